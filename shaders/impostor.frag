@@ -0,0 +1,20 @@
+#version 430 core
+out vec4 FragColor;
+
+in vec3 TexCoord;
+in float Tint;
+
+uniform sampler2DArray impostorAtlas;
+
+const vec3 FogColor = vec3(0.1, 0.1, 0.1);
+
+void main()
+{
+    vec4 color = texture(impostorAtlas, TexCoord);
+    if (color.a < 0.5) {
+        discard;
+    }
+
+    float fog = 1.0 - exp(-gl_FragCoord.z / gl_FragCoord.w * 0.0004);
+    FragColor = vec4(mix(color.rgb * Tint, FogColor, fog), 1.0);
+}
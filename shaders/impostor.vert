@@ -0,0 +1,37 @@
+#version 430 core
+layout(location = 0) in vec3 aPos;
+layout(location = 3) in vec4 iPosScale;
+layout(location = 4) in vec4 iParams;
+
+out vec3 TexCoord;
+out float Tint;
+
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+};
+
+uniform vec2 impostorSize[8];
+
+const int Frames = 8;
+const float TwoPi = 6.28318531;
+
+void main()
+{
+    int layer = int(iParams.z);
+    vec2 size = impostorSize[layer] * iPosScale.w;
+
+    // Cylindrical billboard facing the camera
+    vec3 cameraPos = -transpose(mat3(view)) * view[3].xyz;
+    vec3 toCamera = cameraPos - iPosScale.xyz;
+    vec3 right = normalize(vec3(toCamera.z, 0.0, -toCamera.x));
+    vec3 world = iPosScale.xyz + right * aPos.x * size.x + vec3(0.0, aPos.y * size.y, 0.0);
+
+    // Pick the baked view closest to the direction the tree is seen from
+    float angle = atan(toCamera.x, toCamera.z) - iParams.x;
+    int frame = int(mod(round(angle / (TwoPi / float(Frames))), float(Frames)));
+
+    TexCoord = vec3((float(frame) + aPos.x + 0.5) / float(Frames), aPos.y, float(layer));
+    Tint = mix(0.8, 1.2, iParams.y);
+    gl_Position = projection * view * vec4(world, 1.0);
+}
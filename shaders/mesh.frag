@@ -0,0 +1,15 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec2 TexCoord;
+
+uniform vec4 baseColor;
+
+const vec3 sunDirection = normalize(vec3(0.4, 0.8, 0.3));
+
+void main()
+{
+    float diffuse = max(dot(normalize(Normal), sunDirection), 0.0);
+    FragColor = vec4(baseColor.rgb * (0.25 + 0.75 * diffuse), baseColor.a);
+}
@@ -0,0 +1,49 @@
+#version 330 core
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec2 aNormal;
+layout(location = 2) in vec2 aTexCoord;
+layout(location = 3) in uvec4 aJoints;
+layout(location = 4) in vec4 aWeights;
+
+out vec3 Normal;
+out vec2 TexCoord;
+
+// Three transposed rows per joint, jointCount joints per instance; already includes the character's placement
+uniform samplerBuffer palette;
+uniform int jointCount;
+
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+};
+
+vec3 DecodeOctahedral(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0) {
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
+mat4 JointMatrix(int base, uint joint)
+{
+    int texel = base + int(joint) * 3;
+    return transpose(mat4(texelFetch(palette, texel),
+                          texelFetch(palette, texel + 1),
+                          texelFetch(palette, texel + 2),
+                          vec4(0.0, 0.0, 0.0, 1.0)));
+}
+
+void main()
+{
+    int base = gl_InstanceID * jointCount * 3;
+    mat4 skin = JointMatrix(base, aJoints.x) * aWeights.x +
+                JointMatrix(base, aJoints.y) * aWeights.y +
+                JointMatrix(base, aJoints.z) * aWeights.z +
+                JointMatrix(base, aJoints.w) * aWeights.w;
+
+    gl_Position = projection * view * skin * vec4(aPos, 1.0);
+    Normal      = mat3(skin) * DecodeOctahedral(aNormal);
+    TexCoord    = aTexCoord;
+}
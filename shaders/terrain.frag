@@ -0,0 +1,21 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 WorldPos;
+in vec3 Normal;
+
+const vec3 SunDirection = normalize(vec3(0.4, 0.8, 0.3));
+const vec3 FogColor = vec3(0.1, 0.1, 0.1);
+
+void main()
+{
+    vec3 n = normalize(Normal);
+    vec3 grass = vec3(0.22, 0.30, 0.14);
+    vec3 rock = vec3(0.38, 0.35, 0.32);
+    vec3 albedo = mix(rock, grass, smoothstep(0.7, 0.85, n.y));
+
+    float diffuse = max(dot(n, SunDirection), 0.0) * 0.8 + 0.2;
+    float fog = 1.0 - exp(-gl_FragCoord.z / gl_FragCoord.w * 0.0004);
+
+    FragColor = vec4(mix(albedo * diffuse, FogColor, fog), 1.0);
+}
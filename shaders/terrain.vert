@@ -0,0 +1,62 @@
+#version 330 core
+layout(location = 0) in vec2 aGrid;
+
+out vec3 WorldPos;
+out vec3 Normal;
+
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+};
+
+uniform sampler2DArray heightmap;
+uniform int level;
+uniform int levelCount;
+uniform ivec2 patchOffset;
+uniform ivec2 levelOrigin[10];
+uniform vec2 terrainOrigin;
+uniform float heightScale;
+uniform float heightBase;
+
+const int GridSize = 255;
+const float MorphWidth = 25.0;
+
+float FetchHeight(ivec2 grid, int layer)
+{
+    return texelFetch(heightmap, ivec3(grid & 255, layer), 0).r * heightScale + heightBase;
+}
+
+void main()
+{
+    ivec2 local = patchOffset + ivec2(aGrid);
+    ivec2 grid = levelOrigin[level] + local;
+    float spacing = float(1 << level);
+
+    float height = FetchHeight(grid, level);
+
+    // Blend towards the coarser level over the outer MorphWidth vertices so both sides of a level boundary agree
+    if (level + 1 < levelCount) {
+        vec2 fromCenter = abs(vec2(local) - float(GridSize - 1) * 0.5);
+        float alpha = clamp((max(fromCenter.x, fromCenter.y) - (float(GridSize - 1) * 0.5 - MorphWidth - 1.0)) / MorphWidth, 0.0, 1.0);
+
+        if (alpha > 0.0) {
+            ivec2 c0 = grid >> 1;
+            ivec2 c1 = (grid + 1) >> 1;
+            float coarse = 0.25 * (FetchHeight(c0, level + 1) + FetchHeight(ivec2(c1.x, c0.y), level + 1) +
+                                   FetchHeight(ivec2(c0.x, c1.y), level + 1) + FetchHeight(c1, level + 1));
+            height = mix(height, coarse, alpha);
+        }
+    }
+
+    // Central differences, clamped to the part of the level that is resident in the texture
+    ivec2 lo = levelOrigin[level];
+    ivec2 hi = lo + GridSize - 1;
+    float hL = FetchHeight(clamp(grid - ivec2(1, 0), lo, hi), level);
+    float hR = FetchHeight(clamp(grid + ivec2(1, 0), lo, hi), level);
+    float hD = FetchHeight(clamp(grid - ivec2(0, 1), lo, hi), level);
+    float hU = FetchHeight(clamp(grid + ivec2(0, 1), lo, hi), level);
+    Normal = normalize(vec3(hL - hR, 2.0 * spacing, hD - hU));
+
+    WorldPos = vec3(terrainOrigin.x + float(grid.x) * spacing, height, terrainOrigin.y + float(grid.y) * spacing);
+    gl_Position = projection * view * vec4(WorldPos, 1.0);
+}
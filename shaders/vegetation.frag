@@ -0,0 +1,16 @@
+#version 430 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec3 Color;
+
+const vec3 SunDirection = normalize(vec3(0.4, 0.8, 0.3));
+const vec3 FogColor = vec3(0.1, 0.1, 0.1);
+
+void main()
+{
+    float diffuse = abs(dot(normalize(Normal), SunDirection)) * 0.8 + 0.2;
+    float fog = 1.0 - exp(-gl_FragCoord.z / gl_FragCoord.w * 0.0004);
+
+    FragColor = vec4(mix(Color * diffuse, FogColor, fog), 1.0);
+}
@@ -0,0 +1,29 @@
+#version 430 core
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec3 aColor;
+layout(location = 3) in vec4 iPosScale;
+layout(location = 4) in vec4 iParams;
+
+out vec3 Normal;
+out vec3 Color;
+
+layout(std140) uniform Camera {
+    mat4 view;
+    mat4 projection;
+};
+
+vec3 RotateY(vec3 v, float angle)
+{
+    float s = sin(angle), c = cos(angle);
+    return vec3(c * v.x + s * v.z, v.y, -s * v.x + c * v.z);
+}
+
+void main()
+{
+    vec3 world = iPosScale.xyz + RotateY(aPos * iPosScale.w, iParams.x);
+
+    Normal = RotateY(aNormal, iParams.x);
+    Color = aColor * mix(0.8, 1.2, iParams.y);
+    gl_Position = projection * view * vec4(world, 1.0);
+}
@@ -0,0 +1,131 @@
+#include "AIScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr int64_t Unscheduled = std::numeric_limits<int64_t>::min();
+}
+
+AIScheduler::AIScheduler(const AISchedulerSettings &settings) : settings(settings) {
+}
+
+uint32_t AIScheduler::Add(const glm::vec3 &position) {
+    positions.push_back(position);
+    combat.push_back(0);
+    levels.push_back(ThinkLevel::Dormant);
+    lastThink.push_back(Unscheduled);
+    thinkMs.push_back(0.0);
+    stats.agents = positions.size();
+    return static_cast<uint32_t>(positions.size() - 1);
+}
+
+ThinkLevel AIScheduler::Classify(uint32_t agent, std::span<const glm::vec3> players) const {
+    if (combat[agent]) return ThinkLevel::Full;
+
+    float nearest = std::numeric_limits<float>::max();
+    for (const glm::vec3 &player: players) {
+        glm::vec3 d = player - positions[agent];
+        nearest = std::min(nearest, glm::dot(d, d));
+    }
+    nearest = std::sqrt(nearest);
+
+    const float ranges[] = {settings.fullRange, settings.reducedRange, settings.lowRange};
+    auto levelAt = [&](float scale) {
+        int level = 0;
+        while (level < 3 && nearest > ranges[level] * scale) level++;
+        return level;
+    };
+
+    // Promote as soon as the agent is inside a range, demote only once it is clear of the margin
+    const int current = static_cast<int>(levels[agent]);
+    const int nearer = levelAt(1.0f);
+    if (nearer < current) return static_cast<ThinkLevel>(nearer);
+    return static_cast<ThinkLevel>(std::max(levelAt(settings.demoteMargin), current));
+}
+
+void AIScheduler::Update(std::span<const glm::vec3> players, float tickSeconds, const ThinkFn &think, JobSystem *jobs) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(settings.budgetMs));
+
+    tick++;
+    const size_t count = positions.size();
+
+    auto classify = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) levels[i] = Classify(static_cast<uint32_t>(i), players);
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(count, 512, classify);
+    } else {
+        classify(0, count);
+    }
+
+    stats.agentsPerLevel = {};
+    due.clear();
+    for (uint32_t agent = 0; agent < count; agent++) {
+        const size_t level = static_cast<size_t>(levels[agent]);
+        const int64_t interval = settings.intervals[level];
+        stats.agentsPerLevel[level]++;
+
+        // Consecutive agents land on consecutive phases of the interval
+        if (lastThink[agent] == Unscheduled) lastThink[agent] = tick - 1 - (agent * 2654435761u) % static_cast<uint64_t>(interval);
+
+        const int64_t waited = tick - lastThink[agent];
+        if (waited >= interval) due.push_back({agent, static_cast<float>(waited) / static_cast<float>(interval)});
+    }
+
+    // Most overdue first; among equals the higher level, which is nearer a player
+    std::sort(due.begin(), due.end(), [&](const Due &a, const Due &b) {
+        return a.lateness != b.lateness ? a.lateness > b.lateness : levels[a.agent] < levels[b.agent];
+    });
+
+    // Slots claim agents in priority order, so the ones that thought are always a prefix of the list
+    std::atomic<size_t> next{0};
+    auto run = [&](size_t slotBegin, size_t slotEnd) {
+        for (size_t slot = slotBegin; slot < slotEnd; slot++) {
+            while (Clock::now() < deadline) {
+                size_t i = next.fetch_add(1);
+                if (i >= due.size()) break;
+
+                const uint32_t agent = due[i].agent;
+                Clock::time_point thinkStart = Clock::now();
+                think(agent, levels[agent], static_cast<float>(tick - lastThink[agent]) * tickSeconds);
+                thinkMs[agent] = std::chrono::duration<double, std::milli>(Clock::now() - thinkStart).count();
+            }
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(jobs->WorkerCount() + 1, 1, run);
+    } else {
+        run(0, 1);
+    }
+
+    const size_t thought = std::min(next.load(), due.size());
+    stats.thoughtPerLevel = {};
+    for (size_t i = 0; i < thought; i++) {
+        const uint32_t agent = due[i].agent;
+        const size_t level = static_cast<size_t>(levels[agent]);
+        const int64_t late = tick - lastThink[agent] - settings.intervals[level];
+
+        stats.thoughtPerLevel[level]++;
+        stats.worstLateTicks = std::max(stats.worstLateTicks, static_cast<uint32_t>(late));
+        stats.worstThinkMs = std::max(stats.worstThinkMs, thinkMs[agent]);
+        lastThink[agent] = tick;
+    }
+
+    stats.due = due.size();
+    stats.deferred = due.size() - thought;
+    stats.lastUpdateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    stats.worstUpdateMs = std::max(stats.worstUpdateMs, stats.lastUpdateMs);
+    stats.updates++;
+    if (stats.lastUpdateMs > settings.budgetMs) {
+        stats.overruns++;
+        stats.worstOverrunMs = std::max(stats.worstOverrunMs, stats.lastUpdateMs - settings.budgetMs);
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+
+// How much thinking an AI gets: how often it runs and how expensive a behaviour it should pick
+enum class ThinkLevel : uint8_t {
+    Full,                                     // near a player or in combat: every tick
+    Reduced,
+    Low,
+    Dormant,                                  // far from everyone: coarse, rare updates
+};
+
+constexpr size_t ThinkLevelCount = 4;
+
+struct AISchedulerSettings {
+    // Distance to the nearest player below which an agent is at each level; beyond lowRange it is Dormant
+    float fullRange = 150.0f;
+    float reducedRange = 400.0f;
+    float lowRange = 1000.0f;
+
+    // Ticks between thinks at each level, Full first
+    std::array<uint32_t, ThinkLevelCount> intervals = {1, 4, 16, 64};
+
+    // Agents only drop a level once this much past its range, so one walking along a boundary does not flap
+    float demoteMargin = 1.1f;
+
+    double budgetMs = 2.0;                    // per Update()
+};
+
+// Decides which AIs think on each tick. Every agent gets a level from its distance to the nearest player (or Full
+// while in combat) and is due once its level's interval has passed since it last thought; new agents start at a
+// staggered phase of their interval so a level's thinks spread evenly over the ticks. Update() runs the due agents most
+// overdue first across the job system until the time budget is spent, and leaves the rest due for the next tick,
+// where they come first. A think that starts before the deadline is finished, so Update() can overrun by at most one
+// think per thread; overruns are counted.
+class AIScheduler {
+public:
+    // Called from worker threads, so it must only touch the agent's own state (or be thread safe). dt is the time
+    // since the agent last thought, for integrating over the longer steps of the lower levels.
+    using ThinkFn = std::function<void(uint32_t agent, ThinkLevel level, float dt)>;
+
+    struct Stats {
+        size_t agents = 0;
+        std::array<size_t, ThinkLevelCount> agentsPerLevel = {};
+        std::array<size_t, ThinkLevelCount> thoughtPerLevel = {};   // by the last Update()
+        size_t due = 0;
+        size_t deferred = 0;                  // due but left for a later tick
+        double lastUpdateMs = 0.0;
+        double worstUpdateMs = 0.0;
+        double worstThinkMs = 0.0;            // slowest single think so far
+        uint32_t worstLateTicks = 0;          // longest any agent has waited past its interval
+        size_t updates = 0;
+        size_t overruns = 0;                  // updates that ran past the budget
+        double worstOverrunMs = 0.0;
+    };
+
+    explicit AIScheduler(const AISchedulerSettings &settings = AISchedulerSettings());
+
+    uint32_t Add(const glm::vec3 &position);
+    void SetPosition(uint32_t agent, const glm::vec3 &position) { positions[agent] = position; }
+    void SetInCombat(uint32_t agent, bool inCombat) { combat[agent] = inCombat; }
+
+    ThinkLevel LevelOf(uint32_t agent) const { return levels[agent]; }
+    size_t AgentCount() const { return positions.size(); }
+
+    void Update(std::span<const glm::vec3> players, float tickSeconds, const ThinkFn &think, JobSystem *jobs = nullptr);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Due {
+        uint32_t agent;
+        float lateness;                       // ticks waited / interval, at least 1
+    };
+
+    ThinkLevel Classify(uint32_t agent, std::span<const glm::vec3> players) const;
+
+    AISchedulerSettings settings;
+
+    std::vector<glm::vec3> positions;
+    std::vector<uint8_t> combat;
+    std::vector<ThinkLevel> levels;
+    std::vector<int64_t> lastThink;           // tick of the last think; unset until the agent is first classified
+    int64_t tick = 0;
+
+    std::vector<Due> due;
+    std::vector<double> thinkMs;
+
+    Stats stats;
+};
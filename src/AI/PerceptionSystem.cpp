@@ -0,0 +1,134 @@
+#include "PerceptionSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "../Terrain/Heightfield.h"
+
+namespace {
+    // Unchecked pairs count as this many lifetimes old, so they come first without drowning out threat and range
+    constexpr float MaxStaleness = 8.0f;
+
+    // Cached pairs untouched for this many lifetimes are dropped every CleanupInterval updates
+    constexpr float ForgetAfter = 8.0f;
+    constexpr uint32_t CleanupInterval = 64;
+}
+
+PerceptionSystem::PerceptionSystem(const StaticBvh &world, const Heightfield *terrain, const PerceptionSettings &settings)
+    : world(world), terrain(terrain), settings(settings) {
+}
+
+PerceptionResult PerceptionSystem::Query(uint32_t observer, const glm::vec3 &eye, uint32_t target, const glm::vec3 &point, float threat) {
+    queries++;
+
+    const uint64_t key = (static_cast<uint64_t>(observer) << 32) | target;
+    Entry &entry = cache[key];
+    const float age = static_cast<float>(time - entry.time);
+
+    if (age <= settings.timeToLive) {
+        cacheHits++;
+        return {entry.visibility, age};
+    }
+
+    const float distance = glm::length(point - eye);
+    if (distance > settings.maxRange) {
+        entry.time = time;
+        entry.visibility = Visibility::Hidden;
+        return {Visibility::Hidden, 0.0f};
+    }
+
+    if (entry.queuedAt != updateCount) {
+        entry.queuedAt = updateCount;
+        float staleness = std::min(age / settings.timeToLive, MaxStaleness);
+        pending.push_back({key, eye, point, threat * staleness / std::max(distance, 1.0f), std::atan2(point.z - eye.z, point.x - eye.x)});
+    }
+
+    return {entry.visibility, age};
+}
+
+bool PerceptionSystem::TerrainBlocks(const glm::vec3 &from, const glm::vec3 &to) const {
+    const glm::vec3 d = to - from;
+    const int steps = std::max(1, static_cast<int>(std::ceil(glm::length(glm::vec2(d.x, d.z)) / settings.terrainStep)));
+
+    for (int k = 1; k < steps; k++) {
+        glm::vec3 p = from + d * (static_cast<float>(k) / static_cast<float>(steps));
+        if (p.y < terrain->HeightAt(p.x, p.z)) return true;
+    }
+    return false;
+}
+
+void PerceptionSystem::Update(double now, JobSystem *jobs) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Most urgent first up to the budget; the rest queue again when next asked about
+    size_t deferred = 0;
+    if (pending.size() > settings.raysPerTick) {
+        std::nth_element(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(settings.raysPerTick), pending.end(),
+                         [](const Pending &a, const Pending &b) { return a.priority > b.priority; });
+        deferred = pending.size() - settings.raysPerTick;
+        pending.resize(settings.raysPerTick);
+    }
+
+    // Packets are consecutive runs, so group by observer and sweep round each eye by direction
+    std::sort(pending.begin(), pending.end(), [](const Pending &a, const Pending &b) {
+        uint32_t observerA = static_cast<uint32_t>(a.key >> 32), observerB = static_cast<uint32_t>(b.key >> 32);
+        return observerA != observerB ? observerA < observerB : a.azimuth < b.azimuth;
+    });
+
+    rays.resize(pending.size());
+    occluded.resize(pending.size());
+    for (size_t i = 0; i < pending.size(); i++) {
+        rays[i].origin = pending[i].eye;
+        rays[i].direction = pending[i].point - pending[i].eye;
+        rays[i].tMax = 1.0f;
+    }
+
+    world.OccludedBatch(rays, occluded, jobs);
+
+    if (terrain) {
+        auto march = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                if (!occluded[i] && TerrainBlocks(pending[i].eye, pending[i].point)) occluded[i] = 1;
+            }
+        };
+
+        if (jobs) {
+            jobs->ParallelFor(pending.size(), 256, march);
+        } else {
+            march(0, pending.size());
+        }
+    }
+
+    for (size_t i = 0; i < pending.size(); i++) {
+        Entry &entry = cache[pending[i].key];
+        entry.time = now;
+        entry.visibility = occluded[i] ? Visibility::Hidden : Visibility::Visible;
+    }
+
+    if (++updateCount % CleanupInterval == 0) {
+        const double forget = now - static_cast<double>(ForgetAfter * settings.timeToLive);
+        std::erase_if(cache, [&](const auto &item) { return item.second.time < forget; });
+    }
+
+    stats.queries = queries;
+    stats.cacheHits = cacheHits;
+    stats.cast = pending.size();
+    stats.deferred = deferred;
+    stats.packets = (pending.size() + StaticBvh::PacketSize - 1) / StaticBvh::PacketSize;
+    stats.cachedPairs = cache.size();
+    stats.castMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    queries = cacheHits = 0;
+    pending.clear();
+    time = now;
+}
+
+void PerceptionSystem::Forget(uint32_t entity) {
+    std::erase_if(cache, [&](const auto &item) {
+        return static_cast<uint32_t>(item.first >> 32) == entity || static_cast<uint32_t>(item.first) == entity;
+    });
+    std::erase_if(pending, [&](const Pending &p) {
+        return static_cast<uint32_t>(p.key >> 32) == entity || static_cast<uint32_t>(p.key) == entity;
+    });
+}
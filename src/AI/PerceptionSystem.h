@@ -0,0 +1,91 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+#include "../Physics/StaticBvh.h"
+
+class Heightfield;
+
+enum class Visibility : uint8_t {
+    Unknown,                                  // never checked
+    Visible,
+    Hidden,
+};
+
+struct PerceptionResult {
+    Visibility visibility = Visibility::Unknown;
+    float age = INFINITY;                     // seconds since the line was last cast
+};
+
+struct PerceptionSettings {
+    float timeToLive = 0.5f;                  // seconds a result is trusted
+    size_t raysPerTick = 2048;
+    float maxRange = 800.0f;                  // further targets are Hidden without a ray
+    float terrainStep = 2.0f;                 // heightfield sample spacing along a line
+};
+
+// Line-of-sight checks for AI. Observers ask about their candidate targets every tick and get the cached answer for
+// the pair; answers older than the time to live queue a recheck. Update() casts the most urgent rechecks (near,
+// threatening, long unchecked) up to a per-tick ray budget, ordered into coherent packets for
+// StaticBvh::OccludedBatch, then checks the surviving lines against the terrain. The rest wait for a later tick, so
+// the cost per tick stays flat however many pairs are asked about.
+class PerceptionSystem {
+public:
+    struct Stats {
+        size_t queries = 0;                   // Query() calls before the last Update()
+        size_t cacheHits = 0;
+        size_t cast = 0;                      // lines cast by the last Update()
+        size_t deferred = 0;                  // stale pairs left for a later tick
+        size_t packets = 0;
+        size_t cachedPairs = 0;
+        double castMs = 0.0;
+    };
+
+    PerceptionSystem(const StaticBvh &world, const Heightfield *terrain, const PerceptionSettings &settings = PerceptionSettings());
+
+    // threat scales the recheck priority, e.g. higher for a target that is firing
+    PerceptionResult Query(uint32_t observer, const glm::vec3 &eye, uint32_t target, const glm::vec3 &point, float threat = 1.0f);
+
+    // Casts this tick's rechecks and stamps them with now (seconds)
+    void Update(double now, JobSystem *jobs = nullptr);
+
+    // Drops every cached pair involving entity, e.g. when it dies
+    void Forget(uint32_t entity);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Entry {
+        double time = -INFINITY;
+        Visibility visibility = Visibility::Unknown;
+        uint32_t queuedAt = 0xffffffffu;      // updateCount when last queued, so a pair queues once per tick
+    };
+
+    struct Pending {
+        uint64_t key;
+        glm::vec3 eye, point;
+        float priority;
+        float azimuth;
+    };
+
+    bool TerrainBlocks(const glm::vec3 &from, const glm::vec3 &to) const;
+
+    const StaticBvh &world;
+    const Heightfield *terrain;
+    PerceptionSettings settings;
+
+    std::unordered_map<uint64_t, Entry> cache;   // observer << 32 | target
+    std::vector<Pending> pending;
+    std::vector<Ray> rays;
+    std::vector<uint8_t> occluded;
+    double time = 0.0;
+    uint32_t updateCount = 0;
+    size_t queries = 0, cacheHits = 0;
+
+    Stats stats;
+};
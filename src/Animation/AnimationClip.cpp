@@ -0,0 +1,70 @@
+#include "AnimationClip.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "KeyQuantization.h"
+
+AnimationClip::AnimationClip(const MeshFile &file, uint32_t clip) {
+    const ClipRecord &record = file.Clips()[clip];
+
+    name.assign(record.name, strnlen(record.name, sizeof(record.name)));
+    duration = record.duration;
+
+    for (uint32_t t = 0; t < record.trackCount; t++) {
+        TrackRecord track = file.Tracks()[record.firstTrack + t];
+        const uint16_t *times = file.KeyTimes() + track.firstKey;
+        const uint16_t *values = file.KeyValues() + size_t(track.firstKey) * 3;
+
+        track.firstKey = static_cast<uint32_t>(keyTimes.size());
+        keyTimes.insert(keyTimes.end(), times, times + track.keyCount);
+        keyValues.insert(keyValues.end(), values, values + size_t(track.keyCount) * 3);
+        tracks.push_back(track);
+    }
+}
+
+size_t AnimationClip::SizeBytes() const {
+    return tracks.size() * sizeof(TrackRecord) + (keyTimes.size() + keyValues.size()) * sizeof(uint16_t);
+}
+
+void AnimationClip::Sample(float time, JointPose *pose) const {
+    float phase = duration > 0.0f ? std::fmod(time, duration) / duration : 0.0f;
+    phase = phase < 0.0f ? phase + 1.0f : phase;
+    const float t = phase * 65535.0f;
+
+    for (const TrackRecord &track: tracks) {
+        const uint16_t *times = keyTimes.data() + track.firstKey;
+        const uint16_t *values = keyValues.data() + size_t(track.firstKey) * 3;
+
+        // Keys bracketing t; clamped at both ends of the track
+        uint32_t next = static_cast<uint32_t>(std::upper_bound(times, times + track.keyCount, static_cast<uint16_t>(t)) - times);
+        uint32_t k1 = std::min(next, track.keyCount - 1);
+        uint32_t k0 = next > 0 ? next - 1 : 0;
+        float span = static_cast<float>(times[k1]) - static_cast<float>(times[k0]);
+        float alpha = span > 0.0f ? std::clamp((t - static_cast<float>(times[k0])) / span, 0.0f, 1.0f) : 0.0f;
+
+        JointPose &out = pose[track.joint];
+
+        if (track.channel == AnimationRotation) {
+            glm::quat a = DecodeRotationKey(values + k0 * 3);
+            glm::quat b = DecodeRotationKey(values + k1 * 3);
+            b = glm::dot(a, b) < 0.0f ? -b : b;
+            out.rotation = glm::normalize(a * (1.0f - alpha) + b * alpha);
+        } else {
+            glm::vec3 a = DecodeRangeKey(values + k0 * 3, track.rangeMin, track.rangeExtent);
+            glm::vec3 b = DecodeRangeKey(values + k1 * 3, track.rangeMin, track.rangeExtent);
+            (track.channel == AnimationTranslation ? out.translation : out.scale) = glm::mix(a, b, alpha);
+        }
+    }
+}
+
+std::vector<AnimationClip> LoadAnimationClips(const MeshFile &file) {
+    std::vector<AnimationClip> clips;
+
+    for (uint32_t i = 0; i < file.Header().clipCount; i++) {
+        clips.emplace_back(file, i);
+    }
+
+    return clips;
+}
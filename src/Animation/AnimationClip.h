@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Skeleton.h"
+#include "../Asset/MeshFormat.h"
+
+// One compressed clip, copied out of a cooked mesh so the file mapping can be released. Keys stay quantized in
+// memory (6 bytes + 2 bytes of time each) and are decoded while sampling.
+class AnimationClip {
+public:
+    AnimationClip(const MeshFile &file, uint32_t clip);
+
+    const std::string &Name() const { return name; }
+    float Duration() const { return duration; }
+    size_t KeyCount() const { return keyTimes.size(); }
+    size_t SizeBytes() const;
+
+    // Writes the animated channels at time (wrapped into the clip) into pose; channels without a track are left
+    // untouched, so start from the skeleton's bind pose.
+    void Sample(float time, JointPose *pose) const;
+
+private:
+    std::string name;
+    float duration;
+    std::vector<TrackRecord> tracks;          // firstKey relative to the arrays below
+    std::vector<uint16_t> keyTimes;
+    std::vector<uint16_t> keyValues;
+};
+
+std::vector<AnimationClip> LoadAnimationClips(const MeshFile &file);
@@ -0,0 +1,161 @@
+#include "ClipCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "KeyQuantization.h"
+
+namespace {
+    using Path = GltfAnimationChannel::Path;
+
+    glm::quat ToQuat(const glm::vec4 &v) {
+        return glm::normalize(glm::quat(v.w, v.x, v.y, v.z));
+    }
+
+    float KeyError(Path path, const glm::vec4 &a, const glm::vec4 &b) {
+        if (path == Path::Rotation) {
+            float d = std::min(std::abs(glm::dot(ToQuat(a), ToQuat(b))), 1.0f);
+            return 2.0f * std::acos(d);
+        }
+
+        return glm::length(glm::vec3(a) - glm::vec3(b));
+    }
+
+    glm::vec4 Interpolate(Path path, const glm::vec4 &a, const glm::vec4 &b, float alpha) {
+        if (path == Path::Rotation) {
+            glm::vec4 target = glm::dot(a, b) < 0.0f ? -b : b;
+            return glm::normalize(glm::mix(a, target, alpha));
+        }
+
+        return glm::mix(a, b, alpha);
+    }
+
+    // Greedy reduction: extend each segment from the last kept key as long as every key it skips is reproduced
+    std::vector<size_t> ReduceKeys(Path path, const std::vector<float> &times, const std::vector<glm::vec4> &values,
+                                   float tolerance) {
+        std::vector<size_t> kept = {0};
+        size_t anchor = 0;
+
+        for (size_t end = 2; end < times.size(); end++) {
+            bool fits = true;
+
+            for (size_t k = anchor + 1; k < end && fits; k++) {
+                float span = times[end] - times[anchor];
+                float alpha = span > 0.0f ? (times[k] - times[anchor]) / span : 0.0f;
+                fits = KeyError(path, Interpolate(path, values[anchor], values[end], alpha), values[k]) <= tolerance;
+            }
+
+            if (!fits) {
+                anchor = end - 1;
+                kept.push_back(anchor);
+            }
+        }
+
+        if (times.size() > 1) {
+            kept.push_back(times.size() - 1);
+        }
+
+        return kept;
+    }
+}
+
+CompressedClip CompressClip(const GltfScene &scene, const GltfAnimation &animation, const GltfSkin &skin,
+                            const ClipCompressionOptions &options) {
+    CompressedClip clip;
+    clip.name = animation.name;
+
+    float start = INFINITY, end = -INFINITY;
+    for (const GltfAnimationChannel &channel: animation.channels) {
+        start = std::min(start, channel.times.front());
+        end = std::max(end, channel.times.back());
+    }
+
+    if (animation.channels.empty()) {
+        return clip;
+    }
+
+    clip.duration = std::max(end - start, 0.0f);
+    const float timeScale = clip.duration > 0.0f ? 65535.0f / clip.duration : 0.0f;
+
+    for (const GltfAnimationChannel &channel: animation.channels) {
+        auto joint = std::find(skin.joints.begin(), skin.joints.end(), channel.node);
+        if (joint == skin.joints.end()) continue;
+
+        clip.sourceKeys += channel.times.size();
+
+        // Times relative to the clip; STEP becomes a pair of keys one time unit apart at every change
+        std::vector<float> times;
+        std::vector<glm::vec4> values;
+
+        for (size_t k = 0; k < channel.times.size(); k++) {
+            float time = channel.times[k] - start;
+
+            if (channel.step && k > 0) {
+                times.push_back(std::max(time - 1.0f / std::max(timeScale, 1.0f), times.back()));
+                values.push_back(values.back());
+            }
+
+            times.push_back(time);
+            values.push_back(channel.values[k]);
+        }
+
+        const GltfNode &node = scene.nodes[channel.node];
+        glm::vec4 bind = channel.path == Path::Translation ? glm::vec4(node.translation, 0.0f) :
+                         channel.path == Path::Scale ? glm::vec4(node.scale, 0.0f) :
+                         glm::vec4(node.rotation.x, node.rotation.y, node.rotation.z, node.rotation.w);
+
+        float tolerance = channel.path == Path::Translation ? options.translationTolerance :
+                          channel.path == Path::Rotation ? options.rotationTolerance : options.scaleTolerance;
+
+        std::vector<size_t> kept = ReduceKeys(channel.path, times, values, tolerance);
+
+        bool atBind = std::all_of(kept.begin(), kept.end(), [&](size_t k) {
+            return KeyError(channel.path, values[k], bind) <= tolerance;
+        });
+        if (atBind) continue;
+
+        // A constant track needs one key
+        if (kept.size() == 2 && KeyError(channel.path, values[kept[0]], values[kept[1]]) <= tolerance) {
+            kept.pop_back();
+        }
+
+        TrackRecord track{};
+        track.joint = static_cast<uint32_t>(joint - skin.joints.begin());
+        track.channel = channel.path == Path::Translation ? AnimationTranslation :
+                        channel.path == Path::Rotation ? AnimationRotation : AnimationScale;
+        track.firstKey = static_cast<uint32_t>(clip.keyTimes.size());
+        track.keyCount = static_cast<uint32_t>(kept.size());
+
+        if (channel.path != Path::Rotation) {
+            glm::vec3 lo(INFINITY), hi(-INFINITY);
+            for (size_t k: kept) {
+                lo = glm::min(lo, glm::vec3(values[k]));
+                hi = glm::max(hi, glm::vec3(values[k]));
+            }
+
+            for (int i = 0; i < 3; i++) {
+                track.rangeMin[i] = lo[i];
+                track.rangeExtent[i] = hi[i] - lo[i];
+            }
+        }
+
+        for (size_t k: kept) {
+            uint16_t encoded[3];
+
+            if (channel.path == Path::Rotation) {
+                EncodeRotationKey(ToQuat(values[k]), encoded);
+            } else {
+                glm::vec3 rangeMin(track.rangeMin[0], track.rangeMin[1], track.rangeMin[2]);
+                glm::vec3 rangeExtent(track.rangeExtent[0], track.rangeExtent[1], track.rangeExtent[2]);
+                EncodeRangeKey(glm::vec3(values[k]), rangeMin, rangeExtent, encoded);
+            }
+
+            clip.keyTimes.push_back(static_cast<uint16_t>(std::lround(std::clamp(times[k] * timeScale, 0.0f, 65535.0f))));
+            clip.keyValues.insert(clip.keyValues.end(), encoded, encoded + 3);
+        }
+
+        clip.tracks.push_back(track);
+    }
+
+    return clip;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../Asset/Gltf.h"
+#include "../Asset/MeshFormat.h"
+
+struct ClipCompressionOptions {
+    float translationTolerance = 0.0005f;     // model units
+    float rotationTolerance = 0.001f;         // radians
+    float scaleTolerance = 0.0005f;
+};
+
+struct CompressedClip {
+    std::string name;
+    float duration = 0.0f;
+    std::vector<TrackRecord> tracks;          // firstKey relative to keyTimes
+    std::vector<uint16_t> keyTimes;
+    std::vector<uint16_t> keyValues;          // 3 per key
+    size_t sourceKeys = 0;
+};
+
+// Converts the channels of animation that target joints of skin into quantized tracks. Keys that linear
+// interpolation between their kept neighbours reproduces within tolerance are dropped, and tracks that never leave
+// the joint's bind pose are dropped entirely. Scene nodes are addressed by their glTF index.
+CompressedClip CompressClip(const GltfScene &scene, const GltfAnimation &animation, const GltfSkin &skin,
+                            const ClipCompressionOptions &options = {});
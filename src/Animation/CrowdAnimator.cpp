@@ -0,0 +1,58 @@
+#include "CrowdAnimator.h"
+
+#include <chrono>
+#include <stdexcept>
+
+CrowdAnimator::CrowdAnimator(const Skeleton &skeleton, const std::vector<AnimationClip> &clips)
+    : skeleton(skeleton), clips(clips) {
+    if (clips.empty()) {
+        throw std::runtime_error("CrowdAnimator: At Least One Clip Required");
+    }
+}
+
+size_t CrowdAnimator::Add(const AnimatedInstance &instance) {
+    if (instance.clipA >= clips.size() || instance.clipB >= clips.size()) {
+        throw std::runtime_error("CrowdAnimator: Clip Index Out of Range");
+    }
+
+    instances.push_back(instance);
+    palettes.resize(instances.size() * skeleton.JointCount() * 3);
+    return instances.size() - 1;
+}
+
+void CrowdAnimator::AnimateRange(size_t begin, size_t end, float dt) {
+    thread_local std::vector<JointPose> poseA, poseB;
+    const size_t jointCount = skeleton.JointCount();
+
+    for (size_t i = begin; i < end; i++) {
+        AnimatedInstance &instance = instances[i];
+        instance.timeA += dt * instance.speedA;
+        instance.timeB += dt * instance.speedB;
+
+        poseA = skeleton.BindPose();
+        clips[instance.clipA].Sample(instance.timeA, poseA.data());
+
+        // Pure states skip the second sample entirely
+        if (instance.blend > 0.0f) {
+            poseB = skeleton.BindPose();
+            clips[instance.clipB].Sample(instance.timeB, poseB.data());
+            BlendPoses(poseA.data(), poseB.data(), instance.blend, jointCount, poseA.data());
+        }
+
+        skeleton.ComputePalette(poseA.data(), instance.world, palettes.data() + i * jointCount * 3);
+    }
+}
+
+void CrowdAnimator::Update(float dt, JobSystem *jobs) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (jobs) {
+        jobs->ParallelFor(instances.size(), 16, [this, dt](size_t begin, size_t end) { AnimateRange(begin, end, dt); });
+    } else {
+        AnimateRange(0, instances.size(), dt);
+    }
+
+    stats.instances = instances.size();
+    stats.updateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.msPer500 = instances.empty() ? 0.0 : stats.updateMs * 500.0 / static_cast<double>(instances.size());
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "AnimationClip.h"
+#include "Skeleton.h"
+#include "../Core/JobSystem.h"
+
+// Per-character animation state: two clips cross-faded by blend (0 = clipA only)
+struct AnimatedInstance {
+    glm::mat4 world = glm::mat4(1.0f);
+    uint32_t clipA = 0;
+    uint32_t clipB = 0;
+    float timeA = 0.0f;
+    float timeB = 0.0f;
+    float speedA = 1.0f;
+    float speedB = 1.0f;
+    float blend = 0.0f;
+};
+
+struct CrowdAnimatorStats {
+    size_t instances = 0;
+    double updateMs = 0.0;                    // last Update(), wall clock
+    double msPer500 = 0.0;                    // updateMs scaled to 500 characters
+};
+
+// Animates many characters sharing one skeleton and clip set. Update samples, blends and writes one skinning palette
+// per instance into a single array, ready to be copied to the GPU in one go.
+class CrowdAnimator {
+public:
+    CrowdAnimator(const Skeleton &skeleton, const std::vector<AnimationClip> &clips);
+
+    size_t Add(const AnimatedInstance &instance);
+    AnimatedInstance &Instance(size_t index) { return instances[index]; }
+    size_t InstanceCount() const { return instances.size(); }
+    size_t JointCount() const { return skeleton.JointCount(); }
+
+    // Advances clip times by dt and rebuilds every palette. Spread over the job system when one is given.
+    void Update(float dt, JobSystem *jobs);
+
+    // JointCount() * 3 rows per instance, instance order
+    const std::vector<glm::vec4> &Palettes() const { return palettes; }
+    const CrowdAnimatorStats &Stats() const { return stats; }
+
+private:
+    void AnimateRange(size_t begin, size_t end, float dt);
+
+    const Skeleton &skeleton;
+    const std::vector<AnimationClip> &clips;
+    std::vector<AnimatedInstance> instances;
+    std::vector<glm::vec4> palettes;
+    CrowdAnimatorStats stats;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// 48-bit animation key encodings shared by the cooker and the runtime sampler.
+
+// Smallest-three: the largest quaternion component is dropped (and made positive, q and -q being the same rotation),
+// the other three lie in [-1/sqrt2, 1/sqrt2] and get 15 bits each. The dropped index lives in the two spare top bits.
+inline void EncodeRotationKey(glm::quat q, uint16_t out[3]) {
+    float c[4] = {q.x, q.y, q.z, q.w};
+    int largest = 0;
+
+    for (int i = 1; i < 4; i++) {
+        if (std::abs(c[i]) > std::abs(c[largest])) largest = i;
+    }
+
+    float sign = c[largest] < 0.0f ? -1.0f : 1.0f;
+    float length = std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2] + c[3] * c[3]);
+
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i == largest) continue;
+
+        float v = std::clamp(c[i] * sign / length * 1.41421356f, -1.0f, 1.0f);
+        out[k++] = static_cast<uint16_t>(std::lround((v * 0.5f + 0.5f) * 32767.0f));
+    }
+
+    out[0] = static_cast<uint16_t>(out[0] | ((largest & 1) << 15));
+    out[1] = static_cast<uint16_t>(out[1] | ((largest >> 1) << 15));
+}
+
+inline glm::quat DecodeRotationKey(const uint16_t in[3]) {
+    int largest = (in[0] >> 15) | ((in[1] >> 15) << 1);
+    float c[4];
+    float sum = 0.0f;
+
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i == largest) continue;
+
+        float v = static_cast<float>(in[k++] & 0x7fff) / 32767.0f * 2.0f - 1.0f;
+        c[i] = v * 0.70710678f;
+        sum += c[i] * c[i];
+    }
+
+    c[largest] = std::sqrt(std::max(1.0f - sum, 0.0f));
+    return {c[3], c[0], c[1], c[2]};
+}
+
+// Translation and scale: unorm16 per component within the track's [min, min + extent] box
+inline void EncodeRangeKey(const glm::vec3 &v, const glm::vec3 &rangeMin, const glm::vec3 &rangeExtent, uint16_t out[3]) {
+    for (int i = 0; i < 3; i++) {
+        float t = rangeExtent[i] > 0.0f ? (v[i] - rangeMin[i]) / rangeExtent[i] : 0.0f;
+        out[i] = static_cast<uint16_t>(std::lround(std::clamp(t, 0.0f, 1.0f) * 65535.0f));
+    }
+}
+
+inline glm::vec3 DecodeRangeKey(const uint16_t in[3], const float rangeMin[3], const float rangeExtent[3]) {
+    return {rangeMin[0] + rangeExtent[0] * (static_cast<float>(in[0]) / 65535.0f),
+            rangeMin[1] + rangeExtent[1] * (static_cast<float>(in[1]) / 65535.0f),
+            rangeMin[2] + rangeExtent[2] * (static_cast<float>(in[2]) / 65535.0f)};
+}
@@ -0,0 +1,92 @@
+#include "Skeleton.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+static glm::mat4 ComposeTransform(const JointPose &pose) {
+    glm::mat4 m = glm::mat4_cast(pose.rotation);
+    m[0] *= pose.scale.x;
+    m[1] *= pose.scale.y;
+    m[2] *= pose.scale.z;
+    m[3] = glm::vec4(pose.translation, 1.0f);
+    return m;
+}
+
+static JointPose NodePose(const NodeRecord &node) {
+    JointPose pose;
+    pose.translation = glm::make_vec3(node.translation);
+    pose.rotation = glm::quat(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]);
+    pose.scale = glm::make_vec3(node.scale);
+    return pose;
+}
+
+Skeleton::Skeleton(const MeshFile &file, uint32_t skin) {
+    const MeshFileHeader &header = file.Header();
+
+    if (skin >= header.skinCount) {
+        throw std::runtime_error("Skeleton: Mesh Has No Skin " + std::to_string(skin));
+    }
+
+    const SkinRecord &record = file.Skins()[skin];
+    const NodeRecord *nodes = file.Nodes();
+    std::vector<int> jointOfNode(header.nodeCount, -1);
+
+    for (uint32_t j = 0; j < record.jointCount; j++) {
+        const JointRecord &joint = file.Joints()[record.firstJoint + j];
+        jointOfNode[joint.node] = static_cast<int>(j);
+        inverseBind.push_back(glm::make_mat4(joint.inverseBind));
+        bindPose.push_back(NodePose(nodes[joint.node]));
+        order.push_back(j);
+    }
+
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return file.Joints()[record.firstJoint + a].node < file.Joints()[record.firstJoint + b].node;
+    });
+
+    parents.assign(record.jointCount, -1);
+    rootTransforms.assign(record.jointCount, glm::mat4(1.0f));
+
+    for (uint32_t j = 0; j < record.jointCount; j++) {
+        int32_t parentNode = nodes[file.Joints()[record.firstJoint + j].node].parent;
+
+        if (parentNode >= 0 && jointOfNode[parentNode] >= 0) {
+            parents[j] = jointOfNode[parentNode];
+            continue;
+        }
+
+        // Non-joint ancestors (armature nodes and the like) are static: fold them into one transform
+        for (int32_t n = parentNode; n >= 0; n = nodes[n].parent) {
+            rootTransforms[j] = ComposeTransform(NodePose(nodes[n])) * rootTransforms[j];
+        }
+    }
+}
+
+void Skeleton::ComputePalette(const JointPose *pose, const glm::mat4 &world, glm::vec4 *palette) const {
+    thread_local std::vector<glm::mat4> modelSpace;
+    modelSpace.resize(parents.size());
+
+    for (uint32_t j: order) {
+        glm::mat4 local = ComposeTransform(pose[j]);
+        modelSpace[j] = parents[j] >= 0 ? modelSpace[parents[j]] * local : rootTransforms[j] * local;
+    }
+
+    for (size_t j = 0; j < parents.size(); j++) {
+        glm::mat4 skin = world * modelSpace[j] * inverseBind[j];
+
+        palette[j * 3 + 0] = glm::vec4(skin[0][0], skin[1][0], skin[2][0], skin[3][0]);
+        palette[j * 3 + 1] = glm::vec4(skin[0][1], skin[1][1], skin[2][1], skin[3][1]);
+        palette[j * 3 + 2] = glm::vec4(skin[0][2], skin[1][2], skin[2][2], skin[3][2]);
+    }
+}
+
+void BlendPoses(const JointPose *a, const JointPose *b, float weight, size_t count, JointPose *out) {
+    for (size_t j = 0; j < count; j++) {
+        glm::quat rb = glm::dot(a[j].rotation, b[j].rotation) < 0.0f ? -b[j].rotation : b[j].rotation;
+
+        out[j].translation = glm::mix(a[j].translation, b[j].translation, weight);
+        out[j].rotation = glm::normalize(a[j].rotation * (1.0f - weight) + rb * weight);
+        out[j].scale = glm::mix(a[j].scale, b[j].scale, weight);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "../Asset/MeshFormat.h"
+
+struct JointPose {
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+};
+
+// Joint hierarchy of one skin of a cooked mesh. Joints keep the skin's order (the order vertex joint indices refer
+// to); evaluation follows the node order, which puts parents before children.
+class Skeleton {
+public:
+    Skeleton(const MeshFile &file, uint32_t skin);
+
+    size_t JointCount() const { return parents.size(); }
+    const std::vector<JointPose> &BindPose() const { return bindPose; }
+
+    // Local joint poses -> skinning matrices (world * joint model transform * inverse bind), stored transposed as
+    // three vec4 rows per joint so a palette texel fetch needs 3 reads instead of 4.
+    void ComputePalette(const JointPose *pose, const glm::mat4 &world, glm::vec4 *palette) const;
+
+private:
+    std::vector<int> parents;                 // joint index, -1 when the parent node is not a joint
+    std::vector<uint32_t> order;
+    std::vector<glm::mat4> rootTransforms;    // model transform of a root joint's parent node
+    std::vector<glm::mat4> inverseBind;
+    std::vector<JointPose> bindPose;
+};
+
+// out = a * (1 - weight) + b * weight, per joint, with normalized shortest-path quaternion blending
+void BlendPoses(const JointPose *a, const JointPose *b, float weight, size_t count, JointPose *out);
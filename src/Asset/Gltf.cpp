@@ -0,0 +1,484 @@
+#include "Gltf.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "Json.h"
+
+namespace {
+    constexpr uint32_t GlbMagic = 0x46546c67;         // "glTF"
+    constexpr uint32_t GlbChunkJson = 0x4e4f534a;     // "JSON"
+    constexpr uint32_t GlbChunkBin = 0x004e4942;      // "BIN\0"
+
+    std::vector<uint8_t> ReadBinaryFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            throw std::runtime_error("Failed to Open glTF File: " + path);
+        }
+
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    std::string DirectoryOf(const std::string &path) {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    std::vector<uint8_t> DecodeBase64(std::string_view text) {
+        std::vector<uint8_t> out;
+        uint32_t accumulator = 0;
+        int bits = 0;
+
+        for (char c: text) {
+            int value;
+            if (c >= 'A' && c <= 'Z') value = c - 'A';
+            else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+            else if (c >= '0' && c <= '9') value = c - '0' + 52;
+            else if (c == '+' || c == '-') value = 62;
+            else if (c == '/' || c == '_') value = 63;
+            else continue;
+
+            accumulator = (accumulator << 6) | static_cast<uint32_t>(value);
+            bits += 6;
+
+            if (bits >= 8) {
+                bits -= 8;
+                out.push_back(static_cast<uint8_t>(accumulator >> bits));
+            }
+        }
+
+        return out;
+    }
+
+    std::vector<uint8_t> LoadUri(const std::string &uri, const std::string &directory) {
+        if (uri.rfind("data:", 0) == 0) {
+            size_t comma = uri.find(',');
+
+            if (comma == std::string::npos || uri.find(";base64") > comma) {
+                throw std::runtime_error("Unsupported glTF Data URI");
+            }
+
+            return DecodeBase64(std::string_view(uri).substr(comma + 1));
+        }
+
+        return ReadBinaryFile(directory + uri);
+    }
+
+    int ComponentCount(const std::string &type) {
+        if (type == "SCALAR") return 1;
+        if (type == "VEC2") return 2;
+        if (type == "VEC3") return 3;
+        if (type == "VEC4") return 4;
+        if (type == "MAT4") return 16;
+        throw std::runtime_error("Unsupported glTF Accessor Type: " + type);
+    }
+
+    class Document {
+    public:
+        Document(const JsonValue &json, std::vector<std::vector<uint8_t>> buffers)
+            : json(json), buffers(std::move(buffers)) {
+        }
+
+        const JsonValue &json;
+        std::vector<std::vector<uint8_t>> buffers;
+
+        const uint8_t *BufferViewData(int index, size_t &length, size_t &stride) const {
+            const JsonValue &view = json["bufferViews"][index];
+            const std::vector<uint8_t> &buffer = buffers.at(view["buffer"].AsInt());
+            size_t offset = static_cast<size_t>(view.NumberOr("byteOffset", 0));
+            length = static_cast<size_t>(view["byteLength"].AsNumber());
+            stride = static_cast<size_t>(view.NumberOr("byteStride", 0));
+
+            if (offset + length > buffer.size()) {
+                throw std::runtime_error("glTF Buffer View Out of Range");
+            }
+
+            return buffer.data() + offset;
+        }
+
+        // Reads any accessor into floats, applying the normalization rules of the spec
+        std::vector<float> ReadAccessor(int index, int &components) const {
+            const JsonValue &accessor = json["accessors"][index];
+
+            if (accessor.Has("sparse")) {
+                throw std::runtime_error("Sparse glTF Accessors Are Not Supported");
+            }
+
+            components = ComponentCount(accessor["type"].AsString());
+            auto count = static_cast<size_t>(accessor["count"].AsNumber());
+            int componentType = accessor["componentType"].AsInt();
+            bool normalized = accessor["normalized"].GetType() == JsonValue::Type::Bool && accessor["normalized"].AsBool();
+
+            size_t componentSize = componentType == 5126 || componentType == 5125 ? 4 : componentType == 5122 || componentType == 5123 ? 2 : 1;
+            std::vector<float> out(count * components, 0.0f);
+
+            if (!accessor.Has("bufferView")) {
+                return out;
+            }
+
+            size_t length, stride;
+            const uint8_t *data = BufferViewData(accessor["bufferView"].AsInt(), length, stride);
+            auto offset = static_cast<size_t>(accessor.NumberOr("byteOffset", 0));
+            size_t elementSize = componentSize * components;
+            stride = stride ? stride : elementSize;
+
+            if (count > 0 && offset + (count - 1) * stride + elementSize > length) {
+                throw std::runtime_error("glTF Accessor Out of Range");
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t *element = data + offset + i * stride;
+
+                for (int c = 0; c < components; c++) {
+                    const uint8_t *p = element + c * componentSize;
+                    float value;
+
+                    switch (componentType) {
+                        case 5120: { int8_t v; std::memcpy(&v, p, 1); value = normalized ? std::max(v / 127.0f, -1.0f) : v; break; }
+                        case 5121: { uint8_t v = *p; value = normalized ? v / 255.0f : v; break; }
+                        case 5122: { int16_t v; std::memcpy(&v, p, 2); value = normalized ? std::max(v / 32767.0f, -1.0f) : v; break; }
+                        case 5123: { uint16_t v; std::memcpy(&v, p, 2); value = normalized ? v / 65535.0f : v; break; }
+                        case 5125: { uint32_t v; std::memcpy(&v, p, 4); value = static_cast<float>(v); break; }
+                        case 5126: { std::memcpy(&value, p, 4); break; }
+                        default: throw std::runtime_error("Unsupported glTF Component Type " + std::to_string(componentType));
+                    }
+
+                    out[i * components + c] = value;
+                }
+            }
+
+            return out;
+        }
+
+        // Integer path for indices so values above 2^24 survive
+        std::vector<uint32_t> ReadIndices(int index) const {
+            const JsonValue &accessor = json["accessors"][index];
+            auto count = static_cast<size_t>(accessor["count"].AsNumber());
+            int componentType = accessor["componentType"].AsInt();
+            size_t componentSize = componentType == 5125 ? 4 : componentType == 5123 ? 2 : 1;
+
+            size_t length, stride;
+            const uint8_t *data = BufferViewData(accessor["bufferView"].AsInt(), length, stride);
+            auto offset = static_cast<size_t>(accessor.NumberOr("byteOffset", 0));
+            stride = stride ? stride : componentSize;
+
+            if (count > 0 && offset + (count - 1) * stride + componentSize > length) {
+                throw std::runtime_error("glTF Index Accessor Out of Range");
+            }
+
+            std::vector<uint32_t> out(count);
+
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t *p = data + offset + i * stride;
+
+                if (componentSize == 4) {
+                    std::memcpy(&out[i], p, 4);
+                } else if (componentSize == 2) {
+                    uint16_t v;
+                    std::memcpy(&v, p, 2);
+                    out[i] = v;
+                } else {
+                    out[i] = *p;
+                }
+            }
+
+            return out;
+        }
+
+        template<typename Vec>
+        std::vector<Vec> ReadVectors(int index) const {
+            int components;
+            std::vector<float> raw = ReadAccessor(index, components);
+            std::vector<Vec> out(raw.size() / components);
+
+            for (size_t i = 0; i < out.size(); i++) {
+                for (int c = 0; c < std::min(components, static_cast<int>(Vec::length())); c++) {
+                    out[i][c] = static_cast<typename Vec::value_type>(raw[i * components + c]);
+                }
+            }
+
+            return out;
+        }
+    };
+}
+
+GltfScene LoadGltf(const std::string &path) {
+    std::vector<uint8_t> file = ReadBinaryFile(path);
+    std::string directory = DirectoryOf(path);
+    std::string_view jsonText;
+    std::vector<uint8_t> glbBinary;
+
+    uint32_t magic = 0;
+    if (file.size() >= 4) {
+        std::memcpy(&magic, file.data(), 4);
+    }
+
+    if (magic == GlbMagic) {
+        // 12 byte header, then JSON chunk, then optional BIN chunk
+        size_t offset = 12;
+
+        while (offset + 8 <= file.size()) {
+            uint32_t chunkLength, chunkType;
+            std::memcpy(&chunkLength, &file[offset], 4);
+            std::memcpy(&chunkType, &file[offset + 4], 4);
+            offset += 8;
+
+            if (offset + chunkLength > file.size()) {
+                throw std::runtime_error("Truncated GLB Chunk: " + path);
+            }
+
+            if (chunkType == GlbChunkJson) {
+                jsonText = std::string_view(reinterpret_cast<const char *>(&file[offset]), chunkLength);
+            } else if (chunkType == GlbChunkBin && glbBinary.empty()) {
+                glbBinary.assign(file.begin() + static_cast<ptrdiff_t>(offset), file.begin() + static_cast<ptrdiff_t>(offset + chunkLength));
+            }
+
+            offset += (chunkLength + 3) & ~3u;
+        }
+    } else {
+        jsonText = std::string_view(reinterpret_cast<const char *>(file.data()), file.size());
+    }
+
+    JsonValue json = JsonValue::Parse(jsonText);
+
+    for (const JsonValue &extension: json["extensionsRequired"].Items()) {
+        throw std::runtime_error("Unsupported Required glTF Extension: " + extension.AsString());
+    }
+
+    std::vector<std::vector<uint8_t>> buffers;
+    for (size_t i = 0; i < json["buffers"].Size(); i++) {
+        const JsonValue &buffer = json["buffers"][i];
+
+        if (buffer.Has("uri")) {
+            buffers.push_back(LoadUri(buffer["uri"].AsString(), directory));
+        } else {
+            // The buffer without a URI is the GLB binary chunk
+            buffers.push_back(std::move(glbBinary));
+        }
+    }
+
+    Document doc(json, std::move(buffers));
+    GltfScene scene;
+
+    for (const JsonValue &image: json["images"].Items()) {
+        GltfImage out;
+        out.mimeType = image.StringOr("mimeType", "");
+
+        if (image.Has("bufferView")) {
+            size_t length, stride;
+            const uint8_t *data = doc.BufferViewData(image["bufferView"].AsInt(), length, stride);
+            out.data.assign(data, data + length);
+        } else if (image.Has("uri")) {
+            const std::string &uri = image["uri"].AsString();
+
+            if (uri.rfind("data:", 0) == 0) {
+                out.data = LoadUri(uri, directory);
+            } else {
+                out.uri = uri;
+            }
+        }
+
+        scene.images.push_back(std::move(out));
+    }
+
+    for (const JsonValue &material: json["materials"].Items()) {
+        GltfMaterial out;
+        out.name = material.StringOr("name", "");
+        out.doubleSided = material["doubleSided"].GetType() == JsonValue::Type::Bool && material["doubleSided"].AsBool();
+
+        if (material.StringOr("alphaMode", "OPAQUE") == "MASK") {
+            out.alphaCutoff = static_cast<float>(material.NumberOr("alphaCutoff", 0.5));
+        }
+
+        const JsonValue &pbr = material["pbrMetallicRoughness"];
+        out.metallic = static_cast<float>(pbr.NumberOr("metallicFactor", 1.0));
+        out.roughness = static_cast<float>(pbr.NumberOr("roughnessFactor", 1.0));
+
+        if (pbr.Has("baseColorFactor")) {
+            for (int c = 0; c < 4; c++) {
+                out.baseColor[c] = static_cast<float>(pbr["baseColorFactor"][c].AsNumber());
+            }
+        }
+
+        if (pbr.Has("baseColorTexture")) {
+            int texture = pbr["baseColorTexture"]["index"].AsInt();
+            out.baseColorImage = json["textures"][texture].IntOr("source", -1);
+        }
+
+        scene.materials.push_back(std::move(out));
+    }
+
+    for (const JsonValue &mesh: json["meshes"].Items()) {
+        GltfMesh out;
+        out.name = mesh.StringOr("name", "");
+
+        for (const JsonValue &primitive: mesh["primitives"].Items()) {
+            if (primitive.IntOr("mode", 4) != 4) {
+                throw std::runtime_error("Only Triangle List glTF Primitives Are Supported (" + out.name + ")");
+            }
+
+            const JsonValue &attributes = primitive["attributes"];
+            GltfPrimitive prim;
+            prim.material = primitive.IntOr("material", -1);
+            prim.positions = doc.ReadVectors<glm::vec3>(attributes["POSITION"].AsInt());
+
+            if (attributes.Has("NORMAL")) prim.normals = doc.ReadVectors<glm::vec3>(attributes["NORMAL"].AsInt());
+            if (attributes.Has("TEXCOORD_0")) prim.uvs = doc.ReadVectors<glm::vec2>(attributes["TEXCOORD_0"].AsInt());
+            if (attributes.Has("JOINTS_0")) prim.joints = doc.ReadVectors<glm::uvec4>(attributes["JOINTS_0"].AsInt());
+            if (attributes.Has("WEIGHTS_0")) prim.weights = doc.ReadVectors<glm::vec4>(attributes["WEIGHTS_0"].AsInt());
+
+            if (primitive.Has("indices")) {
+                prim.indices = doc.ReadIndices(primitive["indices"].AsInt());
+            } else {
+                prim.indices.resize(prim.positions.size());
+                for (uint32_t i = 0; i < prim.indices.size(); i++) {
+                    prim.indices[i] = i;
+                }
+            }
+
+            for (uint32_t index: prim.indices) {
+                if (index >= prim.positions.size()) {
+                    throw std::runtime_error("glTF Index Out of Range in Mesh " + out.name);
+                }
+            }
+
+            out.primitives.push_back(std::move(prim));
+        }
+
+        scene.meshes.push_back(std::move(out));
+    }
+
+    for (const JsonValue &node: json["nodes"].Items()) {
+        GltfNode out;
+        out.name = node.StringOr("name", "");
+        out.mesh = node.IntOr("mesh", -1);
+        out.skin = node.IntOr("skin", -1);
+
+        for (const JsonValue &child: node["children"].Items()) {
+            out.children.push_back(child.AsInt());
+        }
+
+        if (node.Has("matrix")) {
+            glm::mat4 m;
+            for (int i = 0; i < 16; i++) {
+                m[i / 4][i % 4] = static_cast<float>(node["matrix"][i].AsNumber());
+            }
+
+            out.translation = glm::vec3(m[3]);
+            out.scale = glm::vec3(glm::length(glm::vec3(m[0])), glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2])));
+            out.rotation = glm::quat_cast(glm::mat3(glm::vec3(m[0]) / out.scale.x, glm::vec3(m[1]) / out.scale.y,
+                                                    glm::vec3(m[2]) / out.scale.z));
+        } else {
+            if (node.Has("translation")) {
+                const JsonValue &t = node["translation"];
+                out.translation = glm::vec3(t[0].AsNumber(), t[1].AsNumber(), t[2].AsNumber());
+            }
+
+            if (node.Has("rotation")) {
+                const JsonValue &r = node["rotation"];
+                out.rotation = glm::quat(static_cast<float>(r[3].AsNumber()), static_cast<float>(r[0].AsNumber()),
+                                         static_cast<float>(r[1].AsNumber()), static_cast<float>(r[2].AsNumber()));
+            }
+
+            if (node.Has("scale")) {
+                const JsonValue &s = node["scale"];
+                out.scale = glm::vec3(s[0].AsNumber(), s[1].AsNumber(), s[2].AsNumber());
+            }
+        }
+
+        scene.nodes.push_back(std::move(out));
+    }
+
+    for (size_t i = 0; i < scene.nodes.size(); i++) {
+        for (int child: scene.nodes[i].children) {
+            if (child < 0 || child >= static_cast<int>(scene.nodes.size()) || scene.nodes[child].parent != -1) {
+                throw std::runtime_error("Invalid glTF Node Hierarchy");
+            }
+
+            scene.nodes[child].parent = static_cast<int>(i);
+        }
+    }
+
+    for (const JsonValue &skin: json["skins"].Items()) {
+        GltfSkin out;
+        out.name = skin.StringOr("name", "");
+        out.skeleton = skin.IntOr("skeleton", -1);
+
+        for (const JsonValue &joint: skin["joints"].Items()) {
+            out.joints.push_back(joint.AsInt());
+        }
+
+        if (skin.Has("inverseBindMatrices")) {
+            int components;
+            std::vector<float> raw = doc.ReadAccessor(skin["inverseBindMatrices"].AsInt(), components);
+
+            for (size_t j = 0; j + 16 <= raw.size(); j += 16) {
+                glm::mat4 m;
+                for (int i = 0; i < 16; i++) {
+                    m[i / 4][i % 4] = raw[j + i];
+                }
+                out.inverseBind.push_back(m);
+            }
+        }
+
+        out.inverseBind.resize(out.joints.size(), glm::mat4(1.0f));
+        scene.skins.push_back(std::move(out));
+    }
+
+    for (const JsonValue &animation: json["animations"].Items()) {
+        GltfAnimation out;
+        out.name = animation.StringOr("name", "animation" + std::to_string(scene.animations.size()));
+
+        for (const JsonValue &channel: animation["channels"].Items()) {
+            const JsonValue &target = channel["target"];
+            const std::string &path = target["path"].AsString();
+
+            // Morph target weights and node-less (extension) targets are not cooked
+            if (path == "weights" || !target.Has("node")) continue;
+
+            GltfAnimationChannel track;
+            track.node = target["node"].AsInt();
+            track.path = path == "translation" ? GltfAnimationChannel::Path::Translation :
+                         path == "rotation" ? GltfAnimationChannel::Path::Rotation : GltfAnimationChannel::Path::Scale;
+
+            if (track.node < 0 || track.node >= static_cast<int>(scene.nodes.size())) {
+                throw std::runtime_error("Invalid glTF Animation Target Node");
+            }
+
+            const JsonValue &sampler = animation["samplers"][static_cast<size_t>(channel["sampler"].AsInt())];
+            std::string interpolation = sampler.StringOr("interpolation", "LINEAR");
+            track.step = interpolation == "STEP";
+
+            int components;
+            track.times = doc.ReadAccessor(sampler["input"].AsInt(), components);
+            std::vector<float> values = doc.ReadAccessor(sampler["output"].AsInt(), components);
+
+            // Cubic spline outputs are (in-tangent, value, out-tangent) triplets
+            size_t stride = interpolation == "CUBICSPLINE" ? 3 : 1;
+            size_t first = interpolation == "CUBICSPLINE" ? 1 : 0;
+
+            if (values.size() < track.times.size() * stride * components) {
+                throw std::runtime_error("glTF Animation Sampler Output Too Short");
+            }
+
+            for (size_t k = 0; k < track.times.size(); k++) {
+                glm::vec4 value(0.0f);
+                for (int c = 0; c < std::min(components, 4); c++) {
+                    value[c] = values[(k * stride + first) * components + c];
+                }
+                track.values.push_back(value);
+            }
+
+            if (!track.times.empty()) {
+                out.channels.push_back(std::move(track));
+            }
+        }
+
+        scene.animations.push_back(std::move(out));
+    }
+
+    return scene;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Decoded glTF 2.0 content, in plain float arrays. Only what the engine cooks is kept: triangle meshes, metallic-
+// roughness materials, the node hierarchy, skins and TRS animations.
+
+struct GltfPrimitive {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;         // empty if the source had none
+    std::vector<glm::vec2> uvs;             // TEXCOORD_0, empty if none
+    std::vector<glm::uvec4> joints;         // JOINTS_0, empty if not skinned
+    std::vector<glm::vec4> weights;         // WEIGHTS_0
+    std::vector<uint32_t> indices;
+    int material = -1;
+};
+
+struct GltfMesh {
+    std::string name;
+    std::vector<GltfPrimitive> primitives;
+};
+
+struct GltfImage {
+    std::string uri;                        // external file, relative to the glTF
+    std::string mimeType;
+    std::vector<uint8_t> data;              // embedded (bufferView or data: URI)
+};
+
+struct GltfMaterial {
+    std::string name;
+    glm::vec4 baseColor = glm::vec4(1.0f);
+    float metallic = 1.0f;
+    float roughness = 1.0f;
+    int baseColorImage = -1;
+    float alphaCutoff = 0.0f;               // only set for alphaMode MASK
+    bool doubleSided = false;
+};
+
+struct GltfNode {
+    std::string name;
+    int parent = -1;
+    std::vector<int> children;
+    int mesh = -1;
+    int skin = -1;
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+};
+
+struct GltfSkin {
+    std::string name;
+    std::vector<int> joints;                // node indices
+    std::vector<glm::mat4> inverseBind;
+    int skeleton = -1;
+};
+
+struct GltfAnimationChannel {
+    enum class Path { Translation, Rotation, Scale };
+
+    int node = -1;
+    Path path = Path::Translation;
+    bool step = false;                      // STEP interpolation; CUBICSPLINE keeps only the key values
+    std::vector<float> times;
+    std::vector<glm::vec4> values;          // xyz for translation / scale, xyzw quaternion for rotation
+};
+
+struct GltfAnimation {
+    std::string name;
+    std::vector<GltfAnimationChannel> channels;
+};
+
+struct GltfScene {
+    std::vector<GltfMesh> meshes;
+    std::vector<GltfMaterial> materials;
+    std::vector<GltfImage> images;
+    std::vector<GltfNode> nodes;
+    std::vector<GltfSkin> skins;
+    std::vector<GltfAnimation> animations;
+};
+
+// Loads a binary .glb, or a .gltf with external or data: URI buffers. Throws std::runtime_error on malformed or
+// unsupported content (sparse accessors, non-triangle primitives, Draco).
+GltfScene LoadGltf(const std::string &path);
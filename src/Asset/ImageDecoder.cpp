@@ -0,0 +1,89 @@
+#include "ImageDecoder.h"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "Vfs.h"
+#include "../Core/AsyncIo.h"
+#include "../Core/JobSystem.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "../stb_image.h"
+
+DecodedImage::~DecodedImage() {
+    stbi_image_free(pixels);
+}
+
+DecodedImage::DecodedImage(DecodedImage &&other) noexcept
+    : pixels(std::exchange(other.pixels, nullptr)), width(other.width), height(other.height), channels(other.channels) {
+}
+
+DecodedImage &DecodedImage::operator=(DecodedImage &&other) noexcept {
+    if (this != &other) {
+        stbi_image_free(pixels);
+        pixels = std::exchange(other.pixels, nullptr);
+        width = other.width;
+        height = other.height;
+        channels = other.channels;
+    }
+    return *this;
+}
+
+DecodedImage DecodedImage::Decode(const FileData &file, int channels) {
+    if (file.Size() > static_cast<size_t>(INT32_MAX)) {
+        throw std::runtime_error("Failed to Decode Image " + file.Path() + ": Too Large");
+    }
+
+    // stb_image keeps its failure reason per thread, so concurrent decodes report their own
+    DecodedImage image;
+    int fileChannels = 0;
+    image.pixels = stbi_load_from_memory(file.Data(), static_cast<int>(file.Size()), &image.width, &image.height, &fileChannels, channels);
+    if (!image.pixels) {
+        throw std::runtime_error("Failed to Decode Image " + file.Path() + ": " + stbi_failure_reason());
+    }
+
+    image.channels = channels ? channels : fileChannels;
+    return image;
+}
+
+std::vector<ImageDecodeResult> DecodeImages(std::span<const FileData> files, JobSystem *jobs, int channels) {
+    std::vector<ImageDecodeResult> results(files.size());
+
+    auto decode = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            try {
+                results[i].image = DecodedImage::Decode(files[i], channels);
+            } catch (const std::exception &ex) {
+                results[i].error = ex.what();
+            }
+        }
+    };
+
+    // One image per job: sizes vary too much for bigger chunks to balance
+    if (jobs) {
+        jobs->ParallelFor(files.size(), 1, decode);
+    } else {
+        decode(0, files.size());
+    }
+    return results;
+}
+
+void QueueImageDecodes(AsyncIo &io, const Vfs &vfs, const std::vector<std::string> &paths, int channels, ImageCallback done) {
+    auto shared = std::make_shared<ImageCallback>(std::move(done));
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        vfs.QueueRead(io, paths[i], [shared, i, channels](FileData &data, const std::string &error) {
+            DecodedImage image;
+            std::string failure = error;
+            if (failure.empty()) {
+                try {
+                    image = DecodedImage::Decode(data, channels);
+                } catch (const std::exception &ex) {
+                    failure = ex.what();
+                }
+            }
+            (*shared)(i, image, failure);
+        });
+    }
+}
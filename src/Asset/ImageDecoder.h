@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../Core/FileData.h"
+
+class AsyncIo;
+class JobSystem;
+class Vfs;
+
+// Pixels decoded by stb_image: 8 bits per channel, rows top to bottom. Freed with the object.
+class DecodedImage {
+public:
+    DecodedImage() = default;
+    ~DecodedImage();
+
+    DecodedImage(DecodedImage &&other) noexcept;
+    DecodedImage &operator=(DecodedImage &&other) noexcept;
+    DecodedImage(const DecodedImage &) = delete;
+    DecodedImage &operator=(const DecodedImage &) = delete;
+
+    // Decodes an encoded image (JPEG, PNG, TGA, ...) in memory. channels forces 1-4 channels, 0 keeps the file's.
+    // Throws std::runtime_error naming the file and stb_image's reason. Safe to call from several threads at once.
+    static DecodedImage Decode(const FileData &file, int channels = 0);
+
+    const uint8_t *Pixels() const { return pixels; }
+    int Width() const { return width; }
+    int Height() const { return height; }
+    int Channels() const { return channels; }
+    size_t Size() const { return static_cast<size_t>(width) * height * channels; }
+    explicit operator bool() const { return pixels != nullptr; }
+
+private:
+    uint8_t *pixels = nullptr;
+    int width = 0, height = 0, channels = 0;
+};
+
+struct ImageDecodeResult {
+    DecodedImage image;
+    std::string error;                        // empty on success
+};
+
+// Decodes a batch of buffers the I/O layer has already read, one image per job across the JobSystem (the caller
+// decodes too), and returns when all are done. results[i] belongs to files[i]; one bad image only fails its own entry.
+// With no JobSystem the batch decodes on the calling thread.
+std::vector<ImageDecodeResult> DecodeImages(std::span<const FileData> files, JobSystem *jobs, int channels = 0);
+
+// Reads each path through the VFS and decodes it on the job its read completes on, so reading the next images overlaps
+// decoding the last. done(index, image, error) runs once per path, from whichever job decoded it and in completion
+// order. Queues the reads only; the caller Submit()s, as with Vfs::QueueRead.
+using ImageCallback = std::function<void(size_t index, DecodedImage &image, const std::string &error)>;
+void QueueImageDecodes(AsyncIo &io, const Vfs &vfs, const std::vector<std::string> &paths, int channels, ImageCallback done);
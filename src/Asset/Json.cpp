@@ -0,0 +1,278 @@
+#include "Json.h"
+
+#include <cstdlib>
+#include <stdexcept>
+
+class JsonParser {
+public:
+    explicit JsonParser(std::string_view text) : text(text) {
+    }
+
+    JsonValue ParseDocument() {
+        JsonValue value = ParseValue();
+        SkipWhitespace();
+
+        if (pos != text.size()) {
+            Fail("Trailing Characters");
+        }
+
+        return value;
+    }
+
+private:
+    [[noreturn]] void Fail(const std::string &what) const {
+        throw std::runtime_error("JSON Parse Error at Offset " + std::to_string(pos) + ": " + what);
+    }
+
+    void SkipWhitespace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    char Peek() {
+        SkipWhitespace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    void Expect(char c) {
+        if (Peek() != c) {
+            Fail(std::string("Expected '") + c + "'");
+        }
+
+        pos++;
+    }
+
+    bool Consume(std::string_view literal) {
+        if (text.substr(pos, literal.size()) == literal) {
+            pos += literal.size();
+            return true;
+        }
+
+        return false;
+    }
+
+    JsonValue ParseValue() {
+        JsonValue value;
+        char c = Peek();
+
+        if (c == '{') {
+            value.type = JsonValue::Type::Object;
+            pos++;
+
+            if (Peek() == '}') {
+                pos++;
+                return value;
+            }
+
+            while (true) {
+                if (Peek() != '"') {
+                    Fail("Expected Member Name");
+                }
+
+                std::string key = ParseString();
+                Expect(':');
+                value.object.emplace_back(std::move(key), ParseValue());
+
+                if (Peek() != ',') {
+                    break;
+                }
+
+                pos++;
+            }
+
+            Expect('}');
+        } else if (c == '[') {
+            value.type = JsonValue::Type::Array;
+            pos++;
+
+            if (Peek() == ']') {
+                pos++;
+                return value;
+            }
+
+            while (true) {
+                value.array.push_back(ParseValue());
+
+                if (Peek() != ',') {
+                    break;
+                }
+
+                pos++;
+            }
+
+            Expect(']');
+        } else if (c == '"') {
+            value.type = JsonValue::Type::String;
+            value.string = ParseString();
+        } else if (Consume("true")) {
+            value.type = JsonValue::Type::Bool;
+            value.boolean = true;
+        } else if (Consume("false")) {
+            value.type = JsonValue::Type::Bool;
+        } else if (Consume("null")) {
+            value.type = JsonValue::Type::Null;
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            value.type = JsonValue::Type::Number;
+            std::string number;
+
+            while (pos < text.size() && std::string_view("+-0123456789.eE").find(text[pos]) != std::string_view::npos) {
+                number += text[pos++];
+            }
+
+            char *end = nullptr;
+            value.number = std::strtod(number.c_str(), &end);
+
+            if (end != number.c_str() + number.size()) {
+                Fail("Malformed Number");
+            }
+        } else {
+            Fail("Unexpected Character");
+        }
+
+        return value;
+    }
+
+    static void AppendUtf8(std::string &out, uint32_t codepoint) {
+        if (codepoint < 0x80) {
+            out += static_cast<char>(codepoint);
+        } else if (codepoint < 0x800) {
+            out += static_cast<char>(0xc0 | (codepoint >> 6));
+            out += static_cast<char>(0x80 | (codepoint & 0x3f));
+        } else if (codepoint < 0x10000) {
+            out += static_cast<char>(0xe0 | (codepoint >> 12));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (codepoint & 0x3f));
+        } else {
+            out += static_cast<char>(0xf0 | (codepoint >> 18));
+            out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (codepoint & 0x3f));
+        }
+    }
+
+    uint32_t ParseHex4() {
+        if (pos + 4 > text.size()) {
+            Fail("Truncated Escape");
+        }
+
+        uint32_t value = std::strtoul(std::string(text.substr(pos, 4)).c_str(), nullptr, 16);
+        pos += 4;
+        return value;
+    }
+
+    std::string ParseString() {
+        std::string out;
+        pos++;
+
+        while (pos < text.size() && text[pos] != '"') {
+            char c = text[pos++];
+
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+
+            if (pos >= text.size()) {
+                break;
+            }
+
+            switch (char e = text[pos++]) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    uint32_t codepoint = ParseHex4();
+
+                    if (codepoint >= 0xd800 && codepoint < 0xdc00 && Consume("\\u")) {
+                        codepoint = 0x10000 + ((codepoint - 0xd800) << 10) + (ParseHex4() - 0xdc00);
+                    }
+
+                    AppendUtf8(out, codepoint);
+                    break;
+                }
+                default: out += e; break;
+            }
+        }
+
+        if (pos >= text.size()) {
+            Fail("Unterminated String");
+        }
+
+        pos++;
+        return out;
+    }
+
+    std::string_view text;
+    size_t pos = 0;
+};
+
+JsonValue JsonValue::Parse(std::string_view text) {
+    return JsonParser(text).ParseDocument();
+}
+
+double JsonValue::AsNumber() const {
+    if (type != Type::Number) {
+        throw std::runtime_error("JSON Value Is Not a Number");
+    }
+
+    return number;
+}
+
+bool JsonValue::AsBool() const {
+    if (type != Type::Bool) {
+        throw std::runtime_error("JSON Value Is Not a Bool");
+    }
+
+    return boolean;
+}
+
+const std::string &JsonValue::AsString() const {
+    if (type != Type::String) {
+        throw std::runtime_error("JSON Value Is Not a String");
+    }
+
+    return string;
+}
+
+const JsonValue &JsonValue::operator[](size_t index) const {
+    if (type != Type::Array || index >= array.size()) {
+        throw std::runtime_error("JSON Array Index Out of Range: " + std::to_string(index));
+    }
+
+    return array[index];
+}
+
+const JsonValue &JsonValue::operator[](std::string_view key) const {
+    static const JsonValue null;
+
+    if (type == Type::Object) {
+        for (const auto &[name, value]: object) {
+            if (name == key) {
+                return value;
+            }
+        }
+    }
+
+    return null;
+}
+
+bool JsonValue::Has(std::string_view key) const {
+    return !(*this)[key].IsNull();
+}
+
+double JsonValue::NumberOr(std::string_view key, double fallback) const {
+    const JsonValue &value = (*this)[key];
+    return value.IsNumber() ? value.number : fallback;
+}
+
+int JsonValue::IntOr(std::string_view key, int fallback) const {
+    return static_cast<int>(NumberOr(key, fallback));
+}
+
+std::string JsonValue::StringOr(std::string_view key, const std::string &fallback) const {
+    const JsonValue &value = (*this)[key];
+    return value.IsString() ? value.string : fallback;
+}
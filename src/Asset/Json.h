@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Small DOM JSON reader for asset and authoring files (glTF, level sources). Not meant for hot paths.
+class JsonValue {
+public:
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    static JsonValue Parse(std::string_view text);
+
+    Type GetType() const { return type; }
+    bool IsNull() const { return type == Type::Null; }
+    bool IsNumber() const { return type == Type::Number; }
+    bool IsString() const { return type == Type::String; }
+    bool IsArray() const { return type == Type::Array; }
+    bool IsObject() const { return type == Type::Object; }
+
+    double AsNumber() const;
+    bool AsBool() const;
+    const std::string &AsString() const;
+    int AsInt() const { return static_cast<int>(AsNumber()); }
+
+    size_t Size() const { return type == Type::Array ? array.size() : object.size(); }
+    const JsonValue &operator[](size_t index) const;
+    const std::vector<JsonValue> &Items() const { return array; }
+    const std::vector<std::pair<std::string, JsonValue>> &Members() const { return object; }
+
+    // Member lookup; returns a shared null value when missing
+    const JsonValue &operator[](std::string_view key) const;
+    bool Has(std::string_view key) const;
+
+    double NumberOr(std::string_view key, double fallback) const;
+    int IntOr(std::string_view key, int fallback) const;
+    std::string StringOr(std::string_view key, const std::string &fallback) const;
+
+private:
+    friend class JsonParser;
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+};
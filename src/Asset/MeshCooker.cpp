@@ -0,0 +1,323 @@
+#include "MeshCooker.h"
+
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "MeshFormat.h"
+#include "../Animation/ClipCompressor.h"
+#include "../Geometry/MeshSimplifier.h"
+
+namespace {
+    // Octahedral normal encoding (Cigolle et al. 2014) into two snorm16 values
+    void EncodeOctahedral(glm::vec3 n, int16_t out[2]) {
+        n /= std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+        glm::vec2 p(n.x, n.y);
+
+        if (n.z < 0.0f) {
+            p = glm::vec2((1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+                          (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f));
+        }
+
+        out[0] = static_cast<int16_t>(std::lround(std::clamp(p.x, -1.0f, 1.0f) * 32767.0f));
+        out[1] = static_cast<int16_t>(std::lround(std::clamp(p.y, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    // Weights quantized to unorm8 so they still sum to exactly 255
+    void QuantizeWeights(glm::vec4 w, uint8_t out[4]) {
+        float sum = w.x + w.y + w.z + w.w;
+        w = sum > 0.0f ? w / sum : glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+
+        int total = 0, largest = 0;
+        for (int i = 0; i < 4; i++) {
+            out[i] = static_cast<uint8_t>(std::lround(w[i] * 255.0f));
+            total += out[i];
+            largest = out[i] > out[largest] ? i : largest;
+        }
+
+        out[largest] = static_cast<uint8_t>(out[largest] + 255 - total);
+    }
+
+    std::vector<glm::vec3> ComputeNormals(const GltfPrimitive &prim) {
+        std::vector<glm::vec3> normals(prim.positions.size(), glm::vec3(0.0f));
+
+        for (size_t i = 0; i + 2 < prim.indices.size(); i += 3) {
+            uint32_t a = prim.indices[i], b = prim.indices[i + 1], c = prim.indices[i + 2];
+            glm::vec3 n = glm::cross(prim.positions[b] - prim.positions[a], prim.positions[c] - prim.positions[a]);
+            normals[a] += n;
+            normals[b] += n;
+            normals[c] += n;
+        }
+
+        for (glm::vec3 &n: normals) {
+            float length = glm::length(n);
+            n = length > 0.0f ? n / length : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+
+        return normals;
+    }
+
+    template<size_t N>
+    void CopyName(char (&dst)[N], const std::string &src) {
+        std::memset(dst, 0, N);
+        std::memcpy(dst, src.data(), std::min(src.size(), N - 1));
+    }
+
+    uint64_t Align(uint64_t offset) {
+        return (offset + MeshFileAlignment - 1) & ~static_cast<uint64_t>(MeshFileAlignment - 1);
+    }
+}
+
+void CookMeshFile(const GltfScene &scene, const std::string &outputPath, const MeshCookOptions &options) {
+    bool skinned = std::any_of(scene.meshes.begin(), scene.meshes.end(), [](const GltfMesh &mesh) {
+        return std::any_of(mesh.primitives.begin(), mesh.primitives.end(), [](const GltfPrimitive &p) { return !p.joints.empty(); });
+    });
+    const uint32_t stride = skinned ? sizeof(PackedSkinnedVertex) : sizeof(PackedVertex);
+
+    // Nodes are reordered breadth first so parents always precede their children
+    std::vector<int> order, newIndex(scene.nodes.size(), -1);
+    for (size_t i = 0; i < scene.nodes.size(); i++) {
+        if (scene.nodes[i].parent == -1) {
+            order.push_back(static_cast<int>(i));
+        }
+    }
+    for (size_t i = 0; i < order.size(); i++) {
+        newIndex[order[i]] = static_cast<int>(i);
+        for (int child: scene.nodes[order[i]].children) {
+            order.push_back(child);
+        }
+    }
+
+    std::vector<uint8_t> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<MeshRecord> meshes;
+    std::vector<SubmeshRecord> submeshes;
+    std::vector<LodRecord> lods;
+    std::vector<MaterialRecord> materials;
+    std::vector<NodeRecord> nodes;
+    std::vector<SkinRecord> skins;
+    std::vector<JointRecord> joints;
+    std::vector<ClipRecord> clips;
+    std::vector<TrackRecord> tracks;
+    std::vector<uint16_t> keyTimes, keyValues;
+
+    glm::vec3 boundsMin(INFINITY), boundsMax(-INFINITY);
+    uint32_t vertexCount = 0;
+
+    std::string stem = outputPath.substr(0, outputPath.find_last_of('.'));
+    std::string baseName = stem.substr(stem.find_last_of("/\\") + 1);
+
+    for (const GltfMaterial &material: scene.materials) {
+        MaterialRecord record{};
+        CopyName(record.name, material.name);
+        std::memcpy(record.baseColor, &material.baseColor[0], sizeof(record.baseColor));
+        record.metallic = material.metallic;
+        record.roughness = material.roughness;
+        record.alphaCutoff = material.alphaCutoff;
+        record.doubleSided = material.doubleSided ? 1 : 0;
+
+        if (material.baseColorImage >= 0 && material.baseColorImage < static_cast<int>(scene.images.size())) {
+            const GltfImage &image = scene.images[material.baseColorImage];
+            std::string texture = image.uri;
+
+            if (image.data.size() > 0) {
+                std::string extension = image.mimeType == "image/png" ? ".png" : ".jpg";
+                texture = baseName + "_" + std::to_string(material.baseColorImage) + extension;
+
+                std::ofstream out(stem.substr(0, stem.size() - baseName.size()) + texture, std::ios::binary);
+                out.write(reinterpret_cast<const char *>(image.data.data()), static_cast<std::streamsize>(image.data.size()));
+            }
+
+            CopyName(record.baseColorTexture, texture);
+        }
+
+        materials.push_back(record);
+    }
+
+    // Primitives without a material share a default one
+    const auto defaultMaterial = static_cast<uint32_t>(materials.size());
+    MaterialRecord fallback{};
+    CopyName(fallback.name, "default");
+    std::fill(std::begin(fallback.baseColor), std::end(fallback.baseColor), 1.0f);
+    fallback.roughness = 1.0f;
+    materials.push_back(fallback);
+
+    for (const GltfMesh &mesh: scene.meshes) {
+        meshes.push_back({static_cast<uint32_t>(submeshes.size()), static_cast<uint32_t>(mesh.primitives.size())});
+
+        for (const GltfPrimitive &prim: mesh.primitives) {
+            std::vector<glm::vec3> normals = prim.normals.size() == prim.positions.size() ? prim.normals : ComputeNormals(prim);
+            const uint32_t baseVertex = vertexCount;
+
+            SubmeshRecord submesh{};
+            glm::vec3 subMin(INFINITY), subMax(-INFINITY);
+
+            // Pack vertices; the LOD seam matching looks at uv + normal
+            std::vector<float> attributes;
+            attributes.reserve(prim.positions.size() * 5);
+
+            for (size_t v = 0; v < prim.positions.size(); v++) {
+                PackedSkinnedVertex packed{};
+                glm::vec2 uv = v < prim.uvs.size() ? prim.uvs[v] : glm::vec2(0.0f);
+
+                std::memcpy(packed.base.position, &prim.positions[v][0], sizeof(packed.base.position));
+                EncodeOctahedral(normals[v], packed.base.normal);
+                packed.base.uv[0] = glm::packHalf1x16(uv.x);
+                packed.base.uv[1] = glm::packHalf1x16(uv.y);
+
+                if (skinned) {
+                    glm::uvec4 j = v < prim.joints.size() ? prim.joints[v] : glm::uvec4(0);
+                    glm::vec4 w = v < prim.weights.size() ? prim.weights[v] : glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+
+                    for (int i = 0; i < 4; i++) {
+                        if (j[i] > 255) {
+                            throw std::runtime_error("Skinned Meshes Support at Most 256 Joints (" + mesh.name + ")");
+                        }
+                        packed.joints[i] = static_cast<uint8_t>(j[i]);
+                    }
+
+                    QuantizeWeights(w, packed.weights);
+                }
+
+                const auto *bytes = reinterpret_cast<const uint8_t *>(&packed);
+                vertices.insert(vertices.end(), bytes, bytes + stride);
+
+                subMin = glm::min(subMin, prim.positions[v]);
+                subMax = glm::max(subMax, prim.positions[v]);
+                attributes.insert(attributes.end(), {uv.x, uv.y, normals[v].x, normals[v].y, normals[v].z});
+            }
+
+            SimplifyInput input{prim.positions.data(), prim.positions.size(), attributes.data(), 5};
+            LodChain chain = BuildLodChain(input, prim.indices, options.lodLevels, options.lodReduction, options.lodMaxError);
+
+            submesh.firstLod = static_cast<uint32_t>(lods.size());
+            submesh.lodCount = static_cast<uint32_t>(chain.levels.size());
+            submesh.material = prim.material >= 0 && prim.material < static_cast<int>(defaultMaterial) ? prim.material : defaultMaterial;
+            std::memcpy(submesh.boundsMin, &subMin[0], sizeof(submesh.boundsMin));
+            std::memcpy(submesh.boundsMax, &subMax[0], sizeof(submesh.boundsMax));
+
+            for (const LodLevel &level: chain.levels) {
+                lods.push_back({static_cast<uint32_t>(indices.size()) + level.firstIndex, level.indexCount, level.error, 0});
+            }
+
+            for (uint32_t index: chain.indices) {
+                indices.push_back(index + baseVertex);
+            }
+
+            submeshes.push_back(submesh);
+            vertexCount += static_cast<uint32_t>(prim.positions.size());
+            boundsMin = glm::min(boundsMin, subMin);
+            boundsMax = glm::max(boundsMax, subMax);
+        }
+    }
+
+    for (int source: order) {
+        const GltfNode &node = scene.nodes[source];
+        NodeRecord record{};
+
+        CopyName(record.name, node.name);
+        record.parent = node.parent >= 0 ? newIndex[node.parent] : -1;
+        record.mesh = node.mesh;
+        record.skin = node.skin;
+        std::memcpy(record.translation, &node.translation[0], sizeof(record.translation));
+        record.rotation[0] = node.rotation.x;
+        record.rotation[1] = node.rotation.y;
+        record.rotation[2] = node.rotation.z;
+        record.rotation[3] = node.rotation.w;
+        std::memcpy(record.scale, &node.scale[0], sizeof(record.scale));
+
+        nodes.push_back(record);
+    }
+
+    for (const GltfSkin &skin: scene.skins) {
+        skins.push_back({static_cast<uint32_t>(joints.size()), static_cast<uint32_t>(skin.joints.size()),
+                         skin.skeleton >= 0 ? newIndex[skin.skeleton] : -1, 0});
+
+        for (size_t j = 0; j < skin.joints.size(); j++) {
+            JointRecord joint{};
+            joint.node = newIndex.at(skin.joints[j]);
+            std::memcpy(joint.inverseBind, &skin.inverseBind[j][0][0], sizeof(joint.inverseBind));
+            joints.push_back(joint);
+        }
+    }
+
+    // Clips drive the first skin
+    for (size_t i = 0; i < scene.animations.size() && !scene.skins.empty(); i++) {
+        CompressedClip clip = CompressClip(scene, scene.animations[i], scene.skins[0], options.clipCompression);
+
+        ClipRecord record{};
+        CopyName(record.name, clip.name);
+        record.duration = clip.duration;
+        record.firstTrack = static_cast<uint32_t>(tracks.size());
+        record.trackCount = static_cast<uint32_t>(clip.tracks.size());
+        clips.push_back(record);
+
+        for (TrackRecord track: clip.tracks) {
+            track.firstKey += static_cast<uint32_t>(keyTimes.size());
+            tracks.push_back(track);
+        }
+
+        keyTimes.insert(keyTimes.end(), clip.keyTimes.begin(), clip.keyTimes.end());
+        keyValues.insert(keyValues.end(), clip.keyValues.begin(), clip.keyValues.end());
+    }
+
+    if (vertexCount == 0) {
+        boundsMin = boundsMax = glm::vec3(0.0f);
+    }
+
+    MeshFileHeader header{};
+    header.magic = MeshFileMagic;
+    header.version = MeshFileVersion;
+    header.flags = skinned ? static_cast<uint32_t>(MeshFileSkinned) : 0u;
+    header.vertexStride = stride;
+    header.vertexCount = vertexCount;
+    header.indexCount = static_cast<uint32_t>(indices.size());
+    header.meshCount = static_cast<uint32_t>(meshes.size());
+    header.submeshCount = static_cast<uint32_t>(submeshes.size());
+    header.lodCount = static_cast<uint32_t>(lods.size());
+    header.materialCount = static_cast<uint32_t>(materials.size());
+    header.nodeCount = static_cast<uint32_t>(nodes.size());
+    header.skinCount = static_cast<uint32_t>(skins.size());
+    header.jointCount = static_cast<uint32_t>(joints.size());
+    header.clipCount = static_cast<uint32_t>(clips.size());
+    header.trackCount = static_cast<uint32_t>(tracks.size());
+    header.keyCount = static_cast<uint32_t>(keyTimes.size());
+    std::memcpy(header.boundsMin, &boundsMin[0], sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, &boundsMax[0], sizeof(header.boundsMax));
+
+    std::vector<uint8_t> blob(Align(sizeof(MeshFileHeader)));
+
+    auto append = [&blob](const void *data, size_t bytes) {
+        uint64_t offset = blob.size();
+        blob.resize(Align(offset + bytes));
+        if (bytes > 0) {
+            std::memcpy(blob.data() + offset, data, bytes);
+        }
+        return offset;
+    };
+
+    header.vertexOffset = append(vertices.data(), vertices.size());
+    header.indexOffset = append(indices.data(), indices.size() * sizeof(uint32_t));
+    header.meshOffset = append(meshes.data(), meshes.size() * sizeof(MeshRecord));
+    header.submeshOffset = append(submeshes.data(), submeshes.size() * sizeof(SubmeshRecord));
+    header.lodOffset = append(lods.data(), lods.size() * sizeof(LodRecord));
+    header.materialOffset = append(materials.data(), materials.size() * sizeof(MaterialRecord));
+    header.nodeOffset = append(nodes.data(), nodes.size() * sizeof(NodeRecord));
+    header.skinOffset = append(skins.data(), skins.size() * sizeof(SkinRecord));
+    header.jointOffset = append(joints.data(), joints.size() * sizeof(JointRecord));
+    header.clipOffset = append(clips.data(), clips.size() * sizeof(ClipRecord));
+    header.trackOffset = append(tracks.data(), tracks.size() * sizeof(TrackRecord));
+    header.keyTimeOffset = append(keyTimes.data(), keyTimes.size() * sizeof(uint16_t));
+    header.keyValueOffset = append(keyValues.data(), keyValues.size() * sizeof(uint16_t));
+    header.fileSize = blob.size();
+    std::memcpy(blob.data(), &header, sizeof(header));
+
+    std::ofstream out(outputPath, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Failed to Write Mesh File: " + outputPath);
+    }
+
+    out.write(reinterpret_cast<const char *>(blob.data()), static_cast<std::streamsize>(blob.size()));
+}
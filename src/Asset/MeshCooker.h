@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+
+#include "Gltf.h"
+#include "../Animation/ClipCompressor.h"
+
+struct MeshCookOptions {
+    int lodLevels = 4;
+    float lodReduction = 0.5f;
+    float lodMaxError = INFINITY;
+    ClipCompressionOptions clipCompression;
+};
+
+// Converts a loaded glTF scene into the .mmesh layout (see MeshFormat.h) and writes it to outputPath, building a
+// LOD chain per primitive. Embedded images are written next to it as <stem>_<image>.<ext>.
+void CookMeshFile(const GltfScene &scene, const std::string &outputPath, const MeshCookOptions &options = {});
@@ -0,0 +1,98 @@
+#include "MeshFormat.h"
+
+#include <stdexcept>
+#include <utility>
+
+static bool SectionFits(uint64_t offset, uint64_t count, uint64_t recordSize, uint64_t fileSize) {
+    if (offset % MeshFileAlignment != 0 || offset > fileSize) {
+        return false;
+    }
+
+    return count <= (fileSize - offset) / recordSize;
+}
+
+MeshFile::MeshFile(const std::string &path) : MeshFile(FileData::Map(path)) {
+}
+
+MeshFile::MeshFile(FileData data) : file(std::move(data)) {
+    auto fail = [this](const std::string &what) {
+        throw std::runtime_error("Invalid Mesh File " + file.Path() + ": " + what);
+    };
+
+    if (file.Size() < sizeof(MeshFileHeader)) {
+        fail("Truncated Header");
+    }
+
+    header = reinterpret_cast<const MeshFileHeader *>(file.Data());
+    const MeshFileHeader &h = *header;
+    const uint64_t size = file.Size();
+
+    if (h.magic != MeshFileMagic) fail("Bad Magic");
+    if (h.version != MeshFileVersion) fail("Unsupported Version " + std::to_string(h.version));
+    if (h.fileSize != size) fail("Size Mismatch");
+
+    uint32_t expectedStride = (h.flags & MeshFileSkinned) ? sizeof(PackedSkinnedVertex) : sizeof(PackedVertex);
+    if (h.vertexStride != expectedStride) fail("Unexpected Vertex Stride");
+
+    if (!SectionFits(h.vertexOffset, h.vertexCount, h.vertexStride, size)) fail("Vertex Section Out of Bounds");
+    if (!SectionFits(h.indexOffset, h.indexCount, sizeof(uint32_t), size)) fail("Index Section Out of Bounds");
+    if (!SectionFits(h.meshOffset, h.meshCount, sizeof(MeshRecord), size)) fail("Mesh Section Out of Bounds");
+    if (!SectionFits(h.submeshOffset, h.submeshCount, sizeof(SubmeshRecord), size)) fail("Submesh Section Out of Bounds");
+    if (!SectionFits(h.lodOffset, h.lodCount, sizeof(LodRecord), size)) fail("LOD Section Out of Bounds");
+    if (!SectionFits(h.materialOffset, h.materialCount, sizeof(MaterialRecord), size)) fail("Material Section Out of Bounds");
+    if (!SectionFits(h.nodeOffset, h.nodeCount, sizeof(NodeRecord), size)) fail("Node Section Out of Bounds");
+    if (!SectionFits(h.skinOffset, h.skinCount, sizeof(SkinRecord), size)) fail("Skin Section Out of Bounds");
+    if (!SectionFits(h.jointOffset, h.jointCount, sizeof(JointRecord), size)) fail("Joint Section Out of Bounds");
+    if (!SectionFits(h.clipOffset, h.clipCount, sizeof(ClipRecord), size)) fail("Clip Section Out of Bounds");
+    if (!SectionFits(h.trackOffset, h.trackCount, sizeof(TrackRecord), size)) fail("Track Section Out of Bounds");
+    if (!SectionFits(h.keyTimeOffset, h.keyCount, sizeof(uint16_t), size)) fail("Key Time Section Out of Bounds");
+    if (!SectionFits(h.keyValueOffset, h.keyCount, 3 * sizeof(uint16_t), size)) fail("Key Value Section Out of Bounds");
+
+    // Cross references between records; indices themselves are trusted, like any other GPU-bound blob
+    for (uint32_t i = 0; i < h.meshCount; i++) {
+        const MeshRecord &mesh = Meshes()[i];
+        if (uint64_t(mesh.firstSubmesh) + mesh.submeshCount > h.submeshCount) fail("Mesh Submesh Range");
+    }
+
+    for (uint32_t i = 0; i < h.submeshCount; i++) {
+        const SubmeshRecord &submesh = Submeshes()[i];
+        if (uint64_t(submesh.firstLod) + submesh.lodCount > h.lodCount || submesh.lodCount == 0) fail("Submesh LOD Range");
+        if (submesh.material >= h.materialCount) fail("Submesh Material");
+    }
+
+    for (uint32_t i = 0; i < h.lodCount; i++) {
+        const LodRecord &lod = Lods()[i];
+        if (uint64_t(lod.firstIndex) + lod.indexCount > h.indexCount) fail("LOD Index Range");
+    }
+
+    for (uint32_t i = 0; i < h.nodeCount; i++) {
+        const NodeRecord &node = Nodes()[i];
+        if (node.parent >= static_cast<int32_t>(i)) fail("Node Parent Order");
+        if (node.mesh >= static_cast<int32_t>(h.meshCount)) fail("Node Mesh");
+        if (node.skin >= static_cast<int32_t>(h.skinCount)) fail("Node Skin");
+    }
+
+    for (uint32_t i = 0; i < h.skinCount; i++) {
+        const SkinRecord &skin = Skins()[i];
+        if (uint64_t(skin.firstJoint) + skin.jointCount > h.jointCount) fail("Skin Joint Range");
+    }
+
+    for (uint32_t i = 0; i < h.jointCount; i++) {
+        if (Joints()[i].node < 0 || Joints()[i].node >= static_cast<int32_t>(h.nodeCount)) fail("Joint Node");
+    }
+
+    uint32_t animatedJoints = h.skinCount > 0 ? Skins()[0].jointCount : 0;
+
+    for (uint32_t i = 0; i < h.clipCount; i++) {
+        const ClipRecord &clip = Clips()[i];
+        if (uint64_t(clip.firstTrack) + clip.trackCount > h.trackCount) fail("Clip Track Range");
+        if (!(clip.duration >= 0.0f)) fail("Clip Duration");
+    }
+
+    for (uint32_t i = 0; i < h.trackCount; i++) {
+        const TrackRecord &track = Tracks()[i];
+        if (uint64_t(track.firstKey) + track.keyCount > h.keyCount || track.keyCount == 0) fail("Track Key Range");
+        if (track.joint >= animatedJoints) fail("Track Joint");
+        if (track.channel > AnimationScale) fail("Track Channel");
+    }
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../Core/FileData.h"
+
+// Cooked mesh file (.mmesh). The file is the in-memory layout: a header followed by 16-byte aligned arrays of the
+// POD records below, referenced by byte offsets from the start of the file. Loading is mmap + validation; vertex and
+// index arrays are handed to glBufferData straight from the mapping.
+//
+// Vertices are interleaved and quantized: float3 position, octahedral snorm16x2 normal, half2 texcoord and, for
+// skinned meshes, 4 x uint8 joints + 4 x unorm8 weights. Indices are uint32 and hold every LOD level back to back.
+//
+// Animation clips drive the first skin. Each track animates one channel of one joint with keys reduced to those
+// linear interpolation cannot reproduce, then quantized to 48 bits: translation and scale as unorm16 within the
+// track's range, rotation as smallest-three (see Animation/KeyQuantization.h). Key times are unorm16 of the clip.
+
+constexpr uint32_t MeshFileMagic = 0x48534d4d;    // "MMSH"
+constexpr uint32_t MeshFileVersion = 2;
+constexpr uint32_t MeshFileAlignment = 16;
+
+enum MeshFileFlags : uint32_t {
+    MeshFileSkinned = 1u << 0,
+};
+
+struct MeshFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t vertexStride;
+
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t meshCount;
+    uint32_t submeshCount;
+    uint32_t lodCount;
+    uint32_t materialCount;
+    uint32_t nodeCount;
+    uint32_t skinCount;
+    uint32_t jointCount;
+    uint32_t clipCount;
+    uint32_t trackCount;
+    uint32_t keyCount;
+
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+    uint64_t meshOffset;
+    uint64_t submeshOffset;
+    uint64_t lodOffset;
+    uint64_t materialOffset;
+    uint64_t nodeOffset;
+    uint64_t skinOffset;
+    uint64_t jointOffset;
+    uint64_t clipOffset;
+    uint64_t trackOffset;
+    uint64_t keyTimeOffset;     // uint16 per key
+    uint64_t keyValueOffset;    // 3 x uint16 per key
+    uint64_t fileSize;
+
+    float boundsMin[3];
+    float boundsMax[3];
+};
+
+struct PackedVertex {
+    float position[3];
+    int16_t normal[2];          // octahedral, snorm16
+    uint16_t uv[2];             // half float
+};
+
+struct PackedSkinnedVertex {
+    PackedVertex base;
+    uint8_t joints[4];          // index into the skin's joint list
+    uint8_t weights[4];         // unorm8, sum to 255
+};
+
+// One glTF mesh: a run of submeshes (glTF primitives)
+struct MeshRecord {
+    uint32_t firstSubmesh;
+    uint32_t submeshCount;
+};
+
+struct SubmeshRecord {
+    uint32_t firstLod;
+    uint32_t lodCount;
+    uint32_t material;
+    uint32_t reserved;
+    float boundsMin[3];
+    float boundsMax[3];
+};
+
+struct LodRecord {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    float error;                // model units, see BuildLodChain
+    uint32_t reserved;
+};
+
+struct MaterialRecord {
+    char name[64];
+    char baseColorTexture[128]; // path relative to the mesh file, empty if none
+    float baseColor[4];
+    float metallic;
+    float roughness;
+    float alphaCutoff;          // 0 = opaque
+    uint32_t doubleSided;
+};
+
+struct NodeRecord {
+    char name[64];
+    int32_t parent;             // -1 for roots; parents always precede children
+    int32_t mesh;               // -1 if none
+    int32_t skin;               // -1 if none
+    uint32_t reserved;
+    float translation[3];
+    float rotation[4];          // x, y, z, w
+    float scale[3];
+};
+
+struct SkinRecord {
+    uint32_t firstJoint;
+    uint32_t jointCount;
+    int32_t skeletonRoot;       // node index, -1 if unspecified
+    uint32_t reserved;
+};
+
+struct JointRecord {
+    int32_t node;
+    uint32_t reserved[3];
+    float inverseBind[16];      // column major
+};
+
+struct ClipRecord {
+    char name[64];
+    float duration;             // seconds
+    uint32_t firstTrack;
+    uint32_t trackCount;
+    uint32_t reserved;
+};
+
+enum AnimationChannel : uint32_t {
+    AnimationTranslation = 0,
+    AnimationRotation = 1,
+    AnimationScale = 2,
+};
+
+struct TrackRecord {
+    uint32_t joint;             // index into the first skin's joint list
+    uint32_t channel;           // AnimationChannel
+    uint32_t firstKey;
+    uint32_t keyCount;
+    float rangeMin[3];          // translation / scale dequantization
+    float rangeExtent[3];
+};
+
+static_assert(sizeof(PackedVertex) == 20);
+static_assert(sizeof(PackedSkinnedVertex) == 28);
+static_assert(sizeof(MeshFileHeader) % 8 == 0);
+static_assert(sizeof(JointRecord) == 80);
+
+// Memory-mapped, validated view of a cooked mesh. Throws std::runtime_error if the file is malformed.
+class MeshFile {
+public:
+    // Maps a filesystem path; the game loads through the VFS and hands over the bytes instead
+    explicit MeshFile(const std::string &path);
+    explicit MeshFile(FileData data);
+
+    const MeshFileHeader &Header() const { return *header; }
+    bool IsSkinned() const { return (header->flags & MeshFileSkinned) != 0; }
+
+    const uint8_t *Vertices() const { return file.Data() + header->vertexOffset; }
+    const uint32_t *Indices() const { return Array<uint32_t>(header->indexOffset); }
+    const MeshRecord *Meshes() const { return Array<MeshRecord>(header->meshOffset); }
+    const SubmeshRecord *Submeshes() const { return Array<SubmeshRecord>(header->submeshOffset); }
+    const LodRecord *Lods() const { return Array<LodRecord>(header->lodOffset); }
+    const MaterialRecord *Materials() const { return Array<MaterialRecord>(header->materialOffset); }
+    const NodeRecord *Nodes() const { return Array<NodeRecord>(header->nodeOffset); }
+    const SkinRecord *Skins() const { return Array<SkinRecord>(header->skinOffset); }
+    const JointRecord *Joints() const { return Array<JointRecord>(header->jointOffset); }
+    const ClipRecord *Clips() const { return Array<ClipRecord>(header->clipOffset); }
+    const TrackRecord *Tracks() const { return Array<TrackRecord>(header->trackOffset); }
+    const uint16_t *KeyTimes() const { return Array<uint16_t>(header->keyTimeOffset); }
+    const uint16_t *KeyValues() const { return Array<uint16_t>(header->keyValueOffset); }
+
+private:
+    template<typename T>
+    const T *Array(uint64_t offset) const { return reinterpret_cast<const T *>(file.Data() + offset); }
+
+    FileData file;
+    const MeshFileHeader *header = nullptr;
+};
@@ -0,0 +1,129 @@
+#include "PackBuilder.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "PackFormat.h"
+#include "../Core/Lz4.h"
+
+namespace {
+    std::vector<uint8_t> ReadWholeFile(const std::filesystem::path &path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("Failed to Open File: " + path.string());
+        }
+
+        std::vector<uint8_t> bytes(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return bytes;
+    }
+
+    uint64_t AlignUp(uint64_t value) {
+        return (value + PackFileAlignment - 1) / PackFileAlignment * PackFileAlignment;
+    }
+}
+
+PackBuildStats BuildPackFile(const std::string &sourceDir, const std::string &outputPath, const PackBuildOptions &options) {
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(sourceDir)) {
+        throw std::runtime_error("Pack Source Is Not a Directory: " + sourceDir);
+    }
+
+    // Skip the output itself when it is written into the tree being packed
+    std::error_code error;
+    const fs::path output = fs::weakly_canonical(outputPath, error);
+
+    std::vector<std::string> names;
+    for (const auto &item: fs::recursive_directory_iterator(sourceDir)) {
+        if (!item.is_regular_file() || fs::weakly_canonical(item.path(), error) == output) continue;
+        names.push_back(NormalizeAssetPath(fs::relative(item.path(), sourceDir).generic_string()));
+    }
+    std::sort(names.begin(), names.end());
+
+    std::ofstream out(outputPath, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Failed to Write Pack File: " + outputPath);
+    }
+
+    PackBuildStats stats;
+    std::vector<PackEntry> entries;
+    std::string nameTable;
+    std::vector<uint8_t> compressed;
+    const char zeros[PackFileAlignment] = {};
+
+    PackFileHeader header{};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    uint64_t offset = sizeof(header);
+
+    auto pad = [&](uint64_t to) {
+        out.write(zeros, static_cast<std::streamsize>(to - offset));
+        offset = to;
+    };
+
+    for (const std::string &name: names) {
+        std::vector<uint8_t> bytes = ReadWholeFile(fs::path(sourceDir) / name);
+
+        PackEntry entry{};
+        entry.pathHash = PackPathHash(name);
+        entry.size = bytes.size();
+        entry.nameOffset = static_cast<uint32_t>(nameTable.size());
+        entry.nameLength = static_cast<uint32_t>(name.size());
+        entry.compression = PackStored;
+
+        const uint8_t *blob = bytes.data();
+        uint64_t blobSize = bytes.size();
+
+        if (options.compression != PackCompressionMode::None && !bytes.empty() && bytes.size() <= PackMaxLz4Size) {
+            Lz4Compress(bytes, compressed);
+            const bool worthIt = compressed.size() <= bytes.size() * (1.0 - options.minSavings);
+            if (options.compression == PackCompressionMode::All || worthIt) {
+                entry.compression = PackLz4;
+                blob = compressed.data();
+                blobSize = compressed.size();
+                stats.compressed++;
+            }
+        }
+
+        pad(AlignUp(offset));
+        entry.offset = offset;
+        entry.storedSize = blobSize;
+        out.write(reinterpret_cast<const char *>(blob), static_cast<std::streamsize>(blobSize));
+        offset += blobSize;
+
+        nameTable += name;
+        entries.push_back(entry);
+        stats.files++;
+        stats.inputBytes += bytes.size();
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const PackEntry &a, const PackEntry &b) { return a.pathHash < b.pathHash; });
+
+    pad(AlignUp(offset));
+    header.entryOffset = offset;
+    out.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackEntry)));
+    offset += entries.size() * sizeof(PackEntry);
+
+    header.nameOffset = offset;
+    header.nameSize = nameTable.size();
+    out.write(nameTable.data(), static_cast<std::streamsize>(nameTable.size()));
+    offset += nameTable.size();
+
+    header.magic = PackFileMagic;
+    header.version = PackFileVersion;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.fileSize = offset;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    if (!out) {
+        throw std::runtime_error("Failed to Write Pack File: " + outputPath);
+    }
+
+    stats.packBytes = offset;
+    return stats;
+}
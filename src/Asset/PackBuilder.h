@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class PackCompressionMode {
+    Auto,                                     // LZ4 where it saves at least minSavings, stored otherwise
+    None,
+    All,
+};
+
+struct PackBuildOptions {
+    PackCompressionMode compression = PackCompressionMode::Auto;
+    float minSavings = 0.125f;
+};
+
+struct PackBuildStats {
+    size_t files = 0;
+    size_t compressed = 0;
+    uint64_t inputBytes = 0;
+    uint64_t packBytes = 0;
+};
+
+// Packs every regular file under sourceDir into outputPath (see PackFormat.h), named by its path relative to
+// sourceDir. Files are laid out in path order so related assets stay adjacent on disk.
+PackBuildStats BuildPackFile(const std::string &sourceDir, const std::string &outputPath, const PackBuildOptions &options = {});
@@ -0,0 +1,87 @@
+#include "PackFormat.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+uint64_t PackPathHash(std::string_view path) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c: path) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::string NormalizeAssetPath(std::string_view path) {
+    std::string out;
+    out.reserve(path.size());
+
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = start;
+        while (end < path.size() && path[end] != '/' && path[end] != '\\') end++;
+
+        const std::string_view segment = path.substr(start, end - start);
+        if (segment == "..") {
+            // Loose reads join this onto a root, so nothing may climb out of it
+            if (out.empty()) throw std::runtime_error("Invalid Asset Path: " + std::string(path));
+            const size_t slash = out.rfind('/');
+            out.erase(slash == std::string::npos ? 0 : slash);
+        } else if (!segment.empty() && segment != ".") {
+            if (!out.empty()) out.push_back('/');
+            out.append(segment);
+        }
+        start = end + 1;
+    }
+    return out;
+}
+
+PackFile::PackFile(const std::string &path) : path(path), file(path) {
+    auto fail = [&path](const std::string &what) {
+        throw std::runtime_error("Invalid Pack File " + path + ": " + what);
+    };
+
+    if (file.Size() < sizeof(PackFileHeader)) fail("Truncated Header");
+
+    header = reinterpret_cast<const PackFileHeader *>(file.Data());
+    const PackFileHeader &h = *header;
+    const uint64_t size = file.Size();
+
+    if (h.magic != PackFileMagic) fail("Bad Magic");
+    if (h.version != PackFileVersion) fail("Unsupported Version " + std::to_string(h.version));
+    if (h.fileSize != size) fail("Size Mismatch");
+    if (h.entryOffset % alignof(PackEntry) != 0 || h.entryOffset > size || h.entryCount > (size - h.entryOffset) / sizeof(PackEntry)) {
+        fail("Table of Contents Out of Bounds");
+    }
+    if (h.nameOffset > size || h.nameSize > size - h.nameOffset) fail("Name Table Out of Bounds");
+
+    // Blobs and names must lie inside the file, and the table must be sorted for Find()
+    std::span<const PackEntry> entries = Entries();
+    for (size_t i = 0; i < entries.size(); i++) {
+        const PackEntry &entry = entries[i];
+        if (entry.offset > size || entry.storedSize > size - entry.offset) fail("Blob Out of Bounds");
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > h.nameSize) fail("Name Out of Bounds");
+        if (entry.compression != PackStored && entry.compression != PackLz4) fail("Unknown Compression " + std::to_string(entry.compression));
+        if (entry.compression == PackStored && entry.storedSize != entry.size) fail("Stored Size Mismatch");
+        if (entry.compression == PackLz4 && (entry.size > PackMaxLz4Size || entry.size > entry.storedSize * PackMaxLz4Ratio)) {
+            fail("Compressed Size Out of Range");
+        }
+        if (i > 0 && entries[i - 1].pathHash > entry.pathHash) fail("Unsorted Table of Contents");
+    }
+}
+
+std::string_view PackFile::Name(const PackEntry &entry) const {
+    return {reinterpret_cast<const char *>(file.Data() + header->nameOffset + entry.nameOffset), entry.nameLength};
+}
+
+const PackEntry *PackFile::Find(std::string_view path) const {
+    const uint64_t hash = PackPathHash(path);
+    std::span<const PackEntry> entries = Entries();
+    auto it = std::lower_bound(entries.begin(), entries.end(), hash, [](const PackEntry &e, uint64_t h) { return e.pathHash < h; });
+
+    // Colliding hashes sit next to each other; the name settles it
+    for (; it != entries.end() && it->pathHash == hash; ++it) {
+        if (Name(*it) == path) return &*it;
+    }
+    return nullptr;
+}
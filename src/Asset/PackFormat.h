@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "../Core/MappedFile.h"
+
+// Asset pack (.mpak). A header, then every file's blob at a PackFileAlignment boundary, then a table of contents
+// sorted by path hash and the paths themselves. Stored blobs are served straight from the mapping; blobs that
+// compressed well are LZ4 blocks (see Core/Lz4.h) and are expanded on read. Paths are normalized asset paths
+// ("shaders/basic.vert"): forward slashes, no leading slash or "./".
+
+constexpr uint32_t PackFileMagic = 0x4b41504d;    // "MPAK"
+constexpr uint32_t PackFileVersion = 1;
+constexpr uint32_t PackFileAlignment = 64;
+
+// Readers allocate an LZ4 entry's full size up front, so a mount rejects sizes an LZ4 block cannot expand to (at most
+// 255 bytes out per byte in) or past this cap. The builder stores bigger files uncompressed.
+constexpr uint64_t PackMaxLz4Ratio = 255;
+constexpr uint64_t PackMaxLz4Size = uint64_t(1) << 30;
+
+enum PackCompression : uint32_t {
+    PackStored = 0,
+    PackLz4 = 1,
+};
+
+struct PackFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t entryOffset;
+    uint64_t nameOffset;
+    uint64_t nameSize;
+    uint64_t fileSize;
+};
+
+struct PackEntry {
+    uint64_t pathHash;
+    uint64_t offset;
+    uint64_t storedSize;
+    uint64_t size;                            // after decompression
+    uint32_t nameOffset;                      // into the name table
+    uint32_t nameLength;
+    uint32_t compression;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(PackFileHeader) == 48);
+static_assert(sizeof(PackEntry) == 48);
+
+// 64-bit FNV-1a of a normalized path
+uint64_t PackPathHash(std::string_view path);
+
+// Forward slashes, "." segments and leading slashes dropped: "/textures/wall.jpg" and ".\\textures\\wall.jpg" are
+// both "textures/wall.jpg". ".." drops the segment before it; a path that would climb above the root throws
+// std::runtime_error.
+std::string NormalizeAssetPath(std::string_view path);
+
+// Memory-mapped, validated view of a pack. Throws std::runtime_error if the file is malformed.
+class PackFile {
+public:
+    explicit PackFile(const std::string &path);
+
+    // Entry for a normalized path, or null
+    const PackEntry *Find(std::string_view path) const;
+
+    std::span<const PackEntry> Entries() const { return {Array<PackEntry>(header->entryOffset), header->entryCount}; }
+    std::string_view Name(const PackEntry &entry) const;
+    std::span<const uint8_t> Stored(const PackEntry &entry) const { return {file.Data() + entry.offset, entry.storedSize}; }
+
+    const std::string &Path() const { return path; }
+
+private:
+    template<typename T>
+    const T *Array(uint64_t offset) const { return reinterpret_cast<const T *>(file.Data() + offset); }
+
+    std::string path;
+    MappedFile file;
+    const PackFileHeader *header = nullptr;
+};
@@ -0,0 +1,220 @@
+#include "Vfs.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include "../Core/AsyncIo.h"
+#include "../Core/Lz4.h"
+
+void Vfs::Mount(const std::string &packPath) {
+    packs.push_back(std::make_shared<const PackFile>(packPath));
+}
+
+bool Vfs::MountIfPresent(const std::string &packPath) {
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(packPath, error)) return false;
+
+    Mount(packPath);
+    return true;
+}
+
+void Vfs::AddLooseRoot(const std::string &directory) {
+    looseRoots.push_back(directory);
+}
+
+std::string Vfs::LoosePath(const std::string &root, const std::string &path) const {
+    if (root.empty() || root == ".") return path;
+    return root.back() == '/' || root.back() == '\\' ? root + path : root + "/" + path;
+}
+
+bool Vfs::Exists(std::string_view path) const {
+    std::string normalized;
+    try {
+        normalized = NormalizeAssetPath(path);
+    } catch (const std::exception &) {
+        return false;
+    }
+
+    for (const auto &pack: packs) {
+        if (pack->Find(normalized)) return true;
+    }
+
+    std::error_code error;
+    if (looseRoots.empty()) return std::filesystem::is_regular_file(normalized, error);
+
+    for (const std::string &root: looseRoots) {
+        if (std::filesystem::is_regular_file(LoosePath(root, normalized), error)) return true;
+    }
+    return false;
+}
+
+FileData Vfs::Read(std::string_view path) const {
+    const std::string normalized = NormalizeAssetPath(path);
+
+    for (auto pack = packs.rbegin(); pack != packs.rend(); ++pack) {
+        const PackEntry *entry = (*pack)->Find(normalized);
+        if (!entry) continue;
+
+        std::span<const uint8_t> stored = (*pack)->Stored(*entry);
+
+        if (entry->compression == PackStored) {
+            {
+                std::lock_guard lock(statsMutex);
+                stats.packReads++;
+                stats.bytesRead += entry->size;
+            }
+            // Aliases the pack mapping, which the shared pointer keeps alive
+            return {*pack, stored.data(), stored.size(), normalized};
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<uint8_t> bytes(entry->size);
+        if (!Lz4Decompress(stored, bytes)) {
+            throw std::runtime_error("Corrupt Pack Entry: " + normalized + " in " + (*pack)->Path());
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        {
+            std::lock_guard lock(statsMutex);
+            stats.decompressedReads++;
+            stats.bytesRead += entry->size;
+            stats.bytesDecompressed += entry->size;
+            stats.decompressMs += ms;
+        }
+        return FileData::Own(std::move(bytes), normalized);
+    }
+
+    std::error_code error;
+    const std::vector<std::string> cwd = {"."};
+    for (const std::string &root: looseRoots.empty() ? cwd : looseRoots) {
+        const std::string loose = LoosePath(root, normalized);
+        if (!std::filesystem::is_regular_file(loose, error)) continue;
+
+        FileData data = FileData::Map(loose);
+        {
+            std::lock_guard lock(statsMutex);
+            stats.looseReads++;
+            stats.bytesRead += data.Size();
+        }
+        return data;
+    }
+
+    {
+        std::lock_guard lock(statsMutex);
+        stats.misses++;
+    }
+    throw std::runtime_error("Failed to Open File: " + normalized);
+}
+
+void Vfs::QueueRead(AsyncIo &io, std::string_view path, ReadCallback done) const {
+    std::string normalized;
+    try {
+        normalized = NormalizeAssetPath(path);
+    } catch (const std::exception &ex) {
+        FileData none;
+        done(none, ex.what());
+        return;
+    }
+
+    for (auto pack = packs.rbegin(); pack != packs.rend(); ++pack) {
+        const PackEntry *entry = (*pack)->Find(normalized);
+        if (!entry) continue;
+
+        // Read the blob with a plain read rather than faulting in the mapping, so the caller never waits on the disk
+        IoRead read;
+        read.path = (*pack)->Path();
+        read.offset = entry->offset;
+        read.size = entry->storedSize;
+        read.done = [this, name = normalized, size = entry->size, compression = entry->compression, done = std::move(done)](IoCompletion &completion) {
+            FileData data;
+            if (completion.error) {
+                done(data, "Failed to Read File: " + name + " (" + std::strerror(completion.error) + ")");
+                return;
+            }
+
+            if (compression == PackStored) {
+                data = FileData::Own(std::move(completion.bytes), name);
+                std::lock_guard lock(statsMutex);
+                stats.packReads++;
+                stats.bytesRead += size;
+            } else {
+                // Failures here (the buffer allocation included) go to the callback, not up into the I/O layer
+                auto start = std::chrono::steady_clock::now();
+                std::string error;
+                try {
+                    std::vector<uint8_t> bytes(size);
+                    if (Lz4Decompress(completion.bytes, bytes)) {
+                        data = FileData::Own(std::move(bytes), name);
+                    } else {
+                        error = "Corrupt Pack Entry: " + name;
+                    }
+                } catch (const std::exception &ex) {
+                    error = "Failed to Read File: " + name + " (" + ex.what() + ")";
+                }
+                if (!error.empty()) {
+                    done(data, error);
+                    return;
+                }
+
+                const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                std::lock_guard lock(statsMutex);
+                stats.decompressedReads++;
+                stats.bytesRead += size;
+                stats.bytesDecompressed += size;
+                stats.decompressMs += ms;
+            }
+            done(data, {});
+        };
+        io.Queue(std::move(read));
+        return;
+    }
+
+    // Loose: the first root that has the file (only worth a stat with several roots), else the first root so the
+    // read fails with a useful error
+    std::error_code error;
+    std::string loose = looseRoots.empty() ? normalized : LoosePath(looseRoots.front(), normalized);
+    if (looseRoots.size() > 1 && !std::filesystem::is_regular_file(loose, error)) {
+        for (size_t i = 1; i < looseRoots.size(); i++) {
+            std::string candidate = LoosePath(looseRoots[i], normalized);
+            if (std::filesystem::is_regular_file(candidate, error)) {
+                loose = std::move(candidate);
+                break;
+            }
+        }
+    }
+
+    IoRead read;
+    read.path = loose;
+    read.done = [this, name = std::move(normalized), done = std::move(done)](IoCompletion &completion) {
+        FileData data;
+        if (completion.error) {
+            {
+                std::lock_guard lock(statsMutex);
+                stats.misses++;
+            }
+            done(data, "Failed to Open File: " + name);
+            return;
+        }
+
+        {
+            std::lock_guard lock(statsMutex);
+            stats.looseReads++;
+            stats.bytesRead += completion.bytes.size();
+        }
+        data = FileData::Own(std::move(completion.bytes), completion.path);
+        done(data, {});
+    };
+    io.Queue(std::move(read));
+}
+
+VfsStats Vfs::GetStats() const {
+    std::lock_guard lock(statsMutex);
+    return stats;
+}
+
+Vfs &AssetFiles() {
+    static Vfs vfs;
+    return vfs;
+}
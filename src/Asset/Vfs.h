@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Core/FileData.h"
+#include "PackFormat.h"
+
+class AsyncIo;
+
+struct VfsStats {
+    size_t packReads = 0;                     // served from a mounted pack without copying
+    size_t decompressedReads = 0;             // served from a pack through LZ4
+    size_t looseReads = 0;                    // fell back to a loose file
+    size_t misses = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesDecompressed = 0;
+    double decompressMs = 0.0;
+};
+
+// Asset lookup by normalized path. Mounted packs are searched newest first, so a patch pack overrides the base
+// pack; anything not in a pack falls back to loose files under the loose roots (the working directory unless
+// roots were added), which keeps edit-and-reload working during development.
+//
+// Mount and AddLooseRoot are for startup; Exists and Read may then be called from any thread.
+class Vfs {
+public:
+    // Throws std::runtime_error if the pack cannot be opened or is malformed
+    void Mount(const std::string &packPath);
+    // Same, but a missing file is not an error (a development tree has no pack)
+    bool MountIfPresent(const std::string &packPath);
+    void AddLooseRoot(const std::string &directory);
+
+    bool Exists(std::string_view path) const;
+
+    // Throws std::runtime_error if the path is in no pack and no loose root, climbs out of the roots with "..", or a
+    // compressed entry is corrupt
+    FileData Read(std::string_view path) const;
+
+    // Queues a background read of the same bytes on io; it starts with the next io.Submit(). done runs wherever io
+    // delivers completions (a decode job) with the contents, decompressed if need be, or with an error message and
+    // no data. A path that climbs out of the roots fails at once, with done called before QueueRead returns.
+    using ReadCallback = std::function<void(FileData &data, const std::string &error)>;
+    void QueueRead(AsyncIo &io, std::string_view path, ReadCallback done) const;
+
+    size_t PackCount() const { return packs.size(); }
+    VfsStats GetStats() const;
+
+private:
+    std::string LoosePath(const std::string &root, const std::string &path) const;
+
+    std::vector<std::shared_ptr<const PackFile>> packs;
+    std::vector<std::string> looseRoots;
+
+    mutable std::mutex statsMutex;
+    mutable VfsStats stats;
+};
+
+// Process-wide instance the loaders read through
+Vfs &AssetFiles();
@@ -0,0 +1,436 @@
+#include "AsyncIo.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#include "JobSystem.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <atomic>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace {
+    constexpr uint64_t MaxChunk = uint64_t(1) << 30;
+
+#ifndef _WIN32
+    // Opens the file and clamps the requested range to it; -1 with error set on failure
+    int OpenForRead(const IoRead &read, uint64_t &size, int &error) {
+        int fd = open(read.path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            error = errno;
+            return -1;
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0) {
+            error = errno;
+            close(fd);
+            return -1;
+        }
+
+        const auto fileSize = static_cast<uint64_t>(st.st_size);
+        size = read.offset >= fileSize ? 0 : std::min(read.size, fileSize - read.offset);
+        return fd;
+    }
+#endif
+
+    void ReadBlocking(const IoRead &read, IoCompletion &completion) {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(read.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            completion.error = ENOENT;
+            return;
+        }
+
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(file, &fileSize);
+        const auto total = static_cast<uint64_t>(fileSize.QuadPart);
+        const uint64_t size = read.offset >= total ? 0 : std::min(read.size, total - read.offset);
+        completion.bytes.resize(size);
+
+        for (uint64_t done = 0; done < size;) {
+            const uint64_t position = read.offset + done;
+            OVERLAPPED at{};
+            at.Offset = static_cast<DWORD>(position);
+            at.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+            DWORD got = 0;
+            if (!ReadFile(file, completion.bytes.data() + done, static_cast<DWORD>(std::min(size - done, MaxChunk)), &got, &at) || got == 0) {
+                completion.error = EIO;
+                break;
+            }
+            done += got;
+        }
+        CloseHandle(file);
+#else
+        uint64_t size = 0;
+        int fd = OpenForRead(read, size, completion.error);
+        if (fd < 0) return;
+
+        completion.bytes.resize(size);
+        for (uint64_t done = 0; done < size;) {
+            ssize_t got = pread(fd, completion.bytes.data() + done, std::min(size - done, MaxChunk), static_cast<off_t>(read.offset + done));
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) {
+                completion.error = got < 0 ? errno : EIO;
+                break;
+            }
+            done += static_cast<uint64_t>(got);
+        }
+        close(fd);
+#endif
+        if (completion.error) completion.bytes.clear();
+    }
+}
+
+struct AsyncIo::InFlight {
+    IoRead request;
+    std::shared_ptr<IoCompletion> completion;
+    int fd = -1;
+    uint64_t size = 0;
+    uint64_t done = 0;
+};
+
+#ifdef __linux__
+// Raw io_uring (no liburing dependency): the submission and completion rings mapped from the kernel. Only the I/O
+// thread reaps completions; submissions come from it and from WakeRing() on other threads, serialized by sqMutex.
+struct AsyncIo::Ring {
+    int fd = -1;
+    unsigned entries = 0;
+    void *sqMap = nullptr;
+    void *cqMap = nullptr;
+    size_t sqMapSize = 0;
+    size_t cqMapSize = 0;
+    io_uring_sqe *sqes = nullptr;
+    size_t sqesSize = 0;
+    unsigned *sqHead = nullptr, *sqTail = nullptr, *sqMask = nullptr, *sqArray = nullptr;
+    unsigned *cqHead = nullptr, *cqTail = nullptr, *cqMask = nullptr;
+    io_uring_cqe *cqes = nullptr;
+
+    std::mutex sqMutex;
+    bool wakePosted = false;
+
+    static std::unique_ptr<Ring> Create(unsigned depth) {
+        io_uring_params params{};
+        int ringFd = static_cast<int>(syscall(__NR_io_uring_setup, depth, &params));
+        if (ringFd < 0) return nullptr;
+
+        auto ring = std::make_unique<Ring>();
+        ring->fd = ringFd;
+        ring->entries = params.sq_entries;
+        ring->sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) ring->sqMapSize = ring->cqMapSize = std::max(ring->sqMapSize, ring->cqMapSize);
+
+        auto map = [ringFd](size_t size, off_t offset) -> void * {
+            void *view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, offset);
+            return view == MAP_FAILED ? nullptr : view;
+        };
+
+        ring->sqMap = map(ring->sqMapSize, IORING_OFF_SQ_RING);
+        if (!ring->sqMap) return nullptr;
+        ring->cqMap = singleMap ? ring->sqMap : map(ring->cqMapSize, IORING_OFF_CQ_RING);
+        if (!ring->cqMap) return nullptr;
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        ring->sqes = static_cast<io_uring_sqe *>(map(ring->sqesSize, IORING_OFF_SQES));
+        if (!ring->sqes) return nullptr;
+
+        auto *sq = static_cast<uint8_t *>(ring->sqMap);
+        auto *cq = static_cast<uint8_t *>(ring->cqMap);
+        ring->sqHead = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        ring->sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        ring->sqMask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        ring->sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        ring->cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        ring->cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        ring->cqMask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        return ring;
+    }
+
+    ~Ring() {
+        if (sqes) munmap(sqes, sqesSize);
+        if (cqMap && cqMap != sqMap) munmap(cqMap, cqMapSize);
+        if (sqMap) munmap(sqMap, sqMapSize);
+        if (fd >= 0) close(fd);
+    }
+
+    // Caller holds sqMutex. Every push is followed by Enter(), which consumes the whole queue, so it never fills.
+    void Push(const io_uring_sqe &sqe) {
+        const unsigned tail = *sqTail;
+        const unsigned index = tail & *sqMask;
+        sqes[index] = sqe;
+        sqArray[index] = index;
+        std::atomic_ref<unsigned>(*sqTail).store(tail + 1, std::memory_order_release);
+    }
+
+    void Enter(unsigned submit, unsigned wait) const {
+        const unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+        while (syscall(__NR_io_uring_enter, fd, submit, wait, flags, nullptr, 0) < 0 && errno == EINTR) {
+        }
+    }
+
+    void Reap(std::vector<io_uring_cqe> &out) {
+        unsigned head = *cqHead;
+        const unsigned tail = std::atomic_ref<unsigned>(*cqTail).load(std::memory_order_acquire);
+        for (; head != tail; head++) out.push_back(cqes[head & *cqMask]);
+        std::atomic_ref<unsigned>(*cqHead).store(head, std::memory_order_release);
+    }
+
+    static io_uring_sqe ReadSqe(InFlight &op) {
+        io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = op.fd;
+        sqe.addr = reinterpret_cast<uint64_t>(op.completion->bytes.data() + op.done);
+        sqe.len = static_cast<uint32_t>(std::min(op.size - op.done, MaxChunk));
+        sqe.off = op.request.offset + op.done;
+        sqe.user_data = reinterpret_cast<uint64_t>(&op);
+        return sqe;
+    }
+};
+#else
+struct AsyncIo::Ring {
+};
+#endif
+
+AsyncIo::AsyncIo(JobSystem *jobs, const AsyncIoSettings &settings) : jobs(jobs), settings(settings) {
+    this->settings.queueDepth = std::max(1u, settings.queueDepth);
+
+#ifdef __linux__
+    if (settings.allowIoUring) ring = Ring::Create(this->settings.queueDepth);
+#endif
+
+    if (ring) {
+        threads.emplace_back(&AsyncIo::RingLoop, this);
+    } else {
+        for (unsigned i = 0; i < std::max(1u, settings.poolThreads); i++) {
+            threads.emplace_back(&AsyncIo::PoolLoop, this);
+        }
+    }
+}
+
+AsyncIo::~AsyncIo() {
+    // Callbacks reference this object, so let everything already submitted finish
+    WaitIdle();
+
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+    WakeRing();
+    for (std::thread &thread: threads) {
+        thread.join();
+    }
+}
+
+void AsyncIo::Queue(IoRead read) {
+    std::lock_guard lock(mutex);
+    queued.push_back(std::move(read));
+}
+
+void AsyncIo::Submit() {
+    {
+        std::lock_guard lock(mutex);
+        if (queued.empty()) return;
+
+        stats.batches++;
+        outstanding += queued.size();
+        for (IoRead &read: queued) ready.push_back(std::move(read));
+        queued.clear();
+    }
+
+    wake.notify_all();
+    WakeRing();
+}
+
+void AsyncIo::WaitIdle() {
+    std::unique_lock lock(mutex);
+    idle.wait(lock, [this]() { return outstanding == 0; });
+}
+
+size_t AsyncIo::Outstanding() const {
+    std::lock_guard lock(mutex);
+    return outstanding;
+}
+
+AsyncIoStats AsyncIo::GetStats() const {
+    std::lock_guard lock(mutex);
+    return stats;
+}
+
+bool AsyncIo::TakeReady(std::vector<IoRead> &out, size_t limit, bool block) {
+    std::unique_lock lock(mutex);
+    if (block) {
+        wake.wait(lock, [this]() { return stopping || !ready.empty(); });
+        if (ready.empty()) return false;
+    }
+
+    while (!ready.empty() && out.size() < limit) {
+        out.push_back(std::move(ready.front()));
+        ready.pop_front();
+    }
+    stats.peakInFlight = std::max(stats.peakInFlight, outstanding - ready.size());
+    return true;
+}
+
+void AsyncIo::Complete(std::shared_ptr<IoCompletion> completion, std::function<void(IoCompletion &)> done) {
+    {
+        std::lock_guard lock(mutex);
+        stats.reads++;
+        if (completion->error) stats.failed++;
+        stats.bytes += completion->bytes.size();
+    }
+
+    // A throwing callback is counted and dropped; outstanding is released either way or WaitIdle() would never return
+    auto finish = [this, completion = std::move(completion), done = std::move(done)]() {
+        bool threw = false;
+        try {
+            if (done) done(*completion);
+        } catch (...) {
+            threw = true;
+        }
+
+        std::lock_guard lock(mutex);
+        if (threw) stats.callbackFailures++;
+        if (--outstanding == 0) idle.notify_all();
+    };
+
+    // Background so a waiting caller never picks up a read and its decode
+    if (jobs) {
+        jobs->SubmitBackground(std::move(finish));
+    } else {
+        finish();
+    }
+}
+
+void AsyncIo::PoolLoop() {
+    std::vector<IoRead> taken;
+    while (TakeReady(taken, 1, true)) {
+        for (IoRead &read: taken) {
+            auto completion = std::make_shared<IoCompletion>();
+            completion->path = read.path;
+            completion->offset = read.offset;
+            ReadBlocking(read, *completion);
+            Complete(std::move(completion), std::move(read.done));
+        }
+        taken.clear();
+    }
+}
+
+void AsyncIo::WakeRing() {
+#ifdef __linux__
+    if (!ring) return;
+
+    // A no-op completion pulls the I/O thread out of its wait for reads so it picks up the new batch
+    std::lock_guard lock(ring->sqMutex);
+    if (ring->wakePosted) return;
+
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_NOP;
+    sqe.user_data = 0;
+    ring->Push(sqe);
+    ring->Enter(1, 0);
+    ring->wakePosted = true;
+#endif
+}
+
+void AsyncIo::RingLoop() {
+#ifdef __linux__
+    std::vector<IoRead> taken;
+    std::vector<io_uring_sqe> batch;
+    std::vector<io_uring_cqe> reaped;
+    size_t inFlight = 0;
+
+    auto submitBatch = [&]() {
+        if (batch.empty()) return;
+        std::lock_guard lock(ring->sqMutex);
+        for (const io_uring_sqe &sqe: batch) ring->Push(sqe);
+        ring->Enter(static_cast<unsigned>(batch.size()), 0);
+        batch.clear();
+    };
+
+    for (;;) {
+        // Only sleep on the condition variable with nothing in the kernel; otherwise poll for new work and go wait
+        // for completions, which WakeRing() interrupts
+        taken.clear();
+        if (!TakeReady(taken, settings.queueDepth - inFlight, inFlight == 0)) break;
+
+        for (IoRead &read: taken) {
+            auto op = std::make_unique<InFlight>();
+            op->completion = std::make_shared<IoCompletion>();
+            op->completion->path = read.path;
+            op->completion->offset = read.offset;
+            op->fd = OpenForRead(read, op->size, op->completion->error);
+
+            if (op->fd < 0 || op->size == 0) {
+                if (op->fd >= 0) close(op->fd);
+                Complete(std::move(op->completion), std::move(read.done));
+                continue;
+            }
+
+            op->completion->bytes.resize(op->size);
+            op->request = std::move(read);
+            batch.push_back(Ring::ReadSqe(*op));
+            op.release();
+            inFlight++;
+        }
+        submitBatch();
+
+        if (inFlight == 0) continue;
+        ring->Enter(0, 1);
+
+        reaped.clear();
+        ring->Reap(reaped);
+        for (const io_uring_cqe &cqe: reaped) {
+            if (cqe.user_data == 0) {
+                std::lock_guard lock(ring->sqMutex);
+                ring->wakePosted = false;
+                continue;
+            }
+
+            auto *op = reinterpret_cast<InFlight *>(cqe.user_data);
+            if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+                batch.push_back(Ring::ReadSqe(*op));
+                continue;
+            }
+
+            if (cqe.res < 0) {
+                op->completion->error = -cqe.res;
+            } else if (cqe.res == 0) {
+                op->completion->error = EIO;          // the file shrank under us
+            } else {
+                op->done += static_cast<uint64_t>(cqe.res);
+                if (op->done < op->size) {
+                    batch.push_back(Ring::ReadSqe(*op));
+                    continue;
+                }
+            }
+
+            close(op->fd);
+            if (op->completion->error) op->completion->bytes.clear();
+            Complete(std::move(op->completion), std::move(op->request.done));
+            delete op;
+            inFlight--;
+        }
+        submitBatch();
+    }
+#endif
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+
+enum class AsyncIoBackend {
+    IoUring,
+    ThreadPool,
+};
+
+struct AsyncIoSettings {
+    unsigned queueDepth = 64;                 // reads in flight at once
+    unsigned poolThreads = 4;                 // blocking readers when io_uring is unavailable
+    bool allowIoUring = true;
+};
+
+struct AsyncIoStats {
+    size_t reads = 0;
+    size_t failed = 0;
+    size_t callbackFailures = 0;              // completion callbacks that threw
+    size_t batches = 0;                       // Submit() calls that carried at least one read
+    size_t peakInFlight = 0;
+    uint64_t bytes = 0;
+};
+
+constexpr uint64_t IoWholeFile = ~uint64_t(0);
+
+// A finished read: the bytes, or an errno value in error and no bytes
+struct IoCompletion {
+    std::string path;
+    uint64_t offset = 0;
+    std::vector<uint8_t> bytes;
+    int error = 0;
+};
+
+struct IoRead {
+    std::string path;
+    uint64_t offset = 0;
+    uint64_t size = IoWholeFile;              // clamped to the end of the file
+    std::function<void(IoCompletion &)> done;
+};
+
+// Background file reads. Reads are queued from any thread and go to the kernel together on Submit(), through one
+// io_uring on Linux or a small pool of threads doing pread elsewhere (or if the ring cannot be created). Each
+// completion callback runs as a background job on the given JobSystem (a worker, never a thread inside Wait()), so the
+// buffer goes straight to a decode job; with no JobSystem it runs on the I/O thread. Nothing here blocks the submitting
+// thread except WaitIdle(). Callbacks should report failures through their own arguments: one that throws anyway is
+// only counted in AsyncIoStats.
+class AsyncIo {
+public:
+    explicit AsyncIo(JobSystem *jobs = nullptr, const AsyncIoSettings &settings = {});
+    ~AsyncIo();
+
+    AsyncIo(const AsyncIo &) = delete;
+    AsyncIo &operator=(const AsyncIo &) = delete;
+
+    void Queue(IoRead read);
+    void Submit();
+    void Read(IoRead read) {
+        Queue(std::move(read));
+        Submit();
+    }
+
+    // Blocks until every submitted read has completed and its callback has returned
+    void WaitIdle();
+
+    // Submitted reads whose callbacks have not returned yet
+    size_t Outstanding() const;
+
+    AsyncIoBackend Backend() const { return ring ? AsyncIoBackend::IoUring : AsyncIoBackend::ThreadPool; }
+    AsyncIoStats GetStats() const;
+
+private:
+    struct Ring;
+    struct InFlight;
+
+    void RingLoop();
+    void PoolLoop();
+    void WakeRing();
+    bool TakeReady(std::vector<IoRead> &out, size_t limit, bool block);
+    void Complete(std::shared_ptr<IoCompletion> completion, std::function<void(IoCompletion &)> done);
+
+    JobSystem *jobs;
+    AsyncIoSettings settings;
+    std::unique_ptr<Ring> ring;
+    std::vector<std::thread> threads;
+
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::deque<IoRead> queued;                // waiting for Submit()
+    std::deque<IoRead> ready;                 // submitted, not yet handed to the kernel or a reader
+    size_t outstanding = 0;
+    bool stopping = false;
+    AsyncIoStats stats;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "MappedFile.h"
+
+// Read-only bytes of a loaded file plus whatever keeps them alive: a mapping of a loose file, the mapping of the pack
+// it sits in, or a buffer it was decompressed into. Copies share the owner, so views stay valid as long as any copy does.
+class FileData {
+public:
+    FileData() = default;
+    FileData(std::shared_ptr<const void> owner, const uint8_t *data, size_t size, std::string path)
+        : owner(std::move(owner)), data(data), size(size), path(std::move(path)) {
+    }
+
+    // Maps a filesystem path directly. Throws std::runtime_error if it cannot be opened.
+    static FileData Map(const std::string &path) {
+        auto file = std::make_shared<MappedFile>(path);
+        return {file, file->Data(), file->Size(), path};
+    }
+
+    static FileData Own(std::vector<uint8_t> bytes, std::string path) {
+        auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(bytes));
+        return {buffer, buffer->data(), buffer->size(), std::move(path)};
+    }
+
+    // A sub-range that keeps the whole buffer alive; the caller checks the range
+    FileData Slice(uint64_t offset, uint64_t length, std::string name) const {
+        return {owner, data + offset, static_cast<size_t>(length), std::move(name)};
+    }
+
+    const uint8_t *Data() const { return data; }
+    size_t Size() const { return size; }
+    std::span<const uint8_t> Bytes() const { return {data, size}; }
+    std::string_view Text() const { return {reinterpret_cast<const char *>(data), size}; }
+    const std::string &Path() const { return path; }
+
+private:
+    std::shared_ptr<const void> owner;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    std::string path;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <algorithm>
+
+// Accumulator for simulation that must advance in fixed ticks regardless of frame rate. Advance() banks the frame time
+// and returns how many ticks to run; after a long stall at most maxTicksPerFrame run and the rest is dropped, so the
+// simulation slows down instead of spiralling.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(double tickRate, int maxTicksPerFrame = 8)
+        : tickSeconds(1.0 / tickRate), maxTicksPerFrame(maxTicksPerFrame) {
+    }
+
+    int Advance(double frameSeconds) {
+        accumulator += std::max(frameSeconds, 0.0);
+
+        int ticks = static_cast<int>(accumulator / tickSeconds);
+        if (ticks > maxTicksPerFrame) {
+            ticks = maxTicksPerFrame;
+            accumulator = 0.0;
+        } else {
+            accumulator -= ticks * tickSeconds;
+        }
+
+        tick += ticks;
+        return ticks;
+    }
+
+    double TickSeconds() const { return tickSeconds; }
+    float TickSecondsF() const { return static_cast<float>(tickSeconds); }
+    long long Tick() const { return tick; }
+
+    // Fraction of a tick the presented frame is ahead of the last simulated state, for render interpolation
+    float Alpha() const { return static_cast<float>(accumulator / tickSeconds); }
+
+private:
+    double tickSeconds;
+    int maxTicksPerFrame;
+    double accumulator = 0.0;
+    long long tick = 0;
+};
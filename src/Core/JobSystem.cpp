@@ -0,0 +1,153 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <exception>
+
+unsigned JobSystem::DefaultWorkerCount() {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 1;
+}
+
+JobSystem::JobSystem(unsigned workerCount) {
+    for (unsigned i = 0; i < workerCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+}
+
+void JobSystem::Submit(std::function<void()> job, JobCounter *counter) {
+    if (counter) {
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        queue.push_back({std::move(job), counter});
+    }
+
+    wake.notify_one();
+}
+
+void JobSystem::SubmitBackground(std::function<void()> job) {
+    if (workers.empty()) {
+        Job now{std::move(job), nullptr};
+        Run(now);
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        background.push_back({std::move(job), nullptr});
+    }
+
+    wake.notify_one();
+}
+
+bool JobSystem::TryRunOne() {
+    Job job;
+
+    {
+        std::lock_guard lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+
+        job = std::move(queue.front());
+        queue.pop_front();
+    }
+
+    Run(job);
+    return true;
+}
+
+void JobSystem::Run(Job &job) {
+    try {
+        job.fn();
+    } catch (...) {
+        failedJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (job.counter) {
+        job.counter->pending.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void JobSystem::Wait(JobCounter &counter) {
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        if (!TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)> &fn) {
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    if (count <= grainSize || workers.empty()) {
+        if (count > 0) fn(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    for (size_t begin = grainSize; begin < count; begin += grainSize) {
+        size_t end = std::min(begin + grainSize, count);
+
+        Submit([&, begin, end] {
+            try {
+                fn(begin, end);
+            } catch (...) {
+                std::lock_guard lock(errorMutex);
+                if (!error) error = std::current_exception();
+            }
+        }, &counter);
+    }
+
+    // First chunk on the calling thread, then help with the rest
+    try {
+        fn(0, grainSize);
+    } catch (...) {
+        std::lock_guard lock(errorMutex);
+        if (!error) error = std::current_exception();
+    }
+
+    Wait(counter);
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::WorkerLoop() {
+    while (true) {
+        Job job;
+
+        {
+            std::unique_lock lock(mutex);
+            wake.wait(lock, [this] { return stopping || !queue.empty() || !background.empty(); });
+
+            std::deque<Job> &from = !queue.empty() ? queue : background;
+            if (from.empty()) {
+                return;
+            }
+
+            job = std::move(from.front());
+            from.pop_front();
+        }
+
+        Run(job);
+    }
+}
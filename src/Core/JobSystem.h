@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Counts outstanding jobs of one batch. Wait() on it returns once every job submitted against it has run.
+struct JobCounter {
+    std::atomic<int> pending{0};
+};
+
+// Fixed pool of worker threads pulling from one shared queue. Threads that wait on a counter run queued jobs
+// instead of sleeping, so nested ParallelFor calls from inside a job cannot deadlock the pool.
+//
+// Background jobs sit in a second queue that only the workers take from, after the regular one is empty. Wait() never
+// runs them, so a long job (an I/O completion decoding a texture) cannot land on a thread that is only waiting for its
+// own batch, such as the render thread inside a ParallelFor.
+class JobSystem {
+public:
+    // Defaults to one worker per hardware thread, leaving one for the caller
+    explicit JobSystem(unsigned workerCount = DefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    static unsigned DefaultWorkerCount();
+    unsigned WorkerCount() const { return static_cast<unsigned>(workers.size()); }
+
+    void Submit(std::function<void()> job, JobCounter *counter = nullptr);
+    void Wait(JobCounter &counter);
+
+    // Runs job on a worker when no regular job is queued. With no workers it runs on the calling thread.
+    void SubmitBackground(std::function<void()> job);
+
+    // Jobs that threw outside a ParallelFor. They are dropped rather than taking the worker down; their counter is
+    // still released.
+    size_t FailedJobs() const { return failedJobs.load(std::memory_order_relaxed); }
+
+    // Calls fn(begin, end) over [0, count) in chunks of at most grainSize and returns when all chunks are done. The
+    // caller runs chunks too. The first exception thrown by fn is rethrown here after the batch completes.
+    void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)> &fn);
+
+private:
+    struct Job {
+        std::function<void()> fn;
+        JobCounter *counter;
+    };
+
+    bool TryRunOne();
+    void Run(Job &job);
+    void WorkerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<Job> queue;
+    std::deque<Job> background;
+    std::atomic<size_t> failedJobs{0};
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
@@ -0,0 +1,128 @@
+#include "Lz4.h"
+
+#include <cstring>
+
+namespace {
+    constexpr size_t MinMatch = 4;
+    constexpr size_t LastLiterals = 5;        // the block ends with at least this many literals
+    constexpr size_t MatchSearchLimit = 12;   // and no match starts closer than this to the end
+    constexpr size_t MaxOffset = 65535;
+    constexpr int HashBits = 16;
+
+    uint32_t Read32(const uint8_t *p) {
+        uint32_t value;
+        std::memcpy(&value, p, 4);
+        return value;
+    }
+
+    uint32_t Hash(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HashBits);
+    }
+
+    // Lengths past a nibble continue in bytes of 255
+    void WriteLength(std::vector<uint8_t> &out, size_t length) {
+        for (; length >= 255; length -= 255) out.push_back(255);
+        out.push_back(static_cast<uint8_t>(length));
+    }
+
+    void WriteSequence(std::vector<uint8_t> &out, const uint8_t *literals, size_t literalCount, size_t offset, size_t matchLength) {
+        const size_t matchCode = matchLength - MinMatch;
+        out.push_back(static_cast<uint8_t>((literalCount >= 15 ? 15 : literalCount) << 4 | (matchCode >= 15 ? 15 : matchCode)));
+        if (literalCount >= 15) WriteLength(out, literalCount - 15);
+        out.insert(out.end(), literals, literals + literalCount);
+        out.push_back(static_cast<uint8_t>(offset));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15) WriteLength(out, matchCode - 15);
+    }
+
+    bool ReadLength(const uint8_t *&in, const uint8_t *end, size_t &length) {
+        uint8_t byte;
+        do {
+            if (in == end) return false;
+            byte = *in++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+void Lz4Compress(std::span<const uint8_t> input, std::vector<uint8_t> &out) {
+    out.clear();
+    out.reserve(input.size() + input.size() / 255 + 16);
+
+    const uint8_t *src = input.data();
+    const size_t size = input.size();
+    size_t anchor = 0;
+
+    if (size > MatchSearchLimit) {
+        std::vector<uint32_t> table(size_t(1) << HashBits, 0xffffffffu);
+        const size_t limit = size - MatchSearchLimit;
+        size_t i = 0;
+        while (i < limit) {
+            const uint32_t sequence = Read32(src + i);
+            const uint32_t h = Hash(sequence);
+            const uint32_t candidate = table[h];
+            table[h] = static_cast<uint32_t>(i);
+
+            if (candidate == 0xffffffffu || i - candidate > MaxOffset || Read32(src + candidate) != sequence) {
+                // Skip faster through data that is not matching
+                i += 1 + ((i - anchor) >> 6);
+                continue;
+            }
+
+            size_t length = MinMatch;
+            while (i + length < size - LastLiterals && src[candidate + length] == src[i + length]) length++;
+
+            WriteSequence(out, src + anchor, i - anchor, i - candidate, length);
+            i += length;
+            anchor = i;
+            if (i < limit) table[Hash(Read32(src + i - 2))] = static_cast<uint32_t>(i - 2);
+        }
+    }
+
+    // Final literals-only sequence
+    const size_t literalCount = size - anchor;
+    out.push_back(static_cast<uint8_t>((literalCount >= 15 ? 15 : literalCount) << 4));
+    if (literalCount >= 15) WriteLength(out, literalCount - 15);
+    out.insert(out.end(), src + anchor, src + size);
+}
+
+bool Lz4Decompress(std::span<const uint8_t> input, std::span<uint8_t> out) {
+    const uint8_t *in = input.data(), *inEnd = in + input.size();
+    uint8_t *dst = out.data();
+    const uint8_t *dstEnd = dst + out.size();
+
+    while (in < inEnd) {
+        const uint8_t token = *in++;
+
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !ReadLength(in, inEnd, literalCount)) return false;
+        if (literalCount > static_cast<size_t>(inEnd - in) || literalCount > static_cast<size_t>(dstEnd - dst)) return false;
+        std::memcpy(dst, in, literalCount);
+        in += literalCount;
+        dst += literalCount;
+
+        // The last sequence has no match
+        if (in == inEnd) break;
+
+        if (inEnd - in < 2) return false;
+        const size_t offset = static_cast<size_t>(in[0]) | static_cast<size_t>(in[1]) << 8;
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(dst - out.data())) return false;
+
+        size_t length = token & 15;
+        if (length == 15 && !ReadLength(in, inEnd, length)) return false;
+        length += MinMatch;
+        if (length > static_cast<size_t>(dstEnd - dst)) return false;
+
+        // Overlapping copies repeat the last offset bytes, so go byte by byte when they overlap
+        const uint8_t *match = dst - offset;
+        if (offset >= length) {
+            std::memcpy(dst, match, length);
+        } else {
+            for (size_t k = 0; k < length; k++) dst[k] = match[k];
+        }
+        dst += length;
+    }
+    return dst == dstEnd;
+}
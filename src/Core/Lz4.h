@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// LZ4 block format (no frame header): greedy single-probe compressor and a bounds-checked decoder. Fast enough to
+// decompress pack blobs at load time; the output is readable by any LZ4 block decoder.
+
+// Replaces out with the compressed block
+void Lz4Compress(std::span<const uint8_t> input, std::vector<uint8_t> &out);
+
+// Decodes a block that must expand to exactly out.size() bytes; false for corrupt or truncated input
+bool Lz4Decompress(std::span<const uint8_t> input, std::span<uint8_t> out);
@@ -0,0 +1,107 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string &path) {
+#ifdef _WIN32
+    file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        file = nullptr;
+        throw std::runtime_error("Failed to Open File: " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    size = static_cast<size_t>(fileSize.QuadPart);
+    opened = true;
+
+    if (size > 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        data = mapping ? static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+
+        if (!data) {
+            Close();
+            throw std::runtime_error("Failed to Map File: " + path);
+        }
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        throw std::runtime_error("Failed to Open File: " + path);
+    }
+
+    struct stat st{};
+    fstat(fd, &st);
+    size = static_cast<size_t>(st.st_size);
+    opened = true;
+
+    if (size > 0) {
+        void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (view == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Failed to Map File: " + path);
+        }
+
+        data = static_cast<const uint8_t *>(view);
+    }
+
+    // The mapping keeps its own reference to the file
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        Close();
+
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+#ifdef _WIN32
+        file = std::exchange(other.file, nullptr);
+        mapping = std::exchange(other.mapping, nullptr);
+#endif
+    }
+
+    return *this;
+}
+
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+    mapping = nullptr;
+    file = nullptr;
+#else
+    if (data) munmap(const_cast<uint8_t *>(data), size);
+#endif
+
+    data = nullptr;
+    size = 0;
+    opened = false;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Read-only memory mapping of a whole file. The view stays valid for the lifetime of the object.
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const uint8_t *Data() const { return data; }
+    size_t Size() const { return size; }
+    bool IsOpen() const { return opened; }
+
+private:
+    void Close();
+
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool opened = false;
+
+#ifdef _WIN32
+    void *file = nullptr;
+    void *mapping = nullptr;
+#endif
+};
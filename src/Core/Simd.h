@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MILSIM_SSE 1
+#include <emmintrin.h>
+#endif
+
+// Four-lane float vector used by the collision and ballistics kernels. Maps onto SSE where the target has it and onto
+// plain arrays elsewhere, so kernels are written once. Comparisons return all-ones / all-zero lane masks.
+struct Float4 {
+#ifdef MILSIM_SSE
+    __m128 v;
+
+    Float4() = default;
+    Float4(__m128 v) : v(v) {}
+    explicit Float4(float s) : v(_mm_set1_ps(s)) {}
+
+    static Float4 Load(const float *p) { return _mm_loadu_ps(p); }
+    void Store(float *p) const { _mm_storeu_ps(p, v); }
+
+    friend Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+    friend Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+    friend Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+    friend Float4 operator/(Float4 a, Float4 b) { return _mm_div_ps(a.v, b.v); }
+    friend Float4 operator&(Float4 a, Float4 b) { return _mm_and_ps(a.v, b.v); }
+    friend Float4 operator|(Float4 a, Float4 b) { return _mm_or_ps(a.v, b.v); }
+    friend Float4 operator<(Float4 a, Float4 b) { return _mm_cmplt_ps(a.v, b.v); }
+    friend Float4 operator<=(Float4 a, Float4 b) { return _mm_cmple_ps(a.v, b.v); }
+    friend Float4 operator>(Float4 a, Float4 b) { return _mm_cmpgt_ps(a.v, b.v); }
+    friend Float4 operator>=(Float4 a, Float4 b) { return _mm_cmpge_ps(a.v, b.v); }
+
+    friend Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a.v, b.v); }
+    friend Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a.v, b.v); }
+    friend Float4 Sqrt(Float4 a) { return _mm_sqrt_ps(a.v); }
+    friend Float4 Abs(Float4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+    // mask ? a : b
+    friend Float4 Select(Float4 mask, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)); }
+    // One bit per lane, lane 0 in bit 0
+    friend int MoveMask(Float4 mask) { return _mm_movemask_ps(mask.v); }
+#else
+    float v[4];
+
+    Float4() = default;
+    explicit Float4(float s) : v{s, s, s, s} {}
+
+    static Float4 Load(const float *p) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = p[i]; return r; }
+    void Store(float *p) const { for (int i = 0; i < 4; i++) p[i] = v[i]; }
+
+    template<typename Op>
+    static Float4 Map(Float4 a, Float4 b, Op op) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = op(a.v[i], b.v[i]); return r; }
+    static float MaskOf(bool b) { uint32_t bits = b ? 0xffffffffu : 0u; float f; std::memcpy(&f, &bits, 4); return f; }
+    static uint32_t Bits(float f) { uint32_t bits; std::memcpy(&bits, &f, 4); return bits; }
+    static float FromBits(uint32_t bits) { float f; std::memcpy(&f, &bits, 4); return f; }
+
+    friend Float4 operator+(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return x + y; }); }
+    friend Float4 operator-(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return x - y; }); }
+    friend Float4 operator*(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return x * y; }); }
+    friend Float4 operator/(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return x / y; }); }
+    friend Float4 operator&(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return FromBits(Bits(x) & Bits(y)); }); }
+    friend Float4 operator|(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return FromBits(Bits(x) | Bits(y)); }); }
+    friend Float4 operator<(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return MaskOf(x < y); }); }
+    friend Float4 operator<=(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return MaskOf(x <= y); }); }
+    friend Float4 operator>(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return MaskOf(x > y); }); }
+    friend Float4 operator>=(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return MaskOf(x >= y); }); }
+
+    friend Float4 Min(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return y < x ? y : x; }); }
+    friend Float4 Max(Float4 a, Float4 b) { return Map(a, b, [](float x, float y) { return y > x ? y : x; }); }
+    friend Float4 Sqrt(Float4 a) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = std::sqrt(a.v[i]); return r; }
+    friend Float4 Abs(Float4 a) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] < 0.0f ? -a.v[i] : a.v[i]; return r; }
+    friend Float4 Select(Float4 mask, Float4 a, Float4 b) { return (mask & a) | Map(mask, b, [](float m, float y) { return FromBits(~Bits(m) & Bits(y)); }); }
+    friend int MoveMask(Float4 mask) { int r = 0; for (int i = 0; i < 4; i++) r |= int(Bits(mask.v[i]) >> 31) << i; return r; }
+#endif
+};
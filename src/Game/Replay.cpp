@@ -0,0 +1,445 @@
+#include "Replay.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    constexpr size_t FileHeaderSize = 8;
+    constexpr int StanceBits = 2;
+
+    void WriteFloat(BitWriter &out, float value) {
+        out.Write(std::bit_cast<uint32_t>(value), 32);
+    }
+
+    float ReadFloat(BitReader &in) {
+        return std::bit_cast<float>(in.Read(32));
+    }
+
+    void WriteVector(BitWriter &out, const glm::vec3 &v) {
+        for (int i = 0; i < 3; i++) WriteFloat(out, v[i]);
+    }
+
+    glm::vec3 ReadVector(BitReader &in) {
+        glm::vec3 v;
+        for (int i = 0; i < 3; i++) v[i] = ReadFloat(in);
+        return v;
+    }
+
+    bool Finite(const glm::vec3 &v) {
+        return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+    }
+
+    void WriteTick(BitWriter &out, uint64_t tick) {
+        out.Write(static_cast<uint32_t>(tick), 32);
+        out.Write(static_cast<uint32_t>(tick >> 32), 32);
+    }
+
+    uint64_t ReadTick(BitReader &in) {
+        const uint64_t low = in.Read(32);
+        return low | static_cast<uint64_t>(in.Read(32)) << 32;
+    }
+
+    Stance ReadStance(BitReader &in) {
+        return static_cast<Stance>(std::min(in.Read(StanceBits), static_cast<uint32_t>(Stance::Prone)));
+    }
+
+    // A changed bit, then the XOR against before as leading zeros, length and the bits between
+    void WriteChange(BitWriter &out, float before, float after) {
+        const uint32_t x = std::bit_cast<uint32_t>(before) ^ std::bit_cast<uint32_t>(after);
+        out.WriteBool(x != 0);
+        if (x == 0) return;
+
+        const int lead = std::countl_zero(x), trail = std::countr_zero(x), bits = 32 - lead - trail;
+        out.Write(static_cast<uint32_t>(lead), 5);
+        out.Write(static_cast<uint32_t>(bits - 1), 5);
+        out.Write(x >> trail, bits);
+    }
+
+    float ReadChange(BitReader &in, float before) {
+        if (!in.ReadBool()) return before;
+
+        const int lead = static_cast<int>(in.Read(5)), bits = static_cast<int>(in.Read(5)) + 1, trail = 32 - lead - bits;
+        const uint32_t x = in.Read(bits);
+        if (trail < 0) return before;
+        return std::bit_cast<float>(std::bit_cast<uint32_t>(before) ^ (x << trail));
+    }
+
+    void WriteInput(BitWriter &out, const CharacterInput &input) {
+        WriteVector(out, input.move);
+        out.WriteBool(input.jump);
+        out.Write(static_cast<uint32_t>(input.stance), StanceBits);
+    }
+
+    CharacterInput ReadInput(BitReader &in) {
+        CharacterInput input;
+        input.move = ReadVector(in);
+        input.jump = in.ReadBool();
+        input.stance = ReadStance(in);
+        return input;
+    }
+
+    // Every entry takes at least a bit, which bounds what a corrupt count can allocate
+    template <typename T>
+    bool ReadCount(BitReader &in, std::vector<T> &out) {
+        const uint32_t count = in.ReadVarUint();
+        if (in.Overflowed() || count > in.BitsLeft()) return false;
+        out.resize(count);
+        return true;
+    }
+
+    void EncodeKeyframe(const SimulationState &state, BitWriter &out) {
+        WriteTick(out, state.tick);
+
+        out.WriteVarUint(static_cast<uint32_t>(state.players.size()));
+        for (const SimulationState::Player &player: state.players) {
+            out.WriteVarUint(player.id);
+            WriteVector(out, player.character.feet);
+            WriteVector(out, player.character.velocity);
+            out.Write(static_cast<uint32_t>(player.character.stance), StanceBits);
+            out.WriteBool(player.character.grounded);
+            WriteInput(out, player.input);
+            WriteFloat(out, player.aim.x);
+            WriteFloat(out, player.aim.y);
+        }
+
+        out.WriteVarUint(static_cast<uint32_t>(state.rounds.size()));
+        out.Write(state.nextRound, 32);
+        for (const ProjectileSystem::RoundState &round: state.rounds) {
+            WriteVector(out, round.position);
+            WriteVector(out, round.velocity);
+            for (float value: {round.dragScale, round.flightTime, round.mass, round.caliber, round.rewindTicks}) WriteFloat(out, value);
+            out.Write(static_cast<uint32_t>(round.dragModel), 2);
+            out.Write(round.id, 32);
+            out.WriteVarUint(round.owner);
+        }
+
+        // Each entity's poses in tick order, so a moving one costs its small changes from tick to tick
+        out.WriteBool(state.hasHitboxes);
+        if (!state.hasHitboxes) return;
+        WriteTick(out, state.hitboxTick);
+        std::vector<HitboxHistory::RecordedPose> poses = state.hitboxes;
+        std::stable_sort(poses.begin(), poses.end(), [](const auto &a, const auto &b) { return a.entity < b.entity; });
+
+        out.WriteVarUint(static_cast<uint32_t>(poses.size()));
+        const HitboxHistory::RecordedPose *previous = nullptr;
+        for (const HitboxHistory::RecordedPose &pose: poses) {
+            const bool follows = previous && previous->entity == pose.entity;
+            out.WriteBool(follows);
+            if (follows) {
+                out.WriteVarUint(static_cast<uint32_t>(pose.tick - previous->tick));
+                for (int i = 0; i < 3; i++) WriteChange(out, previous->feet[i], pose.feet[i]);
+            } else {
+                out.WriteVarUint(pose.entity);
+                out.WriteVarUint(static_cast<uint32_t>(state.hitboxTick - pose.tick));
+                WriteVector(out, pose.feet);
+            }
+            out.Write(pose.yaw, 16);
+            out.Write(static_cast<uint32_t>(pose.stance), StanceBits);
+            previous = &pose;
+        }
+    }
+
+    bool DecodeKeyframe(BitReader &in, SimulationState &state) {
+        state.tick = ReadTick(in);
+
+        if (!ReadCount(in, state.players)) return false;
+        for (SimulationState::Player &player: state.players) {
+            player.id = in.ReadVarUint();
+            if (player.id >= MaxPlayers) return false;
+            player.character.feet = ReadVector(in);
+            player.character.velocity = ReadVector(in);
+            player.character.stance = ReadStance(in);
+            player.character.grounded = in.ReadBool();
+            player.input = ReadInput(in);
+            player.aim.x = ReadFloat(in);
+            player.aim.y = ReadFloat(in);
+            if (in.Overflowed()) return false;
+            if (!Finite(player.character.feet) || !Finite(player.character.velocity) || !Finite(player.input.move)) return false;
+            if (!std::isfinite(player.aim.x) || !std::isfinite(player.aim.y)) return false;
+        }
+
+        if (!ReadCount(in, state.rounds)) return false;
+        state.nextRound = in.Read(32);
+        for (ProjectileSystem::RoundState &round: state.rounds) {
+            round.position = ReadVector(in);
+            round.velocity = ReadVector(in);
+            for (float *value: {&round.dragScale, &round.flightTime, &round.mass, &round.caliber, &round.rewindTicks}) *value = ReadFloat(in);
+            round.dragModel = in.Read(2) == static_cast<uint32_t>(DragModel::G1) ? DragModel::G1 : DragModel::G7;
+            round.id = in.Read(32);
+            round.owner = in.ReadVarUint();
+            if (in.Overflowed()) return false;
+            // A NaN gets through every clamp downstream and ends up as a history row index
+            if (!Finite(round.position) || !Finite(round.velocity)) return false;
+            for (float value: {round.dragScale, round.flightTime, round.mass, round.caliber, round.rewindTicks}) {
+                if (!std::isfinite(value)) return false;
+            }
+        }
+
+        state.hitboxes.clear();
+        state.hasHitboxes = in.ReadBool();
+        if (!state.hasHitboxes) return !in.Overflowed();
+        state.hitboxTick = ReadTick(in);
+
+        if (!ReadCount(in, state.hitboxes)) return false;
+        for (size_t i = 0; i < state.hitboxes.size(); i++) {
+            HitboxHistory::RecordedPose &pose = state.hitboxes[i];
+            if (in.ReadBool()) {
+                if (i == 0) return false;
+                const HitboxHistory::RecordedPose &previous = state.hitboxes[i - 1];
+                pose.entity = previous.entity;
+                pose.tick = previous.tick + in.ReadVarUint();
+                for (int axis = 0; axis < 3; axis++) pose.feet[axis] = ReadChange(in, previous.feet[axis]);
+            } else {
+                pose.entity = in.ReadVarUint();
+                if (pose.entity >= MaxPlayers) return false;
+                pose.tick = state.hitboxTick - in.ReadVarUint();
+                pose.feet = ReadVector(in);
+            }
+            pose.yaw = static_cast<uint16_t>(in.Read(16));
+            pose.stance = ReadStance(in);
+            if (in.Overflowed()) return false;
+        }
+        return !in.Overflowed();
+    }
+
+    void WriteLength(std::vector<uint8_t> &out, uint64_t value) {
+        do {
+            out.push_back(static_cast<uint8_t>((value & 0x7f) | (value > 0x7f ? 0x80 : 0)));
+            value >>= 7;
+        } while (value);
+    }
+
+    bool ReadLength(std::span<const uint8_t> data, size_t &offset, uint64_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (offset >= data.size()) return false;
+            const uint8_t byte = data[offset++];
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    void WriteU32(std::ofstream &out, uint32_t value) {
+        const uint8_t bytes[4] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value >> 16),
+                                  static_cast<uint8_t>(value >> 24)};
+        out.write(reinterpret_cast<const char *>(bytes), 4);
+    }
+
+    uint32_t ReadU32(const uint8_t *p) {
+        return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+    }
+}
+
+ReplayRecorder::ReplayRecorder(const Simulation &sim, const std::string &path, const ReplaySettings &settings)
+    : sim(sim), settings(settings), path(path), file(path, std::ios::binary) {
+    if (this->settings.keyframeInterval == 0) this->settings.keyframeInterval = 1;
+    WriteU32(file, ReplayFileMagic);
+    WriteU32(file, ReplayFileVersion);
+    if (!file) throw std::runtime_error("Replay Write Failed: " + path);
+    stats.bytes = FileHeaderSize;
+    skipEvents = sim.PendingEvents();
+    WriteKeyframe();
+}
+
+void ReplayRecorder::WriteRecord(bool keyframe) {
+    const std::vector<uint8_t> &payload = writer.Finish();
+    recordHeader.clear();
+    WriteLength(recordHeader, static_cast<uint64_t>(payload.size()) << 1 | (keyframe ? 1 : 0));
+    file.write(reinterpret_cast<const char *>(recordHeader.data()), static_cast<std::streamsize>(recordHeader.size()));
+    file.write(reinterpret_cast<const char *>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    if (!file) throw std::runtime_error("Replay Write Failed: " + path);
+    stats.bytes += recordHeader.size() + payload.size();
+}
+
+void ReplayRecorder::WriteKeyframe() {
+    sim.SaveState(state);
+    held.assign(sim.PlayerSlots(), ReplayHeldInput());
+    for (const SimulationState::Player &player: state.players) held[player.id] = {player.input, player.aim};
+
+    writer.Clear();
+    EncodeKeyframe(state, writer);
+    const size_t before = stats.bytes;
+    WriteRecord(true);
+    stats.keyframes++;
+    stats.keyframeBytes += stats.bytes - before;
+
+    // A crash loses at most one interval
+    file.flush();
+}
+
+void ReplayRecorder::Record() {
+    auto start = std::chrono::steady_clock::now();
+    writer.Clear();
+    if (held.size() < sim.PlayerSlots()) held.resize(sim.PlayerSlots());
+
+    const std::span<const SimEvent> events = std::span(sim.StepEvents()).subspan(std::min(skipEvents, sim.StepEvents().size()));
+    skipEvents = 0;
+    writer.WriteVarUint(static_cast<uint32_t>(events.size()));
+    for (const SimEvent &event: events) {
+        writer.Write(static_cast<uint32_t>(event.type), 2);
+        writer.WriteVarUint(event.player);
+        if (event.type == SimEventType::Leave) continue;
+        WriteVector(writer, event.vector);
+        if (event.type == SimEventType::Fire) WriteFloat(writer, event.rewindTicks);
+        if (event.type == SimEventType::Join) held[event.player] = ReplayHeldInput();
+    }
+
+    // Inputs and aim that differ from what each player held on the previous tick, by id gap
+    uint32_t nextId = 0;
+    for (uint32_t id = 0; id < sim.PlayerSlots(); id++) {
+        if (!sim.IsPlayer(id)) continue;
+        ReplayHeldInput &was = held[id];
+        const CharacterInput &input = sim.Input(id);
+        const glm::vec2 aim = sim.Aim(id);
+        const bool flags = input.jump != was.input.jump || input.stance != was.input.stance;
+        if (!flags && input.move == was.input.move && aim == was.aim) continue;
+
+        writer.WriteBool(true);
+        writer.WriteVarUint(id - nextId);
+        nextId = id + 1;
+        for (int i = 0; i < 3; i++) WriteChange(writer, was.input.move[i], input.move[i]);
+        writer.WriteBool(flags);
+        if (flags) {
+            writer.WriteBool(input.jump);
+            writer.Write(static_cast<uint32_t>(input.stance), StanceBits);
+        }
+        WriteChange(writer, was.aim.x, aim.x);
+        WriteChange(writer, was.aim.y, aim.y);
+        was = {input, aim};
+    }
+    writer.WriteBool(false);
+    WriteRecord(false);
+    stats.ticks++;
+
+    if (sim.Tick() % settings.keyframeInterval == 0) WriteKeyframe();
+    stats.recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+ReplayPlayer::ReplayPlayer(Simulation &sim, const std::string &path) : sim(sim), path(path), file(path) {
+    auto fail = [&path](const std::string &what) {
+        throw std::runtime_error("Invalid Replay File " + path + ": " + what);
+    };
+
+    if (!file.IsOpen() || file.Size() < FileHeaderSize) fail("Truncated Header");
+    if (ReadU32(file.Data()) != ReplayFileMagic) fail("Bad Magic");
+    if (ReadU32(file.Data() + 4) != ReplayFileVersion) fail("Unsupported Version " + std::to_string(ReadU32(file.Data() + 4)));
+
+    // Index every record; keyframes must fall between the ticks they claim
+    const std::span<const uint8_t> data(file.Data(), file.Size());
+    size_t offset = FileHeaderSize;
+    while (offset < data.size()) {
+        uint64_t value;
+        if (!ReadLength(data, offset, value) || (value >> 1) > data.size() - offset) break;
+        const Record record{offset, static_cast<size_t>(value >> 1)};
+        offset += record.size;
+
+        if (value & 1) {
+            BitReader in(Payload(record));
+            const uint64_t tick = ReadTick(in);
+            if (keyframes.empty()) firstTick = tick;
+            if (in.Overflowed() || tick != LastTick()) fail("Keyframe Out of Order");
+            keyframes.push_back({tick, record});
+        } else {
+            if (keyframes.empty()) fail("Missing First Keyframe");
+            tickRecords.push_back(record);
+        }
+    }
+    if (keyframes.empty()) fail("Missing First Keyframe");
+
+    Restore(keyframes.front());
+}
+
+void ReplayPlayer::Restore(const Keyframe &keyframe) {
+    BitReader in(Payload(keyframe.record));
+    if (!DecodeKeyframe(in, state)) throw std::runtime_error("Invalid Replay File " + path + ": Malformed Keyframe");
+
+    sim.RestoreState(state);
+    held.assign(sim.PlayerSlots(), ReplayHeldInput());
+    for (const SimulationState::Player &player: state.players) held[player.id] = {player.input, player.aim};
+}
+
+bool ReplayPlayer::Step() {
+    if (sim.Tick() < firstTick || sim.Tick() >= LastTick()) return false;
+
+    BitReader in(Payload(tickRecords[sim.Tick() - firstTick]));
+    const uint32_t eventCount = in.ReadVarUint();
+    for (uint32_t i = 0; i < eventCount && !in.Overflowed(); i++) {
+        SimEvent event;
+        event.type = static_cast<SimEventType>(in.Read(2));
+        event.player = in.ReadVarUint();
+        if (event.type != SimEventType::Leave) event.vector = ReadVector(in);
+        if (event.type == SimEventType::Fire) event.rewindTicks = ReadFloat(in);
+        if (in.Overflowed() || !Finite(event.vector) || !std::isfinite(event.rewindTicks) || !sim.Apply(event)) {
+            stats.divergences++;
+            continue;
+        }
+        if (event.type == SimEventType::Join) {
+            if (held.size() <= event.player) held.resize(event.player + 1);
+            held[event.player] = ReplayHeldInput();
+            sim.SetInput(event.player, held[event.player].input);
+            sim.SetAim(event.player, held[event.player].aim);
+        }
+    }
+
+    uint32_t nextId = 0;
+    while (in.ReadBool()) {
+        const uint32_t id = nextId + in.ReadVarUint();
+        nextId = id + 1;
+
+        // Only ids the simulation has a player for size the table; anything else is a divergence or a bad file
+        if (in.Overflowed() || !sim.IsPlayer(id)) {
+            stats.divergences++;
+            break;
+        }
+        if (id >= held.size()) held.resize(sim.PlayerSlots());
+        ReplayHeldInput &now = held[id];
+        for (int i = 0; i < 3; i++) now.input.move[i] = ReadChange(in, now.input.move[i]);
+        if (in.ReadBool()) {
+            now.input.jump = in.ReadBool();
+            now.input.stance = ReadStance(in);
+        }
+        now.aim.x = ReadChange(in, now.aim.x);
+        now.aim.y = ReadChange(in, now.aim.y);
+        if (in.Overflowed()) {
+            stats.divergences++;
+            break;
+        }
+        sim.SetInput(id, now.input);
+        sim.SetAim(id, now.aim);
+    }
+
+    sim.Step();
+
+    // Check the re-simulation against the recording wherever it kept a keyframe
+    auto keyframe = std::lower_bound(keyframes.begin(), keyframes.end(), sim.Tick(), [](const Keyframe &k, uint64_t tick) { return k.tick < tick; });
+    if (keyframe != keyframes.end() && keyframe->tick == sim.Tick()) {
+        sim.SaveState(state);
+        writer.Clear();
+        EncodeKeyframe(state, writer);
+        const std::vector<uint8_t> &encoded = writer.Finish();
+        const std::span<const uint8_t> recorded = Payload(keyframe->record);
+        const bool match = encoded.size() == recorded.size() && std::memcmp(encoded.data(), recorded.data(), encoded.size()) == 0;
+        (match ? stats.verified : stats.divergences)++;
+    }
+    return true;
+}
+
+void ReplayPlayer::Seek(uint64_t tick) {
+    auto start = std::chrono::steady_clock::now();
+    tick = std::clamp(tick, firstTick, LastTick());
+
+    // Straight on when the target is ahead of playback and no keyframe closer to it would save ticks
+    auto keyframe = std::upper_bound(keyframes.begin(), keyframes.end(), tick, [](uint64_t t, const Keyframe &k) { return t < k.tick; }) - 1;
+    if (sim.Tick() > tick || sim.Tick() < keyframe->tick) Restore(*keyframe);
+
+    const uint64_t from = sim.Tick();
+    while (sim.Tick() < tick && Step()) {
+    }
+    stats.lastSeekTicks = sim.Tick() - from;
+    stats.lastSeekMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Simulation.h"
+#include "../Core/MappedFile.h"
+#include "../Net/BitStream.h"
+
+constexpr uint32_t ReplayFileMagic = 0x5045524d;  // "MREP"
+constexpr uint32_t ReplayFileVersion = 1;
+
+// What a player holds between ticks, as both ends of a replay track it; a join starts from these defaults
+struct ReplayHeldInput {
+    CharacterInput input;
+    glm::vec2 aim = glm::vec2(-90.0f, 0.0f);
+};
+
+struct ReplaySettings {
+    uint32_t keyframeInterval = 600;          // ticks between keyframes: seeks re-simulate at most this many
+};
+
+// Writes a match to a replay file as it is played, for after-action review. The file is an 8-byte header and a run
+// of records, each a varint of its length and kind followed by a bit-packed payload: one per tick with that tick's
+// joins, leaves, teleports and shots plus every input and aim that changed, and every keyframeInterval ticks (and at
+// the start) a keyframe with the whole SimulationState. Changed floats are stored as the XOR against the previous
+// value, trimmed of its leading and trailing zero bits, so a quiet tick costs two bytes and a keyframe a few bytes
+// per player. Nothing is rounded: replaying the inputs from a keyframe reproduces the match bit for bit.
+class ReplayRecorder {
+public:
+    struct Stats {
+        uint64_t ticks = 0;
+        size_t keyframes = 0;
+        size_t bytes = 0;                     // written so far, header included
+        size_t keyframeBytes = 0;
+        double recordMs = 0.0;                // last Record()
+    };
+
+    // Starts the file with a keyframe of the simulation as it is now. Throws std::runtime_error if it cannot be written.
+    ReplayRecorder(const Simulation &sim, const std::string &path, const ReplaySettings &settings = ReplaySettings());
+
+    // After each Simulation::Step()
+    void Record();
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    void WriteKeyframe();
+    void WriteRecord(bool keyframe);
+
+    const Simulation &sim;
+    ReplaySettings settings;
+    std::string path;
+    std::ofstream file;
+
+    std::vector<ReplayHeldInput> held;        // by player id, as of the last record
+    size_t skipEvents = 0;                    // made before the first keyframe, which already holds them
+
+    SimulationState state;
+    BitWriter writer;
+    std::vector<uint8_t> recordHeader;
+    Stats stats;
+};
+
+// Plays a replay file back into a simulation built over the same world. Seek() restores the nearest keyframe at or
+// before the wanted tick and re-simulates from it, with no rendering and no clock, so playback and seeks run as
+// fast as the simulation steps. Whenever playback reaches a keyframe the re-simulated state is compared with it;
+// GetStats().divergences counts mismatches, which mean the build or the world differs from the one that recorded.
+class ReplayPlayer {
+public:
+    struct Stats {
+        size_t divergences = 0;               // keyframes that did not match, or events that could not be applied
+        size_t verified = 0;                  // keyframes that matched
+        uint64_t lastSeekTicks = 0;           // re-simulated by the last Seek()
+        double lastSeekMs = 0.0;
+    };
+
+    // Maps the file and indexes its records, then restores the first keyframe. Throws std::runtime_error if the
+    // file is not a replay; a record cut short by a crash ends the replay there.
+    ReplayPlayer(Simulation &sim, const std::string &path);
+
+    uint64_t FirstTick() const { return firstTick; }
+    uint64_t LastTick() const { return firstTick + tickRecords.size(); }
+
+    // Plays the recorded tick; false at the end of the replay
+    bool Step();
+
+    // Moves playback to tick (clamped to the replay); forward seeks within a keyframe interval just step
+    void Seek(uint64_t tick);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Record {
+        size_t offset;
+        size_t size;
+    };
+
+    struct Keyframe {
+        uint64_t tick;
+        Record record;
+    };
+
+    std::span<const uint8_t> Payload(const Record &record) const { return {file.Data() + record.offset, record.size}; }
+    void Restore(const Keyframe &keyframe);
+
+    Simulation &sim;
+    std::string path;
+    MappedFile file;
+    uint64_t firstTick = 0;
+    std::vector<Record> tickRecords;          // tick firstTick + i
+    std::vector<Keyframe> keyframes;          // in tick order
+
+    std::vector<ReplayHeldInput> held;
+
+    SimulationState state;
+    BitWriter writer;
+    Stats stats;
+};
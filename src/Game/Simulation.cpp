@@ -0,0 +1,281 @@
+#include "Simulation.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../Asset/Vfs.h"
+
+namespace {
+    Heightfield LoadTerrain() {
+        try {
+            FileData file = AssetFiles().Read("terrain/heightmap.r16");
+            return Heightfield::FromRaw16(file.Bytes(), 800.0f, 0.0f, file.Path());
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << ", Generating Terrain\n";
+            return Heightfield::Generate(2048, 1337, 300.0f);
+        }
+    }
+
+    glm::mat4 BoxTransform(const glm::vec3 &center, const glm::vec3 &size) {
+        return glm::scale(glm::translate(glm::mat4(1.0f), center), size);
+    }
+
+    // The room levels/room.json describes, for running from a tree where it has not been compiled
+    LevelContents BuiltInRoom() {
+        LevelContents room;
+        room.meshes.push_back({std::string(LevelBoxMesh)});
+        room.objects.push_back({BoxTransform(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(10.0f, 0.1f, 10.0f)), 0, MaterialConcrete});
+        room.objects.push_back({BoxTransform(glm::vec3(-5.0f, 1.5f, 0.0f), glm::vec3(0.1f, 3.0f, 10.0f)), 0, MaterialWood});
+        room.objects.push_back({BoxTransform(glm::vec3(5.0f, 1.5f, 0.0f), glm::vec3(0.1f, 3.0f, 10.0f)), 0, MaterialWood});
+        room.objects.push_back({BoxTransform(glm::vec3(0.0f, 4.0f, 0.0f), glm::vec3(10.0f, 0.1f, 10.0f)), 0, MaterialConcrete});
+        return room;
+    }
+
+    bool Finite(const glm::vec3 &v) {
+        return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+    }
+
+    // Everything RestoreState() hands on, checked up front so a bad state throws before the simulation changes
+    void CheckState(const SimulationState &state) {
+        auto fail = [](const std::string &what) { throw std::runtime_error("Invalid Simulation State: " + what); };
+
+        std::vector<bool> seen(MaxPlayers, false);
+        for (const SimulationState::Player &player: state.players) {
+            if (player.id >= MaxPlayers || seen[player.id]) fail("Player Id " + std::to_string(player.id));
+            seen[player.id] = true;
+            const CharacterState &character = player.character;
+            if (!Finite(character.feet) || !Finite(character.velocity) || !Finite(player.input.move) ||
+                !std::isfinite(player.aim.x) || !std::isfinite(player.aim.y)) {
+                fail("Player " + std::to_string(player.id) + " Not Finite");
+            }
+            if (character.stance > Stance::Prone || player.input.stance > Stance::Prone) fail("Player " + std::to_string(player.id) + " Stance");
+        }
+
+        for (const ProjectileSystem::RoundState &round: state.rounds) {
+            bool finite = Finite(round.position) && Finite(round.velocity);
+            for (float value: {round.dragScale, round.flightTime, round.mass, round.caliber, round.rewindTicks}) finite = finite && std::isfinite(value);
+            if (!finite) fail("Round " + std::to_string(round.id) + " Not Finite");
+            if (round.dragModel != DragModel::G1 && round.dragModel != DragModel::G7) fail("Round " + std::to_string(round.id) + " Drag Model");
+        }
+
+        if (!state.hasHitboxes) return;
+        for (const HitboxHistory::RecordedPose &pose: state.hitboxes) {
+            if (pose.entity >= MaxPlayers) fail("Hitbox Entity " + std::to_string(pose.entity));
+            if (pose.tick > state.hitboxTick) fail("Hitbox Tick " + std::to_string(pose.tick));
+            if (!Finite(pose.feet)) fail("Hitbox " + std::to_string(pose.entity) + " Not Finite");
+            if (pose.stance > Stance::Prone) fail("Hitbox " + std::to_string(pose.entity) + " Stance");
+        }
+    }
+
+    LevelFile LoadLevel() {
+        try {
+            return LevelFile(AssetFiles().Read("levels/room.mlvl"));
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << ", Using the Built-in Room\n";
+            return LevelFile(FileData::Own(BuildLevelFile(BuiltInRoom()), "built-in room"));
+        }
+    }
+}
+
+glm::vec3 AimDirection(const glm::vec2 &yawPitch) {
+    const float yaw = glm::radians(yawPitch.x), pitch = glm::radians(yawPitch.y);
+    return glm::vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch));
+}
+
+Simulation::Simulation(JobSystem *jobs) : jobs(jobs), heightfield(LoadTerrain()), level(LoadLevel()), hitboxes(static_cast<size_t>(TickRate)) {
+    // Line the terrain up with the room floor at the origin
+    heightfield.SetHeightBase(heightfield.HeightBase() - 1.0f - heightfield.HeightAt(0.0f, 0.0f));
+
+    // Boulders scattered around the room; the LOD chain is built once here, the client selects levels per frame
+    rockMesh = GenerateRock(5, 3);
+    std::vector<glm::vec3> rockPositions;
+    std::vector<float> rockAttributes;
+    for (const TexturedVertex &v: rockMesh.vertices) {
+        rockPositions.push_back(v.pos);
+        rockAttributes.insert(rockAttributes.end(), {v.uv.x, v.uv.y});
+    }
+    SimplifyInput rockInput{rockPositions.data(), rockPositions.size(), rockAttributes.data(), 2};
+    rockChain = BuildLodChain(rockInput, rockMesh.indices, 6, 0.4f);
+
+    for (int i = 0; i < 400; i++) {
+        float angle = static_cast<float>(i) * 2.39996f;
+        float radius = 12.0f + std::sqrt(static_cast<float>(i)) * 25.0f;
+        float x = std::cos(angle) * radius, z = std::sin(angle) * radius;
+        rocks.push_back({{x, heightfield.HeightAt(x, z), z}, 0.5f + static_cast<float>(i % 7) * 0.4f});
+    }
+
+    // Collision world: the level's colliding objects as the client draws them, rocks at a coarse LOD. Boxes collide
+    // exactly; cooked meshes are not loaded on the server, so they stand in as their local bounds under the transform.
+    for (uint32_t i = 0; i < level.ObjectCount(); i++) {
+        const LevelObjectInfo &info = level.ObjectInfo()[i];
+        if (!(info.flags & LevelObjectCollides)) continue;
+
+        const uint32_t mesh = level.MeshRefs()[i];
+        glm::mat4 transform = ToMat4(level.Transforms()[i]);
+        if (!level.IsBox(mesh)) {
+            const LevelMeshRecord &record = level.Meshes()[mesh];
+            const glm::vec3 lo(record.boundsMin[0], record.boundsMin[1], record.boundsMin[2]);
+            const glm::vec3 hi(record.boundsMax[0], record.boundsMax[1], record.boundsMax[2]);
+            transform = transform * BoxTransform((lo + hi) * 0.5f, glm::max(hi - lo, glm::vec3(0.01f)));
+        }
+        geometry.AddBox(transform, info.material);
+    }
+
+    const LodLevel &rockCollision = rockChain.levels[std::min<size_t>(3, rockChain.levels.size() - 1)];
+    for (const RockInstance &rock: rocks) {
+        geometry.AddMesh(rockPositions, std::span(rockChain.indices).subspan(rockCollision.firstIndex, rockCollision.indexCount),
+                         BoxTransform(rock.position, glm::vec3(rock.scale)), MaterialRock);
+    }
+    world = std::make_unique<StaticBvh>(geometry);
+
+    projectiles = std::make_unique<ProjectileSystem>(*world, &heightfield, MaterialSoil);
+    projectiles->SetTargets(&hitboxes);
+
+    // Navmesh for AI over the 128 m around the room
+    NavMeshSettings navSettings;
+    navSettings.boundsMin = glm::vec3(-64.0f, -100.0f, -64.0f);
+    navSettings.boundsMax = glm::vec3(64.0f, 100.0f, 64.0f);
+    navMesh = std::make_unique<NavMesh>(BuildNavMesh(*world, &heightfield, navSettings, jobs));
+    navGraph = std::make_unique<NavHierarchy>(*navMesh, 512.0f, jobs);
+    paths = std::make_unique<PathQueue>(*navGraph, jobs);
+}
+
+// Lowest id without a player, which the next AddPlayer() takes
+uint32_t Simulation::FreeSlot() const {
+    uint32_t id = 0;
+    while (id < players.size() && players[id].controller) id++;
+    return id;
+}
+
+uint32_t Simulation::AddPlayer(const glm::vec3 &feet) {
+    const uint32_t id = FreeSlot();
+    if (id >= MaxPlayers) throw std::runtime_error("Too Many Players: " + std::to_string(MaxPlayers));
+    if (id == players.size()) players.emplace_back();
+
+    players[id].controller = std::make_unique<CharacterController>(*world, &heightfield);
+    players[id].controller->Teleport(feet);
+    players[id].input = CharacterInput();
+    players[id].aim = glm::vec2(-90.0f, 0.0f);
+    stats.players++;
+    events.push_back({SimEventType::Join, id, feet});
+    return id;
+}
+
+void Simulation::RemovePlayer(uint32_t player) {
+    if (!IsPlayer(player)) return;
+    players[player].controller.reset();
+    hitboxes.Forget(player);
+    stats.players--;
+    events.push_back({SimEventType::Leave, player});
+}
+
+void Simulation::Teleport(uint32_t player, const glm::vec3 &feet) {
+    players[player].controller->Teleport(feet);
+    events.push_back({SimEventType::Teleport, player, feet});
+}
+
+glm::vec3 Simulation::SpawnPoint(uint32_t n) const {
+    // Rows of eight a metre and a half apart, filling the room from the back wall
+    const float x = static_cast<float>(n % 8) * 1.2f - 4.2f, z = 4.5f - static_cast<float>((n / 8) % 7) * 1.5f;
+    return glm::vec3(x, -0.95f, z);
+}
+
+void Simulation::SetAim(uint32_t player, const glm::vec2 &yawPitch) {
+    players[player].aim = glm::vec2(std::fmod(yawPitch.x, 360.0f), glm::clamp(yawPitch.y, -89.0f, 89.0f));
+}
+
+uint32_t Simulation::Fire(uint32_t player, const glm::vec3 &direction, float rewindTicks) {
+    ProjectileDesc round;
+    round.position = players[player].controller->EyePosition();
+    round.velocity = glm::normalize(direction) * 930.0f;
+    round.owner = player;
+    round.rewindTicks = std::isfinite(rewindTicks) ? std::clamp(rewindTicks, 0.0f, static_cast<float>(hitboxes.Ticks() - 1)) : 0.0f;
+    events.push_back({SimEventType::Fire, player, direction, rewindTicks});
+    return projectiles->Spawn(round);
+}
+
+bool Simulation::Apply(const SimEvent &event) {
+    // A join must land on the id it had, or it would add a player the recording never had
+    const bool known = event.type == SimEventType::Join ? event.player < MaxPlayers && FreeSlot() == event.player : IsPlayer(event.player);
+    if (!known) return false;
+
+    switch (event.type) {
+        case SimEventType::Join: AddPlayer(event.vector); break;
+        case SimEventType::Leave: RemovePlayer(event.player); break;
+        case SimEventType::Teleport: Teleport(event.player, event.vector); break;
+        case SimEventType::Fire: Fire(event.player, event.vector, event.rewindTicks); break;
+    }
+    return true;
+}
+
+void Simulation::SaveState(SimulationState &out) const {
+    out.tick = tick;
+    out.players.clear();
+    for (uint32_t id = 0; id < players.size(); id++) {
+        if (IsPlayer(id)) out.players.push_back({id, players[id].controller->GetState(), players[id].input, players[id].aim});
+    }
+    projectiles->SaveRounds(out.rounds);
+    out.nextRound = projectiles->NextId();
+    out.hasHitboxes = !hitboxes.Empty();
+    out.hitboxTick = hitboxes.NewestTick();
+    hitboxes.Save(out.hitboxes);
+}
+
+void Simulation::RestoreState(const SimulationState &state) {
+    CheckState(state);
+
+    // Controllers are made aside, so nothing has changed yet if one fails
+    std::vector<PlayerSlot> restored(players.size());
+    for (const SimulationState::Player &player: state.players) {
+        if (player.id >= restored.size()) restored.resize(player.id + 1);
+        PlayerSlot &slot = restored[player.id];
+        slot.controller = std::make_unique<CharacterController>(*world, &heightfield);
+        slot.controller->SetState(player.character);
+        slot.input = player.input;
+        slot.aim = player.aim;
+    }
+
+    players.swap(restored);
+    stats.players = state.players.size();
+    projectiles->RestoreRounds(state.rounds, state.nextRound);
+    if (state.hasHitboxes) {
+        hitboxes.Restore(state.hitboxTick, state.hitboxes);
+    } else {
+        hitboxes.Clear();
+    }
+
+    tick = state.tick;
+    stats.tick = tick;
+    events.clear();
+    stepEvents.clear();
+}
+
+void Simulation::Step(float dt) {
+    auto start = std::chrono::steady_clock::now();
+    stepEvents.swap(events);
+    events.clear();
+
+    for (PlayerSlot &player: players) {
+        if (player.controller) player.controller->Step(player.input, dt);
+    }
+
+    // Poses as of the end of this tick, which is what the next snapshot shows; rounds fired now are checked from here
+    hitboxes.BeginTick(tick + 1);
+    for (uint32_t id = 0; id < players.size(); id++) {
+        const CharacterController *controller = players[id].controller.get();
+        if (controller) hitboxes.Record(id, controller->Position(), players[id].aim.x, controller->GetStance());
+    }
+    projectiles->Step(dt, jobs);
+
+    // Path requests are solved with a 1 ms budget per tick
+    paths->Update(1.0);
+
+    tick++;
+    stats.tick = tick;
+    stats.lastStepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+#include "../Geometry/MeshSimplifier.h"
+#include "../Geometry/Primitives.h"
+#include "../Navigation/NavMeshBuilder.h"
+#include "../Navigation/PathQueue.h"
+#include "../Physics/CharacterController.h"
+#include "../Physics/HitboxHistory.h"
+#include "../Physics/ProjectileSystem.h"
+#include "../Physics/StaticBvh.h"
+#include "../Terrain/Heightfield.h"
+#include "../World/LevelFormat.h"
+
+// Boulder placed in the scene; the client draws it with the rock LOD chain, the collision world holds a coarse level
+struct RockInstance {
+    glm::vec3 position;
+    float scale;
+};
+
+// Player ids are below this. Restored states and replayed joins carrying a higher id are rejected rather than sizing
+// the player table from untrusted input.
+constexpr uint32_t MaxPlayers = 1024;
+
+// What callers do to the simulation besides holding inputs and aim; the order between ticks matters
+enum class SimEventType : uint8_t {
+    Join,
+    Leave,
+    Teleport,
+    Fire,
+};
+
+struct SimEvent {
+    SimEventType type;
+    uint32_t player;
+    glm::vec3 vector = glm::vec3(0.0f);       // feet for Join and Teleport, direction for Fire
+    float rewindTicks = 0.0f;                 // Fire
+};
+
+// Everything Step() carries from one tick to the next, for replay keyframes
+struct SimulationState {
+    struct Player {
+        uint32_t id;
+        CharacterState character;
+        CharacterInput input;
+        glm::vec2 aim;
+    };
+
+    uint64_t tick = 0;
+    std::vector<Player> players;
+    std::vector<ProjectileSystem::RoundState> rounds;
+    uint32_t nextRound = 0;
+    bool hasHitboxes = false;
+    uint64_t hitboxTick = 0;
+    std::vector<HitboxHistory::RecordedPose> hitboxes;
+};
+
+// Unit view direction for yaw and pitch in degrees; yaw -90 looks down -z
+glm::vec3 AimDirection(const glm::vec2 &yawPitch);
+
+// Everything that has to agree between the game client and the dedicated server: terrain, the static collision
+// world, players' characters, rounds in flight and AI navigation. Nothing here touches SDL or GL, so MilsimServer
+// builds from the same sources as the client minus Render/. Step() advances one fixed tick; callers own the clock.
+class Simulation {
+public:
+    static constexpr double TickRate = 60.0;
+
+    struct Stats {
+        size_t players = 0;
+        uint64_t tick = 0;
+        double lastStepMs = 0.0;
+    };
+
+    // Loads terrain/heightmap.r16 or generates terrain when it is missing, and levels/room.mlvl or falls back to the
+    // built-in room, then builds collision and navigation
+    explicit Simulation(JobSystem *jobs = nullptr);
+
+    // Returns the player's id; ids of removed players are reused. Throws std::runtime_error with MaxPlayers in the game.
+    uint32_t AddPlayer(const glm::vec3 &feet);
+    void RemovePlayer(uint32_t player);
+    bool IsPlayer(uint32_t player) const { return player < players.size() && players[player].controller; }
+
+    // Somewhere clear on the room floor for the n-th player to join
+    glm::vec3 SpawnPoint(uint32_t n) const;
+
+    // Puts the player somewhere else outright, e.g. a respawn
+    void Teleport(uint32_t player, const glm::vec3 &feet);
+
+    // Held until changed, applied on every following tick
+    void SetInput(uint32_t player, const CharacterInput &input) { players[player].input = input; }
+    const CharacterInput &Input(uint32_t player) const { return players[player].input; }
+
+    // View angles in degrees (yaw, pitch); pitch is clamped to +-89
+    void SetAim(uint32_t player, const glm::vec2 &yawPitch);
+    glm::vec2 Aim(uint32_t player) const { return players[player].aim; }
+
+    // Fires a rifle round from the player's eye; direction need not be unit length. rewindTicks is how far behind the
+    // server the shooter's view of other players was; it is capped at the hitbox history (one second).
+    uint32_t Fire(uint32_t player, const glm::vec3 &direction, float rewindTicks = 0.0f);
+
+    void Step(float dt = static_cast<float>(1.0 / TickRate));
+
+    // Joins, leaves, teleports and shots made before the last Step(), in call order. With every player's held input
+    // and aim they are all a tick depends on; Apply() repeats one, and false means the world has diverged (a join
+    // would land on another id, and is not made). SaveState() and RestoreState() cover what carries over between ticks,
+    // so a restored simulation stepped with the same inputs and events reproduces the original bit for bit.
+    // RestoreState() throws std::runtime_error, leaving the simulation untouched, if a player id or hitbox entity is
+    // MaxPlayers or more, a player id appears twice, or a position, velocity or round field is not finite.
+    const std::vector<SimEvent> &StepEvents() const { return stepEvents; }
+    size_t PendingEvents() const { return events.size(); }
+    bool Apply(const SimEvent &event);
+    void SaveState(SimulationState &out) const;
+    void RestoreState(const SimulationState &state);
+
+    const CharacterController &Player(uint32_t player) const { return *players[player].controller; }
+    size_t PlayerSlots() const { return players.size(); }
+
+    const Heightfield &Terrain() const { return heightfield; }
+    const LevelFile &Level() const { return level; }
+    const StaticBvh &World() const { return *world; }
+    const ProjectileSystem &Projectiles() const { return *projectiles; }
+    const HitboxHistory &Hitboxes() const { return hitboxes; }
+    PathQueue &Paths() { return *paths; }
+
+    const std::vector<RockInstance> &Rocks() const { return rocks; }
+    const TexturedMesh &RockMesh() const { return rockMesh; }
+    const LodChain &RockChain() const { return rockChain; }
+
+    uint64_t Tick() const { return tick; }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct PlayerSlot {
+        std::unique_ptr<CharacterController> controller;
+        CharacterInput input;
+        glm::vec2 aim = glm::vec2(-90.0f, 0.0f);
+    };
+
+    uint32_t FreeSlot() const;
+
+    JobSystem *jobs;
+    Heightfield heightfield;
+    LevelFile level;
+
+    TexturedMesh rockMesh;
+    LodChain rockChain;
+    std::vector<RockInstance> rocks;
+
+    StaticGeometry geometry;
+    std::unique_ptr<StaticBvh> world;
+    std::unique_ptr<ProjectileSystem> projectiles;
+    HitboxHistory hitboxes;                   // every player's pose for the last second, for lag-compensated hits
+
+    std::unique_ptr<NavMesh> navMesh;
+    std::unique_ptr<NavHierarchy> navGraph;
+    std::unique_ptr<PathQueue> paths;
+
+    std::vector<PlayerSlot> players;
+    uint64_t tick = 0;
+    std::vector<SimEvent> events;             // since the last Step()
+    std::vector<SimEvent> stepEvents;
+
+    Stats stats;
+};
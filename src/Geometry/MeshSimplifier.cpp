@@ -0,0 +1,337 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <unordered_map>
+
+namespace {
+    // Symmetric 4x4 quadric stored as its 10 unique coefficients, plus the accumulated area weight
+    struct Quadric {
+        double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+        double weight = 0;
+
+        static Quadric FromPlane(const glm::dvec3 &n, double d, double weight) {
+            Quadric q;
+            q.a2 = n.x * n.x * weight;
+            q.ab = n.x * n.y * weight;
+            q.ac = n.x * n.z * weight;
+            q.ad = n.x * d * weight;
+            q.b2 = n.y * n.y * weight;
+            q.bc = n.y * n.z * weight;
+            q.bd = n.y * d * weight;
+            q.c2 = n.z * n.z * weight;
+            q.cd = n.z * d * weight;
+            q.d2 = d * d * weight;
+            q.weight = weight;
+            return q;
+        }
+
+        Quadric &operator+=(const Quadric &o) {
+            a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad; b2 += o.b2;
+            bc += o.bc; bd += o.bd; c2 += o.c2; cd += o.cd; d2 += o.d2;
+            weight += o.weight;
+            return *this;
+        }
+
+        double Evaluate(const glm::vec3 &p) const {
+            double x = p.x, y = p.y, z = p.z;
+            double e = a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x + b2 * y * y + 2 * bc * y * z +
+                       2 * bd * y + c2 * z * z + 2 * cd * z + d2;
+            return std::max(e, 0.0);
+        }
+    };
+
+    struct Collapse {
+        double cost;
+        uint32_t from, to;
+        uint32_t fromVersion, toVersion;
+
+        bool operator>(const Collapse &o) const { return cost > o.cost; }
+    };
+
+    struct PositionHash {
+        size_t operator()(const glm::vec3 &p) const {
+            const auto *u = reinterpret_cast<const uint32_t *>(&p);
+            return (u[0] * 73856093u) ^ (u[1] * 19349663u) ^ (u[2] * 83492791u);
+        }
+    };
+
+    glm::dvec3 TriangleNormal(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c) {
+        return glm::cross(glm::dvec3(b - a), glm::dvec3(c - a));
+    }
+}
+
+SimplifyResult SimplifyMesh(const SimplifyInput &input, const std::vector<uint32_t> &indices, size_t targetTriangles,
+                            float maxError) {
+    const glm::vec3 *positions = input.positions;
+    const size_t triangleCount = indices.size() / 3;
+
+    // Weld by position: every vertex maps to a topological vertex ("position class")
+    std::unordered_map<glm::vec3, uint32_t, PositionHash> classOf;
+    std::vector<uint32_t> vertexClass(input.vertexCount);
+    std::vector<uint32_t> classVertex;                      // a representative vertex for the class position
+    std::vector<std::vector<uint32_t>> classMembers;
+
+    for (uint32_t v = 0; v < input.vertexCount; v++) {
+        auto [it, inserted] = classOf.try_emplace(positions[v], static_cast<uint32_t>(classVertex.size()));
+
+        if (inserted) {
+            classVertex.push_back(v);
+            classMembers.emplace_back();
+        }
+
+        vertexClass[v] = it->second;
+        classMembers[it->second].push_back(v);
+    }
+
+    const size_t classCount = classVertex.size();
+
+    // Triangle corners keep their original vertex; corners[] is rewritten as collapses re-point them
+    std::vector<uint32_t> corners(indices);
+    std::vector<uint32_t> triClass(indices.size());
+    std::vector<bool> triAlive(triangleCount, true);
+    std::vector<std::vector<uint32_t>> classTris(classCount);
+    std::vector<Quadric> quadrics(classCount);
+
+    for (uint32_t t = 0; t < triangleCount; t++) {
+        for (int k = 0; k < 3; k++) {
+            triClass[t * 3 + k] = vertexClass[indices[t * 3 + k]];
+            classTris[triClass[t * 3 + k]].push_back(t);
+        }
+
+        const glm::vec3 &p0 = positions[indices[t * 3]];
+        glm::dvec3 n = TriangleNormal(p0, positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]]);
+        double area = glm::length(n);
+
+        if (area <= 0.0) {
+            continue;
+        }
+
+        n /= area;
+        Quadric q = Quadric::FromPlane(n, -glm::dot(n, glm::dvec3(p0)), area * 0.5);
+
+        for (int k = 0; k < 3; k++) {
+            quadrics[triClass[t * 3 + k]] += q;
+        }
+    }
+
+    // Border edges (used by one triangle) get a heavily weighted plane perpendicular to the face so the outline
+    // survives simplification
+    std::unordered_map<uint64_t, int> edgeUse;
+    auto edgeKey = [](uint32_t a, uint32_t b) { return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b); };
+
+    for (size_t c = 0; c < triClass.size(); c += 3) {
+        for (int k = 0; k < 3; k++) {
+            edgeUse[edgeKey(triClass[c + k], triClass[c + (k + 1) % 3])]++;
+        }
+    }
+
+    for (uint32_t t = 0; t < triangleCount; t++) {
+        const uint32_t *tc = &triClass[t * 3];
+        glm::dvec3 faceNormal = TriangleNormal(positions[classVertex[tc[0]]], positions[classVertex[tc[1]]],
+                                               positions[classVertex[tc[2]]]);
+
+        for (int k = 0; k < 3; k++) {
+            uint32_t a = tc[k], b = tc[(k + 1) % 3];
+
+            if (edgeUse[edgeKey(a, b)] != 1) {
+                continue;
+            }
+
+            glm::dvec3 pa(positions[classVertex[a]]), pb(positions[classVertex[b]]);
+            glm::dvec3 edge = pb - pa;
+            glm::dvec3 n = glm::cross(edge, faceNormal);
+            double length = glm::length(n);
+
+            if (length <= 0.0) {
+                continue;
+            }
+
+            n /= length;
+            Quadric q = Quadric::FromPlane(n, -glm::dot(n, pa), glm::dot(edge, edge) * 10.0);
+            quadrics[a] += q;
+            quadrics[b] += q;
+        }
+    }
+
+    std::vector<uint32_t> version(classCount, 0);
+    std::vector<bool> classAlive(classCount, true);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> heap;
+
+    auto collapseCost = [&](uint32_t from, uint32_t to) {
+        Quadric q = quadrics[from];
+        q += quadrics[to];
+        return q.Evaluate(positions[classVertex[to]]) / std::max(q.weight, 1e-12);
+    };
+
+    auto pushEdge = [&](uint32_t a, uint32_t b) {
+        heap.push({collapseCost(a, b), a, b, version[a], version[b]});
+        heap.push({collapseCost(b, a), b, a, version[b], version[a]});
+    };
+
+    for (const auto &[key, uses]: edgeUse) {
+        pushEdge(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xffffffffu));
+    }
+
+    size_t aliveTriangles = triangleCount;
+    double worstError = 0.0;
+    const double maxCost = static_cast<double>(maxError) * maxError;
+
+    while (aliveTriangles > targetTriangles && !heap.empty()) {
+        Collapse c = heap.top();
+        heap.pop();
+
+        if (!classAlive[c.from] || !classAlive[c.to] || version[c.from] != c.fromVersion || version[c.to] != c.toVersion) {
+            continue;
+        }
+
+        if (c.cost > maxCost) {
+            break;
+        }
+
+        // A seam vertex may only slide along the seam, otherwise one side loses its matching attributes
+        if (input.attributeCount > 0 && classMembers[c.from].size() > 1 && classMembers[c.to].size() < 2) {
+            continue;
+        }
+
+        // Reject collapses that would flip or badly squash a surviving triangle
+        const glm::vec3 &target = positions[classVertex[c.to]];
+        bool valid = true;
+
+        for (uint32_t t: classTris[c.from]) {
+            if (!triAlive[t]) {
+                continue;
+            }
+
+            const uint32_t *tc = &triClass[t * 3];
+            if (tc[0] == c.to || tc[1] == c.to || tc[2] == c.to) {
+                continue;
+            }
+
+            glm::vec3 p[3], moved[3];
+            for (int k = 0; k < 3; k++) {
+                p[k] = positions[classVertex[tc[k]]];
+                moved[k] = tc[k] == c.from ? target : p[k];
+            }
+
+            glm::dvec3 before = TriangleNormal(p[0], p[1], p[2]);
+            glm::dvec3 after = TriangleNormal(moved[0], moved[1], moved[2]);
+            double lengths = glm::length(before) * glm::length(after);
+
+            if (lengths <= 0.0 || glm::dot(before, after) < 0.2 * lengths) {
+                valid = false;
+                break;
+            }
+        }
+
+        if (!valid) {
+            continue;
+        }
+
+        worstError = std::max(worstError, c.cost);
+
+        for (uint32_t t: classTris[c.from]) {
+            if (!triAlive[t]) {
+                continue;
+            }
+
+            uint32_t *tc = &triClass[t * 3];
+
+            if (tc[0] == c.to || tc[1] == c.to || tc[2] == c.to) {
+                triAlive[t] = false;
+                aliveTriangles--;
+                continue;
+            }
+
+            for (int k = 0; k < 3; k++) {
+                if (tc[k] != c.from) {
+                    continue;
+                }
+
+                // Re-point the corner to the surviving vertex with the closest attributes
+                uint32_t original = corners[t * 3 + k];
+                uint32_t best = classVertex[c.to];
+                float bestDistance = INFINITY;
+
+                for (uint32_t candidate: classMembers[c.to]) {
+                    float distance = 0.0f;
+
+                    for (int a = 0; a < input.attributeCount; a++) {
+                        float d = input.attributes[candidate * input.attributeCount + a] -
+                                  input.attributes[original * input.attributeCount + a];
+                        distance += d * d;
+                    }
+
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        best = candidate;
+                    }
+                }
+
+                tc[k] = c.to;
+                corners[t * 3 + k] = best;
+            }
+
+            classTris[c.to].push_back(t);
+        }
+
+        quadrics[c.to] += quadrics[c.from];
+        classAlive[c.from] = false;
+        classTris[c.from].clear();
+        version[c.to]++;
+
+        // Re-queue every edge around the merged vertex with its new quadric
+        std::vector<uint32_t> &tris = classTris[c.to];
+        tris.erase(std::remove_if(tris.begin(), tris.end(), [&](uint32_t t) { return !triAlive[t]; }), tris.end());
+
+        for (uint32_t t: tris) {
+            for (int k = 0; k < 3; k++) {
+                uint32_t other = triClass[t * 3 + k];
+
+                if (other != c.to) {
+                    pushEdge(c.to, other);
+                }
+            }
+        }
+    }
+
+    SimplifyResult result;
+    result.indices.reserve(aliveTriangles * 3);
+    result.error = static_cast<float>(std::sqrt(worstError));
+
+    for (uint32_t t = 0; t < triangleCount; t++) {
+        if (triAlive[t]) {
+            result.indices.insert(result.indices.end(), &corners[t * 3], &corners[t * 3] + 3);
+        }
+    }
+
+    return result;
+}
+
+LodChain BuildLodChain(const SimplifyInput &input, const std::vector<uint32_t> &indices, int maxLevels,
+                       float reduction, float maxError) {
+    LodChain chain;
+    chain.indices = indices;
+    chain.levels.push_back({0, static_cast<uint32_t>(indices.size()), 0.0f});
+
+    std::vector<uint32_t> previous = indices;
+    float error = 0.0f;
+
+    for (int level = 1; level < maxLevels; level++) {
+        size_t target = static_cast<size_t>(static_cast<float>(previous.size() / 3) * reduction);
+        SimplifyResult result = SimplifyMesh(input, previous, target, maxError);
+
+        // Not worth a level if it barely reduced anything
+        if (result.indices.empty() || result.indices.size() > previous.size() * 0.85f) {
+            break;
+        }
+
+        error = std::max(error, result.error);
+        chain.levels.push_back({static_cast<uint32_t>(chain.indices.size()), static_cast<uint32_t>(result.indices.size()), error});
+        chain.indices.insert(chain.indices.end(), result.indices.begin(), result.indices.end());
+        previous = std::move(result.indices);
+    }
+
+    return chain;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Quadric error metric simplification (Garland & Heckbert 1997) by half-edge collapse.
+//
+// Vertices never move: a collapse merges one vertex into a neighbour, so every LOD indexes the same vertex buffer
+// and only the index buffer differs per level. Vertices that share a position (UV or normal seams) are simplified as
+// one topological vertex; when a corner is re-pointed, the vertex of the surviving position whose attributes are
+// closest to the corner's original attributes is picked, which keeps seams intact.
+struct SimplifyInput {
+    const glm::vec3 *positions = nullptr;
+    size_t vertexCount = 0;
+
+    // Optional per-vertex attributes (e.g. uv and normal), attributeCount floats per vertex, used for seam matching.
+    const float *attributes = nullptr;
+    int attributeCount = 0;
+};
+
+struct SimplifyResult {
+    std::vector<uint32_t> indices;
+    float error = 0.0f;                       // RMS distance of the worst collapse, in model units
+};
+
+SimplifyResult SimplifyMesh(const SimplifyInput &input, const std::vector<uint32_t> &indices, size_t targetTriangles,
+                            float maxError);
+
+struct LodLevel {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    float error;                              // geometric error relative to LOD0, in model units
+};
+
+struct LodChain {
+    std::vector<uint32_t> indices;            // all levels back to back, LOD0 first
+    std::vector<LodLevel> levels;
+};
+
+// Builds up to maxLevels levels, each targeting `reduction` times the triangles of the previous one. Stops early
+// when a level can no longer be reduced meaningfully or would exceed maxError.
+LodChain BuildLodChain(const SimplifyInput &input, const std::vector<uint32_t> &indices, int maxLevels = 5,
+                       float reduction = 0.5f, float maxError = INFINITY);
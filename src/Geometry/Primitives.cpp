@@ -0,0 +1,107 @@
+#include "Primitives.h"
+
+#include <cmath>
+#include <map>
+#include <utility>
+
+TexturedMesh GenerateIcosphere(int subdivisions) {
+    const float t = (1.0f + std::sqrt(5.0f)) * 0.5f;
+
+    std::vector<glm::vec3> points = {
+        {-1, t, 0}, {1, t, 0}, {-1, -t, 0}, {1, -t, 0},
+        {0, -1, t}, {0, 1, t}, {0, -1, -t}, {0, 1, -t},
+        {t, 0, -1}, {t, 0, 1}, {-t, 0, -1}, {-t, 0, 1}
+    };
+    std::vector<uint32_t> faces = {
+        0, 11, 5, 0, 5, 1, 0, 1, 7, 0, 7, 10, 0, 10, 11,
+        1, 5, 9, 5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1, 8,
+        3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9,
+        4, 9, 5, 2, 4, 11, 6, 2, 10, 8, 6, 7, 9, 8, 1
+    };
+
+    for (glm::vec3 &p: points) {
+        p = glm::normalize(p);
+    }
+
+    for (int s = 0; s < subdivisions; s++) {
+        std::map<std::pair<uint32_t, uint32_t>, uint32_t> midpoints;
+        std::vector<uint32_t> next;
+        next.reserve(faces.size() * 4);
+
+        auto midpoint = [&](uint32_t a, uint32_t b) {
+            auto key = std::minmax(a, b);
+            auto it = midpoints.find(key);
+
+            if (it != midpoints.end()) {
+                return it->second;
+            }
+
+            points.push_back(glm::normalize(points[a] + points[b]));
+            return midpoints[key] = static_cast<uint32_t>(points.size() - 1);
+        };
+
+        for (size_t f = 0; f < faces.size(); f += 3) {
+            uint32_t a = faces[f], b = faces[f + 1], c = faces[f + 2];
+            uint32_t ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+            next.insert(next.end(), {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca});
+        }
+
+        faces = std::move(next);
+    }
+
+    TexturedMesh mesh;
+    mesh.vertices.reserve(points.size());
+
+    for (const glm::vec3 &p: points) {
+        float u = 0.5f + std::atan2(p.z, p.x) / (2.0f * 3.14159265f);
+        float v = 0.5f + std::asin(p.y) / 3.14159265f;
+        mesh.vertices.push_back({p, {u, v}});
+    }
+
+    // Triangles straddling the u wrap get a duplicated vertex with u + 1
+    std::map<uint32_t, uint32_t> wrapped;
+
+    for (size_t f = 0; f < faces.size(); f += 3) {
+        float u[3];
+        for (int k = 0; k < 3; k++) {
+            u[k] = mesh.vertices[faces[f + k]].uv.x;
+        }
+
+        for (int k = 0; k < 3; k++) {
+            if (u[k] < 0.25f && (u[(k + 1) % 3] > 0.75f || u[(k + 2) % 3] > 0.75f)) {
+                uint32_t original = faces[f + k];
+                auto it = wrapped.find(original);
+
+                if (it == wrapped.end()) {
+                    TexturedVertex copy = mesh.vertices[original];
+                    copy.uv.x += 1.0f;
+                    mesh.vertices.push_back(copy);
+                    it = wrapped.emplace(original, static_cast<uint32_t>(mesh.vertices.size() - 1)).first;
+                }
+
+                faces[f + k] = it->second;
+            }
+        }
+    }
+
+    mesh.indices = std::move(faces);
+    return mesh;
+}
+
+TexturedMesh GenerateRock(int subdivisions, uint32_t seed) {
+    TexturedMesh mesh = GenerateIcosphere(subdivisions);
+
+    auto bump = [seed](const glm::vec3 &p, float frequency) {
+        float s = static_cast<float>(seed % 1000) * 0.37f;
+        return std::sin(p.x * frequency + s) * std::sin(p.y * frequency * 1.3f + s * 0.7f) *
+               std::sin(p.z * frequency * 0.8f + s * 1.9f);
+    };
+
+    for (TexturedVertex &v: mesh.vertices) {
+        glm::vec3 n = v.pos;
+        float r = 1.0f + 0.25f * bump(n, 2.0f) + 0.1f * bump(n, 5.0f) + 0.04f * bump(n, 13.0f);
+        v.pos = n * r * glm::vec3(1.0f, 0.7f, 1.0f);
+    }
+
+    return mesh;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// Position + texcoord vertex, the same layout as cubeVertices in main.cpp
+struct TexturedVertex {
+    glm::vec3 pos;
+    glm::vec2 uv;
+};
+
+struct TexturedMesh {
+    std::vector<TexturedVertex> vertices;
+    std::vector<uint32_t> indices;
+};
+
+// Subdivided icosahedron with spherical UVs (the seam column is duplicated)
+TexturedMesh GenerateIcosphere(int subdivisions);
+
+// Icosphere displaced by layered noise; a cheap stand-in for scanned rock/boulder assets
+TexturedMesh GenerateRock(int subdivisions, uint32_t seed);
@@ -0,0 +1,255 @@
+#include "NavHierarchy.h"
+
+#include "NavQuery.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+
+namespace {
+    struct Candidate {
+        uint32_t poly, across;
+        uint32_t clusterB;
+        glm::vec3 mid;
+    };
+
+    struct IntraEdge {
+        uint32_t node;
+        float cost;
+        std::vector<uint32_t> corridor;
+    };
+
+    uint32_t Find(std::vector<uint32_t> &parent, uint32_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    }
+}
+
+NavHierarchy::NavHierarchy(const NavMesh &mesh, float clusterSize, JobSystem *jobs)
+    : mesh(mesh), clusterTiles(std::max(1, static_cast<int>(std::lround(clusterSize / mesh.TileSize())))) {
+    auto start = std::chrono::steady_clock::now();
+
+    const std::vector<NavPoly> &polys = mesh.Polys();
+    const std::vector<NavLink> &links = mesh.Links();
+    const std::vector<NavTile> &tiles = mesh.Tiles();
+
+    clustersX = (mesh.TilesX() + clusterTiles - 1) / clusterTiles;
+    clustersZ = (mesh.TilesZ() + clusterTiles - 1) / clusterTiles;
+    const size_t clusterCount = static_cast<size_t>(clustersX) * clustersZ;
+
+    // Polygons grouped by cluster with a counting sort
+    polyCluster.resize(polys.size());
+    polyLocal.resize(polys.size());
+    clusterFirstPoly.assign(clusterCount + 1, 0);
+    for (size_t p = 0; p < polys.size(); p++) {
+        const NavTile &tile = tiles[polys[p].tile];
+        polyCluster[p] = static_cast<uint32_t>((tile.z / clusterTiles) * clustersX + tile.x / clusterTiles);
+        clusterFirstPoly[polyCluster[p] + 1]++;
+    }
+    std::partial_sum(clusterFirstPoly.begin(), clusterFirstPoly.end(), clusterFirstPoly.begin());
+
+    clusterPolys.resize(polys.size());
+    std::vector<uint32_t> fill(clusterFirstPoly.begin(), clusterFirstPoly.end() - 1);
+    for (size_t p = 0; p < polys.size(); p++) {
+        uint32_t c = polyCluster[p];
+        polyLocal[p] = fill[c] - clusterFirstPoly[c];
+        clusterPolys[fill[c]++] = static_cast<uint32_t>(p);
+    }
+
+    polyComponent.resize(polys.size());
+    std::iota(polyComponent.begin(), polyComponent.end(), 0u);
+    for (size_t p = 0; p < polys.size(); p++) {
+        for (uint32_t l = polys[p].firstLink; l < polys[p].firstLink + polys[p].linkCount; l++) {
+            polyComponent[Find(polyComponent, static_cast<uint32_t>(p))] = Find(polyComponent, links[l].poly);
+        }
+    }
+    for (size_t p = 0; p < polys.size(); p++) polyComponent[p] = Find(polyComponent, static_cast<uint32_t>(p));
+
+    // Entrances: polygons of cluster A linked to cluster B (A < B), joined while they are linked to each other
+    std::vector<Candidate> candidates;
+    std::unordered_map<uint64_t, uint32_t> candidateOf;   // (poly, clusterB) -> first candidate
+    auto key = [](uint32_t poly, uint32_t cluster) { return (static_cast<uint64_t>(poly) << 32) | cluster; };
+
+    for (size_t p = 0; p < polys.size(); p++) {
+        const NavPoly &poly = polys[p];
+        for (uint32_t l = poly.firstLink; l < poly.firstLink + poly.linkCount; l++) {
+            const NavLink &link = links[l];
+            uint32_t clusterB = polyCluster[link.poly];
+            if (clusterB <= polyCluster[p]) continue;
+
+            candidateOf.emplace(key(static_cast<uint32_t>(p), clusterB), static_cast<uint32_t>(candidates.size()));
+            candidates.push_back({static_cast<uint32_t>(p), link.poly, clusterB, (link.left + link.right) * 0.5f});
+        }
+    }
+
+    std::vector<uint32_t> groupOf(candidates.size());
+    std::iota(groupOf.begin(), groupOf.end(), 0u);
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const NavPoly &poly = polys[candidates[i].poly];
+        for (uint32_t l = poly.firstLink; l < poly.firstLink + poly.linkCount; l++) {
+            auto found = candidateOf.find(key(links[l].poly, candidates[i].clusterB));
+            if (found != candidateOf.end()) groupOf[Find(groupOf, static_cast<uint32_t>(i))] = Find(groupOf, found->second);
+        }
+    }
+
+    std::unordered_map<uint32_t, std::vector<uint32_t>> groups;
+    for (size_t i = 0; i < candidates.size(); i++) groups[Find(groupOf, static_cast<uint32_t>(i))].push_back(static_cast<uint32_t>(i));
+
+    // Wide entrances get a node pair every third of a cluster, so open ground does not funnel every path through the
+    // middle of the cluster side
+    const float maxEntranceWidth = static_cast<float>(clusterTiles) * mesh.TileSize() / 3.0f;
+    std::vector<int32_t> polyNode(polys.size(), -1);
+    std::vector<uint32_t> nodePolys;
+    std::vector<std::pair<uint32_t, uint32_t>> crossings;   // node polygon pairs, one per entrance
+
+    auto nodeFor = [&](uint32_t poly) {
+        if (polyNode[poly] < 0) {
+            polyNode[poly] = static_cast<int32_t>(nodePolys.size());
+            nodePolys.push_back(poly);
+        }
+        return poly;
+    };
+
+    std::vector<uint32_t> groupRoots;
+    for (const auto &group: groups) groupRoots.push_back(group.first);
+    std::sort(groupRoots.begin(), groupRoots.end());
+
+    for (uint32_t root: groupRoots) {
+        std::vector<uint32_t> &members = groups[root];
+        const Candidate &first = candidates[members.front()];
+        const NavTile &tileA = tiles[polys[first.poly].tile], &tileB = tiles[polys[first.across].tile];
+        const int along = tileA.x / clusterTiles != tileB.x / clusterTiles ? 2 : 0;
+
+        std::sort(members.begin(), members.end(), [&](uint32_t a, uint32_t b) { return candidates[a].mid[along] < candidates[b].mid[along]; });
+
+        for (size_t begin = 0; begin < members.size();) {
+            size_t end = begin + 1;
+            const float runStart = candidates[members[begin]].mid[along];
+            while (end < members.size() && candidates[members[end]].mid[along] - runStart <= maxEntranceWidth) end++;
+
+            const float middle = (runStart + candidates[members[end - 1]].mid[along]) * 0.5f;
+            size_t best = begin;
+            for (size_t m = begin; m < end; m++) {
+                if (std::abs(candidates[members[m]].mid[along] - middle) < std::abs(candidates[members[best]].mid[along] - middle)) best = m;
+            }
+
+            const Candidate &entrance = candidates[members[best]];
+            crossings.emplace_back(nodeFor(entrance.poly), nodeFor(entrance.across));
+            begin = end;
+        }
+    }
+
+    // Nodes grouped by cluster
+    std::sort(nodePolys.begin(), nodePolys.end(), [&](uint32_t a, uint32_t b) {
+        return polyCluster[a] != polyCluster[b] ? polyCluster[a] < polyCluster[b] : a < b;
+    });
+    clusterFirstNode.assign(clusterCount + 1, 0);
+    nodes.resize(nodePolys.size());
+    for (size_t n = 0; n < nodePolys.size(); n++) {
+        nodes[n] = {nodePolys[n], polyCluster[nodePolys[n]], 0, 0};
+        polyNode[nodePolys[n]] = static_cast<int32_t>(n);
+        clusterFirstNode[polyCluster[nodePolys[n]] + 1]++;
+    }
+    std::partial_sum(clusterFirstNode.begin(), clusterFirstNode.end(), clusterFirstNode.begin());
+
+    std::vector<std::vector<IntraEdge>> nodeEdges(nodes.size());
+    std::sort(crossings.begin(), crossings.end());
+    crossings.erase(std::unique(crossings.begin(), crossings.end()), crossings.end());
+    for (const auto &[a, b]: crossings) {
+        float cost = glm::length(polys[a].center - polys[b].center);
+        nodeEdges[polyNode[a]].push_back({static_cast<uint32_t>(polyNode[b]), cost, {}});
+        nodeEdges[polyNode[b]].push_back({static_cast<uint32_t>(polyNode[a]), cost, {}});
+    }
+
+    // Intra-cluster edges: Dijkstra from every node over its own cluster's polygons, one cluster per job
+    auto connectClusters = [&](size_t begin, size_t end) {
+        std::vector<float> cost;
+        std::vector<uint32_t> parent;
+        using Entry = std::pair<float, uint32_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open;
+        std::vector<glm::vec3> corners;
+
+        for (size_t c = begin; c < end; c++) {
+            const uint32_t *local = clusterPolys.data() + clusterFirstPoly[c];
+            const uint32_t localCount = clusterFirstPoly[c + 1] - clusterFirstPoly[c];
+
+            for (uint32_t n = clusterFirstNode[c]; n < clusterFirstNode[c + 1]; n++) {
+                cost.assign(localCount, INFINITY);
+                parent.assign(localCount, 0xffffffffu);
+                const uint32_t source = polyLocal[nodes[n].poly];
+                cost[source] = 0.0f;
+                open.push({0.0f, source});
+
+                while (!open.empty()) {
+                    auto [g, i] = open.top();
+                    open.pop();
+                    if (g > cost[i]) continue;
+
+                    const NavPoly &poly = polys[local[i]];
+                    for (uint32_t l = poly.firstLink; l < poly.firstLink + poly.linkCount; l++) {
+                        uint32_t next = links[l].poly;
+                        if (polyCluster[next] != c) continue;
+
+                        uint32_t j = polyLocal[next];
+                        float candidate = g + glm::length(polys[next].center - poly.center);
+                        if (candidate < cost[j]) {
+                            cost[j] = candidate;
+                            parent[j] = i;
+                            open.push({candidate, j});
+                        }
+                    }
+                }
+
+                for (uint32_t m = clusterFirstNode[c]; m < clusterFirstNode[c + 1]; m++) {
+                    uint32_t target = polyLocal[nodes[m].poly];
+                    if (m == n || cost[target] == INFINITY) continue;
+
+                    IntraEdge edge{m, cost[target], {}};
+                    for (uint32_t i = target; i != 0xffffffffu; i = parent[i]) edge.corridor.push_back(local[i]);
+                    std::reverse(edge.corridor.begin(), edge.corridor.end());
+
+                    // Cost is the string-pulled walk rather than the centre to centre chain, which overestimates
+                    // across large polygons and would leave the abstract A* heuristic loose
+                    corners.clear();
+                    StringPull(mesh, edge.corridor, polys[nodes[n].poly].center, polys[nodes[m].poly].center, corners);
+                    edge.cost = 0.0f;
+                    for (size_t k = 1; k < corners.size(); k++) edge.cost += glm::length(corners[k] - corners[k - 1]);
+                    nodeEdges[n].push_back(std::move(edge));
+                }
+            }
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(clusterCount, 4, connectClusters);
+    } else {
+        connectClusters(0, clusterCount);
+    }
+
+    for (size_t n = 0; n < nodes.size(); n++) {
+        nodes[n].firstEdge = static_cast<uint32_t>(edges.size());
+        nodes[n].edgeCount = static_cast<uint32_t>(nodeEdges[n].size());
+        for (IntraEdge &edge: nodeEdges[n]) {
+            edges.push_back({edge.node, edge.cost, static_cast<uint32_t>(corridors.size()), static_cast<uint32_t>(edge.corridor.size())});
+            corridors.insert(corridors.end(), edge.corridor.begin(), edge.corridor.end());
+        }
+    }
+
+    stats.clusters = clusterCount;
+    stats.nodes = nodes.size();
+    stats.edges = edges.size();
+    stats.corridorPolys = corridors.size();
+    stats.buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+const uint32_t *NavHierarchy::ClusterPolys(uint32_t cluster, uint32_t &count) const {
+    count = clusterFirstPoly[cluster + 1] - clusterFirstPoly[cluster];
+    return clusterPolys.data() + clusterFirstPoly[cluster];
+}
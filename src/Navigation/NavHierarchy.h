@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "NavMesh.h"
+#include "../Core/JobSystem.h"
+
+// Abstract graph over a NavMesh for hierarchical pathfinding (HPA*). Tiles are grouped into square clusters. Where
+// two clusters touch, runs of linked polygons form entrances, each contributing a node on either side. Nodes of the
+// same cluster are joined by edges whose cost and polygon corridor come from a search restricted to that cluster, so
+// a long query only searches the small abstract graph plus the start and goal clusters.
+class NavHierarchy {
+public:
+    struct Node {
+        uint32_t poly;
+        uint32_t cluster;
+        uint32_t firstEdge, edgeCount;
+    };
+
+    // Between clusters corridorLength is 0 and the corridor is just the two node polygons
+    struct Edge {
+        uint32_t node;
+        float cost;
+        uint32_t firstCorridor, corridorLength;
+    };
+
+    struct Stats {
+        size_t clusters = 0;
+        size_t nodes = 0;
+        size_t edges = 0;
+        size_t corridorPolys = 0;
+        double buildMs = 0.0;
+    };
+
+    // clusterSize: cluster edge in world units, rounded to whole tiles
+    NavHierarchy(const NavMesh &mesh, float clusterSize = 512.0f, JobSystem *jobs = nullptr);
+
+    const NavMesh &Mesh() const { return mesh; }
+    uint32_t ClusterOf(uint32_t poly) const { return polyCluster[poly]; }
+    size_t ClusterCount() const { return clusterFirstNode.size() - 1; }
+
+    // Polygons in different components (islands) have no path between them
+    uint32_t ComponentOf(uint32_t poly) const { return polyComponent[poly]; }
+
+    const std::vector<Node> &Nodes() const { return nodes; }
+    const std::vector<Edge> &Edges() const { return edges; }
+    const std::vector<uint32_t> &Corridors() const { return corridors; }
+
+    // Nodes of cluster c are [ClusterFirstNode(c), ClusterFirstNode(c + 1))
+    uint32_t ClusterFirstNode(uint32_t cluster) const { return clusterFirstNode[cluster]; }
+
+    // Polygons of cluster c, and a polygon's index within its cluster's list
+    const uint32_t *ClusterPolys(uint32_t cluster, uint32_t &count) const;
+    uint32_t LocalIndex(uint32_t poly) const { return polyLocal[poly]; }
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    const NavMesh &mesh;
+    int clusterTiles;
+    int clustersX = 0, clustersZ = 0;
+
+    std::vector<uint32_t> polyCluster;
+    std::vector<uint32_t> polyComponent;
+    std::vector<uint32_t> polyLocal;
+    std::vector<uint32_t> clusterPolys;       // grouped by cluster
+    std::vector<uint32_t> clusterFirstPoly;   // clusters + 1
+
+    std::vector<Node> nodes;                  // grouped by cluster
+    std::vector<uint32_t> clusterFirstNode;   // clusters + 1
+    std::vector<Edge> edges;
+    std::vector<uint32_t> corridors;
+
+    Stats stats;
+};
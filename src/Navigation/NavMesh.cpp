@@ -0,0 +1,220 @@
+#include "NavMesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr int SideX[4] = {-1, 0, 1, 0};
+    constexpr int SideZ[4] = {0, 1, 0, -1};
+
+    float Cross2D(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c) {
+        return (b.x - a.x) * (c.z - a.z) - (b.z - a.z) * (c.x - a.x);
+    }
+
+    glm::vec3 ClosestOnSegmentXZ(const glm::vec3 &p, const glm::vec3 &a, const glm::vec3 &b) {
+        glm::vec2 ab(b.x - a.x, b.z - a.z), ap(p.x - a.x, p.z - a.z);
+        float length2 = glm::dot(ab, ab);
+        float t = length2 > 0.0f ? std::clamp(glm::dot(ap, ab) / length2, 0.0f, 1.0f) : 0.0f;
+        return a + (b - a) * t;
+    }
+
+    // Portal ends ordered so that left is on the left of someone leaving center through the edge (seen from above,
+    // -z forward, +x right), which makes Cross2D(center, left, right) positive
+    NavLink MakeLink(uint32_t target, const glm::vec3 &center, const glm::vec3 &a, const glm::vec3 &b) {
+        return Cross2D(center, a, b) > 0.0f ? NavLink{target, a, b} : NavLink{target, b, a};
+    }
+}
+
+NavMesh::NavMesh(const glm::vec3 &origin, float tileSize, int tilesX, int tilesZ, float climb)
+    : origin(origin), tileSize(tileSize), tilesX(tilesX), tilesZ(tilesZ), climb(climb),
+      tileGrid(static_cast<size_t>(tilesX) * tilesZ, -1) {
+}
+
+void NavMesh::AddTile(const NavTileData &data) {
+    if (data.x < 0 || data.z < 0 || data.x >= tilesX || data.z >= tilesZ) {
+        throw std::runtime_error("Nav Tile Outside the Mesh: " + std::to_string(data.x) + ", " + std::to_string(data.z));
+    }
+
+    NavTile tile;
+    tile.x = data.x;
+    tile.z = data.z;
+    tile.firstPoly = static_cast<uint32_t>(polys.size());
+    tile.polyCount = static_cast<uint32_t>(data.polys.size());
+
+    const auto tileIndex = static_cast<uint32_t>(tiles.size());
+    const auto firstVertex = static_cast<uint32_t>(vertices.size());
+    vertices.insert(vertices.end(), data.vertices.begin(), data.vertices.end());
+
+    for (const NavTileData::Poly &source: data.polys) {
+        NavPoly poly;
+        poly.vertexCount = static_cast<uint16_t>(source.vertexCount);
+        poly.tile = tileIndex;
+
+        for (int i = 0; i < MaxPolyVertices; i++) {
+            poly.vertices[i] = i < source.vertexCount ? firstVertex + source.vertices[i] : 0;
+            edgeNeighbours.push_back(i < source.vertexCount ? source.neighbour[i] : -1);
+            if (i < source.vertexCount) poly.center += data.vertices[source.vertices[i]];
+        }
+
+        poly.center /= static_cast<float>(std::max(source.vertexCount, 1));
+        polys.push_back(poly);
+    }
+
+    tileGrid[static_cast<size_t>(data.z) * tilesX + data.x] = static_cast<int>(tileIndex);
+    tiles.push_back(tile);
+}
+
+void NavMesh::ConnectTiles() {
+    links.clear();
+
+    for (const NavTile &tile: tiles) {
+        for (uint32_t p = tile.firstPoly; p < tile.firstPoly + tile.polyCount; p++) {
+            NavPoly &poly = polys[p];
+            poly.firstLink = static_cast<uint32_t>(links.size());
+
+            for (int i = 0; i < poly.vertexCount; i++) {
+                int32_t code = edgeNeighbours[static_cast<size_t>(p) * MaxPolyVertices + i];
+                const glm::vec3 &a = vertices[poly.vertices[i]];
+                const glm::vec3 &b = vertices[poly.vertices[(i + 1) % poly.vertexCount]];
+
+                if (code >= 0 && code < NavTileData::BorderEdge) {
+                    links.push_back(MakeLink(tile.firstPoly + static_cast<uint32_t>(code), poly.center, a, b));
+                    continue;
+                }
+
+                if (code < NavTileData::BorderEdge) continue;
+
+                // Border edge: link to every edge of the neighbouring tile that lies on the same line and overlaps
+                int side = code - NavTileData::BorderEdge;
+                int neighbourTile = TileAt(tile.x + SideX[side], tile.z + SideZ[side]);
+                if (neighbourTile < 0) continue;
+
+                const int along = side == 0 || side == 2 ? 2 : 0;   // the axis the border runs along
+                const int opposite = (side + 2) % 4;
+                const NavTile &other = tiles[neighbourTile];
+                float a0 = std::min(a[along], b[along]), a1 = std::max(a[along], b[along]);
+
+                for (uint32_t q = other.firstPoly; q < other.firstPoly + other.polyCount; q++) {
+                    const NavPoly &candidate = polys[q];
+
+                    for (int j = 0; j < candidate.vertexCount; j++) {
+                        if (edgeNeighbours[static_cast<size_t>(q) * MaxPolyVertices + j] != NavTileData::BorderEdge + opposite) continue;
+
+                        const glm::vec3 &c = vertices[candidate.vertices[j]];
+                        const glm::vec3 &d = vertices[candidate.vertices[(j + 1) % candidate.vertexCount]];
+                        float lo = std::max(a0, std::min(c[along], d[along]));
+                        float hi = std::min(a1, std::max(c[along], d[along]));
+                        if (hi - lo < 0.01f) continue;
+
+                        // Heights of both edges at the overlap ends must agree within the climb
+                        auto heightAt = [&](const glm::vec3 &e0, const glm::vec3 &e1, float s) {
+                            float span = e1[along] - e0[along];
+                            float t = std::abs(span) > 1e-6f ? (s - e0[along]) / span : 0.0f;
+                            return e0.y + (e1.y - e0.y) * std::clamp(t, 0.0f, 1.0f);
+                        };
+                        float yLo = heightAt(a, b, lo), yHi = heightAt(a, b, hi);
+                        if (std::abs(yLo - heightAt(c, d, lo)) > climb || std::abs(yHi - heightAt(c, d, hi)) > climb) continue;
+
+                        glm::vec3 portalLo = a, portalHi = a;
+                        portalLo[along] = lo;
+                        portalLo.y = yLo;
+                        portalHi[along] = hi;
+                        portalHi.y = yHi;
+                        links.push_back(MakeLink(q, poly.center, portalLo, portalHi));
+                    }
+                }
+            }
+
+            poly.linkCount = static_cast<uint16_t>(links.size() - poly.firstLink);
+        }
+    }
+
+    stats.tiles = tiles.size();
+    stats.polys = polys.size();
+    stats.vertices = vertices.size();
+    stats.links = links.size();
+}
+
+int NavMesh::TileAt(int x, int z) const {
+    if (x < 0 || z < 0 || x >= tilesX || z >= tilesZ) return -1;
+    return tileGrid[static_cast<size_t>(z) * tilesX + x];
+}
+
+int NavMesh::TileOf(const glm::vec3 &point) const {
+    return TileAt(static_cast<int>(std::floor((point.x - origin.x) / tileSize)),
+                  static_cast<int>(std::floor((point.z - origin.z) / tileSize)));
+}
+
+glm::vec3 NavMesh::ClosestPointOnPoly(uint32_t index, const glm::vec3 &point) const {
+    const NavPoly &poly = polys[index];
+    const int n = poly.vertexCount;
+
+    // Inside in plan view: interpolate the height over the triangle fan
+    bool inside = true;
+    float winding = 0.0f;
+    for (int i = 0; i < n && inside; i++) {
+        float side = Cross2D(vertices[poly.vertices[i]], vertices[poly.vertices[(i + 1) % n]], point);
+        if (winding == 0.0f) winding = side;
+        inside = side * winding >= 0.0f;
+    }
+
+    if (inside) {
+        const glm::vec3 &v0 = vertices[poly.vertices[0]];
+        for (int i = 1; i + 1 < n; i++) {
+            const glm::vec3 &v1 = vertices[poly.vertices[i]], &v2 = vertices[poly.vertices[i + 1]];
+            float area = Cross2D(v0, v1, v2);
+            if (std::abs(area) < 1e-9f) continue;
+
+            float u = Cross2D(point, v1, v2) / area, v = Cross2D(v0, point, v2) / area, w = 1.0f - u - v;
+            if (u >= -1e-4f && v >= -1e-4f && w >= -1e-4f) {
+                return glm::vec3(point.x, v0.y * u + v1.y * v + v2.y * w, point.z);
+            }
+        }
+    }
+
+    glm::vec3 best = vertices[poly.vertices[0]];
+    float bestDistance = INFINITY;
+    for (int i = 0; i < n; i++) {
+        glm::vec3 candidate = ClosestOnSegmentXZ(point, vertices[poly.vertices[i]], vertices[poly.vertices[(i + 1) % n]]);
+        float distance = glm::length(glm::vec2(candidate.x - point.x, candidate.z - point.z));
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+uint32_t NavMesh::FindNearestPoly(const glm::vec3 &point, const glm::vec3 &extents, glm::vec3 *nearest) const {
+    int x0 = static_cast<int>(std::floor((point.x - extents.x - origin.x) / tileSize));
+    int x1 = static_cast<int>(std::floor((point.x + extents.x - origin.x) / tileSize));
+    int z0 = static_cast<int>(std::floor((point.z - extents.z - origin.z) / tileSize));
+    int z1 = static_cast<int>(std::floor((point.z + extents.z - origin.z) / tileSize));
+
+    uint32_t best = InvalidPoly;
+    float bestDistance = INFINITY;
+
+    for (int z = z0; z <= z1; z++) {
+        for (int x = x0; x <= x1; x++) {
+            int t = TileAt(x, z);
+            if (t < 0) continue;
+
+            for (uint32_t p = tiles[t].firstPoly; p < tiles[t].firstPoly + tiles[t].polyCount; p++) {
+                glm::vec3 closest = ClosestPointOnPoly(p, point);
+                glm::vec3 d = glm::abs(closest - point);
+                if (d.x > extents.x || d.y > extents.y || d.z > extents.z) continue;
+
+                float distance = glm::dot(closest - point, closest - point);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                    if (nearest) *nearest = closest;
+                }
+            }
+        }
+    }
+
+    return best;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+constexpr uint32_t InvalidPoly = 0xffffffffu;
+constexpr int MaxPolyVertices = 6;
+
+// Convex walkable polygon; vertices index NavMesh::Vertices()
+struct NavPoly {
+    uint32_t vertices[MaxPolyVertices];
+    uint32_t firstLink = 0;
+    uint16_t vertexCount = 0;
+    uint16_t linkCount = 0;
+    uint32_t tile = 0;
+    glm::vec3 center = glm::vec3(0.0f);
+};
+
+// Connection from one polygon to a neighbour through the part of an edge they share. left and right are the
+// portal ends as seen when walking out of the owning polygon.
+struct NavLink {
+    uint32_t poly;
+    glm::vec3 left, right;
+};
+
+struct NavTile {
+    int x = 0, z = 0;
+    uint32_t firstPoly = 0, polyCount = 0;
+};
+
+// Polygon output of one tile as the builder produces it, with tile-local indices
+struct NavTileData {
+    struct Poly {
+        uint32_t vertices[MaxPolyVertices];
+        int32_t neighbour[MaxPolyVertices];   // >= 0 poly in this tile across edge i, BorderEdge + side on the tile edge, -1 wall
+        int vertexCount = 0;
+    };
+
+    static constexpr int32_t BorderEdge = 1 << 20;   // sides: 0 -x, 1 +z, 2 +x, 3 -z
+
+    int x = 0, z = 0;
+    std::vector<glm::vec3> vertices;
+    std::vector<Poly> polys;
+};
+
+// Tiled navigation mesh: convex polygons over a grid of square tiles, linked across shared edges inside a tile and
+// across tile borders wherever two border edges overlap on the same line.
+class NavMesh {
+public:
+    struct Stats {
+        size_t tiles = 0;
+        size_t polys = 0;
+        size_t vertices = 0;
+        size_t links = 0;
+        double buildMs = 0.0;
+    };
+
+    NavMesh() = default;
+    NavMesh(const glm::vec3 &origin, float tileSize, int tilesX, int tilesZ, float climb);
+
+    // Tiles can be added in any order; ConnectTiles() links everything once all are in
+    void AddTile(const NavTileData &data);
+    void ConnectTiles();
+
+    // Polygon under or nearest to point within extents (half sizes), or InvalidPoly. nearest receives the closest
+    // point on that polygon.
+    uint32_t FindNearestPoly(const glm::vec3 &point, const glm::vec3 &extents, glm::vec3 *nearest = nullptr) const;
+    glm::vec3 ClosestPointOnPoly(uint32_t poly, const glm::vec3 &point) const;
+
+    const std::vector<NavPoly> &Polys() const { return polys; }
+    const std::vector<glm::vec3> &Vertices() const { return vertices; }
+    const std::vector<NavLink> &Links() const { return links; }
+    const std::vector<NavTile> &Tiles() const { return tiles; }
+
+    // Tile index at grid coordinates, or -1
+    int TileAt(int x, int z) const;
+    int TileOf(const glm::vec3 &point) const;
+
+    glm::vec3 Origin() const { return origin; }
+    float TileSize() const { return tileSize; }
+    int TilesX() const { return tilesX; }
+    int TilesZ() const { return tilesZ; }
+
+    Stats &GetStats() { return stats; }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    glm::vec3 origin = glm::vec3(0.0f);
+    float tileSize = 1.0f;
+    int tilesX = 0, tilesZ = 0;
+    float climb = 0.5f;
+
+    std::vector<int> tileGrid;                // tilesX * tilesZ -> index into tiles, -1 when empty
+    std::vector<NavTile> tiles;
+    std::vector<NavPoly> polys;
+    std::vector<glm::vec3> vertices;
+    std::vector<NavLink> links;
+
+    // Kept from AddTile() until ConnectTiles(): NavTileData::Poly::neighbour of every poly edge
+    std::vector<int32_t> edgeNeighbours;      // polys.size() * MaxPolyVertices
+
+    Stats stats;
+};
@@ -0,0 +1,966 @@
+#include "NavMeshBuilder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+
+#include "../Terrain/Heightfield.h"
+
+namespace {
+    // Directions share NavTileData's border side numbering: 0 -x, 1 +z, 2 +x, 3 -z
+    constexpr int DirX[4] = {-1, 0, 1, 0};
+    constexpr int DirZ[4] = {0, 1, 0, -1};
+    constexpr int MaxHeight = 0xffff;
+    constexpr int32_t WallEdge = -1;
+    constexpr uint16_t NoNeighbourRegion = 0xffff;
+
+    // Everything one tile's build needs, derived from the settings
+    struct TileGrid {
+        int width;                            // voxels per side including the border
+        int border;
+        int tileCells;
+        glm::vec3 origin;                     // world position of voxel (0, 0) at height 0
+        float cs, ch;
+        int walkableHeight, walkableClimb, walkableRadius;
+        float cosMaxSlope;
+
+        int Column(int x, int z) const { return z * width + x; }
+        bool Interior(int x, int z) const {
+            return x >= border && z >= border && x < border + tileCells && z < border + tileCells;
+        }
+    };
+
+    struct Span {
+        uint16_t min, max;
+        bool walkable;
+        int32_t next;
+    };
+
+    // Solid voxel spans per column, as a linked list through one pool
+    struct SpanField {
+        std::vector<int32_t> columns;
+        std::vector<Span> spans;
+
+        // Merges with every span the new one overlaps. The top surface decides walkability; tops within the climb of
+        // each other are walkable if either is.
+        void Add(int column, int smin, int smax, bool walkable, int mergeClimb) {
+            int32_t *link = &columns[column];
+
+            while (*link >= 0) {
+                const Span &current = spans[*link];
+                if (current.min > smax) break;
+                if (current.max < smin) {
+                    link = &spans[*link].next;
+                    continue;
+                }
+
+                smin = std::min<int>(smin, current.min);
+                if (std::abs(static_cast<int>(current.max) - smax) <= mergeClimb) {
+                    walkable = walkable || current.walkable;
+                } else if (current.max > smax) {
+                    walkable = current.walkable;
+                }
+                smax = std::max<int>(smax, current.max);
+                *link = current.next;
+            }
+
+            spans.push_back({static_cast<uint16_t>(smin), static_cast<uint16_t>(smax), walkable, *link});
+            *link = static_cast<int32_t>(spans.size() - 1);
+        }
+    };
+
+    // Open space above a walkable span, with its neighbours in the four directions
+    struct CompactSpan {
+        uint16_t y, h;
+        int32_t neighbour[4];
+        uint16_t region;
+        uint8_t distance;
+        bool open;
+    };
+
+    struct CompactField {
+        std::vector<uint32_t> first, count;  // per column
+        std::vector<CompactSpan> spans;
+    };
+
+    // Splits polygon in at axis == value; below gets the part with smaller coordinates. Recast's dividePoly.
+    void DividePoly(const glm::vec3 *in, int n, glm::vec3 *below, int &nBelow, glm::vec3 *above, int &nAbove, float value, int axis) {
+        float d[12];
+        for (int i = 0; i < n; i++) d[i] = value - in[i][axis];
+
+        nBelow = nAbove = 0;
+        for (int i = 0, j = n - 1; i < n; j = i, i++) {
+            bool inA = d[j] >= 0.0f, inB = d[i] >= 0.0f;
+
+            if (inA != inB) {
+                float s = d[j] / (d[j] - d[i]);
+                glm::vec3 p = in[j] + (in[i] - in[j]) * s;
+                below[nBelow++] = p;
+                above[nAbove++] = p;
+                if (d[i] > 0.0f) {
+                    below[nBelow++] = in[i];
+                } else if (d[i] < 0.0f) {
+                    above[nAbove++] = in[i];
+                }
+            } else {
+                if (d[i] >= 0.0f) {
+                    below[nBelow++] = in[i];
+                    if (d[i] != 0.0f) continue;
+                }
+                above[nAbove++] = in[i];
+            }
+        }
+    }
+
+    // Calls emit(x, z, yMin, yMax) for every voxel column the triangle covers, with its height range in that column
+    template <typename Emit>
+    void RasterizeTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, const TileGrid &grid, Emit emit) {
+        glm::vec3 lo = glm::min(a, glm::min(b, c)), hi = glm::max(a, glm::max(b, c));
+        const float size = static_cast<float>(grid.width) * grid.cs;
+        if (hi.x < grid.origin.x || hi.z < grid.origin.z || lo.x > grid.origin.x + size || lo.z > grid.origin.z + size) return;
+
+        int z0 = std::max(static_cast<int>(std::floor((lo.z - grid.origin.z) / grid.cs)), -1);
+        int z1 = std::min(static_cast<int>(std::floor((hi.z - grid.origin.z) / grid.cs)), grid.width - 1);
+
+        glm::vec3 buffers[4][12];
+        glm::vec3 *in = buffers[0], *rest = buffers[1], *row = buffers[2], *cell = buffers[3];
+        int nIn = 3, nRest, nRow, nCell;
+        in[0] = a;
+        in[1] = b;
+        in[2] = c;
+
+        for (int z = z0; z <= z1; z++) {
+            float cz = grid.origin.z + static_cast<float>(z + 1) * grid.cs;
+            DividePoly(in, nIn, row, nRow, rest, nRest, cz, 2);
+            std::swap(in, rest);
+            nIn = nRest;
+            if (nRow < 3 || z < 0) continue;
+
+            float minX = row[0].x, maxX = row[0].x;
+            for (int i = 1; i < nRow; i++) {
+                minX = std::min(minX, row[i].x);
+                maxX = std::max(maxX, row[i].x);
+            }
+            int x0 = std::max(static_cast<int>(std::floor((minX - grid.origin.x) / grid.cs)), -1);
+            int x1 = std::min(static_cast<int>(std::floor((maxX - grid.origin.x) / grid.cs)), grid.width - 1);
+
+            for (int x = x0; x <= x1; x++) {
+                float cx = grid.origin.x + static_cast<float>(x + 1) * grid.cs;
+                DividePoly(row, nRow, cell, nCell, rest, nRest, cx, 0);
+                std::swap(row, rest);
+                nRow = nRest;
+                if (nCell < 3 || x < 0) continue;
+
+                float yMin = cell[0].y, yMax = cell[0].y;
+                for (int i = 1; i < nCell; i++) {
+                    yMin = std::min(yMin, cell[i].y);
+                    yMax = std::max(yMax, cell[i].y);
+                }
+                emit(x, z, yMin, yMax);
+            }
+        }
+    }
+
+    void AddSolid(SpanField &field, const TileGrid &grid, int x, int z, float yMin, float yMax, bool walkable) {
+        int smin = static_cast<int>(std::floor((yMin - grid.origin.y) / grid.ch));
+        int smax = static_cast<int>(std::ceil((yMax - grid.origin.y) / grid.ch));
+        if (smax < 0 || smin > MaxHeight) return;
+
+        smin = std::clamp(smin, 0, MaxHeight);
+        smax = std::clamp(std::max(smax, smin + 1), 0, MaxHeight);
+        field.Add(grid.Column(x, z), smin, smax, walkable, grid.walkableClimb);
+    }
+
+    void RasterizeWorld(SpanField &field, const TileGrid &grid, const StaticBvh &world, const Heightfield *terrain) {
+        const float size = static_cast<float>(grid.width) * grid.cs;
+        std::vector<StaticGeometry::Triangle> triangles;
+        std::vector<StaticGeometry::Box> boxes;
+        world.Overlap(glm::vec3(grid.origin.x, -INFINITY, grid.origin.z), glm::vec3(grid.origin.x + size, INFINITY, grid.origin.z + size),
+                      triangles, boxes);
+
+        // Triangles are double sided in the BVH, so slope is judged on the unsigned normal
+        for (const StaticGeometry::Triangle &t: triangles) {
+            glm::vec3 n = glm::cross(t.b - t.a, t.c - t.a);
+            float length = glm::length(n);
+            bool walkable = length > 0.0f && std::abs(n.y) / length >= grid.cosMaxSlope;
+
+            RasterizeTriangle(t.a, t.b, t.c, grid, [&](int x, int z, float yMin, float yMax) {
+                AddSolid(field, grid, x, z, yMin, yMax, walkable);
+            });
+        }
+
+        // Boxes are solid: each column they cover gets one span from the lowest to the highest face fragment, walkable
+        // when the top comes from an upward face
+        static const int Faces[6][4] = {{0, 1, 3, 2}, {4, 6, 7, 5}, {0, 4, 5, 1}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 5, 7, 3}};
+        struct Extent {
+            float yMin = INFINITY, yMax = -INFINITY;
+            bool walkable = false;
+        };
+        std::vector<Extent> extents;
+
+        for (const StaticGeometry::Box &box: boxes) {
+            glm::mat3 axes = glm::transpose(box.toLocal);
+            glm::vec3 corners[8];
+            for (int i = 0; i < 8; i++) {
+                glm::vec3 sign((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f);
+                corners[i] = box.center + axes * (sign * box.halfExtents);
+            }
+
+            glm::vec3 lo = corners[0], hi = corners[0];
+            for (const glm::vec3 &corner: corners) {
+                lo = glm::min(lo, corner);
+                hi = glm::max(hi, corner);
+            }
+            int x0 = std::max(static_cast<int>(std::floor((lo.x - grid.origin.x) / grid.cs)), 0);
+            int z0 = std::max(static_cast<int>(std::floor((lo.z - grid.origin.z) / grid.cs)), 0);
+            int x1 = std::min(static_cast<int>(std::floor((hi.x - grid.origin.x) / grid.cs)), grid.width - 1);
+            int z1 = std::min(static_cast<int>(std::floor((hi.z - grid.origin.z) / grid.cs)), grid.width - 1);
+            if (x1 < x0 || z1 < z0) continue;
+
+            const int spanX = x1 - x0 + 1;
+            extents.assign(static_cast<size_t>(spanX) * (z1 - z0 + 1), Extent());
+
+            for (const auto &face: Faces) {
+                glm::vec3 n = glm::normalize(glm::cross(corners[face[1]] - corners[face[0]], corners[face[2]] - corners[face[0]]));
+                if (glm::dot(n, corners[face[0]] + corners[face[2]] - 2.0f * box.center) < 0.0f) n = -n;
+                bool walkable = n.y >= grid.cosMaxSlope;
+
+                for (int half = 0; half < 2; half++) {
+                    RasterizeTriangle(corners[face[0]], corners[face[1 + half]], corners[face[2 + half]], grid,
+                                      [&](int x, int z, float yMin, float yMax) {
+                        if (x < x0 || x > x1 || z < z0 || z > z1) return;
+                        Extent &e = extents[static_cast<size_t>(z - z0) * spanX + (x - x0)];
+                        e.yMin = std::min(e.yMin, yMin);
+                        if (yMax > e.yMax + 1e-4f) {
+                            e.walkable = walkable;
+                        } else if (yMax >= e.yMax - 1e-4f) {
+                            e.walkable = e.walkable || walkable;
+                        }
+                        e.yMax = std::max(e.yMax, yMax);
+                    });
+                }
+            }
+
+            for (int z = z0; z <= z1; z++) {
+                for (int x = x0; x <= x1; x++) {
+                    const Extent &e = extents[static_cast<size_t>(z - z0) * spanX + (x - x0)];
+                    if (e.yMax >= e.yMin) AddSolid(field, grid, x, z, e.yMin, e.yMax, e.walkable);
+                }
+            }
+        }
+
+        if (!terrain) return;
+
+        // Terrain is solid from the bottom of the bounds up to the highest corner of each column
+        const int corners = grid.width + 1;
+        std::vector<float> heights(static_cast<size_t>(corners) * corners);
+        for (int z = 0; z < corners; z++) {
+            for (int x = 0; x < corners; x++) {
+                heights[static_cast<size_t>(z) * corners + x] = terrain->HeightAt(grid.origin.x + static_cast<float>(x) * grid.cs,
+                                                                                  grid.origin.z + static_cast<float>(z) * grid.cs);
+            }
+        }
+
+        const float maxGradient2 = (1.0f - grid.cosMaxSlope * grid.cosMaxSlope) / (grid.cosMaxSlope * grid.cosMaxSlope);
+        for (int z = 0; z < grid.width; z++) {
+            for (int x = 0; x < grid.width; x++) {
+                float h00 = heights[static_cast<size_t>(z) * corners + x], h10 = heights[static_cast<size_t>(z) * corners + x + 1];
+                float h01 = heights[static_cast<size_t>(z + 1) * corners + x], h11 = heights[static_cast<size_t>(z + 1) * corners + x + 1];
+                float gx = ((h10 + h11) - (h00 + h01)) / (2.0f * grid.cs);
+                float gz = ((h01 + h11) - (h00 + h10)) / (2.0f * grid.cs);
+
+                AddSolid(field, grid, x, z, grid.origin.y, std::max(std::max(h00, h10), std::max(h01, h11)),
+                         gx * gx + gz * gz <= maxGradient2);
+            }
+        }
+    }
+
+    // Recast's span filters: step onto low obstacles, drop ledges and steep stair-steps, drop spans without headroom
+    void FilterSpans(SpanField &field, const TileGrid &grid) {
+        const int w = grid.width;
+
+        for (int column = 0; column < w * w; column++) {
+            bool previousWalkable = false;
+            int previousMax = 0;
+            for (int32_t s = field.columns[column]; s >= 0; s = field.spans[s].next) {
+                Span &span = field.spans[s];
+                bool walkable = span.walkable;
+                if (!walkable && previousWalkable && span.max - previousMax <= grid.walkableClimb) span.walkable = true;
+                previousWalkable = walkable;
+                previousMax = span.max;
+            }
+        }
+
+        for (int z = 0; z < w; z++) {
+            for (int x = 0; x < w; x++) {
+                for (int32_t s = field.columns[grid.Column(x, z)]; s >= 0; s = field.spans[s].next) {
+                    Span &span = field.spans[s];
+                    if (!span.walkable) continue;
+
+                    const int bottom = span.max;
+                    const int top = span.next >= 0 ? field.spans[span.next].min : MaxHeight;
+                    int lowestDrop = MaxHeight, accessibleMin = bottom, accessibleMax = bottom;
+
+                    for (int dir = 0; dir < 4; dir++) {
+                        int nx = x + DirX[dir], nz = z + DirZ[dir];
+                        if (nx < 0 || nz < 0 || nx >= w || nz >= w) {
+                            lowestDrop = std::min(lowestDrop, -grid.walkableClimb - bottom);
+                            continue;
+                        }
+
+                        int32_t neighbour = field.columns[grid.Column(nx, nz)];
+                        int neighbourBottom = -grid.walkableClimb;
+                        int neighbourTop = neighbour >= 0 ? field.spans[neighbour].min : MaxHeight;
+                        if (std::min(top, neighbourTop) - std::max(bottom, neighbourBottom) > grid.walkableHeight) {
+                            lowestDrop = std::min(lowestDrop, neighbourBottom - bottom);
+                        }
+
+                        for (; neighbour >= 0; neighbour = field.spans[neighbour].next) {
+                            neighbourBottom = field.spans[neighbour].max;
+                            int next = field.spans[neighbour].next;
+                            neighbourTop = next >= 0 ? field.spans[next].min : MaxHeight;
+
+                            if (std::min(top, neighbourTop) - std::max(bottom, neighbourBottom) > grid.walkableHeight) {
+                                lowestDrop = std::min(lowestDrop, neighbourBottom - bottom);
+                                if (std::abs(neighbourBottom - bottom) <= grid.walkableClimb) {
+                                    accessibleMin = std::min(accessibleMin, neighbourBottom);
+                                    accessibleMax = std::max(accessibleMax, neighbourBottom);
+                                }
+                            }
+                        }
+                    }
+
+                    if (lowestDrop < -grid.walkableClimb || accessibleMax - accessibleMin > grid.walkableClimb) {
+                        span.walkable = false;
+                    }
+                }
+            }
+        }
+
+        for (Span &span: field.spans) {
+            int top = span.next >= 0 ? field.spans[span.next].min : MaxHeight;
+            if (top - span.max < grid.walkableHeight) span.walkable = false;
+        }
+    }
+
+    CompactField BuildCompact(const SpanField &field, const TileGrid &grid) {
+        const int w = grid.width;
+        CompactField compact;
+        compact.first.resize(static_cast<size_t>(w) * w);
+        compact.count.resize(static_cast<size_t>(w) * w);
+
+        for (int column = 0; column < w * w; column++) {
+            compact.first[column] = static_cast<uint32_t>(compact.spans.size());
+            for (int32_t s = field.columns[column]; s >= 0; s = field.spans[s].next) {
+                const Span &span = field.spans[s];
+                if (!span.walkable) continue;
+
+                int top = span.next >= 0 ? field.spans[span.next].min : MaxHeight;
+                compact.spans.push_back({span.max, static_cast<uint16_t>(std::min(top - span.max, MaxHeight)), {-1, -1, -1, -1}, 0, 0xff, true});
+            }
+            compact.count[column] = static_cast<uint32_t>(compact.spans.size()) - compact.first[column];
+        }
+
+        for (int z = 0; z < w; z++) {
+            for (int x = 0; x < w; x++) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    CompactSpan &span = compact.spans[i];
+
+                    for (int dir = 0; dir < 4; dir++) {
+                        int nx = x + DirX[dir], nz = z + DirZ[dir];
+                        if (nx < 0 || nz < 0 || nx >= w || nz >= w) continue;
+
+                        int other = grid.Column(nx, nz);
+                        for (uint32_t j = compact.first[other]; j < compact.first[other] + compact.count[other]; j++) {
+                            const CompactSpan &n = compact.spans[j];
+                            int bottom = std::max(span.y, n.y);
+                            int top = std::min(span.y + span.h, n.y + n.h);
+                            if (top - bottom >= grid.walkableHeight && std::abs(static_cast<int>(n.y) - span.y) <= grid.walkableClimb) {
+                                span.neighbour[dir] = static_cast<int32_t>(j);
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return compact;
+    }
+
+    // Chamfer distance to the nearest unwalkable edge (2 per straight step, 3 diagonal), then close everything nearer
+    // than the agent radius. Recast's rcErodeWalkableArea.
+    void Erode(CompactField &compact, const TileGrid &grid) {
+        const int w = grid.width;
+        std::vector<CompactSpan> &spans = compact.spans;
+
+        for (CompactSpan &span: spans) {
+            int connected = 0;
+            for (int32_t n: span.neighbour) connected += n >= 0 ? 1 : 0;
+            span.distance = connected == 4 ? 0xff : 0;
+        }
+
+        auto relax = [&](CompactSpan &span, int32_t neighbour, int cost) {
+            if (neighbour >= 0) span.distance = static_cast<uint8_t>(std::min<int>(span.distance, spans[neighbour].distance + cost));
+        };
+
+        for (int z = 0; z < w; z++) {
+            for (int x = 0; x < w; x++) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    CompactSpan &span = spans[i];
+                    if (int32_t a = span.neighbour[0]; a >= 0) {
+                        relax(span, a, 2);
+                        relax(span, spans[a].neighbour[3], 3);
+                    }
+                    if (int32_t a = span.neighbour[3]; a >= 0) {
+                        relax(span, a, 2);
+                        relax(span, spans[a].neighbour[2], 3);
+                    }
+                }
+            }
+        }
+
+        for (int z = w - 1; z >= 0; z--) {
+            for (int x = w - 1; x >= 0; x--) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    CompactSpan &span = spans[i];
+                    if (int32_t a = span.neighbour[2]; a >= 0) {
+                        relax(span, a, 2);
+                        relax(span, spans[a].neighbour[1], 3);
+                    }
+                    if (int32_t a = span.neighbour[1]; a >= 0) {
+                        relax(span, a, 2);
+                        relax(span, spans[a].neighbour[0], 3);
+                    }
+                }
+            }
+        }
+
+        const int threshold = grid.walkableRadius * 2;
+        for (CompactSpan &span: spans) {
+            if (span.distance < threshold) span.open = false;
+        }
+    }
+
+    int32_t OpenNeighbour(const CompactField &compact, const CompactSpan &span, int dir) {
+        int32_t n = span.neighbour[dir];
+        return n >= 0 && compact.spans[n].open ? n : -1;
+    }
+
+    // Monotone partitioning (Recast's rcBuildRegionsMonotone) over the tile interior: each row's runs continue the
+    // region above them only when they are its sole continuation, so every region is hole free.
+    int BuildRegions(CompactField &compact, const TileGrid &grid) {
+        struct Sweep {
+            uint16_t id;
+            uint16_t neighbour;
+            int samples;
+        };
+
+        std::vector<Sweep> sweeps;
+        std::vector<int> previousCount;
+        uint16_t nextRegion = 1;
+
+        for (int z = grid.border; z < grid.border + grid.tileCells; z++) {
+            sweeps.assign(1, Sweep{});
+            previousCount.assign(nextRegion + 1, 0);
+
+            for (int x = grid.border; x < grid.border + grid.tileCells; x++) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    CompactSpan &span = compact.spans[i];
+                    if (!span.open) continue;
+
+                    uint16_t sweep = 0;
+                    int32_t left = OpenNeighbour(compact, span, 0);
+                    if (left >= 0 && x > grid.border) sweep = compact.spans[left].region;
+
+                    if (sweep == 0) {
+                        sweep = static_cast<uint16_t>(sweeps.size());
+                        sweeps.push_back(Sweep{0, 0, 0});
+                    }
+
+                    int32_t below = OpenNeighbour(compact, span, 3);
+                    if (below >= 0 && z > grid.border) {
+                        uint16_t region = compact.spans[below].region;
+                        if (region != 0) {
+                            Sweep &s = sweeps[sweep];
+                            if (s.neighbour == 0 || s.neighbour == region) {
+                                s.neighbour = region;
+                                s.samples++;
+                                previousCount[region]++;
+                            } else {
+                                s.neighbour = NoNeighbourRegion;
+                            }
+                        }
+                    }
+
+                    span.region = sweep;
+                }
+            }
+
+            for (size_t s = 1; s < sweeps.size(); s++) {
+                Sweep &sweep = sweeps[s];
+                if (sweep.neighbour != NoNeighbourRegion && sweep.neighbour != 0 && previousCount[sweep.neighbour] == sweep.samples) {
+                    sweep.id = sweep.neighbour;
+                } else {
+                    sweep.id = nextRegion++;
+                }
+            }
+
+            for (int x = grid.border; x < grid.border + grid.tileCells; x++) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    CompactSpan &span = compact.spans[i];
+                    if (span.open && span.region) span.region = sweeps[span.region].id;
+                }
+            }
+        }
+
+        return nextRegion;
+    }
+
+    struct ContourVertex {
+        int x, y, z;
+        int32_t edge;                         // class of the edge leaving this vertex: WallEdge, a region, or a border side
+    };
+
+    // Highest floor of the spans around the corner between span i's dir and dir + 1 edges
+    int CornerHeight(const CompactField &compact, const CompactSpan &span, int dir) {
+        const int next = (dir + 1) & 3;
+        int height = span.y;
+
+        if (int32_t a = OpenNeighbour(compact, span, dir); a >= 0) {
+            height = std::max<int>(height, compact.spans[a].y);
+            if (int32_t b = OpenNeighbour(compact, compact.spans[a], next); b >= 0) height = std::max<int>(height, compact.spans[b].y);
+        }
+        if (int32_t a = OpenNeighbour(compact, span, next); a >= 0) {
+            height = std::max<int>(height, compact.spans[a].y);
+            if (int32_t b = OpenNeighbour(compact, compact.spans[a], dir); b >= 0) height = std::max<int>(height, compact.spans[b].y);
+        }
+
+        return height;
+    }
+
+    int32_t EdgeClass(const CompactField &compact, const TileGrid &grid, int x, int z, const CompactSpan &span, int dir) {
+        int32_t n = OpenNeighbour(compact, span, dir);
+        if (n < 0) return WallEdge;
+        if (!grid.Interior(x + DirX[dir], z + DirZ[dir])) return NavTileData::BorderEdge + dir;
+        return compact.spans[n].region;
+    }
+
+    // Recast's walkContour: follow the region's outline keeping it on the right, one vertex per voxel corner
+    std::vector<ContourVertex> WalkContour(const CompactField &compact, const TileGrid &grid, int x, int z, uint32_t start) {
+        const CompactSpan &first = compact.spans[start];
+        auto boundary = [&](const CompactSpan &span, int cx, int cz, int dir) {
+            int32_t n = OpenNeighbour(compact, span, dir);
+            return n < 0 || !grid.Interior(cx + DirX[dir], cz + DirZ[dir]) || compact.spans[n].region != span.region;
+        };
+
+        int dir = 0;
+        while (dir < 4 && !boundary(first, x, z, dir)) dir++;
+
+        std::vector<ContourVertex> raw;
+        if (dir == 4) return raw;
+
+        const int startDir = dir;
+        uint32_t i = start;
+
+        for (int iteration = 0; iteration < 1 << 16; iteration++) {
+            const CompactSpan &span = compact.spans[i];
+
+            if (boundary(span, x, z, dir)) {
+                int px = x, pz = z;
+                switch (dir) {
+                    case 0: pz++; break;
+                    case 1: px++; pz++; break;
+                    case 2: px++; break;
+                    default: break;
+                }
+                raw.push_back({px, CornerHeight(compact, span, dir), pz, EdgeClass(compact, grid, x, z, span, dir)});
+                dir = (dir + 1) & 3;
+            } else {
+                i = static_cast<uint32_t>(span.neighbour[dir]);
+                x += DirX[dir];
+                z += DirZ[dir];
+                dir = (dir + 3) & 3;
+            }
+
+            if (i == start && dir == startDir) break;
+        }
+
+        // Each vertex was recorded with the edge that ends at it; shift to the edge that leaves it
+        std::vector<ContourVertex> leaving(raw.size());
+        for (size_t k = 0; k < raw.size(); k++) {
+            leaving[k] = raw[k];
+            leaving[k].edge = raw[(k + 1) % raw.size()].edge;
+        }
+        return leaving;
+    }
+
+    // Keep the vertices where the edge class changes; refine wall stretches until they are within maxError of the
+    // voxel outline and no longer than maxLength. Portal and border stretches stay straight so both sides agree.
+    std::vector<ContourVertex> SimplifyContour(const std::vector<ContourVertex> &raw, float maxError, float maxLength) {
+        const size_t n = raw.size();
+        std::vector<size_t> keep;
+
+        for (size_t k = 0; k < n; k++) {
+            if (raw[(k + n - 1) % n].edge != raw[k].edge) keep.push_back(k);
+        }
+
+        if (keep.empty()) {
+            // One class all the way round: seed with the lower-left and upper-right corners
+            size_t lowerLeft = 0, upperRight = 0;
+            for (size_t k = 1; k < n; k++) {
+                if (raw[k].x < raw[lowerLeft].x || (raw[k].x == raw[lowerLeft].x && raw[k].z < raw[lowerLeft].z)) lowerLeft = k;
+                if (raw[k].x > raw[upperRight].x || (raw[k].x == raw[upperRight].x && raw[k].z > raw[upperRight].z)) upperRight = k;
+            }
+            keep.push_back(std::min(lowerLeft, upperRight));
+            if (upperRight != lowerLeft) keep.push_back(std::max(lowerLeft, upperRight));
+        }
+
+        auto refine = [&](auto &&split) {
+            for (size_t a = 0; a < keep.size();) {
+                size_t ia = keep[a], ib = keep[(a + 1) % keep.size()];
+                size_t inserted = split(ia, ib);
+                if (inserted == n) {
+                    a++;
+                } else {
+                    keep.insert(keep.begin() + static_cast<std::ptrdiff_t>(a) + 1, inserted);
+                }
+            }
+        };
+
+        const float maxError2 = maxError * maxError;
+        refine([&](size_t ia, size_t ib) {
+            if (raw[ia].edge != WallEdge) return n;
+
+            const glm::vec2 a(static_cast<float>(raw[ia].x), static_cast<float>(raw[ia].z));
+            const glm::vec2 b(static_cast<float>(raw[ib].x), static_cast<float>(raw[ib].z));
+            glm::vec2 ab = b - a;
+            float length2 = glm::dot(ab, ab);
+
+            size_t worst = n;
+            float worstDistance = maxError2;
+            for (size_t k = (ia + 1) % n; k != ib; k = (k + 1) % n) {
+                glm::vec2 p(static_cast<float>(raw[k].x), static_cast<float>(raw[k].z));
+                float t = length2 > 0.0f ? std::clamp(glm::dot(p - a, ab) / length2, 0.0f, 1.0f) : 0.0f;
+                glm::vec2 d = p - (a + ab * t);
+                if (glm::dot(d, d) > worstDistance) {
+                    worstDistance = glm::dot(d, d);
+                    worst = k;
+                }
+            }
+            return worst;
+        });
+
+        const float maxLength2 = maxLength * maxLength;
+        refine([&](size_t ia, size_t ib) {
+            if (raw[ia].edge != WallEdge) return n;
+
+            float dx = static_cast<float>(raw[ib].x - raw[ia].x), dz = static_cast<float>(raw[ib].z - raw[ia].z);
+            size_t between = (ib + n - ia) % n;
+            if (dx * dx + dz * dz <= maxLength2 || between < 2) return n;
+            return (ia + between / 2) % n;
+        });
+
+        std::vector<ContourVertex> simplified;
+        for (size_t k = 0; k < keep.size(); k++) {
+            ContourVertex v = raw[keep[k]];
+            v.edge = raw[keep[k]].edge;
+            simplified.push_back(v);
+        }
+        return simplified;
+    }
+
+    int64_t Cross(const ContourVertex &a, const ContourVertex &b, const ContourVertex &c) {
+        return static_cast<int64_t>(b.x - a.x) * (c.z - a.z) - static_cast<int64_t>(b.z - a.z) * (c.x - a.x);
+    }
+
+    // Ear clipping in integer voxel coordinates, cutting the shortest valid diagonal first. Returns vertex index
+    // triples wound like the contour.
+    std::vector<int> Triangulate(const std::vector<ContourVertex> &contour) {
+        std::vector<int> remaining(contour.size());
+        for (size_t i = 0; i < contour.size(); i++) remaining[i] = static_cast<int>(i);
+
+        int64_t area = 0;
+        for (size_t i = 0; i < contour.size(); i++) {
+            const ContourVertex &a = contour[i], &b = contour[(i + 1) % contour.size()];
+            area += static_cast<int64_t>(a.x) * b.z - static_cast<int64_t>(b.x) * a.z;
+        }
+        const int64_t winding = area >= 0 ? 1 : -1;
+
+        std::vector<int> triangles;
+        while (remaining.size() > 3) {
+            const size_t m = remaining.size();
+            size_t best = m;
+            int64_t bestLength = INT64_MAX;
+
+            for (size_t i = 0; i < m; i++) {
+                const ContourVertex &a = contour[remaining[(i + m - 1) % m]];
+                const ContourVertex &b = contour[remaining[i]];
+                const ContourVertex &c = contour[remaining[(i + 1) % m]];
+                if (Cross(a, b, c) * winding <= 0) continue;
+
+                bool ear = true;
+                for (size_t k = 0; k < m && ear; k++) {
+                    const ContourVertex &p = contour[remaining[k]];
+                    if ((p.x == a.x && p.z == a.z) || (p.x == b.x && p.z == b.z) || (p.x == c.x && p.z == c.z)) continue;
+                    ear = !(Cross(a, b, p) * winding >= 0 && Cross(b, c, p) * winding >= 0 && Cross(c, a, p) * winding >= 0);
+                }
+                if (!ear) continue;
+
+                int64_t length = static_cast<int64_t>(c.x - a.x) * (c.x - a.x) + static_cast<int64_t>(c.z - a.z) * (c.z - a.z);
+                if (length < bestLength) {
+                    bestLength = length;
+                    best = i;
+                }
+            }
+
+            // Self-touching outline left without a clean ear: give up on the rest rather than emit overlaps
+            if (best == m) return triangles;
+
+            triangles.push_back(remaining[(best + m - 1) % m]);
+            triangles.push_back(remaining[best]);
+            triangles.push_back(remaining[(best + 1) % m]);
+            remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(best));
+        }
+
+        if (Cross(contour[remaining[0]], contour[remaining[1]], contour[remaining[2]]) * winding > 0) {
+            triangles.insert(triangles.end(), remaining.begin(), remaining.end());
+        }
+        return triangles;
+    }
+
+    // Greedy merge of neighbouring polygons across their longest shared edge while the result stays convex and
+    // within MaxPolyVertices (Recast's getPolyMergeValue / mergePolyVerts)
+    std::vector<std::vector<int>> MergePolygons(const std::vector<ContourVertex> &contour, const std::vector<int> &triangles) {
+        std::vector<std::vector<int>> polys;
+        for (size_t t = 0; t + 2 < triangles.size(); t += 3) {
+            polys.push_back({triangles[t], triangles[t + 1], triangles[t + 2]});
+        }
+
+        int64_t winding = 0;
+        if (!polys.empty()) winding = Cross(contour[polys[0][0]], contour[polys[0][1]], contour[polys[0][2]]) > 0 ? 1 : -1;
+
+        auto mergeValue = [&](const std::vector<int> &p, const std::vector<int> &q, int &edgeP, int &edgeQ) -> int64_t {
+            const int np = static_cast<int>(p.size()), nq = static_cast<int>(q.size());
+            if (np + nq - 2 > MaxPolyVertices) return -1;
+
+            edgeP = edgeQ = -1;
+            for (int i = 0; i < np && edgeP < 0; i++) {
+                for (int j = 0; j < nq; j++) {
+                    if (p[i] == q[(j + 1) % nq] && p[(i + 1) % np] == q[j]) {
+                        edgeP = i;
+                        edgeQ = j;
+                        break;
+                    }
+                }
+            }
+            if (edgeP < 0) return -1;
+
+            // Convex at both ends of the removed edge
+            const ContourVertex &pa = contour[p[(edgeP + np - 1) % np]], &pb = contour[p[edgeP]], &pc = contour[q[(edgeQ + 2) % nq]];
+            if (Cross(pa, pb, pc) * winding <= 0) return -1;
+            const ContourVertex &qa = contour[q[(edgeQ + nq - 1) % nq]], &qb = contour[q[edgeQ]], &qc = contour[p[(edgeP + 2) % np]];
+            if (Cross(qa, qb, qc) * winding <= 0) return -1;
+
+            const ContourVertex &a = contour[p[edgeP]], &b = contour[p[(edgeP + 1) % np]];
+            return static_cast<int64_t>(b.x - a.x) * (b.x - a.x) + static_cast<int64_t>(b.z - a.z) * (b.z - a.z);
+        };
+
+        while (polys.size() > 1) {
+            std::unordered_map<uint64_t, size_t> edgeOwner;
+            for (size_t p = 0; p < polys.size(); p++) {
+                for (size_t i = 0; i < polys[p].size(); i++) {
+                    uint64_t a = static_cast<uint32_t>(polys[p][i]), b = static_cast<uint32_t>(polys[p][(i + 1) % polys[p].size()]);
+                    edgeOwner[(a << 32) | b] = p;
+                }
+            }
+
+            int64_t bestValue = 0;
+            size_t bestP = 0, bestQ = 0;
+            int bestEdgeP = 0, bestEdgeQ = 0;
+
+            for (size_t p = 0; p < polys.size(); p++) {
+                for (size_t i = 0; i < polys[p].size(); i++) {
+                    uint64_t a = static_cast<uint32_t>(polys[p][i]), b = static_cast<uint32_t>(polys[p][(i + 1) % polys[p].size()]);
+                    auto found = edgeOwner.find((b << 32) | a);
+                    if (found == edgeOwner.end() || found->second <= p) continue;
+
+                    int edgeP, edgeQ;
+                    int64_t value = mergeValue(polys[p], polys[found->second], edgeP, edgeQ);
+                    if (value > bestValue) {
+                        bestValue = value;
+                        bestP = p;
+                        bestQ = found->second;
+                        bestEdgeP = edgeP;
+                        bestEdgeQ = edgeQ;
+                    }
+                }
+            }
+
+            if (bestValue <= 0) break;
+
+            const std::vector<int> &p = polys[bestP], &q = polys[bestQ];
+            const int np = static_cast<int>(p.size()), nq = static_cast<int>(q.size());
+            std::vector<int> merged;
+            for (int i = 0; i < np - 1; i++) merged.push_back(p[(bestEdgeP + 1 + i) % np]);
+            for (int j = 0; j < nq - 1; j++) merged.push_back(q[(bestEdgeQ + 1 + j) % nq]);
+
+            polys[bestP] = std::move(merged);
+            polys.erase(polys.begin() + static_cast<std::ptrdiff_t>(bestQ));
+        }
+
+        return polys;
+    }
+
+    NavTileData BuildTile(int tileX, int tileZ, const StaticBvh &world, const Heightfield *terrain, const NavMeshSettings &settings) {
+        TileGrid grid;
+        grid.cs = settings.cellSize;
+        grid.ch = settings.cellHeight;
+        grid.tileCells = settings.tileCells;
+        grid.walkableHeight = static_cast<int>(std::ceil(settings.agentHeight / grid.ch));
+        grid.walkableClimb = static_cast<int>(std::floor(settings.agentClimb / grid.ch));
+        grid.walkableRadius = static_cast<int>(std::ceil(settings.agentRadius / grid.cs));
+        grid.border = grid.walkableRadius + 3;
+        grid.width = grid.tileCells + 2 * grid.border;
+        grid.cosMaxSlope = std::cos(settings.maxSlope * 3.14159265f / 180.0f);
+        grid.origin = glm::vec3(settings.boundsMin.x + static_cast<float>(tileX * grid.tileCells - grid.border) * grid.cs,
+                                settings.boundsMin.y,
+                                settings.boundsMin.z + static_cast<float>(tileZ * grid.tileCells - grid.border) * grid.cs);
+
+        NavTileData tile;
+        tile.x = tileX;
+        tile.z = tileZ;
+
+        SpanField field;
+        field.columns.assign(static_cast<size_t>(grid.width) * grid.width, -1);
+        RasterizeWorld(field, grid, world, terrain);
+        FilterSpans(field, grid);
+
+        CompactField compact = BuildCompact(field, grid);
+        Erode(compact, grid);
+        int regionCount = BuildRegions(compact, grid);
+
+        // Tile vertices are welded by voxel corner, keeping corners on different floors apart
+        std::unordered_map<uint64_t, std::vector<uint32_t>> welded;
+        std::vector<int> vertexHeights;
+        auto weld = [&](const ContourVertex &v) {
+            uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(v.x)) << 32) | static_cast<uint32_t>(v.z);
+            std::vector<uint32_t> &candidates = welded[key];
+            for (uint32_t index: candidates) {
+                if (std::abs(vertexHeights[index] - v.y) <= 2) return index;
+            }
+
+            auto index = static_cast<uint32_t>(tile.vertices.size());
+            tile.vertices.emplace_back(grid.origin.x + static_cast<float>(v.x) * grid.cs, grid.origin.y + static_cast<float>(v.y) * grid.ch,
+                                       grid.origin.z + static_cast<float>(v.z) * grid.cs);
+            vertexHeights.push_back(v.y);
+            candidates.push_back(index);
+            return index;
+        };
+
+        std::vector<bool> traced(regionCount + 1, false);
+        for (int z = grid.border; z < grid.border + grid.tileCells; z++) {
+            for (int x = grid.border; x < grid.border + grid.tileCells; x++) {
+                int column = grid.Column(x, z);
+                for (uint32_t i = compact.first[column]; i < compact.first[column] + compact.count[column]; i++) {
+                    const CompactSpan &span = compact.spans[i];
+                    if (!span.open || span.region == 0 || traced[span.region]) continue;
+                    traced[span.region] = true;
+
+                    std::vector<ContourVertex> raw = WalkContour(compact, grid, x, z, i);
+                    if (raw.size() < 3) continue;
+
+                    std::vector<ContourVertex> contour = SimplifyContour(raw, settings.maxEdgeError / grid.cs, settings.maxEdgeLength / grid.cs);
+                    if (contour.size() < 3) continue;
+
+                    for (const std::vector<int> &poly: MergePolygons(contour, Triangulate(contour))) {
+                        NavTileData::Poly out;
+                        out.vertexCount = static_cast<int>(poly.size());
+                        for (size_t k = 0; k < poly.size(); k++) {
+                            out.vertices[k] = weld(contour[poly[k]]);
+                            out.neighbour[k] = WallEdge;
+                        }
+                        tile.polys.push_back(out);
+                    }
+                }
+            }
+        }
+
+        // Neighbours inside the tile share a welded edge; unmatched edges along the tile boundary face the next tile
+        std::unordered_map<uint64_t, std::pair<int, int>> edges;
+        for (size_t p = 0; p < tile.polys.size(); p++) {
+            const NavTileData::Poly &poly = tile.polys[p];
+            for (int k = 0; k < poly.vertexCount; k++) {
+                uint64_t a = poly.vertices[k], b = poly.vertices[(k + 1) % poly.vertexCount];
+                edges[(a << 32) | b] = {static_cast<int>(p), k};
+            }
+        }
+
+        const float tileMinX = grid.origin.x + static_cast<float>(grid.border) * grid.cs;
+        const float tileMinZ = grid.origin.z + static_cast<float>(grid.border) * grid.cs;
+        const float tileMaxX = tileMinX + static_cast<float>(grid.tileCells) * grid.cs;
+        const float tileMaxZ = tileMinZ + static_cast<float>(grid.tileCells) * grid.cs;
+        const float onLine = grid.cs * 0.01f;
+
+        for (size_t p = 0; p < tile.polys.size(); p++) {
+            NavTileData::Poly &poly = tile.polys[p];
+            for (int k = 0; k < poly.vertexCount; k++) {
+                uint64_t a = poly.vertices[k], b = poly.vertices[(k + 1) % poly.vertexCount];
+                auto found = edges.find((b << 32) | a);
+                if (found != edges.end()) {
+                    poly.neighbour[k] = found->second.first;
+                    continue;
+                }
+
+                const glm::vec3 &va = tile.vertices[a], &vb = tile.vertices[b];
+                if (std::abs(va.x - tileMinX) < onLine && std::abs(vb.x - tileMinX) < onLine) {
+                    poly.neighbour[k] = NavTileData::BorderEdge + 0;
+                } else if (std::abs(va.z - tileMaxZ) < onLine && std::abs(vb.z - tileMaxZ) < onLine) {
+                    poly.neighbour[k] = NavTileData::BorderEdge + 1;
+                } else if (std::abs(va.x - tileMaxX) < onLine && std::abs(vb.x - tileMaxX) < onLine) {
+                    poly.neighbour[k] = NavTileData::BorderEdge + 2;
+                } else if (std::abs(va.z - tileMinZ) < onLine && std::abs(vb.z - tileMinZ) < onLine) {
+                    poly.neighbour[k] = NavTileData::BorderEdge + 3;
+                }
+            }
+        }
+
+        return tile;
+    }
+}
+
+NavMesh BuildNavMesh(const StaticBvh &world, const Heightfield *terrain, const NavMeshSettings &settings, JobSystem *jobs) {
+    auto start = std::chrono::steady_clock::now();
+
+    const float tileSize = settings.cellSize * static_cast<float>(settings.tileCells);
+    const int tilesX = std::max(1, static_cast<int>(std::ceil((settings.boundsMax.x - settings.boundsMin.x) / tileSize)));
+    const int tilesZ = std::max(1, static_cast<int>(std::ceil((settings.boundsMax.z - settings.boundsMin.z) / tileSize)));
+
+    std::vector<NavTileData> tiles(static_cast<size_t>(tilesX) * tilesZ);
+    auto build = [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; t++) {
+            tiles[t] = BuildTile(static_cast<int>(t % tilesX), static_cast<int>(t / tilesX), world, terrain, settings);
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(tiles.size(), 1, build);
+    } else {
+        build(0, tiles.size());
+    }
+
+    NavMesh mesh(settings.boundsMin, tileSize, tilesX, tilesZ, settings.agentClimb);
+    for (const NavTileData &tile: tiles) {
+        if (!tile.polys.empty()) mesh.AddTile(tile);
+    }
+    mesh.ConnectTiles();
+
+    mesh.GetStats().buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return mesh;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "NavMesh.h"
+#include "../Core/JobSystem.h"
+#include "../Physics/StaticBvh.h"
+
+class Heightfield;
+
+struct NavMeshSettings {
+    glm::vec3 boundsMin = glm::vec3(-64.0f, -50.0f, -64.0f);
+    glm::vec3 boundsMax = glm::vec3(64.0f, 100.0f, 64.0f);
+    float cellSize = 0.3f;                    // voxel width
+    float cellHeight = 0.2f;                  // voxel height
+    float agentHeight = 1.8f;
+    float agentRadius = 0.4f;
+    float agentClimb = 0.4f;
+    float maxSlope = 45.0f;                   // degrees
+    int tileCells = 64;                       // tile edge in voxels
+    float maxEdgeError = 1.3f;                // how far simplified wall edges may stray from the voxel outline, world units
+    float maxEdgeLength = 12.0f;              // wall edges are split above this, world units
+};
+
+// Recast-style build, one tile at a time over the job system: rasterize the static world (and the terrain, sampled
+// straight from the heightfield) into voxel spans; drop spans that are too steep, too low or at ledges; erode by the
+// agent radius; partition what is left into monotone regions; trace and simplify each region's outline; triangulate
+// it and merge the triangles into convex polygons. Tiles are stitched where their border edges overlap.
+NavMesh BuildNavMesh(const StaticBvh &world, const Heightfield *terrain, const NavMeshSettings &settings, JobSystem *jobs = nullptr);
@@ -0,0 +1,350 @@
+#include "NavQuery.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+    constexpr uint32_t NoParent = 0xffffffffu;
+
+    float Cross2D(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c) {
+        return (b.x - a.x) * (c.z - a.z) - (b.z - a.z) * (c.x - a.x);
+    }
+
+    bool SameXZ(const glm::vec3 &a, const glm::vec3 &b) {
+        return a.x == b.x && a.z == b.z;
+    }
+
+    void Append(std::vector<uint32_t> &corridor, uint32_t poly) {
+        if (corridor.empty() || corridor.back() != poly) corridor.push_back(poly);
+    }
+}
+
+NavQuery::NavQuery(const NavHierarchy &hierarchy) : hierarchy(hierarchy), mesh(hierarchy.Mesh()) {
+    const size_t polyCount = mesh.Polys().size(), nodeCount = hierarchy.Nodes().size();
+    for (PolySearch *search: {&forward, &backward}) {
+        search->cost.resize(polyCount);
+        search->parent.resize(polyCount);
+        search->stamp.assign(polyCount, 0);
+    }
+    nodeCost.resize(nodeCount);
+    nodeParent.resize(nodeCount);
+    nodeParentEdge.resize(nodeCount);
+    nodeStamp.assign(nodeCount, 0);
+}
+
+float NavQuery::PolyHeuristic(const PolySearch &search, uint32_t poly) const {
+    return search.goalPoly != InvalidPoly ? glm::length(mesh.Polys()[poly].center - goalPoint) : 0.0f;
+}
+
+float NavQuery::NodeHeuristic(uint32_t node) const {
+    return glm::length(mesh.Polys()[hierarchy.Nodes()[node].poly].center - goalPoint);
+}
+
+// A* from one polygon to goalPoly within from's cluster, or a full Dijkstra of the cluster when goalPoly is
+// InvalidPoly. ContinueCluster() runs it and sets reached once goalPoly is found.
+void NavQuery::BeginCluster(PolySearch &search, uint32_t from, uint32_t goal) {
+    search.cluster = hierarchy.ClusterOf(from);
+    search.goalPoly = goal;
+    search.reached = false;
+
+    const uint32_t generation = ++search.generation;
+    search.stamp[from] = generation;
+    search.cost[from] = 0.0f;
+    search.parent[from] = NoParent;
+
+    search.open = OpenList();
+    search.open.push({PolyHeuristic(search, from), from});
+}
+
+// Returns false when the budget ran out with polygons still open
+bool NavQuery::ContinueCluster(PolySearch &search) {
+    const std::vector<NavPoly> &polys = mesh.Polys();
+    const std::vector<NavLink> &links = mesh.Links();
+    const uint32_t generation = search.generation;
+
+    while (!search.open.empty()) {
+        if (expansions >= expansionLimit) return false;
+
+        auto [f, p] = search.open.top();
+        search.open.pop();
+        const float g = search.cost[p];
+        if (f > g + PolyHeuristic(search, p) + 1e-4f) continue;
+        if (p == search.goalPoly) {
+            search.reached = true;
+            break;
+        }
+        expansions++;
+
+        const NavPoly &poly = polys[p];
+        for (uint32_t l = poly.firstLink; l < poly.firstLink + poly.linkCount; l++) {
+            const uint32_t next = links[l].poly;
+            if (hierarchy.ClusterOf(next) != search.cluster) continue;
+
+            const float candidate = g + glm::length(polys[next].center - poly.center);
+            if (search.stamp[next] != generation || candidate < search.cost[next]) {
+                search.stamp[next] = generation;
+                search.cost[next] = candidate;
+                search.parent[next] = p;
+                search.open.push({candidate + PolyHeuristic(search, next), next});
+            }
+        }
+    }
+
+    search.open = OpenList();
+    return true;
+}
+
+// Seeds the abstract search with the start cluster's nodes at their costs from the start. A goal on another island
+// seeds nothing, so it is answered from the start cluster alone instead of exhausting the graph.
+void NavQuery::BeginAbstract() {
+    const std::vector<NavHierarchy::Node> &nodes = hierarchy.Nodes();
+    const uint32_t generation = ++nodeGeneration;
+    nodeOpen = OpenList();
+
+    for (uint32_t n = hierarchy.ClusterFirstNode(startCluster); n < hierarchy.ClusterFirstNode(startCluster + 1) && reachable; n++) {
+        uint32_t p = nodes[n].poly;
+        if (forward.stamp[p] != forward.generation) continue;
+
+        nodeStamp[n] = generation;
+        nodeCost[n] = forward.cost[p];
+        nodeParent[n] = nodeParentEdge[n] = NoParent;
+        nodeOpen.push({nodeCost[n] + NodeHeuristic(n), n});
+    }
+
+    bestTotal = closestDistance = INFINITY;
+    bestNode = closestNode = NoParent;
+}
+
+// Returns false when the budget ran out with nodes still open
+bool NavQuery::ContinueAbstract() {
+    const std::vector<NavHierarchy::Node> &nodes = hierarchy.Nodes();
+    const std::vector<NavHierarchy::Edge> &edges = hierarchy.Edges();
+    const uint32_t generation = nodeGeneration;
+
+    while (!nodeOpen.empty()) {
+        if (expansions >= expansionLimit) return false;
+
+        auto [f, n] = nodeOpen.top();
+        nodeOpen.pop();
+        if (f >= bestTotal) break;
+        const float g = nodeCost[n];
+        const float h = NodeHeuristic(n);
+        if (f > g + h + 1e-4f) continue;
+        expansions++;
+
+        if (h < closestDistance) {
+            closestDistance = h;
+            closestNode = n;
+        }
+
+        uint32_t p = nodes[n].poly;
+        if (nodes[n].cluster == goalCluster && backward.stamp[p] == backward.generation && g + backward.cost[p] < bestTotal) {
+            bestTotal = g + backward.cost[p];
+            bestNode = n;
+        }
+
+        for (uint32_t e = nodes[n].firstEdge; e < nodes[n].firstEdge + nodes[n].edgeCount; e++) {
+            const uint32_t m = edges[e].node;
+            const float candidate = g + edges[e].cost;
+            if (nodeStamp[m] != generation || candidate < nodeCost[m]) {
+                nodeStamp[m] = generation;
+                nodeCost[m] = candidate;
+                nodeParent[m] = n;
+                nodeParentEdge[m] = e;
+                nodeOpen.push({candidate + NodeHeuristic(m), m});
+            }
+        }
+    }
+
+    nodeOpen = OpenList();
+    return true;
+}
+
+bool NavQuery::FindPath(const glm::vec3 &start, const glm::vec3 &goal, NavPath &path, const glm::vec3 &extents) {
+    if (Begin(start, goal, extents) == NavQueryStatus::Failed) {
+        path.Clear();
+        return false;
+    }
+    return Resume(SIZE_MAX, path) == NavQueryStatus::Done;
+}
+
+NavQueryStatus NavQuery::Begin(const glm::vec3 &start, const glm::vec3 &goal, const glm::vec3 &extents) {
+    stage = Stage::Idle;
+    expansions = 0;
+
+    startPoly = mesh.FindNearestPoly(start, extents, &startPoint);
+    goalPoly = mesh.FindNearestPoly(goal, extents, &goalPoint);
+    if (startPoly == InvalidPoly || goalPoly == InvalidPoly) return NavQueryStatus::Failed;
+
+    startCluster = hierarchy.ClusterOf(startPoly);
+    goalCluster = hierarchy.ClusterOf(goalPoly);
+    reachable = hierarchy.ComponentOf(startPoly) == hierarchy.ComponentOf(goalPoly);
+
+    if (startCluster == goalCluster) {
+        BeginCluster(forward, startPoly, goalPoly);
+        stage = Stage::Local;
+    } else {
+        BeginCluster(forward, startPoly, InvalidPoly);
+        stage = Stage::StartCluster;
+    }
+    return NavQueryStatus::InProgress;
+}
+
+NavQueryStatus NavQuery::Resume(size_t maxExpansions, NavPath &path) {
+    expansionLimit = maxExpansions > SIZE_MAX - expansions ? SIZE_MAX : expansions + maxExpansions;
+
+    // Each stage either suspends at the budget or falls through to the next
+    switch (stage) {
+        case Stage::Idle:
+            return NavQueryStatus::Failed;
+
+        case Stage::Local:
+            if (!ContinueCluster(forward)) return NavQueryStatus::InProgress;
+            if (forward.reached) break;
+            // Same cluster but no way through it: route out through the abstract graph
+            BeginCluster(forward, startPoly, InvalidPoly);
+            stage = Stage::StartCluster;
+            [[fallthrough]];
+
+        case Stage::StartCluster:
+            if (!ContinueCluster(forward)) return NavQueryStatus::InProgress;
+            if (reachable) BeginCluster(backward, goalPoly, InvalidPoly);
+            stage = Stage::GoalCluster;
+            [[fallthrough]];
+
+        case Stage::GoalCluster:
+            if (reachable && !ContinueCluster(backward)) return NavQueryStatus::InProgress;
+            BeginAbstract();
+            stage = Stage::Abstract;
+            [[fallthrough]];
+
+        case Stage::Abstract:
+            if (!ContinueAbstract()) return NavQueryStatus::InProgress;
+            break;
+    }
+
+    Finish(path);
+    stage = Stage::Idle;
+    return NavQueryStatus::Done;
+}
+
+// Corridor from the finished searches, then its corners
+void NavQuery::Finish(NavPath &path) {
+    const std::vector<NavPoly> &polys = mesh.Polys();
+    const std::vector<NavHierarchy::Node> &nodes = hierarchy.Nodes();
+    const std::vector<NavHierarchy::Edge> &edges = hierarchy.Edges();
+    const std::vector<uint32_t> &corridors = hierarchy.Corridors();
+    glm::vec3 endPoint = goalPoint;
+    path.Clear();
+
+    if (stage == Stage::Local) {
+        for (uint32_t p = goalPoly; p != NoParent; p = forward.parent[p]) path.corridor.push_back(p);
+        std::reverse(path.corridor.begin(), path.corridor.end());
+        path.complete = true;
+    } else {
+        // Unreachable goal: head for whichever searched polygon is nearest to it
+        uint32_t endNode = bestNode;
+        uint32_t nearestLocal = startPoly;
+        if (endNode == NoParent) {
+            uint32_t count;
+            const uint32_t *local = hierarchy.ClusterPolys(startCluster, count);
+            float nearest = INFINITY;
+            for (uint32_t i = 0; i < count; i++) {
+                if (forward.stamp[local[i]] != forward.generation) continue;
+                float distance = glm::length(polys[local[i]].center - goalPoint);
+                if (distance < nearest) {
+                    nearest = distance;
+                    nearestLocal = local[i];
+                }
+            }
+            if (closestNode != NoParent && closestDistance < nearest) endNode = closestNode;
+        }
+
+        if (endNode == NoParent) {
+            for (uint32_t p = nearestLocal; p != NoParent; p = forward.parent[p]) path.corridor.push_back(p);
+            std::reverse(path.corridor.begin(), path.corridor.end());
+        } else {
+            std::vector<uint32_t> chain;
+            for (uint32_t n = endNode; n != NoParent; n = nodeParent[n]) chain.push_back(n);
+            std::reverse(chain.begin(), chain.end());
+
+            for (uint32_t p = nodes[chain.front()].poly; p != NoParent; p = forward.parent[p]) path.corridor.push_back(p);
+            std::reverse(path.corridor.begin(), path.corridor.end());
+
+            for (size_t i = 1; i < chain.size(); i++) {
+                const NavHierarchy::Edge &edge = edges[nodeParentEdge[chain[i]]];
+                for (uint32_t c = 1; c < edge.corridorLength; c++) Append(path.corridor, corridors[edge.firstCorridor + c]);
+                Append(path.corridor, nodes[chain[i]].poly);
+            }
+
+            if (bestNode != NoParent) {
+                for (uint32_t p = backward.parent[nodes[endNode].poly]; p != NoParent; p = backward.parent[p]) Append(path.corridor, p);
+            }
+        }
+
+        path.complete = path.corridor.back() == goalPoly;
+    }
+
+    if (!path.complete) endPoint = mesh.ClosestPointOnPoly(path.corridor.back(), goalPoint);
+    StringPull(mesh, path.corridor, startPoint, endPoint, path.points);
+}
+
+// Simple stupid funnel over the corridor's portals: keep the funnel from the apex to the portal ends as narrow as
+// possible and emit a corner whenever one side crosses over the other
+void StringPull(const NavMesh &mesh, const std::vector<uint32_t> &corridor, const glm::vec3 &start, const glm::vec3 &goal,
+                std::vector<glm::vec3> &points) {
+    const std::vector<NavPoly> &polys = mesh.Polys();
+    const std::vector<NavLink> &links = mesh.Links();
+
+    std::vector<glm::vec3> left, right;
+    left.push_back(start);
+    right.push_back(start);
+    for (size_t i = 0; i + 1 < corridor.size(); i++) {
+        const NavPoly &poly = polys[corridor[i]];
+        const NavLink *portal = nullptr;
+        for (uint32_t l = poly.firstLink; l < poly.firstLink + poly.linkCount && !portal; l++) {
+            if (links[l].poly == corridor[i + 1]) portal = &links[l];
+        }
+
+        left.push_back(portal ? portal->left : polys[corridor[i + 1]].center);
+        right.push_back(portal ? portal->right : polys[corridor[i + 1]].center);
+    }
+    left.push_back(goal);
+    right.push_back(goal);
+
+    points.push_back(start);
+    glm::vec3 apex = start, funnelLeft = start, funnelRight = start;
+    size_t apexIndex = 0, leftIndex = 0, rightIndex = 0;
+
+    for (size_t i = 1; i < left.size(); i++) {
+        // Right side narrows unless it swings past the left side, which makes the left end the next corner
+        if (Cross2D(apex, funnelRight, right[i]) <= 0.0f) {
+            if (SameXZ(apex, funnelRight) || Cross2D(apex, funnelLeft, right[i]) > 0.0f) {
+                funnelRight = right[i];
+                rightIndex = i;
+            } else {
+                if (!SameXZ(points.back(), funnelLeft)) points.push_back(funnelLeft);
+                apex = funnelRight = funnelLeft;
+                apexIndex = rightIndex = leftIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+
+        if (Cross2D(apex, funnelLeft, left[i]) >= 0.0f) {
+            if (SameXZ(apex, funnelLeft) || Cross2D(apex, funnelRight, left[i]) < 0.0f) {
+                funnelLeft = left[i];
+                leftIndex = i;
+            } else {
+                if (!SameXZ(points.back(), funnelRight)) points.push_back(funnelRight);
+                apex = funnelLeft = funnelRight;
+                apexIndex = leftIndex = rightIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+    }
+
+    if (!SameXZ(points.back(), goal) || points.size() == 1) points.push_back(goal);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "NavHierarchy.h"
+
+struct NavPath {
+    std::vector<glm::vec3> points;            // string-pulled corners, start first
+    std::vector<uint32_t> corridor;           // polygons from start to goal
+    bool complete = false;                    // false when the goal is unreachable: points lead towards it
+
+    void Clear() {
+        points.clear();
+        corridor.clear();
+        complete = false;
+    }
+};
+
+// Shortest line from start to goal through a polygon corridor, appended to points as its corners (funnel algorithm)
+void StringPull(const NavMesh &mesh, const std::vector<uint32_t> &corridor, const glm::vec3 &start, const glm::vec3 &goal,
+                std::vector<glm::vec3> &points);
+
+enum class NavQueryStatus {
+    InProgress,                               // suspended at its expansion budget; Resume() again
+    Done,                                     // path holds the best route found
+    Failed,                                   // start or goal not on the mesh, or no search begun
+};
+
+// Path search over a NavHierarchy. Holds the scratch state of one search, stamped per query instead of cleared, so
+// keep one NavQuery per thread and reuse it. A search can run in slices: Begin() it, then Resume() with an expansion
+// budget until it stops returning InProgress. The search state stays in the query between slices, so it can resume on
+// another thread as long as only one thread uses the query at a time.
+class NavQuery {
+public:
+    explicit NavQuery(const NavHierarchy &hierarchy);
+
+    // Snaps start and goal onto the mesh within extents (half sizes). Returns false when either has no polygon
+    // nearby; otherwise path holds the best route found. Begin() plus Resume() with no budget.
+    bool FindPath(const glm::vec3 &start, const glm::vec3 &goal, NavPath &path, const glm::vec3 &extents = glm::vec3(2.0f, 4.0f, 2.0f));
+
+    // Abandons any search in progress and starts a new one. Failed when start or goal has no polygon nearby.
+    NavQueryStatus Begin(const glm::vec3 &start, const glm::vec3 &goal, const glm::vec3 &extents = glm::vec3(2.0f, 4.0f, 2.0f));
+
+    // Expands at most maxExpansions more polygons and abstract nodes. Writes path only once the search is Done.
+    NavQueryStatus Resume(size_t maxExpansions, NavPath &path);
+
+    // Polygons expanded by the current or last search so far, local and abstract searches together
+    size_t LastExpansions() const { return expansions; }
+
+private:
+    enum class Stage {
+        Idle,
+        Local,                                // A* within the shared cluster of start and goal
+        StartCluster,                         // costs from the start to every node of its cluster
+        GoalCluster,                          // costs from every node of the goal cluster to the goal
+        Abstract,                             // A* over the abstract graph between them
+    };
+
+    using OpenEntry = std::pair<float, uint32_t>;
+    using OpenList = std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<>>;
+
+    // Polygon search state; two sets so the start and goal cluster searches can be kept side by side
+    struct PolySearch {
+        std::vector<float> cost;
+        std::vector<uint32_t> parent;
+        std::vector<uint32_t> stamp;
+        uint32_t generation = 0;
+        OpenList open;
+        uint32_t cluster = 0;
+        uint32_t goalPoly = 0;
+        bool reached = false;
+    };
+
+    void BeginCluster(PolySearch &search, uint32_t from, uint32_t goalPoly);
+    bool ContinueCluster(PolySearch &search);
+    void BeginAbstract();
+    bool ContinueAbstract();
+    void Finish(NavPath &path);
+    float PolyHeuristic(const PolySearch &search, uint32_t poly) const;
+    float NodeHeuristic(uint32_t node) const;
+
+    const NavHierarchy &hierarchy;
+    const NavMesh &mesh;
+
+    PolySearch forward, backward;
+    std::vector<float> nodeCost;
+    std::vector<uint32_t> nodeParent, nodeParentEdge;
+    std::vector<uint32_t> nodeStamp;
+    uint32_t nodeGeneration = 0;
+    size_t expansions = 0;
+
+    // The search in progress
+    Stage stage = Stage::Idle;
+    size_t expansionLimit = 0;
+    glm::vec3 startPoint{}, goalPoint{};
+    uint32_t startPoly = 0, goalPoly = 0;
+    uint32_t startCluster = 0, goalCluster = 0;
+    bool reachable = false;
+    OpenList nodeOpen;
+    float bestTotal = 0.0f, closestDistance = 0.0f;
+    uint32_t bestNode = 0, closestNode = 0;
+};
@@ -0,0 +1,142 @@
+#include "PathQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+PathQueue::PathQueue(const NavHierarchy &hierarchy, JobSystem *jobs, const PathQueueSettings &settings)
+    : hierarchy(hierarchy), jobs(jobs), settings(settings) {
+    this->settings.sliceExpansions = std::max<size_t>(this->settings.sliceExpansions, 1);
+
+    slots.resize(jobs ? jobs->WorkerCount() + 1 : 1);
+    for (Slot &slot: slots) slot.query = std::make_unique<NavQuery>(hierarchy);
+}
+
+uint32_t PathQueue::Request(const glm::vec3 &start, const glm::vec3 &goal) {
+    uint32_t id = nextId++;
+    if (nextId == 0) nextId = 1;
+
+    pending.push_back({id, start, goal});
+    stats.queued++;
+    return id;
+}
+
+void PathQueue::Update(double budgetMs) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(budgetMs));
+
+    updateCount++;
+    stats.solvedLastUpdate = 0;
+    Expire();
+
+    if (stats.queued == 0) {
+        stats.lastUpdateMs = 0.0;
+        return;
+    }
+
+    // Slots first resume the search they suspended, then claim requests in queue order, so the claimed ones are
+    // always a prefix of the queue
+    const size_t count = pending.size();
+    std::atomic<size_t> next{0};
+
+    auto solve = [&](size_t slotBegin, size_t slotEnd) {
+        for (size_t s = slotBegin; s < slotEnd; s++) {
+            Slot &slot = slots[s];
+            if (slot.busy) slot.result.updates++;
+
+            // A slice is not started if one as long as the last would end past the deadline
+            Clock::duration lastSlice{};
+            while (Clock::now() + lastSlice < deadline) {
+                NavQueryStatus status = NavQueryStatus::InProgress;
+                Clock::time_point sliceStart = Clock::now();
+
+                if (!slot.busy) {
+                    size_t i = next.fetch_add(1);
+                    if (i >= count) break;
+
+                    slot.request = pending[i];
+                    slot.result = Result();
+                    slot.result.updates = 1;
+                    slot.busy = true;
+                    status = slot.query->Begin(slot.request.start, slot.request.goal);
+                }
+                if (status == NavQueryStatus::InProgress) status = slot.query->Resume(settings.sliceExpansions, slot.result.path);
+                lastSlice = Clock::now() - sliceStart;
+                slot.result.ms += std::chrono::duration<double, std::milli>(lastSlice).count();
+                if (status == NavQueryStatus::InProgress) continue;
+
+                slot.result.found = status == NavQueryStatus::Done;
+                if (!slot.result.found) slot.result.path.Clear();
+                slot.done.emplace_back(slot.request.id, std::move(slot.result));
+                slot.busy = false;
+            }
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(slots.size(), 1, solve);
+    } else {
+        solve(0, 1);
+    }
+
+    pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(std::min(next.load(), count)));
+
+    size_t solved = 0, busy = 0;
+    for (Slot &slot: slots) {
+        busy += slot.busy;
+        for (auto &[id, result]: slot.done) {
+            stats.worstSearchMs = std::max(stats.worstSearchMs, result.ms);
+            stats.worstSearchUpdates = std::max(stats.worstSearchUpdates, result.updates);
+            result.finishedAt = updateCount;
+            finished[id] = std::move(result);
+            finishOrder.emplace_back(id, updateCount);
+            solved++;
+        }
+        slot.done.clear();
+    }
+    Expire();
+
+    stats.queued = pending.size() + busy;
+    stats.solvedLastUpdate = solved;
+    stats.solvedTotal += solved;
+    stats.lastUpdateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Drops results nobody collected within resultLifetime updates, and the oldest ones past maxResults
+void PathQueue::Expire() {
+    while (!finishOrder.empty()) {
+        auto [id, finishedAt] = finishOrder.front();
+        auto found = finished.find(id);
+        const bool live = found != finished.end() && found->second.finishedAt == finishedAt;
+        if (live && updateCount - finishedAt < settings.resultLifetime && finished.size() <= settings.maxResults) break;
+
+        finishOrder.pop_front();
+        if (live) {
+            finished.erase(found);
+            stats.expired++;
+        }
+    }
+}
+
+PathQueue::Status PathQueue::GetStatus(uint32_t id) const {
+    auto found = finished.find(id);
+    if (found != finished.end()) return found->second.found ? Status::Done : Status::Failed;
+
+    for (const Slot &slot: slots) {
+        if (slot.busy && slot.request.id == id) return Status::Queued;
+    }
+    for (const Pending &request: pending) {
+        if (request.id == id) return Status::Queued;
+    }
+    return Status::Unknown;
+}
+
+bool PathQueue::TakeResult(uint32_t id, NavPath &path) {
+    auto found = finished.find(id);
+    if (found == finished.end()) return false;
+
+    path = std::move(found->second.path);
+    finished.erase(found);
+    return true;
+}
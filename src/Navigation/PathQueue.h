@@ -0,0 +1,93 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "NavQuery.h"
+#include "../Core/JobSystem.h"
+
+struct PathQueueSettings {
+    size_t sliceExpansions = 256;             // nodes a search expands between deadline checks
+    uint32_t resultLifetime = 600;            // Update() calls a finished result waits for TakeResult() before it is dropped
+    size_t maxResults = 4096;                 // uncollected results kept at most; the oldest go first
+};
+
+// Path requests from AI, answered over as many frames as it takes. Update() works through queued requests in order
+// on the job system (one NavQuery per thread slot) until its time budget is spent, so a burst of orders from a whole
+// platoon costs a few milliseconds per frame rather than one long spike. Searches run in slices of sliceExpansions,
+// and a slot stops before a slice that would likely end past the deadline; a search still going then is suspended in
+// its slot and resumed by the next Update().
+class PathQueue {
+public:
+    enum class Status {
+        Unknown,                              // never issued, or its result was taken or expired
+        Queued,                               // waiting, or suspended part way
+        Done,
+        Failed,                               // start or goal not on the mesh
+    };
+
+    struct Stats {
+        size_t queued = 0;
+        size_t solvedLastUpdate = 0;
+        double lastUpdateMs = 0.0;
+        double worstSearchMs = 0.0;           // most time one search has taken, over all its slices
+        size_t worstSearchUpdates = 0;        // most Update() calls one search has spanned
+        size_t solvedTotal = 0;
+        size_t expired = 0;                   // results dropped uncollected
+    };
+
+    explicit PathQueue(const NavHierarchy &hierarchy, JobSystem *jobs = nullptr, const PathQueueSettings &settings = PathQueueSettings());
+
+    uint32_t Request(const glm::vec3 &start, const glm::vec3 &goal);
+    void Update(double budgetMs);
+
+    Status GetStatus(uint32_t id) const;
+
+    // Moves a Done or Failed result out; returns false (and leaves path alone) while the request is still queued
+    bool TakeResult(uint32_t id, NavPath &path);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Pending {
+        uint32_t id;
+        glm::vec3 start, goal;
+    };
+
+    struct Result {
+        NavPath path;
+        bool found = false;
+        double ms = 0.0;
+        size_t updates = 0;
+        uint64_t finishedAt = 0;              // Update() count
+    };
+
+    // One per thread; holds the search it is part way through, if any
+    struct Slot {
+        std::unique_ptr<NavQuery> query;
+        bool busy = false;
+        Pending request{};
+        Result result;
+        std::vector<std::pair<uint32_t, Result>> done;
+    };
+
+    void Expire();
+
+    const NavHierarchy &hierarchy;
+    JobSystem *jobs;
+    PathQueueSettings settings;
+
+    std::vector<Slot> slots;
+    std::deque<Pending> pending;
+    std::unordered_map<uint32_t, Result> finished;
+    std::deque<std::pair<uint32_t, uint64_t>> finishOrder;   // id and finishedAt, oldest first
+    uint64_t updateCount = 0;
+    uint32_t nextId = 1;
+
+    Stats stats;
+};
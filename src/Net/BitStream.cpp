@@ -0,0 +1,72 @@
+#include "BitStream.h"
+
+#include <algorithm>
+
+void BitWriter::Write(uint32_t value, int bits) {
+    scratch |= static_cast<uint64_t>(value & Mask(bits)) << scratchBits;
+    scratchBits += bits;
+
+    while (scratchBits >= 8) {
+        bytes.push_back(static_cast<uint8_t>(scratch));
+        scratch >>= 8;
+        scratchBits -= 8;
+    }
+}
+
+void BitWriter::WriteVarUint(uint32_t value) {
+    do {
+        Write(value & 0xfu, 4);
+        value >>= 4;
+        WriteBool(value != 0);
+    } while (value != 0);
+}
+
+const std::vector<uint8_t> &BitWriter::Finish() {
+    if (scratchBits > 0) {
+        bytes.push_back(static_cast<uint8_t>(scratch));
+        scratch = 0;
+        scratchBits = 0;
+    }
+    return bytes;
+}
+
+void BitWriter::Clear() {
+    bytes.clear();
+    scratch = 0;
+    scratchBits = 0;
+}
+
+uint32_t BitReader::Read(int bits) {
+    if (position + static_cast<size_t>(bits) > data.size() * 8) {
+        overflowed = true;
+        position = data.size() * 8;
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (int done = 0; done < bits;) {
+        const size_t byte = position >> 3;
+        const int offset = static_cast<int>(position & 7);
+        const int take = std::min(8 - offset, bits - done);
+        value |= ((static_cast<uint32_t>(data[byte]) >> offset) & BitWriter::Mask(take)) << done;
+        done += take;
+        position += static_cast<size_t>(take);
+    }
+    return value;
+}
+
+uint32_t BitReader::ReadVarUint() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 32; shift += 4) {
+        value |= Read(4) << shift;
+        if (!ReadBool()) return value;
+    }
+    overflowed = true;                        // more groups than a uint32 holds
+    return 0;
+}
+
+int32_t BitReader::ReadSigned(int bits) {
+    uint32_t value = Read(bits);
+    if (bits < 32 && (value & (1u << (bits - 1)))) value |= ~BitWriter::Mask(bits);
+    return static_cast<int32_t>(value);
+}
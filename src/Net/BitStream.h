@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Packs values of any width up to 32 bits back to back, least significant bit first. Snapshots are a few hundred
+// small fields, so byte-aligning each one would waste most of the packet.
+class BitWriter {
+public:
+    void Write(uint32_t value, int bits);
+    void WriteBool(bool value) { Write(value ? 1u : 0u, 1); }
+
+    // 4-bit groups each followed by a continue bit: small counts and id gaps cost 5 bits
+    void WriteVarUint(uint32_t value);
+
+    // Two's complement in bits; value must fit
+    void WriteSigned(int32_t value, int bits) { Write(static_cast<uint32_t>(value) & Mask(bits), bits); }
+
+    // Pads to a whole byte and returns the buffer
+    const std::vector<uint8_t> &Finish();
+
+    size_t BitCount() const { return bytes.size() * 8 + static_cast<size_t>(scratchBits); }
+    void Clear();
+
+    static uint32_t Mask(int bits) { return bits >= 32 ? 0xffffffffu : (1u << bits) - 1u; }
+
+private:
+    std::vector<uint8_t> bytes;
+    uint64_t scratch = 0;
+    int scratchBits = 0;
+};
+
+// Reads what BitWriter wrote. Reading past the end returns zeros and sets Overflowed(), so decoders can run to the
+// end of a truncated or hostile packet and reject it once instead of checking every field.
+class BitReader {
+public:
+    explicit BitReader(std::span<const uint8_t> data) : data(data) {}
+
+    uint32_t Read(int bits);
+    bool ReadBool() { return Read(1) != 0; }
+    uint32_t ReadVarUint();
+    int32_t ReadSigned(int bits);
+
+    bool Overflowed() const { return overflowed; }
+    size_t BitsLeft() const { return data.size() * 8 - position; }
+
+private:
+    std::span<const uint8_t> data;
+    size_t position = 0;
+    bool overflowed = false;
+};
@@ -0,0 +1,73 @@
+#include "ClientPrediction.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    bool Newer(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) > 0;
+    }
+}
+
+ClientPrediction::ClientPrediction(const StaticBvh &world, const Heightfield *terrain, const PredictionSettings &settings)
+    : character(world, terrain), settings(settings) {
+}
+
+void ClientPrediction::Reset(const CharacterState &state) {
+    character.SetState(state);
+    acknowledged = nextSequence - 1;
+}
+
+const PlayerCommand &ClientPrediction::Predict(PlayerCommand command, float dt) {
+    command.sequence = nextSequence++;
+
+    Entry &entry = At(command.sequence);
+    entry.command = QuantizeCommand(command);
+    entry.dt = dt;
+    character.Step(entry.command.input, dt);
+    entry.state = character.GetState();
+    stats.predicted++;
+    return entry.command;
+}
+
+void ClientPrediction::Reconcile(uint32_t sequence, const CharacterState &server) {
+    // Older than what was already checked (reordered snapshot), or from before the history
+    if (Newer(acknowledged, sequence) || !Newer(nextSequence, sequence) || nextSequence - sequence > HistorySize) {
+        stats.unmatched++;
+        return;
+    }
+    acknowledged = sequence;
+
+    Entry &entry = At(sequence);
+    const float error = glm::length(entry.state.feet - server.feet);
+    stats.reconciled++;
+    stats.lastError = error;
+    stats.maxError = std::max(stats.maxError, error);
+    stats.errorSum += error;
+
+    if (error <= settings.positionTolerance && glm::length(entry.state.velocity - server.velocity) <= settings.velocityTolerance &&
+        entry.state.stance == server.stance && entry.state.grounded == server.grounded) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    character.SetState(server);
+    entry.state = server;
+    for (uint32_t replay = sequence + 1; Newer(nextSequence, replay); replay++) {
+        Entry &later = At(replay);
+        character.Step(later.command.input, later.dt);
+        later.state = character.GetState();
+        stats.replayed++;
+    }
+    stats.corrections++;
+    stats.replayMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::span<const PlayerCommand> ClientPrediction::Unacknowledged() {
+    const uint32_t newest = nextSequence - 1;
+    const uint32_t count = std::min<uint32_t>({newest - acknowledged, static_cast<uint32_t>(MaxCommandsPerPacket), newest});
+
+    pending.clear();
+    for (uint32_t sequence = newest - count + 1; !Newer(sequence, newest); sequence++) pending.push_back(At(sequence).command);
+    return pending;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "PlayerCommand.h"
+#include "../Physics/CharacterController.h"
+
+struct PredictionSettings {
+    // The server reports the player unquantized, so these only absorb floating point differences between builds
+    float positionTolerance = 0.001f;         // metres
+    float velocityTolerance = 0.01f;          // m/s
+};
+
+// Client-side prediction of the local player. Predict() numbers each tick's input, quantizes it as the server will
+// decode it and steps a local copy of the character straight away, so movement answers the keys with no round trip;
+// the command and the state it led to are kept for HistorySize ticks. Reconcile() takes the newest command the server
+// says it applied and the player's state in that snapshot, and compares it with what was predicted for that command.
+// Within tolerance nothing happens. Past it (a command lost in every copy, a late one the server covered by repeating
+// input, or anything else the client could not know) the character is rewound to the server's state and every later
+// command is replayed on top, which lands it where the server will put it once those commands arrive.
+class ClientPrediction {
+public:
+    static constexpr size_t HistorySize = 128;
+
+    struct Stats {
+        size_t predicted = 0;
+        size_t reconciled = 0;                // server states checked against the history
+        size_t corrections = 0;
+        size_t replayed = 0;                  // commands stepped again after corrections
+        size_t unmatched = 0;                 // server states for commands no longer (or never) in the history
+        float lastError = 0.0f;               // metres between prediction and server at the last check
+        float maxError = 0.0f;
+        double errorSum = 0.0;
+        double replayMs = 0.0;                // total
+    };
+
+    ClientPrediction(const StaticBvh &world, const Heightfield *terrain = nullptr,
+                     const PredictionSettings &settings = PredictionSettings());
+
+    // Starts over from the server's state (spawn, respawn); commands already sent stay numbered
+    void Reset(const CharacterState &state);
+
+    // Numbers this tick's command and steps the local character with it. Returns the command as it goes to the server.
+    const PlayerCommand &Predict(PlayerCommand command, float dt);
+
+    // sequence is the newest command the server had applied when it took the snapshot, server the player's state in it
+    void Reconcile(uint32_t sequence, const CharacterState &server);
+
+    // Commands the server has not confirmed, oldest first and at most MaxCommandsPerPacket, for the next packet
+    std::span<const PlayerCommand> Unacknowledged();
+
+    const CharacterController &Character() const { return character; }
+    uint32_t LatestSequence() const { return nextSequence - 1; }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Entry {
+        PlayerCommand command;
+        CharacterState state;                 // after the command
+        float dt = 0.0f;
+    };
+
+    Entry &At(uint32_t sequence) { return history[sequence % HistorySize]; }
+
+    CharacterController character;
+    PredictionSettings settings;
+    std::array<Entry, HistorySize> history;
+    uint32_t nextSequence = 1;
+    uint32_t acknowledged = 0;                // newest command the server applied
+    std::vector<PlayerCommand> pending;
+
+    Stats stats;
+};
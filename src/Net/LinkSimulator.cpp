@@ -0,0 +1,47 @@
+#include "LinkSimulator.h"
+
+#include <algorithm>
+
+#include "Protocol.h"
+
+LinkSimulator::LinkSimulator(const NetAddress &server, const LinkConditions &conditions, uint32_t seed)
+    : server(server), conditions(conditions), rng(seed), receiveBuffer(MaxPacketSize) {
+}
+
+void LinkSimulator::Enqueue(std::span<const uint8_t> data, bool toServer, Clock::time_point now) {
+    if (std::uniform_real_distribution<double>(0.0, 100.0)(rng) < conditions.lossPercent) {
+        stats.dropped++;
+        return;
+    }
+    const double delayMs = conditions.latencyMs + std::uniform_real_distribution<double>(0.0, conditions.jitterMs)(rng);
+    const Clock::time_point due = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(delayMs));
+
+    // Kept in delivery order
+    auto at = std::upper_bound(queue.begin(), queue.end(), due, [](Clock::time_point t, const Delayed &d) { return t < d.due; });
+    queue.insert(at, {due, toServer, std::vector<uint8_t>(data.begin(), data.end())});
+}
+
+void LinkSimulator::Pump() {
+    const Clock::time_point now = Clock::now();
+
+    NetAddress from;
+    while (size_t size = front.Receive(from, receiveBuffer)) {
+        client = from;
+        hasClient = true;
+        Enqueue(std::span<const uint8_t>(receiveBuffer.data(), size), true, now);
+    }
+    while (size_t size = back.Receive(from, receiveBuffer)) {
+        if (from == server && hasClient) Enqueue(std::span<const uint8_t>(receiveBuffer.data(), size), false, now);
+    }
+
+    size_t sent = 0;
+    for (; sent < queue.size() && queue[sent].due <= now; sent++) {
+        if (queue[sent].toServer) {
+            back.Send(server, queue[sent].bytes);
+        } else {
+            front.Send(client, queue[sent].bytes);
+        }
+    }
+    queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(sent));
+    stats.forwarded += sent;
+}
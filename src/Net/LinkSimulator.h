@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "UdpSocket.h"
+
+struct LinkConditions {
+    double latencyMs = 50.0;                  // one way
+    double jitterMs = 10.0;                   // each datagram is delayed a further 0..jitterMs, so some overtake others
+    double lossPercent = 1.0;                 // each way
+};
+
+// A bad network on loopback, for testing: a UDP relay between one client and a server that delays, jitters and drops
+// datagrams in both directions. The client talks to Address() as if it were the server; the server sees the relay.
+class LinkSimulator {
+public:
+    struct Stats {
+        size_t forwarded = 0;
+        size_t dropped = 0;
+    };
+
+    LinkSimulator(const NetAddress &server, const LinkConditions &conditions, uint32_t seed = 1);
+
+    NetAddress Address() const { return NetAddress::Loopback(front.Port()); }
+
+    // Takes in whatever arrived and sends on whatever is due; call every millisecond or so
+    void Pump();
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Delayed {
+        Clock::time_point due;
+        bool toServer = false;
+        std::vector<uint8_t> bytes;
+    };
+
+    void Enqueue(std::span<const uint8_t> data, bool toServer, Clock::time_point now);
+
+    NetAddress server;
+    NetAddress client;
+    bool hasClient = false;
+    LinkConditions conditions;
+    UdpSocket front;                          // faces the client
+    UdpSocket back;                           // faces the server
+    std::mt19937 rng;
+
+    std::vector<Delayed> queue;
+    std::vector<uint8_t> receiveBuffer;
+
+    Stats stats;
+};
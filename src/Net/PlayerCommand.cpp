@@ -0,0 +1,91 @@
+#include "PlayerCommand.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Protocol.h"
+
+namespace {
+    constexpr int MoveBits = 8;
+    constexpr float MoveScale = 127.0f;
+    constexpr int AimBits = 16;
+    constexpr int StanceBits = 2;
+    constexpr int CountBits = 4;
+
+    int32_t QuantizeMove(float value) {
+        return static_cast<int32_t>(std::round(std::clamp(value, -1.0f, 1.0f) * MoveScale));
+    }
+
+    uint32_t QuantizeYaw(float degrees) {
+        const float turn = std::fmod(degrees, 360.0f) / 360.0f;
+        return static_cast<uint32_t>(std::round((turn < 0.0f ? turn + 1.0f : turn) * (1 << AimBits))) & BitWriter::Mask(AimBits);
+    }
+
+    uint32_t QuantizePitch(float degrees) {
+        return static_cast<uint32_t>(std::round((std::clamp(degrees, -90.0f, 90.0f) + 90.0f) / 180.0f * BitWriter::Mask(AimBits)));
+    }
+
+    void WriteCommand(BitWriter &out, const PlayerCommand &command) {
+        out.WriteSigned(QuantizeMove(command.input.move.x), MoveBits);
+        out.WriteSigned(QuantizeMove(command.input.move.z), MoveBits);
+        out.WriteBool(command.input.jump);
+        out.Write(static_cast<uint32_t>(command.input.stance), StanceBits);
+        out.WriteBool(command.fire);
+        if (command.fire) out.Write(command.viewTick, 32);
+        out.Write(QuantizeYaw(command.aim.x), AimBits);
+        out.Write(QuantizePitch(command.aim.y), AimBits);
+    }
+
+    PlayerCommand ReadCommand(BitReader &in) {
+        PlayerCommand command;
+        command.input.move.x = static_cast<float>(in.ReadSigned(MoveBits)) / MoveScale;
+        command.input.move.z = static_cast<float>(in.ReadSigned(MoveBits)) / MoveScale;
+        command.input.jump = in.ReadBool();
+        command.input.stance = static_cast<Stance>(std::min(in.Read(StanceBits), static_cast<uint32_t>(Stance::Prone)));
+        command.fire = in.ReadBool();
+        if (command.fire) command.viewTick = in.Read(32);
+        command.aim.x = static_cast<float>(in.Read(AimBits)) * (360.0f / (1 << AimBits));
+        command.aim.y = static_cast<float>(in.Read(AimBits)) * (180.0f / static_cast<float>(BitWriter::Mask(AimBits))) - 90.0f;
+        return command;
+    }
+}
+
+PlayerCommand QuantizeCommand(const PlayerCommand &command) {
+    BitWriter out;
+    WriteCommand(out, command);
+    BitReader in(out.Finish());
+    PlayerCommand quantized = ReadCommand(in);
+    quantized.sequence = command.sequence;
+    return quantized;
+}
+
+void BuildCommandPacket(std::span<const PlayerCommand> commands, BitWriter &writer, std::vector<uint8_t> &packet) {
+    const size_t count = std::min(commands.size(), MaxCommandsPerPacket);
+    packet.clear();
+    WritePacketHeader(packet, PacketType::Commands);
+    WriteU32(packet, count > 0 ? commands.back().sequence : 0);
+
+    // Newest first, so a reader that only wants the latest can stop after one
+    writer.Clear();
+    writer.Write(static_cast<uint32_t>(count), CountBits);
+    for (size_t i = 0; i < count; i++) WriteCommand(writer, commands[commands.size() - 1 - i]);
+    const std::vector<uint8_t> &bits = writer.Finish();
+    packet.insert(packet.end(), bits.begin(), bits.end());
+}
+
+bool ReadCommandPacket(std::span<const uint8_t> packet, std::vector<PlayerCommand> &commands) {
+    commands.clear();
+    if (packet.size() < PacketHeaderSize + 4) return false;
+    const uint32_t newest = ReadU32(packet.subspan(PacketHeaderSize));
+
+    BitReader in(packet.subspan(PacketHeaderSize + 4));
+    const uint32_t count = in.Read(CountBits);
+    for (uint32_t i = 0; i < count; i++) {
+        commands.push_back(ReadCommand(in));
+        commands.back().sequence = newest - i;
+    }
+    if (in.Overflowed()) return false;
+
+    std::reverse(commands.begin(), commands.end());
+    return true;
+}
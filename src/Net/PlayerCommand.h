@@ -0,0 +1,31 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitStream.h"
+#include "../Physics/CharacterController.h"
+
+// One tick of one player's input, numbered by the client. The client predicts with each command exactly as the server
+// will decode it (QuantizeCommand), so from the same starting state both ends step the same movement.
+struct PlayerCommand {
+    uint32_t sequence = 0;
+    CharacterInput input;
+    glm::vec2 aim = glm::vec2(0.0f);          // yaw, pitch in degrees
+    bool fire = false;
+    uint32_t viewTick = 0;                    // with fire: the snapshot on screen, for lag compensation
+};
+
+// Rounds move and aim to what survives the wire
+PlayerCommand QuantizeCommand(const PlayerCommand &command);
+
+// Every Commands packet repeats the last few commands, so losing a datagram now and then loses no input
+constexpr size_t MaxCommandsPerPacket = 15;
+
+// commands must have consecutive sequence numbers, oldest first; only the newest MaxCommandsPerPacket are sent
+void BuildCommandPacket(std::span<const PlayerCommand> commands, BitWriter &writer, std::vector<uint8_t> &packet);
+
+// Takes a Commands datagram (header included) and returns its commands oldest first; false when malformed
+bool ReadCommandPacket(std::span<const uint8_t> packet, std::vector<PlayerCommand> &commands);
@@ -0,0 +1,110 @@
+#include "Protocol.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // Tick order that survives wrapping
+    bool Newer(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) > 0;
+    }
+}
+
+void WritePacketHeader(std::vector<uint8_t> &packet, PacketType type) {
+    WriteU32(packet, ProtocolId);
+    packet.push_back(static_cast<uint8_t>(type));
+}
+
+bool ReadPacketHeader(std::span<const uint8_t> packet, PacketType &type) {
+    if (packet.size() < PacketHeaderSize || ReadU32(packet) != ProtocolId) return false;
+    if (packet[4] > static_cast<uint8_t>(PacketType::Commands)) return false;
+    type = static_cast<PacketType>(packet[4]);
+    return true;
+}
+
+void WriteU32(std::vector<uint8_t> &packet, uint32_t value) {
+    for (int i = 0; i < 4; i++) packet.push_back(static_cast<uint8_t>(value >> (i * 8)));
+}
+
+uint32_t ReadU32(std::span<const uint8_t> bytes) {
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 |
+           static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+bool BuildSnapshotFragments(uint32_t tick, std::span<const uint8_t> payload, std::vector<std::vector<uint8_t>> &packets) {
+    const size_t count = std::max<size_t>(1, (payload.size() + MaxFragmentPayload - 1) / MaxFragmentPayload);
+    if (count > MaxFragments) return false;
+
+    packets.resize(count);
+    for (size_t index = 0; index < count; index++) {
+        std::vector<uint8_t> &packet = packets[index];
+        packet.clear();
+        WritePacketHeader(packet, PacketType::SnapshotFragment);
+        WriteU32(packet, tick);
+        packet.push_back(static_cast<uint8_t>(index));
+        packet.push_back(static_cast<uint8_t>(count));
+
+        std::span<const uint8_t> part = payload.subspan(index * MaxFragmentPayload);
+        part = part.first(std::min(part.size(), MaxFragmentPayload));
+        packet.insert(packet.end(), part.begin(), part.end());
+    }
+    return true;
+}
+
+bool FragmentAssembler::Add(std::span<const uint8_t> packet) {
+    if (packet.size() < FragmentHeaderSize) return false;
+
+    const uint32_t tick = ReadU32(packet.subspan(PacketHeaderSize));
+    const uint8_t index = packet[PacketHeaderSize + 4], count = packet[PacketHeaderSize + 5];
+    std::span<const uint8_t> part = packet.subspan(FragmentHeaderSize);
+
+    if (count == 0 || index >= count || part.size() > MaxFragmentPayload) return false;
+    if (index + 1 < count && part.size() != MaxFragmentPayload) return false;
+    if (anyCompleted && !Newer(tick, completedTick)) return false;
+
+    Slot *slot = nullptr;
+    for (Slot &s: slots) {
+        if (s.used && s.tick == tick) slot = &s;
+    }
+
+    if (!slot) {
+        // A free slot, or else give up on the oldest snapshot still being assembled
+        for (Slot &s: slots) {
+            if (!s.used) {
+                slot = &s;
+                break;
+            }
+            if (!slot || Newer(slot->tick, s.tick)) slot = &s;
+        }
+        if (slot->used) dropped++;
+
+        slot->used = true;
+        slot->tick = tick;
+        slot->count = count;
+        slot->received = 0;
+        slot->lastSize = 0;
+        slot->present.assign(count, 0);
+        slot->bytes.resize(count * MaxFragmentPayload);
+    }
+
+    if (slot->count != count || slot->present[index]) return false;
+
+    std::memcpy(slot->bytes.data() + index * MaxFragmentPayload, part.data(), part.size());
+    slot->present[index] = 1;
+    slot->received++;
+    if (index + 1 == count) slot->lastSize = part.size();
+    if (slot->received < count) return false;
+
+    completed.assign(slot->bytes.begin(), slot->bytes.begin() + static_cast<std::ptrdiff_t>((count - 1) * MaxFragmentPayload + slot->lastSize));
+    completedTick = tick;
+    anyCompleted = true;
+    slot->used = false;
+
+    for (Slot &s: slots) {
+        if (s.used && !Newer(s.tick, completedTick)) {
+            s.used = false;
+            dropped++;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Every datagram starts with the protocol id and a packet type; anything else on the port is dropped unread
+constexpr uint32_t ProtocolId = 0x314d4c4d;  // "MLM1"
+constexpr size_t PacketHeaderSize = 5;
+
+// Below the common internet path MTU with room for IP and UDP headers, so snapshots are never fragmented by IP
+constexpr size_t MaxPacketSize = 1200;
+
+enum class PacketType : uint8_t {
+    Connect,                                  // client -> server, resent until accepted
+    Accept,                                   // server -> client: u32 player id
+    Disconnect,                               // either way
+    Ack,                                      // client -> server: u32 newest snapshot tick decoded
+    SnapshotFragment,                         // server -> client: u32 tick, u8 index, u8 count, payload
+    Commands,                                 // client -> server: u32 newest sequence, then the commands (PlayerCommand.h)
+};
+
+constexpr size_t FragmentHeaderSize = PacketHeaderSize + 6;
+constexpr size_t MaxFragmentPayload = MaxPacketSize - FragmentHeaderSize;
+constexpr size_t MaxFragments = 255;
+
+void WritePacketHeader(std::vector<uint8_t> &packet, PacketType type);
+
+// False when the datagram is not ours
+bool ReadPacketHeader(std::span<const uint8_t> packet, PacketType &type);
+
+void WriteU32(std::vector<uint8_t> &packet, uint32_t value);
+uint32_t ReadU32(std::span<const uint8_t> bytes);
+
+// Splits an encoded snapshot into SnapshotFragment datagrams. Returns false when it needs more than MaxFragments.
+bool BuildSnapshotFragments(uint32_t tick, std::span<const uint8_t> payload, std::vector<std::vector<uint8_t>> &packets);
+
+// Reassembles snapshots on the client. Fragments of a few snapshots can be in flight at once and arrive in any order;
+// a snapshot older than the newest completed one is dropped, since it can never become the latest state.
+class FragmentAssembler {
+public:
+    static constexpr size_t Slots = 4;
+
+    // Takes a SnapshotFragment datagram (header included). Returns true once it completes its snapshot, which is then
+    // in Payload() until the next call.
+    bool Add(std::span<const uint8_t> packet);
+
+    uint32_t CompletedTick() const { return completedTick; }
+    std::span<const uint8_t> Payload() const { return completed; }
+
+    size_t Dropped() const { return dropped; }
+
+private:
+    struct Slot {
+        bool used = false;
+        uint32_t tick = 0;
+        uint8_t count = 0;
+        uint8_t received = 0;
+        size_t lastSize = 0;                  // every fragment but the last is MaxFragmentPayload
+        std::vector<uint8_t> present;
+        std::vector<uint8_t> bytes;
+    };
+
+    Slot slots[Slots];
+    std::vector<uint8_t> completed;
+    uint32_t completedTick = 0;
+    bool anyCompleted = false;
+    size_t dropped = 0;                       // snapshots abandoned part way
+};
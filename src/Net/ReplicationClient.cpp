@@ -0,0 +1,101 @@
+#include "ReplicationClient.h"
+
+#include <algorithm>
+
+namespace {
+    // Connect is resent this often until the server answers
+    constexpr std::chrono::milliseconds ConnectRetry(250);
+}
+
+ReplicationClient::ReplicationClient(const NetAddress &server) : server(server), receiveBuffer(MaxPacketSize) {
+}
+
+ReplicationClient::~ReplicationClient() {
+    if (connected) SendSimple(PacketType::Disconnect);
+}
+
+void ReplicationClient::SendSimple(PacketType type, const uint32_t *value) {
+    packet.clear();
+    WritePacketHeader(packet, type);
+    if (value) WriteU32(packet, *value);
+    socket.Send(server, packet);
+}
+
+void ReplicationClient::SendCommands(std::span<const PlayerCommand> commands) {
+    if (!connected || commands.empty()) return;
+    BuildCommandPacket(commands, writer, packet);
+    socket.Send(server, packet);
+}
+
+const NetEntityState *ReplicationClient::LatestEntity(uint32_t id) const {
+    const std::vector<NetEntityState> &states = Latest();
+    auto found = std::lower_bound(states.begin(), states.end(), id, [](const NetEntityState &s, uint32_t value) { return s.id < value; });
+    return found != states.end() && found->id == id ? &*found : nullptr;
+}
+
+void ReplicationClient::Update() {
+    const Clock::time_point now = Clock::now();
+    if (!connected && now - lastConnect >= ConnectRetry) {
+        SendSimple(PacketType::Connect);
+        lastConnect = now;
+    }
+
+    NetAddress from;
+    while (size_t size = socket.Receive(from, receiveBuffer)) {
+        std::span<const uint8_t> data(receiveBuffer.data(), size);
+        PacketType type;
+        if (!(from == server) || !ReadPacketHeader(data, type)) continue;
+
+        stats.packets++;
+        stats.bytes += size;
+
+        if (type == PacketType::Accept && size >= PacketHeaderSize + 4) {
+            connected = true;
+            player = ReadU32(data.subspan(PacketHeaderSize));
+        } else if (type == PacketType::SnapshotFragment && connected) {
+            if (assembler.Add(data)) HandleSnapshot(assembler.Payload());
+        } else if (type == PacketType::Disconnect) {
+            connected = false;
+        }
+    }
+
+    stats.abandoned = assembler.Dropped();
+}
+
+void ReplicationClient::HandleSnapshot(std::span<const uint8_t> payload) {
+    BitReader in(payload);
+    SnapshotHeader header;
+    if (!ReadSnapshotHeader(in, header)) {
+        stats.malformed++;
+        return;
+    }
+
+    const Received *baseline = nullptr;
+    if (header.delta) {
+        for (const Received &received: history) {
+            if (received.valid && received.tick == header.baselineTick) baseline = &received;
+        }
+        if (!baseline) {
+            stats.missingBaseline++;
+            return;
+        }
+    }
+
+    // Decoded aside first: the slot about to be reused may hold the baseline
+    if (!DecodeSnapshot(in, baseline ? &baseline->states : nullptr, decoded)) {
+        stats.malformed++;
+        return;
+    }
+
+    latestSlot = nextSlot++ % HistorySize;
+    Received &slot = history[latestSlot];
+    slot.states.swap(decoded);
+    slot.tick = header.tick;
+    slot.valid = true;
+    latestTick = header.tick;
+    latestHeader = header;
+    hasLatest = true;
+    stats.snapshots++;
+
+    SendSimple(PacketType::Ack, &header.tick);
+}
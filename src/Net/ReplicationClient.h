@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "PlayerCommand.h"
+#include "Protocol.h"
+#include "Snapshot.h"
+#include "UdpSocket.h"
+
+// Client end of world replication. Update() resends Connect until the server accepts, then reassembles snapshot
+// fragments, decodes each complete snapshot against the baseline it names and acks it straight away. Decoded
+// snapshots are kept for MaxBaselineAge ticks so whichever one the server picks as a baseline is still here.
+class ReplicationClient {
+public:
+    struct Stats {
+        size_t snapshots = 0;                 // decoded since connecting
+        size_t packets = 0;
+        size_t bytes = 0;                     // UDP payload received
+        size_t missingBaseline = 0;           // snapshots dropped because their baseline was already gone
+        size_t malformed = 0;
+        size_t abandoned = 0;                 // snapshots never completed (fragment lost or overtaken)
+    };
+
+    explicit ReplicationClient(const NetAddress &server);
+    ~ReplicationClient();
+
+    void Update();
+
+    bool IsConnected() const { return connected; }
+    uint32_t PlayerId() const { return player; }
+
+    // Newest decoded snapshot, entities sorted by id; empty until the first arrives
+    bool HasSnapshot() const { return hasLatest; }
+    uint32_t LatestTick() const { return latestTick; }
+    const std::vector<NetEntityState> &Latest() const { return history[latestSlot].states; }
+    const NetEntityState *LatestEntity(uint32_t id) const;
+
+    // Newest of this client's commands the server had applied by the latest snapshot, and where it left our player
+    bool HasCommandAck() const { return hasLatest && latestHeader.hasCommand; }
+    uint32_t LastCommand() const { return latestHeader.lastCommand; }
+    const CharacterState &CommandState() const { return latestHeader.commandState; }
+
+    // One Commands packet per tick, carrying every command not yet acknowledged (ClientPrediction::Unacknowledged)
+    void SendCommands(std::span<const PlayerCommand> commands);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t HistorySize = 64;
+
+    struct Received {
+        uint32_t tick = 0;
+        bool valid = false;
+        std::vector<NetEntityState> states;
+    };
+
+    void HandleSnapshot(std::span<const uint8_t> payload);
+    void SendSimple(PacketType type, const uint32_t *value = nullptr);
+
+    NetAddress server;
+    UdpSocket socket;
+    bool connected = false;
+    uint32_t player = 0;
+    Clock::time_point lastConnect;
+
+    std::array<Received, HistorySize> history;   // in arrival order, overwriting the oldest
+    size_t nextSlot = 0;
+    size_t latestSlot = 0;
+    uint32_t latestTick = 0;
+    SnapshotHeader latestHeader;
+    bool hasLatest = false;
+
+    FragmentAssembler assembler;
+    std::vector<NetEntityState> decoded;
+    std::vector<uint8_t> receiveBuffer;
+    std::vector<uint8_t> packet;
+    BitWriter writer;
+
+    Stats stats;
+};
@@ -0,0 +1,348 @@
+#include "ReplicationServer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Sent entities stay relevant this much past the range, so one pacing the edge is not added and removed in turn
+    constexpr float RangeHysteresis = 1.1f;
+
+    // Sequence order that survives wrapping
+    bool Newer(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) > 0;
+    }
+
+    PerceptionSettings InterestPerception(const ReplicationSettings &settings) {
+        PerceptionSettings perception;
+        perception.maxRange = settings.relevancyRange * RangeHysteresis;
+        return perception;
+    }
+
+    const NetEntityState *FindEntity(const std::vector<NetEntityState> *states, uint32_t id) {
+        if (!states) return nullptr;
+        auto found = std::lower_bound(states->begin(), states->end(), id, [](const NetEntityState &s, uint32_t v) { return s.id < v; });
+        return found != states->end() && found->id == id ? &*found : nullptr;
+    }
+}
+
+ReplicationServer::ReplicationServer(Simulation &sim, const ReplicationSettings &settings, JobSystem *jobs)
+    : sim(sim), settings(settings), jobs(jobs), socket(settings.port, 4 << 20),
+      // A range query covers a few cells each way; cells as tall as they are wide, since the range dwarfs any relief
+      grid(settings.relevancyRange / 4.0f, settings.relevancyRange / 4.0f, 1u << 12),
+      perception(sim.World(), &sim.Terrain(), InterestPerception(settings)), receiveBuffer(MaxPacketSize) {
+}
+
+ReplicationServer::Client *ReplicationServer::Find(const NetAddress &address) {
+    for (Client &client: clients) {
+        if (client.address == address) return &client;
+    }
+    return nullptr;
+}
+
+void ReplicationServer::SendAccept(const Client &client) {
+    packet.clear();
+    WritePacketHeader(packet, PacketType::Accept);
+    WriteU32(packet, client.player);
+    socket.Send(client.address, packet);
+}
+
+void ReplicationServer::Drop(size_t index) {
+    perception.Forget(clients[index].player);
+    sim.RemovePlayer(clients[index].player);
+    clients.erase(clients.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+void ReplicationServer::BufferCommand(Client &client, const PlayerCommand &command) {
+    if (!client.receivedCommands) {
+        client.receivedCommands = true;
+        client.lastCommand = command.sequence - 1;
+        client.newestCommand = command.sequence;
+    }
+    // Redundant copies of commands already applied; a client far ahead is trimmed by the backlog limit
+    if (!Newer(command.sequence, client.lastCommand)) return;
+
+    client.commands[command.sequence % CommandBufferSize] = {true, command};
+    if (Newer(command.sequence, client.newestCommand)) client.newestCommand = command.sequence;
+}
+
+void ReplicationServer::ApplyCommands() {
+    for (Client &client: clients) {
+        if (!client.receivedCommands) continue;
+
+        const uint32_t backlog = client.newestCommand - client.lastCommand;
+        if (backlog > settings.commandBacklog) {
+            client.lastCommand += backlog - settings.commandBacklog;
+            stats.commandsDropped += backlog - settings.commandBacklog;
+        }
+
+        // Everything in a gap was in the same packets as the commands after it, so a gap is never filled later
+        const PlayerCommand *next = nullptr;
+        for (uint32_t sequence = client.lastCommand + 1; !Newer(sequence, client.newestCommand); sequence++) {
+            const BufferedCommand &slot = client.commands[sequence % CommandBufferSize];
+            if (slot.valid && slot.command.sequence == sequence) {
+                next = &slot.command;
+                break;
+            }
+        }
+
+        if (!next) {
+            client.heldInput.jump = false;
+            sim.SetInput(client.player, client.heldInput);
+            stats.commandsMissing++;
+            continue;
+        }
+
+        stats.commandsDropped += next->sequence - client.lastCommand - 1;
+        client.lastCommand = next->sequence;
+        client.appliedCommand = true;
+        client.heldInput = next->input;
+        sim.SetInput(client.player, next->input);
+        sim.SetAim(client.player, next->aim);
+        if (next->fire) {
+            // The shooter saw the world at viewTick; rounds are checked against hitboxes from then
+            const int32_t behind = static_cast<int32_t>(static_cast<uint32_t>(sim.Tick()) + 1 - next->viewTick);
+            sim.Fire(client.player, AimDirection(sim.Aim(client.player)), static_cast<float>(behind));
+        }
+        stats.commandsApplied++;
+    }
+}
+
+void ReplicationServer::Receive() {
+    const Clock::time_point now = Clock::now();
+
+    NetAddress from;
+    while (size_t size = socket.Receive(from, receiveBuffer)) {
+        std::span<const uint8_t> data(receiveBuffer.data(), size);
+        PacketType type;
+        if (!ReadPacketHeader(data, type)) continue;
+
+        Client *client = Find(from);
+        if (type == PacketType::Connect) {
+            if (!client) {
+                if (clients.size() >= settings.maxClients) continue;
+                client = &clients.emplace_back();
+                client->address = from;
+                client->player = sim.AddPlayer(sim.SpawnPoint(static_cast<uint32_t>(sim.GetStats().players)));
+            }
+            // Also answers a repeated Connect whose Accept was lost
+            client->lastHeard = now;
+            SendAccept(*client);
+        } else if (client && type == PacketType::Ack && size >= PacketHeaderSize + 4) {
+            // Only acks for snapshots that were actually sent, and only forward
+            const uint32_t tick = ReadU32(data.subspan(PacketHeaderSize));
+            const uint32_t age = static_cast<uint32_t>(sim.Tick()) - tick;
+            if (age <= MaxBaselineAge && (!client->acked || static_cast<int32_t>(tick - client->ackedTick) > 0)) {
+                client->acked = true;
+                client->ackedTick = tick;
+            }
+            client->lastHeard = now;
+        } else if (client && type == PacketType::Commands) {
+            if (!ReadCommandPacket(data, receivedCommands)) continue;
+            for (const PlayerCommand &command: receivedCommands) BufferCommand(*client, command);
+            client->lastHeard = now;
+        } else if (client && type == PacketType::Disconnect) {
+            Drop(static_cast<size_t>(client - clients.data()));
+        }
+    }
+
+    for (size_t i = clients.size(); i-- > 0;) {
+        if (std::chrono::duration<double>(now - clients[i].lastHeard).count() > settings.timeoutSeconds) Drop(i);
+    }
+
+    if (sim.Tick() != commandsTick) {
+        ApplyCommands();
+        commandsTick = sim.Tick();
+    }
+
+    stats.clients = clients.size();
+    stats.receiveMs = std::chrono::duration<double, std::milli>(Clock::now() - now).count();
+}
+
+const ReplicationServer::Sent *ReplicationServer::Baseline(const Client &client, uint32_t tick) const {
+    if (!client.acked) return nullptr;
+
+    const uint32_t age = tick - client.ackedTick;
+    if (age == 0 || age > MaxBaselineAge || age >= HistorySize * settings.snapshotInterval) return nullptr;
+
+    const Sent &sent = client.history[(client.ackedTick / settings.snapshotInterval) % HistorySize];
+    return sent.valid && sent.tick == client.ackedTick ? &sent : nullptr;
+}
+
+void ReplicationServer::GatherCandidates(Client &client) {
+    client.interest.resize(sim.PlayerSlots());
+    client.candidates.clear();
+
+    const float range = settings.relevancyRange;
+    const glm::vec3 center = sim.Player(client.player).Position();
+    grid.QuerySphere(center, range * RangeHysteresis, client.candidates);
+
+    // New entities must be inside the range; ones the client already has may stay out to the hysteresis margin
+    size_t kept = 0;
+    for (uint32_t index: client.candidates) {
+        const glm::vec3 d = positions[index] - center;
+        if (d.x * d.x + d.y * d.y + d.z * d.z <= range * range || client.interest[world[index].id].known) {
+            client.candidates[kept++] = index;
+        }
+    }
+    client.candidates.resize(kept);
+    client.visibility.assign(kept, Visibility::Visible);
+}
+
+void ReplicationServer::BuildSnapshot(Client &client, uint32_t tick) {
+    const Sent *baseline = Baseline(client, tick);
+    const std::vector<NetEntityState> *base = baseline ? &baseline->states : nullptr;
+    const glm::vec3 center = sim.Player(client.player).Position();
+
+    // Everything in range waits a little longer; entities the client already has are charged for what their
+    // carried state costs against the baseline whether or not they are refreshed
+    const int64_t budget = static_cast<int64_t>(settings.snapshotBudget * 8);
+    int64_t used = 0;
+    client.order.clear();
+    for (size_t k = 0; k < client.candidates.size(); k++) {
+        const NetEntityState &fresh = world[client.candidates[k]];
+        Interest &interest = client.interest[fresh.id];
+        interest.seen = snapshotCount;
+
+        if (fresh.id == client.player) {
+            interest.priority = INFINITY;
+        } else {
+            const glm::vec3 d = positions[client.candidates[k]] - center;
+            const float distance = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+            float rate = settings.priorityDistance / std::max(distance, settings.priorityDistance);
+            if (client.visibility[k] == Visibility::Hidden) rate *= settings.occludedPriority;
+            interest.priority += rate;
+        }
+
+        if (interest.known) used += static_cast<int64_t>(EntityUpdateBits(FindEntity(base, fresh.id), interest.sent));
+        if (!interest.known || interest.sent != fresh) client.order.push_back(static_cast<uint32_t>(k));
+    }
+
+    std::sort(client.order.begin(), client.order.end(), [&](uint32_t a, uint32_t b) {
+        return client.interest[world[client.candidates[a]].id].priority > client.interest[world[client.candidates[b]].id].priority;
+    });
+
+    // Most overdue first; one that does not fit is skipped, so smaller updates further down can still go
+    client.considered = client.candidates.size();
+    client.updated = client.deferred = 0;
+    for (uint32_t k: client.order) {
+        const NetEntityState &fresh = world[client.candidates[k]];
+        Interest &interest = client.interest[fresh.id];
+        const NetEntityState *from = FindEntity(base, fresh.id);
+        const int64_t cost = static_cast<int64_t>(EntityUpdateBits(from, fresh)) -
+                             (interest.known ? static_cast<int64_t>(EntityUpdateBits(from, interest.sent)) : 0);
+        if (used + cost > budget && fresh.id != client.player) {
+            client.deferred++;
+            continue;
+        }
+        used += cost;
+        interest.known = true;
+        interest.sent = fresh;
+        interest.priority = 0.0f;
+        client.updated++;
+    }
+
+    // Whatever the last view held that is out of range or gone is removed, and starts over if it comes back
+    for (const NetEntityState &s: client.view) {
+        Interest &interest = client.interest[s.id];
+        if (interest.seen != snapshotCount) interest = Interest();
+    }
+
+    client.view.clear();
+    for (uint32_t index: client.candidates) {
+        const Interest &interest = client.interest[world[index].id];
+        if (interest.known) client.view.push_back(interest.sent);
+    }
+    std::sort(client.view.begin(), client.view.end(), [](const NetEntityState &a, const NetEntityState &b) { return a.id < b.id; });
+
+    SnapshotHeader header;
+    header.tick = tick;
+    header.delta = baseline != nullptr;
+    header.baselineTick = baseline ? baseline->tick : 0;
+    header.hasCommand = client.appliedCommand;
+    header.lastCommand = client.lastCommand;
+    header.commandState = sim.Player(client.player).GetState();
+
+    client.writer.Clear();
+    EncodeSnapshot(header, base, client.view, client.writer);
+    client.full = baseline == nullptr;
+    client.fits = BuildSnapshotFragments(tick, client.writer.Finish(), client.fragments);
+
+    Sent &sent = client.history[(tick / settings.snapshotInterval) % HistorySize];
+    sent.tick = tick;
+    sent.valid = true;
+    sent.states = client.view;
+}
+
+void ReplicationServer::Send() {
+    stats.snapshots = stats.fullSnapshots = stats.packets = stats.bytes = 0;
+    stats.considered = stats.updated = stats.deferred = 0;
+    stats.interestMs = stats.encodeMs = stats.sendMs = 0.0;
+    if (sim.Tick() % settings.snapshotInterval != 0) return;
+
+    Clock::time_point start = Clock::now();
+    const uint32_t tick = static_cast<uint32_t>(sim.Tick());
+    snapshotCount++;
+
+    world.clear();
+    positions.clear();
+    eyes.clear();
+    for (uint32_t id = 0; id < sim.PlayerSlots(); id++) {
+        if (!sim.IsPlayer(id)) continue;
+        const CharacterController &player = sim.Player(id);
+        world.push_back(QuantizeEntity(id, player.Position(), player.Velocity(), sim.Aim(id), player.GetStance(), player.IsGrounded()));
+        positions.push_back(player.Position());
+        eyes.push_back(player.EyePosition());
+    }
+    grid.Build(positions, {}, jobs);
+
+    auto gather = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) GatherCandidates(clients[i]);
+    };
+    if (jobs) {
+        jobs->ParallelFor(clients.size(), 4, gather);
+    } else {
+        gather(0, clients.size());
+    }
+
+    // Cached line of sight from each player's eye to everyone in its range; stale pairs are recast within budget
+    for (Client &client: clients) {
+        const glm::vec3 eye = sim.Player(client.player).EyePosition();
+        for (size_t k = 0; k < client.candidates.size(); k++) {
+            const uint32_t index = client.candidates[k];
+            if (world[index].id == client.player) continue;
+            client.visibility[k] = perception.Query(client.player, eye, world[index].id, eyes[index]).visibility;
+        }
+    }
+    perception.Update(static_cast<double>(sim.Tick()) / Simulation::TickRate, jobs);
+    stats.interestMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    auto build = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) BuildSnapshot(clients[i], tick);
+    };
+    if (jobs) {
+        jobs->ParallelFor(clients.size(), 1, build);
+    } else {
+        build(0, clients.size());
+    }
+
+    Clock::time_point sendStart = Clock::now();
+    for (Client &client: clients) {
+        stats.considered += client.considered;
+        stats.updated += client.updated;
+        stats.deferred += client.deferred;
+        if (!client.fits) continue;
+
+        for (const std::vector<uint8_t> &fragment: client.fragments) {
+            socket.Send(client.address, fragment);
+            stats.bytes += fragment.size();
+        }
+        stats.packets += client.fragments.size();
+        stats.snapshots++;
+        stats.fullSnapshots += client.full ? 1 : 0;
+    }
+    stats.sendMs = std::chrono::duration<double, std::milli>(Clock::now() - sendStart).count();
+
+    // Choosing every client's updates and encoding its delta; the rest was interest and the socket
+    stats.encodeMs = std::chrono::duration<double, std::milli>(sendStart - start).count() - stats.interestMs;
+    stats.totalBytes += stats.bytes;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "PlayerCommand.h"
+#include "Protocol.h"
+#include "Snapshot.h"
+#include "UdpSocket.h"
+#include "../AI/PerceptionSystem.h"
+#include "../Core/JobSystem.h"
+#include "../Game/Simulation.h"
+#include "../Physics/SpatialHash.h"
+
+struct ReplicationSettings {
+    uint16_t port = 27015;
+    uint32_t snapshotInterval = 2;            // ticks between snapshots: 30 Hz at the 60 Hz tick
+    size_t maxClients = 100;
+    double timeoutSeconds = 5.0;
+    uint32_t commandBacklog = 4;              // ticks of a client's input queued before the oldest are dropped
+    float relevancyRange = 500.0f;            // entities further from a client's player are not replicated to it
+    float priorityDistance = 20.0f;           // entities this close gain update priority at the full rate
+    float occludedPriority = 0.25f;           // rate for entities the client's player cannot see
+    size_t snapshotBudget = 1000;             // bytes of entity updates per client per snapshot
+};
+
+// Server end of world replication. Receive() drains the socket: a Connect from a new address spawns a player for it,
+// Acks move that client's baseline forward, and clients silent for the timeout are dropped with their player.
+// Commands are buffered per client by sequence, and the first Receive() of each tick applies every client's next one
+// to its player: a command lost in every redundant copy is skipped, a client whose input has not arrived keeps moving
+// as it was, and a backlog over commandBacklog is dropped so jitter cannot pile up latency. Each snapshot tells its
+// client the newest command applied, which is what client-side prediction reconciles against.
+// Send() runs after each Simulation::Step() and, every snapshotInterval ticks, quantizes the world once and sends
+// each client a snapshot delta-compressed against the newest one it acknowledged. Each client keeps the snapshots
+// it was sent for MaxBaselineAge ticks; with no usable ack (new client, or acks lost for that long) it gets a full
+// snapshot, so packet loss costs bandwidth but never correctness.
+// What each client is sent is its own interest set. A spatial grid over the world finds the entities within
+// relevancyRange of its player (kept out to a tenth further once sent, so nothing flickers at the edge), and each
+// gains priority every snapshot it waits: less with distance past priorityDistance, and less while hidden from the
+// player's eye by the static world or terrain. Changed entities are refreshed in priority order while the estimated
+// delta fits snapshotBudget, a refreshed entity's priority starts over, and the rest are repeated as last sent, so a
+// skipped update costs nothing against an acked baseline. The client's own player always goes first. Interest sets
+// and snapshots are built in parallel across clients on the job system; the line-of-sight cache is shared, and its
+// lookups and budgeted recasts are the only serial part.
+class ReplicationServer {
+public:
+    struct Stats {
+        size_t clients = 0;
+        size_t snapshots = 0;                 // last Send()
+        size_t fullSnapshots = 0;
+        size_t packets = 0;
+        size_t bytes = 0;                     // UDP payload, last Send()
+        size_t considered = 0;                // entities within range, summed over clients, last Send()
+        size_t updated = 0;                   // fresh entity states sent, summed over clients
+        size_t deferred = 0;                  // changed entities left for a later snapshot by the budget
+        double receiveMs = 0.0;
+        double interestMs = 0.0;              // grid, candidates and line-of-sight, last Send()
+        double encodeMs = 0.0;
+        double sendMs = 0.0;
+        size_t totalBytes = 0;
+        size_t commandsApplied = 0;           // totals since start
+        size_t commandsMissing = 0;           // ticks a client's next command had not arrived
+        size_t commandsDropped = 0;           // lost in every copy, or dropped from a backlog
+    };
+
+    ReplicationServer(Simulation &sim, const ReplicationSettings &settings = ReplicationSettings(), JobSystem *jobs = nullptr);
+
+    void Receive();
+    void Send();
+
+    uint16_t Port() const { return socket.Port(); }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Ring of what was sent, indexed by snapshot number; enough to cover MaxBaselineAge ticks at any interval
+    static constexpr size_t HistorySize = 64;
+
+    struct Sent {
+        uint32_t tick = 0;
+        bool valid = false;
+        std::vector<NetEntityState> states;
+    };
+
+    // Ring of received commands by sequence; comfortably more than commandBacklog plus a packet's worth
+    static constexpr size_t CommandBufferSize = 64;
+
+    struct BufferedCommand {
+        bool valid = false;
+        PlayerCommand command;
+    };
+
+    // A client's view of one entity slot
+    struct Interest {
+        bool known = false;                   // in the client's view
+        float priority = 0.0f;
+        uint32_t seen = 0;                    // snapshot number it was last a candidate
+        NetEntityState sent;                  // state the view carries until refreshed
+    };
+
+    struct Client {
+        NetAddress address;
+        uint32_t player = 0;
+        Clock::time_point lastHeard;
+        bool acked = false;
+        uint32_t ackedTick = 0;
+        std::array<Sent, HistorySize> history;
+
+        bool receivedCommands = false;
+        bool appliedCommand = false;
+        uint32_t lastCommand = 0;             // applied, or skipped over
+        uint32_t newestCommand = 0;
+        CharacterInput heldInput;             // repeated while the next command is late
+        std::array<BufferedCommand, CommandBufferSize> commands;
+
+        // Per-snapshot scratch, so clients can be built in parallel
+        std::vector<Interest> interest;       // by entity id
+        std::vector<uint32_t> candidates;     // world indices in range
+        std::vector<Visibility> visibility;   // per candidate
+        std::vector<uint32_t> order;
+        std::vector<NetEntityState> view;     // sorted by id
+        BitWriter writer;
+        std::vector<std::vector<uint8_t>> fragments;
+        bool full = false;
+        bool fits = false;
+        size_t considered = 0, updated = 0, deferred = 0;
+    };
+
+    Client *Find(const NetAddress &address);
+    void SendAccept(const Client &client);
+    void Drop(size_t index);
+    void BufferCommand(Client &client, const PlayerCommand &command);
+    void ApplyCommands();
+    const Sent *Baseline(const Client &client, uint32_t tick) const;
+    void GatherCandidates(Client &client);
+    void BuildSnapshot(Client &client, uint32_t tick);
+
+    Simulation &sim;
+    ReplicationSettings settings;
+    JobSystem *jobs;
+    UdpSocket socket;
+    SpatialHash grid;
+    PerceptionSystem perception;
+
+    std::vector<Client> clients;
+    std::vector<NetEntityState> world;        // this tick's quantized entities, shared by every client's snapshot
+    std::vector<glm::vec3> positions;         // per world entity
+    std::vector<glm::vec3> eyes;
+    uint32_t snapshotCount = 0;
+    uint64_t commandsTick = ~0ull;            // tick whose commands were last applied
+
+    std::vector<uint8_t> receiveBuffer;
+    std::vector<uint8_t> packet;
+    std::vector<PlayerCommand> receivedCommands;
+
+    Stats stats;
+};
@@ -0,0 +1,337 @@
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+    constexpr float PositionScale = 64.0f;
+    constexpr int PositionBitsXZ = 20;        // +-8 km
+    constexpr int PositionBitsY = 18;         // +-2 km
+    constexpr float VelocityScale = 32.0f;
+    constexpr int VelocityBits = 12;          // +-64 m/s
+    constexpr int YawBits = 12;
+    constexpr int PitchBits = 11;
+    constexpr int StanceBits = 2;
+
+    // Offsets from the baseline that fit these widths are sent short: under a metre of movement, 1 m/s of change
+    constexpr int SmallMoveBits = 7;
+    constexpr int SmallVelocityBits = 6;
+
+    constexpr size_t MaxEntities = 4096;
+
+    enum ChangeMask : uint32_t {
+        ChangedPosition = 1,
+        ChangedAngles = 2,
+        ChangedVelocity = 4,
+        ChangedFlags = 8,
+    };
+
+    void WriteFloat(BitWriter &out, float value) {
+        out.Write(std::bit_cast<uint32_t>(value), 32);
+    }
+
+    float ReadFloat(BitReader &in) {
+        return std::bit_cast<float>(in.Read(32));
+    }
+
+    void WriteCharacter(BitWriter &out, const CharacterState &state) {
+        for (int i = 0; i < 3; i++) WriteFloat(out, state.feet[i]);
+        for (int i = 0; i < 3; i++) WriteFloat(out, state.velocity[i]);
+        out.Write(static_cast<uint32_t>(state.stance), StanceBits);
+        out.WriteBool(state.grounded);
+    }
+
+    CharacterState ReadCharacter(BitReader &in) {
+        CharacterState state;
+        for (int i = 0; i < 3; i++) state.feet[i] = ReadFloat(in);
+        for (int i = 0; i < 3; i++) state.velocity[i] = ReadFloat(in);
+        state.stance = static_cast<Stance>(std::min(in.Read(StanceBits), static_cast<uint32_t>(Stance::Prone)));
+        state.grounded = in.ReadBool();
+        return state;
+    }
+
+    int32_t QuantizeSigned(float value, float scale, int bits) {
+        const float limit = static_cast<float>(1 << (bits - 1));
+        return static_cast<int32_t>(std::clamp(std::round(value * scale), -limit, limit - 1.0f));
+    }
+
+    bool Fits(const glm::ivec3 &d, int bits) {
+        const int limit = 1 << (bits - 1);
+        return d.x >= -limit && d.x < limit && d.y >= -limit && d.y < limit && d.z >= -limit && d.z < limit;
+    }
+
+    void WritePosition(BitWriter &out, const glm::ivec3 &p) {
+        out.WriteSigned(p.x, PositionBitsXZ);
+        out.WriteSigned(p.y, PositionBitsY);
+        out.WriteSigned(p.z, PositionBitsXZ);
+    }
+
+    glm::ivec3 ReadPosition(BitReader &in) {
+        glm::ivec3 p;
+        p.x = in.ReadSigned(PositionBitsXZ);
+        p.y = in.ReadSigned(PositionBitsY);
+        p.z = in.ReadSigned(PositionBitsXZ);
+        return p;
+    }
+
+    void WriteVector(BitWriter &out, const glm::ivec3 &v, int bits) {
+        out.WriteSigned(v.x, bits);
+        out.WriteSigned(v.y, bits);
+        out.WriteSigned(v.z, bits);
+    }
+
+    glm::ivec3 ReadVector(BitReader &in, int bits) {
+        glm::ivec3 v;
+        v.x = in.ReadSigned(bits);
+        v.y = in.ReadSigned(bits);
+        v.z = in.ReadSigned(bits);
+        return v;
+    }
+
+    void WriteFull(BitWriter &out, const NetEntityState &s) {
+        WritePosition(out, s.position);
+        WriteVector(out, s.velocity, VelocityBits);
+        out.Write(s.yaw, YawBits);
+        out.Write(s.pitch, PitchBits);
+        out.Write(s.stance, StanceBits);
+        out.WriteBool(s.grounded != 0);
+    }
+
+    void ReadFull(BitReader &in, NetEntityState &s) {
+        s.position = ReadPosition(in);
+        s.velocity = ReadVector(in, VelocityBits);
+        s.yaw = static_cast<uint16_t>(in.Read(YawBits));
+        s.pitch = static_cast<uint16_t>(in.Read(PitchBits));
+        s.stance = static_cast<uint8_t>(in.Read(StanceBits));
+        s.grounded = in.ReadBool() ? 1 : 0;
+    }
+
+    void WriteDelta(BitWriter &out, const NetEntityState &base, const NetEntityState &s) {
+        uint32_t mask = 0;
+        if (s.position != base.position) mask |= ChangedPosition;
+        if (s.yaw != base.yaw || s.pitch != base.pitch) mask |= ChangedAngles;
+        if (s.velocity != base.velocity) mask |= ChangedVelocity;
+        if (s.stance != base.stance || s.grounded != base.grounded) mask |= ChangedFlags;
+        out.Write(mask, 4);
+
+        if (mask & ChangedPosition) {
+            const glm::ivec3 d = s.position - base.position;
+            const bool small = Fits(d, SmallMoveBits);
+            out.WriteBool(small);
+            if (small) {
+                WriteVector(out, d, SmallMoveBits);
+            } else {
+                WritePosition(out, s.position);
+            }
+        }
+        if (mask & ChangedAngles) {
+            out.Write(s.yaw, YawBits);
+            out.Write(s.pitch, PitchBits);
+        }
+        if (mask & ChangedVelocity) {
+            const glm::ivec3 d = s.velocity - base.velocity;
+            const bool small = Fits(d, SmallVelocityBits);
+            out.WriteBool(small);
+            if (small) {
+                WriteVector(out, d, SmallVelocityBits);
+            } else {
+                WriteVector(out, s.velocity, VelocityBits);
+            }
+        }
+        if (mask & ChangedFlags) {
+            out.Write(s.stance, StanceBits);
+            out.WriteBool(s.grounded != 0);
+        }
+    }
+
+    void ReadDelta(BitReader &in, NetEntityState &s) {
+        const uint32_t mask = in.Read(4);
+        if (mask & ChangedPosition) s.position = in.ReadBool() ? s.position + ReadVector(in, SmallMoveBits) : ReadPosition(in);
+        if (mask & ChangedAngles) {
+            s.yaw = static_cast<uint16_t>(in.Read(YawBits));
+            s.pitch = static_cast<uint16_t>(in.Read(PitchBits));
+        }
+        if (mask & ChangedVelocity) s.velocity = in.ReadBool() ? s.velocity + ReadVector(in, SmallVelocityBits) : ReadVector(in, VelocityBits);
+        if (mask & ChangedFlags) {
+            s.stance = static_cast<uint8_t>(in.Read(StanceBits));
+            s.grounded = in.ReadBool() ? 1 : 0;
+        }
+    }
+
+    // Entries are id gaps from the previous entry plus one, so consecutive ids cost five bits
+    void WriteId(BitWriter &out, uint32_t id, uint32_t &nextId) {
+        out.WriteVarUint(id - nextId);
+        nextId = id + 1;
+    }
+
+    bool ReadId(BitReader &in, uint32_t &id, uint32_t &nextId) {
+        const uint64_t value = static_cast<uint64_t>(nextId) + in.ReadVarUint();
+        if (value > 0xfffffffeu) return false;
+        id = static_cast<uint32_t>(value);
+        nextId = id + 1;
+        return true;
+    }
+}
+
+NetEntityState QuantizeEntity(uint32_t id, const glm::vec3 &feet, const glm::vec3 &velocity, const glm::vec2 &yawPitch,
+                              Stance stance, bool grounded) {
+    NetEntityState s;
+    s.id = id;
+    s.position = glm::ivec3(QuantizeSigned(feet.x, PositionScale, PositionBitsXZ), QuantizeSigned(feet.y, PositionScale, PositionBitsY),
+                            QuantizeSigned(feet.z, PositionScale, PositionBitsXZ));
+    s.velocity = glm::ivec3(QuantizeSigned(velocity.x, VelocityScale, VelocityBits), QuantizeSigned(velocity.y, VelocityScale, VelocityBits),
+                            QuantizeSigned(velocity.z, VelocityScale, VelocityBits));
+
+    float yaw = std::fmod(yawPitch.x, 360.0f);
+    if (yaw < 0.0f) yaw += 360.0f;
+    s.yaw = static_cast<uint16_t>(static_cast<uint32_t>(std::lround(yaw / 360.0f * (1 << YawBits))) & BitWriter::Mask(YawBits));
+
+    const float pitch = std::clamp(yawPitch.y, -90.0f, 90.0f);
+    s.pitch = static_cast<uint16_t>(std::lround((pitch + 90.0f) / 180.0f * static_cast<float>(BitWriter::Mask(PitchBits))));
+
+    s.stance = static_cast<uint8_t>(stance);
+    s.grounded = grounded ? 1 : 0;
+    return s;
+}
+
+glm::vec3 EntityPosition(const NetEntityState &state) {
+    return glm::vec3(state.position) / PositionScale;
+}
+
+glm::vec3 EntityVelocity(const NetEntityState &state) {
+    return glm::vec3(state.velocity) / VelocityScale;
+}
+
+glm::vec2 EntityAim(const NetEntityState &state) {
+    return glm::vec2(static_cast<float>(state.yaw) * (360.0f / (1 << YawBits)),
+                     static_cast<float>(state.pitch) * (180.0f / static_cast<float>(BitWriter::Mask(PitchBits))) - 90.0f);
+}
+
+CharacterState EntityCharacter(const NetEntityState &state) {
+    return {EntityPosition(state), EntityVelocity(state), static_cast<Stance>(std::min<uint8_t>(state.stance, static_cast<uint8_t>(Stance::Prone))),
+            state.grounded != 0};
+}
+
+size_t EntityUpdateBits(const NetEntityState *baseline, const NetEntityState &state) {
+    // Entry bit, id gap, new bit
+    constexpr size_t EntryBits = 7;
+    constexpr size_t PositionBits = 2 * PositionBitsXZ + PositionBitsY;
+    if (!baseline) return EntryBits + PositionBits + 3 * VelocityBits + YawBits + PitchBits + StanceBits + 1;
+    if (*baseline == state) return 0;
+
+    size_t bits = EntryBits + 4;
+    if (state.position != baseline->position) bits += 1 + (Fits(state.position - baseline->position, SmallMoveBits) ? 3 * SmallMoveBits : PositionBits);
+    if (state.yaw != baseline->yaw || state.pitch != baseline->pitch) bits += YawBits + PitchBits;
+    if (state.velocity != baseline->velocity) bits += 1 + 3 * (Fits(state.velocity - baseline->velocity, SmallVelocityBits) ? SmallVelocityBits : VelocityBits);
+    if (state.stance != baseline->stance || state.grounded != baseline->grounded) bits += StanceBits + 1;
+    return bits;
+}
+
+void EncodeSnapshot(const SnapshotHeader &header, const std::vector<NetEntityState> *baseline,
+                    std::span<const NetEntityState> current, BitWriter &out) {
+    out.Write(header.tick, 32);
+    out.WriteBool(baseline != nullptr);
+    if (baseline) out.Write(header.tick - header.baselineTick, 8);
+    out.WriteBool(header.hasCommand);
+    if (header.hasCommand) {
+        out.Write(header.lastCommand, 32);
+        WriteCharacter(out, header.commandState);
+    }
+
+    // Merge walk over both id-sorted lists: each updated entity is preceded by a 1 bit, the list ends with a 0
+    static const std::vector<NetEntityState> empty;
+    const std::vector<NetEntityState> &base = baseline ? *baseline : empty;
+    std::vector<uint32_t> removed;
+    uint32_t nextId = 0;
+    size_t i = 0;
+
+    for (const NetEntityState &s: current) {
+        while (i < base.size() && base[i].id < s.id) removed.push_back(base[i++].id);
+
+        const bool known = i < base.size() && base[i].id == s.id;
+        if (known && base[i] == s) {
+            i++;
+            continue;
+        }
+
+        out.WriteBool(true);
+        WriteId(out, s.id, nextId);
+        out.WriteBool(!known);
+        if (known) {
+            WriteDelta(out, base[i++], s);
+        } else {
+            WriteFull(out, s);
+        }
+    }
+    out.WriteBool(false);
+
+    while (i < base.size()) removed.push_back(base[i++].id);
+    nextId = 0;
+    for (uint32_t id: removed) {
+        out.WriteBool(true);
+        WriteId(out, id, nextId);
+    }
+    out.WriteBool(false);
+}
+
+bool ReadSnapshotHeader(BitReader &in, SnapshotHeader &header) {
+    header.tick = in.Read(32);
+    header.delta = in.ReadBool();
+    if (header.delta) {
+        const uint32_t age = in.Read(8);
+        if (age == 0) return false;
+        header.baselineTick = header.tick - age;
+    }
+    header.hasCommand = in.ReadBool();
+    if (header.hasCommand) {
+        header.lastCommand = in.Read(32);
+        header.commandState = ReadCharacter(in);
+    }
+    return !in.Overflowed();
+}
+
+bool DecodeSnapshot(BitReader &in, const std::vector<NetEntityState> *baseline, std::vector<NetEntityState> &out) {
+    static const std::vector<NetEntityState> empty;
+    const std::vector<NetEntityState> &base = baseline ? *baseline : empty;
+    out.clear();
+
+    uint32_t nextId = 0;
+    size_t i = 0;
+    while (in.ReadBool()) {
+        uint32_t id;
+        if (!ReadId(in, id, nextId)) return false;
+        while (i < base.size() && base[i].id < id) out.push_back(base[i++]);
+
+        const bool known = i < base.size() && base[i].id == id;
+        const bool isNew = in.ReadBool();
+        if (isNew == known) return false;
+
+        NetEntityState s = known ? base[i++] : NetEntityState();
+        s.id = id;
+        if (isNew) {
+            ReadFull(in, s);
+        } else {
+            ReadDelta(in, s);
+        }
+        out.push_back(s);
+
+        if (in.Overflowed() || out.size() > MaxEntities) return false;
+    }
+    while (i < base.size()) out.push_back(base[i++]);
+
+    // Removals arrive in id order, so one pass over the merged list drops them all
+    nextId = 0;
+    size_t write = 0, read = 0;
+    while (in.ReadBool()) {
+        uint32_t id;
+        if (!ReadId(in, id, nextId)) return false;
+        while (read < out.size() && out[read].id < id) out[write++] = out[read++];
+        if (read == out.size() || out[read].id != id || in.Overflowed()) return false;
+        read++;
+    }
+    while (read < out.size()) out[write++] = out[read++];
+    out.resize(write);
+
+    return !in.Overflowed();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitStream.h"
+#include "../Physics/CharacterController.h"
+
+// One replicated entity as it goes over the wire. Both ends keep snapshots in this quantized form, so a delta decodes
+// to exactly the state the server encoded and the two never drift apart through rounding.
+struct NetEntityState {
+    uint32_t id = 0;
+    glm::ivec3 position = glm::ivec3(0);      // 1/64 m
+    glm::ivec3 velocity = glm::ivec3(0);      // 1/32 m/s
+    uint16_t yaw = 0;                         // 1/4096 of a turn
+    uint16_t pitch = 0;                       // -90..90 degrees in 2047 steps
+    uint8_t stance = 0;
+    uint8_t grounded = 0;
+
+    bool operator==(const NetEntityState &) const = default;
+};
+
+NetEntityState QuantizeEntity(uint32_t id, const glm::vec3 &feet, const glm::vec3 &velocity, const glm::vec2 &yawPitch,
+                              Stance stance, bool grounded);
+glm::vec3 EntityPosition(const NetEntityState &state);
+glm::vec3 EntityVelocity(const NetEntityState &state);
+glm::vec2 EntityAim(const NetEntityState &state);
+CharacterState EntityCharacter(const NetEntityState &state);
+
+struct SnapshotHeader {
+    uint32_t tick = 0;
+    bool delta = false;
+    uint32_t baselineTick = 0;                // valid when delta
+    bool hasCommand = false;                  // the receiving client's input has reached the server
+    uint32_t lastCommand = 0;                 // newest of its commands applied by this tick, for reconciliation
+    CharacterState commandState;              // its player after that command, unquantized so prediction can match exactly
+};
+
+// Snapshots may only be encoded against a baseline this many ticks older
+constexpr uint32_t MaxBaselineAge = 255;
+
+// Writes current (sorted by id) against baseline, or in full when baseline is null. Only entities that are new or
+// whose quantized state changed are written, and within those only the changed field groups; a move of under a
+// metre is sent as a short offset. Entities missing from current are listed as removed. An idle world costs a few
+// bytes per snapshot whatever its size.
+void EncodeSnapshot(const SnapshotHeader &header, const std::vector<NetEntityState> *baseline,
+                    std::span<const NetEntityState> current, BitWriter &out);
+
+// Bits EncodeSnapshot() spends on state against its baseline entry, or null when the entity is new to the receiver;
+// zero when nothing changed. Id gaps are counted at their five-bit minimum. Lets a sender fit updates to a budget
+// without encoding them.
+size_t EntityUpdateBits(const NetEntityState *baseline, const NetEntityState &state);
+
+bool ReadSnapshotHeader(BitReader &in, SnapshotHeader &header);
+
+// Rebuilds the snapshot after ReadSnapshotHeader(); baseline must be the snapshot at header.baselineTick when the
+// header says delta. Returns false for malformed data (bad ids, overflow, too many entities) and leaves out unspecified.
+bool DecodeSnapshot(BitReader &in, const std::vector<NetEntityState> *baseline, std::vector<NetEntityState> &out);
@@ -0,0 +1,113 @@
+#include "UdpSocket.h"
+
+#include <cstdio>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    // Winsock needs starting once per process before the first socket
+    struct WinsockInit {
+        WinsockInit() {
+            WSADATA data;
+            WSAStartup(MAKEWORD(2, 2), &data);
+        }
+        ~WinsockInit() { WSACleanup(); }
+    };
+
+    void CloseHandle(uintptr_t handle) { closesocket(static_cast<SOCKET>(handle)); }
+#else
+    void CloseHandle(int handle) { close(handle); }
+#endif
+}
+
+NetAddress NetAddress::Parse(const std::string &text) {
+    unsigned a, b, c, d, p;
+    char tail;
+    if (std::sscanf(text.c_str(), "%u.%u.%u.%u:%u%c", &a, &b, &c, &d, &p, &tail) != 5 || a > 255 || b > 255 || c > 255 ||
+        d > 255 || p > 65535) {
+        throw std::runtime_error("Invalid Address: " + text);
+    }
+    return {a << 24 | b << 16 | c << 8 | d, static_cast<uint16_t>(p)};
+}
+
+std::string NetAddress::ToString() const {
+    return std::to_string(ip >> 24) + "." + std::to_string((ip >> 16) & 255) + "." + std::to_string((ip >> 8) & 255) + "." +
+           std::to_string(ip & 255) + ":" + std::to_string(port);
+}
+
+UdpSocket::UdpSocket(uint16_t requestedPort, int bufferBytes) {
+#ifdef _WIN32
+    static WinsockInit winsock;
+    SOCKET s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s == INVALID_SOCKET) throw std::runtime_error("Failed to Create Socket");
+    handle = static_cast<uintptr_t>(s);
+#else
+    handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (handle < 0) throw std::runtime_error("Failed to Create Socket");
+#endif
+
+    setsockopt(handle, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char *>(&bufferBytes), sizeof(bufferBytes));
+    setsockopt(handle, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char *>(&bufferBytes), sizeof(bufferBytes));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(requestedPort);
+    if (bind(handle, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        CloseHandle(handle);
+        throw std::runtime_error("Failed to Bind Port: " + std::to_string(requestedPort));
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(handle, reinterpret_cast<sockaddr *>(&address), &length);
+    port = ntohs(address.sin_port);
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket(static_cast<SOCKET>(handle), FIONBIO, &nonBlocking);
+#else
+    fcntl(handle, F_SETFL, fcntl(handle, F_GETFL, 0) | O_NONBLOCK);
+#endif
+}
+
+UdpSocket::~UdpSocket() {
+    CloseHandle(handle);
+}
+
+bool UdpSocket::Send(const NetAddress &to, std::span<const uint8_t> data) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(to.ip);
+    address.sin_port = htons(to.port);
+
+    auto sent = sendto(handle, reinterpret_cast<const char *>(data.data()), static_cast<int>(data.size()), 0,
+                       reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+    return sent == static_cast<decltype(sent)>(data.size());
+}
+
+size_t UdpSocket::Receive(NetAddress &from, std::span<uint8_t> buffer) {
+    sockaddr_in address{};
+    socklen_t length = sizeof(address);
+
+    auto received = recvfrom(handle, reinterpret_cast<char *>(buffer.data()), static_cast<int>(buffer.size()), 0,
+                             reinterpret_cast<sockaddr *>(&address), &length);
+    if (received <= 0) return 0;
+
+    from.ip = ntohl(address.sin_addr.s_addr);
+    from.port = ntohs(address.sin_port);
+    return static_cast<size_t>(received);
+}
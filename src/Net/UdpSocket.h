@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// IPv4 address and port, both in host byte order
+struct NetAddress {
+    uint32_t ip = 0;
+    uint16_t port = 0;
+
+    bool operator==(const NetAddress &) const = default;
+
+    // "a.b.c.d:port"; throws on anything else
+    static NetAddress Parse(const std::string &text);
+    static NetAddress Loopback(uint16_t port) { return {0x7f000001u, port}; }
+    std::string ToString() const;
+};
+
+// Non-blocking IPv4 UDP socket. Receive() returns at once when nothing is waiting, so a game loop drains the socket
+// every tick without a network thread.
+class UdpSocket {
+public:
+    // Port 0 binds an ephemeral port (clients); buffer sizes are requested from the OS, which may grant less
+    explicit UdpSocket(uint16_t port = 0, int bufferBytes = 1 << 20);
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket &) = delete;
+    UdpSocket &operator=(const UdpSocket &) = delete;
+
+    uint16_t Port() const { return port; }
+
+    // False when the OS refused the datagram (full send buffer); UDP makes no promise past that anyway
+    bool Send(const NetAddress &to, std::span<const uint8_t> data);
+
+    // Bytes received into buffer, or 0 when nothing is waiting. Datagrams longer than the buffer are truncated.
+    size_t Receive(NetAddress &from, std::span<uint8_t> buffer);
+
+private:
+#ifdef _WIN32
+    uintptr_t handle;
+#else
+    int handle;
+#endif
+    uint16_t port = 0;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// Point-mass external ballistics: standard drag functions scaled by a ballistic coefficient.
+//
+//   a = g - k(M) * |v - w| * (v - w),   k(M) = pi / 8 * rho * Cd_ref(M) / (BC * 703.07)
+//
+// Cd_ref is the G1 or G7 reference projectile's drag coefficient at Mach M, BC is in the customary lb/in^2 and 703.07
+// converts it to kg/m^2. w is the wind velocity.
+
+enum class DragModel : uint8_t {
+    G1,
+    G7,
+};
+
+constexpr float BallisticCoefficientToSI = 703.0696f;  // lb/in^2 -> kg/m^2
+constexpr float StandardGravity = 9.80665f;
+
+struct Atmosphere {
+    float density = 1.225f;                   // kg/m^3, ICAO sea level
+    float speedOfSound = 340.29f;             // m/s
+
+    // ICAO standard atmosphere at an altitude (troposphere only) with a temperature offset from standard
+    static Atmosphere Standard(float altitude, float temperatureOffset = 0.0f);
+};
+
+// Reference drag coefficient, linearly interpolated over the published Mach tables (clamped to Mach 0..5)
+float DragCoefficient(DragModel model, float mach);
+
+// Per-round constant folded into k(M) above: pi / 8 / (BC * 703.07)
+inline float DragScale(float ballisticCoefficient) {
+    return 3.14159265f / 8.0f / (ballisticCoefficient * BallisticCoefficientToSI);
+}
+
+struct TrajectorySample {
+    float range;                              // horizontal distance along the bore azimuth, m
+    float drop;                               // below the bore line, m
+    float drift;                              // lateral, m (positive = right of the bore)
+    float time;                               // s
+    float velocity;                           // m/s
+};
+
+struct TrajectoryParams {
+    DragModel model = DragModel::G7;
+    float ballisticCoefficient = 0.243f;
+    float muzzleVelocity = 800.0f;            // m/s
+    float elevation = 0.0f;                   // bore angle above horizontal, radians
+    glm::vec3 wind = glm::vec3(0.0f);         // x = from left to right, y up, z downrange (m/s)
+    Atmosphere atmosphere;
+};
+
+// High-accuracy reference solution (RK4, 0.1 ms, double precision) sampled every step metres downrange, used to check
+// the game integrator and to compare against published tables
+std::vector<TrajectorySample> SolveTrajectory(const TrajectoryParams &params, float maxRange, float step);
+
+// Bore elevation that brings the trajectory back onto a horizontal line of sight sightHeight above the bore at
+// zeroRange (the lower of the two crossings)
+float ZeroElevation(TrajectoryParams params, float sightHeight, float zeroRange);
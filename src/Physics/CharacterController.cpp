@@ -0,0 +1,308 @@
+#include "CharacterController.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Ballistics.h"
+#include "../Terrain/Heightfield.h"
+
+namespace {
+    // Contacts closer than this count as touching (for grounding) without being pushed
+    constexpr float Skin = 0.02f;
+    constexpr int DepenetrationIterations = 4;
+
+    glm::vec3 ClosestOnTriangle(const glm::vec3 &p, const StaticGeometry::Triangle &t) {
+        // Ericson, Real-Time Collision Detection 5.1.5
+        glm::vec3 ab = t.b - t.a, ac = t.c - t.a, ap = p - t.a;
+        float d1 = glm::dot(ab, ap), d2 = glm::dot(ac, ap);
+        if (d1 <= 0.0f && d2 <= 0.0f) return t.a;
+
+        glm::vec3 bp = p - t.b;
+        float d3 = glm::dot(ab, bp), d4 = glm::dot(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3) return t.b;
+
+        float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return t.a + ab * (d1 / (d1 - d3));
+
+        glm::vec3 cp = p - t.c;
+        float d5 = glm::dot(ab, cp), d6 = glm::dot(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6) return t.c;
+
+        float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return t.a + ac * (d2 / (d2 - d6));
+
+        float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) return t.b + (t.c - t.b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+        float denom = 1.0f / (va + vb + vc);
+        return t.a + ab * (vb * denom) + ac * (vc * denom);
+    }
+
+    glm::vec3 ClosestOnBox(const glm::vec3 &p, const StaticGeometry::Box &box) {
+        glm::vec3 local = glm::clamp(box.toLocal * (p - box.center), -box.halfExtents, box.halfExtents);
+        return box.center + glm::transpose(box.toLocal) * local;
+    }
+
+    // Distance from a convex shape is convex along a segment, so a golden-section search finds the closest point of
+    // the capsule's core segment without a closed form per primitive type
+    template <typename Closest>
+    float ClosestOnSegment(const glm::vec3 &a, const glm::vec3 &b, Closest closest, glm::vec3 &onSegment, glm::vec3 &onShape) {
+        auto distance = [&](float s) {
+            glm::vec3 p = a + (b - a) * s;
+            return glm::length(p - closest(p));
+        };
+
+        constexpr float Ratio = 0.618034f;
+        float lo = 0.0f, hi = 1.0f;
+        float x1 = hi - Ratio * (hi - lo), x2 = lo + Ratio * (hi - lo);
+        float f1 = distance(x1), f2 = distance(x2);
+
+        for (int iteration = 0; iteration < 20 && glm::length(b - a) * (hi - lo) > 1e-4f; iteration++) {
+            if (f1 < f2) {
+                hi = x2;
+                x2 = x1;
+                f2 = f1;
+                x1 = hi - Ratio * (hi - lo);
+                f1 = distance(x1);
+            } else {
+                lo = x1;
+                x1 = x2;
+                f1 = f2;
+                x2 = lo + Ratio * (hi - lo);
+                f2 = distance(x2);
+            }
+        }
+
+        // The ends are not sampled by the search but are often the answer for an upright capsule on a floor
+        float best = (lo + hi) * 0.5f;
+        for (float s: {0.0f, 1.0f}) {
+            if (distance(s) < distance(best)) best = s;
+        }
+
+        onSegment = a + (b - a) * best;
+        onShape = closest(onSegment);
+        return glm::length(onSegment - onShape);
+    }
+}
+
+CharacterController::CharacterController(const StaticBvh &world, const Heightfield *terrain, const CharacterSettings &settings)
+    : world(world), terrain(terrain), settings(settings),
+      cosMaxSlope(std::cos(settings.maxSlope * 3.14159265f / 180.0f)), height(settings.standingHeight) {
+}
+
+void CharacterController::Teleport(const glm::vec3 &position) {
+    feet = position;
+    velocity = glm::vec3(0.0f);
+    grounded = false;
+}
+
+void CharacterController::SetState(const CharacterState &state) {
+    feet = state.feet;
+    velocity = state.velocity;
+    stance = state.stance;
+    grounded = state.grounded;
+    height = StanceHeight(stance);
+}
+
+float CharacterController::StanceHeight(Stance value) const {
+    switch (value) {
+        case Stance::Crouching: return settings.crouchingHeight;
+        case Stance::Prone: return settings.proneHeight;
+        default: return settings.standingHeight;
+    }
+}
+
+bool CharacterController::Overlaps(const glm::vec3 &position, float capsuleHeight) const {
+    const float r = settings.radius;
+    glm::vec3 a = position + glm::vec3(0.0f, r, 0.0f);
+    glm::vec3 b = position + glm::vec3(0.0f, std::max(capsuleHeight - r, r), 0.0f);
+
+    nearTriangles.clear();
+    nearBoxes.clear();
+    world.Overlap(position - glm::vec3(r, 0.0f, r), position + glm::vec3(r, capsuleHeight, r), nearTriangles, nearBoxes);
+
+    glm::vec3 onSegment, onShape;
+    for (const StaticGeometry::Triangle &t: nearTriangles) {
+        if (ClosestOnSegment(a, b, [&](const glm::vec3 &p) { return ClosestOnTriangle(p, t); }, onSegment, onShape) < r - Skin) return true;
+    }
+    for (const StaticGeometry::Box &box: nearBoxes) {
+        if (ClosestOnSegment(a, b, [&](const glm::vec3 &p) { return ClosestOnBox(p, box); }, onSegment, onShape) < r - Skin) return true;
+    }
+
+    return terrain && position.y < terrain->HeightAt(position.x, position.z) - Skin;
+}
+
+void CharacterController::Depenetrate(glm::vec3 &position, glm::vec3 &moveVelocity, glm::vec3 *remaining, MoveResult &result) const {
+    const float r = settings.radius;
+
+    for (int iteration = 0; iteration < DepenetrationIterations; iteration++) {
+        glm::vec3 a = position + glm::vec3(0.0f, r, 0.0f);
+        glm::vec3 b = position + glm::vec3(0.0f, std::max(height - r, r), 0.0f);
+
+        nearTriangles.clear();
+        nearBoxes.clear();
+        world.Overlap(position - glm::vec3(r + Skin), position + glm::vec3(r + Skin, height + Skin, r + Skin), nearTriangles, nearBoxes);
+
+        // Resolve the deepest contact each iteration; the rest are re-evaluated from the new position
+        glm::vec3 deepestNormal(0.0f);
+        float deepest = 0.0f;
+
+        auto contact = [&](const glm::vec3 &normal, float depth) {
+            if (normal.y >= cosMaxSlope) {
+                result.grounded = true;
+            } else if (normal.y > -cosMaxSlope) {
+                result.blocked = true;
+            }
+
+            if (depth > deepest) {
+                deepest = depth;
+                deepestNormal = normal;
+            }
+        };
+
+        glm::vec3 onSegment, onShape;
+        for (const StaticGeometry::Triangle &t: nearTriangles) {
+            float distance = ClosestOnSegment(a, b, [&](const glm::vec3 &p) { return ClosestOnTriangle(p, t); }, onSegment, onShape);
+            if (distance >= r + Skin) continue;
+
+            if (distance > 1e-5f) {
+                contact((onSegment - onShape) / distance, r - distance);
+            } else {
+                // The core segment crosses the triangle: leave through the face on the capsule centre's side
+                glm::vec3 n = glm::normalize(glm::cross(t.b - t.a, t.c - t.a));
+                contact(glm::dot(n, (a + b) * 0.5f - t.a) >= 0.0f ? n : -n, r);
+            }
+        }
+
+        for (const StaticGeometry::Box &box: nearBoxes) {
+            float distance = ClosestOnSegment(a, b, [&](const glm::vec3 &p) { return ClosestOnBox(p, box); }, onSegment, onShape);
+            if (distance >= r + Skin) continue;
+
+            if (distance > 1e-5f) {
+                contact((onSegment - onShape) / distance, r - distance);
+            } else {
+                // Core segment inside the box: leave through the nearest face
+                glm::vec3 local = box.toLocal * (onSegment - box.center);
+                glm::vec3 room = box.halfExtents - glm::abs(local);
+                int axis = room.x < room.y ? (room.x < room.z ? 0 : 2) : (room.y < room.z ? 1 : 2);
+                glm::vec3 localNormal(0.0f);
+                localNormal[axis] = local[axis] >= 0.0f ? 1.0f : -1.0f;
+                contact(glm::transpose(box.toLocal) * localNormal, r + room[axis]);
+            }
+        }
+
+        if (terrain) {
+            float ground = terrain->HeightAt(position.x, position.z);
+            if (position.y < ground + Skin) {
+                glm::vec3 n = glm::normalize(glm::vec3(terrain->HeightAt(position.x - 0.5f, position.z) - terrain->HeightAt(position.x + 0.5f, position.z), 1.0f,
+                                                       terrain->HeightAt(position.x, position.z - 0.5f) - terrain->HeightAt(position.x, position.z + 0.5f)));
+                // The height is sampled under the capsule's axis, so push up by exactly the gap whatever the slope
+                contact(glm::vec3(0.0f, 1.0f, 0.0f), ground - position.y);
+                if (n.y < cosMaxSlope) result.blocked = true;
+            }
+        }
+
+        if (deepest <= 0.0f) break;
+
+        if (deepestNormal.y >= cosMaxSlope) {
+            position.y += deepest / deepestNormal.y;
+        } else {
+            position += deepestNormal * deepest;
+        }
+
+        // Stop motion into the surface
+        float into = glm::dot(moveVelocity, deepestNormal);
+        if (into < 0.0f) moveVelocity -= deepestNormal * into;
+
+        if (remaining) {
+            float ahead = glm::dot(*remaining, deepestNormal);
+            if (ahead < 0.0f) *remaining -= deepestNormal * ahead;
+        }
+    }
+}
+
+CharacterController::MoveResult CharacterController::SlideMove(glm::vec3 &position, glm::vec3 &moveVelocity,
+                                                               const glm::vec3 &displacement) const {
+    MoveResult result;
+    glm::vec3 remaining = displacement;
+    const float maxStep = settings.radius * 0.5f;
+
+    for (int subStep = 0; subStep < 32 && glm::length(remaining) > 1e-5f; subStep++) {
+        float length = glm::length(remaining);
+        glm::vec3 move = length > maxStep ? remaining * (maxStep / length) : remaining;
+
+        position += move;
+        remaining -= move;
+        Depenetrate(position, moveVelocity, &remaining, result);
+    }
+
+    if (glm::length(displacement) <= 1e-5f) {
+        Depenetrate(position, moveVelocity, nullptr, result);
+    }
+
+    return result;
+}
+
+void CharacterController::Step(const CharacterInput &input, float dt) {
+    // Growing taller needs headroom; shrinking always succeeds
+    float wantedHeight = StanceHeight(input.stance);
+    if (wantedHeight <= height || !Overlaps(feet, wantedHeight)) {
+        stance = input.stance;
+        height = wantedHeight;
+    }
+
+    float speed = stance == Stance::Prone ? settings.proneSpeed : stance == Stance::Crouching ? settings.crouchSpeed : settings.walkSpeed;
+    glm::vec3 wish = glm::vec3(input.move.x, 0.0f, input.move.z);
+    if (glm::length(wish) > 1.0f) wish = glm::normalize(wish);
+    wish *= speed;
+
+    if (grounded) {
+        velocity = glm::vec3(wish.x, 0.0f, wish.z);
+        if (input.jump && stance == Stance::Standing) velocity.y = settings.jumpSpeed;
+    } else {
+        velocity.x += (wish.x - velocity.x) * settings.airControl;
+        velocity.z += (wish.z - velocity.z) * settings.airControl;
+    }
+    velocity.y -= StandardGravity * dt;
+
+    const bool wasGrounded = grounded;
+    const glm::vec3 start = feet;
+    const glm::vec3 startVelocity = velocity;
+
+    MoveResult result = SlideMove(feet, velocity, velocity * dt);
+
+    // Blocked while walking: try the same move from stepHeight up, then settle back down. Keep it only if it lands
+    // on walkable ground further along than the plain slide got.
+    if (wasGrounded && result.blocked && startVelocity.y <= 0.0f) {
+        glm::vec3 raised = start + glm::vec3(0.0f, settings.stepHeight, 0.0f);
+
+        if (!Overlaps(raised, height)) {
+            glm::vec3 stepVelocity = glm::vec3(startVelocity.x, 0.0f, startVelocity.z);
+            SlideMove(raised, stepVelocity, stepVelocity * dt);
+
+            glm::vec3 landVelocity(0.0f);
+            MoveResult landed = SlideMove(raised, landVelocity, glm::vec3(0.0f, -settings.stepHeight - Skin, 0.0f));
+
+            auto progress = [&](const glm::vec3 &p) { return glm::length(glm::vec2(p.x - start.x, p.z - start.z)); };
+            if (landed.grounded && progress(raised) > progress(feet) + 1e-4f) {
+                feet = raised;
+                velocity = glm::vec3(stepVelocity.x, 0.0f, stepVelocity.z);
+                result.grounded = true;
+            }
+        }
+    }
+
+    // Walking off a step or down a slope: stay on the ground if it is within stepHeight
+    if (wasGrounded && !result.grounded && velocity.y <= 0.0f) {
+        glm::vec3 probe = feet;
+        glm::vec3 probeVelocity(0.0f);
+        MoveResult snapped = SlideMove(probe, probeVelocity, glm::vec3(0.0f, -settings.stepHeight, 0.0f));
+        if (snapped.grounded) {
+            feet = probe;
+            result.grounded = true;
+        }
+    }
+
+    grounded = result.grounded;
+    if (grounded && velocity.y < 0.0f) velocity.y = 0.0f;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "StaticBvh.h"
+
+class Heightfield;
+
+enum class Stance {
+    Standing,
+    Crouching,
+    Prone,
+};
+
+struct CharacterSettings {
+    float radius = 0.3f;
+    float standingHeight = 1.8f;              // full capsule height per stance
+    float crouchingHeight = 1.2f;
+    float proneHeight = 0.6f;
+    float eyeBelowTop = 0.12f;
+    float stepHeight = 0.35f;
+    float maxSlope = 45.0f;                   // degrees; steeper contacts are walls
+    float walkSpeed = 2.5f;
+    float crouchSpeed = 1.4f;
+    float proneSpeed = 0.6f;
+    float jumpSpeed = 4.0f;
+    float airControl = 0.1f;                  // fraction of the wanted horizontal velocity gained per tick in the air
+};
+
+struct CharacterInput {
+    glm::vec3 move = glm::vec3(0.0f);         // horizontal world direction, length <= 1
+    bool jump = false;
+    Stance stance = Stance::Standing;
+};
+
+// Everything Step() carries from one tick to the next; capsule height follows from the stance
+struct CharacterState {
+    glm::vec3 feet = glm::vec3(0.0f);
+    glm::vec3 velocity = glm::vec3(0.0f);
+    Stance stance = Stance::Standing;
+    bool grounded = false;
+};
+
+// Upright capsule moved through the static world once per fixed tick. Motion is swept in sub-steps no longer than
+// half the radius, so nothing thinner than the capsule is tunnelled, and each sub-step pushes the capsule out of the
+// primitives that the world BVH returns for its bounds. That keeps per-character cost tied to the geometry nearby
+// rather than to the size of the map. Walkable contacts (within maxSlope) push straight up so the character does not
+// creep down slopes; steeper ones slide it along the wall, and a blocked move is retried stepHeight higher.
+class CharacterController {
+public:
+    explicit CharacterController(const StaticBvh &world, const Heightfield *terrain = nullptr,
+                                 const CharacterSettings &settings = CharacterSettings());
+
+    void Teleport(const glm::vec3 &feet);
+    void Step(const CharacterInput &input, float dt);
+
+    // For rewinding: SetState(GetState()) followed by the same inputs repeats the same movement
+    CharacterState GetState() const { return {feet, velocity, stance, grounded}; }
+    void SetState(const CharacterState &state);
+
+    glm::vec3 Position() const { return feet; }
+    glm::vec3 EyePosition() const { return feet + glm::vec3(0.0f, height - settings.eyeBelowTop, 0.0f); }
+    glm::vec3 Velocity() const { return velocity; }
+    bool IsGrounded() const { return grounded; }
+    Stance GetStance() const { return stance; }
+    float Height() const { return height; }
+
+private:
+    struct MoveResult {
+        bool grounded = false;
+        bool blocked = false;                 // hit something steeper than maxSlope
+    };
+
+    float StanceHeight(Stance value) const;
+    bool Overlaps(const glm::vec3 &position, float capsuleHeight) const;
+    void Depenetrate(glm::vec3 &position, glm::vec3 &moveVelocity, glm::vec3 *remaining, MoveResult &result) const;
+    MoveResult SlideMove(glm::vec3 &position, glm::vec3 &moveVelocity, const glm::vec3 &displacement) const;
+
+    const StaticBvh &world;
+    const Heightfield *terrain;
+    CharacterSettings settings;
+    float cosMaxSlope;
+
+    glm::vec3 feet = glm::vec3(0.0f);
+    glm::vec3 velocity = glm::vec3(0.0f);
+    float height;
+    Stance stance = Stance::Standing;
+    bool grounded = false;
+
+    // Query scratch, reused between ticks
+    mutable std::vector<StaticGeometry::Triangle> nearTriangles;
+    mutable std::vector<StaticGeometry::Box> nearBoxes;
+};
@@ -0,0 +1,194 @@
+#include "HitboxHistory.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float TurnScale = 65536.0f / 360.0f;
+
+    float Sphere(const glm::vec3 &origin, const glm::vec3 &direction, float dd, const glm::vec3 &centre, float radius) {
+        const glm::vec3 oc = origin - centre;
+        const float b = glm::dot(direction, oc);
+        const float h = b * b - dd * (glm::dot(oc, oc) - radius * radius);
+        return h < 0.0f ? INFINITY : (-b - std::sqrt(h)) / dd;
+    }
+
+    // Entry t of the ray into the capsule a-b, or INFINITY; a ray starting inside does not count
+    float Capsule(const glm::vec3 &origin, const glm::vec3 &direction, float dd, const glm::vec3 &a, const glm::vec3 &b, float radius) {
+        float best = INFINITY;
+
+        const glm::vec3 ba = b - a, oa = origin - a;
+        const float baba = glm::dot(ba, ba), bard = glm::dot(ba, direction), baoa = glm::dot(ba, oa);
+        const float k2 = baba * dd - bard * bard;
+        if (k2 > 1e-9f * baba * dd) {
+            const float k1 = baba * glm::dot(oa, direction) - baoa * bard;
+            const float k0 = baba * glm::dot(oa, oa) - baoa * baoa - radius * radius * baba;
+            const float h = k1 * k1 - k2 * k0;
+            if (h >= 0.0f) {
+                const float t = (-k1 - std::sqrt(h)) / k2;
+                const float y = baoa + t * bard;
+                if (t >= 0.0f && y >= 0.0f && y <= baba) best = t;
+            }
+        }
+
+        // End caps
+        for (const glm::vec3 &end: {a, b}) {
+            const float t = Sphere(origin, direction, dd, end, radius);
+            if (t >= 0.0f && t < best) best = t;
+        }
+        return best;
+    }
+
+    glm::vec3 ClosestOnSegment(const glm::vec3 &p, const glm::vec3 &a, const glm::vec3 &b) {
+        const glm::vec3 ba = b - a;
+        const float len = glm::dot(ba, ba);
+        return len > 0.0f ? a + ba * std::clamp(glm::dot(p - a, ba) / len, 0.0f, 1.0f) : a;
+    }
+}
+
+HitboxHistory::HitboxHistory(size_t ticks, const CharacterSettings &body) : ticks(std::max<size_t>(ticks, 2)) {
+    // Upright stances scale with capsule height; prone lies along the view direction
+    auto upright = [](float height) {
+        StanceShapes s;
+        s.parts[static_cast<size_t>(HitboxPart::Head)] = {{0.0f, height - 0.12f}, {0.0f, height - 0.12f}, 0.11f, 0.18f};
+        s.parts[static_cast<size_t>(HitboxPart::Torso)] = {{0.0f, 0.52f * height}, {0.0f, height - 0.32f}, 0.19f, 0.3f};
+        s.parts[static_cast<size_t>(HitboxPart::Legs)] = {{0.0f, 0.12f}, {0.0f, 0.52f * height - 0.06f}, 0.14f, 0.15f};
+        s.centre = height * 0.5f;
+        s.radius = height * 0.5f + 0.05f;
+        return s;
+    };
+    shapes[static_cast<size_t>(Stance::Standing)] = upright(body.standingHeight);
+    shapes[static_cast<size_t>(Stance::Crouching)] = upright(body.crouchingHeight);
+
+    StanceShapes &prone = shapes[static_cast<size_t>(Stance::Prone)];
+    prone.parts[static_cast<size_t>(HitboxPart::Head)] = {{0.75f, 0.2f}, {0.75f, 0.2f}, 0.11f, 0.18f};
+    prone.parts[static_cast<size_t>(HitboxPart::Torso)] = {{-0.1f, 0.18f}, {0.5f, 0.18f}, 0.18f, 0.3f};
+    prone.parts[static_cast<size_t>(HitboxPart::Legs)] = {{-0.95f, 0.12f}, {-0.2f, 0.12f}, 0.12f, 0.15f};
+    prone.centre = 0.2f;
+    prone.radius = 1.1f;
+}
+
+void HitboxHistory::BeginTick(uint64_t tick) {
+    newest = tick;
+    started = true;
+    std::fill_n(Row(tick), width, Pose{glm::vec3(0.0f), 0, 0, 0});
+    stats = {};
+}
+
+void HitboxHistory::Widen(uint32_t entity) {
+    if (entity >= width) {
+        // Players join rarely; widen in steps and move each row over
+        const size_t wider = (static_cast<size_t>(entity) / 16 + 1) * 16;
+        std::vector<Pose> moved(wider * ticks, Pose{glm::vec3(0.0f), 0, 0, 0});
+        for (size_t row = 0; row < ticks; row++) {
+            std::copy_n(poses.begin() + static_cast<std::ptrdiff_t>(row * width), width, moved.begin() + static_cast<std::ptrdiff_t>(row * wider));
+        }
+        poses.swap(moved);
+        width = wider;
+    }
+    entities = std::max(entities, entity + 1);
+}
+
+void HitboxHistory::Record(uint32_t entity, const glm::vec3 &feet, float yawDegrees, Stance stance) {
+    Widen(entity);
+
+    float turn = std::fmod(yawDegrees, 360.0f);
+    if (turn < 0.0f) turn += 360.0f;
+    Row(newest)[entity] = {feet, static_cast<uint16_t>(static_cast<uint32_t>(std::lround(turn * TurnScale)) & 0xffffu),
+                          static_cast<uint8_t>(stance), 1};
+}
+
+void HitboxHistory::Forget(uint32_t entity) {
+    if (entity >= width) return;
+    for (size_t row = 0; row < ticks; row++) poses[row * width + entity] = Pose{glm::vec3(0.0f), 0, 0, 0};
+}
+
+void HitboxHistory::Save(std::vector<RecordedPose> &out) const {
+    out.clear();
+    if (!started) return;
+    for (uint64_t tick = OldestTick(); tick <= newest; tick++) {
+        const Pose *row = Row(tick);
+        for (uint32_t entity = 0; entity < entities; entity++) {
+            if (row[entity].present) out.push_back({tick, entity, row[entity].feet, row[entity].yaw, static_cast<Stance>(row[entity].stance)});
+        }
+    }
+}
+
+void HitboxHistory::Restore(uint64_t newestTick, std::span<const RecordedPose> kept) {
+    Clear();
+    newest = newestTick;
+    started = true;
+    for (const RecordedPose &pose: kept) {
+        if (pose.tick > newest || pose.tick < OldestTick()) continue;
+        Widen(pose.entity);
+        Row(pose.tick)[pose.entity] = {pose.feet, pose.yaw, static_cast<uint8_t>(pose.stance), 1};
+    }
+}
+
+void HitboxHistory::Clear() {
+    std::fill(poses.begin(), poses.end(), Pose{glm::vec3(0.0f), 0, 0, 0});
+    entities = 0;
+    newest = 0;
+    started = false;
+    stats = {};
+}
+
+bool HitboxHistory::Raycast(const Ray &ray, double time, uint32_t ignore, HitboxHit &hit) const {
+    stats.queries++;
+    if (!started) return false;
+
+    // Anything older than the history is clamped to it: how far a shooter may be behind is capped right here
+    // (NaN compares false both ways and would pass the clamp as a row index)
+    time = std::isfinite(time) ? std::clamp(time, static_cast<double>(OldestTick()), static_cast<double>(newest)) : static_cast<double>(newest);
+    const uint64_t before = static_cast<uint64_t>(time);
+    const uint64_t after = std::min(before + 1, newest);
+    const float alpha = static_cast<float>(time - static_cast<double>(before));
+
+    const float dd = glm::dot(ray.direction, ray.direction);
+    const float invDD = 1.0f / dd;
+    const float ox = ray.origin.x, oy = ray.origin.y, oz = ray.origin.z;
+    const float dx = ray.direction.x, dy = ray.direction.y, dz = ray.direction.z;
+    const Pose *rowBefore = Row(before), *rowAfter = Row(after);
+
+    HitboxHit best;
+    best.t = ray.tMax;
+
+    // The broadphase runs on every entity, so it stays in plain floats
+    for (uint32_t entity = 0; entity < entities; entity++) {
+        const Pose &a = rowBefore[entity], &b = rowAfter[entity];
+        if ((!a.present && !b.present) || entity == ignore) continue;
+
+        // Between two ticks the pose moves linearly and turns the short way; stance snaps at the midpoint
+        const Pose &from = a.present ? a : b, &to = b.present ? b : a;
+        const StanceShapes &body = shapes[alpha < 0.5f ? from.stance : to.stance];
+        const float fx = from.feet.x + (to.feet.x - from.feet.x) * alpha;
+        const float fy = from.feet.y + (to.feet.y - from.feet.y) * alpha;
+        const float fz = from.feet.z + (to.feet.z - from.feet.z) * alpha;
+
+        // Bounding sphere against the segment
+        const float cx = fx - ox, cy = fy + body.centre - oy, cz = fz - oz;
+        const float along = std::clamp((cx * dx + cy * dy + cz * dz) * invDD, 0.0f, best.t);
+        const float nx = cx - dx * along, ny = cy - dy * along, nz = cz - dz * along;
+        if (nx * nx + ny * ny + nz * nz > body.radius * body.radius) continue;
+        stats.candidates++;
+
+        const glm::vec3 feet(fx, fy, fz);
+        const float turn = static_cast<float>(from.yaw) + static_cast<float>(static_cast<int16_t>(to.yaw - from.yaw)) * alpha;
+        const float yaw = glm::radians(turn / TurnScale);
+        const glm::vec3 forward(std::cos(yaw), 0.0f, std::sin(yaw));
+        for (size_t part = 0; part < body.parts.size(); part++) {
+            const Shape &shape = body.parts[part];
+            const glm::vec3 p0 = feet + forward * shape.a.x + glm::vec3(0.0f, shape.a.y, 0.0f);
+            const glm::vec3 p1 = feet + forward * shape.b.x + glm::vec3(0.0f, shape.b.y, 0.0f);
+            const float t = Capsule(ray.origin, ray.direction, dd, p0, p1, shape.radius);
+            if (t >= best.t) continue;
+
+            const glm::vec3 point = ray.origin + ray.direction * t;
+            best = {entity, static_cast<HitboxPart>(part), t, glm::normalize(point - ClosestOnSegment(point, p0, p1)), shape.depth};
+        }
+    }
+
+    if (best.entity == InvalidEntity) return false;
+    hit = best;
+    return true;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "CharacterController.h"
+#include "StaticBvh.h"
+
+constexpr uint32_t InvalidEntity = 0xffffffffu;
+
+enum class HitboxPart : uint8_t {
+    Head,
+    Torso,
+    Legs,
+};
+
+struct HitboxHit {
+    uint32_t entity = InvalidEntity;
+    HitboxPart part = HitboxPart::Torso;
+    float t = INFINITY;                       // along the ray, in units of its direction
+    glm::vec3 normal = glm::vec3(0.0f);
+    float depth = 0.0f;                       // typical path through the part, for penetration
+};
+
+// Where every entity's hitboxes were over the last few ticks, for lag compensation: a shot is tested against targets
+// as the shooter saw them, not where they are once the command reaches the server. Each tick stores a 16-byte pose
+// per entity (feet, yaw, stance), not the boxes; Raycast() interpolates the pose between the two ticks around the
+// asked time and builds that stance's head, torso and legs capsules on the fly, after a bounding sphere test. The
+// ring holds one row per tick with a slot per entity, so a query streams the two rows around its time and copies
+// nothing; rows only grow (and are re-laid out) when an entity id past the current width is recorded.
+class HitboxHistory {
+public:
+    struct Stats {
+        size_t queries = 0;                   // since the last BeginTick()
+        size_t candidates = 0;                // entities past the bounding sphere test
+    };
+
+    // One kept pose, for saving the history with the rest of the simulation (replay keyframes)
+    struct RecordedPose {
+        uint64_t tick;
+        uint32_t entity;
+        glm::vec3 feet;
+        uint16_t yaw;                         // 1/65536 of a turn
+        Stance stance;
+    };
+
+    explicit HitboxHistory(size_t ticks = 60, const CharacterSettings &body = CharacterSettings());
+
+    // Opens the tick for recording; entities not recorded in it count as absent at that tick
+    void BeginTick(uint64_t tick);
+    void Record(uint32_t entity, const glm::vec3 &feet, float yawDegrees, Stance stance);
+
+    // Clears an entity's past, so an id handed to a new player never interpolates from the old one
+    void Forget(uint32_t entity);
+
+    // Every pose still kept, oldest tick first; Restore() puts exactly these back, so queries answer as before
+    void Save(std::vector<RecordedPose> &out) const;
+    void Restore(uint64_t newestTick, std::span<const RecordedPose> poses);
+    void Clear();
+
+    bool Empty() const { return !started; }
+    uint64_t NewestTick() const { return newest; }
+    uint64_t OldestTick() const { return newest + 1 > ticks ? newest + 1 - ticks : 0; }
+    size_t Ticks() const { return ticks; }
+
+    // Nearest hitbox the ray enters within ray.tMax at time (in ticks, clamped to what is kept), skipping ignore
+    bool Raycast(const Ray &ray, double time, uint32_t ignore, HitboxHit &hit) const;
+
+    size_t MemoryBytes() const { return poses.capacity() * sizeof(Pose); }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Pose {
+        glm::vec3 feet;
+        uint16_t yaw;                         // 1/65536 of a turn
+        uint8_t stance;
+        uint8_t present;
+    };
+    static_assert(sizeof(Pose) == 16);
+
+    // One capsule per part, as (forward, up) offsets from the feet
+    struct Shape {
+        glm::vec2 a, b;
+        float radius;
+        float depth;
+    };
+
+    struct StanceShapes {
+        std::array<Shape, 3> parts;
+        float centre;                         // bounding sphere around feet + centre up
+        float radius;
+    };
+
+    void Widen(uint32_t entity);
+
+    const Pose *Row(uint64_t tick) const { return poses.data() + (tick % ticks) * width; }
+    Pose *Row(uint64_t tick) { return poses.data() + (tick % ticks) * width; }
+
+    size_t ticks;
+    std::array<StanceShapes, 3> shapes;
+    std::vector<Pose> poses;                  // ticks rows of width slots
+    size_t width = 0;
+    uint32_t entities = 0;                    // highest recorded id + 1
+    uint64_t newest = 0;
+    bool started = false;
+
+    mutable Stats stats;
+};
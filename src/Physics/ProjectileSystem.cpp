@@ -0,0 +1,353 @@
+#include "ProjectileSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "../Core/Simd.h"
+#include "../Terrain/Heightfield.h"
+
+namespace {
+    // DragCoefficient() resampled at a fixed Mach step so the per-lane lookup is an index, not a search
+    constexpr int DragSamples = 501;
+    constexpr float DragMachStep = 0.01f;
+
+    struct UniformDragTable {
+        float cd[2][DragSamples + 1];
+
+        UniformDragTable() {
+            for (int m = 0; m < 2; m++) {
+                for (int i = 0; i <= DragSamples; i++) {
+                    cd[m][i] = DragCoefficient(m == 0 ? DragModel::G1 : DragModel::G7, static_cast<float>(i) * DragMachStep);
+                }
+            }
+        }
+
+        float Lookup(DragModel model, float mach) const {
+            float x = std::clamp(mach / DragMachStep, 0.0f, static_cast<float>(DragSamples - 1));
+            int i = static_cast<int>(x);
+            const float *table = cd[model == DragModel::G1 ? 0 : 1];
+            return table[i] + (table[i + 1] - table[i]) * (x - static_cast<float>(i));
+        }
+    };
+
+    const UniformDragTable &DragTable() {
+        static const UniformDragTable table;
+        return table;
+    }
+
+    // Continued segments start this far past the surface so they do not hit it again
+    constexpr float SurfaceOffset = 1e-3f;
+    // Below this a penetrating round is considered spent
+    constexpr float MinimumSpeed = 30.0f;
+
+    size_t Padded(size_t n) {
+        return (n + 3) & ~size_t(3);
+    }
+}
+
+ProjectileSystem::ProjectileSystem(const StaticBvh &world, const Heightfield *terrain, uint32_t terrainMaterial)
+    : world(world), terrain(terrain), terrainMaterial(terrainMaterial), materials(DefaultSurfaceMaterials()) {
+}
+
+uint32_t ProjectileSystem::Spawn(const ProjectileDesc &desc) {
+    if (count == posX.size()) {
+        size_t size = Padded(std::max<size_t>(count * 2, 64));
+        for (std::vector<float> *array: {&posX, &posY, &posZ, &velX, &velY, &velZ, &prevX, &prevY, &prevZ,
+                                         &dragScale, &flightTime, &mass, &caliber, &rewind}) {
+            array->resize(size, 0.0f);
+        }
+        dragModel.resize(size, DragModel::G7);
+        ids.resize(size, 0);
+        owners.resize(size, 0);
+    }
+
+    size_t i = count++;
+    posX[i] = prevX[i] = desc.position.x;
+    posY[i] = prevY[i] = desc.position.y;
+    posZ[i] = prevZ[i] = desc.position.z;
+    velX[i] = desc.velocity.x;
+    velY[i] = desc.velocity.y;
+    velZ[i] = desc.velocity.z;
+    dragScale[i] = DragScale(desc.ballisticCoefficient);
+    flightTime[i] = 0.0f;
+    mass[i] = desc.mass;
+    caliber[i] = desc.caliber;
+    rewind[i] = desc.rewindTicks;
+    dragModel[i] = desc.dragModel;
+    ids[i] = nextId;
+    owners[i] = desc.owner;
+    return nextId++;
+}
+
+void ProjectileSystem::SaveRounds(std::vector<RoundState> &out) const {
+    out.clear();
+    for (size_t i = 0; i < count; i++) {
+        out.push_back({Position(i), Velocity(i), dragScale[i], flightTime[i], mass[i], caliber[i], rewind[i], dragModel[i], ids[i], owners[i]});
+    }
+}
+
+void ProjectileSystem::RestoreRounds(std::span<const RoundState> rounds, uint32_t nextRoundId) {
+    // Lanes past count must be inert
+    while (count > 0) Remove(count - 1);
+
+    for (const RoundState &round: rounds) {
+        ProjectileDesc desc;
+        desc.position = round.position;
+        desc.velocity = round.velocity;
+        desc.dragModel = round.dragModel;
+        desc.mass = round.mass;
+        desc.caliber = round.caliber;
+        desc.owner = round.owner;
+        desc.rewindTicks = round.rewindTicks;
+
+        const size_t i = count;
+        Spawn(desc);
+        dragScale[i] = round.dragScale;
+        flightTime[i] = round.flightTime;
+        ids[i] = round.id;
+    }
+    nextId = nextRoundId;
+    impacts.clear();
+}
+
+void ProjectileSystem::Integrate(size_t begin, size_t end, float dt) {
+    const UniformDragTable &table = DragTable();
+    const Float4 windX(wind.x), windY(wind.y), windZ(wind.z);
+    const Float4 density(atmosphere.density), invSpeedOfSound(1.0f / atmosphere.speedOfSound);
+    const Float4 gravity(-StandardGravity), step(dt), halfStep(dt * 0.5f);
+
+    for (size_t i = begin; i < end; i += 4) {
+        const Float4 drag = density * Float4::Load(&dragScale[i]);
+
+        auto acceleration = [&](Float4 vx, Float4 vy, Float4 vz, Float4 &ax, Float4 &ay, Float4 &az) {
+            Float4 airX = vx - windX, airY = vy - windY, airZ = vz - windZ;
+            Float4 speed = Sqrt(airX * airX + airY * airY + airZ * airZ);
+
+            float mach[4], cd[4];
+            (speed * invSpeedOfSound).Store(mach);
+            for (int lane = 0; lane < 4; lane++) {
+                cd[lane] = table.Lookup(dragModel[i + lane], mach[lane]);
+            }
+
+            Float4 k = drag * Float4::Load(cd) * speed;
+            ax = Float4(0.0f) - airX * k;
+            ay = gravity - airY * k;
+            az = Float4(0.0f) - airZ * k;
+        };
+
+        Float4 px = Float4::Load(&posX[i]), py = Float4::Load(&posY[i]), pz = Float4::Load(&posZ[i]);
+        Float4 vx = Float4::Load(&velX[i]), vy = Float4::Load(&velY[i]), vz = Float4::Load(&velZ[i]);
+
+        px.Store(&prevX[i]);
+        py.Store(&prevY[i]);
+        pz.Store(&prevZ[i]);
+
+        // Midpoint method: drag evaluated at the half-step velocity
+        Float4 ax, ay, az;
+        acceleration(vx, vy, vz, ax, ay, az);
+        Float4 mx = vx + ax * halfStep, my = vy + ay * halfStep, mz = vz + az * halfStep;
+        acceleration(mx, my, mz, ax, ay, az);
+
+        (px + mx * step).Store(&posX[i]);
+        (py + my * step).Store(&posY[i]);
+        (pz + mz * step).Store(&posZ[i]);
+        (vx + ax * step).Store(&velX[i]);
+        (vy + ay * step).Store(&velY[i]);
+        (vz + az * step).Store(&velZ[i]);
+        (Float4::Load(&flightTime[i]) + step).Store(&flightTime[i]);
+    }
+}
+
+void ProjectileSystem::Remove(size_t index) {
+    size_t last = --count;
+
+    for (std::vector<float> *array: {&posX, &posY, &posZ, &velX, &velY, &velZ, &prevX, &prevY, &prevZ,
+                                     &dragScale, &flightTime, &mass, &caliber, &rewind}) {
+        (*array)[index] = (*array)[last];
+        (*array)[last] = 0.0f;
+    }
+
+    dragModel[index] = dragModel[last];
+    ids[index] = ids[last];
+    owners[index] = owners[last];
+}
+
+bool ProjectileSystem::TerrainCrossing(const Ray &segment, float &t, glm::vec3 &normal) const {
+    glm::vec3 end = segment.origin + segment.direction;
+    if (end.y >= terrain->HeightAt(end.x, end.z)) {
+        return false;
+    }
+
+    // Bisect the segment for the surface crossing
+    float lo = 0.0f, hi = 1.0f;
+    for (int iteration = 0; iteration < 12; iteration++) {
+        float mid = (lo + hi) * 0.5f;
+        glm::vec3 p = segment.origin + segment.direction * mid;
+        (p.y < terrain->HeightAt(p.x, p.z) ? hi : lo) = mid;
+    }
+
+    glm::vec3 p = segment.origin + segment.direction * hi;
+    t = hi;
+    normal = glm::normalize(glm::vec3(terrain->HeightAt(p.x - 0.5f, p.z) - terrain->HeightAt(p.x + 0.5f, p.z), 1.0f,
+                                      terrain->HeightAt(p.x, p.z - 0.5f) - terrain->HeightAt(p.x, p.z + 0.5f)));
+    return true;
+}
+
+bool ProjectileSystem::Resolve(Sweep &sweep, const glm::vec3 &point, const glm::vec3 &normal, float depth, uint32_t primitive,
+                               uint32_t material, float remaining, const HitboxHit *body) {
+    const size_t i = sweep.index;
+    const SurfaceMaterial &surface = materials[material < materials.size() ? material : MaterialConcrete];
+
+    glm::vec3 velocity = sweep.velocity;
+    float speed = glm::length(velocity);
+    glm::vec3 direction = velocity / speed;
+    float cosIncidence = std::min(std::abs(glm::dot(direction, normal)), 1.0f);
+    float grazing = std::asin(cosIncidence) * (180.0f / 3.14159265f);
+
+    ProjectileImpact impact{ids[i], owners[i], ImpactType::Stopped, point, normal, velocity, point, glm::vec3(0.0f),
+                            primitive, material, flightTime[i] - remaining, body ? body->entity : InvalidEntity,
+                            body ? body->part : HitboxPart::Torso};
+
+    if (grazing < surface.ricochetAngle) {
+        impact.type = ImpactType::Ricochet;
+        impact.exitPosition = point + normal * SurfaceOffset;
+        impact.exitVelocity = glm::reflect(velocity, normal) * surface.ricochetRetention;
+    } else {
+        // Boxes give their own depth along the ray; surfaces without volume use the table thickness at this angle
+        float path = depth > 0.0f ? depth : surface.thickness / std::max(cosIncidence, 0.05f);
+        float exitSpeed = SpeedAfterPenetration(surface, speed, path, mass[i], caliber[i]);
+
+        if (exitSpeed > MinimumSpeed) {
+            impact.type = ImpactType::Penetrated;
+            impact.exitPosition = point + direction * (path + SurfaceOffset);
+            impact.exitVelocity = direction * exitSpeed;
+        }
+    }
+
+    impacts.push_back(impact);
+    if (impact.type == ImpactType::Stopped) {
+        return false;
+    }
+
+    // The rest of the tick is flown straight from the exit point
+    sweep.origin = impact.exitPosition;
+    sweep.velocity = impact.exitVelocity;
+    sweep.end = sweep.origin + sweep.velocity * remaining;
+    sweep.time = remaining;
+
+    posX[i] = sweep.end.x;
+    posY[i] = sweep.end.y;
+    posZ[i] = sweep.end.z;
+    velX[i] = sweep.velocity.x;
+    velY[i] = sweep.velocity.y;
+    velZ[i] = sweep.velocity.z;
+    return true;
+}
+
+void ProjectileSystem::Step(float dt, JobSystem *jobs) {
+    auto start = std::chrono::steady_clock::now();
+    impacts.clear();
+
+    const size_t lanes = Padded(count);
+    if (jobs) {
+        jobs->ParallelFor(lanes / 4, 256, [&](size_t begin, size_t end) { Integrate(begin * 4, end * 4, dt); });
+    } else {
+        Integrate(0, lanes, dt);
+    }
+
+    auto integrated = std::chrono::steady_clock::now();
+
+    // One segment per round for this tick
+    sweeps.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        sweeps[i] = {i, glm::vec3(prevX[i], prevY[i], prevZ[i]), Position(i), Velocity(i), dt};
+    }
+    stopped.assign(count, 0);
+
+    // Each pass is its own RaycastBatch() over the rounds still sweeping, so a tick with penetrations or ricochets
+    // queries the BVH up to MaxInteractions times; the rounds that carry on go again with the rest of their segment.
+    // Passes resolve in round order, so the result does not depend on how a batch was split over workers.
+    for (int pass = 0; pass < MaxInteractions && !sweeps.empty(); pass++) {
+        sweepRays.resize(sweeps.size());
+        sweepHits.resize(sweeps.size());
+        for (size_t k = 0; k < sweeps.size(); k++) {
+            sweepRays[k].origin = sweeps[k].origin;
+            sweepRays[k].direction = sweeps[k].end - sweeps[k].origin;
+            sweepRays[k].tMax = 1.0f;                 // t is in units of the segment
+        }
+        world.RaycastBatch(sweepRays, sweepHits, jobs);
+
+        continued.clear();
+        for (size_t k = 0; k < sweeps.size(); k++) {
+            Sweep sweep = sweeps[k];
+            const Ray &segment = sweepRays[k];
+            const RayHit &hit = sweepHits[k];
+
+            float t = 1.0f;
+            glm::vec3 normal;
+            uint32_t primitive = InvalidPrimitive, material = 0;
+            float depth = 0.0f;
+            bool found = true;
+
+            if (hit.IsHit()) {
+                t = hit.t;
+                normal = hit.normal;
+                primitive = hit.primitive;
+                material = hit.material;
+                depth = (hit.exitT - hit.t) * glm::length(segment.direction);
+            } else if (terrain && TerrainCrossing(segment, t, normal)) {
+                primitive = InvalidPrimitive;
+                material = terrainMaterial;
+                depth = INFINITY;                     // the ground has no far side
+            } else {
+                t = 1.0f;
+                found = false;
+            }
+
+            // A body in front of whatever the world sweep found
+            HitboxHit body;
+            Ray toWorld = segment;
+            toWorld.tMax = t;
+            const bool hitBody = targets && targets->Raycast(toWorld, static_cast<double>(targets->NewestTick()) - rewind[sweep.index],
+                                                             owners[sweep.index], body);
+            if (hitBody) {
+                t = body.t;
+                normal = body.normal;
+                primitive = InvalidPrimitive;
+                material = MaterialFlesh;
+                depth = body.depth;
+            } else if (!found) {
+                continue;
+            }
+
+            if (Resolve(sweep, segment.origin + segment.direction * t, normal, depth, primitive, material, sweep.time * (1.0f - t),
+                        hitBody ? &body : nullptr)) {
+                continued.push_back(sweep);
+            } else {
+                stopped[sweep.index] = 1;
+            }
+        }
+        std::swap(sweeps, continued);
+    }
+
+    // Resolve() already moved these to the end of a segment nothing has swept; hold them at their last exit point so
+    // next tick's segment starts there rather than past whatever lies beyond it
+    for (const Sweep &sweep: sweeps) {
+        posX[sweep.index] = sweep.origin.x;
+        posY[sweep.index] = sweep.origin.y;
+        posZ[sweep.index] = sweep.origin.z;
+    }
+
+    // Backwards, so the round swapped into a removed slot has already been handled
+    for (size_t i = count; i-- > 0;) {
+        if (stopped[i] || flightTime[i] > maxFlightTime) {
+            Remove(i);
+        }
+    }
+
+    stats.active = count;
+    stats.impacts = impacts.size();
+    stats.integrateMs = std::chrono::duration<double, std::milli>(integrated - start).count();
+    stats.sweepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - integrated).count();
+}
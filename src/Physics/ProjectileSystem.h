@@ -0,0 +1,168 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Ballistics.h"
+#include "HitboxHistory.h"
+#include "StaticBvh.h"
+#include "SurfaceMaterial.h"
+#include "../Core/JobSystem.h"
+
+class Heightfield;
+
+struct ProjectileDesc {
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 velocity = glm::vec3(0.0f);
+    DragModel dragModel = DragModel::G7;
+    float ballisticCoefficient = 0.151f;      // lb/in^2; the default is 5.56 mm M855
+    float mass = 0.004f;                      // kg
+    float caliber = 0.0057f;                  // m
+    uint32_t owner = 0;                       // never hit by its own rounds
+    float rewindTicks = 0.0f;                 // lag compensation: how far behind the server the shooter saw targets
+};
+
+enum class ImpactType {
+    Stopped,                                  // the round ends here
+    Penetrated,                               // passed through and left at exitPosition
+    Ricochet,                                 // bounced off with exitVelocity
+};
+
+struct ProjectileImpact {
+    uint32_t projectile;                      // id returned by Spawn
+    uint32_t owner;
+    ImpactType type;
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec3 velocity;                       // at impact
+    glm::vec3 exitPosition;                   // where the round continues from; equals position when stopped
+    glm::vec3 exitVelocity;                   // zero when stopped
+    uint32_t primitive;                       // InvalidPrimitive for terrain
+    uint32_t material;
+    float flightTime;
+    uint32_t target;                          // entity whose hitbox was hit, or InvalidEntity
+    HitboxPart part;
+};
+
+// Every round in flight, stored as structure-of-arrays so the integrator runs four rounds per Float4 operation.
+// Step() advances all rounds by one fixed tick with a midpoint (RK2) drag integration, then sweeps each round's
+// segment for the tick against the world BVH (batched over the job system) and the terrain.
+//
+// Each hit is resolved against the surface material table: grazing hits ricochet, others penetrate if the round keeps
+// speed through the material's thickness (the box's own depth, or the table thickness for triangles) and stop otherwise.
+// Rounds that carry on are re-swept for the rest of the tick by another RaycastBatch() call over just those rounds, up
+// to MaxInteractions calls per tick; a round still going after the last one is held at its last exit point, and the
+// rest of its path is swept from there next tick. Resolution has no randomness and runs in round order, so a replay
+// reproduces it exactly.
+// Every interaction is reported in Impacts(); stopped rounds are removed.
+//
+// With SetTargets() each segment is also tested against entity hitboxes as they were rewindTicks before the newest
+// recorded tick, so a round hits whoever was in its path on the shooter's screen. Bodies are MaterialFlesh and resolve
+// like any other surface: a rifle round can pass through one and carry on.
+class ProjectileSystem {
+public:
+    struct Stats {
+        size_t active = 0;
+        size_t impacts = 0;                   // last Step()
+        double integrateMs = 0.0;
+        double sweepMs = 0.0;
+    };
+
+    static constexpr int MaxInteractions = 4;
+
+    // One round in flight, for saving the system with the rest of the simulation (replay keyframes)
+    struct RoundState {
+        glm::vec3 position;
+        glm::vec3 velocity;
+        float dragScale;
+        float flightTime;
+        float mass;
+        float caliber;
+        float rewindTicks;
+        DragModel dragModel;
+        uint32_t id;
+        uint32_t owner;
+    };
+
+    explicit ProjectileSystem(const StaticBvh &world, const Heightfield *terrain = nullptr, uint32_t terrainMaterial = MaterialSoil);
+
+    uint32_t Spawn(const ProjectileDesc &desc);
+
+    // Indexed by the material ids given to StaticGeometry; DefaultSurfaceMaterials() until set
+    void SetSurfaceMaterials(std::vector<SurfaceMaterial> value) { materials = std::move(value); }
+
+    void SetAtmosphere(const Atmosphere &value) { atmosphere = value; }
+    void SetWind(const glm::vec3 &value) { wind = value; }
+    void SetMaxFlightTime(float seconds) { maxFlightTime = seconds; }
+
+    // Recorded by the owner each tick before Step(); null turns entity hits off
+    void SetTargets(const HitboxHistory *value) { targets = value; }
+
+    void Step(float dt, JobSystem *jobs = nullptr);
+
+    // Rounds in flight in storage order, which is the order they resolve in; RestoreRounds() replaces every round
+    // and the next id, so the following ticks play out exactly as they did from the save
+    void SaveRounds(std::vector<RoundState> &out) const;
+    void RestoreRounds(std::span<const RoundState> rounds, uint32_t nextRoundId);
+    uint32_t NextId() const { return nextId; }
+
+    size_t ActiveCount() const { return count; }
+    const std::vector<ProjectileImpact> &Impacts() const { return impacts; }
+    const Stats &GetStats() const { return stats; }
+
+    // Read access for tracers and debugging; index < ActiveCount(), order changes as rounds are removed
+    glm::vec3 Position(size_t index) const { return {posX[index], posY[index], posZ[index]}; }
+    glm::vec3 Velocity(size_t index) const { return {velX[index], velY[index], velZ[index]}; }
+    uint32_t Id(size_t index) const { return ids[index]; }
+
+private:
+    void Integrate(size_t begin, size_t end, float dt);
+    void Remove(size_t index);
+
+    // Where one round's sweep stands during Step(): the segment still to test and the tick time it covers
+    struct Sweep {
+        size_t index;
+        glm::vec3 origin;
+        glm::vec3 end;
+        glm::vec3 velocity;
+        float time;
+    };
+
+    bool Resolve(Sweep &sweep, const glm::vec3 &point, const glm::vec3 &normal, float depth, uint32_t primitive,
+                 uint32_t material, float remaining, const HitboxHit *body = nullptr);
+    bool TerrainCrossing(const Ray &segment, float &t, glm::vec3 &normal) const;
+
+    const StaticBvh &world;
+    const Heightfield *terrain;
+    uint32_t terrainMaterial;
+    std::vector<SurfaceMaterial> materials;
+    const HitboxHistory *targets = nullptr;
+
+    Atmosphere atmosphere;
+    glm::vec3 wind = glm::vec3(0.0f);
+    float maxFlightTime = 10.0f;
+
+    // Arrays are padded to a multiple of four; lanes past count are inert
+    size_t count = 0;
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> prevX, prevY, prevZ;   // start of the current tick's segment
+    std::vector<float> dragScale;
+    std::vector<float> flightTime;
+    std::vector<float> mass;
+    std::vector<float> caliber;
+    std::vector<float> rewind;
+    std::vector<DragModel> dragModel;
+    std::vector<uint32_t> ids, owners;
+    uint32_t nextId = 0;
+
+    std::vector<Sweep> sweeps, continued;
+    std::vector<Ray> sweepRays;
+    std::vector<RayHit> sweepHits;
+    std::vector<uint8_t> stopped;
+    std::vector<ProjectileImpact> impacts;
+    Stats stats;
+};
@@ -0,0 +1,226 @@
+#include "SpatialHash.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Cell coordinates packed 21 bits per axis, so keys are unique within +-2^20 cells of the origin
+    constexpr int KeyBits = 21;
+    constexpr int32_t KeyBias = 1 << (KeyBits - 1);
+    constexpr uint64_t KeyMask = (uint64_t(1) << KeyBits) - 1;
+
+    // Smallest share of the entities worth a chunk of the parallel counting sort
+    constexpr size_t MinChunkSize = 8192;
+
+    uint64_t PackCell(int32_t x, int32_t y, int32_t z) {
+        return (static_cast<uint64_t>(x + KeyBias) & KeyMask) |
+               ((static_cast<uint64_t>(y + KeyBias) & KeyMask) << KeyBits) |
+               ((static_cast<uint64_t>(z + KeyBias) & KeyMask) << (2 * KeyBits));
+    }
+
+    int32_t CellCoordinate(float value, float invSize) {
+        constexpr float Limit = static_cast<float>(KeyBias - 1);
+        return static_cast<int32_t>(std::clamp(std::floor(value * invSize), -Limit, Limit));
+    }
+
+    glm::ivec3 UnpackCell(uint64_t key) {
+        return glm::ivec3(static_cast<int32_t>(key & KeyMask) - KeyBias,
+                          static_cast<int32_t>((key >> KeyBits) & KeyMask) - KeyBias,
+                          static_cast<int32_t>((key >> (2 * KeyBits)) & KeyMask) - KeyBias);
+    }
+}
+
+SpatialHash::SpatialHash(float cellSize, float cellHeight, uint32_t bucketCount)
+    : cellSize(cellSize, cellHeight, cellSize), invCellSize(1.0f / cellSize, 1.0f / cellHeight, 1.0f / cellSize),
+      bucketCount(bucketCount), bucketShift(64 - std::countr_zero(bucketCount)) {
+    if (!(cellSize > 0.0f) || !(cellHeight > 0.0f) || bucketCount < 2 || !std::has_single_bit(bucketCount)) {
+        throw std::runtime_error("Spatial Hash Needs Positive Cell Sizes and a Power of Two Bucket Count");
+    }
+
+    bucketStart.assign(bucketCount + 1, 0);
+}
+
+glm::ivec3 SpatialHash::CellOf(const glm::vec3 &p) const {
+    return glm::ivec3(CellCoordinate(p.x, invCellSize.x), CellCoordinate(p.y, invCellSize.y), CellCoordinate(p.z, invCellSize.z));
+}
+
+uint32_t SpatialHash::BucketOf(uint64_t key) const {
+    // Fibonacci hashing: the top bits of the product depend on every axis
+    return static_cast<uint32_t>((key * 0x9e3779b97f4a7c15ull) >> bucketShift);
+}
+
+void SpatialHash::Build(std::span<const glm::vec3> positions, std::span<const float> radii, JobSystem *jobs) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (!radii.empty() && radii.size() != positions.size()) {
+        throw std::runtime_error("Spatial Hash Radii Must Match Positions");
+    }
+
+    const size_t count = positions.size();
+    // Chunks are contiguous index ranges written in order within each bucket, so a bucket always lists its entities
+    // by index and the result does not depend on how many chunks ran
+    size_t threads = jobs ? jobs->WorkerCount() + 1 : 1;
+    chunkCount = static_cast<int>(std::clamp<size_t>(count / MinChunkSize, 1, threads));
+
+    keys.resize(count);
+    buckets.resize(count);
+    sortedKey.resize(count);
+    sortedEntity.resize(count);
+    sortedSphere.resize(count);
+    chunkOffsets.assign(static_cast<size_t>(bucketCount) * chunkCount, 0);
+
+    // Histograms are interleaved per bucket (bucket * chunkCount + chunk) so the prefix sum walks memory in order
+    std::vector<float> chunkMaxRadius(chunkCount, 0.0f);
+    auto chunkBegin = [&](size_t chunk) { return count * chunk / chunkCount; };
+
+    auto forChunks = [&](auto &&fn) {
+        if (jobs && chunkCount > 1) {
+            jobs->ParallelFor(chunkCount, 1, [&](size_t begin, size_t end) {
+                for (size_t chunk = begin; chunk < end; chunk++) fn(chunk);
+            });
+        } else {
+            for (int chunk = 0; chunk < chunkCount; chunk++) fn(chunk);
+        }
+    };
+
+    forChunks([&](size_t chunk) {
+        const float invX = invCellSize.x, invY = invCellSize.y, invZ = invCellSize.z;
+        uint32_t *histogram = chunkOffsets.data() + chunk;
+        float maxRadius = 0.0f;
+
+        for (size_t i = chunkBegin(chunk), end = chunkBegin(chunk + 1); i < end; i++) {
+            const glm::vec3 &p = positions[i];
+            uint64_t key = PackCell(CellCoordinate(p.x, invX), CellCoordinate(p.y, invY), CellCoordinate(p.z, invZ));
+            uint32_t bucket = BucketOf(key);
+            keys[i] = key;
+            buckets[i] = bucket;
+            histogram[static_cast<size_t>(bucket) * chunkCount]++;
+        }
+
+        if (!radii.empty()) {
+            for (size_t i = chunkBegin(chunk), end = chunkBegin(chunk + 1); i < end; i++) {
+                maxRadius = std::max(maxRadius, radii[i]);
+            }
+        }
+        chunkMaxRadius[chunk] = maxRadius;
+    });
+
+    // Exclusive prefix sum over (bucket, chunk): each chunk gets its own write cursor within every bucket
+    uint32_t running = 0;
+    stats.occupiedBuckets = 0;
+    stats.largestBucket = 0;
+    for (uint32_t b = 0; b < bucketCount; b++) {
+        bucketStart[b] = running;
+        for (int chunk = 0; chunk < chunkCount; chunk++) {
+            uint32_t &slot = chunkOffsets[static_cast<size_t>(b) * chunkCount + chunk];
+            uint32_t n = slot;
+            slot = running;
+            running += n;
+        }
+
+        uint32_t size = running - bucketStart[b];
+        stats.occupiedBuckets += size > 0 ? 1 : 0;
+        stats.largestBucket = std::max(stats.largestBucket, size);
+    }
+    bucketStart[bucketCount] = running;
+
+    forChunks([&](size_t chunk) {
+        for (size_t i = chunkBegin(chunk), end = chunkBegin(chunk + 1); i < end; i++) {
+            uint32_t slot = chunkOffsets[static_cast<size_t>(buckets[i]) * chunkCount + chunk]++;
+            sortedKey[slot] = keys[i];
+            sortedEntity[slot] = static_cast<uint32_t>(i);
+            sortedSphere[slot] = glm::vec4(positions[i], radii.empty() ? 0.0f : radii[i]);
+        }
+    });
+
+    stats.entities = count;
+    stats.maxRadius = *std::max_element(chunkMaxRadius.begin(), chunkMaxRadius.end());
+    stats.buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Visit>
+void SpatialHash::VisitCells(const glm::ivec3 &lo, const glm::ivec3 &hi, Visit visit) const {
+    glm::ivec3 extent = hi - lo + glm::ivec3(1);
+    uint64_t cells = static_cast<uint64_t>(extent.x) * static_cast<uint64_t>(extent.y) * static_cast<uint64_t>(extent.z);
+
+    // A query covering more cells than there are entries is cheaper as a scan of the whole table
+    if (cells > sortedKey.size()) {
+        for (size_t j = 0; j < sortedKey.size(); j++) {
+            glm::ivec3 cell = UnpackCell(sortedKey[j]);
+            if (cell.x >= lo.x && cell.y >= lo.y && cell.z >= lo.z && cell.x <= hi.x && cell.y <= hi.y && cell.z <= hi.z) {
+                visit(j);
+            }
+        }
+        return;
+    }
+
+    for (int z = lo.z; z <= hi.z; z++) {
+        for (int y = lo.y; y <= hi.y; y++) {
+            for (int x = lo.x; x <= hi.x; x++) {
+                uint64_t key = PackCell(x, y, z);
+                uint32_t bucket = BucketOf(key);
+
+                for (uint32_t j = bucketStart[bucket]; j < bucketStart[bucket + 1]; j++) {
+                    if (sortedKey[j] == key) visit(j);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHash::QuerySphere(const glm::vec3 &center, float radius, std::vector<uint32_t> &out) const {
+    glm::vec3 reach(radius + stats.maxRadius);
+
+    VisitCells(CellOf(center - reach), CellOf(center + reach), [&](size_t j) {
+        const glm::vec4 &sphere = sortedSphere[j];
+        glm::vec3 d = glm::vec3(sphere) - center;
+        float r = radius + sphere.w;
+        if (glm::dot(d, d) <= r * r) out.push_back(sortedEntity[j]);
+    });
+}
+
+void SpatialHash::QueryBox(const glm::vec3 &min, const glm::vec3 &max, std::vector<uint32_t> &out) const {
+    glm::vec3 reach(stats.maxRadius);
+
+    VisitCells(CellOf(min - reach), CellOf(max + reach), [&](size_t j) {
+        const glm::vec4 &sphere = sortedSphere[j];
+        glm::vec3 d = glm::vec3(sphere) - glm::clamp(glm::vec3(sphere), min, max);
+        if (glm::dot(d, d) <= sphere.w * sphere.w) out.push_back(sortedEntity[j]);
+    });
+}
+
+void SpatialHash::QueryRay(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance,
+                           std::vector<SpatialRayHit> &out) const {
+    const size_t first = out.size();
+    glm::vec3 reach(stats.maxRadius);
+
+    // March in pieces one cell long; each piece visits the cells its bounds (grown by the largest radius) overlap.
+    // Neighbouring pieces share cells, so hits are de-duplicated afterwards.
+    int pieces = std::max(1, static_cast<int>(std::ceil(maxDistance * std::max(invCellSize.x, invCellSize.y))));
+    for (int piece = 0; piece < pieces; piece++) {
+        glm::vec3 a = origin + direction * (maxDistance * static_cast<float>(piece) / static_cast<float>(pieces));
+        glm::vec3 b = origin + direction * (maxDistance * static_cast<float>(piece + 1) / static_cast<float>(pieces));
+
+        VisitCells(CellOf(glm::min(a, b) - reach), CellOf(glm::max(a, b) + reach), [&](size_t j) {
+            const glm::vec4 &sphere = sortedSphere[j];
+            glm::vec3 toCenter = glm::vec3(sphere) - origin;
+            float along = glm::dot(toCenter, direction);
+            float miss = glm::dot(toCenter, toCenter) - along * along;
+            float r2 = sphere.w * sphere.w;
+            if (miss > r2) return;
+
+            float half = std::sqrt(r2 - miss);
+            float t = std::max(along - half, 0.0f);
+            if (along + half >= 0.0f && t <= maxDistance) out.push_back({sortedEntity[j], t});
+        });
+    }
+
+    auto hits = out.begin() + static_cast<std::ptrdiff_t>(first);
+    std::sort(hits, out.end(), [](const SpatialRayHit &x, const SpatialRayHit &y) { return x.entity < y.entity; });
+    out.erase(std::unique(hits, out.end(), [](const SpatialRayHit &x, const SpatialRayHit &y) { return x.entity == y.entity; }), out.end());
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(),
+              [](const SpatialRayHit &x, const SpatialRayHit &y) { return x.t < y.t || (x.t == y.t && x.entity < y.entity); });
+}
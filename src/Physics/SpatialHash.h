@@ -0,0 +1,71 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+
+struct SpatialRayHit {
+    uint32_t entity;
+    float t;                                  // along the unit ray direction
+};
+
+// Broadphase for moving entities, rebuilt from scratch every tick. Each entity is filed under the one grid cell that
+// holds its centre (loose bucketing: its radius may spill into neighbours, which queries cover by growing their
+// bounds by the largest radius). Cells hash into a fixed power-of-two bucket table and Build() is a parallel counting
+// sort into that table, so nothing is allocated per cell and a rebuild only touches flat arrays. Entries keep their
+// packed cell key, which lets a query skip entities from other cells that share a bucket. Cells are taller than they
+// are wide by default: nearly everything lives within a few metres of the ground, and tall cells keep a sphere query
+// from walking empty layers of sky.
+class SpatialHash {
+public:
+    struct Stats {
+        size_t entities = 0;
+        size_t occupiedBuckets = 0;
+        uint32_t largestBucket = 0;
+        float maxRadius = 0.0f;
+        double buildMs = 0.0;
+    };
+
+    explicit SpatialHash(float cellSize = 8.0f, float cellHeight = 32.0f, uint32_t bucketCount = 1u << 16);
+
+    // radii may be empty for point entities; otherwise one per position
+    void Build(std::span<const glm::vec3> positions, std::span<const float> radii = {}, JobSystem *jobs = nullptr);
+
+    // Append the index of every entity whose sphere touches the query; each entity is reported once
+    void QuerySphere(const glm::vec3 &center, float radius, std::vector<uint32_t> &out) const;
+    void QueryBox(const glm::vec3 &min, const glm::vec3 &max, std::vector<uint32_t> &out) const;
+
+    // Entities whose sphere the ray enters within maxDistance, nearest first; direction must be unit length
+    void QueryRay(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, std::vector<SpatialRayHit> &out) const;
+
+    const Stats &GetStats() const { return stats; }
+    glm::vec3 CellSize() const { return cellSize; }
+
+private:
+    glm::ivec3 CellOf(const glm::vec3 &p) const;
+    uint32_t BucketOf(uint64_t key) const;
+
+    template <typename Visit>
+    void VisitCells(const glm::ivec3 &lo, const glm::ivec3 &hi, Visit visit) const;
+
+    glm::vec3 cellSize, invCellSize;
+    uint32_t bucketCount;
+    int bucketShift;
+    int chunkCount = 1;
+
+    // bucketStart[b]..bucketStart[b + 1] index the sorted arrays
+    std::vector<uint32_t> bucketStart;
+    std::vector<uint64_t> sortedKey;
+    std::vector<uint32_t> sortedEntity;
+    std::vector<glm::vec4> sortedSphere;      // xyz centre, w radius
+
+    // Build scratch: each entity's key and bucket, and per-chunk bucket histograms
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> buckets;
+    std::vector<uint32_t> chunkOffsets;
+
+    Stats stats;
+};
@@ -0,0 +1,642 @@
+#include "StaticBvh.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <functional>
+
+#include "../Core/Simd.h"
+
+namespace {
+    constexpr uint32_t MaxLeafSize = 4;
+    constexpr int SahBins = 12;
+    constexpr float TraversalCost = 1.0f;     // relative to one primitive test
+
+    // Traversal stacks are fixed arrays: a depth-first walk of a 4-wide tree holds at most three siblings per level
+    // plus the four children just pushed, so the build stops splitting deep enough that they can never overflow
+    constexpr int StackSize = 64;
+    constexpr int MaxBuildDepth = (StackSize - 1) / 3;
+
+    struct BuildItem {
+        glm::vec3 min, max, centroid;
+        uint32_t index;
+        bool box;
+    };
+
+    float SurfaceArea(const glm::vec3 &min, const glm::vec3 &max) {
+        glm::vec3 d = glm::max(max - min, glm::vec3(0.0f));
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    // Slab test against one box for ray setup shared with the 4-wide version
+    glm::vec3 SafeInverse(const glm::vec3 &d) {
+        glm::vec3 inv;
+        for (int i = 0; i < 3; i++) {
+            inv[i] = 1.0f / (std::abs(d[i]) > 1e-20f ? d[i] : std::copysign(1e-20f, d[i]));
+        }
+        return inv;
+    }
+}
+
+uint32_t StaticGeometry::AddTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, uint32_t material) {
+    triangles.push_back({a, b, c, nextId, material});
+    return nextId++;
+}
+
+uint32_t StaticGeometry::AddBox(const glm::mat4 &transform, uint32_t material) {
+    Box box;
+    box.center = glm::vec3(transform[3]);
+
+    glm::mat3 axes;
+    for (int i = 0; i < 3; i++) {
+        float length = glm::length(glm::vec3(transform[i]));
+        box.halfExtents[i] = 0.5f * length;
+        axes[i] = length > 0.0f ? glm::vec3(transform[i]) / length : glm::vec3(0.0f);
+    }
+
+    box.toLocal = glm::transpose(axes);
+    box.id = nextId;
+    box.material = material;
+    boxes.push_back(box);
+    return nextId++;
+}
+
+uint32_t StaticGeometry::AddMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices,
+                                 const glm::mat4 &transform, uint32_t material) {
+    uint32_t first = nextId;
+
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        AddTriangle(glm::vec3(transform * glm::vec4(positions[indices[i]], 1.0f)),
+                    glm::vec3(transform * glm::vec4(positions[indices[i + 1]], 1.0f)),
+                    glm::vec3(transform * glm::vec4(positions[indices[i + 2]], 1.0f)), material);
+    }
+
+    return first;
+}
+
+struct StaticBvh::BuildNode {
+    glm::vec3 min, max;
+    int left = -1, right = -1;
+    uint32_t first = 0, count = 0;
+};
+
+StaticBvh::StaticBvh(const StaticGeometry &geometry) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<BuildItem> items;
+    items.reserve(geometry.triangles.size() + geometry.boxes.size());
+
+    for (uint32_t i = 0; i < geometry.triangles.size(); i++) {
+        const StaticGeometry::Triangle &t = geometry.triangles[i];
+        glm::vec3 min = glm::min(t.a, glm::min(t.b, t.c)), max = glm::max(t.a, glm::max(t.b, t.c));
+        items.push_back({min, max, (min + max) * 0.5f, i, false});
+    }
+
+    for (uint32_t i = 0; i < geometry.boxes.size(); i++) {
+        const StaticGeometry::Box &b = geometry.boxes[i];
+        glm::mat3 axes = glm::transpose(b.toLocal);
+        glm::vec3 extent = glm::abs(axes[0]) * b.halfExtents.x + glm::abs(axes[1]) * b.halfExtents.y +
+                           glm::abs(axes[2]) * b.halfExtents.z;
+        items.push_back({b.center - extent, b.center + extent, b.center, i, true});
+    }
+
+    if (items.empty()) {
+        return;
+    }
+
+    // Binary SAH tree over the items
+    std::vector<BuildNode> buildNodes;
+    std::function<int(uint32_t, uint32_t, int)> build = [&](uint32_t begin, uint32_t end, int depth) -> int {
+        BuildNode node;
+        node.min = glm::vec3(INFINITY);
+        node.max = glm::vec3(-INFINITY);
+        glm::vec3 cmin(INFINITY), cmax(-INFINITY);
+
+        for (uint32_t i = begin; i < end; i++) {
+            node.min = glm::min(node.min, items[i].min);
+            node.max = glm::max(node.max, items[i].max);
+            cmin = glm::min(cmin, items[i].centroid);
+            cmax = glm::max(cmax, items[i].centroid);
+        }
+
+        const uint32_t count = end - begin;
+        int bestAxis = -1, bestSplit = 0;
+        float bestCost = INFINITY;
+
+        for (int axis = 0; axis < 3 && count > 1; axis++) {
+            float extent = cmax[axis] - cmin[axis];
+            if (extent <= 0.0f) continue;
+
+            uint32_t binCount[SahBins] = {};
+            glm::vec3 binMin[SahBins], binMax[SahBins];
+            std::fill(std::begin(binMin), std::end(binMin), glm::vec3(INFINITY));
+            std::fill(std::begin(binMax), std::end(binMax), glm::vec3(-INFINITY));
+
+            for (uint32_t i = begin; i < end; i++) {
+                int bin = std::min(static_cast<int>((items[i].centroid[axis] - cmin[axis]) / extent * SahBins), SahBins - 1);
+                binCount[bin]++;
+                binMin[bin] = glm::min(binMin[bin], items[i].min);
+                binMax[bin] = glm::max(binMax[bin], items[i].max);
+            }
+
+            // Right-to-left sweep stores the right side costs, the left-to-right sweep completes them
+            float rightCost[SahBins];
+            glm::vec3 rmin(INFINITY), rmax(-INFINITY);
+            uint32_t rcount = 0;
+            for (int b = SahBins - 1; b > 0; b--) {
+                rmin = glm::min(rmin, binMin[b]);
+                rmax = glm::max(rmax, binMax[b]);
+                rcount += binCount[b];
+                rightCost[b] = rcount ? SurfaceArea(rmin, rmax) * static_cast<float>(rcount) : 0.0f;
+            }
+
+            glm::vec3 lmin(INFINITY), lmax(-INFINITY);
+            uint32_t lcount = 0;
+            for (int b = 0; b < SahBins - 1; b++) {
+                lmin = glm::min(lmin, binMin[b]);
+                lmax = glm::max(lmax, binMax[b]);
+                lcount += binCount[b];
+
+                if (lcount == 0 || lcount == count) continue;
+
+                float cost = SurfaceArea(lmin, lmax) * static_cast<float>(lcount) + rightCost[b + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = b;
+                }
+            }
+        }
+
+        float area = SurfaceArea(node.min, node.max);
+        float splitCost = area > 0.0f ? TraversalCost + bestCost / area : TraversalCost;
+
+        // A 4-wide level is at least one binary level, so capping the binary depth caps the collapsed tree's
+        if (depth >= MaxBuildDepth || (count <= MaxLeafSize && (bestAxis < 0 || splitCost >= static_cast<float>(count)))) {
+            node.first = begin;
+            node.count = count;
+            buildNodes.push_back(node);
+            return static_cast<int>(buildNodes.size() - 1);
+        }
+
+        uint32_t mid;
+        if (bestAxis >= 0) {
+            float extent = cmax[bestAxis] - cmin[bestAxis];
+            auto split = std::partition(items.begin() + begin, items.begin() + end, [&](const BuildItem &item) {
+                int bin = std::min(static_cast<int>((item.centroid[bestAxis] - cmin[bestAxis]) / extent * SahBins), SahBins - 1);
+                return bin <= bestSplit;
+            });
+            mid = static_cast<uint32_t>(split - items.begin());
+        } else {
+            // Coincident centroids: any halving is as good as another
+            mid = begin + count / 2;
+        }
+
+        int index = static_cast<int>(buildNodes.size());
+        buildNodes.push_back(node);
+
+        int left = build(begin, mid, depth + 1);
+        int right = build(mid, end, depth + 1);
+        buildNodes[index].left = left;
+        buildNodes[index].right = right;
+        return index;
+    };
+
+    build(0, static_cast<uint32_t>(items.size()), 0);
+
+    // Collapse into 4-wide nodes by repeatedly opening the largest interior child
+    std::function<int32_t(int, int)> collapse = [&](int index, int depth) -> int32_t {
+        const BuildNode &node = buildNodes[index];
+        stats.depth = std::max(stats.depth, depth);
+
+        if (node.left < 0) {
+            Leaf leaf{static_cast<uint32_t>(blocks.size()), 0, static_cast<uint32_t>(boxes.size()), 0};
+            TriangleBlock block{};
+            int lane = 0;
+
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                const BuildItem &item = items[i];
+
+                if (item.box) {
+                    boxes.push_back(geometry.boxes[item.index]);
+                    leaf.boxCount++;
+                    continue;
+                }
+
+                const StaticGeometry::Triangle &t = geometry.triangles[item.index];
+                glm::vec3 e1 = t.b - t.a, e2 = t.c - t.a;
+                block.v0x[lane] = t.a.x; block.v0y[lane] = t.a.y; block.v0z[lane] = t.a.z;
+                block.e1x[lane] = e1.x; block.e1y[lane] = e1.y; block.e1z[lane] = e1.z;
+                block.e2x[lane] = e2.x; block.e2y[lane] = e2.y; block.e2z[lane] = e2.z;
+                block.id[lane] = t.id;
+                block.material[lane] = t.material;
+
+                if (++lane == 4) {
+                    blocks.push_back(block);
+                    block = {};
+                    lane = 0;
+                }
+            }
+
+            if (lane > 0) {
+                blocks.push_back(block);
+            }
+
+            leaf.blockCount = static_cast<uint32_t>(blocks.size()) - leaf.firstBlock;
+            leaves.push_back(leaf);
+            return ~static_cast<int32_t>(leaves.size() - 1);
+        }
+
+        std::vector<int> children = {node.left, node.right};
+        while (children.size() < 4) {
+            int widest = -1;
+            float widestArea = -1.0f;
+
+            for (size_t c = 0; c < children.size(); c++) {
+                const BuildNode &child = buildNodes[children[c]];
+                float area = SurfaceArea(child.min, child.max);
+                if (child.left >= 0 && area > widestArea) {
+                    widest = static_cast<int>(c);
+                    widestArea = area;
+                }
+            }
+
+            if (widest < 0) break;
+
+            int opened = children[widest];
+            children[widest] = buildNodes[opened].left;
+            children.push_back(buildNodes[opened].right);
+        }
+
+        auto nodeIndex = static_cast<int32_t>(nodes.size());
+        nodes.emplace_back();
+
+        Node4 out{};
+        out.childCount = static_cast<int32_t>(children.size());
+
+        for (size_t c = 0; c < 4; c++) {
+            if (c >= children.size()) {
+                out.minX[c] = out.minY[c] = out.minZ[c] = 0.0f;
+                out.maxX[c] = out.maxY[c] = out.maxZ[c] = 0.0f;
+                out.child[c] = 0;
+                continue;
+            }
+
+            const BuildNode &child = buildNodes[children[c]];
+            out.minX[c] = child.min.x; out.minY[c] = child.min.y; out.minZ[c] = child.min.z;
+            out.maxX[c] = child.max.x; out.maxY[c] = child.max.y; out.maxZ[c] = child.max.z;
+            out.child[c] = collapse(children[c], depth + 1);
+        }
+
+        nodes[nodeIndex] = out;
+        return nodeIndex;
+    };
+
+    boundsMin = buildNodes[0].min;
+    boundsMax = buildNodes[0].max;
+    root = collapse(0, 0);
+
+    stats.nodes = nodes.size();
+    stats.leaves = leaves.size();
+    stats.triangles = geometry.triangles.size();
+    stats.boxes = geometry.boxes.size();
+    stats.buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void StaticBvh::IntersectLeaf(const Leaf &leaf, const Ray &ray, RayHit &hit) const {
+    const Float4 ox(ray.origin.x), oy(ray.origin.y), oz(ray.origin.z);
+    const Float4 dx(ray.direction.x), dy(ray.direction.y), dz(ray.direction.z);
+    const Float4 zero(0.0f), one(1.0f), epsilon(1e-12f);
+
+    for (uint32_t b = leaf.firstBlock; b < leaf.firstBlock + leaf.blockCount; b++) {
+        const TriangleBlock &block = blocks[b];
+        Float4 e1x = Float4::Load(block.e1x), e1y = Float4::Load(block.e1y), e1z = Float4::Load(block.e1z);
+        Float4 e2x = Float4::Load(block.e2x), e2y = Float4::Load(block.e2y), e2z = Float4::Load(block.e2z);
+
+        // Moller-Trumbore, four triangles per iteration, double sided
+        Float4 px = dy * e2z - dz * e2y, py = dz * e2x - dx * e2z, pz = dx * e2y - dy * e2x;
+        Float4 det = e1x * px + e1y * py + e1z * pz;
+        Float4 inv = one / Select(Abs(det) > epsilon, det, one);
+
+        Float4 sx = ox - Float4::Load(block.v0x), sy = oy - Float4::Load(block.v0y), sz = oz - Float4::Load(block.v0z);
+        Float4 u = (sx * px + sy * py + sz * pz) * inv;
+        Float4 qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+        Float4 v = (dx * qx + dy * qy + dz * qz) * inv;
+        Float4 t = (e2x * qx + e2y * qy + e2z * qz) * inv;
+
+        Float4 mask = (Abs(det) > epsilon) & (u >= zero) & (v >= zero) & (u + v <= one) & (t > zero) &
+                      (t < Float4(std::min(hit.t, ray.tMax)));
+        int bits = MoveMask(mask);
+        if (!bits) continue;
+
+        float ts[4];
+        t.Store(ts);
+
+        for (int lane = 0; lane < 4; lane++) {
+            if (!(bits & (1 << lane)) || ts[lane] >= hit.t) continue;
+
+            glm::vec3 e1(block.e1x[lane], block.e1y[lane], block.e1z[lane]);
+            glm::vec3 e2(block.e2x[lane], block.e2y[lane], block.e2z[lane]);
+            glm::vec3 n = glm::normalize(glm::cross(e1, e2));
+
+            hit.t = ts[lane];
+            hit.exitT = ts[lane];
+            hit.normal = glm::dot(n, ray.direction) > 0.0f ? -n : n;
+            hit.primitive = block.id[lane];
+            hit.material = block.material[lane];
+        }
+    }
+
+    for (uint32_t i = leaf.firstBox; i < leaf.firstBox + leaf.boxCount; i++) {
+        const StaticGeometry::Box &box = boxes[i];
+        glm::vec3 origin = box.toLocal * (ray.origin - box.center);
+        glm::vec3 inv = SafeInverse(box.toLocal * ray.direction);
+
+        glm::vec3 t0 = (-box.halfExtents - origin) * inv, t1 = (box.halfExtents - origin) * inv;
+        glm::vec3 tNear = glm::min(t0, t1), tFar = glm::max(t0, t1);
+
+        int axis = tNear.x > tNear.y ? (tNear.x > tNear.z ? 0 : 2) : (tNear.y > tNear.z ? 1 : 2);
+        float enter = tNear[axis];
+        float exit = std::min(tFar.x, std::min(tFar.y, tFar.z));
+
+        if (enter > exit || enter <= 0.0f || enter >= std::min(hit.t, ray.tMax)) continue;
+
+        glm::vec3 localNormal(0.0f);
+        localNormal[axis] = inv[axis] > 0.0f ? -1.0f : 1.0f;
+
+        hit.t = enter;
+        hit.exitT = exit;
+        hit.normal = glm::transpose(box.toLocal) * localNormal;
+        hit.primitive = box.id;
+        hit.material = box.material;
+    }
+}
+
+bool StaticBvh::OccludedLeaf(const Leaf &leaf, const Ray &ray) const {
+    const Float4 ox(ray.origin.x), oy(ray.origin.y), oz(ray.origin.z);
+    const Float4 dx(ray.direction.x), dy(ray.direction.y), dz(ray.direction.z);
+    const Float4 zero(0.0f), one(1.0f), epsilon(1e-12f), tMax(ray.tMax);
+
+    for (uint32_t b = leaf.firstBlock; b < leaf.firstBlock + leaf.blockCount; b++) {
+        const TriangleBlock &block = blocks[b];
+        Float4 e1x = Float4::Load(block.e1x), e1y = Float4::Load(block.e1y), e1z = Float4::Load(block.e1z);
+        Float4 e2x = Float4::Load(block.e2x), e2y = Float4::Load(block.e2y), e2z = Float4::Load(block.e2z);
+
+        Float4 px = dy * e2z - dz * e2y, py = dz * e2x - dx * e2z, pz = dx * e2y - dy * e2x;
+        Float4 det = e1x * px + e1y * py + e1z * pz;
+        Float4 inv = one / Select(Abs(det) > epsilon, det, one);
+
+        Float4 sx = ox - Float4::Load(block.v0x), sy = oy - Float4::Load(block.v0y), sz = oz - Float4::Load(block.v0z);
+        Float4 u = (sx * px + sy * py + sz * pz) * inv;
+        Float4 qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+        Float4 v = (dx * qx + dy * qy + dz * qz) * inv;
+        Float4 t = (e2x * qx + e2y * qy + e2z * qz) * inv;
+
+        if (MoveMask((Abs(det) > epsilon) & (u >= zero) & (v >= zero) & (u + v <= one) & (t > zero) & (t < tMax))) return true;
+    }
+
+    for (uint32_t i = leaf.firstBox; i < leaf.firstBox + leaf.boxCount; i++) {
+        const StaticGeometry::Box &box = boxes[i];
+        glm::vec3 origin = box.toLocal * (ray.origin - box.center);
+        glm::vec3 inv = SafeInverse(box.toLocal * ray.direction);
+
+        glm::vec3 t0 = (-box.halfExtents - origin) * inv, t1 = (box.halfExtents - origin) * inv;
+        glm::vec3 tNear = glm::min(t0, t1), tFar = glm::max(t0, t1);
+        float enter = std::max(tNear.x, std::max(tNear.y, tNear.z));
+        float exit = std::min(tFar.x, std::min(tFar.y, tFar.z));
+
+        if (enter <= exit && enter > 0.0f && enter < ray.tMax) return true;
+    }
+
+    return false;
+}
+
+bool StaticBvh::Raycast(const Ray &ray, RayHit &hit) const {
+    hit = RayHit();
+    if (leaves.empty()) return false;
+
+    const glm::vec3 invDir = SafeInverse(ray.direction);
+    const Float4 ox(ray.origin.x), oy(ray.origin.y), oz(ray.origin.z);
+    const Float4 ix(invDir.x), iy(invDir.y), iz(invDir.z);
+    const Float4 zero(0.0f);
+
+    struct Entry {
+        int32_t child;
+        float tNear;
+    };
+
+    Entry stack[StackSize];
+    int top = 0;
+    stack[top++] = {root, 0.0f};
+
+    while (top > 0) {
+        Entry entry = stack[--top];
+        if (entry.tNear >= std::min(hit.t, ray.tMax)) continue;
+
+        if (entry.child < 0) {
+            IntersectLeaf(leaves[~entry.child], ray, hit);
+            continue;
+        }
+
+        const Node4 &node = nodes[entry.child];
+        Float4 tx0 = (Float4::Load(node.minX) - ox) * ix, tx1 = (Float4::Load(node.maxX) - ox) * ix;
+        Float4 ty0 = (Float4::Load(node.minY) - oy) * iy, ty1 = (Float4::Load(node.maxY) - oy) * iy;
+        Float4 tz0 = (Float4::Load(node.minZ) - oz) * iz, tz1 = (Float4::Load(node.maxZ) - oz) * iz;
+
+        Float4 tNear = Max(Max(Min(tx0, tx1), Min(ty0, ty1)), Max(Min(tz0, tz1), zero));
+        Float4 tFar = Min(Min(Max(tx0, tx1), Max(ty0, ty1)), Min(Max(tz0, tz1), Float4(std::min(hit.t, ray.tMax))));
+
+        int bits = MoveMask(tNear <= tFar) & ((1 << node.childCount) - 1);
+        if (!bits) continue;
+
+        float nearT[4];
+        tNear.Store(nearT);
+
+        // Push far to near so the nearest child is popped first
+        Entry hits[4];
+        int count = 0;
+        for (int c = 0; c < 4; c++) {
+            if (!(bits & (1 << c))) continue;
+
+            Entry e{node.child[c], nearT[c]};
+            int j = count++;
+            while (j > 0 && hits[j - 1].tNear < e.tNear) {
+                hits[j] = hits[j - 1];
+                j--;
+            }
+            hits[j] = e;
+        }
+
+        assert(top + count <= StackSize);
+        for (int c = 0; c < count; c++) {
+            stack[top++] = hits[c];
+        }
+    }
+
+    return hit.IsHit();
+}
+
+void StaticBvh::Overlap(const glm::vec3 &min, const glm::vec3 &max, std::vector<StaticGeometry::Triangle> &triangles,
+                        std::vector<StaticGeometry::Box> &boxesOut) const {
+    if (leaves.empty()) return;
+
+    const Float4 qMinX(min.x), qMinY(min.y), qMinZ(min.z);
+    const Float4 qMaxX(max.x), qMaxY(max.y), qMaxZ(max.z);
+
+    int32_t stack[StackSize];
+    int top = 0;
+    stack[top++] = root;
+
+    while (top > 0) {
+        int32_t child = stack[--top];
+
+        if (child < 0) {
+            const Leaf &leaf = leaves[~child];
+
+            for (uint32_t b = leaf.firstBlock; b < leaf.firstBlock + leaf.blockCount; b++) {
+                const TriangleBlock &block = blocks[b];
+
+                for (int lane = 0; lane < 4; lane++) {
+                    glm::vec3 a(block.v0x[lane], block.v0y[lane], block.v0z[lane]);
+                    glm::vec3 e1(block.e1x[lane], block.e1y[lane], block.e1z[lane]);
+                    glm::vec3 e2(block.e2x[lane], block.e2y[lane], block.e2z[lane]);
+                    if (e1 == glm::vec3(0.0f) && e2 == glm::vec3(0.0f)) continue;   // unused lane
+
+                    glm::vec3 lo = glm::min(a, glm::min(a + e1, a + e2)), hi = glm::max(a, glm::max(a + e1, a + e2));
+                    if (glm::any(glm::lessThan(hi, min)) || glm::any(glm::greaterThan(lo, max))) continue;
+
+                    triangles.push_back({a, a + e1, a + e2, block.id[lane], block.material[lane]});
+                }
+            }
+
+            for (uint32_t i = leaf.firstBox; i < leaf.firstBox + leaf.boxCount; i++) {
+                const StaticGeometry::Box &box = boxes[i];
+                glm::mat3 axes = glm::transpose(box.toLocal);
+                glm::vec3 extent = glm::abs(axes[0]) * box.halfExtents.x + glm::abs(axes[1]) * box.halfExtents.y +
+                                   glm::abs(axes[2]) * box.halfExtents.z;
+                if (glm::any(glm::lessThan(box.center + extent, min)) || glm::any(glm::greaterThan(box.center - extent, max))) continue;
+
+                boxesOut.push_back(box);
+            }
+            continue;
+        }
+
+        const Node4 &node = nodes[child];
+        Float4 mask = (Float4::Load(node.minX) <= qMaxX) & (Float4::Load(node.maxX) >= qMinX) &
+                      (Float4::Load(node.minY) <= qMaxY) & (Float4::Load(node.maxY) >= qMinY) &
+                      (Float4::Load(node.minZ) <= qMaxZ) & (Float4::Load(node.maxZ) >= qMinZ);
+        int bits = MoveMask(mask) & ((1 << node.childCount) - 1);
+
+        assert(top + 4 <= StackSize);
+        for (int c = 0; c < 4; c++) {
+            if (bits & (1 << c)) stack[top++] = node.child[c];
+        }
+    }
+}
+
+void StaticBvh::RaycastBatch(std::span<const Ray> rays, std::span<RayHit> hits, JobSystem *jobs) const {
+    auto range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Raycast(rays[i], hits[i]);
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(rays.size(), 256, range);
+    } else {
+        range(0, rays.size());
+    }
+}
+
+void StaticBvh::OccludedPacket(std::span<const Ray> rays, uint8_t *occluded) const {
+    const size_t count = std::min(rays.size(), PacketSize);
+    for (size_t i = 0; i < count; i++) occluded[i] = 0;
+    if (leaves.empty() || count == 0) return;
+
+    struct PacketRay {
+        Float4 ox, oy, oz;
+        Float4 ix, iy, iz;
+        Float4 tMax;
+    };
+
+    PacketRay packet[PacketSize];
+    for (size_t i = 0; i < count; i++) {
+        const glm::vec3 invDir = SafeInverse(rays[i].direction);
+        packet[i] = {Float4(rays[i].origin.x), Float4(rays[i].origin.y), Float4(rays[i].origin.z),
+                     Float4(invDir.x), Float4(invDir.y), Float4(invDir.z), Float4(rays[i].tMax)};
+    }
+
+    // Each stack entry carries the rays that reached it; rays drop out of every entry once they are occluded
+    struct Entry {
+        int32_t child;
+        uint32_t rays;
+    };
+
+    Entry stack[StackSize];
+    int top = 0;
+    uint32_t active = (1u << count) - 1;
+    stack[top++] = {root, active};
+    const Float4 zero(0.0f);
+
+    while (top > 0 && active) {
+        Entry entry = stack[--top];
+        uint32_t mask = entry.rays & active;
+        if (!mask) continue;
+
+        if (entry.child < 0) {
+            const Leaf &leaf = leaves[~entry.child];
+            for (uint32_t bits = mask; bits; bits &= bits - 1) {
+                int i = std::countr_zero(bits);
+                if (OccludedLeaf(leaf, rays[i])) {
+                    occluded[i] = 1;
+                    active &= ~(1u << i);
+                }
+            }
+            continue;
+        }
+
+        const Node4 &node = nodes[entry.child];
+        const Float4 minX = Float4::Load(node.minX), minY = Float4::Load(node.minY), minZ = Float4::Load(node.minZ);
+        const Float4 maxX = Float4::Load(node.maxX), maxY = Float4::Load(node.maxY), maxZ = Float4::Load(node.maxZ);
+        const int valid = (1 << node.childCount) - 1;
+        uint32_t childRays[4] = {0, 0, 0, 0};
+
+        for (uint32_t bits = mask; bits; bits &= bits - 1) {
+            int i = std::countr_zero(bits);
+            const PacketRay &ray = packet[i];
+            Float4 tx0 = (minX - ray.ox) * ray.ix, tx1 = (maxX - ray.ox) * ray.ix;
+            Float4 ty0 = (minY - ray.oy) * ray.iy, ty1 = (maxY - ray.oy) * ray.iy;
+            Float4 tz0 = (minZ - ray.oz) * ray.iz, tz1 = (maxZ - ray.oz) * ray.iz;
+
+            Float4 tNear = Max(Max(Min(tx0, tx1), Min(ty0, ty1)), Max(Min(tz0, tz1), zero));
+            Float4 tFar = Min(Min(Max(tx0, tx1), Max(ty0, ty1)), Min(Max(tz0, tz1), ray.tMax));
+
+            int hits = MoveMask(tNear <= tFar) & valid;
+            for (int c = 0; c < 4; c++) {
+                if (hits & (1 << c)) childRays[c] |= 1u << i;
+            }
+        }
+
+        assert(top + 4 <= StackSize);
+        for (int c = 0; c < 4; c++) {
+            if (childRays[c]) stack[top++] = {node.child[c], childRays[c]};
+        }
+    }
+}
+
+void StaticBvh::OccludedBatch(std::span<const Ray> rays, std::span<uint8_t> occluded, JobSystem *jobs) const {
+    auto range = [&](size_t begin, size_t end) {
+        for (size_t packet = begin; packet < end; packet++) {
+            size_t first = packet * PacketSize;
+            OccludedPacket(rays.subspan(first, std::min(PacketSize, rays.size() - first)), occluded.data() + first);
+        }
+    };
+
+    const size_t packets = (rays.size() + PacketSize - 1) / PacketSize;
+    if (jobs) {
+        jobs->ParallelFor(packets, 16, range);
+    } else {
+        range(0, packets);
+    }
+}
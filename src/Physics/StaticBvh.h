@@ -0,0 +1,138 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+
+constexpr uint32_t InvalidPrimitive = 0xffffffffu;
+
+struct Ray {
+    glm::vec3 origin = glm::vec3(0.0f);
+    float tMax = INFINITY;
+    glm::vec3 direction = glm::vec3(0.0f, 0.0f, -1.0f);   // need not be unit length; t is measured in its units
+};
+
+struct RayHit {
+    float t = INFINITY;
+    float exitT = INFINITY;                   // where the ray leaves a solid box; equals t for triangles
+    glm::vec3 normal = glm::vec3(0.0f);       // unit, facing the ray origin
+    uint32_t primitive = InvalidPrimitive;    // id returned by StaticGeometry::Add*
+    uint32_t material = 0;
+
+    bool IsHit() const { return primitive != InvalidPrimitive; }
+};
+
+// Build input for a StaticBvh: triangles and oriented boxes, each tagged with a material id. Every Add returns the
+// primitive id that hits report.
+class StaticGeometry {
+public:
+    uint32_t AddTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, uint32_t material);
+
+    // The unit cube [-0.5, 0.5]^3 under transform (translation, rotation and scale, no shear), like the cubes of
+    // the render loop
+    uint32_t AddBox(const glm::mat4 &transform, uint32_t material);
+
+    // Returns the id of the first triangle; the rest follow consecutively
+    uint32_t AddMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices, const glm::mat4 &transform,
+                     uint32_t material);
+
+    size_t PrimitiveCount() const { return nextId; }
+
+    struct Triangle {
+        glm::vec3 a, b, c;
+        uint32_t id, material;
+    };
+
+    struct Box {
+        glm::vec3 center;
+        glm::vec3 halfExtents;
+        glm::mat3 toLocal;                    // rotation only, world -> box axes
+        uint32_t id, material;
+    };
+
+private:
+    friend class StaticBvh;
+
+    std::vector<Triangle> triangles;
+    std::vector<Box> boxes;
+    uint32_t nextId = 0;
+};
+
+// Bounding volume hierarchy over static world geometry for hitscan and projectile queries. Built top-down with binned
+// SAH, then collapsed to a 4-wide tree: each node stores its children's bounds in SoA form so one ray is tested against
+// all four with a single Float4 slab test, and leaf triangles are tested four at a time the same way.
+class StaticBvh {
+public:
+    struct Stats {
+        size_t nodes = 0;
+        size_t leaves = 0;
+        size_t triangles = 0;
+        size_t boxes = 0;
+        int depth = 0;
+        double buildMs = 0.0;
+    };
+
+    explicit StaticBvh(const StaticGeometry &geometry);
+
+    // Closest hit with 0 < t < ray.tMax. Boxes are solid: a ray starting inside one does not report it.
+    bool Raycast(const Ray &ray, RayHit &hit) const;
+
+    // hits[i] receives the closest hit of rays[i]; spread over the job system when one is given
+    void RaycastBatch(std::span<const Ray> rays, std::span<RayHit> hits, JobSystem *jobs = nullptr) const;
+
+    // Any-hit test for line of sight: occluded[i] = 1 when anything lies on rays[i] with 0 < t < tMax. Up to
+    // PacketSize rays descend the tree together, each node opened once for all rays of the packet that reach it, and
+    // each ray stops at its first hit. Coherent rays (one eye, similar directions) share most of their nodes.
+    static constexpr size_t PacketSize = 16;
+    void OccludedPacket(std::span<const Ray> rays, uint8_t *occluded) const;
+
+    // Consecutive runs of PacketSize rays form the packets, so callers order rays for coherence
+    void OccludedBatch(std::span<const Ray> rays, std::span<uint8_t> occluded, JobSystem *jobs = nullptr) const;
+
+    // Appends every primitive whose bounds overlap [min, max], for shape queries such as character collision
+    void Overlap(const glm::vec3 &min, const glm::vec3 &max, std::vector<StaticGeometry::Triangle> &triangles,
+                 std::vector<StaticGeometry::Box> &boxes) const;
+
+    const Stats &GetStats() const { return stats; }
+    glm::vec3 BoundsMin() const { return boundsMin; }
+    glm::vec3 BoundsMax() const { return boundsMax; }
+
+private:
+    struct Node4 {
+        float minX[4], minY[4], minZ[4];
+        float maxX[4], maxY[4], maxZ[4];
+        int32_t child[4];                     // >= 0 node, < 0 leaf ~index
+        int32_t childCount;
+    };
+
+    struct Leaf {
+        uint32_t firstBlock, blockCount;
+        uint32_t firstBox, boxCount;
+    };
+
+    // Four triangles in SoA form; unused lanes have a zero edge and never hit
+    struct TriangleBlock {
+        float v0x[4], v0y[4], v0z[4];
+        float e1x[4], e1y[4], e1z[4];
+        float e2x[4], e2y[4], e2z[4];
+        uint32_t id[4];
+        uint32_t material[4];
+    };
+
+    struct BuildNode;
+
+    void IntersectLeaf(const Leaf &leaf, const Ray &ray, RayHit &hit) const;
+    bool OccludedLeaf(const Leaf &leaf, const Ray &ray) const;
+
+    std::vector<Node4> nodes;
+    std::vector<Leaf> leaves;
+    std::vector<TriangleBlock> blocks;
+    std::vector<StaticGeometry::Box> boxes;
+    int32_t root = 0;                         // same encoding as Node4::child
+    glm::vec3 boundsMin = glm::vec3(0.0f), boundsMax = glm::vec3(0.0f);
+    Stats stats;
+};
@@ -0,0 +1,29 @@
+#include "SurfaceMaterial.h"
+
+#include <cmath>
+
+const std::vector<SurfaceMaterial> &DefaultSurfaceMaterials() {
+    static const std::vector<SurfaceMaterial> materials = {
+        {"Concrete", 2400.0f, 300e6f, 0.20f, 12.0f, 0.6f},
+        {"Rock", 2700.0f, 400e6f, 1.00f, 15.0f, 0.6f},
+        {"Soil", 1600.0f, 2e6f, 1.00f, 5.0f, 0.3f},
+        {"Wood", 600.0f, 20e6f, 0.05f, 6.0f, 0.4f},
+        {"Drywall", 700.0f, 5e6f, 0.0125f, 3.0f, 0.2f},
+        {"SheetMetal", 7850.0f, 500e6f, 0.002f, 20.0f, 0.7f},
+        {"Glass", 2500.0f, 50e6f, 0.006f, 8.0f, 0.3f},
+        {"Flesh", 1060.0f, 1e6f, 0.3f, 0.0f, 0.0f},
+    };
+
+    return materials;
+}
+
+float SpeedAfterPenetration(const SurfaceMaterial &material, float speed, float pathLength, float mass, float caliber) {
+    // m v dv/dx = -(R A + rho A v^2 / 2)  =>  v^2(x) = (v0^2 + b/a) e^(-2 a x) - b/a,  a = rho A / 2m, b = R A / m
+    const float area = 3.14159265f * 0.25f * caliber * caliber;
+    const float a = material.density * area / (2.0f * mass);
+    const float b = material.resistance * area / mass;
+    const float c = b / a;
+
+    float squared = (speed * speed + c) * std::exp(-2.0f * a * pathLength) - c;
+    return squared > 0.0f ? std::sqrt(squared) : 0.0f;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Ids used as the material of StaticGeometry primitives; index into the surface material table
+enum SurfaceMaterialId : uint32_t {
+    MaterialConcrete = 0,
+    MaterialRock,
+    MaterialSoil,
+    MaterialWood,
+    MaterialDrywall,
+    MaterialSheetMetal,
+    MaterialGlass,
+    MaterialFlesh,                            // hitboxes; never on static geometry
+    MaterialCount,
+};
+
+// How a surface treats rounds that hit it.
+//
+// Penetration uses a Poncelet-style retarding force per unit of path length, F = resistance * A + density * A * v^2 / 2,
+// for a round of cross-section A, so soft dense targets bleed energy quadratically with speed and hard ones cost a
+// fixed amount per metre. Below ricochetAngle (grazing angle between the velocity and the surface) the round bounces
+// instead, keeping ricochetRetention of its speed.
+struct SurfaceMaterial {
+    std::string name;
+    float density;                            // kg/m^3
+    float resistance;                         // effective target strength, Pa
+    float thickness;                          // path length assumed for surfaces without volume (triangles), m
+    float ricochetAngle;                      // degrees
+    float ricochetRetention;                  // fraction of speed kept by a ricochet
+};
+
+const std::vector<SurfaceMaterial> &DefaultSurfaceMaterials();
+
+// Speed left after pathLength metres of material, or 0 if the round stops inside it
+float SpeedAfterPenetration(const SurfaceMaterial &material, float speed, float pathLength, float mass, float caliber);
@@ -0,0 +1,46 @@
+#include "Frustum.h"
+
+Frustum Frustum::FromMatrix(const glm::mat4 &viewProj) {
+    Frustum frustum{};
+    glm::vec4 row[4];
+
+    for (int i = 0; i < 4; i++) {
+        row[i] = glm::vec4(viewProj[0][i], viewProj[1][i], viewProj[2][i], viewProj[3][i]);
+    }
+
+    frustum.planes[0] = row[3] + row[0];    // left
+    frustum.planes[1] = row[3] - row[0];    // right
+    frustum.planes[2] = row[3] + row[1];    // bottom
+    frustum.planes[3] = row[3] - row[1];    // top
+    frustum.planes[4] = row[3] + row[2];    // near
+    frustum.planes[5] = row[3] - row[2];    // far
+
+    for (glm::vec4 &plane: frustum.planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+
+    return frustum;
+}
+
+bool Frustum::IntersectsSphere(const glm::vec3 &center, float radius) const {
+    for (const glm::vec4 &plane: planes) {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Frustum::IntersectsBox(const glm::vec3 &min, const glm::vec3 &max) const {
+    for (const glm::vec4 &plane: planes) {
+        // Corner furthest along the plane normal
+        glm::vec3 p(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y, plane.z >= 0.0f ? max.z : min.z);
+
+        if (glm::dot(glm::vec3(plane), p) + plane.w < 0.0f) {
+            return false;
+        }
+    }
+
+    return true;
+}
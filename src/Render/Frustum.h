@@ -0,0 +1,14 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// View frustum planes extracted from a view-projection matrix (Gribb & Hartmann). Planes point inwards and are
+// normalized, so dot(plane.xyz, p) + plane.w is a signed distance.
+struct Frustum {
+    glm::vec4 planes[6];
+
+    static Frustum FromMatrix(const glm::mat4 &viewProj);
+
+    bool IntersectsSphere(const glm::vec3 &center, float radius) const;
+    bool IntersectsBox(const glm::vec3 &min, const glm::vec3 &max) const;
+};
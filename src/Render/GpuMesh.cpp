@@ -0,0 +1,107 @@
+#include "GpuMesh.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstddef>
+
+GpuMesh::GpuMesh(const MeshFile &file) {
+    const MeshFileHeader &header = file.Header();
+    skinned = file.IsSkinned();
+
+    meshes.assign(file.Meshes(), file.Meshes() + header.meshCount);
+    submeshes.assign(file.Submeshes(), file.Submeshes() + header.submeshCount);
+    lods.assign(file.Lods(), file.Lods() + header.lodCount);
+    materials.assign(file.Materials(), file.Materials() + header.materialCount);
+    nodes.assign(file.Nodes(), file.Nodes() + header.nodeCount);
+    skins.assign(file.Skins(), file.Skins() + header.skinCount);
+    joints.assign(file.Joints(), file.Joints() + header.jointCount);
+
+    // Parents precede children, so one pass resolves the hierarchy
+    for (const NodeRecord &node: nodes) {
+        glm::quat rotation(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]);
+        glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::make_vec3(node.translation)) * glm::mat4_cast(rotation) *
+                          glm::scale(glm::mat4(1.0f), glm::make_vec3(node.scale));
+
+        nodeTransforms.push_back(node.parent >= 0 ? nodeTransforms[node.parent] * local : local);
+    }
+
+    boundingRadius = std::max(glm::length(glm::make_vec3(header.boundsMin)), glm::length(glm::make_vec3(header.boundsMax)));
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ibo);
+
+    const auto stride = static_cast<GLsizei>(header.vertexStride);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(header.vertexCount) * stride, file.Vertices(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(header.indexCount * sizeof(uint32_t)), file.Indices(), GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void *) offsetof(PackedVertex, position));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride, (void *) offsetof(PackedVertex, normal));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride, (void *) offsetof(PackedVertex, uv));
+    glEnableVertexAttribArray(2);
+
+    if (skinned) {
+        glVertexAttribIPointer(3, 4, GL_UNSIGNED_BYTE, stride, (void *) offsetof(PackedSkinnedVertex, joints));
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *) offsetof(PackedSkinnedVertex, weights));
+        glEnableVertexAttribArray(4);
+    }
+
+    glBindVertexArray(0);
+}
+
+GpuMesh::~GpuMesh() {
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+}
+
+void GpuMesh::DrawSubmesh(uint32_t submesh, int lod, GLsizei instanceCount) const {
+    const SubmeshRecord &record = submeshes[submesh];
+    const LodRecord &level = lods[record.firstLod + std::clamp<uint32_t>(static_cast<uint32_t>(std::max(lod, 0)), 0, record.lodCount - 1)];
+
+    glBindVertexArray(vao);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(level.indexCount), GL_UNSIGNED_INT,
+                            (void *) (level.firstIndex * sizeof(uint32_t)), instanceCount);
+}
+
+void GpuMesh::Draw(GLuint program, const glm::mat4 &model, int lod) const {
+    GLint modelLocation = glGetUniformLocation(program, "model");
+    GLint colorLocation = glGetUniformLocation(program, "baseColor");
+
+    for (size_t n = 0; n < nodes.size(); n++) {
+        if (nodes[n].mesh < 0) continue;
+
+        // Skinned meshes are positioned by their joints, not by the node they hang off
+        glm::mat4 transform = nodes[n].skin >= 0 ? model : model * nodeTransforms[n];
+        glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(transform));
+
+        const MeshRecord &mesh = meshes[nodes[n].mesh];
+        for (uint32_t s = mesh.firstSubmesh; s < mesh.firstSubmesh + mesh.submeshCount; s++) {
+            glUniform4fv(colorLocation, 1, materials[submeshes[s].material].baseColor);
+            DrawSubmesh(s, lod);
+        }
+    }
+}
+
+void GpuMesh::DrawSkinned(GLuint program, GLsizei instanceCount, int lod) const {
+    GLint colorLocation = glGetUniformLocation(program, "baseColor");
+
+    for (const NodeRecord &node: nodes) {
+        if (node.mesh < 0 || node.skin < 0) continue;
+
+        const MeshRecord &mesh = meshes[node.mesh];
+        for (uint32_t s = mesh.firstSubmesh; s < mesh.firstSubmesh + mesh.submeshCount; s++) {
+            glUniform4fv(colorLocation, 1, materials[submeshes[s].material].baseColor);
+            DrawSubmesh(s, lod, instanceCount);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "../Asset/MeshFormat.h"
+
+// A cooked mesh resident on the GPU. Vertex and index data go to the driver straight from the file mapping; the
+// records needed for drawing are copied so the mapping can be released after construction.
+class GpuMesh {
+public:
+    explicit GpuMesh(const MeshFile &file);
+    ~GpuMesh();
+
+    GpuMesh(const GpuMesh &) = delete;
+    GpuMesh &operator=(const GpuMesh &) = delete;
+
+    bool IsSkinned() const { return skinned; }
+    size_t NodeCount() const { return nodes.size(); }
+    const NodeRecord &Node(size_t node) const { return nodes[node]; }
+    const glm::mat4 &NodeTransform(size_t node) const { return nodeTransforms[node]; }
+    const MaterialRecord &Material(uint32_t material) const { return materials[material]; }
+    const std::vector<SkinRecord> &Skins() const { return skins; }
+    const std::vector<JointRecord> &Joints() const { return joints; }
+    float BoundingRadius() const { return boundingRadius; }
+
+    // Draws one submesh at the given LOD (clamped to the submesh's chain)
+    void DrawSubmesh(uint32_t submesh, int lod, GLsizei instanceCount = 1) const;
+
+    // Draws every node that references a mesh with the program's "model" and "baseColor" uniforms set per draw
+    void Draw(GLuint program, const glm::mat4 &model, int lod = 0) const;
+
+    // Draws the skinned nodes instanceCount times; placement comes from the skinning palettes, "baseColor" is set
+    void DrawSkinned(GLuint program, GLsizei instanceCount, int lod = 0) const;
+
+private:
+    bool skinned = false;
+    std::vector<MeshRecord> meshes;
+    std::vector<SubmeshRecord> submeshes;
+    std::vector<LodRecord> lods;
+    std::vector<MaterialRecord> materials;
+    std::vector<NodeRecord> nodes;
+    std::vector<glm::mat4> nodeTransforms;    // model space, from the bind pose TRS
+    std::vector<SkinRecord> skins;
+    std::vector<JointRecord> joints;
+    float boundingRadius = 0.0f;
+
+    GLuint vao = 0, vbo = 0, ibo = 0;
+};
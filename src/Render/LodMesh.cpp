@@ -0,0 +1,71 @@
+#include "LodMesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+LodMesh::LodMesh(const TexturedMesh &mesh, const LodChain &chain) : chain(chain) {
+    for (const TexturedVertex &v: mesh.vertices) {
+        boundingRadius = std::max(boundingRadius, glm::length(v.pos));
+    }
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ibo);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(mesh.vertices.size() * sizeof(TexturedVertex)), mesh.vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(chain.indices.size() * sizeof(uint32_t)), chain.indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex), (void *) 0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex), (void *) offsetof(TexturedVertex, uv));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+}
+
+LodMesh::~LodMesh() {
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+}
+
+void LodMesh::Draw(int level) const {
+    const LodLevel &lod = chain.levels[level];
+
+    glBindVertexArray(vao);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lod.indexCount), GL_UNSIGNED_INT,
+                   (void *) (lod.firstIndex * sizeof(uint32_t)));
+}
+
+float ProjectionScale(float fovY, float viewportHeight) {
+    return viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+}
+
+int SelectLod(const LodMesh &mesh, float objectScale, float distance, float projectionScale,
+              const LodSelection &selection, int currentLevel) {
+    float pixelsPerUnit = objectScale * projectionScale / std::max(distance, 1e-3f);
+
+    auto coarsestUnder = [&](float threshold) {
+        int level = 0;
+
+        for (int l = 1; l < mesh.LevelCount(); l++) {
+            if (mesh.Level(l).error * pixelsPerUnit <= threshold) {
+                level = l;
+            }
+        }
+
+        return level;
+    };
+
+    currentLevel = std::clamp(currentLevel, 0, mesh.LevelCount() - 1);
+
+    // Refine as soon as the current level is visibly wrong...
+    if (mesh.Level(currentLevel).error * pixelsPerUnit > selection.pixelThreshold) {
+        return coarsestUnder(selection.pixelThreshold);
+    }
+
+    // ...but only coarsen once there is margin, so the object does not flip back and forth at the boundary
+    return std::max(currentLevel, coarsestUnder(selection.pixelThreshold * (1.0f - selection.hysteresis)));
+}
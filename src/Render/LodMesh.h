@@ -0,0 +1,47 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+
+#include "../Geometry/MeshSimplifier.h"
+#include "../Geometry/Primitives.h"
+
+// GPU side of a LodChain: one shared vertex buffer and every level's index range in one index buffer, drawn with the
+// basic shader's position/texcoord layout.
+class LodMesh {
+public:
+    LodMesh(const TexturedMesh &mesh, const LodChain &chain);
+    ~LodMesh();
+
+    LodMesh(const LodMesh &) = delete;
+    LodMesh &operator=(const LodMesh &) = delete;
+
+    int LevelCount() const { return static_cast<int>(chain.levels.size()); }
+    const LodLevel &Level(int level) const { return chain.levels[level]; }
+    float BoundingRadius() const { return boundingRadius; }
+
+    void Draw(int level) const;
+
+private:
+    LodChain chain;
+    float boundingRadius = 0.0f;
+    GLuint vao = 0, vbo = 0, ibo = 0;
+};
+
+struct LodSelection {
+    float pixelThreshold = 1.0f;              // largest acceptable projected error
+    float hysteresis = 0.3f;                  // going coarser needs the error to drop this far below the threshold
+};
+
+struct LodStats {
+    uint64_t trianglesRendered = 0;
+    uint64_t trianglesFullDetail = 0;         // what the same draws would have cost at LOD0
+};
+
+// viewportHeight / (2 tan(fovY / 2)): converts world size at distance 1 into pixels
+float ProjectionScale(float fovY, float viewportHeight);
+
+// Picks the coarsest level whose geometric error projects under the threshold, with hysteresis against popping
+// when an object hovers around a transition distance. currentLevel is the level drawn last frame.
+int SelectLod(const LodMesh &mesh, float objectScale, float distance, float projectionScale,
+              const LodSelection &selection, int currentLevel);
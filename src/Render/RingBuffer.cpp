@@ -0,0 +1,142 @@
+#include "RingBuffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// Mapping goes through the copy-write binding point so it never disturbs vertex array or uniform buffer state.
+static constexpr GLenum MapTarget = GL_COPY_WRITE_BUFFER;
+
+RingBuffer::RingBuffer(GLsizeiptr regionSize, int regionCount)
+    : regionSize(regionSize), regionCount(regionCount) {
+    if (regionCount < 2 || regionCount > MaxRegions) {
+        throw std::runtime_error("RingBuffer: Region Count Must Be Between 2 and " + std::to_string(MaxRegions));
+    }
+
+    persistent = GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage;
+    GLsizeiptr totalSize = regionSize * regionCount;
+
+    glGenBuffers(1, &buffer);
+    glBindBuffer(MapTarget, buffer);
+
+    if (persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(MapTarget, totalSize, nullptr, flags);
+        persistentPtr = static_cast<uint8_t *>(glMapBufferRange(MapTarget, 0, totalSize, flags));
+
+        if (!persistentPtr) {
+            glDeleteBuffers(1, &buffer);
+            throw std::runtime_error("RingBuffer: Failed to Persistently Map Buffer");
+        }
+    } else {
+        glBufferData(MapTarget, totalSize, nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(MapTarget, 0);
+}
+
+RingBuffer::~RingBuffer() {
+    for (GLsync &fence: fences) {
+        if (fence) {
+            glDeleteSync(fence);
+        }
+    }
+
+    if (persistentPtr || mappedPtr) {
+        glBindBuffer(MapTarget, buffer);
+        glUnmapBuffer(MapTarget);
+        glBindBuffer(MapTarget, 0);
+    }
+
+    glDeleteBuffers(1, &buffer);
+}
+
+void RingBuffer::BeginFrame() {
+    GLsync &fence = fences[region];
+
+    if (fence) {
+        GLenum status = glClientWaitSync(fence, 0, 0);
+
+        if (status == GL_TIMEOUT_EXPIRED) {
+            // The GPU is more than regionCount frames behind; this is the only place the ring can block.
+            stats.fenceWaits++;
+
+            do {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+            } while (status == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    head = 0;
+    committed = 0;
+}
+
+void RingBuffer::EndFrame() {
+    Commit();
+
+    stats.peakRegionUsage = std::max(stats.peakRegionUsage, head);
+    fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    region = (region + 1) % regionCount;
+}
+
+RingBuffer::Allocation RingBuffer::Allocate(GLsizeiptr size, GLsizeiptr alignment) {
+    GLsizeiptr offset = (head + alignment - 1) / alignment * alignment;
+
+    if (size <= 0 || offset + size > regionSize) {
+        stats.failedAllocations++;
+        return {};
+    }
+
+    GLintptr bufferOffset = region * regionSize + offset;
+
+    // head only moves once the space can be written, so a failed map leaves the region as it was
+    if (!persistent && !mappedPtr && !MapRemainder()) {
+        stats.failedAllocations++;
+        return {};
+    }
+    head = offset + size;
+
+    if (persistent) {
+        return {persistentPtr + bufferOffset, bufferOffset, size};
+    }
+    return {mappedPtr + (bufferOffset - mappedBegin), bufferOffset, size};
+}
+
+void RingBuffer::Commit() {
+    if (persistent || !mappedPtr) {
+        committed = head;
+        return;
+    }
+
+    glBindBuffer(MapTarget, buffer);
+
+    GLsizeiptr written = region * regionSize + head - mappedBegin;
+    if (written > 0) {
+        glFlushMappedBufferRange(MapTarget, 0, written);
+    }
+
+    glUnmapBuffer(MapTarget);
+    glBindBuffer(MapTarget, 0);
+
+    mappedPtr = nullptr;
+    committed = head;
+}
+
+bool RingBuffer::MapRemainder() {
+    // Map from the last committed point to the end of the region so allocations after a Commit() never overwrite
+    // data already handed to the GPU this frame.
+    mappedBegin = region * regionSize + committed;
+    mappedSize = regionSize - committed;
+
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                       GL_MAP_FLUSH_EXPLICIT_BIT;
+
+    glBindBuffer(MapTarget, buffer);
+    mappedPtr = static_cast<uint8_t *>(glMapBufferRange(MapTarget, mappedBegin, mappedSize, flags));
+    glBindBuffer(MapTarget, 0);
+
+    return mappedPtr != nullptr;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// Triple-buffered streaming buffer for per-frame dynamic data (uniforms, debug lines, particles, instance data).
+// The buffer is split into regionCount regions; each frame sub-allocates linearly from one region and fences it at
+// EndFrame. The storage is created once and never reallocated - an allocation that does not fit in the current
+// region fails instead of growing the buffer.
+//
+// With GL 4.4 / ARB_buffer_storage the whole buffer is persistently and coherently mapped. Otherwise each region is
+// mapped with GL_MAP_UNSYNCHRONIZED_BIT (the fences provide the synchronization) and must be committed before drawing.
+// The buffer is not tied to a target; bind Buffer() as GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER, ... with the allocation
+// offset.
+class RingBuffer {
+public:
+    struct Allocation {
+        void *ptr = nullptr;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+
+        explicit operator bool() const { return ptr != nullptr; }
+    };
+
+    struct Stats {
+        uint64_t fenceWaits = 0;      // BeginFrame had to block on the GPU
+        uint64_t failedAllocations = 0;
+        GLsizeiptr peakRegionUsage = 0;
+    };
+
+    explicit RingBuffer(GLsizeiptr regionSize, int regionCount = 3);
+    ~RingBuffer();
+
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+
+    void BeginFrame();
+    void EndFrame();
+
+    Allocation Allocate(GLsizeiptr size, GLsizeiptr alignment = 16);
+
+    // Makes everything written since the last commit visible to the GPU. Must be called before issuing draws that
+    // read allocations from this frame. No-op for the persistent path.
+    void Commit();
+
+    GLuint Buffer() const { return buffer; }
+    bool IsPersistent() const { return persistent; }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    static constexpr int MaxRegions = 4;
+
+    bool MapRemainder();
+
+    GLuint buffer = 0;
+    GLsizeiptr regionSize;
+    int regionCount;
+    bool persistent;
+
+    uint8_t *persistentPtr = nullptr;
+
+    // Fallback mapping state: [mappedBegin, mappedBegin + mappedSize) of the buffer is currently mapped at mappedPtr.
+    uint8_t *mappedPtr = nullptr;
+    GLintptr mappedBegin = 0;
+    GLsizeiptr mappedSize = 0;
+
+    GLsync fences[MaxRegions] = {};
+    int region = 0;
+    GLsizeiptr head = 0;
+    GLsizeiptr committed = 0;
+
+    Stats stats;
+};
@@ -0,0 +1,108 @@
+#include "Shader.h"
+
+#include <iostream>
+#include <stdexcept>
+
+#include "../Asset/Vfs.h"
+
+std::string LoadFileToString(const std::string &path) {
+    if (!AssetFiles().Exists(path)) {
+        throw std::runtime_error("Failed to Open Shader File: " + path);
+    }
+
+    return std::string(AssetFiles().Read(path).Text());
+}
+
+GLuint CompileShader(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        char info[512];
+        glGetShaderInfoLog(shader, 512, nullptr, info);
+        std::cerr << "Shader compile error: " << info << std::endl;
+    }
+    return shader;
+}
+
+GLuint CreateShaderProgramFromFiles(const std::string &verPath, const std::string &fragPath) {
+    std::string vertSrc = LoadFileToString(verPath);
+    std::string fragSrc = LoadFileToString(fragPath);
+
+    auto compile = [](GLenum type, const char *src) -> GLuint {
+        GLuint s = glCreateShader(type);
+
+        glShaderSource(s, 1, &src, nullptr);
+        glCompileShader(s);
+
+        GLint ok;
+
+        glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
+
+        if (!ok) {
+            char log[512];
+            glGetShaderInfoLog(s, 512, nullptr, log);
+            throw std::runtime_error("Shader Compile Error:\n" + std::string(log));
+        }
+
+        return s;
+    };
+
+    GLuint vert = compile(GL_VERTEX_SHADER, vertSrc.c_str());
+    GLuint frag = compile(GL_FRAGMENT_SHADER, fragSrc.c_str());
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vert);
+    glAttachShader(program, frag);
+    glLinkProgram(program);
+
+    GLint ok;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+
+    if (!ok) {
+        char log[512];
+        glGetProgramInfoLog(program, 512, nullptr, log);
+        throw std::runtime_error("Program Link Error: " + std::string(log));
+    }
+
+    glDeleteShader(vert);
+    glDeleteShader(frag);
+
+    return program;
+}
+
+GLuint CreateComputeProgramFromFile(const std::string &path) {
+    std::string src = LoadFileToString(path);
+    const char *source = src.c_str();
+
+    GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint ok;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+
+    if (!ok) {
+        char log[512];
+        glGetShaderInfoLog(shader, 512, nullptr, log);
+        glDeleteShader(shader);
+        throw std::runtime_error("Compute Shader Compile Error (" + path + "):\n" + std::string(log));
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+    glDeleteShader(shader);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+
+    if (!ok) {
+        char log[512];
+        glGetProgramInfoLog(program, 512, nullptr, log);
+        throw std::runtime_error("Program Link Error: " + std::string(log));
+    }
+
+    return program;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <string>
+
+std::string LoadFileToString(const std::string &path);
+
+GLuint CompileShader(GLenum type, const char *source);
+
+GLuint CreateShaderProgramFromFiles(const std::string &verPath, const std::string &fragPath);
+
+GLuint CreateComputeProgramFromFile(const std::string &path);
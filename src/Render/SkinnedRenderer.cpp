@@ -0,0 +1,59 @@
+#include "SkinnedRenderer.h"
+
+#include <cstring>
+
+#include "Shader.h"
+
+SkinnedRenderer::SkinnedRenderer() {
+    program = CreateShaderProgramFromFiles("shaders/skinned.vert", "shaders/mesh.frag");
+    glUniformBlockBinding(program, glGetUniformBlockIndex(program, "Camera"), 0);
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "palette"), PaletteUnit);
+
+    glGenBuffers(1, &paletteBuffer);
+    glGenTextures(1, &paletteTexture);
+}
+
+SkinnedRenderer::~SkinnedRenderer() {
+    glDeleteTextures(1, &paletteTexture);
+    glDeleteBuffers(1, &paletteBuffer);
+    glDeleteProgram(program);
+}
+
+void SkinnedRenderer::Draw(const GpuMesh &mesh, const CrowdAnimator &crowd, RingBuffer &upload, int lod) {
+    if (crowd.InstanceCount() == 0) return;
+
+    const std::vector<glm::vec4> &palettes = crowd.Palettes();
+    const auto bytes = static_cast<GLsizeiptr>(palettes.size() * sizeof(glm::vec4));
+
+    glBindBuffer(GL_TEXTURE_BUFFER, paletteBuffer);
+    if (bytes > paletteCapacity) {
+        paletteCapacity = bytes + bytes / 2;
+        glBufferData(GL_TEXTURE_BUFFER, paletteCapacity, nullptr, GL_STREAM_DRAW);
+
+        glBindTexture(GL_TEXTURE_BUFFER, paletteTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, paletteBuffer);
+    }
+
+    // Stream through the ring when it has room; a crowd too big for one region goes the plain glBufferSubData way
+    RingBuffer::Allocation alloc = upload.Allocate(bytes, 16);
+    if (alloc) {
+        std::memcpy(alloc.ptr, palettes.data(), static_cast<size_t>(bytes));
+        upload.Commit();
+
+        glBindBuffer(GL_COPY_READ_BUFFER, upload.Buffer());
+        glBindBuffer(GL_COPY_WRITE_BUFFER, paletteBuffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, alloc.offset, 0, bytes);
+    } else {
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, palettes.data());
+    }
+
+    glActiveTexture(GL_TEXTURE0 + PaletteUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, paletteTexture);
+    glActiveTexture(GL_TEXTURE0);
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "jointCount"), static_cast<GLint>(crowd.JointCount()));
+    mesh.DrawSkinned(program, static_cast<GLsizei>(crowd.InstanceCount()), lod);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include "GpuMesh.h"
+#include "RingBuffer.h"
+#include "../Animation/CrowdAnimator.h"
+
+// Draws a crowd of skinned characters. All palettes go to one RGBA32F texture buffer each frame (streamed through
+// the frame ring buffer) and every character is one instance of a single instanced draw per submesh; the vertex
+// shader finds its palette from gl_InstanceID.
+class SkinnedRenderer {
+public:
+    SkinnedRenderer();
+    ~SkinnedRenderer();
+
+    SkinnedRenderer(const SkinnedRenderer &) = delete;
+    SkinnedRenderer &operator=(const SkinnedRenderer &) = delete;
+
+    void Draw(const GpuMesh &mesh, const CrowdAnimator &crowd, RingBuffer &upload, int lod = 0);
+
+private:
+    static constexpr GLint PaletteUnit = 3;
+
+    GLuint program = 0;
+    GLuint paletteBuffer = 0, paletteTexture = 0;
+    GLsizeiptr paletteCapacity = 0;
+};
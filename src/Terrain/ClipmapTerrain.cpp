@@ -0,0 +1,264 @@
+#include "ClipmapTerrain.h"
+
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "../Render/Shader.h"
+
+// Layout constants in level vertex units. The ring is 4x4 blocks of 63 quads with a 2 quad fix-up gap through the
+// middle; the 128 quad hole in the middle holds the next finer level (127 quads of this level) plus a 1 quad trim.
+static constexpr int BlockSize = (ClipmapTerrain::GridSize + 1) / 4;      // 64 vertices
+static constexpr int BlockQuads = BlockSize - 1;
+static constexpr int HoleBegin = BlockQuads;                             // 63
+static constexpr int HoleQuads = 2 * BlockQuads + 2;                     // 128
+static constexpr int BlockStarts[4] = {0, BlockQuads, 2 * BlockQuads + 2, 3 * BlockQuads + 2};
+
+static int WrapTexel(int coordinate) {
+    return coordinate & (ClipmapTerrain::TextureSize - 1);
+}
+
+ClipmapTerrain::ClipmapTerrain(const Heightfield &heightfield, int levelCount)
+    : heightfield(heightfield), levelCount(levelCount) {
+    if (this->levelCount <= 0) {
+        // Enough levels for the coarsest one to span the whole map
+        this->levelCount = 1;
+        while ((GridSize - 1) << (this->levelCount - 1) < heightfield.Size()) {
+            this->levelCount++;
+        }
+    }
+    this->levelCount = std::clamp(this->levelCount, 1, MaxLevels);
+
+    program = CreateShaderProgramFromFiles("shaders/terrain.vert", "shaders/terrain.frag");
+    glUniformBlockBinding(program, glGetUniformBlockIndex(program, "Camera"), 0);
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "heightmap"), 1);
+    glUniform1i(glGetUniformLocation(program, "levelCount"), this->levelCount);
+    glUniform1f(glGetUniformLocation(program, "heightScale"), heightfield.HeightScale());
+    glUniform1f(glGetUniformLocation(program, "heightBase"), heightfield.HeightBase());
+    glUniform2f(glGetUniformLocation(program, "terrainOrigin"),
+                -static_cast<float>(heightfield.Size() / 2), -static_cast<float>(heightfield.Size() / 2));
+    levelLocation = glGetUniformLocation(program, "level");
+    patchOffsetLocation = glGetUniformLocation(program, "patchOffset");
+    levelOriginLocation = glGetUniformLocation(program, "levelOrigin");
+    glUseProgram(0);
+
+    std::vector<glm::vec2> vertices;
+    std::vector<uint32_t> indices;
+
+    block = AddGrid(vertices, indices, BlockSize, BlockSize);
+    fixupX = AddGrid(vertices, indices, 3, BlockSize);
+    fixupZ = AddGrid(vertices, indices, BlockSize, 3);
+    trimX = AddGrid(vertices, indices, 2, HoleQuads + 1);
+    trimZ = AddGrid(vertices, indices, HoleQuads + 1, 2);
+    interior = AddGrid(vertices, indices, HoleQuads + 1, HoleQuads + 1);
+    degenerates = AddOuterDegenerates(vertices, indices);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ibo);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(glm::vec2)), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(uint32_t)), indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void *) 0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+
+    glGenTextures(1, &heightTexture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, heightTexture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R16, TextureSize, TextureSize, this->levelCount, 0, GL_RED, GL_UNSIGNED_SHORT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    staging.resize(static_cast<size_t>(TextureSize) * TextureSize);
+}
+
+ClipmapTerrain::~ClipmapTerrain() {
+    glDeleteTextures(1, &heightTexture);
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(program);
+}
+
+ClipmapTerrain::Mesh ClipmapTerrain::AddGrid(std::vector<glm::vec2> &vertices, std::vector<uint32_t> &indices,
+                                             int width, int height) {
+    auto base = static_cast<uint32_t>(vertices.size());
+    size_t first = indices.size();
+
+    for (int z = 0; z < height; z++) {
+        for (int x = 0; x < width; x++) {
+            vertices.emplace_back(static_cast<float>(x), static_cast<float>(z));
+        }
+    }
+
+    for (int z = 0; z < height - 1; z++) {
+        for (int x = 0; x < width - 1; x++) {
+            uint32_t i = base + z * width + x;
+            indices.insert(indices.end(), {i, i + width, i + 1, i + 1, i + width, i + width + 1});
+        }
+    }
+
+    return {static_cast<GLsizei>(indices.size() - first), static_cast<GLsizeiptr>(first * sizeof(uint32_t))};
+}
+
+ClipmapTerrain::Mesh ClipmapTerrain::AddOuterDegenerates(std::vector<glm::vec2> &vertices,
+                                                         std::vector<uint32_t> &indices) {
+    // Zero-area triangles along the outer edge. Morphing makes the odd edge vertices collinear with the coarser level,
+    // and these close any sub-pixel T-junction cracks the rasterizer would otherwise leave.
+    size_t first = indices.size();
+    const int last = GridSize - 1;
+
+    auto edge = [&](glm::ivec2 start, glm::ivec2 step) {
+        auto base = static_cast<uint32_t>(vertices.size());
+
+        for (int i = 0; i < GridSize; i++) {
+            glm::ivec2 p = start + step * i;
+            vertices.emplace_back(static_cast<float>(p.x), static_cast<float>(p.y));
+        }
+
+        for (uint32_t i = 0; i + 2 < GridSize; i += 2) {
+            indices.insert(indices.end(), {base + i, base + i + 1, base + i + 2});
+        }
+    };
+
+    edge({0, 0}, {1, 0});
+    edge({last, 0}, {0, 1});
+    edge({last, last}, {-1, 0});
+    edge({0, last}, {0, -1});
+
+    return {static_cast<GLsizei>(indices.size() - first), static_cast<GLsizeiptr>(first * sizeof(uint32_t))};
+}
+
+void ClipmapTerrain::Update(const glm::vec3 &cameraPos) {
+    stats.texelsUploaded = 0;
+
+    // Camera in level-0 grid coordinates
+    glm::vec2 grid = glm::vec2(cameraPos.x, cameraPos.z) + static_cast<float>(heightfield.Size() / 2);
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, heightTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+
+    for (int l = 0; l < levelCount; l++) {
+        Level &level = levels[l];
+
+        // Snap to the coarser level's grid so vertices coincide; the camera lands in the middle two cells.
+        float coarseSpacing = static_cast<float>(2 << l);
+        glm::ivec2 origin = (glm::ivec2(glm::floor(grid / coarseSpacing)) - HoleBegin) * 2;
+        level.origin = origin;
+
+        if (!level.valid || std::abs(origin.x - level.resident.x) >= TextureSize ||
+            std::abs(origin.y - level.resident.y) >= TextureSize) {
+            UploadRegion(l, origin.x, origin.y, TextureSize, TextureSize);
+        } else {
+            int dx = origin.x - level.resident.x;
+            int dz = origin.y - level.resident.y;
+
+            if (dx > 0) UploadRegion(l, level.resident.x + TextureSize, origin.y, dx, TextureSize);
+            if (dx < 0) UploadRegion(l, origin.x, origin.y, -dx, TextureSize);
+            if (dz > 0) UploadRegion(l, origin.x, level.resident.y + TextureSize, TextureSize, dz);
+            if (dz < 0) UploadRegion(l, origin.x, origin.y, TextureSize, -dz);
+        }
+
+        level.resident = origin;
+        level.valid = true;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+void ClipmapTerrain::UploadRegion(int level, int x0, int z0, int width, int height) {
+    // Split the region where it wraps around the toroidal texture
+    for (int z = z0; z < z0 + height;) {
+        int rows = std::min(z0 + height - z, TextureSize - WrapTexel(z));
+
+        for (int x = x0; x < x0 + width;) {
+            int columns = std::min(x0 + width - x, TextureSize - WrapTexel(x));
+
+            for (int row = 0; row < rows; row++) {
+                uint16_t *dst = &staging[static_cast<size_t>(row) * columns];
+
+                for (int column = 0; column < columns; column++) {
+                    dst[column] = heightfield.Texel(level, x + column, z + row);
+                }
+            }
+
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, WrapTexel(x), WrapTexel(z), level, columns, rows, 1,
+                            GL_RED, GL_UNSIGNED_SHORT, staging.data());
+
+            stats.texelsUploaded += static_cast<uint64_t>(columns) * rows;
+            x += columns;
+        }
+
+        z += rows;
+    }
+}
+
+void ClipmapTerrain::DrawMesh(const Mesh &mesh, int offsetX, int offsetZ) {
+    glUniform2i(patchOffsetLocation, offsetX, offsetZ);
+    glDrawElements(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, (void *) mesh.indexOffset);
+
+    stats.drawCalls++;
+    stats.triangles += mesh.indexCount / 3;
+}
+
+void ClipmapTerrain::Draw() {
+    stats.drawCalls = 0;
+    stats.triangles = 0;
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, heightTexture);
+
+    glm::ivec2 origins[MaxLevels];
+    for (int l = 0; l < levelCount; l++) {
+        origins[l] = levels[l].origin;
+    }
+    glUniform2iv(levelOriginLocation, levelCount, glm::value_ptr(origins[0]));
+
+    for (int l = 0; l < levelCount; l++) {
+        glUniform1i(levelLocation, l);
+
+        for (int bz = 0; bz < 4; bz++) {
+            for (int bx = 0; bx < 4; bx++) {
+                if ((bx == 1 || bx == 2) && (bz == 1 || bz == 2)) {
+                    continue;
+                }
+
+                DrawMesh(block, BlockStarts[bx], BlockStarts[bz]);
+            }
+        }
+
+        DrawMesh(fixupX, 2 * BlockQuads, 0);
+        DrawMesh(fixupX, 2 * BlockQuads, 3 * BlockQuads + 2);
+        DrawMesh(fixupZ, 0, 2 * BlockQuads);
+        DrawMesh(fixupZ, 3 * BlockQuads + 2, 2 * BlockQuads);
+        DrawMesh(degenerates, 0, 0);
+
+        if (l == 0) {
+            DrawMesh(interior, HoleBegin, HoleBegin);
+            continue;
+        }
+
+        // The finer level sits at offset 63 or 64 inside the 128 quad hole; the trim fills the remaining column/row.
+        glm::ivec2 fineOffset = levels[l - 1].origin / 2 - levels[l].origin;
+        int trimColumn = fineOffset.x == HoleBegin ? HoleBegin + HoleQuads - 1 : HoleBegin;
+        int trimRow = fineOffset.y == HoleBegin ? HoleBegin + HoleQuads - 1 : HoleBegin;
+
+        DrawMesh(trimX, trimColumn, HoleBegin);
+        DrawMesh(trimZ, HoleBegin, trimRow);
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(0);
+}
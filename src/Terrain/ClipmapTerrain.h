@@ -0,0 +1,78 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "Heightfield.h"
+
+// Geometry clipmap terrain (Losasso & Hoppe 2004, block layout from GPU Gems 2 ch. 2).
+//
+// Every level is a 255x255 vertex grid at twice the spacing of the previous one, assembled from a handful of shared
+// meshes (64x64 blocks, ring fix-ups, the L-shaped interior trim and an outer strip of degenerate triangles). Heights
+// live in a 256x256 layer of a texture array per level, addressed toroidally: as the camera moves only the newly
+// exposed rows/columns are uploaded. Vertices near the outer edge of a level morph towards the next coarser level so
+// the boundaries are seamless. Draw count and memory are fixed by the level count, not by the map size.
+class ClipmapTerrain {
+public:
+    static constexpr int MaxLevels = 10;
+    static constexpr int GridSize = 255;      // vertices per level side (2^k - 1)
+    static constexpr int TextureSize = 256;
+
+    struct Stats {
+        int drawCalls = 0;
+        uint64_t triangles = 0;
+        uint64_t texelsUploaded = 0;          // last Update() only
+    };
+
+    explicit ClipmapTerrain(const Heightfield &heightfield, int levelCount = 0);
+    ~ClipmapTerrain();
+
+    ClipmapTerrain(const ClipmapTerrain &) = delete;
+    ClipmapTerrain &operator=(const ClipmapTerrain &) = delete;
+
+    // Recenters the levels on the camera and streams the exposed texels.
+    void Update(const glm::vec3 &cameraPos);
+
+    // Expects the Camera uniform block to be bound at binding 0.
+    void Draw();
+
+    int LevelCount() const { return levelCount; }
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Mesh {
+        GLsizei indexCount;
+        GLsizeiptr indexOffset;
+    };
+
+    struct Level {
+        glm::ivec2 origin;                    // grid coordinates (in level texels) of vertex (0, 0)
+        glm::ivec2 resident;                  // origin of the 256x256 region currently in the texture
+        bool valid = false;
+    };
+
+    Mesh AddGrid(std::vector<glm::vec2> &vertices, std::vector<uint32_t> &indices, int width, int height);
+    Mesh AddOuterDegenerates(std::vector<glm::vec2> &vertices, std::vector<uint32_t> &indices);
+
+    void UploadRegion(int level, int x0, int z0, int width, int height);
+    void DrawMesh(const Mesh &mesh, int offsetX, int offsetZ);
+
+    const Heightfield &heightfield;
+    int levelCount;
+    Level levels[MaxLevels];
+
+    GLuint program = 0;
+    GLuint vao = 0, vbo = 0, ibo = 0;
+    GLuint heightTexture = 0;
+
+    GLint levelLocation = -1;
+    GLint patchOffsetLocation = -1;
+    GLint levelOriginLocation = -1;
+
+    Mesh block{}, fixupX{}, fixupZ{}, trimX{}, trimZ{}, interior{}, degenerates{};
+
+    std::vector<uint16_t> staging;
+    Stats stats;
+};
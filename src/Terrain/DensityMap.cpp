@@ -0,0 +1,97 @@
+#include "DensityMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Heightfield.h"
+#include "../Asset/Vfs.h"
+#include "../stb_image.h"
+
+DensityMap::DensityMap(int size, float worldSize) : size(size), worldSize(worldSize) {
+    texels.resize(static_cast<size_t>(size) * size);
+}
+
+DensityMap DensityMap::LoadImage(const std::string &path, float worldSize) {
+    FileData file = AssetFiles().Read(path);
+
+    int w, h, channels;
+    unsigned char *data = stbi_load_from_memory(file.Data(), static_cast<int>(file.Size()), &w, &h, &channels, 1);
+
+    if (!data) {
+        throw std::runtime_error("Failed to Load Density Map: " + path);
+    }
+
+    if (w != h) {
+        stbi_image_free(data);
+        throw std::runtime_error("Density Map Must Be Square: " + path);
+    }
+
+    DensityMap map(w, worldSize);
+    std::copy(data, data + static_cast<size_t>(w) * h, map.texels.begin());
+    stbi_image_free(data);
+
+    return map;
+}
+
+static float Noise(uint32_t seed, float x, float z) {
+    auto hash = [seed](int ix, int iz) {
+        uint32_t h = seed ^ (static_cast<uint32_t>(ix) * 0x27d4eb2du) ^ (static_cast<uint32_t>(iz) * 0x165667b1u);
+        h = (h ^ (h >> 15)) * 0x85ebca6bu;
+        h ^= h >> 13;
+        return static_cast<float>(h & 0xffff) / 65535.0f;
+    };
+
+    int x0 = static_cast<int>(std::floor(x)), z0 = static_cast<int>(std::floor(z));
+    float fx = x - static_cast<float>(x0), fz = z - static_cast<float>(z0);
+    fx = fx * fx * (3.0f - 2.0f * fx);
+    fz = fz * fz * (3.0f - 2.0f * fz);
+
+    float a = hash(x0, z0) + (hash(x0 + 1, z0) - hash(x0, z0)) * fx;
+    float b = hash(x0, z0 + 1) + (hash(x0 + 1, z0 + 1) - hash(x0, z0 + 1)) * fx;
+    return a + (b - a) * fz;
+}
+
+DensityMap DensityMap::Generate(const Heightfield &heightfield, float texelSize, uint32_t seed, float coverage,
+                                float maxSlope) {
+    auto worldSize = static_cast<float>(heightfield.Size());
+    int size = std::max(1, static_cast<int>(worldSize / texelSize));
+    DensityMap map(size, worldSize);
+
+    for (int z = 0; z < size; z++) {
+        for (int x = 0; x < size; x++) {
+            float wx = (static_cast<float>(x) + 0.5f) * texelSize - worldSize * 0.5f;
+            float wz = (static_cast<float>(z) + 0.5f) * texelSize - worldSize * 0.5f;
+
+            float dx = heightfield.HeightAt(wx + texelSize, wz) - heightfield.HeightAt(wx - texelSize, wz);
+            float dz = heightfield.HeightAt(wx, wz + texelSize) - heightfield.HeightAt(wx, wz - texelSize);
+            float slope = std::sqrt(dx * dx + dz * dz) / (2.0f * texelSize);
+
+            float patches = Noise(seed, wx / 300.0f, wz / 300.0f) * 0.7f + Noise(seed + 1, wx / 60.0f, wz / 60.0f) * 0.3f;
+            float density = std::clamp((patches - (1.0f - coverage)) * 4.0f, 0.0f, 1.0f);
+            density *= std::clamp((maxSlope - slope) / (maxSlope * 0.25f), 0.0f, 1.0f);
+
+            map.texels[static_cast<size_t>(z) * size + x] = static_cast<uint8_t>(density * 255.0f);
+        }
+    }
+
+    return map;
+}
+
+float DensityMap::Sample(float worldX, float worldZ) const {
+    float u = (worldX / worldSize + 0.5f) * static_cast<float>(size) - 0.5f;
+    float v = (worldZ / worldSize + 0.5f) * static_cast<float>(size) - 0.5f;
+
+    int x0 = static_cast<int>(std::floor(u)), z0 = static_cast<int>(std::floor(v));
+    float fx = u - static_cast<float>(x0), fz = v - static_cast<float>(z0);
+
+    auto texel = [this](int x, int z) {
+        x = std::clamp(x, 0, size - 1);
+        z = std::clamp(z, 0, size - 1);
+        return static_cast<float>(texels[static_cast<size_t>(z) * size + x]);
+    };
+
+    float a = texel(x0, z0) + (texel(x0 + 1, z0) - texel(x0, z0)) * fx;
+    float b = texel(x0, z0 + 1) + (texel(x0 + 1, z0 + 1) - texel(x0, z0 + 1)) * fx;
+    return (a + (b - a) * fz) / 255.0f;
+}
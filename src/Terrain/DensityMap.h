@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Heightfield;
+
+// 8-bit placement density covering the whole terrain, sampled bilinearly in world space. Authored maps are greyscale
+// images stretched over the heightfield; without one a map is derived from terrain slope plus low frequency noise.
+class DensityMap {
+public:
+    static DensityMap LoadImage(const std::string &path, float worldSize);
+
+    // coverage in [0, 1] is the fraction of flat ground that ends up populated; slopes above maxSlope (dy/dx) are bare.
+    static DensityMap Generate(const Heightfield &heightfield, float texelSize, uint32_t seed, float coverage,
+                               float maxSlope);
+
+    float Sample(float worldX, float worldZ) const;
+
+private:
+    DensityMap(int size, float worldSize);
+
+    int size;
+    float worldSize;
+    std::vector<uint8_t> texels;
+};
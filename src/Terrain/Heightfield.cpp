@@ -0,0 +1,146 @@
+#include "Heightfield.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+Heightfield::Heightfield(int size, float heightScale, float heightBase)
+    : size(size), heightScale(heightScale), heightBase(heightBase) {
+}
+
+static int Raw16Size(size_t bytes, const std::string &name) {
+    int size = static_cast<int>(std::lround(std::sqrt(static_cast<double>(bytes / 2))));
+
+    if (size <= 0 || static_cast<size_t>(size) * size * 2 != bytes || (size & (size - 1)) != 0) {
+        throw std::runtime_error("Heightmap Must Be a Square Power of Two R16 File: " + name);
+    }
+    return size;
+}
+
+Heightfield Heightfield::LoadRaw16(const std::string &path, float heightScale, float heightBase) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file) {
+        throw std::runtime_error("Failed to Open Heightmap File: " + path);
+    }
+
+    auto bytes = static_cast<size_t>(file.tellg());
+    int size = Raw16Size(bytes, path);
+
+    Heightfield field(size, heightScale, heightBase);
+    field.mips.emplace_back(static_cast<size_t>(size) * size);
+
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(field.mips[0].data()), static_cast<std::streamsize>(bytes));
+
+    field.BuildMips();
+    return field;
+}
+
+Heightfield Heightfield::FromRaw16(std::span<const uint8_t> bytes, float heightScale, float heightBase, const std::string &name) {
+    int size = Raw16Size(bytes.size(), name);
+
+    Heightfield field(size, heightScale, heightBase);
+    field.mips.emplace_back(static_cast<size_t>(size) * size);
+    std::memcpy(field.mips[0].data(), bytes.data(), bytes.size());
+
+    field.BuildMips();
+    return field;
+}
+
+static float Hash(uint32_t seed, int x, int z) {
+    uint32_t h = seed ^ (static_cast<uint32_t>(x) * 0x8da6b343u) ^ (static_cast<uint32_t>(z) * 0xd8163841u);
+    h = (h ^ (h >> 13)) * 0x5bd1e995u;
+    h ^= h >> 15;
+    return static_cast<float>(h & 0xffffff) / static_cast<float>(0xffffff);
+}
+
+static float ValueNoise(uint32_t seed, float x, float z) {
+    int x0 = static_cast<int>(std::floor(x));
+    int z0 = static_cast<int>(std::floor(z));
+    float fx = x - static_cast<float>(x0);
+    float fz = z - static_cast<float>(z0);
+
+    fx = fx * fx * (3.0f - 2.0f * fx);
+    fz = fz * fz * (3.0f - 2.0f * fz);
+
+    float a = Hash(seed, x0, z0), b = Hash(seed, x0 + 1, z0);
+    float c = Hash(seed, x0, z0 + 1), d = Hash(seed, x0 + 1, z0 + 1);
+
+    return (a + (b - a) * fx) + ((c + (d - c) * fx) - (a + (b - a) * fx)) * fz;
+}
+
+Heightfield Heightfield::Generate(int size, uint32_t seed, float heightScale, float heightBase) {
+    Heightfield field(size, heightScale, heightBase);
+    field.mips.emplace_back(static_cast<size_t>(size) * size);
+
+    std::vector<uint16_t> &base = field.mips[0];
+
+    for (int z = 0; z < size; z++) {
+        for (int x = 0; x < size; x++) {
+            float h = 0.0f, amplitude = 0.5f, frequency = 1.0f / 1024.0f;
+
+            for (int octave = 0; octave < 6; octave++) {
+                h += ValueNoise(seed + octave, x * frequency, z * frequency) * amplitude;
+                amplitude *= 0.5f;
+                frequency *= 2.0f;
+            }
+
+            base[static_cast<size_t>(z) * size + x] = static_cast<uint16_t>(std::clamp(h, 0.0f, 1.0f) * 65535.0f);
+        }
+    }
+
+    field.BuildMips();
+    return field;
+}
+
+void Heightfield::BuildMips() {
+    for (int mipSize = size / 2; mipSize >= 1; mipSize /= 2) {
+        const std::vector<uint16_t> &src = mips.back();
+        std::vector<uint16_t> dst(static_cast<size_t>(mipSize) * mipSize);
+        int srcSize = mipSize * 2;
+
+        for (int z = 0; z < mipSize; z++) {
+            for (int x = 0; x < mipSize; x++) {
+                const uint16_t *row0 = &src[static_cast<size_t>(z * 2) * srcSize + x * 2];
+                const uint16_t *row1 = row0 + srcSize;
+                dst[static_cast<size_t>(z) * mipSize + x] = static_cast<uint16_t>((row0[0] + row0[1] + row1[0] + row1[1] + 2) / 4);
+            }
+        }
+
+        mips.push_back(std::move(dst));
+    }
+}
+
+uint16_t Heightfield::Texel(int mip, int x, int z) const {
+    int last = MipCount() - 1;
+
+    if (mip > last) {
+        x >>= mip - last;
+        z >>= mip - last;
+        mip = last;
+    }
+
+    int mipSize = MipSize(mip);
+    x = std::clamp(x, 0, mipSize - 1);
+    z = std::clamp(z, 0, mipSize - 1);
+
+    return mips[mip][static_cast<size_t>(z) * mipSize + x];
+}
+
+float Heightfield::HeightAt(float worldX, float worldZ) const {
+    float gx = worldX + static_cast<float>(size / 2);
+    float gz = worldZ + static_cast<float>(size / 2);
+    int x0 = static_cast<int>(std::floor(gx));
+    int z0 = static_cast<int>(std::floor(gz));
+    float fx = gx - static_cast<float>(x0);
+    float fz = gz - static_cast<float>(z0);
+
+    float a = Texel(0, x0, z0), b = Texel(0, x0 + 1, z0);
+    float c = Texel(0, x0, z0 + 1), d = Texel(0, x0 + 1, z0 + 1);
+    float h = (a + (b - a) * fx) + ((c + (d - c) * fx) - (a + (b - a) * fx)) * fz;
+
+    return h / 65535.0f * heightScale + heightBase;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// Square 16-bit heightfield with 1m texel spacing and a full box-filtered mip chain. Mip L is what clipmap level L
+// samples, so every clipmap level reads texels at its own spacing without filtering at runtime.
+//
+// Texel (0, 0) sits at world (-Size() / 2, -Size() / 2); heights are Texel() / 65535 * heightScale + heightBase.
+class Heightfield {
+public:
+    // Raw little-endian R16 file, width == height, size inferred from the file length (a 16km map is 16384^2).
+    static Heightfield LoadRaw16(const std::string &path, float heightScale, float heightBase = 0.0f);
+
+    // Same layout from bytes already in memory (a pack entry); name is only used in errors.
+    static Heightfield FromRaw16(std::span<const uint8_t> bytes, float heightScale, float heightBase, const std::string &name);
+
+    // Fractal value noise, used when no authored heightmap is present.
+    static Heightfield Generate(int size, uint32_t seed, float heightScale, float heightBase = 0.0f);
+
+    int Size() const { return size; }
+    int MipCount() const { return static_cast<int>(mips.size()); }
+    int MipSize(int mip) const { return size >> mip; }
+
+    float HeightScale() const { return heightScale; }
+    float HeightBase() const { return heightBase; }
+    void SetHeightBase(float base) { heightBase = base; }
+
+    // Clamped texel read in mip-local coordinates. Mips past the end of the chain fall back to the last mip.
+    uint16_t Texel(int mip, int x, int z) const;
+
+    // Bilinear height at a world position (mip 0).
+    float HeightAt(float worldX, float worldZ) const;
+
+private:
+    Heightfield(int size, float heightScale, float heightBase);
+
+    void BuildMips();
+
+    int size;
+    float heightScale;
+    float heightBase;
+    std::vector<std::vector<uint16_t>> mips;
+};
@@ -0,0 +1,492 @@
+#include "ScatterSystem.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "../Render/Frustum.h"
+#include "../Render/RingBuffer.h"
+#include "../Render/Shader.h"
+
+static constexpr int ImpostorFrames = 8;
+static constexpr int ImpostorFrameWidth = 128;
+static constexpr int ImpostorFrameHeight = 192;
+static constexpr GLuint CullGroupSize = 256;
+
+struct VegetationVertex {
+    glm::vec3 pos;
+    glm::vec3 normal;
+    glm::vec3 color;
+};
+
+static uint32_t Hash(uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t h = a * 0x9e3779b1u ^ b * 0x85ebca77u ^ c * 0xc2b2ae3du;
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+    return h;
+}
+
+static float Unit(uint32_t h) {
+    return static_cast<float>(h >> 8) / static_cast<float>(1u << 24);
+}
+
+static int WrapCell(int c, int ringCells) {
+    return ((c % ringCells) + ringCells) % ringCells;
+}
+
+static void AddCone(std::vector<VegetationVertex> &vertices, std::vector<uint32_t> &indices, float baseY, float topY,
+                    float baseRadius, float topRadius, int segments, glm::vec3 color) {
+    const float step = 2.0f * 3.14159265f / static_cast<float>(segments);
+    float slope = (baseRadius - topRadius) / (topY - baseY);
+
+    for (int i = 0; i < segments; i++) {
+        float a0 = step * static_cast<float>(i), a1 = step * static_cast<float>(i + 1);
+        glm::vec3 n0 = glm::normalize(glm::vec3(std::sin(a0), slope, std::cos(a0)));
+        glm::vec3 n1 = glm::normalize(glm::vec3(std::sin(a1), slope, std::cos(a1)));
+        auto base = static_cast<uint32_t>(vertices.size());
+
+        vertices.push_back({{std::sin(a0) * baseRadius, baseY, std::cos(a0) * baseRadius}, n0, color});
+        vertices.push_back({{std::sin(a1) * baseRadius, baseY, std::cos(a1) * baseRadius}, n1, color});
+        vertices.push_back({{std::sin(a1) * topRadius, topY, std::cos(a1) * topRadius}, n1, color});
+        vertices.push_back({{std::sin(a0) * topRadius, topY, std::cos(a0) * topRadius}, n0, color});
+
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+}
+
+static void AddBlades(std::vector<VegetationVertex> &vertices, std::vector<uint32_t> &indices, int blades,
+                      float width, float height, glm::vec3 color) {
+    for (int i = 0; i < blades; i++) {
+        float a = 3.14159265f * static_cast<float>(i) / static_cast<float>(blades);
+        glm::vec3 side(std::cos(a) * width * 0.5f, 0.0f, std::sin(a) * width * 0.5f);
+        glm::vec3 normal(-side.z, 0.0f, side.x);
+        normal = glm::normalize(normal + glm::vec3(0.0f, glm::length(normal), 0.0f));
+        auto base = static_cast<uint32_t>(vertices.size());
+
+        vertices.push_back({-side, normal, color * 0.6f});
+        vertices.push_back({side, normal, color * 0.6f});
+        vertices.push_back({side * 0.3f + glm::vec3(0.0f, height, 0.0f), normal, color});
+        vertices.push_back({-side * 0.3f + glm::vec3(0.0f, height, 0.0f), normal, color});
+
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+}
+
+bool ScatterSystem::IsSupported() {
+    return GLAD_GL_VERSION_4_3;
+}
+
+ScatterSystem::ScatterSystem(const Heightfield &heightfield, const std::vector<ScatterLayerDesc> &layerDescs)
+    : heightfield(heightfield) {
+    if (layerDescs.empty() || layerDescs.size() > MaxLayers) {
+        throw std::runtime_error("ScatterSystem: Between 1 and " + std::to_string(MaxLayers) + " Layers Required");
+    }
+
+    GLuint visibleSlots = 0;
+
+    for (const ScatterLayerDesc &desc: layerDescs) {
+        Layer layer{};
+        layer.desc = desc;
+        layer.slotsPerCell = desc.candidatesPerAxis * desc.candidatesPerAxis;
+        layer.firstSlot = totalSlots;
+        layer.slotCount = static_cast<GLuint>(desc.ringCells * desc.ringCells * layer.slotsPerCell);
+        layer.visibleBase = visibleSlots;
+        layer.residentCells.assign(static_cast<size_t>(desc.ringCells) * desc.ringCells, glm::ivec2(INT32_MIN));
+        layer.impostors = desc.maxDistance > desc.lod1Distance && desc.mesh == ScatterLayerDesc::Mesh::Tree;
+
+        totalSlots += layer.slotCount;
+        visibleSlots += layer.slotCount * 3;
+        layers.push_back(std::move(layer));
+    }
+
+    stats.slots = totalSlots;
+    copies.reserve(1024);
+
+    cullProgram = CreateComputeProgramFromFile("shaders/scatter_cull.comp");
+    meshProgram = CreateShaderProgramFromFiles("shaders/vegetation.vert", "shaders/vegetation.frag");
+    impostorProgram = CreateShaderProgramFromFiles("shaders/impostor.vert", "shaders/impostor.frag");
+    glUniformBlockBinding(meshProgram, glGetUniformBlockIndex(meshProgram, "Camera"), 0);
+    glUniformBlockBinding(impostorProgram, glGetUniformBlockIndex(impostorProgram, "Camera"), 0);
+
+    frustumLocation = glGetUniformLocation(cullProgram, "frustumPlanes");
+    cameraPosLocation = glGetUniformLocation(cullProgram, "cameraPos");
+    slotCountLocation = glGetUniformLocation(cullProgram, "slotCount");
+
+    // Empty slots have scale 0 and are rejected by the cull shader
+    std::vector<Instance> empty(totalSlots, Instance{glm::vec4(0.0f), glm::vec4(0.0f)});
+
+    glGenBuffers(1, &instanceBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, instanceBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(totalSlots * sizeof(Instance)), empty.data(), GL_DYNAMIC_DRAW);
+
+    glGenBuffers(1, &visibleBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, visibleBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(visibleSlots * sizeof(Instance)), nullptr, GL_DYNAMIC_COPY);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    BuildMeshes();
+
+    // Command order: every layer's two mesh LODs, then every layer's impostor
+    auto layerCount = static_cast<GLuint>(layers.size());
+    commandTemplate.resize(layerCount * 3);
+
+    for (GLuint l = 0; l < layerCount; l++) {
+        const Layer &layer = layers[l];
+
+        for (int lod = 0; lod < 2; lod++) {
+            const MeshRange &range = layer.lods[lod];
+            commandTemplate[l * 2 + lod] = {range.indexCount, 0, range.firstIndex, range.baseVertex,
+                                            layer.visibleBase + layer.slotCount * lod};
+        }
+
+        commandTemplate[layerCount * 2 + l] = {impostorQuad.indexCount, 0, impostorQuad.firstIndex,
+                                               impostorQuad.baseVertex, layer.visibleBase + layer.slotCount * 2};
+    }
+
+    glGenBuffers(1, &commandBuffer);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(commandTemplate.size() * sizeof(DrawCommand)),
+                 commandTemplate.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    // Per-layer constants for the cull and impostor shaders
+    glm::vec4 distances[MaxLayers];
+    glm::vec4 bounds[MaxLayers];
+    glm::vec2 impostorSizes[MaxLayers];
+
+    for (size_t l = 0; l < layers.size(); l++) {
+        const Layer &layer = layers[l];
+        const ScatterLayerDesc &desc = layer.desc;
+        glm::vec3 center = (layer.boundsMin + layer.boundsMax) * 0.5f;
+        float maxDistance = layer.impostors ? desc.maxDistance : std::min(desc.maxDistance, desc.lod1Distance);
+
+        distances[l] = glm::vec4(desc.lod0Distance * desc.lod0Distance, desc.lod1Distance * desc.lod1Distance,
+                                 maxDistance * maxDistance, 0.0f);
+        bounds[l] = glm::vec4(center.y, glm::length(layer.boundsMax - center), 0.0f, 0.0f);
+        impostorSizes[l] = glm::vec2(std::max(-layer.boundsMin.x, layer.boundsMax.x) * 2.0f, layer.boundsMax.y);
+    }
+
+    glUseProgram(cullProgram);
+    glUniform4fv(glGetUniformLocation(cullProgram, "layerDistances"), static_cast<GLsizei>(layers.size()), glm::value_ptr(distances[0]));
+    glUniform4fv(glGetUniformLocation(cullProgram, "layerBounds"), static_cast<GLsizei>(layers.size()), glm::value_ptr(bounds[0]));
+    glUniform1i(glGetUniformLocation(cullProgram, "layerCount"), static_cast<GLint>(layers.size()));
+
+    glUseProgram(impostorProgram);
+    glUniform2fv(glGetUniformLocation(impostorProgram, "impostorSize"), static_cast<GLsizei>(layers.size()), glm::value_ptr(impostorSizes[0]));
+    glUniform1i(glGetUniformLocation(impostorProgram, "impostorAtlas"), 2);
+    glUseProgram(0);
+
+    BakeImpostors();
+}
+
+ScatterSystem::~ScatterSystem() {
+    glDeleteTextures(1, &impostorAtlas);
+    glDeleteBuffers(1, &commandBuffer);
+    glDeleteBuffers(1, &visibleBuffer);
+    glDeleteBuffers(1, &instanceBuffer);
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(impostorProgram);
+    glDeleteProgram(meshProgram);
+    glDeleteProgram(cullProgram);
+}
+
+void ScatterSystem::BuildMeshes() {
+    std::vector<VegetationVertex> vertices;
+    std::vector<uint32_t> indices;
+
+    auto begin = [&]() {
+        return MeshRange{0, static_cast<GLuint>(indices.size()), static_cast<GLint>(vertices.size())};
+    };
+
+    // Indices are written relative to the mesh's base vertex
+    auto end = [&](MeshRange &range) {
+        range.indexCount = static_cast<GLuint>(indices.size()) - range.firstIndex;
+
+        for (GLuint i = range.firstIndex; i < indices.size(); i++) {
+            indices[i] -= static_cast<uint32_t>(range.baseVertex);
+        }
+    };
+
+    const glm::vec3 bark(0.30f, 0.22f, 0.14f), needles(0.13f, 0.26f, 0.12f), grass(0.30f, 0.42f, 0.16f);
+
+    for (Layer &layer: layers) {
+        size_t firstVertex = vertices.size();
+
+        if (layer.desc.mesh == ScatterLayerDesc::Mesh::Tree) {
+            layer.lods[0] = begin();
+            AddCone(vertices, indices, 0.0f, 3.0f, 0.25f, 0.18f, 8, bark);
+            AddCone(vertices, indices, 2.0f, 7.0f, 2.5f, 0.0f, 12, needles);
+            AddCone(vertices, indices, 4.5f, 8.5f, 1.8f, 0.0f, 12, needles);
+            end(layer.lods[0]);
+
+            layer.lods[1] = begin();
+            AddCone(vertices, indices, 0.0f, 2.5f, 0.25f, 0.2f, 4, bark);
+            AddCone(vertices, indices, 2.0f, 8.5f, 2.5f, 0.0f, 6, needles);
+            end(layer.lods[1]);
+        } else {
+            layer.lods[0] = begin();
+            AddBlades(vertices, indices, 3, 0.5f, 0.6f, grass);
+            end(layer.lods[0]);
+
+            layer.lods[1] = begin();
+            AddBlades(vertices, indices, 1, 0.6f, 0.5f, grass);
+            end(layer.lods[1]);
+        }
+
+        layer.boundsMin = glm::vec3(INFINITY);
+        layer.boundsMax = glm::vec3(-INFINITY);
+
+        for (size_t v = firstVertex; v < vertices.size(); v++) {
+            layer.boundsMin = glm::min(layer.boundsMin, vertices[v].pos);
+            layer.boundsMax = glm::max(layer.boundsMax, vertices[v].pos);
+        }
+    }
+
+    // Unit billboard: x in [-0.5, 0.5], y in [0, 1]
+    impostorQuad = begin();
+    auto quadBase = static_cast<uint32_t>(vertices.size());
+    for (glm::vec2 corner: {glm::vec2(-0.5f, 0.0f), glm::vec2(0.5f, 0.0f), glm::vec2(0.5f, 1.0f), glm::vec2(-0.5f, 1.0f)}) {
+        vertices.push_back({glm::vec3(corner, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f)});
+    }
+    indices.insert(indices.end(), {quadBase, quadBase + 1, quadBase + 2, quadBase, quadBase + 2, quadBase + 3});
+    end(impostorQuad);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ibo);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(VegetationVertex)), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(uint32_t)), indices.data(), GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VegetationVertex), (void *) offsetof(VegetationVertex, pos));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(VegetationVertex), (void *) offsetof(VegetationVertex, normal));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(VegetationVertex), (void *) offsetof(VegetationVertex, color));
+    glEnableVertexAttribArray(2);
+
+    // Per-instance data comes straight from the culled visible buffer; baseInstance selects the LOD range
+    glBindBuffer(GL_ARRAY_BUFFER, visibleBuffer);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void *) offsetof(Instance, posScale));
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 1);
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void *) offsetof(Instance, params));
+    glEnableVertexAttribArray(4);
+    glVertexAttribDivisor(4, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void ScatterSystem::BakeImpostors() {
+    const int atlasWidth = ImpostorFrameWidth * ImpostorFrames;
+
+    glGenTextures(1, &impostorAtlas);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, impostorAtlas);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, atlasWidth, ImpostorFrameHeight, static_cast<GLsizei>(layers.size()),
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    GLint previousViewport[4];
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+
+    GLuint fbo, depth, camera;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, atlasWidth, ImpostorFrameHeight);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+    glGenBuffers(1, &camera);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, camera);
+
+    // Frame f shows the tree from yaw f * 45 degrees; the eight views go to the start of the visible buffer
+    Instance views[ImpostorFrames];
+
+    glUseProgram(meshProgram);
+    glBindVertexArray(vao);
+    glEnable(GL_DEPTH_TEST);
+
+    for (size_t l = 0; l < layers.size(); l++) {
+        const Layer &layer = layers[l];
+
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, impostorAtlas, 0, static_cast<GLint>(l));
+        glViewport(0, 0, atlasWidth, ImpostorFrameHeight);
+        glClearColor(0.13f, 0.26f, 0.12f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        if (!layer.impostors) {
+            continue;
+        }
+
+        float halfWidth = std::max(-layer.boundsMin.x, layer.boundsMax.x);
+        glm::mat4 matrices[2] = {
+            glm::mat4(1.0f),
+            glm::ortho(-halfWidth, halfWidth, 0.0f, layer.boundsMax.y, -50.0f, 50.0f)
+        };
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(matrices), matrices, GL_STATIC_DRAW);
+
+        for (int f = 0; f < ImpostorFrames; f++) {
+            float yaw = -2.0f * 3.14159265f * static_cast<float>(f) / ImpostorFrames;
+            views[f] = {glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(yaw, 0.5f, static_cast<float>(l), 0.0f)};
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, visibleBuffer);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(views), views);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        for (int f = 0; f < ImpostorFrames; f++) {
+            glViewport(f * ImpostorFrameWidth, 0, ImpostorFrameWidth, ImpostorFrameHeight);
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, static_cast<GLsizei>(layer.lods[0].indexCount),
+                                                          GL_UNSIGNED_INT, (void *) (layer.lods[0].firstIndex * sizeof(uint32_t)),
+                                                          1, layer.lods[0].baseVertex, static_cast<GLuint>(f));
+        }
+    }
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+
+    glDeleteBuffers(1, &camera);
+    glDeleteRenderbuffers(1, &depth);
+    glDeleteFramebuffers(1, &fbo);
+
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+void ScatterSystem::PopulateCell(const Layer &layer, int layerIndex, glm::ivec2 cell, Instance *out) const {
+    const ScatterLayerDesc &desc = layer.desc;
+    const float spacing = desc.cellSize / static_cast<float>(desc.candidatesPerAxis);
+    const float halfMap = static_cast<float>(heightfield.Size() / 2);
+    const glm::vec2 cellOrigin = glm::vec2(cell) * desc.cellSize;
+
+    for (int j = 0; j < desc.candidatesPerAxis; j++) {
+        for (int i = 0; i < desc.candidatesPerAxis; i++) {
+            Instance &instance = out[j * desc.candidatesPerAxis + i];
+            uint32_t h = Hash(static_cast<uint32_t>(cell.x) * 73856093u ^ static_cast<uint32_t>(cell.y) * 19349663u,
+                              static_cast<uint32_t>(j * desc.candidatesPerAxis + i), static_cast<uint32_t>(layerIndex));
+
+            float x = cellOrigin.x + (static_cast<float>(i) + Unit(h)) * spacing;
+            float z = cellOrigin.y + (static_cast<float>(j) + Unit(Hash(h, 1, 0))) * spacing;
+            float density = desc.density ? desc.density->Sample(x, z) : 1.0f;
+
+            if (Unit(Hash(h, 2, 0)) >= density || std::abs(x) >= halfMap || std::abs(z) >= halfMap) {
+                instance = {glm::vec4(0.0f), glm::vec4(0.0f)};
+                continue;
+            }
+
+            float scale = desc.minScale + (desc.maxScale - desc.minScale) * Unit(Hash(h, 3, 0));
+            float yaw = Unit(Hash(h, 4, 0)) * 2.0f * 3.14159265f;
+
+            instance.posScale = glm::vec4(x, heightfield.HeightAt(x, z), z, scale);
+            instance.params = glm::vec4(yaw, Unit(Hash(h, 5, 0)), static_cast<float>(layerIndex), 0.0f);
+        }
+    }
+}
+
+void ScatterSystem::Update(const glm::vec3 &cameraPos, RingBuffer &upload) {
+    stats.cellsRebuilt = 0;
+    stats.cellsPending = 0;
+    copies.clear();
+
+    for (size_t l = 0; l < layers.size(); l++) {
+        Layer &layer = layers[l];
+        const int ring = layer.desc.ringCells;
+        const auto cellBytes = static_cast<GLsizeiptr>(layer.slotsPerCell * sizeof(Instance));
+
+        glm::ivec2 first = glm::ivec2(glm::floor(glm::vec2(cameraPos.x, cameraPos.z) / layer.desc.cellSize)) - ring / 2;
+
+        for (int cz = first.y; cz < first.y + ring; cz++) {
+            for (int cx = first.x; cx < first.x + ring; cx++) {
+                int slot = WrapCell(cx, ring) + WrapCell(cz, ring) * ring;
+
+                if (layer.residentCells[slot] == glm::ivec2(cx, cz)) {
+                    continue;
+                }
+
+                RingBuffer::Allocation alloc = upload.Allocate(cellBytes, 16);
+                if (!alloc) {
+                    stats.cellsPending++;
+                    continue;
+                }
+
+                PopulateCell(layer, static_cast<int>(l), glm::ivec2(cx, cz), static_cast<Instance *>(alloc.ptr));
+
+                GLintptr dst = static_cast<GLintptr>(layer.firstSlot + slot * layer.slotsPerCell) * sizeof(Instance);
+                copies.push_back({alloc.offset, dst, cellBytes});
+
+                layer.residentCells[slot] = glm::ivec2(cx, cz);
+                stats.cellsRebuilt++;
+            }
+        }
+    }
+
+    if (copies.empty()) {
+        return;
+    }
+
+    upload.Commit();
+
+    glBindBuffer(GL_COPY_READ_BUFFER, upload.Buffer());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, instanceBuffer);
+
+    for (const PendingCopy &copy: copies) {
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, copy.src, copy.dst, copy.size);
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+}
+
+void ScatterSystem::Draw(const glm::mat4 &viewProj, const glm::vec3 &cameraPos) {
+    Frustum frustum = Frustum::FromMatrix(viewProj);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, static_cast<GLsizeiptr>(commandTemplate.size() * sizeof(DrawCommand)),
+                    commandTemplate.data());
+
+    glUseProgram(cullProgram);
+    glUniform4fv(frustumLocation, 6, glm::value_ptr(frustum.planes[0]));
+    glUniform3fv(cameraPosLocation, 1, glm::value_ptr(cameraPos));
+    glUniform1ui(slotCountLocation, totalSlots);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, instanceBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, visibleBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, commandBuffer);
+    glDispatchCompute((totalSlots + CullGroupSize - 1) / CullGroupSize, 1, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+
+    auto layerCount = static_cast<GLsizei>(layers.size());
+    glBindVertexArray(vao);
+
+    glUseProgram(meshProgram);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, layerCount * 2, 0);
+
+    glUseProgram(impostorProgram);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, impostorAtlas);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void *) (layerCount * 2 * sizeof(DrawCommand)), layerCount, 0);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glActiveTexture(GL_TEXTURE0);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
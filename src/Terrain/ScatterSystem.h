@@ -0,0 +1,122 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "DensityMap.h"
+#include "Heightfield.h"
+
+class RingBuffer;
+
+struct ScatterLayerDesc {
+    enum class Mesh { Tree, Grass };
+
+    Mesh mesh = Mesh::Tree;
+    const DensityMap *density = nullptr;
+
+    float cellSize = 64.0f;
+    int candidatesPerAxis = 8;                // jittered grid of candidate positions per cell
+    int ringCells = 32;                       // resident cells per side, centered on the camera
+
+    float lod0Distance = 60.0f;
+    float lod1Distance = 150.0f;
+    float maxDistance = 1500.0f;              // past lod1Distance instances draw as impostors, if this is larger
+
+    float minScale = 0.8f;
+    float maxScale = 1.2f;
+};
+
+// Procedural instance scattering over the terrain with GPU culling.
+//
+// Each layer keeps a fixed ring of cells around the camera, addressed toroidally like the clipmap levels; a cell
+// entering the ring is populated on the CPU from its density map and uploaded through the frame RingBuffer into its
+// slot range of one instance SSBO. Every frame a compute shader frustum and distance culls all slots, picks a LOD
+// and appends survivors into per-LOD ranges of a visible buffer while bumping the instance counts of an indirect
+// command buffer, which is then drawn with two glMultiDrawElementsIndirect calls (meshes, then impostors).
+// Far trees are camera facing impostors baked from LOD0 at eight yaw angles at startup.
+//
+// Requires GL 4.3 (compute shaders, SSBOs, multi-draw indirect).
+class ScatterSystem {
+public:
+    static constexpr int MaxLayers = 8;
+
+    struct Stats {
+        uint64_t slots = 0;
+        int cellsRebuilt = 0;                 // last Update() only
+        int cellsPending = 0;                 // deferred because the upload ring was full
+    };
+
+    static bool IsSupported();
+
+    ScatterSystem(const Heightfield &heightfield, const std::vector<ScatterLayerDesc> &layerDescs);
+    ~ScatterSystem();
+
+    ScatterSystem(const ScatterSystem &) = delete;
+    ScatterSystem &operator=(const ScatterSystem &) = delete;
+
+    void Update(const glm::vec3 &cameraPos, RingBuffer &upload);
+
+    // Expects the Camera uniform block to be bound at binding 0.
+    void Draw(const glm::mat4 &viewProj, const glm::vec3 &cameraPos);
+
+    const Stats &GetStats() const { return stats; }
+
+private:
+    struct Instance {
+        glm::vec4 posScale;                   // xyz position, w uniform scale (0 = empty slot)
+        glm::vec4 params;                     // x yaw, y tint, z layer
+    };
+
+    struct DrawCommand {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint firstIndex;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+
+    struct MeshRange {
+        GLuint indexCount;
+        GLuint firstIndex;
+        GLint baseVertex;
+    };
+
+    struct Layer {
+        ScatterLayerDesc desc;
+        GLuint firstSlot;
+        int slotsPerCell;
+        GLuint visibleBase;                   // three ranges of slotCount: lod0, lod1, impostor
+        GLuint slotCount;
+        std::vector<glm::ivec2> residentCells;
+        MeshRange lods[2];
+        glm::vec3 boundsMin, boundsMax;
+        bool impostors;
+    };
+
+    struct PendingCopy {
+        GLintptr src, dst;
+        GLsizeiptr size;
+    };
+
+    void BuildMeshes();
+    void BakeImpostors();
+    void PopulateCell(const Layer &layer, int layerIndex, glm::ivec2 cell, Instance *out) const;
+
+    const Heightfield &heightfield;
+    std::vector<Layer> layers;
+
+    GLuint cullProgram = 0, meshProgram = 0, impostorProgram = 0;
+    GLuint vao = 0, vbo = 0, ibo = 0;
+    GLuint instanceBuffer = 0, visibleBuffer = 0, commandBuffer = 0;
+    GLuint impostorAtlas = 0;
+    MeshRange impostorQuad{};
+
+    GLint frustumLocation = -1, cameraPosLocation = -1, slotCountLocation = -1;
+
+    std::vector<DrawCommand> commandTemplate;
+    std::vector<PendingCopy> copies;
+    GLuint totalSlots = 0;
+    Stats stats;
+};
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "BenchmarkTown.h"
+#include "../AI/AIScheduler.h"
+#include "../Core/JobSystem.h"
+#include "../Physics/SpatialHash.h"
+
+// 2000 AIs spread over the benchmark town with four players moving through it. Each think looks for enemies nearby,
+// checks sight lines to the closest ones and picks where to go; lower levels search a smaller radius and check fewer
+// lines, and Dormant agents only pick a new waypoint. Measures that think run for every agent on every tick, then the
+// same world under the scheduler's per-tick budget, with its overruns and how late agents got.
+// Usage: AIBenchmark [agents=2000] [ticks=600] [budgetMs=4]
+int main(int argc, char *argv[]) {
+    const size_t agentCount = argc > 1 ? std::stoul(argv[1]) : 2000;
+    const int ticks = argc > 2 ? std::stoi(argv[2]) : 600;
+    const double budgetMs = argc > 3 ? std::stod(argv[3]) : 4.0;
+
+    JobSystem jobs;
+    StaticGeometry geometry;
+    AddBenchmarkTown(geometry);
+    StaticBvh world(geometry);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    struct Agent {
+        glm::vec3 position, goal;
+        uint32_t team;
+        uint32_t seed;
+        uint32_t spotted = 0;
+    };
+
+    std::vector<Agent> agents(agentCount);
+    for (size_t i = 0; i < agentCount; i++) {
+        glm::vec3 p(range(-1000, 1000), 1.6f, range(-1000, 1000));
+        agents[i] = {p, p, static_cast<uint32_t>(i & 1), static_cast<uint32_t>(rng())};
+    }
+
+    std::vector<glm::vec3> players(4), playerVelocity(4);
+    auto resetPlayers = [&] {
+        for (size_t p = 0; p < players.size(); p++) {
+            players[p] = glm::vec3(range(-600, 600), 1.6f, range(-600, 600));
+            playerVelocity[p] = glm::normalize(glm::vec3(range(-1, 1), 0.0f, range(-1, 1))) * 5.0f;
+        }
+    };
+
+    SpatialHash hash;
+    std::vector<glm::vec3> positions(agentCount);
+    const float searchRadius[] = {80.0f, 40.0f, 20.0f, 0.0f};
+    const uint32_t sightChecks[] = {6, 2, 0, 0};
+
+    auto think = [&](uint32_t index, ThinkLevel level, float dt) {
+        Agent &agent = agents[index];
+        const size_t l = static_cast<size_t>(level);
+        agent.seed = agent.seed * 1664525u + 1013904223u;
+
+        if (searchRadius[l] > 0.0f) {
+            std::vector<uint32_t> nearby;
+            hash.QuerySphere(agent.position, searchRadius[l], nearby);
+
+            std::vector<std::pair<float, uint32_t>> enemies;
+            for (uint32_t other: nearby) {
+                if (agents[other].team == agent.team) continue;
+                glm::vec3 d = positions[other] - agent.position;
+                enemies.emplace_back(glm::dot(d, d), other);
+            }
+            const size_t checks = std::min<size_t>(sightChecks[l], enemies.size());
+            std::partial_sort(enemies.begin(), enemies.begin() + static_cast<std::ptrdiff_t>(checks), enemies.end());
+
+            for (size_t e = 0; e < checks; e++) {
+                RayHit hit;
+                if (!world.Raycast({agent.position, 1.0f, positions[enemies[e].second] - agent.position}, hit)) {
+                    agent.spotted++;
+                    agent.goal = positions[enemies[e].second];
+                    return;
+                }
+            }
+        }
+
+        // Nothing seen: wander further the longer the step
+        float stride = 10.0f + 5.0f * dt;
+        agent.goal = agent.position + glm::vec3(static_cast<float>(agent.seed % 200) * 0.01f - 1.0f, 0.0f,
+                                                static_cast<float>((agent.seed >> 8) % 200) * 0.01f - 1.0f) * stride;
+    };
+
+    // Movement and broadphase run every tick for everyone; only thinking is scheduled
+    const float dt = 1.0f / 60.0f;
+    auto simulate = [&] {
+        for (size_t p = 0; p < players.size(); p++) players[p] += playerVelocity[p] * dt;
+        for (size_t i = 0; i < agentCount; i++) {
+            glm::vec3 d = agents[i].goal - agents[i].position;
+            float length = glm::length(d);
+            if (length > 0.01f) agents[i].position += d * (std::min(length, 3.0f * dt) / length);
+            positions[i] = agents[i].position;
+        }
+        hash.Build(positions, {}, &jobs);
+    };
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    };
+
+    // Baseline: everyone at full detail every tick
+    resetPlayers();
+    double fullTotal = 0.0, fullWorst = 0.0;
+    const int fullTicks = std::min(ticks, 60);
+    for (int t = 0; t < fullTicks; t++) {
+        simulate();
+        auto start = std::chrono::steady_clock::now();
+        jobs.ParallelFor(agentCount, 64, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) think(static_cast<uint32_t>(i), ThinkLevel::Full, dt);
+        });
+        double ms = elapsedMs(start);
+        fullTotal += ms;
+        fullWorst = std::max(fullWorst, ms);
+    }
+
+    // Scheduled, with a fight flaring up around a player now and then
+    for (size_t i = 0; i < agentCount; i++) agents[i].goal = agents[i].position;
+    resetPlayers();
+
+    AISchedulerSettings settings;
+    settings.budgetMs = budgetMs;
+    AIScheduler scheduler(settings);
+    for (const Agent &agent: agents) scheduler.Add(agent.position);
+
+    double total = 0.0;
+    size_t deferredTotal = 0, worstDeferred = 0;
+    std::array<size_t, ThinkLevelCount> levelTotal = {}, thoughtTotal = {};
+    std::vector<uint32_t> nearby;
+
+    for (int t = 0; t < ticks; t++) {
+        simulate();
+        for (size_t i = 0; i < agentCount; i++) scheduler.SetPosition(static_cast<uint32_t>(i), agents[i].position);
+
+        if (t % 120 == 0) {
+            for (size_t i = 0; i < agentCount; i++) scheduler.SetInCombat(static_cast<uint32_t>(i), false);
+            nearby.clear();
+            hash.QuerySphere(players[static_cast<size_t>(t / 120) % players.size()], 120.0f, nearby);
+            for (uint32_t i: nearby) scheduler.SetInCombat(i, true);
+        }
+
+        scheduler.Update(players, dt, think, &jobs);
+        const AIScheduler::Stats &stats = scheduler.GetStats();
+        total += stats.lastUpdateMs;
+        deferredTotal += stats.deferred;
+        worstDeferred = std::max(worstDeferred, stats.deferred);
+        for (size_t l = 0; l < ThinkLevelCount; l++) {
+            levelTotal[l] += stats.agentsPerLevel[l];
+            thoughtTotal[l] += stats.thoughtPerLevel[l];
+        }
+    }
+
+    const AIScheduler::Stats &stats = scheduler.GetStats();
+    const char *names[] = {"full", "reduced", "low", "dormant"};
+    const double perTick = 1.0 / ticks;
+
+    std::cout << agentCount << " agents, " << jobs.WorkerCount() + 1 << " threads\n"
+              << "  every agent full every tick: " << fullTotal / fullTicks << " ms avg, " << fullWorst << " ms worst\n"
+              << "  scheduled, " << budgetMs << " ms budget over " << ticks << " ticks: " << total * perTick << " ms avg, "
+              << stats.worstUpdateMs << " ms worst, " << stats.overruns << " overruns (worst by " << stats.worstOverrunMs
+              << " ms), slowest think " << stats.worstThinkMs << " ms\n";
+    for (size_t l = 0; l < ThinkLevelCount; l++) {
+        std::cout << "    " << names[l] << ": " << static_cast<double>(levelTotal[l]) * perTick << " agents, "
+                  << static_cast<double>(thoughtTotal[l]) * perTick << " thinks/tick\n";
+    }
+    std::cout << "  deferred " << static_cast<double>(deferredTotal) * perTick << "/tick avg, " << worstDeferred
+              << " worst, longest wait past interval " << stats.worstLateTicks << " ticks\n";
+    return 0;
+}
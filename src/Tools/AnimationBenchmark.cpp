@@ -0,0 +1,72 @@
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "../Animation/AnimationClip.h"
+#include "../Animation/CrowdAnimator.h"
+#include "../Animation/Skeleton.h"
+#include "../Asset/MeshFormat.h"
+#include "../Core/JobSystem.h"
+
+// CPU cost of sampling, blending and palette generation for a crowd, single threaded and on the job system.
+// Usage: AnimationBenchmark <skinned.mmesh> [characters=500] [frames=600]
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: AnimationBenchmark <skinned.mmesh> [characters] [frames]\n";
+        return 1;
+    }
+
+    const int characters = argc > 2 ? std::stoi(argv[2]) : 500;
+    const int frames = argc > 3 ? std::stoi(argv[3]) : 600;
+
+    try {
+        MeshFile file(argv[1]);
+        Skeleton skeleton(file, 0);
+        std::vector<AnimationClip> clips = LoadAnimationClips(file);
+        CrowdAnimator crowd(skeleton, clips);
+
+        size_t clipBytes = 0, clipKeys = 0;
+        for (const AnimationClip &clip: clips) {
+            clipBytes += clip.SizeBytes();
+            clipKeys += clip.KeyCount();
+        }
+
+        for (int i = 0; i < characters; i++) {
+            AnimatedInstance instance;
+            instance.world = glm::translate(glm::mat4(1.0f), glm::vec3(i % 25, 0.0f, i / 25) * 2.0f);
+            instance.clipA = static_cast<uint32_t>(i % clips.size());
+            instance.clipB = static_cast<uint32_t>((i + 1) % clips.size());
+            instance.timeA = static_cast<float>(i) * 0.137f;
+            instance.timeB = static_cast<float>(i) * 0.071f;
+            instance.blend = (i % 3) * 0.4f;  // a third of the crowd unblended, the rest cross-fading
+            crowd.Add(instance);
+        }
+
+        auto run = [&](JobSystem *jobs) {
+            double total = 0.0;
+            for (int f = 0; f < frames; f++) {
+                crowd.Update(1.0f / 60.0f, jobs);
+                total += crowd.Stats().updateMs;
+            }
+            return total / frames;
+        };
+
+        JobSystem jobs;
+        double serial = run(nullptr);
+        double parallel = run(&jobs);
+        double scale = 500.0 / characters;
+
+        std::cout << skeleton.JointCount() << " joints, " << clips.size() << " clips, " << clipKeys << " keys, "
+                  << clipBytes << " bytes of clip data\n"
+                  << characters << " characters, " << frames << " frames\n"
+                  << "serial:   " << serial << " ms/frame, " << serial * scale << " ms per 500 characters\n"
+                  << "parallel: " << parallel << " ms/frame, " << parallel * scale << " ms per 500 characters ("
+                  << jobs.WorkerCount() + 1 << " threads)\n";
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../Asset/PackBuilder.h"
+#include "../Asset/Vfs.h"
+#include "../Core/AsyncIo.h"
+#include "../Core/JobSystem.h"
+
+namespace {
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    double Ms(Clock::time_point since) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+    }
+
+    void Evict(const fs::path &path) {
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+#endif
+    }
+
+    // Stand-in for decoding: touches every cache line
+    uint64_t Decode(const FileData &data) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < data.Size(); i += 64) sum += data.Data()[i];
+        return sum;
+    }
+
+    struct Result {
+        double totalMs = 0.0;
+        double worstCallMs = 0.0;             // longest the loading thread was held by one batch
+        uint64_t checksum = 0;
+        size_t failed = 0;
+    };
+}
+
+// Loading a batch of assets the way world streaming does: the loading thread asks for files a batch per frame and
+// keeps going. Blocking reads through Vfs::Read are compared against AsyncIo on io_uring and on its pread pool, each
+// completion decoding on the job system, from loose files and from an LZ4 pack, with the page cache dropped first.
+// Reports total time, throughput and the longest the loading thread spent on one batch.
+// Usage: AsyncIoBenchmark [files=2000] [batch=64] [workDir=asyncio_benchmark]
+int main(int argc, char *argv[]) {
+    const int fileCount = argc > 1 ? std::stoi(argv[1]) : 2000;
+    const size_t batch = argc > 2 ? std::stoul(argv[2]) : 64;
+    const fs::path work = argc > 3 ? argv[3] : "asyncio_benchmark";
+
+    const fs::path root = work / "loose";
+    fs::remove_all(root);
+
+    std::mt19937 rng(5);
+    std::vector<std::string> names;
+    std::vector<uint8_t> bytes;
+    uint64_t totalBytes = 0;
+    for (int i = 0; i < fileCount; i++) {
+        bytes.resize(16384 + rng() % 262144);
+        // Half noise, half runs, so the pack compresses some files and stores the rest
+        for (size_t k = 0; k < bytes.size(); k++) bytes[k] = static_cast<uint8_t>(i % 2 ? rng() : k / 97);
+
+        names.push_back("cells/" + std::to_string(i / 64) + "/" + std::to_string(i) + ".bin");
+        fs::create_directories((root / names.back()).parent_path());
+        std::ofstream(root / names.back(), std::ios::binary).write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        totalBytes += bytes.size();
+    }
+
+    const std::string pack = (work / "cells.mpak").string();
+    PackBuildStats packStats = BuildPackFile(root.string(), pack);
+    std::cout << fileCount << " files, " << totalBytes / (1024.0 * 1024.0) << " MiB (pack " << packStats.packBytes / (1024.0 * 1024.0)
+              << " MiB, " << packStats.compressed << " LZ4), batches of " << batch << "\n";
+
+    JobSystem jobs;
+
+    auto evictAll = [&]() {
+        for (const std::string &name: names) Evict(root / name);
+        Evict(pack);
+    };
+
+    auto blocking = [&](const Vfs &vfs) {
+        evictAll();
+        Result result;
+        auto start = Clock::now();
+        for (size_t first = 0; first < names.size(); first += batch) {
+            auto call = Clock::now();
+            for (size_t i = first; i < std::min(names.size(), first + batch); i++) result.checksum += Decode(vfs.Read(names[i]));
+            result.worstCallMs = std::max(result.worstCallMs, Ms(call));
+        }
+        result.totalMs = Ms(start);
+        return result;
+    };
+
+    auto async = [&](const Vfs &vfs, bool allowIoUring) {
+        AsyncIoSettings settings;
+        settings.allowIoUring = allowIoUring;
+        AsyncIo io(&jobs, settings);
+
+        evictAll();
+        Result result;
+        std::atomic<uint64_t> checksum{0};
+        std::atomic<size_t> failed{0};
+
+        auto start = Clock::now();
+        for (size_t first = 0; first < names.size(); first += batch) {
+            auto call = Clock::now();
+            for (size_t i = first; i < std::min(names.size(), first + batch); i++) {
+                vfs.QueueRead(io, names[i], [&](FileData &data, const std::string &error) {
+                    if (!error.empty()) failed++;
+                    checksum += Decode(data);
+                });
+            }
+            io.Submit();
+            result.worstCallMs = std::max(result.worstCallMs, Ms(call));
+        }
+        io.WaitIdle();
+        result.totalMs = Ms(start);
+        result.checksum = checksum;
+        result.failed = failed;
+        return std::make_pair(result, io.Backend());
+    };
+
+    Vfs loose;
+    loose.AddLooseRoot(root.string());
+    Vfs packed;
+    packed.Mount(pack);
+
+    const Result reference = blocking(loose);
+    auto report = [&](const char *label, const Result &result) {
+        std::cout << label << ": " << result.totalMs << " ms (" << totalBytes / (1024.0 * 1024.0) / (result.totalMs / 1000.0)
+                  << " MiB/s, " << names.size() / (result.totalMs / 1000.0) << " files/s), worst batch " << result.worstCallMs << " ms"
+                  << (result.failed ? ", " + std::to_string(result.failed) + " FAILED" : "")
+                  << (result.checksum == reference.checksum ? "" : ", CHECKSUM MISMATCH") << '\n';
+    };
+
+    report("loose blocking      ", reference);
+    auto [looseRing, looseBackend] = async(loose, true);
+    report(looseBackend == AsyncIoBackend::IoUring ? "loose io_uring      " : "loose pool (no ring)", looseRing);
+    report("loose pread pool    ", async(loose, false).first);
+
+    report("pack blocking       ", blocking(packed));
+    auto [packRing, packBackend] = async(packed, true);
+    report(packBackend == AsyncIoBackend::IoUring ? "pack io_uring       " : "pack pool (no ring) ", packRing);
+    report("pack pread pool     ", async(packed, false).first);
+
+    return 0;
+}
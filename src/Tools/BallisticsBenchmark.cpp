@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkTown.h"
+#include "../Core/JobSystem.h"
+#include "../Physics/Ballistics.h"
+#include "../Physics/ProjectileSystem.h"
+
+// Ballistics accuracy and throughput.
+//
+// Accuracy: the reference solver is checked against a manufacturer's published remaining velocities (below), the 60 Hz
+// game integrator is flown against the reference solver for a few service loads, and, given published drop tables, the
+// reference solver is checked against those too. Table format (CSV): a header line "model,bc,muzzleVelocity,sightHeight,zeroRange"
+// (G1/G7, lb/in^2, m/s, m, m), then "range,drop" rows in metres with drop below the line of sight. Any value outside
+// the tolerance fails the run with exit code 1 before the throughput part.
+//
+// Throughput: 20000 concurrent rounds in the benchmark town, integrated and swept per 60 Hz tick.
+// Usage: BallisticsBenchmark [table.csv ...]
+
+namespace {
+    constexpr float TickRate = 60.0f;
+
+    struct Load {
+        const char *name;
+        DragModel model;
+        float bc;
+        float muzzleVelocity;
+    };
+
+    const Load Loads[] = {
+        {"5.56 M855 (G7 0.151, 930 m/s)", DragModel::G7, 0.151f, 930.0f},
+        {"7.62 M80 (G1 0.393, 838 m/s)", DragModel::G1, 0.393f, 838.0f},
+        {".308 175gr SMK (G7 0.243, 792 m/s)", DragModel::G7, 0.243f, 792.0f},
+        {".338 LM 250gr (G7 0.322, 900 m/s)", DragModel::G7, 0.322f, 900.0f},
+    };
+
+    // Federal Premium's published ballistics for Gold Medal Match .308 Win 168 gr Sierra MatchKing BTHP (GM308M):
+    // G1 0.462 from 2650 ft/s, remaining velocity every 100 yd in a standard sea-level atmosphere, rounded to 1 ft/s.
+    // Printed in yards and ft/s, as published.
+    const Load FederalGM308M = {".308 Federal GM308M 168gr SMK (G1 0.462, 808 m/s)", DragModel::G1, 0.462f, 2650.0f * 0.3048f};
+
+    struct PublishedRow {
+        float yards;
+        float feetPerSecond;
+    };
+
+    const PublishedRow FederalGM308MRows[] = {
+        {100.0f, 2460.0f}, {200.0f, 2274.0f}, {300.0f, 2098.0f}, {400.0f, 1931.0f}, {500.0f, 1774.0f},
+    };
+
+    // 1 cm or 1% of the drop, 1 ms or 0.5% of the time of flight, whichever is larger
+    bool DropWithin(float computed, float expected) {
+        return std::abs(computed - expected) <= std::max(0.01f, 0.01f * std::abs(expected));
+    }
+
+    bool TimeWithin(float computed, float expected) {
+        return std::abs(computed - expected) <= std::max(0.001f, 0.005f * expected);
+    }
+
+    // 1% of the remaining velocity: the catalogue's own rounding and atmosphere are well inside it, a wrong drag
+    // table or unit slip is not
+    bool VelocityWithin(float computed, float expected) {
+        return std::abs(computed - expected) <= 0.01f * expected;
+    }
+
+    bool CheckPublished(const Load &load, std::span<const PublishedRow> rows) {
+        constexpr float Yard = 0.9144f, Foot = 0.3048f;
+
+        TrajectoryParams params;
+        params.model = load.model;
+        params.ballisticCoefficient = load.bc;
+        params.muzzleVelocity = load.muzzleVelocity;
+
+        bool ok = true;
+        float worst = 0.0f;
+        for (const PublishedRow &row: rows) {
+            const float range = row.yards * Yard, expected = row.feetPerSecond * Foot;
+            std::vector<TrajectorySample> samples = SolveTrajectory(params, range, range);
+            if (samples.size() < 2 || std::abs(samples.back().range - range) > 0.5f) {
+                std::cout << "    FAIL: no sample at " << row.yards << " yd\n";
+                ok = false;
+                continue;
+            }
+
+            const float computed = samples.back().velocity;
+            worst = std::max(worst, std::abs(computed - expected) / expected);
+            if (!VelocityWithin(computed, expected)) {
+                std::cout << "    FAIL at " << row.yards << " yd: " << computed / Foot << " ft/s (published " << row.feetPerSecond << ")\n";
+                ok = false;
+            }
+        }
+
+        std::cout << std::fixed << std::setprecision(0) << "  " << load.name << ", " << rows.front().yards << "-" << rows.back().yards
+                  << " yd: worst " << std::setprecision(2) << worst * 100.0f << "% of remaining velocity" << (ok ? "" : " FAIL") << '\n';
+        return ok;
+    }
+
+    // Flies one round with the game integrator and compares drop and time against the reference every 100 m
+    bool CheckIntegrator(const Load &load, const StaticBvh &emptyWorld) {
+        TrajectoryParams params;
+        params.model = load.model;
+        params.ballisticCoefficient = load.bc;
+        params.muzzleVelocity = load.muzzleVelocity;
+
+        const float maxRange = 1000.0f;
+        std::vector<TrajectorySample> reference = SolveTrajectory(params, maxRange, 100.0f);
+
+        ProjectileSystem system(emptyWorld);
+        ProjectileDesc desc;
+        desc.velocity = glm::vec3(0.0f, 0.0f, load.muzzleVelocity);
+        desc.dragModel = load.model;
+        desc.ballisticCoefficient = load.bc;
+        system.Spawn(desc);
+
+        bool ok = true;
+        float worstDrop = 0.0f, worstTime = 0.0f;
+        size_t next = 1;
+        float time = 0.0f;
+        glm::vec3 previous(0.0f);
+
+        while (next < reference.size() && system.ActiveCount() > 0) {
+            system.Step(1.0f / TickRate);
+            time += 1.0f / TickRate;
+            glm::vec3 p = system.Position(0);
+
+            while (next < reference.size() && p.z >= reference[next].range) {
+                float f = (reference[next].range - previous.z) / (p.z - previous.z);
+                float drop = -(previous.y + (p.y - previous.y) * f);
+                float t = time - (1.0f - f) / TickRate;
+
+                worstDrop = std::max(worstDrop, std::abs(drop - reference[next].drop));
+                worstTime = std::max(worstTime, std::abs(t - reference[next].time));
+                ok = ok && DropWithin(drop, reference[next].drop) && TimeWithin(t, reference[next].time);
+                next++;
+            }
+
+            previous = p;
+        }
+
+        // A round that stopped short of the last sample never got compared there
+        ok = ok && next == reference.size();
+
+        const TrajectorySample &last = reference.back();
+        std::cout << std::fixed << std::setprecision(3) << "  " << load.name << ": at " << last.range << " m drop "
+                  << last.drop << " m, " << last.time << " s, " << last.velocity << " m/s"
+                  << (last.velocity > 340.29f ? " (supersonic)" : " (subsonic)") << "; 60 Hz error <= "
+                  << worstDrop * 100.0f << " cm, " << worstTime * 1000.0f << " ms" << (ok ? "" : " FAIL") << '\n';
+        return ok;
+    }
+
+    bool CheckTable(const std::string &path) {
+        std::ifstream file(path);
+        std::string line;
+
+        if (!file || !std::getline(file, line)) {
+            std::cerr << "Failed to Read Drop Table: " << path << '\n';
+            return false;
+        }
+
+        std::stringstream header(line);
+        std::string model, field;
+        float values[4];
+        std::getline(header, model, ',');
+        try {
+            for (float &value: values) {
+                std::getline(header, field, ',');
+                value = std::stof(field);
+            }
+        } catch (const std::exception &) {
+            std::cerr << "Invalid Drop Table Header: " << path << '\n';
+            return false;
+        }
+
+        TrajectoryParams params;
+        params.model = model == "G1" ? DragModel::G1 : DragModel::G7;
+        params.ballisticCoefficient = values[0];
+        params.muzzleVelocity = values[1];
+        const float sightHeight = values[2];
+        params.elevation = ZeroElevation(params, sightHeight, values[3]);
+
+        std::cout << "  " << path << " (" << model << " " << params.ballisticCoefficient << ", "
+                  << params.muzzleVelocity << " m/s, zero " << values[3] << " m):\n";
+
+        bool ok = true;
+        float worst = 0.0f;
+        while (std::getline(file, line)) {
+            float range, drop;
+            if (std::sscanf(line.c_str(), "%f,%f", &range, &drop) != 2) continue;
+
+            std::vector<TrajectorySample> samples = SolveTrajectory(params, range, range);
+            if (samples.size() < 2) continue;
+
+            // Below the line of sight = sight height + drop from the bore line - rise of the bore line
+            float computed = sightHeight + samples.back().drop - range * std::tan(params.elevation);
+            worst = std::max(worst, std::abs(computed - drop));
+            const bool within = DropWithin(computed, drop);
+            ok = ok && within;
+            std::cout << "    " << range << " m: table " << drop << " m, computed " << computed << " m" << (within ? "" : " FAIL") << '\n';
+        }
+
+        std::cout << "    worst deviation " << worst * 100.0f << " cm\n";
+        return ok;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    StaticGeometry none;
+    StaticBvh emptyWorld(none);
+
+    bool accurate = true;
+    std::cout << "Reference vs published velocities (sea level, no wind):\n";
+    accurate = CheckPublished(FederalGM308M, FederalGM308MRows) && accurate;
+
+    std::cout << "Integrator vs reference (sea level ICAO, no wind):\n";
+    for (const Load &load: Loads) {
+        accurate = CheckIntegrator(load, emptyWorld) && accurate;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        accurate = CheckTable(argv[i]) && accurate;
+    }
+
+    if (!accurate) {
+        std::cerr << "Accuracy check failed\n";
+        return 1;
+    }
+
+    StaticGeometry geometry;
+    AddBenchmarkTown(geometry);
+    StaticBvh town(geometry);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto spawn = [&](ProjectileSystem &system) {
+        float yaw = unit(rng) * 6.2831853f, pitch = (unit(rng) - 0.3f) * 0.05f;
+        ProjectileDesc desc;
+        desc.position = glm::vec3(unit(rng) * 2000.0f - 1000.0f, 1.5f, unit(rng) * 2000.0f - 1000.0f);
+        desc.velocity = glm::vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)) * 900.0f;
+        desc.dragModel = unit(rng) < 0.5f ? DragModel::G1 : DragModel::G7;
+        system.Spawn(desc);
+    };
+
+    auto run = [&](JobSystem *jobs) {
+        const size_t rounds = 20000;
+        const int ticks = 300;
+        ProjectileSystem system(town);
+        double integrate = 0.0, sweep = 0.0;
+        size_t impacts = 0;
+
+        for (size_t i = 0; i < rounds; i++) spawn(system);
+
+        for (int tick = 0; tick < ticks; tick++) {
+            system.Step(1.0f / TickRate, jobs);
+            integrate += system.GetStats().integrateMs;
+            sweep += system.GetStats().sweepMs;
+            impacts += system.GetStats().impacts;
+
+            // Keep the population constant
+            while (system.ActiveCount() < rounds) spawn(system);
+        }
+
+        std::cout << std::setprecision(3) << "  " << (jobs ? "parallel" : "serial  ") << ": " << (integrate + sweep) / ticks
+                  << " ms/tick (integrate " << integrate / ticks << ", sweep " << sweep / ticks << "), "
+                  << static_cast<double>(rounds) * ticks / ((integrate + sweep) / 1000.0) / 1e6 << " M round-ticks/s, "
+                  << impacts << " impacts\n";
+    };
+
+    std::cout << "Throughput, 20000 rounds in flight at " << TickRate << " Hz:\n";
+    JobSystem jobs;
+    run(nullptr);
+    run(&jobs);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <vector>
+
+#include "../Geometry/MeshSimplifier.h"
+#include "../Geometry/Primitives.h"
+#include "../Physics/StaticBvh.h"
+
+// Synthetic 2 km town shared by the physics benchmarks: 2000 rocks at a coarse LOD and 3000 rotated building boxes
+inline void AddBenchmarkTown(StaticGeometry &geometry, uint32_t seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    TexturedMesh rock = GenerateRock(5, 3);
+    std::vector<glm::vec3> rockPositions;
+    for (const TexturedVertex &v: rock.vertices) {
+        rockPositions.push_back(v.pos);
+    }
+    LodChain chain = BuildLodChain({rockPositions.data(), rockPositions.size()}, rock.indices, 4, 0.25f);
+    const LodLevel &collisionLevel = chain.levels.back();
+    std::span<const uint32_t> rockIndices(chain.indices.data() + collisionLevel.firstIndex, collisionLevel.indexCount);
+
+    for (int i = 0; i < 2000; i++) {
+        glm::mat4 m = glm::translate(glm::mat4(1.0f), glm::vec3(range(-1000, 1000), 0.0f, range(-1000, 1000)));
+        geometry.AddMesh(rockPositions, rockIndices, glm::scale(m, glm::vec3(range(0.5f, 4.0f))), 1);
+    }
+
+    for (int i = 0; i < 3000; i++) {
+        glm::vec3 size(range(4, 20), range(3, 12), range(4, 20));
+        glm::mat4 m = glm::translate(glm::mat4(1.0f), glm::vec3(range(-1000, 1000), size.y * 0.5f, range(-1000, 1000)));
+        m = glm::rotate(m, range(0.0f, 6.28f), glm::vec3(0.0f, 1.0f, 0.0f));
+        geometry.AddBox(glm::scale(m, size), 0);
+    }
+}
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Asset/ImageDecoder.h"
+#include "../Asset/PackBuilder.h"
+#include "../Asset/Vfs.h"
+#include "../Core/AsyncIo.h"
+#include "../Core/JobSystem.h"
+
+namespace {
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    double Ms(Clock::time_point since) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+    }
+
+    // Copies of one sample texture
+    struct ImageSet {
+        fs::path source;
+        std::vector<std::string> paths;
+        std::vector<FileData> files;
+        uint64_t encodedBytes = 0;
+    };
+
+    void Report(const std::string &label, size_t images, uint64_t encodedBytes, uint64_t decodedBytes, double ms) {
+        const double seconds = ms / 1000.0, mib = 1024.0 * 1024.0;
+        std::cout << "  " << label << ": " << images / seconds << " images/s, " << encodedBytes / mib / seconds << " MiB/s encoded, "
+                  << decodedBytes / mib / seconds << " MiB/s decoded (" << ms << " ms)\n";
+    }
+}
+
+// Texture decode throughput over the checked-in sample textures, relative to the working directory. By default these
+// are textures/wall.jpg (a 4000x2600 photo), wall_2k.jpg and wall_4k.jpg (its centre square at 2048 and 4096 pixels),
+// and textures/noise.png, noise_2k.png and noise_4k.png (value noise at 1024, 2048 and 4096 pixels). perSet copies
+// of each are packed into one .mpak and decoded with stb_image from the VFS's buffers one at a time on one thread, then as one DecodeImages() batch
+// across the job system, then with reads and decodes overlapped through QueueImageDecodes(). Reports images/s and MiB/s
+// of encoded input and decoded pixels for each, and checks every batch decode against the one-thread decode.
+// Usage: ImageDecodeBenchmark [perSet=4] [workers=0 (one per hardware thread)] [workDir=image_decode_benchmark] [image ...]
+int main(int argc, char *argv[]) {
+    const int perSet = argc > 1 ? std::stoi(argv[1]) : 4;
+    const int workerArg = argc > 2 ? std::stoi(argv[2]) : 0;
+    const unsigned workers = workerArg > 0 ? static_cast<unsigned>(workerArg) : JobSystem::DefaultWorkerCount();
+    const fs::path work = argc > 3 ? argv[3] : "image_decode_benchmark";
+
+    std::vector<fs::path> sources(argv + std::min(argc, 4), argv + argc);
+    if (sources.empty()) {
+        sources = {"textures/wall.jpg", "textures/wall_2k.jpg", "textures/wall_4k.jpg",
+                   "textures/noise.png", "textures/noise_2k.png", "textures/noise_4k.png"};
+    }
+
+    std::vector<ImageSet> sets(sources.size());
+    for (size_t s = 0; s < sources.size(); s++) sets[s].source = sources[s];
+
+    JobSystem jobs(workers);
+
+    try {
+        const fs::path loose = work / "loose";
+        fs::remove_all(loose);
+        fs::create_directories(loose / "textures");
+
+        for (size_t s = 0; s < sets.size(); s++) {
+            ImageSet &set = sets[s];
+            for (int i = 0; i < perSet; i++) {
+                const std::string path = "textures/" + std::to_string(s) + "_" + std::to_string(i) + set.source.extension().string();
+                fs::copy_file(set.source, loose / path);
+                set.paths.push_back(path);
+                set.encodedBytes += fs::file_size(set.source);
+            }
+        }
+        const std::string pack = (work / "textures.mpak").string();
+        BuildPackFile(loose.string(), pack);
+        fs::remove_all(loose);
+        std::cout << "packed " << sets.size() * perSet << " textures; " << workers << " workers\n";
+
+        Vfs vfs;
+        vfs.Mount(pack);
+
+        // Buffers as the I/O layer hands them over, paged in so the decode timings below are decode only
+        std::vector<FileData> allFiles;
+        std::vector<std::string> allPaths;
+        uint64_t allEncoded = 0, touched = 0;
+        for (ImageSet &set: sets) {
+            for (const std::string &path: set.paths) {
+                FileData file = vfs.Read(path);
+                for (size_t i = 0; i < file.Size(); i += 4096) touched += file.Data()[i];
+                set.files.push_back(file);
+                allFiles.push_back(file);
+                allPaths.push_back(path);
+            }
+            allEncoded += set.encodedBytes;
+        }
+        std::cout << "paged in " << allEncoded / (1024.0 * 1024.0) << " MiB through the VFS (page sum " << touched << ")\n";
+
+        uint64_t allDecoded = 0;
+        double serialMs = 0.0, batchMs = 0.0;
+        for (ImageSet &set: sets) {
+            uint64_t decodedBytes = 0;
+            DecodedImage reference;
+            auto start = Clock::now();
+            for (const FileData &file: set.files) {
+                DecodedImage image = DecodedImage::Decode(file);
+                decodedBytes += image.Size();
+                if (!reference) reference = std::move(image);
+            }
+            const double ms = Ms(start);
+            serialMs += ms;
+            allDecoded += decodedBytes;
+
+            std::cout << set.source.string() << ": " << set.files.size() << " x " << set.encodedBytes / set.files.size() / 1024 << " KiB, "
+                      << reference.Width() << "x" << reference.Height() << "x" << reference.Channels() << "\n";
+            Report("one thread", set.files.size(), set.encodedBytes, decodedBytes, ms);
+
+            start = Clock::now();
+            std::vector<ImageDecodeResult> results = DecodeImages(set.files, &jobs);
+            const double parallelMs = Ms(start);
+            batchMs += parallelMs;
+            Report("batch     ", set.files.size(), set.encodedBytes, decodedBytes, parallelMs);
+
+            // Every copy decoded on the job system must match the one-thread decode
+            for (const ImageDecodeResult &result: results) {
+                if (!result.error.empty()) {
+                    std::cerr << result.error << '\n';
+                    return 1;
+                }
+                if (result.image.Size() != reference.Size() || !std::equal(reference.Pixels(), reference.Pixels() + reference.Size(), result.image.Pixels())) {
+                    std::cerr << "Batch Decode Mismatch: " << set.source.string() << '\n';
+                    return 1;
+                }
+            }
+        }
+
+        std::cout << "all " << allFiles.size() << " textures:\n";
+        Report("one thread", allFiles.size(), allEncoded, allDecoded, serialMs);
+        auto start = Clock::now();
+        std::vector<ImageDecodeResult> all = DecodeImages(allFiles, &jobs);
+        const double allBatchMs = Ms(start);
+        all.clear();
+        Report("batch     ", allFiles.size(), allEncoded, allDecoded, allBatchMs);
+
+        // Reads and decodes overlapped; images are dropped as they land so memory stays at a few in flight
+        AsyncIo io(&jobs);
+        std::atomic<size_t> failed{0};
+        start = Clock::now();
+        QueueImageDecodes(io, vfs, allPaths, 0, [&failed](size_t, DecodedImage &, const std::string &error) {
+            if (!error.empty()) failed++;
+        });
+        io.Submit();
+        io.WaitIdle();
+        const double overlappedMs = Ms(start);
+        Report("overlapped", allFiles.size(), allEncoded, allDecoded, overlappedMs);
+        std::cout << "batch speedup over one thread: " << serialMs / allBatchMs << "x (per-set batches " << serialMs / batchMs << "x)\n";
+
+        if (failed) {
+            std::cerr << failed.load() << " overlapped decodes failed\n";
+            return 1;
+        }
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
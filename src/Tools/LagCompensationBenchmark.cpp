@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Physics/HitboxHistory.h"
+
+// Lag-compensated hit queries: players running and turning over a 60 m square (100 players), a second of hitbox history recorded
+// at 60 Hz, then shots from 20-150 m aimed at where a random target was up to a second ago (as a lagging shooter
+// saw it). Reports memory per player, recording cost per tick and query cost, and checks the shots land on the
+// target when rewound but mostly miss when tested against the present, which is what lag compensation is for.
+// Usage: LagCompensationBenchmark [players=100] [queries=200000]
+int main(int argc, char *argv[]) {
+    const uint32_t playerCount = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 100;
+    const size_t queryCount = argc > 2 ? std::stoul(argv[2]) : 200000;
+    constexpr size_t HistoryTicks = 60;
+    constexpr int Ticks = 600;
+    constexpr float Dt = 1.0f / 60.0f;
+
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    struct Runner {
+        glm::vec3 feet;
+        float yaw;
+        float speed;
+        Stance stance;
+        int turnIn = 0;
+    };
+    // 100 players share a 60 m square; more get proportionally more room
+    const float half = 3.0f * std::sqrt(static_cast<float>(playerCount));
+    std::vector<Runner> runners(playerCount);
+    for (uint32_t i = 0; i < playerCount; i++) {
+        const Stance stance = i % 10 == 0 ? Stance::Prone : i % 5 == 0 ? Stance::Crouching : Stance::Standing;
+        runners[i] = {glm::vec3(range(-half, half), 0.0f, range(-half, half)), range(0, 360), stance == Stance::Standing ? 5.0f : 1.4f, stance};
+    }
+
+    // The benchmark's own copy of every pose, to aim with
+    std::vector<std::vector<glm::vec3>> feetAt(playerCount, std::vector<glm::vec3>(Ticks + 1));
+    std::vector<std::vector<float>> yawAt(playerCount, std::vector<float>(Ticks + 1));
+
+    HitboxHistory history(HistoryTicks);
+    double recordMs = 0.0;
+    for (int tick = 1; tick <= Ticks; tick++) {
+        for (Runner &r: runners) {
+            if (--r.turnIn <= 0) {
+                r.yaw = std::fmod(r.yaw + range(-120, 120) + 360.0f, 360.0f);
+                r.turnIn = 20 + static_cast<int>(rng() % 60);
+            }
+            const float yaw = glm::radians(r.yaw);
+            r.feet += glm::vec3(std::cos(yaw), 0.0f, std::sin(yaw)) * r.speed * Dt;
+            r.feet = glm::clamp(r.feet, glm::vec3(-half, 0.0f, -half), glm::vec3(half, 0.0f, half));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        history.BeginTick(static_cast<uint64_t>(tick));
+        for (uint32_t i = 0; i < playerCount; i++) history.Record(i, runners[i].feet, runners[i].yaw, runners[i].stance);
+        recordMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        for (uint32_t i = 0; i < playerCount; i++) {
+            feetAt[i][tick] = runners[i].feet;
+            yawAt[i][tick] = runners[i].yaw;
+        }
+    }
+
+    // Shots at the torso centre of a target as it was rewind ticks ago
+    const CharacterSettings body;
+    size_t rewoundHits = 0, rewoundOther = 0, presentHits = 0, candidates = 0;
+    double rewoundMs = 0.0, presentMs = 0.0;
+    const size_t candidatesBefore = history.GetStats().candidates;
+    for (size_t q = 0; q < queryCount; q++) {
+        const uint32_t target = static_cast<uint32_t>(rng() % playerCount);
+        const double time = static_cast<double>(Ticks) - static_cast<double>(range(0.0f, static_cast<float>(HistoryTicks - 1)));
+        const int before = static_cast<int>(time);
+        const float alpha = static_cast<float>(time - before);
+
+        const glm::vec3 feet = glm::mix(feetAt[target][before], feetAt[target][before + 1], alpha);
+        float turn = yawAt[target][before + 1] - yawAt[target][before];
+        turn -= 360.0f * std::round(turn / 360.0f);
+        const float yaw = glm::radians(yawAt[target][before] + turn * alpha);
+
+        glm::vec3 aim;
+        const Stance stance = runners[target].stance;
+        if (stance == Stance::Prone) {
+            aim = feet + glm::vec3(std::cos(yaw), 0.0f, std::sin(yaw)) * 0.2f + glm::vec3(0.0f, 0.18f, 0.0f);
+        } else {
+            const float height = stance == Stance::Crouching ? body.crouchingHeight : body.standingHeight;
+            aim = feet + glm::vec3(0.0f, (0.52f * height + height - 0.32f) * 0.5f, 0.0f);
+        }
+
+        const float bearing = range(0.0f, 6.2831853f), distance = range(20.0f, 150.0f);
+        Ray ray;
+        ray.origin = aim + glm::vec3(std::cos(bearing) * distance, range(0.0f, 3.0f), std::sin(bearing) * distance);
+        ray.direction = glm::normalize(aim - ray.origin);
+        ray.tMax = 200.0f;
+
+        HitboxHit hit;
+        auto start = std::chrono::steady_clock::now();
+        const bool rewound = history.Raycast(ray, time, InvalidEntity, hit);
+        auto middle = std::chrono::steady_clock::now();
+        rewoundHits += rewound && hit.entity == target;
+        rewoundOther += rewound && hit.entity != target;
+
+        const bool present = history.Raycast(ray, static_cast<double>(Ticks), InvalidEntity, hit);
+        auto end = std::chrono::steady_clock::now();
+        presentHits += present && hit.entity == target;
+
+        rewoundMs += std::chrono::duration<double, std::milli>(middle - start).count();
+        presentMs += std::chrono::duration<double, std::milli>(end - middle).count();
+    }
+    candidates = history.GetStats().candidates - candidatesBefore;
+
+    const double perQuery = 1.0 / static_cast<double>(queryCount);
+    std::cout << playerCount << " players, " << HistoryTicks << " ticks of history (" << HistoryTicks / 60.0 << " s)\n"
+              << "  memory: " << history.MemoryBytes() << " bytes, " << history.MemoryBytes() / playerCount << " per player, "
+              << history.MemoryBytes() / (playerCount * HistoryTicks) << " per player per tick\n"
+              << "  recording: " << recordMs / Ticks * 1000.0 << " us per tick\n"
+              << "  rewound query: " << rewoundMs * perQuery * 1e6 << " ns avg, " << static_cast<double>(candidates) * perQuery
+              << " players past the bounding sphere test (both queries)\n"
+              << "  present query: " << presentMs * perQuery * 1e6 << " ns avg\n"
+              << "  shots at where the target was: " << 100.0 * static_cast<double>(rewoundHits) * perQuery << "% hit it rewound ("
+              << 100.0 * static_cast<double>(rewoundOther) * perQuery << "% hit someone in front), "
+              << 100.0 * static_cast<double>(presentHits) * perQuery << "% against the present\n";
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <iostream>
+#include <string>
+
+#include "../Asset/Gltf.h"
+#include "../Asset/MeshCooker.h"
+#include "../Asset/MeshFormat.h"
+
+// Offline converter: glTF 2.0 (.glb / .gltf) -> engine mesh (.mmesh)
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: MeshCooker <input.glb|input.gltf> <output.mmesh> [lodLevels] [lodReduction]\n";
+        return 1;
+    }
+
+    MeshCookOptions options;
+    if (argc > 3) options.lodLevels = std::stoi(argv[3]);
+    if (argc > 4) options.lodReduction = std::stof(argv[4]);
+
+    try {
+        GltfScene scene = LoadGltf(argv[1]);
+        CookMeshFile(scene, argv[2], options);
+
+        // Round trip through the runtime loader so a bad cook fails here rather than in the game
+        MeshFile cooked(argv[2]);
+        const MeshFileHeader &header = cooked.Header();
+
+        std::cout << argv[2] << ": " << header.vertexCount << " vertices, " << header.indexCount / 3 << " triangles (all LODs), "
+                  << header.submeshCount << " submeshes, " << header.nodeCount << " nodes, " << header.jointCount << " joints, " << header.clipCount << " clips (" << header.keyCount << " keys), "
+                  << header.fileSize << " bytes\n";
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkTown.h"
+#include "../Core/JobSystem.h"
+#include "../Navigation/NavMeshBuilder.h"
+#include "../Navigation/PathQueue.h"
+#include "../Terrain/Heightfield.h"
+
+// Navmesh build over a 4 km map (generated terrain plus the benchmark town in the middle), then the cost of long
+// hierarchical queries across it and of a 200-request burst through the time-sliced queue, whose searches suspend
+// every sliceExpansions nodes to check the budget.
+// Usage: NavBenchmark [cellSize=0.5] [paths=200] [clusterSize=512] [budgetMs=2] [sliceExpansions=256]
+int main(int argc, char *argv[]) {
+    const float cellSize = argc > 1 ? std::stof(argv[1]) : 0.5f;
+    const size_t pathCount = argc > 2 ? std::stoul(argv[2]) : 200;
+    const float clusterSize = argc > 3 ? std::stof(argv[3]) : 512.0f;
+    const double budgetMs = argc > 4 ? std::stod(argv[4]) : 2.0;
+    PathQueueSettings queueSettings;
+    if (argc > 5) queueSettings.sliceExpansions = std::stoul(argv[5]);
+
+    JobSystem jobs;
+    Heightfield terrain = Heightfield::Generate(4096, 1337, 24.0f, -12.0f);
+    StaticGeometry geometry;
+    AddBenchmarkTown(geometry);
+    StaticBvh world(geometry);
+
+    NavMeshSettings settings;
+    settings.boundsMin = glm::vec3(-2048.0f, -20.0f, -2048.0f);
+    settings.boundsMax = glm::vec3(2048.0f, 40.0f, 2048.0f);
+    settings.cellSize = cellSize;
+    settings.cellHeight = 0.2f;
+
+    NavMesh mesh = BuildNavMesh(world, &terrain, settings, &jobs);
+    const NavMesh::Stats &meshStats = mesh.GetStats();
+    NavHierarchy hierarchy(mesh, clusterSize, &jobs);
+    const NavHierarchy::Stats &graphStats = hierarchy.GetStats();
+
+    std::cout << "navmesh: " << meshStats.tiles << " tiles, " << meshStats.polys << " polys, " << meshStats.links << " links, built in "
+              << meshStats.buildMs << " ms (" << jobs.WorkerCount() + 1 << " threads)\n"
+              << "hierarchy: " << graphStats.clusters << " clusters, " << graphStats.nodes << " nodes, " << graphStats.edges
+              << " edges, " << graphStats.corridorPolys << " cached corridor polys, built in " << graphStats.buildMs << " ms\n";
+
+    // Orders across most of the map: endpoints at least 2 km apart
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+    auto onGround = [&](float x, float z) { return glm::vec3(x, terrain.HeightAt(x, z), z); };
+
+    std::vector<std::pair<glm::vec3, glm::vec3>> orders;
+    while (orders.size() < pathCount) {
+        glm::vec3 a = onGround(range(-2000, 2000), range(-2000, 2000));
+        glm::vec3 b = onGround(range(-2000, 2000), range(-2000, 2000));
+        if (glm::length(b - a) >= 2000.0f) orders.emplace_back(a, b);
+    }
+
+    NavQuery query(hierarchy);
+    NavPath path;
+    std::vector<double> times;
+    size_t found = 0, complete = 0, expansions = 0;
+    double lengthRatio = 0.0;
+
+    for (const auto &[a, b]: orders) {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = query.FindPath(a, b, path);
+        times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        if (!ok) continue;
+
+        found++;
+        expansions += query.LastExpansions();
+        if (!path.complete) continue;
+
+        complete++;
+        double length = 0.0;
+        for (size_t i = 1; i < path.points.size(); i++) length += glm::length(path.points[i] - path.points[i - 1]);
+        lengthRatio += length / glm::length(path.points.back() - path.points.front());
+    }
+
+    std::sort(times.begin(), times.end());
+    double total = 0.0;
+    for (double t: times) total += t;
+
+    std::cout << pathCount << " paths over 2 km: " << found << " on the mesh, " << complete << " complete\n"
+              << "  avg " << total / static_cast<double>(times.size()) << " ms, p99 " << times[times.size() * 99 / 100] << " ms, max "
+              << times.back() << " ms, " << static_cast<double>(expansions) / static_cast<double>(std::max<size_t>(found, 1))
+              << " expansions/path, length " << lengthRatio / static_cast<double>(std::max<size_t>(complete, 1)) << "x straight line\n";
+
+    // A whole company gets orders on the same frame
+    PathQueue queue(hierarchy, &jobs, queueSettings);
+    for (const auto &[a, b]: orders) queue.Request(a, b);
+
+    std::vector<double> updates;
+    while (queue.GetStats().queued > 0) {
+        queue.Update(budgetMs);
+        updates.push_back(queue.GetStats().lastUpdateMs);
+    }
+    std::sort(updates.begin(), updates.end());
+
+    std::cout << "queue burst of " << pathCount << " with a " << budgetMs << " ms budget: " << updates.size() << " frames, update p99 "
+              << updates[updates.size() * 99 / 100] << " ms, max " << updates.back() << " ms, worst single search " << queue.GetStats().worstSearchMs << " ms over "
+              << queue.GetStats().worstSearchUpdates << " updates\n";
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "../Core/JobSystem.h"
+#include "../Game/Simulation.h"
+#include "../Net/ReplicationClient.h"
+#include "../Net/ReplicationServer.h"
+
+// Snapshot replication over loopback: a server with one simulated client per player plus server-side bots, every
+// player wandering and looking around (a quarter stand still), for a few seconds of play. With a map size everyone is
+// scattered over that square of terrain instead of the room, so each client's interest set is a fraction of the
+// world. Reports bytes per client per tick, server CPU per tick and entities considered vs. sent per client, then
+// checks every client's newest snapshot: its own player exactly as the server quantized it that tick, everyone else
+// as quantized on some recent snapshot tick, with how many ticks behind they lag near the player and further out.
+// Usage: NetBenchmark [clients=100] [ticks=600] [snapshotInterval=2] [bots=0] [mapSize=0 (the room)]
+int main(int argc, char *argv[]) {
+    const size_t clientCount = argc > 1 ? std::stoul(argv[1]) : 100;
+    const int ticks = argc > 2 ? std::stoi(argv[2]) : 600;
+    const uint32_t interval = argc > 3 ? static_cast<uint32_t>(std::stoul(argv[3])) : 2;
+    const size_t botCount = argc > 4 ? std::stoul(argv[4]) : 0;
+    const float mapSize = argc > 5 ? std::stof(argv[5]) : 0.0f;
+
+    JobSystem jobs;
+    Simulation sim(&jobs);
+
+    ReplicationSettings settings;
+    settings.port = 0;
+    settings.snapshotInterval = interval;
+    settings.maxClients = clientCount;
+    ReplicationServer server(sim, settings, &jobs);
+
+    std::vector<std::unique_ptr<ReplicationClient>> clients;
+    for (size_t i = 0; i < clientCount; i++) clients.push_back(std::make_unique<ReplicationClient>(NetAddress::Loopback(server.Port())));
+
+    auto connectStart = std::chrono::steady_clock::now();
+    size_t connected = 0;
+    while (connected < clientCount && std::chrono::steady_clock::now() - connectStart < std::chrono::seconds(5)) {
+        connected = 0;
+        for (auto &client: clients) {
+            client->Update();
+            connected += client->IsConnected();
+        }
+        server.Receive();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << connected << "/" << clientCount << " clients connected\n";
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (size_t i = 0; i < botCount; i++) sim.AddPlayer(sim.SpawnPoint(static_cast<uint32_t>(sim.GetStats().players)));
+    if (mapSize > 0.0f) {
+        for (uint32_t id = 0; id < sim.PlayerSlots(); id++) {
+            if (!sim.IsPlayer(id)) continue;
+            const float x = unit(rng) * mapSize * 0.5f, z = unit(rng) * mapSize * 0.5f;
+            sim.Teleport(id, glm::vec3(x, sim.Terrain().HeightAt(x, z) + 0.05f, z));
+        }
+    }
+    struct Wander {
+        glm::vec3 heading = glm::vec3(0.0f);
+        glm::vec2 look = glm::vec2(0.0f);
+        int turnIn = 0;
+    };
+    std::vector<Wander> wander(sim.PlayerSlots());
+
+    // What the server quantized on each snapshot tick, to check the clients against
+    std::map<uint32_t, std::vector<NetEntityState>> sent;
+    auto quantizeWorld = [&] {
+        std::vector<NetEntityState> states;
+        for (uint32_t id = 0; id < sim.PlayerSlots(); id++) {
+            if (!sim.IsPlayer(id)) continue;
+            const CharacterController &p = sim.Player(id);
+            states.push_back(QuantizeEntity(id, p.Position(), p.Velocity(), sim.Aim(id), p.GetStance(), p.IsGrounded()));
+        }
+        return states;
+    };
+
+    double serverMs = 0.0, worstServerMs = 0.0, interestMs = 0.0;
+    size_t bytes = 0, packets = 0, snapshots = 0, fullSnapshots = 0, considered = 0, updated = 0, deferred = 0;
+
+    for (int t = 0; t < ticks; t++) {
+        for (uint32_t id = 0; id < sim.PlayerSlots(); id++) {
+            if (!sim.IsPlayer(id) || id % 4 == 3) continue;
+            Wander &w = wander[id];
+            if (--w.turnIn <= 0) {
+                w.heading = glm::normalize(glm::vec3(unit(rng), 0.0f, unit(rng)) + glm::vec3(1e-3f, 0.0f, 0.0f));
+                w.look = glm::vec2(unit(rng), unit(rng) * 0.3f);
+                w.turnIn = 30 + static_cast<int>(rng() % 90);
+            }
+            CharacterInput input;
+            input.move = w.heading;
+            sim.SetInput(id, input);
+            sim.SetAim(id, sim.Aim(id) + w.look);
+        }
+
+        sim.Step();
+
+        auto start = std::chrono::steady_clock::now();
+        server.Receive();
+        server.Send();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        serverMs += ms;
+        worstServerMs = std::max(worstServerMs, ms);
+
+        const ReplicationServer::Stats &stats = server.GetStats();
+        bytes += stats.bytes;
+        packets += stats.packets;
+        snapshots += stats.snapshots;
+        fullSnapshots += stats.fullSnapshots;
+        considered += stats.considered;
+        updated += stats.updated;
+        deferred += stats.deferred;
+        interestMs += stats.interestMs;
+        if (stats.snapshots > 0) sent[static_cast<uint32_t>(sim.Tick())] = quantizeWorld();
+        while (sent.size() > 64) sent.erase(sent.begin());
+
+        for (auto &client: clients) client->Update();
+    }
+
+    // Whatever is still in flight on loopback
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (auto &client: clients) client->Update();
+
+    auto findEntity = [](const std::vector<NetEntityState> &states, uint32_t id) -> const NetEntityState * {
+        auto found = std::lower_bound(states.begin(), states.end(), id, [](const NetEntityState &s, uint32_t v) { return s.id < v; });
+        return found != states.end() && found->id == id ? &*found : nullptr;
+    };
+
+    // How far behind each entity a client holds is, by the newest snapshot tick whose quantized state it matches
+    constexpr float NearDistance = 50.0f;
+    size_t mismatches = 0, stale = 0, missingBaseline = 0, malformed = 0, abandoned = 0, viewed = 0;
+    double lagSum[2] = {0.0, 0.0};
+    size_t lagCount[2] = {0, 0};
+    for (auto &client: clients) {
+        auto found = sent.find(client->LatestTick());
+        if (!client->HasSnapshot() || found == sent.end()) {
+            stale++;
+        } else {
+            const NetEntityState *self = findEntity(found->second, client->PlayerId());
+            const NetEntityState *mine = client->LatestEntity(client->PlayerId());
+            bool matched = self && mine && *self == *mine;
+            const glm::vec3 eye = mine ? EntityPosition(*mine) : glm::vec3(0.0f);
+            for (const NetEntityState &s: client->Latest()) {
+                bool seen = false;
+                for (auto at = std::make_reverse_iterator(std::next(found)); at != sent.rend(); ++at) {
+                    const NetEntityState *then = findEntity(at->second, s.id);
+                    if (then && *then == s) {
+                        const size_t band = glm::length(EntityPosition(s) - eye) < NearDistance ? 0 : 1;
+                        lagSum[band] += static_cast<double>(found->first - at->first);
+                        lagCount[band]++;
+                        seen = true;
+                        break;
+                    }
+                }
+                matched = matched && seen;
+            }
+            viewed += client->Latest().size();
+            mismatches += matched ? 0 : 1;
+        }
+        missingBaseline += client->GetStats().missingBaseline;
+        malformed += client->GetStats().malformed;
+        abandoned += client->GetStats().abandoned;
+    }
+
+    BitWriter full;
+    std::vector<NetEntityState> world = quantizeWorld();
+    SnapshotHeader fullHeader;
+    fullHeader.tick = static_cast<uint32_t>(sim.Tick());
+    EncodeSnapshot(fullHeader, nullptr, world, full);
+
+    const double perClientTick = 1.0 / (static_cast<double>(clientCount) * ticks);
+    const double perSnapshot = 1.0 / static_cast<double>(std::max<size_t>(snapshots, 1));
+    const double udpOverhead = 28.0;
+    std::cout << clientCount << " clients, " << world.size() << " entities" << (mapSize > 0.0f ? " over " + std::to_string(static_cast<int>(mapSize)) + " m" : " in the room")
+              << ", snapshot every " << interval << " ticks, " << ticks << " ticks\n"
+              << "  full snapshot " << full.Finish().size() << " bytes; sent " << snapshots << " snapshots (" << fullSnapshots
+              << " full) in " << packets << " packets\n"
+              << "  per client per tick: " << static_cast<double>(bytes) * perClientTick << " bytes payload, "
+              << (static_cast<double>(bytes) + udpOverhead * static_cast<double>(packets)) * perClientTick << " with IP/UDP headers ("
+              << (static_cast<double>(bytes) + udpOverhead * static_cast<double>(packets)) * perClientTick * Simulation::TickRate * 8.0 / 1000.0
+              << " kbit/s)\n"
+              << "  per client per snapshot: " << static_cast<double>(considered) * perSnapshot << " entities considered, "
+              << static_cast<double>(updated) * perSnapshot << " sent fresh, " << static_cast<double>(deferred) * perSnapshot
+              << " deferred by the budget; " << static_cast<double>(viewed) / static_cast<double>(std::max<size_t>(clientCount - stale, 1))
+              << " in the final view\n"
+              << "  ticks behind the server: " << (lagCount[0] ? lagSum[0] / static_cast<double>(lagCount[0]) : 0.0) << " avg within "
+              << NearDistance << " m, " << (lagCount[1] ? lagSum[1] / static_cast<double>(lagCount[1]) : 0.0) << " avg further out\n"
+              << "  server replication CPU per tick: " << serverMs / ticks << " ms avg (" << interestMs / ticks << " ms interest), "
+              << worstServerMs << " ms worst\n"
+              << "  clients: " << mismatches << " mismatched, " << stale << " without a checkable snapshot, " << missingBaseline
+              << " missing baselines, " << malformed << " malformed, " << abandoned << " abandoned\n";
+    return 0;
+}
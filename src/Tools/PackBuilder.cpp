@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+
+#include "../Asset/PackBuilder.h"
+#include "../Asset/PackFormat.h"
+#include "../Asset/Vfs.h"
+
+// Offline packer: asset directory -> .mpak
+// Usage: PackBuilder <output.mpak> <sourceDir> [compression=auto|none|all]
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: PackBuilder <output.mpak> <sourceDir> [compression=auto|none|all]\n";
+        return 1;
+    }
+
+    PackBuildOptions options;
+    const std::string mode = argc > 3 ? argv[3] : "auto";
+    if (mode == "none") options.compression = PackCompressionMode::None;
+    else if (mode == "all") options.compression = PackCompressionMode::All;
+    else if (mode != "auto") {
+        std::cerr << "Unknown Compression Mode: " << mode << '\n';
+        return 1;
+    }
+
+    try {
+        PackBuildStats stats = BuildPackFile(argv[2], argv[1], options);
+
+        // Read every entry back through the runtime path so a bad pack fails here rather than in the game
+        Vfs vfs;
+        vfs.Mount(argv[1]);
+        PackFile pack(argv[1]);
+        for (const PackEntry &entry: pack.Entries()) {
+            vfs.Read(pack.Name(entry));
+        }
+
+        std::cout << argv[1] << ": " << stats.files << " files (" << stats.compressed << " LZ4), " << stats.inputBytes << " -> "
+                  << stats.packBytes << " bytes\n";
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "BenchmarkTown.h"
+#include "../AI/PerceptionSystem.h"
+#include "../Core/JobSystem.h"
+#include "../Terrain/Heightfield.h"
+
+// AI line of sight in the benchmark town: 200 soldiers in squads, each asking about 50 enemies every 60 Hz tick.
+// Reports what the perception cache and ray budget make of that per tick, then compares the packet any-hit query
+// against closest-hit raycasts on the same lines and checks that they agree.
+// Usage: PerceptionBenchmark [ticks=300] [raysPerTick=2048] [ttl=0.5]
+int main(int argc, char *argv[]) {
+    const int ticks = argc > 1 ? std::stoi(argv[1]) : 300;
+    const size_t raysPerTick = argc > 2 ? std::stoul(argv[2]) : 2048;
+    const float timeToLive = argc > 3 ? std::stof(argv[3]) : 0.5f;
+
+    JobSystem jobs;
+    StaticGeometry geometry;
+    AddBenchmarkTown(geometry);
+    StaticBvh world(geometry);
+    Heightfield terrain = Heightfield::Generate(2048, 9, 8.0f, -6.0f);
+
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    // Ten squads of twenty in a 600 m fight; everyone watches fifty soldiers of the other side
+    constexpr int SoldierCount = 200, SquadSize = 20, Candidates = 50;
+    std::vector<glm::vec3> positions(SoldierCount), headings(SoldierCount);
+    std::vector<std::vector<uint32_t>> watched(SoldierCount);
+    for (int i = 0; i < SoldierCount; i++) {
+        glm::vec2 squad(static_cast<float>((i / SquadSize) % 5) * 120.0f - 240.0f, (i / SquadSize) < 5 ? -150.0f : 150.0f);
+        positions[i] = glm::vec3(squad.x + range(-25, 25), 0.0f, squad.y + range(-25, 25));
+        headings[i] = glm::normalize(glm::vec3(range(-1, 1), 0.0f, range(-1, 1)));
+        for (int c = 0; c < Candidates; c++) {
+            watched[i].push_back(static_cast<uint32_t>((i < SoldierCount / 2 ? SoldierCount / 2 : 0) + rng() % (SoldierCount / 2)));
+        }
+    }
+    auto eye = [&](uint32_t i) { return positions[i] + glm::vec3(0.0f, terrain.HeightAt(positions[i].x, positions[i].z) + 1.6f, 0.0f); };
+    auto chest = [&](uint32_t i) { return positions[i] + glm::vec3(0.0f, terrain.HeightAt(positions[i].x, positions[i].z) + 1.2f, 0.0f); };
+
+    PerceptionSettings settings;
+    settings.raysPerTick = raysPerTick;
+    settings.timeToLive = timeToLive;
+    PerceptionSystem perception(world, &terrain, settings);
+
+    double totalMs = 0.0, worstMs = 0.0;
+    size_t totalQueries = 0, totalHits = 0, totalCast = 0, worstDeferred = 0, visible = 0, unknown = 0;
+    const float dt = 1.0f / 60.0f;
+
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < SoldierCount; i++) {
+            positions[i] += headings[i] * (1.5f * dt);
+        }
+
+        for (uint32_t i = 0; i < SoldierCount; i++) {
+            for (uint32_t target: watched[i]) {
+                PerceptionResult result = perception.Query(i, eye(i), target, chest(target), 1.0f);
+                if (tick == ticks - 1) {
+                    visible += result.visibility == Visibility::Visible;
+                    unknown += result.visibility == Visibility::Unknown;
+                }
+            }
+        }
+
+        perception.Update(static_cast<double>(tick) * dt, &jobs);
+        const PerceptionSystem::Stats &stats = perception.GetStats();
+        totalMs += stats.castMs;
+        worstMs = std::max(worstMs, stats.castMs);
+        totalQueries += stats.queries;
+        totalHits += stats.cacheHits;
+        totalCast += stats.cast;
+        worstDeferred = std::max(worstDeferred, stats.deferred);
+    }
+
+    const double perTick = 1.0 / ticks;
+    std::cout << SoldierCount << " soldiers x " << Candidates << " candidates, " << ticks << " ticks, " << raysPerTick
+              << " rays/tick budget, ttl " << timeToLive << " s\n"
+              << "  per tick: " << static_cast<double>(totalQueries) * perTick << " queries, " << static_cast<double>(totalHits) * perTick
+              << " cache hits, " << static_cast<double>(totalCast) * perTick << " lines cast, worst backlog " << worstDeferred << "\n"
+              << "  update " << totalMs * perTick << " ms avg, " << worstMs << " ms worst (" << jobs.WorkerCount() + 1 << " threads)\n"
+              << "  last tick: " << visible << " visible, " << unknown << " never checked, " << perception.GetStats().cachedPairs
+              << " cached pairs\n";
+
+    // Same lines three ways: packets in eye order, packets in random order, closest-hit rays
+    std::vector<Ray> lines;
+    for (uint32_t i = 0; i < SoldierCount; i++) {
+        for (uint32_t target: watched[i]) lines.push_back({eye(i), 1.0f, chest(target) - eye(i)});
+    }
+    std::vector<Ray> shuffled = lines;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    std::vector<uint8_t> occluded(lines.size()), shuffledOccluded(lines.size());
+    std::vector<RayHit> hits(lines.size());
+    auto timeMs = [](auto &&fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double packetMs = timeMs([&] { world.OccludedBatch(lines, occluded); });
+    double shuffledMs = timeMs([&] { world.OccludedBatch(shuffled, shuffledOccluded); });
+    double closestMs = timeMs([&] { world.RaycastBatch(lines, hits); });
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < lines.size(); i++) mismatches += (occluded[i] != 0) != hits[i].IsHit();
+
+    const double us = 1000.0 / static_cast<double>(lines.size());
+    std::cout << lines.size() << " lines, one thread: packets " << packetMs * us << " us/line, unordered packets " << shuffledMs * us
+              << " us/line, closest hit " << closestMs * us << " us/line, mismatches " << mismatches << "\n";
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Core/JobSystem.h"
+#include "../Game/Simulation.h"
+#include "../Net/ClientPrediction.h"
+#include "../Net/LinkSimulator.h"
+#include "../Net/ReplicationClient.h"
+#include "../Net/ReplicationServer.h"
+
+// Client-side prediction over a bad network: a server and one predicting client on loopback with a LinkSimulator
+// between them, both ticking at 60 Hz of wall-clock time while the client walks a scripted route (turns, runs into
+// the walls, jumps, crouches). Reports how far the prediction was from the server whenever a snapshot confirmed a
+// command, how often that took a correction and how many commands each replayed, the input delay prediction hides,
+// and how far behind the latest snapshot an unpredicted view of the player would have been. With no jitter and no
+// loss every command arrives in time and there should be no corrections at all.
+// Usage: PredictionBenchmark [latencyMs=60] [jitterMs=15] [lossPercent=2] [seconds=20]
+namespace {
+    bool Newer(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) > 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    LinkConditions link;
+    link.latencyMs = argc > 1 ? std::stod(argv[1]) : 60.0;
+    link.jitterMs = argc > 2 ? std::stod(argv[2]) : 15.0;
+    link.lossPercent = argc > 3 ? std::stod(argv[3]) : 2.0;
+    const double seconds = argc > 4 ? std::stod(argv[4]) : 20.0;
+
+    JobSystem jobs;
+    Simulation sim(&jobs);
+
+    ReplicationSettings settings;
+    settings.port = 0;
+    ReplicationServer server(sim, settings, &jobs);
+    LinkSimulator relay(NetAddress::Loopback(server.Port()), link);
+    ReplicationClient client(relay.Address());
+
+    // The client would load the same world; sharing the server's is the same thing without the second load
+    ClientPrediction prediction(sim.World(), &sim.Terrain());
+
+    using Clock = std::chrono::steady_clock;
+    const float dt = static_cast<float>(1.0 / Simulation::TickRate);
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / Simulation::TickRate));
+    const size_t ticks = static_cast<size_t>(seconds * Simulation::TickRate);
+    const size_t connectTicks = static_cast<size_t>(Simulation::TickRate) * 5;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    glm::vec3 heading(0.0f, 0.0f, -1.0f);
+    Stance stance = Stance::Standing;
+    int turnIn = 0;
+
+    bool spawned = false;
+    uint32_t reconciledTick = 0, lastConfirmed = 0;
+    std::vector<Clock::time_point> sentAt(ClientPrediction::HistorySize);
+    std::vector<float> errors;
+    double confirmDelayMs = 0.0, trailSum = 0.0, trailWorst = 0.0;
+    size_t confirmed = 0, trailSamples = 0, predicted = 0;
+
+    Clock::time_point next = Clock::now();
+    for (size_t t = 0; predicted < ticks && t < ticks + connectTicks; t++) {
+        // Relay traffic until the tick is due
+        while (Clock::now() < next) {
+            relay.Pump();
+            std::this_thread::sleep_for(std::chrono::microseconds(250));
+        }
+        next += period;
+        relay.Pump();
+        const Clock::time_point now = Clock::now();
+
+        // Client tick: newest snapshot first, then this tick's input
+        client.Update();
+        const NetEntityState *self = client.HasSnapshot() ? client.LatestEntity(client.PlayerId()) : nullptr;
+        if (self && !spawned) {
+            prediction.Reset(EntityCharacter(*self));
+            spawned = true;
+        } else if (self && client.HasCommandAck() && client.LatestTick() != reconciledTick) {
+            const size_t before = prediction.GetStats().reconciled;
+            prediction.Reconcile(client.LastCommand(), client.CommandState());
+            if (prediction.GetStats().reconciled > before) errors.push_back(prediction.GetStats().lastError);
+
+            if (Newer(client.LastCommand(), lastConfirmed) && prediction.LatestSequence() - client.LastCommand() < ClientPrediction::HistorySize) {
+                confirmDelayMs += std::chrono::duration<double, std::milli>(now - sentAt[client.LastCommand() % ClientPrediction::HistorySize]).count();
+                confirmed++;
+                lastConfirmed = client.LastCommand();
+            }
+        }
+        reconciledTick = client.LatestTick();
+
+        if (spawned) {
+            if (--turnIn <= 0) {
+                heading = glm::normalize(glm::vec3(unit(rng), 0.0f, unit(rng)) + glm::vec3(1e-3f, 0.0f, 0.0f));
+                stance = rng() % 5 == 0 ? Stance::Crouching : Stance::Standing;
+                turnIn = 30 + static_cast<int>(rng() % 90);
+            }
+            PlayerCommand next;
+            next.input.move = heading;
+            next.input.jump = rng() % 90 == 0;
+            next.input.stance = stance;
+            next.aim = glm::vec2(glm::degrees(std::atan2(heading.z, heading.x)), 0.0f);
+
+            const PlayerCommand &command = prediction.Predict(next, dt);
+            sentAt[command.sequence % ClientPrediction::HistorySize] = now;
+            client.SendCommands(prediction.Unacknowledged());
+            predicted++;
+
+            if (self) {
+                const double trail = glm::distance(prediction.Character().Position(), EntityPosition(*self));
+                trailSum += trail;
+                trailWorst = std::max(trailWorst, trail);
+                trailSamples++;
+            }
+        }
+
+        // Server tick
+        server.Receive();
+        sim.Step(dt);
+        server.Send();
+    }
+
+    if (!spawned) {
+        std::cout << "client never spawned\n";
+        return 1;
+    }
+
+    std::sort(errors.begin(), errors.end());
+    const ClientPrediction::Stats &stats = prediction.GetStats();
+    const ReplicationServer::Stats &serverStats = server.GetStats();
+    const auto percentile = [&](double p) { return errors.empty() ? 0.0f : errors[std::min(errors.size() - 1, static_cast<size_t>(p * errors.size()))]; };
+    const double secondsPredicted = static_cast<double>(predicted) / Simulation::TickRate;
+
+    std::cout << "link " << link.latencyMs << " ms + 0.." << link.jitterMs << " ms each way, " << link.lossPercent << "% loss; "
+              << predicted << " ticks predicted\n"
+              << "  prediction error when confirmed: " << (stats.reconciled ? stats.errorSum / static_cast<double>(stats.reconciled) : 0.0)
+              << " m avg, " << percentile(0.5) << " m median, " << percentile(0.99) << " m p99, " << stats.maxError << " m worst over "
+              << stats.reconciled << " snapshots (" << stats.unmatched << " unmatched)\n"
+              << "  corrections: " << stats.corrections << " (" << static_cast<double>(stats.corrections) / secondsPredicted << "/s), "
+              << (stats.corrections ? static_cast<double>(stats.replayed) / static_cast<double>(stats.corrections) : 0.0)
+              << " commands replayed each, " << (stats.corrections ? stats.replayMs / static_cast<double>(stats.corrections) : 0.0) << " ms each\n"
+              << "  input delay hidden by prediction: " << (confirmed ? confirmDelayMs / static_cast<double>(confirmed) : 0.0)
+              << " ms avg from command to confirming snapshot\n"
+              << "  unpredicted view would trail by " << (trailSamples ? trailSum / static_cast<double>(trailSamples) : 0.0) << " m avg, "
+              << trailWorst << " m worst\n"
+              << "  server: " << serverStats.commandsApplied << " commands applied, " << serverStats.commandsMissing
+              << " ticks with input late, " << serverStats.commandsDropped << " dropped\n"
+              << "  relay: " << relay.GetStats().forwarded << " datagrams forwarded, " << relay.GetStats().dropped << " dropped\n";
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "BenchmarkTown.h"
+#include "../Core/JobSystem.h"
+#include "../Physics/StaticBvh.h"
+
+namespace {
+    // Closest t in (0, tMax) of each ray over every primitive, the same tests the leaves make but without the tree.
+    // Primitives are the outer loop so the rays stay in cache while the geometry streams past once.
+    std::vector<float> BruteForceRaycast(std::span<const Ray> rays, const std::vector<StaticGeometry::Triangle> &triangles,
+                                         const std::vector<StaticGeometry::Box> &boxes) {
+        std::vector<float> best(rays.size());
+        for (size_t i = 0; i < rays.size(); i++) best[i] = rays[i].tMax;
+
+        for (const StaticGeometry::Triangle &tri: triangles) {
+            const glm::vec3 e1 = tri.b - tri.a, e2 = tri.c - tri.a;
+            for (size_t i = 0; i < rays.size(); i++) {
+                const Ray &ray = rays[i];
+                const glm::vec3 p = glm::cross(ray.direction, e2);
+                const float det = glm::dot(e1, p);
+                if (std::abs(det) <= 1e-12f) continue;
+
+                const float inv = 1.0f / det;
+                const glm::vec3 s = ray.origin - tri.a, q = glm::cross(s, e1);
+                const float u = glm::dot(s, p) * inv, v = glm::dot(ray.direction, q) * inv, t = glm::dot(e2, q) * inv;
+                if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < best[i]) best[i] = t;
+            }
+        }
+
+        for (const StaticGeometry::Box &box: boxes) {
+            for (size_t i = 0; i < rays.size(); i++) {
+                const glm::vec3 origin = box.toLocal * (rays[i].origin - box.center), direction = box.toLocal * rays[i].direction;
+                glm::vec3 inv;
+                for (int axis = 0; axis < 3; axis++) {
+                    inv[axis] = 1.0f / (std::abs(direction[axis]) > 1e-20f ? direction[axis] : std::copysign(1e-20f, direction[axis]));
+                }
+
+                const glm::vec3 t0 = (-box.halfExtents - origin) * inv, t1 = (box.halfExtents - origin) * inv;
+                const glm::vec3 tNear = glm::min(t0, t1), tFar = glm::max(t0, t1);
+                const float enter = std::max(tNear.x, std::max(tNear.y, tNear.z));
+                const float exit = std::min(tFar.x, std::min(tFar.y, tFar.z));
+                if (enter <= exit && enter > 0.0f && enter < best[i]) best[i] = enter;
+            }
+        }
+        return best;
+    }
+}
+
+// Rays per second against a synthetic 2 km town: rock meshes plus rotated building boxes. Rays are issued in
+// batches the size of one tick of hitscan / projectile queries. The first checked rays are then cast against every
+// primitive without the tree, and any ray whose closest hit or occlusion differs fails the run with exit code 1.
+// Usage: RaycastBenchmark [rays=1000000] [batch=4096] [checked=1000]
+int main(int argc, char *argv[]) {
+    const size_t rayCount = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const size_t batchSize = argc > 2 ? std::stoul(argv[2]) : 4096;
+    const size_t checkedCount = std::min<size_t>(argc > 3 ? std::stoul(argv[3]) : 1000, rayCount);
+
+    StaticGeometry geometry;
+    AddBenchmarkTown(geometry);
+
+    StaticBvh bvh(geometry);
+    const StaticBvh::Stats &stats = bvh.GetStats();
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    // Shots from head height in random directions, slightly downwards on average, 1 km range
+    std::vector<Ray> rays(rayCount);
+    for (Ray &ray: rays) {
+        ray.origin = glm::vec3(range(-1000, 1000), range(1.0f, 2.0f), range(-1000, 1000));
+        ray.direction = glm::normalize(glm::vec3(range(-1, 1), range(-0.2f, 0.05f), range(-1, 1)));
+        ray.tMax = 1000.0f;
+    }
+    std::vector<RayHit> hits(rayCount);
+
+    auto run = [&](JobSystem *jobs) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t first = 0; first < rayCount; first += batchSize) {
+            size_t count = std::min(batchSize, rayCount - first);
+            bvh.RaycastBatch(std::span(rays).subspan(first, count), std::span(hits).subspan(first, count), jobs);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(rayCount) / seconds;
+    };
+
+    JobSystem jobs;
+    double serial = run(nullptr);
+    double parallel = run(&jobs);
+    size_t hitCount = std::count_if(hits.begin(), hits.end(), [](const RayHit &h) { return h.IsHit(); });
+
+    std::cout << stats.triangles << " triangles, " << stats.boxes << " boxes, " << stats.nodes << " nodes, "
+              << stats.leaves << " leaves, depth " << stats.depth << ", built in " << stats.buildMs << " ms\n"
+              << rayCount << " rays in batches of " << batchSize << ", " << hitCount << " hits\n"
+              << "serial:   " << serial / 1e6 << " Mrays/s\n"
+              << "parallel: " << parallel / 1e6 << " Mrays/s (" << jobs.WorkerCount() + 1 << " threads)\n";
+
+    // Brute force on a sample of the same rays, for both the closest hit and the packet any-hit path
+    std::vector<StaticGeometry::Triangle> triangles;
+    std::vector<StaticGeometry::Box> boxes;
+    bvh.Overlap(bvh.BoundsMin() - glm::vec3(1.0f), bvh.BoundsMax() + glm::vec3(1.0f), triangles, boxes);
+
+    const std::span<const Ray> checked = std::span<const Ray>(rays).first(checkedCount);
+    std::vector<uint8_t> occluded(checkedCount);
+    bvh.OccludedBatch(checked, occluded, &jobs);
+
+    const std::vector<float> closest = BruteForceRaycast(checked, triangles, boxes);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < checkedCount; i++) {
+        const float expected = closest[i];
+        const bool expectHit = expected < checked[i].tMax;
+        const bool hitMatches = hits[i].IsHit() == expectHit && (!expectHit || std::abs(hits[i].t - expected) <= 1e-4f * std::max(1.0f, expected));
+        mismatches += !hitMatches || (occluded[i] != 0) != expectHit;
+    }
+
+    std::cout << "brute force on " << checkedCount << " rays (" << triangles.size() << " triangles, " << boxes.size()
+              << " boxes): " << mismatches << " mismatches\n";
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../Core/JobSystem.h"
+#include "../Game/Replay.h"
+#include "../Game/Simulation.h"
+
+// Replay recording and playback: a match of players wandering, looking around every tick, changing stance, firing
+// lag-compensated rounds and now and then leaving and rejoining, recorded unthrottled for the given minutes of game
+// time. Reports the file size per player-hour and the recording cost per tick, then plays the file back headless
+// from the start (verifying every keyframe against the re-simulation) and seeks to random ticks.
+// Usage: ReplayBenchmark [players=100] [minutes=5] [seeks=20] [keyframeSeconds=10] [path=benchmark.mrep]
+int main(int argc, char *argv[]) {
+    const uint32_t playerCount = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 100;
+    const double minutes = argc > 2 ? std::stod(argv[2]) : 5.0;
+    const int seekCount = argc > 3 ? std::stoi(argv[3]) : 20;
+    const double keyframeSeconds = argc > 4 ? std::stod(argv[4]) : 10.0;
+    const std::string path = argc > 5 ? argv[5] : "benchmark.mrep";
+
+    JobSystem jobs;
+    Simulation sim(&jobs);
+    for (uint32_t i = 0; i < playerCount; i++) sim.AddPlayer(sim.SpawnPoint(i));
+
+    ReplaySettings settings;
+    settings.keyframeInterval = std::max<uint32_t>(1, static_cast<uint32_t>(keyframeSeconds * Simulation::TickRate));
+
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    struct Wander {
+        glm::vec3 heading = glm::vec3(0.0f);
+        glm::vec2 look = glm::vec2(0.0f);
+        Stance stance = Stance::Standing;
+        int turnIn = 0;
+        int fireIn = 0;
+    };
+    std::vector<Wander> wander(playerCount);
+
+    const uint64_t ticks = static_cast<uint64_t>(minutes * 60.0 * Simulation::TickRate);
+    double stepMs = 0.0, recordMs = 0.0, worstRecordMs = 0.0;
+    size_t rejoins = 0;
+    {
+        ReplayRecorder recorder(sim, path, settings);
+        for (uint64_t t = 0; t < ticks; t++) {
+            for (uint32_t id = 0; id < playerCount; id++) {
+                if (!sim.IsPlayer(id)) continue;
+                Wander &w = wander[id];
+                if (--w.turnIn <= 0) {
+                    w.heading = glm::normalize(glm::vec3(unit(rng), 0.0f, unit(rng)) + glm::vec3(1e-3f, 0.0f, 0.0f));
+                    w.look = glm::vec2(unit(rng), unit(rng) * 0.3f);
+                    if (rng() % 4 == 0) w.stance = static_cast<Stance>(rng() % 3);
+                    w.turnIn = 30 + static_cast<int>(rng() % 90);
+                }
+                CharacterInput input;
+                input.move = w.heading;
+                input.stance = w.stance;
+                input.jump = rng() % 600 == 0;
+                sim.SetInput(id, input);
+                sim.SetAim(id, sim.Aim(id) + w.look);
+
+                if (--w.fireIn <= 0) {
+                    sim.Fire(id, AimDirection(sim.Aim(id)), static_cast<float>(rng() % 12));
+                    w.fireIn = 20 + static_cast<int>(rng() % 100);
+                }
+            }
+
+            // Now and then someone drops and rejoins, so ids are reused mid-match
+            if (rng() % 300 == 0) {
+                const uint32_t id = static_cast<uint32_t>(rng() % playerCount);
+                sim.RemovePlayer(id);
+                sim.AddPlayer(sim.SpawnPoint(id));
+                rejoins++;
+            }
+
+            sim.Step();
+            stepMs += sim.GetStats().lastStepMs;
+            recorder.Record();
+            recordMs += recorder.GetStats().recordMs;
+            worstRecordMs = std::max(worstRecordMs, recorder.GetStats().recordMs);
+        }
+
+        const ReplayRecorder::Stats &stats = recorder.GetStats();
+        const double playerHours = static_cast<double>(playerCount) * static_cast<double>(ticks) / Simulation::TickRate / 3600.0;
+        std::cout << playerCount << " players, " << static_cast<double>(ticks) / Simulation::TickRate / 60.0 << " min of play, "
+                  << rejoins << " rejoins, keyframe every " << settings.keyframeInterval << " ticks\n"
+                  << "  file " << static_cast<double>(stats.bytes) / 1024.0 << " KiB (" << stats.keyframes << " keyframes, "
+                  << static_cast<double>(stats.keyframeBytes) / 1024.0 << " KiB): "
+                  << static_cast<double>(stats.bytes) / playerHours / (1024.0 * 1024.0) << " MiB per player-hour\n"
+                  << "  recording " << recordMs / static_cast<double>(ticks) * 1000.0 << " us/tick avg, " << worstRecordMs * 1000.0
+                  << " us worst; simulation " << stepMs / static_cast<double>(ticks) << " ms/tick\n";
+    }
+
+    SimulationState recordedEnd;
+    sim.SaveState(recordedEnd);
+
+    ReplayPlayer player(sim, path);
+    auto playStart = std::chrono::steady_clock::now();
+    uint64_t played = 0;
+    while (player.Step()) played++;
+    const double playSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - playStart).count();
+
+    SimulationState playedEnd;
+    sim.SaveState(playedEnd);
+    bool endMatches = recordedEnd.tick == playedEnd.tick && recordedEnd.players.size() == playedEnd.players.size() &&
+                      recordedEnd.rounds.size() == playedEnd.rounds.size();
+    for (size_t i = 0; endMatches && i < recordedEnd.players.size(); i++) {
+        endMatches = recordedEnd.players[i].character.feet == playedEnd.players[i].character.feet &&
+                     recordedEnd.players[i].aim == playedEnd.players[i].aim;
+    }
+
+    std::cout << "  playback " << played << " ticks in " << playSeconds << " s: "
+              << static_cast<double>(played) / Simulation::TickRate / playSeconds << "x real time; " << player.GetStats().verified
+              << " keyframes verified, " << player.GetStats().divergences << " divergences, final state "
+              << (endMatches ? "matches" : "DIFFERS") << "\n";
+
+    double seekSum = 0.0, seekWorst = 0.0;
+    uint64_t seekTicks = 0;
+    std::uniform_int_distribution<uint64_t> target(player.FirstTick(), player.LastTick());
+    for (int i = 0; i < seekCount; i++) {
+        player.Seek(target(rng));
+        seekSum += player.GetStats().lastSeekMs;
+        seekWorst = std::max(seekWorst, player.GetStats().lastSeekMs);
+        seekTicks += player.GetStats().lastSeekTicks;
+    }
+    if (seekCount > 0) {
+        std::cout << "  " << seekCount << " random seeks: " << seekSum / seekCount << " ms avg, " << seekWorst << " ms worst, "
+                  << static_cast<double>(seekTicks) / seekCount << " ticks re-simulated avg; divergences now "
+                  << player.GetStats().divergences << "\n";
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../Core/JobSystem.h"
+#include "../Physics/SpatialHash.h"
+
+// Rebuild and query cost of the entity broadphase for 10k to 100k entities spread over a 2 km map, plus a brute
+// force check of every query type on a sample of the queries.
+// Usage: SpatialHashBenchmark [queries=10000] [builds=20]
+int main(int argc, char *argv[]) {
+    const size_t queryCount = argc > 1 ? std::stoul(argv[1]) : 10000;
+    const int builds = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    JobSystem jobs;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto range = [&](float lo, float hi) { return lo + (hi - lo) * unit(rng); };
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    };
+
+    for (size_t entityCount: {10000, 25000, 50000, 100000}) {
+        // Soldiers and vehicles clustered around a few towns, the way a populated map looks
+        std::vector<glm::vec3> positions(entityCount);
+        std::vector<float> radii(entityCount);
+        std::vector<glm::vec3> towns(16);
+        for (glm::vec3 &town: towns) town = glm::vec3(range(-1000, 1000), 0.0f, range(-1000, 1000));
+
+        for (size_t i = 0; i < entityCount; i++) {
+            const glm::vec3 &town = towns[i % towns.size()];
+            positions[i] = town + glm::vec3(range(-150, 150), range(0.0f, 3.0f), range(-150, 150));
+            radii[i] = i % 50 == 0 ? 3.0f : 0.5f;
+        }
+
+        SpatialHash hash;
+        double serialMs = 0.0, parallelMs = 0.0;
+        for (int build = 0; build < builds; build++) {
+            hash.Build(positions, radii);
+            serialMs += hash.GetStats().buildMs;
+            hash.Build(positions, radii, &jobs);
+            parallelMs += hash.GetStats().buildMs;
+        }
+
+        // Hearing checks (sphere), vehicle paths (box) and sight lines (ray) centred on entities
+        std::vector<glm::vec3> centers(queryCount), directions(queryCount);
+        for (size_t q = 0; q < queryCount; q++) {
+            centers[q] = positions[rng() % entityCount];
+            directions[q] = glm::normalize(glm::vec3(range(-1, 1), range(-0.1f, 0.1f), range(-1, 1)));
+        }
+
+        std::vector<uint32_t> found;
+        std::vector<SpatialRayHit> rayHits;
+        size_t sphereResults = 0, boxResults = 0, rayResults = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (const glm::vec3 &c: centers) {
+            found.clear();
+            hash.QuerySphere(c, 30.0f, found);
+            sphereResults += found.size();
+        }
+        double sphereMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        for (const glm::vec3 &c: centers) {
+            found.clear();
+            hash.QueryBox(c - glm::vec3(10.0f, 2.0f, 10.0f), c + glm::vec3(10.0f, 2.0f, 10.0f), found);
+            boxResults += found.size();
+        }
+        double boxMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t q = 0; q < queryCount; q++) {
+            rayHits.clear();
+            hash.QueryRay(centers[q] + glm::vec3(0.0f, 1.7f, 0.0f), directions[q], 200.0f, rayHits);
+            rayResults += rayHits.size();
+        }
+        double rayMs = elapsedMs(start);
+
+        // Brute force on a sample of the same queries
+        size_t mismatches = 0;
+        for (size_t q = 0; q < std::min<size_t>(queryCount, 200); q++) {
+            const glm::vec3 &c = centers[q];
+            glm::vec3 boxMin = c - glm::vec3(10.0f, 2.0f, 10.0f), boxMax = c + glm::vec3(10.0f, 2.0f, 10.0f);
+            glm::vec3 eye = c + glm::vec3(0.0f, 1.7f, 0.0f);
+            size_t sphereExpected = 0, boxExpected = 0, rayExpected = 0;
+
+            for (size_t i = 0; i < entityCount; i++) {
+                if (glm::length(positions[i] - c) <= 30.0f + radii[i]) sphereExpected++;
+                if (glm::length(positions[i] - glm::clamp(positions[i], boxMin, boxMax)) <= radii[i]) boxExpected++;
+
+                glm::vec3 toCenter = positions[i] - eye;
+                float along = glm::dot(toCenter, directions[q]);
+                float miss = glm::dot(toCenter, toCenter) - along * along;
+                if (miss <= radii[i] * radii[i]) {
+                    float half = std::sqrt(radii[i] * radii[i] - miss);
+                    if (along + half >= 0.0f && along - half <= 200.0f) rayExpected++;
+                }
+            }
+
+            found.clear();
+            hash.QuerySphere(c, 30.0f, found);
+            mismatches += found.size() != sphereExpected;
+            found.clear();
+            hash.QueryBox(boxMin, boxMax, found);
+            mismatches += found.size() != boxExpected;
+            rayHits.clear();
+            hash.QueryRay(eye, directions[q], 200.0f, rayHits);
+            mismatches += rayHits.size() != rayExpected;
+        }
+
+        const SpatialHash::Stats &stats = hash.GetStats();
+        const double queries = static_cast<double>(queryCount), perQuery = 1000.0 / queries;
+        std::cout << entityCount << " entities, " << stats.occupiedBuckets << " buckets used, largest " << stats.largestBucket << "\n"
+                  << "  build serial " << serialMs / builds << " ms, parallel " << parallelMs / builds << " ms ("
+                  << jobs.WorkerCount() + 1 << " threads)\n"
+                  << "  sphere r30  " << sphereMs * perQuery << " us/query, " << static_cast<double>(sphereResults) / queries << " found\n"
+                  << "  box 20x4x20 " << boxMs * perQuery << " us/query, " << static_cast<double>(boxResults) / queries << " found\n"
+                  << "  ray 200 m   " << rayMs * perQuery << " us/query, " << static_cast<double>(rayResults) / queries << " found\n"
+                  << "  brute force mismatches: " << mismatches << "\n";
+    }
+
+    return 0;
+}
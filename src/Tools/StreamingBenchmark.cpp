@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Asset/PackBuilder.h"
+#include "../Asset/Vfs.h"
+#include "../Core/AsyncIo.h"
+#include "../Core/JobSystem.h"
+#include "../World/CellFormat.h"
+#include "../World/WorldStreamer.h"
+
+// World streaming under budgets: a map of generated cell chunks (meshes, textures and entities per cell) packed into
+// one .mpak, and a camera flying a winding route over it at 60 frames per second in real time. Uploads are
+// simulated (VRAM = blob sizes). Reports the per-frame streaming cost, how often the cell under the camera or a
+// neighbour was missing (pop-in), peak RAM / VRAM against the budgets, evictions and request-to-resident latency.
+// Usage: StreamingBenchmark [seconds=30] [speed=60] [ramMiB=48] [vramMiB=40] [grid=16] [workDir=streaming_benchmark]
+int main(int argc, char *argv[]) {
+    const double seconds = argc > 1 ? std::stod(argv[1]) : 30.0;
+    const float speed = argc > 2 ? std::stof(argv[2]) : 60.0f;
+    const double ramMiB = argc > 3 ? std::stod(argv[3]) : 48.0;
+    const double vramMiB = argc > 4 ? std::stod(argv[4]) : 40.0;
+    const int grid = argc > 5 ? std::stoi(argv[5]) : 16;
+    const std::filesystem::path work = argc > 6 ? argv[6] : "streaming_benchmark";
+
+    WorldStreamerSettings settings;
+    settings.cellSize = 128.0f;
+    settings.loadRadius = 384.0f;
+    settings.unloadRadius = 512.0f;
+    settings.ramBudget = static_cast<uint64_t>(ramMiB * 1024 * 1024);
+    settings.vramBudget = static_cast<uint64_t>(vramMiB * 1024 * 1024);
+
+    // Cells cover [-grid/2, grid/2) on both axes
+    const std::filesystem::path loose = work / "loose";
+    std::filesystem::remove_all(loose);
+    std::filesystem::create_directories(loose / "cells");
+
+    std::mt19937 rng(3);
+    std::vector<glm::ivec2> cellList;
+    for (int z = -grid / 2; z < grid / 2; z++) {
+        for (int x = -grid / 2; x < grid / 2; x++) {
+            CellContents contents;
+            contents.cell = {x, z};
+            auto blob = [&](const std::string &name, size_t size) {
+                CellBlob b{name, std::vector<uint8_t>(size)};
+                for (uint8_t &byte: b.bytes) byte = static_cast<uint8_t>(rng());
+                return b;
+            };
+            for (int i = 0; i < 2; i++) contents.meshes.push_back(blob("mesh" + std::to_string(i), 65536 + rng() % 196608));
+            for (int i = 0; i < 2; i++) contents.textures.push_back(blob("texture" + std::to_string(i), 262144 + rng() % 524288));
+            for (int i = 0; i < 50; i++) {
+                CellEntityRecord entity{};
+                entity.position[0] = (static_cast<float>(x) + static_cast<float>(rng() % 1000) / 1000.0f) * settings.cellSize;
+                entity.position[2] = (static_cast<float>(z) + static_cast<float>(rng() % 1000) / 1000.0f) * settings.cellSize;
+                entity.scale = 1.0f;
+                entity.mesh = i % 2;
+                entity.texture = i % 2;
+                contents.entities.push_back(entity);
+            }
+            WriteCellFile((loose / CellPath(contents.cell)).string(), contents);
+            cellList.push_back(contents.cell);
+        }
+    }
+
+    const std::string pack = (work / "world.mpak").string();
+    PackBuildStats packStats = BuildPackFile(loose.string(), pack);
+    std::filesystem::remove_all(loose);
+
+    Vfs vfs;
+    vfs.Mount(pack);
+    JobSystem jobs;
+    AsyncIo io(&jobs);
+
+    CellCallbacks callbacks;
+    callbacks.upload = [](StreamedCell &cell) { cell.vramBytes = cell.vramEstimate; };
+
+    WorldStreamer streamer(io, vfs, cellList, settings, callbacks);
+    std::cout << cellList.size() << " cells of " << settings.cellSize << " m, " << packStats.packBytes / (1024.0 * 1024.0 * cellList.size())
+              << " MiB each; budgets " << ramMiB << " MiB RAM / " << vramMiB << " MiB VRAM; camera at " << speed << " m/s, "
+              << (io.Backend() == AsyncIoBackend::IoUring ? "io_uring" : "pread pool") << "\n";
+
+    // A lazy figure eight inside the map so the camera keeps crossing cells and turning around
+    const float extent = static_cast<float>(grid) * settings.cellSize * 0.35f;
+    const float period = 4.0f * extent / std::max(speed, 1.0f) * 2.0f;
+    auto position = [&](float t) {
+        const float phase = t / period * 2.0f * 3.14159265f;
+        return glm::vec3(extent * std::sin(phase), 2.0f, extent * std::sin(phase) * std::cos(phase));
+    };
+
+    const int frames = static_cast<int>(seconds * 60.0);
+    const auto frameTime = std::chrono::microseconds(16667);
+    auto next = std::chrono::steady_clock::now();
+    size_t popInFrames = 0;
+    double totalUpdateMs = 0.0;
+
+    for (int frame = 0; frame < frames; frame++) {
+        const float t = static_cast<float>(frame) / 60.0f;
+        const glm::vec3 camera = position(t), ahead = position(t + 0.1f) - camera;
+        streamer.Update(camera, ahead);
+        totalUpdateMs += streamer.GetStats().updateMs;
+
+        // Pop-in: the cell under the camera or one next to it is known but not resident (ignore the initial load)
+        if (t > 2.0f) {
+            const glm::ivec2 here(glm::floor(glm::vec2(camera.x, camera.z) / settings.cellSize));
+            bool missing = false;
+            for (int dz = -1; dz <= 1 && !missing; dz++) {
+                for (int dx = -1; dx <= 1 && !missing; dx++) {
+                    const glm::ivec2 cell = here + glm::ivec2(dx, dz);
+                    if (std::max(std::abs(cell.x + 0.5f), std::abs(cell.y + 0.5f)) > grid / 2.0f) continue;
+                    bool resident = false;
+                    streamer.ForEachResident([&](const StreamedCell &c) { resident |= c.cell == cell; });
+                    missing = !resident;
+                }
+            }
+            popInFrames += missing;
+        }
+
+        next += frameTime;
+        std::this_thread::sleep_until(next);
+    }
+
+    const WorldStreamerStats &stats = streamer.GetStats();
+    std::cout << "update: " << totalUpdateMs / frames << " ms avg, " << stats.worstUpdateMs << " ms worst per frame\n"
+              << "pop-in: " << popInFrames << " of " << frames << " frames had the camera's or a neighbouring cell missing\n"
+              << "residency now: " << stats.residentCells << " resident, " << stats.loadedCells << " loaded, " << stats.loadingCells
+              << " loading, " << stats.wantedCells << " wanted (" << stats.missingCells << " missing)\n"
+              << "memory: RAM " << stats.ramBytes / (1024.0 * 1024.0) << " MiB now, " << stats.peakRamBytes / (1024.0 * 1024.0)
+              << " MiB peak; VRAM " << stats.vramBytes / (1024.0 * 1024.0) << " MiB now, " << stats.peakVramBytes / (1024.0 * 1024.0)
+              << " MiB peak\n"
+              << "totals: " << stats.requested << " requested, " << stats.uploaded << " uploaded, " << stats.evicted << " evicted for budget, "
+              << stats.unloaded << " unloaded for distance, " << stats.failed << " failed\n"
+              << "load latency: " << stats.averageLoadMs << " ms avg, " << stats.worstLoadMs << " ms worst\n";
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../Asset/PackBuilder.h"
+#include "../Asset/PackFormat.h"
+#include "../Asset/Vfs.h"
+
+namespace {
+    namespace fs = std::filesystem;
+
+    // Shader-like text, mesh-like quantized records and image-like noise, roughly the mix a level loads
+    void GenerateAssets(const fs::path &root, int fileCount) {
+        std::mt19937 rng(11);
+        std::vector<uint8_t> bytes;
+
+        for (int i = 0; i < fileCount; i++) {
+            const int kind = i % 3;
+            const size_t size = 4096 + rng() % (kind == 2 ? 262144 : 65536);
+            bytes.resize(size);
+
+            if (kind == 0) {
+                static const char words[] = "uniform vec3 position; layout(std140) float sampler2D texture normal mix(";
+                for (size_t k = 0; k < size; k++) bytes[k] = static_cast<uint8_t>(words[(k * 7 + rng() % 3) % (sizeof(words) - 1)]);
+            } else if (kind == 1) {
+                uint16_t value = 0;
+                for (size_t k = 0; k + 1 < size; k += 2) {
+                    value = static_cast<uint16_t>(value + rng() % 64 - 32);
+                    bytes[k] = static_cast<uint8_t>(value);
+                    bytes[k + 1] = static_cast<uint8_t>(value >> 8);
+                }
+            } else {
+                for (uint8_t &b: bytes) b = static_cast<uint8_t>(rng());
+            }
+
+            const char *folder = kind == 0 ? "shaders" : kind == 1 ? "models" : "textures";
+            const fs::path path = root / folder / (std::to_string(i) + (kind == 0 ? ".glsl" : kind == 1 ? ".mmesh" : ".jpg"));
+            fs::create_directories(path.parent_path());
+            std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(size));
+        }
+    }
+
+    // Drops the file's clean pages so the next read comes from the device
+    void Evict(const fs::path &path) {
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+#endif
+    }
+
+    uint64_t Touch(std::string_view bytes) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < bytes.size(); i += 64) sum += static_cast<uint8_t>(bytes[i]);
+        return sum;
+    }
+
+    struct Run {
+        double coldMs = 0.0;
+        double warmMs = 0.0;
+        uint64_t checksum = 0;
+    };
+}
+
+// Asset startup cost: mounting and reading every file of an asset tree through the old per-file ifstream path,
+// through the VFS from loose files, and through the VFS from a stored and an LZ4 pack. Each is run cold (page cache
+// dropped with posix_fadvise first, so this needs a real disk rather than tmpfs to mean anything) and then warm.
+// Usage: VfsBenchmark [sourceDir=generate] [files=3000] [workDir=vfs_benchmark]
+int main(int argc, char *argv[]) {
+    const std::string source = argc > 1 ? argv[1] : "generate";
+    const int fileCount = argc > 2 ? std::stoi(argv[2]) : 3000;
+    const fs::path work = argc > 3 ? argv[3] : "vfs_benchmark";
+
+    fs::path root = source;
+    if (source == "generate") {
+        root = work / "loose";
+        fs::remove_all(root);
+        GenerateAssets(root, fileCount);
+    }
+
+    std::vector<std::string> names;
+    for (const auto &item: fs::recursive_directory_iterator(root)) {
+        if (item.is_regular_file()) names.push_back(NormalizeAssetPath(fs::relative(item.path(), root).generic_string()));
+    }
+
+    fs::create_directories(work);
+    const std::string storedPack = (work / "stored.mpak").string(), lz4Pack = (work / "lz4.mpak").string();
+
+    PackBuildOptions stored;
+    stored.compression = PackCompressionMode::None;
+    PackBuildStats storedStats = BuildPackFile(root.string(), storedPack, stored);
+    PackBuildStats lz4Stats = BuildPackFile(root.string(), lz4Pack);
+
+    std::cout << names.size() << " files, " << storedStats.inputBytes / (1024.0 * 1024.0) << " MiB; LZ4 pack "
+              << lz4Stats.packBytes / (1024.0 * 1024.0) << " MiB with " << lz4Stats.compressed << " files compressed\n";
+
+    auto measure = [&](const std::vector<fs::path> &evict, const std::function<uint64_t()> &load) {
+        Run run;
+        for (const fs::path &path: evict) Evict(path);
+
+        auto start = std::chrono::steady_clock::now();
+        run.checksum = load();
+        run.coldMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        load();
+        run.warmMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return run;
+    };
+
+    std::vector<fs::path> looseFiles;
+    for (const std::string &name: names) looseFiles.push_back(root / name);
+
+    Run ifstreamRun = measure(looseFiles, [&]() {
+        uint64_t sum = 0;
+        for (const fs::path &path: looseFiles) {
+            std::ifstream file(path, std::ios::binary);
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            sum += Touch(buffer.str());
+        }
+        return sum;
+    });
+
+    Run looseRun = measure(looseFiles, [&]() {
+        Vfs vfs;
+        vfs.AddLooseRoot(root.string());
+        uint64_t sum = 0;
+        for (const std::string &name: names) sum += Touch(vfs.Read(name).Text());
+        return sum;
+    });
+
+    VfsStats lz4Vfs;
+    auto packRun = [&](const std::string &pack, VfsStats *statsOut) {
+        return measure({pack}, [&]() {
+            Vfs vfs;
+            vfs.Mount(pack);
+            uint64_t sum = 0;
+            for (const std::string &name: names) sum += Touch(vfs.Read(name).Text());
+            if (statsOut) *statsOut = vfs.GetStats();
+            return sum;
+        });
+    };
+    Run storedRun = packRun(storedPack, nullptr);
+    Run lz4Run = packRun(lz4Pack, &lz4Vfs);
+
+    auto report = [&](const char *label, const Run &run) {
+        std::cout << label << ": cold " << run.coldMs << " ms, warm " << run.warmMs << " ms ("
+                  << storedStats.inputBytes / (1024.0 * 1024.0) / (run.warmMs / 1000.0) << " MiB/s warm)"
+                  << (run.checksum == ifstreamRun.checksum ? "" : ", CHECKSUM MISMATCH") << '\n';
+    };
+    report("loose ifstream   ", ifstreamRun);
+    report("vfs loose (mmap) ", looseRun);
+    report("pack stored      ", storedRun);
+    report("pack lz4         ", lz4Run);
+    std::cout << "lz4 decompression: " << lz4Vfs.decompressedReads << " files, " << lz4Vfs.decompressMs << " ms of the warm run\n";
+
+    return 0;
+}
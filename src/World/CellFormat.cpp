@@ -0,0 +1,113 @@
+#include "CellFormat.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    bool SectionFits(uint64_t offset, uint64_t count, uint64_t recordSize, uint64_t fileSize) {
+        if (offset % CellFileAlignment != 0 || offset > fileSize) {
+            return false;
+        }
+
+        return count <= (fileSize - offset) / recordSize;
+    }
+
+    uint64_t AlignUp(uint64_t value) {
+        return (value + CellFileAlignment - 1) / CellFileAlignment * CellFileAlignment;
+    }
+}
+
+std::string CellPath(glm::ivec2 cell) {
+    return "cells/" + std::to_string(cell.x) + "_" + std::to_string(cell.y) + ".mcell";
+}
+
+CellChunk::CellChunk(FileData data) : file(std::move(data)) {
+    auto fail = [this](const std::string &what) {
+        throw std::runtime_error("Invalid Cell File " + file.Path() + ": " + what);
+    };
+
+    if (file.Size() < sizeof(CellFileHeader)) fail("Truncated Header");
+
+    header = reinterpret_cast<const CellFileHeader *>(file.Data());
+    const CellFileHeader &h = *header;
+    const uint64_t size = file.Size();
+
+    if (h.magic != CellFileMagic) fail("Bad Magic");
+    if (h.version != CellFileVersion) fail("Unsupported Version " + std::to_string(h.version));
+    if (h.fileSize != size) fail("Size Mismatch");
+
+    if (!SectionFits(h.meshOffset, h.meshCount, sizeof(CellBlobRecord), size)) fail("Mesh Section Out of Bounds");
+    if (!SectionFits(h.textureOffset, h.textureCount, sizeof(CellBlobRecord), size)) fail("Texture Section Out of Bounds");
+    if (!SectionFits(h.entityOffset, h.entityCount, sizeof(CellEntityRecord), size)) fail("Entity Section Out of Bounds");
+
+    for (const auto records: {Meshes(), Textures()}) {
+        for (const CellBlobRecord &blob: records) {
+            if (blob.offset % CellFileAlignment != 0 || blob.offset > size || blob.size > size - blob.offset) fail("Blob Out of Bounds");
+        }
+    }
+
+    for (const CellEntityRecord &entity: Entities()) {
+        if (entity.mesh >= h.meshCount) fail("Entity Mesh Out of Range");
+        if (entity.texture != CellNoTexture && entity.texture >= h.textureCount) fail("Entity Texture Out of Range");
+    }
+}
+
+FileData CellChunk::Blob(const CellBlobRecord &record) const {
+    const std::string name(record.name, strnlen(record.name, sizeof(record.name)));
+    return file.Slice(record.offset, record.size, file.Path() + ":" + name);
+}
+
+void WriteCellFile(const std::string &path, const CellContents &contents) {
+    CellFileHeader header{};
+    header.magic = CellFileMagic;
+    header.version = CellFileVersion;
+    header.cellX = contents.cell.x;
+    header.cellZ = contents.cell.y;
+    header.meshCount = static_cast<uint32_t>(contents.meshes.size());
+    header.textureCount = static_cast<uint32_t>(contents.textures.size());
+    header.entityCount = static_cast<uint32_t>(contents.entities.size());
+
+    uint64_t offset = AlignUp(sizeof(CellFileHeader));
+    header.meshOffset = offset;
+    offset = AlignUp(offset + contents.meshes.size() * sizeof(CellBlobRecord));
+    header.textureOffset = offset;
+    offset = AlignUp(offset + contents.textures.size() * sizeof(CellBlobRecord));
+    header.entityOffset = offset;
+    offset = AlignUp(offset + contents.entities.size() * sizeof(CellEntityRecord));
+
+    std::vector<CellBlobRecord> records;
+    for (const auto *blobs: {&contents.meshes, &contents.textures}) {
+        for (const CellBlob &blob: *blobs) {
+            CellBlobRecord record{};
+            record.offset = offset;
+            record.size = blob.bytes.size();
+            std::memcpy(record.name, blob.name.data(), std::min(blob.name.size(), sizeof(record.name) - 1));
+            records.push_back(record);
+            offset = AlignUp(offset + blob.bytes.size());
+        }
+    }
+    header.fileSize = offset;
+
+    std::vector<uint8_t> out(offset, 0);
+    std::memcpy(out.data(), &header, sizeof(header));
+    std::memcpy(out.data() + header.meshOffset, records.data(), contents.meshes.size() * sizeof(CellBlobRecord));
+    std::memcpy(out.data() + header.textureOffset, records.data() + contents.meshes.size(), contents.textures.size() * sizeof(CellBlobRecord));
+    std::memcpy(out.data() + header.entityOffset, contents.entities.data(), contents.entities.size() * sizeof(CellEntityRecord));
+
+    size_t next = 0;
+    for (const auto *blobs: {&contents.meshes, &contents.textures}) {
+        for (const CellBlob &blob: *blobs) {
+            std::memcpy(out.data() + records[next++].offset, blob.bytes.data(), blob.bytes.size());
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Failed to Write Cell File: " + path);
+    }
+
+    file.write(reinterpret_cast<const char *>(out.data()), static_cast<std::streamsize>(out.size()));
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../Core/FileData.h"
+
+// One streamable world cell (.mcell): everything the cell needs in a single read. A header, then 16-byte aligned
+// arrays of blob records for its meshes (embedded .mmesh files) and textures (encoded images), its entity records,
+// and the blobs themselves. Offsets are from the start of the file, as in MeshFormat.h.
+
+constexpr uint32_t CellFileMagic = 0x4c45434d;    // "MCEL"
+constexpr uint32_t CellFileVersion = 1;
+constexpr uint32_t CellFileAlignment = 16;
+constexpr uint32_t CellNoTexture = ~0u;
+
+struct CellFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t cellX;
+    int32_t cellZ;
+    uint32_t meshCount;
+    uint32_t textureCount;
+    uint32_t entityCount;
+    uint32_t reserved;
+    uint64_t meshOffset;
+    uint64_t textureOffset;
+    uint64_t entityOffset;
+    uint64_t fileSize;
+};
+
+struct CellBlobRecord {
+    uint64_t offset;
+    uint64_t size;
+    char name[48];
+};
+
+struct CellEntityRecord {
+    float position[3];                        // world space
+    float yaw;                                // degrees
+    float scale;
+    uint32_t mesh;
+    uint32_t texture;                         // or CellNoTexture
+    uint32_t flags;
+};
+
+static_assert(sizeof(CellFileHeader) == 64);
+static_assert(sizeof(CellBlobRecord) == 64);
+static_assert(sizeof(CellEntityRecord) == 32);
+
+// Asset path of a cell: "cells/<x>_<z>.mcell"
+std::string CellPath(glm::ivec2 cell);
+
+// Validated view of a cell chunk. Throws std::runtime_error if the data is malformed.
+class CellChunk {
+public:
+    explicit CellChunk(FileData data);
+
+    const CellFileHeader &Header() const { return *header; }
+    glm::ivec2 Cell() const { return {header->cellX, header->cellZ}; }
+    size_t Size() const { return file.Size(); }
+
+    std::span<const CellBlobRecord> Meshes() const { return {Array<CellBlobRecord>(header->meshOffset), header->meshCount}; }
+    std::span<const CellBlobRecord> Textures() const { return {Array<CellBlobRecord>(header->textureOffset), header->textureCount}; }
+    std::span<const CellEntityRecord> Entities() const { return {Array<CellEntityRecord>(header->entityOffset), header->entityCount}; }
+
+    // A blob as its own file, sharing this chunk's buffer (a mesh blob can go straight to MeshFile)
+    FileData Blob(const CellBlobRecord &record) const;
+
+private:
+    template<typename T>
+    const T *Array(uint64_t offset) const { return reinterpret_cast<const T *>(file.Data() + offset); }
+
+    FileData file;
+    const CellFileHeader *header = nullptr;
+};
+
+struct CellBlob {
+    std::string name;
+    std::vector<uint8_t> bytes;
+};
+
+struct CellContents {
+    glm::ivec2 cell = glm::ivec2(0);
+    std::vector<CellBlob> meshes;
+    std::vector<CellBlob> textures;
+    std::vector<CellEntityRecord> entities;
+};
+
+void WriteCellFile(const std::string &path, const CellContents &contents);
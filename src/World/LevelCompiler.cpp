@@ -0,0 +1,120 @@
+#include "LevelCompiler.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "../Asset/Json.h"
+#include "../Asset/MeshFormat.h"
+#include "../Physics/SurfaceMaterial.h"
+
+namespace {
+    std::string ReadTextFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            throw std::runtime_error("Failed to Open Level Source: " + path);
+        }
+
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    bool SameName(const std::string &a, const std::string &b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+}
+
+LevelContents LoadLevelSource(const std::string &sourcePath, const std::string &assetRoot) {
+    auto fail = [&sourcePath](const std::string &what) {
+        throw std::runtime_error("Invalid Level Source " + sourcePath + ": " + what);
+    };
+
+    JsonValue json;
+    try {
+        json = JsonValue::Parse(ReadTextFile(sourcePath));
+    } catch (const std::runtime_error &ex) {
+        fail(ex.what());
+    }
+    if (!json.IsObject()) fail("Root Is Not an Object");
+
+    LevelContents contents;
+    contents.cellSize = static_cast<float>(json.NumberOr("cellSize", contents.cellSize));
+    if (!(contents.cellSize > 0.0f)) fail("Bad Cell Size");
+
+    const std::vector<SurfaceMaterial> &materials = DefaultSurfaceMaterials();
+    std::unordered_map<std::string, uint32_t> meshIndex;
+
+    auto meshFor = [&](const std::string &name, const std::string &where) {
+        if (auto it = meshIndex.find(name); it != meshIndex.end()) return it->second;
+
+        LevelMesh mesh;
+        mesh.name = name;
+        if (name != LevelBoxMesh) {
+            try {
+                MeshFile file(assetRoot.empty() ? name : assetRoot + "/" + name);
+                mesh.boundsMin = glm::vec3(file.Header().boundsMin[0], file.Header().boundsMin[1], file.Header().boundsMin[2]);
+                mesh.boundsMax = glm::vec3(file.Header().boundsMax[0], file.Header().boundsMax[1], file.Header().boundsMax[2]);
+            } catch (const std::runtime_error &ex) {
+                fail(where + ": " + ex.what());
+            }
+        }
+
+        const uint32_t index = static_cast<uint32_t>(contents.meshes.size());
+        contents.meshes.push_back(std::move(mesh));
+        meshIndex.emplace(name, index);
+        return index;
+    };
+
+    const JsonValue &objects = json["objects"];
+    if (!objects.IsArray()) fail("Missing \"objects\" Array");
+
+    for (size_t i = 0; i < objects.Size(); i++) {
+        const JsonValue &source = objects[i];
+        const std::string where = "Object " + source.StringOr("name", std::to_string(i));
+
+        auto vec3 = [&](std::string_view key, glm::vec3 fallback) {
+            const JsonValue &value = source[key];
+            if (value.IsNull()) return fallback;
+            if (!value.IsArray() || value.Size() != 3 || !value[0].IsNumber() || !value[1].IsNumber() || !value[2].IsNumber()) {
+                fail(where + ": \"" + std::string(key) + "\" Is Not Three Numbers");
+            }
+            return glm::vec3(value[0].AsNumber(), value[1].AsNumber(), value[2].AsNumber());
+        };
+        auto flag = [&](std::string_view key, bool fallback) {
+            const JsonValue &value = source[key];
+            if (value.IsNull()) return fallback;
+            if (value.GetType() != JsonValue::Type::Bool) fail(where + ": \"" + std::string(key) + "\" Is Not a Bool");
+            return value.AsBool();
+        };
+
+        if (!source.IsObject() || !source["mesh"].IsString()) fail(where + ": Missing \"mesh\"");
+
+        const glm::vec3 position = vec3("position", glm::vec3(0.0f));
+        const glm::vec3 rotation = glm::radians(vec3("rotation", glm::vec3(0.0f)));
+        const glm::vec3 scale = vec3("scale", glm::vec3(1.0f));
+
+        LevelObject object;
+        object.transform = glm::translate(glm::mat4(1.0f), position);
+        object.transform = glm::rotate(object.transform, rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
+        object.transform = glm::rotate(object.transform, rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
+        object.transform = glm::rotate(object.transform, rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+        object.transform = glm::scale(object.transform, scale);
+        object.mesh = meshFor(source["mesh"].AsString(), where);
+
+        const std::string material = source.StringOr("material", materials[MaterialConcrete].name);
+        auto found = std::find_if(materials.begin(), materials.end(), [&](const SurfaceMaterial &m) { return SameName(m.name, material); });
+        if (found == materials.end() || found - materials.begin() == MaterialFlesh) fail(where + ": Unknown Material " + material);
+        object.material = static_cast<uint32_t>(found - materials.begin());
+
+        object.flags = (flag("visible", true) ? LevelObjectVisible : 0u) | (flag("collides", true) ? LevelObjectCollides : 0u);
+        contents.objects.push_back(object);
+    }
+
+    return contents;
+}
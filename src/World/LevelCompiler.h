@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "LevelFormat.h"
+
+// Reads a JSON level source into LevelContents, ready for WriteLevelFile. The source is
+//
+//   {
+//     "cellSize": 64,
+//     "objects": [
+//       { "name": "floor", "mesh": "box", "position": [0, -1, 0], "rotation": [0, 0, 0], "scale": [10, 0.1, 10],
+//         "material": "Concrete", "visible": true, "collides": true }
+//     ]
+//   }
+//
+// where rotation is degrees about x, y and z (applied yaw, then pitch, then roll), material is a surface material name
+// (see SurfaceMaterial.h) and everything but mesh is optional. A mesh other than "box" is a .mmesh path under assetRoot,
+// opened for its bounds. Throws std::runtime_error naming the source and the offending object.
+LevelContents LoadLevelSource(const std::string &sourcePath, const std::string &assetRoot);
@@ -0,0 +1,234 @@
+#include "LevelFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "../Physics/SurfaceMaterial.h"
+
+namespace {
+    bool SectionFits(uint64_t offset, uint64_t count, uint64_t recordSize, uint64_t fileSize) {
+        if (offset % LevelFileAlignment != 0 || offset > fileSize) {
+            return false;
+        }
+
+        return count <= (fileSize - offset) / recordSize;
+    }
+
+    uint64_t AlignUp(uint64_t value) {
+        return (value + LevelFileAlignment - 1) / LevelFileAlignment * LevelFileAlignment;
+    }
+
+    bool Finite(const float *values, size_t count) {
+        return std::all_of(values, values + count, [](float v) { return std::isfinite(v); });
+    }
+
+    glm::ivec2 CellOf(const LevelBounds &bounds, float cellSize) {
+        const glm::vec2 center(bounds.min[0] + bounds.max[0], bounds.min[2] + bounds.max[2]);
+        return glm::ivec2(glm::floor(center * 0.5f / cellSize));
+    }
+}
+
+glm::mat4 ToMat4(const LevelTransform &transform) {
+    glm::mat4 m(1.0f);
+    for (int c = 0; c < 4; c++) m[c] = glm::vec4(transform.columns[c][0], transform.columns[c][1], transform.columns[c][2], c == 3 ? 1.0f : 0.0f);
+    return m;
+}
+
+LevelFile::LevelFile(const std::string &path) : LevelFile(FileData::Map(path)) {
+}
+
+LevelFile::LevelFile(FileData data) : file(std::move(data)) {
+    auto fail = [this](const std::string &what) {
+        throw std::runtime_error("Invalid Level File " + file.Path() + ": " + what);
+    };
+
+    if (file.Size() < sizeof(LevelFileHeader)) fail("Truncated Header");
+
+    header = reinterpret_cast<const LevelFileHeader *>(file.Data());
+    const LevelFileHeader &h = *header;
+    const uint64_t size = file.Size();
+
+    if (h.magic != LevelFileMagic) fail("Bad Magic");
+    if (h.version != LevelFileVersion) fail("Unsupported Version " + std::to_string(h.version));
+    if (h.fileSize != size) fail("Size Mismatch");
+    if (!(h.cellSize > 0.0f) || !std::isfinite(h.cellSize)) fail("Bad Cell Size");
+
+    if (!SectionFits(h.transformOffset, h.objectCount, sizeof(LevelTransform), size)) fail("Transform Section Out of Bounds");
+    if (!SectionFits(h.boundsOffset, h.objectCount, sizeof(LevelBounds), size)) fail("Bounds Section Out of Bounds");
+    if (!SectionFits(h.meshRefOffset, h.objectCount, sizeof(uint32_t), size)) fail("Mesh Reference Section Out of Bounds");
+    if (!SectionFits(h.objectInfoOffset, h.objectCount, sizeof(LevelObjectInfo), size)) fail("Object Section Out of Bounds");
+    if (!SectionFits(h.meshOffset, h.meshCount, sizeof(LevelMeshRecord), size)) fail("Mesh Section Out of Bounds");
+    if (!SectionFits(h.cellOffset, h.cellCount, sizeof(LevelCellRecord), size)) fail("Cell Section Out of Bounds");
+    if (!SectionFits(h.stringOffset, h.stringSize, 1, size)) fail("String Table Out of Bounds");
+
+    // The fixup: offsets become pointers once, here
+    const uint8_t *base = file.Data();
+    transforms = reinterpret_cast<const LevelTransform *>(base + h.transformOffset);
+    bounds = reinterpret_cast<const LevelBounds *>(base + h.boundsOffset);
+    meshRefs = reinterpret_cast<const uint32_t *>(base + h.meshRefOffset);
+    objectInfo = reinterpret_cast<const LevelObjectInfo *>(base + h.objectInfoOffset);
+    meshes = reinterpret_cast<const LevelMeshRecord *>(base + h.meshOffset);
+    cells = reinterpret_cast<const LevelCellRecord *>(base + h.cellOffset);
+    strings = reinterpret_cast<const char *>(base + h.stringOffset);
+
+    for (const LevelMeshRecord &mesh: Meshes()) {
+        if (mesh.nameOffset > h.stringSize || mesh.nameLength > h.stringSize - mesh.nameOffset) fail("Mesh Name Out of Bounds");
+        if (!Finite(mesh.boundsMin, 3) || !Finite(mesh.boundsMax, 3)) fail("Bad Mesh Bounds");
+    }
+
+    for (uint32_t i = 0; i < h.objectCount; i++) {
+        if (meshRefs[i] >= h.meshCount) fail("Object Mesh Out of Range");
+        if (objectInfo[i].material >= MaterialCount) fail("Object Material Out of Range");
+        if (!Finite(&transforms[i].columns[0][0], 12)) fail("Bad Object Transform");
+        if (!Finite(bounds[i].min, 3) || !Finite(bounds[i].max, 3)) fail("Bad Object Bounds");
+    }
+
+    // Cells partition the objects in order, so a cell's objects are one contiguous run
+    uint64_t next = 0;
+    for (const LevelCellRecord &cell: Cells()) {
+        if (cell.firstObject != next || cell.objectCount > h.objectCount - next) fail("Cell Objects Out of Order");
+        next += cell.objectCount;
+    }
+    if (next != h.objectCount) fail("Cells Do Not Cover Every Object");
+}
+
+std::string_view LevelFile::MeshName(uint32_t mesh) const {
+    return {strings + meshes[mesh].nameOffset, meshes[mesh].nameLength};
+}
+
+std::vector<uint8_t> BuildLevelFile(const LevelContents &contents) {
+    const size_t objectCount = contents.objects.size();
+
+    std::vector<LevelTransform> transforms(objectCount);
+    std::vector<LevelBounds> bounds(objectCount);
+    std::vector<uint32_t> meshRefs(objectCount);
+    std::vector<LevelObjectInfo> objectInfo(objectCount);
+
+    // World AABB of each object: the eight corners of its mesh's local box
+    std::vector<LevelBounds> unsorted(objectCount);
+    for (size_t i = 0; i < objectCount; i++) {
+        const LevelObject &object = contents.objects[i];
+        if (object.mesh >= contents.meshes.size()) {
+            throw std::runtime_error("Level Object " + std::to_string(i) + " References Missing Mesh " + std::to_string(object.mesh));
+        }
+
+        const LevelMesh &mesh = contents.meshes[object.mesh];
+        glm::vec3 lo(INFINITY), hi(-INFINITY);
+        for (int corner = 0; corner < 8; corner++) {
+            const glm::vec3 local(corner & 1 ? mesh.boundsMax.x : mesh.boundsMin.x, corner & 2 ? mesh.boundsMax.y : mesh.boundsMin.y,
+                                  corner & 4 ? mesh.boundsMax.z : mesh.boundsMin.z);
+            const glm::vec3 world = glm::vec3(object.transform * glm::vec4(local, 1.0f));
+            lo = glm::min(lo, world);
+            hi = glm::max(hi, world);
+        }
+        unsorted[i] = {{lo.x, lo.y, lo.z}, {hi.x, hi.y, hi.z}};
+    }
+
+    // Group by cell (z major, then x), keeping authoring order within a cell
+    std::vector<uint32_t> order(objectCount);
+    std::iota(order.begin(), order.end(), 0u);
+    auto cellKey = [&](uint32_t i) {
+        const glm::ivec2 cell = CellOf(unsorted[i], contents.cellSize);
+        return std::make_pair(cell.y, cell.x);
+    };
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return cellKey(a) < cellKey(b); });
+
+    std::vector<LevelCellRecord> cells;
+    glm::vec3 levelMin(0.0f), levelMax(0.0f);
+    for (size_t slot = 0; slot < objectCount; slot++) {
+        const uint32_t i = order[slot];
+        const LevelObject &object = contents.objects[i];
+
+        for (int c = 0; c < 4; c++) {
+            for (int r = 0; r < 3; r++) transforms[slot].columns[c][r] = object.transform[c][r];
+        }
+        bounds[slot] = unsorted[i];
+        meshRefs[slot] = object.mesh;
+        objectInfo[slot] = {object.material, object.flags};
+
+        const glm::vec3 lo(bounds[slot].min[0], bounds[slot].min[1], bounds[slot].min[2]);
+        const glm::vec3 hi(bounds[slot].max[0], bounds[slot].max[1], bounds[slot].max[2]);
+        levelMin = slot == 0 ? lo : glm::min(levelMin, lo);
+        levelMax = slot == 0 ? hi : glm::max(levelMax, hi);
+
+        const glm::ivec2 cell = CellOf(bounds[slot], contents.cellSize);
+        if (cells.empty() || cells.back().x != cell.x || cells.back().z != cell.y) {
+            cells.push_back({cell.x, cell.y, static_cast<uint32_t>(slot), 0});
+        }
+        cells.back().objectCount++;
+    }
+
+    std::string strings;
+    std::vector<LevelMeshRecord> meshes;
+    for (const LevelMesh &mesh: contents.meshes) {
+        LevelMeshRecord record{};
+        record.nameOffset = static_cast<uint32_t>(strings.size());
+        record.nameLength = static_cast<uint32_t>(mesh.name.size());
+        for (int a = 0; a < 3; a++) {
+            record.boundsMin[a] = mesh.boundsMin[a];
+            record.boundsMax[a] = mesh.boundsMax[a];
+        }
+        strings += mesh.name;
+        meshes.push_back(record);
+    }
+
+    LevelFileHeader header{};
+    header.magic = LevelFileMagic;
+    header.version = LevelFileVersion;
+    header.objectCount = static_cast<uint32_t>(objectCount);
+    header.meshCount = static_cast<uint32_t>(meshes.size());
+    header.cellCount = static_cast<uint32_t>(cells.size());
+    header.cellSize = contents.cellSize;
+    for (int a = 0; a < 3; a++) {
+        header.boundsMin[a] = levelMin[a];
+        header.boundsMax[a] = levelMax[a];
+    }
+
+    uint64_t offset = AlignUp(sizeof(LevelFileHeader));
+    header.transformOffset = offset;
+    offset = AlignUp(offset + objectCount * sizeof(LevelTransform));
+    header.boundsOffset = offset;
+    offset = AlignUp(offset + objectCount * sizeof(LevelBounds));
+    header.meshRefOffset = offset;
+    offset = AlignUp(offset + objectCount * sizeof(uint32_t));
+    header.objectInfoOffset = offset;
+    offset = AlignUp(offset + objectCount * sizeof(LevelObjectInfo));
+    header.meshOffset = offset;
+    offset = AlignUp(offset + meshes.size() * sizeof(LevelMeshRecord));
+    header.cellOffset = offset;
+    offset = AlignUp(offset + cells.size() * sizeof(LevelCellRecord));
+    header.stringOffset = offset;
+    header.stringSize = strings.size();
+    offset = AlignUp(offset + strings.size());
+    header.fileSize = offset;
+
+    std::vector<uint8_t> out(offset, 0);
+    auto put = [&out](uint64_t at, const void *data, size_t bytes) {
+        if (bytes) std::memcpy(out.data() + at, data, bytes);
+    };
+    put(0, &header, sizeof(header));
+    put(header.transformOffset, transforms.data(), objectCount * sizeof(LevelTransform));
+    put(header.boundsOffset, bounds.data(), objectCount * sizeof(LevelBounds));
+    put(header.meshRefOffset, meshRefs.data(), objectCount * sizeof(uint32_t));
+    put(header.objectInfoOffset, objectInfo.data(), objectCount * sizeof(LevelObjectInfo));
+    put(header.meshOffset, meshes.data(), meshes.size() * sizeof(LevelMeshRecord));
+    put(header.cellOffset, cells.data(), cells.size() * sizeof(LevelCellRecord));
+    put(header.stringOffset, strings.data(), strings.size());
+    return out;
+}
+
+void WriteLevelFile(const std::string &path, const LevelContents &contents) {
+    const std::vector<uint8_t> out = BuildLevelFile(contents);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Failed to Write Level File: " + path);
+    }
+
+    file.write(reinterpret_cast<const char *>(out.data()), static_cast<std::streamsize>(out.size()));
+}
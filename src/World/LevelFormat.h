@@ -0,0 +1,150 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Core/FileData.h"
+
+// Cooked level (.mlvl), compiled from a JSON source by the LevelCompiler tool. The file is the in-memory layout: a
+// header, then 16-byte aligned flat arrays indexed by object (transforms, world AABBs, mesh references, material and
+// flags), the mesh table, the cell table and a string table. Every reference is an offset (from the start of the file
+// for sections, into the string table for names) rather than a pointer, so loading is a map plus validation; LevelFile
+// resolves the offsets once and hands out typed spans into the mapping.
+//
+// Objects are sorted by the cell their AABB centre falls in, so each cell record covers a contiguous run of objects.
+
+constexpr uint32_t LevelFileMagic = 0x4c564c4d;   // "MLVL"
+constexpr uint32_t LevelFileVersion = 1;
+constexpr uint32_t LevelFileAlignment = 16;
+
+// Mesh name of the unit cube [-0.5, 0.5]^3 the render loop and StaticGeometry::AddBox draw and collide with; any
+// other name is the asset path of a .mmesh
+constexpr std::string_view LevelBoxMesh = "box";
+
+enum LevelObjectFlags : uint32_t {
+    LevelObjectVisible = 1u << 0,
+    LevelObjectCollides = 1u << 1,
+};
+
+struct LevelFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t objectCount;
+    uint32_t meshCount;
+    uint32_t cellCount;
+    float cellSize;                           // metres, on x and z
+    float boundsMin[3];                       // of every object
+    float boundsMax[3];
+    uint32_t reserved[2];
+    uint64_t transformOffset;                 // LevelTransform per object
+    uint64_t boundsOffset;                    // LevelBounds per object
+    uint64_t meshRefOffset;                   // uint32 mesh index per object
+    uint64_t objectInfoOffset;                // LevelObjectInfo per object
+    uint64_t meshOffset;                      // LevelMeshRecord per mesh
+    uint64_t cellOffset;                      // LevelCellRecord per cell
+    uint64_t stringOffset;
+    uint64_t stringSize;
+    uint64_t fileSize;
+};
+
+// Affine local -> world: the first three columns of a glm::mat4, then the translation
+struct LevelTransform {
+    float columns[4][3];
+};
+
+struct LevelBounds {
+    float min[3];
+    float max[3];
+};
+
+struct LevelObjectInfo {
+    uint32_t material;                        // SurfaceMaterialId
+    uint32_t flags;                           // LevelObjectFlags
+};
+
+struct LevelMeshRecord {
+    uint32_t nameOffset;                      // into the string table
+    uint32_t nameLength;
+    float boundsMin[3];                       // local space
+    float boundsMax[3];
+};
+
+struct LevelCellRecord {
+    int32_t x;
+    int32_t z;
+    uint32_t firstObject;
+    uint32_t objectCount;
+};
+
+static_assert(sizeof(LevelFileHeader) == 128);
+static_assert(sizeof(LevelTransform) == 48);
+static_assert(sizeof(LevelBounds) == 24);
+static_assert(sizeof(LevelObjectInfo) == 8);
+static_assert(sizeof(LevelMeshRecord) == 32);
+static_assert(sizeof(LevelCellRecord) == 16);
+
+glm::mat4 ToMat4(const LevelTransform &transform);
+
+// Validated view of a cooked level. Throws std::runtime_error if the data is malformed; after that nothing is checked
+// again, every span and name points straight into the file's bytes.
+class LevelFile {
+public:
+    // Maps a filesystem path; the game loads through the VFS and hands over the bytes instead
+    explicit LevelFile(const std::string &path);
+    explicit LevelFile(FileData data);
+
+    const LevelFileHeader &Header() const { return *header; }
+    size_t ObjectCount() const { return header->objectCount; }
+    size_t Size() const { return file.Size(); }
+    const std::string &Path() const { return file.Path(); }
+
+    std::span<const LevelTransform> Transforms() const { return {transforms, header->objectCount}; }
+    std::span<const LevelBounds> Bounds() const { return {bounds, header->objectCount}; }
+    std::span<const uint32_t> MeshRefs() const { return {meshRefs, header->objectCount}; }
+    std::span<const LevelObjectInfo> ObjectInfo() const { return {objectInfo, header->objectCount}; }
+    std::span<const LevelMeshRecord> Meshes() const { return {meshes, header->meshCount}; }
+    std::span<const LevelCellRecord> Cells() const { return {cells, header->cellCount}; }
+
+    std::string_view MeshName(uint32_t mesh) const;
+    bool IsBox(uint32_t mesh) const { return MeshName(mesh) == LevelBoxMesh; }
+
+private:
+    FileData file;
+    const LevelFileHeader *header = nullptr;
+    const LevelTransform *transforms = nullptr;
+    const LevelBounds *bounds = nullptr;
+    const uint32_t *meshRefs = nullptr;
+    const LevelObjectInfo *objectInfo = nullptr;
+    const LevelMeshRecord *meshes = nullptr;
+    const LevelCellRecord *cells = nullptr;
+    const char *strings = nullptr;
+};
+
+struct LevelMesh {
+    std::string name;                         // LevelBoxMesh or a .mmesh asset path
+    glm::vec3 boundsMin = glm::vec3(-0.5f);
+    glm::vec3 boundsMax = glm::vec3(0.5f);
+};
+
+struct LevelObject {
+    glm::mat4 transform = glm::mat4(1.0f);
+    uint32_t mesh = 0;
+    uint32_t material = 0;
+    uint32_t flags = LevelObjectVisible | LevelObjectCollides;
+};
+
+struct LevelContents {
+    float cellSize = 64.0f;
+    std::vector<LevelMesh> meshes;
+    std::vector<LevelObject> objects;
+};
+
+// Lays contents out as a .mlvl: computes world AABBs, sorts objects into cells and builds the tables. Throws
+// std::runtime_error if an object references a mesh that is not in contents.meshes.
+std::vector<uint8_t> BuildLevelFile(const LevelContents &contents);
+void WriteLevelFile(const std::string &path, const LevelContents &contents);
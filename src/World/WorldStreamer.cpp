@@ -0,0 +1,305 @@
+#include "WorldStreamer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include "../Asset/Vfs.h"
+#include "../Core/AsyncIo.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double Seconds() {
+        static const Clock::time_point epoch = Clock::now();
+        return std::chrono::duration<double>(Clock::now() - epoch).count();
+    }
+}
+
+WorldStreamer::WorldStreamer(AsyncIo &io, const Vfs &vfs, std::vector<glm::ivec2> cellList, const WorldStreamerSettings &settings,
+                             CellCallbacks callbacks)
+    : io(io), vfs(vfs), settings(settings), callbacks(std::move(callbacks)) {
+    for (glm::ivec2 cell: cellList) known.insert(Key(cell));
+    stats.knownCells = known.size();
+}
+
+WorldStreamer::~WorldStreamer() {
+    // Reads in flight call back into this object
+    WaitForLoads();
+
+    for (Arrival &arrival: arrivals) {
+        if (arrival.error.empty() && callbacks.release) callbacks.release(*arrival.cell);
+    }
+    for (auto &[key, cell]: cells) {
+        if (cell->state != CellState::Loading && callbacks.release) callbacks.release(*cell);
+    }
+}
+
+std::vector<glm::ivec2> WorldStreamer::FindCells(const Vfs &vfs, int radius) {
+    std::vector<glm::ivec2> found;
+    for (int z = -radius; z <= radius; z++) {
+        for (int x = -radius; x <= radius; x++) {
+            if (vfs.Exists(CellPath({x, z}))) found.emplace_back(x, z);
+        }
+    }
+    return found;
+}
+
+uint64_t WorldStreamer::Key(glm::ivec2 cell) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32 | static_cast<uint32_t>(cell.y);
+}
+
+float WorldStreamer::Priority(glm::ivec2 cell, const glm::vec3 &camera, const glm::vec3 &forward) const {
+    const glm::vec2 offset = (glm::vec2(cell) + 0.5f) * settings.cellSize - glm::vec2(camera.x, camera.z);
+    const float distance = glm::length(offset);
+    const glm::vec2 view(forward.x, forward.z);
+    if (distance < 1e-3f || glm::dot(view, view) < 1e-6f) return distance;
+
+    // 1 straight ahead, -1 straight behind
+    const float facing = glm::dot(offset / distance, glm::normalize(view));
+    return distance * (1.0f + settings.viewWeight * 0.5f * (1.0f - facing));
+}
+
+uint64_t WorldStreamer::Total(uint64_t StreamedCell::*bytes) const {
+    uint64_t total = 0;
+    for (const auto &[key, cell]: cells) total += (*cell).*bytes;
+    return total;
+}
+
+void WorldStreamer::Drop(uint64_t key) {
+    auto it = cells.find(key);
+    if (it == cells.end()) return;
+
+    if (it->second->state != CellState::Loading && callbacks.release) callbacks.release(*it->second);
+    cells.erase(it);
+}
+
+bool WorldStreamer::MakeRoom(uint64_t StreamedCell::*bytes, uint64_t budget, uint64_t needed, float priority, uint64_t keep) {
+    uint64_t total = Total(bytes);
+    if (total + needed <= budget) return true;
+
+    // Only cells that rank worse give way, and only if together they free enough; otherwise nothing is evicted
+    std::vector<std::pair<float, uint64_t>> victims;
+    uint64_t freeable = 0;
+    for (const auto &[key, cell]: cells) {
+        if (key == keep || cell->state == CellState::Loading || cell->priority <= priority || (*cell).*bytes == 0) continue;
+        victims.emplace_back(cell->priority, key);
+        freeable += (*cell).*bytes;
+    }
+    if (total + needed > budget + freeable) return false;
+
+    std::sort(victims.begin(), victims.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (const auto &[victimPriority, key]: victims) {
+        if (total + needed <= budget) break;
+        total -= (*cells[key]).*bytes;
+        Drop(key);
+        stats.evicted++;
+    }
+    return true;
+}
+
+void WorldStreamer::Request(glm::ivec2 cell, float priority) {
+    const double requestedAt = Seconds();
+
+    auto placeholder = std::make_unique<StreamedCell>();
+    placeholder->cell = cell;
+    placeholder->priority = priority;
+    placeholder->ramBytes = loadedChunkCount ? loadedChunkBytes / loadedChunkCount : 0;
+    placeholder->requestedAt = requestedAt;
+    cells[Key(cell)] = std::move(placeholder);
+
+    {
+        std::lock_guard lock(arrivalMutex);
+        inFlight++;
+    }
+    stats.requested++;
+
+    // Runs on a decode job: validate the chunk and let the client decode it before it reaches the frame
+    vfs.QueueRead(io, CellPath(cell), [this, cell, requestedAt](FileData &data, const std::string &error) {
+        Arrival arrival;
+        arrival.cell = std::make_unique<StreamedCell>();
+        arrival.cell->cell = cell;
+        arrival.cell->requestedAt = requestedAt;
+        arrival.error = error;
+
+        if (error.empty()) {
+            try {
+                StreamedCell &loaded = *arrival.cell;
+                loaded.chunk.emplace(std::move(data));
+                if (loaded.chunk->Cell() != cell) {
+                    throw std::runtime_error("Cell File Holds the Wrong Cell: " + CellPath(cell));
+                }
+
+                loaded.ramBytes = loaded.chunk->Size();
+                for (const auto records: {loaded.chunk->Meshes(), loaded.chunk->Textures()}) {
+                    for (const CellBlobRecord &blob: records) loaded.vramEstimate += blob.size;
+                }
+                if (callbacks.prepare) callbacks.prepare(loaded);
+            } catch (const std::exception &ex) {
+                arrival.error = ex.what();
+            }
+        }
+
+        std::lock_guard lock(arrivalMutex);
+        arrivals.push_back(std::move(arrival));
+        inFlight--;
+        arrivalSignal.notify_all();
+    });
+}
+
+void WorldStreamer::WaitForLoads() {
+    std::unique_lock lock(arrivalMutex);
+    arrivalSignal.wait(lock, [this]() { return inFlight == 0; });
+}
+
+void WorldStreamer::Update(const glm::vec3 &camera, const glm::vec3 &forward) {
+    auto start = Clock::now();
+    stats.budgetDeferred = 0;
+
+    std::vector<Arrival> arrived;
+    {
+        std::lock_guard lock(arrivalMutex);
+        arrived.swap(arrivals);
+    }
+
+    // Distance first: anything past the unload radius goes regardless of budget, and everything else is re-ranked
+    for (auto it = cells.begin(); it != cells.end();) {
+        StreamedCell &cell = *it->second;
+        const glm::vec2 offset = (glm::vec2(cell.cell) + 0.5f) * settings.cellSize - glm::vec2(camera.x, camera.z);
+        if (glm::length(offset) > settings.unloadRadius) {
+            if (cell.state == CellState::Loading) {
+                cell.cancelled = true;
+            } else {
+                if (callbacks.release) callbacks.release(cell);
+                it = cells.erase(it);
+                stats.unloaded++;
+                continue;
+            }
+        }
+        cell.priority = Priority(cell.cell, camera, forward);
+        ++it;
+    }
+
+    for (Arrival &arrival: arrived) {
+        const uint64_t key = Key(arrival.cell->cell);
+        auto it = cells.find(key);
+
+        if (!arrival.error.empty()) {
+            std::cerr << arrival.error << ", Cell Skipped\n";
+            failedCells.insert(key);
+            if (it != cells.end()) cells.erase(it);
+            stats.failed++;
+            continue;
+        }
+
+        if (it == cells.end() || it->second->cancelled) {
+            if (callbacks.release) callbacks.release(*arrival.cell);
+            if (it != cells.end()) cells.erase(it);
+            stats.unloaded++;
+            continue;
+        }
+
+        loadedChunkBytes += arrival.cell->chunk->Size();
+        loadedChunkCount++;
+        arrival.cell->priority = it->second->priority;
+        arrival.cell->state = CellState::Loaded;
+        it->second = std::move(arrival.cell);
+
+        // The request went out on an estimate; if the real chunk does not fit, it is the one that waits
+        if (!MakeRoom(&StreamedCell::ramBytes, settings.ramBudget, 0, it->second->priority, key)) {
+            Drop(key);
+            stats.budgetDeferred++;
+        }
+    }
+
+    // Wanted cells, best first
+    std::vector<std::pair<float, glm::ivec2>> wanted;
+    const glm::ivec2 lo(glm::floor((glm::vec2(camera.x, camera.z) - settings.loadRadius) / settings.cellSize));
+    const glm::ivec2 hi(glm::floor((glm::vec2(camera.x, camera.z) + settings.loadRadius) / settings.cellSize));
+    for (int z = lo.y; z <= hi.y; z++) {
+        for (int x = lo.x; x <= hi.x; x++) {
+            const glm::ivec2 cell(x, z);
+            const glm::vec2 offset = (glm::vec2(cell) + 0.5f) * settings.cellSize - glm::vec2(camera.x, camera.z);
+            if (glm::length(offset) > settings.loadRadius || !known.count(Key(cell))) continue;
+            wanted.emplace_back(Priority(cell, camera, forward), cell);
+        }
+    }
+    std::sort(wanted.begin(), wanted.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    size_t loading = 0;
+    for (const auto &[key, cell]: cells) loading += cell->state == CellState::Loading;
+
+    bool queued = false, ramFull = false;
+    for (const auto &[priority, cell]: wanted) {
+        const uint64_t key = Key(cell);
+        auto it = cells.find(key);
+        if (it != cells.end()) {
+            it->second->cancelled = false;
+            continue;
+        }
+        if (failedCells.count(key) || loading >= settings.maxLoadsInFlight) continue;
+
+        const uint64_t estimate = loadedChunkCount ? loadedChunkBytes / loadedChunkCount : 0;
+        if (ramFull || !MakeRoom(&StreamedCell::ramBytes, settings.ramBudget, estimate, priority, key)) {
+            ramFull = true;
+            stats.budgetDeferred++;
+            continue;
+        }
+
+        Request(cell, priority);
+        loading++;
+        queued = true;
+    }
+    if (queued) io.Submit();
+
+    // Uploads, best first and a few per frame
+    std::vector<std::pair<float, uint64_t>> uploads;
+    for (const auto &[key, cell]: cells) {
+        if (cell->state == CellState::Loaded) uploads.emplace_back(cell->priority, key);
+    }
+    std::sort(uploads.begin(), uploads.end());
+
+    unsigned uploaded = 0;
+    for (const auto &[priority, key]: uploads) {
+        if (uploaded >= settings.maxUploadsPerUpdate) break;
+
+        auto it = cells.find(key);
+        if (it == cells.end()) continue;
+        if (!MakeRoom(&StreamedCell::vramBytes, settings.vramBudget, it->second->vramEstimate, priority, key)) {
+            stats.budgetDeferred++;
+            continue;
+        }
+
+        StreamedCell &cell = *it->second;
+        if (callbacks.upload) callbacks.upload(cell);
+        cell.state = CellState::Resident;
+        uploaded++;
+        stats.uploaded++;
+
+        const double loadMs = (Seconds() - cell.requestedAt) * 1000.0;
+        totalLoadMs += loadMs;
+        stats.averageLoadMs = totalLoadMs / static_cast<double>(stats.uploaded);
+        stats.worstLoadMs = std::max(stats.worstLoadMs, loadMs);
+    }
+
+    stats.wantedCells = wanted.size();
+    stats.loadingCells = stats.loadedCells = stats.residentCells = stats.missingCells = 0;
+    for (const auto &[key, cell]: cells) {
+        stats.loadingCells += cell->state == CellState::Loading;
+        stats.loadedCells += cell->state == CellState::Loaded;
+        stats.residentCells += cell->state == CellState::Resident;
+    }
+    for (const auto &[priority, cell]: wanted) {
+        auto it = cells.find(Key(cell));
+        stats.missingCells += it == cells.end() || it->second->state != CellState::Resident;
+    }
+
+    stats.ramBytes = Total(&StreamedCell::ramBytes);
+    stats.vramBytes = Total(&StreamedCell::vramBytes);
+    stats.peakRamBytes = std::max(stats.peakRamBytes, stats.ramBytes);
+    stats.peakVramBytes = std::max(stats.peakVramBytes, stats.vramBytes);
+    stats.updateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    stats.worstUpdateMs = std::max(stats.worstUpdateMs, stats.updateMs);
+}
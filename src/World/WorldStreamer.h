@@ -0,0 +1,147 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "CellFormat.h"
+
+class AsyncIo;
+class Vfs;
+
+enum class CellState {
+    Loading,                                  // read in flight
+    Loaded,                                   // chunk in RAM, waiting for its upload
+    Resident,                                 // uploaded
+};
+
+struct StreamedCell {
+    glm::ivec2 cell = glm::ivec2(0);
+    CellState state = CellState::Loading;
+    std::optional<CellChunk> chunk;
+    std::shared_ptr<void> clientData;         // whatever prepare/upload built (decoded textures, GPU meshes)
+    uint64_t ramBytes = 0;                    // chunk plus anything prepare keeps
+    uint64_t vramBytes = 0;                   // what upload created
+    uint64_t vramEstimate = 0;                // expected vramBytes, for the budget check before uploading
+    float priority = 0.0f;                    // view-weighted distance; lower streams first and evicts last
+    bool cancelled = false;                   // left the unload radius while loading
+    double requestedAt = 0.0;                 // seconds, for load latency
+};
+
+// Client side of a cell. prepare runs on the decode job the chunk arrives on (decode textures, validate meshes) and
+// adds what it keeps to ramBytes, and may set vramEstimate (the blob sizes by default); upload and release run on
+// the Update() thread, upload adding to vramBytes. release also gets cells that were prepared but never uploaded.
+struct CellCallbacks {
+    std::function<void(StreamedCell &cell)> prepare;
+    std::function<void(StreamedCell &cell)> upload;
+    std::function<void(StreamedCell &cell)> release;
+};
+
+struct WorldStreamerSettings {
+    float cellSize = 256.0f;
+    float loadRadius = 768.0f;                // cells whose centre is this close are wanted
+    float unloadRadius = 1024.0f;             // and dropped past this, whatever the budget
+    float viewWeight = 1.0f;                  // a cell straight behind the camera counts as 1 + viewWeight times as far
+    uint64_t ramBudget = uint64_t(256) << 20;
+    uint64_t vramBudget = uint64_t(512) << 20;
+    unsigned maxLoadsInFlight = 8;
+    unsigned maxUploadsPerUpdate = 2;         // bounds the GL work one frame takes on
+};
+
+struct WorldStreamerStats {
+    size_t knownCells = 0;
+    size_t wantedCells = 0;                   // within the load radius
+    size_t loadingCells = 0;
+    size_t loadedCells = 0;
+    size_t residentCells = 0;
+    size_t missingCells = 0;                  // wanted but not resident yet
+    size_t budgetDeferred = 0;                // last Update(): wanted cells held back by a budget
+    uint64_t ramBytes = 0;
+    uint64_t vramBytes = 0;
+    uint64_t peakRamBytes = 0;
+    uint64_t peakVramBytes = 0;
+
+    // Totals since construction
+    size_t requested = 0;
+    size_t uploaded = 0;
+    size_t evicted = 0;                       // dropped to make room under a budget
+    size_t unloaded = 0;                      // dropped for distance
+    size_t failed = 0;
+
+    double updateMs = 0.0;                    // last Update()
+    double worstUpdateMs = 0.0;
+    double averageLoadMs = 0.0;               // request to resident
+    double worstLoadMs = 0.0;
+};
+
+// Streams world cells (see CellFormat.h) around the camera. Every Update() ranks the known cells in the load radius
+// by distance, stretched for cells away from the view direction, and requests the best ones through AsyncIo, so a
+// frame only ever queues reads and uploads at most a few finished cells. When a budget would be exceeded, cells
+// that rank worse than the one that needs the room are evicted, worst first; if there are none the better cell waits.
+class WorldStreamer {
+public:
+    WorldStreamer(AsyncIo &io, const Vfs &vfs, std::vector<glm::ivec2> cells, const WorldStreamerSettings &settings = {},
+                  CellCallbacks callbacks = {});
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer &) = delete;
+    WorldStreamer &operator=(const WorldStreamer &) = delete;
+
+    // Cells with a chunk in the VFS within radius cells of the origin
+    static std::vector<glm::ivec2> FindCells(const Vfs &vfs, int radius);
+
+    void Update(const glm::vec3 &camera, const glm::vec3 &forward);
+
+    // Blocks until every read in flight has arrived (loading screens, tools); the next Update() takes them in
+    void WaitForLoads();
+
+    template<typename Fn>
+    void ForEachResident(Fn fn) const {
+        for (const auto &[key, cell]: cells) {
+            if (cell->state == CellState::Resident) fn(*cell);
+        }
+    }
+
+    const WorldStreamerSettings &Settings() const { return settings; }
+    const WorldStreamerStats &GetStats() const { return stats; }
+
+private:
+    struct Arrival {
+        std::unique_ptr<StreamedCell> cell;
+        std::string error;
+    };
+
+    static uint64_t Key(glm::ivec2 cell);
+    float Priority(glm::ivec2 cell, const glm::vec3 &camera, const glm::vec3 &forward) const;
+    void Request(glm::ivec2 cell, float priority);
+    void Drop(uint64_t key);
+    bool MakeRoom(uint64_t StreamedCell::*bytes, uint64_t budget, uint64_t needed, float priority, uint64_t keep);
+    uint64_t Total(uint64_t StreamedCell::*bytes) const;
+
+    AsyncIo &io;
+    const Vfs &vfs;
+    WorldStreamerSettings settings;
+    CellCallbacks callbacks;
+
+    std::unordered_set<uint64_t> known;
+    std::unordered_set<uint64_t> failedCells;
+    std::unordered_map<uint64_t, std::unique_ptr<StreamedCell>> cells;
+    uint64_t loadedChunkBytes = 0;            // running sum and count for the RAM estimate of a request
+    size_t loadedChunkCount = 0;
+    double totalLoadMs = 0.0;
+    WorldStreamerStats stats;
+
+    std::mutex arrivalMutex;
+    std::condition_variable arrivalSignal;
+    std::vector<Arrival> arrivals;
+    size_t inFlight = 0;                      // guarded by arrivalMutex
+};
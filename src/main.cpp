@@ -4,84 +4,32 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
-#include <fstream>
-#include <sstream>
-
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
-
-std::string LoadFileToString(const std::string &path) {
-    std::ifstream file(path);
-
-    if (!file) {
-        throw std::runtime_error("Failed to Open Shader File: " + path);
-    }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-
-    return buffer.str();
-}
-
-GLuint CompileShader(GLenum type, const char *source) {
-    GLuint shader = glCreateShader(type);
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
-    GLint success;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        char info[512];
-        glGetShaderInfoLog(shader, 512, nullptr, info);
-        std::cerr << "Shader compile error: " << info << std::endl;
-    }
-    return shader;
-}
-
-GLuint CreateShaderProgramFromFiles(const std::string &verPath, const std::string &fragPath) {
-    std::string vertSrc = LoadFileToString(verPath);
-    std::string fragSrc = LoadFileToString(fragPath);
-
-    auto compile = [](GLenum type, const char *src) -> GLuint {
-        GLuint s = glCreateShader(type);
-
-        glShaderSource(s, 1, &src, nullptr);
-        glCompileShader(s);
-
-        GLint ok;
-
-        glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
-
-        if (!ok) {
-            char log[512];
-            glGetShaderInfoLog(s, 512, nullptr, log);
-            throw std::runtime_error("Shader Compile Error:\n" + std::string(log));
-        }
-
-        return s;
-    };
-
-    GLuint vert = compile(GL_VERTEX_SHADER, vertSrc.c_str());
-    GLuint frag = compile(GL_FRAGMENT_SHADER, fragSrc.c_str());
-
-    GLuint program = glCreateProgram();
-    glAttachShader(program, vert);
-    glAttachShader(program, frag);
-    glLinkProgram(program);
-
-    GLint ok;
-    glGetProgramiv(program, GL_LINK_STATUS, &ok);
-
-    if (!ok) {
-        char log[512];
-        glGetProgramInfoLog(program, 512, nullptr, log);
-        throw std::runtime_error("Program Link Error: " + std::string(log));
-    }
-
-    glDeleteShader(vert);
-    glDeleteShader(frag);
-
-    return program;
-}
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Animation/CrowdAnimator.h"
+#include "Asset/ImageDecoder.h"
+#include "Asset/Vfs.h"
+#include "Core/AsyncIo.h"
+#include "Core/FixedTimestep.h"
+#include "Core/JobSystem.h"
+#include "Game/Simulation.h"
+#include "Net/ClientPrediction.h"
+#include "Net/ReplicationClient.h"
+#include "Render/Frustum.h"
+#include "Render/GpuMesh.h"
+#include "Render/LodMesh.h"
+#include "Render/RingBuffer.h"
+#include "Render/Shader.h"
+#include "Render/SkinnedRenderer.h"
+#include "Terrain/ClipmapTerrain.h"
+#include "Terrain/ScatterSystem.h"
+#include "World/WorldStreamer.h"
 
 float cubeVertices[] = {
     // positions          // texcoords
@@ -128,15 +76,35 @@ float cubeVertices[] = {
     -0.5f, 0.5f, -0.5f, 0.0f, 1.0f
 };
 
+// Usage: MilsimProject [server address:port] -- with no server the simulation runs locally
 int main(int argc, char *argv[]) {
     SDL_Init(SDL_INIT_VIDEO);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+
+    // Packaged builds ship assets.mpak next to the executable; anything not in it (or everything, in a development
+    // tree) loads loose from the working directory
+    if (char *basePath = SDL_GetBasePath()) {
+        const std::string pack = std::string(basePath) + "assets.mpak";
+        SDL_free(basePath);
+        try {
+            if (AssetFiles().MountIfPresent(pack)) std::cout << "mounted " << pack << '\n';
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << ", Using Loose Files\n";
+        }
+    }
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
 
     SDL_Window *window = SDL_CreateWindow("Milsim FPS", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600,
                                           SDL_WINDOW_OPENGL);
     SDL_GLContext glContext = SDL_GL_CreateContext(window);
+
+    // GPU driven paths need 4.3; everything else still runs on 3.3 (e.g. macOS)
+    if (!glContext) {
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+        glContext = SDL_GL_CreateContext(window);
+    }
     gladLoadGLLoader((GLADloadproc) SDL_GL_GetProcAddress);
 
     SDL_SetRelativeMouseMode(SDL_TRUE);
@@ -152,6 +120,146 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    glUniformBlockBinding(shader, glGetUniformBlockIndex(shader, "Camera"), 0);
+
+    GLint uboAlignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uboAlignment);
+
+    // Per-frame streamed data; destroyed explicitly before the GL context goes away
+    auto frameData = std::make_unique<RingBuffer>(1024 * 1024);
+
+    struct CameraBlock {
+        glm::mat4 view;
+        glm::mat4 projection;
+    };
+
+    // World, players and rounds in flight, shared with the dedicated server
+    JobSystem jobs;
+    Simulation sim(&jobs);
+    const Heightfield &heightfield = sim.Terrain();
+
+    std::unique_ptr<ClipmapTerrain> terrain;
+    try {
+        terrain = std::make_unique<ClipmapTerrain>(heightfield);
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        SDL_Quit();
+        return 1;
+    }
+
+    std::unique_ptr<DensityMap> forestDensity, grassDensity;
+    std::unique_ptr<ScatterSystem> scatter;
+    if (ScatterSystem::IsSupported()) {
+        try {
+            forestDensity = std::make_unique<DensityMap>(DensityMap::Generate(heightfield, 8.0f, 7, 0.5f, 0.8f));
+            grassDensity = std::make_unique<DensityMap>(DensityMap::Generate(heightfield, 4.0f, 11, 0.8f, 1.0f));
+
+            ScatterLayerDesc trees;
+            trees.density = forestDensity.get();
+            trees.cellSize = 64.0f;
+            trees.candidatesPerAxis = 8;
+            trees.ringCells = 48;
+
+            ScatterLayerDesc grass;
+            grass.mesh = ScatterLayerDesc::Mesh::Grass;
+            grass.density = grassDensity.get();
+            grass.cellSize = 16.0f;
+            grass.candidatesPerAxis = 32;
+            grass.ringCells = 12;
+            grass.lod0Distance = 30.0f;
+            grass.lod1Distance = 80.0f;
+            grass.maxDistance = 80.0f;
+
+            scatter = std::make_unique<ScatterSystem>(heightfield, std::vector<ScatterLayerDesc>{trees, grass});
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << ", Vegetation Disabled\n";
+        }
+    }
+
+    // Boulders come from the simulation; LOD selection runs per frame
+    auto rockLods = std::make_unique<LodMesh>(sim.RockMesh(), sim.RockChain());
+    std::vector<int> rockLod(sim.Rocks().size(), 0);
+
+    // The camera rides the player's capsule: standing on the room floor, stepped at the simulation's fixed 60 Hz tick
+    const uint32_t player = sim.AddPlayer(glm::vec3(0.0f, -0.95f, 5.0f));
+    FixedTimestep simulation(Simulation::TickRate);
+
+    // Against a server the local player is predicted from our own input and corrected from snapshots; the local
+    // simulation then only provides the world to predict and draw against
+    std::unique_ptr<ReplicationClient> net;
+    std::unique_ptr<ClientPrediction> prediction;
+    if (argc > 1) {
+        try {
+            net = std::make_unique<ReplicationClient>(NetAddress::Parse(argv[1]));
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << '\n';
+            SDL_Quit();
+            return 1;
+        }
+        prediction = std::make_unique<ClientPrediction>(sim.World(), &sim.Terrain());
+    }
+    bool spawned = false, fireQueued = false;
+    uint32_t reconciledTick = 0;
+    auto self = [&]() -> const CharacterController & { return prediction ? prediction->Character() : sim.Player(player); };
+
+    // Cooked props (MeshCooker output); optional, the scene runs without them
+    GLuint meshShader = 0;
+    std::unique_ptr<GpuMesh> prop;
+    try {
+        meshShader = CreateShaderProgramFromFiles("shaders/mesh.vert", "shaders/mesh.frag");
+        glUniformBlockBinding(meshShader, glGetUniformBlockIndex(meshShader, "Camera"), 0);
+        MeshFile propFile(AssetFiles().Read("models/prop.mmesh"));
+        prop = std::make_unique<GpuMesh>(propFile);
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << ", Props Disabled\n";
+    }
+
+    // Cooked meshes the level places, by level mesh index; boxes use the cube, meshes that fail to load are skipped
+    std::vector<std::unique_ptr<GpuMesh>> levelMeshes(sim.Level().Meshes().size());
+    for (uint32_t i = 0; meshShader && i < levelMeshes.size(); i++) {
+        if (sim.Level().IsBox(i)) continue;
+        try {
+            levelMeshes[i] = std::make_unique<GpuMesh>(MeshFile(AssetFiles().Read(std::string(sim.Level().MeshName(i)))));
+        } catch (const std::exception &ex) {
+            std::cerr << ex.what() << ", Level Mesh Skipped\n";
+        }
+    }
+
+    // Infantry: a cooked skinned mesh with clips, 500 instances spread over the terrain around the room
+    std::unique_ptr<GpuMesh> soldierMesh;
+    std::unique_ptr<Skeleton> soldierSkeleton;
+    std::vector<AnimationClip> soldierClips;
+    std::unique_ptr<CrowdAnimator> crowd;
+    std::unique_ptr<SkinnedRenderer> skinnedRenderer;
+    try {
+        MeshFile soldierFile(AssetFiles().Read("models/soldier.mmesh"));
+        soldierSkeleton = std::make_unique<Skeleton>(soldierFile, 0);
+        soldierClips = LoadAnimationClips(soldierFile);
+        crowd = std::make_unique<CrowdAnimator>(*soldierSkeleton, soldierClips);
+        soldierMesh = std::make_unique<GpuMesh>(soldierFile);
+        skinnedRenderer = std::make_unique<SkinnedRenderer>();
+
+        for (int i = 0; i < 500; i++) {
+            float x = static_cast<float>(i % 25 - 12) * 3.0f, z = -20.0f - static_cast<float>(i / 25) * 3.0f;
+            AnimatedInstance soldier;
+            soldier.world = glm::translate(glm::mat4(1.0f), glm::vec3(x, heightfield.HeightAt(x, z), z));
+            soldier.clipA = static_cast<uint32_t>(i % soldierClips.size());
+            soldier.clipB = static_cast<uint32_t>((i / 2) % soldierClips.size());
+            soldier.timeA = static_cast<float>(i) * 0.37f;
+            soldier.blend = static_cast<float>(i % 4) * 0.25f;
+            crowd->Add(soldier);
+        }
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << ", Infantry Disabled\n";
+        crowd.reset();
+    }
+
+    LodSelection lodSelection;
+    LodStats lodStats;
+    const float projectionScale = ProjectionScale(glm::radians(45.0f), 600.0f);
+    float statsTimer = 0.0f;
+    int frames = 0;
+
     GLuint VAO, VBO;
     glGenVertexArrays(1, &VAO);
     glGenBuffers(1, &VBO);
@@ -171,19 +279,87 @@ int main(int argc, char *argv[]) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    int w, h, channels;
-    unsigned char *data = stbi_load("/textures/wall.jpg", &w, &h, &channels, 0);
-    if (data) {
-        GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-    } else {
-        std::cerr << "Failed to load texture\n";
+    // The wall texture is read and decoded in the background and uploaded on whichever frame it lands
+    struct PendingImage {
+        std::mutex mutex;
+        DecodedImage image;
+        bool ready = false;
+    } wallImage;
+
+    // Background asset reads, declared after everything their callbacks touch so it drains first on shutdown
+    AsyncIo io(&jobs);
+    QueueImageDecodes(io, AssetFiles(), {"textures/wall.jpg"}, 0, [&wallImage](size_t, DecodedImage &image, const std::string &error) {
+        if (!error.empty()) std::cerr << error << '\n';
+
+        std::lock_guard lock(wallImage.mutex);
+        wallImage.image = std::move(image);
+        wallImage.ready = true;
+    });
+    io.Submit();
+
+    // World cells stream around the camera when the assets have any. Meshes are validated and textures decoded on
+    // the decode job; the frame only uploads, after which the chunk is dropped and the cell keeps its entities.
+    struct CellGpu {
+        std::vector<MeshFile> meshFiles;
+        std::vector<DecodedImage> images;
+        std::vector<CellEntityRecord> entities;
+        std::vector<std::unique_ptr<GpuMesh>> meshes;
+        std::vector<GLuint> textures;
+    };
+    std::unique_ptr<WorldStreamer> streamer;
+    if (std::vector<glm::ivec2> cells = WorldStreamer::FindCells(AssetFiles(), 32); !cells.empty() && meshShader) {
+        CellCallbacks callbacks;
+        callbacks.prepare = [&jobs](StreamedCell &cell) {
+            auto gpu = std::make_shared<CellGpu>();
+            cell.clientData = gpu;
+            cell.vramEstimate = 0;
+
+            for (const CellBlobRecord &mesh: cell.chunk->Meshes()) {
+                gpu->meshFiles.emplace_back(cell.chunk->Blob(mesh));
+                cell.vramEstimate += mesh.size;
+            }
+
+            // The cell's textures decode side by side on the job system
+            std::vector<FileData> encoded;
+            for (const CellBlobRecord &texture: cell.chunk->Textures()) encoded.push_back(cell.chunk->Blob(texture));
+            for (ImageDecodeResult &decoded: DecodeImages(encoded, &jobs)) {
+                if (!decoded.error.empty()) throw std::runtime_error(decoded.error);
+                const uint64_t bytes = decoded.image.Size();
+                cell.ramBytes += bytes;
+                cell.vramEstimate += bytes * 4 / 3;   // with mips
+                gpu->images.push_back(std::move(decoded.image));
+            }
+            gpu->entities.assign(cell.chunk->Entities().begin(), cell.chunk->Entities().end());
+        };
+        callbacks.upload = [](StreamedCell &cell) {
+            auto &gpu = *std::static_pointer_cast<CellGpu>(cell.clientData);
+            for (const MeshFile &file: gpu.meshFiles) gpu.meshes.push_back(std::make_unique<GpuMesh>(file));
+            for (const DecodedImage &image: gpu.images) {
+                GLuint texture;
+                glGenTextures(1, &texture);
+                glBindTexture(GL_TEXTURE_2D, texture);
+                GLenum format = (image.Channels() == 4) ? GL_RGBA : GL_RGB;
+                glTexImage2D(GL_TEXTURE_2D, 0, format, image.Width(), image.Height(), 0, format, GL_UNSIGNED_BYTE, image.Pixels());
+                glGenerateMipmap(GL_TEXTURE_2D);
+                gpu.textures.push_back(texture);
+            }
+            gpu.meshFiles.clear();
+            gpu.images.clear();
+            cell.chunk.reset();
+            cell.ramBytes = gpu.entities.size() * sizeof(CellEntityRecord);
+            cell.vramBytes = cell.vramEstimate;
+        };
+        callbacks.release = [](StreamedCell &cell) {
+            if (!cell.clientData) return;
+            auto &gpu = *std::static_pointer_cast<CellGpu>(cell.clientData);
+            if (!gpu.textures.empty()) glDeleteTextures(static_cast<GLsizei>(gpu.textures.size()), gpu.textures.data());
+            cell.clientData.reset();
+        };
+        streamer = std::make_unique<WorldStreamer>(io, AssetFiles(), std::move(cells), WorldStreamerSettings{}, std::move(callbacks));
     }
-    stbi_image_free(data);
 
-    glm::vec3 camPos = {0, 0, 5}, camFront = {0, 0, -1}, camUp = {0, 1, 0};
-    float yaw = -90.0f, pitch = 0.0f, lastX = 400, lastY = 300, deltaTime = 0, lastFrame = 0;
+    glm::vec3 camPos = self().EyePosition(), previousEye = camPos, camFront = AimDirection(sim.Aim(player)), camUp = {0, 1, 0};
+    float lastX = 400, lastY = 300, deltaTime = 0, lastFrame = 0;
     bool firstMouse = true, running = true;
 
     SDL_Event e;
@@ -192,29 +368,86 @@ int main(int argc, char *argv[]) {
         deltaTime = now - lastFrame;
         lastFrame = now;
 
+        {
+            std::lock_guard lock(wallImage.mutex);
+            if (wallImage.ready) {
+                if (const DecodedImage &image = wallImage.image) {
+                    GLenum format = (image.Channels() == 4) ? GL_RGBA : GL_RGB;
+                    glBindTexture(GL_TEXTURE_2D, texture);
+                    glTexImage2D(GL_TEXTURE_2D, 0, format, image.Width(), image.Height(), 0, format, GL_UNSIGNED_BYTE, image.Pixels());
+                    glGenerateMipmap(GL_TEXTURE_2D);
+                }
+                wallImage.image = DecodedImage();
+                wallImage.ready = false;
+            }
+        }
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT) running = false;
             if (e.type == SDL_MOUSEMOTION) {
                 float x = e.motion.xrel, y = e.motion.yrel;
                 float sens = 0.1f;
-                yaw += x * sens;
-                pitch -= y * sens;
-                if (pitch > 89.0f) pitch = 89.0f;
-                if (pitch < -89.0f) pitch = -89.0f;
-                glm::vec3 dir;
-                dir.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
-                dir.y = sin(glm::radians(pitch));
-                dir.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
-                camFront = glm::normalize(dir);
+                // View angles live on the player so they replicate with it
+                sim.SetAim(player, sim.Aim(player) + glm::vec2(x, -y) * sens);
+                camFront = AimDirection(sim.Aim(player));
+            }
+            if (e.type == SDL_MOUSEBUTTONDOWN && e.button.button == SDL_BUTTON_LEFT) {
+                if (net) {
+                    fireQueued = true;
+                } else {
+                    sim.Fire(player, camFront);
+                }
             }
         }
 
         const Uint8 *keys = SDL_GetKeyboardState(NULL);
-        float speed = 2.5f * deltaTime;
-        if (keys[SDL_SCANCODE_W]) camPos += camFront * speed;
-        if (keys[SDL_SCANCODE_S]) camPos -= camFront * speed;
-        if (keys[SDL_SCANCODE_A]) camPos -= glm::normalize(glm::cross(camFront, camUp)) * speed;
-        if (keys[SDL_SCANCODE_D]) camPos += glm::normalize(glm::cross(camFront, camUp)) * speed;
+        glm::vec3 forward = glm::normalize(glm::vec3(camFront.x, 0.0f, camFront.z));
+        glm::vec3 right = glm::normalize(glm::cross(forward, camUp));
+
+        CharacterInput input;
+        if (keys[SDL_SCANCODE_W]) input.move += forward;
+        if (keys[SDL_SCANCODE_S]) input.move -= forward;
+        if (keys[SDL_SCANCODE_A]) input.move -= right;
+        if (keys[SDL_SCANCODE_D]) input.move += right;
+        input.jump = keys[SDL_SCANCODE_SPACE];
+        input.stance = keys[SDL_SCANCODE_Z] ? Stance::Prone : keys[SDL_SCANCODE_C] ? Stance::Crouching : Stance::Standing;
+
+        if (net) {
+            net->Update();
+            const NetEntityState *state = net->HasSnapshot() ? net->LatestEntity(net->PlayerId()) : nullptr;
+            if (state && !spawned) {
+                prediction->Reset(EntityCharacter(*state));
+                previousEye = self().EyePosition();
+                spawned = true;
+            } else if (state && net->HasCommandAck() && net->LatestTick() != reconciledTick) {
+                prediction->Reconcile(net->LastCommand(), net->CommandState());
+            }
+            reconciledTick = net->LatestTick();
+        }
+
+        sim.SetInput(player, input);
+        for (int tick = simulation.Advance(deltaTime); tick > 0; tick--) {
+            previousEye = self().EyePosition();
+            if (net) {
+                if (!spawned) continue;
+                // One command per tick, sent with every one the server has yet to confirm
+                PlayerCommand command;
+                command.input = input;
+                command.aim = sim.Aim(player);
+                command.fire = fireQueued;
+                command.viewTick = net->LatestTick();
+                prediction->Predict(command, simulation.TickSecondsF());
+                net->SendCommands(prediction->Unacknowledged());
+                fireQueued = false;
+                continue;
+            }
+
+            sim.Step(simulation.TickSecondsF());
+        }
+        camPos = glm::mix(previousEye, self().EyePosition(), simulation.Alpha());
+
+        frameData->BeginFrame();
+        terrain->Update(camPos);
 
         glClearColor(0.1, 0.1, 0.1, 1.0);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -222,41 +455,139 @@ int main(int argc, char *argv[]) {
 
         glUseProgram(shader);
         glm::mat4 view = glm::lookAt(camPos, camPos + camFront, camUp);
-        glm::mat4 proj = glm::perspective(glm::radians(45.0f), 800.f / 600.f, 0.1f, 100.f);
-        glUniformMatrix4fv(glGetUniformLocation(shader, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shader, "projection"), 1, GL_FALSE, glm::value_ptr(proj));
+        glm::mat4 proj = glm::perspective(glm::radians(45.0f), 800.f / 600.f, 0.1f, 10000.f);
+
+        RingBuffer::Allocation camera = frameData->Allocate(sizeof(CameraBlock), uboAlignment);
+        if (camera) {
+            CameraBlock block = {view, proj};
+            std::memcpy(camera.ptr, &block, sizeof(block));
+            glBindBufferRange(GL_UNIFORM_BUFFER, 0, frameData->Buffer(), camera.offset, camera.size);
+        }
+        frameData->Commit();
 
+        // Streams new cells with whatever ring space the frame has left
+        if (scatter) scatter->Update(camPos, *frameData);
+
+        terrain->Draw();
+        if (scatter) scatter->Draw(proj * view, camPos);
+
+        glUseProgram(shader);
         glBindVertexArray(VAO);
         glBindTexture(GL_TEXTURE_2D, texture);
 
+        // The level's boxes; its cooked meshes are drawn with the props
         glm::mat4 model = glm::mat4(1.0f);
-        // Floor
-        model = glm::translate(model, glm::vec3(0.0f, -1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(10.0f, 0.1f, 10.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-
-        // Walls
-        auto wall = [&](float x, float z) {
-            model = glm::mat4(1.0f);
-            model = glm::translate(model, glm::vec3(x, 1.5f, z));
-            model = glm::scale(model, glm::vec3(0.1f, 3.0f, 10.0f));
+        const LevelFile &level = sim.Level();
+        for (uint32_t i = 0; i < level.ObjectCount(); i++) {
+            if (!(level.ObjectInfo()[i].flags & LevelObjectVisible) || !level.IsBox(level.MeshRefs()[i])) continue;
+            model = ToMat4(level.Transforms()[i]);
             glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
             glDrawArrays(GL_TRIANGLES, 0, 36);
-        };
-        wall(-5.0f, 0.0f); // left
-        wall(5.0f, 0.0f); // right
+        }
+
+        // Other players as the latest snapshot has them
+        if (net && net->HasSnapshot()) {
+            const CharacterSettings body;
+            for (const NetEntityState &other: net->Latest()) {
+                if (other.id == net->PlayerId()) continue;
+                const Stance stance = EntityCharacter(other).stance;
+                const float height = stance == Stance::Prone ? body.proneHeight : stance == Stance::Crouching ? body.crouchingHeight : body.standingHeight;
+                model = glm::translate(glm::mat4(1.0f), EntityPosition(other) + glm::vec3(0.0f, height * 0.5f, 0.0f));
+                model = glm::scale(model, glm::vec3(0.6f, height, 0.6f));
+                glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
+                glDrawArrays(GL_TRIANGLES, 0, 36);
+            }
+        }
+
+        // Rocks
+        Frustum frustum = Frustum::FromMatrix(proj * view);
+        lodStats = {};
+        for (size_t i = 0; i < sim.Rocks().size(); i++) {
+            const RockInstance &rock = sim.Rocks()[i];
+            if (!frustum.IntersectsSphere(rock.position, rockLods->BoundingRadius() * rock.scale)) continue;
+
+            rockLod[i] = SelectLod(*rockLods, rock.scale, glm::distance(camPos, rock.position), projectionScale, lodSelection, rockLod[i]);
+            model = glm::translate(glm::mat4(1.0f), rock.position);
+            model = glm::scale(model, glm::vec3(rock.scale));
+            glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
+            rockLods->Draw(rockLod[i]);
+
+            lodStats.trianglesRendered += rockLods->Level(rockLod[i]).indexCount / 3;
+            lodStats.trianglesFullDetail += rockLods->Level(0).indexCount / 3;
+        }
+
+        if (streamer) {
+            streamer->Update(camPos, camFront);
+            glUseProgram(meshShader);
+            streamer->ForEachResident([&](const StreamedCell &cell) {
+                const auto &gpu = *std::static_pointer_cast<const CellGpu>(cell.clientData);
+                for (const CellEntityRecord &entity: gpu.entities) {
+                    glm::mat4 world = glm::translate(glm::mat4(1.0f), glm::vec3(entity.position[0], entity.position[1], entity.position[2]));
+                    world = glm::rotate(world, glm::radians(entity.yaw), glm::vec3(0.0f, 1.0f, 0.0f));
+                    world = glm::scale(world, glm::vec3(entity.scale));
+                    if (entity.texture != CellNoTexture) glBindTexture(GL_TEXTURE_2D, gpu.textures[entity.texture]);
+                    gpu.meshes[entity.mesh]->Draw(meshShader, world);
+                }
+            });
+        }
+
+        if (prop) {
+            glUseProgram(meshShader);
+            prop->Draw(meshShader, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -2.0f)));
+        }
+
+        if (meshShader) {
+            glUseProgram(meshShader);
+            const LevelFile &level = sim.Level();
+            for (uint32_t i = 0; i < level.ObjectCount(); i++) {
+                const std::unique_ptr<GpuMesh> &mesh = levelMeshes[level.MeshRefs()[i]];
+                if (mesh && (level.ObjectInfo()[i].flags & LevelObjectVisible)) mesh->Draw(meshShader, ToMat4(level.Transforms()[i]));
+            }
+        }
+
+        if (crowd) {
+            crowd->Update(deltaTime, &jobs);
+            skinnedRenderer->Draw(*soldierMesh, *crowd, *frameData);
+        }
 
-        // Ceiling
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.0f, 4.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(10.0f, 0.1f, 10.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+        frames++;
+        statsTimer += deltaTime;
+        if (statsTimer >= 1.0f) {
+            std::string title = "Milsim FPS | " + std::to_string(frames) + " fps | rocks " +
+                                std::to_string(lodStats.trianglesRendered) + " tris (" +
+                                std::to_string(lodStats.trianglesFullDetail) + " without LOD)";
+            if (crowd) {
+                title += " | anim " + std::to_string(crowd->Stats().msPer500) + " ms/500";
+            }
+            if (streamer) {
+                const WorldStreamerStats &cells = streamer->GetStats();
+                title += " | cells " + std::to_string(cells.residentCells) + "/" + std::to_string(cells.wantedCells) + " " +
+                         std::to_string(cells.ramBytes >> 20) + "/" + std::to_string(cells.vramBytes >> 20) + " MiB";
+            }
+            if (net) {
+                title += net->IsConnected() ? " | net " + std::to_string(prediction->GetStats().corrections) + " corrections" : " | connecting";
+            }
+            SDL_SetWindowTitle(window, title.c_str());
+            statsTimer = 0.0f;
+            frames = 0;
+        }
+
+        frameData->EndFrame();
 
         SDL_GL_SwapWindow(window);
     }
 
+    net.reset();
+    streamer.reset();
+    skinnedRenderer.reset();
+    soldierMesh.reset();
+    prop.reset();
+    glDeleteProgram(meshShader);
+    rockLods.reset();
+    scatter.reset();
+    terrain.reset();
+    frameData.reset();
+
     SDL_GL_DeleteContext(glContext);
     SDL_DestroyWindow(window);
     SDL_Quit();
@@ -0,0 +1,137 @@
+#include <glm/glm.hpp>
+#include <chrono>
+#include <csignal>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Asset/Vfs.h"
+#include "Core/JobSystem.h"
+#include "Game/Replay.h"
+#include "Game/Simulation.h"
+#include "Net/ReplicationServer.h"
+
+// Dedicated server: the client's simulation with no window, GL context or input. Runs the fixed tick at rateHz of
+// wall-clock time (0 runs ticks back to back, for soak tests and replays) until stopped with SIGINT/SIGTERM or after
+// the given number of ticks, replicating the world to clients on the UDP port. Bots can fill out a match, and the
+// match can be recorded to a replay file for after-action review.
+// Usage: MilsimServer [rateHz=60] [ticks=0 (until stopped)] [bots=0] [port=27015] [replay=none]
+namespace {
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void RequestStop(int) {
+        stopRequested = 1;
+    }
+
+    // Wanders round the room and the rocks, turning every couple of seconds and firing the odd round
+    struct Bot {
+        uint32_t player;
+        glm::vec3 heading;
+        int turnIn = 0;
+        int fireIn = 0;
+    };
+}
+
+int main(int argc, char *argv[]) {
+    const double rate = argc > 1 ? std::stod(argv[1]) : Simulation::TickRate;
+    const uint64_t tickLimit = argc > 2 ? std::stoull(argv[2]) : 0;
+    const int botCount = argc > 3 ? std::stoi(argv[3]) : 0;
+
+    ReplicationSettings replication;
+    if (argc > 4) replication.port = static_cast<uint16_t>(std::stoul(argv[4]));
+
+    std::signal(SIGINT, RequestStop);
+    std::signal(SIGTERM, RequestStop);
+
+    JobSystem jobs;
+    auto loadStart = std::chrono::steady_clock::now();
+    if (AssetFiles().MountIfPresent("assets.mpak")) std::cout << "mounted assets.mpak\n";
+    Simulation sim(&jobs);
+    ReplicationServer net(sim, replication, &jobs);
+    std::cout << "world ready in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - loadStart).count()
+              << " s, " << jobs.WorkerCount() + 1 << " threads, " << (rate > 0.0 ? std::to_string(rate) + " Hz" : "unthrottled")
+              << ", listening on port " << net.Port() << "\n";
+
+    std::unique_ptr<ReplayRecorder> recorder;
+    if (argc > 5) recorder = std::make_unique<ReplayRecorder>(sim, argv[5]);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Bot> bots;
+    for (int i = 0; i < botCount; i++) {
+        bots.push_back({sim.AddPlayer(sim.SpawnPoint(static_cast<uint32_t>(i))), glm::vec3(1.0f, 0.0f, 0.0f)});
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const float dt = static_cast<float>(1.0 / Simulation::TickRate);
+    const Clock::duration period = rate > 0.0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate))
+                                              : Clock::duration::zero();
+    const uint64_t reportEvery = static_cast<uint64_t>(Simulation::TickRate) * 5;
+
+    Clock::time_point next = Clock::now();
+    Clock::time_point reportStart = next;
+    double stepTotal = 0.0, stepWorst = 0.0, netTotal = 0.0;
+    size_t bytesAtReport = 0;
+    uint64_t late = 0;
+
+    while (!stopRequested && (tickLimit == 0 || sim.Tick() < tickLimit)) {
+        net.Receive();
+
+        for (Bot &bot: bots) {
+            if (--bot.turnIn <= 0) {
+                bot.heading = glm::normalize(glm::vec3(unit(rng), 0.0f, unit(rng)) + glm::vec3(0.0f, 0.0f, 1e-3f));
+                bot.turnIn = 60 + static_cast<int>(rng() % 120);
+            }
+            CharacterInput input;
+            input.move = bot.heading;
+            sim.SetInput(bot.player, input);
+            sim.SetAim(bot.player, glm::vec2(glm::degrees(std::atan2(bot.heading.z, bot.heading.x)), 0.0f));
+
+            if (--bot.fireIn <= 0) {
+                sim.Fire(bot.player, bot.heading + glm::vec3(0.0f, unit(rng) * 0.05f, 0.0f));
+                bot.fireIn = 30 + static_cast<int>(rng() % 90);
+            }
+        }
+
+        sim.Step(dt);
+        if (recorder) recorder->Record();
+        net.Send();
+        stepTotal += sim.GetStats().lastStepMs;
+        stepWorst = std::max(stepWorst, sim.GetStats().lastStepMs);
+        netTotal += net.GetStats().receiveMs + net.GetStats().interestMs + net.GetStats().encodeMs + net.GetStats().sendMs;
+
+        if (sim.Tick() % reportEvery == 0) {
+            const double seconds = std::chrono::duration<double>(Clock::now() - reportStart).count();
+            std::cout << "tick " << sim.Tick() << ": " << static_cast<double>(reportEvery) / seconds << " ticks/s, step "
+                      << stepTotal / static_cast<double>(reportEvery) << " ms avg, " << stepWorst << " ms worst, " << late
+                      << " late, " << sim.GetStats().players << " players (" << net.GetStats().clients << " clients), "
+                      << sim.Projectiles().ActiveCount() << " rounds in flight, net " << netTotal / static_cast<double>(reportEvery)
+                      << " ms/tick, " << static_cast<double>(net.GetStats().totalBytes - bytesAtReport) / seconds / 1024.0 << " KiB/s out\n";
+            reportStart = Clock::now();
+            bytesAtReport = net.GetStats().totalBytes;
+            stepTotal = stepWorst = netTotal = 0.0;
+            late = 0;
+        }
+
+        // Fixed schedule; a server that fell more than a few ticks behind starts over from now instead of racing
+        if (period != Clock::duration::zero()) {
+            next += period;
+            Clock::time_point now = Clock::now();
+            if (now > next) {
+                late++;
+                if (now - next > period * 8) next = now;
+            } else {
+                std::this_thread::sleep_until(next);
+            }
+        }
+    }
+
+    std::cout << "stopped at tick " << sim.Tick();
+    if (recorder) std::cout << ", replay " << recorder->GetStats().bytes / 1024 << " KiB over " << recorder->GetStats().ticks << " ticks";
+    std::cout << "\n";
+    return 0;
+}
@@ -0,0 +1 @@
+u ilt trurim iy4lpte fesls aDumxmpno4oetnmociydla2el(msnt) reoxr3iydla eaivs;s)setrir iy4llt mfei s s2ua(rp;t0ole moetasls2ea( pnu4tleoxo3iotla eau s ( setrxopnu1oltemnctat srrm(mono0oeeoiieils mDua(mp u0trenxr iydlpt au i s truoxo nu1omt  fesa(f rum( p;o1altoiieiyt mDranvpn() exoio io1lm e neo s0trto(mpno1omtnlfvsls aDumur nt1aexnmfeiys m2umu snt0tlxnxocoy1oa eau o t  rxoxrpno1openmfesat  Draumono0tpeo ieiyt m umnvp;t)aexnmo3tytlpDelu sls trur(r3oy4omenmivsas aruru pnt4alx  fcias a2uau onu) lenio3oydfp rauvo;(  rur(r3io4opee ivi ( a2umx  no1oee moeiys mDemn o u0tetrif3oo1om rlivs;t)srxmirpoy4lltnmfvilt  rtrx ont1aetniociltfs2ranvs u)tlermf3iodopDrauvs;s0 etmir nydameemnciltfartm(rp;o4tlenii3iys a em( p;(0trerif3oatlmD aivs t0trxrxr nudal  mivtls)arrr(mont0tpe  fciad aDrm( snu0tltnio3iy1oatelnesl(0sexrirpoydom  mfciat)aDuau ooo0opt mf3tysla umnvs t)artrmociadfatelies s)seur(r3oydol emics (  2rrxr ou4olto iciltfm2em(vo ()aeeomo oytom rai s;s  rtrim3nodllt lnctls)sDur(r nu0alx  ociat aDelnvo;(0trtoxo totfatrai s t)t2um(o no1apt  nvi s)a2um(mo;t1tlx  f3ilslm2ra( pnu)trtrxr3oo1omte ieilt srur(o3oo4lmee netlt)s2raxrono1apxn fcias s um(mpnt) eerxfctytoat li o t0 rtmxm oudlm nmnes t)a2raxr nt4tlenmieiaslaDuau snt0texoxr3oodlpDeaueo s) 2xr(rpnodam e nvi tfarraxmp;t4tpxn o3iatlm2ra( p;t4arxnmrcoodfmDeai o s)srxr(o io1llt lnciat  ruax p;t4aeeo feiat s rluvs;(0 lenircoytlaDeaivs;(0seuo(r3nu1llt  fvsls srtrxmp;u0ole mfeias m2ea( pnt)tlxrxo io1la  luei t  rtoxr iodal  mfct ()a2rr(mpot4aexomf3iat mDua(vo;t) etnio iadlm   uvs t0srurir io1ol nmnesatfs2ta(mo;t4tle ii3iat mDeanvp (4 rxoxoctotomDrln o;s srtmim ny1amtelfct ( aDum(m oo4optn ictltfm rmuvpnt4 etrxf oytfp  lueolt s2umxrpnu4alenlfvslt  rraxrp;t1tptnmietaslsDum(ms ()areriocoatlmD au s;s)srtmim3oo4al   nvtltfa2tmum oo4tpxoiociad s2ul(vs t0 lxrxr iotfp rlivilt)t2toirpnydlm n nci sfsDrm( pou0alx ifciasfmDrl( ont)altnxf totfpteauvsls s2xoxm3oy1al nlnei () rur(mp;u0tlxoifetyslm em(ms u) rxnxr3iy1faD aieo () exmxo3oo4omtnmneiasf 2ta(rpoo0oee miciyslm2ea( p ()trenxrcto1lateluvs s0sruoxr3io1apee nct () rtr(mp;o4tpe iocilt mDrmnmonu4arxnxf oy1opte nvol( sruo(o3oydlpee nvil( arurx p;o0oltn oetasfa2ulu o () eerxr oa1op   n s;( s2tmxmpnydll e ncs t)a2rrurp;o0alt mf3iatlaDum(vp ()altoxr io1lmte uvo s sruoim3io4lp  livia(faDtaur ;u1ole ii3ilsla2elnvo u0 leomr3oadlmt lnes t0srxo(m no1oltnlivtas) 2ur(m oo1apen ocild s2ea(vo;u0tlerxf3iatfp r i i s0sexrim ou1amee fcil()s2taumoot1opt mo3iadfm2uln s u4alxnio3oydfaDraivs;s)trtoimpoo1ol   fvsl(faDtrumoou4ale ifeiasfaDrau onu0tetrif3tatoateluvo (  rxoim3oo4altelnvsatfsDtm(m oo4alxnmi3ias aDrlu sn(4alxnifciy1op   i o (0 rxm(opny4lltn ieslsf 2rru poo0apx mietlsfa2uln s;t0 eenir tydlatr uvsl()s2urxmpoydap  mies () rtrxm ;u4oexnmi3iltfaDeln ont4 eerxf tytomD livo (0t2xoirpnudomt mnvtas s2ra(ro;t0openmfetlslmDuan p t4trxnifciotfa raneolt s2uriopnu4lmeemnci ()sDrmxro;u4apeomfciat sDumnvs;u)tltoxo3tytlm ean slt0t2ur(m3nydlpt liet s)s2tmu pnu0apx mo3tad a2rmuvs (0aeerxo tydoa r nvi;t0 etr(rpnodlpen ncils sDururoot1ope mfetldfaDua( p;t)altrif oydlpt  n o;()srto(rpnodal   ict t srrmxmp;u0tltnmo3ias sDuluvpnu4aetrxfcoatom e n ols  eum(rpnu4olee nvtat)sDrmxmonu4apt  icildls um( o (4artrxo3tydlp  luvs;s) 2toxr3iu1ap e fvi sfarumx o;u4altomiciydfs elu s;()texnmfciadop   u ils0 2xmimpnu4alenmncsa()srum(mpoo1oex iieildfa2raumsnu0 rxnif to1lm  anvs s trtrxo3io4ole mfct s  Drmu  ot4oltomfeiadls2em(mp ()teerirciotoatelueols  exmxo io4lmtelnesls srurum ot1tlen feildfm2rmn o;t4tleomo ta1laDrau o (0 rurxmpnudlm nlfcsls a2umu pno0oeeomieiyt s raums (4altnmoctatfmte uvs ()tetoxm iu4lptn iciatfs2rmxront4aexnmfciasfs rlu o;u) lermrctadla  aueol() etrxm iodol eliei ()a2urur no0tet moeiltlsDem(ms;t) ltnmf3oytlm   i ol(  rxoir ou4amee iei tfartaxrpnt4tetniietlsfm emums u4trxomf3iy1lmD au o ( srumxm oy4lpe lfctltfaDtmurooo0opxoifciatfm2eln s u)tltomf3iy1fa eaivo;() 2xr(mpiy1lm nmnvs s  Dtm(rpno1alen i3iatfm2eau p;t4 ltoxocoy1omDe ieo;t0srxmxr oudalt licilt srur(mo;t1opxomfeiyt s2umn p;u0 ltniocoo1lmDrluvi;s  exrxopou4lmenlnvils  Dra(ro;u4oee moeiasfs2el( snt0artomf iy1oa e ies ( srxo(o3nudlleemivsatf rrr(mp;o0oex  oetlslm2rauvp (4 etnmf3ta1lmDe nvsls0 2xrxr no4apen fesas  2tmum ;t0oeenmoctad s rmn s;u4trerxociydfpteaneol()teum(opiy4lmt  ieia(faDrru pnu1tetnmfeilslmDum(vs;u0tetnmf iatfpteaueo s truoirpiy1op   nes t) rta(  ot0tlxomi3tysfmDeau s;t0 etoxo iatoateaies;s0 rto(o no1omenlivi t s2uax p;u1opeomf3tatfs2umnvo (4teenir io1fmtelu s s trtoxr io4lpt licia(fsDur(m ou1texo oeiatfmDuluvo u4alermf3oydfmt lneolt  exmio3oo4ome  nci s) rtauro;u0tlxn fciad aDea(mpnt)texrif oo1oa r ieols trtoxm3nodlleelnctatfa2urxmp;o1optnmf3tys s rmu s t)aeeoxoctatlp e iei;t  eto(r3iu1lpte fcilt)s2rmurpnt0alt io3iatfsDumuvpnt)alxoifciy1om  aneo ()teurxm oo4ol nmnct s  Drru pou4tet  fctltfa elu snu4aetoxo iatlmtrlivs s) 2umiopoy1ap  lneslt) Drrx  no4alx iieildlsDum( pn(4tlerir3todopteaneo s0setoir3nudolt  fei s)aDrax  ;o0oltnmiciad s ulu pnt) lenmrciadfp r ueo s  eumio3iy1amenlnet tfa2tmu ont4oetnmfctlslaDrmnmo u)arxnir ootfa   ivo t0truo(m3iydll nlfcia()srrrxm nu1alxnii3iadlm rm(vp u)artnxr3ty1lmtr nvs;() rumirpny1llte ieil(fsrrm( pno1texo i3iys m2uau o;u0 ltomo3ootomt liesls)t2xrxo3oudlm n iesl(f 2raxm nu4alto f3ias mDuanvp (4tltnmo oatla r nvo t t2urxr3iydlle mnviltf Dta(moot1oet  o3ils s2rln on(4 lxrxr tadfptr u olt0teum(o3ny1lpeemnciatf 2ta(rp;o4opeomi3iytfsDra( snt)tltoxo iy1fmD aivolt0 eurxr3ou1alenmiet (  2tr(rpou0tpe ifctld a2emn ont4tetrxr3to1fpteanvo;t)srtrxo3oo4al   fcslt)artrxmp;u1oltomfeiasfs2elu s;(4teenmrcoadfa e nvil(0s2tr(m3iydlmenmncs t) 2tmurpno0oexomociad aDua(vp u4arxoxociytoaDran o t  exrimpio4oleelieiasf 2tmumpoo1open fciadls rln o;(0aexoxf3oytlp r uei;s0s2trxrpnu4llee fcs s)srtaum nu1tpxnioeiltfsDem( pnt4 etoxrciatfp elnes;(0 2urimpiu4optn fct s  Dur(mpou0tet iociasfs2rlumsn(0 ltnif3oo1faD  ies t) 2uoirpoy4ap  livt (faDtm(rp;t0teen o3iytfm2ulnms t0tlerio3to1oa  anvo s teurxo3no1om nlietasfs2tmxrpoo4tleomoeiysfaDeln s;(4 lxrif todfmte i s s seur(r nydlltnmivil( srumx ont0ope  ociat sDem(vsnt0arxrio3iadla rlnvo;s)truoxr3nudlltnmfvils)srrrx oot1olt iieiasfmDumnvo;t4 rxrio3tytfat luvi ( texoir iudamtelieilt sruaxmo;u4oleo oeiatfa um( o;u4 exrmo iadfmDranvo s sruo(o3oo1lme  fct t)a2ur(r nt4olto f3iltfa elnvs;t0 eerxrcoodfa r uvsl(  exr(mpio1apenlfcsls) 2umx  ou1teeniocilsla2ean pnt)tltrmo3to1fpD ai s;s seumxm3ny1lpe livt s  2tauronu0texnio3iat m2ulu p;()aetnmfcoadopD li i;s0teuo(opoy1amt mfcil(fsDum(  ot4aptomo3tad m2uaums t0artoxo3oadfm eanvo;(  rxm(mpno1apenmfvsls  rtruronu1tpt  fciatlm uauvsnu) eenmo3iytomDeaivs ()truriopiodapt  ivtas)sDumx pno4alxomoeiytfm2umnvpn(4trxnxfctytomtrlnvo () euo(opnu4opeemnetlt) Drrxmono1alxnmoeias sDrm(mon(4tlerxr iadfpDr uvs (0trtrim oy1lpeelivil()s2um( pot0altnioctlsfmDel( snt0aeeomr3iodfaDrlnvil( srxoir3iu4omeemfes tf Dta(mpou4tptnif3tysfa em( o;() exnmr3totom eaivi;t) rxmio oo1am e feil(fartaumoot1oltnmi3iadlm2uaump (4arxnioctatoateau o ( trxr(m io1om nlnei () 2uru  ou0tpe iociyt m2rlnvo () exnmf3tytlpDrlivi;s seurimpou1ame lfct s)a2rrxm ;u4tpxomi3iyd a2rlnmsnu) renmr tydomDraivols)t2tr(r ny4oltelnciat  rtmuro;u4oleoifeiat aDrl(mo;t)aexnxf oodop  aneils tetrxrpiu1llenmictltf Dta( pnu1tlen feiytfsDeanvo;t4trxomo iadoaD  ivsls)t2uo(o oydlmt livi t srrr(mooo1oltn fetaslm ea( o;(0arxoxr3to1omtrlneo;s)seurirpoo1llen ivsasfs2rrx oou4oleomf3tatlm2eaump u)aeerxr3ia1omD  i il( t2urirpoudomte feiatfa2rmurpno4opxnif3iys a2ranvpnt0aeenmoctydlmDrln s s) 2tm(mpnudlp  mfetls s2tmumpot1oeenmf3iadfm rl( o;t0aleoircoo1faDelnvi s)t2xo(m3nydllenlfeiat) 2trxrpnt4teeomi3iad a2rmu pnu4tltnmf io1opD anvi;( seto(r3oydamtnmnesatf rumum nt0aet  f3tyd s2ua(mpnt0tlxrio oydlaD  neolt0truriopiodopenlfct t) 2ua(mp;u1teenio3tasfmDrlump (4tltnmo3todfatrlu s (0t2trxm3nu1lm  mfvs sfarrrumpnt4tlxnii3iadlaDua(mo;(0 reoiociytlaD lnesl(0s2um(opny4apt lfviatf Dtr(mpno0tpxomfeiys mDelnvsn(4tlxrmocio1laD  neo;(0srtr(mpou4lp emnvslsfsrrmu poo0apx mfeiltfa2el(vp;t4tltrmoctatlp   ivs s0t2xmio no1aptelnvilsf 2ur(mooo1oeen i3iysfs2emnvs;t4 exnio iydfpt  u i;t0 rxrio3oodaltemfeils)sDtrxm ;o0tlx ifeiytfmDrl(mo u0arxrio ty1lat  uvolt) rxrimpio4llenmncsa() ruaur oo1ole mfeiatfa um( p t) reomrctydlm  anvi;t)s2um(opoy4aleelnvtas s2rr(m oo1teto iciytls eanmo (0tltoxo oadopDraneo;s s2xo(o nu1lmenlneiatfa2urxront4tltnioctadfs2ul( p;(4arxrio ia1laDe u s;(0 2tmio3oy1lp   iet sfa2umxm ot0aleoifetas sDel(mp u4tlenxo oodlmD  uvo;() exoxo nudamtemfci ()arum(r ;t1aetoifctyd s2ra( on(0alenxfcoydlmtr n ilt texr(m3iudop nmietatfa2tr( oou0tpt mieildla el(ms;()treoxf3ta1fmD auvo;(  2xo(rpoydolt lnesasfaDtm(  ou4alt iietlsfm rln p (4 ltrmr totfmtr nvil()setoxm io4omt  nvsls)s2rmurono4aee ifetat s ul(vs t4alxoxr ia1lptr n i;s trtr(mpiu4al n fei t)a2ur(r no0apxomociadlmDum( sn(0alxnxr3oydfaD ai o s)t2xmir nudomen fcilsfsrumumont1tpx  oeiysfm rl(monu0alxomf oytop  aueolt)sruo(opiydom n ivtltf Dtrxrpoo0alto f3iad s2elnmp u0altomfctytfa rlueols t2xmxm nu4ole mfvs tf 2urumoou1tlxo o3ildla elu o ()trenmrciodoat ai ils)srto(opiu1ame  nctls)s2urx ont4oexo fctatls rlnvsnu) rtoircoytopD lneo t  rtmirpno4amt lnvsl()arum(mont0aetnio3tatfaDuanmp t)tlenmfciadlaDelivol()t2xoimpno4ape mieiltfsrrmum ou4opto f3iytfaDrmuvo;t4aetomocoytfm   ivsl( setoiopiu4am n ncslt)a2umu pou1aetomicildfa2rauvo;t0 ltoir3totoaDelneo;s0texr(mpny1am nlfeias a2rax  nt0aeeoif3ias sDua(vs;u4trtrxr3oydfpteliesl()texmir3ou4ame  icsa( aDtmxmooo0tex mieiydfs2eanvp t4trtoxr tatfa e ies t srxrirpiu1alte fvs s  Drm( pnt0aee ifeiyd sDuan p;(4altoirciadlmDelu s;s  2umxopnudom n fci t)aDrr(r no4alxoifciadfmDeln p;(0tlxoir3io1lmD  ivi t s2tr(m nu1llen fct s s2ra(mooo1openmi3tytfsDrl( s u4tlenxo3iatfmD  i s t)sexmiopny1ape mictls) ruax  nt4tpe miciadls rm(vs u)arxnio3iatfaDelues t) rurxo3nodllenlfeilt  Drmurp;u1olenmoeiatfm2umn ont0trtnmf3iydfpDe ivsl( seum(m3ou1lm elfetls sDtru o;t0olxn o3iadlm ulumsn(0tlerxr3iatfmDeauvs;()tetoxm3oodope  ictlt)s2rmum nu4ape iociltfa2eln on(0artniociy1omDrlnvils  ruoim iydlltnlnetas  2ua( p;u1aptoiociydlmDel(mp t4arenif tadoa elieslt0 etoio3oy4olee fcs tfsDrr(r no0oet  ictls m um(mp t0tlermr3iy1opDr ivi;t srumxo oy4om nlivs (faDtr(mpou0aleoifciytls2elnmont)teeoxociytlm elu ol()s2xr(r3oydll  lnvia(fs2rrxrpoo4teto i3tydlm2eau o (0tetrifctytom  li ilt)srtmxr3nydap e nvi ()a2ururpnu0teen ieiatla2el( s u)aetoir oytlatr nvo;s  rumim iy4openlivtl(fsrtr( pot1apeo icildlsDra( p () ltomocoytfmD an o s0seum(r3nydap emivtl(faDtrx o;u1tpxoifetasfm2ua(mo t0 renxocoa1op eai o;s s2xoxopoydalen ivi s  Duaum ;t1tltnmf3tyt a ulnmp;(0 rxoir oydfptraivi s0 2xoxo nu4ol elfet tf Dumx pnt0apto ictytls emnvpnu) rtoxocia1lmDelieo;t0trum(o3oy1opee fvias  ruaumoot0ole ioctyd s ua(mp u0aetnio3to1om rlieo;t) 2xrxm oy1lptnlies s)arrmum oo1ole mfetytls2ua(vsnu0aeerxo3totfm rai o;(0t2uoimpno4om  lnei s  2trum no0apxn f3iltls ua( s;(4 etoif iy1oatelnvo ( setrir3ou4op elfvta(fsruax o;t1teeomfctlsla eaumo t4aeenxo3io1fmteauei;s) 2ur(r oo4omeemfet ()a2uaumpoo0tleo fetatfa umn s (4tetomrcoy1opD auvo s0texoxm3oudlpeemfvsltfa2rr(r ou1aeeoif3iltlmDeanmp;(0 rermr io1oatr nvsls  rurir3nu4ame  ivi ( s2taxmo;t4oltnmictyslm emnmsnt4arxomf iotlp   n s;t)trxoxm3nudamenmivtatf Dtau  oo0olx mfctadfsDumnmo;u0texomo3iy1laDrlu s (0teuoiopiu4ll nmfetltfaDururoot1oltoifetltlaDuau o;(4alermr3iydfaD  uei;t trtoxopiu1ll nmnei s aDrmxr nu0aetnif3iyd a raums;t4 renif3iydoaDeli ilt s2umxmpiy4amtn fci ( aDtrumpoo0oeeomi3iysfm ranvo t0 renxf3iytlaDeli il( teuoxm ou1alee fvsl(f Dtmuront0tlx ifeiltfs2emu onu) exoxocoydlmt  ueo;s)s2uoxr iodalenliesat)arta( pou4oexomocildfaDea(vo;() lerif iydopteanei t0setoim io4altnmnvtls)a2um(r oo1olxo oeiydls eln p ()aetrxf3ootlat aieo s teumir3ou4optelics (  rurumoou1tee ioeiatfa ea(vp;(4arenmf oydfmD an s t)seum(r3ou1ale  fcsl() 2trxm nt1tlen ieildfm2ua(vpn(0 rxoxociotfate n o;t)texmxm oy1ape livs t  rrrx ono4tlxnifciadfsDemn onu0 exoxfcootoptrlu i s0 rxmxmpoodomt lictas  Dum( o;t1aexn ictltla ean pnu0alxoiocoadfmD li il(  2xrir iu4lpe  fcias sDtmu pno0oetn oetlt m ua(ms;t4alerio3iydom  an i;s t2xoxopno4omt mivt tfartru o;o1apt  octldlm2ran o;(0trenio3iadlpDrluvslt  ruoxo iu1llenlivtasfaDum(r nt1apxoii3tld s umnmp;u0trenmrciatomteluei;s0s2tm(r oo4oltelnvia(fsrrmxrpnu4oexnio3ild a2em(mp u0trtnir ootfaDr n o;(  rxriopno4ol nlncsl() Drm(mooo0tptomi3ild s2ulumsn()aexnxo3oydfp   ivs ( srurir io1ameelieslsf 2rmx ont0tet io3iys mDranvs t0tetnir ta1la r n s;s0 rxm(m3nu4op   fetas  Drmxmoou4ole io3iydls ul(vsn() eeomo3iy1faDe ivo;(  rum(m iydameemieiatfa2rr(  ;o4opx  f3tld mDuln s;u4 ltoir3iadfp e neols trxr(r3ny1omtemnetlsfaDrmurpnu0optomi3tytla2eln pn(0artnxociotlmD  ueo;( seum(m nu1olenlnct tfarraur no1apt ioeiatls rlu s t0 lxoircia1fatrau i;t0 rtmio3oodol  lfct ()sDtmu  ;u0opx iietys sDrlnvo;u4arxrmr3tytlmDraueo ( seto(mpoo1llt  ivia(  rtmxmoou0tpt  feiydfm rau pnu0tlerxo3oadom   ivi;t  2tr(m ny1ll elfeilt  Dtmx ooo0aetn iciltfmDranmo;u)teeoxo3iotlmDranvs;s)srxo(mpio4om nlivt sfartmx p;t1tpen feilt s2eln pn(4 ltrmr oa1oatr u o;s0s2trir iy1om nmfvtlt a2rm( pou1olenifciadlm uau s;u4 lenmr oytfmt aneolt0t2xo(o3oydamenlfvtl() rrau  ou4tltomfcildfs em(ms t4altomfcoadlmD  ivi t  exoxrpnudolenlfvtat)sDtm(mpot0tpt ifciasfa ua(ms u4 ltoxrciy1op r n o;()t2toir3ny4apt  fcslt)arua(m ;o0aptnmoeiydla eauvs;u0tlenmo oy1faDrlivslt) rxr(o3ny4opeemnviasf 2trxmp;t0oexnioeildlm ulu pnt) ltoircoa1fmD  u o;t srtrio iudapen feta(  rrmx pno4aet moeilt aDuauvs u4artnxf tytfa rln i;t0s2umxm ny4am  mnvsl( aDumx p;u4oetomoetasfa2rmump t0 eermf3iytom rauei;s0teuo(o oodll emfvsat a2raxro;u0tetnifciydfmDeau ont4alxoxf oydomteanvs;s tetrim3oo1lpt mnvsa() 2trum nu1opeo feiat a2rl( pnu)texrmocoo1fmDrli i t  etr(r io4al nlnct s s2tmxr ;t0tpe  fciysfm umu p u)altrxo todfa e n s;t)sexoim iy1lp  mncsat a2taxro;t4aexnif3iatfmDel( s;u) exoiocoadopDrlu i s srumxo3nudlpt  fes ()arurx ono1altnmietyt s2ua(mp u)texnxo3tatfmte ueol( s2xrim nu4opee fetlsf rrr(rono0oetomoeiydfm rmnvsnu)altoiociy1la rli ilt) eur(m oodll  lfesat aDrmur oo1apt micias aDumuvp;()trxoxo ootoat  i sl(0 eurxmpnodlltelnvt ()sDurumpnu4tex  o3tas mDra( p (0arxoio oydlatr i i ( t2urirpiy1omeelfvsas) rtau o;o4alx  f3tad s2ra(ms;(0trxnir3oatfmt  u slt0t2uoir iy1ol   ivt (fsDrmxro;u0aleomiciys aDum(mp ()tlerxfcty1omteli o;t  rtmirpio1al  mfvta()srra(mont0tlxn ieiytla rlump u)tltnirciatfmD
\ No newline at end of file
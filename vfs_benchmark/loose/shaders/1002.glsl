@@ -0,0 +1 @@
+neslt0 rxriopiu1al n ieil(f rra(rpot0oexnmi3iad mDrl(mp;(0alxnmrciotfmDelieols)srxmxr3iy4aleelfei t srtau o;t4texn i3ils mDeau p (0aexoircoydoaDeanes s  2toim oy1ap nlnvia( sruaxmo;o1oexn f3tyslsDem( o t4trenxr tytfmtelivs ( teuoxo3nu4lptemfetltfarra(ront4alxo ietat aDuan s;u4aetrirctadop e ieolt s2urxm3io4lltemivsa(fsrtaxmonu4aet io3tad s2el(vs t)aetrio3totfpDe u i t0 rtm(r3iy4ap elfesatf Dur(m ;u4opeomictld s rm(vo;u4aleoxocoytop r uvi t0 rxoio ou1lme  nvsa( s2raxmonu0aexomfeiad sDean s;t0 reoxr tytfpDe i o;s t2xr(m no4lpe  fci ()aDtmu  ot1tlxnmietldfm2ul(mpn()tltrxf3oadlm r n i s srum(r oy4al  lfcs () 2trxmo;u4aleoiieiydfa rm(ms;(4trxrxf oatfp   ieols) rxoxmpoo1apee icils)arumxr nt1aexoif3iatlsDemnvp;t0tetrmfciotfp eluvi;t)trtoir no1olenmfctl()arurum ou1oex  f3ildlm rmuvp u) lxrxf3oytfp rlivo;s0s2xoxm3ou4lm eliei sf 2rmurp;t0teen i3iys m2el(vp;(0teermf3todlatrln s s0t2um(r3nu4openlfei s) Dumu pnt0tpen fctydfm rmnmon(0altnmr3ty1lat aieols  rumir3oo1lpt  nvtas  2rm(mpno1tet ifciyd sDumu s () lxrmfctotfateanvs t)srtoirpiudlm nlneilt aDtr(ronu1apenmieiydfmDemnvpnt0aeermf iydfa eau i;(0 rtrxm3iu4olenlfci s  2rmum ;o4aee  iciltlmDranms;u4 lxnircoodop raneil( teurxo oodam nlfcs s)aDrmxrpot0oeeoifciasfmDuanms t0aetoif3iodfmDrlnei (0 rur(opoo1opt  netls srumu ooo4opt  ieiat aDeau sn(4aexrxocoytom rlu slt0 etr(m ny4aptn neia(f rtmur nu1altn fciatlaDrl(vo;(4 leoxo3oatoaDeai o;s0srtmio iu1amen fvtat)sDrrurooo0apen fciydfm2ranvont0tltnmr oytom  anvo;t  2xrirpnydal e ncilsfa2umxmonu1alxo f3tadls rmu pnu)arermocoo1fm eluvs;t0 2xrim iodal nlnvia(farua(r ou0opxn oeiasfa2rlumpnt4altnio oadfmDelivol( t2umio3ou4omeemnvi s) 2taxr ot4tlxomociad mDea(mp u) ltoio iodfmDeln olt0 ruoir3nydam emnci t)s2ururpot4tpxoifctyt aDrmu o t0aleomfcoytlp eli ol() exmimpiu4lmt mies ()aDrm( pno4alenifetat m2rlu on(4tetrmf oytla  aivs;(  ruoxo ny4op   ict (f ruau o;o0aexnmictatla2eanmo (4tltoxf3oydlate uvi;()t2tm(rpoudapt lieiat)arua(mpot0teeo iciadls2rlu o;(0teenmfctodoaDranvs;s sruoxo oudlptnmfesasfs2ua(mpno4tpt  f3iyt aDeauvo u0 rxoifcta1lm r ivilt0teurxrpnudom  micia()srtr(rp;o1tptn ieils m2raumon() ltrmo3tydfpte uvi;(0s2uoim3ou1ap   ivsasfsDrr(mpoo4tet iicilt aDrl(vpnt0 lenxfciodlmt ai ils t2umxo oo4lm   ncs (fs2ua( ooo1tle iietltfa2ea(vp;u0altrirciadlm   i sl()sexm(opiudlle mnctas)s2uax  ;o1opxomoeiydfmDum( p;u) ltnmoctatfa e uvilt)t2tm(rpiodap elncs (  Drmxrpno0aleoifciatlm2eauvpnu0tetrifciytfaD  u o t)s2xo(r iy1ll nlfvi sf rtaxroou0aee ii3tadlaDemnms t0 eeoif3tydomDelneil(0t2xo(m3iy1aleelnetltf 2um(rpoo0teeo ieiltfa ra( s ()areoxr oa1fptran olt)trurxmpnodom  micilsf 2rm( ont4apeomfeiatfm uanmo;t0 lxnxo3todfpDrln o;s0trxoiopou4op e nvsl( sDtr(r no0apen i3ias aDemuvs;u4trenif iytfp  lues s)srtr(m iudap nmfes t srrmuronu0oltnmo3iltfmDea( p;t)aleomf tytoatrai o;t)trum(m3oy4lptelfei tf Dtmur ot0oee moctasfmDemn s t0aetrxr3oydfpDelivslt0trumxo nudal nliei t)arurum ot1oeeomf3ildfs ra(mp (0 reomfcoadomDeau o ( s2xoxm iudlmt miesls srumu o;t4tpen ocild a uan s t0 rtrxr ootoatr ieo t) 2toir nu1om nmieiltf rumx p;u1opxomociys sDrm(vont0trxrmfctytopt  ivo;(0s2xoim3nydoleemfcsls)aDum(mpnu0tlen ictld aDuau p (4aexrmf3ta1latrai i t) exrxmpoo4ll  lncsl(  Duau oot0oeeoioetatls2rmnmpnu)tetnxf3tatomD  i o;s)trur(m nodomee ictas srrmxmp;u4ale  octlt a2rluvs;u4aetrxr tadoptrai i t0 exoir oudomtelneias)arta( ont4altn f3iatla2eaumpn(0tleoif3totlm eanvsl(0s2xo(opiu1ap elfvs tfsDua(mono0alenmo3iytfm2ulnmont4 rxomr oodfmD livil( t2trimpoydlm nmfcsltf 2urum ot4aptomo3ildfm uan pnu4 lxrmf3oo1lpD  nvi;()s2urxr3oudome mncs s)aDumxroou4oetnifcildfa ulnvp (4 rermrctadlp  ai ols0t2um(m oodll   ietatfa2tmur nu4aeto oetatla rln pn() leomo3tydfmtranei ()trumio no4lm nmncta()s2urxrp;t4tptn ictatfmDua(vsnt0texnmfciy1lptr neo;t0s2umxmpiudaleelivia(f 2ua(m nt4oee mfetadla umnmp;() leoxf oy1la rlueo t0s2tr(o iodal e fvi t s2tm(mp;t0aetomictld sDra(von(4alxomf oo1lptelnvs;s teuoir oydoltemfcias srtaum ou4olxo icias aDrmuvo t)arxnir iy1la eln sls) 2xrxr oo1lpt  neil(f rtrxro;u4ape io3iltfa rmuvpnu) rxrmf3oytom   ieolt0s2tm(mpiy1op e neslt)srur(rp;o4tee mfeias s rmnvp;u)arxoirctotlatrai il()t2xm(r iodllte net ()a2uaum nt0alt mfctas a ul( on()altrxf tytlat  u s;() euriopiudap nmnet ( srrrurpno0tle ii3iat m2eanmp;(0aeenir3io1oaD  n s;( setoio3no1olt mnei tfa2rrumpou4apenmiciadfaDrmnvont0aexrif iytfm r neo s srxr(m3ny4al e icsa( sruru poo0opeoioeilt sDrmuvo () ltoxo3ia1fpteaiei;t0trxoir3nu4lp  mnct (  Dtaurpot0tlxoioeilt m raumo;t4 rtrxo3ia1lmteli ols)t2uo(m ou1om emnet sf 2ur(rpou1ale mf3iytlmDea(vo u0tetnmr iatfp rau o;s)teuoiopnu1ol nlnvsa()sDra(rpot1aee iietyd m emn p u0tltrmf3ia1lmD lnes ( t2toxo3iu4lme  net (  2tr(  ;u0apxo octat s rm(vs t0aexrifcoy1lmDraueo t0sruo(mpoudlltnlfvtl()arta(r ;u0oetnioeiydfm2rmu s (0tltnmr todlp rluvs;t s2uoirpio1oltemiet sfs2ra(moou4tpe ioetyt m2ea( o;u0 exrmo todomtelnvsls)sexo(r3ny1am n net t)srrmxr ;t0openmfctydfa2uau o ()trenxocio1fm ean o ( s2um(opiu1lme lieils a2rr( o;u1aptnii3iydlmDuanvp t)tlenmr3ia1oa rai o;t  eumxmpiydoptemnvtat arum(r oo1tlxn o3tyt aDranvo u)trxomfciodlmDr uvs;s)s2tmxrpoodlm eliesls) Drmuroot4alx miciytlaDrm(mo (0tetoxr3tydlaDrln ilt0 2xoxm3nydalte icia(f rumx  ;u0oee mictytla emu onu4arxrxo3totomte uvi;s srtr(opnodameemnct s  2um(moou4opxo fciltlaDrlumo;(4trenmrciydlaD aieol(0 2trxr io1apee fcs (f Dtrxrpno4oetnmociyt mDuanvp t0tetoxrcootfp ranvo s0truoir3nydom  mfctatfsDtru ooo1oee io3tltfa2ea(monu)artnxr totoaDrluvo;t s2xo(rpiu4ope mfeiat artmxmo;u4teeo fciytls ul(vp (4tltoxfcoatomDrli i t)tetmimpnu4oltemncs s  Dtmxr ;t0tlt  octld a2eauvp (4aexomf3ia1lmDr u s;() 2xo(o oy4amenmfvia(fsrrau  ;u1apeomi3iyd s ran p;(4areoxo ta1latelueilt0 rxoxr ny1omtnmfcs t)aDuaxmo;t0tpt if3ilslm uauvo t0 ltrir oadoa  auvs s  rxrxmpiu4ome  fci ( srtr(  ;t1olenmictytfm raums t4tltrmocoo1fmDelnvil(  ruo(o3iy4omenmfeia( aDrm(m ;o1tlxo i3ild a2elu s ()tleoir iodomDran sl( s2xoio oy4omeemiesls) Dtru ono1apx ifciyt a eauvp u0teeoxfctadfmt  nvo t)srtmxmpnudame mivtltf rur(rpou1tlxo o3tlsfm2rl(mo;u)alermfcty1opt anvs (0truoxo iu1lltnlici tfaDta(roou0opxn fciytlm emnvp ()alxnmr to1fmD aivi ()trtmio nu4omeemnci s) Dur(mpou1apenmf3ildls uauvo;(0aetnif3tadlmDe nvil() rxm(r oy1al elfcsl(fs2ta(  ;t1tee iictasfm2rm(vs;(4texnmo tytfpD auvi;s) euoir3oo4lmenlnvilt artmxm ou0tltn ictytfmDeluvpn(0 reoxr3tydlaDr ieils0trxrxmpio4optnlivt t a2rm(r ;t4aexoiocilsfmDrm(mp (0 exnifcto1opte ieo;s0s2xoxo3nodal e fvsat  2uaxrp;t4tlt mieiatfm rauvp;t4 exnxr oydoate uvslt0trto(r3nu4lle mivi sfsDrru  nt0tlxomiciltla2ra(msnu0altoxocoydomt aneo;() exmxopio4am elncslsfaDtm(r oo4apx io3tytfmDrlnvp;() lxriociydoaDe ies;t0 ruoxrpiudom nmfctl( aruru  ;u4tlt  iciasfs eanvo;u0 exnxr oydfp eaivsl()trxo(opiu4ll nmfvil(f 2rr(mo;o0oee moeiltfa rl( s;t0texrxocoatop e iesl()sexm(o no4olee fci () Dumxm nt0tlt mfeiys a2emumo u0alxoif3oa1lpDeau o;() euoxm oodal nlnvias)aDrm(mo;u4aetnifeiasfs umumpnu0tleoir ta1lp eli o;s sruoxr oy4oltn netls) rumumo;o1apeo o3iasfa eauvp;t0teermfcoa1op r n i;s  2uoxr3nodam n iei t)srur( ooo0apx mi3iat aDul(vs u0aetnir iotfate ues ()srumxo iu4omtnmnvt t)sDra( pno1tle if3iytfsDulumont) exoir3totomtrluvo;(0teuoxm ny4ope mnvta()a2ta( pou0aexo fetytfs rmu p (0aleomr3io1latraivil(  2urxopnodomt mnci (f rurumpot0opx mfeiytfaDumump ()trenmr3tatom rluvsl(0 2umxm oy1ome  fvi ()a2rrump;u4oltoifcildlm ulnvo;(4 renif3totlaD lu i;t0 etm(o nodlpeelncils  rtrxmono0opeoiieiydla ranvp t)arerir3ia1lmt  ueo s) etoim3oudol nlictasf Drm(  ;o4tptoiieiydfs2umnvp ()aexrmr3to1lmt  nvs;t sexmxr3ou4alen fci s) 2ra( oot1oltn octatfs ean o;u4alxrxfciatopteaieil( seuoio iudale micia(fsDua(r ;o1oexoioctyt m2umumo t)teermocoo1oa eaivo t trxrxr no4llenlfvia(faDuaxrpno1tex  oeildlm em(ms (0teeomr todomtrau s;s0tetmim iudlmt lfcilt s2tm(rpoo0tpto i3iadlmDra(ms (4 lxrxf3ootoaDeliei s  2xoimpoydllee ncilt aDumxmp;t1aptnmfciat mDumuvo ()tltrmf3oy1fm eluvi s0trtmxo oodop nmietas)arrau ooo0apxoii3tysla2elnms u0 rtnxfcoydlmtrliei;t0trtr(mpiydap nmics (  Dtmxr ot4olxo oeiydls2rau pn(0trtnmocoa1fm elneo;()sexrim3ny1om emnctlsfsrrmur ;t1oltn iciltls2umums;u)arxrir3iodfp e ieil( srtoxopnu1lmtelnesls  rur( pnu4oee ifeiadls ranms (4tlxrxr3oo1fmtrlnvs;t) euriopiodlptemnvsls  2uaxmoot0altniieiatfs2ra(ms t0 exnxo totfpDean i ()tetmim3iodop emieta( sDraur ;o1texnif3ildfs uanms (0artomoctodfp  ai i;s)t2umim3io1lm e neiatfarrmx p;o1tpxn f3ilt s2raumont0aeenmo3oy1fmDeaiei;t)sexm(rpiu4om nmfciat  rtau pou4oleoii3iysfsDelu p;()tetoif3oodopDeauei;t0s2xoxopoo4alt mncil(  rrr( onu0optoifciydfaDra( s t)tltoxf3iadomtr nvi;() euo(r3no1ame mfctlt)srrmxm ;u4alx  ieiyd mDrlnmpnt) ltoircia1lmte n s;t0 2tmxrpio4lpe mfvs t  rrmur ;u0altn oeiydfa uau p;()teenmr oytlm eaivsls  2xmio oy4lpeelncs t)a2rax pno4opxnmo3ilt m2umnms;t4 lerio tytlmtelnesls trxr(mpnu4lltnmnei s) 2umurpou1ope  icils m rmu s u)alxomo iotop e uei;s) etmir ou1amt  nvtlt)aDrrurp;u1tlt ifciydlsDul( o (4arxoxocoydla   nvs s) rto(mpiodom e fcs t)aDua(mpoo4tlx moeiyslsDua(vp () eenmrcoytlmtraiei;( srtm(r3iu4alee ivtlt sDtaxr ;o0apxnmfeiatfa emnmo;t4tlxrxocoy1fpt  u i;(0setoio3oy4oleemncsas sDua(ro;u1opxoioeiysfsDrmnvo;t4 lerxf oodoaDrluvo;t  rumxm oy1omtemnes s) rrmur no4tltnio3iadfm2emn pn(4aexrxo3to1la rai s s0teuoxr iu4ol nlnes tf rur(m ot1oee mictltfm rlums (4 rtrmrcootop rln s;(  etr(m io1al n nvt s)s2umu  ot1tltnmoeiyd s eln on()trxrmo3iodomteau sls0 eurxo3oydlp n nes s aruaxrpnu0oeen f3iys a2em(vs;u0teeoxo3iytlpDrai o ( sruoir3nudolen ict tf rrmxm ;o0oeenifetas mDrmu s;t0 rxoxf totfm e nvil(  ruoxm ou1al   iei t)aDtm(roou4tlenif3iltlmDul(mo t4aexrioctotfmtr nvilt)s2uoxr3iy1opeemicsas)aDta(mpou0olx ioctyt a2ra(mo;(4 leoircty1lptr iei;t0teurio oodllenlfet t sDtrump;o0apeomoetydfa2umn sn() ltrio oy1lpDe uvs s trxrim iudamtn ictas a2umu  ou1oexo i3tlt m2ua(mon(0 ltrir iy1omD  n i t0 etr(r3nu4ap  lfcs t)s2uaxronu4aexniictatlm2ean p (4 lenmr oydop  ai i ( sexo(m ou1olt mnvt ( srtr(m nu4oee  fcias aDranmonu4aetnmocoadopte u s;s) 2xo(rpnu1amtnmnvsl(  2urx pou4tpe iociyslaDuauvpnu0 exoxr3todopDr ivi;s  2xrxr io4al emiesas  2tmu o;o4oetn oeiyt aDra(vsn()aetrmfcoadlm eaueo t texm(rpoydomeemict s)s2rmum ;t0oleomi3iyd a2rlnvpnt0 etoio3oodla eanei;s)sexmir nu1opee fei ()sruaxr ou0aexo i3tlsfaDrm(vs;t0 rermo3iydfp eauvs;( setoim ny1apt  netls srurxm nt1oeenmfciadlmDrau s t0aexrmf todoa  lnvo (  etr(m iy4lle  iei sf 2tr(mo;u4tptomfciadls2rm(mo;(4 renxocoy1fa rai s s)texmim nu4lpenmnesl( srtau poo4tleniicils a2rmump u0tlenmr tatoaD  uei;s setm(r3nudop   netls aDur(m ;o0aleo ieiaslmDulnmon()trxomoctodlaDrai s (0 rxmir3oy1aleelfvil(  Dtm(m no0tlxnifetatfs rlnmo u0 lxnxr3ta1fmDe i i s)srxr(mpoy4lle lfctlt)aDtmxrpot1teenmictysla emu s;u)trxrmf iy1laDe n s (0 eurio3io4op  lnciasfaDtrump;u4aleomi3iasla2rmumo t4trenio oytlpD auvs;s) etrim oydol  micslt  2tmx pnt4tptnmoeiltfs rau pn() etrif io1oa ran o;s) exrxm3iodlpenmnet tfa2rm(mo;u0apx  o3iaslsDel(mp ()arxrmf ia1optrauei;s) rur(r3iy4olee nvt sfsDrrur nt1apenmf3ils m2ulu s;t0texrmo3tydomD livolt)t2ur(m3oy4opt mietl(  2rmxr ot0teeomfciatlmDeluvs;u4 rtrxociytom  liei ()trurxo io1ope  fvsl(  rumxro;u4alx  f3ias m2umnmpnt) ltrmo ta1la rluvo s tetrir ny4apt lfcs (f Drm(mpnt4aeto o3tyt s2eln pn(0tetrir oa1lpDelivo;t0srto(rpiu1am nlneiasfaDrrxrooo0olenmo3iltfa2umu o t4arxnmrctydfm e n s;(0texo(m3iu4op nlieslt) Dtr(mpoo1olxomoeias a umuvo (4 lenxf3oa1lmDe uvi t)teuoio nodlm elfetat)s2tru oou4tee mfctydlaDeln s u) renxf3oo1la  an i;( t2umim3nydlpen nei t sruax o;u0tlen fciydlaDeln p t)alxrif3tydfmDeli s;s)sexmir no1ll  miei s) Drau  ou1ale  fctltlm2ran p u)treomrciotlp  anvs;() 2uoirpiydlp nlfvt ()arur(ronu4teen ieias mDelumpnt4trxoxf3oa1omtraivsl( texo(rpnu1lmtn fvt sfarra(m oo1tex mieildlmDrl(ms;t0trtomfciatfmte n i;( trumio3nydllee nctl()sDrrxmo;o4aleo feildfs2umu s;t4 lxrmf3iy1lpt lnvo s0 2urxopio4openmfcsatfaruru p;o4oltn ictlsfmDuanvpn(0teenxo iodfmDr u slt0 2uoim oudap e nesasfs2urx p;u0texnifciysfs2rlnvo u0 lxrxf io1late u s s0 exoim3ny4lle  ivs (fs2rauro;u1aet  i3ildlm umuvs t)aeerxociydoaDr n ils srto(m3ou1lm emivi tf Dum(  ;o1aeenmfeiyd s2rmn onu4altnio3oo1fm rauei s  2umiopiu4am nmivs (f 2trx ono1tpeo ociadlm umu onu0tltnmf ootlmD  nvs ( truo(r3ou4lm e fctlt)srumum oo4alxo i3ildlmDrln o (0tlxrmr3oatomDelieslt sexmirpiu4lptemfvi s)aDrax oou4ole  fciasfs2ulu p;() ltrxociotlp  au ols)trtoxm3io4ap emicta(fsrtm(m no0teeo i3tlsls2umnmp (4 rtrir oytoa  auvi;s)s2xmxopny4am   fetat)srta(rp;u0alxoii3tyt s uanvo;u) rtnxoctytlpt  ueo;t s2uoxm3iudap e icta(fa2ta(rp;t1oetnmoeiyt m el(vo;(0trerircoy1fp rlivsls0 rxmxr3no4ap  mncilsf Duau  oo4oetnmfeilt s2ul(monu4 renmocty1omDeauvo s s2to(o iudamtelfeils)sDtrumonu4tlenmieildfs2elnvp;t0tlenmf3tatla elnes (  etmir iu1omeemfvsls aDumxrooo4tle mfctadlaDrmump;t0artoif3iy1lateau s () 2xmirpou1ope lfcsat aDuaurp;u0tle  i3tytlaDem(ms;u4 reoxo ia1oaD aieil() 2trim3oydamen nctls  2rmx o;u4apx mi3tltls elu p;(0 reoio oytfpD ln o ( seto(o oy4llenmfetls  Durumpno4apt iociadla elu p u0trtomrciy1fate ies t)texr(r nu4lpen ivils) rumu pnt1opxoio3iltfmDumums;() etrxo3oo1lm eli sl(0teurir ou1optnlfvt ( a2urur ou0oeto f3ild s ra(mpnu0 ltrio tytla   u s s0trxmir nudol emnviasfa2tau oot4texnmfeiat mDul(vs t4 rxnio tytla eluvil( trtrim3oudoptemicils  Dum(mo;t0aexo feiyslm rmn pnu4teerxocootlmtranvi;(0trumir nodomenmnct sfartaxmpot0altnmfciytla2ra(vs t) eenxr3oadlateli i;(0 ruo(opoy1amenlfctat)aruru p;u0apxn octadlmDelu p;t)texnxf ta1oa  lieilt0 2uo(r nydope  ieils a2ua(m ;t4ape  oeiaslsDeluvo u4trtoio3oodlaDelnvol(0srto(opou1lpe licsl()a2rm(  no0tex moctytla rlnvpnu)arerir3iydlmtrai o;s sexm(opiydapt mncslt sDrm(r oo4texn o3iyt sDemnvp;t)aetnmfcoy1fm elies;()srtoxr3nodlmt  fesa(fs2ururp;o0ale moeiatla elnmsnt0 exrircio1latraueilt) eurxm3ny4aptnlicias) rrm(mpno0tlxnif3tydlmDrluvpn(4 exoir tadoaD  n s t s2tm(m3ny4op nlfetl()artr( pnu1oetn fetatlm uau p t4trtoxo3iotfmDr uvolt seto(m ny4am nmivs s aDur(moou4tet mfeiatfmDuan snu4 etnio oydopDr i s;t  exrxo3iodome mieils artm(rp;o4oex mf3tldla2rm(monu4 lerxrciy1lptelneo;s texo(r3ny4ape  nct s aDtmu p;t1tpto o3iyt sDemnvs t0tlxnir3tytfa  ai s t)teuoir3ny1apee ictlt)aDrr(m ;o0aeenmfetldla2uln p u0 ltnxf iotlatr iei;t)seum(rpnu1opeemnes (f rururp;t0ale  o3tytlmDrlnvp;() ltrif3iytlat  uvo;s)srxoir io4lme mncia(f Drr( ooo0tpeniicilsls2em(vo;()aexoir tadlm  aivslt trxrio ny1lpee fcils  2rm(mpou0apenif3iysfmDulumsnt0altomo3oa1fp e u ilt) 2toxm3no1omtelnct t)s2tm( ont1olxn fetyslmDelumpn()alxoxociy1la eanvi;t  rum(o oydameelnei tfa2um(r nt1alxniietlsfa2ulnmsnt)aeenxfctytlatrai s t seuoio iodolee nctls)aDumur oo4tlx io3iad sDrmumsnu4tlenxfciatop   u i s truoxo3no4ole mnetls  2rax  ou4altnii3iyslmDrlnmo t)treomo3to1fatrli s (0t2xoio nudalt mieil( sDua(ronu1aptn o3iatfa2eluvo;() ltnxo totom raivo t) exr(opnydaptelfvsas)a2uaxmo;o4apxn iciydfsDumnmpn()tetnxfciotlatelues t0s2xoxo3iu1lpt lnci tf rtr( o;t1oet mi3tadfaDua(ms u0 rxrmocia1fpD auvolt srto(r3nu4lmtelnet sf 2ururp;o4tpxn fciys a2ua( s u4altnxrciodfa e uesls  2uoim3iudope livsls artrumo;o0tpxn icias m2rmuvo u0teermrcoo1fptr ivi;(0 rtr(rpoudop nmnvs t s2uax  nt1oltnio3iysfa eaump;t0 lxnio3iytomte u ils setmio3nu1amtelnetlt arrrx pot0tlt iicilsla eanms;(4 exrif3todfpt lnvs (0teur(m io1aptelfci ()aDum(ro;t0tle  fetysfmDrmu o t4alxnir3iytfmDe ieolt0srxmxo3iu1llt lnctat  rtr(m no1oetn f3iydfsDua(vs u4 rerio3oatfp eaivo;( srtm(m iodoltelfes s artm( pno4aetnmi3ildfa2em(monu0 etrmr3iytom   ues;s)s2tmir ny4lme lict t srtrxm ;o4aptn ociat sDrlu p;t4aetoiocoy1lm ran i ()t2xo(m3oy4ap nmfet s  Duax o;t4aexnii3tlsfs umu o u)arerxo3iodlm   u s;()sexm(o ou4opt mfei s s2tmur ;t1oex mo3iasfs elump (0 exoxf tadomD anvolt0 2xrxm oy1lm   ivtatf Drau p;t4oltn i3ilt mDuanmp;u4tltnioctodom ean o;s)s2xr(o oydomtnlfcias)a2trxr ;t1texo oetat sDeau pnu4tltnmr3ty1lp e ivol() rxmim3iudal   ncsl(  rtaxm ;t4tpe mfciys m2rlu o;u4aeenmo ia1oatrai sl()s2xoxm3iu4amtelivsl() 2rrump;o4ale  o3tatfs2rln p;u)aeerxocoy1fptrlnvs (0setoio nu1lmeemfvs s)sDrmumonu1oexnii3iadfaDeau snu4altoxf3oytfatelueilt) 2toim3iy4al n ieiasf 2rrxmpot0aexn iciydfs raump;u) rtoio3iy1fatraieils s2uoir3iudlpe miesa()arumum ;u0tpxnmfeiys a2emn o u)tlxrxr oytoateaieilt0sexmxo3iu4olt mncilsfsrta( p;o0tlxnmoetydlm rm(vsnu0 reomfcto1op e uvi;t0seto(o ou4lmtn neta(fsrua( ont4alt ioctldfm2ra(msnu)tlxnmo oadom raiesl(0setoio oydaptnlfcils srumxront4apt mfctadfmDuln pnu0trenir oodom rlu o (0 2xr(opny1apt  fvs t  Dtaxrp;u4olxomfciytlsDeaumonu) lenxf iadla  luei t)t2ur(r3iodll elivia( a2rr(moot4ope mfciltfs2ra( p;u0 ltoir3totlatrlues t)trtm(o3oo1llt  fvils  Dumumpoo1apeo feils s2rlu snu4trxomrcoo1la  livol()trtoiopny4ol elfcia(fa2rau  ot0tle iociasfs2ra(mp;(4 ltrirciatlmD  neo;s0seuoxmpiodapt mfeia()aDrru  nu1apeomf3iys aDea( o;t0trtnircia1omD aivol(0trumir3oudll  mfei ()sDtaxm ou4aex mociadlm raumont0 leoxf3to1omDelnvs ()seumio oy4aleelict s srra(  oo0alt  fctyt m2ulnvp;t) etnxr ootlat  i s;t  rxo(m oo1apeelfvils srtmxronu0aexnmietldla2emump;t0trenmo3oadfmDeanvo t) etrio3oo1lm  lncilt)aDta(mpno1ape  o3tat s2um( s t) etrir3oydlaDelnvsl(  2trxo oo1omtnmiei sf 2rrurpnu0oetomociydlm2uan sn(0trxrircoy1opt an s;(0t2ur(opiydomt mivsat)srtauroou4opx moetaslsDrm( s (0artnio3to1oa  li ols sruoir nodlltnmiciat aDtaur nu0apt iociltfs ulu ont0arxrxo ia1om elivsl()teurxopoy1llt mfct sf Dum(rono0opxomfcilt a2ua(mo;u)artrmo ta1omD lnvilt0 2xrxopnydomtnmneta() 2ra(mp;o4ale miciasfaDuau s;()aleoxr iy1fmtrau ols trtoxopoydal e iei s)s2rmx p;t4ape mieilsls eaumo;t4texnxr3ty1opte n ols0s2trxr3ny1apeemnctlsfarumuront4tlxnii3tad aDua(ms u)trtomo iodom e neo;s)s2trxrpou4lmenmnet t) 2tax o;u4tpenmoetld m2el(ms u0 lxnmr tytfpD  neo;()teumio3ou4llenlfeta()sDumum oo0olxo feiyt m2el( o t)artnxr oa1faDr nvil( trtrxo3oo1op nmncs tfaDumu pou0tpeoioeiytls2ea(ms;() lerir oydfat  ieilt0 2uoxo iudalt lfvt s a2taumo;u1alxomo3tatlmDuanms;u0teermr3oatlpDe uvilt)s2urxm3ou4om  mfcs s)sDrrur oo4oetnii3iysfs rmnmp;()tltomf iydfaD  nvols0s2xmio3iy4am  mnesls)aDurumo;t1aeenii3iysfmDua(vs;() rtnmr3iodfpteln olt)srxm(r3nodamte fviasfsrraur nt0olto ieils a2uluvont0 rxnmr3iytop eaueo s tetmxo nudlptemfeta(f 2trx p;t4opeo ociatfm2eanvs (0altoxo totfpDelieslt0srxoir3ou1alenmncsas) rrrumonu1aee ifeiat m2emnvp u4areoxfciy1lpt li o t srumxr3nu4am elfci s arua(  ot0oltomoeiytfsDua(mp;()alenirctydfmD an i s0trurir3nydame lics s) rrrumonu4aetoif3taslsDrlnmp u) exrxfciotoaD  uvs;s) eto(o iy1lmtnmnet tfs2umxm nu1olx iieiad sDumnvs;t4 rxoxrcootopDeanvi;t t2umimpoy1omenmfcs ()a2ua(mp;t4aetomietyslsDuluvont0tlxomr3tatoatrauvs ( srtr(mpoodllt livsl(fa2ra(mp;u4tlenifcildlaDeauvs;t0tlxrmocio1fm r uvils) rtm(m3io4ll elnvt ( sDrrxmont0tlxnifetysfmDra( s;(4tetoxo iotlp rli s;()texm(o3iodaleemfcs t)aDta(mo;o4apeoii3iyt s2rl( o;t4artrxf3iytfmDrln o;t0texrimpny1llt liesat)sDrmu  nu4oleoiieiad a el( sn(4 lenmr tatlpt lneo;s0tetr(opiy1am  mieiltfa2ur(r no4oee mf3iatls rmumo;u)tlxoxf3ia1lmDe n o;t)trxmxopoo4omeelncs sfsDtm(rp;o0tet  fetasla ranmo;(4trenxo3oatopD  nvo;s)texr(opiodllen neilt)sDurxm ;t4tltn o3ils a2rlumpnu4 lxomo3iy1fmtrln o;t0setmirpny1lltnlfes t s2ururoou1tlx mi3tlsfsDrm(vs;t) rermociydlat aieil( trtr(m3iy4llte nvsasfa2ta(mp;t1olx mf3iyt a2umnmon(0arxrxr3oo1opD lu o;t0srxm(m iy4lpenlfvi ( artmx o;t4apeo f3tlslm2emuvs;() exoirctotfp eai slt0 rtmio3io1lp elnvi sfsrur( pno0apxniictatfaDel(ms;()artomo tydoat an ol(0t2xoim oodam  lnesl(  Duaumpot0tpxoii3iyt a2rmums;t0alxomo3to1oatr ivi;s0srxrxrpiodomtnlfci (fsDrmu p;o1tlxomfeils a2ulu p () etriocty1lat  n ol()srxoio3ny4omtn nes t)aDuax  ;t1olen ieils m em( pnt4 rxoxo oytop eanes;s  2toiopnu1lptnlici s s2ur(  ot0olxo f3tasfa ran p t4 lxoiocoatoptrlnes;t) etrxm3oodalen icsl()arrr(  oo4alxnmiciyt a rluvont) rxomocia1fpt  u s;( teuoir oodlpe lici ( s2trxmpnu4oexoio3tlt m emnmp (4alxoif3iy1fatraieo t0sexr(opnydlle lics t  Dur(m ;t1oexnmf3ilt s2ea(vont4texnif iodfmD au s s teur(r ou1al e neilt)aDrmu pot1opeomicild m ranvp;(4 etoio oatoa   i s;t0s2urirpnudap n ncs s) rua(rooo1tlenmfctld a emu sn() lxoifcoydfp rlnvs;t0setmimpoo4lm e fesat a2truro;u1oee  ociydfs2ra(msnt4altnxrctydlptrli il( trxoim3iy4lmtnmnci sfs2ua(ro;t0oltomo3iyslmDrm( ont0alxriocoa1lm  au i ( srtmxo ou4al elnvtls)aDrmxm no1alx mo3ilsfs2eauvs;(0trtoifctodoa eauvols t2trim ou4altemiesls  rtaxrp;u4optnmo3tytla2um( snt) rxnirctadomtean il()srum(r nodlmen iesas)arrr(r ;t1tlxnifciysfa2uaumsnt4aeenir3ia1opteanvi t0s2umir3oy1amtemnvsl(fa2tauronu4alxnifeias s elnmp;() eeoifcoy1lpDr u s (  rtoio3oo4om n fct s  Dumum ou0tpx  fetasfsDulumo;(0 rxrmrcootopt an i;t  etr(o3ny4altn ies ( s2rrxmoou0tpeoif3ilt a2eanmp (4 eenxf3iydfmDr i i;( texrimpoo1optn ieiat sDumurpno0apt mo3tyd a2rlnmon()aexrif3tadlmDr ivsl() rxoxo3nu1lm nmietlt  2rmumonu0oex  o3iytfm2uau o;() rtnmfciatfm r uvs t  rurxr oy1lptelnctas)sDtrumont1teen fciltfmDeau pnu4 ltrmr3tytoa  aneo s0 ruoio io4lpt mivtat arraxrpnt0tptomf3tasfa2uauvp t0texnxf io1opte ivslt teurxr3nudol emfviat arumum oo4tleomfeiydlsDulu p () eenir iodomt  nes;t)srxriopnydopeemivilt  rrax onu0tle mfctat a ulumo (4tlenxoctydop   n o;t srurio3ny1ameelies t  rrmx  ou1alt  o3iasfa el(vp u0trenxf to1fmDeanvi (0srxmimpno1lm nmfeil(f 2tm(roou1tetomictysls2elu pnt0texoif oydlmt auvslt)seumir3iu1aptn nvt (faDua(r ;o4aet  ocildlm2rlnvpnu4tlxoxf iytfm eanes t s2xoxo ou4amtnmnviatf rra(ro;t0tpenmoeiadlm ul(vs;t) lerif oytfm  ln il()s2trir3oy4lme lfei tf rua(mpnt4altomfeilsfm umuvo;t4trtoifciotop   ivi;s trto(opoy4alee net (  Dur(rpoo0opxomietydfs2ranmo u0 exomfcoytomtrlueils seuoim io1om   nvsat) 2umxmpnt0opt mo3iydlm rauvont) rxrmoctodfp rlnvs ()s2xoio3iodoltn nvtlsf Duaumpot1tee  i3iadfmDranvont)artrif3oatoa eanes s0t2tmio3iydamt mnvt ()srumx ont4apen fctatfa2ea(vp u4alxoio3oytopDrli s t setmio3iydlmtelneils)sDua(rp;o4teeoifeias mDra( o t)aexoio tytlmDr ivi t  rxoim3ou1alen nvtasfsrua(mpot0texniieilslaDrau s t4teeomo iytlm  luvo;(0 2tmir iodapt  ictl( s2tauroot0olxoifeild a2em(mon()aleoxr totlmDelnvi;(0 2um(r3nudole  ici t s2rax oou4ape  o3iasfs ra( p;u0aeenir iotoaDeluvs t trumxo no4lptelivs (  2rmxmooo0ale ifeiyd a2elnmp t)trxnmfciotop  aies t trxmimpiu4alt  iet t) Duax pnu0alx mi3iytla rl(vs t)alxnif io1lmD lnei t0t2urimpiu4ap n nct t)sDuru pnu0altomoetydfm2rluvsnu4 rtoifcoodoate uei;s t2trxr nydale lnes ()arta(  nt0oltoifcildlmDea( p (4 leoxr3io1fmte ivolt0seurir nodop  liesa(faDtrx ont1oet  iciysfm elnmon(0trtoxfcoo1lp elu o t)trtoxr nudolte fvs sfsrtm( ont4tpxoifeiltfs ua(ms t0artnirctadlmD li s;(0 2xo(opiodap n fciatf Dtru o;t4tpe  f3tas s2ran o;(0 rerxoctotop eaivilt sexm(rpoo1op   neiltfaDrr(m ou0aex  f3ias a2eaumsn(0tetrif3ia1la rau o ( srurxopoydapt  ics s)s2tr( pnt1tlto ocilslmDul(mpnt4aexnmf tadfmtr nei (  2xoxm3oo1amtn ivs s) Dumxmonu1tlt mi3iltfs2rlnmo;t0trxoir3oo1lpDeluvolt)srumirpnu1om n fetlt) Dumx p;u1opt  ieiad a elumsnt0tlenio iytomteauvols)s2xrim3iu1lp  lnes ( aDum(rpou1ole ii3iydfaDemu snt0 rtnir3iytlpD aivils teurxr3iy4lleemivtlt aDum(monu4olxnio3iltls2rm(msnt4 etoxo3tatlmteaues ( tetoxrpnudlmen fctltfsrta(m nt0teeo fciyt mDrmuvs;()artomo3iy1fa  luesls s2xo(r iudap n fetlt)a2urxrpnu4aexo ieiltfsDemuvo t4altoir iytlp   ivi s0truoxo3oydaptelfesl(fa2uaxr oo4aptnioctad aDean o;u4trxrxo oydfmtran i;t0 rumim oy1om  mies s s2trxmpou1oet ifciadfs em( s;u4tleoxfcty1om  ai s s) rtoir iy1ll e icsl(f Dum(mpnu4aexo ieiad aDeanmp u0 etomr3ia1laDran i;s)t2xrimpoudom emiei t)aruaxrono0tpen i3iys s2rmuvp;u4tetrxf3ia1fpDeau olt0t2tmxo nudlme  ici t  rtmxmp;o4tlxnifctatfm2emnmo ()trxomocoytlp ran olt)texo(rpoy1lm  mneia()artax p;t4opxoiicild a ranmonu) rxnxr3iytfmD  i s s srxoimpiudamtemfei s)sDumxmooo1aleomietltfa rau p;(4altnifctytfm e ueo;t0 ruoxrpoo4lpenmicsl()sDrauro;u4apt if3iadls em( p;()altoio totfpDelivol() exmio3ou1altnlfei s)arum(m ;o0tee ioeild m rlu ont4 ltnmf tytoaDrlivs;t0sexmxr iudopte ietatfs2tr(m ;u4aex iictldlm2ulums u4teenmrcty1oa  ln sls t2uoxo io1altnlnvsa()sDtaur nu1tpxoio3iltlm ra(msnu0 lxrmf3ty1fp  lu sl()s2uoxr3oo4lpee iei (fsDurum ;o0oeto oetasfsDul( pn(0areomo3oa1oa  luvolt)trurxo ou1lmtn fvtas s2rrxrpou4optnioeiysls umu o (0aleomfciadlmteauvi s  etr(mpoydlle lici sf Drmxroot4oexnii3ildlaDelu s t0 lxnir3io1fp eaues t0s2tr(o iudalenlnvi (f Drrum ou1olenio3iysla2uanmont)tetrxr iatfm   n ils tetrxopiu4ope lics t)aDumu pou1aeeoii3ild a2umnmp;(4 eermr ta1fm   i o ( tetm(o no1lptn ivia(fsDumx  ;o1tex  oetadfsDrlnvsn(4tlxoircoy1la   u o t  2trxr nudll elici ()s2ra(rooo0tltniieilslm2ran snt) exrxr iytfpD livilt) euo(r3nu1lm nlnvsat sruaur ;u1olenmf3ias s um(vs;t)arxomo oy1fptran sl( t2toxopiy1ll   fesls aDtmxr ot1oex iieiydfa rm(mp t)alenmociytomD  neo s)teumxo3io1amtn fct tf Drrum ;u1ape mf3tyt s2uan s u0tlxnxo3ta1om r nvs;s0 rto(o ou1lm emnvsltf Duax ont4apx mieiasfsDulnvp u4treomo3iytlpDrai i;s sexoim nodlp  lfcsas)sDuau  ot4tet  f3tad a2el(msn(0aetomf io1omDranvsl( srurim3nydap  livias)s2tmx poo0teenmfeilsfmDumnvsnt)aeenif3ta1lpDe nvo t t2xmxrpou4omtemivs s)srurur ot0tex mictytfa2uanvonu)aexoif ootfa ranvi t)setm(opny1ole lnvt ( srrm(r ;t0ape miciatlsDumumpnu4tltrxr oadlmt lnvi s srumir io1ll nmnctlt)s2tax o;o0oetomfeiyd mDeanvs u0trxrxo oatop rlieo s0 etm(opiy1ame livt (fs2um( pot4tee mf3ilt aDumnvo;t4aeermr3iatoat aiei ( s2umxmpiodap  mfcsas)arrrump;t4texomiciydfaDua( p u0 etnxo3tytlmD  ivslt teurxr no4lmee nvs s) Dtm(m ;u0alenmf3tyslm uln p t0 rtoif totopteaneol()setrim iy4ap emietasfsDrrxmonu4apenif3iysfsDumu s;u)altrxo iatlpteanvo (0 rum(o oy1omee ivs ()arra(m ot4olx  f3iyslaDea(mpnu4artoxf tytop rluvsls t2uoxm3iu4al  lfeil( aDrax  ;t0alt mfctyt aDeauvpnu0 leoxo tatomt li o (0tetoxr iy1al   nes t)sDtrum nu1olx iiciytfaDulnvonu0 lenio3ootfmD  nvi s) 2xoxm3oo1omtemnct sf 2rrx oou0alen fciytlm umn snt)treoxr3totla  ln i;t srxoir3iodom nmfvia() Drmu  ;t0alto fcilsfaDum( snu4teeoio3oatlaDeaiei;s)tetmio oo1lptnlfeils)s2trx onu4aexn o3iat m eanmon(4arenif3totoat li s ( trtr(mpio4apt mnci (  2ta( o;u1alxniicils a rmuvo;u0teeoxoctodomDeauvo (  eumimpio4om nmncs (f 2raur ;t1aptnif3iys sDel(mo (0trxrxf3tydfa  aivslt0s2uoim3oy4apeelivsasfaDurx o;t0oeeoifciyslsDul( p;t4 leoxo ia1om  aivi;s)s2ur(o3oo4ape lieil()arrrumpnt0aptoifetydfm2uauvs;u) lxrxf3io1om  aueslt0srxm(o oo4ol emfci t) Drmum oo1oleomo3iys mDrlu o ()trtoifcoy1fatelieslt0setm(mpoodomt lfci ( sDtaumono0oexoiiciasla2uau on()tltnmf3oo1lp  li slt) 2uoxr oo4ol elneiat a2tmxm nu1ale mociydlm2ua(vpnu4aleoxo iadlaDeaneilt srumxo3oo4lmtelneia( s2tmxmo;o0alx if3iysfa2uanmonu4altrmrcoo1laDr u o;()srxr(m iy1omee icta(fs2tax poo4oee  f3iat m2eauvpnt0aleoxr oydopDe nvsls)trxoimpou1ole lnei (fa2taxmonu0opx mi3tat m umnmpn(4 ltriociadlp e uvil( tetmxo3ny1ap elnvs t)srur(mpou1apeo fciyslm ran s u) rxoir3oa1fm eluei s) 2toxm oudomenlnct t)sDtaumoou0olxoioeilsfm rlnvp t4trerioctodlptrln o;() etr(opiudalt lnvias)sDrau p;o4opxomieilt m2um( p;u)arxrxo oo1om  aueo;s0srxoxm ou4om e nes t)srrru p;u1tlxo iciatfm uauvs;t4aexrmocootlatran s;()t2xrxo3nydlpe  ieta(  Drrump;u4alxn oeilt s2ra(mp;t4artriocoatopteau i ( teum(r ou4omt mnei t  2tru  ou0oee iieilsfa2ea( p;(0 eermf3ootoptrlneilt t2um(r no1llt  ncilsf rurxmp;u1altomf3iyslaDrau s (0arenio3tytoptrai ols)t2tm(r no1alenmies t)s2rauront0olxo f3ildfsDra( snu4tlerxf3oy1laDeanvs ( s2xoxr3nu4ame mics s arrr( onu4tlxo o3tys a2rm( pnt4aeenir3oa1fptrlivo;()trto(r iy4olte fvslt  2uax ono0olxn ieilsfm umump;() reoxrcootopt luei s)srumim3nudlmenlfetas)srtrumpou0altnmi3iytfm2rlu o;t4 rxrxoctotfmDeliei s)t2um(rpnu4opt mivtatf Dumxmpot4aetnmi3tasls rl(vs u) ltnif oytfmD ln i t)seumir3nudlm  lfetl(fs2taxmoot4apenio3iltfa2uln s;(4tetnmfcoatlptr neo t)srumxm3nudllenlfcs ( a2trxront1alxomfcildfm2umn sn(0 ltrxo3oa1laDr ueo ( sexrim3no1oleelieil(faDta(ro;u0apt  f3tldlsDrau sn() rtoiocoa1la r uvil()t2uoxo io4lp  lnet s)s2tru p;u4olx iiciysfa rmuvpnu0 exrmf iotlatranvilt sexmxmpnudopt  icsa(farrm(mpno0aleo feiatlsDuau on(0tltrmf totopteaues;s  2tr(rpou4omeelfes sf rum(  ;t0tpt  i3iyt m2uluvp;(0 lerio3oydfmtraneilt seuoxmpiu1oltnmfctas)srtmu  ;t1optoif3ils m2emn p;u)trenmocoodfm r ues ()t2tmiopnydom n nci s  2ra( p;o4tltoioeiltfaDrau pn(0artrif3iatfa  lnvils trur(m3nu4lpe lnctat) Dtmx pnt1opx ifeiyd a elnvs;t4 lxnir iodom rlnvi;s srurxr nu1apt lfeias) rrrur ou0aptnmf3iatls ulumo;(4 rxrmo totfmDrauvsls t2xo(o iy1lm  lfctat)sDtrurp;o0optnifeildls umums (0 lermo oydoptelueils0 etrxr3oudlmen fcsls srrr(r no1apx iietltfm2elnms;()trxrmr iotoaDranvi t  exoxm oo1oleemfcsl( aruax pnu0opeomieiat s2um(mp (4aexomfcoy1oa   uvs;s0sruo(r3iu4alt  ivtls sDrr(m ;o4aee  fetldlsDrmnvpn()tltomr oytfaDelneo t) rxrxr3oodop  mnetlsf rrmx ont1oexnmoeiatfa rmuvsnu0altnmo ty1lpDeaivslt  2uo(m3ou1op n nesls)sDrm(m nu4altnmiciatlm2rlu o;t4 etnio3oydla raivo t)s2umiopou1ope lnvi t  Duaxmp;o4tpeoifeilsfm2ea(mon()arerir3oadopDelnei;s0texmir iydam elfeia( sDururp;o4oetoiictas aDeaums;t0areoxr3oy1om raueo t0teurxr ny4olteliei ()aDtmu pot0aptomociltfaDraums;t)texoir oo1lp elues s0srum(o no1om   fet sf 2um(mpot0oeeo oetytfaDra(mon(4 rxoioctotlpD lues;t0 exo(m io4lp elnviat  2trur nt0tee  i3iydls ulnmp (0teenxf3ootfa  li olt)sruoxmpnodal  mfes t  Dta(  no1aleomf3iyslmDrlnvs u) etrio iadomDr n sl( s2toimpoy4am  mivsatf Durxm ;u0aexn octyd s emnvsnt0altomf3oytfa ran o s) eurxm iy4om n ncia()s2tm(r nu1apxoif3iad s2uanvo;u4 eenxo3oo1om eli ils)s2tm(o iy4al n net s)a2rr( p;o0olxoiietys s uau on()aetnxo3ia1lmDrlneo () rurxr3ou1oltnlnvsls) Duru o;u1olen feilsfsDrmnmo;u4 eenxf3oydlmt  nvslt)t2to(m3iodlle mneias artm(ronu4aptoii3ildfsDeau o ()tlenif3ia1late u o;(0 2xmimpnydlp nmfcs t) rrrx  ot1olt moeiat s2ulnvsn(4 rxoxf tadop eaiei t sexrxopiu1aptemivsatfsrrrxr nu4opt mfctydlm raumsnu0 ltrmr3oodfmDr ueol(0srtm(opoy1opt lnvt t)s2umxmp;t0teenioetltlm em( p;t0tlenxf iadom   n i ( teumirpiudoptelfvsl()sDtrxroou4ope  oetat mDum(vsn(4tltoxr3oytop   ues;()trxrxr3iy4optelneslsfs2um(mpou1oet mi3ildfm2rl(vont4 leoxf oatfpt  u il( tetmir3oo4ll e ici tfs2rm(root4apxoioeias aDeau ont0 rxnxr3ty1oaDrlu s s) 2uo(r no4lm nlnvtl(  rrru  ;t4ale io3iyt m2eanms;(4trtomrcootoaDr uvo t seurio no4ap emicilsfsDraxmpot1apxoifetys aDulnvs u4arxrircoatlmDrau s;s  2trirpno4omeemfvtlt  2rmuroot4oet  oeilsfs2um( pnt4aexrir tydfm  luvo ()t2umxm3oo1op   ieia() 2trum ;u4oet ii3iatls ran sn()aetrir3io1opDelivs s)s2toio3ny4op   fet s s2uaxr ou1ope moetasla rmu o;u4 etoxo iatfm   neo;( s2xrxo3io1ap nmnci (f 2ua( o;o4aptn ieiadfa rl(mo;u4 rtnxf tatfat  iei s)trxmim3no4lm e nciltfaDumxrp;o4ale moeildfs ranvo;u)aexnxo oytfm  aieo (  etmxr3oudomt lnes (f 2tmxm ou1altn ieiytlm eauvsn(4tetoio3tytlatr uei;()trtoim no1olt mncs (f Dum(rp;u4tpxnmf3iyt aDul( p;t0alermf3iodlatr nvs t0 etmxmpou1llenmfcil( srrmxmo;t4aetoifcildlm rln s;(0 rxoio3ty1om eaivsls sexm(o3ny4amee ncsltfarururpnt4tpenmf3iasfa rmnvonu)areomf todom  lnei t0srto(mpoy4aleelnetls)a2rm( ono1open feiyslm2rmn p;t0aeerir todlmtrlues;t) 2tmxm iu1ale  fvt ()a2taxmoot1teeoifeiadls2ulnmp;t4 etoxrctodfate ivo;s0seur(rpnudlltn fetls srua(mo;o1olenmo3tlsfs2emuvon(4artnifcoatlpt au s;t)s2uoim3ou4ape mnvilt)sDurxr ;t0oeen f3tlsfaDemnmpnt4teerir iatoaDraivo;s0tetm(r no1lmtnlneil( s2urxm ;u1tpe  fetadfm2rln p;() rxrif tadoptr n s;()trtm(o oy1altnlivslt)aDrr(mpou1aeen ociadlsDra( p;u)tlxnxrctotoa rlnes t) 2xrxopno4lm  lfvias)arrrumo;u0aeeo feiytlsDua( o t4aetoxf3iadlaD  iei;(  2toxm oy1omtelnctat aDtmxm ;t0tle mieils sDeluvp;t4tetnir3io1lat ln sls  eur(r3oo1am  mnctasfartrx p;t4aet ioeiadlm2ea( o;u4 lxrxf iytlmtranvsl(  exmxo3nodapte fcta(fa2ta(mpnu1aleomfeilslaDumnmo;t4tltomociotla raiei (0sexoxm oodll   nct t) Drrxrpnt4oet  ictlsfs2rauvsnt0trxomo3iytomDrlu i t  exrim3iydop n icsat)srum(  ;t1aeen ieiytla2em(vo (0 rxrir tydom rln il(0s2tm(o3iy4llenlfcilsfarumuronu1opxo ieiasls2em(vsn(0areoxrctodlmtelu slt0texoxr nu1lm emfetl(faDrax ono0opt ioctldlm2ul( p;t)treoxoctodopDeluei;t t2xo(m3iy4ll emivil( aDrmum no1tptomfciaslm uanmo (0 rtoxocio1op eln i;s0s2uo(rpnodlp n ieil()srra(m no1oltomiciasfsDum( pn(4aetnif3io1lpteaieol( s2xmxrpiodoltnlnvt ( artrx p;t4tptnifeiys mDrl(vo;t4tetnioctotopteaues;t0 2uoxrpoy1opt lnetls s2raxroou0optnioetldfm elumo (4aeermr3oatla e ivol(0s2xm(rpoodlpenlict t)sDraxmpnt1tlen o3iyslm2eau p t0 eerircoy1fa r ues;s)t2ur(rpiu4lp nlfvi tfaDra( ooo4tpx  ictydfs2eluvp u)arermociy1fa e nesl() euo(m3iodame mfvs t)arrm( pot1tpe  fctld m2rlnvp u)tlxnxoctatlmtr ivil(  rxmir io1al e fes s aruru  oo4teto oetad s2emumo (4artrxr3oa1faD lneslt)s2uo(m3no4alt lnet s)aDur(r ;u4olxniiciydfa el(ms;(4 lxomoctytla r i s;s  etrim oy1ol emfvsat)s2rm(  oo1aee mo3iad sDrm(ms u4tetoxf3oa1oatraues t0 rtmxm3ny4lm elfeslsfsrraxmpnt1tlxniociltlsDrm(vs;u) ltrmrcty1fp  lueo t texo(o nu1ap nlfcias)s2trxronu4tlenmictltla rl(ms u4 rxrir oodfateau o s0srxoiopnydlm emneils arrauro;t4tpx miciatla umu on() etrxo3iydfpDr i o t srtoxo nydaltnmnvi ( a2ur( pnu4aexn i3iasfmDumumo t4alenif3oy1omtrln s;(0 rur(r ny1altemnci (  rtr(  ;t4apx micils s emn snt4 reomr3tatfa   iei;() euoim io4op emfes (faDurxrpou1oex mi3ildfaDeanvs (0aexoxrcootomDeluei;s0s2xm(mpnydlm emneslt) Dtmxr ou4teeniocias m2em(ms t0arenmr3to1lp  luvsl() 2trio oy1llt mnviasf Dtmu p;t0opt mictasfa2ulu p;u4 exomfcootfp  lies ( texo(m3iy1omee nctat artmumpou0apxn ieiltlm uanmp u4teenmfcoytoaD auvolt)trumxrpny4ol  mies s  2ur(m nu0olenmf3iytlm raums;()altoxf3iotlptraivi ( s2toxopnudoltelfesa()artmu  nt0apen ociadlmDelnms (0tleoxr iatlpDeli il()t2xoimpoodllen neia(  Dra(r nu0tpe  f3iysfm el(mp;(0arenmfciadfa e neo;s  2trim3nu1om nlneiat)a2tm(ronu1opx mfeils a2ra( s (4altrmfciy1faD lieo t  2uoiopiy1lltn neslt)s2urumo;t1alx mfeiydla2emu s (0aeermo3io1lm eln ils0teuoio3ny4oltelnvsa(fsrtmumpnu0texnio3iaslm2elu s;t0 rxnmr3totom rauvs t  2xm(rpiydlm  lieiat  Dua(ronu0apto fciys m umu s;u0artrir oa1opD anvil() rur(rpny4al elfcias) Drm(m nt4teeoif3iadla umnvp;(4 etnif3iatfmtranei;t  ruo(o3oy4llee fesa()aDtrx pou4optnmfctad s rmn s;t0altoxo oa1fpDraivs s0 exrxr3io4lmenlivt ( a2tmxm no4optnmoeiyd sDrm(mp;t) lermf3totlmt lnvsl(0 2xo(rpiy4omt lfetls srrru  ot1alto i3tasfm em(vpn()aeenifcoatlm  auei;()teuoiopiu1lle lncia(f Dtm( pot0tptnmi3tadfa2ea(vp t) lxrmr to1lmDeauvsl(  ruriopiodlltn nci ( s2rrxrpou0opx moetldfa em( p ()texrirctadomt ln s;(0s2xo(m oydlme livi (  Dtaxmpno1aleomieiydlm2uan s;t)teeomfciydomDeaueo;t teuo(rpiudlltnmictl( s2uru pno4texomo3iatlm2umu p t4aetoio ty1fpD au i (0srtrir3nudlleelnesl() rtmur ou0oeen fciytlm2rmumon(4tetnmrctydfmDrlnvo;s)s2tmxopio1al n nvt s  rrru  ;t0aptnifeildlm2ra(vsn(4aetnxf3iydop  lneo;t s2xm(mpoy1lm elfvtl( aDraxmont1texomf3iltls rl( pnt0 rtrir3todlmD anvi;()s2uo(m3nodaltnlict t s2tau oot1aetoiietas s2rlums;(0 lxrifcoa1oaD aivils  etmxm oy4altnlietl(f Dtmxmp;t0oleniietlsfm2rmuvsn()tetnmrcoo1oa elivil( srxr(opiy4om   nvilt)aDtm(roou4tptnif3iysfs ea(msn() etoioctodlm  livs s srtrim iu4lm nmfct ()aDtmx oou1alt  f3tld s2rau ont)tlenmo iatla   neo;(0t2trxo3io1amtelfcil(fa2rrx p;u0teeoiietlslm2umnmp t4tlxnmf3iatfp   ues;t0 2umxr3oydlpt lfesl()aDrmurpnt4ale moeiyt s ul(vsnu4aetrir oodlatr uvolt)t2xr(o ou1lp  lnesat)s2tmum ;u4tpeo i3ilsfm2um(vpn(4artnmf oytoaDr neo t)setoir nu4llenlnvia( aDrax  ;o4tpe miciydfaDuauvs;t)tetrxrciodoaDe ivsls  2urio no4ap e fctls srraxm ;t4opeomo3tys a umnvo;t4alxoir3oadoat aues s)trur(r3no1om  lfcsatfsDururpoo1tltnmoeiytfa2ulnvp;t)teeoxf3iodoptrlivilt t2xmir3nu1alenlics (fs2rr( pnt0apt  i3tldfmDum(vo;(4tltoxociytfp  ai ols) etrxm3oy4lmte fvilt  rraxm ;t1apenifctyt m2rm(vpnu0aexnxo ootfmte i i ( texo(m3nu1ale  ieiat) rtauro;u1tee moetlsfa ul( p;t)texomr3ty1omD auvs ( srxmio oodlm nmfesat)s2uru  oo4tpt  ocilsfaDranms;t)aeermrciatomDrlu ol( srxr(m iu4apen nvi t s2rm(r nt0alto ieiad s ul( on()aetnmo totfa   u o t0 rtmxmpiu4lltnmncsas aDumu ont0tlxo ieild s ea(vp;u0tlerxrcoydfat aies;(0 2xoxo oudoptnmnvia()aDuaxm nu1aetn f3iat m2emu s t4trenmr totoaD lnvs;s) 2xrxo oydomenlivs ( srrmxmp;o4tlenmoetat s eln sn()teeoxocoa1fate u i ( teuo(r3oo1lpt mnvsa()a2tmxr no4tpxomoctydls uanmo u4 lxoxoctadlp  an s;( trumim3iodapen fcsl( aDrm(rooo4ole iictlt aDeanvs;(0artnxociotfm e n o t) rto(m ou1opt  netlt) rrrurpoo0oex mf3ilt s rau on(0tetoiocoodfaDrli il( trxo(rpnu4optn neiltf rrrx p;t0alxo fctld a rauvp;u)trxrxrcoydomDeai sl( sruoim3oo1ole  nvia( srrm(r ;t0openmfciatfaDem(vs;t0 lxoir3tydopt  nvs;s0 exm(m oudop  mictat)arrr(r ot4tet mi3iad a ulu s;t4tlxnxr3ta1lmD li i (0srumimpoodomte fvtlt)srtmxmo;u1tetn oeiyd sDumnmp;t0 ltrio3oydomt lu s t0s2xoxr no1ameemnvsas)s2tr(mo;t0tleo f3iltlmDrmn pnu4 lxnmf iytlpD  u s;t0setrim no1lleelnvils)a2ta(rp;o1oexnmfetatlmDuanmsnt)tltrmr tydfp rlieol( tetoxr no4altemfeslsf 2tm(ronu0olxomietadfm2ea(mp u4 rtrxociydfpDeaneo ( trxoxo oy4lp  licil() Durxm nu1openioctlt m2emn pn(0 rxnmf3io1lmDeaivols0t2trim oudap  mnesat artmurpnt1aetnmfctasfa2ean on(4 etrio to1fm  aieslt) 2xriopoy4lm emnetl(farurxmpnt1opt  oeiysla ran o;t4arerxf todfp   nvo s  rurxo3iy1omeelnctl( sDur( poo4oeenifeiytla2umnmsnu) lxoxrctytlm  livsl(0srxoir3oudal   fciat  2rrurp;t4tetomoeilslm rauvs;(0artrxocoo1lmt  ivsls) ruo(m no1lm elfcta()s2ua(r no0tpx mi3ils s ranmo () rxrif todfpDeluei ()s2tmir3oo1lpt lnet (f rraum ;o1opxoiiciasls rln ont)arxnxrcoatfmDeaneil( sruoio3nydoltnmivs tfsrta(rp;t0aexnif3ils s el( p;u0tlxomrcio1lmD lnvo;(0 eto(rpiudll   nvs s)s2urur no4tetniociltfa ra( s u) rxnif3iy1faDrlu i;s  exr(r3ny1omenmics t sDtau ono4ape  ieiysls ulums u0alxrifctydopD luei;t srur(o3iu4ol nlivsat sDrm(m ou4oet  o3ias aDuauvp;(0 lerxocoytlptr iesl()t2xmir nu1oltemiciltfs2rrumooo0oleniieiadfa2rau pnu)tetrifciydlmtr ueo;( srxo(m ou1op  mneslt  2ua(m oo4oltoifeils m2eauvo;u4tlxoxociydopDrlnei t  2triopoy4amen feil(  rururpot4olenmf3iatlm2el( s u4 rtnir oa1fmt  ivs;s0 rto(o3io1am nmiet tfa2rm(rp;t1tpeniocias a2ulnvonu4 rtnifctytom e ueo s0s2tmxo oodlptelfeias a2urx  ;t1apto ieiysfs2emnmon(4altoxo3iy1faDe nvi t0srxoxm iudopeemies tfsDrrxm ;o1ape mi3tat mDrauvo;t4aetrxrcoydlm e uvi;(0trurxm iydom e fvs s) rtmxmono1teeomfeiydlmDrau p (4trtnxr3oytoaDrlneol()s2xr(opoy1apeemnvtat)s2raum ;t4apxnmi3iasfa rm( o;u0aexnio3iytomDr i ol( t2urxr iu1amenlfvsls)s2umurp;o0alen i3iltfa el(msnt) etnir iydoate uvols0teto(o3oydop nmncsl( a2taur oo1aex ioeiadla ua(vp;t4treomf3io1opDr uei;s truoxopou1lp nmnct ( aDurxm oo1aet  ieias s2ranmsnt0tlxnif iatoptr neo (0srxr(m3nu1lp emies s a2rmu ooo4oltnifetytla rmnmont) rxrxf3oytlmtranei;()sruoim3nydlmenlncil() ruau  ;o0alxniociltlsDem( o;t) leniocty1lpD  ivo t0trxr(r3ny4lp nmncia()artm(rpot0alenmietyd m2rl( snu) rxnmocoydla rlneols0 rxo(r3iodlmt mneslsfs2urx pnu1optomo3iatfsDrluvs (0treoxocoydfateai sl(0 2tr(o3iudop nmici ()s2tmu pnt0olxo fctasla umnvo u0altnmfcoadlptranvslt)teumxr oy4oltnlnvias s2tru poo4tpeomicilt a eln o;u4arenxrcoodfa elnvils)trxrxo3nudal   neiat  rum(mont1opeo octld sDrmnmo;u4aexrxr ty1lmt anvo ( s2tmxo3iodlmeelnes tfa2truronu4teen ieiydfs raums (0aexoxoctadfm rlu s;t s2umir3iu1lmeelfcia(fsDtrxm ;u4aleomoeiys aDumuvpn(4alxoxfcty1fatrluvs t srtm(opoydlp elicia(fa2tr(rooo1tpxomfcilsfmDuauvo;() rtrxf3oydla raiei;()t2um(r nudolenlnesa()s2um(m ;u1apt moeiltla2umuvp t)altnmr3to1fmDeai s;t0 rtm(m3nudamt lfes t) rrm(rono0aetn octydlaDelnmpnt4 lenxr oatfa elu s;t)t2xm(opnodoltemnvtltfsDra(mont0texo ietas a2umumsn(0 lenxf ta1op   nvol()seum(mpoudolee netat) 2urxro;t4alenii3tytfa emnmp;()altnxo3ty1fat  nes s) exo(o3nydlp   iviat)s2uru  nt1aexn fetad s2rmnms (0tltrio3totfptr uesl(0srxrxo iu1llte ietasf ruax pnt4ope  iciytfmDemnvon()tlxrifciydfp eanei;(0seurxm3ny1lp n nvt t)sDum(rpou1tpxnmictadfa uaump u4 eerxo3oodfpDeaueslt) exrio no4op nmfcslt sDrr(rpoo1oetn fcild a uan snu0 eenmr iydlp  lu i t0texr(m iu4lp  livtltf 2raxm nt4oeeo ieiad sDemump (4 etnio io1oa elivi t t2umirpiodlmt  ivilt a2um( ooo4altnio3iltlsDulnvo;(0 exoxf3oydfmtr ivols0 rto(r3nu4alen fvi s) rurxmp;u0olx  o3iyd s ulnmp;(4aeenmfcoa1lpte neo;t)tetr(mpiydame lfesls srra(mo;u1oetn oeiltfs ul( pnu0aetnio3tatlp ean s;s0 2urxm3no4lm n ivt s) Dtmurp;u0ope  ieildfa2ulumo ()aeenirciatfa   iesl(0trtoxr oo4omt  nctls aruru  ot1tpe  ieiyt sDrln onu0 ltnxr3iydfaD  u o;s srto(o3oydomte ivt sfs2umu ont4aptnmfctysfs ul(mon(0teeoircto1oaD  ueo () rto(m3io4open neslt)sDta(mp;t0aexo fcils sDrlu o t) eeoxocio1omD  ues (  2trimpou4altnmnvsltfsrrrxm ;u0aeto ociat aDem( o (4tltrif3oadoateauvs (0 rum(m3ou4lme lfcil()srtr( p;u0apxn oeiytla2ea(vsn(0alenmf oytoa eli s;s0teuoio3nydalenmfvsa(faDta(r ot1olt mf3tytfa ran pnt) lxnir3oy1fpDeanvilt)sruoxr3no1op   fctat  2umumo;t4tpeo fcildla ean pnt)arermf3tatfate ieo;(0truoim3oo1ap nmnetat) Draur nu0aet iictltls rlnvon(4 exnif oy1lp   nesls srxmiopoo4amteliviatfsDtaxmooo4aeenifeiysfm2uauvp;t4 lxoxf3iy1lpDeln s;s)trtoim3oo4ame mfeias a2trxmoot1tpt ioctatlaDum(msnu) lerifcoytfmDr i i;t)trtrxm3ou1om elfvs s)sDtr( ooo4oetomicildfa2umnmp t4tlenmrcta1fa rli sl( sexrio3iydaptnlics t) Dururpou1tltn feild aDum( p;u)trxnxf3tadlmDr ieols0setr(m iu1lp   fcs tf Dta(moou1ope  f3iatla rm(msn(4 lermr3iadlpD  nvils  2tm(o oydalte fvtls a2um( ooo1opt ioetas a rauvs t0artrxr oo1opDr nvslt0srtm(m nydlme lnet ( srur(rp;t1oexoifciytfmDrmnvont4arermocoo1oat auvolt0t2xrimpoo1llte ivtasfsDrau oot0tetnmociydfs umnvsnt)texoif iodlpte neolt t2xoiopiudllenmfcta(  2rmur oo4tptnif3iytfs emn on(0arxoioctytfmDrauei t)trumxmpiudapenlietl(  rrru onu1tee ifciad a2umuvon()tetoxrcoydlate uvi;t) 2to(opiodapenlnviltfaDtrx  ;o4tle  ictyd s2elnmsnu)texrifcto1faD luvs;t0 eumim iu4lp  mivsasfsDtrxr ;o1aee  f3tlsfmDeaumo t4 rxomociatfmt aueo t)srtoimpno1op  mfvs s)sDtau pot0opt ioctytlm2em(ms;t0trtrxo iy1omte ueo t  exrir3nodap nlict (  rrmxm ou0oeeo o3ils m2emumsnu0 leoiocoodlm  livo t0seumio3oydaptemieils)sDurump;o0tpxniiciadfs ulu p;t)tetrxr iodfpDran slt)trumxo iy1om nmfeil( a2um( pot1tlenio3iys m2el(monu)tlxoxo3oydlmDr neo;t0 2tmxopoydamenmfviat)a2rr(mpot4tltnmf3iyd sDrmu s u0 eeomo iytom  livs;t0teumxo ou4lmtelivs tfa2rmxmp;t0tee  i3iat s2emuvs;u4arenifciotoat  nvo t0teuoxrpou4ll elfviatf 2tmuront4tet mocilsla rm( pnu) eeoiocoydoptr u s t trum(rpoudol nmncilt  Drm(m nt0olto i3iyt s rl(ms (4 rtriociadfpDran i t0 rurim nu4lmeelfesas sDra(mpou4tpe mietytlm emuvsnu4 rtomr3ta1fa  an i;s  ruoxrpiy1optemfvslt arumum ;u0aet if3iyt m ulums;t) lerxr3io1fm raies;s trxrio nudolen ncilt)s2ur(r nt0olx iociltls2rl(mo;t) rermf3oytlmt ln s;s trtr(opoodamenmnctas a2uaumo;o1tlenif3ilsfsDra(vsnu4texnif todlateaues;t0s2xmxm3oo4ol   ncsa( srurx  nu0altnmfcils mDrl(vp (4 rxnmfcoodlp  lies;s) rxm(opiodaptn fcs sfs2tr( p;u4opxomoetydlm2uan p (0tlxoxrciotlp rlu s t  rtm(r nodlpe  fvt s)s2umx p;u4olxnmo3iydlmDua(vp;t0aetoio ta1fmDr ues;s0trtmir iy1olen ivt ()a2trur nt0aexn i3ilsls ea(vsn(0 renir3ootoatelnes;t  2tr(rpnudlptnlfeiat)s2taumpno0teenmf3tls aDrlu sn() lxnmo3iatopDrlivo;s)seumir3oydole  icslsfaDtm( o;o0olx iictlsfsDrmnmo u4tetoxfcio1lpDe n i s sexoxrpiodomt  fvsasfa2tmu p;t1oex mo3tlsfsDea( o;u0texnxociydopteaiei;s0 rxm(r3iydaltemnvs s sDrrumono1aexnif3iasla2eanvo t) rtnio3iydoaDr u s;s  euoio oudapeemies t s2uaumooo4texnio3tas m rm(vo u)trxrmf3iydfmD  ies t) rtrimpiu4lleelnesl( aDtr(  ;u0ale ifciyslm2elnvp ()tltnxr oo1lpDrlueo t)trum(m no4ape mfesat  rua(m ;u4alxomoeiasfa eaumsn(4altoif3io1lm ran i t)srxoxr3oodam nmnes tfsrraurp;o1oltomoeiys a um(mp (4 ltnmf3to1lpt an i s)s2tmxmpiudol elietl(  rtax ont1open f3ildls2uauvp;(4tlenxfcty1fate nei;(  2xm(r3iy1lle lfeslsf Durumono4tetoifeilt aDrlumpn(0aleoxf tydla r n i;s t2trxo3ny4amte fci t)aDrr(mooo1opt moeiysfm2rmnmp;t4 etomf3ty1faD an o (0 2xrxo3ny4lptnliviat)sDua(rono0apt ioetldla rlnms (4aetnif iodlptrau s;s)srtoxrpoo4om n nci s)s2urxr ou4oex mf3iltlsDrmumon(0tetoif3tydfptrlnvo;s)sruoio3oodlptnlieias aDumxr ;u0oltoii3ils mDemnmo ()aeerxf tadomt  n sls0 2xoirpoo4lle  nes s)s2tr(mp;t1teen feildlmDem( sn(0 rxnxr oo1lp elieilt0s2tr(r iodlmte nctls  rtaxront4tle  ieiyd m uauvp;t)trxoxo3oy1fmt lneo;( t2um(m3oo1alt lnvi s)a2uaxmpou1opxniiciyd a eln snt)alxnxf oy1lpD  ivi;s)trtr(r3oydomtn ncs s)s2ua(m ou1apxnmfeild a2rm(vp t4artrxociy1laD lneo s)texoxr nodamtn nvt () 2tr( o;u1tlxoiocild sDea( o (0 ltnmf3tadlm  li o ( s2to(o io1ll nlies sfaDra(mp;t0apto ociysfs rmuvs;t4 ltrifciodlmD luvols)s2xm(opoodom   nciatfaDraxm ;u0texnii3tatlaDrmnmpnt) lxnmrciydoptr ies s tetrxr3nydapt lieias  2rmx  ;u0oex io3iltla2uluvpnt) rxoxf3iodoat  u s;()seum(opny1apeelictasfaDrrxm nt0apxnmoetat m2rauvsnt0 lxoxrcootlm  au ol( t2urim iu1al  mici s sDuru pot0texn octlsfs2rm( o;t4texomfctadlaDr nvo;s) etoimpio1llenlfetltfaDumurpnu4oetnio3iadlm umn p;u4aexrxo tytfp  lu o;() exmxrpoo1ap  livi t)aDta( p;u0tpxn i3tls m umn s u0 lxrxf iodlm rlu sls) rtoxm oodomte iesasfsrumxmpoo4tpe miciad sDumnmont4 rxnmrciotlmt lieols s2um(m ou1olt mfesl()a2trxrp;o1oeeo f3iatlmDraums (0 reoircio1lpD  u s t  rtmxr3no1apen netas arurx ono0apeo oetldfs umn pnu4tltrxo iy1lp   u olt  eto(mpoudolt lieta(farum( pno4ape iiciytfm rlu pn(4texoxf tatlaDran s ()t2urio3oo1llt  fetasf rumu  ;u4alt micildlsDum(mo;(4alerxf todoaDeli i;s)trxoxr iodapt miet tf rta( oot1alxn fcilt aDean o;u4 rtnifciytlp ran s ()setrim3iy4lptnmfvs sfs2tau onu0optn ieiltla uluvsnu) etnxo oatlpD  u s (0srxmir3iu1ap   fesat  2taur ;t4oee  fetlsfs um(vp t)trxrxocty1fm  lies;t0trto(opiu4lptelncil( sDrm(m oo4teeo ictad s ea(vs u)teeomrcia1oa elu o;s)trtmxr nu1olte fcsl( srua(m ;t0tetomoeiasfa ulnvp;(0arenmo tytlmDeanei ()t2xmxmpiy1omtnmnct s) rtrxmoot0opeomo3iltfs2umu p t4 exrxo3oytfm rluei t)s2uo(r iudam e ieiat)sDrmump;o0tlt ioetltlsDelnmp u) exrxrcto1opDean o;s)t2tmxo3ou1apee ivs (fsrrm(mpou0tlx miciatfs umump t4tlxrir iadlaD lies s t2urir3iy1lp elivs t)a2raxmonu0aleomf3iasls2rmnvs (4trtnxr3iytoptrlu ilt0t2urio oo1altnlnetatf Dtmum ;t4tex moctys a eln s t)arenmo3iytlaDrai i t) etoxrpiydlptn nviat  2rr(r ;t0olt if3iyslsDul(vp;t)alxnmr ty1lptrlu s;s) rumxrpoo4om nmnet (f rta(mpno4oet  iciasfm ul(mp;t0aexrxr3oydlmD anvi;()t2tm(m3iodomeelfcs ()aDrm( oou0aeeomfetltla2rau snt)areoio oa1fp ran i;s trtrimpnodapee nci t a2ua(rono4opx mi3ias m um(vs;t4arxnifctodfat aieols texrxmpoy1al  mictlt) Dua(ro;o4alx ioeilsfaDum( s (4 rtoio iodlp eli o s) 2ur(m no1lpeelfvi s a2tm(moot0tlenio3iadlmDuauvp u4aetrxr3totfmt anes s0trxr(opiy1omenmnvi sf Dtaumooo4aexo ictatlsDrlnvo t) eenxr3to1om eau s s srurxmpio1lpee ivt ()srta(ront0tet mfciydfs2elnvsn(4tltoxf oydlp  ai ils0 2tmxmpiu4opee ncs sf Dra(rp;o0aleo oeiatfa ea(vpn()tlxoxr oy1oa   neolt seurxr3nu1ll elnesa(  2ur(mpnt0aet ifetasla2uluvs (4aexnxo oadlpDe neo;s0texo(rpoo1llt lfetl(faDtrur ;t0aet  feiatfaDea(msn(4trtnif ootlpD ai i;s0sruo(r nudlp   ict tfs2tru  nt1tltomieiysla2ra( pnt4 exrxrcoy1oa   i o;(0srurio oudome lneslt) 2tmuro;t4tpe mfciyt a2uau o (4 rtrxf3oydoat  uesl( sexmxopny1altemfvtlt) 2rrurpno4olt io3iytfmDeanmp;u4 etomfcoa1omteau ils)s2xmiopnu1op  lfvta( s2tr(mo;u4apto fctyd a eauvsnu0 etnioctytoptrlnvo s)t2xoxo ny1op emnvt t)sDur( p;t4apto fetyt a2rl(von(4aetrio3oy1faD au o;t0t2ur(o3io4lltemnciatfsrtr(r oo4oeeomfctys a2rlnvs;u0aetnircoydfm raueilt)teurxo3iydll nmivi s  rum( p;o1apt if3ilt a2emu pn()altomociydlaDe i o;t0 ruo(mpiydlp   neil()a2ra(r ;t4opeo feiasla2em( p u0treriocootlmt lueil(  rumxr oy1op n fvs ( a2ta(mono0tleomoctatlsDul(mo;(4arenxfcoatfptr u i;()srur(mpno4amtemfet sfsrua( onu1oex ii3tydlm elnmp u)tlenifctatfpDeauvsls0trxm(o3oydolt lnctlsf rtmumpnu4aet iociyd m2elnvp u0 lxrxf iotfp e n s;t  eto(m io4ol nlnet t sDtrumpou1olx mocils sDean p;u) leoxfcty1opDraueils)teumxo3oy4ll  lnvs tfa2ur(mp;t4oeeo oetltfm eanvs;()aeerxrcoadlmtran il(0 2trxopny4ope lncsl(f 2taxm oo4altnmo3iyd m umn on(0arenirciotomteluvs;(0 exoimpiy4lmte ict sf rur(m oo1opt ifetyslm rmnmp;(0arenmf iy1lmt luesls trxo(opiudlpen fvi (f Draur ;o0olxomfeiydfm rlnmp u)tltomociydfp eai i;s  rtr(rpnu1lp eliesa(faruau  nt0aetniieiaslaDeanvonu4 renirciytfmDelnvils0 rtmxo3oy1alee fci s  rua(  ;u0apenmo3tatlm2ranvs u4 ltnmo3oodop rlu ilt0srtmio3nu4op n icil( arua(rooo0ape  fciltla rmumpnt0 lxoir3iatoa  lnes;(0s2xo(mpoy4lpe lnvsls  Dta(rpoo0ape mfeiatlm ranmp;t0trtoxo ia1la rlnvi;t)texo(o3ou4ll elietasfsDtrxrpot4alx  o3tydlm rl(mpnt)tetnmf ia1fmDe i o ( sruoirpnu4am  lfci sfa2uax ont4tlen oeiatla ranmo (0 renifcoytlpDrlnvsls  eurxopnodoltnmictas sDrrx  ;u4apeo ieias s2elu s (4trxrir oa1lptrlneslt sruoiopio1aleelfci ()aDua(  ou1opxomo3iys m umu snu4tlxoir3oydlp  lueo ()srum(r3nudaleemivils srraumono1tet  i3tadfsDeaumsnu0trtrmf oo1lpt luei s0truoio3iudomte ivslsf 2taxmonu1tpxn oeild a uau on(0tltnxfcoo1latrln i s srtoxmpoydlpte nvtas)aDrm(  nu1tle mo3tyt s uan s () exomo oatomteanvo;s) etrxo3io1ll nmieia(fa2ra(  ;t1oex mi3ilsfa2ea( s;(4artrio3tydla rln i;t) 2ur(mpoodalen fcia(fs2tmurpnt4opxnifciltfs elu p (0arxniocoodomDrluvs ()texr(r iy1lpee ict ( aDrru  ;u1alxoiictlsla em(ms () rxoir ta1opD au s () 2um(r iu4llt  fviat artmur nt0aexnmi3iytfs2emnvp u4artriocoy1latrluvo (0t2xm(r3ny4lpte ivilt  2rrur nu4oeeoifeils mDeluvp;u4tetnifcto1lmDe u olt) rurxm3ou4alt lfcs t)srumxm ou1opeoifeiytfs2ulnmon(4 etnir3oadlptrauei ( teumxmpiy1ale  nvils) rtaxr ;u0oeeo oetls mDelumo;t4 ltnif iodomDeli s;s0srto(o3iodlp e fcsltfsrrm( onu4altnmf3ilslsDranvont0 rtoxr iatlatrauvo;( srtoxrpoodop e fvsa()artr(  oo1aeto fetlt
\ No newline at end of file
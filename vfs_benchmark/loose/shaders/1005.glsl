@@ -0,0 +1 @@
+nei;( sexmxr3ny1optnlfesat sDta(rpot1texnmo3iydlsDra(vp;u)arxomr iydop r uei;s0t2xr(opio4amtelnvi (  rrrumonu4oee  f3ildls ranvp;u4 etnmocoo1lmDelu o s  2to(opoo1ope lnciasfa2tm(r nt0tex  feild a umnmsn() lerio3iodfpD  iei;( srurimpoo1opte ict tf 2tr(moou4oeen f3iyd s2ra(ms;t0 etnmf iodfpDrlues;()t2tm(r io4lm  lictat sDta( o;t0oet mfcild s2ul(ms;(0aeermrcta1lat lneols0srxo(opoydol  mieta(  rrru  ;t4aet mo3ild sDum( o;() etrxr3tatoatr ivol( trtrxo iy1ap nlici tf rum(m ;u1aexnmieiysfsDuanvsn(0artnmf ia1om rln i;s)texmxmpoo4al nmici s aDrr(moou4alxomo3iaslm2ranvsn() exrircoy1oa e nvs;t  2xm(rpoydalt lnci (  rtm(rono0altomoeiltlmDrln o;u4 eeoioctotla e u i;s0teuo(r oo4ope mfvslsfaDtr(mp;t4aetnifeiytfsDul(ms t4aeeomo oy1fm   u ils)trumxm3oy1olen nvsl(  rur( o;u4oexomoeiaslaDelnms;u4trermo3oodfmt  i s s setm(r3oo1lm e nvi (f rraxm ;t4apxoif3ias mDul( sn(4trtoxfctytopte nvi;( trumxr3no1olenmivslt) rrmxmo;t0tlen ociatlm umumsnt0artrxocoo1fpDe nvil(  etrxo3iudame  fetlt)a2raumont4olxo ieiad aDeau ont) rtrifcto1lpDe nesls)seurirpiodoptnmneta(  Duax o;o4opx mietld sDem( s;t0tetrmfcoa1laD li o s0setrxm3iu4omenmnvsa( s2rmu ooo1teeoifeiat a uanmonu4aexnxfciatlp   iei () 2toxm oodlpenmnetl(f Drrum no0aexn i3iad s2eln s;u0tlenirciy1faD  n sls0srto(m3iodopte ieilt  rtru  ou0tpeniieiydlm ranms u)alxoxf io1lateln i t s2tr(opno4lp nmici ()s2rmx ont0opxomoetydls eanvo;t4tetrifctytlmtrlivo;t)t2xm(m3iodamenmnviat)aDrrxrpot1tpeo fetyt mDean on(0trtoif ta1laD luei;t0s2umxo3iydlmt lneiasfa2tmxrpot0tlxomf3tytfsDrluvpn(0 rermo iy1lm r i ols tetoim oudlpen ncta( sDtr(  ot4aptnio3ild a2ea(mon(4 rxoxfcoodopDraneslt)texoxm iudllenmnvslt aDua( pnu1olenmo3tls s2eaumsnu)tlermrcia1lm  luvi t)t2xm(opny4lpte fvilt)sDumx pnu4tpx ii3ilslmDelnmsnt)trtrif3iatoatrai o (  rurxr3iy1ameemfviat  Drrx ooo0apx  f3iyd aDeluvon() rxnxfciadom r nes () ruoxr3iu1aptelfeil()arur( o;u0oeto ociad m rlnmpn(4trtoir3oa1lmDeauei;(0srxrio3ny4ll  mivtatfsDrrum no4teeoii3iydlm eauvon()aexrio3oodfp rlivils srxo(o3io4ape  neilt)artm(r ou4apeomfetlt a2elu s;t4arxnif3oydfa eanvo t0setmio oy1aptelfeils) Draurpot4oeeoif3ilslm emuvo;u4tlxrxfciydoa rlies;( teuo(m iudom elivi ()sDuaxr ;u1tptnio3iad m2uluvs u0tlxrmf3oodomDrai ol( t2tr(rpoydop  lict t)arumxm nu0olxoiociytfsDean s () renio io1lpDe u i t  etriopoy1lm  lnetl()aruau  nt4tpxnioeiasfa2emuvsnu4 eerxr3oy1faD livol() exmirpoudll  mnesas)s2rmx  ;u0olx mocilsfaDrl(vpnu)tetomociytom rlivs t) rtmxr ou1lptelivia( aDumxrpnu1tlt moeild mDem( sn()trxnir3iatfaDelivo;t) rumxm3iu4om n nesl()sDra( oot0apt  ocild a ua(mo;t) ltrmr totoaDr i s s sexoimpiudop e nct t)a2trur ou1apenioetltls2rluvp;t4 lenxocoo1op elivs ( setmxopny1ameemivta(f rrrum ot0aetnioeiysfs2uluvsnt0tlxnio ty1laD ln s;(0s2trxo nodolte ietls artr(  ot0tpenmfetlt a um(monu0 leriociy1fateluei;t)t2umim3ny4omenlict t  Drmu  no4apxomociydlm2rmn pnt4 rtnxf3iadlmDrluvi ( s2xoxr iudalt  nvsl( artaxmpnt4teeomieiad aDua( o;t4 etomr oadopD au sls0truoxopoodopenlncs sfa2urx p;u0tlx mf3iyt s2rmnmpnt4arenio3iatfmDe iei;s)tetmxr oydlmeemfcilt srta( onu0tpto oeiasls2emnvont4tltrmo3iotlaD an sls) exr(o3iodaleemivsls s2trx oou0olxoiictltfs2eluvs u4 leoxr ia1fp eauvi;(0seurxm3io4ale mfesls)aDurx  nu1tpenmi3tat mDuln ont4 leomo3ia1latelu s () 2tmxopiu1lpe  ieta( srtm(ront0apx ifctltlm emu p u)aetoxf iotfm elu o;t  rumxr iodol  lfvta(f 2uaur ot1tex iicildfm uluvp;(4tetrirctotlp elieo;s setrxrpnu4lpenmiviasfsruaumoot0tlt mf3tat m emnmpnu4altrifctadlaDr u il(0s2xoir3iu1lm n fesltfarta(r ;t1aexoioetydlaDumu o t)teenmocio1om e ivi s texrim3iu4lp  mfcsat arurxrpoo4aex ioeiaslsDul(vs;u0 lxoio io1lm ranesls0 exoir oo4lltelnvi s a2umumpno4olen fetldlsDelums;t)trtnxfctotfpD au o;( texoim nodlptemfeia(faDrrumpou0olxniiciat m elumpn(0altrxfcia1omteln i;t)setriopiu4lmenlfvs t s2tru o;t1oexnif3iyslm eanvs t0tltrir3tydfp e u i s texm(mpiydlltnlfvtas)srraump;t1aptniieiyt sDel(msn(0 reoxociodfp  au il(  rxm(rpoo1aleemnciat) 2rrxm ;u4oeto ietydlm2rmu p t4aexoxf3ootlm r nei s)setm(mpiu1optemivtlt  Dumum ot4aeeoiiciat mDrmnmp;() lenxf ta1fptr n ols0 rtr(opoy4lme  nvi s sDraxmont4apx mi3tytlaDea( o u4altoirciodlpDeau o (  rtrxmpoy4apenlies t) Dtm( p;t1tpe moeiat m rauvs t)tetomr3iy1fmtelivi;() rtoxr3oy4amen neils) rrm( pnt0opxn f3ils sDumnvsnt4tlxrmoctatoaDe iei;s0truo(m oo1lptemfciatfsDtr(mpnt4tpeomf3iasla2raumsnu4trtrxf iodlptrlieo t0 eum(o3oodll n fvslt aDuaurooo1oetnmfciltfsDum(mp;u0tltoif3iotlp elues;t) 2xmirpio4oleemivi (  rtaxront4oex mociasfsDemn s u4aetoio ta1lpt  nvs;t)setr(o iu1altemiet (f Draxmooo0ope  fcias m2raumo t) leoxfctytlmDrauvils setm(opoy1amtnmfvi s  Durum ;o4aetn o3tls sDra(vpnu4teermo oa1fate ues;t s2tmiopoy1lm   ietatfsDtaxro;o1opxoioeilsfa ran s u4tlxrmr3ta1oa rlivi;s srtmxopiu4optnlneias)aDtmxmont4tltnif3iysfs ua( on()aetnmo3oa1fa rln s (0s2umirpoo1aptnmicsasfaDra(r ou1tltomfciys m um(vpnt4trtnif tydoaDelneol(  2urxm ny4lpenliviltfs2ur( o;u1tpxn feiys m2ranms u4trtnmf3iatfatr ivo;s0 etoir3oodole livt ()aDtaxrp;t1tlxoifetatfsDra(vp;(0arxrmo3oatoaD  neils) eurir3oydal nlnci s aDuau poo4aexoio3iaslm rlnmo u4 rtoxr iy1lm elnvi;s)s2uoxo nu1amenmfcsls) rtrx oot1tpeomo3iasfs2ea( s;u4 lxrmfciodlmt auvo s0teumxm3oy1omtelfvi (f Dtaxrp;o4olenmfciyslsDulnms;u4alxrmo tatoat anvsl(  rxmimpiydam   nvsatf rua(m ;u1tlxoio3iad s2rlnvs;u4artnmo oy1fm rlu sl(0trtr(m iydlpe lnvsls) Dum(rooo4tpe ifeilt s2rlumsnu)aexoif3totfpDeluvslt0s2tr(r3oudlmtelfvsl(fsrua( pot1oeenmf3iaslm2ean p;() lxoxociy1om   iei;s0srurir3nu1aptelnes sf Drm(  ;u0ole  i3iadfaDrln pnt0artomr3todoat ai slt0 rurio iydopee netlsfarurur ;u0tltn fctatfsDranvont4altrif iy1oaDr nei ()srtr(m3no4am nlicils sDrm( oot1aet mf3tldla2ua(mp;(4 exnxrctadfmt anvi;t)s2tr(m oudlpe mfcs ( s2rm(r no0openmfctatfsDua( p;()alerirctatlatrli i t0trur(r nydlp elivs t)aDum(  ot1texn o3tysfs2ul( onu4altrxoctydlpD lies s  rtr(rpiodop nlnciltf rtrxm nt4alx  feild sDuluvo u0teeoxf tydlpDelivi t)trxmiopoudamee ivs sfarta( ono1tpenmo3iadfsDrl(mp t0 lxoiociatlaDeaneo;t  rxmxm no4ome  iesltf Dum(r ot4tpenif3iyd mDemumsnt4trxnirctodlate uvi s)seurxo3ou4omtnmiviatfaDtrumpot1tee iociatfa el( o;u0 lerxociodfate i o;s) 2urxmpoy1altelivsas)srra(monu1tpeoii3iydfmDrlumpnu0aetoifcoatomD  nvi s srxr(r3oy1amt mneil()a2uaum nt0tpt mictadla2rm(mo;t0arxniociatlptelneolt t2urxmpnydlptnlict tf rrmumoou4oex  i3iysla umn s;u0trtomr3io1oaDrli ils) euoir iydlp  mieil() Dumumpot1olto ietad s eauvs;u)aexnmo3iadopD lnvi ()setrio iy4oltnmnvil(f rrmxront4apenmociydla2ea( p u)alerxfctytfm e neil( teuoxo3oodlm  mfeils s2rrur ;t0oexoif3iad a2uanvo;()tlerxf todoa eaivi;(0trtr(mpnudll n ieilt)s2rrxro;u0tlenmociaslaDrm( s t)aeerxo iydlptraivi t0srxrxr3oo1lptnmiei t  rta(r nt1openioetyslmDrau sn(4 rxnmrctadlm   ivo;s0 2xrxm3iu1ol   fcils sDra(r ot4olxoiociltfm el( p u0 lermo oy1oate ieols)t2xmiopio4amtnlieslt aruaxmono0tpt  ieiaslsDrlnvsnt4 exomo iotla raueo;t0tetoiopiu1ol   feil()arrr( oot0oeeniictls a emu on(0 lenxf oadfmDr ivs;s t2xr(o oy1altnmncia( aDtrxmpot1apx  feias a2emu pnt4tlxnmrcio1la ranvols  2uo(mpio4om elicta(f 2rrxmpno4optn ietltfa2rau p (0 lenmo tatfpD aneils setrio3nodalt  fcia(  Drr(ront0olt ifctys sDemnvpnu4teermo ia1fmt  i s;s  2toir nodlpt lnviltf rrauro;t0oltnifeiyt a ea(mpn(4aexomocta1lat lnvi t)setrxm iodoltelivias)arraur ;o1ale io3tyd a el( o t)alerifctadopt ai i s) etoxm3oo1lpen ncilt  2umx  ;u4oeen octyt s2ulump t)trxomo3oodlaD  nei t)seumim oy4om elieil(fsrta( p;t0ole mo3tltla ranvo;(4arenmociodfp  lnvolt0 etm(o3iu4opte fet s srtruro;o4oltomfeiadlmDul( pnt0trtoxo3ty1op raneols)tetoim ou4amt lneta()s2rmxmpoo4oet mieiatfs ra( s u4aeeoifcoytfpteauvo;s)trtmirpno4lmtn fviasfarrm( ooo0aet  feiatla2rlnvp;(4arxrxociatfpt lueol()s2urio3iodolt lnvil(f 2rmum nu4tlx iiciadfs2rmuvo;u4 leoir3tydoaDranvi;s0 exmiopio4omeemicsl(f Dtmxrono4tetnmf3iatlsDuluvo;u4artnmocootlmt  i i;s0 rxrir iudlpenlieiat srraxr ;o4aexo o3iytfa2rm( snu4 eeomrciotlm   ieo;( sruoxopnodlmeelnviat srur(  ou0tltnmf3iys s rlu snt)tlenifciy1lmD ln o;t0 rxm(m ou4ap elictl(fsrua( ono0tltn i3ild a um(mp;t4trtrif tadomD an i t0 2xmxmpiodole lnvsls  rurxrpou0altomiciatfa umuvp u)trtnmo tydlp elies t)seurim3ny1lm nlnctasf 2trx  no0aeeoioetaslm ean pn() lxrmo tatomtrauei;s trtm(m iu4lltn netls aDur(mp;t0tptnmf3ils s2rmuvsnt4 exomr ia1optr i olt  rumirpio1omen ivil(f Drmu ooo4alxn o3ilsfs ea( p (0 etnxrcty1om eliesls  rurxopoy1ll nlivtlt)aDur(rono0alx mieiadfm rmu s (4aetnxf3tatfa raivi (  2xoirpnu4ope lneslt aDur( pnt4tlen f3tysfa umn p u)tlxrxr3todfaD au ols s2xmxo3ny4lme micias)a2trx  no4apeomfeils sDulu sn()tlerxrcto1fm  aivs;t)tetmxrpoo1lmt mnesls) 2rm(rp;u4tlen o3ilslm ea(ms;(4trxrmfctytfa  ln i ( t2toxrpny1ale  ieilsfaDuaxr oo0tpenmi3ilslsDrau o t4tlerxr tatlat  iei t  etrir nodllen iviltfarur(r ;o0apx  o3iytfa ranvp;(0aeerxoctodlpt  ivo;t0 2xm(mpou4am  lfcils)aDtaxm oo1apxo ocilsls eaumo;(4teenio tadlmte ueslt s2umxmpnu1ol   fciltfarum( oot1texomi3ias s2rm(vp;()tleomr oytfmDrauvi s t2toxo oo4aptn fcsa(  rtrurp;u0tltniietatfm2emnmonu)tlerxr3to1om rlivol()t2uoiopiu4oltn nct (fs2ta(  ou1tet  fcias aDua(mpnu)arenmo3to1lmDr i il(0 rxo(o nu4ame mfetasf Dtrx pou1texn ietat aDranms;t) ltoio ootlaD lues;s0sexmirpiodame mnct t)arua(rp;t1apeo octad s2ra(mo;t4aleoxr3ta1opteli i;s t2xr(r3nodaptemnci s artrxr ot1aex  f3ilslsDul( ont)tlenxrctotfat  ieols0trtoirpiy1al elfvils) Dtrxrp;t0tpto i3iasfa2rm(mo;t) exnmrcoodoa  an ol( trto(r3io4lmenmncsasfs2rr(moou0apxomo3iysls2rm(mp;()artnxf ta1lat aivo (0t2xm(mpoudaptn ivil()srra(mpou4aet  feiatlaDra(mp;()tetrir iy1lat ai i;s) eumim3iy1ol emivilt)s2rmu  oo1opx moetad m2rln s;(4 rtomr3iatomD  ieols)t2ur(opiu1llenmivil()arrauro;t1tetnmociys m umums;t0altrxo oo1lmt lueolt t2urxm iu1aptn fct tfa2rr(rpnu0oetnmoetyt aDuln p;() exrif todom   uvi (  eurir3oodapeelivtas sruax  no1apxnmiciys m ranvo u4alxomrcoa1oa r i i;( s2trio3io4aptemnvtat aDtm( oot1opxomoeils s2rluvo;t0alxoxf oydlpDrlnesl(0s2urxm oodamte iei (fsDur(rpot0tee  ociys m rmuvonu0trenxr iydomt aues;()seur(mpiu1amt  fvs sfs2urxro;t0apxo octytfa2uanvs;u0 rxnmf3oa1optr iei t0s2toimpoodaltelicta(fsrrau  ;t4opt  ictld s ranvo;(0tltnifcia1fpD  uvs;t s2tmxr3oo1om  mivia(  rur( pnt1tle iicilslm2umu o (0texoxf iatopD  nvs s texo(rpiodlpeelnvi ( srtr(ro;o0tpen oeils a ulu pn() rtrxf tydopDe uvs;s0 eumxr iu1amenmnvsat  2tmumpot0apxoio3iadfa ra(ms;u4aeeoxf3iy1omt auvs (  etoxr ou1lm  lfct t)arrr(mooo4apenmicilt s2rlnms u)tlxrmr iotlmD livi;t0 rxmio iodalt lnctl( sDtrxm ;t1aeenif3iyd m umn o t0tetnmr3io1optrlivs;t0texrxo3oo4lptelnctas srtrxmono0alt miciat mDrm( p;u) lenxr3todopDe nvils0seuo(opoodam n iei t)artm(  ;u0ope io3tytfmDulu snu)arxoxfcty1lp raies;() 2urir iudap n nctlt aDtmxmp;o0oet  o3tlt m2rm(vo;u0tltrxr3ootomte uvols)sruoio io4llt mivt t)sDtmumooo4tptn oeiat a ra(mon(4 lenmr3oy1fpDraieo;() euoio iudolenlnciat aDumxrpnu1ope mfeiadls2ea(vs;u4 ltnif oydfp eanvi;() 2xrirpiodaptemieilt) Dtaur no4oeenio3iasla2uanvo t0 lenxfcty
\ No newline at end of file
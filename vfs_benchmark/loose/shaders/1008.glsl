@@ -0,0 +1 @@
+ues t)trxr(r3oudlmen nvs sf 2uauronu1altoiictysla rlnvs;t0aetrif3totoptrlnvils0 etmxrpiudal elncsl()s2rr(  ;t1aet  icilsfs raums;(0 leomf iytoa e n il()s2xoxm iu4ll e fcslsf Dtau  oo0texomiciyslsDea( p u0texoxo ia1opDe u i;s teuo(mpiy4om elnes sf rtrxm nu4alt  oeiadls2eauvon(0teeoir3todfpt  i slt texr(m3iy1opte neils  2tau p;o0apxnifciasls umump;u4tlenmrcia1omDraivo () 2xm(o3oudap nmnei t)a2umxroou4tlxn ictlsfs ua(vpn() etrio3oatoaD  u ils  euoxopny4oleemfeias a2ur(r ;o4ole  fciytls um(vs ()alxnxf totom rlnvs;s)tetoirpiu1ol nlnetlt srrm( o;o4aex mfctytlm ulu ont0arxnxf3ia1op rluvilt0srto(opoo1al e nvsl()sDtr(mp;u0oeenif3ildfm2eau o t4aexoifciotoa eai ilt)sexoxrpoo4oltemnesl()a2taxr ou1oeen ieiysla2rlu s;(0 rtrmo oatoaDrlivo ()t2urxmpnu1altelfvtl()sDrrxmp;o1oetnmiciyt s rmu s t0 exrxocoatlatranvo (0s2toim3oo1lmt  iet s s2ra(m ;u1apt iocilsla2uln o u4tlxrxf iotoat an i s)trxmirpoy1ameemivsat)aruaxmp;u0tptn ieiadfsDemu s;t0 rxrmo3ta1oaD liei s0 exo(r ny1optnlfct sf Dtrumpoo4olxn fetat m rm(ms;(0 ltriocoytfaDr nvo ()teuo(r3oy4lmt lnvs t)sDtrxr no0tpenmo3iltfsDeanvs u)altoxo3oadla rlivo;s  etrxo3iodllenmfvs sfa2taxr nt0tpe io3iad s ra(ms (0tlermf oadlpDrlnei;t) 2xmxr3iu1lm  mneiat srtmurpoo1ale  ieild a emuvs (0 etoxf oo1fmteanvol( s2xmxm3oodlpt mfcs ( a2tm( pot1aeenmicildfsDelumsnt0texoxo to1fa   i ol(0 eurxopiodll elncslt  rua(m ot1opxoiiciatls el( ont4altrxo ta1oaDe iei s0srtmir oudop e fvt t)sruax ooo4aptnioeiasfa2elnms;(0alxoxr3iy1oateauei;t teurio3nudlm   icsasf Dtmumpnu4opx  ictatfa2ulnvpnu4 eeoxo3ta1lmDrau i;( trxrxm3oudale mnet t s2uaxr ;o1tlt ifetls a umnvs t4 etoir3tadlm rlies;(  rurxm3oo4aleemiesas  2ra(r no0alxo ietat aDrlumo u4trtoio3oatlm  an olt s2urxr ou4omtnlfct s sDra(rpou4tlt iiciys a2ran o t4 eermo totoptraies;t)trtmim3oudlpeemfcta( arumx  ;t1teenmf3tlt s rm(mon(4aexnmrciotlm   uvo t t2xmim3iydomt licsls) Draxrpnu4olx  i3iysfm emumsnu4 lxrmo3io1lmDelnvi;s) euo(o iu4lp e nvtatf 2uru o;t1tltniieild aDrl(vpn(0 exriocoytlaDelivol()tetoxm3nydoleelietasfsDrmxrp;t1apto f3tyd s2umu snu)tetoiocto1fpt  n o;s srurxm ou1al   net ()srumur nu4tleo ictatfa em( ont)arxrxr oadfate i s;t)s2trirpiydapee fesasf rur(mono4oet if3iytfaDeln snt4 eenxf iadfm  aueols0sruo(r iu1alt lfesat  rtau o;t0tpeniocild s2emuvp;t0 eenmf3ta1omt luvi s0 rxmxrpno4lpt lnvs (faDrmump;t1aex  feildfsDul( p (0trtoxr to1lp  livs;t teur(m3ny4amtelnciat  Dtrxmo;o1oeeomi3tadlaDea(mp;t)treoif3tatoatrlues;(  exrxopou1lptnlnvt s s2rmu p;o1altnio3iyt sDumu s;u)alxnxr3iotoptranvi;(0 eur(o3iu4ll nlnctl()s2rmurpot0tee mo3ils a ul(mp t0 lxrmfcoatla eanesl(  rxrim oodlme mfeilt)s2ra( oou1alx ifctldls eaumpn(0 lenxr to1laD ai sls s2tr(r3nu1opt  fvs ()s2rrum oo4tlxomicildfsDuln p;() ltnio tadlm   i s;( trurxopiy4amt lfvsl(  Duaxm ot0altoio3ild sDuln pnt4 rtrir3iytfpD  nvs s0 2to(r3ou1omt  iet sf rur( oot1oltnifetytls ulnvpn(0tlxrif3oa1fpDelivol() 2umio oo1lmt livtls)sDua(m nu1olen o3tls a2eln s t)teermo io1op  aivs;t tetmimpoy1opt mfvt ( aDua( p;o4aptomfciat a emuvpnt0alermo oy1fatr ivslt seurxr3nydomt micsas  2taurp;t1tpx ii3iat s umnms u4alerxocoa1lp raies;s  2um(r3no1am  mnesa(  Dua(m ot4alenioeiadfmDean o;(4teerif iotlmDr iei (  exmimpiu1ale micilt)s2ururp;t0aeeomo3iyd sDrln sn()alenio3oodfm rai o t0 etm(r3no1am  mnciatf Drmu poo4tpxnmo3iysfmDulnmo;t4 etoxf3ia1oatr n s;s)srxoio oudop  mictasf 2trxrpnu1ole ifctadlsDea(vp;()altoir iadop rlivs;t0srtr(r3iudalte nesl()a2raxr ot0aeenmi3tlsfm2el( o (4aeerxr3oy1fmDrluvolt  exmxr ou1ap n fci (farur(m nu0tex if3tat sDuanmpnt)aexomf totla r i o;t  rto(opou4lmenlfvt sfsrtm(ront1oex mictaslm rluvs (0alenmf3oy1omtrli i s)s2urxr no1altn nvsltfsDtr( oou4aeenmieiydlm2em(mo ()alxrif3tadfmD lieils0 ruo(m ny1lp e neia() rurxmono1oetoiiciadfm2rl(ms;u0artomrcta1la e n o s)texm(r nodopenliviltfaDrmu  nu1ape mictadlsDul(mo t)tlxnmf ia1op eauvs;s)t2xrxo3nu1apte fctl()a2ra(  ;u4apx mociydlm ulu s;t4trtnmo ia1oate u s ( srtmiopoydlleelfvslsfaDta(mp;u0oexomieiat a emnvp;(4tlxoir3oatfaD  i s t s2xoimpoy4ole mfctls srtr( onu4apt mi3iytfm2elu pnu4alenxr3oadoaD  i o s0srxoir iy4lp emfvi t) rrrxro;t4apenio3ild mDel(vp t)trtomo3to1fp r ivslt0 euoio iy1ll emfetls sDrmx  no1oleoifetyslaDrm(mpnu4 lxnmf tatlptelneo s0s2um(m3iy4omtnmicilt)s2rm( p;t4apx ifciys a ea( p t0tltnxfciytlp  ai s (0 2xmim3ou4ap nmicia(  2ur(mont0tex  oetlsfaDrluvsnu)aetnifctadlaD aiei;t  eumxo3nu4optelncs (f rum(mooo0apxnmo3iysfmDumnmo u4artnifcia1oa r u o;( srtm(m3oydopeelnetlsf 2rau  nt0alxo i3taslm ulu p;(0trtomfciydopte i slt)srtm(rpiudaltn nvta( aruax  ;o4opeo ocils aDrauvs ()tltnxo3ia1opt  u s t0srtm(r iy4om elieil( a2rmu  ou1opxnifetltls el( snu0 rtrxo3oo1fat  u s;( srxmiopoy1omee nes s)artrxront0alt  ieiytls ean o;(0tleoxociatlpteaneo ( t2xmxo iy1ll n icia(  rrru ont1apxnif3iys m2rm( on(0tetnmr3iodfm eli s t) exrir iodoptelivt s s2tm(r no4aetn i3tat m rmnvont)tetoxrcoy1omD au o t) exmirpnydlpt lnciatfaDra(  ou4teto ieiatfa2umnms;t) etoio tadlm rlnesl(0 eumim3oy4ape mnesa( srrm(  ou1texo o3ils aDrln o;(0teenxo iadlpDe nesl(0srto(opny1ame  fvi s)s2rax o;u1open oeiat m ra(mp t4tlxoxr tadlmDr nvs;t)s2urxr3no1aptn ivt sfaDtm(mont1alxnifctyslm rmuvs () etnif oytlaDeli slt)sexmxr3oydamteliviat  Dtaurpoo1oexoio3iatfaDeln o (4 lxrxrcto1lat  n ils)seuoiopoy1lptelneta(fsDtrum ou0tlx if3iadlm rlnmo;u4texnir3iotfp ean sls0trumxr oo4lm nmfvta()aDrr(mp;u0aptn o3tasfs2ea(vp;(4 ltnif3io1oat li s;t)t2umxrpiodllen fcias)a2tmx oou4tetoifciys a rmu on(0 etrir3ty1lmtrluvo;t0 rur(r3ou4op e net s artaum ot1oexomieiadfsDemnvs u)aexoxr ootlmDe ueo;s  2uoim nu4opt  ict () rtmxro;u4oee mieils m rl(mo u0texrir3iy1laDeanvs;( sruo(o3iudoltemncs t s2uaurpno4tltomoeiasla rluvpn() eenir oatopte i ol(0teum(o iudopteliesl(  2umxr ;o0teeniiciat sDranmp;t4alxnir3iytoaD ai i;t0s2xmxo3nydlm  mnei ()sDrrxm no4alt ifcias m2uanmont0trxnirciatoatrluvo t)tetmimpno1apt lfei (fsDrmxm ;t0opeo feilt m2uauvs t)tlermo oodlptr uvsl( t2toio io4ame  iviltf Dtr( poo0optomietyt m2um( pn()trtnif io1oa  au o ( trxoxrpou1ope mivtat) rrau o;o1opx moeiatls2rln s t4texnxo iodfmDrlnvilt)s2urim3ny1apeelnvi t arta(ro;o4aeen f3ias sDumuvo;(0arxnmf3tydopD  ues;t  rto(m3oudllee ict (f 2uaxro;o0olt  fcildfm2eanvs u4tetomo ta1omt  n i (0 exo(o iu4lp nmiviatfs2um(mp;o1aexn fciysla uanvp;()tleoxf tydop  livo;(0t2xmxo3ou4op  mnesl( s2uaxmp;o0altnif3iltlmDulnms;t4 etrmocoo1lm   ueo (  rxo(o oy4ome lncsat aDtmxm nt4olxnif3tytlmDraumonu) rtnif tatop  aies;()srxmxm oydomtnlivt ()a2uaxronu1tpx miciatfs em(vs;u)texnmfcoytla elnei;s)truoxo iudol e nvta( sDumxmpnt0olt iicilt aDrlu o u0texrxo3oytfaDe i o;()t2toio3nudlptnmict s  Drmxro;u4ope  oeiaslm2ranmpnt0aetnmf ootop eluvs;s texoxmpiy4ale  ivilt) Dtaur ou0optomfetls aDrm(mpnu0tltoxf3iatlm  au o;t0srxr(o ny1om emfvtlt)s2ua(monu1opx mfeiadfmDel( p (4texoio3oy1lpte n s ()seumimpoydlp elfctl(fsrtmu ont0alxnmfciys sDulump;t0tetrmr3oo1fm  livo;s) 2umio nydlltemici (f rtrum oo0apeomoeias aDea(vo u4 rtrmr3ootfm rlu o;s0 eum(r3oo1apeemfcil(  Dtm(r ;o4apxn o3iltfm2rlnmont0 exrmrctadlm r n o;s0t2tr(m iu4op n ies ( a2tmxr no1aptn i3ias m umnvo;t)texomo3todfmteaueols srxmim3oodalt livsa( sDrmxro;u1oee ifctyd m uan s () ltoio3iotlmD aivs;t0t2uo(mpiu4olee fcilsfsrur(m oo0olxoii3iysfsDelumonu4teenir tadopDeaiei;s s2toim3oydll nmfctls)srtmumoou0apenmi3tasfa umuvo () eeomf3oo1lptraieo;( texr(r3io1ap emiciltf 2uauro;u1tpe ii3iytlm2uluvs;(4arxrif oytlptraieo;s)s2xrxmpoodap n ivi (  ruaxr no4aex io3iatfa um( o;t4arxriocia1fp  luvo;s0t2urxo oydaltnmieiasfaDtaxr ou4tpt if3ildfsDrl(vs;u)artomo tatfp eanvs;(  rxoirpoodlmen ivilsfaDtrumpnu4optomoetldlmDrm( ont)teeoxf oa1om  lueo s) rxoimpoo4ll e fcta( sDrmu  ;t0aee ifeildfsDulnmsn() lxomocta1lmDr n ols) ruoxr3ny1ll nmiesa()s2rr( oou1aet micildfm2elnvs;t0 lxnxo3oadfaDe ivo ( trxrxo3oodoleelfcsasfaDtm(  ou1tet if3tlslmDuluvsnu)alxrxo oy1fmtelueo s0s2urim nu4omen nes s aDrmu ono1tpeomieiyt a ul(mpnu4arxoiocoo1fpteai il(0trto(m ou1alt mfct ()sDtrx pot0olto oeild s rm( s;u)alermr3iodoptraneo t0 exrir3oy4ame lnetls aDrr(mpnu4tet mi3iysla2emumo;t4tetrxf3iatopt auei s0 rtr(o3oo1amen fctls)aruaxrpnt1apxnioetls s rln ont)trtoxo iodlmDrli s s seto(rpio1om e nvilt aDrax p;o4alx mi3tytfm2umumon(4 reoif oy1fptran i t)trtm(opiu1lp emiei s)a2uaxront1oetnmfciasfm emn o (4 exnir oytfateanei s0 2um(mpnu1ap   fctl( sDta(rp;o4aetnmictls a uanvo;t)tlxoxo3ia1lmteauvo;s s2uoir oydapeemfvi s) rtmumonu0tpeo oeilt m emump (0aexomo iodla  ln s;(0 2toxrpiydolenlnetat)arta(mo;t1tltomfciadfsDrmnvsn(4texrxr3oatlpt li olt0sexrxmpio4amee iviatf Dua( p;u0opeo fctadla rmnvs (0trerxo ia1lmt  nes;s trurxr3oo1lme mneia() ruaxm ou0tptoio3iasls uauvpn(4 lenmo3ootlm  an il(  rumim3oy4al n netas) Dumx ooo0altoii3tltla umuvsn(4aeenifciydom   n ol( s2tr(r oudlp n ivs s)srrrxmp;o4tpxn ictadlm ranms;t) rxrmo ta1fmD an s;t srxrxo oodamtemnetlt)a2tmumooo1tlt  fetytls2emn p t)alxnmo3oydfmtrlueolt)trxrir3oy1amte iei tf 2uaxm ;o4tpeomi3ias s2el(vs;t4 rtoxrciadfatrlieil(  rxoir ny1ome miesa() Dta(m nt4tex  oeiatfa emuvp (4 eenmr oy1fatrluvo s0s2xoxo3ou4ap  mfeia(f Dtmxmpnu0olenii3ildfaDumuvo;(0tetnio oytlpDe n o s0sexo(m iy4ll n nvs ()arumx  ;t0opxn fetltlsDuanmpn()teeoircio1fptr iei s)trtoio3io4lmte iciatfarururpnt1tlt  f3tltfm uaump;t0alxoif totfmtr nvs;t)srtoirpnodap n ncia(  Draxront1ape io3iatls2rmn p t0trerxr3oodomD aieil(0 exrimpny4am  mivt t)srrrurono1aleomoetys s2rlnmsnu4 lenxo totfpD ln i (  exoir oydomee fetlt) Dua( o;t4oeenmoeilslm2uan o;() etoircto1fptrln ilt seuoim3ou1aleemicil() rtrxmont4aptnmfeiatfa2ulnvo;u0trtrxr3iodlpDrau s t0trtmxr3ou1ameelnciasf rtaxmp;u0oetniieiyt mDean p;t0texnif oydlpDranvs (0s2xmiopio1om  mncil(  2ur(m ot4optniictlslsDuln p u0texnmo3oodfm rai olt)teuoxmpiydomt  ieslt)a2umu  oo0tex io3iydla emnmont)alxrirctodomt  uvs ( s2umirpnydaptnlicta(  rta(rpnu1tetoif3iys mDra(mpnu0aexomfcoodomt lnes;s0 eurimpnudll  mnviat)s2tru pnt0apto o3ilt a ea( pnu4artnio iatlp   u sls s2xr(m no4lmt  nei tf 2ua(  ou1altn feiyt aDul(mp t0trenio tydfate ieslt) 2xo(m iu1lp   ict s)a2trxmpnu0tlt  oeiadls em(vs (4 etnirciotfaD  ueslt teurirpoodomt miciat  Dtm(m no0aeto octlslm uln p u) leoxo3oydfp  lueil() 2xrxm iy1llenlfci ( sDuaump;o0apeomoeiytfmDeau p u)alxrmr3ia1omD  n s;(0 2ur(m3ou4lpt  nctas)sDuru  no4aexnifeias a emnvo t0arenir oodfatelu o;()teuoxr oo4amtnlfeta(fsrtm(r ot4ape moeiyslsDeluvo u0aexnmr3totfmDr uvol(  etoxm3ou4alt  icta(f 2umur ot1tpxnmoctat aDra(vp (4tetoxr iydlm rluvo t) etrxm oudole  fei t  Drm(mpot1optomo3tltfa uanvp;u4arenir todlateanvo s t2to(o io1lp e fetas)a2raumo;o1aetnmictasls2ean onu4arxrio3oo1lmt aies;t)tetoxr iydlptnlict tfaDurxm no1olxoifeiys m2eluvp;(4tlerxoctytfateaneo;s trtoim iy1ap   ivslsfa2rax  nt1tet mf3iltfs2rm(mo t4treoxf3ia1lpt  u i;s  2uoxo3nodlp nlnesa(faDtaxrpoo1tee ifeiatlm2umuvsnu0tetomf iotfpDr ivs (  ruoxr oy1lp e fctl(f Dua(mp;t0aexo ietas s eau s ()texomfcoydoa r u sls) euo(o iudop   netlt) rum( oou0tlt mieiydlaDeauvpn(4texnif iadopDr ivi;t s2xr(opno1ame  fvtl()sDrrurpot4open iciadls rmums;t)tltrxfcoytfaDe u slt)trurio3ou4apt mfct sfaDraumpnt0oetnmfetlsla ean s;(0aexrir iodfm rlivo;s) 2xo(r3oydomtelnetat)arrr(r nt4tlenmf3iltlsDul(vsnt0 ltoxf totoa rlivolt) 2um(rpnydap   fvi t  Draum no0tee mfciydfa em( p (0trtomr totom  livo;t  rumxo ou4lm   iet sfs2trur ou0apxomfeiyd sDrmuvonu4alxrxr oy1lmD auvi;(0 2um(rpiu4lpe licta(farrm(m ;t4tpxoif3ildfs2rmu pnt0tlxnmo3tatop  lu s;s s2ur(mpio1ll elictasfartaur oo1aexomicils a raumpnt) exoxf iodlm raivs s)s2urxopnudlpt livsat)aDtruro;u4apeoifciydfm2ranvp;t4arenxfctytopDranvi;(  2xmirpoodamtemfctlt)sDur(ro;u4opt ifciytfaDumu ont0 eeoif3oo1oaDr ivs;t0s2umxopno4ape livs ()aDrm( o;o4apxn ietasfmDumu p u)aetrxr iydomD aiei ()s2xoir io4op  lfcils)s2rrx p;t4opeoiietltfm ra(msnt4texrxr3to1la  luvi t0 eumim io4lmeelnvt (fa2ua(mpnu4alxo octysla rmuvsnu4 ltnifcoydfmDr iesl(  exm(o iydll emfvsat arrmxm no1opxnmictlsfs ran o;u4 exrir totlat  nvi t)texoim iy1ame  ictlsfa2raum ot1olxomf3tlt a rmn s;u0 etnir3iatlpt lu s ( srumimpnudalen ici sfsrtrxm nu1aetoifetadlm rmuvp;()trtoxrciadlpDeau s (0srurxr iy1ope livtl( aDtmxrp;o4tlxn f3iat m eaumon(4artnxrctotopt au i s)s2xr(o3ny1lltelivsl(fsrraxmo;t4olen fetlsfs ulu s;t4aetoxf iytlpteai i;()teumir3ou4optelncil(f rurx ont1olt mfetyt a emn o;t4tltnmr iydfm raivo s0seur(m oy4lmtnmfetl( srua(  ;t4tltniiciatfaDea(ms (0alxoio3todom eaieols0s2xrxrpno4ome mfcia() rur(moou0opeomfcildls2emuvs;t)tlxnio oa1opD au s;s  etmir ou1open nvtlt)artmxrpoo0apenmo3ilslm2rlu s u0texoio oytlm rlueolt) rtmir3nu4am   ictat  rrr(ro;t0oltnioctyd s el( o t4 lerir3oa1fmD livils)t2xo(o3oy1ap  liei t)arurx p;t4texnifeilt mDulump u) lermf oydopDeluvo t0s2um(rpnydomt lfct s) 2urur nt1oltoifeild m2rm(mon(4altrio3tydfa e iesls0s2xr(rpnodlleemnetltfsDumxmpnt4tlto i3iadlm2umuvsnu4tlxrif oy1opDeauvo;s0 2xr(m3no1lleemfeilt srtm( pot1tet  ieildfa elu p;u0trxnmf ta1om ranvol( seumxo nodope lfesa(  2trx oou4tpeoiiciltlsDuaumpnt0altoifcoadoa raneil(0srurim ou4am n ivt s) Dtru onu4tpx  icilslmDul(vpnu0 rerxo3todlmtrlnvo;s0srumiopno4alenlicsls srurumoou1tpe mi3iysfa ea( sn()trermoctydfp eau o;(0 etrirpoy4amtn ics (f 2rauronu0tpxo feiys m umuvs (0 exnxfctadlm eluesls0setmxo nodoleelivsl()srrmxmoot1aptnmo3iadfs ra(ms () renxf3iy1om elnvil(0srxmirpou1apenlnciasf rum(rono1apenioctld mDrmnmp u0aeeoxr iy1lpDranvi t  2xr(r3nu4lm emfvia() Drmxr oo1texnmictatfs rm( o (4aexnmr3tydfaD  ivo;()t2xrim iy4amte ivta()artmum nu1texnmoeiad m umnvp;u)arxrir3ootoa eau ils)s2tm(opiydlptn ncs ( a2taur ou4tetoiocilslaDeluvonu4 rxoifcty1lptraneolt0 ruo(m nu4opt  ncsl( aDrm(rp;u0tet ioctysfaDrauvp t4 lxrmfciy1fpteli i s) 2trim iu4aleemnvils  2tmx pnu0olen oeiys m2raumsn(0 ltoir3ia1la   ues;(0 rxm(r ny1alee fcs ()arta(mpou4aexn oetasfm ra( pnt)tetnxr iodfa e ues;()setr(o no1altnlnvia(fa2tmxrono1alt if3tadlaDra( snt)trtrif3iydla rlnvil( s2to(mpoydlp nmfvi t) rtmx oot1opto i3ild aDua(vp (0 reoxfciatfptrlnei;s0setmxrpou1omtnlfctas sDrru p;o4aeeniiciaslaDrlums;t0aleoxrcoo1lm  lneo s) rto(m3io4apeelneta( a2raxr oo4tpxomieiyt m ua(ms;u0 rxrmrctydfptelnes;s s2uo(opnudom emictl()artrumono0olenmi3ildls2rm(mp t4 eeoifcta1fpDean sl()truriopno1ll n netl() rrax p;t1ole  ociatfmDrm(msnu)trtrxrctodfptelues;(0t2xr(r io1alt mnesltf rur(r ou4altnmociadlmDel(mon(0tltnxr3oydoaDraiei s truoxr3iu1lle lfesasf rtmumooo0altnmieils s um( p t0aetrir3iotlaDranvo;s) 2uo(m3iydal e fcslt) Drrx oot1olxn fetys m2elnmo;t)tlxomo3oadoaDelivi (0srtm(o3iodoleemncs (fsrra(rpnu0tpxnioeiytfs2eanms u4altnmr3tatlmtrlu s s)trxmxmpno1ll  lnes (  rtmumpnu0opt  f3tlt s emumo (0 rermr todopDr u slt0trxr(m3iydol emivsls)sDtrxm oo1oee moctatlmDelu o u0 rermf3oatlm  aueils) euoir nodaptnmnvs t)srra(  ;o0opxniieildlm2uanmo t4aeerif3oatfpDrauvi;t0 2trxr ou4ame  nvs ()s2um(mont0aex ioeiyt s rmn p;t4arermr3ty1lmDraieilt)seuoxo3io4lme mivtat)sDur(mp;o1oltnmo3ildlm2eauvo;t)trxrir3oo1fptelnvi;( trumim3nodlptelnetat)srrm(  no4tlenmoeiydfs2rlnms u)teerxf iydfmDeaivil()setmir3ou4lp   fetat) 2tr(  ;t1altn o3ils s eluvpnt) exoircty1optrlnvo ()srxr(r oydlp nmfct t artr(rooo0tpxomoeildla ua( snt)alxrxr to1la  lnvo;t t2toim iodaltemfvtas  rtrxrpou1optoio3iadfs2uau o;u)aleoifcty1oaD liei (  2tm(o3iu4ap nlivt s a2tax  oo1oexoif3iat a2ea(vsnt0aetnxr iodom rlivo;( srtoxrpnodoptnmfvilsfsrumxmo;u4tex  o3iasla eanmo t0aeenxf oytlatrauvs s) 2xo(r3oydamen iesl() 2ra(r ;o4tpeo feiydla2uluvp;t4alxrir3iydfm e neslt t2xo(o iu1omt mnvi tfaDrm( pot1tpe  f3tyt a2eln o;t)alerifcta1oa   n s t0seto(m oydopt mivslt s2urxmooo4teenmictlsfa2ra( sn(0aexnxo3iy1fm e uvo t)t2umxr3nu4lpen feia(  Drrxroou1aleo feild m ul( p;() rtomfciy1fatrln o;s  etmimpno4oleeliciasfsDurum ou4teeoio3ild sDem( p;u0 rxoxrciytfaDelieols) exm(r3ny1am  lnetl(fa2ra(m ;u4tet  iciadfmDeau p;u0arerxr3todfp  aiei;(0t2trir3ou4omtemnei t  2uau poo4aexnif3ilt s umumonu4aetnir iatlmt  nvi ( teurxrpou4al n ivtltfs2taumo;u1alen fetatfs2ulu p;u) exrio3iodfmD ln i;s0trxm(r iudlp e fvsatfsrrau pnt0tltn ictlt s ul(vp u) rtnircoy1lat  i olt) exrir3ou1lltnmfvta(  rtrxrp;t4apenifetlslmDulnvpnu4teerxfctadlpDelneslt)texrio3oodlmt mfeiat)sDtr( oou1oeto ictyd s rmnmont)aexrirctodop ranvo;t)trxo(m3nydlpen fvia(  rta(rp;u0oeenmi3tas m2umnmpnt)tlxoxf oy1lp r u o (0trtr(r3no4am  lieiat  2uaxr nt1oeenii3tldla emu o t)aexnmr oatfaDrlnvils setm(r io1olee ivsat s2tmu  oo0aptoii3ilt m emumsnt)tetnxfcty1laD  ivs;s0srxoxopiy1openlivtas)srrrxmooo1oeto f3tad mDea( p;t4 rxrir3tadoatr uvo;s texm(r nydol elfvsltfs2tr( o;o4texniociys m ulumon() leomociytomt  ieo t trtoxopio1ll nlict t  rtrxmp;t0apto ictydfaDuanvo;u)texrmfcoydfm r i i (0t2to(m3ny1open iesls aDurxrp;u1ole  iciltlm ul(vs t4arxnxf3oa1opDeaiei;s0sexmxr iy4lltnmfvt s  2tmu  no0teto o3iltfm2ua(ms;(4 lxoxfcootla e ivo t0s2xm(r3ou1om  lnvs tfaDrr(m ot0opt ioetytfmDrmumpn()arenxrctydlmt aiesl() 2to(m3oo1lpt mnvslt  Dta(  nt4apxnmo3iyt sDrm( p u)alenifcoydoa  au ils)trumxrpiy4lmt  nvs () rtmump;t1aeeniictyd mDranms;t4texnif tydla  li i ( s2tr(r3ny4om  mfcta(farta(ro;o4alto fciat m emu p u0 renif3iy1lpDr n il()s2ur(o3oudam elfvta(f rrmx poo1oleoifeiyd a rau s (0alxoxocoa1opDe nvslt0 2xm(o nu1olte ies () 2uax o;u1teeomi3ild m ra(mp t0trtoif iy1fmD aivo;t texmim3ny4apee fetl(f Dur(r ;t0tlxniiciydfm2ul(vo;t4tlxnxo3oo1omDrau olt setrio oo1olt lietl()s2taxmoou0aexnmiciat a2rlnms t)treoxo ia1op  au o (0texo(o3iydal   fvtlt sDumuro;t4olxomfetasfm elump t4tlerxo iydfaDrluvols  etoim oodolt  ieta( sDraxmo;t4tpx mf3iys aDuan o (0 renmo tadlmDe nesls) euoirpoudapte ivtasf 2ta(r ;o1openmoctlslm ua(vo;u0 rtomrctytlpDeln o s0setmiopoudll nlfci tfsrur(  no1alx mo3tytfa2ua( s;(4 lenmf iotoaDelivilt)s2xr(r3ny1al  mncsat  rum( pnu0oee mi3tyd mDrauvo;t4arenifcto1fm e nvolt0 rxmiopio4lptelnetlsfsrua(ront1tetomf3tld m2ra( pnu4teenmfctotopDrln s;t0trto(r nodalee ivs sfaruaxrp;u0alt if3tydfs emuvs u)tlxrxo3totfptr nes s0 etmiopoo1oltn fesas)sDuaumpot4teeo ieildla2ulumsn() rxrif3totfat  ies t) exrio3iudlp e fesas)arumumooo0tlen f3ilsfm2uau o;(0tetnxocio1fa eanvi () rxo(m3ny1opt livsa( a2raumo;o4oeen f3tlsls2rmnvpnu0aetomr ia1fmDr ieo t sruo(o no4ol e ncs ()sDrrurpot1alxnif3iadfs2eluvs u) leomo3oy1la rluvsl() exo(rpio1amt mfcs tf Duaxro;t4optn oetys mDeanvs u0areoif tydfmDeanei;s sruoio3oudomtnlnvtl()arumum nt1apeomictydfm rl(monu)tetoxf oytopDr nei s)setm(rpny4al emfviltf rumuro;t0tpe  f3tys aDemu o (0 etriociatlmD aieo;t0texmimpiu1amen fvi s)a2urxrp;o1aex mfcils s2elnvo t4 leomf io1lp  ai sl(0 eto(r3oydaltn nci ()arum( ont4tleomo3ild aDra( s;(0tlxoircoadlmt aieil(0 2tm(opny4ol emfviat) Dum(m nt0teenmf3iyd m2umn o u4 leoif3iy1lmD auvs;(0 rumxrpiu1ope lici ()aDumx p;u4optn f3iad m2ulnmsnt4 lermocoytla elu i ()teto(m3oo4lp  licta()artrxr no0oeto oeiysfs2em( ont)trtoirciadlm raivo;()setrxr3io4apenlfctltf rurxmo;t1ape  fetas a ran ont0tltoio iy1om rli ols)trxoir3oudlpee ncsl(  2uaxr ;u1tpxnmieiasfm ulnvp;()trxoio3tydop rau o ()tetoir nu1omtnlnetl(  rrru ooo1tpe  oeiytla emuvp u0teeoir ootlp   u ols0 exrxrpiy1lpt  nvs sfsrra( ono1tpx  fciasla2rm(ms;(4 rermociodfaDeanei;t) 2xoim3ou4am  mnvi t  Drmxmpno0apxnmfeiys sDeanmo u) lxrmrciy1lmtrlivils)t2xo(mpny1aleemiesa( arumumpnt1tle mietydfm2emnmon() eenmf3oatfm eanvi;s0sexm(mpnodomeemnciatf Drmxronu0tlx mociytlm rmnmo;() lenircto1fmtr u i (0seto(r no1oleemfet ( sruaum ;t0apeoioetasfs um(vo;(4aeenircty1lm  ln i;t  exoxm io4omt lfcia(f rrmu p;u1optnmictadls2eau pn(4aeeoxr3oo1opte uvo t0trxo(o iydam nlicias)sDrau  nt0opx mf3tatfs2ean p;t4arxomocta1opt lies;t trtrim3io1ll e ncsl( aDtauro;t0tle mf3tytlsDumnmsnt4treoxr tatla   i s s0tetoio nydaptn ict t  2urx poo4tltomociysfs2elu pnt4artoxfcoodoa e i o ()srurxm io1llt livia()aruax o;u1tet  i3iydfaDean p;t4tltoxf oytla   nvolt0 eur(m3oy1lmee ncils  2trxm oo4aeto ocild a emu p;u) etomr3oodfpD li o t)srtmxrpou4apte ieslsf rrru  oo1tlx mf3tad s emums;(4alenif3tadfmt au i;t0t2xm(o iy1omtn feia(  2uau  ou1oeenmoeiltfs2ulnvpnt4aetnmfcio1laD  n s s) eurxm oudope mnesas srtrur no0aex  iciydfm rlnmont4trxoioctydoaD lu o (0srumxr3oo1ol n fetl(faruaurpnu4optn fctld s el(ms;t)tlerir oa1lpDrln o ( s2xm(o oo1lmenlivsa()srtaxr nt0tlxnifeiydlm2eluvp;(0tltoio tydlpDr neslt)srxrirpiy4ome mfviltfa2rau pnu1oet moeiasfa2emumsnt0trerif ty1op rluei;s0trtoxm no4om nmfetlsfarumurpno0ole mieiltfs ra(ms () eeoxoctotlpDrlnvsl()t2toxr3no1am elnct s)aDuax o;o0tpe  oetatlaDeaump;u0aetomrcoodoaDeaies;()t2urxr ny1ap e ncs tf 2ta( pot1alxoifeilslm rmu ont)aeeomf3iy1lp r nvs ()trxoir3oydam   nviat)aDrr(m no1oetnifetltfa eaump ()aexrmr3oatopD liei (0setm(opoy4omt livsatfa2tax oot4ale  o3ias sDrm( ont) rerxo3iadoa  liei ()texrio iu1omtn neilt)srrm( pnu0teto o3iadfa rm( s t0 lenxfctytop e i i;()srumxo3iu1am elnctls srum(m oo0opx io3iysls2elnmo u4tleoir ty1fpt lu i;t0t2umxr ny1lme mnci (fa2tm( o;t0tpe mf3tltlm2rau snt0tltnio ta1fat li ils) 2tm(o iodll nmnvi ()sDrmu p;o4openmf3iltfsDraump;u4aetoxr tydoaDeaieslt setoxo oy4omenlfes s  Dtaxm oo0altnmictas m2rm(vsnt0artnio iatfpt  ues t trtr(o3ny1op n netlt)sDtaumoot4oee mi3iysfa em( ont4 eeomf iytlp elieil(0srtrxm iu1op elivsls)s2ur(r nt4tltnmoetlt s rlnms;u) etnxf to1op eauvo ( s2umxrpiu1op nlieslt)arrm(m nu0oex  oeilslmDelump;t) rxrio3tydfmtelieo (0sexoxm3iydlltnlncsatfa2ra(r ;o4tpxo i3iyslsDemumo u0aeeoiociytoatr ies t0 2tr(m3iydolen ict t)arurump;o0tetomoeiytls ua(vsn(0tetnircty1fmtean i ( sexmxo3nydap emietltfaDuaurpnt0aetoifeiatfm2rmu s t0aeerio tadlmte uvs;t0 2toxm3nydll  lict t srrmx poo0oleomoeiatla ea(mon(4 renxrctatom raivo;(0 etmxopno1lm n nctls)srtrx  nu1tpt iiciasfs ul( p u) eenmr3oydlm rli ilt0 2urio iydol nlivsa(f 2rmx pnt0apx  o3iydfa2umu o (4aeenmocoodlpD aieo;t)sexmirpno1llenlfvta( s2rmxront4alx mf3iytfs umnvp;u0alxrir3oadopD aieol( s2um(r3io4lleelfcia(f 2urumpnt1aptnmi3iysfmDulu pnt0altrmr3tatfmt aivols0teurxr ny4ome livsa() rtax ono4tlen o3tat m2raumsnu)altoif3tatfp r i s;s0 2umir3oy1al elncsatfs2taumooo4aee ifciatlm2rmums;()areomo oytlptrli i;s srxo(m nudamte ivsa(fa2raum nt4opx io3iltfs2ranvp;u) eeoxr3oytlpDelues;s trtmim nu1open fcsls a2tmu  nt0aleo f3iyslmDelu o;(0 etoxf to1fp   i s t)teuo(m nu1al nlnvi ()arrrx  ou0teeomo3tyd s umnvsn(4altrxo3tydlm  lneslt) 2to(m nu4lptnmneta( a2tm(m oo4tpxn f3iys aDeluvs;() ltnmr oadlaDeluvils s2tmir3nu4lptnlnvsa(f Dtmurpno1aet mf3iytfsDeluvp;u4 rtrmo3ia1op   nvslt  2xmim no1open ncils  Drr(rpnu4opx moctadlm2uaumsnu0 exrio iatlpDr uei;t)s2tmirpoo4ll nliesas) rrrxmp;t4ope  i3tlsla rlnmp t4tlenir to1oaDraieo t0t2uo(rpiydalenlivtatfsDtaur ;o1aex  iciad aDuln onu0aexrxf3iotopteluvs;(  rto(o3iy1alte fvi tfs2tmu pno4ope moetatfa uau pnu4aexnmoctadlmteauvslt t2ur(opnu4lltnlnvilt) 2ua(roou0olto fetlslmDrlnvon(4teenxo3oytoa   ieols0truoxo3nu1lltn iei tfsruau  nt1tex mfcildla umnvp t) ltrxo3iytlpte ivo;s setmxo iodam  livtas  2umxm ou4tpto ictadlm2rl(vpnt4artomo tatop eau o s t2xoxr oy1lmeemfcil()a2tr(rp;o1aleo o3iltlm ua(mp t4trtoir iytlp  anvs;t0t2tmxo iu1ap nmnvtls aDrm(rpoo0oetnmociad s2ulnmo;u4 renifcoo1fpDr nvs;t0 2trxo ny1altnmneilt)aDurumpno0teenmocilslm2uluvo u0artrmocto1fmD lieo t0 eum(r nodlp elncil( aDum(m nt0apxn f3iysfm rl( pn()tltoxf3oatopD  nvi;t)tetm(r oy4llen ieiat) 2ur(r ;o0ape if3iat sDraumo;(4aexnio tydfp rlivo;( s2umir3iu1lmeemncta(  Drm(  nt0tltomieiys a ulu s;u0 ltrmf3ootlmDeli o s)teurio io1al  lncsl() 2ur(rpou1ole  f3iysfsDem(vp;t4aexnir3iytlmD au slt trtr(o iydop nlieslsf 2tax p;u0aeeomoetytfa eauvsn()trxrir3oatlmDrlnei t)sexmim3nydaltnmieslt) Dtrxmpnu4aexo f3tltlmDeanmp;t0teeomrctotoptrauvils)srurxopno4lp nmnvt ()s2rm(r ;t1olt mo3tatls rlu s t0tetoif3tydlmD ln o;s  2umir3no1lmtn ies t  Dum(  no4tpx mictlsfsDuluvsnu4arenmo3to1lpDeau s;t)tetrim nydal   fvsas) rtaur ot0olx  oetat mDrau s;u) lermo3oadop rlivol()setmir nu1am emnci ()arrmxro;o1teen ietlsfm el(mp (0trxnxo3iatfaD  uvsl() 2trxo3io1ape lietl(  2umxrpou4oeto feiysfmDea( snu)alxrmo oy1fpDeaivs t trxmio iydlle  nct s)aDrm(m ou4aleomocils aDra(vp u0arxoif3oo1om  livo s0t2xoiopno4ap e ies ( sDtmu  oo0tpt  oetldlmDulump;t0tltnio oa1fpDraivi t trtrio3oo4lmenlictltfsrtrxm nt4tetnmictatfmDrlnms u)tlxnxo3iotfmDeai s;() rxrxr3iodomtnmfcsat)sDumuroot4aexo oetysfa2emnms;u0altrio3oydfatrlies t0seuo(r3ou4olenlnci ( sruau  no0apen oeilsla2emump t)alxrxo3tatlaDeai o ( trtrio3oo1ame miviatf rtaxroou4apxomf3ildfa2rlnvsnu0 rxrio3iotlm eli i;s texmxo iy4lp  liei ()s2rau onu1olt iociytlsDeaumo;t0aetrxo3tydfpDeaivi t) 2uo(m3oy1alt  netat)artrxmpnu4oeenmo3iadfs2umuvsnu4 reomrcoatfm rau s;s0t2xmxmpio4llte nviltfaDum(  ;u4ole  i3iytla2rl( on()aeeomoctytlm elu o s0t2xmxm3iydlp e iesat)aDtr(rpnu1tlxoio3iadfm rl(mp u) etoxo iadlpt lneo t) rurxrpiydap elivil( artmx  ;u4ole  f3tltls2ea(vo;t) lxnio3iadom r uei t  exrirpnydlptnlictasfaDur(mooo0oltnifetasfs2rl(vonu0 rermf tatopteanvs (  2umir3iu4lm e ieslt)a2urxr ;u1tptomfctltlm2um(vp (4texrirctydlmteau s s0 rtr(o nudlp nmietlt arta(rp;o1texo o3tlsfa emu sn(4tetnif oatom raueo s) rtr(r oy1lm e iesat sDtm( ont0apeo feiaslm2rmu pnt) etnxo to1fmtrlieo;(0 2uoim nodop nmics ()s2um(m oo0tex iictldfsDrmnmp;t4trxnxf totfm e uei (0 2xoxm ny1aleemivsas aDtru ono1oexoiocildfmDuln snu0 rxoiociytfp   ues s0t2urxopoy1lpeelfci t  Draxrpnu1alen f3iadlm2um(mpnt4arxoio3tatla elnes (0 exo(r ny1omee fvsas arurx p;t0aex  o3iysfmDea(ms;u4alenxrciydlmD ln sls texrir3ny1alenmiesat)s2ur(mo;u4tex iietyd m rmums;u)tltnmf oadlp e neols0srtrxmpno1lp nlfvt tfaDtmx onu0altnifeiyd s2rlnms;()teenmo3todlmt luvil() rtmxo io1ame mnes t)srtmxmp;u4oeto icils s elnvp t0 etnmf3iydom elivslt  2tmxopiu4am elfvia() rtax p;t0apt iiciydfa2el(vsnt0 ltoxrciy1oa eli s ()sexrir iy1olenlics t) ruaur nu1openmfciyslmDuanmo;t)tleoxf3oadfp e ues;s)trxoir nudameemnvs (faruaxrpno1apeo oetatfs umnvsnt0trtnif3io1fp eanvi s s2uoio ou4amt mfeia( a2tr( pno4apt mfcilt m rmumpnu)altnif3tadoaDeaneols0sexm(rpio1lptnlfvs s arurxm oo4oexomo3tld aDumu ont4 rerxfcoy1op raiei;(0 exm(rpiu1al  mieta() Dtmu pot0teen f3ilsla ulumo t) lerxf3tatfaDrai o ()t2xmxopou4opee fctl( arumxrpno1oltomf3iyt mDumumpnu4trtnmf3totlaDelnei (0srto(o3oo4lmee ictl()sDuau  ;o0optnmfetat m ua(vont)aexrir ta1fmtr ivo;s t2tr(rpnu1op nmfes t srumuro;u0olenmo3tadlm2el(vp;t) rtrircta1faD luvsls0 rxrim3io1opeelictas artaxm nu0alen ieiysla ean s;() eeomo3tydla rai ols) rurio io4ape micsat a2rmu pot4olt  oeildfsDumnvsnt)texomociatlmt luvs s)srtm(rpou1opeemnvi s) 2urxmpnu0tptnifeildlm2emuvo t)aeeomocoy1laDe nvol(0srurxo3iy1amt liet tfsrtmxmp;t0olx  i3tydlm ul(vo u4 rtrmrcoadlp r i i;(0trurxr iydalt lnvs ()aDua(m nu4tltomoetlt a2ul(ms;()trerif3iodfp  li il( trxm(o ny1apt  nesas) 2taxr oo4alenmicils a2umuvp u4 rxomo3ia1fpte u i t0 euoim3nu4apeelnciat sDrm( ooo4tpen ictatfm2rm(vsn(0 exrmocootlmte nes;s  2tmxo3ny4amt miei s) Dtrx  nt4tptn fetltlmDrmn p u4teenxr3to1omtranvs () 2uo(mpnudaltn ieia(fs2rax o;u4teenio3iyd aDrau p () rtnxo3iy1fpDr ieils sexrxr3oodame micslsfaDrmx oot4oltomo3iys m2rmnmsnt) ltomo iytomteaiei;( srxoxr io4amtnmicsas sDrmu pou0tpt ii3tltfs2ua(vo u)tlxoxo3tatlpDrlies t)t2trxo iy4lmtn fci s aDrmxronu1teto ociytfsDrluvo t4teeomo3totfaDr uvi;s0seuoiopno4lleelfet tfa2umu pnu4aleoifcilsla eln p t0 exrmocoa1latrauvo;s) rtm(o3no4ome lfvsat)a2rmumoot4tpt mietldlm umn s;t0aeenxr ta1lmDr ieol() rtoxr3ny4al  mfeia()sDraum no1alx ifciydfm2rl( pnt4 reoxr3tydfmD lnei;s0 ruoiopnu1omen fviat)a2um(ro;u1tpenioeils s ua(mo;t0 eenif3oy1fpDe ues s trxmxm3io1al  lfei tf Dtm(moou1opx mfeiat a emnmont) lxrif ta1fpte i s t0 rtoxr iy1lltelfciat)srrr(  nt4opxo ieiasfsDelnmo;u4tltrxocoytoaDean i t)tetoio nydlpt lnvsls  Drrumo;u0aptomfeiys sDrlu pn(4 rxrif iytoaDrlneolt)t2tm(r3oodomtelfeslsf Dtr(  ot4aptoiociad s2el( snu)altnmo iydomtr ues;(  ruoiopoudam nlncta(f Dtrx pnt1oetn fcias s eau s;t0artnio3oydlpDe nvsl(0srxoxm3iodlmtn fesat s2tmx o;u0apx ifctldfs2rln p (4 lermfcia1opD  ivolt)s2xrir3oy1ll e ictlt) rta(moot4opeo fetlt s2eanms u0aeerxf oydop elnvil( seumimpnu4lptelfcsl(fs2ra(rpot4oeenmoeiatfm2um(vo;u0 ltrmrcoo1fatelnvi;s)seur(mpnu4apenlnctls)arum(m oo4tlt iicilsls emnmpn(4alenio3oatfmD aivilt0trurxm3iy1ape lfctas srtmxrpot1ope  i3tadfa ra(vs;t0aetrmfcoo1fm rlivs t) euo(opiu1optnlfetatf rrm(root1oet ifetydlsDem(vpnu0teeoio3todlm raueo;(  rxrir3io1lle mnvta(f rrruroot4aex micildfa2ul(mp;t4arxomfciotfaDeluvi t)tetrim no4optnlncs sfaDrr(rp;t1olxomoetlt a2emn ont)trtnmr3to1lmteaivol()teurir nu1lltnlies sfaDuru pnt0alxnmicildla2rmuvsnu4 ltnir3ty1oa  aivi;s)srxriopoydamtelnvtls  rtmxm ou0altnmfctlt a2um(vs (0alenir3tydop ranvol(0s2xoirpou4optnliciatfaDua(mpnt4oet iicilslm ran p;u4altnmfciydfa  li o;t teum(m3iy4lmtnmivt (  2tr(rpnu4tpxn i3iatfaDumnmpnu) lxnmo3iatom e uei;t srtrimpiu1ap e fvilsfsDrau pnt4oltnmiciadfsDumnmont0aetnxfciotfpDran s ( tetmim no1optnlfcs t a2taur ot4aptnmi3tyt aDea(mp t0tltnmo3oatoaDranei;s t2umim3ou1op  mnci (f Dum( pou0aexo oeiad s eanvs;t0treomoctodoat anvo;t0 rtr(opnodlmen ies s  2raxr no4alenmo3iltlaDem(vs u0trerif3iydfpD anvo t0 rtmxr3oo4lmtn nct t)a2umx o;u1olt  i3tltfa el( ont4texrxf oo1lpD aivo;(0teuoxopnodomtemicslsfa2rmxroot0tpxn ieiyt s el( onu4altrmf iy1lp eaivol( setr(m3iydam e ieta(faDraxrpnt0oeeoiocildls2eau onu4trxnir oatfmD ai sls)t2um(opoo1amtemfeta(  rrr(m ot0olxn f3ildls2ulnmp;t)texomr3tatfm r neo ( trxo(r3nudllen feil(  2rau ooo4oetoifetat s2elnvo t0alxnmo tytlp   n slt0trxr(m3io1omtnlnetl( sDua(mo;u4olxoio3ild aDra(mp;(4arenircoa1fmtr n i;t0 2xr(m3nu1olenmneia()s2urumpot0oeen ietatfmDumuvo () renmrcoodlp rlnei;s0s2urirpnydalee icilsfs2raumoou4apxn feiadfaDeaump ()trxoxocoa1fmteai o t) rxrxm3iy4ap  mivtltf Durxmont0oltoii3iatlmDeau ont4aeenmf tytom   n s;t  2trirpnu1aptelivs sfsrtaumo;u0alenmocias sDeluvon()trenxf3oytlpt lu i s  rtmimpiudlltelnesls)aDuau  ;t4tpxomf3tys mDelu ont4trxoio oydlmteli o s) rxoiopny4lltnmiet t srrrx  oo0oltnioetasfaDemn pnu0tetnmfctotomD auei;s0s2trir iy1lpe lfcsas s2ta(mo;t1alto o3iys m uln snu0trtrxr tatla eln s;t)trxo(r3iydalt lfcilt)a2rr( oou1teto ieiatfmDelumo u4tlxoircoa1fmteaivo s) etr(m3io4lmt lfctlt)aDuax oot0aleomietatfm2ran p u4trtomr3ty1lp e uvo;t) exo(r io4omenlict t aDtm( p;t4oltniietls a2ul( on(0altrmr3ootlmDelu ils0s2urxm io1al nmfvt () rtrum nt1aexnif3ild aDraums;u4trxnmf3todfpD aies t)t2umir3nudomenlncia()s2tr(rp;o4apt mi3tysla el( ont4trtnxf3iotopDrlnvi;(0 rumxr nu4ol nmfet tfartmxr no4oltnmietld a ranmsnu)trenxfctatfpD livi;s trumir io1omtnliesatf rtaxrp;t1oetn o3tasfa2rauvs u4areomrcia1lm rai i;(0truoiopou1aptemnesl(fsDraxm nu0texomfcildlmDelnvon()altnxfcoy1optrlueo t0 rtmimpiudlp  miviasfs2tm(mp;u1tpe mi3iytlm2emu o t4 rxrir ia1lpt ai s s texrirpiodomt  ncsas)srrr(moot4alx if3tasfaDuln p;u)treoxo3iotfp r uvs;()teurir nydlm  lfetls a2uaxm oo1aee iictls a ulnvs;u0tetnxo3ootfaD lieo;()t2trxo3iu1omtemfetat)s2tmx  ;o4olxn oeiysfmDeanvp u)arxnir iydfpDrauesls0 etrxr ou1amtelfvsatfs2tm(m ;o1tpxnifeiasfs2ulnmon(0aetnmr3oa1lmD  u olt0s2toxopoodolt mncs s a2rru  ;t0olxnmo3iyslm rlu s t0trtoio iytlp e i olt)srumir ny4op emiet sfsDur(  no1alx  f3iytfm rmnmon(4 etrif3oydlp elnvs t0s2umxm3oy1altnmivtl(f 2tau ono4oleomf3tadlaDrauvp t)alxrirctydla e uei ( srxo(m nudomenmnvi (f rum(r no4optn ieiadfsDuaumon()aeeoiocoytomD lnvolt) ruoxr oydop elnvt tf 2tmxmp;o0optnifetasfs eanmpnu0aexrir oytfpDe nes;t) 2tmxr iu4amtelnvta( aDra( o;o1oleomieiatfaDemuvs t) exnmf to1omDeai i t0 rxm(r3iu1ale  nvtasf 2tmumoot4tlx mfctasfa2rmumo;t)trxoxr tytopte nvilt  2xrirpnydlp elictl(fsDurxrpoo0aeeomoeild a2rm( o;u)tetnirctotlaDr i s;s0srxrim3iu4lm e iet s  2rrxmpno0tpe mieiydfm2rmnmpnu0altnifctatomtr ivs s) 2tr(o ou1amenmieilsf rumump;t0oet iieildfmDemuvonu4trerifcoo1lp r ieo;t0seuo(m3iy1ol emneil(f 2tauroou0opeo ieildlmDraums () etoir tytfa elivi s)trtm(m no1ol nlfctlsfs2tr(rpnu0oltnmo3iatfaDea(von(0altrif iy1la eauvi () 2xrxo3ou1lleelivsas)arur(rpou1olxnmfeiad sDuan o;u)tetnxo tatfptrlnesl(0 euoim3nodale lncia(faDumx  ;t0teto fciasls uau snt0tlxrxo tatfate uesls0trtoir3oo4opt  fcia( aDurur ;o4olen i3iys a2em(vs;u)tlxrmo3ia1omD anvs;s sexoxo3oo4ol n fvilt)sDtrumo;t0oee  fciytlsDua( o t4teerxrcta1fa rau i t0setr(mpiudopeelictat)s2rau oot4teen i3tyt aDrmnvsnu4 renircoa1laDranvi s)sruoim3oo4lmtnlfeta()aDum(m ;o4olen i3tat sDuau on()tleoio3ia1la  ln slt0tetr(o3oy1lp  lnct s  rrm(rooo1tltnmoetadfs eanmp;t0aeerxrcoo1om eaivs (0seurxo ou1al n fcsat aDumxr ;t4ope  f3iytfmDrmn s;(4 rtoifciotoa rln o;() rxo(m3oydope mnvtas) rua(mo;t4olxoif3iytfm2ea( s;(0 rtrir3tydfm r ueo t0trumir nodomenlicslt)a2ua(rp;t1oex ifctaslsDel(ms;() lxnxocty1oaDe i ols  exo(opnodlm nmfes t s2taumpno1tltomi3tas s ean p;(0trtomr3oodfmDelueslt trumir no1ll   nesas)sDra(  ;o4texoii3iltfsDeanms;t0trtnxrciy1fatrlivi ( s2xm(r no1oltemfcilsf rtmu  ;t1tpeo octatla rau s u) rermo ootlm rlnvo;( t2urio nodlltelivsas aDrmur ;t0olxoiociltlaDel(vp ()teenxfciy1optrlnvo ()t2xrxrpiu1omtelfci ()sDtru o;u1ale miciasfsDemuvo t0tltrifciy1op rlnei;s) 2toim oodapte neilsfs2rrxr no1alxn ieildla2rmnvp (4tetnxfciatopD lnvi;s0t2umxmpnudomtnlnci t)s2raxmp;u0tpxn fctytlmDumnmonu) leomfcoatopt aieol(0srxr(r3no4lpt mfvs s sDumu  ;o4aexnif3ilt m rm(vonu)aetomr3oatfaD an s s) euriopnu1om nmnct tfsrrau pou1oex ioeilsfm eau p;u4 rxnxfcoodomD  nvo;s0t2urimpiu1om e nctas  2uax  oo1tpt  ociydfaDrm( pn(4tlerxo3tydop rlu i;t0 rtoxopiu4ape mnei () 2raumoou4aetn ietldfm2rlu p;()alxrmr iadlat  nvol()seto(r3ou4ll nlfeiat)artmu  ot0tee ioetld m rln o;u4tleoio iy1omteaivi;t) etrir3iydop n nctat) Dtaxrpno1olxnif3ias s ranmp u4tetrxo todfp elu s t  etm(m3ou1amtnlnctlt)srrmur ot0altnmfciatlm2rl( o t)trenif iatoate ivsl() exo(o iydol nlfet t aDrr(ro;t0teeoio3iyd a elnvs;u4 rxrifcia1lm r ieo s0s2uo(o3io1lmtemict (fs2tr(roou0openiieilsfsDranmonu)arenir3iotla  aues;(0s2xoxopiy1oleemnvil()srtmu p;o0optoifeildlmDul(vsnu4texniociytopDrlivils) 2xoirpio1oleemnvtls sDtmumpno0opxnmfeiadfa2emuvs (4alenio io1lm  luvo;t0 ruoxo3oydlle liciltfa2rrxmo;o4aeenmfctlsfa el( p ()teenmf3oadfat aivilt truoimpiydop   ivtltf rua(mono4tleo f3iat m el( o;u4 eeomrcta1lp  aiei t0s2trirpio1ope  fcsas s2raxr nt1tltomiciysfm elumsn(4 ltnmr3ty1lpt  i i ( trtrimpio1lpeelicias)srtmumpoo0tetoif3tysls ra(mpnt) ltomr to1lm   iei;(  2um(o3ou1ome lies (fs2rmu poo0alxomf3iydlm2em(vp;(0 lxoio3oydlptraneo;s  2xm(m iu1lpeelneslsfaruru pou0opt ioeilslaDuan s t4aeeoio oo1omt  n s t0s2xmxmpnodale  nvi ()sDtr(roou4texnmiciytfm2ranmo u4aetoir3oatfpDr ues;()sexr(o3oodalt lnei (f rtrum nu0apxnifeiydfa2emnmp t)trxrio iy1lp  lneo (  eurxo io1lp nlicils) Dua(mp;u0oetomo3iydlaDrl( ont)tleoircta1latr nvo;t s2toxm no1lm   nctas sDtaxm ;u1teeomfciltlaDua( p ()tleoio oy1omt  i o;( srur(m3oy4lpeelncilt)s2rr(mono4alxn o3tysfs uauvpn(4arxomf3ootlmtelnes (0s2uo(opoo4apt lfes ( srta(r nu0aexnmfetyt s eanmp (0tltrmf iotomDr ues;t teuoir oo1ope lfvsa()arum( onu4opto ieild m2el(mo;t0 rxomrciatla  aivils) 2xrir oodlmte nvias srumump;t1opxnmfctasfa2uan sn(4 lenxf3iatlmDeaueo (0 2xmimpiy1open fvtat)sDtau pou0teeoiictasls eanvo u0teermf3oatlpD lnvsls)t2xmxrpoydom  lfvta()s2um(m oo0altn oetydfaDua(vp;()arenircoytfp r nvsl( trtmxo no4omeelnvt (faDuau p;u4alt  fciadfmDul(vs;t0aetrmf3oadfpte uesl()trtoio3nu4al nlfvtatfaruau pnu0tptnio3tadls ea(mp;t0 exnmrctytlm e u s;(0s2xmxmpou1ame mncs sf 2rrx pnt4texomfcils a rlumonu4 etnir3iydlmtrlivi s  etm(r nu4ll e ivt tf Dumxr no4tet  o3tytlsDuaumo ()texnir iodfp e ueo (0 euriopiy4olen fcsatfs2rax pnu4ole ifeild a rln s () exomfcta1lp  lnvo s)trurim3iy1ll nlnvs ( srumurpoo4oeto oeias m ea(von() rxnxo3iytlm  luei t)teurim3oo4al nlnctls artrxmpnt4tetniiciad a um(vp t0alenmr oytfmDr ueo;( srumxopiydlm n fctls a2rrx poo0tpxomoeiadlaDrl(vs t4 etoxo iadom elivo s0s2umxm3oo4optelfvias a2urxmpoo4texo f3iltfs ra(mo;()arxoircoydlpt  nes ( seumxo3oudopenmnet tfa2rmxm no0aexoio3tasfa ran s;u4 reoif ta1fa eliei;s)setmxmpio4oltemnviasfaDumumooo0tlt iiciyt a elump u)arxnxr iodlpDrau i;(0sruo(rpio1am nmnesasf 2tmumpno4tpxoioetadla2um( onu0arenmocoadopD aues s t2tr(m iy4lm emicia()aDumuroot4tlenmietadfs2emuvs t4alxrxr oa1fp  ai i;(  ruoimpoudap emnes t artr(m ;t4texomf3tasla2emnms;()alxrifciatfa  lnvi;() rurim3nu4alenmneslt)aDta(mo;u0olxoifeiadla2rmums;()areomrcta1om e i o;( s2toio3ou1lmtnlfeta( sDtr( pnt0tpxn o3iyt a2rlump;() rxnxfcia1fa   u ols0 etmxrpiydaltn ies s)arur(rpoo0oee ioetydfm umuvs u0alxrmrctadfptelieils  exo(r iodaptnliesl( s2tmu ooo4aetoiiciyt m2ra( pnt)alxrio3ia1fmtr uvi;() etrxrpnudol n nvi () ruaumo;t1oeenmfctyslm2rlnmo;u4 rerircty1lptelivo;s)trxmim no4oltnliciltfsDrax p;t1tptomfctydla2rl( onu0treomo3tatlat  i i s) eur(o3iydlm n ici ()a2tr(  ;u1tpxo fciasfsDrluvsn(4altrmo iodfat anvo;()trxmxopnu1alen fcia()sDuaump;t4alx  octatfmDua( snt) lxoxr3iytlmDeliei s trtmxm nydoltn fes sfaDumxmp;u4oeeomoctatfs elnmo;u0alenxf iotlaDeaivs s)sexmio3oydome  feslt  rra( pnt4oetnmfctyslm2umuvsnu)texoxrcia1la rluei s)t2ur(m3ou4lpeemics s artmu onu4aet ii3tltls raums () etomf ootlp  aivs;t sexoirpou4al nmnei tfaDrr( pot1apeoii3tadfa2rmnvp u0 rxomrctotlatr i s;s0s2uoxm3iudole mnvsa()sDurx oou1oetnioeiyd m2emumsnu)tltrioctytlpDeaivo (0srtrimpiodlptnmfcilt sDrm( ont4oexn i3iaslm ranvp;()texoxf3oadlmDran o (0setoio iodoptnlieiatf 2tm( o;u0tlto ocildls ua( s;u4artoir3iatlmtrln ol(  eumirpnodamtn ivi ( srtrxm no1aptnmietas s2el( o;()tlerir3ta1lmD  n s t trxrxo3oodapt mncs () 2trum nu0alx mictlslsDrau p (0arerxocio1fpDrlnvs s0 etmxo iodame lnct (  2tm( o;o0aptomictldlsDem(mp t4 rxrir iy1lp rli slt teurxm3iu1ll   nvtltfsrtau  ;u4tlt mo3iltfs uaumo ()aetnmf tatfa r ivo;t)setmim nudamtemnet s s2taumpno1optn iciyd aDrl(vp ()aeeoxr3oatopt  ueolt0srxrimpoo1op  mfvilt artm(m ;t0oeeomiciltlmDrau p t0aexrif3ty1op rlneilt) rumim ou4oltelfcsltf ruax p;o1apxn fciasfmDulnvp ()tetomo oytlmtrli ols t2tmim iudomtnlfvtls s2rmx o;t1alt mfcild a2elnvonu) lenmoctatoaDrliesl(0trxmimpio1lp nmieils sDuaumono0optn ieiysfmDranvs;(0 lerxr3oydlmtr ueols)s2uo(rpio4lpe  fvi t sDtmxrpoo0tpxoioetatfs ua( p;u4 ltnir3ty1fmD livilt s2xmxrpiu4ap n fcs t)arta(r ;t1oexn f3iyt a2ulumpnt)aeeoio3oodom rlnvo;s0trum(m3no1opte neil(fsrrrumpot4oeto f3iat m2eaumonu)arxrif3tatlatraiesls texriopoo1om  mivias) Dua(ro;t4tlenmfetasla rlump;u4texoxfciodoa rlivo;t setm(m3ou4ape  fviat)a2rax onu4tlenio3tlsfa uan sn(4 reomf iodoptelu o;t seurio3ny1am  mnes tfarrax  no4tee ifetas mDrl( ont4tetnxrcio1la eaiesls0seumxr oydopt lfvt tf Dtmxm no1oleoiicilt s el( p;(4areoxr io1lp rli o;t0t2toxmpoy4lm  lnei s s2rru  ;t1aptnifciadfa umums ()aleoxoctytfa  an i;(0trtmxr3oodllen iesls s2ta(rp;u4texniociasfs ulnmo u0trxnmo3tatlm  au o;t0s2xr(m oo4op n nctat  rua(r oo1tetoiocildfs eauvs t)alenmo3ootopDrliei t) rxoxmpnydlp nmict tfa2tr(ront4aee mictas m2um(vs u) rxnmf3iodoa   iei;s0trtoxm3oo4apenlfct (fsrrmur oo4tet  oeiatfm ranmo;t0aexrmr3iotlmteaneil( sexo(m nu1optelietas)srua(mpoo1opxnmiciatla rl(mpn()tltnmf io1lm eaueilt0s2xoim3ny4ap n nei ( aDtruro;o4aetnmoeiat a2ua(mo;(0 renifciydoa eanes ( s2toxo iy4ale  ieia(f 2tr(r nu0oee mo3tas m rmumon(4tlerxfcoa1lmt ai ols)srxrirpiodlpe micilsfarua(rp;t0aexo feiysfm2rluvsn()tltnif tadfpt  uei s0 etm(mpny4lp nlics (f rum( p;o4olt mo3ildfs eanmpn()artoif iy1fate n ils teuoir3oydoptnlfcs t) Dtrxm nt0optnmoeiadlmDuan p;u)tetoioctytfmtranes s0t2xo(r iy1amt  nvt ()sDua( o;u0ole  f3tatlsDeln ont0arxrmo3tytlpteaneolt0trtoxm iy1aleelnviltf Dtaum no0ale if3tlt s2ulnmpnu)arxrmr io1fatran o t)texoxopny4op  mneslsfs2um(mp;u4apxo fctyd a2ran p u)tlerir iy1oa  anes t)tetr(r3oy1lpt  net sfa2umxmpot1olxomf3tyslm2ulnvpnt0teenmrciotfmDran ils  exmio3oo1lm   ieiatfarumxm ;u0aleomf3iatfm2uau p u)aexnmf oodoaD anvolt0srtr(mpno4lptnlneia(  Dur( pnt1ape mo3iasfs umnvsnt)texrir3tytfm e ivs;t sexmxrpoodlpt lics ()arrr(m nt1apto oetlsfsDulnmsn(4 lxrmr3todom eau i;s0 etrxrpou1opee nei t)arrr( p;t4aptomieiyd m2rauvp (4artrioctytomt  u s;t0s2toxmpiydlpen ies s)aDta(mo;o4tpe iieiysfm2emnvo u0alxomrcto1la e ueilt t2xo(o3iy1olt mnes (fsDtm(r nu4alt  ocilt mDulu p;t4tlxomociytoa e n ils0 2urim3oydamenlivt t)aDtax  nu0open f3iyslm ul(vp t)arxomr3ia1opDeaues;t s2xmio oo4ale mieslt sruaurp;u4tlxniietlt mDrmumo u0aexoxo3tadoaDe u slt)truo(m3oo1omtn nvta(f 2ua(  nu1aexoifeils m2rmu pnu4trtnif ty1lat aueslt0 2xrxr3oydom   fvs tf Drrum ;u4aptoii3ils a2umnvs t4trtrircoo1fmte nvo s0 2tm(r oodlptnmnvsas)s2ta(moot0apxnii3tltfaDrln s;()alxnxf3oy1fate uvolt0s2to(o nydop n nvtas srurxroot0aexo f3tatfsDrm(vsn(4aexoir oa1laDe nes s) euoxmpiudap  livtl(  Dtm(rpoo4oexnmoeiyd s2rmumo;t0aeermo ootfa   neils0 exoio3ny4op emnctat)a2rmx  oo1aeto feilsfa ul( p;u0 ltrmocoytlatr nes ()s2uo(r ny1omenlieiat) Durx  nu4tetnmfeiaslsDuau snt)teenir todlpte ivo;s0s2xoxr oy1ol  lfcsat) rrrx  nu4olxomiciyslm eluvp;t)arxoxocoydfatelnvi;s texrimpiu4ol nmiei () 2uru  ;u1texoif3iasfs2ranmsnt4tleoircia1fat  uvs;t0 eurxmpio4ameemncsas)s2ra(moou4apenmfciasfs um(mp;t)alenxo tytfmtrai s t srto(o iy1apenmfct t  rrmump;u0oeenif3ilsla2rm( o u4 ltrio3to1opte u i;t) 2uo(opny1ol nlieiasfaDumxr ;u4opxo i3iatfs2rmn o;(4aexrio3iydlaDe nvi s0trxrxm3oodopeelnei ( sruaump;t4tee  icilslm eanmpnu)altrxr3todfmDe ivo t)t2xrio iodal  lnes s) Dtaxr ou0tee iocilt s2ulnvp u) leoxf3oodfatelivsl()tetoir3oydam nmietatfaDrr(mo;o0tpxn ocilt m2uauvonu)tlxoio io1opD  ieo;t0tetrir3oo1lp n fesa() 2ra(mo;o1tlenif3tlsfaDemn p;t) lxomrcoydomDe u s;s)t2to(mpoudoleemfeiltfsrua(r ot4oet  iciat a2ua(vpnt0altrmfctatla eau s;s)t2xm(o ny4lpen ncias)s2ra( pot0apxo octyd a rmu o;u0 leomfciotfp raivo;s)trur(m3no4am   netasfa2rmu  oo0aptnifeiadfmDrlu p ()arxnxr3to1fat livols  rto(o3ou4lpee nvils) Durxm ;t0tpxnmf3iysls2rm(vo u)arxrir totfaDr u i ()tetrir nydoptelfcsa(  2tm( pno1ape ifctysfa raumo u)trxoxr3tydlmD ai o t)texrxr oy4op emnvtl( a2raxrpnt4opt mociysfa2ra( s;(4aexoxf3todlpt aiei s0srxr(o3iydlm emivsls)s2trurpnt0apt iieiltlm2ea(mo;u4trxnmr iy1fpt aieolt)seum(r3ny4ll elici s)sDumxm no0altn feiatlsDeluvsnu)tlenmrcoatlaD aueils teum(m3io1lpt mieta()aDrau o;u4ole  f3tydla ul( p u4tlerif oy1omtelneol( seuoxmpoudomt lneta(  rraxmpoo4tpt  f3iatfm eau o u0aexnio oydlm r uvsl(  ruoir
\ No newline at end of file
@@ -0,0 +1 @@
+n slt trtmir3iu4ll  mfvta() Duaxm ou0oexo o3tytfa2ea( s;u0aeerxf oa1latr u s;s srxoimpno1lptemnesa( sDtrxmoou4oet mociatlmDeluvpn(0aeeoio3iytlmDeln i t0 rtm(m iu1lptn fcsl()s2urxm ;u4opeo ictadlm rluvp u) rxrmf oodfmtrli ol(0trxoxrpnudlpt  nctat)sDrrx  ot0optn icilsfmDuau s u)aexnmr3iydfpteli i t0 exm(m3iodlpee ict t aDtm( pnt1tlx iieiatfmDrm(ms u4 lenxfcoydoptrli o;(0 eumxmpno4olte nvilsfaDrmu oou0tlt  o3tldlaDuan pnu)trtrxocoadoa e i i t)s2um(m nydolte fesa(fsrrmu pno4tex miciysla2um( s t4 leoxrciytlpDrli il( srxr(o ny1lptemfei (f rumum nu0tee io3iysfsDumnvo;t) ltrxf ia1lmte neo;(  ruriopoy1optemfctls)aDum( ooo0olxn fciytfm ua(mp;u0trermrciytopDelu o s0teto(r iodom   neslt) 2urx oou1oexnioetysfaDrmn s;()alxrmf3iotlp ran o;t)s2urxrpnydapeemies t arrrxr ;o4oexomo3iydlm2umu pnt4texnir todom eanei s)t2xriopiy1apenlfcslt)srtrum nu4apx iociltfs2rluvo u4texrxr3ia1opDeluei;() rxr(mpiu1ol nlnviat)s2ta( pou0alt  fciys a uaums t0tltrmrcia1fmDr neo ()s2toir nudlltelfesat)a2rrxrp;o4oex  ietasfa2em(vsnu4 exnxf3tydlmD  i i t0s2umxo3nydllenmivs (f rra(mp;u4apxnio3iat sDeluvsnt)arxnmr3io1om  aivo;s)trur(m3oydop  lfetltf 2ra(r nu1ope mo3iadfa emn pnt4 leomfcto1fp e n o t  2tr(m ny4lltnlies (fa2rrumpoo4tptoifetaslm2ea( sn(4 rtoxrctodlmt  i sls)trtoimpnodome  fesl() Drm(rpnt4tlx  oeiasla uln pn(4 etrircoa1lmt  ivi;t  euoio3ny1op emfvsas) 2tr(mont0aetomfetad a2umuvonu4artoxf3io1lptrlnes;t0 2urio3iy1lltnlfeiat sDtaumonu0altoio3iltls ea(vpnt)aetrif to1fa eai o s0 etmio nudop  micils srrmu poo0tle  fctyslmDul(monu4texrir oodlp r i o t0trxmxmpnu4al nlfcsasfs2um(moot4aeeo ocils m2uaums;(0 leriociotlaD an s s0 etmim3no1ame  ies tfaDrauronu0tpt if3iydlm2eaumsnt0trenxocoydlmt lnei;s texo(o3ou1ale mieiltf 2raxroot0opxn fctlslaDrmumonu)aeerircty1fatelnvs;t  exr(r io4altn ncsat)a2ua(  ou4aex iieiadlm umnmpnt) eerirctotlatr n s ( s2uoio iydape  ncilt)s2rmumoou1tltoiietas m2eln p;t)alxrxfciotlm rauvsls)srxoimpoodope  fct t a2rrx  ot4optoio3ildfsDem( o (4alenif oadoa e uvo;t0t2urxrpoo4olt lictatfsDur( poo4tee  ictls a2ulnms;() eenxfcoy1om  lu s t texrxopoydap nmieilt arrau oou0optnmicilsfs eanvs;t) exoxrcoytfaDrlnes s0 etmxopoo1altnmivsat arrrxmo;o4teeniietydlm el(ms t0arxnif ootlatrlnei t0s2urxm3iydopt mivsat artm(m ;u0tle  ietysfsDrmu s (4artoxrctytlptr u ol( t2urim3ou1altemfvsatfaDtax p;u1teenioetldlaDumumo (4teenxo3io1oa  anes;s texm(m io4apeelnetlt aDraur ;u4optn ociad mDulu ont4 ltnifcta1latelnesls0 rxmxm ny1ale mivi s)aDrm(moot1tptnmf3iyd m eluvo (4artoxoctotoptrlnesls teum(o nudamenmfeils  Dta( o;u4oetomiciat aDuanmp;t0teeomo3oadoaDr ies;s0t2xrxm3no1llt lict s  rrax  no1olenmf3iysla eln o u4 rerxo iatoa r ieo t0 2trio iu1ll  lnct sfaDrmump;t4tpenmf3iat mDel(vo;u4altnxo oydomtrlieil(0sexoio3ou1alt  nvsl(f 2trxmonu1olxn i3ias m ulnvp (4aexrmrcoatom e uvs;() 2tr(r3oodamtnmfvs ( arrmurp;t1aptnmoeiyd sDea(vo;(4tlenifciotoat livol( trxoim3oudol nlnesltf 2uax oou0tleo i3tytlsDem(vs u) exoio3oy1opte u o s0 rxr(m ny1lptemfet tfa2umxrp;t1apxn oeiysfa2ra(ms;t0texniocia1oaD ai o;()sexm(mpny4aptn fvs t arumxro;t1opx iiciat aDeluvp u)arerxrciy1lp raivs s  2xrxm3iudomen iesa(fartrur ot0aee iictaslm umn on(4tltnir oatlpDran il(0srxo(o io1lm n iesa() rrmu poo4ale io3tasfs2ra(vp u)alenmocoatlm raiei;(0setrxo3no4ap e ivt t) 2urxm ot4alen ieils a um( p;t0tetoif oodlpt  nvo;s tetrxmpiy1lltnlivils s2rax p;u4teeo ictyt sDran p;()texomr3tatfm r n olt srtr(r3iodlptemnvtls)arrmxmonu1tex mf3iyslmDulnvonu)tetnmfcto1laD aueo (0t2xmim no4ol   fvsl(fs2ur(mpno0alx mi3iltfaDulump u)trxriociotfa eauesls s2xo(mpny4lm n iesls srtrurpnu1aexoio3tytfs2elumont4 leoxf3todlaD  uvi t setmio3oy1oltn icsasfa2trx  no1tptomieilsfmDelu s u)artoir totfm  ln slt trtrio3no4oleelici (f 2trum nu4tex if3tasfs ua( pnt4aeenmrcoa1oa r u sl(0texrxopoydaptemfei tf Duaxm nt4tpxn iciysfs eaumo;t)teerio3ia1la   nvi ()sruoxm nudomtn iesa( sDra(mo;o1tpe io3tlt a2eauvsnu) etrxr oydoaDr i s t  2umio3iudome livi s)sDra( p;u1oex mictls s2ulnmsnu4trxrio3iodlaDrlnvo t)sexrir iu1ap n ivtasfa2raumont0olen f3tat m2eanmp;(4trtrio totfm r ieo;( truoimpio4altemfeilt)aDrm( oou1aptoifeiltlm2em(vs;t)alermr3todopt  u i;s srtrio oy1am emncsl(fsDuauro;t4oltnioetatfm2rauvo;(0alxoir iatoaDelivsl() rtrim3io4om n nvtlt a2rau ono0oexnmocild sDrmuvp u0 ltrif oy1fpD luvo;t) rxrxo3oy1opt  ivt ( arum(mono0oleoifcildlaDuln p u4tlerxo3todfaD auei s0 etoxo3iu4opee ivsatfsDtaurp;t4apx iieiydlm umuvpn(0 exnxo tadfaDeaivils srur(o3oodopenmncia() rumxm nu0aetn i3tyd sDeanvo;u) lerif oydlatrlivils)teum(o3iudop  mfes (faDumu pnu0oexoifciasfa el(mpn(0tltomr tadop rln o s0t2xo(rpiydol   nvt sfa2taxr nu0ale mi3ilslm eauvsnt4 etnmo3iytoaD  uvs s) etrxopio4am nlfcil( s2ta( poo1open f3ildfaDrmums u)altomoctydlmtraueo t0truoio ny4aleemfci t)sDurum ;o1tpxomfeild a2rmuvo t0trtoxfcoydfpDeaiesl(0 eto(opnu1om  mnvtasfarrau  no4teen i3iasla2em( sn(0 exnmrcoatfmDrlieolt sexm(opou4lp  livt tfs2tmxm ;t1aptn o3ils m rau snt0texnxr3todoaDr uvi t setmimpny4op  lictls  rrr(r ;t4apt  ieiatls2rlnmo ()tleoio tydfpteauvs;t0sexrxr ny4amtelivta() rtm(r ;o1oltnmoctasfs rlump;t0 lenxo3tydlpD an o;(  2tmir3oodoltn nes ()sruaxmoou1tlxnif3tadls2umnmo (4 exrmr ta1fmDelivil()trumxo oo1om   nvtat  rtrxmpnt1teeo icilslmDelumpnt0tlenifciatom eaueo t0texrxr3iu1lm  mfesa( aDrrx o;o1apxnmoctysfaDulnvpnt4tltnir3iotoatranvo;s  etmimpio1amen fvsl(fartmxmooo4tpxo icils a rln p;(4 rtrmr3iodla   n slt)trtmxrpou1alee fcias aDumu  ;o4olt io3iadlmDua( s;t4 ltoif3tydfmtrai o ( t2urim3oydoleemivtls)srumx oou0aleoifciytla2elump;u) ltrmrciadfaD livs;s sexoxr nudal emfes (f rumxronu4aptoiiciyd s2emn s u4aleomr oadlaDrai ol(0 eur(m oo1ome mfet (faDtrx  ;u1oetomfetys m2rlumpn(0teeoxo3oydlpt li s;(0t2umimpoy4lmtemnctas)s2rrur ;o4altoio3iys mDumumo ()alxrxo todop eluei s0setriopoy1ll nmiesl(f Dta(mp;u1apen i3iaslm2el(mp t0 exrxo3ta1lm e u ol() 2umio3oo4al nlivs sfsrtax o;o1texniietat m eanmo;()tleoxf oydopDrln il()trumio iy4lp elfvi ( aruru  oo4aptnif3iatlm2rlumsnt4altoif3ta1lp e u s;t  etoxo3iy4al   fcil(f Dtm(r nt4olxoifctysfa2uauvs;u) eeoxocoy1opDrlu i s0 eur(mpou1lmenlicilsf 2umu oot1altnmoetat s2rmu snt0treomfciadlaDeaiei t teto(m3no1opte nvslt) rrax o;o1oex if3ils sDumu s;t4 lxrifcoa1lmDe ivsls trtmxr3no1aptnlivslt srumx oot0tpenmfctys aDul(mo u0treoxfciadlp  lnes;(0t2xrio nydllt mnei ( arra( pou1oleo fciatfm rlumo () lxrio oa1op r n ils0 rxo(o oudomeemfcias  rrrxrpot1ape ii3tat sDrmnvs;(0 exrmf3oadfp r n s s  rto(opiydlmt mnvi ( aruru  nt0alenioeiatfm2elnmp u0 etnxo iotfateauvslt t2uoiopnu4am  lfeia() 2rmu oou1opxnmoetlsfm ul( p;t0tlerio3oy1oaDrauvi s)srtm(rpnydam n fvsl(fsDuaxrpot4tpxniietysfa ul(vsnt4 exrxr3iydfp rluei;t setrimpio4amtn ictl(fa2tm(r ot1tex ifetytfmDeaums;t4aetoir oatlateli slt) 2um(m iy1olenlfvslt)a2rr( ono0aptomociyd s2emuvp;u4aetrxo oatlmDrai olt0 exr(r no4alte fcia() Duau ont0tpe miciydlmDeanmsnt4tlxoirciydopte i s;t  2xm(o nudlptelfcil()aruau o;t1olto f3tadlmDrmnvp t)aexoxo iy1optrluesl(0 2to(m3ny1lp nlfvtatf 2um(ro;o4alt iieils s2rmnvs () ltrxr3to1fmt  nvols0srurir iu4am  lnesa()s2tax pou4alxoifeiytlm umumo (0 renir3oodfa  aieol() exo(m3oodaptelivi (fs2ra(mo;t1aeeoii3tyt m2rl(ms (0tltnio3oy1lmDe i o;s) 2xmio3nu4lltnmieiat)s2truroot0oeeo ietysls2um(ms u0 leomoctatfmteanes;s0srtmio3iy1op emfvsas)sDua(  ot1alxoifetldfsDranvo;u)altnxr oodlpDrlivs s0srurimpoodome lnci ( sruaxmpoo1tpxo fcilt a rmnvp t4tlxrxf ootfatrli sls)seum(opno4lptnmfesl()s2ta( pnu4oetomf3ils s2umnmsnt) rxrir iadla raneo (  rumio oy4lp emivs s)a2uax  oo1oexo ocilsfs uau s;u4alerxo3oydfmt aueil(  2uoxmpoo4lmen fcslt)srrrx  ;u4oee ifeildfm ean onu0tetnmf oodoaDelies;() 2urxm iy1ll  mfctasfa2tr(r ;t0altn ieiysla2ea(vo;(0trxomfciotfmtrlivil()srtoxo nydapenlfciat sDtaxrpou1aex iiciadla rmnvs;(0 rtrif3oadopD lu s;t0s2to(r3nu1omtelicslsfs2raxrpnu1tptn i3tadls rln o t0 rerxf3iydlmDrluvi (0srxoirpiydalte nvt () 2rrxr oo1oleomfeilsls2elnvp t) rtrir3tytlm ean i s0srto(m3iydape liei (fsDua(ro;o0oet mfciys a uanvo;t4texoif3iytlmD luei t  rxmxo iudop  mfet t  2ururpoo0tlx io3tad a rlump t4arxrxf3ia1fpDrliei;()tetmim nudlp e fctlt arua(mpnt4ape moctlslsDua(monu4treoxo3oy1oateauvi s)srxrxr oy1om e fcsat) rumxrono0tetoioctld s rluvp t4altnmo oo1fa   n ils  rurio oy4al emfvta()a2rm(ro;u4oltnmoeiadlsDemums;t0 rtnmo3oytfat  uesls  rtmxo3oo1ap e ics s  Drm( poo1tlenii3ils m2el( pnt4tlxnxrcio1op  ai s (0texoxopoy1lp   fvs ()sDtm(rpoo4tle mf3tad a2ea( p;(4tlxnio iodlpDe ies s) ruo(o oy4lle  feil() Drm(r no0teeo oeildlm2elnvont4 eerxf oo1omteaivsl( s2umir3iy4am n fvilt srrr(monu1tetoioetldfm2rlnmo;t4arxrxf3iatfmDr neil(  rxr(rpoo4lptn fvsls  2rax  oo4oexomo3iasfaDeaums;(0alxrifcto1faD  ieo;s s2xoio3ny4ol   fcs tfsDtaumo;u0tptoiiciatfm2uln p;()tltoxf3tydoatr ivs;t0 euoxr nu4lp  mfctatf 2trxrpot4olxn i3iasfs2elump u4tetrmocta1lptrlueo t  2to(rpoudolt mfctls)srtrumpnt4oeenmfetydlsDeanmp;u)altnmo oodomt ai o s  rxo(m3oudll nliviatf Dra(m ot0optnmfciad m elnmo;u) ltnmr3iatop r ieo;()sexrirpiydlm n ncs (fa2ra(m ;u1aptoiietltla uanvpnu4tetnxr3iy1lpt  ues t) exoim iy4omee ncsa(  rrr(m nu1apxn fciyt a rl( snt4 exnxo3iadlmt li ols  2xmxo iy1am emfei s sDtaxm ;u0tpx ii3iltlm eluvs;u0artnxr3oy1fpt ai i;s0trtm(r3iudlme  neta(farum( ont0apxomoctad a eanmsn()aleomf3iydopt li i s0srtr(m oo4oltn nctl(f Drm(mooo1tltoiiciyt m2rl(vsnu0aexrxrciatfateauei s0setoxo iu4alenlneslsf rtrxr nu1altoiocildfs2rm(mpn() rtnifcoadlmtrli s t0 rumxmpno1oltnmnetls)sDum( ont4texoio3ild s eluvs;u4 ltnmociodfmDraivi t0 2xmxo iu4op  lfcsls)a2taxrooo4tpto f3iyd a ea(msn()arenmocta1lmte i s ()s2tmimpou4altelivsas)s2ur(  ot0oee  ietldls eau o t0tetrmrcoydlpt aies (0t2trir iy4amenlnctas)a2rrxmo;t0aexnifeiaslm ra(monu)artniocoatomD  ues t sexrxrpoodlleemnesa( s2rmuront0oltn ietls m2ea(mo u4trenxo totlmte nes;t) rtm(opio4am n ieta(f rumu ont0oleomfeiyd s rau s ()alxnmoctatlm elu ols teurxopiu4lmtnmfviatfsrtrxm nt0tlenii3ils mDum( ont)arxnxo3oatfm rauvilt  exoxr oudalen iciasfaruru pnt1ale  oeildls rmnvont)aexnmr3ty1lmDrlu ils)tetrxm iy4ap   ncsls)sDua(mpno0apeo oeiltlmDrm(msnt)arxnmo3iydfpDe i s ()trumim3nu4lp  mictlt  rtaxr ot1alxoio3tytfs umu o ()trermf tadfa e neils  exoirpou1lpe  ivsas srrr(mo;u1tltomi3tltfs rl( s (0 rtnmr3oy1op  auvs;()srurim3oudom nlictas) rtaump;u1tlen iciyt s emumo u0tetrmr totoptelu o t0srxrxm ou4apeemnvtl(f rrruront1opxnioctasfa ea(vs (0 rerif ty1lptran ol(0 exoimpnu4apt lfeiasf rtrx ont4opto o3iad m2eaump;u4trtoioctytlaD  ues (  2tmxr oo4lmt  nei (f Durumono4oltnmo3tysfs2um(ms (4arxnmr3oa1omtelues t0seumxo3ny4omenmfvi sfs2ta( pou0optomfeiys m ra( snu) lxnmociydlmt luvo s sexo(r3iodop   nvsl()aDtmxmo;u0tpt  f3ilsfs rauvp;(4aexnxfcty1omDrlivilt)seum(r oudome mics (  rtru pno1tpx ifeiydfm ra(vo;t4 lxoiocty1oa raues;t  ruo(r nu4ameemfesat)sDtrum ;o0oexoif3iytfs2ra(vp;u)teenxr oydlm e i o (0 rtmxr iodlmtn fctas a2tm(mp;o1alen ieiydfm ua(vsn(0alxnifctytop ranvslt)sruoirpoy1llee ieta()aDtau ont0tee miciyt s2umuvonu) rerxf3totfaDe i s;t0t2uoimpiu4ap  lfcsat srum( ooo1tleoifctyslaDuan s;(4 rtnxf tatlmDe nei;s teur(r oodllte ieslsfs2taxmooo4ope ifeiat a2eanmon(0 eeoxf ia1op   nvi s s2trio3nydamenlnctat s2um(ro;o0tpxoif3ild a2umnmp t4aleoxrcoytlp   n o;s) eurio nodole mfcsl()srtrxmoot1altomietaslmDuanvp (0 ltoxo iodfmD lneo (0t2uoxr3ou4opee nvsa(f rtaxmp;u1aleniieiatlmDemnmsnt) rxoifciydlp r u o ()t2trxopny1op emnvi ( artmuronu4apxomi3iadfs rm(mo;(4teeoio3oadfm raiei ( trxmir iudamtemieiasf rtm(rpnt4tpenif3iasfsDul(vp t0altomf3oatlmte ivs;t t2to(mpiudamteliviat)arrm(m ;t4aleoifeils m emnmp;(0 renxr iydlpD auvsl(  ruo(m3io1apenlneilt)s2umx  oo0oleniietadla elu p (0teeoxf oytom  anvo;t0 etoxm3ou1lp nlfcilt srurxr oo1alen feiadfs2uau s;t4 ltnxf3oytoa e n il(0 2umxopiudamt  feta()s2rr(mpou0texn oeiydfa rl(vo u)arenxr oatopD an s t  exrxr3io4ap n nvtas) rtrum ;t0tpenmictldfs uaumonu)aeeoif3to1la raiei;(  etoxr3nydom nmneiatfsDtmurpno4opeo o3ild mDranvo u4 eenxr3tytopt lnvs;t0t2uo(r3io1ome mfetas s2raxro;u0oltnmoeiltlmDulu o t) etrmr todlm eln ols0 rxmxo3iy1om nlfci tfarumx  oo4aee  i3iad a uln p t)artoif ta1lmD aueilt)t2xmir3nodlp e ieilsfa2ua(r ;t0tltoii3iyd sDumnms u) exnifcoatopDrluvo s s2uoio ny4lmen fvtas)aDtr(roou0alx  o3tltls uln o (4 rerir to1fp r nes;s0t2xo(o3ny4omt lnvs ( aDrmurpno0tpxo fciys aDranmon(0trenxociatom elneolt teumxo3nu1lleelfesltfsDuaum oo0aetoiocias s rlump t0tltrxf3ty1lpteanvi s)srxrim oo1amtnmicias) rtm(mooo0aexn ieias s rluvs;t0 lxrxrciodom  aiei;t)t2tmim iu4op e feiltfsrraxrpoo0opto iciytfsDrauvp;u4tleoxr oy1fp rli s;t0teuoxr iy1lmtn neias)aDuaurpnu0ale ii3iysfsDem(mo;t0aexomocoy1opDr i s;()setoxmpny1lm e nvtat)aDrr(mpot1olxomocildfaDrauvs t4altnxocto1fmDrlues t0 exoim ny4ap   ivtlt)a2rmu ooo1tex ii3tlsla2rau s;u) reomf3tytla   uvi ()s2tm(r3io1lpte fcia( sDua(  no0oetoifcilsfm2el(vs;u4trtnifctodopDeaivils setm(r3iy4apen fet t)s2rm(r ot0aeeomociltls2rm( p t4trxnmf3todlp rlnes s)s2to(rpoudll e nct t)sruau  nu4tptnmietydfa2elnmp (0tetnxf3oodoaDr i sl(  2xmio3iu1lpt lnvias sDurur oo4aex ii3iytlsDrmn o t0 rxomr ootfp r ueols) 2xm(o nu1open ncta( aDum(mooo4oexnmoetydfs ranmonu0texrmf3iytfp ran ols)trtmir iydap n nesa(fs2rrxmoot0tetomoeild aDrmuvont0 lxoxo tydfp eaieil(0trum(opiydaleemfetat sDrmu pnu0oex  iciysla2rmuvs;(0artrxrctodfpt lueo s)s2urim ny4ol e fct ()s2rru  oo0optomfciydfmDea( p;(4tlxnif3tadfptranei;t0trur(m3iu4op nlnctas)aDtax pot1ale mocild aDea( onu4texnxrcoydlaDean i;s0s2xrim iu4lp   iei t)arrau p;u0tpxoif3iytlm2uanmo ()texrmrctatom eau s s0trtm(o3iodlpt mnet (fsrumumpot0tpx  octatfa2ra(ms (0 lxrxo3iydfmt auvol( teuoxm3nu4al nlnciat)a2urxrpnt0oetn o3iytls2el(msnt0trxnmo ootlmDe u ilt)t2uo(r3no4lleemfci t) 2uaxm nt1tpenmo3tys aDrlnvo;(4aexrir3oadfpDranvs t0 etrxr3ou1am  lneslt a2ra(mono4opxo fciysfa2ua(mon(4 rxomocta1oaD  iei s  2xrio nu4lmtn fviltfs2umxr oo1ape ifetydlaDeanmo;t4altrircootlpDeanes ( srxmxopnudame lfes t) 2rm(rp;t4apxn ictltlaDrmums;u)arxomfciytlptean s t) rtrxopnu1openmnetas)sruaxm ;o0apxn o3tatlmDuanvs;() lenioctatfpteauvs;t seuoimpnodale  icsa(  rtm(mpnu0alx  f3ilsfm2ulnmp;u)aeeoxf iotlatrluvo s)s2xrxm3oydal e fetat)sDuru  ou4optomfetatfa ranmp t4arxnxr3totoaD lneil(0 2toir3no1al  mnvi t arta( ont0tpe  fcildls el(vs u4 lermoctadopDe ivs;()t2tmxrpiu1aptn fcslsf 2umumo;u0texoiieias a rm( snu4alxrmo to1lpte ies;s0sexrim nu4alt  icsls  2um(ronu1olenifciydfm2rlumo t0trtrir oytoaD  i ilt0srtoio3oy1am  mivs s)srraxro;t1olt  fciyd mDum(vs;(4arxrmrctytomDrluvs ()srtmir3ou1amt lnvtatfsrta(r no4ale iiciysfs emu sn() leoir ia1fpDraneol( s2tmio iu4apeemfcs ()sDuru p;o4ape ioeiasla elumo;t4alerxr3oy1opteluvo s)teurim ny1llenmicsl( sDua( ont0teeo f3tysfa eanmp;t4teerxo oydomt  i i;s)trxr(rpiy1lmtnlfct t aDtruront1tet  f3iytfm2umn snu)alxoxf iy1oatelivi;( t2trxm3oydam emict (f Dur(ront4teeoiiciltfsDel( s (4trxrif iytfpt anes ( sexoxmpio1lpee iviltfarta(ro;t1aetn i3ilsfa2el( s;() ltomocty1fatrluvs;() 2xmiopnu4optnlietltfaDtmx pnu0tpx io3tld mDumnmsnt0 eenifcootomt  iei;t)teumir3iu1ll emfeias)aruru o;o0aeenifciad a eln o t4altomrcoo1fateaues;t0 euoiopoo1alt lnctat)sDuaur ;o4tpenmf3iys m emn snt)teenmfcoa1fmt  n sls s2xo(m oy1apee feslsfsDrm(m ;t0openmf3ilsfs2elnvp ()aleomf3ta1faD auvo;s0t2toxmpnu4llt mnvtl()sDururp;u4aptn ietydla2rmnvs u) exoio3io1fm eln ols0setm(o3iu4alte nesasfaDuaumono0optomfciadla rlnvpnu4teeoir3oadlmtr nvs (0seurio3oo1ole  feiat arrrx  ou0tlenmfciat mDumnvonu0 exrxfctydfm e uvs s s2xr(o iodomt mncs tfaruauronu0oee ioetadls umnmsn()aeenif3ta1fatrauei s  etoiopnu4apt lietasf rtmumont0tlx moctydls2ranmo;t0areoxo totopDr u sls  2xr(m nu1lp e fcsas s2urumpou0aleomictls s2emnvs t4 eeomfctotlaDr ues;() rtmio3nodomt  fvi (  2tmx p;t1aptn ietlslmDrm( o;() renircoydlp  lu s;s0tetoir3iu1opeelivtl(  Dtr(mo;o0tpt ifetyd s rm( p;t) exoxf3iatfpD lueils0trumxopiydll  lnvilsf 2ta( p;t0aeeo octlt m ra( p;(0trtnmr iotoa elneo;s srtmir3oodap emici sfaruru oot0tpxoiicilsfa umu o u)treniociy1oa   u ilt)setmxo3nydom   nvtatfsDuaumonu1aee mfctas s rln s t)trenmr3ty1fm  li ils0trur(mpou4ol  mivs t  2tax p;t4optomocild aDuanvs t)arxnxf ta1oaD auvi s0t2xrxo oudaptemies s sDrmur nt4ole  o3tysla ulnms u4 etnmo tatopDeanvi;s sexo(m oo1lm nmfvtl() 2ra( p;u0altnifciadfs2emu pnu0 etomrciydoaDr n ils s2tr(r3iu1lmee iesl() rtr(rpno4aetomociat sDelu o;u4alxnir3ia1opD lnvs;()seuo(rpno4lleelnvs t  Durxmoot0tetomfeiaslmDeauvsnu4tlenmf todfptraieilt t2xriopnydllenlfeslt srrm( pno1tpx  fciaslsDel(mpnt)altnxo oo1op elnvils)tetoxr3oodap  mfei tfa2trxmono0tle io3tyd m2ea(von(0 rerxr3oy1oateau sls0sexmim oo1al emncsat a2rau  ou0apeo f3tls a2emnvs (4 rtnir3iydlp  anei;s  eurio3iy4lpenlnvslsf Drmumooo1texn fctys s2rmnms;t0aeerxr tydla   ies t0 rtm(o3no1llte fcs t)artmxmp;t0tlt  i3iyd s elu o;u0texoifctytopDeaueilt0srtm(r3nudllee fes tfa2tmum ;t1tpxnif3tatfsDrluvs;t)artnmfcoa1lpte n i;()s2xmim nydlpt mfesatfs2uau oot4aex if3tlsfs eanvo;u4 reoxr tadfmt ai ols t2umio3nodapeemfeils)a2trumo;u0tlxnioctadfs2ean snu4alermrcia1oa rlivolt)sruo(m3oodap  lfviasf 2rmuro;o4ole ii3ias s2raump ()tlxrio tytfmD aueo;()t2um(r3oydomeelfctas) 2raumono0tltn iciltfsDrmnvo;t)altoio ia1op elieils)texrir nu4om nmfct t s2taxmono4ape  o3tldls2emuvp;u0altrmo io1faDr uvs;s t2toim3nodapen ici sfsDurumpno4tet mfetysla ra(msnu0tleoir oo1la eau i;t)s2umir3iu4al elieiat)aDtax poo0apeoiictls aDrmnmon() eenmf3ty1om r ivol( trtmxm3iu1opt lfvsat  rururpnt4tee ii3ild a rau s;u) etnmrcio1oaDrau o s)srxo(rpoo4ll  mivil(  rrrxr oo1oexnmfctlt aDul(vp;(4texomo3iodfmtelu ils s2toirpoo4lptelieia(f Drr(mp;o0tetoiieiasla2rluvs t0treoxocoodfat  uvs;s0texm(mpiu4amtn ici sfsDuaxrpno0apxn o3tatfm2umnvs;(4tetnmocoy1fmDr ieo;s)t2uoxr iu4ale mnctasf 2uauronu1tetnmfeiat mDem(vo u4altrmo io1fp e ivo;(  2xoxo nudlp n fctas) 2trxrpou1oexniicild aDuan ont4 rxnmfctydomDeau i;t0t2xoio oo1al e nvt ( a2rm( onu1tetn icildlmDulnmo;t0teerxr iytfm r nes;()srurir3nydllenliviltfa2tmxmp;u0apen fetat a2rl(mon(0tlxoif3ta1lat auvo (0 2toirpnydap  mfvt tfs2truroot4aetn oeiatlaDuau sn(4tltomfctadfp  lu s t) 2ur(m3oodaleemieia(fsDta( ont1ole  f3tadlmDeanvo t4tltnircoatom   u s s s2xmxmpno1omtn iciat sDrmxro;t0oltomieiydlm2rm(vp t) rxnmo tadomD lieilt) ruo(o nodoltnmfct t)srra(ro;t0olto fciyd a2umnms;(0teenio oa1omtelies;t s2uoxm3oy4lp emieiasfaDrax ooo0olxn fetadlm ul(mp (0tetomr oydlpDelnvs s) 2tmimpno1lleemnei tfs2uaxrpno1opeo f3tysla2ranms t)arerio oydlat liei t0 rtm(m oy1amte fcsls s2uau pno0apxn oetat mDuauvsnu0arenxr3tadlpDeai ol(0s2urxm iudomtnlncslt s2tmxrp;t4alenioctasfa rm(vs;t)texnir totop   u o;s0tetrio3iydlmeelicsa()sDrmxr oo1tex  iciyd m2emn o;t)tltnio ootoatrluvilt  2trimpoudam emiet t)arraumono0tpt io3iadfm2rmu s;t)tlxoxr tytfp ean ol(0 exoim iydoptnlfcta( srua( pot0olx iociadlmDeau pn(0alerxo tadfat ln s;t0trurxrpoo4am  lfvils  Drrxrpnt4aetoif3tlsfs el( o t4alenxrctytlaDraies s)setoir3iu1om e ies s)artm(mpot1alt ioctatfs2uauvp;u4 etrir oy1fmDr nvo;s0srtrxm3iydamteliesa()aDtr( o;t0oltoifeiytfa ul(vp;u) rtnxo3iy1lmDe iesls)t2uo(r3nudolee iet tf rtmxmonu4oeen ociyd aDel(mp u0aleoircoo1lmDeli i;s)texr(o ou1lleemfct ()a2rmx  ;u4opx mfcias s eanvpn()arxnxf tydom   i i t0 rtoxr iy4al nlies t aDuaum no1aleo ociaslsDumums;u4 etrio iy1fpDr n i s s2umir3nu4opeemivtatf 2uaxr ot1opt ifetadfa ea(vo;()trxrmr oa1lptraiei;s)texoir nydome lnvtl(f Duaurp;o4olx ioeiad m emu p;u4trtoifctotlate nvils s2xoxopiodomte fci (fs2taxm oo4aptomociysfmDua(vsn(4aetoir3iydlmteanei t) 2umiopiodapen ivil()srtr( p;t1aexnioetadlaDumnmp;u4trermf3oadfa   i sl()trxo(rpoo1olt lnvt s)srrruro;u1oexn ieiadla umums;(0areoio oa1la e uvs;()t2umir3oy1am   fvtl()arumu  ;u1oeen ieiasfs2rmn pnt4 renifciydomtrlneo;t sexrio3oo4ap emnvi t)sruru  no4altnio3iasfs2umuvsnt0 rxrxf3iadfa  au ols  rxr(r oo4lltn fvi t)srtaxrpoo0teeomo3iytfm2rmu onu0arxnmfcoadfa   i i;t0texoxr oy4olenlnviat)a2ur(mo;o1ope ioetltlaDum( ont4trxrmrciatlp eaivol( trxmxo oudop emnciasfa2umxmont4oetomietad a2rmu s t0arxomf3oa1lp  luei t0 etm(o3oodal  livsatf Durumo;u1tpe  fctatfm2emnmp;u)tlxrmo oatlm  aues;(0s2urio oo4amenlieil( a2um(mpoo4olt mfciyt sDemums t) rxrxf oodlatr i i t srxoxr3oodamt lnvsat  2urx  oo0olxo iciyt a2rm(mo;(4altrmo3tytoaDeaneilt  etoio io1om   iesas)a2tr(r nt1aptnmoctlsfa ea( o u)alerir oadop elnvo;t0t2umim3nydol emnvt (  Drm(r nu1ole  i3tldlsDean snu)aetomr tydomt  i olt0sruoimpoy1ap emfctl( aDum(mpnu1tex  ieiyt s rl( p;t4 rtoxrctydfp   ivi s) 2tmxr3ou1ll  lnct s arrau  ;t1texoio3ilsfmDrau o u4aetoifctotla  aivs;(  etmxm3oy4lle lncia(fa2urumono4tpx  f3ilt a2ra( p;u4 rxomr tydfaDeaivslt t2uo(r oudam emnvi tfs2taumpoo1alx  ietas a rau snt)trxrif oa1fatr i o ()trur(r3iy4altemieta(f rtmxm oo4tle mictytls ranms ()tetomf3oodfptraivo t0s2trxmpny1ll   ivt s  2rmx  nu4olt ifetlsfaDuauvp;u0aexrir3iatfat  nvo;t  rumir3oydlpee fetas)aDrmxmp;o4tee  i3iasls el(mo t0 etoxfctatfmte n i s t2uoir nydapeemfesl(f rumumpot1aleo fciyt s um(mo u4 rxoxfciatfaDeluei ()trtmxmpoo1ol   fctas srtmxront0apxomoeiytlsDuanms;u)trtoxfctytlm eln o s)sexoiopoodlleelneia()srumx  ;o1opto oeiat s2uauvsnt0alxnif totlp  ai s t)trxmio iodlpeemfci (faDra(moot4tpenifeias sDeaumo t4trxrif3iy1fa   neils)tetoiopio4olte ictatfsDra(mo;t0oexoifciyt sDuluvs;u4 ltoxf iodopteauvo;t0t2tr(r oodlptemicta(f Dra(mpot4apeo o3tadfs2ulu s u0 exrxf3ia1fmDeaieil( teuo(rpno1alt mnet s  2rr(ronu1tetnifeiatls2em(vs u4trermo oodlmte ies;(0srtr(m3no1ome lfesas  rua(mpou0tlxomfetat s2ua(vs u0alenifciadla e i ol() 2urimpnu1lpe lictas a2rmuroot1aexn oetasfsDrmu s u0aetomo3to1omteluvo;s)sexmxm iydam n ietls  Drrxr ou0aptoiictltla2umumsn()tltrxr iotlmteaivs (0 euoxmpoo4aleemictas  2tr( pnt0oltnmieiltfsDrm( s;t0alxnio tydla e i o t0trur(m3iy1am emivi sfaDrr(m ;u4ape ifeiltfa rmnvp t)aexoio ty1fmtran slt  rxm(rpiy4lp emieiltfaDrmuronu4oee miciyslm2rl(msn(4tleoxo iadlaDr n s;( srxmxo no4lpeemnetl(fa2um(mp;o4aeen f3iatls2uan o;t)trenio3todlpt  u s t  rurir3ny4opte fesa(fs2rmurp;t1tltnmoeiadfmDrln s (0trerio tydlatrai i s  2xoim3nudale  ics s  2raxro;o1texn ictad m el( p t)tlxniociytom rluei s0sexmiopny1lmenmieia(faDrmx ont4apen fctldfm2el( s;t0tetrmr3oo1fp ranvi;t0truo(r oydam nmiet t) 2ur(mooo4teeomoeiydls uaumo t0aexnxr tytoa  lneolt  ruriopnu4ale lnei tf 2rm(mpno4oeenmfeiyd mDeln p u4 lxnxoctatfpt lueo s) rurxm oy4ame mfctas a2rrx pno1apenioctydfs2rmu s;(4alxrifciy1lateauvo;t0texr(r3ny1lltnlfet t) rumxm ;o4oexnioeiasfm2ranmo (4 rxomf tytfp rln s t)t2uoimpoodopeelivsas  Dua( onu4aptn fctydls rmu onu)tltniocoadopDe n s (0 eurxmpnu4lle lfvtasfa2ur(r ;t0apxomoetadfa ulnvp;() renmf3iy1fmt li o (0t2ur(m3no4ame mfeils)a2ra(r ;u1tleoii3iydla2uaums;(0tlxoiociy1lm r n o ( srum(opiy4aptn ies (f Dtmxrooo4alx ioctltfmDranmpn(4artnxo3iytomte uvs;s  rxm(opoydopt  ieil(fs2um( pnt1aetnio3iaslaDumnvsnt) eerio3ta1laDeauvs;s) rur(r iu1lpt liesatfarua( poo4aexn icildls2emuvont)tetrmf3oydlpD aivo t) rxoxr3oo4lpee ivi s)s2rmumpnt0oexnmoeiasla ea(vonu)trenmo tydfpDelnvo s  2umxm oy1apte netl( sDtm(moot0aexnioeiatfaDeauvo;u0 lenif3iy1lmD au olt0srto(r3iudlptelnct ( aDta( pnt1ape mo3iydlm ra(vs;t)tltrmo totfa  li s ()s2urirpny1opt  ivtlt arraump;t0tetnioeiasfs eanvpnu)tltoxo3oadla rluvil()s2tmxr3iu4ope  ncsl( arrmx p;t4altoioeiatls umu p u0 renmrctodlpD luvs;s teur(rpnu4ol nmicta(  rta(rp;t0apxnio3tlt mDeluvsnt4altnifcoadop ran slt  rur(mpio4al n nct t) Draumpoo1tleoio3ild s ulu o;u) etoioctotlmt  ueil(0 exmxrpno4ap n nes tfsDtmum ot1oet if3ilt m2umnvs;u)artrirctatfat lnesl(0t2xriopnydoltemfeiatfs2ua(mpou1alt io3tatls el( s;u)tlxnircoytlmD  u s;t s2to(r ou4apte ivt s  rum(mpot0olto ictatls emuvp;(4 eerif3oo1fm rlnvsls)teurir io1omeemnvt s) rtaxmpou1tlxomfeiysls2uluvont4teeoxr3oodlmD  ivils srxrxopnu4lp nmnvtlt)aDtr(  ;u4tetnif3ilsfaDuau o;t4texoxo3iydlate i o;t0t2tm(r3no1ole lietl(f rtm(mooo1oetoii3iadfaDemu p;()areoiocoatfm eanvilt0t2to(o oo4om nliesas a2tmxro;t4tet miciasfm umnmp u0 rtoxo oodfp rlivs;( trtmxrpno4alenmivtas  Dtrxrp;o4opxnifctytfs uanvo t4texrio oydla  lnvo t0 2trxr3oy4amtnmfet tfsDtaxr ou1aee mocildlaDel(vs (0 leoxo oytoa rlnei;(0sexr(r iu4lpeelnes s srrax o;u1tpenmf3ias a ra( o;u0tetnxf3iotlmt lueo;(  rtm(opoo1aptn iet tfaDuaumpot1altniociat m2ra( on()aeermocoatfm  an i;t)sexriopoydopte iviat  2ur(ro;t0opeo ictysfa2uau p () lenmoctodfa r i sl(0t2tm(rpoy4lpenlivtat  2rr(mpno4olto iciytls rauvs;(4tetrirctotfm rau s;s  2urxmpiu4aptnlnvsa( srtr( onu1altn o3iyt aDrlnmsnt) rtoirciotopt  i i t  ruo(m iodamte iesa()sDur(  nt4opxniociyslaDuluvp t4 lxoxfcootlat  i ol(0 rumim3ou1omeelnetat  2ra(rono4tlto iciat sDrmnvp (4altrxocio1fat lueo;t trtmxrpnu4omeelfcia()srur(rp;t4tet ioctatlm2umumsnu) etrmr ootlptrlnes ()t2tr(r nydlme lfvil(fsDtauro;t0teen ocild a ulnvpnu0 lenxoctodla eln s;s) exr(r3oy4amt mict s aDua(m ;u1oee  f3ilsla ulnvon(0 etrifciydfmteauei;s)srtrirpny4amtnmfes s) Dumumpot1tpeomieiyt a2rlumpn(0 lermf3iodop  an i t) rxoxm3no1olenlnetls arrmx o;o1apenio3iad s2elump u4teeriocoodlmD  u sl() rtrim oo4ameemneils  Drmx  no1olx  oeiltfm2rmnvp ()artomocoatlpteliei t0 rurxm no1ll elivt ()arururpno0opxn i3ilslsDemums;(4 etoxocty1fpDrau i ()srumiopiy4op  lncilt aDtmxmo;t1tlxnmf3ildlaDrlu s;(4artnioctydfm r uvi;t)teuoxo no1aptnmfvi t) rurxmooo1oeeoifcilt s eaumo ()trtnmfctotopteanvs;s s2to(opiudapeemneia()artax pno0tlenmoctysfsDrl(vs t4aeermo iodlaDr uvi s  2tm(o3oo4lmenmivs sf 2raxm ;t1tlenioeias s2ua( s;()trxnmocoadlpte nvs;s teur(m iu1lmeemncs t  2ta(r nt0oeeoifciytfm ulnvp;u4areriociatfm r neo;s0teurxrpiy1apeemict (f Drrxm ot4ale moeiysla em(msnu4artrirciotoa rlnvo;(0trtrio3io4lp   ncsat  Drrxmonu1olen octls a ranmont0 lermr to1omDeai i t0s2uo(r3nydlltnlict t  Drmurpou0oexnioetys m2ra(vpnt) lxomr totom rliei (0truoxopou4lmt  nviasfsDtrumo;t1oexoifctadfaDrmnms;u4aeeoxf ta1lmt an o;()s2uoxo iydlptemfctat a2urxmpou0tltoiieiatlmDrl(mo t)areomfctotlmD  ivo;s0tetr(mpnydom  mivia( srra( o;o0oeeomi3tlsfa2rlnvpnu) ltrio tytopDr nes ( t2xm(m ou1lltelivsl( a2ururo;t4tleoifeiyd sDrmu p t4aetoio ta1oaDrlues;( seur(r io1ape  fvsls aDrmxrp;t0olxn fciasfa eln s u4teeomo iydfptrluvo t t2urxopnudlp   icsl()a2tmxrpnu0opto fciyd s2rlnvo;t4 eermr iotoaD livils)t2toim nodaptnlfet t arrmumo;u0tlxoio3tldla2uau p t0 ltnircio1fpD luvo;(  2xmxo ny1ol n ieilt  2uaurp;t1ale  i3iat m rmu s (0tlermo tytfp r u o s0 eumxr io1amee icia(f Duru pnu0tle iictlslm2ea(ms ()alxrxf3oadla eaivs t)teurir no4altnmnvtatf 2umuront4tpx mo3iydfa el(vpnu) lerir tadfmDrlnvs s seur(opno1lpe mncs t)aDraumpot0opeo ictasfa2eluvont4 exnxr tytlaD luei ()trur(m ny1amtemietl(fsDtrxroou0oex mieiydlsDulnvp (4artnmf3iadoaDelivols0 exmxo3no4lm nlfetlsfaDrr(mo;o1texnmfciadls raumo u4areomo3totomD aneo s sruoim3oudoltnmfctlsfs2tau  nt4tpto iciytla2ulu o;u0alerir oo1oatr n s s)trtr(o3iy1amenlieilt srraum ;t1tex  ictyt sDrm(mp u)trerio3tatlpt livs;(0srumxo3iu4llenlicsls) Dtmurpno0tee  oeiltla rl( p (4 eermf ootlm e ivo;s)texrim3iu4lme  fesas) Drau pou4oetnmoeiltlm2ua( p;t4teerxr oodfpteanei;(0 etm(m3no1op n fvt tfs2umxmonu1opxnmf3iysfsDeaums;u)teerxo oydlaDr ivslt0texrimpoo1lmte fvslt aDur(ronu4alxnifciltlaDrlnmo;u4tlxrxo iy1oat an o;(  rtmxm oy4om e ivi t)sDrrx  ;u0aee ifetld aDumums;u)teenmf3oa1oa r n o s)teurir3iu1amee ivslsf Dtax o;t0texnmf3tasfmDrlumpn() lenxf3iy1faDeau s;()sexrim no4amenlfet () Dtmxmoou4oetniictadlaDean p (4aetrmf iy1latelivi t) 2xoxo3nudopenmics sfa2umxmp;t1tlt mi3taslmDulu snu)trtoxrcto1lmtr i o s tetmxo oo4ol   nes () 2rmurpot4oeto ieiytfs emu p t4trxoif3todlmt  nei;(0 exr(m3nodlpenmnvia() Dtaump;t1tetoio3tldfm2rm(mo t0arerxf3iydlm rlneo t truriopiu4am nmncia(faruau o;t1tpenmi3iasls2rmu p;()texnxocootlm   ivi () etmxm3ny1ll n ncils  rrmu  nt0tptoif3ilsfa em(mp u) etrmo tadlpDraueslt trumxo3nudam nmnct ( sDtau  no4oetomi3iys a2rln snu4 eermocoo1om  li s;(0s2uoxm iudapt lneiat)a2ur(rpnu1tpt  feildls2em(mp;(0alxrio3tydomtr i o;t) 2toxopiodlp elietl( sDtrurooo1opxniiciatlm2umumsnt4arxoifcoydlm eau i;s0 2ur(rpoo1olee ncilt a2trxm oo4texn ictad a rl(msn() exrmrcoodlptr i i s0 etm(o3oy4om nmnvsasf rtax  ;o0aee iicilsls2ulump t) rtnxf3iodfpDranvo;( trurim3oo1om n nviatfsrtm( pou1aptnmfciyd aDuaumsn(4alxoxoctotfmt liei;s)t2tmir3iudolte nct t srumxront1aptoiociltlm emums;u)aeerxfcootlm eli s ( tetrim oo4ol  lnes t  2rmxmoou1teenifeiat a2rmnms;u0 leoxf3oa1lm rln sls0 2uoim3oydaltnmfesa()arrmxmpnu4aet  oeiyt mDeauvp;u) ltnmf totfmt lnvi ( t2tr(m3nudlptnmivilt a2rm(m ot4olxoifetydfmDumnvp;u4texrircoodfm r uesl() exm(o ou1openmicia()aDuaumpot4tlt ifetad s ulu sn(4 lxrmrcoy1optrau i t) 2tr(r3ny1lp  lfvtat) rrrxmpou1oltomo3ildfsDrauvp;(0artoifctytlpD anes t)teto(opiodaptnmnvi s) Dtmu pnu0apxnmociltfaDum(mo;u0 eeomfciatfaDeln o s)teur(m3iydlmenmics () rrmurpoo0tpeomoeilt m2ran p u0 lerir oodfp r i o s teuriopno4ome  nctat)sDumu  no4tleoifetas a2rmumont4tetnmf3iodomtrli o (0 eum(o3oy4oleelnci s artr(root1tpeoifeiys m2el(monu0aeermocia1fptrln o ( srxr(r3iy1oltn iesl(f rtm(m ot4tle  oeiydfs em(vs t0aetrmoctodfpDrli s s  2toxrpny4lp emivsa(  2ua( pnt4oltoioetatfm eanvsn(4trtnioctadfaDraues t texo(r iydalee feil(  Dum( p;t0ole  fetlsla2ra( s (0 eeomo3to1fpDrlivols s2xo(r io1ome lfetltfa2rmurono4tltoifetat s uan o (4 reoxo todfmt lueo;s trtoim3no1omenmfciatfa2uaum nt4aexn ieiltfsDem( snt4 rtoxf iotfmDe ivo;t) rxmim iu4opee nvt s a2ra(mpot1ole iociyd sDra(von() lenio ta1fp   uvs;s)t2trxmpoo4amee fvt s) Dua(mpno1tltn oeils a rluvsnu)trtnmr3oo1la  an il(  rtmxm oo1ap nlnvt t  rumx  nu1aetnmi3iatlm2emnms u)tetnifciadfaDe i i;t  rtmirpno1openmnvsasfsDtm(ro;u0ale  fciys mDrl(vs t0 lerxo3oytopDrai sl( seum(rpnydomt mici sfartruro;u0oetoiieiltfa umuvs;(4tetrxfciy1fmt  ivils  2trxrpiy1ol e nvs (f 2rru o;t0altomo3tldfm2ulumo ()aeeoif3iadlmD anesls0s2to(r3iydllt mict t srrax o;u4oeen f3tyd s rluvo;t) exnio3iy1oaDrai i;(0sexmxrpoy4optnmfesa() 2ra( ont1oetnio3ilt s2rlnvo;()artrmf ia1latrlueol()srtmimpny1alt mivsls s2rrxrp;o1opeomictys sDrmnmpnu4aleoxfcta1fa  anvs;t trxm(r3no4lm nlnes t)a2tau  no4aex mfciyt a ea( sn(0aexoxo3iadfptrlnvo s) 2xmir iy1ll elncilt) Dtmxm ou4oeeo i3iytfaDeauvsnu)teenxr3to1omteli s (0 etoio3iy1lm n iesl()sDra(mpoo1tetnmfeilt m2ran o;u)aetnxo iatfmteaivi;(0trxoxmpnydlmtnmivt t aDrrumpoo1ale  feilslmDeluvo u)tlxomo3todoaD aivs;t  eumim oodamtnlnvi s)a2urxmo;u1altn feiydfsDum(mp;u) rtrifcootlp rli i s)seum(m3nu1ale lfctlt)aDua(mpno0olenmicias mDel(vpnu4alxomr oydom  livo;s)trtoim3oy1am e nctlsfsDumu  oo1tleo ieiadfaDrm(ms ()arxoir3to1lpDr uei t)t2xoxm3oudalenlfeia(  Drmxmo;t4apxoioeiyslmDul(mpnt) lerxrciytla  livil(0 rxmio3no1ame lncs ( a2tr( pot4alxomf3iatfs ran snt)alenmr oodfa  lnvil(0trtoxopnu1opt lics ( a2urxm ou4tlen o3ilt mDrauvs;u)altrir oodoa e n s;s0tetrxm iydlmtnmfes sfsDurxrpno0aexn ociysfs uau s;u0aexrxo oodoa elieilt  rurir nydop e nvil(fsrra(r nu4aee  feiltls rmnmpnt)tltoxo oydoatrlies;t0 2tm(o3nu1lltnmfvta(f 2uaurp;o0aexnmiciltfmDuanvp;(0altnmrciytfm rlneolt seto(r nu4lmt lnetatfa2uaum ou0apeo fctytla ea(mp;t)aexrir totfm e uvo s)tetrxopio4omtnlnvs t s2uax ono4oltomociyslm em(vont)trtoircoo1oatrlueil()t2xrxo io1alenlivilt) 2uax p;t1tleoioctldfm eanvo ()trxoiocia1opt  nei;t)s2xr(r oo4apee nvtls)artm( oot1tpxnmfeiasfsDelnmsn(0 ltnxf oadfptrlu il(0 2tm(mpnodopt lnes s aDta(r ;t4tetoiocilslm rmumpnu4aetoio tytomt ln ols0t2trimpoy4optnlnct s sDta(mp;o4teeo fciat m rm(ms;u4 rxoir3tydop  au s (0s2uo(rpio1ol emnes t)aDtmx  nt1tetnifetlsfm2elu p t4treomr ootfpD li i (0 eurxrpny1al n ivias) Drax ont0teeo f3tytlmDulu s (0 ltrxr oo1op r neilt0 rxrio io1omtemnct t) rtaumo;u4teenmoeiydfm ea(mp;u0 eerio3tadoate u ilt)trurirpnu4lp nlfcs ( aDurxmpoo0oex iociytla rln o u0 exnmf3iatlm rliei t)t2to(o iy4ol nmivtlt)a2ur( p;u4aex  fetldfs uanvo u)tlxoxrciytfmDrlu o;( trtm(rpnudalt mnesl()aDrmx oot0aptnioetldfs2umums t) rtnxf ootlp   nes t texmxo3ny1ol nmnvtls) 2umxmp;u4tetoiicilt mDrm(ms;u0 etrxfcoydfpD anesl(0truoim io4ome mfvs s)a2uaurpnt4tlxnmo3iadfsDranmpn(0artrxo3oydlatranes ()setoir3oodllen iesl()a2rmumpnu1aexo i3ilslm2ran s;u4trxoxf3oatfaDraues;t0 2uoxm iy4lleeliei sf rrm( poo0oexo iciysfa2umumsn(0aetnxr iydlp   nvo;s  eurio3nu1lp  lfcsltfsrtr(rpnu0tleo o3tydfaDel( ont0texoir3tatlp  ai o;()trxo(r3oy4apen fesls  2rr(mont1apxomi3ilsfa2ra(vpnt) lerxf3oy1op rauvi;s) rto(rpiy4am  mivils)a2urxrpot1tpeo o3tyt a2el(mp;(4tltoifcty1fmt lneo ( s2umir3ou1lpeeliviltfa2ra(rpno4apx mociatfs umuvsn(4aetomo3tadfpt  ueo ()trto(m3nodol n fesa(  2urx pou1oee mocils a2rmuvsnu)trtoxr3iydoateaneo;s texrimpoo4op e ncias)arrrxmooo4apenmoeildfaDumn p;(0trtrmr3oatfm r ivolt0trtmir oydlleemnesa( sDuaumooo1opx  feilsfmDelnvs;t4trtrmo tydlm rln s;(0 2tmxo3oy1opeemnet (faDtauro;u4tltn f3iadfsDrl( s;u4trerir3tydfp eai i;s)tetrxrpiodalenmieta() rur(r nt4apt mociatlm em( pnt0aetnxocoatoat  i s;( setmir3oy4om nlnes s  Dta(moot1opeoii3iatfmDulu pn(4 eerxfciydla e n s s)srurxm oy1llte feia( a2ua(ro;t1tlxnifeiad m elu s t4teeoiocia1fateanvo;t) rtmxr3oo4lltemnvs s)sDtrumpno0oeeoii3iaslm uaump u0texnmf3oytlpt an i ( texrxmpoodamtemivs ()a2umx ont4oeeo iciydfs2um(ms (4 rxnmfctotlpDelneo s0 2xm(m3io4om nmfcs ( aDta(m ;t4alx  iciasfa elumo;t4 eenmr3io1optrluvsl(0texm(o nydamenlncilsfsDumx oou0texnii3iasfm2emu s;()arxoif iodomtelueo;s tetrxr oy4opee nvs t)aDrmx p;u1oexomo3ias m2umnmonu4altoifctodlmDeluvols0sexrio3iudomtnlfvsas a2ra(rpot1tlt io3iytls ulu pn(4 lxnxr3ta1opDeluvo;s s2xmxmpnu1lm nmivilt) rtrxrpno1texn fciltls elumo u)texoxo to1fa rlies;s)s2ur(o3iu1lm  mfeiatf Dta( o;u0olxoiocilsfmDumnvsnu4arxrxrciydom e i i;(0 etrxopny4lm n nes s s2tm( p;u1alenmf3iatfm umnvpn()tetrio3io1opteli i ( t2trxo iu1apenlnvs (fsrtmx onu0aex io3tldfm2eanms () leoircoodlat aivsls trtoim3oy1olenmiesatfsrtr(rpou1apenmo3iltfa2elump u4aeerxf3oytopte n sl(  rurio3ny4lpt mfetl()sDuau  ;t1tlxnif3tyd s2ranvsnt)teerir3oatfat  u s t)seuo(o3oo4amee icsl(fsrraum oo1teenmi3tadfaDulumo;(0 lxnxo3oo1fa raies t0setr(o3oodop nmieiat)a2rmur ;t1apt  ociaslsDrmn on(4 leomo ty1oat  ivs t  eumxm3io1ole  fetatfsDtm( onu0teenifctytla ran p;()alxnmf io1oaDeanes s)tetrxo oo1optnmnetlsfsrtax onu1olx  ocias a ulump (4altnxo oadfpt lies t0 2trxr io1lmtelfvi t)aDtm(mpno1ole mictldfaDeanvpnu4 etoio tadlaDrau ols)t2xmxo3oo1omtnlfetat  Dur(moou4oet io3iltfmDemnmo;(0artrxocootfaD au o s) 2umio3nodlpenmfesas) rtaur nt4opeo oeildfm2ul(ms;t0 etnmr3iatomD anvo;( t2xrxo3oy4ale lfvil(f rua(ro;u1opx iictyd mDrm(ms;u4 leoifctotfpt  nei (0tetr(r3io4ole  ivtasf Drm(  ot1altnifctydla ua( ont4 eeoio iatomDelivs;s0t2urir io4aptelfcil( sruaxm ;t4oetoiocild aDuln p t0texrxf3oa1opDr nvo;t0s2xo(m oudamtemnetasf Drru o;o4tlx  ictltfm ean p;u)tltnmo oa1lmD ai i ( s2xriopou1olte fvs (  rra(m ou0olx ii3iadla2emn o t4aexoxf oy1lpD aies ()trxm(o oudopeelnvias s2uaxrpou1open i3ildfaDrmuvonu4alxrxrcia1oatrlu o ( trtm(o3oo4oltnmfviat)aDtr(rpou0oexoio3iytlmDumnmo t0arenmfciatomt ln ils texrirpoy1omtnlfcia( arrm(  oo0apenifeiys a raums u) leoircio1lptr n ils0teum(m ny4ll e iciasfa2uau o;o1ope mo3iyt a ulu pnt)trxrmfciydfpD  nvs;t  2toio3iy1op n fei t)sDua( pnt1olxomf3iadfa2uluvsnt4tltrmocoydfm rliei ()t2toim3nu1ol   ieiasf Dtaxroou4aex  ietat mDran pn(0 etoxf iadlmtr uvi;t) 2trimpiy1aptemnci s)s2um(mpno1apxn o3tadls eauvs;t0tlenxociy1laDrauvil() 2uo(opiy1alt lnciltf Drr(r nt1olxn feiyslaDuan snt) eeoio ootomD luvil(0tetrim oy4omenmfvs t  rua(m nt4aetn ocilsfa ea( p;u)tetnxo iotop elueol(  rtr(mpiu4ol nlivsat sDur(rpot1tlxo fciaslaDea(msnu4 lxomf3oydlpDr uesls t2xm(o3iodlm e nviasf Dta( o;u1tlxomf3iyt mDul(vpnu4aexrif3oatfate nvils0 etmxo3nydlmenlnvt (fsrta(r ;o4oee  iciytfs2elnmo t4 rerir oydfmD auesl()srxoxmpiudalt lnetls)s2uaumont1aetnmf3iytfs2rmumo;t)aexoif oo1fpt lueslt0trxrxo3ou1op e fvil()s2ta(m ;t0oex iieiys s2elnms;t)tltoir3iy1opteau s t0 2xm(m3iu1ol nlfetltfaDtrxmpno4oetn o3iltlm rlnmpn() eenmf tatfp raivol()trtoim nodope lnet s srtaumooo0tet  o3iytls uaums;(4arxnir3oa1la ran s (  rtmxopoo1am elieiltfarrr(r nu1tlxomf3iydfs ea( ont0alxnxo3oa1lptr ies (  ruoir iodamenmfeils  2rmumoot1olxo ieiad sDua(vs;() exrxr to1optranvols) rto(rpno1ap elncs s)a2urxrpoo4tlen f3iltlm2umn s u4 ltoif oy1fmteaieol(0 etr(r3oy4ame mnvi sfarur(m ;o1tpe moctas sDua(vsn()tltrmo3oytfa  anvo ( t2xo(r iydllt lneias) 2trumpot0oee  oetasfs rm(mp;(0 rtomr3ootomteaiei t)teto(o iydol nmfcils a2trumpou4opx mf3iyd aDrluvo u0 lxoio ia1oatrauvi (0texr(mpio1aptnmivsas)aDurx  no4aeeo f3iydla2uau ont)arxrxf todfm  luvo s t2xo(r3nu4am nlfcsa()sDuaum ;t0alx mieilsfmDuau o;u4alxnxocoodfpte nei t0trtrxmpoydaltelfeias artaumpot1tptnmictlslm rlump;t)altoircoo1fmDr ivs;t)srxrio nu1om elncsltfarta(  ;t1tpe  oeiydfmDrluvont4 rxrmr ty1lm raueo ( t2xrio ou1apenmnvils)arum( poo0opt mf3tys m2rl( s;(4 rerxr3oa1opteluvs;s)srtmxopnodopenlics s aDrmur no0tpe ifeiyt sDrl(vpnu0aeenir3oodlm eluvsl()teuoxr3io4omeemietl(farta(mp;t4teenifctasla2uau o;(0artnxo3ootomD ai s ()trtrimpoy1am e nct sfsDrmxm ot4olxomfciat s emnmsn()arxrio iydlm  ln i s)srtoxrpnydom n icias)sDrax o;u0tex  fciytfs eluvo;(4 ltrir iadfatrai olt)trxoxo io1al   fetasfarrmx  no4apxo ociytls2ulnvp;t0aexrir iy1fmt  u o;t s2ur(m3nu4lleelfvil(fs2rrxmo;u4olt io3ildfaDelumo (4 lxnxf3iotlpte i i t0sexm(m3no1ll emnct t)artr(mont4apx ifeiadfm rlu p (4trtoif iadfmtran i t0 exoio3io1ameemncsl() rtaumpot4alxoifctlsfa uaumont4aleoxoctytomD au o s seurim3nu1alt lnetlt)arrrx poo0aexomietatfmDelnvs t)areoio oa1faD  n slt0 2xmxo3io4ll nlnesl(farra(m oo0aptoif3tydfmDranvsnt4 rxrxo3iydlaDrluvi;t0setr(mpou4aptn fcsa( a2umxm ;u4oexoifetytlaDua(vs ()tetrmf3ia1lp ranvils)s2trxrpiy1lmt lfcslt  2urxmoot4tlxnii3iat m2ran s;u0aexrir3oytlmt aivs;(0t2xoiopou4apenlfes sf Dumumo;t0oeto oetasfa elump u)tlerif3todomD anvols0 etmxopio1llen iei tfaDrmurpnu4aetnmfctlsls2uanmp;t4aeenmf iodlpt  ieols  euriopoy4lltemnes s s2rax  nu4apxn iciat s umumo ()tltnifciodopD lieo;t)sexr(mpoodap nmiei t srrauro;u0tlxn i3iytls ul( o;t) rxnirctotla rluei t) eumxmpiodll  lfciasfsrtm( p;o1optoii3iytfa2emn p u4 lxnio3oy1fpt aueo;t teum(r nu4op e fetas)a2urx poo0aeenmo3tad m2ua(vpn()texrifciadoaDeau olt)tetm(rpiy1amt lfctl()artmum ou0aee iociadfmDumn on() lenmfciydlate ues;t  euo(m iudal  lnvil()artrurooo0apxnmfeiytfm2ua( o;() renxociadopte i s;()sexrxm3iu1omte iesl()a2uaxro;o0opxnmiciydlmDelnvo;t4artoiocoa1oaDe i ols) rtmio nudam  lfcs t srrrxm nu0aexn ociatfaDulnvp;u) rxniociadla ranei t0 exrio3oo1om   nesa() 2tmuroot4tlx ifeild aDrm( p ()trenmo ty1fateai i t0seurxo oy1olen ncslt)aDtmxmpou4oexnmiciatlm em(mp;t4alenmociydfmDrlnvi t trxoxm ny4aptelfci tfs2trumpoo4aee  fciatlmDrmuvpn()alxnxfciodlm ean i ( setoxmpoy1apee netat arurxmp;t1texnmfctytlm uau o t0 ltnxf3oytomtran i s0 2xmio3io1op n ici () Dtrur no4texnmictldlaDemump;()tlenxo iadfatr ivsl(  exo(m ny4am nmnei ( arrmu  nt0tpx iiciysfs2rmu p u) rerxf iatlpD  i s s trurxr iy1amenmncsl() rrm( o;o0ale mfcils sDuaumon()aetoifcia1fmte uei;s) etoirpnydop  miet t srur(ro;o4tpx  ietls mDulnvs;t0 rtoir3oadfa  aies;(0s2xrxr3nudamt mieilsfaDtrx pou1alxnifeiyt a rm(vpn(0arxnmf3iadoa r ieo;t0setoim iodolt mnvsatf rtaur ou4apeomfeiatls2raump t4alxoir iytlmt  n s (  rxmxo3nydam   nctltfsDua(rpnu4teto oeiatfm ua( s;u4 exrifciydfmtr uei;(0 rxo(r3oy4apt  nes (fsDrauro;o1apxnifctydfa ul(monu4arxrmf oytfa rai ols0 2uo(opiudlp elfctlt  rtmumoot4aeenmiciytlmDemuvp;(0aexrmf3oo1op eluesl( t2xoim nydll  mfeil(fa2rax  no4ape  ictatfs2rl(vo;t)trenmf iytlm elnvs;t srtoio oy1am  mfct (fartrx ono4olxo oeiatfaDrluvp;() rxoxr ty1fmtr u s s) eurimpno1altelicslsfaDtaum ;u1ape  oetyd a rmn pn() rxnmo io1lpDrlies;() 2urxo nodolee iviat) rta(mpnu4aetoioeiatlm ulu p (0trtnio iadfa   u o () 2tmir nu1oltn fct (  Drm(  ou1oexomfetytfaDeaumsnt)teerxociy1oaDe u ol( trxoio iu1omtelicsas aDtrxmonu1ope  feiydfm ua(vs u)altrmfciadopt lnei t seumxo iodaptn nei s)arra(  ou4tpxomf3tlslsDel(vs;t)trtrxfcoy1oaDeai ils0 2urim ny4lpen ict s)s2tmxrpno4oee iictadlsDem(mo u4 eerir3ootlm  an ol( srtrxo iy1opt  fvsatfsrurum ;t1texn feildlmDua( ont0 rtrxo tytlp rlivol(0tetmiopiy1llee nvtls aDuaxrpnu4teen feiatfa eauvs u) lenmf ia1lptrln i (0 rto(r3oy4lp nlfciatfaDrrumpot0olt iicild s rlnvon(0 etnio3tytfpteai sl( texr(m iodllt  nvs () Dtax p;u4opx  fetysfm rlumsn(4teenxo3oy1fa rai i;s sexo(opnudamtemnvil() 2rru p;o4oex iocils m elu o;u0 ltnir io1omt  ieo ()srurxr3oy1apt  nvtls  rua( o;t1tlt  octltfs2emnvpn()alenirctotlptrauvil(0 ruoxo3iudal elfvtltfs2urump;o4alx  i3iydlaDumuvs;u0 etrif tytoaDeaiei t0srto(mpou4lm nlnvils s2urum nt0tlt moeiasfsDean o;t0tlxrmr3iodfp  li ilt0 rurir nudoptnmivsl(  2rru pot1aetn fcild s2uanvo;u)artnxf oydfatraieo t0texo(m iu4lm   ncsa(  2rr(r nt0tle iocilsfa2rmump;t0areniocoy1lat  neils)t2xrim3nu4lm n fvtl( a2rmxr oo1tetnmoeilsfa ranmon() rxoircto1fpD  n o (0 rxm(o3iy1op  mnvils aDrau pno1altoifeiyd a2ea( onu4tlxrmf ia1omD anes t0s2trim3ny1ame mncs ()aDumxmont4olx mfeiasfm rm( snu0trenir3iydlmDrlu ol(  rtm(mpnu4ol e iesat)sDraxmo;o4aet ii3iytlmDea( o;(0trenir oa1oa   n s;t t2tmxr3iy4opeelivt tfarur( pnt0oetoiicilslsDem( s u0 rtoif todlmt aiei ( sruoxo3iodaleemnctlt)s2rmumono4altoifeiysls eau on(4 rtrxo3tatom  auesl( s2xr(mpiydaltelfesltfarrruronu4texn ociasfaDrlnvon(4tlxrmf tydlpt lueslt)sexmxr3oy4al  micil(f Drm(rp;o4oltnifciad s2eluvs ()aetnif3ia1laDelueslt  eum(m nydope mnes (fa2rrum no4oeto o3iys a2rau p;t)artoir3oodfpDr ieolt0texoimpoy4aptelfvi (fsDrruroot1aptn ieiytfaDrmump t0tleomrciatlatrai o;s0 rxmirpou4alteliei t)srtr(r ;u1aexomoctltla emnmonu0altnif iydfaDrau ils0 rum(m iy4lp e fvt tfa2tm(rono0oet iictat a2em(vo u)tlxomr3totlaD  nvs;()teuoio no4lmt  nvsls)a2umxr nu0oex mi3iydfm um(mp t)trxrmf3iy1omtraueilt  2xmxrpnodal emfvtls)srrru  ;o1aeeomfctlslsDrlu p;t0aexrmfcio1opt  uvol(0 rtmim nu1op  lics ()arta( oou4opt  octydlm2ulump () exnmrcoatfp eai i ()trto(rpoy4alen ictlsfsrrmurooo0oex ifctls sDrmu p t)alxriociadlmD lu o t0 eurxm iy1lptnlieils) rta( o;u0aleomi3iadfs2eau o u) eerir3oo1omDean o s)srxm(rpiodole lnvi sf 2trx poo1aeenioeiatfs rlu o (4arxrmfcoa1faD auei;(0truo(mpiu1al nlfes (f 2tmumpnu4tee  iciadfs em( o;u0 reomo3ootoateluvs;s) exo(m io1open nvs (f Durumonu0optomfciyd m2rluvs;(0alenmr io1lm eaues t t2xm(m3iy4ll emictas)arta( pno1aptnmfciadfaDuan pn(0tetnio ta1lp rlivs s0srxoio3iy4ole mnei tfarumxmo;o1tpeomoetldfm2em(vsnu4areoirciodfmD aneil(0tetr(m ou4amt lfvsa( srur(  ;u1aeeoifetlt a2ul(mo t) ltrxo oatfpteauvsls0 2xrim iodllen nvtl()arrr(ront1ale mfctysfsDua( o u0 lenxf ootlmt lnvolt0t2urxopiodlmeeliet t  Duauroot1aeeoifeilslm elnmo;u4tetoxr3iodla e neil(0sexoir iudlp nlncias)sDrrxr no4optniicils sDea( p t4trtoxo3io1faD aieo t  2trxr oydlleemfcilsfsrtm(r no0oet  ocildfa2ul(vsnt4 lxrif3iadlaD anvsl(0 etmio nu1ap elivsa(fsrtr(  ou4tlto fctld aDumn s;t0trxoirctytomte neslt) 2xm(o no4ap   nvsat)s2tm( ooo0optomf3iadfaDum(ms (4tetoif3tadfmt an ils  2xrio3nudole  icia(  rrau  ot1alxomfciyslmDrlnvon(4aexrir3oy1op elivsl()setrxmpio1lleelnei sf 2rm( p;o0tet if3iasla rl( s;t)tlxrxf3iadopteai ols)s2tr(m nu1lpte nes ()aDrrx o;t1aee mfeiatlaDul(vont0 ltoxocio1late ues ( trxr(o3iu4lpeemfcils)sDrm(mo;o1aexnmfciyd aDumn p;(0tetrxo3iydfa rluvslt s2umxo3iu1olee fetlt  2ua(  ot0tlto ociadfsDeanms u) eeoif totlm eli ols) exmxrpoy4ol nmici sf Dur(rooo0olxniicias s2ean o;(4alxomo3iotfmteaiei;(  etrxo iy4lmtelfvta()s2ua(m ou0alenifeiadlsDeanvo;t)aleomr3totfmt aivs s)trxoiopoo1ll   ics tfarurxrpno4altnmfciyt s rm(vont4trenxfcoytfp rlu sl()trtoxo oo4ap elnvt ( aDraxmpou4olxnmociydfa em(mp;u)alxrmr3iodlpDrai o;t srxo(m nu4lp e ictlsf 2taxmooo1ope mfetas a2rlumo;(0tltrif3tadopD ln o;t)t2um(rpoy4altemncsas)s2umum ot4aex io3iys a raump (0altrio iotlptrli o;s)srtmxrpoodaltn ieslt aruaxmoou4oexo o3iltfs um(von(0 etrifcoytfmDr neol(  eumio iy1ape mivils  2ur(  nu1apxnifetatlm2ea(mpnt0aleomo3ty1lp rln s ( s2uoxo3iudlp nmiciatfsDum(m no4oltomo3ils mDuaums;u4arxoxr3iytlmD  i s;(0 2tmxrpiudamt  iesa(f 2tm(m nt4aptnmictlt s2rmumsnt0aexoxrcoy1fa rluei;t)tetrio iy4lptnmiesatfs2rmxm ou0apt  fctyt s ea(ms (0tltrio3tadlp r ieolt)s2xr(o oy1ole  ici (  2uru oot1tetn fciltla elumpnu)alenmo3oo1fpD lnvol()sexmio iy1ole mfcil(  rtaxm ot4apxn f3iytlaDulump;u)aeenif3ia1latrlivi s seto(o nodapeelfci t arurxrpou1aexnmfeiysfm2rl(mp;t) lxrmr3to1lptrauvsl( trxoxmpiudamtelnes t)arur( oou0tpeoiieildlmDum( s t0 lxoxo iodop e u olt setr(rpoo1aptnlfvsat srrrump;o4olxnio3tyt aDua(mo t) lxomr todfaDrauvsl( truo(r oodlme lictltf 2uaxrpnt0alenmi3tatlmDeanmo;u0 lxoxf oydoa r ivs;() ruoir oy4altn iei ()aDrmxr nt0altn ieils s2uanmp;u0aeeomrciydfaD lu s;s0truo(opny4alt lnvils s2rm(m ;o1alxn o3ils mDeanmo u0 ltrxrcio1op raueils tetoxopno4llt liei ()arrrxm ;o0oltnmietldfa2emu o () lxomf3oatla rai slt)t2uoxrpio4lltnlnvsl( sDtaumoot1tetomociat sDumnvo;u0teeomf iytfpteanvi s trxmxr nu1apt mfvtlt)sDururono0apx iocild aDul(vs (4alxrmo oadlm rlnes s  2to(o3iy1apt  fctatf rtmxro;u4tltn fctys s eauvs;(0treoxf tadfmtrai o;s)t2tm(o oo1ap nlnvsls)srrr(m oo1oeto ociad mDul(msnu4tlenxfcoytlatrlneolt) 2uoim iodlmenmict t)arur(mo;o4aptn octld a2uluvp;t)aexnifctatfate u i s0 rtoxm iy1llee nciat  2rmxmpoo1tex ioetlsfaDul( o t) exoio tatlmte neil(0 exmxm3oo4ol   nesl(fa2rmumont1tle iieiat mDemnmsnt0 eermr oa1fmteai s;t0teur(r3oo4optnlncias)s2ra(mpot4tpt  iciyd aDranvont0 etrmr3tatfm  lneol(0 2xoim oo4lpenmiesat sDrrxmpno1tpeo ieiasfa2rauvs;u)alxnir io1fm  an i;t  etmxopno4lpe lfcsls  rtr(moot1apeoioeildla em( o t0 lxnxf iadlaD  u ilt0 2uoxo3ou1al n nviatfsDtmu ont0tlx mfeiat mDrmuvp;(0tltrif3iadfa rlu s;t0setrio iodam n net tfs2uauront4ape mfeiydfs2rluvsnu4aetoiocoadlm eauvo ()trxrir oudalt  fctl()aDrau p;o4tle ioctyt m uan p;t0aeerircta1lmD luvo;s0srxoxm3ny1lmenmfvtls)sDtax onu1alen fciad m2rluvo t0tetnif tatlpt lnei t srtrxo3nydll elicsa() 2raum ou0teto ieiad sDelums;u0trtrxrcoydlmtrli ils t2xo(r3iu4aptnmnetas) 2umuront4tpeomiciatlm2ul(vo;t)tlxrmr3ootfaDe uvsl( t2xrimpnu1om elnciat)sDuaxmont4oeenmf3ilsfa2uanmsnu4artnxf3tatfaDeanvs;t) etoio no1lp emnetat)a2rrxm nu4oeenifetldfm2uaumo u)arenxo tydopte i s ( srtoxr3oodapte ivtl()srta(mp;t4tltoio3tas mDemnms u) etoxr3to1oa  ai s;t)tetr(mpiydllte icsat) rrmxrpnt4tpen f3ils aDuanvsnu) lxoir oydla eanesls  rxr(o3oo1lp e fet sf Drau oot4tpxnii3iydfa ulumo u4alenxo3iydla e uvi;(0trxmxo3ou1aptemnctasfs2urxm ot1teeomicilsfs2el( o u4tlermf3tytoateln i;t)srurxopio1lm elivi t aDtmxmpoo0tptnmocils a uauvsnt) ltnmociytlm eau sl()s2xrio3nu1alenlfciat)sDrrur ;t4ale  o3iysfm umu snu4tetnmr tatfp  lu s;s)texoimpoodlmeemfvi s srtrxm ou0oltn feiadfm2em( pnt)treomo oadfat  uvi;(0 rtrim3iy1ape lict (fsDrau p;o4aexn i3ilt s2uaums t4alxnxr3oadla   i sl(0srumim3ou1omtn fcsl(f rtru  ;u1aex iiciasla2rm(msnu)artnxrcoydoatr i i t0 rur(r3oydlltemicias sDua( pnu1tltomfcilsfaDem(ms t0tlxoio3tadoat  ivo ()t2umim3oo4lpt lietl( sDrax  ;t0oltnifeiaslsDum(von()aexoxrcoadlmt  ivsl()s2toir ny4ol emnctls s2tm(rpno0tltomfcild a em(vp;u) renxr iytomt  ieo s t2umim3nodomeelfeta() Draxmo;o4tpx  fetasfsDemuvon(4aleoif oatla e uesl( srumiopnudom nmncil(  rra(mpou4optn i3tyd m eln sn(0aeermf iatom r uesl()trumir oudoptelfvt ()aDrax pnu0olt mo3tytlsDem( o;u4 reoxo oatom eaneols)trum(r3no1opt mfciasf rrmxmpoo1oltnifetld s2emu o () rtrmr3totlpt  uvs;() rtmxo oy1oltemfvi t)a2uau ont4apenii3iasfmDel(ms;u4 eerifcta1fmDrlneil(0 2tmxrpiydlp nlnetl()a2tr(mpno4tpen o3iatlmDeau onu4treoxo3oa1latr neo s  rtmir3oo4om n fci t)arrrxmp;u4optnmfetlsfm2uanms u)altoir iatlmt lues;t) 2toxm iudom nlfes tfs2ta(mo;u4tle ioctydfaDumn snt) exrifcoodfp   ueol(  rxrimpio4amenlnvsl( a2urum nu0oee  i3ilsls umnmonu4texoxr ty1lmDe i i;s)t2xm(m iy1ll nmnetl(fa2ra(m nu0tlto iciaslm2elnmp t0 rxnxfcoytom  auvi s)s2xr(m3iudal  licsl(  2urur nu1tet mietlsfsDrmumsn(0trtoio oydfaD aues;s)t2umir3nydolenmfesl()a2rr(mo;t4opxnii3tadfmDra( o () lerxf3totlp e u o;s)trto(o3no4ole  fcil(  2raxr ot1opeomieilsfm rmnms ()aexrmr3oytoaD liei;s0 exmxr3oo4lltnlivta()sDra(m ;t0oexomociltfa rl(von(4altnmrcoo1late nvols) 2xr(m nu4amen nes sfsrraxrp;o0aetn f3ildlaDemuvp;u0alermr3oatop eaneils0t2xoxm3no4lmte fctas sDrr(rpnu1olt mo3iasla uaumo;t) exnmo tydoatranvo;( srxm(m3nudaptnlnvilsfs2tmxm nu1olxnioctydls2rl(mp;t)aexrmo tydomD  n o s)trtr(r3iu4omtelfctlt)a2ua( pnu4opt iiciatlm2uanvs;(4artomr ia1fptranvsl()trtoio oo1lle mivi t) rrrur ;t0oetomo3iysfs ranvp;(4 rerxf iydfm elnes s) etm(r oy4ap  mnct (farurxmono1oeeoifeiatfm2emuvo t0alxrxocoo1lmte nesl( texrxm3io1optnmfcil(fa2uax  ;o1oetnmi3iydfsDea( p;(4 eermf3iadfateauvi s t2uoir3oy1op n fci t  2raumont0oex  ictyslmDumumsnu4 lerxoctytomt aivil(0trxoxo nodamtemfetasf Drrx  nu4tetn fcilt a ul( s (0trxomf3ia1omDrli s;s0trto(o iudalt mnci s) 2tmx o;t0aptn oeiasla2rmumpnt0altnircoydlpDrlivo;( srtmxr3iudapenlfvsls srtmx poo0tlx moeiysfm ulu p u)arxrmr3totoaDrauvi;() rxmio3iu1lpt mfvsa(fs2rm(mo;u4ope mi3tat s uauvsnt4arxoxf to1lm e n i;t)trxm(o3iydalen neia()aDra( ooo1tlto f3iydla2rmuvo (4 eenmf oadlpDrlnvi;t seumxmpnudlme  fvsatfsDtrurpno0tleomieilsfsDulums;t4 lxnio3iadlpt anes t) 2toimpnudom  lnctltfsDraxmoou1aex moctldfm2emu o t4alerxf3io1lp rlu o;()srurir oodomtelncta(  2raxmpno4opt moetys s umumon(0 renxrcoydla r uvi;()srtmxrpno1ap nlnct (f ruaumpot0alto fetysfsDran p;u) renxr oatlateanvsl(  eum(o no1ome mivt (fs2tax ooo4olenio3iltlmDrauvpnu4tlxnmr iytfaD aiei (0t2xmirpou4lm nmnvs sfs2tr(mpot1optnmicild m ul(vs u0 lxnmr oo1oa  aueo;t)t2trim io1optemfei t  2ururo;t0tpx  f3iydla umnms (0 exoxrcto1om e ueo t  rxrxo nydapenmfctas)sDra( onu4alto o3iltlm rm( on(0altoxo ootfpDr u sls texrxo iodomtnlfvtlt a2rru o;t1tpxn feiydlmDumums t0trerxfctydla eliei ()s2umxr3no1om elictls a2taumont0aleomi3tltfs ra( s ()tetnio tatfm rluvs t)setrir3iydolenmnesat)srrrxmono0ape mictatls2eauvp ()trtomrcoydlpDelu o ()texr(r iodom  mici s srrm( pou0tpenmfctltfm2rlnvo;t0 etnxr3oatlp elnvi ( srtoim3nudapt lies t) ruaump;u0tleo f3iasfs rmnmsn(4alenxfctydfptr nes;t)srum(rpnudomenlneils aDtmumooo0oexo octldfm umumon() ltoxr3iodoate nvslt trtrio nodape  ivt t  2tmurooo1alenmieiasls2ul( snu)areomr3oa1fateau s;(  eur(r iu1ol e ncslt)a2tmurp;t1aptomf3iltfs2rln on(4aeenmo oodopt livols srxo(r3iudomen ivt () 2tmxmoou0tex  oetltlm um(msn(4aexoxo3iodfa r n ilt0truoim3iy4ll emfctlt)aDraxrpou4tpxniieild a ul(mp;u0 ltrir3ty1fa eauvs s  2tmxr nydom n fet t)s2rmx pnt1tpenmictldfm2eanvont)tlxnmf3oodfmt  i s;( srum(opiydlmtemies ( sDrr( o;t1tleomo3iyd sDelums u4alerxo3oy1opD  i ols) rto(m3iu4ol e icils s2tmxmono4oetnmfciytlm uau s;u4alxomoctydlp  lneo s setrir oo4om n ics (fsDtrxrp;o0oex moctyt sDua(mpnt) etnxrcty1lmDr ieilt0tetoiopiodlpenlfvsas  2rm(mpnu0alxoioeiytfs em(vsnt4tetnxf oadomD au i t s2xrir nudop emnvilt)sDrrxrp;t0tpeomfciadlm em(vo;u4 reomr ootlate u ols)s2xoxm iudlmtnlnvs t arrrurpno4tpen oetys sDemn p;u)artnmr3tytfmDelnei;()srum(r io1lm e ivslt) 2rr(mpnt0tpeomociatls2ra( s (4 ltoxo tatoa rln o;t) 2to(m3no1omt  feiat)a2ua(  nu0aleoii3tadfa eau p;t4 ltrxfcta1fa  livs;t) rxmxo3io4olt  fvsasfa2tax o;t4teenmiciatfsDulump;t4teermf todfptelu i;s sexo(m3nodalen fctasfarumumpou1apeoio3tydls uluvp;(4 rtomr3oa1lptrlu i;( t2um(m3oy4lleemfvsa( arrm( p;o4olx ioetltfs el(vp;t) rtnio oadlmDr uvo s t2uoxm3ny1aleeliet tfsDtr(mpnt1aexn octyd a2rl( onu) exrxf3oa1oa r iei;()trurio3nydaltn ivsas)s2ra(rp;t4alxo oeildfm um(mp t4tlxoxocoydfmt lies;t  etoirpio4apenmfet t  rrrurpou4apto ieildfmDeaump;(4 lxoxf oydopDraues;()s2xrxm oo4ap e ici tf 2um(  nt1opx  o3iydfsDem( s;(0arxnxfctotfpteai ols  ruoxo3ou1alt  nesls) 2taxr no1apxn fctydfsDelump t)arerirctadlmDe nvi;t0srum(r ny4llenmfeil(f 2ra(r oo0tltn o3iytla eaumpn(0 leoxf3oy1la rlueo;(  exrirpoodomeelieils  2rm(  ;u1tee mietadfaDeluvsnu4trenxoctodoaDran s;t teuo(opio4op  mfvsa()arraum ot0apxnmoctld a2em(mo u0trxrmociatlp   nvi;t setrio3ou4altemneta(f rtrxrp;u0aetoii3tyslaDra( o u0alxomociatlm elueo ()texm(r iu1lm n ictl(fsDrax p;u0oeenmietysfmDel( p ()artrxf oy1laD aivolt  2xmxo iu4lmtnmnes sfaDrrxrp;t4tlxn oeiltfmDemu o;u)texnxf3tytomD an slt)trxoxm nodopt  ieiltfsrumx  nt1altoif3iyt aDua( onu0aetomocoo1omD  neo;t0srto(mpny4apt mnvt tf Dra(mono1openif3iasla2ul(mp;u)alxoxf3iydopDrlueo t  rxo(opiudop nmnci tfa2urxr ;u0teenmo3ilsla2ulnvont0 ltoxf3tytop e ivi;(0srurxopiy4amtelfci s  rtmuronu0tpeoif3iadlmDelnvs;u4 exomfcta1op r nei ( tetoxo oydameemfvtl( srua( p;o4apeomoctyd sDumnmpn()treoio3to1lmtraivs s0srxrxm3oy1am e fci t)sDraumpoo4tpenifctyd m2uln pnt0 ltrir3iy1faDraieo;( teuoxm3oodlpte ncsltf Dum(m ;t1alt mfctadfs2ul( on(4 lxnmr totoate n o t t2xmim3nu1ll n nct tfarur( pnu0aleo ietytfm umnmonu)tlerio3iydfpD  u o;s)srumimpio1alt  nvtlt) rta(r ot0opt mo3iatfm2rmuvpn(0trtnmo3oadoaD anes;s) 2xoxr nodaltn nctlt)a2rm(r ;u0oexnii3iat m ua( sn(4teermrciydfpD  nvols0 rtrxo oudapee ics (  rurxmo;u0optnii3tyd s el( p (0aexnmrcoydopteanes;t)truoir3nodlpte fesat aDrmxmpnt0alt  fcilt a2elu p t)texoio oodfm   nes;t s2um(mpiudlme mfvt t)sDtm(m no4apen oeilsfm uaump t)areoir oytfpt  nvolt0srumim3iy4amenmnvs ()a2ur(ronu0oexoif3tls sDeaump u)aeenif todoa rliei s0srumio3oy1apt  net ()aDra( o;u1optomfeiasfa2um( pn(0aexrif3ta1fa raieo;(0trtoir ou4ap nmfetasfaDrr( pnu1tleniieiaslsDran o;(4trtoif3tatfp eai i;()teumiopno1lmeelnet tfaDtaumoou0oexo feilsfmDranmp;t4tltnir ta1fp eanvo ()trxrxr io1al eliciat  Dtmuroot0tpe  ociltlm2eanvp;u4alxnmr ta1lmDrauesls)tetmim nodalt  nvta()s2ur( pou4alxoio3ils s2el(vp;()aeeoxo io1opt  u o;t0 eumio nodlpt  fcia
\ No newline at end of file
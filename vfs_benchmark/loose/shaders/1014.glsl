@@ -0,0 +1 @@
+neils0 2um(m oy4op n ivs t sDtmurpno1texomo3ildfm um(mpn(0 reoxo iodfpD  i s s tetmxmpnydalt lnvt t srra( o;t0aexnmictys a2rm(vp t) leoxo3oo1fa  aivols0 exrio oydope lfes ( s2uau pnu4opt  o3iyd m uauvs;()tlenxrciadfmtrau o s texrir3iudoltn fvilt) Dta(rono1optoif3tat s ulumsnt)alenmr oo1opDe neo;() 2umxrpnu1lptn fvia( arrr(ro;u4optnmoetysfs2rmnmsnu4 eeoxo todfmteaivslt0 rtmxo iu4omee nct tf 2truro;u0tex  o3tytla ulnvs;(4aeenxf oodom e i o s0 etr(r io4ol  mnes tf 2ta( pnt4aee  ociatfm ua( o t0tetrmr3iotlpDelivo ( trxoxrpio1apeelfcsat  Dur(rooo1olxnio3iltls eanmo;u) renmfciatlptr ues;(  2urimpnodlpee ivt ( sDrm(rpnt0opxoiiciat m2emn o () etrir ty1fm eln s;(0trur(opiy1om nlnetlt)s2ur(mpot1opt iociltfm rmuvo u) exomr iotlmDrluei t0 2xmxo3nodomenlictat) Dtrur ;t1olxn iciydls2rmuvpnu4arerif3iodlm eaivi;(0 2trim3io4omeemnci ( aDrm( pnu4oeto i3iatfa emnvp;u0 rtoir todlatrli il(0truoxopnudlltelietas arrr(mo;o1aex mfctlt m2el(vp ()areoxf ty1lmDrlueo;s0sexoxr ny1lmtnmieta( s2rr(mpou1tltniociytfm em( p;t4aetoxrciatfpD au olt0sexoxrpoy1oltnlncias sruru ono4oltomfciydlm2rm(ms;(4texoif3iydfmDrluei ( sexm(r io4ole lfeia(  rumx onu1tptomo3tadla rl(mp u0altrxr tatlpDeau i s)truoirpiu1altn fctl( s2umxmp;u0aleo fcilsls2rmuvo;t0aetnif3todlmtrln s ( srxmxrpou1llen nvtat)aDrrxrpot0tle  feild mDumn p u0 reoio io1oat an ils0teurimpno4lltemivils  Drmx  ;t4olxn ieiasls2rlu on() lenir3tydlpD anesls)sruoxo3nu4lpt mnetltf Duaxm no1aptnmf3iadfmDran p (0 ltnxo tytfa e ieols0 eurxo3no4ll  mfcsa( aDua(mpno0aexomfeildfs2umn s (0 rxrmr oatlatrlu s;( trxoxm3iu4ap   feil(fsrtrum ;t0oltnifcias m2uanvp;t) rtoircootfp raueolt) rtmxrpno1lp elfvi sfsruaxmp;u0tptomfeiatlm2eanmo;u4arenmr oydomt lu o;t0srxr(o io4oltnmivia() rrau  nt1olt moeildfsDrau pnu4teeoxr io1opDelues;()trxrio iu1ol e fvia()srrau ooo0tleo ieiys aDrlu o;t) lerxf3iodla r neo;s)teumimpiu4olt mfvslt srrrum ot4texoifciydls rmnvs;u0tlenircty1la  lues;()s2xoiopoydllee fetlt)srtrxmpou0tltnii3iasla2el(mp;(0tleoxr oatfp r n i;(0sexoxr3io4opt lnvias)aDraur ;u0tet  o3ils m2uluvsnt4alxrmo3io1lpD ln i s)s2um(o nu4omenmfviat s2urxm oo0tpeo f3ils m rau s;t4 rtnmf oo1oa r ueolt)s2urxr no4alt mnvi s sDraurpnt4olxo fciytlaDrlnvp;(4arermr3oo1fpt  n ol()s2xoxm ny4omee ncia(fa2trum ou0alxnioctad a2uanvs (4 ltoxf3io1oatrliesl(0sexoxr3oudaptn fci ( sDra(m nu0opeoifcild a2ul( onu4texoio3ia1fa rluvslt0sexmio3iu1optnlnvslsfs2tr( p;u0tptn iciytfa ranms u)trenxocoadfptelnei;s0 ruoim3iodopeemictatfarrmx  ;o0aexoifetad m2umnmsn(0trtrxr3oodfmtraivi (0srxo(rpny1al emivt t srur(rpnu4alxomociasfs2rmn p;u4texrir oa1fmte u slt0s2xmir3oy4olee fvsat arumxmoot1tpxomietad m2emump t) rtomrcoy1fat anvo;s) 2xmio io1lm  lfvsltfsrrru  ot0oetnioetytlsDrmump;t4aexoxf3oadla r uvils srxr(r ny4ol   fvils) Dtmx ont0apeomoeiydfs umuvo () exrxrctadopDr nei;t) rurir ny1ap nlicilsfaDua(m ;t4ole ifciyslsDea(vs;u4alxnmrcoatlmD lueols)t2tr(m ny4lpe mfct t) rurumooo4tlt mf3iatlmDuanvp u4 reoif3iytom elneo;t  rtrxo oodoptemneilt  2rm(rp;o4olxn i3ild a2ranmsn()tlxoxf totlp r neslt)truoimpnydope  nctlt) Dta(rpoo0opt  fctydfa em(vo;(4 lxniocty1oa rau olt) etm(r3iy4lm n iei sfa2ur(r nu1tptnmo3tadfaDrl(vs u)alermrcoadlm  lneils)trxriopnydam n nes ( a2tr(mp;u0apto o3tatfs2umnvont0 ltrmrcoatlaDelnvo s0 rxmxm3nu1opee nct t)aDtax  nt4olx if3iyd sDemnvp;t0trenio iadfm rluvslt  rtr(mpiy4ol elnvi ( s2tau  nu1apen oeiys a eanvsnu)aeeomo iadlptraivs;s0 etoir3oudlm n nes s  Dtrumo;u0opeomfciatla rau o;(4 exoxf3tydomDelues s trum(o3iodlmenmnvtat) 2tmuront1tlx ii3ilsfsDul( p;(0tlxoircto1lpteanvo;s) 2urxr oo1optnlnci t)sDrau  ot1oeeo oeiaslaDean o (0trtoxf oatfaDelues;s) 2ur(o io4lpen ivtatfsDtmxmpnu4olxn oetydfs rauvo (0 lenir3oa1lp r nvs;() 2tmiopiodlmte fvtlt  rum(r ;o4tleoii3iatlmDua( s;t4tetrmf3ootomDelu s;( trxrimpou1ole mfeias sDta(  ;o4texn oeiydfm ulumsnt4 exrxfciadfp rlieil(0 2tmio3io1ap  lieils  rrau onu0tex ioctldlaDuluvsnt) reoxfcto1opDelneils0s2xm(r iu4alt  neta(fs2rr(  oo0tpt ioctlsfaDemn snu4alxrircoo1la eliei;t  etmxr3nu1lm nmnvi s)a2um(rpot4tpe ifciltlm um(mo;() rxomo3iatop rai slt sexr(m3iy1optnmivsas) 2tmx oot1olx  f3tysls2rau s t)arerxocoytfmtr uei s0srxrir oo4am nlfes s  Dtaxmpoo0teeomi3iat aDrlnvsn(0 ltoxf3iodfatrlu ilt  rur(r3nudal  lictls) rrmxro;t4tex ifetadfa ul(vs;() ltnmocoa1fpDranes s0trxrir3io4oleemfet s)aDuaxrpot0opxomoctltlsDrmn on(4tltomr3ty1fa e uvolt) rxrxr iy4ome lfetl( s2umxmp;o4opxo ieiys s2rlumon(4teerxfcoatlmtrln s s)teuoxopnu4amtelnvtatfsDum( oou1teeoioeiat sDul(vp u4trxnifciodlm ran i;()t2urxo no4am elivi ( srurxrpnu4opx mf3tyt m ra( p;(4aexoir tadfpteln s ()teum(rpnodllen ietatfsrua(r nt1alxoiietasfaDelums u0 leniocty1lmtean o;t sexoxm nu1ap nmfvsasfsrtaum ;t4aetn o3iydls ranvo;u4tlxomr iodla   uesl( srtmxr nydapte ivil() rtmumpnt4optnmicilt m ran onu0tlxomo iydlmDeaivo t)texo(r oo4amenlfvt s)aDuaxrooo0opxo oetydlsDem(mp u)aeenircoadla e uvi t)setm(r3oodlp nmfcsa(  Dtr(mooo1aet mo3iysla rauvsnt0aetrxfcoo1lm rai o;(0 2umio3oudal  lfetasf rurxmono4tlxnmfeilsls elumsnt0trenxo3tydfat  i ols s2tmxrpoy1omt lneiltf rrrxmonu0ape mi3iytlaDem( sn()artrxr oadomtelnvo;s0trtmimpoy4omen ivsl(faDumxr nu4oex io3iadlm2emump;u4alerifcty1lpteluvo t0trxoio oy4op nlnet ()sDumx  ;u1opxoifciasls2umnvo u)tetnmfciodfmtr uvo;()seurxrpoydlptelivtasfsrumxmo;u0tlxn feiatls2elumo t0 leoxo iytlatraues t0t2xrir3ou1lmtelfeil() Dumx  ot1apeomocildfaDulu p u0texomrctodoa   u ilt) etmxo oudlpe mncslt aDumu  ;o0tleomiciat aDrlu p;(4 eenio3iytfmteanvi;s) 2uoim3oodaptnlicsls)aDuaxroot1opxoio3iys a2eln s;t4artoiociodop ranvsl() rtmio io1lp nmfei sfa2raxr oo1tet  ociaslmDul(mo;t0aetrmf ta1oa rli s (0texo(o3iu4ale lnetatf Drrx pnt4tpt iieiadlm eanvsnu) rxnxrciy1faDelnei t)srxr(r nodapt lncsa( srtr(mo;o1aexo ietys a ulnvsn(0 exomf3tytlm r u o;s0tetm(m3iu1llenlfvtat aDumxr ;u1optn iciasls ulnmsnt)teerif oa1oa rai o t0 2xrim oo4ol elieias) Dta(root4oee  fctytlm2um(vo t0 renxf3oy1fpt aivsl()trtr(mpnudope mnetl()srrmx pnt0olenii3tydfs rl(vo;()tetrif3tadfatr ivsl()trxoim3oo1lpen ivi tfarua(ront4optoiiciad aDuauvs;t0 ltomo3oa1fp eaivslt0 rtrxm nudap   nctlt)a2tr( pnt1aeeomo3tltfm2eaump;(4aexrio3tydlaDeaues;s0srtr(opoodlpeelicil()arumx p;o4olen i3tysfmDeanvpnu0alxrmoctydoptrlnvi;s0t2xmio3oodop e icsat)aDra(rpot4tlx moeiyslaDemumo;(4alxomfciatfa eanes;(0 exr(opiy1oltnlivi sf 2rmu  no1optnmiciltfm ea(msn()texnmrcoa1fa  li ils) euo(o no4lp nlies s  Dtmxmooo0alenmietytla emnms;u0 etoxf ia1fatraueils t2umxrpno4opeemnci sfarrruro;o0opto iciatlmDean s;() renmociadomt anes;s)trxr(o nu1ol  mfcils)sDumurpot0oex moeils s ra(vs;u0tltriocoydfa e ueol()s2umxr oydalt lneia(f Dtrx poo4oet  feiyd m rmuvs t4altnircto1lp ran s s sexo(o3oy4lltemfct t  2tm(ro;t4apx  o3ildlmDumums u4aleomo tydfmDeli slt  etrxr iu4amenmfvi (fs2tax p;u4ope iieiyd a2ra(mpnu0arxnif3iadom e i i s  2umxm3oodll n nvs sf Drr(rooo1oexnio3iys aDul(ms u4 eerif3io1omt  nvo;s0trtoim iy4al emfvsls) Dua(ro;u0alx mociaslmDrmn s;u0texrif oo1lpD an s t0sexr(m iodam  lncils sruaxmpno1olx if3iys a2rmu o;t) ltrio iadoa ranes ()t2trxo3iodam nliciatf 2ra(rono1tlxn iciatfsDrmnvo;u)tetrmfcootfpDrlu sl(0trxm(o io1lm e nct ()a2ra(rpnu4optnmf3iaslm2emn sn()aexrmr oatoa rlnvi s)trtoio oy1omeelict sfartmxmp;t4apx moeildlaDel( o;t) rtoio3oytlm rauvs s)t2urim3nydam nmfeilt)sDua(r ;o4tpeomo3iytfmDrluvpnu4 etomr oodfm   u sl(0 rxr(r3ou4oltn ivi t  2tr( o;u1optn octlsfmDuan snu0 lerif iatlm  luei s)texm(r iodomt  fcs s)artrx pou4apxo ociysls rauvs;(4 rxrmo iydopteau i s seurim3iy1lptnlivsatfa2umu p;t4aet ii3ilsfm ean o (4 leoiociatfp e ivols  ruoim3io4aleemiciat) Dtm(ro;o1texn oetysls2uluvon()arxrmf oydfmte nvi s)s2toir ou4amt lnesl(fsDtr(m ;t4tltnii3iat a2rmuvp;(0teermocoadoptrliei ( sexrimpno1optnmnctl()aDrmxm ;u0opeomictad mDrm(mo;(0alxrmf3oa1fmt  nvol(  2tmxr3oydlpt miet t sruax oot4tlto i3ildlmDulumo;u0tlerxf iydfp  lnvil( seuoxmpoydale lnei ( aDrmxmp;u1tlt  feiyt m rm(vont0treomo3io1fpDeluvolt0 2xr(r oydape mfvtls)aDrmumoot0olto ieias aDumnvo t)alxomf3iatoa rlu s;t0s2xrxopio4alenmnesat) rtax pno0apenio3iysla2umumsnu0 exrif oa1oateau s (0t2uo(m oo4alenmfcsls)sruaxm ;t0aet iocilsfa ean on(0texrmo tytfate ues;t0srxmxopnodoltnmietat) rum(mp;o4tpe mictyslmDumu s;u) eermr3iadlpDraueslt0 rxoxm iu1olt lfvi tfsDum(ront1tetomf3ilt a ea(vont0aetrio3tydlp e uvs;t) exoxopoydlmt mnesa( sDtrxrooo0tltn fciat m2eau o ()trtoirciydop eaueil( s2uoir3nydom nlncsl(  Dtrxm ;t1opxoiicildfa2um( p (4arerif iytopD an o ( teuo(mpiudal elieilt)sDtmxmono4teen feiad m uau o;t4teenif iy1oa r n il()seum(r oydamt mnes (fs2tr(mono1olxomi3iys m2ul(vsnt0texoxf oadla e uesl( t2tmir nydam  lfcs s)sDtr(mo;u1tle mfciltlsDrau o u4arenmo3oo1op  aivol() exr(r3io1ll e ncia() 2uax p;t4oltniictadfmDul( pnt0 rxrio todla eai o;()s2toxm oy4am  mics s) Dum(rpnt0oltnmoctltlm2rm(mp;u0trxrmfcootfptrau o t0 euoxopiodamen nvias) 2tmurono4aet  oeiytlm2eluvs t4 lenmo3ty1fa eaies (0 2urxo nu1ame mfciat aruax ooo0teeo iciydfs elnmsn()teeoifcty1lmt li sl(0truoim iu4ome  nciasfa2tmum ;u4aexnii3tlsla eln p (0trenxr3iytoa e ueo t s2uoxr oy1lmtnmict s  Durx pot1aptnmoeiadfm ra( snt0 leomf oy1oaD liesl()t2tmir iy4om n fcils arrmxm no4tpt ioetad a em( p;t0aeeomocto1opteaues;s s2urim3iy1lm nlfcta()arumur ou1opxnmiciadfm2ea( ont0tlxnxr3todoaD li s;(0 etrxr3io1omtnliesa()a2tmum oo4opxomieilsls ra(mp u)artnmrcootfmtean ilt trumxrpoy4lltnmncsa( srrrxmp;u1openif3tydfs rmn o t0 rxoirciotfptelu i s0 rtmxm ou4ap elietls a2uaur ot0altniieiadlaDel(vs (4trxrir ia1fpDeaues t) rxmio ou4llt  fvia()s2ra( ono1open o3ilsls ea(vo;u4aexrxr iadoaDr nesls)tetrio3ny4am e ivs tfsDurur ou0tpxo i3tlslmDuauvs t)tltrmr3ty1fmteluvols0setrxmpnu1oltnlnct t a2rr( p;o1aeeomiciat m ea( s;()arenmr ta1omD  u i;(0srtr(opoydop n ici s srurumo;o4texo ieiltlm rlu o (4 rxrmf oadom e ieslt t2urxo iudal   fetl(fartr(rp;u1apxnif3iatfs2ean o (4trxoio iytfp rluvslt0 exrio iu1olenlics (fsrumxrpnt0tlto oeiysfs2ranvpn() exnmoctatlaDelnvo t  ruoir3no1lm nmietl(f Duau  no1alx if3iad s ulnvp;t0trtnirciodlmtrau s s)trxmxr3oo4altn net t)srtau p;o0tptomfcilsla ul( snt)texrxr3oydop raueo;( tetrxrpno1lltnmivtas  2ur( pou0tpxnmo3tys a2uluvs u0arxoio3oo1omDeaieo;()srtoimpoy1lp nmfeil( aDtaxmpnt4aex mociyt m2em(vp ()aetnir tadopteln s s0 rxm(mpoy1altnlicsa( sDumxrp;o4oltomoctaslm emn s;(4trtrxo oa1lp   nvo ()teumxr nu1llen fvs ()a2tr(rp;u1olen iciyt aDua( onu0 lxnir oo1fpD anes ()trxm(o iu4optnlnetas)s2ur(  oo4olt moctad aDuanvpnt0trtoirciadfmDe neolt t2xo(o iu1om nlfesl()aDuax  no0tpto ociytla2ulu o t4aexrxf todoa rln s ()s2uoim3iodoptemnvsls)srrrxrpno4tltn o3ilsfmDra(mo;t0 eerxfciadlpD aieilt) rxrxm3iudop nlivsl(  rua( pot0olt ioctydlaDuanvs;t0aexnifcto1omD lneo t0 euoir3ou4llee fcsa( aruaxrpou4aexn feils m eluvp t0 lxnif3tytlaD  ivi s)s2xo(mpnu1am emfvt () rrmx pnt4oex  ieildls rmn o;(0 lxrio iodlaD  u o ( s2umxrpnu1lpeelfeiasfaDra(m no1alxn oetyt m2rl(monu)aleomo3tytomteaneil()trurxo ny4am nlfei ( a2rr(rpou0tlx moctas a um(vo;() rxoxo oadlmt liei ( t2xoxo3io4olenlfei t)s2ra(mooo1aptnif3tlsfmDrm( s (0trtoio3iatla   ues ( trxoxr ny1alte fviltfsrtm(mo;u0oetomfetasls2eau p;u)trerifcootfpDr n ils)texrxo3ny1openmncia(fa2rm(m ;u0tpto icilslaDeaumo (4 exrmfcoodfp e uvi;s teto(r3nu1ll eliesat)a2trxr nt0tpxomo3iatla ea(vp;u0tltoxocia1lpDr ues t0 rtrxo io4oltn ietlt aDua(m ot0aetnio3tatfs2rm(mo;t4arxrmocto1fpDeln s s seuoxmpny1lm n ivs s)aDraxmpnu4alt mfciad m2em(mp;()aetoir oy1om e ivi t)seumim3nudlpte nvil( srua(r ;o0aee  f3tltfmDuln onu0 eeomo iatla eaivs;t0 exrim ou1alt mfvil(  Draxr no0aet  ietltfaDelumo t0tltnxrcto1fm  li ols texoxo no1ll  lfcilt s2umx pot4tlx moctyd s rmumo t)alxoxf3tadla  luvo;()t2toxr3no1ap elncilsfsDta(rono4opt iocildls2ra( pnt0 lerxo oatfp rlivil()s2tmxrpoydoltnlfcilt)aDurur ot4teeo i3iysfaDuauvon(4arxrifctodomtrlnes t)srtmir iudomtelnvi s)aDururo;t0olx  oetasfmDumnvon(0 etrmocoydfmDr u s (0s2umirpno1oltemfvi ( aDtm(monu0tle  f3iytlsDumnvp (0trxrxf ty1oa   n ils0 2umxm3oo4amt mivsls)srtaurpnt1tptomf3tad s2ua( pnt)texnirctodom eaiesls) 2xrxmpoo4ap  mfcs t)arurx  no4olt ifciltfsDraumpnu4 lxnxf oo1fpt ai s ( texoio3oo1lm  lfct sf rtmxmpou1alenio3tys m2rlnvs t)treniocoa1fpD lu i;t t2uo(o nudameelnet ( a2ra(rp;t4aexomfeilt m2ran s () lermr3tatfpDrai i t)s2toio oo1amtnlfeils  Dtru oot1teenmfeildfs2em(mo (4 etnmr io1fa   n ils)seto(m3oo4lme  ncsas)s2rmumo;t0tptn fciytfm2uauvs u4tltnmf to1lmDeluvslt0sexrxmpoy4ap  lncsas sDraumo;o1oltn f3tlslm2uauvp (4 lenmf ia1fm rlnvo;(0t2xr(o3oo1omtelnes ()aDtm(m ;o4tpx  fetydls2umuvp;(0teeoxfciy1fatr i il(0s2xoxm3iudam nlivias  2rax o;u0teeoifeiatfm2ran s;t0 rxrxrctydomtr nei;t) 2umio3oo1om elnvt ()a2trxmpou0tet mf3ildlm um( p;t0trxoif ootlmDelieil() 2xr(m3ou1lpee iciasfsDtmxmo;t4aexo ieiyd m umnmont)teermr iotoatran i;(  exr(o3iy4llt  ncs s a2tau pnt4tlxnmfcils a2ul(mp t4 rxnxr3oytlaDeluei s0t2tm(o3oy4oltnmici sfaDrr( ont4alto ictlslmDran p;t0tetomfcio1oaDr ueo;s setrir iydal   ieiasfa2urxmp;t0oexn ieiydfa em( o;(0aexnif io1fmDr uvs s)s2toio3oy1opte fetat) rrru pnu0apt ifcildlmDrm(vs;t0 rtoir totopD li o;s) exrxo3nodlltnmfes s)srurxm ;t1ole mietas mDumnmonu4 eeomf to1la r iei;(0trxmir3ou1ameemfesl(f rra(ro;o4open iciytlaDuan o t0texoiocoydlaDeai o;t)srurio3oo1apenmnvtlsf rtmu poo1aet miciat m emnvo;() lxrir3oodoate ivil(  2um(o io1om   nvt () Dumxr no0oeenmoctys m ul(msnu4 etrir oatlpt lnes;t0t2tmio nodal nmfetls sDtmumpot1tpenii3tyd aDuluvp t)teeoxocty1lmtraueo;( setoxr ou4ap elivt t)artm( onu1apx  iciltla ea(vonu) etrxo3to1optrlnes;(0trxo(m3iydlltnmfesl( sDum(mont0altn oeiatfm2ul(vp u) ltriocoy1la r n o;t teurio iudom elnetls sDua(rpno0olxoifeiasfsDrmnvs (0 rxnif iatfp   uei t setmxm3no4ap   fvta(f 2urxr ot4olxnmicilsfa rm(ms u0trtoioctydfp rluvo;(0trtr(r oo1lpt mncs (f rtaum nu1tlxomicilsfa2el(vs (4 ltrmocio1om   nvi;s0srurxo3oydlp e nvslt)arrrx  ou1aeeomoeild m eauvo (0 etomr todlat lu i;(  rxm(o oudolen iesls)artaump;u0tlx  oeiydla em( s t4 eerxf totlmDeaivs t  ruo(o3iy1lp elivtl(f rrmx poo1opx  i3tyt sDumn pn()texrifcia1faD  uei t0tetmimpiu4al  mfeilt  2rm(  ;o4texnmo3ils aDemnmo;t4aetoircoa1lm  luei;s)t2xmir iu1ole  net s arta(r nt1oexomociys mDrau onu0altnxo3tadfatr nvs t  2xm(o iodlmt mfesa()srraum ;o4aleomf3iytfmDemnvp (4alxrir3oatfpD livolt) 2xmxmpou4lmen ivsat  2ra(mo;t1ale ioeiaslmDulnmpn()texnmo3io1fpDrlieols  2xo(opoodll  mics (f ruax ono0tlxomieiydfm em(mp;t4aexrmo3iytlptelnes s0 exoxr iu4lmt mfcsat) Dum(r oo4tltnmf3iysfm2umuvpnt0trxnxrciydfa e ivs;s0setr(m3nodlmeemivta(faDua(  no1olxomf3tlsla rl(ms;()artoxr3tadlpD au i;(0t2triopno1ol emivtl()aDtrur ot0tpt  i3iyt aDranvp (0texoirciytomte nvs ( s2urio3io1olte ics t srua(rpoo4oexoioetltlm el(mo;t0tleoxfcio1fpteauvs;( setm(rpoudamtelici (fa2tm(mont4alenmfcilsls rauvon(0tltnmocootfpDranvi (0teurir3nudole micsls  rrmx pnt0tetoio3iadlm ra(mo;(0artnxr iotlmtraueols0sexoxmpio1am n ivias) 2tr( oou0apenmociyd a2uanms u0 ltomo3iotlmt auei s  2toxrpoodlmt mivsa(  2tmu o;t0tlto f3tadfmDea( on(0areoif iadop rlneil(0 2umxo nu4al  mnviat)sDrrxmont4oeto f3iytfsDelu pn() ltnmfctydfpteaneils)t2tmir iy1aptn nct tfsDta(r nu4opto o3iytls rlnvsnu0aeeoio3ta1op e nes (0 ruoir iydlmt mncilsfa2tm(mont0tpenmiciydlm uauvo;t4aetrircio1fp  li ol(0s2tmir3ny1ap elictlt) 2rmumpnu1aeen f3tasfsDrlu o;t) rxrifcoatfp rai il( trtm(rpny4lptelieil(fsruaxro;t4oltomi3ils a2rl(vpnu0 ltrxr3oodfpt livo;t0srxoxo no1lpeemfvias)srtrxmp;o1apx mociad a uln s;(0areoif3ootfa elies;(0s2trxo3no4ale mfvsl( arrmxrp;t0oeto o3iatfs rmu sn(0altrxr3to1laDraivs t)s2to(r ou1opeelnes t sDtmumo;o0opxnifciyd s elu p;()aetnmo iytoa   ueo;t0trurxrpio4ole mnvtat) Drr(mpnu1tpe moetas sDua( ont4 lxrmrcia1laDe nei s0setrxo3iy1ameemncs s) rrax pnt4oet  i3ilt m rmnmsn(0 rtoxrciatla  aivsls)t2trxo oydap  mieslt a2uaxmooo4aetn f3tldlm eanvo t4 ltnif3iydlmDr nes;t0s2xrio oy1lm   fvt ()s2ururont4tpxoif3iat m2umuvo ()aexrir iydfp e ivs s0srxoim ny1opte ici sfs2rmump;u4tpt moctltfsDean o;u4arxnxo io1fat li s;s  eum(m oydapeemnetas)artmuroot4olt  ieiytlsDel(mp;(4tlxrmr3iytoatraivilt0 2triopny1ol n fvs t)arumurpno1olxnmiciyd mDranvpn() etrmociydoate n sl(0seur(o oudopt  nesl() 2urxrooo1olxoifcils s umn snt0alerxo oo1lpD ln o;s)s2xr(r oy1al nmfcs s) Drrxrpnu0alxnio3iat m umu s t4 eeomociydomte ivs;s  eur(o io4llee fctls)aruax p;u4opxn ietldlm rm( o t0tlenxr iy1lmD  uesl(  rxo(rpoudolt livsa() Dtrxr ot4altn octytls el(ms t4tlxrir oodop e uvi;t)trtrim3ou1ll e nvi ( aDrmxmp;u1aee  i3iyslmDua( s t4aexomocoydlpDraieo;()teurir iydlpenlnciasfarra( ono1aex  ictytfsDeanmp;t4 etomrcty1laD  n o t t2xm(mpoy1amen fctltf rta(mpnt1oexoii3ildfa2eanmp;u4tetrxocoatlmt livo t t2xo(r nydlmeelivta(farrax ooo1alxomociat a eau o t)altoxrctydfatrau s;s)s2urim oodap   fesa(f Dum(m nu0tlx mfetatlmDelu snu)arerxo3tydlaDe nes s0 etoim3iy4opt  ivsatfa2raxroot1tpen oeiad mDra( pnt0 lxrifcty1oaDe ivo;()srxm(r3oodapeemfes t) 2umumooo0ope io3tldfa em(mon()tleoir3oydfmt anvilt teto(o3ou1lptnmnvsl( arrmumpot0oetn i3ils sDemn o ()texnirctodop  anvolt0truo(rpoudomt lieilt a2ra(mpnt1tptomi3iydlaDrl( o;u0trxrmr3iotomDrauvi;t trtrirpou1ome  fvsat sDtr(m nt4tlt io3tasls rm(msnt)arxrmrcootopD  i olt) 2trxm3iy1aptemnes (f 2truro;t4alto f3iysls ea( o (4 reoirctodop r nvi;s0setoim3io1om e fvsa(farur(mpnu1tetnifetatfs2ranvs;u0 rxoxr3oa1lmDe ivo;()setrxr3iudlme  fvtls)arumu o;t0apx ioetas m uauvs;(4alxomr3iodoaD  u sls  2toirpou1alee nvslt)a2tmxrp;t1oexniiciyt a2rmu p;()texoir io1la  au ilt  2tm(opio4olee iet s  Drmx oot1tlxnmi3iydla2ran s u4tltrmf oodlatrlieols srxoim3ny1apeemneil(  2rmxm ot0ape mfctyt mDeau s;t)aetnmf totfm e u i ()seurim oodomte nct (  2rrx p;o1oeeo oeild s2ean s;u4aexnmr oytfmDe n i t  rum(r oy4alte iesls)aDraxmp;o1aet mfeilsfsDeluvp t4trxrmr oa1oaD  ieo;s  eurxo3io4ll  lnctat arrmxm ou0alx moetydfmDrluvp t)aetnif to1om  ln i;()t2uoir ou4ale lnctatf 2um(rp;t1olxnmoctys m uan p;u0trxnxr3ia1omDr n i;()texoirpoydaleelnvi s  rtmurpou1aptomociat m2emu onu0 lerir3tydomDe u i;t)srur(rpno4oltemicsasfs2rm( pou0olenmoeiysfmDuanvs;u0 lxomf3ta1omt  n s;s0 rtmiopiy4omte ncs (fsrtmu oou0tle mfeiasfsDumnmpn(4teeomo iydlaD  nvol( trtm(opny4ape  ictltfs2um( oot1aexnmiciytlaDemn sn(4tetnio iadlpDe n ols)teuoio nu4amen nci (fs2ra(rp;u1tetnmiciadlaDum(vp t)tetrmr tatfm   uvol(0 rxr(m oodllee fvt t)srtr(r ou4aetomieiasfaDrl(ms t)alxrxfciodopD lnvs s t2umio3iy1lp nlfvs s aDrm( p;u4optomi3tatlmDumnvp;u4alxnir3todlmt livilt)sexrimpnodamte ivtl(  2rm(mo;u1olx mieias s rmnvsnt4tetoxf3io1fptranvs (0s2trir oy1ope liesat sDumur ot4ope  octlt mDuanvp (0trxoio iatla r iei ()texmir3oydoltnmnei t sDtrurpno1ale mfcilt s rmums u4 lxoir3iydfm  an o;t0 ruoxm3nudlmte nesat a2umxrpoo1opeo i3tyt a eauvo;(4arenif iatlpDean slt  eurir3iy1optnlfvs s  2tax  nu4oltomi3ildls rlnvs t0arxomocoo1lmDrlneslt0sruoxrpiudalt  icils)a2urx o;o1tpen ociytfa ua(mon(0artriocty1lpDe neol( trxmxmpou1amt liei tfsrurur ;o0oeenmoeiytls emumo (4teeomfcoo1oat auvs t srtoxmpoodlm n nctlt) 2tru  nu1tlx  i3iytfa ulu onu4 rxnxr oy1fm r uvs;s0trtoxm3iy1lmtemiei sf Drau oot4texoifctls m2rm(vpn(4 etnmo3iytopD lues t0trto(opoydap   ict s sDuau  ;u1tlx  o3iasfaDrmnvo;u0texnxr iytlm eau i ( s2xrim iodam emnei sfarum(m ;u0aetomocildlaDuanvsn(4 rxnxr ootoatr uvs s0 etmxr iu1apeelfetls)srumxm oo1aee mfctld m2ea(vp (4 etoxr3oadomDrlueolt s2um(mpiy1ap elfcs tf 2ua(r ot1aptomf3tat aDrln s t) exrxo oadlp r i il( teurxm ny4ap  mnvt t) rrmxrpoo4oleomfciasfs2ulnmon(0tleomo ty1lmt lnvo s)texrxo3nudameemivtlsf 2rax  ;o1alxn octldfa eaumsn() lenio3totfmt auesls0srxr(r3ou1lpt mnct (f 2tm(  oo0texo octys aDeaums u)artoifciy1lp eln olt srxmxopio1lltnlieia(  2urx p;u1ope mf3iyd s elu snu0 ltomr iadfmteli s;s0setrio io1op  lfes tfsDra(rp;t1altn f3iytlmDrln on(4aetrxr3tytomD ln o t0t2urio3oodopte fvs t)sDua(mo;t0aexomi3iyt s eluvp;(0aleomo3iy1faDelneols0texm(o3iudal nmfeiasf 2rrxmoot1tpxomi3iyt m umuvo;u) exrmo3tadfm ranvs;t)srurim oydlpe lfvsat)arrr(r no0tptoio3ilsfmDuauvon(0 eeoxrciatfmteanvil( trtrimpio1aptnmnesls)srra(monu4aee if3iadlaDrl(vsnu0 exnio3oadfpt ln s t)trtmio3nudopenmivt sfsruaumpot4tee mietadfsDelu pnu4 rtnxf3to1faDe i i t s2umir3iydlleelfvt () Duaxmpno0tpx  f3iydlm2um(mpnu0aeenircoatlp eau sls)setoxm oo1alte iesltf Drmum ou4apxoiicilt a el( s u4 rerif oodomDe uvslt0s2toxm oudlpe mfetltf rrau  no4alxnmo3iat a2uanmp;(0alenxr3oa1opte u s;t)trtmxrpiydome  netlt artmxr ;o4tet  f3tldfmDumn s;t) eenmr3iotla e u s ()t2tm(rpou1lltemfvias) Dra(root0tlen f3iasla2ulnvpn()arermrcia1lmD aivi;t0 exo(opiodapt lfcil()sDtrxr oo0ale ioetatfa2um( o;(4 lxrxo ty1lmteaivs;t truoim3io1omtnliet t)a2urumo;o4oexnioeias sDumnvp;u0teeoif tytfpt ln i;(0t2um(o3iy1lpe lfcslt arrmxmpoo1tpxnmi3iytfa ra( snt0tltrio oodoaDeaivi s0teuoio3iu4ll e iesat)arrmxrp;o4aleomoetysfa2ra(ms t0texnir3iy1laDr n s;(0teuoir3nu1omeelfvt s sDua(mooo0ole iicildfsDuanmp (4tleomr tadfaDraivslt) rxrxmpnu1lltemfei sfsrrau  ;t4opt mieias sDean s;t4alxrio3iadopt  neols  ruoim3nu1altnlivsasfsrrr(moot4optomiciatfa rmnmo;u0teeoif ty1fa raueil( srxoio3no1apt lnvta(  Drrxm no0altn i3iys a emn o t) etrmr3ootfpD  ieo;s0 euoir3no4lptemieilsfartru ont0ole  feias a rau o t0teerir3iy1fptraueo;( s2tmio nudlltemfei ()sDumxrpoo4oeeo f3iytlaDulu o (4 reomf3oa1lmte i sl( tetoirpiodlltemies ( s2trxmo;t1olxomoeiadlaDemnvs (4aexoxf3oadfpte nei t0srxmirpou1apt lncil(f Dtm(mooo4opxn icilt a2um( pnu4aetnio oytfpDeauvi ( srur(o3io1olt  fcsls)artrxmpno4apen fctys a2em( o;(0aexoio3oodop elu ol()srxmxr3iu1omenlfciat sDumuronu4apeomieildlm rm(vont)texoircoodlmDr uvs t0srxmio oodole mivias aDraur ;o4aeeoifeiadlmDrl(mpnt0altoif iy1fat  ueo;s)trxo(opnudolt  nes sf Dtm(roou1apt iociysfs2rl(vs ()aexrxo oatlpD  uei s tetrxm io4aptnmnciasfa2rax ooo1aeenmictyt m2eln s;(4artoif3oy1fpteai s;(0s2xmio3ou4op emfvias  rtrxmpou1ale  fetasfa2umums;() exnif iytoateli i;t0t2tmxmpoo1lp n net ( s2umumono0ape  o3iytlsDeanvont)tetrmrcto1faDr uei;(0t2umio oo1omeelncilsfa2rmum ;o4aetnii3tlt sDeau s;u4tlxrxf tatlpt  n olt)sexrxr ou1am  mnvtatfa2tm( ooo1oeeomieild m ran snu4 leoioctatla  an ilt0s2urim io1omee ivilsfsDumxmo;o0ape mieiatla rl(vs u) rtoir3iodoptrlueil(0texmxopoudopenlnvs ()a2ua(mo;o1aet ifeiatls emnmpnt4 exrir totomDean i t)truriopnudlm  lfvt (  2rax pno4opx  f3tldfs2ulnmonu4alxrxo ia1omDr nei s srtr(m oydalenmncs t  2trxm ;o0oleniieiatlaDrlu o u4artrxo ty1lmteauvs ( t2xo(o ou4llte fvsa(fa2trur ou0oet  o3ilslaDrlnvp;t) exoxf3iodfpDe ivi (  exrxr iy4omeelnvt (fs2tr(  no0oltnmoeiad m ulnmpnu0texrmrctodfm r ieo;()seurxm oo1ol elieslsf 2urxm nt0optoio3tad aDelumpn(0teerir3tatomD ai ols0s2trxr3iy1lleelivia()sDurxmonu1tpeomietldla2rmump u4arenxoctydlm  anes t trxo(opiudomtemivs tf rrr(m ou4tpxo o3iydfa eauvp u0alxrmo tadlpt  i ol(  rurxrpoodlmtn nvtatfa2umurpou4optoifciysfs2umnmo;u0 reoxr tatlm r ies;s0 2tr(m3iodap n fvt (fs2uau poo1alxnifciatlm2emnvp;()alxrif oytoa  an o t0seuo(rpnu1ap n fcsa()srraumo;t1teto fctydfm umnvsnu)aexrif3iydoateanvi;s) ruo(o3nudal  mieiat)a2ua(r nt0teenioctlsla rm( p;(4 eeomfcoa1opD auvs;(0s2xmirpiu1om elietls  Dtaxront0tlto fciltfs ea( snu4aeermfciy1la ean sls) exmio ny1altelieia() Drr(  no0ale io3tldls2uau s u0 lermo3tytfmD  ueo (0trxmxr3oodopenmfvslsf Drax  ou4alen f3tlt m2ea(mp ()trxnio3iotomtrlnei;s0seurxr3oodll emivs t  2raxr ot1oleniietyt mDrl(mpnu)alxnxf tatlmteaies;( tetrim3no1amee fvils  2raxm ot0alt miciatlaDumu p;u)aeeoif ia1fa r nvo;() exm(o no1ap nmnct sfaruaxmoou1aleomocild sDelnmo u4 lenxfcoodom  ln ils) 2uoxm oy4al e fetls)sDtrxmpno0tptn feilsfa umuvs;t) eenmr oy1omt li o ( s2urir3no1lp emiciasfs2ururo;u0oee  feiysla ea( s;u)arerif3oadfmt aueils)t2tm(o3iu1oltnmfetl(  Dumxmooo0tlxniieiasls2uanvont)alxnmo iodfmt  i o;() 2ur(r io4lp elfvilt)arurur ;o0opx mi3ias m rl(monu) ltrxocoodla   uvo ( s2xr(m3nu1lltn fvi s srtmxr no4aetn ociatls ulnmp u)tlxrxr iytfa eaivs (0setoxm nodal elfes tfa2rm(mpot4alt mfeiyt a ea(vs;u4 ltrif3tatlat  ieolt srtr(o oudlm  mnvt t) 2tmx  ot4opeomf3tyd aDeluvs u4 eeoir ta1op ean sl(0 2tmxrpoy1lm  micsat sDurx o;u0teenmictat mDuanmo;u4 lxrio oytfateanvi;t t2umxm iudoptn fcsa()s2rmxrp;t4optoii3ilsfmDelu pn(0 lxnircoydlpDelnvo;t0 exoxo oodole mfvi (farta(mpno1tpx mo3ildls ra(vo;u0alxrmr3oo1om e ivo;( s2uoio3iudlptemivta( aDra(r no0ope if3ils a rlnmp;t0alenmo3oatlaDrliei;t setr(m no4ale  ivtlt s2trxm ;o0tet ifeiydlm2uanvo (0altrmfcoytop   n il(0 2xmxrpoy1om nmfvs ()sDrr(r nu4oex ii3tlt s2el(vonu0tetrif3tydfmtrauvs;s)s2tmio3io4lp  mict s  ruau  nt0tet ifetys a ra( o;u0tlenmr iydlmDeai o t)trxr(o iydolenlfes (fartaumoot1tee  ietytls rl( p;u4aetrmr3tatopDrlieols0trxmxo ny1alt mfvt tfsDurumo;u1oleo f3tysfsDuau p;u0trtrif oadomDelieils tetmim nodamenlfetls arrmu  ot0ape mi3iyt m el(vs;t0 eeomf iy1fp rai i;t texoxr oy1lpeemfetat aDrrur ot1oetnmf3iad s2rl(vo;t)teeoif3iydoate u i ()seum(r3oo4omtemfeils  rra( ooo1opxo iciatla2eanvpnu) eeoif oydfatranvil(  2trim3nu4amt mfeil() 2ua(ro;o1tet mfciadlsDem(vs (0tltrxf3ia1omtrln s s0 ruoxrpny1lmtemnei (fs2tmu poo0opt ii3iad m emu o;(4 renio oadopDelu ol()srtmim3no4ll n fctat) 2uauro;t1oltnii3ilt a2rmnmont) ltrif3iydomteln sl()trxm(mpno4optnmfcs s aDrax ooo1tlenmo3iysls emumonu)texrifcoytfpDeaivo (0 2xrir oudal n ivsas arrrxroou1oet  octad m el(vsnt)tlxnmocio1lpDeai o;(0srxriopou4al nmncsls)sDtm(mono0aeeomo3tldlmDelumpnu4texrxf3oadfatrlneo;s0 2tm(o oodol  mnctls)sDtrxro;o1opeo iciadfs rmnmpnu) eerir oatlmDrluvo;()truoim3iy1lmtnlnvs t)arum(  ;t0aeenmieiaslm ranmp (0teenmr tydopDeaies ( seto(r3ou4alee fcs tfsrrm(mpou4apxnmf3tydfa rl(vs;u0tlermf tytlm e uvi t0trur(rpnodaptelivtl(fs2rr( pot4tlxn oetas mDemn p;u)tltoxoctadfmtraivo;t t2tr(o nu4al  lnci tf 2taur nu1oee ifetys aDea(mp (4artnif tydoaDeaivi s)trurxmpiu4ol n nci t)s2ra(mpnt0aexoio3ias mDelnmo;()alxnmfctatoa  lueo;()srtmir3oy4ol e fvsat) rtru o;t4tlxnio3tyslaDelumpnu0arxrmr ty1fa r u sl(  exoiopnudll elneils) 2tau pot0aptoii3tadla2elu o (4arermr iy1faDrlies;t) etrxo3oo1llenlncslt srum(ronu0oex  f3iydlsDrlums () rxnxo iadla rlivs () exr(mpoo4ol nmnet s)sDrr( o;u0tlt mociysfm2emumsnu0aeeoxf3tydlmte i ols)trtoim oodllenmnct ()arrrumoot0tle  feiadfm rl( pnu)trxnxocia1lpDrlies (0teuoxmpoodame mivslt)aDua(  oo0alxoifetyslm ra(mo;t4artoifcoy1opDeluvo s  2tr(mpiu4lm  lfesat)sDua( pno4opx mictldfaDelnmo (4 rtrmrcoydoptranei t0trxrxr3io4lme mnciasfartr(mpoo1tpx  f3tytfm2umu s;t0 etrmo3oydfmt aieo;s0 rum(rpiy1altemnvilsfaDrmxm no0opt  iciasfsDrmnmonu4tlxomo oatop rlues;(0trtoio3iy4ol emfet t)aDta(r ot4texoiiciasla umumo;t0texnmocta1fatr ieo s0 2xm(r no4lpeemics s)arrrxro;u0oltomieiyt m2umn p t) exnxo3tadfpDrlu i s)tetm(m3ny1lmt mnetasfa2umu pou4oeeoiiciydfaDrl(ms;t0tetrmf oo1lmtrai s;(0trxm(o oo4lm n ivt s aruaum ;o4olx  oeiasfm2rmu s;()artrio tytlat auvi;s  2tmiopiodllte ivsat  Durx  nu4tleniieiys s umu o;() rtnxfciatfm eau s s)trumim iu4al  liciltfarum(r ;o4oeenmieiydfa2el( s ()areomo3ta1fmDr nei;t0sruoxm3oudop   fvsl() 2rrumooo4oltnmo3tys mDum(vpnt0 ltrxo iotfp rlnes s0 2toxo nu4openlnet () Dtau o;u1tpx  feildls rmu s u4aexnxf3tadoa eai i;s) eurio oodlmee ics sfsDuaxrpou0teenmfeiltfm2um(vs;u4 renmfcoodlmDraies;s)seumxopiudlpenlfcsls)aDtmxro;t4oetomi3tysfm elumo u)arxrirciytlmtelues () eurimpoodlmtn ietl(  2urxront1olxo i3ias mDulu onu4 rxnxf3iydfate u i;t0 rur(mpny1al nmnes ()s2uax p;o4aet ii3tat s ranmp;u4alxomocoa1fatrau o;s)s2tmxr3iudlpt mieiat)a2um(  ;t1olt  oetas m uanvpn(4 exomo3tytfmt lnvo (  2uo(rpiy4ome lfei sfarrr(mo;t4tleoiociat m2um( s;t)arxrxrcoa1fpDeauvi;s s2umio3iudamenlfcias) 2tau ont4tpx mfeildfaDrlnvo;t4teenxociatom   n s;s)seto(r io4lm  mfvsltf rrm(r ou4olxoii3iydls2uauvpnu4 ltrxocoydoate nes () rumirpiodopen ivs t) rtaumo;t4opx  ietltfs2uau o;t4aexoxf iodfaD  i o s0s2urxopio4lp e fetl(f Durx  nu4texomf3iat a2rlu s t4 lermr3oatoat lnvil(0sruoir3iodol nmfctls)srur(mo;t1texn ictas m2uln pnu4 ltnir to1latrln o s s2tmir io4ol elietl(fsDraxro;u0ale io3ild m2um(vo u4tlxrxr3io1fp  auvils)trtoxr3oo4oltn feiatfsDrmumpoo4oet iietat a2emnvp ()artnxo iadoaDr nvsls  rtm(m iydolenlfesa( srum( oou0alt mo3iyd mDemums (0artnxr3iydlpDeauei ( texm(o nydll n fcs s  ruau p;o4opx ioetasls elnvsnt0areomocia1opDe u i;t0t2um(rpnodale lfei (  Dtmxr ;u0oleo o3tlsfa2ulump;(0 ltomfciodfptelivols0seum(m3iodameeliei (faruau o;t1tlt io3iydlaDum(vpnt) rxomf iotlm eaieo;t t2urxo iydam   ivtlsf 2umxmont1ole moctasfaDulu s u4tlxnifctotfp   i s;(0 rum(r3nu1aptnmnctatfs2trum ;u1tpxnmociytlm eluvs;t4arxomf3tadop eaiesl( srtrio3iy1llen nci (  2tm( pou0aleo o3ias mDrl(vpnu4tetnif3oydoateln i;( trxoim3no1lpee neiat) 2umumpnu0opto i3iytfa2el(vo;t4aeerio oodopDr nvs;()texoxrpny4apenlfci ( aruaumonu1oleniocildfm2umnvsnt)tetnmrciatlaD ln ilt)truoir3oodlpeelivtls  Duaur ot1tpxn o3iasfsDeau snu0aleomfciytfa r neslt  2umio oy4om nmivtasf rrrx onu0opxniieiltla rm( snu4 lxoir ootfmD  ivsl()texr(m3oo4lpenlivsl( aDta(mp;t0aeeoifciys mDemu on(4 rxnxr oydomDeau i;s)t2urim3no4lpe  ncsat)s2urxrp;u4tetnmoeiaslm ran s;u) rtnmf3oatfa r ivi;t0 2xoxo3oydamt lfcsas sDtaumpou1olxoiiciyd m el( o t0artnircoodlaD liesl( trtr(r3ou4al  mnvs s)sDrruronu1tetnmfeiasfm elnms;t)arxrxf to1lpte ies t  exoio3oy1oltn fcils  Dtax o;u0tpxn octydfa emumon(4tltoif tydfpDrai ols)srtmio3ou4amenmfetasfsrrrumpoo4alxn fciatfa rmumo t)arxrmr iydfm   ies;s  2umxr nydapee iei sf Durxr ot1oet mfcias m2rlu s u)aexnxo3oadlpD lu ilt0 rtr(mpiu1ope mfvilsfsrrrxr ;o0oeeomietltfaDum(mo t) eenxr3ootlpt an ilt srtrir3ou4lp nlncils)aDrmxmpoo4optnioctydfm el( p;u) etoxr3tytlm eli i s0sexrxm io4ol  lfet t)arrm(rpnt4tpxn i3taslmDumu pn(4aetnir3oy1fmtrlu o s trtoimpoo1alte icsl( sDuru oot1olt mfeild m2emums;u) rerxo to1fmtrluvo;t0 etmiopny4am n nciat) rumu o;o4ale  icildla2uanmsnu)aetnxo3iodoptelivs ()t2xm(r iu4lp   fvtl(  rur(mp;o1oltnmocias sDemnms;() rermo oatlmD li s t  etriopno4lm  liciat sDrmxrpou4tetoioeilt m2uln snu)tlenio oytfm rlneolt0seuoimpiy1apt  icsat srta(m ;u1aptoii3iyt a2ean s t)teenmf ia1fm rln sl( texm(r io1op   fvtlt)sDra(mo;t4olxoioeilslmDrmnvs u4 etrmo tatom eau i;t0 rurxr3io1op elnes tfsDrm(  oo1oeen o3tldlmDea( pn(4alerxo3iodfptr u s (0trtrxm3nydoptnmneias) rtm(m no4oex  icild a emu s (4tlxrir3totlmteanvo t0trum(r nodlm n nvta()artmum ot1aptn o3iydfmDem( o;u4 ltoxr3iodfaDranvsl(  rtm(m3no4apen fci s s2tmur ot4tet ii3tad sDelnvs (4trtrio3iotoat auei;()seurio3ou4lp n fcs s)sDrru  ou1ape  oetas m elnmp;t4arxoiocia1om r u sl( trxmio ny1amee ics t)a2ur(mpno1aleomoeildlsDumnmpnt4trenmf3tatoaD anvo;s) euoxo3no1opeemieia( srurxronu0tpe mociyslm2emnmo u)trerxr oatfmDelnvi s0s2trir oo1ole lnvslt  Drrx pno0optoioeiltlaDrauvon(4 etniociadfpDe i sl(  2tmim3nu1omeelnet s)srua(m no4tle mo3iydlsDum(mo () reoxocoy1laD  nvol(0 2xrxm3oydlptnmfesa()srrm( o;o4tex io3tlsfaDea(vo;t)trtrmoctytfmDrlnvs t  eurxmpoo4lmeemncil(f 2umur ou4apt  i3iydlaDel(mp;u4texrxf oatlmt ln i s trtmxmpiodoltnlfvia()artr(r oo1tpeomi3ilt s2ranmp (4tetoxr iadlmtrli o ( srtoxmpnu1olt lfeslsf 2tm(rpoo4tlxnmfeiyslm2emnvo;t0tlxnir3oydlptr i i (0 eurxo iy4lm  mnes t  Drmx  ot4tlto o3tlt a2um(mo;u4 etnxo iotfp  lnvi t) 2um(rpoodal e icslsf rraxront0open feiyd aDuanmpn()teenxfctodlatrliesls  2tr(opno4alt lnet sf rrmxmo;u4oexomo3tasls2ulu s (0 lxoxociydfmtrlu o t trtr(opnudale mfvtas  rrm(r ;u1oet  ociydfaDeln o;t0trenir3oy1lm raneolt)texoim3iudll e ivsa( srraxr ;t4aleomfciyslsDra(mo ()aetrirctotomD  ueslt)s2uoir oo4ol  mnvia(fa2uax o;t1oltomoctys m ran onu4aexomr oytla e i o;(0tetrxr3no4amen fctl(fa2raumpot1aexoii3iys m rl(mo;t0tetnmrctadopDraivs s)setoxo3ou1opt licias)a2rruronu4teen oeiatfm2emu p;(0 rtrmocoa1fptrauvs;t t2umir3iy4alee nctl(farra(mpnt0ole moeiat m2ulnvonu4tleoxocoy1laD li s s teuoxm nydlpt mnvt (  rrauro;t0tpenmo3iltla2em( s u0trenio3iodfat aues ()seuoxrpnudomtelfci tfa2tm( p;u1ale  fctadfa rlnvsnt)aexrxrctotom  au olt0trtmim iu1alt  feil()sDumx ont1aeeo oeiysfm rlnms;(4 lxoxo3tadfmD auvi;t) 2xrir3ny1lptn ictat  Durxrpou0teeoii3iasls umumsnu4tleoir oytopt ln s s s2to(rpno1omtelfctls)sDrr(m oo0altnmf3iysfm ua( pnt4 rxoio iy1oaDrlnvs;s trtm(o oy1lpenlieilsfa2uauroou1aleoif3ildlsDeau pnt)alxrmfcoodfaDelnvo t  etmxopou1omtelfvtas)sDrmuro;t0aexomoeiydfa rl(mp;(4arxrxfcoatlpDe ies s)teumir3iu4ape lict t)srrax o;t0apxo octad mDumuvsnt) eenxrcoatfaD  u s s)t2xoxopiodlp  miei s s2um(r no1tlt iieils sDra( o t0trxrmrcto1omDr uei t)s2umio3iy1amt mnvtatfartaumo;u4olenmoetas s umuvsnu)teenmfcoytop rauvo s srxmxo3iy4altn ivs tfs2tmxmpnu1oee  o3tytlmDemnmonu0 lxrmf tadopt  uvi;t) etm(o3no1ome  iei () Draurpno0tltn ietydlm2elnmont0 ltrxf3iy1lmteai s;t)s2umxmpiydame mfcsl( a2rmxmo;u0tee  o3iasfm emu onu)tltrifcia1fmD  uvo (0 2uoxrpnodap   nvilt)a2um(m ;o0teeo feiadfs2uln p t0 etoxfcio1omDelu slt)teuo(m oo4alteliet t)srumxr ;u4altnioeiaslmDeluvs;t)alxoxrcootfa  aivsls) rtrim oy4om  lfeta()sDraxrp;o1alxoioctat s2emump t4 exrir totlaDeau i;s  2to(o3nu1amenlfvs tfarra(rooo1alx  oetatlm2uanmonu) lxomocoadoaDelies (0trumim no1amt lnci tf 2rau oot1olt mf3tldfaDemn snt4arenir3tytfa ean i;s0trurxr oudameemfcslt  2trum ;o1tpx mf3tls aDul( s (4teenmo tatfm eauvslt) 2xoxr3no4ope livt ()arraur ;u0tpeomo3iytfa el(vp;t)teermrcootfpD  nvs s sruoxr3ny4lpenmict t)sDumu onu4alenmoeilsfs2eaumo;u4 eerif3oadom eaueo (0srxmirpiydome lnei ()aruaurp;u4apeomfeilsla2um(ms;t) reomo iytla  auvi;s0t2xr(r3nydlmtn nesatfsrur(m ;u0tpx  i3ildfmDran pnt4 eeoif3iatlm  an i s) rtoimpiu1optn net sfs2rmu ooo0olxn icildfa emu p u)tlermo tatfmDe ieils0s2umxo no4lp elnctatf Drmxmonu1tpxomoctysfmDemnvp;u0treomociadoatr u o (  ruoio io4opt  fcia(  2rrurp;t4aexnii3iytfm uanms;(4teenio3ty1fa eai i t)setrxrpiu4lptn nesl(farrau  ;o1aee  fciys a um( p u4 exnmo iytla raues;s s2ur(rpnodalenlivt (  Dta( p;o0oleoiieiadlsDrmnmsn()trxrxo to1opteluvo;t)t2uoir3nu1lmenmfct t) 2rru  oo0opt mf3ilsls2rm( s u4alxnxr3oa1lmtelnei;s0 rtoimpio4alt mfvilsfsDrr(m ot0aexo oetldfa eanvs;()tlxrxocoadfptrauvo t0trxrxr3iy4am nlfct ()s2umx  ;t1oee  o3iadfaDrm(mon(0 exnio oo1lpteliesls0s2xmxrpio1aleemici sfs2rrxrp;u0aex iociadls rau p;() exnxo3ty1oa ranes t texmimpiudamenlneils a2ua(rono0apx  ocias m em(vsnu4aexrioctatoa  lnvi;t  2xmxrpoydllt lnesa( aDta(m ;t1oeeoioetldfsDeln p;u4tlxnifctytfm  aues t)sexm(r3ny4amee nei tfaDrrxm ;o1oee ii3tyd a2el(mp;t0 eermo oo1lmt  ivo;s trtrir3no1lme mict s) Durx pou1apxo fetltfs2rmumon(0areoxf3iy1oa  lueo () 2trimpoo1op n netls)arurx pnt1teeo ociyt aDua(monu)arxoxf3totfmDeaueo t seumiopny4altemfvil( s2tr(mpot4opxn i3iys sDrmn o t4aleomr3ta1la r ueo;()t2urir oodam emnvsas)s2umx  ;u4aeeomictasfa2rlnms t)texnmo3iytoaDe ivs t0t2urir3io4omtemieil()aDuaurpot1aleomo3iyslmDea( o;u)trtrir ootfatraueolt0 rtmxr nudop  licils  2ua(mont0ope mi3tat mDea(mo t4 lxoifcta1faDelieo s) 2xo(opou1op  mfvslsfarta(r no4tpxoioetldls2ea(vo t0 lxnxr todlateln o ()trtrxr3nydlleelnvsa(fsrumx  nt4apt mi3ildfa2ul(ms t4altoir oydlm   n o () rum(mpnydaptemfvia(  rta(mp;t1tetnioeilslm2eau p;(4trtrxr3iatlmDrlneol() exrio oy1altnmncsa(  Dum(mp;o4apt miciydla2rm(vsnt4 ltoir oydlaDraieo;( setm(o nu1lmtnmies s)aDrmu oou4alt ifcilsfm2rlnmpnt0artnir iotfpt  nvilt0teumxm nydlleemnei ()sDuru ooo1oleo oeiyt a2rmump u)trerxr oytoate neol( s2umxr3oo4altn ivsas)s2ra(r ;t1olxnifeiyd m ua(vo;t4 etnmo3oatlpt anes;s t2tm(m oo1apenmnvtas sDraxmono4ole iieilsfa2eanvon(0alenxo3totlat aivo;t)seto(o3oodlp n ivsl()sDur(rooo4apen i3iat aDemn o t0texrio oytfa r nvs ()t2toxm3iy1lle mfvs t aDumx  nt1tpe  oeiytfa ea(mp t) lerioctadfa ran sls)trxmio3nydomt lieilt)sDurx ont4opxomi3tysfaDrm(vo t)texrmocoo1oaDrlueslt s2xmim iu1lmt lncs (  Dtr(mpnu1aptnio3iadfmDemuvont0alxnir oa1fmD au s t0t2xo(mpou4ape livs tf 2rrxro;u1oex mfeiytfmDel( o;() lxrio oadoatr nes;t texo(opnu1lltn fvi () Dtmxro;o0tleo f3tlt sDeauvo;(0 rxrmociytfmD lu s (0t2xmxmpno1optemicilt)srtruroot1oetoifctytfm2rlnmonu)texoxf oy1oaDeln s;(0teto(rpoy4al nmivs ( s2um(rpou4oexn fcias a em(mo;t4trxoiocoo1fmtraiesl()s2toiopiydapeemics t arrmx o;t0tptn ociadlm ran s u) etnif3iadoaDr nvs;s0sexmxrpiy1aleelnvt t a2rrxrp;o4alxoiociytla2rmu s t) exoxf iatfa e nei;s  ruoirpoo1oleelnci ( sDtaumoot1oeen ictad s2ul(vont) lxrir oadfat  nesl(0 rxo(opny4alen ict t  Duax pnt1apen ieiysfs uau o (0 lermr iodlmD  ueo t) 2xm(r oudlltnmfeil()aDrrxr ;t0teen ociytlm2ul(vpnt) lxnmrcoodfm   ies s)srtmxo3iydal emivta( a2uaum ;o1ole io3tld a2raumsn(4aexrmo3tytlaD an sl(0sexm(o3nodap n icil(faDrrurp;u0alx mocilslm2elnmon(0tleomfcio1om  aivil(0teum(mpoy1lltnlfei ()srtmumont1tpe ii3ild m2um( p;t0texomociodop r u o (0trtoxm3iy4omeelfvil(fs2rmump;t0altoif3iltlmDulnvp u)altnio3oydlmtr uvslt)trtoirpnodll  mnctl( s2rr( pnt1olt mf3iatfm rmnvp;t4 ltnxo ootoaD aneo;t0s2trxopoo4lmtnmictasfarum(mo;u4tle ioctltfm ra( on() lxrmr io1lmtrlies s setr(opno4ll e feia()sDtmx ooo1oee  f3iat a ul( p;t)texnif3ta1fm e n o t)teum(m oudolt mfei sf Dumx ooo1tlxomoetldfm ulnmpnt0arerifcootlpD  ivsls trumxm iu1ameemfetls)a2rr(mo;o4oetn fciasfsDuln o ()alxoxf todoa eanvo;s  rur(m iydal nlfet t  Drmxrpou4alxomfeildla rm( p;(4 etriocia1fmtrlnvol()s2uoir3io1aptnmfci () ruru o;t4optoiieildls2emu p t0aeeomrctydfptelieo s0t2uoirpnu1lm  mfesat arur(  ;u1oet micild a2el(mo;u) eeomfctatlaDe n o;() 2uoxm3iodol  mivsls)s2rrurpno1olenmfeiyt m uaump ()teenif3ia1om  aivs;( s2xrxo ny1lmtemieias) 2tmxmpnu1alxn oeiadls2uan s;u4tltnmfcoodoa elneilt  eumxr3no4ameelfvt t) rurxm ;o1texnmfeilsla rau o t)aeeoio3totoaDr n i t0 rum(o ou1alt mfvsl( s2umx onu0olt mfctytlm2ea( s u4arenmr3tydom eaivil()t2xoxmpoydoltnlnvt t aDua( pnt4tlxn ieiyslsDeaums t4alxnio3totla e ueol() 2umxm3iodlmenmfvia()sDumurono1alt  icildlaDrmnvo (0 etrmocoatlmDelu s ()srtoimpoy1lpeemnvi (fsrur(mp;t1oltnmfcilslsDuln pn(4arxoif tydfmD  nvo;s)sexo(o3iudaptemfvia( s2taum nt0aetnio3iatla rau s t4 ltrxf ta1omD anei s srxmir nudlmtemnetlt)aDtrxm ou0apxoio3ils sDrm( p u0 renifciy1latraueol() 2tmimpiudlptelfct s  Dtaxmoot4optn i3iysfa uln p;t)tetrxo3oodlp r n o;t sexrio3no1aptemnvsatfsDumx onu4opt  ictas m2eln ont4texrif iydlaD  i ilt)trtrxm3oy4lpeemnct (f 2trx pot1aexo ictatla2rau o (0arxoir tydop  aivolt0t2xrxmpnu4am  mnvt s) Dtr(rpoo0teenioeiydla rl(vp;(0arerxrciydlat  n ils)srur(r io4lpeemfes sfsDuaxmpno4aetomf3tasls emuvont4 reoifciodfpt lneilt teurxm3oo4ap  mivi s a2rmumonu1teen oetad a2ean o (0altomr totlmD livsl( trxoim ou1omeelfeias  Dtm(rpot4tex moctad m uauvsnu) eerifcio1fa rlnvsl(0 2ur(rpnu4lm n nei ()srua(r oo1aetnmieildfmDelu ont0 leoirctodfpDrlues t)s2to(rpiydaltemfct s)srum(  no0tptoiietat sDum(mpn(0aleoif ia1omte iei (0s2tm(r3ou1lpte fvil( a2tr( pno0opxnmfctytfm eauvont4trxomr oatlptelues (0s2xoio ny4lmtnmnetas)arum( poo0apt  iciatfsDraumo;(0trxnxf3to1omDr nvs t  eurxopoo4lmt mnvilt)s2umu  nt0olt  ieiydlm2ul(mpn(4 etnmf3iodlmDrluvslt)teum(mpno4lpenmivs t) 2umxronu0aex  o3tasla rmnmo (0aeerxo ia1lm eanei (0setoio ou4omtemieias) 2um(mp;o1tpx  oeiysls uan p u4 rerif tytoa eaivo ()s2uoxo3nu4omtelnci s) 2um(root1olxnmoeilsfa rlnmp (4 exoxf3to1fpD liei;()teumxm3oydal e fvta(farum(rono1olx moctlslaDua(vs t4 etnir ia1oa  aivs s)sexmimpiy1om emivs s)sDtmurp;t1tpenii3ilt m2rlnmp;(0trtrio tadoa elu s t) exoxo3oydapenmnvt tfa2uau  ot0aptoiiciyd s ul(mont0texomo iydomDelneo s trxrxm3ou4om  lfet ()aDrru ono4tlenmoeiydfs2raumon() rtnir3iodla elnvs () 2xmxm oudapenlncsl( srtmurpnu1aptnmoctlt m um(mp t)trtrifcootopDeluvs;s seumxmpiu1op  mfetlsfaDrax p;o4olx ioeild s rlu p;u4 lermr3todlm elneo s0t2uoxr3no4lme lfvt sfaDtaum ot1tex ii3iatls rau s;()aexrifcty1faDrlnes;t trxrimpoydalenlnvsa() 2ua(  ;o0alt mf3ilsfsDea(vs;t)aleomr3iatla elnvslt0tetrxr oydape  iesas aDumu  ;o1ale mf3iytfa2ranvs u0tetnmocoytfm e i o;t) rxmio iy1lpenmneslt)s2tauroou0olx mietas s rmnvs;u)teeoir ty1lm rauvil( s2tm(o ou1altn fvtl()sDtm(r oo4oet miciytfs2ulump u0tetrifctotlm eaieslt) rtrxr3iu1om  lnvsatf 2umumpoo1alxniictld m emnvsnu4alermocio1fmDrlnei;(0 2tm(r3iu4lmt lfes t sDtr( ooo4apt  f3iyd s ea( pnu) rxrio iatlaDelneil() 2ur(m nudol  lfet t) Dum(mp;t1tleoiieildlmDuln o;(0 lxoxr3oatlatrln il(0 rxm(o oodale mnesatfsDrrxmpnu4aexnifctydlsDelnmo;t0trtoif tydlpDe u ilt0 2uoir no4lmeemnci ()aDuau o;o0apxomf3iydfs2em( p (0aetrmrciodoatr u s;t  rtr(m3iu1oleelnetas)s2rmxm ;t0apt  fctysfa2em( sn(4aeeoxr3tytom ranvolt) 2tm(rpiodop e fcta( a2tax o;t1altnioeiad sDuanvo;()tetomf3oy1oat  i s s)trum(m iydlmtemfvi s  2ra(r oo4oexn iciyt m ranvp;u)tetnmo iadfmte ueol(  2to(o3ny4op   fctat)s2tm(m ;o4tpto i3tys s2uanmp t) ltomocia1lm e nesl(  2tmxm oo1om n ictas aDtrurpno0olto f3ils s2emumon(4aeerir3tydfmDeaivolt0texoim iy4apt livt s  Dtrumpno1altoio3iad aDel(vo;t0 renmf iodoateanesl()seumio ou4amtnmfctat)aDrauro;o4oexoiieildlsDeauvs (4aetoif3oa1fmteaueil()srxmir oodlltemnvs ()a2umxmo;u0oltoif3tysls2ulu snu4altnir3oa1fm rauvs s setrxr oo4open nvsl() ruaumonu1alxoiiciytls umnvonu0 lerxf ta1omte i olt  rur(o nydopt  fvs (  Dta(  ;u0optn ociltls rlnmo;t)aetnmr3iodfpt  ieo (0trxrim3ou4llenmietat) 2ur(rpnu4tlt ioeiltlm2eauvs;u)tetrxf iatfpt  n ilt)s2uoir3no1lltemicias  rum( pno1oetomfetytlaDemuvo t4 lenmr iatop  lu s;s sexr(m oo1ale lnvias srrrxmp;u1tpenmfcilsfmDelu p;(4 renmr3oodfmD  nvo ( seur(o iydomeemneias)artrx p;t4oexnioetytfmDeau on(0teenxo ia1fp  aneo (0 2xm(rpiu1lm e nviasfa2rrx ooo1tex  fciat a uluvsn(0alxnif oydom  ai olt0tetr(m3oy4oltnlnvsltfsrururoot1tlenmoctlt mDelu p (0 exoifctotlmtr i o;s)seur(o ny1alt lfctat  Drrx  ;u4tlenioctltfs2ul( o;u4alxnmo3totomt auvol()t2toio no1olenmnet s srua(rono4tet moeiys a ulnvon()trtrmo iadopDeliei t trurir3iydomte fciat  rua(mp;t0aptnifetas a rm(mo;t0aexrir oadopDrlivi s sexo(o iydal n iet sfaDtmu p;o4opxn oetat mDrm( on(4 lxoxo3oatlmD  nvs t)texr(m3oo1ll  mnct sfsrrmumo;u0olx  o3iyd s emnvp (4 eerio3oodop   i sls)texoim iodapenmfci s  2rmu p;u1oetn f3tls mDrlnvsn() lenmf oadop  li o;(0setr(r3iydaptemnvtl()arrm(mpno4alxniictltfsDeln o ()arenmrciotlpt aues;t) 2umio3oy4olee icta(fsrta(r nu0apt moetatfm ranvs;u4 renmrciatfate u i t0srtrio nydame mictlt)aDumu  ot4altn f3ildfm2uanmo;u4 eeoxf iy1oa eaues;t  ruo(m3iodal n net (  2tm( pou4apx mocilt a emnvsnu4trxnxocoydoa e i sl()srto(opiu1optemfvslsf rua(m ;o1olt io3iad a2ranvs u)altomo3io1oa eanes;()tetmio ny1lmee fet (  Dua( p;u1tpt iiciysfs2umuvs;u)arxnmfctatfmt au i;t0seuo(rpoudlle mnviatf 2rrxm ou1olt ioctytfm2umn s;t4 reomrciadom e iei s)s2xmim3oy1lm n ncsa(fsDra(rono1olt iociydfsDrl(mon()texnxrctadfpDr nvilt0t2xrxr nydameemivtasfarua(rp;o0tetomoctydfa ean onu0 eeoio3iytomDran o;t trur(m ny1lm n ivsls a2raur ou0alxniietldlm rmuvonu4 lxomo3oydfatrlivo t0t2umir iodamee ieils) rum(mo;o1aet  fctyt mDrluvo;t0 lxomf3iodopD  ies (0 exo(o iu1lp nmfct ()srtrxrono4tlxo ociysfm eauvp;t0trtoircoadomD  ieilt)trxm(o3iy4op nmiciat aDtm(mpno1tlenmfciad a2rl(vp;() rtnmo3oo1late ivil(  ruoxm3nydale micsls sDrmx onu4oex iietys a2ua(mo (0 lxrxocoo1faDraiesls) etmxm oudop nmfct s a2rrx onu0tetoiictatfsDulump ()tltoxf ta1fatrau ilt0 rxmxr3ny1lmtnmfcsa()aDumx oot0alx mietatfmDemn o;u)aleomfcoa1latrlivi s)srumir3ou1ll emivias  rtruroot0ope iieiatlsDulumo u0alxnmo3oodoa  luvi;s) 2xm(o3oy1alte iesas) Drmxm nu0tpx  i3iasfmDulu o (4 ltomf3oydopDeau s s0 2umxm oodlleelfvt (fsDtmur ot4oeenmfcilsfs2ulums;(4altrmoctadlaDraies;t t2urir iu4omtnmics tfsrtm(moot0alenifctad s uan pn(0aeeomo io1fptran olt)seur(m oo1amt  icils srtrxm no1oeeo o3tltls2raums;u0 ltnxr tytfmDelueo;s0trtmxr no4omtemnetasfaDum(  nu0apt  o3tasla ra( o;()artrmo3oo1fa eaivi s trurxo3iu4omtemncsa(faDtm(rono0alxn octytlm emums;()tlenxr3ty1om r ues;(0trurxmpoo4altelfet t a2tmxmpot4tpxoiicildfa2em(vpnt0 rxrxfctydomD aueo (0 2uoim3nu4ope  fci t a2rrxm oo1tpen f3tasfm2rmuvs t)arenmf ia1oa  lneo ( s2trxr3iy1op nmnvt sf Dua(roou0opxoii3tld a rl( s () rtrmr3oa1fmtr uei;t0s2tr(opoodam elivs sfarrrx poo4oetomf3iasla emn o t4trxomo oo1fa  aiei ()t2urir nodlmenmnvt s aDum(r ;o0tltn fctydfmDua(vp;u)treomr3iatla  ln o;() 2uoirpny4olee fvtl(farra(m ;t4tlenmfctlsfs2em(vsnt4trxoif iodomte nvi;t) rtr(rpou4lltnmfcs tf 2um(mp;u1alenifctatlm umuvs;t0alerxf3tydoa   nvils0t2xm(r3iodlp nlfvslsfarua( onu0oeen f3iyt mDemn p;t) etrxf3iatlpD  neo t)t2toxm3iydam e nvs (  Dtrxmont1tpt if3iyslmDemu ont)aleoirciadfpD an ilt t2um(m3iy1ll e fes s) rrmu  ;o1tee mieils mDulu o t0 reoxr3tadla eaivi ()teuoio io1lpt mivtl(faDta(m ;u1opeomf3tas aDrl( on()aleoxf iatfmteau o;t  rurxo iodlleemfvsasfa2ua(r nu1texn o3iysla rmnmsnt0artoxo3iadop e uvolt  rxrirpoo1lmenmict s  Dtaumpnt1aptnmfctlslmDea( o t)trxomocoydfa  lieil() 2uoir3iudamt licta(fs2trur ;u0olxn i3ilslaDum(mp u)trerir3tydfmte uvo;s0t2uoimpiydlm  mfetlt  2tr(m ;o4altn fciasfs2ul( s;t4 lxrxr3ia1laDe uvsls0seuoxr io1ll nmfvsa()s2tmurpot0altoif3iydfm2ulnvs u)arenifctodlpDeaiei;(0sexrim3ou4lmtnlnvilt  rra(mpoo0opxnifeias sDeluvs ()aleomr3oydlmDrlivo;(  rxrio3nu4olen ics (f 2rru  ;u1aeeo o3iysfs elumo;u0teerio3tytfmte nvo s0 rxm(r nydalt  fvt ( srta(  ou1tltn ocils a2rlnmsnu4arxoxo3iatfatr uvols) rxmxrpnodlm   iet sf rrmxm ;t4olx  iciyd a em( snu4aexnxrciydopt ln olt  eurir ou1ome  ieslt a2ra(rp;o0oleoii3tlslaDul(mont)aeermfcoydla eau il()teumio3ny4am  livi ( aDrrxrp;t0opt  ieiysfa2rl(vp t)trerif3ia1omDr nes;t0 rxrxr io1am emivilsf Dum(mpnu4opxnii3iysfsDulnvo u4tltnxfctadfpt anvs (0 exoir3iodlle  net (f 2tmxrpot0apt iicilsfmDran on(0tlerir tydoaD aieo;t teto(opiydam nlfeilsf Durump;u1apxomfetltlaDem(vs t4aexrioctatopteluei;t0 2xoio3ou4ll  lfvtl()sDrmuroot4alxn feils m2ea( s;(0teeoxfciy1lp r i o;s)srtrio3io4alteliesatfaDrm( pnt0tex moctas s2umuvo t) eenir iatfaDr i i s) 2xrxo3iodllenlivtat)srrr(  ;u0tet iociltla rmn o;t4 lxrxrctotoa eauvi (0 eto(o iu4lle mnesl(f Draxmp;t1aexomoetltfaDeau p (4altoxfctadfp r ueo s0 2uoxo3nudam elnvt t  rtaurp;o1alenio3iyt m2ean o ()treoxfciodomteli il()trum(o io4lmtn nct s)aDtru  nu4oeenmoeild sDrmnvp;u4trtnircoa1oa e u s ()srxoxo3nudopenlnci t aDur(r oo1teenmiciad s2elu ont4 exrxf totom elivs;s0 rumim3oy1lleemnetat srtaxrpoo4tlt  o3iltfaDul(mp;t)texoxr oadlpDr nvo;(  ruo(m3no1ol e fesa( arrauroot0tetoifetydlmDrlnvonu0 etnxo ootop elnes s srto(o3ou1lle lfci t s2rmum no0apx ii3ild a2eluvp t0aexrxfcto1lpDeaivs s0sexmiopnydap elicta(faDtaumpno0optomf3ilsls ea( ont) lermf iodfpD  nvi s0t2xo(o3nu1am n ivs ( sDua(mooo0tpt  oeilsls eaump (0artnmociatfpDr ueol( setm(opno1al emnetas)sDtr( pot4altn fciytla2el(vp;u4trenxfcoadopDe nvs s0srxmiopoo1al elfetat arua(mo;o0olx mfctyslmDeau p (4tlerifctodfate ies s)srtmimpnu1lle mfvi s sDta( poo4opt  f3iyt a2emnvp (0aetoxfciotfaD  u ol(0 euo(mpnodlleeliviltfaDtaxmp;t4tpenmiciysfmDrl( p;t4aeenio oadom r uei s0srxmir oo4lltn feta() 2uaumo;t0oeto f3iasfsDul(vo;t4 ltrxocta1fptr ivo;(0trxmiopou4omen nctas s2taxr ;t0olx mfeilslmDra(vp;t4alxoirctydlptrau o ()t2to(r3nudole  net t) 2rm(m oo1oee moeilslmDea(von()trxniocoodlatr ieo;()srurio3oy1ameelnci s)aDtrxmo;u4opt  ietld m el( p ()texrio ia1op   nvi;()s2xo(r3iy4om e icslt) Dumur ;o4tetoifeilsfs2ulnvont4 etoir3todfp   nvols  2xrxr io4omee fcsl()sDumxr ;u4tltn fetatlmDel( pnu)trxoir oo1lm  auvi;s)teumxr3no4lmeelfviat) Dtm(rono0ale mieiat sDranms t4aetomfctotlmDraieils0texrimpiu1apt livsls)sruru pot0alt  ieiaslsDrauvsn() reomf iatoate uvo (0 2urxr3nudalenlictlt)srrr(mpnt1olxnmf3tlsfsDeauvo t0aetnxf oytlm rlueo t) rxo(o io4lleelivs t)srur( ono4aexomfeildlmDuanms;u4trxoif io1laDeauvi;t0 rtmxrpno4lpe livtltfa2umur nu4oexnmoeiyd m2umnvp (0 rxoxr3oadfat li i t0trxoxm nu4llte ieil( srta(ront1alx ifctytlm ua(vo;(0aeenxrctytlm e ues;(0t2ur(r oy1ameemics ( s2ta(root1aeto ieilsfa2um(vs;(4artomo3ty1oaDrai i ()trurxo3nodom  miei s artrumpoo0aet mo3tyslmDra(msnt0 rxoxfciodlmDrlivs ()sexm(m3oo1open nesltfaDumx  ;o1texnmoeiatlm2ua( ont4arenircty1lmDrli i s0t2tmxm3ou4lpeemivsat sDtrxm nu0oetnmo3iasla2emn s (0tltnxr3oadlaDeln i;t  2tmxm3nu1optnmnvsasf Duru ooo0tpxoifciys s rmu p t4 lxnmr3to1oaDelu sl(0 eum(r3io1lp elivt t)s2rmx  no1alt mieildlm2rlnms;u0trxrxr iytfpDe u i ()s2tm(o3iu1ll   neta(fartrx  nt0aetnifetadls elumont4altoxociotop elnesl()sexrxr3oudop eliesls aDrrx  ;u1aleomoeiltla2ua( o;u4 lenir oytlateauvil( teurirpoudlptelnciat)a2ururo;t1tpxnmieiyd mDrlnvo t0aleoif3tatlaDrln i;( texrxr iydolee iciasfsrrr(rp;t0aptnmoeiyt aDul(vsnt0altrxf oa1fm rluvilt s2toimpoy1lpenlfct sf 2rr(mpot0aetnif3iaslaDrlump (4altrif3oo1lmDraieil( t2xoiopiudol elncsa()arrr(mo;o0oexn fetasls emuvp;()aeerxo oadoptr n sl( texr(m nydoltnmfes s)aruaxmpno4apxomfeilsfs rlumsnt)treomf3oydoat lieslt0srxm(rpiydope  fcs t) 2taxr ot4olt  fciydls elu p ()treoiocto1optraues;s setr(rpou1am nlies t) 2urxmoou4olen ieiytlmDua(vsnt4 eerxrcoodfm  luei;(  2toio3iodope liesa(f Duaur oo1oltnmf3tlsfa2uauvo t0trtoxr oy1lpD lies;s0teto(rpoydlm nlnviasfartaumpou1alx iietasfa2uauvp u)arxoif3iadfpDr neols teuoxopiodal nlivt sfa2ra(r nu1tlx ifeiad m ran snt4 rxomfcoydfp r iei;(  rxrxm io4oleemnesas) 2tr( pot0tpen oeiadla umu pnu)tlermfcto1oa r uei s  2tmxm no1lpte icilt)s2rmx oot1oet mfeilsls eln on(0artomr ty1lmtr ivs t)texoim oo4lpt lnvi ( artmu poo1oexoii3iadfmDraumo;u0 ltrxr oodlmDrlnei ()t2tmxo3oy1lmtnmics (  rua(root1olxomfciyt m2umu o;(0 exomf3todlateai o;(0t2tmxrpoydll emivsls srur(mpoo1openmoetasfm rl(msnt)alenmo3ia1oa rli o s) 2umir3nudlp nlnvslt a2rrumono4tleo fciasfs2elumont) eerxocia1lmt an i;t  rtm(m iydlmenlfcia(  rum(root0aex mi3tadlm2eln onu)aexoifcoadla elnvols)teumxo oo1ap nmfet t)arrmxrp;t1tlx ii3ilslsDrlnmp;() lenmo iydomt liei;( srtr(mpno4apt lnetl( s2raur ot1aetniietatfm rl(monu)texrmf3iydoa eaivs;t) 2tm(o3oy4lpt mnvta( aDrau oot1tee iietydfa2ra(vp;u4aeerio oo1lmD ai sls)sexoxr iydoltnlneslt)a2umumont1apen fciydfa2rm(mp u4 rxnxfcoatfpt  ueo;(0 rxrir ny1amte fviltf Drrx oot0oexnioetytfsDeluvpn()alxnxo oo1lmt lnvi s)srtriopio4apen ivt ()a2rr( pnu1tet moeilsfm2ra( p;(0 leomrcto1opDean s ( trxoxopoo4om  lneia( srrrxmp;u0alt  o3ildfm2ul(vsn(0artnxrciydla r uesls) rxoimpiy1om n icsl()a2ra( pou1ape mictldfa2em(vp ()tltnmociotlmDeli ils)trur(r iy1optelnvslt sDumu  oo4apxniiciltfsDem(msnt) lxoxr ootfpDeli o (0tetrir io1lmt lnvilt s2rmuro;o1tltn f3ild a2ulnmp;u)artrirciytlm e iei;()t2umxm oo4am emieilsfarraxmpnt0olxnmfeild mDeauvp;(0treoxociatomD lu i;(  2trxm3iydlpeelfesa(fs2tmu pnu0optomi3iytfs2em(ms;u0 etrif3oatlm   ivils)s2uo(mpnudlp nmncils  Drrxroot4tltomfetytfa2rlu o;t4 rxomr iydlmtraivi;t0seuoxrpou4amenmnvtatfarta(ro;t1apt mieild m umu s;u0 lxnxo3iydfpt anvo;(0 2ur(m3nudope  ivi sfaDumumont0ape iietydlsDemnmo;() rtnxfcootoat ln o;s)sruo(m nodolte nvi tfa2umur oo1oeeoiietas m2rm( s;t4 lxrxo3iydfatrlnvo ( setmxmpiudal elicsl()a2ua(r oo1oex ifeiys aDel( ont0arxrmrctotopDeau s s tetoxrpoo4lm   net s) 2urxront1tpxnmi3tad a ra(vs;(4 eenmf3oatlaDelneo ()t2uoiopny4lm e ici (faDtaumont1tpen o3tldfm ranmonu4artrmocia1om  lnei;s) rurirpnydom n netl(  Dtaxmoot4aet  i3iatfmDrluvonu4 exomrciytoaDr i i;t trtmim3iy1oltemneias  Dum(rpno4aex moeiadlm2rl(vs;t) ltnir3tytoat aueols0 ruoirpno1op  mict tfa2truronu1ope mictld s2rmnvonu0altoxr tytfmteli o;t  exoxrpio1lle lfctlt sDurur nu1aetnmociadlsDranmsnu0 reoio io1lm elnei;() rurxr3oo1lmtelieilt srtmx  nu0oexoioeiydlmDum( snu4tlxomfcoatlaDelies;t) 2tm(r3iu4ll nmnvt sfaDrr(r ot1ole iocild s ul( o u)aleoxo ta1omt livols0 eur(m oo1oleelfvsas  rum(  ;u0tetnmiciatlsDrauvs;(0 lenxo3iy1la   nvols  2xoxo3oydlm elncsatf Dur(  no1ale iiciyslsDua( pnt4aeenmfciatfa   neo;s)trumxo3iu1lp nmfesat aDuru o;t4tltomoctltfa2rl(vo;u0teeomrciydlpDr u slt0t2um(o iu1op eliet sfartr(rp;o4tpenioeiltla rl( s (0arxrmr3totfatrai sl( t2uo(m oudll n icia()a2raxm nu4aetomo3iyslm emn s;() ltoxf3iytfm rli o t trto(rpiy1om emfviatf 2trumpnu1opxo fciys s2elnmsnu4 rtnmr3ootfat anvi (  2xm(o3ny1om nmieil( a2rax pno4olxomicils aDemnmo;()tlxrxo oodlmD ln il(0 rtmxr iy4lme mfeiltfsDraxrp;o0ale miciatfaDrmn on()texomf tytlp rlneo;t0sexoxopiydlme lfct tfaDtmx poo1tle ifciat mDuanvs t)artrio3iodop eaieol(  rxr(r3oy1amte ivsl( aDra(mpnu0olenifetadlmDem(vsn(4tltnir3oodom  aivo;s  etm(rpnudoptn nvil(f 2umur nt4ope miciad mDum( s (4 reomrcoy1oa e neils0t2xrxmpiu4aleelfvtl()sDur( ono1olxn ieiys mDuln o u) leomr io1fm eli o (0s2ur(r oodlle livt t)s2rmxrooo4texn f3iyslm emn p;()tlxnirciytfaDrln i s)teuoir ny4lm n netls sruax  ;u1oeeo icilslm eanms t)arenmf3iodlm   uvs t seuo(m ou1opt mfcsat  Dur( pot0aee ii3tlt s uln o t0arenmr3iatom r uvsl() etm(opou4optnlfeta() 2rmu o;o0opxoio3iyd s2rmums u0 leoxo3totop r u o;s)t2urxm3nodlmtemnvi (  rur(r no0oltoif3iadfa2ul( o (0tlxoif3tydfateli i s  rumim iy1amee feiat  2rax p;u0aptomf3ilsfm el( s;t4tltnmo3iadfmD auvi;(0 exmio3oy4om  mfcs t sDta(m nt4tlenio3ilsfsDranvo t0artoio3iydfpteaivils) rxoxr iy4aleelneilt) Duax ont4tpt  feildfaDemuvs;u4texnxociytfm rln s;s0seurxmpoo1altn iviasfsrumxro;t1oleo i3tad m2ua(mpn(0artrif3oodopD lnvi s)sexoxo3no1lleemneilt srtmum ;u0texn ietysfm elu s;u4texrxf oa1omDeanvs t)truoir3nu1al nmnetasf Dua(mo;o0aex ii3ilt s2rau pn() etomo3oodlaDeauvs;t0srxoxo nodlmtemnetltfartru  no1tltnmiciatlm uan p u4 eenir totlm   u s t0 rumxm nudol e fvt s) Dtaxro;u0tee mf3iadfmDua(mon()altnxr oa1opDeaiei t)sexo(m oy1ll  mivt (f rtax p;u0opx  ictytlaDulump;t4 leomocia1la eai i;()s2xoxo oudlltnlictasf 2urxmpot4tlx mo3iat m2rlumpn(0artomo3oytla eln s ()teuoxmpiu1op emicil(fs2tr( oou1aee  fetyt mDea(vs t0treoxociodfat anvolt srtrio iodlm nlnvsas)a2rau  ou4altomf3ilsfsDrm(monu0areomr ta1lmDr ivolt0 2xm(m3iu4lleemfvsa( arrrxm ot4tlxoiieiasls2elu s;u)aeeomoctotfmte u s (  eur(o3nu4alt mfct ( aruau oot4ope io3iyd a uan s t4 etrmrctodfmt luei s)t2xrxo3iy4oltnmnctas)s2uaump;o0tlx io3iatfm umuvp t)trtrxfcty1laDr iei;s)srtoir3oo4am nlnvt s artmumpou1tetomo3tys m uln snu0 reomfciodfp   u o;()truo(r ny1ale mnvtas)a2tmxm ;u1alxoii3tas s2ul( o;(0aexrmf ty1opD anvs s)srumxr nydol  mneia( arraxmoou4tlx  feildfm elnmpnt)alxrifciytlm  lnvilt0srto(o3no1ll e fci ()s2umumpot1oee mfetltfm2rmn s;(4arxnir3oytlm  an o t)teur(opou1lmtnlnvslsfsDrmu  ;o0tpeomoeiltfaDumnvp;(4alxrmocta1fa eli ilt srtoir3iy1alt lfcsas)srrr(r ;o4olenmi3tltlaDemu pn()trerxo iotfmte uvs (0sexriopou4omtemnviltf rrmur ;u4tex mo3iaslaDel(vonu4tlenio totomDran ol(0srtoio no4lpenlfcils sDrru  ou0olxnifeildls em(vo;t)alxnxr ia1opt lnvs s teuoio3iodap nlncs sf 2tmu oou0olxoii3iasfa2eanmonu) rtoxf io1lptr u ol( srumxrpno1lm emivtat)sDrr(rp;o1aexomfctas a2rln snu)arxoir oydomt  ivs;() 2xriopoydam elfeil( srtaxro;u4optnifetydla2uaumont0 eenxrcootlmD  ivo;s0sexoir oo1olenlfcs s)srurump;u0olxoioeils aDrluvp;u0 rxrmo iydfp e u ols s2xrxr io4llt liet s aDra( onu1aet io3tad s rln p u4alxomrcoa1op r ieo s) 2trxr3iu1lme lncs sfsDtrurp;t4tpxoiietydls ul(vp (4 eeoifciytopt  iei (0seurir nodoptemivta()aruau onu1apxoiieilsfmDumums u4altrmr iodlmte ivolt0srxoxopoydale mncils)s2tmxmo;t1alt ifciydlsDumu snt4 reomo3oadfpteluvil()srtr(r3oodll  lfcta()sDrau pnu1oexnio3tlsfaDumuvsnt4trtomrcoodlm raues;t)setrim3oo4llen nvsl(  Drmumpot1oet moctatlsDuluvon(4 rxrircoadlat  nei t  2uoimpoo4ope  fcias)aDrmu o;u1tpt  f3iydfs2eanvp u) ltnmfctodfatr n o (0sexmxmpiudom   ivil(f 2rr( oot4tleniociltls rln snu4 etoxr3oo1oatranvs;t trtm(rpny4llt mncilt a2taxmpnu4tpxnmociyd m2ul(mp (4texoxo oytoa eau s t)t2xoim iy1ap  lneiasf rrr(r oo4oexomo3iatfmDul(mo;u)teerxr3ootfaDrlnvilt trxmim3ou1lm  lfvi tfs2tm(mp;t4tpt  f3iasfm rmnmp t4aetnmfcoodfmDrliei;()s2xm(m3ou4lleemieias  2trxmp;t1opxo feiaslmDea(vo (0tlxrif oytoptr uvo;t)t2xrirpou1lm  lncsat)aDrr(roou4oexo oeiyt s rlu o (4 ltrircootlpD aueols  eumxo3ny1aptnliviat)sDua(mp;t1altn fetyd a rmuvs;u0 etoir3iadlptr ieslt)srurirpio1ap nlivslt  Duaxro;t1aeenmoetatla2ean o;() renmr3io1laDrlu s ( trxmio3io1lm  micia(fartr(r ;u1olxnifctldls2eln p u4 eenif3tytlmD au ol(  exrimpoodll  lneil() rum(mpoo1teeoif3ilt mDuan pn(0texnxo tydoat lneslt0t2ur(o3oodoltelnvsl(fs2um( pou1apen o3tyd aDuau p;()aeerxf3iodomD aues s0t2uo(r3ny1lp emicia(f Dua(rp;o1alx  fctlslm2rmn onu0tlerirctadlaDe i s t  etmxopiydll n iesa()srtau  ou1tet mo3iad aDea(vp;(4 rtrxo3oodfmD luvo t  ruoxr3iudlleelict (farurx  ot1texoifetat s2el( snu4arxnxf3iytfmD  uei ()s2tmir io4ol  mies t)a2trurono4apeo ictadfs rmnvsnu) leoir3tytlpDr ivs (0srxoio3io1ame mneilsf 2tax p;u0opeoifetls mDuaums;u)tetnxf3oo1fmtrli o ( texmir iodll nmfei s) rrr(mooo1tpenio3iys mDumnvont4teermrciytopDr nvo s)s2uoim3nu1am e ivslsfsDrr(  ou0tetn ieiadfm ranmont4teenxr oadfmte i i s)teuoxopoydopenmnvs t  2rr(rpoo4oex mietyt mDelumon(4aeeoxrciytfm   ivolt0 rumir oydomtelfvils) Dtrxmont4altnmf3tytfsDean onu)altnmf iotlpt  ivs (0texmir no1omtn ivs tfa2rrx pno1tetniocilsfmDul(mp;() ltnxf iydlatran i t)seuoir nu4apt lnvias  Dum(mont1opxnmf3iytfm2ranvpn(4arerifcio1fmt an ol(  eur(r oudap e nvta()artmu o;u1apto o3iyslaDrln o;t0 lenmf tadomtrlu sls)sruoio iu4ap   ivsls arrmxro;o4tltnmiciyt mDrlumo;t4aeermf oy1omDe nvs () rtoxrpio1ap  lnvsl(f 2tmuront0tlenioeilslm ulnvo t4teeomo3iodla raueilt) 2to(m3iodapen nesa(farua( ooo0apt if3iydlm el(vo;t0aeeoio3todfmtrai ols srumxm3iydlpeeliesas s2tr( oot4tpen feiatlm emn snt0trxomf3tatfmt  uvo;t)trxoxm3io1olt  neils) Dtm(mpot1opx ioetysfm rluvo u0arerifcoodfp   i il(  2xm(r3oy4om elfvt s) rrmx oou0tet ifetat a2ul(mo;(4 rxnioctadlmDeau s;t0 etrir3iu4ol nmnvia()s2umxmpot0olto i3iyt m2uaums;(4artrxf3iy1optr uesl(0 eur(m iydol  lncsl(faDururonu0tpxo ietydla2rau p t0 rermf tytfmDranes;s)trxoxrpny1optelfvi t)srumur ;u1opeomf3iad s um(vp;t)texomociotoatrlnvo;() rtr(mpiy1omen netasfsDta(mo;u1teeoiocilt s umnvo;(4tlxomf3ta1fa r uvslt)s2umxopnudlmt livtl(fsDraurpnt0tlt  oeiasls rmnvpnt0 lenxo oadfaDeln slt s2xm(r3iodlmtn nvs (fsDum(mpot0oex mo3taslsDemu s;t)tltoiociy1lpte u ols)s2xrxr iu4aptemnviltfa2uauro;u0apt  ieiltfa2rauvp u4alerxo iotfp rlivsls0truo(o3oy4olt  ictl( a2urxr ;u4aeeomociydlaDul( p;(4 renir3tadlm eli i t0s2umim nu4lptemnes s)sDraxr no1olenmfetytla2emn o u0teenirciotfa eaneilt0trxoxo ou4lpeelnesls s2taxro;o1tet mo3iaslsDraums t4altnmf3iadlp  aivsl( srtoio nudaltelnetl()s2rau pnu4oeeo oeiltls um( p ()aexnmo3ta1fmte nesl(  rtoim3nu1lmtelncsas  rur(m no0tpe mfeiytfsDrmn o;(4aeeoif3ty1lmt lneo ( srumir3oo1llte fvsat artmurpoo4opxniieilslm el( o;t)aetoio oa1lmt ln i ()trumxo nodopeemfetat s2rm(m oo4aee mfctatls ranvs;(4 ltnxo3iadfmDe u slt s2xrxrpnydlm  lieilt)artm(mpou1oeen oeils m2uauvsnu0 rtnxo3iatlmDeluvs;()srur(rpiudomte fcias)artru pou1olxo fciasfm rmnvs;t)arerxo ta1omt livi t)s2to(o3iu1alenliet sfsDuaurono1tlxoiocildla2rluvp;() etoio3tytfatr i s;(  etr(r nu4op emfetas  2umxm oo1aleo i3iysfsDrlump u)texnxocta1omDrlieolt t2tm(r3nodap nmncils)aDtmx  no0oeeo f3tatlmDrlu s;u0alxoio totomt livs t0 2tmio oy1ll elici (faDraum ;o4tptomieiad m2uau on(0alenxo tytlaDrlnesls0 exoio io1lpte fet (  rraump;u1tlx ioetydfm2elu p (4altoxo3to1opDraies s setrxr3nudllenmfei t a2ua( pot4olxnmi3iaslaDulums;t4tlenxf3oytfpD auei;( seuo(o3oy4ope lfctls)a2rr(mpnu0tpt  f3tasfs2emnms;(0tlerio3tadoa r n ols) rto
\ No newline at end of file
@@ -0,0 +1 @@
+n ols tetm(rpiodamtemfcsl() Drmxm ;o0tptoiieiadfmDum( ont)trxomr iatom r uvi ()srtm(o oo4amtnlnesa(fartaxr oo0tpeoifciysfa2rmnvs;t4trenio3tydoatelu o s)sruoimpoy4omt livslt aruaxmo;u4alxnioctyd m ran p t0 ltoir tatoat ai slt0seurio iodol nmivt sf Draur ;u0opx  ieilsla2ranmp;t) ltnxociy1oa rau s s)srxm(rpoodom  liesa( a2raxmpot1opeoif3tysfsDemnvpnu0 lxrmrcoadfm  lueo;s srtoxm oy4aleelnviltf rrmurooo4teeo i3ilsla ul( o u4tltomocoytomt  nvslt0srtmir nodlpe liciltf 2rm(r ;o0oex  octys a rlump;t0 rtrmo3tatomD au ol(0s2xoir3iydal emnvil() 2urx pot0tlen oetatla eanmont) eermo iatlatrluvils  exo(m3oydlmte nes ( srurumo;u4oltn oeiysfaDuluvo (4trtnmf oydoa  lu o s)trxoio iudoptn nvsa(f 2taumpno1aptnmoeiad s2uln snu0tltnmr3tadop elu s;()s2um(m3oy4op emfeiat s2ta(  oo4tlx micilsfmDua( pnu0alxnxo oa1opt  ueol(  2trxm3oy1ll emnes ()a2rrxm ;o0tet  oetytla el(mo;(4 exoxf3tytfm   ivilt  etmxr3iodalt lfctl()srraxmont4teenmfciad m2ea(mp;(4 lxoxf totop   u s t0t2xm(mpiodolt  ivs s artrxro;t4alxo f3ildfs uaumo;t)artomfcio1faDe u s t srurxm no4lmtemiei tf rurxrpnu4optoii3iadfsDeln snu)arenio oadoaDrai sls t2xo(m3ny4opt livs tfsDtmuronu4aptoifctatfs uan sn(0tetnmf3iy1omte neo s trumim3no1al   net s s2trxr ot1apeoiociadlaDeln p;t0aeenxrcta1lmteanvi s)s2ur(rpno1amtnmieils  rua(mooo1oeeoiiciydfs uan s (0arenio3tadopD anesls trtoxo ny1omt  nvi ( arurxro;u1aptnif3iltlsDulnmp t0tetoxr3iy1om rlnes;(  ruo(opiy1lpeelfetls arta(m no4tpt io3iyd m elnvsnt) rtrio3ia1oa r uvi s  rurxr3nudlle mietl(fsrtmxmpou0tpeoio3ilt m eln o;()teeoif iatlaD  nvi ()t2urxm ou1ap  mfei s srta(  ;u1apxoio3ildla emn s u)tltrxocoo1fp eluvil( trxr(o3iudale mict sf Dumump;t4teeomfctltls2em(ms (4 eerxr3ta1fmD aivo;t0texmim iodlleemnvilt s2raur ;o1oeeomoeiadfs2umumonu4aexnxr3tydomDe nes s0 rto(rpny1oltelfesat artru o;t4ape  fciysls ean pnu4trenmo3iydop  lnvols trxm(o iydlp nlieilt)a2ta(r ;u0aeenio3iltfa2uau p;t0 lxoif todlmtrlu o;t0 rxmio3iy4opt lfcsl(fa2tru o;o4oeto f3tld s2uauvp;t) rermr3oo1oateanvo s0texo(rpoydameemnei t) 2tax oot4aetoioetydlm2ean p;t)tlxrio oydlp elu sls srxoio iy1oltnlfcsas  2raum ;t1oee  oeiytfmDumn onu4 rtnircio1oa rlivo t  rxr(opiodlmee ies (  Drrxmono4tpx  ieiysfa rau pn(4 ltrio3oy1oa rli s t s2toxr iodop n nctas arrm(r ou4oee moeiytfa ul( p;u4teerxr3oatopteli sls  2uo(r3iy4omtn ietl(f 2rau  ;t0tlx  fetadlaDuanvsnt4 eerxo tatfpD  nvols trxo(r oydap e ies tfsrtm(  ot1opt io3ilsfm2rmu s;t4trtrif oatlat anei;(0t2to(rpiudolen fct s)sDrmx oot0optnifciydfa ea( p;(0trtrio ta1omD lu il(0 2xr(m iudap   ict t artm( p;u0apeomoetysfs2rmumpnu4artrxo3oo1fmtrlnei t)texmim3ny4lp  lfcslt  Dra(  nt4tet  oeiat s ulu s;t0alenif3iy1fpDe n s t srurim3iodlpt mfeil(  Duaxmo;o4tpeoioeild m2uluvont0 rermr3ta1fptrauvo ( seumxr iodlmt miesas) 2uru ooo1teeo ictytfa emuvon(0 ltnif3iydfptr i o s  2umxr3ou4llte nesat) Dumxr nu4alx  ocildfa2ranvon(4aexoxo3oatopDelu i ()s2um(m oodoltnmncilsfsDtaurpou4olto i3ilslaDua(vsnu4aexoxo3iadop eaies s0 exrxrpno1om nlfcsa() rtrxrono0aex iieiaslaDrm( ont0 rxnifcio1lpD  ieo;(0tetrxmpoo1amtelnvi ( s2rmu  ou4alen ociasfs2rm(mont0 lxomf ta1lm  luvi t0 rur(m iy4apte fviatf Dum(r ;u0tpeomf3tasfmDemn s;t4trtrif3tytoaDrln i;t  exoir no4lmen fet tfa2rm(  nt4aee miciysfs uanmsnt) exoxocto1faDraieolt trxrir3io1olte nvs () rtr(rpno4tex  icils mDul(mon()trermfcootomt  uvi ( s2tmio3oo1lp e fei ( s2ua(mpot4aeen oeiasls umn ont)altnxfcoa1omtraiei s0 2xmir3oodlp nlictl()aDra( ono1opxomoeilslmDem( o;(4 reoir oadop r nvo () rumim3oy4openlnctltfa2urumo;u4alxnioeiytlm rl( p;() ltnmo ta1fa rauvs;(0teumxo3oy4al  mfeia(farua(mpou0optnmfctasls ulu o u4aeerxfciydlatean s t) 2xrio iudalt mfcil( srumuro;u4olx mietlsls ra( o;()tlenir ta1oaDrauvi t0sexrxmpiy4al nlfetasf Dta(m nu1apenmfctatfs ua(vo u0texrxo3todoatraueo (0texoio3nodole micsls artax pno0aee mfetyt a2eauvo;u0aeerio iydoaDrln i s) etoxm iu1lmeemnci ()sruaxronu4aexo f3tas sDemnvs t) lxniocoy1lmDeluvs t)setoio3nudome lfvta() 2rr(  ot1tetomo3ilt m2umumo;t4tltrmo3tatomte nvols trxrir3oo1lp e ivt t)arumx poo4opxoifeiytfm uanvsnt0aeerxf3iodla  lnes () rum(r ny4ameeliei tfsrtmx poo0tltn i3tltfsDumuvp;t0 lxrir iadoa raiei;t  2urir3nu1ape  ieia( s2trum ou1tpeomi3iytla ra( s;u0 ltomfcio1lmt auvs;t)tetm(m3nu4ll elfcslt)s2raxmonu1apto ocildls2elnms;() renxr totfp   uvs;t0trtrxopoydome lfcslt  2tmxmp;o0aex  o3iytfa rluvo (0 lenir ootfpDe ivi;()srxrxopou1alt  nvia()s2rmxmpno0oetn o3tls m rmump u0 exnmr oadop  auesls) eurir oudalt mfvslt a2raxrono1tlxnii3ils sDulumsn()teeoio3totlmDe uvs;(0texr(rpoydlleelfcils  2umu p;o4teeoiociasls ranvs u4areoir oodfatr uvs;t0 rtmxm nydlmt lfet sfarrr( ooo0aee mfeiltla2rl(mp;t)trtrmo3todoptrau i;(  2to(o no4lpe mnvtl()arrauronu1oee ifeiyslsDel( o (0teeoiocio1opDr nvo;(  rtoim3no4ap elicsl(fs2ta( oou0aet  i3ilsls ulumsn() eermo3iytfmteaiei;s0 2xo(mpiy1lpee iei ( a2rr( pot4aleoiicilsfm ulnvpnt)arenif3ta1fmt ai i;(0 rumir3nydlle  ietasf 2ta(r nt4aeenmfetytfa eau s (4altoxo3ty1lmD  i i (0srtmxm ny1al nmivil(  2trur ot4oee  oeiytfs rl(ms;t0tltoifciytfmDr neo;s0tetmxopoudap e iciatfaDtax pno1tpenioetld m2rlnmp ()trxnmf3tydlaDraneil(0 rumim iydomt lfet t  Dtm(mp;u0oeeoioeiydfm el(vont)tlerif3iydfmDrlnvo t0 2ur(mpoy1altn ies t sDuaumono1aex  i3iytlsDean o (4trxnmoctodop elies (0s2uriopoodamee nvtat)srurumoot1oeen ociaslm rl(vs t)aexoxr iy1fateanvols)t2umxmpnudlm   nvslt  2urumpoo1tlxomictyslsDranvon(0tlxnxo3oodomt  uvo t0setrio3ny4olen net (f 2umx p;u4apt miciydfsDrm(vo;u4altnmf3tytfp  aivols s2trxrpiydoptnlnvils  rumxm oo0aeen octysls eanvo t0 lerif oodfateluvi t0t2tmir3iydol elnvsas sDrm(r ;u0oetn oeiytfs rm( pn(4aleomo oadoaDrln o;s0 rxrimpiy4llt lncsas s2tmumono0tetnmi3ildfsDrl( pnt)trerxfctotlmD luei;t)trtrxrpiydlpe mnvs s)aDrrum ;u1texnioeiydls2rlnvo (0aetrmr3iotlpDr nvi s)truoio3iu4optnlieils) 2rr(r no0teen fetasla2emu sn()teeriocoydlatelueslt0srtr(o iy4lm  lnci t sDrru  ;o4opeoiietlslm2uan p u0artnxf3tydfp r nvs;t0s2uo(rpno1lm n icsatfaDuaurp;t0aptniieiytfsDel( pnt0treomf tydfmtrauvs ()t2xo(o ou4omte fvt s sDuaxroot4oltomiciys m2rmnvs;t0artnmo3iotomtelnei ( trum(o iy1al  mivtlsfaruau  ;u1alenmociltlmDem(vsnu4tltnif oydfmtrln i;s0setrxr oydll   nctas)a2ta(rpno4oex iicils sDelumpnu)arenxr3totlpDelivi t s2xoxr oy4opt lfvt ( srumurp;o1olen f3tatfaDum(ms t0arerio3to1om rlu s s t2xoim oydapen nei t  2trumo;t4tex ii3tasfa2uluvo;t4aleriociy1lpt luvi () eurxrpnydlle mfctls)sDumu  ot0alx iieilsla umumpnt4aexoircia1lm eaneo;s0seuoim3iudome mfviat arrm(moou0opxn ietyd m rm(vonu0 rxomoctytfpDraieolt  2urim3nudom nliesls  rtr(ro;o0tleniieilt a um( s;()alxomoctodlm r i i ()trtr(o3iudllenlfci s) 2uaxrp;o4aetnioeiytlmDran o t)alenmrciytlptr u s;s)trtm(r oydlp nlict (fa2tmurooo0teeo ieiys s emumonu4 rxnio ia1omtr ueo;() 2urim3iy4omenlivia()aDtmx  ot1opx mf3iys a2rlnvsnt)tltrxr iydfaDrln i;t)s2xo(rpoudlle lfvtlsfs2rm(moot1ope ioetlsla2rl(vo;()trenxo3oadoaDrli ilt teurimpiy4optnmietas) 2uax pnu4opxomo3tyd a umuvp;(0trtomocto1latr ieilt srtrirpoudamtelnctltfaDrmx ono0olx moeilsfsDra(vsnu4altrxocoodlmtrluvs s0 rtr(o iudopt lies t  Duaump;o1ape  f3tld mDeluvp;t)arxomfcoa1oaD  n s;s0 exoio oy1omenmnetl()s2rrur ou1tex iociat s2rlump (4tltrxf ta1omtrai i;t t2umxm iu4lm elnesasfsDtaxm ;u1apen i3tasla rluvo;u)aeerif ta1lmtrlu o;s tetmxr3nudop e ivt t  rtr( p;u1oeenii3iyd sDelnvpnt)teenmr3oatlm eln o;s0sexoxo iy4ope lfcs tfsrua(mo;t1oexomoeildfa emnmon(4areomocoo1lm eaueol()trtmim3iu1op elnesa() rrmur ;t4aee io3iasla2ean snu4trenxr to1oa   uvi;() eumio3ny4oltnlictlt aDurx o;t1opeo f3tld s2ulnvs u)arxoiocty1oa r iei;t0 2tm(m nodopeemicsas sDuaxr ;t1olxnio3iatfs ra( on(0aetrmocoydfm e nvs s0setrim ou1lme licia(fsDrrur no0altn f3tyd aDumu sn()texrmocia1fpDr nes t)srtrxr3ou4ol emiviltfa2ua(mo;t1oex moctysfa2emn s;t)tlerio oodoatraivolt  eumxo oy4llenmncsat)aDur(rpnt1teenmociatfa2uan snt4arenmf totlpD livo;t teumxm3ou1lm  livs t sDrm(mpnt4tleo i3ilt s2uau sn() lxoxr io1fat  u i;(0setr(o3oo4lm n ncsatfsDrm(m nt1oexoif3tasla2uluvo u0alxoir3io1fptrau i (0 2um(r3nudolenmfcsls) rraxr nu0tltnmiciytls ulnvs () lxrir oodlmDrln s;(0 rtr(rpiudopee icslsfarumuro;u0texnmfciydfs el(mp;(4trxnmf3iytopt ln olt0 rur(m iudaptnmnvias s2umuroot0apt io3tas a2ulnmo t4aeerxo3tydlp  ln i;s t2urxr3oodome  fct ()arum(rp;u1tee  o3iad m2rmn o t)tetnmo3io1laDrliei;s0trtmir3oodol emieslt  rtrxmp;u1aex ii3iaslsDelnvo;t)aexomr tydlatelnvslt  ruoio io1alee fcs sf 2rr(  ;u4tet  f3ilsls2ea(vo;()artrmo todlp  anvol() 2trxopiy4omenlfeia(fsrrm(  ou0texo o3ilt a2emuvs t0aexnifcoydfp rln s;s)sexoirpnodoltelieta(  2tr(m ;o1optnmf3ild a2eanvp t0 rxnmf3iodfmDr i ils  ruoim3iydol  mncil( a2tr( p;u4tle iiciltfm umu p u4teenmfcoo1fat  n s;()teumio3ny4alee fctat)aDum(  ou0oex  f3iytfsDranms;(0trxnmoctydom eaies;s0trur(r ou1lptnlietat srumump;t4aeenifctasfs ea(mon(4aetrif todfate neil(0 2tmxopoudllt lfci (faDtrxrp;u0ape moetls a2emn p;u)teerxfcoatfptraueols0 etoirpio4lltn nvsa( srraur nu1aexnmietldlm umnmp;t0arxomr todfaD  ueo;t) rxo(m oodlmeemneiat)srra(m nt0oex mociydfsDul(mpnt) lxomr iatlm   nvs s  2xoirpiu1optn icsa(fsrrrxmoot1alenmfeiydfsDrauvpn(0 ltnifciatomD luvo;s)trxm(r3oo1optnlnvsatfsDuau o;t4altomiciltls2elnvp t)tlxomo tatfm ranei;t setmir3nu4altelictat sDuau  ou0aeto ietldfaDuaumo u)alermo3totfpDeln s s0 2tr(opou1apenlfvslt) Drmumonu4olt  o3iysla rlnvp;(4aleoxf3iydfpt lnvs ( t2uoiopiudlltn feias) rrrxmpnt1oee ifeiyd a2elu snt)aeenxo iatlatr iei;t0srxrxr oudope mnetl( arraxmono4teeoio3iytfm rlums (0trxnxr tydlmteaueilt0tetr(opnu4ape lfctas)s2umur ;t0tpenioctlsfm umuvpn(4tlxrxr3iatfm e i s;s  rxoio io1lmtn nctas) 2ra(rpoo0apen i3tldlsDumn s;u) eermf3iatoatr ivi t0t2toiopnu4lmtemies t  Durumpno4tlxo ociytls elums;t4 ltnxo oydfm r uvi;t)trum(o iu4op nlnciatf Drr( p;t1opt  ieilsls el(mpn(0trxnif tydlmD lueols)srtr(mpnodlpt lfcs s)srtmx p;o1alto oeiytls emnms t)aetomo3oo1op rluvo;( t2xoxo ny1llenmietatfsDtrxrpot0oex ifeiaslm2elu p u)trenxo3oy1fa rluvsls) rum(m3no1opte iei ( a2uru ont0teen i3tasfa uanvsnt0arenir3iytoptr ivols0t2toxm3oy4amenlicsa( sDua( p;t1apx mfciytfa2uau snu4 rtnxrcoydlp  anvi;()s2um(opoy4olte fvsas)aDtmurpnu0opeo ocildfs2eauvs;t4 lxnxfcoo1fp raueil(  rto(mpnu4am  lnetas arurum no1opt moetatfm2ran s (0teenir iytlatrlues;(0teuoio3no1al e ies s arra( p;t4altniieiasfs2emuvs;(0tetoif iytfpt aieols0t2ur(r3oudop nmiesa()aDtaxmont4tpxn oeildlmDul(vp;t)arenircootom r nes t)teurirpny4ap nmicils) 2rmxronu0aex mo3iadfm ul(vp u4arxomr3oytomt  ieols0 etr(o3iy1apt mivsl(  Durxmp;o0tex ifeiltlaDran o;(4teerir oadfpt  n o;t)srur(r3nu1om  lnet sf ruaxmooo0tpenmfeiadlm emnvsn(0 lxrir3todoaDeauvils0s2to(m nu4lmen nctatf 2truro;o1aetniicils sDum(mp u) ltrmo tytfmDelnes s0t2uo(mpny4ll  mfeiatf 2ra(m ou4ope mi3iasla2rm(mp (4 lxnmf oy1om e n o;t0 eumim3ny1apt micil(fsDumuront1apxn i3iasfs2ulnvo t4trxrif io1op rlueo;t tetrim3ny1lp e fes tfsrur( o;u1alenioeiysla2umnvs;u) etrif iatom e uvs t srtoiopny4lpe lnvsas  2tmu pnu0alen octadlsDeau p t0 rerxf tydfa eauvs;(0truoxmpiu1amte ncia(farumuro;o0olto ieiltfm em(vsn(0altomocto1opteliei;s  rurio iydamtnlfesl() 2trurono1aexn ietydfa umn sn(4teerifctatopDr i ils0t2umir oy1llen netl() 2um( ont4tlxnif3ildfaDulnmp t4artoir iy1lmteaivi () rxmio3nu1lptemnvtas) Drr(  oo1oeto feildls2ul(vpnu0 ltrif3to1lpte ieol( trtoir3no1ome licsa() rrmum nu1aex  f3iysls rm(ms (0altrmfciodop rai i;(0sruoiopoo1llt  nctls s2rr(  nu0oetnio3iadfs umuvsnu)texnmf3tatop eln s;(0trtoiopiu1llt lfctasf 2trumpno4tpxnifciyt a2ean o (4alxomo oadfm elnvi () etr(mpno1amtnlnvsl(fs2uaurpnt4apxo f3iysfmDea(vo t)alerio tadomDr nei s)sruo(o iy4aleelfes s)s2ua( pnu0aee  f3iatfmDeluvp t4 etrxoctadfate ieol(0seto(o oydomeemict sf Dtr(rpou1open f3tadls rlump t)tltnir io1omtrluvilt)srtr(o3no4apt mieta()sDtrumpnu1tetnif3iysfaDumu p;()trxnif todlmDrauvo;t0 2xrxm nu4alen fvslt) rrr( onu4opxo i3iatlmDum(mont4arxrir totomtrlu ilt0s2toimpnu1omtemietltfsrrr(mpou0aptnmoeiadla2em(mo ()trxoiocoy1lm  ln i;t  etrxm nodllt licsa(f rrmur nt0tlt ifeiyd m ranvp t0 ltnxo ia1lpDrln s;t)t2urir3nu1op emfvias) 2tm( ont0optomi3ilt m2eluvo;t4aexrif tytlaDraivilt  ruoio nodalt mnvt t srur(mpno4tetoiociltfs2rm(vont) rermo3oytopD aueo;(0 2xoiopiodlmt mnvtls) 2um( poo1oex ifctydls2emnvp;(4teenif ia1om r nes;s)teurimpoo1al e nesa(  rrmx onu0tlx  o3iydfs ua(vo;u0 rtnir3to1opDr n s;t srxmir nydlmtn ivi ()aDrm( oot0ope ifciltfaDuau onu4 etrxfciytlm  an slt)trurxr io1lp  mies t)s2urx pnu1tleomi3iyd m uln o;u4areoxo oodfpDelivilt)t2tr(m nu4omt lfct sf rumum nu0apt  ietaslmDemumo (4 rxoxf iotomtrlnvols0trxoxo3iu4optemieils sDrmxm nu1aptnii3tltfm ul(mo u0tetnio oodlpDranesl(  rxoxrpnodlle  ncsl()arrmxr no0aeenifetatlsDra(mo u0trenmr3tatomDe nvils0sexo(r iy4llt lfvil( s2urx pnt1aee iietyt s rln s;u4aeenmrcta1lpD lnvs;(0setrxmpny1al  mfvt ()srrau oot4optnmo3iaslm2ulu o t4aexrmf oytlmDranesls) euriopiu1op nlnvias)a2um(m ;o0aetomociydls2umu s u4trtrir3iadomtrlnvo s sexmirpiodom e fcia( s2tru  ;u4oeen ictltfm ea(mont)trenmf tydfa r uei;(0t2uo(mpiu1ame  fct s  rtaxr nu4tltomfciadfm em(vsn(0artoir ty1fmDr n o;s)trumxo3nu1lp nlfvtatf 2trx pnt0apxo fctys m2rlums t4teermo3ootfptelivslt) ruo(opnudal  mfvsas) rtrxr nt1texoiieias aDumuvs t0 etoir3oo1fa eanvilt srxrxm3nodop e ici (fsrtm( poo0oexnifciys s rau pnu4aeeoxf3iodlm   nvo ()srxmxm oodll  lnvs ()sDuaxm nu4tlenmiciadlmDemu ont4trtomr ta1om   uvils)srtoim3no1omtnlnei (farra(rp;u0oeen f3tldfa2uauvo;u4arxoxo iatlm  lnvi;()trxm(rpoy4am  lnetasfsrraum nt4olto icild s2rauvpnt0 rxrxf ia1omte ivo;s  rtm(r3ou1llt  icta(f rra(r ot0openifctadls rluvon(4 rermfciatlateaneilt0t2trir iy4amt  ivils)s2urum nu0optnmo3iaslmDrmnvpn(4trtnmf oo1fa rlueo;(0 2xo(rpiy1lptnmfvslt)a2trx  ;o1tlenio3iytfa2eluvsn(0arenir3iatlatr n s;t0 rxr(m3nydom e nvslt)s2uaump;u4apenifeiasfaDelumo u)arenmo iatoa rluvi ( texoim ny1oltnlfcia()aDrr(rpnu4tpt mieildlm2emu p;()aexrif oy1fm  ln s;s0t2um(m oy4optn ivilt) rtmurpno4tlt ifetas a ra( s;u4teerir3iytfat  ivol( t2to(r oudop  lnciat srtmxm ;t4ole mfeiad s2umnvs (0aetoir3oa1fa eaivo s)srxmio oodopenmiet ( s2uax ono4optnioeiatla2rl(mp t4arxrxociytlpt auvils setoxopnu1lm n nct s)sDrmxrpou4texnmociydfa2rmuvo u4tltnxr3iy1omDrlivi ( teumxm3nu4ole mnvtlsf rrr(r ou4altomf3tld sDumnvp;(4aetnmr iydoatranvi;t sruo(r3nydam   nvi t)srum(r ;u0tpt  fctlt m eauvon()aexoio oadfm   nvs s  exoxo oodlp emnetltf rtmumo;o4tlt ioeias m eaumsnu4tetnmr3iodlpt  ies;s)tetoim3nu4ol   neta(f Drr(mooo1apeo ictatls2ranmpnu4 rerio ia1fatelivol() rxoxopnu4optnlfvil()srum(mo;o4oeenmi3iaslaDel( pnu) etnxr3iydfptraivo;t0 2xr(opiy1oltemiei t)s2umxr oo1aexnmieildfa2rmumont0tlxoxf oydla e uvslt0 2xo(opiudaleelicsas) rta(  nu1alt iiciad a2ea( s;t4teerxf tadfatrlu s s0tetrxr nodalt licsa()aDtr(r nt0tetn o3iytlm2emn p t0trtomo oy1oa   uvi ( trumir3nudlp nmfetl(  Drmu pnt1tlx iicilsfmDea( p;t0trenircty1omD aies s) 2uoxm3oy4ll e ncil(  2rrx pot1tlxnmf3iadfaDeanmo (0 reomf3ty1optrln s () 2umxm iu4oltelicils) Dtmxmp;t0tle  f3iad m2raumo;t4trxrirctadopDr n o;t) ruoxmpiy1optn nei (  rrru  ;t1texnmociys mDel( p u4tlxrmr3iy1fm  li olt s2uoim3oo1ol e icsat a2tm(root1tlen f3tltla2em( pnu0 rxomr iydfaDranes s)teto(r3iu1ap  mfct t sDum(  ;o1opxnmi3iltfm2el(vo;u)artnmrcoadlmt aivo;t trtoxm3nu1am emfcsat)sDtru ooo4tlxo icias a uln o ()trenir iodlaD aneslt)t2tm(m3ou1amenlncta()a2umxmont1oeto f3iyslm eanvo;t)alxnmrctydomt ai i;t0trtrir oo1lmtemncsa( artm( p;t1tetomietltfa2um( sn()artnmf tadfaDr neo s0tetrxr ou1lme  fcsa( a2umx p;o0apt  oeiyt s2ra(vo;t)tlxoif3oa1lp   i o s0 rtoxmpiydllt lici (f 2rau ono0tleoio3iadfs2uln o (0trxoxo todlpDeli sls sexr(o ou1omt lfcsa()srua(rp;t1tlt ii3tasfsDumu p (4 rermr oo1oaDr u sls teuoio3ny1ole  ies sfsDta(ront1olenio3tlsfm2ean s t0alxomr3oodom ran i;()teto(m3nodalt  ietlt)aDur(m nt0ope ii3ilt mDumuvsn(0 rtrio3tadlp rauvs (0trurxo nydam nmiviat srur(rono4texo feiad a2umuvs t4 rtrmr oy1fpDelu ol(0 ruoxo3io1al emnvt s  ruau ooo4tlxnmictasla2umuvo u0 ltomf3iytop  luvs (0 eurir3nydlmenlivilt)s2raump;o4oeenmfctat mDel( p u4trenir3oatla eai s;(  ruo(m3iy1openlnctls) 2tmur ;t0teeoiiciyd aDemnmsnu)aetnxociatopt aivsls)trumxr3iudaltemivtlt artmxroou4opx mf3iasla2eauvsnt4 exrxf3ta1fpteaivs;s)tetmio3ou1alen ncs s  Dtaump;t4apen i3tydlm rlu o u)arxoiociadoa raivsls s2uo(rpoy1omt miciatfartaxmp;t0tpxnmo3iyt sDrlnmo;t4 rxnio tadfa elieols trxmim3ny4lp e neilt srta(r oo4oeenmfeilt s ea(vs t0altoxf oydfpD anvols  2to(r nu1ap  mnei ( sDrau  no4opt io3ilt m2elnmp;u4 etrio3iodop rlies t)sexriopnu4olte ncsas) 2tm(ro;t4aleomo3iyd a2uanvs t)teeoircoydop   ueo s0texr(o3iu4ol e ieilsfs2uax pnu1optomfeiltfaDeluvs t0aexrif ia1fpD au ils texr(opnodlpenlnvsa(fa2raxr ou1apxnii3ild a em( o;u4tetoxr3io1fpte ivs;s0t2tmxmpnodaltn icsl() Dra(m oo1aptnii3ilslaDuluvs t4aexnxo3oytlmDrlnes;s s2tmiopiudlp elivils) Dtmxrpno1tpeoiieiadlm2rmnmo;t) etoifctadlateauvi;t  2uo(rpnudlptn fcslt)sDraumooo4aetnmf3iatlm umn s;u4 rermr3iotomt luesl(0seurxm oodapen fcsasfsDrr(monu1ape  ieias a2uanvp (0 exnio3tadfmt an o (0 rxoim3iydll e fviltfs2uaxm nt1tlenmo3iadfa ulnmonu4trermr3oytoaDeai s;t srtmxo iu1open ies t srumurp;u4tpenmiciatfm emumo;u4 eerxoctatlpD li sls) etoxm iodlm  lfet s) rrmx p;t0tpxoio3tad m2ulu p;(0aeerir oytoptr uvi;t  2umxmpiy4apt lnes tfa2tm(moot1tlxo fctadla emnmo (0arxnmfcio1omD lu s s0trtrirpnydlpee nciltfsDumx o;t0texnmieiltfmDelnvo u) etoir tytoptraivo ()srtmxrpou4olt lnci s)s2trurooo4opto f3iys s ranmp u4tlxnxoctydlm elnvi t  exoxo no1ap  mies tfartmuro;o1oet mi3tys a2ulnvp (4texnif3oatfmDe ueol()s2toim3nydaptelnetlsfa2ua(mo;o4texo ieiadfs2ulumsnu)trxnif iadfatraivi t  rtoimpiy1olenmiesat a2trx  ou4tee  ocias s umumo;t0alxrmo iotfmDe ies s  2xoxopno1ole lietl(f Dumu  nu0opt mieiyslm2um(ms;t4 ltnmr3oo1fpDr uvo;t0srtmxm ny1om e neslt srtr(r ;u0apx io3tytfa ul( s;t) rxnxo3iotlmte i o;s0texm(o nydopte nvt t artrxmoot4aleomi3ias s2elnms;t) rxnxocoatfm r i olt trxo(mpoo1ol elnvi t  Dtm( p;o1opxo iciysfa2umu s;u0trxoxo3to1op rau ols0 rxoxo iu4alee iesa( srraxrpnt1tee moctydla2el(mo;u4 eeomr ia1fp elueilt srxr(m ou4ole lfcs ()s2rr( o;o0tle moeiat a2eanms u0alxnxfcio1fmtr uvs;t0 rurimpoy1opeemici ()a2tmxmono1alen i3iytfmDra( o u4trxnxfcty1lat lu i s  2xoxr oydlpenmnctl( aDurxr ;o4aeto fetadlsDuln o u)areomo3ta1fp eau ol() etrim3oy1open fvsa(fa2tr(rp;o4opeomi3iydlsDrm(mo;u4teenmocta1opDrluvi;s0 rtr(m nu4lmte fvil()aDtrxrpoo4tpen ociadlm ranmsn(0 exrirciydla eaivi;( sruo(mpou4am  lfeil()a2ua( pou4tlto ictad sDem(vs () ltrirciadoptrli il(0 exmxm nudlp   ncsasfsrumx pot0tpeniictlt s ranvo;t) rxomf iatfmD ai s;( setoxopoodomtelfciat)srtm(mont1tlenio3iytfmDra( s;t0 eenmfcto1oateanei;s  2umirpiu1llt mfvils srrrx pou1aptoioeiydlm2umnmp;u0aleomf io1lpDelnvi;t) euoxm3nudapt  ivi ()aDra(mpot1alxnmictadfmDrm(vsnu4trtnir oydoa elneo s  2xmxmpou4oltnlnci () 2uaxr ou4oet moeiyd mDeanms;(0arerxrctatoateaivils)t2umxm3oodap  mivs (f Drr(r ou4alt  ictad s eluvo () leoif3oydfatrlneo s)setoim nu1lm   ivs s)a2urumono0oltnio3tlsla2rauvs;u4 ltoif3tadlmt  ieslt0texoim oydoleemnvslsfaDtmump;u4olx ioctyd mDul(vpnu4trtoxrcoatfpD  ieols tetm(m ou1am   fcs ()aDrru o;t1tpe  feils a rau p (4tetrmfctydom   nvsls teuoim3oy1lmtnlici tfaDua(mp;u1tee iieilt m rmumont)texrxrcta1oaDe uvo;t s2xrimpnodale mici (  Drm(mp;t4oetomi3iadfm2rmn s u4aetnxrctytfmtr i i s)srtoiopiodom   nvtltfsDrrxrp;t4tpx  i3iaslaDulnmo u0aexomf3iy1oa   uvi;s trxoxrpoo1lm n fvi s sDum(  oo1tetomo3iasfa2eanmp u0tlermo tydfaD li ols  2uoxopoy1lm  lnctls)s2rmuro;o4tpxo ictys s ulu p;t4tetrxociy1laDeluei;t0 2tr(o nu4omt lietl(fsrurum ou1teeomociltlaDemnmpn(4texnif3io1opDrluvo;(0 2um(o3iy4lpen iei ()srrm(rooo0tex iictytls ulump;(4aexnir todlm  aieo;()srxmxrpny4opt lfet t srumxrono1aptnif3tyt mDuanms (0 ltoxfcio1fa e uvo s0srtoirpiudale livt tfartax poo4tptomictas m rmumont) rxoxf oy1latrlueol(0texoxr oy1al emnvsa() Dumxmono4ope mfeilt aDel(vs t0aetoio totlp  lnvs;t0teuo(mpnu4omtemnct (fsDraumpou1opxn octaslaDem(monu)tlerxf tytlm e nvi;(0srxm(r3ny1lptemictltfartr(rpoo1altnmieiytfm emumo;(0 reoir oadoaDr ieols srurir3iu4lptnmnvt t) 2rrurpot0aetoif3ias m2ra( p;(0altnmr oy1fmt ln i;t)srtm(rpoo1lmtemfvias a2ra(rono4ape micildlm umuvsnt0tltrir3iytlpDran s;s) exm(mpny1opt  fvsl( a2trxmpnt0aexoiietydls um(vpnu)tltnxo iatopDrlueo;t)tetrio3iodlmtnlietl(fa2ra(mp;o0opeo ociyd mDra( on(4aexnxf3iatopDr ueo;()sexo(r3ou1olt lfviltfsrua(mpnt0opx  oetls a elump;(4trtoif iatfaD anesls seuoir iu4opt mfcias) Dtru  ;u1tpe  ieiatfm rm( o (0tlenxo3oodoat anvolt s2tr(opno4lltemnvsas)srrmurono1teen fctysfa ul( o t0 leoifcoatop  aueo t)seurim3nudal nlietlt)arrmu oot4openmfeilt m2uluvo u0 exrmfcoo1fatran s ( s2xo(o ny4ameelfctat aDuaxm oo4opx ioeiatfmDem(vo;t)arxoxo iatlp raueilt)srur(m3iu4ap elnei s) 2umu  ;o1aptomfetlt s umuvsn(4tetrmf3tydopteai s t  2xr(m3iy4lmt  fei s arua(m oo4opt mf3iyt a2elu ont4tlxomo oatlaDr ueo;()seuo(m iy1amte fvtat  2rauro;o0apxn o3ild sDelu s;(4tlenio oa1lmDr u i t srtoir3iydaptelfvi s) 2umx  nt0texoifcildlm em(monu4 exomo3tadlpD  ieo (  2xoim3io4ameelicils srtaum no1aetomf3tat m2eanvon()texomf3tytlm rln s s t2xm(mpny4apte ici ()artr(mp;t4aptnif3iad sDrmu pnu4arxoxo oydoa eauvo (  2xm(o3iu4al emfvil()aDrr(mono1olt if3iytla2ua(msnu4aetnmr3iydlpD livi;s)srxm(rpno4lmeelivs sf 2rr( o;o0tpxo f3iys s ean p u4aetoxr3todla eai slt0t2umimpnu4lltnlncs (f rua(mpoo0olxnifetysls2uauvp t) eeoirciydfpDeln o;( srtrio3oudlpe lnct t)a2umx p;u0aeto ieiyd mDrlu o u)aleoxo3tytfmtr i s;s0teumimpiy1openmivt ()srtaxmooo4aexo octytfsDemnvsnu0 rxnmf todlmDelneo s0teuoir3iodlp nlncs s sDurxmonu1oee if3tat m ea( s (4tetnxo3tatfm ranvi;(0 rxmim3ny1lmenmfcilt a2rrxmo;o1aptn o3iydfmDran o u0altnmo3io1laDranvsl(0 2xrio3iudopeemfesas)aDtauro;u4oexoifciydlm eauvp u)trtnxf3iadlmte iei;(0t2xmxm iy4lp  mivi t  rrrumo;u4apxomo3tlt mDua( on(0 ltomo3totfpDran ils)t2trxmpoydoptemnvtlt)aDtrxrp;o1tee io3tldfs2rmuvonu)arxnxf oa1opteau olt)srto(r ou4al nmietasf 2tr(rp;t1tet mf3ias a eln p;(0texoxfcoa1lmt lieo;s) rxmio3iy4apte iesl()a2rmxmp;t4tpxomfeiysfm2ul(mp t4trerxr3totom  lieol(0 eum(m3iudlme  ici ( a2um(mpnt4aee mo3iadfa2eanmpnu4arermf3tatfm raivi ()sexoxo3nudal nlncil() Dtmx  ;o4olxnif3iys s2ra( p t0aexnmf tadfmt ln o;t)teumxrpnydlpe mneil( aDtm( p;t0oex if3ild s2ul( pnu0 lxrmocoa1lpDeaivo;t s2tmimpou1ol n nvtat  Drax pot1aleomfctytfs2eaums () ltoir3todopt  ivs;s t2trir3iudoptnmiet s) 2raxront4olenmo3iatlm ranmpnu0artrmo3iydomtr ivi;s trtrxm3ou4al emiet s  rtm(mpou0olt ifeiasla2rau o u4 renmociatlptrli s t0tetoim ou4lmeemncs t)s2rmxmoou4oltoio3iytls2ea(vs;t0aeeoxf3to1op  li s;s  2xmxmpoo4optemfvil( sDra(mo;u0olx  f3ias aDean o;(4 etnmo3totopD aivs ()trurirpny1lptemfct tfa2taurpno0tptnio3iytla2rm(vp;(4 rtoif3tatla  anvils0trumxo3iodlm   ici s artmx oot4opx ii3ild s2um( s;t)tetoxf3todlmt ai o;s0setrxrpny1omeelivil(fartaxrono0aleomf3iasls2rl(vo t0artrif totlmD  uvs t0s2um(o3nu1opee iesl(faDtr(monu1olxnmociyd s2elnms (0 rtomf3ootomt luvo (0trumirpou4llt mncsa() 2tm(mp;u1ale io3tys a2eaumont0tlxoxo ta1oaD lnvi;s  2xmxopnu4alenmnvsl() Dumu pot0optomoctltlaDumnvsnt0tltoxoctodfm  lu o s  2urxmpiudlp emnetls  Dtrump;t0altn f3ilt sDumu o (4 lenmf oo1omteluei s  rur(m3iodlmt lnetl(fa2tmxmpnu1optn f3iydla emnvp ()areoif3oadoaDe ieolt t2toim nydalenlivsa() 2urur oo1aleo icilsfs ranvp (0areomf3oydlmtrlnei (0 rtmimpio1om  lfcia(faDrmx pot1aexnmfetlsfa2elu snu)aexoxo3oytop   nvs t  rxmir ou1lle lfct (fartm(r ;o4olx  iciltfs rluvonu)trermf3ia1oaDelnvi;s  euoxr ou4opeelnes tfa2raur ;u0aptoii3tydfm rmu o u0 renmrcto1omDr ivo (0teum(mpiodlmt lfes s s2ua(mooo4tleomi3ils a2um( o u0 lenmfctodfmD auvsls trtmxm nu1ol
\ No newline at end of file
@@ -0,0 +1 @@
+n slt0trurirpiy1lltnlivil()sDrmum nt4oleo oeiad mDemnvs;t4aexomfciydfptrlnes;s0texoxm ny4om nlfeia(fa2umxr ;u4optnmi3tatlsDean p t4trxnxo iotomte i o;t  exrxm ou1lpe  netls  Dur(mpnt0aetoiieiys s2rmu s t)teenmr oadop eluvo ()srxm(o iu4amte nvtas)srtrx oot0opxoii3tasls umn p () rxnir3iatlat  uvilt) rtmimpoudaptn iei tf rrmx o;t1alt  f3iltla2elnms (4arxrmfciy1fpte n o;t0s2xmxo oo4al   feslsf 2rrur oo4tet  ociyd mDrlu onu4texnmocoatlp r uvs;s  rurxm3iu4lp nliei sfs2tr(ronu1aetn ietytls2elu o (0trxrir tadfmDeaivil() etoxr iudal nmivias sDum(  ;o0tpx ii3tys a2umuvp;u4texnmrciatoat ln s;()tetoxm3nodlmenmncta(f Drrumo;u0opx mfeiytfs2ulnvonu0arxomfcia1optr uvs s0trtmim3ny4aptn nei sfaDuaur nu1altoif3tls mDelnvonu)teenmrctadlmt luvi;t0srum(r3oodapee icsat  Dtr(r ;t4ape mi3iltfm uanmpnu4tetnircoadop r ueo s) eumir ny4lmtn fcsas arrax pno0aexomo3iatlm ranvo;u4trtoxr3iodfmteaivo;(0t2um(rpiu4lltn ivt s a2rmu pno4oex  feiadla2rluvpnt0tlerxo3oodlmD ln s;(  eumir3oodlmtnmfeiat  Dum(m ou1aetnio3tydlm2uan s;t4 eenmf3tytfp e ivilt0srumxr ny4op  mfesls srrau  oo4tpe ioeias aDrmumo;u0 ltoio iodfmDrauei;t t2xoxo nu4aleemicsltf rur(monu1altnii3tadfm eluvonu0teerifcoytfptelneil(  2ur(m3iu1opt  iesat sDur(m ;u0tlenifcils a rln ont)alxnmrciodlm r n o;t)srtrxmpiy4ol emfvilt)s2ur(mono0alenmieiytfm2ea(ms;t)trtoxf ty1op elueo;s0s2uoxopiu1lltnmfvia(f rua(monu0olxnii3ilt s2em(vp (4aleomfcoydomt lnvi t srum(o3no4olen nctas aDrrumpnt4apx  feiatls elnvon()artnmfcty1oa e uvo t)t2xmir3iu1lleelici (fsDta(rpot4aee mf3tys m rm(vs ()aexnir oo1omD lneo;t) 2to(m3iy1aptnlfci (fa2ra( oou4oee  o3iytfmDeln sn()texrmfciy1lpt lnvs ( s2um(r no4oltemncs sfs2raumonu0tetn f3iltla2ulnms;(4 reoxo3iatlaDelieo (  rxrxm3ou1amtn feils)s2ua( pnu4tleoifctldlsDulnvo;u4arxomoctydlp  aneil(0 2xrxr oy1lmeemicil()s2ua(monu4tlxo ocild s eauvo t)altnmf3oodfp   n s s) 2xo(o3iu4amenmfcilt)aDrr(  oo1alen o3iys aDrl( o t0 rtnxr oytlm elueslt0 rxr(m ny4lpenlivta()srta(mpou0tlxoiicilt s2uauvpnu0 rxrio3oy1fp eaues t0trurxo ny4lm  lies ( aruaumooo1texn ictysfa2rluvp t0tlxrio3iodom rln slt  2tm(rpoo4op nmfvi s  Dua( onu1tetnmoctytls2eanvpnu4arxoxr io1lpDranei t0 2uo(o ny1lmee fvsasfarurumont0oetnmicilsla uanvo;t)aeermf iotoaD ai i t0t2xrxm no1lmenmfvsls s2taur nt0open fctat sDrluvsn(0tltoxr tatlpDelu slt)srxrxr io4lltnmncilt  2tru pou4alt  feilt s2rmnmsn(4 lxoir3to1lp elu olt  eto(o3nodomtn netls) Drm( ono4aee if3iadls rl( o;u4 rxnmo tadlmDrlnvs s  2umxm oo4opt mnes ( srtm( pot1apx mf3ilsla2rl(von(4 lxoif3io1lat luvils trxoirpno4lp nmfvias  Dtax  nt4oex mfciatfsDeauvs;u) lenmf tytoa ranvi ( t2xrir3oodom   ict tf 2raxm ;u4tlxnmieilsls2rmump ()aetriociydop eauvi;s texoxm ny4llt  nvslsfaruau ont0tpen o3iydfm ul(monu4tlxnxf3ta1fateanvs;(  rur(o3iydlptnlfvt sfs2rmu ont4texnifeiat m eauvs u)tlxnmo iodopte ieo t srto(r oydole  fvta(f Dtr(rp;u0aexo fciaslm rm(vs t4tetnmrcia1lp  li o;()trxmxopiydlp   nci s  rtax o;o4olx mf3iydfs2rm(mo;t) rxrif tatlaDe uvi ( t2ur(o3nydlm   nvil(  rtm(mpno0olt  oeiytlaDum( s;t)trtnio3iotfpte i ol(0s2tr(m iu1alenmivi s)sDtmum ou1openiocias aDem(vo t0artrxo3ia1fa   i sl( trtoxr3oy1lpenlnvia(fsDtr(mp;t1aex mi3iytfa2emuvo;()aetnmf oo1faDrai s;s)sexm(o nodaptnmfvsltfsDum( oou0tpenif3tlt m rlnmo;(0trerxocoydfpDraueilt)truo(r oo4llenmieiltf Draxr ot0alxoifeiltlmDulnmpnu0 renifctatopteai ilt)t2uo(opio4om  lietl(  Drr(r ;u4tex ii3tat s2ra(mp u0 etnio3ta1lptraiei;s0t2xoir3ny1alen ictatfaDrrum ;o0oexnmictyt m2uanmp u) eenmrcoatfmDe u i s)tetoxo3nodaptnmfvtasfsrrrxmo;o0oetn oeiydla eluvon(4tlenif to1oa ean s;s srxm(m3ny4alt  feiat arum(mpnt1alxniictytfaDum(mpnu)texomocoytfpD  uvs t0 rtm(rpoodape mneil() rtr(mont1aptomocildlsDel(mp;u0trtrir3tadoa eli i;t0t2to(mpnydlp emnes ( aDrr( o;t0texnmi3ias a eanmsnu)arerio3iotopDrluvols  2xo(rpoy4ol elfesat) rur(ro;u4oexn oeiytfmDeauvpn() lerirctydoa eli s;s  rxr(o nudlm   iei sf Drr(  ;t0tex  fciydfs rauvo ()texrifciytfa e u i;( truoxo no4omtnmfeilt sDta(mpnt0apen i3iasfm eluvp t)aeenif3iotfat aieols trurxr3iu1ol   ivs ( artmxmpou0tlenmi3tlsla emn pn(4 eenxf3oo1opt aueslt)s2xr(r ou4omeemfcia(fs2rm(rpnt1openmf3tadlmDrmnmon(4 renxr3totoptr n o;t s2xoir iy4ap nmfvtas) 2rmu pnu4tet iietltfsDeauvo;u4tltrir3iytom eluvo;s) rtm(rpou1alte fetls)sDra(monu0tlt io3iad s2umumsnt4altrxrcta1fpt  nes;(0t2um(rpiydlmeemneta()sDtrumooo1oltomoeilt aDua( onu) ltoio oatoa r nvsl(0teumio3iy4lle mfei s) 2tm(  ot1opt mfetatlsDea(vp (4 reriocoydlmt aieols0t2trim ou4omt mivt s  Dum( pot1oetoiictlslaDrm( snu)tltnio3ty1fa rlues;( sexo(r3oo1oltnmnesls) Dumxm oo4aexnifeild s eluvp;t0altoxf3iy1fp r ieo;t t2trirpiu1lp   fcils)sDumxmoou0aptoif3tysfmDra(vpn(0tltriocootop  liesl()t2urxrpoydaptn ici t a2tmurpnt4apxo ociysfm rauvpnt0arxomfcoytoa rai olt)t2tm(r3iydoptn icta() rtmx onu1apt ifeiasfsDrl( s t0aexrifcoytlmDrlieols0 2xoir3nydllee ietls)arumurpou0apeomociatfa rl(mp;(4tlxrio iodlp rliesls)setm(opio1ll nlfeil( s2urumooo4aeto octat sDra(vo;()trenir3ta1lpte nes (0setm(o3oydlm  mnei t artax o;t0tltn ociatfa2rm( s;() exrio ty1oatrlnes;()srto(r3iodlm   icsasfsrra(rooo4tpxnioetys sDran snu4trtrmrcty1laD lnvs s t2umir oo1lmtnmfvt sfs2tr(mpnt0oetn f3tysfmDrlu o;t)artoxr io1oa  anvo t)trxo(o nydamtnlnvils) Duau ono1apeo f3tysfa2rmnmo;()arxomfciadfaD lnes s  rtr(r iodll  mncs (  2umxrp;t4apx  oetlsls2elu p;(4trerxf3oa1op r ieils) rtr(r3oo1ll elnvils)aDtm( p;o0olxo o3ils a2ua(vpnt0tlxnxf oydlp   u i;s)trtrio3nodoltnmivi t arurxmooo1alxnmieiyslm rmu snt) rxnif iodoate n ils0s2tmir nu1oltn ncslt s2rmurpno0alx ioeiaslm2umnvsnt0 rtnirciatom e iesl(0t2uo(o3oo1opeelietls)a2tmurooo0tlxomfeiltls2rmn snt0altrxr3iadlpt lieo;t) rxm(o3oydomtelivt (fs2taurpno4texnmi3ils a ulnvp t)aleoifciodlatrauvslt) etr(m io1ap e feta()artm(  ;o1tlt mo3iytlaDrmu o;t0tltnxf3totoatelieo s  2um(rpoo1altnlfvsat s2rrumpno1aexoii3ilsla uanvsn(0trtoio3iatoateaueo s seum(o3iy1aptemnvsls)aruru o;o4oetomo3tydfsDemnmpnu)tlxrioctotfmtr neol()sexrio3nu1olte nvtls) rtmxro;o1teeo feiyt s um(mp (0 eeniocoo1latr u i;t0 2urxmpiodamtelivil(fsDurxmpnt1aetniiciydlmDua(vo (0tlenmo3iy1op   ieols)srtrxm3nu1lp  lfeilsfsDrax  oo0oeeoioeildla2ra( o;()treoir oo1fmD  neo t texm(rpnudapenmnet s)aDrrurpno0alt mictltfs rl(mp u) eerif oatlmteau slt trtrim3iy1optn nes t)aDtm(r nu0ole ifeild s2umu o (0treoxocia1fp e nvils0 2xmxo oydopte fviatfaDurumont4olen ietlsla2rmump;(0 ltoio iytlpDeai s ()s2xmxrpoo4ameeliei s)aDurumpoo0tltnmiciasfm2ulu pnt0altrmo3oa1fp   u sls) exmxo iudapeelnctl(faruru onu4opx  o3iyd s2eluvo t) rtnmrciydlpD  nvo ()seuoimpoudamte fcsls)sDum( p;t4oetoii3iyd a2rmn p t4 leoiociadoa  ai o;(0sexmirpoydam e nctlsfsDra( o;u4alx iieilsfsDul(msnt0texrmocoy1fmteli s s t2umxrpoo1ol  mieiatfsrrmxmpot4tlen oetyt m2ea(mo;u4trxnxo3todlaDr ivs s  2umxo iodlpeelicslsf Dtau pnu1alenifciys a uaumpnt)artoifctytlp elivo;s)t2umir3iodaptnmfesas) 2umumoot4alx mictlt a2ua(vp;(0aeeoxf oy1lmDean sl(0sexmxm3iu1apenmnctl(fsDtm(mp;u0aex mfctadlaDrm( sn(0treoxoctotlpt livolt srtm(rpoo1lleelnvsas srtr(r ;u4oexo oetas m2umnvonu4 rxrio3oatfat auvslt  exrir nydlm e iesa(fsDtaumpou0aeeoii3iyslm el(mp (0 etomf oo1op eanei t)trxmio no4omtnlicsat aDra(mpno1aet mfctltls2emums;()trenxfciatla rau o (0srto(o ny4ap e fvs s)s2tm(r nu4ale moetld sDemuvs t)aeenxr3iytfaD  n o s0t2trim iy4llt lnct (f Duru  nu0tpxomoetaslsDrlu pnu4texrifcio1fmDeauvs;(0 rur(o ou4lpe  feil( sDuaumonu0texoii3iydlm uauvpnt0trtrmf iodfm  aieils  rxrir io1ale lnvs tf rtmx o;t0aet ii3iytlm2rln onu4 rermociadoaD  i o;t s2to(r3ou4aptnmfes ()artrxrpou0oex if3tltla rln on(0altrirciydop elivo t) 2umir ny4apenmfet (  2raxmono4alto fctasfmDul(mo ()aexnxf3io1fmt aivols)tetr(opnu1lpenlfcsas aDuaumono4optnmo3tlt sDulu p u0 lxnmr3oytoa  auvi;()s2uoiopio4al  lfvsatfsrrrxr oo4aeenifeiltfs em( o;(4 rxomf3iotfpte n sl()seum(m3iy4lm nlfet t)s2umum ou4apx  ictad s ran onu)tlxoir ty1op r nvs (0sexmir3iu1ol   nvi ( arrmu pnt0apxoif3tatfm rm(vs t0 eenif3iatoptr i i s)t2xmim3iudam nmietl() rtm( oot4ope  oeiat a2rmnvs;u) eeomo3iydlptrlivo s  eumio iydop   nci (  2rrxrpou1aex ioeiadla2elumo t0texnir3iy1faDeln i;t  2xmxo3iu1amenlfvt sf 2trxm nt0texo fctls a ulums t0altnmo3ta1lat  u ils  2trxm ny4lpen nvi t a2rmxr ;t1teto fctadla ulumo t0 eerxo iytoaDrauesl()trurirpny4lptemfcs sf ruaumoou0tlen ieild a2rau o;t)arxrxo oadlpteaiei;s)texrxo iy4alenlies s  rurxmpnu1ope if3iadls2ranvont0tltnxoctadfptran s t0seurir3ou1olt lnei tf Dumum ;u4texomf3tasla2eluvp;(4tleomrctydomD  nesls)trtoxmpoy1altn ivsat s2rru ono4olen o3iyslsDulums;(0aetnif3iytlpDr ivsl()tetoio oy4omee fcs ()a2umuro;o0oet ifciadfm2rmnvs (4 rxoxr tatoatrluvsls) rxmir3iu1lleemici t  rrr(  ;u1tptnmo3iat mDelnvs u4alxoxocta1fa  an o s)setmimpny4lp n ivi sf 2ra(  oo4oeeoii3iatla2um(vp;t0 reoxocootlm e i i t t2uoxmpio1llt  ieil(fsrrr(ront1alxoifctytfmDemuvo t0artnxf3iotlp e nvs;t  exmiopoodomeemfvt sfarrrxm nu1tltniieiysfa emu s t)tlxoxr3oytom  luvs;s)texrirpoodlptemiei t) rtm(rpot0ole  oeiatfaDrmums;u0alxomocoo1fmDrau s ( s2tmir iudomee fetltfa2ur(mooo0aexnii3ilsfs2rm(vont4aetnmf3iy1omDraivs ()s2xo(m3iy4lptn fes ()arta(m oo4oeenmietydfsDeaumsnt)aetomocoytoatr uvi;t0teuo(opoudamtn fcils) rtmxr no0aleomo3tad mDrmu p t)teenmf3iytfa e ivsl(0setriopnodome mnctltfsrrmumoot0apeoiiciasfm eau onu0artnmfcoytlat aiei t t2toir iodlp  livsls)aDtaxrooo1oetoif3ildlm um(vp;t)texrio3iadopDr ivs ()tetm(m3nydam n fes tf Dua(rooo1tee mf3tldfmDua(vo t0 etnmr todfmDrln i (0 exoim3io1lp e fet tf Draur ;o4oeto oeildfm uluvs t4 rerxocoy1fp rlu i;( t2trxr no4omte fcsls  Dra( o;o4ope ifeils m2uauvp;u)artoiociy1faDeauvolt s2tr(opou1optnlnvia(  Drm( pnt1apx ioeiytlmDumnms u4 etnxr3oydlp rlueilt) euoio3ny1ol  lncs tfs2tr(r no0ole mfciatfs eln o;u4texnmoctydlm e ies;s0seuoirpoydlm  lnvsl(f Dur(mp;t1tetniietlt s rmnvpn(4trxnio oadfmt  uvols0s2xrxopoy4llt livi (fartrxmp;u4tpxo ictat m ulnvo;u0teerxo3iodlpDe uei;s0 rtoxo3iy4ale  neia(f 2rr(  nu1tlxnio3iasfmDem( o;() exrxrcoo1omt  u i s)s2tmxo nu1apenmieiasfsrra(r oo1tee iictyd a emnvo (4trerxr ty1lmDrauei;t truoimpiodope mnei s aDra(rp;o1opxoifctysfm2umumsnu0 rtrir3io1la  aivi;s)trxoio3iu4oltn ieiatfs2umxm ou1altnifeildla emnmon() exnxo3totoa r nei () 2tmirpoy4lme  nctls a2urur ;o0opxn ieiysfs2uluvs;(0aexoxo iodla   ieo;s0 euoxm3iy4ol  lnvsl( aDtrxm nu1tex moctysfa ulumpn()teeoxo tytomDe n i;s seto(mpnudam n ncil( s2umum ;o0olt  o3iytlm ea( p;t4tltrmf3iy1oatraiei s0s2umxm3nu1lmeemneias  Durx oou4tpxo ociys s rlnvont4altomo3ootopDe u o;t trxrxrpoo1al   ici tfsDum(mpnt4oetn i3tytfsDranms t4tlenio3ootfa eaieolt0teto(mpny4lpe lfcsat srrmxmooo1openiiciysfa ea( onu4 reoxr iadomte i i s)srxr(o3oo4omtnmfctlt s2tmxm nu1opx  o3iadfs2rauvp;t)tlxnmrcta1oaD aneslt s2xm(opnudam  mfcsas arumxm ;t4oeeo ociyslaDemump;()aexnxr iatfm r uvi;t0trumio nudamtemfet (farrm(mpnu4aexo 
\ No newline at end of file
@@ -0,0 +1 @@
+nvi t  rtm(r oy4alt lietl( srtaum oo4aex ifciatls um(vont)artrxo3to1la rai o ()seuo(o3ny1lpeemncsl() Drr(roou1apx miciaslm2rm(mp;u0 lxnmr ty1faD anvi;t0sexrxo iy1om  mnvsa()aDrmx p;t0oeto oeilslmDumnvs u4trxrmrciadfpt  u o () 2xrio iudole livi tfa2ua(m nt4oleomieiydlm2rlnvpnt) lerxfcoydomDe u sl( srumxm oo1apt  ici () Drru o;o0alto feils m2um(vo u4tlxnif3oy1oa elies t) exr(r ou4llenmfeta( s2rmum ;o1apxniiciaslaDua(mo u) rxnioctotlateanvo;(0 etoxo iy4ale mnvtasf 2rau ooo1aex if3iadfa ul(ms;()aexnmfcoydlmD livs ()t2toxmpnydopeemfvs t  2urumo;o4oeeo feiaslmDea( o u0 exomf oatfp   n i s0 eumxo oy4optn net t)aDtaumo;o4aeenmociysfsDran p u0arermf3tytlp r uei (0srxoxo3nydamt  feslt arurxmpno4aexoifciytfaDrm(ms t0 ltnifciatlmt aueols  etr(o3ny4op n nvilsfa2umxrpnu0apt if3tlslm ua(ms (4 rtoxfcoodomtrlnes;()trxmio3no1apenmivsasf Duaxmpno0aeeomi3tlt s2uluvs u4 ltnxf3oatfaDe uvols t2xmxm3oo4oltemivt t  rraum oo4oleomicils mDumuvs t0aeenmf iodlm rlu i;(  ruoxo iu1ol elnctat srra(root4tle moeildfa ra(mo u4 lxnxf3todfm eauvi;()tetoiopnodll   nvs s)s2trur ou0aptniieias m2eauvs t0aeeoxr oadfateln ilt0seuoxm3nu4lmt  ietasfsDrrx pnt0tpen iciadlaDel(mp;() rxrif iotfpDeaies s trur(o oodlptemici t)sDuru pnt1tleo i3iyd aDel(ms u4tlxomr3iodopt luvo s) etr(o oodam elnvs ( s2tmum oo1aeenio3iytls rlums;(4tlxrmrctotfmDelu ols  2umirpou4ol n iviasfarrr(rpot4alxo o3tadfs2ul(vo t)alxnmf oodomt au s;s0 rtrxr nudllt lfei tfaDum(ronu1olx  o3tadla umnmsnu0 eeomr iytlat  iei;s0 ruoio oydam n fcs () Dtmurpot1tpeo o3iasfs ulu pn(4 rtrmo iy1opteliei t sexrio3iydlptnlfct (  rurxmo;t1ope mfeiyslm2uanvo;(0artomoctytfmtr uvi;(  eurim nydoltnlicsls) Duaur nt1aex mfeiyd sDemuvont0trtrmo totom elnvs;(0tetmxo ou1al elfesl(f Dum(r no0opeomictlsfa2em( p u)trtoir tatfmDr i ilt0t2xm(opiu4omtelnctas sDta(roou4altnifeiyslm2ea(vp;()trtnmo3tydfpte uvi ( t2xoimpoudaltemneil() Drr(  ;t0oex  f3tlt a ul(vp;t4 lxnxf ty1fpt anvolt0 rtrxr ny1lp e nvilt artruro;t1opxn i3tydlm rluvp;t)arxnirciodopDeaiesls texr(mpiy4oleeliciasfsruaxmp;o1tet mo3iltfa rmnvont4trerxf3tytfaD  ivi;t0srxrxm3io4ale mnvt sf 2trumoot1aee  i3ilt a2umnvs;t)arxrmf3to1lp e nvs;(0teuoirpio4omt lncslsfsrraxr ;o1teen i3iltfm eauvsn()teerxf iodoptr n o;s) 2tmxmpnydllte iciat  rum(mpoo1apeo i3tltfmDel(mo;u4aeeomfcoatlpDelueo t s2umxmpoodoltnlicia() 2ua( o;u1aee  fciysfsDrluvsn(4 ltrmr3oadlpDe i o t)sruoxr3oy1omte fcs ()arrrxro;t4apxo oeiasfs ran onu0trxnir3ty1opDeln ol(0t2xr(m nodlltnlfcil() Drrxrpoo1optnmi3ilsfaDra( ont4trxnircio1fp e ivs s0s2tm(rpiudllenlnvta()s2tr(rpoo4oexnioctys sDelnvo;u)texrif3oo1lmt lueo;t)s2xr(r oy4apeemnes s sruaurp;u0tlx  icils m rm( p ()alxrio3oy1latrau s ( t2tmim iu1altnlnet t)s2uax o;u1altn o3iatfsDemn onu0 rtomf iatla ran sls srxrirpiu1lpt mneta( arrmx p;o4tee ioeilsfaDrl( p t0trxrmfcoa1faDeln o t0trxoir3oodop n fei sfs2ur(m oo4texo ieiadls2ea( p;t)tetniocoodfmtrluei s0s2toir nu4lpenlfct tfartmx pnt4tpto ieild a2ea(ms;(0 renxr oydlmt aivi ( srxm(o3oudlmt lneil()srrmx  ;o1tltoif3iysfm2rluvo (0treoiocoodfa   ieol() 2tr(mpio4lm  mnci s sDum(r oo4apx  ictlsla rl(vo ()alerxo3ia1fa eanvo;(  etm(mpnydol emncsat)aDraumo;o0alxnifciatla uauvp;(0 lxnxoctatlpt au ilt)t2xmirpny1omenlfeilt)s2ur(  ;t4texnmf3ilsfaDuanvp;t4aeeoxr oadlpDe ueil( t2ur(rpno4opte fct s) 2ur(rpou1tetoifetls sDum(mo (0 rtrirciatopD  ivs t t2uoxmpiu1am e fci t)arrmu pot0alt if3iasfaDrlnvo t0arxrxr3tydlp e i o;t0teuoxm3ny1ome  nctat srtm(ro;u0tlx iociys m umu p;(4arxrir tadoate i ol( seumim3iu1ole  nvta(fa2trxmpou0tpx ioeiys aDemumonu4artoif oadomt lneol(0 2xo(r io4op n ieia(  rurxmp;o0apeo o3iasfsDrlu s;u4arxoxo3iodlmDrlnvo;s  2to(opiu4apenlictat a2tr(rpoo0tpenifcilsfmDranvo;t0 ltnio oydlp   uvolt  2uo(r3oodomtnmici ()arrmu ono4tlxn fetysla em( pnu) reoif iodop raneo s sexo(o nu1optemietlsfsrurx  nt4apt mo3tysfa elu ont)texnio ty1fmDrlieo s) rurimpoudamt  nvil(fsrurx p;t0oex ifeiat mDelnms () ltnif3iy1lpDr ieo;t trto(rpnodomenmicsas)s2tmumonu0tpt iieiltfsDul( sn(4texnxocia1fpte ueo;s0t2uriopiudome mict t) 2uaxr oo0apen feild s2eanvo (4teenir tadomDrlues;s trto(m3iu1opt mnctat  rraumoou4opt  ieiltla2eanmo;(0tlerio tatlat  n s;s)trxrir3nodop  lnvsat  2um(r no4oexoifciadlaDeanmonu0 etnxr iodfpt an s;( s2xoim3iudap   ictas srtau o;t1altnmieiad mDuanvp (0teenifciotla raneo;t) rxr(opnudol nmivsatfsDuaurpnt0texnmiciys a2elums;(4 lxoir3totlm eauvo;t)s2uoxr iudamt mnctls) 2rm( pnt4tet  fcils aDrau p;u0trerxf3oytopDr ueslt0 etrio3ny4apt  ivt s)aDuru poo1aetnmfciltfm umnms;u)trtrir iy1fa  lneols)trxr(m3iydom e ivias) 2rmur oo4tlxn i3iys sDrlnmp;(4aexnxf3oo1fmte u sls) ruo(r3no1llenmnesa()arrr(mo;t0tpxnii3tltfmDrmuvp;u4aeenxf3todoaDeau s s)teuoxopou4ll  liet t) rrru o;o0olxnifciyd s2ulnmp;u4tetnxf3oadfmte nei;()t2umxmpoudalee fvta()sruru poo4tltomfeiasfa raump;()trtrmfcio1oa  lnei t0 rtmxrpno4lp   fcs s  Dua(mono0oexnioeiydfm2uauvo t0teeomrctytlptr ues s0 2to(o ou4lmt mnct (farrax pnt4apx  ietltfa rl( ont0tltnirciytlpteluvsl() eumim iu4llt mfetat) Dtrxrp;o0apx ifctasla emu s t)areoxocoytlmD aivs;t  rtr(o oydlmtnliciatfaDtrxmont4tltomoctys a2ulnvo (0trtrxo3tytoa elnvo;()srurxm no4amtnmieiat srua(r ;u0tetnifciatlm el( pnt)tetrxo3ta1lmtr n il(  2trir oo1al  lnvt t)sDua(r ;t0oexn f3iad s eanmo;u0arxnmo to1omDr u il()setoxmpnodoltn feiatfaruaxmpno1tlxoii3iasfa eaumo (4arxoir3oodfmDeanes t0setoio oy1op  lfei s)a2umxrpou1alto f3tad m uanvsnu4texrxrcoy1oatelues t0srxr(rpoo1alen fctasfs2um(r ;t0tex io3iaslaDrmn snt4teenxf iadopDeai i;t trurio io1lle  nct sfsDua( oot0olenmi3tytlmDra(mp;u0alxoxociytfa eaivi (0srur(o nodapt lnci (fa2rr(mp;u1tetoiictydfa2em(vpnu)tltnxfcoydfat livs (0 exrimpiu4apenlnciat  ruaxmpnt0oet mi3iydfmDemnvo (4 exomo tytlptr iei;s)sexo(o iydom  lfviat) Dua(r ;t0apxoifciasla el( o u4arerif oydoaDraivo;s t2toiopio1lptemiesl( a2tmxr ot4olt  fciasls eluvsn(0texomo io1fm   uei t sruo(m iy1lmt  fvt ( sDumxm nu0ape  f3tydfs eaumon(4tlerxr3iodomDr i i t)t2xr(m3iu1aptn ncia()s2trum ot1aee  fetysfa um(mp t0aexoio3to1lpteln i;t0t2tmimpnodom  mici s  2rr( o;o4alen fciad s2rmu p t0aeeriocoo1lat luvo;t)setrim3iy4ol n fvs (  rra( p;u1oeenmocilsfsDum(vs;(4 etoir ootoat  ivs;s)srxrir oy4open fvi ( aruax  ;t1aet iieiadfsDemuvp;u4teeomrcoodopte uvi t) 2trir ou1ap emnesl()s2urumooo1tpxoiictld sDea( o (4alxrmo iadoaDelnes (  2to(rpiydal e fet s) 2rmx  nt1altn o3tlt aDrmumo;u4alxnif3todopDelieilt)srtrxo nu1ap   iet (fsrtmx pno4olxo o3iasfa2rln o u)arxomocta1omt  ues;s setrxo3io1ol  mnesat a2ur(r no0olxnmiciysfm2eluvonu) lenir3ia1lmDranesl( t2urxr no1lp elnvs t s2rmxm oo4olto fcilslmDrmn o (4tlxoxrcto1omte n s s0t2urxopou4apt mnet ( artr( pou4ape  feiad sDranmpnu0arxrio3oy1fa rai s s  rxm(o iu4amtnmivi tfaDtau o;o0aleomo3iysfm2rmnms;t0teerio3ia1oa  luvslt)t2urxr ou1om nlnesltfa2tmumpno0tltomf3tyt m um(vsnt0 lerirctotfaDrlnvo;t0s2umxr3oy1ol emncslsfartauroot4opxo oeiydlsDeanmsn(0tlxoxo3tadom  ai i;t0truoxo nu1om elnvils  rrm(r oo0opxnmociltla2eln o t)tltoxo3todlmD luvs ()s2uoio3ny4optn nctat)s2rruroou0oleomicildlsDum( onu0tltoif3oodlpD liei s  etoxm ny1optemivt ()artmuront1oetnmi3ilsfm2uanmsn(4 rtnmr3iy1fmt lu o;s) 2uo(o no4lpen icta()aDta(moot4altomi3ils s ranvp u)alxrxo3todfp e ieslt)s2um(r3ny4lmtnlicia(fsDtaxrp;t0tlxoio3iadlmDulnvsnu4texrifciydopDelueo;(0s2uo(rpoo1ll   fvs t sDrmump;o4tltnifetytfsDrlumon(0aexoxo tatfptelieil( trxrxr iodlpe mietatfs2uaxroou4apx  fcilt mDel( snu4artrxrciytomDr n i s)s2urxo3io1omte nei t a2urur nt1aetn f3ildlsDrl(vo (0trxrif tadfmDelnvs;s) 2xr(r3io1al e fcia()artrump;u1teeo f3iyt a eanvs u)texoir ta1fp raivo;(0t2xo(r ny4lmee ivsat)a2umxr ;t4oee  icilt s umnmsnt)aeerxf3to1fmteli s s)teto(opnodoltelfviat aDtmu pou1alto iciat m ulumo u0 exomo ty1fa eai s;( teur(o iu1apt miesas sruaxrpot1olxoifcilsfaDrmu snu) etrmo3iydlmDe nvo;t0 rxoiopny1omen fvsa( aDra(mp;o1tltomfciasfs2ua(mont)altnmfcoatfatrau il()sexrxm3nu4ll elfvtls arua( oot4teenmieias sDrm(vsn(0teeomf oodlptr uvs;(0setrxr no1op nlieil(  2umxrpnt4oee mociad aDel( onu4texrifcto1opte u o (0s2xm(m3nydope  ivsl( aDtm(r no1oexomf3iysfs eanmp t0aeeoxr oydfp rli ils  euoimpiy4lptemfcsa()sDrm(mo;o4tlxnmictat m uln o (4trtoxfciotfpD  nvo;t srxo(rpnu4al e neilt) rtm(rp;t4tle  ietat mDrmuvo u4tlxrxociotfp   neilt)trxrxm3iydome  nei ( sDum( pou0aetoif3tasfs2rl(vp u0 lenifciatopte ivs t  exm(m nodaleeliciatfsrum(ro;t4olenmictysfa2ua( o t0altrxf to1fptrlu i;s  etrxrpou1ll n nctlt srum(ronu4tee moctytfsDuan s t) rtrxrciatomt auvil()teurio3ny4amenmnvtlt)s2ua(rpnu0teeo ietadlaDelnvs u4 eeomf tatlmtrai i t  eumirpoy1ap   fvta(faDraumpnu0opx mfeiasla rlu s;u4texoxr tytlpDrln slt) rtrirpoy4om n icsasf 2um(  ;u0tltnmfetytfsDeln pn(4teenxr tatfptr n ols) etmxr3nudllt  ivtl( sruau pno1aleo ieiyd m2el(vs;u0 rtrxr3tydfp eauvo t  euriopiy1aleelfet t) rur( o;t1openmi3iysla ua( s u0 lxomr ty1fpD anes;t0tetoxm3nu1ll nlnci ( a2ra(rpno0tpeoii3tlslmDua(ms ()aleoxfciydla r ivsl()srtmxm nodllte ivias)sDur( pot4olxomfeilsfaDeaump;t0alxnifcoadlpDeln i ( s2urxmpiodllt lieil( sDrm(  nu1tpe  feiadfmDean s (4 exnxf oa1lmtraiei t)seuoimpiydomte fvils  2tmu  nu1oex  fetltfa ulu o u)tlxrxr3iotop elivi ()s2uoio oy1am elnesat aDtmumonu4optn feilslm emu o;u)trerio3iytop rluvo t0 rumxr nodlpeemicia(fs2truroou1apxnmo3tyt s2umn p;(4alxrxf iotfmt lu ils0srum(m3iudol nlfcil( aDtaumonu0apx ifctys sDea( s;u4alxrxo tadlm eanvi;t0sexm(r nu4ll  mfcs t)sDta(  nt1altn fciytfs2rl(mpn()alerxo3oodom  lueslt srtm(r3iydoltn fci (  rrm(  ou1altn ociatfs umnvs;()trtnxf oadoptrlieo;s  rxoxrpiy1opt lfesat) 2rr( oot4aet iociatfm2rmu o;()arenxfctadfaDrluvs;s0 eumxo3nydlpeemnesl(fs2ua(m ;u4tle mictatfa2ua( o t4texrxr3totlmDranvsls0teto(o3iu4al elnvt t a2rauroou4tpen oeiatfa2eanmpnt4arxomf3tadopDean ils0 2xrxopnudolt  nei ()s2rmx pno0oetn i3tasfmDrm(vont)trxnir oodlm eau olt) eumxm oo1al e ivt s)srua(monu4teen f3iysls2raump t0texnir3iotlmDr u s;t)t2urim oy4lmte nci () rtr(r nt4tee ifeilslaDel(mo;t)altnir oo1fat ln o;t)trtoir3iu1lmenlictlt  2urxmpno1aee moctytfa2uanvp u)trxriociotla eai o;t truoxr oo4lleemnct t srraxm oo4tpxnmiciyslm2ul(mpnt)aeerxo to1opteauvolt)t2trirpiy1om   feta(f 2tax poo1tle if3tld s rm( s t4 leriociadlpt auvi;t0trtrim3ny1ol   neiasfaruaxrp;o0tleomf3tatls ul( o;t4 rermo3ia1lmD auvsls)s2uoirpou4ll nlictatfsrurxmpnu1oeeomo3iyslm ul(vpnu) exnxo3iodlpt  ivi (0srxr(r3iy4ope mnetas) Drmumoou1tptn feiytfsDem(ms;t)treomo3oy1fatelnvs;(0 2xr(m nydaptelivtas aDtmxroot0openmo3tyt s2rl(msn()tltrxoctytlat auei;( trumim3oydolenlietls)aDrmxm ;t4tleoiieiys m2ra(vp;u4 rerxociadfateauvs;t0 rxrxr3iudam n fvsas a2trum nu1opt mo3iatla2ua(msn(4 reoif ty1laD aieo;t0s2ur(r ny4om e ivil( aDrru ooo0tle  fetydlm ulnvs u4alxoir3io1omtr u ilt)setoimpnodole mivias)aDrrx  ot0apen feiydla2eln p t0 rxrmo iatopt  nesls0sexoir oydllt mfcta()s2ta(ro;u4oetomoctas m ra( s;t)alerxf3tadomt  n s;t  rtoio oo4olenlfvslt  rrrxrpnu0apx ifctasfm umn pnu4 rtomfcootopDeln s;( s2um(r3no4ap nmivi s sDrmx pou0aet mociyd mDelnvp;u)areoif ty1opDe i o;t0trxoir nydlmen fct t) 2trur ;o0texnmf3iydfs2elnvs ()tltrmf3ia1la  luvol( t2toir3nudaltnlnvtls sDtm(rpnt1tlx ifctlt sDemn p;(0alxriocty1lmDr nvils)texm(o iu1oltemictlsfa2tru ont4apenmf3tadfaDuanvsnu)aleomocoo1lp eaneilt0 2xmxr3iu1al nliet t srrr(rpot4tlxn feiysfm2eanmpnu0 rxnxrcio1fmt ln s ( sruoio3oo1om nlfcs t)arta(  nu4tlt  fcildlsDulumo u4artniociotom  luvo s0tetmxr oudome lfvtltf Drmuront4alxo iciadlmDrm( snu)aexomf tadla eauvilt)teurir oy1olt  fvs ( arrmu o;o1tpx  feiydla2ea(mp (0trxomo3oodfateanvi s t2xrxm3nodlpe micsl(faDrau  ;u0tlxomociadlaDuln s t4aleoir3iy1fmDrauei t0texr(r ou1omenlivs tf rtm(m ;o0opxo ociysfaDeluvp;()tlxnifcoa1laDrau o () 2umxopoydlleelnvtasfsDumxmono1oleo octatfa2ua( o;(0texomf todla  livi () 2tmir iudol  mnvsls)arumum no4teenmfeilsfm emu s;t4arerxrcootfptrlu s (0s2umxr3oo4lme  icsas arrrx o;o4tpt  o3iydfsDrmuvo t0areomoctytlp  liei;s0srur(r3nydlmtelfvil() Drrurpnu1olt io3tyt a2rm(ms;()texomociytlm  anvils0 rtmir3iydale lneta(  rua(mpno0tetnifctls aDumn p t4trxoxo oytomtr ivo;t0tetrxopno4amt lieil()s2tm(  ;o4tee  ociatlm2ran o u0 etoircoytoatrlnvsl()srxmxrpiy4omenlfctl(fsrraum no4alt mo3iad a2rln o;u0 etomo ia1laDrlieils s2to(r iodlptelnvsas arumxr ;t0ole mf3tys m uan o ()texoxrcoo1fm  an ilt) 2xoxmpio4al  lfetat)aDrr(  ot4ape iiciydls2ua(vo u) rtoifctadom  ai i;s0s2xmim oo4lltnlncsas a2rmumo;t0tlx ifeils s2rl(vo () ltoxo iy1faD anes;(0t2umio3oo1opeemncsls)srrmump;o4tpx if3iasls2uaump;(4trerir3tatfmDelues ()texoxo iy1alt mfvi ()srua( ont1oltnmociasfmDeluvo t0 ltoir iodomDe ueo ()t2xrir oydlptnmnct t sruaum ot0aleoioetaslaDemnms;u4arxnxociydfmtrai s s s2tm(mpio1olt mnvi t)artrxrono4opt  icild a2rm( s;()tleomr3tadfmt anvi;(0setmxo3iydll nlfvtat s2tmump;u4aeeo o3iad sDel(vo t0alerxf tadfm  aivi;()sexm(r3oy4op e icias)a2urx p;u1olxniieiys m uan sn(4 lxrif3iotopte neil(0s2xmxm3iodaltnmivi sf rra(mp;u4tleomf3ild mDem(vp;u) rxoxf oo1omDe ieilt)s2xrxrpiy4ole  feiasfartaxm nt4ope ioeilt a uln onu4trenmo3io1fpt  nvols)sexr(m ny4om emncia()a2urxm ;t4oexo ieiytla ulump u)alxrxoctotom rluvol(0t2xr(opno4optnliciat) Dua(mo;t0tet miciltls2ua( pnu0trtnif3oo1la elnvi s) 2urxr3oydal nlictl()aDtm(rpot4altnmf3tld s2em(mo;(4 etrmocoodfmDrai o t0truriopnydlmt livtlt srrau  nt1apeo o3iysfm emnvp;t4texrxociytlaD ai s;(0s2xr(opnydlpe mfvslt  Dtrurpot0optnio3ildla2ua( p (4teerir3iotomDelnes;s0trxm(m3nydom e ies s aDtmumpou0openmf3tysfm rmnmp (4aeenxfctadfat  nvo t0trxrim3ou1ame lnesas  Dtr(r ;t0tpen ietydfs2rm(ms;u4arerio to1lmt lieo;(0s2xoiopno1lle lnei () Drmurooo1oexnmfciydla rmumo t0aetrxo ty1oa e nvsl( tetoxo3nydal elnvtls a2rr(m ;t4tlxnmo3iytla eauvsnt)tlxrmr totfp  lnei s)s2uo(m3ou1lm n fci sf 2rax pnu1tlx ifeilt m eaumpn(4areoxocoodfp r n ilt0srtmxo3iy1am n ivtls)s2urxmpno0optoii3ild sDua(vs (0arxrxfcty1op rai s;s)srxo(r no1apee ics () 2tmx o;t0aleoiietlsfsDrl(mp (4aeeoxo io1op e ivs ()truoirpio4lmeemici (f rrmxm ;o1aet ifetydlsDra(mp;u0altnifcia1lpt  u s;()setmxr iudll n ietasf 2tmxm ;o4oeeo fctydlm elnmo;u)aeenxo iytlm   ivsl()s2uo(mpio1amtnmietlt)a2um(mont4openmo3ias mDemump;t4arerio oytoa r n s s)srtrxrpiodale mfes t)sDumxrpou1aeeomietydfm em(vs () ltnir io1omtranei () 2uo(m no1apte ncslsfsDtmur ot4olxnio3tyd m rmump t)altnxf ty1om r n s;t0 rtm(rpoydlpte fvsatfsDta( o;o4tpt mo3tydfm2el( on(4 rxoxf iadfm rluesl( s2tr(r ou1ap emneia(f rtmx  ;t0oeenmfetyd a2em(vs;u0aexnir3iotlmt lnvo t0seum(r3no4ll emnet () 2ta(mp;t0teeomiciat s eanmo;() leomr3oatoptr neol(  eurxrpoo4ll  mfvtas) Draxm no0aeeo i3iyslm elump;u4texomf3iadfpDrlivol( trxm(rpiydame  ietls)sDrrxm oo0tetn ieildlsDrln pn(4aexrmf io1fateaiei;t) 2tm(m iy4oltnmfetas)s2tm(rono1tltnmo3tys aDra( pn()tlenioctatoptr ies;s)s2xrxo oudoltnmivi s  2umumo;t0optomfeiltfa rmuvp (4 lxoir3oo1lat lu i (0s2trio3nu1opt  fct tfaDtr(ronu4texo f3ias aDrlu p (0altrxfciy1la eauvs s  rtm(o iy4optn icia(fs2ra(mo;u1opxnifciys m2eanvo (0arermr3tydom  lneilt0srumxm3nu4ole mfcs s arrm(m no4tee mf3iltls rlu p;u0areoif3tydoa   ivo (  etm(m oo1lme  nctas  Drm(  no0alen fetydlm2umumpnu0tltoif3oy1fp   ueo (  rtmim3iodlpte fci s)a2uax p;o1apeomo3tad sDemnms;t0tlxoir ty1fa rluei s)trtoio ny1ol elfcs ( aDur(mo;o1oeto ictltlmDulumpnu4treoio3iydfaDrluvsl() 2um(m3oodllt mfcslsf rrr( p;u1tpxoiicild m rm( on(4tlxrmfctatlaDe i sls)srxr(o iu4altelfvs sf rum(mp;t1aex  iciydlsDelumsnu4tlenir3tatlm eai slt0 exoxrpoudll   iesas sDrrxrpou1oeeo o3tytfa2ulu sn(4aeenxr3iydlmD  n s () rxoimpno4ll elnetasfaDrau pou0opxnmi3iysls emn pnu)alxnir3oy1fmDranvols)t2trim3oydope livi t  Durx pou1tex ii3iasfs2rmumpnt)altrxr3todla  anvo t)teurxm nu4om  lnctlt)s2ua(mpou1texn oetldfsDelnvo u) reoir3oa1fatr ueo;s)s2ur(opno1amtnmnctas s2urum ou1alxniietltfaDrmuvon(0aeermr tatlmD aivi s0t2ur(o3oudlme lfviasfarum(m nt0aeen iciad s2uaums t)treomf oydfmt ln i;s0 rtrxm3oy4apt mnetltfarta( p;u1tptnmfciat m2eaump t4aeenmf3oa1fm eluvils  exmxo3nudalen nct (f Dur(mp;t1tlt mfetatls rmnvs;t0 exrxfciytomDe n il(0sruoio iodamtnmies ( s2rrum nt1alenmo3iadfm2eln o;u0aeeoxr3oy1lmD  n o t trtoir ny1lp e fcilt aDrr( o;o1oeenmfetad s2emuvp;u0 reoirciadop  liei;()srxrxmpoo1olenmict s aDurum ;u4tptomf3tldla2emuvp;t4 etnio3oadfaDranei;(0s2xrir iu1omeemieta()srur(rpou0opxnioctadls2ua(ms ()alxrxr oytlaDe ivsls)truoir3iydop  lfctlsf 2rmxm oo0tet iictlsfa em( p u)aleoirctodop ranei;s0seuoir no4alenlivs s) 2tm( o;u1opx  o3tltlaDea(vpn(0areoxrctytomtr nesls) 2xrxr3io4al emfci s)aruauront1olx ifeilsls2umnmo (4 rxnxo3oytoaDrlnvs t0 rum(m nu1ap nmncta(fsDum(monu0teeomieiatfm2emumpn()altnmr3io1fmtrlu ol( t2trim oudapenmivtatfsDtr( ono1alxnmoetld a2ul(mpnu0 etrxrciadoatraieols sexoxm3iodame  fvsat)sDumuroot1aexnioetyt aDua(vp;u)aeenxf3oodfa  luvils srxo(m3nydomtn fvsat  2rrx o;u0apt  ieiatla ua(vsnu)texnircoytfaDrai i;()teuo(o io4opee neilt  Dumum nu4optnii3iad aDulu sn()areoxr3iotlat aiei;(  exm(o3nu4op  mnvt t a2rrxmo;u1alto fetltfa eln s;(4altoxrciydop r uvi t)trurim nydolenlnei t s2rm( oou4aex mo3iytlm elumo t0trenxo oydlp rlnesls t2tr(r3ou4lm  mfciltfsrrrx  nt1altnmictldfa umnvo;t) rxrircoy1om  ln s t0s2xrir no4omenmnesatf 2rmurpnt0tpxn o3ilt a rmnms u4 lerxo3oytom   n s;( seuoio3no1omt lncs t)arua(rono1opxoiietltfa2el(mp () lxrxoctatfatr u i t0s2urir3io1lmte ies s)sDur( pno0opt ifetat s ea(vpnu4arxrxrctatfpD li ols srtrim3io1omte ieslsfaDraumpnt4altnifctls mDul(vont0 lermr iadlat  n slt t2xmxopnudllenmfesl(  Drrumo;o1teenii3iatfs elump;u0aetrmo3todfa rlieolt)srxr(rpiu1lmee fes t  rrau  ou4aeeomi3iydlaDua(vs t)tetomrcta1lp r neo () 2umirpno4om e fes (fs2urx  ot1oleoiieils aDrlu s;(0trxrmrciatoa  ln sl( trurir3ny4ope liei t)sDrm(rp;o4alxoiietysla2rmu s;u0aeerxo3iotfpt livs;s) exo(o3io4lme lncsat srrm( pnt0apx ioeiydfa rln s;u0 rxomo iatlm eluei;s)seuoxo3oydomee nvtasfsrtax  ou4opeomoctytfaDrmump t4alerio oadop elneil()srtmiopnu1om emfcia( srtrxrpnt0aptnmieiys mDem(vo;u) lxrif todfatrlneolt0 2xrio oo4lmee fvil(f rtm(  ;t0teeo ocilsla ea(vont4 etrio3iodoaDr iei (0seumiopou4op n ivt ( aDrr(m nt4tpeo f3ilsla2um( p;u0tlxoxrcto1lptrliei;t0srxrxm3nydomtn fci s)arum(rpnu0aleniictytfmDuaumo (0tlxrio3io1laDelu o;t0sruoxo nu4apenlieias) Drmxmoou4oexoiiciad sDrluvont4aeeriocty1omD ai i;s0 eurxr oy1alenmfet ()aDrm(m nt1oeen f3iytfaDel(vsnu) etnirciodfa   neo t teurio3nudapee ieias s2umxrpnu1tltomfciyt mDuluvs ()alxoir io1fm e nvolt)t2xoxr oo1omtnmfesa() rtmxr ;u4oee io3tys mDrlump (4 etoifcty1fpDelu i;() etrxr3oodam nlfesa(fs2uru pot4alto o3taslaDemn onu4aexoir3oa1fmt li s;s)s2urir no1ole  ivi tfa2rmump;t4open fciasfs2eanvp;t)trtomo3oa1laDeaieo t0s2um(o iodom nlnvt (  rtrurooo1oex iieilt a2emump;u)alxrmf3iodomDrlu s;t teum(rpnu1ope  iei s)s2urxronu1apxoii3iysfm ulump u0 etnmf oy1faDeauesls0trxmio3ny4aleeliei tfs2rmumo;t4olxnmociytlmDra( pnt0teermo oa1fpteauvs;t0sexoim io1ol e ieil()artaxmont0olxoifeiydla uauvp t0 leoxo iydfp r ivi;t  rxmim3ou1lm emnctl( aDtr(rpou4oeenmoeiat a um( onu)altoio tytla rlnvi t  2um(opiu4al emnci t srururo;o4tleomoetaslm rm(mo u) etoir iadfa rauvo s  2tr(r nudap   icsl( arrmurp;o1teeoio3ildfs2ranvs t4aetrmrciydoat  neo t) 2xrxopoy1apt lnci tf Dum( ono4oleoioeildfa ranvs;u4 renmfctatfpDr i s s) exoim3oydoptnlfetatfs2urxrpnu1aet mfeiltfsDrlnvs (4 etoxo iatopt anvi s)srtrxopiu1lmeelnes tf Dumumoou1aleoiieilslaDrmuvo t4tlxoxfcoo1lptran il()trtmxo3oo4om  mnetlt)arraxro;o0oltoii3iadfs el(mo (4arerxociadomDe nei t)srtrirpoydaptnlfcsas srumurpoo4aleomfeiadfs emnvp;t0 rxomfcoytfp eaivs;s)srtm(o no1lle lnvils arur( oou1apxoiieiatlsDuaumsnu)aetomo3io1omDe i s;s)trxmim oodal nlnesa()artaur ;t0tpe  ocild a2rau o t0 eenio ta1lmtran o;t)s2uo(rpnu1am  livi tfarrmxr oo1oetnmoeiys a2umn pnu)trxnmociadoaDrli ols)trtm(r oy4amee nvsas aDur( pot1aptnioeilsfa2uln on(4aexrxfcoo1omDrln o t s2xr(mpnu4amtn ict t) Drau pnt4ope moeiysfm2rln snu0 lxoxo3oa1oaD lueil( t2tmxrpio4altemivilsfaDrmumpnu4aptomociydlaDrlnmont)trerxf3todfaDeaues s sruoxm3ny1omt mnvil(fa2tru ooo4ope  i3iasfa uluvpn(0 lxoio3tytop ran s;() 2xrimpiodlpe  fvsa( srra(mo;u4ape iictls a2umn p (0arenmr iy1omD  ivi;(0 eurio no4omt lnetas) Drrx o;o4tex iiciatfa umnvont4tetoxocoodomte neil(0 etoxr3nudlm nmnetltfartau  ot1aex  iciatla2rluvo;t4 etniocoydfmDeli s s  2tmxo3ny4optnlfvs sf Dururpnu4oeenmietlsfsDran sn(4trenxo iy1fmD luvsl( sexmxo iu1lm nmieslsf rtr(m nu1teto ociydfm2ea(msnu0tltrmrcia1op e uvsl( setm(o nudolenmfviat sruru oou0tlxnmfetlt s eanmpnu)arxnmfcoa1lmt  ieo;s t2tmxo3oudaptemncsl(faDrm( p;u4opeo oetlsls2uanvs u)areoirctotomteauvo;s setrir3no1ale lietat sruru  nu4opeomfctltls2ulnmo t)artrirciy1om rauvo t0srtoxrpiu4altn ictl(fsrtr(mp;o0alxo i3ias m ulums t0aexoio ty1la rliei;(0s2xrxm nudlmtnmfeslsf ruaxr ;t1oetoioetasfm ulnvont4tlxrxfcia1fpt  nei;(0sexoim iu4lp  lfvslt  2rmxm ot4aeen ociyt a2eluvo;u)tlermr oodla eaiesl()trtr(r ny1lme  fvtlsf Draxm oo0tlxnio3iydfm2eluvo t4 lermo3to1fpteaivolt)trxmim3nydllee fcil()aDtru o;o0opxoifetatla uan pnu0 rxoif io1laD lies ()trxrxo3oy1olee fci t sruax o;u1aexn ictlt m2um( ont0trtoir iydlpDelieo t)truoxrpiy4lptnlnci sfa2uru  ;t1opxomictlsfa eanvs;t4tleomr3iotlmtranvsls0texrxo iudlpenlieiasf 2rm(mpno1tleo ieiysla2rauvs;t4arenxf3tydlat aies;s0setr(m3iy1ale mfvi s)sDtr(  nu0tee  iciyt mDranms;(0 renif iotoaD ln ilt) 2xoio oudap nmfvsl(  Drru  no4oeenioctat a2umu s () rerxf3io1fmte ivs;s)trtrxrpoodal elfeslsfs2trurpoo4aetnmi3ild m2raump;t) exnxociotfp elnvol(0 2ur(r oydap e icias)a2tm(rpno4oetnmoctatfaDea(vo;u)treriociatfpDeluvil()setoiopio4apeelfciat  2raump;u1apxoii3tadlm2elumon(0 renmr to1faD livs s0tetmxo nu4alt  netl(f rrrumoot1oee micilt sDrl(vs;t)aexoxr to1lmDelnvols0texrim iudol   ncsl(fs2uaump;o1apeo o3tlsls2rlnms (4trtnif3oa1lm elnvi ()srxrirpoy4lltnlivi sfa2uaxrpot4aleo ietadla rluvsnt4tetoio ta1faDeln o;t) etr(mpiy4aptelivs s)s2umurooo4tltomieiasfm umn ont)tlxnmo iadom rlueo;(0 rto(o nu1amt lnvi s)sDrax p;u1tpeoifciasla2ua( s t)alxnio tytfpte i o s0 rumxm nu1am e ieia( srumxrpoo4altomfciydfs2rmuvo;t0tleomo oy1op r uvils0sexoxo iydomenlfesas)s2uaum ;o4aet moeiyt mDrluvp t) exnmr3tadlatr neil( teumir3iodlptemfciat) 2ur( oou1apeo ociasls rmu p t4aetoir3oytlpDr uvi (  rxmxr3ny1lm  lietltfsDua(moou0oltomi3iat s eluvo t)treoxo ia1lpDeluesls0teto(r3iy4lmen fet s) rua(moot1tpeoiictytlaDean pnu4teeoxf totlp elu i t) rtrim3ny4lltnlivt tfsDrmu  ou1optoiociad aDrm(mp;(0aexnmocia1lm e nvo;s  eum(mpno1olt lfct s srtmxm ;u1alx mieiad s2umnmont0 lermo3iytlpD an o;t texr(r3nydlpenlnciatf 2umu pnu1aee iieiyt a2uaums;t0 rtnmo ia1lpt  i s;() 2xr(opou4lme mnci s sDuaum nu4oet ioetytfs rlums u4tltnmo3iadlpte n i;(0t2urxm iydomtemnctat srrr(mont0tlxomfciatlmDumumonu4aexrir3oytlmD lneo;s s2trim ou1apt lieslt aDurxrp;u0oet ifctydfmDemnmpn()aetrifciy1oa  lueils0 rxo(mpno1omtn nct sf 2tauro;o0apxomf3iyt a ranvp u0trxomfcootfpD liei s0 exo(o io4apee nesas) Dtrxmpno0ape ii3tytla ua(ms t) exrxrcio1fpt  u ilt) 2urxm iu4altemnctas)s2trur ot1apx ifctltfa rmnvo t)alxnmr3oadfptranei;()t2ur(rpiu1om  liesas) 2ur(mooo0ole if3tydla2umnvont)trxnmo3oadopt  ivil(0trum(r3oy1omeemiviat aDumx  no1optoii3iasfs umuvo u0aleoxociy1fpteau il( trxoir3nu1opee ncsa(farur(ro;u1aptn fetldls2emn s ()teerxr tytomteai o ()truoio ou4opee ivsatf Dra(m oo0tlxomfetadls rluvs;u4altnmociodlm ean olt) 2ur(o no1opte nesas  Drrxmp;t0apx iieiadls2ul(vp (4 etnmfctotlpteaueol(0 2toxm no4lpe  fci ()sDua(rp;u1teen ietysfm umn o (4 reoxf3totfpDrlu slt0s2umxr3nu4al  liesls s2ua(rpou1tlen oeiytla2emnvo (4tlxomf3iytfpDeluvo;()seurim3nodlp e nvtlt aDurxr oo4tpenmicils m ul( pnu4trtnmr3iotfmDr nvols0tetrim3nudamenmies s) ruaxmp;u0tlen iciytfs umump;(0texomr oa1lat ai s;( trxr(r no4llt mnvsl()a2ta( o;t0opeo oeiydlsDumums;t)trtnxr tytlp   u o;s0 etrxmpoy4al nlfvslsfa2rrumo;u4alxniictldls rlumo;t)tltomf io1omDe nvo;( t2xr(r nodaleemfcsat  2ur(  ou4ape io3ild a rmnmp;()tlxnxo3tadoaDe n i;t truoxr iydlltn ivtl() rra(ronu4aptomo3iyslm rmu pn()arxrmfcoodla   ueo (  rtrxm3nudam emnetlt)aDuru oou4aetomociltfmDeluvo t0teenio iadfm elnes;s) etm(r3ny4lmeelfvtl() 2trxr no4opxo o3tlslmDeluvp;u4 ltrxrciydfp   u i;t0s2uoxopiy4oltelnvtls  rrm(mo;u1tlxoiicilt a elnmp;(0texnmocty1fm r ueols)s2ur(opiy1apenlnciasf 2trurono1aeto fciltlsDeln s u)teenmrcta1omte n o;(0seur(o3iy4ol nmnci sfsDtr(rooo1apx mo3iatlmDrmu o;t4aeenxf3totopDeli i t0 rtoxmpou1olt lict t) ruaumooo0oee  ictyt s elu snu4 ltoxr oadom eauvi;()setrxo io1alee fciat)sDumump;o1tetn fctatfa2emn p (4trermrcoytfm  aneilt0 2umiopiu1opee fcs sf Dta(r no4ale mi3tytfsDumnvsnu0aetoxo3iytlmt  i s;s)sexr(r ny4om nmnct ()aDur(moot1tee miciadfsDrluvpnu)aeeoifctatfmteln o t)s2trxmpny1lpeelivtltfaDta(r ot0oex  fcilsfa2elnmp;t0trenmr3oodfmt  uvo t setm(r3nu4amt mfct ()sruaxrp;t0tee mieiys mDuaumpnt)aexnmfcoy1fatr u o;t)texo(mpiudole mfeil( s2rmum ou4openifeiad a el(vs;()tetoxf tydlaD luvilt0srurxr oo1om nlfvs ( s2rr(mp;u1oexomocias a2eauvonu0 ltnxf3oodfa r ueo;() 2tmxr3nudalt  ivil()artru  ot0aexo oeilsla uauvo u)aleoircoy1op  aivsl(0trtoxrpio1alenlncsas)sDur(r oo1aetn feiyt aDum( o;(4aleoirctatlp r i slt) rum(r3oy4alte iesas  rurxrpot4aexnio3tls s2em(ms (4 eerxo3tatoa eluvi ( s2xo(m oy1op nmfes (fs2taxmoot1alxnmoeildfm2umnms;t0tetnmf io1lmtrlneilt truriopiu4ale  ict s sDrrxroou0teen oetldlmDrlu pnu4 rtnirctadopDrln ol(  rumimpny1apt lietlt  Dra(m nt0tpe micilslaDuan o;u0tlenxf3oydom  liei;t0 rtmxmpou1alen fvils  rua( pou4aptniietytfs2rm(vp u)trxrif3iydfa elnvils  euoio iu1am  lnctlsfaDrr(mp;u4tlx mf3ildfmDrln ont0 exnxf3to1lmtrau o;t0trurxo iudopee iet tf rraumo;u1aptnmf3tad s2em( snt)tlerxoctatlp e ueols0 2xoir oodap nlnctl()aDum(mo;o1ope  feiadfaDumn pnu4 rerxo oodlptrau ols)srtoxr3ou4om nlneiatfarumurp;u4aptn ociytls em(vp;t4 exrmfciotlm eanvslt0trxmio iu4ame mfctltfs2ur(r nt1openmfciat s2eanmsn(0arxrirctydfaDeaivols srum(o nudlmen fcs (fartaump;o1oltoif3tatla2ra( snt0aeerir3oadomte u o;s0tetmxrpiydlm  livia( artm(r oo4olx  o3tatls2ul(mp (0tlenmr3iytfa  anvo;s t2xoxopno4am e net sfa2tmumo;t0apxnifetysfs umuvo u0 exnmo iatoaDe neols t2xoimpny1apee ncsat)arraur ;u4alenmietld aDea( pnt0texnifcio1lpt li o;t s2xo(r3nu4ol  mivsls  rur( pnu1tlx ifctytfa2ra( p t0altrmr iadfatran slt  euoxr iodlleemnvtls)s2taumpnu1tleo oetatla2uau o;t0tlxrifciodlaD  nesls s2tmxopnudopenlies (fsrurumoou0olt ifciysfaDuanmonu0areomr3ia1opDeaueo;s)setoirpiu4om n ncs (  2tmur ;t1opeo i3iltfs2ran ont)tlxnmr ta1fmD  ivols)teuriopou1al n nvsatfs2tr(ro;u0alt mfeilsfs ea(msnu0altnif oydla r ivo;(0 exo(r3ny4altelncilsfa2tmu ont0tee  ietldlmDea( pnu0alxnmf oatoaDrlivs;(0seto(o oudol emicsasfsDtrx poo1oexo fciadlaDrlnms u0tetnmr iodoa  aues;t texmimpoodom e ictat sDtmu  ;o0oexomietytfa rm(mp u0alxoif3iotlpDeauvs t srum(mpnodam emnvil(  rumxmoou1aeeoioctys s ea(ms u4trtrirctadfa ran ols)srxo(mpno4aptn ncsatfsDrm( p;o4olx mf3iytlm2umn o;t0texoxr iodfp eliesls0t2uoxrpoy1op nmici t)a2rmu oou0opxo oeils aDuanms () eermfcootfaDelivol()t2toir3ny1lm  lfetl(farumurono1alxo iciadls2ul(mo t0tlermr iadomtranvil(0 exrio3nydomtn fci t aruau pnu1olxo i3ild aDemnmon(0teeomf ootlpDeau i s)srxo(m3iudal nlncsls) Durx o;o1oltnmi3iytlsDemnvp u0 eeoiocia1fa  an o;s0teur(rpno1olt lfcta() ruaxmpoo4tlx ifetltlm um(msnt0arxrmocoatlmD  i o;() ruoxrpoy1ol emnci (f 2tmx  ;u1olen octyd sDrau p u0trxnxo iatlptrlnei;s0t2uoir3oo1omee icsa()a2ra(r nt0olxomictldlm2umn p (4trxrxocoo1fm ean i t t2uo(o3io4lmtnmfvt sfa2tm(m ;u4olenmf3tytfm eauvont) lenxocty1lmDelneo;t0sexrxm3ou1am nlici () 2urxmpnt4tlxomociyd m2umu o u)aetnifciy1fp   uvslt s2trir3nu4ole  ici t  2umx pot1tlxn fetaslm2rm( s;()tltnxr oatfp raieo s  2to(opny1lltnlncsat) Duaxmpoo1oet ioeiytfa2um( pn(4teermfctatlpDeaneo s)t2xm(opno4olt  fviltfa2raumo;t1tlen ictytlsDem(vont) rxoxo ia1la   ivolt0 rxrim iydop nlnctlsf rta(r ;u1apxo feiyd s raumo t)aexrifcoatlmte ueo () eumxo3iy1omenlncsl(farrrxm nu1olx mf3ild aDemu pnu)arxoxr iotlaDrlivi;( trxm(o no1ole  ietatf 2trxmp;o4oeenmfctatls rm(vp;u) lxnif3iydla rlueols  etmir nudlptn ivtl()aDtr(  ;t4aleo iciysla raums;(4arxrmoctadfpDeluvo;s0 2uoio3oy4optn ict t) Dta(m nt4tptn oetadfs2ranvo;(0 renxr iy1lmDeluvi;s s2xrir3oo1lp emfeia()artr(  oo4tet mf3ilsla em(vpn(4 exriocoo1faDe iei s)t2xoir3io4lm  miesatf 2rrxmo;t1aeenif3ilt a emn o;u0trxrxr3iadoa  livsls) 2uoxrpoy4apeemict s arta(m no1tpe iiciyslm2umuvsnu)texnircoa1om raueolt teumirpiu4om nmics (  Dumxm oo1aexnmoetldfsDemump;u4trtoxociydlm  livs;t)sexmxrpny4ll e fct t a2taum ot0tpeoiieiatfa2um(ms;u0aetrif oodopDrlueo;(0t2tmxo3no1lm  lnesa()sDrax  ot0olxomfeild m2uln p;t0aetnmocto1omtrln slt) rxmir oy1apeemfetls)s2tr(r ;o1olxnifeiasfsDrau o u0artrio3iadop ranvols setm(m ou1lmenlneiasfarrau p;t0oeenmfeiad sDrlums;u)aexrircto1fate n i s)seumiopoydamt lfcsa(  Dtaxm nu4tle  o3tlt s elu p u0teenmoctatlmtrli o;t  exrxmpny4opeelicsls srtrur nt1tlenifeilt m2rlumsnt)tlxoif oodfpD an ils srtmiopno1altnmfvtatfs2umxrpnt1alt ioctysls ua(vs;t)tltoif tytop elu o ( truo(m nudlptemnvi s)s2rau  ;t0tlxoio3iadla ul(vs;u)arerxf to1lpDeaues;()srtm(r ny1olen fesltf rumumpnu4apxo oeiltfs2rl(vonu)aeermf3iydfmt aues;s)seur(o3nydam  lfeil( sDraxront1optnmoctysfa rl(mp;u4teenio3to1omDrauvo;(  2uo(r3oydalt  net (fs2urum nt1tpeoiietlslm emuvpnt0arxnirciatop rluvs ( trumirpoydop  lnvil(faDum(m ;t0aeeoif3iadfs2ul(ms t) rxomf oadomte nvols) exoimpoo4lp e nvsas aDrm(rpoo0teen i3ias a umuvs (4tetoio oy1fpteau i ()trxr(opnudlm elivi t arrr(mp;o1aexniieiltfs2emn p;u)aeerio3oytfa  aivs s  eumxm3iu4lp emncilt sDtrump;u1openmoetlsfa2uaumo;t4 ltnxocoydlmtr ivs t)trumim3iy4ll  mnvtasfa2tm(rpou4ale ifeias aDrln s;u)arxrmoctotoaDeau o t0sexoxr iodamtnlfcs ()sDur(mpoo0opx moctlsfmDrl(mpn() eeoio tytfp  livslt) etmio oy1lp e fvt ( aDtax pno4tptnio3ilslm2em( onu0 lxoxr to1op  ln o (  2toxo oy4opt  nct t)srrmu p;u4optnioeiys a rl(vsn(4 reriocoodoa eluvolt0seum(mpiodamen ictl()aDtrxr no1opeoifctatlsDul( s;(0texnxf3oy1fm e nei t0srxoxm iu1olt lici (fsDtmurpoo1tltoifetlsfsDemuvp (4aexrifcoodlmtelu i;t0t2toxmpoy4ap   ivs t)sDrru pnt0tlt  ieiatfa ranmp;() rtoiociodlmD luei t)s2tm(r3ou1optemfvs t)srrax ooo1ale ii3iyslm ran pnt0aetoif iotfptrlivs;t)trxr(m3iy4aptnmieslt  ruaxmpot1tee moeiyd mDumnmp;u)tltomoctytlm  auvo t)teuoxr iodlmeemieil(faDurumpou1opx moeild aDumn o;u0tetnxf tydoptrlivi;() rtoirpio4ll e ies s  Duru  ot4tex mfciat m uluvo;t0 exrifciytomDe n o t0srto(o oo4optnmnctl()srtax  ;u4apxniieiysfa um( snt4areomrcto1fm   u s t) 2umxopou1op n ies s)a2tm(mp;u0opxn iciatfs2rlumo;(0texoxf oytopteaneo;t)texmirpiy1alt livias s2rrxrp;o1aeeo ociat sDeau s (0arxnxf3oo1lmt luei;()trurxrpou4open fvt ()a2rm(r ;t1aexnifeiyt mDrln p;u4tlxoir oy1om rlivols)teuoirpio1ap  mncsls sDtr(  no1tleoifctld s2emn o;(0 lxrmf3ootfptr i olt s2xmir oo4ap emfctltf 2rrum ou4apt mfeilt s elumo u)tltoifciodfaDr n i t) rxriopiodlp   fei sf Dtaxm ;u0oleniieiytlm uln o u4trerio tadla e uvs ( teumir ou1ll  mneia(fsDrru onu4optomi3tas mDrmnvo;t) lenif iadopt  ieo (  euoim3iu1am nlnei tfa2tr(m ;u4oeto fctasfm2elnvo;t)trxrifcoodfaDe nvolt0 2trxrpnu4om n ics ( a2um(rp;t0oeeomoeias a2um(mp t0 lxrxf iytop rai i s0t2xmio ny4lmen netat) Durum nt4tpe ifciadla2ulump ()aetnmr iadlaD an s () 2um(rpno4opt  fvias) rtr(m ot4teeoii3tlsfs uaumo;(0tetomo3oatfpDeau o t s2uo(r3nu1lp  mieilt)a2tru  ;u4oetn oetydfm2ea(vsn()teerircty1om   nvol(0sexo(r iodll elies t) 2uru pot4aexomo3ild a rl(monu)altrmfciydfmDeanvol() 2toir io1amtemiesa(  rur(  ou1oeto ociadfa2elnvsnu0 renif iodfmt lneo;(0 exmxm oudom elnvsa(  2rrx ono0alenii3iaslm eau snu0 rxrmo to1omtrlivs t0 etmim3no1llee ivi t) Drr(monu0oex iociad s2umnmpnu0trerxr tytfm rlivil()setmxmpiy1ol  lnctlsf Dtr(ro;u1oeenifeiadls eln onu0tetoxr3iatfmD lu ols  2xm(m nydape lnvt s)srraumo;u4apxnioeiltls em(mp t) lxoif3ty1opDr uvi;( t2uo(opoo1al  lfes s)sDurx  nu0tpxniieias a ran s u4 eenmfcoa1fpt lues;(0t2uoxm oudlp nmfvt tf rurx  nu0olx mfetltls2rl(mpnu4artrxocto1omtr ues t0 exm(o oy1olen nctas a2trxmpou4oleniicilt m2rm(vo () renio3todlmDelnvo s0 rur(r3iy4lmenmnvil(faDururpoo0tlxoifetasfs ea(vs (4 ltrxr iatlpteluesls  2toxr3oy1lp n fetlt srrm(r oo4tlxoiieiatls ul( p t4arxrxoctydoa  lu o;() 2xo(r3oo1llte fes ()a2urx ono1alxoiicilsfs2uln o;(0tltrmf iodopDraivsls)truo(m3oudap   ivt ()aDtaxr ;u1tptnif3tls a umumon(4 ltrxoctodfmteanesls) rurim iu4omtnmnci sfs2trxroot0tptn fetad m2ua( s () eerxrciotla  anvsl( setoxo3ny1lm nlietat  2trxrpou1opeomieilslsDul(mp;(4 exrmo3oy1faDe u s;s0 rxrio iy4llenmicta()aDuaxrp;o0aexnii3ilsfm raumpnu0 renio3oy1fmte ivo;s)setrxo3iu4lmte ict ( srtmxr nu1texnio3iad s2ulnmsnu0texnif tadom  livi t teurxo3oudlle lies s)a2um( p;o1tpx ioetyd sDel(monu) leoxf oatoat aieolt)seto(opiy1lpt mietlt aDtrur nt0ope mietyslmDuauvs;t4trtnioctatoa r iei;()trxmxr oy1omt micsatfsDtrx ono4oetoio3iysfsDrlnvo;u) etomfciadlpDran s s)trumim iu1am emictl( srtaxm ot4tptnmo3tasfsDeluvs;u) eerif oy1opDeln o;(0s2xm(m3iu4lpeemfci (  Drau ooo4tpen fctatlaDrauvo (0 rxrmf3oy1fmDraiesls t2xm(m3oy1lle mnei sf Durxro;o0apxoifeilt a ua(vpnu4arxoio iadoaDelueo (0 rtrim iy1opte fvt t  Dra(rpnu4tet mo3iy
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;t s2trxo3oydol n nvt (fs2trur ;u1tpeo iciyd a2rluvo;t)aexoxrctotfm ran i;( teuoim3iodopt mfvs t)srrrx ono1tlxoifctys m umu s;t4 rxrif3ia1lmtraueo;( s2um(m3nudal  lncil()s2tr( oot4alxo ocias m eaumpn(4 lenxo3oa1oat luvs;s  2toiopiy1openlfcsltfarum(m ;o0oeto o3iysla rluvo;t4 rtrxfcia1fpteluei;()s2tm(r no1ll   fci t  ruru p;t4teeomoetytfm rm( snu0teeoxf ia1lat ai ol(  rur(rpiodapenmnvsls sDtaur ;o0oltn fciltfaDem(mo;t0 eeomf tatomtr n o t) rumio ou1ll nlnvsas)sDrm( ooo1aexnmoctysla elump;t) ltoif3oytlateaneilt0trtm(r3oudlpe mict t srtm(mono1aexnmociysfa ra(vp;()aeeomr todomtrluvi;t tetmio3ny4oleemict tf Dtrum oo4tpen feiyslm rlu s;(0 rtomr oadfmt  ivi;s t2trio oudol nlneilsfs2uaumo;t4opxnifeiys aDumump;t4artoir3iodlaDeanvols trxrxo3no1ol emfvi t srurxrpou0tlenioctltls2rlnmpnt0trenmfcoadlateaieils  2tm(o iy4lp emivs t aDumu p;u1aleo iciydlmDum( o t)artoxf3oy1latelu ils0trxoxrpiu4ope mncsa() rrr( poo4oleomi3iltfa2uanvp;u4texrxo oydla  aueo (0teumiopiy4alte fvt () Dumx  ;t0apt  i3ilslm2em(mont4 ltomfcootlmDrlnvils)trum(r3iu4llt lfvia(faDua(  ;u1tptoifciyd sDrm(monu) rtnxr3ty1oa eluvols)srxrimpny1olt livs s  Draurpno4olx mf3tad a ran s;u)tlxrmo3tydlpD aivol( srxoxo3nu1amen nvs s srurxm nu4tetomiciatlaDrmumo;u)artrxocty1oat  ivi t  exoir3ny1lmee nesas  2ururp;o4aet  o3tyt m rl( pnt0trxnxoctadlm  an i s)s2xo(mpiu1llenlfvta( arum(rpoo0tleniicilsfa el(vp (0 lerxr ta1lmD aivols  eumxr3oo1om  mnetl()aDuru poo0oet  f3tysfsDuaums t0altomr oydom rluvo;s t2ur(o nydolen fesl( sDtr(rpno4tetnmictat m raumo u0tltoifcia1fa   i o ( trtmxrpnu4al n fcslt) rraxr ;u1oetn ociyt s2ra( snu) exnxr3iotoa e ivils)tetr(rpnu1altnmfet t aDur( o;u0alx  ociasls2rmu s u0 exnmo ty1faDranei;( seumxo3nodaltnmncslt srra(ro;t1tpe mictldla2umu o (0altrio iydoaDeaivi;t0t2trxo3nodolt mfetasfa2urxr nu0optoio3ils a em( o;t0aeermrctytlp   iei s0texm(m3nydomtnlict (f Dra(mpoo1oeeo oeiat m eluvs;t4tltoio ta1op   i sl()t2xmir iu1al   fvtltfs2tmxrpoo0olxn o3ilt m2ul(vp;u0tlenmr oydlaDr uvs;(0 rxo(o3iy4ome  nviatfaDrrxmpno1aexo feiysls rmn o (4 ltnmf3to1la elnvslt)srtoxmpnodap nmfci s)srtaur ;t4aet  oeiyslm rmnmp t0teerio3totlpt au i;s)t2tr(mpoudll e net s arum(m no1opeomo3iatlmDemumo;(4 rtrmrciytop rlu ols) rxrxm3iu1llt lfes t s2tm(ro;o1oleoiocilt a um(mp;u)arenioctydomDrluvs (0teumxr nu1opt lneil( aDtr(ronu1aetnmiciysfs2uln s;(0tltomo io1lp   ues t t2to(rpnodlltn iesat s2ta(mo;o0olt mf3tysfm raumo;u)tltnircoo1omt livi (  etmxrpou1apenlicsl(  Dtaxmo;o1aeenmfcilsla ranmpnt)aetnxo3oodlmteliesls)srxmir3iy4altemfvil( srrrx  nu1aetn o3iytfm2rmuvsn()alenmo iydlm r u il(0sexmxr3iy4ome lietl( aDumxm oo0olx  ociyd s em(monu4aeeoio3oy1om eluvi s0t2xmirpoy4ol e nvs tfaruaxr ;u0alxnmo3ilt m2eluvsnt0aexrmfctotop  lu o s0 rtrxr oudlp elfvs sf Dumu  ou4apxo i3iyslmDumn o;(4areoio iatlp eaivi s)teuoxo oy1al nlfctlt  2ra(r ;u0opeo ieiltfs ulu pnt4tlxoxocootop e i o s0 etmxrpoo4ame lfetat arurxroot4tpt micildlsDrlump () reoif ty1omDelieo t teuoirpoodllt  ivta( a2rr( pnu1alxnmfetytfm rl(vsnt)tlxnmr to1lm  ln s ()seum(rpio1lpeelict s)a2raxr ot0tle ii3iyslmDra(mp;()areoifctotfaDraueils t2ur(rpiydll  lictl()s2ra(moou0tetomo3iysfs raumpn() lermo oatlaDrlieil( tetr(m nu4open fcsas)s2urx o;t0tlt iocildfs2ulnvonu) rtnifctatfaD ln i;( texo(m3no1oleemies t)a2uru o;u4oetnii3iltls2ra(mo;(0tltnio oo1fpDe neolt)seum(rpou1lmte fcslsf Dtmxmooo1openmo3iltlsDeau s (0texomrctadfa rauvs;s t2xmxrpou1lm eliesls)srurx oot1olx moeiaslm2ea(vs;t)trxrio oatfpDeai s;t0 rur(opoo1lm  mfvilt)a2rmxmo;o0tex  i3ild s rmnvo (4 reoio oo1fm eli o (0trumiopiudlme liei () Dua(rpou1altnmfeilt m2rm(vo (4arenxrctydfmtrluvils0 rxr(r no1apt lfeil()s2tr(rpnu1tex ifciysfa elu s u) rtnxr3oydop r neilt0 rtoiopnu4lp  lieiltf Drmu o;o4altoio3tys s2emu p t)artrmr oodlpteaies (  2toxmpno1lle mieia(farum(rp;t4oee mi3tlt m2umnvo t) exnifciytfmtelu s;t) eumio oo4apenmieiltfs2rau  ;u0tpxoifeiaslm el(mpnu4trxoirctotoaDraueo;()t2urxm no1omt mfvil(faruax p;u1apx mf3tysfm2elnms t0 etoxf todfpDr uei (0t2umim3no4lle mnvils)s2ua( oot4optnifeildla2ean o (0 lerxfcootlpDrlnei;t  exr(r oo1lp  lnvt (f rurxm nu0opxomoeiydlmDran s;u0alxnirciodfaD  n i s s2xr(o iu1lp  mfvsls) 2rrumono1olx mietls mDelnvo ()tltrmr3oo1lpD anvo;(0trtoirpoo1oltelieil()arrmxroot0ape mf3iad mDemu snt0trerio3oydlm rliei ( srtoim3io1openlfct s sDtrxmpnu1tex iictltlmDrmnvo;u) ltnifctadlpt an ols  2xrio3iydll  mfcs ()s2ta(mono4tet ioeias s elu o;(4areoio3ty1fmDr neols teuo(o no1op  lfcsltfsDtau  ;o4alenmfcias m ua(ms;(0trxrxr tatfm eau i;s s2trxm3oy4om  mfvi t aDrm(ront4aetoifctad mDeaumpnt0altomr3oytopD lueo t0s2to(r iy4lp n ictls)srrm( oou0alt mo3iydlsDranmon()tltriocto1omtrli o;() 2uo(mpno4oltemnet t s2tax ooo4opeoioeiydlmDea(mo;t0trxrir iotfmteaues;s) exmxrpoydlpenlfeia()srtruroou0aexn ieiyd m ra(ms t4tetriociydlpDr ueol(0 2urim3iu1alenmnetas  2tmxmo;o4tpe io3tyt m rm( p;u0tlxoxfciydoa   u ol() rtrxo no1lle  fcsa(fartmxmono0olt mi3iys aDrlu o;t0 ltrmr iytoa e ues;s srxmim iudom elfvtat aDrm(r nu1aet ii3tlslmDemuvo t)tlxoxocoy1fp eluesl(0tetoir3nodoltemncs (fs2ra( oot4alx  ociytls umnmp;t0tetnif3todomDr iesl(0s2to(r oudalt  ivi s)a2trurono0tetnmf3iydfsDran s (4tlxomr3iydomtranei;( srur(o3nu4lp emnciat sDuaxrpot4opeo fciad a ean sn(4trxrif oatfp elnes s) 2umxm3no1llen iesls aDraum no1olxniociadlsDuanmo;() etomo3iydfptelivi;s texmim oydlmtn ncs s  Drmxro;t4olt if3tyd s ean o t4altoir ta1opDr i s;s)t2uoxm oo1lmeeliesa(f rrrx p;t1oetn fetad sDemumsnt0 lerif oo1oatr u ol()t2xmimpiy1altemfvsls)s2rmx  no1oltoif3tatfa el(von(4 ltnmo oo1fmDr i o;t) rtoxmpou1opeemncsltfa2ururoou0aetnif3ildfm2uanms t4altrif3tydopteluvo;t)seur(o3ny4opt lnvsl(  rrmur nt4tet io3iadlsDrm(mon(0aetrmr tadlm elneils0 etmirpnu4lmt liesas sDumu pou0aex  feilslm2emumo u0arxnxo ootopteaivils0 eto(o oo4ape  fvsa(fs2tm(mpoo1aptnmfetatls2emu pnt0trenmf3iadlmtrlu i;s) rxmim3no1apee ict ()srrmumono0apx mf3tydfs2em( s;u) lenmo3iytfpDrlnvilt)truoxr3oydlmtelneil( arum(  ;t0opxo ieiytfsDran snu)trenxocoy1fp e ivo;(  2xmirpoodamee fvia(  Drm(mo;u4optn octytls2rm(vonu)tetnmf iatlmtrln o;( srxrir ny4apen nei ( a2rmxmpnu1aex ioetydfmDuln on(4tleoxf tadfa r i s t0trxm(rpnydlmenmivils)a2uaumpnu1oeenifctatfm2rlnmo;t) exnxo3oytoa rlueilt trurir oodllen neias)aDra(mpoo1oetoiietydfa2rlnvo;u)tltrxr ta1oaDeli s (0teurxr ny4oltnmivs s)aruaxront0aptnioeildfmDeaump u4trtrxfciadopDrau s;s)s2tmxrpoy1apt  nci (f Drax o;u0altomf3iyslm2ranvpn(0alxnio3oo1oaD aneo;s0s2xoxr iudlpenmiet t aDtmu oot4oetn ietasfa2rmn pnu) lxnio tydlpt anes ()sruoir3oodom emfvt ( srrax ont4aetnifetadfs2umu ont)aetrxociytfa rauvs;s sruriopnodlleelicsasfaruax  nt0olx io3iadlmDuaumpn(4tlxrif3tytoat  n o ()teumxr3oydlptemfvt ( arrau o;u0opeoii3iltla ulnvo (0alerir oo1lmteluei;s texr(rpny4apenlietatfarrmxr ot1oltn ociat a rlnvonu4treoxocoodla  lneo;(0srurimpny1optnmneslsfsrtmu  oo0teeomo3tlsla2rau s;t4aeermr3iodfpt aieil(0t2xoxm iy4alen fvtas  ruaxmp;u4olenmieiatfaDra(vonu4trtoxr3oydlmDe ueils teto(rpiu1omeelneiltf Drm(m ;t4ape  f3tldlaDuaums;t4tltoxf3iytfpD li i;s setmio3io4apte fviat)srra(  ;u4apxoio3tat a2uanms;t0tlermf3iy1oa  ln o ()setm(mpnydlmteliesas  Dtrumonu1alx iictatla2rl(mo;u) etoxo3ty1lm r u s;t0t2trio3oo1ome lfei t)s2tr(rpno0olt iietys s2rauvp;u0teeomf iydfatrauvi s0setrxr3nodamt mnvi s  rtmx  no1apen i3iytls2elu s ()artoxocty1opt ln olt)t2xm(opou1lptnmfctatfsrrrxm ot0openmieilsls um( p;t)aetrxf3to1lp eauvs s)srtmxo3io4apenlivi t a2ur(r oo1ape  ieildfmDea( s u0 exomrctytfaDr i i;(0 rtr(opnu4altnlics tfs2umx  nt4olxnii3iad s ul(vo u0alenif3oydlp  lueo ( srxo(m3io4alee fvt sf Draurono4olenmi3iltlmDuaumsnu4alxrif3iytom rln i;s trxr(opnodom nlnct s  Dumxm ;o1apenifeiytla2rauvs u)aleoif tadlm elu s t0 ruoxmpnu1lpen nvilt aDraxmp;t0aet ii3tytla ean pnt0aexrmfcta1op raueo t)seuoxr3nu1ll e ivta( arta(r nu4optomfctyt mDum(vp (0artnmf3oo1opt  nvilt0 exrio3oydaptn ietlsf rtm( ooo0olxniictydfaDemnmonu0tlxoirciodoa  lueo;s0srxoim iu4open iesa( aDrauro;u1aeeoif3iytfm uanmo (4 ltniocto1opDraueol()t2tmim nodop n nesatf Dtaur ot0olenmf3iad m2eaumsnt4 ltnxo3tadfm rlieo t  rtm(mpny1ameelncia(  2tr(m ;u1olxn ietadfaDea(vp;(0areoxf3oo1fp  aneo;()s2uoimpno1ol e ivtlt  2tr( o;t0aetoioeiyt m2ul(mp;u0arenxociy1fptr uvols0 etrxo oydlle  ncsas) Dtmumpnu0tpxn o3iyd a2rlnms;(0 ltrxf3iatlm eli slt0s2umiopno1ap elfctat)sDur(mpoo4aexnmf3iatfs ra( snu) etoif3iatla  ln i s setrio oy1om nlnvsatf 2uaumont0oleo feiydfm2emnmsnu) lxrmo oytopDe ieil(0s2tmxmpnudol  mics s sDtau ono1ape mietatfaDra(mo u0trerxf to1oa  aneo s) 2xm(opnodlp e fvi s) rraxm nu1tleomiciltlaDum(monu) ltnxrcto1fm r uvi (0seurir3oy1amenlics sf Dtaxmpoo0alenmoetysfm2ra( o ()teenmf ia1fp rlnvs t srxmio ny4amt lfctl()arrru pno1tpt  octadfaDel( o;u4artrirctadlmDelnvo;s0sruoxr3iu1lpe lfvt () rtmu pot0tlx moeils m rlnmon()tetnmf oydfaDraues;()srxo(r3nu4ol   fcs t)s2um(  ot1oeeomf3iltfs umnms;t) etrxf3todoa rlueo;s trxmir nudapen icil( a2taum ou1opxo o3tldfsDumn o;()trxnmr iytop eln o;s0 eum(rpnudlmeemneiat  2ra(  no0oeeoiiciydla ra( s;(0 reoio3iadlmDeaueo ( s2tmiopnydamte fciatf Dra(monu0oee ii3tytfm2ea(mon(0 exnif3totfat auesls teumxo iodom  lncslt  Durxrpno4oexnii3ild aDelumon()tetnxociodfa r ueslt teuo(o oo4opee fctlt) 2taxr ;o1oetomfeias mDea(vsn()tetoircty1lat aieo ()setoio nu4lmt  nvilt)aDrrxmont4apx mociyd mDuluvpnt)trxrmr3io1laDr i i ( srumxopoydap n iei s s2taur no1oltn o3tyslsDumump (4 ltoxfcoa1lateaivol(0t2umxrpoo4omt  iet tfaDrmxrono0opeoiiciadlmDua(mpn(0 rxrio tadopD lues;t0t2tr(m3iy1optn icilsfs2tm(  ;t0tlx  fetld mDra(mpn(4tltrmrciy1latean olt  2xrxm io1al emnet () 2umumooo1apenmf3tatfm2rlu snt0alerxo ty1fatrau s;t0 exrxr nodame mnvtls arraxmono0oexoif3ilt sDrl(mpnu) etnir3oodlmDelneilt)s2trxrpiy4omenmicsls aDurxmoou4alxomieiysfa2rluvo u)artoio tydfpD luvo;s  eurxopnudaltnmnvsa(f rtmxront4alx  oeiysfs2uluvont4artnir iy1op rauvi;s0srtmxr nu1optelivil()sruau pnu4aexo fetldfa2emu pnt) rtoxr3oytfatr iei s  exrxm3ny1al nmfcs s  2uax p;u0altomieiadla2ulnvs u0 lenir3oadlm  aueo;s srxo(m3oo1lm   fvsl() rrrxrpno0opx mfetatfa2rm(vpn()trtomr3iydfmt lieo;t)sexoimpnodal elneia(faDtm(  nu0tpxnmf3tyd aDum(vont0 rxoxocia1op r neo (0truo(rpiy1amee iviasf Dumxr ;o0aeen fetld mDeanvo;()arenmf3iadopDraies ()srxoim3no4ap emnei ()a2rmumpoo1tltomiciltla uluvs u4trxnmoctatlmDelnvi s texrxr oudlme  icil(  ruau  no4opx  oetlsls2uanmp (4 etoxrctydfm eln s;t)srxmxm oo4lptemfvi (f Dtru pou0tpenifctysfm2um(ms u) lxoxo oy1la   i s;t t2toir3iudlp  lieslt s2tmu p;t4tlt mi3ilt a emuvp u4altnifcoydfmtrlnvs (0srumxrpiudlptn nvsat  2ua( pot4ape mfciatlsDrlu pnt0artrmrciy1fm   i olt0 2xoxmpoy1lptelics t)aDrrurooo0aleomf3tyt mDeanms t)tltomociytomteai i s  rtoxr3oodop nmieia(fsrtrx  no0oet iiciydfa2rauvpnt4trxrmf3io1lpD lu o;t trurir ou1apte fesat)a2rru pnt0alen fciad s ulnvp (4aetomf3ta1la elivsl(0setmimpnu4olen fvt tfsDumxr ;u0aexnifciatfa rmu o t0trtnmr tatomtelu ols)trum(o3io1ape  feta(fsDur( ooo4tex iictat sDuauvsn(4teenxocia1lp eluvils teumirpnu4ole lfetls)aDtrxmp;t1aetnmi3tltla2umumo t)arxrifcto1omt lieol( srtrir oy1lpe mict (fa2raumpoo4aptomo3iys m umumo t0 lxrioctotlmD anvo;( s2umxo oo4ame  ncias)a2rmx pot1alt  feildfmDea(vp;()artrif iydla  luvs;s)s2ur(o no4amee icsl( aDraump;o0alx iicilsls2rmumo;t) renxo3tytoa r i o s t2trio3io4omt  fci s s2ur(rpnu4aeeomi3iadfs2ulu p t0 lxnif oodlp rluvols)srtrxrpnu4apt mieiltf Drmu ont4oexomfciad m umn o;u)aeenxrcty1omte ues;(0 2uoir oo4oleelfetasf 2rm( p;o0olen oeiltla2ulnvp t)trermf3tadop rln i s0srur(m no1omtemivtls)aDtmur ;u0teenmf3tas a um( s u) renmociy1lm r uvi s0teuoxrpnodlltnmfcia() 2taxmo;u0ole miciys mDeluvo;(0tetomfciodop  aivo;( trxr(r3iy4op e ncs s aDrmxm ot0alt  feiltfm2emn o t4 lenxf iotla e nvo;s s2xrir3no1lpte nviasfsrumu p;t4olxomfciatfaDra(msn(0 lerxrcia1fp e uvils seum(opiy4op  mnesl(faDua(mont1apxn feiyslm emnvo;(4tlerxf ta1lm eanvsl(0s2urxrpiy1al  miet sfsDrau  ;u0apt micils mDua(vo () exoxr iatlpteaieilt srxoim3oudam nmnesat) ruax o;o0optoifeiatls rmnvpn(0trtrif todlm rlieo;t srxrio iydomeemicsltfsrtmu poo1tet mfeiydfaDumuvsn()teenif oy1faDrau ols) rumxm3iu1amtemictl()a2raxrpot1aptnmo3iaslsDumuvo (0 ltrmf oodlpteauvi;( teumim ou1om  lieia(fa2taxrpoo1teeo feiltlsDuauvo;u4trxnmo ty1om rluesls  2uo(r3io4lmt lfvsat)sDuax  ot4oeto o3ilslmDumumon(4 etrir3oy1la eaivils0 2trir3iu4apeelnesltfsrumxmooo0olxnifeiydlm2ul(vs t)tlerio io1lmDr n s;s  rurio nu1am   fci t sruaxm nu0altn ociad a2em(vpnt)trxomo3iytom   ivs;( t2uoxm oudlle mivta() rtmurp;o4oltomoctltlm2rau snu)texoxrcoatlmt  neo s) etoim3io4alee nvtls  Dtmxmpou0tpt mo3iytfaDum(ms;(4trtrxr3iytop  lneslt)srxr(mpnydlmen ieils) 2tmumont1alen oeiadfsDua( snu4treoxo3tatfa   u olt0 exm(m nydopeemict sf 2raurpnu0olxn oetltfs2ulump;t0aeeoio3tatfmtr nvilt trto(rpnu4llte nctatfs2urxront0tex  f3ildfa2rau pnt4trtomocoadoa   n o t0s2xm(rpiu4lltnlfcsas  Drax onu4tlxoiietltfsDrm(mp t)tetrxocootfmDrlues;t0teto(m3no1lpenmnvils) 2uax pot4aleomoeilsfaDua(vsnt0 renxr3tadlmte u ol( t2tm(m3oy4lpeemfvsat  2urx onu4tee iictld sDrluvpnu4 lxrmrciotlpteln i (  exr(r3ou4lle  iet s s2ur( p;o1oeto oeiadfaDea(vs;t4tlenmociotomDe uvol(0srurio oy1lm nlfeiasfs2rax o;u4tpe ioeilslm ua(mp ()tetrxfcoytomtrlnvil( seumim3iudal elnvt t  rtau pnt0opeomoctasfm uauvsnu) etnxo oodlaDeauei;(  2xoxm nudol nmnvil( s2umx  ot1alxo oeiat sDelnms;u4trxrmr iy1lm  auvi (0 2xm(o3ny4ll   ivta()sDra(  ou4opx  ieias s2ranvs t4 rerifcoytoaDraneil(0srum(m io4lm e fesls s2ururont1oeeomf3tldla2rmumo;u)altnmo oadfaDrli o;()s2umim nodopenlfvtltfsDrau ooo4aex  ictadla ea(mont4arxomo totopDe nvslt0texmiopoo4op nlncil() 2rm(mooo0alen f3tytfaDemuvon() etrxf tydomDr ies (0srxo(rpnu4ll  miei s) 2rrxmono4opx  f3iltlmDeluvs;(4altoxrctadlpDeau ils trtmiopoodlmen nvsasfartr(rpno4tpxoii3ild s2ulumon()alxoir oo1fpDrauvo;( t2xo(mpoodamenmfctl(  rtmxr nt0altn o3iasfs elu s u)trtoifctatoatrauvilt t2xmim iodll  lfcs s)aDum(mp;t4ale mieiatlsDumums u) exnmf ootfm eaivi t0trxoxo3oo1ll n fctas sDuaxrp;o4tlto ociltfs rlumo u4 reomo todfmt lnvi (0 rtmir io1ameemicsasfaDtmxrp;u0optomiciltls uaums u)tltomr iatlp rlu o;s) 2xrir3nodole  ivi s)arrm(  nu0oexnmf3iatls2ua( p t0tltoxr3oatfm ranes t)t2urxo3iy4ome mncta(faDtr(rp;o0apxoifetltla rmn on(0trxomo oatopD anes ( srum(r3nodaltelnci t  Dtau oou0aex ifctasla em(mp;u)arenmf ty1fpDean o;t0teumio3iudamtemivsl(fartaum nt0tptoiiciatfa rlnvp u)trenxo3totfmtelu ols0t2trxmpoodapeelieia()aDurxrpou4tpxoii3ilsfsDul( s;t) rxomrctadfat livs t)s2trxo3io1altn ietasfa2trxr ou0aet  octadlm el( on(0aexrxr3todoptrai sls)trtrio3ou4amte fcsl(  2umump;o1olxnmfetytfm2elnvp t)aetrio3iodlm   i olt) 2ur(r oodllte nvt s)sDraumont0opx  i3iat a2uluvsnt4areoif oadlat lues;()teto(r no4ole lici t) Drr(ront4tleo octltfmDumu onu0arxrxr ootlm  luei t)sexrxr io4ll n nvtltf 2tmurpno4tltn iciad m2uauvpnu0artrxo3oodop rlnes t trurxm3nodaltnmncsls aruax pno0alt mf3iydfsDuanms () rxomociy1lpD anvolt)t2xoir3oy4om  mfci s  2ta(mpot0tpen f3tydlmDrm(mpnt0tetnifciy1laDe neo ()s2xmxr nudap nliet tf Dtrxr ot1ale iiciydfa2em( on()aexoxfcoy1oa e nvolt s2xoim ny1op nlivi tf Dtrum oo4tpe iieilsls2rlumpnu4tlxnxfcty1fatrln s t sexoimpoo1al  lietlt)artaxrpno0oexnmfciatlmDum(ms;(0 lenir3oatoatrluvo (  2tr(r oo1lpe mneilt)srtmxr nt1tpeoio3tysla2em(vo u4 exnxo3tydlaD au sl()texr(m3oo4lmt lfes s)aDrmxmpnu4alxoio3tltfsDul(vsn(4 ltrxf3ia1fa   i i;(0s2tr(o3iydllt  nesasfarum( ont0tpenmfciatfsDeaums () renio3ia1lp e nvols) eum(opnudlmt  netlsfaDrmxr ;o0optn octyd a emu ont4tltrio3iytfpDelivs s0s2tr(o oodll  mnct t)a2rr(r ou1tet moetat aDrmums;u0trtrxfctadoaDe nvol(0s2xrxo oydom emiei t aDrm(mpot0oeenifeild mDrmumon(4aexrif ta1la e uvslt t2urxr3iy1am e fvslt)aDua(m ;o0oex moctytla ua(mo t4 etoxf3ta1omDranvi s srxmxr no1aptnlivt s  2rrxmp;t1aleo octas mDumu pnu4arenmr3tytlat  ieil(0t2xmxmpiu4lp  livt sf 2tm( o;t0oleo fetatls2el(msn(4 ltomo3todopt lu i t  rxmxmpiu4aleelict s  rrmxrpno4aeenifcildla elumo;t0tlermf iodoatean ils)seum(mpno1ol  lfct t s2ta(m ;o4alt if3tldfaDra( o t)arenmf3oydfmDraueol()srxoxr3oudoleemfcsasf Duaxroot0opto feiasfaDua( onu)areomr3oytfmDrlieo t s2urxr3iudop  micsls) Dta(rpnt0apeoif3ildlm ua(mont)texnmfcia1lat  ieol() euo(opoudamenlncia(  rrr(m ;u4apxo icild sDrauvp ()texnir tadoa  au il()texmio3ny4olt  iet s srtm( oou0olx  fciatla2rmnvo;()trenmf ty1omDrlnvs s trtmiopnydam  mieilt)aDuaxronu0opto fetadfs umn o;t)tlxnxf oydfateli o s t2toxr nudlp nlnetlt)s2ua(mpnt0apt mieias m elumo (4tlerio tadoaD au s s) rxoxmpoy4alee fcsltfartm(rpou0aeenmi3iyt aDra( s (4tlxnmr3iodlpD luei;t trumxm oy1aptemfcsa(f 2ur(m ou0apx mfcilsla umnvp ()texrxocoodla r ueols)teuoio ny4amt  fesls)s2rmx pot0opxnmoeiadfa uluvsnt4artnmrciydlmDrln sl(  rumxm oo4al e nei t arumumpno1aeeomoetad m2umumo;u)treoxociytop   nvil( s2xr(r iudomeelfvilt)s2uaurp;o0aeeoioeiatfm2rau s;t0texrmf ootfp eaiei t) 2xoir iydamt  fvt tfarurx pnu4olt ioctyd s ulu p;u) exrmfciatoaDeln ilt)trto(r3ou1am  lnvi t)artax  ot4aet iociasfmDean s;(0aeenifciydlat  uvi s0s2xoimpiy1lme  ieia() Duaumpno1teto ictytla ra(mp (0arxrxo iodfmteaivolt  2toxo iudop n icil( s2rru  ;o0ope  f3iytlsDuluvp ()tlxrxrcoadfmDean sl(0teum(o no4lm  lnvs (f Dtr( p;u0oeeo ocilsfa el(vs;(0trenio todlate u ilt0teuo(o nydlm emnvs t  rra(  oo0tltnmfeiydla rl(msnu4tlenmrciodfmteli o;( srtmim3nudlpen fcia() Durx onu0tpx  ictlsfs ul(vonu)treomr3oytopD  nvi t)trtmirpno4lmen fes sfsrtmum oo1tle mi3iytlaDrm(vp;u)texnxr3io1opDrlu o t0s2xr(opiu4alen ietl( arur(  ou4oeeomi3ils aDuau o;t0aeerio tadoaD  neil(  rur(m3no1alt lnvs ()sDum(r no1opxo f3iyt s2uan ont0aexoxo3ty1fa   uvolt) rxm(o3ou1altnmivtatfarraum nt4tex moctlsla el(mo;(4aetomf3iadlaD lieo;s)sexmxr nudlme  ictas  2tr(mp;u1optomo3ild m ranvsn(4alxomr tadoa e nvo s0srxmio3ou1al eliesas sDrr(rpnu4tlx mociat a2eanmp;()teeoxfcto1fp rau il(0 2toim3no1omee icslt) Dtm(rp;o0tptniieiydla2ra(vs (4treoxf ia1la   u sls0srtm(r oydlm nlfvtas)sDrmxmono1oeeoifeiys m elump;u0tltnmf3oydfa rlieo (  2triopnydlptemnctlt sDrr(rpoo1apxo fctldfs ua(vp u4arxoio3to1op eanes t texoir nu1apt licslsfsDtru pnt0teenmi3iadlm rmumsnu4tlxoxf3iatlpD anvi (0srurim3iu1al  mnviasfs2rm( o;t4olxo ictas aDrlu snt) rxnxo3tydomD li i;t) 2xoimpiy4ap nlnvtl(faDtaxmpou1opt iieildfmDumumonu4areoirciatlp eaivi;s0 rxoxrpnu1op  lfci sfsrra(  ou0olx mi3ilt sDua(vo (4trtnmr3io1op  lneils) rxr(r3no4omeemietat) rtrx onu0olxnio3ias mDul(mont0 rxnxf oydoaDeluvi s0srurir3io4al   nct tfsDrmur oo0tlxoii3tyt aDeanvont4 lerxo todom  au s;s)seuo(mpiydale lfvt t  Drm(  nt1aee ifciyd sDeln s;u)altomr iytfmteli olt) etoxr nydlmen fviasfs2rm( p;t1olxomociltls2rauvo u4aetnif3ty1fpD  n s s0seumir oy1amee fvt sfa2uru pou1opxn octld a rm(vp;t4alenxf iydomDranes (0srxrio oudamtemivt tfaDraumoot1tltoii3tydfm ean o u) eeoif iy1om eanes;t) 2umir oo1amt lfesa(faDuaxrpou1opx iociytls2elnms t0trxomf3io1la eauvi (  2uoir iu4apeelicsas sDum(r ou0olt ifeiasfmDemn ont4trtoxo oa1la elues;() 2xo(o3no4aptn fetasfa2taxrp;t0oexo feiyslsDra( on(4aeenif iydopteluvi;s0s2tr(r3oy4al  mfcsatfaDrmurpnt1texoio3ildfa ranmo t)alxoxoctydlm raivi t s2xo(mpnodolt  nvtls)aDum( pnt0opx mictlt m umnvp u0tlerxr3oa1omt aivi s  2urxo3iudap elnvslsfa2rmxm ot4aetoio3iyt s el(mp ()aleoxf oodfat luvi s0 etoio io1al e ivta()sDtrum nt1apen oetysfaDuaump u)teeoxo3iodoaDr ivo s)seto(o iudaltnlivslt)a2rr(r nt0aeenio3ias a2rmuvp u) etoif3ta1fpteln i s seumxr3nodaltnmfciat sDraxrono4oex ii3iytlsDrmnvont4trtnxr iytopteai i t0teumio3io1ll  lncsa()s2taxmo;t0olxnii3iydfa2rm(vp;(4artoir totfate iei t t2xoxm iydal nmfesl(f 2trx  ;t4teen iciad mDua( p;u4 ltnxr3oo1fat  n o;s0texmir iu1ale mictl(farta(m nt4oltnmoeiys s rm( p;u4 leomf3totfmDeaues s)texm(r no1altnlnciasf Dtaum nu0aptomfeiadfs umnvp;t0teenxr tytlaDrauvo t)srumxr3io4aptemnes (f rurxrpot0tlt moeiltlm2rm(ms u4trxrxr3io1fpte uvi t) 2xoiopio1ale  nei () 2rm(m ;o0texomfciydfa2el(ms t4 etrxr3oa1lmtrlueo;t trumxm io4omt  nct ()arrmump;o4aexoio3iasfa uanmo u4teerxoctytlat auvs;(0 rtmxmpny4lpe lfeias  rur( ooo4texn iciat a eaumpn()tetnmr3todomDeaivsl(0t2toim ny4lltelnctas  2rax  nt0oltnmo3tltfsDrl( o t) ltrxfcoadfp r u ol( texm(o3ou1omen ncsas  Drrxmpoo4tpt ii3tls aDrm(msn()aeeoir3totlm  li s;t sexrimpny4lmeelfci ( s2umurp;u4tltn ietadfs ranmp;u0 ltoxf3oa1omte i s;(0t2trxm3ou1op emnetltf rtrump;o0teeo octys a rl( s;u4aexnif tydlmteln s (0s2xoir3oo4lmte nctltf rraxro;t0oet  ocilt a2elnmp;t)tlenxociadlmD li slt0texrxm iu1lpte iciatf 2rm(ront0oee ifeiasfsDemumsnt) lxrir iodoaDeau il()sexmimpoodlmt lfvsa(fs2ra(ro;o0oet  fcildlsDeanvo ()texoxociadom  lnes;(  ruoxopiodolt lfei sf rurxmpoo0opto oeilt a uauvsn(4 rxnxoctydlmDe u ilt  ruoxmpoo1op nlfetl()s2ua( o;t0oetomictltls2umuvs t)altrif oytlaDr uei;t)t2tmxr3ny1omee icil() 2rr(root1teen oeiasls2rlu pnt4 lxoxociatfp  auvs;t s2to(r3iodalte nctas sDrmxm ;o0texnmoetad m emn p t) etoif3iatomD luvo ()setmxrpiy4ll n ncsat)aDrmur ou4oleoiieild aDua(ms;(4aeeomo tadfm e u i s setr(rpou1olen ncsl(faDuax  no0alenmoctydls rmnmsnu)trerif3oo1latelnvslt)srxr(mpiydolt mivtlt)a2rm( p;t1aex  ictls s rlu pnu)tlxnxf iatoa  aivs;t trur(r3oo1ameelfciasfsrrrxrpoo1aptnmoetytfa2rlnvo;()aetnxfcta1fa eanvo;t0 2um(r no4ll nlnci ()arrmu p;t4aex  f3tatlm2eluvo u0arxnxocoo1op eaies;(0seum(o no1ame lies ()aDrmxr ;u1tlt miciatlsDrl(mp;u0arermr ootfmDr u ilt0teur(mpio1lm  lieta( s2rr(m ou4apxn o3iys m2emn sn() rerio3iadoptr iei (0t2xr(m ou4altnlivs s a2tmu pnt4aeenif3tasfs2rln s u)aetnxr io1lp eau i;s) 2toio3io1lpt  fvi t arrm(roou1aptnmictld a rl(mo;t4trxrircoytfaD lnvolt0trxmir3oo4ap nmfci (fartmx  no0alt mietltlm rluvp t4 eerifcoodfp e neolt0t2tr(r iu1omtnmicils)s2trumonu1alxn icias a umnvs;u4 rerxocoa1omt  nei s)s2xoxopno4omtn iesltfs2urx o;o0aee  o3iatfaDeanvo ()teerxrctodom raies;t)texr(mpoy4lpt lnetat)arurxm ;o1apxomfctltfaDrmu snt4trtrir3iotlmDrli i s)sexoirpiodoleelici ( sDrm(m oo1tptomf3iyd mDrmu s;(4altoif iadlmDrln ol(0seuoim3nodaptnlnei t a2tm(  ou1tltomociadfaDrmnvs (0 exrio ia1lm r n s t)texr(mpnodoleelicta()s2tau o;o4alx  i3iytfm2rlnmo;(4trermo oydoaDrliei t0 eto(r ny1lptn ncia( a2uaxmo;t4tltn i3ildfmDuluvo;() eeomrcoatopt ln ilt0sruoio3iodapte ncil()arurur no0olenmoeiysfs2emnmp;() ltoxf3tydfpD aueo;t0teto(o oudlptn feslt)aDtaxr ot4aet iiciydfm ea(mp u4teeoxr oa1fm  au i () rxm(opnu4altnmnvil( arrr(  ;u0apxomo3ilt m ulnvp;(0arxrmf oydoaDrluei;s0srtmxr3oo1altnlneias) 2raxm ou0opeomi3iat mDeluvpn(4 exoio3iotfpDranvi;s0 2xm(m no1lmen nctl()aDurum ot4tpx  o3iysfa2uanvpn(4alxrmfciotomD  ieol(0setoio nydoptemfvta() 2ra(m ot1oet  ietas m2ean p u)artomr iatlpDrauei t) exoir nu1ameemfciltfartax ooo4apxo i3tadfmDrauvs t) lenxo3to1lp eanesl( s2toxr3oy1ale  feilsf 2trx  ;u1apt  ociyt s el(vo;t4tlxoxocoytlmDelu il(  rumxr3iu4lpenmnesl() Dtau  ;o4oleomociys m2em(vs u0 lxrmr3tydlate u o;s0 rxm(mpoydaleemivs sfs2rmumpou0olx moeiydfa rl(vsn()tlxoir iatom  aivs s  exmxo3iu1lptelncilt artmx  nu0tlx ioeiyd s uaumsnt)tltrxf3tydfmDeluesl( trum(mpnu1llenmieta(fs2tmx oot4optnmo3iad m2elnvsnt4 lxnxfcoa1fatr nei s  rtrxo iydamt  fctlt  rra(r ou1aet mfciydlaDulumont)aexnmrcio1omDrlivolt0trxrir iu4lmte netl(fa2taxmooo0apt mo3iydla emnvsnt0 eenir3oo1la r i slt0 2trxr no4ame lfvslt s2tax  nu1oexomieild a ulums (0trxoirciatlaDr uvo () etr(o3iudal nlnet t)arrru ono1oetnmoctlt a el(vp;t)aeeoircoy1oateaieols trxr(rpoodol elnct s)a2tmxrpnt4tlenmi3tydlaDel(mp;()treoxrcty1oaDeli s ( srxo(m iudol emivsasfsrra(mooo1oeeo ietldls ulu snt0 rxrmf tytomte ivi;( t2uoim3nu1ol  mivtls)srtaur nu4aeeniieiat a emnvp;(4alxrxr ootfate uei t) 2xrxrpoodlp elneia( aDraumoot1oeeo octytls um( o;u0tltnmo3iatfmDelnvs s sruoxopny1lm elnctlt aDrr(r ot4tetomfeiydfs2rmumo u) reomrciatfmDr neslt0 euo(o3oydapenlfeslt a2tr(mo;u0aet ifetatlm2ul( pnu)teeoxrctadom rln ils s2xoxm io1amt miciatf rtaxr ot4olt ioctadls2ra(vo u)aetomr3oatoaDrlnvils0 euoxm iy1lpeelivslsfsrurxmo;u0opxoio3iat a umn on(0trerxfcoydlaDe ivi;t0 2urio ou1ome  fcil()sDumumo;o4tex iiciat s2eln ont0tltrmo oadlpD  ieo t0t2xmxo3oy1omt mneil()s2raumpoo0oee moeilslm2elnvpn(4aeeoir3to1fmtrai ol()tetmxr3ou4aptn nvsas)aDrr(m nt1alxoiicilt a2uanvo;(4aetnif iodop   u ols setoio ou4ol e feia(  2um(rpnt0tptn feiatfa ulu s ()altoir iytoptrlues ()tetmxo3nydllenmieiatf 2rr(ro;o1tptomictldls rm( s;(4trerifcoodfpDraues;( s2umxr3ou1ll  mies tfsrtmxrpno0teeoiiciat m uluvsn(4 exrmr3oy1laDrauesl( s2umirpnu4oleelfctls arurxm ot4aet mf3tys m2elu s;u0teeoxr3iytfaD luvils) 2uoxo nu4lp e nctlt) 2umuroot0tlxnio3iltls2uau p u4aetnxf ia1omtelivils srtm(mpnodapen fci () rra(ro;u0aeeniocilt mDrl( o u0trxomocootopt lues s)trto(m ny1amt licsl(  Dum(  oo0tpenmfetld s2ul(mp (4 etrxo3iadomteaiei;t)trurir3oydlltnmnetat)sDtmx pno1ale  i3ilt a2eau s t)aeeoif3io1omt lu ol()texo(m3nu4lle mfci t)sDtrxmo;u4tpxn ieiad s eanmp;t4tlermfctytlaDeaues s srto(opoo4amtelnet () rraxmo;o4alenmieiyd sDean p u0trxoifcta1om eaneo s t2xmxmpou1ol  mnes tfaDraurooo1tlx ii3tltla2ulu p;u0trenir3iy1lm  anes s  2urxmpiudale livsat sruaxr nt1ape  fctat aDuln s;u4tetoxr3iytlp eaieo t0t2tm(r io1alt  fes t)a2rm(mo;o4alenmf3iytfa eauvon(0tlerio3oy1fat lueo t  rtrim3oy1opte ivt ()sDrm(  no4teenii3tld m rm( s u0tlxrxfciydlp e i i ( s2urxopnudoltelnvtls)sDtrxrono0tpxnmfciyd m2eaump (0artnxr totom elivo;t0 euoirpou1open fvi s)aDra(r ;o4aexnmfciysfaDum(mpnt4 etrir oytom elnei s0srtr(rpiodop e fei (fs2trxm ;o1texn f3iytfm2ea( snu0 rxrmr3iadlat lueslt0t2xo(m3oo4olee fcs s arrmuroot0tpeoiicias s ulu p;t)treoxf3tydlpDr nvs s s2xrir iodlltnmnvtas  rrm( p;t1oetn fctas s ra(ms;()artrxrcoo1lpt aueo;t0 2xoxrpiodlpen fet t a2rrumpno0alxnmoetydlaDuaums;u) lxrircoa1opDrai ilt0texoim3nu1aptn nvias)artmx pou1aptnmictysls2rln p;(4 lenio io1lp  auvi s trtoxo3nodop nmfvslt srrrx  ;o4alx ii3ils aDum( pnt0tltrmfcta1fa  au ilt)trxmxm ou4apee ictls) ruaumonu1aptomfetlsla2ea( o (4aetnmoctatla  lies;()trxr(o ny4om elnct s) rtrur ;t0tetoiieiyd m2rmn p;u4aexnmr tytfm r i il( srtmxm3no4amenlfes t)a2tru pno0aexnmi3ilt s2emuvonu0alerxf tatlm r nvs;s)seumir oo4amtemivia(  rua( poo4oeeo i3ias m rlump;(0 lenmr oa1omDe ivol()s2xrxm3ny1al nlfeslsf Drax pot4oex iieildfaDuaums;t0 eenxo oytlpt  u o;t0t2tm(o3oo4aleelfct s  2ua(r oo1oee moctasfsDem(vpnt) eeomo oydopt ai i (  2tr(opny4olenmnci (fsrrrumo;t1aexoiiciasfaDrmn s;t)altrmf3io1fmt  neol()t2xrxm iy4lpenmivia( srum(r ou1texnmoetldlaDrau pnu4arxnmfcty1fmDrauei () eumxrpiydlptelnci t)srur(r oo1oeeomictad m2ean p u4alenmfcoydlp r u s;(  2uoim oudlleemivsltfarrrx  ;u4aeenmi3iat aDemu pnt0texomfciytfmDeaues;t trxmimpoo4olt lies (farua(rpno0texomfciatfaDrm( on(4 lxoxo3totfmtelueo;(0 rtmir3oydlmeemietat srua(  oo0tlenmicilsfa2uaumon(0altnircoydlpte i ils0trurxo3oudlm emneta(  rtrxmo;t1oex mictytlaDem(vp t)aeenxf tadopDe ueo;s)trtmir3iy1lpt mics tfarumumo;t0oee mf3tlt a2ul( p;u)arenxfcio1omt  uvsls texo(r io4olen fct s)a2urx ono0apxniiciyt mDulu o;t) ltoir iodlpDrlneil( trtrxmpiu4al elfcs () rua( pnt1aex  ietytlmDea( s;u0 etomrcto1latraueo;(0teumxm3oydlmte fet ()a2rmxr no0tlxnmi3iys m2ea( p;() lxrmo3tydfmDeaiei;(  2tr(rpny1lmenmicia(fsDtr( poo4olen feilslsDemu p;() lxnio3tatopD aieol( t2toxrpoodomen fetls) Dtrum ;o1oleoiiciasfmDuaumonu) rtoir ootfaDran i t0s2triopou1al nlicsas  Dtr(rp;t4ale mfctydfa emump t0arenmr3iytoptrlu ils0t2xrxrpoy4apte ncsl(farrrxm ou1opto fciysfa2umumsnu)trxnmr tadopt lneo;()texo(opoo4lptnlivtlt)s2um(r ou4ale io3tlsfaDum(vo u4arxoxr3iydlm r nes;t teurio3iu4lm  mfviat srtm(rooo4tpto f3iydfmDrlnmont0aeenxrciydfaD anvo;t)t2xmio3nu1apen fci t arum(r ;t4aetn f3tas sDulumo u)trenmo3iadlmDrli olt)setoxr ou1am elfetas s2tmx ooo4optn icils m2eln p u4trenmrcto1faDe ivo t sexmir3oo4lleelivtl() Drr( o;u0apxoioeiltlmDemn o;u0arxrmr oo1lpDe ies ()seumir iydole lnciasf 2trx ont1aleoif3tadla ea( p t)alxoircoy1omDrln o;s0s2xoxo no1llee ivtl()s2rauronu4teeniiciydfs rl( s ()alenmf oytop  anvsls t2uoxr oo4lmtemivtat  2rmum nt0apxn o3ildfsDumumo (4aetomr3tatfat ln i;()trumxm oo4lptnlnctasf Duaxr oo0tlenioeilsfsDumuvp;u0tltrxr3to1fat livs;( seuoxrpny1lptemiviatf Dumx  ;u0tet iieiadlsDrl(mo;()aexrio iadfmDr u i t0trtmxr3nudomte nct t sDtm(rpnt0texn o3tltfs2uluvp;t0aexoxocoatfpt aneils)teuo(mpny1al n ics s a2tmurooo0aetomf3iytls uanvo (0alxoio3oa1lpDe n o (0setoirpoudaptnlnetatf Drm(r oo4tleo fcilslsDua( sn(0aeerxr io1faDe ueolt0sexm(opio1lle livtatfsDum(mp;o0tlxnioeild s2umnvonu0aexnxfciotfmDeaneo () 2xoxo ou1op e fet (faDumu  nt4tpxn f3ildfa emump t4 rxnifciatfpt aueo;() eumim3iudolt  fet sf 2uaur nt4tle ifeiat a2emums u)altoxo3oadfm   ieil(0t2umxrpiodlltnlncils) 2rrxmont4tlxnioeiadfaDranvon() leniocoatlp raueo (0 2to(o3no1apt lictlt sDtax pnu4oetnii3iytla rm( s ()tltrir3ta1optranvilt srurxr iydopeemivt ( sDtau poo1opt ifciyt m eanms;u) ltnxf ootomD lnei;s  euoxo3oydol  mfcs t)s2um(monu1tex  ieiydlm emu on() rtrxf oo1fa rau il() euo(r iy1ol emnct tfaDraumono0tpeo octadfs2rlnvo () reoio iadop elneols)seto(mpoy1ll   ncs (f Drr(ro;o4olto feildlm2rl(mont4tetnifctotopt  nesls) 2tr(r3io1llenlncil(  2rru p;t4oeeoii3ilsfm emuvon(4 etnxr3oodoa  luvol(0s2ur(o ny4olenmicsl(fsDurxm no1oex ioeiltfaDumums u0aexrmr3ootom  lneo t srxoxopoodom elfvt s) 2urxmo;t1opxn oetlsfa em(ms;(4 eeoir iydfmtr u s;(0 etmxo iodop nmiesa()srtm( ooo1alx ii3iysla eln o t0 ltomr ia1lmtraies ( t2tr(o3nydal n netas  2ua( p;o0olt  i3tldfs eln ont0 eeomfciy1omD li il(  eumxr3nudol nmfcs t s2uaxm no4optoioctadlm2eanms (0arerir todfmDe uesls0s2tmio3io4lpt mics tf rtr(m nt4olxnmi3ildla2rm( p ()aeerxo oodomtraues (  2to(m3nudaptelicsl()artr(m no4aetoio3ias a ulnmp t)texomf3ty1op r ueil()t2uo(o3no4op nlfeia( aDtax pnt1oexomfciltlmDemuvon(4 rxoif oa1fpDranei s  2toxr no1lp  lfei tfsDurxrpnu1opxo fciaslaDranmo;(4 reoxf3oatfm  lu i s  eurim ny4opeeliciltfsrraxrp;u1alenmfciyd mDumumsn()aetnir3iy1faDraies;() 2umirpio1am  mnvtat a2taurpoo1tle mf3ild s2ra(vo u4aetoxr ootlm elneol() rtmir3nodlptnlnctl( arumuroou4altomietatfs2el(mo;(4treriocia1fmD livi;t0 2ur(o ny4altemfet ( s2trxm oo1altnmoctldfm ulump;t0tltoifcoatlm   nvo s) 2xrxm3oodapeelfcsat s2tau ont0tex  i3tld sDrmn ont0aetoxfctadlpteaneo;(0srxoir3oy4am nmfcias) rrmuroot1aex mieiydlsDuln p t4aexrxoctadlmDelivo t tetoxm3nodlp   nci sfsDuax ono4aptoif3ils m emu s (4treoio oytopDe nvi;t0s2urxo3iy1ameelivtasfsrrau p;u0alxn ietad m ean p;u4aexnir3todlp eai i;s)s2xmxm3oo4ol   ivt t sDta(m ;t1oexomo3tad m ra(mp u0 exrxf3oatom e nvs s) eurxm3nu4lmte nesl()arrax  ou4altnmfeiadls2ranms;u0arxomo3iy1omteluvs;(0 eumimpio1om e nvt t  2rrx  nt1alxnmietadla2ulnvpnu)tlxnir3oodlmDrlnei;t0 eumxopnodlm  lfcsls)sDtrumo;t4tlxnmieiltfsDrl( p t) rtoxo ta1oaDeauvo;s0teumxo iu1lp n fvsa(  rumxr oo4aptnii3iatfm rln s;t0teeomo3tatfateaueols)setoir3oo1lmtelnvia()a2rrxrono0aexnif3tldfm el(vpnt4 rxrxf3iadlatranvo (0sexm(r3oudamt lfci (f 2trxmo;t4texo icildlmDeau s u0tltoif ta1lpDelnvi;()t2xrio oo4ll nmnes tfarrm( onu4oeeniieiyd a2ra( sn(4tetnircoo1lptrluvils)seuoim3oudomt mictlt) 2taum oo0openifetys aDeluvp t0trtoxf3tytopDraneols0 rtrio io4apt  net s aDrrxro;t0alt ii3iasls2uanms u)trxoir oo1fa r u il( trtriopou4lmtnlnvi t aDrr( p;u0aex iociyslm ulnmp (0 etnmrcoytoa elnei;(0srxm(rpoydoltn iciltfsDtaurpou1aleoif3ildfaDuluvsn(4tltoir tatlatr uei;(0 eumxm3oo1oleemnci (fa2urxrono0oex  ociat s2emu p (4 eerxociy1lpt aivi;t)s2um(r ou4apeemnctls  Drm(r no1aptnif3iydla ua( p t4 lxoxrcio1om rai s t seurir oy1lmtnmfvsas artmu  no1tpxn ieiasfa2rluvs (0aleoir oodfaDr uvs;t t2tmxo3iodalenlneils s2umurp;u0aptniociasfa ul(mo;t4alerxf ty1lm elu o;( t2xrimpnu1apte ivt tf Duaur ot1aexniictlslaDrm(vs;t4tltrifcootfpte u o;t0setmio3iudlp   ictat aDtmxm nt1texn oeildla2ua( o u)teeoxo oodoa elu o;s) euo(m3iy1ll nlneil(farrmumpot1opt iicilsfaDemu pn()aexoio3io1om eluvi;s)t2xoio3nu4lmte ictas  Dtrxr ;t0aex ioetls sDulnms u0arenxfciodfa elies s srtr(m nydop  lnes tfarta(rpoo1open iciad s2umnvo (4texrio to1lateaueol( trurxm ny1al nlici t) rraumpno0olx ioctat sDrm(vp;t0aetoxfcoadomDraieslt  exm(rpno4ll nlnct ( aDumu pno4aetn ieildfa rmnvp;t) rxoif3io1fate i s;t)teumxopio1lltemnct sfaDta( pnu0tetoifciat mDel( s u0areomoctadlp  luvs () 2um(m nu4lltnmictas)srtm(roou4aexomietyd s emnvo t)trxoif to1lpte nei;t0 2ur(m3oodamt  ncs (fs2um(rono1teen iciydfm2em(vp;u4aexomrcty1opt aueo t  2tr(o iudoleelfcsa( aDumurpot0opxnifetyslaDrluvo t)tltrmf iy1lm elnvslt)trxoxo3ny4am  lfvi (fs2tmxr ;o4opt  ociltlm umuvp (4arxomr3oatlpDe nes ()srxrirpnydalte feslt sDua( pnu1tltn o3iatfmDumn p;(4 lermr3tatla ran s ( t2um(r nu1ol nlfetas)sDrmxm no4tle  oeiltfsDrl( snt) lenio iydom e i o s trum(opio1alte nvtltf Drr(mp;u1opeo ociyd m emn snt)trenxf3iodfp   i olt0s2umxm3nudapenlneilt arur(moou0oet ifctatlaDelu snt)tltomr3totla   uvilt)s2trxm3oodaltnmies sf rtax  no4oexnioetltlm2umumpnu) rtoxfcio1oat aivslt teto(mpoudlmtelivsas)a2urxronu4apxomo3tytfsDrmnmo;t0alxnmrcio1fmDr i i;(0trtoio ny4omtnlnvsa(fa2trumpot0tltnif3tldls2rmu p t4 eerir tytomD lu sl() eum(r3oodlp e feilt)s2rm(m ;t0tltnmfeiltla umumpnt4 leriociodoaDrlu i (0texo(r3ny1lm emieils)a2ur(ro;u0tpt mfeiatla um(vonu)arermo3oytoatelnes (0trumiopno4ol   icsas  2tmumont0oeen i3ils s2rm(mon(0areriocty1fmt li i s0teuoim3ny1op  lictltfsrraumo;t4aexnif3tytla2ulnvo u4 rxrxr iodlpD ln il(0 eumirpoo4ol n fcslt)s2rr(  ;o4oetnioeiytlm2em(mo t)altrmo totlpDelnvsl()t2tm(m iydome mfes t)s2rr(ro;t0tpxoif3iatla ra(monu)tlxrioctatlatrai s;( s2urio nu4lmteliei t artmumoou0olx ioctyt m em(mo;u4tlerxrcoatfmDeauvi t0sexm(o3nu1lmtnmfesatfarrm(mp;t1aptomo3iytfmDemump;(0teenxf3iatoa  aieo t0srtm(r3no1ol nmicia() Drrxroot4tle io3iltlm ra(vs;u)trxoio tatlm  anvi s0srtoio3oydam elnvt (  Drrumo;o1apxoioctldfs ulumo;(4areomf3tadlp rliei t teuoxopiy4ol emfct s a2tr(mo;t1teen ietas m ulnvo u4tleoif3iatopt li o;t srxmxo3iu4lptnmfes sf Drr( p;o1tle ii3tltfs ua( p;u)aeenmo iadlmD aieols0 euoxmpiy1alenlfctl( srra(r ;o1olxo o3tyt aDean p ()aleoxo3tydlmteaiei s teto(o3io4omenliei t)srta(mo;u0opx mfciat sDrmuvonu4teeoxo3totlate uesls0 rxmxr3nydale lnvt tfsrua(roou1ale moeilsfs2em(ms;u)tltrmf iydfpD aivs;s0t2tmxo oy4lltelnvi t) Dua(r ou4ale io3iltfaDrlu p (0 reoxfcto1fmtrliesl(0trxoirpiodlpt  fei s aDum(mo;t4aleomo3iasfm rmn sn()altoxo ootopDrln ols0 rxmio nu1al elfvil()arrmxr no1opeo octad a2ean pnu) rxrio iotlpD  nvs t) 2umio3io1al e ieslt  2taumo;o0optnmocils mDumnvo (0trtoifciatlm rai o;t)t2trxm io1apt mictls) rtr( pnt4tlxomi3iyslm2uaumpn()texoir iotfpte nvi () rxr(mpnu1apeelieia( sDumxr ou0tet ifeiyt a2umn on(0tetnmfcoa1lmD an sls0sruoirpoydlpeeliei ( s2urumono1tlxo oetlt aDuanmo ()arerxocia1lmD anesl(  etrxrpiy4altelivsatfsDra(rp;t4ale  i3iysfs2eanvo;t0aeenir3iy1latr neil()setmxrpnu1ll e fvia()aDtmum oo4tltniiciltfa2rm(vs t) rtnxf oodom rli i s)s2xo(rpou1lmen fvi t sDurx p;t0apen f3ilt mDra( pnu0 rxrxocta1fm  aivs;(0teumxr3ou4ole mnvil(  2urxmoot1olt io3iyt aDelnvo t) eeomr iatlpt  nvsl()s2xo(m3oo1om elfct sfsDta( o;u0ole  ocils s eanmp u0 ltnmf3oatfmt li s t  etrim ny4ome  ivslt) Drm( pnu1oltoiietasfs eaump;()trtnmf3oatoatrlnes t)s2toio ny4amt lncias) Drrxrp;t4tpeniictls m2ulumo (0tlxnmrcoo1om eaivi s) rtrxrpiudlpenlieslt a2rmxronu4alt ii3iaslaDemuvp (0trtomr3iy1faDelnvs;()trxoim iy1opt  feia()a2tau oou0tltnmictydfm rmump;u0 renir3iatoa  an i;s0teuo(r3iy4opeelnvia(fa2uauronu0ope  o3iaslm2uanmsn(0texomf iydfpt ai slt)texr(o3oudlmeelfct ( s2rrurp;o1aetnif3tydlm rmnvo (0trxnmf ty1faDe n ilt0trxm(r3nydoptn net (farta(rp;o0tpe mi3tat a el( sn(0 rtnifcta1lpt  n s t t2toio iy1opte ivi ( a2ua(ront4apxnioetasfs rm(mpnt)trtnir oytfpteaneo;s0trtmir3nu1lp e ivtls a2rr(m nt0oeeniocildlm eau ont4tleomrcoy1lp  au olt0 rxr(rpiy4amtnmnct (fa2trx o;u0aexo i3ild mDrln on(0aetnmfctotoatelivilt)srtrxr3io4lle lfes (  rtrur no0oleo ocils s emumsn(4aeenmrcoadfmt lu s t  2urxmpoy1lmeemfviltfs2tmump;o1aexnmo3iys sDrau o t)altrxr3iodlp   ues t0 rxmir3iy1ll nlnetat)arumxrono4opto ieiytla2ra(mo u)trerifctodom   n ils srxmxm3oo4alenlnvslsfaDtmxmonu1aet ifeiytfa rl(ms;t0texoio3ia1fpD an s;t  rtr(o3oy1lpe lnetat aDtr( o;o0oexo ietld aDemn snu) ltnxr3tatfpDe ieils)tetoxrpiudlpee iei ()srtau ooo0ope ifeiasfmDulnmo;() ltnmr todfmDeliei (0s2tm(mpou1amtnmnvsl() 2tmxro;o0tpx  o3ildlm2emums t)aexnxf iotfaD au ils  rxo(r3iodam   fvs s  2rr(  no1oexomfctlslmDua(vs u) rermr3ty1fpD  nvi t  etrirpiudlmenlieiat)aDuru  ;t1tlxoioctlt m2umnmsnu4altoio iadfp raueo;( s2xmio iu4lmt lfcilt  ruax p;o4apeomieiad s rmump;() eerirciodlp elivo;t)trxmim nu4lltnlfctlt aDta(rpno0oet mi3iadlsDulums () lxoif3ty1fp eln s (0trxmxm3io4lp  mieta() Durxmpno4aptnioeiydlaDeaump;u0alxoiociatfpDeau i ( seur(m3nu4ll  mict t sDta(mpnu4tlxo oetasls umnmo;(0trtoxr3ta1fp e ueil(0s2umim iudllt mivslt)s2ua( onu4aee  ieiyslm2elnms;(0aexoirciotlptrli i s0 ruoxm nodlp e fei () ruax pnu4oeto fctysfmDea(mp;(4 rermr iy1fate ies;()texmxopoudlp nlfcta(fa2uax pnt1opeomfeiat sDul(ms;() eeoif tadfat auvslt) exo(o3iudomt mfctl()srrax p;o4opxn feiad aDelumon()trenmfcoo1fmteaies;s) exoxr iu1apte ict tf rrr(mp;o0opxoioetytlm2ranvp;u0 reoxrcta1op  luvs;s  etoxo3nu4apte fetas)s2raurpnt0tlt  fctadfsDrm(vsn(4 exoxocta1lmDrluei;s) rur(rpnudope mncil() rrrurp;o0tlenifctaslaDrmnvo t) exoxr ootoaDrlneilt trtm(rpno4lmt mict ( aDra(mo;o1altn o3tltfmDuanvo t0 lxomrciy1omtean sls0srxmirpiydoptelfeias srtrx  nt1altnio3tyd s elu o;t)teenxfcoa1fm rauei (0srtrxo nydap nlfvs sfsDrr(  no0apx ifeiys mDumuvs u) exnxr oatfate u i;s  2ur(r no4lmtnmnvs tf ruru pnu1opxo oeiat mDel(mont4aexrxfcta1lm eluvsls0 exo(o3iudol nlfei t) 2ur(rp;o1tlx  i3tadfs uluvp (0aexomr3iatlaD  i sl(0t2trir nydam elivsat sDumuroot4apt mo3tydfs ua(vont4aeerxf3oo1oa eanvsl() 2urxmpiy4omenlietas aDrm(rpnt0tpt  ietytfaDuau o;(0trxnmf totlpt lu s;(0 2xoio3io4oltnlivsls a2uaxm nt0opto fciyt m umums u0 rxoxo iodfpDeln s ( teurim3iodap nmfvsa( a2ta( o;t1oexoifetls s2eln p;t) etoxr tydopDrli i ()s2xrxm iydlmee nvtlsf Drm( pno0olt ifcilslsDrlu p (4 lenircootlatelieil( srxoxmpiudomt lfvil(  rrrxr nu0oee  iciasfaDua(vsnt)artriociadoat  ies s  exmxo3nydalt mictat aDrr( p;o1oexo o3ildlaDranmp;()altrxf ty1fp elivslt)sexm(o3iy1lpee net sf Dururpno1aexn ieils aDel(ms;t)aexomrcto1lmt  nes s teumxm io4olt mnvi sf rrrxm ou4alxn ocilt m2umuvp;u0 ltnxo3tytom rlu i;s  exmir iu4omeemnei t artax o;t4oet if3tydfmDrmnvo u0 lxoiociotlaDeluvs ()setr(rpnodome mnvs (fsrrmxrpou0apxn i3iydfaDrlu sn(0 lxrmf3oodlmt auvi s  rxrxo iy4omenmivilt sDrruronu4tptomoctlsla ua(ms;(4alxrio3oadlm rlivo;t0sexo(mpiy4oleelfvias sDumumono4aetn icild aDumuvsnt0 rerxrcoytlat  nvo;() 2xoim oo1lmtemfesls aDrmum ;t0aptnifeiadfmDumnvs u4tlxrio3oy1faDeluei s0sexmimpno4ap elfctas arra( p;o0aetoiieiys a2uanmsnt) etomoctodoate ueo t t2uo(m3iy4opeelnvias)artm(ro;t0oex  feiat a2elnms ()arxrio tatoa  luvi s) exoio3iodap nmict t a2uaxrpoo4olto i3tld m2ulnvs;() ltrxfcio1fatelivs;( t2xmim nydomenliciasf Drau p;u4ape  i3iytfa2rl(von(0artomo3iadfpt  nvsls s2toxmpoy4amtn feia(fsrta(mpoo1olt  fcias s2uan o (0aexrmr3ty1fa raivsls0 2umxo3iu4lmtelnctls a2tmu pou0oeeomieiltfm2rluvo u)tltomfctadlm raueo;s  euoir oodll nmnvi tfs2tmurp;o4alen i3iat mDum(vs u4 exrxo iy1faD aiei;t t2tm(opno1omtelivia(fartmxrpot1tee ifetas m ea(vs;t0 lermr3oydfp rai slt s2xrim3iodam  liesltf rrmumpnu1olenioctlsfmDum(mp u4 lxrmr iodoaDrai s;( s2xrxo3nu1ame  ncsls s2rm(mont4tpeomi3tat m2ea( p t)alerxo3tydlatr ivi t s2tmxr iudopeemietl( sruaumpnu4tlxnmo3iatfaDrmumpn() etomo3ootlmDeai ils0 exmxopoudoptnlict (fsDra( pnu1tptnmieildfa2ua(vont4teenxrcoo1fpte uei;t t2ur(opno1lltelneta( aruaumo;u4aexnioeias aDrlnvpnu)tltrmr3iytfat lnvsls)truoxrpno4lp n iciatfa2urx pno1oetn ietytlmDulu p u4 eeomo iy1omDrai slt  2xrir3io1am  miet s srrmuro;u4tlxomieiytfs umnmsnt)tlenmf io1lm  auvo s0s2xoir3iu4lptn ict t  2rm(r nu0alx ifeiltlm umuvonu4aeerxf oo1fatr u s;t trxmxmpiydll   feslt  2tmxrp;u4tltoioeils aDulnmo;t0 renmociytoaDelnes;(0 exo(m oydlp emfvtat  2tau oou1optniictasfaDrln p;(4teeoxo3tatlm e i slt  eurxopiydamenmiesatfs2raurpnt0ape  iciaslsDuln ont4arenxr3ta1op raiei t0setmim oo1lmeelfvtlt arumxrono1opx mi3tas s2um(vonu0 eermo ta1oatr uvil(0srur(o3oudllte iet tfa2trur oo0tpeo fctytfsDuanmsnu0 ltnxf tytop e neils0teuoir iudlptnlfvsl(fs2rrxmp;t0tptn iciadfs elnms;()alenxo ty1fptrli o;s)srurxrpoodaleemictat sDum(rono4alt  i3iysla el(vp;u0alerio oatlatean i t trto(o nydopte iciat)aDumu p;u1ope ii3iaslmDeluvpn(0aeerio3io1faDeluvo s setrir ou1apeemieiltf 2ua( p;t0ope  f3tyt mDel(vonu4teerif3todomte ivols0t2trxmpiudame lncsa(  2uaxmono4aexoifctytla2rlnmsn(0trxrmo3iotlm rli i;t0sexr(o iy1om nlfcilt)s2rmum ot4oexomfctys a emu p;u4tltnif iy1omD lu ol(0 etr(rpiu1ll nlfcsa(faDtrx oot1aexoio3iydfs rauvo u0 reoxrcty1oa r ivo s)seuriopou4op  lnvia(faDuaxmpou0teen ociaslaDrlnmont4trxoxo3io1laDrlies t t2xmiopiodom   ivsat)arua(m ;t0ale ioctldlm2elu o t4altrircta1lpDrai s;() 2uoim3iu1lp e nct tfarta( ooo1olt  ietytfaDrm(mp;t0trtnmfcoy1oa rauvi;s)seuo(o3oo1lpe livs s) 2rr(m oo0opt  feiytlmDrl(von(4texoxf oadfp  lu o;(0t2xmiopoy1al e ictls  rrr(ronu0tlxn i3tytfm2umnvpn()texrio3ta1fmtrai ils trxoxrpnudalenmnct s srra(m ou1tee mf3tatfm2uluvo (0tlxrxo3tatfptr ivsls)tetoim no4lm e neiasfsDta( pnt0opeoiietldlm2rlumsn(4artoir to1opD ai s (  eum(o3oo4lm  lfeils)arumx onu4tpxnifctysfa elnms;(0 ltnxo3tadfaDean s;t)t2to(r3oudlmt mivtlt  2ra( pot4oee  fcilt a rmu ont) ltoir3oa1omDeaieolt s2um(m3iu1am e nvsas) Dtrx pnu4oeto ocildfmDul( snt)tlermr iytlm  auei;t srxo(r ou4alt  ietat)srrru  ;u4oet  ieiasfm emuvpn()tetrirctytlpDeli i s0 2xr(o3nydame lfvias)a2uauro;t0opxnmocilt sDumnmsn(4trtrir3tatoatrli i t)t2to(o oo1aptnmictls sruauro;u0opxomieiltfa2ra(vsn(4alxrxf3ta1op eaivolt0s2toxm3no4olenmfci t  Drr(r no1aptn feiadlm2ua(mpn(0aetriocio1faDrlnvo (0 rxo(o3nydam  lfesasfs2rmu ono1oet micild s2ua(vs;()teerir3to1fm eaneo;(0 rtmimpnu1lpe  fcilt) Dtr(  ;u1tet  o3tlsls2rl(msn(4trtrxf tydlm  li olt0 2urxo3iudap  lncias srrr(root1oeen fciysla2ua( p t0 rtnifcoodfp eaivs;t setoirpio1opee fviat srtmuro;t1aetnii3ilsfmDemumsn(4 rxoioctytfmteluei;()srum(o3nudlpee nvslsfaDtru p;t1tlxnmo3tadla2ranvpnt) ltrif3oadop rauvol() 2xr(mpio4al emfvias s2rr(  nu0ole ifeiyt m rauvon()trerioctodlmD livo t  rumir ny1optnlfcia(fsDua( ono4openioctydfs umump;t0 lenir tydoa eauvols)sexoim3nydlpen ivi sfsrururooo4tlenii3iat sDumuvp t)aeerxo oadfpDe uvi t sexr(m3nu1lp  mfciatf Duaxm ;u0aeto i3tys sDeaumpnt4 lxrxocoatfpD ai ol(0 2tmirpiu1lm   ictlt)arrrxmooo4oltoiieiat s2ea(ms;u0 etnmo3ty1omD livi () rurirpiy1opt mivilt  Drm(r nt4tpx ioctlsfm2umnmpn()altnmrcoa1oatranes t0srtmim iu4ope livsa( sDta(ronu0aptomieiytfm2rl( ont4 ltrxociytlm e ieo;(0 etmim oy1lmtnmivtls)sDum(mo;t1apx ifciytlm2em( o () leoif ootlp e iei;s) 2urxo ou1olenlici ()srurxroot0tptnmi3tysfmDrau o (0artrxr iydlatrli i t0sruoxo nodop nmnvias aDra(rp;t0tlx mfeiadfm ea(vo;t0 exoir iotoaDrlnvi s)s2tmxopiodlptnlivs (  Drr(moou1tptoii3tas s2rmuvp u4 rxnif todomt an ils trtm(o iudll e fet ()srtaxmp;o4aee  oeilt sDem(mont) lxnxo3iotlptr u o ()setmxm oo1op emnesas)arrmxmoot4ope iietlt s2eaumo t0aeeoxf3oodla  lieo t)s2umxm ny4om  lieias  rrr(mono1tpx io3tltla2umnms;t4 leomr ty1fm  ai i;s0texm(rpio1olenlieta( sDrax oot0teenmoctysfa2eauvont)trxoir iatomt li o t0tetoim nu1amtn neia(fsDtaxm no4apeoio3tls aDeln p t4alenxr3tydfmD lu i t) rtmxo iydome mivsls sruaumpou0aet ioeiat s emnms t0aexoirctatla ranvslt) rurxm3iu4ale mfviat)a2rr(ro;u1olt mi3iatls2eluvs;t4tlenxo3oydlpDrlivs;s texrimpnu4lmeemfvia(  2ra(ro;o0oeeo iciytlaDulu s;(0aetomo ta1la e ivi t0 2xrim ou1alt lictat)s2rrxr ;t1opxniieildfaDuaumon(4 exnxrcta1la eaivilt0 rto(opoo1omen ivtl() rum(mpnt0tlxnif3ilt a2ranvp (4 lxrmf tytlpDe nvi ()seuo(r3io1ol n iesls)srrrx ooo1tpxo ictld m ul( pnt4artoio iotfaDe i o ()setr(opno4lltn fcia()srrrxm nt1aexomoeiyslm ua(vsnt)aetnir tatoatrln il(0setrimpio1lpee feta()aDtru poo1tlxn fctad mDrlnmp u0 rerio io1fmt lies;(0 2tm(mpoydlpen nes sf rtmxm ;u0olt  octld aDrmnmo;t4aexoir oydfmtran ol(0trum(r3oudol n fes (f Drm(rpno0alxo fetaslsDrl( p;u0teenircoydop eauvi t0 2uo(r3oo4am n fesltf Dur(mooo0tpxoif3ilsfaDuau pnu4 rxrmfcoo1laD anei t0 ruriopnudomt  iesa(f Duaxr ot0oetn o3tat aDemums u4aetomfciatlmD lnvs s  etoxopno1amtelietl(fsDtaxmoou1optomoetlt sDulumpnu0aexnxr3to1lm elu slt trtmxm3oydllte fetas s2uru o;o4tlxnmfctls a2elnvont4arxnxf to1omtraivslt texr(o oo1lp n fvs (  Durump;o4tpe ifctlt s rauvp t4 renmf3ootfat lueils0 2ur(m iydlm nlfesltfaDtmu pot4oee  fctysfa2rln o;t4aetomfctodlpD auvi s)s2umim3oodll nlfetlsfs2tau o;u1aeeoif3tlt s umuvonu)tltrifciy1lp  aivi;t s2urir3io1ale mncta( sDuaumo;u1tpe if3iadfsDrmuvonu4teenir3iodop   ivsls teuoir3iu1lp  mnvtlt)sDrrxrpnt0opxnioeias a ea(mo t0aetrifctotfpte nvo;t0texm(o3iu4ap nmnetl( aDrm(mono1aptn fetytfm2rl(vpnt4 lerif oadfatelneolt t2tmir3io1om eliei (faDraxrpot1ape iieild m2em(ms t4arxrxrcootlmD livs;t)srtm(mpio4op   ict sfsruau ono1open fciatla2ulnvs;(4texoxo3iodfa e neolt tetr(r oudlm   fcs sfa2trxroou4aexoii3iadlm ean o;(4teeoircoytfp   neo s tetr(m iy4lmeemivi tf 2rrur ;u4oexomfciasfa rmn o;u4teenirciy1oa r i o;s)sruoir iydlm nmnct ()s2rmu ooo1aex ii3iadfa rmn s (4tetomf3iy1fpDrlieo;s  exmir ou4lleelfeslt sDrmu  ;o0alxomieiasfm2emnvonu)tlxoxo3ta1lpDe ivslt0texoim ny4omen fei ( a2rmxmo;t0altomfcils s2ra(vp;(0aexnmo3iatlmDelues;s)setm(rpny1omt  fvsas a2rm(  ;u1oetomf3tld aDrmump u)trtrio iadlmtr ieo;( trxmxm3iudap emneils  Duax o;o4tlxn ieiyt m ua(vo;u4texnifcio1opDe iei;t)srxoxr oodlmeelnctl() Duaxmoou0opeomiciatlm eanvo t0tlxrif iytlpDraiesl(0 ruoxm nodop elivia( a2rmumoou1oetniociltls2ulu pn(4aleoxrcia1fmtrlieo;()trurxopoydamtemneslt) 2rm(  nt1alt mfcilsfm eanvs;t0 etnio3ia1fateln sl( t2toxo io4ll elivsat)aDuru oot4ope ioctatfs umnmonu4tleoio3iotlmD anvi;t)teur(r ny1optelivslsf 2umxm nu1aleoiicildfmDelu onu)areoio oytomtr ivs;(0t2tm(o3no4apen fct (fa2ta(  ou1tlx  f3iyslm uauvo;t)arermfciatlpDeliesl()srxoiopno4lpe  ictlt)a2rmx  nu0oet  ictldfm2rl( o;(0altrmr io1faD  ueols trtmxo3io4altelnesa()a2trxm ot4tpxo oeiys a2em( o u4teermo iytlpt  ues;s  eto(r3oodam elfvi t a2trur ;o1alenifeilt s2emn snu) eenxr3iodoatr ivil(0 exoim iudapt miei t arraxmo;u4apen iciltfa uluvs;u) rxrif iotlatranei s0trxoiopiu1om nmnci s)a2rm(m ;u4alen ociys s ul(vsnt4teermr3oatlp r uei;s  rumim3oo4amt  fvtas sDumump;u0aexomo3ias m2umuvp t) exrmf to1oaDrlues;t0tetmir3ou1am nlfcilt  rurxm no0apxniociadlm ran s ()arxrif ta1omtelu s s srtrxr3nodal nlfctasf 2raurpot4tlx mieiad s2rl(vp;u0tetnio3iydom raneilt srtmxm oodlp emnvtlt  Dur(rpoo1alt  i3tydla ea( o (4artnifcoatlaD lueo;t s2xmio3ny1lmenmneslt)srum(moou0tex ifeiytfa eanmont0 eerxr3oydfa   neilt0s2xrim nodlmeelictlt  2ta(rpno4oetn fciyd a umn p;t0alenir3oy1om raivi s)t2toiopnodlmtnlnvsatfsrrrxronu0altomieiasfa2emnvsnt0tltnif3ootlmte ivs;t0sexm(m nu1ome lncsat a2ra(ront0tlt  fctld sDum(vo;t)tetrmrctytfpDe nvsl() 2trimpoydlmeelfcslt) Dum(mooo0alxnmo3tldlm el(mo t0altoif iadopD aneo s)trxoxm3iy4oltnlfci () Dra(moot1tpeomoctatls2rlumo (0tetoio iotfpDr nvols trto(o oy1opt mnei t)aDumxmp;t4opeo oetaslmDean o;u0tetnmrciytfptrauvi;()s2to(r io4oltnlnctlt) 2um( p;o0tlxoifctltfm2rauvp u0trenmo iadlmD luesls0t2urir3no4op nlfetasfsDrmxmoou0aptoifctlsls uluvs u) eeoir iotfp elnesl()s2trio oydolt  fetasf Drr(mont1oexn ieiys sDuanvon() renmrctytlpDraivolt)s2uoir3oo1opte icil( aDrruro;u0teenmfeiyt s2umnvpnu) rtniociodlaDeau i s  2uoir ny4ap nmnesa() rrmumoou0oeeomi3iltlsDran pnt)areoxo3tydfmt  ivs;t0srxriopou4lpee fes (fsDtrum nu1tet  f3tysfm rlu o u4 ltomo tadlp   u i s texoim nu4optnlfci s  rur( pot4tptoiictyt mDra( s t0 lenxfcoadlm   ieils t2xmxo nu1optemnetat sDum(m ;o4olx io3tldfa2ul(vo;t0altoxocia1lp eaneol( trtr(mpiodolte ies (f Dur(  ;o0alxoio3ilt a rmumont0 exoio oydomDeanei (0 etmxr iy1am e icta( aDum( p;o0oetnmoeiyd m2ul( s u0treoxf3oodfm r i slt)tetmxm3iu1olt mivsas) Dumumooo1opto oetasfs2el(mont) reomo oatfpt lnes;s)t2xr(rpoo4lleelictls aruru o;o1opx ifetad m rlumo t)aleoir todoa r uei;t0s2tmiopiu4ole licsas a2umu pou4tltnmietytlmDumumont)tltnxfciotlm  anvo s tetr(m oudomtelivsat)aDurumo;u4tlx mfciytfa2ulu o (0 etrmf totlm rlu sls  2uoxr3nodopte fvtasfs2tmurpno0tpen oetysla2eaums;(0tlxnmf3io1lat liesl() rumim oudoptn ivs sfsDur(roou0texn f3iysfmDumnvo;u)alxnmfcto1oaDrauei;t0teurxo3iodal emfei ()arrmxrpou0texnif3tyslmDrmumpn()aleoif3oo1opDrli o s0 2xr(m3oo1omtemnciat  rtmxrp;o0teeoiicilsla2ulnvp;()treomoctytfaDeanvo;(0 rtoxopno1lp  lfvi t arurumo;u4tpx  i3tld m rl(ms;t0tleoircoadoa eli slt)trurirpio4lpen ivsls arurx onu1texnmf3iys mDemumsn() ltoiocoytfm  aneol(0 rtoxmpnu1altemfvs ()s2rrxr nt1altoioeiydfmDrmu onu0 eenmr iydlm eau o;( t2xoxm ny4ale  ies (farrrump;t1opxnioetytls rm(vs t4 lenmf3oy1fptelivo s0sexmxr nu1amtemici tfa2rrump;u1teeomi3tyt aDean p;(4 exomo ty1opteaiei;s)s2xmim3nu4ol nliciat)a2uaxm nt0tpx iociaslaDrlu p t4areoif3totfm r i i t0 2xm(rpio1ll e ivsatfs2tr(m no1alx iieiatlm2rlumpnu0 rtrmr oytom  auei s  eur(r ou4olee ivtls)aDrrxr ;o1oetoifeiydls eanvo;()aexoif3oadfmt  u s;s) rtrimpio1amee fct s) Dra(ro;t1aleomfetldla elnmp;u) rtnifciadlm eau il() eum(mpiudllt lnesas  rtmu onu4oetoiiciys m rmn o;u)arenmf iadoa rlnvsls)s2tmimpiu4llenlnvs t)srumu  ;t4tetomfetytfs umumsnt0alxrxocoa1fate i sls) rxoxmpou1lp elivsat) rrm(rpnt4tpxoif3ilsfsDeanmp ()teerio3ootoa rlieo (0 rtrxmpnu4lltemncilt  Draxr ;u4aee mociydfa el(mo t0tltrir ia1lm rauvo t tetoxopiy1ope  nvsa(fsrurx  ;o0tetn fcilslmDrmuvs;t0texnircoo1fmDeau o;t)s2xmimpoodamen ivsa(fsrrmum ;t1olenmoetldla2rmnmo;(0 etrxr iadoa r ies;()teuoio3io1am  mneia(  2uaxmonu1aeto i3ildfm ea( o u) ltnmfcia1fmD auvils)teurio oy1omenmivi s  ruru
\ No newline at end of file
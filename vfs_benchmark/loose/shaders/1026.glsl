@@ -0,0 +1 @@
+ieol(  2xrxopiudlpenmfvtas)a2trxrpot1opx iociytlmDrlnms u) rtrif3ootfatean ols t2tmxrpiudlltn nvtasf rrmxm ;t4apx mf3iad a2elnmo u4alenmf ootlpD  u olt0sexo(o nydll n icslsf 2rmx pou0alx  ieias mDran o (4artnirctatla  lnvs s)s2xmxr iy1oltnlncta(f rrm( p;u1tlx  fcild m rm(vpnu4aetnxrciytlate i o;t  2trirpnodlpe mivt s)sDrrum ot1aetnmiciadlmDel( pn(4tlermociadlat livi;s t2xrxopio4ope mivtls) rurxm no4openmocildfs rlu s () reoxf3iotlaDe uvilt  2tmio iudaleemfeilt)s2ta(m ;u0tetnmfetyt m2emump u4 exnxf ootlm rli s;s tetmxr oo1op nlnei () rta( ono1optnmfctyt sDrmumsnu0 exomfcty1lateaues;t s2xo(opoudapenmiesa()aDrrum ;u4altnii3iadfsDemn o t4 lenmf iadoa rau i;t) rtmio ou1ol e ivsas)a2raxmpnu0apx  oeiysfmDra(msn(4alxrio oytop rlivo;(0s2um(r iy4apt mnct t srurumoou1oexo f3tytlm ra(vo (0trxrio iodlaD ai s (  2xoiopou1lmtnlicilt arumu  no1tlt  oeiyd a2uau s ()texrio3iy1faD ln i;s)srtmirpiudoltnliei tfsDtrx  nt0opxomieilsfm2uanmsnu4alxrxf ty1fa eli s;s  rurxopny4lm   iei sfs2umurpot1oexnmoeiysfa2rm(mo;(0 eeoxf3iytfpDe iei (0 rurxo nydol elnetat arrm(root4apto fctas sDuaumon(4artnxfcoydlaD  nvs t0 2xriopiydom   neil( aDtau p;u4tlxomi3iasfaDrm(mont0tlerxo tydomt lueo (  2ur(m ou1apte ivsas aDurum ;u1texoii3iadfm rmnmp u4aeeomo3ta1lpDe uei t)trxmiopnudam n feta( aDtrx ooo0tlen oetas m eanvs;u)tlxoir3oa1optrlieol(0t2umxr ou1al  mfcsat aruax pnt0oeeomieiydlm rlnmo (0aeerif todfpDr n ols0tetr(m ny1ll  mfvtat) 2ua(r nu1aex mfcilt s2em(vp t4 ltomr oodlp  lnvs;t0teuoir iodame lfctls)a2ra(rpou4aeto octydls eauvsn() renxfcoa1lptr ies t srxo(r3oy1ame  feta( srtau oot4texo fciltla2rluvs;t0 renxf3tydlm eauvols0texoxopoudamtnmfvtlsf 2rm( pnt1apxnii3iydlm rl(mp;u) rxnxr oa1lp rlnvslt) etm(mpoy1lmtelivsa() 2trur nu1tee mietlsfmDea(vont4teermr iydfa   nes s0 rumxo3ou1al  lneilt  Dtmumont1olt  i3ilsfsDrmumo;(4trxnmoctydoa e u i t  rto(rpiy4amenlfeil( s2um( o;o1aexoifciltla ua(ms;t)areoxo3ta1laD aivi t0srumim nu4al elnesat  rrmumpno0aleomo3ias m rl(mp t)aeenxrctadomD  uvol(  rurim3oodomtnlnvsatf 2rm(mpot4tptnmfeiadfm2rmn o u4teenmfcty1omtraies s t2to(m3ny1lp  lfvtas  2ra(rp;t0tex  feiytfa ua( s;t) ltnmf3ty1fp eli i t)tetoxmpnydameelnvias  Dtm( pou0tpx mo3tatls2eluvo t)aeermr3iadlp  au ilt0 rxoxm3nydolenlfvs tfaDrrx o;u1aex ii3iatla emnvp;t0 etrmo3oodfat aieo;t)teurio3iydal nmnvslsf rrruront1tpt mf3tls s2um(mo u0teermrcia1fptraivs;t)s2tmxmpnu1llt mfesatf 2tr(mo;t4tlx  ieiat aDea(vs (0aeerxfciytlm raivo t)s2urxr3ou4ape mnctlt sDra(mpno1tpxomietasfaDel(vs;u4 eenir totfp  anvilt s2toimpnydape lnciasf rur(ronu1oexoifctat s2rm(vo (0arenxfcta1fa rliei s s2ur(rpoo1olee ivt s)arrrur ou1tpt io3ilslmDean on(0 eeoif oo1omDraneo s) eum(o3iu1lmt mnvtas)a2uau o;o1tpxn i3iytfa uaumo;u4areoir3oy1lmtrlieo;(  rxr(o3no1ol  lietatf 2rau poo1olxomocilsfsDua(vsnu0 eenmr oa1lp rlnes t) rum(r oo4ol e icsa(fsrrmxm ;o0tet micildls elumo;(4trtnmr oydfaDr ueols)trxo(o3iu4lpt lfetat sDua(r ou1oex ioctytfs ua( s;t0arerir tadfp e u i;s)s2urxo3nu4op nmnctls)sDrm(m ou1aptn i3iydlmDrm(mon()aexoxr3iotoate uvs ()truoxo io4aleelncs t s2uru  ot1oexnmi3iaslm rmn s u) lerioctadfm raivi;t) 2trimpno4lltelnctasfarta(mo;o4ale ifeiaslm ul(vpn(4trxomr3io1fat livo;t0 2tmim oy1altelieslt) rumx p;o4alxoifciys m2elnvp t4aleoir iydfa r ivsls0setmimpoy4apt lnes (fsDtr(r nu1olt ii3iadlsDulnvo;u)artnmocto1opt  n o t0 rtoiopnodop e nei tfsrrr(monu1aleoifetas aDelumo;u0trxnxo iy1lmtrai i t)t2xoir iy4ol   ies sfa2trumonu4apx mfctytlaDemn pn(4trtnxrciotlat an i;t0 2xmir3io1amt mnci s sDrmxrpnt4oee ifciydls ranvpnu0 rtrxr3oydop  aivolt) etrxr nu1oltemfvs s a2tmx  ;u0alxoif3iyt s2uauvs;t0 eerifcootop  anesl()teurimpoo1lp  lncs sfaDra(r oo4texo fciyd a ranmonu4alerir oo1opD  ieo ()tetoxm ny4amtelivtlsfs2ur(r ou0aeen iciatfa2ranvp u) exnmf3ia1op  an i (0srxoir ny4om e nvias sDum(m ou4tptn fciltfaDuan s t)aetnxfcto1oat  nes;(0setrxm iu1aleelicsls aDumum no0altn i3iat aDumuvsn(4trtnmr oytfm  lnes;(0 2toim3nu1ol n fcia(f Dtmxmoou4teeomi3tadfa2ulnmont4 lenio tydlpDe uvs (0 exoxr3io4apt mncsat) rtm( p;u4open ictldla2rlnvsn(0 exomo io1lp elieols  2trxm3io1lltnlieiatfa2rauroot0olen f3iytfaDrmumonu)arxrxo3iotlaD  ies;s0 2xm(mpno1al emict () 2rm(moou4oeeomi3ildlaDrlnvont0altoxr tydoat lnei;t)teumio oy1lp elnvslsf rtmxmpnu0oee iociltfm ean p t0 ltomo3ty1om  aues;s)setrxrpiu4lmtn nvtas) 2ur(mooo0tlxn i3tytfaDrmnmsn(4 rxrxociadfmt aneo t0teuo(m3iudap elicilsfa2rm(moou0aeeo fcildls rmnmon()altnio iatfa eln i;s sexrxmpiydlpeemfcsa(fa2taumpot4apt mfetatfm umums;u4trenxf ta1laDrlivi s)truoiopou1apt  nvi t aDtau pot1openioeiad aDrl(mpnt0 eeoif3iotlate nvsls) 2tm(r ou1op   fctat)s2raumpot1aetn feiytfa2rlumonu0artomf oy1optelivs s0 rumxm iy1lpenlnes (fsruau p;o4apt  oeiyt aDea( pnt0trtomfciytfpDran o ( trxr(mpio4om emfci tfsrtrur ;t0tetnioeiadfa ua(monu)tlermo oodlpD  u sl()s2xoxo ny1om nlfvt s srrr(moot1tpenmo3tlt m2rln o t4tetnxo3iatfmD  nvs ( t2uo(r3oodoleemfes (fsDtm(r no1tleoio3iltlsDem( p t)tetrmrciy1fa ranvs;s0s2xo(o3oodlptemnvi s)arraum ;t0oexo ocild aDeln s ()tlermrcta1laD anvil(0t2ur(m nu4ap nlnet sfsDuru  ot4apeo feilsfm um(vsn() etoiocta1lpteaueo s srtmirpiudapenlncsls sDua(  ;t4oee io3iytfmDumnmo;(4 rerxf3totoateluvsls0s2uoirpnydolen ivtas)aDtr(rpno4tee  ociydlm eanmp u)teenir oatlpteanvo;s) eumxr oy4ll  miviat)aDum( pnu1tpxo iciatls ra(mp;t0 renxoctydlm  lieo;s0tetmirpiydomt mfvils  rrrur ;u1apxoio3tys s ul(vs;(4artnxocoodlmDeanvilt) 2to(o iydlmtnmnvtl()a2tru  ;t1texoifctltlm ranmo;u4 lxnif to1lpDe u s ( seto(rpiudol e nesa( aDur(roou4texo o3ias mDrmump t)teenxfctytlpD auvsl(0 etmirpoo4ap n ivs s sDtax  oo0tetnmoeilt s2emu p t4teenmo oodlatranvi () eum(o oodll emfvils)srraxm ot4tle io3ildls um( p u4trtoxf tatomt an i;s) etoirpoudamenlfctls) Dua(m oo4tpt mfciysfs2rmuvs t)teenmf3iytlptean sls0 2xrio nu1alt  ncsltf Duaxrpnt1apxniictyd mDemnmo (0alxoif3to1lp eau s t  exoir iu1oleemnvtat) 2rrumpou0aexnmf3iadlmDelnmp;t4aeermr3totoat li s t teur(r3ny1openlivtas)a2tr(ro;t1oetnifeiadfs2uaums;t0 rtriocio1fmt livs s trxrxm3iydomee ivta()arurx pot0oeenmiciltla2rmump u4 etrmo iadlat liesls)srtrxr3iy1apte fvsat s2rrxm ;u1opxniociltlaDra( o;(4trxnxf3iotfpteau o s) exo(mpiodol nlnesl(fa2tr(moot0aeeomocildla um(vo;t0tltnmo ta1faDeauei;t  2xr(rpoydop  lnctl() rua( p;t4opx  iciadfm2ranmp;(0alxoircto1lmtrau slt t2xrxm iy1al n fctas sDra(  ;o1teeomieiytfs2rau pn()teermrctodla rlieils) 2trxmpno1amenlfcsasf Drrxro;o1oex ii3ilslm ranvp (4tlenir3tadlm  liei (0 2xoxo3ou1lmen ivtatfs2uaur no0aptoifcilt aDemumonu0 lxnxocta1lp  anvo t0 2tmirpiu1olee ietas)sDum(  ;t1olxomoctlsfm elnmp u)trxrmf iydlpD lieo;s t2xoxopoodamtn ncsls)artmumoou4olto ieias sDranmpn(4 leoirciatfaDrluvsl(  exoxr oo4lmt  ivslt sDtmu pnu4oeeoioeiltfa2rmnvp t4 ltrirciydfa  aneolt) rurxm3no4apeelfcsl(fsDurum ;o1optoifctytlmDel(mp;u)altnxo3totoptr nvsl( sexr(o oydape  feilt aDrm(rpou4alxo ictlsfaDeauvon(4altomf3iodlaD aneo;s  2xoxopnu4lp elivsltfaDtau  oo4optomoctysls2um(vo u4tlxrxr3oydfa ean ils0t2uo(rpnu1ll n fvtl()arrrumpno4ape  octytlm2ua(ms t0alerir oatom e uvs t)t2umio oudam nlieils)aDtrx o;t1tleomoeiys sDel( p (4alxnmocoytlp r ies;()srtrim3oo1om elicils a2rrur no4apeomi3iad aDra(vs t4 renxr iotop ran s;t  rxoir iudomee fci (faDtm(r oo4ope moctys mDumnmpnu4 ltoio3ty1op r u ils)sexrxr3oudolee ivil()srta( ono4oeenmf3tyt s2ea(vs;u4teerifciadlm rau o s truriopny1ol emfctls)sDuru  no0opx mi3iydfm2rm(vpnt4 etrmo3oo1fateluvs;( teurirpoudalte nviasfs2ur(mooo0olenifetytls umn s;t) eenxf oa1lmtraivs s0 2xr(mpio4altelfes (fa2rr(  ;o4apeniiciasfmDelnvsnu0 etrmocoodlptr i i;()trtrio3nu4open nvsltf Dumum ou0aeeomf3ilslaDuln p t4trxomr3iodoptelu slt0seuoxo3iu1al e nei sfaDtrxmoou1oetnmoeiytfm emnmo;() lerxo3oydfm eln i t)t2trirpnydomte ivsasf rum(rpno4oeenii3iysls uan o u4 eenir3ta1fptr uei t) ruoio oo4lp emivilsfa2rru  nt4oleomfctat sDeanmo ()trenmo3iytlpteaneols)t2xrimpiydap n ncsas) 2tr(rpot1oltnif3ilslsDrmnmo t)aexnxf3tatoateai il() 2trir iodal n fci ( aDuax pnt1aptomieiys sDrmnmo (4 lxrmrcoy1laDeli i;t teum(r iy1omtemnvtl()srtmum ot1aee mf3iasfaDran s t) reoxf3ta1fptrln slt  2umxopnudlmtnlfei ()s2urumpot1aetoif3tas m2ranmo (4altoifcootopt  uvi () eumiopio4lpe lfei ()s2taum ;o4tlxoii3iasfs2ua( on(0trenxo oatfpt auvs t)truoxmpou1ole mict s s2taxm ;u0olt moeilslaDuau o t4tlxnmr3todfaDe ueo;(0 2tmxmpno4omeemnvi s s2taxm ot0opxnmoeiltfsDrmnvsnu0trenircoatlmt  i o ( trxmxm3io4omt licia( srta(mpnt1tee mo3tysls2ran s (0artoif3oydlmD ai ols0s2urir oydll e fesls  rtaum no0optnmf3iydfs rm(vpnt4alxomrcoo1opDrau s;t0s2xrxm3nu1aptn feiatfs2um( oou4opt  oeias a ulnvp;t4 rxoxr3oo1fa elivs;t) rxm(o iu1alt lfci (farta( p;o0apxniicild m2eauvs;u)aexnif3iydfm r ivi ()srto(o3iydlltelfcsltf 2tr(  oo0tleniieiatfaDrm(vo;u)treoio tadla  lu i;(0seto(mpiydlm  miciltfa2tr(  ;u4oltnmietadfm2um(mp ()arxnmr3oatfmteluvs s)s2trir iy1lmte fet s a2trurpoo4oex mieiasla ean s u)tetnmo iotlaD  nvo s s2xoxmpnu1lptn icsl()sDrmur ot4alenmf3tatla2el(mo;(0aetoxrcoo1oatrauei;s  exm(r3nydlltemnviat  2rau p;o0oet if3ildlaDrmnvp ()trtoir oa1lat  uvo;s)s2xrxr3iy4lmte net s) Dra(moou4aleoiociys a2elnms;u) lxoio totop   iei;( srxm(r3iu4amtnmieta(  2um(mont0oltnifeiysls uau snu)trxnmrcoytfpD livols0tetrir3oo4ap nmiesls srrr(mo;t0apxomf3iltfs2ulnvont0 etrir oy1lmt  ueo s0teuo(o3ny4aptnmfvtl( srtr( pnu0tlen f3tld sDelump (4tlxnirctotfaDeli ils0t2xrxmpio1lltnmicsas) Dur(r ;u0oleoio3ilt s2rm( pnt)alxomf3to1opt  ieo;s t2xrxrpoudamenlnetlt artrumoot4olt mf3tas aDul(vs (0aeeoxr oatopDeaues;t) 2xrxm iu1aleemfct s  rua( o;t1apxn fciadfmDeaums () eeoxrctodfpDe nes;()seurxrpnydolee nesasf 2urumpnt0alxn fcias sDulu s t0 exrmf iotfm elnvo s  rtr(r3iu4lp nlfei t  Dtrxmpoo1opxomf3tadfm rln snu0 rxomo oodlpDeanvo;(0trxmim oudlltn nvils)aDuaxroou0teeomociyd a emnvo;t0 exrxf tadlat  ies;()sexmxopiu1lp e fvt ()artmump;t1oexo feiatfsDrmn s u) exnio iy1fp  ln olt0setm(rpoudll   fvsat aDumxr ;o1tpeomociltfa ran snu)tlxnxfctatfp   ies;( trtoxo io1am e fcils) rtmx pot4tleo i3iadfa2rmnvon() etrxr tatlm elivils0truoiopoudamenmietat) 2ururo;o0apeomictytlm2rm(vp;t4areoxociatlmDe nes (0 2urio3io1openlivslsf 2tm(monu1oleomieiyt a rmumon(0arxrio3oydoaD  u i s)seumxm ou1ame mfvt t arrau pou4tlt  o3ilsls rm(vo (4 ltoir iy1fpt aueils trxmir nudol  mfesl( srtr(rp;u1aleo ietldfs2ulu s;(0tleoxo3tadoa  lues (0 ruoirpoo1apt lfet (f 2umxm nu0tltomfetad a uluvs u0altnir tatlm rlueols0texo(r iu1apt mnesa(fs2rm( ont0oex io3ilslsDuluvpnu0tleoxf io1optrlueslt)s2xr(opoo1omtnmictl( srua(rpnu4tee  feilsfa2rl(vo (4arxoif oodop elu s;(0 etrim oudop emnvtat a2rmu pot1opeomfctysfsDranmsnu)tlxnio iadlp raieslt)texoio oydlpt mfvt (faDua(mpnu4tee  ietyt a2ul(vsn(0texoio tydoateln ils)teuoim3oudlpt  iet ( srra(mpnt0alxo oeiyslm2rauvs u)trxomf3oo1oaDraneo ( srtmirpiu4llen iesa(f 2tmumont0olx mictytfaDua(vo t)arxnxr3oa1omtr i s t)t2ur(rpoy1omt  ivt t artm(m ot4apxoio3iad a eanms (4treniociotlp raneols0trurxmpoy1om n netl( arumx  nu0tle moeiytla2rlnms u4areoxr ty1opD luvs;t s2urxm3oudaltnmiciat sDururo;u0oexo ieiadfs rmnms u0tltoifcoatoaDe ivs s0 euoxopnu4ol   icta(fs2trumpot0tpxoif3iad s2ulnvs u) ltoxfciytfmtrlu s;( s2umir3nu1openlfeta()srtm( onu1oltomiciat sDulnms u)trermr3iatoa ranvols0s2xr(opoy4ameeliet () 2uaxm ;o0oltoii3taslaDul( pnt0tlenmo oatfaDe neil(0s2uoxm nudlp emnci t)a2uaxroou0oltoioetys a eaums t4 renxo tydfateln slt t2tmxopny1lleemnvslsfs2raum ou1tpen f3tysls rm(mont0tleoxfciy1fm ean ils teuoio3oo1apeemfes (f rtaump;o4tpxn ociltfa uan o;u)aexrif todomt au s;t s2ur(mpno4omtn ivsat) 2ua(r ;u1oet if3iytfs emnvo;(0alxnxf3tadfaD anvs ()s2trirpnodal  mfviatfsDurxro;u0oeenmf3iad aDuan on(4altoxo3iy1la  au sl(0 exoim nydoptemieta()s2uaurpou0opt if3tytfm umnvs;(4 eeoir3tadfp elies s truoxrpoo4lltemneia(fa2rax pou4tptomietad mDrm( pnt) exoxrciotfp rln slt0t2ur(opno1lp e ict s  Dtmx o;t1tpt ii3iatla2uln snu4aetrxrcio1fpDeluvo () eurio ny1am  mnviltfarrr(r ;o0tlt ifeias m2uau s u0treoxo3iotfp  luvo;t)trtr(m3iudop  mnvtlt  Dua( o;u4tpx ifctlslmDeau p t) etoir tydfpD lu i t0texrir3no1lp n fvilt) Dtaumo;o0tee if3tldfm2em(mpnt0texnxo oo1lmt  u slt trtm(o3io1omeelnvt (fsrurx oot1aleomiciaslsDrmuvo u0 rxomf3ootlpDranes;t)t2trxrpoy1ame mnvtat a2umu oot4aptn iciyd a uauvo;u4 lxnio3iadfp e uei (0teumio3oo1ape  nctat srurum nt1teeniicildla elnms;t) lxomocoadoa e nvo t0teto(r iu4lp n ivt ( sDrr(ronu0olen oeiad s2rlnmsn()aleomf totlp rlnvs (0t2tmxrpno4apt  ivs sfsrtaumoou0ope  fciad m ua(vo;t0aeeomf3iadfm  liei ()truoxmpnydlp  lnei ( s2tr( onu4ope mo3iyslmDrmuvs;u)altrmf3iytom rluvo;s0t2tr(m3io4am nmiet tfartmxront4alen feilslsDemn p u0 rxnmf3tatomtr nvslt t2xmio3no4ll emiesls a2uaxmooo4apeomi3tlsla ra(ms t4 rxrmo iatlp elu i;(0tetmxr oo4apeelivils  Drrxmpno4apx iieilslm2rmu pnu)altrxr iytfpD lnvols trxr(mpiy4oleelies tf rrru pou0tpt io3iadfaDrmuvo;t0 leoif oo1lptr n i s)srto(r oy1lm e ncia()a2ra(mpoo0aex  feiysfa uluvsn(0 lxrxr3iatoptr ueol( seumxr iu4ale lfvtls arraxrooo0tetomfcias s ulnmsnu) eeoif iatoat lnvs ()trtmxrpno1lp elnvt (  2rr(m ;u1teenmoeiadlm2em( onu4 ltrmf iy1lp elnvs s0sexm(o3oudom n netasfaDtmu p;t0texnioeiyt aDelu p;()tlerif3iy1fat  n olt0seurxrpiodol  lieiat) Drru pno1aeenifciasfs2ra(mo (0tetnxocia1faD auvs;t srumxr oy1am elfviatfarraxmo;o0tptnmf3iatlm el(vo;u4 etnir3tytlat li s t trxmim oy4om nlnetas) ruaxr nu4teenioetysla2em(mo;(4tlerxr tydfaDeaueo;s0t2uoim3iu4oltnmfeia(fa2trxroot4alxomi3tld m ua( s;()trxnmf ia1lp   ivo s0trtmxopny4aptnlicsl(fs2ua( ono4aeeo fcilt a ra(vs u)artoxo oodopD  nei t0trxmio3nodlmenlieias aDumxmo;o1apx  i3tlsfsDuau o t) rxrmo3ia1fmD auei;s)t2uo(r io1lpenlncil(  Dtmx poo1tetn feiatfmDum( onu) reomf3iodfmDrluvs;s0srumxr nu4omen fvt s)srtrumo;t4tpxoifcilsfs eanvo t4 rtnioctytfa  aivils0 exoim nudomtemivtlt)sDum(root0tptn f3ias m2rlnvs t4 leoif3oytfaDean sl() rtmim3nu1ameelnesa( a2tru o;t4tpx  i3iytfm2em(vs u4alxnir oy1omD an s;()srumim oy1ameemiet t srrau oou4altniociaslm el( p u0 eenxf3iotfm   ieo;()setmir oo4omtemnet t)sDtaxm nt0tltn oeiyslsDrm(vp;(0tltnifctatfpDeluvol( texmxr3no4opt lfes t) Drrumono0tleomoctldfsDum(vs (0 exnif tytfm e ieilt0tetrio3iy1omenlnvs t srraxmp;u1tee mf3iatfaDrlnmsnt) reomocty1optrauvils srurxr nodale  fcs sfsrtmx pot4apxn fcildlaDrluvo t) rxnxf3ootlp   uvilt) rtmiopnydolen ncil(  rumum ou4tetnii3tldfm umuvonu)trtnif oodla r nvilt)t2xoxopno1opeemictas)arurxmpno4oltnmfcildfaDua(mpnt0teeoifcta1laDe ieo ( srtrxm io1ap  lnvta() 2trxro;o1oex moeiytfaDulu snt) lxnxfcoodfmteaivs;s) eur(r iu1am nlivsas)s2ur(  ot0oleoif3tlslm rm(msn(0 lerxocia1lpDeai s ( seumiopnu1aptelnetl( srta(rpnt4alx io3ild aDeluvp;(0trtnio3tydlmD  uvsls)teumxrpio4openlicsat)aDum( o;u0opxo oetasla2ulumo t4trtrmf3iodfmtrli i;t) etoxo3iu1ll  mfctl( sDtrx o;t4apeoiieiytls2emnvp t0aeenxf tatlaDeaivilt trxmimpoo4alte nvils  Dtr( pou0apxo i3iat s um(vs ()tlxrif3oo1oatelieo ()seurir3oodapen ivslt s2tru p;t1tltoif3tysfaDel( pn(4aetnmr3oytopteai o t  2um(opoo4ome lfciasf Dtrx pot4aex mfciaslaDeanvp;t0trermf oodlateai o (  2uo(rpoo4openlncsa(  2ua(mono1alxoifetadfsDel( pnt0 ltnmf oydop e nvs t) etm(mpnu4op nliei s s2uax  ou4olt  fciltfmDemnvsnt0alxoir3iotfm   n sls0 etoxr nu1lp emnvs s)aruru ono1texnmo3iatfaDeaump;t4 eeoif iodoateluei;t0teumir3nu1lmte ncsas aDtr(monu0apxomociyt a2uaumo (0trtnmocoo1opt  nes;t)setmxm nu4amenmfei (fsDraxr no4texoioeiadfsDrlu snu4 renio3iy1lpDelneol()t2um(opoodale  nci (f 2ur( p;u0tet mocildfm eau p;t4tetoxociatfaDraneolt0srxmxr3oudalt lnes sfa2ur(rpno4oet ifetas aDem( s ()altoxociytlpDe ivil(0s2toxo3iu4ol n fes tfaDuaumo;t0oetn i3tadlaDrlnms u)aleoxf3io1om  aneslt) rtrimpiydll e ncs ( s2uau  nt4olxnioeiltfs2eln sn()tltrxf tytfpte i o s s2xmxrpnudlpe  fvils) 2tmx poo0tlen feiaslsDuanvo;u)tetrmo ia1faDelnei t  exmxo3nodam elnct s)srtmxr ot0alxn f3ias m2ul(mp;() ltrif ty1omDr uvo s  exoim3iy1lltnmiet sfs2umxm oo0opxnioctat m em(mpnu)texrir iatfa elnvsl(  etoimpoy1omte netl(fs2rrx  nu1tetomfctatfs umnms;u0aetnxr3tytoptelnes;s)srtoio3oudolt  ici (fsrtaurp;o1tetoifciat s2ea(vs;()trtrir iytopDeau ol() rtoir nu1olen fcia() rtax  ou4oexnmoetydls2eanmonu)arxnif3oodlm rlues s srxriopny4omtnlncsls)s2uauronu4aexomociadlm el(msnu0treomo3oydopD  nvil( t2tmxr3nu4ameemnesa(f 2rmxm nt0aeen ociysfs2ran o t)altoxoctatopte ies (0tetoio3nydamt  fvi sfs2umxr oo1apeoii3ilt sDul(vp;t)tltoxr tydla rluei t)setrxopiydlpte ivsls) 2uaumo;t1aet mi3iytfs2rmuvo;(0aexrmrcoa1fp rlnvi s)srxrimpiy1alt lnvt s) Drrumpno1tpt  iciatfmDrmnvsn(0 exnxrctatoatean i;s)setr(o3nu4ope  nesltfa2rmu  ;o4oleoifctat s2rmn p () eeomf3ia1fatrai i;s sexmim3oodop n nes t srrm(  nt4alto icildlm2ulnvpnt) exnio3iy1fpte ivo t)trurim oy1opee nvtatf rua(  ;t1aetomieiasfmDrm( p (4alenxo3iy1omte i slt) eumir3oudlm  mfetl( a2rrxmo;o0tle  ieiadlsDranmo;t0texrmr3oo1lateaies;(0seuo(mpoudlp nmictl(f rrm( ont0ole  o3iyd s2rmn pnt)tlenmr3tatoaD li o s  rurxo nudlltnlfet s a2rrumont4oex iiciasfa2eanvo;t4altomrcoo1om r nes ( sruoirpiydlptnmfeia(  Dtaumpnu1tex mfctadlmDumumonu)alxnmf oo1oaDelnes (  rxo(r oy1lp emnet t  rua(r ;u0apto o3tadfsDelumpn(0tltrxfcty1lm  li s (0 2uo(o3iy4am   ies ()arta(monu1tpx io3iatfa2ul( p u0teenxo totlmteanes t0trtmxmpiudlpenlnctat) Dumx oot0oet mfcil
\ No newline at end of file
@@ -0,0 +1 @@
+neilt t2xrxo3iydopenlicslsf rrm(m ot1alto ietytfaDrm(vs t4aetnircoadfa  lnvs;()t2xrxo3ny4lmee ncs t)s2umum no4aeto i3iysfm2emumpnt) eenxr iytoaDranes;()s2urxmpoy1apt lnvias) rra(rpno4tetomfeiysfm2em(msn()tltrmociydoat  n o;(0sruoxrpoudlp e ivil( arrm(ro;t1tlxniictldfm umuvs;(4texnmo tydlmDe nei;t)seurxo3iodamtn nesl(fsDtmumpot4olt  o3ils a2elnmp u0trxnmfcio1la r nvol() rtm(o3oodlpen ncsas)sDum( p;o0apto f3iys sDeau o t0aeerifctytfaDe ues;(  2xriopnudol e nesat)srua(r ;t4olxo f3tlt s ua( snu) lxnmfcootopDrlues t)seur(r3iydomtnmfctls)s2rrx p;t1oexo ociys sDrmuvp;u0aexrmrctatfm eau s;s) ruoirpnu4am nmnvtlt  2uaxmpou1tetomoetatlmDran s;u4altrmf3io1fp   neolt0trxoxo3iy4ap  mieiat) Dtm(root1olx  iciadlaDra(vs u) rtnxo oy1lmtr uvils0 rxmirpou4alt lfctl(f Drr(moot0tlenmfeiatlmDuauvs (4artnmr3iodlmt auvils0 ruoiopiudlltelnct s  2raurpnu4oexnmfeiytla um( p;u) etrmocoodom rli i s0 exo(opnodoltemnesls artmu ono4alt  feiasla umu s t0teeoif3oytlaDrlivsl(0tetmxmpnudlltn ict t arrr(mp;u4oleo oeiatfa elums (4 etrmf3todfpDe u s;t0 exm(m oydol elfvsatfa2ta(mp;u1apto icilsfmDumnmo t0arxnxrcta1fpt  nes;t0s2uoxr3oydlptemietat  2taxmo;u4tetnioeiadfsDrmumo t0 rtomocia1oa eau o s)t2trimpiu4lp elicta(f ruaxmp;t0optnioetldfm2eanmp;u4tlxomo to1lat  nes;t)seuo(mpnudalenlnet tf 2rmxm nt4tpxoiictas m ul(msn()tlerif oy1optraiesl( s2umio3oo1omenlicta( sDrr(mp;u1apxnmfciltfm ra(msnt4trxoif3iydoptr i s t t2toxo iy1amtn fvi s artr(mpou1apxoioetyt m elnvp u) rxoirctatfa elivi s0 2xoxo3oo4ol e ietatfsDrm( oot0altoif3ilslaDelu onu)aeenxf totlpte iei s0tetmxmpou4omt  ivi sfaDrmxmpno0aet ioeiadfsDrmnvp;() etoxrcia1omt  i i;t)srxr(o nydllte nes (faDrm(mont1tex  o3iadfm emums u4 etnir ia1om eauei ()t2uo(r ny4lpenlfvtlt)aDrmurooo1olenmi3iydfa eanmo;(0 rxrif3iytlpDeln ilt trum(r3no1omtemfvsl() Drrxmooo1olx mieiytfa umnvont) exrir3ia1lpD  u o;s0t2tmxm ou1lptnmnet ()aDtmumono4aexo o3tldlm elnmon(4 lerxr3oydfm elnesls0sexrxopou1lmtnlneil(fs2umxrpno1aeenmfetyslm2elnvs;t4 exrmfcoadlaDranvsl()t2urir3io1amtn ieslt) rtmx pou1tltnifciytlaDemn p (4 exrmrctadlmtr uvils0texrirpiudol e ivtl()srtm(  nt4tpen oeiltlm eln snu)aetrmf io1fat aneols0trurir3iydomtelfcs t)s2ur( pou1tet iociatfm rmnvont0altnmoctotfm elu o ()teuoxopiy4lptnmnvs (f 2tax oot4tetnmiciasfa2rln p ()tleomr ootlp eaies;()t2to(r nu4ll n nct t a2rmx  nt1oetnmoeiytfm ua(mpnu0alxnxr3todoaDrauvils0seuoio oodapen ictas)s2rau pou0oetomo3iyt a uln s u4aetoifciatfptr ivsl(  rxoxm iudlme mneilt)sDtm(r ;t1opeo iciatls2em( o t) ltrio3iatla rlueil()sexo(opnudol   nvils) rtmxrpnt4openiociasfmDulums u)artnif3iydfpD  i o;()setr(m3nydaptn nvilsf Drru  ;t4aex mf3iyt a ranmo u0teerifciadfmteli slt)t2umir iu1am  licsa( arrrxm ou4oee io3iltla rmnvs ()arenmf ty1fpteli o (  ruoxopoy4ameeliesls)aDtm(mp;u0ape io3iyd a2rlumo (0arxnxrctotlaDeaivi;s0srurio3oydolt mfcslsfarur( p;o1olx mfetyslm umu p t0tetoio ootlaDr ivsl() 2xo(r oodllte ncslt a2rm(rpoo1apxnmf3ils aDul(mp;(0trxoxr3ootfm ranvolt)trur(m iydllen ieil(  2uax  ;t0tet ifciltlm2ra(mp;()alxrxf3totfpDelivi;s)trtrio io4ap emfvtls aDtru  ou1tleo feiadlm rluvp;t4 etnif3ia1lat luvol( sexo(rpou4oltn ivs (fa2umuront4oexomfeiltla rlums u) rerifcoy1lm ean o t setoimpio4opeemfvsl(fsrtau ont4olxoii3iysla2rlu o u)alerxocoytfpD aivo s  exrio iu4amte ncs (farumur ;o0tptn f3iltfa2umnmont4aleomf3tydopDr neo;t)teto(mpiodom nlneils  2tr(  nu4oeenmieiys s rl(vpnu0tlermrcoadoptr uvol(  rtrxo io1lpt lfctlt)s2rrum ;t4oeeo ietadfaDemumpn(0 lxomo iodlmD  nvol(  2xmimpiudllenmnvsl( s2rr( p;t4ale ifcilsfa2um( p;t0teerxr3ta1oatrau ilt0 rxoxm3no4om elivi tf rta(ronu1aetn ictyt m rmnvpn() etomo totom elnei;s) rurxr iu4alenlnetl(farta(ro;t1open ociaslmDemnms ()aexrxo3oy1op eaueol()texm(o oo1lpt liesls artmu oou1ope mfctatlaDulumo;u)tetnioctydlmD  nvi s) eurxo3iu1ame licsa(farum(rp;u4olxn fciadfm ea(mo u4teenxf ty1fpDelnesls)t2tmirpoo1ap n nctas) Drrxmono1apxnioeiasfm2eanmp;t)trtrxocoatlatr u ilt0texr(r3iodllenmnctls) 2tru  ou0tpt mi3tld sDumums (4 lxoxf iodfmD ai s t setmirpnydamt mies s) 2ta(r nt0aleniieias sDemnvs u4artnxo ta1fa   ueol(0t2xo(m oodlmte nvt t aDum(moou1tltoio3tltlaDra(vont4alxnifciadfpD  uvi t) 2tmimpoodaptnlfvsls)a2taur ;o1opeomfciyslm ean o u4tlxoio3ia1omtr i ol(0s2tm(o3oo1om n nvia( s2rauroou4oleomoetadfs ulnvpnt) exnifcoo1oat aies;s srxrxm oudame  feslt)sDrru  ot1tpenmoetltlsDua(ms (0altnmfciadla raieo;s0trtrimpou1lmenlnet tfaDtax o;o4aet iictadfaDrlnvo;(4artrir oo1faDr uvils0s2tm(r3iu4optnmics s  Drrx  ot1teenmieiatfs2eluvs;t)trenmocootfp eai slt srxrir3iodlmen neiat) 2tmumooo1teto i3tad m rmnmo (4arxoir3iatoatrli ils)texoxopnu1alee ivtas)artmxmp;u4texn ieiatls rm(vpnu0 rxnmf iy1oaD  u s;s0 euoxm3iu4al e fvi t)sDururpou1tltnioeild s2ranvpnu0aeenifcoydlaDelu olt)sexrim ny1lm  lnvsatfa2tr(rpnt0olt  o3iysfm ul( s;t4aleoxr3ia1oaDe u ils)t2xr(o ny4op elfesas)sDtm( p;o4aeen o3iltlsDumnmon()tleomo3oo1la r nvs s0 exrir3ny1ale lfcil(farum(ront4tptnifcild aDrlump ()teenxo3oytopDrlueilt)trumxm oy4ap n fvsat  rtmxrpno1tlxomiciad m umnmont4alerif3ta1fpt lies () rtr(mpoy1opeelnesls)sDrax  ;t4tlxo fciys m emn on(0 exoxrciy1fp eli s (0setmxo3nu4omen nci ( sDurxmont1tetn feiyd a rauvs t0arerxrcootfaDe i s;t sexo(o oodlltemnesl( s2ra(r ;u0tpen oetltfm rln pnu)tleoir3iatlpD li ols)trur(r nydap elivsat  2ur(r nt0oleoio3tyd sDraums (0arxrmoctotlpDr ivsl(0 2umxr nydomtnmfctas)a2ta( o;o0tleo i3iyt s ra( o;t0 exomf oodopt  ivo;s s2umim3iy1lmtnlieiasfa2ta(mooo0altn f3tytfs2eauvp;t) etoxociatfa rlu olt t2uoxr iy1am n nct t s2umxroou4tptn i3ild m rmnmp (4aexrir oodlpD aneil()trxrxmpoy4amen fvilt)sruax pnt0tptnmfeiys m2ea(vp;t0alenxr3ty1oa r nvo;s)setmxr no1amenmivs (faDtaxmooo0tetnifeiadls rmn s t0alxomrcoa1oaDr i il() 2ur(m3ny1amtn ictls)aDtrxr ot0aeeo iciatfm rl( snu4 reoxocty1opDrlu sls  rxmio3oy4alenmnvi s sDta(m nt4aet  ictytfaDumnvon(0 ltoxf tytfaDr nvs;s sruoir iu4omeelicilt arrau o;u4oexo feiydfs uaumo ()areoiocoatfa  aneils0 exmxm3nudaptelnvs t  rrrxmpoo1aee iictldfa2rauvo;() lenxo iatla eaieols s2uoxopnu4ap  mictl()srrmurpot4oet  f3iadfa umnms;t0texoio oo1lm eaneil(0trur(opoudale mfvs t) Drmurpou1texoii3tyslm2eaums (0tlenif3oodlmD ai olt s2um(m3oudlp nmnctls) 2um(ro;t1tlt  o3iydlm rmnvsnu) rtoxr oadfpD  nei;()trxrimpio4optn iciasfartaxmoou1tpenio3iad a2emn s;u) lxnio ia1om eai s;s)s2umxmpio1altnmfetat  Drmumont1oet  ictls s2uaums;u0trerif tadfat  uvo s) euriopnydlltnliciatfs2ur(mpno0olxniieiltfsDelu o ()texnifctydfa rli ils)texm(opoydlmenlivsat aruaxrooo1tltoioeiydla ean pnt) exrxf3oydfmtelivi;s0s2tmiopiu4lmen feiat aDum(mont1oeen oeiytfaDea( snu0texrxoctytoa elues t)s2xrxo oudopte nctl( srrrxroou4ape iiciyd s2ul(vo;t4tlenircta1la eli o;t)srurxr ny1omt livia() 2tmum nt1alt mictasfaDranvp;(0arerxr3ootfatrliei;t0 eumxopou4ll e fcslsfs2taxrpoo1tlt ifeiys m2um( onu4 etrif3iatoa  an ols)srxoxo3oy4apenlicil( sDraur ;u1tpeoii3ildfaDumuvs u0arenxfctydfpt liei;( s2tm(opiy1apte nvsls srtm(rpnu4optomfctyt s em( pnt) lxoif3totopDraueo s t2xrirpoo1ope mnvs t)aDtmum ;u1aeen iciysla emu snu) exomo3todlmtr uvs t0trurxopou1ame lfcslt s2ur( oot4tptomf3iysfa rl(ms u4arenmrctadlmD liei ()tetm(o3ou4apte fetas sDraum ;o1teeo oetydfm2el(mont0arxoxr iotlaDelnvs ()trxmirpoydlme  fvta() Dtrxrp;o0apt mi3tldfm2umnvs t4alxnif3ootfmDe ivi ()trum(mpiy1amenliesa(fs2rrurpoo4ape  ieiadls2rmn pn(0 ltomo3tytfmDrln o ( t2xmxmpiodopeeliei s srra(monu1tlxnmi3tydfa ea(ms;(0trtnmoctydfmt auei;() rxmimpnu1lmee ieslt)aDtru o;t0ole  oeiasfa2uaumo;(4tlermr ta1lmt livslt  eumir ou1lp emnct s)sDrrur ou1olx  oeilsls2rl(ms;u) ltomo3tytoptelivols  rxrim3ou1ap elnct () 2rrxrpot1tpxnmociltls2um(vp;t0 lerir3tadlpD  u o;t0 eumxmpoo1lpeemfcslt  Dta(ronu1aptoiiciltlsDulnvonu)tlenxf3io1la e n o;()truo(opno1apeemnvslt sDurxroou1tlt ioeiadls2ra( p;(0tltnxf tatfpteai ilt0s2urxr oodom n iesas)aDum( pnu0teeo ictldfm2raump u0 etnxfciydoptelneo (0srxmxmpoudol nlnctasfsDrrxmoou4tpt mfeiad m eanmpnu4tlxrir tadlp eanesl(0s2xoimpny4lltemnvias arrau onu0ole io3tasfa2ra( p u)aetrir oydlm elivslt)t2tmim3ny1ol  mfct tfsDtruro;u1tpxnmfciysla2ul(vont0trxrmr3totomDr n s s s2tr(m iu4lpe mnvi tfs2uaurp;u4tle io3iyslm2ra( on()aeenxo iy1fmD lueols0 rxoxr iy1alenlies t)aDrmurp;t4tlxn ictltlm elu o;t4artnif3iadoptrauvi t0t2um(o3ou4optn ncias aDtaxrpnt0aeto oetyslm ean s u4 eerio oatopt  neil()seuoirpnu1olenmnvtl()s2taxrono4altn fcilsla2rmuvs;(0 rerxf todfm  lu ilt  eumxr no1aptelfesas  Drm(r ;o0tleoii3tltfaDel( o;t0aeerirciydoaDelivo (  etm(r3nydlme mietasf 2ur(rpou4olt iictad s ua( s (0aeeoxr tadfpD  n o (0texr(rpno1ap   icsl( aDrau ont0aee ioeilt a2ua(mp;()treomo3tatfaDean i;(0s2uoxmpiudomtnmnvta( aDrr(m ;u1tetomociydfs2uauvo;u4alxrxo ty1fa  an i;s)sexmir3iudlmtnmivtas)aDra( pnt4tpeo i3iys a2el(vp (0arenxf iytlate i sls) rxm(o io4op n ieil()s2umx  nt4aex io3tasfm2rlnvp () eenxo ta1fptr ueols)sexrim3iy1lmt lict t) rumxrpnt4tle ioctatfm2rln s;u)arxoxf3tatom rlivol( s2to(opoodoptnmnvsa(fs2raxm no4olt ifeiadls emnvp;()tltnxf tadlateaivi t) ruoirpnydolenmfvsa()aDta( pou1tpxniociltlm2el(mp u)trxnmr3tydlpDrlues s) 2urimpny4opt lncia(fsrrax  ;u0ape mfeilsls emnvsnu0 eerir tytfa e u o;t0tetmxrpiu1ll   icsl(fsrrr(m ;u1olxoifeiysfm2eluvo u)altrifctadlptraieols srumxr3oo4lm  mfvils  rra(m nt4oee  fcils m2rmuvsnu0 rtomrcoytlmtr uvi s trtmiopio1openlnvsl() rrm(rp;t0oex ii3iydlm ea(vo t) reomo tytfpDr nei ( srtrio3iy4ap nmivsl(  Dtau oot4aexnio3iadfa2rlnms t)tlxnxf iytfaDe iesl( t2xoim3oodamt  ieia(f rurxmpot1ape io3iltfsDum(vonu0treoif ty1opDrli s t0trurir3ny1ope  fcil()a2tmurpoo0tex mfciad m em( s;(0alxrxr3oo1fm r iei t trxo(m oo1amtnlnei ( arraxmpou1oexnifeiadlm2rmn p;u) rtnio oodomteli i;t0 2xrxm3io1om emnetls a2umxr no0aexomi3tyslaDean p u4arenxr3ta1fmD  uvilt0s2uo(o ny4ape mnvslt a2tm( p;u0aex moeiltfa rl(vs;t) reomr iodfptraueslt)t2um(mpno4lmt  fctasfa2umurpnt4tpxoiicildls ua(ms u) exnxf3tytfp eaieil( t2toir no4om nmivsas) 2ra( pnu1tlxoio3tasfmDemnvon(0altrmo tytoptran o () rxm(o iudlp n ncils srrrxrooo0ope mfeiyslmDum(monu) rtoxr3oydom r ueol( sexoim3io4ol e nvs (  Duaxmoot4apxn octas m2rmuvpnt0tltnifcoodlpDr u o;t0srtrirpoy1ap  lfvt ()srtmu  ;t1tltn feildla rm(vpnu4 reoxf ia1opDeln o s  rto(o ny1am  mnesas) rtaumpoo1aptnmieiad mDeanvs;t0 rtriocootopDrlnes;s t2urxr3ou4om  micsl(fa2trx  nt4apx mi3iad m2em(ms u0 lxomr3io1omDranvolt  ruoim nodamtemfciatfa2trurp;u1texnio3tyd m rmnmo;t4 eeoif oatlm  ln ols trtrxopiudal nmfviat)s2tmxmpou1tee  o3ild s2ra(monu)tltomo3oo1laD an i;s s2xoxopoo1ap  liviltf 2ta(rpot1tleoifetyslm rmnvp u4 etnmfciatla   i slt truoxm3iy4amt lfeiltf 2tmuroou1oetnmf3ils a em( s;(0arermo3tadlm r i s;t  2xm(m iudom  lfcilsfarrrurono0tlxoiiciytlsDul(vsnt0treoif tadlm  anvs (  eur(m3nydlmeemncia(fs2tmu ont1oee  fciltfa rm(mo () ltnxo tadoa  luesls seto(r3iudlptn fctat sDtrxmono0tetnif3tys s2rlump t)texnxo3tatfm ean s;t)setr(opny4oltnmnct t  2rm(m nu4olt  f3iatlm rln pnu)trxnio3tatfa eau olt) ruoir3oydalt mfetas)srua(r ;u0oetoii3iasfa2uluvs u4 rtomf ia1opt lnvi;s0tetoim oudameemncil(  rrmurp;t4opx moetasls emuvsn(4arxrir tydfmte u i s0sexmim ou4aptnmnet t  Dtrxm ;t4tex ioeilt aDrmnmonu0alenxo3io1laDr ivsl(  rxmimpoodaptelnesasf Dtaxmont4ale mfcils m2ulu snu4teermf3oydlptrlu i;s)tetrxm oudalt  net sf Dta(rp;o4alxoiictld m2rm(vp;t) etnif3tydoa raueo;(0srxoxo3ny1omeemnvs ( a2ta(mp;o0oeen oetaslsDrlu s t)aexoio oatfa raies t) rtoxr iy1lpt mfetl(  rua(rpou1tlxo fetaslsDuaums;t0teenmf oadlaD aies (  exm(r nu4op n ict sf rur( oou0opxomfciad m2rl(vp;u)tetnifciadfpt  u s;s0 2urxo ou4amtelfeta(fs2trxmpou0aetoifciatfm emnmonu) lenmr3iatopDrai i s)trxoiopiu4ap  miciasfarrr(ro;t0alx mo3iat s umn snt0teeoiocoy1oa eluvi (  ruoxmpnu4lpee ictatfsrrrum no4tptomieiadlaDuaumon()tlenifciydop r n i t0srur(r oodopeelics ( aDta(ro;o1apt mo3iyd s2ulnvp t4 rerxrcia1fp rai o s)t2xrxo io4lpe miesl(f rrmx o;u1oleomoeiltls uaumont0arxomf todoaDeaieolt)sexmio oy4oltelies s  2rax o;u0tet  ocilsfmDulnmp t0tltoxo ty1omDr iei t0trurxmpno1lpee fesltfsDum(  ot4optniietys m rmnmp () eeomo iodop elnvi;t)t2trimpnu4llt  iciasfs2urxm ;o0oet ifeiasfm ea( snu4trxomr3ty1faDelivil() 2ur(o3io4omtelicsat)artrx o;o4tltoiictytlmDum(mp (4altnir tatoat lnvs;t setoirpiodale  neslt s2rax  no1tptoio3iadfa2rlumo;u0arxrir3tatfmteau ilt0s2xrxrpoy1om nmivtltfa2ra(rpot1tet mi3iytlaDra(mpn(0arenif3oytfa  aivil()setrim oy1ameemnvtat) rra(mo;o0oltomfciatfsDeluvp;t4 etrircoy1fmt lnei;t0truo(r nodll   iesa(  rurxr ;o0opxo f3iytla2emuvs;()arxrxf io1fm rlivslt srxr(m3oudalt  ieil( s2rrxmpno1optn ietadfm2elnms;t0 rtomo3ta1op eln o;(0setoir iy1olt mnvt sfartrx pou1texnmfciltfs rau p (4aetrxr3iy1fm eau ils0trtoxrpoy4alt mivtls s2trxmpoo4alxnmo3iadlaDuanvp u) reomr ty1om r n o () rumirpiy4omtelicta(f Dtm(r ;u4oee  fcildlmDuluvp;t0alxrio iydomDr u ol(  exoxopoydap e fcta( srtrxmp;t0olxn i3iyt s2ea(von()aeerxo todfptraivil( t2tr(r iudomtnlncil()sDurxm ;u0oexoif3iytlmDeaump;t4trermf oydlateluvi s)sexo(rpnodlptemicslt  Dtruro;o0ape moetadla2ua( snt4texnir3oytomtran o t setrim3iu1lmt livia(faDtr(rpno0tpt ifeiydfaDeanmp u)altnxfcty1lm r i i;t) rxm(opou1lp e ncsas sDrr(mpno0oet moetatla2raumo;t) eerirctydlp  lnvs t)s2xm(opou1amtn fvs (fs2taum ;u1tleo ietasfs2rl( sn() eermf3io1faDr ivo (  rxmirpnu1ole mneia()arurx  ot0oee iociytls2uaums;t0altoiocia1opD aues (0t2xrim nu1altnlncilt aruru  nt4tlxnii3iad s eaump;u0trtniocoo1lmtraneo ()srur(mpoy4ame mfcsatfsDrr(roou0apeomfcildls ra(vs t0trtoiocoydfptraieo t  rurxm3nudam nlnvtat) Draxro;o4oet  feiatlmDran o u4teenmr3iotoa rlnes;( srtr(rpiodom  mnei (faDrmxm ;o0aetoio3tlsfs2rlnvp;u4aeerxocia1lpD  ueil(  2toxopou1op nlfvs sf rrrx  ot4oltoiiciatfsDuaums t0trxnmrciytfmDe n i s  2uo(mpiy1oleemnctasfsrtaxm no4oeenmictaslm2rmu o;t)tleoio3todlaDeaivilt trtm(mpnu1apeemicsasfaDtrxmpno4olxnio3iaslm2rau p;(0alerxr oytlp   n o;t) 2trxopiu1lm  mivt ( sDum(r ot4aptomieiad s2elumsnt4arerxf iy1oa eaueilt0 rxo(r3nydlmeelivsls) 2trurp;o0tpeoioctltlm2eluvsn(0aetrxocoytomDeluvslt0t2xoxr iudll nlicils sDrrur oo1aptn ocilt s ua(ms u0texnxf oatlmDraiei t)seuoxo iy4om n netl(fs2tm( ono0tpenifeilslmDemn s u) rtrif3oytfmDrlneslt) 2toimpno4al  mfvils srtru  nt1oex  fetysla2rmn p (0artnxf ootlp  lies;s0s2um(r nu1op e ivt ()artruront1texn o3tasla2rmu p;() rtomf iydfmD  i i t s2tr(rpio4ol nmnesas)artmumpnu0oet  o3tadlsDumuvs u)arxrxfcoatfm rluvs ()srumxr ny1amte netlt arumuroou4oltn fctltlaDum(vs;(0tetnmf3ty1oaD aueo t srumxr io1am  liei (f 2umu p;t1tpeoifeiat a2ean pnu0aeeoxr3ta1lmt aieo ( t2xo(m iy1ope  fesat sDtrx o;u1tlt ifciatfmDra(mp;u0teenif3oatlpt lnvi t0 rxrim3iu4apt mfvsasfsrtax ont0alt  f3iat s2umu sn()texomrciotfat  ueo s)srtmirpiydamtnlnet sf ruaurpoo1tle if3tyt mDranmsn(4 rerxocoy1om eau i;(0 ruo(r nydapen ncilsf rtru p;u4oex ifciydfs2ea(vpn()tlxnmf3ia1optrlu ilt) exrxo3oy1ope  fvtlsfa2tau  ;o4tpenmiciyslm ea(ms (0aexnmo ootlm eluvs;( teuo(o3iu4lpenmivi (f 2rmxrp;o4tlxoifctat s emnmp;u4teeoxo oytfat lueo t)s2xmio3ou4op nmfcilt sDraumoot0oee mo3iytfa rmn ont4 rerxr iodlmDeliesls)s2um(o oy4oltelfct t)srraxm ;u4ale  ietlsls2umnvs;u) rxoxr3ty1fmDelu il(  rxoio nydom emics tfarrmxroou0opxnifeiydfm umumsn(0aexnxrciotlm  anvs s teurxr iu1lmtnmncs ( a2rm(roou0olt mf3tlslmDrmnmp;(4 lermf3tadfaDe i s (0teuoim no1omtn ietl() rrmx o;t4altnmieiltfs rmn sn(4 eenmrcoo1op rlnvslt0srxmxrpnu1lle mivsatfaDtru o;u1oexomi3ilt sDelumpn(0 lerxf3ty1oaD aieo;s0 eur(o iy1am emies s  rur(mono4tlt  fcias m2ul( o t) etrio oo1lpteaneo s t2xoimpiy1aptemfesa()a2tax o;o1opx  fetltfm2um(mo;(4 renmo ia1oaDrluvs s sexmxo oudol emivsls  2um(rpno4texnmoeiyd a2rluvo u)tleoxr oytop  aues;s0 rxrxrpny1am  lneslt)artaxroou0ale  o3iad a2uanvp t0 renxr3ootomDrli ilt0 2xo(rpiy1lmte ict s  Duaxmo;u1apxnio3iatlmDem(vs t0teeoxo3oa1lp r u ilt seumxo3oodom nlnvi () Dta(rp;u1oetniiciadls ra(mp t4trxrmr oydopDeanvs;s teto(opou1lpenmies s) Dumxr oo4oeen f3iytfs2ua(msnu4tetomfcoadopDelivs t)s2xmxopoy4ameelivsl( a2tm(m oo1optoio3iatfmDul( p;t4texnxfcia1op rlivs;t0trtrxrpoo4amt lncil()a2rax oot0oex  fciys mDulnvp (0areoxo3tydoaD  ivs;s0texm(m3nudllen ncsa() rta(  ou4altoifciadfm rlu onu)aetoir ootfa r u i (0 ruoxm ou1lpte fet t  2tr(  ;u4ope  fetyd s uauvs;u)tlerif iadlm e nes;() etrxmpnydolen nesls  rrrurpot0aexnmo3iydfsDrl(mo u0trenif todlp rlnes s0s2uoxrpno4olenmieiatfsDtax o;u0olxn o3tltla2uln snt4 ltoif3iy1lmt livi;t0 2xm(rpoy1lm  mivtlt) Durxrp;o4opto icilsls rauvo () ltnmr3tadlatr uvslt0s2urxo3nydlleelfcs (f rtmxmpot0altnmictltfs eauvp;t)trtnif3iydlmDe nes t0seurim3oo1apte ict (  rrau ooo4oetoii3iasfs2rln s;u4 eerxr3io1fmDrlueslt) rxrxo3io1op n ivt tfaDumxr ou0alx if3iadfm ulums;u)trerxf todfmt auvi ()srto(o3iu4amtn ivias  Dur(r ;o0tptomo3tld s umnmo t0 rxrmo3todfa rau o ()teurio3oydal n nei t)srrr(r ot4tee  ieiytfmDrmuvo;(0artnxr ia1lm elueol( sruoio iy4ll   fcsls) rum(r no4alxniietld m2rmnvsn(0aeenmr3oo1omtrai o;s)texm(r no1al  lfvtls)srua(r ot0oet if3iaslsDemnvpn(0trxrxo3iotom e ies;t0 2tm(mpiudamtnlnet t aDtr(m nt0tptn o3iyt a eln p;t0 exoxf iytoat  nes s)srxrir3io1ape  ici (faDurxmp;t4olxn iciyd mDumnvonu4areoifcoa1fpD  ieols texoim iudolt mfes (fs2uaumooo4alxo oeiatfaDuluvpnt4 leoxr totfm rlu sls t2um(r nudol emncia( arumxmpno4tlxomietys a2umnvpnu0artnxo iytfptelnvs t s2xriopnu4op n fcsl(fsDuax  nu4aexnio3tytfa raumont0tltnxr3iytlpD aiei ()s2tmio3nudapeelnvs t  2tm(r no4oet io3tysls2ranmp ()alenifciotopD auei t  exoio3iy4lpe  ict t)s2tmu  nt1opt if3tltfmDrauvp (0tlenmo iadoa rai s;t)t2umim3iodop n ici tf rua(rp;t4tptnifeiydlmDra(ms u)trxnxr iydopt lnei;s0teur(o3nudom   nvsasf rtm( o;u4tet mfcilslaDea(vs;()alxoxf oadfa   uvi;s0trtm(rpoy1altelncsa() Dtrum nu0aleo o3iydls2rln snt0 renir3tydlmt ai s;()trurirpiu1lpte nesas  Drr(  nu1tptn f3iytlm2ulums u0 etoir tatfm elnvils0s2toxrpoy4op nmfcslt  2trxrono0tpeomi3tadfm rm(vo u0artomrcoadlp  an o;()trtoxr oo1lpte fet t)artax ont0alxniociyd s2ua(vp u0 etomf oadopDeln o;s)texoimpiu1ll nlivsasfa2rmx oot0texoiociad sDrmuvs;(0trtnmrcto1omt lues () 2toirpnudal nmnesat srrrxmont0tleniociasfm2emnvp;(0trtnif ta1faDrlueo s0s2um(m ou1alen fcs sf rrru o;o0apeo i3iadfsDua(ms u0altomr iy1omtr ieo;t truoio oy1lm nmieilt  2rrxrpot1ape miciytfm2rlnvs;t0 lxomrciatomtraies s)t2uoio iu1ameemnvtasf 2taurpou0oet  oetlsfa2ra(vs;t0altoif3iy1lmtelnes;t0trtrio3iy4oltnmfetl(  Dta(mooo4ope mi3tyslmDrlnmp t)tetnmrcoo1lmtr nei;t sexr(m iu4al elfvsa(f rrmurpot4tlxomoetytfs el( pnu)teeomo3iodopDrauvo;(0s2xrimpou4altnlfcia( arrm( oou4opxo f3tlsfm2eluvonu0 eermocoytoaDe ues t) 2toirpoudomt lici t)a2rmxmpoo1tlxo fciaslsDel(ms;()texnir3iydoa eau slt0 exr(o iu4olenmivtls srumuronu4tpx mf3tytfaDrmnvsnu4alxrxrciotlm ran i t0seurxopoudolt  nvtat)aDrru  nt0olxnmociyd m2rmuvo;() lxrxf3iadfmtrli sls seurirpoodolt mnci s) 2rmumpnt1tlxo iciysls2eln sn(4tlerxo3totopteln s s  exrxrpnodop emnciat arrr(rpot0opt ioetltfmDul( o (4 lxoxocoodlm r n ilt0t2tmxm ny1ape lfvsls) 2ur(m ;t1texniiciatfs rm(vo t0 etnif3io1oaDean s;s s2uoimpiodol elictasfs2rau o;t1alxniociasla2eln o;(4trenmr3iytfa elnvo;s)s2trio3oydlpt  netltf rur(moou0olxomo3tyt mDum(vs;()teeoxf ia1fat  neo (0trumxopiy4amenlictat)s2raum ;u0aptomocildfm ea( pn(0 exomo oy1optrlu s;t)t2ur(m3no1om  mnes s  Dtrx poo0aeto o3iytfm2rmums;(4 exomrcootfa r nvi ( t2xmim3nu1amt  ieiat  Dtrum nt4tptnii3tasfs2emnmsn(4arxrircootfaDeau o t teumirpiu1op nlnetlt sDuau  ;o1alt ii3iytfs ua(mo t0alxrmrcoatomD lnes t t2xrxrpiodamtemfetl() Dtmum ot0tpxoifciydlm2elnmsn(0alxoiociadla  an il( sruoxmpiu4ol  miesas)aruaurp;t0alxn i3tytls rl( p (0altoir3tytlatraivils)s2xm(m nodlmtnlict s) 2um(m ;u4tpenmf3tas m em( pnt)altrxf3tatlp r uvi ()t2uoim3iodap emfvsltf Drau  nt4olt  i3iys a el(msnu0trxrirciadopDe u olt)t2xo(rpiydaptnlies tfsrtmu  nt1oltn oetadfs rmn sn()aetoif3ootfmte n i;(  2xrim3nydame mfcs tfsrrm( o;u4apeniictltfm elnmo (0 rxrxfcoatfpD aneil()srto(r3ny4lmen fet (fs2taxrpno4opx  icildlaDra(vont4aleriocoodfaDe nes t sexr(m iodlmt lncil( s2rmxm ;u1tlx iiciydfmDuanvpn()aeeoxo3oytlp eaiesls)t2urxr3ny4lmtelfcsl(f Dumxm nu0tee ioeias s2ulums;u4teeoir todlmDeli i t0trxmxr3nu1ome  fcsasfsrururp;t1tptn f3ilsls rmumo;t)artrmf3ia1omt lies;s0truo(mpiy4lmeelfvtlt)s2raur nu1aexo f3taslm rm(vp;u)alxoxrcoa1lmDrli s;(0seumio3iu4lp nliei (fartmu onu4oltnmi3iadls2rauvo;u4 lermr iadoa  aneol( s2toio iudol   ici s a2uru p;u0alx ifeias sDum(mon()aexrxf3oa1fp  li i s)t2uo(o3nu4lmenlnet t arrrur nu4tlx ii3tat s emuvpnt4 lerir tadomt aueo s trtmxmpio1ope lnetl( srtm( pou0opx mfciytlmDulnvo;t4aeerxf ootlmDeluvsls s2tr(rpiodlltnlfciat  2rm(mo;u4aptomfciysfs ra(mo;(0 ltnmr tadom   i s s0 rtm(m io1ol nmivta(  rrr(mp;o4oleo i3iltfsDul(mo;(4 leomr oo1oa raneolt0 etoim iy1lpee ieslt)sDuaxr ;t1opt mieiydlm2rm( pn() reomr3iotfmDr i i;(0s2um(o oodame licsat)s2rm( o;u1apx iociysls uluvo t0 exnircoa1optr nei t0texoxr3oo1lpee ivi t)sDrmuro;u1aetnmfctls s2ra(vp ()tetnxf tydom eaueo;t)teuo(rpno4ope mici ( a2tr( poo0tex  o3ild m2uan o t)aeerio ootfaDr u s;()setoxo ou1openmfei sfartaum oo4teeomoetyt m uaumpnu0aetrir3oy1fm e neslt0 2xrir3ny1ll elfvtl(  2tmxr ;o1alxoiieiadlm elu s;t) ltrmocta1oaDeluvi () 2toirpoodlme mics s)a2ua(m ;u4oeto f3iys aDua( snu)aleoifcio1oa r nvs t)s2toio3ny4ap e ieils) Dur( pnt4opeomi3iysfa2ea(vo u0tltrxociatfmt lnvsl( s2toio3iudapt lnvtlt) Dtaur ou0tee moetltfm elnvs;t0aexoif iytopD au ols)trto(r3nu4ap emivsatfa2ururono0tee mf3ildfa rmnmon(0arermociadlm r i ol()t2tm(r nodapeemivi s  2tmxmo;t4tpx ifciltlm ran p;u4 renmo iytfm  livo;t)trtoiopiu1alt lictl() rum(rpoo4altn o3tydfaDeaumo;u0 exrio3ta1faDr uvo;()t2toxmpoo1lme  nvta(  Dtrum nu0alt ioetydfa2uauvsnt4artnxo3oadfa  lueo s)trtr(o no4amenliciatfs2umurp;t4tpt mfetlt s em(ms;() eeoif3totlate nei;t)texmxm nu4ll elneilt)s2rm(monu4apt  feiydlm eanvs u0aetriocoodomteluei;t teurio oodal nmfvilsf Dta( ono0olenio3ild s2ua(vpnu4 rxrmf3ty1oa   n ilt)t2tmim3nudap   fcsltf Dtm(mono1alxoioeiatfm rmump;()tetnioctytoatr uei;t)sexrir io1ale mfvtatfaDraxro;o4aexoiietad aDemumsnt4 lerio oydlp   uvsls srxrio3iy1lm nlics (  rrm( pnt0aeto o3tld mDrmuvs;u)trtnio3ty1lmt aivs;t)setrxr3no1al emnvs (fsDrrur ;o4apxo i3ils s rau onu4trtnxrciy1fm  auvi;(  2uoxm nudlmtemfei ( arrr(r no4apen f3tas m uauvo;(0 leoxfcoatfpt lieols0srtm(m oo1amtemnvs sfsrrmum ;u1teen iciys mDua( pnt0texnxo3totlpDelnvo;t0 ruoiopiy4lpeelfcs ( s2tmu  ;u0teenmictlt a umumo t0trenio3ta1faDrli i t)srxm(o3ny1altn nes ( s2ua( onu0oet mi3ilt sDemums;u4 etrxrcoa1latran ol() 2to(mpoo4llen fetls sDuaumono4texo f3tyd sDemn o t0tetoxr todlmt  u i t) rto(m3io1open fet t) Dta(mpno4aet  ocild mDul(mont)tltnxr3totlaDelueolt0setoio ou4am elietas sDrrumonu0apxo f3iat a2ra( on(4 exrir tydfateaivs;(  exm(r oy4olt lncs t srrr(mpou1aleoio3iyslmDulnms;u0 eenif iotoaDeauesls s2tmxr3oy1al e fei ( a2raxr nu1oltomociatfmDuanvpn()aeerif to1opD  ies;s)s2xo(m3oodam   fvta(fa2rrx ono0tltoiieiad m emn on(0 exrmf3tytoaDr nvi;( trxmimpnydame lfvtat) Dtau onu0tlt  f3iasfsDemums;u) etrxf3iatlm rlnvs t)texr(mpiu4llen ivsls)srua( ono1texn o3iyt sDuau s;t4 ltoxo iatom eaieo s srurir3ou4opeelicsa( a2umumpnt1opto o3ilsls2emuvs u0teeoxr oodfptrluvil(  exrio iudlltelfvsa(fsrra(mo;u1oltn ictldfsDrmumsnu0aleomo oo1fa  aiei;(0trtrim nodalte ncsasfaDrrumo;u4opx ioeiatfs rauvp t0 ltnxo io1lp e ueo;s0s2toxmpoo4amte icil( aDtmx  no4oexoifeiyd m uaumon() exniociatfp ean s;s t2xoxmpoudom  mfeils) Duaxrpnu1aeto iciydfsDran o u4 lenio3oydfp rlivslt0sexmxr iu4ap  lneilt)s2rmumpot1opxo fctatls eanmsn()arerirciatomD aiei ()s2trxm iu4lm nlncil() rraur ;u0oexn i3tytls2rmuvs t0altoxo3ia1faDe ivi s0s2umirpny4al  mfvtl()a2urxrpnt4tlx  f3tasls2ua(msn(0arxrmoctotlat aivs;() rtmim3ou4ope mivs t)aDurumonu4tetnii3ias aDumn pn()artrmocia1lm r nei s)sexoxo nu4om   fet t) Drmurp;u1tlt  feildlsDraumo (0trerxr oatlp eauvol( t2xrxrpoy1llenmnctl()s2tmx ono1apenmfcildla2rln on(0aetnio3ta1fmtean ils0 2toxo3oy4lm n fcslsfaDumxm nu4olen fctysls2ulnmpnt)tleoir iadfpD lieol(0seumxr ou4ll nmncs tfarrmxmpot0teen i3iydfm rm( pnt)aetrif iotlm   ieo;()s2umio3iodlpeemncs (fa2raxmono1tlxnmi3iydlmDrlu p;(4 eenmo oa1fa  ln o s) eurxmpiu1lpte iet (f rtrurpoo0tptoiicias s2uln o;(4arenif3tydfat auvs;t)trumxopoodllenlnvsas srum(m nt4oet mi3tldlsDua( snt) rxnircoodoaDrli i t)t2xr(o3nudale micsltf 2tm(r ;u1aeenif3tls a rl(vp;t)aetoiociodopt  u i t0s2uoxo3oo1lleemietat aDrr(r no4apt  oeiysls ua(mon(0tlxrxf3oo1oate u o t  rtmir3iodlpenmici t)sDraxr ou0aetnifeiasfa rmuvo t0tetrmr todlaDelieilt)s2ur(m iy1oleemiei t  rurump;o1apxniieildfm2ra( s t0tlerif3oydoa elnvo s sexmimpiydlmtn nvi (fs2uru  nt4tptoiocias m2rlnmpnu)alenxf io1op rauvs;(  2xr(m3nu1amenmfct t a2umumo;o1openmieiatfa2rlu o u0tlxoxrcoo1opDelnes;(0srtmxo oodamtn feiat aDrr(m nu1tlt  ociytlm elumsnu0tltrxr iodfpDrlnes;s0s2xo(r ou4lm   ncs t)aDtax oou4aptnmfctls aDelnvonu0 rxoif ia1fpDr nei;( s2tr(m nodopenmnctlt  Drmxmpnu1tpxn ociydfmDemnmp u4 rxoxo iatfm  luvi t0seurim ny4lp  mnvsl()s2umum ;o0ape ii3iytfa2rmums;(0alerir oadlaD  nvolt teto(rpoo1op emfcilt sDtr(r ;t0ope  ieiadla eln pnt0texrio3oo1omDe uvs;t0trxoxrpnu1lm n fcsat a2tau pnu4aptnifetltfs2ulnvont0trxoif iodoaD  nei (  rxmxr iy4amtnlnet sf Draxrpno4tpenmfetadfs2rlnvp;()trtomr totopDeanvo s)teto(o3oydamenlfvtl(  rur(moou1opeomoeild m2rmuvs (4areoxo3ootlmt luvils s2toio no1om nlncsasfaDua(  nu1ale io3tys mDemu o t4tetrio tytlmtelies ()srtmim3nudopen nvilt) Drmum ;u1oee mi3ilsfs ea(vsn()aexomf iatlmteau i (  2tmio nu1lp elfct ( a2ur(  ou4tetoifetaslm2emnvon(0aleoio oodoa raiesl() rtmxo3oodlltelnci (fsrtr(mont4altnii3iad sDrmnmp;(0 rtrxrciodfmDeau s;t)srumxr io1omte net s  2rmxroou0tpx  f3ilsla eauvsnt4tlerxo3ootop   uvi s0 rtmio3oodll nmneil()a2ta(mo;u4opt  f3iyd a uau p;u4 rtrifcoa1oa ean i s0s2xr(m3ny1op e ivt sf 2raumpot4texo i3iytls rm( s;u0 rtnmociotla  lnvo;t) rur(m3nudalee feslt aDra( pnu4ape  fciydfm emnvp;t)tetnxf3iydlaD aivol(0srxoxmpiudlme mnvsas  rumurpoo0tpeo octydfs2eanvpn()teeomocty1op   i slt srtmim io4optelnctls aDraxmono0tpt  i3iatfa ra( sn(4arxoxf oadlaDr neo ()srtr(o3nudalen fetls s2ta(mpnt1oetnioeiydlmDrmums;t0trxrxo3tadlmt lies;(0s2xm(r oydaleemiesas srtru  ;u1teeomfciyd s rauvs;t) exnir3ta1latranvo;(0 rumirpoo1ll nmfci s)arurumoou4texo iciad s rlu on() lxrxf3io1fpDelivsls trumxo nu1lpenmivt tfsrrmump;u4aptn icild m uanvonu4altrir oy1lp rluvolt trtmxopno4lltnmieta( a2ua(mpou1aleoifctatfmDrl(mp;(0tleoxf oydopt  uvi (0s2xr(r oudolee netls sDtm( pot0oeeo feiysfs2ean o u0 lxnio oatlpD aies;t)tetrxrpiy4lpe  fcsasfsrrrxroou0tlxn ieiytfs2el(mpnu)tlxrif todfpte iesl()tetrimpny1am nmnct tf Drrx  ;o0alxnmfetys a rmnvo;u0tlenxf3tatfp  aieslt)s2xr(opiodamtnmnvt t)sDua(  ot4texnmieiyslmDel(vp;u)artoxr3ia1fp rau o ( trtoio iudomt mfeiat srurumpot0aleomociad m2eanvonu0tlenif iy1lmte neo t) etmxr3nu1am  lfcia()aruaur no1ape  oeiad s rlumpnt) exrirciodfa rau i s0s2xo(o ny1ll   fvtlt arraurpot0aetomo3iadla2eaump () eermfcoa1oaDe i ol()trtr(r nu1alt mivt t)a2umx oou4alto fciadfaDulumo;()teeoxfcto1lmt au i t trxoxr3oudoleelieta()aruau  ;u0oexn oetasla2eln snt4texoio3ty1op  anvo s0 rtmxopiy1ap nlnvt s arta(mo;t0altoiicias m2emnmp t4trtomo3ia1laD anvs s) eurxr ny1op elivsas) Dtmxr oo4aetnif3tat sDua(vs t4aeeomoctatopDe nes t0truoio oo1alte nvi s)aDur(mpnt0tleoio3iad m2raumsn()trtrmo totop eluei s trxrimpnu4altelfvilt) 2ua(m ;u0oexniociys aDranms t0trermr3ta1la ranei s0t2to(rpoy1aleemnviltf rrauroot1olxo ieiytla2rmnvon()texnio3tadfp  lneolt seuoiopny1aleelfesl(fs2uauroot0alx mo3ildls rau o;u)tlxrif3to1opt lnvo (0 2toxm iydlpe micsas) 2ta(ro;t0tlxn o3tyt m uanvp t) leomr3to1lptran s (0sexo(o oydape lfcsatf 2trxrp;o1aee mictydlsDrmn p;t0tltoifcty1oaD anvs t0trxmio io4omt mfct s sDtmu pot1tetoifciysla ulnvp (0altnifctodlpt aneilt srto(r3ou4ap nmivia(  2tr(r ;u4aet miciyd mDumnmo t0arenmfcoadlm e n ol() rtr(r io1llt  feiat  2rau  ;o4apx  ieiytla ea(vs;u) rtrmf3tytomD  nes;s teurim3iodomte fvil( srtm( o;u0aee  octasls rmnvont)trxrmr3oydom raueilt0 rtmxmpnudomtnmfvtas a2trxm nt1oet ifeiytfaDrmnmo;(4teeoio iydfa rau i s  exoir iy1ap  mfvs t)artmuroot1oleo fcild aDemn s u4 rtrmf3tytoa  auvo;t)t2tmxmpnu4ome mnvt s)srtm(moou0apxnii3iatlaDelumpn(4aetoir ootomt lues s0srtmxopiydame mfcsa() Dra(mo;o4aeenmo3iasfmDumn sn(0trtrmo3iotom elnvs;s0srxo(r nydom nmfcsltf Drau ont0tlxn ocilt sDua(mpn(4 rxnifctatlaD  nvils)seuoxo3no4lltemnvtat srrrxro;u1ope mfciyd s umuvp;()trxnmf3iydom  auvi;s0srxmxo3nodomenlfvi (fs2tr(rpot1tlx moetldls ranmo () lerxfciytom elnesls0 2uoxo iy4olenmnvil()arrmum oo1oet mi3iad aDrln o;u4 rxrmo to1omDelu o t0seurxr3oy4ap n nvsl(fsrra( ont0altn fciydlsDra(vp;u4areoifcta1oateau il(0trxr(mpno4amtelfvi s a2uau  ;u4tlx moctld mDemumo (0 rxomo3tytlatelnes;s  rtrxr iudalee nctasfa2rr( pnu0altomi3ilt m uan onu0aeenxr iytfpDrauvi s0sexo(r iodaltnlivs ( sDtr( pot0tlxnmociyslm ul(mp (0tlermr ia1lmteau s s s2xrxr nu4olee ics s)srra(r nt4teen i3iytla rm(mo;t)texnxocoadoat an slt) rtrxmpoy1am  lnetas aDtru pno1optn oeiltfa2ea(ms t)trerxf3iodomt ln i;()s2tr(r3ou1lmtnmfciat)sDraumpoo1tpto o3tltfs2rlu p ()altrifctytfm eai o t0trumir iodal n netl(fs2taum nt1alenmf3tydfs2rlnmo t)aexnxr3iodoa  ln o t)sruo(r oy1om elnctls srrmx  ou4altomieiyslmDelnvo;u0aeenxf3iotfptr i i;t0sruoir nydoltnmict sfsrurxmoot4aptn fctys m2ra(ms ()trenxocty1om eau o;(0 eur(o3oy1olt micil(fartaxr no4oet ioctysfs eauvo;t4aetnxo3oadoptrlu s s  eto(opiy4llen ictas a2uaxrono4ole  ieiasfm elnmsnt) renmr ootlmD  iesls seurir3no4lmeelnvi t) Dtr(moot1oex  ociatls rm(mp;u)alxomf oatla  aivo s0t2xo(opnodame liesat)a2um(  ot4olxo f3iys s rmnvonu0trtrmo3tydoa e nei t0srurimpoy1omeemici (f rtmu  no1aeeo feiydfs2rmnmsnu4artoxr oadomte n o;(0 rtmxmpnu4al e ncsl() rua(rpot4alxnioetlslsDelu sn(4 exnmrcty1fmDrln o;t0trtmxrpio1lme lnciatfaDtaxmpou0tetomicilsfs2el(vp u0tlxomf3iotlaDr iei;s  rtmxm3iy4om nlnvsa() rrr( pnt0apx  f3iatla umn ont0 rxrxo3tytlpDe ivi;()trtmxopiu1opte fvil(f rumx ono0opeo f3ias s uaump;t)tetrmo3iadlmDelu slt0 rxmxm iodape lieiatf 2rrum ;u4texn ieias s2uln pn(0tetrxocto1opteau o;()t2toxrpio4opt  fcil()srrm(mp;o4oex io3iydlm ea(ms u)tetoio oatfpD  uvo s0sruoir oydlptn nvs sfsDtaxmono4aetoiictldfm rlu s;t4arxrmf3oadfpte i i;t0 exrio ou4alen iviatf 2ta(mpno4alxomf3tydla eanmp;u)aeerxo3tytla eluvo;() 2urxo oydale mfesas)arrrumoou4tee miciytfs ulumon() rtniocoo1fa
\ No newline at end of file
@@ -0,0 +1 @@
+ivol(0t2tmxm ny4opt lfvi t)aDra(  ou4olxomf3tldlm2ea(monu) ltnmrciodfmteaivsl(0 eto(m oy4ale lici t) Durx onu4optoio3iadfsDeau o t)tetrmr iodfptelivilt teuoxo ou4al e neils)sDta(r nt1open fetatfm rmuvs;() etomo oadop r nvs (0srxoio no4omtnmnei s) rtmx pou4aee  fetysfs2emnvs;(0aeeomr oydomtrauei t s2xmirpno4am e ivslsfaDta(ro;t4tle moeilsla2em( p;t4aeenxo3oa1faDrln i s  rtr(r3no1lmeemnetlt sDrr(  ;t1tpxniocilt sDua( s;u4 rxomo oodfp r i o t t2xm(r3oydlmtn nviasf rtmu p;t0aexomi3iys aDuln p (0trenmf3io1oatelnesls0srxo(m3oy1llt  fctas)sDrmumono0optn ociadlsDrluvsn()areoio3iodlmteli i t)srumio3no4apte fcta()srtmx  nt0olenmi3tldla ran o;u) lxriocoatfm rlieo t)t2uoim no4amtnmicsatfa2rrx pnu4aet  iciadlmDelnmo;t4 rxrxrciadopt  ivi t  etrxm iodom e ici () Drmx  ou0oexnii3ils s rmuvpnt4altoxr3tytfate i o;s0 eumxr3no1ol nmivtat)arra(mo;t0texo o3tltlmDrlu p;(4treomfcty1fa  au sl() rtmxr3oo4ll elnvsas s2tr( o;u4tltn oetaslm rlnvp t0aeerxfcia1oaDr n o s  rtrxm oodomt mnetatfartmurooo4oetnioeiytls rlnmp (4 rxnif iytfmteauesl( s2toirpio4lptemnvtasf Dua( pou1aeenmfetadfmDua(vp t0alenxf oadomDeli o ( trxoxo3io4om  lncsl(  Drau oou4tleo fetytla2elnvo (4alenif3iydlm rlneo;s) etmxr ou1ap n ivslsf rrm(mo;u1olx  ietld a rl(ms;()areomr3oo1oatraivo t sexrxopiodal  lfeiltfs2ra(mo;t4alx ioetyd m ran p u0tlenxo ia1lmDrau olt)srtoxrpny1op nmivil(fsDumu ont0aexoioctytla emu s (0aleoif3tydfaD lies;t)srxriopoydamte fcsasf Drm(  oo4altn fctlt aDran pnt) leniocootla eaivil(0 rtr(o no4lpt mnetls)arurxmo;t1aet  fetytls ul(msnu4 etnmrcio1fpt  neo t seuoir iodll elfeslt)sDtmxro;o4aet if3tys m2ra( on(4arxnmf tatla   ueilt s2um(m iodlmt mics ()aDrru  ;t4optnmieilslsDrl(mp;t4 reoxr oodlmD auvil(0 2trxrpiudomenlfvsat) Dtr(mo;t0oeto ictas a2rlnvon(4teeoxoctatfmtr nvolt)tetrxrpou1ap emfvtl(fsDtax ont4olx  o3iyt a2uanmo;()tltoxoctadopDrauei;()seur(m3nudamtnmncilt)s2rauront0oetomictlslm eluvont)aeerio3ootfp rli slt teumxm iodlmtnmneilt) 2tm(r ou0tptomictasfaDel(vo;() rtnif iy1oatraieils0srxoio3io1omt lictas  2rm(r ;u0tetomf3iydfs2rmnvp u)artnif3oodlmDeanes;t0texr(r iydop  lfvil(  Dumx o;o0aeeoioeild mDumumsnt4alxomocia1opte nvslt0s2urxo iydoltnlicia( arurxm nt1alt mictys a el(mo;(0 rtrxf tytfptr ivi;s srumxo3ou4lme mieias)aDtrurpou0tptnmfctytfm2ea( o u)tltrmfciytla  luvo;()t2ur(o oo4opt  ieta(fsrtau  oo0tpxniiciydfa2umnmsn(4trxnmocia1la  livol( t2tmxo3io1apt  ieias)srurum nu0ope ifetyt mDem(ms ()tlxrxf oodopD lu i t0teuo(r3iu1alee nctlt  rtrx  oo1aexoifctys aDeanmp;t)trtnmo tatfateli i;s  rtrio3ou1alt liesa(fa2ua( pnu4oeeo oeilt aDum(vo;u0texoxrctotfptrlneolt trumxm ny4oltn fvs t)artaxr nu1texo oetaslaDuaumon()artrxrcta1lmtranei t)sexrir ny1lleelfeiltfa2rrum nu4aeen f3tltfa el( s;(0altnxoctydlm  an o (  rxm(opnodam  miesas)artmxmpou0tlxnmoeiat s rmuvo;t4 rtoircoy1fat lu o s0setoio3ou4op  livsa()aDtaurp;t4apto feild m rlu snu4aetnio ty1oaDeln o s0tetm(mpiu4olenmivi t s2urxr nt0aexo oeiytla2eanms t0tltrir3oadlmD aiei;s0srtmxopiy4lmenlivi (fa2ra( o;t1tlenifciatlsDrl( o () ltnmf todom  aivo s  rtoimpnu4lmenmfvias a2urx pnt0aexo ociasla2umuvs;t)treoircoydlaDelu i s) etmiopoo4llt mieil(farrm(m nt0oexo o3tlsfa2ua(mp u0teeoxocio1lmt luei;t) exrio iu1apt mnvil( srtrumpno4tlxn iciat a2elnmo;t0trerxo3iatlp rln o;(0seto(mpiodome mnvias)sDtrurp;t4texoiieilsfm emn s t)trxrmr iy1faD luesl()t2xoxm3iy4lp  lfvia() Dur(mo;o4oltn feias sDrmn pn(0 rxoxo3iytlpD lues t) etmim3iodlle mfcta()s2rm( ont0texnioctyd s2ua( p t0tltoifcoadfaDe neo;s) exo(mpiodaleemfes t srtmur ;u0apt io3ils s2elumo u4 lxnif3io1fm  luvi t)t2toxo io1opeelfctlt) 2rru pnu0tpx miciys sDea( on() rxrif iotla e uvo t0srxm(rpoodaptn feil(  2tru o;u4aex  feiydls ua( p;(4 rermrciatoaD lu il() eumxo ny1ol nmncs s) 2uaurpno1tpxoioeiadfaDea(vonu4 ltnxr iy1lptranvs;s0texm(opou4ap n fvsat sDtrx oou4aexo ieildfmDran s;u) etoio3ootfp raiei;s t2xmxo3io4ap emivsltf rra(moot1optn fciadla2ulnms;t4areniociotlaDrau o t trumxr3oy1omte ncs t artmu pnt0tee moeiysls umnms (0 etnifciadfa rlnvslt0s2urxo3iudapt  ivilt sDur( oot0texniieiysfmDrlnmp u4trtnir oodfaDelueo ( seum(r oy1lp  lfciasfsrrm( o;o4texnmi3tyt a ulnvp;t) reomr3todlpD aivs s) rtoio3oy1ale lnct ( srrruroou1aee moctat m2rm(msnu0treoir3iytfatran o;t) 2uoim io4lme  fvsas)s2urur ou0alen iciydfs2ranmp t4 rxrircoo1lm r ueil( sexoxr3oo1op e feiltfsrtrxmpou1olxoii3iysfsDea( o;t)treoxf iodoaDran olt) 2ur(o oo1lpee ics (fs2ua(m ;t0tle mo3ilsla rl( s;u)aetrmo3tatlm rli o;s0 eur(opio1omenlfviltfsrrmxrp;o1tptoiieilt aDea(msnu0 reomo oatopt anvs (0trumimpnudope lnes t) 2rmuronu0openifetatla rl( p u0aexoif iydomD  n i;t0texo(m io1omte ivsa(f Dtau  ot4teeo o3tatfs2ea(vp u) rxrxo3totoaD  uvs;t srtmio3ou1ol n ivi t)artrur ou4tpeoii3tytlm elnvp;(4altoxr3oa1lmD  ivi;t0t2xm(o nu1lmen nvta( srtr(r ot4tlenmo3ild m2ra(ms;u4 exomrctatlpt aivs;t) ruoxrpoudlltelnvslt)aDumx  ;u0oetoiocilslm2uln s u) rxnxfcoytfaD aivilt s2tmxr3ny4olt lietlt)a2rmumoou0aex mf3tydfsDemuvo (0aetnxo oadomtelueolt0t2xr(m ny4lme  ivtas  Dtruroot4oetomoeild m umu p;u)aexomocoadlmD  nvi;s0s2urir oy4omtnlfvtltfs2tr( poo4olx ii3iyslm2ra( s;t)altoif3oytoa r nvs ()seur(rpou4apee fctasfarumuro;o4oltoii3iatla2rmnmp;()trxrmfctodlmDelivslt  ruoxr3oudomtnlfciatf 2rr(ronu4tpx mo3iyd aDem(vpnt)trtrxo tatfp  auei;()tetrio oy1alee ieilt a2uau  ou1tptomo3iysfmDuln o (4artnmf3iadfmDeai o;(  rxmirpnu1lm emfvsls) rtm( oou4aee mf3iyt sDumumpnt4tltrxociotfp   ueilt0texoxmpoydapt mfviltfaDraxr ;t1tle  f3ilslm umnms t0 ltnxf to1omDr uvo s tetmxr3nydopte nctasfsDrmurpou1oetomfciasls2rm( o (4arxnmr3tytlpDelu il(0s2uriopiudoltnmncias)artaxmp;t4aex  o3iatfaDea( p u0tleoxfctadoa elneol( t2tmir nu1lmtn nvil( srta( o;t0tetomo3ilt s2rlnvs u) ltoxf tytfpt lieilt0s2xr(m3no1lpt miesat artaxroot4tet mfetytlm2eln p (4texnxo3tatom rlu ol(0 eumim3oo4op  mnvs s) rtr(moot1tpto ieiyd sDuauvsn(4altrif3oadlp eln ol()tetoio3iudam  mnvs sf rtr(m ;u0tex iictas a2ulumont0 exrmr iytfaDr uvs;t sexoir3nudal nlfcs (  2uaxrpot0aet ifetlslsDulnmo;u0arerxf totlm  lnvs;s sexmir io4ape lfci t aDrr( p;t1tex  o3tys s2ul(vs t4teenxo tydomteln s;s  2xrio3oydlp nlicta()a2trxmpnt4apxomoetysfmDelnmp (4artrif3io1oat lnes;(  2xmir io1amtelivsat sDum(rpnu1ale iictlsfs ua(vp u0trtrmfciydlm  au sl()t2urxmpiu4om emieta(fa2rmxr no1tet  ociasls2elnvsnt)artoxf oodla eauvo;t t2xrio3iy1lpt mfvia( aDtmurooo4olxomf3ias aDrlu s;t4 eerxocia1lp  livol(  exoiopoo4alt livslt)artruronu4aex if3ilsfs rmnmpnt)tetoxr3oodfpDr n i (  exrimpoo4ol n nci () 2tmxrpno0tpeomo3iasfm umu s (4 lerxr oytomtelivo;(0srtoir iy4olenmnvsasfa2raurpno0oexnioctatfaDrln s t4tlenxf oytopDean ils sexrim oo4lm   net (fsDtr(mpno4oltnmoeild a ra(mo;u)texomrctotoate ivsl(0t2xrimpny1ameelnvs s)sDtmxront0alt  ieildlsDrln pnu)trtrif oodlmt aieils)texoim3nydape  fct s)s2taxr ot4alx  oetatfa rmnmsnt0artoxr3oytlmD  ues;s0srtrimpiu4altnlnvsl()a2urxro;o4tpe  oetydlaDem(vo ()texoxf oy1fat livs;t  2xmim ou4aleelies (faDtr( pou1optnmieilslaDeauvo u0 lxnif iy1oaD an o;(0 2xoiopoy1ol elncia()aDrmu pnt0ope  ocildfaDeauvsnt) eermf3oydfmteai s (  eumxr io1apeemfvia() 2um(rooo4open i3iasls2ua( o (4tlenif oytla eau s;t0seuo(rpny4lmenmnvtlt)aDta(m nt1aetomoeiytfs2rm( p;t)aeenir oy1omt li o;s setrxrpiy4om e nct t  Durur ;t0tltn fetltlm ranmo;t)alxnmr oa1fp raivo ( sruoirpiydolenlictlsfarraxmpnu0aetomieiad mDuauvo u4alxomrctotomDrai ol( s2urxmpiodamtn nctls) 2urx  ;u1aexnmictat aDumnmo;(0 eermrcta1fm r uvs;(0sruoiopiu1omeelncil(fsDurx  ou1opxo i3iydla rluvo;u4 ltomfciatoaDr i il()seumio3nu4lpt miet () rurxm ;u1aeto ociltls2rluvp;t0arxrifctotfm r uvi;t texmxopnudlmt lncsl( a2rmuront0ape miciatlsDeauvon(0 etoxo oadomte ieo t)truoxopnu1lmt  fvsa()s2ua( p;u4altoio3iasfsDemn s;(0aexniocootlptrai i;(0sexrxrpny1optnlnvi ()aDurxmpnu0tltomo3iatfs2ranmo;u0aetoifcoy1omt  i o s0srtrir3oy4omtelnvi ( srrmx ono4tlen iciltfa2rmn o;u4aexoxoctodlp  ai slt) 2toim no4ope mfviasf 2tau  nt4ale ioctldfmDranmo u4 ltnmfcty1faDean ilt0srxoxr3nydom   ietatf Dtrurpot1alt mi3ils a2rm(mp;() lxnmr iytlpteanvi s0 rtrxo nu4opeelneiat) 2taxr nt1aee  i3iydls2umnvonu)trxrifciatlmD  ivol( s2umxr3nu4olt mnvsas)s2rau ont4texnmf3tyt s2rau p;u0tlxnxociy1oaDrlu o;()sexrir3no1ome mnvia(fsDuau ono1tlenmiciltfa2emn o t0tltrxf3tadop e u olt)trxmiopny1al   ies (f Dumu  nu1olx  fctytlmDuanvo (0artoxr oydfptran ils t2umim nudamtemfetltfaDrm(r ou0texomoeias sDumu s u0alxrxr3io1laDran o ( s2trxo iodlpe mncil(f 2rrxr ou0tpenmociysfm umu pn() rtnmo3iadfpDelnei;() rxm(o iu1apenlnvta(fa2rmxronu1tetomo3tld mDuan o u)teerxo iytlaDelivo;s) etmxopoodam nlfesat a2umxrooo0ope  octldla ul( o (4aeermo iadfatrli ils)srxm(opiodamt  neil(fa2taxmp;t1teto fcilt s umu p u)teenxf3iotopte uei;t t2uoirpoo1ome lies (fsDurumoou0olto i3ildlm2elnmonu0alenmo io1omD au i t)sexrir iu4alen ieil(f 2tm(rpot1teeo o3ildfs rlnvpn() ltrmfcoatlaDeai ilt0 exoxo3no1ole  nei () rua(mpnt1oexoii3ias mDeln s;(0 rermr3iadlm ran olt  rtmxopoudlleemncta(  2uru p;u4alxnif3iydfmDean ont0tltrmrcia1lmteauvils0srum(r io1lmen fes t arta(  ot4opxomfctyt m2rmnvon(0trermrctydfpD auvolt0s2tmxr3iy4ap n fci t)aDrrx  ;o0teenifciadfm emu p t0 lxnmfctodlmD auvi;t)t2uoim iy1apee fesltfs2ururooo1tlen i3ildlm2ean onu)aetnmociatoaDelivilt sruoir oudlpe mfes t)aDtmum oo1altnmictatfa2ulnvp;t)teerir iytlmD lnvi s setrir iu1altemnct s)a2rm(  ;o4olt  oetld s2eluvont4 exnxo3iadla   ivils texmio3ny1am elfei s) 2ra(mpot1tptnmfciadfm elu s;()texnmo3iatfatrlueolt0t2urirpiu1lpe lics t srumxro;t1oex if3tydla umums (0alxnxo3iytfp  aues s)t2trirpou4olen fcil()sDtm( oou0opx iociad s2uauvp;u)altoifciadfpt li sl()tetoio3oodoleelnvtat) 2tm(r ot0tlt mo3tytfm eanmon(4tltoxociatla   uvils  rto(r3oo1al nmict s srtru  ;o4optnmocild m2emuvon(4alxrmfctadlm   ivols0 2umxm oy1aptnlneils  rumurooo4olenif3tasfmDrlnms t0aexrmrctodfaD  ivsls) rur(opnudole  iesa( aDum(mp;o0aex ii3iatlmDuanmp u)aexomf3io1fate u ils t2xoxmpiy1om e fcsas  2rmx pou0tltomi3tyt m2eaumpn(0 eerxr3todla r uvols0 rtrir3oy1ol e nci tfs2ta(r no0aee ioctyd sDel(mon(0 lxoxo iatfp rli s t0 2xmxo3io4ome lfvi s aDta(mp;o4aeeo f3tatfm2elnvsnu) lenxr3todfm rlu s (0 exr(m ny4aleemictatfs2ur(mo;o0tpeo ocild m umums;u4 etoif to1fpteauvil(  rtrir3iu4altnlivtltfsrur( ono0opxniieilsfs elump t4trtoxr3totlpt anvo;t0 rtm(o3nydlm  livi sfsrurumoou4alt miciadfm eanvon(4arermr oa1fm raivs s)trtoxm oo4op e nctl(f Duaxr ot4tltnii3ildlm rl( onu0trenmf3tydoatrlnei t)s2tr(r3iu4ol nmictatfa2trxront4tex io3tls s rmu snt0 lerir ty1oat aueslt) 2urio3iudlptnlfvil( aDra(rpno0ope ifciysfs2umnmo t)arxomfcoo1fateluesls)s2tmimpoy1al   ivsl()sDuru  ;u1olxomfeiadfa2rl( snu4trtoxr3oadoateau slt)seumim nu1alenlivi () 2tmu  ot0tee mi3iatfaDrl(mp u) lenxf iotomtraivsls) exoxm3nu1ll nmfctas artmump;t0texoio3tld m ul( pn(4tltrio ootopDeaieo t0s2xrxr io1ameelnesls aDrm( ono1ope ifeilsfm ua( p;t0 etriocoa1fpDrluvilt  etm(m3ny1am  lfcsatfarrm(mpnt0opeomf3tat a ranvsnt4arxnxo3iotop eanvilt0setrir3oo4ope mieil(fs2tm(m ot4opto fcild sDua( o;() rtniociatfmt an i s0 rto(rpiudlmeelfes t  rraxmpnt0ope  feiat m2uln p;()texrxf totom rln s;s)t2tr(mpiudole mneslt arrmumo;u4olenifeias a2ea(vs (0 lerircoatoaDr nvil() 2uo(m ny1lleelivsa( srtrx pnt0tlx micildlm ua(vs;u0aexrxf3oytla  auei t0trtrir3oodolenlnvs tfs2urxmont4oltnmociadls ranmsn()tlenxfctadlmtran o;t s2toxm3ou1al nmncs tfsDrr(mooo4olx moetyd aDrm(mo;u) rerif3ia1lmt  ivs;s srtrxo3nodlmt  iesls s2ta(mo;o1tpxnifeiatla2uauvp;u4arerxrcootlatrlueo;() 2xoxmpnu1am   iei t a2rmumo;t4tltnmieiatfs2ranvo u0trtoxrcoodfpt aiei s)tetrxopny1ap n ieia( artmu poo1tpx ioetat m rm(mp u0aexnio ootom  ai i;s0 rtrxo iu4am  mfesl()aDum(mo;u4tle iiciltfmDuaump;t4aexrio3iydoa   ues s)trtr(opio4llenmieta(  2uaxront4oleomoetas m uaums u0alermf io1faDraueolt) 2tmxr3iu1altelivtasfsDraxm ou4aee ioetld m elnvp t)artoir tadlatr uvo s s2trio no1om elncs () Durxr ;u0openmfciltlmDum(mpnt4 rxrmocio1om  livs (0s2xoio oo4al elnvsl() 2rrurono4tlxn oeiatlmDea(vpnu4aexrmfcty1lp e i s;t0teuoirpoudam emicslt  rtr( pnu4tpeo iciat a2rl(von(0tlxnir3oa1fpt lneilt trurxmpoo4lp  mieilt a2umxm ot4apxoio3iadla umnmon()aetrmfciodomDe uei s0 rtmimpiu1lm n nciat)arrmurpoo0aeeoioetyslmDum( pn(4 ltoxf3tydfaDrlnvsl(0s2tm(mpoy4am nmieil()s2rrx  nu1tpeoiieilsla2elnvonu0arxoio3tydlmDe nvs;t0truo(m3oodom  lneiat) rta(ro;t4olxn fetys a2ra(mp () rxrxo oadlm rli i s  rumir iu4ll nlfctls) ruaxmoou0aeeoioeiadfm ul( s t4 lenio3ty1lmteauvs t srtrxr3no4ol n nvils) 2tax  ;o0tee  o3iytfsDrmums;t)altoxo3iotopteaivsl( seuo(mpio1llenlfctat srta(mp;o4aptomietatfaDumnmsnt0 ltnio3iatoa eauvo t0setrim3oodopt  fesa(fsDtau o;t0alx  oeiytlm uluvs;u4trtrmociatlmt  uvs;( t2xm(mpou1olenmfvil(farua(rpot1optnioctadfm2emnvo;(0trxnmf3iotfm elnvsl()srto(m3no4lpen ncsa(f rtmx  nt4tpen fciad s2uau o;t4 lenxf oadlm  li slt0trxmir nu4lm  mnct sfsDur( ont1olenmieiltfa2el( pnu4tlxnmr3oytomtelnvs;( s2xmxo oy1omeelfvta( srtm(rpnu0alx io3tas a2rmnvsn(4alenxo3oodfptelnvil(0s2uoxr no1lptnmicils)aDra(mo;t0oltnif3ilt aDrm(monu) eermr oy1lp  lnvo s trtrir3nu1ap nmnci tf 2taxmp;t0tee  f3iatfs2um( snt4alxoxf3oy1oa  anvils0 2xo(m oy4lp nmfvsas)a2uax pno1apto fciadfsDrmn pnt0aetoiociotomt ln i t t2xm(mpnydam  mncilt)sDur( pot4apenmieiltls rl(vp;t4 lxoxoctytomDeaivols) etoxrpnudamtnlfcta() 2rauro;u1alto f3iysfs rl( pn() exoxfcoatom e i o s0trxrim iu1lpt mivi tfartr( o;t0tex mfctat m2rl( s;t)tlxoif to1la ranvi;s truoir3oy1amee fvsl()artmxrpoo0opt ii3iyd sDulnvs;()tetrxocty1oa  au i;s0seuoiopio1llt mieta( sDrr(r ;u0tle if3tlsls2em( s (4tetoxo todomDrauvi;s0t2xrxo3ou4lp nlivil() rtmxr nu0opxo oeiysfa rmuvp u)tlxrif3todlaD lneo;s)t2tr(o3iy1op   fvs ()a2rrump;u4tpx miciadfa uanvpnt)aeerir3ootlat auvolt0 rxoxo oudam  lfvtasf 2tmxr ou1oex  i3ils s2ulumo;()arxnxr3iadfptrau s s  etoxr nodapenlfcilt s2rmu  oo0olx iociys m rauvsnu) reoir3tydlm rlu i;s  exoim3iu1apenmfcia()srta(  nt4olt iiciadlm umn s t)trerxrcoydom eluvo;()s2umio3ny4lm e ivt tfa2um(m no4olxnmfeiatls2um( p t0 lxoio iytfa r neil()srtmxrpoydom elfviltfs2uaxm ;t0opeo ietydfa2rm( p t) etrxf iodlpteluvs;s t2to(rpoo1ol emfetat a2urum no0alt  ociysfmDran onu)tltnxr iotom elueols s2tmxr3oy1oltnmici ()aDurumont0tlxn ociys s um(mpn(0aeeomfciydoaD aieslt  2uo(r3io1openlnciltfartm(rpou1tpenmoetatfm el(vsnt0 lxniocoy1la   ueo;s0 exoxo3ou1lmt miviat  rtmu pot0tlen o3tydlaDuln o (0altrmf3to1om  lnei s0 etmirpnydlltn icias s2rmxr ;u1aex mieildlaDumumo;t4 renmf oydfmDeanvs t0t2ur(opiu1oltelfvias)aDumurooo0oeeo fctldfs2ean s ()arxoxfciydomt  ivslt0texmir ou4ape mfes (f 2ur(rpnu1aetn i3ild a2ua(vont4 rtoxf iodlm   uvo;t sexoxrpoo1lmtn fvtl(fa2umx onu1apt  i3tldfaDuau s;(0 rxrmrcootlmDelieils0s2toir iydapeelnctltfa2urur ;t0teto fctadlsDuanvp;t0 rermf3totlm  ai s;( trtm(m3iydopt mieil()arraxm ot0optomfcilsfsDumnvo;()tlxrxo iatlaDran s;(0trumim3iu4ame mfct (f 2rmumooo1tltnmictadlmDrlnmp (4 rxnmf3oy1fate uesl(0setmxmpnydomte feiatfa2ua(m no1openmfeiysla rlnvs;(4 rtrxrciodlmtrai i;t0 etr(rpou4ame  ivta(f 2urum ot1tlto fciasfa2ra(vs u) eenmo oadfp ran i t0 2uo(o3io1apt mnvia()sDraxr ou0olx ii3iadfs raumon()altrxo oadlptr u ils0seumxm3io4ap emfeia(fs2rmxmooo0aptnifciydla emn snu)trenmocta1fmt aieilt sexmio ny4openlnctls)s2rr(mooo1aeeomfeiatfaDumnmo;t0arxrmo3io1lpD  uvo () rxo(m nodal e ivsa()s2tmxmpou1apt  iciytfa ea(msn(0alxnif3oatfp r iesl()s2tmxm3iodll  mfcsl()aDrrxroou1alenmi3iysfaDelumpnt)alxrircootoaDr uei;( t2trxrpoo4ap elfet s  2rmumo;u1tptomfeiasfs2uauvpnt4aexrifcio1om rlieol(0t2toiopoudlmtnlfetatf Dua( pou1tltn feiltfaDeanms;t) rtoxo iy1op elneo s) eurir ny1lpeemncslt)arrm(rpnt1olenmietadlm ua( p ()alxoircoytop e u il(0 2tm(o3oy4lle  ictas aDtrx onu4tpt mf3iatlmDemnvs t4aeerif iadfmDr i slt0tetoio nydapenlietltfsrraxmo;o4oex io3iatls2rlumo;u)tetoio3ta1fmt an i t  etoirpiu4lm elnvtatfa2uax  ;t0oeeo o3iad a2ra(mo;t4 reoxo3iytoa eaueo t)srurir3oudlpte nvilt) Dururpou4oleo ietydfmDemums;t)treomf3iotlptrauvs;t)texm(opoy4alenlnet () 2ua(ronu0optnmfciytfs2rmuvsnt0 etnxo to1fmDr ivo;t srxr(o nu4lm emfetl()sruau  ou4olt mfeiadfsDran o;u0tetoircoa1la e ueilt0s2xr(rpio1lpte neiasf 2raur ;t0alt mf3tyd sDrl(mp t0aetrxocoydlate nvi;(0 rurimpiodoleemnvsa(f Drmxm ot4texomo3iatlaDeauvp;() ltrxociydomteli ilt t2xm(r nodlpee fvsas)arum( o;u1tlenmf3iyd aDraumo (4aetrmo3oo1oat auvo s trtr(mpiy1lmeemncs tfs2umur ;t1tetoio3ilsfa2rmnmsn(4altoio3to1fa rlnvo;(0teur(opny4om e ietat a2trx  ou4oeto ociysfs rm(mon(0areoxr3tatfmD lies t  eto(r3oodlmen neilt s2urxr ;t1apt ifcilt s2rmnmont4tltnxo ootfmt liei;(  2xrxopiodlp   fesas aDuaurooo0aptn feiydfa rln o (0tetnir iy1lpDeaueils)seumiopnudlme mneils  Dra(m oo0tetoio3taslsDulnmpnu0aexrifcio1omt aues;( t2uoio3oydaltnlici s a2tau pot0oetoii3iatfmDua(vs;u0altrmfciy1fmtranvs s teum(r3nu1ol   icta()a2taumpou1oeen o3iytfsDranvp;() etnmf iadoaDrlieo;(0seurxm ny1ap e nviat sDtaurpoo0apxnif3iyt aDel(msnu0treomo3iotfm e nei ( trxo(mpnu4lp elnei s)srrr(mo;o0aet io3iltlm el( pnu4texomr3iy1fmD auvi;s0truoim no4oltnliei tfs2rrx ooo0tpxnmietysla2rlnmp t0tlxnxocta1fpD aueols) rtm(o no4amte fcilt arrrxroou1teto fctlsls2emnms;t)aexrxf3tatfa  livo ()srtmirpny1ape  iet t)aDrm(  ;u0alx  iciltla2ua(mp;(0tleomf io1om r n s;t0 exrimpoo4lmt lfvta( a2rau  no1olxnmoeiltlm em(mo (4 etoif3tatfmteaies s) rtoxo io4lleelncsl( sDtau oot1teeomietytlsDelnmon() lxrifcoa1oat li ol(  2urxo nu1omtemict sf rurur ;t0tltoiieild s uau pnt4alerio3tydlm eauvo s t2xoir3iy1ol nlnetlsfsruaur ou4olxnif3tld m2ul( pnt4 etrxociodfp  auvsl()trtr(o iodome  nvs t) rururo;o4tlxomoeilsls2elnvs;t4arermfctydlpDelnvs;t)trxr(r3iu4optnmfct t s2ta(mo;t1tee if3tytfsDrln snu)teerio oy1fm rauei;s0sexrim3ou4ap emnei ( s2umumooo1alx mf3iad m ea( on(4teerio3oatlpDeli ol( srtmio3iy4ap emfvt s) rtrx oot4tpx mociadfm2el(vs (4altomr3iadomDrln ols)texrim3iodam emies s)a2um(m nt4tlxnmfciyt s rauvs;u4 ltoifcia1opDrlivo;t0s2triopiy1lm  lfvsat)aDrrxrooo1aleo oeiasla2ranmp;u)teermf3oadfm ranvi ()srtm(r oo1al  livil(fs2rrxrpou1apt  feiaslmDea( sn(4aetoxo iatlm  aueo;t) etrxo3nodamtn ies s a2raxmpoo1ole io3iatfm2ua( on() lenmf iatoptraieil(0srurxrpnydameemieta(f ruru pno1tpxn feiad s2rlnvs;(4tlxnmr3iadoate nvs s0trxmxopiydopt  iesls  ruru pnu1opxomieiydlmDeanvo;t)trenif oy1oatrai o (0 ruoio3iudape mnctltfa2uaxmoot0tpen octysla ea(vs;t)altoxo tydfmtrlivi t)srto(mpio4ap nmivsa()s2rmx poo4ale moetltfmDrmums u0aexrxr io1lpte nes;()s2urxm3oodaptn ivtatfsDua(rooo0apx ioetatla uaump (4 leoioctatfm raivo;s t2toim3no4al   neia(  Drru  ;o0aetnmf3iadlm rlnmsnt)aeeomr oatfm rluei;t  rtr(mpno1lm nmiet (fa2umuront4oltomietltfm rl( on(4altnmf3iatfatrai ils0 rto(opiydape lncil()a2urxronu1aptomfeiydfa2rl(msnt4teenirctodoptr uvi s) eurim oydlm  mnct t)sDua(rooo1tpxnmfeiat m2umnms t0trtrmo3todfpteaies s t2xoiopio4lm   fetlt  rtau  ;o1olto ociysfm elnmon(4trxomf iydop  aueo;t  rtrxm oo1am nlici s  2ua(m nu1opxn iciytlsDrau s;u0aetnxrctatfp eaies t0t2urimpiodopeemncsasf 2rrum ;t0apx mfetys aDum(vpn()areoio iydom ranesl()srtoio3oudlm nmfct t)sDrm(m ;o4apx mociatlm ulnvpnu)areoif3iotfp elnvslt0s2tmiopoodomeemicta(farumumo;o1aee  iciltlm2ulumpnt4 lenmr tytfmD ai o;t)s2tmxo3ou4om   fvsasfarua(m ;t4tetoii3tldfmDemu p;u4 leoifcta1lm  lnvs (0 exo(mpnydal   ivsas s2rmum ;t4opx  feilt aDeanmp;(4 exrif3iatom rliei;s0 etoxr nodamen fci sfsrraum ;u1olxnmieiys a2um( s ()alermfctytlaDrlnvs t0trtm(rpoo4ll  lietat)a2trum ;u0aetoii3iatlmDeanvsnu0trxoif iy1lm ranvols srto(m ou4ll   nei t) rum(mono1alxoioeiatlmDrlnmon(0teenxocoy1om  au s t s2tm(r3oo1alt mfct s)aDtmxr ou4tpx  fctad s2emn pnt) leomo ta1fpDe ueo;()setm(o nu1op elncsat)srtax oot0aee ifeiydfmDua( p;t4altrio3iodoaDelnvi;(  2tm(mpny4olte nvt (fa2ua(m ou1teto oeiyd s el( s;t)tetrmfciytfm  aueils0srur(r3no4ll   nvtlt)aDtau ooo0olenifetysfs ea(vpnu0aetomocoatoa   nvilt0trxoxo iu1altelivsa() rrm(rpot4oeeoifeiysfs uaums t0 renmo todlp r uvo (0 rxr(o nydlp elivilt)a2rrxm ou1tex  o3iltfs eauvp;(4aeenxoctadfpte uvs;t  etr(r iydapen fcilsf Durxmonu1tltn feiyt m ra(vo;u4tetnxrctodlaD ln sl(0 2xrxopnodal n ncil(f 2umur ou1olt iocilsfsDuanvpnu0 lerxr tydfm   i il(0srxm(m iodolenmncils)srurxr ou0apxn iciysfsDraumsnu0 reniociatopDe uvs;( t2xo(r no4optn icsat)sDtm(rp;u0oeeoioeild s eau s (4aexomo3oodoateanvs;t  euoimpou1omee ncta( srtmxmp;t0apenmoetytfaDemnvs t0texrmr oydlm  liesl(0 ruoim3oo4amtemicta(f 2umx pnu0opeo fciat mDuan o;t0aetoircia1fm e uei;t)s2uoim iudopenlfcsatfs2tmum oo4optnifeilslm2ul(ms () ltnxr3ia1oatraiei t)s2um(r3iu4aleelict sfa2rrur nu4olt mi3ilsla2rln snu0 leniociotomDe i o t0tetmiopio4open ies s a2ra(m ;t4tetomi3tltfa2rauvo ()trtnmf3oytfaD  uvsls0setmim ny4op elivsltfa2ua(r ;o0alt mociasfm el(vs t4arxrmo3todfat  n i s0 exrio3ny4lpen fcias sDrm(rpou1tle ifeias m2umnmsn(0arerir3todfatraivilt  exoxrpiy1am nmfet s  2truront0ale ifciltls ulums u)altrif oatla eanvol(0 etoxo3ou1lmtelies () 2rm(rpot4opt iocias mDem( s;(0areoif iytfatr n o t0seto(r3nu4opt lnesltf Dtm( pnt1tle  feiad m2ua(vs t) lermf3iodfat aieo;t)trxoio oy1om nlneils) rum(ro;o1tet ifeilsfm em(vo u)tetomo3ta1op rau o ()t2um(opnudlle mfct t  Dur( oot0aeeo iciltlm2rlnmo t)arxoif iy1fp  ai ol(0trtoxr iudom nmfvsat s2ra(  oo4tet ifeiadlmDel(ms () lxoir3oa1fmtrlu o () etoxo nodlltelneilt) 2trumo;t0tpxnmfeilt m2uau s;(0 lxoif ootlpDraivi s0 2xmxrpiudalte fvi t)aDtm(m nt0tee iicild s eluvo t0trxoiociotomD  i s;s trum(r iu4ameeliei sfaDtru pou1texomfcildfa ranvsnu4 lxnif3ia1omDe nvo t0sexmxm3nudapenlfcia(  Draxm ;t4olenmi3tyd aDrau s t4tlxrir3iy1oat  uvsls trxmxrpiy4ap e ies ()artmxm nt4tpe mfciyt m uanvs;t)tlxrmo3iadoptr n i;()srtm(opio4oltemieias)s2uru o;u4tpenmociltfaDrauvs t) exomf tatfmt luvs;s  rtr(o3oudamenmicils)aDurx oot1olxo iciydfa umnms u4 reriocoy1latrlieils0s2to(o3no4amtnmivtlt)aDurxm ou4opxn ocildfa2eaumpnu) exomoctadomDeaueo (0 ruoxo nu1lme lictl()aDrm(mp;u1apt  iciyd aDeauvp;()trtoxo3iy1opt au o s0s2xmxr iy4altnmfvs sf 2rrx p;t0aeeo ictatfaDum( o;t0altoxo iatfpDelieo s)t2uoirpoydlmtnlivia(f rtrum ;t4tlenifciydlmDua(vo;t0tetnmr ia1fpt auvo;s  etmxopnodap  mfetasf 2rmxro;o0oexniieild mDrauvp t0 etoxfcoo1lmtranvi (  rtrir3iy1ole lfcta( s2tru  ot0ole if3iasls2ul(mpnu4texnio tatlaDeliesls teurimpiy1oltn fvi tf Durum ;o4optoioctydls elnmon(4areomf3oytlaDe ivs ()t2xm(m iy4lpenmncsat)s2ra(r ;t1olenmfetasls2ra( s;(0tlenmf3iatlpte iei (0t2trir3nu1om emivi (f Dumxmo;u4tlx iietytla ranvs;u0aetrmr ia1omDrlnes t) rumirpno1lpeemfcslsf 2ra(mpou0teenmo3iysfaDrlnvpnt4 ltnxr3io1optr ivs;s)s2xrxr3oydame lietas  2tau o;t1apt  ociadfmDum(mo;u) lxnir iadfm eliesls s2toir3nu4aptnlfes t a2rr(m ou0alx iicilt a ra( pnt0tlenir iodfaD  neo;( seto(r io1ope mnvt tfs2um(moou4tpt  iciys s uauvs t4 rxrif3tydlaD lnei (  eto(o3oo4lp nmicsl(fsDrm(  ;t4oex io3iysls2rmnvs;(4trtnio ty1lm  anes s0trto(r3iy4oltemfetls s2raxmono1apxoifciatfm ranvonu0aetnio3iy1oateaivo (0 2toimpny1llt mivsas a2rmxrpnu1tlx  o3tadlsDem(mp t4 eerxfciatfa r i s;() 2uo(opou1al emieta()sDuaxrpot1aptoio3ias m ea(mo;u4arerxf oatfaDr n o ( seum(r iydamtnmfeils)a2tmumo;t4aptoif3iytfm2elnvo;u4teenmfctadlptrluvs;s0setrirpoydlltnmictltf 2ur(mont0oet iietysfmDea(vpnt0texoxfcty1fa  au s;()t2xrim3iu1ol  lfetl()aDtaumo;t4oeen oeiysfs2ua(mon(0texoxo tydomtrlu o t)sexrio io1lleelnet s) Dtrxm no1aptomoetytfa2elumonu)aetrmf3oatlm rln o;( t2tmxmpno4ame mneil( s2taxrp;t0olt  icilt sDelumsnu)aetrxfcoodoatr ues;s0seum(r oydame lnetl( srrau p;u0olx ifetltls em( p;t4arxomr iy1fateluvo t  exm(r iy1olenmnctls)sDurxmono1alt iietyd m ul(mpnt) renio iytoaDr nvols0trxoim3iodll   ivta() 2raxrp;u0olen oetytla em(vs ()trxomf io1fat  uvi ()trxoir oo4opt  ici s arurxrpnu4tetnii3tat a elumonu4 lxomf oy1lmtrau i;s)sruoim3oy1olee fvsat)artmumo;t4oex  oetadfm el(mp;t) lenmf ia1oat  ivs s)t2urirpny4omee fvil( aDumu pno1aee miciasfs2rmnms;()aexnxr iadfp eliei s0teum(m3iydlptelfeiasfs2tau  ;t4olx  i3iadla2eaump;u0 lerio iydoatran i ()sexoxrpnu4ap n nes s)sDrm( ooo4texoii3tlsfm rau pnt0arenxociotfp ean s;s0 eur(m oo4al e icsls aDrrxmpot4optoiieilt s2el(vsnt0texrmf3ootlateai sls t2uoxrpio4lm emnvs t)a2uax  ;o0tleoioeilsfa emnmont4trtniocta1om elu ils) 2uoimpnudlpe mnvilt sDumumono1oee  ocils s2elumo;u)trxnmfcoo1opDraivilt sexoxr iydal nlfvtl()srrau  oo0tex ifetys m emn s;(4 exnmr totfa elieo (0 2xoxr3no4omee fvsat) rum(mpnu0aexniieiys mDuaumpn(4teenxf todoaDeanvs s) 2xmio oy4omt lnviat)srtru pou1tpxo oeiyslm2eanvs;u4aetrmr3ty1omDrlieols0setoiopnu4optemncs ( a2rmxrpot0oexomicilsfm2ra(mont)texnif3oo1om ran i;()trtmxm3oy4lpt  iesa()sDumx pnu4tleoio3iysls2uau o t0trtnxo oo1fa  aiei t)sruo(r iu1ap   nvsl(fsDtmx  ot4oltnmo3tad s umn p u) exnxfcty1oaDelnvo;()s2ur(o3oydlpeemnvtatfaDtmxmp;t0optnmocild s2ulu o t0 leoio iotlpD aueo s0t2urir3ny1lpe  fei (fa2tmuro;o0oeeomfciydlaDeanmonu0artoirciy1lptr iei ()seur(o iy1lltnlics sfaDua(mo;t0apxoiiciltlmDum(msnt4artomr3oytla r uvi;t srxoir3iu4opt  feias a2ra( pot4tpt mociaslmDrmu pnt) renxr iytfa  auesl(  2xm(m3nu1lltelietlt sDrm(r no4olxn i3iad sDel(vont)altnxrctytfptrlu ols)t2urir iy1ll nmfvslt) rrmx  oo1oeen fctlt s2eanmont)artoir todomtelivs;s0truo(rpiy4lp n ivi t) Dra( p;t1texn ociyd mDemn p;(4trtomo3oatlm   u i t s2xmxm iy4lp n fvilt artmx pnt4alen o3ildlaDrmuvp;u) lerxo3oadfp r u o t setm(o oydoltemivt () 2tmxr nu0tltnif3ilsfaDrauvs;(0arxrio ty1lmteaieo t tetm(m3iu4ale micsl( sDrrxro;o4tet  fciltfa eluvs u0tltrxr3iydoaDeanvs t srum(m3no4lm  lfctl() rra(m ou4tetomo3iyd sDul(vo (4trtomociydfpD aivs;s0 rurxo3oy1lltemfvta(  rururoou0tltn f3iltfs2rmump (0arxrif3totfptrluvo t trto(mpou1apt mnetlt)s2tmxm ;t0tpx  ieiys s rm(mo;(0treomo oy1fmDrau s s sexoio oo1lpe lnetls a2trxr ;o4oeen fetytls2eau s;t0artrxf3iy1lp  an s;s) eumim3iu4om eliesl(fs2rruronu4olenmociltfs rmn ont4 exrio totlp raneolt)s2xmio oydll  miviatfsDrau o;o1tlx  i3iysfaDrau o;u0tetnmr oadlpteaiei;( trtrxo iudape mnetltfsrta(mpot4aex moeiyt aDumn s t)aexnxf ia1lp  lieils)seum(o oydlptn fesl()aDum(  ot4oleoiietld mDrmn s;t0teeoxr3tydlm eauesl( setrirpiu1amenmfvsat)a2tm(moou0olenifetltlsDrmump t)tlerir todfa  auvs ()t2to(o3ou1lpt  nct t a2tax  ;o1oexnmfetltla elu p;t4alxoio oatfpD lieil() etmxmpoo4op elncta(fa2rmx p;t4ale  oeiytla umn s (4 lerircio1lp  aueol(0 2xmxr3iu1lptn ncs t) rtmum no0ope  ieiysfsDeau p (0trerir oydla  livs;t srxrxm iodomeelfeia( a2rmump;o1olenmi3iadlm em(vo;u0 rtomr3ta1fp ean i t teumxm3ou4oltnmieta(f rumu  ;t1tetniiciltlm ean s (0artnxr tatfmte uvi;(0srxr(opnu1lm emivtat)aDra(  nu1ale  i3tydla uan s;(4trxrifciatomtrli s;s  rumir3nodlp n fet sf Dra(moou1altnmf3tyt sDrmu s;()trxoif to1lptr uei s)t2xmim3iydoltn icslsfa2rau  ot4opeomi3tatfm uauvpn(0alenmfciatlpDeaiesls0srxoxrpoydap e fetlt)aDra(m ot4oltnmi3tls aDrauvpnt0texnxr tatlp rauvsls t2uoimpiu1am nmivil() rtrumonu0oetomfcils sDra( pn(4alerif3totomte uvs;(  euo(mpoydop  mfcsltfaDurxro;u0opeomoetasla um(vpn() rtrmo3tatfmt auvslt0 2umxrpou1ameemncil() 2tm(rono0apx mfeias mDem( s;t)tlxoxr iydom  aneols)t2xoxo3no1lltn ics s sDtru onu1apto iciltlm2el(mo u)trenmo3iy1lpDr i ol(  2uoimpiy4ap emivs sf Dta(  ;o1tlxnmieiasla ua(msnu)altrif oodfmDe nvo s)srxrxo iudal nmivias  Dur( onu0tptoifcilsls rlnvo;t0 ltnmr iodopte u i ( srxr(opiy1amtelfvs s)s2uaxrpoo1teeoioctldlsDum(vo u0 etomf3tydlaDe u i;t) euo(mpiudlpt lfcta(fa2tmxmont1ape  o3iltfm ra(vp t0tltrmocto1lp   n i;()teur(o3oo1lm  liet t)aDtr( pou4tptoiietyt a2em(mpnu0 ltoxrcoydlmDraueo s sexoio ou4altnmicsas a2trurono1alenmietydfs2ua( onu) lxnmo3oo1la   n s;s)s2ur(o io4ll n fvilt  2tru  ot4oexn o3tysfa2ua( pnu0aetrif iodfaDr ivo t) etoxm3ou4lmt lfvsls  Duau o;o1olxomf3tlt sDel(vp u4aetomociy1la eaivi;(0s2um(o oo1lm nliciltfsrum(r ;u4olxn fctaslaDum(ms t0artrmf iy1fp r i s;t) 2trxo3oydam  micil( arta(mp;o4ale mi3iydlm rln p t)tltoxf oydomDraues ( t2xoim3oudlpe mivilt  Dtm( oot1opxnio3iyt mDrluvo t0treomr tytlatrauei ()setm(opoo1lp emieilt) 2raumpno0tltomoeilt m uln ont0trxnio3tadomtr ies (  rurio3iy1aptnmicsatfa2uaxmooo4ale  feiys aDrlu on(4 rerxocio1om   ieo (0 eumxm3no1lpe lfeta()sDraxmpot0aeeomf3iasla2eaumpn(4 renxf3oa1fm elu s s s2tmir nudlpe  ncsl(fa2tru pou0texnio3tldfm2uanvpn(0 exrmf todfmDrai olt0 rxrxmpoy1al elietat) 2uaum oo1alxnmfctas m2rmums;u) rtoioctatlpD aueo;s trxrir iu4ll  mnvt t  2tru pnt1oetniieiytfa raumont0 rxnxr3ootlm eli sls)texrim3ou4olt lnct sfsrumx ooo0alenif3ilslm ul(vonu)tlxrmocoo1oatranvs;s texoxopnodamtnlicilt)s2rau  nt4apto fctydfmDem( on(4trtnifciy1oaDraneo;t0t2uriopno4ap  lfes s) rrm(rpot0oee  fciad m rmu snt4aetrxf iadfptrlivs;() exmim3oo4apt  fciat)sDrauroou1tle if3iadla uanvpnt0trxnxf tytlmD lueo t0 rxoxrpno1op e fciat)sDua(  no1optnio3ildfm elu p;(0tetrxo3oydlp   i o;s)srur(mpiu4am   nesa( srur(  nu1tpe mociyt a eln snu0 lerxrcio1fpD aiesls0s2uoir io4ame lncsl(f ruaxmoou1aetoiocildfm uaumonu0texnmrciodla e uvils0t2xm(o3iu1lmt micil(fa2ra( pnt4apeo i3iaslsDum(msnu0 etoxf3todlmtelivo;t0s2xoir3iu4apeemiesls aDum( o;t1aeenmiciatlm2em( s t4teenmfcia1fpt aiesl(0teum(r3io4omtemneilt)sDurxm nu0oeto i3tydfs rlumsnu0altnxrciodlmD  ues t) rtoxm3io4ll   fet (fs2trumo;o1tptoifeiad sDul(mo u0 ltrxfctatoatelnvi;t) eum(mpiu1lptn fvsa( sDrr(m ot4opt iiciadfm rlnmsnu4aexrmrcoy1faDeluvi;t) 2xoio3ou1amt  fvtat)arraxr ;t0tlxnmf3iyt m2em( s u0 renircoodfm rli i;t) etoir3nu4lme lnesa(fartaxmonu1texo f3ilslm eau o;u) eenmf3todfptelneilt)sexrxopoudomtemfes ( srrau  ;o4opeomo3iatfa rlu s;t) renir3tatopDeaivo ( trtr(opoy4olt lfvia(fs2trxmoou0tpeoiieiyd a2ranvsnt4alxnir tydfmt aneo;(0 rurir3oy1am e ies ( aDrrum ;t4oeen iciytlm ra(vsnu4tltrxo3io1fptr i olt)sexoxrpiy1amtnmiet t)aDrax onu0tet mo3iadls um( s u) lxnio3oytom  lnvo t s2tmim nydlmtnmfvilt  Dtrxm nu0tpt io3ildla2em(ms;t4texnxr3oodfmt  uvs;s)s2trxr3ou1al n ietas)aDtaxmoou4aexnioeiatla el( on(4 reomf3ta1op raivs (0truo(mpoy1ll   nvsas  Drmu  ot0apenmi3tls aDuauvs ()tlerir3iodfaDr ueils texoxmpnu4ome mictas  2umumpot0open ieiyd mDelums;t0 exnir3tadomtr uesls0teumxrpio1omte ict s)aDrrur ou4altoiiciatfm2ra(mp;u) rxrir ty1fpteln s;t  2ur(m ou4ale mnesl(f Draumpno1ole  fctyt s umuvs;(4tlxomo3iy1fm e n s;s) 2to(o iu1ope lfeils)sDumuroot0olenio3ils s2rmn ont0trerxo todla elneo;( tetmxm3oo1am n fci s sDtmx pou1aptomociytfs2rm( p u4aexrif iydlpDe n olt0 rumxm3oy1lptemivt (fsrtr(  no1open fctad mDrmnvs t)trenifctotlp  au s s)texoio3iydoltn nvias  Drm(mo;o0tle mieilt sDua( ont4tlenmo3iotla r uvs;(0t2xo(o no1al  mneia(f 2umxm ;o1olxnif3iyt m2ul(msnu4trxomo iydfatr nes;(0s2uoimpiu4ome mnctls s2ua( onu0ape io3tytfaDrmnvsnu0alxrmr3iotfptrlnes s) rumiopoydopt lfvsl(faDtau  nt1alxoii3tytls ran s t) rerxocoydoaDrauvils0 euoxm iudlmte icta( a2taxmpou0tpe  oeildfm rm(ms (0trxnifcia1oaDe uvi;( tetrir io1al elfctlt sDrax  no1tpeomf3iyt mDua(msnu4aeeoxr3tadfa r u s;(0srur(o iu4lle  nctas  Drmu ono1opt ioetadfa el(vonu0aexrirctatfmte nvsls)t2tm(o io1omt mfei t)aDuaxmonu0tlt iiciltlaDea( onu4aleoxocoadfmte uesls0srumxrpny4om nlncsls)aDurx o;o0teeoii3iytfsDrl(vpnt)altrxr oadfp eai s t0trtoxr no4ol n ivtat s2um(r oo0optomf3iatfs2ra(vont)areomr3oo1fp   n ols0 2xoxr oo4lle mivilsf 2tm( pnu0ale  i3tlt aDea(mpnt0tlxrmo tytla r ivs;t s2tr(mpiudlme micilt)a2urxm ;o0apx iietytfaDra(mpn(4aeeomfcia1fm rlieo s) exrxo iydamenmfvsl()s2ur(  ;t0opeoio3ild mDra( on(4 etrxr3iydoatrluvslt seuo(r iydapen iciasfa2tmurp;u1tptoioeiydlm2rmu sn(0aeeomr oy1om   iesl()sexr(r3nudolenlfcsat) Dtm( p;u1oltnifetadls rlnvs;u0 rtomo3iatlaDe i ils s2xriopnydlpenmiei ()s2taum nt1aetn i3tydfaDeluvo u0trtomoctodoaDr ivo ()tetm(rpoy4lmtelfcs sfa2rrumont1oexnifetltfa2rm(mp u4trtrxf oa1oate i s ( t2uo(o3nu4lm n nvias artmxm ;t0altoiieiyd s2uluvs;u)tlxrir3todoa r n i t srum(m3oudaltn icsas)srrrx p;u0tltoifciltlm2ea(vo ()tleoif3tadlp eaivo;(0srur(r nu1optnmfetls a2um(r ;u0ope moeiasfs2rmn p;t)arerircoytfmt anvolt0teurir3ou1ap nlneia(  2rmxroou0opt mi3iltfmDelnmpnt) eeomfctatlaDeaies;s trur(m3no4open fvtlsfa2ur(mo;u1alt mf3tydfm2rmuvpnu0 rerio ootomt au o ( trtrxo oo1am   ies t) rrau  ot4altnmociyt m rmuvs;t0 reniocoodla  an il(0seumir nydll n nviatf ruaxr ;u0tpe iieiydlm rm(vo t0arenxfciatoaDraneilt0trtm(o3nu1opeemivtls a2truroot4tpx moetad m ra(mpnu4alxrxf ootoate ueo;()t2umio3oo1lmen feia()sDuax poo1aexoii3iat a2eauvs u)aexrxr3ia1opDe n ol(0sexrxrpio1olenmfcs ()sruau pnt0tlt  feilsfmDrmn p;(4teenioctotfpt anvsls  eumxrpny1ope mnctat)sDtaum ;t4alt mo3tadfs2eanvsn(4arxriocty1fmD anvol( teur(m no4lme micta( s2tmxr nt4opeomietatla2rmn p;t)artrmf iodfmD luvo;s)seuoxm no1omee feil()a2rm( ono4tetnmi3iasls raumpn(4 rxnio3tytla r nes ( trxoxo oudol  lnci tf rumxr oo0aptnmoctydlm umu p;u4aexnmo oadomD aies;s0 2xm(o3oo1lle mici t arrmur oo1oleoif3tasfmDra( s;u4aexrir3ty1omDelueilt t2tmxmpio4openmfetlt) 2umxmpot0ale moctyslm2rm( s (0arenmoctotoatr uvols sexmxopoydllte fcia( sDum( ont1aeen f3tas s ea( pn()aeenio tatlpte i s;t0tetoxopnodlptelfesl(fa2umu pnu1alxnif3tldls rm(vo u)trtnxocia1optrlu s ( tetmxrpnu4op elics t)a2rmxmpot4tptnmicilt m ulumo;u) rerxfciydfat livols) 2uo(mpou4om nmnvtltfsDrr(ront0tlx io3iltfa2um(vs (0 exniociodomD anvo;() exoio3oodomtn nei s arua(r ot0oee mictldfmDuln pnt0trtnircoytlpte nvolt0teur(opnu1llenliesl()aDum(  ;t4apt mfciyslaDulums u) rxnmo tydfaD au i (0 2to(o3nu4lmtemnetls  Dta(rpou0tpeoifcildls2rmumpnt4altoxociodlpDrlivo;t0 etr(rpio1optelictlt) Duaxm ;t4oeenifctas aDumuvpnt4alxomo oo1faD lnei;(0 rtm(r3oudam   ivtasfa2tmur nt1olenmf3tlsfa rauvs (0 lenmr3oadfat  iei s t2tm(m3oo1ame  neias)srrrxm no0ale mo3iasfmDul(vs;u4artrxr3totla rauvsl(0sexrxo oodll   ict s)s2raum ou1oltoifeils s2rauvsn(4aeenxf3io1fatrau sl(0s2um(r3nu1oltemncta( s2ur(ronu0altomiciatfa elnmp;u)tetrmocoytomDelivi;t)s2toiopio4amt  icsl() Draxr ;t4aee mo3tatfa2eluvsnu) ltrxocoa1omDrln slt)trtmxo iy4lmenliesltfs2umxmp;t1tpeoif3iyt s2uauvon(4aexrxfcoa1opt auei;(0sexmim3ny1lmtnlfvilt srtrxrono4aexo i3iatls emumsnu4alerio3totlpDraivilt)tetrirpno4lle  iei t)aDta(rpnu1apenif3iadfa2ua(vo u4trtrmfcoadom   u ilt0t2umir3io4lpe mnei ( artax  no0tee ifeiytlaDuauvs;()aexnxo oy1fmDrlies s)srxoirpiu4op emnvilt srrrumpou0texo oeiltls el(von(4texomf tytlm  au slt  exoir nudlm emfvtat  Dua(ro;t4oexomo3iasls ua(mp ()alerxo ia1lm raneol(0 2xo(o3ny1omtn iei tf 2tr( o;o0aeeo oetltlmDua(vo;(4trxoxrcty1lmDeau ols0sruriopiu1lme mnvt sfs2rrxrpou0apenmo3ildfs rmnmo;(4 rxrir tydlmte ieo () 2xm(mpoy4op  lnvsas  rurur no0tpxn ieiyd s2ra(vo;()aeeoircoodoatrlueilt)seum(r3iu4lm e ieilt  Drrurpno4aleomfciatlmDemnmo;(0alxnmociy1fptran o ( tetr(o iu4aptnmncils sDum(  ;t4olt  f3iytfmDel( s t4arenmocoatfatr nvs s)s2xrir3oo1apeemfet t)s2umx  ;t1openiociydfmDrln sn(4arxrxrciatlmt lu s ( tetriopno4ap nlnetas)arrau pot4alenmfetld m2ulnvs;t4 rermoctytlaDrlivo (0 eur(o3oodapeemfei () rtmumont0oleo f3iasfs emu snu)tlxoirctodfaDe u s (0setmio3ou1al emiesl()sDrmu ooo4opx  i3iysfsDelumonu0 rerircoytfat aivo;t0s2xmxr oy1ap  lfetat sDurur ou0texnmoeiaslm2ul( onu4 lxoxr ia1oate n ilt)sexmio iudape  fet tfa2tm(ronu1tpx iiciltls um(vs;(4 etoio iatoa  anvi s)trum(opoy4am nmfeta(farrmumpot1tlxo ietytls eaump;u4 lenifciotfat anvo;t0 eurxr3io4opeemnet s) 2rr(rpnu0tle mfeiyd m eauvo;t4 lenirctytlmte ueols0s2urio iodal e iesl( aDurxr nt4aetnmfciyd sDeln p t) rtrxoctotoat  uei;s sexoxo nodope mfei (f 2tr(mpno0opx  o3iasfsDelnms u4trxnircio1faDeaueo;t0 rumio oo4ol n nvsatfs2ta(m ot1alxnmo3iysls ranmp (0aetoir tytomD ai s;( s2urir no1am nlicia() Dtaxmo;o4aex ifetltfaDrmu pnu)arxrmoctodlmDranes;s  rtr(rpoy1ape mies s  rrmu  no1optoiociys a2umumsn(0tltoifcoodoa rlnvi;(  2umir3iu4lp  lfvtls)srua(  nt1optoio3iyt a2ea( p;u)altomf iydomt lueo s0 rxo(r ou4al  lfeil(fsDuau pou1aptomociasfm2ra(vp t)texomr3iydoa eauvil(0t2xrxm3oodlmt  ncilt  2rrur nt4tex mieilslm2ul(von(4 lxnio3iadfm eanei t0srxoir iu4lmeemnes t sDtmxrpot1texnmi3tldfmDulnms t0 etrxf3oatop  anvo t sruriopoodom nmfviasfaDur(r no4alt mi3ilt a emnmon()aeenxf oydlpDelnvsls0 ruoimpiodlm nmneia( arrr(mp;t1tpeoif3tad m uaums;(4alxoxocoa1fp  an o t)teum(o nu1amenlncs (fsrrmxr ;u4apxo i3iydfs eanmo u) eerxf tytlp eli s;t0srur(opnudamtelietltfsDumxmoou4olto f3ilt s ran s t0trerifcio1lpteluvo;s  eumir ou4olen iesl( arum(rpou1tpxnmoeilt a2rmnvo;(0aeermo iodlm r ueols  2uoiopoy1ap  mnvi t)arrm(m ;o4tlxomf3tltla2ul(vp;(4teenir3ootlatr iei t0seum(r iudalte ncs () Dtrxrpno0olx  f3ild m rm(vo;(4aeeoxo3ta1oate u slt)t2uriopnudlptnmncias sDrru  nu4tpxo ieilsla eanvp u4aexoxfctadlmDrlnvs;t srtrir oo4om nmictas)srtrx p;o4alenmf3iltlm rlnmo t4 rtnmo3oo1lmtrauvil(0 2tmio3io1om n fcta( sDur(mo;t0ape ii3tysls rlnvpnt4texoxr totlaDrli s (  2xoio3no1aptnlicslt  Draxmo;u4optoii3tltls2umuvp () lermo3tadfate n o;(  rxmxo3nodamt lnctl(farum(mooo4tpx ifctyt a2rlnvs (0tetoxo3tadopDelnvsl()s2umxm3no4ap nlnvs sfartaur ot1ale moeild a2raums u0teerxr iatlmte u o;t0trtoir oy1ll elietlt)a2rmumo;u4ale ifeils m2em( pnt4alxoir io1fpt liei;t teuoiopou4ol nmivsa( artm(mont4opx mo3iys m2rmnvpn()trerxo ty1fmDr uvsls) 2xm(opio1ameemfei s a2tru ooo1olxomocilsls2rmums u4texnxfctytfpDrluvilt)trum(rpnydamte nvs s a2ta(rpnu0oexniieiydfaDrl(vs u0arxomoctotlp eaivi s  rxmio3iodlmee nvt ()sDrr( oou0ale moctltfa2emnmpnt4 etnmo to1fpt lnes s  eto(rpio4lp n fcta(farurx  nu0aexnmi3ilt m rlnvont0artomfciydlptraies t0seumxopno4lptemfesls arumx oou1opxn ociad s emnvo;(0texomr oytfp e uvs;t  eumim3nu4aptemnvia(fsrtr( oot0oet  oeilt a2raumo;t4altoxr3iy1fmtranvs (0srur(o nydlp n nvs (f Dtaurp;t1aexnio3tyslaDemnmp (0 eerifcoa1fateln ol( s2urirpio1ole  fvi (fs2uax  nu0oexnmieiatls ul(mo t)artnmrctytlmDeauvi;s sexmir3nudamtnlfeiat)sDtr( p;o1alto oetlsla ulumont4 reoxo3oa1opt li ols0tetr(r nu4amenliet ( arumurpno4aee  fctadlmDean p (0arenxr iytoa elu o ( tetmirpny1ol e fes sf Dtauro;t0apx ifctysls2rluvonu)aetrif3iotfa   i i;t0s2umxr io4llt livsasfaDur(  ou1opt ifeilslmDeauvo;t)teermo3oa1fpD aivo s) 2xoir oy4ll  livil()sDumx p;t0tpeoii3tlsfs2el(vo;u4tleomf oydfpDraivi;( sexr(opiydom e nciasfs2uru onu0alxn f3iadfm2rmump (4aetomo oo1lpt  uei t  etoxo ny1alenlfcil(  2tr( pou1tpe mfeiaslmDemn o;(0 etrxr3iatla r uesls  2uo(o oydolt mfes (  Dtmump;u4tpx mfeilslm emuvpn(0aeeriociadlaDranei;()texrio no1altnmfcsls)sDtm( poo1oet mf3iaslaDemums;(4 etrirctadfpt au i;t)s2trxr3no1olenmnvsl( s2tax p;o0openifetasfaDrlu o;u0tlxnmfcoy1oa  auvsls0 2xrim ou4lmenmncs tf Drr( oot4tlxo iciatfs rlums u4 rxoircia1lmDrlieo t)tetoio oudalt lnes (f Durxm ;u4teeomfetasfsDemnvp u)aeeomfciydlmD anei s0trxm(opiudlpen nei ()srrmu  oo4oltomi3ildlaDemnms;u0 exoio3iydfate i s;(  rtoxo oodole mfcta(fa2tm( p;t4tptnioeiyd s rln o;(4tltoiocto1fpDe u o s0srurxm iy4amtn ies s)a2rmxmpnu1oexomfctasfs um( ont0aetnxf iotlmte ueil(0seurirpoo1alenlnvtat) Draxrp;t0aexomi3iasla elums ()alerxf oo1omtr uvils s2ur(m3iu4lp e fes sf Draurooo4alxo fctld aDeln pnu) rxomf iodfpDraiei;s0s2xm(opno4opeemnci (f 2ra( pnu4tlxoiietas a ean p u)arerio oadomD aivi;( truoxo3io1aptn ivi ()a2rmxm ;t1tlenmictadfmDeau o u4alenmf iy1opD  i o;s) rurxmpnodoltnmnctls) rtr( o;u1tpxoiietlt m um(msnu0tltrxrcty1fa eluvo;(0srxoxmpio1opt  fesa(f 2tm(r no4alxnifciadlsDum( o u4altoxfcoatoa eai o ( trtoxopno4lm elfvs tfa2um(ro;o0apxo oeiaslm2rau o t4tleoxr iodop   ivils  rumir3iu4llenmneil() rrrumo;u4tlt mo3tyt s2ra(vonu4teenxfcoy1opD livsl(0teur(r3oy1lmtelnvi tfa2tmu pot0oeenif3tltlsDra(vo u4 leoxr ty1fptelivo s) 2xrxm3oydoltn nei sf Dtrxronu1apeomf3iasls emuvp u0tlxrmf tydfptelies (0 rum(r3io1ape  neiltfa2uaxmpou0oleomieiyt m2emnvpnu0altomo3iotfpDeaieilt0seumxo iudlmee ivsatf rrrum nt0oltnmieiadlm2rlnvonu4 rtnir3oy1lpD  i ol()seumir ny1op   fei (  2tm(m nt0tlxomieiatfm2eau pnu0altnmocia1fp   nei;t)t2toxopoodole lnei s  2ur(moot4tlen ictysls2rlu s t)trenmr3ta1la r uvs (0 ruoio oudllee ics s)aDrr(rpot0alen o3iytlsDuanmo (4 reomo iotomt  ueo s0 etrxm3oy1lmt licia()sDur(mpou0apenio3iysfmDuaums;t4tlxomr3oydfpt lues;s)teurir3iy4llt mivs t)s2umum no0aexnif3iltfaDrl(vsn(0aleoio3iadlat au sls)t2xrir io4altn ivta( aDtrurpou0apto ietydlaDuln p;u0arenmocootlmDrli i;()trum(r3oo1lpe lfct s sDrmxmoot0alxoio3iadfs2ra(mo;() eeomf3oytlatraiesl() rtm(m oy1optnlfvtltfarrmu  ;u0tleo icils aDelums () exnxf3tadfp  luvo;(0trtoxr3iy1lm emnvsa()sDtmurpnu4opx  f3iydlaDulumont0alxoxocoy1op rlnvi;t0 etr(r3nu1om emfvsat) Duax ono4tpxnifeiadla2eanvs t)alxrmo tytlaDr ies;t0teurimpiy1lme lnvsa(  2ta( oou0oleoii3tyt aDrauvp t)texnir oy1la  anvo s) 2xoimpoo1llen ivsa( s2tm(  ot4oltnioctatlm2um( p u4 leoxocia1omtr ueslt sexo(rpou1olt mfvia() rraumpot1oeenioeiydla rauvs u4 lxrmr totomteluvs;s)t2xrxm3nu1olt mfet s aDtmurpou1texo i3tlt s2elump;t0tlerxr oodfaDelueo;t sexoio3no1lmtelictls  rumur nu4oeeomieiyslm rl(vs u4aeerio3totlm  anvs t) eur(rpnodlltnmietls  2ua(ro;o1teenmoeiysla2rl( pn(4tlenmr ia1lpDrli s;( srtmxr ou1amtnmnct ()sDra(  ;t0oet if3iaslaDrmnvon(0aetoxfcoytop r i o s0 eum(mpny4lltelietat  Drm( ooo4tlxoiietytfa2elnmpn()aexnxr ty1fpDrlneol( s2tr(o ou1ame mnes (fsrrmuro;o0tptn f3iadfa2rmu p (0tltrmoctadfmt aneo;()s2xmio3nodal n icilsf 2uaxmono1olxomoeild s2rlums ()artrir3oa1lmtrau s t)trxm(r3iudamenmfcsl(fsrta(r nt0optnifeiyt aDrmu p;(4arenmrcootoaDr nes t trtm(rpiy1olt mneils  rum(roou0alenmf3iyslm2eanmpnt4 etoir oatoaDrlivs;t  2ur(opiy1lltemfesa(fs2uaum ;o0aetniieiydla2rl(vpn(4trxnir oy1lp rlivo;t) 2um(rpnodalen icsa(f rumuroot4opxnmietyd a rluvs t)teeomf3iadlmD anvo;( trxrir oo1llte nvta( srta(rp;u4aex  ociytlsDumuvp;u0aeermf iatfmDr ivo;s0s2to(r oy4opee ncsa(f rtaxrp;o1altnifeiat a2ea(vsnu4 rerioctodom  lieo;s0 euo(rpiy4alenmneiatfsrta( ont0opx ifciat m2rluvpn() exoir iatlateau s;t0t2xm(o ny1opeelfcsatfa2rau p;t0tpt  f3tytlm em(mp u) renmo3io1oaDrlnvs ()s2urimpnu1openmfvslt)sDtrxmpnt0altnioeiadlm2el(vs u)tlxoiocoo1oa rlues ()srxriopnudamee ncs ()sDrmxroot4tlen ieiltls eauvsnt) lerif3todoatrai o (0srumxr io4ome mfctlt)s2rru ont0tlxnmieiad s ua(ms;(4tlxnif3iadla  anvs;s t2uoxopno1optnlfvils) 2taumo;o1aptnmictltlaDem( s ()tltnxo iodlpDeaivi s0seumxr ny1om n ies sfartmurpnu0alto i3ildfs2rl(monu) etoiociotop  auvs (  euoxo oudolt mivtl(faDtax ono1teenifeiyd s eauvonu4texrifcto1fa rlivi;t)trumxmpio4omtnmicil(farrrxmooo0aptnioeiltla2ra( o u0tltrif ootfp ran i s0 exmim nu4am   icsl( srrmxront0oeeniieiltfs2ean s;(0aetoif oytfm e u ilt setrxmpoydopeelnvtl(f rrmum no0tle mfeiyt s2rm(vs u)texnmfcta1faDeln i t s2um(r nodlleemnvilsfa2rrurp;o0aetoifctysla2eau s;u0aetnio tadfaDrlivi s0srxoxm io4omt  nesat  rtaurpot0tptnmoeiytfm eln pnt)trtriocoy1la elu slt0s2xo(m no4opeelncsls  Dumur ou1opto o3ildla2ul( s u0 rxrio3ia1opDrlneils0 rurxmpio4ap  lfvt sf rtr(rooo0alt ii3tad m ulu on(0 reomo3iy1omDelu o s) rtrxr nodlmtnlieta()s2uaxmono0optnii3iyt m rmumo u0 rtomfcoodfaD ln ol(  2tr(r ou1op n net t)aDuau  no0oltoioeiydfaDulnvo;(0trtoir iadoatr uvol() eto(r oo1aptnmfetat) Duaxrpot0tleoii3iat s elu s u) exomf3ta1lmD ln o ()s2uoxr3iu1ol elfci ( srraxrpot0alx mo3iytfm2rauvpnu4tleoiociodlpDrlnes t0 exmio3iudopenmfeiltfs2rru pno4opx  ictat m ea( pnu)trenxo tadfaD an s s  rurir3iydlp  lnvs tfsrtmxr ou0texo iciydlmDulu pnt4altrmrcty1oa   n sls)texm(m iudoltemicils)aDtaumpnu4oltomociadfm emnmo;t) exoir iodfp  lneol( srumxo iy1amenlfcia() rua(moot4tetoiocils m uln s (4 lxrmr tydoat livslt)srtr(m io1opt lfvs () rrmuronu1opxnmoetytfsDemn s;(0artrxfcty1fp eaivilt0 eumir3nodamtnmfvs s) rrmurp;o0olt  ictld a ea(vp (0teeomfcoa1lpDrai ol()tetmirpnudol e feia( aDumxrp;t1tpx if3iadlaDuanmo u4teeoir iotfa rli i;s) etm(r3ou1omtelfciat sDraump;t0oee mfctldlsDeln sn() lenmf todlaDeanei t0sexo(r ny4aptnlfcs sfarumxro;u0oetoifetlsls ulums;u4aeenir3ta1fpte ueo t  rumir3iy4olenlfcsa(fa2ta(m ou0teto ieiyt mDrl( s;(0tltrif3todoa eauvi;s)t2tmxr nudol nlnesl()arrrxrpou0olt mo3tyslsDumumpnt0 lenio3oa1lat  ues;s) rxm(rpoy1lmee fvs t)aDtmx ono1aeeo fcild sDra( pnu0 lxomf3ootla eluvslt s2toim3oy1lltn fctas)sDrru oot0tleomi3ildfs2ulnmp (0aetnxo3iadomD  u o;t)trxmxm3iydope lfct t  Dtm(rpnt1tleomiciyt s2um( p ()tlenxrcty1lmte iei;( trxmxm iy4olt lfeiltfsDtr(mo;u0openifctltfaDumu o ()aleoxr3oa1lpD  ues s0 2uo(r3oydol emfvsl( srrmxrp;o0tleniiciysfa umnvo;u) lxoxoctatlm  aueol(0srtrxmpno4apeemneslt  Dtm(mpnu1oee mo3iyt aDeln p;(4tetomr oa1fat  ivi;(0srxm(m iodolt  fvsl(f Drru pot4oetoiociasls uau p;u) rxrxo oodfmt  ues (0s2tm(m3nudom nmieil()srrr(r no0optomfeiatfmDeluvo u0artomo oo1opDe uvs;(0trxrio iy1alt mfcilsfa2taurp;t4oeeoiociyslm2um(mp;(4trtoio3oydop eaneo ()trxr(o3nudlm n nct s) 2uaumpoo1tlen feiyd s2uauvp (4tleoxf3ta1fp raneo;t0t2umxm3oydlle mnctl(fsDrmum no4tex mieiat aDum( onu0aleomf3oadlpD aivo ()setmxmpnu4am elfvta(  Dur(r no1tlt  o3ias s2eaumo;t0 leoir3tadomDeaivi s s2uo(mpio4am n nct t sDumxm no4oeeoifetls s ra(mp t0alerif3iadfptean ilt0srtrim3oo1ap   nvsat) 2ururpnu1aptniieiasfa2ea( s;u) rtoxr iodfm raiei ( s2toio3oy1amenlfctlt aruaxrooo1aet mf3ildlsDuan p t) etnxfctadfp ranvolt sexrxr3iy4ap e ivils) rtmxmpno4tltnmoetys sDran onu0artnif tatlmt an il(  rxr(m3nu4lme mfcsas  2rmxmpnu0opt io3ilt a2emu o;u4texnxo3tadlm r u olt)t2tmiopoo4am n neiatfsrtmumo;t1oeeo fetlt sDulnms u4altomo3ta1lmDr neo;t srxo(m3oy4lpe livs sf Duru ooo4texo ictysfa uauvp;t0 rxnxf tytlaDraieolt trum(r iudolee net tfa2trxro;t1tleoio3tatla eanvp () leoxr iadlpDeaueolt)srtoxopiu4ll   fciat  rtrurp;o1oee mieiytla ea( p;u4treoxrcto1fm e neslt tetoirpoo4om emfvsatfa2trx  nu1aeeo feiys s2uan on(4 rxnxr iotlpt ai sls)srtmir3no1am e fctl()artaur nt0aexomoeiyt m2ulnvon()alxnmo3oadop  lu o;s0t2uoirpiydalenmieia()s2rmu o;u4aeeomfeiaslaDrm(vpnu0 rtnmo3oadoa eln ils)teum(o oydlpte fet sfsDrmxmp;u0tetnmf3iys m emn s t)alenxo to1fm r nvols teuo(o3oydomt mietl( s2trxrpoo4aeeomietltls emnmsn()tlenir to1lp elnvi;t0sexoio3iy4lp n ies t)s2tm(  ;u1apxnifetys s2eau snu0 lxoxocootfat luvol(0 etr(mpnu4optn fcslt)aDua(mo;u0apt ioctyt aDrmump t) exnxf oytfa e ues s)s2xoxr oo4lm elfvsas)s2um( pnt0alx ii3tltfaDrmn pnu0alerxfciotomD lneo;(0 ruoio oy1am elics s  Dtmxrpnu4olt iictls m rmnmpnt)tltnmociy1fateanvs;s0trxrxo iydol e feiat s2rrx  nu4tltn fciadlm umn pnu)aetoxr to1lm  aivo t0seuo(rpoudop   fcsat aDrrxm nt1aeeoifctlt sDeanmsn(0tlxoio iatfaDr nvo;s  2uoxr no4oltemfvt s)aDrm( pot4openifeiat s2ra( o u4tltnmfcoy1omte iesls trxoimpoudal elictls s2rrxro;u0opxomociasla2em( o u)artnxr iydopDrln i;( seum(r3oydlpeelnesls) Duax o;u0aleoii3tlslm2rmn pn(0 renif3iydomtrluvo t0 ruo(m nu1om nlncsas)sDurxmpnu1aexn o3taslm2eanvs;t)aeeomf3tatlate u o (0s2uoim3ou1olenlivilt) Dtmumoot0oltnmoeiadfm2el( p (0 lxnif3tytom   u sls)texmxrpny4llt mfcs s s2urxr ;o1aetoiieiadfs rmuvs u)arxrifcoadlpDr i sls  eum(mpnu4lpen ieia()aDur(m ;t0aptoif3iyd a2um(vo;t0artoircoadfp eaneol( t2xmxrpiudlmtnlfesasfaDta(mo;t1openioeildfa2rmums;u)artoio tadoat  ueilt)s2toxrpiydopeeliesltf Dua(mo;u4altn f3tysls2um(mpnt0 lxoxf3oytlptelivo;( sexmimpoy1ll n fcta(fsDtmxm ou0optoii3tat s uau o;t0 eerxfcoo1om rlu sls0setoxo iydam   nvs s)a2rrxrono1opx mfeiatls2em(vsn()aetrio3io1fpte ueo;(0srurxopnu1omeelfeias s2umurpot4tlen o3iatfa2uanvpnt4aexomf3iytlpteli ols0seurxopno1om e fvtl(fartau p;t0optnmfeils mDumums t)tetnif3ootlptranvolt)trtoio no1ape lnvtlsfsrrmur ou1tpenifeiaslsDrlu pn()aexoxr iodlm eanvo t srtoxo nydapt mfetas) rrrur ot1aexn oeiytla umnvsnt4altoir oa1opteaivs ()s2xrxmpnydam nmfvil( srra(mono1tpenifctadfs2eluvo (0 lxoxrcoydfatrlu ilt)trxm(mpiu1apen ivta( sDtrumono4ole mo3tytlm uauvs;u4aetrmfcoodlmt an ols0s2xriopiodal  mict t sDtmum ot1ole ii3tytlsDemnvpnt4 eerircoydlmte nvo (0teur(o3nodllenmies tfs2rmxrp;o1aee ifeilt s2ua(mo;u4 rtoir tydopDr uvilt  eurir3nydlmtnmfvi (  Duax p;u0aptnii3iydlsDrm(von(0 ltrif oa1opDean s s sexmxmpoy4op e netls)sDrr( o;u0olxo f3iyt sDra(vs u4trtnirctytlpteai sl(  etm(r no1ll nmivils)a2raumoot0tlxoifctadlm eanvon()arxrio3ta1opDe nvo ()tetrir3oo4apeelnvt tfs2ra( oou4tptniietasla eanvsn()treoxfctatlm e neil(0 2uoxr3iodlptemfes t srtmxm ;t0altnmicild mDua(mo;(0alenircio1faD  i s;t)setm(o3nu1op emfvias)s2tr(m oo1apt  octysfaDul(ms;u) lerifctadom rauei;t0s2xrxm3oo1ape lncsa()s2umu  ;t4oetomfeiys mDrm(vp (4 rxoifcoa1omtrau ol(0 ruoio iy1ap emictls s2umumpnt1aleoioetydfmDelums (0tlxrmrciydoa rlnvi;s)t2urio3iu1lmen ncs s)srrrxmonu0opx ifctltfs emn ont4 rxrmfciy1fmtraies (0t2uoim3no1lm elfet () Dtax ont0altoiictldfm2ul(vp;t0 rxnir3oydopDe uei;( trxr(o ny4ope mfeil(f rta(rp;t1apxoii3iatfm rln sn(4alermrcootoaD an i s)s2xmimpoo1amt lnvslsfaruaxmpou4aee moeiatla2rl(mont4 exrxfctatfate neils teumxopiy1lmtelfei tfaDrr(roou0optnmfciys a raumpnt)tetrirctodla e nvi t) exo(r3nu4amte iciasfa2trxmono1aeeo iciytlsDranmo u4tlxoif3tatoaD au il(  etrxm3oo1opt mnvi (f rraxront1opxo fetltfsDrlnmonu)altrmoctytlmDe uvo s0srxm(r3iu4op  mnetlt aDuaurpou4oltoiociyd aDuauvo (4treoir3iy1omt  neolt srtoirpnydlmen fet tfs2raxronu1tpxomfctad a uan p;u4artrif3iodoa r n i;s0 2xm(mpoy1optnmici t arrmu p;o0apt mf3tydfsDrln o t4aleomo3ootlptrauesls  2xoio3iudlp  mivta(  2trxrp;t1aex mi3iaslm el( s;u)aetnmo3todfptr neolt)tetr(r oodomee fcs (  Dtmum ;u1oeeomi3tad a rl(vs;() exomr3oydfp e ues t)seurimpiodllenmivilt) rrru o;t4oexomieildla2ul(msn(4alenmf ty1lp  anvo;t  2xrxo3oo1op nmfviltf 2ta(rp;t0apxomoeiytfs2rmu snt) eenir3iadfat lnei t s2toir nodame mnesl(f Dtmx  oo1tlto i3iat s eau p (0trermr3io1opDrai s;s0t2urxrpnudol emfeias  ruaxmpot4tee mfetaslsDrln p;(0tetomf3iadoa rai sl(  eurir3iu4amt mncsl(fa2tmxm nu1opx  fciyd a2raump t0aleoxr oa1om   nei t)srtm(rpiudap   fvt (fsrum(  nu0oee io3iltlm2rmnmsnu4treoxo oa1fatr i olt trurim3no1op  lnvsa( aruaurpno4olt ifcildlmDum(mp;(0trxrircootlaD luvs s texmxm3iy1lmeemivtlt aDtm(r ot1olenmfciydla umump (0trenxr3iy1laDeaies s)s2urxo3iudol emfvsatf rrrx p;o4aetnmoctyslmDel( s;()altoif iytla r nes t  ruoxm3nydlmtelfei sf 2uaumpno0open oetlt aDrmu p u) lxrmr oatfm r nesl( trtmio oo4lptnmfvil(fsrrmu ono1tee mo3tlt mDuluvs;u0aexrxr3io1opD livil()srtm(m3oudomt mici tfs2tmxroou4tltn ociytfa ean pn(0 eenxf to1opDrlieo;t)trxmir iudop nlfetlt)s2tm(r ;u1apto o3iytlaDelump u)tltrir oydlmDr neil( t2ur(mpno1lpe lnetlt)arrau  nt1tle mieiysfa2ra(vs ()arxoxociotom   ieo s)srtrio3nu1ol  lfctat) 2ta(r oo0tptomoetlslm ra(mon()artnmr iodop rli o;t  rxmim nydapenmfei (fs2tmxmo;u4oeeo o3tltfs emuvo (4 exoxr oo1oaDelivolt)t2xoxo oydalt mfcils) Drrx oot0open ocilt sDrmnvo;u4 exomf ty1lm rlu s;( teuoim oodoltemneia(fs2rrur nu4opx  octlt mDea(mpnu0 ltoirciydlmtr ueo;s) 2xm(r iodam emicil()sDraxrpoo4texniiciysfa2uanvo;(4arenxr ia1lat luvo;s0 exoiopiy4lm n iciat sDtm(m nu1tpt mo3taslaDul(ms u4aetrmf ootoaDr ieo t0trxo(mpiy4aptelivs s)s2raumooo1tpxn oeiydls2ra( snt)tlxriocto1lpt auvs ()sexrxopio4olenmiet t)arra(roou4texnmoctysfm eaumsnu)alxomf oodfa  ln sl( teuoio ny4ll elnvtasfs2rr(  nt0tetoif3iysfa rlnvont4aetrmocoodlaDeaivi (0trxoir ou4omenlnvil( a2urumpou1alen i3tad sDumums;t4 rxnxo3iy1oaDeau i;s tetr(o3nu4lptemivslsfs2rau oou1aex  f3ildfm ul(vsn()arenmr3oatfaD aivol() 2trxm3iudopenlnvsls)arrrump;o0oet mf3iadfa emu snt0trxrmocoodlmDeln s;t) 2xr(o nu4op emfeilsfartr(mo;t1teeniieilsfa2um(vp;t0 rxnmo to1opt aieo;(0teumimpno4omtn ictltf Drrum ou1alxoifeiatls2rl(ms;t)arxrxr tytoptr ies;s0sexoxo io1omt  iet s  2um( p;u4oeenioctyd m rl(mo u0altnmr3tytop r nvs ()sexrxr iydomtemivtl( srur(r ;o0tlx moeiadfs ul(ms (0aexrxr3oatlp rai s t seuoio3nu4om emnvi ()aDraurpou0texomoeildlaDea( p;t4treomo ty1opte i i;() rumio3oy4omtnmieslsfs2rrurp;o0tlxo i3iadls2ulnms;()tetrmfcto1fmDe nes;(0t2urimpoo4opee feias)a2ra( o;t4tpxn f3tldfs2umu o;(0aleoif3iodfmt livslt  2xm(r oodomtnmivi t srurx  ot0opxnmociatlsDra(vsnt) eenxr3tydlm rlues;t0 exoir io1openlivi ()srurumo;o1aetnioctyd a emumsnt0aexrif3tydfaD  u s;s  2xr(mpoy4altnlivtas)sDraum ;t0tpt  fciyt s2eauvonu) reoxrcoydop rauvs s0s2to(r oy1lm elietas a2raxmont1opto feiad m rmnms;(0 etnxo3iodfm  auvs s) etrim3oodam   fct sf rtr(mp;t1alxoiictldfmDrl( s;t0 eerifctytfmD  i o t seurio io1lme  neiat)sDrrxr oo4aexn ietasfa2uln o (0 lenxf3oadfa e u o;t)srtm(m oodoptnlfet sfsrumxm ;o1texo fciytfs eanvo u4 lerif3iytfp rlivilt)sruoirpoodlltemietl(f rrau pot0tetn fetydlmDulnms u0 rxomocoodlp r iei;( srur(r3ou1omt mictlt sDrrurpoo4tltnmoctyslm2rau s;u)arermr3iy1opD  nvols0 exr(r io4amtnmivil(  2raumpnt0apt mictatlm emu o u)trtnmo oadfp rliei t  2xmimpny1lleemfciat a2um(rpnu0tet mi3iyd aDra( p;t0aleoxocoa1oaDeln ols)seuo(m iu1ale  icsls artax pou4tlt moctldlaDuanmp u4trerifctytlmDe i slt) rxo(mpnu4olenlfvt tf Dur(mo;o0aeenii3ildfm2umn s u) reoif tydlm raivo s  eurxrpnu1ape mfetls srrm( o;t4tetnmoeildla2eluvs u) exoir3iotoa raneolt)srxrxm ny1lme mnet (fartruro;u0tlx io3tldfa2elu ont0arxrio3tatomtrluvol() 2xoirpno4altemnesl()aDtru  ;o0tlxn fetatfsDraums;u0 lxnmf to1fm   ies s  rtoirpnudlptnlfvia()a2ururonu0ale  f3tasfm2ranvont4alxrmf ia1fat lu ol(0tetrir3oodlpeemnci s) rta(mpnu1tpxo ieiltlm eaump t4 leomr3oatlmDe uvil(0s2xmimpiu1open nci sfa2um( p;t0apxo o3iadla2uln s;t0teerir iy1oat au il( srxrxmpny4ol e fcsa() 2tru p;o1oee  icils s2umumonu) lxrircta1fm e i s t)t2uoxmpoodalenlfesa(f 2ra(m ;o4aex  ieils m2ran p u0trenio3ia1oa  au sls0s2umim oo1altnmiei (  Durx pot1tet ifciydfa el(mpnu)trtomf3todfaD  ueo t0seuoimpoy4ale mncias)aDrmumo;t1apx ii3tls m2rmn p (4texnmo3oa1faDr ueslt  euoxm3iu4omt  ivi () 2urum ;t0alx  ociyd s ran p;(4alerxociotlatrluvs t)srxo(r iodom n nei (faDrauronu0optnmfeiyt a rlu ont4 rtrmfcoadlaD  ieols srto(m3iydope miesl(faDrru  ;t0oet iiciasfmDrm(mp;u0 ltoxr3oatomt aueol(0seumim iy1lmtnmivsltfa2rmurpot1alto feiltfm rln s ()tetniocoadfp   nes;(  2uoxo3ou1omeelncslsfs2ta(rp;o1oex ii3iltfa2raumo;t4tlerxr ia1lm   i o s truoxmpiudllenlnetlt) 2um(m ot4teeomictlsfs2rmumo;t)trtnmf tatopt livo ()t2xmirpiudap e ivtlsfaDrr( p;t0apeo iciasfsDua(mp;(0aeenmr totfatr ueo;t srurio nu4omen fcsa(fs2rr(moot4olt iieiytfs2rm(vs;t4tlermf3todfpDr nvo t)trtoxr3oo4ol e ivia( a2trx  ;t0ape mfeiaslm umnvont)altrirctydopD  ueo t0trurxo3ou1oleelivt tfsrrmxrpou0olxo oetyd aDum( s (4alxoxf totlmDrlnes;() 2xoir iy4amtemfciat srtrxm nu4tlen ietltfaDuanms;t0treoxo3tydom elues s)tetm(o iy1am   ncsl( srtr(r ;u0opxoiocildlmDrau pnu)tlxnmo3ta1lm  livilt0tetrio nu1omtn fvs s artaxrp;t4oetoio3iad mDra( s t4 renmocoa1faD an sls trurir iu4lmt liet ( artau  no1olt ii3iyslm2uanvp;(0 rxrmfcta1lpDeluvo t0setmim no4lm  mivil(fsrrau  oo0ape mfeiyslsDemnmo t0trtoxr io1lpD lneo ( t2xr(m3nydamtelncslsfa2rruronu0tee mo3iydfm ul(vs;t0 exomo oa1faDe u sls s2xmiopoo4apee icsls sDuaumo;t4olx mf3tatfaDuan s t4 rtnxo ia1lm  ln s t0srumxopny1alen ies (fsrrax  ou4oexomo3tat mDra( p;u4arermfcoatop  aueo;s0texmir3iydoptnlfvt t  2rrxrpno1tpxomi3iyd m uln pn(4trxoxfciodfp rlieslt)s2uoxr oo4omt lfetl()a2umumpot0tle ifeild a ra(mp;(0 ltnxo tatlm rln s;s)teumxopiydale mivtl(faDur(r ;o4aptnmfciydfsDumumsn(0 lerifctytomt  uei s)s2xmio ou4amen ict t)s2taxm ot1aptniietys m2umnmp;u)artnxf iatlpDeaueolt)s2xm(m3iudlp n nvslt)sDrru  ou4tee ioctltls2eanmo (0 lxrmrcootfaD  i sl(0sruo(m3nydaltnlicsat)arraump;o1opxomi3ildfa ranvon() leriociadlateluvs;s) ruoxo3io1lm  livi tfsrrmurpot4ape mociasfsDeanvs;(4 reomocto1lmDran ols0 eto(opoy4omtnlfetasf rtr(mpnu0aleoiociyt sDranvsnt4aexnir3ty1fat ai ol(0sexr(o3no1lmt mfcsa( a2tr(rpno4aee mf3iltfa ua(mp (0 reoir3iydoaDraivi t0teuoirpiy1lpe mfeslt s2tau  nt1alxoiieiltfs2rmnmo u0tlenmf3iy1laDr uvs;() 2xm(mpou4llt lnesls  Durxmp;o4olx mf3iytfm ea( s;t0 lermr3oydfmteln ilt)t2uoxo nydaltnmnctltf rtm( ont1tetnioeilsfmDrlu snt)texrmr3iy1fmteaieo;t0setm(mpoy1ole  fcs tf rrrxro;t1oleomo3tydla2eauvo t0tetnmo3oydlpDran i s0t2tm(o3io1om emfctlsfsDrm( pot0tex  feilt s2rm( snt)tleoxfcoy1optrli il( trxrxr3oodole miesasf rtaxro;t1oex  oetydfs2eanvo;t0tltnxr io1fpD  n o;(0texr(opnu1ol e feilt  2rrx  ot1tptniietysla emnvo u) lxoif ty1omDelivils0setoimpoy4amt lfci t) Drm(rono0alen i3ilsfm2rmnvpn(4aleoif tatlmtrli i;t s2xoimpou1optnlnvslsf 2ra(m nt4olx ioeildlm2emuvo (4tltrif iydlm r uvo;()trtrxopoydap  lfvil()s2urxmpoo1aet io3iyslmDrlnvp;t4aexrmf3oy1lp eanvi t0 etr(opoudaptemfcs () rururo;o1texo fciysls rluvs () rtrmfcto1lp r ues t0sexrir3nydllt mietlsfaDtrxro;u1tpen iciaslmDeluvp;t4tlxnif3oo1oa eln s;t)t2xoxrpnydolt lnet sfs2trumpno4apxnifcias aDel(mo u)trxrir3tadfpt lnvsl( s2ur(m iodolt lnvtls s2umur ;o4oeenmi3tytfa em(vp;u4 rtoxrcty1lmD livs;t s2trxm3oudoleemfct t  Duaxr nt0tpeomo3ilsfs2rl(vo;u0texrxf3to1opte ivo t sexmio3ou1altemfvtatfaDur(ro;o4olx iocilt m rln o;t)aeeoxf oy1fm eaueil()t2xrxopio1ap  liesltfarur( oot4oetomo3tyt m emn sn() etoxr to1omDeauvi;()s2xrxopoudole licilsfarrrxrpno1alx ioeiydfsDrmnmo;u) leriocta1oaDeau o;s0 2umim io
\ No newline at end of file
@@ -0,0 +1 @@
+ivi s  2xmxm3oo4ole livta()s2uaxro;o0ale  o3iltfaDrmn on()alerif3io1lmDeauvs ()sruoio3ou1openlnetasf rra(r nu4alxomocilslm eanmo (4 ltomf3oatlaDelivilt  2xmirpiu4lmenmfvtls a2rm( p;o4olxomocilsfa em( o;() lxoxocoodoptrau o s)s2toim3no1lpt  feia(  Dumumoou4aetomo3tls s umnms;(0tleoifciatfaD  u ol() exrxrpnu4op  mivt tfs2raxro;o1tptn f3iydfs2eanmsn(0 ltnmrcoodoa rau s s sexmio iy4al nmivias) rrmuroou4opxo ieiydls2uau s t4alerir iytfat lieils srtrxmpnydome lnct t)aDtm( o;t1tet ioeiysfs2elnvp t)tlerioctydomtraivs s texoir3iu4ll nmicil()arua(ro;o4olen fciaslmDrm(ms;t4 eenif to1lpDe u s;t0 rtoim nodamtelfcia()srrmum ;t1tptoio3ilsfaDumn on()trtoxr tatlp rluvi t  2trim3ou1lm nlict sfa2taxmo;o4alen octltfmDran o (0trtnmf io1oaDranei;(0 etoir3nodlme  fci tf rrrxmoot1aeeoioetasfa2rluvo (0 ltnmr3ta1lp ranes (0 eum(rpny4ol n ies sfaDuru pot1alxoiieiys s2ul(mo t0alenmrctatlmtean o t)seurim no1altelnvs () rumu  nt4tpt  fctld a rmu s u)arxnif3iydfpD ai o;t)tetoxm3iydlmt  nvtls  2uax  ;u4oex mo3iadfa el(mo;u)arxoiocia1lp raueo;t)seuo(rpoudlmtemneias)srumx ont0texoifeiad s2rm(msnt0 etnircoytoaDe nes;(  rtoxr3oydape miet tfarrm(  ;t4aleomo3ias s em(vs;u0tetrmr totlpt aues;t tetmxo nodapee ncsas  Dtaxmpno1aexomfetadlmDuauvp;t)trtoxo3oy1lmtelues s0srxm(r ny4lp n icsatf Dua(mp;o1alen ieias m2rmuvonu4 exnmf3iotop rai ilt teumxopiy1ap n nvsas artaum nt0texo ieiatla2ra(msnu0tlxomocoo1lm eluvs;(  2trxo ou1ol emnvil( s2umxmoot0olxnmoeildla elu on(0teenmr iotfpD aieilt0srxrimpny4aleemnctat  rurx o;u4alenio3iys s2uauvs u) rxrmr3ty1lm elivi s srumxopou1lmeemict tf rurump;t4apeo fctydlm2el(vo;t0texrmf3oadlp e u s ( srtoim iydalee fcsasfsrrmxroot0tltniociat m2uanms;u4trxnxrcio1oate u o;(  2uoim no1amtnmfcs tfa2rr(rpnu4tlx mfciydls ran pnt4aetnmf oodoaDe nvsl() etoir3nydam elnet s)artaxrpot0apenifeiyt mDuln s;()texnxo iatom eauesls) 2urxrpny1apee fct s srtru  ot4tltoiictlt aDemnvo (0 rtomr3oo1late i ols) 2umxmpny4omenlnetltf 2ta(r ;u1oltnmiciydlm2ea( p ()texnmfcty1fptr uvs;(0truoim3io1lpe lfeilt)s2ra(roou0aexo octad sDuanmpn(4trenifciotlpDelnvs;t t2urxm3io1ole lfesatf 2rauro;o1teeomfcild mDum( s;u0 rtnifcta1oatranvo;t  2uoiopnu4op nlivs (f ruaxrpoo0oleo ociyd mDuan p;t4teeoio3tytlpteaieo;(  rumimpny4lm nlivs ( aDrm(root0tpxoifeild a2el( ont)aeeoir3iydfat an s s0tetm(opoy4ll nlnvi tfarrru pnt0altnio3tydfm2emnvpnt0 lxnir3oydlatrlieo t trtoio oo4llt  fcs ( a2rmx  oo4apxnii3iltla rl( p t4 rxrxo io1lpte nvil(  rxrio iodol   ivt tfaDtr(mo;t1aetnifctyd sDumumo t) lxnir oo1fat li s;(0s2xmio io4lm n nci (  Dtmx  oo1oet  f3iys aDra(mo;u4tltrir tadfa e u ilt0seuoxr iu1lpen nci ( sDrmxmo;o4oet mictls m2ranms u4aexrmo3oy1lmteliesl(0 rtr(opiu4ll elfetasfaruaur oo0oex  ietyd s2eau o;() exnxf3tadfmte ues;s s2xoxr3oydlm nmiviltf Duau pnt0oexnmicildfsDuanvs;()texomr3oy1fmDelnvo (0 2urim3oodlptemicsltfsDuaxrpot1texoio3tysfs rmn sn(0arxnxrctatfmD  ueo;t) 2umirpou4oleemncslsfa2rr(mp;u0oetnmf3tldfaDum( s;u4 etoir3iydfatrlueolt0s2uoxopny4amee ivil( sDrrxm no0aetnmfeiysfs2uanvs;()trxnmrciydfpDe nvsls)setrxopiodlltemnesasfarum( ont0opxnmoetas s eau pnt0arxnxf oydopteaieilt0s2uoimpoo4aptnlicsl( sDta(mooo0tpen f3ias mDumums (0trenif3iydfa  lnes;() rtrxmpio4lleemfvtas sDuaurooo0aleomociad a ean pnu4 rxrxociadomtr ieolt trtmxo3oy4altemncil(  2tmu pno1aee mictadlm2ea(mpnt0tltnio tytfmDe i sls)trto(mpio1amen ivsasfsDrrx  nt4tpxomi3iysfs uaums (4arxrxr todfmteai ilt t2xoim nudom nlivi s aDtrur nt1opt mieildlm2ea(vp t0alenir ta1latelnvils0seum(r3iodll  lict (  Dtrumoot1apeomf3tldlsDemn o t) ltoxo oytfpteau i s0s2xmxopoo1altnmnvi t)aDrau oot1tltomfetldls umump t4aeeoif iy1fat lnvi (0srxoimpny1omt  ncsl(  2tm(mo;o0alt moctlsla ul( p (0altnmoctodopDeai ilt  exoiopnu1am eliei s sDtrx ont1tet iictls a2rmn s;t4trxomfcty1lm   ueo;t0tetmio ou4optnmnvias  2urur ot0tpeoifctlsfs2rauvp u0tleomrcio1lm e iesl( trtrxr3io1llee fctls  rurx pno4aexnifeiyd sDeau s;u0arxrmr3oa1fpD lieslt texrxm io4ap  mnctasfarrau ono4oltnmoeildfm rl( s;()texrio ootopDrai i;(0setmxopoo1lmeemnes (  2raxmoot1apx ioetlsfaDrmnvp;t0 eeoxocoo1fmD an i;s) euoim3ny4ll elnvi (  rrru pnt0alt io3iat s umuvo t4arxnmocoy1fp  lnvsl(0srumxr3io1lmtelieiasfsDum(mo;o0tee iiciad a2elnvo;t0 lenxr3oatoa  lies s0 rxrir iy1lpt mfvtls)sDtax  oo0tptoio3ilt a rmu pn(0alerioctadfa raiei;s) rxr(o3oy4omeemiesls s2tax o;o1tlt  ictlsla2ean o u4teenio ty1lmDr i sl( srxmxmpno1al e nvi sfsDtm(rpnt4alxniieiyd mDrmuvsn(4artomrctadlptrln slt) 2urim oudaltnmfctlsfa2urx oou4ope ioctydfs2ul( o t)teeomf tatlp  lueslt teuoxrpnu4apee netl( srta( pot0alt iiciasfs2rm( pnt4 exoxr3todla raivolt sexoxopiodal nmfcsl() Drmumoou1ole if3iadlmDumn o t)texrxf3oytlmD luvs s) 2xrxrpoy4lpt mnvt tfs2rau  ;u1altoif3iyt a2ea( p;u0aeeomociotlmtean olt)t2uo(m3io4altnmfvsas  rtrumo;u4opx if3iaslmDeau s (4trxnircty1latelneo (0sexoim oy4ape  iviltfa2urx onu0oeeo o3ildfs rm(mo u4tetriociadfa r i sls0 2tmio no1al emfei tf rumxmpot0tleoii3iat m ra( o t0tltoirctydlat liei t0 rto(rpou4ll emfesa(fsDtax  ;u0altnif3tatlsDel( s;t)tlerxf iy1lpDranvilt0setmxopiy4om  mivilt a2um(mp;u0oltnioeiadlsDeaumo u4 rtrxf todom   u slt0tetoxm3nydlltemivil()aDraurpou0oetoif3iysls rm( o t)tlxoxociydfpDeanei t  etr(mpnydol e ncta()s2ta(m nu1aet ioeild mDulumsnu0 etnif3oy1lm eaueo s srtmim3io1aleelnetlt sruaumo;t4opt  f3iytlmDrlnmon(4 rtomoctydla r u ol()srumxrpoo1lltnmnciat) Draum nt0opxomfctydfmDel(vs u) exnxo oadfa elnvs;(0s2toxm io4lmtnlfvi tf Dra( pnt0aleo ociytfmDrmuvo;(0aetoio tydlpte u i s setoxo3nu1ap emieiatfa2urxmont4aexo ocildlmDelumo () lxoir3oodop rlivs ( texm(o3nu4llt lnctlsfa2ta(r ot4teeoioeildfs ranvpnu0arenmr ta1op elies s)s2umio oydam   nvsl( a2rm(r no0tpx  i3ild m2elnms;() etoxf3ootlatelieols trurirpiudomen feia(farurxrp;o0opxoifeiytls2ea(vo u4altriocoa1fateauvs t)sexrxr nodalt  iet (fs2tr( pno1open ictytlmDea( s ()arenif ta1lmD  n s ()tetm(rpnodaptemivtlt)sDraxrp;u0olxn i3tatfsDeluvo;u)trxnif tytfpt  nei;t srxrxm3iudap  lfetl( arrm(moou0apx io3iltla ulu p;t) eenirciodlateln i s0tetrir3iu4op elfvsl()sDra(roou0aex io3tys a rlnvonu) lxrir to1fmt  nesls0tetrio iu4omtnmnetlt)a2rmuro;o4tltomociyslm2el(mp;u4 ltnif3io1fptrluvsls0 euo(mpoo1aptn ieiltf 2tmur nt4oetnmfctltlaDeanms;(0 lenxr3ootfateai olt s2trio nu1al e neiasf Durx ooo0olxomfeiytfmDra( pnu4tetrifctadoaDrlivo;(0 eum(r iu1alee nviat) 2ta(  ;u4oleo oeiydfmDrau p t0alenmo tytlmteanesl() 2ur(m iy1aleelfvia()s2rru pnu1apx  f3iyd mDel(mpnt0 reoxocoatfp eluesl(0 2xr(opnydll e fcilsf Draxro;t4tpen i3tldfs uanvp t4arenmo3oa1optrln sl() 2trio3ou1lmt  icias)sDrmx pnu4oeenifciysls2el(msnt) eenmrciatfp rauei (0trur(r iu1lleemnvias)a2taurpnt4tpe  f3tat aDum(ms () exoxf3tadfpD ln ol(0 etmim nudol  mfcsls)sDum(m oo0alt ifeilsfaDua(vo;t)aexnmr oo1laDr ivs;t setm(o3no4apt licils) Dua(moou1oltniieiltlsDua(vo;(0arxomrctotfpD  ues s) eto(m ny1ome lncsas aDtax ono4opt io3ilt mDrlnms;(4 ltoio totom  lnvols0 2um(o iu1optemnesat)aDum(mpno0aee iictltlm ean s;t4aexrio iotfa r ivo (0 exm(rpoydamen fvt t) Dtau  ou1aexnmfctytfmDrl(vp;t) lxnio to1oate ues (0s2ur(mpiy1al nmfeias  Dtrum ou1teto feiytlm ra(vp;t)arxnxrciytomteauvils0 rtmiopoo4open fvta(farrr( o;o1optn feiydfm2umuvs t)altnir3iodoptr ieo () eum(r no1lltelfeta() rumu pnt1tltn ieiys mDrlnmo;t4 ltnmocoadlmt lu o ( s2uoxr3oy1lmee ieil()sruaurp;u1open oetld a rmuvs;u4arxrmfcootlp ranes;(  2urxo oy4lltnmfci ( a2umx o;u1oetnmi3iys a2ean p t4 rtoif3iatfaDelu il()srtmxr oo1optnliet ()a2tmxrono1teen i3tld s rl( p (0 ltrmf iydoat au s;s0trum(m3iy4aptelfvilt s2tax pnt0aee moctaslaDea(vs;(4alxrir3iytfmDraiei;(  etoiopiydlmtnmfcsls  ruauronu0tptn ociadls2ulumpnu0teermr3oytfm raivolt) 2uoxopno4ol  mivia(  Duaur no4tptn f3tldls um(mo;t4tleomrctodfat li ols srumxopno1ape mncsls) rumx  ;u4opxo i3tysfmDeau s u0trxnxf3todfmte nvilt0texrio3ny4ap e nvia(fsDtm(  nu4oleomfcilt sDemnvpnt)aleoio3ta1la eaieo;(0teuo(r oy1omee ivias)s2urxrp;t1aex mo3iasls2el( p;u4areomr oodomD li o (  2xoxm3oy4lp  lnesl( s2rrx ooo4opeoioctytfs2rm(vp;u4aeermr3oytfmtrluvs;()srtr(r no4omtn ncsa(fsrraxrpno4tpt mieiat s2ua(mp;(4tlenio iydfm rliei;(0 etmim3ny4llt mncilsfartax o;o1alt  ocils m2rauvpn(4 rerir oytoptr u o t) 2xrxo3ny1op nmfvilt)aDurxr ;o4tptomictldfsDrm( s;t4altrirctatlp elnvsls0s2ur(m3iydal  liet t) 2ua( pot4tlxnmociaslm2eanvo t4tltomo ta1fpt lies (0 rxrim iy1ll emfcils a2uaumooo1teen feilt a2umn o;u4arermf3ootomtrlnvol(0srum(m ny1openlivt () 2ur( oot4tle io3ils s2um(mp ()tltoio3io1fpt aieslt0t2uoxo3oydape  fcias)sDtmur ;t4apeoif3iltfmDrl(mo;(4tlenmf3ty1lpDe n sl()s2umirpnu4om n nvil(f 2umxr ou0tpxn f3tlt s2rlnvon(0aetrmr oo1fpDe ieo s)s2xo(rpoy4om   ivsa()aDrr( pot1olxnmfciyt s uaump (0teermrciatlm  lnei () rtoxopoy4openmfcia(fsDumx  ou1aeeoif3tydls2em(vonu4tltomrciadlaD  i o;t0tetoxmpiy4lleelfcta(f 2tmxr ou0oexoiicilt s eaumpnu0artrxr3ia1lptelnes;t teumiopnu1omtnlictls)artrxmp;t0alxomieilsls2rmn o;u4trenif3oadom rlu i s  rxrimpnydlltnmnciatfaDraumoou0oet ifeiytla2el(vs (0trtoxo iy1lat  nes;()s2uoxmpoy4optnmnvs () 2taum ;u1aeto ieiytfmDra( s;(0 renir iydlm  ai il(0srtm(rpoo4aptnlivt t sDur(mpou0texomf3iysfs2umnmp;(0trtoioctotlp   ues (0sexriopiy1ol  livil(fa2ta(roou1tltomiciadls2rluvo (0 etrif ootfpD  ivils0 etrxmpnu4lmtnmietls)srraum ;o1tpenif3iydfm ra(mp;(0 eerxo oodfpt  uvsl(  eumir iudop nmfeslt)srrrxrp;u1optomoctydlsDemnmo () rxnxo oy1op ran olt trurxm oy1op e fcia()artmxrp;o4tlxnif3tad s ulnmsnt) etnif io1op rluvsl()sruoxo ny4om elicia()arrm(r ;t1tpt mi3tld m eanvp u)tetomr3iy1fmt lu i t t2xm(opio4oltnmnvsas)sDtmumont1oeenii3iasfs uanvo;u0tlxnif3iadfptraueo ()t2uoxopno4optnlnvil(  rtmx oou4tetniictysfm uanmpnu)trxoxr3totoaDrauesls0trxr(mpio1ol elfcs sfsrrr( ooo0texoio3ias sDuan o t4texrircio1fp   nei;t0srtriopnodamtelfcs t s2tmx o;o4oetoio3ild a2rlnvs u) exnmfciatlmt aueo (  2uriopoodaleelivtl() Drrur ;u4oex ifctydlm2em(vp;u0teenio3tydlp ean o;t)seurxm3nu4lpt  fvil(f rrmxr nu4tpt  f3ils s2uanvp u0 etnio tadfmte nvolt)s2to(o3nudom  livi (fs2tm(r ;u0tet  i3ilsfsDrlu s;t4tlerio3iydfptr n s;s)s2toxmpoydal e nvil( artaxr ot4oex mictadlm2rmumo (4altoiociatfpDean s;( texm(rpiu1alen ict sf rraurpnt4optn i3ias a ul(vont4trxnmf3oa1fa elu i;s)t2to(rpny1amen nvta() rurx  ;o1oeeniictyd mDem( o;t4 rtnmo3ia1oat livs;s0seurxrpiy4lpt  fcsat) Dumxmo;o0tleomocias aDeanmp t4 ltrxf oa1laD lueols0 rtoxopiu4om nmies t sDrau pnt4alx  oetlt m rl(mpnu0artomf oydlpDe nes;t)teuoimpnu4al n ivtl( a2rmx o;u4aetomieiydlmDelums;u0arxoxrciotfmt aueolt0 2tmim io1am elneils)srraxrp;o1oltnmiciytlmDuln pnu4artomf3oytfpD lu s (0sexrxmpoo1ol emfvtat a2umxr ou1oex  ieiaslsDulnmo;(4 lxrif iydopD lu s t0s2tmxopnu4ol nlnvtas)srta( ono4opx ioetatfmDean p t4aetniociodla e iei;t0teto(m3ny4apt  nviasfaDur(m ;u1aptn iciyd mDumums u)aeenif iydlaDeli o s0 rtoio3oy4amtnlnet tfartaxm no1texniociltlaDuanvp;t)arenmr iytomD  n i;(  eumirpoudlle mnet () 2trumo;o4opxnifeiydls el(mp;(4aexnxfcta1fmDe nes ( trxrxm nodomeelnvs s aDtrxrooo0ale  f3iadla2ul( o (0trtoxf3iy1la r n i (  rur(o3nudll  lfct t) Dtrurpoo4texoifciadls ra(msn(0alxnxf oa1fpDeln ols) 2tmimpiudlmtnmfeilsfaDrr(  ;t1olx mictadla elnms t4altrmf3oydfptrau o;s teur(o3nodal e fet ()arururoou0apenifctatfaDem(vo;(4tltnmr3iydlp  aneslt) rtmir3ny1ol nmfeslt  rur(mpot0tlto f3ilsla emnvo () rxrircoadlm ean ol( sexrxo nodalen ivs (  Dtau ono0apeo fciysls2rlu ont)aexrmo iodla  au o;t  rxmio nu4lp  lfvilsfsrraxrpnt4tlenifetatls um(ms t4aexnxfcoydlaDe nvi t) euoir3iy1lpte feilt  rum(  ou4tpxnmfeiytfa2rm( s () rerir3to1faD ai o (0 2uoimpoydop   ncsltfsrra( o;t1tet iieiadfa2rlnvo;()alerxr3iydfpteauei;( srxm(o3oo4alenmiei t) 2tmxr ot0tlx  octadfa ea(mo;u0trxrir3oo1fm rlu s;t0 rur(mpiodalen fctas srra(m nu4alto ictldfa2ua(mp u4alxomrciodlp e ueo;s  2um(o nydlp nmnctasfsrua( o;o0ape  f3tydls emumsnt0trtnxo3oo1lmte nvolt) rtrxm iydlmeelneiltfaDrm( o;o0olxo ieiydfa emums;t0trxrxr totfaDeai o;s srurxm nudaptnliesas sDtmurono0ape if3iytfmDel(vs;u4 renxo3oydoatran ol()srxo(m3oo4ome  feiat) rurxrp;t1alen o3iaslm2raump;(0alxrio oy1om  anvo t)trto(r io1lpt lnvia(faDururoot1tpxnioctyt sDul( s t0 rxoir iytomt ai i;s)t2xrxo3iydlltn ieta()a2tax oou1alxo oetyd s2ranvs;(0trxomr tatom eau o () rtm(m iodomt mfei (fa2ta(m ot1alxomo3iytfs2eau s t)tlxoxo iydfptelneslt)trto(o ny4lltnlnvi ( a2rrx  nt4texniociytlaDrmnvont)tltnif iodfpDr ueils0srumir3io1al nmies t  rumur ;u1tlt moeiltfaDulnvsnt0aexnxr iytlpte u slt)tetr(m iudalt  fciasfaDrax  nu0tetn octaslmDua(vo t) reoxoctadom e iei t0texrir oudllt lfcil( s2rrxro;u1ale mi3tatfa rlnvsnt)tltoxocto1faDrluei t0 exrxm3iu4omt lnvi sfa2ra(r nu1optoiicildfa2umn p;u4alxomo iatlm   ivo s0sexo(o nu4lmeemfvtlt) Dtmurpot4tetnifeilt m umnmo u)alenxrcoodfpDeluvo;t0texoir no1ll   ieil( aDtauroou4aeeo fetasfs ea(vs () lerxo iatfmDe n s;s texr(m no1am elfeiatfaDrmur ;u4tpenifeiadls rlu ont0 exoxfcoatomDe ivo;( srtr(m iy4omt mnctat) rrr(mooo0opeomf3tldfaDrm( sn(0trtoxrcio1fptr ivo s0 exo(opiu1olte nvtltf rurur ot0teeoif3iatfaDulu sn(0tltnmfcoa1fm  ln o;t tetrxm3ny4lltelnvtls arrm(r ;o1oexn fetldlsDranvsn(4tetniociydfpt aiesl()tetrxr3oydll nmivil()sDrmxm ;t1tltoifeildla ulnmp u)aexnxo3oydoa eaies s t2ur(o3iu1opee nvtlsf rum(mpoo0oee io3ildls2eln on(4 rtrmrciy1fm   u olt0t2uo(o oo4lp nlnvta() Drm(r ou1olen i3iltls ranmo;u0alxnmfcoo1fmDr ivo ()truoxo3no1al elnvta( aDtr(rpno0oexnifctat mDeau s;()alenircio1oaDrlues ()srxmxmpoy1apenmies s)aDtrumo;u1oltnmoeiysfa2um(mp;(4treoxociy1oa ean o;t setr(o3ou4lp  mfvtl( a2rrx oot0optnmfctat mDeau o;t0aleoxfciodfp raivo t  2xrio3ou4aleelnet s)sDua(m ;o1apxomf3ildfs2eluvo;(0tetnxo tytfateln i s0t2urxr nudom  lnvias arrmu oou4tpen ictlsla el(vs;u0tetomrctodopt  i ilt  2xm(opnu1omee feil() 2rr(m ot0tlto fciyt a2ua(ms;(0tetrir tydomDe i ilt0t2tmim ny1opee fciatfa2rax onu4tpt ifetldla2elums;u4 lxomr3tytfatr uvsl()srxo(mpny1oleelict t s2taur nt0oetomfeiad a2rlnvs;u) rxnio oa1lpD luvs (0srtrxr io1apte fvt t  Dur(mpoo0oetnmoetysfs2ua(vp t) ltoif3iydfaDeli s t0 rur(rpoy1lptnlies sfartm(r ot1opto o3tldls2ra(ms;u4texoxf todfatelu sls0t2uoio3iu1omt mnvsls  2umxr oo4openmieiatlm2eanvp;u4 rtoio3oatlptrlu i;s0t2toxm3oodom  lfetas  2rrx oou1aee ioeildfa rm(vont0texoxo3oadlpD aies t teur(mpnu1amt lfviltfaDrm(m nt0tpeoiiciydfsDua( p () rxomrcoydomD aieo t)s2xoiopiodll n ici (faDraurooo0texo o3ilt sDulnms (4 exrmrcoy1lmteluvi;t0srxm(o3nodol   fvi sf Drr(rpoo1tltomiciadlaDemu s;u)teenmr tydom rau ol()trxmxr3nu1altnmiviatfa2tm(mo;u1tle mf3ilsfa2umump u)tltomo oydlptr uvi;( truoimpoydlpe lfet ( srrmxr ot4alt miciltfs2rl(vo;(0aeenir tadoaD li i ()sexm(opou4altn ivs s  rum(  ou0tlto i3iyt mDumn o;u0 eerioctatfmt  uei;t)sruoxo nudamte icias)sDtr(mp;t0tpto oeiadfm2ra(mpn(4tetoxo3tadom   ueols) rtoiopnodlme  neslt s2raxm ou4ape ii3tatfa ea(mo ()texoxrcta1oa eaues;s) rtriopou1am   iet t)sDrmxmoou0alx  f3tyd a rln snu0 etoxocoy1fa raneo s)truoxo iy1am e iet t  2trx  no4alxnif3iysfm2eanms;(0aeenircoydoateaivsl(0trtoim3io1ap emnvtas)s2tr(rp;u0aptnio3iadfm2elnvp u) ltomrcootla rlu s ( seurxm oodlp  lnvt tfsDtaum nt1apeoii3iltfa2em(vp;u) rxnxo tydfp  livslt) rxmxopiy1apte nvi () rrm(mpnu4oeeomieiadlsDuluvsnu4 ltniociadoaDelivil( sexrim3oo4opte ncta( a2rmx ooo1optnifciltls ulu s (0altnxociadom ranvslt0srtr(o3iu4apt lnctas)a2tmumpnu1tpeomfciat a em(mp t4alermr oytfm  aivolt  exoimpoy1lmtnmnvtlt arra(r ou1opeoiictasfa ul(mon() etrif3iotlaDeaiei;() euo(o oy4lm n nvsatf Dra( pno0teeoif3iat a2uau ont0 leomociotlpDrlnvo;()s2xmimpnudome lnctl() Duax ont4olto o3tytfa2uaumonu0alxrmo3tadlmtrauvo t)trxmxr3nu1lptnmfvt (f rur(ro;u0tleo ociyt m ua( s;(4altomf tadfa  lnei t)trxrim3oo4llt lfctl() Dtmx  oo1aeen fciatls umnms t)alxomr tytlaDrluvil( srtoxrpiu1op emnvi ( sDuax  ot1openmocilsfaDel( o;t0trxomocta1lpD lieolt t2to(o nudopenmncsas)sDraxmo;o1oleomfciyt sDea(mo t4alxriocoytfpDrli ilt setrim oo1apee nctlt  rrrxr oo1openiietatfa eau s (4altomrcoo1omte i o s0tetmxm nu1al  lnciatfsDtmuronu0oetnif3ilt a2ulumpnu)tltnir totfatelnvo s) rxo(o3iy4ole liesls)artm(mpno0tetnmi3iytfmDumu sn(0aetomo tytfpDeai sl()truoirpoy1openmiei (f rurxmpnu4oleomfeilt s ran snt)artoxo iodfpt  nei;s0trxoiopoy4om nlicil(fa2rm( pou4oetn ociasfaDrlump;t)tlxnmocoo1opDrluei ( teum(o ny1amtn nvilt)srtmx  nt4opxomfetaslsDum( o;u)alxnmr to1fpD  uvo;(0 eum(o3oo4omenlfvs sfsDum(rpoo1apxnio3tyd m2el(vs;t)tlxnio iotfpDeaies;( trtoxrpiudom n ncslt)srurx pou4oeenmfciyd mDumnvon() exoir todlpDelueo;t0s2urxm3no4ameemfesls sDtmu  ;t1alen ieiysfs rau o (0tlenxfctytfmDran i;t0teur(r nu4lme mneiasfa2rru poo4olx iictysfm2emu s (0tltomfcoo1faD aivol( trxm(r3oydale lics ()artm(  ou4oltniictasfs eauvs;u4 lenmo totfpDraueil( trtr(o iodamee fct t srrm(rpot1oleo ietltlsDrm( pnu) lerxo3oa1oaDrlu ilt)seurxr3oy1alenliet (fa2tm(roou4aet ii3iyd aDumuvp u)tetnmr iytop e uei;(0 rxoim oodalte nvs s s2tm(moot1tpenmi3iytfaDel( pnt) rtnio3ia1faDe ies;(  eumim3iu1ome  nvtlsf rrax ont1olt iieiydfm2eanvs;()aetomo todop   n i;t0srxmimpiy4omtn feils  Dtrur ;o4tlxn f3tytls2uaumon() ltnio3ia1omD aueils t2tmxr nudame livs (faDta(mono1optomf3ildfm2elnmp;t)trxnxr3iodfa   ueo t0srtrxm3oy4aptemfci sfarrmu oou4alt iociytlsDrauvonu4aeeomf iy1lm   uvslt) 2trimpoo1lpe lnvs () rrm(  nu4aptomi3tadlm2eanmo;t0artnmfciadopD  u slt) eum(o iudlm   fvt tfarrm(mont1aeen o3tldfm rau pnt)alxrmo3iy1om elueo (0srto(m3nydope  iesltf rrrumpou4oeto o3iydfm2um(vont4tlxnircta1omDelnei;( trtoxm3nudlltnmicsl() 2tmxr nt0oexoifcias aDulumpnt0trtnirciadoa e ieol( t2xoir oo1oltnliciltfsrtaxmpot0aetn oeiltfa emn o t)trtnif3iydlpte ueols0 exo(r3nudoptnmnvt (faDrrx o;t0tltniiciasfm ul( s;t0aleoxr3ootom   uvo;t0t2xrir oy4apen nesat  rtmu  no4olxniiciatlsDemn snt0tlerir oo1om  aneo;s  etoim3oo4ll elfci tfsDrax  ;t4altn oeiad s2ua(vp (4 lxrmo oadfa ranvslt0 exm(mpny4apenlivtas)s2rmxmo;u0apxn ictasfs ulnvsn()teenxf totlmt li o;s)seto(m ny1ap nmncs ()srtaumpnu4alxoiociyd aDelump t)trtnmf iadoaDrli s;()sexo(m oy1lltelfesat)srtmump;o0oleomictls m em(vo;(4teenxo tadoatrlu ils texrxr3iy1lp n fcsa( srtax  ot1aleo fctlt m emump u)arxoio3oy1fmtr uvo;t) euoxm3ou4ol  mncilt) 2rr(rpno4altn oetldfa eln s;t4 ltoxo3oa1la e neils  2urim oydalenlncs sfa2urumpnu0oetoiiciatfaDrmums (4 etrxo3ia1opt anvo;s s2tm(o iodaltemicia()aDtru  ;t0tex mietat mDuau o;u0 etnxr oodfptrliei;s) 2uriopnudal n fvtatfarrrxrp;t4tlenii3iyt a ulumo ()aeeoxr3to1faDranvo t srxo(m3oy1lmen nvi sfsrrru  ;t0tex  f3iasfs2rmu pnt0 ltrmrcia1omt aies;( truo(o3oo4lme  nci t) 2ta(rpnt1tpxnmfeiytls emnvp (4texoxf3tytopDrau ol(  2xoimpny1ll e fvsat) Drauronu0tlt mo3tysfsDran o;t4 exrxf oatfm r i s (0trtrxopoy4om nmneta( aDtrxmo;o1aexoioctadla ean o (0aeenmociydfp e nvilt0s2uoir3iodllee ivtas sDururpou4tlenmictlsfs2rmuvont4aexnmr tadfp r ivil(0s2um(o iy4aptnlfcsl( arua(  no4apxnmocildfmDea(vo u)teeoxfctadfmD  nvi;t seuoxmpou4oleemfcilsfsDraxm no4aexnmo3iyt m2uluvpnt4aeeoircto1opD  nvs;t s2urim3nodomt mict t)a2rmx p;o4olxoif3ilsls em(mp t4aleoio oadlp e nvsl() exr(r3io1amtnlncs t  Dum(mp;t4apen octaslsDea( o t)trenxr3iadlpDrluvi;( teto(opnodapenmnetat) Dta(mp;u1olxnifetld sDrmnvo;(4teeoxo to1op e ieolt0 2uo(m nudom nlfetls)a2tr( p;t4alxomfeiys a el( s;u0 ltnmr3iy1omtrliei ( t2umxrpno4lmtn nvia() Dta( pnt0olt  i3iyd a2umnmo t4arenmr tadlmDr nvilt0s2to(r iydope mnetas) 2rmur no1oltnmieilslm ea( pnt)arxrmo tydoptean s;t  2urxm3iy1olen nviat arururpoo1alenmi3ildls2emn pnu)trxoio3ootlptrlnvs;s trumim iudop elivs t)a2tmurpnu4apxomf3iyt a umu p;(4 eerxr3oytop r n s;s  rxrio3no4ame mfct tfa2ur(mo;t1ape ioeiltlm ea( s;(4treomo3iodfm e nvi;s s2tm(mpiydlmt lfesa(fa2um(mpou1opto i3tltlmDrlnmsnu0tetomf3oy1fmD  ueslt0texmio3oodllenlicsl( aDumu  ou1apenifciat a2rm(vs;u)alxoirctotfp r ies s truoim3oo4al nmfeil() Durxm no1texnio3ilsfsDulnvsnu)trerir3tydomD auei;( srtmio3no4ap nlics (f rum(rpnu1apxomfcilsfs rmnvpnu0trtrmf oydlaDr uesls0trumxm iudom   ietasfsDurx  ;u1oexomociyt m2uaumsnt0 lxoio3tytom elies;t s2xoimpny4oleelnvsltfsrrm(mpoo4altnif3iytfs rm( s;u) etrircoadom eai o;t s2xm(rpnodalen nvi ( a2tauro;t1apt iietltlaDemu onu0aetrxo3iodop r ivol( texmxr nu1lp   icslt)a2tru o;u1opxomiciytfm2rlu p;t)aeerir3todopt auvi t) rxrio oo4ap  lietlt)a2urxm nt0tpe if3iydla rlnvo t)tlxnmf3oo1omtrli s t)t2toxr3oo1lme  ivt s s2tm( oou0apenioctltlm rmu sn(0altoxf3oo1fpD aieilt0teto(o iy4lmtn fci s) 2rr(m ;o0tptn o3tasfm eln sn()aetnio ia1op r neolt0 2um(o ou1ol  lfvta(fa2tm(mpot4olxo i3ildfsDemumo (0 reomo3oytfp rluei (0tetmim3nu1amtnmnvta( srta(mono0aexomietldlsDelnmo;t) ltrif3ty1lat li il( trxo(r io4alenmnvsat aDtrx poo0tpe mf3iytla el( pn(4 etnir tadfmte uei;t t2xrxrpoo1alte icsa(farta( pnt1oleoifeiydla em(vp;t4 lxoxo3ty1oa eluvilt0s2xrxrpoudomeemnci ()sDtaur nt1aee miciadfa2uau pn(0 exomr io1opt  ueilt)srtmxr ny4omtnlfesl() Dta(ront0opx mo3tytfm rmnmpn(0aeeoir3iodopD lu ils)texoio3ou1amenlnctltfa2truro;t4olxomfeiltfm2umu pnu0areoxr3iy1opDelu ols)seuo(opoy4amt lnvi () 2ra(m ;o4tpt io3iys a el(vs;t) eeoif iatfp e i i s trurxopoy1apenmnciasf 2ra( poo4texomo3taslaDrmumon()arenir to1optranes ()s2uo(r no1lle lnvi s)a2uauro;u1tptn fctat s2eanvp u) rxomfciodopDelneo;s)sruo(o3ny4lltnmieils) Drm(m ;t1altomictyt s umnvpnt)aetrmrctatlmtr ueol(0t2toxm3ny4lm emncs t)a2taxr ;u0tptn ocild a2rmumpn(0treomf ty1lpt  nvils t2xo(o3oo4ape lfctlt)srtau pnu4aeeo ictas sDranvs;t4 lxnir3totlpt  ueo t)t2umxo3nu4lmtemici sf Dtrxmooo1aeeomfeilsfaDrmumsnu)arxrxo totfa e ues t0seuoim3oo1om nmivsl(faruru  ;o1oeeomf3iaslaDraumpnu4arxnxfciadoate uei t0t2xmim3io4am nlfvia(  Dtmxrp;u0texn ociysfa2uan pnu4areoif oadfmDrlu ilt)s2uriopno4oleemfvia(  rrr(rpot0opxomfeiyt a emu o;u0 eenxf3oadopte nvo t) rtrxr3nudll  lncslt) 2rr( oou4tlt ifeias a2ean o;u) rerifctydfpt  nvils)s2xr(rpno1aptn nviat)aDuau pnu4opxniictltla rmnvp;t0tltrmf totla  lnvs;()setoxr iu4lptn feia(  rrru onu0tleomo3iltfmDuan o t4 leomocoatlptrlueo t)setr(mpou1am  lfctl()s2uaxm ot1tetnifctlslaDumnmonu0 lxrmf iotfpt  u ols srurxm iu4lmeemfctas)sDrmuront4tleo f3ilt a eluvp t0alerxoctydlp r n i;s trtmxm3ny4lptnmicilt  2uaxmpoo1alt ifciat m2eanvs u) eeoxr tadopt  ivsl(0srxmirpiodamtemnetls s2umu o;o1olxnmoeiadls2rl(ms;t)trxomf iytlpDeln o t0s2xmiopnu1lmeemfcia(f rumumpno1tltniieilslaDea(vp (0 rermo iydfpD aneo;t0 ruoxmpno1oltnmfeia()a2ta(rp;t1alx  octydla ulu onu4artnmo oo1laDelu o s sexoim nydol nlneiatfaDtmu oou0texn ociyd s emnmpn(4alxoxo oytfaDrluvolt0t2xm(o ny4lp emieslt aDraxr no0tlenmiciadfm2ua( p;(0arenmrcoatfp r ieslt) exmxrpio1altnlics sfarrmuronu4tlen octlsfs2emnvsn(0 rtnxf3ia1op e uvi;t0srtoir iy1om nlfcsas a2tr( pot1oeeomo3tyt s2el(vp;u)arenif3iytom rauvo;(0tetm(m3oo1amtemfes s) rtax pno0tle mfeiadlm2rm(mp u0 leoxf3iatopDraivsls0 rxo(mpnydolt mncsa() 2uru  ;o1tex  ociltlmDrmnms t)trtnmrcty1fat  n o;( s2uoio3oodap   nct (fs2rmurp;t0tex ioeiysls2ea( s ()tlxomr3ia1lmDeln s;s0 2xm(m no1openmict ()s2ur(mpno4oexn octytfm ulu ont0 etrxr3to1fpDeauei (0 rtr(opny4open ictl(  Drmx  ;o0altn fciltla2emnvo;t0 rxomo totopt lneo ()srtmiopou1altemneias)srum(rp;u4aeto f3tyslaDeluvo;u0 rxoxo ootfptrlneo (0 euoxm oo1lmen fvsls aDur( ooo4opxo ieiytlmDumnvpnt0artoif3iodlpt  u o s) ruoxmpou1alt lfcs s sDrrxm ou1alto o3iys a2um(ms ()teerio3oo1fmtelnvilt0tetrim iy1opeemfcias)s2tmxmooo1alxoiictadfsDum( o;u4trtoifcoy1lpt ai ilt) rtoxmpno4ll elicia() Drm(root1teeomoetysfs umnmonu) etoxr3oadopD livi;s)srxmio iu4olenlnvi (fs2umuroou0open feiatfa2rauvp;u4 reoir3ty1opt  ueo (0truoim3iu1lm nlfvi (fsDtaxmo;o0opxomoctysfa2rlnvs () rxoiocootfat aiei ( t2toxo3no1lpt mfvt () Dra(mp;u1olto o3iad mDum(mp (0 rtnmr3tatfp elues;t0s2xrxm3oo1ope micsat)artm(r nt4tleomocildlm2umnvpnu4tetriocto1opDe n o;t)t2xriopoy1al nmncil(fa2taurono4apxoifetysfa emump;t4 reoxf tydomDe nvi;t t2urxm3nudoltn iesatfa2umxr oo4apt  fciat a umumo t0 etrxociodopD li olt)texrxm nu4ap nmnvilsf rrm(  nu0alx mo3tydlaDel(mon(0trxrmf3oadlp e n s s sruoxm3oy4lp   nei () Drm(mooo0oex  o3tat s2ea( p u4 exrxf3iydfmDr i ils0srxrxo ny1apenlncia(f 2uau o;t1altoiieiydla2uanvsn(0 lenmo3oodopDeanvsls0 2trxo3oo4llenlietasf 2tmum ou1tpenioeiyt mDumuvpnt4 ltomocoydlm rau il( trtrir oudllt  fci () 2taxro;u0olxnmfeiyd s em(mon(0 ltnio todlm ranvo;s0 eur(rpio1llen fcta() Dua(  nu1aet mfciasfmDrl(vo u4aexoxo tadopt liesls s2trxo3nydlme mfetlt)arua(r ;u0opxnifeildfaDrlnms t0tltnifciotlp r neols)seum(o3oy4alen ncsls  Duru pnt4tpt iociltfs ra(msn(4 etriocoadopD lies;(0tetoxr iudaltnmivilt  2rrxront4oexnmietlsla2umnvs t0texnif3iadfp  auvi;t0tetrxo3oy4lme lfetlt) rum( poo1alxnmo3iasfaDra(mo;t4tlxniocta1fm eli il(0s2um(mpoo4lpeemivt t)s2ra(mo;u0texn ictadfs rl(vonu0 leoif3totlat liesl(0setmir3nu4oltelnvi s)sDtr(rp;o1oexn o3iyslmDrau s;()arenmrcta1oat  ueo (  rum(opnudopte ict sf rta(rpnt0ape  iciyt a rmu snt4 etnif iydfa  ln ol()setr(o nudomtelieslt)s2umumpnt1aexn i3iytlsDrlnvs (0artoir3oy1opte ues ( s2trio iudalte ictasf 2ua(r ot4oltn ieildlaDemumo;(4texoxr3oadfateauvolt sexmirpnodlmenlncia() rtrxm ;o0alx moeiys sDrau s u4aexnxf3iydfpteaueilt)seumir3io1ap nmfcilsfsrum(mpnt0aptomieiysfm ul(von()texrir3ootoaDr ueslt0trtoxmpou1openlneta( arumxmo;o4ole iociad a2um(vo t4aexnio iotoaDeaieilt0t2xoxr3nu1omtnmiei t s2rrx ooo4aptniieilsfm emn o;t)artrmrciytfat an ils) rtrir3oudlpee fctas aDtr(m oo1opxnmo3tadlsDem(vp u0altrxf totfpt  nei s0s2uoxr3iu1al nmneilt  rtrx o;o4ale mfetasfaDra(vo (4aexnifcoadom  li o;t)trtm(mpoo1omt lfctltfarumxmpot4tltnmoetat m uln pn()artoir3oo1oat aiei (  2umxr3io4lp n iei () rtm( o;o4tlxo f3ils a rm( o u)artrmf3iydlptrli olt t2xm(mpny4apeelfesl()a2trxrpno4ole iocils m2el(vp;t)texrir iodla rai s s0 rum(o oodlltemfct ( sDrau  ;t4altomf3iaslmDumnvp;u0 lxnif iodomteli o s  exrxm3iy1ol   nvsa( srtmurooo1aptn ieiatfs rl(vp;(0teenircootlp ran ils setoxrpoo4am nmnct sfaDra(mp;u4aeeniieiltlmDul(vp;u0alxnir tatfaDrli i t0 2um(mpnu4ape mncils a2ra(m ;o0apt iieiyd s rl(vpnt4 rtrxo tadfpt anvslt tetrim3no4amee nctls)sDua(mono0olxomoetld aDumumsn(4alermrcoatfpDrauvo;t trtm(r3no1amt lfctat) Dtaxmpoo1texo oeiltfm rm( sn() rxomr3iydoatranvs s srur(o oudll elnvta(f 2taxront0tlxomf3iytlm ea(vont4 eerif tatfm  auvo;() 2xoxo3oodalt mnctatfaDrmxr nu0opxnmieiat m eaumo;t)altnmo3oatfpDeaiei;( t2xoxrpny4lmtnlfcslt a2ra( o;u4tlxoioctydfaDea(vo t)aeermfctydlm  aneil() rtm(opnu1ame lfct (  2ua(ro;u1tlt  o3tatfmDeln o;u4aetnmocoytfatrlivslt)truo(o3oo1op   ncslt)srtau pot1oetomo3tldfs2rlu o;u4alxnxfcoy1oate ivo ()srxrim3iydol n nvia(fa2um(  nt0opxomieiad aDul(vs u4 rxrxf3oo1lpD ai i ( tetrxo3ny4optelnctlt  Durxro;o4aee  i3iytlmDrl(mo;u0 etnmfctotopD auesls)trur(mpiodom n ivslt)s2ta(r nu0apx mocils sDrlumo;(4texomo oo1opte ieil(0teurim3nu1ol emneta(f Dtaxrp;t1tptoif3ilslm2ulumon(0aeermocoydomt lneo t sruoir oudlpenmfeiltfs2rmur ou0opt ii3iat s2uaumo;u0aetrmfctydomDrlueslt0s2ur(rpiu4am n ncsas sDta(rpou4olenifeiytla2emump;u4 exrmo3tatlpDeaieo;s  rtoiopno4ameemfcsas a2rrxro;u0altnioetytfs emump u) etrxrcto1om  livs (0t2xmirpnudomt mieia()aruax onu1apxn fctltlm rl(mo;(4 lenir tatfm e ueo;t) 2tm(o3iydame mnvslsfsDrmx oou4tpeomfciydlm2rln pn(0tlxrxf3io1lpt  nei (  exmio3ou1lmt livt t)s2um(ronu1oee ifeiatfsDua(mo;u0tlerifcia1omDrlues;s)s2xrxmpny1ap   nvias) Drmx  nt4tpxomfcilslmDean o;u0 lxomr oydlatean ilt)s2uoio3oo4lle mnei (  2trx pnt4alx  f3iyt a2um( p;u)arxnxrcta1latelieo;s)texoxrpnu4op  mnvi sfartr( ont0ale mieiysfs2uan p u0alxnio iy1fm rlneilt  2xm(o3oydlpe  ivtlt a2umumont4oeeo oetltls el(ms u4arermocootlaDr u s;(0 exmio3ny4op  mfes (fa2rm(mp;o0aptoiietltlsDulumonu0tlenmf iadfa raies s) ruoxopiodopenmict sf 2uau  no0open ociad a rln p;t4aetomo iytomDr nes;s teuoim3iy4lm nlfesa() 2umumpnu1olxo f3iad m2rm(ms;(0texrxo3iy1oaDranvi ( setrxo oydam nlfetas a2rauro;t4apto o3tls m2rm(vp u0altoxf3ty1fmtran i;()seurir3ou4omee fci tfarrm( p;u4olxomf3iytfa uanvo;u0trxomf3oo1op  an o;s) rto(m ny4ape mnvtltf rumu pno1optn o3iadlsDel(ms u)aexnmo ia1fat au s s0trtmxmpiy1oltnmnetls) rtrxmpno4tetomfeildls eau p ()texoircoadfateai o;t)tetmxr3no4am  mnesas)aDrmurpou1oltnii3iat aDuan pn(0 reomoctotomtr i ols s2uriopiu1lptn ieiltfa2urxmp;o0oet ii3iydlm elump t)tetnifcoodfp rlivo t0t2tm(mpoy1om nlictls  2raxmpno0tltoiiciasfsDrl( onu) eermrciadfa rlivi s)s2trxm io4ol emfvilt)srrmxrpnu4aexniociydfa rmumo;t0 ltomf tadlpteai ilt0t2tm(m nydlmtnlfeil(fa2tmumo;t4alxomocild mDrmuvont4 lxoxf3oadfa eauvsl(0srxmxr3ny1lmtemncsls  Duaumono0ope  f3tyt m2eau s;u0arxnio tatoaD aieo (0setoxmpnu4alte nct s s2taxrpot1tpe mf3ild m um(vs;u4alenxo3ty1opteaivils)sruoxr3iu1opt mieil()sDrax pnt0texnio3iys m2umnvon()arenmf totfpDelnvs;s texoxr3ou4oltelfetas arur(mo;u1opx mo3iyd s2ranvp u0 rtrxf3oo1la r i ols trurxr3oudoptnlnesa(  rtmu pnt0aet  feiasls em(vp t) reoxr iatomtrluvo;s  rxmxr nudolt
\ No newline at end of file
@@ -0,0 +1 @@
+ues t sexr(r3oy4amtemict s  rurx pnu4ole mi3ils a2umnms;u4artnxr3todlmtrluvo t) rtoxopiu4lp  lfvia() Dtm(  nt4opx moetatlsDul(vp ()artnxrcoa1fatrau o;t)sexmxo iodome mieiat  ruaumo;o0tpe mictltfm2eanmsn(4artoxociytfaDelnvi t)sexoim nudol elivt tfs2ua( o;t4tptomoetatla umump (4 ltoir iy1fpte i ols srtr(m3oy4ll   ictls) rururpou4alxnif3iyd mDul( s;(4tltrxocoydoaDe nvo ( teur(o iy4lmenlfcil() rtrxrpno1alx  octlt mDua(ms (4aexomfcoa1omteaivo;t0sexr(opou1lmt micsasfsrtr(rooo4tltoio3tyt s2umums;(0aeermo3iytopD lnvs t) etmxo3iydll elivsltfs2ururoou4tpenifetaslm rl(mont) exomo3io1fptr n i s)srxrxrpoy1om elnei sf rtrxmp;u0texo ietydla2raums (4aeerxo3oo1lpDean o;s)srxoim3iodllte ncias aDrrxmpou0alx mictys aDemuvon(0trenio ia1lm r neil(0t2toxm nu4al   icslsfa2raxm ot4apx  iciasfa2umn o;t4tetnxf3tatoaDe uei;t  rxmxm iodalenlfvilsfa2rmur ;o0texn o3iatls ra(vonu)aetoio iytlp eai o s  2tmio3oo1am emivsa(f Dumx  nu1opxn ieiyd s2ua(monu)teenirciy1lm  ai s;s0seur(o oy4lmeelnvsl()s2umu oot1alenmieiatfaDemnvon(0 eenifctotoaDrlivi;t teurimpoo1lm  lnesls) 2ta(ronu1alx mfcias sDeau s;(0 lxrxrcta1fate u il() ruoio3ou1lmenmictltfs2tmxm ;u1tee mfeiasfsDelu sn()tlxnmr3ta1fmtrli ol() 2urxr3iydoptelivtltfsDtax  ;o1opeoiociytlsDeanvs;()trtoxf iodlmDe ues t  etr(m iy1lpt lfcias)sDtr(m ;u4ape mf3iadfa2umn s;()trtomr3iatomt livi t t2uo(o3nydlm emivtlsf rtmxro;t0tpt mf3tytlaDulu p t0artoir3ia1fmDeau s ()s2xo(r3nudlpee iesa(f rrrur no1aex mfeiytfaDelums;u)trtoir totlptr neslt0 rxm(mpiodll emnci () 2ur(mpot0tlxn f3ildfa rl( onu0altrxr3ia1fpt  ues t setmir iu4alt lfeta(faDurur ;u4tpeoifciat mDuln s (4 rxrmf3iadlpDeauvo;t  ruoxrpiu4ol nlics sfaruru  no4tet  i3iltls el(msn() rxrmrcoydfat luvi t  exrxr3oydlme mfeilt)aDta(m oo1tle  feilsfm rl(mp;() lermr3io1fa eai o;t) 2tmimpny1amtelicils)aDtr(r nu0oltn ieiytfmDemn p (0alxnmr todopD  nvo;t trtm(r iy1apeelfvilt)s2rmxr ou4alx mf3taslmDrau snt0teenxf oadlpDelu o;t)trxrir nodlmt lnct (fsDur(rpoo0apto oeiltfm rm( o;t)tetrxo iadomDe u s t0sruriopou1ome livslt) Drmxm no0oltn oetld s ranmo;t0 ltnifciadfmD livils0srtm(o iudol   ieiltfsrraur oo0alx ifciys mDum(vpn(0aetrxfcootopDeaieo s t2xmxm3io1lpt  netatfartmxmo;u0tle mo3iyd aDumuvpnt0texnmfctydlaDrai s t trtrir ny4alee net (f rrmu  ot0teeo ietltls rlu s u0aexrmocoy1lm  lnvs s  exrxopnu4am n fctat)aDta(m nu0apenmoeilt m emump;t0aleoif iydlmDr uvslt)s2uriopno4lpen net s srrr( pot4apt mociat s ea(ms;(0trxrio oydoat li i ()s2um(opio4optemnctls  2ur(ro;u4alxnmictysls rluvsnt4tetnxr3oy1fpD  ivs;s srtm(mpio1alee neiltf 2trxmpot0teeomo3tat mDuanvp;(0trxrmo3ty1laDean o;s0t2xrxm oo1oleelicta(fs2ta(mpnu4tee if3iadfa2umuvs;t0trtnifcoodlptrlneo;()setmxo ou4amtelfcsatfsrrrxrpnt4tex  octyslm2emnvp;() rxrxr3totlaD livs t tetmxmpnydlmtnlfvils srtr(  ot0ale iiciydla emuvp;t) lenmo oydfm e ieolt)seuoxrpnudlpee ivil() Drr(mpoo0opeoio3tls a ea(vo;(4alxomf3iotopDe nvo ()s2xrirpnodape miciat  rurx o;u4olxomoeiatla ul( p (4 ltnxfcia1oaD  i i (0seumim3nu4ll nmictat)arumurpot0oltnii3tlt s2ua(vp;(4arxomo3oa1la r nvo;t)s2um(o iodllenmiciatfarurxmpnu4tpxnmfciysfs ua(msn() etnxo tatlat aieols s2toxm3ny4ol   ictlt) 2ua(mp;u0tex ifctyslsDrm(mpnu0areomr3ia1omteai o t) euo(o3nu1lme lici sfsruru  oo0alx mfeiad m eluvp;t4arenmrcto1opD aiei;t) 2xoiopoodoptn iesa()aDumu pnu4tetomfeilslaDrauvonu4 rtrmo to1fmtrlu ils0srxmim3nudlmt lnvtlt s2tr(rpou4texoii3iasfmDra( s u4 rtomf3iy1laDrln s;s trtrirpoudll  mnvt sf rumump;o0olt  fciatlm rm( s;u)texnxf ty1lat  ivs t0trur(mpoydomt  netat  rum( ooo4aex  f3iad aDemnvsnu0tlenxr tytlp rluei;(0texmim nu1lp   nvt (fsDrr(  ou1tpt  i3iadfm um(vo (4aleoxrctatopDrlneslt0srto(mpoodlmtnlnei t srrauro;u0openioetadla emu s;u4altoirciy1fmDr ivs s) 2tm(o3nydlle lfet (  rurx  no4altnmi3tyd m ul(vont)trtrmr tatlpt lnvol( srtrxrpoo4ame lnviat aDrmx p;u0alt  i3tydlm2ulums t) exoio iadfp r neol( tetmxrpoodame mivsasfarrm(r ;u0altniieiatlsDrlnvsnt0texrif3oodoatr nesl(0s2tmxo3iudome  fvtls)s2rmu onu4aexnif3iadfsDua(mp t0 leoxo tytfpt luvi;s)seumio oy1ol nmfctlt) 2ur(rpou0texo fctldfa elnvo;t0 etoir3io1fatraues s0s2toxm3nu4omtemieiltfs2rmurpot0tpto fciasfmDeau s t0 lxomf ia1fp rauvi ()t2xr(rpnodam nlfcsa(f 2raxmo;o4oet iietas a2ra(vp;t0 lermrcoadlmDraivs;t)teuoxm oodlp emnei ( aDurxm ;u4tex  f3tldlaDrauvp;()tlenxf3totlpDr iei t0 rxoxr3io1op elnci t a2rrxm ;t4alxo oeiltfa2eau o u4tetoif3oo1fp rliei;( teur(o oydalt  neia( arurum nu1altoiietys sDum( s;u)tetomfctytfpt lnvo;t)srtrim oudom emfeil(f Dtmu p;t1tlt mi3iytlm2eluvon(4treomfctydlatr ivolt)s2to(o3iy1lpt mfcs s arrrurp;t0altniiciytlsDum(mpn(0 rxrxo3todfmDr ivols0tetmio3oodoptn iciatfa2tmx  ;o1tpxoio3tytfa2em(mp (0aeeoxo oatlpDelnvi ()t2toim oo4lltelici (fa2ururont1olx mo3iltlsDrm(vp u4altnirctydlmD auvs t t2tmio oydop nmnet s)srtmxr ;u1optnioeiatfs emumont0alxnxrcia1lmDr nvi;( trxoxmpiy4lpeelfciltfaDtax p;u1opeo oetadfs2uauvo u)aexriociodom  au s (  2um(m3iy1lpt  fvt s)srurum ;t1aee  ociltfm ulnvo;u) exomoctatopD lnvol() rtmir iu4om e nvt tfsDra(mpnu0tee  f3iyt m2rm(ms;u) rxrir3tatfa elnvsl(0srtr(opoydom elfvs t  2ur(rpnu4tltoifciysls2rlnvp t4 lenmr iydlpD anvols)s2um(rpnudap   ivi (  rrrumpot4oeeomo3iydlm2eauvs u4teerir3ootomDelieslt  2xoxo ny4lp  micilsfs2uaurpou0altn fetysfaDean s () rxomr3oytom  lu i;t0t2xmio iu1oltnlnvtlt arurur ot4openmi3iydfsDemu sn(0trxrmf oadfpte uvols srxrxrpiu1am   nvtatfs2ur(mpnt4aeto i3tat m2ea(vs (0alerir tytlatrau o s srumxr3oydal   fvt s s2raxmo;o4tpeomfcildfm em(ms;t0aeenmrciatfpt  ueslt)trxm(mpny4op  mfcs ()srum(r oo0apenmf3iad s2eln pn() eenir ootfm eau sl()t2tmio oudlmt mfeilsfsDtrxr ;t4aee  f3tadls2uanvo;u0 renir oodlpDr n o t)trxrxr nu1am emieia(  rtm( p;t0oeeo f3iadlsDrm(mp;t4 rxoifcoo1lpDr i o s0teuoiopiu4lp nlncs (fa2umur ou0aexomfciyt aDuln p (0altrxr ta1faDranei;(0teumio io4alt lics t a2tmu o;u1oex ifeiatls ra( o;t)tlxomr ta1lmD aneslt) 2trim3iudll elncias  rtaxrp;t4aeenmociatlm2rlnvsnt4 rxomr oy1fm raivs ()t2urirpoo4ape lies s)aDtmxmpnt4aetoiietltlsDel(mo;u0artrxr3iatfp eaivols  etr(m3io4oleemfetat  Dtmx pou0aex  feiltla ra(mp u4aetomo3tatlptran o;t0seur(o3oudlme lnct () Drrxr ;t1olxnmieiltlm elumpnt)tetnxo3tatom e n i s  2uo(o nodlm nmivtas aDra(mo;o1tex mo3iltfa uln o t0aexoir iytfm eaieo;t0trxrimpoo4om e ieta( a2ua(roou1oetomiciys m ea(mp;(4trxoxrciodfm e i s;(0srurxmpiu4ol  lfetat) 2um(roou1tetn f3iysfsDulu p t4trxoif tydfm ran s;s0texoirpnydom e ncs () 2um(r oo0tlxn ociadfs2ea( o;t0 etoir3oadfat liei;t) 2xr(r ny1ap emneta()a2umxrp;u0opxniieiasfaDrm(ms t)alerio3ty1fpD  nvil() rurimpny4olt licilsf rumu pnu4tet iictytfa2umu s;u0teeoxfcio1fatr i i t s2xmim3no4ape  netat)srua(m ;u0tpenmieiadfm2umumpnu)tltnif3oytlm  lu o;()srumxo iudllenlnvsatfsrtruronu1apxoioetyt aDuanmpn(4altoxf iatopDrau i (0t2xmim3iu1op  mivt t) 2tmxronu0tee mociytfaDelnvpnu)tltomf3oodomD aueo;s0s2uoxr3ou1olt lies sfsDtmxrpno4olxoii3ilt s rl( p;t4aeermr3oo1fp eanei;s) 2tmxm oo4lltnmfcs (fs2umur nu1aetn i3tadfm rmnvo ()aetoio iatlptr nvs t0s2xoxm iydalteliet s)srumxmo;o1apt ii3tldlsDul( onu4tlxoxf3ootoaDr ueol(0 2to(r3iudam   fet t) Dum(r ;u1optnioeiatfaDeln o;u0 etomfcoa1lp r nesls0teur(r no4ale mieias)sDrm( p;t0tptoioeias m uluvo;u)texomocootfmDrliesls srum(opoudlm  micias srtr( o;o1olx ifciad sDrlu onu0teenxr tytom elnvils s2xoxm3nudal emfetat) Drmur ot0tpx if3ildlsDrmump;u)tetoir3totop eli sl(0 2umir3nodaltelies s  2uaurp;u4opto fciyd s ul(mp;u0 renmr3tydoa r u o s  eto(r3iodol nlnesa() 2raurpnt1alx mfciatfaDran onu0aeeomrciotlp  aivo;s  rtmxm3ou1olt lnvtatf Drau o;o1tex ii3iatfs2eluvsn(0trxnio3tadfm  lues s) etr(rpiydal emfes t)sDumx  ;t1oetoio3iysfm2umnvs;t4arxrxrctydfm ean sls)s2urirpoo1opeemieils a2taum ;t0tpen i3ils m ulumo;(0alxrir3io1laD anes;( teto(rpoydomt lnet tf 2rau  ;u0apeoifeiysfmDeauvs;u) exrifcoodoa r nes ( srur(o3oo4llee ncslsf 2tm( pou0tpt  ieild aDea( p;() rtnir3totoptrlues s0t2uoiopoudaltnmivi t artaum no4tetn fciat s rl(vpnt) etrir3tatomtrlivi t0tetrxo3io1omeemnet t sDtmump;o4tpxo ociatfm2rmnvo ()texnxr oodlat  u s t0 2uo(o3ou4ap nmieilt sDraurpnu4oltoii3tydfaDrmnvs;() rxomfcoadfm  lies t0srtmim ny1amtnmietls  rraxmpot4tet  o3ils sDra(mo u0texnmrctatlptran s;s0 rxoxr nodlptnmieta() Dumumpou0aee io3iyt a2uauvo u)texoxr3iodfatelivol( tetr(rpno4amee ivsls)srumump;o4apxomfciatla2uluvs ()texoxrcoydlmDraivols)trtmxr iodam elnvtl(f rumx oou0alx if3iat s2rln s;(4 etomr3oatoatrau ils  ruo(r oo1om  mfctatfa2rm(r ;u1alt ioeilslm2rmumsnt4 ltnifcoo1fateln i t0t2tr(r3nydalen fes sf Dur(mpot1olx ioetldfa uanvs;u)altnxo3oadfat  nvil()t2uo(mpno1optelncsas sDrmxr ;u0aeeo o3ildls rl(mp u4aexnif iy1la eaiei s texm(mpio4om n ieta(fs2taur no1tetn fctadlsDean s t4trtnmf ty1fmteanvs (0seuoir3io4ole mfcsatfa2um( pou1ale io3iltfaDuanmp u)tltomo3iydfa r i i;t  2urirpiu1apenmnei ()aDtaxmpnt0oex  o3iyt m2uau s;u)trtoxo3iodopDrlnvils  eto(m3iy4omee fcsatf rum( p;t0tlen o3ils a um( o t4 eeomr3ta1la   nvol()t2xo(o3io1oleemietas s2tr( p;o1alxn o3iydlm2rlnmont0aetomr iydfptean ols0 rtm(o3ny4llen iciltf 2urumpnt0apx  ociad sDra( s;()alenmrciytlm e ivi;t)s2xm(m3ou1ll nmncsl() Duau pnt1aptomietasfmDulnvon() rxomr iytlm rln i;t setoxm3iu1altnmfvils srum( pou4alxnmictad m ra(mp t)tltoifcta1fp ranei;()tetriopoodlm   neiat  rtrumpou0olxo oeiyslm2rmnvp;u0 rermfcoatlp raneolt)srtm(o3oo1lp n ivia()artaxr no4alxniieilt mDrl(mon()altnxf3iodfmDrlnvi;s0trumiopoy1amtn ncilsf Dtrx  oo4olto ociysfaDemums;(0aetoircoy1oaDe ies t truoxrpiodame lnesat srtrumo;o1tlx mociydla rmnvo;(4tlxoir3ty1fmDeaneils  rto(r no1om nmivsls)sDrrxmp;t4ole  oeiaslaDranmp;(4aeerxo3iadoaD  neo;s  eumxo3oo4omte nvi ()aDtrur nt1alxo iciydla2eauvs u0aetoir oatomDrai i;(0seumxm nudalenlict tfsrtmu  nu1teenii3iatfa ul(vo;(0 exoifciotlmD  n s t)tetr(r3oy1omenlfcslsf Durxmono4opxnio3iydlaDeauvo;t0trxnxrctotop   nvs;( truoxr3oy1apee fvtls)aruauronu4tlen fctadls2rlnms;(4texrxo oadopDe uvils t2ur(m no1olee icta(farum( o;u4tlt  ictadlaDuanvp;(0aexoxrcoa1fateauvs;t)trxmxm no1lltn ivil(  Dtrx p;t0opeomocildlaDrau s t4 lxnxo3tytlmD anei;t)srxm(opiu4ope mivta()arrrxm ;u4oetn f3iadls elu o;(4 lxrircootomDr ivils0 rtrxr3oy4amen fetat)s2um(rpou0olen feilslsDrauvp t4aeenir oodfmD  u s (0srtmxrpio1alt lnvta()a2taxmpoo4aex iicild m um( o;u4altrio tytlaD ln il(0setoimpoydal n ncsls) 2tr( pot4alto i3iytlsDrmnmsnu) eeoxf3iotomt  neo ()setriopoudlm elfviltfaDumxr oo0tpeo o3iydlm2uan o t) leoirciatfmDr i il( teum(opiu4am n fetl()a2ua(mo;u0tltniociys s2rluvp u)tlxoif3ta1fa elnes;()texm(r3oy4am emict ()arurur ;u0opt  o3tytlsDrm(vo;u4 reoxo ty1fpDr ivs t) 2xm(o3iy4lmtnmfvsas srum(  ou4aeeomiciysfa2eln s;u)altrmo oodfpt  ueols trtrim oy4omeemictl(f rtmxm ou0oexnmfeiyt aDua(vs (0 leoif iadom raies;s teuoio3io4op nlivta(fs2taxr ou0optn ieiytfsDuaumon(0texnxr iodfmte uvsls)t2trxopnu1alenlnvtl(faruaumpno4oet moctys s raumo u0alxnxr3oa1fm eai ilt) 2um(opoo4lpt  nctasfs2ua( o;u4alxomieiytfsDrmnvo ()trxnxo iatlmD aneo (0teur(o io1ap   nvil(fa2trxr ou0opt io3iyt aDemn p;t) reoio oa1fmDelues;s s2xmxo3iy1ol elivt (fsDua(rpot4oex io3ild s umums;u)tltnmrcia1omDran i s  rurio io4lptemfei ( artmx  ;o4aeenmo3iysfmDulnvp t)aeeoxoctodfat anvols)srumir no4lmee nci t) 2tr( pno0alt mo3tysfa um(mp;u0aetomo3oodla elivols0 ruoirpiydalt  feta(fsDurx onu4tpt  oeiatls rlu snt0tleomo tadoatelu ols t2trirpoo4lle  nciasf 2urum nu4tpe  ieilt sDumnvonu0 etnif3oy1optrluei;(  eum(opnu4oltnmivias a2tmu  ot1opt mieiytlmDulnvon()tltrmfctotoa eli s;()t2umxo3no1ll  mfcsatf 2uaxrp;u4alx mfeiadlm rl(vsnt0 eenxfciadlatrli o;s t2tmxr nodoptelnviatf Duaxroou0oeenmoetatfsDrln p;u)aexnxociy1lm ran sls)t2xoir3iu4om emfctlt a2uax  oo4olen oetyd s ranmo;u4tetoxfciytoa rlivo;(  eum(m3oo4omtnmicsl()a2tax  ot4tex  octas m2rmnvont)tetrxo3ootfpt anvs;( srurxmpiy1lp elfcils a2uaum oo0oexoii3iatfmDuln o;()altrifcto1lptrauvo;s0teurir3nudol n fvtat)s2trum ;u4apxoiietatfmDrlnvp;u0 exrir ootlaDean slt)teumxr3ou1om nlnetat)aDurumo;t4tet  oeias s2rlnmp;t) rtrir3tytlmte uvo;t) euoir oy4lltelfes ()sDra(r ot1tetnifetltlsDel(mp ()alxoxfciy1fa eaueo;()srxoxr iu1lpeemfetl(fsrtaxroot4aee io3tatla ua( pnu)artnmo tadfa eln s s srtmim3io1lpe  ncias)srrru ono1opxniociad mDra(mo (4aetoif3io1lp eau slt trumio3oodape  fct ( sDtmxroot0teeomo3ilslmDrm( p ()tlxoif3tytlmD lneilt  rtrim3io4ape lietlt a2trumono1oeenioetysls ul(mp;u0aetnxo ootfm elu il( trtoxo iy4opt  nvs t srrrxmooo4teeo oetydfm2elu o t0trtrmf3todoa rliesls sruo(m3ou4ol emncs s)s2tru pou0olt  octyd a elnmo (4tlerxf ootfm  anvi t0sruo(rpnydam   nvt tfsDrr(r nt0alxnmocilt m rlu p;t)tltrmr iy1fptranvo;s  rxo(r3nu4lp nmneils srtmuro;u1ape mfciasfa ranvo (0 rerir3ty1laDr nvs;t) rxoim3ou4amt lfcsas s2trxrpnt0aleoio3iltla2rmuvo t)trenmf oydopD li ol(0srtmxrpiodlptelnvsas  Dta( ont1teenmo3iytlaDrl( sn(0 etoio3iytoat  uei;s0 2trxr iu1omen fcsls a2uaxro;o1opeomfeiys a2el( p;()arxoir oo1fmD  uvslt  etrxm iydoptemfet s  ruru  ot1ale moeiysla2rmu o;u0 lxomo3oydlm e n i s trtmxmpio1op   nctlt  2umurp;t1oex iieiytla2rm( sn(4artoxf3oytopDelivo;( truoxopou4ol   ietlt srururonu1tpenmoetyd m2em(vs;u) rxnxociytfmDe neslt0sexoio3oodame miei sf ruauro;o4tleo f3iyt aDem(vs (4tltrio oatfpD aneslt)srum(m3nudamtemicsa() 2ur( ono1olto i3iadfaDrl(mo;t0aetrif ootla  an i;s  rxmxopiu4ap nlncsasfaDuaumpot0aex  i3iaslaDrl(vsnt)alxomr3iy1laDe uvsls0trtoxm3oo1ll  mfcs sf rrrumono1optomi3tas sDran pnu) eerxf tytomteanvolt setoxm3oo4op nlnetl( s2rmxmpoo4aee ii3iys s2emuvont4aeerifciadlat an o (0texoim io1apenlfcsl( srrm( p;o1tlx mieilsfm emump t4 exnxf3iytlaDeauvslt0t2um(rpny4apenmfvsltfs2umx  ;t0oleo fetytlm emn ont0trxnif ia1lptrauesl(0s2tr(r nu4amtemicia()sDta(m ;t0apx mfctasfs2rlnvont4artoir3iatlp rluvi (0 etrxm ny1altn ies sfsrrmurp;t4opeo oeiad s ranvpnt4 rtrif totomDelu s t) ruo(o iudlm   fctl( aDrmumoou4aeen i3iltla emn on(0alxnif3iadoaDe nvs;t0s2ur(mpiu1lme  nci s) 2raxrpnt4ale  ociytlm emumsn(4texnmr io1lpDelu s s) 2tmxm3nydomtnmiesls  rtau  ot0oetoioetysfs2ulu pnu4trxoxr3oytfpt  nvi;s0trxoirpiudlm e ivt t)a2umumpot0tetniieiyslm emuvont4 lenmo3oo1fatraivs;()srurimpiy1alt mivsa() Draxro;o4aet iietld m2ea(ms;u4texnif iotoate i s t)texoxr3oydoptnlfei ( srumxrooo4optomictad a2um(ms;(4 etnxf todlateaues ()srxo(r nodopenmnct tfsDuau p;u4olt mieiys m em( o t4 rtrmo oytfp  lnvo s)t2tm(rpiy4olt mneta(fa2rrx poo0texn oetld sDua( p;()areomrciy1lmDraivo;s)t2uo(o iodlm elivt t)sDraxmooo4apt ifciysfmDrau o;t0 eeomo3ia1oa raiesls tetr(o3io1aleelfcsl(farrm(m ot1alx iieildfm2emnvp;(4 rxoiocoadlpD  u o t)s2um(m no1omtelfvta(fsDrm(m ;u0tlenifctyd sDranvs;(4 rerir3oa1op  aivs;t)texm(m oo1ap  liviatfa2raxr ot4oet miciltfmDem(vp () reoxrcootopD aieslt)t2xmirpio4ll e ics t  rta(  nt4altoif3ildfmDulnvpn()trenxo oo1faDr ies t) rxmxm nu4olt lnct t  Duaum no1tpe  ociatla uluvs u4aexnxoctatfmt  nvo s0trxrxm3no1ap nmnet t) 2rr(ronu4apxomf3tldfm2rlnvsnt4artoifctodfa rai sls) rumxo ou1opee feias) Durx oot0aet moetyd sDumumont0artnmr totlatr nvols  2ur(m iy1ll nlncsa()a2tmx  ;o1oexo ietltfsDrmump (0altnmf3oatfmDrli sls0setm(o oo1lptelfei t arraxrpnu0oexoifctys s rlump;t0 rerifcto1fa eanvi t)truoir3iy1omtnmfctat  ruax ont4opxniicilsfs2rlnms t0texnmf3tadfpteauei;t  2xm(rpnu1lpeelictatfa2rru oot4tlxnii3tatla2uanvp;t0tltrir3oadfatraneo ()tetrxo3oo4ameemicia() Drrxrpno4teeo ieildlm2rl( snu)trtrif tadoatrli ils0 2xoim3nu1op nmivs t sDua(mp;u1aexoioctydlmDemumo t0arenir oo1latrlnvs;t0 euo(o3iu4amt  fet () Dum(mpot0olenmfetydls2ua( snt0texoif ty1fateaiei;(0srtriopiu1omen ivsltfsrtm(rpoo0apxn octys sDemuvo u4 exnir3to1omteaueilt0t2uo(r3iu1ll nlnciasfaDumum nt1aptn icilsfsDra(mp;t) exoxo iotlmDeau il(0texrim3ny1ale  fcilsfs2rruro;t1alt mietad m2ua(vs;u4trxrifctytfpteauesls) 2to(rpiu4lpte iesa(f Drau pot4tlto fctldfmDra(mpnt)tlxriocoytomteli i;t) 2umxm iu4ope mfvsa(  2ra(ro;o4aee mfeiltfa2ul(mont)altrxo oy1omtelu i;( teurirpnodap elivil()s2taurpou4oeeo ictyt aDrauvs;u0altoircto1oa eanvs s0t2umim3ou4omtnmfcsl(f 2ra( pot0apx mfetltfm elnvpnu)alxrif3oy1lm   ivs s0trum(o nu4optelicsasfsDtr(mpoo0aeeomf3ilslsDuauvo;t) reoxocoatoptr u il( s2urxo iu1am  mictl()sDum( ooo1olenmietlslm elu s u) lenmf iytlatean ilt s2xmxmpoy1om n nvt (fsDrm(mpot0teenio3tyt a2uaums;u0 lenifciydfpDrauvi;(0 eumirpiy1lpe  ncs ()s2ua(roou1olx moctlsfmDua(mo;(4teerxfcoo1latranes (0 2urimpnu1ope  fvsat s2umx  ;u0aexoiiciytfm ulnvs;(4artoxfcoa1om  an s;t0trxr(mpoy1op  micil()aDtru pot0aeto i3ild a ra( s;u) etnxo3iydfatraieilt  rtm(r nodlle  feil( sDtmu oou1aet iictas s2uln pnu4 leriocto1oa eai s (  2toxrpoo4ll   ivs () Dtaxmpnu4optn iciytfs emnmp ()texnxf3todomte nvs t0srumimpnu4lleelfcilt)a2uaxro;t4olx  i3iydfm2rmuvp t)treomr3oydlm  ln s ()srxoxm iu1ll  mfvsls)aDuru onu1openioeiydfaDrm(mont) ltomr3oa1lpDeai i;t)texm(r3oudom eliet ()aDrrxr no0tpt moeiatfmDrlnmo (0tetnmo3tydlpte ues;s srtoxopiudamen fet (f 2rax  ;o4tltnif3ildla2umn s t4tltnmfctatop eai s s0srtrirpnu4oltemiei tfsDumu  ;t4ale  i3iltfsDelumo (4teeomf3oadomDrluesl()trtoxm3oo1om n nvs t) Duaurpoo4tlen i3iadls2ranvo;u4arxnio3oo1lp elueils0sruoxr ny1omeemnvsas s2rmxrpnu1tpe io3tad s2rlump;u4arenmocoadla elivi t srtoir3iodoltnlfcslt) rua( oot4aexnifctydla eauvsnt0 leoxo3iy1faDraneol() ruoxo3iu1ale lneilsfs2umxrpnt4tlxnmf3iysfm2rlu pnu0tlxrmocoodlpDrluvols s2tmiopiy4lp emivt tfs2tmu  nt0tltnmieiadls ra(vs;t4altrmoctytlaDr i s;s)truoxm3no4alt mnei (f 2trx ono4oex  iciyslaDrlnms ()alxnxo oadomtelnesls0seur(r3no1amtn ivtls s2rm(rpnt4teeomociyt mDem( p;t4 rtrmr3iotfateauvs;t)t2toxo iu4lpte ict (fa2raxm nt1tpt  fciat sDua( o;(4 leoir3iadfaDe ivs;( seurimpoodlmenlfviat  2trx pou0apenifetlsls ra( pn() ltomo iadfptr u s;()seuoim io4ome mfvs () Dtmumoot0alt mi3tldla uan p u)aexnir3oydoa ranvo (0 eur(o3oy1omtelics t)arurx pnt0tpx mieiys s umn s () ltrir3oatoate ivi;()sexmim3iu1lpeelnvta() 2ur(r ;o0apx ioeiat a2uauvo;(0teerxf3todfaDrli ol( seur(m3iudapen fet t srua(rpno0tpenmictydls ra(vo;t4tetnif3oydfpt an i;s0 ruoirpoydlmtemivt () 2tax o;t0oeeomi3ildla uanvp u4alerxr3iytfmDe ues;(0teurio ny4ll  lfvsat) 2ta(  ;t1tle mfeiltlaDrl(mo t)arerxf to1fa   ivi (0srxrimpno1ame mnes t s2tr( pou1aetnmo3ilsfmDua(mp t4arerir oydoa eau s (0t2trir3iodomtelictlt sDrmxmpnt4tptn oetadfm ean p;u4aeermrctadfpD  i sl()t2toxm3iy4lpte nvia( srtaxmp;u0texomi3iydla rlnvp (4 etrxf3oa1op   nvs;t)teumxr ny1lp nlncta(f Dururooo1oexomociytfm2umump u4 exoirctotfmt auvs;()trumxm3no4omeemnvsas)aDrmuronu4tlxo iciytfa ua(mp u) lxoxr3ia1fm r ueo ()srum(mpnu1lptemicsas a2trxr nu1olen oeildlaDrm(ms t4alenifcto1fm e i s;s) 2xoxm3oy4ape  fcsl( srta(ronu0olen fciydlm2umuvpn(0 exnmrciy1fa eln il(  rtmxr oydlpt livs s)s2tax  ;t1tpt mi3iltlmDulu snt)artoif3iydfp  lnei;s0seto(o nu1opte ictlsfartmxrpnt0teenmoeiysfm rauvp;t)trtomrciytfp   u i (0 euoirpiu1am   fesl(faruaxroou4opeoioetyd m2umnmp t0teeoir3io1lpD aues s0truoxr3nu4ap   nvtat srurump;o4opxomicild m uanms;()artnmr3io1lpD  nes () rtmir3iodll elfetls) rrrumpoo0opxoiociad aDrlnvo;(4 renxocoa1lm e ieslt) rtmxmpnu4ole  nvsasfs2ta(m ;o1tpxoifctadfaDranmp;(4 eermo ta1lmDr neo;(  2tmxr nydomeemicta() 2rrx o;u4oex ifeils m rmu s;u) rxrif3tadfpDeauvolt0 2xrxm no1lptemnciatf 2trxrpno4tetnmfciysfm um(mp;t0altnxr3iodoatrli slt t2xoimpou1ale lnctat)sDraxmont4tpxn ieiydfm2emumsnt)altnmfcio1fp  ai ol( trto(m ny4lmtnlncslt)s2urum ;t4aexn ictld aDua(mp u)tltrio tatfm rlieol(0seurim3oodome mnct s arrr(m ou0alxn i3iyd mDraumo u0 lenxr iodom rlnvs;s)teurxopny4olee fci t)s2ta(  nu0tlx mfetls m eln o;t)tetomr iotlaDeaneo t)trumxrpou1lmte icils) Drr(rono0altoif3tytlaDeanvsnt0artomr oydom elues s)trum(m3nu1ameemicslt)s2taxrpoo1tpe ifctadlmDelnmo (0teeomo3ta1fm elueolt  rtmim nu1lp   ncsatfa2ua( pno0aee iiciydfs ra(mp (0trtrmfcoytfateanes s) etrir3io4ame  fvsls)srua(moou1oexnmietls aDemump;t0 reomrcoo1laDrlnvol(0srtoim iy1lm   fes tfsDrmxmpnu1tpto f3iysfaDea( o u) ltnmo iy1fm   nvo (  2umio3iu4op   icsl( a2rm(r ;u1aetnmo3iatlmDulu p;()tetoio3iy1fp eanvolt)texo(r oy4lm emneta(faDtaxmpou4aexomf3tyt m2emumo;t)texrxo ootom ran o t sruo(rpoudop  lnvtlsfa2ta(rp;o0tet mictatls uanvs u4trtnmf3tadoaD an sl(0srtmxr3iu1omtnmfes s srtrurpot1apenifeilt s2rlnvs (4arxrif3todfaDeauei s0setr(m3iodllee ivs tfaDtmx  ;u1tlt  oetatfs umumsnu) reoif3ta1oa r uvolt  eur(m no1ol   nctl(  ruax ont1tle micild s um( s u4 exoifcoa1omtr i olt srumxo ou4optn nctat aDurxront0opx ioetas m rln o t4tlermf3iatlm  lues t)t2xm(o3ou1amen nvt t) rta(r ou4tltomoeiatls uanms t4aetrxrcoo1opt aivil() exr(m iudll  mncsas s2ua( pnu1ale  ietysla2em(vs;u4trtrxr3oydopDr ies;t0trxm(o3nodll elieslsfaDtmu  nu1open ociyt m2emnvpn(0 eenifciadom r nes;t0t2xrxr no4omt  nct tf Dum(mp;u0oee  o3iytfm eau pn(0tlerxfciydfpDelues;s0texoxrpio1oleemfvia(fa2ua(rpot0tpxo fetls m rau s u) eeoir3oatlmDeaivo;()sruoxr3nydomee ictls a2umxrpnu0oexo fciyd a ua( snt4aetnmr oy1oaDrlu s s) rur(opio1ll  lnet (faDtaumo;t4apt mi3iadlmDelumonu0arxrir ty1fmD ln o s0 2xmxm3iu4al nmics t) Draur oo1oetn oetat m rau ont)texoif3ty1lat ln o;( t2xrir3nydoleemivsls)srtrur no1olxomfeiysfsDran p;(0 renio ootfat  neils) 2trio3oo4amtn feiat) rtru p;o0olxnifciysls2eaumo (0 etnmr ia1faDe uei ()t2to(o3ny1alt mncia()sDuaxm ;o4oet ii3tadlmDel(ms () rtomfciotlm e uvo () exoim3ou1lpeemfvs ()a2rr(mono1tpe iociadfaDeau o t4tleoxr3oytlmteai i t0trur(r oy4lpenmnvia(fa2tm(r nt4oexomfcildls rlnvo;t)tltrio3tadlmDeai s;t  etrxo iu4al emfvi s)s2ua( pou1aetoii3iat m2ua(vp u0 exnxocoodopDrlivs t)trurxr oy4op nliviasfsDra(m ;u0olx mieildfm2umn s u4areoif ootla r ivs t trtm(rpoodaleelietasfa2rm(roou1tpxoioetldlm2ranmp t4 exnxrctydfm r ivi s0 rurxmpiu4aptnmnvs t  Dururp;u1apto i3iad a rl(vpnt4 eerif3oo1fp elueilt) rumxm3oy1lm n neiat aruaum ;o1tlto fetytfa2ea( s u0 lxoxo tatlpDelueilt srurio oudol   ivils)aDur(ro;u4aptoiiciyt mDeauvsnu)altnxfcoatomD ai il( s2xr(opiu4lleelfcs t  rrmur nu1alx  o3tat a ra( p;u) lxrio3oy1fmD luvi;s s2trxo3iu1am nlfetl( sDrax pno1aeeniicilt m2rmn s;u4texomoctytfpte iei ( seurxm nu1amte nesls)artmx ont0tpt mi3iyt aDel( s u4alxnir3todfp   nvi t)srtrxm3nu1lmeemfvtlt s2tmxrpot4tlenif3ias a2rmu pnu0aetomo oa1fa eanvi ( tetmirpno4amtnlfci t arrr( o;o0oeeomf3iysfa emu o;t4texnmf3oydfaDrluvs;s setmxopio4am nmfciltf 2umxroot1opeoiieild m eau snt0 rtrxf3ia1fpt au ol(0srtoxrpiudomtnmncsls)aDurxmo;u0tlxomieiatfs rm(mp (4tlerxo iytfp r uvo t)t2xm(rpou1omte fes ()aDuaxm ;t1apx  oeiltla eluvo u0altomoctotlaD  i slt sexm(r oy1lptn fet (f 2tax o;o4tetniieiatfmDelums;t) lxrxo oy1op eluvils0srxm(r3iu4lle lneta(faDuaum no0aeeoifctas a2uluvs;u0 rtrirciy1lmDrln s;s0srxoxr3ny1omtnlicsl()a2rmumpnt0alto ietadlsDumumsnu4aetnmr iydfmt anvo s0seurxr ou1lm n fei s srtrx p;u4tpx moctydfaDuluvs;u0 etrir3oydoa  li o;s t2uo(opny1al nlfesl( a2raur nu4apxnmi3iadfm2elnmo (4altrif tadlpDe ieo s0 ruo(rpiu1ame  fetas) rum( oou4tlx if3ilt s2ran sn(4aeerxfcto1lpt  i s s) 2tmir3iydapee fesat  Dra(r ;o4aleo ociad mDeluvs;u4tlxoiocty1op   n s t  rurxopiydapt mfvtl(faDtmx  no1aetnmfciytlmDulnmp u0altoxo3totoaDrlueo;s)s2xmxo nydllenlfesat)s2ra(  nu4aeeniieiltfmDrlnvo;u4artriocty1om elnei (  eto(m oy4al  lict ()aDua(mpno1aeeniicildlmDrauvs u0tltomr iadfmDr ivolt0s2xr(m nu1ome lfvsa(  Dtmumpnu0oeen f3tysfm2uln s u0 eerio3iy1fmt  i i t  2xm(r3oy1amt miciat aDtr(m ou1tpxn fciltfmDulump () ltoircootlmt lu sl( srtrimpoodlp nlfetatf Drrurpnt0aet  octasfaDeanvsnu4aexrxf3oa1oatelies s0srtm(rpoo4opte fcsls  rurx  oo1olxomo3ild a rlnms (0aexomf3tadfmteai o;(0t2tmir ny1ap nmnvi (fs2rmx onu0tpxniieiatlaDrmn s (4tetrmf3ootlptelueolt)setmxr oy4alt lnvil(f rtr(  ;u1aexomoetysfmDumn on(4aetnxfciatlm   n o t t2xm(mpou1ope  netl(faDumxm ;o4tlt  fciadls rl( s;t4 etrmrciytfmtrauei ( s2xoxopnu4amen fcsa()srtau p;t4ope mi3ilsfa2rlnvp u4 rxomo ia1lmDeli sls) rto(opnu1lltelnvt (fsrtmxmooo4altnmocild mDul( snu4alxomf to1omDr uvols  rur(r nudaptelivi t srraumoou4opxo ieiysfa2em(vs t4 rtrio iatlpD  ues;()texr(o3oo1lpt  neil(fsrtm(moot0apxoioeiatfa2emnvp;u) eerir3todomDe i o t0 2toio oodopte fctlt sDrrx p;t0altnmo3iytfa ua( s;t) etoir3iotlmDeanvol(0s2tmiopnodaptnlnctas  2umxmont4altoifeiatfa2rm(ms u4 leoir3iytfp e ivils0teto(mpno1lm nmnvs ()srur(rpnt4tlxomociyt mDean p;(0tetoir3oadfatelieols sexoim3ny4lpenlfetlt  rrrumono4oeenioetysfa eln pnu) rxoxrcoo1lm rlnvs;(0srur(m io4lmtnmicsat)s2tr(root4aetnmo3ildfm ua(msnu4arxomo ty1lmteanei;( seumim3nudol   fei ()aDua(mpot1tle iiciadfa elnmo;u0treomf3oadlpt  i s s s2umxrpoodom nlfvi tf Duaur ;o1alenmf3iltfs rmn p t4aeenif tydopt lnei;t0 2urxrpiy1llt lnctl()aDtm(  ;o0texoiieiltfm rl(vsnt) eerxo3totfmt lnei;()s2umio oudlle  fvt s) Dtau o;o0tlxn i3iadlsDeanvp;t4artrmr oy1fa elivi;()setmio3ou4op nmfvtat aDum(  no1open ociyd aDul(vsnu)aetrirciodoa   ivo t0srur(mpiy4am nlnvi tfs2ra(rpnt4teeomicias sDranvont) eerxfcio1laD anvs;s0s2uoxm ou1lpe  fciasfs2urxmpnu0aptomoctat s rmnmo;u4 eerxfcoodlp  anes;(0 etrio3nudlptnlnes ( aDumxm ;u4tex mfctydla2uaums t)artoxo oydfpDrlies;()s2xoxr3oo4lptnmivt ()a2tr(  nt4altnmfctlt sDranvsn(4altnxrcia1lm raues (0t2uoir iydlle mics t)aDrmxmp;u4tptnifciysfm um(vp t0trxnircoodfa raies ()t2xm(m3iu4ll elncslsfaDum( p;t1tptoio3iyd mDel( p t4trtnxfcto1fatraivo (0truoxm nydllenmnes () 2rm(m nt0alxo oeiyd aDel(mp;u0texnmo3tytla  livs t srurio oodlm e nei sf Dtrx  ;t1tpxoii3iatla2umn s;t) ltnif3iydfaDrlu i s0 2to(r oo1lm  mfvtls s2taxrp;o1oexniieilt sDuanms () rxrxr3oy1la eln s t  euoim iy4ol elnvt (  rtaur ;o4oexn oeiydlsDelump;()artoio oo1fp ean s;s0 2toim iy4lmtnlnvta( sDrrxrpno0aeenio3iytlm2emnmsn()tlenxr3oydoa e ivilt0srtrxm iudolt  fctatf rra(m nt4alxn o3iasfs ulnvp ()teeoifciadla eluei () euoxm3no1lpenlfvi ()sDrmuronu1tpenii3iytls2um(ms;t) lxnxo oo1lmDeln o;t0t2urxrpio1lp e fctl(fa2tr(mpnu4tlen ieiltla2rau o u4tlermfctodlate i o t0trto(o oo4apt lnesl()a2rauronu4aleo o3iydfa2raumont4alxoxf3tytlpDelues s trtoxo iy1lpte fcias a2urx  ou1olx iictlsfsDrm(mo;u0 rxrir3to1om raivsl(0 rtrxr iudopte nci s srumurp;u4aptomoctlsls2ea(mon()treoxr ootoatelnvo (0setrxm nu1lmeemnvta(fa2rr(rp;t1alxo oeiltfm uanms;u0areoxo iotfatrluvo;(  2umim oo4llt  ictat) rrau  ;u0tpen ocilt sDum( o;u)tlxrif3to1optranei t) rtmxo3io4lptemfetat)sDraxmpnt0aptoifetadlm rl( p;()tlxomr3tydlpDe n i t) 2umxm3nydll  mncsl(fs2tr(r no1aet ioeilt mDuluvs t) lerif ty1faDelnvsl() etrio3oydamenlncias s2rmurpot0tlt mi3iyt s2rlump;()trermocoa1faD  nvi s  etoxm ou1lltnliesas  rtmx o;t0opxnmfcilsfm2um(vont)trtomfctatoaDr uvo;()teuoxr3nu4aptnmnct s a2rrxmp;o0apxnif3iasfaDrmnvp;t)aeerif3oytlm   nes;t  2uoiopnudopenmfvslt)a2ta(ronu0tptoioetlsfmDra(mon()tlxoif to1fatraieo t) 2xo(r3ny1op elfeilt)artr(r ;t0olenii3iys m2rmu pnt0tlxrmr ty1oaDe ivi t0 2urim3oydolt  fcslsfsrrrurp;o0tetnmiciydfm2eln on()teenmr3todomt  u i ()srumxr oy4amenlncsl(f rrru poo1oexo ociydls rmu o (4arenxo3iydlptrauvs s)t2xoimpoudape  ietl(f 2raxmpou4oeenmo3iytfs raumo;t)altomr oatomDe n o;s teuoxm3nodllen fvt tf 2tmu  nu1tptnmociasls2emnvp;(4 lxoxrciotlp r ueo;s0trxrxo oydol elncilt) Drm(rpoo4apx mi3tatlmDumuvs t0tlxrxfciotfpt  i ols texoxmpoydal emicia(fsDuaurpoo1ale  oetyslaDuanvsn(0aetrmo oadla  aivols)sexrxo ou4lptnmneta(farum( o;o4tle mi3iadla2ra(vpnt0aexrmr3oatoptrlnvol( t2umxo nu4opt mivsasfs2rm(rp;t4optomociltfsDelumont4trxrif iotlpDr u ilt) eurxm nodomtelicils sDum( pot0ape iieild m uan o t4 lxrxf iydlmt  nvs;t) rtmxo iy1ol  lneta( srumurp;o1opx  fctydls ean p;t4trerxo iytlat  ieo;s t2trxo3io1ameelici ( aDrm(rpou0optomoctlt m2emumo t0 reoxr iydfpDelivs;s)t2urxm3ny4olte neiatf rtru ooo0apxniieiad sDraumo;t) eenmrcty1lpDe nei;t0tetmxrpoy1olenmncslsfaDum(r nt4aet mf3iat s rm( pnt0 rxomrctadom rau s;()teto(r3nu4amtnmfvsa( s2urxrpnt1apxomiciadfa um( on(0 ltomf3todomDe ieo;()s2xmxm oy1llen ncslsfa2trxmoou4tleomoetldls2eanmo u4alenir iydlmte i o (0t2tmxr3iu1lpe  nes s)s2trxrp;o0tpx ii3tlsfm ulu snt4 renio3iytlp eauvilt s2tm(opno1lltnmietltfaruaurpou4tpx ioeiyt m em(mo;t)aeerxocoy1opDrlues;s)srxm(o oo4ol nlncsls srrmxm ot1opx mi3iad sDeaumsn(0 ltnmo3totfptrlueo ( trxo(m3oudlle mnci (f rua(m ot0oexo feild aDeluvsnt) rtrmr3iy1opDrli i;t0 rtoxm3iu1lmtelfviat) 2ta(mpnu4opxn fciatfa ulnmonu)tleomo ia1op eanvsls)trtmxopnu4olee fvilt s2rrx pnt0apxn octldfs2emnmsn(0aeerxfcoydfptranvi t t2xoxrpiy4llenlnvt s  rtruroot0teto i3iyd s umu snt0arenioctotopDelu sls) etmim3iu1olenlneia() 2rrxro;o4oltn ocildlaDrm( s t0altoxr iotlaDeaivs;(0 rxo(m3io4amtelivt ( a2tr( pnu1tetomociad sDranvo u0altrmo3iy1oaDrauvo () 2umiopnu4oltnmfctlt s2um(  nt0alenmoeiytfs ean s t)altrif3totlm   i s;t)trxrxm3iudomeelict s s2umx  ou0tptn fciatfm ua( pnu) rerifcoatomteauvo;t setmxmpiu1oltnlivsls)srrrurpno0oex io3tldla2elnms (4tleoxf iytlmDelivi;s srxo(mpoodopt mici ( srua(r nu1oetnmf3ilsfsDelumo t4artoxo iy1late i sls seurio iudlp emfvilsfa2tmu  oo0olenmictas a2uln p t4 rerxrcta1oa  livsls0seur(m iu4ll  lieslsf rurxmp;o4aee moeiasfsDemn pnt)aexoirciodfp  aieols)setoir3oy4op nmict s  2rrx  no4tpe if3tydfaDemuvs;u4 reoircootlmtrlu i s) etrim3nu1olenmnctlt s2rr( p;u4aptn f3iytlaDrm( s t4 etnmrcio1omD ai s t  rxrio3nu1aptelivil(  Dtmum nt4texnif3iyd m uanvo u4 etnircoytopDr uesl( trtm(opoudlm  lncs ()s2urx pnt0olto o3iydfa rmn o u0arxnir oytomt  u i ()s2uo(o nu4apenmnet s  Drm(mpnt1tpeo fetyslmDelumsnu)tetnio todfaD anvo;( s2uo(mpoudamtelncta(fa2ua(mpot4altoiociyd m ulnmpnt0tlxnmo tatfmD aueslt)t2toimpou1ol nlncsa(fa2uaur ;o0oltn iciyd sDeanmo;t) rtomo oy1fmDe u i;(  etrxopnudlptelicsls  2tr(mp;t1olt mfeiydfsDemnvp;u4artoxr ia1lateanvols)trtrxo3nydoltn ieilt  rtmurpou4oeto oetld a eau pnu)trxnxo3oo1op  ln sl() eurxr3iodam elneias sDtaxroou0tex iietatfsDel(vs;u)alerir oydoatr ueilt)tetoxm oy4aptnlnvslt  2raum nu4opx  oeiyt m ra(mp;()trxoiocoy1lm  anvi s s2urio oy1ll   fet sfs2trxm no4aetnmo3ilsfmDem(mpnt)alerir3oy1faD ln o t s2ur(r3nu1openmnet ( a2rr(mp;t4opxn o3tldfm ran p;(0texrmf3tadomDrauvi;s sexmio oodlmenmfetat  rtm(r no0tptoifetlt a emnvs u4alenxr iatoatrai s () 2xrxo iydllt lfvtlsf Drrxm ou1oex iociasfaDrlu on(4trxnxf io1latrlnvilt srtmir3oy1amenmfei tfaDrr(mo;o4oetniieiyd m rm(mo t) rxoxo iadfm e ieslt0srxrxopno1lpt  fcilt a2ua(mp;o0aee iocild sDelnms u4 ltnio3iadfpD  i o;(  2xo(mpno1ole mfcs t  2ururpno1aex if3tysfm2emnvo (0 lerxf3iotoate ivols0 rxrxr iu1lpt mnvtltf Dtmx poo1apxnio3ilsla emums;() ltnxr3oa1oa e nvols0trxo(r3oudam e icil()srrmxmono4texnmi3iad s eaumo;(0 eenxr oatlatranei s0sexm(m3nu1op  lfvtl() 2tru p;t1tlxnifetas a rmu s t4alxrxocoa1opteau s;s texoirpoydal nlnei sf 2tr(r no1ale ii3tldlm2em(vs u)alxrmfcoodfaD auvs s)sexoio ny4lp  mnei s)a2rr(moot1alt  ociadlsDua( sn()aexrmf3io1op e uei;() etmim3iy4al nlfcs t s2um(rpnt0olenioeiad aDem( o;t4aexnmo tydla  aies;s) rxoirpiu1lmtn neta( a2trurono0tlxoif3iytla2elnvo t4 etoirciytom  luvilt) exm(m nodope lfvt ()s2umumo;t1teeoifciaslm emn onu0areriocootfa raies;t0 2uoxr ou1lmeemfeta(fa2ta(mp;u1ope mi3ilslmDrau p;t)trtrir3to1om   ueslt0 etmxm3nu4ll n nctls  Dtaumo;o1oeeomf3tlsfmDelumont4alerif3ty1oaDr neo;( s2to(r3ny4amt  ncslt)artr(r ou1aexnmfcilt a ea( s (4aeeoir iadfmteaiei;t0trxmimpnu1om n fei s)arta(r ou1tetomi3ils aDranmsnt) eermo3iatlateaneols srumio oydoptnmnvia()a2trurono4oexnif3iydfs rluvs ()tetrxrciadfaD lnvs;( t2umio nudlpenmnci t  2ua(r nu0tpe  fciadla2uanvp u4 rtriocoatfmt lnvils0t2umxo io4apeemivi s) 2rrur no0oleo ieilsfa2ranmpnu4 lenxociodlpteauei s0 rtrxopnudolenmfviatfaDuau poo1tpto fciyd sDrm(ms;t0aeerxrctotfmD aivils)t2ur(o3ou1aptelfet s arta(mp;o4ale mf3tysfsDelnms;(0arenmo3totfa r uvo;t0texmimpiu1lp emicsa() rrax ont1oexn feildfm raumont4 exomf3ty1la eaues s)srxo(o iy4lp nlnvslsfsDuaxmoou1ale mictyt m ul(mo t4aeeomrcoa1lptr ueils) rxmir3nydapen net ()arrrumpno4apt ifciatfm uln s u)aleoiocty1op eauvi t  2xmio no4lltelics () Drauroou4oltniicilt aDemums t) lxomo3tadop   u sl(  exmim3iudolen neils aDurxrpot0optomfciltfmDranvon()aeeoxr tadop   n il(  rtoir3iydape  nvil(  2uaxmonu0olx mictys m ul(vonu0 rxoxociy1la   u s t  rtmxm3iy4op   netasfa2rmumpoo1alen octas aDeau p t) exrxfcta1lm ranei s  2xoir iudam e iet t  2rmx  oo1olxoifctlt sDrm(vont)aeenmoctadop raneolt  eum(rpny1aptelnet sf Dtax p;o1olenmiciadlm2umuvon(4tltoif3todfp e u o;(  2triopno1am nlfvt s)sDuaurp;u4tee  oetls s2rm(vp;t) eeoxo3todoaDranvols seto(m3ou4altnmnct t  rrmx pnt4tetomictas a2ul(mpn(0arxoxr3totoatr i i;t0t2toxr nu4olte nvil(f 2tm(rpnt1olto o3tldfm em(vp;t0tetomr iodfpDranvi ( teuoxr3oo1lptemictat arum(rpnt1optn fciaslmDulnmp (0 reoif ta1lmDr u s ( srxm(r ny1aptelivtas aDtrxront4opxnmi3iysls2eanvsnt4tlxoxo tatomte uvsl(0srtm(opoo1apenmfcsls) 2tru o;u0tpx  oetysfm2ulums;u)tltnio tydop  aivslt0seurir iudoptelneta(fsrurxro;t0aet ifcildlmDeaumsnt4altrmf3iytlaDrauvo;(0tetrir oo4ol emnct tf rumurp;u0aet ioctadfmDrl(vo;u4texrxrctydlatr i i;s  2tm(m ny1omtnmfci t aDtr(ront1ape ifcilslaDulumo;t4tlxoxr3oodomt au sl(0tetrxo3oudaltnmivi t)aDrrxmoot4opxnmoetaslm2eanvon()alxniocootlaD  i o;t  etmxm3ou4lpee ncs t  rtru  ot0oltoifeildlm el(vp (4 exnmrcoadfateaieo t0s2trimpiudomtelietl(faDrm(root1olx moeiad sDem(msn(4 lxrmfctodfaDrln o s tetmxopiu1am  lnvt tf rurumo;t0opeo o3tyt m2uauvp;() eenir3ty1fpDean i;s0trumim oo4om nlictat) 2rrum ;o4tlt  fetytlm em(vp;(4 leoio oydlaD ai o;()srto(o3ou4optnmivs ()s2rmurono0tee ii3iyt s2um(vo ()tetomrcia1fa  lueo s  exmio iu1omenmict s  Dta(r ;u0teenmoeildlmDulumo;t4 ltrir iotlaDrlivo () rxrxo3oo4lptnlfvsat)sDtmxmono4oeen i3iys s eauvp u) rxomr3oadfp eaneilt)t2toiopiu1omtemfctat)aDuaxrpnt1tpx moeias sDea( s (0tlxomfcty1lateluei (  2xrxm ou1lpe  fvsas aDtaur nt1apeoif3tasfm uluvo;u) renmo3iy1fa eanvs (  rtrio ou4amen ncs ( arrmx o;t0altomiciat mDua(mp u4teenxfcoodfm e i ilt tetoio iu1op nmnct (  rrm(  ;u1tpto feiydla2em( p;t)aleomf3tydfm  ai o t) 2uoxo3no4alte ivtl( a2trumpou0alx ifetyd sDemumo;u0alerif3tatlpD lu ils)texrxm iu4lpt mfvt (faDtauroot1tlx moeild sDrl(ms () exoxf iy1op rauvi s0sexm(o iydlmtnmfvt t) Duax ont4apt ii3tatlsDeanvp;t0trermf3tytomt lnes ()setoxo oodomtelfct s  Draxmp;t4aetnii3tys aDra( p;u) renmf tadfmD liei;s)t2urio3no1lm emfvsas sDrm(rp;o1altoioeiadfa2uaumon(0aeeoxo oodlpt auvolt)s2tm(opiydoltelfcil()srtmxr ot0oee  fctadlsDua( s;t)trxnmr3iatlm eli sl( srtrxr3oy1lptnmfcta( arum(mono0aee ifeiyt m2elums;(4tltomr3iodfm rli sls)teumir3ou1lpe  ivs t)a2ta( p;t1tlxomociyt sDrauvp t0aexrxrciydfpD  i s (0srumxr io4omtelnvta(fs2taxmooo4alt miciatls ua( s;t)aexnxf ia1lmDr nvilt0teurxo3iudope livt tfa2tmu  no4tle iietatla2uaumo;t0 lerxrcoytla rlivi;t0t2uoir ou4op emnei s s2raump;u0oee moeiytfm ul( pn(4aexomrcootlm elivsls) 2trim3ny4llt  nvta( a2umu  nt0aetnio3iatfsDel(vp (0artnmrctotopDrli o s0trto(mpoy4lltn nctas srrrumpot0aleomf3tytlmDulums;() etnxo3oytlm  ai i;s)t2to(rpnydlltnlncta(f 2tauro;u0olxn ieils m rmnms;u4trtrifcoatlaDelivi;t) exo(m oo4apeelnvs t sDtrx o;t4tpx mo3tld a emumsnu) rxrxfciotomtrai slt)seurxm iy4apenliei sfsrtrumonu4alx mfeiydfm um(vo ()tltrxo tytopDeaivols srtmir3nodopeelnci t)srur(root0aee  octatlm ulu p u4 reoxf3tydfmD lu il(0srtrxo3oy1lpen icsls s2umxmpoo4opxomfcildfm2um( snu)alenmf3iadfpD ai i () 2uoim io4lltemneia()srtmxmpno0tpeoioeiatlm ra( o t4tlxoxf3iatlp eauvs t0srxrxr iy4ale lfet sf rur(rpnu0aptn iciatla rm( on(4trtomfcoodlp r i s s0t2trxrpny1omt mfvi ()sruaxr ;o1tptomi3ildls2rl( o;u0tlxnir ia1fp eaieils s2urxmpou4om emncs () 2uaumooo0olen ociadlsDrl( ont)areoirciy1op elu s;t0 rur(r3io4lmtelfcslsf rumxrpnu1texomoeiys aDrmump (0 ltoifciytoptr neo t0 2trxr oy4lle mncs ()s2tr(mpou0oetnmfeilsla rln o t4trxomf3oytlaDelues;s0trxmiopoo1lmenmfetl( a2um(m ;u1aptnmiciydlaDrln ont0 lerif tatopDraivsls  exrxr oudllenlnetat)srrm(rooo4aeenmieiytfsDrlumo;t4aetnmo3ia1op rlnvi;()sexmxrpiudop emfesa()sDtau  nu0aexo feiadlmDuau onu) eerio oydlmD lnvo t s2uo(r3oodoltemnvs s)s2tmumo;o0tpen o3iytla ra(vsnu)tltoxo to1oa   uei;t0t2xoim oy1amenlnesl() Dum(  no0apxnii3iltls uau s t0 etomo ia1fmtr ivi t0 ruoxrpiodlpe lieil()arrrxr ot0altnmoctydfm2emumpn(4tlermfcoatlm eanvo;t s2tr(m oydopte fcsl(fsrraumoou1tpenifeiadfs2emu snu4 exriociotfmDeluvs t) etrio oodome mnes t arraum oo0tpxo ictytla rlnmo;u0 eeoxo oydlmtrlivols0 exm(m oy4ame  fvtatf Durx o;o1texn ictytfsDrm(vo;t) rtnxo3iydfat  i i;(0seurimpiydomtelncsa(fa2tmx pnu4tlt  ieiytfs2eln ont4teeoio3iydom ean o s)teur(r io4ll   nctas  2tmu p;t1optniicildfa uanmp u4tlerxf iytop  aueo;t) ruoxopno4ole mfeta()s2uaxr ot4apx  i3ils s ulump;u4 lermo3oadoaDr ieols0 2urir nydom   netls  2tau  nu1oleo i3iatfaDumump u0trxoif oatlateluvo s  2urim3io4omenlfei t)aDtmx  nu0tltnmo3iadlm ua(msnt0tltrmr ia1faDeanei;s sexmiopiudal  lfeia() 2tm(r ou0tlxn ieilt mDrauvs t0 lxnxr3todop r nvsls  eumxo3oodlmt  feia(faDra(rpno1texoiicildlm2rln on()texnio3oydfm  au o;s0texrimpoo1ol e ivt t)a2uru ont4alxomiciadfa rmumsnu0 ltniocoa1lmDelu sls0t2trirpnu4lp e icil()srtrurpnu1tpxomfeiyd m em(vsn(4 exomr3oodlp e neol( sruo(mpoo4ape  nctl()a2tax ooo0opxomf3tltfm2ean s (0tetnio3todfm rlu o;(  exrxm3oy4omee ncsas)s2rmu onu4tltomo3tldfmDean onu4tlenxf ia1fatr nvslt0tetoxopiydlmt liesa(fsDtrxm ;t4olen i3iyd s2rluvo u0alxnxo3oy1opDeaieol()seumxmpny1lpte fvil(  rra(ronu1tpeoif3iys a2rau o;t4 exnxo iodfp rauvi ( t2tmirpiodame  ies sfa2trx oou4tee mi3iatfm2ranms t0 reoiocootfp  auvs t  ruoxo no4lme mici s) Duaumpno1apen oeils a2elump t4 lxoif tatlmDrauei t  rxm(o ny4apee ies (  Drmxrp;o4ape  fciysfa2ea( s;(0altrir iodlm ean i s trxr(o3ou4apte ietat  2rmxrpnu1oleo f3tydfmDuaumon(4 eenxrcoadlatran olt0srxmxopiy1ape  ivt tf rrau  oo1apxoii3tatfm ul(vonu0 rtrmfciydoatran o s)trtoxm3no1op  lieil( sDtr(r ot0tleomieiaslaDulump;u) etomo3ootfm e n o t)tetr(m oodol n neia( aDur(  ;u0tlt mieiasfa2ua(vp t0aeeomf ty1faD ln o s texm(opoy1lmte fct ( sDua(  oo1oleo ociyt m ra(vp;t) lxnxf oydfa  lnvi ()srurxr3oy4lm e fes tfsrtm( pou0ole mfetydlsDelump;t0alxrio3oytopDelnvilt0trxrimpou4lp nmfcilt)a2uax oou1tltoif3tltfa2umnmp (4 reomf iatlpt aivs s0s2urxmpny4omtnmict sfarta(rpnu0apeo i3tysfm uauvs;t0alxoif totomt aueol(0texmio3oo1ame miesa( sDrax p;t4oexo ietlsla uau o;t)aexnmo iodopDrln i () 2xo(opnu4op n fet (f 2tm(  ou4tetnio3iltla rmnmp u4trerxfctatfa   ieols)setrim3oo1lpt  fetl( s2urxmono4tpxnmoeiysfs2rau s;u0tlenio iatfp rli i;t srtrim oy1ll  mfvslt)aDuaur oo0olt  f3tasla ranmpn(0 exnxf iy1fptrai ols)s2umxmpio1am nmnes sfarraxr oo4aeeo fciydlm2emuvpnu4aeeomocootlm rlueol(0trtoir io1lmee nvia(fs2rrxm ;u0olen f3tydfm rlums u0alxrxf totlmDrli ol(0 rtmxr3oo1lp n ieil(fa2ur(r ot0alxomictldfm2elu snu0 eenmo ta1fp rau i ()teurim iy4omee nct tfs2trx o;t1olxnmieiyd aDul( p t4trenxo3iadfa  lnesls0srurxmpno4lpee ivilt)aruaurpot1ope mi3iytfa2uaums t0tlxoxo io1lm eai o () etoxo3oy1opte nvs sfaDraxmoot1aetoio3iydfa rmuvp u4aetrif3todfpteluvs t0s2xrxmpoudlmtelfcsls aDtru ooo0alxn feils mDrluvpnt0 eenmf3iatfa eau o s s2xmio ny4am  lfvi ()s2rrxrono1tlxnif3iadfaDrmuvo;t)trerir iy1fa  lnvo s0 eurxr3iy1amtelnciasfaDrr(mo;t1tptn i3iydfa rmnvo t4aleoio oo1op r neil() rur(o3iy1op   net (  Dtmu  ou1texnmieias aDum(mp;u4trtnmr ta1lm eluvi s  eurxm iu1aleemneta()arumx  ;u1aeeoif3iaslsDrln s;() rxomo ty1om   n i s0 2xrxopiu4apee ietlsfa2ua(mpno1olxnii3ilslm ranvs;u0 etoif3io1fate u ol()t2tmxopnydopt lnvtlt  2umxrpnu1aptn ociyd s elu on(4 etrifciy1fp  aues s trxmim3nudomtnliei (fa2taxmpnu4aexnmicilt s2ranmsn(4tlenxo3iydfaDean ols0teum(opny4ol   ncilt)srta(r ou1altnifctys m uau s t4treoiociodfateaies;t)sexmim iy4lpeelfetl(  2rmxmp;u4tetn oeias a2umnmp;u) rtniocia1fat ln i;s) 2urim3no1al nlivtas srtm(rp;o0aetn ieiatfs2uan o;t4 rtrxfcoydlpD liei s0t2xmxo iu4omt mfetlsfs2umump;t1tlt mfeiys a umn snt)aexnxocto1lp eaiei;t)s2urxr3ny4lme lfvs t aDtmxrpnt0olx  f3iltfmDrmu s;(0treomr3totfat liei;t0 rtmxmpiydlmee ivtltfsrtrxrpoo4apxnioeiad s emnvon(0artoxrcoodfptrlnvi;t0seto(r nudlp  mnvt sfa2uaxmono0opxnmf3iysfm2uanvs;(4texoif totfp ran i;t0s2umxo nu1am  mnesls artmxrono1aetniieilt m emn o u) rxnxr3oa1opDran s t0t2umxm3iy4ome lnesls) rtmu ont4ope  feiadlm2rmn p;t0trenxo ia1fpDr iesl(0s2trxm no1amte ivs ()srur( pou0apt  fciatlm em( p;t4alxrio oatfp eln i s teumxr3iu4altnmfetlsfaDrax o;t4tlt  f3iydfm2rluvonu0trtrxf iy1lm rlnvs;s)texmir oy1ope licil(f Dum(mo;t0tlx  iciadfm emuvo t4trxrmo oytfaDeaiei;s) 2tmimpio4olee ivs s artrxm nu4aexnmi3ias mDum( p;()trtnxocto1lm r i s;t truo(o3io4apte nciasfsrrr(rpnt1apenioetltlsDuanvo u)alerio iadoateaneo;t t2tm(o no4apte fcslt  2tr(mpnt1tet mi3iys m2eanmo t0tlxnio3oa1lpt an o;(  2trxm io1alen nvta( arrmxronu4aeeo oeiys sDrlu p;u0 etoxr3oadfp eai il()sexm(mpoo1am emivi tfsDrru pot4tle  o3ildlm2ranms;(4trtoxf3to1faDeaieols0 2xr(o oodoltnlfvsl()sDrmxrooo1optomoeiltfmDua(msn(4 ltoxr3oa1fatrlneil()trxmxm ny4omt  fciat)srrrurp;u4oex ioetlt s2eluvp;u) rtrmo3oytfat  n ils)sexoxopoo1olee iesls aDurxr nu0aet  iciatfs rlnvo;(4trtrxfcoodopt livs t sexr(r iy4lme  nciasf rurx pot1texnioctls s2emuvo;(4aexomf ia1op  au o s0 etrxr nu4oltnmfvsasfs2rr(  ;t0apto fctydfa2rm(mp;u)trtnio oo1fpte neols0 etm(o iu1lp emfvsa( aruru onu4aee  f3iad sDuau snu)alxoio3iy1fa rlnvo ()srxr(r io4op emfci s)aDtmur nt4alxomoetas sDumnvs u4aleoifcoadoaD  n s;s)t2tmim3iu1llt  nciatfarrru p;u4ale  oetyt s ul(vs (4teeoxo3ia1oat aues (0 exmxm oo1om emnci () rtax  oo0oexnifciysfaDrm(vo t4aeermo iytomtelivi (0 euoxo3oydlme lnci t) rtm(m oo4tlenioeiasfmDelnvsnu0 etrxo3iatfa eai i (0 eto(r nydaltnmncta()s2tax  ;o4ape mieils aDrluvs u)trenmo3iadfa  aneo s t2um(m3iu4op  lfeil(f Drrum ;t1alxn i3iad m rlnvo;u4 exnxr3iodomtrli i ()t2xmxm iy4ole liet () Draurpnt4altnioctyd s umnms;t) ltnxr3to1lmtrlu s () 2xmir iodaltemfetl( srtaxrpno0altnmi3tldla2um(msnu4trenif3iotfm rlu o ( trumxo3iy1al nmnvt (farur(mp;o4apx ioeiatfs elump u)areomrcia1lpDr n i;t)s2urxopoudale lncslsf 2ra(ro;t1oee  oeiat sDua(vs t0tlxrmo oatlpte neo (0t2xo(rpoydlmt licil(f Drrxrpou4tpx mfctydfm elu s;u4trxoxo ootlate nvs ()tetrxr ny1ap  mnvs s)sDum(r nu4ole  ocils sDuanvs u0areomfctatopte n s t0s2xo(m io1ameemics s aDrrxmp;t0alt ii3ild sDuanvpnt4 renircio1la rlueo ( trxoxmpio1op elnvt t)s2raumonu0ale mfeildfmDuln onu0tetoir oo1fate uvi t srxrxrpno4optelfesas)arrrump;o1ole  ietld aDrluvs t4 eerircootlaDeli o s0seto(o3iy4omt  ieslt  2ra(m oo4tee ioeiltls rl(mp u)tleomr to1om r ieo t) 2tm(r iu4ap  mict ( sDrr(  no1apt ioeilsfa2umnmont)texrmfcoo1faDeauei;()texmxrpnudll n nesl(fa2tmu  ;t1tleoiociadfa uan s;u4 etniocootom r n sl( trxoxm3oo1lm  lfctat  rtmx ooo0texo fctydla umnvo;u0altoxo3oatfpte uvols0trxmxmpiy4ll   nei s) Dur(ronu4oexn fcildla2ran on()aexnmf iy1oaDr n sl(0tetoio3iodlm  lieiat) Draurono4olt if3iasfm2elumpnt)aeenmr iadopt aiesls truo(m3iu1am emictlsfsrtmxm nu1olxoio3tadfs uanvsnu0aetrmf tadfp r ies;t0 exr(rpou1omeemnvtlt  Dra(mp;t0alx  i3iatfm umnvo;(0trtnir3iatfp eai ols trxmir3no1omenlnvtas)aDumxmo;t4alx io3tldfmDelu on(0arermr io1oaDe uvo;s)srxoxopnodlp nlics () Draumpnt0alx mfcildlm elnvpnt4trtrmf3oa1omtr ueo t0teum(m3iy1lm emiei s)sDrmx  ;o4aleomf3iatfm rlnmo t0trxoxf3todoatelnvi s)teurxr nu1amee ncsat)aDraur nt4tlxnio3iasfa2ra(vs t0altrxocootoaDeanvols0 euo(o3io1omtemicsa(f rraurp;t1apeoioetadla2rluvsnt4aexniocoo1faD  uvs ( sexmxmpoy4lptnmncsls  2uau o;u4tlxnmoeiysfa rmnms;t4 exrmr3tytfatr uvi ()s2tmim oudape mies sfartau oou0apx mictydls emu ont0 leoif3todoaDr ivsl() 2umxmpnudlle lfesat)s2rau p;t0tltn f3tas aDulnvo u0tltnmr3to1op e ieo;s  euoirpoydaltemiesa(f rurxront1tle  icils s2ulu p;t4 rtnmfcootlmDrlivo s)srtmir oo4op nmivi t)sDuaxr nu4opxo feilt a2rln o u4trtnio3totlmtr ivs ()srtoio oydlp  mfctas  rum(  ;o4tet iociaslmDuau o t0aexrir3oytlaD aieil( trxmio3oodlme  ivtas) Dtmx pou4aetn f3iytla emuvp;u4arerxf3iodoatrlieils0 ruoim iy1lm  lfcs t s2trumpot4ale mieiyt m2em(vs (0trxrmfciodlm  aues () 2xo(m3no1ap emicilt)srrrxmpnu4tlx ioeiytla2eln s u4 eerifctatop raneil(  etr(m iu1ol n fvsl(fa2uaxr ;u1opt mo3tld sDrm(vo t0tltoxo to1omDr nvi ( setm(o ny1om n ics s arrmum nt1tpe iietlt s2umn pn()aeerioctytlmDeluei;( trtm(opnydllenmietlt a2tr(mp;o1opeomiciytls rlump u0texnxf tatomte ueol(  2xo(o iydoptn fvi t  Dtru ont4apxoio3tydlmDul(vp u0 reoifcoodlatelneslt)trur(r3oydolte ivsa( aDtruro;u0tpen octasfm eau ont0areoif tydopD  nei;( trtmiopnu4op e fetl(  2ur(rpoo1apxoif3iytfm2emu s (4 rxnir iy1la raieo;s trtm(m nydlmte nvi ()sDum(rpnt4texnifciltla em( o t0 rtoxf tadopt  nvol() 2tr(m3oydol nmncslsfa2um(monu1aee  feilslmDuau s u0aeerxr to1fp rlueils0 ruo(rpoudam e ivtat) 2uru pnt0aexnmietytfa2um( s t4tetrxf iytfpDe ivo t trtoimpiy4lm n iet s)arta(r ;t0oeeo f3iydla2rmu o;u4teenmrctydoaDe i o s) 2xm(opou4llt  ncta( srrrx  oo0aptnmoeias m2rmuvp;u)tlxrir oy1oatrluei t)srxoio3oydale  nct t s2rr(m ;o4ole mo3ias a2elnvp u) renxo3io1lpt lu olt0srurxr oydap nlnct ( sDurumo;u0olto iciadfa em(vp (0 lxnxfcio1fatranes;( srtoxo iodam nlnctltfs2rrur ;u0oex moctys sDum( s;t) ltrir3tydlaDrlieo s s2toio3iy4altn nctlsf rrrx ooo4opxo f3ild m2elu pnu4tleoxo3oo1lat ai i;t0setmir3no1open ncslsfaDra(mo;o0aleo oeildlmDumnmonu) lermo3oydoptraivo;( trum(o3nodopt mnvi () rua(mp;u0apxnmfeils m eaumpnt0 eeoxfcia1la eln olt0s2toxm3nydap nmfcs s s2uaxmpnt1aetoif3taslm2ulu p u4 rtoxo3iytfmD an s;()srur(m oy1apeemfcsls)a2rau p;u4aex  ociad s2rlu p;u0 rerxf to1omtelies t0 ruoir iy1omtnmivslt a2tmuro;u4tltn feiadla2um(vp t4alerxo iotomDelueilt tetoim ou4op   net (fa2uaumpnt0olxn oetytls uan p;(0 exrmo3iy1oaDeanvsls srur(r iu1am nmiei sfs2ta(mp;u4aex iocildlm ranvo;u)tlerxr3iodlat  i o s teurio3ou4omtnlfvt tf Dumxrono0apeomfciatfa2rmu s;(4 leomo iotfp eanei;t trur(m3oydam  mnesls) 2rrurpnu4oet ifcilt m2umn o;u0alxrxocoa1lptelu s;t  rtm(o nu1llen iet t a2raxmpnu0tetnmi3ildfm2ul(vpn(4alenxr3iadlaDeanvol() exmxm3iudlltelfeta(farurx p;o4olxnmieilsfm2rl(msnu4tltnmo tytlp e ueo ()setrirpno1olen ies s)a2rrum ;o1oeeo f3ias a emnvs;(0arerxf3iatfa   nvo t)setr(opnu4ap  mfvils aDtax onu4tlenifciasla2emuvs u4alxrif3tytfp  lnvo;s0t2uoim3io4omtnmict t)aruaxrpou1aex  octasls ua(mon(0 lenxo3tydlp   i o;t)s2tmio oo4optemneias)srtmx  oo4opx io3iasfaDra(ms;u)tleoxo todopD li i t seum(r iu1lpt mnvtat a2uaurpnt1tpxomoeiad m2ranvp () rxrirctodla   u sls t2xo(opiydaptnmivtls)arrm(r no0alx ii3tad sDrlnmo u0teenxocoo1lmt liei t sexo(r nudal   fvsat) Duaxmo;t0opxn o3ilsfs2emuvonu4tetoio3to1fa eaivo;s  2uoirpoy4alt lnvils s2uaxrpot1optomictldfa2rlump;u4aexoxrciatfpDelivo ( srurxr3iy1olenlfvsat  2umum no0tpeomociadfs emnmpnu4arxoxf3ta1fm eaues s t2ur(r3no4llt lfes s)sDtru oot4tlt  ocildlsDrlu p t)tleoiocoytfaDeaivols0srum(o oy1opt lnvils)sDum(mont0aptnio3tadlm um( p u4alxnxoctytomD lieo s t2urim3iy1lpenmfvsat s2tr(mo;t1opx ii3iat mDemu pn() lenif3iotfateaieo t0 2tr(rpoy1lmenlieils) 2tmxmp;u1tex mo3iyt m eanvs t4texnmfcoy1omtrauvs t)srto(m3oydlmte fvtls s2tru  ;t4oee moctltfs uauvon(0 lenmo oadfm   ivs s srtmimpnodllt mneils sDurum ;u4tlx mo3iysfs emuvp t0aleoif todfaDelueils s2um(o3nu4am   fcil(fa2ua( ooo4oee mi3iltfaDuau pnu4trxrmf3ootoa rai s;(0 rxrxr3ou1lp  lfet ( s2tr(  ou0aleoiiciys s rmuvp;u)areoifciydfp  li sl(0 rur(o io4lltnmnes (f rua(  ot4aeeomi3ilt a rl(msn()aetomo iodopt  ivolt)srtmio3iu4al  lnesas)a2umur nt1tlx mociatla emuvo t4artoxr3oytom e nei;t) 2xrxrpio1op  mietltfs2ta(r nt0aptoif3iyt s2ra( p t) ltnxf todlpteliei ( srtmir3oy4alt mfvt ()srumumo;t1olx iociatlsDemnms u) exrxrcootop  auei s)tetoxr3iu1om   fvsls) Dtmxmpoo4apeo oeilsls umumonu)trtnxrctodlatraivo;(0s2toxm oo1llte ivias)s2uru pno0apxomf3tldlmDrlu s ()arxnxrcoa1fp rln ilt0 2tr(r iudaptemict t)s2uru pot1oetnii3iadls2raums;u4tltrmfcoy1fatrlnvs ( srto(mpio1ap elncsltfsDumxmooo1optomfeildfs2uluvpnu4artnif oodoa rlu i;t trtoxr nudlmeelfviasfaDrr(mo;u1optnmf3iat s em(vo;t0alxrir3tatop   uesls  ruoxmpio1am nlfetlt  Dtmx  nu0teeoiieiatfa2ulnms u4tleoiocta1oatrai sls t2xrim nodlp elfvi tfarum(rono0tpx  o3tas aDrluvont)trxrxo tydlm rlneils)tetrxo3io1lpe liviltf Drmu p;o1tltomfeiyd a em( s;(4 exrmf3tatlaDr n o;t srxoim3iudomen fes s)srumxro;u0apt mictytfs eanmon(4 ltnmf oydfpteau o;t0 rtmxo3no1ap elncias aDta( p;o1oee mieiat sDuan o;(4 lxoir to1optrauvs;() ruoxmpoo4lmte fetlt)s2raurono4oet  ieiltla el(vp;(4 renmr3iodopDe i i s srtm(m iydolenmfct t) Drm(monu4ope  i3iat s elu s;(0treoifciy1fmDelnvi t tetoxr ou1ol  mfeils)s2tm(rp;o0tptn f3iyt a2ea(vpnt0 renxf3tatlpteaieil(0 ruoxm3iydameelicia(fartmu poo4teenmoeiadfm rln snu0aetoif3tatlp e uvo s0texmir3ou1om elfvi ()s2rrxro;o0tltn ociydfsDrluvonu)trxoifcio1lm eauvsls0truoir iy1alt mnci s sDrrurpnt0tlxomi3tltlm uanvo;(0 eenxr3iydlmte nvo;t)teumir oodol e fei s sDtmxrpnt1aet iietltfm ua( p;(4arxomf3iatfp  livo t)t2uoirpnu4lmt  nvias arrau  ;t4aptnioeiltlmDel(vo (0arenxrctatoatr n o;s)srtr(r3oydop nmnvs sf ruaumpnt4olen ieilt mDem(vo;t)trtrircoytlmDrlies s)s2xrir oydal elfvtas sDraum nt1apxomi3iysla2ea(vs u) ltrifciadfa r uvo;t) 2xo(r iu4ope mietls arur(moot1altnioetatfmDrlnmp;() etrxr3oatlp r iei s)trxm(r oo4alt  nvslt) 2uau pnt4tpeomociat a raums () exomoctatoptelies;()srtoimpnu1ap  micils) Drru  oo4teeoii3tytlmDranvo;u4 eenifcoadlptraneils)t2toir iodomenmies ( srrmu o;u1oltn octadfa rln sn(0 exnmrctotfp   u ol()texoio oo1opt mfcs ()sDrrur ou0aee mieiat m ea( snt)teerir oadlpD luei s  2urim oy4ape mici (f 2rr(  ;o1ole  fctatfmDelu p;u0 etnif to1fm rlnesls)teurxm3ou4lmte neilt) 2taumpou4teenioeiytls uau p t) ltrxrcoodlp e ueo t srxoim3nu1lle liesat  Dtrur ot4tex mf3ils sDrlnmpn(4artoxo oa1lp  aivi;()sexoir3oo4lpee fcils)srumumo;o1texo f3tysfmDra(ms u)aeerxr iotfmt aivsl(0setoirpnydlpe lfesasf Dumu p;u0olt mo3iytla rl(vs;u0aexoio3ta1fm rln sls)srxoir3nydlm  lfcs sfsDrm(m nt4alenifetatlm uau pn(0 exnmo io1oaD livo;(0 exr(m nydamtelfei () rrrxmo;o1alxoioetldfmDulu pnt)tleoirciy1lat lnei;s s2urirpiy4lpt  fct t  rurxroou4alx  iciadls em(vont4teermo3iy1opDrlnes s teto(r no1alenmfeta(fa2urumo;o4olxomociytla emu o u4aexnio3oodfmtelnvs;t0seurir3oy4ome  fviat) ruru  ;t4teeo fciasfsDumnvp (0artomf3oy1fm r ieo s  2urirpnu1amen icsasfs2tmu pno1oexn iciad mDrauvo t0altnxr3oy1lpte uei t)t2um(r3io1ll nlfesa()arum( oot4tpxnmoetlt aDuln s;t)trxnir ta1la elneo;(  rtm(o io4aptn ncs ( sDtmx  nu0optn ociasfmDrl( ont)trxoxrcoatlmD li s s0tetoxo3nudlm n ivsl( s2urxrp;u0tpeoioeiys a elums;t4trerio3iodop  aieo;s0 2trxo3oudlptemneilt) rrmxr no4tpt iieilsfa2rln snt4aexnir oo1om eaivo (0 rxm(opnu1omt  ieils sDrr(root1aetniociaslaDeln o t0 leomr3tadfa raneo (0 2tmxo no1amenmfetltf 2uaurpnu0apt if3tld sDrl(monu4trxnxo3ootomt au ilt teur(o oy1omee ncslt)a2tauronu0olxoifetasfa eluvp;()altnxo oadlp eaueo t seuo(opnodom nlnes ()arrm(ro;u0tet mo3ild m2rm(vp;u) rxrmr to1oa elu s (  2toir3iu1ope mivs tfaDrr(r ;o0oetn o3ildfsDeluvsnu4 etnxo oatfmt li sls0 rtm(r no4lm elnvt s sruaxm nu1tet io3iydfs2ulnmpnu0trtomfcoy1fmDe u o t)srtrxrpny4lmt micsa()sDum(rpnu4altniociysfs2eln pnu4artnxo iytop elnes;() rto(o3oo1ll n nviat a2urxronu4aee ii3iysfs2rm(mp;u4 etoif to1lp  an s (0truoxr iu4omenlnvt t arraxrpot4ope ii3tltls2ra(vpn(4treniociydfaDrli ols srxoxm3ou4am  lietat)srtm(mpou4ope  ictltla ra(vs;()tetomo tadoatr u i ( texmxrpoodal   iet ()sDrruro;o1oet ioeiytls2uau o (4 eermf iydlpte ivi t0t2xm(o3iy4lp n fcs s s2umx  ;o0apxo fctlt s2ranmp;(0 exoxr oa1lmteanes;t  etoxmpnu1apteliei sf rraxr nt0apx  oeilsfm2rmumo;t0arxrmo totlp eaueo;(0 2uo(mpiudllee ictls aDum(  ;u1tlx  ieiydla eau o;u) ltoiociytomt ln i ( trtrxr iy4ale  nvt ()artrxm ;u4oex  fctys m emnms ()trtomf oa1laDelivils t2tmim3oy4olt  icsa( artaumooo0texo feilt a2rl(ms (4aexoxo3iy1opD an slt0seuoir3iu1alt mnvs s s2raur nt0tptn octyd mDuln s u)trtrxo3tatomD lu s;t0 2xrir3nodaptnlfctas artm(mp;t4olx  iciadfaDuau pnt0artnmo3iodlpD lies;t0s2tr(rpny1ol  lfvt s aDtmumpnu4opt mictyd a2rmnmpnt0 exoio3tadlaDe uvi (  2xrxo3oo1ap  mfeilsf 2uax p;u1alen icias a rluvsnt) rxnxf3oatlpDrauvo;t seumxr3oydop emfesl( srtru poo0olt mfetytfmDranvsn(0texnxf3iadla rlieols trxoim nu4ol nmfvtl()a2um(m ;u1alt moetydla rlnvpn(0 lxoiocta1lpDr i slt s2toxopoy1lmee nvsltf rurxmo;o0apxn fctlt a2uanmo;(4trxomo3tydlpDe nvi;s0trtrxmpoodapte icsa(f Dtr(rpoo1tpxn i3iltfa eanvsnt0tlenxoctytopDelueols0srxo(r iydop emnvsas) 2umxr oo1tptn fetasla umu p;()tetnxocto1la   uesls srumxmpou4lmtemivsa(  rtmurpnt4aex  f3tydlmDea( o;u)trtrmfciotlmtr ieil(0s2toirpoudomtn ivtls sDuaxrooo0altoif3iat aDrmnvo;u0aexrmo iatlpDe n o t)srum(o3iydole  ncs s) 2uaurp;t1tpeoiieiadfsDemnvsnu0tlerxr3oytlaD lneolt  rxm(mpoudll e netl(fsDrm(rpnu0tpto ictlsfm2elums;u)tlerxf3tadopteaivo t)seur(opny4am  lfvias)srua(mpoo1tpe  o3iydlm2ra(vpnu)arenircta1opD aieo;t0trumirpoydlmen ncils a2uaumpnt0oltomiciydfs ua( ont) renmf oytla r u sl()s2xr(r3iydalen ivsasf 2tax  ou1oeeo fctysfa2ran snt4 ltomo tadfa   uvi;() exm(rpoo4apt  fvslt sruauroot0open feiad sDulu s t4tlerxr ta1late i o;()trxmim nodapeelivs ( arrmxmpou4olt  ictld m2rln ont)arermr3iydopteliei;s0seur(o3iy1lme  ivsasfs2umurono0olxomi3ilsfaDem(mo ()altnmf3iodfpDeauvil(0setm(m oydlp   fvi sf rum(ront4apeniicildfsDeanvsnt)aetrir totlpte nvo;()setrxo io1apenmfesltfaDrmx  nu1opxnmi3iys m elums t4 reomr todopteauvilt t2xm(o3ny1op e fcsas  Drrurpnt0teenmicilt m uanvo;t0aexrmf3iotlmDeai slt0tetm(r3oudamtemfcsls)a2urxm nt0tetomfcilt m rl(vo (0 lxrmr iytfm raivs;()texoxrpoudllenlieilt srrau  oo1aleomfeiatlm ean pnt) lxomr3tytomtrai sl(0setm(r3ou1opt mnei s s2umur no0tptnifciltfs ra(vsn(4 etnmfcto1oaDr n slt0setmir nu4opeelfcias sDtrumoot1aet ifciat m uauvonu0arxomo3oy1lpt an o t0srur(m ou1lpenlivi t aDrr(rpnt1ape  i3tydlaDumnmo;t)tlenmfcoo1faDraneo;t)s2uoxo iydopt  fcias aDrrxrooo1opeo oeilslaDranvpnu0arxrmr iy1lptelueslt  2uo(mpno1lp  mfci (f 2rmum oo1oetnifeiatls ua(vp u4 eeoxf3oydfaDelu o;t t2to(o oo4lpenmncta( a2ua(m ot4tpt moeilsfm elu o t)arxnir3tytfp ranei;t0 2tm(r3nydlm emfeilt  rtrur oo0tpeoifciad mDul( on(4 rtomrciydfp rlu ol(0 etr(r3oo4am  mieia() Dumxmp;u1oeen icilt a ea(vp () lxomf iodfmt anvi;t) etrim3iydole mnctl(f rrru  no1tptoio3iaslsDulnmont0altnmfciadfp r i il()t2tr(m no4ape mfeiat)a2uru pno1tlt moeiltlmDranmsnu)tlerif3ia1opteln i;t trxo(rpny4lm nlnvi s  2uaxr nu4ape mociasfaDrmn pn(4aexrmr3iydlp r ivo s)srtriopoydame lieia(fsDuaumo;u1oet mi3iys mDea(vs;(4 rxnxo3ia1fa rlueo;( srurxopnu4opt  fetas)aDrru  ;o0altnmfciydfsDranmpnu0 ltrxf3ta1fp  li s;t)t2ur(m3oo4lmtn icslsfsrururonu4aeto o3tys mDrmn snu0 eermociatfpt anvsl() 2xm(o nodalt miesat) Dtmx o;t1texoifciytla2uanmont4 rtnif tytlmDelnei s  ruoxr ny4lm   nvs t s2urumono0olt ii3ilsfa2ul(ms u4 eeoxf iy1lmtrlivo;t)teuo(r nu1altemfvsa()arur(  ot4optnmietydls2ran ont0tetnio3tydopD lueo;(  eum(r ny4ap  mfvi t)a2rm(  oo0tpxomo3tld mDul(msnt0trxrxo iodfaDranvo (0 rur(o oy1al  lneiasf 2tr(ront1oetoiiciadfs ulumo u0 exomrctatla   uvs t0 ruoiopoo4am nlnci ( artru o;t1olx micildlmDeluvp;u0 rtnxfcoa1oaD luvs t0teuo(m io1aptnlfvsatfs2taxronu4oexoioctys a2ra( p;(4altrio3iydfmDelnvo (  eur(o nu4om n netat)a2tm(m ;o0tleo fciatlmDrlnvpnt0areoir oadfmtr ies;()s2trio3oodal emncsa( arum(r no0tee ioeias a2rl(ms (4areoio3tadlat livsl(0srxoir iu1alenlncslt  rraxrpou1opeomictyd sDrln o;() reoxr tadfm  li olt  rxo(opiodlmte nesl(fa2rr(  ou0opxo feias sDumnvo;(0aleoir3oa1fa r u i;s sruoiopny4ameelnvslt artau  ;u4alx io3ilsls2rmu p (0aexoxo3ia1lpDrlueolt)t2tmio3oy4lm  mnesat  rumuront1texo ictltfa ul( p t0 lxnxociytfmt lneils sexrxm iu1lm   icilt arta(  nt1oetoifcils a2rluvpn() rermrctatlm   nei;s) rum(o3iodoltemncsl(fsrum( onu0ape  feiydla elu o;(4tleomf3iydfpDraues t)teum(m3oudomenmivslt srtrxr nt0oetnifciat a rm( s t0teenxo3iy1fmDr iei t0trumxm nodlm nmfvsl(  2rax  ;t4oetoifctaslm ea(vpnu4artoxo oodfmtrlneols seum(rpny1am nlnei tfsDumur ;u1alt ifctlt a2emu s t4 ltnxo3tytfpDraivi t)srumxrpiodoleemfvslt a2rrxmp;o1aet  i3ilsfs2rluvo;u) lxnmr iodomt  uvs t  rto(m nudom n iei s s2rr( pno1tee ifctltlmDelnvp;t4aexoir3iodfmtr i s;(0setrxopio1am  lfesl( a2umxmooo1aptomieiyt s2umu o;t0 rxoifcta1lmDran o t) etmir3ou1op nmnviat)srurumo;o4altomfctadlaDum(ms;()tlxomoctodfm rauvo t  2urxm3iu4lmenmfvsl( sDumx pnu1apt iieiadls rlnmp;u4tlenio3oadom eaivi t s2to(o io4ol emfesat)a2ur( poo1texo iciadla ua( ont0 ltnmrcoadfpteanes;s trtm(m ou4aptemnvi (f 2uaxmp;o0opxo o3ildfa2el(vp;() ltomr3iydfm  aivi;s  rxo(r3iydlpt lfeslt)s2ta(r oo0tet mociad m2elums t0arxrmr3tatlp r i slt0trurir3oy4optnmnvt t srtm(mpnt1aeen ieiatfm2ua( o;()trtoxfcoydfa eln ol() 2uoxrpiudoptelfcils  2tax o;u4opxn ieildlm umnvp t4trxomr3ia1fa eluvsls)s2umirpoo4lm elfvils  2tmxrp;o0aptniietltlsDra(vs;(4tetrmfctatfmDe ivil()s2xr(rpny4om  mnctas aDrr(  ;t1alx  fciyd aDra( o;u)aexrxr3oo1lm eln o;( s2toxopiudol nmfcils)s2raurpot4tlx moctyd s2eln s (4aleomo3todfptrlieo;t  rxm(opio4om e fes tfs2rmx ono4apxnmociydfa umn o;t)aetomocty1lmt  uvs (  exrxm oy1al n fcia() rtru  ;u1alxn icilslmDrluvs;()alerxf oatlpD lnes;(0t2urir3oo1apen fci t sDra( pnu0opx  i3ias a uaump;u4 rxrmo oo1optrai s t0 2xoirpnu1lltelnctasfs2tmum ;t4teeo i3tldfa2eanmon(4teeoxr3oadlmteanvo () rto(r3iydomt livilt arta(ronu4apenmociadfm umu s t)artoxoctadomt ai ils  2toxo io1openmnct s)srtax onu0te
\ No newline at end of file
@@ -0,0 +1 @@
+nvo t0t2uo(o3iy4ol   feias) rtaxr ot4opxoif3ilslm ra( p;u0aexomo io1lpDr i sl()t2xoxr3ny1lm nmneslt  rrruro;o1altn oetysls2emu o;t4tltrmrcoy1faD anvilt  rxm(m3iydamtnlivi tfsrrrx ont4alt  o3ils sDrlu o;t0trxomo3io1fa  luvi s s2xr(rpoy4alee feilsf 2tr(ro;o1olxnio3tls a2eln p;() lxrmf3tytlpD livsls tetr(mpiy1amtnlfcia(  Dtm(r oo0teeo oeiydfsDuauvp u0trtoxrciadlm  aneils  rurxr oodlptnmncta(fsDua(rp;t1tetoioeiadfsDrl(mo u) leoir oy1opDr ies s t2tmio oudlpe mnciasfa2rmumpno0oee  oeiysfm rl( o;t0aeeoio3oy1lpteaneo t)t2triopoodlle lnesl()s2tm( pou1opeoifciatfsDumnms;u0tetrioctadfmDran i;s)srumxr nydomeelnetas s2tmur ;t4tltoio3iasla rmumo ()aleoir3to1la  lnes;t) exm(r iodlm   icias) rtaxrp;u1tee mictyslm elnms;u)arxriocootoatr n i;()trumxm iydameemfcia(  Dtr( oot1tpt mietltlm rmnvpnu4 eerxo to1fm  lu i;(0teuoir ou1lme  nctl(  2tmum ;u1opto fctlt s2elnmp t0trxoxo3iotlpt  u o t  2xmxo iy4optnmieta() 2rm( pot4ale mo3iltla rlu s u0texoxo3oy1fmt lneils)tetrio iy4ale  fcsasfarrmx  nu4tlen o3iad m ean s;(0tlenif3oo1lm  anvslt  rtr(r3io4ol   nvsat) 2taumoot0oltnmo3iatlmDraump t4 rxnxrciotomtraieils0trxoxr3iu4altnmnvsatfarrmxm ;t4tpeo ociat a rl(mo u) lermo iadfmt aueol(  exmxm3nudoltelivtls)srrrum nu0tpt iociat sDrl(ms;t4 lxnxf3oydomD ai ils setmio oudlpt lfcsl()artaurp;u4oee mo3tltfsDrmnmo;t0 rxomocoa1fmDraues;t t2xm(opiu1opeeliciatfaDtrxr ;o1tpe  feildfs2uluvs;()aeeoxf3oatfaD  ivols0 rtm(m iy1ap   nctlt a2tr(mont1oex mictlt m elnmp;(4 leoxo3oa1lmt  nvils s2triopio1lpe  fciatf Dum(m ;t0aeenmi3tad s2uanmpnt4 ltnmfciytoaDr nei;s)sexo(mpio1opte fei ()aDrrxr ou0aeenmo3iltlsDulnmpnu0trtrmociatfpDe ivi;s t2ur(m iy4apeelfesas srtr(mo;t0tpenmoetadfa uauvonu0alxnmo oytopt auvo s) etr(r3no4open neiatfaDtaxr ;t0aeenmoetytfaDemuvs u0aeenmr3to1op  anei t s2trxo iydolenmfcta(fsrtrx pot1ale iieilslm2el(ms;u4trxoir ta1op e n s s)texoxrpoo1al   neias)arrax poo1texo iciysfm2el(mo (0trxrio3iydoat anvi t)s2tr(r nudlmtnlics tfartrxmp;u4apenifctydlm ra(mont0arxrmr3tytom ean s ()sruoim nydapt livtlsfaDrmu pnu4oeenio3iatfaDuau s;t4alxrmr iytlptrauvi (0t2xo(opoodlmt lncsas srra(mpoo1tlxniietadfs um(vsnt)tlxomrcty1fm raiei;(  ruo(rpno4om nmfvilsf Duaxr ;u1aptnio3tls s uaums;(4treoxfcootlptr iei;t0s2um(rpiy4am  lfetat)aDrax p;t0tle mociadls rmn sn()tleoif3tytlm   uvs;(0setmxm iu4lpe  ietas)aDrm(ro;o1oleomociaslmDeauvp;() exrifctotoptr nvils teumxopiu1al nlfci sfs2trx o;o1ole mfciys mDuanmo t0aexoxr3io1fm   ueo;s)s2xoxo3nu1ol nmfesls)artm(m nu1tlenmictaslm2rln o t)trenmocoadlpD auei;s)trto(r oo4lme mnesasfarumum ;t1tpt io3tytfmDrmuvpnt0aetniocoy1lm elivo (0 rum(r3oo4lpe  nei s artrx  ou1olxoifciatfsDra(msn(0 eerirctotla   n s (0 2xo(rpiodomeemiesa()aDur(rp;u1aetnmi3iadls el( o;u4 eenio3oo1oatelivs s0srurio3ou1lpte nvs sfarurxrpnu0openmfcils s el( p;u4 lxnif oydlmD  i slt) euo(rpoydolee fvta()arumxr ;u4tleoiocildfs2rlums t4 ltoir ty1lp ean s;t0seuo(o3ou4ale mfeta(  Draumo;o0oeeoifcild s rluvo;u4alermrctadfp eau olt0teumxr3iydoltemncs t) 2rmxr oo0apenio3iat m uanvp t4 leoiocoytlm elu ils  etoxo iodop elfeiat)sDta(mo;o0altomo3iat m rm(mp t0artrxo tytoaDr i i;t0 2trxrpoo4lltelfesl()s2rmx  oo1apeo iciydlm2emnmsnt) lxnmo ootfpDrlieo t)s2uoimpio1lp n iesa( arumx ooo4aeeoifeiytfm rmump (4alxnxf ta1omDrlu s t0srxrim3no1omee nes t)artrx  nu4aexn octlt mDemuvs t)artomo iytomteai olt s2uo(rpny1lp n ietl() Draxroot1aet miciadfa2ra(mo t4arermf ia1oaDeli olt texr(opoo1lm  mfcsatf Dua(rp;u4alx  ictlsls ra( pn(4teeoxf iotla r neo t0teuo(r iy4lm n fetat  Durx  oo1opxnifciatlm emuvs u) rxrif3ta1oaDelues;s)srxrio iudomeelicta(fsDuru ooo4apt moetadfaDuau s;t4trenio oodopDelieo s trumxopoudap emivtasf rrmumooo4optnifciysls2um(mo;u0artoio oy1fm r u o s0trxoxopoodol  licsa() Durx  ;u0alx mfctltfm elnmsnt4trtnxf3tatoa  livs t)teumimpoydlm  mfct t sDur(ro;u0ape ioeiadfm uluvpnt0texoxo3to1oaD lnvs;()srtmim3nu1olt  nvt sfsrtr(mp;t0aexnmieiyt mDraump;(4alxnif oy1lmte uvs s)teuoxo3oo1alt mfetltfartmxmonu4opx  fciatlaDuanvsnt4 etoio totlatrluvsls0s2xoxrpnodlptnmnvsat  2rm( pno4oeenii3iytlsDrl(mp;(0tleomr3iatoa elueol(0tetrxo3iy4openlfvil(f rrm( oou0tet  ocilt aDem(msnu0aeeomo3ootlptrln il(0trtm(m iu1alen fvtatf Dtrur ;o4olxn ictaslsDraumo;()altrif tatoa  anvsls)setm(m3ny4lmt lncsa()sruaumpno1aetnmoetltfsDea( pnu)tleoio3to1la elu i;s) 2uriopny1amtnlncta(farraxrpnu1aexniietls s2uanvpn(4 lenmr oy1fmtrauvilt0t2toxo nydape lfvsa()arrmxmpoo1tlx mfctyd a el(msnu)aexrxfcio1oaD au o s0s2toirpoodlpeelicsas)arrmx  nu4aee  iciatlaDua(vp (4tleomr3iy1fm  liei;s0texoirpiy4altn fesa() Duaumpou4tet mociydlm eaumsnu4texnxf3io1lpt ai ils)srurirpiudomtn netl()a2ra(mpno1optnmoeiadfs2elumo;t4 rxrioctydlmt  u sls)trurxo3oo4ale mfcsls aDtmxmp;t1oexnmfetatfm2em( o (4 lenif oy1oat  n olt tetmir3ny4op emnes s)s2trum nt0tetnii3iyd aDuan s t)aetrxr oadoateluvi;s trxrimpnodlmtn icsatfartmumont0oexn ieiasfaDeaumon(0 rerxr3ootoa e n s;t trtmxm3no1lleemieilt) rtm(r nu4tlxnmf3tlsfsDel( s t) lxnio totoa eln i s s2umxm ou1ol  mfetl( aDumu o;o0tpx  fetadfs ranvpnt4alenio3ia1faDrlues;()seto(rpio4opeemiesasfsrraxro;o4oetnio3iyd a emu s () leomf3io1lmDr iei;( s2tr(o nydame mncil(fsrtmumpoo4tleomietatlaDemnvs;u4alerir iytlp  aivsls s2xmim3no4olt miviat  rurxmooo1aeeo o3iasfm2raumon(4 exoxo iatfa  lneo ( trtmxopoo4lmenmnvsat)sDum( pnt0alxomi3ildls2eluvs;t) exnifcia1la r ues;()t2umxo3iu1lp emncsl()arur( p;u4optn fctat sDra(vs;t) lxnmrcoa1opD lnvi;( t2urim3oudome lfctlt)sDuaum ;u1oee mi3iyd m em(vp;u4 exoxr iy1faDraies;(0t2xoimpio1lm elncils) Drm(m ;o0tleomieiyd aDea(mont4 exomr3oodfa  lneilt)srxriopnydop emiet t sruru  ou0opxoif3tltlmDumums t0trtoir3tadlate neilt)setmxo3nu4lltelfetas)sDtmxm ;o4tpt  octatla ranvo u4aexnmo tytlaD aivs;t)t2trio iodap e ieiat)aDraxroou1texnifctyt sDranvp;(0tltrxr iadfaD luvi s teur(r ou4ome lnvtltf rurxrooo1tpxn o3iydfs rauvp;t4aetrmr oatopD aivsl(0t2tm(mpiy1apenmictatf rum(roou4olx  oetldlm2rmnvo t0tleomr oytoat  ieo s) eumxr3ou1omte nesls)srrr(m ou4opt moeiydls rmn p (0areomf tydfat lneol(  rtr(opnu1ome lietasf Drrur ;u4aee  ocilsls um(vo;(4 eenmf oodlm eauvs t teumxr io4llte ivi s s2rau  ot4aetnmoeiat m2uan p t4 rerxo totlmDe n i s teum(mpoo4ape mnvsa()a2ua(rpot0opt iociltls2umump (4 lxnxf totfpDrlneo;t)srtr(opny4am elnctatf Drmumpou0tlenmoeild mDelnmo;t) rxnxo todomt lu i s0trto(opnydlp n fctls  2umurp;t1tpxoioctatfmDeanvpnu) exoio io1fp  li slt0tetoiopoudlpte iesat s2um(  ou4tetn o3iasfaDuau p;t4trtoxr ta1lmtran s;s  exoxm3ny1lltnmncsl()arta( oot1oltoifeiydfmDemumo ()alermr3todopD livo s0s2uo(mpiudlm nliesa(f Dtm(mp;u4altnmo3ild sDelnms;()altrif ootlmt lnvolt tetm(opno4oltnmfvtatf rurx  ou0olxomoeiltlsDelu s;(4aeenmf3iadop e uvi;s trxmxo3io1omte ivtlsf 2uaxm no4opto f3iatfsDua(vo ()aetnmf oa1lat lieilt) rtoio oudomt lnesl()sDrrxmoou4oltomi3iasla rm(mon()aeeoxf iytlateluvilt teurim3oydal nlivils  Dtrx  oo1apeoiietyd m rlnvpn()teenxfctatlat aneilt0 2uo(m io4lpee fvsas)a2tax o;u0altnmi3iatlmDem( s u4 rxoif3oytoat auei s)t2tm(o nu4amtnlfvs ()a2raxr ;t1oee  f3iasla elnvonu4aleoxf3iotom eanvs;(0t2to(r no4llte nvs t  rraurpot4ape mociasfm eanvon(4trxrxfciotfp eanvo t0 rtmxrpoo1omt lnet (  rraurpoo0tpt  ietatfm2rluvs t0aetoircoytop e n i t) eumxr3iy4op n icsas)srtm(m no0ape mictytla2uln s;t) ltoif io1laD ai sls)seum(rpnudol  lfctat)sDrm(m no4olxn feiadfsDul(vs (0arxoircoa1fa e ivolt0trxmirpny4olenmnvtat)artau  nu1tlto feiaslm2um(vp (0 lxnmrcoodopte uvs;(0trumir3nu1aleemiciatf Dtrxmpnu0oetomi3iat s2ra( ont) lxrmr3ta1oatranvil()s2uoio3iudlme mnes (f rur(mono0tex  fciysla ulnvp (0trtnxoctytfmDr uvsls srxrxmpiydalenlivtl(f 2raxmoou4alxo i3iltlm em(ms ()texoxoctodomDean o;t0s2umxm3no4lp emivt ( s2rr(rpou4ope  fciasls elnvpnt0teenio totfp  lueol(0 2xoxo nu4ale  ictls  ruau  ;o1oeen ieiydlaDem(mpn(0alerxr3oadfmtrlu olt0texm(r3oudlltn ivs (fsrtr( o;t4alto feiasfaDrmnmon() eeniociodlpDeanes ( t2xr(o ou1optelfvsl(f 2tr(  ou4tpxoiietad m2emump t4 lxnmf oa1fm   ieils0 rxoxrpno4lpte fcslsfaDtr(r ;u4altnmieiysfmDemu snu4 eenxocootfmD ai ols0texmxm iudll nlfes t) 2umu pnu4ale mi3iaslsDua( s (0teenmf ty1fa eanvo t0t2tmxmpny4omenlfct ()srtr(m ;t4tetn feiyt m2el( o t) etrxr3oodfp   uesl( teuo(o no1am n ncsatfsrtm(  no1tetomf3ilsfsDel(vsn(4 lxrxr totla  an il() eur(m ny1ole  iciltfarurum ;u1alto ocildls umn o u0tleomf ootoat aivolt0s2uo(m3iu4amt lfvsas sDrmxrpot0oleoiicild m ra( o u4alxrif3iodlptelnei;s tetmxm3nu1ale lncia( aDtrx p;o4alxnmfcildls2rlnmsnt0 etoir tytoa elieils  rtrirpnydaltnmfetatf 2raum nu1aleomfetlsla ulump;t0tetnmo3oadfm rai i s texmxopou4ll e iei sf Duax pot0tpxoioctatlm emnmon(4aeeomfcoytfat livols0trum(r3iudopen ivs tfs2ur( pnt4tptnmociatlsDulnmpnt)teeoir3iatfaD luvsl(  2toir3oo4optemnvsltfsDraurp;t4tee iieiysla uauvs (4tltrxo3tydlp rlies;t0 rtmimpnu4omtelfct (  Dumuro;o0oeen ieildfsDul(vs t4aetnmf iatomDraneslt texmimpny1om emnci (fsDua(m oo1tet ii3tls m em(vs u) rtrxf3totfpDelivs;()s2tr(m3nu4aptnlfci t  2rrxrpot4opeo o3ildls rauvsnt0tlxrmf3oo1fptranvols) 2xoim ou1ol nlneilt)aDtru o;o0tptnmfeiytfaDumuvo u4 rtoifcta1lpt li o t0 etmimpno4am  mnet tfa2tm( oou4oexo oetytfaDra(ms;u)trtnmr3ia1opDrli i s)s2urim3io1apee fvtasfsDtmxro;t4olxoifciasfa elnvs;(0trtoio iytlmDeluvs;s)tetmxr3iu4lleeliei s srrm( o;o1aetomoetyd a emnvs;()tleoxo oatfa  anvo s)t2xo(m3ny4opeemies ( aDtaxm nt4apx ii3tls m um(vp;(0 leomf3iotfp eliei;(  2umxr3iy1lltelfeslt aDtrxront0teeomfetat m umu pnu4aexrxr3oatlmteanvi;s) etoxm no4apenmietl(fsruax ooo4aexnif3ild a em( snu4trxnif3iydomDe uvo;( srxrxr iy4ope lnvs t)artr(mp;t0oleo fciyt s ulu sn(0 ltoio3iadfmt ln ils  euoir ny1ol  lneias) ruaump;o4aeenioctysls2rln o;t)texrxrctotfmDrlnvsls srxrxo3iydlpen ncsas)sDtrurpot4ole moeias a2uau p (4aetnxf3oo1fmtran olt)t2trxr3no4lptemfvtasfsDuaum ot1tlt  i3iadfm umn p u) rxrmo3ia1op eli o s t2trirpnu4op  mietatf Dtmxrpou0tet mfetlsfm ranvpnt)tetrir to1om   uvslt  rxmxo3iydllt livs tf 2ur(rpnt0alt iiciyt a2rlnmo;t) etoir iy1omtrluvs;s0tetrxr3oy4lleelivtas arum(m ot0aeenmfctyd m el(vpnu0 exnxf iotla elivs t  etr(m io4lmte fct s s2rmx  ;u0texnii3iatfa ulnmp (0tetrmocoadfpDe uvo ( sexmxr nodole lfvt ( srta(mpot0altn fciltlm2umuvo;t) rerir iytlp elues;s trtmxm3io4lpt lfeslsf Dta(mo;o4oet iocias aDulumsnt0 etnmr totlpte u il(  2xo(o3no4omen neil( sDrm(r ;t4oeeoio3ilslmDrmnmo;t4trtnmrctatfm   i o t texoxo3oo4altemieils)sDurx oou1tptnmfciatfs rl(mp t0alxnxf tatfpDeaueslt)tetrxopoo1omenlfvi ( arur(mpot4oltn ictldla emnmo;()alermfcoytlmtelneo;s0 eumiopoo4lltn fesat)s2umu  ;u0tptnmieiltla2elnvp u0trenir3tytfa rlies t0sexr(o3iy4amtnmneilsfarrmxroou0tptnmoeias aDuaump u0teermoctytfp elnes s t2tmxr nydop nlfeiasfarrru o;o0oeeniictlsfs uluvp;t)tlerxr3tadlmt lnes (0seum(m no1am elfct s) 2tr( o;o0aexnmoeild a ulnvpnu0aexnxr oadfpDr iesl(  2tmir iy1al emncslsf rrm(rpnu4olt  i3ild s emu s;()tltrir3oatom elivi t texrxrpiu1lm nmfciltfs2tmxr nt0alxnmiciad a2uln sn() lenif3tadlaDrlnei s s2tr(m3oudlltelicsat  rta(m ot1opx mo3iltlmDrm( p t)trtoxocoatfatrliei;t srtoimpnydolt lfcsas)a2urxm nu4oltn ociys s2ea(mo t) exoxr3ia1fmte n i;t0t2urio io4op emnvi (f rumuroot1optomfctysfm emumo;() etnir3iy1oat li sl(0s2um(rpnodlltnlfei ()s2rr( o;t0oleomietldfm ua( on()aexoxf iadfmtr ueo t0 2xmxmpnu4amtnlnvi ( a2taxrpnt1aex  iciasla ea(mo;(0tlenir iydfmD ai s;s t2toio3iydoltnlncs tfa2uaurp;o0teeo oetas mDem(mp;u0 lxrxr oo1fmt lues s s2tm(m3oodlm n nct () Draxr ot1apxnmfeildlsDumnmo u0texnmrcoo1fatelivi ( sruoxo oo4ol nmnvta(fsDraxmo;t0oee ioetltfs rlnmp u0tltrifciatopt  ueo;s trtm(mpiy4lpt lies t)arur(  nu4oltnif3tytlm rlnmo (0trxomocta1fp  aieols) 2to(m3nu1lptelfes tfs2tmx  no4oetnmoetat m2ulumo;(0tlxnmf3oydopDrlnvolt  rtrxopny1al   nesltfaDtmxr oo0tpxomietatlm ua(mo () ltrmfctatfa elu s (0t2toio oy4aptn fvsasfsDtmum ou0tex mieiyd aDra( s;t0tltoxo3oa1oa rlues;s)s2umxrpiu1lltnmictlsf 2rrxmo;o1oet  oeias aDrlnmo;(0 lerxo3totop rauvo;t srumxopiy4alee ivs s) Dtr( pou4teeoio3iltls2uln s;(4trxnmociatomD lnvo;t0 rtrxr3ny1ope lietls a2ur(rpoo4tleomfetad a2emnvp;t)aetoio3oatlat aieolt  exmim3iu4ome miet s  rtr(m oo4apto fctyd sDemnmonu) leoxrctadoatr ivs s)trtmirpoo4ap n ivtltf 2ra(root1tpt  ieilt sDrauvo u4tlxoir3iydfa r i s;s0 2xm(o3nu4oltn ncs (f 2raxroou0aetnmoctysfs2rluvp;t4teermrciydoat aieo t)tetoxr3oudame mneil(fs2rm(r nt1opeoif3iyd a2uln p u0tlxrmf oo1fatrlu o t0srxmxopoudol  mncsl(  rtau onu0oexoifeiysfm ean o (0 ltoxrciodlateaieo;s t2to(r nudalte fvsls sDrm( o;t1tetomoeiytlmDrmuvs;u0teeomf3ia1lp r ieslt  2uoxm no4ap  lnvslsf Dumxro;t0tlxoifetys m2rm(vs (0 exoxo totfa r n i (  rxm(r3oy1apt  fetatfs2rax  no0apeomietytlm2elnmonu0 exnioctatfat  u s;()t2xoimpnu1omtemfctas)a2tr(  ot4openmfcils m2umnmpn()aeeoio oatomD li sl() etmxrpnu4aleelfeta(  rraurp;o1apeomoctld a2elumo t0artnmf3io1fp   uvs;s0truo(opio4lpe licslt) rra(r no4oexn i3ildls2ua( o u) rtrmr3ootom elivs t)srxr(m no4ameemfeias  Dumump;t0tpt  iciltla rln s ()artnxo3iadfm eaueo t  eumimpnu4lm emivi t  Dtaumonu4tetomfctatfaDel(vp u) renxo3iy1fmD au sl(  2xr(mpny4lptn fctas srta(mpno4aetnmfeildlaDrmuvpnt)arxoxr tytfpt lnvs s t2xrirpno4ole lictas) Dta(moot1tet ioeiad sDumnvp;t4 leoxo oatoaD luvs;s s2to(rpoy4lptn fei (fa2rrur no0tex  fcilsfmDra( s;t)tlxoir oydla  anvs;() 2trxrpio4llen nctat) 2uaumoot4teenmoeiatfm2umnmp;(4alermf oytfmD aivo;t) rumiopoy4lm emnesas sDtmu pnu4opxnmi3iasla ran onu4areoiocoodopDelivi t) exm(opoodameemfcs sfs2ta(  ot4ale iocild a ul(vs;(0aeenxrcoy1omt  u i;s trxmim3ny1om elnes sfsrra(m ;t1opeo o3tlsfmDra( ont0 exomr to1laD aivi;s)teuoirpoodopt lnvtat) rrrx pno4olt mfeiatfa emump;(4 lxoxf3iodlmDe iei t0 2triopny4omtelfvtl( srrmur ;o1apx if3iadfa2emuvonu4 lxnmfcoatfmt luvolt0s2urim3oodlp nlfvslsfaDtrxro;t4tpe  fetltfa ul( p;t) rxrio iadfpD aivs (0srtoxr nudalt  nvia(fs2rr( ono4tlxn octaslm2ulump;()alerio3oy1fat  ies;()texrio ou1lmeelnvtl(farrrum nu0tee  i3iltfm2rln pn(4arerio3to1fmtrli i () rtrimpou4llt mnesl(  2um(moou1oeen oetlt aDrmnvo;()aeenmfctydfaDean s;s0 etoim oydop nlivsl(  Dtmu  nu1apenmi3tyd aDul(msn(0arenifctytlmtrlneo;(0srto(mpoy1am nlfviatf rrr(mp;u0alen ictyslm2eauvsnt4aetoxo3iadla  aivo t s2xo(o no4apt mieiltf Durxmont0aetn octydfa2ranvp;(4tlxnxr3iadla   neols seuo(m iudope lnetl(fa2urx poo4aptoiictad mDrmuvp;u)trerxo oytoaD  ueo s  rxrxrpoo4ole lnetltf 2rm(rpoo4aeeoioeias a2em( p;t4aexrmr3todfa e uei t) exm(opiy1alenlicslt a2ur( pot0aex  o3iys s ra(vs t4teermfciy1lat luvs;t  rxm(o oudam e nvil( arua( pnt4tleo fetadla2elump t4altnmo totfatean slt)trxo(m3iydlm  livslsf 2uaxrooo0tlxniieias s emnvs u0 eeoxo3ta1fpDe ues ()s2xmxo ny4altemicias)a2rax pnu4aexoiocilt m umu s t4arxrxf3iy1fmtrlieol()teto(r iy4llte ivilt  2tru  oo1oeenmfetlsla2emn o;u4aeerif tatfpteauei;s)seuoxopou1omenlnesls)a2tr( o;u4tetnmi3ilt aDrl(ms u0areomr3to1oaDeau s;s  rtm(r ou4lpe lnvsat srra(r oo1teeniieiysfsDeaump ()tlermf3iotlmteaneol() 2tmxrpou1amt mivt (faDtm( pnu0aeenmi3iytlm ua(vo;(0trtnxr3oodla  lnes;s0seto(m3nydapenlfvias s2trum ;t1ole miciytfmDran ont4 rxomf ootla rai s;s0t2to(rpno4lm  lfetat) rta(  nt4open icilt a ra(mo (4arxnif3tydop rli o;s0tetr(rpnodolt  netlt  rurx oou4texnmoctaslmDemu p;u0trtrmrcto1lp eauvi s) rxrxr oo1op n ncs (  Dtmumpnt1tpt  i3iat sDrmn p u0aeerif oa1faDrlnvolt0t2tm(o3oudopeemfvi ()s2rm(moou1tpxnmfetydfa ea(mp;u4areriocoadoptr ivo (0trtm(rpnu1lle  neia() 2umx onu1aet  o3iltfsDea( s;(0 ltrio iatlm eln s s0setoxo oydomeelncils)s2rr(mo;o0aetoii3tat s2ua(vp t4trxnio3iytom rlu il() eurir no1omt lieiltfsrrru pnt0aeenif3iytlm2elumo ()tlxomr3to1la rauvs (0 eto(m iudaptn fctltfaDumxr nt1olx mictysfa rl( s (4aetoxr3iotfm rlnvils0sexrio3oy4optelnes t s2umuro;o0altomi3tat s rm( onu0trxomr3ootfmDraivi;s0tetrxo3oudam n ivsl( a2um(root4texnmicildlm2eaumo;t4aexoxrctytlpteli sls0 rur(r3oo1lmte fcias a2tmx o;u0tlenmfetldla2rmu ont4alerio iotfmDraueolt seum(r ny4apt mivs t artmu  nu0oexoii3iysfm2umumpn(0tleomfciydfaD aiei;s)trtm(m3nudamtnlnvt tfs2trx oot0tlxn ieild a2rl(mp;u4arxrxr3iadlpDe ivilt0srurxm oy1aptelnesat  rra(  nt0aleoii3iad mDea(ms () rxnxo3tytlmD ln slt0s2ur(m iydll n ics (  rtau o;o0apt mf3tlsfa2eauvon(0 rxnio3oatlmt lues t sexo(m3ou4lm n ncia(fsDuru pnt4tlenif3tytlaDumuvpnu4tlenir tytlptrln i (0t2tm(rpoo4ope  neta(  2rmurp;t0aet  i3tys s2ul(vsnt4tlxnxr ia1oa e i o (0seurir iy4lm   iet t sruau ont4open ictld mDulumpn()trxnxo oydom elnvs;( tetoxopno4ole  iei tf Dtau pno0alt  ietysfa2ul(vo;(0tleomociadop   ies;s)s2toir ny1omte neta()a2ra( o;o1ole mfeils m2rluvon(0texrioctydfateanes;s tetoim iodap e fvtat) 2raumpot1tltomieiyt mDuln pnu4trenmr3oydlatr nei;t trum(o3nydap  lnvi ()aDta(rp;t1apeoif3iltfa ra( s t0tltoir oytla  au o;t  2xmiopoo4lleelfvs tfsrtru  ;u0optnmfetadfs2ua(ms t0aeerir3iodopDe ies s)t2uo(o no1omtelict sf 2rmx p;u0ole  iciadlaDeaums u4 exrxr tadlate neils)s2umim3nudole mfeia(f Draxm ;o4oeeo ieiytfs umnvs;t0tlxnir totoa rlies;t trxoim no4omenlicsa( arrrx pou0tex  oetltla2emumpnu) etrmr oydla rli s (0trxmxrpoudlmeemfcsa()srtr(moot1apt mfeias m2eanms t4trtnif3tatlp elivo s0setm(m nodal emncs (f Dumxmpnt1altoif3iyd m2rluvs;u4texnxocty1fmteaies ( setrio3oy1op  mics (  rtaxr ou1alx  ictytfmDeauvp;t) exnio ootfaD au sl(  rum(m no4omenlnetat  rrr( o;o1apt mociaslm2rl( o;t)aetnxfctydfpt ai s;( trtmirpiudlltn fesltfartm(r ;u4aexoii3iasfaDumn p;t)trenmf ia1fpDraneo t0tetm(opno1op  lnvias) rraxmpnt4ape iietysfmDemu s;u0 lenxf3iotomt  i ilt) rurxr3oo1olenlictat  2trxr ;u0aptn f3ildfa2eauvs t0 reoxr oadlmDeaueo t0 eurxopou1oltn nctltfartrx pnt1alt  ocild aDua(vs ()trxoif iotom e ieo;() exrxo oo1aptnmncias  Durxro;t0olxn f3ilt aDrm(mp ()teenif iydla eluvilt)tetmim3io4ap n nesls)s2tau ono1apxnii3iltfs ua(mo ()alenirciadfaD anvol( srtr(o3nu1opeemfes (  2tru ono1ole if3tad a ul(ms t0alenmr iadomDrlu i (  rumio io4aptelneiat)aruau pot4tee mfeiatls2em(mpn(0trxoif oo1fm r nvilt)teurxo oydlleemivils)srurx ont1oexnmo3iytfm rl(vsn()trtoir ootfatrluvsl() rxmiopiu4lme lfei ( sDtmump;o4ape moetas a2el(vs;t0texrif3oydlmtrlu slt0 2toxm nodop nliviltf rur(mp;o0teeo fcildlm2rln onu4 ltrio oy1omDeau sls0 eurio iydlp n iciat aDtmx ono0openifctyslsDua(monu0arxnxr3oydfaD ai olt0 2umirpio1lmt mici ()a2urum ;u0aet ii3iytlsDelnvsnu0 etrifctydop r nei;t) 2xoxm iudlle  fesatf 2taxm no4aee ifcild m ea(vsn()tlxoxo io1omDrlnvo;(0setoimpiydlm nmnct s)srumxro;u1aee  oeiatfsDra( sn(4tlxnmocoatoa eaieols0 rur(r3oudlme licsat  2ra(m ;u4aeenmieiydfmDuln s;(4altrxrcty1la   n o s) etr(o3nodamt lnvils arumx  ;t1tle  fetytlaDrl( p (4 lxomo oadoa  lieo;s0setrxr3iudlp nlnci ( sDurur no1texoifetysfs2emn o () exrirciotlptrlues (0t2uoxr3nu4lpeelietasfa2rmump;o4tlx ioeils m rmu p;(4 rxrmfciadlm  aueo t  2toxrpnodalt mivs s arumx pot1oexn feild a2eauvo;(4artrxf3tatomDeanvs;t  etr(mpiydlm n ics tf 2umx o;o0oexn ieiysfaDrm( s t0tlxrxo3oytlm e uvi;t t2uoxm oydam nmfcsat srur(m nu0tptnifetasla ulu o;()altnxr oydopt  uvi t0srtmxo iu4apt  fesl(farum(  nu1apxomictldlmDeaums u)trerxr3io1fpteaieo;( trurim iu1alenlfesls  Dtaxrpnu4alxoii3tadls rluvs;t4tetnmrcoy1fmD ai slt)trum(o3io1lmenlivtat) 2tax ono0oetnmoctldla2umnvon(0aeeomrciydfmDrln i s srxr(o3io1lp  mfcslt) rua( o;t0apeomoetat mDeluvon()arxoifcoadop   ieolt)seto(r oo4lmtelnetat  2ur(m oo0oex  fciydlaDrm(vs u) eerxoctadopt aivs;()s2trxopoo1ap e fcsas)s2rr(  no1texnmiciyt m eauvsn() rtnxo iytlmt lnvo s)srxoimpiy4am  lnviat)aDtrxroot4aexnmf3ils a elu s u)aetomr3oo1fmD  i s;( s2toio oy1olt  iet tfsrta( pnu0oeto i3iytlsDraums ()alxrmo3oy1fmD ln s;( teur(m3iy1omen fct sfartrxmp;u1alxn fetlsfsDul(ms t0 etnmocoytlm eauvs s0 exrirpiydam nmiesat)s2rm(rono0olx  icilsfa2rmnmo u4artrmf iydfatelnvs (0teurxm iy1al nlictlsf rua(  ;t1tptnmoeias s ul(vpnu0trxnmo io1lpDe i i;( sexoxmpnu1amee iei ()a2um( ont1altomiciad s2umnvo;t0 eeoxr tytopDe ieils texmxr oo1lmtelivs t a2ur(moou4tle io3tad a uluvs;t0 rtniociadlmD lnvslt)srur(m iu1lm   icsl(f 2rm(  ot0aet mf3ilsls umn on(0 ltomrciy1fm  au olt0t2urim3iydap nmfvs s) 2rr( pno0opxn fctlt sDrl( o;t0trtoxo3tatlmte iesls seuoim nu4ape lnctas) rtau pno4aee if3ilslm ranvonu4 exriocoa1oaDr ueslt0trumxmpiu1am emfcsa(fsDua(rpno0oexn icias mDum(von(0alxnxf3totfmt  neolt sexoir nudalte icsl( sDrr(moou4tltn fcilt s2umu o u4 exoxo3ootomDeauei;t s2urir3oodll  mfvias aDum(moot1apxo iciat a2ra( p u0artoir3oy1fpDeaivo;t s2xo(r3iudaltnlfeilt a2tmurono4opxn oeiad aDrmn o;u4trxnxrctytfm rauvo;s)trxmxo3no4al e fes sf 2rru poo1tlenioetysfmDrmnvs u0arxrmf iotfaDr i olt0 2tr(o3oo1oltnmict t) rua(rpou1tet  fciys s eau s () ltnifcta1oa rli s s)s2urim3iu1optnlnvtls a2tm(  ot0tlxo octytfmDemumsnt0trtoiocoatlp raneils0truoxmpny4amenlncsatfsrua(ro;u1oltomfcilsfm el(vo;(4 reoxfcio1op eai s (  exoxr iu4llt  feils)srur(m ou0olen i3tlsla ra( ont4 eenmocty1omt  n i;s srurio3no1omtnmfctlt aDrmxrp;t1oltnmi3tlsls2rm(mpnu) rermf tadfmtr ies;(  rxmxr no1amenlfvtltf Dtrxroot1open ociytla2ranmpnu0altoxr ta1fmDraivslt truoio oodom  lnvtlsfsDra(  ;o1aeeoif3tasfaDumnvonu0altoxo iy1fmDrlnvil()t2to(m3oodal nmieiat a2tmuronu1apto icild s umuvp t)tlerxo iadlmD  u i s0 2toim iydam  lies s s2tmu  ;t0oeen iciltls2ulumpn(4teeoioctadoa eaneo;t  2toio oo4om  mivi s  2urx onu0tpxnmfeiadlm rmnmp (4 ltnifciotlpDrauei s setoxrpny1lp  mfvi ()arrmumo;t4aleoifciyt s ea(mont)aleoxr3iadoa  luvols)tetm(o oy4olte neta(  Drrumoot4ape iieiaslm elumon() rxrxfciadlmtr neilt0sexo(opnudlp emneilt s2uau  ;u4tpe mf3tltfm emnms;t) rerxo io1lmDrli o;t0 rxmir3iydop nlicias)aDur(ronu4oetn o3tyd m2ra(monu4areomo3oo1lp  lnvolt trxm(mpnu1op nmfcta()sDurxm nt1tee mo3iytfm2um(vp (0trtrmf totlm rlnvsl( s2uoxo oy4olenmfvslt) Drrxrpnt4aleoif3iat mDem(ms;t4 rtoio tytfpD  uvi;t) 2xrxr nydal n fes tf rtrurooo4olenmoeilt s2uauvo;u0 rtrxo iydomDe iei;s0 2um(rpoodlptnlfei sf 2tmxmpou1ole ii3iadfmDrm(vs;() lxnio tatoptrai i ( s2umir no1op e nct t)srurxmo;u0apto i3ildlaDua( pnu)alxomo tydfm rli s;t s2trim nu4lpenmnctl( srtmu p;o0tetoiieiadls2ua( s t4aetnmf iadopte i s;t) ruoxo oudom elnvi () Dtaum nu4aptn f3tytla ul(vp t)tetoxfciodfp  anvi;() euoxm ny4ap emfeia(f 2umur ou1apeo fciydfs rmnmp (4teeomo3tatfa  luvs s seurxo3oy1am   fct t)a2raxr ;o0teeoiieiytlsDel( s u0trtrifctytfatelnvi;t0 euoxr oy1om nlfetatfsruaxr ;u1oee mf3ias mDrln p u4teeoxr3oydom elnesls s2toim3iu4oltnmfcs (fa2rm(  ;t4apto oeiasfs2ulums;u4altnxo tydom r uvolt)sexmim3ou1ale mfvsls) Dtmu onu4teeo fciytfm2ranvsnt4arxnmf3iadomDr neo;s teumirpno1lpenmictasfsrrrumpnt0tpxnmfciadfa2rmn ont)altoxrciotlat  nvs;t t2uoiopny4lm nlnvilt)s2ta(mpot1opxomf3tlt m ra( pnu) ltrxr oa1omDean s;t  rtm(r3oo1lleemnvt ()sDumxmont0tltnmfeiadfs emuvont0aexnxo3oytlmDeln o;()sexoimpnu4optnlfetls)srrm(m ;o1apx  i3iltls2rmumon(4 rxoir iydoa rau o (0s2tmxo no1lmtemiviatfaDrru oou0teeo o3tysls2rmu sn(4trxrifciadfa r ieol(0tetrirpnudalenmfei tf Drru ono1tle  octad sDrmn o;u)aeeomf to1fmD luei ()t2trio no1lpeelnet sfarrm( pnu1aptniiciys s2ran s;t4tleomf oatfpt  ivi s0t2xmxrpiodameemfeiltf 2rmxm ot0olt ioetlt m2em(vonu0tlxrmocoadla rlu s s  2toir3nu1am  licilt)aruru pnt4aleoifcils m uln s (0trxrir3ty1omDe n i () 2uoxopnodopeelnet s arrm( pno0olt ioctltlm2eanmonu4 ltoxo3tytlatran s t0s2tm(m3oudlmt  ictlt sDtaxrp;u1altnmi3ilsfa2um(vo ()areomoctydlmt au o;t t2tmir nodop elnvslsf 2rrxmpoo1tptnmociytls2emumsnu)alerif3oo1op rauvslt trxrxopoydoltnlnesls) Drr(m ot1apxoifeiydfm ran on() eeoxo oy1fm e ieolt t2xrxr oy1llt  nvia(fa2uaump;o1tleomoeildfa2rluvsn(4arerif iytom r nvi;() 2xrxm ou1am n fcs t sDua(root1opxo fctatlsDumumont4altrmo oo1fm r ues (0t2um(o iy1op elies tfaDtm(ront1tlxniietasfm2emu s u)areomrctydoaD luvs;s0teurxrpnudamte feilt)sruax pnt1aeenmfetys s ea( o u0aetoxo iydoaDr n o;s)trtrxo3ny4amtnliesa()a2tr(mono4oleo oetydlmDemnmont0 ltrmocia1fmt aies (0 rtmxr nodapt  neiltfsrtaurpnt1tpxo iciysfm2rlnmp (0 lxrio3tydlateluvs;t seuo(r3oodlltemfvi t)a2taurp;u4teen ieias s um(msnu4 rtriocto1lpteli o;s)teurxrpny4ameelfct ( arur(  nt4optoii3iydls rmumpnu) etrmrcta1fmDr i s;t0teum(opnydlpt licsl() 2um(mo;t4oleo icilslm2um(vsnu4alxoxrciatfp   i o;t truoio3iudaleemiesas)aDtmxr ou4altoii3iyd a rlnvsnt0aexrxr tytfa  auvs;t) rxmirpiu4op emict tfs2rmxm ;t1aex  feiydlaDea(vo (4alxoifcta1omt lnvo;t)seur(mpnydapeelieiat  2urxm nu0ale  fetydfa2el(vs (0tlenmrcoa1fatraiei;t) ruoxr3nudopt lnet ()s2tax  ;t1apenifeiad aDeanvo;t4trtoxo iydfpteluvsl(  rxr(r3ou1ale liesatf rua(r ;o4tetnmf3ils aDulu on()tlenio oy1lp   ivil(0 rtoxmpou1al elict ()srum(rpno1oetnifctlsfs em(ms;t4 rtrif iatfptr uei ( t2urirpoydop nliesl() Dtr(rpno0alx mf3ildlsDumuvont4 rxomr3oadoaDrliei s) eur(o nodap  livt sfarta( poo1aetn oeiytlaDemnvp;(0aeenxr3ta1fateai i;()trurxo oudalte icsat arurxmonu1tpxomoetyt aDelnmo;u0trtnircootfpD lnvo;s)s2uoiopou4omt liesls)sruaumonu1oetnio3ias aDeaums;(4artomocootlmt lues ( s2xmxo3no1ol emfctatfsDur(monu1aee  iciatfs rln ont4alenir oa1lateln ilt0t2xmiopiu4al nlnvtls)sDtaur oo1aexomietydla2ea(vs;u0 eeoio3iy1lmte n sls t2uoxo nodllte ici ( srurum oo0olenioeiydlm2umn snt0 leoxr totfptraueo t)tetoxm3no4am elicsls) rrmu  no4oltn fcilsfaDem(mo;(0 etnmo3tatopD ai i s)tetmir3oydlm  mnciasf 2uaxmono0olxomi3iyt a2rm(mp;u)tlxrmr3oatlmteau i (0t2xoxrpoy4ape lfcta(  2tmx  ;u1ope miciydla rmuvsnt0arxnircio1fm r nes;(0seumio io1ol  mnes ()srumur ;u0apxo fcildlaDulnmp;t4 etrmrciatoa ran i;t  exm(o iodaleemivi (f rrr(mo;u0aexomi3tldlmDul( o t)alxrxfciotlatrlieo s)teto(r ny4llt mncia()a2urumpoo1tetoifciadla el( o (0treoifctodlmtr uvolt)setrxm3iu4lpt lnvsl()a2tm(mono0alxnioctytfmDrluvon(0trtrmf3to1fmDe nvols)srxrirpoodom nlici ( arrauroou1oex ifeildfs elnvpnt4 exoio3todfmt aivs;s  2ur(opiu4ope  nct t artaxrpoo1oexniictyt m el( pnu) ltoio3oa1fat  u s;(0texoio nodope  fesatfa2rrx pnt1tpxnmi3iysfa2rl( p;() ltoxo tatlatr nvi (  2xm(opiu4ll emivil()srtmxmpnu4teeomoeiltla uluvpnt0arxrircty1laD ln o;t s2tmxr iydomeelneias)s2umxrono0opx iociatfmDulu snu4 eeomr3ta1la eaues;s)s2ur(r nu1ale lnci s) Drau o;t0tlto octldfm umuvpnu0aeenxo io1fate u il(0trtrirpoo4omte nvta()a2urxroou0oeen oeiys sDrlu pnu4trtoiociydoatrli sls0sexo(r3no1lpenmivias) rtmurp;o1apxnmfetysls2eauvo (4alxoir oy1faDeln sls)t2urim ny4am nmnvil()aDrr( pno4opxomf3tld a2ra( s;(0tetoifctydlatrauvols) euoim oy1ap elnei tfaDuau p;o0oleoioeiltls2eanms;(4aetoir ia1oaD  ivols0s2tmxo ou4lpe  fet s) rrr(rpno0aex moctytlm emuvs u0tltoio3oadomDelu olt0s2tm(o3oodllen nviat)s2rmxrpoo4ape  f3tasfm2ra(mp t0trtomo io1omDe i o s0s2toxm ou4optnliet t  2rax o;o4ale iiciadfsDraumon(0altoxr3to1om   n i t trtm(m ou1apt  fet s) Dta( ooo0ale  iciasls uanmo;u0tlerxf ty1faDr uei;s)tetm(opiudlp   nviasfarurx ont1teeomietatlsDumu o;()artnmo3iadfpDr u s s) rxo(m oudlm n fciatfsDtr(ro;u4oexomoeiatla ul(mp;t0 rtoir oa1omtranvo s teuoiopiudlm n fcta(fa2ur(r ;t0tle  iciytlaDra( p;()teermfctodfm r ueo;(0s2uo(o oo1om emivtls)aDrmxmooo4ole iietytls2ulumo u4artnxf3oo1la elues;s) exrxrpou1ame  nesa() rtmumpnt1tptnmf3iydfa2umuvsnu4 renxr tadfmD  i s s0seum(o3oydomt liei t)sruau pot1tlto feiadfa2ranmonu)aeenmfcoodop   ivi t)sexo(rpio1oltn fct (fsDta( o;t1apto f3tldfs umumo;u4tltoxociydlmtrlnvils)sexoxr iy4lpt lfes tf Draumo;u4oexoiiciatfmDuluvsn(4 eerif3todoatelivs (  etmir nodlptelfes s  Dtm(mpou4aptn f3iydls2eau p () rxrio3oatlpt  u il() ruo(r3oo1ll elici s sDumxmoou4tlxoio3tas sDel(vpnt4trerxociodfpDe ueolt) etmxr3nu1ame mfciat  Dtrxmpnt4aee  feiys m2ra( o;()altoxo3ty1op   iei ()t2toxo iu4lmtn nes t srrmxmo;t0opx ifctltfmDumuvsn(0 eerifcootoaDran s t) ruoxopno4apeemnci s  Dtmu oou1tetoifciydlm2uanvon()treoir oytlmteaieol() 2xoxm3io1lmt  ivias)s2rr(m ;o1alxnmfeiytlm ulnmpnu)alxnifctatoaDeanes;t  euo(rpnodape lnvsasfs2um(monu0oet moeiysla emu sn(4tltrxo3ootla e u o t s2tm(m3no4amee fvslt s2rrumpno4oetnmieiyt a uanmon(0 lxrifciadop   n o s) 2tr(mpiu4llen ivtasf rrmx  nu1olenio3iaslm ean pn()trtrxfciytlmD anes;s)setrxm3oo4alt lfei t s2trum ;t4tptoiiciad aDem( o;u4teenifcia1omDe nvil(0 2toim3oudll nmnviatfa2tmu pno4alen oetltfm2eanvpn(0 renio3oadfmDe n i;(0 rxmxr iy1op n fvias sDtmumpnt0tlxomfciltls2uaumo t4alxriociodopDr uvi;()teuoio oudlp n ietat)arurxroot0tlen ictydlsDuan onu) rerxocoatla r u o;(  2trxr3oy1oltelivs (f Dtmxrpnt0texoioeildla rau s ()aexrxociytomD au s;( srxrxopou4omtelictl( srtrxr ;t4apxniieildfmDuauvsnt) lerxf3oadomtrlu s;t) etoxm3ny1alt miet (f Dtrx oou1aptnmi3tyt a umu pn(0teenxf oy1omte n ils0 2tm(opiydll  lfcil(fsrtm(mp;t0openif3iyslsDuaump;t0 eeoxr totom ranes;() 2uoxo iudlptnlictlsfartmu  nt0alt mfeiaslmDeln ont0texomfcoatfm   iei ()sexoir3ou4al n ncsa(fsrtru pnu1aex miciytla2ea( s;u)aetrxo io1oa ran ols teurxm ou1om nlnvs ( sDuaur oo1tet mfetld aDeauvs;t4artrircio1faDe uei;( sruo(mpny4ap nliet t)aDrrx o;o0opxoioctls s2rluvs t) ltrmr tytlatrluvi;t s2xo(m oo4llenmnvsasfarrr(moot4tpe moctad a emnmsnt4tleomf oa1faDr uvo ()teurirpio1op emfet sfsDta(root0aleo oeias sDul(msnu0alxoxf iy1fm e nei;s0teuoio iy1openmfvia()srrr(mp;u0alxn i3iadls2eanmonu)tltoxrcoatlmtelivs;s0trtoio3iy4om nlfvsat) 2umu  no4tlx mfctltlm2rlu s;(0trerir oo1fmtrauvs ( s2uoim ny1opt lieias)s2rrxmoot4olenmf3tltfa rm( pnt) lxomoctadlp rlu o s srtmxo nudomtemnetls) rtax o;u4tpt  ociysla2elnvsnu) etoif3iatfat aivilt) rur(mpnudlle  fci ()sDtrxm nt4ale io3ilt m elnmo;u0 ltrmr3todla e n ols)s2xo(o3ny4omt mfctl(fsDrmxm oo4tleomf3iytfa ran p (4trerir totopDeanvolt  exrim nodlptn ncsltfs2raxm ot1tpxo fctasfs2emn sn(0 exrmo3iy1lmDrlnvo;t0srxm(o3oo1lle miciat) Dtmump;u1tee iiciasfa2rmuvp t)arxoxf3totla raneil( s2umio3iu1ol  mfeilt  2tm(r ;o1tlx  oeiltls eanmp u4aleriocty1oa   nvol(0tetriopoydamt  nctltfs2tm(  ;t4olto oetyd a2emu p;u4treoircty1fateauvsl(0teur(rpoy4olenlicsa()srtm(  ;o4alto octydlm2em( p;t4tlermf tadoa e nvi;s0trtrxm no4am n fctls) rtr(m ou1tle  oeils m2rlums;(0aeenif3oytoaD li i;s  2trxopoo4omen fvs tf rrrumpot0tltomf3iad mDuanvo;t0artnxf oatlmt  nvolt  rurirpny4omee nvia(faDuax oou0tet if3tlt s2emump () lerxo3tydlptrlneol(  rtoir3iu4optemnctas  2umx ono0oetnmoctydfa2ra(mp t)aeeoifctodoate nvo s  2tm(m3ny1apt mivsls)sDrrum ot0tlt  ictas s2ulump;(4texnmr oodoaD auei;t t2xrirpiudom e fvias arrru o;t4aeenmfciytla2emnmo t4aexomf iodopteaivo;(  2tm(r no1omenlfvtas)srtm( pot4aet iietytls2elnms (0alxoxo3tatla elivol(  2tmxrpoydlp   nvilsfsDumu p;o0optn i3taslsDean snu0areoif3to1laDrli ilt trxr(m3ny4open netl(f rrrx pnt1oleo oeildfmDraump (0arxnifctytlm rauvol() eto(rpoy4opee ieiltfs2uaxr ;u1tet moetasls eauvp;(4tlxrxo tydop eaivs (  2trio nu4lp elncias aDraxmp;o0oetomicilsfsDeanvp;u)tlxrmf3oy1lat  uvils sruoxo3iodop   fct s aDrrx ooo0apxnmoeiyd m elnvp;t)texnir3iodfmDrlues;t)trtm(opny1apeelfvt tfs2umump;u4tle  fciyslm uanvonu4 etnmr3oo1fm eaivo;s)t2toio3nu4amenmnvias)srtmx  ot1oetnmi3tytla uau snt0trtoiocootfm eai ilt0setrir3iy4lm emfci tfsDuaxr ;t1aex  fciasfs2eanmsn()tlxrxfcto1laDr u i t)srxoxr3iodlltelnetlt  rurur nu1altnio3ils m2uan pn()alxrmo3ty1la raueslt seuoim iydlp nmietls  2raumpnu1tpt ioetas s2ean o u0areoxo3iy1fmtrln slt)t2xrxr oy1omen nctl( srtm(r nt0olxn i3tls a ulu onu) ltnxociadlpt  uvi s)texmimpny1ap  lfci ( artmxmont1altomiciaslsDrmnvo t4trtrir3oy1faD  u o t) 2urxo3nydomt lnvta(f Dur( poo4oeeomoetysls elumo u0aleoxocto1omDrlueils0s2xmiopiy4apt mfvias s2tr(m no1opeoioetat s el(mo u4tetrmf3oatfmt lnvil()t2uoxm3nu1ll nlicsls) 2uax  nu0aeen ietasfm2eanms (4 ltomo ia1lmDraieol(0 exoir3iodlmtn ivs () Drmx  ot4oee iociatfs2um( p;u0artnxf iodfa ran o;s) rtmxo oodlm   neils)s2ua(roou4olx iictaslm2el( pn(0tlxnxo3iotfa raueslt0trtoio iy4optnmnvia()sDum(m nu4oetnmoeildla2el(ms t0tlenxf3iy1fm rliei;t  rxoio3ny1lptnmicsasfartrxmonu4olx mietydls2uluvp u) rxoir3oatom r uvo t0texoio3nu4ol nmfvsl( s2rm(  ot1aeen o3iysfs2umnmpn(0tltomf tydopD  ieols0 2umxo3iydlltemnvt s)srtrumont0opx mf3ias mDem( ont4tlxomf3oo1omD  nes (0srtrim3iu4om nmnetltfsDuau ont4aptnmociad m ul(mo;t4tlxrxo3oa1fm rai s;s0s2uoxo iydom e ivt s arua(m ot1open iciasfm eln s ()aexrirciydla  luvs (0 euoxo3oy1aleemncsa(  Draumo;o1aet ifetld s ulnms u4tltrxo3tatomD aueo;s t2umxo ou4lpte fvils a2trx o;u1tltnmfctlsla elu p (0alermo3ta1fm  livs;t)srxrxm3nydlp e iet sfa2taurpnu1aptnif3ilt a2ulnmsn(0teenmf3totla  lnvi;t t2uoirpiydome lnetat s2raxmp;o0aetnmoeiadlm el(mp;t0 ltnio3oodop e ivols0s2umxmpiy4ale lfesa(f 2rax o;o0apeomictytlsDumn pnu4arxriocoo1la elivolt0 ruoiopiu4lmen icsa( aDrrxrp;t0opxniictat a2rauvs;t)tlxrxo oatlaDr nei (0 rurir3nu1lmtnmnvtlsfsrrm(  ;o4oleoio3tas m ulums (0tlermr oy1fp  li i;()trxmim3iydolt  fcs s)arrmum nu4aex mietas mDrm(ms (4aetoxf ia1faD au ilt0trumxm oo4alte net t srum(mp;t1ope mf3ilsfa umuvp t0 etoir3todlateluesl(0 2urirpoy1lp e feta(fsrrru  nu0optnmi3iydfs rl(vo;() exrifcio1faDrliei ( seuoim3nu1lptnmivi sf 2ua(ro;u0tpxomocilt m2emnmp t) rtomf3to1oateaivolt0t2urxo oodom   ivi ( a2urx pnt0optoiictldls ea(vpn(0 rtrxocty1lpDeli s;t)srumim3ny4ap nlnvsls)srumurono1aex mf3iasls rmnvp (0 eeoxo oytfmDeli o;s  2trxo nu4ap  lnct s)aDra(rono1texoio3iaslm2eauvs (4 lxnmf iy1fm e ues t)texo(r3ny1omeelfciat  2tr(mpot4aee ifciysfs2uaumont4 etomo3oatlmDelieols  exrxm no4alt lfvsl( srtrxro;u0altnif3ildfaDeaums;u0 rermfcio1lat lieo (0texoio3iu4apenmiei () rtr(  ;u1oex  f3iad sDrl( s;u) eerxf oo1fm elnei;(  eurxrpiu1amtnlivilsfs2urxrp;o1apxn feiltlmDra( p;(4 lxoxr3iytomDeln s;s  2xoxm3iu4aleemivta(fsrtrxr nu0tltn i3iatfa ea(von(0arxoio iatlp e nvol( seumxo3oydolen fet t) 2rmxm oo4opxnmi3ilt sDeluvp;t0aeenmrcoytlp eaieils  exm(r oudomen ivtls arururpou4oetomi3iad aDemnvp () leomf tydomteauvs t)trxr(opiy4ale lfesltf 2umu pot0aptniieils mDem(vp u) exoif3iadom raueo s sexoirpiy1lmenmicsl() rrmxm ou4opx io3iysfs2umnmp u0 ltomr iotlmDe i i;s)s2xo(mpoy4omenlneilt) Drm(moot0tlt iieildfa2umn s;t)aleoir ia1lm e n ol(0s2uoxm no1olen nctat)artaur no4oexomfeilsfsDumu p;t0aleomf oy1fatrln sl(0sexm(mpoydaltemfctasfsDta(mo;t0tlxnifeiytfsDranms;u) eerxr3iatop rlues;() ruo(m oydll emnes sf rtmx  ot4texnio3iyt m2rlnvp;(4trxrmf oy1lptr uvs;( seumxmpnu1ope  neias  Dtr(mpno4aexnmfetat m ea( p;t0 etrio oodlpt  i slt  2urxo3iudalt micias srtrxmont0aptoifcild m2ua(vp;t4aeeoxrctydfm r nvol( s2to(o3iy4amte fctl()a2tr( oot0optoifciadfa2emu p t0tleoio iotomt lu s;( setr(opoydlptn nvt t)srumxmont4tpeo i3tltfaDuan s t) eeoif tatfa eaneol(0teurxo ou4alenmnetls  2tr( onu0opxnii3tltfm rluvo;t)arerxfcto1lmDeaueil() etrxo oudam n ies s s2tr(r ;u4oeto iciysls uanvo;t) reoxociotoa eaivo;(0 eto(rpoy1oleemics t)sDtmumpoo4olx  ieiyd m uau p;t)arermo iatlaD  uvsls0sexm(r iudomenmfcs t  Draum nt0olt  ietatfm emnmp;u) leoif iadlm   iei;t) eum(mpio1apte fvil(fsDurumpot1tpe mociyt mDel(ms u4texnif3iotfa rli o t0srxr(opoy4lm n fcs s aDtrxmp;o1ole  ieiadfs2ranvo;u4texrmr oydlp e n s;t teumxm oydomt lnvilt  2umu  nu1opxo o3iytlm2ul( pnt)texnxo iadomtr ueo;t) ruo(r iy4optnmfvi s sDrmur oo1apx  oeiysfm2uauvp (4trtoxocio1opt  ivo t0t2uoxo3oydol elies s sDumxrpot4aetomi3iysla umumon(4artoio tadlaDraueil(0 2xmir oudapt  icsat)s2urumo;t0apto i3tldlmDea(vp u) etriociytfpt au i;t  rtm(m nudam nmfct s) rraxronu4oet ioeiltfaDea(mp t0 rtnmf iydfpDeanvi (0 etrxmpoy4om nmneiat sDrax pno0opxnmo3iys s rmnvsnu0aexomr3iatom elueo;s0truo(m oo4lp emfeil(  2ua(rooo1opxomi3ils s rmu s t)aeerio3tadopD  n o t s2tm(r3nudap e nvsl(fsDum(rpou4oeenmieiydls rl(vpnu) lenir oadomD  u o;s)s2xmim oy1lleemiesat sDtaxmo;u0aleo f3tatfaDel(vp;u)aeerxo3io1lp   i il(0s2toxopio1omenmfctltf Drmx p;t1texomfciasfmDua(vp;(0trenxrctotlpt li s;t)s2xrxr3io1apeeliesat a2umxmono4aptnii3tldls rl(vs;(0 rxoirciodlp eluvi (0s2to(m ou4ll  mfct ( sDrr( p;t1aex mi3taslaDrm(vont0aeermo3oo1om  ln s (  eurio3oodlmt lfet tf rrr(mooo0aet mfciltfm rln sn(0arerir3todfaD  ues (  2tmimpoudopee ivtl( srrm(mpno1tpxomoetasls2rauvs t4arerio ty1fpDr nvolt) etmirpoodll nmneias)sDtmur no4olenioeiytfsDrmuvs t)tlenmfciatop rlneolt teurxr iy1ope  fvt s) 2rmx  ou0teen octydfmDumumo;t) leoif3iodomDrai o s seum(r3ny4omt mivtat)s2um(m nt1ole ifeilsfa2emu snt4tltomr3iy1lptrauesl(0s2umxmpnu4olen nvsat)a2tru  ou4opeoii3tat s ul(mp () etoxocootlm  lueo (0trxrio3nudoltn feiatf Dua(mont0opxomf3tas a ean o t) reoioctotfptrauvo (0sexo(rpiydal  mfesls arua( pnu1tet mieildlm rmnvont0trxrxf3ia1omDranesl() rtoim3iy4al e nvil()s2trurono4oltomietldfa ul(mpn(4trermf todlat  u il(0setrio no1olen nvia(f 2um(ro;o1oetniicilsfs2ulumo (4texnmf iotla rlu s t  exm(o3iu4ap elnes sfarrmu ooo4opx  i3iad m2ea(vpnt) rxomfcia1laDr uvo t0setoxo3oydlm e nvtasfaDtaur ot1texn o3tadls2ulu snt4tltniocio1fmte ues s  eurio3nodaptnlnetat)a2rruronu1tet mieiysfmDumnms t)tlxrmo3oodfp r ies;s  eur(rpoy4lm n fvsl()aDur( p;t1aex  ociytls ua(vsn(0 lenmo3oy1lpDeaneol(0sexrio ou1ope lfvi s  rumuronu0aeen ieiysls umumo (4trtomo iy1om eaneil( tetrxm3iudop nmncsls)sDtmxronu0texnmocilslm emu snt0 leomo3iatop e nes;s)s2tr(rpou4llenmivt t)aDtmumonu0apxnioeiatlm emnvs u) lxomf oatfmt lues;( srtrxr iy1om   fct sfsDrmxrpoo4olt ifctltfs ea( o;t0aeeomfcoatfm e i i s0s2xr(o iydope mies tfarrru o;u0oleoifeild sDranvsnu)tltrxf ootopte ivilt)t2toim3ny1om nlivias)srraxrooo1oeenmicildfaDrmnvo t)treomo oytopDraneo;(0 exmxm3io4omee nvslt)aDrmuronu1apeo ieiasfsDemuvo;t4 lenxfcoa1fptraivi ()srtmir iu4al nmfesat) Drr(rpnu1tee iiciydfaDranvo;(4 lenmrcia1lm  ln slt) rtm(r3ny4am   fesa(f rtr(r ;o1tpxoii3iydls2ean o u4aeermo3tadfa r n ils texrim3io4omt licia()aDuau oou1aleomo3ilsla rl( p (4trenxr oo1lpt  ues;s) etrxm no1al  lnei s s2rr( pot0tlt  ietltlaDul(ms (4tltomfcoy1optrlivi ()t2xmim io4op  lictl() 2ua( o;u1aet  oeiatlsDra(vsn(0 eeomf3oatlateaivs;t s2to(rpiu4opt mfcsl(fs2rrx oot1apenmf3ilsfaDeaumsnt) lxoio3oa1opDe ueo;(0 ruoxr oy4am nlfci s aDrrxr ;o0apxomoetadlsDem(mp;u)arxrmociodfa   n i;(0tetoir3oudlmeelfctat s2uau poo1tpeo oeias m elnmp t4tleomr3oadla elnvil()truoiopoydllen fcil()aDrrxm nu0oee mieias sDrm(vsnt4aeenxf3iodfaDrli i;t0t2toir3iy4lmeemietatfsDtaxmp;t4olx io3tatla rlnms t)tlxrxrcoatomDrln sls)texrxo ny1ame mfeiltfaDrrxmo;o4opto oetyd sDemu s ()arxnmfcootlp eaivs;s)s2xm(mpoo1olt mnvsas) 2taumooo4olt  fctasla ul( o;(4aleoifciodopD  ivsl(  2tmxo nu1am elnesls srumx ont4apt  octyd a2rmu pnt4altrmr3tatlpD anvsl()s2xr(o3ny1amtemncs sfa2trxr ;u1tltnioetyt mDumump (0arerifctodfp  anvo;(0srum(m oydamtnmncs ( s2tmu oou0oexn ieiltlmDul(vsnt4tlenxr oodomDe neo;( srumiopoo1om e fetat srumxm nu4oltoioeiyt a2uauvp;(4tetnio3oadlmDraies s s2uoxrpnodolte ivtat  2rrxr nu0apeo oeiasfa2eanvpnt4aetomocoydfatranvs;t0tetoim3oo4opeemfctltfsDrrxr nu1opxnmi3taslm em(msnt4artnmo io1op rln i;s) rxo(m3ou4omenmfes tfa2tau ont1oetomo3iasfm rl( o;u)aeerxfcoa1lm elivi (0srtoxr3oy1ope mfviasf 2trur ;t4altomicilt a el(ms;()trtrmf3oa1faDrlieslt0t2tmirpiy4omenlnciltf 2uaxrpnu1aex mi3iasfmDulnvp t4alxomo oy1lptean i t0srtoxopoy4amee fet ()sDuax pou0aptn f3iys m2ul(mon() rxnxrcio1op rlieo;() rxoim3iudlp nmneiasfs2rm(mo;o4olxn ieiydlsDrmu s t4areniociotfp eau ils0t2tm(o iy1op e fcslt)s2raxroot4opxn fetytfa2ul(mpnt) rtrxr iodfp raueo;t0s2ur(o3oo4ape  ncil(f rurur ;o1oee iiciyslm rau s;u4trenmf3iy1laDrlu s;t0 rurxm oy1ame livtatfs2tau  nt1oetn ictlsls2umnmonu0texomo iodlaD lieilt0srur(m3nu1lp n fvtas sDurum nu0olxoifciadlsDeanvpnu4trerio ty1oat  n ils0trxm(opiodol e nei tf Dtrumo;u4opeoifeiytlsDelu pnt0aexoir3oodfmtrau ols)teurim3nodomtemnvs sfsrtru  nu4aee  ieiadlaDumums;(0 lenxrctotlmt  neo s  exmim no1am  lnctl() Dta(mooo4tlx if3iasfaDel(vs u4trenif iodlpDe u i;s0seur(rpiy4apenmfcsltf Dumump;t0tee  ieiyt a2umu onu) ltrmr3to1oaD  ues;(0t2xo(m oo4openmnvt ()artaxr oo4texn oeiasls2rmums t0tltrir3oytfpD anei;t0 2trxo no4ol nmfvias) rurx pno1oetn oeiatlaDranvonu) rtnmr io1la elu sls  etmxo3iu1am nmfcsls) rrmxmpoo1tptnmieiytlmDeaumo t) eerxo todlm elu o t teuoim3iy4llt mnvta() 2taxrp;u0alt micildfm rmnvp u) exoxr todopteaneol( seuo(mpno1ol elietas) Duru  ou4apx  ociad m2rl(vp t)teermr3to1fmteli s;( seumio iy4lleeliesas) Drmumpot1alxnmf3tadla2ran on(4 rxrxf iytoa r uvils teuoiopnydlme  nvt sfs2tm(moou4optn f3iydlsDemnmp;u0arxnxr oo1laDranei s0 2xo(r3ny1amt lfvs ( arta(  oo0olen ocildlaDul( p;u0 rtnxf3tytoaDeli o;(0t2uoir ny1oltnlfvsas aDtruro;u1tpxo f3iad s2emnvpn(0trxoxr iotfpt lies;()srxmirpoy4amt lfesas)a2rru  ;t0tle  fetltlm el( p (4 eenmr3oa1oaD  ies;s0sexmimpiudomtnmfes s aDraur ot1oet  icild a ea(mo;(0tltomf3iotom ranvsl( tetr(m3nydopte ncsl()artaump;u1apx  f3iad aDrlu snt4alenifcoodfaDeli o t0srxm(m oudopt  ivsl(fsDrm(m ot1tpeo f3tasls2ranvp;u0 leoir tytop eaneils seumxmpnu4altemfet tf ruru  no0aex  oeiydfa rmu onu) reoxr ootlm   ivol( s2tmim3nodlltnlfvslt)sDua(rooo1optomictat sDrm(mpnt)trtniocoa1opDrauei;t srxr(opnu4ll n netltfs2trxm ;t0texnmo3iasfm2ea(vsnu4treoxr oadoa e ivsl(0trumxopoydoptnlnesl( aDta( p;u1tlxnifciytlaDumu ont0aexomf oadlmt auvi t tetr(r3iy1ame  fesl()arrrx  ou0tetnmocias a eluvs;u0arerioctodomt aneil( sruoxm ny1lpte nvt s) 2tr(m ot0ope mfetltfs rlu p u4texrxo iatfpD  ieo;t) 2umio oy1al  lnvslt)arum(m ot4openiieiadla2ulnvs t4aeerio oytfmDrau s s)s2tm(r3iu1llenmfcia( srtaxr ;t1aet ioeils s rluvpnt4tlxnmo3ta1laD  ues t) rxm(mpiudamte ieslsfaDtrxrpno0oetnifctlt m2rmump;t)trxrmr iy1fm eanes (0 etm(o nu1ll  lietas srrrumooo4olt iieildfs rlnmp;(0arxomfciadfa rli slt s2xmxmpoydapen ncsat  rrmum ;o0tptoif3iat s2emuvsnt)treoxr oadfp rau s;t)trxmxo nodop nmictls s2tru  ;o0aexnmf3iltfm2rlumo;t4 rtoxr3iy1lpDrlnvo;t)s2uoir io4ome  fvs s srtmx pot4apenioctatlm2rmums;(0 exnif iadfmt ai s s setrim3ny1lp elfcslt srrr( onu1opxomieiyd m2rauvo;u4aexnxocoodfptrauesl( s2xm(opny1lptelies s sDraxront4altomo3iysfs eau o;t4trenxf ta1fmteauei;(0 2ur(r3nydalen nesa()aDrmumono1tlxoioeiydfmDelnvp;(4altrxr tytoat an il(0 rxrir oy4optemictlsfs2ur(m nu4aex  ociad a2umnvs t0alxnxo3tadfa  lueol() eto(rpny4oleelictas  rur(monu0aexomfetaslsDelu o t0tltomo iadoa elivolt tetoir iy1lmt lfes sfsDrr(moot4optnmf3iatfmDum(mpn() eeoxocoydlp  aivo;t0tetmxo3iudameemiesl(  Dtaxrp;o4aexnifcilslaDrluvp (0 exoxrctotla   ueo s) 2xmirpou1omt mfvta( sDumx  ou0aptnmfciltlaDrl(von()trtrmf iotfp e i sls0setmxo oydomee nctasf Draxm nt0alt mf3ils aDuanvsn(0 ltrmf oytfateaies;t0trtr(opoydam nlfvta( a2uaum ;o4texo octltlm2ra(mpnt) etomr oytoa  ln slt0 rurim3oy1lptemneilt)a2uauronu4opt miciatla em(mp ()trxnmo3oatlpD lnes;t0trtr(o3oy4omeelfvta(fa2uax p;u0oetnio3iadla2eauvont0texrxocoodfm e i slt0setmxrpoy4lme  nvtl( sDraumo;o1olxoif3iyt s ea(vs (4teenmr tadlm rluesl(0teum(m3iy1am nmfvi ( s2tr(  no0oet miciasls emu s;t4altrmo ia1fatrau s;t)s2trxmpoy1alt  nvslt)srra(rpnt1aet moeiydfm2rln onu) eenmr3iodfp ean o;s0srumir3no4ale lfvsa() 2tru  ;o1opx if3iatlm2rmnms u0trtrircoytlpt liei;s texriopiudopt micilt) 2rmu p;o0opt  icias aDranmo ()aexomr3tytfpt ln o s) 2to(m no4lp e fvi (fs2umxmpot0ape  o3iatlm2eaums;u0tltoiocto1optr uvil()srtrxopno1apt mfvias)sDrmu  ;t1apt iictldfs elumo;u0tetomo3oy1lp r ieil(0 2um(m3iydomee nctatfsrta(rpnu0oetn fcilt m2emu pn() etrir oytla e n s s0 rurxm3nu1opee iviatfs2uaumpnt4oexo ociadlaDra(vo;u0 lxnio oy1lat lnes;( t2ur(rpnu4alte ictlt  Drru  no4altomo3tasfs2ulnvs;u0 rxnir3tydfat lnvi;() 2urxmpnu4aptemfvt (  2um(mpnu4tleomoctadfmDelnmo;u)aeeoif iotla   ivi;t)srtm(mpiu1lp elneias sDuaxr ;u1olxnmfetlslm2ean pnt0aetnif3ta1oa raivil()s2umio3io4ale lics s  Drmumpno4oetomoetadfm umums u4tetnmr iodfa rlivilt0srumir nu1lp nmfvilsfsDtm(  ;o0tpx ifeiytfs em(monu0 exrmf to1om  li ol(0tetrxm3no4lmtn fvsa(fsDumxmont0aee  o3ilt m2uaumsnu0tleomfciy1lm r nei;t0sexm(r io4ap n fet ( s2urx  ;u4aetomociatfm2eau ont0tlerir iy1fpD  u o;s0setmir iy1ale lnet t)sruauroou1texnif3tasls rlumpnt4 reniociytom rluvi s)truoxr3nu1llt lnct s)a2rrump;t0opxo iciytlm uluvs u) rtrif3iotlmtr nvol()trtr(mpny1al e ictat)s2ua(  ;u4tptniictyt m2umn o t4 exoxr tytfpDe n o;()t2toxm3oy4lp nmnvt ( sDua(  ;o1teeo fciad m2ul( snu0 rtrxo iytla ranvi;t  euoxrpoodlptemfvta(  2urum ;t0altoiictad s eaumsn(4 lxrmf todopDr neslt)trxm(rpoo4ap e nctlt srtax p;t1optnioctas s2umu on(4tleoifciy1omtr ivo (0srtoxr3nu1altnmics ( sDuaum oo1olen octasfmDum(vs t0aetnio oydopDrlneo (0trurim iydope  fei s)aruaxrooo0apto oetys s2ran p;t0aeenifcoy1faDe uvs;s  rxm(r iudal n icsl(faDrax  no0aex mf3ias sDel(vpn()tlxnxo iatom eau s;()t2xo(m io4lmtnliviat)sDumumo;o1olxn i3tysfm2umnvo u) lxrmr3iatfptr iei t)sruoiopnu4oltn ics (fsDtm(  oo0ope mietadlsDra( o;t) lenxrcia1op  aivslt s2umxm oodlmt  ict ()aDrau o;t4aex  ieiad a2rmumo () rerio3oadfmtelu sls)s2toxopoy4ol n fci t) Dra(roou4tlx ifeiytls2um(vsnu0trerxo iy1omtrauei;t0 etrxmpoydol  lfctas)aDua(m ot0aetn ictltfm2ul(vo () lenxrctatom   i ol(0seumxr3iudol elfetls) 2rax pou0oexnmf3ils m uln pn() lermr3tatopD anvolt) 2xr(m3io1omt mncil(  rrruro;o4olxoioetas s el(vp;()artoxo oa1op r i ils0 exo(mpou4amtemnctas)sDrau ont0oeeo fctat mDraumo;t)artrmociotlaDeau o;s0t2to(mpoydam emfcia()s2tm( p;t1openmoctlsla ua(msnt)tetnmfciatomDe nvilt)setoim3nydlle  fvi () rrr(  nt1apxoioeildls2um( p;u)texnxociotfpt  i ils0s2xmxo3oydomtelfeta(fsDtmu  ;t1aetnmf3ias a rm(ms (4 rtoxf ta1optr ues;s  rtm(m ou1am elieta( sruru ono4ale iociltls2uauvsnt0texnmrcoodopD lu s;t)texoim3iudamtelfvs s)artrum ;o4aptnmo3tlt mDua( p;t0arxrmo3tydlaD auvi;t0 2to(mpoo4aleelfes () Dtr(mp;o0apx  octydfsDul( pnu0tltomrcio1lm  aieo;(0t2xo(rpoo1ope mncsa( sDtaxm no4aeenmfcils aDumnvp (4teenmr3oatfm  aivi s sexm(rpio1aptn nesat  2tauro;o4oex  fetasfs ra(msnt4teenxo iy1lpDr ivi;t0t2uoio ny1ome mfesa()arrrx pno0ope  iciaslsDua( snu4 rxrif iotla r n olt  etr(m iodap elncsltf 2ur( o;u0tlx ioeiys sDum(vs u)tltnxo3todfaDeau slt) rtr(mpny4lpeelfctl(f 2tmu pnt4tltnmo3tytfs2rlums;u0 rxomf tytfm rlnei;( t2xr(rpou4oltnmieiatfsrrau p;t4oee mo3tls a2emnvp t4treoxo3tytlpt  n o;t  2um(opiy1amtnmfvsas)a2tr(r no4tle mi3ild s rmump;u)arxomrctydlaDe ieilt)trtoxo3iu4lpe mietl()sDtmx  nu4ale ifctlsla2ra(vo;u0trxnifcoatlpt  i ol(  exo(r iy1ome lietas artmxr ;o4oltniociltlaDeau s;t0 ltoxf oa1lp elues t0setoirpoydolt lfci s  Dua( p;o4olxo feiaslmDrmnmo;t) rerio iatfp r u s s0 2tmim3nu4oltn nviat srua(r oo4apxo o3tat m emnvs (0 ltrxo3iy1fmDeaivols  2ur(mpio4om nmivsa()srtrxmpoo0tpxomieiat a2rlnvo;(4trxrifcoo1optelnei;t) exmxr iu1ap nlfvil(f 2tr(mp;u0aptoio3iat s2um( o;(0aleoxf oodomteauvsls0t2xrir ou4aptn icsl(fsrurxm oo0tltnmoetas m2rlnmo ()tlxniocta1oaDeli sls trxriopio4am  lfctlsfs2ur( onu1apt io3iyslsDrl(ms;t4tlxoxrcoo1omDeln ols)teuoxo3oy1lm  mnesl()a2tau pou4alxnif3tatfs umnvpnt) rtrxfciotlpteai s;(0teuoxrpnu4ope  ict ()aDrr(  nt1tleo feiatfm em(msnt0tleriocoo1lpD lnvolt  2tmim3oo4lm emivia()s2tmump;u0apxo feiatla rmnms;()tlxomrcty1oat lies;t0t2xrxrpno1olee fvsat sDrau oou0oleomieiys a eauvs t0arxrmfciodom r i il()trxoim3oy1ol elnei s)s2tmuro;u1tee iietatfmDuanmon() rxrxfctydfpte iei;()trxoxo iy4omt miesasf rtr(ront4olxo fctydfmDum(mp (0texoxf3io1fptrluvo t0sexo(o3nudaltn ies tfaDrau poo0alt ioctlslm rm(mont4trtomr3oydla raivs;s s2xmim3nu4omtnmici ( sDtrxr ;o0oex mf3iydfm rmnvo u0tlenmrcia1fm  luei (0truo(opnu4amtelfvtls srtm(r ;t1ole io3ildla2emuvo () ltrifcto1fmtelies;t0srxoxm3iu4ale  feta( a2rm(m no4alt moeilsfs rau snt)tltrif tatomte i o t t2toiopoy4lltemncias s2taum ;t4tpeoifeils a2eanmp;u0aetrxrcoatfatr nvs;s) 2urio nu4ape livtl(f rra(m oo0opxo fciasfmDul( o;t) eeomoctotom eau i t0srumimpiydop n icta()s2rm(moot1opx iocias m el(ms;t)altnxrcoydfp  lneilt seum(r3ny1lp elfctl(f rtau  nt4tlxn ictlt sDumn p;t)trermocoytlpDrauvi t  2urxo oy4ap nmfeil(  2rrx  nu0tleo oetysfaDrm(vp;u0teeoir io1fpt aivi s0texmxo iy4apt mnvi tf Drm(mp;u0tlt mfeiaslm2rmn s;u0 exoxrcoy1late ies ( trtmir3iy4altnmnvs s) 2uru oou4oleoiietltfmDum(vpnu)artnmr3iydfm r uvsl(0 euoxr ny1lpt micsls srtmxro;u0tlen i3iad a2em( snt4tlerxo oodla e ueo t  2ur(o no4ll e nvilsfsDrax  nu4ole mfciatfs2rm(vsnu0 exnio oodopDraueo;() 2xrxr3iu1ole lncia() rtmx oou1olenmictltfaDeanmpn(0 ltnio ty1faDe n i;(0setoxmpiu1am emivsasfaDrrxm ;o0aex if3ilt sDrlums u) rxrio to1laDelu ols0texoim3ou4ol n ieil(faDrru o;o4optnifetlt m2rauvonu4trerxrctytlpDe n o t)t2tmxm iodlle mietat)aDumxr ou4aetnif3iysls rm(vo u)tetoxf3tadfmtr n o;s sexrxmpny4olte ieia(  rra(r nt1opeomf3tldfs2rauvonu) lenmociytfmteaivols  etmirpoo1omen iet (  Drm(mp;o0oexniieiaslm umu s u)aleomf3iy1opD  u o;s)teurir nu1opeemneilsfaruau  ;u4oee ifeilslsDrl( o (0alerxociy1lp r nvi t0 rtrxm oydamen nvsltfartmurpnu1oexo fctaslm2ra( o (4teenxf3iatlmDr uvi ()sexr(r3nudlptnlfvi s)s2um(r ;o1tex if3ias m2rmnvp (0 lenio3oodopDrlu s;()setr(rpno1lpe mivtlsfa2uau o;o1texo f3ils m rlnvsnu4teenmo iotopDrli o s) exrxo nudal   ieiltfsrur(root4teto ictyt s2rluvon(4trxnio3oa1op   ivi;s0 2to(m no1om e nes sf rrm(roou1opxnmictas m2ua(vs;()trtrxr3oa1fmDeli slt teumir no1lme  fesatfarurxrono0apxo fciyd a2ranmp;u0arxoir oadfateauvslt0s2trio nu1ale mfcs s aDum(m oo4optn fciysls2ua( sn(4 etrxo oo1op   n ols tetmxm iu4lptemnet tfartr(r ot4aeen feiyd m2rmnvo t)texnmf ootom  livi s)sexoxo3oydope  fct t)arua(mp;t1opt iietls aDranmp t0trermo todlm  luvo;()sexmio3iudapenmfcs s  2uaurpno0oeeo iciasla2ea(mo;u)aetoioctotlpDean i;()tetoxo3iu1altemfcslt  rtr(  ;t4tpe ifciad m umumo;u4 exoir3ootoat an o;t t2tr(mpnudaleemfciatfaDtrxm nu1tetomiciys a emu snu0tltomrctodom ranvil(0 exoimpiy1lpt mnvs s s2rrx o;u1oetnifciyslmDemnms;(4aleoxo3iotomtran il(0teuoio iy4altn fviat)aDtm(r ot1apxoii3iyslaDea(msnt4altoxo3tydla e nvs s0t2uo(r iy1lmen fci t  rrrxr ot1oeeoif3tldfm2el(msn(4 eerxoctodlp rlnvi;s texm(rpnu4al nlfes sfa2ur(m nt1texomieildls emuvo u)tltoxociytfmDraneo;() exr(rpoy1lm  lfvilsf rumuronu1olt mo3iltfm umnmo;u0trtrmr to1lmDr uvols t2tmio oy1lmtn feia(f 2uaum ;u4tpeomo3iltfm el(vo;u) etomrciodfm  lieil( trumxo oo4om  lnvt s a2rax  no1opt mi3tasfmDra( p;(0trtnio todlaDeliei (0 eum(r nydllen nvtltf rrm(r ;o1tptn o3ildfsDrmnmont4trtrmf oydoa   nes;s0tetm(o3iodll n icia()a2rmump;u0tltn oeiysfs eauvs;u0arenxo3ty1fpt aieil(0tetoio ou4apt livtat  2ta(r nt0apeomoeiysfs emuvo () etomo3iatfmD lu o;s  2toim3no1amenmiei ()a2rmuro;o4opxomfcilsfa2elump;t0tetrxrciydlaD an o;t0seto(rpou4apee fviatfartmump;u4tpto fciadfs2ulnmo ()tlenxf tadfm rau i s0 2xrxrpiudamee ics () 2ua(moou0tpxn i3tysfm2ulnvs;t4tlxoiocia1oat an s t)trtr(o iodapt lfcslt aDrrx  ou4tet io3iasfsDem(vs;t4altnxo ootoat  n o t)trxmio no1lmee ivil(fs2rrx ont1altn i3tldfs2raums (4arxnmf3tydoa eauei (0t2trim oo4lmenmfct t  Dum(m ;o4altniieiadfm2ranvsnt0 exnxf iodfmt  n o () euoir nudop elietasfaDuaurpou1optoifetltlmDrluvp;t4tlxrifciydlpDr i ils0 2urim3iu4om eliet sfaDuru pot4oexnmo3tyt m2rlnmon() rerio iytlmD  ies;t  rto(rpiudomeelictlt sDrmxronu0apt  f3iatls2rln snu)tleoiocoadfatr i sl()t2xoir ou1ol  lieiltfsDumxm no4oexnioctltfm2emnvo;t0tltrir oadfmteli o;()t2xrio nudol nmici tfa2uau  ;o1tpeoioeils s ranmonu4 etrxf oa1faDeluvs;t)srtriopoydll   fesat  2ur(moou0oeen feiysfm ul(vpnu0trtoir oa1faDraues (0 etmxr3iu4am   feiat) rrrxr ;u0olen ieilsfmDel(msnu0aexoxrciatlpteai ols0s2ur(o3nudlm nmnci (faDtmumo;t4tlenmi3iltfm ul( s t4 exnxf3oy1lmtelu o t)s2uoxr oy4omt licil()a2um(  nu0aexn ictltfs2rmuvo (4 ltrircio1optrai sls0trtoxmpou1lpee feil(fsrur(mpot4aptoii3iat sDeluvp;u4aetnmocia1lpt luvs s) 2urir3iy1apenmncia(fa2tr(mpot0tlx iic
\ No newline at end of file
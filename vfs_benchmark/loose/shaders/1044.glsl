@@ -0,0 +1 @@
+nvsls sexr(o3io1ol emnctlt aDua(ro;t1alenif3iysfm rau pnu) eenir tatoptr uvi;s trtoir iu4amt mnet t)sDrm(ro;u1altn feias s2el(msn()tetoio3iotfatrauvs;t)t2umxrpoo1oltemics s  Dtmxrpou0oexn o3iatls eln s t) lxomo3iytoaDranvi () rxmiopiy1omenmnciat  rtaxr oo1tpeniiciad s ra(vont4teermf3iydom eluvo ( t2umio ou1opeemncta()a2ta(r ;u4tpeoifctytlsDemn o;t0aetrmr oo1lptr ueolt)seurxrpou1olt mictlt srrmumpnu1tleomi3tas s ulnms u)arxrmf todfmtr nvs s srxrxm3ny1open ivt () Drm( onu0tleomfetatla2emu s;() rtrxfcty1fm rlu i;(0tetmxm3iy4alenlfvilt)arrmxrono1ale  ocias m2ua(vp;u)trxoircty1lmte uvils0seurim ny4ame livils  Dum(m ;u4teenmfeiasfsDea( snu)aexrxrcoadoa rai i s  2tm(opnodom emfctls)sDua( oot0oexo ieiad s2el( on(0tltoxocta1lpD  u o;( sexmimpou1lpte nctl(fsDuaxm nt0texnmoetadfm ra( p t) renxrctatfaD livo;s0setrir3no1apenmfvi s  Dra(r oo0aeeo ieilsfaDuan snu4altoiociodoa rau s;s)t2xoxmpnodape mnei t)aDtmx poo4alenmi3iltls2ul( pnt0 lxrir oytlmt  nes;t s2xoxo ou1lpte iet ()sDraxronu0aeeo ieilt m2rluvo u4alenio iy1lm e ivs ()setr(opnydole mfcia( a2urxmp;u1aexo oeiyd m2umnvsn(4trxrxo oy1optran s;s seumxo3nodal  mnetlt) Dtmuro;u4tltn icilt aDea(msnu4trtnio3to1lm rlnei;t)texoirpoudol  mnct t  2um(  ;o0tlxnioctltfmDrmu pnu0 lxrmr3tytfm  lies t)seumirpiy1ol nlicil() rrmum no1tlt ifeilt m emnms;(4tleomr3oa1oa eanvo () 2toxm oo4oltnlnvsl(f Drrxmpnt4apxnio3tls s2emuvp u4 rtrif3ta1lmDranvo;( setmio3ny1ope mnesat artmumo;t0tle  f3iysfa2em(mont4alermfcoodlp   i i;t srxmxmpnodomeemnvt tf Dtm(  oo0opxoiietls a2umnvpnu0 lxrif oytlm r uvsls0seuoim nu1ll   nvs tfsrrmu ont0opxo ociasfs2rm(vs t)altoxr3to1fm eau o;(0s2toxmpny4ll   iei tfsDum(  ;u4olx  o3iltfs rmuvp (0 etoif3ia1fm r ueo;s trxmxm nudam  mfvia(f Drm(  oo1alxo f3tlt m rmn p;t0 exnir3iydlm r uvols0srxmir3iy1ole  fci (f Draxmoou1ope ioetat mDrluvo u4teeoxr3oy1fp elnesls srxriopoodome  nvsas)srta(m oo4tex  ictldls2rl(vo (0trtoxo io1lpD ln o;s  2tmxo no4alt mneiltf rrrurpnu0optomietyt s elnms;(0teerxr3tadla   nei ( trur(o3iy4amtn neia()arrmu onu1optnmi3ild s eauvp u)altnxo oodlm e n ils  exoirpnu1lpt lnvil(f rrmx oou0oet ioetaslm2em( p u) lxoirciatfptr u sl( truoio3oydlm  mnes ( srrmxm ou4oetomieiydfsDrmnvon()tlxrmo3iotlp rlnvs;s0 2toxr3oo1omtelncilt a2rrum no0tetnii3ild a rm(mo u) ltoif3ia1la ranvi;(0s2urxr3ou1aptelfvil(f Dtaur nu4tex  ociadlmDea(mo t4 rerxrcootoat auvo t)t2xmirpoudlp emnvtat  2rm(  ou4tle iieils s ul(mo (4alerxo iydfmDe nei;t0 rtoxm iu4ll emiesl(  Durx oou0tetnifetldlm2rlu pn()altrmf oadlptelnvils)sruriopiy1apte nvtlt)s2tmxrpno4aet if3iad s rmu on(4tlerircto1oa  luvsls)srtmxm3iy4lme lneils aDrmur ;t1teenmi3iltfs ra(vp;t)tlxoxr3tytopte ieil(0truoxmpoodal  mivi () rrr(rpoo0olt io3ilsls2um( s;t0 rerxrcty1fpDr nvo;(  2xrim3iy1om elfeslt)a2ta(mooo0tee  i3iyd s2el( s (4teeoir3totfa  auvs (0sexm(o ny4aptemieta() Drrx p;o1oetn ictaslmDeau p (4aetrxo3iydlm raivil(0sexrxm3ou1oleemncs s)a2umxro;u4opxnifctadfaDra( s t0alenxo oa1lp eaivs t s2uoirpio1op n fci tf Dtrumont1teeomoeiydfa2eauvp;t)aexrxr3tydlpte nvi t srxm(m nu1ap   fct s) 2ta(ro;t4tex  ietadlm uluvsn()arxoio3iotopDr ieol( seuoxrpiy4llen iviat  2ra(ront0oee  o3iydlmDrm(vpnu0teeoio3totlpDelivi;t)texm(m3nu4omt lnes tfartm(mp;t1oee mfeiat s2umu pn(0altoxr ta1fmteln sls0 2xm(m3iu1lle  iei s srumur ;t1tltnmieiatfm ra(mo t) lxrxo3to1oa ranvs;s0setmim3nudam nlici s)sDurxmo;o1alx mieiad m2eanms;(0trtrxr to1fpDrau o s sruoir nu4amtn nctlsfa2rm(rpoo0opeomieiasla2ea(mo;(0trtrmf3tytfm  livi;(  2tmxrpny4apt  nvtat a2uru  nu1opt ifeilt s rl(vp;(0 renxo iatfmDe uesl() 2urxm3oo4lp e ivslt artaurooo1aeeo oeias m uauvp t4altnir3oytfp e ivs;(0t2to(m3no1ome  iesl() Drr(r no4apen i3tls s umu s;u0altnir3iotlpte u s;s srtmxrpiu1lpe mnvia()aDrmur nu4opxnmfeiytlm2um( o;()artomr tytomtrai s t0s2tmxr oo1lpen netls  rtaxr no4oleoiieiaslm2umumon(4alxoif3iytfaDe ivi s0 2xo(o ny1lp elfvi () rtrxmp;u1tltomfetlslaDrmuvpn(0altoir3tadoatranvils) rtr(r io1amt lfvslt a2taumpnu1apenmoeildlmDumums;t4 lerir3tydom  ai s;t trumir3nu1ap nmnvtasfs2ua( p;u4tptnioctldfm2rl(ms;(0alerxr3oy1oa r i olt0teurxopiy1omeelici ( srumxrp;o4tlx  fciydlsDem( p t)teenxr iotop eaivs;s)t2uoxm3oudoptemies s sDtaumpno1aex  ocild a em(von(4trxnircootfa eli s;s sexoxm ny1ameemnei s sDurur ot4tpxoiieils m um(ms u4 lxrxr3iy1lat ln s s  2urio nydomtelfcsa(f 2tr(moou4aleoii3iad aDulnms;(0alxnifcoy1fmt  i ols0 rxmxmpoodole  fvsa() 2urxmpot0tlto i3ild m rmuvo;t4trxrmo3iodomD  nvi ()texmxrpoo4lltn icil(fsrrmu p;o1tpxnmfciydfmDrmums;(4arxrmo ty1faDelueo;() 2ur(m nu4amee fetl(f 2taurp;o1tptnifeiadla ulump t0texoxo io1opDe i sl( teuoxr3ny4lmenliesl() 2ta(mont4olxo i3iasla ranms;t)arxoxfciy1lm eanes;( s2trimpoydolt lfvs (  rtaxrpno1oet ifcildlm2rm( onu0altrmf iadlpDeli o s0 2xmim3nodlmee fvilt)sDurx pot0aexo ieiydlaDelnmo t4 exrxfcoo1omD  uvi ( s2urxo3nydomtn nctls)aDua(rooo4apxn oetatfmDelnvp u)aeeoir3ootlmtrlieo;t0 2xr(o3iu4lleemfciltfaruaumo;o1tet  feiatfaDrlumonu4 rtrmf3ty1fa  liesl( srxr(o iodamte ivsl(fsDta(r nt1oetnii3tlsfm ulumonu0 lenxf3oadfa rli s s)teuo(rpnu1opt lneta()arra(mp;u0olxo ictlsfaDem(vs;() exniocia1faD luvs s  2xmxr oydal n fetltfarraxront4tltnmoeiyt m2um(vont) lerxrcio1fmtr neil(0truo(opoydapeemfvsl( sDrm(r ou1texnii3iad mDra( o;u0aeermo3oo1oa   nvolt0 eurirpiu1llenmict t sDurxr no0apxomfetat mDrmuvsnt4aeenmf3oatop elivs;t)texrxopio1ap  mfetl() 2tmx  ot1alx  ictadfm2uauvp;(4tleoxf3oy1lm   i i ()seum(o3no1omenmfciat aDtrxmoot1oeen ictyt s2ua(vont) lerxr iodoat aiesl(0 exm(mpno1omtn fciltfsDrmur nu0oetoioetydfs2ul(vsnu)tlxnmf tydomt anei s)trum(rpiy4alte ict t  2urumpnt0tet iiciadlmDuln pnu)areoir to1oa   iei ( s2xmimpoy1al emfvi sfs2raxrp;u4tptomo3ilsfmDrmumsnu0teeoxr3tytfatr neo s)srtr(o3oo4lpe  ies s) rra(r no1texoiociysls ulnvpnt)alxoifcootlpDr n ols t2um(r oo4aptn fciatf 2rrxr oo1opeomieiatla2ulump t)aleomf3to1fmt  n s t seumio3oy1lptnmieilsfs2raxm ;u1apto fciytfa2rmu pn()tltrxf3io1lmDeluvi s0srtmio iu4op nlivs s artmu pot4tptoifciys s2rl(vo;(4 lermr3oadfm rlivi;s srtoxo oy4olenmieil() rtaum ot0tpeomoeiltlaDra( s t)aexnmr3to1lm e ues;s0t2toxm3iu4lp   nvs t)s2umxm oo4altoiietasfmDea(vo t4teenmrcoodopt li i;t0trxmxr nodapte ictl() ruaxr ;o1aptnmi3tadls2rlu p (4 renxfcootopteau i;s)tetmiopnudllenlivsls  2raur nu0opeoifciytlsDulnvsn()alerirctadfaD au ils sexoio3iydlp  lfcsl( aDua(r ;o1texomi3ildlm rau snu)aeenifcia1om rln s;()truoirpio1llte neslt)srum(mpot0apxomietysfa2ranmsn(0 rtnxociytfa eau o (0trtrxm3iu4ape  nvs tfsrraumpot0apxoio3iatfa ea(msnu4aexnxr3tadfmD  i i s)t2toxr3ny1om  lfesat)s2rau  nu4oeto f3iytlm ua(mo;t0aexrmoctytfpt an s s0 rxmxr3oodal n fvia( s2trx  ou4aex ifeias a rluvs (4trtnxrcootfa  li s t teuoxopno4al nmfei sfsrumx pot4olxnmictls mDran ont4 eeomr io1lpte ies t) 2tr(m ny4openmnetls  2uaump;t4oeeoif3iad s2umuvont0 etrxo3oydfaDeau s t t2to(m oo1lm n ncs tfsrrmxm ou1tpeoioctatla2rl(vs;u) ltnirciy1oat livi;t0 2xoim oo4alt lnvia(  2ta( o;o1tltomociltls ul(von(4artoxr3iydoatrlueols)t2um(rpnu1apee ieiat srum(rpot1tpx  ieiltla rln s;u0tltnmo3oo1fpDr i o;s trur(m3io4ale mnesas s2tm(ro;t1olx  feiydfmDraums t0 etrif3totlptelies ( t2tr(o3io1apeelfvia() Draxrpnt4ole ioctat sDua(vs u)aexrmo iotfaDe i i;( trur(opio4am nlfet s)aDtaur nu0oetomiciatlmDra(mo (0 rxrxfcoytlp r uvslt0 2trxm3no1opte fciat) rrrumpot4aet miciydfaDuan p (4trxoxo oo1fpt auvs s trtr(mpno4lpte fctlt) rtm(roou0apeniieiatlsDran on(0 eermo3iatlptrln slt) etr(opno1lp emnetat sDtm(ront4apxn ieiys sDumn o;()altnio3oa1laDeln i;s0s2um(rpiudlmtemietatfsrumumpoo0tptnii3iydla ranvp;u0trtoio iytom  aneolt0trxmxopno1omtn nvia( arurxroot4oex miciytls2rmuvs;(0arxoio tadomt  uvol() exm(r3iu1amtelfvtltfa2rm(m ou4openioctytfa um( p t)tetrifcoo1fm eln o (0srum(r3iu1oltn ivta(f Drrx p;o4opxoiiciytlm ua(vs;t)texoxr3io1lmDr ieils t2toiopnu1ame lict s  rta(rooo0openmieiysls2ea( ont) ltrmrciadlp rai i;s s2umxmpnu4lpeemfcsa(farraxmont4optoiieilsfsDrmuvpnt0altrxf3oo1faDelivi;(0texr(m3io1lle  fvi s) rraurp;u1optomfetysfm rmn o;()alxnxr3iotla eaneo s0 exmxm3nu4op nmivta( s2trxr oo4oee ifeiltfs um(vs;u0arxnmf tytfatrauvol()tetr(rpny1ope mnctls)srua(  ;o0opeo i3iltls2umuvs () exoio iatfat anvs s) exrimpnudopeemivs t  2tax onu1tpxn f3iltlaDra(ms (0 exrir to1oa rlu il() etoxo3no4open icia(f Dtr( oou0apeoifciad s2ea( s t) rtnxf tytomtranvi;s t2tr(rpnydlmt  nesls)s2raumoou4oltnmictldls2el(mpnu0 leoif todfpDeau i t0srur(m3no1omenmfetl( s2rm(  nu1tlxniiciytfs2ra(ms ()trxoir3oydfpD  uvslt0srtrir3oydal elicil( arra( p;o1tptnifciydlm umu p (0arxrxr iadomD auvslt  ruoxmpou1lptelivtl(  2rrx poo4aptniieilt a elnvont0 etnmrcoytfate u i;t  exoir3no4lmeemics s)srtm( o;t1tleoiieiys m ulumo u) etrircto1fmDr nvo;t t2xriopiu4altelfctat)arum(moou1tlto f3tatlmDeln on(4tetoxf3ta1fmt  ues (0srxo(r3no4llen feias  Dra(root0aeeoifeiydlsDrau p t4tlxrxfcoo1fm e u o;t trumir3iu4lm emietas sDtmumooo4olenioeiyt sDrmu p u4 lxoio3oatlmt ai o;(0trurxm3iodom nmncsas)sDtrx p;t1tleoii3tld s rl(ms;t4trenxr3io1omDeai o s  2uoxmpiy4ap n nvslsf 2umxmpnt4tpxnmoetyt m2uanms u0 etoir tydoaDr nei t0texo(mpnu4oltnmfetlt aDtrx  ou4aetomi3ilt aDel( p (4artomoctotlatr ueo;( trxo(o3iydal nlncsa(f 2rr(m no4opeo i3iytfs2rln on()tetrmrcootfpDrln slt trum(m3ou1ol emnvtlt)artru ooo1apto ieiyt mDrlnmsnt0 rtoxfciotlpD  i il( s2toio3nu1apen icslt)sDtm(  nt4aptn o3iad s2elnvont4aeeomrciy1lp   i slt seur(r iy1oltn nvi (f rurur no1ole  ieiadlmDranms;t)artoio to1lat livil( srumio3nu1ap  lfct sf Duax ono1olt if3tysfm eaump;u4tlxnircoy1omDrluesls) exoxo3nudom   nesls  2uaxr no4ole mf3ilt s ul(mp;t0 lxnmf3oatlmtrluei t0trtm(mpoy1lm e ivtl(fsrumu  ;t1tpeomi3ilslsDuln o;(4 rtoir3iotlpD ln s t)seuoxo iy1amt  nei ( arrr( o;u4olxnmfctytfs2rmn s;(0arermoctatopt  u o;()trumxrpno4ll   nvsa(fartr(  oo4tlxo iciydla um(vs u) eenxf3oatlaDeai s;t  2xriopnu1al n fvsa(  rtr(rpou0alenmociltlm uln p ()alerxfciatom raies;() 2umio3iudam e fci (  2ur(r ou0aee moeildfa umnvo ()texnio to1lp rln olt)tetrxrpiy1omtn fcs s s2ur(ro;u0oltoiietldfaDelumo;t0alxoircia1lmtelneolt) rumxmpoy4ol n ictl()aDumu  ou1tlx iietadlaDrlu p;(4aetomf3oatfpD lnvi;( s2urirpny1ol   fetlt s2ur(root4oetomfetasfaDrmn p t)alenif to1oaDrlu s;( sexmxr oy1olt livsls)a2tr( pot4alt mi3tydlmDuluvpnu)arenxocoydlp  livs (0texrio3nu4lmt  ivtat sDtm(rono1tet mi3iadfmDem( pnu0 rerxo oadfmDe uvol()seuo(opnu4llenlictltfa2rmu  ;u1openiictyd mDul(vsnu0tltrmfciytoaDrlneil( s2triopou1ameemfvsas artaur oo1olx  f3tltlaDumnvon(0alerxr iatfmt  ues t)srtrxm3oo4apte fcsltf Dumxmo;o4tpenii3tltfs2rmuvs ()altrir3tytfatranvs;t0s2uoiopny1omenmneias  rraur ;o0aeenifctadfsDemuvp u4trxrxociydlmtr u s t tetoir3iodlme mfetl(fs2raxro;o1aexnioeiydfsDeanmsnt4 lerxf3iatoptrli i (0t2tmxr3io4opt  ivsasfaDta(m no0optn iciatlm2ranvsnu0 rtomo to1lp eaivo;s  ruoio3oy4openmneslt arrmxr no1tet  fcilsls2ul( s;t0arxrif iatopDrlnvi s t2toxr nydame lfvsltf Dum( o;t1alt  ieiydlm2emumo t)alxnxr to1la  aies;t)seur(mpiu4lm e ieslt)aDumx  oo0optnif3tldfs ean o;t4 lxnmr3oa1oa rau i;()srxrxr3oy1amen fvsa()srrr( o;u4apxoii3iadfmDrau s (0 ltrxr oy1faD  ueo;s trtr(mpiudopenmfetlsf 2tm(r ou1aeeniieiltla raumo u) rtoif tytfm   uvils  eto(o3ny4ol elncsls)aDtmxmo;t4alx mi3ilsla2rau s;t)tlxoif3oy1faD an i t) exoirpiydopeemieta(fartrxro;t1apt ioeils a ulu o;u4artomf oadlaD aies s0setm(m io4olt mivslt) 2ra(roou1aeenifctldfs2elu p;t4 lxnif oydopD ai o;()texrxrpiu1lltnmivtatf 2rr( oou0tpxomf3iat a ulums t)tltnif3iotlpDeauei;(0t2xm(opoy4llenmfvils)sDumxr ;u0oleo fetld sDea(mo;u)aeeoif3iydfp  auvs t srxoim oudop nmnvtl( sDua(m ot4apenif3tyt s2ra(mpn(4 ltrxr totlmDr ieols0trtoxmpio4olt  iesasf 2rmumoou1opx if3ilsls ulu o;u)aeerir oytoateaues t)srxrirpiodolt mnvtls srtrurpno4tpx  ietlsfm2ua( p (4alxrmrctytopD li s;( srtr(m iu1lltnmnctls srtm(mo;o4olenmfetasfmDuanvp;t)treomo3iatfpte nvo s  rxoxo nu4omee netl(  Dra(mooo1opeomocilt a rlu on(4 rxoifctytfa rluvolt0 2tr(r3oudlle  icsasfsDtau poo1tlen fcilt m elnmsn(4altoir ia1fp rluvslt  rum(m3oy1al n fvslt)a2rm( pot4apenmoeild m2rlumo;t4 lermfcoodlm r ivs t t2xoxr iodop emfctls  Dua(mpno0olx ioctltfs uanvp u4 reoxfciy1fmD  ueo s t2tr(rpoy1apen fctls aDrrx p;u0ope mfeilslmDeluvs u0arxnif oydoa rli o;s)setoxo3oo4altemieias srur(rp;u4tetnmocils a emnmpn(0texrmfctotfmt lnvs;(  etoir3oo1omeemieil(f rurxrpou4tlt  f3iad aDua( o t0tltrio ia1lm ean i;()srxmirpny4oltemnctlt  Duaum nt1ape  o3ilsfaDua(mp t0 rxnxfctatfp e uvols0 euo(m3ou1aleelfvt tfs2umuro;o4aetnmictaslm rlumo (0tleomrcta1op   iei;s s2xmxr no1lme  ncia(f rtru pnu0tpxomi3iatfs el( s;u) eeoir iytfm r ieo (  exoiopiy4amtemfvi () Dua(r oo4tlxn i3ias s um( o;t4 exrif iodoatean i t0teuoirpiy4amtelnvilt) Dur(m no4teto feildfs2rl( o (0 leomrcoytlaD anvi t seuoiopiu4openliet t)arurumpot1opxo o3ils m eaump;(0aeeoxf3oadfmD luvo;s srtmxo3ny1lmtelfvtat)aDtaxmp;t0tpto f3tytfmDemnms ()arxnmo iotlptean il(  2um(r3iydllen neil( s2rr(ronu0tptnmfeiasfm2rl(mo (4aetoxo oatoaDrai sl() 2trxr nu1alt  fcsls)sDrr(mpnu4oex ifeiltfm rlnms;u4tlxoxf oodla eaivi s)s2to(o3ny1al e nvsasf 2umxm ;u0altn feiydfm ra(ms;t0tetrmo iotom elies;() rum(r oydap n icsas  ruaumpou4apx io3iltfmDel(mpnu) ltoif tytoaDrlu ils s2tm(opno1olen fci ( s2raxmp;t0tltnio3iyslsDran o u)tlenmocto1lmDranvo;( srtoxm3nu1lm elneslt aDrmuroot4teto octlt s2rlnmpnu0aeerxo tydlat an i s0srxrim iu4ome lfvsas s2trxmpnt0olt micias a emnvo t) reomo3oatfa  liesl(0 rxm(m no1optelfcils sDtmx ooo1teeomfciaslm2eln o t0arxomrciadfpt  ies;t0 rxm(m nu4alte ncsl()s2rrum ot1tleo i3ias s eluvo t0tltrmrciodla  li s s  etmxm3ny4omtemiesa()srtrx ono1aleoiiciltlm ua(vsn(4tlxrmrcio1omD lu s;(0 rtmir oy4llt mnesatf rtrx  nu0oexoiieiysfm2ulnvpnt) lxrifcoa1la eaieo t0 2tm(m iu1omen fcsl()sDtm( o;u4tlx ioctadls rauvp ()aeeomf3oo1laDraivslt  exrio oy4omtemivt t  Drmu o;t0teto fetat m el( p t) lxomocoytlpDraneilt0t2uoxr nu1lpen fvtltf Drmxmp;t0tpeomiciyslm raumonu)tetoxfcoytlp rai il(0trtmxo iydopeelfci tf rrr(mont0oeeomi3ildlm2elu s;u)trtoir3todoat  nvo s setmxmpny1ol nmivta(f 2trx o;t0olxnmi3iltfmDua(mo;(4trxnxf3ootom e i s;t0t2xmxmpiudom elfcia(fsDrauroou0tleomoeiytla eanmsn(0aeeomocoo1la eluvo () 2xmxm io1opte ieias) Dtru  oo0tpx iictls m ranvonu4tlerxo iadoaDelnvi (0 2xoxr oodlmt lnvsa()s2tmx p;o4tetnmf3iytfm uanmsnt4arxrmrcoy1fpD  n o;s sruo(r3io1ape  nvtlt  rtmu pno1olxomoeiytlm2emu p u4tlxnxoctydoa  lnvs;s0t2uoxr3oodlleemnetlt  ruaurpoo0ape  octldls uau o;t0 rtnif iydopDelnes;(0texr(rpny1lpt  ivs s s2rax pno4alx  fctydla2umu p (4tltomr tatlp   n i s)srurio io4omtn ivi t s2umxm oo4aeenmf3ias s2emuvp t4trenifciydlm  au s;t0seur(o3oydll nlicsa() rrax ooo1olxn i3iysls2emu p u) rtrmrcoy1omt au ol() rumirpno1amt lneslt)s2tmx  ;u4tle mo3iytfaDrlnvo;(4tetrmf3oadlm e uei;s) rtrirpoudllen fet ( a2rru  ot0optoifciltlsDemnvs t0alenxoctatlaDean ol(0seumio ny4lptn nes t)srur(  ;u4aexnmf3iatfsDrl(msnt) eerxf io1fatr ues t0texo(m iu1ll   iesat)srtmu o;u4tpt iietltfsDrm( p;u4tetnmo oatlpt lneo s)texo(mpou1om n ici sfsDua(m ou0apxo f3tyd sDel( s u4 lenifciydop eli s;t  etm(m ou1oltnmfcilsf rrmxmonu0tpt  octasls elu o u)aleoxocoy1oaDeau i;s)tetoxo nydll emici tfaDtru onu0tltnif3iytla2umnmont) rxnircoytlm  lnei s0seto(m nodom nmiet (f 2ur(r nt4aetnmocilsfsDulnvpnu)tetnio3tadomDeaieo;t)tetoir oy1ap e nci t)aDrrum nu1opt  o3iyt s2eln onu0trxrxfciadfpt  i s s0srto(m ou1amt micsa() 2ua(ront4aetn octas m emnmsnt4 exnxf tadlmtrln s s sexoxr nu1op   fcs t)a2trxmpoo1oexo o3tlsfs ua( ont4altnxrctatlatr neo ( srto(opno1omen ieia()aDrau  ;o0opxnif3iyslm2uanmp;(4altnmf3oadlptr uvsls)trum(r iydllt mietas  rrr(r nt0tlen oeiatfsDrau o;t0trenxrciatomtr ieo s0 2triopiy1lm elivi tfaDraumpno4tlxnii3ild s2rln s u4tltnmrcoa1optr uvol(0 euo(m3nu1ope lfesatfsDtm(r ou1ope  o3tatlsDua( onu0 eeomr3iadoa raueo s  2xr(mpno4ll e ivtas)srrm(mp;o1tet iietydfs rmu s ()aetrmocoa1lptraivi;s)s2xo(o3ny4ll  lfci s arrm(rp;u0aeen f3iadlm2ulu o u0tlermfcoydla ran s t  rtmxm nodomtnlivias  rurxrpot1tpeo iciytfm2rlumon(4tetoxociodlm  ln o (0teur(m ou1amt  ieiasf Dum(m ;t1opxnifciytfm2uaump (4teenir iytlpDrln s;( setmir3io1lm  livtl(f Dtmuroot4tlxnmo3iadlsDrmums;(4tltrmocta1oaDrai i;t)teumio3nydomteliesat)artmx pou0tpeomfctysfa2el( onu)tlerxfcty1fpt ln s s) 2umxopiu4lptnlivias a2rm(r oo1tle miciasla2umnmp t4altomf3iodlmtraueolt) rurxm ny1ll  mneiltf 2raumpoo1oeeomocils s umuvont)arxrxr iodoateln i ()s2umxrpno1op emfctl(f Drrur ;u4ope ioeiyd a2ea(ms u4 reomf3iotfpDeaies;s  rumxo nu4oltemiei s  rrmurp;t4tlen f3iltla rmu o (0trtomf iodlmDeaivs;s  euo(m3nydlp n fvt t  Dtm( pot0tltnioctadfm eauvp;u4 lxoir3io1fpt li s;s seumxr3no4ale lfei (fsDraxrp;u4openmoeiydfm2elnvpnt4texnmocty1lp   n ilt  2tmxr3oy1lpt livtat)srur(  oo1alt mietadlsDea( p;() exoxo3tytoa ranei;t s2xrxmpnodop nlics ( aDrau p;o1opxo i3tltlaDeaums t0aexrmrcta1lat anvo s0 ruoxm3oy4ape mnes ( s2rmxrpno4aptn oeiaslm ranmp t4tlxrxf3ia1fmDraueo;s0 exoxrpou4opt  ivs ( sDumu ont4apxoii3iadfs2rmuvonu)tlxomo3todomDeaies;s sexrxrpnydlmtnlfvsl()arrmu  no4aptomoeiatfm umu s t4alenmo oo1fpD auvs t0srto(r3io4ap  lnetlt)srrr(ronu4aptn icildfm rm(vs;t)tltrmo ta1fm e ivs;t  2xm(rpiy1llenlivs t)srurxmooo1tlxnioeiad aDuan s u) reomr3iodlpDr uei;t0 etoir3ny4lpe mnvi ( srtmuront4tetoioetldfm uln o (0aetrmf3io1fpt  nvols t2toxmpiydap   fctltf 2tr(root4tet  ocilsfaDuauvo ()altomf tydomDeluesl(0 2urxrpiydlleelies t aDurump;u1tet  oetyt m2rl(vsn(4 lermr3ta1lm  aivs s0t2um(r ou4opeemnes sfs2uaur ot0tpxoifetldlaDem(vo t0 lxnmf3iadlmteai ilt0srtm(o nu1ap elncsa(fsDur(  nt1ale  o3tyt m rlnms;(0aexnxocoadfp ranvo t tetm(mpnodlp   nci (fsDur(mpou1tlt  fciytfm ea( o;u0alxnmo3tadfaD aueils)srtoxo3oo4lpte nciatfaDtr(m nt1olxnmictydfa umu p (0 lenif oodoa r ueo s  rtmxopny1omeelnei t)sDrr( pou0opt mo3tld m2umuvpnt4trtoio iytfm   ues ( setrxr iy4om nmicslsfsrta(  ;t0tptniociadlm2rm( s (0 ltnir tadlaDrluvi s0srtoxo3oo1al  lfcil( srraxm ou1oee  f3iat aDul(vp t0 etrxf iytlpDraneol()srtmxm3iydopte fvta(f 2tau pno4tpe iicilsls2rln p;u4 etrmfcio1fmte i s t0trxoim3iu1al  lics s)sDrr( ono1opxnio3tldfm2rauvonu) rermrctatlpDrauvils) rto(opoo1apenlfeslt) Drr(  ot4aetn feiyd s2ean onu) rtnirctadoptrlnes (0 eurxm3no4alt  ivt (  2tmxr ;o0tlto f3tyt s uln p (0trermf tadomt lnes () eumim3oy1lpenlfctlt)artmumpot4tet iieiad aDrlnmo;t0 rxrmo oytoatrli ols tetm(o3iudam  lfcias)s2ta(rp;u4alenmfetat m rmn sn()trenif3to1optelivo t)s2uo(m ny4ol n ivtat aDumxr ou4opxnmo3iadfm el(vs;u) rxomo iotopDrai s;s trtm(opoydolen fctltf 2umur nt0tpe ioetysfaDulnvs ()aetniocoadla eln olt0s2xoim nudlptemfes s a2urumpnu1tpeoio3iytfa eluvs;(4 rxomo tatlp   nvilt)t2xmxopoodalt  ivil(  Dtr(roou4tlxnifetys m2uan snt4tltrxocia1fpD  nvo;s0 exmiopiydaltnmfcsat arrmuront1tlx  fciadfm ua( on(0arxrif ootoaDran o t0teuoim iy4lpenlnct s  2umxrpno0oeen f3iytla ua(msnu4altoxo todlpt aieolt  2xoxmpoy1ape mnvia(fsrtaur ;t1aexomociatfs rln o (4tlenxo tytlaD  ueils) exr(mpiy1amtn ici tfa2tmumono4tpe  ociasfs2ranmo u4artoxo3oydopDelieo;t0t2xoimpnydalt mfvi s  Dumx  nu0oetnmi3iys aDulnmp u4treoxfctotopDrau i;t0t2xrxr3oy4lmtemnvi ()srtax onu4tex iietydfsDrln s;t0arxrmf oodlm  lnvi;( t2xo(mpoodol   fesl( s2taxm ou1oeeo oeiytlm2rmumon(4artoif oa1laDraivs;t  rurxopio4lptnlicsa(f Dtmurp;t4tpxnmietld aDrmuvp (0tlxrxfciodlm r ieo ( s2umirpnodop eliesas)s2urur ;t1aetomf3tys mDranvp u) rxoir3iytopDraneo s0texriopoudaltelfvtlsf Dumxm nt1tltnifeildla elu snu4tltrxf oo1fp rlieilt setoim oo4omeelivt t)artrumoou0opeomi3iyt sDul( p (0trtoio3tadopD livo;s0 2xmxrpiu1amt licslt)a2ra(  ou4oet  ociatls uau pnu)treomr3oadlpD lneols trxoxopnudal nlnetlt)aDtax ono4open feild m2elnmo;t4tetrmrciy1oa eai s t0t2to(m3nu4op  mnesls)artaxmp;u4alenmietltlmDeau snu)treoxr ty1fpDrlieols0srur(m iudoltn ieta( srurur oo0tlenif3iyt s ra(vs;t0aetnxf oydlp e iei s0 rxmim3iy1lm nmncslsfsrurx pno4alx mfeiadlm ran pn() eermocio1lm eln ols srxrxopiy4apenlfvias  Draump;t1tlenmiciat mDua(vs;(0tlxrxr3tydomte nei s0t2tr(o3no4lm  liesltfsrrm(mp;o4open fciyd sDeau s t4alxoif ty1fpDeli il() 2toxr3iydop  mfvsls) 2trx ono0aleoifciaslm ra(mo;t0aeeoif3totlm  au il(  rxm(rpiodal e fvias aDum(  ;t1ope iicild s elnmo u0aleomo oadoaDe ues t0setr(rpny4amtn iviasf Dum(rono0openmictad m elnvsnt)arermo oadlmDraivo ( teurxr iudaltn net t)aDrr(r ;u0apeoii3iatfm2rl(vsnt4trenio ty1omte nvo s0 rurirpiu4op  micilt)aDraum nu1tet mo3tyd a ulu o;u4tlxoif3iatla rai o;()trtr(opny4oltelneilt)sDurxr nu4aexniociyd a2el( o (4 leomfcoodfmtr i o ( teuoirpno4lm  lncs s)srtru ono1tptoio3iat m2eaums () rtoxf3iadomtrln s;(  eurxo3nodop emfctls) rrr(mpot0alx  oeias m2um( s t4artrxrctatfp e uvs t sexmxo3oo1apeelivsat  Dtmu oot4opto f3iysfmDem( ont0teerxr tydfm   ueo t)s2to(o iu1opee ivias  rtaxrpoo4oee  fetadfm emumo u4 etnmrctytla eanvs;s trxmxrpoudlpte fcsatf rum(  oo1optomfciaslmDrl( p;()altnirciatlat lneslt)t2tmxmpoo1altnmfeias  Drmu ont4apxomfeildls2uluvpn(0tltrir3oytop eanvs t)sexm(m3iy1al nmnetlsfa2um(m ot0tlxomfetldlsDemnmp (0arxrio3iy1lmDrai sls  2uo(m3iodlpe  iesas) 2trx o;o4tltn feiatlaDuln p (0 ltnmocoo1lmDrlueo s) rto(r nodalen iei s) rtr(moou0aeenmfciltfs2raump () rtrifciodfm e uvil(0texmxm io1amte ivtl(  2tr( p;t0apen ictydlm2ra( s;(4areoxf3oadomtraueol() 2um(r iydapt  fet t) 2trxmo;t0ole ioctad a2uan snu0trtomrcty1faDr u ol( tetr(opnudapenlictls  rtmxr ;o0opt if3tls m ul(vsnt)tltrmr3ty1lmt aieol()seuo(opio1al  mfvsat srur(ro;o1tpt mi3tydfm2el(vs;u)trenmo iotfm r ueils0trxo(m3no1lmeemnvsl(fsrrrx ooo4tpxo feildlaDua(mo;u0aexoifcta1fptranvi;t)trxoir3nu4aptnlfcilsfsDraxro;u4apen fciltlm2elumo;(0 etoxocio1faD livolt0t2toimpnudopen ictlt arrm(ronu0opxomieilsla rmnvp;(4 lxnxr todoaDe ivo;()t2to(o oydlpen ictltfsDumurono1alx mocilsla2emnvpnt0 renir3tytoptran i t trxmxo nu4alt lnctl(fs2rm(m ;t1tltomo3iyt mDrl(vs t0 etnxf3iotom  lues ()setoim3no4oleeliviatfa2tmurpot0alto o3iatlaDemuvsnu0treoxo3oatoptrlues t) rtmxmpny4ol emietat a2uru  ou4tlenmiciyt m ua(vs;u4treoircoy1fa r ies s)texm(m3oo4al  lnesa( a2rrx ooo1tlt  fetld sDum(mpn() rxrmocty1faDrluvs;t0trto(o3nu1olee ietat)sDua(r ou1aeto i3tyd s2raumpnt4 renxf3iadla eln ol(0sruo(mpoydlpenmfetas) rua(mp;t0tpxoiieilsla em( pn(4tetoiociodfptr nvi;t t2toio ny4apee nei tfsDuaum ;o4ale  i3tldfsDrmn sn(0altnmrctadom  auvi s0setmxr ny4ame mfcs (farrmxmpnu0oee moctydlm2rlnvonu0trxrif3totoate nvslt0truoxm io4om n ivsat)arraxmooo4aeenmfciydfa2ul(monu0aexomoctadoa e u s;s0teumxrpou4om   ictls  rumumpoo1ape mf3iyt mDuan p;(0teeoxr ty1fpte uesl(  rxr(mpou4llt  ivilsf rtr( pnt0tpxomoeildlmDranmp;u4 lxomr tadfmte i s;t0srxoxm nodaleelnct sfarrm( oot0oeenmociatfsDrmnvsnu4texnir3tatfp e ivs;t0 ruoimpno1amt  fet sf Durum ;u1aexoii3ildls rlu p ()texnxfciadomtrlu il( sexrir iy1lm nlicsl( a2rr( oou0tltn o3iytfs2eau o u0aexnmf3ootlmDelivs ( s2trxm oodlptemfcsl()sDtmumooo1tpenmfetydls ulu o u) lenmf oadop ean o t t2uoxrpnudlm e nei t)arta(rpoo1tpenmociydls2rln pnt0teerxoctatfaDeanvo;t  exr(m iodlle mivs tfsrur(m nu1alx mfeiaslm elumo u4tetriocoy1oa raiei () 2uo(m oudlm emivil( s2ta( p;o0ole ii3tasla emumo u0 etoxr tydlate u i t  2tr(rpoudom nmietl()aruauro;u0texn oetysfm2ea(vs (4 rxnmr3iydomDrlies s texoiopny4lptemnetls  Drmxmont0aptn o3tlsls2rmn snt0arxrxociytop r ivo s t2uo(m no4lme mncsas)sDra(ront1teeoiictltls uauvo;()artoxo3totlate u sls) rxoxm ny4lmenmieils sDur(m no4tpen fciydlmDrm(ms u4aexrxf ta1omDelu s;t teum(m oo1op  lict tf rumxm nu1aexomf3tlt a2rmumsnu)arxnif3tytopD luvs s0s2ur(m ou1op   iei t)srra( pnu1tex ioeiyslm2ra(vp u)artoxo iydlmDeanes;()sruoxrpou4lp n fcsasfartmx  nt4apen ietlslm2eln p t) rtrmf3ty1lm  luvi (0 2tmxm oydom nlfctat)sDumum ou0tpt if3tldfm2ran s;u0 rtrxr iodfm elivi t) 2uoxm oodamtemivt sfa2umumoot1teeomfciyslm2elnmo;(4artriocoy1fp ean s;t0 2xoxrpnydap elfetls)srrr(mpnt1olenifctlsfm emnvs u4trtrir3tatfpD  ueil()srxr(rpoodopee fetat)artau o;u0altoiictasfaDrlu p;u0arxrmf io1lp rluvi s  rxmxm no1lmt lnetl(  rraurono1tee ii3taslsDrlnvp;() ltoxocto1lpD  u o ( s2urxo no1llenmivsat)a2taumpnt1tlxn f3tadla2emu snt0altoifciydomDeluvi t0trxr(r nudopee iet () 2uau pot1openmfciysfm ulnmsnu0texnmo oodla   u s s trxr(o iydapeemfcs s srrrurpot4ale  iciat a rluvont0alxniocto1lm rlivilt)srxoxr iudope  nvsa(  2rm(m ;t4olxo fctaslsDem(vsnu4altniociy1oa rau olt srurxm no4lpeemfvt sfsrumxrpnt0oex  i3iydfs uln p (0trtrxrcta1lm ran i t0 2toim3nydomeelies tf Dtr(rp;u1openmoeiltlm rm( s;u)trtnmfcty1fptrau s;s  rtm(o ou4olen ivt t arurx  no0aet mo3ildfa ulnvs t0 exrmfctotfateaivslt t2umxr iydlpenlieil(farrauronu1opxoifctlsfsDumump;t0tetoxr oatla  lneils srtrimpny1olenlfvilt)sDta(mo;o0oeenmfeiysfsDrmump;(0 lxrmr oatoaDr u s s)trxmxrpoo4ale  fvs (fsDum(mo;t4oex  ociadlsDum(ms ()alxnif3iy1om r uvs;s)t2urxopiu4lpt lieias)sDur(rpot1olen i3tltls rm( s;u4aeerxf3oadlpt  ues () rtoio oy4lpenlnctl(f 2urx ooo4altnifctysla ra( o () eenxf oa1lpt li o;s0srxm(r no1alee nctl(fartm(rooo4aleo i3tyt s rlnvp u)texnio3iadfmD aivsl(0trxrir3iy1ap  lncsasfsDumxrono1aeen feiadfaDrlumont0tlenmr3oytomtr ies;s)srurxrpiu4lptemncsltf 2rr(m ou1aex  iciatla2em( sn()tetoio3ty1lm eanvils  eumirpoydll nmfeils s2trx o;o1aeen ictas m2uan p;(4teeoxfctydlpDrau i;t) rumirpnydol nmnet s aDuaum ;u0tpxomo3iytlmDrmu o;u0aleoxocoy1fmt  i o;t)sruoirpnu4ol  lnctas  2raumpoo1tle mociytla2ranmo;t0 etomrciytoaD aiei;s0setriopnydlm e ieia() Drru  ;t4apt if3iaslm2rmumpnt4 renio iy1lpt livo (0setmio iy4lp e ictls) Dtm(mo;u1tlxnio3ildfm2ran p;t)trtrxf ootfptr neol()tetm(mpoy1ole  iciatf rururpoo0oex mi3iasfa ul(vp t)teermo oydlpteln s;t)texoxr oo1al  micilt)sDrrx ont1oexnmfcilsfm2emn o u0aeermr3oydfpD aies;t0 rxmxm3iudlptnlfeiltfarrrx  ;t4tetnioeildfaDem(vsn(0arxnxr oytlatrlneilt texoim oodamtnmicsat aDtru  nt4texoioeias a eluvp;t) eeomo oodfm elu slt)srxmiopnu1ll  mfeiasfs2taxm nu4olxo oeilsfsDumumo;(0alxnxrcootla e ivols t2umxr nu1altn fesltfaDuaxm nt1tlxomf3iltfa2ea( s;(0arerxf3ia1lpteai i;( truoir3oodomte fvs t aDtm(rpno1tleoiietlsfsDua( o;(4texnio tatlm r n o s)trurim oudlmtelncs sfa2umx oou1openiocilt m2eanmp u4 rerxr oy1faDe i o;s0 2uo(m3io1amtemnvt ()s2tm(m nu4ole iietas s eanmonu0 lxoif3io1la rlies;( s2tmxmpiodamtemnct tfarraumoot1oexoiiciytls2rmn o t)areoxf todopD an i;s)trxmiopiu1op n fetat)s2umxroot0oltomf3iadla2elums u)arerif to1fmt  i i;t0 2xmxo3oo4al e ictat) Dur(mp;u1apxniieiysfm2ul(vsn(0 exrmo3oa1lm eluvslt setrim3oo4lm nmivt (f 2rm( p;t1aexnmoetas s2em(mp;t0aexoxr3ta1lmte u s;t  etm(r oydom emneil(f rurx  no4tetnifctlsfa eanmon()tltnxociytfaDrlu slt)s2umxrpoo4am n icsltfsrumu  ot4tpx mf3iadfa ul( s;t)tetniocoadfa rauvi t)srxo(r ou1ap e fei t  2umx p;t0tltoif3tysfaDua(vsn(4tlxoif iytlp rai s;s t2umxmpoy4lm nmicsl(f rua(rpoo4olxn fctld m em(vp;()tltoxr3iatomDe u ils s2trxr io4am elnes (  Drmxm nt0oee mfcias a2raumo (0aleoif iydfaDr n ol(0s2uo(m3iy4opt lnesat  Dtrx onu1tpe  o3ilt s2rm(mp ()altomrcoadomtr uei;s seurxopou4llt  netl()srua(  ot0teenmf3tad mDulnmp t4texoxo3oa1oaDranvs;(0 rxoim ny1lle mfcias) Dtr( oot0aexn fctys m2ul(vs (4 rxrio3iadoatrlieolt0trto(rpnodlmtnlfetls  2tm(mpoo4oexomicilsfa ulnvsnu0 reomfciotfmt  n s;t  rurxo3iodame mnct (fsrtm(m no0optniocilslmDul(vsnu)alxrxr oy1fmt  iei;(0 eum(opoy4apeemfvsa(  rtr(m ou4optoifciytfs2eauvont)aetrmrciatfaDeli i s)texm(r3nudap  mict s)artaxmont1tleo fctytfm uauvs;u0 lxrmr3ia1lat au i s0 rum(opiu1ll   ivi s) Dtaxroot0aptnio3iys s rlumo t0 rxomocio1fa eln o t0 2tmxm3nu1omt  fcilt) Dtrxmoot0tpenii3ildfa2rl(vp;()trxrio3ootopt ai o s0trxoxo no4lm nmfet t)aDtrur nt4apeo ietydlmDuluvp;t0altnxocta1la  aieo s0setoim3ny4lpt mnetl(  2urxrpnt4aetomi3iadla emums;t) exrif oytopDelieil(0texo(o iy1olen ncil(f rrr(mo;u1tee mociyt mDra( sn(4aexnxf io1fpteaieo ()t2toxm3nodlp nlivtls) 2trxm ;o0oexomietydlsDrlu p u)tlxomo iodlmDran o;t  2urxo3iodop   ieiatfarrmu ono0apxn ieiyd aDumnvp;(0 etrir oo1opDrlnvo () eumir iu4lmtemivtlt) Drru  no0apx mocilt a el(mp ()artoiocto1opt  nvi;s)texr(r3iu1om nmfcs (f Draur oo1tlxo ictat aDumuvp () reoxr3oodfpD  ies;t trxr(m oy1apee ieias aDrru  ;o4tee mocias s2uluvsn(0 rtrmf tadla eluvi;( s2um(m3nu4ll  lfetl(  Dtmu o;u0texn oetyd s ean s u0trtrxo oodfa raues;(0t2xmxr ny1om   feia() Dtr(mo;o0aexn feiatfm2ea(ms (0teermrcoadoat aivil()srtmimpnu1llte nvtas) Drru pnu4opxn ociadlm rlnmp () reomr iadfmtrlivol()trxoxrpio4ol  lnvils a2ra(r ou0opxn f3tytlsDrm( s u)areoircia1fatelies;t  2tmxrpoy1alt  nvtas arum(r ;u4alx if3tls a ra(msn(0teeniociotlmteau ils0setoir3io1op elfctltfs2tax  nt4oeto fctyd mDrl(vp t4altnif todfaDr uvo;t setm(rpiydoltnlfci s sDtaur ;o4teen icias a2em(mp t)teeoif3oytom   nes s  2xoxo nu1ope mncsasf rra(monu1ole mietysls ua(mo;()arermrcta1fmDe ies;()seumio3oodol  micslt) rtru onu0oeen f3tltla ulu s u0aeenmrcio1la e nei;s0t2ur(r iudlptemfciatfa2raur oo0tleo octls s rm(ms;t0treomrcty1lp  auvs s0setmxm3nu4omtnmneta( sDuaum no1olxn oetltls2uauvp;u0tlxrif3iadlatelueil( tetrxo iodol nmfeils aDurx pnu0oetnmo3iytfs rmnvs u) lxrmf totlpDr ieilt0srxm(o iydllt  ivsls) Duaxmo;t1tlen oetytfsDumnvs u0 ltomoctydfmDeli s (  etrxm oydopt  fct () ruau oot0apt moctadfaDulnmsnu0alenif3ta1faDelieilt0t2umxo nudamtn ieias sDrm(mono4aexnifciytls ean pnu4aeeomr3tatomD  ues () 2xm(o3iu4lmt licslt  rrau  ;t4optnifeiatlmDrmnms;()texrmfcio1lpDeau s;t0trtm(rpno1lltelicsatfs2ururpnu1tlt  i3tldfs ul(mo;u0 lxomr3oatlpDrau i;()s2uo(rpnodom   ncia()a2rrxmpno4oetoii3iltla2emumo;u) lxnmf oodop r ueo;t  rumxo io1ll elivil() Dtmxr oo0oex mi3tltfm el(vs t4tlenmfcootomDran i;t)t2xrxmpnydalee fct tfsDrmum ot4tet iietys m2umu o (0tlermo iadlpDe i i t0 rurim3oo4lle lnes s arrrx  ;u1oexnifeild a rlnvo (0 rtnir3oo1faD lieo;(0teuoimpiu4lm nlfctl( sDum(mpno1tetoif3ild s2elu o (0 lxnio ootfptrlnvi;s0s2xm(rpoy4oltnlfvsls) rtmx pnt0olxnifetad a2ra( s;u0 eeoif3todopDeln ils)s2xr(rpno1ope  iet tf 2tr( oot1aptoii3tyt m2uanvpn(0 rerir3tytfm   ieo;(0s2uo(o nudope mfvtatf Drrxm no0tee iociad a um( o;u0 rxrmr tadoaD aieil(  2xrim io4ol e ies s s2ta(rpot4alt  iciat s ua(vo (4trtnmr ia1optean s t0 etmir3oodol emnvilt  2trx ont0olenmo3tasfaDeln s u0aetoxf3tadla rlueols) exo(m3iy4lm emfvi ( a2ta(rpnt1aee  o3ilsfa rmuvs;(0alerif iatoaDr n ol( srxrxo3io1ole mfeilt a2rmxmo;o1tpx mfeildlm eln o t4trxrxf oy1faDrlnvslt)srtmirpnudlmte fvtl(fs2taxmono0opeomoeiydls eln p;u0trxoxf3oy1oateln i (0srtr(r iu1ap e fei tfartrxrpoo4aexo feiydlmDea(vp;() ltnmo iotfm  aivilt0srxrim3iydop  mnvtls a2umurpoo1opx  i3iydlsDeanmonu0tltrmf3tydfpDraues t)srtr(r3iy4al   nvias arrax  no1tpxo fciyslsDrl( s;u0areoxo iydopDeaies;()sexo(r nydll elfvt ( sruaxro;u4tpe if3tld m emn o;t0alxnxrcootlmt li o s) 2xrirpno1lpeelivs tfs2tr(  nt0opt ifctytlaDemnvon() ltnxf3iadfate ies t texrxopno1lmen iet ( s2rm(mo;u4apt mf3iatlaDrln o (0artoxoctydop r uei (0srtr(m oo1ole  neias) 2uaumoot4tlx iieiys a2rmu o;u) leomr tadlmt aieo;s0 rxo(m3oo4lm nlnvt ()aDrrxroou4tpeniictltfmDemnmo (4 exnio oatoateau o s0 2uoxm3iudoleemici tfa2uaxroot4oexn o3iasfs rmnvp u) eerxociytoa  anvi s0t2toim3oo1omen fvtasf 2tmx  ;t4teeniocias s2rmu pnu4 etoxf3tadopDr i sls s2xoio3ou4lpee icta()a2tmu  nu0aleo f3tlsfaDrmn o (4teenir3io1fpDrluesls t2toio iy4apeelivs sf Dra(  no4oee mfcilt a2eanvon() rxoxf tytfm rlieil(  rxrxr3io4omtnmfeslsfs2raumooo0apto f3iyt mDemn s;u0altnxr ty1la r ivo;( srtrir3io1amtnlfcsasfa2rmxm ;t0aexniietatfa eln on(4tlxomf iy1fpDean slt) exmir3oydalenlncilt srrmurpno1teto octld m2rl(msnt)trenircootomt auvi;s t2xrimpoudal  micil()aDuax  ;u4alxoifciyslm2uanmp t)trtoiociydlp  aues ( seuoim nodlm n nctl() Dtrxrpou4tltnmf3tys m2eln snt0 renmf iatlaDeln ols0srxmiopou1aptnlncslt)sDrrx poo0aet  o3tadfaDrmumo () ltnmr3iatlpDeaivsl( setrimpoy1apeemfvil()artaxro;u1tpto i3tlsfm rlu sn(4 exoxo3oytlm  au olt  2uoxopoydopee fvt tfaDrrurooo4apx  oeiltls elumpnu) lenif iotla  au ils  eumxm3oo4al  mfcs ( sDua(ront0oexnio3iad sDelump t4alxrmr3ty1opt  i il( trurxr3nydam  mneils srtaxmpnu0aetnii3tld a ulums u4tetoxo3oo1fp ran s;s0s2xmxo iu4lme mfvt sf Dtrxrono0opx  o3iysfaDrmnvs u0 lermoctatopt lnvo (0trxmxm nu1lle mfvia(farum( oot0tltoiiciysls2emuvsnu0tlxrxo tydlmtean o;s t2umir oodap  mfvslt  Dtru poo1texo oetadfs ua(ms u)trtnmr ia1lpt anvils0trxm(m nu1oltemies t s2uru ont4aetnmo3tatla2ran pnt) rxnmr io1omD lnvsls0s2uo(m oydlme  nes (  rrr(rp;u1opxn ocilsfs ul(vs;t0 exoifciadom raivi s t2um(m3iydlpeelnvtas)a2rr(m ;t4tptomfciytla ea(vp;t)aeermfcty1op eluvi;s)t2xoxrpiu4am elivi (faDurxmp;t4aeenmf3ias a em(vp u)arxniocia1om e n s;(0sexr(r iydop  mfciasfaDtmu p;o1oltn fcils sDeln on(4altrxrctydfaDeli o;s s2trir3oydap nmnvtl(fsrtmurooo4oet io3tys sDra(von(0 reoxf totoa e u slt trumio3nydapeemfei (fsrtru p;u0oexnmfciltfm2ea(vsnt4altnifctotlmD au s;() 2triopoodlptemfctat  2rax pno4aee mocias s umumpnu)tetnmf3iytomtrlieil(0tetm(o3ou1am nlnci t srtmu oot0opxnmfciatfa2em(mp;t0aexnio3totopte iei;()t2xm(o3ny4olt lietls) 2ua(m ou1tpx mf3iatfaDranvonu4aetrxrctotoateluesls srtr(r3io1opeemivsasf 2rm(m oo0olxn ietytfmDuanmo;t4aleoxoctodom rlnvs;t0trtrim ou4lme  nct s s2urx  ou0tpeo ictldfaDumnmp;u0 eerxf3ia1opte nvs s)tetoxm iodal nmictls) Drrxrp;o0tpxo i3tyt s2elums;u4tlxomf io1lpD auvsls) euoxo iy1lmte ncta(fa2um(r nu4tetomf3iyd m2ulumpn(0arxoif3ta1op ranvols t2tr(m iy4op nlnet sfsDra( pou0tpe mfeiys s rlnvp u0aexrmf oy1fp eaieo;t  rurxrpiudop  mict sf 2uaum nt1tptn f3ildfa2el(mp;u0 lenxo3tytfaDe i s t)srtmxmpiy1amtemicsatf 2umu p;t1texoiociadlmDranmo t4trermociadomDeln sl()t2tmxmpny1lm  lieia() 2rax p;u1aex mietysla2rmu snu4 lxrxf oatlp ranvs;( trtoxopnudom emnci (  rtrxroou1opxo fctld m el( s;t4aetnmr iotlpD au o;()s2to(rpiu4al emfcia( aDumx pot4apto feilsfm2elu s;u0aleoifcoadomtean sl( truoxrpny4ap emicilt)a2tr(  ot4opxoiictydla eauvs;t)altrmfcootlaDrlivs;s0trxoxopno1omtnmfcilt arra(r oo1oltn ieiadfs2uan s u0tlxnio3iatfaD ai slt0s2toxr ny1omenlfeiltfsrrmu pot1tlxniocildfa rm( s t0texrmocoo1oat auvi s0srxoxo3nodope mnctl( aDumumoou4oex  oeiyd a rmump u4texrif oydoat lu ols  2urimpiy4ole lnci tfsrta(root0altnmiciydfm2rlnvo u4 rxrmf oo1fm  li ol(0teumxr iydlm  mfvsa( artmxmo;o0opxnmo3ildlaDelums ()aeerir iytom eanvs t0 2uoio iydalenmfes s srurx pou1tpe ifeiys aDuln p (4 rerxociytfa   nvolt seur(o3oy1lmt  fvi ()aDurxrp;t1aet miciydlm emu snt) lxomrctodopDr nvs;s0trxoim3nu4lpe lnetls)a2ur(r oo4aeeo f3iat aDrl(vo;(0aexoxf tydlatrlivo;t)texrim3iodllt mncslsfsDur( oot4aeto o3iltfsDra(vs u0 etnmrciatoaD lnvi;(0 rtrxo3oy1opeemnvsatfsDrmxm nt1apx  oeiysla ul(vo () eenifcoatfm elivo;t0tetmxr3iu4lmte ivt t s2raxmont4tlxomi3tltlaDrluvsn()arxnmoctydfaD livo;() rurio3nu1lmtnmnvtlsf Dur(m no1alxomoctatlm ean onu4 eenxf3todop r ueo;(0seurim3iy4ope lnvil( srumx o;t0ole io3tadlm uanvo u) etrxrcoa1fm eauvs;(  exoxmpnu4openlieilsfarrr(m oo1tpxoii3tad sDrm(mo;()arxrmr3to1optran s t)s2tr(m nudam elivtlsfaDtru oot1optnioctydlaDeaumo (4aetnircoodoaDeauvil( s2xr(m3iydop nlneias aruaur ;u4ale mfeiysla elumpnu4aeeomr iatfp   nes s)s2tr(o3oodopt  ieilt)a2trurpnt0ope moetls a rau s t0 lermo oydfp raiei ( s2tmimpno1omtn feta(fartaxmp;o0oeen i3tasfa2rl(vo t)tetrmfcio1lat lu ols  etoxo nu1llenlicta() Duaurp;u1oexn oeiysla2emuvo;t0aetriocoytomt  ieilt0tetr(m3nydlmt lneils) 2taumoou4oet if3iltlmDulu on(4aexrxr3oydla raivs s0t2umio oy1amenmict s) Dur( p;o1alenmietytla ulumo u0 rtoir3oatla e iei;s t2uoio no4lmt lnvtl()aDtrxronu0teen o3iyt s ulnvp;u0arerxr ia1omt lu s t)srur(r nodom  mfcilt)s2tmumoot4aexomiciydfsDelu p;t4teenxocoytla eln i s s2to(rpiu4am nmictat  Duaxroou1opt mo3ilt m rm( o;t)arxnmr3oatlpDr ies t srtrxopou4alte netat  2raumo;o0apxn oetydfs2eau pnu4 lxnif3ia1omDe n o;( s2tmirpiodom e ncs (  Durum nu4tptomfctyslmDrl( p;t)alxomocoy1opD  ueol()t2urirpno1olenmieias sDrruro;o4teeomoetltfs2rl(vo (4teeoxfciodlp   i o;t  2xmxo iy1ole mnvs tfaDuau onu4oltomi3tlsla rau on(4trxrmr3oadlatrau i;s  rtmirpnu4oltelieia() Dumx  oo1alto iciadlsDrauvo;t0 lxriocoatlpD  ivs () 2tmim iu1omtnlietls  rtrurp;t4tpenmf3tysfm2ea(vont)areoxf iytom r ueol(0t2urio3oudalee iei t  2umx p;o1aleomictatla2ra(vp;() rerir oytfptrlivo;t setm(r3iydlmt  fciasfaDumxmpnt1aptn feiat m2rl( p u0 rxriociy1fat  uvils)s2tmxo no4amtn fct ()sDtaxroot0aeenioeiytfs eauvo;t4 eerxf3tadlaD aivol(0 eumir3oy4lpen ivslt)aDum( p;t4ope iictlt s rauvs;u4texrmoctytfateanvols0s2xoimpou4lm  mfvil(fsDur(  ;u4ape  o3tytfaDra(mo t4aexomo3iatlm elivs;t)sexmirpiudom nlnvia(  2trx p;u1tet mieiat aDemu ont4 etnxr3oa1laD lu ol() exr(mpno1aptelnetls a2ur(r ;o0aetoiiciytfm2ul(vsnt4tlxnmf3iy1omt ln sls0 2xm(r iudameelneiat aDtmurpou4aptnmo3iatls em(mp u0areoxr3ta1omt anvilt0sexo(r3iu1lm   ncil( sDtaurpnu0tetn fciadfa2emn s (4aexomo tadlpDraivs;(0t2umxopnu1opeemicil(fs2tau  ou1aet  f3iydls rlu o (0 eenio3iotfmt liei s) rumxr ou4alte icsl( sDrax pnu0opxnioeiatfa2ea( on(4 etrmocoo1lat ai olt0t2uo(m3ny4apeelfvilsf Dra(ronu4aeeoioeiyt s2rm(vo;t0tltoir3oo1omt  n o t  exm(opny1lmen ictas a2trxmp;o4optnmieiatlsDrln p u4 rxnio iotfp  aies ( t2uo(opnydapen neia( arur(rpno1tle  ocias sDemuvpnu4tlxomr3ty1oat ln slt0 rto(rpou4lm e ivi ()arurx  ;o0aexnmoeiydfa rmn pn() etniocto1fmD  ivi s  2to(rpny4al emnetltf rraxmooo0apen feildfmDem(vp;(4 ltnif ty1fa e i s (  exoxmpiodaleemnes t)sDrm(m no4aexo fcias s umuvonu4 ltomfcta1fmt auvo s  euo(r nu1ole mnesls)aDraur no1aexo oeilslsDrlnvo;t4tlenir3ta1lpD lnei s0 2xm(r3iu4opeelfetlt)aDua(r nt0apt mi3iat sDrlu p;t4tetoxfcty1la eaues;t)trtoxr iudllte ieta( a2tr( oou1ope mieiltls ranvp (0 etrxfcoatlp rli s (0 rxrxr oudlmeemfvs t)a2rrx p;t4tex  o3iadfm umumon(0artnmr3oydfmD lneols0 exmxopny1llt  ncslsfsrrmum ou0apxoii3tadfa2rau p;t4 rerircia1lp rlnvs ()trxmirpiudomtn net sfa2rm(r ;u1tlx mieilsfsDraumo t)artomrciy1la  liei s)srxr(rpiydlm elnvsas artaxrp;u1tex mfeias m2rm(mont0 lxoioctotoa  aivi s0sexmxr ny4olt  feias)aDuax p;u0ole  fetlsfaDeanmpn()aleomr3iydomtraieslt sexmimpny1om emfcsasf rumxrpou0aet micils a rmumon(4 rxnxr3iotoat lnes (  exm(r3iodalte feils)sDum(rpnu4alenioeiyslmDua(mpn(4tetrxo3totfp rlivil() etoxo iy4aptelfvta()sDuau pnu1aex  ieiad s2umnvp;t0 lxrmo iodlp  an i;t0 eumxrpny1alen fcilt sDrru oou1tltnmf3iytfs umn o t)areoir oatfptelu s;t)teuoirpoy1ale lfeil()a2ur( oot1olx mi3iltfa2ea(mpn(0 rtnmf3oy1oaDeluvi;s trtmir3oy4ll n fei t) Dra(m no1oee mfcild s ra(mp ()trxoxfcta1la e uei ( srxo(opoydalee ietlsf rra(  ot1ale  oetad aDra(vs u4aeermr io1faDe u ols0s2tmir oodoltnmiesl()sDtmxm nt1oeenioeiytfmDua(vsnu)tltrircoadlmD  nvi;t trxmirpoy1alenlfvt tfaruaxrpnt1oleo fctatlsDrlumon(0trxnxociotlpt lnvs s  2toir3io4llt  fct tfsrrmxmo;u4tltnif3tydlm elu pnt0 eeomo3io1lpDr uvils  2xmxm iodol  mivs sfa2rmxrpnt0tpxn i3iydfs2raumo u)tltrxociotfmD ln i;(0sexrxr3no1lptn ics t sDtrxr ;o0aee  ieiytla eluvont)arxoif3iotlpte n i;t) 2tmxm ou1lme lncs t)a2tmur no0aptomi3tls s2emuvp;(4arenio3iy1oa r nvi;(  2xmxopnodamenlfcsls) rrrxr ot1teen o3tyd m2rauvpnt4 etomf3ty1fmt aues;t  eumio3nydolen fcta()srrr( ont1apx ioctytla2eluvon(0aexrif oa1latr i i;() 2to(r3oydolenmnvil( aDtm(monu4aptnmictytlm ea(vpnt0tlermo iodom raivs;()t2tr(m nu1lmt  nvs t) Dtr(mooo1aleoioetatfs2rln p;(4arxrxr oadopDeanvol(0t2xriopoodlpt lneia() 2ra(r nt4opeo o3tydfa2ran snt4trxnmoctydlptrlnvi;t setm(o3iy1omen ieilt) ruaxrpot1opxo f3iltls2ra(vp u4tlerxrcoo1fpD  nvilt0teur(r3ou4oltn nvta() Dumx pno4tetnmfetat s rln s;u)tleoxf iydoa rlnei;(  euo(r iy1aptn fetls) 2rm(  nu0altnii3iadla2rmumsnu)arenmr3oy1lmt ln s () exmirpiodlle lfeiat) 2ra( p;u1oex  octatla2emuvs u0texrxfcootfpt li s;s0tetoxm iu1lp   nvt ()arumurp;t1opxn ietatfm2el(mp t0arxrmr3oatomDe ieils0teur(r ny1lmte nci s aDur(mpno0aeeomfeiaslmDrlnmpn(4 eenmoctatlpt aies s0 etoxo no1alt  fvta()srua(mp;o1tltnioeildfmDeau s;u0 lermr oo1oa  au o t0tetm(o nydap  mivt (fs2umu oot0aleomictyd a2rlnms;() rxomrctadlmDrluvi (  etmir oo4optemfctat s2ra( ooo4tlenmi3ilsfm rm(vsn(4 exrio oo1fm eanvols) ruoxm iy1omee ivs tf 2urxr ;t4tlxomi3tysfs el( snt4tetnmociatoptrlneo;t)teumxm io1aptnlfes tfaDtmx poo1aet mo3iad sDemuvp;(4 reomf3ia1oa  au o;t0 etrxrpoodopt  fetlt s2tru pno0aexnmietysfsDem( sn(4 etoif oytom r ieo t s2xoiopoydap emictat) 2rrxmo;u0texoii3iys sDuanms ()aeenmrciatfm e u olt0s2ur(r3oudlmt  fvs (f rtm(rpot0apen i3ilt s2uan s (4 renmo3oadomD  uei s0 2xm(r3iu4amte iet sfaDur(r no4ale mfciltfs uau s;u)texriocoatoat  ies t)teuo(rpiudap nmnvtl()arum( ont1apxnifeiaslaDrm( s;t0alenmfcootoaD lieo;(0t2trxr3iydop nmiviltfsrtaurpnt0alto oeiatla ua( s (4tltnmf3ootla e iesls0s2toim iydapt lfcta( s2tau o;o1aeenmi3iadla rm(vp;(0tltomf3oo1optraivs (  etrxopnu4apen iesls)a2uau ono0aetniocild a2rm(vont)texoio tytopDe nvs;t trxm(opno1al e ieiltfaDurxm oo0ale mictas mDrlnvs;u)tlxrmr3oa1latr ueo;s  2trxr3oudom emiviat sDrrxmpoo1tpx mfetyt a2ulnmo t)alxrxo ta1lat auei (0 eum(o3no4lp emfei t  Dtau pou0tltoii3iat a uaump u0 ltnxf tadfaDrlnvs () 2tmio nodame mnct sfarrrxmont0tpe  f3tad a ulu s;(0 rxnmr3ta1fm   u ol(0teur(m3oy4lmt  ictl( srrrur nu1altnmi3iytfa2rluvp;u)tetrxfcoytlaDr uvo;(0srxr(r3nodal emfeiasfarumumo;u0apxn oeiaslm ran s u0trerxr3oatfmD  ivi;t0setoirpno4lp emieta() Dum(rpou0tlt ioetasfaDulnmp u) eenxr3tytlpDrli i s teto(r3iydlltelfvs (  Draxmpou4tex  ocias s emnvsnt4aetrio tytopteli o t0texoim oydlltelnesas) Drm(root1teeo ictat a uaump u)alenir oo1laDelieil( sruo(r ou1lmt lfciatfa2urxm ;t0oee mo3iltfm el(vp;(4 lxrmo3iytomDe uvslt0s2xmxo io4omenlietlt)sDtrurpnu4tleomf3iadfmDel( s t4 rxomo3tydlp rlnvi t) rxrxr3iodop  lnei s a2rmu  ;t4olxnii3ildls2eanvonu0arermrctatfpt  iei;t texrxmpiy4opt lncia(f 2tmxmp;t1tex iociat m rlu p;(4altoxociadfmD aieo;s0 exo(r oydlpt lfetatf 2trur nt4tlxn oetasfm rl(vo;(4trtnif3oo1lmt lues;(  2trxrpou4lpenlnei (farrmurono0oltn i3iyd mDulu s (0trtnxr oodlpteliei s0texo(rpnydlpte neiasf 2tm(rpou1opt mociatfs rlnmsn(4 eeoiociadfmt auesls  rtrxr no1alenmnvt ( s2umurpoo4tpxnmoeiydfm elnmont4 ltriocoa1la  li slt)s2toxo ou1ameelncils)sDua(m ot4ale mfeiys a em(vo u0 lerir ta1latraivi () rxmxr nu1ole mici s sDrrxronu1openioeildfs2ra(mp (4 ltrmr3todfmtrli slt  euoxo3iu1ap nlfvt (fsDrmx  ou0tex iiciadlm2uln s t)tltnxrciydopDelneo;s t2um(mpnydlpteliesas) rtaxrpot0apx iictlslmDum(vp ()trxnircto1omD lu i;s s2tm(mpoydope  ici t a2urx pnu4alenmieiys aDumu on(0trtrxocoadomte ivslt0 2xoxr oy4am  lfet tfaDtmxmoou0apeoii3iltfa2em(vo;u0trxoxrctotoaDrlueil(  2xm(m ou1amtelivil()srumxroot0tle  ictatls2uanvon(4trenxfciy1lm raieo (  2uo(r3nodomtn fct () 2ta( ont1texoifciyslm2elums u4tlenio3oo1lateaivsl( teuoirpiy1ap nmnesa( s2tm(rpnt1tlxo fetadfa ran o;(4trtrmocia1optraivs;t0 rumimpnydop nlfei ()arrmxr nu0alx mfctadfs2ranmpn(0tltoxr iy1fp rlnvo s setmxo oo4optemnvtasf rrmxro;u1apt miciltfs2rluvp ()alxnio to1lm e u il()teurxm3io4oltemfcil( a2uau ooo1opt  o3tytlmDelnvs;u4 etnmf3totfpteaieils0 2uoirpno1ale lnctat)srua(mooo1apen o3tad m rlnmo t)tetrir iy1oaDr uvsls0texoxo3iy1amtnmfeslsfaDuax  oo4tpenmo3tytfm rln s t0teenxocoy1fm elnvi;t t2uo(o oo4alenmnct t s2tm(mpoo0aexnmo3iasfa2ean o t0trxrxf oydfaDr nes;s0 rto(opou1ll nmfetlsfaDtmxm ;o1apeomi3iatlmDeanvp t) lxrirctydfm   u ols0srxmxrpoodome  fvilt srrrx  nt0oetnifetatfs2eaumonu4trxrio oy1omD li o (0 rurxo3nydal  mneslsf Durxmoou0tptoii3ildla2ulnvp;(0arxoir to1fp elneolt)srxrxr3oo4ole mfetl(f 2taum ou1tlxnmieias sDuan o;(4aeerif oodomtr i o ()srxoxopoo1ame mncil(fsDrrxmpot1tpt mi3ild s2eau p u) ltoif3iotfmtelueo t) 2ur(rpiodom n fes t) rururo;t4tle  i3tasfmDrlu pnu0aetomociodomtr nei (0sruoimpiudol emfctat a2tmurpno0olxomo3iyslsDeln p u0 rxnxfciy1fm  au o s)truo(opnodlpt lnci t srrm(rp;t4tetomoctlsls2el( snt4 etoxoctadfmD  nvo s)t2xrimpno4apen fes t)s2raurpnt1teto o3ilt a ea(ms ()aexrxr to1lmDrlnei;t)sexrxm3iudom nmfcia()sDum(mpoo0tex ifciyd aDem(mp u)arerxf oydla e i s s  eumxopiudopeelnvtls aDur(mooo0texnmoeils a uluvsnt0tlxoio3iotla  livo;(0 rtrio oo4al emivsa(farurump;t1tpxnio3ilsfm2umuvs (4texoxf3oy1fm e neilt0s2xmxr iy1alenlfct ()aDrmxr ot0tltoiietlslmDuaumpnt4 lenircoatla eauvils trtmxo iu4lmenmietas)s2umxmont1oexoio3iadla rmu on()alxriocoy1oaDr ivil()tetm(r3oodoltn fetls  2trur nt0apt io3iaslsDelumsnt0aeeoif3ootoa   u o;t0teum(r3iodol  lici sf 2tr(mono1oltnioeiydlsDrlnmo ()artnxocta1laDe uvi;s0t2xmxr nu1amte fesa()srrr(  no1tlxn octyt a2ea( o t4aexoio oadoptean o s0 eur(m3oy4alen nvt tfsDta(m no1alto ieiatlm emu p u4aetnirctytlat  u s;s) ruoio3ou4ome  ies t  Dra( oou1optoioctatfsDuau onu0 ltnir totla  aueslt0 2tr(opoy1om nlnvs (fsDrmu pou4alenmf3iyt mDumnvs;u0 lxnxr3oodopD auvo;() 2tmim3ny4lpt mfci s)srtm( pot1tpto fciyt m raumon()texrmo oo1fa  auvs s)srtoimpiydamte ivtl(fsruax ono4oexoio3iyslm rl( p t) reomf iy1oa   ivo;s) 2xrir3oydol e fvilt  2rrxmoot1alxomo3tls aDrln p;u) lxnio ta1lmDeanvslt0s2trim no1lle mnci ( a2rmxrono0aee  fciat a2um(mpnt0aetrxf iodoptr u slt  exrxr3iudlltn nes () Dum( pnt1olt mfeildfs ea( o;t4 exoxo ootfpt auvs;s trxr(mpiydapenmivt t a2rmx o;t0ope mf3iltla ranmo;t)teeomf3iydfpD anvol()sexrxopoo1lm  licsas)sDumu pnt0altomo3iyslm uanvsnu)teenmo iy1lptraiesls  rtmirpiy1om elnctatfaruau  nt4tex  fctad s2rmnvs;() etomociadomtrlu ols0texm(opio1lpe  netlsf Drrurpno1oeen i3tat m emuvo;t)texomr iy1lp  aivsls0setr(mpiydllte feil(  2uru  ot1opx  o3tld m eluvo (4 rxnxr3iotomDr u sls0seto(rpno4lleelnetl()s2rmu  ;o4tltoii3tld s ranvs;u0tltn
\ No newline at end of file
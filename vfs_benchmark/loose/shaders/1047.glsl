@@ -0,0 +1 @@
+nvs s trxrim oudlltelfvia(farra(ro;o1oetomieiasla emn ont4altnmfciy1omtelivslt0s2xoirpiy1lp emnvsa(f rrax p;u0apt  fctadls eluvpnu4alerir tydopD luvi s)teumxopnudlpte ieiat)arrm(mpoo0altomoeiytfa2umu snu4artoxfciytopt  nei;() 2ur(m iodlmenlfct s) ruax ooo0opxomieiadfmDrluvs;u)alxnmo3tatoa  lnvolt0t2tm(r3nu4ll n ict (  2uau o;t4aeenmoctysfa eau sn(4teeoioctadomt luvo t)trxm(r3oydoltnmnct s)aDumu  ;o1aee mociyt a rl(ms u4 eerif oytfm e nei;(  etmxo3ou1lm elneilt) rrr(rpnu1openioeiytls umumo;()tetnmf3iytfmte nei t0s2xmxr nydlmtnlietls a2ur(mpot4aexnii3iat m el( p u0trxnif3oo1omDrau i t0t2tr(o3iu1lpeemfvilsfa2uaurpoo0apeoifeiat s ua(mo u0altrxrcty1fmtr ivol( seuo(opiudomeemivsl( s2rr(rpou4tpxnif3iatfaDranvont0artrmociadfpD li s ()t2xoiopou1oleemnei s)arum(roou1tpeoioeiytlm um( p;(0aeenmo3ootopt ln il(0 2tmxrpnu4lltnmivils a2tr( pnt4oetoif3tad mDrlump (4aexrir totfmt luvs;t)s2ur(o oy1oleemneta() rua(mpot1aet mociys aDuln pn(0texrmf3oo1la   i o;()s2toxm3nu1op nmiei (fsDurx o;t4tleoiietydfsDea( sn(0aexoxr3tydfat aueo () 2xmxr io4ap   fesls aDtm(  ;u0apx mfcias aDum( snu) ltrmo3iy1lp r nes s s2trxo nu1olt lfes ()srumxm nu1oexomoetys m2emumo t) lenxf oo1faDe ies;()trxoxopiudop  mnctl()sDuax  oo4oltnifcilt aDul(mp u) etrio ta1lmDrlu slt  exm(o nydoleemivt tf Drau pnu4apt mociyd s2um(vsn(4artrxf oy1fpDrlivo;s0t2xr(r iu1ameelivsat) rraumo;t4ale io3iydfa ea(vo;u) eermfcty1lmtrln s;(0 rumxr3oudom   feia(fsDua(mpnu0tet  f3ilsla2emnmsn(0 etrifcoa1optr iei;s)teuoir3iy4oltemfcta( a2taur ot0texnio3ildfs rmump;t4 ltnxo iy1fm e ivo s) 2toir3nudale mfesatfaDurx oou1optnmieiltfa2uluvsnt4 rtrmrctodlat anvils)sexoxopnu4optelnci s s2trum oo0opt  ieildlm raumont0 rxnio to1fpt aueslt0seto(r nu1alte feta(fa2rax  no1teen o3tlsfm rau o t)aeermociadlatrai ols truo(o oy4omt  fvsl()arurum nt4texoifeiydlm2um(ms u) eeoxr3oydlpDrlu i;(0setr(mpio4ll emnvsa( a2uax pno4tle if3ias s emu p;u0 lermrciy1lat luvs t trtoir3nudopeelicslsfaDuru oot4oleomoeiatls2ra( pnu0artoxfcty1oaDr n sls seuoxr ny1llte ietas)srum( p;u0apt ii3ilsfs2umu s (0areoir3tadoa raiesls  eumxopoudlpe lnesl(f rumurooo1optoifctyt sDeanmpn(0 etoio3todfmt aues t trxmxo3io1ome mnesl( a2taurpot4oetoioetydfs2eau s;t0trtnxo3tadlmDeauesl()trumxm3iu4lm  lfvia(fsrrax pnu0oleoifctyd a2emump (0teeomociatomt auvs t) 2tm(opno4am n ietlt  2ta(m nt4altnmictltlm elumo ()arerio3todfmtrlneslt srur(o3oy1omenmfcs sfaDrm( o;t0apx iieiyslaDem(vs;t) ltrmfciotfpt an sl(0 eurxrpnu4olenlfeil(f Duru pnt0apt  fcildlm2ea( p;u0 rxriociytfp  anes t  2tmio3iydopenmnvi t) Dururpot1altnifciat s2ulnvp u0tlxrmo3iytlpte n s;s)setmiopoydoptn fesltfaDumx  oo0tlx if3iytls emuvs;(4aetnxocty1om  an sls0texmxrpiu4ap  mictl(f Draurono0tpeniictyt a ua(vp t4texrmrcta1fmDr iei;s trxmim io4lle mivtl(  Drmxro;u1tpeoioetat s elnvo u)tleomo3oo1om rlues t)t2toim3ny4om nlncsas srtmuroot0aeeo o3iad aDumnmsn()tlxoxfciatom raieil(0sexoio3no1oltemici sfarta( p;o0tltnmfciytfs2um(ms t)altnxr3oatlpD anvs;s seuo(rpny1lme lnvtltf Drmu o;u0aexnmfciad m elumo;(4 ltnxr3totlmtrli i;t0t2umiopnodalen net t)aDtmur ot1aee  oeiyd s ulnmp (0tlxnio3iatfptraneols)teumim3oy1aleemfcsltf 2taxmpou1ole mfctyt a ua(vp u4areomr3oy1omDrau sls)setrir oudlmeelivs tf Dra(r nt0altnmi3tysla2rlu p t0arxnif3oo1op  auvslt  euoio3iy4ol   iciat  2um(  ;u0tet miciatfaDrl(msnt0tltoxr iotfmt  u o;(  euo(mpiodoptelnetlt)sDtrxmpno0aexo ociyslaDeanvpnu4tltrxo oodla e nvilt0setmxmpoudllee ietls) rururoot4alxo ictlslaDea(vp t0 ltrxfctytfaDe u o;()t2urirpnydlmen neslt sDrrxrono0aptn feilsls2uanmsn()tlenxo oytfpD li i;t0 eur(m3ny4olte ivs (f rtrur ou1olt  i3ias mDumu pnt)aexomf3oadoaDraues;t) rtmim no4lpe livi t)a2umu o;t4oexnmfciltfa2eluvp;u4tltrio3oodfp   neo () etmxm3iu1llenmieilsfa2uaump;o1apen f3iydfm rl(vo u4tlxrxr3oatopDrau o t0truo(r oydllenlnvi sf 2tmx pnt4alxnifciatfa2ra(vo (4tetomf iadopD anei;s)s2tmxm iy4omtelneia( arrm(mp;t0alt micilslsDul(vpnu0artoir oydfmDrau s;s  2xo(r3iy4lmenlfcsat sDta(roou4oleoiiciytfm ra(vpnu0tltoxo oadlmt liesl(  rtmxm3iu4apen ictl(fa2ua(m ou0aee mietlslmDrm(mo;t)altrio todopDrluei;( s2tr(r ny1om  lieslsfsruru  ;t1olxomieiad sDea(monu0 ltnmr3ootfmDrauvs s0seuoimpiy4om  mnetl()arua(r no4olxo ieildfm rluvp;() lermfctodfmtrlivs t  2urio3ou1llt lieiat) Draxrpnt0tleoiieilsfsDeanvon(4 rtoxr3io1opD lneolt)seumim oo4omt  fctls)a2rruro;t0tltnmf3iysla2eauvo t4 exnmf iodlptraies;s trxoimpoodlptn ivia( aDrmu oou4tlenmfetldla um( s;u)aetniocta1op  lu i;s)texm(r3nodlmt mfcta() rrm(m nu1tpt ifciyd s ra(mo t4tlxoif3iodoaDrlnvils)s2xmir3iy1aleelfcta()aDraxroot1tlxomf3iasfs2rmumpnt0 ltrirctodlpDeaneo s0s2toxo iu4lpte iesatf rrr(mont4optnmiciatfm2rm( o;u)trenir tydoaDe i s (0 2xo(r iu1altnmivi t sDtm(rpno1oet  iciyd m ulnvs;t)tetomf3oa1fmtrlues;t  euo(m3oy1lmt  ieilt)sDurx  ;o0tlxo feiys a eanmsnt4texoifcoatopDe ivo s0s2tmio3nodamte netatfs2rru o;o0tle  feiytls2emu s () rtoir3iy1lmD ln ols) etmxm3iy1omtnlicils) rumx  ;u0teenmiciat s ulnvo (4tlxoxf3tydlatr nei;s s2urxo oy1ap n nctat)s2rax ont1tlenmfctytfa rl(msnu) ltrxr3totfa r nvs;t  eurir oydolen ivs (faDtrxrpnu1apxomi3iyd sDrmuvs (0aleoir3io1latelivo s seurxm3ny4am  mnvi ()s2rmxrp;o4tptn ociltfmDrl( o () exnxocoydom   nvolt setmxo3oudomeelnciatf Dua(m oo4tpen ieilsfaDulnms t0trxnif oydomt  ivi;s0t2xo(m3no1lp  mfei () Durur ;t1aptnioetytfmDumn p t0aetnir tydoa elu ils0teumxm iydlleelncs ( s2rrx pnu4alt mieildlm ua(vp () etoxociytlatr u i (0seumxmpnu1amte fesas)srurxmpno0alxn oeias a2emumo;t0 etnxr oo1fmDrln i;(0t2xoxr nu4olenlnetas srtrx pno4ole ifetlsfsDrau p;t) etrmo3ty1fmteli s (  rtm(o3nudam  lnvta(  Durumonu0oetomieiadlm2emnvonu4alenmr oo1oaDrau ols  etrxr3nodlle liesat srua(  ;t0tlt  o3tltla2rmnvo u)altrxocoadlmD aiei;( srtrir oodolenmnvtatfsDraxmpot0optomfeiysls2ulnmsnt) rxomr3totfat  ueols  2to(r3no1ol n nctat  Dur(rpot0apenii3tlsfm em(ms;u)aexoirctodfa rln s;t srtoxr3iudlleemfvtlt s2uau o;t4alx  iciltla rm(vsn(0 rtoxrciadfm ean s;s trxmxr nu1ame miei () Dta( pot4olxnmi3iydlsDuanmp u4altomr tydfmD livolt  eur(rpno1al   fesat arrrxront4apx iieiadfsDum( pn(0trxoir3oadlmD lu o s0texrim3oy4aptemncsa(f Drmumonu1oeeoifcilt sDrmnmo (4 ltnmrciatopt livo ( t2toxmpoudameemnetlsfaDuauront1tlxoio3iyt s emnmp t4arxnxf3iydlpt aieo (0s2urir3io4am n icil()a2ta(mpno0optomociaslaDumnms (4 rxrmf3ia1fat  i s s  rum(rpiudlm e ieiat a2umur ot1alxo ieildfa2elnmonu)tltnmf3oydopt lnvslt)texmim iydamtnlivtatfa2tauront1opxomo3tysfa2ranvo;()aeerio3todfmDe nvs ( sexr(o3oodape mncsl( sDumxrpno0tlt ifctydls2rmn s t0 lenifcoytom eluvsl() 2urxopiu4al nmneslt) 2rm(mooo4teeoii3tlsfm2rm(mp;t4 eerxr3tadla  lueo;t t2tm(o nodame mnviat)aDrrur nt4alxn ieiltfmDelumont)trxnmr ty1lp raivilt0srxrio oudllt  nvsa(fa2rmx pnu1oeto feiyd a rl(vs;u)aleoxf iatlmtrln i;s0s2toim3io4lp elivia()srum(mp;o4olxoio3iyt s uanmon(4arxrifcio1fpD auvils  rur(m3oo4lptnlicsas sDra( pou4aet mf3iaslm2ea( o (0tlerif3to1la rluvsls  exrio3oodol nmicsltfarrmumo;t0oexoiiciys s raumon(4trtoifciytomDelu s;t sexmim no4ole mivs ( arrmxront4oet  o3iadfa2uaump (4arerxrciy1la e nvi;s sexrxo nudlme lieiat s2ta(  ;u1tle  oeiltla elu p t)tetnxfcio1lpD livo t t2xrxr ny1lmeemnvtls sDur(m oo0openmi3iatfm2rlnmp t0 lxrmf3ty1fm   u s (  2uo(mpio4am   ivtasf 2tr(m ou4teeniieiytfm rmums u0 lxomocoytoptrli il()tetm(r3oo4olte fctls) Drrxro;u1oetn fcilsfm2umump t4alxnmf ta1lpt lieo;(  2umxrpou4apenlivt tfsrururpoo0open ieildfa umumo t0 exrir tadopD anvolt0 rxr(opoo1ap nmfct s)artru  oo4optn ociyd a ea(mo;(4tltomfcoa1fa  luei s0 euoir iydll nmnetlt srtr(rpnt0ope mfeiasfs uln s u)trtnmr iadoa   nvsl(0t2xo(r3iy1omtelfesas)sDra(rp;t4tleomoeiyd m umnmp;(4texnif3ty1fm rluei;(0trur(r3iydop nmneia(  rrrur nu1tpx  feiltfaDrln o t0aexrircta1omD lu sl(0 2uoir iodope  iviltfsrrau pnt0aetn o3iysfa ran p;t0tlxoxf totlp   ues ( setmirpio1om nmnci ()sDtm(r ou4oltnioeiltfm2rlnvp;() lxnxocoa1fpD lueo;()trumio3nydapenlnesa(f rtaxr ou1tpenioeiyt a eanms;(0 etnmf3oadoaDe i o t seumxm oo4oltnliei tf 2tmxm ;t1tltnmietadlm ulnmpnu)trtoifctytfp   ies t) eur(opiu1lm n ivt t arumx pno1aeeoiieiatlaDea(vp u0 rtnmr3oadfa rlieo t) etm(rpiudoptnlfesas s2rrxm ot4aexnioctydfa rmn snu4aeerir oodfm r iei;(  ruoir oy4ll nlictlsf rrm(r no4aexo ictadlsDrluvon() exoio oo1op rlivo;t0srtr(r3oudlme livt sf 2rrxmooo0oltnmoctat m2uanms u0texrmrciy1faDeaneo;(0 eur(m3no1ll  mivias) rta(mo;t0oexoii3iys aDelumo u) ltrio ia1lm rlieolt  2tmxo3iy4optelfesl()aDra(mpno0opeo ietlt aDea( p;t4 rxoxrcootomDeln ol(0sexmim3iydam  lnci ( sDtau  ot1olt iictlt mDrlumsnt0arxoio3oodlmDeau olt  rtrxmpno1alte fvtl(  Dua(mpnu1tpeomoetadlmDem(vpnu4aeerio3to1lpt  neils)setoxo3oudaltn netat  Drrxro;t1tptn ociytfm2elumo;u0tltrio3iatom  anvi t srtoxopiydop   ncs s sDur(rpnt0opt  fctysls2rl( sn(0artoiocoodlmte n i t0tetr(r iodal n ict t) rra(mooo1tet micilsfaDeaump;()altrirciydopDr uvo (0 rumxmpnodom  mfcsls)a2tr(ro;t4teeoiictydfm2umump;()artomfcoodom  aieo;t t2xoxo3oy4aptelictls)aDraxroot4aeeomfciysfm2rln pn(4 etoif iy1oa eaieolt t2trim3no4optemict s)a2uru pno0oleomictys s2rlnvp;(0aeenmo iy1fm ranes s srtrxrpno1lmte ivslt  2rru ont1tpxomieiltfa2umn o;(4arerxrciatfp  lues;(  rxo(mpoodll nmnci s) rrr(monu4opxoioetyd a2umnvon() etrio3totlate i s;t s2trim3oudal emncsl() 2umu poo4ope io3ildlm2eluvs;(4trxoif3oodfa ranvs;( teumir3iu4lm elnvs ( s2rru  ot1alenmoetls mDrlumsn(4tetnir3ia1fp r uvs;(0trumiopno4lpt  ncia( aruaxmpot0alxo ictltla eanvp;u)tlermr3oadfp r nes t0t2urxopio1ap  lfci s s2urxroot4oleo oetlsfs2elump;t4 eeoir to1faDeanvsls) 2xmir ny4om elnctas)sDrr(rp;t4apt mo3iltfa2rm( o u)areoio ta1op  lnes s)tetmio nodllen ieiasfarrm(rooo0openmfctldls ua(vpn() eerio ty1omtr uvols s2to(o3iydapt  fei sfa2trumooo0aex if3iytfa ul( o;t0areoxrcoydlatelueol(0s2xo(r iu4ope mfeils sDtm(  ;t1teto octyt s2ua(mp t) etnmo io1faDrluvo s0seuo(opnodlmt mnviat artmumpot1olxn f3iydfs2elums;t) eeoif oa1oaDr uei ()sexrxo io1omtnlfvs () Dtrxr nu4altnmo3ilsfs2uauvpn(0trtoir3tytlptean ol(  2uo(opoo4lltn fesas)sruaumpoo4olxo fciydfm rmnvp u0altomfciytomDe n s () euoio oo4lmt  ivsls s2um(rooo1oltn i3iad aDra( p () eenxf iytfmDrli o (0 rur(mpno1olt lfci tfartmx  ;u4texnmi3tldlaDumumsnu)tlenmf3oytomD anvi t  rxr(m3nu1ame  fvsat)sDtrurp;t0tpeo feils m2um(mp;t4treoif oydla r uvilt tetoxr iu1lm nmfcsasfa2umxmp;t1tleniiciatfm2eluvonu) rxrif3tydfmtelueilt)tetm(o3nu4omtemivtltf rur( oou0ope moeiyd s ra(vo;u0teermf todom  anvolt setm(o3nodlme  net tfsrur(mono0oeeoii3ils a2uauvpnt)aetrxf3tydop elues t texr(m3io1apenlnetls) 2umu  nu1alt ii3iatfaDrmnmsn(4 exrmr oydfmDelivo t) etm(r3iudame mieta(fsDrrxrpno1apenifeiatfm uluvo (4 eeomf ty1omt ai il(0s2tmxr3ou1amt livs tf 2trxroot1oeeomi3tlsfs2rmump;t0artnir tydfptr ieo;t) 2uoxopoodol   ictlt)aDua( onu4ape mi3iytfs2em(vp;u)arerir3iytlpt lu s;s0 ruoim ny1ll elnvt sfs2rmx onu1alxomiciytfa uaumo ()altrmo iadlp e u olt) rumxm3ny1oleemfvtl()a2raxrono0olt mictltls eau onu)alxrmf iy1fptelnei s teum(rpiodolt  feiatfsrtm(mp;u4opxn i3tysfa rlnvp;u0tleoif3iy1omDe n i s0srurim3oo1lltelnctat a2trur ;o4opt if3iatla ranmpnt0aexnir3oatoptrlnvs (  2tr(m3oy4olt  ivt s)aDtmxmont0tleo fetld m rl(vs u4 lenif3oatlm raueslt trtm(o io4ale mnctat)a2rru pno0tpxnifeiat s2ean s;u)tlxnxf oydlmDeai o t) 2xrim nydlmtelfctlt  2uaumpou0opt  octatfmDean snt4trtnmrcia1la r neo;t) 2urxm3oo1lpen fvs sf rrmx  ;o0tptnif3ias mDulnms;u0tlerifcoa1fmt  uvil(0trurxopiy1ape  ietat) 2raurpoo1olx mi3ild mDrl( snu4aeerif3ta1fa  lu ils) exrirpiodamtnlfcia(fartaxr no0tlt mfeiasfa uaump u0 rxnircoodlateaies ()srurxo no4omte fct sfsDrru  no1tetomf3ils m2ea(vonu) exomo3ootoaDr i olt  exmimpnodopenmivs s s2tr( ono0opxomfciatfmDuanmo;u) rtoxrciotfpteli sls  euoxr oydalenlnvtl()s2tmum ;t4opto i3tls s2rmn s;(0 rerircoydoaDe uvi;s  rtoiopoo4amenlfcs () 2tmx  ou4oetomociytls uauvp t) exrmo3totlatrauei;t  exoimpio1alenlfvsas) Dtax ono4opx  o3iys mDrauvp;t4artnmfciadopD  uvi;( t2toio3ou1lmeemncil() rur(mp;t4aetnmfciat s rlump (4treoxf3oytfptelieslt)seumim io4lp n ieta(fsDta(mpou4tpe mfeiaslm2ranmpnt)tltrircoo1fa e i i;(  2ur(rpnu1lm e fvtat) 2tmurpoo4tee mfetydlaDumnvp (0artnxo oodlm  ai o;s0srxoxo3iu1lmtn nvtlt)srtaumpou0texnifeildfa2rmn o (0 rtomociotlm e i i s tetr(opoy1olee icsat) rumumpot1tpt mi3iasfsDum( on(4 eenir iadlaDranvo s0 2ur(opoodlpenmietlt)s2rmx  no4alen fcils mDeln snu)tlxnmr3tytomtr uvil() ruoxo iudolt mncias artaxm nu0tle iictlslaDra(mp (4 rxoxociytfaD  ivi;s sexoir nu4lm e nvi ()aDrru p;o4tpxomoeiys sDrln p u) lerifctadlm  aivs s) 2xoxr3nydlm  mfeta( aDumu onu4alto i3iadlaDelu p u4teenmo oa1lpD anesl( srtm(opio1lmtnmnci s)srrmumo;u0oleomfciltfa2umumpnt)aleoioctotfmteaies;( srumirpno1am emnci tfaDum(m ot0tlxoiietys sDrln s () eenif3oydom e ueol(  2tmio iudomt lncta(  rtaxmpoo4oeeomoetyd aDelu ont)alerif3ia1oateli olt0texr(m3oy4lpeemietlt  2taxrp;o0tpeomoeiadla2ea( s u4 lermrcootfpD  iesls0seuoiopoy4ap n ics t)aDuru pnu0tee iociydlaDemnvo;t)aeermo iytoptelivol(  exoimpnodoptnlfet (farrm(r ;u4alxnioctasfm2ulu s;t4arxrmociadlat  ueo (0srxrxo3nydop nlnctls sDtmxrpnu4texomfeiytfsDum(mont)areoxf3oo1laD  ivsls  2xmxr3iy1alenlfvtlt sDta(roou4oetnii3tld sDea( pnt0 etoxfcoo1om e iei ( s2trxopoy1opt  fcia()sDurx  no4ale  ocildls rlnvp;(4teermrcoatlpDraneils  rtoxmpny4ol nmfetlt srtrx oot4tetn o3iytlm2uauvs t)altrxf3tydfpDr nvi;(0 etmio ou4ap nmivt t srrmxm oo1tpt mf3iyt a el( s;t4tetnxr iotoaDelivs s)t2tm(o3nodll  licilt s2rax o;o1alt  i3ils s rl(vo t0altoxf ty1om  an s;t0sruo(o iy4om  lieta() rra(rp;u0apeomfeiysla2umnms;u)alxomrctydfm rai ols) rxrxrpnydame livia(fsDrr(ro;u4oet  oetytfm2emnvo;u4 lxrxr ta1fp  lneo (0trtoxmpoy1olenlfetas sDrrxrono4tlxo fciydls ulnvpnt4altrxfcootfpDrln s;( s2xr(o3io4lp nmfetas sDrrumooo0tpt ioeiatfaDemnms;(0 etrmf3oytlpt lies () 2umxr3iu1lptnmfci ()a2taxrono4tet io3iat aDelu snt)trenxocoadfmt  uvi;( teto(o iu4ale mnetasf rumu o;o1tpt iieiltfmDrlumo;(4 rxnxociodom eaieol(0 rtr(rpiodllte fciasfa2trx  oo4ole  ociys a2rmnms;()arxoxo3totlpDeli i s0 rumxm3nydam emfct s)a2rmur ;t4tpt mfctls s ranvs u) rxnmo ty1oa elu s;s)setrir nu4omeemiesas)aDuaumoot0optomfcilslaDuluvont)tleoircia1lm r uesl(0srxo(r3oy4lmtn ics ()arrrx ont4texomfeiysls um(vont0 lxoio oydla  auvi t0t2xrir nydomt  fvs ()sDuaur nu1opxn feiltla2el( p (0arxrxocoytfaDrln i s)trxr(rpny4lpenmiei () Drr(ro;t4opxoii3iyd a uluvs t0arxrmociadfm ran o;s srxmirpoudlm  lnvsa( arumuronu4tlen feiytls2rlu snu0aeermo oodoaDelieo t0trxrimpou1lpeemfvtl()a2uru oot0apt  ieiatlm em(ms;u4aetrxf iotoaDeluvslt) etmxrpiy1ape mieta( arumurpot1tlt miciys mDea( o;t)trtrmr3iotopDran sls) 2xmxm io4ape lfeia(f rur(  no0altnio3iytfa2ea(vp ()alerxrciatlm  au s (0s2xo(rpiydal nlfvsa(fs2taum ;u0tlxnif3iytls elnvp (4aexnxrciotfpDr i i t s2xm(opnydlmeemfvia(fa2uaum nt0apeo fctatlaDemn sn()trxnxo oy1op eanvils)texrirpnydll elfcil( arurur ou0tlxomoetytfaDua(ms (4alxrifcoydopt  u s;( srxoxopoudolt lfetasfaDrmum no4olenmfeildfs2rm( s u0 exnxocoadomDrlnvi;t0 ruo(r nu4omen iesas artrxr ou4oexoio3iaslsDumums;()arxnmf todfaD  n s (0 rxoimpoydaltelfvs t)aDta( ono4tleomfetld m emn p;u)arxnio3iadlpDr ies t0 2xmir3ny1lp nlivtl()a2rau  ot1olenmi3iatls2elu pnt4texrxfcoadlptr neo;t0seuoimpiydlptemnvtls aDrrum oo4optn fciatlmDrln o;t0texrmr tydfpDrlu ilt0t2trxopnydlltemfeilsfsrrr(rp;t1opxomfciysfmDelnmp (0 renxfcio1late ivs s0truo(opou4omtemfetlt srtrx ont1oltomieiltlaDean onu0aetrif oatlpD aueolt)tetrxm3oudomt lieil( srum(r ot1opt io3iyslm umnvs;t0 lenircia1fp eluvils s2ur(o3oydll nmici t)s2trxm ;u0alt iocildfm el(mp;u4 ltomf oo1laD  i ols0srtoxrpoo1ap e nesls) rtrxrp;o0olen i3iasfm2uaump;u0trermf3oytopDr uvo;( srtoimpno1lptn nctltf Dtau oot4opxnmoctadfmDrmn o u4artoxfcio1fmD  ivi;()t2urxopou1apenmncia(f Draxr ;o0olxoiietys m uau o;t) rxnxociytfptrauvsls)t2xo(r3nodlptelnvsl() rtrumonu4aexomiciytfa emn p;(4 rtrmr3oytop   nesls) 2urxo3ny4al nlfesl(  Dtm(r oo1olt  oeiysla ranvo;u4 lenio tadfp r u i;t0trxrim3ou4aptemnctat artaxrpou4oexo fctat s2em( p;t4artnxo ty1op r ivil(0srtm(r oodllte neils)srumx  nu1tpe if3ild sDelumo u4 lenir3iytlpt  u i ( t2xrio oy4ope  fvslsfa2ur(m ;t0aexn fctld a2em(vpn(0 rxrir3oy1op eanei;t0t2umxr3iodalte nvt (f 2tmumpno1oetoioetysfs2uan onu) exnifcoatfptelivs ( s2toim oy1ameemnvslt arrrxmo;o4apto iciltfa2rau pnu0aeermr ta1fmD  ieo;s  2to(m oodapen nctl( a2tmxmpno4oetomi3iyt a2um(vs (0 reoxf3tydlm elieols t2um(r oydlp nmnes ()s2raxmp;o4alxniiciysls rl( ont0aexnxocoa1fptr i o t0 rumxm3iy1amtnmfvsa(  rtr(  nt1tpt  ociydls2umn pn()tlxnmocoo1faD lieo;s0 2xoxo3iy1omen fetl(  rrr(monu4tpxomocilslmDrlumpnu0 etrir3tydlaDraneols  exoirpnu4om elnvtat)s2ta( oot1teen o3tat a eau p;u4artomrcia1lpt lnei;()s2urxr oydlpenlfcs t)artaxm ot1tpt ii3iasfm2rl( pnu)alerif tatfp   neol(  2uo(r3oudap   ietlt)srrr(m ;o1opx moetatfa2em(vs u) exrirctatfm   u ilt setr(o oydoleemnvsa(fartmxm ;u4olen iciytfmDeanms;u)tetoxoctatfpteln s;t t2xo(opoodamtemneia(  rra( p;t0texo o3ild mDea(vs u0 etoiocoa1omD an i s setmxo3oo4altnmictl(fs2ur(m nt0tpt mfeiyd a2ra(vo;()tlxoxo3oydfpteluvi ()s2urxopou4om e ncs sfa2raxmo;u4oleomoeiytfa2emnms t)aeenmoctatlm eliei s  rumxr3oydlltemiei (f Dtaurpou4olt iictydlsDumnvs u4teerxo3tytoaDrlu o;( srxoio3oodll emiesas)srtr( ont4aexnifeiys m2umu sn(0 rtrxocoy1omD luei;t0tetoiopiudopt  ncta(f 2ta(mono1tpe  f3ias m umn o;u) exrmf iy1fp eai i;s)seurir iy4olt  ieiat) Drrxm ;u4tpxoii3iatls rl(vo;u4 eenxoctytfp e ieol(0srxmxm3no4opte fesas a2rau p;u0oltn ictatlmDrm( o;(4tltoirctatoaDe ieo;t  rtm(opny1lme  ncils)arurxm ;u4oetnmi3tad sDem( p;t)aetomf3oytopD  ueil(0setrxm oudop  lfeils) rtmumpoo1aleoioetadls em(ms;u0altoiocoy1omD an s;s  rtoir3no4amte icsl()aDraxmo;u0tet micildfaDeanmp u)trtnxr totfpteli o t)t2xmxm nydam  lnes ( arurxr ;u1tlxomoetad a elnvo t)artoir3iy1opteai ols texm(m oy1op e nctas)sruru  ;u1aetoifetadfa2rm(mo (0trermfctotoaDeli s;t teuoxm3nydap eliei (  Draxmoot1alxomietytfaDranmonu)trtoxr ia1latelnvi;s)s2umxr3oy1lm nmieil() ruaurpot1tpe mfeiaslm2elnvonu)aetrmr3todlpte n sl()s2uriopoydal   iesat)sruaur ou4ape ifctyt m eanmon(0areoif3tatlmte nvo;(  ruo(o nodllenlnvtls a2rr( pnt0opx ifciyd aDemn o u4aetnmfctotop rlnei;s)texmio oy4lme lics s)sDrrx  ;o1ale iiciatlaDuauvo;(4alxomrcoatoatelneo;t s2xmir oo4op nmnvtl()sDra(rpnt1aex ifctadls2ranvo u) ltrxf iadfaDe ueolt)seumiopoy1ol emncsat a2rmxmpnt1apxnii3ildfm ua( p;t4arxnxr oydomteau s;t)srtoimpnudoptemici t)aDtaxmpou1alen o3tat m umnvs;t4 rxoxo oa1optelu sls  2xoxr nodlmtn fvias a2rmu p;u1opt iieiatfa rm(msnt) exnifcoodlaDraieol(  2tmxopoydapeelfetl(  Dtmuroot0oetnmi3tysla2ulnmpn(4 exnxo3iadlmDr ueil(0srtoio iu4lp  lieilsfa2uaxmono4tlto f3ilsfs2umnvp;u0altrxo oa1lm rlies;t0t2xmxm3oo1op nmiesls  Dur(  ot4oet micils a2uauvp;(0trenir tytfptelneol( tetmirpoudom  mnci s)srta(r no1tlto fciatls uln o u) exrmocoa1opDeai olt s2xo(r oo4ll nmict t srum(moot4apxo i3iytlaDea( s;(0 lerif totlp ranvol() 2uoirpiudlptemiei tf 2rrx p;o4oet  iciydls ra( snt4areoircto1lpDr uei;t) rtrxr nodape  nesl(f Dtaxro;u4ope ifetlsfa ul(ms;t0tlerxr oy1fpD li i;t  exmir io4llen fctas) rrmxr ot1olto f3iad mDumu p;u0trerifciotoaDeaivi t)texmir3iy1olt  feslsf Durumo;t0tlen f3iasfm ul( s (4aexnmf ootoa  ln i s) 2uoirpiydal elfvslt aruru p;o1olen f3iadfaDrlnvs ()trtrmocoa1fmDrauvol(0setoxmpiu1amt  nctat)aDrm(rpoo4openifeiyt m eln o ()teenxfcoa1la  aivs;t0srur(o iy1alt  nei () Dtr(rooo1tltn i3tytfmDul(ms u4teenifcoydopteaies s  exoxmpnu1olte nvi sfartm(ronu1ope mf3iatfm2em( s;(4arxnxr oo1fp  luvi;t0 rtr(m3oy1alenlictas)arrmum ou0aeeo ieild a rmnms t0 renir3iotfat  nvs s s2xrxopnodape  fvi sf rtaxr ot0tex miciatlm2ul( s t)tlxrxf io1laDrai i;t t2to(m ny1llt lnctl() 2ua(m nt4tetnii3iat m rauvonu4 leoif oadlatelies;s) rtmxm3oodal nmics ()sDur(mpou0alx mi3iydfm2rlumo t4 rerxo iadla   nvi s  rxmxm nydlptn fet s  rrax p;o4oeto o3iatla uau o;(4 rxnirctadoa   ueo t  2uo(o oudapeemicsl( aDuaxrpou4aex iietad m ulu p;t0 exriocia1lpDe nvi;s sexm(mpiu4omee feiasf Drruro;u1aeenmociydfaDrluvo;u)treomr ia1fmteai ilt) rxr(o3iy1om  mivilsf rtaumo;u4apxoii3iytlmDemnmp;t4 etomf oo1laDelieslt)tetoir3oy4ome  ncslt)a2tr( ono4tlxnmoeiat a uaump ()arxrmr3oadfmD au i;t  rumim3no1al n fcsl()sDrr(  ;u0aetn feias a2rm( ont0arenio tadfateluvs;(0 etrirpoodll nmivs sfs2umx o;t1oltnifeiaslsDranvs;u) etniociy1fpDeli ilt trtoimpoudal   net t  rtmx o;u1aeeoio3tas s2emuvont) reoif3iatomtrlies (0 2xo(rpno1lpeemieta(  Dumx  ot4tlt iictadfs2ulnmp;(0 etoiocoatfpt  ues () etr(o3ou1oltelncs t  rua(  ;u1teenmfciatlm2ea(vsnt0artnir totfmD aivs t0s2trio ny4llenmfvsl(f 2uru onu1olt  o3ildfa eanvp;(4 reoif3iytfpD lu i;t srxmxm io1optn nesasfa2rmur ot1tpen fcildla em(vpnt0altrif tatfpDrliei t0trurio iydapeelieias) Draxr ou4tpenif3tadfs rlnvo;t0tetnmf3oodfpt anvo t) 2umxo io4optnlfesl()sDtmxmoou4tpt  octld a2rlnmo;()tlxrxr tatlpDran olt t2xrxopnodlltemnesls)sDrmum oo4alenmiciydla uaumo;u4 rtoxocoytfatr nei;t0t2uoxr nu1ol n icsl(faDrmx onu0oexo fciaslaDumn sn(4aleomf iodoat luvi;s)s2umxm nu1lpte ies t  rra( pnu0aetoifciyd sDumn o t4teeoif to1lmDeaiei ()trtrxo nydape mnei s)arua(  nu4aleomo3iytlmDuau s;t0arxrif3io1oat  ies t0srxoxrpio1olte fesas srraur nu1apenif3iadfs2rmuvo u)texrmf oytopt  uei ( srxrim3no1omtemfvsa() rrrxrp;o1oet  iciyt sDeau o t0tleomocoa1fp raneo ()tetrirpoo4amtelivils  rtmx  ;o1tptomoctlt s rm( p;()tlxoxf iytfp r ies s t2uoxr iydlm n fct ( a2rru o;u1teeo ieiatlm eanvo u0 lxnir3to1faDelnei;( s2xr(r iy1olt lfesas s2um(  ;u0alto iciydfm2uluvont4tetomrciydlmtr ieilt)setoxm3iy4lmtn iciatfs2trur ;t4aex moctadlm2ra(mpnu0artrmocoy1optrlivs s srtr(o ny4llenlfet s a2ur(roou0opx iictltlm2um( ont4treomo3tadopD au s (0 rxm(r iodlptn icsas s2rr(m ot1tptomfeiyd m2emn onu4tltnio ia1fpt aieo s0 euoxopny1om nmfesat arrm(r no4tpxoiietldlsDul(ms;u)trerxf todfpt an sls0t2tmxr3nodlp  lnciltfsrumxrpno0apx  f3iltfm uanms t)trxomfcoatlpD aivs;()s2xmxm3nu1am n ivt () Draurpoo0oexomiciydfsDra(mpn(4aeenmrciydfa  lueolt0truoxmpny4olen fetasf rta(mpno4texn oeild a uauvs;t4 lerxo3iytlm r nes s  2toxo no1llenlfcsas)a2rrxmp;o1tpxnmiciltlaDea( ont0tetrxr oytfp  aues t s2xr(m nu4lmt  fcs tf rtaxmo;o4aex  f3iytfa rmums;u)tlenir iydfatelnvi t setmim nu1ole livslt)srtaxmpot1apt ii3iytla2um( o;(0tetrxf3tatfa   i i s t2um(mpiydlme mfvsasfs2ua(ro;o1tlt mf3tys sDrm(ms t4aeenmfcoytom eln ils0 rumxopiudlptn iesl(  2ua(r ou1oetnifetatlaDeauvonu0aeermf iy1fmtrai sls0 rtmxr oy1ope lici t) 2um(rpnu4oeeomfciytfm2rln p;u)aetoxr3iytlpte ueo t)t2tr(o3iydamtemnvt t a2umumpno4apxniietytlm ranvo u0 ltnif3ty1op  luvi t  eurxo3oydomtnlnctlsfsruaxrpno4openii3iytfm eanvs (0areoxo3oo1omt lu o;(0t2xrxrpnu4open ivtasfa2raumpou0aexomiciltfsDeanmpn(4tlxomocto1fmtr ieolt0 rur(opiodllt mnetas arumxr ;u1tpto i3tatlm2umn o t0 rtrmrcio1omt anes s) 2xoirpoy1lmenmnes ( aDta(mpno0aexoiociatfa2emuvo;t4arxrmf3tydop eaiesl() rxrxrpny4llenmfeils)s2urum ot1tpt mfcildfs2rl(mpnt)teenmfcoydlat aivo;s setmxopou1aptn ict t sDumu ooo1tptoio3tyslmDum(vo t0altrxoctydoateluvo;(0trxriopnodalenmneils arraum ot4olt mfetyslm2ean o u) eeomr3iytfp rlneo;t  exo(m oo4omenlnvilt aDrrxmp;o4aetn o3iaslm emnmon(4alxrio3oy1lmtrlnvs;s t2urio iudomenlieta(fs2raxm ;t4tpt mociadls2umums;u4alermr3todfa   u o (0srtmirpoy4opee ies ()srrr(mpno4tex  feiyslm2rmn s;t)trxomr oy1late ueo;t) 2trxopoy4ol  lict tfa2tmxr ;u0olt ifciatlsDelnmpnt)teerif oytoate ivol( sruoxrpoy1olt  ncilsfaDtmum no0tlenmoctaslmDrm( s;(4tetoxrctydfatelu ol(0t2toxopnu4lltemfeil( sDrmum ot4tpenmictatfsDem(vs u)tlxrxrctatlpDelnvo;t  exmio3oydolte net s sDraumoot4apto oetys s2eau o t0teeoif3io1fp  luvo s0setoxr oy4apee ieil()arrm( pnt0ale mietysfs2ra( s;t)treomr oadfm r uvilt  exm(rpnu4aptn fct sfsrtr(mpou1olx mfcilsls ra(vp;t0 etoxo oydfat ln i (  etoxm3oydap elfetas aDurxm ou0aexnio3ildla rl( on()aexoxr oydfmt li ils) 2xrim3io1al  lnct () 2taxr nu0opx  ociyd sDul( p;(4 exomf3oatopte nes (  eumxrpoudalenlfeia(  Drrxmp;o4teenioctytlaDeaums t)tltnir oa1fp rlnvilt  exrxopnudaptnlfei ( a2rr( pot4tleomfeiad a2ea( s t0tetrifcoo1oaD anei s) 2urir3nydllt  nesas a2tmuront4aptoioeiydlaDel(ms (0 rtomr3ootla rauvilt0srxoim3oo4oleemfctl() 2rrx  nt0oetoifeiasfaDrl(vo t)trtoxfciadoaD  uei;( t2xrxrpnudalen fcs t a2ta(  nu1oleomf3tatfs2emnmpnt0aeenxo3oadfmt ai ils0 2trim oodlmenmnesa(  rtr(ronu0tlenmoeilsfmDemumo t0 rxrir3ia1lpDe n slt)sexmim3ny4lmtelfvia( sDtmu ooo0tpto oeild aDum(vpnt)trxrif3tydomDe uvslt trur(opnodop   fcsl( srtmxrp;t4olt ifeiadls2uaumsnt4 rtnir3ta1latelu slt) exrxm nu4omtn iet s)arra(m nu4openmfeiyt mDean snt)tlxnirctatfaDraivs ()sexoimpnudllt  neslt)a2ta(r ;u4optoiieiaslm2rmnmsn()alxrxf3oytopt lueol(0setrir iu4ol nmncta()a2trxr ou1apxo fetlsfs2rm( p;u0aetnxf ootoptran s;(0t2xrxopnu4ame mnvsl( sDurx  ot0tpxn o3ias mDrluvsnt4 etnif oadlpte ues s0trumxmpoo1al emfet sf rrmumoou0aetomiciltlmDrmn p u0trxrxf totopDr uvs (0 2trio no1apen ieilsf ruaxmpot4aptnmo3tlslm2ua( on() rxnmr tytlmtr n ils trumirpou1op e fetl( srtrx  nt4texo o3iadlm2eanvpnu) rxrmrciodoa   u o s0 2uo(o3iudoleelict s)aDtaur no0tpxo fcias s umnvpnt4aeenmf3to1fmDrlnes;t0setmxo3oydlm nlfvi t) 2rrx  oo1olx ifctadlaDumnmpnu0 ltomfciy1latraies;( s2uo(m ny1om n net sf rrr(  no0tpeo fciys s ulu p;t4trerio3oa1lateln slt0teum(r3nu4al nmfcs s artrxm ;o1alt mo3iltlm emn p;t)teeomo3ia1om raiei;t)trurirpiudlmte iesls srrmx o;o4openmoeiyd mDulnmp u0 lenxfcoydfp e nes t0 2xoxr3ny1om  mivsasf 2rm(mont1opxn ocild a2ul(monu0 etoifcoo1fptr n s (0trto(opiu4lltelici t a2rmxr ;t4tltoiocildlmDrmumont0 leoio3iodop rlieo t seto(r3oo4lltelicslt  2raumo;o4aetnifetlt a emuvo t0 eeoxf3oytlm r uvo s) 2xrxr3nu1aleemfcs t  2umump;o0oexnmieilsfa ean s u4teerxocoodopt lnvs;t  rxo(r3ou1aptnmnvil(fa2tr(mp;u4oetnmiciys sDeau s;t4arxrxfcoo1lm r i olt)tetoxrpnu4lltemnvs s)a2urx p;t0apto fciyd a ul(mp;t) lxnxf3ia1fat  n o s s2xm(o iu1oltnmiei sf rtrum ;o0tlenifetadfsDeanvsnu0tlxomo tytopD  i ol(0 eur(o io4alee ivsl()srumxront4aexnio3tltfm2elu s (4alerxf3oodlatrlneil( s2ur(rpoo1alt  netltfaDtaxrp;t1altn f3ild m2rlumo;t) rtoifciodfpDr n o;t setm(o no1lm nmfvt ( aDua(mpot1tpxo fcildfm uan o t4trxnif3oy1op eln i s0teuoxopnydop emnctlt  Drmx  nu4openioeildfa umump u)tltrmr3oydfpDe ivs;(0s2uo(o iy1am nlfeslt) Drrum ;u1aee mieiytla2raumont4 rxrxr iadlaDe nes;s sexo(r3io1lle  ietat  2tax o;u1aptnii3tys s em(vs (4tleoxr3iatoptr uvslt)trtm(m3ou4lltelfcsatfs2tau pno1apxn o3iadls emump;(0alxnio3totfm   uvs;t)sexoxo3iy4lpe  nct s) 2ra( p;u4optomieiadfs2ulnms t)arxoirciodfm   ivils trxoir3ou1lmtelnesa( srumu  no0aptomi3tyd sDumn s t)aetrmocoatfaDeanesls0sexmxm ny1lp  lfvta( sDumu p;u4openmo3iltfsDulu pnu4 rxrir ty1lateanvo;t0 rtm(r3iu1omt lnct () Drrx  oo0alto o3tasfa2ran sn(0 eenir3tatlp  lneolt)trurxo3ou1altn ict s s2rau oot1opx mi3ilt mDuaump u4alxrmfctadlat lu o ()trtr(rpio1aleelnct ()s2rmumo;o1texnif3iltla umnvs;(0aeeomo iytomt auvil( s2tmxo iudlpt  nes tfarurxmpnt0tpeoii3iydlm elu sn(0arxnif to1lmDr ieols t2toio3ny1omtemneiltfa2uru  nt0texn i3iysfa ulump ()tlxnir3oytfpD  ieol()trtm(o iy1lmt lnvi s  rta(mooo4tpxn iciat aDumn s u0trxoxr oatom elivo;s)trtmir3iydlmt mnvils) rtmu oot0tpxniiciytfaDelu p;(0 rxrir3oa1oa rauvs s0srxoxr iydlpe liet t)aruru  ;t0aexnmoeilsfa2eluvp;t)trxoif3oatlmtrauvo;s0tetoxmpoo1alenmivsat srumxro;o4tle iieiadfa2eln s u4aeerio3ia1la  livslt  etrirpiu1ome lfet ()a2ta( o;u0tlxn oetytfsDuauvs;u) rtnircta1lptr neslt)tetrirpnudomtelieilsfa2rrx  nu0opxoiocildfa2umuvsnt4aetnxf3oytoat auvo;s tetoio3nodlpee ivsatf rra(mpoo0apt miciatlsDrmu p;t4tlxnxrcty1latr uvil(0s2xrxo3nu1ap  mivsa(fs2trxrpnu0aet iietytfs ulums;u4aeermf3oy1fptelues ( texr(rpio1ale mfci t aDraxmono1olxo ieiatls el(mpnt4 lenxr todoatelneilt srumxo3ny4omtnmnet (  Dua(  no4tpx iocilt mDelumsnt) etoxo ta1fmDrluei;t  etoio iydll   iesa( a2ra(  nt1alxo ieildls ean o (4teenxf3oadlmt lieo ()trur(opoo4opt  fvsls)arraxm ;t0aexnmfctasls2elnmonu0 leoxfcia1lp   uei t)tetm(o no1omeemfvta()a2rmurpnt1oeto f3iasfs2ulu sn()trxnmo ta1lp r uvils0srxmio ny1olee nes (farra(  ot4aex  ieiasla2ulnvo;t0tetomr3iytfm  auei s s2uoiopnu1lltnliei s srumx oot0oleomf3tysfs2rlnvp t0tetrir tatomte ues (0srxrxr io1am nlivsat sDumxro;o4aetomf3taslsDum(vp t)teerirciydoa rln o;()teto(mpoydapt  fvtlt)s2uaurpnt0alx moeiys a eau pnt0arerif tytfatelieo ()srtoio nydlpt mfei t)s2trur no0ale iiciltfm uanvs;t4tleomo3ty1lp  auvi;t  2tr(opou1ll n fvtls  2ra( oot4opt io3tyt aDrlums t)tetrmf3oodlpDrai s;() 2umxrpnu1apt  nesa() Dumxr ot4aetoiiciltfs2eluvo;u)teenir oytfateliei;s0 2xrir3oo1lm n fvslt s2ua(rpou4alenmfctadlm2rmu on(4texnif3iatoatelu ils0t2uriopnu4lmtemnetat) Dtr(mo;t0tltnifctldlaDean snt) lxomociy1lpDrau i t0tetoxmpnu4lpenmfvslsfarrr( ooo4aet  ietatlm2ua( s u0aexrmrciotoateaieo;s0trtrxr3nodam eliesa() rrrxmonu4aptnmicildlm2uluvo;u4aexoxfctotom rai i t  2umxrpiydomeemfvtas aDra( o;u0aeen octld sDem( o u4arxrio tytla ran s;s seuoxrpiy4ap e icilt sDtrxrpoo4oleo oeildfm2rmu p;u0tltnifciatom e ivs (0s2uoim3iu4ale mivta( arumx pnt1opeo i3tysla ulnvs;(4 reomf3ta1lpDr u s () 2xrxopiydomee fetl( a2urxrooo4apt ifeilslmDranmp u)trtnmo io1faD  n s;s tetmio3iydom nmfvtlt)aDtaxmpot4apxo f3iltfm ean p t4 exrxf ta1fa  lnes (0srumio3iy1amtelicias  rrm(rpot4tle mfcildlaDumnmsnt)tlermr3ootfmDeai ols)seumxmpoudop n netat s2rmxmonu4tltoioeiasfs rl( on(0tleoxf3ia1fpD  ues;t0s2ur(m3oydaptn nvtas  2uaxmpou1tptnifciad aDea(msnt0aexrmo tadfmtran il(  2xm(r oy1aptnlfvtasf Dra(moou1optnioctys s2ua(msn(4 ltnmr3io1laDrlnvs t0s2uoxr3nodoptnmivtls sDur(m no4ape iocildfmDrmn snt0aeeomo ta1fp rauvilt)tetrxr iy1am n iesasfarrrx o;u1tleoiictadla elumo () ltoifcoo1laD  iesl(  rurirpnodom   fet (farurxroou1tet  oeiat m2umums;() renif3iytoaD  neil(0 eto(o3oydllenlicsa(f Dtrx ooo1olxn o3tlt s umump;t0tetnio iatfa e ueslt0 exmxr oy4apt lfcilsf 2uau pnu4opxnmociatfm2elu p;() leoxo3oy1lp rluvs s)srxoxr3nudop nmfvt sfs2raurpou4apto o3tatls2ul( pnt4tetoxf tydfptrlnei (0 eum(opio1lpe  fctls sDuaumpot1aeto o3iysfa2eauvsn(4aexoio3ta1fatr i o;t0sexrxo3no1am n fetas) Dtr(rp;o0aexomi3taslm2elu o ()aexomrcootla raieilt)srtmir3io1llt mfes s sDuaur nu4tetnifeiydfm ulnvsn()tlxnxocoodfpteau s;()s2toxo nu1ol nlfes tf Dua(mooo0tpxnmictysls uan p;u0tlxrir3oy1om elivi ()s2urxm ny1lp emiet (faDurxm ;t0oee moeilsfs2ulumsn(4aetoxr3iodoaD  ieils) 2ur(r iudalt lietl()s2rmxr nu0tet iietydlm2rauvon(0aexnmr ta1fmDr ivo s  2xmio3ny1op nlfvtat  Dtr(mpno1aex  ieilslmDem( o t4artomf3oadfpt auei (0s2tmirpiy4ap  lnet s) 2urxr no0altoio3ildfmDemnmp;u4 lenmrciadlm   nei;s)s2toxrpny4oltemfcias  2uaxmpoo1alenmieiltfmDuaums;u0 ltoxo3oy1omDraueo;(0srto(r oo4om   ies s)sDtaxrpoo0tltoii3iatfaDeaumpnt0 ltrxo totlatr ieils0 rtr(r oo1ol elfvt t a2uru  oo0aptn feilt aDul(vo;u4tltnir oadfpD aivols)setoxm3nu1al   fvtas  2rau  nt0oltoiociyd sDra(vp ()altoif3ty1laDean i ( t2uoir3ny1ame lfcs ( arur(  ou1oee mo3iytfmDumn o t0trtnifctatoptrlnvs;t0tetrimpiodlpe lnetl( aDra( oot4oeto feiydls2uan p;(0 ltrio iytfatean o () 2tmxr oo1al  livsat srrrxmonu1tee mfctasfs2umump t0 rtnir ty1op elues;(0s2uo(mpiydam  livi () rrm(mpot4tpt mfetatls2elnvo u0 eeomo oydom e uvs (0srurxrpiodllteliet ()srrrump;u0alx  icilslaDemn p t0 rerif3oydfpD lu o;( s2xm(r3io4ole mnvs ( sDurx  nu1olxo fcildla2uanvs;(0arxrir oa1opteaueils  exrxrpio1amenmieiatfa2urx pou4open ieiat mDean s;t) rermf3todfpt aivs ( srxo(mpio4lmt lnci s)aDrrumoot1ape mfeiaslm2emnmo u)tetnif iodomD lieo;(0s2urim oodop nlnvtl()srur( pot0tleomoctatfmDrm( o u)aleoio3iodfm eanei ( sexmxo iy1optemnvt s)a2rmumono4aexoiietadlm2ea( pnt0texrif3iydlpt lneo (  rtr(m3oodlmtn ieiasf Dua(ro;u0tptnii3tyt a rmnms;u0 eenmo iatlmDrau ilt0 2tmxm3oudap  liet s aDrmurp;t0tpxo fetld m2rl(vp t0arxoxr iodlp   u o;(0 rurim3iodameelnctlt) Dtru o;u4ole  f3ild s2em(vpnt) reoirctodopDr n ilt  rtr(o oydom emicsl( sDta(  nt1aleoioeils s rln sn(4tlerxo3iy1fp elu ol()sexrxm3iydopen ictls  Dtru pnu0open i3tad a rl(vo;t4texrmo3oodoaDrluvslt)tetmir iudol   ietas)arumu pno4tlto octadfsDrmnmo;u)tltnmo3ty1lp eaueolt)t2xmir3iudom n feiat sDtau  ot1tleoiociatlmDelnmp t4 reoxf3iatfaDelieo s)srxrir3nudlltemfei sfs2urxrp;u1opx mfeild a2elu o;(4aetomr3tydla ean ol()texoxo3nu1lpenlnes tfarrrx pno0alt mfeiat a uanms;t)aexrmr3ia1oa   ueo;s)s2uo(rpiu1om elncsas)artaumooo4opxo f3ilsfsDum(vo;u0arxrmf iatfaDranvs s)texr(o3oy4om n fcilt sDuaxmoot1tpe mfetatla rmnvo t4tetomo3iotopD  ivsls  2xm(opny4lp   fctls arumur ;t4oltnif3tatls2rm(mpn(4artnxrctadlpD  uvsls trto(rpnu1opt lfvt sfsDurxr no1oexoifciad aDumnms t4tltnio3oadfmtrauvs;s0trto(m3io4op  mivsatfaDtrum oo1alxomoctas a2emnmsn()alxoxrciydlmte u ils srumir3iu1aptnmivsl( sDrrumpno0oetn fcilt m2ul(msnt)aetnio3iadomD  ivs;(0s2xmiopoudlpeemfctat)s2rrurpno4apx  o3iltfs rl(ms (4tlxrxf tadoate uei (0srur(r nudopenlnetls aDtrx p;t1tlto feiadla2rm(vonu0aetrxfcty1lm rlueols  rxr(r oydom nmictat)artmum nu0olen feiysfa2uanvs;(0 ltoxo oo1lmD  nvi;(0 2xmxo3io1om elivilt sDumu onu4aet mfcilslmDrlnvp;t0 etnxrcootlate ieo s0t2xo(opio4lpte nvs tfa2trxr no1ope  fcilslsDemn pn(4aleomo iotoaDelivs;(0teurirpnodapeelnctl(faDtm( pot0tpeoiociaslm2uan pn(0 rtnmo3tytlpt aiei t t2um(m3io4al nmictas aDumxm ot4oexo octas s2ul(vs (4trxnxfcto1lmD  i s;s0sruoirpoydoptelfcsl()sDur(ront1tet mf3iasla2rluvs t0 lxrmfcootlpDelues;s  2um(rpou4aptnmfvta()arrmu onu0tptomfeiysfmDra(vp u) etoirctodfmtrauvols trum(o3oydaltemnes s)artrumpot4tpt  feiat a2rlnvpn() ltnmr3iydlatranes () exrxrpny4lptemfvsas srumx  nu1tlto fciad sDra( s t)alxrxrcoa1lpt li i (  rtrimpnu1optnmict () 2tau ont4ale mf3ilsfmDuau s;u0 eeoxo todfptraivs ( trxoio3oo4aptn icsl( s2ua(rpnt4tltn f3tld m2ea(vo;t4aetomocoydomtr u s t) rxoxo oy4apt  fes tfsrtm(r ot1alen o3tat a rl(vp;(4 lenir ootomt  i sl() rxo(m3oy1ol  lfvsasf 2tau pno1oexn iciadfaDea(vsnt4artnmo3ta1lpteau s t)srtmxm nudlm  mncs tf Dtau ono0oee if3tlsfm ulnmonu) lerifctydom   uvol(0 euoir nudll elfct s  2rmxm ;t0teenmictys aDuanmsnt4aexnxfcty1lpt luvs;t) rxo(r oodoleeliciatf rum(rpoo0apeo o3tlt m ua( s;u0 exoif3tatfmte i sl( setm(rpno4llen icsl()sDtmuront0aetnioeias m rau ont4teerxf ootfaDe uei;t)t2xo(o nydll elnci t) rtmx ono1tpeo feildfm2rauvsn(4aleniocoo1oa e neil(0 rxr(mpiu4apeelncsl(  2ra(m ;o0oee mf3ilt m2uan pnu4 rtoxoctytfmD  u slt)t2tr(r ny4om   iei t)srraxrooo0alxnmociys s umu pnt4alenirctotopD  uvs;() 2uo(m3oo4alt lfcia( a2uaxronu4tee  ieildfa2elnmo;t0arenmr3io1lat lneo;s t2tmim3oo4omtnmivta( sruauro;t4olxnmf3iatla ua( p t)trxoxoctydfaDrai sl(0srxr(o3nu4omt  fetlt)srrau  ;u1tleniietldfm emnmp u4alxrir3to1lptran ol(0setr(r3no4ap n nvsas artruront1opto ictadlm ul(vp (0tlermo3iotlmtran i t)sexoxm3oudoptnlnvt tfs2uaxm no4olenioeiasfmDem(vp ()teeomo3iadoaD  nvi t  2toio3oydlp  mivsls  2tax  ;t4opt moeiltfm rm(ms;u4trerifctotom elueo s  rurir3no4lp  lieias a2ur(ro;u4tpt ii3ilt s2eanms () etrir3todfaDrauvsls)texr(o ou4lm  mnci ( arrr( ont0olx  iciltfmDuauvp u) lxrmo oa1lmDe neilt0 ruoirpiu4olt liet (f 2uaump;t4aptniociyt s2rl(vo t0 rxrxo ty1omtr ivs s)trum(mpou1lle licsls)aDurxm no4oltnifetydfsDrmnmpnt0treniociy1la   u i s)trumimpoy4op  lici ()srum(r ;o1olxnioeias m2raumpn(4 etoirctatomD aivs ( trurio no4lptnmfvsasfarraumpno0apeoii3iyd s um(vo;t4artnmoctatom e uvs t s2urxo oydolt  fvs (  rtaxmoou0aeen f3ilsla um(mpnt)teerxo3iy1lmte u s;s0t2uo(r oudlp emieiat)s2tru pno1opx  octydfs2elnvp u)tlermo oadoatrluvolt) 2uoio3nodalen fetas srur( o;o1ole ifciltfa uluvsnu4trtnmr iadfa e ieo () exoxm iy4amen fvs t)arra(rpnt0oet mi3tadls2rauvsn(0aeerif3tydlpD  uvi;t0t2tm(mpio4al eliviatfsDtru  ou4aleoioctytla emn s u)teerxr3oydfmD li o;t0 2urxo nodalenlivils aDtaurp;t4oetoifetatfs2uaump ()trxrmo3iatfp eaneo s0trxoio oy1llee nctlt  Dtau  ou4tptnmocild m2uaums t0 rtrmoctytla elnvo s sexr(opiodamenlnetls s2rr(rpno4aexnifctyt m2elnms u0tetomr oatfpt anvi s texmiopnydap nmnvilt s2rr(ro;u0texoiociltlm umu on(4 reoifcoy1oaDeau ilt0 eumxm oodlptnmnei sfsrtmu  ;t4aptomf3tlsls ran o;u0 renxo iy1oateaieo s  ruo(r nodamt lneilt a2rmxmpnt0oltn fciaslm uaump t)tetrxr ia1oatean ols0t2triopiudlp n fvsa()arraxro;o4oexo feild a ranvs t)arerifcta1fpt lnvi;t texrimpny1lmt mfvs s  Dtm(  no0oetoif3iydfs em(vs;t)treoir iotoa e n o s0 2tmxo3ou1llenlictl()aDumxr no4alxnifetasfa emn o t4 rtnxr oydlp   uvsl()teuoimpoudape mfvilt)sDtaxr ot4tpxn feiytfs rlnvonu0arxnxf io1fmDe nei s0sruoio3oodlleemfetas)srua(mp;u0oexo o3iysfs2emn ont0 exoioctytomte nvslt trto(o3nodlpe mfvias  2tmxmonu4ope miciasfm uaumont4tetrxfciatfp  ai sls)s2xm(m3iy4ope lfcsatfaDuaxrpou4tle ifctadfm ulu p (4trxomfcia1lpteanei t s2tm(r iy4lpenlnetl()a2trx poo0aet iieiydla2rl(vo u0 eeoifciodfateaivo ( seum(rpiydlltnlfcsat)srtruronu0tle mfeiatla eln o;()aexrxrciy1opteaivo () rtoxr oo1ameelnciasf 2rm(r nu0teeoif3ildfm2ranms;()tetoio3ty1fpt ln ils0s2trim3oodomt mfcilsf rtaumpnt1tle ii3iad s2uanmo (4aeenmf tydoate ivo s) rurimpiodlmenlnvs ( s2uaxm no4ope ii3tydfm2um(vp t)arxoir to1fptrau s t setr(mpoodopte fcsltf rrau p;o1ope io3iysfs2rmu s;u4alerio3ty1oaD anvolt0 rurir3ny1olen fctat  Draxroot4tltn f3tasfa el(vp;(0 exrmr3ta1fmDelueol(0s2tmxo no4ameelietlt aDumumo;t0alto i3iatfmDemu sn(0tetnioctatopDran i;() ruoimpnydoleelfeia()artaxr nu4alx io3tyd a em( sn(4artnxf3iytlaD  nvil()sruo(m3oudamtelnvt t arum(r ou0tlx mo3iysls ua(vo t4aeeomf3io1fpDr nesls setrim3iodlpe mnes (fartauroot0texomietls m2emuvp u0texrxociydomD lu olt)texrir3iudam emneils)srumx  ;t4altoioetlsfs ean p;()areoxr3totlatrau s;() 2tr(o3oo4ale lneilsfs2rrxmpno0opxnmf3iydfsDemn o u0teenifctydoa e uvs;s)s2uoxmpiudoptemfvi t) ruau pou4tlx mf3iyt a ran snt0aexnmf ia1oat aivi t)seur(r io4lmt  nes ()srurx ono1apt mf3tlslmDrauvo;()trtrxr todlm eau s;t0texoxo3nu1am  lfctasfarrmxronu1oex iicilsls el(ms t0 eenio oatlp  aieo;t  rxr(m3no4lm   fet (  Drmx  no0oltnmo3tlsfm2rmn s (4tltoif3oatomDrluei;() euoio3nydomeemfvta(fsDumuroot4opeo icilsfmDrmnms;()trtrxr3to1lp  auvo t0 exoxm3oo1omtnlivtls aDraur nt0oee miciytlm2uln o;(4aexoxr3iadlmD  i o;s)s2to(r3oodllee ivtat)sDrru oou0oet mfeilsls elnvo;()trenmr iadla eai i;() 2uo(o oydol elncta(farrmxrpoo0aetnmo3iytlsDemnvp u4trtnxoctotfpDeanvs;s t2trimpiudamtelictat  2uaxr oo1openiieildlaDumnms (0tltnxocty1la   uei () rxrxr3iu4olenlnctatf rurur ot1apxomi3iadlmDuauvo t0 lxrmocio1lmDr nvi s0 etmir3ny4ape lfvias) Drrxr ;u1tpxoiiciad s ulnmp;(4aeeomfctadfp   nes ( sruoxr3nudaptemneilt srtaxrp;u1opx mo3iadlm elnmpnu0teeomr3oo1oat lnvi;s0 eto(m3nu1amteliviasfsDrau p;o1tpe  o3iysfm ua(mo (4 eenircootopte nvi;t)t2xm(m3ny4altemictlt sDuaurpnt4altnmociatfaDea(msn(4trerio iodlaD anvolt)seum(r ou1lmenlnct t) Dum(ronu4aet if3tld s2uluvo u4arerxr3oatoa raivilt0 2xr(r3oudome  ies t) 2tm( ono1altn ieiltlaDemnmonu4 rtnmf3ta1opte ieo;s0teuoxr nu1lp nlfvil(fsrtrxrpoo0aex  o3tyd sDea( o () rerifcoatfmtr ies;() 2umxrpiy1ole licsas s2tmx p;o0tpxn ieiadfa emnvp u) rxnmr3oatfmtrlieo;t setoir3io4lpe mncia()aDtmxmonu4teeo ieild a rau on(4 lxnxfcoo1fpDrauvi;t teumim3ny4llt livias a2rmu oou1apt iieilt mDuln s t4 etniocoytoaD li sls) rxr(mpiydap  mncsa(f rraxroou1tlen iciltla2emn ont) ltrmf oydlat  ivo ( trxo(o nodlle lfei t) Dur(mont0tetnmocildlsDul( p;t) etrircoatfaD li ols0t2xmxrpiodap   fetl(fa2ta(m ;u0oetnmieiad m el(vo;t)aexnxfcoodlpDeau i;(  ruo(mpoo4ol   nvils sDtaumpnt0oetoiictatlsDem(mon(0areoir iatfaD  iei;t  rxoxopnodapt lfvsl( a2rmxr no4tpxniocild aDel(vs;()treoio ta1lpDean sls t2toxr3oudamt  neilt  Drrxm no0tpeoii3ild a ul( onu4alxrio tydla   nvi t0texo(r ny1opee nvs s  2tr(mp;t1altnmoeilsls um(mp (0trxnir iatfmt lnvilt sexoimpno4om  mnct sfsDrrx  nt4oltnmo3iasla ranvonu)aeenio3oydfm rlnei ()srurio ny4oltnlicils) 2uau p;t1tleo ieiaslsDuanvpnu4alxrif3ootopDelivs;s0trtm(r3iodlp nmict tf rurx pnu4opt  oeiasfa2rmu o;u)aleoxo oadfa e ieol(0 etr(mpio4ll nmnvtl(f 2uaxrpoo1optn f3iydls2rlumpnt0aetrxr3iatfate u s;t0t2tr(opiu1optnlivi tfaDtmuronu4tlt  o3ilt a2ean p;u4 lxnio3oa1lm rluvolt)sexo(m iudlpenmnet t)a2uaurp;t0apt mf3tysfm2elu pnt) rtoif3oadoptelnvols0t2xoxm oo4ap   ictltfa2uax pnu1ale ifeiatfs raumsn() rtnxo ty1opD auvi;t)trtmio oy1lle  iesa( a2taxronu1optnmfcilt m2rauvsn(4aeerio ia1lmteanes;t s2trirpnu4am e neils) 2rax  ;o1tpen oeiytfaDumumo (4arenxociydlpteauvi;t0t2uoiopnu4amenlfeils)srra(  oo4oexoii3iytla2ulnms;u0 etomr3to1omtr nvol(0 rtmirpiudlmeemfei s) 2tr(m ;t1tpen fciat sDemums u)treoxo oadlat  i ils0texoxrpnudlltnmnct s  2rm(r ou1tlxn fciltfa rl(mpn(0 eerxf3oydop   n ol(0trur(r3ou4lleelfct tfa2ta(mo;t0oee  octad aDul(vo u)altoxr3io1fmDeaiesl( t2ur(mpiy1alte nes (f Dua( p;o4tpxoiictls s ra( s;u4 etrxrcoo1lpD  ues (0 2tm(r3no4ap   nvt t)aDraxrooo1aeeomieiltlaDeluvsnu)treomr tatopteln slt0sexr(o3no1ole  ncsltfs2uauronu4aeen feiadfaDrmnvsn(4 etnio oytlatr i s () 2um(r iu4ap elfvi ( a2rmxmpot4apxoiocildfmDumn s u)arenif3ootla   nvilt)teur(mpoo4opt lfesat)aDrrx oou1texnifetadlaDem(vp;t)aexoxf3oytoate u i s texrxo3iy1op  lfct sfarurumpno4olxomoctys a ul(vs;t)artoif3io1oa rai s s seumir oy1alt mfctltfa2uru  ;t0apt if3tytfs ua(mp;t) lxrmrciydoateluvi;t0t2xo(r iu4opt mnvsl()sDtrxmpot1oleo oeilsla elnvo (0texrxr tadom raiesl(0t2xrirpio4lm  lnvta()aDur(r ;o1opt  i3iadfmDrmnmp;(4tetomr3tadfp   u slt0srxoxo io1amt  fci s)artm( oou4oexoiictysls2ra( p;t4alenircoadfaD  nvo;() rtm(o3oy1aleemfesls)artaur nu4teeoioeiatfs um(vsnt) etoxo ta1fpteanvs;s) rtm(opnu1altn fviltfartmuroot1alxomoeiysfa ea(mon()artrifcoy1omD  uei t)t2toxr ny4lm  mfvsa()aDumxr nu1oetomiciat a eanvs;u0 reomo ty1lmt  ieols s2xoxopoo1omtnmnvslsf 2tm(r ;t1oexo ieiatfm ua(vs;u) eeoxr3iodla  an olt s2umxr3no4op elivs s)a2trur no4tleomf3iyt s2uln o;(4 rxrmf3oo1lmt  uvo;( setm(m3oydllte nvtat)sDtm(rpnt4teto oeiad s2em(vs u)tltnxrctytlpt  nvo;s trtoimpiu4oltnlivt t)aDumum oo0altoio3iadfs2ea(vpnu0 rtrmf tatfa   uvolt) 2uo(m3io1lltnlietlt sDtrx oou4opxn fctltlm2uanmsnt0treoir3oatfmt  ivs s)tetmim io1al nlneslt) 2trx oou0olx ii3iydlaDrl(mo;t)trermr3iotop raies;(0teurxo3oudop nlicsas  2rr(  ;u1olxnmi3tytlmDuln o u4trxoxrcoodomt an ol(0setm(m iy1ap  mfeias srrm(rpoo0apxoioetad m rln s;(4trtnxr3oadlp  aues;s)s2um(r3no4open iet tf rtm(rpou0aee  oeilt sDrmn on()arxoxfcty1lpDran ils s2xrxr3iodol nlnctltf Drru oou4tltomocildfsDrmnvp u) lxrmoctotfa ean ols0trtrir3nydapt mivsl()s2urx  ;o1apxnif3iatfm2el( s ()areoxf ia1fmtraivolt trtmio3iudaltn ictlt srrmxrpnu4aet mietyt s rmnmp t)tleomocty1oatrlnvo s  exoxo nodll nlnvil( a2ur(monu0alxoio3tlt sDeau p u)trtrmr3todlm ean ilt0 2xrxo ou4lp n fci tf Dtau  oo4oetomieiys mDrmn s;u0texnmf oo1fpDelieils)texmiopiydaltnmncsltf Dtmxro;u4tpto f3iydfm ua(vsnt)teenmr3iy1fmDraneilt  2xrio3oo4ll  lfctl(fsrtr( o;o1teen octlslsDra(vpnt0trxomo ia1fpDe i sl( teuoxo nu4ll n neslt  Drm(r no4open fctydlm2ulumo t0 rtoio3oo1lmteli o t s2ur(mpiodomeelieilt)s2trxrp;u1ale mi3tytfmDemnvs;(4 lerxf tadlmD lieo;( s2xrim3oy4am n fctatf Dtrx  nt4ole  o3tld m ea( o;u4areoxo3oatlateluvi t t2xm(opno4ap emieias  rtaxr oo0oexoiiciatfmDemums;t)arermr ta1fat an ol()seumxrpiy4amt mnviatfarrau o;t4apt mociasfa emn pnu)tetoxf iadlptrai i;() 2toim nu1olen netl(f Duau pno4apx mf3ilsfa2el( o t0 lenio tadlm  an s;(  rurxr ou1lpee ncils a2rrxm ot1apeoioctyt m2emnvpn(4trxrxf3iydopDr i i;(0srumir ou4alee ivsls s2tr(mpnt4tpxnmieiad mDumnvs;u4 rxrxo3ia1fp raivols0 euoxm3iy1lm emnvtlsfartaur ou1texn f3tydla rm(mo;t)altrxrcoo1faDr ivi;t  rtmxrpnodlp e netls) Drmx  ou1tpxnii3iys mDran snu4tlxrmf iadlpDrln i (0teurxmpiodom nmfesatfsruaxmpoo1tlx mo3ilsls uauvs u0 etnif oo1lmtr uvslt0 rur(o io4ll emnetl( srurur ou1altnmo3iatfs2rm(mp t4altnif iatop eaieo t)srtrxm nu4lmtnmfct tfartaxr oo1oetomfeiydfaDuau p;(4aetrxf3oatom r iei;s0sexmir iodlmtnmnvtltfaDumuro;u4aetnifeiys s2eau p (4trtnmo3to1opD  ies ()tetmxm3nu4olen ics (fs2um(m ;o1oexnio3iyd a2umuvs (4trxniocoatlmteaivo () exo(m iy4opt  ict t a2uau pot4aet ifcilt s2ean p;t)trxnmf tatfp   n s s truo(r3oodame mfvt s s2tm(rpou4aeeoifeiysfa2eln onu4tltnxf3ta1omteluvils  2xo(m oydlp elictatfaDuru p;u4opx  fetldfm emn snu)arxrmociatom elu i s srxo(rpiydlpe  fvsas) Drrxr ot4openmi3ilt mDulnvs u4aeeoxo3oa1latr i s;s0srtr(o3nu4apee nctl(faDur( onu4tpxnifciltla umumpnu0tetrmo tydlateau ilt)sexr(m iu1opee ieilsf 2uaum ot1aleo ieiys mDrmn s;(4altrmr3iytop ran o (0 2xm(o3oodapenlietlt)a2tmu pou4aeenio3tadfm2el( o;t) rxnxo totoa raivslt0seuoiopoodlpe mfvi s  rrmumpoo4tlen ociat sDul(mpnt4arxnxr oatlpteli s s)s2uo(m3io1ale  ivt sfarurxm ;t4altn ieiatfm em(vs t4arxnircia1opD  uei (  exrirpio4amtnmfci t) rraxrpno1aexnio3iatfm2eanvpnt0trtnmfcootoa e nes;t s2toxrpoy4om nlnci (fsDtau  no0ope  oeiltfa elu onu0aleoxr3tadfmt luvo;s0s2xo(mpiy4omeemnvi s  2tm(  nu0opt  fctyd a2um( o t0 ltrio iotfatrlueol()trxrxr nudllt lnvil(  Duau p;o4oeeomi3iydla2em(vonu)trerio oadomDr iei;t0trxoiopiudlltelivil( arumu p;o0aleomoetas a rau o;u) rtomociytfpt luvilt t2to(o3io1olte neiat arraxm ;o4teenmieiadls rmu p ()arxnmr3tatfpD aivi;s0t2urirpno4ape mfes (f Dtrumpnu0tpxo oetldla rmn o;u4arxoxrctatfmDrauvo;s0t2xo(opoy1opeelivtat  rraxro;t0ale mo3ilt a el(vs t)alxrmr ty1fmteaneilt texmimpnodllee ncia()s2rmu  ou4optomf3iasfaDumuvp;t4 exoxrciotfa r nvi;s0 etmim3nu1lmenmneilt sDum(mpot4olen ocild m ran p u0tltnio to1fmDelu i ( trtmxrpnodop e ivi t  2taur ou4aexn fciad s uau o;t4 rxnmrcoytomDrlieo;( tetoir3iy4altemneia(f 2rmurpno1tptnmictysla rlump;t)alxoif oodfm  livo;t t2xrxr no4llt  fvtlt) 2taumpot1opto f3iyt s umumo;u0tlenifcoy1lm  lnvs () etrxr oy1lm elfcils)aDur( pno1apxnif3iad a2uanvsn(4tltnmr3oatlp r uvslt)s2xo(o3nu1opt mfeiat)a2ua(mo;t0oleomo3ias s2ea( o t)altoxocoatlpteli ols)seurxr3ou1lptnlfvt ()artm( pnt0oetn oeiatfm um(vo t0aeenmfctotla e ues s0texmir ny4ame  nct (  Drau pnt1ope if3tadfa ulu pn(4 rxoxo3to1fat ai ilt  rum(m iy1ap nmivs ( a2truro;t4tetnmfeiys aDumump u0trtnxo ta1fate uvo t0srumxrpnudll e nvs ( aDtr(m ;u4oeeoif3ilsfa eauvp (0 rtnmf oydfm eaivsls0sexoim3ny1alt lfeiltf Dumx p;t4tltomo3iatls ua( o;(4 etoio3ia1faDelu i t0trxoxr3oy4opt lnvsas) rraur ;o0tlxo feiysfa2emuvo (0 rxnmocootla r u s () rur(o3nodamt mici (f rrauro;o1altniocils a2eauvont0 rtoxo oa1faDelivsl(0 rxmxopoo4lltnlfcia( arrmx pot1tet moetld s2ul(mo (0alxrmr3iodlpt  ieolt t2tmxopoodaltelictl(  Durx p;u1alxnioctld s2rmumo (4aeenmo3iydla rlueo;t0t2ur(o3nu4om   fvt t)aDtmu pnu4aeen ociysfaDranmo t4aetnir3iodlmt  ues;s setmiopou4omt  nvsasfs2um(mo;t4aptoiieiyt aDuauvs;t0trerxo3iadop r i slt0 2uoiopoo4lpte iesasfsrraxm no4aex ioctlsfa2emu s () rermo3tydfptrlu s;( srtr(opoy4op nlivsat)artau  ou0oex  oeias s ulnms ()arenmf3oa1fa eaies t) rtm(r3iu1opeemicsasfa2trumpou1olxn i3iadfmDrlnmp;u4tlerio oa1omt an s;() 2xo(r nu4optelnvtas)arrmuroou0oexoio3iytfs2rm(vpnu) exomf3ty1lpDrlues s0 exoxr ou1op nmies ( s2rmxm ;o4optnioctysls ua(mpn(4tlxrxf todlaDrlieo;t trxrxm oy1al nliet t aruax o;u4aee ifciydfmDem(ms;(0aexnxocootlpD  ueo;s t2xoxm3oydlmtn ncils) 2taumpno0alt  oeildfs ul(vs;u4trxnmo tydfmD auvo t0 2toxopoo4lptemnci s a2trxm nu0tlt iocild mDea(ms;()arxnxo totlmt an o;s0teumxmpiu1llen ies (farta(ront0tpen iciysfaDemnvs u)teeomo3oy1fate u i;s seum(o3iu4optemiesat  2tm(mont1tlto octltla2umnms u4teenioctadomD  i o;t)trurxrpiu4ale  net t)aDta(  ot0tetnmo3iad s rmnvs u0arxnmociotoptran o ()t2xoxopny4apt  net s)s2rmxr ;u1tle io3tlslaDeln o;u) ltrmf oodfaD an i;t0srurirpio4olen nvia(f 2um( oot4ape  i3iltla eaumo;t4 etnmf3tadfmteai sls0 etoxo3ou1lptemici tf 2rrurpno1tle mf3iasla ul( p u)trenmo ootfpDrli olt0 rtr(r nydlltemfcs ( artrum ou4aetnmictys m2rluvo u4aetrxfcoy1fpDeauvs;t)seurio3iy4omtelfcsl( s2umu poo4olxomf3iytfa2rln s;(4tlxrxf3oo1lateluesl()s2xrim3ny4alt  nvtlt) Drr( pot4oltomi3ils a rauvo u4tlenif3oytomDr ues;(  2umxm oydam n fetat)s2um(r ;o0optomfciyslm2el(mo;(4 exnxr3iatoatraues;() rxmim3nu4apte nci s) 2rrum ;u0aeen ieils s eln s t0tetnioctydfm rln ol()s2toir iydalee ict tfsrrrxm ou0apx mictaslsDeaump (4texnxr iydopt  i ol( t2xo(r oy4omenmivs t)sDuaur ou4tet  ieilsfa2umu s t0tetnmocoytomDrliei t0 rtoxr3ny1aptelies t arta(mp;u1aex iieias m ua( p t0texrxo iadlpt lnvslt)setmim3oo4ap  mfvtat) Draxmooo0ope ifetatfaDul( s (4alxrmrcoo1oatr neo s)trur(o iodop elfvslt arraumonu1teenifctltfaDrm(mo;t4tetoifciatlp r neo s0seurxo3nydopen ivils  Dururono1apt ifeiysls ea(mo;t4 etrxrcio1oaDr n sls)trurim3oy4omen ncsat)aDur(  oo1tlen fctytfmDrluvon()arerir3iytlptelieo;( srumxr oudlm  lfcslt)arra(  ;t4aexo f3ilsls2umnms u4tlenir todlpt lies;s texoxr iu4alenlneta(fsrrm(  ;o0opt mfciydfsDrmuvo t4alxoxo tytoa   n s;s)truoxr3nydom   nctlt)arrrumooo1oeto o3tyslsDua(vonu4 etomfciatfp raivo s seuo(r3no1lltn nciltfaDta(  nu4apt  f3iatfs2uanvp;(0 rtrmo tadlpD auei s0 rumirpnu1lle  ics s) 2ua( oou0texnifeils a ran pn()texrmfcty1fpDeaivi s tetm(r3iu1omtn ict sf Dum(  no0tptoifeiydls ua(vo (4 eeoio oo1optrln olt texo(o3oo1omtnlicslt)sDurumpot0tle mi3iadfmDuln s u4altrxfctotlat  u o;(0 exrim oo1ol emnctlt)a2tmxroou0oexo i3ils m2uan p u4 rtrir tatopte nvsl()t2tmxm ou1lleemneias)aDumur ou1tlenmo3tyd sDeauvon(0 eenxo ta1la rlueol(0srxr(o iy4opt livt s  Dtmur ;o0aex  ietld s2rmu s t0texnif3oy1fmD  ueols  eumxmpoy4lltn ivslt) 2ra( onu4tptn i3iatlm2em( on()aetoxr3oo1fa r n i s)seurxm3ou1openlnviatf ruau pnu0tpx if3iytfa emumsn()artnif iytlpD ai s (0seuoir3iu4lmt lfcs t sDum(rpno1alt iocilsfmDrmuvp (0 rxoio3oodlpD luvs t t2xmir oodome lfvi (fa2ta( pnt4tpxniiciadfa2rluvon()tltnxr3ootopDeaues s srxr(rpiodalte fvsl( a2rr(mo;t4oexoifeiaslm ra(ms (4 etnio3oodfp  aneil(0 2xr(o iodal emivtl( arrr(r ou1aexniictlsfmDrln s;() ltrif ia1oaDrauvi;( t2tmio ou1altn fvtatfsrumu ooo0aetomf3iatfaDrlnvs;(4 rxrxrcoatoptran ol( setmimpoy1alenlivsa() Dumxrpoo1tpxo f3tyd s2emnmp u)tlxrxf oatoate u s s) eur(opiu1ap  mncs (fartmxmo;o0texnioeiadfa2elnmont)arxoifcootfmte ies t tetrxr3oy4ole mivils) Drmurp;t0texn f3iysfmDemumont0teenmocoa1fptrlivs;(0srxo(rpiudame lnct () Dur( p;o0tltnmfetltls2emu s t4 rxnif iatfpteaivo s srtrxr3iudlme lfetlsf rua(r ;o4tlt  iciatfs el(vs t0arxomrcty1oa rlu i;()tetrim3nudale lnvsa(fsrra(moou1aet mi3ilsfm2uluvs u4aeenxo tatfat  ieo ()srtr(r3io4lmtn ictat aDrmxront1apxn feiytfs2rm(mpnt0alxrmr3oatlatr ues s)texr(o3ny4om nlnci t  ruaxront1opxnmo3tlt a ra(vs (4 lxnxo oatlpD li i;()s2trxrpoydameelnetas)a2rru pnt1olto octadla2ranvont) rxoio3tydlp  lies;s)sexmio iu1apee fes s) Drmxmp;u1tpt mietadla2elu o (0altnxociatomt auvs;()s2tr(r nydome mieia( arua( pou4oee mociadls rlu o;u) ltomrctodlpDelneo;( sexmxr io4omte ics sf rtrur no0tpxo ieiytfm rmumpn(4alxrmf3iytop  ln i;t)t2urxrpoudalen iei tfaDrm(mpou4apenii3ild s2umn o;(0texriocio1la e ivi;t0 exo(mpiy1lp  mnctas a2raxmono0opt io3ils s2ul( o;u)trtrxrciotfpt luvols0t2uo(mpio1lp   neia() Drmxm nu1apxomoeiysls emu snt)aexrxrciadlp  auvs s) rxo(o3nudlltnlfvsls  2rmum ot1teenii3tydlsDuanmsn() rerxf oo1lmD lueol() etoio oydolt mies t  Dta(mp;o1tet mo3tasfm ra(ms t) etoxo3oadfmDeaiei s  2ur(m3oodlpeemfetlt sruru oot0tlxnii3iad m ua(vont) rxomrciy1fat  i s s0s2toxm3iu4lle liet ()srrr( oot0tpeo fetld a2ulump u0arenirctatoat aivs s0 rur(rpoudam nlnes t  Draxr ;o0tleomoetyd a2elu o;u0aleoxo3iodfmDelies;(0setrxr io4lmenlictls) rta(rpot1aexo iciat aDrmn p;(0 lxnxf3oydfaD  nvol(0seuo(m3iudapt mfcta(farta(m nt1tetnioeilsla ea(vs;u4 renxr3ootopD  uvi ( t2to(m oudamtnmfei (f rumu o;t4apxoiociadls2ua(vp (0 renxf3to1la   ivs;t t2toimpoydllte nes t a2tmumpno4tpeomf3ildfa uan snu4tlxrxf3iadlpDr nvi ()sexrxr3iy1altnmfctatfs2umx poo0olt miciatla um(ms;t4aeerxo iodfm eanvol(0 rtmim3nodlmenlfetl() 2rr(m nu4aexomi3ilt aDumn s;(4 ltoxf3oa1lp eauvsls0setriopoo4lpt lncsas a2rr(r oo4aexnioeiytls raumpn(0 rxnio totlp r ivils0teuoimpoo1lltelivsls)aDta(ro;u0oeeomoctldls2eln s;t0 lenifcoa1fm  auvi ()s2xoxm3ou1ll   ieias)sDururpou0aetnmi3iytls ul( s;t)tltrxf totlpteln i;s0trumxo ny1amtelivs s) 2rmump;o1aexniociys s2emnmsnu4trxrmo totopDe uvolt seuoiopnydopenlfetls  Drr(m no1oltn ietat mDra(vo;u0trxoiociodfa  li o t0 2xoirpny4al  mncsasfs2ra(  oo0oleoifetat s2el(monu)treoxo oydfpte i o;t s2trxr nodlltnlfviat a2tau  nu0tex  ieilsls2ua( s u)teenmrcoadfa elnei;t)srtoxo ou4om  mict s)s2tr(m nt0tpxoiietyt a2umn p t)arxrirctodoatrau ol( t2tmio iodaptnmnes sf 2tm( onu1oeto oeilt sDem( o;t0trxoxo3iodomDr nes () etmiopnodlptemictls)s2ta(rono0apx ioeildla2elums;(0teenmf3todoptrauvo;s0 2uo(o3nodllt  neta() Dum(mont4alt iociasfa ra(mp;t4aexriocoatlm eln s s0srxm(opiu1lp n ietl( artau pot1oee ifeiydlm emu o t0alenmr iytfpD lueslt sruriopou1lleelnvslt s2trxmp;t0ope  f3tadfm2um(vp u) eeoiocootlpDelivi;(0 2xm(o3ny4apt livtat)srrrx o;u1tpenmoeiytls2rm(mo t)tlxrio to1fm ran o;s srxrxopnydomt  iciasfa2um(mo;o4tltn o3tltfs2rl( s;t4aeeoirciotfmtrlnei () 2urxr3no4apenmfvi s)arraxm ou1optnmo3ils m ra( snt4teeniocoy1oa e i s s) 2xoxrpoo1om elnvtl()srrru p;u0tpe  oetyt aDrm(vs t4tltnxr3ia1fateai ilt trumir3no1ame mnvsl( sDtr(  ot0aetn fetldla2rln o t)aeeomr oydoaD auvo t0teurxr3nu4llte icsa()aDtmx  ou1tlx mociytfs2rlu onu) lxoxr iatfptrauvs s0 rxo(r ou4lmeelnviatf Dumx o;o1tpxnmf3ils m2el(mont4 lxoir3ootlmte nei s srxm(opno1alee fes sfaDtaump;t4tlx ifctld s2ulu p;u0aetrxfctydoaDraueo s  rxo(m ny1ol elivs t) 2rr(ronu4alt ifetad a2elnvs;t4trxnifcoytoaDr nei;s0 exo(r3oy4olt mici sfa2rmu  ou4tle moeiytfsDrmn p (4arenmrciytla e uvil()s2uoxr3oudamen ncta( sDrmu pnt0texnmoeiytfaDeaumsnu4areomf tadomt livi s0s2uoxo ny1om   nvtlt s2rr(mpou0ale io3iysla2em(mon()trtoxf3oadopDrluvsls srtrxr3oudap emivs t a2rmum oo4aeenio3tldfs eaumo;t0altrio3ty1omte i i;(0 etmxrpio1op elfvsls)srua(ront4tpx ioeias a2uaumsn(0 lxnmo tydfpt ln ols0 ruoxo iu4optnlnvils  rtrxrono4tlx ioctadfm rmumsnu4trxrxf3iy1fat anes;t0srumio ny1lm nmfeslt  rur( ooo4olenif3ias s2ea( p;u) ltnir3oa1lpDrlueo;( texm(rpoudameelfvs s  rra(r ;o4opeoiociydlm umn p t0trtnmf3todfa  aues;(0setrirpou1omtn ictas)a2tm(rp;o0tet iietls m2rmnvon(0alxrmr3ia1fpDeanvo s t2urimpnudllt  ivsat  Drmump;t1apt ifetlslm2raumont0 rtnxfcoa1lpt aneslt teum(r3ou1al elictlsf Dta(m ou4opeo feiadlsDea( onu4alxoxr3iytomte nvi t t2xoio oo4lmenmictltfaDuau poo1aee moctadfaDrl(vonu) lxrmf oa1fatr i o;s) exr(o iy4lle  ietasf Drmx onu4oet  ieild a el(vs t) ltomf3oodlpt aneo;t0texo(r3oo1ll elivt t  2rau  nu0tleo o3iaslm2rm( o (0 rxnmo3iotla  aieo;t0trto(r ny4aleelneslsfsrumump;o1oltnmicilsla em(vo;() etrmocty1lm e nesls0 rxmxo3oy1om  licias  Dua( pot0teeo o3iltfs2eauvonu4trtrxo3ty1om raivo;(0 rxrio oo1altn fctas)aDra(ront1apx mocild aDrl( snu)tetoxo iodoat lnei s  rtmxr3iodolenmfviltfartrurpnt1alxnmf3tyt m2um(vs;u0 exrio ta1fa ran ol()s2tmimpiy1op elfvtas s2uaxm nu1tee mictydfa umnvsnu4tlxrmr oytfp  luesl(0trtrxo3iodam emieiat)srua(ro;u4tpx mociysfaDean o;t0tlxnir ta1oaDe u s (0trtmxo nodoptn ics (fa2rrx  no0oex  i3iaslm rl(vs t0tetrxrctatop e neolt) 2xmir3no4ome livs (faDrrxrpot1olxn ieiatlm2ulnvsn(4 etnmo3iytfmtelneo;t0t2umio oydll  lncilt sDua(mono4tex  feiadfa em(vo (0tltnio3oytfpDe uvi;t)trurxo ny4aleelnciasf 2raumpoo4aleoifeiys m2rmuvo;t)teenifcoadfmt anvsls  2ur(opoy4aleelncs tfaDtm(r no0tet ioeildfs rlnms;(4 exrif3totoaD  neilt s2xoxmpoydam nlnctat aDrr( pno1tle  fctadfs emumonu) rxomrctatomt  ivi;()srxmir3no1amee ictat  2ur(r ot4oltomoeilt a rlnvo u4texnio iatlaD  i i ( s2tr(m ou1lme miesl(fs2tauro;t1olxoii3tasls uln s;u) rxrxo iy1laD aiei s)setoir3ny1ale mnvs (f 2rmx  ;u0optnmo3iydfm ua(mpnu)tltrmoctytfpD livslt tetm(o3ou1lmtemivsatf rrr(mpno4aet  ietat m2umn o t4 reoxo ia1lmDr neols0srxmxr oy4olee iviat  Dum(m nt1apt iieias sDeauvo;()arxnxr oy1oaD lueil(0teuo(m3nu1olenmnei s) 2tr(m ;t4aexn o3iydlmDumums t0trtnmoctadlpDrlnvil()trtrxr3iudape mivs (fartmxmpoo0teto ociadlm2em(vs;u0aeerxf iy1opDeaieo t0 rxoim nydlp nlncsa( aDuaxmoou4teeoii3iltfs rlnmsn(4 leoiocio1omtrlnvo t setmxm3oy4lle lfcsl() Dtru  ;t0alt  ictydlm ulu snt4artoxr oytlpteln sls) 2um(m no4aptemivtat)s2tr(r nt1teenmoctatlmDeanvs (4artnmo iatlmte neo s srxrxr iydal emnvils) Dtmumpnu0apx  octld a2rm(mp;u)tlermf3iydomte nes;()s2xmxm3nodol   nvs ()sDuaxm ;u1tlto fctat sDeanms (4 rtnxf3oydfp elivol(0 exm(r3oydlm  mfviat) 2rr(r ot1opeoiiciltfm rm(vp;u0 rtomo3iy1optrln o s) eurxr iodll nlnetls sDtax ono1aeto octatfm emnmo;u)tltnmo3oo1laDeai il()s2urirpnodll  mfcs s) Dta( ont1aexoioeiatfs2rauvp (0 exnmf3todopDelieil(0t2tr(m3oydlp e ivi t  Drr(moot1oeeoifctat aDrl(mpn()alermr totop  li ol() euo(r3ny4olt  ictlsf ruaur nu0aptniociat m2eaums t4 etrxrciodoaDraieolt) rtm(m3iodol nmfcia(fsDra(mo;u1opx  fciys sDrmnvon(4 rtnmfciatomt  uvol(0srxm(r3no4am nmfvta(f ruau o;t0alxo ictydfa em(vs;t)artoxrciatlat  ies ( srxmxr3ny1lp  mfetlsfa2ur( pot4aex io3ilsls elump;u) eeoxr3tytlp  lneolt) 2xmxr3iodlpe mietl()sDuaumpnu1tle if3iytla2eluvp;(4 exomocoadfatr nvi t s2xoirpiu4llenlfcs sfarumumont0texo f3iytlaDrl( o u0 ltrmf3totfp raivols s2ur(rpoudom n iviat  Dtmum ;t0olx mfcilsfmDeln onu0altrxocoytlpte nes t)s2urirpnodame lnesas srtrum nu4aetoiiciys s ulnvs u4 eerif3tytopt lnvo;t)seurim3ou4ap emnvt s  Drmu p;u4olto i3iat m2umumonu4 rxrmr oadfp rlivi s  eurxm no4lmtemies s)s2uaumont4open ociltla2raumsn(4 ltrmoctydomDeluvs;(0trurxo3oydlmte iesat)srra(m ot0aeen feildlm2ran o (4areoif3tatlmD ai ils  eurim oudopt  nesltfaDum( o;u4apxo fcilsfs2um(vpnu0artnif3iydlaDelneo (0sexr(m no1lptnliei s aDtm(r ;o1texoif3iatlaDeluvont4arenxrcoo1lptr uvsls  2urim iy1llt lncsa()artrur nt1apx mociadfsDemnms;u)tlxoir oy1la elu o;s) 2urio ny4lpeelneiat a2ta( onu0apeomo3ildlm2rlu p;t0altnmo3oydoatrlueo t)trumxmpno4al e fcsl(fa2rm( o;o0tlxomieiltfm ea(vs;u4tlxnxf tatfp rlieo;t) rxm(m io4lmtelieilt a2ta( pnt1apt mf3iatlmDemnmsnt0 lenmf iytlm  aueo s0 eur(r3nudol nlnvtas) Durxr nt0tpt iieildfs2ul(mo u0artoxo ia1opDeaneil()sexoxm3iu4ome mfvsltfsDtmuro;o4oet  ocils m emnvont)teenxo tydlm eau i;t0trxr(r ou1ope lfetl( srrrurono4oee ifeiydfa2em( s;(4 lenircoa1omteauvs t0t2um(m3oy1lptnmfvtls)arraurp;t4olxnmiciyd s2rmnvonu)teeoiocoadomteliesl(0sexr(r3oy4omen ietlsf 2rrur ;u0apenmfctydla umnvon() rxnmo ootomt luei ()trurio3iydop  lfcil()aDrm(moot0tltnioetys sDrmuvo;t0trxnir3iodopDeanvo t) eurim oodlp elnvi s)a2ta(mont1oltn o3iytla ran s;()aexoxrcoydopte iei;() 2umir no4am   fetas arumx onu0ope if3iatlaDea(vs (0tlxomoctotlaD  nvs;t t2trio oo4lmen icia()s2uaurpot0opto fctlsls2rl( s t0trenif totfatraieilt)trtr(o iu4alt mnvilt  Dtr( o;o0texo oeiytls um( p u) reoif3iy1faDelnei;t0texr(o oudol elnvs ( sDtmxrono0tpenmfeilt m el(mo (0 rermfcty1fmt ln ilt0teum(o iydap emnesa(  Durur ;u4oet mfetatls2rm(ms;(4 lermr iy1lpD anvo;t) rxmiopiodom   iesa(f Dta(moou4tet mfciytlm uau s;u)tlxomf oo1opt luesls trur(r oodop elnvils) Durum ;o1ope  oeiyt mDel( p;u4artnmo3iytla ean o;t0 2trim no4om nmivil(  Drr(r ot0tlxoiocias a2rlnmp;(4tleoirciotfatrlnvo;(  2uoxopny1op  lfciat  rta( oot0olxnmf3iydfa2uln s;u)alxnmociydlaDrluesls) rtrxm no4amtnmncilt  rrrum ou1tpxnmocilslm2rmump;()trerxr tatfa e u i ()s2tm(o3oo4llt lfvsa(  Dtau ont1apxnmi3iatfs2rau s (4 lxnmr todom  ai o ( t2umimpiu1olte ivil() Dtmumpnt1apxo o3iltfm2um(ms;u0 etnmf3iatlm r ivols)texrxm3nudaltnmici (  Dumumooo4apeoioctytls emn snt0trenmfciydfmtelu slt t2uoxrpiu1oltn nvslt arua(mpnt0open feiytla rl( o;()teenmocoatoaD lieo;s trtoio3iudlmtnlfcils)s2rrx pou0apenmoeiatfmDumu s;u)arermr oa1fmtraivol(  etm(o ou4lleemnvtlt) 2rau  ;u1aeeo o3ildls2ra( s;u) reoxocio1fat  neil()teumio oy4ape mfcs t) rua( poo0teeoiiciatlmDra(vp u) eerxo tadopteaneslt0s2tmxmpnu1ap  lnvs () 2uau pno4opeo o3iysfm eanmpn(4altnircoo1lmD lnei;t)t2xrxr io1ome  ncsatfa2taum ou1aptoiictltfs rlu s;()areoircoatoa r i s (0s2um(o3oo1lltnmietltfsDur(m ot4aee mo3iyd sDrlu s (4 renxf iodoat luvils0 eurim3io1lme lfetlsfaDrru pno4aeeo fetatfmDumuvsnt0aeeoxo3ty1fat ai i t0 ruriopiu4lp elnviatfa2tax pno0teeomo3iaslsDeaumsn(4arxnio3oatfm r nvol( teumir3no4olee ics t)a2ta(r ;u0ape mf3iltls ra(vsnu4arxnircoa1oat  neo;(0texoxo3nu1lm emnctat sDtaump;u0olt  fciadls rau o t)areoif ia1faDeli ils0 etmiopoudal n fesl()srtrxm ;o4olx mociytfs rmnvpnu0 rermfciodlm elu i;() 2xrxm3oo1amte ies tf 2rax pnu4aeeoiictldfs2ulu o;u0 exrif oa1lp   n ils texr(m3ou4amte ivtlt)arrrx  ;u0altnioetydfs2emu o u0 lermoctytfa   ivs;( s2umir3nodlp  lfct t s2trxm no1teeomi3iatfmDrlu s t0 exoir oo1oaD aueolt)truoxopio1lpte fcs tf rtrxrono1ale mfctas s2rmuvp;t)alxnxf3ia1fmtranvsl(  2uoxrpny1alenmicil(farrr(rp;o0olx  ictad s2umuvsnu0 ltomfcoodfmD ln o;( seuoxm3iudom nmneslt) Dta(m ot0tlx iociysfs2em(vo;t4arxrirctotfmt an i;s) 2uoxo3iy4lpenmfvs sf 2urxronu0tet  i3ildfm2rl( snt4tltrio3ty1lm rauvs;t) 2ur(r oodamtelfcslt srur( p;o0tptoioeiadfaDrl(vo (0 etnxrciydopt  nei s0seuoio3iodaptnmieslt)srtmurpou0aeeniiciytfa ul(vp u)aexoxrciydlptrlu i t0 2ur(mpnu4opeelfctat)sDua( poo1alt miciatfs ranmpn(0 etrxo3iatoa  luvs t0srxoxm ny4olt lieias arrmum ;t0altnifeilslaDea(vo;(4aetrir3iodlmD  nei (  rtoimpnu4lltn fetls)aDurxro;o1apenifctltfsDra(mp;u0aeeoxo3to1omtr ivi;() etm(r3io4al n nvtl(f 2tru pot4aexnioeiatlsDean o u)aetniocoydfmt  i o;() ruoir3nodame liei s  rrr( pou4oeeo f3ias a ua( o;u0trenxr ia1lat  n i ( srxrxo iy1aleelfei ( sDur( p;t4ape  o3tytls2ulumo;(0trxoio ta1la  auvo;s setmxm3iodope mfei s  2ta(ro;u0oetnmicildfa rl(vp;(4 rxrxrcoy1fateanvi;t0 eumxrpnu4lpenmnvi t aDtr(monu0aex mietlt mDeluvsn()artoxr totfa ean ol()s2xrir3iudal  mnvsa(fa2ua(  ou1tetn oeiysfa2ranvs;u4 etrmr todlat lu o () exmio iu1am  mfei ()arrrur no1alxn ictltlm2rln p u) rxrmfciy1fatranes t0t2xmxrpoudamenliciat artaumo;u4apt mieils s rln o (4alxoxo oatfmteauei t) 2urimpiydll n iei t)aDra( pno1olenmfetatla2ulu s t)altrxr3io1faDran s (0s2um(opnu4omte ietas) rurxr ot1aeeomfcilsfa2elump;t4trtoxo oytfa eluei t  rtoxr3oy1op   ietas  rrrum ;t1apxomieiaslm ulu pnt4 reomr tytfp rlu o ()setrxmpoy1lp nlnvt ( aDtr(rpno0openmiciadfa rmuvs ()tlxnxf3ta1lp r nvo t0 2uoiopoodlptelicia(f 2tau ont1ole  f3iltfm emnvs t0aleoif ootomD lnvs;(0 etm(mpny1lptnmnes tfsDuru o;t0opto fciyt a uan pnt) rerio ootla  li i;()texoxmpiodolenmfeilt sDua(m ;t0ope miciys aDem( pnu) eeomr3ia1oaDelivolt srxmxm3iu1lmeemnct (  2rr(ront0oex if3tys aDem(vo t4 eeoxo oa1fpD aieo;(0 rtoim ny4ole  fvs s)srrrxrpnu0apenmietas mDraums t0 eeoiociytfp eaues;t0 rumim nodop emfes s)sDumu p;o4tpe  fciaslmDrlnvo u) eenio totfmte i o;(0setoio nodlmtn iei t  Duru pnt4opxnmf3tatlsDumuvp (0altrxf io1lmD au sls) exoxr nu4apt livs s sruru o;u1texnmictld a rlums (4tltomf todfmteai il()teto(o ny1olen fvi t)sDumu  nt1oltoiictadlaDul(mo;(0tetomo3io1fatrluesl() euoio oydol e iesa(  rtr( pot4altniieiys aDul(mp (0trxrmo oadomtr u i;(  2uo(r3io4lm e fvs s) Dtrx p;t1opt mf3tls mDulnvo;u0texrir3iatopte uei;t)setoimpno1optemfvilt a2taxmpnt4olt  oetatls uan snu0alermo3oy1omDe neo;t tetmxo iydome mnei s  Dtax  ot0altomietadlsDrm(msn(4arxrio oytoa rai sls trurio ny4aptn fcs ()a2tm(mo;o0tpe  fetlsfa2rmumo;t0 rxrif tydlateanvol(0sexmirpio4lptnmivsat) rumxroou4tpxnmi3tysla ra(ms;u) lerxf iodomDeaivol( trxrxopnu4alt mfei t)sDrr( ono1opxn octyd sDrlnvs u0 etrxr3oatfaD lnvil() rto(m iy1lpt mnvi s) ruau o;u1aexnifctld m rlumon()arenio3oa1lp eanvolt0trtr(o nu4olte ncils)s2tmxrp;t1tetnmfctysfs rm(msnu4alxnmf todom e neo s)s2urim3oy1altnmnes s  2rmu ooo0tpx  oeilslm2umump;()tltomf3io1fa   ues ()s2umxm nudol emnci ( sruaxrono4ape mf3ils mDua(mpnt)tlenmf tytlpt li olt0texrxr oo1omenlivsltfsrrrx  ;t4tpt  i3tys a2uan p t0trtoxf3tydlmDrlies;s0srtrio3nudlptnmfvtlsf 2tmxr no4tlx ifciadlsDua(mp (0 rxoxo totfaD  i o s t2umxo3ou4lmenmnvi ( arrm(mo;o4tpxnmoctld m2ua(vs;()texnif3iadoat  u s t s2ur(r3oo1lmeemfvsa()aruru pot0tlxo icild m um(msnt) rxnir3iytomt lies;()sexo(r ou4amt  fesl( arrrur oo4tlt mi3tyslaDuan onu4trtnmo oydlmtrlu i;s t2umxr io1alenlivsas)a2rm(ro;u0alenioctadfsDua(mo u4artoxr3oo1fmt  i o t0 rxo(opiu4lmt lncsls) 2uau pno4olt  ieias sDemuvon(4 etnmrcto1omt lnvs s)srxoio iydomt  fetas sDtm(mont0alxomf3tltfsDrln o t)tetoxfcoytlm  anei;s  rurir nu1oltn nvi s srua(  ou1tex  i3ilt mDel( p u4arxomr oydomD  u o;t0trxm(mpiu1op elietas srtmumpnu4oet mf3tytfmDea(mo;t0 ltnir tytfaDrluesl(0s2toim3nu1olt lncta()sDtr(moot0optnio3iys s el(vs (4alerxr oa1lpteauvo t srtm(o oudllenlfvi s)s2umum no0tee  f3tldls2eauvp;t) ltrxo3io1op elu ols0 eurxm3oudamtnmneil() Dtmxr ou1tetomo3iasfaDelumon(4 lxrircoo1lat aies t  2trxr no1lltelictatf Dtaxr nt1ole  ieils s2ua(mp;()alxnif3oa1lmDr ues;s)trxoiopou1ole  nvsl( srumum oo4tet iicildlm2rmu o;t0alxnif ootopt auvslt0seurirpnodale  fvi s)artrurpnu1optn oeiat m el(vsnt)aetoir iotop  lnvilt) rtr(m3oudapt lics s) rrr(mo;o1ope  iciytla2uan p t4 rtrircoy1fpDeauvi;(  2xoxo oy4olt  feil() 2umum oo1tpto ocias sDrl( pn(0 reomo oatla raueil( t2uoio ny4ope  feils)aDuaxrpot4tpt if3iysfsDua(mpn(0tlxomociytfp eln il( teur(m oy4opt lfctas)s2urxmpot1aetn iciytfa emuvon(4 exrmr3oadoa ranei s) 2xrxmpoudllt mfvil(fsruaurono0oexomf3iyslsDum( o;t0 lenxrciytlp raues s s2uo(opoydoltn neiltf Drr(mo;t0opx ifeild sDrl(mo u)aeeoxf iadfm r ieilt0 rurxopnu1op nmnetas)sDrrxmo;t4tpeo ieiltfm eaumo;u0arxoxf3iadfaD aues s)s2toxopiu4lmte nesa(  Dta(mo;u1opxnii3tydfs ea(vs;t) rxrircio1fat aneo ( tetr(rpnu1optn fes (fs2tmump;o0ape ioetas a ulnvo t) exrmfctatlpteau i ( truoim3iy4apt mnvi s  rraxmpnt0tlxnif3iysfm2em( on() etomfcoodlmDrlnvo s)seurxo3ou1lm nlfei s  Dtm(r oo4alt mfeiyt m rm(mpnt) rtnmr oa1fp r ivils teumxo3nodape lfeil( s2urxr ;u1tleo i3tld sDea(mp t0arxoxo oatlpDe n i () 2toio nu4ap n ietas) 2urumpou4tlx mfeiadfa2ulnvo;(4aeerxr oa1fa eli s;t)srumim3nodol n nvs s sDtmxrpno0apxo ociltlaDul(vo;u) eenmfcoadlm  lneo t0trxmirpoy1lm  lfcs tf Drmxmpot0oetn oeiys aDrlums;(4tltrmrcoadomtr nesl(0trxrxr io1lmte nei t)a2ur( oot0tex mieils m2rmums;t4tlxrifcoadomt  neo t)s2toir io4oleelietas)sDuax  ou0opxnmicilt a2umuvp t) rxnxr oy1fat ai i;t0srxoxo iu4openmfesatfsDuau p;t0tee ii3tas s ea(mp;t) etrio iotoatelnvsls0srum(m3oy1altelnvs t)aDrmx ono4aeenmfctasfa eanmo;t)trxoxo3totfmDr uvol( trxr(o3ny4apeemivi sfs2rm(rooo1tpeniiciadls2em(ms (0tetnxf3iydlp rluvi s  rxoxm io4optn ivt (f Dtm(ronu0altnioetyd m2uln pn()tlxomf3iy1fptraueslt s2toxo ny4omeelncta(fsDrax pou0oex  f3iyd m el(vs;(0trerxr iotoatr ivi t seuoim3nydoleelnvs s) 2raur nt1alx  oeiadfm rmnvs (4 etriocia1la e ivols tetmxo3oo4ll elneils a2urx  ;t4tlt  f3iat a2eluvo ()texnif iadfpDr ies t  etmxr io1omt mivsl(  rtru  no0altnii3iydfs ea( p (0aeerio iydla rauvi t)setrir oo4lme mfetl(f Dtaxr nu1oetnmf3iydfs2elnmpnt0 etoxr3iadfateli s s  2tm(mpio4ame mfetasfs2urx ont4tlx  icildfa2uln on(4tleoifcoydfaDrauvo ( s2trimpny1am e fes ( srraxrp;u0tet  f3iaslm uluvpnt) rxrmr io1lmD  ueslt trtoir3ou1optelfetat) rumxront4tle  octlsfaDra(vo (4trtoxfciodoa   n o s0srtrio3iu4ap elnvils  2ra(mp;t1tlenifeiys m2rluvs u0trerxocta1oate n i;(0 exrxr3no1om  lfcils)s2tau onu1alt moeiadfs eau pnt)texomf oa1fat au sl(0srur(opiy1lmt mfeiat) ruaur nu1opeomfcild m2eau s;t0aeermf3iodopDrlnei t0s2trir ou1opt mfvias)artrumpnu1tlenif3iltla2uauvo;(4aleoir3oatlptraieo s0trxo(mpnudaptnlnvtat  Dur(m ;u0oeenmi3ild mDemu o t0trxrmo3oytlp raueols)trtrir3nodlm elictlt  Drm( onu1olxo i3iltls2eau p () rtrxf iatfpDraneo;t trum(opoo4lltnmfvsatfartm(r oo0ope  o3iat m rmn s u4 etrmf oatla eai i;s0t2uoxmpno1optnlnvtl(f 2tru  ou0olx  i3iadlaDrl(mo;u)texrmoctadlaDrauvi;t  eumio ny4al nlncil(  2tax onu1alxnmiciatfsDeanvpnt0 etrifcto1opDraivi;t0t2toxo nudoltnlneslt  2urxmpnt4alen fciydfaDemu pnt4trtnxf3tydfptranvo;s sexoio oodamtnlietas)srtmxmpnt1oleo ociad mDranvsnu)trxomrciadoaDe ies;t  ruoir oo4omt liei s s2rrur oo0tptomfeiadlm2elumo;t4 lxoxo3oatfmtelnvs s setoim ou4al nmfvi tfsDtmurpou4aex  ieils s rm(mpnu4tltrircoo1oaD lnvs;(0t2um(m iydll  lfvtlt)aDuax  ;u0tlx mfciyt s2ul(vs (4 ltoxo3oytomteau s;()s2urim3ny1omenmncsat sDtrxr no0altoifciltfm2uaumsn(4teeoxo3ty1lm   u ils)setrxm oudomen feil()aDrmxmpou0alx  ociltlmDulums;(4aexoxf3iadoaDe ieo;t trum(m nydlp n fcta( artr(r ;o4oeenioeilt s2ulu s;u) eermr3oy1lp rau i;s s2um(mpoydaptnlncia(fsDumu p;u0tet iicilsla2um( p;u0 rtrioctatfaD ln s;t)trxrxr oy1op n ies s arta( onu1tee  feilslmDrmuvo;t0arxomf3oy1omD  n o;s s2toimpnydamt lfviasfa2rmxrp;t4tlen octls m rm(vo u4tltrmociydlmtrau 
\ No newline at end of file
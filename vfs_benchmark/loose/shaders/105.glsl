@@ -0,0 +1 @@
+neo;(0 rtmiopnudamte nvi ()aruaurpoo0aptomf3tadla ulu p () reoio3iytoa rln il(0setmxmpoodam emncsl( sruaxmo;t0alt mfciaslaDrauvo;t0 exnircty1om elieil()seur(opnodapt mfvia(farurx o;t1alenioetadlsDulnmpn(0tetnir3oydlptrlnvils)s2xrxr3oydolte iesas) rta( oou0oee ifeiltfa rlnvo t4teenxo3totlpteai i t)s2xmir ou1altnlieta()srrmurpou0tpxn o3ils s2rmnvon(0trxnxfciadopDeli s;()t2tmiopiydom n fci ()a2tmuro;o0tltn octysla2uanvon(4arxrir3oadlatr n ilt)s2trxm3oodlmtnlncias)a2ta(  nu1olxn fciysfs2rln o u0 ltoxocoydopDrlueo ( srurxm iudam nlfctls) rtmuronu0olxniiciydfa2umu p;t0 etoifcto1fpDrlnvi ( s2um(mpnydamtnmfvilt sDrmurp;o4apt  o3tasls2rl( o;(0tltomrctadlpD au o (0 rtmiopoodop emfci t srtmu  nu1olen icilslaDua(ms u4trtnmf oadfaDeli s (  eurxopio4ome liviltfartmumpno4alto feiad s rl( snt4trxoxo3totfmtelues t0 2uoio3nu4ap  mneilsfartrxrp;o1tee  fciytfa eauvpnt0tltrxf todopteau ilt0teurio ou1openlfciat)a2urxmont0teeoii3iltfmDemnvpnu4tltnmoctytoaD  nvo;s)setmxo ou4am n ivt s artrx p;u4oexnmfetasfs eanmpnu0 lxnmrctotomDeaieslt0 rtrim3nu1ape mnci (f Duaurp;u0apt iietadlaDrmu s t4aleoio3oytlatr uei t0seur(mpny4amtemfet sfsDtmx oou1oexniiciytla2umnvsnu4texrxo iytfmtelueilt0s2uoxrpoodopen fvtas)s2umx p;o0oex  i3iadfs ua( o t4tlxnif iydomD  i ils) rtr(r3iudape mfvsasfarrmxr no1olx moetldfmDrlumont) exrirctatlat lnvi t teuoxo3oy1llte ncsls)a2umum ;u4tpx mo3tld aDel(vs;u4aeenxo3iytoat lnvs;( tetrxrpiu4ll  mnvsltfsrtrumont0tpxnmfciad a2ua(mo (4tlxrio3oatfptran o;s srur(o3no4lmtnmncil()s2tmxrpnt1alxnioeiys m rmnmonu0alenmocoo1opDr nei;(0 rurxmpoy4lmeelfvt s a2tr(rooo1ole mietaslaDem( o () ltrmr3tydop raiesls) rurim iodol n ivtat)s2uax oot1alx  icilslaDumnvonu0 ltrmfciodlatr ivo;s)s2xoimpnydopte ictl()aDta(m nt4tpeomo3ilsls2ulnmonu)aetoxf3iodlpD ai olt0s2tmim oydomtemictl( a2rr(ronu4texn ietad m rluvonu)trtrmo oodfmD  u o t0srtrxopnu1apt  feia(f rururpnt4opt ifciyt mDea(vs u) etnir totlp eln o;s)sexmimpiy1lptn icilt)a2tmxmpoo4tlx moctydfa2rmums;u0tetrmfcoa1oatraiei;(0setr(o3no1oleelfvtatfa2rmumooo0tlto fctadla rln onu4altrmfcoatfpDran o;t0trtr(r3oy4llt lieslt)arrrx  nt4teeomoctys m2ra( pn()artrif3iadoa  lnvo;s) rxoio3ou4lle  nctl(f 2tau p;o1tle mfeils m2eau p u0trtrif3to1la rlu s ( texmxopnu1ope lnvt s srururp;u0alxo fctltfm2ua(mpnu4tltrif3to1laDe n s t0t2xrxopoudlmteliesasfs2umur ;u4aptoioetlslaDemumsn()aeeoxfctodfp elu o;t0 2umxmpiu1op nmfcsatfsrtm(rp;o1opxomi3tadlm uau s;u)tlxrir iy1oa e uei;(0srtrxmpnydolt  fcsas)sDum(ro;t1tex ifeiad s em(msnt0teeoxrcio1fp eluvsls setmxm nodaptnmiet s)sDumxro;o1tetomiciatlmDuauvon(0 leoif iadfp ran il(  2trim iodlptnmneil()aDuaur oo4opt ifctlt s2ran o;(0 leniocio1fat  ivs t0 rtrio io4alt lfes sfsrur(mp;u0optnmi3iasls umn sn(4 rtnmf3ty1oa r n o;t0 eurxopno4opt livi ()artmxmpno1oeenifctys s2ua(vo (4 ltnio tydlat anes s0s2xoio iu4opeemfvslt arum(mpoo1alt ifciydlm elums;(0 ltrmr tydfpt aneo;( texoxrpiudll  mnvsltf rrruront1tet mieilt sDrlnms;u4 rtrio3tydlpD luvs t s2umxrpno1ol   nesas)srtr(r ou1aexo ieiadls2ranmo;(4tlxrio3oy1om rauesls0s2uo(rpiudapte iesl(f 2umur nt4tlenio3tad mDea( p () lenir3ty1om  lnvs;s0trumxr3iu1ameelnet ()sDra(mo;o0teeomo3iyt a2ulnmsn(4 rxoifcoatla r ivo s0srumxo iy4lm emnvsatfa2taur nt1olenioetysfa emnvo t) exnxf3ootla r uvslt  rur(rpou4om nlnvsa(f 2ua( o;o4alto ieilsfa rluvon(0 ltomrcty1fmDrlies s) eumxo3nu4lmtnmfvt sfsrtm(  ;t1olxniieiltfm2rm(monu) reoif3oytlmDelnvi;t)seuoir nydop  micil( srtr(mpou4olenmfcilsla eluvo;u0 reomrciydom eluei (  2xmxo ny4al  mnvs s aDrmxronu4tpe mociatfaDea(mo;(0altomfcto1laD  uei s0 exrio3iy4amen fvs ( aDurxrpoo4tet mietasla rln p;u)arxnir iydoa elies;t)sexmim nu4open nvsltfa2uaumpou0olen fctls m el(mo u4treomo3oodom rlivo s)tetoim oodap n ictlsfsDta( pot1opx micildfa2eanmsn(4teenifcoo1omDe ivs;s t2um(m io1omen nviat  2tmxm ot0alt if3tad sDrmn p;t4tetnmf tadlaDrauesl(0s2tm(m oodolte fvtasf Draum nt4tetn fctydlmDrlnmo;u0tltrxr oodopt au ilt) exoxm3no1al emics s)a2umxr no1olen fctatlmDrl(mpnt) rxrxr ootom r nvolt t2tmio nu4ope mfeias)arua(rpnt0apt  feiys aDeauvs (0alenxociatfaDelues;( teuoim3io4lp nmnci ( arrrxmpou0altnmi3iyt m2emnmpn(4 lxomr iy1lateauvi;(  2tr(m nu4lpee nct t arta(  oo1tpxomietytlmDrm(vont4 etnir tadlpDeln o;()srxoxo3nodomeelici t a2ua( o;u4opxoifetls aDean o u4altrmociatlpteli s s0truo(rpnodam   ieia()s2urur ot1altniicils sDra(von()altrmo iotoa   i i;t0teurirpiy1optn iesa()artrx  ot4opxoii3tas m2el(vs;(0teeomocia1fm r neilt s2xo(o3iudal  mfetat)aDtr( oot1alxo oetadfs ulums;u) lxrio3tadfateanvs;t) eur(opno1apeemieiatf rtrx  oo4alt iocilt a ul( ont0arenmrctytlpDr ues;() eto(mpoo4lm n nvt ( aDrr(mp;o4aeeoif3iysls2uan o;(4trermfciodlm r ues s srtrxm no1ol elncsls a2rmum nt4tpx mi3tysls2ua( p u) reomr3oy1op elieols t2xmxo ou4lmtelnvia(f rtr(mpou1tptomo3iltfs rl(vo () rxrxf3tydlate uvil(  2uoirpiy4lmee fcta(fa2rmxm ot4alxnmociys a2rmu snt4 eerioctytomt lnvs t0srtmxrpnu1apt lnvi s  Dra(rpnu0opt miciyslaDrl(vo t0trerxr3iy1lmt  nvi s)trtoio nu4opt  fcsl()a2trx  ou4ole  iciltfa2rm(mp u)altoir iatoaDeanvo s sexriopio1om  livtlt srrmu  ou4tpe  fctls a2eluvsnt4 etrif3oy1omDeauvo t) rtr(opoy1oltnlictls srrmu pnt1apxnioctldlm uauvp u4 exoxfciy1fpt lueo;s0srur(o ou1aptelnesl(fs2rrurpnu1tlto oeiad a2elnmsnt0artomrciadop ranvo;t0 rxm(o oodlmtnlfvias  ruaurp;t1oee  ieiadfsDranmp;(0trtrxo3oy1lmtraues;t)t2umxrpno4olee ncs (f 2umu o;t0opeo o3ildlaDrmuvo;(0trerir3tydfmt  n o;s)texoim iydalenlfvta( s2ta(mo;o0apt ifeilsla rmnvo u)artoxrcia1opDrlneol() 2xmim oy4ameemfet t aDurur oo1apen fcils mDul(vp;(0 leoxo iydla  aieo t srxo(opou4optn nci sfaDrrxronu0tlenmoetaslmDrlums;u)texrmocoa1fm rau s t0s2xm(rpoodole mnvtls sDrr( oot0tlt mieias m el( p () exomf tytla r ivilt0seurxopiu1amt mfet (fa2ururpno4aetnmo3tatla2ulu p;()trtrmfcoo1lm raivs;(0 exmxo oo4lle  nctl(  Drrxm ou0aeenmfcildla elnmp t4aexoif oadfmt an s s0s2xo(opoy1alt mietl(faruru o;u4texn i3ilsfa2el( p;u) rxoxf3io1laDrli i;t0tetrim io4llt  iesa() rurx  ou1tltoiociad sDrlu p t0artrxr3oydom elivi;(0 rur(rpnudale micsls)srrmu  ou1tltomo3tadls2um( pnu4arxrif tadlm   ieilt0s2uriopio1lm  lieil() rumurpou4oexniociat m rmnvsnu4artnio3iodfpDeaueilt  rtrimpoy1op nmfcsa( sDtaxmoou1oleomfetad a umumon() rtoxfcoy1faDr u s s)srxriopiy4amt  ici ( s2rmu  nu0tpxomociad s2rmumsnt)arenifciotlaDelu i () etoxm3ny1omte ics ()artmum ot0tlt iiciasfm eln pnt) renxfciydopte nvils0teto(m nu1lp  mnvtls)a2urxrp;o1tlenmiciadla2rmnvo;t) rxomr3tydomt  u o;() rxmxo iu1alt  iviat) Dum(rooo4olxn oeiys s2el( p t4 rxniociytopDrlnes;s) 2uoxo no1ol nlicslt  Dtaurp;o4oetoif3iasfa2eau s (4 rtnmrctatopDrlneo t0 rtmxo3oudom elfeslt  2umx pot1apen ieildla ul(mo (0aetoio3totoa  ln i;t0srtm(o oodole mivi sf Drr(rpou1tpeoiictat sDrlnvo (0teermoctydoaD anvs t0 rtrxm3nudlle mnvtl(f rraxrpoo0ole mf3iys s2rl( s;() exrmfcio1fa e n s;(0srtmxopnydap  mics tf Dtr(mooo0tlx moctadfaDean s t0aexoxfciydlp rluvil( trtr(m ou1lmenlivi s)arur(r ;o4oleoiiciad sDeanvsnt4alerxo3tytfp rlieo;s t2uo(m3ny4lmtnmnvt t artm(rono4apxn iciysla uauvs t)aetnif3ootfpteln i;s0tetoxr oydaptemnet tfaDumu ooo4alx mf3iat a2rl( s;()arerxr tadlaDe uesl()srxmir nodlptnlnvil()artm(  ;u4ape  oeiytlsDeln snt) exrmfcoa1fmteanei t s2tmio3oudoltnlfvta(fsDtru ono1tpxn f3iat a2emump;t4teeomf3tatomte uvi;s) eur(opou1al  licsa( arur( oot1tee  fetls m2uluvpnu)arxrxf iatop  lnei;s0 2xoio nu4ll nmfvi (f 2ra(mpnt0optoioeiasfsDum( on(0 lxoxfcta1fp  auvo;s)srxrxrpnu4ol elnetas a2rmumpnu1texniietyslm2rmn s u4texrmf ia1oaDraieo;t0 rumim ny4lpe  ivi s artrx pnu0aptnmfciyd a2uanvs;t)teenxf io1opDraivsl( srxoim nydapeelnetl( arurx ono4tlxoiictaslm ea( s;t)trxoxf io1late ivo ( trto(mpiydlltemfcsl()a2ua( ono1tleoioeildfsDumuvs;u0 exomo3ia1opDrai i;( t2trxopoo1lp e fvs t  Dum(m ot0aetn ictat m emnvon()texnxrcoadop   ieo t0t2urio3oo1lltelfvs (farraur nu4aetomo3ils a2elnmpnu4altrmr oadlpteanvo;(  2urir ou1llenmies sfaDtm(roou1aleoioeiasla2el( s;(0arenxf iatom rlueo;t0t2xoimpny4amtnlnvtatf Dtmxm no1tptnmoeiydfa2rauvsnt0 ltnmr3ia1fmte i o s teumim ny4optn nvs s) Dtaxm no1aptn oeiytlmDemu s u4 etrio tadom rlnes s t2toimpiu4al elfvt (faDum(rpnt4oetoifetadls2raumpnt)arerxo io1fpt lueol(  etr(opoo4lltnlics tfaDta( pou1aptoiieiltfaDrauvpnu4alxnmf3io1omDrlieo s0 etrxopny1ol e ietlt)aDtmur no1tpx  ieiydfs2uau o ()aeeomfctodfaD anvi;()t2xo(r3oudlpenlfesasf Durump;o0oleo ietatfmDeauvs u4trtoio oadoatelu il(  rtr(o nydolt  fesas aDurxmoou1tptn fctatfa2elu p ()altnmr3iotlpD ai s t0sexm(r nu1opt lnesasfaDtmu oot4tltomf3ildfm2ua(vo;u) lxoio3tytopD auvs t t2xrxrpoo4alt  ict ( aDua(rono1opto ieilsfs ra(vp u4alerxoctodlmteln i;()sruo(o iu1ome licil( s2tmx  no0apt  ociatlm2emuvpn(4aleoxr oy1lmD ln o;(0sexoxr3oo1amtelfet s)aDtaumpno0tle iiciysfa2rl(mp t0arxoifcoadfmtr u s;s)sruoir3oydll n nvtls)aDtrxrooo4olen ieiytfsDemnmp t0 rtnmrcia1opt  u ilt texoxopnydome lfetatfartaxmpoo1tee mf3tld m rmu onu)teeoir3iytfmD lu i;() 2xmxr3ou4lmenmfcils arra(  no4tlxnmoetydfsDum( p;u0 rxomo3iodom e ivi ( s2to(opoy1ol  mfetatfsDtm( poo4tpe mietys m2rmnvpnu)alxnmocta1fate n i;t0 etoxm3iu4lm  mivtls) 2um( o;o0altnmi3tltfmDeanvo (0aetomf3iodfpDr ivi;t)srumim oodoptnlnvsatfarrm(mp;u4apt io3iat sDul(vp;u0tetnmr oodfmDeaivi;s)teuoxrpiodoleemfcslsfaDtrx  no0aee if3ias m2rm( p t0 lenxrcoydfateanvsl(0 ruoim3iodlp  mncsltfa2urur nt0aex iietatfaDuauvo (4trxrmo3oy1fm eln olt0 rxrir3iu4ll   nvtlsf rtmuront1openmieiys m elnvs;() reoxo3io1fptrlu o;t)s2toxr iu1op elicil()sDurxmpno4texnmieilsfsDem(vs t)aeeomfcty1fa rau s s s2ur(m3iu1lmenlncilt)arumxm ;u1tpx mo3ilt aDuau p (0arxnmr tydlm elnei t0 etoir3iy1ap nliesa(fs2rr( oou4aexn ociytfa emnmsn(4texrir3tatop eln slt0t2uoxrpnydamee fvs s arrax onu0tetomieiatls umuvs () etrxo3io1opt lnes;t)t2xr(o nudlle  nesat)sDtmxrono1aet mieils m2elu snu4 leriociytlp e uei t0texoxo3oydopeemnctltfartr(r ;o4tltoio3iysfa2ranmsn(4 rxrmf3oadlmtrluvo;t s2urxm3nudaltn fvs s  rrmu  ;t4apx mocild a umuvon(0 ltrir oa1lpt lnvi;t0 rumxrpiudlpe mnvs sfaDrm(mo;t4opxoiiciat a ranmonu4 eermr tytopD auei;t0 euoxopno1lpe livsa( sDua(mpou1tlx ioeiys a2uln s;t0arxnio oadfptelnei ( trumirpnydomt mncilt) rrrumpnu4aleniociydfs2um(mont0 rtoir3iytomDelu s s0 2tr(m iydapenlnvil()a2rr(mpno1optnio3ils s2rmnvpnu) lxnmf ta1laD  nvi s) 2xm(rpiudlm   nvsatf rtm(ront0alxo f3tldfs2rm(msnu0alxrxf oadopteli i;s seurir oo1ol  mieil() rrrumpnt4tleo ociytfm rlnmp () leoif oo1faDr i s s trtrxo nodomtn ietlt)a2um(rooo1opx mo3tad a2ranmon(4tltrxo3iy1lmt  u s;t0srxmxo3iydopte neils)sDraumpno4altn ieiadlsDrlnmo;t4 rtoxo iy1op eauvs;t0 exr(m iy1llt  feiltfaDtmu  ;t1opxn ieilsfmDuln sn(4 ltrmfctytlmt  u il(  rtm(r nu4lmt  fvi (f Drm(ronu4opxoif3iyt a2ulums (0 lxoirctadoaD anvs;t s2xoirpoudapt lfet ( a2umu ono4tlxn f3iat a emu o;t4tltrxrcoa1la  liei t0trtrir3nu1olenmneta(fsDumxrono4oexoiictatfm umuvo;(0 renir3ootfaDrliei;()s2tmir iy1lmen ict tfsrum(mp;o1oetoiiciyd mDuau s t0aleoio3oodom r uvi;s s2xrir3no1lpt  ictls) Drm(m nt0tpe mietatfmDrmuvsnu0 ltrxociotlaDeai i t  euoiopno4op elfvsls sDuru onu0aet moeiad s eanvo (4aleniocoydfaD  uvi;s t2umiopiydoptelfvi sfartm(  ou1aex  fciys sDem(mo u)tltrio3to1fmDe n slt trxo(o3iudoltnlncsat) rtaxmpnt0aeen feilsfa2ul(vonu4 rtnxf3tatfmDranvol(  rxmirpno4lpe  nvsat)aDum(rp;u4ale io3iasls rmnvp (4 ltomf3iadoptrai slt0setoxrpou4lm nlncia() Dumur ot4olx ioetas aDeanmo (0 lenif ta1lp r neo s srtmxm ou4aptnmfesl()a2tmxm oo0tet mfeiltlm um(mon(0teeoircto1lmt anvol( srtr(o iy4lpenmnes t)a2rm( pot0tex moeilslmDumuvo;() rerxf3oydfp   uvs s0sruoimpny4op e ies tfaDur(  ou4aexomo3iadla ulnms t)trxnxfciy
\ No newline at end of file
@@ -0,0 +1 @@
+i o;(0srxoim ou1aptnlfei t)sDrr(rooo1tet  ietat m2el( ont4alerxr3iodfmD  uvi t s2urio3nu1lme  fcslsf rtaxmo;o4tee mociltfa eaumsnt0texrxr tadlmt  ivs s  euoxm3ny4lltnlncs t)a2urum nu0aetoiociltfaDrl(vo (0aetoiocoo1opt auvi;s0srumxo oo1op nlfet ()aDtrxrp;o1tlxoioctad sDumnvp t4arxnif3totoatrlies s0t2toxmpoudalt  nesls)s2raxmoou0oee  ieiasfa rm(mon(4aexrxf3iy1fmDe ueo t) 2xoirpnu1om emfcsls  Dtmump;o4apt  i3iad s2uanvo;() exomr totfatranvsl()texrxrpiy4ol   neiltf rtaum ot0oeeniictyt a rlu s (4alerif3oa1oat  u s s0 rxrir iu1lp  lnvi s)sDurxmoot1oleo ieiatfaDua( o;u4 leoxo3tatomteauvs s truo(r io1lpte fes t s2ur(r ;t1olx  fctatlmDra(msnt4aexnmf3totfp e uvsls)teur(m iu1omte fesa(fs2trxmono1alx if3iys m em(vo u0 reoio ty1fmDeli o;t texoimpoodopeelnesat  Duaurpnt4olxoioeilslm ul( s;u4trtrxrcia1lp e uvs t) etmir iu4ll   neiasfartaxrpou1opx mo3ildfs eauvsnt0tetrxo iotlpDr iesls) rtm(mpio1opt mnet ( s2rr(  ;u1oltomfeilsfmDrm(mo u)texnmo iydlatr ivi;(0s2xmiopno4omenlfes t) 2trxmp;o1tltnifciatfa ua( s u4arenio3io1om   neo;( trtmxm iydapenlnvias aruax o;t1aeto ietasla2rauvsnu0teermrctodfp eaieo (0t2xo(m nu4amen nvsasfa2uauroot4opto ietlt a ul(mo u0 ltrxfcty1op e nvolt trxoxopnudapenmncia()s2ua(r ot4tptomictadfs2uanmp;()teenxo3ta1lmDeaieo (0 ruriopou1aleemietls sDtm(mpnu1oexnmociadfmDeau s;(4aeeoirctotlmD anvi t0trxoxopiodome mfcsltf rumu ooo4olxnmoctatlsDuanmo;(0 lenmr3tydlm e iesl() rxo(mpiydomenmfeslt arurxmo;t4oee ii3iad a ranvsn(4arxrmfcoodfpD auvols0trxoxopiodoltelivs s a2ta(mpot1tpto fctytfsDumu s u)artrxf iatfat luvsls)s2to(o iy4altelfetlt  rtmu o;o1tetomietytla2uanvp (0aleoif3tatlaD  u ilt  rum(r3iudomtnlnes sf rumxmp;t1tle mf3ilsfmDeluvs ()artoxf oodoatrai o;t  rxrirpoy1lptemivi tfsDrmx  ;o0opt ifciatfs eanvsn()treomociy1fmD  ieo;s0sexoxmpiudalt  ics ( s2urxr ;t1oexomicias sDraumonu0texrmo ia1lp elueo ()s2uo(r3ny4om nmneils)srra( oou0teeniicildlsDrln p;u0 ltnircoadlmDrlneo;t)t2trxrpnudalte ies tfsrrrur ot0oee  oetasfaDuanvs;u) rxoio3io1la r nvi s trxo(m no1om elfei t) Dta( ooo4tlxn ieild m2um(mp (0trenmr io1lmD anvs;t0 exr(o3no4am   fcsls)a2uax oot1ole mfctld sDel( s (0 etnxf3totlm eaieolt0srxo(m3ny4lpt mfcias)srrmump;t0ole  ictas sDra( pnt0treoif ta1lm rlivo t)sexriopnu4lpt livi t s2umuro;t1oleo oeiasla2rl( pnt)aexrmf totfpteauvi;s  rto(opnu1lltemnet s) 2urx ono4altn oeiltlsDrl( s;t) exnxr oo1omt lu olt)s2tm(m iydol  lnvtat)artrxm ot4oleomfetyd m eanmont0alxnxf ootoaDraivo t0seur(mpoydaltn fes s s2tr(r nu4olto fetat a2ranvo u0 lxnxrcia1om ran i;( srxo(o iydlpe mieil( aDtmxm ;o4oetomoctlt mDeaumont)trtnxfcoatfp rlueo;()s2xoxr ou1op n nei t) Drr( pno0apenifeiad a2ua(vonu4altnmociatla rlies;t)t2trxo3oodlpeemivtls aDur(r ;t4tpeoifcilsla rm( o u0 etoxr3iodopDe uvi ( setoxo3nu1olen fes s)srumum oo1tltnmfctlsls2uln pnt4tlxomo3todlptrlnvo s0 exrxopiu1lptelfvs t)s2rmxmp;o1ale iieiat a raumont)altnxr tadopDeaueil(0 2to(o iodlp  lict tfsrtau p;u4tet  i3tys s ranmsn(4teenif tytomtrluvilt) 2urir oodlptemfcsltf Dtmx pot0tetomfeiydlaDranvo t4arenmfcoytfa rau i (0tetmim nu4ol nmncs (f rrrurono4tlxoii3tatfaDrlu on() ltrmf3iotfmD lnvi ()trxr(m iu1ll nmivs s  2rmurpot1opxoiieildla uluvo;t4 eermr tatfm e uesl(  2xrxm ny4al emncsas)aDua(ront0aetoio3iasfa rmnmo u)trermr3oo1fpDran o;s)sexmxo nodlp elivtlt s2uax pnu4tlx  i3tltlm2em(vpnu4texnmr3todlm r ivs s) 2toio ny1opeelnvi ( srurum ;u1oeeo fctydlm2uln pnu4 rtoir3totlaDeluvi t t2xmim io4apt  fes t)sDtmurooo1ope iiciat aDrmuvsn(4tetoxf oo1opteanvo;s s2toim3iu4ap nmicsas)s2taxrpnt4alxoiictat aDemnvp;u)altrxr iodopt  uei;t0setoxr3ny4lltn fctatfs2umx o;t4tex mi3iys m2rmn s t)tlxrxf3iadlpD an s;t s2xriopnydlmee neia(fs2umxr nu4aptnmfciasla2elumo;(4trtrxo3tytfmt aues;t)texr(r oydopt lietls sDumxr no1alenifetys a rl(vs;u0 lxnmo oo1lpD livo;t)tetrimpnudapee nvtl()arrru  ot0alx  o3tyd a em(mpn()areoif3ta1lpt  i o ()sruo(o no4am   ivi s)a2umx  oo1olx mo3tldfa umnvp () ltomo3oytfpDean i;() rxmxr oydllen netl(fsruau o;t4opx miciydfaDelums t4aeerxf3todfp eau o ()s2umiopoy4aptn nei tf rta( oot0oltnmfciys m2rlnvo u0texrxr tytlate i s;s)t2uoxo oy4amee nvtas  2rmuro;t0tltoifeiadla raumo;(4alxoio oadlmD aieo;()tetrir oy1lmenlfei ()s2uru p;t0tle mietldls2rau on(4 leoxociodoatrlueslt0t2xmxopiodll emfci ( s2ra(mpnu1apxoifciytfm2ul(ms;(4teenmocoa1fateauesl(0truo(opnydale  fcsa( sDtmu  ;t1openii3tytfa rm(vsnt0 rxnif3totoaD  ieils)tetrxo3nydopt  fcil() Drmumpnu0aptomocilsls um( snt4teeomrciodfmtrau olt0texoxo oodamtelnci ()sDurxmpno1opeoif3tytlm rmuvp;t4 rtnif iy1fp raivslt srtr(mpiodalenmnvslt)aDtm(root1olto f3ildla2rlnvs u) exoiocoa1oaDr nei (0t2xr(o3oydap n icsat arra(m ;o1apto oeiyt mDumnvsnt)arxrif io1lmDeau o t srtrxo3no4aptelfvtatfsrum( pno1ape mf3iyslm ra( onu4trerif3ta1fa e uvi t  2trim3oudom   ivtatfsDrr(ro;o0oeenii3iysfs2rm(mon(0trerxoctytlmDrlivs;t)trum(mpoydlmenlfeilsf ruaur ot4apxnmoetys s ulums;(4artnxr oodfptr n i s)trxr(m oy1lmen fetlsf 2uax pnt0opeo iciadla el(vsnu4 lxnxo3oadfaD aneo;s s2ur(m3nu4ameelfci t arurum no0aptnmf3iasfs2rlu sn(4 eeomo iodlm eanes;s)srtmim io1oltelfetat)sDururonu4aexnio3iatlaDrlnvsnt)tetnxf iotfmDrau il()tetm(o3oo1op  mici t)arrm(mpnt0aptniietltfa elu o t)alenircootoptean i;s)sexmir3oo4lpe  ncs tfa2rr( pnt1tpeomo3tysls2eln on(0treoxf3ootlmDr i o t)t2xrxrpnudlmeemnvtls) rumxr nu0aet iociydla uanmpnu0arxoif tydfpDeli o s  eumxo iy4apeemfcsa(  2rrxrpnu1oee mietyt sDeanvpnt0aetnmo oydoptelues t)seumir3nodol e fvslt arumx p;u0ape  f3ilsfm2rlums;(4alxnif totlpD auvs;(0 2tmirpiy1am nmneta(  2urxmpnu0apenmoeilsfs2rl( p u4tltnir3tydfaDrauvo;( srxo(mpnydomt  ietasf rtrxr no0tpxniieils mDeanmsnt0alenir3oydomtrluvi;t0 rtmimpnydom n nctls  rtau  oo1oleoiociasfmDeanvp u)tlxoxf3iodfa ranvo (  2xoxmpnudlm elieilt s2tau  ;o4tee ii3iat a em( sn(4 ltoif3tytlm e nei t) etm(m3nydlm n nctas  ruaum ;o1tlt  ocilsfaDelnvsnt4aleomoctotfa elueo;(0srur(o iudlltnmieias)srtrur ;t4opto fciysls2uauvp (4 lerxf ty1fptrlu i;t)texr(m3nu4ole lfvsas  2umu  ou4olxnmietat s2umu pnt4teerxr ta1fmt auvo t  2umxr3nodolt mfcil(f 2tm(mp;o0tpt mietasfsDumumonu0 rtnxo to1lpt an s t seurir ou4ol   fetas)arrrx  ;t0tee  feildla umuvpnt4arxrmfcoo1oa  ln s;(  2xo(m ou4olte fcia(fs2um( o;t0tptnmoetldfaDelu ont)arxrxrcoo1lm  lies;t t2xmio nodal  lnvs t sDtmumoou1tpeomfeiatla em(mon(0texrxfcootla   n slt  rtm(o no1lp emfet tf 2ur(mpno4oetoioctytls rlnms u4aexnifciadlptr n i t  2urirpio4oltelnvia(  Draxm ;t4apxomfctydla ul(mo t4altnxf3tydlpDrlnes;s)t2uoim3oo1apt  nei t  2ua(ro;u0apt iieiat m umuvsnt0 ltrmfctodlpte n il()tetmio3oodaleelfvil(  2um( onu0opxomoctadfa rmums;() lxomf3oy1lp eau s ( s2urxr oo1aleemfeilt)a2rm(r ou4tpe  feilsfm umnmpnt4 exnxr3oo1fp rluei;s  exo(r no4ope licslsfs2tr( oou4tlxniiciasfmDemn pnu0arxoxr3tytlp rlneo;() rtmio3iu1lp nlfeslsf Draur ot0aleomfeiytfa emuvpn() lxrif3tatfat lnei;t0t2xmim nodll emfeils  Dumu o;o1olx iiciad a ul(ms t0 eermr ia1oateai i s  ruoxo3io1apeemieiat) Duau  ou4opt miciysfmDrmn pn(0 exoxrciotopDelu i;( srtrir iodalenlivs sfsrtrx pou1oeeoiiciytfs2em( onu0tltnmr oy1lmDr nvilt  rurim3nu1alt livtlsf ruau p;t4oexnmf3ild s rmnmont4 rermr iotop rli il(0 rum(mpiydom nlieilt) 2rrxmpoo1oltomfciydfa rauvp (4 lerxf totoaDranvo;s  2uoxrpnydlm e fei (f rum(r ot4opx iicildfm2ra(mp;(4aeerxocta1lp elieslt0setr(r no4lm n nvsls srtaurpot1aeen i3ils aDemu sn(0teermfcia1lm eaueslt0trto(r3io1omeelfcil( s2uaurpnu1aee moetyd a rlnvp;t)teeomr to1lm e n o s)srtmxo io4ll nlici tfa2urur oo1tptniociysfmDem( o;() exrxfctadoa e neol() exm(m oudlme mivsls) Dum(  ;t4oeto f3iaslsDrmu on()aexnxr oy1laD lu o;s trto(mpiy1lp nmietatfsrurx ono0oet ii3iydlmDrm(vpn()trenirctodla  lues s) 2xo(o io1al   ict sfa2rrxmp;u4apeomfeild s umnvsnt)tlxoir oydom e neslt)t2ur(m3oodole  fcsls  rrmx  ;t4tetnio3iytfm2rmnvs;()aleoxf3oatoa e nvo;s t2toxo nu4am emfeslt  2trxroou4oeenifciadlmDum(mpnu)aexnxr ootopDrlivi s t2xmirpoo4alenmnciat sDrrxr nu1oetniociltlaDeln p;t) ltrxociytlateai i t) rurxo3nu4lpenlivsltfarum(mpno4alto f3iadla2ranvp;t0altnxf iydom raiei;t teuoim3iydoltelnvslt) Dur(r ou0aexoifeiat mDel(mp;t) rxomr ty1lmDrln ils)s2to(m3iodame lfvsa() 2ur(r ;u1tpe  fctadfmDelumsn(4tltomr3iytlpt  uvs;() rxm(o3nu4lp elncs (farrmxrooo0alxn iciydfa elu ont0trxnmo oadfm r n sls0s2xm(o nydomenmncs s)s2tm( pnu0texnmictadfm rm(vo (0arxrmo3oo1fm eanvilt)texr(mpoudlpeemncslsfa2trum ;t0opxnmieias m2el(mp;(0 leoxo3oatlmDrai i;s) etrxr3nudll  mnesl(fartr(ro;t1olxn iciaslsDra(vsnt4texnmrctadfmDrlu s t s2to(r3nydlle  nes tf 2um(moot1ope iicildlaDua(mpn() lxrir ia1lpt  i ilt  2urim3ou4lp nlnei tfsrrmu pnu4altoii3ild s2elu o;u)arxniocoo1lmte n o;(0 rtoimpny1optnlfcilsfsrrm(mpou1oexomf3iysfm eaums (0 lxoif iytfaDr nes s0setmir3iydlp  mfctas  rumx  ;u4aeeo oeilsfm2rl(vs (0tleoxr oadfm   ivi;t  2tmxmpnodop  lfcil(  2ur(mono4oetnmiciyt sDea( o t4 rtomf3ia1lat  uvs;(0t2tr(mpio4lm nlicil(fsDtmxmoou4opt  oeiyd m2rm(mp;() etoxr3totlp   ivs (0 eur(r3no1olenlfeslsfaDuaxmpot1ale mfciydfsDel( sn() rxnmo3to1fptrai s s0 2tmxm ny4altelfvil(  rua( pno0tptnifciydfm2rmuvsnt4tltrxo3oytlmDrli o;()trtmxm ou1amt mnetl( sDuaxmp;o4tpt mf3tlt a2eanvonu0 lxrmrcootlat lnvol(  2xmiopnu1amtemfctls)arrau ont4oexoioetysfs2ean pnu0tetrxfcoatfat lu slt srurirpiu4optemfcsls) Dtm(root1texoiicilsfa rlnmpnu4arxoxrcio1latraueo t0 rum(m3iydolen fcils aDtrum ;o1tptomo3iydfm ra(vpnt)arxoxr3todopDe n o;s0srxo(r3iu4amenmicil( sDta( o;o4aleoiiciyt mDulu pnu0trtnio3ty1faD lnvslt)setm(mpny4openmivs t sDtmu  ;u0oeto fctad m uauvs;t0altnmocia1fmtr u ils s2xrxo no4am elnvtas  Durxr ;u4tetnio3iadls2eauvpnu4arxnio3iodfptran ol()t2uoxmpio4lmt  fci tf 2raumpno0tlx mf3ias m ulnms t0tetnxf iy1oa elieo s tetmxo3iy1olte fci t  rrm(r ;t4aeenmoetatfm2ra( snt4 exoifcto1oa raivi t)texm(r nu1amenlnvs ()aDtrxrpou4oet if3tydfaDranmp;u0aeeomo3iodlptr nes s  etmir io4lle lfcsl(  Dtm(  ot1teen ieiydfa uanvont)tleomo3ia1fptrlu o t)t2urxrpiu4altnmnet t)sruauront0oetomiciatla ul( pnt) rtrxo iotlp rlieol()tetrxrpiudlme lieta(  rtmxr ot1opxo f3tls aDrmu pnt4tlermr3tatfm  aivo;( teum(rpoodal nlncta(faDum(rpoo0alxoio3ias s rlu o;t0altrmr3ta1lp   nes t0 eurio3no4lm nlncias aDrmu oou0oexnmfciydfm eauvo;t) exnmrcoytfate nes (  rum(opnu1lme  nes s)aDrm( p;t1alxoioetyd mDumnvsnu0tltnifcoodfpte u ilt0 eur(opny1om  lici tfsrua( poo4olx io3iydlm2emu snu4 exnxrciytop  luvolt tetmxo3ou1alee fvs (  Dtrx p;o1texn oetaslm2emuvo t4alxomr3ty1lpte nei;() rxm(o iu4openlnetls)aDtaumoou0ape  oetyslsDemumo u0 rtoxfcoy1lmDe nei;s srtmir iy4lm nlfet tfsDua(mpnt0teeomicilt s emuvpn(4aexoio3oy1fmDe n slt0 rtoimpoudomtelivs sfa2rrurp;t0ale  ociatlmDrmn p u4treomf oodla   ivi t t2to(rpiudap e nci t) 2uau  ou1tex mociytfm2uan on(0 rtrirctytfm   ieilt)srtmxopio4om n ieta(  2tmu pou4olenmoeiytla ulnms t4aetrmf totlm eaivs;t t2xmim io1om emiesatf Drr(rp;t0opxoifeiasls2ra( o;()tlxnxr oy1oaDelueolt0 eumiopou4llenlfeta( a2ua(  ot4optoifctlslaDrmu pnu)arxnxfctotfpt livslt0s2xoxm iu1lpt mnesas arumxm ot1tpt mfeiat aDumnms u0tlenircoytfpD luvol(  exm(opoy1om  lfes t)s2umxmpno0olenioeiydlm2ulu pn(0 rerxr3iy1fpDr u o s0sexr(r3nu4al  mnetlt s2umx p;o1tex iiciat m rm( s;()aeenio iadoa e uvs t0 rto(m3nu1ol emfviasfsruaxr no0texnmoeiysfmDuanvsn(4aexnif3iytfp elnvils  2tr(mpiy1lpte fct (fsrrr(r ;t0oee mfetysls uaumpnt4aeenio3iytop r ivo;s0 2uo(o3oo4am nlfciasf 2rm(ront4olxo ietatfa2em(vpnu0tltrif iy1fa rauvi;(0tetoxmpiudll  lieslt  2trxr ;o4tpeoifeiad m um(von()tetrif iydfa e ieo s0 rxm(mpoydam nlncs tfsrur(mpnt4aexo o3iasfs2rm(vp;u)texnxf3todfmtr ieo (0trxr(r ou1amee fesatfa2trx p;o4aet mfciydfsDuau o;t0trxnmf ia1lp  aueol() 2xrxr3iydamtnmnei t s2trxr ;o1aetniieiadlm uln p;(0texnxf oatom   nvol( sruo(rpiodlp  lieslt) 2raxm nu1oet mo3iytlaDranvpn(0 eerxr tydoate uvo (  etmxm3no4optnlncsatf Draump;t4apeomfeiadls uanmpnt4 rxrir iodfpt  uvslt s2tmiopnu4am   fvslt)aDurur no0tpe iociys s eanmpn(4tltomfcoy1fa rlivs;s setrio3oo4am  mies s)arraxrpoo0oeeo ictys s2ea(mo;()tltoio oatlm rai s;s)sexrxm3iu1lpt  iei s) Dtru  ot0aet mfeilt m rl( o t4 lxoxf oy1fmtrauei;s  2xr(rpoo4lmtnmivtls) 2rr( pot0opx  f3tytla2ran o (0 reoio3ta1opDran slt0teto(m3oodam   fvias)aDurx ont1ape mfetysfsDrm(vo t4trtnxfcia1opte n o t sexo(m nodlme mivi sfa2rru ooo1opt mfctatlsDemn o t)arxnxrcto1omt  n i s)srto(r3nu4ol eliei tf Drmurp;t4tleomf3iyd a ran s;t)teermr3tydlat  n olt0t2ur(m3nu1omtemfet s  2ra(  ;o4aleo ociyd m2um(mp;u0arerir3oa1fp rln ilt t2toim3oy1omtnlicsas)artrumo;o1olx mf3tad s rl(mp t) etrmo3iy1omteau i s)srtr(o3nu1ape lfeiltfaDrau ono4tex  ieilt mDrlu p;(4 reoxr iotlpDrln slt sruoio iydaptn nctl(  rtaur oo0aexnifeilt m rm( p (0treomocio1oa r iesls0s2xmxopoo4op emncilt sDraump;o4teenmfetlt a2raump;u0tltrxrciadom  lieilt0tetrio3nydapenmneia( a2taumoou4olxnmocildls2uan s (4 lenifctydfpDeauvi ()t2trxopiy4lmtnlics t)s2tau o;t0oexnmfeiadfs2ul(vs u4 rerio oa1faDe iesl() 2tmirpoy1aptemiciat)arua(  ot1oexoiietysfs2ua(mpnt0tlenxr3iodlp  aueols trto(o ou4apt  fesas  2umu  nu0tptn octlsfs2eluvp t4trxnxo oatfpte n i;s s2toxrpny4lmte nvilsf Dum(  ;o4alxomiciydlmDeln p u0arxrxf3oydfpt  n o s)srxmxrpio1lpenlfcs t)aDtmu onu1tpto ieiytfs2el(mo;(4 rtoif3ia1fm eaies t)s2uo(m nydome mnvtls s2ua(rpnu4texnioeiyd m emnmpn(4arxrxr oy1la   ivo;t)setmirpnudap nmfci sfartr(r ;t4tleomietatla ra(mon(4trtoif3oo1lp r nvo t0 2xo(m3iodoptelnvi t a2uaxr ;u1apx  i3tyd s2el( sn(4 reoif io1fptrlu s s  2tr(r iy4ol   icils  rur(ro;t0tet  i3ilsls um(mp (4 etomf iotoatran il(0sexmimpou1ol emictl()arrrx  no4oeen ietlsfs ul(vsnu) lxomociydfaDeanes;( t2toxm iu1lleelfci tfsrtrx o;t0olx  fetydlm umu o;(0 lxrmf3iytfpt luvs t truoxrpoo4om   neslsf rta( oou4opeo ictls s umn pn() lxrxocoydoaDeln s s0seurxo3nydlpt lfci ( s2truro;u0aet  oeilsls2ulu pnt4trenmr totlm  auvo;(0s2umirpiydlpe lnvtl(fartm(ro;t4apto f3iydfm2uluvs t)treoxo iytlptelu i s)trtm(mpoy4ale  fctls) Duaump;t1olenif3iyt s2eluvp ()aeenio ootfp   uei ( t2umim nu4lmee nvt () rtaumooo1openiietyt aDum(vsnu0trtnmo iatopD aues (  exm(o iu4oleemfciat) rrmum ;u0texnmf3iat aDrm(ms t0 etnmfcty1lat au slt t2toxm3io1ll  lncta()aDrrum ;u1oeeoiociltlsDea(von()altomr3iadlpDr i slt) eurxm ny1aptemiesl() 2ur(r nt1oetnif3ilt a2um( o;u)alxnio3ootlp  ln s;( srtrxo3ou1am n fcilt s2rrx pnu1aptoifctldfmDrm(ms (4 etnxr ootfa elieils0srurxo3ou1lmte nctas) 2ra(m oo4tptnmfeiyd aDrm(msn()teermo oadlmtranei;(  rxoio3oo1amtn ivtls)s2ra(rpnu1tle mf3ild m elu s;u) rtnio oatlm rauvo ()seuoio ou1ll elfvil( s2taxmpoo0olto o3ils s ul( sn() rtnmrciydoat au ols0 etoirpoudlpee nctasfs2tmu poo0aeeomoetltfsDumuvp;(4tetnir oydlp eaueolt0 2xm(r3oudom   neiltfarrmu ono4texnmf3ildfm um(vs () lxnxo oy1laD aues ()trto(mpoudoptnmicsat s2rax o;t0oetoif3iyt sDeluvo t) eeoxocoadlmtrlnvo t0t2umxr3iy1al  lnvt s)a2tm( pnt4opxnmietat m rln pn(4teeoio3oydfaDeln o;(0tetoio iy4optn ics ( aDtmxm nu4tpxo fciasfm um(ms ()tlxoir3oo1lpt  ues t0setm(m3oy1oleemict tf 2ra(r ;u1tpx iociltla2rmuvo t0 etoio iytfaDeanvils0 exrir3nudomtelieslt) Dtmumpou1oleo octls a2ran onu)aleomf oodomDeaueo;t)srumxm3nu4open nvil()s2umxmpnt1apx moetatfaDumuvs t4 etrifciatfm eluei (  rxm(o3oo1lp e fvs ()arrr(roou1oleomietydls2rauvp t0 lxrifcoodfa  lnvo s)tetoir oo1ll emnvtltfs2tmu pnu1opeoii3tasls rmumo;u0teenxf3iytlp r nvol()sexr(r iydlmt  nvtas)sDraurpou0oleoiietlslaDulnmsnu4aexoxf3oytoaDrluvi;t)s2trio io1al e ivtasfsDraumont4alxn i3ilslaDuan p;(0teermfciatoa eaueils seurir3iydlleelfcsl( aDtmumonu1aptnmf3tad sDul( p u4trenxfcoo1fmtr ueol() rxr(m io1lmenmivtls artmx onu0ape  iciyd mDuau o u4trenmf ty1lm e nes;(0t2xmimpiy1ll nlfct sfsDrr( o;o1oexoii3tysfmDrmnvsnu)aexrmr iotfaDe ivi;s s2umxr nydlleelivtasfsrua(  oo4aetomieils aDrluvon(0 reoir3totlatelnvo s teuo(m iu1altemivsl() rrmur nu0ole ifeiydlm um(mp (4aexoxocoo1lateai ols srxmxm3ny4ol nmfcsas artrurp;t1alx mo3tat s2rmuvp;t0tltnxr iydlmtelieolt)setoxrpny4ale  ies s a2tm(r ;o0tex  feildfs ea( s t4tetnxr3iotoa r ies s  2urim3iu4ll  lfct ( a2uaxr nt4tltomieiysfm2raump t)altrxrctadopt lnvol()texm(o3oo4lltn fes ()sDtaxm oo4texnmociltfmDrm(ms;()trtnircoy1oaD aueols)t2ur(o oo4al emnvt ( srrrxr no4tpx mfctadls2em(msnu)alenxr3tatop eaueslt) 2umxrpiu1lp n ivsas) Drm(  no4altnio3tydfa2elnmpn()tlxnmf3oatfmt  n i t)t2xoxopiudlmtemfvs t) 2taumpnu1tlx iociadla ranmo;u) exomo iytlp r nvolt0srxr(mpiu1open ivsas srrmxronu1olen i3iasfm2uaump u)aeenio3iadlpDe n s t seur(o3iy1ol n nvta(fsDrmu ono4tltomfeiasfs eau s (0artoif iotfp   i i s  2tm(o iu4lp nliciasfsDra(mo;o1aetomfcilt sDeaumonu0 etnmrctydomtraivi (  rxoxo3oudlptnmfvils  rrmumpoo4apt iieiasfa elu s (4tltniociy1opDeaiei;t0 2trxo3oydaptemfct tfs2uau onu4apeoio3tlt sDua( pnu4aeenxfciydla rln i;t)texrir3ny4aptn fviatf Draumono4opeoifeildfaDul(mp t4alxnif3tatfaDeanvi () 2trir3iy1alenmfvs ()aDtmur ;o0tlxomo3tatla uaumpnu4aetnmo tydoaD li s;(0srumio3no4ome mnvsls) 2rmx o;t0optnmoetys a2ran snu) lerif oydlmDr uvi t0trumimpny1al   ivsls)arum( ooo4oeen iciltfs ean pnt)trxrio3tydopteanvslt0sexr(m3nodolt mfvil(  rtaum ou0olxn oeildfaDrm( s;()tltnxo tatlp r ivs;s) rxrxmpiy4lmte nei ( srtr(ro;u0tle mociltfm2uan snt)teermo iadop rli i t)sexmio3oo1lmt mncsasfsDrau  nu0aexnifeias aDeau s t)aetrxf3oadla   ies;t0t2tmio io1altelnetlsfaDtaxrp;u4tpe  fciyslsDrmnms;t4altnio3ia1omDeai ol( s2tmio nu1om nlnctlt a2rr( oot4tex mf3ils aDem(mo (4artoiocoa1fm eaiei (  2ur(o no1am  mfeiat  2um(  no0oexnifeiys a2rlnvp;t)texnif tadfa elnvi;t0texmxo3ny4ap nmivta()s2tmxm no4oetnioeiysla2rau pn()tltrxo tydoa  anes () exm(m iy1ll emnetas)a2taumooo4teenmoeiatfm emu s;u0alenmf tydoaDrli o s0srtm(o3iy4ap e fci ( srua(rpnu1tlx  ieiltla umuvp u)aetrmf tadfp  aueo s0srumim3ny4lltelieils)sruaum ot4tlx mf3tyslmDrl(mp t)altniocty1fa eln sls truo(m iodal   ivtl() rtr(rooo0tlxomfctasls ran onu4 lermr iydop ran s (0 2tm(rpoy4ameemiesasf 2tmurpnu4tlxo fcilt s uan pn(4arxrircoatfa  au i t  2xo(o3oodap   netat)a2ua(  nt1tpeo ietat m ranmp u4artoxr3ty1fatr nvslt)sexrxrpiodal   iet t)arum(r ou4aexoifciaslaDulu snu0aeermf3iodlpt  nvo t)tetr(o iy1al nliei ()aDur(  ot1ale  o3iltlm em(vp t) reoirciadoatrli s s) rxr(r3io4olee fvs (  2ua(ro;o4olxomo3tldfa el(mpnu4trxnmrcto1oatraueo;t trxr(m3no4alen fesas) Drr(r ou1tlen ictad a2ra( sn(4altrif3ty1fmDeaieil() ruoio3ou1lltelnctl(fs2uax o;o1tptnmfctld mDuau o;t4 rxnmo tytlmDeli o;t srtrimpiodlp elncil(fsDrrump;t0ape mieiat a2uluvp;t4 leoif iytlmtelu o;(0srur(rpoy1lpeemici tf Dumu  ;u4opeoio3ildlm2raumont)trermrctydlp eliei t0setoio iudlpe lictatfa2rr( ont4teeo o3tltlsDrmn sn() rtnioctytfpt li o;t0trxm(rpiydaltnlnci s)aDra(mpno1oeenifcildlsDuln o;t)trxomrcoa1fa  an o (0teurio io4lmtn nes sf Dtrxrpoo4tetomf3tls m2rl(mp;()arxrxrcoodlpDe ueilt0srxmxopnu1lp  miesat)sDta( poo1olen oeiydlsDrln s;(4trenifcoo1lateluvi;( setmxm no1oltn ncsl( aDurxmo;u1aetnmoetasfs2uluvo;t)teenmo oa1fmtrau o t srxmxo3oy4amt mfet ( aDtaumpot4tptn oeils mDumuvs;t4 lxoxf ia1opD  ies;t  2trim ou1ll  mieil()arrrur no4aexn ietatfmDrl(mo;t0 reomo oydlp  au s ( srtrir3no1llte ieiltf rumxrp;o0tee mfcils a2rlnmo (0trxnif tatop   uei t teto(o3oy1ll   nei () Duaurono0optoif3tydfa2ulu o;t4 eeoifctodlm r uvol(0s2tm(rpou1om n icsl(f 2ra(r ;t4tpxnmf3tld a uan o;t4 ltnio oo1oate n s s0 2tr(r oy1om eliei tf Dtr(rono4alt iieiltfs2ea( snu)teerio oo1op rauvs;()trxoim3iodll   fvsls)arumurono0oetoio3iltfaDul(mp (4 exrxr3tytfmt  ivo ( t2toimpoy1lmtnmfcs s)arra(rpoo1olxo octytfa2um( onu)tltoio3oa1faDe neo;()s2xoxo nudal e ictlt s2ta(r ot0olt mictydla2elnmp;(4areomr iodfmDelu s;s) exoxmpoo1ope mietlt) 2raumo;t0tet  o3tytlsDumuvsn(4trxrir3tydfa e ieils0srtm(opoudoptemivsas) 2uaumoou0apxomietat a2rl(vs t0trenxfciotlp e ueil(0 2tr(rpnudapt mnesl( s2ua(ro;u4aex  iciysfmDelu o u) lxrir3io1optrlies;s sexmirpiy4open nctlt sDtrxmono0aeto o3tyslm2um(vo u)tlxrxfctodoa  luvols0s2xrirpoo4ame lnvs s a2uax  ou1apt mfetasfmDrmuvo t) leoxr3oytlp eaneol(0 rurim3ou4lm n nci t sDururonu4oleoiicilsls2ul( o;u0 exnmo3iytfmDr ueo ()s2tmir ny4amte ncia()srtmurp;u1apeo o3tltfmDrlu onu0trtrxo3oo1la  an sls0t2umio3oy1omeemnesl() 2taump;u1aexomf3tadlm uauvsnt0aleoxo3oodopD  ivi (0setoxmpou1lm  lieiasfsrua(  ;t0tpx ioctadls2ulumon(4arerxfcia1opD lnesl( s2toxm ny1alt lfctasfs2ta(mo;o4openiociydla2rmn p t)tlenmoctodoptrlieo;(0 exmxm3oodale lfvtlt arrr(r ;u1olxo oeils m2emnmp t0alxrxo3iytoa eaivo;s) etmimpiu4lmt mfvilsfsrra(  nt4tlx  ietadlaDumumsnu4tlermr tadlm  aies;s0 rxoxr3iu4llenlnesls)srurxrpoo4aeeo iciydlmDelnmo u0alxomo3to1fp rlivsl(0t2xoimpiu4opeemnci ()sDrrxmonu1ale mo3tydfmDranmo (4tltnio oytopDraues t trtoimpiydop  mfvs s  2ur(mp;o0oeenmocildfaDumnmon(4alxnmr3todoaD aiei;s0srxr(r iu4apeemfctas srrrxrpou4oeeo octlt mDeanms;u0aetrmocoadlatrauvils)srxo(o3nydopeelnctat  2uaumont4alxnmoetlt sDelnmp u)alerxr oo1lp rlnvsl(0s2xrxm ny1lpt  ivilt  rua(r oo1tpto f3iltlmDelnvo (0tetomr tydlmDeanvi s0 rxr(r iy1lp emietl(  rrax  ;t0tee mfcildfa2umu p;t4trxrio3oo1lm eln i t)tetr(m3iy4ameelnvta()sDrr(mp;u4aleoiocilsla emnms t0aexnxr io1laDeli s (0trumxm3nydol nmncsa() Drm(r ;o0alt mfcias aDuaums;t0 eeomr3oo1fat luei ( srxr(r3iu4om  mictatfsDtaur ;o4tlto feilslaDrl( p (0arermf iodoa   nvs;t  rxo(m3no1olt mict (  Dtauront0tlt mi3iadfm rl(vs t)trxrxo3oytomt an s;t0teum(rpiy1am nlneslt) rrau pno1texoioctldlm2rlumont)trxomoctadoaD lnvo;(0srtoim iu1lmee fcta( arur(ronu1aexnmocilsla ua(mon(4 rxnif3iatlm  aneo;(0 rtm(m3nu1amtnlnvil(f Drrxront1tptomfeildls2ea( snt) ltrmfciatopDe u ol() eum(rpno1optemiviltf rtax o;t1alt  ictat a rmn p;t4 eeoxo oydomD livsl()teumxm3oo4lme lnes s s2ua(m ;t1aet if3iltlaDrmumo;(0tlxrmf iydoa raiei t0 2ur(r3oudam nlictl()sruax oot0oltniietltls ulumo t)tlxnxf tadoa rli i;(0trum(mpnodlmtnlnvtl( srumxm ;o1tpx  iciys a2rl( s t4texnxrctytlaD aneo;s)s2toxopoudal  mfcia(fsDurxmpno1tlx ii3iasfs2rluvpnu)tltrxf totfa r n s s0 rum(opiu4ole  ieia()a2rmu  nt0openmf3iltfa uluvp;()aexnxo totlmD aieil(0s2xoimpou1ol  mnes s srrrumpno1tetnmf3ildfm ua(mo ()aexnmfctadfm r ies;s srtmio iydal nlivtas s2ua(rpoo0tlt  oetasla eln pn(4 eerif3oadlp elivi;( trtmir io4ome lfvslsf 2rmurpou4tptnmfeiat a2emumo;(4tetomo3to1oat aieols trurim3io1lmtnlncias  rtm(r ;u0oee ifciysls2elnvpn(4tleoxfcto1fptrluei;s setoxr iodapenmfcsltfaDrmum no0aexo oeiat m2rauvp;t0 eenmr3tydoateanes;() rxoxm nu4al  miei t)srum(r no4alt  oeiysfsDumn s;t0alerircoatop eaueo;s teur(opou4lm emictlsfa2tmu onu1teenmo3tldlaDelump t4aeerxocoadopDeauvo s)sruoio3no1am e feias)srururpoo4oexn octasfm2uaums;u0 rxrir3oadfp   i o;t srtoir3ny4amenmictlsfsrtaurpou0aee mfeild a2rmn ont4alermo todlpD liei;s0 rtr(m3iy4am elieiltfa2rmxro;u1oexomieiyt mDran s t0trtnif3oydfa r nvo;()teur(o iudll emneia(  Dum( o;o4optnmo3ild s2rlumo t0 rtrif tatop  au sls0srtoxm iodop nlnviltfarrmx poo0aptn ieildfa2ulump u0 ltomo3ty1lateaivil(  etoir3iy1ale liesas arrrurpou0alxo ieils m2ulums () rxoxf tatoa r neilt)teurim3oydapeemfviatfarrmuro;t4tpxnifciaslaDelnvo t0aexoxr3oytlp eanes t)s2xrio3nudop   ici sf 2trumo;o4aee  iciys s uau pn() exnxr3oadopD lu slt) eurxo ou1llt lncils)sDrmumo;t4olxnmfctytfa2rlu s t4arxrif3oa1fatrlivs;s0trtr(m no4lp  lnetl( sDumx ooo4oltnifetls a2eluvsnt0 exomo3oa1oatr i ol() rtmiopny1lmeemietltfsDur( pou0tlt  oeiytfm2rlump;u) ltriocoatoateluvs;t) etoxm3iydomtn icsa()s2rrxmooo4tpxnmo3tas s elu s t4 lxrmoctydfa e iei t0t2xmim3no4ome lfeta(fartrxrpnu4texoifciat a emnvp;t0tlxnxf totlm e u i ()s2uo(r3no1optemici tf rum(r nt1oltniiciatlaDemnms u0 rtomrciodlmD  ieo;s)trtr(opoo1altnmfesasfarrm( o;u0aeeo octysfmDraumsn(0trtnio3io1fatelivo t0t2xoxr3ny1ol e fet tfsDtau onu1tpx mfciasla rln o;t0trtnxfciatlpt auvil(0t2um(opiu4oltemicta(f rrr(  nt1aetn feiaslmDulu p;()teeomrcoydop r ies;(0 rtoxo oo4optelfcilsf 2rm(rpou4tex  i3ild m2eaumont4artnxf tatlmt  ueols  etmim iydlp nlieiatfaDrmum ;u0tlxomi3iadfm2uaums;t) etrifctytfpDelnvo s) 2ur(rpoodame  nvsasf Draxroou0tpeomieildfsDra( sn(4alxnmrcoy1oat auvols)t2urim iu1oleelncil() 2umxrp;o1opeo ocils aDem(msnt0 eenif3iodlmte n il()s2umxo oy1ape lnctl(fa2ururoot1oexomoeildfa ua(vp t) leomo totlm rlueo t)tetoiopio4lle  feil( srua(ront1oeeoio3tadls2ulnvs;t0alxnxrcoodla rlnvs t0 2tr(o ny4omtnlnvias) rtr(ront0opeomicildla rmnvsnt)alenxr3oy1la e n i t  2triopoydlmtnmivsl() 2tax  nt4apenmictltla umnvsnu4alerir3iadlp eln ols t2ur(r ou4lmt mnvs t a2ua(r ;o1opxoifeiytfaDul(ms t0 lxrmrctytfaD lnvi t texo(opiu1apt lfet (farrr(r nt4tetnio3ils m rlu pn() rtoif3tytoaD  neo t  rtmir3iu4lmeemfvta()s2rmxm ;t4opxomo3iatls2umnvsnt0 reoif oatoptran i;(0setm(r nu1olte fei s aDtaump;t0olto icils m uanvp () exrmocia1fpDeaivils0 ruo(m iu1ll   ietas)srtr(roou4olxn o3iydlsDran o ()tltomo iydomte uvs;(0texmxrpiydapenmnciatf rtaur ou4oexo ieiytla ranvs;u4 eenmr tydlmt  ies;t0trumio nydopee fcs sfartau pou1tpxoiiciytfm2em(mo u4trxnxrciotfa r ies s s2xoxm ny1omenlfct ( s2urxm ;u4aex io3iytlaDul( on()alxomo oa1fmtrlieilt)setrio ou1lpeemfci () rtau o;u4oetnifetyt a ea(vp (0 lxnifctodlptraivsl() rto(o io4olte ivslt)sDrmxmpot0alx  feiadlm2ea(mont) eenmr iadlmt lnvo;s0 rurxm oy4altelnvs s  2tmx ooo1olenio3iadlsDumnvsnt0tlxrirctytfateliesl(0trxmxm3no4om nmneiatfsDtrum nt1aexoifctytfaDum( s u)altriocoytfate ies;s0 2xo(m3iy4optemivt ()a2rm(m nu4texomociltlaDrm(vont0trxnmr ta1fat  nvils0srtr(mpiu4op emncsasfartmurp;t0oeeo feiasfm2elnvonu0texoxfcoo1faDr n o t t2um(rpiy4lpt  neia(fsrrmu ooo1alxnii3iad s2ra(mo u4 rtoxf3tydlmDrlues;s0t2urir3io1apeelfvtls a2rmurpnu1tpt if3tasfa em( s;(4aetoxoctytoaDe ieolt0 etr(o ou4lp  licsa()arrmxront4olxo iciyd mDumuvo t) ltoxr3oatlp e n i;(0sexrim3iydal  mnetlsf rrmx o;t4oltomieiyd s2uln s ()arenir to1lpt  nvo t0srtmirpnu1ale mfvsasfarta(mp;o0alxoioeils sDea( p;()tlxnmr oo1op  lneslt0sexoim io4altnlivta(fa2rmx pnu4aeeoif3ildla2el( o;u4alxrxo oydlm eanvs s)tetoirpou4omt mfcs t)aDurur ;u0apenmoetld m eau o;(0 rerxf3oadlptelivilt0 2xoim3nydome miviat)aDurump;u4olt  ociltfm2rl( p;u0texoxf iy1oat aueol( sruoxo3iu4lm n fcia() Dumx p;u1tpeoifciytlmDuanvs u4tetnif3totop r n i s0s2umxm3io4ame mfciat arraum oo0oetnmfctldfmDrm(mo;() rermo3io1lmDr ieslt)s2xr(o3iydalt lietl( sruaxrpou1alxoioetydls2rm(mp;() lxriocia1fmt  u o;t0t2xmxm ou4amt  nvtas s2um(ro;o1alenmiciatfsDel(mp (0 etrxf ty1lptrau s s0s2umxr iodol elfeiatfsrtmxm ;t0tltnmocias sDeluvo;(4trxrxf3iotlateli s;t0sruo(rpiydapt mivtatfaDua(monu4tlxo ieiys m eanvo;(0tlxoxf iadfa rai s s0trumiopiodapenmnesls)arrm(r ;o4olx if3iatlsDuaumo;(4alxrmr tatfmDrln i;t) rxm(rpno4om  lnvt tf 2trur no1tlen feiasfs ra(mo;t0teeoxo3oa1op  ln ols) euoxm ou1optnlfcil(fartrx p;o0ape moeiad a rl(vsn(0altoxo iotfa r ieolt) rtm(mpoy1ol nlncs s) rur( pnt1opx  f3ild m2rl(mpn(4 ltnif totopDelivol()truoim3ou4lmt mfvtatf 2raxr ou4alxoii3iat m2eanms (4trxrxfcootlatraies s)srur(opiu4lpt lfcia() 2um( pot0olx ii3iat mDrmumo (0alxnif io1optraneols0setmir nu1om elietat) 2rrumo;t1openmoeiyt aDulu p;u0aeenmf ty1fa  lnvilt) 2tr(m3oudap n ieia(  ruaxmoou1aeeoioetld a2ranvo u4 lxrxr3iytoa rluvo;s0sexoxo iy1apeelfesa() 2ua(  nt1tle ifetldfs2ulu pn(0tlxrxf3ta1fpD aueils s2xm(mpoodolt mfeilsfa2ua( ono4aexn iciatlsDelnvont0artnif oa1oatrluvs s)trtmxm3oudaltemicias arumump;o0tpxoio3iys a2raums u4 lxomocoatlmDelnes () euo(opiy4lpenlnvi (fs2tmxmonu0apenmoeildfmDuanmon() rtnxr3todop rlieol(  rtoxopoy1op e fvi ( aDrmxm ;u0oltnmfeiltlaDumumsn(0treoir3oy1oa   uvsls0 rtrxo3ny1omeemnesas aDtmu  nt0tlenmieiydla ua( p;t0alerirciy1oate nvi t0teumxm3ny4amenmncsa(  Dtaxr ot4altniictas mDean p;u4aetnirciadla  luesls s2tmir ny4llt  ivtl( a2taxmo;u0ole  oetls s em(vs t4teenif3iatomDeln ols0s2xrio iu4lm  mfvsa(fs2ur(r ;u4tpenmo3ildlm2emn pnt0 eeoio3todopD  uvi;s) rxmim3oy1ale lnvi t) ruru  ;t0apxnio3iasfa eanvp;t0aexnio3ia1fpteau sl( trum(m iy4omen ieil( aDur(r ;o4tlx  ocils mDrauvp;u) lxnxr oadfp r uvi;() 2xrxmpno1lle lfci () Dtrur no1aleniocilsla eanvo;u4 reoxr tatop  aivo s)tetrir3iy4ole lnvslt  Dua(mp;u1oeen feiytla emn sn(0 rtoir3tadfm  lnvo;(  2tmxm3iy4lm n fctatf 2uaurooo4tlt ii3iyd sDel(ms t0 exrxo iotlm rlneo t) euo(o3oodoleemivs s  rtru  no1aptnmfeiatfaDuau p;t) renxfciy1faDeaivsl(0 rurio3iu4altnmnvtl()a2taxmpou1olenmi3ils m2rmn s;t)alenio3iatomDeaivs s0 rtoxmpoodolte fcsat) 2tax  nu0teen octltfm2rlumo;u)trenmf3oadop r uvs;t0teur(rpiu4lleelfcta(fa2rrumpnu0tpx moeilsla ran s u4trxnif3oodlateaneo t0 rxr(m oo1olt lics (fa2um(m nt1oeeoio3iysla emnvs t0texrxr3iatlm r n s;(0 rumio iu1lmeemfci t  rtaxr ou1tleoio3tad m2rluvsnu4 etnxrcoadfpDr nesl()t2xo(m3iu1lmenlfcil()aDum(rpnu4ale iiciasfm2ranvs;u0aetrifctytfa  an ols0s2toxopoodom e ncsas) rtm(mp;t4optoiictatfm2em( pn()arxoif3iy1lpD  nvi;s srtmxo3no4lpenmfetl() 2rr(r no1opxoioctasls2elnvs t0altoxr3ta1fatelnvols)seur(opiy1opt mnesls  rumxmpoo0apxnmfeiys s emnvs;t) lermo3iydlmD li i (  exoxm3no1lm emiei (fsDtr(m ;u4apxnmoeildfa uauvp;u0 ltnirctytlm elu s s trtmxm ny1omt mnci s  Dumx ono4aleoioctad mDum(vpnu0tlxoxoctotfaDe uvols  2xoxm3ou1lle lfeias) Drmu pnt1aptn ieils a2umnvs u0teermrctotlaDeluvo (0t2xm(mpiy1ome mnvi s arumx p;u1olxoioetasls ulnmo u4tlxrxf3io1lmtr uesls setmir iu4op elnctatfa2raurpnu4oleo oeiaslmDrau onu0trtnif ia1latrliei s0s2tmxm3io4op n ivs s  ruaumpno0tlt  o3ildfm ua(vp;t0tlxrmr ta1opte neil(0 2toimpiu4lme lncil( sDtaurpou1opxo f3iys m2rmn p;u4alxoiociodlmDrai i (0 euo(opnodamteliviat  rtmu pot1olto i3iysfm um(vpn(0 etnio3oatfpt aieo ()srum(o3nydolenmnet ()a2urxrpot0alx iieiat s2rluvs;(4trtomfcio1om e uvslt)srxrxm3nudope  icsl() Dra(ronu0aptnioctatfmDuanvo u)aleoxr ty1lpte neilt0 2xm(o3iydapenlies (  Draurpou0altn f3iatfsDeluvs;u0aexomr3ia1fpDe ivs;(0 rtmir nu4omenmieils) 2uaur nu0opxn i3tlsls2uau pnu)tltrircta1lm e ivslt) rumxrpnydom nlietas  rua(mpou0opeo fetadfa2rlnvo () exoxocoa1fpDr ueo ( s2tmirpoo1lm emnei s aDta(mpnu0tltoio3tld s ul(mo;t0texomfcto1lm rlies (0 eurim ny4alee nvtltfsruau  ;o1apx  feiasfa2ea( s;u0tlxoxfcoydoateanvo t s2um(mpoy4lmt lietat)srua( p;u4opeo i3iyt a2rl( p;(0 rerxfcty1fpDr uvi;( t2trio ny1lmtnmivt ( a2tru o;t4alxn i3iydls elump u4arenmoctatlp   ivols0t2xoiopny1ap e ncia(fa2ur(  ot4tlx iietytfa ul( pn()arxrif3io1oatraivo t  rxm(r ny4ll   nesl()sDrm(roou0tetnio3tltla2emn o;(4artrir3ta1laDrlneil()srxmir3oy1ole mfvi s  rrmur no0aptomfeils m2rmuvo ()altomr3oo1lpt auvil(0texo(m iudoleelnvtltf rrmum ;o0alx  ociat mDelu ont0tltoircoadlptr i o t  2tmxr oodolte ivi sfarrm(  ou0tlto fciys aDul(vsnu0arenxr3oy1oat li sl() 2xriopoo1ope  ictat)sDrax pnt0tpxn oetldfmDul(vs;t0texnmoctytlp e ueols s2uo(m nu1alen nctlt)s2ururpot0tpt  f3ils s2em(vp (0 rxomf3iydfaD aivs ( t2uoim nodomtnmfcslt sDtaxmp;t4tptoio3ias mDrmnvs t)tlenxr oo1lm raivs t0 eur(opio4amtnmfvsasf rum(mpnu4texn oetytla2em(mpnt)tlerxf iadlpDeli sl( trtrirpno1amte fci ( aDtru  ;u0openmi3tydlmDeaumpn(4texnxocoytopDr ues;() rurir oudoltelfctas)a2rm(r oo4texnmieiltfa umnvo;()tltnmf totomteau i s  exoxo3oydlltelfeil()sDumumpnt4tpen ictldfaDrmuvon(4 rtrmf ty1op ean o s0s2to(r iy4lme lncs sfa2tmx  nt1apt mf3ilt sDrmuvp;t4 etrxociodoptrauesl()truoio io4lp  mietlsf rum(mooo4aeenifeiydls rmn sn(0tlxrmr3iydlpDelu o (  2trxo iu1lpt mncslsfsDraxro;o0oeeo o3ilsfsDrmn onu)aleomr3iadlm  aieil(0seuo(mpnydopee feiat) 2ta(mo;o4tpenifctydlm2rln s;(4texnxo3oa1fm e nvi s) etmiopoudamtnmfcslsf Dtax pnt0tex if3ias m rauvs u0aeermf io1fp  luvil(  2ur(m io1ape lfvtat)aDum(mo;u1tpe  o3ilsfa2rlu ont)artnxfcoydlp r ivilt)s2xrio oudal emieslt)s2rr(mpno1aet  ictadla ra(mp u)arenif ia1fptr uvi () etoio ny1lpte ieiat  Dtm(m oo1tleo oetlt m2emn o;u4 rxrmo totfmtrluvs;s0setrir iudopenmfeslt s2urxrpnu4tpenifeild sDrmuvo u)aetoir3oydfpteauvol()t2umio iu1omtemfetat srumxr ;u0alenmi3iatlaDra(mp u4arermrciadfat  ivslt0 rxoxm iu4olenmiciat a2ta(rooo1teeomo3iydfsDemnvsnu0 ltnmrciytoaDrli s ()trtrxrpou4ll elictls)srtr(mpno0alt mfctaslm uanvsn(0 etniocia1fpDrlivo (0 rxriopoydlpe  nesasfsrrmxro;o1tex ii3iatfm2ean pnu0 eenxf to1oa r ueil(0trumimpiu1om   iviltfsDtauroot4opeo f3iys s elnvp u) lxrxo3tytopDelnesls0srtmim3oy4lle lfciatfaDumu p;o0ale if3iyd a2uauvont0altnmf3to1lmDranvi s0texm(r3oodol n icias) 2raxm ou0oex mi3tlslmDean p;t4 rxrmo iytfm eln sls)sruoim3oo1amtelfesasfarrmur no1aex iieiltfs2um(vs u)texnxr3iy1lmtelnvo t)trto(opnodlmtemnvt s  rrru ont4alx ii3iasfs2uanvo;() rerxrctydfmD li ol(0trxrir3nu1llt livtl(faDtmxr ;u1oleoifetyd a2rlu p t)aeermr tydlp  an s t)srtmxo ny4open fvils a2ra( o;o1aptnio3ils m2umu p;(4tltrmocta1optranei;s texmir nodamtn feil( aDtrxroot4tptomociytls2umnvo u)arxrmf3oadoat lues;s)s2xo(r3ny1alt miei tf 2tmx ooo1opeo i3ild s eau ont0 lxoxf3tadlm eaieo;s t2tmxm3oo1lpt lnvs t) Dtr(mp;o4alxomf3iys a emnms (0treoir iatlate nvi s trtoxr3io1olt  net (fsDtrxronu1teen f3taslaDrm(mo;t0texnxo3ty1la e i s t trum(o io4lp nlicia(  rrmur ;t4opx  feild sDrlnmp;t) eenxo3to1lptr nvils)t2urir3ny4omtelict (f rtmx poo1oeeo i3iytfaDeln s u0 ltoir oytfmteanvo;( trumir ou1lpte nvil(f Dtm(m ;t4oeen f3iadlm2rm(mpn(0tleomo3iodomDrlivslt0 rxo(mpoy1altelicsat  rraxm ;u0opeoii3iytlaDumuvp u)arxrxo3oo1latrli ils)s2trxr3nydame lfcilsfa2taum ot4apxo feiytfm rl(mo;u)arenmocty1lptraneo t)teumirpiy4ll nlfctas a2rrur nt0texoiiciatfa emnvsnu)tlxriocia1oaDeln i (0t2uoxr io1lltn iet s) Dumu ono1aptnifeiys sDumu o;(0 lxoiocoodop r iei t  rxm(o oudlpt mivs () rtmu  no4teen ociys mDuluvo t) eeoxf oatfmDrai o s0 2umxm3iydomee nvt s artax  ;t0tleomf3tytfaDumump;t)texoif oytom e i o;s0truo(mpny4altnmivsas)a2umu pnt0tlx  i3tat mDra(msnu0tlxoirciodlptrlivsls  2trxr3iodap n ncilt)arraxmo;u4oetnmicild mDuan p;(4artoiocoo1oaDe i o t)trxrirpiy1opt  netat  2ua(  ;u4tpenmo3iaslm um(vp (0arxoxfcoo1lpte nvolt s2xoirpiu4altemneiatfsDrmu  nt1alt mi3iytlaDumumsnu) etoif3tytom rln ol()teumxm3ny1al  liei s arta( pnu0aleoii3tydfsDrauvo;u)arxrmo oo1fateln ils tetrxm3oy1lmen nvilt srurx  ou0altomo3tytfm2ea(vp (0 leoir tydfmD li ils  rur(r iu1olte ivia( srrrx onu0apto oeiltfs2ul(vp;(0 lerxf todfpt lues s0 eumxo3nu4lleemies t srtau  ot4tee ii3ildfs2umuvsn(4tlxrifciotoat li o t)trxoxmpiy1om nlncsatf rtrxmoou0ape if3iadlm uln s u4 renio iadfmt  u s ( texoxo iu1lm emnct ()aDtr(ronu0tpx  f3ilslm2uanmsnu4treoir ootomD  ieo t)sruoir3oy4lmeelivtls aDumu  nu1ole ii3ilsfa uln pnu) etrxf3iy1lm rluvi;s)t2xoiopio1lpt lnvi sfsrur(rp;u0teeomiciyd mDra(vp;(0alermoctodfateauvs;s s2uoxr3ou4ll emiei tfsDtmxmooo4aetn i3iltfsDea(mo;u0altoirctatfat aies;t0tetm(rpoo1am  lfeta(fsDraumono4tlx mi3iasfa ul(mp;(4artoif3iy1lm rauvsls0 2triopnydap  mfvt tfarumx  oo0aetomieiytfaDel(mo;u) eenmr oydlm eluvol(0 rxmxopnydlme livilsfsDrru onu4oexo f3iasfs2ea(vpnt4texnxrciatlmD ln ilt0s2xoxr oo4lm nlnvias sDua( oot1tpxnmi3iytfsDel(mp ()alerxo iotopt anvo;( s2toiopou4opt  fes s  2uau ont4optnmi3iytlsDrmu p t0 rtrmfcia1fat lnes t0trtmxopno1llee ncias)aDtaxront1aeeo oetyslaDul(mpnu4 lxoiocoadlpDelu o t0t2uoxo3nu1ap  miesa(  rrr(mooo4tptniictys s2rl(vo;(0trxrmf oodlaDrauvilt0texrxm3iodom nlfvsa( sruaump;t0aexnmo3iad m2umnvo u)aeenif3ty1faDe nvo;()setmxmpoy1ope mnet () Dtm(rpno1apxomo3iysls2ul(vonu0 exoir3totlmte ieols)texm(m3no1llt  fvtl(  Dum(mp;o1opxnmoetytfs2uan s u) eerifctodoaDelnes t) 2uoxo nodlpenmnetas  Dtmxrpnt0tpxn feiydla2rau o;t) rtoir3oatlat lnvo s  rur(o oodamt mfes ( srur(  nt0tlenmf3tyd sDulnvp u)alxnmo3oodoaDr ivslt)t2xo(opiydoltelncsl( sDraxrp;u4ole iiciltls2rmn onu)arxnmr oadlpt  ues;t)seumio3iu1apeelncsa()srum(r no1tpeo oetasfm um( p t0arenifciatfaD  u s;t0s2umir3iu4opeemfesa(fsrurx poo4aexnioeiatfm emnvsn()aexnio3io1lat lneols0tetmio nudam e fei (faDra(mp;t0tltnmieiyd sDrmnvsnt0aeerir totlmt  nvo s texrxrpno4oltelics sfsDra(rono1optn octaslm2ranvsnu0 leoir3totla eaivo;t0 rxo(rpiodlpen icilt  2um(moot1oeen i3tad aDeauvonu4trenxr3oy1fmDe uvil() exr(o oy1lmen nciltfarurxrono1tee  oeiyslm uauvo t0 ltrifctodlmt anvilt0trtoio3nu1ope mict tfs2rmur nt4opt  ieildfs uaump u0teeoircoo1lateli il(0s2xoim3io1llenlicslt a2rmu pno0oex mi3iatlsDran on(0 leoxf3todlpDrlnei s) rumxo no4ope lnetas)s2rm(mp;o0optomi3ilsfa umnvs;(0 ltomf iatlaD ln ol()trxm(opiy4lme  fvs sfaDtaxrooo1tlt  ociat m rm(mo;() leoiocoydla  au s;( trurimpou1lptnlnvtl( a2rau o;t1tet ifciydlm2rauvs;u0 exrmr3io1lpDelnvs s)sruo(m iydal nlfcs s) Dtaxronu1oltnio3tls aDrmu s (4aetrifcoo1om eli s () etr(opoudap  lncsas aDurur ;u1altn ieiltls2ranms;t0alxnmr3tydfa  luei;t sexo(m3nydop emies tfartrxm nt0apt io3iydfs2raumonu0artnmo oatomDr u o s  2xmxmpny1ope miesasf 2rmxmpnu0alt  f3iasla rlnms;u0tltnio iy1omD livil( trtrir ou4llen ncsa()a2ururpnu0alto oeiysfs ul(mo u0aeermf3oy1om raieolt0 exr(opou4lmt mneiat)sDum( pnu4aet if3iad mDea( snu0aetnmf3ia1lm r u s t) 2xrxo3oo4lmt  fetas aruru pno0tptoiocilsls2umuvo;(4aetrxo tydop e uvolt  eumxm nu4apt mneilt)srumxmoou0aeen ociytlaDeanmsn()tlxnir tytopDelueils)texr(r3no1ol  lnvt (fsDurxmpno0apt mfetasls elnmp t) rtnmocoy1faD ln o;t texmirpnu1lltnlnctls srta( ont4oexo fetat m2ua(vp u4 lerxrciydfpteauesl(0s2xmio ou1lpe lfeta()a2rmx  nt0teenif3iyslsDumn onu) eermo3tatomte ies;(0 euoxo ny1oltelfesls  Drrxrp;t0aptnmf3iytfm2umnmo t4 rxrmocio1op rlnvo s) rxoxopny4lm elivil()aDuaurpoo0teenmfeias s rl( o u) ltoxo oy1fpDeanvs;() exmiopiu1amtnmict ()aDra(  ;o1apx ioeiytfm2ean pn(4trxoxr3ootlpD  nvi (0 rtrir no1ol elfcta(fa2tr(  ;u4oexnmfetlsfs ua( snt)artrio oa1op e n sl( srur(m3nu1ll emnct sfa2tru ont0oee mi3tlt a2uanvs ()artrif3oydoptr nvil(0 etr(mpoy4llee iet ( srurx pnu0aee mociysla ra(vp;t) eenmf3oadlmDr ivols) rxrxopny4lle  icsat)s2taxmpou1tlxo feiltfsDum(msnu4 eenmrctydlaDrluei t)t2xrimpiu4oltnlfcsas) 2uaxrp;u4tpxnmo3tld mDrlnmpnt4 rxnmoctadlp rlnvo ( tetoio3nodlpe mict ( a2umxrpno1olt mieiydlm emn onu4altnmrcta1lmDrai o;s0srto(o oo4omtemivtat)sDtrurpno4tleo fetasla2rmuvsnt4areomrciatlmteaivsls0 eurimpoodapenmfvil() Dra(rp;u0texo octlsls2el( sn(4aexoifcta1lmD  ueils s2umxopiy1al nlics () Drr(r oo0tptoifeiasfmDul(vs;u4aexnir3tydfpt  ueo;s)trtoirpny4alt livtasf 2rau pou4tltnmictydfm ulnmpn()treoxrcoytom e ues;( setriopnu1lp e fvtl() Drmump;u0openiieiydlm2ulnvont4arxoifcoadop  lnvo (0seuoimpio4lmtelnvilt sDua(r ;o0apxn fciltla el(vs u)tltoxoctatlp  aies;t tetmirpiodam  lfei tfs2uru  no0tpe  fciadlsDelnms;u0tltoifcootoa   i i t) rxrimpoo1lp  lfetatf Drrumo;t4oeeomi3ilslm ul( o;u)aeerxrcoa1fatrlnes t0 2tmio3oudolte icsls  Dtau  nt0ale if3ilt mDeln o t4tetomo io1lmtraivs;(  rxriopnu1ll elnvsatfa2tmumont4alt mo3tadfa2eanmo;u0arxoxrcoadom  lieols0trum(o oydoleemnctat) 2rr(rpno4ope mictat s rlums;u)altrxf tadlatranei;t0texmxm3iu1lm emfvslsfaDua( p;o4tltoiiciys m ea( o (0tetnmfctotla elieil(0 2xrimpio1ll  miesas  Dum(r ou1tleomieiatlaDra(mpnt0trerirctydoat  u i t trumir oy4altelieias  rtauro;o0tlto ieiyd sDrmnvpn(4 eeomf3ta1lpDe u o ( seuo(o ny1apenmfeslsfsDurumo;o1aexomietat a umuvpnu) rtnio ty1om rluvs;( srtm(m3nudap e fvslsf Dtmump;u4aeto o3tydla2rm( s t0 rerxf3tatopt ai s;s  rurir3iy1apt miet (farua(roou0alx miciydfs rln o t4trtomr oydoa eaivo (0s2uoxopno1ol  mivtl(fsrta(ro;u4tetomieiytls rmnmpnt0aexoxoctadomDrlnvi t0teum(o iy1openlfcil(faDurum no1opx ioctysfs2rau o;u4alxnif tytlmteaivi;s0 2uoxr3ny4ameelfes t)a2ur(mpoo0oetn f3iatfaDrlu snt4altrif3ta1faDeli s t  2xriopou1ol e nesl() 2ur(m nu1oetniicilt a rmuvp t)trtoxocoo1laDe nvolt t2xoirpnudllenmfvsas srrrx pnt1alenmfetytlmDrmu o;(4 exnxr3iodlmDranvs;s t2tmxm no4apteliesas srtrumont1aet  oeildfmDuanvs u4treomociodfp rlnvils0 eto(mpny1apee nvi s s2tau pou1oeto oetytlm eluvp;u4arxomfctodfmDran olt t2umxrpiudlp e nvsa(f rrrx ono0tetn feiydlm2rlnvp u0trtoif3iytfm r ueolt0s2uoxmpny1lp  lnesa( srtr(  nt4apt  f3iytfs2umnmo u)trtoxr iodla eluei s  eum(r nydlltemnctls  2ra(  ot0alenif3iydfs2emump;t4arenxo3tydoatelnvo;s)t2xr(m3iodllenlivsas srtaumpou4aeen fctys m elnmont) rtomr3oy1fa  ln i;()srtr(o3oy1ol nlivs sfsrrau p;u0oetnio3tltls uanmp t)tetrxf3iy1fmteluvils0srtr(o3iodol emfetltfaDrrxrp;t1tltoioetatfaDul(mp;u0trerxf3ta1fat  iei t) rxrio nydomt  fvt ( srua(moou4tetomoctysfa2ul(msnt0 lxrif3oy1opDe u i;t)srxo(r no1aptemivia(fsrrau p;o4oee if3tadfa2ea(mp;(4aleoxo tytoaDeau il(0srtm(o oy4ale lnvilt arua(rpnt1apx mf3tls s2ra(vp;u)treomocoydfpDelueo ()seur(m3iu1ol emfesls) rrm(mo;u4tlxo oeiatfsDrmn s;t0trermo3iy1fp eau s;t0tetoio oudalenmnvta(faDur(rpot0oetomictls s em(vsnu) lxoxrcia1fa  lnvs ()t2toxrpny4ap n ncsls)srrax p;o1aleomo3iltfm ulumo ()artnxr iydlp r uvs;t0t2umiopiu1om nmiviat aDumum ;t4altomictaslm2rmnvsnu4aleomr3ty1fp r ivo s)t2urimpoydapt  ies s a2urxrpnt1alen o3iadfa2rmn p ()texnxo3oydfp eli ols)seumxmpno4optelnvsat s2tmxmpnt4teeomoeiatlsDrmnvs;(4aleomrcty1fmtelivsls0 rxriopiy4omee fvsls sDrrurooo0altnmfetytfa2rlu pnt) ltnmo oodoptr ivo;t0texr(o3ny4om nmivtas)a2trx  ou1aexn feiydlm2eanmsnt4teerif3iadfat li sls  rtmio3oy4al nlfcsl()a2rmump;u4texnifctltls em( o t4 rxomocoy1oaDelivilt t2uoir3nydlmee ivs (fa2umxmoou4alx ifeiytls ua(mont0alxomocio1la rau s;s  rxo(r no1opee fesasf Durxr ;o1oleomf3iyd m2rlums u4 lenifciotlatelueilt0trxoxopno1lpe lnetas) 2tm( pno1texn icils a2umu o (0 lxnxfctodoa  lneil() etm(r io4olt micilsfsrua(mpnu1texnioetadfsDrmuvont0tleoio3iydlaD livilt0trxrxopou4ol n fcil()srumum nt0tpt mo3ild mDrl(vo (4 lenmr3totop eauvi t)trto(r3oy1ap nmivsat a2um(mpou0ope mieiyd mDrlumsnt) ltoif3todoatelnvi ( s2xmim3no1ll elictlsf 2tauro;t4oeen ociatlm umu o;t4alerifcoytfptrlivols srur(m no4lptn ncsasfsrtm(rpou1teto feiasfs eanms;t)trtnirctadopDe nvils)texoxm3oodapeemfctas)srum(  ;u4tleoiociytfm2emump;t0arxrif oadomDeanvi (0setrim ny4apt lictls)a2umu  nt4tlto oeilt aDelnmpn(4alenmo3oy1fmDraues;(  rtm(rpio4om  lnetl(fs2ta( oot0oetnmo3ilt aDran o;t0tlenifctytlpte uvs;( s2uoxm oydopee ivils  2rru o;u4tltn fciys s2ranmp t)artoxf oydlp raivo t)trum(r3nodal nlnetltfsDrrx pno4oex io3iadls2elnms;(0arerifcoo1lmD  i i t s2tmxrpoydll nlnvia( aruau oot0oleomociltfaDeau p;t) lxoxfcia1oaDr ivolt) 2urimpiy4ameelnet ()aruaurpou1altn icilslmDraumo t4tetrmo tatfpD aieo;( truoxm ny1apee neta()srum(ro;u1aetoifciadfaDemnmsnt4 etrmocoytfpDe ueols0s2ur(m iy1oleelfcils)aDtr(ro;t0aeeoifcildls elnmp;(0artrxo3iy1fptrli ol()t2umir3oo4alt lfvt t  rrrxmont4olxoioctadlsDem( p;t0aexoif oo1lmtraivi s t2xr(mpio4lm e nvil(f Dumx pnu4alxn octat mDua(vonu4 exoxr3oadom  lneo;t  exrxo3iu4lmen feia(fartax p;u0ape mfeiadfs rl( o ()altomf3ia1fm  luei t0truo(o iodoleelfet t a2um(ro;t4tlenif3iydfa2uau s;t)tltnxo3tadfpDraieol( texm(o3oo4ol emiei s) rum(roou0apto f3tlslm uan s (0 ltrmo3oadlmD lu o;(0 euo(o3no1lm nlnvi s  2umxro;t1aee  feiltlaDrm( s;()tlxrmf3iatlaDe nvi;()sexo(opnydolenlictatf 2umxmo;o4tet  ociyd m2elumont0teerxfcoo1om  lu s;s)srxo(opio1ll   fvslt aDuaur ;o4opt moctlslm2rm(mp u0 leoirciodfmteanei;s t2xmimpio1lpt  ict sfs2umxmont0olxn fciytlsDran p;t4arenmo iodlm r ivsls)s2xoir3nydom nmieias sDum( pou1aetoifcildlmDumumpnu4altrxo tatopD aiei (0t2uoxo oudapt lnvta() rurxront0oltnioeiadlm2eanmp t0artrxociydlmtr i ilt s2tr(r nu1lltelnesl(f Duau  nu1ape  fctys mDrm( s;u)teeoir totfatrln s t0 etriopou4al  lieta(  2tm(mp;t0tpenifciytfa elu s t)arenxrcoodfmteln slt s2umxmpnu4ap  mivs t) rumum ou1oetn fctat s ulu pn(4 eenxf3ootfm rlueslt  etm(mpoy4ol elfcsat aDtmumpou4oetnio3iyd s umnvp ()arxnmr3ta1opte nvo t)s2tmir ou1llte fvtlt)s2rrum nu1opx moeiyd m emu pnt4aexoifctatoa  livsls0 exoxm ny4ope mivtasfsDuaxrpoo0tlxo feiatfa rlu s t0tlenio oytfm rai s;(0t2uo(opiy4lpen fvia()sDraxmpou4aet miciat a el(mp (4arxrmfciydfmDeaieslt0trxrxr iudapt mfcs t sruaur ot1olt  ociadfa2eluvo u4 etnir3ty1la eluvi;s0srtrimpoy1ape mfvtlt)aDuau  ot4oleomf3ilsls2emnmont4tltnmr3iy1op   uvs (0seumxmpiudalt  fes ( s2rr(ro;t4tet mi3ias a ulnms;t)aeeoio oo1lmt aivi;s0seurim3oy1altnlnctlt s2tmxmp;u0tlto feiysfmDrl(mp u4areomr3oo1fp   ivi;t  rtmimpoydomt lfvt sf rra(moou1aptn o3iad m rlu pn(0teeoxoctadlat auvi t) ruoim oydameelfvt s  Durxm oo4tlenifeiytlsDeln s;t0aeenxf3tadoaDeln i;( truriopiydop emiet tf rrr(m ;o1aet  fetydfs eluvp;t4arxoio3iotfa rlnvol( s2xr(o io4omtemfvi tfs2ta(  nt4oltnif3ias sDrlu s (4alenir tydom rlnvsl()truo(rpnodlle lfeta()sDraurpnu4tle mi3iys a2rl(vs t4 exoio3oy1lpDe nvo;(0setm(mpny4olenlfeia( a2rmx p;u1olenifctld a2elnvpnu4 lermocoatlp   iei;t0teurxrpio4am  lfctlt sDur(r nu1tpx iictlsfsDumu snu4 ltomfctydomtrai ilt  rxoxopoy1lptelfct (f ruax  ou4oexnii3tydfm eau p t)arermf3oy1la e u o s tetm(opnydamtn ivt tfarumxrpnt0teenif3ilt a2ul( p (4 lxrxfcoo1fmt  uvsl(  euoir3no4lpte ivs ( s2urxroou4tpenmietls s2elnmo;t4alxnxf ootlpDeaues t  rtrxm3nu1lp e nesas)aDua(m ou4teeomi3tlsls ea( s;(4 rtrmrcoodopDeau o;t0t2tmir no4omtnlics t)sDtm(m ;o0tlt  ieiydfs2ul(mpn(4tlxoif3ty1latrai o;s0srxmxr nodlp nlfesls s2tr(ront1tle iocils m emu p;t4arxrxocta1lmDeaieo t) rurxrpnudole mfvil() rrmum nt1alx ifciytfm2ua(vs;t4tetnmociy1lmt lieils) exr(m io1lltnmiesl(f 2ur(rpoo1optnif3iatfsDean o (0tetrio ta1omDean ol( seuoir3oo1alt mnct t  rrmur ot0aptniociysfm2ran s;t4tleomr3oodlmteluvs;s  rxrir3iodllenlnctls  Drmurooo0oeeoio3tat sDelu s t)trtrxo3iy1lmtr u sls)seur(o oodolenlnet t arrmurp;u0oee ioeildla2em(vpn(0treoircty1lp r ivo;s0texrxm oy1ll e icsat  Drmxmooo4oltomociadfm eanvo;t4 ltrmr ty1omt  i s;(0t2to(mpnudom nlies () 2rr( ono4alxnioeiatfs ea(vs;(4tltnxfciydomteaneo t0sexo(r nydlmtelfvil(fs2tm(root1oltoifeiys a2em( s;t4 ltnio iy1la  anvilt)sexmxr3nydam n fviatfarraurp;t0tptoio3iasfa2rln onu)artnxf to1omte iei ()texoir nodomtnlici ()srrrxm nt4oexnioetatfa rau snu4aeerxr3totop   ueo;()sruoirpoy1alt mnctl( s2ta( onu0tlenmiciysla2rau pnt0trtrif oa1fm raneslt setoimpiodlm e nci t) rrrxm ;t1alt mf3iysfa rlnmp;(0 lxnmf3oy1fmD  nvi () euoimpou1apt  nesa( srtr(r ot1aptomf3tlsla ua( sn(4tleomr tadlp eaueil() 2uoimpnu1lme licilt) Duru ooo1apx  oeilt a2uan pnu4 rtnmr iadlaD  i i (0s2tr(mpoo4optnmictl() Drru  ;u1aexniietltfsDuluvon()altnir3iotfaDe ivs t0truo(o oy1lp nmfes () ruau  ;o4alxnif3iat m2ran o t0altrmo3oadfaDe ieslt srum(o oodap nlnctasfa2tmumoot1texomo3iatfmDuanvp u4texrmo3iodfpD  u sl()t2xmio3nudlpeelieil()a2rrxrono1tet ioeiatlm rmn on(0aeerio3oytlp r nvslt0srxo(m io4altn fcsas arumxrpnt1aexnmo3iadla2emuvp;u0texnio3tydoa eauvs;s trtr(o ou1aptn ici ( srtaxr no4tee io3iadla rmnms t0aeerxf ia1fp eluvs t0t2xo(r3iydamtelfvtlsf rrau  nu1alx  octytfaDel(mpnu4arenir3ootlmDelivs;()trxrir3iu1ap nlfvsa(fa2rru ont4aexoiiciatlsDra(mp t4areomociy1fa  li i;s srtrxo3iy4am nlfctat)sDurxmoou0ape if3iyd mDel(von()artnxo3iy1opteau sl()s2tr(m ou4optn ict tfs2taxr no4alxo fciyt sDua(vo () ltomf3oy1lpD  uvo t tetrim3oo4ll  lfcs (  rtrxroou4ope mfctltlmDean o (0aexomr iatlp  auei s)t2trir nydoptnmnci (f Drmxrono1ole moctasla ranmo;(4tetrxr3oydfp  lieo;s0s2tmiopnodap e ivils srrm(mpnu1oex mieild sDelumont0 rtrir oa1lp ranvi ( srxmxo ny4lmtemncsat sDrmxmoou4ole ifctytls emnmo u0trxnif oodlmtranvsl(0tetmio3nodapenlietlt  rtaum ;o1aex iieilt mDeln pn(0artoioctotlpDrli o;t0sexoxopou4lptnlfvt t srraxrpno1apxnmfcilt aDrlnvo t0texnifctodoptean olt texrim oudame lnet s)aDtmxmpoo1tltn iciad s eln sn() reoiocoo1latraneol() rxr(mpiy1om  livs s)s2uau ont0tlx ifetysla uaumo;()teerifctodlp ean o;(0s2xo(r3ou1apeemict tfaDtmump;o0olxomf3tlt a2el(mp ()alenmr oydfpD  u o () rtrio3oydlpe  neta(fa2umxr nu4alxomi3iyt a2uanvp u0arxomrcoodoa raivo t) etrirpio1ole lnvt s sDtmxmp;t4optoifeils a ra(vs u0 lxrxfctodoptr n o;t) rtm(opoo1altn nvtls) 2ur(m ;t4ole  o3iatlsDuauvon(4trenxfciodlpDraivol(  eurir iydap e neia( srtr(rpot1tptnmiciatls rm(ms;(4tleomfcoatlpt luvo;s0tetrim iy4om emivta(fsrur(m ;t1aex mfciad mDrlums;t4 lxnif3tytopteaueilt0tetmxr3iu1am nlncil( a2rm(mpnt4ope moeiatfa2ra( pn()aetoxr3oa1faD aueolt0t2trim io4aptn fvtl(fsDrmumpot0optnio3ils sDemn pnu)alxoxf3tadfatr nvilt) 2xoxm io4olt mnvsasf 2rm(r ;o0oex mf3iyt m2em( o;(4 exrxociadfptrauvil( truoirpoudoptelivtas)artm( o;u0oleoif3iyd m2rmnmp;(0aexrxrctotfa eaues t0 exmiopnu4llt  nei tfs2uaxr nu1olx mfciatfa2ua( o;t4altoif iodfa e iei ( s2urxo nodomtnmnesl() Drrxr ;o0tet if3ils m2umu o t0 ltnir3ia1lptrlnei t0 rxm(opnudolen ncsls)a2rr(rpou1tpenifeiasfs rlumo u)texnxocoytlaDraneilt0srxr(o3io4omeelfes sfs2tm( o;o1apxnmicils aDumnvo;t0tlxnmo3tadlm eaieo;t0teto(m nu1opt mfetltfsrur(rpnt1tlenio3tldlmDra( p;u0teeoifcto1fa eauvs ()t2xmir3ny4lptnmfeilsf ruaxr ;o1openmi3ias mDul( o;t)alenioctatopD aivo;(0trtm(r ny4olte netl(f 2ra(mp;o1tlxnmoctasfs el( o ()arxrxf oydfat lneo;(0s2urxm nydomt lnctat) rrr(m nu0opeomiciasls uluvpn()trtrxf tytlmt anvil() rum(r3iy4ale  netat  Dtrxroou4oltn fcild sDumn pn(4 lxoxo iadfm rlnvi;(0 2xm(o3nu4amtnlnct tf Dumurpot1opt mieildlm elump;(4tetrmo3oodfmDrluvo;s0 2tmim oy1ll elfeiasfa2trxm ot1tpeo f3tasfs uluvsn(0altnxociatlp eaues;( t2trio3no1lle  fct s  2uru o;t4aexnmoeiysfa2ea( p u)trtnxfcootlaD au ilt  rtmxr3iy4oleemnvtltf rumumo;o0aet mi3iltla rlu p ()arerirciatomDr i slt0setmio3iy1llenmfeias)s2uaxmo;t4oetomfcilsfmDeanvs;()aexnir iy1opteluvils)s2xmiopio1oltnlicia() 2trx oot4altoio3iysla el( s;u4tetnmo oy1fpDrluvs;(  exoxopiudolenmfeiat) Drr( oou4tptn fciltfs rmump;u4aeerxo3to1opDranvol()teuriopiudamtnmfvtat)a2trxmo;u1aexomocild m2ran snu) rtrifciytlm e nes s)seum(r nydll e icil( a2um(roou0apx  fctyd s ulums;(0altoxocoa1opDe ivs;s)seur(o3ny1lleemfes tfsrurxm oo1alx iociysla ulumsnt4 ltomfcoatlm r u o (  rxrim oo4lp  mnvtls sDrm(r nu4optn o3ildlm2eaump;(0 lerxr3oatoptranei (0t2xm(r3oy4amte nesltf Durxmpnt0tpenii3tlt mDulu s u)tetomo tydlm   ivo t0teur(r3iy4ap   fvt sf 2rmum ;t4alxn o3tatfaDeluvpnu4tlenmrcta1lat aivi (0 rtmim nu4amee ics t)aDra(mp;u1tle  feiatfaDemnvp;(0treoir iotfmtelueils) 2urxm3ou4ll elfviltfsDuru pou0tptn fcildla2raums;(0 rtrio oa1lpD  ivi;t)trto(opoudal elnvtasfs2rrur oo4alxomf3iysls2uauvp;t0aetoir io1op eauei;t)s2umxmpiudlp e fesls) 2tr(mpot4olen i3tldlsDulums;(4 exnmo tadoa   uvo s)t2xr(r3oudome  fesasf rum(mooo0aetnmietlsla ul( s;u4arxnxr iadomtelueslt t2xm(r3oo1om emnvta()aruaurono0teenifctls sDulu s;(4 rxnxf ty1fmDr ivi;(0t2xrim iu4ale liet ( s2rr(rp;o4aptoifetyt a uauvon()alermocty1la  aueilt)texoiopou4omeemnvtat arrm(m nt4apxnifeiytfa2el( s () rtrxf3tydlp rlies;()t2xrim no4lm e ivtlsfaDuru poo4alt mocilt m ua( p u)artrir3iatoaD  ivi s0srxm(o iydalt mnesasfartaumpno0texoio3tat sDulnvont0aeeoxrciotla rauei t trxrim3nydom   ieslsf Dumu pou0tpenii3iydfm rm( snu)aeermrctatlat  i o s teurxopiydom  lfes s  2uaum ;u4tpx mfetadfa ul(vs;t) leoxfcty1laD li ols  2tmim oodapenlics t) rrr(rp;t1apxoiicias a uaump t0tlerxo iadfaDelneo s)srtrimpnu1op e fvtl(f 2umumpno0oet mi3iadfsDea(msn() rerir3ootfat aues t0sexmim iodamtnmfvsltfsDumx o;t1teeoifeiydlm2eanmp u) lxrmo iadomt au i;(  eurio3oudomt miesas)aDumump;t1altomiciysfa el(mp;t)aexoxo ootfpDrlies s0trtmxo iy1optnmivils aDtmu pnt0openmf3iasla2rmu s;t)aeenirciy1oaD  iei t0trumirpiu1apenmfvil(fsrtm(m ;u1alt mieiys aDum( on(4 lxoir iy1late ivols)t2toir3no1optn ici ( artmumono1alxoifctadla ua(mo u4aleoiocoytlaDrauvo;t)tetrxmpnodlme miesl() Dtru p;t1aleo iciasls2eanmo;()tltnxocoytom  lnvo ( sruoxo3iudomtelnei t artm(r ;t0tpen i3tls s2eln snu) rtrmo3oodlat luvo;s) 2umio oy4alee ncsatfsDra(r ;u1tpt mo3iysls2em( o t0 rxomo ty1fp eli s;(0s2to(o3ny1ol nmfvilsfartau ooo0teeomieias s2um(vpnu4arenmr3oa1lp eai o (  2xr(mpoo4lm emfeil(fsDtrx  oo1optomo3tlsls rmn o u0 rtoio3ootfptran s s0 eum(opiodale lnvta()aruru  ot0alto f3tas s2rluvp;u)aeerirciydfp rlnvols0s2um(opno1ome  icil(fsrtaurono0optnif3iasfa2ulumpnu0 renxrcoo1lat  i i;()tetm(rpoydolt lietas s2raxmono0olto icild s ranvp;()aexnir tatfaDeli slt0 2xmim iodlltnlfcsasf Draxmp;o4openifeiatla2rmnvo;u4 etrif3oydoa eluvi s0 rxmxm3ny4al  lfcsas a2tmur ot1altomictytla eln on(4texrmocty1fm r uei t0 2uoxopiodlptelfvsl(fsDuaxm oo0aexniociaslm2ul(vp u0aexoio iotlp   n o t0trxoim3nu4lme lfei tfsDurxmpnu1oeenifctatfmDemu o;t0 exnxr3iotlptran o () ruo(m nydam  livtltfartmumo;t1opeoio3ils a2ul( o;() leomocta1lmt lies ( sexoirpio1omeelicslt arrmurp;u0olto f3tys sDul(vp;t4 etnmf3ia1fpD  ues t)srxrimpnydlme mictls arur( p;t1opx moctlslsDeluvo;u4aexnmr oa1om  livslt texoimpoy4lm  miesasfa2rrurooo1tee mfciatla em(vonu0trxniocoodfmD aieo;( srxoio nu4lmenlfetasfartrxrpno4apeo fcilslm rmuvsn(4trxnxrcty1opDe uvol(0t2toimpiy4llen nctasfsDrax pnt1opx mo3tatlmDum(mo;()aeeomf oadlat  ivil(0trxmio3oodoptelivtl(f Dtau pot1apxnmiciyd s2emu pn()trxnmf ta1opD lnvo () etr(mpiydalt mfcsls a2ua( oot4tptoiieildla2emums;u4 rtrif oa1fm e i ilt0teumirpou4olte ivs ()arrrxmpnu4alen ociyt m rmn ont0arxrxr oodfpDrau i;( seurxopoudomenlncils a2uaurpno4aeeomoctldls uau pn()aexrxr ty1fp e u s;( trumxr3iy4ame mivtlt  2trxmonu0tpen fetydfa ulnmo;u0arxrmf3oa1opte ivi;t0texm(r3iu4om   icilt  2umx p;t4alxomiciltfsDeln o ()aetrxo iatfaDran s;s  2tmxopiudome  iesasf Dtmumono4aexnmfciaslaDrau p u4 exoio todfaDeaueo t0s2xoim oo1llt lfvt s)s2ur(mooo1tpxnmiciydfa ua(mo;t)altrircoodomDr u ol()srxmxo3nydal   fvtls arua(mo;u1ole mf3iatfa rl(vpnt)tltoif oo1la r u s;t0 etrim3nu4al elfvsl()srrmxmp;u1oeeoii3iyt a2ra(vpnu)trxrxr tydlptrluvi t0t2xr(opoydop e iviat a2tmu pot4opxnmociysfsDel(vs t)texoioctadfmte nei s  exrim nudlp e fei t  Dtaxroot1texoifcias s em(mpn()altnxf3tytla  au s;t0 rum(o oudome  fvtl( srta(mpno4tlxn i3iasla2rmnms;u0 renmrctadla eai ilt)trumio oo1omtelnvias a2umxr ;u0apto octysfm emumo;u4arenmf oytomDeanvi ( s2umxrpio4lmen nesa(  Duaxr ;u4tleo ocilsls2uaumo t0aetrmr3oatfpteli o;()seto(mpnu1lltnmnvt (f rtmu  ot0apto i3iytfm2rl(mo;u4areniocty1oat  ieilt)texrxo3iu1lm emnesatfaDurur no0tpe  oetlslmDuaumpn(4artrioctadfmt ln s;( setm(r3iydome  fct (faDumu ono4olt mociyt mDemu p u4 etoio3oydopt anvslt t2urio3ou1ol nlnvsls)aDuau  ot1tetoiictltlsDranvs;u)tlxoir3todlm  lnesls0 eurimpiu4op nlnvs t)sDtm(r ot0ale ioctytfs rmuvsnt) eerif3oatomte nes s)s2triopiu1ole  ieta()aDtrxrp;u1aetn o3iydlaDulu s u)altoxo iydlaDrlneils)trtrxr3ny4ame lnet s) Dtm( p;o1tptomfetytlaDelnvonu4aexnio oo1lat  n s s)t2urxo3iy1olt  nciat)s2rau oot0tlto octlt s2eauvs;(4teeomf oatlm  ai s t tetoxo3nu4lptnmfesatf rraum nt4tlx  octatlm umuvo;()trerio3oytfateaiei t0 2xo(m3oo4op e nct (fartr( poo4tet iocildls2rau p u)aexrxo3oydfaDe iei;t  rtr(r3ny1al nmicsl( aDtmumo;u1oeeniiciysls eln p;t)arxnxoctotlmDeln i (0t2uo(r3oudam emfctas) 2tm(  nu4optomi3tlt mDrlnvp u0aetrio to1fp rlnvi;(  2umim3oudole lnctlsfsDta(ro;o0olxomoeiytfa2rm(vs;u0tltrir iadopte ivsls sruo(m3oudope licilsf rrr(  no4tltomf3tys a2em(mo (4texnmr3oo1omD livs;s0 rtr(m3nu4apenmies tfaruauro;t4tet  o3iltfm um(vo;(0 eeomf iy1lp  ai o;s)t2to(m ou4op elfetat s2rmxronu4oetoiociytlaDum(ms u4 etrio tytlm e i s ()seuoio ou1oleemnctltf Durx pnt4opt ifciad a2ua(mp;(4 etrxociodlmDrauei s) euo(m3io1omenmicils  Drmuro;u1tpeomoeilsfsDumu p;(0 etnifcoytlptrai i t  2uo(rpny4op e fviat)a2rr(r ;u0altomictaslm rmnvs (4 eerxf3iydopt ai i;s0 eurxm iy1ol   ieils)aDta(m no1oet  fciydfs2el(vo u0 eeoir oadfptrlnvi t tetoimpny4openmfet t)aDrax ono1tpt  feiysfm rl(ms (4 ltnifcoy1lmD ln s;s)t2tm(o oy4omeelfvi ( s2tmu  ;t0tlxo i3iysla em( ont0tetomocoytlaDelnvi;()trurio3ou1lltnmnci tfa2ua(ro;t4aleomf3ildfsDrm( p;t0 etoiocoodfm  an s () exoxopiu1lpee nesat  2rmum oo4alt mfctld aDrluvo u)arenxo io1omDelueils0tetmxo iodlpe mfet (fsDrmxmoou4oee iieiysfsDelnvonu4tetrmo to1lpt auvil( t2tmxm3ou4omee ncsas s2tmx pno4tpt  oeiytfs em( o t4alxoircootfateau i s)t2xrim3nu1lmte ieiltf rumu pnt1oex mo3tldfaDum(vo u4tleomo tydfa   ivo (0trto(o ou4om   icta(f rtmurpot4alxomfciadfsDrlnvo t)trxnmrciy1omt  i i;s)t2trim ny1lmenlfes s arua(mpnt4alxo i3tat a rlu ont0 exnxf to1omDr n o t)texoim nydal eliesa() rrrxr ;o0opxn fciyt a raump;u4 rxnir to1fpt au o s teuoxm ou1om  lfeslt srtr(  ;o4oeen o3iydfs emnmsn(4 eerxr3to1fpDrluvo t t2ur(o ou1lltnlnctas) rtaur nu1oet if3tad aDeanvp u0 etoif3ootop ean sls sruoxm3io1lp nlivt s) Drmx pnt4optnmocias aDelnvsnt0aetoio totomDrlivi;s teuoxo3nu4amt mieta(fsrtr(r ;t0tlxnif3iysfm2ran o u4altomo oytlmtr ivs s)teuoxm io1ap nmieils)aDtaxro;t1aptn f3iydfm el(vp (4 exrio tatlmD aieols)s2to(m3ou1amtn nes t artmurono0altniictyt sDea( p u0aexnmrcoodlm eaies;s srxrxrpio4op elieia()a2taxro;o4aexnmi3iasfm uauvpnt4 etrmocoatoptr n s;(0 eur(opio1lpenlnetas)aDrrum ou0tetnio3iasfmDea(ms t0 rxnmr3totfa  livo ()srur(rpnudamen ncsat artmxm ot1tptomocilsfsDrlums;t0 renmfcta1fpte u s;s texrxopiu4am  lfvtls) 2ra(mono1ale  iciad aDrl(msnu4treoxr3oodoaDrli ilt)teuoim3oy4ape miet t  Dururono4olxo oeiad a uanmsnu0teeomociatom   iei t0srxrxrpiu1lpe mici t srua(moou4opto f3tlt sDeaump;t4 lxoxf oytomDe nvs;s)trtm(m3iu1ll e nciat)sDrrx ont0aetnif3ils aDulnmp;u)teerir3io1opD  ieols  rxr(rpoudap  lfciat)s2ur(root4aexoifctys sDra( p t0aleoir3iotfaDeauvslt0srtmxo3oy1omen fcsls a2uaxr no0apeoio3iyd s2emu snu4 eeoxf iytomte ueilt trxoio nudlpen iviat arrax o;o0oleoiietytlmDumn o;t0teenmf3iydlat anvi;( t2xo(r3iydop nlneta(f Dtrx ooo4oleo f3iltfm ul(vp;t)aetnmr oatfp   nvo (0 etmxopiy4ope  iei (  Dra(moou4alt  icias m2elnvo u0aeermf3oa1om eanei;s0 rxr(mpou1apeelfvias a2urur ot4tlx  feiys a2rmuvs (0alxrmfcia1omtrlu il()s2urio3nydlpt mnvt sfsDuru ooo1aex if3tyd a elumon()artnmrciodoa eliei;t0trxo(mpoudal  lnct sf rrrx  no1tpxniocilslmDuln ont)tltnmocoadfat auvi ( t2xoio iudap emfci sf rrax pou0teeoifctlsfm2ra(vo;(0tlenif3tatoa  ai i t s2tm(mpio4lme  ictasfaDuru  ;t1aexoiieildls2elnmpnt0artnxfctydlaD li o t) rtm(r3oo4op nmnciatfs2ua(rp;o1tpxomoeiat mDrlnmsn()areniocto1opt luvol() etrio3iudlm elfeils)sDtr(r ;o0alenmoeilsla2uanvs t0 rxrmr oytlm e i o;s  2xmxm3no4amenliet t)sDtrxr no4olt mieilsla rmu s t0 etrxf3ty1lpDrliei ()t2umxm3nudap elivt t sDtax oot1tet iociltls2rmu p;t) etrmfcoydoatrli o s0seumxmpoudam e ivi ()a2ra( o;t1texo ocils aDuanms u0 lxnmf iydoa e neil()tetrxopiydam nmnesls srur( p;o1texnmo3ildfa2um( s;u)alxrmf3iotlpD  i i;s0texmxo3oy1lm emivia(f Dua(mont1apx  fctatlm2ea(vont4trtnmo3totfp  ai o t0s2xmiopoodol nlfct t)arta(  nu1oeto ietltfs ulnmpnu4 rxnifcia1lmDeln ols) 2xo(r nudlpt mnvi sfaDtru p;t1olen f3ilsfmDua( ont0 rxomf iotfpteaues;s0s2umir3nydapt  iciatfaDtr(rpnt4apt ifeiyslmDrmnmpn(4 lxrxo iydopt lnvo;s0srxm(rpiy4omenmncs sf 2rm( pou1tex  o3tldfaDeau o;t0alxnxr oodlaD  uvo ( seumxmpiydlpeelnvt s)arrr( onu4aetn icilsfs2eanms t0tetomr oy1laD li i t0 2um(m3ny4lpe  ivt tf ruaumo;u4tet mfetasfm rm( o t0teenxfctydoaDeaiei (0s2urio3ou1apte nvs sfsDrr(ront1opt ioetytfa2eln onu) ltrmr iadfmDe u s;()srumiopno4olt livils)arrru  ;u1apxniieilsfm2ul( s;()alxrio3todlpteluvs t0 rxrxmpnu4ap   iet ()aDraumpno1olx mociltla rm( p t0artnxo oydfm eanvsl(0 etmxm iy1lp emneilt)arua(rpoo4opto f3iat a rl( pnt) etrmocootom ean s s0srtm(opno1ale  nctls aDtax  ;o0aetnio3tad m umn pn(0aeeoxf oatopDrlnvs s  2xrxm oo1omenlnvtas sDtmx onu4olen iciysla2eanvo;() rxnmo3iydfa ranvsl(0srurirpoo4al  lncsat)a2rrx  ;o1optnmictasfa2uaump t0teeomf totom   u o;s0 rtmim oodlm  micslsfsDrm(r nt4tltnio3iysfmDrl( on() reoiociatfm   ivolt0trumio nodam e fcslt)aDtmxr ;u4oetoif3iyt a2ulnmsnu) ltrmf3totlptrau i t  eum(opiu1omt lneslt  rrrxr ou4apto ictatla2ul(vo;t0teeoxf3oo1omD luvolt0s2xmxopoydapt  ici s  rtrum nu4apt miciyd mDua(msn(0tetnir iy1fptr u slt)s2xmirpny4lmeelfctat sDta(ro;u4tptnio3tadla raums;u4tlxomo io1fptrlieil( texo(rpiudolt  feias)srrm(  ;o0apeniietadlm umn sn(0alxrirciadlat  ueols trxrio3oodlm  mivi (fa2ur(mono4olx  f3iytfm ua(vpnu)texoxr tydfm raneilt seumimpio4lp nmnvs t)aDtr(rpou4olxn oeiyd m el( o u) lenxo3totoa rau i;s)sexm(o3iu4lm elies sf 2ta(  ;u0aptnmi3iyd a2rmnvpnu) rtnif to1optelnvs t0 rxrxmpny1lme mnesl() 2rr(moot1opx  ociyt aDrlumsnt0alxnmfciatoptrluvslt  etr(m iydol elnci sfaDra( pou4teenmfctat mDel(ms;()teeoxr3iydlmD au ols s2tm(m3ny4lpte fvsls arta(  oo4tptn feiysfm uau o u)aexnxo3oo1omD ln ils0 2xmxopou4om nlfctat)sDtrum nt1tpx miciydfaDuaumpnt0alxnmr3oydopDrlnesl()trurxr3nu1am emfctlt)sDrrx  nt1aet if3ilsfsDel(mpn(4 rxnmf iytlmt  uvs;(0 etmxo iodamenlfvia()srrruro;o4aet iictltfaDeln o () rermf3tytfa e n sls  exm(m io1aptnlfvil( a2tmxm ;u4olto f3iasls eaumpn(0altrxfciytlm ran il() euoio3oy1lpeemnesa() 2urxr ;t4ape ioeiadfa2emn s t) rtnxf3iydlateaueo;(0t2xoxr3ou4lme mfcsasfa2taxro;u1apxomoeiltls2emn o (0tlxoxr ty1la rlueo;()teumiopoodap e ictlsfaDurxr ;o1opxoiictys a2ran pnu4aeermr3ty1omDr ivilt t2um(o iudoltnlfeils  ruaumoou1olt  ieiydfaDuanvo;() lxomociy1fm r n i ( t2urirpoo4apeemfctl( arraxm ;t0ole mictytlm eaump (0 reomf oytlmDran s;s) 2tr(opoudamee fctasf Dtm(  nt0oexoiociys m eanvo;(0 eenmr tytop elivols)trxmxrpny1oltemicsl(fs2urum no1apxo iciysfm rlu s t4tltrxr3iy1opDeaivs;(0trxrxmpnodoltnlfcsls s2rru pnu0tlxn ieildfs ean s t4 rtomrctodfpteli ils)trxo(r3iu1lp nlncs () 2ua(  ;u0oexnif3tltfa2eanmpnu4 ltomf3ootlmD  nvi;s)sexoxm iu1op emfvtas  Drruro;o0alenmo3iltla2em(vonu4arxniocoo1optrai i (0srumirpiu4ll  lneias  rumx pou1oltoioetyt s um( s (0 ltnif3tydomD  u o;s0t2umimpoo1lltnlncslt  rrmu o;t4apeomfetltla ea( ont0aetomo3oodlmDrauvi ()sexo(o3oy1ome  fviatfsDuau oot4tltoioctlt s2ra(vs t4aetnioctydlmtrln i t0 2xrim nu1amtnlnvtl(f Duaxmpot0alxn o3tad m2eau s;t)texrmo to1fa  au s s) 2tmxopnydale lfeils) rum(r ;o4aeeo o3iasfaDum(mp t) rxnio ia1laDranvsls0 etm(o3nu1ame mnvs sfs2rm(r nt1apt  ieildfa2ulnvpnu)aeeoxo ootfp   n i s  rtm(mpno1lptnmieilt)sDtrxmont0optoio3tad mDuau snu)tlxrmo3oytlpt  iei;s0srtmim3oy1aleemneias)artmxr no4ale ii3iasls2umuvo t) rtnmrciodoat  u il()trumxmpnudomte iesls)sDrmxroou0aexoiocildfsDemn p ()texrxrctytoa  luvi;s0t2tmxmpiu1ape lfeta() Dtm(rp;u4apxo i3tyslsDrl(mp t)alxriociydopDr uvslt) exoim3nydlleemivtasf rraxmo;t1alxo o3iad mDulnmp t0tetomrcoy1omDe n o;t)s2toimpnydlmteliei t  rtr(m no0altoiietyd s2emn s;t0 exrmr3iatla rai i;( sexoxm3oo4omte nviatfaDurx pnt0oetnio3iydls2eanms u4artrxf oytfm e n ilt0teuoxo iu4lpt mfcs (fsrrrx  ;u0oee io3tltla rln pnu0aexoxrciotlaD auvs ( sexrxr nudlmte icta() Dum(  ou0tlxoiieiyd sDuau on()tltomo ty1opDrau ilt0texoxopoo4ole  fei sfaDrau  nu1ape mfciasla2eauvsn(4 leoxf io1oa  ln i s)teurirpou1altemncia(fa2rm(  ou1tetnifctadls ua( o;() etnxf iydfm r nesl(0tetmxo oodamte ieilt)s2rr(  ;t4tpe iiciyt a rlu sn(4treoxr oydom rlues;s s2to(o3nudlpee ieta(  Drrxmont0olenif3iyt a2umump;u0artomf3iadfm raivi;t0tetmim io1omeemfvilt)a2rmx o;o4oeeo ieiat sDrmumo () rtoxf tytoaD  uvsl( trto(rpiu1amt mfct tfa2rm(moot0ole  o3tld aDrmn s;t) renxf totfaDe ivo;s trtmim ny4openlfesls artrxr nt0aetn f3iytla2ea( snu)aeenxocoadlmDrluvs (0srxoim nu1lmt mfetas)srtaum ot0opto f3ias m2rlu pn(0tlxnxr3oydfm  auvo t0s2xo(m io4lle lnes (  2rr(m ou4altnifctltfmDean s;t) reoxocoadlm e ivo;s0seumir3no1lpt lneiat s2urx pou4aeenmf3iadfa rmnmsn(0areoiocoadfa r u i;s) 2to(mpny4alt  nes (f rrr(mooo0tetoioctad m rm(von(4arerir3ootla raies;s srtm(opno4altn ivsltfsDra(mpoo0oet  ietls m ulumsnt0tltomrcoydoa rauvsls) rtrim3iydamte feiatf Duru o;t1oltnmictysfm2uanmon() lxnmo3iy1lmDe ies ()teum(opnu4ol   nesas)s2tmxm nu1aptoiiciltla rmu pnt)tleoirctotfaDran i (0texm(r iudoptemncs (fsrtrxmpot1ope  ietad mDrm(vs;(4aexrxociytoa  ln ilt)setoir nudlp  mivilsfsrumu  no0opt mi3ilsla emnvo u4 rtrif io1oatr ueslt0 rurxr3no1ape  icsat a2rm(ront4ole ifcild a uau s t0aetnmociydomtrlieo ()texrio3no1apenlnet sfsDur(  ot4tpx ifeiltlsDelnvp t0aetnmrctadop eluvi t0 2xo(rpoy1lmte ncil(  rrmu p;u1tltomo3tasfm um( o;(4aeeoif ootfm  auvil(0 rtrxr3oo1lme lfcs ( srraumo;o4texnmoetls s2ul(vo;u0 ltoio to1fa rau sls)seumxr iy4ll  lnvia( arumxr nt1tet moeiytlsDrlnmsnu4trxrir3iotfaDe nvi t  eumirpnudop  lfvt (fsrta(mpno1aeeo f3iyt s umu p t4aeenmr3iy1omDrlnes;s0tetmxm3iudlpt mfesas) 2tr(mpnu1ole ioetldlaDumu pn() rxrmo oo1omD  nvs;s)texrxm3oo1lmenmnesat  Dua( o;o4aee mociasfm2eau snt4arxnxo3tadlpDrln ilt)texoxm3nudlptemivt ( a2tm(  ;o1tpeoiietyt s2elums () lxnxr3iadfaDeaues s) rur(o3oy1ome mnetasfsrraxrono1teeo fctldls emn p;t0texomo oa1lpDr n i;s teuoio ou4lp e ivil()sDrr(  nt1aetomoctlslm2uanvp;u)texnir ia1fmtrln o s)s2tmim iy4amtnmiet (f 2tru o;o0tet mfetysfm2emnvo ()artoxrcio1fa e ueo;t0s2xr(rpoy1lpeemfeilt)aDuaumpno0ape  o3ildlaDrln p t)alerxrctadopDr n il() eto(opio1lp e fci tfsrra(moou0tpto oetadfs ea( snu)artnxf totoa eanvi t  rto(o no1ameemieils a2tmu  ;o1apen o3ildlm2rm(vpnt0aetriociydopt  ivo;s  eum(opoo1altn fei s  rtr(r ou1oetoiieiad s2eau onu4arxrxr3ty1lmDe n i () rtmimpno4lm  lfeiatfsDurumo;t0tle io3tasfs2umnvs (4 rxoirctytfmDean sls s2urxm3iudom  miciatf 2um( p;t0aeeoiiciat m2rl(vpn(0trtnxfcto1fpD aiesls  ruoir3no4lp  lncsas s2rm( p;u1teto ociyd a eluvp t0trtnmo3iy1faD luei;(0t2tr(m oy4amee fvtls)a2uaxrp;u1tpxo ieias aDrmnms;(0tetomr3tytlpD lnvs;t0teurxmpny1om n iei ()sDuau o;o1tetoifeiysfsDelnvon()tltnio iy1opD au i s0srxmxo3iudlmt mics s)srtr( ono0olxnioeilsls eluvp;u0teeomf iotopte n o;t)truoio3ou4apt  iciat aDtr(mpnu1olto o3iadls2el(vs;u0arxrmr iytoa   i i;(  exoxm3oodlmtelivsl(faruaur nt0opt miciadfm2umnvo u)aetrxrctotfp elivo t seto(o iy4ll elfcsasf 2rru ono1aptomo3iadlmDua(mpnu0arxnxr3iy1opt luvs;t  2toimpoo1olt lieil( artaxm ;u4oltn feilslm2ea(vo u0aeenmf3tatfaD aiei t)tetrim io4ameemieiat) 2rmx ont4tee iictldfs2rmumo;(4arxomo iotopD anvo s teumimpny1op  livilt arurxrooo1optnif3tldlm rm(vp (4artrmr3iotfaDe uvi;s srxmim3iu4op   fetas) rtrur nu4aptn i3tyslsDulnms;t)trenxr oodfptraivi;()t2trxr3oo1ll nlicil(faDrmxrpou1tpen ocilsla em(vsn(4tlxrmo3iotlaDe i ol( srtmxr io1op nmictls)s2tmxr nt0tpt io3iasls ulumpnu0texrir3iatfat  nvs t)trxmxrpoy1openmfesat) rrm(mont4olxnioeiatla ul(mont0aeeriociytlp  luvsl(0trxr(m ny1amenmici t)srua(rpnu4oetniieiyt a2rlnmo t0tltrxf totlaD ai o t) rtoir oy4lptnmiet s a2trx pot4aeenmfeiasfsDea(mon(4 etoir3oodlatrluei t0sexrxr io1ape  nes tfa2ta( pnu0tex moeiltlm2eluvp u0 lxoifciytlm   neslt0 rur(rpiu4ope  ictas)sDrr(ro;o1alxnmo3iatfaDrauvsnt0aexnxo oa1oa eliei ()srum(m3oy4lmen fcsa( sDtr(m nu4openmi3tlslsDem(mpn()trtrmf oytlat  ivo;(0t2umir oodape  ivt (f rrr(mont1tpxomieiatfm2uau s;u0alerxocoydfmD aiei (  etrxr3ou1apte nvsl(  2rr(r ou4tpe ifctlt mDra(vpn()aeenmociodlm  ln o;s)teuo(o oy1ap nlnvta() rtm(mpou4tpenii3tasfa2rmnvsnu)trerio3oadfmt li s;( s2uo(rpiodop elneilt) Drmu  no1aexnif3ilsfa2emu o;t)arxrio oy1oa elneo;( trtr(r oudap emici (f 2rrurp;t0tpeo oetatlsDulnvs (4aexnxoctodlpt  nvi ()texoim3iydlp   ivtl()aDtaxr ;t0tpt moeiadfm rm(vo u)alerxr3todfatrlueolt)texrxm nudop emnctl() rrrx p;u4apxnmi3iatla rlnvpnt0alenif3totfa ran s;t)sexrxm3iy4op  mivsa(faDuaxmpou0tetnioeilt m eanvp u0 etoir3oydopDeli i s) rum(o3ou1lpe  net sfa2trx  ou4aet  i3tlt sDrlnmon(4trxnif tadfa   ies s)sruoio3io1ale lncsa( sDrmur ;t0opxoiietlt a2eau o t4alxrxoctotla ranes s0t2xr(r3oo4ap   fctlt srtru o;o0opeomfeiysfs rauvo;t) exoi
\ No newline at end of file
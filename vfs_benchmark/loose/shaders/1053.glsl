@@ -0,0 +1 @@
+n il(0 rxoio io4opeemfcsl(fa2rm(r ot4oee  f3tlsfa rm(msnu0treomo3oytlp  lnei s) eumir3iudlpte feta(faDum(mont1apxniieildls rluvpnu) eermr3to1om  ai s;s0setmxo nu1llee nvtas) 2tru p;u4teen ieiyd aDuau p t4 exrir to1op rluvi s0 etrxopny1op e fesl(f rur( oou0tpxnmoetadfsDel( p u) rtrmf3ta1lmteai s t)texo(rpoy1alt  fci t)a2raumpnt4alt  feilt s2rlnmo t4arxrirctytlpD  uvs s0s2ur(m3ny1opt lfvs t) Draxmpno0alxn ieiatfs eau onu)altnxo3oodfa  ln i ( sexr(opiy4lme mnetlt)artrum oo1oeeo ociad m2eau p t0aexoifciy1fatrau olt)seurirpiu4altemiesls aDumumont0tpt mociytlmDua( pnu4alxoxf oo1opDeai i;t) eum(opnydop   ieiat  2rmxm ;o0oeeoii3tlsfmDelumon(4trerirciadfmDeli s;t teum(m no4am e icilt sDumumont0oee  feiyt s ulump;u)aexoifcoy1lpt aneilt t2trirpou1lp   fvsasfsruaxmpno0tpt  feild s rmumo (4aleoxfciy1laDeaivolt0seto(r3iodam elneias a2trxm ot4aex ii3iydlm emumpnt) ltomocoytlptraieils0texrio nodoptemnvil(  ruau o;u4apenmo3iltfs2ulu o;u0trtrio3oadfa ean slt0srxm(r3ou4alen netls  2ta(ro;u0olxniieilt a2ul(mpn(4 renio3tytomtr u i t0trxm(m3iudlpenmiei sfsrrm( p;t0aleomf3ild sDraums;(0 rtrmocoo1faDe ivilt srur(opio4om nmneiat)sDraurpnu1ape  ieildfm2ul(msnt0tetrxo3oytfm r nvils)srxrxr iu4lmeelieta(fa2tm(  ;t4apxoii3iatfm raumo;(0teermo tatlp  ln sls  2toxm io1opte nci t)srtm(  ;t0tptomfciys sDel(vpnu4 exnxf3ia1om  lnes ()s2urir3no4ame lics (fsrrr(mpoo0texn f3ilt sDem(vo u)trxrio ta1lpt  nvi;(0trumxmpoydopt lfes tfs2rr(m no4oet  o3iyslsDumuvs;u4 eermf todom eli i;()setrxrpiudol nmfetatfs2tm(  ;t4alxoiociydfa rl(vonu0aetrxo3oy1op elu s (0s2umimpoo4ale mnvt s  2rmurpno4aetn o3tlslaDrl( p u)altrxo iadfm ranvi s0 eumio3iu4olen nctas) Drmx  ot4texn f3tyt mDemumo u) etrxr to1la rlueslt)t2xmir3iu1apt lici t) rrau  ;u1opt  ieiysfs emnvp;t) eeomo ty1fatr nei t0 rtrxmpno1al  mnetat)s2trx oot1oexoiieiydfa2ea( onu4alxoxr oytlmte neo;s) 2xmim iy4olt mivi s  Dum( oot4opxoio3tld aDemuvo u0arxrmf3tytlmtelnvi t texmim no1ameemfeias) rrru oou4tet mfcilsfa2rau o;(0aetnif3iodomDe i i;t)srtoio3iu1lmtnlict ()arrr(rpnt0alxniicias m uauvpnu0aexrmf iy1laDr ueo t0s2uoxm3no4ol n ivtatfs2rrxmp;u4oleo ictyd a2rmu p t4alxomf3to1oa rln s s0tetrio3oudope mfeil() 2ur(mpnu4apenifctysfaDemuvsnt0alxrmo oydom   i s;()sexr(rpnodol emfctlt) rrm(rp;o4alt  octyslm ra( o;(0arerxf3tydom  luvslt srxmio3iudoltemnvs s srtmxrpou0tex mfcild s emn pnu)tltnio3iatfateauvils)s2tmio3nu1am nlnvs ()artrumpnt4opeomictysfa rmums;t0tlxrxrciodopDrau s () 2trir3nydll   ies t sDtr( pno1oetnio3iytla rlnvo;()trxoirctadfmteai o;()tetrio3ou1ap nlieiltfaDua(rp;o4tlen feiyslsDel(msn(0aetrio oadlp r ueo;s)trxo(m3iy4alt mfesl(  2uauront0opt io3iltfa2rmnmp;t)aexnir tatla rlnes t0tetoxopiy4lpe lnvsl( arraxrpno0olto ocilt sDemump u0alxomr iydfmte i s;s)s2trxopno1ameelfes t) Dtaumooo1ole ifcilt a2ul( pnu0artrmr3tytomt  uei;()seur(r3iu1amen neil() rrm(mpnt4tlenmfcildfa eauvsn(4tleomoctatop  auvsls s2ur(m nu4alee fctls a2rmx oou4opto ieiltfa2ua( p u0tltoxociydlp ranei t trxm(o iodalenlnvias srraxrpnt0alxomi3tyt a ea( s t0altoir3iodfaDelieols0 rxoxm3oy1am nlicsltf 2ra(r ;o4tlt iiciasfaDrmn s;u4 exnxf3iydlm  anvs s0 2tmxo io4ll elfvias) 2taumpoo0olenioeiytfa2eaums t)alxomrcoodopDe u sls)trxoio3iu4ame mfci () rrmu o;u1aleoiiciat sDemu o t0 ltrmocty1omt li i (0 2xmxo3oy1amenmics tfsDururo;o1aeto fciadfsDul(vs (0 exrxfcty1lmtrli o t)tetm(m3no1amtnmneilt  Dur(mpou1oeen f3ias aDuan o;t0 ltrmr3tytoat livo t s2xmxo3oy4omenmfvs t)a2trxmo;t1tlenifctydlsDumu snt0arenifcty1omD anvsls  rxrxm3oy1ll  mivt s) ruax ooo0ope moctysfa umu s t)trxnmr3iydfmDrln o;(0sexmxr3ou1ap emivsl()a2rax ono4tpxnio3iyt aDum( on(0 rxoxo3oytfpD aieo;s trxr(opnodopt  iesas s2urx  oo1aex  feildla2ra(mp;u) ltrxrctotfaDrai s s0 rxrirpiodlmeemici s)srurumont4ale ii3tlsfm ul( o;u0 exnxfctadlateluvo s  2trir oy1olt  fcsa( artrxr ou1opxo ociyt m2eluvs t4teeoio iotfa rli i;( s2um(rpnydopenmivi t)srtr( pnt0ape  fcilt sDrmu snt)tlxnio3tytfmDeau i;t trxrxo iy1op nmncsatf rurx p;t4opxnmfeiatlsDra(vp;u) lerxfcoadopt lies s) 2xmxopoydomtn nesas aDrrxmpno1alx mfciad s2ulumsnu)aeeoxocto1fpDraneolt)seum(m3no4al  lnvt sfarum(m ot1aetoifeiyd m2ran o ()altomo3iy1oateanvs ( t2toirpny4olt  fvtl() Drmu pou4texo iciyslaDra(mo;t0tltomf3oytlpDrln o;()sexm(m3io1om elivtat  rta(m no0apxomfeiadls2emn p u0 lxnif3tadfpte nesl(0s2xmxopny4amtnlncsatf rrr(m ot4tlenif3iasfa ra(mp u0 lxoioctydlptraivi t0trtoxopno4lm  mfvils a2tau  nt4alxomi3tasfs ean o t4teeomr3iadlmt  nvs (0sruo(m3ny1olte iesl(  rraumooo4texomieiadfs rl(vp u) rxoxr3iadom   ueils setrxopoodoltnlictls a2tax p;u4oetoif3ildfa2emu p;u)tltrmrcoatlpt livi s0trumiopny4om  mfvils) Draxro;u1apxo o3tadla2ra(vont4tlxoxr todop r ivi;( teuo(opiodopenlicsa()arrauro;t1tlxn i3tatfaDum(msnt0areomr iydla e nei ( t2xo(r3io1al emfvi tfarumxmpoo4aetnmiciltfsDea( o;(0 lenmr3to1oatelueils)t2xoxopou1op e ncilsfs2rmx  ou0teeniietasfa2elump u)teenxfcootlm ean s (  eurim ny1omt lict ( arur( p;u1alen i3tytlm2eaump ()trxnxf ootla rau o;t0t2xrxmpiu1oltnmnesl()aDtm(r oo4aleomoctad sDrlu sn()tltomf3ta1opte ieo;s) 2uoxr oo4am   iesa(fa2trx onu4oee if3iyd a2ranmo t)alermo iodlp elnvs t0srumxm3no4oltn ici s)sDtrurpno1tpeoifciat m2emumo;(4teeomrctydfmDelu sl(0 rtoxr iy4llee fet t)srtaxm oo1aeeoii3iyd sDra( s t) rtrmociytopt aiei;t0t2umim3oo1lm nmnci t  Drr( o;u4apenmicilt aDul(vo (0 ltnxf3oydfa e uvol(0 eurim oo1olenlfes s)sDtaxmpot0texnioeias s2elnmpnu0trtoxr todfmDraneo t  2xoio3iudop nmnvtltfs2uru oou0apxo ocias m uaumo (4 lxrmf iadfmt lnvi (  2tmxm nydam   ieia(  Drrx ono1tlt mf3ildfmDelu pnu0 ltnifciodlpD lnvo t seum(rpnu1lmtemnvi s)srrrx ont0ope moeildfm2rl( s () rtnmfciodop   nes;s) rtmxm3oy4ale  fvt ( aDtrum ou1apeoiociyd s2rm(mp u4artrxfcoy1fm r uvol(0seuoxr oo4omenmncs t s2umu  no0olto ieiytfs2rau s;u0tltoxr3to1lmDeanvs;s texmxo3iodop   fei s)aDrmu pno4tpt mocildfmDem( on()artomrcio1latrlieo;s0s2tmio oodomenlictls)s2uau oot1tltnmi3tyt sDean s (4 eerxr3ty1om  lnvi (0 2tr(m3iydllenlieias)srraxr ot1aexnmi3tad aDul(vsn()tetnif iotfp r neil(0teur(o io4altnmivi tfsDra(r ou0oee if3iydlm rauvonu)tetrmrciadlm eau i;t0 eur(r3iydlmtnmnesl(faDuaxmono0tetn ieiasfa em(mo;u0tlenxfcoydop rlu s s)t2toio nodomeelnvil(fa2ur(mpou4apeomf3iys s rlnvon(0 rxnmf io1fate ivsls0srtmimpiydomeelieslsfsDtmurp;t4apeo f3tytfaDrm(ms;t0aetrmr iytfatr nvo t0sexrxo iydop nlnviasf Dumxm no0tlx mfetldfm umu p;(4tltnmr3oadfm eanei ( setrxo3oydapenlnei (fartmxmpnu4oex mieiysla emnvs;u) exrir3tatlaD  nes;t0 2xr(o3oydlme  fesa(  2rrx pou0aleoiiciydfa uauvsn() etomf iadfp r uesl()srxmir no1amt  ics (  rum(  nu1oee micildlm2ea( ont4artnmf3iotlmDr ueo t setoir3oy4omee nviat  2ua(ro;u4opx  fciad a rlnvp;()trxrmfctodfptrlnvils)truoir3oo4om  mictls)s2tr(mpoo1aex ifciysfs umums u4tltnir3todlp raneol()texm(rpiodlm  lfesat) rtrx o;o4tlxoioctyd a ra( s;u0 reoxf tatopD lnesls0s2urxo no4lp emnet t sruau pnt4tpe moeiytfs ul(vsn() lxomfcoa1la rluei;t setmxm iodllenlivt tf ruaxmonu1tltoiictlsla2rlnms t0tlxoxo3tytoatelnvo (0seumxo3nydole  fesls artmxm nu0tlt mocildlm2elumpnt0aexnxrciy1fp rlu sl()texmir3nu4lmtnlieia()a2tmxrooo4oltniieiyd m uauvo () rxnir oa1om   neilt)seuo(r oodal elivs tfsDrmxm ou4teenif3iad aDranmsnu4teenxf3oydlmt au i;t0 2xm(mpoo4lpee fci ( arua(mo;u1aee  i3tadlaDum(vp (0aleoifcia1oaDelnvi s  2to(r3iy4llt mnvi ()sDtr(m oo0oexoio3iysla ran pnu4aeeomoctatoa rlueilt sruoir iodomte nvsat  ruaxm ;u1tet ifeildfaDrmnmo;(4tleoxf oa1la rliesl(  2xr(mpiydlmt mfviasf Dtm(rono4oexn fcias s2ulu onu4altnmo3iadfm ranei t) 2xoir3iy4omenlfcsl()arur( pnu1oexomi3tldfs2ea(vpnt)trxrmr3iatfp r ueilt) exoiopoy4omtnmieslt)a2raur ;u0tpxn oeiysfs rlnmp (0trtnmf3oy1fp r i ils  rtr(r3oy4omtnlfetlt a2tr(  ot1tpe ifciytlm eanvo ()trxrxrciytlp  aueo s setrxr nu1lptelfcias  rururono0oetoiocilslaDumu o;t)trtnxrcoodlat  nesls0t2xm(r iudam  mfet t  Dtm( poo1aexn fcild a emnvs u)aetrio tatlpt lu i t seuo(m3oo1am eliei sfsDtaxm ou1oleoifetltfm2emnvon(0 rxnxrcio1oa e i ilt srxm(o3oy1alt lnvta()arum(r ;o0alxnii3ild aDeauvpnt)alxnio oydfptrlu i ()s2trxm io4lptn ncsasfaDtmu  ;t4aexnioeiatla2umnmsn(4 rerircia1faDeai i t)s2um(r3ny1altn ictasfaDrmump;o1ale mictatlaDua(msn(0aetrxfciy1fm  lnvolt)truoxmpoo4apte fvilsfsDurxmo;u1oee mictatla2elu o (0 rxomr iodfpt lues;s) rtrio iu1omee ies t)srur( pno0optnmfeild mDean o;u)tlxrif3ia1fpt  uvo;t srurimpoydoltn nciatfsrra(r ;u0tltomieils sDemuvonu0 lxnmo3tatoaD au ils0 2uo(m3oy4aptnlieslt s2trump;t1apto oeilt m umu p;t4alxomr3totfpD  uvo s)texo(opiydamtnlfei (  ruaur nu1teeoiictldfm2um(mp () exrmfciotoaDrauvo ()trtoxo ou1alenmfcilt)s2tru ono0tlx moeiatla uln snt0teerxo3ootfa   ivs;t)trurxmpoo4ope mietl( srtau o;t0apto ietatla uan s t)arxnxfcty1fp   u i t) euoxr3io1lp emfvs sf Dtrurpoo0opeo f3iydfm2emn o;t0texrir tytfp  aivi s  rxr(r iodopenlict sfs2rrxront0aee ioeiatlaDumn p;(4tlermo tadfa  lnes;() 2ur(rpoydlle licsasfaDurum ;t1apx  o3ias m2emn o;(0teenmocio1laDrliei s texmimpoudamenmncsasfaDurxm ot4tex iocildfaDrmumsn(4tlxnmf oadfm  ln slt)trtmxm3iy1al   ivta(fsDurx  nt4oeenmoetldfaDranmo;u0teeomrctydfmDe u o () eur(m iy4apee nei s  2rmurp;u1tlen ictad mDeluvp u0tltomo tatoaD ai sl( t2uoxo oo1llte nvsas s2rmur nu4alx  ociadfs ean o u) eerxr3oodfa ranes;t s2uoxo3nu1lmeemnvsl(  2umump;u4opx  fciatfm elnmp;u0aeerifcoatomt  nvs;s)sexoio iy1op nlnetl(f 2rrx  ;o0altnmf3iltfsDemumo t)aleoio3oatfpDelivo () rtoir3iy1lmeemfvt tf Dum(r no4oeto i3iasfa rlu onu0alxnio iydlmDr ueol( t2xm(opoy1al e fvtls a2umurpnt0aptomocils s2eanmo;u0 rtrmocoydomDraieils t2tmim3iy1lltnlfesl(f rrrum oo4tleoio3iaslm2elnvo u)trerxrcootoaDeau i;s)seurxm3oodoltelics sf rrmxmpoo0tex miciysfs2uanvs;(0arerxf tatomDelues ( s2xoxmpoy1ll n ivil()srrrump;u0ale mieiad a ulu p u4artrmr3tatop raieils t2xm(m nudol emnct tf rum(rpou1tpen i3iadls ran onu4aexoif oadoa eln ols t2xo(m oydopee netat artmumpno4olenmi3tldfm ean o (4alxniocta1opDeluei t  rtr(opoo4apt lfes tf Dtmx p;u4tpeomoeiyd a2ea( p () eermrciy1fmDrln sls)trxoirpoo1lltelnvils)s2tmx pnu0tetnmieiytlsDel(mont) leoxr iytfpt lu i;s srurimpio4al  mieia(f rtaxm no0alto f3iyd a umuvp t4 etoxocoytfpt livs;( t2uoir oodamtemieiat srtr(m nu0ope  ieiyslsDum(vsnu4 rermo tadfpD auesls  2xm(m3io4ale mnetlt srrmx  no1aeeomfeiydla2rln p (4teenmf3to1laDrluvsls)t2xmxrpio1ol nlfvs s)aDumu ont4aptoifeias m2ra(mo;t)tltrxf iadfaD lu s s0 2xmim3iydal e icias)sDtrumpnt0tpxoioeiytlmDumu s;t4aeerxo3totlat aues t srxr(r oo4lmte fcilsf 2urxm oo0olen iciydla eluvsnt4altnxfcoy1lpt lnvs;()teuoir no4opt liet (  2rrxro;u1texnmi3tytfa2uaump;()trenmo oa1lpDeliei (  exmiopno4aptnlivtl( srtr(moou4tltn i3tatlm2uanvs;u0alxnmr3ty1opt  nvi s0texrxo ny1oltemncsa(fa2ta(m ou4tpxomociatfm2elnmo (4altriociadlatr i i ()tetm(m oo1op n iei () 2rmx p;u1opx  o3iyd aDuan o;t)aeenxfcoatlaDeaneo;s texo(mpoudal emncia()a2tm(mo;o0tlxniociys a umump;(4aetnxr iydopteanvs;s) 2uoir3nu4lm   fcsl()a2uax  nt1texoiieildfs emnmonu)teenir3tytom  lu s t  2to(rpnu4oltnmfci t) 2urxmo;t0tpxn fciytla2uanvp;(0texoxo totlpDe uvs;()srtoxm oo4ap nmfci s) rumur ou4ale iicils sDrl( p;u)artoif iotfaDrlieil() eurir3ny1opt  nctasfs2ururpnu0tpeo ieiydlsDum( snt4tlxnxrctydlmDrli o s) exm(r ny1oltnlictat)s2raum ;t1apt moctlslm2rl( p u0alxrifcoa1fptelies t)t2triopio4llt  fes () rtax  nu4tltnmociatlsDemump;()aeenxo3tadoa r nes;s srumim3iu1apenmnvtas)s2um(mp;o0oetomo3tls m2eluvs;t4teenio3iydoaDeanvi s) 2tr(r ou4lle  fei (  Draurpnt4aeto i3iydfa2ulu p;(4 lermrcoa1omt aivilt  rxoxr3io4lp emncsatfsrrrxrpot0aetomf3iadfm2uln o;u0aetnmo iadopDr u il(0sexm(o no1lm  mnvsasfsDrruro;t0tlxnmoeiltlm2um( o t0tltrmf tadlpDelnvi;s  exm(m iodom e fvtl(fsDuax  ;t4tetnio3iltfsDuauvsn(0 etniociotlm raivo;(0truoio3iu4lltnlfetl(faDtax pnt4alxniietltlmDea( s u)trtoxfctatfmte n s t)trxoxr iudolt lfviltf rrr(  ;t1oeen feils a ranvo;u4aexrxf3oo1lpD auei;t0 2uoxopoodoltnlfvslt a2tmxm no0oetnif3iyt sDulnvo;() rxrmf oa1fateluei;s) etmxm3ou1alee ivtas  ruru ono0aeenii3ilsfmDuln s;u4aleomf3oo1om r i i t texr(o oo1olt lfetl() 2umu pnu1oetoioctldfa rmn pnt) eenmr3oydlaDrau ilt)teuoxopoydlmeelivt t)s2tauroot0altnmi3tltla um( ont) rermocta1fatelueil()texo(m3oudalenlfes t)sDuaum no4aeeo fciysfs rlnmo u4tlxrmo tytfaDr uvi;s)s2uo(rpny4al nlfcsl(  2um(mpno1olen i3tatla2rl(vs () lerif3iadfmDe u o;t seuoxmpiodamtemfei () 2trxm ou1tpeomoeiyt m2um( sn(0treoxf3todomt li o ()t2uo(o3nudome  fesat)s2taxm ot4tpto f3iaslaDeaums;u4 lenir oadlaDraivsl()sruoir io4opte icias) Dtrxm ;o0tpeo o3tat a eluvo;(0aexrmrctydom rln s;s)t2uoir3nu4olte fvt ( s2taump;u4tlen octys s2umuvs (0alxrirciodlm e neo;(0 2xmxm3nydape lfvtatfaDtrurooo4tpeomo3iadfa2rlnvp t4trxrxf3oy1oaDrauvi s)sexoxo3nudomtemivtls)s2tm(  ou1tetn i3iltlaDrlu s u4texnmr todfpD aueo;t0s2tmxopny1olt  feiatfa2uaxmpnt0apxo octltfs2el(ms;t0 renmr oydlp raieilt s2xmir nodol  liviat)artaxm ou1aexn feils s rm(msnu4 lerxrctydlp  auei;s sexoirpnu4ole lncsa( sDtr(mpoo0teeoiieiatfm el( pn()artrirciotoa rai i;s) exm(r io1ome  fci t)s2um(m oo1alxo o3ildfsDuauvs () etrif3tytla rlneo (0 etoxo3oydop nmnvias  rraumoou4apt moetatfm rmu sn() rxrxf todfmt  i i (0 2umir3ny4ole  ivil(f Drruroot4optnifciys mDraumont0 lenmf3oatfmtran i;(0trto(opiydam  livs t  2rrx oot0tet ifeilt a2eanmpn()altnif3tytlmtrluvi s0s2toim iy4omtelfetas)sDtrx  ot0opt io3tydfaDean s t)altoiociytlmDrluvil()t2ur(rpoy4om e fcs tfsDtmxrpoo1tpeo oetysfa2rmuvp (4artnxo3oydfaDrli s;() 2trir nydaltnlictls)arrax  ;u0oeenmociytlmDumnvp u4 etnxociadla eai ils0t2xoim iodom n fesas) Drm( pno1tet if3ilt m2el(mp u) lermf3oo1op raivol() 2tmxm3nydal nmietl()artmurpou4olx iociasfa rmuvpn(0texoifctydfmte uvilt)srxo(m3oy4ome lncs t)aDurxrooo1aptn ietytfsDrau pnt)texoxr3ty1fpte uvo;() 2xoir nu1opt lfctat  2rr(mp;t4tetomi3tltfm2rl( s;t0teenir todfm e nvs ()s2xo(o3oydop e ietas)aDtrumpou1opt mictls s2ua(vs u4 lenmfctodoa e nvo (  2xrxm3iy1amenmfetatf 2uaxrpoo4alx  f3tytfm ranms t0tlerxr3io1la eliei;t  2umxm3nu1lpt mncsl()s2rmumo;t4tpxomieiat m2eln p;u0artnir ia1opteaivi t  euriopny4opeelivt ( aDtrx  oo1ole moeiys m2umump u0tlenmr iodom rlu slt0s2xoir3no1olte feil( aDum( ono0alt  i3iltfaDelu snu)aeerio iy1fa rlues;t0teumiopno1open ici ()aDur(rono4olx if3ilsls ulnmonu)trtnmocootlmDraivo;()seuoxm iu4aleemfeil(  rur(mo;u0apxomf3tytla2el(mo (4 rxoxo oatomteluvi;t trumxr3nu1ll nmivi t srrax pou1oetn o3tasfs2umuvp;(0 lxrmo tydfa r uvs ( trurim3nudap nlfet tf Dra(m ;u4tpeo iciasfs2rmnmsn(0altoxr3oatfpD  i i;t0 2xmxmpiydllte ivi s a2tmxmpoo4tle  f3iys mDelnvon(4arermfcto1om raivi (0s2tmimpoy4om emnesatf Dtr( pno1aptn f3tat m ean o;()artnmfciy1oate i i;s0 rumxmpio1oleelivil(fsDtr(  ot4olxoio3iltfa2rmn s;() renifcio1fpD ai o s teuoxm io1oltnmnvtls)artrxrpnt4open ietasla2emnmont4texoxo oytlp r i ol(  etrxo3iu4lmt  ici (f 2rrxrpot0aetnifcild m2ul(vs;u) ltrmfciadfmD luvo;s)t2xr(r3oydlmeelnetat a2urum oo4tpxo fciyd m2ranvs;(4 etoioctotoa e n o s) 2xmimpou4lptnliet t a2rm(r ou1aetoifetytls2uanvo (0aeenmf3oo1faDr i i s0teumio ny4am   fvtlt)aruaumpno4al
\ No newline at end of file
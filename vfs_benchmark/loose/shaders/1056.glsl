@@ -0,0 +1 @@
+neo;t srxr(mpiudlpt livias)sDrrxm nu4oet mieiat s2ranvo (0tltnirciodfmDr ivo s0trtr(opiydome mieia(farumu ono4aet iociydfa ra( s t0alxomo iytla r ues;t0 2xrirpiy1om   netasfa2rrx  ;o0ape  oeildla2eaump (4 exomocoo1fm e iei;( srxoxm3oo4openlics sfartm(rpno0tlt  i3iltla2rmuvonu)arxoir to1fm r u ol( t2toimpiy1ll  lfes (faDtmu o;o1tee ifciatfaDelump;(4tltrmo tatlmDrlivs (0 2uoxm3oo4olenmivi t)s2tru  ot1tlxomi3tadlm ul( s;t0tetomf3oy1fptrlieo t)trto(mpnodape  nct ()sDra(r ;t1opto fciyslsDel(mp;(0arxnmr3ia1omt au o t) rtrxm3nydapt livsas arta(r ot0olt iieildfmDeanvs t4 leomrcta1fmtrauvs (0trumio nu1lptn ict t artr(moot0oexnifeilt m2rm(vs t4 eermfcia1lpD li o;(0trxoxr ny4olenmnei ()aDtaumpnt1apxoioeiltfmDuanmpnu0aexrifcoa1fa raivol( t2umiopiu4lpee ietl()sDtr(root1aexoioeiytfs ulu pn(0arxnir oatlpt  u o () rxrxopno1amt lietl() 2umxmpou0altnifetatls2el( pnu4altnxf iodomD  i i ( tetrim no1ll  lnct t arrmx  ou0aee mi3iltfa2umnmpnt4 reomf3iy1lm   n o;(0 rtrxr3oy1ome mfctlt) 2ua( pnt1alxnii3iysfm2rmu o t4 eermf3oo1opteaneil() exo(r3oy1aptnmicils) Dua(m no4opeoioeilt sDrmn s;u0altoif oodlpteau il(0srxmim iy1lltnmicta(f 2ur(mooo4tlxoiociatfs2umu s ()texoio3oa1lp e n slt)truoir iu4ol elies tfarraxro;u4olt mfctad s2emuvs;u0tlxnxf3iodfpD  ueols t2uo(opiudlmtemfci s  2tmxrono0tltn ociadls uln s t)arxoxf3ootlm raivi t  exmxr no1am  mivi tfa2um(m oo1tpxo f3tytfmDrlumo;t4trtomr3oodopDeaieo s) 2trxr3io1op emfvs ()sDrm( o;o4optn oeiytla rluvsnu4 exrxo iytopte nvs;(0 rxoxr3io1amt lfct tfarrrur nu1ole  o3iadlm rm(vo u4altnifciotfpD an i;t) etm(r oodlptnlfvi s) Dtmumo;u0olx ii3ilsla emu p;t4arxrir totoate ieol()t2xrxrpoo4lmtnlivt tfsrraxront1tlx mictldfaDuln p;u)treoif oodfpDeluei;t0s2uoxmpoy1lm n ieslt)srrauront0apx ioetytls rm(ms;t4 lerif3iadlaDeaivs;t0sexm(r3oodomt  fvtas)aDraurp;o0tpenmo3iadls2em(msn() etoiociatopDr nes;s  2xmim nudomenmivil( sDrm(r ;o1opt ii3iatfaDem( s u4 leomf3iydfaDrai i;s)trum(o3oydlmeemictlt  Duax  no4olxomo3tytls rlnmp;t4tlenxf oydlatr i sls t2xmimpiy4lmt miei sf 2tmumpot0tpe ii3tadlm rm( o u0 exoifcoa1lm eaivi (0t2ur(opiydale mivt ()aDurxr ;t1tetnifctat sDra(mo;u4tlenxfcty1oatr i o;t t2xmxm3io4lme mivias)s2rau pnt0tlt iiciatfa2ul(vo;u4 etnir3oo1opte uei;( trxr(m nu1apte ncils srurumo;u4tee ifciyt a2ul(vonu4 rtnmfctotoa   u i t)seur(r nudamenmivt tfarta(  nu4ope miciatfs rmu snt4trenmocia1fmDeln sls srxrimpiu1opte nvsl( aDraxm nt4aeto oeiysfs ean o;t4 eeoif oo1op r uvo;s  2toim oo4apeemfci s  Durx p;o0tpx mfctatfm rmnmo;() rxnio3io1fp r uvil( trxrxmpou4olt liesls)aDtru p;o0open feiyt aDeauvonu0aetrmocty1lptr ivi;s0trumxrpnu4lpen ieia( aDra(ront4olxnmfetld s rauvpn() rtomfcoytfaD aivo;t)sexmimpiudam   ietl(faDtrxrp;t0oeeomfeiydlaDulu sn()texoxo3iydfaDeau ilt)trtoim3nu4llt mivtlt)arrrxr ;u1teeoii3tlt a2ul(vsn()teeoiocoadlp  aueolt)srtr(r3oudlmtelnesa()s2tr(  oo4aleo feiydfaDrmnvpnt0aetoir3ootlm r nvolt) exoiopoo1al n nvt (fsDumx pot1teenmfctadfsDrm(vo u) eerio3todlmD  n i ( sexmimpnodam nlivs s  Dumur ot4oeenio3iltlaDuauvon(0tltoxf iy1om elies ( tetrirpio1am emieil(  rta(m nu4olto i3iydfmDra( o u4treoio tadfmDr i i t  etoim3iodll emfvt (  Dtau o;o1tpenifctltlaDranmpnu4aeeomrcia1la  au o;t)srxoxm iu1apt mivils)aDrr(rp;t4tlenmfciytfa2umuvo u) lerif iotomt  nvi;t) 2tr(o nodomtn nci s) Dta( p;u0tlx  feiltls ea( o;u0alxrxrcoy1op r ivo t)s2tm(o3iy4lm e nesatfsDurxmont0olxniociydls emu ont0aeenmf3io1lpt aivo (0 2ur(o oydale lfes ()srtr(mpoo4apxomieiys aDrluvpn(4teermo3iatop  aieo s0srtrxm no1lpe  fcsl() 2urumono0opxoifctat m em( pnt4trtoif3iotfptelivo t) 2umim3ny1ap nmici s)sDuaump;o4aetnmiciltfmDrmnvsnt)alenio oy1lpD luvo;s)setmxo3ny4ap eliei s a2tmx p;t4tlxniiciysfm ua(vsnt0trtnmr3tatopt ln o;(  ruriopoudol  mict (  2tr(root4tpxn feiyt m2eln onu)tltrxfciodlm r ieo;()t2xoirpnu1alt  ietat s2rm(mpno4tpxo o3iys sDumuvs u)teerxocootfp eauvsls0 eto(opoo1apt lnciat)s2tax  ot0aetnii3iyd m eaumo;u0 etrmo totomDelnes;( t2umxm3iodlmtnmics t)s2tmxm ;t1opx if3iysfsDem(vo t4 rxoxo3to1faDrlu i s srxmxr3iu1ole  fei sf 2uaump;t0opx mfetldlaDuanms u0artnxocia1fpDe uvil() rtm(r3io1alenmicsl(fa2uaumont4openmoeiyt mDulnms (0 ltriociatlpD  neil( teur(rpio4op n ieta() Dumxr ;t0apxo ictasfs ulums (0alenircoytfatrln sls truoir3nu1llte ncsls a2urxroot0texnmoeiyt sDrln p (0 eenif3io1fmDeai o;s sruoimpny4lmee nciat arraxr oo4aeeomfctldlm2emumo;t4tlxrir oatop  aieo (  2umxo ny1ll nmfei s srtrxr nt0teenmo3iatla uluvs u4alxnmr iytfaDr nesls0tetoio nu4lme lnvtlt  2um(mo;u1teen i3iad s2um(vp;u0altrxf iatfm rlnes t s2urxr ou1ame  ivsas)srtr( onu1tltn ociasfa2rm( p (0altrxocoytlpDr i i s s2xr(mpoy1am   fvsa( sDtr(r ot0oetoifeiydfm uanvs u0 exrio oo1oatr uvs () 2uo(rpoo4aptnmnctasf Dtmu p;t4olx mfcilt m uau p t4teerif3oodfaDelies s0t2uo(r3iy1ole mneia() rra(r nt0tpe mfciytfs eanms;u4texomo to1fmt livi t truoxmpnu1llt lnvi t  rurxr nu4aptomociad a2um(mo;t4alermo3iytop ean i s0srxrxm3iy4olen icsls)aDrru pno4tpeomiciltlm rlu s t)teeomrctotfatrlu ol() eurim3oy4om emfvtas) Dtr(mp;o4aptn fciat a2eln s u)altnmoctodfmte ivs ()s2tr(opnydalenlfvtl() Dtmur ;o1oex  ietltfs2ulnvo (4texnmo iy1laD aies t)trxoxm iodll   nctltfa2ta(r oo0tlx mo3iltfa rl(mp u4alenxr ty1lmtelueo ( teuo(o ou1ap nlivsat s2tr(m nt4ope ioeilt sDumn pn()aexnmrctadoatr uvo ()t2to(m nydol  lnei s srtaurpoo0alxnmf3iadlm2elnmo;u)alenifcoydopt  uvil()trxoimpoydopt  fvs t  rurxr ;u0opx iiciyt m ea(vpn(4artnio totoat ai o;s0 exoim ou1amtnmivta(fsrumxmoou1aleomfetatfm2ua(msnu0arxrmo oatopDe uvi;s0 2tr(r io4om n fvta(fartau  ;u4ope  f3iat s2emu onu)tleoiocoy1fp r ivs;( t2tmio no4omenmncia(fsrrmxr nt4oetn o3iadla umumsn(0 renio to1oatrln s (0tetr(rpiy4am elfviat)srua(m nu1tpt iociat sDelu s;t4 rxomo tydlateai s;( setr(o3ny1lleelictlt)s2urum ou4aetoifetasfaDuauvsnt0alxoxo3oydlp  aues;t  2umim iy1lle mfcs s  rur(r nt1opxnmo3ilsfmDem(vp t)altoxo3oadomtr neils0s2xm(o3no4lp   ici (f 2umxmono4tee mf3ias mDul(vs;u)arermr3tatfpDeauvols0 rtriopnodolen ivs s) rtr( o;u1oex  oeildls2em( on()tlxoxrciadfmt  ieo s teuo(opoydamt  nei (faDtrxro;u0oee mieildla rm(vonu0alxoirciatlm e nei;s0 2xoio3io4oleemici s)artmu  ;o4apt  fctls s emnmpn(4 reoio totlpt luvs;t  etm(opoo1lltelnesltf 2tru  ;u1tlxoii3iydlm2uaums;t) lxoxfctydfmteai ils)t2urio3oy1op  mfvsatf rrrxmpot1teeo ieilsfaDumu o t)altoif oo1latran ils)trto(mpoo4al n nvt s s2taxmonu4opeomiciadla rmu s (4 eermr3tytfpDrluei;t s2trxm nydllen nvslsfsDuaxro;o1oltniiciytls rlnmsnt0 etrir oadlm e uvo;s)teurxrpoo4ole mfciat arrr( pnt4opx  fciat a eln p;()tltrmo3tytlm r iei s0 exoxmpiu1llee nvs s)srrm(  no4tle miciatfs2emu p ()tleriociotopDeai olt t2trxo nu1ameelnet () Dtmxronu1tlxomictld aDraums t0tlenmf oa1opt lnvi;()srtmxo3io1apt liviltfs2rr( poo0olxn ociysls elumon(4 leoxo totlmD aueols0 etm(o3ou4op n nct s  Dtrump;o4aexnioeiadls2ua(ms t0areomo oo1optrlivo;(0trtr(mpoo4ol elfes ( a2tm(  nt4ale  f3iys sDrmnmsnu4aleomo oytomtran o ( t2urxo3nodalt lnvtls  2taumooo0optn f3tad a rmn sn()aetrxr iy1lptrauei s)texr(m3oudopt mfcia()srtrxmo;t0opxomoeiyt s2uauvo;(4 renxf iotoaDe u o;t0tetoxm iodol elncslt srum( o;u0olxomo3iatlm el(ms;u0treriocio1lpte i s;t0 eto(mpio4ole  fct (f rum(moot4aleo fctltfm2el(mpn(0tlxomo3tydopt anvs t t2tmim3ou1lmtn nvs (fsrumx oou1opx moeiydlaDelump u0arxnxf ia1oaDe ivi (  etriopiy1oltnlfvta(fs2um(moot0opxniicildfmDemnms;t) exoxocoo1lmtrluei;(0s2xo(r3oodamee nesl( a2um(ro;t4aexo fciytfm2ua(ms t4tltnif oodoaD  ies;s)s2xr(opiudame lncta(  Dururp;o0tltomoeiysls ea(vpnu)trtoio3iydlmDr u i ( s2xrimpnudlleemicsat s2rm(m no0ale moeiytla el(mo;t0 ltrmo3oydoa   neolt s2ur(r3ou4al  lnvta()aDrr(  ot0aexo ieiltla rlumsnt4 ltrmf tydlmD aueilt s2umim iu4openlivsls  2ua(m ;o1tlt mieils sDua(mo (4areoifcio1fpt auei t0t2umxr3ny1ap nlnvsl()a2urumpoo4aexn iciatfa eanms;t)teenxf ootoa   ivo t0s2xr(mpnudapen fvt (f 2rmu  oo4oeenmf3ilt a2el(vs t4trerio3iydlateaivi;s) ruoir nu1am  mietat)a2tm(rpou1apxoii3iydfs uanvp t) lxrxr3ia1lp e ivo t0srur(mpnudale licia()s2um(rpno1apx mocild m2umnmo u4teerxocootfptr nvi;()srurxm iy1omte iciltfsrrru oou0texo feiatfm elu p (0 ltrxfcia1latr u i;(0seur(mpio1lmen fctatfs2rrx  ot0teeoifctad s eaumo u0 ltnxo3oydlmt lnvo;() exmxm3oydllen fcsl()s2rr(rpno1apeoiicild mDrluvs u0tetoio3to1fa eauvslt)s2tm(r3oodam n fvt s) 2umu onu0oet mo3tltls2rl(vs (4aetoir oadlpte i ols0 etmxo io1olenlnctls arrrx  nt0tptnioeiytfaDemnms u)altoio tadlmteluesls)teuo(rpny1apeelivt t sDtrumo;o0tee  ieiytfm em(vp u)trtrio oa1fa rlu s () rxmirpou1alenmnei sfarum(mp;t4olenifciatla rlu p t4trtrmr iytlpt aueo;t0trurimpiudomte ivsltfsDrmxm ;o4oex  ietydlaDeaumo (0aeenxr3todfm   u s s0tetmiopnu1alt lfci t sDtm(mpno0aexnifetldfm2ran o;u4trxnmrciatfpt  i s s)t2xrir oo4lm  mneslt s2umxrpno4tpx  ietytfmDra(vsnt4 lxrir3oytoatrlivils  2toxo3oo1amtemfvtas a2tm(rpou0tle mf3iltfs rl(von(0alxrmrctytom   nvi;s0sexr(r3oodamtemnes ( arrmum nt4tleoif3ils aDrluvsn(0altnircootomD luvo;t)setrxm io4lmte ncias  rumurono0tpx if3iydlsDrmuvonu)trerio3iydopDrlnvo t trto(o oy4ome lfesa( srrrxmp;t1aeenifctat s2uaums (4aetoxoctatomt  ivilt srxr(o3no1omtnlicia(  Dra( ont4oeen oetasla umump;u0trtoxfcoo1opDeaivi t0texm(o ou4lpeelfcils)s2tr(  ;t0olt ii3iysfaDelnmo;(4teerif oo1oat  ueo;( tetr(m3nydam  lfci sf Dtrumonu1tpenioetld sDrmuvs;()arxoircootoptrlnvolt0 rtrir3iy4lltelictl(  2um(mo;t1aleniictldlaDuauvont0 lermr iatlpDran s;s)sruoxr3iodlp nmfvsl(farrrxr ;u4oeeomiciatlaDeaumont0teenif oytfp rlu s;t t2xmxmpiudal   ncsas  2rr(ront4alt iictadlsDrmnms (0trtnxf ia1lpDrlnei;t t2xmim3iydomt mfvsas sDtaxrpno1opeomfciad a2ea(vs;() lenmr3iy1la raneil(0t2tmimpiudapt  fvil(farrmxr nu0apxnmociyslaDrl( s t4texomr3iytlmD aivs ()tetoio ny1apt lneilt  rraxr ou1ape mi3ias s rm( on(4alxnmfctytfm raies s0t2xrio iydal nmfvsl(fsDrau  ;o0oeeoiicilslm umumsnt0 lermrcoytoa e ivi;t s2trxrpny4am e fvt s) rra(m no1aleomoetysfa2eaumon(4arerxo oatlat  ieo;t0 euoxr3no4olenmfesa(fs2trx  ;o0olxomictltls2rmuvs;t4treoxo io1lpD  n sls0 2urxo iodllee fcs t s2rm(ro;u0alxoii3iadls2umnvon(0 ltomr3tatfate u s;( teuo(o nu1apen fctlsfsrtm(rpnu4tex mf3iat sDrlu on(4trenxo iotomtrli s s)texmxm nu1ll n iviat  2rr(  ;u4apxnioeiltfs2rlnvp (0aetnmo3to1fpDr u o;t0 exrxo3nodamte neia( aDta(ronu4apxn iciaslm2eanmo;t4 ltrxf ta1fm eluesl(0 exrxr nudlpte fcil() Dta(r nu0tpt mietadla2ranms u)tetomf3ootlm elueslt) rxm(mpnodoltnmnvtat) 2rruronu0opt  ociyt aDrmu p t0arenio3tadlpDr u il() 2tm(m iy4lpe  nvtls)sDtaxro;t1tpeoiicilsfs rlnmo t4alermr3iodla eli i t seuoxr nu4oltnmnct (  2rr(  nt0texoioeiatlm eanvp () exnir oo1faDeau ilt0trtm(m ny4amtemfes s  2rau  ou4alt ioetydlm ra(mpnu4trerio3totoaD auvs;( t2tr(mpou4lltn fvi tf 2urxmonu0opto ieildlm2uluvs t4altnir ia1fpDelnei;s0t2tm(opnu4optemneslt sDtmxmooo0tlx ii3iydfm emn sn() lxrxo3ia1oa eaies s)t2tr(o iydop n nci t  rumxmont1oee mo3iys m umums;u0trtoir3tytfmDeaiei ( t2xrxo nudop  lieslt artax oot1aptn feiysfaDran o t0aetoxo iytfp  an o;t) 2tmiopiu4op nlieilt) 2ur( pno0olenmf3iyt m um(vp;(0 lerircty1fa rauvi s)t2uo(o3nu4om   fcils s2uru  ;o4aexoifciys m2uln snt)tltnmfctodfmDraiei t0tetr(o nodlpeemfesls)sDraump;o0tpto o3tydfa ua(mp ()trenmociodfatr u o;t0sexoxm ny4lmt mivil(fsDumx o;u0altn i3iysls2rmnms t0 eerxf iadop  lnei s srtr(opio1lltn nvs (fsDrmxmpou4aptnmo3iydfm elumo u4 eeomfcty1optr ivs t)setrim3ou4oltemnvtlt  Dum(mo;u0ale if3iadlm ulumo (4 eermo iy1lpt li o;t seuoxr3nudamtnmfei s a2urum ;t1aex  oetas a2ra( pnu4texrxrcoytfp   i olt) 2uo(m iu1ole lfcsl() Dtruro;o1tlxn feildfm ranvsn()teeoif3oodopt  ivslt)s2toxm3io4omte fcslt) rumxmo;u1olx if3iyt m2ua( ont4arxrioctatom e uvol() rtmxrpoodlmt mict s artauro;o0tpeniictatlaDulumpnt)teeomfciatfptr nvils0 ruoio3ny4lmt  nci s s2ur(  no4apeoifctlsfm rlu o t0artoxf3totfm eluvol()teuoiopiydamt mict (fsrtr(rp;t4aeenmfctatfsDuluvs (4altnir oodoa  aneols0t2tmxr no1am  lict t  rrrxrp;u4tleniocias m2um(mp;()altrmrcootfaD aiei;t)trtr(m ou4lpen ncs (fsrurumoot1tlx  feiytlm2elnmonu) eenirciodfmD auvs;t0trtoio3nodap   nvsl( arra(moot4oexn ietytfa2rmumont4aetnmrctadla elu sl()sexrxr3iu1lmtemnvsa(  Dtaurooo0tpxoioeiydfa2umumo u4 ltrxfctytopte uvo t)seuoio oo1op nlietl( srrrxmont0oeenifciyt a2ra(vo t)tlxrxrctotlmtr u sls0 eurxmpoo1altnmnvtls)a2tax  ;o0oee moeils a2umu s () leoircootlmte nvo;s) rtriopio1apt mfetlt)sDurumoot0texniictadla2elums u)tltnircoo1la e u i;(0sexriopoo4lme  ncil( srurx pou1tltn i3iyslmDeln p t) rermociodopt  nvs;( texm(r iu1lm emnvs (f Drm(r nu4texn feiydfm2umn ont0teerxrcty1oa eln sls)srxm(r oy4ameemfvilt s2uax  ou0opxo i3iysls ra(mo (0 rtoxfcto1fmt auvils) eurxo iu4olte ivi s arrrx oou0ole mictatfa umnvp (0 lenmf3oy1lpt lneo;t)t2to(m iydap  mivi s s2ur(r ;u4opto ociysfs2eluvp u4artrif3io1laDe uvs;() rxo(m nu1lpen nvt () rtr( pnu1olen f3tydls2ranvp;(0alxrmf3ia1fa elu s;t t2urxo3no4ol e fvs (faDurxront0aexomfcilsfs um( p;()artomo tydoat  nvi;s trxoiopoy1ol elfcs ( s2uaumono0texoio3iltlmDrau o (4alxomf tadoaDeaneil(0seumirpno4lptemfesls aDumu oou0tee mo3iydfs uln s;u4alerif3tydom   neo;s) 2uo(m3iy4lm e nvtat)aDuaxrp;o1aet  oeildfm2elnmp u)tetomfciytomtrluvs (  exr(r3nodll nmnesl()s2rrum ;t0tee ioeilt a rm( snt4 etrxr ty1fat lnvi (0srtr(opno1opte fvi s)a2rmumpnt4aptniieiasfs2ulu p u0aeerifcoydla r nvs s  2toxo no1al nmfetl()artmum nt4tet mfeiltfm2ua(mpn(4tltrmrciytoa rlivslt)sexrxo ny1altnlfesatfs2umur ;t4alenmi3tadfs rmump (4alenmrcoa1opDelnvo;s0 euoxr3io4amtelfcsas sDtm(m oo0ole  ociydlm umumsn(4 rxomociadoaDraneo;s0t2urimpnu4opte ict ( sDra(mpot1oee mi3iasfm ra(mo;u)trtnmr iatoaDrli s ( srumir3nu4apen icslsfaDurxr nu4texnmo3ils a2ua( o;t0aetnxr tatopt lnvsl(0texmir3nudop e ivs t a2ua(ro;t0tlt ioeiadfm2ul(vo t)altnio3oatfm  lu i (  exrxr3io4lmeemfes ( a2ur(mpnt1texn f3tat s rlnmo t) lermf iatfpt livs (  eumio oudlp  lnei t s2urx onu1olxn f3tlt s2rmnvsnu) leoircoydomt an ils0 2xoxo3no1ame lfvsas)arraxr ;u4teen ietat sDum( ont4texnxociatlmte ueo;s  rxrxmpoudoptnlfctas a2urxrooo1alxoioeild a2rl( snu) rerir iotlptrauvo;s) eurxmpou1open nviatfs2ua(  nu0aexo iciatls el(mp;u0aexoir3io1oa e i o;( trtmimpio4lpee ncta() 2rmumono1tpx iociltla ua(vonu4arerir3oytopDr neo;( s2xmim no1ope  fcs s)sDtmx pou4oleo iciad s2elu on(4trtrxr3io1omtrln o;t  eto(rpio1om emnct s sDra(mp;o4altniietydfa em( snt4 etomfciotfmt auvo;s) eum(opiydam  mfvia(  Drr(rpnt1alxnmf3iasfs2ra(mpnt4arerio3todomDeauvo;(0texoxr3nudlm n ies tf 2tmx pou1oexomiciltlmDelnvs t4tetomr oadlptrli il( sexmxm3iudamenlnctl(  Drrur no0tee  i3tlt m el(vs;u0teeoxr iotlm  ai sl(0tetoiopno4aptelneil(fa2umu pot4alt  fctydls2um( pnu4 etnmo3ty1omt  n s (0 etr(rpou1openlnetls)a2tmuronu4tltn f3tyt s umuvs (0tlxrircoatlmDr nvs s) exrir oydapte ncias sDta( o;u4olto o3tlsls2ra(vo (4 etnio3tytfaDeanes;()s2xo(mpnu1am nlivsat)sDta(m ou0opxoifciyd s rm( o;(0aetrir3ty1fpD lues ()t2trirpou1al eliei s)sDuaxmont1apto iciyd m2rmn pn(4tleoxrctodlaDrauvi;s) 2trxm3oydapee icsl()srta(r ;t0altnifciysfm emu p u0 rtrxf3tatopD aueolt)teurir3oo1am  mivtat)sDtaurp;o4tptnif3taslaDumn s;u0 rxrxf3oa1fp raivslt0t2um(m nudap e fct (  2tmx ono4oeeo fctad a emnmo ()texoxociadlatr uvo s  exmxrpiodlp emnvia( sDrmxr ;o1olxo oeils m ulump t4alxnxocoydop r n i t)seuo(o3oudll  mncil(farraxr ;o4oeeniictlt mDemn p;t4tlxnxf3iodoaDelnei;s) 2um(opio4ale  fvtls srumuro;o4tpe mfeiyd a2rauvo u0aeerxf3oodlmDe u ols)t2uoxr iu4oltnmfcta( a2rrum ou1oex mieiyd aDemuvo;t4aeermo oy1late nvs;s trxoxo oo1aptnlfviltfa2ur(monu4olx mfcilt sDrmn o;(0 etrif oadfp r neo;s srumxr iudapeelnciasf 2um(r nu1altoifciydla2elu o ()trxomr tatfmD  neol(0texmxr iu4olt livia(f Durxmoot1olxomfeiadla2rmums;u0trxrmf iatomDeluvols)seto(r3ny1apt  fvsas sruax ono4alx  f3tld mDuanmp;t4trxnxr oytlateliei ()truo(opnudom n fcsl()s2rrum ot4tleoif3tydla umums;t0altrxocoadom  an i t)t2xr(mpno4lptn nes ( srumxm nt0olenmieiysla2rl(vpnu4treoircoo1la r n o;s0srtrim3iydomee ies tf Dtax o;u4oex if3iysls rln s;(4trtrmrcia1lpDe u i t0 ruoio iu1amenmnei tfsrumu p;u0optomf3ild aDuaums t)tetrmr3ootfpDr uvolt0s2trxopnydll nlfciasfarrm(r nt0opxomf3iadfmDea( pnu)aexnio iy1op rau o;(  rxm(rpiydaltelfcsa(fa2uau ono0texomoetys m ua(ms ()artrif tydomte n i s0 rtrxo iudameelfvi sf 2urx pou4oeenmf3iydfsDulnvpnu0artrmr iatlp  ln o;(0teuoxm3oo4ol elnvta(fs2ta(rpou1apto oeiltfmDuluvs;u0 renxr tydlaDrlneol(0 2urxr iudam nlfciasfs2raxmo;u0tpxnioeildfm emnvo (0treoifcto1lp r nvils0 etoxmpnydapenlieta(fs2tmu pot4oltn ociad sDeaump;(4trtoir iatfp r ueils0texmiopiudlp elnvil(fsrtr(r ot4oexnif3iltfsDrauvont)aetnmf oodfpt luvs s) 2tr(mpoy4op   nci () 2trx  ou1oeeomociyd a rl(vs;()aeermrciytlp rlu s;s  2xmxm3iy1al  lfetls)aDtruro;t4tlen feiyt mDemnvp ()arxoxo3iodlmD  neo;s0texr(m nodlltemfcsas s2trx  ;u1aetomfeiys sDean o;t) eermf oodfa eai s ( s2xo(opny1lle  ieiat)sDra(  oo4olxnif3iltfm elu s u)artoxr todop e nvo s  2toir io4apt lfvt t sDra(mp;u1tpe ioeiadfmDulnvonu4 exoxfciotomtranvi t0 etm(o oo4olenmnei sf 2rmu  nt0olx if3iatfs ea(vs u4aeermo3oodlm rlivsl(0trto(o iy4open fvt t srtmur ou1tlxomo3ildlm ranvs (4 exrmf tytlateaivols)srumim ny4al  livtlsfs2taumpot4teenmieias m ran p (4artoir3to1fpt  uvo;s0 2xmimpoodalenlfvs t)srrrum oo0apt moetadfs ul(mpnu0aeenir oo1oa  ai sls0texm(o3io4op  mnesa()aDraxmpot4apen ociatfsDran snu4tlxoir3ta1fa e nvolt0truriopoo1lp e ici ( arurumo;u4tleniiciatfs2rluvpn(4 lxnmo3oodoa r ivi;( srxrim3nu4llt mncil()arrruro;o4aeen ieiltlmDul(mp;u0altnxf iytomDeaivo ( teum(rpno1lp   nvtlt) 2ua(m ou4tetn octysls2rln p u4trtrio ty1latrluvilt)t2umiopiydamtelncia(faDtmu  ;o4alxomfciydfm2rmu s;u4 rtrir io1fp  aneo ( trxrio3nodlpt  nvtas)aDuaxr ;t4opt mo3iaslaDeln o;(0tetrmo iydfmtr ieo;()srxoxm3nydopte neil( sDtrum ou1alenif3iad a2ul(vs u) rxrxo to1oa r i i;s s2tr(o oodll emnei sfartmurpoo4opxnii3tatls emnmonu0 renxf oy1lmD  uvil( t2tr(r3nudape  fvsltfarumumo;u0tpxn fetatls2elnmonu)arxomf3ta1fpD  i i t) rto(opno4lpenlfcsa(fsrtr(m oo1tetoifciltfa2umnvpn()alxnif oytop rlnvo;s  eumxr io4olee icilt artmxmpou1oetnmociytfa2ulu pn(4arerif3iotomDrlu o s  2uoxm3nu1am nmfeia()artrurpou0openiieiad a ua( p ()aexomoctytom ean o (0trum(mpiu4omenmiciatfs2umumooo4tlenmoeiadfmDua(mp;(0tlxnxo iytlp raueo;s)trto(m no1ame mnvilsfsDtaur ou4altoifetydfa rau o;u) lxnxr oytlm eli olt)sexrxopou4lme  nvilsfsDua(rp;u1opt  fetlt m2rauvo u) rxrxr3oytlp eanvi s0teum(mpoudomt lnvt s srrax  oo4apxnmo3iadfm2rmn p;u) eerxo oa1oaDe i s;s s2tmir iydllte nvt () 2rrxmoou1apeomo3iadfa2eln s u4aeeoxf3tydoa elivs t s2to(mpiu1apt lfct t  rtr(r nu0tpeo iciydfsDra(vo t0artrio3iotfptelnvo s)trumxo3iy1lptnmivtls)artmxmpou0optnifciadfm2uluvont) rxnir oytfptranei s)trxoxopiu1om emieilt)s2rmumo;u4tpeoiieilt sDeauvp u4aetnxo3iy1omt luei;t  rur(m no1open fviat srrmurp;o0tpe ioeildfs ua(mont0alenmf iy1la e ieo;s) exmio3no4ol elictas)sDuax  nu4opt  feiysfaDemu snt4 eerxo3ty1la elivi;t srto(r3oo1alte ncsas aDtrxr ;o1apt  oeildlmDul( o t4tlxnir3tadomteluvs s)s2xr(opno1ome mneiat)srurxr ;t4opxoif3iadfa2em(vonu0tetomo ootom r uvilt s2uoim3ou1apenmfciltfa2ta(mp;t4tpxnmoeilslsDrmn s t4arxomfciadlpDeauvo s)sexoxo nudamtnmnesat) Drrx pnt0tpxo ieiaslsDuanvsnt) etrmo3iy1laDr uei;t teuo(rpou1aptelfes s)sDtrxrpno0tet ioeiatlm ulnmp;(4aexrmfcoa1lp r neo t0setmxo iu1ll nmncslt)arumumoot0tle if3tatfs um(vp u)arermrciodomDelivs;s0t2toxo3oy1lp n fcta(fsDrrxr ;t1oexn oeiys mDrauvonu0aexoxrcoa1fmtrluvo s)trxm(m3nydalt  ict t) 2uauroot0tpxo o3tlslsDrm( o u)tlxoxfctydoaD lueo t0s2xoimpiy1opte ncil( a2uaxr oo4alxoii3iltfs2ua(mont)aeeoifcoy1laDeanvsl(0srtrxo nydapeemfvtl( aDuaumono1aex  iciltfs rluvp (0tlxrxf oo1lpDelieil( seurir3oodaltnlivs (  rumx p;o4tpxn oetyt m rluvp t0tlerxrcoy1op  ln ols s2uoxo ou1ol n ivtas aDrauro;u4aet iictat sDrmnvont4trxrxo iy1op r uvs;t0 euoxopoy1llenmivia(f rrr(mpno1tetn f3iytfsDeln p u4 ltnmo oytlp rli ols0t2xoir no4omt mnci ()aDtru  ;t4alxoif3iytla ulumo t) rtnxo oy1op raueil()texoir3ou1opeelfvtltfsDtauroot1tpe ioetltfs uau p;t4aleoiocto1fpt lnei t  rurir iu4am e ncsas a2uaump;t0apt  ieiadlmDranvs u4tetrmf3oatlm ran i;s0srxmirpou1lmtnlnvia(f rraxrpoo4oexoifetas m2ran p;() leomr tatlat au o (0trurxopio4ol  mfvt tf rraumonu4opxomi3iyt m2em(vp;u)arxnio tytfatelivo;s)srtrir3ou1lp emnctlt)srtmxmooo1optoiieiydfmDuau snu0tleoif3oatopteai i;s0trxr(r oy1op nmivt t srumuro;o4ope  oetydfm umnvo t0 lenxf3tytoatraivils0sexmxm nodol  mfcsl( sDtaum nt0olx mocild a ra( s;t)artnio iotla r u sls t2trxo oodlme liviltfsDtaxm no0oeto ieiydlmDelu o;u0 eeoio3oodfpDr i o;(0trur(r3oy4ll n ietlt)aDtmum ot4tpeo i3tadfm2uanvpnu) rtomrctotfpt  neols0sexoxo io1op e fvtlt  rta(mono1tetoiociysls ea(vpnu0texnmfciotlmDrai o s)tetmio nydame liesl( aDta(  nt0texo ociytls2uau s;t)arenmociodfa r nvs ( srxo(mpou1ap   fvilsfarrrur ou1olxnmoeiat m rlu o u)trtrmf iydla e nvo;s srtmio oydapt lnvilt)s2umu p;o0apx ifciadfaDeanvp t4aeerxf todlpt li s;t) 2tm(opiy4lleelivtas  Dumxr no0opto feiasfmDulnmsn() etnif3iadfmteluvolt)seumim3nodlmeelncilt)artr( pot1oet iietatfsDea( s;(4aetoif3iydlmtelneo t0srxoim3iu4op n fcsat)a2rr(ronu0olt mieiltlaDumnmp (0tlxomocoo1om rli i s  rxm(mpou4lm  mfetlt sDtru  ;o0apxniiciys a rmumo;t4texoif3tadlat an s s) etmir iu4lltelneiasfa2rau ooo4oeto i3tytla ulnms;t) etnir iydlpD aiesls seuoiopno1opte ictat)srtaxmo;t1tleo oeiatfa um( o u0trenmr3iadfate i s;(0tetmxm3nu1llenmfcsatf 2rrxr ;o1opeo ietlt m rl(mont0trxomfcty1fpDrli o s0 rxr(mpnu1lptn ncslsfs2urx pnt1opx if3tydfs2elums;u0 eenmf3ia1opDranei ()trtrxo3iy4lpeelivsatf ruaxmooo0aptnmociadfaDulumo;u) reoxr3tytfaDelu s ()trur(m nodal emfesatfsrra( poo0altoiicildlm2ulu s u4tlxrmf ta1oa ranes s trxoim nydole mnetas)srrrumonu4olenioetas s2eln o;u0aetoxr oydlm   n o t0 rxm(m3oo4ll elnctls srrrxroou4apenifctad s em(vsn(0aetnxf iadfm rluvils)setoxo3nu4omenmnesas  2ua(r ou4alxomfeiaslm umnmo;t)trxnmo iy1fmD ai i;s0tetoir3nu4opt mivtasfa2rrxr ou1tlx ii3tlt a ua(vo;t) ltoio3iadomtrlnvs t trtoxrpiydale lnvtls s2uau ono0oet ifetlsls2um( s u0trxrmf oatfp eli s t trtoim iu4ope lfeslt)aDumumoou4aeeomo3tysfa uanmo t4alxnifctodfa eaues;s0 rxrio ny4openlfci t) rra(  no1oetn oetlslm eluvpnt0tltnir3oy1la   ieols)s2xrirpny4lltnlfei s  rum(r oo0oltomo3tls sDul( s u4aexnxo3tadomt anvil(  rtoxo3ou1lle mfci t)sDrmxm nu4apxnmiciad mDrluvon(4trxoir tydomDelu o;t)srxoxmpou1apeelicslsf rumxm ;o4tltomfciat a ranvpn(0arermr3tadomteaueslt0teur(r nydamenlivilt  Drr(r ot1oexnmociytfs umnms;t4tltniocoy1om eluvs ( srumxrpoydllenmnetlsfsrururpoo0alxoiictld aDranmon()trtrxfciatoaDeai il(0trtoir io1lpe mneias)aDua(  ;u0tlxoiieiytfs ul(mp (4 ltoxo iodfatrln i t0 2xr(r3iu4lp emfci s)sDumxmoot4oetnii3iyd a ulu o u) eermr3iy1laDr n s t0srtm(o nu1ameemnetl(f 2rmx p;o4alxoii3iad mDrmump;()tlxnio ta1oat lues;t) exoiopio4am  mfvsa(  rumurp;o1altomociytfsDum( sn(4trtnxf3iytopDe i i ( setoxo3oo4lle  fvt t a2tax  nu0oex iicilsls eln snu)altrxrciytlp  lnvil( s2trxr ny4opt lies t  Drr(  ou0oltnmf3iasls2em( o u4trtrmr oydlm rlneols)t2xrim nu4ome  nes ( aDum( pnt0oexnmfcilt mDeln s u) renmr oa1fp eaies;s s2xm(m3oydapenmici t  Dtrxrp;o0aetoif3tyd mDel(vo () lerxr3tadfmD  u ol(0s2xmir ou1ol elncs t)arurxm ;o0apxn o3tytfmDrm(msn(0 rtrmfciatfm  liesls0sexr(m oy1op e fvtlt a2urur nu0oee ioetydla ulu o;()tetriociodlp eaneilt seuo(r3oo1apenmnetlt)arumx o;t1opeo oeiyt sDrlums;() lermo oy1om elies s)t2xr(r3iu1ll   fctasfartaxmp;o0tpeo icilt mDrmums;t) eeoxfcoy1lp  lneil(  etrirpno1op  mncia( aDumurooo1oee micilt aDemumo t0alxnmo3io1op r nvo;(0t2uo(m oy4amt  feslt  2tr(mp;t1aexo feiltfa2rl(vonu0alerxr oatfmt luei s0tetrio io4amtnmfvi t) 2trxrpot4tex io3iadlm ean o () reomr io1opteln i;t  rtoimpoodom nmnvils  2tru p;u1aexnio3tyslm rmuvs (4tetomo3oatfmD livols0s2tmxr3ny4llt  ict s)sDta( ooo1oee ifctydfm2emuvp;t0 lxnircoatop eanvi ()tetoim3io4om   fvt sfs2tmu ono1alx iociyd s2ra( s u4alxrxr3tytlmtrlnei;s)sruriopiy1llt  nei ( s2tm(m ;u1oleoiietyt s rlnvo u4tlxomo3iytoatr ieolt)trurio oudap  lfet (fsDua(  nu1tltomoeiys s2eln snu0 exrxrcootomDran sls  eum(m oo4lle lnet s) 2tmxrpno1tltnii3tadlm2emumpnt0teerif tadoaD li i;(  rtmxm nydome  nvias arrau pnt4aetoio3tatfm2rmnvs;(4artnif3totom rlnvi;s0 rumio nydamt lnci () Draxmpnu4apx mo3ildfm2raums u0tlerio oatfaDrlues ()sexmiopio4amtnlfct tfaDuauroou1tltomo3iydfa um( o;u0trxnxf iy1lp eanvo;t t2xoxm3ny4alenmnvs t) Dumxmo;u4oltnmfctyslmDulu o;u4 exomr tadop  au s;s)setm(r nudol  mnvt sfaDua(rono1tpx  ietatlmDrl(vs;(0 eeomf ootfatelneilt trxoxo3oudolenmfvi sf 2taum nu4aeeoif3ilsla ua(mont0alenxocoadfmt luvs;s teto(mpiy4apeemfvi tfsDurxm ou0altnmfctldls ranmpnu0 lxrmo oa1laDranvo;s) 2xmiopnu1lpeemfvi s) rrrx pno0texnmfeiytls uluvp t0 rxnxfctytfatran s s0s2uo(m3oo1ameelfvilsf rurx poo4oeto ociad aDuauvp;u4tlenmrcoatoaDeau ils) eumxmpiu1ap e icta() rurxmont4aeto iciyd s ra( pnu4 lxnir oytfpDrlivsls0 2xoim3oy1am nmneilsf 2um( pou1oleniieiadfa2ua( o (4arermo3oo1fmDeln s;s0 2xr(o3nydaptemncias)sDurxmpou0oeeniiciatlaDuln o ()aetnioctotla eauvolt)srtrio iodlm elfcilt  2rax pot1altoii3iysfsDel(mpn(4areoir oodlmt ln olt)s2tr(m iudlp  lfvs ( a2trx pnt4apeniiciys s2rmuvs u4tlxomr ia1om  auesl(0sexoxrpnu4om e fet t  2umxm ;u0opx  f3iytfa ra( s;u)altoio3oodlm raivo;t s2umxo oy4ome lfet () Duaxmp;t1oex iociyt a rmu p;u)trxoircoydlp eauvol(  2xoxmpnudaleemfvi s aDumxmo;u0olxo o3iltfsDeau p u) etrmr3iytfpDe ueslt0 rumio3no4ll  miesls  Drr( oot4tpt mi3ildlm2umumpnu4arxnxr3to1omDrlneo;s  2umir ny1am  mivtas  Dtrum no0tet io3iatla ra(ms;t4trenmf iydfa r n s t0truoxm nudaptn icsatfaDum(  ;o1oee  o3tas m umu s;(0 rerio io1fm   uvil(0seum(r3no1amen fvtl(f 2ra(  oo0aleo ictld aDrlums t4aexnir3tytlpteau o;t  exr(m nu1lle  ncils) Dtrx poo4tlx  ictlsla2elnvont0tetomfcia1oaDeai i () rtmio iudlleemnes s)sDrr(moou4aetniociysls ra(mon(0 eerxr3oadopD lnvils0 rtr(r3iydlltelnes ( a2ur(mpou0olt  icilt aDulnvon() rxoxfcoadomDrauvo (0texrim iydal  lies t)aDua( p;u1alx  feiytlaDel(ms;t0 etomociytfpD  i sls0 rur(m3oy1apenlncsa(fsrtm(  ;u1tpto ociasfmDrau p;t4aeermrcoa1la  au s s)truoxr3nu4lltemictltfaDumu p;u1tpe mociysla2ulnvs u0 etnmrciydfaDelnes s)srum(o3iydllenmnvtas)aDta(ro;u1alxo fciysfm2eauvsn(0arxnir iatoate u slt0 2tr(mpoy4ole  fes s)s2ur(  ou1tptomociad a ul(vp (4artoif3oa1faDrauvs;()srtoim nudlpeemfeia(f Dra(mpnt4olen iciyd m rm(ms (4 eeriociy1omtrluvol(0t2to(r io1lmtnmfctltfartauroou1olt  octytlm2rmnms t4areoxr iadfpte i ilt)s2uoir3nudlm emiet sf Dururpnt4texnmiciyd a emn o;t4treniociy1fa r ueols0tetr(o nu4lpe  ivt tfsDta(  ;t4tltnmoetlsls uau s t4 lenxrciadfptrlies;s sruoir oudlp   fet (  ruauro;o1apenmfciatfs rmuvs;u)alxrmo3ta1oaD  iei () exoir iu4op nlfvt t s2trur no0oeenifetyd a rlnvs t4 etoxocty1lmDe nvo;s)s2um(o oy4altelivils)s2um( o;o0oeen fetldfa rl( p u)tlerxoctadlptraivi s)s2tmxm ou4ape  feta()a2trump;u0ole  o3tatlaDum(mo (4altoxrcoodfmDe n s t0setmir iudlpeelivslt arta(  ou4tetnmf3ildls eau ont4 eenircoatfptr nvo s0tetr(m oudam nmncsat  rrr(m no4aeen fetldfmDelums u)arxomr oodoaDr ies;()s2uoxm3nu1lp e fvi tf rra( oot1tpenmi3iltla2el( o;()alenifcoadfpteli i () 2xmxo3iy1lpe livi () 2urxmont1olto ieiytfs ulumo;() rxnxf tatoaDe nvo;(0texrxmpio1lpt lnciatfs2tr( p;t4apto ictysfmDrmu pnu4 ltoifctytfptr n sl( srumxm3ny4omen fvsls) rurxr ot4aex iicils m2el(vonu0 renio3oodlmDraivs (0s2tr(o oodop e fesl(  2rmum ou0opxomf3tldlaDrmnms (0arerir3oatlmteaieil(0teto(m ou4amtnlivils  rur(  no4alxoii3tls aDrmn onu4 exrmo3tytlmD luvs () 2xm(r3nu1lm elict ()srua(rp;u0olt mieiytlaDem(vpnu4tltrmo ia1omDe nesl(0t2trir3oy4am elicta( srtrxrooo0texomictlsfsDrauvs;u)trenxf iodfmt  n s s)trxo(o ou1olt  fet (f Dtmu  nu4tpxn ociasfm uaump u4tlxrxocty1lpDean slt0 2trir io4om e ivils s2ra(roou0opx mo3iysla ua(vp u4arxrmociotfmtr ueo;t t2xrio io1apte ivslsfsrrrxmpno0altn o3ild s ra( s;t0arxomf3oa1la   nesls0s2xoxm no4ol nmici sfsrtrxm nu0alxo o3iadfm ul(vo u) lxoxfcio1omD an o;( srxrxr ny4lptnlfci s)sDraumo;t1aeenmf3tytfs2rlu p u0trermo iadomDeaues;()truoimpiodale mfct () rrru  nu0tpxoio3ildfa uanmo;u4 rtrmr3iotla  lnvslt  exo(opiudapenlncta( a2rrxrono0ope ifetadlm2ulnmo t)texrirciadomDeaneo t  ruoirpiy1lp n ies t arrrxm ot1oetomo3tydfmDemnmon(0trenxf3ia1oa r ueslt0 rxoir oydal nlncta(fsrumxmono0apeo icilsls2ua(mp;()texoxr3oodom e uei s)truo(m iodalenlnes tf Duau p;o4teenii3iatfmDrl(von(4 ltnifciytopteliesls trxm(mpoy1aptnmivt sfartru ono0oexo octaslmDuluvsnu0 etrxf iytfpteaneol(  rtoiopnudoleemnctl(faDur(m ;o1alt mfeiytlsDulumo t0tlxoxr oadopDrauvi t  etr(mpiudlleemieta() 2tmxm ;o0opxnmi3tyslmDrlnvp t0 eeomr iotfat  ivo t0srtmxo3nu1lmtn nvi s) 2urxm ot4optnmoetadls2rm(mon()altomo3oadfat lnvs;s0trxr(o3no1aptelfcs t)aDrm(  oo1tpt  fetyt m ra(msn(4 lxnxfcoatomt  nei;t texmxo3oy4ol  mictlt) 2rrxroot0opx  i3iadla2ea(mp t0tlerif3tatopt lu il(  rtrirpno4om  lfvilt)aDrmxrp;u1oeeo i3tad s emu s;u0tltoxr ootop   iei;t0tetmim io1ll elncsls s2taxroot0altn iciatfmDemumo ()areoxf ootom r u sl(0sexm(m nodomeelivtlt) Duaxm nu0opxomf3tadfsDranmonu4 eerxf oadfmteauesls truoxm iu4lpeelnei t) Dtmx o;u0optomi3iatla2rmuvo;(0artnmr3iy1oa e nes s0teuo(o3ny1lptnlies sfaDuru o;o4optomo3iaslm2ulums u) eeoirctytlmteanes t)t2toimpnu1amte ieia( s2rmxrooo4tpenifeiys m emuvon(0texnxo ootfm elnvi s0seur(r ou1lpen nvta() Dtax  no4optnio3ild a2emums;u4 renmf tatomDeln o t s2umxo oy4altn iviatfs2rrur nt0oetnmo3iyt a2el(mo ()arxomr iy1la  lu ols s2xrim3nudll  mfvtlt) 2um(  nu0ope  octysfa umumonu) lxnirciatfmD  uvol(0 2ur(rpiu1omen fcil( s2taur ou1alxnioeiydfm2em(vs t4altrio ta1fmtr uvi t seto(mpoy4omt lncsls arraumpoo0opto fcilslm elnvp t0trxniociotlat lu o t)t2urxmpnodlle lnvil()arum(ront1aex  octysfaDemu s;(4tlenmo todfp e neo;s)s2tmxr3oudlmtemivt s aDta( pno4opt mi3iydfa rluvpn(4 exnxr tydoa eluvs s)tetrim3iu4olenmnci t a2umur ou1openmfeiydls ulump;t4arenxr3oydop   iei s) etrir3oudlm n ieta()aDtmu o;u0alt  i3ils sDemuvsnu0texoifcoo1fp r ivol() rur(r ou4amtnmiei s arrmxr ;u1tpxnmi3tltfm el( pnu4 etoxocoo1fpDe neils setrir nu4apeelfci ( a2tr(mont0apx mietlsfa emu o t)trxoxr oodlaD  ieil(0 eurxm oo4lpt  neia(  Dtrxmpoo4tltoioetltls emu o;t0treoir3tatfptrli ilt0tetmxr3no4aleemnesat)aDrr(mo;u4openiociadfa rauvs u) ltnxf to1fatelivilt0 rxmxm3ny4op emicsat) Dua( o;o0apt iieiysla2rln p (4 rxoio iy1opDrluvs;()texrxo iu1ap  mneiasfaDrrxr ot0oexnmiciyt aDeaumpn() etoxo iadoatrlieils)t2xrim3iu1om elnetlt)s2umxrpnt0tee iociltfmDelump;u0 exrmr3to1omtelnvil()trtoxr3iu1opt lies t)aruaumont0oltn fetasfm2ulump t)alenmrciydfaDranei s)srurim oudopee fctas arta(m ou0tet  fciyslm emn o;t0 rxriociytfmDe u i ()srxoxrpoy4lpee ivil()a2tau  no1opt if3iydfa2ea(mpn(0 lenir tatfmt  neol(0s2trxrpnu4al nmivi ( sDurum ;o1oet ioeiytlm rm(mpnu4tlxrio tydop  lnes t0srxmxmpio4lp nlnvtas)srtaxrpoo1apeomietadfs um(vp (4tlerxo3oodlmtr neo s0t2urxmpnudam  liciasfa2um( p;t1oltnmfctadls uau p t0 leoxr iatoaD  ueol( srumxo oo1omtnmnes (fs2trx  nu1oet ifetytfa um( o (4 renmo tatla  livilt)s2uo(r3nu4lltnmieta()sDrmxrpno0opt io3iat a ea(mp;t)aetoxo ia1fmt anvs;t0 2xm(r3nudaltn fvilt aDuaxrpoo4aetoifetlsfmDrl(mp (4trxrmo3iy1fmD lnei;s) rxmir nu4ll elnvs s sDrr(moou0aet iietydlsDemuvo t0texnxf3to1op  luvi;t)srurxm iy1lptemfvsls)a2umxrpnu0oexnmo3tadlm2rlnvp u4tetrmo3io1late n i;(0s2uoio3iy1lle mfet tfsrurx pnt0teen i3tytls2emu snt4 leomo ta1omDranvs;t)teurim3iydomen ncia( a2trxrpnt0aptoioctltfmDua( snu) lxnxr to1oa r ueo t t2uo(m no1aptemfvt t)aDtmurpot4tpeomociat mDem( p (0tlxnmfcta1fm ranvs;s)srum(o iodamen nvsa( arur(rpnu4opx micilt sDrmu p;t4texnmo tadfaDeaivo;t0setmxm ny1oleelnvilt s2tm(r ;u0teeoii3iysfm2rmnmonu0arenxf3io1lmteln i;t0texoiopio4al emieia(faDurumoou0apxoiiciydla2rl(vs;u)altoio ty1lptr i slt0 eumir3nu4aptnmfes s artm(m no4aexnmoetldlaDem(mo;u) eeniocto1faD auei s)tetmirpiudlpenmnet tfsDuaxmont0alxnmiciyt a2ul(vs (4altnxfcoadfp   i ol(  etoir3oo4aptnlfctl() Dra(r ;t1optnifciyt m umnvo;t) eeoxo3oydoaDe ieo (0 2xrxm3io1lme mfvsa() 2trurpot4oltomi3iydla2rm(ms (0tetoif iytoaDeai sl(0t2toim no1lpeemfvsas)srurxmpno4tetnioeiatlmDulnmo;u)trxnmoctydlmDe uei;t0sexoio3iydllte fcs sfsDrm(ro;u1olenmfciyd s uanmp t4 ltnio tatfmDeaueil( trxoxopnu1apen icil( srraumpnu1optnmieias m eanvp;t0artrir totom  aivils0seuo(r3ny1amenmneiat) rtaum ;u1apt mf3iadlm uau s;t0 eermocta1laD ln ols0 rxrxr3nodlp  mivi ()sruaxr ;u4aeenmfciyt m2rmu s t4 rtrxrciadfptraneols0 rtr(opoy4op elfvt s) Dumum no1alx ioetytfaDeln p;(4arxrxrcoa1oatrlueo;t  exrim3nudopenlncilsf rrrum ;t4aleomoeiaslaDranvs;(0trerir tadlpDrluvs;s) rtmxmpoydamte feias)a2urxmooo4tlxnmfciasfs rmuvp;t0trenmf oytopte nes;() 2xrir iodape mfcilsfsrta(mpou1texoiictls a2rmuvs;t4artrmo3iy1fp  aivsl()sexm(opiodlpe lncias arum( o;t1oeenioeiyd sDra( p;() reoircoytomtrauvi;s0 2um(opno4ap nmnct t  rurumo;u0opxoioetytla2rlnvs t) etnifcoo1opDeliesls  2xr(m nu1aptelnct sfarrrumpoo4tpxnmo3tldla em(vo;t0 etrmr oatlpD aueo ()trur(rpou1aptnmfcs tfaDumumont4alxnioeilt s2em( sn() renmf tytomteai o ()s2xmxmpnudal   ictltfarrrump;o4aeeoif3tydfmDea(mo;()artnxrcio1fptr uvi s)t2trxm3iy1am e ici t sDuaxmpnt1oltnii3tltlsDua(mo t4alxnircty1omDe uvo t)srtrio3iydlpt lfeslt)arumxrp;t0tltn oeiysla ran snt0 rxrxr ty1oaD  n i t trum(o iu4ap n iet (f Dtaxrp;t1tpt iietadlaDuluvs (0trxnmociytopt ai o (0trxriopiy4lptn ivt (f rtaxr ot1ale  ieiltfa2elnvs t0treoio ty1faDe ieo s)setoxm3oudopeemietas srrmumpou1tlt mietatla umu s (0tltnxfctatlatrlueils0srumxopou1apenlfeslt sDra(  oo1tptnmicildfmDrm(msnt0teeomrcoytlptr u o;(0 2ur(r3iu1om nmncsa(  Draumono4tlto iciydls rl(vpn(0trxnmr iodlaDrlies s t2triopoydlp e feils srrm( oou1apenio3iatlsDuau s t)trxoxf iytlat aneo s  2uo(mpnudll elnvilsfarraxro;o0aexomfeiltla ra( on(0 etnmr tydfp rli o;t0 2xoxr oo1omee neta()sDtmx oou4aeenmieiydfs ranms;(4teeomo ta1lmDrauvo s0s2xo(opnydom nlfvia()aDurump;o1tltomoetldfm2ulums u)tlenifcoatoa eau i;t0 rxm(r3ou1omen ieias) 2taxroou1tptn oeiltfa eaumsnt4 lxnxr3totlpD luei;s s2xoxr iudlp elicsls) Dtmxm no4optoii3tltls2uln s;() eenir oadfa rlnvi;t) 2urxo3oo4omeelivslt srra(  no1tetn oeiyd a rl(vonu0 eenmf3iy1optrliei ()trxr(r oo4altelfesas)s2rax pnt1texnifeilt m2ra(monu0 etnxo ty1lm e n s s srurxm oo4amtnlfvt t arrru pot0aee  f3iys mDranvonu0tetoxrcty1opDraivsls) 2umir3iu4omee ncs (fsrrmumooo1oleoioeildlsDrm(vpnu)tlerxf3oadoa eauei;t  exoim3nu1lmtelietas aDtmum nu0tpenifetldfm emu pnt) lxrio oydlmtraneil()t2xoxo nydope  fvsls  rtr(ront0oeen fctytlm2ran pnu0altoxrciodoatr ieo;s)s2uoio3oy4lpee fcslsfarrmx  nt4tle ifctatlsDea(ms;u)aetrxrcoodlpteaivsl(  2xmio oy4lp nmfvt s) 2ua(  nt4tlt  fctaslmDea(ms u4trenmr3iotlpDr neslt sexrxo oodom n net () Dtmuro;o4aptnmoctlsfs2eauvs u0alermr oydla ranvs (  etoxm oy1lmen ict tfsrrmu pot4tlx io3tatfa rl(mpn(0aetrmr iodomD lues ()srumxo oy4ale  neta( a2ua(  no1oltnmietydlmDuauvo;(4 rxnxrciadfatrlivsls0 2toxrpno4omtelnetls)arrmumo;u4tlxoiiciyslm eluvo u)aleoxr3ta1faDean i;s)s2xr(m3ny1lptn fcsls)artaur oo1oexomociltfmDrl( s;u)tetnmr3ty1la  auvs;s0 euoxo3oydolte nvs (  2ra(r ou1tlxnioetadls rauvonu4areoir tatom ranvo (0t2xmirpoydolenmfviltfaDumum ;t0tpxniictytfs2emnvs;t4alxrifcty1oaDeanei (0sexo(m3iudll e ics s sDta(m nu4olxn icils aDua( onu) rtnxf3oadfaDrlnvol()setoim3iy1alt mfeias srrmx ono4alx iietlslaDelnvp () exoxo3oydfpte i s (0s2xr(m nodap  lieta(fsrurxr ;o4apxomo3tls a elu p u0tetoir3oo1fateaies;s s2toxr3oo1lp  lfeilsfa2urum ;t0tpenif3iydls rm( s;(4areniocia1opt  ues;() rtm(r3ny1ol elnesa( sDrau  ;o4altnmo3iatlaDum(mp;u4 etoxo3iotfaDrauvi;s0tetrim iy4llt  ivs (  Drmx pou0altomo3iaslm ul( sn(4trxomr3ty1fp  ai ilt0seto(mpnudom  lfei t) rtru  nu4tlenmo3tat mDelu o u4aleomo3todoateau slt texm(mpiu4lptelivi sfaDra(rono4tptnmieiatlmDelnmp;u)treoxf3oodfmDe n olt0 etm(mpnu1lptnlfes (fsrtrx o;t1tlx  ieiyd a em( ont) etrmf io1fp  auei s setmxm ou4altemnesas a2trxmpot4tetomoeildla2eluvs;t4teermo oadoptraies;t sruoxo nu1openmnetas)srra( ont4aexo i3ias sDuluvp;t4alenio3ootfaD  ueo t0sexmxr ny1al n ncilt sruauroot4tlto i3iltls2rau pnu0alxniociadopD luesl()s2tmio iu1ol nlfct (  2ua(  ;o4tlxo iciytfsDean p t0alxoifctodfp r nvi;t0t2uoxm io4om nlieil( a2trxmo;u0tleomieiytla rmnmo;t0 etnmfciydlm raiei t)trtmxm oo1oltelfcta(fsrrru oot4opt mf3iadfsDran snt)treoxr iotlaDelueols tetoxo nodlle  iesasfsrrmxmonu4ape ifctasfa emumsnt) exrif3oy1fmDelieilt  rxm(r3oo4opee icsas srrr( oou4aet mi3iltla uaums;t)teenmf tytlp raieol( trur(opiy4al nmnesa(fa2tmxmo;u1aexo ictatfs2emump u) rxnmfcio1lmD anvsls)trxmim3nydlp emivilsfa2rax ono0aptoif3iadfs2ranvo t4artomo ia1la r ueolt t2um(rpoodape lnvt tfsDtaumpot4oetoif3tls m rauvp;t0trtnxo tadfp rlies;s0 etr(o oy1oltnmfci ()a2tr(rpnt1alt ii3iyd m emu s;u0texoxf iatomDeauvi s0 rurir iu1alenlicslsfaDra(mpot4altoiicildlmDuanms;u)teenio3tydlaDrlues;()teuoxrpoo1al   fvt ( srta(mo;o1openifeiyd aDemuvo t0arenxociodlpD  ieo;( t2um(r3no1op emictls)aruaumpnu0tle  ieiysfa2ulu p t4 rtnmf oytfpt aues s) 2xrxr3iodop e ivtlsf 2rmxm ;o0alx  i3iyd m ra(mp;u)aexomo3iydfa   ivs s)s2uoxm3oydlptn ieiltfsDum(moot4oleoifctas s umn s;u)artrmf3iytfm e n ols0 etm(m iy1amt lfes ( artm(  nu1tpxomieiadlaDrm(vs u)tlxrmf3todopDrlnvsls)trxoxr oydlmtnmietatfaDurxmpoo0alxn ociyd s rl(ms;(0 rtoxocoodlat lu i;t s2xmxopnu1ap   feils)s2rmu  no1tetn fciyslm2eanvs u0artrmr oydfmD lu o;s0 2toxm3ny1lmen fcsa( arraxrpnt4alxn ietys aDem(vs t) eeomf oodfpte uvolt  etoxm nodome  ict s a2rr(m no4tle mfetltfaDulu on(4aeerxr io1oa  li o;(  2xm(mpoy4ll elnci tfsDta(  ot4tptnmoetlsfaDemuvs t4teeoxrctydop eaieslt)t2xoxm nodlp  mnvt (fartaumpoo4oexnioeiytlaDuanvonu)altoiocoytfmDe ues;(0texo(m iydap emnet sfa2ta( poo0tpen iciatfm rmu s (4artomf3iatfm elu i;()s2xm(m3oy1am elfesat)srtm(mono4oexnmo3ild s ea(ms u4aetnmo oa1op r neil( t2ur(rpnydom n fctas)arrr(mo;o1oeenmociysls rlump u0aeenifcoydlaDe nesls)texrxm3ou1apt  neiat)s2rm(m ;o0tex  feild s ranvp (4trtomo iydfmteauesl(0trxr(r3no1altnlfet ( sDrr(rpnt0oee mf3tlsfsDea(mp;u4areoxf3oadoaDrln s ( t2urimpio4al nlfcsas  rra(mp;o1oetomoctlsfm2uau o;u0trenmf iydlaDean i;t)setrxo iydam nlictl(f 2taxr nu1aeenif3ildlm eluvo (4 rtnmr3oa1fpt  ivolt0 exoxmpiodlmt miei s) 2uaum ;t1aleoif3iytfm2ua(vp;(4areomo tydfm e u o;t0teurxmpiodom emictat  2rruro;u4tltoiociatlsDua(mon()tlxoxo tadfpDrliei;s0 etr(r3oydal emfesatfa2rr(rp;u4oleomicias a emump (4aetrir oodlmtrau s (0s2trim ny4am emnesa(faDtm(mooo0apxo oetls aDemn ont0tetrio3ia1fmD  n ol(  rxm(m3iy1apt  iesat  Dtrxrono4optoioetaslm2rl(vsnt4 etnxfcoadlpt aivs s0srurirpnu1ap  mfesl()aDrm(  ;o4tpxo i3tltlaDem(mo t0tetnmfcoodopD lu sls trxo(o iu1opteliet s) Drrxmo;u4tpt if3iyd a2rlums;u4aexnmrcoydfaDe u o s s2toio3no4aptnlnct tfaDumxmp;u1olxnioetldlsDemnmonu0treoxf tydlm   uvs;(0 2uoxm3nydoltnmnvs tfsDurxm no1tlx mo3iltlm2em(vpn(0tltrxr iadlmteai o t)texrio3oodalt  ictltf Dum(  ot1alx mfctlt s2rm(vpnu4 lxoif tadfp eanvo s) 2xm(rpny4ol  lfcil(fsDtru  ot1texomo3ilslmDuanvpnt4tlerxf oytoa   u o t) 2uoxm3nu4ome lnvs s)aDtax p;t0oeeomfciaslsDemuvs;u) etoir io1om  ln s;s seurir iodalenmfvtat)s2urxmono4tpen ieiysla umumo u0alxrxo oa1oa elu o;s  2tr(m nydom emfvils aDtmx  ou1oee mfetat m2rlnvs;u4 ltnxo oa1lpD ai i;s sexoxo3ny1ll  lfcia(fartmxm ;t1optoifeilsfa rl(mp;u0tlxnxr3iytfp rluvi;s)trto(m nu4apen ieiat sDtax  ;o0oltniietaslm ulnvo t0 rerxr3oy1lpDrau ils srtrim3oy1omtnliet t)a2rmumo;o4ole ifciys s um( p t) lxomo3tydfmtelivols setoxm3no4lmeemfcsasfs2urump;t4tleomiciaslm ean onu4alxniociatlm r nei t0 exoxm3io4lm  livtat) rtrxmpou4tlxnmi3iatfsDrmump;u0 etrmf oatoa  aieol(  rxr(opoydol  mfvils) rumxrpnt0oleo o3ildls2uanmp;(4tleoxocto1oaDe ivsl( sexoir nudlltelfctls  Dua(mooo1oex ifetytlaDemu p (4alerio3tydfp  lu s t0t2xmir3nodlpt  iciltfsrtmxroou0tet if3iadfs2rlump t)tetoxocoo1fa  lu s (  2tm(o nodal   nct tfs2taxm ;u0oeenifcils a rmnvsnt)alxrxociy1lp e uvs;s)tetoir3iudlmt mnctls)aDua(  nt4olt miciasla2umn pnt)aleomf3oodfmDranvi t) 2uoim io1ameemneiatfaDrrumpno1apx  ociad sDulu s;t)tlenir to1lmtrliei;(0srxoxo3oy4omenlictat aDrrx o;u0olxoiictadfa2uaums u)trxnif iadlp rlu s t0s2uo(o3iy4op emietas)s2uax oot0tltn feiytls2rluvs t0texrioctadomDrliei;t0srtrxm ny4apt lies t)artr(  no4tptoifciatlm2raump t) ltoir ty1fmt liei ( sruoxrpoy1lle lfvtl()a2taur ;u4opxn ieiytfa elnms (4alenmr3oa1fpt luvi () rxoxo nu4lpt  ivta()srtrx p;o4oeen ocildfs elnvo t)altnmo3iadlate ueo;t0sexrxmpoudole lfeia() rtrumooo4opt mi3tys m ulu p u0 eermoctodoaDelivi;() rtr(m3nu4al   nes (fs2rrxmont0teto ieiyd a elnvpnt4 rxrmoctytop eluesl()t2xrir iodal emivtatfarum(root4opto o3iatfa ul(vo t0alxnmoctydoate ivs ( s2uriopnodlpe lieil()srrrur no1ale  ieiadlmDea(msnt0aeenxf oodfp r n s t teurxr3oydal emnctas)arta(m ;u4tleo feias mDrlnmpnt)tlxoir3oytfa   ivil(0setoxr3oy1amen net t artrxro;u4optnii3iysfm2rmnmp u0trxomf to1fpDe iesls  etoxrpiu4lltemivslsf Durxroot4olxnmo3iad s2rmums (4tltrmo3iytfpt ln o;s0trtr(m nu4apee iesa()sDrr(m ;t4opxoiocildlmDra(mo () lenio ootlpt  nvi t0s2uoirpnydaleemivsat)a2rau  oo0teto octad a2eau s (4 lxoifciydoa e u il(  etrimpnu4altnlfvtls  Drau pnt4texomietytfs2ea(vsnt0tetrircto1opD aues ( teurxr ny4lpenlfcilt)aDur(ront1tpxomfctad a rm(vs ()arxrxf oodomD  neo t0trurim iydll elietlt) 2tmum ;t0tpe moeiatls2rmnmsnu0tltrxfciytfa  anei () 2xmxo3ou1am  mivsatfs2raxm nt0tpen o3iltla ran o;(0 eeoxf iodlm eanvo t)trur(mpoo1lpeelfvt sfsrtauront0altoifctytlsDrmu o;t0aexnir3oatlptean olt) 2xr(mpiy1op  lncs t  rrm(  ;o1tlen o3iytfa umn o;u0 rxnxf tatopDelnvils) rurxo3oudopenmnetat) 2raumpnt4tpen f3ias aDemu o (0 ltnifcoytfa eln ils) rtoim nu4apen fvi t)sDtrx  nt1oexomieiydla um(vpn(4 lxrio3oa1lmteanvo s)t2tmir3nudlpeelfciltfsrum(  no4olxn fctadfmDumuvp t)teeomr oadlpt  i s () etrxr3iydalt lncs (f Dtaum ;u0tpt  iciltlsDem( o (4tetnxf3ootoa r ueslt srur(o3io1olenlnet ()sDrmxro;u1aetn i3ild s2um(vo;t) ltrxo3ta1om   ues s)teto(o nydlmee nci ( aDrrum ;u1altomoetld aDulumon(4alxnmrcootopD luvol( sexmirpnodoptelfcsa(f Duaxmp;u4tpxnmietltlaDrau s (0artrxoctodop ran ol( s2urxm3iy4lleelicslt) 2ta(ro;u0teto ictasls2uan o t4altrio oodopt  uvs;( t2urirpiydop nliesas sDua(rp;t0oex  feiatlm eanvo (0 rxrxo ta1op   nvo;(0texmio3ou1am  mfvi s  Dtru o;o4tlxo ietldlm2ran p;(0texnmfcoo1omtrluei t)seuoim io4amte feil(fa2trxm ot1ale miciyd sDrl( s u4texoxo3oytfmDrlues;s)sruo(m oo1lpt miciat a2ua(m no1apto o3iatfm2rmn o u)artrmrcootopDrln o;(0t2tr(o nudole  nvilt  Duax o;t0ole mfciyd m ran ont4treoif3ia1oaDrau i (0texo(r nu4ome lfciat)srrmumont1aptn oeiydlsDrl(msnu4 rxrxr ta1omtranvi t)t2xrxm3oy4al nlnvs t  rurxrp;o0apxoifetlsfaDua(mon()trtrxo iotoaD lnvslt)tetm(o3oo4om nmfetlsf 2tax pno1apenifcildls2umuvpn(0trxoir oatlaD lnvo;() 2trxopou4olt lneil()arrm( oot1alto fciytlmDua(mo () renxocto1fa eluvi;()t2tm(o3ou4ap   nctls)a2umum ot4tpxoio3iatfsDelums u) exnio3todfpDr ueo;t trumxopiudlm emnvtls)srrmxr ;u0tltoifcias a em(mp () exoir oytfa elnvol()truoirpiu1olenmfcs sfsDtr(rpnu1tpt  i3iatfaDrm(mp u4texrxfcia1lp r ivo s) 2toxrpiodome  fcilt  rtaxrpnt1tleomf3iasfs ulnvs;u4alxomo ia1fp rauvi s teumiopiu4ameemfei ( sDtm(r ;o0aexoiiciadls2ra( p u4 exnir3oodlp  aueo;(0 2um(r oo1alenmict s aDtm(r ;t4tetomf3iatfa elu s;()artrmrcta1lptrlueslt0teuo(mpoy4llen nvia( artr( o;u4altomociatfa raump;()tlxnxf iodlpDrlivi;s0sexoir ny1amenlfetas sDum(m ;t4olx  i3ildls umuvs u) lxomo tatfp elu ilt)t2xm(m ny1am nlicsa()s2tmu ont4tptnmf3ild s2uluvo u4artnio3ootlm   neol()t2tr(o nu1ol n ieta(fsDrax pou0tlxomoctltfsDeau snt4trtoir oydopD aiei ()trtoio3iudopenmivt (fa2urx pou1ole mieiasfs2emnmont4 rerirciadfmtrln o s0t2toxo3iudomeemiesatfaDua(r ;t4opt mi3iydlsDua( s;u0 reoxf to1opDraneo;t tetrxr no4oleelnviasfa2tm(rpoo0ale  o3tyd m umu s u) lxoxf3iodlpDeauvi;s)trtoiopio1lp e ictlt srumx  ;o1oeeomieils m ulnmsnt0texrmfciodfmt  iei;t0s2tmxo iodlp elfesatfaDrrxrooo0teeo fetytfs ranmp u0treoxf3oodlatraiesls)srto(rpiodamenmicslt  2tr( pot1oexomoeilslmDua(vpnu4trxrir3oy1optran o s t2toxo3io4ll  lnvs t srrm( o;o4aexoiictat sDemuvon(0 exrxf3iatfpte n o;(0srurxmpnu1ap nmics (farrr(  ou0apt io3iyt mDeln s u0tltrio io1lp  aivi s  2xr(m ou4alenlieilsfaDraum nt4alxnifeiadlmDuanvo;() reriociadfp rln ols) 2xmxm oy4om e feils  2uaxmono0oet moctys s2um(ms (4tetnxo3oy1lmD  ivilt)texmxo io4op   fesas sruru p;t1opeoioeiysfaDelnmp;(0tlerxr3ootfm r ivs;t)srxoxr io4alte ietas) Durxr ;u4aleoii3iyd a umu p;u0trxrmrctytomDelneil()s2tmxrpoodap   ictas  rrmur nt1apx mo3iaslmDraumsn(0altnmf iytomDeln slt0srtoir3io4ll  licia()artmu pno0optomociltfsDraums t)aexomocootlptrai s;s0 rumxm nodom  mfcsas)arum( p;u4olenmiciat sDraums;u4tleomocoadfat livo t  eur(r3oy1ll e ivtl() rtm( p;o0ale  oetlsfm rlnmp ()tltnif3oy1fmDeanesl(0trto(o iudamtelncslt)a2raxm ou1oltoifeiadfm2uau pnt) rtrxr3iatopDraneslt)trxmirpnu4ole licsls aDtm( ono0oleomieiltla2emu o u0 rxnioctatla  liei;(  2xo(m oy4apenlfeiltfsDrm(monu0tetomieiatfa2ulump;(4tlxrmrcootfmDe uvo s)sexo(r3no4al elfvi sf 2ta(ro;t4opx moctyslm emnmo ()trxnmfcty1lpt  ies t t2xr(o3ou1op e ict t)srtaumpoo4texomieiydlmDrluvs;t) etomr to1fmte ueo;()trxrxrpiodal  lfvsatfsDurum ;t1tpt mietyt sDeauvo;t)tlxomrciotfmte nes;t)s2um(m3iy4openmfetas)srtmuro;o1tle  o3tat s emuvo t)areomr3totlm e n i;s)srurio3nudlmt mfet (  2umu oot0tpe  feiyd s2uanmp;t4 leoxocto1fmDraies;t s2xm(rpoy1op nmfct t s2ur(  ;u4aexoioetatlm2ea(ms;t4artrifctytoptelnvo s srxmiopiydol emncil(fs2rr(rpou4oltnio3iasfmDrl(mo;t4 exnifcoydopt  nvs;s0t2xmio oy4om nlfcsa(f Drax pnt0tee  fciytlaDemumpnu4texrir3ootop r i i;s0seumxm iu4ole mfvil() 2taurpno1oleomieiytfsDemnmsnu)aleoio3ia1opteaueo;s)s2umxm3nudoltelnetl() 2uru pnu1aex mf3tadfaDel( o;u)arenmocoodlaD aieols) rtoim ou1ll emivsa(fs2ur(mpnu1tex mf3tyd mDelnvsnu) lxnxo ty1fptrlu i s  etmio ny1apeelfctl(  Dtrx oot4aexoii3tatls2ua(vs;u0alenxfcoa1fatraueolt)tetoxopio4opee fvt tfsDtmxmpot4olx iociatfmDea(mon(4 leoxf todlmDean il()trurxopiudal  mictl(  Dumumonu1aetnifcildls2uluvon()tetnmf3tydlp rluvsl(0trxmxr iy1ale mivi s)aDua(mo;u1tpeo ociad s2elu s;t0treomr iodlat lueo;(  exoxr oydope  icia( arrru p;t4tpt mf3iatfs2umu s;t0altrif3tadfa   i i;t0 eurxopnodlpenlieils aDuaxrpno0tpx iietat a2ulu pn()tlenmr3tadop eluvi;(0tetoxm3iydame livs ()sruau o;u0teto ociyd m eauvp;u0tetoxf3iydomtr ivo;(0s2xmiopny1al   iet (fsDtmum ou4aptoifctatfaDeln o;t0aetnir3to1lptrau i;()t2xrir io4om n ivt ()a2raur ;o4tetoioetyslm2um(vsn(4 ltoifctytfa eluvo s  rtm(m ny4ol   fvtat a2raxro;o4oeeo ieils s uanvsn()tltrmr3iy1faD an ol()sexmir oydomee ivia(fsrrrx  ou4tee if3iydla2eanms t4alxnxocoy1op e nvs;s  rxoirpiydalt mfcil( s2tm(mo;u4tetoiiciasla2elnvp;()tltnif iotomDeau ils0trum(o3oo4alt mivs s)sDrmx pou1apen oetldlsDea(vo;t)artomr io1lmt lieo;t) 2urio3oodlpt mnvslsf rrau pnu1tleo oeildla emnmp t0trtoio oytlmDelnvils)texmxr iu1lpeeliesl()aDtaxmo;u0oeto feiasfm uln on() lenmf tydlmt aneo;t0setr(opio4ll emnetat a2tmum ou4apen oeiltfaDea(mo t4areoifciytlmt aueilt0t2xmxr iydapeelfvsat  rraumo;t0apeomf3iys m2rln s;u4alenmo3to1laD  ieo;s srtr(mpnydlp nmivtas srra(r ou0opx mi3iysfsDua(mpnu4 eeriocio1lptran s t)t2toirpoy1opt mfei s) rtmu ono1altoiieils m ul( o;u4tlxnmo oa1lmt livilt)srxmir oy4llen nesl() Dua( o;u4texn iciaslsDeanvo t) lxomfcia1opD  nvils0trurxo3oudlltelnvsas a2rmump;o1alt iiciadls2uau snt)treoif iodoaD luvo;() rxoxopnudom nmivsas arrau  ;o0tee ioeilsfa2rlums u4trxoio io1fpDrliei s0s2xm(opiodlm  miet t)s2rrxmo;o4aptnif3iydls2rmump;t)trxrxfciydoa r ieo;t)trxmim3io1lmte fvi (  Dtrxrp;u4olt  o3ildlm2rmumpn(0tlenxf3tytomteaueslt)t2ur(o3iy1lme lfetlt srtmxrp;u0oee ioetltls2rm( p;(0texnmo3iadopDe nvolt0s2um(m nu4aptnmneia() Dtmx p;o4tpe mi3iytfmDea( sn(4texnxo oatom e i sls0 2toxr iu4lme mnci s  2tmum ;o0open iciyt sDeauvs () rtomr3iytoa r nvil()t2uoio3ou4amtelnvtlt  Dur(rpnt1apxomfciydlsDean ont4alxrxrctadom   n s;t) 2umio3iy4aptn ncil(f 2umu  ;o1tpxomictltlaDuanmp;(4arxomf3oo1oa  auvol(  eumio3ou4apeelnvi sfaDrr(ro;u0oetoiociadfs rm(vs t)artnmo3oo1fm r nvol() 2tm(r3nydop nmfvs () 2rmu o;t0oeenio3tydfm2uanvo u) rtnirciatla r nvo t teuriopnydll  lnvi s s2umxmono1alxomictadfm2uluvo t0aeenif3ta1omD  n s ()trxmimpio1lmeemiesl(  rumxmp;u4alenmietyt m uauvs;t0altnxo oadlmt  n i (0s2toir ny4alenlivslt sruru o;t0aex ifctatlmDulnvp t4 exomociy1opDe n i s  etmxr oodlp elies s  2umxmpoo1open o3tasfs2um( o;()aeeomfcoytfm e n o t truriopnodlmt lnvilt s2tmxrono1alt io3iasls ea(ms;(0aetoif oy1lmD li olt sexm(r oy1ape  icslsfs2rmu p;t4tet  fctlt a rlu ont4 ltnmf iadlmD lueo;s sexoir ou1ameelfvsl(f Dra(r no0olxnmf3tad m elu o u0aexnmo3ootom rauvo s0texrirpnu4al n neils) ruau  ;t0texniociyt a rlu s u0arerxo iy1fpteauvols0s2xoxm3nu1lltnmfesl(fsrrm(moou1texomf3iyd mDulnmo (4alxrmrcta1lm raieilt0trxm(o3nydlm   fcta( a2taxrpoo4tpt ii3tatfa ranvs t)tlerxr3to1op elivilt srxrim iodop  lfvsltf 2uaum nt0oexomfeiasfsDrm( snu4 ltoxf3ia1lmDeln olt) rxoir nodlp nlietlsfarrm(monu1apenifciyd a rau o;(4 exoxo3ta1faDraivsls0sruoio ou4lptnmnes t)s2umur ot1apen f3iytfa uluvp;()trtrxo iotfpte uvi t)sexm(mpou4al emivt s)sDtr(  ot1apxnmoeils aDrl(vs (0aetoxfcoo1fatelivols0srurir3iudome lies (fsDtruront4tpxo ociytlmDrmumo;u)artnxf3tadom  aivi;t  2ur(m oo4ope mnct (  2urum no1aex  i3iyd mDuan onu)texnmrcoadla r i s ()sexmirpny1om  lnci tf Duax poo1ale  fetysfa rln p (4arxrio oo1la   uvo;t0t2uoio nydolen ivsls  Dum( pnt0altniieiltlsDelnmp;t0 leomo iodfptean sls setmxo ny4ol  mfet t sDrrxr ou1altn feiytfs2uanvsnt) etnmo3oy1om elnvo;t s2trxo iy4ameelfes s  Drrx  oo1opx ioctlsfm elu on(4 lxnxrcio1la  luvsl()teumir oy1op nlnci sfaDtau pnt1opxnmi3tadls um(vpnt)trerir ia1omtrlu sls0t2xoiopnydlp emnviasfa2trxr oo4apeniietls s2rluvpn() eeomo3tytlmDr ues (0 eur(m3oydapen iet s arrm( poo1aee ifeilslsDrmu o t)trxoif3oadfmt auvsls0 rum(mpoy4llte nesat  2tmu  ot4olx ifetlsla2ra(mont)tlenirctotfmDeaivi;( tetrimpio1opeemncsat)srtm(mpoo4aet  f3tydfa ulnmsnu0trtrio iotoaDe u i s) 2xmir oudoltemnetltfsDrmump;o1ale ii3iatls elnmp (4aexnir3oy1opteln o;(0teur(m3iy4lpeeliesatfsrurxmpnt0tpenio3iadfm uln p;u0alxrir to1lmtelivsls0 rtmir nudol elfvslt)arraumpnu1aet io3ildfm uau o;u) rtnxo oo1oatr ivols0t2urxr3ny1al emiesas)s2rmx o;t0tptn ociasfa2uanmont0tlxoiociotopt ln s;t trxrxrpoo4amen fviltfaDrru p;o1apx  oeiadla um(mo;(4 exrir3io1oa r n s;(  2urxo nu4lm n fes ( srrau  nt4opeoiiciadla2ranmp t)alxoif oodomtraueslt trxrirpiu4omte fviltf 2ua(  oo1oet ioeiaslmDelnvs;(0tetnxoctatlmD  u ils) exoxopnodop elivsasf 2ua(rpnt1texo f3tytlmDrm(vs t4teermo todlateaieil(0texrir nu1lle  nvt ( artmxrooo1tlxomoeiad sDua(vsnu)tetrmr3tydoaD anvs;()s2uo(r3iu1openlfctat) rtm(root1ale if3tlslm rmums;u)alenio tytoate uei ( t2trxo iodam n fvsl(fartrxmp;o1oexn ociltfmDumnmpnu) rxnxo ta1lmt  uvi s)t2uo(o3nodlp   nvtltf Dtr(r ou0opt ifctytlm2rmnvsnu0 lxnio oadlpteluvs ( truoimpny4ape miesls  2rr(ro;o0tpt ifctltfs2uanvp u0 exrmrciotlaDrauvolt trxmim3nudlp  lnetl(f 2ururpnt1tetoiiciltfmDelu sn(4 exnxr3totlpt  uei;t)teuoxo3nu1lltelnet tfsrraum no4tlt mi3iyt mDrm( s;u) rerxr iydomDran olt)t2ur(o3oy4ale lneilt) Durx  ;o1tlen feild s ua(mo ()trtrmo todlm rli o;t) exm(o ny1opt mictl() Drmxrp;u0tetn i3iytlaDrln pnt0aeeomr3ia1omtrln o;t srtmir oy1lpte ivtat)arumx onu4texo fctad aDem(msnt4texnmf iadlp   nvslt  ruoiopnodap n feslt a2rax  nt1tpeniieiyd s2el(mpn(0aleomf tatlmDelnvo t0 exmxo3iu4ll e feta(  2urx ono0opeomi3iysls2rluvp;t)arenxf3totfptr ies;()truo(r3nydaleelicsasfsrur( ono4alx io3iadlmDuauvo;u0tlermr oytlpDeln o;s)texmxm nudapee fvia( a2rmu ont4tpt  iciad sDuluvo t0aetoxr iadoa  ai i s0s2xrxo3iy4amen ictls  2rm( p;o1opeo f3iasfa ulu o u0aetrio to1om elieo s)seumir3oo1optemnvtlt)aDumx pnt0aleomoeiysfaDelnmo;t0 exrmf oy1faDraieo;()t2xoxr no4ale  nvtat)sDumumo;o1tptoifciad m2em(vp u4tlerifcoydfm  lnvs;s texo(r3no1apeelfvt (f rtmx ont4apt  ieiysls ea(mon(4 lxnxr to1lptrlivs s0t2umxopoudopt mivil( aDtmxro;t0olx  o3iasfs emuvsnu0texrmr tytlmD ai olt trxoio io4op elfct t sDuaumpnu0aptn o3ils a2elnms t)artrmo3oytfmDe i o s0srxoio3oudaptn fvta()srtax  ot4teeo ociytfa2umn s u0artoif3iodomDelneslt0 etrxm3no4olte fvslsfa2tmxm ;t4olxo f3ild a ua(msn() etnmociodfp eau o;( seumim ny4op   icta(fs2uau  nu0oexnif3ias a2eanvs;t4 etrio3oatfatrlnvs t  rumxm oy1llenlnei s artrxmooo0tet  feiytfsDemnmp t0 renifctatfaDrai o () exoxm3oy4llte fvs t) Dtr(root4olenmieiat a rm(vp (4 renmr3oydlmDe i sl(0 rxo(r3iu1ol n fvsltfaDtm(m nt1tlx  oeilslmDeanvont) ltnif3totoaDrlnvol()srumxr3iu4open icsat)sDua(  ;t0texomfeiatlmDeanmpnu0teermf oydlat aneo;s srur(m3io4lm   fvs s  2rrum nt1apxnmfciadfa2rmnvsnu0trxnxo oatla ran ol()t2umim no4alenmieiasf Drm(r nu1apeomociys mDuanvo;()aeenxr iatlpD  i il()srurxo iudlmee ieiat)s2rr( ont1tetnmo3iytfsDrmn s () rtnirctotlpt aivs;s t2xrxm3ou4aptelnvil()sDumx p;o4olto f3iadfa2emn snu0tlxrxr3iatla rlnvols) 2xo(r3io4om n fvi () 2tr(mpnu4tee  o3ildfaDel(msnu4 exnmo oydoatelies;t0texrir oo4ap e feiltfaDumum no1opxo fciatls2raumsnu) ltoxr3oydoptelnvi;(  2urir ny1amt lfcilsf Drrxrpot0apt  oeilt a emn o;u)texnircootom  ln s;( trurirpiu1lltelfctl()a2tmumpou4alto ictydlsDulumo;t0artrir todfpt  uei t0 etoi
\ No newline at end of file
@@ -0,0 +1 @@
+nvs t0teto(m oudalee ivsas aDrax o;t0oex  fcildfaDul(mpnt0tlxrxr3to1opDraivs s0s2to(m3no4open fctl()a2ua(  nt1oet mf3iltlm uluvp (4 ltrmociydoa rluvo;( s2xrio3oy1lptemnvilt) 2rmurpnt4tlenii3ilsfa ulu sn()areniociadlmt lueslt0teumir oodlmeelnetasfaDurx ono4tle ii3tlsfa em(mp;()texnif tydfa ean s (  2xoim3oo4opeemnvil() Draxro;u4altoiociydfmDrl(ms t4 rerxo3ta1oa eau s;t)seurirpno4am emfvt ()a2umxmpnt0tee  icils s2rl(monu4treomr3tytlp e nvsls0tetmimpoy1omte nci t  2tmx p;t1tle  i3iytlsDrmu o;u0 lxnxf tatlm ean o t sexrxr oy4oltnlfctas artaxrpnu1texomoeiysla umnmon()trenmr3iadoa  ai o s) eumxm3oy4lm e ies (  rur(ronu4ale ioctadla2eanvpnt4tlermfciatomtelueo (0 2toxr oodlm  lfei () Drmx o;o1tpxnifetadfaDra(vsn(4trxnxf oy1op elieo;s)teuoir oy1om elneilt)aDumumo;t0tpxo feiltla el( pn(0 renxr ta1fpD  ivi t0s2ur(rpnudap  lfvtas)aDtau o;u0tlx  ieias a2um( s ()trxnxf3iodfp eln olt)seuoxmpou4olt mivt t) rum(rpnu1oetn o3tadlaDrmnvs u0tetnxrciy1fp ranei;s0 ruoxopoodal n nct s aDrrxmono4tex ioetls m2raumon(4aleoxr3oodlp ranvi t)srxrir3oudolt liet tfsDrax pno0texnmfciad mDrm(vs ()alxnxr3tytlp   uvsl(0t2uoxopiudalt miei t  rtrx  no0tlenioetysfmDemnvo;u) lxnxf3iydfpt  u o;( trto(m ny1lmte fvtls)a2tmumono1tltnmo3ilsfs2ua(mp t4aeenxf oydlm e i s;(0 ruoxopoodlmtnlfcsasfartrx o;o0aleo ietadlm2rl( p u0tetrir3oa1lptraneolt)trtr(r oudol emnctas)s2tr(mpot4aee  i3tysfsDemnmp u4aeerir iydfa  anei ( t2xmxo3iudlpe mictl(fsrrm( ono4aeeoioeiyd a2rmnvs t0aeenmo todomt  i s s)truoio3iodlmt mfctatf Drau pnu4opxomi3iytls rmnvp u) lermfctadlpDelivo;t0seurim3ou4lm  mneilsfarururoot4tetomfciydlm2ranvp u) exomf tatfp r n o ( srxm(opiu4opte fcsas) rrrxroot1apx moetadla ea(vo;u0 ltnxf3tatlaDr nvo t0texmimpiu4llt  fvilsfsDrax ont1opxnmoctat m2rmnmo u)teeoir3ty1op raies;s  euoio3iy4lmtemictat)srta(r ou1apx mociyd a2umums t0alenmfcoo1oaD  ieo s  2tr(o no4apt lieiasfaDrm(roou4altomf3iydfa rmu p;u)areoxf io1oa r nvols0 exoim3nodopenlictlt)sDraxmp;o1tltnmo3tldfmDrluvs;(0aeeoxrcta1lpDeanvi;s)srtmxmpou1lptelnetas)a2ua( ooo0apt ifetasfm rmnmpnu0tltnxr totomDr uvi;(0sexmiopoydllt lfvta(f rtaurpoo4oltomi3iytlsDean s (0arerir3todlm r n i t0s2toim3iu4oltemfvsa()sruaxr nu1oexnmictatls ranvs;u0alenxr3oatfaDrluvsl() rxoir3oy1lm nlncias a2ta(m ;t1tetomfcias s ua( s () rxnio3tytla  ln o;(  rtr(o3iy1lpenmivil(  2ra(  oo4aexnmoetasfm2ul( p u0aleomocto1fmDeau il()srxmirpio1op elnct ( srrrump;u0tltn fctadlsDelnvo u4texrirciadlmDraues;s0srxrxo iodlmt mnvtas a2rr(mp;u0tptn o3iydfa2elnmo u4tetnio ia1opDraneil(0t2xmimpoo4ole liesl()sDtax oou0tpe if3iadfm2ul( pn(0 exnmr3ta1lpDrlu s;s)trtoio3oy4lmtnmieslsfartrx p;u1altnif3iad mDuanmp u)alxoif tatlpDeaneils) eur(opnu1altemivslsf rtru  nt1aetoio3iadlm elnvo;(0altnir3iadlat lnei;t)trurirpiy4lm elfvs sfarrrxmp;u1alxo o3ildfsDua( snt0 exrir3oo1opt  ueolt) etmxo oy1apt lnvtl(f rrmxrp;t1tpxo i3tysla em(monu4texoxr3tytlpteau s;t0t2xm(opoo1alt mfviasfsDtm( pot1oltnmf3ilsla ulu p;u0teeoir3ta1lmt  uvsl( texmxmpiudale mivt (f Drr(m ou4aex  iciadlsDel(mp t4trxrio3io1fm   nvs s0s2xrxr3oodlm  livsa()srumu oou1texoiieiytfaDrm(mp t)teenmo3oodla  aies;t0trurxopoydop nmnci ()sDtmuront4aptnio3tlsls2eauvs;t4aeermo tydop rliei s teurxo3nudaptemfcs t)aDtrur ;u4tlx mictls mDrmuvsnu4tltrif3iytopte neils  exoir3ny4ome  fvsls a2rru ooo1alxn i3iys aDelumo () etoif3tatlaDe i i ()setmxopoydom elfetl(f rtmx p;t0tltomi3ild sDum( pnu0trtrxo3iotopteai o ( s2uoxo nydaptnlfcs tfsrur(ro;t4texn ociatla elu p;() rxnxo3oatlmDe ivs;t0 ruoim ou1alenlivslsfsrrmx p;u1aleniiciaslm2ul(vonu4teeoxrcio1optr nvs ()s2umxopoo4lptnmfeil() Dtmurpnu1altniieilt a2ul(vp u)artnmo3oa1latran i s srxmxr ny4ap  lfciatf 2rru o;t1alen f3iyd s ra(msnt0texoxfctytoaDe nvi s0t2trirpnu4om   nvtatfsDtax pot4apenmietyt s rmump;t)trxnxo3totfatrauei s  2xmxopiydlm elfci s aDtrxmooo0oet  ieiaslmDelu o;(0 reniociytop r nesls0srxrxm iydll   icta( a2tr(rp;t4apt ii3tytfa2ua(mo u4aexnxf3iytlmDrau o t  ruo(r3oy4al  mictas sDta(m ou1alt ioeiydls2ran pnu)arxnif3oy1laD auvo;(0 2trxmpiy4lp nlfctas  2um(  ou0oet  fctatfsDraump t) rxomociodoaDrln ilt0s2urxo nu4ale  ici tf rrau pno4aexniociytfm2ranmo;(4 exnmf3ia1laDraues s) euo(r iydomtnmncs s  rraxmoou0alen oeiadfa2umumo (0trenxf oy1lm eluvils0seto(m no1optn fciatfs2trxr oo4olx  f3iltfmDuan o t0 rermfcoy1omt auvilt  euoim3nu1ap  lfvta()aDurum ou4tlt if3tlt s2elu p t) eeoio oodomD lneils  rtmiopny1ame  fctatfaDrrurpno4oee mietltlm2rm(mon() etrio ootomteaivs () 2uoxr3nodlp  mnct s)arum(mpoo4ale mi3ild sDemumon(0texoio3todoa   nvils sruo(r ou4lpeelnes s  Dumx pnt1tle mfctad s2eaums t0tetrir tadla e uvi;(0 2umio3ny4am  mivtl( sDtm(m ou4tex  ieiyd m emn s u4 exoxr tatfmDeaivo s0 eum(m3oy4lleemiesa( aDra(rp;o4aee  ocildlsDumnvsnt0 eenifciy1fa eli sl() 2xrimpny1ole mivia(  Dumx pnu1texn o3iytlm rauvonu)tltoir tatfm r u s t)seuo(opnu1ape licils aDra( o;u0ale mi3iasfaDemu snu) eenio tytlaDe ueo (0sexoirpiy1apee fvi ()aDtrxmpoo1tetomietad a ul(mo (0 etrir3to1fatelieolt0s2trio io1alt mnvi s)aDra(ronu1tle mfcilsfaDumnvsnu) rtrxo iydlat ai s ()sexoxm3io1altn icils a2um(rpnt1tptnifciltfa2ua(vo t4tlenxf3iodlpteli o;() rumirpio4lpenmfvilt srurxr nt1tpe moetltlm2ea( o;t4 rtoio oo1lat  nes;(0sexm(o3nu1aptnmictatfaDrrum nu4alto fctatfsDemnvs;t4tetoxo3iydfaDeai sl()teto(r3nodal  lncia()aDrmum oo1tee ii3iyt a2ea( on(0aeeoir3totop r uvslt0t2xr(r3iudlmee iesa( aDumxmonu1tlxo i3tysfa rmnmo (4trtnxfciotfpt auesls seurxmpiu4omeelncs (f 2ur(ro;o4opxnifcilsla2ulnmon(0 lerxf3oo1lpt luvi;s0sexoir ou4omenlfvias)arua(r ou4ole mieiatfs2ra(mon(4tlerxr iatfpt au i s0tetriopiu4am nlfctatf rumur oo4olen oetls m rl(mo;u4 rxrif3oatla eaivi;t0 exmxrpnudoltnlici sfa2rau pno1optoio3iysfsDrmn o (0alxoifcoo1lmt  ies;( s2ur(m3ou1ll e ncsls sDumumo;o4olx moeiatls rlnmp;u4aexrmocootfaD anvslt t2xrxo3oydomtn ieia( s2trxm ;o1apx  oeiadlsDeanvp t) ltoio3oytomtran sls t2urir iodoptelfei sfsrtr( pou1alxnmf3iysfaDul( p u0 rtriocoa1opt lu slt0 rtrxopio1om n fcsls)sDumu  nu1olto iciys m ul(vont) rtrmo tatfpte uvs (0s2tmxmpny4om nlnviasf Dumu  ou4aetnmf3tlt mDelumont0 leoio3todopD an o t  euoxo io4lmeelicta()arumu p;t1opxnmo3iysla2rm(vs;u4texoxo tatopDrauesls0s2urxm ny1olenmfcilt)arrmxm nt1tpx mietyd m2emu p;t0trerxf3ta1lmte uvo t0 rxm(r3oydaptnlneiat aDurur ;o4aexoioctlsls2elnmo;u4aetrmf3iotlpt  ivs;(  rxmiopnodoltn fvt t)s2tmxmont4tptniociad s2eln o t)aetoio3oytlptr nvs;s tetoio io1apt mfctls  Dumumoot0tetn o3tydlsDrmums (4 lxrioctadlpDrlnvils s2xo(m3no4lp elieslt)artm(m ;u1olt ioeildlaDem(msn(0tltomf iatopDranvsls0 2xoxopoudllte ietlsfsDta(m oo1optnioeiysfaDul(mpnu0tlerio tadoat au s;t)tetm(r oodopee nctas  Dtm( ono1apeomi3iysfsDel(vpn(4 lxoxo oy1lmte nvs s) 2xmio3iodlp  mfvs sf Draump;o4tpxn fetyd mDrmu s t0 rtnmrcoatfmt lnvsls setoirpnodomen ici sfarrru  ot0tle mf3iyslsDul(vs (0teenxf3tydlp  lueslt0s2uoxopnu4lltnlivi tf 2taxrono1olt mfciat s2rmump t0arxomfciatomtranes;t t2xmir nu4altnmfviatf Draxmpou4oeen iciydfa rmn o;t4trenxr3tatlptrauvi t0srurir no4al emicsltfsrum(r ;o0teen fciltfs rmu s t4tltoifctatfateau ols srur(m3oodol nlieia()srtrxmp;t0opeo f3tatfs2elu s t4alxnxf3iytlmD  i i t s2to(m iu1ap e icilsfsDtau ont4aeenmo3iydla2umuvo;(0 etnxocty1opD li s;t0trum(rpiodaptnliesas)sDum(root0alxnifeild a umump;u0artoif iytoptelu s s  rxr(opnydlm  lictls) 2raxrpno4opt if3tld a2ranmont0 ltnmfciytopDelneslt teurio3iydlltnmnct sf Dtr(rooo1tptoifctadla2umnvp u0trxoxfciotlatr nes;(0 2umir3nu1optn ieil(f rtaxmp;u1olxnmieiasfa umu p;u0trxnxo3iodfpDeaneilt teuoir3iydale liei s) Draurp;u0olt mociyd a2uluvsnt)trtoxf oodoa   n o s trxmxr nudlltelfvtl()sDrau pnt1tlen icils s ea(ms ()texomfctytop rluei (  exoir iodap nlfcta()sDtax  nu1tpt mietyslm2em(mp t)tetnxociytfatrln o;t  eto(m oy1alt mietl(faDumxrp;o4apt mieiys s ulumsnt0aetrmf oo1fmtr nvolt) 2to(mpoy4amtn ncs t  2uax o;o1tptnmfeiydfm2umn ont4 rxrxfcia1fa r uesls0trur(mpio1lmee ivi (faDrm( oou4alxnmi3iat m em(ms ()alxnxf ia1lat  u i t s2umxo io1al nmiesltf Dtaxm nu4aexniocias sDelnms (4tetnif todlat aues ( texr(mpio4ap   fetat srrmurpoo4tptoii3tldfa2eaumpnt4tetnio to1lat  ivil(0trxriopoo1lm   ies t)a2tru pnu1alxn oeilsfs2ra(mo;u) reoxf3iydlate iei t0 etm(o3oy1olt  nctl(  2urxmp;t0aptniieias aDrmnms () rxrmo iydoa r uvs;()seumim3oydom e nesl()arur(ront0apxo o3iys s2rmnvp () lenxf3tatlpt livo;( s2um(opnodoltnmici t srrm(m nt0apxo fetls sDumnvon(4aetrxr3ta1fa   ueil() rurio oudamtemieta( srumx  nt1alxoii3tatlsDul(von(4treniocty1fat  uesls0 exr(o iydlltemieiasf 2tm( pot1tpt mictydls ulnvsnt)trtoxocoydfm  li s;() exr(r iu4lpte nesltfs2umx  nt0tpx ioctlt sDum( s;(0 eenxociydomDr nvs;t) eto(m3iydap nmfvtl(fartrur ou1tpx ifctldfs ranvo;()aleoxfcoatlaD lu ilt  etoxm oydalee ivs t aDtaump;u4olenif3iydlaDra(mp u0tlenmo oatlpD  nvo t) etrio iy4ome lfvtls a2tmxrooo4tpxniicild sDeanmp t)arerxf oo1lat lu i s0srxmxm3iudal nlicilsfarrax ono0tlx if3iyt sDrmuvpnt4aexrir3totla e uvsl()texm(mpnu1lm e netlsfs2uaxront0aetnii3ilsfsDrmnms ()trxoif3oodoaD  nvo t) exmxrpio4apte ietlt sDtrumpoo4aetn i3iat s uluvo u)tlenmf iytlaDeaueils0srxm(o ou1aptn iet sfs2rmxm ;u0olen o3iasfaDem(mo u0aetrmocoo1oaD  u slt)sexoxr io4omen neia() 2rrxrooo0alxnmfciatfm umnmp t4tetnmo tytfate neo;t setriopiodllenlnesa(fsrrr( ooo1tetoiicild a2rm( pnt)altnmf3iytfmDeliei t0srxmxr nodlpeemnctlt  Drm(  nu0tle ioeilsfmDul(mo;(0texrmf oodfp  lnvols)t2toir3no1lp nlfciasfsDtaxmpot4ape  oeiys s eluvpn() eeoxf3oa1op  aivilt texr(opiy4lpee ictl( s2umum no1tlx ifcilslaDrmn p;()alxomr oydomtelu ilt  exmio iy1omt  ncsls)aDuaxmoou1aptn ieiysfm emumo t4 lenxrciydomDr n il() exmio3oo1omt mfcslsfarrax  ;t0aptomoeiytfaDua(ms;(0alxniocootomte u o t)seuo(m3oo1lptnmfvs sfs2uaxro;u4aetoioeiasfm2em(vpnt) leoiocoatom  auvslt) 2tr(rpoo1omt mivi s arta( o;o4tpxn fetas m rau o u4texrmocia1lmtrau s t trxoio iydolt mnci t srtmxm no1alenifctys s rmn ont0artnxocoodlpDeaneilt0trum(mpiydlp  mncs tfaDtmurpnu0apxo o3tyt m rmu o t)tltoir3oa1opDelivilt)s2xmxr3oy4lptnmnct (f rua(rooo0altomo3iyslm2eanvsnu4artnxfctatop   uesls)s2um(o3oy1al emncsls)sDumu p;t0tpt io3iydfa ran on(4teerio oatfat  nvi s t2xrirpou4ome mnesl(  Drrum oo1oexn f3iasla um( p;t)artrir3to1lm  aivilt0seurxm oo4ll nlfeslt) Duru onu1apt mociatfm rmumo;u) rxnirciotfmt  uvi;(0srum(mpiy4alenmivilsf 2rax ont4tlen o3tydls2ua( pnu0altrxo3oadoptrau i t srtmxopio4ame mivils srta( oou4apt iiciysfsDem( ont0tltnxf ty1laDraues (0t2to(r nu4alt mfes (fsDua( o;t1ole mi3iadls2emn onu0 rxrmrcoodlp r i i t0srxmxr nu1opt  neils)srtaumpoo1oex ii3iasfmDul(vo;()trtoir3ia1faDrlu ols)t2xo(m3iu4lle  ivsa(  rumxm nt0opto fcilslsDrlnvo u4aetomr iy1laDe uvolt  etm(r3iu1lptnmiesat s2uaur ;u1altnifeiad s rl(mon(0trenmrciytlmDe nei;t0t2xmir iudaptn neia(farua(mp;t4apx  fetlslm rm(ms;t4arxnir iadoaDrluvs;()s2uoxr nu1lmeemivsltfaDtaxmono1tlxnmf3iyd a rau p;u)arxrir iatlmDe neo s)s2xmxm3iy4am nmnei t) 2ta(rpno4tpt if3iadls eluvp (0trtnioctydfmDeaies;t  rxr(r oo4lpeemnet sf rra(r ;u4open o3iys sDum( p;(4 eenmo oydlpt  ivo ( t2tmir3io4llte ncsas)aDra( ooo1apxnmociltfm2emumo;t4tleomr3tydoat ln o s srxr(r3oudoptemfvslsfaDraxr nt4olxnmfetysfa eaump;u0tltrmrcoatom elivi s0t2xm(rpiy1olt mnetls)arrm( pno4tet mo3tyt m2elnvs t)tetomfcoadfaDr i s ()seuoxo3io4omt lfvs ()s2ur( o;o1aexniieiyd m2rluvp;(0 ltoif oadfmtraueo t  2ur(m oy1ape  fvt (faruaumpou1opeo oeiytfa2elump t4tetomocoo1fp  lueolt0t2uoxopiu4al  mnvtls srtax pnt0aexnmf3tysla2rauvo () exoxf oo1op rlnvi;s)s2xr(opoy4ame mieiatfsrrru  ou0tlenifetatfm ran pnu0tleoxf ty1opt  neo;(0t2um(r3ou4lptelfetl(fsrtr(r ou0tltoiictyt m emn ont)arxrxoctytlm r uvols  eum(m3ny4amte ivt s) ruauro;u4olt iicilsfs2em(vpnt0alenxr3iy1fpD ai o;()srur(o3iu1optnliet s a2rrx p;u1alen iciaslm2ua( o;u4aetrmrciadfpD  u o s)s2urxopnu4ll nmfeia( sDrmur ot0olxoii3ilt m2rauvo;u)arxrio oo1fat luei s)t2xmimpnu1al n ics s s2tmx o;o4tltn oeiatfm rm( o (4trtnmf oydfaDr nes;s teumxrpoo1olt  nvi s) rtm( pot0alto ictldfa2em(vo t4aetoirctatoa   ivsl( sexoio nydaltn iesls  rumx p;t0altomietydlmDulu s;(0tetrmf3oodfp  aneo;(0seumimpiydll   nvt t)sDraum ;u4tptn ictat m ul(vp;t4trtnxocoy1oatrau ol(0 2umiopiu4am nmfvtat srtrxmont1oetn o3tld a elu s;t4 rerxo3ta1laDrlneil(0 2xo(r nu4omt  fetasfsrtm(  ou0aptnmfetlslm2elnmsnu) rtnxocoydfmtelivs s  ruo(mpnu1lm nlfcs sf 2ta(mp;u1aex  octlt s rl(mo;t4aeerifciadomDeln o () etoiopiy1oleemncilsf 2rm( oou4ole iictytfsDrau on()tltoxo iadfptelies (0srtrimpiudlmee nesasfs2ta( ono0aleoiieiysfs rlnmp;u4arenxf3ty1opt an s s s2xmimpno4om emieils sDuau ooo1tee ifctltfs uluvs (4tlxrxrciytlateliei;(0 etoxr nydalee fvsa(fsDrmxm ;t0tlxoii3iyt a emnvo;() etrmf3tatlmteli i ()texmxm3nydoleemnvia( a2umxmooo1apx  f3tat m2elnvsnt4 etomf ootfmDelnesl( trtmio3iu4omeemfci (fa2ta(  ou0altniocildlaDrl(mpnt4tlermr3io1fp e u ilt  etrxo3iydale micias aDrau onu0tlen fciyd aDum(vo u)aeerxr totopt lueo s)trxm(o3ou1amen fvils)sDtmuronu1olx moeiyd m2rm(vp u4tetrmr oatoatr nvsls0texmir3ny1amt  nvtlt  rumx onu0oleo fcilsfsDea(mont)teeoio3tytlmDeanes s)srtrim ny4op nlnetas)srtm( pnt4texniieiatfa rlumo;() rxnif3ty1lat luvo;s)sruoxr3nudolee fvil(farur(rp;u1optnii3iltfs2ul(vpnu4tlenifctydoa r ivils0srtoimpno4ome livilt) rur( oou4tlx io3tltla rauvo;u4teeomo iodlaD li s;s0 rumxopou1lmtnmivt sfaDum(rp;u4ope io3iysfaDumnvo;()trxrmr oodom elueo t0s2um(o oy4oltnlfvsa( aruru  ;t1alenio3tls sDrmu o (0 exomrctadfaDelieolt) 2xrxm3iy1ap  mivsatfa2umurpno4alxnmoeilsfsDrlnmsnt4 etrmf3iytfm eanvi;s s2um(r iydalt  ivi (f rurxr ou4tle mietytfm eauvp;u0tetrxf3io1lpt luvi (0 2urxo3iydamt mfes ( sDraurpno4oltn ictlsls rlu ont4tetrmr oy1oa r nvs (0 2trir3oy4ol  lictatf ruaxronu1olen o3iytla2uln p u0tlxomr3tatoa rlivs t0 rtrio iodam  lfcsas) rtaum ;t0tet  ieiyt m2ranvo;(4teenxr3iatfmtrln sl() euoxo iudap  liesa(fsDtmu  ;o4oet ioctyd mDeaumo;u)aeerxf3oytfaD  uvs;s0trtoxo oydoltemiet tf 2rruronu0tpxo ieiltla eanvonu0tlxnmo totoatelu i t0t2xm(rpoodol  lfvtlt aDta( pno1olxnifeiatlsDem(vpnu4 rtomo oo1opDrli o;s) eumiopio1optemics sfsDum( ono4tle iieiltlm uanmsn(4 ltrif3oa1lpDrauvi t s2xoirpiodal  lneta( a2trx  nt0oeeniietasfm2ul(vsnt4trtrir3oo1fpt  uvs;t)tetm(o3ny4lleemfvilt sDrr(monu4tlx  fcildfaDrln onu4texrmociotopt lnvs;(0trxmio iy4ale  ncs s s2tau pno4aetomietytlmDuau o u)alxomr iodlmDrlnvo ( seurxm3oy1llt  ivtlt  Dtru  ;u0oexnmf3tldfmDel(vs u4tlxnxr3tydomt  ues;t0tetrxopiodom n iet ( sruaum ou4oeenifciyt m2uauvo (4trenif3ta1fptrluvo;(0seto(r oydll emnesl()s2tmx o;t0olx ifeiad a ua(ms t4alerxf todomD  ies;( srtrxo3no4lptelnctat)sDurxr ;u0opeomfctadfa ea( p;t)altrxr totom  lueols srtoim oy1aptn fvia(f rrrxmp;u0altomf3ilsla2eaums ()tlxoxr oytfp e n il(0 rur(r3ou4lmtn fvsl(f rumxr ;u1aex ii3ils s rm(vs u0 etnmfctydlaDrauei t  eurxm3oydapeemnvslt) Drau pno0oetnmociasls2ea(vsn(0 ltomf iodoaDe ues ( t2xrxmpno4aptn iciasfsrumxr no4opx micild m2rl(mo ()teenxf iy1omte ueils0 2tmirpio4ap emnet s) rtrumont4tpe mi3iadfm2uaums;t0 ltnio3tytom  lueols  rtoio3no1om emfvta(fsrrm(m nu4tet iietydfmDuluvonu4alenmr tatopt lu slt teumxmpnu1opeemneil(fsDtrx oot4texn oetydfa2rm(ms t) exoxrctotlp   n ols seuo(m nu1ol   ietl()a2urx o;u4olx moetat a ra(ms t4tlxomrcoytla eaivil()tetmxo3ny4apen ictat s2um(rpoo4opeomf3tlt m rm(vo u4treoif3oa1fatr uvolt)setoxo nudlp  mfci ( sDrmx  ;u4opeo f3tatfa2uaums u) exrifctytlp  li o s0texmxr oy4ame  iei sf 2urxrp;o0tpxniictltfmDemnvon()arerxr3todoa ranvo t) rxmxopio1lm nmfvt s  rtmxmp;t4oexomieiat mDrln o t)tltrio3tatlmD lnesls0seuriopnydlmtelnvia(faDrr(m ;t0aex ifeias m2emnmp t4tetoioctydlaDeaueo ( s2xrxopiy1lle lfvi s s2rruronu4opto ocilt sDeanmp t4 lxrmr iotlpDe uvs;s  2to(rpoydlme mfesat  Dtr(rpnt4olx  oeildlmDuanmp;u)tleoxrcia1fmD an o;s)sruoim ou4al  lfes (faDtru p;t4tet ifctyslsDumnvsn(4 etomf3ootlp rai o s0 2xoimpoodoltnlicta()s2rrxm ;t1tetnmf3iltlm2ra(vpnu4aeeoxf tydfpDelneil(0s2xmiopiy4ll  lnvta(f Dtmumpno0oeeniiciyd m rmnms;t0trxoircta1latrau o;t0 eum(m3ny4apeemnvia( aDrm(  ;t4tpe iiciyslm eanmo;t) etrxf oatlp  aues s s2xoxo3ny4lmtnlneta( srrmu pou0tleoifeiaslm2ul(vsn()tlxoifcoa1om e ueils)srumim oydap nmnvt s srtrx poo4texn i3tadlaDrm(ms (0 rtnif3oo1oat luvs ( texoio oo1aleemfct () rta(  no0olt iietyslm ranvs t4 eenmocoy1omDeaivilt) rum(rpiu1lpenmiciatfs2rrxmp;t0tlt  ieiytfa2uanvsnt0trtrmocoatlaDrlues ( sexr(m3oudalt lfvs s)aDum(rpou0apeoiiciad s um(vpnu4altoxf tatfate nvi;s)trxoim ny1al elivsasfsrrmx oou4ale  i3ilsls umuvp;(0 lxomo to1fp   uvo s s2xm(o3oy1ll n nvsas)artmum ;t4tetoio3iasfaDemums ()texnxf3tydfmD lieo;t)sexo(mpoudaptnmicilt)srtr(mo;u4tex  ictydla el(mo (0tetrxf todoptelnes t)setoxr ou1al emfetlt) rrrxmoot4tpeoifetyslaDuln p;u4teerio3iotfpDe neslt0texrxmpoodam  mictl( arumxrono4aee ioetldla ulumsnu4trtoxrctydfat lieo;t0truoim3iydopt  ict s) rtm(mooo4oex ii3tatfa2eanmo;t0tltoir3tatfpDeluvsls0 ruoxm3iu4lme  ieia(fsDua(m no4apeoif3tadfa2ean ont) etnmr3tytlmteli i s  etoxo3nu4lm n fesas) Draum ot1tleo o3tlsla rmn ont0alerio oo1lat lnei s  2xoir oy1op elictlt aDurxrpno0alen f3ildfm emnvo (0trxnxfctadfmt  ivs;s0s2xrxr3oy4om  mies s a2rrxmont1tlenifeilt s eauvs t) rxrmocoatomte u i t  2tr(m io4lptnlfcils arra(  no1olxniieilsla ua( snt4altrio3todomD  ieils)seum(o nu4lptnmnvsa(fsrtaxmpot1optn oeiatlm2ulumo;(0arenxr iatlpDrluvil( srxr(r no4lpe  fetlt) Dur(moou0apeoiicildfm2umnmon(4 eeoircoo1fp eli s;t0trxoxrpoo1apt  nvil(fa2umuroot4aexnifetlt a2ranmo t0tetnxo oo1optr u o () eurxr3oodalenlfcs (fs2ua( o;o1tlt  fetasfm rln p;(4 etrxo to1fmteaiei s0tetmiopiy4om   nes (fs2taxr ou4alxoioeiadfs em(mont0trtnxr oytop rln o s0srurxo nydam nmict (faDta(mo;u1alt mietatlm rm(vs;t4alerxf oatlp  ai sl(  rtm(r oodalenmfvsls s2uru o;o0aet mf3tas s rmumsnt) leomf3iydfa  luvol(  exmiopoo1olenlnvsa(f 2umxr nu1apx  i3iasfa ra( s ()tlxnmfcia1fm eau i;()s2xm(m nydome  fetat  Duru  no1olxoii3iadlaDuluvp;(0 eenxf iadlpDrlivo;t  2uoxmpoo1lptnlnctas)sDum(m ;t0oexoiieiytfaDrmnms t4alxoir iytla elu o;t  eto(r ou1aptelivtat) rraxmp;u0texnif3ias s2emn snu0tltnircto1omt luvs ()trto(opiy4ome mieslt s2tr( poo0oex  icilsfm2rmumsn(0areoxf tatfm rlivi;t truo(m3iu1alee ncsat arrm(rp;t4opt mfctaslmDel(ms u0tetnmf3iadlm  anei s) 2to(opiodamtnlivt (fa2ra(moot1altnif3iadfs rmnvont)alenxocty1oatran o t srtmxm ny1olenmfes s aDumurp;t0oeen i3iat a2umn p;(4alenmf3tadop   nvolt)seum(m oydoltnmfes (fs2rax p;o4tex io3iat m rluvonu)tetnifciy1laDean sls) etmxrpno1optelfviat a2ua(mp;o1apxnmi3iysls2ua( s;u4tlxrxrcoy1la r i i;s  2uoxm oydop  micsas)aDraxm no0aeen o3tysfs eanvsnu4trtrirctotoptelivo t) euoir3oodom  lfvtasfsDtmu o;t1alxnmi3tadlsDulu sn(0trtoxo3iodlmt aivs;s)seurimpno1lltnmfesa(faDur(r nt4alt mi3ias aDrluvp ()tetnmf3iy1om eaiei t t2tm(r oy1opt liesls s2rr(ro;o1aetomoeiytfa umn o u0 rxrir3oy1lp rlnei;t  eumim3no1aleelicia()sDta( oou1olxnmociltlm ua(ms;t)alerir3iy1fp eau i s0trtoxrpny1ope  ieiltfa2ra(m ot1tptoif3iyt m2el( o t0tetoio3ta1oatraieo;s s2uoxo iy4ameelfcta(fs2ua(rpnt1apxoifctyd m ua(mp;t4altnmr3oatlmDr n slt0 exrxr oudalte ieias  2ururpnt1aeeo fetldfa2umn s t) ltomr tatlmDrlnei;(0tetoir oydalenmietat)sDrmx  ou1apt if3tyd m2ra(mpn(0tetoxo ootoaDrli i;s)srurir oo1lpt livsa( arua(m ;t0teto fciydlaDranvs;(4 lerxr3iytoaDrluvs t)sruoxrpnodome mici t s2ra(  ;u1tltomiciad a rlnmpn() exomr3ty1oa elu olt) rtoir oo1lm nmfei s) rraurp;t1tlx moeiat aDemu p;(4trermoctytoa ranvo s0 rum(rpiudal  miviatfartaurono1optomfcildls2eln p t) rtnir3oytlpDr ueo s  2uoiopiydlm   fvsa() rtm(rpno4opeo i3iatlsDemnms;u4arxnmocty1laDeaivol(0t2tmim3oo4omt livi t aDrmum oo0aexnio3tls sDrl(vsnu0 eermrciydomD aieo;s t2toir ny4lmtemfei (f rtm(m nu0ope  oeiatfmDeanmpnu4arxomf3ta1omt lies s texmxo3io1lltnmfcsat sDtmxmono1oetn oeild s umn s;(0altoif tytlmtr uvo t)setoim3iy4open nctltfa2uaumo;t1tpeoio3tatlmDrl(msn()aetrmr3io1lmte u o;(0 exoimpiodame lfeias)s2rrxmonu0apxnmf3tld mDrmn s (4altrmr3io1fpD  ueolt  eumir3no4lm  mfeil()srra(rpou0opxomocils a2em(vp;u4alerio iodlm e ies;s) exoxr nodalenmfet tfsDurxrp;u1tpt ioetys s emumsnu0arxnif oytlmt aneils sruo(o ny4al nlnes ( sDrrx poo4alt mi3iysls2um(vp;u4 rxnxfcoo1oa rlnes ( sexmirpiodamen iviatfsDuaxmpnu0opxo fciatls rl(mp t0treomf3ty1lm rln s;t0srtmim oy1llt  ict s)a2raxroou1oltn fcias sDem(mon()trtrxf iy1fmtr ivils)s2um(o iy1lm  lics t a2ur( poo4tpxnif3iyd sDemump;()trxnirciytomD luvs ( tetrir oudlmeelfetatf Dururont0tet moeiatfm2eanmp;() exomo tadfatranvs ()trtrimpno4lle  ncs sfsruaxr ot0aptnmfciat sDrlu o t)aeeoif3io1fmDrauvi t  2umxr oo1ome  fct t  Duaxm nu1aet mi3iat aDul(ms;(0texrir3tadlpt  uei;s texo(mpno4al  mivtas)s2tmxmono1opxn o3tls m raumpnt0tltrio oodop  livslt seurir3iy4ape mnvsas) 2ta( onu4texo ociyslmDrlnvp u0aetoifciytfp r ivi (0s2xo(r ny1apen ivil()aDta( o;u1aeeomociytfs umuvo;t0 renxr3iy1oaDr n i s)trtm(m3no1alt liei t) Drm(rpot1tlto o3ilt sDrau p;u0tlxrir ia1op r ivo s srtmxmpno1ome  feilt) 2um(r ot1tlenmieias s2eluvo t4 lxnxo3todfatr ivo;s) 2xr(o3no4am   fvtl(fsDumur ;o4aet ii3tld m2rmnvsnt0teenxo oy1la  lnvil( tetm(o3oudap  lnct (fsDuau o;o0alxomoctysfmDeauvs (0aeeoir3tadfmteau s;s0 2tmiopoudlmtemnvtas)a2umxrpoo1opt mfcildla2elnmpnu)artomrcoodlpDr nvs;s  2uoxo ou4ope lfvtltf 2rru  ;o0tet  f3iysls2ua( p;t0tltoxocta1lat lnvi t0trum(m3no1olenlfesa()sDra( p;u0oleo o3tysfs2rauvpnt0tetriocoydfpDean ol() 2xmirpoudope mivt (fa2tax onu4ape  fctltfs2ua(mp u) renxr oytlatrlnvs;s0s2uoio io1apen ivtl(fa2ta( oou0tptnmociytfm uau p;u0teermf3oydlp eaieo (0 eurxo3ou1lm n nvt ()aDumu pnu0tpeoio3iasfa umnvsnu0 etoifctotlaDr i s;t)truoxm nu4ll emnvi t)s2ua(r ot0tpto f3iydfmDemumpnu4 renmo3tadopteanvi;t) 2xmxo3iy1om n nvi s)srururo;o1oex iieiyt m elu sn(0alxomr3ia1fpD aueo;t  2trxr oy1alte fcia( aDtaum ou1aet  oeiydfa rmumo;(4 rxnxr oodfpD ai slt)s2tm(m nydlleelnesl()artaur ;t0tptnifcilt m2rm(vp;t4altoxr3oytlmD lnes t  2xrir3no4lpt  ivslt)s2rm(  oo1apxniiciytlm ulnmon(0 ltomociydfpt aieo;t0sexm(rpno1llt  ics t)s2tr(  ;u0aeenmictytlsDrmumo;u0 etrmr tytla e ueo;t)texrimpiy4lmeemnci ( aDrmurpnu4tetomfeiysfm2eluvp;() rxoxr iatla   u slt)texoirpiu4lpt lncsl( sDtru  ou1tptoif3tasfm2eln ont4tlxoir3iotfmtrai o;(0srxoio ny1optelnes t)arraumont1opto ietydfm ua(monu4artoxocoytlp   ivi s0 ruoxm no4lm nmnvt ()arrmxrpou0aleoiieiysfm rmumo;u4alxnif3iatlmte nei;t  2tmimpoydolen fci () Dtr(  ;u0apxnmi3iydfs2rm(msnu4tltrxociytopt  nes;()sruoir iy4omtn ictas) Duau ono4tpxnmoctlsfa2uaumonu0 rtrmoctydopDr nvslt0 rumim ny4lptnlivsat  2umu p;t1aexnmieiys a umnmpnu0arxoio oy1fpte nvi t) 2toxr oo1oltnlnct s) 2tax oot4apxoif3ils aDeaumo;u4texoxr iydoatrlivils tetmxr3iy4alte ivtasfarrrur ;t0aexn iciad sDrmn s t)altrir3todfpt  nvs;t srurxo3iodoltelncslsfsDrax oot1aee ioctydfsDua(vonu) rtnircoy1lmtr ueilt  exr(m3nodamenlnvs s  Dtm(r nu1oleo ieilsfmDean p u0artriociytlpDe nvo;t0 etrio iodlmenmivsa()sDuru o;t0tpenmo3tysls2umuvpn() etrifcta1om e uesls0tetm(rpiu4lpt licias  2uru pou4oex  f3tys s2ua(vsnt4aetriocoatlateli i;(  euoim nydlmenmivi t)arra(m no4alxn fcils aDua(vpnu0teeoxrcoodla rli i;t0trtoxm iu1om n neilsfsrrru  no4alxn ieiytlm2rm( p;(4aetrmfciytoatrluvo (  etmxmpoo4lp emieias arrr(rp;t0aexo iciytfm uluvs;u0 rtnir3iytlptr u il(0t2umxo oydalt  fcs s) 2ur(m nt1opt mfcilsla uauvp u) eeoxr oa1fp  lu ilt  rum(r nu4alt lnctas  2rmur nt4oeeo i3ildlaDrmu p;(4 lxoxr todla  lnvi t s2xmim3no1oltelnviasf rrrurpoo1optoiocildlaDrl(vsnt) lenmo ty1lpte ivil( t2tmxrpoo1apee ivi () rtr(mooo4opxomo3tys s ul( s;(4texnxr oy1fp   ieo;t srurir3ny1om e feilt srtau  ou4tpen fciadfmDumu p t0tleoxocoadopt aneslt srxrio iodale lics ( arraxro;t4aptniociyt aDemuvo;t)aetomo totomDraivils trurio3no4aptelivslt  rta( poo0tleomi3iat s2emums;t4tetoxf oydopDrlu i;t0teumxm nu1optnlivsas)s2tax ont0teto feiatlm2um(vo u0teenir3ia1fa r i slt)s2to(r oydalte nei (fsDumu  ;u4aee ifeiltfa ua(vs;t4trtrxociytlatr i o;s  eto(o3nu4ape mnci ()sDur(m nt4tleo oeiadls em(mpn()alerir3totla rluvs t)setmirpoydopenmncsatf Duaurp;o0optoiiciat mDum(monu4 ltomf iotfatrluvs;(0s2trxm oy4ame  fcsa(fs2umx ono4ale miciat mDrm( snu4artnxrcia1oaDrliei t) 2xo(o oy1ol  livsl(  2urxmpno0tpxoiiciydfmDra( o;(4trtoif3iodomDr uvils)texr(m3iu1op n icsa(f Drax  ;o0tlt mocilt s2ul( s;u4trenmfciytfaD li s t) etoxo iu1lp nlfet ()sDrr(  nt4olx micild a2emuvs;(4aexoir3iatfmt livilt)s2xr(opny1lptn fvtat  2uaxr nu0aetn ietyd s2em(vo u0tleomociodlat  u s;s0seto(mpio1amtemivsa()srrrurpnt4ale ioetls a em(ms t4arxnioctodomt auvs s0setmim3iu4omen ieias)a2tmxmpoo1alenii3tyt s2ulums;u0altrxf iy1oatrauvs;s0t2xrio nudalte fci t  rra(rp;t1oetnmictlsfmDea(mo;u)aeenxrctytfpD aivo;t srxmio3oo4lleemfvtatfs2um(rpno4aeeoiieiysls ua(vp u)areomocoa1oateaues;t teuoxr3io4amt  netasfsDumx oou1olxn i3tlsla rm(vs t0tlxrmrciotfaDrau s;s0trxoir3iudlleelnci (fsDra(r ;t1oltnioeiydfs2rln s;(4trtrmrcta1la e nvsls)t2urxm3iu1ol n netls a2tr(monu4optnmfciltfa2uauvpnt4areomr3iodomtrli ol(0setrxo3iu4aptnlivsls  rraumpot4alx ioctldls ulu p;()tltrxfctotomteanvilt0 exr(r nydlpe lneia( srtmxr ;u4tee  fcilslmDeau p;t) etrmrcty1lm e n s;( s2uo(r ny1llenlics s)arumu o;o0texn octas m2eau on(4 leomfciadfmtr ivs (0trxrxm nodope mnvia()s2tmu  nt1tle ioeiysfs umu sn(4treomf3ia1lm ean olt  rxoxopiu4op   fcsas aDtmx  ;u0alxnmfeiltfm el(ms;u4trtrirciatfmtrluei;(  exm(mpiy1lmee fetasfa2rmxmp;t1alxo feilt m2rauvs u4tlenmr ia1optr ivsls0t2trxm ny4lle  ncslsf 2ta( ooo4tpxo fctld m2ulu pnu4alxrmo3tytom rlues;s t2xr(m iu1al emncslsfaDta(rpno0tpxoio3tldla ra(vpn()arxoxrcia1fpt li sls0srtrim3oydllen net t)sruaxrpou4aet ifeiltfm2el( snt)aeerxf oy1la ran i;s)teuo(opnodlleelici sfsrtrxr no0olx ioetldfsDulu o u)trtoiocty1la eluei;(0t2xr(opiy4ol  livs sfa2raumono0apxoio3iatfs el(vo;u0tlxnmo oytfpteaivo;()t2uoirpoo1omen nct ()aDum(mpot4oltnif3tld s rmumsn()aexoxf3iatom rau s (0 2uoimpnodlpenmfesls)arururo;t4tltoifctldla2emnvs t4 lxrif todfmD anvi s0teum(o ny1am emfvtl(fs2raxm no4olx  ociytfm2ulump;(0 rermr3oadopD anvs s  ruoxo ou1omtemncslt  2tmxrp;t0tpeo feiys a rmump t0areoxf oo1lp e i s;(  rtrxrpiydal nmfetasf 2uaxrpno4opeo i3ild a ranvs;u4texnir3tytopDe n ol()texm(o3iu4lp nlnci s  rua(rpno1tlt mieiadlm2ua(mp ()treomrcoatopD  u i (0 eum(o iu4ll  mfvi s) Duax ooo1tlxo feild mDrl( o (4 rtoif oadlmDr ieolt0 euoiopnu4ope  nei tf rtaxroot0ape ioeiatfm eau o t)trtrmfcootfmDrau il(0trtrxr3nudll e fct tfaDtaurp;u4tex ioetlslaDrmn s () lxrir tydfaDe i olt0s2tmxm oydome mncia(  rra( pno1aeenio3tadlm2rmnmo;t)aetnmo iydomD  ieols s2tmio no4oltnmfeta() Dua( o;o4aet  oeiys m ra( sn(0altrif oo1lp  an il(0trtrir ny1omenmivtl(f Draum no4ope ii3tas aDuln pnu0texrir iydomD au sl()tetr(o iodlm n fcsa( a2uau  nu1apx  f3tatlm2eau pn(4 exrmr oydoat  uvo;s)srtm(rpnudop nlfvsl( srtrur nu4oeeo oeilsfsDemn p (0alxnxf iy1op eluvs;(0 ruoxr iudam emncsl()s2rau o;o0apenii3tydfa elnmpn(0 etrxr3oydlmt  n slt sexrir3ny4ap emfei sf 2rru  ;o4apxo oeiaslaDrauvs;u)alxnmfctadlaDe ieo t0trtoirpio1olt lfvsa( a2tmxr no4oeeomieiytlmDelumo;()tetoif iotfp   nvo s0texr(m3oodopte fvtltf Draurpnt4tptniietltfsDrauvs (0 exrmf ty1latraiei;(  exrio nodamtelfeilsf 2ua(mpot4tlx ifciat m2ulu p;() etrio3oatlptr nei s) exo(opny1lle  fvsatf rtmxr nt0apeomoeiad s umu pn() etrxr3to1laDeaivil() 2to(r3no1ll n nctl(faruru pou4ole io3iad m elu snu0trtoxoctotfpD anei;t0 2uoim iodam emfctas  rtmurpou0oex mi3iytfaDuau pn(4 eenir3totfpD li s;t0trtrxr iodaltnmfvt (f Duru p;t0apto o3iatlm2raumo (4altrxf3iodlpt lu il(  ruoxm iu4ope mnet t aDrmumpnu1tpeo ietysfa2umumo;u0 ltnio oydfaDe nvo s)srtriopno4lptnmfeia( aDtmxr ot1oleoii3tyd mDrln p t4 leoxr iytfmte ues;(  rtm(r oydlmen ies (fsrrmxmp;o4tetn o3iydls uanms t4tetrxo iodomD auei;(0s2tr(o3nu4ll  mfvia( s2tmu  nt0ape ioeiydfs2emums;t0teerircootopDe nvol()t2xmxopou1lptelnetat a2umxmono4oetnmoctldfsDeanvo;t0alerxf3tadfa rlnvo;(  2tmir iy4ameelictltf Duaur oo0tpxniieils sDemn snt) lxnmr3iy1lp  auvils0s2uoxmpnu4apt mfciltfarrrurpou1aexnmi3iad m2ua( snu0teeoxr3iytla e i s;t)trto(m3iydol nlies tfarum(m nt1aexnmo3ilsla elums t4 eenxf3oadoate u ils) rur(rpnu4lm  mictlt) rtru p;o4apenmoctasfa ean sn(0trenmfcoa1faD  i o t s2toir no4lp e nesatf rtrxront0oexn ociydlaDeauvsnu0texnmo3ia1fpt aneo;t)t2xo(m oo4ape mivs s  Drrurpou1alenif3tltfaDemuvo;() lenmr3iodfmDrau s;t texmxo oy4apenmnei tfsrrru p;o1aptn octasfs ulnvp ()aeerxr iytlm eaivo;(  etr(mpou1am nmnetat  2raumpoo4opxnif3ild sDuau pn(0arxnir ta1fmte neil(0srurxrpoy1oleemnvtltfs2rrx  ot1optnmfetadlsDumu o u4 lenmfcoytoa  ai ilt) ruo(m nodomeemnctltfa2rr( p;o0tpen ociasls2ul( o t0treoio tatfa r nes;(0 euoxr nydapt  fctl(faDra(mono4oltoifctltla uluvs t0 lerio3oo1oateluvo () rum(o3no1lme mfci tf ruaxm ;u4opeo f3tasla elu p t0trxomrcio1lmD ln s ( s2toiopoy1am emfetlsfsruaxmpot4teeomociatlaDuau o;u)tlxrifciydom  aieilt t2xmxr oo4openmivtlt)srum(  oo4apt io3iaslaDraumo;t4teerio oy1late uvo;()texmio oudop nlnviat  Dtmumo;u1tlx moeild aDemu o (0 rtomo3ta1fmD  u o;s  2urxr oo1lpte iet t) Drrxrp;u4tlxomictasla rm(mp t0trenxocta1lat au o t t2xr(r3nudom  lneil(fs2uru  nu4aeen feiysla rln sn()aexnmo oo1fmt  n o s) exo(r3oo1lltn nctl()arur(mooo1alenio3tyt mDuau p u0arxrmo iotlpDe i s t0t2uoiopiy1lpe  fctlt aDurxroou0oet iictltlmDel(mo (4 rxnmo3oatoa rluvo t)srtmir iydlm  mfeilsfsDurur nt0teenifctadlaDrmumsnu4 ltnxr3tatlm r ieo t sexmxrpoo4ll elncils)arumxrpnt4aexnmietatfs umnvp;(0 rxnxo tydopD  u ols)t2xmimpoo1lmtemnctas  ruax  oo1apeoifeiys mDranmo ()trerirciadlmDraieslt0s2umimpnudlptelnetat)srrm(rpou1tlt  oetaslm2ea(mo;t)tlenxf3tydfpDeanvs;( setrimpnudopt lncsls s2ua(mpnt1teeoiicilsfaDraumo ()arenxo oadfp e nei s)trto(r oo4lpenmict (f 2tax  ot4aet ifciys s uanvpn()treomocootfa r i i () euoxo3io1lmtnmieia(fa2ra(  nu4tlt  f3ilslmDeanms t)tltrio oodla  au sls)teuoio3oydlmtemnvtas  2rrumpno0aptoioetyd m2el(monu0arenxf3oo1lmDr ieols seto(o nu4ape  fvta(fa2tm(m ;o4apx  o3ild sDuaumpnu0aetoxf tatfmDeaivo t) 2to(r no4lpe mictas aruaxm ;t1opxoio3iadfa2rm( s;u4texriociotfp elu slt)sruo(m oydap n fesatf Dtrumooo0tpen oetld s emu pnt)tlxomf to1lm  an olt)t2xoio3iy4om  miet s)a2urumoot0oexomf3ils mDuau s t)trermrcoydfmDe neo;s0 rurxr3oodomtnmfetl()srrmxrp;u1tlt  feiysla rluvo t) lxnmfcoatfat  n o t)trum(mpoodlle mfeiat s2ra(  ;o1olxnmiciysfm emu p;u0 eeoiocoadlm rauvi s0 2xmxm3nudop emiesl(  2tmur nu0aetoifciadls2ranmo;t4 lxnmo3iydoa r i s;s trurxo nu1optn icsasfa2rauro;t1opxn ociyd s rln s;u)artoxf ootlpteai i s0s2xmxm3ny1om n iet t  Duaxr oo0tltniociatfa2eanmsn()trtnmo3tydfp e i s;s0 rtoxopno4lm elicsltfarururooo1texoif3iydfm2rl(vp u4alxrmrctytfatrauvs t) rtriopoodopen fei t)sDtm(  ;t4tltomo3tyt m2ua(vo;t4 eenmr totopDrlnvs () exm(o3iy1op nlivtat sDtaum ;t1opxoifciyt aDra(vpnu4trtoxr todlp  aneo s0s2xmxr3oy1lp elfes tfsrtaumonu1opxoio3iatfa2umn on(4alermf oy1latelu s;t)t2xmxrpoo4ame  fet (fa2ta(moot1aexnii3ilsfsDea(vo;(4alxoir tatfmt lnes;s) eto(r3nodal   fvs tfs2rru onu0opxo fciltfs2uanvsnu0 renxf3tatlp  au sls t2trxmpnodlp  lfcsasfaDuaxr nu1olen fciydfs2ul(ms u4 lenmocoytop elneo t) exoxm3iodom emnvsa()a2tru  nt0alxnmfeildlm ulu o ()aetomrcty1lp raiesls  2xoxopiudolt  nvt t srua(m ;t1apx miciytlm rmuvp;t) lxnxf3ia1fmDr nei;t t2uo(o3oudole  neiat aDrm(r ot0opx ii3tyt a el(vpnt0teenmfctatop  au i;s)srxoxm3no4omen fvi tfa2uru o;u1tlt ifcilsfmDeau p t0 etnmo tytfpD li o;t  exmir3oo1oleemicils) 2rmx  no4opxnio3iys mDra( p t0aleoxf iydfp elueol( srxmir3ny1om n feslt)aDumum ou0oexo oeils aDeanvp;(4 rtomo3ty1lm r i o;(0seto(mpiodlltn icsls sDrrxro;o0apxnio3tldfsDumu o (0texoif oytomteaivs (0teuoxopio1ope mieiatfsrtmx o;t4olenmocildfm2eln s;t0tleoio iydoat  i s (0 eum(o oy1ll n neias)s2ua(moou4aetn o3tldla2ul(mp u4trxnmr3oadlaDeau s ( trtoxm oy1op nlfvs (fa2tax p;o0apeomo3tytls2rl(vpnt0tlermfctotomtelieo t)teurir ou1lm   nctas) ruru  ;u0ole ioetldlmDuan p;t0 leoiocoy1lmDeln olt0srumimpoudal e fvsa(fa2umx  ;o0apeomfctyt sDrm( o t)arerxr3iy1omte nvs;s) 2uriopiydaptnmncsasfs2rmxroou4tee iieilsfaDrlnvp;t0treoif tadfpt  neo;s0seuo(r nu4ole lfci sf rtax pot0texn iciyt m ea(vp t)artnif ty1la   uei () eur(r iy4omt lncs tfa2urx pou0alxo iciasfa2emu s u0trtrmf tydomDr u s;t  rtrxr3ou4ol e fvs t) rtrxrooo0aetn fctldlm2rmn ont4arerxo iy1oa   uvslt teur(m ny1ap nmnvtat  rrmxmoot0apeomoeiyd aDelnmpn()teenmo3oydop rai sls0trurxopou1al n ics (fa2tmu oot1aptnif3iasfm rmumpn() lenmr3ootopDeau slt srum(opoy4altnmfcils)srrax p;t1ale  ociltlsDra(ms;t0 ltnmf todfmDelnvi;s) exrxr3ny4olt  nciat) Drax pou1opeo iciytlm2uau p;(0 etrifcoy1lpt luei t) eto(opnodolenlictasfs2tru pnt1oeen fciys a ulu sn(0trtnir tydfpt an sls  exr(o3iu4oltnlfeiltfa2tau onu4oexoioeiatlmDranmp;u4trtnmrctodoa  aivi t)s2xoiopoy1omt livtas)aDur(rpot0tptomiciyt s elu s;u4artnmfcoo1fa rai o;( srumxr3oo4omtnlfctl(fsDtrum ;t4opt mi3iys mDem( o (0aeeomocto1fm rauesl( setm(m3oo4lpenmicslsfarraurpot0oetnmietydfs um(ms;(0tetnif ootlm eluvols seumio iu4al nmfci s srtm(m oo1apx iociltfm2uaumsn(4teenxr3oadlp  anvs;t0srum(o3ny4amtnmfei tf rurx  ot4oeenmf3iasla2rluvp u) leoxr3todoptelu ols0 ruoimpiodlmt  fcilt s2uru  ou0alt mfeiasfm2emums;t4tleomociatlat  u sl(  2urir3oy1ape mnetlt)aDrrxr oo1alxoif3iatfaDrm(mpn(4altrmf iy1om  anvi t srxrxo ou4om elfei t  Dur(r oo4oex  f3iys mDemumonu) ltoxo iytfpDrau olt)sexrimpno4apen netat) Drm(mp;t1tex  ieildlm2el(mpnu0areoxf oytfa e uvo s)setmir3io4om n ict sfsDrrxmo;o1opto o3tad m umnmo u4aexrio tadla elueo s)t2xr(o3oy4alt livsat s2umxr ;t1tptniiciys m rm(vp;t)alermr3ia1lpDrlnei;t  2xrxo nu1oltelfvilsfaDtm(rpot4apto o3iadfaDel(msn(0trxoioctydfptrau i;s0tetmimpio1apt  ietl( aruax onu4oexoioeiltfa2ea(mo t0tlxrio3todomDr u i t  exoxo nydapt liesa() rtmxmpno1alt mo3iydla2ra(mo;t0alerxf3oydlpt an slt s2tr(r3oo4llt mivt s  Durxro;u1aetn f3ildlsDemu snt)trenmrcoydoaDe n ols0 2uoxo3oy1omee fctlt)srum(r ;t4tltnmfciatlsDumumsnu0aexnxo oytla raieo s) 2um(rpou1amtemiet s)artm( oot1aetomfctlsfmDrmnmo u4aetrif tadoaDeaieo t) rurxr3io1lm e neiatfaDrm(mpou1oexo fctatfs ea(vs;(4trtrifcootlptr ivolt  rxoxmpoudomtelicsltfsrtauro;t1opxomicild a2ulnvpnu4 rtoxrctytlp rlu i (0sruoxr oy4alt mfet sfsDrm(mp;o1tlen i3ilslsDrmn p;t0 etnxfciatlaDrluvsl( srtrim3iy4opt  ncsat)a2raxr ;u0oeto i3ias s2ra(vpnu0 lxnif iy1fptr i ils srtmio oodllenlnet () 2ta(moot4aptn oeiatlm2rmu s;t4aetnxf iadfa  luvi s0 rurxo3oydame liciat)artaxr ;u4aeenmictlslsDul(mon() rxrxo3iodlmte n o;(  exrimpnudlle mieilt s2ua(r ;u0tpe ifcias a2emu o;t)alerxfciodfm r nvsls0 ruoio iu4opeemnvtas)aDum(rpno4opxo i3iatlsDrl(mpnu0aeenmr3tadlp e i ilt  eumir ny4op   nci t)s2uau pnu4alxoifeiyt m um(ms;t)tlxnxf oy1opteaivi t) rxo(r io4lp n fetl() rua(  ;u0tpxomiciysfmDem(msnt0trxomr3oytfa rauei;s  eto(mpoo1lpte fvt tf rrruroou0aeeomo3tltfs ra( p;(4alxnif3ty1optelu s;s sexoio3oudlm   ivslt) Dumxr ot0opeo feiatfs2ra( o u4 rerioctadlmD lueolt)t2xoir3io4lptnmfetl()aDum(rpot4tptn fciytfaDrlnmo;()teerxf ia1fat au olt trtmxo3io1olt  fci sfa2uaxmpot1tlxnioeiatlaDrlnvo;u)alerxr ia1lmtelnvo;()trtmimpou1ape mivsatf 2rmu  ot1aeeoifciltfa2rlnmont)artomfciatfmtrli i;()s2tr(r nudam  miei ( sDrmu oot1apt iietys m2elnvo (0tltrxo tydlat  n s;s0trurirpiudap e fvt tfs2urx  ;o0tex iociyd aDuln onu4trtrmf iotomtr n s t s2xoxopou1ap emfetasf 2uax o;u4opeoif3tls s2eln p u)altomfcia1om e n o t0srtoimpnudolee iciasf 2rax p;t4opeo ictls s rmnmo;u0 exnxr iadfaDrau ol( tetrxm3nu4ameemfes t)arum(m ;u1tex  i3tls a uauvont4 etrxf iatlm eluvsls srxo(r3iu1llen netltfaDuru oot0apxoio3iyd aDelnvonu0aeenifctydla r ivi;()trurim3oydole  fvil( aDtrxmpot4oexnifctad a rlnmpn() reoxo oatop  lnvi;() rtrirpou1llen neil() rtrx oou0tpto fetat sDeln o;()texomo oytlateluei;s t2um(r iydlpenmieilt)a2tmx pnu4apx mi3tat a2rlnmp;u4trxrxocto1fa   uvil(0teuoxm3oy4ll n fesl() rtmuroou4tpt ifctadls uanmont0alermfctydla eaieo ()texrirpnudlle lncilsfsrua( p;u1tpxomoetyd mDrluvpn(4arermr3iy1oa rlieilt)trtmxo3iudlpte ieta( srtrxro;o0tptomf3iyslsDemn o;t)tetrmo io1fmD liei (  rtoio iy1alt livs s artmxr ou4aetomo3iadla rauvont)artnmo3oydop r i i s0 rtmxo3nu1apenmnciat s2trumpnu4apeo f3iasfm eanmpnt4texrirctadoa r n o s0teurirpnudal  mfvi (fa2umxmpnt4tex mf3tlt mDra(mp t0trxrmf3io1oatr ies t t2xmxm iodlpe mncs t  rraxrooo1aee mo3tyslaDul(vsn(4 rxoxocio1omD  nes;() rxr(mpoy1ap elici tf 2tmum ;o1alx  fciatfmDuauvp u0 etrif3oo1lm eanvs s0tetm(m3oy4opt miviatfsruaum nt0tee mo3tyslsDum(ms;t0tlxomr totfm ean i s sruo(opio1lp emies s) Draxm ;u0tex mo3tyd s2rluvs u)tleoir3todoa r ueo;( t2toir nydamtnlncil(  Dtaxro;t4opxn iciys s ran ont)tetomr3oo1opD  uvs;s trxoiopiy1al n fei (fsrta(ro;t4texo feiat a rlu pn(4 etnxr3iotoaDr uvil(0 2uoim3iu1altnlnetat)s2urx  nt0oee  feild sDrmnvs;(4trxrmfcoadfm   uvi;t0s2trxo no1aleemiei s  2uaumo;u4opx iieiltls2uluvpnu4aeenmo oytoatrlueils s2urim io1llee ivi sfs2tmx poo4opx mo3iad m2ranmont)tltoxfcoa1la rli ols)trtoxopiu4ape mnciasf 2tmxm nt0oltnifcilt a2elnvs ()tlxoir iy1lpDeanvo ( setrxmpiy1lpte nvil()srtmxr nu4alxniiciad m ra(vsn() rxrmo3ia1fa  auvs;()seumxrpou4lp elnvtltf 2umxmooo4tpxoifciat m2ul(vsn() ltoiociadoaDr nvi s)srxoxopoy1ol elnvi t)sDrmu p;o4apxnmietadfaDulums;(4artrmr tytom   i olt)texrxo oy4om  mnctas  Duax  ;t0oltn oeiyd a2ulnvpnu4alxrif3iadfa  ai i s)srxrio3nodlpe liviltfa2rmx  ;t0aleomoeiys sDranmpnt4 reoxr3oydop   nvol()sexo(rpiy1alt lncia( sDurx ono4tle  o3ilt sDul( s;t0aexnir3tadfaDraivo;( sruoxopiy4optnmfeil(fsDraxro;o1aeeomfcilsfmDemn snu4 rtoio3tatfa  aies;(0t2xr(opou4amt mnvi ()s2tmu oou4apto oeiytfmDeanvp;()artnif ia1la ran i (0 2xrxopiy1apee nctlt  Dtau  oo0tlt  iciasfsDra(monu4alxnmf3todlatrlnei s)sexrxo nudlle  ict t) rurx oot0tlen iciyd m uluvo;u)trenxr3oatlp  anvi;()trxoir3io1ll nmictl(  rtmu o;o4tle  f3tad m2emums t) exoxr3ty1fpD auei;s0trxoxmpou1lpe lnctat) ruaump;u4opx iiciadlm rauvs t4arerio oa1op  aies;t trxmio ny1lpt  icsl( srrax ooo0opeomi3iatfsDrlnvs;u4alxnioctytoa  lnei;s)t2xmimpiudale lnvtl( s2uax pno1ale  i3iaslm umu p;t0 rtnmr ty1opte u slt  2tmxo no4al   ncilt s2taxm ;t1tlxoioetydls rauvp u)alxnmf3iytfmDe ivil()sexo(opoodlme mfviat  2rmxmono1texoiiciltfa rm( pn(4aleoxrctodfaDe ivo (0t2uoio nodlmtnlfci () Dtaxmpnt4tex moetysla eanmpnt0 lxnmf3iy1lm  lies;s t2uoxopiodole lici (fsrtrx o;t0olx  fciyt s em( s;u4 rtnifctytfpD auvo t s2xo(o oudomtnlfcs s sDumx o;o0olen ictat a ua( o;(4 exomo3tatlat auvsl() ruoimpnu1olte neslt) rtrumpnu0aex mietld a el(vs t4tlenmf3ty1lm elues;(0teuoxrpnu4ol nmnesl()a2rrumonu0aleo ietysfs ea( o;u)aleoxociydlat lu s () euriopoy4apt lncsl( a2urxrooo4tltniociltlm2rmnmon()arxnxr3iydopt livols t2toim nodll elnetl() rrr(moou4tee  f3iltfm eluvpnu4tlenmr3ia1la e uvo;t)s2uoirpiodlme lfetl(farua(ronu4optoif3tadfaDel(mp;t4tltnmfcoatlpDranvo s  euo(r3iu4op  lfcslt  2ra(r nu4teenii3iadls2rl( o (0trtnmo oodopte ivolt)trumxo ou4ameelnvilsfsrum(m ou0alxo o3tas aDem(vpnu0 etrmo oa1lpte ivs t)t2xr(o ou1ome lnvias)aDum(r ;o1oltn feiad m2el(mp;(0tetoxocoo1op r u i t0trtmiopno1ame  net s aDrmx pnu1alt  fctadfaDulumpnu0trtomr3ootfaD aivi;s)srtoim ny4lle mivi t a2umx oou4tpxn ociatlaDra(mo (4 rxrif3oo1opDrli i;()s2tmir3oudoptnlfeslt  rur(r ;t0alxomf3iaslsDuan o u0 rxnif3tydfm   uvi;s)tetoim3oo1olen ictas) rum(  ot4opx  fciltfsDemn p;t4alenio tytlptelues;( seurxo iudamtnlfeiat arurxrp;t0ale iocild m eauvp t)trtomo ta1la rlnei t0s2tmxmpoodlmt  fctls s2tmx  ;u4olto fciys s ulumo;u) exrxr3oa1op rlneslt  2urxm iydlltnmicsl(f Drr(  nt0aeen ieias aDrl(vo;u4arxrxo iodom ean o;s  etoxo3oo1omtelnvsls a2tru  ot4tet  ociaslaDul(vp;u)aeermocoadlaDrlnvs s0 rxoxm iudopenlnvslsfsrrrump;o1oexniieiyslsDul( s;t)teerio3oadfaDr n il( texrxo ou1lm  mfet s aDtmumo;o0apenifetlt s emumsnu4 lenio oatlp  au o;() rxo(o3iudol e feslt s2um(  ou0olxnmfciyd aDelnmpnt)texnxo3todlpt ai o;t) rxmim iudolt  ivi (  rtm(ronu1oeeo o3iatlm eaumpn()tleomocoatfm  lnes;( srurxopnodap  lietltfsDtm(r ou1tpxnmocild s2rl(mo;(4aleoio3iotfatr ivolt s2uoxopoo4lmenmicsls)s2trumo;u4tpt mf3iltfsDemnmp;u4aetrxr oo1opte ivolt)trxmir3iu1oltnlivsl(fa2rmur ;u1oex  oetldla emu s t4altrmr3ta1opteauvi (0srtr(m3nu1amt  netas a2ur( poo4tpxoifeiasfa2rmn p;u4 leomr oodfatrlu slt s2uo(opnydam elneiat  Dua( onu0oetoiieiat m2ra( on(4tlerio tatoate i i t0setm(opiodap   ieslsfsDum(mp;u4alen octlsfa uan p () exomrcoy1lmtranvslt sexo(m3iydole liet (  Dumxmono1altomi3ildla eln s t) lenxrciydlpt  u sls  2xm(m3oudamt  fvil() 2rax o;t4alenmictysfsDel(ms;t4 exnmf tatop raivsl(0 rumxmpnodolenlfet tfa2tauro;u1tltoioetls s eluvs;() reoxo3oy1opD li sls0 exr(r iy1oltelivtat aDraum nt0aet  ieilsla2umuvp;u) etrmrciytfmDeauvi;s)srtmimpiu4lmte fvsas)sDrmum nu1oee mi3tld mDulnmo;t0aleomo iadlpDraivo s trxmio3iodap nlictl( s2ra(mp;t1opto fctydfm2eauvp;t0 lenmr3iytfmtr ies;() rur(rpiy1ll  mneil(fsrur(ronu1aet  f3ildfs eau p u4aetniocto1lmte ieilt t2xoio3oo1lmenmncsa()srrauro;o1teeomoetlt a eaums u4arxnxocoatoaD an i t tetriopoo1ll  mneilsfsDtmxr ot1aexn icild a rln pnt4 lermf oytomD lieols srxo(m3no1lmenmfci () 2uaum no1aeeomfeiad sDelnvo u)trermo3oadfaD  u sl( trxrio io1amen feia()sDtrum ;t4oetomoctysfa emuvpnt4 etrmr ia1lpDeanvils  rto(rpiydapeelnvsasfarumx ont0olxoio3ilslmDul(vp t0altnxr iatfp  aneolt0trumim no4lmtnlfeia() 2um( p;o1oetomociasls2elu snu)altoirctodfp eaivi s)s2xoxo3nudom  lfcias)sDururpoo0opeomfctltfaDran s;u4 rerxocta1late uei;()s2tmir io1ame mies sfsrurx pnu1tltomfeild sDrm( p;t0trermf ta1late i o ( tetoxmpoo4omeemiei (f Dtrx  nt1oex iiciltlm umnms t4teerxf io1oaD li s s0tetmim3iydolenmfvs t artmu p;o0alx  o3iyt a2eaumsn(4 renmf oytoa elnvolt)setr(o3iy1llen fct (f rrau o;u0optnmf3iys s2elnvp;t)treoir totfaDelu o;s0 rxmio nodap elnesat srtr( poo4oee if3iasfa2el(vo;(4 lxnir3oy1opte n s;s0 rtmirpiu1lm  micsat a2taum ;t4opxniietlsfaDem( p t4tltnmo3todfptelneolt t2umirpiydalte ieia()sruaxro;u0apt  fciaslmDrlump t0tetoifcoytop  an olt s2umxr iodame livils)s2urx ont1openiieiydfmDumuvs;() etnmf3ootoa eaieilt t2urirpoo1ome mfvt s) 2tr(mp;o0alenmfciyd aDemumsnt0trxomocta1laD  uei;s  exrio iodamt  neta(fsDrr( pou4tlxomfeiytls2emumo u)alenmrcootlmt  u i t0 rxm(rpny4op n fet sfarrmxm ;o1altoio3iytfs2rlnvp t4texnir ta1lp   nvs;()tetr(mpnu1ale mietat  Dum(rpnu4tetnmictlsfmDul( s t4tltnxo ta1lmtrai ils seuoxm3oudal elnesa() rraum ot1tpe ioctatfmDeauvp;u0tltriocoodfp rauvo;t)srtr(m iu4ome mncsls)s2umxmpno4aetoifctadls2ua(ms u4altnxo oy1fa e ies t0seuo(o3io4alt micsls) rrr(m nu1aeeomiciat a2ra( s u)tltnmo3iytfmDrlneo;s0 exrxm iy1lp nmiviatf Dtaxmoou0tpt mi3tltfsDeln o ()tleniociatfpDe ueo;s)srxoirpiydaleelneta(faruax oot4tlxoiieildfsDrau s (4 ltrif3ootla raneo t sexoxr ou4opt mnctasfa2urxr ;o4tlx  o3tatfaDrl(vp ()teenxf3iy1fp  an o () rxr(opny1op emnvsas a2raurono1tpeomociad sDean o;u4tetrio to1oa ean o (0 2trirpno4lpee ieiatfsDtmumpnu4tetomoctas a2rluvo;t)tetnxr3iodfa  ln o (0seur(o3no1olt lfcsat)aruaxro;o0oeeomoeiadla ea( on() ltomrctytla  lnes;(0srtrimpno4lptnlfcilt arumump;t4teenifctatfs2em(vpn(0tleoio3tadfatelu i;s0t2to(m oy4alenmnetat s2raur ;o1apx mo3tlsfm rm( s;t)arxomo3iy1faD anvs t  2um(r iodapt lieilt)s2rrumpot4oetoioetasfsDranmo ()trxomo3oadlaDelivo s)seuoxopiu1op nmfcsas)srrr(rpot4apx mfctaslmDrl(vpnu0artrir3oa1lpDe uvils) rtrxr no4lp n fvsas srumumono1tee mociadlsDelumsn(4 exrmo tatom rai i s) rum(r3ou4llt  fvi s) Dtrur ou1alx  i3tydlsDem( o;(0aleoxrcio1lpt auvo s  etr(opoo1lm nlfvs s)arrrx  ;o4tlx mfeiad s rln s;t)trenmr3tadlmteauvs t sexrir3iy1lpe lfeil( a2tmumonu1teeniociyt m2uau p;t) exnxo oo1fmDeluesls)srum(r3ou4lme lnvt (fsrum( ooo4aptomi3iyd m eaumsn()aeenifciydla  li ilt)s2um(o iudlpe  icslsf rraxrpoo1oltomo3iys sDumnmo;u)trtnirciydfmD luvol(0 exoxmpnu1apt lnesls  2umx  ;o1oltomiciyslmDrmu s u4 exnmr3oatfpt  ies (  eumir3ou4olt  nvsl()sruaxro;u0apxomoctyd mDea( onu4areoio totlpteaieo;s)s2umxr3oo4ape  icsatfaDrau  ;u0openmieiytfa2eanvsnu)texrioctadoaD  uei t texm(opno4op  mivslsfs2taxm ;u1aeto ictad m2rl(mp;t)tlenmf3ootfm   n o;t0setrir ou4am nmnvtl(f Dur(mooo0oetomfeiadlm rmnvs;t)trtniociadopDe n s;(0trurxr3oudoptemfei s  2rauro;t0oeeoiietld sDrluvp;u)trtomr3oytla rln i (0trxrimpoudameelnci s)s2taurono0tlx mi3iysls rmu o (4 exoxr3iytlat lnvsls0s2trxm3ou4ap e ieta(  Dumur oo0aptniieiytlm2ra(mp u0tetrxfcoadfmD au ils texm(r3iodol emicsasfaDta(ro;t0oeenmoctas s2raumsnu4aeeomr iy1faD livols srxo(o3oydll e iet sf rrrurono0aptoiiciyd s2ulnmo;t4 rxnxo3oydlmtrln il(0tetoxopio1lpenmfeslt)sDtrxmpoo4oex  fetyt s uluvo;u) eenmr3todopDrlivol(0tetoxr ny4ale lnvtat  2taum oo1tlx  ociyslm rmumsnt0teenif iodlptrau s () ruoirpny4ope lnvias srrrumo;o1alxo ictad s2eau p t0arxomo3oo1fatran s;t t2xmxr3iy4al  mics ()artaumoou4tlx mfeiad sDum( o t4 exoiociodlp raueols  rtmio oudamteliei (fsDtaum ot0oetn ociltfmDeln s t0 lerif todfpD  n o s) 2tmio3iy1ameelictat) Dua(m ;t4apen ietldls ea( ont)aetoir totfpt  ivi;t)sexmim3ou1ol nlfeia(faDtru pou4tlxn o3ils a eanmo;() rtnmf3oadomt aieo;t)trxm(m3no4lle mietltfsDuaxro;o1opx miciyd aDel( p;t0alxoxr3ty1lat auvo;t0s2ur(o iydomte fci tf 2rmumpnt0alxomfeildls2uanmo;t) lermrcio1fa elu sls)srtrir3oy4opte iesl( sDur(r ;t0olxn fctadlsDuln o;u4trtriocoy1lm raneo;s) 2xrim oy1am  lfci s s2rmxmpnt0tetoif3ilsfs eanvp u0aleomr3tydfpDelieo ( trtmimpoo4lptemfes (faDrmu  ;o1aptn iciaslsDuanvp t4tltoir tatlmtr ueslt s2uoxr3oodomt mietat sDumxr no1apx  iciadfs el(msnt)altrxo3tytlptranvilt0 rtr(r3oy4ap e ici tfaDraxroot1opxo fciytfs2emump () leomo io1faD ai s t0 2toimpoo4lptnlnet (f ruaxm ot4opxo fciytfm ulnvs ()areomfciadfm raivi ( trumxopnu4olt mneilt a2rmur ot1oexo ietlsfa rluvsn(0arxrxoctadomD auvi (0s2tmio3ou1ll e ici (  Dua( pnt0tee miciyslsDra( s;u0tlermociydop  au o s0teurio oodllt  nctas)srum( poo1olt  f3ilsfsDeln o t)arxoio iodlmtelnvils t2xrxm3nu1lme  feta()a2rr(rpou0oltomfetas sDul(mo (4 reomo3iytomt livil()t2xrim3iy1am   netl() 2urx ono1opxn o3iyslmDrlnmpnt)tltnxocoatfatrlnvo;t) rxm(opoudlpeemfeias a2taxmooo1aex if3iytlm2ea( p u0tetnif oytfmDe ivi s)trum(mpnudlp n nvsl(farraxronu1tetnmi3iatfm el(vo u)alenmf ootomDrau i () etr(r3nodapenmfeslsf 2rrxm ou4opxnifeiydla umnvs;(4aeerxociy1lpD aueo s trtr(r oy4lm nlfvi ( s2umumont1tpeoifciad m ra( s;(4aetnmo3io1laDelieol( s2uo(rpoo1omtemfvtlt  Dum(moot1oexomictls a2emn s;t0aeermr3oodfpDeli o;(0seuo(m3oo4op  liet t srtax  ;o4teto o3ils a ul(vo t4aexomo3iy1optr ieils srur(r oudaltnlnct ( s2rmu pot1optniicild aDel( o (4 ltrif tatoaDeauesls0srtm(r oo1apt mfcs t)a2uru  ;o4oexoifeild aDelumpnt) lerxf3tydfa e ueo;(0trtmxopny4ol n nvi (fs2rru  oo4oeeo oetldfa emuvp t4trerxo oy1opt  nei s t2xr(r3iy1llen ncsa(  Drmu ont0teeniietasla ua(vo;()areoio3oadlmDelu o s sexoiopoydoptnmics t)a2tru  nt0aee ii3iysfs emnvp u0aexoioctydla eauvi;t) rxmxr no4am   fesl(faDtax  oo0ole  fciltlaDulu ont0trtrxrcoa1fpte nvol(0 2xm(r3nudol nlfcsatfa2rmx p;u1apeomo3tytls2rm(vo u0aeenmf oadfpDraieil( srtrim3no4om elivtls  Dtaxmp;o0altnmi3tltfaDuauvs;u4 eenxr oytop raivs;( s2tmxmpio1lptelnctls)a2umu pnt1open fciad a2ul( p;t4arxnxfciatlpDeanvo;() etoxr3ou1al n fes ( aDta( o;o4apxoifcilsfa uluvs;()tetomf oy1fp   ieol(0t2tmxmpno1ole lnctl(fa2tm(rp;o1tltoif3tytfsDrauvs;u4aexoxo3oa1fpDrlies s texr(opiy4optnmictas)srua( o;o4apt  fciytfmDeanmp;u4tetrmr3oytfaDrlivs;s) rur(m3iodll nlncsa( aDumu  ou4tle if3tlsfa2rlums u)trxrmr oatfmDraues;s) rtrimpoy1amenlfvil(fs2trxrono1tlxnii3ils s2uluvpnt4tlxnif iatfptelnvols s2uoxm ny4oleemictas a2ururpnu4olenmoctasfs emuvonu0teerxo ootlm e ieo;s0srxmxo3nydameemivs sf 2uaxmpno0olx mfeiatfa rl(vo t)tlxnmrciydopDe i ilt)tetoio3nodlle  iet t)arumxmonu0ope ii3ilsfs emump;u4 lxomr oydoa  lu i s  etrxopno1lp elnes ( sDrax  ou1apto oetlt s2rmnvs u0alerifcoodfatr uvi;(  2xmxrpou4olt lieslt  2umx  ;o4tpe  feiysfs2ua( pnu)aeermo tadfm  lneil( t2toim3oudol   ict sfsDrax  nt0altn fetldfmDeauvpnt0teeriociy1oatrauvils)sexr(m oodal nlfeias sDtau  ;t0texnifcilslm2umnvo ()teeriociytlaD an i t tetriopiodameelnetlt s2uru poo0oex ioetlsls2rmnms;() ltoxf oa1lmte iei t0tetm(m oo1optnmfct (fs2ta( pot4aet ii3iyd a2ea(mp;u0areoxfciadfaDelnvs;t0trtmxm3ou4olt lfvsa(fartm(rpnu4aexoif3ildfm um( p;()arxrxo3ootoa rlivils t2xoxr3oy4om  lnvtlsf rtrxmp;o0opx  icildlmDum(msn() eermfciadfm eaneo;(0trxr(mpio4llenmicsatfarur( pou1aeto i3iatfa2rln ont)texomr oy1lat  ieo (0s2xrim oudamee ictl()a2taurono4olxnmoctasfs eaumont) eeomoctytoa   ieo;()s2tmio3io4lm elivtl()s2tmumonu1apeo oeilsfm2elumo;u0tleoio iatfmte uvs;s t2xmio3iu4amte ivslt)aruax pno1tptnmf3tlsla ulnmo;u0alenxrciytopDraies;s)s2xo(r oo1llenmfctltfaDtr( pno4apeomf3ildfsDrmn o;(4tlxnmrciotfa ran sl(  2xoim3oudlm elfvta( sDtaum nt4alxniiciys sDra( s t0alxoxocoytfptr iesls setoio oudlltelfcta( sDra(m ;u4alx iietlsfa2ul( s;(0aleoio3iy1opteln i;t) 2xmim3oydame mnesa()s2rru  ;t1aptomoetlt mDraumpn(0 rtomfctodoaDr neo s0seuoim io4lmen feil(fsrrrx o;t0texn ieiysls rlu p;() ltomf tydoat  ieilt0t2toiopoy1al n ncs tf 2ta(mp;u0aptnmfeiydlsDum( p t4 ltniocoodopt anei;( texoir iydlme livt (fs2tm( o;u0alenio3ias s2el( snu4tleniocto1om raues s0 rxmxo3iodaltemiet s) 2uaumo;u4oeenmi3ildfsDrl(vs;t0 rtniocoa1faDelu o;(0 rumio3ou1omeemnei (f rtau  nu1oexn oetasls eaumsnu0trerxr oydfpt  i s;(0setoim iydlpeemicsatfsrtr( pot0ope mfciysla2raumpn(0texnirciytla r nvslt teumim nudlp e ici s) Dum(mpnu1optoiieils sDrauvpnt4 exrmfcio1latran o (0srtmxr iu4lltn iciasfarur( pno0tltnifciadlaDel(vo (0teerxf oo1oaDrau ilt srumio3io4ll  lnes s srraxrpnt0aexnioeiat a rl( snu) eenmo ta1oa rln s;s  2uoxmpoo4alee fvsa()s2uau  nu4tptn ieilsfmDemu pn(4arenmociadoaDeau sls)texm(o nodlm e feil(  2trurpou0aetnmiciytfm rln o t4texoxrciytlpDr i i t)texoirpoy4am nlfvs sfa2rm(mo;u4ape  f3tat m umnmo t4alenxociytlpDelueilt0 2xmxr nydalee ncia(faDumxmp;u0aptn ieiadlm2rmnvp;u) reoxfctydoatrlueo;s0teuoio nodlp nmfvt (  2rau  ;o4olt  ietydlsDuaump;(0 lxoxr3tytfat  uvs;t0s2toxr oudom emneias  2taxmpot4aetnmoctyt m ulnvs ()texrxr3ia1op  lies;t0seumimpoo4lptemnvslt)s2rmx p;o0opxoioctytlaDuan snt0 etnxf3oytom rlivslt) rto(o io1ole miet t srtaxr ;o4oee mi3tldfa2eln o (4artomo3iatlp ranvslt0srur(mpoo1lmeelfet t)a2tax p;o1oltn i3iadlmDemumo;t0 eerxfcio1lpDr nvs;(  rtmir3ny1op n icsltfsruauroot1teeoiietatlm rmump u4aetoxfcoa1omte ivol(  2xriopiu4lpe  nvias sDtax  nu1altn f3iad s ean o;(0tetnio iodom r n s (  2urxr3ny1lmt liet s artrxmpnt0apto ictatfa umn snu4altrio3io1lpD aueo;()trtmiopoodlp  lnes sfsDuauront4alt iictat sDulumont0tlxnmf iydoaD  n o s0s2xo(opoy1amt mncta() 2ta(r nt0aetnmociytfm2ranmpnt4artoxr3tadlmt auvi t)texm(mpoy1ope lfesas)aDta( o;t0oetomi3iyslaDum(vsnu0 ltoifcia1lp raiei;s  exmxr nydlp  lfesas  2rmxroot4tpenifcildlm rauvpnu) leomrctodfm  li s s) ruoxm3iydalee ivsat)aDuaxrpoo4tptomoctls sDem(msnt4aetoir oytlm rlivs;t  2xr(r3iudaptnlnviltfsDrm( ont0tltomiciys m rau o u4tetnxr oytopteaivi s  2xo(m3nu4amee iei s)a2tm(ro;u4tltomietldla ea( o;t0teeomf oatlateaieo s0t2um(o3ou4opt  net t)srta(rpnu4aee mf3ildla rm(msnt0arxnio oo1fm ean i;t)sexr(m nu1lmenmnvs ( sDur(mpnt4openifctas a rmums t) exoxrciy1fpDe uvils t2trxopiu1altelfciasfaDrmxr nu0teeoioctat s ranmp t0 lermr3ty1lp rlnvs;t  2tm(m no1olt  fcilsfaDrmxrooo1olenmo3iytfa2uan sn(4arxoxociatfpDrlies;s0trtrxr no4lpenmnei t) 2ua(  nt1tleo icild sDuanmont)tltoifctadomDeli o;()srtoio iy4ale mfetls)srrax  ;u0apenmiciasls2elu p;t)aetnif3iy1opDraues;t trumiopoo4ape lnciasf 2tmumono1opxniociat s el(vpn(0alxomf oatlpDr nei ()s2tr(o3nu1aleelfesasfsrtr(rooo1tptn iciaslm ra( o ()texrxrcto1om   ies;s)s2uoxo iy1lptnmnetlt sDrau ooo0tpxomf3tltfa2eaumonu) eenxrciodfp raivs t  2xm(m3nydam nmivs () rtr(m oo0oet  ieilt a um(mp u4alermf tadoat auvi;s t2urxm3nu1open fvs sf rurxm ;t1oexnmi3iysla ra(ms t) rxnxociodfpt lies t0srto(rpoy1om   nes s  Durxrpnu4tee  f3tyt s um(mp u4 rxoircoydfm eluvs;t)setrim3oudlm nmfci t)arum(ro;u0alxnmfciyt a2rmnvp u) eerifctydoa rlues;(  euo(m3no4ameelnvtls  2ur(r no4ape moctyslaDum(vpnu) lxnmfcio1omDeauvs;(0srtoxrpoy1ll emfvi t)a2tr( oou1oeen feiadlsDem( p;(0aexomf tytoa   ivolt0truoxr3oy1omtn netl()aDurumo;t4texn oeiytlaDrl(vpn(0aexrircto1latraies ( seuo(m3iy4aptelnct t)aruax  nu1aexo feild s2uluvpnu4 etomf3oodla r uvs;()texoir oydllt  iesas)aDua(r ;o4aetniocildfa2emumpn(4 eeoir3ta1lpDeaneilt0texo(m oy4open nvtls) ruau o;u4altomiciydfs2rm(vsn(4 rtoxo3tydom rau s ()srur(o3nu1lpeemfviatf Durxmo;u4tpx ii3iyslaDeln s;u0 ltoir iotla  li s s0 rxo(opiydlptnlicta(  rtaum ot4oetn icilsfs2rm(vo;u0trxnio3ty1oaDelu o t t2umxr3io1op nmfcs s sDurx  ;o0tee  ieiasfa emn p (0teeoxocoodlaDranvs t0tetoxr oo4om emfvta(fa2rmxr ou4opxo oeiatfsDrmnvp t0trtoxr oa1omt au ils0 eur(m oudlpe  nei (fs2raxmo;u0oexomi3iltlsDra(vpnu4trxrxrcoy1fptrlivs s srxrxo3iodlptn icilt) Dta(r ;t0tlen iciatlmDeluvs;t) lxomr3todfm  lues t s2xmxopny4lp e fviat  Dtaumpot4apenifeiadfsDelnmp;u0 lerxfcoytfa  li ols0tetrxo3oudlltemnvta(farta( ont0olenio3iys aDrl( p;() lxomrctadoptr nvs;() exrimpou4altn ics ()srurur ;t4alxnio3ildfs ea( ont0 etnircio1lmtr i o;( srtoxmpny4lm nlfetatfsDrmxronu4ole moeiasfaDran sn()artoxocoadoateaueo (0t2xr(m3iu4lpen ict ( aDraurpno0tlxnioctltfs2emnmp;t4texrifciadoatrau i;t trurir iu1altemnvt tfsDrrxm nu0tlx iieiysla2ulnms;(0trxoxociatfmDe u o;( s2uoir3oydoltnmieia(f 2rrump;u1opx ii3tyd a2rmnvs t0aeenxr3iotoaD  iesl(0setm(r3nydole  ivi s)a2um(mpno0ole iieiltfm rmu s;(4 renmf3iatla  livs s)tetr(o3iydllte nct s) rtm(  nu0tetoiictyd s ea(vpnt4trxrmo3oodfpD  u s s0sexmimpoy1opt lfct ()aDrauro;o4tlxn i3iydla2rm(vs u) rtomfctatomDeanes;t)seur(o iy1ol emictatfsrra(mo;t4tlenmfeiad sDrm(vonu)treoxr ta1faDelu i s) etoim oy1om  lfvilt aDra(  nt4apxomf3tasfmDum( s u4arxoir3ootlpDrlneil(0 rtm(m3iy1lpt  fctat)aDrr( p;u4aptomicild s ul( snt0arxnmocoytla  luvs;t)teurxr3oudlmeelnvt (  rtmx pou0opeomi3tad sDumuvpnu0 rtniociodop elues t sexo(rpiu4om e ieilt aruax o;u4ape mfctldls um(vs;u4altniocoadlm rlu i;()s2xrxmpnudomenlietas) 2uau pot1aeeo o3iasls2umnvp;t)teeoxrciytlm rlnvs;s tetriopny4olenmfvsat)sDtaxmono1tptomociatfmDeluvont4aexoio3oa1opDe nvs t trur(opno4amte fcslsf Drm(m ot4ole io3ildfs umnvp;t4texomf oytfmD aueols)sexrio no1ap e ivta(fsDuau  ot1ope mociatlm eau s t0aeeomociadlatr i s;t)texmxm3ou1am nmnvt (faDuax  nu4apxnmicildfs rmuvp u)teerio3ia1fm rai s t0 2umxo3iydlmenmivtls) rrrumpnt4olxn feildfaDrlnmo u) rtrmr iadfmt lueolt0srxr(rpnydaptn nctasf Dumu pnt4aex ii3tas a eln s (4tetrxr todomteai sls)t2xo(o iu1altelici tfa2umuroot4teeo o3iatlmDelump;t4aexoxr iy1laD aies (0 2xo(o3oudlmtn ieta()s2ua(ront4oee ii3tldfs2eauvp;(0alxoxfcootoaDeanvils0 2uoxmpoodlm  mnesas s2ta(r ;t1texnmoetadfs2eluvs ()treoio3tytlmDe ivil()t2xm(opou4om  mics t)s2rrxmp;o1apx  ietyslsDumuvp t4 leoxo3iytomtr ivs;s t2trxopou1alenmfcsls s2ua(roou1apx  fcildlaDrmumo u0 ltnio3ia1fpt  ieols seurio oydam n fct sf rtru poo0teeo f3iydfmDeauvpnt0alxnxr oadomDr iei;( srtrirpnu4altn iesltf Dtr(ro;o0texomiciytla2ea(mp;t4tltnif iodfp  ln o;s0trumim nydlm  lfvt t  Dtmu  oo1oeenif3iys s2umu o u)aexnxo iydlmt aues t0srxo(m3no1ap nmnvta()s2rax ono4alxnioeiysls ea(mp t)altnmrcoytfm rli o t srumxrpio4ol  mfesls)a2uau ooo1ape ifeiytlm umu o;u)arxrmfciytlpDrauei ( seum(opnudomt mnesltfaDtaur oo1tle  ocilslmDrmnms;(0tltnxf3oo1fatrli s;s) etrir oo1opeemnvilsf rtrxro;t0teenmf3tlsfm rmnvp (4tetrif oydfmDr uvo;t0teuo(opiodapee ictlt  rraxrp;u4teeoii3tas a2rm(vsnt4tetomr3iatlaDrlnvi (0 etr(r3iu1omeelfvtls) Duaxm nu0alxo fctlsfs2emnvs;t) etnio3ty1lpteaies t) etm(opnydopeelfeils) rta(rooo0tet io3tlslm2rlnvon(4aetoif ty1optr i il()trtm(o3iudop  livi ( sDrrx oot1oltoiietaslsDean ont4tltrmrcty1fa   nvslt srxm(r oy4lp emneil( a2ra(r nt4oex  fctls a umu o;t)tlxomo3iytlatraivil(  rto(opoydol n fcsls srtaxr oo1oexnii3ilt a2ra(vsnu0arenmr3ta1late ieil(0 etoimpoy1olt  fvi s srumx  ;u4alenifeilsla eanmo;u0texnmf3iodfpD lueo ( t2xoxo iy1lle mnct t) 2ra(mpno0tpt  ociasls2el(ms;t4tltnio oodlm raivs;t trum(r3nodop   nct t)a2taumoot4apt iiciyd m2rlumo;t0 ltrxr iy1fa ranvo s  eto(o3iodalt mictas arumx pnt1tptniociatlmDuau onu0aleoir3iotfmtrlivols)s2xmxmpoy4llee neiasfsrtm(m ;o0apeo oeildfs rl( s;t0trxnxrciotla  ln s;(0trur(m3nudolte fct tfsDrau ooo0tlx  f3iyslsDul(monu0trxrxr3oa1fa eaieo;s  euoxm io4lp nmncsl() Dururpnt0aexomicildfmDel( snt0 reoifcoytlatrliei (0srxrxo no1lmenlnesasfarurx ooo4tlenmfetydfs umuvonu)altnxf3oadlm eanes;( trxr(o oudaltn iet s) rtrumoou0teeoiicilt m umu p;() exnmf ta1om   neols teurimpiodomtnlnci ( srraur ou4ape  iciys m rmuvpnt4tetnmr3ootomDeai o;s trtriopnu1lpt lici ( a2ra(  nu1apxo ociadfm rmuvsn(0trxrmfcoo1fa e iei;(  2tr(m io1lleemies s s2raum ;u4opxoiocildfmDelnvo (4 exnmoctytoa e ieo;t sexrir oy4omen nvsls sDurxmo;t1olen ieils s2uau p;u) exnif iydlpt  nvi (0 exmio io1ol   fesl() 2tmxroou4tle  ictltlmDem(monu)alxomo3oatop  livs;t0 euoim iu4omen ictl() 2raxrp;u1aleo feiydlsDrm(vs u0 renxoctadlp e u s;s)s2urio3iodlptn nvias a2rmxm ot0tptoii3iyt s uauvs;() lerxr iy1oat li s;()srurxm3ou4apte icils s2umxr nt1apxnifciydfm em( o t4aetnxo3oodom  aieo;( t2xm(mpoydapen fvsa(fs2ur(mp;o4olt if3iyslaDeln p;u)aeenio3io1lmDrlneilt)s2xm(m3io1ap  mivsat)s2um(m no0altn ietysfaDea( pnu0 lenxo3ty1lmDeaivs;(0s2xo(rpiudoptnmivsatfsrta(mo;o1aptnif3iysfa2rmu p;u)trtrio iotom e nvo s0srum(r3ny1oltnlfciltf Drrx o;o4aleoiociytfsDrmnms t4tleomfcoy1op r ivol(0 exmxm nodam nmiet t)aDrrurp;t0tpxo fetlsla rm( snu)aeenxrctadfat lu il(  rxrxrpno1omee nvta( sDrrur oo4tleoif3tadfa ua( p () rerio3todfpDelivi s)srum(o3iy1olenmnvt s)s2rm( o;t0opto i3iasfs ul( p;(4 lenmo3iy1om  li i;( texrir3iu4om n netlsfsrurur ;o1tex  iciydfa2rau p u0treomrctadop e neol( t2uoio3nu1lmeemnvils a2umxr ;o1tlxomi3iadlsDemnvs (0artnxfcoatlaD aieilt t2xoxrpno1alt licsas a2uax pnt4alen fciltlm eanmo;(0 rxrxf to1lpt aues;s  eumxopnudomenmicsltfa2trxrpou0apx iiciatlmDuln on(4alenxo3oo1omteli i;(0seurxm3iu4lp n iet ( arua(r nu0oetnmfeils a2ra( ont)trtrmrctodlm  aieil(0srtmxr iu4lptelnct t srua(moot4texnmoeildla2rluvpnt4 eerio3iytlp rli o t setoxm3iodlle  netl() rrmu oot1aeto o3iasfa ran o;(4 rxnxrcootfm  lueo;()seurxopiu1lle  fvi s  Dum(r ;o1opt mfciyd m2eau s;u) etoif oytlpD lnvol(0 exrxr3oo4lmtn icsl() Draxrpnu1tlt  fctls mDulu ont4altnxr3iydomt ai ol()srtmimpno4aptnlfesa()a2tmu  ;t1tleoifcilt mDulnvsn(4 eermf iydoaDrlivol() 2xmxr nudlme livt sfs2urum ;o4alt  iciat a uan s ()aexomr oytomD lnesl(  2xm(rpiodaleelieiatfarumuro;t4tee mfeildfm uln o;(0 eerxr3io1lptelnvs ()trumxrpio1opt  ivtas) rtrxrpnt0ape iietadls um( o t0tleoir iodoaDeau s;s0srxoiopiydam n fviasfsDtaxr ;u4tee  i3ild m2uau o t0 ltnxf3ta1fmD  ues;t0 etm(o3no1al emivia( a2rmurooo0opeomfeiyt s eaump;t4tetoxocoa1faDean s;()t2umir3ou4ole liei tfsDrr(mooo4apxnmietydlmDelnvonu)trtnxo3totfateluvi;s s2xmirpio4om elnvs s srum(  ;o1tpxomoctatlm eaumpnu4tetrircio1lp r i i;t0 2xrim ny1open icta(  Dua( poo1tlxn oeiys a2ra(mp;u) rxnif3oy1oaDe ivilt t2xo(mpoodlp   fesltfaDum(mpno4altnmoeiyd a2um(mp t4arxniocia1fmDrau sls  2xrxr ny1ap n netatfsDurxmpou0aeto o3iatfa ulnmsnu4 exrmf iotfa   uesls s2tr(r iu1ome  nctat)srurumpnt4tlxn f3iytla el(mp;() reoxo oa1op  luvi;s0 2xo(m3iu4lmtnliviat artru pot1oeenmietltlsDelu p u)alenxr3todopDe uvslt)teuoirpnu1lme lictls) 2uax  no4aex mo3tytla2ua(mo;u4texrmr3oytom eluesls t2um(r iudlm n ivta(faDrr(moot0tpeoii3iydlm ra(ms t4arenxrctotom rau sl()setm(r io4lmenlivil()sDraur ;u1apx mfeiys sDul( s ()aleoir iytfaDr ivo ( s2to(rpoo4lp nlicilsfsrua(mpnt4olt  o3tydfm2ra( o;u4aeenmo totlp e nvo;(0t2xoxo3iu4lm nmneiat artmx poo1tlt mf3tls aDemums;(0 renxrcoadfpDe u slt0t2xrir3iudop nmivtat) 2ur( oot4tetn o3ildfa2emn p;t) lerxfcio1laDrlnesls)t2toxr3oudap nmnci t)srurumooo0opto oeildlaDran snt0arenmo iadfptrlies;t trxmxo nu1omen ics s)a2tmuroou1oet  f3tysfm rlnmp t)texnxr3oadomt aivo;() rtrxr3nudoptnlicsls)s2uaxmoou1oetomoeilsla2ua( snu0texnxfcoo1lmDeluvi;()teuo(o3ou4ap nmicils)s2tmxr ;t1aexomocild s2ea(vonu0tetrxf oa1optean ols0s2toxo no1alee ivilsfaDraxr nu0aeenif3iat mDrl(mo;(4trenxr3io1lp  ai o;t) rum(rpou1lmt mnvt sfsrumxm nu1aptnioeiasfa ean o;()artoifcootlmtrai ils  etoxrpnu4lpee fct (fs2tr(ront0oet  fetatfsDuan p u)aetnmfcia1lp r uvo;(0 rto(rpio1lltnlfcsls) 2urur ;t4aptomociytfa eau p;(4tlxomfcoatom raieo (0t2toir3oydome miei sfsDtr( o;o0tlto fciadla2umums;t) etomr3iytomtr ivi ( tetmxrpno4ol n ncsltfa2ta(rpot0ope ifeiydfa ranms;t0 eenmoctytla raivsls srtmirpnodll n nes t  Drmu p;u0tpen oeiat a2uaumpnt0tetnxrciadlp r u sls0teur(r3nydlltemfeia(fs2rm(ro;t0apenifcils m um(vo;u)trxniocoo1oate n i s0t2to(m3iudale  ncs s)aruaxrpno0tle ii3tlsfmDuaumon(0artoirctytfmDeai ilt truriopnu4aptnmivta(fartmx  ot4apt miciadlm2rl(vp;(4aeeomo oydfm ranvi (0srxrxopou1lpte ieil()s2trurpno4tpxnii3taslmDem( o;u)alxoxo3oa1fp eai s () etoxr3nu1ol eliet (  rrru o;t4tlxoiictatfm2ulumo t4alxriocoa1fmt  iei;s seuoxopny4openliviat  Dtmxr ;u4altomieiatlsDemu s (0trenxo3todom eli o;t tetmir nodlm emivtls s2tru ono0olx  i3tad s el( ont) etrmf3ty1la  lnvs t  exoio ou1am emneias)sDumxmp;u4aeeomoctysla2um( onu4aeerxf oatfaD  uvolt s2xrim3nu4ol n nvias  Drax o;u0opxn fctadfsDrl(vont0aetrxocoo1opDeauvo t0seumxr3ny4op nlfcta( a2ur(ro;o0optoiieiadfsDrau pn(4texoxf3iotopD ln o;t) rumxrpiy4amtn nciatfsDtmxm no4altomoetat a eln pnt4 rtnmfciadfa rau i;t0trtriopnu4ole lfvsas s2uaxroou0altnmociysfmDeaumpnu0treoxf3oa1fat  ivo s  exoxo nu1apt  fvt (farumxront4tpxnioetad sDrl(vsnt4 rxomocta1faDelivs t t2trimpnu1amenmfeia(f rum( pot1open ieiyt aDumuvpnt)trxnifciodfaD  u i;t) exr(o3nu4ol  mfvi ()a2taum oo0optomfcilsfa2ulu p u)tlxnio ta1omDeliei ()sruo(rpiodom   nctl(fa2umum ;u0tet mo3tadfsDuau s t4 etrio iy1lp e u s t)trtrim nodamte nvilt sDumx  ot0openmfcildfs ra( pnt0texoxocoydfmDraueo s  2tr(r oy1omte nctl()arrmu p;o4teenmf3iyd sDeluvs;t)tltrxf3ootfm r ueo t0sexm(m3no1openlict () rtmurp;o1oee mociatlsDea(vp;t0aeeomr oadomD aueo;(  eurxo3ou4omen fvsl(farrr(monu0tlx mfciltlm eauvo (4 eeomr tydfpteln o ()setmir3nudolenmivia( artmxmo;o4tlx moctltfa ranvonu4tlxnxf3iodlmt aieo s0tetmxm oy4am  mfci s s2um(m ou0olxnif3ilsfs2umuvp;(0altnxo3oytfmDrai s;( 
\ No newline at end of file
@@ -0,0 +1 @@
+ivolt0 2umim3oy1ll  miet t)aDtr(  nu4oex  o3ildls2uluvpnt4arenmr iydlmtrai o;s)setrxm ny4lpenmnctatfaDraxmono1tee ifeiad sDeaums;t4 exrifcoytomteanvo ( tetr(o ny1lltnmnctat arta(  ;o4opeomiciadls2ul(vo t0 lxrio3ootlmtrluvo;(  2urio3ny1openmfciasfaDrru  ou0aexo f3tlslmDraump;() lxrmf3tytlaDe n sl( teumxopiu4ap  mncsa( arumu oot0tpenmi3iaslm2elnvont0alxrifciodoat auvil(0 etr(opiu4lpe lncs t  Drmxmp;u4alx mfctad m ra(vs u4trenmfciytfmt  u olt0teum(mpoo4ope mfeilt)sDtm(m ;o1tlx mociasls2rl( p u) lermocty1fmDeanvol()trur(r iy4am elics s srrru  ;t1openifetysfaDraumpnt0 ltnmf3oa1fp rlueols  2xmimpiu4lm  mfcslt) Dtru p;t0oetoiiciytfa uau o u)trermo3tatfptelnei (  2xmio3ou4lm elfvs ()aDtmu  ;o4opt mfetadfa rmn p;u) lxnmr3iadlpD an s;( s2trxmpoo4lmenlfcs tfs2rmxm ;t0tetoiieiad s uauvon(0 etoxf3oatoaDeai o s0trtmxrpiu1aptelfeils) Dta(r no1tpen f3iat a2umnvs;t4tltnmf iytlptran s;()texo(opno1oltn fcs ( artr(  ;o0altomi3ils a ra(vo;t) lenircootfmtelnvo;s0teto(o nu1omtnlfvs ()aDtaxmpnt4tptnmieils s2rmnvp (0texoio oo1fmDrauvo t)trxrim oo1lleelietltf Dtaur ot0aexn o3ils a2ran ont0trenir3todlpt lu i;t0srxr(opnudlpt  fvsl( arta(rono0tpen fcilslaDel( o (4 exoxo iodfmtrlivil(0t2umxm3iu4olte nctasfsDraxmpnu1tptnifeiyd s ulnvp;t4texniocoatlpt  n s s t2to(m no4lp e nctls a2rax  ou0oet  oetadfm2rmuvon()tetnxr ta1fpDrai s s0trur(r3nudllee fci (  Dururpot1apx  ociydfmDel( o;t0texoxr ia1faDelivi s)teuo(r3nu1omeemfvs s)arumu p;o0aexomi3iadfm2rmumpn()aetoxo3tadlp  lies t  2um(r iu1op  lfeiat  2tm(m ;o1alenmfcilsls emn o (4 rtnir oytoptrlu i;( t2urxrpiodome mfcsls)s2ra( oou4oexniieiat aDulumsnu4teeoxo ootom ranes;t)teto(mpoydlmeemivi s) Duaxr ;u0ole mfciys m ua(msn()arenifcoy1fptrlieols)setrir oy4am   ncsat  Duau pnu1tlto ictat m rmnmp t4alenio io1fpDrauei t0t2urxopoodlme lfes s srum( pou4apxn icilsfs ra( s;t)aexrmocto1omt  uvol() euoim iy4ll n feia( arurumpot4teeomictydla uauvp;u4 eenmocootla  aies () etriopio1lp n ncias sDua(m ou0aeeo i3iadlmDuln s t)aeermo3ty1fmte u i;() rxr(r3iu4optnmivt ( s2rau onu4tltnioctld a elnvonu4tltnmo oytlateli il(0 rum(mpny1lm  mncs (  rtm( o;u0aexnmfeiatfa rln s;(4trermoctadla  lneils0 rxrxm3ny1opte fctlt)sDrrum nt4olenifctasls2ul(vo;t)tltnir3tydfpD lnvi;( texrio oydlleemfvtatfsDurxmpou0tlxo i3ildlmDelnvp t)trenmf oatfp  lueo s0trxr(r iu1lpe liesls aDtax  nu1apxnmiciltfs2uanmp (4 ltrmf3totlaDr nvo s s2uoxo oo1alen nct (fsDua(mp;o0apx  fciadfs umu on(4arxomr3totfaDrlieilt0srurio3ny4llt mnvt t)srua(m no1ole  fctyslm rau p;u) lenxoctadfateai s s) 2tr(m3iodlpt mict sf Dtmur nt4apt moeiad a umnms u)aeenxf totoateaieslt) ruoxm iodlpte iciat)srtaur no4aptnmf3ild s eau onu0artrmrciodfm  luei;(0t2uoimpnu1omeemivsa()s2umx o;o1tlenmi3ilsfmDuau p;u0aleoiocoa1fpt lnvo;(0 etmxm3oo4amtelfcias arumx  ou1alenmfeiatfm eanvsnu4arxrmr3tydfmDeaivi (0texo(o3iodlme lfvi ( sDtmx pou1aet mictlt a emuvo (4tlxoifciodom e i o (0teuoir3oo1ape mfvsa() rua(rpot1tle  i3iyd a rmnmp;u) etoxo3ta1opDr n i s)s2toxopiy4oltelnet () Dtauront1oexomoetysla2rl(monu0tlxrir3iadlpDrlieols0 eumir3ny1lp emncias a2ururoot4tpenioeiaslmDeluvo;(0tltrxoctytlmD  nei s)t2to(o3iudopeelfvtat aDraurp;o0tex iictyd aDra( ont0texrxo3todfp  lues;s)sexo(rpny1amtn nvslsfsDrrumpoo1aex  ocils s ra(vo (4trxomf oo1lmtelieils0 rtrio nudoltnlfvtatf Drm( o;u0oleomoctytfm2rmu pn()artnir io1lptrluei t srtmim3nydlmt  fvslt) Dra(  ou0apenii3ias m uauvs u0 rxrxf oatfp ranvsl(  2xoio3io4al nmieilt sDur(rpno1tle mo3tlsfsDumnvonu)trxomfciadomtrli i (0seur(opio4lm   fvs tfa2urxm nu0alxnii3tasfa emums (0tltoxf tytfmDr i i ( t2umxm3oo1lp  mfct tfaDumxr no0opxn ociytla2em(vo;t0 rtnxociydlpDraivolt0srtr(rpnodolenlnviasfa2tm( ont4apxo ieiys aDuauvpnu0trxomr iatom r ivil()trum(opnu1amtnmictat  rrmur ;u4tlxomiciadla elums (4trerxr3totoa  an ilt sruoio iydal emivia()srtmxr nt4oexn i3iltlmDumu snu4 renir3totfaDeli o t0trtm(opoo1altemiei sfaDtax  no0tpx mf3tltfs2elumpnt4aetomrciatla rau o (0t2xm(m3io4op nlfeia(fsrtr(r nu4oexomo3tld a elnvs;(0alerxfctodfa eauvi t0 rxrxo3io4am nlnvsatfs2tm( poo4oet ifciadfm rmuvo u4 lxrir oatfptrlnvol(0s2tmxo nu4omt livtl(fs2rmumpnu4tex moctyt mDra( pn()teenir3io1fpD luvs;s0trxrirpio4am   fvil(fs2uaxrp;o0olenmi3tytla ra( o;t0 exnifcoytop  ai ils)srxrio oydam n nvt () ruax oot4tpenif3ilslsDum(vs u0 eeoxocto1fmtr i il() 2umio ny1alte fesas)artaumont0aleoioeiad m2uan s;u4trxnmr3oytlate i s;t  rurir3oy1ope  nvs s)a2urx onu1oexnmociltfm uanvo u)alxrmf tytfm  au s (0srtmir3iy1lltnmicil(  Dumxmont0tpenmoetysfm rlump;u0 etrir3oy1lp  lnvo s)srxo(r3iodop  mivil(  rrrum ;t0tpxnmf3tltlm2eauvo;u)aexrmocoo1fp elnvs () euoxm iudll nliei t) rrmu p;t0tlxoioeiys a2ul( pnu4alxnmrciy1lp e ivs s)seum(r3iydlpt  fvt ( sDurur nu1apto i3iaslm2eaumpnt4arerircoadop  an i s) 2tr(o3iodomenmfvi t) 2ua(mo;u1oleo o3tytfa rmn s;u)tetnif iydlmt livolt0trxo(m nydlltnmnvias sDta(mpnu0ape ifetldfsDeluvpnt0aeenmo3oytlmt au i;s)s2urxm3oodomtnmnvtlsfsrua( pnt4apxn feiadfaDumnmo;t0tlerif todoa eluvi t trtmxm3nu1amt livias)s2ta( onu1opxn ociydlmDemnmpnt4altnmocoa1fptrlu o (0 rxm(r oydlpeelfct t) Duaum ou4tlxoio3ilsfs uluvs ()tetnmfcta1opDeaneil(0setr(mpoo1ome mictls)a2rmump;u1alx mictlsls2ua( sn() etnxr3oydlptraueo t)srurxopoy4lm n ncta( s2urxrpoo1oleo i3tytlmDum(vpnt4trtomocty1fpDrai s s) 2urxrpoodaptemictlsfs2taumonu4tle ifetad s2elu s;(0 eerif3todomDrlivo t  eurim oo4ap nmictl()srum( pot0aex ifctlsla ulumpnt)trtrmo3iatoat luei;s  eur(rpiodllt lnvs sfa2tm( ooo1aleo fetydfa rmn pnt)tlenmo3iodlmt  uvo;()s2xrirpnu1amtemiei (  rrmx  ot0tpx mietls aDrmu p;u4alxrmociydomD aivs;(  2uoxopoydapeemnci s)srtmxmpoo0ape mfeiaslm ranvp t)altnxociytlatr i il( t2toio oy4op  mfvia(farrm(ro;t4tpe ioeildlmDrm(vs t4 etoxr oodfaDr u il()s2uo(r3iy4ll n fcslt) 2rr(  ;u1altoiocilt mDemn s ()tltnmo3oy1lm e neo s)t2uo(opny4op emictas)sDuaxmp;u1tpeo feiasla2emn s;u0alenxf3iadom eanvsl( texmiopnu1ap nlnet s  rta(m ou0tle mocilsls2el( o;(4 leniocootoatelivil(  2uoio3io4op nlictl() Dumu ont1tltnmictys aDea(vs;()alxrxfctotfpDrluvs;( srxr(m3oodome  ncia(fsrua(r no4texnii3ild m ra(vsnu4 etrio3iotfpte n o;()trxo(m3ny4llt lfeta( a2um( pno0apeo ieiysls2eaump;t4 rtoxr3ta1la rai i (0 ruoim3nydlmeelics t  2urxrp;t1tlxnmf3tlt s2ra(vp t)trerif3oydla rluvi;t0tetm(mpio4ol nmnctas)a2umu  nt1aexomf3iat s rlumpnt0trxoxo oytlaDeln s s texmxr oy1lmenmiet t srrrxronu4aleo ictyt sDra(mpn(0texnxocoodlpD  nvsls0 2tmirpiydll n fesa(fs2rau pou4tlt miciasls2umuvonu) etriocoo1faDrlnvs ( t2tr(opiu4lp e nvtl(farra(r ot0tpenmo3tlslm2ranms t) lxoxr iotoat  nvo;(0 exmio3nydolt micias a2rmu pnt1apto o3tatla umnvo;t) rxoif3oa1fmte uei s tetmxm nodlp   icsatfs2tr( o;u1aptn feildlsDra( o (0 leoxrcoydfpteluvs;t)t2trxr3ny4op n ncta(  Dtmxro;t1tleoiiciytls2rln snt0aeenmrcta1fm eau o t  exm(r iudopt mnct s)srum(mp;o0aeeo ieiatla2em(mp;u)aetnio oodfp ranvo t  exrxrpio4ap emiei (fs2umxm ;u1tpeomoctas s ul(vo u0tlxnioctatfp  anei;(  2ur(m io4lp elfesl(  Dtm(  nt4oeeomf3tydla rl(mo () renir3tatfp ean ols  rur(m3nodapt mnes () 2umu o;u1oltniociltlaDrlums;u0 exnmo oatfpDraueo s) rumxo3ou1om  miesasfsrurxm ;t0oeenmi3tltfs2emuvs;u4artoxf totoa ranvo;(0seur(rpiu1ole  nesas)arur(mpno4aetnmiciltla2rmnms;()alxnif oatoa   ueols0srtrxr iydoptelfvtlt)a2trumpnt4oet mf3iysls2ua( sn(4aetrxf3iadfaDr uvol(0tetmxrpnydalt  fesls aDurum no0alx io3iadlm rmums;(4alenxrciatomtraivo;t) euoxopoy1lmee fvs tfsDtm(rono1apt moetydlm2ulnms () lxoir3iotlpt aieslt0 2tm(o3io4ol nlfet s sDua(ro;u1aex moeiatlmDulu p;t)teerif3oo1fm rlies;s teumxr3iodopee ncil()srra(mooo0ale ifeildlmDemu pnt)alxrxrciatlmD  n o;t0 rxoxm3iy1op  mivsl()s2umx ooo4aptn o3tadlaDeanmsn(0arxrxo3tydfm rluei ( s2xoimpio1lle  ivils)aDra(mo;o0tpxnmocias s eanvs ()aexnxfcoy1op rlivolt)t2umiopno4al nmnvtlt artr(m ;t0oltomfctlsfa2um( pnt4alxrmr3oodfateaieo;(0 rtrxr3nydomeemiet (fsrumx oou4tlx mfctatls2el(vs;() lerxo iadfmtrlnes;t)trxoir3oo1lpen fcil() Drr(r ;o1aeeo ictldfa2ua(vsn(4arxoxrcoo1opteaivs;(0 etr(rpno1olt licsat)s2tr(m ;o0apxn i3iatlsDean o u) rxomo todomD aivi s0trto(mpio1lpt  iesa( aDrmxrpnu0tle mi3iaslaDrlnvonu4 exnxocoydopD lu o t s2umir3iu4lmenmnvsat) 2raxmp;t0aexn o3iysfa2rlumo u4 lxrxr io1oaD an i;s tetmimpiu1am  mieilt)sDur(ront0aleomi3tyslm eluvonu)tlxrxoctodfmDe u ols  rxoir iu4altn iesatfs2trxm ;o4tpxnmfeiyt m emn o t)arenio ta1fp rauvols  2tmiopoudomtn icta(f 2umurpnu0aex ifetytfs umnvo u0arxoioctadfpteauvolt texo(r3ou4ap nlicils  2ur( onu4aleomocias m rl( p (4aleomf3iy1oa e ieil(0t2tm(m3ou1ol elfci (farrm(mp;u4olt iietatla rl( o ()tltrxf iydfaDranei () rtr(mpoydome mncs ()sDrruroou1tlenmictlslm rl(msnt4altrxociydfa   ieslt)trxmxmpio1am nmnvsat)sDtmu p;o0oet  ictyt mDemuvonu)teenmo oy1oa eluvi s)texrxr3iy1op   ncils sDumumpnu4alxomi3ilslmDra(von()tltnxo3to1fptranvil(0 2xrio3oy1oleemicsas aDtr(mpot4aptnmieiydfa2rmnvo;()alenmo3tatfmtelneols0 etmxm3iodllenmieta(f 2rmx  ou1aex  i3ias m2rlnms u4arxnxo3oytlateau i (0 euoxo oo1aptemncs s)arrrxmpot1oltn f3iaslm el( s u4 leniocoydop  luvo s sexmxr oudll  lici ()sDra(rpno1tlt mf3iadfa2ran onu4 exrmociadfa eaneilt0 2xr(r3oydlptn nvi ()artm(rp;o1tpto i3iytfmDuaumsn(4texrxf ty1omDr neils srtr(rpny1op emnvt (fs2trum no4oltomoeias s uau pnu)texomf ia1fm r u ols s2triopio4lptelfeias)srurx o;o4teenmo3iys m um( p;u0tlxrmf oadlmD  u ols)trtmim iy1olte nvtas arraxmoot1aee  o3tydlm em(mp t0arxoxo3oo1lpDe neo;()teurxmpnodomtemncsa(  2rr(m ot1olx ifcilsfa2emu p u) eeomo3ty1fm eaivi s0 2tm(m3iudoptn fviat)a2umx o;t0alx ioeiyt a2elu s t4tlxrxr3oydlmD auvsl() ruoxr iodamtnmneil(fsrur(rpou0opxn ieiytls emn snu0tleomo3ootfmt livols trtm(o oo4opt mics t a2uaur nt1tpxn i3tyt sDeau p;(4tetrxo tydfp eli ol(0 2xr(o3iu4amen ncsa()sDtax  no0alt iiciat sDumuvo;u4 rtnio3oo1fpte i sl(0t2uoirpio1ol  mfeils)srrmump;o0apxomocildfa2ra( ont0trenio ia1lm eln ols0 exr(m3oo4lm  lnvs () rrr(m nu4altnioctaslaDulnvpnt0aexnmf tadomtrln o;()s2tr(m iudlltnlieias)sDtaur ;t1tpe mfciys mDrln pnu0arxrmrcoa1oatr u i;s0t2xrxr3ou4amt  nesas aDraxro;o0tltnmoeilsfa2rln s;u0trxrmf iytfmt an ol( sruoxo nydopenmncias)srum(ront1tee  ictldla ua(mo u4 rermocto1la r ues;t)setmxo ny4al  mfcsat)aruaxmont0texn feild a2el(vont4 rtrmr3ta1fa  lnvs;t)sexmxrpoo1ol  lfei t)sDtrxmo;o1tpxo i3tyt m rlnvo u4 ltomfcio1lp   i ols0trto(o3oudamtnmivt (f 2umu  ;u1tpt ifciys sDumnms;t0alxrif iotlmtelivo t  etoio3nydop   nvil(  rrau ono4tlt mf3tlsfaDelu p;u4texrircoytlate n sls0s2urio3ou4lm elivta(fsDrmx ooo0tpe  i3iyt m rmuvpnt0trermo todfmt  neol(0s2uo(r iy1ap  mictas arraxr ;u4apt  ieiltlaDeanvp u0aetomr tytlp  lu i t0s2tmxo oy1olenmiet t  Duaur no0apt mietat s2uln s;u0 lenxr3oatlmt lues;t0 exoxo iodopte nei t)s2rmurp;u0alt  fctys aDuauvp u4 eerircootfa elivi;t0 2umir ny1omee nci ()sruaumpou0alen fctytfa ulnvsnt4aexrxo3oo1fmt aieo t teumxrpoy1ome  feia()a2uaxrpot0altn i3iat a em( pn(0arxnxociy1fptrai sls)teumxo3oodope lneilt) 2tm( p;t4aetoif3iytla2ulu s;u4arxnxr3totlatr nvs;() eumxmpoy4amtelicsa()sDrau  nt1texn o3tltla2rmums;() rtnmr3tydla rln s;t)t2xoiopoo4ol n fcslsfaDumu  nu4ale  o3iad s uan o;t0alerxf io1om rluesl()t2trxrpou1lpenmfet tfsDumxro;u0tlen ocild a2emu ont4artoif3iotoaDranvslt)srxo(o nydlle lfciasf 2rmxront1optoio3ilt a rm( o u)tlxomfctytoat livs;t0setrxr3io4amenmiet t sDum(mont1alxniocild m2elumo u) ltrio iy1laDraiei (0 2tmxr3iydlm emivi s)s2tmxmp;o1ape  o3tls mDul( s;u4aeenxr3io1omD  u o t0 etmxr oy1omte fctltfsDua( ono4tet mfciys a2uaums u0 rerxr3iy1late nei;t0s2xoir3iy4op   ncsl( srua( ono1tlx mo3iatlsDemump;u4artoifciadfm rai i;( setoir no1al nlnvilt  2umxm ;o1olxoioeiltla em( s;t) eerxf iodomDraneo;()s2trio3io4aptn ietasfsrrax p;o0texnmoeiys sDumnms;(4alxnxrciadoaDeli i () rxo(o no4al  mfvi (f rtmumo;u4ole  f3iytfmDulnvont)trxnir ia1omD aivols) 2to(opiodlp emnvta(f Draxm nt1ope  fetlt s2eau o (4 rxnxo iodfat  u ilt0 etrxm iodlpe mncias s2urxm ou1teeomf3tatfaDrluvp () rtrmfciatfm   ivs;(  euoimpny1omtelnet s  Dua(  ou1tet moetytlmDemnmpnt0tltrxf3totfmDeaieols sruoxo oodome mfet ()arumxm ;o4apxoiieiatla2rlnvo;t4teerxrctotfaDrluvs (0 exrxopno4lpenmfci t  Dtmxmp;t0openmo3tysfmDrln snt) rxrxocoydlp r nei t)t2urxopio4lmt mnctlt s2rmxm ou0oexnif3tytfaDraumo;()tlxnxf3iotlaDrau i ( s2uoim ou4optemncsls  Drrxm ;o0oleo ieilslm2eauvp;t)alenmr io1la e neslt0srtmio iu1llenlncilsfsDtrx  ;u4oex mf3iyt m2rlnvp;t0tetnxfcoatfmDeaneolt) 2xoxopoo1ll n nvi s)s2tau ono1aexoifciysfmDrl(mp;() eenxo3oo1oateluvs;()srtoxrpiy4apee ieia(  Dua( onu4oetnio3ilslsDemn snt4areoir3oodlmDeaiesl(0texo(r iy4lm n icsat  2rr(  ;t1tpenmo3tydfm uanms;u)artnmr ia1lmDeluei s  etmxr3io4amenmiei s) Dtrx onu0apxomo3ias m rlump t) lermfctydfp raueilt)texm(m no1ll  lnvsasfsDur(rp;u0apeomi3iaslm2ean pn()artrxfctotomt  nvslt srumio3io4alenlfeia(f 2umuro;u1olxo i3iysfm2ea( p u4altnmr tytoat  neilt)t2tr(o3oydlp n ictlt)arra(mp;o4tlt  fciys s2emn snt0trxoxf3oodoa rlieils0trumxm ny1lp elivi tfa2um( p;o4optn o3iad s eaump t4 etnxr3oatfptr uvi ( s2xm(mpiy4alt  fctls)s2uaump;t0aetomoeiydlaDum(mpn(0 eermr iadlm rluvsl( s2urxmpoodal  mfvil(fartmxmpnu1olxnmo3iys s2ra(ms t)aeenxrctatoaDr n o s) eur(m oo4lptn ict t  2urump;o1tpxo ietat m2eau snt)aleoio tytfmDrli ols)s2umxm3iodal nmiesls) rtrxm nu4tpt mfciys aDeaump (4 leoifciy1fptr u s;s srurim3ou1alt lncilsfarum( pot4teeo feiltla rmnvo;t0 rxrmrciy1laDr nvi;(0sexm(opiydol n fetlsf rur(m ;t1oexomfctadlaDul( snu0texnir to1fa  anvo s)s2xo(r3ou1omt licslsfs2ta(rpou4aleoifeiysfaDemn p;t0aetrif3iodlaDeai i;s0t2tmio nydlle mnctl() 2trx p;o4tlt mfctatlsDulnmp;t4aexnxfctydomtrlu i t0 exm(opoy1opeemnvia( a2urx ooo0tet mieilslaDelnvo;(0artoxf iytfa eaiei t) etm(mpoy4ll emnvs t aDtmx  oo0tet ii3tasfm2em(vo;t0aleoircoatfa eaneilt0trxrxmpnu1lpe mncslsf rta(mo;u4apxnioeiydfa2um(vs;(0aexoxr oo1fpDr neils0seumio iudap n ivtasfaDtru  oo4oeen o3tatlm el(mo () lxrxrctadopt  ieslt) euoimpnu1amtemnei (fs2umur ;t4openifciatls rauvs;()teeoxrcoydfp r i i;() 2xm(r no1oltnlnvsat aDtauroou0openmictydfmDrl( o (0aetoxf ootlp e ieil()t2urim nodom n nvil(farrr(r ;u1oexn feiyt m elnvsn()trermfctytlmDrliesl(0 2trim iu4om e nctat) Drm(r ot1texoif3ildlm uanvs t4 lxrmocto1lptr n o;s)tetmim oo1omtemfcs t)aDtaum nt4tpeoii3iys m2ea( o;(0 exoirctodlp e uvs;(  2toio3ny4al nlncsls s2tmum ;o0altn fciyd aDuau s;u) rxoif oytlpDeanvolt)texm(mpny1lm nmnes t)sDurx  no1tltoioeils s2rmu o;()arxrif oa1oa r iei (0 rtoxo3oudlm elfcsat) rrmu p;o4oetn ocildlaDranms t)aeerxr oadfatelivols)texm(r3nu1opeelfcsat  2rmx pou0opt if3ils a emums;u)alerxrcta1lptranesls  rxrxr nodopte nciltfsrtaum ;u4olx moeiadlsDrl(mo u0trerxrcoatlatr ivo;t) 2xoxr3io4llee nvia(faDra(r oo4tltomietysfs ra(vo u)aleoif3oadfptrlnei () rxrio3nodlm nmieiatfsDrrum ;o4texnmf3iadfa ulnvp (0trtoir iadomt  nvolt)truo(m3oo1apen fei sfaDrmxmono1apeoif3iyt a2eanmsnu4 exoxo3tadfmDelivi (0srtr(m iu1altelivtas)sDumxrpoo1texniicild mDrmu snu) rxnxo3ty1lpD anesl( sexrxm3io1op nmnesl() 2tm(mp;u0tlxn i3tld mDua( p t4aeenxfctodomte ivi s)t2uo(r3iodopen fviat arur(rp;u1oexo fetlt m emnvonu0teerxf3ty1lateanvs;t0sexoxo3io1am  mnvi (fs2umumo;t1tpenmi3iysfm raumsnt4areoxfctadlmtr nvi (0setm(mpiu1op elieias)sDrm(ronu0optomf3ilt sDrmu o t0texrxoctotfm   nvil(0srumimpoy1alt lics (fs2umuronu0tpenmo3tltfa elu s u4aeeoir oydomDeanvs;( s2tmir3iy4lmen ncia()a2tmu oot0oex  ieiyslm rmumo u4alenmf3oydopD lnei;s0texo(r3iu1lptn ivil() rrmuro;u1olxn ocildfa emn p u4tlermr3oo1lp e iei (0trtrimpiu4ol nlfctasfsDtaxmpoo4tpxnmieild mDum( o;u4 rxrmo3oatlpD aivs;t0teuoimpny1apeeliesl( aDrr( o;t0oetomfeiadfm uan pnu4tlxoxocoodlm elneols0srtmir ny1ome  nesa( arraumpou4olto oeiad mDuanmp u0tetnio oo1laDeauvol(0 etrxr3no1amtnmicil()sDuaur nt1oeeo f3iytlsDulu pnu4altnioctadlm r u ol()s2xrxopnu4ol elfcsl() rtaxrooo1tet mf3tls s rm(vs u4tltrif oydfa  aieol(0s2to(o3nydlpeemnctl(faDrmumo;o0aeeo feiatla2rmnmp t)texomr totlateau ols) exo(o oy4ll n ietat) 2trxrpnt0opeoifetldfa2emnms;t)arxoxfcoodla e uvs (0trxmir nydop n nvi sfarrrurooo4tlt iociyd aDrl( s t) lxrxociotfa elnvo;s0s2xo(m nydlp emfcsat)s2tmur ;u4tlx  o3iasfaDrm(ms t0alxnxr iytoa ran ols  2um(m nu4lmt mnes ()a2rm(ronu4aex  f3tatfa rmn s u) etrxr3iatfmDraneo s) eto(o nu4oltnmncta(fsrra( pou4opeoio3iasla rl(mo u0aexrxrcty1oaDr ivs t  etmirpou1opeeliet (  rrr(ronu1aptoiociltfs2emn o;t) lxomf3totop  auesl(0trxoiopno4omeelncs t srtaurpou4tlx  ietld s ea( p t4teeoio3totfat livsls0 etoxr oudaltnlfcils  Dum(moou4olxnifctas sDuan sn()arerio3ootfm e nes;s0texmiopnydamt mfcsl()s2tmu o;t4ope  i3iltfm2um(vsnu) eenmf tydlpD  uvi ()seur(r3oy1aleelncs t) rraumo;u4ole  feildla2rl( o u4tetnio oa1lmD  ivo;s) rxrirpoo4ome mfctltfsDrm( pou0oetn i3iys mDuauvo u0 ltrxr3oydfateln ilt) eumimpoydapen fetas)arur(rooo0olx mociytla2ean p;u0trtnmf tatfa   uvs;()t2umirpno4optemfcil(f 2uaxm oo4apto oeiad s ea(mon(0 eeomrctydfp elueol( s2xoimpiodopee nes ()arur(mpnu1olxomfciadlm umnmpn(4alxomociatlp ean il() rxm(m oo1al emfes tfsrrr(rp;o4aptn f3iyd s ra(vpnt0trxnifcoo1laD  uvi (  exoxmpoy1ole  ics (fa2tr(m nu1apxn f3tydfm uluvsnt) ltnxf3io1omD aivo s0s2urimpny4lmt mictl(f rra(  no0tpeoif3iytla2ranms () rtrir3iytomDelu o s) euoxopnudal nmfcsat arrr(m ;o1apt  f3iytlm uau o t0 lerif tadopDeaieol(  2urxr3ou4ol   icsl( sDrmuro;t1aexn f3ilt a2rmuvon()alxrir io1lp  lu i t0teuo(r oudapt  fcsat) Drrx o;o0ole mociyd aDrm(vs;u4texnmf3oytfpDeluvo;s texmirpou1lleemnesasf rtm(mp;o4oltoioeild m em(mpnt4 eenir ia1opDelu slt  2to(rpiydll nmivilt  rrm(mpou4olxomietat m2eauvo t0trenmo oytom  aiei t  rxoxrpiu1lm emnet t)arrmx poo1tpeomo3iasfsDrm( s;t) eeoxfciytlpDeluvo t  rtr(m3iu4om   fcil()srta(r nu0tltn o3iltlm2uanvpnt)tetrxr ty1la rln o t  rtmiopnodom  lncs t  2umur ot4oleo ietydlm2ul(vsnu4 renxr3to1fpD ai i s s2xoir3iu4alee icta( s2tr(mooo4tlxo fctasfm2rauvp u4 etoif3iydomt aivs ( teur(opnu1om nlnvtlt arrmur nt1opxo oetldfs uanms;t4 etnxo3oydfmD  u sls) 2uoxr io1altelivs ( srum(ro;o1oexn iciat aDul(vs;t0trenxo oydlp elivslt  rum(r iu4llee ncsa(  rtr(mooo4ope mf3tytfm2eluvo;t4tltnxr oa1fate neo;t setrirpnu1lmee feta( sDrax  ;u1aex iieiydfmDeauvsnt)aexnio ta1fatraivs ( t2xmio ny4ameemnciltfsrumx oou1aetn ietls sDuau p;u4artoio oy1oaD lnvs;s0s2xoxopoy1lm e nvta()s2um( o;t4tleo ieiytfa2rm( o u0alxrxf3oydop eaivi s  etm(mpoodape mfvtat  Dumur no4tpx ioetltfsDea(mp (0aetomocio1om  lueo;t  2xmio iy4omt mfct sf 2tmum ;o4texniieiytfaDul( s ()teenxf todfpt  nvi;t) etoimpoy1alenmictl(fsrtm(mpoo0opx io3iad sDulnmo;u4 reomr to1op  livil(  exo(o ou4aptelfcta(  2umxr nu4tet mi3iytlm2el( p;t0trxrxo3oydfmD  u il(0texmxm3iy4lltemncsa( aDrmumono4tex iiciysfmDua(ms;u0aetrio3oytoaDrln o t0 exm(opoudllen ieia(f rtrxm no0aet ifetls sDulnvonu4tlenir iatopt luvil()t2umim no4lptelivia(f Durxmo;u4texoio3tadfs emump;u0aeeoio iadfptelies t)trxrxr nu4lle  ivt sf 2urxront0opx mictls m emn s (0tlxoif iytfaD aneo;t) rumxopoydalen ivsat)artr(r no1tpxnmicils aDran s;()tlerxf3iatlmtr ieol(0 etmirpnydap  mfcil( a2rrumooo4oex ifctyd a2em(vonu)aetrxr io1fm elieo;t0t2tmxmpny4openlfetl( sDtm(mpot4opxoifcilslm rmuvo;u0 renif ia1fat aivo;(0 2xmio3nu4amtelfcsa(f rurxmooo1tptn o3tldfa2uluvs () rtrmo oo1lmtrai s;(0t2ur(mpnydolenlneil(f rrmxrpnt4tex ii3ild s2ea(ms (4altoxr tatlpDrauei;s) rtrxr oy1llenlivsa()a2rm(root0apeomf3taslmDea(vp;(0alxrif to1fptrlu o;s srum(rpny1lltn fcsl(  2rmum oo0tetn oeiat a2elu o;(4teeoir3iatfmtrai s;t0s2toxo3oo1alt mnctls)sDtrxrpnu1oeeniocildla ua(monu4trermrcio1fmDr ues;t srxoxrpnu4lle licsl()aDumuro;t1tltnifeildla umnvs u4artoifcoatop   neo;s texoxo io4llee fcs ()srra(monu4apenifciytlmDumn o u) rtnir oytlm rlu ils)seuo(opiy4opt mncilsfaDum(mp;u1opt  octlt a2ra(mo;t4 rxrmo3oodomte u i t tetoxm io4lme mfct s)aDtr( ont1tpx  o3iysls um(ms;u4 rxrxrctadoa elnvo;s teuoxr3ou4amenmiesasfaruaxmonu4oet moeiydla rmu p;u0 eeomf oatom  luvs t)t2umxm3nu4op nlfetlsfa2raurpnt1tle if3iadfmDrlumonu0 eenifcoa1fat au olt0trtm(m oydll e nci ()aDrm( o;t0aptniieiyd m2eanvsnu4trtnio ia1lpD  ivi s0trxoxrpnu4op nmivtltf 2rrx  ;t4aexo fciatfsDelnvp;(4aleoxo3oa1faDeaivi t) 2umim3oy1lltemici (fsDtrurooo1tle io3ias s2rl(vs t0 eeomo ootfp eanvslt)sruoim nudlleemies (f 2umur ;t4aleniicilsfmDrluvp t4arxoxr ia1faD  uvslt)trtoxm oo4openlfvia(fa2rr(rp;u0oltomociydfm rluvpnu4teenmo3totlmtr iei t)trurxm oo1lmtn nctatf 2uaxro;o4tex mfeiltfsDeaump t4 exomocoa1fm  lnvo t)sexrxm3io4amtemncsl(fs2tmurpou0tpxnif3tad m ea( o;t) lermf3tytla  au i;t0 rxo(r3io1lmenmietltf rtmumpno4tlenmf3tyt mDuan pnt0 etomo io1omDe nvo;t)t2urio iy4apenmivt s aDrr(r nt4oetomoetydfm rauvo u4arenxf3iatfpD anvolt0srtoim3iu1omenmnvsls) 2urx p;t0opt mfcilt mDulnmon(4trxnif3ta1la e ueo () 2tm(m oudlpen ies t)srrmumoou0texnmo3tyt mDel( on() rxnxo3oydoateauesl() etmxm oudlp  lnci t arrax  ;u0aeeo fciatfs2umnms t0 eeoio3iotla   u o;s)srtrxr iy4lmt  ieslt) Dtauroot0tle iieiltfmDra(ms t)alxrmr3oa1fpD aieo;t0srxr(mpiu4lmtnmnci sf Dua( pnu0tpeomo3ils sDulums u0tltnmr tytfptrln i;s  eum(r iudop  mici s arum( pot0tptniieiydla2ua( s (0 lxnmr ta1omDelu i;() rxoir no1om elfcsat)artr(roou4oex  ocilt sDulnms;t0 eeomf3to1fmDeluvo;t) 2xrxopoy4ameemnvi tf rumxrpot4altomi3tlsfs2umn s;u4 ltnmr oy1opt anvils) rtmiopnudlltemnvtlt) 2raxmpno0oeen iciys a elnvs t)teenio iytlm  luvo s0sexr(o oo1lptemfesasf rua(rp;u1opto octatlaDrlnvonu)tetrmrcta1lp   uvo t texm(o oudlltnmncs s  Drrx pnu1tlen oeilsla emu s t0alxnmo io1faD lnvs ( srxrxo3nydapee nvslt)aDtru poo0olxnii3tlsfa ulums t4 lenif tadlmD au o;s0t2xr(opny4lpee ivil() 2ua(m ;t0aeenmi3tatlaDem(vonu0 lxrircoatop  aneils trxoxr3iudopenmnvil() Dtm(mont1alenmoeildfm ul(mp u4tlxnio tatlp  auvo;( trtr(m3no1op  micsasfa2ra(r ;u0alxnmieiad s2rauvs () ltoxociytlmD  n o t)trxmir iy1llt mneia(fsrrm( pot1tpxnmoeild a2ra( p;t0tleoxf3oodlpt ai olt  rxmxo io4al elietl() 2rax poo4tee mo3iydla rmnmo ()tetrmr3tytla  au s;()seuo(m3iudame  nvia(faruax  ;u0tetnmociys m2ua(mp t)treniocoytomt liei ()s2toimpnu1llenmncsasfsDrrur nt0texnifetys a2ulump;u4trenmo3oytoaDe n sl(  etoio3oudalt  ieias  rtrxmp;t1tpx iieilt sDul(mo t) lxnmo3oa1fmteaneilt  etoim iudlp emfvt t)a2trx p;o4oltnif3ilt a eaumpnt4alxrif3iatoat  nvo t) rxr(r3oo4amtnlfvsasfarumx o;t0tee mietysls2ea(mon(4 rxrio3iytlptr nvols  rxr(o no1om  lfeiat) 2raurooo0oexoiieiys s2ulumsn(0 rtoxf iotop  aues (0s2xrio3nydamte nesls arraxmooo1tpeniictltlm2el( snt4 rtrxr3oodfpteai o s srxrimpoudlptnlnct (farrr(  ;t0oltnii3iatfm2um(vo u) rtrmrcoatfptrlnvi s)seur(mpiy4lmen nes s)aDtmxrpou0tlen icilsla ean snt) rtrxr oo1oat  u s s0sexmxmpou1ome lics t)srraumo;u4aeen fctlslaDum(msnt0texrxo oatoa   nei;t)s2xoimpno4olt  ivsa(fsrur( pnu0alt mi3tltfm2eluvp t)aetoxf3iotom elnei t trxoxo ou4alen ivtatf 2tmx  ;u0tlxn fcildfa2umn s;t) lxnmf iodfm  liei ( seumir3io4ll nlnes s) rua( poo4aeto iciys a2uluvp;t) eeoifcoatoa   ivs s) rxrim3ou4amtemiciat)aDuaxmoot1aet mocildfm2umumonu0trxnmo3oodfptelieols  2xoirpnudoltelivi () Drmx  oo4tlxn fcils mDem(mp u0tetrir3oa1om r ivs t0 2toir oy1omeemfviatfsDtmxm ;u1altoif3iydfa ul( p;t4altrmf to1fmt lueol( trtr(opoodom n ivt s)a2raumo;o1opx  f3tld m2umnvsn() reomf3tatoa elieil( teuoir3nu4openlnvtltfsDrr( pno1oltomictatla2emnms (0artrir3totfmtelieslt0 rtr(rpiy1ale livs t)sDur(mont4tpx mo3tadfa eau p t) rxnmr3oodlpD aneslt0s2xr(o3iu4ape  neiat)aruaxmpnu0aet  f3tytfm2ra(monu0artomf3oytlm rln sls  2xoimpoudop emfvs ( arurxm no1olx mfeiat a2rmuvp;t4 ltnxr oatomte i s;( t2tmim ny4am nlfeiat a2uaxro;o1optnmfeiytlm2el(mo;u4alenxr3tadfp eai i t0srtoxr nu4am  licta(fsDtau pnu4tlt  ociat s2ul(vo;u)aexnir3todfateln i;t0t2xoxo3iy4op nlnvs t s2raurp;u4oex  ieiatfa2ulu ont4texoxr3oo1lpDr i ol()trxrir iy1llte nci s s2rm(monu1teeoif3iys a emu p;t0trerxf iadlmDelues ()srtr(mpio1apt lnes s sDumxrp;o4aeeoio3iytfaDeaums u0tleomo ia1fmt  uesl()trumir nu1om nlfciat)a2rax  ou0optnioctyd s2rln p;(0 lxrxf3tadoa   nes ( sexr(o iydamtelivsat s2tau poo0olenio3iydfm2emnvsn(0 etrxrcoy1fa rlnvs s0trum(o3oodopeeliei s)s2urx ono4aptoifeiad aDrmnvo (0artomf oadlpt  ueo s0tetm(o3iy1lpeemici () 2uaxrp;u0aeen octadfaDraums u) lxoirctodfaD luvo (0 etoirpnudome lfvtls  Dta(mo;u1oleomf3tldlaDulnvs;t)aeenxf oy1fp rlu sl(0sexoirpoy4apen ict sfa2urumoot1aet iictad m2em(ms t4 lermr3iatoa   n ils)t2uriopiodopeelfcta(fartaumpnu1oltoio3tldfs rm(vont)artnxf oadop  lu s;s)srum(mpoydal e ivtat arta(moou4tpxnmoetldla uaumont4aexnif3tadfmt  ivs;s srum(m3ou4ope  fcsls)arrm(  nu4aptnifciydfs ul(mpnu4aeerxo3oo1op eaieilt) rtmxm3no4ll emncil()s2taxmont1oexomocias s ean s;u4aetrio3ty1omtrliei ()teuoirpoodamt mnctl( artm( oot0opt ii3tytfsDran o;t)alxnxoctadomDe nvi t0texmimpoydalt lfei tf rrrxmooo0tee moeiltls2emuvp t)tetnioctytfat lieolt0 2tm(r no4lmtnlfeils arur( ont1aeeoioctlt mDuau s t)trtnxr3oo1lpt  n i;(0trum(r io1openlivi s) ruaxrooo1tpenmoctytlm2ea( snu)tetrxoctatom  au ol( srumimpou1lpeemfctlt)s2rmxmonu1oleomfciys s2ranvpnt0aexomrciadoatrai o;s)texm(m oodopeemfvi (fsDtr(r ;o1tleomfctat a2emnmon()arxoio to1lpD lueo;()seuo(r nydole mieiat)a2tm(rpno1aexnmi3iat a2emnms;t) lenmo tatoatelnvil(0s2xr(r3nu4op emics (faDtrur no1optomo3tytfsDuaump ()trxrif io1fpDeluvi;t0 2tmxm3nydolenmnei ()sDuru p;o1alxoifciltls ulumo u0arenio3iatomDr i o;s0 rtr(r3io1lp nlfesa()s2rrump;t0tpenmoetyd m um(vs;u4alxnifcta1fate i o t0setm(m iu4lmt  nci t)aDtru ooo1teeo oetyd m2eauvp u4aeerir3oa1optr uvil(0 rumio iu1optn ieil( srtax ont1aexo icild a rm( o (0tetrmo tadom  lneo;t0s2uo(m oydole liciltfa2uru  nt0tlxn o3iasla2rmnmo;u4areoir3ty1oa ranvi;s0seto(mpnu4amee fvs t) Drrx ont0tet  ietyt mDeau o (4 exomo iadfmt  n o;t teum(o3nydlpeemivtlsfaDumx  ou0apxo feias s2rm(mpn(0aexoif3oytomteai sl( tetrirpoy1olt  ict t aDrru poo0alt  fcild s ea(vp t4areoxfciytlatranvo t)s2xm(m iudalen ici () 2taxr nu4olto octyslaDemnvsnu4 exoxr3oo1lpDeaueol(0srxmir3iy1lle  neils) 2tm( p;t0optomfciytlmDumumo;()arxoif oa1oatelueols  rurxr iydoleelfeslsf Duau oou4tlxo fetyt m2ra(vo;u)tetnif iatoptraues s0srxo(m3ou4lm nmnetat)artrumo;o1opxoifcildfa rmu o u4trtoxr oodfm rln o;t0srtr(m oy1ape  ivt ()aDumx  ;u1oetnioeiltfs2ra( sn(4areomf oa1oaDrlnvo;s)srurio3nodllt liesl()s2tmur nt4apxoioeilt a2rln onu)tleoxf3totlptrlivs;t0seurxopiu1om nmnvtls)arrmumpot4olxo feiyslm2el(mp;t0artoifciy1oaDeau s;(0texr(m io4ll   neta()sDurxr nu0aee mieils m ra(mp;u4aleoifciatfmt auei;t)s2xmxopoodolt mfciat)srum( pot1teto f3tatfm2el(mpn()tlxrmf3oa1omt lu ol( teuriopoo4lm e neslsfa2ra(m ;u1open feild a2em(mpnt0arenio tatomDrau i ()texmxopny4om n nvia() Drau o;t4apeniieiltfm ea(mpnt)aexoifcoadlaD lnei ()setoxo3ou1lp elicil(  rumum ot4olxnmo3tad sDeau p;u4treomo3tydopt  i i;(0 2xr(r3ny1lmt lfvslt aDtmum nu1tltnmfctld a2em(ms;u0 rermr oadlaD anvi t srtrxopny4amtemietls) 2ur(ronu4tpxo oetat s2rluvsnt0aeenxrcoo1lmt  uei;t0trtm(o ny4om nlfvtl(faruru p;u4aleniiciadlsDran o u)alerxf3iytfmDranvo;t t2xr(o3oo4llenlfvsls)sruru  ou0tpt mo3tldls2uauvo;t0teenir3iodopDean ols0srumxm nodalt lfcta(fsDrmxr nt1tpxomietytla umuvpnt0aeeniociytlmDr ies;( srxrxr3iydamtn ieslt aruau pot1tetnmoeiadla2rau o t0 leomf iadfa   i i t truo(r3iu1omtn fei t artr(root4olenii3iad s2ea(ms;t4 ltrmf3ty1fpDeaivs t  etrxr oydape livsa(f Dua(rpot0tleoiiciaslm2rm(vont)altrmo tadfmt auvilt  rxrxrpny1opee nci (  Dtmumpno0alenmfetltlm ra( o t4artoxr ty1om eaies;(  ruoim iu4olee fctl() 2tmu pot1tlenmiciatfaDel(von(0 rtoir oytopt  ivi s)trxmxm3no1ll emncils arumur ;t0alenioctas s uauvs;t4trtomrcoy1la rauvo;s  rtmxr oodom nmnci s aDtm(roou0ole if3iadfs2el(vo u0tetoxo ia1lpDe nvs;s0 rumim3no1ol  mfvslsf ruru pno0olt mfetlsfm2umn s;()treoir3iodom elneo t0s2xr(mpio4lmt mieiat)s2rmxrpou1opt  i3iltfs2ulump;u)tltrmf iotoa eluvi;t)trxr(opoydolenmietl(f rra(m no0apxo ictytlm2emu snu)tlxrmo3oodfmDranvs;t0seur(r oudapeemiet ()sDumumooo0aexnifeiydfm2eau s t0aleoio3ta1oat an i (  exriopoodop n icils sDtm(  ou1olenio3iadfsDea(vp;(0arenmocty1oa eauei t0srxoirpnu1lp  lncs t)a2taumo;t0aleoio3tasfm emn sn(4tetrir3ia1la e u i () 2uoxr3nodop elfvtlt srurx p;o0tpxoifeiat s um( s u4aeenmf tytopte neo t0teuo(o3ou4lm e ivsatfarraurp;t4oetoioctatfs2ul(vpnt0teeomo iodomtelnvils srto(r oo4omt  ieiat) Dtmur ;u4apeomieiasla2ul(vpnt)teerifciatoa e n s;(0sexm(r3iodaltnliei t sDra(  ;u0opeo o3iatfa2ra(msn(0trxoxfcoatfa   ueslt)sexoxm3iu1lpt mfcta() rurumont1tee iociydfs um( sn(4altoir3tadopDeaivi s texoir3nudamtnlnctas)aruau ono0tltniiciltlm ranms;u0trxoxf3iy1la  au s s srurir3iudlmtn fvtlsfs2urump;u1aet  i3ilsfm2eau p;t0teenxf3io1fmt ln ils)s2tmxmpno4ameelict ()a2rauroot1texo feiydls2ulnvp;t0arxomr3oadla r n slt)texm(mpoodal n fvsas  rta(moou1tpe  ieiysfmDelu o;(0aeermo ta1lm   neo;t trurxm oudapeemnesa() Dua(rp;u1ale moeiltfm2ulu snu4 exrifcoytop ranvi;s0s2to(r3iy1alt mncils  rua( o;o0oet iieildlm2ea(ms u)arxnmrcootop   i o s) etrxo3nu1altemfcsls)artrump;u0aeeo i3ilslm el( onu0 ltrif ty1laDrlivo;(0trumio io4al elictls) rurumont1oeeoii3ilsfs ean p;(0arxrmr3oa1oa eanvsls0srumxo oo1oltn netlt srua(r ot0tltn fctyd mDrlnvo t4tlxnif3iytfptrai o ( setoim oo4lleelnet tfartax  ;u0aexomieiyt s2rmnvs t4aeerxfcto1lpD anvols)t2xo(mpiu4lltelnetat srra( pnu0olt ifetytlaDrl( s () rtomr3oadopDrlivs;t0t2tm(m3iu1olt  fvt tf 2um( ont0tet mictys aDumu snt0aetoio3ootfm rlnvs;(0teuoir nu1alt  ietl(faDrrx pnt4apt  octatla uau pnu) eenxfcty1fm rai s;s  rxoxo io1op  lnvt sfs2ta(mono4olt iiciasfa2eaumonu4alxnmr iytfm rai s;t) 2umio3no1alt  nvil() rrrxmpoo4oeenmfciytfm2rl( ont0alxrxf iy1omtrlnvo;(  2umiopou4aleemfet (fsDum( pnu1tleo ocias m2umnmp;u0 exnio io1opte i il() etrio iu4lltelicsas) 2urxrp;o1oex mfetat aDulu ont4arerircta1lmtrauvils  etmxopiudllt lnvi ( aDtaurpoo1tle  ieiasls2elnmsnt)altnmo iydfmteaivo (0 rtrxopnu4apen nes s aDtmx  oo4optnmi3iadfs rau snu4alxnio3tytop  lu i (0teuoir3iudomt lnvtls)aDtrurpnu0tpxnmiciatfm2em( snu0trtnif oodfatran s (0t2trxr3nydolenmnetatfsDrax pou0aetomi3tadfmDulump u4aetnxf ty1om e uvo ()sruo(rpoydop   ivilt)sDur(mooo1opxnmfeiys sDuau o t0 etnmr iatomtr nvsl() etrimpoo4lpt mfvt ( arumumpnu1aexn oetydla2ua( p t) exoxocoo1opDranvs;s) etrxm iy4apee fetls s2ur( ono1tetomietytla2um( s;u0trtnmo iydla elues (0 eumxm iydlltnlivias s2rm(rpou4oeenmociatfs ulu p () lerxocoadfpteaueolt)s2tr(opoodope livtat) Dtmu ooo4tpx ioetlsfa2eanmp;(4 ltrmr oatlpDr ueolt)s2umim3oy1omtnmfcsat  Dtmx o;u0oetn oetatlmDeau p u0aexnmocoa1fmte ueilt) rxoimpoo4op nmncil(  rrax p;t0tpxnmoetyd mDrmu o;t)tetomfciadfmDrln i s0s2to(o3oudapenlfvtas)srrr(m ;o4aptnmoetaslsDuan p;t0aleriociotfa eau i;(0 2urimpno4lm   fvi s)s2umxrpnu1aee mf3iaslaDuaump;u4arenmrctytfa e n i s)seur(o3iudlptn fesa(faDraxr oo0aex iociys m2rlump t) reoir tydopDrai o;(  eumxo3oy1ll emfvtatfa2um(r ot0tpx mfeiat mDrmn o t)altomr iadlmt auei (0trxoimpio1omeemictl(fsDrmx ooo0tptniictldfaDelu sn(0treoxr3tydop   n o;s  exm(r io1lm  liesasfaDuau pou0texnifeiadla eauvp u0 rtomrcootop rluei;(0 exo(m3ny4amen fetl()sDumxrono0aexnifciad sDrlnvp;(0alenmf oa1oaDrln s s) rurim iudapt  ieta() 2ur(m oo4altomieiysfs2eluvs;(0artoio iadlpDeaues s) 2uoir3iudll   nvsatfs2ur(m ot1tex mo3tasfm2eau s;u4tlxrif oydomt liesls  2tmxo nu1oltelfeil( a2uaxmp;t4alt  f3iytls uln p (4 leoxo3iydoatelivs;s tetrxo oy1op  micta(f rtaxr no1tlx iiciytfs uau on()aexoxr oa1la  lu slt)s2umio3no1ome mfei tfsruaxro;t0tltomieiaslm2rln s;t)tetnifctotlmt ln o;(0tetrxr3oo4lptemnvs s) 2ra(m oo4tpxnmfetatfm ulnmo;u4 ltnmo iydlp raueol( t2tmxopio1altn fvtl(fa2um(  ;t1apx mo3tadla2ra( sn()alerio3iy1lmtr uvi;()tetr(r3nu4apeemfvtlsfarum(mo;u4aptnifeils a ra(ms u4 rxrmf3iadoaDr uvi;t)setrimpnudam  lnci s) Drrxm no4tptomfetysfs2elnvo u0tetnxf3ty1lpD lneo s)seuoxrpnu4lm n netatfs2ra(mpou0tlen feils m ulump;u0trtomr ty1optrlnes;() eumxr3no1omeemicias)arra(mont4oeeoifeildlm2umu snu4 lermf oo1opte n i t0s2xoim3ou4al nmivt t)srrr(m nu1apxn fciasfs uauvon()texnxr ty1omt lu s;t srxrir oo1ole licias)sDurx pno0alt  octadls2rlump (0aexrif3oa1fp   u o;s s2toio3nu4oltemfvils aDur(rpot1aetomociyd aDuanmp u)tlermo3oadla ean i;s0 2umxm no4apen fcsa()a2tm( o;o0tptomo3iatlm2uaumsn(0tleomf totoaD lu ol() exo(rpnu4amt mnvils srtru onu0tet ii3iadfmDulu p t4tlxrxfciytoaD ai i t0s2xrxr nydlpen ivs ()sDururpoo4ole moetld m2rm(mo u) etomo oydlpt  nvs t0 2umir3iodlpeelivtl()aDtmx oou0altoif3tltfaDumuvo u4teeomf ta1optrlivo ( setmirpoudopee icsl() 2ta(ro;t1tlto ocias a2ua(vsnu4arxoxf io1lp   ivo (0 exr(rpou1alee nvil()aDtaxrpot4apeomo3iyt m2em(ms (0 rtoxociatlp eluvo (0sexmxo io4omeemiviasfartmxmp;o4alxnmfciadfm ean o;u0 rtrmr oodop e uvi;s)texr(m nydlltelfesat) Dra(  ot0tlxomi3iadfsDean s t)aeenmo3oo1fmDe ies;()t2uoio iodap elfvsa()srrmurp;t0oltomieiatfa2uan o t0alerxf3ia1lp ran o;t0 exr(mpiy4altemnesls)s2rrum nu0oet if3iytfs emumsn(4 eenmoctatlpt livs t)srtoxr3nodlpen fes sf ruru  nt1tpto oetytfs2elnmsnt)aeerirctytlp elu ils srurio3iu1optnlnei () Dtau pou4aet ifeiyt a2rl(mp;u4arxnxfcoo1faD lies () rtr(opoudlptnmnctls)a2tmxmpno4aetnmfeias aDrln p t4tlxomrcta1lateaiei t)teuoxrpiu1lm elfvsat)a2rmurpnu1olxomo3tydfs rl( snt4 lenxo ty1oaD lnei;s srtmim3nu4openliciat aDum(rp;o1tlenioctyt s2raumo u)artnxo tatopD  ies;()trtoxm iy4om nlnviltfaDtaur nu4apen oeiadfa emump;u0altoxociytoa  lnes;(0sexrir3ny4lleemnviatfa2rax  ou0tpx  octys a rau s u)tltrxr3oatopD an o;t0t2ur(r ny1apenliei ( srtmuro;u4alxomieilsfmDumn pnu) rxrxfcoa1lmtr ivols0t2xoim3ny1ope livsa(fa2umxmoou4tlxnioetydfa2ea(ms u)tlxrxo oodfpDeaieo t)seto(mpiu1opt mnvi t srumxr nt0olxo icilt aDrauvp u0arxnxr3ty1op elieo ()t2xoio iu1amtelictas)a2urumpou1aexn fctyd aDemnmp t4aleniocoydomDran ol()t2xriopoo4opeelies s)a2ta(rpno1olt  ocildfm2ulnmsn(4teeoxr tytop  livs;()srtmir iy4olt  nvtat aDrr(r ;u1openifeiytfm2rm(vs ()texnio ty1lptelnes;t texmim ny1ap  lfesl(f rra(m ou0opxo ietldlaDum(vsnu) rxrmo3totlmDelnes (0teuo(rpny1optnmfeta() Dtm( pou0aptnmoetasls el(vpnt)tlenio3ty1fmte iesls)s2tr(m3ou4ol elivil(fsDuru ooo0apto oetlt a2umnmo;t4artnxr3ia1fat auvs t s2tmxo iy1apte fvsa( arur( o;t0altoio3iydlm em(vp u0alxrxo3iy1opDr u i;t) rxoxr nu1omenlietl(f 2tm(  nu1alxniocilt m2ea( pnt0alxrio tadfatran s;t0s2xrio3nu4ap nlnet t)aDumxrp;o4tpe moeildfa uan o (4 rxnmfctydfate u i s0setoiopiy4ll  lfeta(  Dtauro;o0aeen i3tad m2rm( s u4arenmf3oydla ranvs;( srtrxm3oydoleemnvtl()aDumumo;t4oee iicils m2umnvp;u0 etriocia1fpD lieo;(0texoir oo1ole lfcslt)a2ur( o;u4teeoifcias s2rluvp;u0 lxrxr tydop  livsl() 2xoim nudal elfei (fsDrr(m ;t4opt  ociydfm el(mo;u4 lenio io1fatran i s)teto(opoo4lp nmfesat)sruru p;t4aleo i3iytlm2rm(mpnt0tlxnmo3iytoaDr ivo t0srum(r iy4optelfvsa(fsDuau  oo0oleomociad aDrln on(0trxoxo iatoateli s s0t2xrxo oo1om  lncsltfsDtm( ont0tpt  i3iad m elu p;(4 leoio tatlpt  i s;( sruoxm iu1amtn nviat)arrruronu0apx  fciytfa elnvs u)tltrif iy1lpDe nes;t) rtriopny4ame  fetl( artaxroou1apxnifeiysla um(vs (4 lxnmf3iy1lpDrlnvi;s0setmxr io4lpte nes () rtaumoot1tlenif3tad sDuluvpnu) rxoxr oa1fptelivo;( t2trir3iu1lle mieiasfs2tmuront0apt io3ias m2umu s u4teeoxo iy1om e ueo t s2xr(rpiudlme  ncil( a2tr(r ;t4olen i3ilt mDumump;(0 etomf3ty1opt livils0truoxrpno1opte nci ()srrm(mpou4ape ifctydfa2ra(mont0 etrmo iydop eaneols0 2xoim oy1ope lici (  Dur(mo;t0aetomoctltlm2uanvs (4trtoircto1fmD  ivs;(  2xm(r oudaltnliesltfaDurumpnt4tpe if3iysfaDuln o u4aleomfciadomtranvs t)texmxo3nu1ole mnvi (f rtaxm ot0alxnii3ias s2rl(vp;t)artrxr3iytomte u o;t0t2tmim oudapenlnvt t) Duaxm nu4tpe mo3iyt aDuan s t4 exrif3iydoateai s s)s2tm(rpoy4lpeelicils srtmu  ;u1oltomictldla2um(mp u) etnmo iytfm  aivo;s  rxrio3io4al emnvsatf rrmu p;u1tetnmicilt aDrmu p ()aetrifcoy1lmD  u i;s teto(rpnydameelnvta() 2uaurpou4aeenifeiytlm2em(ms (0trerif3iytomDelnes;s)sexrxm3oy4openmfvslt sDururooo1tpxomieild sDeanmo;t0 etnmf tadoat  ieo;t)sruoio io4lle mies s aDtmumpoo4oetoioeilsfsDemn pn(4arerircta1oaDraieilt trxm(o3nu1lleelnetat)sDur(m oo1tle mietldls rluvpnu0 exrir oy1fm rluvo;(0teur(r3iydlmtnmfcia() 2tau pot1apto iciys mDul(mo;(4 rerxf3iydfmD ln s s  rtmirpio1am   fei t) 2raxr oo4tptoiiciadfm rl(mpn() reoifcty1fp elues;(0texmir3iy4ap nlfcta(faDtr(  nt1texoioetydfs umuvpn(0 rxrmoctytlp rai s s) 2xoimpou1apenmict s  rtm(mo;t1oetnmfciydlmDul( snu4 rtrmf3oo1lp elivi;t0 2xo(o3io4ale  icta()arua(r ot0ale io3ilsla ranvpnt4altrxf3iatlpD an ol( t2urxmpiudopt mivi (  Draxm ;o4oeenmfctydfsDranvp;(4 exoif3oatfate neslt tetrxm oy1lp nlnviat sDrrxrp;t1tpenifciadlmDel(mp (0alxnmo3oy1faDrlieslt s2umxr3iydlptnlncilt)aDra( pnt4opx iietat sDul(vo ()alermr to1omD lnvo;s) ruo(o no4ole mfct ()aDrmx  ;t0teen ociyslm2ra(vo;u4 ltnxf3iodfaD lnes;()t2uo(mpiy4apte net t)a2uaumo;t1altn ociatls2eanvp;u0teermf oydfpDeaneo t0 2xoxopoo1optn fvsat) Dua(  ;t4tlxomo3tlt sDeauvs;t4arxnxr3ta1faD anes;t  2xoxr oo1ope lfcs (faDtr(moou0optnifetlsfmDean o;u0 etrirctatlaD  i i s  rtmxr3iy1lp  lncias)s2umxrpno4oltniictltlmDua( p u0trxomocta1lmtean s s t2umxo3oo4lmee ncs t aDur(  oo1aeeoifciad sDuan on(0aexoif iy1omtrlnvils  exmxmpou4aleemfesls  2rmum ou4tlx mi3iytlaDulnvs (0aexoxr io1lm rau olt sexrxr nodopenlnvs tfarrrx poo4aexoiiciydfm2elump t4 eermf ia1laDeaiei t  2xmxo iudlm  mncil() 2tmuront4tet mictydfs ra( ont0tetrxo oodfmt aueil(0 rurim3nodal e fvslt) Dtaxmono1opeo iciad s2eaumont)tltrxo3iy1fmDr ivi t  rtm(r iodllt  ncs (fartmu oou0apen ieils sDelump u4trtniocoy1la r uvols) rurimpoydom n ieiltf 2rr(  nt4tex moetldfm2um(mp t0trxrxf ootfpt lieo t setrir nudaptelics (f 2raxmoou4texoiociatfs2emn p u0 rerxf iadlaDraivi ()tetm(m3nu1oltn neia(fsrumu ont0oetoifeiytfs ra(mo (4tltomf3oydoa raueo s) 2xo(m iy4apt  netas aDraumonu1ape ifctad mDran o (4teeoiocoodfat ai s t t2urxrpnu1op nlfvtasfsrrmuro;u4optnmfetls mDrl( onu4 rtrxocoo1la rli i;t)srurxr3oydlp nlieslt  2umum nu1oltoiieiydlaDemn o;u0aetrmf3oo1faDeau i t)t2uoxopnudamtn nctatfsrrmxmpot4opxomoeiatfsDea(mpnt0tlxrio3iydop   n sls  etmio3iu4ol nlneilt)srum( onu0aexomfetaslm2rm( s;t0aeeoif3tatom  lnvi ()srurxm3oo1ll   fvsls a2urxroot0opxo ieiadlsDulnvpnu)alxnmf3oy1op  anvs;(0srtm(mpnydlmee fcs tf 2taxm ot0altnmieilt aDeanmsn()aeeniocootlatr ueils  etmio3iu4ole livs s a2tru onu0olen f3iasfa2rl(vs;t4altnir ootfat lnvo;s)srtmir3io4altnlict ( aDurxm nt4opeoioeiytlmDeau sn() eenxf iotfmtelues;t0trxoir3iudom n fvia(fsrur(mpnu4oetn o3iytfs2rl( on() exrir todomtrluvol()trumio nu4altnlivsltf ruru pno1tet  i3ias sDelums ()aeeomoctodlmte uvi t0trxo(o iy4al nliesa(f 2urumo;t4olxo ocilt m2rm( on(0 lxoircoydfmt li i t trxoio3oudoltelncilt srtm(  no4oltn f3tadlm2em(mp (0 lxrir iy1lpDe nei;()s2uoim3oo4lmenmicsa(faDtr(mo;o1tltn oeilt mDea( s;u) exoir3iytoa  aueo;(0srxmxr iy1ol e nvsl( aDtmxm ;u1tpt  i3iysfm elnms;u0arermocto1oateliei t)trtmxr io1ol e fvtl()aDtmu o;t1tpeo fetydfs2uanmpn(4trxomf iatfpt li i;s0s2tr(o3iudaptelfes ()s2umur ou4olxomoeiadla el(vpn(4tlxrxr3tytfpDeaues;s) rurim iu4lmen fcsl( s2tmu pou1aexo fetasfaDuluvo;t0alerxf tydopt an o s0trtrxr iu1om  lfes t  rrm(mpoo1olxnmfetldlm2rmumsn(0 etoio3iatopt anvs;t teur(o iu1am   nvi (f 2ra(m nu4oet io3ildfm2emn snt)trxrio3tytfaDeluvo;() 2urim nodol nmfesls) 2tmurono1altnmf3iyt a2eaumpn(4 rtoio3oydfp raueilt) exoirpno1omtnlnct sfsrurumooo1apt ioeiltfs2ran p;(0aexnmr oy1fp eau sl( seum(r3oy4ome livtasfsrra(m no1aex if3iytfmDrlnvs u)artoxf oa1lp  lnvs;t setoim3iudale lfvs t srua(rpot4alt ifeild m um( o;u0 lenio3tadoptrai o t0truoirpny4olt  nct s) 2tmx o;o4openifcilsfsDea( snu0tetnxr3iadfm e nei t seuoimpnudlpeelnesl(  2tmx ooo1aee  fetltla2rm(vo u4tlxoir3oa1fpD lnesl() 2to(o oudaltnlfet () Dtaxmp;o4texn ocildlsDemnvp u0tetrmfctytlpDeaivsls0t2ur(r3iu1oltn nes t)artmu  nt4oltomfctls s2rmu o (4 etomr oadlmDrln i;s)srurim oy4oltelnctls) Dur( pnt4teeoio3tadfm emu p;u4 rxoxr todlate nvols)t2tmio3oo4openmfct (  Duru p;t4tpxo ieiadfsDul(mo;t0trenxrcootop   iei (0sruo(m3ny4amee nvtat)a2trxrpnt4tpxnioetatfmDeaump t4texrirciotlp   i s;() eum(mpnydalt  fctat  Dumxmpot1opxoif3ilsfa uau s;t0 etomf3to1lp rai s;s)trurxopou4aptnlnvi tfarurxmpnu0olxniietytls eln s ()teerir3totomD  nvo s)tetoir io4ome  fcta(faDrmxrono4altnio3tatla2rlums ()tleomr iotomDrlnvol(0texr(m3io1lptelncs t)artaxmpno1oltnifcild m rl(vp;t0trxoir oatfpt lues;t  exr(opou1lmt mnvia()aDuau pot0tlx if3ild m2ua(ms (4 ltnmf oy1lmDe ivsls0 exmio iy1llenmnciasf Dtrx ont1altoio3ildlmDem( s;() etnxrctotopDraivs t) 2uoim3oodll nmiet sfaDrmum nu4teeomociys mDrlnvp u0 etnmrcoadfmte ivs;(0srtrio3nu4lltnmncia()sDrax  nu4optniociasfs elnvo;t4tltnmr iadoaD  neo;t)trtmiopno1llt mfesatf Dur(rp;o1olxnifctysls emuvs;u4tlerxr ta1fateli s;( t2xo(o3oodapen nvias  rtaumono4aee ifctatfmDrlnmp;(0 reoxo iodfm rluvo t0trur(m3oodlpeelfeta(  Draxm nu4optn f3ilslm2um( p;()arxoxr3oy1lpD aneol(  etmxmpio4ap elnesl(fsDtrx pou4altnioeild a2umnmo;u0 exrxf tydlpD  nvs;(0t2xmxr3iy1omenlncilsfa2taxr no4opt mf3iasfmDrau pnt) eenmf3io1oaDelu sl(0 eumir3iydamt mfviat  2rrxm ;u1aex ioeildla2emuvs;(4 lxomoctytlmtrlnvo s teuriopiydoleemnvtat) 2um(rp;t0aptn ieiltfaDrluvp u4trxnmocoa1optraivilt  etr(r ou1llt lnvs (  rtm( pou0aetnmfeiyd m rmu snt0aleoirciadlpDr ies;s0 etoimpou1om  lfesa()aDtmxrono0apx  i3tyslm elnmpnt4 exrxf todomD  n ol( s2xr(o ny4lmenlfvtas srtm(mont4olxoifeiyt m ran ont0tltomf ty1fp  au o;(0 rxmimpoydol   nvt tfsrrru  no0tle  i3iydfa umn o t0 exomo3oytoaDe ivo (0t2xrir3oo1omtemiesat) 2rmu pou0tpxoifeiydla2um( o;t4 exnxr oatfaDrln s;( s2xr(opny1lmenmnei t  2raumo;t0texo ictasfm2rmnvs t4 lenmfcty1la  lu il(0truo(o3iy4altnmnesls)sDur(m ot0tpe  ietad s2uanvpnu0trtomociy1om raiei;s0srxoio3iy4omen ivi s  Drr(rooo4oeto ietadlaDrmn ont4tleoxr3oodomteln o t  2tr(m3iodomtnmfesl(  Dua(ronu1alen fciydfaDrlu snu0 rtomociatfmDeaneo t0 rxoxr3ny1al emicslt) rrm(m nu1aetn o3ils m rlumpnu0 exnmr3iodlmD  nesl(  rxrir iudome lfeil() 2tru  no0apx mictltfsDelnmpnu0trxnmr3todlmt aieo;(0t2to(o ou1aptn nviltfa2ur( pnu1optn o3iadfs2um(mp (4arxrmr ootoaD auesl(0trtm(m iodap nlfvt ()s2rmu  ou1tle mi3tyd m2elnmo t) rxnxfcoadfpt ln il( srxoxopoy4al nlici ( s2ta( ono4olx ifciysla2uanmp;t0tetoxocta1fmD aies t)t2uoim3oy1ll elnvtat)aDrrum ;o0altnmfeilsfm2ra( s;t4tlxrxf3iytlm e ivi;t texoxo3io1lmeelnvsls s2trxrp;t0olen f3iadla ua(ms (0teenxo3oodlp  lu i;()truoio oo4ome mnetl()artax onu4aeen feiytfsDemuvp;t4trtoio3tatfptrau il(  rtmxopoudam emfvi sf Drmxr ot0ape mo3ilsls2umuvonu4tleomr totfpD lu olt  etmim3iydlm emnvsas)s2tau  ou1tetn fcils mDua(von(4alerif3ta1fa r ueolt s2xmxopnydlpt  ict t arrr(moot0olxn o3ildlsDraums;t0trtoxr iotlpD auvs s t2uoirpio1lm n ieilt sDum( p;u4oee  fcils m2rmuvpnu4arxoxf to1la e i sls) exmio iu4opt mivtas) 2tmu oot4alt mietas a eluvo;()trtoifcoy1oaDeaneo s0 rtoimpiudom nlncsltfs2rm(mp;t0olx mietys a em( o;t)tetrir3iadfate nvs;(0trumio3iudlme mnciasfarum(rpno4aptoif3tasls el(vo t) eeomf ia1omt aiei;( trur(o3nu1amt lfvsat)arumu pnt4olt moctaslm2el(vo u4 lenio3tadopDeli i;t)t2to(r3no4alenmnvt (f Draxronu0tleo ictls mDel(ms u4aleoxrctydla  lueo;s0 2urxmpoo4openmici ()sDrmu  oo0alxn ocilslaDuauvs (0aeenxo tadfmt  i i () 2tmxo3oo4amen ivtls)sDraxro;u0aex  iciydfs2eanvs u0 eerifcoa1fmtraneilt s2tmirpio1opee fcilt)a2trxr oo4oex  oeiasfa uaums (4 lxnif oatfp elivi;t0 etoxmpny4opeemivs tfa2ur(m ot1tpeomoetasfsDumu s t)tlxnxrcio1lpDeauvsl()s2uoxo3iydaleelfetl(f ruau oou4tetoif3iys s2ulums;(4aleomo tatlmD lies;t0 ruoxopiu1lle  ies t aDumurpou4apen o3tatfm rmu s u)aetrio3oy1fm eaivs t t2ur(m oydlpeemnesas  Drrx  ;u1oexo f3iydla ranms;() etoxr oatlmDrlneolt)srumxr3no1ll nlnetlt)a2tru poo1ape moeiytfm rmn p;u0trerif ty1fmD anvs;()s2urirpny4lptelnesat aDuaxrp;u0aeeo ociadlm2rm( p (0trenxr oydfpDrluvo;t)t2tmxopiy1lmtnmfes t) Dumum ou1tptn iciysls rl( snu0arxnxf3oo1fmtelnvi;t teur(o oo1apt  fesl() rtax ono4tex  fctat sDemnvpnu4aeerxfcia1oaDeaueol()truoim oy1altn nviat)sDua( oou1aeenmfeiat m rmnvo u) lermrcia1fptrlnes ()trum(o nudomeemneilt srrr(m ;o4apx mfeiatlmDuluvo;() lxoxr oa1oaD anesls texr(r3no4lmtelnesas aDtrxrpno1tlxomfeiatfm eauvo t) lermo3iotfa r nvslt)srxmir3no1omeeliet sf Dtaxroot1opxnmi3tysfm ul(mpn(4trxomo3ty1fmteli i s s2umxmpoudamen nes () rtmxr nu0tpe ifciyt a2ul(vs (4 lxoif3iytop ran o s  rum(m iy1op  mnciat  Dtmx o;o1oee if3iytl
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;s srxmxmpou4amen fcsat arra(mp;u0aleoiieiat a emnmo (4artomo3totfa  lu o (0 rurxm3oo1lmeelfvi sfsrurxmpnt0apx ifetat m rl(vsnu)aetoifciadlmDr nvs;(0trtmxmpoudomt mncilsfa2rrx  ou4ale ifcilsfm2ranmp t4tleomrcoodomDraieo;s0 2uoim3no4am e ictl(  2rmurpou0tlxo oeiadlmDea(ms () exnxr3iytoa e n sl( s2xr(o ny4am elicsa( arrm(moot4ope ifetadfa em(mo u0tlxrxfctodop rlu o s) exriopnudal e nct s)aDrmumonu0tetoio3tld mDumnmp;() rxrmo iydfptr nvo (0setoir3iodapen netas) Drr( pnu1teto ociadfaDulump;t0trtrxo oo1fmt  nvs s t2xrxm3iodop e fet t) 2rax pnt0alxn fciytfa el(vpnu) rxomr tytfate n s;()s2uoxr ny1amt  ietat)aDtm(rpoo0tle ioetad m2ulnmpnu4tltnmrctodlpte n o () eurim3ny1lpeelfetl(  rtauront0tleomoetlt s2emumo t0 rtnmoctotopD anesls  exmxr3iu1ameelfvsl( sruaxronu4tleomfetlt m2uau on(0tlxrircia1lpt  nesl()teto(r io4lm nmiviat)aDrm( p;t0aetnmieiltfs uau s (4artrifcoydfpDe nesl(0sexmio iydlm e fviat  rur(r ;o4tlenmfeiysfa2rm( s (0altnxr3io1lmtelu s t texoxopiy4amte nvtat)sDrr(  ;u4ope  iciyslmDranmonu4aeeoxr3ootfpDr ivsls)s2uoxm3iydlmt lictl() rumx o;t0tee ifctydlm eln pnt)arxomr3oytoaDelnes;( s2tr(o3no1aleemfci s  2rax o;o0oltniieilt aDrauvo u4tltnir iodfmtr u ils s2trxo3iy4am  mivt s)s2rr(  nu4tlenmociltls2rl( pn(0 rermr3iadlp  anvils  rxoxopoy1llenlnctl( arurxrp;u4aexnmf3iyd sDeauvpnt) rtrxr3tytopD  u i ( srtrio3oo4lmenmncs s srur(mp;t1tpx mieiadlm2rlnmo t0 exoxf3ootopDe i o;t0sexoimpiy1ale mfesa(  rumurp;o0tet miciytfmDua(mp t4tltnif ootomtrauei;s0trxoxmpoo1alenmnciatfsDumx pnu4tpt  i3iatfs rlnvonu4 rxoio3iy1om  lnvil(0setmimpnu4amtnlici t)srtrump;u4openiociyt a emuvon(4 lenmfciytom e i o;t0trtmxm3ou1lmtnmfeil() 2urx  ;t0apeoiociat aDrm( s;t)artoio3ta1fp   ieslt0srtmimpiydoptnlnctltfsrrr(m no0opeomfciyslmDulu s;(4aeenmr3oydlm eaivsls0seto(mpiudoltnlfvilt a2tmxm ;u1aet  i3tasfs2eanvp;u4alxnmf3ta1om r nes;(0seurir3oy4amee nvtl()sDrru o;u0tlt  o3tatla2ul(vsn(0 etnmf oydfatelueils) rurxrpnu4ome livsat arur( p;u1opxn fetltfs2el( p;(0aetnmfcty1fp rlnvo t t2xm(r oy4lm  liet s) Dua(mp;t1oetniiciadla rlnmo;u0 eenif3oatfaDr n i s)sexoim3iydlmee nci sfarumum ;o4tpxn o3tyd mDrauvp (0 renxo iadopD  ueo;t)srxr(rpiydlleelfvtltfarraum nu1oetn i3tas s2umuvo;u0artrmf3ootop  aueo;s) 2trxmpio4ape  feilt  2tr(  nt0teto ietadfs uauvpn()alenxrcoydopDrauvi;( s2uo(o3iy1al nmnet s artmu o;u0aee iieiytla rluvsnu4tlenmr iadoat au sl(0 2xoxopio4amt  neias arrrx pnu1oltn fetat s um(vsnu) etrmf3tydopt  nvs;s srtr(opio1omt licia(farraur nu4apeoifetlt mDrmnms;() rxoir oy1fp elivolt teur(r3oy4apt  fcsas aDtaxr ot0alxoiictls s2umuvsnt4aeeoxf iodoaD  nvs s trxrimpou1lpeelnctlt)arra(ro;o0opxn ieiadlm umu s t4 lxrxf3oytfm eli o s) eumxo ny1lpeelnciasfarrr(rooo0tltoif3iysfa elnvp (4 rerxr oo1fm r n i ( texrir oo4lltelneil(  Duaurpnu4oetomfciys a umn snu0trxrmf3totoaDr nvsl( texmio iu4ol emnctlt)sDuaxrp;u1tlenmo3tlt m2ean p u0tltoxocoytlp elueo;s t2trxm no4llenlies tfsDuau pnu0aet ifeiydls2em(vp t4 rtoxrcoodfa r uvi s trtm(m3ou4ale mncils)srrru p;o4oltnif3iadlaDuaumon()arerir3tytfmDean sls  2umxm io4omtnlictlt  2ur(  ;t4apeo f3tadlaDem( s t4tlenio3oa1fpt anvsl(  eurxmpiu1lpe lncta(fs2rmx p;u0tpt moetas m rmuvp u)trerio iatlpDeai s;s sexoxopny1ap elieiat sruau ono0aexnmociys a2emn o (4tlxoircoadfpDrlnvols teuoim nu1lmtnlieiasfaDuru pou4alxoiietltfs elums () eerxf io1laD ai slt0s2toxr3iu1lm nmieilsf rumx o;o4oltnmietadls ranmpnu4 rxrio iydomtelivo;s  2xoir io4ome  fvia(fsDumumpot1alenmi3iatfs um( o;u4aexoxr3ootoateaivo () rxriopiu4lme  ncils)a2tr(monu0aexoio3iyd m ul( o u4 lermo3tadfaDean o s srto(o3iydapen fctatfa2taurooo4oee ii3tltls emnvo;(0aetrxociydlm  anvo;t t2urxmpnodaltnliviat aDtrur ;u4aexo ieiytfa rm(vp t0alenir3ia1fa e u ol(0t2xrio3io4optnmfetl(farrrum ot4texoii3tydls2rau snt) eeoxrciodfmDr i s;()trtmimpiu1lptnlfes (f rrmur ;t0ope io3ildfs2em(vs ()tlxnxf iotfate ivslt  exoxm3nu1lmt mieslt) rraumo;o1tpen i3iasfsDelnmpnu4arerxr3oo1fpteaneo (0texoxr nu1lmtelieiltfs2raxmpou4opt ioeiatlm2uau o t0 exnif iytoateluvil( tetoimpny1lmenmfcsa( sDum( ono4tpe ioctatlaDuauvo u)tlenmrctadoat lu s (0t2uoxo nu1llen nvilt a2umxrono1texnmociydls rau s ()tlxomo iytlm rluei (0srxo(opio4ole liesa(  Dua(r ;t4ope io3tad mDra(vs u0trerxocoydomD aieilt  2urxo3oo4apen netls aDuaxrp;o1tpt  fciadls2raumo u0teeomo3iytfpt aneo s)trtm(r iy4lm  lfci (fs2um( p;o1opx  fciysfaDrl(vp;t) lxnio todfa r ieo t tetrxopiu4amee ics tf 2tr(m nt0texn o3iadfs emn p u)alxrxf iotoaD anvo (0 2tr(m oy1ap  mictas aDtmu p;t1tet  i3tat mDranmpnu0 etrifcio1omteanvs t s2xmxo ou1amtnlfctas)srua(r ;t0oet mf3iyt m rau p ()teeoxo oa1fpD luvo t)teurxrpno4openmnci s aDrr(rooo1oetnmictlslm2eauvo (0 ltomfctydopDe nei;s) exm(r iudlmte nvils)srurx oou1aex ifcildfmDumn sn(0 ltrxf3iy1fa elieo s) exo(m3io4optnlfct (faDrax  ;t1tpe mfctlt mDrl( s (4altoir oa1lpD lnvs;(0t2um(opou1lm  lnvil(f Dtau p;t0apeoio3iyd s2rlump ()artoxrctydopteln o;s)trxr(o ou4am emfvt sf Dtmx ont4apeo ieiyt aDrmu s;(4 rtnio3tadfp  aueil( tetrir3nydll nmfei tfa2rmu o;t4apxnii3tlslm2rm(msnt)tlenio oy1faDe ies;t s2xrxrpiodomtn fvtls)a2ua(  ;t0olxn f3iydfa2ul(vs;t0 ltrmr3iatopDr ueil()trxrir ny1aptemnvtltf 2tr(monu1aet iieiyd m2um(mp t)aexnmo oa1lmDrluvilt t2uoxm3iy1alen ivsl( aDuru  oo1alx  fetlt s el( pnt0 exnif3oy1fpDrlies t0texrxr3nodllenlnvi t)s2raxr oo0aptnif3ildfm eau o () rtoio iydfaDrlnvs t  etoio nu1apenmncsasf rua(r oo0olxoio3iydfm umnms;() rerxo3iy1opt lieilt0 exmir3iu1alen ict s  Drmxr nu1tetnmoeiytfm2el(vonu0alxriociy1omD  uvil()s2tmxo3oudop e nct ()srtrx pnu1oetnmoeiyt sDelnvsnt0tetrxr tydlaDrli olt) rur(rpnu4amtemfct ( aDua(m ;u1alxoiietysfs2rau o;t)trxrmf3oo1opDeanes s) euo(r nodop emfcsl(  rrm(rpoo1tpe mf3tadlaDua(mon(0tetnxfcio1omtrlivo t)t2trim3oydll elneslsfsDum(r oo4olt micildfm2rm( snu4aetnmo3oatfpDr ues;s  euoxr no1lp e fetls sDuax p;u0aptomi3iasls umnmo;t)arxnxo iy1lmteaueo t srtmxo3ou4lmtnmfetlsf rurxro;t1oexnmictyslsDuln s ()tetoxo3iadlatelies;t0teurio3iudomen fvs t a2tru onu4optomoctytlm rlump;t4areoxr tytoa eanvils t2toxr3oo1oltelfvs sfarur( pno0aptniociasfa2em( pnt0tetnio3oodfptr ueo ( trxmxo3no1lm  mfet (fa2tm( pnt4apeo feiydlsDuan p;t4trerxr oadfa elnes;t0 euoxm3nudap elnes sf Drrurpno0optoifciadfs el(mo ()trtrmoctydla   ivilt0teumxm oy4olte fctl(  Drmump;o0alenifciysla2rm(vs;t) ltrmr3ia1om e n o () 2xo(opoudomenmfetltfa2um(mpnu1tpeo f3iyt s2ulu o (0 ltoxrcoadfp   uvi;t srtmxopiy1llenmnetls) 2ur( poo0oex  o3ilsla2rmnvs;t0aetrmf3iydom eanvo;s0texm(r iydll n nesa(fa2rmxr ;u1oee  ieiatfm rau o (4 etrxo tatlpte i olt0 etr(m iu4lme livsat artrxm oo0oleoifciytfs umu pn(4arerifctotlpt li i;()s2tmxm3iodaptnmfviatfa2ur( pnt4apenmfeiasfs rmuvo (0aetnmfcta1fmteaivs (0 2xm(m3iy1lptemics t aDrmurpoo0ape mf3iltla elu p;u0altnmf3oo1fm rau s s srxo(o nu4lm  mfcia(f Dtax o;t1opxomicilt mDuanvs t)tlxrio3tadop   ueo t) rtoio3ou4op  mfvsat srtrx oou4tle if3tatfs ranvo;u4 eermf3oydopDrln sls  rto(rpiudoltnmivsa( srurx o;t4aetn oeiadfmDrm(vs ()tlenxrciadfp  aiei;() rumir3io4lptemicslt s2rru  oo1oet  octyt s2ua(vsnt0 eenifcoo1lmtrluvo;(0sexriopio1ome mfciat) 2ur(mo;u0alt  iciysfm rlu s u0teeoif3iotfpDrlneo;t0t2xr(o iu1ll  mnes s srumxmooo1alen octldla ul(von()trtrxr oodoa  au o s) rto(o3oudlm  lieilsf Dra(mo;u1apxomoeildfa umums u0arxnxf io1fa eau ils0s2xrxr3no1lm  mnvils aDrm(  ;o0alx mi3tydfm2rmn p;(4trermr3oatlpD  nes;t)trxrimpno1ol n fesat aDtrx p;t1ale  oeiat aDrmnvo;t4tetrifctatomDr nes t) 2trxm no4lptelncslt) Drm(rpnu0ale moctytfs2emnvs;u4tltnxr3oadfm eaueil(0t2xrim nodlm nlnvs t)sruaxmpno1aexn ietyt m2ran p;(0 lxnio oatla eau slt)trtoio3oy1lp  mfeia( arua(m ot4tpto o3ilsfm rmuvo t0aexomr3oatfmteauei;s0teuoxmpnodaleemiesat) Dtmu ooo1opeoiocilslmDemn p;(0teeomo3oa1omDraues;(  2urimpny1lp  lnctltfs2ur(r ou0opxo ietlslaDrmnmo;t4tlxomf3iodoa elnei;( trxmiopnydomtnlnvt tf Drmum ot4apeomfeiydla rm( snt0alermf ty1lmDr ivi;(  2xoxr oodol emfci (fs2rmu oot4apenmi3ils a2rmuvonu0arxrxf3oo1laDrai s s t2xrxmpno4olt lfei tfarurur oo1tex mfeildlm2em(ms;(0texrmr oo1laDe i s;s)teuoxo3ny4lp emfetls) rurxmp;t4tleomoetad aDuluvsn(4teenxo to1fa r ieslt)trxoim oy4ap e fvilsfaDtaxmono0aex mf3ilsls2ea(vo t0 etrir3oadlpDelnei;t0trto(o oy1lmte fct tfarrmu p;t1aexo i3iadlsDrlnmpnt) etoioctytfaDe u i t0 ruoxr3iodom nmneia()srtmurooo4tlx  ictysfa uln pnu0aetnmr3oo1lmtr ues;t)trxrxo3ny4omee fct (faDua(rono1oetnmi3iatfsDul(ms;t4arxnio iotfm eli ols srxmiopnu1am   nctas)artm(  ;u0oleoiietltfm rmu o u) leoxoctytoa e u s;s sruoim oy4ll   nctl(fsDrm(mo;u0aet if3iatlsDrluvo;u0aeeomf3todop r ieo;(0texoio3iydale lneil() 2taxmoot1tptn fcilsla um(msnt0aetomr3oy1oaDrluei ()t2umxr nodopt mivtl(f Dtrxmp;o1oltnmiciyd sDel(vo u)texoxf iatfmDrluvils)s2xmxo oy4optelfesatfs2rm(rpoo4oet mi3tasls2umuvo;(4alxnmf3to1fptrluei;s seum(m oy4am nlfeta(f 2urum ;u0aptniieild s2ulu o (0teerifcty1opDr neol()sexrio3nu4optnmieta()arum(mp;o1oee  oeiyd a rm(vp () ltoir3tytla  au i s)setrir iy1lleemfetls)a2rmu ono4tltomo3iadfs2rmnvonu4 rxnif iy1lateln i;t srtoxo3iudlle mneia(fsrrmu  ot0teeoiieiyd mDeanvon()alerxr iadoa   i o t  rxmxmpno4amtnlivsl( aDuax oot4alxo ociasla2el(vpnt0altnif oadlp rlivi s truoir nudalt  fctat)arrruro;o0aee moeias m2ra(mpnt0tltnmf3oy1fpDr ivol( seto(mpoo4ale mfcsltf Dra( oou4alx  ieildfa eaums t) ltnmo3oatfpD lnvolt  2xoio iu1olenlncil(f Dumuroou0aeen o3iadlm2ul( p (0artnxr3totfmDe neslt0 ruo(m ny4omt micsa( s2rmu ono4tlxomfeiytls ul( onu0trtriocoatoatelnvsls t2urxo oo4apenmnct s a2tmx pot4tlt  ociadfa2umn s (0 rtoxo3iatlmD livi s  rtmxmpiy1lmeemfetls s2tmxm no4tetomi3tasfm um( p u4 eeoifciodomDeluei;t)sexo(m oy4lle  ncs ()sDta(  nu1oeto oetatfsDem(von(4trtoif ty1fm e ieo;()s2urio iy1opeelici (  Duauro;u0oeeniocias s2eau s;()aetnif oodoa  livs t texmio3ny4lpee nct t) rtrxm nu0olxomietydls2rm(mpnt4 rxoircootopteaivi;s trtr(mpnu1openmivsa()a2tmxmpot0altn i3iyslm rmnmpn()altnxo3io1fatrai ilt srxm(opno4opt  fetasfs2um(monu0tetniieiadls eln s;t)alerir3oytlp rau s s0t2xmiopno4lmtn iesat)srumu  ot0aeen f3iltfm2ra(vs;(0texrio3iatlaD  ieo t sexrxo3nudlp nlfvils)s2umumo;u4alt mfeilslsDelumo (4artoif3oa1oaDeluvi;(0trtoir ny1aleemnvt s a2tmu p;t0tlxo i3ilt m umnvo t4treomr tytfa raneilt0t2xrxopou1op elnes s) 2umxmp;u0altoio3tydlmDulu o (4 ltomf tatfa rliei s) 2urxo oo4ll e icslsfs2raurpoo4aexnii3ias sDemn on()arxoxr iotoaDeluvo s0t2trim3oy4al emneslsfarrmumoou0apeo ocildls rlnmp;t4 renmf ia1lateau o t trxm(r3nu4omtn nei tfa2rrum ;o1tleoifciltls2ea(vo (4 exnmr3oy1fmt  i ils) rtr(opiodlmeelfei t s2tmxrpou1aleo iciyslsDel( p t4aetriocio1fmD auvo;( trtr(m3nu4lpenmieslt  Dta(rpnt4olt ifeildfaDran p (0 reomo oodlm r nei (  euoirpiu4ol nlfvil( artau pnu1tpt ifeias aDrm(vs;u0aleoifctytlat lnvs t0s2xr(mpio1aptnlivi tfaDtax  ;t0tpxo ieiatfs rm(vs t0 etomfcoytlmD ai il( s2xrirpiu4op  lncs s s2urx o;t0tlxo i3iydfm2em(msnt)artnmf iadomDeai i ()sexm(rpnydlp nmfvtatfsDrmxr nt1tltnioeildlsDem(vo ()teerxocoy1lm  an ols teumiopny1apee fct (  rrr(mo;u0tpxnmf3ilsfsDeau o t0altrmo oadom e ivo;()t2xmio3iu4al e nvsas arua( o;u1olxnmieilsfmDumumont0alxoir3ia1lat lues s seum(m nu1lmt  ivtltfa2ua(ront0oeeo ietytfs2ea(mpnt) ltoio iadlmteliesls)srxrir ou4lpen nvt sfsDta( ooo1oltnii3iat a2uau s (0tetnmociatlm  lies;s)s2xoxr nu4omen ncias aDtrum no1oleo i3tlt s em(ms (0 leoif3oytop eanvs t0 2xoxr3iy4amen nci t)aDur( ooo1tex micias a uanmont)trxoxfcoytlmDe n o;t0t2urio oy4llt  fctlsfaDtaxmpot1olto octlt s2ua( o;u0artnifcootfa   nei;t)sexoxopnudom e fvsa(f 2urxmp;t1tleoifeiasla2umnvonu4 eeomo oy1fmDeli o s  exo(m no4aptemictas sDrrxmooo1aetoiociadlsDrmn o () rtnmo3tadom eanes () etmio3iodap e nvi t)aDtr( pnu0altoii3tas mDemnms;u)tlerxrctydoa r n ols s2tm(o iodale mneias) 2umu o;u0ape io3ils s2rl( snu0artrio iydlp   ivi;t) exoio3oo1alt  netasfsDta(r ou1tee if3iydlmDuaumpn()alxnif3oo1lp rluvs t0texrxr3iudam   fvtatf 2tr(  nu4tlt mo3iatls em(vp u) lermf3iotfaD  neo t) rxrxm nydome mnctls artrxro;t0texo fctys s emuvo u0tlxrif tydomDr ivo ()s2xmxrpoo4lptnmfcsasfsrurx o;u4oee io3iad mDeanmp u4trxnirciadfaDe u ol(0s2xm(mpio4lptn nvi ()a2trx  nt4aeenif3tltlm2ra(mp;(4 leoircoydlmteanvols srxoirpnodlltn ivi t s2tmu o;t4tlxo oeiltla2rmu sn()alxrio ta1omtrlnvi s trtm(mpou4ap   ieilsfaDrauro;u0tpeoioeilsfs2emnmpnt4trtnioctotfa eai o;t)sruo(mpio1om e fvil(f Dtr(root0oexnif3ils m em(ms t)arxomfcoo1fmD  i i;t seum(m3iodam emiciasfarraxr nt1tex  o3iydla2elu p ()altoir3todoa  ln il() etrxo oy1op nlivi t)srtrxmpou0teeoii3tldls uanvo t4artomr3totoa  ai olt  eurirpnodlmt liet s)sDuaxmpot4tltomictysla ra(mo ()tlenmocoydomt  nesls0trxrxr iudlle mncil(fs2tmxmpno4olxn octyt s emn o t0trxrir3oatfatr nvs t)teur(opno1am   ncs t aDra(  ;o4optnifeiaslmDumn snu0 eeoif tadom e uvi (0 eum(rpny1omte feia(fa2tax pno4apxnmo3tlsfa emnmo;()trtoir to1fp e nvo t) rtmim3ou1ol emfct t)a2urur oo0aetnif3ilslaDrlnvs;u0trenmocto1oaDraivs;(0srxoio3iy1al nmfesatfsDuau  ;o4teeo iciadla ra(vo;(0tltrxf3ty1la   i sl(0 rtoxm oydapt  fvil( sDrmxro;u1altn iciytfs2elums;t4alenmo3iadopDelu o;( t2tm(mpiodalenlncsat)s2tmumono1altnmfctldlm2um( p;u4 rerir ty1fpDr ueslt0 2urir3iy4ameemfvs t)srtaxmpou1olxn ietyslmDrmnmp u0artrxociatfm  livol(0t2urxr3oodlleemivt ( srtmx ooo1aetomociat a eln o (0arxrmr3iotopD aueo;t)seuo(opnydome lfvtlt)s2tr(rono1oltn o3ildla2rmums;u0 eenioctytop r uvs s setmxr ny4ole lfvtlt)sDtmxmpnu4tpe ii3iadla rauvo;(0 etrxo oo1lpte uvs ( trumxo iy4alen nvtlsf 2raxm ot1olx  fctas s umnvpn(4tlenmr3ta1oa  ln s;s  eurxrpno1oleemieils aDra(m no4olxnmoeias sDelnmp t0 lerir tatopt lneolt)tetoio ou1lp elnvsl() Dumx  no0apto feiadfm2emuvo t4 exomf iytfaDrauei t0 2urxmpoudopte ivsls aDurxr ;o4opt moctlsls elu snt4teenio to1fpt au o t0sexoxopnudoptnlnvil( aDuaurp;o4opto o3tytla ua( o;(0aeeomocta1laDeanei;()srxrxmpny1lmtnmiviat)srurur no1tltomf3tatfm2ulnvs (4arenxf3oy1opD luvsl() rtmim3ou4lpe lfet s arururpou1aleniieiydla2rlnvp t)tltomfciatoa   ivsls)texm(r3oodlpen nesas aDtaumono1oetomf3iltla emnmon()tlerio iytoateln i;s  2ur(o3nu4oltnmfctat a2tau p;o1oexo oeiatfm2em( o;()aetnircio1late i slt0t2umimpiy4ol  mncs (farrrxrpnu0olxoiieiatfsDrlu onu0tetrxo3oo1la ran o s  etoim oydam n ivia()a2trump;t1tpx iietat sDrmnmo t0alenio todfa eaivo t0s2trxm oy1lmeelfvt () 2rm(mpnu1tleo feiatfm2emnvp;t) eerxocio1fmD au slt0texriopoy4alenlfctltfsDrm( ono0oeenmociyd m rln p;(4tlxn
\ No newline at end of file
@@ -0,0 +1 @@
+ivolt srumirpoy1lp eliei t aDurxmo;o0texnii3ilsfsDranmpnu0 lxnxrciy1fm  anvsls)seurir3oodaptelfeta(farurx  oo1alxomfeiad m2uan o;()trxnifcta1fat aivil( teurimpiy4lptnmietas aDtm(r ;u1aetoio3ild s rl(mp t)trtnmf3oatomt lueolt)srurxr3ou4lp nlfctl(fa2taxmonu4ole mo3ildfm elnvpn()tleoxf3iydlaDrauvi;( tetmim ou1ameemnvs ( srrr( pou4olx  i3iat s um( o;(0 lenmo tadfmDeanes s  2xo(m3nudomee fviasfarrmur ot4tleoiociys m2ea(vp ()arxrxfcoa1lp elivo ()s2urir io1am   nci s)arur( pnt1oltnmictadla2rmuvp;u4altrif3iadlmD lnes t)t2trxo nydlpeemnvt ( sDumu p;u4apeo oeiytla2ran o (0 ltnxr totoptrlnei ( trxmim3ny1openmnci ( srrmur ;u1apx mfctas a emuvpnu0 etrxr3oodfpt  uei;(0 2xoir3nodalenmfvia()arurxrp;o4apeomoetatfaDelump (0 rtnmo3iatlm  lieo s0t2xr(r iydal nlnes () 2rmxmoou0oetn ieiydfa2rluvsnu4trtrxr iy1fp e neo;t)trxmiopoodope livt sf 2uru  ot1aex ioeiasfm2ua(vp (4 renxo3io1lpDelues t)srtmim ny1al n ics t) 2uau pou1aee iociyslm rl(von()texomr3todfaD  u sl()tetoxr3ou4ap  lnvtls) 2uaum ;o1tlxnmf3iatlm ea( p;u)tetnxfctytfatelnvs;t0seum(opoydamtnmfcta()arrmu p;o1tptomf3iydlm um(vo u) lenxocoa1fpDr iei;(0texoirpoy4lltemivi ( a2trumo;o0ope  i3iltfm el( sn(4 eenirciadfmDe ivo;( sexr(m oy1op emncsl( sDrmxrooo4optn fctytla rm(msn(0artnmr3tatfp  au o;t s2uo(r ou1altn fctl( a2tr( ooo0apxomf3iydlm2rluvs u0 lxnxo3oa1lp eln i;s) 2xoxm oodolenlfvi tfsDum( ont1openmoeiyslm2eln pn()teeoxo io1lp elnes s0 2urxm iy4ap nmiesat)s2uaxmpno1oetnmfeiatfm ea(vp;u0 ltomo3oydopDr ueils srxoir3iodapt lfviltf Dtrur oo0tle  ietytfmDulnmonu4artoxoctotlp raueo;( s2um(opio4lptn nvs s)aDtaum oo4aeen i3tltlm2um( pnt4 reomf3oatfpt aies;(0s2xo(m oo1ap e ivi (  rraxr ;u0apxniiciydfa2elu p t4tetoifciadomt li i t seuoxrpoydoltnmnct tf rtaxm oo0alx ifciltla2em( p () lxrio todomt  uei;t  ruo(mpiy4al emici s)s2tmxmp;o1tet mi3iltfaDemnmo;() lxrxf3iydlm rlnei (  rxoxr ny4ll nlfvia()arrmxrono4teeo ieias s ua( o;(4treomo3tytopDr ivs;(0t2xmio3no1am   fci (faDtaur ;o1altoioeilsfa2rl(ms;u0aexoxf ta1fm rauvs;() 2trxo nydop e ivs t aDuau ono0tleomoetaslm elnvo;t)tetnxo3iytlptean s;s) 2uriopoydape  nvsa()s2tmxm no4apeniiciyt a2elnmp (0 ltrmo tydopt anvs;(0trxo(mpiu1al n fciatfarra(ront0tlxniiciytls rl( ont)teenmo3oy1lmtr n s s tetmxm oydlmee fei (f 2rmx p;o0altnifciltfsDum( p;t4arenmfcootfaDeaieo s0trtoiopnudole mfcilt  Draurp;u1openmfciytls uaumo;t4artomr oo1fptr u i;(0t2tmiopiydll elicil()sDrrumooo0tlenmfciltls2em( o;(4alxniocty1lateaiei t0s2toxopiy4opt  ivt tf Dtmxmoou0tlx  i3ildfsDuluvs;() eerir3iadfa  aneo (0 2to(m3iy1lp e fvsltf ruaxm nt4aeeoii3tlsla2rau p;t4texnif3ty1lmDeaneo () 2to(rpou1am eliesat)sruax  ;t1teenmociad sDran o;u) ltrxr oa1lmtrln s ()teum(r3iy4lpee iet () Dur(r no4aeeo ieiasfs2eanms ()trtoxo3tydopD aieo s trxmxo3oodapte fvs s srrmumo;t1aeenioeilt sDemu o;t4aexomr iodomteai o;( setoxo3ou4ap e icia()a2rrxmo;u4altomo3iatlmDemnvonu)tetrxr3iatlmDe ivi (0 ruoir iodal   nctl() 2urxmo;u4tlx  f3ilslsDuau s;u0 rxomo iodfpD anvs;t0 2trim iy4omte feslt)srrrxm nu0alt  oeiatla2eln o u)arxrio3ia1opteln o;s  rum(r3iudlmt  fetat  Drau oot1alxoioetatfs2um( pnt)trtnir3ty1fp  aivslt texoxrpoodlpee ncs t  Dtaxmoou1tlx ioeiasla rln s u0 rtoioctatfmteaiesl(0t2tmimpou1ap e ivsl() rtaumpnt0altniiciytfm2ra( sn(4 rxnxf3ootopt ln o s  euoxopnodom  lnvslt a2tm(mp;u4oeenio3tysfa2eau s;t0 lxrxoctadlmDrlu i (  2um(opoydlm nlnet ( arrm(  ;t0apxo f3iydlm umumsnu0 etoxrciodlm e ivil() 2toxopnodom  licilt s2rrx pot4oexoifeiyd s2ea(vo;t4 exnir todfat lues s)srxm(o iudlm elfvs t)artaxmpou4tex  fctltlm2ran o;(4arenif3iatfpt  uvs;(  eumimpno1am  miesa( a2trx pno4teenmieils s uan s;t0 rxrif iy1fa raivs t0t2urxm iy4lltnlict s artr(rpot1texn o3ias s elumpnt) lxnxr3oadom rai i s)seuoxm nudlm e nctl( sDuru ooo4alxnioetlsfs rlu sn()alxoir ta1lpD  ivil(  rurimpno1alenlfvsasfartm(mp;u0opt iocilsfm ulnmo t0alerxr oadlpte ues;(  2toxm oo1oleemnei sf Dtr(  nt1opt  fciytlmDrlumsnt0 eenmociytoatraivs s) rtmiopiodalenlnvtat  Dumxrpoo1oet  o3tat s2rln snu0tlenxr3oytlaDeluei s)s2xr(rpnodlleemncs s)s2rrx poo1alt mf3iysfsDrm( p (4 leoif iodomtr u ilt0trxmimpiu1om nlnesat)arrmx  nu0oet mi3iadla2ua( o;(0 eeoxf3iy1oat aiei t s2umxr oy4omeemies ( a2tmxmp;t4tleomo3iat s emumo;u0arenmr ootlmDe i s;(0t2toim3oodoltnlnvsltfaDtmumpno4apx ii3iydla2uanms;u4artnmfciadomtrli il(0 2umim3ny4altn fcta()arta( ont0tleo feiltlsDulnvo t0trtnif3oatfpte ues;t0t2tmir3oy4ap n ncsasf 2raxronu1oex io3iatlaDeanmo ()aexoxociotlp e nvols0setrxr3ny1omeemicsls arrrumpou1tee  o3ildlm2uaumsnu0 rtnmfcoy1fmt aueils)t2umim ny4ape lnetat)srrrur oo1oetomf3tlslm rmuvpn(4 eenio3tatfptrlnvi;t)trxrxr3nu4lpe  ieias) 2tmx p;t1oltnmf3ild s emu snt) rxomf3iatlaDr ivol(0 rurxr oo4lmt  fcs ()arur(m nu1olen ictydlmDel(ms t4teenxo3oydom rau o;t)srtrxm iy1aptemnvi t  2ua( pno0aleomiciysls2rln p;t)aleomfcootfaDrau ilt0seto(m oodap e nvt tfaDumxrpoo1opxomo3ildfs rm(vp;(4tltrxf3oo1oa r n il( s2uoxr iy4om nmneia()srurumo;o4tleoiiciasfm um(vo t0areoio3oydla elnvi;()sruo(o oo1ape  nei s)sDur(r ou1oetn oetasla2umn s t)altnxf3iatfaD luvo s s2uoxo ny4ol elieils  2raurp;t4tex if3tatlm rm(msnu0texnif tytomD  ivi s0seur(mpnu4lmenmici ( srum(  ;t0aeenmociydlm ra(vpnt4aleoxrcoydlm  auesl(0 rtr(o iy4lp   fci tfartau ooo1aeenii3tlslm eaums;t0tlerxo3oydfmteliesl() 2ur(r iu1om   ics ()a2tmuront1tpeomictatfm uauvp;()trenxr3ootop  an i s0 2tmio ny4optelfcs t srumu ono0aetnmfeiyt s el(vp;(4aeeoxf oy1fmDeli sl(0sexoxm3no1ape mnci s a2rmxr ;o0tpxnmiciysla2rmnmp;u4 eenir iydlatrai i;() ruoxm3iudlme  fct ( s2um(rpnt4aet  fctlsfa rm(msnt0texrifctadlaDelieo;s setrxr nu4ap nmneias) 2raxrono0opxniiciyd a2um(ms t0teermociydom r u slt) eur(r ou1op e fcslt) Drmx pnu4aex mfetyslmDua(mo;u)tltniocta1oaD  i slt0trur(r3io1omtn fvslsfs2uau oou0olx mfciltls2emnvp ()altnxo3iatomtelu i;( teur(opiu1aleelivta(fsruaur nu1olxomfeilt s rmu on(4tetoxr iytla rauei s0t2toio nu1lm nmiciatfaDrax o;u0tpeomi3iysfs2ua(mp t4tltrmocoo1lm eaies s) exmxrpnodll  mics s  Dururpot4tex mfeiysfs rluvp;t0trenifctatfpt ai s t seur(r no1ope mnesatfa2trxr no4tpxnif3iadlm2rlumo;(4 rxrxr ta1opD lnvil() 2trxr oudop emfeilt)sDurxrp;u1aex mfeiadla um(ms u4 lxrmrciadlmD  ueilt0s2uo(r ou1lp elivtls  rtau pot0opto i3ias a2ra(vo;u0 etoif3iydoaD aivs (0srxm(m3iudop e ictls)s2um( o;u4ale if3tydls umump u0trtoxr3iydopDr u ol(0s2umxo3ou1lme lnvsat)artauronu4oexnifcilt m2emums () exoxociodfm elneo s0teurxmpio1olen ivtas)sDtm(mooo1oexomf3ils s2uau p u)tltoifctatlatr ues ( truoio3iu4ol e fetatfa2tru ooo4tlx  f3iadfsDrl(vonu)tlxnifciatlpt  u ilt)s2tmio3ou4lle lfcil() rurx  ;u0tet ifetadfa ra(vont4 ltnxr tytlmDe nei s setoxm io4lp  mfvils  2ra(mpnt0apxoifciytfm el( p u) exnxf3oatla r n slt)srtrirpoy1omt mnesasfa2uru  ;o0tpen iciad m2rl(mp;u0arermf3oytla rlu il(  2xmxrpiu4lpeemivt () rrrxmonu1tpeomo3iytfs2rln o t4aetnxo oytfmDeauvs s0teur(r nodlmt lnvsa(fsDraxmpou0texnioeiyt s2rmnvo;(4arxoxr ia1opDean s t0teur(opiy4ope lfvt s  rum(rp;t1open f3ilsla eanvo;()altrifciodlat ln slt srxo(opno1omtnmiesat srtmx onu0ape  ieiatla2eln s t4 ltomr tydfmDr n ol( srxr(o oodomt livi ( s2um(mpou1aet ii3tadlaDrmuvs;(4 etnxociadla  au i;t trumiopnu4apte fvta()sDrmxm ;u1optnmoeilt aDua(vo u)aeenmrcio1opDeli o;t0t2urxo oo4om   ieil(f 2taxrpnt0apeo oeils m ea(vo t)aeerxociydlp rli o;t0 etmio iydopenlicias)s2umxm ou1opt  i3iltla ua(vpnt0trenio3oadfp  liei t s2xmxo iu1ape mnet (faDtaxroot4texn i3iltfs2rl(mpn(0trerxr3tatla rliei t s2trir3iodlltn ncils  rrru pnu0alx  ieiytfaDul(vo;u0 ltoxr oa1fat li s;s  exoimpiodlmtnlfesa(f Drr(moot1alxnmi3iyslsDrln p;()tleomo oatfm rlivo;(0 2toim io1aptnlictltfarrax  ;t0alt if3tydfs um(mpnu)aexrxo oytla eluei t0 etm(o no1ope  fct s)s2um(mp;o1tlx  feiatfmDuauvs ()tlermrctotomt  n i t0 2xrxo nydamenmieslt  2raum ou0opxoifciytfm ra(vsnt) lxoxfciytfm  liesls) eur(r3nu4aptn nci tf 2umxmp;u1apxoifctydlaDel(vonu4 reoir3to1oaDrauesls sexmxm io4omtn icta()artaur nt4olxnifeilt a elump;u4teenxrctytopteluvs;()trtoxo nu1opte nvias)s2umurooo1opeo o3tytla um( o;()aetrxrctydop eanesl( sexrxo3nu4lle  ietas) Drrx oou4apxoif3tytla2ul(msnu)arermfciatlpD livols)setrxm3io1openmncias a2rru pot1apenmoctad aDrlumonu4 etnxo3oatlp eanvo;t0s2uoio iy1am nlneil(fs2tmumonu4altn ieiltfmDuan o;u4tleoxfcto1lmtr ies;() eur(o oydll e nvtlt sDrr(mp;o4opx  oeiydla2ulnmp t0tlerio3ootfmDraueslt)teumir3oo4ol nmfciat s2ta(mp;o4olx mieiltlaDul( p t0 eenmfciatomtr ues ()seurxr3oo4amtnlivslt a2tr(rpno1tetnifciydfsDrluvs;(4texoio3tatfmtraivols)s2urxr ou1al  miviatfsrraxmoot0aeeo ieias sDelnvp;(4 lxnio ty1lptraivsl() 2trxm ou4al   nciat)sDrmuro;o1ole  oetad s um( p;t)aetnmo3oatfat  neo (0 2umxm3iydomtnmfeils aDtmxro;t4tleo o3tasla2rmumont0trtomr3oadopDe ieo;t0srxmiopio1lpt lfvsat)arurumo;t1alenifeildfmDem(mp u0 rermo ta1lmte n s t)s2toxo3io4lleemicta(  2uaurp;u4ale mfctltfa ulu p t) leoioctydlm  an o s0texm(mpoydol nmivi (fs2raxrp;t1alxoioctytls2ua( ont0 leoifcta1lmDraieilt s2xo(rpiu1lmtn ncia() Dra(rp;o0apxomfcild m elnvpnt4 lenxo3oadfa eluvi t t2xmxm3nydomen icta()srumxr ;o0apxo fetlsfmDelumsnt0 rtnmr3ia1lmDean sl(  exrxmpny1ol n ieslt  rtau onu1alxnif3ildls emuvont0aeenmfcoatfptr n s;(0s2xr(o3no4al elfvta()s2ururp;u0tleoiieilsfs emums;u4 etoio oydfaDr nes ( sruo(rpoy4lpenlnci s)srrauroou4olx ifctlslm2ea(mo t0 ltrxf3oodfa  anvslt0 etoio ny1lpt mnet t arumur ot0tpe miciytfsDrlnvpnu0aexoir3io1fate nvi;(0s2xoio3ny4al elivtatf 2ra(m nt4tptn ieilslm2rmnmo;t0aetrio iydfm e n il(0sexrim3no1omee iei ()sDumxr ou1opto ictlsfa2raump;(4trxomo3iytopD  nesls0 exmxmpiudam elncsl( s2rrxmp;u1tpenioctas sDul(ms;u0 ltnmf3ia1omte ieo ()t2tmxr iu4alt mfvt (f Duaurpnu1tet mi3iydls2umnms;u0 ltnmf iatfp rlieo t t2trxrpoy4optemicil( sDtrumpnt0oexoio3iyd a2em(vp ()arerio oadfaDe nvi s teuoxm3iu1op elictl() Dur(m no1aleo ictysfs2eanmpnt0tetnxfcoo1lp rau s;( setr(m3iodoptemivs s artr(  ;t1oeto ictydfm2eanvon()arxnmf todfaD  nvi;s  2xo(o3oodam   iet tf rtmuro;t0oexn fciydlmDul(msn(0trenxr3oatoatr nvsl(0s2tmimpiu4oltnmfet tfarrmurpno4ole moeiytlmDulu s (4treoxf3ia1op elues t seuo(mpiy1op n nciasf rtax oou1optn ictadlaDemu o ()texrifcoodfa e i ols0teumxm ny4lmte fci sf Dta( p;t0tltn i3ildla2rm(mo u0aetnxf tatlmte i sl(  2xm(mpio4ope lietat srra(r nu1teeo o3iydfmDra(vo t) etrif3tatopteli i;s) rtriopiodlmenlfesls)aruaurpot1aptnii3tlt m2eanmpn(0arermrcoy1fpDe nvs;( srto(mpoo1aleemnct ( sDurumono4tptoio3ild a2rauvp () eenxo3oytfa elnvi;t s2xrimpou1opeelneiasfa2rr(m ;o1tle ifcias m ea( pnt)aexomfciotfptr u o;()srtrir iu1ap   ivia(fa2taur nu0opt moctlsla2eau p;(0tetomf3to1omt lieo (0texm(m3ou1llenmfesat)s2rm(ronu1oltniociydlaDemuvo (4arerifciy1lp  lueol(0srxoio3ny1lm  lict ( aruru o;o4aex mf3iytlm2rlnvpnu) reomfcoytlmt anvi;() 2xoio iudal emfetat aDrru  oo4texo ociadlmDel( ont0tleoiocoo1fpDeauei;( s2uoxo3oy4am nmnvi sf Dtaxm nt4tex mieiytfa2ea(mp u4trxnxf iy1opt ln i;() 2toxo3iodap  licilsfs2rm(m nu4oetnifeiasfm2rluvo;(4 rxrir iydop   n ils0 2uoxrpnu4lmte nvs tfarrr(r ;t1tpe ifctldfa2ul( onu0 reoir ta1opt  u i s0 2trio no4lm nlnei s sDumur no1ope mocildfaDum( o;(0trtoio ootoat  nvs;(0s2tm(opou4lmtn ies sfa2umxmp;u1ole  oetldfm eluvp (4 rtoif io1lpt  ivi;t)texm(rpiy1apt mivslsfs2tm(r ;u0apto octyt sDulnmo;t0altrxr3tytfa eaivo t) ruoimpnu4al n neils aDurxmpot4ope mfeiat m2rmumpnu)artomf iatfm elnvs;()s2xmxopiodape  icsa() 2tru pou4teenmf3iys mDua( o t0trxoif oadlpDe u o;t s2xoiopiu1llt mfcilt sDrmu pno1aleomo3iatla emnms u4trtrxocio1op  aues s t2ur(opoo1omtnlfeias s2ua(r ;u0ole mfeiltlsDeaumsnt0aetnmf3to1fmteluei;s  rxrxm3nodll emieiatf rtr(mo;u1tpt iiciydfsDuln o;t0tetomr oa1faDr n s ( srtrxrpiydamtemfciat s2um( o;u1optoifeiys aDem(mo;t) leomf oydlptraies;t)texm(m oy4lmee fvs t aDumump;o1ale iieilsfm rlnmo;t0 rtrxrcoadlp eau ilt srumxm3iy1omee nci () Dtauro;t0ale iociysls ulump u)alxnmrcoy1fatelu s t0 2urxrpny1alt  nei t a2taumo;t1opx iieiyd mDrau o;u4tltnirctadop  an ols srxoxmpoudomenlictlt)a2ra(rpou4oet iieiyt s2ranmo t0altnif3iy1lmDr ueslt0t2tr(r iodlp  mfcias  rrrxmpoo4tlto i3tatfa2ra(vpnu0alxriociytfatr u o;(0trtm(mpnu4ol   ivil(  rrrurp;u1opeomieiydfa umnmo (0areoxocoydlate ies;(  eto(mpoydllt lneta( s2rmxmpnu4oleoio3ilsls rl(vo;() exnircootlmteli s s0 etm(opno4lmenmfcslt)a2rrump;u0oetomociysla elnvp u0aeeomo oodoa  lnvol()t2trimpnodol nlfet t  Dum(ro;o1tpxoii3iadls rmn o;t)trxrmr tytom   nvolt0 rtmxr no1om   fvilt)srtaxrpou0teenio3iytla2emnmp u0texrxf3iatfmt lieils srumxm3io1ale lfeslt aDraump;u4oltomieiltlaDumn o;t0 exrmocio1fmteauvol(0srtoirpoy1aleemnvsl() 2taurpnu0texn ociad s2ra(mon(0trxnifcoo1fmD livs s0s2xr(rpou1olt mnvslsfa2tm( p;o1tpxomieildfm2um(mont) etnif tatlpDr uei;t)trtoxm3oudapenmivs t  2tmu p;o1oee ifeild aDeaumpn()alermr todlp  livsl(  2uoxr nudom  mneias)a2rmxr nt4olx mfeilt s2rmu p (4 eeomo3iadomD lu sls) rxrim3iu1olt liet s) rumur oo1apxniietld mDraumpn(0teeoxr to1oaDrlivs;(0tetoim nu1lpee iesl(  2raumonu1apt  f3iatfs elumpnt0aexoxo3oy1omDeaies t sexm(opno1amtemiviltf rraumpnt1opxniieilt m2em( p;()texnmo3oa1fmtr nvs;t0 rum(r3iodaptnmivtas artr(rp;o0optniietatlmDemnmonu0tetoif iotlp  au o t teuriopoudalt  ivia()sruaumono1tle ifeilsls2uluvo;t0 reomo3tadlpt  nesl(0srxriopiu1lp  lietat) Durx ooo4texn feilt m2rln s;t) eermrcoa1lm  luvi t)seum(r3no4ll n nvil( srrmxmpoo4tpeoioeiltfsDua(vpn() exrxfcoadlptrai o;s) 2xmiopiu1llt mfei t  rta( pnt0olxo octysfa ra( p;(4artomfciytfmDrau il(0seumxrpnodoltnmfesa(fsDtaumo;o1tltomiciad mDrmu o;(0trerxrciytlmteaneil( setoxmpoo1amt  fvtls)s2rmxmpnu4opt moctas a2el( s;u0 eermrctotla elues (0sexmxo3nu1lp eliviat)sDraum nu0teeoio3iadlaDrlnmon(4 rermo totlat  uvo;t sruo(m oy4amenlfeiasfarrmxmp;u1tlx mo3tytfmDrl(mo u)aeermfciodl
\ No newline at end of file
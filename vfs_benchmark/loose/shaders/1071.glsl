@@ -0,0 +1 @@
+ueo;(0seurim ny4opt lnvs s sruaum ot0tpxnifciadfa2em( on()trtomr3oa1latean ols srtoxrpnu4ole mfvs t) rrmx oou1alx mietlsla ulums;u0alxnir oadlptr n o;( trtrxrpoudlleemnei t s2rmum oo4olen ietasfsDelnvsn(4artnxr3tatlm rluvslt0t2toxm3nydapeelnei tfsrtrumpot0tpxniieiydlm2el(vs;t0 rxnxf oodla  luvo t)sexr(opoo1alt  nvi s  Dta(mpoo0oexo fciytlm2emumon() lxrxo ia1opt luvolt setmim io1ap  lfci ()s2ua(  ot4tee mf3iasfsDrmnvsnt) eeomf todla  auvols) 2toirpiu1llee netasfs2ra(ro;t4opt  oeils a2rm( p () rxoif ty1fmDranvil(  etrxr ny1ap nlicils srta(rono4tlx mfeiad a rmnvonu4tlxniocoa1lmt ai i t)trtrio ou4omee feiltfs2rr(ro;u0aetomociatls2umn s;u0 lermrcoytlpt aues (0srtm(o oydopt lictas) rururo;t4oeeo oetasfa ua(vo u0 eeomf oa1oaD luvo t0 rumxr3iy1ame lneil(faDtmu pnt1oetomoeiasfa2eluvs ()aeeoif iatfp eln il() 2tmir ny1ale  ictatfarrm( pno1oexoiocilt aDelumsnt) eermfctatlm eai ilt0 rtmxm iudop nlies (fs2ra(mp;t1opxnio3tltls2uau s u4 ltrmf oy1fpDe i ol(  2toxm iu1omeemivt tfartm(m nt4alto i3iytla2ra( o ()tltomfcto1lmtelieils) eumxo oydlptemies ()srrr(m nt1alxomfeiytls2rau ont)aeenircoodlm  anvslt0srtrxo nodlmee fcils)aDum(mpnt4alt  fciys a2umumont0tlerxo tatfptrlnes s)setm(o nu1amenlivtlsfs2rmxmo;u4tleoiietatfmDem( pnu4altnmo3tadlp   ivilt  2to(mpoo1om e nci t srta(ronu0texn octytls2ranms t)teenif3oatomDe u o;t teumxr3iu1al  mfetl() 2tru  nu4tpeomfeiyt aDul( o (0arxnifcoa1om  lueo;s s2trxo3nydomtn ivsat srtauro;o4tetniicildlmDrlumpnt0trtnif tydopD aueolt0texoir iudapt  fetls arrau  oo4tpt  o3iyd aDumuvpnu)artoxr3oadopteaivols  2xo(mpnydlmen fci t  rtax ont0opto oetls s2elnvo;t0 exoxf3to1lmDeai s s)s2tm(r oy4omenmnvias  Dtru oot4tpeomoetys s2emu p t4 rxoir3oydfpt aues s  rum(m iu4ole lnct t aDua( pou0aexnmieildlmDua(vo;(0tetnxrctydlatr nei;t seurxm3iu4am   nvs t  Durumpnt1aet  icilsfm eln s;u0tltoxrctatomtraivils srurxo3oo1ole livs t) rrmu  ;t0olen oetls sDrmn p;u0aetoxo tytopDeau o;s0teurio nu1aptemnvi (fsDta(rpoo4apx ioetys s2rmnvpnu)trxnir3ta1op eai i;s s2xmxopiy4omenlici sfa2tru oou4opx  ociasfs eau o;(4 reomf3iy1omDe i il(  exoxr3no1ll nmietlt)s2tax oot1oetn o3iyd m rlu p t)artomo todoa r neolt trurio3no1omtelivtatf Dur(mooo0oet  oetltfa eauvp u0aexrxo3ootfa r nesl() 2xo(r ny1lpt lfctls s2rau poo4tltn i3tatls eln s t0arermf3oytlmt ln s;t) etm(m3nu1ll e netls sDta(r ;u4aexniiciad s eauvp;u4 lxnir oytfp  lnvs t t2ur(m3oy4om nmicsls  2rax pot0oeeomfeiydlm2eanvo (0tlxomo iodoaD  u olt s2tm(r3oo1om eliei s)srurxmono1oltnioeiyt sDrmump u0 etrxocoydlmtranei t t2tmim iu4ap n fvsasf rra(  ;t1tleo o3tys sDuauvp (0tetrif oy1opt aueo ( s2umir oy1lmtnmfcsasf 2tax p;o0oeen ocils a emu pn()arxrmf3oytfm eauvslt0t2uoio3ny4omt lfvs () 2urxm ;o4apenmfciyslaDea( s;u) leoifcoytfate n i;()sexoxrpiodopee ncsas artr(rpnu4apeoiieiasls2rl(vo ()aleoir tydfpDrlneo t srtrxopou4ol emnes s a2raxrpot0aee mfetat s ra(mo t)alxnir iatoaD  ivo;t0s2xm(opny4opt lnvias  rrm( p;o4tptniiciydls2em(msn()arxrmr3iadomD auvils  rxm(mpny4altemfet ( a2rm(mooo1ape  feildls em( o u0tetrir tytfa eluvs;t) 2xmxr3oodllen ivilsfaDra(rpno0tpxnmf3ilslmDra( sn(4aeeoir totfmD  uei;s  2toirpio1op emfes t)sDra(mont1aptn o3tys m eau s;(0tlxoircto1optrlivs (0trxoxr3io1omeemieia()srtmxr oo1aptnif3ilsls ranmsn()alxomr3iodoa elues s texo(r iy1ap n feilt srtrurono4ope  f3ildfs rluvp (0areomo3oatlaDran ols)s2tm(o3no4lm   ivi tfsDta(mpot0opeomf3iatfs rlnvs u4 lerir iy1fpDrau s (  rurio3nu1lp emiesl(f Dtm(r nu0tpe iictyt mDrm(vp (4teermfctatlmteanvilt setmxopiudome lieslsfs2rm(r ;t1tptoiictat mDea( s t4arenmf tytfmD luvols0seumimpoy1lptemnctl( artax poo0aleo fctatla2el(msn(0 rxnir3tadfptranvol() eumim3oy4ol  miet tfs2trxmo;o1apx mietyslsDeauvo;t0trxnmo3iatomtrln ols trtoxm nydam elnvtasfarua(rpnu1alen oeiatlm rmu o;t4trxnmocoy1la rln s;s0trur(o nydamenlfei (fa2raur no0oee ioeiat a2ua(vsnu) leoio3ia1fp rlnvs s teuoir3nu1ame  feia(fa2umxro;u1oetn fciytla2emumo;(4trxnmr3tytfmD an s;() rtoiopiy4opeelfvt s  rum(m ;o1oee  o3tad m uanvp;(0trxoxo oa1omD  iei s0trtrxm no1ale mfes t) Drmu  no0tlxnmieiat a2umn onu0tlenmf io1fa rliei;s0s2trxo iudlp elfes s  Dum( ooo0aex io3ilslm2ean p;t)texnxf iydoaD  nvo;s seur(r nudlltemneia() Dumxro;o1aetnmf3ildla2eln on(4 rerir iotfat  nvi (0teuoirpoo4lltnmfci ( s2raur ot0ale mictlsfa emuvp (4aexrxfcia1om e nesls s2um(rpiy4al e ivsat) rum(r ;o4olto i3iyt sDrl(ms (4aetomf3to1omD luvi;t0 2urim oy1ape  icils)arra( pou4opxn fetydlmDrluvs u4 eenmf ia1la elnes s tetrim ou1lltnlicslt aDtau o;u4alxomietydlm2ea(mpn(0aetoifciodoa eluvsl( t2uoio iu4lleemfvsat s2ra(  ;o4alxomoeiyd s ul(vs;t4aexoio tadfptrlneilt0texm(o ou1om n ivs s)srrax pno4tet  fciyslsDua(vp;t) lxniocia1faDeai il(  2xoio3iodap elncsas)srrmu poo0opxo oetld aDuaump;u4 rxomo3tadoatr u il( s2xo(m3ny1omeemieilt)a2umur ;t1oleo fetas s ulnvs;t0 eenxo3tadoate ivslt0texoim no4lpte iet tfartmxro;u1apx  f3ildfm2ulnmp t)aetrxrcia1fa  lueo;t0sexrxo oo4om nlnvsls sruaump;t0optoif3ilt a emn s u0teeniocty1om  lnvs;t0 exo(opno4lpe lnesl( s2ta(mp;t1aetomo3iatla2ea(mpnu)aeenmrcoo1fmt au i t0tetm(mpiydop   nct t)a2tmx ono1tpeomf3iydfa emnvo u0trtoir ia1fptraneil()setrxopoy4lp e fvt s aDtaxmo;o4tpe mfctat m ua(vsnu0arxomf todfptelivols)trtmir no4omt mfct s  Drruro;o0tex mo3iat aDelnvs (0 eerxfcoodopD an i s  etoim oydlpeelfvi () Drmurp;o1tltoio3ilslsDeanmonu0texrifctotlaDeaueslt0seumxo3oy4op  miesa( a2tmx  oo0oleniocilslmDemu p u4altnxf to1omtrlneols0 euo(r nudalte fcils)srua( o;u1tlxoiictas s2ulnms;() lxriocoatop  li i;s  exrir iy4lpen fesls a2tax  ou0aexomfeiysfs rm(vont)teeoioctatlat livi;( sexoir oydoptnmncils) 2umx poo4oeenmictat aDeanvs;u4altoxr3to1laDeluei;s0 etrim3oydameemivs s)arurumo;u1altomo3iasfmDua(vpnu)tlermrctadfa  aivsls s2um(r iy1ap nlictas srur(rpou0tlxn icild m emu o;u4 rerxrciydfpt liei s0tetmim3ou1amenlfcsasfsDua( pou1ole  fcildfa2umuvo (4 lxrif3iadfatrli o;(0trxm(r iodam nlfetl( artmxrp;o1olx iiciasla2uluvp;u4 leomf3to1lmDeaneo;s)srurir oodomtn nci t)srumxr no4optoiiciytfa ea(vp;t0treoifciytlpt lnes (  2uo(m ny4omt  nctl(f rraxmooo1opx mo3tadla2ran s;(4alermocoydom eaiei (0sexmir3nydap  mfvs sfarrr(r ;t1tlxnmieiyt m elu o u4arxnxo3ty1omt  ies s s2xmim oy1lm emfvia() rtrx pno1alenmo3ilt aDraumonu)texrmr3iatoptrlueils) 2xm(o io4apt lncta()s2uru  ;t4tleoiieiysfmDrluvo (4tlxrxfcoo1op  lues;s sruoxm3nodaltn nctatf rtaurpno4ope mfeiydlsDrlnms t0aetnmo io1lp rliei s  rxm(r oydapenlfcsas)aDtrxmono1apeoiietas mDem(msnt) exoxr3oatlptrln s t)t2xoir iy1lleemnvsl()sDumxrono4ale mfctatlm umu o;(4 eeoif ta1lp elues;t s2tm(mpoy1amtnmict t s2tmx pnt1teen i3iydfa raumonu0alerxrcty1omD an ils0 ruo(opoy4open ieslsfs2raxmono0altniiciltls ra( s t0tlermr oa1fm  ai ils0 2trio3io1ll   fvtat srum(ronu1tlx moeils aDuau o (0 lxrir3oo1om   nvs s  2uoxr nodomeemnctas sDtru ono1optnii3tlslm em(vpnt)artnir iotopDrau s;t trumxm3oudom  livtl(  rrrx p;u4ale mfctad s ulnvo;()arxoxocootoa e ues s0t2uoxmpiu1lptnlictat sDtmum ;o1alxoii3iys sDrluvsn(0tlxrioctydlaDr i o;()srtmxm ou1oltn fctl(fa2raxmpnu0aex ioetltlm ea(msn()alenxr oydop rlnvo;s)s2toxm3nu4al  lfcsas s2uaxrpoo1aee  oeiyt a2rmn p t0tlxrxo3iadla   nvs t0 2um(rpiudlm n fcias arta(rp;t4alxn ociatfa2ul(mp u0 ltoircoatoateau o;s)s2uoim iudom  mncs t  2urumo;u0tpenmoctys a uauvpn(0 rtnmr totopte ueo t  2urirpnu4alenmnvtl()srraurpnt0aetoioeiytfa2elnmpnu0aetnxr3ootfateln slt seumim3iu4opt  ivs sfsDtmum ;u4apt mocias mDeanms;u)arenmr3iytfmt  u ol(0teuoxo3iu4amtnlfci s)artax p;t4tleo o3tldlm um(ms (4 etrmoctatfmtrlnei t0 2ur(m iodlptemncta(f Drr(mp;u1optnif3iad a uln p t0tleoxf3io1faD anvo t0 2toir ou1lp nmiesl() 2umurpnu0aetoifciaslaDel(mpnt0 ltrxf oo1optelueilt0 2tmxr oydop n ieiat)srtaur ;t1tet moetatls2rlu o;t0aetrmr3oa1fpD li ol(0s2toxo3iy1op emfviat) Duaxmp;o4teeomf3tydlm2ul(von()alxoxo3oa1oa rauvilt)setr(opiy1lleelfet s)sDuaxr nu4tex mfcils mDuaump;(0 etrmfciadfaDraneolt) rxmirpoudll   nes sfartaur ou4tpx  o3tlsla2ranvs;()arenif3totfpDrln o s)s2urim3iu4olte iesa( arta(rp;o0oexomociad m ul(vonu0 lxnmocta1fmteaueo;()trum(rpnodoptnmfetas)srta( pou1aexnmociaslmDumn o;(4altomf tadoa e ueo s)trumim iy1omt  nviasf 2raxm ou1tpxo ociys a el(mo (4alxnxo iodfptrlivslt srto(r io4llenmnvsl()srta( p;t0tltnmietlslm2umnmp u0trerxf3oadlp   u o t trurxr iu4ameemfetl( a2ta(mono1optnmfciasfs rl(mo t4trenmrcoo1fpD aues;s)trxrir iu1oltemietatfaDrru pno4olt iieiltfmDran s t0artnmrcootoat  nvo s)trtrim3nu1apt  fct ()arraxmp;t0opt  fetyslmDumuvo u0aetnmf iadfmD an s s0trum(o nu4lpt mfetl()sDtaumpnt1aet mietld a rlnmont) exrxf iytlateluvslt)trtrxm iydlltnliviasfaDrm( pnu0olxo o3iysls ranvs u4 leoifciy1om r ivs s0 etrim3nu1lp emnesa()srurxm ;u4aetnif3iys m2eau o;u)trtrio oatlp r n sls)s2xr(r3nu4op n ncia()arraxrp;u0oeenifeiyd sDuau s t)aleoio iydopDrai o s0 2uoxrpnodlpeemieiatfsrumxmo;t4apxoiieiydlsDulu s (4trxomfciydoptr ivs;s s2uoio3iu4lpte icsl(fsDtr(r nu4oeeoif3tatfs uanmp t4 etoxr ia1fmD  nvi;t)sexo(m no4olt lfeil(fsrtm(r ou4opxnmi3iydfm2eauvp t) leriociadlpt aivilt0 rtr(m ny4lp nlfviatfa2rrxmpou0apen o3iytls rlnvo;(0aexrir totlmD  u s;(0trxoxopio1am   ivsltf Dururpno4olxn icild a ra( s;t)artoio3ta1opD anei t)seur(opiudam   fcs (f Duax p;t4tle  feiyd a uauvp (0 rxnmociy1laDe n o t0s2uoir oudameemieilt)aDumxmpnu0apt mo3tytls rmnmo;(4trenio3to1om eanvsls0 ruoxr3iudlp nmfesltfsDtaurp;u4apen ieils s rlnms;t4tetnxrciodfa elueols)s2trim3ny1amteliei s srrax oou0tetoiiciyt a2uaumo;u4tlermociy1fpD aies t)srxo(m3oy1optnmiei s arrm( p;o4oee ii3iatlsDranmonu0arxnirciotoptr u i;t0 2uo(opoudal elnvs t  2um( o;u0aee  o3tat s rauvo;u4 rxoifcoodopDr uvs ( trtrxo no1al emiet t artm( pou1olx iicils s ul( snt) etrif3oy1lptrln i;t s2toim3iodomt mfet s s2ua(mp;o4opxomoetat aDelumpnu0tetomf3ty1omtr nei;s teumxmpiudllenmiei ()arumxrp;t4oeto f3iadfs2ulnmo t)trtnxr ootfaD luei;s s2trxmpno4llen fesa(fa2tru oot0oet ii3iasfsDelnvonu) leomrciy1oaDeaieo s)t2xoxr3oy1lltnmnes t) Dur( ont0apto ociysfaDrl(mo;()aeerif3todoat  ieo;s0 rxoio ou1alt livsat)sDta(rpot1aee ioeiydfmDrauvpnt)tlxrio3tytom  luei t t2trxr3oo1lme livsa(f rum(mont0aptoioctadlsDumn s;u4trtrmocootopt  nei ()teurim3nodam   fvta() rur(moou4tetomoetat aDumnms t0tlxrxf3to1la  an il(0srtoxr io1altemnes (  ruaxr nt1optn o3tlsfa2ul(vo (0arxrmr3iatlpDr ieo t0s2xoim io4omenmfesa()srrmx pou0oexomfeiltlm rmnvp;t4 exomfciy1opDrlu ol(0tetrxo3nudoltemieilt)artaxmoou1apt mo3iadfm rm(mo () rxoio oo1fpte neslt srurxo oy4omtnmivtasf Drrx  nu0aetomfetltfaDuan pnt4tlenmr iotla  au i ( teto(o no1olen nctl( aDrrurpoo4aptomfeiatfs2umn s;u4tlxoif3io1faDrlnvil(0truo(o ny4omt mici s)srtr(ro;t0aptniieilsfa elump;(0 exrirciatomD auvi;s) exm(r ny1al nmfvt t)sDraxmo;o1opt mfciat a emnvs t4 eerir iatlmD anes t)setmimpny4aptnmnvilt  Draumo;u0oeenio3tlt a2rlu snt)arermr3iatlatrlnvs ( trum(m oo1lpen fet t)sDraxrpnu1tpe mfeildlm rlu o;(0 lxoir iadopt livs s)texoimpnudlmee ietasfaDumx  oo4oleoif3tadlaDuan o (0arxrxo3iotomt  i olt)t2xm(mpno4apen ivils)s2rmxrpnt0oexoifctls mDrmnvp t4 lenio tydfp r uvs;s  2umir oo4amtnlnvt ( a2um(rp;t0tex miciatls2ra(vs;(0arerxf ia1laD li i t  rumxr iy4alt mfeiat) rum(mpot4apx mfcildls2rlu pnu)tlxnio iytomtrlnes;t) exrxopnu4lp nlfcsa(fa2trxm nt4texnio3tys m eluvpnt0texrxrctytoaD anei ( srurxr no1optelfvil( sDurumpno4oee iietlslaDem( o;t)teenmf3iotlaDeaies t0s2trimpnudoptnlfvias sDtrx  ;t4apxn ieils m rluvs (4tlxoif3to1fatelueo t)trtmxr nu4apenmfvsls)sDuau  no0ape mietlt m el(mon()tltnxf iotom   nvo;()trxmxr3iydlp   nci (f rrm(m ;o4aee io3tat sDua( p;u4trenir3iytfm rluvilt)texm(o oudomenlivt t  2raurp;t0teeoiocilsls uln p (0 etoircoydoa e nei;(  2xmxo ou4op nmfcslsfa2uru o;u4aeeomfciad a um(vo u4aetoxrctodfmDrai sl()teur(m3io1amtemfet t)aDta(m ;t1alenmo3iydlm uanmp;t0trtoio oy1lpt aivo;s)t2umxo3iydome micil( s2tr( p;o1apeomfetls mDumnvsn()altomociatfmtrauvs;t  etoxrpio4apeelncsl()sDtm( p;t1tlxnmociadlaDuaumpnu0arxomociytomtrlivsls)t2trxo3nu1omtn ivil( sDraxrono1oltoiociadfsDemnvo;u) lenio io1lp   n i s)texmim oy4oleemictlsfa2ra(monu0aetomiciadfmDuluvonu)tlxnif iotoateai s;s0 2xrxo3ny4om  livilt) rtmumpno4opxn f3iytfm2um(ms t0aeeomo to1lm  lnvo;() 2xrir nu4lm  mnciat  Drru poo0tlxo oeiytla emums;t4tltrxrctydfpD  uvil()teto(opoy1lpe mncil() Drm(rpnt1altoiictys sDemumsn()aexnio3ootlaD  ueo;t)t2tmxmpnydlle  fei s arumu poo0olx  f3iadfsDrmn onu0 lenxfcta1fpD aivi;s0t2tmxo iy1ap emnctat)artmu  ;t1tlenmociat sDrmumpnu4alxnmf3oytlmD ln i;()t2ur(opoo1openliesls  2taxmpou0tlt iicild a2rluvo;()aetnmr3ta1oatr nes s)tetmirpou1ale  fvtlt  rua(mono0ape moetld mDrlnvo u)trtrmo3totoaD ln i s  2xr(mpoydol n ivtas a2tmxront1alt  o3iysla uauvpnt) rtrmr3iy1fm   n ols t2urxr3ou1lpe micta(f ruax  oo1aetoif3iatlm rm( snt0trenirciydoat livs t)s2uo(rpoodlm   nvilt sDtau  ou4opxnmociys m ulump;(4tlxrmo tatfa  auei;s texoxr oodape livils aDtr( oot4tee  f3iatfsDeanmp;(4arxniocoytop eluvi;s)t2tm(rpny1al   ivs t) rtm(r no0alen ociatfm2ra(mp;()aetnxocia1la r nvolt  rurim io1ll   iei t)a2tmx pno1tlxn oetls mDuauvpnt4trenmf to1fm elieo;s t2toxo3iy4llte nct s arumur ou1oetoif3iatls2rm(mo;()aexnmrctatfa  anvolt)setrxr ou1altn nvt t)aDrrur ;t1opeo fcilsls2rmnvs;u4teeomociydfa   ivo (0 exoxr3oydole  nci t)s2ur(rono0tleniicilsfa2eanvo (0aexrxo3tadla eaneolt0trxoir3ny4ame mivilt)s2trx o;o0aeto oetlt a2uanmsn()trxrif tytfm e uvo s  rurio iy4lp elnciat sDraxmpot0tee if3tyd sDrlnvo ()alxoxr oytfpDeln ils) 2xm(m3io4alteliei t aDrruroou4oltnif3iasla rmump;() etrxr iytfmte n i t s2urim no4lmtemict ()a2raump;u1apxnmfctadlsDeauvp;(4 rtoxr to1fp  ai s;(0teuoimpno4lm  mivilt)aDrmxm nt0oet mo3iad m2um(vsn(4tetoxfcoydlp  lu s;t) 2xoxr ou1ol emietls)arrmxro;u4tleo iciatls2rm( pn(4arxomr3oatlm e ivsl(  ruoirpoo1olteliesatfsrua( o;o0tptnmicilt m umuvsnt4artrir ta1lpDeaueo;(  rtoxm3oy1lme micsas aDtm( pou4tee mo3iyd mDrmn o;u)alxnxf to1laDraivols0 eurio3oydopenlnes t  Dtmxmoot4aee  ieildlm ra( onu0alenxf iytla e i s;t)sexoir3oo4om e fci t)sDtau onu4apxo ieias a2rmnmpnu0 eenio3oodlat  n sl()truoir3iodop elies (  rrmu o;o4optnmoetadfm2ea(vp t0treoxfcootom eanes;s0sruo(r3nu1opeelivilt) rrrumo;t4optnmfctltfm emnvpn(4trtrmfcty1op raivol() exmxm3iudom emfetat) ruaurpnu1ole mictad s2rlump t)tltoxociytfm eai s s0 rtrirpoydllt lfviat) Dtr(rp;o4apxnioetldfs2ul( snu4aetnif3tatlatran s;t seum(r3ou1lp e fes t a2trx ont1oet  o3ildfa2uanvp (4aetnmo3oadomt  n olt)srtmir3iudolte ivsa( s2tr(r ;t1oltomoetls m2ulu p;u0trerif iadom  anvi () rtm(mpoodlpt  fvilsfaDraumooo0oex  oetyd m em(vp;(0tetoir3iadopDraivi;t)t2tm(m3iy4al e nvsl()artrxro;u1tpeo f3ilt m2rm(ms;(4trermr3iadlpD  ueo s0 rto(o oudopenlicsasf Dtmur nu4altoifctatla2umu s;(4alenxo3oo1laDranvols  etm(r oydoltnlfvt sf 2rm( p;u4opx  fetasls2ulnvp;()tltnxo3tytlaDrauei;t) exmxr io4ol e fcslt srra(mo;t0olxomoetasfm ulumo;u0 rxnxo todoaDeauei;(  exoxm nu1op emfvtls)srumumpou0ape iietysfm2ua( o;u0 rerxo iy1optranvol(0trumirpiy4apte fcsa()sDumuront1tltomo3tasfaDranmo;u0 etnxo oodomtrluvi;s)trxo(m3ou4oltnmfcilsf rrrxmooo1alt  oeiasfsDum( s ()tltrxocty1lat  nvs t0 2toxopoydlpte fciat srrm( pnt0aleomf3iyt a2ea( pnu)artoif iy1fa   ivo;s sexoxrpny1ape  fcsls artru o;o1ape mi3iydlaDrl(ms (0teeomrctytopD au i;t0 etrio no4aleemfcs tfa2rmurp;o0altnmo3tas a2rmuvp;t4trerif ootlatran il(  rumxo ny4al n ncsa()aDta(mpnt0ope  ocild m2emn on(4 eeoio io1fpDeau sl(  rumimpny4lp elfvsl()sruaurpnt1optoio3iadlsDemnvon(0aetniocootlmtr n s (0s2tr(o3nodlm emiesl() 2uaumont0opx iociyt m2el(msnu)alxrir3oodlmDelnvs;t0t2xo(r3iy4ape livia( s2tmx pnu4teenifciydfa uauvp;u)altnxr iatfpt luvols srxrxr nydom nlfcsat) Dtmxront4tltniocilsfa2rl( p t4tltnmo3io1opDeanesl(0trxo(opiodlmte nviasfsrtr(root0ape  feiatfa2em( p;t4areoxo3tadlptelnes t)s2xoxrpiy1om elfvslsf rumu oot1tptn feild s ean ont0altrifctytoa elu ilt trtm(o oo1ame miciasfaruaum ot1aee mociaslmDrmnmo (0aexrmr iodopDr uvo (0t2xoim nodolt mneslt sDtaumpou1opxnifetyt sDelumo ()aleomr3iydfptr uei t0seum(opoo4lmen fvtls sDua(mp;u1texo iciasls rmnmp;t4artoiociotfa raivi;t)t2xrim no4alt miesa(  Dur(  ou1alt iicilt aDem(mo;t)areoxr iydlaDelneo s trtmxo3iodalenmnvt tfs2tau  nt1tee iictasfmDeau pnu0tetoxfcoatlmDrluvo;( srxo(o oo1lm elneiasf rurxro;o1alxomoetld mDeanvon() lxrxf3ty1oa eaieilt0srtoxo3oudamt  fci tf Drmx p;t0apeoioeiadfaDrl(ms;t0artrmrcoodom   nvolt0s2um(o3ou4alt licta(faDrm(r ot4aptn iciat m um(vo;(0artoxr3tytlmtrlnes;s0 eum(rpiydlpeelivs tfsDumxmo;o0apxn ieiydfaDua( p t)alenmr3oytfpt ln sls)srtmio3iydomt  ncsls) rurxrpnu4altoii3iyslsDemumon()arxnif3iadom rlivo t)t2xrio nudomt  ictat)s2taxrp;u1tetn ieiad aDrlnmo;(0arxoxociydomDe uvolt0t2tr(m ou1ape lies s s2tmxrp;o1apt  i3iaslsDel(mpn() lxrxrciy1laD lieil() rurxo oodop   fvia( artaurpnt4aet miciltlmDrmu snt0 rtomr oodla rai il(0srtrxm3no1ope mncsl(  rrrurpnt4oex ioeiyt m emnmp ()texnmo oytfpDrlivsl(  etoxopnu1ol n ieiatfa2rmxrooo4aetnmictlsfa emumpnu4tlxrir3ty1lptr uvsl( seumiopnydaptelivtltf 2tmu pot4oexoifetytfs2umumo;(4trtomf3oydom e i ilt0srum(rpiy1opt lnetlt)a2uaurpnu0alen o3iltls ra( o;u0tltniocta1lmtean ol( s2urxo3iy1alenmfvtas aDrrxmpno1tpeo o3iysfs rlnmsnu4 exrirciadlp   nes;t0trxm(mpiydlle mfei ()a2trxm ;t1aleo f3ilsls eau s;()arermr oydfmt aieil()trxoxo3io4amenlnvtat s2tm( ont1oetomoeildla em(mo t0tlenxr oodop eli ilt)sruoio io4ll elfvias)artmxmoou1apxomocildfa umu p u4teenifctytomDrln o (0 eumirpiodlltn fet t sDrmx  ;u1tlxnmocils a emnmon(0trtrifcoa1oaDeliei;(0s2xoxr iu4llt mfvsas)srrrx p;o0aeeomi3iatfa2ul(mp;(4arenifcta1fmteauvilt0texo(o3ou1ale lfctas) 2rmxm ot4openioeiytfm2em(vp;(0arermo3oo1fm eln s s texm(rpnydope lnvtasfa2tmxm ot1olto ictaslaDrauvo;t4 ltnif3ia1fptr u o;s teur(m3iu4llenliet tfs2uru ooo1ope mfciltfm ea(vs;u4aexrmf3ia1omDe uei () exmirpoodolt lnvi t  Dta(rpnu1oexo ietldfm rlu s t4teenio iatfpDr nei (0srumxmpiudlmtnmivsl(  2urxr no0alxo oeiysfm2um( s u4 rerio ty1laDrlivi;s0t2xm(o ou1ol   fcsa(  2rmxr no0tetnmi3iydfmDul(mp;()tltnxr3ia1om   nvi s0seumim3nu1al nlfvsl(fa2rr(mp;u0aet mi3iydfs2rau pn(4trtoir oadopD liei;s0srxmxr oy4apt lfctl()a2rax pou1opeoiictas mDranmp t)artomrctotoaD ln ils  etm(o oodap  lictlt)s2rr(rpnu4opt iietys s2rm(vp (4 rtnmocoadfpteaneils0s2xm(opoo1ome lieta(fa2rrx ooo1apxoioetadfaDrm(vont0 leoxf ootlpt anvi ()srtm(r nydlmenlfei tfarururo;t1alxnmoeiatlm ulnms (0tltnxr3ootoatr uvo;() exoimpiy4al n iei tfarrrxronu0tpto fetasfmDrmu sn(0treomr todomDelieo;s0trum(o3oydomt mfeiltf 2trx poo0tpxo ociad m emuvs;()areoir3totoptr u s;( sexrir iudam nmnvtasfa2rmuro;t0apxn oeiysfm rauvon(4tetrmo3ootopDr nei (  2um(mpio4opeelfet (fsrtm( pnt4tltnii3tlsfs2el(vs u0trxrxo3oy1fp elu il(0 2xo(rpnu4opt  iesat)aDum(root0alxnifeiyd sDuanvsn(0aexomr iatfm r iei;t)truoxmpny1ape  nvt t  rraxmo;t0apxoifetydls uau p;t0trtrxr oytfm  lieolt sexm(rpio1lmtemnct ()a2trxm oo4apx iietat a ulumont)tlxomfciy1opDr i i (0srtmxmpoo4optnlivsa(fs2ua(  nu4tptoif3ild a rlnvs;t4 ltnmr3to1fmDraneo;s trtrimpiu1lptnlneiltf rraxm ou1apxo i3iasla2eauvp;u0 exoircoa1oaDeanei s0srxm(rpno4lptnmncsat)s2uax  ;o0aet ifeiatlaDrmu p;t0tltnxf iadlmDr uei () 2trim io4lle mnvs tfaDrmxmpnu0opeo ociad a2eluvpnt0 rxrmo3oo1fm elnvi s)seum(m nydlpeemivi sfsrtrx  nt0opx iieils aDuanms u4teenircoydomDeanesls)t2uo(m3iydole mfctlt) 2rmu  ;o0alt  i3iatfm2ea(mp;() leoif io1lpt an olt)trurxmpiu1opt  iet t) 2truro;u0opxoiociyd sDumu o u0arxnifcty1op r nvils)s2tmirpny4ape lici t)srra(rpnt1tpenioeiatlaDemuvo;u0 etrir3iadfm   u s;s t2xr(mpno4lp nmiesl( s2urx pot4aexo oetad a2emuvp;(4 exoio oo1fmt aues;( teuriopio4omee fet (faDrauronu1aetniiciysla rmumonu) lerxo3totlm elnvo;t0trxmxm iy1amt mnvs s  2trx p;o4apx ifeiad m2eauvo u0 rxoif3oa1lpDelu olt0s2xoxmpoo1lpe  fvt tfaDtau ono1alt iictyt m2rm(ms t4aetnmocootlaD  ieo;s0s2uo(m iodam e icils)s2tax ooo0tet mi3tlsfmDuaumpn(0 lxrmr oy1lmD  uvs ()srtmio oudamtnmfvi t  rururo;u0tlx  o3ild mDumu s t)tltnxfciydoaDeli i;s)texmxm oy4aptemfet sfaDtm(rpno4apenif3tat s2eln p;(0tlermfcio1omt livi t0seumxm iudomtnlfct t) Dtaump;t1texnmoeiat s ea(vsnu4aexrxr3totlm  livolt)trxoxm oudll  mivslt  Drrxro;u0altoio3iys m2eauvs u)arxrio3oa1om elnvi ()t2xrxo3iudop nmfvta(fsDumxmpno0optomieiadla eau pnu4aeeomf3ta1lmDelieils tetm(o nudlm e ictl(  Drrur ou0tleomfciltfa2rluvs;t4 etrxo iy1omteaueo s)s2xoiopio1apeelies (  2umxmpot4tee  ieiys a2umumon(0trxoxf ia1latraneslt0s2xrim3oydome  nvta(  Dum( pno1tptomfetltfm2eaumo u0tltnif3iytfa ranvi (0s2umxrpnydomtnlfeilt)a2uru ont1olxomfeiysfmDea(vont0areniocoadfp  ai o;t0trxrirpiudap n fvia(fsrrru  ;t4tltniietasfsDuanvo t4altnxocia1fp eanvs s) 2uoio3iy1optnlfetl(fa2uaxrpoo0olenio3iltlsDuanms t)tlxomfciodfp rauvo () rxmim iy1lleemictltfarua( oou4olxnmieild m emuvs t)tltoircootla  aues;t0seurim nu1lptemfvt s) rraur ou1tlxnifeiatla rmump;u4tlxoxoctatlatrlu s;s0 2trirpoodamtnlfvias)a2tau ooo0aeeoiieiad m rl(mp (4aetrir iotfp elu s (0sruoir io4amtnlncil()sDta(r ;t0tlxo f3tadlm2ul( pnt)tltomr ia1fmDr nvi;()srtoxmpio1llen ieils  Duaurpno4tptniictlt sDelump t0arerxfciatlmtrauvs;(0tetoirpiy4omenmicta(  rra(mpot1oexn i3tas mDumumsnu) etnxf3oatopt  n sl(  2tmxr no1ol nlnvil() 2uaumoot4teenioetys s ul(monu0arxrxf3totopDe ueol( srumxo iu1ome  nctatfaDur(rpnt0tlxo feiysls rlumpn(4 eenxfciodfm rli s t)srxr(rpiodlle lfei ( sDrrx p;u4oeeomf3tydlm2rluvon(0tltrxo3tytoaDrlnvi s truoio iodal  mfvil()sDua( ooo4aee  feiys s ua(mpn(4trtnxfcoydlmt  ues t)srurxopio1oltn fct s s2uax  ot1ale ii3tadfs umnvp;t)treoir3oy1fat aueol(0seurimpny4ll n fcilt s2umum no0tetomf3ias a rmnms;t)arxrif3tydlp   i i ( t2xrxr3no1ll  lfeslt)srrm(  no1ope mo3tadls2rauvs () eerxocootlm eauesl()t2toxm iydoleemiet ( a2ta( oou0aleo oeias a2ea(mo;t) etnmfcoa1oatrlues ( tetrimpoy4omt lieiat) Dtr(m ;t1optnmociltfm2umuvsn(0 ltrmr tydlmteli o (0 2umxr iy4ope mfvta()sDraxm ot1apxomiciyd sDranvsnt) lerxocto1omtrli olt0trxm(m iodamte net tfsDumxmooo1tpeomf3tydlm um( on(0trxnif ty1faD li s;s s2xo(rpoo1al nlfes t)aDraur no0tet ioctytls rl(vp;() lxnif oydoaDrli s t)srtoio3oydop   feiat)s2uaxmpno4openioctysfmDeanmo;(0arxoirciy1lptr u i;()trumxo iodlmt mivsa( s2raurono1tee  o3tyd mDuluvo t0aeeoxfcoytlmD  u sls  2xrxrpiy4lpeelivtl(  Dumum ;o1aet mieilsfmDranvsnt0teeoirctydopDrliesl( teum(m no4lltnmieias) rum( oot4tpenmoetyd a2umn pnu4texnxfcto1op eluei t) rxoxr iu1altnmicsatfsrumuro;t0tptn ociyd a emnvont4trtomfciy1op  au sl()t2xrxm nu4ome lfvs s)artmx  ;o1apx ioeiytfs ra( pn() eermo oy1faDrlnvo (  2toxr3io1amenmnctatfaDra(monu1teen fciyt aDrlnvs u)texnxf3ty1la elueo t  exr(o3oy1lpee fviat)aDraxm ou1aeeo o3tysfa rlump;(0 rxrxrcty1opDranvi;t0srxr(rpiudlpee fvil(faDua(mpno0optnifetat aDrl(vs (4trtoifciotlm   uvo t trur(m3ny1omt lfvi () rumu pno0tptn i3iyt aDumnvs;u0trtomfctatfpt  u i t  rurxr3nudlp   icil()aDta(mpnt4alxomi3tydfs2umnms;u)tltnmo oa1fm elneolt) 2trxrpou4ap  livtl(f Dtaum ;u1tlto f3iytfs ulu s u) rxoiocio1oaDelivols) rtr(mpoudalenlivsat)aDra(ro;u1alxoiietadfs2rmn s u4 exrif3ia1omDeaneo;t)t2xm(r iodaptemiet sfaruru pno4aeen i3iltlm el( o;u4trenif3iytfpt  nvs s srtoxr3nudamt liesa(faruaxmpnu4oleniictls s2emnmsnu0aleoif3ia1lmDelnvi;s0s2umxm nodom nmiviltfsrtmx o;u0oetn ieiaslaDrmn pnt)trtomo3totlaDeluvsls)texrirpoodaltnlietasf 2raxmooo0optniiciytfm eanvpn(0tlxnif iotoatr u o () rxo(rpnudlle lfvtlsfa2ur( pou0aptnmi3tld sDum(vs;u4 rxrxf iadfmteli olt srxr(o oudameemfeta(fsDumxrp;t1aexnifeiad a umuvo;t4 etrxo iy1opD  iei;t s2toxr3iu4oleemnci sfarrrxroou0alt mi3ilt aDum(vont)trerio io1la   i s;s s2urxo iy1olt  nct sf 2urxmpnu4tltn f3tlt m2ul(vont0aetrxfcio1omDe nvs;() etrxopou4ame  icsas) rtm(rpnt4ope iocilslm2rau onu)texrxf ia1lmD  ieslt)trxriopiydomen ictlt aDur(m ot4tpt if3iadlmDelnmo ()trtnmo3tydoat auei s teurimpio1lpt lfes (fsDumxrpno1tpt mieiaslm2rm(mo;t4altoxf3oo1lm rluvils) rxrxrpiudop nmnvtl( sDur(r ;u0aexo ieilsfsDra( o;t)texrmo3ty1lpDe i o s0sexo(opiudolenmfes t)srrmxmooo4tlt iiciadls2emn s;()aexoxr iydfpD li ilt0t2urirpny4apte ivi (  2tauro;o1oltniieiadfa2ra(vp;u4tlxomf3iytlp rlivils)t2xm(m3oo1omte fciatf rrm(monu4ope  ictlt m rlnvpnu0alxoxo3todfaDe ivols)texmir3ou4optemfvslt) Dtrxm nu4tptnmf3iat a2em( ont0arxnxfciodlmt auvi;(0srxrir oo4lm elivi sfsrtaxmonu4tlen iciltlm ul(mo t4 ltoxf ta1la e i olt) 2xo(o io4open fciat) Dtrurpoo0oexomf3tas m2eanvo t)tetnir3tatlmtr n s;t  2xrir3nudameemivilt)s2taumpnu0tpeomfeiyslaDuauvont)arenmrciotlm r nvilt0 2tmiopno1oleelnvia( srtm(moou4oleoioetadfm ran o;(4trxrxf ta1om eln s (0 2umir ny4open fciltfa2umxrpoo0tet  f3iltfa2ulnmp t)aetoir ta1la ean s ()trxm(o3no4amtnlfvi (fartaxrpnt0alenmfeiatfs2ean snu4 lxomocta1omDrli s s)sexm(rpnodope mivil()aDtaxr no0texoifciys a uau p;u0trxoifcta1oa eluvils)truoir ou4am n nvia(fsDuax p;o1olenmictadfm umnmp;(4aleoxo ty1oaDeau o;(0 exoxmpnydamee nesa() 2tm(mpnt1aetn oetldfaDean on(0areomrctatlmDelies t)seurio3iy4omt lfvi t)s2rau  nt0tetn i3iyd s2rl(ms;u4tlxoxfcoodoa  ln ols0s2uoir3iydoltelneilsf 2ta(ro;t0tlenmieild s2uauvs;u4trxnmf3totlp eauei;() rurir iydoptemnvs (fsrra( oou0oltnmicilsla umumo u)trerifciodlm  auvs;t  2toxopio4optelivsat arumx pou0aetnmoctydfs rlnmp (0 exnirciydop e n i;s  2xmir ny1alenmnetl()sDrau pnt4aeen f3iatfa2um( pnu) rtnircoydoptrauvi t  exm(r ny1lltn netat)artrxroot4optniieiaslm2umums t4 exoxo3iodfp  aivols setmio3ny1omtemieta(  2uaxrpot1tpen ictldla rluvont0trxnmf iotfmteau slt0 eurxmpoudlle lfvtl() rrrx  no0tet ifciltlaDrl(vp;u)aexnxoctytoa elieols)tetr(m iy4op nmnvt s  rtmxmpnu1ape micild m ea(von()tlxomrcoatom  anei s  exoio oudape mfei (fa2uaur ot0alto f3tadlmDua(mo (0aetrio3iatfmDrlnvil(0 2toio3nydlpeelicsa() 2ra( pno0tpxnmo3iyd s2el(vo;() leoxo3tadoaDranes t)srum(o no4lmt lncsl() Duau pnt4oet ii3iysfm2el( o (4alerif iydoa raneo s) 2tmir3ny4am nmivtat) Dum(r nt1tpxnifetas m um(vsnt4tleomf3to1fatr i o t tetmir3iydap eliesa(  Dtr(m ;u4alto feiasla2rmn o (4aexriocootfptelu o;t0seurxm3iudomt mnvt t artmxmpoo1aeen oetlt aDua( p u4trtrio oatoaD au ols0 exo(o oy1lm  miet tfaDrmu  ;u1aet mieildfsDeanvo;(0trtrif3iydfaDrln i;()s2xr(o3nodlme mivi t)aDtaxm ;u1oexn i3tlsfmDrmnmo;u4tlxnmr3to1lpt li ols) rxmxrpny1ale mfvsl(faDraxrooo4aptnii3iadfa emu pnu0 exniocia1lpt an il()s2uo(m oudop emnvsls aruau  ou1tltn o3iyd m rauvo;t0artoxf iodlpte uvi;s  2trim nu4lmtelncil()arum(ro;o4tlto octas s rlums t0 eerxf oo1lpDrlu s;t)s2tr(m3iodol   nes t  2tm(r oo1aexn octysfm umn o;u4teerxf3to1oatr u i;s0 2xmxo3ny4ape livi sf 2rmxrp;o1apt  icilt sDemn o;u4 eenxfctydfa r u i;s  rtmxo iodoltnmfeias)aDumumonu0apeo feilsfm elnmsnu4aexnif totlmtranvs t t2xoirpnydole  fcs tf 2ta(moou4aetn fciyt a ranvp u0 lxrmf io1fa  aues ()s2ur(mpio1lltnlncsat  2urxr ;o0olx ioeiatfs rmumont0arxrmociydlaDr iei;(  ruo(r3nu4apenlies ()sDtau o;t1ape mfetadlsDeanvpn()aetoio iy1fa ranes t)s2tmxm no4apte net s  2ua(m nt1tex  f3tls aDrlnvs;u4teeoircio1oatrlueo;() 2trxrpoy4omtelieils)a2um(mp;t4teeoioeiytfm2ra(vpnt4aexoxrcoadoaDe nvo;s0srumxm3oy4lptn ivt (f 2rr(rp;u0tpenmf3iatfa2eaums u) reoxr3iatfa ean s;s)setoxrpoo4openlfctlsf Dtau  nt0openiiciytlm em(mo (0aexoxo3ia1lmD ln s s0 rtrxopiy1lleemneta( srtrxro;u4optnmoeiys sDelu s;t) leomrcio1lmDr u o;( seuo(m3no1ap e iesa()artrurpou0oeeniociytfs ra( p;(0treoxfcoa1fa e ueol(0 2xoimpnu4lpte fes sf 2rr(monu4apenioetatfa emnvp t0 lenifciodoatran ilt s2urxmpiy4op elnvsls arrmump;t0tptniieilt m el(mo;() eeomfcoydfateanvs ()teto(m3no4ol n nesa()arraxmpnu4apxomoetatlsDrm(ms ()texrirctotopte n slt  rxmim iu4ap  mneilt) Drmxmo;u0oeto ictadfs raums;u)tltnxf3oa1latrau o ()srxmir3oudomtnlnctas s2tmu p;o0tpt  icilsfs uau s;u0tleoxf3todlaDraivo;s0t2xmir3iydoptelfvtat  rtmx o;u1tpt ioctltlsDum( ont)altrxo3iy1lateanvolt) eumxrpoo4ll elicil(fa2uaxmpno1oetnif3ilsfs2rlu o t)tetrmr3oodoaDeaies;()trumir3oy4lmt lncil() Dumu  nt4tlx io3iysla2rmnvp (0 leniociadlmDr uvsls)texoxrpny4amtelicsl( arrr( ont0oleomi3iysfaDeau s;u4tlxrifcio1oa  livi t trto(o3oo4oleelfeiat artmxroou0apx ifeiatlm2ean s u)tltnif ootlmDe ivolt0srxm(opnodlpee ivtatf 2raxmpou4tltoioeiatlaDua(vo;u4aeeomociy1omD luvs;(0 etrir nu4lpeemfvt s  2ur( pou0aet  oetysfm rm(vp;t)trxoxfcty1lpDeln o t0t2toim3iudoltnmictlt)s2ra( pot1alxoifctltlmDemuvp t)tltoxfcoodlaD luvs;t)texoirpio1optnmiviat  2ra(ronu4aleniietlslmDeln ont0 etoirciydoa  aneo;s0s2tm(m oydape  fes ( a2tm(mooo0tpenmi3iltla ulumpn() eeoiociy1opDe ueil(  ruo(r3oo1omt mnvsl(  Dtax ono0tlxniiciadfs2ea( o;u)trxomrcoy1lpt lnvi ( srxrxo3oo1lleelnvsls  rrmxronu0tltniiciasfs ul(monu0 rtnxf tydop   ivils0 eur(o3iy4ll  mfeiasf 2ra(  nt0oexniieiltfmDumnmo t)tltnmo3tadla rai i () exo(r oy4om nlnvtl(faruaxrpou0openmieils aDeanmo t0arxrxr io1fpD  ues;t sexrim3iydapenlncs () 2umx onu1oee ifetas s2uln p;t)aleomr oytfmDrau sls  eumxopoy4ap e nctl(f rtaurooo4aeeoiietadls2ea(vpnu4 rerxr iydom  anei s  2to(rpny1amtemnetlt arumxmoot4olt iociatfm umums;u0 etrmf tatlmt auvi t)t2tmxopny1al n fvias  Dtmxmo;t1optnmfeiad sDrmu s;(4artomrctydoatelnvolt)s2trxrpno4lpenmics ( s2raxmooo1tlxomi3iat sDuaump u4tetoio3io1lm r uvs;s0sruo(mpoy1om nmncs (  2umx  ;t1oex  fetltla2em( o u)artrxr ta1laDe uvi;t0t2tmxm ou4op  lfcslt sDtaur ot0oee mfeiad s2ranmsnu4 rermr tadfm elueol(  2xrxo iy4lmenmivia(fs2tau pou4oet iieiadfs rmnmo u) etnxf3tatfa  auvo t)s2tm(opio1ope  ncsatfsrtrxrp;u0tlxo oeilslm umnms ()trenmo iotfmte nvsl()t2xm(m3oo4opeelnvsa(  2tmxmo;u1oltnifetldlsDra(mo t4artoxr iadopDraiei ()s2umxm ny1olt  ncsltfaDtmxrpnu4tet mi3iad aDrluvsnt0texnmfciytfm raivol()s2uoiopiydlle mfvslt) Dtaurpnt4tlt mieiydlm2em(vpnt0texrmo3oa1lmDrai ils  2urxopny4llen nes ()srrmxmpno1opx  feiyt mDra( o t)aetomrcoa1fa e i o () 2trim oudop emnvs (f 2ur(rpnu4tltnmfctys m2el( o;() eeoxr3oodlp r ueo t) 2umxmpiydomee fctasfs2um(ront4aptomo3iadfm rmumsnt)trenxf oytopt  u ilt0s2urio3oydapenmfcils) rtm(monu0oleomo3iyt sDuan ont)texoir3oytlat anvil()t2xm(opoodllt mivs sfaDurum ;o4tex  ieiysfa ea(mpnt4 etoir iodfmteau o;s srxr(r io4lpee fvsat)srtrxmpno0apeo fctlsfsDrmnvs ()trerxr3tytlat  i slt sexrxmpoodol emicsa() Dtm(mp;t4tex  oeiytlm2rlumpnt0texnmocta1om rai i;t teurxo3oo1lmt lncil( a2raumo;u0optnif3tysfa rl(ms;u)trtoxf totla r nvol()s2trir3no4alte fetls)s2raumonu4opxoio3iyd a2umn o t4 eenir oa1fptr nvolt) euoio3oy4al e nvt tfarraum ot0apxn f3iyt sDuln pnu4alenmf3oo1lpDrluvi;t s2xrxr3oy4op nlnvt s  rtax p;o1tpeo ociltlm2eauvs t)teenmr3iotlm r neslt) rxmim3ou1ol nlfvsa(faDum( p;o1altniietat a um(mo (0aeenxr3totla rlu slt0seuoxr oodlp nmfvtlt) 2taumpnt0tlxniieiltla2umump ()texrmocoadlp eai s t  rtrimpoodam n fvil( sDtax oou4aex moeilsfm2umump;u) ltoxfciadoat  ivs t)t2umio3oy1olt  fvil() 2taum ;t0tltnioeiyd sDelu p;t4tlxrmocoodlmDe ieo;s seurio3oydape mfcslt srra(mp;t4tlxn oetadfsDeanmp t0 leomf ty1lpDelu o;s0trxmir iydlptn fvil(  rta(rp;t4aexnmieiasfaDulu o;(0teeoir3tadop e ivi;(  2xrxmpoo4amt  fvi ()sDumx oot1opeomfctyt a el(mp u0 eerir3oa1omteauvi;(0t2ur(o3no1ap nlfctas)s2ta(ront4aexoioetatfs uauvo;t0trenmr3ootla rluvslt setrxm oydll  lfvsat)srrrxm ou0apto oeiadla ea( p;(0trtrxf3ty1oateaieo;( t2tr(mpiodome lnvsat aDra(  ot0open f3tld m2rluvo ()tltoxo tydomtr ies;(0t2umxmpnu4oltn fei (  2urumpou4opx  fciatfa2rmumsn(0 exoxfcto1op r uvi;t0 rxm(r3iydaptn ietls)a2rmx  ot4apenmictatfaDeanmo;(0 rxoxrctodlmDe u il( trurir3iy1lpe  feiltfa2uaumpo
\ No newline at end of file
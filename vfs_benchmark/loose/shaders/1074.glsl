@@ -0,0 +1 @@
+ueo (0seumxopoodole lfvias) rrrxmpno0tetnio3iatfm2emnmp;t)tlxoxr oodlaD lneo;s0trum(r3nydllen nesls arumurpnt4texoiicilsls2rm(vsnt4trermrcio1lpDe ivo (0srxmio3nu1olenlictas) ruaxroot1opt  feiad mDem( ont4 lermf ia1lpDr nvslt0teur(o3iydaltelici sfa2rrxrpoo4apenmfeiyslm el( s;u)alxnir3oy1lateli i (0 rxoxmpiudlp emfvsl(farrau p;o0olxniietldfa2uaumpnu4trenir3oodoa  lneol(0 rumim nudam   fetasf Dtm(m ;t1tltnmfetad m ua(vpnu0 rermrcoodlm r n sl(0t2xoimpnudope  ivs s a2taxro;t0aexn fciatfa2ulnmp u)arxrxrciydfp raneo s0 rxm(r3iy1lmenmncs s  Dtrurp;o1tlen oetaslmDrmnvsnt4 etomo3todla r ieilt srxrxrpiodll elnvi (faDtmxmoou1tlt mo3tys m2eau p (4artoiociy1omteai o (0t2tm(r3oy4lltnlfctltfsrra(rpoo0oet iieiysfm2ranmp;()texnifciotfaDran ols texoxm iu4lpenlfci () Dtmxmonu1oexomfctltla emnvp t4 lerif tytfp   neo (0srxoxr oo4omt lnvt s)sDrax  nt0tleo iciyd s emump u)trtnmrciadlaDr nvs;()texm(mpoydoptnlnesltfsDur( pot0tlxnii3ilsfm2umump;u4arxnxr oydfmDean s s) exoiopnudlmtemiesa( s2tm( o;u1oleoiocildla2elumsn(0trtnio oytfpDrln i s texoir3oodop nlnvilt)a2rax p;t1apxomi3iysla2umnvsn(4teeoxf todomtelivo t)s2xr(opio1oltn nci ( a2ua(m ;o4teenio3tytlaDrmumonu0tlxoif3tytoate nvo t0texo(m oy4ole  fvi tf 2rmxm nt4ale  o3iyt m emump;(0 lermrciatfmDeauvsl() 2xmirpny4lptelicia( sDum(mpno0aexn ociatlaDuau onu)trxnmo iydoaD liesl( trtrirpiudom  lictat) rtmx p;u0ole ifciatla rlnms;t0trtoxo3ootlpDraneol(0 eur(rpiy1amen nei sfarta(  oo1texoiieiyt mDulnmo u4 rxnmrcoadla eaivslt)s2toxr nydllenlnvilsf rumx  ;t1opx  fetas m2rmnvpn() etrxociydla r i ils  eurxr io1apt lnvi ()a2taxm ;u4tetn ociysfa2ua(ms;u4texrmrcoo1lmt  n il()t2toim iudap   fcsasfa2rrur no4opxnif3iysfs2emu p;t0 lxnmr ta1opt lueslt0trtrxr3ou4ameelivt t) 2uaxrpou1tetnmi3iatfsDulu ont0tlxrmr to1fa eluei;(0 rxrir3oudlm n nctls sDurxro;t1oexn f3iad aDulnmsnu4 eeomr3iytlpD luvo (0 2xoxo iu4oleelfcsls s2umur no0altnio3iat a umnmo u4 rermr oytfp r neo;s trxr(opnu4lltnmivsas)a2tmumpot0opxomo3iadlsDrmn s;u4tltomociadlptrlneolt0 ruo(opny1al  lnei ()aDtrx  ot4ole ifeiatlm eau o;u4altomo todomt livo t0tetoir iu4apte ictas arrr( p;o1oexomfetydla ulnvp;u0alxoiocta1lmt luvolt)setoio3oydomt lfvsa(fsrtax o;u0texo i3iltfsDuluvp;t4tlxrxr tytlat ai s;s)trurim3oudlpeelfcslt  2tmx o;t4aeeo f3ils s rauvs t)texnirctadfpt aueol( t2xrirpiu4aptemfctl(  rur(mpoo4oltoiiciyslm2em( o u)aeenio3oa1fmte ieilt0 2trir3iy4omtnlivtas artaxrpnt4alxnioeiydla rm( o u)tetomo3ty1opD  ieilt0s2urir iy4om n ivsl(fa2rm(m ot1tltnmoeiyd m ua(vs t0tlermrcio1opte ueo;t0srurxr3nu4lltnlnvsas aDrm(rpnu4tlxn oeiytfa2emnvp t4trtnxocto1omt aues ()s2um(opnu4am  lfet s srrr(mpoo4oexoiicilt a ul(mpnt0arerxo3oodlaDelnvsl(0 2xrxm iu1amenlict ()sDururp;o4aeeomfciat m2em( o;u4trxoxr tatfaDr ivo ()tetmxmpiu1al e net sf Dra(mont4apxnifctyt s2uanmo () rtrxfctotfmt anvols)srxr(o3nu4omee neta()srta(m ot1apxoii3tltfm rmn o u0aexoir to1op r n s;s0t2um(opno4olenmfcsl() 2trxmoot0tlt  i3iadlm rmn pnt)tltoif3oa1fpte u i;t) 2xmxopiu4lle  fct t) 2tm(rpnt4oleoifcilslm2ran pnt)trxoir3totfp rlu s;s0t2trim3oy1amee feiat)aDrru  nu1aleomicildfaDuln p;u0aeeniociatfaDranvs ( tetriopoydom  mictlt arurxm ou1tetomfetlsfm2uau o (4 lermr3iadom ranvil(0trtmim3oo1om   ncta(  Dtr(mpno1oexomietydfsDua( s u4texrxrcoo1lptrluvi;s) 2to(r3oudap nmieils)aDurxmpoo0ole  ietytlm2emu o u0 renmf3ia1fmD  ueo;t0 ruoxo3nu1lm e fesat)aDum(rpno4olxn fcild a um(vpnt4aeerxoctatfatraivs;t)srtmxo oudaptnmfetl(  Draur nu1apx  fetltls umuvs ()alenxo3oydlpt lies;()teum(rpiydlme  fvtls srtaumpnt1apxnii3iatls eau s;t)tlxnio iodopt aivil(0trtoxmpoy4opeelfcia(fa2rm(ro;o1ape moeiatfmDumnmp t4treoio tatfpDr i i s)truoxm3ou1openmfcsa() Drauronu0optoifcildfsDeau p;u0altniociy1lpD  nvilt0trurxm nudamtn ivtlt artaxr ;u4tptn ociat a ranvon(4areomrciatlptrauvolt srxo(r3no1ameelneslt artru  ot0texn fciydlmDrlnvo;(4trxoxf3iytfmteauvi t0 rur(opoo4omt mnesas a2taump;t4alto i3ilsfa2umnvo;(4aetnmo3iydlp r u slt) exrxr iu4ole  fvs sfsDtm(rpno4oexnioeiydfsDulnvpnt4 eeoif3to1fmDeai o t0truoim3iu4ll nlfcsat artrxm nu0teen iciyd a uluvont0alxnmo io1laDeln i;t sruo(m3oy4openlnesls  Dtmum ;o4tlxoifeiydfs2el(vsnt)aetrxr3oydlmDrauvi ()texo(rpoy4am n ietat) Draur ;o1oee mo3tldlmDean o;t0aexoifctatomD livs s  2umxr iu1lpee fvt t sDtmxmpot1apxoifetysfmDraumo u0aetrir io1fm   u ils)texmxo3oudlmt miet t)s2tm(mpoo1tee io3ias s rln snt4 exoif ootom  ai i;s0texmio3ny4ap  liesls sDrmur ot4tpx if3iatlaDeauvo;()tetnxf iotfat  nei s)texmimpiydam e fcslsfa2ur(root0tetnmf3iaslm2uan snt)arenxocio1fmteau o () 2tmir3ou1oltelnvsl()srtmxroot4aleomieiadls ea( onu0texrxfctotfmtelueil(  2xmir nudome lict s) 2um(m nt1tpen f3iaslaDuluvs (0aetoiocoatopDean s t0 etrio iy4lm n ies () Duaxr ;t4tpx if3tlsfm2ulumpn(0texnxfcoadopDelivo s0s2tm(m3oy1lmen ict sf 2raxmoot0opxo fctltfa umn o;t)alxnmr iatomteauvslt0 rtoiopoy1lmt mfvtl(f 2taxrpot4tpxnmfciat mDeanvon() exoiociadfa rlueo t) 2tmim3io1ll elncia( a2umxrooo1tlen feias s emuvonu4 etnxr3oadfaDe nvo t) 2tmim oydlmt lfcs ()sDtaxrpot4olxoii3iadls umn o;u4tleoio oydlm  lies (0t2urxm ny4apt  ncs s  rtaxmpoo1aptn feiadla2el(ms u4 ltnio3oadom  aivilt srurim3nodlpe mfct ( a2uau ooo1aexomociadfmDra( pn()tetnxo iodlateanvi s0t2uo(r3nydameelivia(f rumum ;o0oexnmf3tlslaDea( snu4teermfcoodlpDrauvil(0t2tmim3oo4lpe mnetlsfarum(rp;u4olt  i3tltfs rlumo u4aexrmfcoy1lm eaivs;( srumxr3iu4om emfet (farur(r ou0tlt ioeilslaDuanmon(4 rtrmf3iotlptrlu o;s0 2tmimpny4ll  mfvtls  Dur( pou4teto ieiadla ranvs;t)tlxomrciadfmtraies t0t2tm(mpiu1ame mfvt (  rumxrpnt4tltomocilslm umu p;(4tlerir oytoaDeai o s0s2umxr io1ap n fes s)aDraumpno4teen o3ilsls2umuvp (4texoxf oa1opDr n ol(0 eur(mpnudap n ivils  Dum( pnu1apt  i3ilslsDumu s;u0aexrmrctadom elueilt)srxrxopoudal n fcsat) 2ururo;u4apeomfctys s2emnvs;(4 lenmocoatlaD  u s;s  2urim3ou4ll  lncilt a2tmu poo4opeomi3ilt m2emumsnu)artnxr iatomDeai i ( t2tm(rpnu1lltemfvi sfarraumo;u0aeeomieiyslm rlnvo;t0arerxr3todopD  i ols0s2umxm no4ol n nesl() rtaxro;t0aex ioeiad mDranmpn(0artrxrcootlp rlues;s  etmimpno4omee ncs ( a2tau  ;t1ope mo3tasls ra(vo;t4tetriocoytoaDr uvi s  ruoiopoy1am  lfctat)arrru p;t4tetnmietldlsDrm(vp;()trtomo io1op eluvils0 rurxopiy4lleemnvt sfsDrmx oou1apxn oetaslm2raumpnu4aetrmoctatfa e neol() exm(m iu1ome lfcslt) rrmum no4altomi3tys s2rlu ont4trxnxr3iodfm eauvols0 2xmirpnydom  licsasf Duaxmpou0aptn fctytfmDemuvp (0 ltrifctotoptelnvs s)truoxr io4ape  nvi ( a2ur( oou1aet  f3iadlm2uaumo;t) ltoif ta1lpt ln ol()s2uoxm3iu4ape  fesltf 2uax  ;o4aetoiociatfa ulnmp;(4tetnmfcootlmteaivolt0trtm(r3no1alen icils) rururonu1ole mieiasls2ua(vo t) ltnmocoatlp rlnvi s0seuoimpno4ale  nvtls  rtauronu1oeto iciatlm2uanms;u4arxrmf3iy1fp e n i;t t2xoirpiy4lp n ietl(fa2umx onu0apx  o3iaslaDumu pnt)tltrmf3iadlpDeauei t trtoimpou1lleelicia()s2raur ot4tlt  iciasfs2ulnvp;u4 eenmo oytop rlivi t0srurxopnydllt liesas)sDrm(m ;u4teen iciydlm2uauvpnt)altnmf ta1fatrlneol() euoir oudop   ictasfaDtrxmpnu0open feiadfa2ea( p t4trxoxo3ia1lpDeli ols)texoio3iodam nlnctatf 2rrurooo0oetniiciltfm2umn p t0alxnif3ia1op  lnei;s)s2xoxo3iodomeemnetatf rtr(r nu1tlt if3iys s2eaumo;u4arxrxf3oodlp  li sls)setrim io1ope lfvt s a2uau p;t1tpxoif3tatfaDeaumpnu)teeoxo oydlmD anei t0 exmiopiodlmeeliesl() 2rr(  ou4olenmfeiyt m2eluvs u)texrmf oodomDe n i t0 etoxo3iy1lmt lietas) 2raurpnu0tpxnifeias sDrl(vo t) rermf iydfp e nei;s  eurir3oudlm elnvi t srta(r nu0aexoio3tadla rmu onu) etnmr totopDraivo;s)trxrxr3iodap elfes t  rrrxr nt4aptoifetyd a umu o;(4trtoxr3tadla rau i;() euoiopiodlptnmnvt s  rumumpou0alxoii3iydfm uanmp u)trtoxfcto1fmtelu s;s0teuo(o3nodale  icsa( srtaumpnu1opx if3iyt a ea(vo;t)arxrmrctatom   nvils  exoxopnodllt lfctls arumxrooo0tleomieilslm rau p () lerxfcoadlaDelnvilt)s2um(rpou1apt mics (f rrr(r ;o1opt ioctad sDul( on(4 eerirciatfpt lueilt)s2toim iy4alenlnvs ()aDumu  ou0oexoii3iadfaDem(vp;() exnmo oo1om  aies s0texoxm oydal nlfesl()a2um(  ou0teeo oeiyt m2rauvo t)aeermocoadfmtelnvs s) rur(rpiy4lm   fct (fsDraur ;o1alxo iciatfm2eluvpn(0 exrxr iy1omt  nvo;()tetoio nudlm e nvtatf rrrum nu1oeeo oetlt m2rlumo;u4artrmfciytoat luvs t0srtr(opoy1omt mnviat)aruau p;u1aleomi3ias m2um(vp;t)arerxf oydfat  neo;s) 2toxmpou4optnlfciat) 2umxrpou0opxnmiciltlaDum(mo;() lxrmrcoatomtr ivi;t)texo(rpiu4lmt  ieia( arurxr nu4altoioeiydfs2uanmont4tlxriociytop eai sl( t2um(m3oydame mfetls)aDtaxronu0altoifctltlmDranmp () exoxr3ty1lp e n il(0srumir3nu4omee fesa()s2tmu  ou0aleoiiciltfm rl(mp;t) etoioctytfp rlneo (0srumxrpiodom  lfcil(f 2tr( oot1tleomfeiad sDelnvs;t)trxoxrciadlmDeau s t0srxrio no1llte ictlt s2ra(r ;u1oetnmo3tytlsDumnvp;t4treoxf tydomDeaieo ()trtrxm oydalee fes s)srraxr oo0opx  feils a2eaump ()aexnif3iytop elieol(0t2xoxopnu1ape liviatf Durxmpno1alxnmiciytla2rl(ms;(0 ltnif iotlpD  uvs s)trto(r3io1ol  mfeils)sruaumo;u4apx mfcild s2uau o;u)teerxrcta1omDeli i s)s2xmxmpiodop nmfei t  rtaxm nu4teeniociytfa elumpnu4arxnmrcoa1om   i o;s0srxrirpiy1alt  net ( a2rrxm ;u4aptn oeilsls2ea( p t0aeerxf iydoa   n o (  2toxr iodapt mfctlsfa2umxrpou1oexnioeiat m2uln s;()alxomocootfm r n o () 2tr(o iydaptemicia(fsDtruroot0apxoifctaslaDra(mo (4artnircoytoatranvi;s setoiopoo1am nlnctl() 2uaxmpot1ale iictadfaDumn s u4aexoxrciodomDeaueols  2tr(m iy4ameemneslsf rra(  ;o0alx  oeilsla ranmp u4teenif3oo1lp r n sl()trtrxm3oodapeelfeilt a2tmx  nt0oexnmo3tat mDemn s;t0 eermf iy1lpDe u sl(0truoxr no4op nmnctat  2tm( oot4olt mocias s2ua(mo;u)trerxr iatfp e nes t teurimpio4lpt mfesasfaDra(r no0apx mfeildfm2umn on()tlxniocoo1fm   ueo;t s2xm(rpoudalee nctasf rtaumont0olx  o3iyd mDeln s;t4aexoircoa1opD  n s;( srtoxmpny1alee ietltfaDuaumpnu1optn ictytlm rl( p;t) eenmo oydla   nvs s0sexoir3no4apt mici t s2ra(mp;u0texoii3iat mDrmnmp;(0 lxnxf tytlm rluei t0seuo(r iy4ope  fesas)sDururoot0alxo f3ilslaDuluvpnt) lxrxfciydfmtr ieo;t setrirpoodlp  lnctas artr(r ou4tpxoiiciaslmDrmuvs (0areomrctydfatr i i (0trumiopio1lmtelici (fsDuau p;u1oeeomf3iltlm ua(mp;t4 eeoxr tydfmDean ilt0t2toimpnodlp emivt (f rtrumoou1tltoioetydfaDuau s;(4tltrxociatfpteanvi;t0s2uoim iydlltnlfvi s s2ua(  nu1tlto oeild m2elnmo () lenifciodlpDrluvslt0t2xoxopoodame  ivs sfaDurumpou1oeenmoeiatlaDrlnvs;t) lerxrciytom r n s;s)teur(rpou4lltnlfes ( s2rmur ;t1tleoiociysfa2ulu o t0 etoxo3oydlpt  nvi;t)texr(mpnodlpte fvtls srrrxm ot0tleniiciytlmDeanmo;u4 lxrir to1fmD lneo t)teurxm nydal emictlt arrau  ou0teeo oetatfmDrlumo;u4 rxoifctydopD aivi t0t2xo(m3iy1omeemnvsl(fs2rrumont4tlx moeiat m rluvp;() reniocto1oat anes;s)seuo(r3iudllen ivs () rumxm nu4ope ifeiydls emn pnt)texrxo3oodomDeaneo s s2tmxm nu4altelnvilt)sDtmx pno1opx mieiatfsDeanvs (4tltrmrcta1fa  auvi;t) eur(opiudlptnlfvsat  rur(r ot1oeto octlsfa2emnmonu4tleoir oatlp r u o (0sexoir3iu4olen fesas)arrr(  ;o1tlxomfeiytla rluvo () lermrciy1omDe i ils) ruoxmpiydoleemies (faDrm(r ;t1aetomo3tltlsDeauvs;u4tltnmf3oadop ran o;t0 2trim iudam nliei sfarrrumpoo1tlxn i3iytlm eaumo;t) leoxf iytfp  auvo;t)seum(opnu1om nlnetlsf rrax pno1ape ifcilt s2el(vonu4trxoxr3oadomtrluvi;s)trxm(rpoo4op e ivt (f 2umxrooo0aeto feilt sDuan o;(0tltoxo ia1lmDr uvolt  rtrirpiodal emfvsas aDumur oo0tex ifciyd sDemu s;()aeeoxociatoa ran slt) 2tmio3nudol n fviatfsrtrur ;o4tleoif3tlslaDelnvp u0texoiociatom r uvi;s trurimpoy1lpe lnvsat)s2tmur nt1tlxnif3iatlm ean snu4trxnirctatoatrlu o t sexmio3nu4al e fvta()a2uau p;u0aptoioeils aDrlnvp t)altrir iy1faD lnes;t)seumir oodoleelneias aDtmxmo;u4ape moeiydfs2ea( p;() lerirciy1lp   uvsls) eurxopoodale  feiltfarum( pou0oeto oetys a2rauvp;u4aeenio3todomt  neol(0srtrxr3oodopenlnei s aDumum ot1ope ifeiytfs2umuvsnt4aexrxo oadlp   ues t0teum(r3oudlm nlivils) 2tm(ront1olx mfctytlm2ran o (4areoxo ta1lmDr i i t  exoirpoo4op elfesa(  rur( ont0olxnio3ilslmDem( o;t4aleoxf iy1oaDe ueo;(0 eur(m oy1ap  lnvsltf rua(mo;o0altomi3iyt m ul( pnu0aeenxo3ootfaD ln i t) eur(m3oy4om  lneslt) 2ta(  nu0teenmf3ildfmDulu snt4arxnmf ia1lmte ueilt  etm(o io1lle  fvtlt)a2tmum ;t4tlxomi3tasfmDeluvpnt) ltrxf3tatoaD luvs t) ruo(rpio4lpen fcslt)arrr( poo0oexnmf3iatls2el( onu4tetoxf oadlpt  nvi (  exr(mpiu1amtnmivi s s2rr(rp;o1aleo octlsfs2ra(mpnu4teerxr3tydlpD  i s;(0 2uoxm3io1omtnlnvtl() rrr(mpnt1tlx iietat m ul(mp () lxnmo3oo1lp rauvo (0setoio3ou4ll e nct t)a2umxroou4opxnmociysfs ulumpn(0aeeomrcoydoptrliesls)s2umirpoodamtnmnvias aDurxronu1olxo f3iadfa em(vo;u0 reoiocoo1laD lieilt texoio io4altemncia(fs2umur ;o1tetomfctasls2rln s;t0arxnxrcootla rau s;s) rtoxr oudlpe  icia(  rtmump;u0aleomietydfaDra(msnu0 exrmf3tadfatelneolt)sexrxm nu1lmt lfciltfa2uru  nu1opxnmfetatla ulumo u4 exnif oodfp e u o s teurxr3no1lmt mncsl(fsDumx pou1ole if3tyslm2ra(vsnu4teenir3iatoaD aieols)s2tm(m oodlmen ietatfsDrmurp;t4tle mo3iyd m2ulnms t0aeerio3iatlatrlueol(0truoimpny4am   ncslt)a2uaumpnu1tet mi3tydls2uau snu0texrif3oytomD auvs;t0 rxrxr oodapen netltfsrumxrpou0oeeo f3iys a2um( pnu) exnmoctydfm eaivs;() exoxopoy1altelivt s) 2uaurono4oleniocilsfs rlnmo;t)tetomr iadfm e nes t0seuoio3io4ome  fvs (f rtmxm ;t4texomictls m ua( pnt)treoio3iydoat  u ol()s2um(r3oy4opeemfvsltfs2rrur ;u4olxoif3iyslm2rmu p;(0arxrio oo1lat  ueolt trtoirpoo1alenmnet tfsDumu p;t4aptnmociatla2umnvo;(4 rxnmocty1la elnvs s0t2xmiopoydolenmfesa(f rrmxmo;o4tlxo i3ilslmDrlums t4 ltnxfcoydfa rlneils s2uo(o no1lp   fcsatfsrrr(r no0aex  ociyslaDeau sn(0 exrmocoytlp rlueo;s0s2xrim3iydomen neiltfsrtmxmono4oltoifctls sDeaums ()arxrio3oadoateai il()srumxrpnudlptelieils  rumx p;u0oexomo3tat s rmu p;(0 etnxfctatoa  li ilt)s2toxopiu4ap nmici ()arur(mpno1aptoii3iat sDumnmont0areoxf iydoaD  ieo;s t2xrxr io4amen fcta(f Durx p;u4alxoifcilt mDrau s;t) etoxr to1oatrau s;( srumxmpiydape  ietlsf 2tmxrp;o0opxomf3ilsla eau o;u)arxomr ootlpteauvil( seur(o3ny1opt mics (fsDrax p;t1olxnmf3iltlm em( onu4tetnxfctydom eaues (0sexr(o oy1ameelicia(f 2tmxm ;o4oex  i3iat s rmuvs (0tlermo3oodfpD  uvo t tetmir ou4lm   fvtat)arua(r nu0olx io3tlt aDem(vp (0arenmoctodop   nvo t)tetrxr iu4apeelietlt srtaxmont0tetniiciadfm rmnmpnu) ltrmf3oy1fp raueo;s  rtmim iydalt licsat s2tm( onu1tlxn ietltls rlnvp t)artomrciotlat lueo;t0 rtrio nudlp   iviat artmx poo0oeen ocils aDua(vo;(0tlenmocoodfm   u s;s0s2toio io1lleemnvilsf 2raxm ou0tpe  iciltfs eanmp t)trxomr3ootlatrlues s)tetoim3no1amt  icta(f 2rax ooo1oltoiietytls rl(vp;u4trtnmf3oy1fmD ln o;()tetmxrpio4ol  lfvt sfsDtmxmo;u1tpeoio3tyslmDuanmo t4 renmf todfaDrauvolt0srxoiopiy1om   nvilt sDra(r ;u0tpt mfcilt aDem( pn(4aetnir ty1lpt lu i (0s2xoxmpou4ame mnvsl( aDua(mpno1apeo feils a2eanmont0aexrmrcta1omt  ieo;s  exmio3oo4altelnvi sfarumx pnt4oexoioeiadfa2eauvsn()alxnxo oodom  auei;s0 2umxr nudlmeemnei (f 2rmurp;o1tpe if3tys mDra( s u) etoxr3iatlmD ai s;( s2umir no1lmte nes (farumxmpnt0oeen ictat a2ra(msn()areomr3oodlpDelu ilt t2toxmpio1opt lfvtltfaDrmxr nu4tetn fciadls2em( snt4 exnxf iatopDeaues t)srtoio3nu1apt lnetas) 2urxmp;o0aeenmieild sDea(ms ()trtnmr tytlmte nvi s t2trio iudop e ivil(f Dra(r ot4tet mfetad a2um(vs;(4tltrifcio1om  lues s) etrxr iydomen fcsat) Dta(mpnu4tpxnio3tltlaDua(vsnu) eenxo oytfp elieo;( seto(opnu4olenmivt ( aDtmur oo0oexomoctys sDum(msnu0alermf3iatlm rliesl( t2uoxm3iy1lmt lnci (fsDururoot0tle mietadls rm( sn(4aetoifciadlpD  u i;(  ruo(r3iy4apt liei (  rrmxm nu4alenmo3iysfaDelnmo;()trtrio3todlaDean i;s0t2to(m no4ameemivil()a2umu pnu0alt io3tls a ua(mpnu0tltoxfcoodlaDeluvil()srum(r3oo1ame mietat aDtmu pot0oet  i3ildfa ulumo;u) rtrxr ootoatraneols) rtmxr no1ameemnviltfs2um(ro;t0aexo ieiadlsDul( p u4 lenmfcoo1faDrluvo;s)s2uoimpoy1op nlnei s)aDrmxmo;o1texoioctlsfm ea(vs u)artrir3ia1omt aieils) etrxrpiu4al nlfvtlt  Dur( o;t4apen feilsla um(msn(4aeeoif3iy1fa eln s s)texoiopno1olte fctls)arrmum ;u0oexo fciyslm2em(mo (0aexnirciotlat auvs;t srtmir3iodaltelicil( aruau pnt1openif3iydfaDelnvp u0arenif oatomD lueo;t)srtoxo ny1am  lnes (fa2tm(mp;o0tle ioetytfmDumumon(4trtnir3iadomt  nvs s)seumirpoo4apt  fviat  2umxronu4apto fctasfmDrmnmon(4arxoif ty1faDrln il()s2toxrpoy1lp emfcia()sDraur ;o0opx if3ildfa ra(vont)tlxnmf3iydomteauvo;t)t2umxopiu1lmtnmnetas) rum(r nu4tleomicilsls2ua(mp t0 eenmrctatlptrauvi (  rtoxo iy1om nmfcilt  2tmxmo;u1oetn oetydfaDrl(mp (0 eerxf iotfa rlnvi;s) eurxo nu4ol emnetat) Dumxm ;u4tlenmfeiadfsDrmuvo t4treomoctatlpDeanvs t0t2urxr iodllen nctl( a2trx  nu1tltomoctys a2eln ont)texrmfcoa1lptelnei t  2trxrpny1ole mfcsls arra( oou0aex ii3iat aDeanmp ()trenif3oy1fatelnei;s)seuoirpoy1alenlietls) rraur ;u4tlt  ociydla rlnmp (4tleomf3oo1oa elu sls0teurxm3iodomeelfcias)sDum(rpnu4tlenmo3tydlm2rmn s u)trtnmf3oatom r ueols tetrxm3oy1amt  ncils  2rmxrpnt1oet mo3iatls emnmsn()texrmf3tydlmt li ilt)t2um(o iu1optnlnvias)s2ururo;u1texoifeiys m ulnvpn(0tetnmocia1fp eliei s)texoimpnudaltn fciasfa2urx oot4apt ii3tatls2eanvo;u)tetomf iatlaDeanei;() 2ur(mpoydlleelfvt s) 2tm( o;t0oeto ociasfa2rlums;t0aeeriociytopt  n o s0seumio3nu4llen fcta( srumumpoo0olt if3tatls emnms t)aleoir3iotfm eluei;(0 rur(r oudlpe  nciltfa2tr(  ;t1optniociltfsDrlnvpnu0 rtoxocty1fmtrlu s;s)trxoxm oy4oltn ncs sf 2rm(mpou0oex  oeild sDeaumo t4aexoxf iy1oaDranvo t0 2toiopoudolenmnvsasf 2ua(mont0altoioeilslaDel(ms () rxrxr ootfa r ieilt0texo(rpnu1ap emfesls  2tmxr no0texnmo3ildfs2um( s;(4trtrir oa1fmDr nvs;s0sexm(m iydol nmieiltfsrua(  nu1aex  o3ils s rl(msn(0tetnmociotfpt ai i ()s2xm(r3no1op nlncta(  rtaur ot1tpenmoctytlmDraumsn(4artrir iytlaD  n sls s2xmio3nu4alee iet t) rrru ono1tetn feildfmDelnms u)trtrir3iy1lmtrlu slt0t2xmirpoy1lmtemfvtat aDrru o;u1oexniicilsls ra(mo;u4trtnxf3tytlpteanvi (  2xoxm3iu4ol  mfciltf rrmu ono1aex ioeiasls el( o;(4teermocta1la rai o;s)t2urxo io1lmenmnet t) 2ur(m nt1openmfeiatlaDuau sn(4altrmfcoy1fptelivs ()srtr(rpiy4aptn fct ( a2umxmo;o4ope mf3tyd aDeanmpnt4tlxoxocootlm eaueol( sexrirpoo1altnlivsa() Drr(mpnt4texomf3tyslm2raumpnu0 rermf3iydfmD  i i (0 rxrir3ou4llenlnet s srrr( ono1aetn iciatlaDuaumont4tetrmo3oa1lpDrlu sls0texoxmpnodlm  mneilt)aDrmxmo;u1teenmiciysls ra(mo;t4tlxoir3iotfmD an i (0 2xo(mpiu1ame mfvs t sruaur oo1tptn feiytfsDean o u)alxnxo ty1om e iei s  2tmim3io4al n nctlt  2rm(mo;u4opxnifetat s emums ()teeoxf3iadlptrlu olt)seurxo io1lpt  fetatfa2trumpno1tlx ifeiytlsDemnvo;t4 leoifctytlp elu sls) 2xoio nu1altn fviat) rra(mono0aleoio3iydfmDeauvo;t0artnxr oa1opDr ueo;s srtm(r nydom  mncs s)srtm(m nu0oltn o3iltlaDul(mpnu4 reoxf ootla  lues;t trtrimpoydop  mnct t) Dra( p;o1aexoioetytlsDrm(mpnu0texnxf3to1fm   i o ()texm(r3nodap   nctlt)srrrx  ;u4tptomo3iaslmDem( p;t)tetnmfciodlptr n s;s)srtrxrpou1ol   nci sfsrua( pnu4olxo feiatfs2ea( ont) etnxrcoo1omtelnes;t teum(m no1ol n fct ( aDtaxr ot0oee mfciatfmDelnmo (4aexnir io1lmtrliesl(  2to(opnudopee nvs ()sDtr(  ;t0olxo fcilsfa rl(msn(0alxoxo oydop   n o t0 rto(m ou1lm   nes s)arrrumo;u0aeto o3iyt aDem(mpnu) ltriocto1faDrlueslt0sruoxm3no4omtelfcil( a2um( ono4ole  fetad m rmuvsnt)teeoxrctodlatrln ils)sexo(o3oo4ll nmfct sf rrm( o;u1olenifciltla rl(vo ()aexoxo3tatfaDelu sl(0texoxo iu1lmee netas  2um( o;u4oeeniieiasfsDrlnms;u)tetnmocto1lmtr i i;s0t2uoxo nudoltelivi t  2tm(rpnt1oleo octytfa ranmo u4aexrmr3todoatr nes;(0s2urxmpio4ll nmicsa( sDurxrp;t0tpxn ociadlaDean s (0 rtrif todom r ivils  2uoir3iu1opt mfct t s2umxmpot4olxomo3ilt m ran p;u4aleoirctadoa eauvsls) 2xoio io1lm emictlt)sDumxrooo1tet mf3ias m2rm(vs () eerxf3iadoa rauei;t s2uo(rpou4opt  fvsl() Duax pno1tet  ieiatfa2emnvonu4 ltrmo3iydlateai o;t0srxrxmpio4ol emncsas)sruaumont1olxoiieilt m ul( p (0alermocoydoaD aivolt0 rurxr3ou1lpe mivilt)sDtaum ;u0oltoioetytlmDum(mo;(0tltomf3iatfaDr ieo s) eur(mpnodomtnmncta( a2urxronu1tlenmi3iltla2um(mp;(0aetrmfciytopD anvslt0trtr(mpoodapt  fvsltfsrrr(rooo1tpe  ictydfa2rm(mp;u4alermoctatlpD anei;s0 exrxrpnu4altelivsa(fsrrrxm nu1aetomieiat m em(msnt0texnir3iydlpte nvo;s  exrxopnodlpt mnctlt)sDuaxrpou1tlx  o3ils s2ua(mp;(0trenmo3totfatr u i s) 2xoimpnodoptemnctls  rtaxmpot1tlxomfeildlsDuanvp u0tltrio3oytfp  lueo () rtr(rpny1amtn ivtas) Duau pnt1tltnio3tydla2uln s;t4 rermfctotlmte n ils0sexo(m3oydaltnmfctatfsrtmxmp;t0tlxnifetlt s emnmp u4 rermr ootfaDr ivol() rurim3nodaltn nei sf 2rmxm oo4tpen ietyd s uluvo;t)aeeoiociy1lp   ueo;t0t2trio ny4ap nmfvs () Dtru o;u1tee iociltfm rmuvs u)alxrxf3oydoa eaieo;s0 eur(o io1lm nmfvt t)sDrm(r ;u1open f3tls mDem( p u)alxrif3tydoateln s t0setmxrpnudlmen fvs t)srrrurpou1texoiociat aDem( p t4 rxomr3totlateanvsls)trur(opiodlm emnvslt) rtmumpno0ape mi3tydfa rl(mont) etrmocoy1lmDeluvo;( srtrxopnu4al   ietatf rra( onu0oeen feiysfs2rlnvsnt)trtoxo oytopDr ueo s  ruo(r oo4ape mnvslsfsruaumonu1olenifcilslaDraums;u)artnifcta1omtrlueolt)trumirpoo4lme  nct s)srurumoot1olxnmi3iaslaDuan s;t0aeeoir iytlat  ueils  etoxo3oudomee ieslt) Dtauro;u0oexoif3tadlmDeln o (4 lenxf totfptr ueilt) 2xmio iydlpt lfciatfartax  ;t1texo i3tadfaDumuvpnu)texrxocoa1fm r u s t0teur(opoo4lleelncsls)s2rmxm ot0tetoif3iydlsDulnms (4 eeoif3oo1lp rlivs;( t2uoio3no1optnlnvtatf 2rrxmo;o4tptn i3tltlm2rm(vp;t) ltnxo ta1oa eaieils  2xrio3nu1opeelfeil(fsrum(r ;t1aexnmo3iasfsDumuvs t) eenxo ta1omDe ues;()s2uoxopio1ameemicta() 2rr(rpno0apxomictasfa2em(mo t0arxrmfciatla   uvo ( trtr(mpiodoltelfcslsf 2trxm ou4alx mfeild m ran s;t)tetrmoctodlptelies s0seur(o no4amenmicsa(f 2umxmoou1tee  o3tytfs2ulump t4tltoxr3iatlaDr i sls  rxm(o3iu4ale licsa( arrr( o;o0aee  ietatla2rmu p t0 exrio3ia1optrln o t0sexoimpoydomtnlivtls)aruaxmooo1aeenifeilsfsDrl(vs;u0artoif totop e iesl(0 eto(r nydopen fctl(f Dum(rpot0oltomf3iytlaDemu s t)arxrio3io1lptelu s;s)trxmiopnydlpee fct (fa2tmxrooo4tptomi3tysls2emn s;t4 rxniocoatfpDeln o;t0 2xo(r io1llenmieia( srtmurp;o1tee  fciatfs2eanms (4 rtnxo totfaDrlueils)srxoxopnu1om elnet tfsDraxmpot4tpxnifetld sDum(vs;t4 etrxo iadlm  auvs (0trtrxo iodoptnmncsat) rur(monu1tpenmf3ilt s uaumsnu)aeenxocoatfm r nes;t  etmiopny1lp  lnviasfaDuru  ot4olxnmociad s emnms;u0 eermfcoo1fm eai i ( t2um(mpiudomtnmies tfsrtmx oou4tlt ioeiaslsDumnvon(4 ltoirctydlpt  n s;(0 rtoim no4opt mfcsa() Durur ot1oexomfciydfa2ul(vonu4 etniociydfat  ivsl( trxrxm nydape  fes s)s2umu ooo0apeoiiciysls el(vo t0 ltnif3todlpDraueols)texm(rpnu4ome mivsat)srraurpoo1apenio3iltfmDeau sn()tlerxo ootoptran il(0s2xrimpiy4lm  mnvsatf 2urumont1opto iciytfa2eluvpn(0aeerxf iy1om eanvils s2tm(r ou1amt lnet s  rtmxmp;o4ape mfctyslm ean s;u4treoif oadfaDe n o;t0trxrim ou1oltnlfctls) 2tmx pou4ole  iciatls2rm(vo u0tltrxf tatlm eaiesls) 2ur(mpoydlmeemiei s)arrmxrpou4aexnmietltlmDemu o;(4 renxr ty1fptrlieilt srto(m oudalenmfei sfartm(rpno1oex mo3iadfs emuvont4 rxoif3tatopDr u o (  2um(r oo4lmt licia()sDtaum no1aptoiociasfsDeau p ()trtoir ta1fpD aieslt  rtr(opnodap nmiet t) rtmx  nu4tetnmfcild mDeln o;(0 exnmr3ia1opDrai ol(0 2umxmpoodam   ivil(fsDtr(mpnt0aex mieiaslm rl(mpn(4artrmf io1op e u o;t)sexoio3iodam n ivtlt  Dtmxmpnu4tlxoiociytlaDum(mpn(0alxnmr iy1omDrlnvslt) exriopnu1olt lnetls) 2tmxm ot0tpxoifcils s umu o;t0 eeoifctatlatr ueo;t trtoiopiudllt  fci ()arrr(r ;o1tltnioctlsla ul(vs t4 rtoir oadfp eaieils  etmxopnu4olte fci t) Duax onu0ale iicilsfm umuvpn(0alxoif3tytlaDean ilt)s2um(r no4amtemfesatfs2um(moou0aeeo ociys a2ulnvp (0arxomr3oadom   nvo t0sexoir3iodoleelivt (f 2rrxr nt0tlxo o3iadfs umu s;t4tetnxo3tatlpteaieo s0trtmxmpoudlp emnct t  2ta(mo;u4apeniietyd a uln pnu)tltrifcoa1lat lnvsls)t2to(m3ny4omenlivsl(farua(ronu1tlxnioctltfm uan on(4tlenmfcoo1fm r neilt)s2tr(opnydapen ics s  rrrxro;o4aeenif3ildfaDean pn() rtnmoctodfaD au s;(0s2ur(o3iu1altn ivilsf rta(mooo4tpeniietad m2rl(vp;t0alxomf3ty1fm rlues;t)seurxm3ny1lpe  ncs s  Dua(  ;o4tltn o3iytfaDul(vpnt0trermr3iy1fmteaueil()s2toxm io4lmtemivsatfs2rm( p;u0aetomoetyd s eanvo;u0trxriociodfat anvo;( srxrim3ou1omt mnet tf 2raur ou4tpeo i3iad aDemumo;u4aexrmr ootlpDeanvo (0srxmxmpnudll nmicslt  Drr(  nt1olto i3tld mDuan s;t)trxoircty1laDeli sls0srxr(o nodope mivt sfa2rau  ;o0aexnmo3tydfm rmn pnu0artnxfcoatlmt liesls  2tr(r3iydam nmfct s)aDrrxmpoo4tltoifctyt a ra(vo u)arxrxr3io1fm  lu i;s)teuoxopou1lm  mfci sf 2trum ot4tlt io3taslm2uauvon()tltoxociotfa e nvslt0 ruoim iodope  nes sf Duaur nt0teto oeilslm2rluvs;u4aeeoxrcia1fa   ivo;t0trtoim3nudal elfes t)srrm(  nt4tetoiictydlm2ra(mp (0tltomf3oytfaDrlnei (  ruoxm oo1ap  livsl(fsrtmuro;t1tpenifciysfa um(msnt)alenxo totfa  anvils  rurxm oy1lme  fvias) rurxr nt1tptoio3iad mDua( pnt4 lenxo oadop rai ol() 2uo(m3ou1lpenmfei t) rumx  ;t4teeo ociysfs2elnmon() leoircto1la  luvs;t t2xr(r iy1op   ictls)srua(m nt1aptn fciyt a ranmont)tetnir3oatoat livo;t0trxrxmpou1lmteliei t) 2rm(moou4oetnmi3iytla ul( pn(4 rtomo ia1oa raivo;(0t2xoxopiodamt  fci s artmurpoo1apenioetadlaDrl(vs;t0alenif3ta1fpteaneo ( teuo(o iudaltnlietl( artru  oo1texoif3iat s rmnvp (0altrmf3iodfptraivs;s)t2to(r oy1omtemivias)aDrm(mpot4tlxomicildfm2umnvs;t)trtnir3ia1opteaivs ()t2toimpnu1altnlfvs s srumx  oo0texomoetatlmDeln s t)teermr to1oat aues;s)trxrim ny4omtemnci ( a2trur ;u1alto ociytls emu p u4texniocoydlaDr neolt)tetrirpio1lme liciat  2tr(mo;t4teeo i3iltlaDulu o;(0 ltrxo oytlmDe nes;()srxmxr3oudol nlfvsas  2tmx  ou0opxomi3tlsfa ulump;(4aleoxf iatlmD  ues (0s2to(opoy4open fct t)s2uaurooo0aeeo octatlm um(vs;(4alxrxo oadom  au o t)s2xmxr oydam e nvtls)s2tmumoou4tltomietyt m uluvpn(4 rerxocootlp elueo;s s2to(mpny1op  lfet t aDuaxrono1open iciat sDrmu pnt0aexrmr3tadfptr ieol( setm(r iu1omenmiciltfaDrmurpnu1texnmi3ias mDrmuvp u0tltoxfctotfpDeanvils srxrxrpny1altelics s aDtrx pno4aleo i3iys m ua(vo;u) renxr3ootfmtrai sl()s2tm(r3nu4lptemicsat sDumum nu0tlto f3iyd aDem(mo;t)tlenxf todlm  luvols0trxrxopoydopenlncsltf Drm( ont1oeto ietat sDem( ont4areoir iadfptran sls t2ur(o oy1opt mfetatfarurumonu4tex  f3iad a rl( pnu0arerxrctodop eai i;t srtrxm oydop elivt sf Durxm ot0alxn fetltls2rl(vp (4trtnmrciy1faD au s;(0 ruo(rpiu4lpe lfctltf Duaxm ;t1teeo feiatls2ulu o;u4aetoif iodlmDr u ilt  2tr(r3oydamtnlfes t)aDrrxm ;o0tlxoiictytfs2rmnvp;()alermf iatom rln i t  exmir3io1am   fvt (fa2raum no1altomociasls2umnvs;u0 etnxf3iy1lm elu s (0trxoim ou4opt liviltfsDuaump;o0tpt moctytls2rmuvp () rtnmf oodfat ai s;t) exmxo3io1lm nlivt (f Dumum ot1tpeo o3tad a2ulu o (4 exnxo tadop rluvols0t2uo(r oudope lfvtl(f 2tmxrp;t1opt ii3tad m2ua(vo ()tetnxf iydoateaies t0 rxrxrpoy1omenlivt ()aDrr(mooo1oexomi3iat s rlnvp;t4 rxoxo oadlmDeaivil(  rxr(r no1opeeliviasfs2trur ;u0tpxnio3iltfm2elnvs;(4trerxfciodlaDeaiei;t0s2trxrpnu4om nlfvsls)aDtr(m ou1oeeoii3iys mDrlu p;(0 rxoxf3ootlm  lues (0 2trirpiudlpt  fes t)a2rau o;o1aex iietad m rmnmp t) rtnifciadomD lu i s0texo(o oydamteliesl(fs2raumont4apxn ieiyt s2rlumon(4arenifciotopt lueo (0trxmxo3oy4opt  iciat  2uax p;t1tptnii3ilt sDeln o u)aetomf tatlmD livslt) rtoxr io4lm emnetat)sruaurp;o0opxomfcilsfaDra(mp (4 rtoir iydoatelieol(0s2tmim3ny4oltemivi s)sDuax pot1tlxo ieiltfa ra( s;t0aetrif tytopDr u ol(  rxr(m3nudll elnvi ( s2rrxmoou4oexnif3tatfs raump (4 rxnmf3ta1omtr ivols) 2trxm nodapeemivsa( arrmxr ;o4apxnmocias aDrlnvs t4 rtrxfciatoa  li o s  rxmim ny1al nlivil(  2trurpnt1teeoif3ildla rl( pnt4trtrir oodfateaneo s)trum(o ou4lmt lfcsatfs2rmx o;u0oet ii3iys s2rmnvp t0texrmrciotomDe nvo;( truo(r nudlmee fvt sf 2rru ono1aptnii3iydfsDuanvpnt)treoxrciatop  li ils)truoirpiudlpe licil(fartax pot4tex ifeiytfsDeluvp;u4trtnif ta1fmDrai o;(0trto(m3oudame lfvt (fsrraxr ;u0tetniocilt m2umnmo u)tlenmociodlpt auvo s)s2urxo3iydape lnvt ()sruru pnu4teeniiciysls2uauvon(0areoif3ta1lpt aneils0t2tr(r3ou4ape lfvtat)srur(ro;u4tpxnio3tadlm umums u4tltoio3oydfp  livslt srxrio oy1opeelfvi s) rtr(ronu1apeomi3iyt m em(ms t) rxnir3iodlpDe uvo s  rxmiopny1lleemneia() 2tmx o;o0alenmoetytfm uln s;u4artoiocio1opDrln i;t0 2xo(o3nodlp nmiei sf 2tm(r ot0tptniietlsfm rlu sn()trxomf3oytlmDr ieils) etoimpiydal  lnvsl( a2ua( onu1tpxoiiciydfmDeanvs;t4aeeomr3oa1fm   uvs ()srtriopoy4lmtemnviasf Drr(m nt4tlxnioetldls rmn snt)teenmrcio1lp rln o;t)texoir3oudal  lnesas  Dua(  ;t0aetn oetatlmDuanmp;t)arxnmociatomD  ivsls0t2uo(r3oy1apeelictl( srumu pnt0optnmi3iysfsDrluvp;u)tleomo iatfpte n s;( srtrxm nu4llt mnvtasfaruru pno0aex  ociatlaDra( o t0 ltriocoy1fat  ies s0texmxo ou1lptelivt tf rtmx  ot4tlx ii3ilt s em(mon(0trxrif ia1op e n i;t)t2ur(rpnu1op nlfesas a2tau pou0ape ifctys mDuanms;t4alxnmf totlmDr ueo (  rto(opnu4lm  mieia(fs2umu oou0texoifciys sDrl( s () ltrxf3ta1lp r ivi;t seum(o3iu1ap emfct t)arrau pno0aexo ocilsls elu o u0arxrif3iy1faDr ueo;s)trxrxmpny4ap e ncta(  2ua(rpot4tet  ieils a2raumsn(0 lxrmf iy1opD anei s)trxmxm oy1omee fvsl() Drr(m ;u1opeo i3iyslm ulnmp;t)altrmo oatlpDe nes s) eto(m iydol elicsls)s2trxmpnt1aexoiieiadfa2rlnmo;(0aeeomo3tadfatrlivo s0 2umim3oo1oleemnvia() Dur(m ;u0apx ifeiaslaDua(vs t4aexrmo3oodom eauvo;s0 2urir ny1al  mnvi sf Dtmu  ;u0aeeniieilt aDel(mp u)tetrmr oodoa rlneo t  exrxm3oo1lmeemivs ()sDtrum nt0tpt  iciltfs elu p;u4artoxrcto1lmtr u sl()trxmxrpnu1lpe lnvi t a2rr( oot1tee ifetatlaDea(vsnt)alenir ty1laDeaivolt)trumxr3oy4amtelnviat  rtmxr nt4texn icilt a elnmo t4 exnir3to1lateaivol( trtm(m oo1aptnmivs ( arrrur ;t0optomociysls um(vpnt)tleomf tadlpt  i ilt) exoxmpnydlltnmnci (  Dtaxrpou0tpx moeiys mDumu p t4altomoctatlateanvo;s) rxm(o3iudamte ictasfa2rr(mo;t4aexnifetld mDran s;u)areomf3totfatraiesls teurxm3io4optemfetls srumur oo0teeomfctltls2rmn on(0texomr3oadomte ieslt s2ur(o iydomtelnvt t)a2rm(mo;t1aptomiciad s elnvpn()arxrmo tytomtrln olt) 2xrir iu4am nlfcsatfa2uaxrpoo1tlxnifctadla2uau snu0 exnmocoatfptr neils seuo(opiudlm  lfetl(fa2uaxm ou4oleomiciat sDumu o;(0alxnio oatlat aueol(0sruo(o3oo4alenlict ()sDtaumono0oexniieiyt m2rlnms;u4 rxnif oa1op rai o ()sexrimpoo4ll nmiciatf rrrxm oo0apx mfeiasfmDum(mon()alxomf to1fpD lnei t) 2xr(m3oo1amee ivi ()srrr(rp;o4optnmi3iat s2eanmo;(4 etnmo3oydomDrauvs;s  etoxr3ou4amtn ivtatf 2rmxroot4openio3iysla2uaumonu)trermo3oytoa r i olt) etoxo iu4lm emfviltfs2tr(mpno4open o3tad aDel(mo t4tlenxo3iytfptrluvolt0sruoirpoudlp nlnvsltfs2ta( pot0tpeomf3tyslsDea(mpn(4aetoir3tydomDeli o s)t2toim oydomtemnes ()sDurxmo;o1tpxo o3ias mDrlnmsn()trxrir3tatlatrlnei s s2xrxr3iodomee nvi sf Dtrx  nu0alt mieiltfs2ulnvonu)tlxnio3ta1omDe ues;t0t2toxo iodoptemnvsat a2ua( ooo4oexnmoeils m uan pnt0aleoxfciytfpDr nei s0t2xmir iu4amtnmivslt)sDta(m nt4oee mfeiyt a eluvp u0arenmr oodlptr nvo t s2to(o ou1lm e fci s)aDrau o;t1olx moeiadlaDum( on(0 lenif3ootla eli s;( srxoirpnu1om elnetl(  rrr( p;u0alto ieilt m ra( on(4 leomocia1lat auvs;t t2tmimpiydllenmivt sf rrmx  ;u0optoiiciasfmDrauvon(0texrmfcio1om   uvo (0t2xr(opno4am elieiat sDtmx ono1texo ietat s2uln s;()trenmf3iodlat lueils) rxoxr oudomtemivi (faDtmumo;t0aexnio3iatla elu snu)tltniocto1lat an o;() 2uo(m nydopeemfcsas)a2tru pnt4opeoio3iytfsDulnvo t4 lerir tadoptr neol()t2xmxopiudal  mnvslt)a2um(moot1tpe ii3iysfa2rmnmo ()altnmf ty1fm r iesl(  2tm(mpiy4lle mnesa() 2rm(mono1teeomfciytfs uanvont)aeeoxr io1lp rli slt srxo(r3oy4al elicsl()artrxmpnu4aex  feiad s rmump u) eeoxf3oy1lmDelu i t  2xrxm3iy4olenmnesas a2ta( pnt1alt ifeiatfmDel(mpn(4 lxoif3oo1fpte ueo;s) rumxo nu1lp  lietat  Durumooo0alenmiciyslaDem( s u) exoxo iadfpteaues;s)trtoxr nudlptemfvsl(fa2ta(m ;t0opxnmieiasfm2elnvs;u)teenir iatfatrai o (0s2xrio iu1lm n fvsl(fartm(rpno1tle mfciltlsDuluvo (4tlxoif oo1lm rlnvol()setr(mpnu4ope mnctlt) 2urx  ou0olenmfeiadla2ra(vo t)tlenxo tadoatean i;s) 2xr(opiydopenmfetltfa2rr(mono1opxnmf3tlsfa2el(vp t4trtrxf3iytlpDe i o ()s2um(r3iy4lltelict t aDrmx poo4oee micildls ul(ms;() exnmf3oatom  aies s0s2umxrpoo4lptnlneil(fs2tm(r nu0aee  f3ils a uau o;()aexrxo ta1fm raivs;t  2uoir oy1amt mnesatfarrrx  ;t4ape ifetlsls2rauvp t0trtoxf iadla elieslt0seuo(o ou1lltemnes (f rra(  no0oet io3iad s rl(mont)aexoxr tadoaDe nvi;()trur(r3oudol  lfetl( arrm(r oo4aexoii3tldlsDemnms t4 ltrxr3oatop   nvs t0s2toim iydomt mfciatf 2ua(mpoo4tet iicilt a2el(ms;u0alenif iadopt lieo;t srxrxo oy1om   feiltfsrtm(m ;u0aet iicilsls elnvp;t0 rtrmfciydom rlues;s) 2toio3ou1opte iet ()a2ur(m ou0oexnioeiys a uluvp;u0aetoxr3tadfmDrlu o t  rtmim oy1ape mncsat sDra(m no1oetoioeilslsDelnmont0alxomr3iotlpDeaivo ()s2umxm nu1ll nmnei t arrru  nu1optoioctasfsDean o;t) ltrmr3tatfaD ln s ( srxr(o nydlpe lnci tf rua(rp;o0tlx ifeiydfa2elnmp;u4 exnxocoa1lmDrlivo (0sexrxo iy4apenmietas  Dra(r oo1olenmociydfm2ea(vont0 ltnmo ootoa   ivs;(0 2xoio3oodamtemnei t  Drmu oou0tpen oeiydls2eanvs t)trerxf oy1la  anvs;()t2xo(mpoy1lmenmneil()srum(m ou1alt mi3tydfa2eauvsnt) leoio iytlpDr ivo;()truoim3oudame lfvtl() rtru pnu1olxo fciasfmDumums;() lenif3tatfmt  ivolt)srtmxm no4op emnct t sDtmxmo;u0optn f3iadfa2uaumpn(0alermf3ootfmDraues;( s2urxm3ou1ome mncs ( arta(moot0teenmo3iltla elums;(0 eenmr to1fpt aivi;(0 exo(opiodlmtelieilsfsDumx o;o4optnif3ildla uau snt4aleomfciadoa  au olt0 eum(rpnu4al nmietl(  ruaumpoo4aetoii3ild m2rl(mp;u)arxniocoydlm rlu o;(0trxr(r3iy4omeelfvilt)s2rrx pnt0ole mfeiatfmDem(mo;()aleoxr3tydfpteli i;(0 2uo(mpoodapeemneia(fartrum nt4aeeoii3tltfm2umu p;() lenmo ia1fptelieslt tetr(o3io1al emivta( arrmur ;u4tltnmi3iytlaDeau onu4tlenmo3oa1fateaueolt sexo(m3ny4lpte ieils  Dtau  ;o1oeeoif3iltlm rln s;t4artrif3ty1lateaues s0t2to(o ny4lpte net tfa2ua( pno0aeenmoeiydlm2uauvp t0 leoio ootfm elnei () rum(m3iu4lp  lfvt s sDtrxm ;u4olt  octatfa2uauvpnt4 leomo iydomt  iesl(  rxmimpiydalt lici s)a2trxmp;o0ape ifeiadlaDrm(mp (4arxomfctadlp eauvi (0teto(rpoy1lpte fcs t aDrax oou1apxnmf3tatfm2emn p;t4aeeoif iy1oat  neo t) etrir3ny4ll emnvsa(fsDtr(mo;o1aexoiociys s ea( pnu0 eeoxocoadfm r ues;s)teuriopiu1lmen fvtl()aDtmu  ;u0aeeoifciysfs ulnmsn()aeerxocoytlm  aueol()t2tmxo3oudamen fetat)aDurxmp;u0aee  fctatfsDua(ms;u4 reriocty1oaDe nvs;s  rxrxo iu4olte ivsl( sDuru  ;t0apen octatlaDrmnmsn(0 reoxfcootom elnvo ()s2toiopiydam e nct t aDrax pot4olt  oeiytls2ul(vs;(0arenmf ta1oaD anvilt0teurxo nodllenmneil()s2rmu o;u0texnmfctlt m2rmuvsn(4texrmrctadoat  u ols0t2uo(opiu1omtn fvsat s2tmxmont1opx if3iydfsDem( onu4trxrir3tadom e ivols)t2toxrpio4ap  mnvi (fs2rm(mpot4opx mociysfa em(vpnu4tetnxocoo1laDrai s;(0t2xoim oo1lleelfctl(fa2rrxm no1tpxniieiatlaDranms;t4 lerxo3oa1fp elivo;t)setmxm no4ol   neiasfsruru onu1optnmiciltls ulums;()tltnxr oytoateli i ()s2xmxm3io4ope mivt s sruaxront1apxn oeiadfaDrau s t0altnmr3oytlptr iesl( s2xo(m no1al nmneil()s2ra( o;u0aee  f3tltlmDrluvp;(4 ltoxr io1lptr n i s t2toxr3io4ome livtasfsDurxro;o0aeen ocilsfs rln o;() etoif oatfaDe ivs;t t2tmiopiu1ap   fvsasfa2tr(mpnt1aexomieiyd a2uanmo (4arxnxfcoytoat aieol( seur(opiudalt mnesat)s2ra( pot1tleomf3iydla emu ont) lxrmrcta1fmD  uvs;s s2umim oydol e fcslt)s2taurpou4aptn f3tadfsDum(vs;t0 rtoircoytfpD lnvs;()srto(rpoodllenmfeslt s2um(rooo1alxomoeils a umuvo ()aeermfcto1lp  livslt) rxmio3ou4lleelnvs () Drrum ;u4tpe ifeildfs um( sn(4tlxrio totlaDe ivsl(  rxoio iu4ole lnvsl(f 2ur(mpnu4olenmf3iatfs2ul( p;()trtnmo oadlpDr uvsl(0s2um(m iy4ol nmnctls)aDururooo4apxo iciyslsDulnvp;t4trxoxf iotlmtr nes s0srto(mpnudol  micils  2tr(ront0olx micild m rlnvo;t) reomfcio1lpt  ivs;t)trxrxr3oo1lmenlictas sDtr(mo;t0tpx  ictatla2uauvont0aetrir3iodlat  n ils0s2ur(opio4ap nlncil(f rtaum ou1tlx mfeiydla em(mo;u4 reoxfcoatoat lneo;s)trxo(o3nu1omt lieiatf Drmxmpno4oeto oeildfsDranmo;t)trtoir io1optrli sl(0srtmiopoydaleelietas  rtrxr ;u1opx iieiat a ra( o u)texnmr3tydfp elnvilt  eumir nydlp elfes (f rtr( o;t4apx mi3iys a2emnmont) lerxocty1lpte n i;(  2tmxr oy4ope  fviat  2taxrpno0apt moctat a uauvsnu4arxnmfciydfa rlu s;t0 2xm(o no1ame  fetat)aDrm(r ;o1tltniieiysfmDum(vp;t4artrxr3io1fpD  neo;s) 2urxo3ny1omenlnvsl(fa2rr(mpot0tpxnmictaslaDuluvo;()tlxoxr3iy1oaD aueo (0t2to(r iu1amt mietasf rurx onu0tpt ioetytls umuvp t0trxnio3oo1omDeaneils0 rtm(o iy4apenlicsas a2uaumoou1tltn ieiltla2rl(vs ()arxoiocio1oa rauvo (0tetmim nodam emfesl(  rtrumoot4tpenii3tad a rlnmo;t0alxrxocto1opt lieol( truo(o3no1lpt lneta() Dra(r ;o1oet moctld s2rmump;u4altomrcootopD aivi;t)trxmim3iu1lpe mfct t sDuaxrpot4apt mfciysfaDrl(vs;(4altrxo oatomt lieil( t2toxm io1alte ivt ( s2taxroou0oltnifcias a2umn p;(0artoxfciydop   uvi (  ruoxr3oodape mivtlsfsDraumo;t0tlxn fctls m2umn onu0trtrmfcoodfmteauvo;t)srtmxr3oudlm elfvi s)s2ta(mpou1tex iociys a2umums (0 ltnio3totlaD luvo;s trumio ny1al  mictls) 2tmu p;t4tlenmf3tadfa rmnvsnu4trtomrctadomD au i;()srtmxrpiu1lpte neia( arum(r no0olt iictatfsDumn snu)texomr3ty1lpD lnei s0tetr(rpiudlp  mfetls)srua(mo;u4oeeo ieiydls2emumo u)trtnio3oodfm eaivi;s srum(opno4al   ieil()srtau pnu4oltoif3iytla2eanmsnu4 eenxo3io1oaDeluvi;s)s2urxm oodamt lfvtat)aDrrurp;o0teeo octatlsDemumonu) lxnxo iadfatrlnesl()t2tmxrpnu1lltnlneil()aDrm(  nu0olt mfetadls rl(ms (4aexrif oydfat lnvs (  rxmxo ny4optemfes t sruaxr nu4tpe ifetasfaDul( s u) exnmo3iytoat au ilt)t2xoxo3nydal  lnvtlt) rta( o;t4tpenifeiad m ulnms;u4trxnmr oo1oa elu s;s sexmim io1alt livs s  rta(r nu0tleomfeiadfsDrlump;(0aetrioctodlmD ln s;s)sexoir3oodlptn fvtasfa2rm(rpnu1optnif3tltlm ua(msn() etrxo3iydfaD  uvilt0 eurio ou4amtnlfes t srrrxr ou0aet ioeildla ran s;u)altnxrcoatfmDelu ol()sexoimpiy1open ivsat)artru  nt0aee  fciyd aDea( s;u0 etnir oydla e n s t srxm(m iu1lm nlnvt sfsrtmump;t0apxomoetad m2rmn p;u)areoxfciy1omDeln i;( s2toio oy4ll n nct t sDraxm ou1ape io3tytlaDrm( pnt) reoxrcoy1lpDelivils0 2ur(m iodlpeelfctl( sDtauroou1apeomf3tytlm emuvs;t4tltrxr3oydfmt aueilt0srto(o oudlpen nviatfsrurx ono1optomiciysfa2rmuvo t4 eeoioctydlpD  i i;s) rxo(opou4op nlncsat  Drm( oot0tlx mf3iysla2rl(msnt4 eenif tytlp  lnei (  2uoim ou4am nlnvtat  2tmxro;o4tlxnioeiyd a rmn pnt0 lxnmrciadopDrlnei t)s2xr(m3io1ame micsas) rtm( oou4alt io3tadls2rmu s;(0trxnir3iadomt anvil()s2umimpou1am  mfvtas arraumpou1teenifeilt sDrm( s;u) rxnmociatfmtrlnvi t setriopoy1ome  ictat)a2tmxront4tpx  fciasls2rluvpn(4 exnio tatla e u o ( t2um(o no1lmtnmneta() ruaumpou1tpx  ieiat m rm( o u)teenmrciodfa raies s tetrim nodlm nmictasfaDtrur nt4teenmfeilsfa2rlnvs t4alxnxo3iadfate ieo;(0srxr(rpiu4ol n fctatfsDrmump;u4tlt mi3iydls2ua(vs;(4tetrio oy1lmDr n s;s)srtr(opoodalenmfei t a2umumpot0aexnmoeiltfm elumo;u)texomoctatlm rauvi () rxrxm iudop emfetas)a2tm(m nt0aeto fciat m2em(mp;(4artoir3ty1fp  lu s;(0 exrir nu1lpeelnvsas)s2rm( oot1tle  f3tas a2rm( o u4 ltrxf iadfaD lu il()texmir iu4omee icsl(f rtm(r ou1olx mociad s2em( p;t0 exoxo3oo1fm elneo s)texrxm3oy4llte iciasf Drmxrooo1alxn f3iytfm2ea( pn(4alxoir ootoaDelneilt  exrxrpnydap nlfvi (f Drr(rpoo1oetoioeiasfa umuvo;u0alerxo3ootopte n s ()setmxr3oodomtemicilsfsDurur ot0olt mo3iyt mDum(vs;t)tltrmociadlm eai s;(0 2xoio oo4lp  lnet t) ruax  ot4olxn fetlt s ul(mpn(4 rtnxo3oy1lmte u o t0srum(mpio4lm emictas)a2rrx o;o4tptnmo3tadfa eln p;u4alerxocoo1laDe ieil( t2xoio io4lpenlfvil(fa2rruro;t0ope  icilt s2emn s;t) lxoxr3oa1om e u slt)trto(m nu4lpen ietlt aDrax pnu0opxoiocias sDua(mon()tltoxf iodfpDr uvsl( trxrxmpiy4aptelies tfaDurur nu1oltn ictat s2ea( s t0aeenmo3ootom ran sls)t2urxm3nu4openmfcslt) 2uaxr ou0alx ifciad mDrl( o (0 lxnxo3tytfm elues ()tetrir iy1ome livtl(fa2taxrp;o1oexnmf3tltfaDea(vo;(4tltrxo tatom  lnvils) rur(r3iydlpt lneils)sDrr(m ou1apxo oeiyt m umnvo t) rxomrctatfp e ieo;t)s2xmim nydopt livsas) 2ur(rpnu4apt mieild a elnvp t) renir oo1oaDeluei;(0srtrio3ny1ale mfctl(f Dra(mp;t0oexomictadfm rmn s;u)aeeoxrcoo1omDe nvs;s0 eurimpny1omt  fci ( sDtr(m no4optomieiadfmDel(vs;t)arxrmr io1fmteai o (  eurxo3iydapenlfesasf 2umur no0tpt  fciaslsDua( s u0alenxf3tydom   u s;( sexr(o iu1op n nctat a2trxmpno1oeen oeiys a raums;t4aetoif iytopDean o ()setmiopoo1lmenmncs tfarrm( oou1oeenmf3iytfs ulumsn() rtoif3iy1fmDrlu i;( t2uoio3oy1alt lfeias) Dua(rpot1tpx mf3tyd mDrlnms;u0tlenxrctotfptraivs s texrxm iodaptelfcsasfa2urxrpnu1oleomoeiasfs raums;u0arxnxr oy1lpte nvols) rtrir oy1lmeelncsatf 2umurpou1teen fciasla2uauvsn() etomo3tadomteai s;() rumim3ny4lp emncs s  Dumxmo;t4optnioetyslmDrln ont0 rxnmr oo1fmtr ivs;s0seum(o3iu4oltelfcta()srtau  ;u1opx  octltfa2eanmp;()aleoxr todom  aueol(  2xmxo ou4apee iet sfaDtr(mp;t0oltomf3iasfa rl( s u4 exnxr oa1lm eluvs s0srxm(r3oodlle mivi ()aDrm(m oo4apeo oeiyslsDrmu o u)teerxo3oo1fa  luvo s0 rtr(m oy4al   iei sf Durumonu1tptnmoetldlm2eln s;t4artnxr3tadoaDran o;()seur(r oy1ol elfvi (f 2urxro;o0tpe iieilt a eln o ()trerio3ta1faDraueo t0srtrxmpio1olenmiciasf rumx ont4oexo feiyt a umnvp;t0arxoxr iy1oaDeaues;( t2tr(opio1ol   nes tfs2uaumo;t1aex  i3ias aDemnms;(4tlenmfcta1omt li ilt0 rtoxr3ou4am elfvias s2tax oou4tetniociys aDrmn snt4 lxrmfcootfmDelues (0 euoir iu1lptnlfcsas)aDum(mpot4tet mf3ias aDel(vonu0 lenxf3oa1optr iesls0srtrir3oo4olt mies (f rrrump;t4tpeomicilt a ea(mo t)teenmr tatla rlieslt0 rurxm3oydapt lictasf 2um(mpoo1apxnmieilsfs2rmn s;()artrxrcoydlmt au o;s)t2xm(r io4lmt lfvsatfsrrr( oou0olx miciatls rmumo;t4aetrmf iotfaD  neslt)srtmir ny4omtemivt t a2trumpno0tetoio3ilsls2uluvo;t)teerif3tatlatrauvo t)t2xrir nu1lm emivsas) Dtr( onu0tlxnifciys m2rluvs u4 rxnmrciydopt liei s0srxoir ou4lpe  fci t)arum(rp;o1aptomf3iasls2rm(ms t)tlxrxfcoytfptr u ils0 eum(rpny1lp  lfet s) 2rmxmoot1aeen octltls uanvp;t)teermf oatfm   uvo;(0t2umxr nodalte ivtlsf 2ra(  oo0opt  iciydfs2rlums;() rtnxo to1faD auei;s  ruoir ny1lptn ieta( sDraxmonu0tpeo oeiyd m2rmnmp u4 reoirctydomDrli s;(  2xm(r3iy1alenmfct (  Dtmum ;o4aex mocilsfsDrau s u4 eerio3todlatrlieo s0 rxmxopny1aptnliviat) Dtmum ;t1ole mieiydfa2umumo (4trxoxf oa1om   i i ()setrxr3iu4altnlivs sf Draurpnu4teenii3iatfs2ranvo;u)arxomr ia1lm raueils0texoxopio4llen icsltfsDtmumo;o0opeomi3iys a2ua( o u)alxoio oy1lm e uesls0 euoir3nudllt livtl(fsrtaxrp;u0aee mfeiysfmDrau s ()trtrmfciydlaD  uvilt  rtmxo3oodll emictas)srua(rpnu0oex mi3iydlaDemn o;u0tetnmfcootlpteai o t tetoxo oy4amtnmiesas)a2tax  oo0olx iieilsfm2eaump;t) eeoiociy1lp  an ilt0t2uo(opoy1lp  mictasfaDrrxronu0tpxo oetatfaDum( pnt0trxoxo to1fm elieolt s2urir3oy4lpte ivsa(faDumumpnu1tpto ociat a uluvs u0tleoxf tytlpD lieslt  2tm(mpoy4lmen fesat sruax o;o1olxnmietldlm rmnms (0alxrmo3oadop rlnesls0tetrxr iy1op n nctltf 2urx pot1aee  fciyt sDeanmp u4alenio oatopt  i s s0t2tm(o oy1lm emfvil(  2umu  ;u4oeeo ieiytfmDumu s t0trxrmr3ia1lmD au o;(0sexriopnydaleelfvtltfsrumxr no4opx  i3iatlm ea(vp (0texoirciatlm eaneols trxmxm3nu4ap   ivia( aDtaxmo;o0olx  feiasfs um(mpnt4 eeomr3iodfmDrauvolt)s2tmxo3ou1ap   neta(faDururpno0aleo oeiyslsDea( on()tlxomfctydfpDeanei;( sexmir3ou4aptemieia( a2tax p;o0oetn ictyt s2umu p (0trtrxocoodlmtraiesls  rtrxm oodol nlnvt () Dtaxm ;t4oleomf3iat a uanvs;t0altomfcoodlatr nvslt  eum(mpiy1ll  lieil(f 2tax  ou0aeeniocildlmDrlump u4aeenio3oydfpD  uvsls)setoxopiy1ll emnct sfaDum(rpnt4apxnmictyd m ul( snt0 lenir ty1oaD auvs;( s2uoxo iu4ll elfcsl(faDrm(mo;o1apeo fetas aDrlnmonu0tlermrcoa1laDrauvils)srtmim nu4lpenmfeilsf rrmx  no0olt mictltfa2elumo () ltniociydoa  aies;()t2urirpiy1op  mfesatfaDrmx  ou0tpxniocilslmDea( s;t)alxomo totfpD ln s;s0trumirpnu4opeemnctasf Dra( oou1tetoiieils sDuluvsnu) ltrio to1oaDr n s (0seurimpiudolen fvt t a2umxm no1ope  f3iad aDemnmp;() etomr3oa1lmDr ies ()t2xm(mpiudalen ivt ()s2trxmp;u4aet ii3ilslsDrm(vsnu4alenxr3totoa rai i s0t2umiopnydop nmfes ( arrmur oo0opeoio3iltla2umnmon()alerxf oo1faDr ies (0t2trxm ny1ap emfctls  2uauro;t4tpxn octld s2uluvo;(0altnxo iy1oa  ln s (  2xo(o iydamte ieilt aDtau  ou1tltn ietat mDrlnmp;u4tlenxf3iotlaDr uvs ()sruoim iu1omenlnct ( a2tau  nt4tpx mi3ilslm2em(vo;t)arerir iy1fpD  ivi;t s2umim3iu4llenmfeias)aDrmum ;o1ole ifeiyt mDuanvs;t4aetomo3todfa   iei;t)t2urirpiy1op  lnetls sDtmu pnu4aeeoif3ilsls2rlnmp;u) exnir3ty1lpt lnvs;(0 2triopnu1olte nctltfsDra(mono1altomf3iyslaDrmuvs (0 lxnircio1fateauei;(  rxrio3oodllee fvslt a2uaurpnu0aeeomoeiadfa eaump;u)aeerircoatfmDe iei s srxrim3nudal emnetl(f Dum(mpot4oetniieildls2rmn p (4alxrxfciydoa e nvi;t s2xmxo ou4optn feia(f Drmxrp;o0tex  o3tadlm rmump ()texnmo oytlpD aivs s0 etm(rpnudop  mfet (  rtaxmp;u4tlto f3tatlm2uanvo (0trermf ia1lmt lneo;(0trtrxrpio4amee neta() rrmxm ;u0apt iietyt a2rm(vp t4altrir to1lpD  neo () rxoim3ou4oltelnet t srtruroot1apxnifciltfm rl(ms;t)tltrmr3iy1fpt lues s0s2uo(rpoo1apenlicsatfa2urx poo0tet ii3ild m2ran o;(4tlxnir oodfmDrli o t)setoio oo1omt mfvilt aDrr(r no4alenioetldfmDulnms t0 ltomrcoo1laD  ivils t2um(m3iydamenlictas) rtmu  ot4texnif3ildfa2umuvp () lenmrcty1la elnvi;(  etoio3ou4amen ivsltfsDumxro;t4apxnmfcilt s ulu p;()tltomf3tydfmD lnes;s s2urxr iydape lfetatfa2raurpoo4tleoiicildlm rl(vont0artrifcoa1optr ivs t0sexoxo oydopeelnvtat)a2uaurooo0aex moctasla2emnmonu4 eerifcoa1oa r ieslt sruoxr iu1am e ncs ( a2umxmo;o4tlt  oetadlaDrmump t0tetoircoa1la   ivol(0sexmio io4olt mfesatfaDua(ro;u4tlt ii3tydla ul(ms u0 rermr3ty1laDrlivs;t srtoxopny1ame  fvia(f 2ra(ro;o4tpeomf3iatfaDrmnvs t0 eerxr3oy1lm elu i ()t2trim io4om elnctls) Dta(mp;t1aptnifetys aDrauvsn()altomo iy1fpDe neol( setm(mpnu4op n neia( sDum(  nt0olx if3ias mDrln o;() eenxr3io1lm eaieo;s0 2xr(o iu1om nmictlt artmumo;t1oee ii3tydfmDrlnms u0arxomf3tatfm  au o t tetmiopoo4ll   fciat aDraump;o1tpxnifctydlmDraumsnt) lenircoydfmD livols) eumxr3ou4amtn nvsl(fa2ra(rp;t0aexomoctyt s2ulnvsnt4 eenifciotfpt aieols) 2urxrpiy4oltn nvi sf ruaumoot4tlt  fciyt s2ua( o t) renxf3iytfmtran ol()trtr(m oodope licsa(f Drmum nu1optnmi3tadfm2uaump;t)arerxocta1faDe uvo;t0sexmir iu4lpeelfcslt  rraxrpno0oeeoio3ild a rm(vo;u)trtoxo3iydop eli i (0s2xo(o oydoltnmict s  rum(r oo4alenioeias mDel(mo t)aeenmr iytoptr nvsl( teurxo3nu1alt  ies s)srtr(rpot1tpxnmi3ilsla rauvs u0altnmrctytom   nvolt)t2trio3nodop elnvslt  Dtr(m ot4aleo o3iat s uau o ()texnmrcootfmDelnei s t2xr(r no1olte ieslt aDrmu ont1tptnii3ias sDrm(vsn()texnio3oodlm   uvslt0t2toxrpiudapt lnvsat)artmxm nu1tex  feiaslm ranvo (0teenmociatopteanes (0t2tr(opoo1lleelivtls) rua(r ou0opeomfetas mDua(mpnu0trerxfcoatomD luvil(  rumxm ny1open fcsl(fa2raurp;t0teto i3tydlm elu snt4artrio ta1fm rlieo;(0s2xrirpiudlptemici tfa2um(mo;t4oeto f3ilt a ranvp t0 reomr3oodlaD  nvilt0 etmxr3nudlp nlicta() rta(mp;u0tex ioeiltfsDum( o;(0 lxrmr3iodop elu sl()teumxo oudop  mfeias)srtaxront0alen i3iysla2rm(vonu0 rxomf iy1fa  lieslt0texrxr iy4ll nlfvil(  rrmu  ou0ale ioeiydlsDra(ms ()tltomf3tydop  
\ No newline at end of file
@@ -0,0 +1 @@
+ieo (0teum(mpoodop e nvi (f 2uaxmo;u4tleoioctldfa2el( pnt)aexrxociodop  lu olt0trumxr nu1am emieil(f Dta(rpoo1aetnmo3iytfm em(msnt) exrxo iatlmD an il( trxoxo no1am  mnci ( sruax  ou1aleo oeiys sDrlnmsn(4artnmo3to1opD  ueilt seurir3nodoleemietl() 2rrxrooo0tltnmieiadla uanmp;u) rtomo3iatom  li ils0srum(m ou1oleemfvslt sruau  ot4tpenii3ildla rlu o u0 renmf3oydfptr ivolt s2xo(r ou4ape lfvil() Dumx  nt4alenmfeildfmDumu sn(4tetoir oydoptean ils  eto(o3iu1lm nmivt sfaDtmur oo0aetoiietltfa rmu o u)tetomfcoydlpDrlues;( texm(mpiy4lm  mnet t  2rm(ro;u1tpen ictls s2el( s;t) exnmo3iotfmtr n sls0 rtrir nydapee fciat)arum(ronu0opxomfetltfa2ua(vs;u)teenmrcoa1oat lu i;s  etrim iy4lp e fvil() rraxro;t1opt mfetld sDem( sn(4tleoxo3iytlp  ai s t0t2tmio3oy1omeelicias  Drrumooo0tlxn fetlslmDrluvonu0 renxf oo1opDe i o () rum(r nodopenmnetlsfs2rrxr nu0ope mietys m2umu o;(0arxnmocoadlp   ivs;s0trtr(o3no4ape mivsa( s2rm(rpno4oex  i3tytfa uanvo u)alxomo3ia1lm e i i t setr(r iu4amtelfesa() Draxr nu4aptn ietaslsDra( sn()aleoio iodfmDeli il(0sexr(o ny4apt  fvtat)sDtmxrp;o1tee  f3iadfm2ea(mo;u0trxoifctatlpte ues;s trtrir oy1oltnlicias)s2trx  ;t4oleo f3ildlaDum(vo;t0alxoifcoydoa eanvsls0 rxmxm ny1ap n ivt s  ruau ont0aptomieiysfs uaumsnu4tlxoir iydop  an o;s0trxm(rpiodap elfvtas)srraxr ;t1ope ioetyd s2uau onu4aexrxr3iatfpDeai sl(0 2tmxmpoudom   nctl(fartmu pnt1alxoiietlsfm ulnmp;u)altomr tytfmD  i o s0 rtmiopnodamee icil(f 2tm(mpno4tpx  ieilt m2raumonu) leoif3iydoate u s s) 2tmxm3io4al nmicias)s2ur(rpou1oltnio3iydls2eanmp t0trenioctotomD  neol() rum(rpny1lp nlfeta( srtru o;t1ale moeiysla2raumonu0alxomrcta1lptrauvols)trtm(rpiu4al n ncs () 2tr(r nt1teenioetatfs ul(ms;t)alxnxr todfa r nesl(0trxr(o no4al eliviasfarumx  no0aetnmo3tytfa2ea(mp t4trxriocto1fmDr nvs;s)trtriopio4lpte nvsa(fa2umxm ot4oeeniiciadla ea( p u4texrxo3iodfat au i;s srurxrpnu1ol nlnes () Durxrp;u1aet mietldfs2rl(mp (0trenxo iytfmDelivil() etm(o3ou1apte fes ()aDra(monu4ape  fciytfsDrmn pn()trenmf3iodfpDrluvi t)t2xoio nydaptn feil(f 2rmx ono1tptnmoetasfs2rau pnt0 lermo3oo1oaD  n olt0s2toim3nydam  lnvt ()s2rau  oo0apeoii3iaslsDrauvont0tltrmr3iytfaD lnes;s)sexr(opny4op nlnvsat a2tmxrp;u1olt  feiasls ea( on(0tetrio oo1fa  aueilt setmir oo1lp e fvia(farua(mp;o0apeo feils m rmu o u0 exrir iy1laD ln s;()trto(r oydllen netls aDtm(moot4olxn f3iydla em( snu4aetomo3oy1laD  n il()s2xo(r3oo4oltnmfei ()srrr(rp;o1oltnio3iasfmDrmums u0texnmocty1lpDeluvolt0trxr(mpiu4op nlfct sf ruaump;u0aexnifctatfsDemumonu0aetrmo oa1opteluvi s) eurio3oudlleelfct s artrumo;u1aeenmocias mDuan p;u4aeenmfctydla raneo;(  rumio3iudop nlietl(f ruax oot1ale iictlsfa2elnvp ()artnxocoytfmt  i il()trxrxm3nodaltemfvtat) rra( p;t4olxn o3iltlm2rmnvo;(0alxrxr tydomtrlnei;s0 2xriopoy1am nmicia(fsDra(mpno1aexn ociasfm rm( p t4tetnmo oodoptrauvs;t0texmirpny4lp nmiviat)sDumxmpno1ape miciaslmDeln s;() rxnxf oy1omD auvs s  etmio3nodllt lnvilsfs2uax  ou0ope mi3iytfmDrl(vonu) lxnxr3tytlmDelivol()trxm(opnodapenmnvslt s2tm( poo4apxo icias a rlumpn(0aetrio3tadlpDrlnvsls setmxrpoydole lncils) 2ra(rpot4tpt  fctysls rln on(4aetnirctotfm eai o s srxm(opou1oleelivs tfs2tr( o;t4texnmoeias s2elnmpnu0 rerircoa1late i s t0s2xm(r3nudol n nct sfa2tr(rp;o0opxoio3iasla2umums u)alerir oadlp eli ilt0tetoirpiodlp  mfcsa( s2trumooo0oex mfciltlaDumu o;t) eerif3tytlat  n s (0 etmxr ny4omenlfvi (farurxmono4teeniietyslaDel(ms;u4arxoifciadoptrlueils) eumxmpiy1omtemnvi t)a2taumpot4aeeo f3ilt a rlu p;u0 lenxf ty1lmDean i;t  rxrxr io1am elnci s srumxmpot4aexoifctldfa uanvp;(4 etoxrcoatlpteli i s0sexoiopiu4lp   nvsl(  2ua(mpou4tle ioeiytlaDrlnmsnu0 etoxr oytlatr neil(  2toimpiodom  mfesa() rrauronu4teeoiociasfm um(mpn(0 lenmo tydomDrli s (  rtrxr nydaltemnvi t a2ua( poo1ole mo3iasfm ra(vp;u0teenmocoytfmDrai ol(0 2xoxmpiydamtemnesas)aDuaxmo;t1tlx iociyd m2ra(vs ()artrxociodfat luvils0 2to(m iodom  mfvs s s2ra(m oo1tlen o3iasfs2ua(vo u0aexoxr io1oateluvs;s  2xmxrpoydlm e fvilsfa2uax  no1opt mi3iyd m rauvon()alerxfcoydfm r u ilt0tetr(o oudllenlfctlt a2tmu p;u1altn icildfm ean o;t4trxoir io1lmDr ivil( srumim ny1omt lfvi t)sDtru onu0oleomociytla ea(vs;u) reoioctotfmtr nvo () eur(o3oo4lpenlnet t a2rr(mp;u1tltoioetyslmDrluvp (0alenirciodom  aivs;() 2tr(mpiy4alenmfvslt srumurp;t4tpto f3iytfm2raump;t)trxoifcootomt auvs t0trxoxr3iudam  lfetls)a2taumpno4tlx iociatfa eau p t4aexnmo iadomt  i s ( s2toxr3oy4lptelncias arua(mpno0open o3iad s2eaumsnu0tetomfciatop ran ols srxoxmpny1ap elfeiltfsrrm( pnu1olenmi3iysla2ul(vp;()artnmf3io1lm r ivs;t tetoxo io1ale lneilsfaDtmu  ;o4tlx  feiadfm2emuvs;u)tetrmfctotla eanvolt) rxmxm3iy1lmenlfet s  rur( pnu4apt iociltfmDeluvonu0 etnxo iodomtrln o ( srxoxrpno4lp e feias srrm( o;o4aetoioeiytls eanmsnt0trxoio3oa1lpD aieols  euoim iy4lm e ivilt)a2umu pno4aeeo ocilt mDuaump;(4 rtoif3oo1fpDraivo;()srxoxmpiodom elietlt)srtaxrp;o0apx  f3tlsfs ulnms;t0arxniocio1omte uvs;s)trurxr nydaleemfesl(fsrumum nu0tltn ieiyd a em( o t4 eenmr3totfpte neils  2xmxm3oudll n fetat) 2tmu  ;u1apen fctatla2rm(vo (4arxoxr iotlp  luvil()sexrim3nudamenlnct sf Dta(roou0oexomo3tltfs2emnmpnt)arxnxfcoa1fpt lues;( seum(o io1alenlfet ( a2umu  oo1tetn ocias m emumont0 eenxrciydomtr n i;() rxm(m3ou4amt mieil(fa2trumpnu4aexn oeiat a2rmnvp (0tlxnio3oadomt  nvi;(0 2xrxr3iodom  mieiatfa2uaump;t0tet  oetatlm2rmn o;t)altoio3to1lpD luvslt)setmxr iodam e ieslt)aDtmxmpno0optoiociydfaDeaums t4artomfcoo1faD au i s  2uoxo3oy4omeelivsltfs2taum ;u4olt moeiatfs2rlnmo;u4 rxoio iodfmDelu ilt srto(r nydol elnes ()a2ra( o;o1olxnmieiasfa rmuvp;u)alxoxr3tydfmte uvi (  rto(opiydam emnvil() rumxrooo1oetomfctatfs umu s;()aeenmrciytla r neo t  2ur(r iydomt mfeiasfsrumur no4apeo f3tat m2um(ms t0aetrmf3oytop raueslt sruo(m3ny1optnmivi () rtrxr nt0alxoiieiyd s2ran s t0 etnmo3oytfa raivil( srtmir no4al  lictl(fa2ra(  nu1olenmfciasfa ea(monu0tlxrmo oy1opt aieo;t)tetmxr iu4lmt  icia()a2trxm ;u1aeenmiciytls2ran s u) etrxrctadlpt aieo;s s2tm(mpny4ameemietat  2ra(ronu0ope  oetlsfm2ra( s;(0alenxrcoydfate ivs;t)t2tm(m3iu1ome liet ( aDtmx pnu0apt  ictydla rmnvpn(4 etnxf oydfm  aneil( trum(o3iy4ol  miet s sDrm(  ;t1tee  f3iytls eluvon()altomf3iydop eai olt0texoirpou1ap  lnci s) rta(mpno4olt micild m2rl( on()tltrxo3oytlate ivo ()t2tmxm3nu4opeemnetlt)aDtmx oot0aetoiicild s2rmu p;t) lxnif3iytop rlivolt) euoxm3nu4alt  neiltfartr(mpnt1ope mo3ils m eluvo;t) lxrmfciodom elivi;(0 2umxrpio4am   ncs s  2um(r ot4tleoii3ilsfm ulnmon() rtnmocoo1oaDraues s)sruo(m iudoltnlnviat s2uaurpnt0olt mietyslaDuln p u0arxrif ta1omDelieol()seto(m ou1olt mncsl( a2rm( p;o1olt  ociat aDranvpn(0tlxrxr iytlmt  ues t seuoirpiodol   fesatfsrum(mpoo1tlxomo3iatfsDuanvp;t0trenmo3oa1la rlues (  2ur(opnydllee nct () Drmxrp;o4tlxoifetld a ul( onu)alxrmr3oodoptelnvsl(0 2ur(o3nydlle mnct s)a2trum ;t0tleoif3tatls emnvonu0 rxrir3oy1fm  liei () rtr(r3iodalte netlt)aDtrumpnt1aexnmieiadfa uluvo;t4aexnxf ty1oa rliesl()sexoiopny1aleemiviat) rtmxrp;o0ope if3iltlm rln o u) lenir iotom raueo;( t2uo(m3ou1lpt miesat) Drax pot1opx  feiat a2rmuvonu)tlxomo3ootomtelu ils0 exoirpnu1opte nctltfaDta(  ou1oexnifcilsla rm(mp u4alxrir3iadfa eaueo s srumir nydopte ncsltfa2tau  no4aetnifeiytfmDeanms;t4aeenir iotlaDelnvs t trum(r ou1am   netl(  rtr(r ;u4aetnmf3iyslsDem( pnu)arxnif tatopt lnesl(0 eumxr3nudape mnvs s srrmx pnu0aeeo feiydlaDra( o;u0teerxfcoa1la  aneol(0s2umimpio1lp e fci s  rtm( p;u4opeo f3ilt s2ranms ()treoir3oydla ean ilt0texrxopoydop nmiesat srum(rp;t1oleoiieilt sDeaumo u)alenmf3oatomtran ols truoimpnodlle lfvil(fsrtm(rpnu1optnmociad s rauvp ()tetrir oatfpD ai ol( srurim nu4amtelnvsl()sDtmxr ;t0oeenifeiyt m2rl( p u)tltnxr iadfpte ues ( tetrxr iy1om  mfcslt  2tmur nt0aeeomfeiat aDranmo (0 reoio3tydfm ranei t0sruo(mpnudaptemfcslt)srrrurpnu0apx  fetldlmDrmn snt) eenmocoodfmD  ivilt tetmxrpiodole mnet ()sDumu  no4ale ifeiatfs2uluvo u0alxomr oy1oate ivs s)s2uo(r oodop emncta(f rra(m nt0olx miciatfm2umumo;u4tlerif oadoa  an i s teuoirpoy1oleemnei (  2raxm ;t4altnmoetlslaDul(ms ()tlxomr tydoa rli sl(0 rtrxm io4ome lfvt t)a2um(root4openmf3taslsDrm(mo t4 ltrirciytom r uvs;t)trtm(mpiy1am elfeiat s2tm(mpoo0tetniietyd a uan sn(4texrxr3ia1lp ranvi s trur(m ou4am   nvils  rur(moot0oexomfctltla eluvon(0texnxr iadfm  anes;s  rto(m oudll  mivtasfaDta(root4tex mi3iysfs2eau sn()texoxfcoatop r ues s  2xrio nu4lp nmnctl()s2urur ;u0oexomiciyslsDem(vp u4aleriociytoa e nei;(0truoxr3oudale mnvt t) 2tru oot0tpe mfciytfa2raumpnu) etoircoatom rlu sls  rxm(r3iudomeelnesa() rrru  nt1oee  f3ilsfmDulu s t4tlerif oatom  livo (0s2uoxo iudaltn feiat  rraxmpoo1oex ioeiyd a ea( snu)aeenio ootopt  i s s  rtrxopoodom elnes s)artmu o;o0olxn f3tlslsDul(vo;u4trerxr oydoatrli o;t0 exm(m3nydapeemfvia()a2umum ;u4apxnmoeiyslm em(ms (4altoxo iydfaDeln o;t)srtrxr oy1lmt  fet (  Duauront0aet io3tld mDeauvs t)tlxnmrcty1fp elneo ()s2uoxo ny4openmfvs (fs2urxmpou0tpx moeiadlm2uanmsnt) reoifctytla elneilt)t2urxm3iu1lme mnetltfs2urxrp;o0aetnio3iasfsDemn ont0trxrir3to1fatrlnei (0 2toimpnu4amt mfeils) rrrx ooo4tetoiieiaslsDemump t4 lermo3iadlmDrlu s;s srurir oodll   fcs () 2ta(mooo1oetnmiciytla el( sn(0aetrxo tatlp eai s t t2xm(o3oydlltnmfesls) Drmum ;u4tleo f3tydfa2ran s;(4tltomf3iodlp raneo;s  rxmxrpiodal   ivtls srrrxmpnu0optnmi3tltfm umnvp t0trxnmrcoa1fa elieo (  eurimpoydoptelfvil()aDraxrpnt1ale mfctat a rlnvo;t)tetrmfcio1lpt aueslt)sexo(mpiodlpee net (f Dtaurpno1oexnmf3ildfm ua(ms (0aetnifciytlmDrai olt  ruoim nudllen icsat a2trxmont0alx if3ild s2um(mpn() eeomrcoydoatrai i;()srxmxm3ou4amee fctl(f rurxmp;o4aexn ieiyt s ran p;u0altnxf3iy1oat  nvils)trur(o oo4oleemnctatfs2ur(mpou0apenifciyd m ua(vo;u) lxoxo3todopt lu ils setm(m3iy4al nmncia()arumx pnt0aleo feiydls2rmnmont4tltoioctatfa  livolt)s2uo(m oy1ol nmfcilt)srtru ooo1aetomictaslmDeln ont0 eerif oodopDranes;s) 2xmirpnu1opeemnes ( aDraurp;o4teeomiciyd m2um(mpnu)arxoircty1lpD  nvs;s) 2xoxopoo1op   ivt t arrru o;u4apenmf3iydfaDuanms t4 eeoxf3iodlmD aivol()s2trxopoodam  lfes tfarrr(m ot0tpt  o3tadlm2em( o t)trtrmrctadopD  n s;(  2um(rpny4lp  lfcs sfs2tau  nu1tpenmi3iatfaDra(mp t0 rtoir oodlmt anei;()seumxmpny4lpenlfes t  rurxm ;u4tpe moeiyd mDul(ms;()arxomf iytla e n s (0seumxopno1lp   ncias sDrrur oo1aleoiicild m ea( pn(0 rermr3ia1om   n i;(  2xrxr iu1amtn nctat s2ua(  ;o1opx mociatfa2rl(mo u0 etrxocty1op   nei () 2ur(o oo4omee nctatfa2rr(r nu1aeeomi3ias s2ulnmont4tlenif3totlmt livo;s0trum(opou4ll nlnesa( s2raumpnu1apx  fetyslsDrl(mp t4tetrxrcoa1fatrlnes (  exo(opnudom   nvsas  Dumxroot1ape iieiatfs uanms u)trtnxf3oodfmte ues;( s2umxo oodlpe  iesa(f rrm( o;u1alto i3iytfs2rmuvs;t)artnifciadlpD lnvi;t0teuoim nudlpen fct sfsDra(  ;t0oet  feilsla elnvpnt4aetrxf iadfp   nesls teuoxm3oy1lmee nvtlt  Durxmont1apeoiieiytfa elnvp u0 eeomr3totomDrlivs t)sexrim3nu4om e fet (  Dtaumpoo4tpxomieiad aDumnvs t4areoxf oadoa rau o;t0srur(mpiu1optnmnciatfs2rau pno0tpx  fciys s2uln s;t4aexomocootfpt  ueils0tetr(m iu1olt mics t) rtrxr ;o0optnmieiytfs2rmu s;t) lxnmrcta1fpDeaues;t  2urxo iy1lltnmicslt)sDumxrpnt0alxo fcils a rl(vp u)aleomf3oa1lmtrlnvolt0 rtmirpnydlp   ies s a2tm(root4opxnifcias mDrm( snt)artomrcty1latelu i s)seum(o nu1olt  fcsltf rtru pnt1tltn ictas aDrmnvsnu0aeermf oytoat aivo t)trumxm ou1ll  miesls arumu p;u0oetnmoeiasla elnmpn()tltomf oatfaD lnesls)srxm(rpnu1om n netas)arrm(  oo4tlen feiyd aDem( p t)arxnmocio1lptr n ols)t2tmiopoodameemneta()aDtau oot1aexomf3tldls eanmo;t)tltomf3iatfaDeaneol( srum(m3ou4open ivsat  ruaxrpot0aet mocils m2eau o;()altomo iydoatrln olt0 rtmim3io4oltemivtat aruaxr ;o1tlen fciasfs ranvpn(0 exnmo3iydom r nvil()texrxopou1apt mfetls)sDtaxro;u1olxn ietys sDea(ms u) rtrio3iydla e neo;t)truo(r ou1ol n nvi t)sDrrx ont4aee iictysfs ua(vp t0tlxnmr3tatfate ivsl()t2toir3io1apt mici s  2tm(rpou4tptoif3iys aDrln p t0tlxoxf tadfmt  ueo;()texmxopoodapt lieils  2ur(m nu1aeeo feilt aDemump u4artoio oatoa rli o;(  etmim iu1lleemiei tfaruaurono1tee mfeiys aDul(vs;u4alxrirctatfm raiesl(  rurio3oo4lptn ivs sf 2taurp;u4tltoifetldfa2rl(von(0 renxr3iodop  li slt seuo(o iodllt  fcs s) 2trump;t4tpeniieiatfa rauvo ()alerxo3iytoa  an o;(0srur(o no4ol nlictl(  Dur(mp;o1apenmociyt a uaums;u) lxoio oatoateaiei t0s2xr(m3oudam  lietas) rrrumoot1oltnmf3tat s2ea( o;t4altrifcta1la ean i ()seto(opoy4ap   ncta(fsDumu ont4tpeo iciysfm2em(mon(0texomrctatfp rln s;t)sexm(rpnu1lmt mnes tfsDrau  no1apt ifeiydls ra(vp;u4teeoiociytfatrlivolt trxmxo3no1olee ies s arra( pou4tet iieildlsDranmo u) lerxociadoateau s t srumir nodlptemnvta(  2trxmp;o0oee mocils m2emn o;(4 rtnmf3totlm eauvs t0 rtr(m3no1lle lnvtatfarur(monu4tptoioetldfa ua(mo;u0arxnir iytopD livsl(0teur(mpoy1al  lieils s2rau  ot1altomieiltfa2el(vs;u)altnifcoadfmt lues;t)seumirpoodlm   fetatf Dum(m ou4oetnio3iydls2el(mo;t0arxnir3oa1faDranvs t  2toir iodlptemnet s)sDrm(mp;t0tle  oeiltlm2rlu s;t0 exomfciadom e i sls0teuoir nu1omtn fesltf Draxrpnt1optomo3tltfs2ranmpnt0aleomoctotom e nesl() eum(rpiodalt  nvi s)sDum(  ;u1aex io3ias mDrlnmp t4treoxr tatlm rauesl(0 etmxm3iudlleemfvsa( s2tr( oou4oee  i3iasla rl(vp u)alerifcio1lmt ai o ()setr(rpno4op emfvta() 2ua(rpnu1alenmi3tadfsDrmuvont4 reniocto1fm r u i s0seuo(r3ny1lp  mfci s  2urx  ot0olxn fciytlmDemump;u)aexnmf oydlp e neo;s)sexm(o oy4lm elneiatfartmxrono4olt iicias s rmn o;u) ltoxoctydfp eaivs;t) eumxo iy4al  micia(fs2tauronu0ape  f3tadfs ulu o;t4 lerifciatopte n ols) rumirpiy4olee fvt s arurx pot0oetn o3tas a rlu s;u) exrxfciy1fmt lnvils0 2xo(o oo1lmt  iesl( aDrru o;u1olxn ocilt s umu ont4arxoxr3oodfpteaues;s)trumxr ny4ll elieil() 2ra(r nt0alenmictatfs2rmn pnt) etnmo oo1lp  an s ( srumxrpoydapenmnvia(f Duax  ;o4tpeo fcildfm em(ms;()arenio oydlatr nvi;t0srtrxm3no1ll  mnvsl(faDrau pot0oltomo3ild a emump;u)tetoxr iatlptraivolt)srtrirpoy1alt  fvsat a2rmxr ou4oleoio3tlslm ean o;u0 rtrxr oytfatr nvo s)trxr(o3io4alte ieiat) rtax pot4apenmi3tld a2rm(vp t4 etrio3oytopDrauvsl(  2umim3ou1amt  nes ()aruaxrpnu1optnifctatfm rl( sn(0 lxoxrcootfa   ieols0srtr(o3oy4open fcta()a2rmxm ot1apto ociys mDrlnmpnt4 exnmf3totomD  nei;t)srumxo3oodapenmnvt () 2rax  nu4opto o3iadlm2ea(vp u) etoifciytfmDelieslt0setm(m io1omt mfcs sfsrtr(m nt4aexomociydls um(ms;u0texnir io1lmD livs t) ruoxm3iu4lptnlneil( a2rmx  ;o1apt  ieiytfm2rlums u)tlxoxr3oo1la eluvo (0 exrxr iy4alte fei t sDrmx  ;o0tpt mfetat m2uluvo;t0trtoxf tytfaDrauvilt s2xm(r iu4ap nlfesa()aDra(r ;u0oexn iciysla2rlnvp u)trxnmo3ia1fatelieo s)srxrir iy1al emfvsls) Dum(m ou0opxn feiyd sDrl(vs;t0areoir3totlp ean o;s0 rumir iy1llte fci t)sDtm(m ot1tpx mf3iad aDelu p (4trxnxocoatlmDrlnvs;(0 etrimpoudomtnmnci s sruaur ;t4oee  i3iad aDrluvs;t0 rxnmo3iytoaD livils teto(r3iodamt mfciasf rrrum no4aexnmocildlaDra( o;u4tetnif3oatfm e nvi;t  2xr(o nodom elfvs s) rta( pou4opxomo3iydfm emumo;(4 lxrxrcoadom eaneils teurirpoo1lp e ncsasfa2ua(roou0alt  feilsfs2ulnmo;u)texoir3oadfa  lueols)trxoio no1al n nvias)a2umxr no1oetnio3ildfs2el(mon()trtrmf3to1lm rauvi;t)srumxrpnodlpen ncia()srrmx ont0tet moctlsfa2em(vo;u4aleoxfcta1fpD luvi;( seto(rpiu4ap elnes s  Duaxrpoo4tltn oeildfa2umuvon(4trtnxfciy1lptrli sl( seurxmpiydap  lnvsa(  2taxrooo4aleo ieiad s2rlu s u0arxrmf3ootlp eln o;t) 2xoir no1ap  lici s a2tr(r ;t0tetoio3iyslm raumont4aleomo iy1lp e i il(  etmim3no4apenmfvia(f rur(mpot0alenmoetlt mDrmnvo;u)trenxf3oa1fmDranvil(0 2xrxo3iodll emncs sfsrrr( o;u4teto i3ias mDem( on(0 lxrir3iodfmD  nvo s) 2xo(rpnudlpen fvsat a2tm( p;t0tpe ifeiadfs rluvo;u) rtoif tydom elnvolt) rxoxm3iy1apeelfvtl(  Dur(r ;u1oeeo ieiydla2um( s;()tltrxf3tadop e ivo t0 2urxo iy1opeemies ( srurxr ou1tlxo iciad m2umnmo;u0trxnxf oodlaDraueo t0teurim iodoltnlncilsfaDumxmoou0oltnmf3tasls eluvs u0 exoxo oadlateanei;s)s2xo(r3iu1omt miei t) 2rm(m oo0olx moctatlaDeanvp u)altrmo totfpDeau s s0teuoxmpoudap n fes s s2urx ont0tetn ociadls eaumsnu) rtrmo io1opt lieils  2tm(opoo4lm nlfvs s)aDuaumpot1oltomi3ild s2uanms;u)alenio tydomtrluvol(0 rtmxrpnu1omt mnvtl()aDua(mooo1olxoiociatls ea( snu)texoxr iy1fa eai s t trumio3ou1altn nesls)s2um( oou0tptnmfctldfs uanvs () rxnmr todlaDeluvs;s0 2urir3oo1olte fcia(fsDurxmp;o1aetn ieiadfs2em( s t0aetoifcoy1fatr u s s0texr(o ou1lp elfvtas)a2tauro;o4tlxn ocilt a ulnmonu4alenmrcta1lp raneo;( texm(r no4alt lictl()artmumpno4aeen fciad mDrmuvpn(4tltoirciydfmtraues;t  exrio3no1optemiet s)sDtaum nt1tex ii3iatfmDeanms;u)trxnxf ootlm  aieolt0 rtm(m3oudll emfvils) Dta( pot0aptnii3iyd s rau p t0artrmr tatfaDrln ils texoxm3oudal n fvtas  rrrxmono4ale ioeiyslsDul(mo;t0arxomfcoo1lmD auvolt)texoxm3iy4om e fvs sfsrraxmp;u0olx moctytlsDrlnmp () lxrxf iydoate i i;()t2uoxm ou4apt  fvsas) Drax oou0oltnii3iltfm emumon(0arxnmfctytfmDeaies t)texm(o3ny1lpenliei sfa2ta(mo;t0tptnifeild m2eluvpn(4aeenif3tatfat auei s setmiopoo1alen fei tfa2uaur nt4tpenmoctlsfs2rlnvpnu)tltrio3tatfmtrauvsls)tetoiopio4lmtn fesl(f 2uaxmont1tpt  iciydfsDulu o;(4 reomo3iadla rluvilt  2xoxmpoudomtelfvi t aDrm( ooo0oee  o3ild aDea(vont4arxnif3todomtr i i;()trumiopiodalt lieilt)a2rm(mpot1tltomfeiydls2rlnms;u4aexrxo3iatlp eaiei;s texrxo3iudomen fet tf Dtm( oou0tle  oetydfaDrauvp;() lenmocio1fpDraies;(0 rxr(mpoo4altelivsls a2tmum ;t0apxo o3ildlaDeau pn() eerio3oatfpDrau i t0 2urxr3iudopt mfviat srurumo;u1alt mieilsfa el( o u4tlxoiociytfmt livilt s2trim3oo4al  mncslt  ruau pno1tptomi3ild sDea(mo u0aexoxf oatfptr ueilt  2tm(r3oy1al nmnes sfartrx o;u1alx ifetydfa um( s;t)tlxoxocoatlaDranvi;s0s2tmio oo4lm nlfci sfaDumu p;u0tpt ioetltlsDra(ms u0aeermo3oatfmtr nvo;(0srtoxr iu1omtemieil(  rrm(r no0opxo fctytfm umnvsnt0tlxrif ootoa   nesl()trxoxm io1opte fvsltfa2ta(r nt1aetnmo3ilslm umnvo;t) ltnmo tytfmD au i;s)s2tmirpiy4al nlivs t) Drrxmpnt4tpto o3tytfs rmnvp;u) ltoxfcoatoatelu o;s0trxmir3iy4omt mnvtlt arum(mo;o4tpxnmi3tld s ran p;(4tleomfcoo1fat anes s)srxoxmpiydolenlfeil() rtax ono4optomietytls2emuvs t4tlxrir3tatfa rauvsl(0s2xm(r3iy4ol nlics t)arrrxr ;u0ape ii3iysls2eluvo;(0 leomo oodfpt luvsl( s2tr(mpiudapeeliet s)s2umxmo;o0teto feiys sDuaums;(4teeomf ootfmte nvi ()sexm(o oy4openmfeilt aDtruront1tlxomfetls m rm( s;t) eenmo iydomD aieilt  rxr(o3iy1om   ncsas  rurx  nt4ole mictld m rluvp t4aetnif3tytomt li i t0 rxoimpoodoptemneias)aDtmumoou4tee if3ilsls ea(mp;t4 lenio oo1fp eanvs s)tetrxm3ny4lmen nvt tfsDtrxm ot0tpt  ieiad sDum(mp;t) ltrmfctatfatrlnvo t0tetmxm ou1alt lfes s)artm(rooo0tleoii3iatlmDrl( p ()tlxrxr3iodoa eaneolt)s2xrio oy4opt  nesasfs2trxmp;o0oleo o3iyd sDul(monu0 leoxo3oo1lpD lu o s seuoxmpnudole  icilt)a2tm(r ;t0opt io3iadfs2rlnmpnt0 lenifctatlmD liei ( trurxopio4omen fvsa() Drr(m ;u0oltn ieiysls2uauvonu0 leoio oo1faD  nvs;s) 2toxmpiy1am nmnvi s)arta(rooo1tpt if3ils mDuln p;t)aetoiocta1fpDran o;()t2trimpiu1lle  ics t sDurxr ;u1ale mf3iysfm el( snt0aetrmf oy1lat luvsls)t2xmim3nu1omtnmivilt) Dta(mo;u4oltnmi3iytfmDrlnmsn()trtnio3iadom eanei;()trtr(r3iy4al nlieias arta(rpnu1oexomfetldlmDrm(mpnt4aeenxo3iy1lm eln ol(0sexrim oy4am  lnvsl() 2rm(ront0oeto icias aDulumpnt0altnxocoydlmtraiei t0t2tmxo3nu1op  mnei s s2rr(mpoo0oeenmieiatla rmnms u0 rxrxo3tatlp ran s;( t2xrio3iudlpe mfvtl(  2uax pnt1altn oeildlm rmn s u4aeenxr tytfmDrln sls)sexoir ou4lle  nct s s2um(m ot1oetoioeiysfaDrln o (0 eerirctadopt aneols0texm(m ny1oleemnvtat)srum(  ;o1aet mo3iys m umuvpn(4treomfcoydlptrauvo t0seuoir iydlle lfvs tfs2tr(rono1tetnmfctad a emump;t4 rtomf3tadoaDeli slt0srumir3ou4ape lnvslt)sDurump;o4ale ii3iaslmDemums;u4tlxnmocoadopt  neolt)trxmxr iu4omenmnei (fs2ur(mpou0oleomo3iyslm2umump;u0trenmrcoydomteliei s)t2urimpny4lpe  ncsatfarum(root4tpen oeias mDeluvo u0 rxnxo3ia1lmDeaivsl()s2urimpiy4lm nlnvi s)srurxronu1tleomictyslm2uluvon(4areoioctotlmDrlneols t2xmiopoy4aleelncsls)arra(m ;t0opx iieiasfaDua(mo u)tleoxf3to1fmD livi (0 rxo(mpou4ol e nvi t srrmumoou4oeeomieiyd m2emnmsnu0tetomrcta1lm  lnes;s)t2toxr oudomeemiviat  Durx  ;t1tle  f3tydfs2eln o;u0trxnifcoy1oa elues s0setriopno1lptelnetl() Drmxmpno4oltn ieiydls rm( snu0 exnmrciodla  livs;t0sexoir oydopeemncs ()aDrruroot4optn iciytfm2rlump t4arxomo oydlp eauei s srxrxrpnydap e ieia( s2tm( o;o0olto feiadla2ulu pnt) rtoiocta1la  auvo t)tetr(mpoy4lm n ietas srur(m ;t1aexomo3ild a rln pnu4artoiocia1faDeau o t0srur(opnu1ll  lnvi t) Dtmx  no1alt mi3iys aDuluvsnu0 ltrir oa1lmteluvols)setmxopno4altemfvt s)s2rrxm ;o0oltn feiad a2ulu o;()tlenxr totla r neo s)s2urir3oydal nmnei (fa2uaur oo4optnifctltls umn s (4aeenif3iodfaDean ols0 2uo(m3oodom  mietlt)aDumur nt1aleoifeiadfs uluvp;u4 renxo tydfptr nvo t setoxm3iu1openlies ()artaxro;t4tptomoetls m emumon(0areoxfciydfa rlu i s tetr(rpny1om nmfeia()sDtrum no4aetnio3ilsls2elnms u)tltrxf iytfa  lu o;t0texmio iy4ap e iciatfsruaumoot4tpxo ieildls ua( s;(0arerxf iodla rai i ( s2uo(opnu4lpen fvsat aDtmumpno1olxoiiciyt s ua(vp t0artrmociy1fp eauei;t) exr(m ny1ol   ics sfaDuaxmp;u1tetomf3iys aDumuvs;u0artnio totop   nvilt s2umio3ou4alen netl( sDtm(mooo1oet mi3ias m emnmo;u0 etrmr3iy1oat li o () eto(r iudolee ncils a2raumo;u0tlt ii3tydla2ra(msnt0 ltrircoodlaDrlnei t0srurim3io4omen ivtl()arra(r ot1tpen i3iyslmDrm(vp;u0aeeoxrcoydoaDeaues;(0teum(r3iodamt mnvi s srra(r no1tlen oeils a rl(mp;u4 lxrmo3ta1fa  an s;(0 rurir iydlm nmnct t)arraurp;t4oee moeiyt sDumn p;t)arxnir3oo1fateluvs s trxr(r3oo4ap  lictl(fa2tauro;t1optnmo3tyslmDrmnvsn(4aeeomocoytlat aneo t teto(rpiu1lp n neil() Dua(moou1apt if3tldlmDrmn o u4teenmo3oo1optraneo;s0sexm(opou1op nlfet sfs2rrumpno4aex  i3iasfsDumnvs t)trxnmf3ta1fat lnvi (0s2xm(opio4lmt livsltf 2ua(m ;o4texoioctld a2rluvonu0 leoif3oydoptrlies s0trto(r ny4ape lnvs (f ruax onu4texoii3ildls2raums;u)trtrio3ootlat lieil() rxmxo3oudolenmfci t s2uax  oo1tetnifetysls eaumsnt4 rxrmr io1oat aivi;t0trtoxr3oy4oltnmneilsfarrm(  ou0aex iociadlaDeanvp;t) rxnxo oatopD aieol(0trxoxr oo4ap e fcilt artru  ;t0apeomi3ildla ra(vo;(4aeenxf3iotlatrlivi s)setoio oo1oltnmnct (  2tau  ot4aeeomietls mDulu p u4 rtrmfcoytfmtrli sl(0 2trxmpiodlmtnmncs (f Dra(m ;t0olenmocilt mDumums u0treoio3iatlmDrli i s  eto(o nudopenmiei ( a2trxmo;t1aetnmociytlaDean pn()tetrif3oodoat  i sl( s2xmxr ou1oltn feia(  rua(rpou4opt mieiltfsDeaums (4 lxoxo oadopD an s;() 2uo(opnydape lfctlsfa2ua( ono0tpx ifciasla2ra(vo;u4areomf3ta1la  luvo;(0texo(opiu1op elfctlt aruau  ;u4oltoio3iasfm ua(vp t4trtomf3tytlp eliei;s0srtmir iudoltnmncslt)s2rmur ou4opx ifciys s2ul(vp t0arxrmo iydlmtrlneo;()setoio nudom nmnvsl() 2ururpno0tltomf3iad s rlu pn(4aexrxf3tadlptr neilt) 2urxmpio4lm   fct s srtmx  oo4olxomfciysfa2umn p t0aleomrcoatomDr ivsl()trtoirpiu4amee fvs sfsruaum ;o0tltoifciyt sDum(mon(0 eenxf to1fat  neilt0 2uoiopio1ap e fvs t) rumx pno4alxo i3iydls ua(ms;t0 eeoxocto1op  lneilt0texoxm iu1ll nlnetl(faDumxmp;t1oex mfeiydfa2umumo;()tlxnir oadlaDeai o s) rxoir oy1ll nlfctltfaDurx oot0tpt moctltlsDrlu s t0tetoir tytoaDe uvilt  rumxm iy1omee fei sf rrm(rpnt4altoif3iadfmDemnmo t0tlenif3to1om  ai ols srtmirpiy1llenlfvi ()arta(r nu1tpe miciadfm2emuvo;u) eerxo iadopt  ivol( trxrxmpnu1omeemivtasfsDrm(rooo0aetn feiat m2em(mo u)texrxo oadfpDran i;t) rtmxmpou4altemfcias)srtrurpou1aee  fctldfm ea(vp;u4trtrmf3oydlat au o (0 2toxo oodaltnmiei s  rua(roou0oetn ocildlm2umnmp t0trtoifciatop r uvs (0 euoirpnudol e ncs tfartmumpnt1tpen o3iyslsDrlumpn(0trxnxr iy1latrlnvi;t0 rtm(o nu1lle mnvtls s2taxroot0tptoioetlsla2em(mont4alxoif3oadlatr i s s  exm(rpoodlmeemfeias)srtaumoou1teto fetysls ea( s ()aeermrcoy1om elnvi s) rurio oudapenlietl( s2ua(r nu4apxnmfeiydfa2el( s;(0teenmo3oa1fpD luesls  eur(opiu4op n fvsa(fsDraurpnt4alxoiiciys m2ranvpn(4 lermfcio1fp rlivols0 2urir3iu4lpt lfcil(f 2ur(  ;u0tpx io3tydlmDrau o;t0aleomocoy1op ranes s  etrio oy4amenmnvt tfaDua(  oo1tlt iictadls2rlu on()aexnmo3tytfp rlneo (0 2um(r oy4opeemfci t) rra(  ;o0openioeiyd mDuan s;(4teerif todfa eli o;s tetoxm ny4ll  mietl() rrm( ont4aptnio3iad s rauvsnu0aetomrcoodfp eaneol(0 rxoim3no4ol n fvtl( s2rmxm ;t0tptomi3iydlm em( pnu0 ltnxfcty1fp e nvo s0srtmiopiydam nlnvtls  2rrurpoo0oee iieiydfs ea(mo;(4 lerircoa1oaDr n olt0 2uo(opiy4apee nvsltfsDrmxmpnt0tpt mociltfm2rauvs (0teenmoctadfmte ivs;(0teur(m3iy4apenmicsl( s2tr(m ;u1aee ii3iltfm2eln s t4 ltrmocto1fatr ivi t t2xmir oy1lpeemnesls  rur( o;t0aptoioetydlmDuanms;u) etoxf3oadla  auvs (0 rtr(r3iudlpen ivsatfartmx pnt0ope miciadlaDuanvs t4tlermf3io1la  ln ils tetrxo3ou1ll nlfci sfsDrmu  ou1tee ifetldfmDemn s t)trtoif3todoaD anes;s  euoxo no4lptn ivt t)sDrr( onu1tpt io3iat a2ea( o (4aexrir3iydfmtelneols0teuoiopiy1ol nlnvsls)s2rmxmpot4oeeo f3ilslm eanms t4 exoif tadfmDrln s;t)srtm(opou1lm  lnci s) Dtaxront4olxn fctat s emuvo u) eeomrctydfpDeau o s0 exmiopoudole mnvt t sDrrx p;t4apxoifcias s ra( sn(4tltrio3ia1fmDe n o;t0srxrxr3oo4apt mfvi s aDraurpnt0tetoii3ildfsDrlnvp;u)tlxnmo3oytfmteli o t0srxmim3nudale lfeslt  rumuro;t4olxoiiciytlsDuln s;t)arxnio oa1fpDeaies s texo(r3iudome lncils)sDraxr nt0aptoioeiatfmDea(vsn(0trxnxfcoatlm eai slt)srtmim ou1olt miet sf Dta(m ot4opx mfetadfs2ranvs;t4 lenifcia1lm rlu o;( setmim3ny4omt  ict s  Duaxmp;o1texnioeiadfs em(vpnu) exrio tatlp  lnvi t srxmxo3iu1ap nlfcilsfaDur( o;o1ale  i3ilsfm uauvpn()tltrir3ty1fpDrlnvi s  exmxm no1ol elivsatfaDta(mpnt1olto ieils aDulnvp;t)trxnxr oy1fatranvo s)sexmxm oo1lpt  fetls)aDum( pnu1optomf3iyt sDelu o u0trtoxf3iadom   neo t tetr(rpio4lmtemncsa( aDtm(mpot0aetnmieiytlmDea(mpn(0aetnxrcoa1optelneilt)texr(opny1am e ivt (f Dtau  no4texo f3ias aDuau o;u0trtnmrcoydfmtr nvslt0seumxrpoy4lmtn nvt s a2ta(r oo4tpxniieiatfsDrau p;(0 eerif oy1fa r nvilt0sruoir oy1lp e fvtlt)srrmxmonu0alx  ietlt a2um(mon() exomf3totfmteaivi;t sexoio nu4lmenlfetl(fs2umumo;u0tet mf3ildfsDrmn snu) exrxo iodfa  aieil( sexm(o3no4al n ict s  2trump;u4oetnio3tadla em(mp t4trenxo oytoa r n i;( teum(r iu1oltelnvslt  rtrum ;o4opeo i3tatfm rl( snt0 lxrifciodfatrliesl(0trxrxopnu1omt lfvtlsfaDtm(  nt0oetn ieiytfsDumumpnu)tetrxoctodfaD lneo t0srxoirpno4ape mfeilsf rraump;o4tpx mfeiltlaDrauvs;(4 rxoxrcty1omDrauvi t)srxmxrpnudomtemfeslsf Dtm(  nu0oeenmoeiltfm2uln snt0 rxrxr ootom ean o s s2xm(m3oy1ope  fvi (f Dumx o;o0texn o3iyt a um( on(0texrmo todfa eau s;s)s2xr(r nydaleelict () Drmxm ;u1alt ioeiysfsDemnmsn()aleomr3oo1lmt livs t sexmxr3iodalte ivi tfarururp;u4tpxnii3tys s2rmuvp;u)teerio3oy1optrlnvi;(0 2tm(rpiudlpeelfcil(faDrrxm oo4olenii3tlsfs raums;(0aetnxr3oadfa e ues;t)srur(m no4lle mfcs (faDtru p;u1ape mfetls sDrmuvs;t)alerio oy1omD lnvs t)s2tmxrpnu1optelieil(f rrmurpot0aex mocias m emumo (0 etnif3ty1fa elu i;s srtoiopoodale mfctat)srrr(m nu4tlx  icild mDem( p () lermo3iadomD anes;() 2umxo3oy1al elietls) 2trx pou1oet io3iydlaDuluvo;u0trerxrcoy1lpD ln il(0sruoiopoy4omeemieils srtau  nt1tlt  fctldfaDran p;t4 etrircoa1opDean ols)t2xmimpio1olen feslsfartaumonu0tlxniicilslm uauvs ()trxoxf3ootlmD aivi;t0 2to(r ou4ome mnci t)srrrxmooo0opxomieiysfsDranvo;() reoir tatoat lnvo;(0seto(o oy1op   nesl(faDrax pnt0oexomf3iydfa2ua(mpnu)teerio oatoptrai i (0s2trimpny4ame livi s s2taurpno4tlenif3iys s emn p u)tlxoxociotomte uvs;( trxm(r3nudlp emfeiltfsDrrxrpnt4ope ii3iytlmDumu p;t) exnir ty1fm elnei;s  rxoxm3oydole liviat)a2tmuroot4aetn oetyslmDum( s;t0trxrmr3oy1oaDraieo;t)srxoxr oudlle micilsfs2uau  ou4ope moctysls em(mpnt4tltoxr3oytlmtranvils) rxrxo oo4aleelics tfaDrmx p;o0tee mictysfa2ul(ms ()arerifcoadlmte iesl(  euoio3oydol nlfcia( s2trxmonu4olx miciat s2uauvpn()tltoio3oadomD auvi s) rurim3no1lltelfeslsf 2uaxr oo4tpe iietytla2emnvsnt0 rtnif tatfmte uvo (0 exm(m no4am emnvil() Drmxmpot4tetnmociys s2rmn p;(0 eenxr ty1om e uesl()s2tmio3oydam n ncs ( arumu onu4tpto feias a2eanmp;(0 exrmr3tytfaDelu s t)srtmxrpoodop nmicsatf rtaxm nt0opx mi3tlsfs2umnvo;u4aleomr3todomDeau ols0 exr(m nu4lptnmfctat)aDrax oot0ole mf3tlsls2eluvont) rtomf3iydla  au s (  exmxr3oy1ap n fvia(f 2tru  no0aeenmoetas sDem(mp;()artrifcty1opte i sls0seum(r nu4lltnlnctltfartrxm ot1alt  i3ias mDrmnmpn()tlxnmrciy1fmDe u s t  2uoxo3oy1ap elivtl( s2trump;u0tpxoio3iysla2rmumo (4 eeoif3tadfpDr n s s  exoxrpou4ap elietl() Drmumooo0oexo f3tatlmDumn ont)tlenmr iodomDe uvo;s  exmxr no4lle  nvs ( arurxrp;o1alxn ieias s rm(mp;(4trenio3ia1lmtr u i;s0s2toxopiy4omte fcsltf 2tmuro;o1oltn f3ilslaDemumpn(4tleomf todom ranvil(0 2tm(m nydal e nciltfaDuauro;o0aet moeiasfs2emumpnu0 rxrmfciytfptranvo;t0srumxrpiu4ll emncil(faruru pno0aleomfciasfmDrmn s;(0aeerxo3iy1fmDrauvs t teuoxr3nu1lm emfesatfsrua( ooo1oltnmi3tas m2ul(vonu0aetrio iytlpDr neo t0 rxmio iodal  mivt tfa2rru o;u0olx ifetyt a2ranvs t)aeermo ty1optraieo t  rtoim3ou4am nmici tf rum( p;t1tlxnmoctltls2rlnmsnu0tetrir3oy1fm elu s s)setm(o iy1openlivtls) Dum(rp;u4apt mictld sDraump u4altomrcta1fatr n il(0sexrirpiudomtelfeil( s2tr( onu1apeomfetad a emuvp;t4tetrxf3io1fp  aues;s0srxo(rpnydlmenlnvtltf Drm(  no0apxo o3iys a emnvo t) lxrmo iotoptrlueo s0sexoirpio4am  mfvsa( sDum(mpnt1alxoio3ildlsDrlnvsnt4 ltniocoa1om rlu i;s setm(mpny4lm   icils  2tmxr nu4ole  ieias sDea(mp;u) rxnxfcta1laDr ivilt s2tmio3oy4al  lies (faDtr(m nt1aex ii3iad m2rmn onu0tltrio ia1lat ai il(0srum(o no1ll nlnci s aDtau p;t0oet mo3iat s2eln onu0trtnmo3tytopte i sl(0s2umir ny1olt mnctatfs2rmur ;o0tpxo f3ias s ranvpnu4tltomf3iytfp  aiei (0 rtoxr io1opee ictasfsDtrum nu4tleo i3tls m rlums t4trxomr3oydoaDraivo;() etr(o nydale mnei s) rraxr ;u0alx ii3tasfsDul(vp;u0aeeomfcia1fp ean i;s)setrxopoodlp nmnesas)sDrmuront0oltnmo3iyslm2uluvs t)tlenxrctatfmt  u s;( srxoiopny1lm nlneilsf 2umx oot1tpt io3tyd sDemump u0 leomo3oytoat  n il(0 rxo(m3nodlptnmnvtatf 2tr(rpoo0aet  f3tys a um( pnt) rxomr3todoa r nei ( srum(m3no4lpe mnesatf Dumxmo;u4tptnmfciadlaDea(msnu0alenmociodomt  ues s)s2ur(r3oodapenmfci t  2rm( pot4aleoiociyd m2ul( p u4 ltrxocoa1fmD  ivo;() rur(m oodlptemnci ( sDtax onu1altomi3ilt sDrlnvs (0trtoir3ia1fa ran i;t  2toio3ou4altn ivia(fa2tmxr nt1tleniiciatlmDuaumon(4treoxr3tydlp raueo t)truriopiu4openmnesas)sDua(r nt1aptoioeiltls2umumpnt)tlxoif3to1lat aueslt  rtrir3iy1lle  feiatfs2ra(rpno1opxomoctadlaDemnvsn(0 ltnmfcootom  lnei t t2to(m oudol emneilsf 2tru o;u0tptnifciytla2umn s;u)teenio oadlpDr ieo;()seuo(mpny4lpe lici (  Dtrump;o1oetoioeiad aDemuvpnu0 exrmf3tytlp elnei;s s2xmimpnydaltelietltfaDrr(m ot1apt ioctysfa ra(ms u)teerxf3totfmD lueo t t2tmxopiodol nlnetatf rtmu o;o4openmi3iatfm2rm( p;u)aeenmo3totomt  nvi t0trxm(o no4lmt  nctasfarur(rpoo4tptniicilsfsDemnmsnt)aeermr3iatop rlnvo;s0seurxo3io4alenlnctls arrrxmp;t0oexnmfeiydfa ul(mo;(0artoxo iatlpDean o t0t2xo(o3iydam  mfvsatfs2raur ot4oexoiictytfm2ra(vs (4 etomf3tatfmDe ivi;()srtrimpoydol elfvtas a2taum no0olen oeiyt m rm(ms;u0tltoxrcoydlate iei;t0 rurir oodalt  ivtls srta( ooo4opt mi3ildls2uau o t4aeenmf3ty1lat lu o;t truo(m oy1lleelnctls)arua(rp;t4tpxnmi3iyd s2el( o;t0tlxnio3iotfmD auvo s s2xoxo3no1am e fctl()srurumo;t1opxniietasfa2rm( o;t4treomf iydlat  ivo;() 2xo(r3nu1ap   iet sfa2tau pnt1tptniociaslsDean o;(4aeeoir oa1oaDraueo;s0s2tmio3io1olenmfcta()sDumxroot4alt io3iadfaDelumo u0aleoxocoa1faDe n o ()sruoiopio4lp nmnvt ( sDtm(m nt4alx io3tydls2el(vo;u0trerioctatoptraueilt0trumio no1lm e fcs s) Duaurono0teeo ociasfs2rlnvonu0aeeoxf3iytlmt aivolt0 rxoim nodap   fetls  Drrum oo4texn o3iadla rlnvsn(4 rtomf3ootlpD  i s;t0 2xrxm3no4optnlfvtasfs2tm(moot0aeen ociysla uanvpnt) etomocoa1omteluei;s texrim nydomt lfct s srumum no1olt micildlaDumums;t) etoxo3iytfm  luvi;s) 2tr(m nodlp elics () rtaxmonu0apxn feiltlaDua(vo ()tetnmrctodla rauvi;( t2xoio nodop elfct t)a2tau  ;u4tex io3ilslm uanms t4areomf3oytlpDrliei;()texmxm3io1ap n ivias)sDtmxrp;o4tetoifeiytfmDrlnvp;u4tetnxfcoadoat lu sls s2xoxo ou1olen nei (faDum(rp;u0tet mfeiatfs2um(mp;t4texrmo3oodfp  lieo (  2to(r iu4omtnlnes t)srtruront4ole iociatfaDemumpn(0 rxnxo3ootopte ues ( sexoio3io1lltelict s srrm( o;t1tlx mfetatfsDel( pnu0 rxrxo ootom rauvo;(0teurxmpnudlme  icsas  Dtmumooo0oeeoif3iasls2emu s t0 lxrxr ta1lm r u i t) etoxr3io4lm elicta(faDtax p;u4ape iieiysla2ra(msn(0aetnxo tydom ranvolt0 exoim3nudlm n fcsa(  rrr(mp;t0oltnii3iadlaDumu onu4alxrmfcoytlmD  neil(  2um(m3oo4lm emfvi s aDtm(mono4tet  ociltfmDrluvo;t4 ltnmo tydfm   nvi;s  exrir3iu1apeemnesas  Drm(  nt4aee iictydfs umu onu0tleomr3iotoa e u i ()s2tmxm3iy1opt micta(f rtrxrooo0tltoii3iys s rluvpnu) exnmf3iodlpD luvo;s  exrxo3nydlltnmietl()s2umumpnu0optnioetydfs ra(vp u0arxoio3oydfatr nes;()texrir3iy4al nlfci ( aDtrump;u1ale iociytla rm( onu4aeenxo tatlmDe uvi (0srxrim3iodlltelnvia()sDrrxmp;o4teeomietyt m emu p;u)aeeoxocta1faDe ueo;()seurio ny4optelfci (  rrrurp;t4oetniiciatfa uan s t0tlxnifctadfaDeluesl() rto(mpoo1lmenlncil(farta( oot4altnmi3tysfa2rln s;u)teenir3oodlmD lnvs s s2xoxo3no1olenlfvtls srrm( pno4apxnioetytfm2umnvo;(4 etoxf tadlatr ivo t)trxoirpio4olee ncsas a2tmxrpno4apeoifetysfm2ea(monu0trxnxf iy1oatr uvolt s2toir oydam e nctlsf Dtaum ou0oetnmiciyd a emu s;u0tetnmo oy1oa   neo;s) exo(r nudoptnlivsl( srtrum ot0aetnmi3tlt a2emuvs u0artrxo3io1lpD  nvo;()sexrirpiodlptnlfcs t)srumumpnu0aee mfciat s umuvpnu)aeeoxo3oodlpDrlu olt trurxm3oodap  lnctas srtaurpno0teeomiciytlm rlumpnu)tlermf3ootfateauesls0 exoxo ny1omee nctlsf 2ta(ro;t0tet  ociydfaDel(ms;u)aeenmf iydom eanvilt t2xmim oy4apt mnvtls sDua(  ;o4oltoio3iytfsDrmums ()tetnmf iodfm r ivils0seum(r3oo4ap emfcils)a2rmumonu4aeeo i3iytfm2rlumonu4trerir tatfp rlueo t  eto(o ou1ole  neta()s2ra(mo;o4olx mfetlsls2um( pn(4alermf3ia1op  lueols0texmirpno1opt mncsat a2urxmpou0teen o3ilt a ranms;t)tleoxo3to1fmDrlnvils srtoir3nodalenmfeilsfaruauroot0optn fetysfm2umn pnt)aetrmr3iytoaDelnesl(0 2tmxopoo4lmenmnci s  Dum(mpno1tltn iciaslmDrmu o t)tleomr tadoa eaueo t)s2uoxopny1aptemivsa()aDtrxrp;t1oetnmoetlsfaDumumonu)aetrmo3ia1laDr uvil(0s2tmxm3oy4oleemncta()a2ta(rono1oltnifeilslaDrmu onu4artoif3ta1oatranes;t0 2xrio iu1oleelfvi s)aDtr(m ot4opt  oeiltls2rm(vsn()tltnmr3oo1fp ranvs;( tetr(m ou4amtelicsltf Drmum nt1apto icils s emnmpnt0 rxnmr iy1lptelueo;( t2xrxr oudal elfetl() 2rrum nt0opxnioetysfsDrl(vpnt4arenmocoadfm  an i (0tetmirpiydll e ieslsfsrtaxro;u4tpeomo3tadfmDumnmp;t4trtomr oa1lmDe uei;s t2tmxm iudape  fet (faDrm(mooo0optoii3iyt a2ea( p;(4trxnxfctydfpDraieilt)t2tmim nudol nlfvilt  Drm(r ot1tpxn f3tys aDeln snu)aeerxo3oydlpt luvs (0seuo(rpnodom   icsatfsDta( o;t0tetoioeiatfs2rmu o u0trtnmr3ta1fatelnes;t0 rtr(r3oydomen nesl()aDuax  ot1olt  i3tas aDrmnvpnu4tleomr3tydop eaieo;s srurirpoo4amtelfvt tf rrax oot1oleoii3tltfs rau s;t4arerxf3oatfa rli i;t tetr(opnodllt lfcilsfs2rm(  nt0olxoii3tlt s2rm(ms;t0tltrmrcto1op e uvo;t  rur(mpiudopenlfci ( sDtaum ;u0tetn iciatlsDulumsnu0 reoxr3ootlaDr u o s s2tmio3ny4ome lnvi tfa2trumoot4olxomocildla uan o;u4tetnxo totop rlnvil( s2uo(o ou1lle mfei t)a2umx p;o4tle io3tld a2ea(mpnt4 exnir3iadoaDraueo;()teumxmpoodlm nlncsasf Drmxmo;u1tpx  i3ias mDelums ()tlenirctytfm  aivols)t2um(opoy4olee ivilt a2rmx p;o1ape mfeiytfa2eanvs u0 rxoxo3tytlmDeauei t)s2uoxmpoodame  fctlt  Dtmu p;t4tpeoii3tlsla2eanvp u4treomo3iytlmtrai sl( texoxr oy4apenlnesltfaDua(  no1aeenii3tydfa2uauvo (0 lenxfcoy1oa  auvs ()setr(m3iu1llte fct t) Drmumono4aexnmfciat m2rl(vsn()teeomrcoadfpD livi ( texoimpoy1oltnmneils) Dua(mpnt4oetn iciysla2rm( o;(4arxomo3oytlp elnvi;()trtoim no1ole mnvsa( a2rr(m ;u1oeen i3tlslsDul(vonu0 rtrxf ta1opte i s s) euoimpio4ape livt t) rra(r ou1olxnmoeiyd sDuaumont4trtomocoatfp ean i s)tetr(opnu1ome mncia(fs2taur ou0alenifciysla ean snu)tleoxrctodlm  aiei (0texr(r iy4llt livsat) 2ta(  ;t1alxoii3iaslmDranmp t0 exnmf iytlmDrlu olt)srxrim iudol emfvtls a2rrx poo0oeeomoeilsfs ua(mp u0tlxomocoo1oaDe i ols0 euoxm ny4opte nvsa(f Drm(roou0aptnmfeiyslaDemnvon()teenxr iytfm r ivs;t  rxoxm3ny4olee netlsf Dumumoou0tpeoioeiadfa2umnvsn(0tlxrmfcoadoat  nvols) rtr(mpiudamen neta(f 2rrumont0oee iicilt a2em(vs;u0 lerxocta1lp eaies s  rurio iy1lm elivilt) Drau o;t1oleo i3iydfaDuau p u) rerir oatlp rlues (0seum(rpoo1apen nei tf 2trxmo;o1oexn ieiasla rau s;t4tltrmr3ootoa rli o;t)s2tm(m iu4oltemiet s s2rmx oou0altoii3tltfa raumo (4tlxomf iydfmteai o (0setr(r3nu4alen icil( arur(mont4opeo fetls mDeau o;(0 lxrmrciydfmD aneol( s2xmxo nu4am  mnvt (f Dumuro;u0oexnmfciadlm2umuvp t0 ltoiocoy1fp rau i s) rxm(m3io1optemnvsat  Dur(moot0aexo ieiyslmDel(vo u0teenmfcio1oatelnes;t) exoxo oodlm eliet s s2rrxmp;t1oee  f3tltlaDul( s;u4arenioctadfa eluvols) 2toxr3iodalen ncs ( s2rau  nu0tltoiietasfm em(ms u4 rerioctotlmD  uei;s0texoir nu1lle mfetlsfsrtr(  ou0aptnifetyt s2ean pnu)tetoxfcoydomDeln sls)trxrxopiodoptnmnct t)srur(mono1oexn iciatfmDua( sn(4texnifctadlat aivo;t  rtoxr oo4amtelietat s2ururpnt4teeomoeiasfs2ul(mo u4aetnifctytfmD luvo;(0setmim no1apt lieil(  rtm(root0tlxoii3tytfa2umu p;(0 leoiocoodlmt lu sl()sruo(m oy4lm n ivs (f Drrxrpoo1tptomf3iat m ulnvon(0 reoif3to1fp  auvo s0 2xmxo3no1ap nmivta()srurxm oo0tpx if3tlsfsDuauvs;(0 renmoctadom e ues t tetrxmpnudam nmnvs sfsrumurpnt0tpx moctltla2emn o u) rxnmf3tytom   nvil(0trxo(o3iudolen nvs sfa2raxmpoo0tpt ii3iydfmDrlnvpnt)tltnmf ty1lm eaivi t0teuo(rpoudape livslt sDtmxrono1tpxn f3ilsfs2ua(msnu4trxrmr tydlaDranvo s)t2uoxm3oy4lmenlfesl( aDrmu o;o1oltn o3iltfm2emn snu4aexoxf3ta1fpt lu i ( texoxr nydlmt lies (f 2tmumonu4alxo f3ias m2el(mo u4trxoio3iotlpD  n o s texoxo3iodomenmfvsat s2raxrp;t4tlx  f3tys aDrlnvsnt0tlxrmrcoodlpt  ueolt)sexmxo no1aptn fes tfa2trxro;u1tlt mi3tld m um(mont0texrio3totlpDr iesls)srxr(m iydame mncilt  2tax pou1olxomoeiysfm uaumpnt4arxrxocta1omtrluvol()setrxrpno4olte nctasfsrtax ono1olxoifciyd m2umums;u4texoxrciodoa   n s t)setm(m3iy4ol elnesa( aDtrx  ou4alt iieildfm2ea( pnu4treomf3iodfpD anes;s0 rtrxrpou1om  mnet t srtmu  ;o1aeeomi3ilsfa uaumpn(0 lermo ty1latrln i () rtmim iydamt lneiat aDrrxmono1tetnifcilsls2ulumpn(0teerir tytlpDr uvo;(  2xm(o3oodlme  ivia()s2rr(root1tpxomociydfm2rl( o (4 rxnmo3oy1op  lieo;s)srtmxr3no1lm nmiesat  rurur ;t4teenioetltfm rluvpn(4aeerxf3oy1op  aiesl(0teuoxrpou1aptelfeilt) Dtaxroou0oltniictasfa2ranmonu) lxomo iatopte ueolt) 2uoxm3iydalte netl(f 2rmumono1oltnio3iyd aDuanvo t4aeenircia1oaD anvo;s0setmir oy1lmee fctlsfsDtmxront1tex ifctydls ua( p;t4 rxrxf3io1op e uvi t0trxoir3nu1om n fcs tfs2tauro;t1opt mi3tlt m rl(monu0tlermr3ty1la rlnes;s0s2xmxo nudapee fetatfsDuau o;o0altomo3iasfmDumnms u4 etomocoytfpt lnei (0tetr(o3iu4ap nlfeil()srtaxmpoo1tlen oeiaslsDulump t0alxoif3oadlmtr n o t0trtrxo3nu1lle lnei sf 2tm(mpoo4tlxnii3iytfmDeln o;u)aeenif iodlatr i s s) eur(rpoo1am elnctl( sDum(m ;o4apen f3iad a ul(vsnu0 etrxrcia1omt lnvo (0setm(r oydap n nvia(faruau p;t4open ociysfs ranvp u) renir3iydom eluvslt)t2tr(opno4lmenlfes ( aDrr(mono1apx mo3iytfsDum( o;t4teenmrcoatomtean ils)texrxo3oudomenmncilsf Drr(r nt4oleomoctat s2umu p t)alenmf ta1faDrln s;s)trurxo iudam  lfet (faDrmxroot4oexoifcildls2eluvpn(0trtnmr oatlmte nvil(  2trxr3no1lmtemfci sfa2rau  ou0oetn fciysla2umnms (4aetrmr3oytlp eanei t)tetoxm3nu1lmtnmieia( srtmxm nu0oetn ieiys a2elumsn(4aeerxo3tadlaDrau s ( trtm(mpoudal e ivt (f rum(  nt0opt  ietysfm2um(vo ()artnmo3oo1opDraieslt0 2trxm3nudol  lnvtasf rta(mp;t4tlx mfetlsfaDuanmp t) rxoir iatfa  anei s0 2um(m3oy1ole mivtltf 2tm(  ;u1oetoifetas aDrlu s t) rxnioctotfpteau i t  2uoimpoydapenmnciat)srum(r no1altnioctlt m2ul(mo;u)trxomf ootopD aivs t srtoim oo1aptn nei (  2rmumpoo0oex if3ias m2eluvp;t0 renmrciotlat au o s0 rum(o iy1llte nctasfaDumum oo1tlenmf3iytfmDranmo;u)alxrxr3ty1laD lu i s s2ur(r ny4om n ivtl( srta(mp;t4opxnmocilsfsDua(mo;t)trxnmo3iytla r nesl(0srxoiopno1lm n iei s)aDta(  ;t0texo iciad s rluvo;t0tltrmo3oatoaDelnvols)sexrxm oodape mnvtlt arta(mp;t4apt iieiyt s2um( s u0tetnxr3oy1oaDr ivi;s) etriopou1op  lfcia( aDrrumonu0oeeo iciatfa2rauvo t0tltnxr oy1oaDrln o s)t2xriopoy4lmtelncsltfs2uaxmo;t4tpxnioeiysla2rmu p;t0trenirctodfa eaieils0trxmio3oy4lmen iciltf 2raxr oo0olenmi3ias m rl( sn(4 leomociatla r u slt t2tr(m3ou1ol emfvi t)s2umxm ot1apxomoeilsls uln s u)texnmr to1omDraivs ( srtmxm nu1opt  fcta( s2trumo;o1aptnmo3iys mDel( onu)artnxf iatlaDr u sls)t2xo(opnudam   nctlt)s2umx  nt0texoifciyslm ra(mp t)teeomo3tatopt  n il(0 rxoiopno4ll  mncsas) 2rmx pnt0aet ioeiysfa uan sn(4tltrxf tydfpDr i il(0setrir iy1om  mivta(  rum(mpoo4tee  ocildls rl(vpn(4 etnxocoodlatr i olt setmim ou4ame  fetl() 2rr(m ;o4aeto o3tat s2eaumont4artoxr tadopt ln ols0tetm(r3iodaltemictatfaDururono1oeen o3iydlm rmnvont4trxnir iytfa ranvi;t0 2tmxm3nodlpe  fesa( s2urxr ;t0oee mi3tldfs2umumo (4 eeomo ia1optr ivs t0 eur(mpny4om  licsa(fartm( pnt0tex  iciadfa ua(mp t) ltrmo3iy1oatelueo;t srtoimpnydomtnlivi ()aDumurooo1tptoif3iysls2el(vo;u0trxnirciodfatrln s t0s2trio3nu4op elfet s  Drmu o;o1apt  i3iltfm el(vs;u) exrxocoy1lmt ln s;s  rxr(o3oydlptn fct t)sDrrump;u1tle  i3iat m2uanmp;u)teerxociy1fpDeln o s0 eurimpio1ap   nvils  2urxr ou4opxniieiaslaDea( s t0 leoxfctotoat livs;s)t2trxm oudlpenlfvsls) Draxr ;u4alto o3ildls2el(msnt) etomrciydlptr nvs ( sruo(o ou1opee ivtas srrmurpno0aetnmietatlm2rln o t0aetrircootoatranvo ()seuoxr no4lp n ncilt) Drmx p;u0optn o3iadfmDumnms;t) exoio3to1oat  i o;(0sexmxmpiu4alt mnvtls)a2tr(m ;o1aee mf3iys a eau onu0arxrmr3oy1fmtranvs () 2xrxo3nu4ame lfcsas)a2taur nu1oeto f3tlsfm2rluvp u0tlenmfcoodomteli i;s  etoxr3oodllt  nciat)aDtmur nt1alxoiocils mDrmnvs u0arxomr3oydlpDrli olt t2uoxopoo4op n fctas) Drmumpoo4opx  f3tltfm rlnmo u0 rxoif3tatlmtrlneol(  2um(m oydllte nvs t) rurum ou4tle iiciaslmDrlums;t0arxrmr3ty1fpD  nvi s)teur(m3oudole mnesls)s2rr(  ou1aeto ieiytla ulumo;t0alerif oadfaD  i i;s s2urxmpou1ll nmfesl(fa2rrx oou4oeeomietyd aDum(vsnt4altnmfctotopDe nes t0trxo(r3iydap nmncils s2umxr nt4tlx  o3iys aDuan pnu4trxniocoy1la e nei;s0tetm(m3oydomeemivta(fartau oot1teeoiietlsls2umuvon() exrifcoo1fa eaivilt srurimpoydlmen net t)aruaurono4apxomi3iysfm2ra(mo;(4 rtnmocootlmtelnvils t2tm(m nodomee ncs tfs2taxmo;u0tpto fetlt m uln snu) lxoifctydlpD lueo;t0srumxmpny1lleemict tfarrrxmpoo1oetn oeiad s emn s t) lxnmrcoo1op raueils)srto(m3ou4op   fei (fsDrru pnu1alt mfetyd sDrmu o;()arxoio totlm eli ils0srxm(o3oy4aleemies ()sDrmx ont0tlxomi3tlslaDrl( s;()alermr iotla raies t setm(r3no1llee fes tfsDuru poo0tlt mf3tltfs2rlumo;t4 rtrmo3oodfpD liei s) rxrim oudaptnmncia(fsDtax o;o1oetnmfetydfm ulnvp;u4aeerxf oa1oat livo t  2xoxr3ou1alenmfeia(fa2tm(r no0oeeomi3tld aDuan p;(4texoif3todfp   n s;() 2umim3oodll  lnei tf Draxr no1ale  o3iat a ul(mon(0aetoxo tydfptraivi t t2xm(r3iudlltnmnctl(fsrtaurp;t0texoio3iat a2rl( s;t) leoxr oadla  an o;t)setm(rpnu4op  livt s) Dtau  ou4aexomietydfs rlu s;t0 rxoifctytfp r i ils) ruoim ou4lm elncsls s2tr(mp;o4open oeiad m2ea(mpnt)aeenmf3ty1lat  uvols  rxmim no4om e ivtat) 2tax ono0alenmieiltfa2rmu p;()arxomf3iydlpt auvi () 2xo(r io4om nlnci t aruaum ;o1altoif3tldfmDran p;t0 rxrio iydopD lnes;s0t2tr(mpnydaltemncil(  2ra(mp;u4olt  oeiad a2ranmpnu4 lxnxf todoptelnvs;( t2uoir iy4ll   ics tf ruax pno0opt iociysfm2uluvsnu0tltomo to1opDrlivol(  etrirpou1ame lietas)aDtmx pot1aeto i3iatfa rau o t4alxrxf io1lptraieo;s  2xoio iu4op  mneias)a2ta( ont0oex ii3iys s2rlnvp () rxnif3todoa e ieo;s)texr(r3ou1ape livtlsfs2urur nt1optoioeilsls rl(mpnt) eenirciy1om  lies;()seurirpoy4aleemnei tf rraxm ;o1optn i3iat m2rlu s ()tlxomr tydopD ln sl(0t2to(r iy1alenlncta(  2ua(m ;t1aptomoctyt a2uluvp;t)tleoir oatfp  lies s0 exoim oo1om elieilt)s2rm(mont0opt ii3ilt mDea(vp ()tlxrio3tydfmD  u s;( sexmxopio4omenmfvslt) rraxrp;t1ape moetad s rmnvp t)teeoif3iadlaD  uvi;t setmirpnu1ll e ietl(fsrraxrpnu0alxnmo3ildfs2ul(ms t)aeerif3tytfm  livi;s0srxrxr3iodaleemfcta(  Drm(mooo4oetnmf3iytfs2elnvon(0 exnmfcta1lpDran s t)teto(mpoo1op e fet s)artru oot0apt ifeilt sDum(monu) exoio oy1fa e iesl(  etr(rpiy1lmee ivt sfaDururo;t0alxnmo3tyt s ra( s t)texrir3oy1fmD auvo;t sexm(opoo1am elictat  Dtmuro;o0tex  octat s2uan snu4artrxr oytlaDr uvi;t0 rxmir3iodllte net t  Dtrump;u1tltniiciadlsDem( s u) leomo tatlm  auvolt) rtoim nudlm n fct t) 2taumpoo1apt if3iydfaDeauvs u0 rxnircoytomt  u i s trto(r3nu1lp e nciat)srrmumo;o4oleniociltfm2el( pnt4alenir tatfm e u o ( trtriopiu1am  mivtat s2urx p;o4altoiieiltfs2emn s t4 ltrir3iotfat lnvi;s s2umxm iu4altemivsa(  rtrxrp;u4tlt  ocildfa2ua(msnt0texrio oy1fa   nvilt teuoxr oo4lptnlfctas)a2uru poo1olxoif3ilsfsDeluvs;t0tlerxr iatfpt auvol()srxr(opou4am emfvsls artm(roou0tpt  ictyt s2rm(vp t4trxoir3tytopDrln o t)tetr(rpoo4ope mnvtlt)s2uaxmono1alt  oeias sDrauvo;u)artrxf iytomtranvi;(  2trxo3oudlmtnlfctls)arumxr oo0opeo fctadfs um(mp u4tlerxf todlat anvs;(0 2xmir3iu4om n ictltfsrua(mp;u1olxo f3iytfs eanmpnu4 rtnir totopDrai sls)trtrxrpiodlm elncsls) ruaumpou1olx mictasla2uluvsnu) ltoxf3iatla   n o;s)trtrio nu1ope mivta() 2rmu onu4apx iieiatlaDrmu o (0 exrio3iodfpD  i sls  etrxo oy4al  mnes t sDrmx ont0tleo feils a2rauvo () exrmo3oadfaDe i o t)trtmxmpiodomtelfesas arrrxmp;o4tpto ociat a2ea(mp t4artrxfcia1om r u olt srxoio3oudop  lics s  Dtau  ;t1ape iieils a rluvo (4aeerxfcio1la  auvs ()sexo(r no4lp e fci tf Drax o;o0oetniicildla2rmu p;(0 etoifctytoa   ieils0s2umxo oy1lme lnvt tfs2ua(r no4aee  feiyt s2uan pnu4 lerif3iy1oaDr ieils)teumio3ou1lm elnviatfsDumu pnu0alt  icilt mDra(mpnu4tlxnmf3tadlate n ol(0s2xmim nydam e fvta( aDtr( oot4tleoif3tasls rm( s;u0 exrmf3ta1opD lieo;() 2urio3no4ap elfetas arumur ;u0tpto ieiasfs2eluvs;() exoir3tydlpD au i;s0s2urio iydapeelietlsf Dtmumo;o1tlx iociatla2ua(vsnt4aetnir3oytfm e iei ()tetoxo iydame mivi t)srumu  ;u4olto f3ilsfmDemumsnu0teeoircoatoaDe i s;s0 euoxopio4ll e nvtl( a2raxront1apx  f3tlslm uaumonu) rxnmf oatfp   i o s0texmxm nudlle lnvia()sDtr(rpoo1olxn oeiatla elnmo (0aexnio iy1oa eaiesls s2xm(o3iy4aptn fet () rrr( ono0tlen fetls a ulu p;()tlerifciydomteluvo s) eurxr3ou4am e ivt s)srtaxmpnt0tpx moctad s2rl(von(0treomf iytomD  u i;()s2umimpny1ome  icsat srur(mo;t1tpxnii3iltls2ua(msnt0 renxo iatlmtean s s) rxmiopnu4omt  fetat sDtmump;t1aptoifetatlm2rau o u4 ltnmoctytfm   ivi t0 etrxrpou4optemnesltfsDrrxrp;t0aetomoctydfs el( p;t)arxoxrcoy1op elivslt0 2xoirpiy4lmtn fetlt)sDrru p;u1oeeo oetld s2umump t4altnxr oo1fp  li o;( s2uoxo3iodap e ivslt)sDurxr nt0alxomfciltfmDuluvpnt0artrio3tadoa eanes t0s2tmxr3oy4ome mfet () 2raxm oo4tpxoiicild a ranmsnu) eenxr iodlmDr n o;s  2tmxmpny4ale mnvs ()a2tr(rpnu1aeenioctatls uan pnu4alenmr tydfpDrai o s  2umxrpiy1apt  nct ( sDrmxmpoo1oeenmfetyt sDrlnvpn(4 lenif3iadlm r u s;s) rtr(o oo4llt  ictat)srurumpno4aet  i3iydfsDumuvpnu)texoxo3io1oa ean i;()t2uoxrpiu1ap  mnvs tfsDurxmooo0tptoif3iat mDrm(vp;t0 rtnio tytla rluvo t tetoir3iodale  nvs sf 2rr(rono0ole if3iysfm2emu o;t4aetnxf3iadfpteli i s) 2trimpou1ol   fcs ( arrmxr ou1apxn fcias s rm(vp;u4alxrir oadfp eaues;s)trxm(m3oydalt mfetlt s2ta( p;t0apeoioeiatlm2rln o;(4tltoxocoy1oatelies;(0 exoxo3oodoltnlfeta( s2tmxr ;u0aexoiicildfmDulnms t4alenmr3iy1opD lies;()setoxo oydopte ici tfsDur( o;o0tlenifetldfmDeanms (0arermf iydfpD lueo s0srxm(m3oydopenlfcslt sDtr( pnu1opxniieiadfmDum(ms;u4tlxrxrcoy1fpDeli i;s sexoim nydaptn neiltfs2tm( pnu1opxoio3iytfa rmuvo u4 lenxr3iadlp elivols s2tmimpoo4amenmnvsl(fsDumx o;u4ope  i3ild sDeau p;(0artnxrctadop elnei;( teum(r3oydaltnmfct t  2rrx poo0aex  o3iatla2rlu o (4trxomo oodfaD  ies;t  eumxr nodap nmies tf 2raur ot0teeo i3tydfsDem( snu0 lerxrcoy1fpt livs;t0t2xm(m iy4amen ncsl()arraumpoo4oltoiociydlmDum( sn()aetnmf3tatoa  ln ils s2uo(m iodlleelnviasfaDtmum ;t4tpx ii3tasfaDemu snt)artnxo3ootfm e u i s0 2xoxm3nu1al emict () Dumuro;t0tee iociasla2ul(von(4 rtomr oodomteaivo;t) 2xmirpou4lp nmfctat  2trxrooo0apt moeils s2emumo;t4texnxfctotop   n s;s)trtoxr iy4ale  ivtat sDraurpot1alt mieiltfaDra(ms t4tltnxf3oytfm  ln ils  euoxmpoo1op emivsls s2tm(  nt4oexnmicils aDuauvo t4artnmo3iatlp  ln ols) rxoxo nydapenlfcsa()s2ururpoo0tlenmiciadla emnvs t)aetoxr ty1faDeai slt0setrim iy1lmen fvta(  rtr( o;t4olto ieiytfa2rlnvsnu4trxnio oatfmte nvs;t)srtmir iu1am nlnct tfarrr(  oo4altnmfetadla ua(vo t)aeenxf3oadlmDraieolt) rurimpny4ope  ivia( a2ra(rpou4texoiietatlm umums;u)alxrircio1lm eaivo t0s2xrxo iodaptnmfei t)s2tr( pnt1oex  fctls m2rln o;(4aleoxo3to1faDrlieols)srtm(m no1lmtelnei sfarrrumooo0altn fciyt mDuau p t0 rxnxoctadlp r nvslt  eurxr3no4lm  mietatfsrum(ro;t4olt  ietys aDemu s;(4artoxf3oy1fpD li ils0 2xrxo oydllt  nvi s  2ta(ront4tetnif3tytfm rlu o t) rxomr oydfpt auvol()s2umxr3iodoleelfci sfs2tax  no4aexn oeildlm ua(vsnt)alenmociatoaDeai slt0 2xrxrpno1alt micias)sDtrx pou4alto ocildfm2ea(vsn() exnmo oatop e iei s teuoxopno1ll elfcsat a2tmur ;t1teenif3tytlm2ra(vpnu)tetnircio1opteluvs;( s2tmxo3nu4oltn nvtl()sruaxr nu0aeen o3ildlm2ea(ms;u)aeeoif3tytom ranei;( t2xrim nodlmte fcilsfarur( p;o4altnmfetldfm2uauvp u4 reoif3totopt aneo;(  rxm(m iu4al  lfvsl()sDtm(mpnu0tetniieilt m um( onu4 rxnmf3tadoa r uvo t  rxmimpno4am  licsls s2tr(mp;u1apx  oetatlm rl( s;t0treomr tatop e uvolt t2uoxmpou1opee nes (fsrrru pnt0tptomi3iyd mDumuvpnu)aetomr3oatlp  au o () ruo(opoy1olee nci sfaDta(mpou0ole ioetys aDumumo;()artnxr oydopD  ieils0s2xo(opnudlmenlict tfa2umxm ot4texnif3iatlmDuan p t4 rtnxf to1lp eau o;t0 euoxr ou4olenlfci sfa2urumono1tee mociys aDulu pnt4tlxoif3oatoaD aneol( t2xr(r3iydom n nesl(  2ua( oou1tet io3tld sDeauvp (4trtniocootlptrauvolt) 2trir no1lm nmics tfsrumumpou0optomi3iys s2ranmp u) lxoio iotlptraueo (0srumxr io1alen ietls)aDrr(mpot1tpeniietatlaDrm( onu4alxrmo3iatopDrlivi () etoiopiy1ll  lieils s2rrurooo0tlx iiciysfaDranvo (0 ltoxfciodlmDeaivi t srxr(o3ny1olt mietls) 2rrxr ot1ale mo3iatfm rm(vs u)tlenif3iatoaD aies;(  rxoxrpny4lptnmfcsas  rtax  ;o1apenmf3iyslaDra(mp;t0tlxrxr oatoaDr uvs s0s2to(opnu1ap   ici s)arrru p;o4aleo iciydlaDumuvpn(4 lxnmr to1fm e u s s trtm(o3iy1amte ies s) 2trxm nu4teeoiieiatlaDem(vo;(0 lxrxf tadlm  luei t0 eumxrpoo1lmen ivtlsfa2rr(m ot1ale mfciad a2rluvs;u0 rxoif to1oat lneol( s2um(r oy4ape  netl( s2umu  nu4aleniieiat sDrlumo;u)alenio iodfmDrli s;t srtrim3nydom   ivsls  rtau o;o4oetnmocilslm ul(ms;(0arenxr iy1lpD aiei;s seuo(m3oodam nlfetls)aDtm(moou0tpx mo3ilt a2rm( o t4 etrir3iy1oa   uvi () 2um(mpiy4al   ivt (  Dtmurpnt4tptn ictasla ulnvon(4aeerxfcoydlp r i i;()t2xr(mpnu4altnlict t aDrmu pnu1alx iictyt aDrauvon(4altnmf3iydfmteaueo (0trumxm3oo4amtnlfeiasf Dur(mp;o1olx if3ilt mDemumsnu4aetnio3iydfpt aneo t0 2trxm3iydoleemfetls)s2tr(monu4teenifciasla2ea(vo;u4 lxrifciytlaDelnvsls)t2xoiopoodom nlnci t) 2ururonu1aex iocilslm el( s;u) lerif3iatfptrln s (  2toio3oy1lpenlicils a2tru  ot1oltnmi3iat sDul(mpnt4aetrmocoodomDraivs;s)setmirpoudlme  fei s a2taxm oo4alxo ociltfs rlums;() rerxrcoydfmt  neo;(0 rtrxm3ou4lme  fesltfsDrrx o;u0tpxnmf3tad m2elnms;t0 rtoifcio1lmDrliesls)trumir nu4omeemnvi s) rra( pno1oltn o3iydlm em( on(0teeriocoydopDe u i;s  rtrir ou4llenlfvsa(fsruaumoot0opx moetat mDeaumpn(0trtrxr3ta1fmDeluvs t s2xmxrpiy4oltnlfvs s) Dtaxrpno1oetnmoeildla rauvs;t) leomfctotom e u i;t) rtrir oudlpte fvt t)arur(root0tpe iieiad mDelu snt0 leoxo oydfmD lu o t)texrxrpiy4alenmfeta()s2ur(mpno0open i3taslm eluvo;(4aexrio oatfm elieo;t0setoxr iu1olee fvt ()a2umxrpnt0aetomo3ias a em( ont0treoiociadlm  aivs;t  2trxm3ou4opeelnci t) 2rr( ont0texo fctyd m2emumpnt0trtrif3oatlm elneo;s)srxm(m oo4opeemieilt)aruax  ;t1aex  o3iltfm2uluvpnt)aeeoxf iytop e iei;s s2to(rpiy4om emivtls s2rrumo;u4apxnif3tlsls2um(ms ()texnmrcoodlmtrlieils0 exoir3iydameemncsls  Draur ;o1olenio3ias aDul( p t) eenmocto1lpDraivo;t0 ruoxo iodopenmfciat srraxroou0ape if3ildla2rmuvsnt0aetomr3oydfpte uvs t) rxmxo3nudop elneia(fs2urx o;t0tltn o3ild s uan o t4 reniocoa1lm eaivs t teumirpio4omtnmfesasfs2tr(rpno4aptnifciadla2ra( snu4texoxf ta1la eau s s0trxo(r3oy1aleemncsl(fartr(rp;u4opxnifcild a2rmnms u0 ltrmf tadlp  ln slt)srurim3ny1aleelfvi s sDrrxront0tlen f3tltfsDeau snt0tlxoir3io1omDelu slt s2xrxo3no1ol  livi () Dtrxrp;o1tlt mfcilsfsDumnmonu)tetnmrcoy1omDelnei;s0 rtm(o io4lltnlfvs (fsrtr( p;t1tpxoiiciad m eanms t0texrmr io1fp elues;s  etoirpio1apt mnetas sruaumoot4oex  octatfs um(mp;u)teerxo io1opt an s;s)t2xr(m3iu4lptemivias) 2uaurp;o4oex mictysfm em(mo;u)aexomo iytlmD  ieol( sexmxr3no1lm   ivs t sruauront0tpxn ocilsls rlnmonu4trtoxo iotfp rlnvsl()srxmxr3iy4al  livsa()aDtmx pot0opt mf3tyt sDulnvs;()artrxrcoy1late uvslt srtmimpiy4ap emivtlsfsrumumpnu4oltn ictasls ulumo;u0aexrif3oa1fp eaiei;s) 2xoxr oudolte ncs t)arum(ro;o0oex mociltfaDea( o;u0alerir ta1lp eauei s) euo(o ou1opeemfviasf 2rmu  ;u0tpx  o3tydfaDeanmsnt0aeerxrcty1oaDran o;()teto(rpoo1amee iet s) 2raxrp;u0tex  ieiytlmDrlumo u)alenio oy1fp  an olt0 rtrirpiodalee fvs (  2rr( pot0ole mf3ild sDem(ms (4teeoxr3tadoatrluvi;( trtmxr iydom elivt s)aDta(mooo4altniicils aDeau p t) rtoir ootomDrlivo;s0s2ur(o iydomtnliviat a2um(mpou4apx  feiatlsDel(vp;u0 exomfcoa1lptraieilt)seumxopou1om elfvia()s2tmumo;u0teenioeiysfmDranvonu)aleoxo todop  lnei s s2ur(m iu4om emfvi s) 2rrx o;o1alto f3iytfs ul( p u) reoiociadom elivslt trtrxrpoo4ap  lnetls sDumxmp;u1aee  iciydla rmuvs () lerif3oy1fmD  uei t s2tmio no1lp n neslt)aDtr( p;u4tpenmociadls2ran o;u0tleoxo3to1fmte u ilt)srxrxr iodoptnlivtlsfsrtm(r nt4opt mieiytfa2em( p;(4tltomf3oo1fm r n il()t2uoxr3no4lmenmieilsf rta(ro;o4aleo f3iydfm2emumont) lermf ty1fa  lueo;s)teur(o oy1om nmnetlsfsrurum nt1tpe ifciatfmDrmuvon(4areomf iadfm r nes s)t2xmxr ou4olte fesl(  rrmurp;u0aeeomieiltfa rl(vont)trxnif oy1op   n i s0sexrxo iy4lp  lfvs sf 2rmurooo0oexo o3tyd aDea(vs u0aetrxf3iotlaDeln o;( teuoimpnodlpt livsatfaDtau pot4aleo f3iasfa2ra(ms;t)trxnxo oo1lp elivslt0s2trxr io1op emiei t) rraxm nu1tpxn f3tad sDrmumo;()altrxfciy1latr ivols) rtoxm3iodal e nvslt)s2rrumpou4tpxomfetytfm2ea( o;u4tetomo to1oa  anvsls0teur(m oo1am n ivt s) rtaum ;u4optnmf3tytls elumpnu0 reoxo3iadom rluvo s)t2xrir3nudole mfct t s2tr(  nu4oeenif3tasfsDeln pnt4teermo3ty1op e nvo t0texmir3nodol e neta()sDuaur nu4apenmoeiltfm ua( p;(4 eenxf3tatopteauvs ()texoxr iodamtnmnet s)arrmu oou0tleoifetatlsDulnvpn(0 rxnir3oa1lp rlu ils) 2tm(opou1altn nes () rtm(rp;t0tltnioetaslm rau pn(0 rxrmrcoadom  lnvo;t0 rxm(r3ny1aleemictl(fa2rm(  no1olxnifetysla2umnmp;u4altnmrciatfmteluvs;s0trtoxo3oydomte fesat) rtru  ;o0aeeomictlsfmDrm(vp u4tetrxr3oo1opDeli ilt sexoiopno1ole mfciltf 2ur(m ou1tlt mo3iltfaDumn o (4treoxrcoadomDr n ils0 exrio3oy1om nlivil(fsrrau pnu0tle  f3iatfs2rmu s t0 lxriociydlmteau sls sruoim3iy1lpenlnetat)s2raur nt1opxnmoeiatls ra( pnt0 etnxo oydlmt lieo t s2xoxopiy4omtelfei ( a2uaumo;o1opt moctatfmDulu s;u4tltrif iodfm eaies s trurxm iudlltemfvta(faDurx  ot4tee iictld m umn snt)tleoxociydfptr u s;t)t2trxrpiy4am emictas)srum( p;o0texomoeiatlaDrmums u0altnmr iytlpD lu i s)setoxrpoydlp e nesltf 2tr(rpoo4tet  icilsla2ua(msn(0 reoxf3todop ean o;( setoim3ny1al nmfesas) 2tm(rpnu1tpe mf3iadls2em( on(0alxnxfctadla rlu i t)srxr(r3oy1ll nlnet ()sDtau  ;o4tex  i3tyt mDranvo;() rtnir to1oate ues s0 2umxr3oudol elncs ()s2trxmoot4tpxo ieiasfa rluvs;t0 rermo ootfat lu o t)trtmxm nu1ap   iei tf Drrx  ;u4texomieiyd m eluvo t0tlxrxf3oatlat luvi (0trtr(m oy1ol  licsas srum(rpot1tpto ieiysfs eaumo u4arerxf iotom rlueilt0t2trxr3oy4ape lietltfaDraxr no4tlxo ictls m2ean p;t)aetoxociodlp rln s ( seuriopny4alte ietltfaDrmx pnu4olenii3iys a2rmnmp;(0alerxrcootlpD  i s s0s2xm(opno1lptelicils)artr( pnu0teeoiicias mDeanmo;u)teerifcoodlpt  nvils0srxm(rpiu4ap e nvs s sDtau p;u1aetnmfetat m2ulumo;u0 lxoirciotlp eai ils s2xo(r no4ale mfviat) rraur nt1tlx miciasfs2ea(vs;(0trtrxo3iadlm   uvols0sexrxr3iudopee fvs sf 2tm(r ot1opt  fcilt aDrl( s u)tlxoxfcoa1fptr ivi;t)srurxo ou1altnlicsl() rrmumpou1texnii3ild s2umuvp;()teeomo3to1opD anei;()truo(o3oy1lpen net ()sDua(r ;t4tpx  ieiydfsDumn s u4 eermr oydla eluvo;(0 exrim3iy4lp  mnvil( s2tr(roou1tlt iietltfm el(vo;u0trtoxf oytfmte ies;s)s2urxm3oy1lm nmncslt) Draxmpnt0altoii3ild sDrlu s u4tleomrcoy1oaDe uei s)sruoio3iydame lnet sf Duauronu0aeenmi3iltla2ulums;(4aexoxo3iotfat  ivils0sexo(opiu1op n neil()aDuaump;t4oeeomfciytls rmuvsnu4trtnxf3todla rli o;t)srum(rpnydaleelivsa(faDrm(mpnt1aexnmieiysfa rlnvs;t) rerxocootfatelnvo (0 eto(r3ou4alte nct s aDtm(rooo1oex  ociadlm2rmn p;t0alxomrciotfmtrluvi s srxm(opiu1ape lnetls) rrr( pnt0ale  ieiasfa2rmumonu4tlxoio oatlpt aieo s0t2xm(rpio4ap  mnvsa(fsrtmurp;t4teeomoctls sDum(vp;t0aetrxo oytoaD  uvsl( trxm(o3nydlmtnmncilsfs2ra(r no0tetoiociasla2rluvp () lerxrciy1omDrli i (0 rtoim3io4al emiei () rurxront4aptniiciyt a2um( s u)trtnmo3oy1lm rau i;s0teuriopiu4ole liei s  2tax  ot0oexniietlsls emumo;t)alxoxo3iotomDelu s (0t2xr(opou1lm emictls arta( p;t4olxniociatfsDulnvs u4tltrir ia1laD  ueo;s0 rxmio ou1llt  nvt t)aDrm( poo0olxn oeilt mDea( p t0artnir todoa  li ils) 2xm(o3iudalenmietl( s2rrxm nt4tpen fetls sDemuvs ()trxnioctydfp eau sl( trtrxm oo4amtnmfvsl(  2uaxro;t1oet mfetlsls2rmuvo;t0tetoioctadfp e i s () exoxo3oy1llt  fet t  2tax ont0oleoii3tltlm ra( s;u)trxnmo3tydopte u s;t t2xrxr3ny4om emiei ()arur(  ;o4opto i3iadlm2rl(ms;(4arxrxfcoydfp  lieo;s) eum(rpiy4llt lnvsat) 2rm( ont4oeeoii3tasfa ul(ms u4 eenmrcio1oaDrai s;s  eurio3io4lp emneiat)srta(m oo1tltomf3ilsfa eluvo;u4aetnmr3iotfmt aueo t setoimpiu4am nlncsa(fs2urur nt4texo icildla rlums;u4tltnifctytfpDeluei s) 2xmxmpnu4op nlnesl(fsDua( o;t4aleo oeiadlaDuln onu0 exnmr todfa elnvi;s0s2um(m3nu4am n fvsa(  rrauro;u0tlxo fcildfm ra( snu)trxrxf3todfmt an sl(0texmio3oodamenmnvils  Drr(  ot4apt mi3iyt m2ra(mo t0 lerxr oadop eanei;(0seurxr3nu4optnmfvsat) rumur ou0alenioeildlm uanmsnu4 ltoircty1op eanvi;()srtrxm3nydlmtnlnvta(  2taxmoou4tet  oeiyslsDemnmp;() rxrio3ty1lptr iei s  2uoim oy4olee fvt ( a2umu oot4oee moeilsfs2eluvs;t4 lxriocty1fmtrlu i s) rum(m3iodlp nlnesa()aDtrxmono1olxnifcildlaDrm( o;t4alxrmociydlmDr ivsls t2xmxo3iy1alee fcta(fartrxmo;u0alt mi3iyslm el( s;t4areoxfciodlpDrai o;t0 etrxm3iudll  lnvtl(  rur( o;t1apt mo3iyd s2umu s t4aexomo io1fm  auvs ( s2tmxopoy1optnmnctltf Dur(m nt1olxn ietatlm uau s;u4 lxoxr oatfmtelu o () rxmxo nydlpe lnvtatf 2uru ono4opx ioeilslm uluvo;t0treoxrcoytoa rlivolt0 2tmxr3oy4olee feiltfsrtrumooo4alt ifctas m emu p u0altnxo3todoaD auvi;s)teumir3iy4omeemfciatfsDta( pnt4tlt  f3tad m emnvs;t0aeeoxo oydomDelivo t)trtoio iy1op nlfet tf Dua(m ;o1altnmfetysfm ranmo;(0 etnxocoatla e nvs;s tetrxr3oo4om  micsl() 2tm(r oo4olt moetytfsDuau s u) lerif3tydlmtr i slt)t2xm(r oudam emfvsa(farrru pou1alxo i3iys a2elnmsn(4artrxrcootopDrlivo;s0sexm(r iudlpt mnvslsfsDraxrooo4tltnmieiat s2ulu s;u0arxoif3oydfpDe n il( s2xmxr3oy1lltemnviatf Dumur ou0altoii3iytlaDranvs;(0teerxociatfatraues;s teuo(rpoydlm n feils)s2uax pnu4opt  ictld a rl(ms;u)trtnmr3iy1optr i ols)seumio3nudlptemnvtas) 2uaur ot1alx  fctltlm rlnms u4 lxomr iytfpDrlnvs ()s2tmxmpnu4oltnlfvslsfs2trum ;t0tlxo oeils mDel(vpn()tetrmf3totla   ivs;t) euo(o3ny4ol  miesa(fsrumur ;o0apxoif3tltls ea(mo t)arxrio io1fmDrlnvo;s)tetrxr nudoptn iesls  2trxm nu0apt ioetlslm2raumon(0 etnxfciodomtranes t)s2toio nudam   fvtl(fsrurur ot4tptnifeiltlaDrm( p t0trtomf totfat aueol() euoxr io1opteliciat)aDrauro;t4oet  ietasfa rmn o;t)tleoio3iodfpteanvs ( tetr(rpou1omeelfcsltfsDrmumo;o1olxo i3iasls ranvs;t4areoir ootfpD aueol( texm(m3oo4om  mivi tfs2tmxmp;o1oleomiciasls raump;t0trenxr oydfpD  ieols0 eur(r3iodam nlietltfsrtaurpnu1oeeo i3tad sDem( s;(0alxnmfcoytomt aivo (0tetoxm3io4lpte iet s) Dtmxmo;t4opeomi3iatfs elnvs t0teeomocoy1fmDrauvo t  rum(rpiy4alenlictlt  Drr(m no4teeomoeiltlaDrlnvsnt)tleoiociy1fpDr n ols srtrxr no1apeemivsas aDumxmpou0opxomfeias aDumnvs t4teeomrctatlm elnei ( srtoxr3no1olt  fvt (fsrrmx  oo4aexnmoeiatfm2emnmsnu4artrxrcoa1lm  aieol()trxrim3oo4ale lnvias)a2raxmooo0ape iiciatls2rm( p;t)trxoir3todlmDrau slt  2to(m3iudolt livtat)a2taumonu4aetomi3ias sDra(mpnu)trxnxf3ia1opDelnvo;t s2uoirpnydoleelnvslt)sDrrxr no1apt moetls m rluvont0trermoctatlm ranvo;(0s2trxopnydam  mictl( a2umxr ou4altnioeiysfmDum( o;t4tetoxo3oodfatrauvo;(0s2uoim3ou4apt mfcsas  2um(m ;o1tltnmfciyd s ra(vpn()tleoxfcoo1laD  ivi s s2urimpou1lmte fetas artmxr ;o4tptnifciyt sDeluvo u0 ltomr3iatlm rlueo () 2tmir3nodap emivtas)a2rrx pnt4ole moctlslm2ra(mp;u4altnif oa1fa eliesl(0 etoxm iy4llte icsatf 2rr(moou0tpe ioetas sDem(monu0 lenxoctotoa  lu s;s) exmio3nodalte feiasfsrrmur no0texoii3tls sDrm
\ No newline at end of file
@@ -0,0 +1 @@
+uvslt)s2urxm3io1lpt  ict t)aruru o;o0oet moeilsfa ran sn(0trxomo oodlptr ueilt0 etm(m3oodaltemieiasf 2rmuroot4apxnmietytfa2eanvp ()artomr oadoat lieo (  2xmir3iudoltn ncia(  2rau ont4aetn fciltlm2eaumo;()arxnmo io1fmDeauei;t0s2urxrpnu1optnlfetl() rtaxmpou0opx mf3tlt s2umu pn(4aexrxf3oytfp   ueo s0 2urimpoo4lp e nei s) 2umxm ot0tpt iiciltfa eaums t)texnifcty1fpDr u i ( srtr(rpnodlme mnctl(f 2tm(ro;t0apeomoetadfaDel( ont0aeeriociadoate ueo () ruoirpoo1alenmnctls  Dumxr ;u1alx  ietysfa2rmuvont4aetoxo totfmD anvs;s0t2uoiopiudope  icsas sDta(  no1olxniietls m2um(ms;t4tlerircoydfpDr i sls) 2xoimpno4opeelicsltf 2ra(  ;o4teenioeiatlm2rmuvo;()tlerxfctodoptrlnesls0 rxm(rpoy1lpeelnvia(farrru  ot0apxomoeiaslm2raums u)alxoio3iy1fmDeanvs;t  2toir3oy4optnlivi sf 2ra(m oo0olx io3ildfsDumnvs;t) rxomf oydop r u ilt0srtrxmpnu4amtnmnvi sfaDrmur ou0ale mieiat m umu sn()aeeomfcoa1fa r u i ()trtoirpno1lpen ivi s)s2taur no4open fctatfm2ul(vs;(0aeenmrciotopDrauvol(0 rtmxrpou1aptnmfes s  2rrur oo1apxomo3ias mDea(mo;t0 exnmf oo1latran s (  rxoio oudopt lncslsf Dua(ront0tpenifctytlsDua(mpn()tltnirciadla e i i ()s2trir oydlltnlivsa(  rtrurpnt1olto icildlmDrln sn(0arermrctydlptr uvo t0 2xoxrpiodomt lfcias arur( pnu0aleo ictyd mDranmp;t0aexnxfcoytopDeluvo ()srxo(m3iudop n ivtls  Dtm(mo;t0texnmo3ilsfa um(vpnt4tltomo iytoptrluei;t setoxm iydaltemfetl( s2umum ;t0tpxnmfetas sDrlnvsnu0 rxoxf3iydopD anvil()srurirpiu4amenlneil()s2uru  nt0aexn ietld s2eau o;()tlenxr todfp rai i;(  rtrxo3oy1ape mfeia(f 2urxmoou0tetn o3iydlsDumuvpnu)alerif3iotfmt  uvo;s) rtmim nodameelfvi s)srur(m nt0oex  fctatfs emnms u4 lenif iotfmte ieslt t2xrir3ny4al nmnci t  Dumxm ;t4tpenii3iatlm2uln p;u)alxnxr iy1opDraueil() 2xo(mpiodom  miesa(fa2tmx o;u4oltomoeilslaDel(mo;()alxoxf3tydlmteai i (  euoxrpoodamt mfvias srrr(rp;o0oee ioeiydlsDuauvpn(4 etoio3oytlp rlneils0s2um(o no4ole mnes (fsrtrxmo;t1alx  o3iysla rlnvsnt4trtoio3ia1omtrlnvs ()tetoxopoodome mfciatfsDrmu ono4tetnmo3iasla uanvsnu4tetomo3tadopD lueo t t2urxm ou1lmenlfeiat)sDururp;u1apt mi3iyd sDelnms;t)aetoif iydomt aiesls)teur(o iy1omeemfcias) Durxmont1aptn feils aDemnmont0aetrmoctatfmD li i s)s2xrio3ou1ale lnet s arumx  ;t4tpxoio3iyd a um( s;t)trenmrcta1la rluvo;s srur(rpiu1am nlfvtls arur(  ;u0optnmo3iydfmDem(vpnu0artnmocoatfa e nvi;t  exrxr3io1amt  ieiatfa2ra(rpnt4tlxnmoctldla ea(vo;t)areomf ty1opD aivs () etmxm oydapenmnvsat aDrrumont4apen o3tytfa rlump;u0 ltnxrciatfptelies () 2xmxrpny1lmtemivi t srrrum nu0apeo fcildlaDemnmp t4teermfcoa1omDean ols) rxrio3ou1am nlivtl(f Drrum nt0olxniieildla um( o t0artoxo iodlmDr uvilt  rxm(o3ou1lme  ies ( s2rrx pnu1tee  o3iysfs2emnvs;()texrmfcoytfa elieo;( sexoirpiu1lp elfei t) 2ta( poo4alt mfeilsla2emnvs;(4texoxf3iodoat lueo t0 2urir nu1am  lics (farrm(roou1oltoioeiydfaDrm(mp u4aetnmr to1faD aueol(0 2trxopiodoltelnesa(  2rmum ;o4tlxomi3ils m2rmums;(0trerxr iytlpDr neo ()s2xo(o no1apeelies t)srur(ront1tpto ieiaslm ran snt)texnmo3tydopt ai ils)tetrxmpoodal emfei () rtaxr nu4apenmfeiyt s el(vpnu4teeoxociytoa e n s;(0setmiopio1lmt lneiasfaDuaxmoou0teenmieilt a ranvs;t4tltrmr oa1oa  luvs;( t2uoxr3no1om elfctlt sDtm(ro;o1tlt  i3ild m eln p t0 ltoif3oa1fm elneo;s0t2toir3iydlp nlfvils)a2ur( pnt0alx  oeiysls rlump;()aeerif ty1lpt  nes;s)sexoim3nydop  lici t s2rrxmpno4tlxnmf3iasfs2ra( o u0aetrxf3tytlmteluvols) rtrio3nu1lmenlnes t)aDtaxrpnt4apenif3ildlm2uaumpnu4texomo3iatfpte neo s)tetoxmpnydamtelncil(fsDumx oou4ope ifciadlaDem(mp;(0 etnmo3ootlpDelu s;s s2toiopiudlp emfvsl(faDur( o;u4aetomoetadfaDemn s;(4artnir oy1lmtrluvi;t tetmio nodol   fcs t aDrm(ronu1oexn ieildfm ul( o;() lxrio tatom e neo;t tetmim oo1lm   nes ( aDraxr oo1tpx ii3iyd aDulu s ()tltnxfctodlmtraieols s2umiopnydap e nesatfsrum(mooo1apenmf3ias a2ua(mo u)aexnxr3iadom r ieo;()setrim3iydam n fvsa()arrm(ront4tleo i3iadla2uluvs t0arerxr3totlpDranei;s srur(r oudll  licsl(f 2ta(m nt1tlxniieiatfmDeauvp;(4tetnxrcia1faDraueo t)t2xmir3iudom nmnvtls  2rrxr ;t4aexniiciatfs rlu snu4 lxnxf3tatlaDe i ils) ruoxr ny4ope  nci ( a2uru oot4ope  feildfmDeln snu) exomf tydlpD  uvs (0t2xr(o oydlm nlneil() rtaumono1teto ociad a uan sn()aeenmf iadomDeluei;s0sexrxr3iu1ameelieias s2rmxmpou1ope  ieiatlsDelnmp;u0trxnircto1lp  lues;t0setoirpio1lp nlfvilsfa2umxro;t1tpx miciadls ulnvont0arerxrcty1latran i;s) rxrxo iy4lmtn iviltf Durxr ;u1alt  f3iytla2em(vp t0trxrxfciotfmDeauvs t  rum(o3no4lmtnlieiat arrrxm oo1aee  feiys sDulu ont)areoxr3io1lpteai sls)t2xr(o oydlptelfcsat  Dtr(  ou0ape moeiydla emn ont0artnmfcio1lptraivi;t t2to(mpiydapt  ncs tf rtmumpnu4oltn f3iltlm rmnmo;(4arenif ty1optrlu i;t0 etmio3oodlmenmivt sf 2ta( pou0olxomieiyd m2rln snu0treoxr tadfmDrlieo s  rxmxo3iu4optemiei t) rumxr oo4tlxo oeiltfsDrmn s;(0 ltrio tydopD au o t) rumxr oo4ale  ivta()artm(mp;u1apt  iciytfm2raumo (4aeeomr ootlmD  uvs;t)t2xmxr3ou4op nmncils arum(rpnu0tlt ioetatfm2rauvonu0 lenmr oa1omDeauvil() rxmio nydome lfetls  2ua(  ;u1ape  oetlsfa umums;t0tlxnmocio1fatr nvols0 2tmxrpoudomtnmfeias)aDrr( oot4oleomictasla emump;u4teenir iytfa  aies ()srumir3nodll emies t artmur nu4oee  o3tasla emn s t4treomf ia1laD  ueo;t s2uo(r3ou4ame  iet (  rumxmonu1tlxomfeiytfs2rln s;u0tltnmo ia1fm rlu il(0t2urxo iydom  lnvslsfaDtax  nt0apeomfeiltfs ean on(0trenmo3iadoat an s;s t2xoxo3oo4altn fei t aDta(roou0opxomo3iys a rluvp;u)aexoxr3iydopDranvi ()trto(m3nu1amtemneiat)arurxmp;u0tetomiciyt sDua(mp t4teerxf3iy1lptrlneils)t2xoxopnodam  liet t aDtrxrpoo4apt moetytla2eln s u) eenio tytomte uvi;(0tetoimpnodom nmncils arrr(mpou4oetoif3ilsla2ulumo;t4trxnxr oatfatrluvi;t  eumir nu4lp  lieil( a2rr(rp;u4olxoiietad a2rluvon()texnxf oydfmt lu o;s0trxoxo oy1ll nlicsls artaurono4tet  fciytls2eanvp;(4 exoxo iotfp rluvo;()trxrxmpnydomeemfcil()s2trxrp;o1tpx iieiyt mDua(vo ()altrxrciydom r neo;s0texrxo3iu4olt  fetlt srumx pou4tpe  i3iydfm emnms u0aexomocoy1fp ran ils sruoiopoydlptnmfet s srurur no1tet mi3iyslm eanms u0 rerxfcoa1fp rai s;s t2uoxo3oudlle  fesls) rra(root0oee  i3tysla2um(vo t4 rxoxo3to1laDraivil( seto(o3ou1lm  lfci s a2trx  ;u1opxn f3ilslsDulu on(4teeoirctadfa   u s ( teumxo3iy1om eliesatfarumx onu4altomi3iydfsDra(mo;u4aeenxr iadfatean o;t0t2xm(o3oo4ole lfvt t) 2tmumo;o1olxo oeiatla2ua( p;t4areoif3tatfp e n o;s sexrio3iudol e ivi (fa2tmumpou1oex ioeiatfa emnms t4texrxr tatlp  li s t srtrxm3iudopt lnctls)srtaxr ;t0aeenmoeiydfaDemumsn(0altnmo iodlpD luvi;t seuoir oydlp  micil() 2rm(m ou1oet  i3iasfm2eau s u4trtnxrcoodfm rln i;t  eum(m nudll n icia( artrurpnu0aptnii3iydfm2ulnms;u0areoxocto1la   n olt0seumim3oy1aptnmnetlsfsDumumo;t1apenmf3iadfaDuln p u0artnmocto1faDelies;t)srum(r iu1lpenmfeias a2raum no4apxomfciltlmDean p u)tlerxfcoytoatrau i t  exoxo3oydlp n ivia() 2uax  ;o1tpxnio3iatlaDul(mo;(0tltomr iytfm e ieo;s)setoim oodoptnmicslsfsDuau  no0olt if3iltfs2eau p;u)trtrxfcta1la  ln ilt0t2uoxo iydameemnvt (faDtaurpoo0altnmocild m umu s u0aexrxo3tytoaDeanvsl(0seuoiopiydll   ietlt)a2rr(m oo4tle miciadfs2umnmo t) rtnxociodomDrlnvolt0sexr(r oo1lpe mnet tf Dur(rp;t4texnio3ilt s2elnvpnu0 etnirciytfptrlu olt0 2umxr ny1ll n nvta( arua(m oo0aeto octltfmDemn onu4texriocio1opt luvi ()setmxr oodlmenmncsas a2ua(r ;t1teenioetyd aDrauvp;(0 reomr3tatfa  aieils0srxoiopio1ame lnet tfsrumx pno4tpx  iciytls emn snu0trerxocoydfptelnvi;(  rurir3nu1omeemicia(  Drax pno4tpxomieiytfs2uau snt) rtnmfcoodlm  aieo;s)tetm(m3oy1am nmnctltfarrr(r ot1olto fetad aDuan s (4 exrifctadfpte u i s)texo(r ou4apeeliviat aDtmur no1tpe ii3ias s el(mpnu4trxoxo todfaD lu i s)sruoxo3oudamenmfviat s2ta(  nt4oltniociydls2emuvsnu) etrxf tytfp eai ils srtoir iu4amee fcsltfa2raxr ;t4aexo oeilt a emn p;t)tleoxr3oo1oa ranes;t)trtoir oodlptnlfes t)arraxr ot1tpt if3iydla2rln sn(0alxnir iodla r ivi;s seumxo3nu4al e fvil(fartr(mo;t4altoiocilt sDemumon()tleoircootlmDean o;s0 exoxrpnodalt  nei t) 2tau p;o4tlenmfeild s2umnvon()tltnmf3oatfaDeluvol() rxriopnu4oltemneilt s2um(  no1apeomfeilsfa2umums;u0 reoxo ootfmtr n i t0 2uoxo3iu4op  mnvtasfaDrr(r ;o4olxniietltls uanmp u4tlxomr3iadop  luesl(0 euoir3ou1lmte nvt sf Dtru pnt1apx iiciltlsDel(mp;t0teerxo oatomD lneo t srxrxm nudal elictlt)aDtrx oot4aleo fcild a eau s t)alxoifctytoatranvsls  rumxm iy1ap emies (f Draur ou0oeeniiciltfa ulu s (0teenif oydlmt anes;( s2xrim3iu1optnlfeils aDrmx ono1alxnioetld m emu o;() rtomfcoydop  li o t0 etmxr oydaltnmfes t)s2rr( o;u0opt iieiltfmDuanvp;t4arenmocty1op e u o;t0 rxo(rpiu1am nmneils)srurur oo1tleniieiyslm uau pn(4 etnmoctytopDrln s;s)srxrim no1amte nei tfartmum nt1tltomf3ild s2elnvo;t0 ltrmr3iodopt ai sl( sexo(mpnodomeelicsltf 2ur(r ou0tlx mo3ias aDrmu o;(4 rermf3totlm elu ol(0srtrxr iudapt lfet s)aDrau  ;o1alxo feiadfa2rmnmo;()arxoxr3iatlpD livi ( s2trxo3ou4omee nesltf Dumxr nu4tlxnmfeiytfa ulu o;u4tltoxf iatlmD auvo s t2uoxo ou4op nlivsatf Dua(rp;o1apx  ociydla2rau p;()trxrif3iytop r n ilt0sexmio iu1ap  mnct sfs2rr(m nt0tlxn ieiad a2rmnvon() ltoir3oytlmDelu ols) etoxo io4lp elicta(  2tax  ot1aee mfciytfm elu p;() etoxo3tytfmDrauvil(0s2tm(m oo4altn ivtl( sDtrxr no1oeeo i3tys a2ulnvp;() lxrir3io1faD  uvo s sruoirpny1lmee ivsat  Dta(rono4ape mociatls uanvpnt0teeomfcty1late ivo t)s2uoxr3oy4lptn feilt) rrmxrooo1tetn fcils a2rl(vo;t4altnxrcoodomD  neo s0 etmxr3ou1lme mfctl(fsrumx  nt1tpxo i3iydla2uauvon() eeoxrciy1fpt  uvo;t)t2xo(r3ny1ape lnvi t a2urxmp;t1aleoiietlsfm em( on(0altoxo todfaD  ivo;s t2xmxo ny4amtnliviltfsrtmxrpnt0tltnifciltlm rauvp u) etnxo iadopt aivs s0t2trxr3oudal  lncsltfa2taxr ;u0ale mfetltfs2rau s u4tlermfcta1opD  neils0srxr(m3nudapeelfct ( sDtrxrpoo1ale mociys sDuaumo;(4arxnif3oy1fmt  uvols0 rumxr no1llen feslt)sDum(mo;u4ale moetlsls2eln s u4tlenxfcto1fmt  nei;( teum(rpny4alt micia() Drmurp;t0alx  o3iasla2ea(mp;t0 reomf3ta1fatrluvilt srtoxmpno4llenmnvsl( arur(  no0texnmfetys aDra( p;(4treoxo3oodomteaieo;t truoir no1lptelfvi t a2rmxmoou4olenmiciadfaDeanvo u4trtnxr3iatfmDrlues;t)s2xr(r3ou4olenmfvs s) rtm(mpnu0olt mf3iyt mDrmuvpn(4trxrir3ta1lpD  nvo t0srxrxo3no1ome  neta()s2tm( ont1texo o3iltlm ul( s (0texnio oa1lat aieo;t0texr(o nu1amee fvta()s2rmxmpno0apxn oetydfs ea(vo (0trxoxf iotfpD  nvi;t trxoxmpiu1lle mfcs t)a2tmx pnu0ope mf3iatfaDean s t4arxrircia1lmt an i s  rxo(o nodlmenliei ( srrrxmo;u0aee  fctadlaDrmu snu4 lermf tytom e ieo t0 rxmir iy4om  mivt ( arurxrp;u4tlt mo3ias mDeanvo t)aetrmocia1fpt luvo s)trxmio iudal   iei (f Drr(  ;o1oeeo o3ils aDumuvs u0 rxnmf iodlaD lnvo t)trxmir3ny4lmtelivtls  2ra(mpno0teeomietasfm emnvp (0arenxo3oodlm  an s;()s2uoxo nu4omtn nvsa(  Dtmxmont1alxnifctls a2um( pnt)aexrxf tadom   n i;t sexrio iy4ame mnet t s2ra(rooo4oex ifcias m ul(ms;u0arxrmrctodoa  lnes ()srtm(rpiy1omen ivia()sDraumono1alxoiocildla eau o t0arxnxo oy1faD livi;() exoxo3ou4lptnlnvtasfarua(rp;u0teeoiiciatfaDum(vo t4texnxf tatoa elnvi;t0teurio3nu1ap  livsa(f rrmx  ;t0aptnmieilsfmDeau s;t0texrmf3totoaDrluvi s0trxoir3oy4omee nvilt)a2ta( ono1apxoio3tytla2uaumsnt) eenxo3totfmDr ieslt)trxoxr3ny4ll  lnvi t aDra(mono4aet  ociydlm2ea(ms;u4 ltomr ty1lm ranvo t  rto(o3nodllee nct t srraumo;t1apx  ietas mDra( sn(4aleoifciydlaDrli s;s)srtoxr oo1omee ivt t)artaxrpnt0oexo fciysls um(von(4areoif3oadfmteli o t0 eumir3iudol elnvslsfaDtax oou4aee  ociat m2eluvp (0 leomrcoa1lm e i sls  2uoxr oy4lmt liei s)sDumxrono0ape  f3tasla ua( pn() lenmr3ia1omDeaivilt  2um(m nu4lm   net t) 2uaxm ou0tlenmieiadfs el( ont0tltoio oo1lm raueil(0 rtrim3ny4lptnlfcsas sDrr(r ;u0tltomfciyd sDemn o (4texomo iodlp e ivo;()t2xmio3nodalteliei t arum(mp;o0olto o3tad s emnvpnt)alxoxo3oy1fatr uvi t0sexmir3nudalenmfvtas)sDur(ro;o0ole  ietld sDel(vpnt0trtomf3ty1fat aneil( sexrxm3iudll nmnvsas) rua( pou0aexomoeiatlm uan ont)aexrxociadla  lnei t)s2xmxrpno1lptnlfvsltf 2urxm ;o0opxo icilt aDeanvonu)tltrxocoatomtran i ( setrxr3oo1alte fciat s2trxmpnt4tptn fetltfs2rl(ms;u0trtoxrctadopDrluvsls)s2xm(r iydop elietl(  Dtrur oo0texo ietad m2ranmo;(4 rxomociodfa e ueo (0srxmiopny1al nmnct (  2ta(r nu4tlx ii3tyslaDelnmo;t4arxoxo todlmD livs s0texoiopnudalt mieilt  Dtrx  ;o4teeomf3ias sDraumon()treoxoctotlp rlnvol() 2uoxm ny4ome mfct sfsrur( poo0aetnmi3iysfm uln p;t)altrifcoa1oaDrauvs ( trtoir no4aleemncil(fs2rau onu1alxo feiydfs2emuvpnu0alxoxfcto1lpte uesls srxm(opoo4ap nlnvt () Drrxr ;t1opxomi3iadlsDra(msnt0arermf oodopD  i i s  etoim3iydlm nlnesl()aDururpnu4aexniicildlaDrluvonu4 ltrmrciytlpDr iei;s0trtm(opoy1am   nviatfsruaxmo;u0aex if3iysls2emums;(4artrir3to1lat aieol( t2tr(r iydale  nvt t)s2rauro;o0teenmfctysls eauvo (0aetrio3oadom e ies;s0t2xrxm3iodomenlivilt) rtm(rooo0altn iciysfa2rmu s;t4 lerif tytlm eaieo;s trtmxo3ou1omenlivta(f 2tauroou4tee moetysla rl(mo;u)tleoif tatop   u s;t) 2xmio3oo4ap n ivt s sDua(rp;u0aee  iciytlm2rau p;(0trermf3iatlmDe uei;s)trum(o ny4oleemieta(fs2ra(mpot4tleomi3tyt a2uluvo ()trerxfcta1om raivo;t sexmim3iodape liei (fartmurpou4opx  f3iyd m2uluvpnu) rtnio3iatlm rau il()tetoio3oodlltn fctas) 2rrxm nu0opxo f3tasfa2uaumo t4tetoio3iytlp  anei ()t2xm(o3iodlp n fcslsfsDum( ont1tle io3tad m raumsnt) ltrxrctydlpte n ilt) exmxo3oy1amen iesasf Dumu o;t4alx if3iytfa rlnmp;(4tltoio3totfm  auvol(0 etr(opno4lpe  nvia(  Durx  ;o0tpe  o3iyt mDrmuvpn(0 rtnio oa1fa   nei;( trumxr3io1lp elnvta()a2rm(m no4tlx ifeiytlm2ulnmsnt0 exnir3oo1la  lu o;( srurxo3oy1lmee ivs t srumxm ot0oexn o3tyt a um(ms u0altrxr3iotfp  luvs s tetr(r iu1lpe mnctasfsDrru oot4apxnioeiytla rlnmon(0trtnmo oydfpDeaueolt)srum(r nudom nmiciltfarrmxmono1oex ifeiyd mDeanvon(0 leoir3ta1omDe u o;t) eur(o ou4ole mivias aDtmur ou1tlxn o3taslm2emuvp;() lxomfctotfmtr nes;s0seuoxm nodap emneias)srum(r no1tleniiciys mDeauvp;t4 exrxr3tatopt  iei s trxoim3ou1lltnmfcta()aDtr(mono4ale mietydlm eaumon()tltoxfcty1op rlieo s texm(mpoo1aptemivi t)a2tmu pot0tleoiieiltls ranms;t4alxoir to1lmD aivs (  2tmxo3io4op e nvi sf Dum( pot1tlx iieiadla rmnvs u0 lxrifctotoptraivo;t t2to(m nydope lnesls  Dtauronu0alxnioeiysfs2emnmp;u4 rxnmociodfpt aivo s s2xm(r ny4ope  fvs t  Drrxm ;t0oee io3iyslm uan o;u)altnif oy1fptr uvi;() 2tmxr ou4omtnlnviatfsrta(mo;t4oet  i3iadfmDraumsnt0teerxrcoadlm r neo;(0s2urio3nydomtemici t)srrru  ;t1tltn iciltlmDel(vs t4 rtomociydomte u o;s0trxo(o3ou4ll elnvs s  Dtmu pnu0tpxnmieildfm umn s u)areoxociodoa   ivs;()t2uoxr3iudlpe livt s)s2rr(  ;t0tpxniiciasfmDua(mp t4trxnxoctodomteaieo;() rurimpoodole lnvsa()a2tmxm ;t4alxnifctyslm2uanvsnu4 lxoiociatfat lnvol()teumir3oudlp  mnvia(fsDraump;u4aptnmoeiadla rmuvp t4 ltriocoatfaDr i slt)sexm(o oo1ap  lncsa( sDtm(roou0aex mocilt a ua(msnu4teeoio3to1oat aneo;s t2to(m3io1om emfvias) Duax p;u4oleomiciydlmDuluvon(4arermrciydlatrli i t0tetm(o iydaleemies t) Dtmum ;o1apxoifctatfaDemnmpn(0 exnif3oa1late u i () 2umxr nu1opee fvt t)sDua(mp;t1apxo feiad s2uanmp u0trtomf tadfp   nvs t0tetrirpny1oltelnvta()sDraurpnt0aptn fcildfa2umn o t0alxoxo3oydfa e ivs;t0setmxr no4al  lfvtat)a2uaxm ;o1aex  ietltls2rm(msnu) etnir totoaDrlueil(0trto(r oo4oltn nesat)sDumurpoo1aetniieiltlm2uanms;t4 exrxf iadopDrlnvilt  eur(opoy4ll   fvi t  Dur(m nt0tpeoif3iysfm2umumo;u)arxoifctodfmtr neilt0seto(o io4op   iesl()arurxmp;t4tlx mi3ildlm2ra(mo;()aexrxf to1lmDeluesl()seuo(r oy4lpe lnctat s2uru  no0aee mieiasfs2ean pn(4alenxo iydfat  nvs;(0srumxo oudolt  ivils) Dtax  nu4teeniieiyt mDum(vp;t4arxnir3tatop  auvsls)srxo(rpnydal nlnetl()s2umu  ;o0oleomi3ias sDul( o;u0alxomfctodla  an i;( sexmxo oy1ap emici tfaDtmx pno4oexniietytfm2ra(vs;t4artoio3iodfpDe ivo t sruoir oo1llee fvtat s2um(monu0apxnifeiytfa2ua(msnu)aetomoctotomD auei;s  ruo(o ou1ap e ietlsfsrur(mpnu1alen ieiydfm2uanmp t)artrxr3iotlm  lieils)setrxo iy4altelfvsa()srrmxr nu4ole mfciytla ul( s;u0trerxrctytlat ln s;s t2xmiopno1ole lieiasfsrum(r oo4ale if3ilt s rm(vsnt0trxrxocoa1fmt ai o t0truo(o nu4llen fcs t a2rruro;o0teeomo3iltfs elu p;t0arxrmrctotlatr ies;()texr(m iy1am  mivsasf rtaurp;o4alt ifciat s em( pnt4 lxnmr ia1oat anvs t truo(r3ou1amtn ici sfartmxrpou1tle miciadfm2rau s u4alxoxo iy1opt  u i;s s2toio no4lltn ictl(fs2rm(r nt4oltn i3ildla rlnms;() ltoxr oa1lp   nvs t)s2xo(m3oy1lltnlfctat)artau pnt1apen feilt a raump ()tlxnio iatlmtraies;s0truo(rpiudapt  nvtlt)srrmu  nt4optomiciat m rmn s;t4 lxrircty1om r uvils)sexrxr no1lm nmiesatf rurumo;t0oet mi3iys a2rmnmo;(4 etrmr3ty1fptrlies t trxriopou4lpe lfcs t s2ur(  ;t4altnmiciad m ra(mp;u0artoxo3todoaDr nvsl(0teurir3io1lmt lnvsatfa2tmxro;t1altnifetyd s uanmp t0 lermo3oodop e i o (0s2xrxm3iydaptn icsasf 2tru o;o0tet mfeiad s2rlnmsnu4 lxnxr tydlat  ies;(0s2tr(mpnodlmenmncsl(fs2rmxmp;o1oexn ocias m2uauvo;(0artrif3iotlpDrlnvo ( texmxopoydameelivi () 2taur ;t1apt  fcild m2uanvs u)tlxrxr3oydfp eaiei;s0seurim3ou1alee ivtl()a2trx p;t4aeenmoetltlmDrau o;t)aexoxf3iadoat an s s0 2to(m3nodolte feilt)a2rrur ot1tpxoiicildlmDrmuvs;()arxrifctydomt li ils s2umxm iu1lpe mnct t) 2tru pno4apenii3iytlsDran s (0 exnxo tatlm  livi ( t2xrxopno4ape  nvslt)aruax p;o1alt mfcild s2rln s;u4 rxnif3iadfptrauvo t t2tmxm no4lmt lfcs (f Dur( p;o4oltnmfeiysls2eluvs;t)teenmr io1omDe neo;s)s2xoxrpoo1altn ivta( s2tmxr ;t4oee iocild a umu pnu0trxoif3todlmDe i il(0 etoim io1lptnlnvi tfaDtm(r ;o4ape  fciytfs2uauvs;u)altrxr3oatopt  nes;() 2tmxo nudalt lies t)a2um(rp;t0tpen fciydfm2rmu o;(0 exnxf ty1lm r ueols s2trio nu4am nlfvia(farrr(r ;u0oeenifeils mDranms;u4tleomf ia1fptrau i;()sexmxr3ou1lle lnet tfa2ur(rono1open feiltfa rlnvs u) lxnifcoy1fateanvil(0trxm(m iodale mnet s  rrr(ronu1alxo fcildfsDuaums (0 ltoxrctodlpteaneol() 2uoiopiu4amen nvil()sDrrxr ou0tleoioeiytfs2rmums (4alxoif oa1oaD anesls t2to(r3iodol nliet s s2tm( p;o4olxoio3ild sDrlums t0trtrio3iadfmD anvs;s0t2tr(mpiydlltnmfvt tfsrtr(mo;o0tetn fetatfa rlnvs u4 rtoif3oydfpDelueolt0seum(r3oo4altn nvt s) rtaum no1open oeiadfmDumuvp t4 rerxfcoytopt lnvi () exo(m no1lm   fcs sf rua(mono0oleomoeildlm2ean p u)arxnxociytopDr ueslt) etoxm oo4lp n nci ( srraumoou1optn f3ilsfsDem(mpn(0 exnxo3oodlpt ln i;t0 rxm(o oydlpt  ivsa( sDuaxmo;t1oeeo oetldfm el(mo;u) lermocoa1lp rlivo;(0t2toir ny1op   fes t) 2tmur oo0olenmiciyt a2rlnms;u)teenif oy1lmteaueil()s2uoxrpiy1ol e ivtl(fsDtrxroot0oltnifcilt a emnvp (4 rxrmo oodfptr nvo;( srtrxmpoo4am e fci t) rrr(roou0tleoioeiydls2rluvs;()tleoxo iadomt livslt)trtrim io1ole livslt) 2tax poo1aeeomi3iydls em(vp ()tlxnifciodomt au s t0teum(m3oodomt  fctasfaDtmumo;o0tet  feiysfmDuln s t) rtnirctotlaDr neslt0 rxriopiydop n fesltfsDra( pou1aetn o3iytlsDulnvsnt)trtrxr oodomD lu sls srxm(o ny1amtnmieia()s2ururp;o1texn fcilt sDrm(vs;t4trenmo3tadomD aueols trxmirpiy1ape mictl(fs2trxr ot1tptoio3tldfs elnvsnu4 rxrxr iadfm  ai sls0t2xr(r3nudlpte icslt s2taxroot0optnmfeild a2em(vont)trenio3oatlmDrli o;()seuoxr iodamenmneil(fa2uru p;u4ope  fctas a eln snu)arxomo tatfaD  uvsl(0s2xo(o io4llt mnvslt) 2raump;o4tpxomoctldls2rm( ont)tlxnxrctodla rau i t  euoxm nu4apt  nvsa() 2rm(rpoo4opx io3tadfa eauvs u4tlxoio3oytlpD livsl( srurio iy4lptnliei sf 2rr(mpot4oetoiocias s umnms t4 rtoxf3iatoa   n il() exm(r3no1alen icia(fs2umu o;u0opto ieils a2ea( o u)trermr iy1lm   i i;t  rtm(opiydamtn ictasfsDuaxr ;u4tlen fetlt m ra( p;(0 exoio tydlaDr nvsl(0tetoim iudol nlfvtat  Dta(rpoo0teen iciatlmDrmumo ()aetniocoy1fmtraivs (0 rum(r3oy1alee fcs sf 2tmxrpot4tlt moetatfs ea( s;(0trermr iytopDeau s;t  2umim oo1am emivi ( srum(mooo0opx  o3ildfaDumu s;(4 rtnmo tatoat anei;(0sexoxopiy1ap  lnvi t)a2rmuroou0tptniietatlm2ulu s u) etnif oytfmtr n sls0 rtmxo3oodole mivsl(faDtaxm ou4tex mfetadla el(vonu0tlerxo iytfat luvi;s0 rtmxr3nydlltemfvi t)srrau oot0oex ifeilsfmDrl(ms;()trerif iatfm ean i;t0trur(o3io1optemivt tfaDraxro;t0aee mocias aDrl(vonu) rxomr ia1fmtrauvs;t s2xmim3nu1ll emnes (f Dumxrpot4teeomieiys a eanvp (0 rtomf iodomt ln ols) 2trxmpnudalee ivilt  Drax  ;t0altomicilslmDraumo;u)alxomfcoa1fmt au il()s2umir3oydoltelivtls)arra(m no4teen ictlsfa2rmums;t0aeenmr tatfmDrai ilt tetrio3iu1al elivt t sDraxrpnu4altoiieilsfs um(ms;u0tetnircoadop  li i t t2xrxo no4ome lfvsl() Dtmumpno0tptn octat aDum(mo;(0altrmo tytlatelu s ( sexrxopoodam   net s a2tmu o;u1apxn f3iytls uanmsnt4 lerif3todfpt  neol(0 exmio oydoltn fvsls arraxro;t1olx  ocildla2uau p;(0 lermr oodfmt livs;(0texoir oo4aptemnctlsfsrtaxm ;o1apxn ieiydfaDeanvo;t4aetnif3tydomDeanes t  eurio iy4apen fesl() Dtmumpno1oleoiieiaslm2rmu o t) rermo tadfa r n slt s2xr(mpoo4ll  lfeia()sDuru oot0aexoii3tyt aDelnmp;(0arxniociatoa r n s;s0s2tmxm oy1ameemnvi ()s2tmum nt1tee ii3tydls uau pn(0 rtoxr ootlmD livolt0srtmxmpoudamtemnvs (faDtm(rono1ape mfetatfm ean s;u4aetnmociydoa r n o;s0setm(o no4ap  mies s) Dumxrp;o0tet ifeias m rm(mp (4 exnmocoytfatr n sls0 rurim oodam eliei s  rurxrpoo4aex  oetyt aDrlumo u4tetoirctotfp  li o t)s2trxmpoy4amt mnvsat)aDtrump;t0tex mictas mDua(vp u0teerxfciytla rlnvo;s texo(opoodlltn fcs ( a2rrxr nu1aexnmi3iyslmDum( o u0artomfciotfate n o t) rtr(rpiu4amee iesa( a2rr(m ;t0apxoii3ilslmDuln o;u4 ltoxocoadfm   iesls trtoio ou4lm elfvs t sDta(m ;o4tetomfeiys sDrln o;(4artoif oa1omDelu sls truo(o oo1altn fvslt a2umur nu1tpeomfctldfm2ran pnt0 rxrmocoo1lmD aies;t  euo(r3io4lpen fvt s  2rax o;t0aeenifetldlaDeanmsnu) rxriocoadfpD  i s;s  etrxmpoudom emiesl(  Dtm(m no1oetoiiciad m uaums;u0 renmr oo1la raivo;t) rtoxopio1amte ieiasfs2urxmpno1tpto octadlm2ra( p;u4artnircoytom  ln ols  exr(r3no1ll e ivt tfa2ua(r nu1alto oeiysls rmuvo;t)artrmo3oo1opDran o ( sruo(r3oo1opt mict s  rurumono1apxniieildfa2emuvo t) etnmo3ia1opt aivil( s2xmim iy1lmeemfciltf 2umu pnt4tpxn ieiltfaDrmu s;t0 etnxrctatfaD an s;(  2tmir3nodal n nciasfa2tr( o;u1apt miciasla ul( p (4artoio3tytfaD  neo;s0sruo(mpiudoptelfvtlt) rumurpnu4alenmf3ias aDelu ont0 exoioctatfpDr i i;t0 etoir3iy1lm  lfvtas  rrr(mooo4aee mi3iyt s umnmo t0arxnio3ta1lmDrlu s t)srxr(o3no4amenmfcsat  rtaxrpno4alt ifciytfmDeln p u) etnmf3iatoaDe nei (0tetmxo iodope  nvsa(f 2ururono0aeeomfetytlm2uluvp;() lerxr oa1op raieo;(0 ruo(mpou1lmtnmivsa()a2tau pno0tltn f3tydls2rl(ms;u4tetrifcoy1lmDranvilt sruoxo nudopee fvi t)a2rmxront4tet mieiasfs2eanvs u4tltrxo tadfptraieil() rurxmpio1lltemiesls)sDtaum no4ope mf3iytfm ua(vp (4aetomr3oadlp eli o t seumxm ou1omtemncta()sDum(ronu4tpto ieiltfm2raums;t)alerxo iatlp r iei s teuoiopny4lleemfci tfarrm(r ;o0aleoioeild aDemnvs () rxrxoctydopDran s (0 2umio3ny4op e fetas) Drru  no4oex  feilslaDea(vs t)tltrifctytfpt li sl(  rxmxrpoy1amtelictas)s2rr(m ;u1optniieild m ua(vo;t0arxomo ta1opteln s;t0srurim3ny1lptnmictltfsDrr(r no1tle ifeiaslm2em(vp;() exrirctadfmDr iei;t0teuoxo3nu4lp  mics (  rtrxrpot1olxoioetadfaDrm(monu0 ltnxf ta1la ean s t0s2to(m ny1lptn neilsf rtau pno0oetnifciyt m uauvo;t0 etnif tytop elnvilt0 rurim3oo4om  mivs t) Durur nu4altn o3tyt mDranmo (4 exrmfciytlatrluvo (0 rxm(opny1olt mnetas)aDumxmo;t1oltnioeiat a ra(vs t)aeenmrcootla ran il()srumxo3ou1lme lnet () rurumonu4tptniicias s eln s;u4aeenxo ta1opD aivilt) 2xmim io1apeemicta(fa2rmxm ;o0aetoiociltfa ul( p;t0 lerxr3totoat aiei;(0 2xrxr nydal   fct t s2rru pnu0oeenio3iyslm2emu p;(0tetnxfctadfmteauvs;(0srtr(o3iu4opt liesatfsDum(m ;u4altn ociasfmDumn p;(0trtoif3io1oa  lnvi s s2tr(m3oo4ap  mnvil(  Dtaxm no4tltoio3iytla2ra(mp u0 eeomf iodoat livo s) rxrxr3iodlpeelncia(faDur(rpno4tltnii3iadls2em( s;(0aeeoif3oydoate nes s)truoiopny1lle mfctat) 2raumpnu4tet ioeiadfm ran p;u4tlxoxr ty1fm   nei;s0s2uo(m3iydomeemiesa()srrmum ;t1tltnifetys a ra(vp;t)aeerxoctydlm   nvs s0trtmxopiydapee ieslsfaDrmum ou4olxoiictlt s2umu snu0trtnmo io1fm e ies;t)s2trim3iy4op e fvsa(fs2ra(rpnt0apenmoetadfaDrau o;(0tlxrxf oy1fat anvslt) 2tmir iu1ap n nesls)srur(  ;o1aptomfcilsfs rmnvs (4 reomr3tatoatrlues s)sruoim iy4optemneia(f rrrxm ot4tetnmfeiad s emnvp;u)trenmr iotomDe ieo;s0trtrimpiu4ame  fvtasfa2tm(roou1tetniociyt a2eauvsnu)aeerir ta1fmtelnes;s0 rxoim3nodomtn ici sfs2raxr ;u4ope ii3iltfm2eau snt0 exnmf3oydlp r uvs s srtmim3oy1ap nlfcsat  2ua( pnu4tlxniietlsla2rmuvp u0aexrir ta1fmDe nvsls  2xo(m3iu4alenlnvsat  rua(  ;t0apx mfciydla ra(ms;()artomo totfm rauvil( s2umxr3oydll n ivi t  rum( p;u0oltn octat mDuanms ()treoxocootfm  aivs t0teumim3iy4llee ietlt  Dumx pot0ole  ociaslm2ua(mp;u4arerxf3oadlat ln o;() rumim iy1om e ici s  rtmx  ;t1tptn o3tad a2ul(vs t4 exomo3io1fmte i o t)setmxm3nydol nmies t)sDrrurpno0oeenioetydlm emnvon(0aleriociatfp r ieil(0s2xrirpnodope mfct t  rumu  nu1alx moeiytlmDrl(mo t4tlxoio iytlmt lueol(0trur(o io1omenmnesatfa2ta(roou0tltoifeiatla2el( o u0aeenir ta1omte ieil( trumxr io1lmtelncslsf 2rru poo4olxoii3ildfm2rmnvs ()teeoio ootfpDeau s t tetmxm3nu1lmenlnvil()sDuaxmo;o1tptomo3tyt s2umumont0tleoir3oytomteli o;(0 2xo(rpnu1lm n ncils srrr(moou4aex  iciys m2rmn p u4aeermf tytopte uvsl(0texr(r io4lmt lnetlsf rtmurpoo4alxo i3iasla2rm(mon(4trxoxo iytfateauvsls0sexoio oo1amenlfcil(fs2um(rooo4tetoif3iyd a rauvp;t)arxriocoytfm   n olt0 eur(r3iodop emfvs t)s2taum ou4aexnmfciltfm2emumo t4treomr3oy1lpD li o;t texrxm oudllee ivtlt  Dum(r nu4aleo fctytfmDelu snu0tltoif3to1la elnvols  eurimpnudaptemnetlt aDrr(r ot4opxoiietydfmDrm( s;t)trenir3oa1opD  u ils0 eurio3no1ol  livsatfsDtrx  nt1olxoifeiad m rl(mon(0 rtrir iydfm eaivs;(  rxrxo3iy1omen neiasf 2taur nu1oex mocils s2rlnmpnt0trtoir todlp eau s;() 2xr(o iudomtn iesat aDtax ooo4aetnifctydfs2umuvsnu4tlenmo oa1lp  lu ils) 2toxo nu4am emfct (fsrrm(  ot1tpxnmfetysls2emn s;u) ltnxrcoa1fa  aivs;s0t2xmim3oy1ope  icia(f Dra(m ;o0aeeomoeiatls2uluvs t4tetomf iodlpDe i o;t)srumim3oodalt  nci (  rrm( p;o0aeeoii3iyt sDemu o;(0alerio3iytomt  ueo;t  rtoxopou1ape mneil() 2tmxmono4apx  f3iasfm emn pnu4trxoir oatfpDr ivo;s texrxrpnudlle mnei ( a2um(m no4tpeoioeilt s rmn p u)texoxr3to1lp rlieilt)srtoxr3iudllt mfeilsf 2rrx  no1oleoio3iatfa2eau s u)aeenio3ootfat lieolt0 rxr(mpnu4oleelnvta(  2ua(moot0aeenifeiyt m uan s ()teerxf3oytlmtraueo t0 eumim3iu4om nlivsl()a2ur( oou0tlenmi3iatfa2ulu pn() rerxo iytfat  ieols)texrirpiydamenmfet ( arrmuroot0teeoiiciadlmDea(mp u)tleoifcoo1fmDeaneslt srtriopny1altnlivtlsfaDuru o;t0tptnmictyslm rmumo;u)altnxo3totlp r i s;s) eur(o io1om n fei ()a2tax  ;u4oeto o3tlt aDranvsnt)alenmf io1om r uvi;s) rum(mpou1altelfvi (fsDtr(rp;t0teeoiiciasls ea(mp t4 leomfcoydfpD anvo;(0srxoio no4altnlfeias)aDrm( pno0aptnio3ils s emuvo;(0 rtoxfciotfmDrlivsls0 2tr(rpou4lmt lfvsltf Dumxr oo4aexn octls m ra(vo u)tleoio3iatfaDr n ols0seumxr3no4lleelfcil(faDrauro;t1opeomo3iydlm em( ont0tlxrmf3ta1faD  i il(0 rtrimpou4ope lfvsl() 2urxmono4oleomoetytlm2uan p;()altnif ootlatelneo;s) rtmxm oodop   iciasfaDrrumpou4apt moetadls ul(mp;() exnxo3oodlp rlu o (0sexoxmpno4amtnlncil( s2rr(m nu0ale  ictlt m2ranmsnt4aeeoir3to1fmtelivols)t2uoxm oy4ome lfesltfaDrrxrono0oleoioeilt sDran o;t4texoif3oytlp  ai o (0texmimpiy4ale mfetat)arraump;u4texo octysfmDemums t)tleoxf tatla elnes;(0tetrim nydll   nvi s aDrm( p;t1teto ociat s2ra(vp u4 rerxo3todlpD  n i;t0trxm(m3ou4op   feil(fa2uaxmp;t1tetoiocilsfm em( pn(4trxrxf tadfpDelnesls  2ur(o3oydalt lneils  Dtaump;u4tlxoii3tydfm uluvp;u0tlenmoctadlmt  ivols) 2trxopoudllen fcia()aDrax  nt1tltn ieiytlm2ean s;t) rxrxr3oa1om raieslt)t2xr(m ny4lm n fctlsfsDta(rpno4aeen ociysfaDum(vp;t0 ltoxr oatlpt an s;(0 etr(r ou1ale  ict (fs2rr(r ;u1tex mfeiyslm emuvs () lenir iotomteauvs t tetmxm3iydoltemfetls srtau pou1tpeo o3iysfm ea( on(0 lermrcootoa  auvslt  exoxmpiu1omt lfctls) rrmumoot4tex  o3tyd a2ean p t4tleoxoctytlmtrlnvil(  eumxo3oodaptn fctlt)sDtm(  ot4aleomf3iytfs2ra(mo ()aeenif ootfm   ueols0s2xmxr no4lp n fvs (  Drr( o;u4tltoif3iadls2elu on(4trxoxf3tydopt luvo;t0t2xoir iu4amte icsls srtm( oot0tpto oeiysfa2eauvont)tetrifciatomDean slt)teumim oodole mneiasfs2umuro;o1aetomo3iadfs ulu s;u) etrmo3ty1lpt  u s s0seurio3iodoptnmiesasfsDum( poo1aee mf3tasls2umn p (4tltnifcoadoa e nes;t) 2toxmpio4lpe licta()s2trur ;u0oeeoif3ilslm2rm( pn(4tleoir3oy1op ean o ( srumxr nu4am elnei (fa2raumpno4aee  i3tydls rluvp (0alerircoatoaD  ivi t t2xoim no1omtelnvi t)srurxront0aex  o3ils a ul( s (0alerio io1lpt  i i t0sruoimpoy1lme lnci ( s2ra(mpoo0ale mfctltlm2ul(mp;(0alerio3oo1la r u o t0t2tr(rpoudop  mivi sfsDurxrp;o0tltnmocildls em(ms;t0teeoxo oytfa raivslt0trtoiopiy4lmtelict (fs2tr(  nu1apeoioctyt aDem( p;u0aexnmrciytoate uvi;s) 2xrxm3oo4lme lfeia(f rraxmpnu4ale mo3iytfs2umnvpnu) eenmrciytlpteanes (0 etoxmpoudlle  ict t  rurxro;t0ape miciytlmDemnmpnt) ltoio iy1lm rai s (0s2xm(m3nodalt  fctl( srraurpoo4aexo oeiytlm2uau pn(0trtnif oa1late ueolt  eur(r3oy1amt mies t)s2taxront0olxn ietysfs2emumo (4aeeoifctytomDr u o;t)trxr(r3oy1omenmneta() Drr(ro;t4tpxomictyd m2eaumo (0tetrmf3tytfptrlnvs;t) 2urim3nodllenlivs ()aDrrxr ;o4altniiciltlm2umnvo;u0aetrio ia1faDr u s ( s2xoxm iu1ale lnctlt)a2tr(  ;u4altomi3ild mDulumont)tlenxfcoydla elu o;t0setm(mpno1ameelivtas a2umxmont1aetomi3ild m2elu onu0 exnmo oodoateluvi s)s2tmxopnodlpt mncilt)arrrxmonu1alenmo3ildfsDul(mo t)tltrifcto1fat aiei;(0t2toirpnu4om   fciat  Dtmum nt4olt mieiltls rlu p t0arenio3oydfpDe neo s0s2uoxr oo1ope mfvtl(fa2urxr no0olxo fciltfm rauvs (4 lxoio iy1lptr uvi (0 rxm(o3iodam  lncia( a2tr(mp;o1tet  o3ilt s ea(msnu4alxoir3iydopteauei;t0srxr(opoy1amte fesat srum(  ;t1teto o3ild m uau p;t0altoxf iadop  ai ils0trxmxmpiydlpen nvsl( arurxr oo4tex if3iys m2rauvsnu)texnxo ia1latrlnvi s teur(mpnu1ale lnvi s) 2rr( oot1tptoioeils s rlnmo u4teerioctadoptrlueo s  rtoim3io1ape  nei s)arum( p;u0tpe  feiad mDuluvpn(4 reomocia1opDrlnvs;s0sexrxr3ny1amtemfctl() Dta(rono0oee iictldlsDel(msnt4 eenifctatlmt luvi;(  2um(mpno1lp  lici t  2tau  ;t0oeto i3ilsfaDean p;(0aetrxr to1faD au s s)srtrxrpno4lm   iet sfaDrm( o;o0olt  iciydfsDeln o t)aeenxo io1laD liei;t)texrir3oodlpe mnvt () 2ta(  ;o0aexomieiyd m elums u0 rerir3iotopDrauvo t trurio3ou1oltnmicslt  Drr(mpnt0olx mfeiasfm2ean pnt) lenxr todfpD aieo;s)sexr(opoy1oleemfctas  Dtaxmp;t4aex  oetyd s2emu p u)aeeoxo iy1omtr nei s)srxmio3nodlpenmfct t arrmu  ;t4teeoif3tld sDrlnmo u4 eenmr3ootfateanesls0texmirpiydlmt  nvils) Duaxroou4tpx iiciasfs ulumo;t)aexoif iy1lpt li olt0 rxr(m oudamtnmivils s2ra(r ;u4opeo f3iydla2emu s u)tleoio oadfm rauei;t trtrxrpiydamtemncilsf Dtm(mpnt1ape mfciat m em(vonu)altrxrciy1fmt livs;(0s2xmim3ou4lm elivsat)a2uru o;o1tpt micild mDulumsnt4 etnmf3tydlpt  i slt t2toir3oo4lpee ncs sfsrrr(  nu1opt  fciyslmDrauvp (4tlxrmf iydomt lneil( t2xmxmpno4alt mictls s2ra( ont4oet iietytfm umu pnt0areoif3tadfmDeaues;s0setmir oudlptnlivsa(  rrrur no0tptn fetydls2emnmsn(0tltnxocoy1omteln i t s2triopio1aptn ics sfs2ra(  ou0ale ii3iadfm rmuvp;u0 exrxr tydfaD liei s setrir iu4ale lneiat) Draumont1aet mf3iyd s2ea( pnu4tleoxr3ty1latr i i s0s2xo(r ny1alee icslt  rraxro;t0teenmf3tat s2em(mpnt4treoxo iotlpteli i;s srtr(r3nodlp n netlt) 2ra(m ;o1tle ifetatfm2ra( ont4trenxr3oodlm r ueo;()srxrxo ny4ll nlfei t)aDrm(rpou1oet mi3iad s uanvs;t)aeermocoa1fm elieilt0 rxo(r3ny1lm  mfvilt) 2urump;u1tpx  ocias sDranvp t)treomo oadoaDeln i;( tetoxm3oy4opeelfci s s2uauronu1oexn iciltls2rl( onu0 rtriocoa1omDr u ols) 2toio ny1am nmnetl(fa2rmxronu4tpxomiciyt s elu pn(4 exrmo3oatomD an olt tetmirpiodlmee neil(fa2rr(mp;o1aetn fctldfm uau o u4texnxrcoatoa r neo (  ruriopoudlmt lfeias  Dtr( p;u0tpxn iciadla rluvp () rxrir3tytlptraieo;s  2triopiy4lptnlfctat) rum(m no1oexoii3tadlmDul(vs;t0texrxociy1omtelieo t0 rurxm oy1amtemnet t)artmum no1aeenmfciysfa2ulu o;() reoxf oodlmD  u s;t)trumiopiu1op n nvslt aDtrxro;o0apx  f3iltfsDrmnmpnt0 etoioctadfaDeluvo (0 2tmxo nu1amt  feils  rtau pot1oetn oeils a2ea(vp;u0 rtrmo3oa1opt lnvi (0 2xoiopoo1ome mivtasf Dumxr ou1opxnmoetytfm eau p;u0 eerxf3iytlaDeanvo;s0trxm(o3ou4lpe licta()aDraumoot1opxnifeilsls2rm( p;() ltnxocoa1latr ies ()teurxr3no1omtemies tfsDtax  ot4teto ociysla2ran p;u0alxrxf tytfat  i ol(0 rto(m nydlmen neia(f 2umxrpou4tpenioctytls2rl(mpn()teerxo3ta1lmDeauvs s)srxr(m iydlme mfciatfs2ur( onu0oex  i3iltfaDea( onu4 exoif iydomDe uvs s  2tmir3io1ole  nvtat) 2rm(mont0ope  ietydfa2ran o;()alenxr ia1lpDrauei;(0t2umio3oudllt livs tfarta(m ou4ope  o3iltfaDrlnmp;u)altnxocty1fm  livs;s  rxr(mpnu4ll emiei sfarraxmo;u0apt  ictys s ul( s u0trerir oo1lpt luvolt0seuoxm oy4ol nlnvia()aDtmumpno4tpe ifciadfm eau o;t4tetrmr3iytfmteaivi s  exmxrpiu1ol nmivsas)srrrurpnt4altn ictadfa2eanmonu)trtoir3oatlp rlnvsl(0 rur(mpoy4ameemncslt) rtmum ;u0oexo fctld a2emnms;(4tltrio3io1fmte n s;()srtr(m oy4lmt mnvi s) rtru ono4tex mfeiydfsDel(vpn(0tlerxr3iy1lp ranvils s2xmir3nydol nlnvtlt) Dtrumpno1tpen ociaslaDeauvsnu)texnxf3iadfpDelies t  2xoim3iu1am   fcs s) 2tr(mpnu4apto fcils mDum(mo;(4trxrxrciy1lpDr u ols texmir iu1lpenlivsat s2raxr ot0apeoio3iltla ea(vs;(0tlxnxfcootfmt aueil()srtoxo iu4llt mfvta(farumu ooo4tet  ociadfsDelnvont)trxrxo3ia1lptrlnvs s0trurirpou1ap elivia( arta(mo;o0aeen ieiyd m em(mp;t)tlenxo oadopt aneolt0t2xmxo oydale lfetlsfsrum(mo;t0tet ifcilsla rlnms;t)altnxoctodlpDeaieo s0 exm(m3nodll  lfes tfartmxrpot4oee  ocildfm ra(monu)arenxfcoadlaDe i i ()s2toxm3ny4ope lnvsls) rtr(  ou1oex iictysls2el(msnt) ltrifcoydfaDeauvi;() rxoio3ou4optemfct t  2tm(m no0tex iociytlsDeanmo;t0 etomo tatlpt  ues;s)t2xrxo iodllenmfctltf 2trur nt1apto o3ilslaDulnmp;t4artoxr oa1laDeauvsl()s2ur(o3nodapeemnvtat  Drru o;t0oetn i3ild m ul(mo (4tlerif3oa1la r i il( sexr(m3nodolenlnesasfs2ra(mp;o1aee moeiatfm2umums u4 renxo3iotfp rai ol(0 exmxo ou1op n icsas) rrmu  nu1tpxoio3iadfm2el(vp;t4 exriociotfa e ueols0sexr(mpny4ole liesatfarurxr oo0oet mictadfm elnmp (4 rtrxfcta1oa   ueols0 etr(mpny4opt  fvil() rtaxm ;o4aptnmo3iasfm raump t)trxnmrciatlp eauvi;s0 2xm(o3iu4lpe mfcta( a2rrumo;t0tpeo o3iydla2el(vs;() eeriociatfpDrai i;t  rtrim3iudomeelneia(fsrurum oo0aleo oeiatls ean p;t4 rxrircoytfmDr neols0 ruriopiy4lpte fcilt sDtru pnu1texo iciysfm2rm( p u4 eeomr3ootoatrlivs;s0texr(o ou1omenmncsatfsrua(  ;o1tpx  fciasfsDuauvp (0alenmo tadfmt lu sl()texm(mpnydomeemfcia(f rrru oou1aexn ietldla2uluvs;()trxnifctatopDean slt0sexmim ou4openlneil() rua(rpnt1opxo o3ils mDum(mo;u) lerir3ootopDeaueo;(0 exoirpoo1al nlnetlsfs2uax  nt4aptoiiciltlaDum(mo (0 rxoio ty1faDr ivs t)t2xm(r no1op nlfes sf 2rr(r nu4tetomi3iyt a2eln o;t0trxnmo3iodopte ivo;s0seuo(mpio4lptnmfcsas)aDraump;u0apen o3iltlmDuluvs (4 etnxrcia1fmteau i;t0seuoxm3iu1ll   nvilt  Dtmuronu1opt  oeiyd s2ua(mp t0trxnxocta1fp   nei;( texr(opou1lle  nei (f rtauro;t1tpeomiciydla2elumo (4alermr ootomtraies;t  rtoio iodlmtnmivs tfartmu pot1texomociyd a uluvs u4tlxoiocoy1fpD anvs s)t2tm(r3nydal   netatfaDuaum nu0olto oeiyt a2rln s;u) exoir3ta1opDeaiei;t)trtrir3ou1apeemncs s)s2ra( o;t1olxoii3iasfaDra(mp;u0tleomf3oy1opDeanvi (0trum(m3io1aleemnci (f 2rrxmont1oexn f3ilslsDumuvo;u0aexoxfctytlptr i i;()t2to(m3oy4olt lnvsa() 2ur( p;t4tet mictys a2eauvp;()treoio3ta1op rau o ( trxm(o iy1lptemfcslsfaDtmumo;u0apx  f3iys m rl( p ()artrmrciy1fa   u sl(0s2xo(rpiu4al e neia(farrmxr ;o1tlenio3iadlmDum(mo;u) eerxocoytfmtrln o;t0 2tm(mpoo1lle mfcsas)aDtmuronu1apxn i3iatfs uanmpnt0 ltoio tydlm eaies;(0texr(m oodlm  lfetas) 2rmxm ot0tptnmfeiyt mDumuvs;u4 exoxf3iydomtelueslt0setriopiydlpeemfvsat)srtrurono4aexn o3tyslm2ul(vo;(4artnxoctytfp  luvi;t0texr(m3no1lp  miciatfa2tr(roou4tetn o3iyslmDrl(mpnt0tlenxf3iatfaD livi;s0 2uo(rpiodomt  nctltfaDtaum nt0optoio3iydla2eluvpnt4tetrir todfm eauvs t  eurxm3nu4ol nmnci t) rraxm ou4aleo octltlm um(vo t0aeeoxf iatfpD li o t) rtrxr3nydamtnlictls a2umx ont1alenifeiat a ean p;u)aexnif oodfaD au o ()setmxr io4ll  mfetls  rraurpnu4optomfctlt sDemn o;u4arerxo3iy1oa   neo;s0trumir3nu1olte iesl()arraurpnu1olt  feilsfs rauvpn(0texoio oytfmte neo s s2uoiopoo4am n nei s  rrru oot0opxn f3tatla rmnms u0tlxnmo3ty1lp eaieo;s0s2uoimpou1olt  icta(fsDrmxm nu0apxo o3tytfm2umu s;u0tlxoiociodop  auvs s0t2xo(r3iudoltnlivsat)a2umx  nu1tee mieils s uln sn(4 lerxfciatlaDraueol( tetmio iydap elictas)s2tax  no0apxo ieiyd m2ea(vs;u0 exnio3todfmD aieo;s0trxr(m oo4oltnmietl( srurur nt4texomo3tlsfmDumuvpn(0 lenxo iodopD an i;t s2xoxo no1ome  icsl() 2taurpnu1alx mietydfmDul(mp;t)arenio3tydfpteanvo;(0s2umiopou4llt mncta( a2ua(r nu0tpt iiciadla uauvp;(4alenmo3oytop  an i s0sexm(rpno1lm emics (fa2tmumono0aee  iciysfm ea(vsnt0aleoifcta1oaDeau ols)teurxm iy4lmt  ivsl( srrrx ono0ole ii3tysfs2umuvpnu)arxnxf3iatoptranvols) exr(m3oy4am nmfvi tfa2rmu p;u0tpx ifeiadfaDrmnvs u)treomocoodfa r neols)teumxm oy4ll nmivil() rurx oou4tleo i3iatfs2umump;u0treoxrcoatfmD  ueo;t srtm(m ny4lltelnei (f rtax ooo1aetoiieiadfsDulump t0aetnmoctotlmt ln i;t0 eto(o nydlm n fci tfsDra(  ot1opeo ieiyt m elu o (4arxnxf oytfateauvi;(0trtr(m3iudalt mfvil()s2uaxmo;o4tpe  octysla rlu o ()aeeoiocoy1fa r n i;(0 etrim no4al nmnci t  rur( o;t0aee mfctldlaDulumo;u0 etniociatfp rlieo;t  2xmxm iydom e ietl(farum( o;u0oexo feilslm2el(mo u0 rerif3iytla elies ( trtoio no1lltnlivt sfa2raum oo0texniociytfs uanvs;(4 rtoio3to1lmDeanvil( s2xm(mpno1aleemivias aDrmxroot1olenioeiytfa umu pnu4aexnxo3todlpDr ieols)srum(m3iudale lfciat)artmxr ou4optomfeilslaDeauvo (4treomrcto1fp eau slt)texoio iy4omee neta(fsrtau  oo4openmociadla2ea(mo ()aetnxrciy1lpDrluesl(  rxoxm ou1olt mfeilsf Dtr(rp;t0alxomieiytfm ul(vsnu4texrmr3iotfa raivil()sexoirpno1optn fvsls)s2tm( p;u0tpenmfeiatlm ea(vsnu) eeomf oodlpt ai s;t setoxmpoo4omtnlfet t)arrrx ono1ole  fciatfaDulu o t0 lxrxociytlp rluvo;s)texrxr iu1llt mnct ( aDtrur ;t1oeto fctas mDumu p ()tltoxocoodom rliesls trxmio3iy4altnmnci ()sDuax o;u0oeeoif3iad mDulnms;u4tleriocoodopDrlivs ( t2tr(o iydlp n feils)artaxrpoo0oex  o3tyd m2rl(vo;t)areoxocoatoat lu slt) rtr(m3oydamen ivt s) Drrxm oo0oet iictldfsDrmump t4 rtrio iadom   nesl() 2urxr iu1apt  ivsa( sDtmumpot1tle mfciltla rl(mp t) etoxfcoodfateaueslt0s2xmxr3iodlm n iei tfaruaxr nu4tetn feiatfs2uaumo;t4artnmo3ootomt  ieil(0 rtoir3nodalenlictls)srtrump;t0teeo ieiatls ran p t0tlxoio iotfpDeli s ()teur(r3ny1apt lnvtltf ruau pno0tlx  ieiytls rmuvo;(0teenifctydlm rln s;t teurir iudomt lictas) Dtmxro;u0oetomfetyd sDua(mo u0 exrxf3iytfatean s;t)s2xr(o3oodlp e fesas)srumxrp;t1tle ifctld sDuluvs;(4 rxoxo3oy1omDrai o;s seur(rpiodamt mivsa( srumuro;u4aet  fciytfs raums;(0aetnmf3ty1lmtr nvs t  rxr(m ny4amt mivi tf 2ua(mo;t0altn o3iytfmDemuvo t4trtomfcoadop  ai sls)teuo(o iydolenlfvils  2tau p;t1tetoii3iltlmDeln s;u0 eerxf3iatfmt au o;s)s2xo(r nu1ap n nesas  Drmxrpot0alto o3tat s2ua( s;(4 rxnxf3totomDeanei (0 2urirpiu4ameemnci sfsDtax pnu0oltn fetat s umumo;u4 reomrctytlpt livo s0srxr(o nydomen neiltfsDtr( o;u1tltnmictld aDrlnms u0 lermrctytfpt liei s)seum(mpoo1lpeelncs sfartmu ono0tpt ifctltlsDumumpnu0aexnifcta1fpte nei ()t2trir iu4apt lfcias)sDrmu pnt0olxoioetyt sDrm( s u)aeerxr oo1fpt  nvs (0srxrio3iu4amtnmietasf 2trxr nu4apx if3tltfs ea(mo;t0arenio3todoa eau i t0seuoxm3nu1alt lnctlsf 2ur(m ot1olt mictasfsDemu p;u) ltriocio1fmtean s t0teuoxm nu4lpe mnvi t sDua(mp;o4tltnmi3iad sDrmumont)tetoxf3iodfptr nei s s2toim iydlmtemicslsf rtrxrpnu0apt  i3tytla uln s;t)texoio3iadoaDe ivs;s s2tr(opny4olt livtas)sDtmxro;t1ale  o3tld m2ranvp;u)arxoifcta1fpDranvi;()trtoxrpou1lmeelfet t aDrrxr ou4aexomf3ias mDel( p u4treoifctadla  aivils0 exo(m3oudoltnmivsa()s2uax poo1ape ii3iytfa ulnms;t4areoxf3ta1faD lueils0srxrxopiu4opt lneslt arrrx oot1opxnii3ias a2uau o ()alxnif oodlaDelu sl() 2tm(r3oy1ll elici tf rua(r ou0oexomiciadfm uln on(4trerxrciytlp elu i t  rurxo nu4amee nvilt)sDur(rpoo1alenmo3tas m2umnms t)trtnxo3iotlaDraivol()trumxopiydopeemnet (f rtmum ou4oee mfetyt a eln s (4aleoirciadlat  uvi t0t2uoxr oo4omeemfvta( sDur(  oo4opeo icildla rln snt4teenirciodlpteanes;(  eumxm3ou1lm nlivsasf rrrx o;o4tlxn fctyt s ua(vs (0treoxo ootfp eaivs;s) ruoir3iodapee ncsl()arum(m ;u4oee if3tasfs umums;(0aexnxfcoa1oaD  uvi s trtm(r nydlleemfetlt)sDuru o;t0apeoiiciydfsDrauvsnt0 renir3to1fpt  iesl( t2toxmpiudll emfeia( sDrr(m no4openmf3tad m eanmonu0aeeomo3iytop e i s;s  rxmimpoydlpe livsat)s2ua(rooo4olxnmiciyslaDuaump u0 etnxrcoy1la  aieo t) 2xrxmpnu4omen fcslt)a2tru oot1aex mictlsfm2ra( o (0arxoxoctytlm   nesl()t2xr(o3iodoltnmiciltfaDtmx ono0tlt  oetas mDemump u)trxomr iy1lateaivils0t2tmim oodome  ivs sfarrm(mp;o1tleomo3ildlaDrl( snt)alermo oydomD li o;(0 rxrir3iu4am nmici ( srum(rpoo4teto octadls ul(mon(0 ltrir3iodlmDrluvs;(0trxmxm iydolenmnvsa( sDtaxmooo0tlxoifetytla eau p;(0tltrxr3tadfptrauesls0s2tmxm iydal  mivtl(f 2trx o;o0aet  o3tld sDrm(mp;(0 etomr3oydlaD lues;t trtoim iy4amtn fctlt) ruru pno4olxnmfeiadlaDul( o u) lxrmr tydlptranvol(0 2xmxrpoy4oleemicia(faDrm(m ;t1texoiieias s el(vo;t0tlerirciydlpDe i o;t0 2umxo3oy1amtnmfctls)arrrx o;u0tltoiiciyslmDrl(vsn(4altoxo3oodoateaueo;t0 rumxo ou4lptemfctl(fartm( pnu1tltoii3tldfs2el(vsnu4tleoiocoytoa elivi ( srto(r nu1optnlivsl( arra( o;o4tptomfeiadla el( ont)texomo ootfpDe nei;t) rtoxopou1amt lnetl()a2rm(mpnt4alx  oeiat m2em(mpn(0 eenifctatlmD luvo;() etoirpnu1apeelnet ( srrrum nu4tltomo3iydlm umnvs (4 lenmfctatlp elu i;s0trurimpiy4lmt lfvtls) 2uaum oo0tlxoii3tasfa2rmu pnt)aetrxr iy1fmD aivil( srxriopoudaptnlnvs sfs2trum ou4oltomfcilsfsDumu sn() etomociodlmte uei;t0tetm(opno4am nmivsas)aDtaump;t1olx mieias mDum( pnt)tleomr oytopDeln s t srtmim oy4omtemfviat)s2urumo;t1teeoii3iad m elnmsnu0 rxnxf todlaD li i s)s2xr(r3iodlp   ivtatf rtmxmooo0oetnmfctysfsDulnvsn() ltnif3iotla e n s;s0t2tmxopou1amtnlicsat a2tr( pno4oetomoeiatlm2el(ms;t4texoxo3iy1op elues;s)trtmxmpno4om  lnvilt) 2ra( oou0opeoiociasla ea(mo t4aexnxrcio1lp rluvs s  eumxmpnu1al nlfeta()sDtmxr ot0tpxoiieils sDumums u4arxrif3oytlat lnei;t  2xo(opiu1amen fvtlt sDum(r ;o0opx  ietyslm2ulums t0 eenxo ta1lm elneil()seur(rpny4optemnes (fa2umu  ;u1tetomfctat sDeanvon(0 leoxrciatomt  nei;( t2uoxrpnudol   ivsl()aDurur ou0tetnifcildfmDumnmp t4 rxrmf iodopDrluvslt t2xo(r io4am elicsa( srtaxmpoo1oleoifctlslmDrmump (4 rermocoodfmteanvs;s0seur(r nu4alte fetltfsDraumoou4teenif3tlt mDeln o;t0trtnmfciytfm  ai s;t teuoxr nu1aptemies ( sDrm(  ou0tleomfetytls rlumont) eeomr totlpte u sl(0 rtoio3nu4aptnlncsls srraxront0alxnmictyt m2eanmpnt) lxoxf3ty1lp eauvo;t0s2xmio ny4am nlicsltfaDrru pot1aeeomfeiltls ran o;u)trxoxfcty1oatrlnvsls)s2tmxmpiodlmtnlictls  rtmxr ;t1alxomfeiysfa um( p;t)aetrirctotomtrai s;() 2toxr3nu1al nmfvt sfsrurump;t4aeenifciysfs rluvsnt4trxnxf oo1lp  aivs;s)trtr(r nu4ap nmivil(f 2rrum nt1apeo ietytfmDran p;()tlxrmrcoa1opte nvil()sexmxr3nu4apenlnciasfsDrrumpnt4apxnmfeiasls umnvs u0 etnxr3ootoa elu s s  eurio iodopte fvs t  Dtrx  ot1tpe mieiys a2um(vpnu4alxoir todoaDrli o (0trxmxm iodopt lnct t)a2trur ;o0olxn ieilt s2ulnmo;t) exnxfciatop e nvol( trum(m3oo4lpen icils)a2tau  ;u0tlxoioeiasfaDeaums;(4 etnmf tatlatrliei (0 2uoir3no1omtemnvil(f 2tmxmoot1oeeo fcilslmDuln s;u0trtomo3ia1la eln o s  2xmio nodope  nesas s2tmurooo0oleo ieiad m2ua(mo t4arxnxfcoytlpt  nvs s)texmxr iu1apt  ivslt)s2ta( poo1apx ifcilt mDem( snt0tltnio totomDe neo (0texmio nodlmtnlfes tf Drm(mpou1tlxomiciys sDrl(mp u)tetrioctytfm rau ols)srxoxmpiu1ap n fvs ()artmxm ou0oltoifctlslsDuan p;()alenxo3to1fmte ueo;t s2trxr nydal nmietls)a2rrx  nt4tetnifcildlsDuan s ()trenxocia1fp  anvs;t0 rtoiopiu1amenlfetat s2tm(roou4oltnii3iltlm2ra(vsnu4 rermr ootoaDr ivi s)seurxopoodoltnmncs () rrmx  oo0oleomieildls2umnmo;t)trtrmf oydlp eln olt0 rtm(mpnu4op n ivi sfsDrrx oot0tex mo3iys s2emn on(0tleniocoydfp e i o t srto(r nu1al n nes t arrrxrpno1oeeomfctls m umnvo;()aeenxo3tytfa rlivi t trxoir3no1ap   net s) 2truro;o1oleoiictytlm2rlu onu)arxnmrcia1lpt livo;s texrio iu4aptnmnvt tfs2tau o;u0oee mo3ild s2em( s t)aeenmf3io1fm rlneo;(0srum(opiy1op e nciatfsDrm(mpot4tptn oetlt aDraumont)arxnxr3tydomtraies;(  rxrxr oy1apen feta( srraur no4alxniicildfs2rl(vo;u4aeenio3todfpte ues (  ruoio ny1ape lfcsatf 2trx  nt1tetnmictadfaDemn o (4 eeoiocto1lmt lneol()srtrxo3oo1lm nlfviat)sDrr( p;o1apenii3tytla2rl( p u4tetnmocoodfm eln sls0t2xmimpiodllenmietas)a2umu p;o4texoifctlsfa2rm( s (0 reoxo3tadomtr i s;s)teuoxr3nu1al   ncsls  Dtmumont1ope mf3iydfs ra(vp u0arenxf3tydom  aneil(0 exrim oo4op e nei s) rtau  ;o4apxn oeiltfs rl(mp;(0aetrir oytom rlieil() 2trimpnydopte nvsl(fs2rmxmp;u0altnioctas s2rl(vpnu0alxnir iotfm e n i;s0sruo(opno4omt  fvi t sDtrxm ot4aleomfcilsfm em(vp (0teenifciadlm  lneo;s)s2tm(o iodomtemneiltfsrum(rpnu4olxnmietaslsDem(vsnu0 rxrxr3oydlp eaieo s0 2umim3iudam emfetasf 2urxmpnt1aex ifcilsfm2rmuvo u4 etoxociodoaDe neols trum(o oy4ll e net tfa2umu  nu4tpen f3iytla rmn o;t) etoxf3to1fpt  n o ( s2umim oo1ap  mietas)sruaxmpno4opeomi3iatfa2ulu p ()texnircoydop  livilt0 2trxm ou4ol  mfctas aruaum nt1tlt ioeiaslsDumnvs;(0 eenxrcio1fmD  i o s) exoir3nydlmtn feil()sDururpou0tptn f3tyslaDeanmo ()aetnxf3ia1faD auvils0 rtr(mpou1ll e neta() Drm(r no1optnmfeiytlm ua( s (4 rxoio3iy1fatrai ol(0 exmxm oodop emfetat) Duauro;o0texoiieiat aDranmp;(0 etoir tatoaDean slt0 rtmim3io1alee icilsfa2tau o;u0optomf3ilt aDum(mo u4tetoxr3todoatranvil( trurxr3nu1omtnmicsltf Dta(mpot4olxn oetatla2emn o;t0 exomfcoy1fateauei t)tetmxr3oo1lltnmnci t  2umxrpnt0aptn fcilsls2eluvon(4 rxoif oytfmDr ues;s0 2to(o oy1llen fcsa()aDrm(mp;o1apt ifciltfa eanvp u)tlxoxo tadopDeaues s)s2tmxm3iu1llenmnvtatfa2tm( pot4aexoiicils mDemn pnu)texoioctytfpt anvi;t)sexm(m3ny1op nlicsa(  rtrxroou4oleomiciad m rmnmpn() rxnxocto1lmD an sl(0s2xoxrpou1omtemiesas)sDtmxrpou4ale mo3tlt m2ulnmp (4 rxoxr3totfmteai i;t s2xrxr3nu4lme lietatfs2ur(rono1tlt  ociadls rln s;() reomr oo1fmDelnei ()texo(o iy1lmte fcia(faDrrxro;t0alt mi3ils a2rlumo u0aeeoxf iadfaDe ueol(  rum(mpnudlm e fvsltfsDtrur oo1oee  i3tysla rl( p t) rtnxrcty1op  aueols)s2tmio oodlpenlneia()s2umx oot0aexo feiaslmDuanvsnt0trermfcta1fp elu s t0tetmim oy1lleelfcsat)srtaxrpou0opt  o3iydfa emu p u)aexoxfctadfa ranvils0 exmiopoo1lptnmncsat)s2rru  no4tex mieilt sDua( o;(4 eeomf tatlmDr nvol(0teum(m no4lpen fvt ( artm( p;u4tptniiciltla2rmnmsn(4 renmrciatfp r uvi;t0 etmxopio1olenlfesat)sDra(r ;o4alt ifetlslsDemu onu4altnxrcoa1lm e u s;(  2xmxr3ny4lpt mfvt (  2umurp;t0tle ifcias mDulu snt4 rtomfcoo1optrauvs;()srxrir iu1optelfet ()aDraxm ;o4optomf3tltfa um(vp u)aeeoxfcoatoaD luvs;s0trto(o3iudaltnmfctatfa2rmumo;o4opxoio3ilt m2emnmp t0aexnmfcoydoa raues t)tetrir3no4aptnmncsa(  2rrxmpnt0tetomi3iatfa rm(vo t0trxrircoy1lp   u slt srtriopou1om nlfciat)artmxmont1olxn ietytfa emumo;u0arxrif3tadlmtr nei (0srxm(o no4oleemfeia()arrruronu0aeeomo3iad mDeanms;(0alxomrctydfm ranvsls0s2umxo3ny1ole mfvtls)aDurxmp;t1apxn fctaslmDemu o t4tltnxo oo1fat  i i;(  2tm(o nodlmtn fcils)artm(r oo0oetnifeiysfm2uanmp (4arerxo tytlptraueils0 eurirpno1ll n ici t aDurxroou0apt ifciad s2rluvo u0 leoxf totoaDeluvo t s2to(m3ou1omeemfvtl(  rumur nu0tpenio3iatfm2emuvonu4arxrifciy1optranvi ( t2uo(o oodaleelnvs s aDtmxr nu1tetnifcildlmDeluvp;t)tetomf3oadoa   n o;()t2tmiopoudalt liesasfs2ua(mono0altnmociydla2uauvs t) renxf3oy1fp ranvs;( t2tm(m nodomeemneta()sDrmxmp;u4olen oeildfs eluvont0teenxf tydlpte i s;()texrxm ny1ap nmnesl()sDtrx  ;t0texnmfctys a rmuvpnu)arxnxrcoadfa raieo;t t2urxo iodol nmfvslt  Drr(  nu4apxo feiad s ulu s u4aexoif3iy1oateaivolt0t2uoirpno1am nlfcilt  Dtaxrpnu1oexoifctatla uanmp t4teerir3ia1omtelivslt)trxm(r iu4aptnlfei (  Dtm(ront4opxnmo3ias aDrlnvp u4 etriocoytfaDelueil() ruoio3io4lmen feia(  Dtr( pnt4tlx  ietld m ra( o;t0 reomo3iadfpt anei (0 etmir no4am nmfvtatfsDtaum ;u1oltn ocildfsDean o t4alenmo3to1lmt au s ()s2xmxopoo4al   fvt (fsrua(  ;u1oetnmfetyd m2uau snu0 etrxf tytlat  ieols)teurxopnydopenlnvs sfsDrrxrpoo0aee ioctyd m2ra(mo t0 rtnmrciodfa elu il(0trtrxo ny1oltnmnvs s) Dumurooo4aeeoioctatfa rlu p;(4 exoxo oydfat luvi s0teuoxo3nu4ll  mnvt s)srrax o;o1oexnmiciat sDemuvpnt0altoxf3ootlm eluvo;( srxo(r3ou4lleelfeias  2ur(r ou1opeomictldfm2ulnmpnt)trerir3iadfateanes;() 2trxm iu4lp n ncias a2rmx p;t1tpeo ociyslm2uaump;(4treomr3oodomDeaivo;t) exmir no4op nlict sf 2umu pnu4alenif3iytfm2umu s t) lerir io1fptranei;t s2xm(r3nudlptnlncs () Drr(m ou4oleo ictydfaDrauvs t4tleniocto1laDraivilt srtr(r3iydlmte fvil(f Drmum ot0texo i3ild mDul(ms (0 lermo tadopDeanvil( s2ur(m3nydlleelfvt s  Dta(m oo4oetoioeiydlm rlnmo (0tlerxfctytla e ivolt)s2tr(mpiu1alt  net t  Draur ;t0texomoeiasls2ulu p t4 exoxf oo1lpDe i sls s2uo(m3iydlptemfes t  rra(r ot0ope  oeiat a2ulums t4arxomoctodoptrlneo;t s2toxm ny4lp  mivtls)aDtaxr ou0aeeoiiciltla em(msnt)aeeoircoy1lateluei;(  rumio3ny4alt mfesatfa2rmu p;u4alt moctadlm ea( sn(0altrxr oydfp e ivi;t)s2trirpnu4amtnlivsas a2ra(m no1tpt  ocilsls rluvp u0 eermr ty1om  ai ils0 etrio iy1lmee fctat)s2tm(rp;t4oex if3tytla2rlumo;u)tlerxocoadlpDeanei;s0sexoxr ny4llte nesatf Dtr( oou4tpe iieiys m2um(vs ()tltniociytomDeluvi;()t2xoxmpiu4op emiviat aDta( o;u4tpenmociyd a2eauvp;u) lerif iotlateli o s t2tm(r io1llenlfeias srtrum ot4oetomiciasfm ul(vpn(4 exoxrcty1lmDe u s ()tetmiopiodom nmfvsatf 2uaumooo0tlxoiociadfsDumu o (0texrmr3iotfmD li s t0s2um(opiodoptemfvtasfarum(rooo4tpx mfetlsla rau s t0aexrmf oadoaDrlnvil()tetm(o3nu1op  mfetas) Dur(mp;t0aetoif3tadla ua(mo t4aexnmf3oydomDeau s;t)texrxrpoudaptelncsa( a2rr(root4tlx  o3tyd mDul(vo;u4trtrirciy1fpDe n o (0 rtrim3iodlpenliet t srur( p;u1altoiictls mDrl(vp;(0 lerir3io1fate n sl( t2xrir3no1oleelivs ()s2rmx p;o4teenioetytlaDumn snu)arxrxf oy1optelivs;s setr(r nu1oltnlfvs t)a2urx o;t4tetnmo3tad s uluvs;(4aexoif3iytlaDeauesl(0 rtm(o3iu4llen iesas)sruaxrpot4oet mo3tadla2eanmont)trtoxo3oo1oaDr uvs t)seumxmpoo4lm elieslt) 2trx pot4tet mfciytla2ul(mp (4teenmfciydla r i o s)srtr(r3nudolt  fviatfsrrruronu0ope moctasfs2rlumo;()aetoxocoa1oat li i s0trtmxr3io1lp emnet sfs2rmx  ou0tlx moetyt sDrl(vp;t0tlerioctydfp e ivs;t t2toiopnudll eliesa(  2uax poo1apx  ociaslsDulnmp (0aetoxrcoatoaD an slt)srxm(rpou1opeemfeias) 2rmxmoou4oeeoii3iadlmDem(msnt)aexoifcoytfmDr ues t0 exrio3no1oleelici (  Dtmx poo4aeenmi3iydls2ulnmonu0 eeoircto1fmD luvsl(0 ruoirpno4am emiet s s2uaxm ot1tpt ifcild m umumon(4aexomoctotfmt  nvi;s) rxm(mpny1amtn fvtl( sDrmx  ;o1oee  i3iat sDulu o;()teeoifcoy1fmtranvi;s) rxmxmpny1al nmnesa()arra(rpnt0tpxn oetyt s rm( on() lxnmfctadopD lu s s)s2xmxm3oo4alt mnvs t)s2ua(mpoo1aexn o3ildfa2eaumo ()arxoio3oa1fmDr u s;s0srxr(o3iy1lmenlietat)s2um(mo;u4tpxomo3iydfsDem(mont4 renmo iytomD lueol()trto(o3iu4lltnlieilt)s2trxroot1aeeomf3ilt m2ulump;t)tetrxo3oatfpt  ivsl(  etrxmpoo1lpt lieils) 2rru o;t0aeen iciltlm2umums t0tlxnmf3io1lpDr ueol( s2urxm3oo4lpenlneil( sDurump;t1oetoiieiasfm ean o;t4tltrifcoadopDe uvi;( s2tmxopiy4aptelnet t a2ua(  ot0altoii3tyt m ean s t0arxnxo3oodlaDeanvs t)sexr(o ou1apenmicsltf rumxmoot1tleo oeildls2ul(mp u4 lxnxrctatlaDrau s;t  rxo(m3ou4alenmics ()aDum(m ot1olt mfeiadfaDrm(vonu0tetoxrciy1fa eanvolt)texrir nudll  livia(f Dumu  oo4olen f3iltlm2rln sn(0 lxrmf3oytlm elieslt)s2xmimpnodal nlfvs s) Drr( poo0aptnmi3ildla emu s ()aetomfciadlmt li s;t  2uoxr oodop  mfvil() Drm( pno0aee  fctad sDranms u)aetrmfcoa1opt lneolt texrir iu4lmee fvsls srtmumpnu0optoio3tlsfs eln s;u)alxomrcoa1lmtrauvi;( setoxr3io4am emfvsltfsDua( o;t0aexnifeiltlsDeanmo (4 ltnxf3oo1fmtrauvi s)t2xm(o3ou4lm emfesl() 2urum ot0tleo ietlt m2umuvo;t4 etrmo3todop raueo;()s2to(opoodom   ncias)a2raumo;t0olxn icilsfm2um(mp t4arxnmrciy1oa rluvo (0trumimpoodop nmfcs s) Dtm(  ;t1opeomoctatla el(vs t0 eenxo3oo1la eln o;s0 2trxrpiu1am n ict sfaDur( o;t0aet io3ilt m2ra( p;(0aexnif3tatfptr nvo t) 2xo(rpiu1lptnmfctl( arta(r nt0tpx mfeiatls2eau o;u)aetnio3oo1fpD lieol()t2uo(o no1apt  ict tfa2tr(mpou1tlt if3iytfs ul( s u)alxrir iodlpt aneslt t2uo(r oy4ll elncs ()srta(root0olx mf3iatfsDuluvo;(0 renmo3oo1faDrlivo (  2umxo3iydom emies t)a2umxmpoo1opt  feiysla2eluvp u)artrxociotfmD  nvslt seumir oo1altnlnvsl()srtm( ono0texomieiys a2uauvs;u4 eenxfcoadopDeliei;(0sruo(o oodome lneil(f 2uru  ;t1tlen icilsfmDuauvp () exoxf totlat ai i s)trtmim oydllenmivtlt  2um(  nu0aptn o3tld m2raumo;t0tlxrif3todfm   neils  exmio iy4ap  mnvslsfsrrrxrpot4ole ifciydfa ean p;(0 rtoxr to1lmDeau ol()seur(rpnu1am  mnvta( s2tr(  nt1aeto fctltfa2el(mpnu0arermo oa1lm eauvi s  2toim nydol e feslt) rurumpno0opxnioeiat m2rmn s u)artrir oa1fmtrli s t seur(r3ou4omtelfctls) 2rrxmp;u1tle mfeiydls rmnvonu4arxnirciy1lat lu olt)tetrxm3nydllt  ies () 2rmu  oo0aex io3tytlm ua(vont)aleoircta1op rluvo s t2urxm3nu4ale mfcs t s2taxm nu0opxoifcilt s ra( ont4alxrmo3oa1omDrluvi t0 ruoimpiy1oleelnctas) Durx pnu4tex  oeiyd aDeanvon(4alxrif tytfm e i ilt)trumio oy4alt miesat  2urxmpno1olx  oetlt a2elu s;u0trxnxfctodopte neils)setmirpnodomen nvsatf 2uau pnt0tpxomfciys s2ran onu4 rxoxrciytfatean ol(  rumimpiy1amt lfetl( s2tmxmpot4altn i3iydfm umnmpnt) renmrcio1lmDe u ol(0seurxo3ou4ame  icslt)arrmx  nt0ale io3tldls2eau p;u) ltnxf3iodfat aies s)s2tm(o3iu4omtnmieiat  rtm(m ;t4aexn ociat m2ulnvs;t4 lxrxr to1omDelues t0s2xmim3iodlm  livsas)artr(rp;o0alto f3ils sDrlump u)trxoif3to1oat  u olt  rur(r ny4alen icil()sDtaxm ;t4apxnif3iltfaDrmuvon(0arenio3tydopt au ol(0seumxr oo4om  micsat aDurumpot1oexnmi3iadfmDulums;u4 etomr3oy1fmtr nei (0trtrir iy1amenlicias sDtru  no0texoifctat a eauvon()tltoxf to1lm   uvi;t  rum(r nu1lmte fetl()a2uaumpnt0opxn feiatfm ranms t4trxrir ty1op   nvi ()texmio3oo4lpen ietlt)s2rr(mp;o1teto o3iad aDum(vp t0 renioctydopDraneo;t0 etoio3oudlleelncia(  rtmuronu4alx ioeiysls2ra( o;t)arxrmo3tydoptrau s;t) rxo(r nodlmtnlieta()srrm(rpno4texomoctadla eanvs;t0tleoif3todlmte n o t0tetmim io1op nmictas  Drmum nu4tltoio3iys a um(vo;u4aexnmf oa1fm raivols texr(rpoo4alen nct s s2tmx o;o1apxnmiciasfs rluvs;t0 leoxfcoydlaDe uvslt t2tm(o3nydlme  fet ( a2uaumo;t0aetomfciyslmDem(monu0texoir oytfa e ies t)setoim3ou1am  lfet s  Dumu p;t0tltnmo3tat m2uauvs;(0tetrxf oydomteanvo;(0 euoxr3nudlm  mies t srtaxrp;t1opeo feiytfa uanvpnu4 leomf3todfatrlivolt0 rto(m3nydlp nlnctlt)a2rmuro;t0oleoii3iadfs ea(vo () lxnif3todfm  luvo s)tetmiopny1omtelnet t sDumu  ;o1optn oeiatfaDuau snt4 ltoxrctydfaDeaivo;s t2uo(r3no1amenlnvil(  rrmur ou0olxomoeils a2el(mo (4texnio3todlpDraiesl()srtr(o3oodoptnlfeil( sDtmu  ot0alx io3iat s el(vo;u4 rxoir3totla rluvols srxoxr iydop  mivt ()sDrr(mpnt0tlen oetls m2rmnmo;u)tltrxf iatoptr uvi s  2uo(m no4lpe mnesasfsDta(r ou4teeoiicildls2ra(vs;u) lxnio oo1lp   u sls0 rxoxr oudalee iei s  2tax  oo0aetnmictltfa eluvs;(4arenxr oo1op rlnvo;( srxmiopiy1lp   ivilsfsDuaxmpnu1tpt mo3ilt aDeanmp;t)arxrircio1fm   ivi t) 2uoirpoy1lp e nctl( s2uaxmono4opeomi3tatfs2umn o;t0artnxfcoodlm eauvo;s texo(rpou1optnmneilsfs2ua(r ;u4tle  i3iyt a2rauvs;t0trtnifciatomDe uvi (0 rtm(o3nydapt lfvsa(fs2rmurpnt1teeomf3tltfs rmuvp t)tltnmociadfmD  uei ( s2to(opny1alt  ivslt) Dtmxr ;o0oetomociadfmDua(mp u0 etnxr3tatomte nes;(0trxrim oy1apee icsas sDuax  ou4tlto fcias m2emuvp (0 eenif tatomDe ivi t0 exrxm oydolenmfeils)sDtru oou4oeen fetydfsDemu on() rxnmocoatlmD  uei s)trur(o3oy4lmtelnetl(fa2um(r oo0oet  fciyslsDumn on()trtriociytfa raivo;t  2uoxo iu4lmt mfci (  Dumxro;o0oexnioetld m umn s;t4aeerxo3totoaD  ieo ()trumxr ou4op e ivt s)aDrr(mo;t0tex mfetasls2ulums (0arerxocia1fate i olt0sexm(o nodolte ncias)arrrur oo0tptnmf3iyd aDranvsnu4texnifctatlpDrlnvs t0trtmirpiu4om n nvi s aDtaurp;o4aexo o3ils m ea(vp (4arermf tatlaDrau i s0s2tm(mpoy1op nlfvilsfaDrr(mp;o1tlxomieiyt s umnvont0tlxnxo3iotlpDr ueo;t) rxmxm3ou4ll elici tfsrta(monu1tetnmfetyt sDel( p u4 rxnmf3tydoptrlnesls teuriopny1aptnmicsas)arum( o;t0tex  oetldlsDrl(vp u4 etrxf iotom  luvsls) 2tmxr3nodom n net t sDrru p;o0teto i3tatlm rl( o;()aetnxo iy1optrluvo s setr(r iy4am  mivi ()sDtaxmp;t4optnmo3iys s2rmumpn() etnxr iatlmt livs;(0 etrio ny4ope  fetls  2ua(mont1tpx  i3tld s rlnvont4texoif iydfpDeai i s  2uo(mpnu4olenmnvs (  rurur ou1optnio3iys a2rm( s;(4aexnxociodfp eauvi (0 eumir ny1apt mivt t)srrrxr nu4altnii3tyd a2uanvp;(0 etoxrctotfpDraueo s0sexrio nu4am n ncsls)aDtru poo1tptnmfeiadfm um(mo t)tetoifctatoateln s (  2xo(mpoydlptelfesas a2tmu ont0tpt  f3iysls2el( s u)alenircto1la e nvo s0 2to(m iy1al n nctls) rumum nt0oeeoii3iyslm rmnms (4 leoircta1fm rau slt seumiopoo4am  mncils)aDta(rpnu0ole mf3iytlmDea( p;u) renir ta1om  aivo t texm(r3oodlpenmivsa(f 2taumoot1tle mi3iyslmDem( pnu) lxrmr3iadfate nvo s0sexoxo iu1aptnmfct tfsDtaxmooo4ape  ietyslm2ra(vp;t4trtomfctodopt livo t0trxoio3oo4llee feils) rrrxro;u4tlen iciyd m umu p u)aetoio3to1omDrluei;(0t2ur(r io1op   ncslsfs2tru pot1tpen fctatls umnmo (0 rerxf iy1lm   nvo;()srxoim3iu1lm nmies s) rumumoot4tleo fctyd sDeluvp ()trenir iodoa eaiei s  etmxmpno4omtemfes tfs2ta( pou1olxo feiyd a2um(vs u0trtrif oa1fptr ieo t0setm(opnodamtnmfcils) Dtaum ;t4opxn f3iydls2ra(msnt0trxnio3oodfatranvo () ruoiopiu4lm elneiat arrr( pot4ole moetytfaDrmnvon(4aeenirciydlptelnvs t) rtm(m iu1oltnmicilsfa2trurp;t4opx mociys s el( o;u0teenif to1omDrlueols0s2urio iu1ll n feia()s2tmum ot0ope ii3tls aDul(vs;(4arerif3iodlmDe ueilt  eurxr3iudom e fctls) Dtrxm nu1opt mictatlmDrmumo;u0aleomf3oatomDrlnes;()texoxm iu4omt  fvt s s2uaxrp;t0apxnioetyt sDel(mo;(0teenmr3iydlp  auvi t s2tm(rpno1ame mfciasfa2um(r ou0ape ifciyslaDum(ms;u)teenif3iytfa rluvo;(  exoxr oo1lm emnctl() rra(monu4aptn ieias s2rmn pn(4tetnxrciy1lm r neilt)s2umxm iu4ope mfei s aDrr(r ;u1tee ii3taslmDrl(mpnt) exnmf3ootlaDeliei;t t2toio3no1omt mfvta(  rumxmoou0oltnifctltfs2rmu p;u0teenioctydfatrli il( seum(o3iodll emfes ( srrr(r nt4aee mociys mDuauvsnu0aetnxr oatomD  i o s0s2ur(m nudoltelfctas srtm(m nt4olto o3iyt s rlumo;u4tetoxf iodoaDrlivo t texo(rpnu4opt liet (  rua(m no4alto fciasfsDea( o;()alerxr totopDranvol()trtrimpiy4lpt miviasfa2rm(roou0oexomi3ilsls rlnmp t)tleomocty1lat luvi;s0srumirpny4aleelfetls  2ra(m ;u1teen o3iltfa ra( p ()tltoir oatlpD  n i;s0 rumxopno1optemfvsas s2tm(r ;o4aexnmf3tlslm2ean p t4 eermfciadlatraivolt0 2tr(opoy4lmee ietl(fsDurxr ;o4aex mociydfsDrl( pn(4 ltnxr oydomtr ues t  2tm(opoy1olte ieiat srurum nt4aptnmf3ilslaDrm(mp () ltnio ta1lpD lneilt0 2tmirpoo4lmtn nvia()artr(ro;o0tptoiictat s rl(mon(4aetoxrctydlpD lnvo (0 eur(opiydlpenmivslsf rtax onu1ale  feiyt a2rmnvp (0 rtrxrciytlp   i i t srtrxm3iudal   iviasf 2ra(m ;t4altn octad aDem(vp (4arxoxr3io1la   uvil( sexmxopno1omenlncils) Dur(ronu1teto fciadfm2umuvsnt) rtomrciodla   ieo s t2xr(m3iy1om   ivtl() Dra(mono1tltnifeildfmDelnvpnt0texrmrcto1lmtraivol(  rxmxrpnu4op  mictasfarua(mp;u1oetniictadfmDea( pn()texomf3ootlp rlnvi (  etr(r3ou4lp  mfci ()arumur nu4tlxn oeiydlm umu pn(0texnir3oytfaDrlu o;t) eurxmpoy4amenmnci t)aDrax  ot1aeenmo3ildfm em( ont0artrmr todomteaneo;t srxr(r iu1lp nlfeslt a2taxmo;o0altomi3ildla rmu s;(4 rxrio3ty1fptrauvs;t0seur(r iy1lme  ici s)sDumum no0aex mf3ildfmDeaums;(4 lerifcootfate uvolt) exrirpiodam elnetat aDtm(rp;u1apx  fctadfa2eauvp u) eenirciadfptraieilt)teuoiopnudap n ies (  Dtmurp;u1tpx ioeiydlm emnvonu4arxomociy1op rln s;t0t2xmiopnydlm   nvi ()a2tr(ro;t1apxn i3iadfsDuan s;u4artrmf3iotfpDr u ol( t2uo(o no1olenmfei sfsrrax pot1opxnioetad s ua(mp t4altrxociy1lm rlivi s)seurxr3oodol nlnet t)sDumu  ;o4tpen i3iytlm2umumsn(4arxrxf tytlp   i i;t)s2ur(r iu1lpe lnct t sDrmumpnu1olt ifciatfmDul( o;t)aetrxr3ia1fa e i o s)s2xmiopnodolt mnvs (fs2umxr oo1open fciaslmDrluvon(0texoxfctodlmtelivo;t0setoirpny1altnlnvi tfsDtr(roou4tex  o3tldlmDrmuvp;(0 rxrxf oadlat an il(  ruoxo3no1lm e icias  Dta( oot4alxomo3ildls2um(vo;(0texrxf tadlmDelnei t t2uoxopoodope liciat)srumx ooo1opxomfciltla em( p (4 leoxfcootomDelieil(0 exm(o iu1om nlnetat)s2ua(mont0aetnmi3tadls eau o;u)altrxo3to1fpt lnesls0s2xm(o3oy1apee nctas sDur(mp;t0oexn f3tadfsDum(mp t4tlerxf3oadfm  au i;( s2xrirpnu4am nmnvi tfs2umxro;o0openmiciysfa2rluvo t0 rxnir oodlmDrlu ol( trxr(r nu1apt mivsasfa2rr( ont1oeenii3tlsfa rl(msnu0 eerif oadlm rlies;( setm(o3nudom emies sf 2raxrp;t1tee  ieils aDrluvsn()altrmr oo1fp rlu s (0 rxoxopoodlmtemicsa( s2rau  nt1apt  f3ilsfmDuln s u)alermocoodfaDr u i;s t2tm(m3nodapee ncs (  rraum ;t0opeo fciydfa2ul( o (0tltrio3tytoatr nvs;s  eumxr ny4ale mnei s aDum(r ou4alxo octytfsDrl(vo;t)tltnif tadlptrln sl()teuoxo3nu4oltn ieia()sDum( pnu1altomictltlm elnms u4aetniocta1lptelies t)teuoxr3nodll nlnviasf Dumumont0altniiciad aDemn p;(0arxoir iotfmtrlu o;s seto(m3io1om  mneia(f Dur(  no4alxo o3iadfa2rmuvp t) ltnifciotlm rauvi;t0trxm(r io4optnlict ()s2rr(mpot0oeeo ictlt s uauvo ()aleomf3oodlm r n ils)t2tm(o iy4amtemivt (  2ta(r no0opxniieiyt m2eanvp;(0alerxf3iytlm   n i ( setmimpnu4oltnmnviltfaDuaur no4tetniociadfs2uanmsn() lerxf3iytoatelies;s0 2uoio oy4lptemiesl(fsDua(m no0tpx if3ild aDrmumo;(0teenxocoydlp eaneo () 2tmirpiu4am nmiesa(  Dum(root4tpx  fciasfsDumnmon(4tlenirctytlmt li ols)srurxopoo4apt lieta( s2tmxm nu4ope  ietys m umumo;u0trxrifcoydlm r u o;t)truoir3iu4apeemiei t)sDtrur ;t0olx  feiydfa2el(mpnt0 exoio iy1lmD luvo;s0 eur(mpoudaleelivs (fs2ra(rpot4ope io3ildfm emnmp ()arxnmocty1lmD aivi;(0 rumxr iydoptnmicias) Drau pnt0oet mfetyd aDumuvs;() ltrifcootlp eai i;s texoxo io1optemfciltf Drrurpoo4aexoifeiyd sDua( s;u0 rxnxr3oo1faDeluei s trtmir3io4ap nmncsltf rur(mpou0oee mfctltls2eau s (0aexoio oadom e uvo (0 2toim3iydameeliet sfs2rrumoot1tlt  i3tydlaDul(ms t0arxoircootlpD lnvil( t2xrxm3iodlp e fetl( arua( ooo4aeto i3tydfsDrau s u)teerxr3iotlat ln ils0truo(r3nydam elfcs s  2tr(r ;o0opxo ieilsfs2uanmo u4 reoxf3iatfp e ivi (0seum(r3oy4oltnlfesa(fs2ta(  ou4texnmoetldla eluvo;(0trxnxfcootomtrlneo t0t2tm(r3nudaleemnci ()s2uax  ;t0tpe mfctat sDul( p u4 etriocty1fpte u sl( seuoxm iy4llt  fet ()srumxmoot0ope iieiydfm uluvo (0 eeomrciadlmD an s;()s2urxopno4ame mncsl(fsDrr(m nu4alt mi3ild a2uauvsn()tltoxr oy1oa  ln s;t0srtrirpou1oleelnci s  Drmu  ot1aptomociasla uluvs;u4 etrxrcio1opD  u i;s trto(m iudlpee fet t) 2ta(rp;t4alenmfciydfm rlnmon() rtnmf ta1oat lu o t trtmxr ny4oleelnct t aDua(r no4optnif3iasfs em(mp t0aeenxr3ia1opteai s s0 2xrxr3iudaptelfeta(  Dtauro;u1optnmf3ildls2rmnms;u)tltnmociytlm elieo s)srtoimpou4ope mfet s srrr(m nu1tlxo octyd m2ul(vo t4tlenmrciatlpt  u ols0trxrimpoo1ome  nvtas)a2rr(  nu0opxoio3tatfs elu s (0arxrxr3oodoatr n ilt0s2tmimpiu4ol   fei t s2rr( oou1opeo o3tasfa2emu p;()alenxo3totoaDean i s0 rtrxm3no4op nmfvsa(fsDraumono4oltomfciatls rmnmonu0tetnxr3ty1la  livilt  etmio3iodllenmnvs t) Dtruro;u1aleoifcilslm ea( snt)tlxniociatfpD li i;t0sexo(o iu4lmee nvs s)a2ur(mo;u0tetn f3iydfaDem(vp t)arenif3totopD aneols  etrxrpoudol  mfvsa()srtau pnt1apxomoetls s rmnmp;t4tetrmfcoydfmtr ueo t0srumim iodamee fcsasfsDtaurpou4optnii3iytfm elnvsnt4 ltrir tatfpteluvi (0t2urirpiy1ame mnvtlsfa2uau  ;o1altoio3ilt a2rln s () exnxo iotlmt li ols) exmxo oo4omt miet sfa2uaur ;o1tpe  ocildlm rlnvp t0altrifcoydlaD  nvs (0seum(o3oo4op e nesa( sDtmurpot0aee iiciys a umumpn()tetomf3totlpD aiesl()texo(r iodomeemfvsl(fsrrmumoot0tetoifciyd mDrmn s t4aexoircoydlp rlivilt srxo(opiu1amt lieil(faruaxr ;o1tlt  o3ils a2um( p u) etnmf3oodfm rlivsl(0srxoimpiudlleemiei tf Dtmu  ot1tltoif3iltfs ranvont)aexrio oo1opt livo;t)tetoxrpiydameemnvsat aDrr(r oo1oex iiciltfa2el(vsnu0 etrmfctadfatrliesl( teurxo nu1ole  neta()aDtaxr ;t1opxomfctldlm2ranmp t)altomo iy1lp rlivslt) rtm(m3nudlmenlict t) Dtrx oou0tltnmoetasls rln o;t)tlxoio3oatomDraivo ()srtm(o3iydameelnvtlsfa2tmx oou4olx mfetyd m2rm( s;t) ltrmrcto1omDelueil()trxmxo3ou4lp n ncil() 2umxrooo1tpt iietls mDumnmont)tleoxo3iadfa r nvo t t2trxmpiydop elicils) 2trumo;u4oleomociltlmDelums;t0altomo3iytla   uvi;t  eumxr nudol   nct s srum(  nt0alxoif3iadlsDrlu ont)tetoxr oodla ranvols0 rxo(m3iudameemici ()aDrmxroou0tpx  ociltfs um( pnt0trenxf tytopDr uvi ( s2ur(rpnodam  micia() Dtax o;o0teto i3iad m2um( o;t4arxrxo to1opteaiesls)s2tmim3iodoltn fetl(fa2tm( oot0tet if3tas m2umuvp u0altrif totlateauvsl(0 etmxm3iy4amte ncslsf ruax pou0tlen i3iltla emumsnt4texnio3oydoaDr ivo s0texrxmpiy1lpt miei (fa2rmx  ;t0teenioeildfa2eluvp u4trxrxr oytfmt ln i;( t2urxm3ny1om   ncils srur(r ;o0alenmfciyt a emu o u4 exnxr3iadlpD lnvol( seuo(rpno4olt  nctl( srum( oou1aee iietlt a2umn o;t0 ltriocoa1omtranei;s  2xm(r3nu4am e icias a2rrxrp;u0tlxo ociadls2uan o;t)trxoxrcoytlm  au i;t  rurirpiy4omtn ivsas)s2trur nt1opeoiocilsfa2ulu o (4 exomoctadomDeauesls) rtr(m3ou4ll e nvs s)s2tr(mpno4optomoeiltfs2eau p;t4 rtrif3tydopDelivils)teumxm3iu1op elicil(  Dtrum nt1alt iiciadfs emuvp (0trtoirctytlp elies t)s2xmxm3oodlpenlivtlt) 2rmxrp;o4tltomf3iaslm2ra(vsn(0arxnifcia1lm elu ols)srxmxr ny1omen nci ()a2rru  ;t1olx ioctadlaDrm(vs;t4aeenmfctytomDr n o t t2tr(m io1open netlt artax oou4teeomf3iys aDrln snu4alxnxrcoydoat li ol( tetmxm ny4aptnmnvilsfarumxmont1tet  octlsfa2ua(vpn(4aeenmr iadlmt anei t0seuo(o3iudll emicsl( aDtrump;t4oltnmiciat m ra(mo;(4alxoxo iatlmD aneo;(0trxmirpiydlltnmnvtlt a2um(mont4aex ioctat mDean snu4 lxoxrctodfmDrli o;s0srxr(r3oo1lmt  nvi tfaDrru  nt0altnio3tasls2rmn s;u4aexomfcoatlm r uei;(0 2xmxopoudllen fesatfsrrax o;u4alx io3tyt s2ulump (4 rtoif3ia1lm   ivo;s t2tr(r iu1amt  ieiat) rra(m ou0opx mictldfm uanvs u0 leoxo iotfat luvolt trxo(o ou1ome lieia()a2ur(mp;u4tpenio3tyd m2umnms;t0tlxoircoadlp  auesls0srxoxo3nu1om emnet t srtrumono1aet mi3tlt m2rln snu0arermr ootlmDe u o;(  ruoxm3iu1alt lnvtasfarur(  oo1ope iocils a rl( p t4texrmrctotfmD  u s;( t2uoxo no1ameemfes t)srtm(ronu4aeto f3ildfaDraums;t4trxoif3todla  an i s setrio3nu1omenlnvtat)sDrr(mpou0aee  f3iyt a2uanvs;()artnxf tydfaD  uvs t  ruoir3iy4ope  ici t s2tmxrp;t4aleoii3iaslm ranvp;()aetrio3ta1faDe ues t0s2trirpoodap emivtas)srtaxmooo1aetnioeiltlmDra(vsnt)tetoxfciadfat ai i;s)trxmxrpny1omt  nctltfarrmurpno0olenioetysfa2ul( on() exrir3oo1oaDrlneo;t) etmxrpoo1amtnmncsatfsDta(r ou1tpxn ieiyt s2ulumpnt4 rtomr todfpteli i;s teuoxmpny1am elivias aDrm(  nu4oltoifetytls ua( snu)aeenmf3ootfpD  ivs;()tetmio3oy1alte nvtat)a2tm(mooo1tex  o3iyt s2uaumpnt0 eermfctodlm rlueol()trxoir ou1altelfeiat srtr(rono0opxnio3ilt mDranvs u0tlenifcoy1lp elnvslt0s2to(mpiy4lpe lfet ()a2umum nu0opx  i3iydls ranvp (0 lxnxo oo1laDrli o s t2xmxopiy1amt livtls)a2umurooo1oexomfeiyd mDem(vp;u)texrmr3iytoate ivolt s2uo(mpou4alte nes t aDraxmooo0tpeo fetas a2ean s t0artoioctatla eaueolt srtmir iy1lpeemfct (  rta( o;t4oexnii3tydfsDea( o;()arxoxo totlmDrli o;t)truo(o3iudomtelictas  Dumxrpnt0oetnii3iat m uluvo u0alxomf3oatfpDrai s s)texriopiydoleemfei ( sDumxrpno4opx  octys mDeauvp;(0alxnmr oadfmD  n s t  2umxr no4lm elfeiat aDurx p;o0olx ioetytlaDra( o;u0artrmf3todlat aneo s srxmim3iudll emncsas)sDtau  ;t0oeen iciatls2ranvo;u0aeeoircoo1lm eluvo;s texr(opiy1lmtemnvsas)a2umxrpoo1tpenifciyd m2el(mo t4trxrio3oo1fmtrln s;s)srxo(r nodalenmncs ( a2rmxr no0tlt mf3iytls2ean sn()aexnmoctodoatraivo s) euoxo oodap e ivs s sruru o;t4oleoifctldfa2rlumo;t0tlxoxrctydlmDeln o;t seuoxopou4am  lfvsa(fa2tr( pot4texomi3iatlaDeaump u)teeoio3tatfptrli i;(  rxm(m nudopte netat)s2uaur ;u4tpeoiociasfs2el(mpn(0tlermo3iodopDe nvo;s) 2tr(o3oy1open ncilsfaDuax ono4aptnmfeiltfmDean pnt) rxoirciy1oaDelivils0 exrxo3ny1altelietls)sDrrur ;t1oetn ocild s ea( ont0arenmfcoadfpt aivslt)teuoiopio1omtn ivi (  2um( p;t0tptn icilslsDumumpn() eerxf3iodlmtrluvo;s)trto(m3iy4lpt  fetat)a2rrxm no1tlxn o3iadfmDrmu onu4aetomociytoptranvolt) exmxr3oydlm emivs () Dra(  nu1tle iiciysfa rln pnu0 ltnio3iodoaDrlieo;s)tetmxopiy1open feil()aDtr( oot4tpeoiicilsls rm( snu0trerir3oytlmtrlnvil(0 exoxm ny4om  mfci t aruau oou1tpxomi3tytfaDelump;u0texoif3oatlm r n s t)s2xoxo3oy1al n nvt ( sDumumpno4altoioeiad a2rau s u4altoxrciodfpD  u i t trxr(rpiudll  mnvilsf 2tmuroot0oexo fctltlm umn o u4alxnxo oa1lpDeaieo s0 2tr(mpou1amtnlfvi 
\ No newline at end of file
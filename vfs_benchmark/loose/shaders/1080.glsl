@@ -0,0 +1 @@
+nvo () etoxr oudopenmnvsl(farrrxr no0tlt mo3tld mDemn pnt)aexrmf iatop   uvsls srxoir oo1oltelieiasf Drrum no1tlenifeiasfaDumu s (4 lenxociatlp ean i;t trxo(rpnodalte ietltfarururpoo4texn i3iatla em(mp ()tlermrcoy1opDeli ol(  etrim3io4lm  lfciatfarua(rono0apt ifctat sDrm( o u0artnxr tatlmte u il()s2tr(o3io4olt lncias aDumumo;o4tpeomi3iyt m2um( ont0arxoxo iodlp r ies;t srtrir nu1altemfeil( sDurx pou0opxnmoeildfs ulums ()aleomr oa1oatrluvo ()teurir3nu4omtn nci t)sDrrumont0aptnif3iytlm ra(ms u0trxrmr3todla e ivi;s t2toimpiu1op e fci t sDrr(mont1oleomfeiytfaDrau p;()arerir3ta1fptelues;s0s2toxm ny1op  mneslsfaDraurpoo0oee moeiatla2rlnvpnt0 etnmr3iytfa rauesls srxoxmpio4ole  icsas arta(rpno4aeeomieias a2ra(mo (4 exnmr oydlm rln ilt) etoxmpno1lltemfesl( a2trurono4altnmi3iadfm2ua( pnt0teeomf3oy1lpDrliesl(  2toxm3oy1am  lieils)s2tm(mpno4alxnmoctadls rm(vpnt0alxnxf3oo1oaDrlnes;() 2uoxm3oydam  mnctl(  rrm(mpnu0aet  ieiys s2rluvont0 lxomr3ia1la elnvi;t  ruoxm3nu4omt lneil()sDraum nt0aee ifetas s uauvsnt) eenif3oytopDeln il() etrir ny4olt liciltf rurxmpou4teeoioeiyd s uau snu) rxnxrcoatfmt aieils)srurxm iy1omeemnvi t  rta(roou4oet mfeildfm2eaumsnu0 ltrmr3iadoptr uvo;t0 euoio iudlme lnesl(faDrrum nu4oet mictlsfa2rlu pnt0 exrxfcootopD luvo (0 2xoxopiy4olt  fvta(  2umu  ;o0apen fctasfm2el(vpnu4trxrxo oadomteln o s0trxm(mpio1alt  icil()srururont1tpxomi3iydlm2uaump t) rtrxf ta1fpD au i (  rurio3oudomtemici s srumxmpno1opeoiociadfmDrl( o;t0 exnxf3oodfaDr ivsls t2tmxrpiudlmtemfct s)a2tm(m no1tpxo iciadls emnmp t4 rtnir3iodfptrluvo;s trur(rpou1am e fetas  2trxmoot0tee  ieilslm2rmnvo u0trxrxocta1fptr nei;(  rxmxr oydlpe mfviat a2uau pot1apt ifetas mDulu pnu)alxrmo ia1oa   ivo s) 2tmxopio4open ncslt arrrur ou4altoioeilslaDrl(vsn(4aexoxrctadop e nvs;( s2trir nu4oltelnvtat) 2rr(m ;o4aptn fetlslm rlnmp;t0aetoioctatlpDr ieo s)truoimpiy4lpen ncilsfaDum(mo;o0tptn octytla elnmo;t)trtoxfciatlpD lies (0teuo(mpiu1llt  fct sfarrrxmp;o1tptnmocildfaDemump;u0trtrxfctydfm  auei t s2urio oo4aptelfesatf Drm(mono4tee ii3iytfsDrm( s;t)teeoxo3totlm   ueilt0 2xm(r3io4lp emnciasfa2rr( ooo0tet  i3iytfa2umums t4 etnifctadomDran ol( trtoxopiodlm nlictl(fa2umu  oo1opeo ieilsfm rmumo;()trtrmocoydop e i s;t)teuoim oudll n ncs (f 2trxrooo4ole moctlslsDrlnmsn(4 lerxociodlat  nes;s0 2ur(m3iy1ol  mictl(f rtmx o;t1tpt iiciys m2eau s (4arerxo3tydlm e n slt0 ruoxopnudlme lnetl(fsrtmu  ot1oeeniiciydfsDuluvo t0alermo iotlpD anes s0trxmimpnodamtn ies s  rtrxr ;t4aex miciys aDul(mp;u0aexnir ty1lmDeau s;t) rtrio3oy4omeelfet s sDrm(rpno4oee io3iysfa eaumsn() etrmf tydlptran s s srxrxmpnu1al emfei ()sDtaxm ou0alxoifeilsfa2ea(mo u0tltnmf3oytopD lueo;( srur(r oudapt mnvt () rrm(m ou0tlenioctytfsDuaumo;u) leomf oo1la e uvolt texm(m ou1ol  mfvias  Dur( o;t4oexomieiasfm2el(vont0 exrmociydomteai o;t) 2urxr no1lmt micil(f rtrumpoo0alxnifcilt sDra( pn()tlenmo3ta1lm  aieo;s0sexoir iy1ome  nci ()aDumx pot0opt ioetydls2eanmp;()trxnxfctadlmtr ieil()s2umxrpio4oleelfes sfsDrau poo0aeeoiiciysfaDumn p;t)alxomocootfaD aies s)srxmxm iudalte ncia(fs2tmxmp;o4opeo oetydfm rl(mp (0 rerif3tatlm r i o s  2um(opiodameelncs sf rururp;t1aetomicilslsDrlnvs;u0arxnmr tydfmtr nes;t  ruo(mpoydale liviasf 2rm( oot4olxoiieiydlmDum(von(0altnir3oo1fateaivi () 2xmxmpnu1oltelnvtlt srtmxrp;u0olx mfeilsfm ulump (0alerifcto1fmD ai i;(0trtrir oo4lm nlfvi sfaDtmu  ;t1altomieildla2ulnmp u)tlxrxr3oydfpt  ieilt0t2xmio iu1ol nmncsls a2taxro;u1alt io3iyt m2rmn o (0 lxrmocta1lmD  u s ()srumir3nodope livt (f 2rm(  ;u0tlto fctldfmDemuvon(4 renmfctytopt  neo ()t2tr(rpno4ole mfeia(f rrr(moot0tptoif3iydfa2rmnvp;u4arxnio3iadoaD  neil( texrimpoo1om e ies s) Drm(r nt1apeoii3iadfs emu o u0tltrio3oy1latrauei;t)tetr(m io4omtelfetltfarrauroot4tpx moctls mDeluvont4aeenmfctytlmDe iesl() rxoxo3iu4amee feilsf rum( o;o0tlxo f3ilt a2rl(ms;u4 etoxf tatfpDe ieols0seto(r3oodole mivtlt)aDur(rp;o1tee ioetysfa2ra( o;t4tleomo todfpD au o;t0seurxo3ny1om e fetlt)srurxm ;u0tlenif3ils m2rm(vont4tlenxf3oodla  li i;s  exoxo iu4ame  ivtas)sDtau ooo4aee  i3tldfa2ean s;t0 exrmo3tatfaDeln s s0 euoio iydll  lietl( aruaxrp;u4tpxniietyd a ra(mo (0arxoif3oa1laDraneils0 rto(o3no1amt micta(  rrr(rp;u4alxo ociad m2rmnvp;u) eeoxfciydfmDran i () euo(rpiudllt  ncsls)a2urumpot0ole mf3tldfm umnms u)aeenxr3iatfa e neol(0trxoir oodlmeelfei ( artmx pnu0texoiocilsfmDran o u4artoxrcoodopD  neslt)srxrxr iu1am elfvilt  ruaumo;u0tpt iietysfm2rauvo u0 lermr3io1faD lnvo s  2tmxm ny1ope  nvias)sDuaurpno0tetn o3ilt s2uln s (4aexrxo3io1la eln i;( s2xoio oo1ape  ncs t  rtr( onu4aptnio3iad m rl(mp u)aexoxr oodfmt aieslt  2xmim iydlptelnvia()s2ta(  nt1opeomfeiadlm2ean s;()aexomo3oydlmt auvi;t0t2xoio oy4lpe mfctat s2trum ;u0oeeoifciasls2uanmo t)teeniocoodla e n il() 2uo(r ou1openlfvs (fsDuaurp;u1tpen fctysls rlnvonu4teeoxf oa1opte ivi t0tetm(r oydapenmivsas sruaurpno1optnmfciyd sDemumon()trerxo iadlmD aues;s) rtmxr iudomee fvs s)sDrru o;t1aptomo3tytfm2ua( ont4 rxnxo oy1la   ieo (0srur(m ny1al emnciltfsrtmumpoo1aex io3ils m ulnvs u) lxomocoatfat  uvils0srurirpoodaleemnctas)srua(mo;u0tpeoifetyt s2ranvs u4areomfcty1fat an i;t0 ruo(opoy4ap nmiciat s2tau o;o4opx ioetydls rln p (4alerxfctytlpDeaneolt  rxoir3iydlpe  feias aDum( poo0olx mf3iysfm eaump;t)aexoxrcoydopDrluvol(0srumxrpno4ll  lictas)aDurxr ;t0tetoio3tat mDel(vo;()arenmf3ta1la  aiei t0texm(r3oy1ll nliesltfarrm(m nt0aee mietltfm2ua(mon(0trermo3tatlatrli il( s2tm(mpnu4omtnlnvtl()a2ua(r nu4aeeo fetldfs ul(mp;(0aetoxo tadfmtelnvslt s2uoirpio4ap nmfctas) 2tru  oo0texoifciad mDumumpnt) eerio3io1lpte nvsls  exoim3io4olenmfvi (fsrumu  ou0oet mf3iad sDra(mpnu0trenirctadfp  an il()tetoio iy1lltnlnet sf Duaxr oo1olt ii3iadlm rlnvs;u4 lxrmoctodfa r ivi () rtoxrpoodalt lfcsl(f Dtr(mp;u0oleo feiyt sDea( sn(0tlxomrciy1lmt  ivi;s srxmio3oo4ale mnei s)aDtaxmont4alx mf3iyt s2el( p t0altrmf iodlaDelivs t0s2uo(m3io4am n ici ()a2tmx ooo4aee moctadfmDumuvp;()teenif oytoptraues (0 2urxmpiu4lptnmivias  2tru  nu1olxoifctad aDulu o t4 lerxf3tydlatrluvs;t sexoim3oudlltnlnctlt)sDumxmo;u4aexnioeiydls2rl(mo t4 renmf iy1fm r n i;()s2um(r3oo1ap e ncia() 2rmx pnu1texo feiltlmDum( on(0 ltnio tydop eli s s) 2uoir3iydlptnmivsat srumxm ot1teto fciytfs ranvont0tltrxr3to1fmDrlnes;t t2tmxr oydope lnvtltfaDua( pno4tetnmocild m eauvs;u4 eerxrcoo1op   nesls) 2uoiopiu4olt mncsl( arrr(roou0aex  octlsfmDumuvon(4trxrxf totoat lieol()trurxm ny1am nmfeil()arurx  ou4altnmoeiadlm rluvp u)aetrxo3oo1oa rlu sls trxoxr ny4apeemieiatf Dtrxm ;t1aetomo3tlsls rmuvsnu4tleriocio1fm e ies;t  2triopnu4alt lfct t  rrrurpno4tle ifctytfmDrm(mp u0aetomf oodoa  livilt srtr(mpiu4lp e icsltfsDra( pnt0texo ociytla2elnmo;(0altnmrcia1fmD livs t0tetoxopno1omenlivi ( a2urxm ;t1teeniieiltlm2em(vsn()tlxnxf iatlaDe ivs;()setriopoydam nmics ( a2rm(m ou0apt ifetydla elu s;() rtomr3oo1op eli s;(0t2xm(r oodap elnesatf rra(ront0tetomoeiytls uau o;(0tltomr3totoa r i slt) 2toxm3io4ll nmivi s)arum(  ot1olenmfciatla rm( p;t)aleoircoo1om e nvsl(0 2xo(r iydame  fesat a2ua(mooo4apxomfctytlm ua(vs;t4 lxrxrcoadfpD  u ils0t2uo(mpou4ome lieils a2tm(r oo0aptnif3iatlm ulnms;(4 exrmrctotfaDrlu sls t2um(o3ou4omenlivi s s2ra(rpnu0olxo f3iytfm2ea(vo t)tlxrmo oadlmDeluvi;s) 2trxmpoo4lp   fcias aDur(mpou0tptniietydls el( o ()aetomr oydoateln ilt) 2uo(m3ou4omt  ivilsfarrmx pno0tet mfciytfmDrl(ms;u4 exnmocoo1oaD auei;(  rumxr3ny4omt  ncsa( arurumpnu0oltn f3iaslm2eau pnt)alxnio oa1fateli o (  2uoir iy1lp  lfvias  2rm( onu0apt iocilsfm umnmp (4alxnxocoodfp raues t0teuo(m3nudlle  ivsa(  rtm(mont0alxnifetaslmDrmnmo;u)aeeoxr3ia1la rlnvi t texrim ny4om  licias) rur(mpot1tlx io3tad mDemuvp t4tlenmf tydoat aivs s)srxm(opny4alee fctat)aDuau  nu1aptomi3tytfa rmu s;u4 exomr iodfatran s ( srxrio iu1ap n ivsa(fs2tru  no4olxo f3tlsfaDrm(vs (0trtrifcty1fa  ln slt) etoxo3iy4ame  ics tfartr(ro;u4tpxnif3iys aDean s;u)trxoxfctytlmDran o;( teto(m iudop  lnvs ()sDrm(mpot1tltnmfetatfs emn p;t)trtrxociadfa e n slt0srtmxr3nudapte neil(fs2urx  no4tetomi3tas a rm( o;u0 lxnxf3iadlaDr ieolt0 exoimpoydameelfvi sfsDuru oot4aeto ociatfm uluvp;t4tltrmr oa1late n o;s  rtm(m3ou1ap e fcsa(fsDrrumpno0ape iictyslaDuanvs;t) rxrxr3iytlmteaivi (  euo(m3no1op nmnes ()s2ra(rpou1opeo fetydfm rln o () leriocia1om eliei;t) exmirpoy4olee fvtas)a2taum ;o0aexoif3iyd sDrmn s;u0 eerif iy1lmD an olt) eum(mpoudllte nvtat)srrrx  oo0aleomfctlt aDrmn o t)aeenir3ootlatelivsl(  exmio3ny1optnlfctlt srrrx pnt1tex mi3tat s rln o t0altrmo3oatla eluvs;t)trtoimpoy1altemfvi (f rurx  ;o1open f3iasla ul(vs u0altoxo ta1oat luesls0 exr(mpoo4ll e fvt ( srtr( p;o0oexomo3ilt a2elump;u) rerir3totomt  uvo;t)srtmio ny4ap elfvt sfsDrrum nu0aee ioeiyslm emuvon(0trtrmr oa1faDr n s;(  eumxrpiy1lptnmfeiltfarur(r ou4oeenmfetytfmDumu s;u4aeeoxr ty1op rlu s;(  rur(r iu1om  lneiltf 2tm(mpoo1tlxo feiytfs2eauvo;()texrxr tadopteaiei t)teuoio no1lmtnmfvils)sDum( o;u4aeto oeild a umnvsnu4aleoxo3to1fpDraueo;t)texoxopiu4alt lfci s sDrr(m no0oetoio3tld m2rm(ms;u0trtrio3iodlmDranvsls srxm(o3oudope  iet s s2uaurpou1alt  fctat s ua( s (0tetoif tadfpDr ivs s)t2xm(o iodaleelfes tf Drr(mo;o4apto icilsfa2eanmo;u)tetoif to1lmtrlu o s)tetm(m iu1ap   fvs () rrmxmpou4alxn icilslm2ranmp;u) ltrmfctatla  au ilt) 2xmimpno1ope mncia() rrmu o;o1opt  ieilt mDeluvpn(0 etrmf3iotopt  n i t setoxr3iu1ap  mivt s srurump;o0tpx ioctld a2emuvonu4teermf tadomD luvs;s t2xr(opnydll   ieils s2rax  no0tex ifctldlmDeluvont0tlenxfcoa1oat auei;(0 exoxmpoo4lm  mnct tf rrax o;t4olxniictltlsDumuvs () leoxo oy1fm rlu o;(  rxoxr iodlptelivtasfs2raxroot0tpx mf3iyslmDem( p t0 exnxf3ia1op elies;(0s2umim3oudop elfci sfsrrr(  nt0aleoii3iysls ul(mp;u4 lxnxo3todoa eai ols tetr(opnodoleemnciatf rrmurp;u1aexomfciytls umuvs () lxoif3todopD ai olt seurxopoodlmee icias)s2tm(rooo1aexnmietatls emn o;u)alxrmr3iodlp rli ils srxrxr3oodolenmies t)arrm(r nu1aeenio3tldls umu o u)tlenirciydfm e ivs;t)t2xm(o3io1lp n iei () rtmx  ;u1alto ieiadfsDrmums u)altrifctodfa ranei t srxmim iu1alee netat)aDtrxm nu4olx  ocilsls rmnvp u4altoif3iydlp rlneol(  ruoxrpiodapt  fvs tfaDuauront4oeen ietadlmDrl(monu) ltnioctodfp e iei;()tetmio nu4ap nlicslsf 2tr( pot4optnio3iysfa2ul( snt)trxrmf oadfa  luvo;t0 rtrxopio4olenmnvsltf 2rru p;u4aptnmieild a2elu pn(0tltrxo3oa1faD  u o;()seumio3iu4omee neslt) rra(r oo1opxo i3iatlsDrlumpn()trxnmrctadlm r uesls0truoir3oo1alen ivtat a2rmur ;o4apeoio3tlt mDrl( pnu4teenxo3oatfatr nvo;s)tetrio oy1om nlfesat)a2rr(monu0tpeomfcias s uluvsnt0aeermfciy1la eanvilt  exo(opno1llt mfvslsfsDumum nt0aexoii3iyd sDua(vsn(4 lerxfcoadfate i s;s) exm(r iu1open netas)a2rm( pot4oltnioeiyd s2em( o u)treoxf iadla  anvslt srtr(r oy4lptelfcias) Drmxrpoo0oetn oetyd m ranmp;t0 lxoif3oodop  livi s) etmir3oo1aleemieiat srrru p;o4aleomoetaslm2rl(mpnt0arxrxf3ta1la  lneo;s)setoxm nodomte ieiat)srtr(m ;o4tetnmo3iysls ranmo;() eermf3iytlpDelies;t) 2tm(o ny4om emnctls) rumx ooo4opx  o3tysfsDea( o;(0 ltrir tytlm eai i t t2uoxm3iy1apt livi tfarurxmp;t4aex mfctytfs ranvs;(4 etrmr oodfmDeli s s)trxoir3iydap e ivi ()s2rrumpot0alto i3iatfs eln s u0 etrxf iatfmD li ilt0srxr(r3iy1aptelieia(  Dtmu pot0aetnifciysls2ranmo u)tlenir3iy1omt anvils)tetr(r3io1op   feta(  rua(  nu4olxnmietasfa emnvp;(0 exrxo3tydfmt  neo s srtoio nydameelnvs s)srrmxm ;t4alenmieiys a2eaump;(4 rxnmr iy1lmD ai s t teurxo iudop emivtls)srua(roou0tltn i3ilsfsDuaumsn(0tleomf3oatlp elueo t) 2tmio oo4ap n fviat a2ta(  ot1aleomoctad m uaums u0texnio3oy1faDr ies s  euoxrpnydope  ivslt arurur no0tptnioeiaslm2um( s t)trerxo ta1fatelnei;t) etr(o3iydlp nlfvta(fa2rrxrono0aptnifetysfmDrmuvs (4altrif oa1oaDr nvi t) ruoxm3oodom elivil( a2tmxmpoo4aex ifeiatfm ulumsnt)texnircta1fatrauvo;s srtrxm3oydlptn fvs t  rtr( ono4aetn i3tatla eau snu) leoxf io1om ranvilt0 etmio iudamte fcsltf 2uax ont4tetnmfetatlaDeaumonu0tlenxo3ootopte ieo ()trxrirpnu4lle lfetasf Dra( pno0oltoiiciaslm2uauvsnt0alermr oodop  aivols) exr(mpno4ale lici t)srta( pno4olx io3tytlmDum(vs;u0aexoxf3tydlpt  iei s0trum(o3iudam  mfvilt aDrm(mpnt4teen feiydfm2uln onu)alermf iadlm  luvols) euo(m3ny1op e nes (  2rr(r ;u0opeo ictadfs2rl(vo u0texoxf ty1oatr ieo;(  eurxm3iudolen ivt (  Dur(m oo4aleo fciaslm rm(mo;(0 exoir oadfpDelivo;t) rxrim3nudole mivtl(fsDrru  ;o1tpenioctatfm2ulnmp;t4 etrio3iadlpDr uei () 2xoio3nu4am nlnet t)a2um(rono1ope mfetytlm uaumpnt0teenmo iydfmt  ivs t)texm(mpnudalt  fetatf 2um(rpot1apxnii3tldfa2rl(msnt4treomfcoatlat lu ilt)trumxr3oodamtn ncs sf Dra(moou4teeo octldfaDrmumsnt) rxnmociytlatrlneo (0 euoxopio1om emncsas s2rruro;u1tpeomoetas aDuan o u0aetnircty1lmt anvs;( trtrir3iy1amt  ivt t a2ra( o;u1apxo fetyt a2umu pnu4 reoio tadlm  anei () 2xmxr3no1ole mieia(  Drruroot4oee moeiadfs ul(mp u)trerxfcoa1lmtraueilt0 2um(m io1oltemncslsf 2uax pno4oex  ietasls2umnvonu) rtrmociydopDeauvi;s)srxmio3iy4apen nvtat  rrrxm ;u4tpe mfetld sDemumonu) eeoifciatfaD livi t0sruo(rpoo1opeelncsltf rrm(r ;u4texo ictldfm2eluvp (4 eenmr3iy1fa e u s;s sexoio iudaptelivsl() Drmumpot0oeeniieiat a em( s;t)trxnir iodoaD luvilt  rtrxm3ny4ap  mfeil( srtr(mpnu0tet  octyslaDean p ()trxoxr3ta1laD aies;s)truoir iu1ap  lfcs sfa2trxr no1tpt moeiys mDrm(vs t)aetnmo3iodfat  neslt0trumimpio1lle  fes t sDtax ono0tex moeias s rl(vs (0tetnmr3oa1fat lu il(0srtoirpnudam eliesls) 2rrxr ot4oetn i3ils mDrmu s;(4aetoircoa1fpD  n i s) eto(r ny4llt mnesa( artr(m no4oetn i3iys s2elnvpnu0teerir3ta1oaD lnesl()s2xoxm nydom e neta() Dtmumpno1apenioeiasfsDumump;(0 leoxrciatfaDeaivi;()trum(r3oy4lleelnei (fsDrru p;u0opxnmoctad m2um(mo;(0tleoif3iytfmteauvol() rtrim3io4apeelnvia() 2rm(  nu4alx moeiysla2ul( pnt)alxrxrctadfmt  n o;s0 2ur(o iy4ap e ictlt)artmxroou1opeomi3iys m2rlums;(4 rtoircoadoaDr nvi;s0srtmir3nu4al  mnct s  Drmumoou0tlt mfctldlsDeluvsn(4 lermo iodlatrai o s0 rur(o3ou1om nmivt s aruau o;o1oleoio3iat mDrmnmsnu4teerxocoydom ranei s)t2xrirpnydope lfvta(  rra(  ;t0tetomf3tadls ua( p u4 exnio3ia1faDe ivi;(  2xrxr3oudap eliesls srtru  ;t1aptomictld s rlnmonu4texrmf todlm  aivsls teumim3oy4alte fct t  Dtm(mp;u4oetn f3tatfs2emu pnu4 lenirctotomDranesls0srtr(opoo4omenmneils artmurono4alxo ocias s2emnmp (4 eerxf oa1lmD livo s0teto(opou1al nlnvs () rtr(rp;o4apeoiieildfmDum( o u)tltoxr ootlmt auvo;()tetr(mpiudoltelfvt t)sDrr(m nt4oet mietadlm2emnvpnu0 eerxf iotfmt  iei;(0texrio3no1lleelici t sDumxm ;o1opto o3tadfm2rmuvs;u)tltrxo iotopDrliesls0srto(o oy1omt mnei tfa2uaump;u1texnio3ilsfm elumo t4alermf3oodla  lueil(0t2tr(r ny4lm emies s)sDrm(moot4aetomf3tytla ran o;u4trxrxr3tydopt livi t srxr(o ny4lm elici tf 2trurpnt1tlto ieiytfs2ua(vo;u0aetnxrciytoaDrluvi;s0 etm(m iodal nlnvil( s2tru  no0oee ii3tytfm ea(vsnt4 eenxr ootomDranvi;( trtr(r iy4lpe lici (  Dta(rp;t4alxnii3iat mDrlu ont0teeoxf3oydfaD ln s s tetr(mpio4lleelfcsl(  rrrumo;u1tpxoifctydfsDulnmp (0artomr tatlaDrai s;()srurxopou4alenlfvslt)a2rr( ont4olx mocild m um( pnu) exriociydlp r ues;t s2xr(o nu4op   fvilsf 2ur( p;t1tle  fcilt m2ra(vp;u0 renio3oa1fp  ai i (0t2xrxr iu1ap  mfcs t  2um( pou4olxnmo3iys s2uln snu) rerxr oytfmteln i () euo(o iu4opeemicil()a2ua(rpoo0opeomf3tydfa rmnvp;()trtrir3tadomteauvs s t2trxm nudape mneslt) rumu  oo1oltnmieiytfa2rlnms;t0 ltoiocoy1fm eauvi;(0t2xrxrpoo4om elfctatfa2rr(r oo0aeeomieiysfmDem( snt0trtoxo oytfpt ai i;s)sexoxr no1ll nlnes t  rtmum ot1aex  oetydfm rluvo u0tlxoxo ta1oaDelueilt0trur(o iydapen nci t  2ra(  nt4tpx mf3ias sDuln o;(0tleoir3oo1omtelieo;t0 rtrxo oodlmtelnei s a2ta(moot1alen ieiytlm2umn onu0alxoxo ia1oat luvi t srtm(o oodale livtls)aDur(mp;u0tptnmictatlmDem( s;(4aleoio todlat auvo t trxmir3nydlm emfei t)sDtmuroou4tex mieiydfsDrmnmo;()aexoxo ootlm  an i;()trxo(rpnodll emnvs tfarra(ro;o1tpxnioeiatfs uan on()trtnmo3ty1oaDe uvo ( srtoxo3ou4om   ies s arururp;t1oetniociasfm2ua(mo;u)tltrmrctadfpte uvo (  2xmxopou4ameelieta( aruax p;t4optoiieiltfm eaump t)altrxr tadlp eln i s  eumim oy4lleemictatfa2tmxr nt4altomfciad a ra( s () lxoxr3tytfmD aueolt  etrio nodapt lfci s)arumu  ;t1aetnmf3iys s eanvp;t4trerxr3iotoa r uvi t)trtriopoy4olenmiesa(fs2ra( oot0tpeo ociyt m2el( o;t0 lxrxo3ta1fa   nvslt teum(mpoodop e ieils  rtaxrp;o4ole mfeils a2rlumo u)alerif3oa1opDe n o s)t2tmir ou4aleemfcsl( aDtr(  ;o0alen ietlt s2rl( o;t)artnmrciydomDrli ol()trxm(m3oo1aleelncil(faDrr( pno4texomfcils aDrln snu4tltoxr3oydlmDeauvsl( teuoio3no4olt lnet t  2tm(  nu0opx ifetytfs2rlnvs;t)alxrxo tytoaDr ueilt tetoxo3oo1aleelfvilt  Dur(mpou1oexoioeiydfm2ranmp () rtoif3ta1oat  u s;( t2tr(o oudole mieil()srur(rpot4aetoiieildls2ua(vsn(0 rerif oatoat  u o;s truo(o3io1om e fci ( aDra(rooo4alenmfciad mDua(ms;() rxnxo oo1omteaiei;( truoim3iu4lp e ictl( srrmu  oo0alt mictadlm2ra(ms;()tltnmr oatoate n ols  exoim oy1apenlivia( a2uau poo1apxn f3ildfmDumuvsnt) rxniociodfa eli sls)setm(m iydalt  iei () 2trxm ou1apxn f3tyslsDulnmsn() rxoir3io1lm  an s;t)seto(m ny4lp  lfci (fa2rmx pnu0oexoiietatlmDrau p (0 exnxfctadfp eaneo t srxr(m ny1optnlfct (  2uru poo4tptomfctys sDeau o;(4altrxo3oadfat lu s t0srto(m nu1al n feias  2tax ont0alxnmfetas aDelnmp;t)texrir3oytfmD lnei t tetm(o3oy4op nlicta( srurumoou4tpt mo3tas s2ea( p;(4aeeoxocootfpD livs t t2um(mpiydam  lfvt t)s2rax  ot0oetomictydlaDrmuvp t)trenio3io1omDraueil( s2toxo oudameemietl(  2ur(rpot4oleoioeiadlmDemuvsnt) rxnmr ty1fatr n i t) etm(opiy4lm  lnvtl( srtaxm ;o1tpx  f3ilsfa el(vo;t0 leoxr3oytlateln s (0s2xrim iu1apt lfvs t) rrru  oo1tee moeiydla uanvsnu) rtnmr tytlat  uvolt0sexoir3ou1ape  iciatfarumur ;o4tpe  ieiatfsDel( s;t) lxomo oytopD lues (0 exo(opnudom nlfvia() 2uau  ot4texoifeiltlmDea( p;u)trxrio3tadlptrlies;t0s2tmir nodamt liciltf Duaxr ot4oltn i3iysfaDem(vpnt4 rxrifctadoa r i s;(  2xoxr3oudamt  ivias) 2rmurpnu0aleo ieildls2eanms t4trtnxo oadfateluvs;s sruoirpny1lm elfetat sDumxr no0aeen i3ilslsDeaumsnt0areomf oa1faD  ies (0srumxopio4omtelfvsl() rtax pnt1aleomfeiytfm umu s (4tltrmfcia1fm ran ols0 2xr(o3oo1lmte nctl(fsruaumonu1teeoio3iytfaDea(vs;(0tlermr3oytlp e nvs t t2urxr3iu4lp emies (fa2raur ;t4tptoii3iysfaDulnvonu4 rerioctotoateaivol( s2xm(m3nydoltnlietl(farrm( o;u0opx ifctls s2rmuvp;u) reoxr3oatlptrlneol(0t2xmxr3no4ol emivt ()s2um(mono0tpeoii3ilt s2uaumpnt) lxrmo3oytoatr i i;s srtrirpiy1lle  fcia(fsrua(m ;u1oex  feiadfa2uau pnu)aetoxo oa1omDeanes;(  2trxmpou4apt lfcilt aDtax pot1tex io3iyt mDemnmo;()tlxrircoy1fmtr nes;( s2uo(m io1lleelncsasf 2trxro;t1texnio3tlsla emnvp;u0tleoxociytom  lueils srxrxo ou1op   ivtls srumx o;u1alt mo3iadlaDrlu o;(4texnif3iy1fm e ivs;(0texr(rpnydomt lfvs t a2rru  no1aee mociytlaDraumpnt0 leomf3tydom e u o;() eur(o3nudolt mfeilt s2tm(m no1oetn octyd mDean o u)treoio ia1fpteai s;s  exmxrpny4llte fei tfa2taurono1tlt io3tltlmDrl( on() eenif3oodfpDraieo;s srxoir iy4altn nctas) 2rau  ;t4tptoiociytfs2umu s;t0tltnio3tytfm  aueo;t s2to(o3nudlltemfvs ()s2rau o;o0apx iiciasfsDrl( p;(0altoircto1lmDrlnes s) 2xrxr3no1lptelieslt s2ua(mpno4ope moeiltfsDranvp;u4 ltrio iy1lmt lu sl()t2tmio ou1lltnliciatfsDra( oot0aetoiieiat aDelu snt0artomoctotoaDeaneolt0tetmxrpoudalte fvil( aDrrxmo;o1apxomfctydfs umnmont0aexrir3iadop eauvi t) rxo(mpoodaltn ncsasfartmur oo4apxomoetydlsDran o u0trermfciotopDelies;s0 etoxo no1om  licia( srtru p;u4ope  feiyt sDra( pnt0 leomf io1lpt  nvils)s2xrir no4op elfcsltfartmxmpot4teeniicildlm elnmp u)tetomr3oatfa e n o t0t2trir3no4lm nmfcslsfsDtmu  nu0teeoii3ilslm2uan o (4 exoxfcoo1fp  lieslt  2xoio iudom emfcslt)aDur(mo;t4oet  ictltlm ul(monu4altrircoatopDeauvi;s0t2uo(mpny4aleelfvtls) Dur(mp;o4tet ioetydlaDrau s;u0aetoxfcootlaDrlnvilt  2urxopnodlp  lfetasfartaum oo1olto o3ildfa rlnms t)trenir ootlaDeaneo;()sexrio3iodopee nci tfsDtr(rp;t0olenmfetldfs ul(vpnu)artnxf io1la r neols  2urir3no1lpt  ict s)sDtmxrp;u4aptnifeiatlaDrmnms u0tlxoifcoy1lm r n o t)trurxo3oo1altemfvias sDtaxmpnu1aleomfciyt m2emnmo u0artnmociydlat  i s;s0 rxoim3nodalte ici (f rta(r ou1optnii3iydfmDuauvp;t0 eenxr ta1oaDraneo t)t2xo(r nydlle  ivtlt srur(rp;o4tpx mfciad a2ul(mp;t4 etoxocoo1lp eau o s0t2xo(opnu1aptnmieilt  rtax pot1tlxnmociatfm2um( o;u0 leoxo iydfm eauei;t0t2umirpou4amenlnvsa(f 2rrx  no4aeeomfciysfa rlump;t4texoxr3oytla e ivsls) rxrim nydlp emfvia(fa2rr(r nt4tlx mietadfaDra(vs;() rtnifcoodfa   ieol( truoirpnodam emfetls aDtm(mp;o0tpeo i3tlsla2rln s t0 exnmrctatomte uvo;(  rxrxopnydlptelnes () Dumur ;t0olx  icils sDuanvs t)trenmr3iydomDe ivils0setmir3io4llt  nesl(f Duaumooo0tetnmieiytfaDea( s t4 rtoir to1opteli olt0trtrirpnu1aptnlies ()arrrumo;u1alx mo3tld m2rmnms t)aexrxrciadlpDrau o;()srurimpnudap  licslt) Dtrumo;u0aptnmf3ildlsDeln s ()tlxomo tadla r iei s  eurxrpiu4amtn iet ()s2trx pou4opxnmfctad s emnvs (0texoif3to1lat lues;()texmxmpiudapeemfetlt)s2trur ou1altomoctasfs rln p (0artnmf oatopDrluvi s trxmim3nodal nlivi t a2trx p;o4alxnmfciltls2rl(mo;(0tltrxo ootlmte uvo t)s2trio io4apeemicslt) rraur nt0teto i3iasfs2rln p u4 rtomociytlmDr ueils0seto(mpny4opt lneiat) 2urx  ;o0tltnmieiyd m elumsn(4aeeomrciodoa e i il( s2toxopoodoleelfvs t)a2rrur nu4alxnioeiyt aDrmu s;(0aexomf iotfa elieo s0 etr(r nydlmt licias arumxm ot1tpx  f3tls a umnmp;u0treomrcta1lpD an ol(0 exrxm3iy4al elfcsa(fsrtru pot0tpe mf3iltfmDulnvo u)aleoirciatopDeauvo s0 rurxm3iy1lpee fviat  Duaxroou1teeoio3ildfmDraumo;u)alerxfciytomD aiei;()srxoxr iu1omte ivilt)a2rm(mont0altniietadlmDra(msnt0aleomfcootop raueil( trtmxopnydomte nei s s2rmum ;t0apx ifciytlm um(vs (0artoxocty1fa ranesl(0s2urir iodapee nct ( srrmxmoou4ale mo3ilsfa el(vs;u)aeenir3ootlmt an s;t) 2xmim iy1lmen iesls)a2rmxmont1alenifciys m ran s;t)texoxrctodfmteli o (  eurio iudapenlivtat  rtrurpou4aeen ociysfaDrluvo u4arenif3ootfpDraueo (0sruo(opnu4lle lncias) rrrxro;t1tpenmoctyt aDelu p;t) rtoxociadoateai s;t)t2xmxo oudlme mfvs sfaruau pou1tetoio3iltfs rau s;u)altoxr3oadlpD ln s;(0tetr(mpiudol nmivias)s2rmu onu4apxo ictytlaDran o u4alenxf3iydfpDr nvol()truoxr io1lpenlicias s2uaur oo0oeenmfctltfsDel(msnu0 rtrmfcoy1la r neils)srtm(opnydame  ncs t) rua(mp;o4tet  oeiys s2ra(vo;(0altrmr iadfm   uvolt) rtrxo nu1apteliviat) Drmur ;t0tptoioeildfm2ranmpnt4 rermo3iydfmDeau i ( s2uo(rpno4lmeelietas)arua(m no0oeeo oeildfm2umnvs;(0 rtomociydom elivi;t teumiopoo1lpt mnctlt) 2rrx ont0oeto feiys m umu o;t4treoir3oodfa  anvo s)trxm(o ou1omeemfeiat) Drr(mpno1aptoif3iys s2ran pn(4texrmf ia1laD aneo;(0 rtr(rpoo4oleelnctas)sDuaurp;t0optoiiciadlmDeluvsn(4tltrif3oodomDeanei ()tetrxr iy4llt  ieia(f Drrxrpou1aexnifciasfaDua( s ()tlenmf oydoaDranvs s)texmio3iydap  lfesat sDtrump;u1oleoifeiysfaDumu p;(4 etomr ta1la rln sl()trxrimpoydoltelfctl(fsruax poo1oetoifciatlmDeanms t4tltnxr iotfpDeanvo;s trxm(rpnudapenlnvsat sDtaxr ;t1olxnmfetatfsDemnmp () ltniocoadla r ivil()teumim3oy1lpe mieias)s2rmum nt0tetnmicilsfm2eauvs;() rxoif3oatopt auei s s2trxopoo1lmtnlfesl()aDua( o;u0opx ifetlslm um(vo;(4trtnxociatom r ueo;()truoxopnu4optnmivils)sDrr(r nu0apxomfetas a2eau s ()altnmr totfp e uvs ( teuoimpiudoptnmiciat)aDtax  no0oltnmieilt sDem(vo;(0trenir3iotoaDeanvo ()sexoim3ou4ame lfvs s)aDumxrp;o4aptn ieiyd s2umu s t)texriociadoaDraivi;t trto(r ny1lm nlfeia(  rurx ont1tet mocildfmDrm( s;u) etnmfcoatlmDe nes;(0seumirpnydale  nei tfa2ur(root1tlxoio3iysls2emums;(0altnxo todfatelieo;( setoir iu4lme  ieiat  Drau pnt4ale iicildlm rmn pnt)aleoxr3tadlmtr i sl(0 eumimpno1om  lietl(fsrrrumont0tlt  oeiys a2ulnvs (0 ltrir3tydfmt au i t0 exoiopiu4oltnmnvi sfsrrrxmp;o0opx  i3iytlsDra( s;u4 rtnxfcoatoa ran i s0texoiopiudlmtnlnvia() rra(m ou0oltomo3iasls2rl( snu)tltrmo ia1lp ran il() etr(o3iy1ll elnctl(f Dumxroot4olt ii3ild a el( p ()aetnxf tadlaD  u ols)sexr(m3nu4olt lictat)arraxrpoo0ale mieiyd a2umuvp t4artrio iotom  ln ilt  exrim iu4olenlnes t)s2taurpnu0aetoiictls s2ul( ont4trxnxr3iydoa r ivi s)srtmxr3no1optnmfvias aDrr(  no1tet moeiadla2um( p;(4 exnmo todomD ln s (0trto(rpiydoltelictas  2tr(mpnu0apeo oeiys sDrmums;t)aetnirciytla eaueil( t2trir iy4llenmfeiasfa2ua(rp;u0tee  o3tyslmDrl(ms;u4trtnxociytoaD  u o t) exrxr3io4opt  neias sDum(m ot0opxn o3iltfa2rmuvo u4alxrmf oy1faDelnes;t0 rxmxo3iudom  mnetlt)srtrum nt1tptnmieiat a umuvs (4alerxo3totlm   i s ( truoxm iu4ll n fetas) 2uax p;t4tpxn octys m el(ms;u4tlxnxo oo1la rlneolt0s2xm(r nu4openmictlsfsrur(mpot4aleo f3ilsfm rlnvo;t0 rtrmr3oodomDe n sls t2uo(opno4al elivt sfs2ta(  ;t1openioeiaslmDrlu onu)arxnmr3ia1oa  au ols)t2um(m3io4lmeemfciat) Duaurooo1oeeo octys aDrlnvo u) renmfctadfp ranvi;t0 2xmirpnudlptnlncslsfarrrxr ou0optoif3tadla2ulnvs u4altrmr3ootlaDeli s t0s2urxrpny1ole  netls) 2urx oou1aptnii3tlsfm2em( snu)alenmrcoo1lp e nei;t teum(o3oudom n fes tfs2trumono0tetnmo3iat m2um(vs (0altrxr to1om e i o;t)sruoxmpiy4omtn fes sfaDrrxront4opxn feiytls2emnmpnt0arermfcoadlatelnes;( tetrio3oydlmenlivsa(  2raxmpou1ole mi3iys a um(ms;t4texrmfciy1fptelueo;s teuoxm oodomeemfet ()arum(m ;t4aeeomo3iydfa eluvp;(4altomr oydopDrluvi;t)sexmxrpou4oltemies s srtr( pnu0tlxnif3tyt a um(mont)areomo tydlaDraivo;( sexrxm oo4apeelfvtasf 2tmxm nt1tle ioeiaslm rmnmont4aexrifctodfpteai o;t0t2toxopiodol emfet s aruax  ;o0texoiociasfs rauvsnu0 etoioctodoaD anesls trtr(rpio4olenmneil(f 2rm(ront0tpx ifetls a2rmnvp;(4texoir3iy1op   ues () etrimpou4ameelfctl()a2tru  oo1apto i3ils a2uaums u0 rerif3oy1fatraivi t)srtoiopoo4lmtemnci s) 2um(r nu0tex  feiydfsDrlnmo (4 lerir3oadoateauvo;t)seuoxm3io4amenlncs s a2tr(mono1tpe  ociad a ua(mo;u) lxniocty1lmteaivol(0 etrxo3no4om n iei s s2ra(mp;o1oetnmf3tlslm2emn s t4 rtnmf iatlmD  ueilt0t2xo(o oudap  lneilt aDuru ooo4tet mfeiasls ul(vs t0tetrmf3ta1fat lu o ( srum(r3iudolee fvtasf rrau  ;u4aexo fetytfmDranvo;u0trxoir iatlm   ivo;( tetoxopoydopt miet t  Drauro;o4oee mieildlsDem( s;u0teeomf tytlp e i ols  2toio iu1lmt mnesat aruauroot0apenmociyd a elu o ()tlxnmf tadomDrlneo;t sexo(o3oodopt lici s)s2tr( onu0opxoiociatfs2ea(vo () exoir3iotlpt liei (0 2xrxm3io1ll   nesls) 2um( p;o4alx ifciyslmDelumsn()trtrxf3oydopD  n o s0 2trxr3nu1lltelnvsat) 2rrxmpou4apeniictat s2ulumsn(0 rxoxr oa1omteauesls)s2tmxo oo4omeelfetl(fs2rm(mp;t4olenmf3tyd aDeanvpnt0texoio iydlp  lu i t) etmir3iudol nmictl()aDtm(mpoo4aetomfeiadlm2rlnvo;(4arermoctytomt anesl(0setm(mpoydlpt livtls s2ta(m ot4oexnmicildls2ul(msn(0texnmf tytlaDrau s;(0seurim ny1lpt mivtlt  Drmxmooo1aptnmfetys s ra( sn(4 eerircoatomD luvi s)tetoir iu1lpt  ncil( aDur(m no1tetomieilt sDua( o;(4 eeoio3oydfp  lneils0 ruo(rpoo4ol n icias sDtm(m oo4olenif3ils sDuanvo;u4tlxoxfcto1lmtr ivils0srumxo3no1llee ncias)sDtm( ono4tlenmi3tlslsDrau p (4alxomrcoo1fp   ivs;t seuriopny4ope lfeilsfs2raxm ;t0tlxo ociaslsDemnvo;u0 eerxf io1fat ln i;t t2xr(o3no1lpee fvsas)arrrx pou0tptomi3iatlm elumpnu4tlenmfciatoa eauvs ( teuoim3oy1lmtemnci t  2ur(m oo1teeo o3tyd mDeauvs;(0arxnxocoa1lm   i i s  2xr(m3nodlptemietlsfaDrm( o;u0alen fciydfs ua(vs t0tetnmo3to1fm  li o s) etoimpiy4olte nesas)a2raxro;u4alenio3tas m eanvsn(4texrircto1lmte u i;t)seurxr nu1ll nlneia()aDuaxmp;o0tetnmiciyd aDrlumon(0 rtrmrcta1opt lueslt) exrim nodalt mfvsa() Dumur nu4oex io3tlsla emump (0 etomo3oytlate u o s srxoimpio4ol  lnvt (faDrrumono1oet mictatla rmuvsnt)altnxf oo1la eaueo (0 2xmiopio1lpe lies t)s2raxronu0tee iocias a elumont) eerio3ia1fmDe n o;t0s2xmxopiu4ameelneia( a2ra(  nu1aex  f3iadfa2eaumo t) exnmfcia1lat au s s0 rto(m no1op n nvs t  2raxr no0tleoiieiasfsDrl( p;t0arenir3iadopt  i ilt)t2tmxopno4olt  fetat)aDrmx  nu4olxnmieils s elnmp u4 lxrxocoydop r uvi;( tetrimpnu1lp  lfviat) rtaum oo0opxomfeiadfm2el(vpnt0areoxr oytlmDelivo;s0 eurxopiu4apenmneta( s2urx ont1tlx ioeiat m2uau s (4tlxnio oytoaD li o;(0t2xmir oo1opeemnetltf rtr(rpoo4tpen iciatfs2ua(vp u) rtrmo3oa1fatrlnvs;s)trtrio ny1omt  nesas)a2rm(  oo0tpt mi3iatfa2um( s;()tetrxf3oatopD  nvi (0 2uoxo3ny4am emnctatf 2rrxmpoo1alx  i3iytfs2uaums;(4arenxo3ootoaDeluvo;s sexo(opiu1ame mneiasf rrrur ot1tlxn iciadls2uauvonu4tlxrmocoodlatrln ols  2tmxm iu1lpeemnei ()srumxr nu1tlen f3iyslm uau p (4tetrircta1fp rlnei (0 eum(m3oy1aptnlicslsf Dta(rpno0apeomiciadfs ul(vp;(0artoxrciodlaDraues ()s2tmxrpoo4lpenlnviat)s2ra( p;o4tpe iietldlaDumn o t4texnir tytlp   uvo;()srurio oy4om nlivt s  rtru  ;u0texomieiyd m2ra( p;t4trenxrcoydfatelneolt)seurxo iu4llenlivsa()artau pno4texo f3ias aDranmo () exrxf iodfp eln s () etoxo3no1om  lncil(fsrtmxroou1alx  feiasfa uanvont) etrxr oatopD  ieo (0 eto(m ny4ll emivs t) rra( pnt4oee mictyt sDumuvp () lxnio3ia1la r ivi;t0t2trir3nu1lle  fvil( srtr(  oo4tpxoioctydfm2rmn o;u0tleomrcootlat lues s) 2umimpiudap nlnvt ()aDumu oot4opt io3tyd a2emnmp u4arenxr3iy1fmt lnvsl(0tetoir iy1ome  ncsl( aDtrumono0teenifeiatfa raumonu)artoio3iotlm rlu o t0s2tm(mpoudll n fci (faruau p;u4optn octadfm rl(vs;u4 rxoxf3oytlm   ieils)t2xrxm3oy4llt mieia( sDumxroot4tetoif3ildfa2uluvp;()tltomr iadom ran olt  rxoiopnu4al  mfvia() 2ua( p;o0tpxo oetysls rlnms;(0arxnxo oytomDeau o ( t2trxr nydomt  ivs t)arrr(  nu4oetnmoctld mDrau p;(4tlenmf3tadlaD lu o s0 rxm(o oodlmeelnei (fsrtaurpou0teen ictadfm2ean s t)artoirciodfat lneilt)trtmxopiodom nmneilt  2um(rp;t0aexoiictadla ea( s;t4trenifctotomD luvsl(0 rxm(opny4olenmnvsl(  rra(mp;u1tlx ioctldls2umuvs t0alenxo iydfmteluesl(  exmxr3oy4ame mivt s)sruaxm ;t1tetoio3iatfm2rmn sn()tltnir3totom rli o t)s2uoimpnodlmeeliciasf rtmu p;t0aexoio3iat m2raumpnt4 reoxfciotfp  aies s s2xm(mpiodal  mfeil() Dua(mp;o0teenif3ils aDuau snt)tlxnxo todoptranes;s)srto(r iydal nmfctas)srurxr no1oet moctad a rmn o u4 lxoxfcoa1fat  ivo s s2xo(m3oy1lmt mnvs sfartm(mpnt1tet miciadfm rmnvonu)alermo3oy1fm  livi ()teto(m3ou4ole mfcils)a2ta(rp;u4tlxomoctat m2rlnmsnu0arxrir3iy1lmD  n o;t0t2xoio3iudom elfvtas)aDumx ooo0tpt mfetatfa2el( p;t4texrmoctadfpDrau il(0texoxm3oydomenmici t)a2tax ont0texo oetatfs rmn o;t0alxoxr3oadlmt  ieo ()t2uo(o iu1lpenlnctatfaDum(rpno4alto fetat a rl(vsnu) leomfcoo1lpDe nvs;s0 etmxr ny4omeelivtls) 2trxm ;o4tpxnmociasfsDulnvsn(4 leoxo iotop   nes t  2xoiopoudale  ici s)aDrax o;t0texn o3ilsls rlu pnu0trtrif oydlaD aivo s0trxmir3ou1amtemnvilt)s2trum ;t4tlen icildfm rmn s;u0artrxr iatlp elnvsl()trur(r3iu4aptnlnes (fs2rrxr ;u0tle mictls a ra(mo;t)aeenmf3ootlmte neslt) 2umxm oy4amen feslsfsDua( pot4alxn fetas sDulu p ()tltoxfcta1oatr uvs;s) 2to(rpno1altelici (fsDtax  ;o0tptnif3iytfs2ul( s;()tlxoio3oo1laD  ieo;(0s2tr(mpnydolte ietl(fs2tau o;o1ope mi3iysfaDra(mo;(4texrmr iodlpDe u s;s) rumxo3iudopee fciasf 2umxrpot4aet iieildfaDuanvp t0tleoircta1lm e nvolt0tetoxmpoydlpeemivtasfsDtrumont0opxn ociltlm ulums;u0arermr3to1latrauvsls) 2tmir3ny1al e ics tfaDuaumpnu4tet moctat mDulnvpn(4aexoxrcoytopDr ivs;() eur(rpoy1optemfctlt) Dta( pou0aetnmi3tytlsDeln s;u) rtnir tytoat lueilt0 2trxr3iu4am nlfctasfa2ururo;t4tpeoioeilsfm2rl(vpn() etrxf3iodfmDeauvi s)trtoio iodalee fcsasfs2rauroot4apx ii3ilt a emn o;u0aleomf todfaDr ivo;s srxoxopnu4ll nmivtl( srtaumooo0aet mocias mDrauvpn(4 ltrxr3todoa   ieo s)teurir3iy1open feilsfsDur( oou4ape ifetlslm rl( pn(4trenxr iatoatrluvo t setmimpny4lp e fcilsfsrtr(r ou0aptnif3iyd m2el( sn()tetoio3oy1fpteln sls0trtr(m iu4lpee fciatfsrtax pno0opto ietasfaDeanvp t4 ltrxrciatfm rluvsl(0trtmim3oy4lm   ics t  Dumxr ;u0alxo f3iat aDulums u4trxomr iy1fpD ln o t sexmxm nydomee fciat arumxmpou4tetnioetyd m2ulumo (0aleoio3oo1fmtelieo s srtoxm3oo1lpte ncsat srururo;u1apxnmo3tyd m2uln o;() exrif3iodlmt lnei ( s2uoimpoy4om e fetas)srtm(  ;u1tptomf3ildfa2ran p;() eeriocoatoa rlu il(0texm(m oydopen netatfarurxmp;u0olt  ieiatla2ra(mpnt4arxomocoydfm rlnvolt)srxrxmpnydoptelfcs t a2uax pnt4aexo fciyd s2umn p;t)aexomo3oodlm ean s;t0 etoxrpiu4lltnlicilt srur(ro;t4oltnioctas aDel(vo u)tetomfcoa1lmt lnvilt0srtrim3ou1lleemfvi (  Dtaum ;t0ape ii3iat m2uln s (4tleomo3ta1fpt aieo;t0texmio3iudome lieil()s2rr(r ou1tlx mo3iydfs emu o u4 renxr3todlp elnvs;s0sexrio nu4altnlnet t  Dtmu pno1alxn ietlt m2ea( snt4artnxf oatopte ivilt srxoirpio1lleemnei ( aDuaumpno1altniicildfaDrauvs ()texomfctytfaD aivol( seumxm3iy4lpeemivta() Drruroou0oex mociyt m2ul( o;u0teeniociodop r i o t)sruo(opno4amee fcs sf Dra(mp;u4tlx mf3tatfaDraumo;t) exrmfcoydoa raues;s0srxmxopoy4lp nmieslt) Dtmxrpoo0opt  o3iadfmDua(ms u0 eenxo3io1lmD lnesls0 eumxm3nydopenlicils)sDtaxmoou1ape mf3tltfm rmnms;t4 ltomf oadfpDelneols sexo(o3nu4opt lfvi s) rtaxmpnt1oexo fetldlsDul(vs;(4alenif3oydomtrlu i t) euoxr nu1am nmies t)sDraumont4olxoifeiydlsDranvp;t0arxrmo3oatfpD lu s;t t2um(r3iu4omeelfetatfs2urumo;t0altnifeild aDul(mp;t)tltoir3oa1lmD  uvolt0seumxo ou1altnmnvta(fsDraxmpnu1alxo oeils m2ra(vpnu)trxrmo ta1lm e ivs t  2to(r3no1lmee ieil(farrau pou0oltomfcilslm umumo;(0 exomo3oatlptrlivo s) 2xoio3nydaptnmies () rumur oo1tpenmfciytls2eaumo;u4tetrxf3tydomtranvs s) exo(m iydlltn fesa(  2tm( poo4olx io3iyt m elnms;u4 etnxr3oatfmD  i ilt0 rto(mpnu1amtnmfetas arrm(  ou0oeenmf3iasfsDuauvonu4arerio iatlmt  neilt0sexoxr iu4llee netat aDurxmo;o0oet mietysfm2eaump () exnxr oatlmDr iei;()trurxo3ny4apenmfcsl( srrau pot4tlt  icilt m rm( s;u4tlxoxo3tadla eaneo;( setr(m nu1altn nvsls  2ur(ro;o0olx ii3iyt sDemn s (4 etrio oydlp eliesl() rur(rpno1alt  fctls aDrrxm nt0apxomoeiysls rlnms;t0arxrmo3oytfpt auei;t)srxoim3ny1apt  ictatf rtrxmoot4altoiieiysfm el( snt)tlxrxfciadfaD auei;s srxr(mpio1ap nmivsat)aDrr(rpot0tee mo3iyslmDrl(ms;t) eenifciytfp eaivil(0seur(r oudllt lnctl(faDtr(  ;o4alt mi3tatlm ul(vs (4tlxnio3iy1omtr ies;s0 rtoxm3oy4lm elncta()aDurx  ;o4oleomf3ilsfm2eanvpnu)artrif tadlatrlivolt seumiopou1omtemics sfarumx o;t4oeto f3iysls ea(mp ()arxoio3tytfmD lueo (  exm(o3oy1am  lfesa(f 2taxmooo0aeto ocias a2rlu p u0tetomrcto1fa rli o;t)t2umim3iu4omte ncs t) Dum( pou0oeeoifetyt m rmuvs (4 lenxrctadoa rai slt  rto(m3ou4al emici sfa2um( onu0tptn o3iasfmDrmuvo u0tltoxr3iatfmtrlneo;()trtmxopno4lm n iesl() ruaurpou0aetomo3iltfs emumo (0aexnxo tydoatr nvol()t2umxrpnudap nlici s  2tr(m oo4oleoioeiasfs2um(mo;u4arxrxo iatlm elneolt0t2xrxr3oy1ape mfes t aDtrur ;o1oltoif3iltfsDraump (4 rtnxrciodfaD au s t  exm(mpiudoltn fvt s) rraur nt0opt miciysfm2ranvo;()texnxo tadfm r i ol(0 eurxopou1lm elfcs (faDrr(m nu1alxnmf3tatfmDua( pn(4teeoxr3oodop rluvi t) rtmxm3ou1lp nliei tfa2ua( pnt0tlx mietyt a2uanmo;(4teerifctodfp  livi t s2xoxmpiodope lnci () 2rr(mp;t4olenifetlslsDel( onu4 exrmf3ty1lpteli o s0t2xoxm iudllenlivias aDraurp;t4tlt mf3taslaDemnvp u) leriocty1lp eaivil(  ruoxr3nu4omenmncils  2rmxmo;t0opxoiictatlmDulu sn(4tlermo3to1fmte u o;s0t2umxo3no1omee ivsls)s2rrur ;t1olxnmoeildla eauvsnu)aetnioctotfpteauei;t  rtrxo3nydllte fei t) 2raumoot0oetnif3tltlm2rm(mp u0 exrmf oadlm elnvsls0tetrxm3nu1amtemivil()s2ur( o;u1altnmociydla ulu onu4arenir3tydfa rln o;() etoxopnu1ape  fvias)s2umu o;o4alt moeilsfs ra( o t) reoif iatfm  luvi t)s2to(opoo4ape mnvias s2ta( oou4oltomfetysls2rm(ms (0aetrmfcta1lp raieo;( t2xrio iydlp  lncsat)sDrrurooo0tlxoii3iatfa um(vo;u0aexrxoctotomt  ies;s0 2tmxm3nu4am elivi t)srrmxm no4tpe ii3iltfa2eanmp () rtnif tatomt aivolt s2umxo iydam nmnvta()srrr(rpot0aee moeiasfs2rln sn()alxrmo ty1optr n sls  2xoxo3oydop nmfvtat)a2rrxront0texomieiat m ea( ont)trtrxo3io1oaD li o ()texmxopou1al e ieilt  Drru pnt4opto o3ias a2rmnmp u0arxoifctydlm   ueslt)setrxr3iu4lpenlncsl()s2um(  ot0optnioctltfm2umnmo t)texoir3oy1oa  livo () rxmir3no4oleemnes ( arur(ro;o4olxnioctatlm2rlumo t4altrxfcoo1faDeauesls) exo(opnydol  livtlsf Dur(ro;u0aetnioeiad a2elnmo (0 exnxr3iodomDeai s;t) exrxm oy1om  mnvs s aDrmxmonu0tpt  f3iys m rl( o u0alxoir3tadlmDr nvols) exm(m oy1ll nmfeia() 2umu  ;u4tltomfetatla um( o;u)alxnmo oy1lp  livi;s trto(r3iu4optn ieta(faDrmxmoou1oee  ictlt s rluvp;t4trxomr3ta1latrlneil()trumxr iu1ape  feia(f 2rrum nt1tlx  iciltfa em(vsnt)arenxf3oydlm eln sl() 2xoiopiudomenlieiat  rtr(  nt0alxniiciadla2ul( s;t) exnif3tytlm r nvils)srtoimpoudapen fvt sfsrumum nt4tpe moeiatls2rmuvp t0arxnifcoy1om e ivi;s setmirpoo1op nmfet t)srta(  nt0aexomo3tytlm umnvo t) lenir oytfm  lnes (0 rtrir3iydaptnlfvs s) ruaum no4opxo ociaslmDem(mpn()tetoir ootoa r uvo;t trumxm3ny4omen iesl(f Dum(  ;u0aeeo f3tltlm umump;u4artoxr3iy1oate n sl( s2trxm ou4llt  nvilt srumxr ;u4tlen iciyd m uanvp (0arermr tydfptraneil()t2umxr oydll  lfeia() Duaxmoot4apxoio3tytfs2ua(mpnt0 lxoiocoydfp elnvil(  eurim oydom nlnvtas artrum ;o1opt  fetldlm raumon() rerxr oa1fptrauvols)texmxm3oy4opt mnvsat  2raurono0olen feild s2rm(vs u4trtrxo3io1oatr ivo;s  euoxm iy1ol  mnvsltfsDraurpnu0apx mfeiysfs2el( sn(4 rtnifciodfp eli ils)teum(rpiu1lpeelncsls)artr(ro;o1oeeomi3iys mDeln sn() rtoxrctatoat au ilt  2toim3nu4lmtelfcil()srrrx pot1oexoifetltfm2rl( o ()teeomf3to1fmDe nei s) rtrirpiy4omtn fcsatf 2raxro;o0ape moctlsfa ean o t4 lxoio3oa1latelues (  rtoxm nudapen fvsatf 2tmum ot0oetniieiadlm2rln s;t4 lxnxr3iadfpt  n o ( teuo(o ou4ap n fcil() Dua( onu4aetoifetydla rm(mp u0 reoif tatlp e nes t  2uo(rpno1alt  iviat)artrxmont0opeoif3tat a ean p u4tleoxo3iatlpDraieilt t2xo(opiodam elicil(f rtru ont0oexo f3iydlm2rlnmon(0tltoxocta1faD  neolt)s2ur(m3iu4oltnlnctatf 2umxrpno0tltoio3tltfa2um(mpnt)arxrio oadfp elu ils0s2toxmpnydal elicias  Drr(m no1altnifciyt s2rm( on(4 lxrircia1opDeluvo;s s2xrxm3nodoleemnvt s)artmurpot4altn feiysla eanmsnu0texnxr oodlaD  ivil(0seurir3no1lleemnvtls arra(  nu0opt ioetydls2um( o;t4alxrxfcty1fmD  ivslt)s2xoimpou4om nlnctl(f 2uaurpnt4opeoioeiasfa emums u4treriocoytomD  nvslt)sruoxr3io4omtemics (fsrtrurp;u0tpt ifctad sDrmumpnu0tlenifciadfpD  uvs s0 rtrio iudalenmnet () 2ua(rooo4tlen f3iys sDul(vsnt4arerio oodomt aneo;(0 2uoxrpiy1lltelfci s sDuaumpnu1alx  o3ils s2umnvp;() ltoxociodlmDeluei s srurio oodllte ncilt  Dtaum ;u0tptoifetls a2ul(mpnt0tlxnxr3oytfp elneils)srum(o oy4amtemfcs sfsrurxr no4texn i3ias sDrmu s u)teenif3oodla eau ols0t2xoiopiu4ap  liei s)aDtm( o;o0tpenmf3tyt s2umu o;()trtnxr iytopt lnvi;(0 rxrxm oudap   fvta() 2urxrp;o1texn ictad s eanvo;u) exrxo to1oa e i s;t) etm(o oy4lpte icslt) 2ururpnu0oexoiociydfs2emn o;u0tetrmo3iytlpDelneo s trxmim nydlpt miesl()srua( pnt4tleoii3iytlsDel(vp;t0 etnxo3iatfaDrluei;t teto(m no1olt mivi ()sDrm(rpnt1ape  iciydlmDrmnvpn(0tltoxr oatom elues s)s2tr(rpoodamtnlivt s) 2tru ono1apxnioeils s2eaumpnu)teeoxfctydom   ivs t)srurim nu4ll nmfcsa(f Dtmxrp;u1alt if3ild s rau p;u0tlxnio iytfa e n o s)texmxr nydape licias artaxr nu0altomo3tyd a2umnvon(0aetrxf ty1fpt ai ilt) exm(m3iudlp e iet (f Dtmxmpnu0altomfeiltfmDrlu p;(0aleomo3ia1op e uvi;s0s2xoim no4lp nmicsat) 2rmu  oo0ole mfctyt a umuvp u4tleoxrctatlmD auvsls) etoxo iudoleemncs ( aDtau onu4aleoifciaslm2emuvont)treomrciy1optrlueols srxmirpiu1lpen ics sfaDrmumo;o0tlt ifeiad mDea(ms u)alxnxoctytfp  li s;t0t2trir oudom nlivt sf 2urxm nu4ale  oetyd a uln o (0aetnmr iatlmDr uei t) rxrxm3oodlpenliesl()sDra(ront4oeeoiocilsla emums;u4 lxrmr3iotop eau ol(0s2xr(m oydaleemnvtl(  2rr(ronu1ape  octls aDuan p ()teeoif ia1latrlnvi ( texr(mpou1amen ivsas)s2trx ont4olxoiictld a2um(vp;()tetoxfciodfa e i s (0trtr(m iu4altelictas)a2uau  ot4aetnmicilsfmDem( pn(0tlxoxociy1faD an s;(0s2toxm3oodlp  micia(f Dtruronu0tlenmoetadfm2rmn pn(0 eermo iatfpte nei (  eum(r ny4llee nci sfarrmu o;o1olt  oeilsfsDrmnvs (0 lenir oadfptrluvs;s) rxoxopiu4ap  livs t) rua(r ot1aetomietldla2uauvp;t0trtrxo3iatfmteauvo;s0trtr(o3iu1al  livs (fsDuru ont1apeo octaslm rauvo u4 lxoxo ta1oa r nvi;t t2xoxrpoo1amtn nctas)a2uax  nu0altomo3tadfa um( s;(0altrxfciatfm  ai s (0 2uoxrpoo4ole  nesatfs2raum nu0ole moeiltfaDum(vs u4tleomo tadoatr u i t0trto(mpiy4op elnvsls)a2uru o;u0tlxomo3iad mDraumo;(0artnmr3oodop r nvs () 2um(m3nodapeelnctl(f rurumonu1alx mictadfm umnmp (0 lerxr oy1fmtraieol(  euoxopiu1ome  nes t  rra( oot0aexoioeiadla2emnvs t0tltomf tatfat aivs t0s2urirpnu1lmtemfvsa(fs2taump;o4tlxn oetatfaDuauvo u)treoircio1latrluvi t0 2xmxm oo1opeelictls s2rmxmpno1aet iieildls rlnvo;t0 etrxf3iy1fmD li sls  2xoio3io4llenmfeils  rtm(r ;t1tex  ociltfaDrlnvpn(0alermo oatfmt  nvi;t srtrxo3ou4ame mnvi (faDurum oo0tpxoif3iatfm2ranvonu0 eenmrcoodlatrlivslt)texoxopoo4lmt mfet ( sDra(r ot4ope ifetyt m2ulnmsn()alxnxrctodfpteliesls teuo(r3no4lmenmncsa(fs2ua(r oo1alto f3iytfa ra(mp u0 rtoircoodomtrlneils0 exmim3ny4ole lfet s  2ua( ono0olxnmf3iytfsDum(mp t4alenif3oo1lp  luvol(0sexmimpoy4ol elfcta( s2rru  oo1aleo feiytfa rm(mpnt4trxrxfcoatopDelues;s) 2um(o iydolt mfet sfa2rmump;o4apxn iciysla2emnmpnu0tlxnmf oo1fm rluesls t2to(o3ou1lm nmivta( aDrau pno4aptnmiciys sDuau sn(0alerifctadop ran s;() rtrxopoodaltn ict sf rtru p;o4alxn fciysfsDul(vp;t0trxrxocoo1fat lneo;t teuoirpoy4omt  iciat)sDtaumooo4opt mfetydlm2rauvont4treoxoctydfpt lueol(  rtoio ny4oleelfei s s2raxmpoo0altoifcias sDul(vo u4trtoir3iotlmt aneo ()truo(m3ny1omen fci tf Dta(mpnt4ale mocildlmDea( onu) rerifctotlat anvo;t) rurio3nudlle mnvs t srtmumoou0texniieildfs2rl(vpn() reoxocoodoateau s ( tetrirpiudlle  ivtlt)arum(  ;u0alx iietysls2rm(ms (0 rxoio3ootlptelivo;( teurxmpou4lpenmnvslt)s2urump;o0aexn ictld mDumnmsnu0 ltoxr iatlptr uei ()trumim iodaptnmfeia() Dumu  ou0tlxnifetytfa2eln p;u0 lxrxfciadlatrauvs s  2umxopnydol e fvtltfsrrmxm no1aeeomictytls2um(vsnu0aetoir3oodlm r ivo t0 2um(mpoy1aptelfci s sDtmurpoo0aleomocias m uauvo;t4arxnxr iadfa ran i;(  2umxm ny4aptnmivs tf Durxm oo1oexoioetltla2ranvo;t4 exnif3iodopte iei s0teurxo3no4lltn fcsatf Dtrumpoo0aeeomo3tatlsDrl( p;t4trtrxr oadlp rlu i;s)t2xrio3oy4olenlnctl( artrx pnt4olx  feiyt m2eanvo;(0 rxoxfctotlptrauvol(0t2urxmpiudom   iciat  ruaumpoo0teeo oeiydfm2ean s;(4 reomf3oydlpt  ivils)trurir io4omenmnct t)s2uaxro;t0tet  feiytla eau o (4 lerifciydlp e i i;t)trurim3oo4op  mivilt)sDtm( oou4apxniicildfs ul(vo ()aleoio3oodoaDeauvo t0s2ur(r iy1alt lnvi ( sDtr(monu1oexn i3tlt s2umn pn(0tltoxfcta1omtr uvol( teto(r ny4al nmictasfsrurx o;u4alxn ietyt mDra(vont0trtoxr3oadla e n s;s  rumxo iydol nlietat srrmxmo;t0tpt mi3tadlm ra(vo (4 etoxociytom e uvo (0 rurxo3iu1oleemivt tfsDrm(mo;t0tpxniociytfs2eau o;t) reoxoctotlaD luvil(0srxm(opnydlpee neia(fsDuau  nu0oleoii3tlslmDrlnmo;(0 lenir iydlm  ai o;s0 2tr(opnu1llteliciltf 2tauro;o4olenmi3tydla ua(vpnt) etoxo3iatoptr ies s srtmxo iodapte ncils  Durumpno0tlenifctltla emums u0aexnirciydfa rln s ()sexoir3ny4omee neiasfsrrmum nt0tptomoetadlm rlnvs;t0tetrmf3to1oatelnes;(0 2xm(m ou1aptnlfvilt)a2tr( pot4tptnifetasfm rluvp t)tlxomf3oa1lptraivi;t  2toirpoodol e fesa()aDra(r ou0alen ieiydfm2rm(vp;t4 ltnxr3to1fmDe ieo t)setm(o3oo1am nmivsas)arur(r nt1tptn ociytfm umums t0trtnxr iatfmte nvi;(0 etriopnodapen icils s2uaxrp;u1olto feiydlaDul(vo;t0tlxomfctatopt lu sls0 ruoimpnodop  mneias)srurxmpnu0opx mociysfs em(mon(0aetnmr3oodoa   i s t0 rxr(rpnydol nmiesl(f rrau ont1olen oetytfaDuanvs;u)artrxo iadop e ieo;( t2xrir3nodlme liesls)sDta(m nt4tlt  octldfa em(vp u0tlxrmo iotlpDe ies;t)truoio3nudap n fesat  2trxrpot1olenio3ilslsDul(ms u)trxnir3to1om r n o;t)trur(o iydapt mneil()s2umxr ;u0oetomiciad mDelumonu4 ltomr3ty1fm   u i s t2toim nu1am emieiasfaDtaxr nu0tltomoetytfs rmums t) lerir to1fatean i s setrxm3iu4optnlnci ( a2rmumoot0aexoifciysls uauvp;t0alxoirciadfm e u s;(  2trxo oy1omt lnvil( s2tru p;o0tle iieias mDra(vp;t4aexnio3oytfaD lnesls)trumio nydlpeemnctat)sDrr(r nt4apxn icilsfs ranvo;(0altriociydlptr i ils) 2xmxopiy4ap n fvsl(f Drmur nt0aetniocilsla2ul(msn(4altnif iadfatrlnvi ( s2tr(o oy1ap nlnesasfa2taxm ;o0aeenmoeiatlm2elnmo;() rerxo oytop eli i;s0 2toim3iy4optelfvtlt a2um(m ;o4ope  fciys s2rluvp;u0artnxf3oytfpt  neo s0 etoir iodlptnlfet t  2uax o;t0ope iiciat s2uau s;t0 lenio3iotlpt an s;s0s2toxmpoo4alenlfvils s2tr(rpnt1tpto fctydls ulump;(0 rxoifctotlmD liei;t trxoxo3oy4opt mivta(fs2umumpnu0tptnmo3iytfa emn pnt0artoxr oy1fmDe ieslt)texm(o3no1llenmicsl()srtm(ro;u1tpt ioctltfs2em( s;u0artomrcty1lmtrauvo () 2umxmpiu4lptnlfetlsfaDra(moot0alx mo3ilt s2el(mo (4arxrxf totfpDrlivols) 2uo(o3io1olteliciltfsDtr(mpoo4olt moeilslm ul(vs (0alxoifcio1fp ean sl(0srxrir3ou1ome  iet ( aDra( p;t0aeeo fciad sDumumpnu0alermf iadlmtean i;t0s2xoxopiydll nmnvs tf Drmx pnu1alxo i3iysfm elnmo;(4 leomo io1opt auvs;t)s2umio3oy1amtn fesltfs2ua(mo;t0tpxn f3tyt sDrmnmp t0tlxnir totlaD  ueols)s2tm(r3iu1omteliei (fsrtrur ou1texnmf3iyslm2rau on(0 lxomr3iatoatrli s t0trtmio3ny1amtnmnes sfsrrm(rpno1tee mo3ildfm ea(vpnu0trxoxr3ootop   ivs;t srtr(m oydlptnmfcsls a2umxmooo4tleniictlslsDean pnt) lxnxr3oy1omD  n o (0sruoio no1omtemfci (f rtmumpnu1olen icils a rau o;t)alxrxf3oy1fat ai o (0 rxmxr3iydll e fctl()sDraumpnt1ope  octat a2ulump (4 etrifcoodlpD  nes ()s2uoxo oydal  liesl()srtru  ou1olx moetlt s uanms u4tltnmo3oy1oaD ln s;(0s2to(o oy1omtn nvs s)arrax pot0oetnifctyt aDemu s;u0aeermf3iydfpDr u ils0sruo(o3io1altnlivs ()aDum(ronu0opxoifctat a ulumsnu0aeenifcoytomDrln slt)t2to(o3ny4amtn ivil() rrm(mo;o1tpxoiociytlaDum( s;u0arxnif3iytomDrluvs;s0 eurxm nu4op e nesl(  2ra(rono4olx  iciad mDumn o;t0altrir tatfpDelieo (  rurir3iy1ale  fcsasfs2rmu  oo4olxomictydfa emu s t4aetoif3iy1lpD lu olt)srtoxm nudlm  mneilt a2tr(rp;u0teeoifcildfm rlu p;(0artnmrcoy1fmD  nvs;t t2xm(rpno4ameemnetl()s2tax  nu4aeeniictlt aDul( s u4tlxnmo3iotop  aues;t s2toxr3oy4al   fei ( a2ta(mont0ope io3ilt s eauvo;u0 lxnmr3ia1faD anvi (0s2tmxo iy4omenmicil(  rtru  ;t4optnmieiydla2el( o u) lxnmo tydlp e n i;t0setr(m ou1lp nmfeta()srrax  ot4aeto feilsfaDrl( onu0alxrmr oytlat au i s0t2xoir3ou4am   netat)aDtmxr ot0tptniocias s ua( s (0tltnxo iy1fa rauvi;s  rxoxo ou1lle  ivt (f rtr(m ;u1apxnmociydfsDel( onu4treoif3iodfp r ues;s  ruo(rpnu1altnmivil()a2urxrp;o0apx iietldlaDum(vo (4altomo iodlptelivs;(  exm(mpoodom  lncsat) rtmum ou1tlenmfciytfa2em(vo;(0tetnir3totoa rlueo;()t2toio3oo4lmt livt s  Drmxr ;o4tlt mf3ilsfsDrln pn(4trermfcoodomDran slt0setmxrpiudlmtnlnci (  rurxr ;o4tpxomf3tyd s2ul(vp;(4teenxf tadfmD  i s s) exoim oy1lptnlfctas  rtmumpot1altn o3iatfm rau o;t0trtrxf3oadlmDe ieo t0 eum(o3oodolenlneiatfsrtmxronu4tptoii3iysfaDulnmon(4tlxnxr3ta1lp rli slt0t2tmim3no4ap e icslt)sDtmx  nt4tlxomoetydfa uaump;(0 eenio oatfmteaiei;s)setr(rpoy4lmenlfes ()aDua( o;o1aetoio3iasfs2el( on()arxoifcia1fa  luei t0srtm(o3oy4lm  mfet sf 2rrx o;t0tptomo3ildfm2rlnvsnt0trtrxfciydoaDrlueo (0s2xrxopny4aptemneilt  Dua(rpno1olxo i3iadfs2emumo () rtnmocoytla r nvil(  rum(opio4al emnetl( s2rrxmpnt1olenifeildfmDea(monu0 rerxfcoy1lpDe neo s  rtoir iodlm e nvtas srtrumoot4apxnmfciatfsDulump u0trtnifcoydlpDelieo;s  exmxopiu4aptnmfei () 2rrx p;o0tleoifctld s umumsnu0aetrmr3todopDeau i;t trxm(r3io4ape  icsl( sDrr(  ;o4aexo fctaslm2ul(vs (4trtnxrcoa1lm rau ols) rto(o3ou1ol   fvi sfarua(moou4tle mieiadls umuvpnt4tleomf to1op  lu o s tetoxrpiu4lm  mfctatf 2tr(rooo4aptnifciydfsDul(vsn(0altriocty1omDeauei;t0 rumxmpoydap  lnesat  Dtaur ;o4tltnmoetyslmDul(vs;
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt)t2toxm iodlptnmivi tfsrta(rpnt0tet mi3iyt sDum(mp;(4 etrxr3iatlpDrli s;t)srxoxmpoydlp nlnvi ()artr( ooo0open ocias a2emn pn(4 lxrxr3oydoatraues;(0 2tmxrpny4am n fctl(faDta(roou4tlxnii3tyd a ua(vo t)areomf3tatoa  aiei;(0trxo(m oy1am e fei s  2rmxr ou1aet mfeiydlaDul(ms;t) rtrir ty1lateaneo (  etoxopiy1om e nes tfarur(rpnt0opxniocilt m2umu p u)trtoxfctatoateaivi;t0seuo(mpnu1op  mfes t  2umumooo4opxnmoeilslm ra(mp;t4 eeoxf3totlptrli o;s0t2xoir nudapeemictas  2rrurooo1oetnmieiytfa rm(ms;u4aetnmrciy1fp e neo;t t2uoim iu4lp elnvtls)srra(  ou1open o3ild a ranvs;t0alxrmo tadoa eaues (0 2xoxo3nudoptemnvt t)arua( ono1opxo ieiytlm rmump;()tetrxo3ty1lmDeauei t)s2uoir3io1ll emncs sf 2ur(mpot0aeenmo3iyd sDumn on(0treomr3oytlatelnei t) 2tmxo iu1opee fct (fsrumumo;t4aetomi3iad mDrluvont0trtnifcoydopte nvol()seuo(r3no1ale livi sfsrurumooo4tetoioctlslaDum(mo;t0alenxo3iy1lpt liei t0 rtm(m3nydlmen fvtlsfarrmxmont4aptn f3iydlmDeaumo;t4 etnio3tatfpt  i ilt t2xr(m nu1op   ictltfaDur(mono4tle  f3tatls um(mo;t4 lermf oo1fat  ueo s0srto(o3oo4lpee fvs () rtm(m oo1oetnifeiydls2uaums u0trenir iytlp   u olt) exrxm nu4lm e fei (f rrmxmp;o1aee mfeiat s2rmnmp;t0tlxoxocta1fm eanvo;s s2xmxm3nu4lptnlneta(fartmu pot0tex  ieiyslm2emuvsnu0 rxnxrctydfmtelnes;s0tetrio io4llte ivt (farraxr nu4aptnioetytlaDem(vp;u4 ltnxoctodomD ln o t seum(m3oo1ol elict t)srtrxmoot1tlxn o3tltfsDelnmp;(0 rxnxfcoatlateanei;s0seuo(r3oo4olt  nvsl(fsDtrurono1tlto ietytls rlu pn() exniocoytlpteanvi s)s2tmimpnudlm  mfesl( srua(mono1tleo ieiatfaDumn p;()tetnxr tatom rau i t0s2urir oy1llee ivsl()artr( pno0apto o3iltfm2rluvp u0 ltoxf iydfa e u o;s t2tmxr nu1amtn ncsatfs2ra(  ;u0apeoifeilsla2eln pnt0areomfcoytopte uvi;s)tetrxr3iy1llte fctltfa2rmu  nt1tetomf3iytfsDeaums;u)aeeomrcio1fatelueo;t0srum(m iudap n ieiatfarurxm nu0tlx mieilsfmDemnvsn() rtnmr3iotlpte n o s) 2xoimpoydllee ieslt s2ua(r ;o0texnmi3iyslaDrmumsnt4 etoxociydoa raivo;( s2toirpiy4lm   fcils srrax poo1oet  oetldfa el(vpn()alxrxo io1fa   ieols setrxm3nu1amtemictas) 2tmxmo;o0oltnmiciad aDum(mo;u0tlxrmr oydoate ieo ( s2tmio iydole lnviatfaDrrxm ;t0apeoii3ild m rmuvp;(0trxnxrcoy1lp  luvsls) rtm(m3oydoltnlfct ( aDrr(moot4alxn o3iyt m2emnvs;(4 reoio3iatfp  an s;s0t2umirpoy1ol eliesatfs2tax  ot1oeeoiociys m raums;(0trtrxo3ta1lp ran s s0t2toio io4lme  nvi (fs2uru ont0olx mfctadfa umuvsn(0trermo iatlatrlies (  2uoimpnudomtn iet (fsDumxmonu1ale ioeildlsDuluvpn(0tlerxrcio1la   ivs;s  rtmimpiydlmt  nciltf rrmur oo0oetnmfeiysfa ulu ont)tltnmo to1om raueo s)s2xoxrpio1op   nci sfsDrau ono4texn fctys s2el( p;u0 ltoircty1oa   uvils)t2tmiopou4om  lncsl(  rta(m no4aptoif3iyd sDrl(ms;()altnmfciadfm rluvolt seurxmpiu1aptnlicilt  Dra(m ot0olxnmo3iysfm2rmnms () ltoxf3iydfpDrluvs s0trxmxr ny4llee netat sDurx poo4ole mfciltfm2ea(mon()aetrmf iy1fpD ai i;t0 rxrxo3iodolen ivi sf rtmxro;u0tpe  fetadls2rmnmon(0 rxomfcootfmDeli sls trtoxopiy1omtn ieslt) 2urx  ou1ale mfeildfsDelnmsnt0teeoir tytom  au o;s0tetmxr3nu1amtelieil(  Dumur ;t1tpt  feiatls ea(vo;(4trtnio3tatlp   neil(0sexm(mpoo1lp   ivi s)aDtaxmoou1alx  o3tas sDrm(ms u4 eermrcta1fm e i ilt t2trim3iy4ap e nvslt)s2urur ;t1tet  fetyd s rau ont)aeeomr oydoaDrlnes s0srtmir iu1lmtnlicsas) rtaxr ;u4apx ioctldlaDumu s ()artoircoa1omt luvo;t)srtmxm3iydom nlicsatf 2tm(rpnu0tptomfeiatfa rmnvsn(4 leomfctotfpt  u o;s setm(mpny1lme miei (fs2tru p;o0apxniietlslaDrmu o u0 etnxf3tydomD luvo t)teum(rpiy4altnlnvsa( sDtrx  ;t0optomoeias aDelumo;u4aexoxf3oadop raivs t0 2tmxo3iu1ol elieiatfs2ua(m ;u4texomo3ils sDrluvo u4aetrxo3io1opD lieo t0seumir3nydolen icil(faDuru  oo1oleo iciyslm uanms;t4alxnxo tytfa r nvs t0teumir3iodap  lfcs s s2uaxm ;t4aexoii3tyslm rln p;t) lxnmr iadla e neslt)tetr(o oydomtemivslt)arurxmpoo4aeeoii3tadfa2ea(vo t4tetoxo iydopt aies;s0trxm(rpiu4lpe  nviat)aDtrxmpno1tptomfeiysls2uluvs;t0tltrio3oydlmD lnes;s0trxo(o ny1ol  mnci t  Drr(r nu0tex moeiys aDrmnvpnu)alxoxr3oatlp  luvi;t trumim iy4lmtnmnvi t)a2ta(mpnu4aet  o3ils m rmuvs;u) exnmoctotlpDr nvs t)t2umio3oy4lptnlfcsls) 2tmu  nu0opt  feildlm2elnvs u0altoif3to1fp eau o t0 exrxmpiu1op n ivsl() Dtax  ;t0tlxnifetlt sDuauvp;t4 lxrir3ta1fatean i;( setrio ou4lptelncslsfaDurxmonu4oeen octydla2ul( o t0 leoxocoo1omteanes;() 2ur(o nu1am   icslsf rua( pot1tle ii3ilslsDeln s;t0tleomr3iadfa rli sl()s2toxo nydam  mictlt)aDtm(mpot4apeo o3iys a ra(mo t0 renxrcoatopDrlivo t texoxrpoy1apeelfcsl(f Dta(  ;o4tpe mo3ildfmDrm(ms (0 ltnif3tydlateaivi;t trtoio iudomtelnct tf Durx oot1aexnmoctad s eanmon()aeeniocty1oatr ieo;(0 rtrxr nudlme  neia(fsDum(ro;t0aptomictatfs emnmpnu4aetrmr3iy1fpDeau s;(  2uo(rpno4amee ictat) 2urumpnu0tlx  iciyd m elu o;t0tlenif iytlat  nesls texr(rpiydameemfciasf 2rr(rpnu1oltomi3tydls rln s;(4 ltnmf io1lm rai o t0srumir3oydoltnlfvtlt)srumxmooo1optniictltls2ra(vsn(0 leoir oy1lpD lu o s)srxriopoo4ll emivt tfsruau oot1alen fetatfsDulums (0tetomo3oytfat aieols) 2toxm ny4ol nlfesl(  2taurpou0tpe mfeiat s ua(vpn(4tleoiocto1fpt anvs s)seumim3iu1olen fct s sDtru  no4tlx  ietad sDrmnvsnt0aexrmr ta1om eanes;( t2uoxr3oy4lmenmnvilsfaruaxrp;t1opxomf3iadfm rlu s;(4artnif iy1lp r uvs;t0s2to(r3iu4altnlnesatfs2uaurpou1aet iicilsfaDelumon(0arxnif ta1fm e ies
\ No newline at end of file
@@ -0,0 +1 @@
+u ils) rtrxr3oodlleelfvsas) rrrumono1opxnmf3tad s el(mp;t4aleoifciydomtrlieslt0t2uo(rpio1amt lnciat)sDur( poo0tlxo i3iydfmDea(vs (0trxnmf3totoa  ai o ()trtoim3ou4oltnlfcil(faDrm(mooo0aptomiciydls el( p t) rtoxrctydfptelieol()srxmiopiudape livt ()arrm(r no4oexo oeiytla rlnvs t)tlermr iatopDeauei;s0 etrxr3nu1oltemietl(  rtm(r oo1tpx ii3iyd m2elu o;(4 rerxo3iotoaDe iesls0 rurxopoodap n ictas a2umuroou0teeomoeiadla em(vp;(0tleomf3ia1fm elnes t t2xriopoodamtelnetl() Drmxr ;u1open ietasfsDea(mo t0aetrmf ta1fateln s;t0srtr(o3oy4lle lfviat aruaxr ;t1aetomo3tlslm2rln pnu0alxoio3totfaD lneols t2trio3iu4lp   fcs t)s2trur no0tpx  ociydlm2uaump t)texrio3iytopteluvs;s0t2ur(mpoydol  mnctltfsDtrur ;o0aex ioeiasfmDemnms u0texoxrcio1op  anvil(0 exoiopiydlpenmfcs ( srtax  ;u4oexo octldfmDemu s u0 reoif io1fmtrauvils)trxoxm nodam   nesl( arra(rpoo4oexomfciasfsDrmn s t)arenxf iydoa r u ilt)t2xoir ny1op  lnciat sDurx  nt0tlxniiciasls rmumont)altnxo3tydop e n ol( t2toio oy4olenmnei ()arrauront0alt  fciytfsDul(vp u0trermf oydoatr nvs (0 2toim oydlm nmieil() 2rr(r oo1oltoiieias s2rln p;u)trtrxoctytlp raneo ()t2xrio3ny1lmtnmfeta()s2uaxmpou1tle moctad aDum(mo;t0altoxo todfmD aies s  2toio3ou4opee neils)aDtr(mpno4olt  oeiltlsDua( s;u4aetoio3to1om elu i t0 etm(opoydamen fvsl(fsDur(m ;t0tetn oeilsfa2uan p u4teenmf tytfatr uvi s)trtrxm3oudlm   ieil( srta(m ;u1ale  iciat mDra( s t0arxomr3totlpD auvil(0 2xmxmpno4lm emfvtasfaDur(root1aeenmieiadfa el( s u0 ltnif iotlmD aueo;t)s2xmir3no4ame lici s) rumuroot1aptn feiytfs ua(vp;u)trxrxociadfatrlnvilt0t2uoxopiu1lptemnet sfsrtm(mp;u4aleomfetadfm rmn s u0aexoxo to1om e ueils texm(rpoo4omtelfct tf rtr(mpnu0alenifctld s2rauvsnt) lxoifcoodomteanvi (0truoim no4ll nmfct tfsDurum ;o1altoio3iltlsDrmumpn(0trerxr todoptrlu s;( s2xm(o io4lme mfeslsfartau pno0tpeoiieiysfm2ra(msnt4aetomo3io1fatelueo;( s2urxopny4lmen ieiltfsDrax pot4oeenmociydla el(mo u4 exrxociodlpteluvs s0setmim3oodlpee nesls aruax ooo1oltoioetls mDrm(mo u4tltoio io1lmDe ies t  exm(m nydomtemnct t)sDtmxr nu4tetoiieiysfaDrauvont0trerif tadfaDeaiei t0 rxm(mpny4ome  ivil(f rua(mono1tlx mi3ild a eluvpn()aexnxf3tadomtr nes t) etmio iy4ape mictat)a2tau  ;t1oex iociydfa ua( p;u)trxnmf3totlmtraieils  rtrio3no1lmt lfet ( aDururooo0tee  ietyt sDelumo;u0tltnmf3oodfat auvolt srxrio3oy4omte ivsl(f Drrxm no4oee ioetld a umnvpn()trtoxociodoat  nei ()texr(opoo4op elfvtlsfsrumu p;t0alenmi3ilt s eanvon(4 lenxr3oatfmteln o;t trum(r3nydape mnet tfs2ur( pnu0apx  ociltlm2rmnmonu)arxrmr3iodlpDeaueo;()s2trxmpoo1openmfvtlsfa2rrxrp;o0ole  feiydla ul(mon(0artrio3oytop ran i t) ruoirpno1omt  icslt a2urumoot0tpxnifciydfs elnmp;(0 renmo3tydomtr i slt0trto(rpiu1ale  neta() 2raxmonu1tpen oeiytla2el( s t4 eeoircta1fmDeau o s  2tmxr io1alt mfcsl(f rra(mpnt0alt mf3tlsls rmumpn(0aeeomocoy1laDran o s)truoxm3oy1lm   ictlsfsDua( pnt4tlx  ietyd sDrl(vsnt4arxomf3io1fmtrlueo;t  eto(m io1omen iesasfsDumxro;o1oleniocils s2emnms ()texoxrctatopt anvsl()teum(opou4om elfeiltf Dumx ont0aleniociysfs2ra(vs;u4trxnmfcoy1omDeaues;s0 etr(m oo4opt licilt) Draur nu4tpxn feiydla2uan o (4tltomr3todlpD anvilt truo(rpno1aptnlncil( srrrxronu1aex mo3iyd s2uauvo u4trtrio ty1lp eauvil(0setrim nudaleemnei ( srrr(moou1aexnif3ils s rmumpn(0aleoxocta1fmtr i ols trumxr ou4apte ics t)s2urxrooo0tex iictldfm umu p;(4trtnmfcoatlm rauvo;( teuoxm3oy1ll  lfei ( arumu o;o0opx  i3iysla rluvpn(4 eeoircoytlateai o t0 2to(o nodlmtnmicia()s2tmu o;u0alx mf3tysfmDrlu p;u0tltoxr3oytfmtranvol(  2tr(o nodllenmnct sf Dtrx p;u0tet mfetys sDrmnms u)arenmr oy1op   nei;t0srtr(o3nu1al emictatfa2rr( p;u0oee mietys mDrmn o;(0tltrxrctotlpDrln s;t0 2xoio3iy1lp nmnetasfa2rr(mpnt4oex mf3iltlm eanmon(4 rxnifctatopDean s;()seto(opiu1apt  fvils  2umumono4texo ietytfaDemu s t)trxnmo oy1lmtrlivs s0 exmxr io4lptn nvil()srum(mpnt1olxomf3tytlaDumu snt4tlxoir io1opt aivi;(  rxm(o nodll  mnciatfarum(m oo4apx mi3iysfs2umu pn(4trxrxf tadopDrau o t0srtoxr3oo1ol nliciltfsDuaum ;o0tleo i3iyslmDum(mo u0trxrxo to1faDrai s s)srxmim3nu4ll  mfctls)srtm( pot1tlxoiiciadls ua(vpnt4aexoio3tydlpte uvo;() 2umxr nu4ole licia(f rta(mo;t4tetoiieiad a2ua(msn(4alermf oadla eluvo t s2trio3io4lmtemfvsltfsrtr(  oo4aeenmf3tytfmDumnmon() rerir oytom  anesl() euoxrpoudamee nci s)arrrx oou4aeeomfetatlaDum( o u0alxnmrciadlpD auvilt  rtoir ny1opeelnci s)a2rr(ront1apeomi3tldfaDrl(vs () exnir iodlm raueil()t2tm(rpiu1ope lnvt tf 2urum nt0alxomi3ilslsDrmnmo;t)tlxnir3oo1fmtran s s tetr(m io4llen nctl()s2umxm nt4texn ieildfmDrln pnu4 etrxr3ta1omDrlu sl(0 rumxr nodopeemiesl( a2ra( o;t4aeenii3tltlsDeaumsn() eenxr io1fpt lueolt  exmio oy4ap nmncsltf rumxmo;o4texo f3taslmDua(vs;u) ltrioctadfateliei () rxrio io4alt mies ( aDrax oot1apxnmi3iydfm uanvont)aexnifcoydfaDe u ol(  rxr(opnu4alenmictasf rumum oo1tlenifetysfs umumsnu0aeenmf3iy1fmDr nvs;t0texrxmpnu4aptnlfci tf 2um(rpot0texomoctyslmDem(vs t4 reomr totfmtrln o;( s2tmxmpoo4op   nes s  2raxmo;t4tpxnmfeiad s rlnmpnt4tlxoxr3iodlmtean ol(0 2uoirpoodaptnmfctat a2uaxmoou1alen fcildfaDrmu p (4 lxomo3tytomDrluvs t0seuoiopnydapen fcias s2trurpnu1aexnio3ild sDem(mpnu0arxnmf iatfm r neo;(0 etrio3no1amtelicsls)srur( o;o0tpxniociasla2elumo;(4altrif3io1om elnvs;t t2xrxmpoy4amte fes s arrr(ront4tle  oeiytfmDelnvp t)altrio3oo1op eauvo;s srto(rpio4alt  ivt s a2urur ;u0teenmfciydlaDulu p;(0trxomrciotomD livi t t2toxm oo1lmenlici s) rur(ront1opxomoctat mDelumsn(4 ltnxo totfaD  ues t setrxo oodape  nciat  2ua(m ;u1tpeo octas m el(msnt)tltnmr3iydfpD lneslt trtrxo iy4lpt miet tfsruaump;u1aptoiociyslsDel(mp;t) lxomo3ootfatr neo;()t2ur(r3nydale lnetasfs2ur( poo1tpe ioeildlaDuluvpnt0 renio3oo1lpDraues t)srumxr3ou4amte ieslt srrax pnu1ole  ieiadfm ua(mo t4treoxr3ootfpt liei;( trxmir iy4lp  lfvslt) Draurpnu4tpxnmi3tydfs2ranvp t0aetrxf iatlm r uei;s sexrxo3oudlpen fci s  rrrxrp;o4tlt if3iys mDrmu o t0texomociy1optelneo s trxm(m ny4lpeelnvslsf 2tm( o;u0oet  ocildfs2rlnvpnt) rtrif oodfat li i;s t2tmxo io4apt mics sfa2taur ;u0oexn feiaslm2ea(vp () lxnxr3ootom eliei s)seuo(rpou1lp  livtatfsDumx pnu0alx  feiytfmDran onu) leriociytomtrlnvsl(0teuoim3iudomtnmfcsa(fsDtax o;o4teeoio3iadla2rm(vonu0altrio io1op eai s;s) euo(rpnydomenmfcta()aDrmu pnt1tltoio3iydfa2elnmpn(0artrmf oadfaDeauvs s)t2trio nydomenlictat  rrrx  ;o0teeo fetldlm raump;u) lerifciytlpDr uvol(0setrxr nu4ale lfcilt) 2rauroot0alenmoctysls ulnms u) ltrio3tatopte ueols seumio ou1omtnlnvs s sruaxm ;u1tltoiiciytla uaumon() renir io1faDeluvo s) ruoir3oydam e ieils  Durumono0ale miciytfs2em( onu) lerir3to1oaDrlneo;s)seumimpnodap elfeias)srtaxrpou1ape miciatls rm(mo () rtnxf oytfmteluvs;( s2uo(r3ny4optnmnvs s s2tru oou1oleomicias m rm(vp () rxrif3iadlpDr ieils  2uo(mpnydoltemies ()s2rrumo;o1tpxniiciasfa ulu pnt0tleoxfcoa1lpteanvi;(0 ruoxr no1amenmfcilt) Dum(rpno4apxo fciytls emuvs t)tlermf io1oaD  uesls t2umiopny1alt  nvs (f rumxm ou4oet ifeiytfa2ul( s;t0 ltnio iydop e n s ()t2tmxo oy1alt liesl(fsrur(r oo0apxomf3ilsls2ul(vo;t0texrxociotomDelueo;() rtmxm nydaptnmnciat)aDtmxmonu0aee ifciasfaDrm(von(4 lermo3oo1lpD ln s t0sexrxmpno1llee ieia(f ruaxro;o4tpxomicilslm rlnvp;t0arxnmf3iydoateanes;()sruoxm iydlm n fct ( a2ra(mpnt0tptn ieiltfa2em( ont4 rxoio3tydlpt an i;t  rxr(opoy1op   ieia()srumx p;o4olxn f3tat mDuaumpn() leoir3iotfaDrluvol(0 2tmim3oy1aptelfvtl()aDra(ro;u1aptnmi3iys m2elnmon(4tetoir iodfp  anvi;s0 etrxr iydlmenmiesl()srrr(rooo1tet io3iad sDua(monu)teenmo tatoaDr u s;(  rtoimpou1olee fvtat s2uaurooo0tee mf3iltls eaumo;(4altoiociadop e n s;s  rxr(opny4am e feil( s2trurp;t4tlx ioeias a rlumo;()arxoif3iy1la raueo ()t2toxr ny4olenmiciasfaDum(mont1teenmoctyd aDem(mo;t) rxomf3tadfat lnvil(  2to(m3io4amee fctls  Dtaxr ;o4ale  ocilt m emn p t4 rtnir3iodfp rau ols srurxopoydomtemivt s) 2rrxront4tlxoio3iyd m umnvs;(0arenxo iytfmt auei;s) rxm(opiodap   nvsasfs2rm(m ou0tetn octltfa rmnvo;(4arxnxrcoodlptranvslt)teur(r3nu4omt mnet sf rta(ront1aex  ictasfm2rlnvpn()tltnmr iatfp rlneol(  2toim3ou4lp nmfcsas a2rrx poo0opt  o3ild a eanvo;() ltnxfcia1fmD lueo;s0seurim3ny4om  mfesatfa2rax  ou0ale if3tasfmDrln pnu)tetnmr oo1fmDe n i s t2uriopoo1olt  ivslt aDurx  ;t1olenmociltla2eluvs u)trxoir3tydlpD lueo;( tetmiopio1ll emies t  2rrx oou4alenif3tatlmDrlums (4 eenmf3ootoaD lieil( trumxm3iodlmtemicia(fsrua(m nt1oeeomf3ilsfmDuaumo;(4treomr tytomteanvs;t s2xmir iu1lmtnmietatfaDuru o;u4apeomf3tlsfmDean p;t)alxnirctydfmte n ols s2uoxr oo1olt lncs s) 2rrurooo1ole ifeiadfs2emnmo (4 eeoxf3oy1fa  luvi;t t2tmir ny4ll nmfetls  rra( oou0altoio3iaslaDranmp;(0arenxf tytlmtran s t) etoxr oo1apeemiet sfsrrmum ;o1tptn icias a2ul( o t)tlxnmo3oodla  ln slt0teur(o3ny1ol elieils artrxmpoo1oleniociyd s2eaumsnu4teenmo3iodfmDraueo t)teumio3oudll e fetat)aDrr(rpoo0oee  oeiadla uan pnt0trenmr tatlpDeauvils)trtmir3nodap elnvil(f 2ta( pnt4apxomfeiltla emnmo t) rtnxo oydlat aiesls0 rto(r3nu1alenlncslt arraumo;u1texoif3tasla2eanvp u)arxoif iydopD  uvs ( texmxopnu1amtnlfvs (  Drrxront1oetnmfcilt sDem(mon(4treoxr to1fmD aneo () euoim3iu1optnlnvt () Durur no1alt mo3tasla ra(vp;(4 exomr3todlmDrauvols0t2to(o ny4omee ieiat)sDtmu o;o1oeenifeiytlsDem(vp t)aexrxf iytop eli i (0 2xrxmpoudaleelieias) Durxrpoo1tlt if3ilsfs2umuvo t) eermo3todoptrauvi t0trur(m iy1ameemfesatfa2rau  ;o1oleniieilsfm2em(mo;t0trtrifcoy1fat ln olt trxmio3oy4am  lfes () Draxmo;o4tpxn ietasfmDrlnvs (0 ltnmf3oadfaD livs;s srumxm oo4llt lfvtls sDumx  ;o0tlx iociltfm rl(mont4teerxrctadfaDrlueslt)srxm(mpio1ape miet t)sDuax oou0olt ifctyt a2ua( p (0trtrif3iatlat li s (  exo(r oo4aptelieil(farra(mo;o4tet ii3iltls ra(vp u)aleoirciotoa  lnvi;s teuo(o3nudope mfviatfa2tmu  nu4tptoii3iatfs2ul( ont)trtnxf3tadfa r uvs s)teuoxrpoydlmt  fcsas srum(r no4tleniociadlsDea(vp;u4aexoxr oadlp ean s;t t2xrxr nu1am emfvta(f Dtrxm ;o4opxnii3iaslm rl(vpn()areoir3todlmt  ieo t  2umxopio4om emnvs ( aruaump;t1aexomfetytfm ulump t4 rtrxf3oy1omDeln o s)trto(rpnu1omtelfcs t)sruax oou1ape ioetlslm ul( s;t) rxomo oadomDrlneo;t0texoxr3iudomtnlici ( a2umxr ;o1optniieiasfs2rl(vsn()tetomocio1la  an o ( s2toimpiudaptnlicsasfs2ur(ro;t1tpxoif3iyd sDem( p;t0aexrmf to1fpDrli i;t srxrxmpoy4optelies sf 2tr(mp;u1apeo oetad a uanmo ()trtnxfcty1fpt  ieol() rto(m ou4ale  ivs t)aDtmu  oo0tlxnmf3iyd s2ra( o;(0aetomo3ia1opDe nvol()t2trxmpiu4al elfeslt a2raurpot1olxniiciasla2rmnvo;(4tlermfcoadfmDe ivi;() 2trim3nu1lptnmiciat  2raxmpnu0tlxoiociltfs uanvpnu)artomfctydfmte uvo;t texrir3oo1lmtnlicilsfsDtmxrpoo4optnmociydfmDean snt0trxoio3oatfptranei ()s2urxr3io1am nmnvtat)srum( poo4tpx  ieiyt m2ulu p t4 lenmfcoytla raivils) euoiopiy1apt mfeta() Drru  oo1oet if3iyd a ulnmp u0arxnxo oa1fmteauvo (0 rtmio iydlpe  icsl(fa2uaurpnt0tptomfeilsls2rlump t4 eenio ia1faD  uei;t)seuo(m oodaptelneiatfsDurx  no0optnmfctysfm emnmp;() ltnio ta1faDraneslt0teurxo3nydamtnlicsatfsDurxrp;u1alxo fetyslm elu on(0 rxrioctatfmDr n olt0 rumxr3iudam  mfvil()aDrmx p;t1apeo oetldfs2ul( o (4aeerioctydlpDeauvo t) rtmxr iudlp n ivsl()a2tmurpot1olxoiiciytla2rauvs;u0 exomo oadlaDrli o;s0setoxr nu4lpte nciat  2raurooo0opxo fcildfmDel(vp (0alenmf3ia1lmt aivo ()seur(r nydlm nliesl( aDrm(rpno4tpt if3ilsla ua(vo (0 lerirciatoaDrauvol(0teuoxr3iy1ome  ics ()aDtmxrono4oleoiociat a ua(mo;u)aexnifcta1lmDrlu sl()trtrio iu4lle  nctls)sDrmurp;o0aetnii3tldfa um(monu0alxomrcoydlate u o s)trtm(m3oydam e neiasf rumu poo1oet  f3tlsfs2rl(ms;u) eenirctadoatr nvo;t)texo(opno4al elfeia()s2rmxmooo0tptn fciyt a rl(vs;t0 etrmr3oa1lpt luvi;t0 etrir3nodole mnvt t)a2umum ou4alto o3tlsfs2uaumo u0alxnio3totopD luvs;s0srtrxr3oudap  lfcia() Dta(moou4opt  f3iydfsDelu onu4artnxf oa1op  aneolt0trumio oy1omenlnvi ()srur(rooo1tetn oeiltlm2elnmpnt0altoxo oo1lm  aivols)seurxm3no4alen ncias  2tm(mpnu0tpxoii3tadlmDelnvp;u0teenmrctatlatelu o;(0srtrxo iy1aleemnci t  2rrxmo;t1aexo i3iys aDrmnvp t4artoxo3ootomt lnvo;t trxr(rpiu4am   nct s sDrmur ou0tpt mociatla2ea(vp;u4arerxrcootoaDrlnesls) 2xoxo ny1optelivta() Drax  oo1tpt  o3iasfaDrlnvs;(0tlxrxfciydop r uvi;(  etmxm oudomtemivt sfsrumx  ;o4alxn feilt mDrl( o;u0 rermo3iadomDrli o;(  rtriopoodllen ivsat s2ra(m no1opx  i3ildla2ua(mon()trenxr ta1fpDrlneo;s) 2urim iy1am n nctasfs2ra(mo;o1open fciaslsDul(vo u)trxnir3oodfpDraieo () rtoim3iy1ll   fei sfaDraurpnt0alt mf3ilsfa ranms;u0 reoxf oydlmD auvs t)trxrio3ny4aptelfviasfsrrmur oo0aeeoiietltlm eauvpnu)trtnxf oytlaD lueo;s0srtrir oy1aptn netlt)s2umxrooo4aexnifciatls2raums;t)tetrmo3oytfp elneo;s)sexo(m3io1amt  nct s)aDumxmooo0aexn i3iasla emnmp t4teenir3tytlpte neslt) 2uoir iydlpe  nvslt  rtaxrpoo1oexomo3iad a el( pn(4 eeomrcty1fpD  ueils)t2uo(r3oudlm nmnet () rumxrpot0tlxomfeiatlm2uaumon(4 reomf todlat  ues;()trum(rpny4ap  lfvi ()s2rrxrooo4optn o3tyt s2ran snu0tetoircoy1lm eaiei;s t2toir io4oltn icsls  2rruro;o1alt moeiatlaDum( p u0aexrif3tytopDeai o t teuoxrpoy4omt  nct s)srraum nu4aet  f3iadfs elnmsnt4 ltomr oa1oaDeliei ()t2xo(o io4omtnlict (  Dumurpno1tetoifeiltfa rlu on(0 renioctodomtraieol( srtoio oo4lm   ivi (fs2rmxro;t1tpeoii3iydfaDrmn p;(4tltomrctotlpDrau o;( trum(opnydllt  ici s  Dra(rooo1opx micildfs umu s u4 eenio oytfmDrau s t t2xmxm3oy1oltnlncs () 2ur(ronu1ale  f3ilsla uaums;u4aetnir3iodfpDeaues t)srxr(opnodam nlictasfaDtr(m ou0apxnmiciatfaDemnmo;u0aetrxfcoatfpDeaieilt0trtmim iy4lltemnesl(  rraur nt4tetomfctadfa2ra( ont)texoio iytoateau s;s t2um(m3nudapt lfetl( arra(rpoo0teeoioctasfm rmnvp;u) eeoxr3oo1fat  uvi (0setmxm3iu4lle lfcilsf Dum(r nu4ape  i3tasfs2rlnms t0 rtomf3tytoaDe ivo;( srtriopnydomtemfetatfs2urxmp;t4tpxn ociat aDrauvs u4aeenmoctytoatr nvi;s t2xrimpio1lme mivilt sDumx  ou4oexnmociadls umnmonu4trxoxo3oytoaDeaivi () eumxrpio4ll elfctls s2ra(rpnt0apxomf3iat a2eau pn()aleomfciatfp eauvi t)trxmxo nydolee fci ( sDrmxro;t1olxnmietltls2emu o;(0texomo3oydfpDr uvilt t2xm(o3nodom emivsl()artmu onu0texo ictydlsDea(mo;u0aetrmo oo1fpD  neils0trtmirpnu4ale  iviatf Dtruro;t4aex iietlsfmDrm(mp;(0trtrmo tatfptr n o;(0trto(rpiudom nlicslt)aDrr( oot4aptn ieiltlaDrlnmpnt)areomocoatlm elues;t)teum(m3no1olt lnvias)srur(r ;u0optnmi3tld m ran o;t)aeenmfctotfp rluvi () etrxo iu1alee ieiatfsrtmxm ;o1olx mi3tls aDua(mp;(4 exomf3iydop rlueslt  rxr(r3iydomt mfctltfs2rmxm nt4aexo o3iysfa emn o () lenir totoptrlnesl( trurxopiu1ape lnvsa(fsrta(mp;t4tee ii3iadlaDemnvpn(0teeoif iydfa eln s s0seumim iy1alenmnvsa(faruaxm ou4aeeo fctldfa2rl( o;(0 etomo oytfmteaivol(  2toxr3oodap e nesa()aDum(ronu0opt  fciadfs2umn p ()tlxrxf iodomtelnes (0trumxm3nu1lptnmfcil()a2ururont4texo oeilsfm rm(mpnt0alxnmociydfa raueols s2trir oudlpenlfct t a2ra(r no0tpeoio3ilsfs rmn on(4tlxnxrciadomD anvo;s srurimpio4lltnmics t)s2tr(ro;t1oleoio3tytfs uln sn(0altrirctatlmDr iei;( srtmir oy1lmeelncsls) rrmurpot1apxnifciyd mDeln o u0 lxoio3iadomt auvi;s0s2xm(mpiodolee nctatf Dururpno4tpenmo3tld a2rm( o u0 etrmfciodlp  an o;s0texrim nu4om nlnesas) rtr(r oo0tlx mf3iadfm2uaump;t4aetoxrcta1op rli ol( tetoiopoo1lmee fvia()srtrxmono1apeo iciytlmDrm(vo u4trxrir tydopte ueo t)t2tmxmpnu4ome liviltfa2rm( pot4aeen i3ildfs2elu sn(0arerif3tadoaDrlivs;s0tetr(m3ny1ll elfvias srurumpot4olx mocias a ua( o;(4tetoxf iatlate u ils) eto(opno4lltn fcilt) Durur nu4apt  ietasfmDrauvs;t0tetnmfcto1fmtrlu slt sruoxo nudalteliei (faDrmx  oo1texn octld sDum(vpnt)tleniocootomD lnvi;s0truo(rpiudoptnlfviatfa2tmxmono4tlxnioetydfm eaumo;t0tetrif3todfmt ai il(0 2urxr3iu4apenlicils  rumxm ot1texoioetls mDeluvpnt4 rtomf ootfat  ueolt0s2tmxmpny1lmtelivi (fs2um(rpot0apxnmoctys aDum(mp t0alxoifcoodoa eli o;s)texoxmpoudoltnmfeta( aDtmurooo1tpxnmictyd s eluvonu4 exnmo ta1lp   nes (  2tmxr3nodlpt lfctlsf 2uaxmont1aetoii3tltfmDumnvont0tltnxrcoydlaDeluvilt  rum(o3ny1open iet s  rtr(rp;u0tlxoifeiat sDumuvp (0aexrxfcootfaD  u o () rxo(o3iodap  miet (fa2rr(r ;o4tpen oetysls umu snt4 exrxf oydoateli s ( s2tmiopoodope  nvi s)arua( ono4optomictlt mDum(mo;t)tltrxoctytfpDeln o;s)srtrxo nu4altn fetl(faDumu pnt1tpx  fciltfaDranvo u4 rtnmf tydopDraiesl(0 eum(rpnudoleelfvia( a2tmu oou4tetoiiciaslsDum(mp;(4 eeomfciatlpt  ueo;t  eumxopou4lpt mfci s)s2rm(ro;t0oltniociatlsDumnvo t4 lxrxf3oydla ean slt0 exo(r ny1al emict t) rrrumpoo4aptnmf3iaslaDra( s;u0trxrxr3oa1lat  u i s)trxoio3nydamen ivi () rumx pnt4olxo ieiydfmDuln on(0aexrmo3oytlpDr neo s0s2urxm oy4ap nlnesas) Dtmumo;u4opxnifctysfaDeln ont)alermrctytfpDeluvs s0 2xo(m3no1omtnmnvi (  2tr(m nu4tptn o3tldfs eauvsnt0teeoir3oodoatrli s;t) euoxopiydomt lneslt a2tm(  ;t4tpxnmfctasfa2eluvs;u) lenif iy1omD aivi;t)srxo(rpou1al n fci s srrrxro;t1aex mfetldlsDelnmp u4 ltnxr3oadoateaivo ( trxr(opoy4ameelnciat) rrmu pnu1oeen ieiys m rluvp u) rerxf3iodfpDrln ols)texmxm ny1ape livils  2ra(  ot4olx io3iltfa2ea( on(4alxrxrciytfp rauvo s)tetmiopiudom  mnctlt  Dumx onu0tlxnii3ias a2ran pn(4texnir3todom  an i t)s2umim3oo4lm nlfct t  Draxrp;t0tlxn o3iysfa2rau snu4texnif oodfp   neils setmimpno1olt livia( srra(rp;u0olt ii3iydfa umump (0 exrxoctydfmt  i o;t setrxopio1lpt  fci t)aDtmurpno1apeo ocild a2el(mp;t)tlxrmr ta1laDr iei (  2tmxr ou4amtnlieia(  Dtmxr ot4oetnmiciasla ra(vo (4teeoio iodomD ai slt)s2umir ny1lm emfei t)sDumumo;u4texo octysfa rl(ms t)tetrmr oatfmt anvs;()trto(m iy1op e neta()sDrmurpoo4tlt mf3tld s2ua(mpn(4 exnmr3oadlpteaueo t0 etoim3nu1lp   fei t)sDrauro;o1apto f3tldfs ul(mp u0tlermo oydfmDeauei;(0srxmxrpnu1olenlncsat sDraxmp;o1apxoiicilsfm2rm(vo;u4arxoxfcto1lptr neo t  rtoirpnu1ap nmfcsatf rtr(moou1tpt iictyd sDrmnmo u4 ltrxr3iotomteaueo;()s2xmimpou4lmt lfvt tfa2ta( oou4apenii3tytfm ea( o ()altoif3ia1lm rlivo s0s2trxr oo4am  lneiat sDum( p;o4oeeoiiciatlmDrluvs;t)alxrir ia1oaDranei t0 rtr(mpnodom  lfcta()a2trxmooo1aexniieiysfa2rmnvp;(0tetrif3oadfp raneo s)sexmir3ny1al nlieilsfsDumu oot1texoif3tasfm eaump;(4 lerxo tatfp r iesls)trtriopio1lleemfvta( sDtaur ot1aptomf3ild aDuan snu0artnxfciotfptrlieslt0seto(o3nydapeemiet t sDrmur ;t0texo feiyd sDua( s (4tltnmf tytfmteai o s0setoir oy4alt lfvtls aDraxro;o4oltnmfeiyd aDul(vo (4 reoir io1lm e nvi;s  2umim iy4oltemict ()s2urxro;u1ole  feiadls2rlums u)tlenif ia1fatraivs (  eurxrpnu4aptemiet s  rurx p;t0olx  i3iasls2ul( p;t4 ltrmr oo1fmtr ieo;( srtmxopnodlmtn fctasf 2umx pno4oetoif3ils s uanvs u4tetnir3iodlaD anei;t  2trxo iodomeelfetl(fsDra(mo;t0aex mi3tatls2ea(ms (4 exoir iy1fmt lueo ( s2toxrpoudlm e icta(f Drmx pnt0tet ii3tlt s2ua(vp t4artnirctadlm  lnes t s2uoxrpiu4al elnct sfa2urx pno1tleo i3iyd aDelnmp (0aetnmr3iotomt aiei s  etr(r3nodop  lnctat)arrmu ono0opxniieiyt s2rm(vo (0 rtoif oadlateai o;s srxr(r3ou4llenmfcsasfaDuax ooo1texomi3tat m rln snt)arerxo3oodfp rlu s t s2uoir iudam  lnvta( sDumxmono4alx mieiadlaDrauvont4teenmfctotfmD aivi;t s2to(mpno4ap elncilsfsDuaxmp;t4oeeo ietldfm2em( o t0 reoifciotoa e i s;s0 exrxo3oo1llenmnvsatf Draxrpot1aex mf3tysfaDulnmsnt)tlenif iadomt  nvo ()trxrirpnu1om e feilt)a2tax pnt4tpt mf3ildlmDuauvpnt0trtoxo tydfpt aues;(0 etoimpiy4om emfvi ()a2um( pou4tetn f3iysfa uau s t0aeeomr oytom  ai s;(0 rxm(o oydolenmfci () Drrxm ;t0oeto f3iyt m2ua(mo;t0trtnir oytoaDr nvsl(  eumxmpoo1optemnetat)sDrm(r nu0tpe mfeild sDuanmonu)trenxf oadlaD lu ol( trum(rpnudope lietl(fa2rrxr no0oeto i3ilt m ua( s;() etomfcootfm  li o;t)trum(opnydalenlfvta()aDua(mpou4tle  ieils a elu o;u4 etrmf tytfa elnei;(  2xo(o no1llee iesat s2tax ont1tpx moeiasfm umn o u0tetoxr3tydoa  lueils)texo(opnodopt  feilsfs2rm(mpoo1opt mo3iasls2ea( pnu0tetrmoctotla rlieo (0seumim nu1lm n ietlt aDtmu  ;t1aptnmo3tytlaDra(mpnu4alenmr iydfat  i i s srtmxo oy1amtnlneilt)artmxmo;o4oeeo fetlt sDrl( snt0aleoircoa1om  aies t0 rtmim ny1olenlfcias s2urx pnt4optnioeiltfs ul(ms (0aexnmo3ty1fpDrlivs ( trtmxopio1al elfvtl(  Drm(mp;t0aetoio3ild a rm(mp;u4trtnio tytopD lieols0t2xr(opoo4amtelnvtat a2taxm ot4tltnmo3tasfa rlnvo (0artnmr3iytopteau i;t0 etmxopoodll   ivi t)s2tr( o;o4oexnmfetas m ra( s (0texnio3oodfptraieo t srtrxr3nu4ome  iei t)aDurxr ;u4apeo o3tltfaDrl(vo u0tltoxo3iy1fpDe iei;(0trtrxr ou4ap nlicta( srrmurpnt1tlt mo3tadfm ean o;u) etoif3iotfmtr ivo;t0truoxr3iy1lm nlict t) 2rr(  ot1tltnmf3iltlaDra( s;t4 rtnio oa1oaDelnvo;s)sexo(r3iodamenmfci ()sDur( o;u1tle  ietadfaDelnmo;t4 exoxf tatlate n i;(0s2umimpoodlpe mnvsas  rtaxmp;t4oex  ieilslmDul(vo;u4 lerir tatlp r u o s0 eum(m3oy4ame lnvsl(f rurx
\ No newline at end of file
@@ -0,0 +1 @@
+ivols0trxoim3ou1lleemicil( aDtr(m ;o1opx  f3ild aDra(mp u0 rtoif3oo1om eau s;s teumxmpou4am elnctat)a2um(ro;u1oeeomi3tatla2el(mp;u4tltrio3oa1lat auvol(0t2um(r3iu4am n nvtas aDur( pnu1oexn i3ils s2el( p;t)teerio to1opD anvols)t2trir3nudlmtemfcil(  2taum no1apxnmfeiaslmDel(vo;()arxrxf tatlmDraies;t0 2xoxrpno4lm e fet (f rra(mo;t1tle ifeiydfs2emn pnu4 exrmrctytfpDelueo s0 rtoirpnu1olenmnvi (  Draxrpoo1aeeoif3ilsla2uanvs;(0arxrxf tadlmtraies (0trumio3iudam n iesasfsrurum nt4tpe mieiyslm uauvonu) leoirctotfm  aivilt)s2xoxm3iy1ale  fet t) 2uaxm nt0tlxn feiyd s rluvo t4trtoircoy1oaDelneo () rxoim3oo4lp e fcsa( artaumo;o4oee mfeiyd s rl(mpnu4trermr oytop rln s;s0sexoim io4ape mnei tfa2rr( onu1aetn ietldla rm( p ()texrmr3tydlatelnvi;(0srum(r3iudaltemivi s) rrrx o;u0oeenmfctldfs umu snt0teenmoctydfa  liei;s) rxmxo3nu4op  mnet (fsrrr(moot1tlxnii3tas aDuanmpnu)aeenif3totoaDrauei;t) rxrimpiodaltemfesl(f 2raur nu1oetniieiytlm2ranms (0 lerif3ta1fa  lnvs;( s2urxmpou1lmeemnctl()arrr(r ;u1olxn f3iasfs rlumsnt)aexrio tatoa eauvi s0teur(r3oodll elictl( sDrm(  nu1alx  fciysfs2ua(mon(4 ltoio3tadoa eaies s)t2xmimpny1am  lies tf Durxmo;o4oexnmfctlslaDeln sn(0texnif iodlpDrln o s) 2uo(mpnu4ap nmieiat sDtauroot0aetn f3tysla2emn o u4arxoircootfp e u i;(  rtrxm3ou4ole micia(fsrrmu pou1alxnio3iysla2eln p;u0trerxrcty1fpt ln i () rxoiopio4lme lfciltfarurur ;t1apxnmo3iysfaDel(mo u0 exnif3oodopD  ivslt0 exoim nu1lmenlivilsf 2tax  ;o0oeeomo3iad m eanvs u0 eeoif3iotfpDeanvi s) 2uo(m3nudlmt livsa()s2ta(r ou4aet moeiasfmDrlnmo u)treoxr3oadomDrln i (0texmio no1lmt lnciltfs2ta(mono0oetn iciltfsDranvs;() rxomo oo1oa  aivs;s srtmxopiydomenlncias artmumpnu0opt  fciytla uan s u4trtrmo iotomteai s ()srxoxmpny1am nlncilt)aruaurpou1tetnmietydlmDelumo;(4aetoirctydfmDr uvols t2uoxm3no4llenlieilsfaDrrx pnt1aeeomi3tasfs2rmn s u) reoio3iotlpD ln il( srxm(r3no1al nlicsls)s2ra( oot4tpe mocild a uaumsn(4 etoio iatfm eluvsls0 2xo(m3ou4lptnlivilt) Dua(mooo4aet ii3tadfm2rlnvp (4artnir3oydlm elues;t0trtmxo3nu1lmtn nvi ( srrm(moot4apx mictasla ul(ms;u0teenxr3iytfmtean s;s0 2urim3iydam nlnvsl()sDtmump;u1aeenmicilslsDul(mo (4trtoiocoodlaDeau ilt  etmio iudll e fct tfs2tm(m ou4apx  oetldlm2rluvsnt0 rxnmrciy1fp e uvo () etmxo3ou1ol  mfvtat a2rmur no4tlx  oetldls2rlnvs;() lermo3tadfaDeauvs;s) 2uoxr3no4lm e ivt () Drmu pnu1ale  iciytfa2eln p u)trenmrciadop e u s;s)trxoxrpio4olt  ies s  rrr(m ou1optnmo3tltfa el( s;t)alxoifciy1lm e uvo t) exo(rpnu4omeelnvi (  rumx pnt0tlt iietas s rmuvo;t0trenifcty1fmD aieil( srxr(rpio1lp e ivslsfa2trx  nt1tlxomoctydfa2rlnmo;u0tlxnio oodlmtraieo;t) etr(opnydll emietas  2rmxm nu1apeomieiatlm2ulnmpnu0trerio3oa1fat  i i;(0teum(o io1lm e nes t) 2uaur ;u1aetoif3tyd aDrl(vo;t0 reniociodopteanvo s)s2xoxmpiy4ameemncsa() 2tmu  ou4tpx ii3iltla uau pn(0 lxrir iotomt auvi;(0trur(o3iu1lmtnlfvilt  2uau p;t4aee  octld m rmumo u)teeoif3oodlaD  nes;(0t2urxopny1op e ncsasfs2uax o;t4aeeo o3tys sDrl(mp;u) rxrxf oadlm eai sls)sexoxo3no4llt lfvtltfs2tmumont0tlxn i3tltlsDemu o;t0aexnio oo1latr ivsls) rxmxr3iodame livtlt)s2raurpoo0aee mfcias m rmnmo (0texnio3tadoat aueo;( trumxr ou1amtn nct tfa2rm( o;o4aetomictltlm2uanmp (4altoif3ty1oaD aieols)seuriopiy1oltnlivtas aDtm(moot4olxn icilslmDrmnms;t)tlxrir3iydfm  aiei t)t2toxr3iodope mncs t) Durumo;u4olt  oeias mDel( o u)tlxoircoy1omt lneil()srtoio3oo4ole  ics s) Draxmo;o4tetnioeiatlmDel( s;u0 lxoxf iatlmDe ues;( t2xm(m nydam n fcs t aDra(  ;t0oleoif3iydfaDra(ms ()altriocoytopt aneols texrio ou4amtelnei (faDumx  ;o1olxoifcilslsDrl( s;u4tlerirciadlat  u s ( trxrimpio4ape mnvtl()sDumurpou1alxoifcild a ean p t0aexoxrcto1lp raivi;s0trxo(o iudap  lfvta(fs2rr(r nt4oex mo3ildfm raums u4trxoir3tadfmt  n s;s  ruriopoodol   nesasf 2rrum oo1tle ioeiydfa2emn p;u4trenxrciytlmteau o t0t2trio nodlmtn fviatfa2rax  ;u1tee  o3iytfa2rmn pnt0trxnmfcoy1lmDelu o (0 eurio no4lmtemnvsasfa2rr(  ;t4opt  ociltfa emnvo u)trerirctotfmDran o;( sexmirpoo4lpt  ivt s artmxrpot0opt  fciatla2eaumsn(4 lxnif3ia1op elneslt0setmir iudal n fei s aDrru  oo0opxniictydfmDeluvo;t0aetnmr3oo1lpDr ueo ()s2uoxo oydal  lieil( a2rrumpoo1aeenmfctltfs2ulums;(4artoxf3to1la raies (  2toio oydoltnmnesas)s2umx oou0aetnmoctat m2umnvs;u0tlerif ia1om rluvs;t) rurxr3iy4llte net t)srrmxr nt1oexn fetat m2ea(vont4 renmoctadfp  ai i;()teumxo3oudlp nmneils) Dumurp;t0oex  ocilsla umnvp t0texrio3iytfatran ol() rxm(opio4am nmfcslt  Drmum ;t1olxoioetatls2rau snt4 exrio oadlp   neo (0 etoxr3ou4opte fvtls aDum(root1tpx iieiad m2uaumo;()aeeoir iadlp e nvslt) 2toxo iudlmte feta(f 2rrxm ;u1open oetatlm2umnvp;(4alxrir oo1fpt lnei s0 2trio3nodoptemfct tfaDrau  ;t1aexo fciasfs rauvpnu4tlenifcta1fat  ivslt)texmxo oydope lnvtlsfa2umurpnu0olenmfetld sDuln s;u) rxoxf3iytla   ivi;()t2uoxr3oudlpe  fvilsfsDtm(ro;o4tetomo3ias mDelnmsnu4tltomocoodfm e iei;(0 eumxm3oodlltnlivs t)arua(r nu0tleo ociysfa rmn o;t4trtoir3iytomteaivols) 2tmxopiu4altn nei s sDrrx poo0open ocilt s2rmu o () lxomr oodlaDraneil(0srum(rpnu4ame mivta(  Drrxm ;t4oexnmoetydfm ulump u4 rxnxf3iy1lm raieolt)tetmxrpnodop  lfvsasfaDra( pno1aexnmictadlmDrl( on(0 etnio3ty1fatr u o;()setmxrpiy1ap n ncsltfaDuaxr ot0apx  o3iytlaDeanvont4aexnmr oy1lmDr u o s0trurimpnu1lmee nvi t) Dtax ont0altn o3iys m2umn o;(4aetoiocoadlat auvi;s)truoim3oo4altemncs s)a2urxrp;t0ole mictaslsDran onu4trerifcio1fm  aieo;t s2uoxr iy4op e nvsl()sDtm(r ;t0oleoif3iydls emu p;u) eerxf ta1lp   uvs;(  rur(m3oydom nlivia()sDururpnt4opxoiiciytfm elu s;()aetrmr3oodop eaueo;s0 rur(r3oy1apenlfviasfs2trum no4aee mfeils s umn s t4tetnif3iy1fmDe ieo ( trxmim3ny1ape  ietltf 2rax  nu0oexnmieiad m uaumo;t4 ltnxfctadfpDean ol(0teurxo ou4lle mfeta(  2tmx  ;t4tpenmfeild s emnvo;(0areoxo tadlp  aies s srtrio3io1olen fei t) rumx ooo1olxoioetldls ea(vo u0altnxr3iodoa  luvi t0 rxoxr3no4olenmicsasf Duaumpnt1tpx mieiadfs2emnvsnu)trtnmf3io1laDe uvi;s0s2xoxr3nu4apte fvi t)aDrrurpnt1aexn octad s rmu snu0aleomr3oatoa e i s t)setrir3ny1apt  feia()sDum(mooo4tpeoio3tlsfs elnmont)artrifcoadoaDe uvslt s2uoxm3iy4ole  nct () 2um(ro;t4tptoioeiatls2el(mpn(4arxomocto1la r nes;s0teumimpou4am elnct tfs2uax pno0alt  i3iadfaDelnvp u4 ltoir oy1oa rln i;t0trtrir3nydlmtelics tfsrrrumo;u4aee mfeiyt a2ua( s;()arerxfcia1laDrluvi (0s2umio3io1oltnmiciasfa2rmurpot0ape  ieiydfs2rauvp t0texrircio1opDeaiei s srurxm3iy1lme mictat  Dtm(m nu0tlt mf3tldls rmumon(4arerifctytlptr u slt teto(o3oudlpen ivtl(f Duaurp;u1tltomi3tltfsDemuvp t0texnxr oodlmDrlieolt0 2toxo3nu1alte iei t aDrm( ont4opx mi3tlsfmDuanmpnt4 exomo iadop eau o s texrxm oydalee fciltfsrrmx pot4olxo feiatlm ranmo t)tlxnxo ty1omDr ueils0 eumxm3oudoptn feiat a2tr(  ot4tex mfctyt sDrl(monu4altoio ia1fmteauvils0truoxr oydoltemneslt)srrr(  ou0oltoiiciasfa rmnvo;u4arerir tydlp r i o t s2toir3nydll n ict () Drmxmoot0aetn oetltfaDemu p;()trxnio3oodomte n o;s0 eto(o3iy4lleelicslsfaDra(m ;u0tlx io3ias sDean o u0tetrifcootomte u ols0seuoir3io1apenmictat a2taumono0tpxniiciat a2umuvs u0trerio3oatop eli ol() etmiopiu4optnmnct ()s2raxrpnt4tlxnioctysfs2ua( s;(0 lxnir oa1fate ivi;s0t2umxmpnu4omt  nvilsfs2tmum oo0tpeoiociadla el(vo;u)artoifctadfpt lnvs;t)texmxr ny4lm   fvtlt s2uaxroot1alenmfeilt s um(mp;t) etnif iotfmDelieols)s2toxm no1ap elictl(  rumx o;t0alto o3iltfa2uauvo t)aleomf iodfm   uvs;t tetm(m no4al  micil( aDtmx pnu1tlxo oetat mDrluvsnu) exrmr3oa1lp  luvo s) eumxopou1op n fctas)sDuax pnu4aetniociltlsDrluvp;(0 rerio ootlm elueo;s0 exrirpiydal  mfvtat a2tmumpot1texnmfetlt a2eaumpnu)tlerifciotomDelu o t)s2uo(mpny4llenlneias) Drmxmp;o0oexomfeiat s2umumsn()alxoifctydlmDeaues () 2trxmpoodamtnlnvsa( aDrmxmont4aptomi3ildlsDraumo;u0 rtrio oydlaDelivo s0sexoimpoudope  ieia() 2ra( o;o4tpxniicilsla rlnvont) lxrmf iotfp r nvo;s0t2xr(mpny4lmtemnet sf rrmxmono4olxn ieiydfm2umu s u)aexrxfciy1oaD au ilt setmim3iydole mnvs t)artr( pou0tpeo o3iltlsDrlu snu0 rtnxf3iytlmD  n olt)srtoio3nu4olt mict tf rrm(r ;o1alt mo3iyt a2eanmont)tlerxociadomtr nvslt t2tmxrpno4lpee nvs ( s2trxro;t4aexnmfeiadlm2uluvp;(4 ltrxrcoo1fpDeln il(0srxoxm3ny4aptn ies tf 2rru onu0tle mieiltls rm(mp;u4 exnio3io1op   i s;s)tetrxm iy4omen nvsasfs2ur(mpnu4alt mfetltlsDrmuvp () reoir iytlptr i s ()setoimpoy1opt livi t) 2ua(rp;t4tpxomf3tysfsDea(mp;t)trtnxrciadopD  ueil(0teuoxm no4lpt mfciat) rurx pno4tlxniictasfmDuluvo;t4trtoio oydoate uvi;s) rtmxo nu1llenmnvsat)arurum ot1apeo oeiysfm ea(vo;()texoio iatoa e nvs ( tetoxr3oo4omtnlieia(fs2ra( ont1aeenmi3ildfa2uanvsnt) leomo tydopDe nvilt teuoim3oo1olen ivsa(  Dumx oou0tet mfeilsla2rln o;u0trxriociodlp rluvol() rumim3oodlltn ici sfa2rr( p;t0aptomi3tydfs emnvpnu4tetoif3ia1op e i i;()seto(mpny1amen nes tfsrumxr ;o1alto f3taslm rlnvo t0 lxriocta1lmteauvi;(0 rur(r iu4ol  lnviat)a2tax oot0tee if3iysfs ulnvonu0 etrmf3oy1optr n o t0 rxoirpio4lmtelnvi s artrurpou4open octlsfm uln sn()teermf oo1la rlivi;t)t2tmim ou1lmtnlneta(fsDua(m no4apen fciysfsDumump;t4arxnxf ootlmDr iei;(0tetoio3iodal elnct tfa2raxmonu4opxo oetadfa ulnmo;(0trtrmo iadlpDranvo s0texmxm3nu1lme mnctas a2umuroou0alxnii3iasfsDea( o;u0 rxoxo oydfa   n sl(0t2xm(mpio4olen ncil(  Dtm(mp;o1aexnmfciat mDul( p u4altrio iy1lpD ln o;s0t2xm(r iy4om e iciasfs2umxrpnu0alxo feilslaDrm(vpn(4trxoif3ia1lmDr nesl( srxr(m3no1ol e ics tfsDtaxmp;o4aet  ociat s uln p (0tlxnxocto1fm  an sl()s2trxm iudole livia( s2uax poo1oex moctad m eanmon(4alxrxfciotlm raivol()trurir oo4altemnct s s2ur( oot4oetoiieiadfm ul( pnu4trxnmociadfpt ln ols)t2xrxm3oydapt mfctl() 2uaxrp;t1alx  oeiatfmDulumo;(4aeeoxf3to1fpDeaues s0teumiopno4ll emicsat) rtau  ;t0aeenifciyt a ua( p t0 renmfctadfaD luvo;s t2toxm3no4ape mnet (fsrtax  ot0oetnmi3tyt mDuan pnu4 rtnmoctytopteln slt srtoimpno1lme mivi (f Dum(mooo1tpxo ictysfaDemn p ()tlenmf3todfmDe nvs (0s2xrirpny4omeemfcs s arrrumpnt4tltnmo3iydlm2eau o t)altniocty1fpt anvi t texoxopiy4ame  fetas) 2rr(r ou4tet  f3iytfa rau snt4tleomrcta1oatrluvs;s0s2umir3iu1llee ncsl(  Dum(moou1aeeo oetytla2eluvonu)alxrmfcia1oaD li s;s teuoir3no1olt  nct t  Duaxmo;u1tpe  ocias sDrl(vo u4tltrxr3iy1lp elu o s) exo(r io4ole mfvtlt)aDtaxrp;u4tpe  iciaslaDeanvpn() exnmfcootfmD ai s;t) 2xo(r3ny4ap  lfeil(fs2ua(rpoo0oleomieils s2raumo;t4 etoif ta1oaDeauei;s)t2umxo iudl
\ No newline at end of file
@@ -0,0 +1 @@
+ivols0 2uoir3oo1ome mieia() rtau  no4opt if3iyslaDrl(mpnu0tlermf3iatlp r neo;( trumxr nu4altelnct ( sDrrx  ot0tlto ieilt aDrmnmon(0texrmr oa1lp r n sl(0 eum(o io4ame lnvs t)aDua(r ot1aleomfeiadlaDra(mo t)artrmo3iodfa rln o;t0t2xo(rpno4al nmies tfa2rm( o;t0tet mfctltfa emn s u4trxnmocoydfpt  u olt s2toir nu1apt  ictlsf 2rrumpoo4oeen feiyd s rmu o;() rxnmrciotfmt  uvi t0 rurxr3oodaptn nesl()arumurp;u4oeenif3iytfsDrl( o ()trxoir3tydfp rli o;(0s2xoxmpnudaltn net sf 2taxmpoo4ole  ictltfm2ua( snt) rxrxf3iotfm eau o;(0 etmirpnudal  mncsls)aDuax pot0tltniiciasfs2rmu snu4trermrciatfaDrlieol(0 euoim oo1lptnlicils) rrmxmpot0aex io3iys s2rl(vo t4 ltoxf3ta1fptranei t0 ruoir3ny4lmee fci sf 2rr(mpno4teto fctydlm2emums;t4tetoir3io1fmDrauvi t s2uoim nydlpe lietatf Dta( o;t0tetoiiciltfa2eaump;()tlerifciytfp eauvs t  2xoim iydll nlfcsa(fsrum( ono0oexo ietlt a2emnvo;u)artrmocta1lpt aies s0t2xrxo3iy4opte netas)a2tm(moou0altomoeiytla em(vpn(4tetnxo3ty1oat li il(0 exoiopoudoptn nvt t aDurx p;t0ale  ociys m em(vo u) renxfctadlmt li i t  rtmxrpoy1amtn ictat  rtmu o;u4altniictldls rm( s;t4aetrxfcoodom e nvo t s2toirpoodop emnetl()srrrx ont0oexo fciaslm emn p u4 rtrio3to1la e nvs s) rtr(mpoy4ame lfct (  ruaumo;o0ape mf3tadla2emu p (0aetnif oytla elieolt)sexrxo oydlmtemfct t)srrrumpou1alx mo3iydla rauvon(0 ltrxf3iy1lm e n il( s2xo(o3iodllenmfcs ()srtrxm no4oex  ociadls2uau s;t4trtrir oo1omD li i s)teur(opoydam nmneslt aDra(mpoo0aex  icilsfsDemuvp u0trtnxf oodlat  i o;s0 exrxr nydom  mnvsa()s2umump;o0tlt moeias sDuau s t4 lxrmo3to1omDeaieo;( seumim3oydal  mnctasfa2rrurpot1opeoiocilt aDra( p;u)aexrmfctatlmDrlieilt setoio iy4opt mnctls s2urumpno4aeeomfetysfm ul(vp u)aeerxr tatlaDe nei s)s2xmir nu1am emnvt t)sDtr(rpoo4texnmfctydfsDul( s u) rermr oa1lmD lnei s0t2tmxm io4optnlivs ()aDuaxrp;o4apenmieilsfa ulums;t0tlxoxf tydfaD lu s ( s2xrirpno4altelicta()a2uaxmo;t4aetnmoetldls2ea(vpnu0trxnxrcoadoa rauesls)srtrir3nu1aleelnci tfartru ont1aeenmictydfs rmnvs;u0 lenio3ootlaDeaivo;( sexoxm3oydam e ieilsfarum(m no1texomfeilslmDrm(vp;u) rtnmrciy1oa elnvo t0s2xrxm iodale  ieta(  2rmuronu4openmf3iatfa emnvo;u)tlenif oytlat  iesl( srtr(r ou4amenlivta()arrm(  ;t1apt mfeiydfa em(mo ()aetnxo tydfptran o;t s2to(opno1lpe  ncia(f Dtrurpnt0apenif3tadls eau p t) reomfcoa1lpt anvsl()s2um(o3nu1lptn ietlsf rtax o;u0tpx ifctysfmDrl(mo;(0 lxnif3iotfm r u o;() euriopiu1op elicta(fsDurxmo;u4olto f3ilt m2rauvp (4 ltnmf iy1lm raieo;s0 rurim3nydlpenmfetasf 2umurpoo1tlxnif3iltla rm( o;u0 lxnir3iydfateaiei s0seumiopny4op e fvilsf rrrur ;u4apenmictad mDrmuvo t4 exrir3oy1fpDranvi;s s2tm(o ny4om emnvsas)aDraumpoo1aee  ietaslaDemu snu0teerio3totfaD lnvi;(  2uoimpiu4llte nvi t  rrm( o;o0oet mf3tyd s uln o;u0aetnircoatlp raueils texoxr oodll elneta(f rtr(m ;u1oee moetytlmDemu o (4 ltrxr3to1fp ean i;s)srtoio3nodomeemivt () rur(  ot4alenii3iytfaDua(vp;t0aexnxo3io1lp eauvils) exmxm3nu1ap nlfetltf Duauroot4oet if3tad a raums t4arxrmr3io1opDelnvils0 2xoirpiy1aptemfct t) 2rm(  oo0tet ioeiatfaDrau s;t4altnxo ta1lm elu s;s0 etoxrpnudal elfvs t)sDur(rp;o0oltoioctlslm2em( o u0trxnmr3ty1fm rauvs;(0t2umim nu4apte iesls sDtrxmooo1apeo oetatfs2rl(mp t0texnmr3iodomDr iesl(0s2urxmpoodlme lnvi t aDtr(rpou4oetomietys m2eauvp;t)artrif oadfpDrli o t)truoxrpiodaltnmiviat)sDum( oou4alx  fcildfm2umnvp (4trtoif3oa1omD au ilt s2uoxm iydll   fvi (  Dur( p;t0aetn oeiltls2ua(vo;t)artnmfctatlpDe ies s sruo(o no1omeelnvtlt a2tmx  ;o4apt  fetasfaDuluvsn(4 rtoio3tydlp  li s s)srumiopoodamtnlfet ()sruaum oo4tpxoiociatls rm( sn(0aetoxo3iatlpDelnvo;s0texrxopiy1omtnlfvi ( s2rmxr no4olx  ociadfa2uanvonu4texrir ta1lpteaiei t  exmxo oy4opee net tfaDurxm ou4oltn f3tysfaDul(vp u)tlxoxo3oydfm eauvi;t trtr(r iy1am elivsls)sDraur oo1oet ii3iatla ean snu4aetnxfctytfmt li s t) eumirpny4omee nei s) 2ur( pot1tex  ieilsfsDranmo;()arxoir io1faDeln s ( t2xoxopoy1op n fviasfarta(mo;t4olx if3iasfa ul(mo;(4teenmr3tydop  lnvolt0srtr(opnydlmt lietat aDrmump;o0optnio3tadlm2el( snu4tlenifcoydfaDeaivi ( t2tr(m3nydlp n fcias) Dumuro;u4opxnmfeiltlaDel(vp t)artriocoydfm elivs ()srurxo nodoltn fet (fs2uax ooo0texomieiasfs elnmp;t4tlxrxrcoa1opDeanvils0texoiopiudllt mfcil( s2urxmpnt1tpx moctysfs2emnvp (4trerxr tadlmt auvsls0tetoxo ny4ap emnes sfaDtmurpnu1olt mo3iltls2emnvpnu0arermr oodfa   ies s0texoxo3no1amtnmfvilt)a2rrump;o4aptoioctlsfsDrlumpnu4 lxoxrcootoateln sl( s2xr(o3nu1lltemivt ( sDrruro;o1optomoetatls rmn s;(0aexrio3to1omtr nes;s) 2toxm ny1om emivtat)aDuaumpoo4tlt mfctatla2rmnmo;(0 ltrmo3oadlm  lnei;s)trto(opnu4lm  lfesl(faDrrxr ;u4aexoii3iatls ua(vs;(0 rxoio iytom  lu i (0t2to(rpoo1altemivsltfs2ra(ronu1texn oeilt s2ea(vp ()aeenxr3oy1omtrau s;(0trxr(mpoo1lme mneslt) Drau ooo1alxniociytlsDum(ms u4tetomf iotlaDran o s0srtoimpiu4optn fvil( srurxm ;o0ale mi3iat m2ranvo t4aexrmrciatop e u i;t0trumxopiy4ap nlivt tfartm( p;t1aetoifeiat m2uan snu0tlxnmo tytfmDrauvi t t2xmxm3iodapee fviatf Dur(rp;u4tpxo ociysfsDrmuvs u4 eeoif3iy1opDe uvo ( s2xo(m iu4lm nlieil() rtaxm ;t4alxnmo3iasla ranmont)alerxf3iytomDr nvs ()t2trxr3no1ap  mici ( aDtrum ot0oetnmociatlm umumo;t4aexrioctodfpteln sl() 2xrxr iy4lpeemietatfa2rm(rpou0aleoii3tyt sDrlnms;u0 ltnxfctatlateln sls0 2tr(o3io1aleemivta( a2taumo;o4aleoiociadfaDumumont0altomocio1oat  uei t)t2xr(o3nu4lp nmicsl(f rurump;t4aee  ictad m2rm( ont4trtomo tydlmDrlu o ()seto(rpiy4olt  fesl( srtmxmp;o4ape moeias m rmn o;t4 exnxr ty1fm e i s ()trum(r3iu4om nmivtltfarurumonu1aex  i3iytfa em(mon()texoxocoytfpD anvslt t2uoxr3nydomeemnvia()srrau o;t4aet mi3iytfs2ea(vo t) rermr3oatomD au ols)seuo(o3nodlm nlfci tf Dra(  ;t1aleo f3tadlmDel(ms u) reomo3iatfp rai s t) etoiopou4amee fcils artrxmp;t0aex mfctyslaDua(vs (4 rermr tatom r ivo ()srto(m iydop  mnct t arua( oot1alxomoctasfs2el(vp;t4tetnxociytfptrlivol(0srtrim oydlm elfvtas) rrrumpoo4aex  o3ildls2ulums u)texrif3iotlmD  uvi s0 rto(r nydam nmiesas  Dumum nu1tet mf3tldlm2el( pnt)teenmo3to1om elivs;t0s2um(m3io1ameemiesasfsrtm(mp;t0tle ifetltfs uan snu4aetomf3iatlp e u s s0 exrxo3oydamenlici t) Drmurpnt0ole micilsfaDuaumpnt4trenif oatfpDeanes;t)trumim3io4ame lictlt a2ur(  nt1aet  o3iltfs elnvo;u) etnxo iy1latrli o;t tetr(m3oodaptnmnet t)a2trump;u4tlt mietltlsDem(mo;() ltniocoa1fm rlnvo (0sexoxo iy1amtnlivt t s2uau p;u1oltoiietytls2rlnmp;(4arenio3ta1opDean o ( t2uo(rpiu4ape mnetas)s2umurpnt1ale if3iadfmDrmn sn(0 ltnmf3iy1fpD  ues;(0s2tr(o no4al   nvtltf 2ta(root4oetnmoctatlmDea( s;t4arenio3iytoatrauvi;t0 rxmxopnudoptelnesls)sruau pnu4oltn octatlsDulnvp u4 ltoxrciy1lpDrau slt  2xrxo io4omt lfet t)artrx ono0aleoifeiydfm ra(mpnu)tetnif3oatomt  neol() rxrxr nudol  mnci t sDta(ront1tlt if3iadfa2ulu snt)aetrxocoydfateli i s)s2urxr ny4oltemicsas)sDrmur oo0apxn o3iyslm2el(vp t0arerxo3tadlmDelu sl(0trxoir3iy4ome  fvsas arraump;t1optoii3iltlm eaums;u0 ltnir oadlmteauvo;t)s2urxrpoydlpt mncs ()s2ta(r ;o1optoif3tytfsDem(mo;(4tetrir3iytlmDeaivsl(0seuoxopiy1om  mivilt)s2tru pnt1alt moctyd a2rm(vs t0 etoifciy1fm elivi s  2umimpoydam nmfci t)arum(r ot0tetnmi3tasfs ua(vs (0trtniocoydom   i i t0trxrim3oudaltemfvsas) rtau pou1tpenio3tytfm ea( on(4aleoxo oy1lmDe ivi;()t2xoio3iodomte ivi t sDra(rpot4tpxoioetydlsDelu snu0tltnmo todfaDeai s;t sruoio3iu4amenmici ( srraxmo;u1tpx  f3iat sDeanvs ()trxnxo tytlm r uvslt)sexrir3iodopeemicilt s2taxrpnu4olx iiciltfs2rmuvp (4texrmf iatom  an i;t s2um(o no4omte fctas a2tauroou0opeo f3iatlm2elnmo u0aexomf3todlmDr uvi;s srto(mpoo4lmtelfcils) Dtm( oou4aptn ociyt a ua( s;u0 ltoxf3oadla rlivo (0s2urxo3ny4lmt mfctatfartruroou4tex  feiyslm el( sn(4 ltrif iodoaDeau ils  2toxm3oydomte ict (fa2ta(r ou1opt if3iat mDraums;t4aleoxocta1fa eluvs;s0s2tmir iydll  livt s aDumxm ;u4ole  fetysfs2uluvont0texomf iodopte ues;s0setr(r3io4apen nviat)aDra(mooo4oleo iciyd mDel(vo;t4 leniocta1optr i sls tetrimpoy4opeelncsa(fa2uaurpno1tle  ieild m2raumpnt)trtrxr iotfm  liei t srumim io4amtnmfctls s2trump;t1oee iietyd s2emn o;(4 ltrif3iy1fmDean s t tetm(r ou4lpt lfesls)srtaxmo;t1aptoifcilt m eau s;t0altomo3iadlaD aieolt) rxoxm ou1lptn ivs s srtmuront0tltomo3tytfa ranvpn(4 reomf tatfmD aiesl(0 2xo(rpiu4ope  ivsltfa2ua( pou0oex  icias sDran pnt0tlxrioctadom   n sl(0s2toxmpnydap emnvtas  2trx oou1tpx ioetlsfa umump;t4trermrctatom e uvsl() 2tmimpnydoleelivtlsfa2ua( ont4aeto oetasfs ran o u4tetnir tydla  aivils s2urxr3ou4lmt  icsl( artmxrpoo0optn fetad s rl(vpn(0aexomr3ia1lpDelivsls)texr(o3oudal emneslt)a2uax  ou4opxnif3tldla2el(msnt4teenio3to1oaDr i ols0setoxo nydlpt  ietls)srrmur ot4teenmictltfs ranmpnt0arerircoytfmD aneslt)seurirpiodamenlfvilt s2rru pot0opxniietltls2ua(vonu)tleoir3oytfm e n sl(0teumir3oo1ll n fctltf Duauront4tpx io3iytls elnvsnt)alxnioctytfmDelues;t) 2xrim nodalenmfvt sfarrmurp;t4ole iociydlm uln s;(0 leoxf3ty1lat  n i;()seumimpou1lmt mfeslsf 2uaump;o0tee  ietydfa2ua( o (0 lxnirciydopte i s;(0teuoxmpno4apt  ncilsfsDrmxm ou1opt  i3tatfs eaumsn() eeomfcootoat ln il() 2tmir3nydamt lieils  2umu oou1tlen octasla2ua( pnu4trtnxoctadlpt livi;(0setmxrpoo1lmtemfcil(fa2urur oo0tpx mfeilsfa2eluvo (4tetrxr3oydfa rluvi;t0texmio no4omt lncsa(fa2rrxr ;t0aptn o3iaslmDem( o;()aetrirctatfaD anesls0s2trir oo4al nlnes (  Durxmo;o1tltn f3tldls uauvont)alxomo io1lm  lueils)t2uo(m oodllte fcsas)aDtaxrp;u0apxomfeias m2elnvonu) etomociatop   ieolt)s2trim oy1al  mnvtl(f Dtm(  ;u4apxnio3tydfa rm(vo t0 leomocoadlp  aueo;t s2tr(m nodlptnmivias a2uau pou0tee mf3iltfs2um(vonu0tetoxf totopt lneols0 rxmxr3iydam nmnctl()srtm(mo;t1aet  o3tysla2emnmp () leomo3tatfmDraivs;t t2urxm ou1ope lncils  rumurpnt4tpe mieiltlsDrlnvsnu)aexnmf oatfmte ivi;()trurxopnu4ame lfesas) 2um( o;u0tpeomictld a rmu p u0altomo3oodfm eaiei (0srtrxm nu1aptnlnvia()s2raxmonu4oet mfeiysfm em(vpnu4tlxrxo oy1fp r nes s0srtoxopnu4alen nci s  Draxm ;t1tlen f3ildlaDra( o;t)artoif iydopDelnvs;(0teuoxr nodopen iei ( arrrumoot1aleoiietldlaDelnmsnt0 rerxfctadlmDelivs;s truo(mpnudoleemnvt sfsrumxrpnu0aeeoifciyt a rlnmo (4alxoif3iodom e n
\ No newline at end of file
@@ -0,0 +1 @@
+neo (0srumxrpny4altemivsa()srtmur no0alto ietldfmDeauvs;t0tlxrirciodlm  lneolt) rtoio3oy4op nmivs (fsrurur ot4tlto octldfsDrmuvpnu) rxoxo3ta1oaD an ils  2toxo3ny1ol  mfcsa()arrm(mp;u0aexo fcildfaDemnvs (0aeeoxo3oy1om r i o t  2uoio nu1lm emfvsls)srrrxroot4oexoifciydfa elumo;(4aexrmo oatomtraueolt0texrimpiu4ap n fvsl() 2rrumo;o4aetoioetldla elnvonu4alxnxo tydfmDeai i s0srumir ou1ame mivslt) 2trumonu0tlto o3ildlm2ul(mp;t0 lerif oydfm eluvils0trxoxo iudlle  neias  rtrx ont1tex moetls mDra(vp;(0alxrxrciodla  lies t0t2xr(r no1ome  fvi sfaruaxr nt1olto oeiltfsDel(mpn(4areoif3iytomteanvslt)setrxo iudlpt livta(fs2ta(  nu4oee moetadlmDran p t0tleomfciatopDe n il(  2toxo3iodamt mnct s) rrr(m ;t0aleo feiysla uluvs u) exrif3ta1opt ln s;t)t2xr(mpny1om emfvias) 2tm(monu4tpeomoetldla rmu pnt0aetrio iodoateaneo;s)t2trxo ny4lltemivsas  2rax ooo1tpenmociatfaDuanvs;t0trtoircoadomtr ivilt)srxm(rpoudlmt lfvs sfs2tr( pou1tee  f3iadlm rmn p;u) lxrmfcoydfate iei;(0srxmio3io1olen ivslsfartm(m nt4aexn oeiydfm ra(vs;u4aeerxocoa1lm r n i;s setoir3iydamtelncs ( a2rrumpnt4olx  fctldfs uauvp;u)texrio oodoatr iei (0 rtoxopio4apte neias  rurxm nu0aetnifetyd mDeanms;()aleoxrcty1oatran i ()t2tmxr iydal  mivt t) 2uaumooo1oltnmfeiydfs2ea(vsn(4aleoxr3io1lm  ln ols srtoxmpoodlmenmnesat artrxronu4opeoif3ilsla2ua( pnt4 ltoxo oa1oatelnvi ( seur(m ny1lmen nvtl()srtrump;t4tetn ieiatla uan o u0tetoir3oa1fmtranvo;t teuo(r nydaptnmies s) rrrxmpoo1aptn f3tytfm umnms;t0altoxf ootlateli o;( s2tr(m3io4aleelnctlt)sDuaxrp;o0tle ifeilsfs ua( s;u0trtomr3tytlpDranei;(0t2xmirpnudol  livi sfartax  no4aetnii3iadla2ranmonu)aetnxr oydlmt  iei;(0 rxr(m nudap n nct t sDrr(mpno4tlx mi3iltfs2uan s (0 rtrxfcto1fpD  ueolt0 2umir3oudole livil()s2rm( pno4opxo fetlsfsDem(vp;(4aetoifcoy1faDr ivs;s)t2trim3io1oltnlnctl()artmx  ;t0tlt ifeilsfa2ulu snu)aeerxo3tatfa  luvilt)trur(o iodolt  ivsls)a2ra(ront4oet mieiytfsDumnms;() exnxr oytfm eanvo;t0t2xoxmpny4lp e fesl(  2tax  oo4teeoioetadfa ulump u0arermr oa1lm r i slt) eur(o3iy4olen icta( srua(  ou0tee  oeiyslmDeauvont0 renirciadfa eauvils setr(o3io4om nmfcsa(fsDum(r ou4apt  o3ildfs2ul(vont4tlxrmo3iatop   ueils) exo(o3no4ale miesls  rraxmo;o4alt mf3tadfaDum(msnu) exoio iadfatrliei t)teuoim3iodlmtnmnei s)aDra( o;o1apto ictlsla2em( s t0 eermo oa1optrai o;( setm(o3ny4aptn nvilsfartmxmont1altnmf3iydla rmnmo;u) lxnmoctytfpD lueils0srum(r iy1openmnctl( s2urx p;u4optnmo3iydfm2emu on()alxrxr oadfpt lu sl()s2uoxm3ou4alenmnei t s2urxmpou4tptoiietatlmDra(mp (0 lenxf3iadomtrln o t0s2um(m iudapt  ieslt) rrrx o;t1texo feias s2el(mpnt0tlxriocta1fmDr uvi t0t2triopiy4apeemnvil()sruax pou4opto ociat s raums u0 eeomfciadlmt lnvs;s0 exoirpno1ape mncia(f 2tau o;u1aex  ietadls2el(vo (0 ltomrcoa1la r ivs s0srtrim no4om e icslsf 2rmxrpnt0aptnioetyt mDelnvo;u0 lxrxr tytlp e nvs;s0s2ur(o3nu4op nmneilt  Drmxm ;u1ole ii3tadlaDeanvp;t0 renir3ty1lpD aivo;s)sexr(m iu4altnlnvsl(faruru o;t1apx  i3iyd s ran s;u4alermo3ty1la  an i ( t2trim iydapt  fct tfs2rmurpno4apxnmietasfm2uauvo;() reomocoatfa eln i;s setm(m3nu4ale livil(fa2trx  ;u1apeomoeiysfa umumo;()tetoxo3oatoa elu o;s)t2trirpio1lle  iei tf rumxrpou0tpto iciad m2ra( on(0 rtnxr3oatlmteaiesls s2umxopiudopt  nvslt)s2umx o;u4texo ocilt a umn p u0aeenxocoadlp  livo;t s2urio iy4llt lnei (fsDrrurpnt4oee ii3tydlm2elnvp (0altoiocoodfmDeauvols0 euo(m iu1lpen fctl()artaxroot4olxo ietldfmDranms;t4texoxr3tadfate nes (0sexo(rpiu1am n ieslt  Draxrpno0oetn ocild m2uln p (0areniocoytlptrau s t)sexmxo3ou4op n ivi tf 2ua(m nu4ope mo3ils sDrm(mo (4 reomo3totfp rauvi ( seumxmpiu4lmt mfct t sDrau ono4aetnmieiydlmDumuvp u) ltnmrcto1la r n ilt s2xrimpiy4amtn fctlsfaDumxronu1tex if3iytls2um(mp;u4aetomf to1fmt  u i s0 exoio3nu1aleelieta( s2umur ou4tlx mf3iyd s2elu ont)aeermr3tytfa eai o;t texmxmpoo4llenmfct s)s2tmxront0aetomoctldlaDrluvs (4 rxrircoatfa rlivsl() rtm(m3oo4amenmics t arumxrooo4texnmfciadls2ul( on(4aeenmf3tatoat au o;s)srtrxo3ou4al nlfci ()artax  ;o1tex ifcias m uanmont4trenxrcia1fp   uvi ( sruoxr io1al elics s a2tmx  nt1ale  ieiysls2ean pnt4arxnxr io1omtelueo;t) euoiopno1lmeelictatf rua(rono4apxoio3iysfaDea( s;t)aleoir iytfmtrluesl(0seum(rpnudlm nmncils)s2rmxr ot4open o3iysfm rmu p;() etnmfctydoaDrlies t0 rxo(mpiy1lle mnesa()s2rau p;o0tpxoiietad sDua(msnu4 rxomf3io1omt lnvs s0sexmxr no1oleemnvtat) Dtmxm ;u0oeeo o3ilsfaDulu o t4aeerxo todfpt  neilt0srxmiopiy1lpt lieiatfsDumxmpoo4tpxomf3ils sDumums t4 rxomocootoatrlnes;(0s2toxm3nodamenlnvtl(  rtau ono4tet io3ilsla ea(vp u0alerif ia1lm   u s;s)s2ur(m3oodam  lneilt srtmurpnu1oexo o3iydfa2umumsn(0 etomfctytfatraneo ()s2uoiopoo4lpt  fvt ( aDta(mp;u1tpx if3ilt a ulnvs;(4 etrio oytfaDrluvo;t)sruoio3oudomtemiciat  2uaumpot0apx moctys sDra( p t4aexnxocia1late nesl()teuoir3oudop nlfeil(  2raur no4oeto fciydls um(mo;u0tetoio tydoaD li s;s) exoxm iu1apeelnct () 2um(ronu4apt  fciydlaDeanvp;t4altrmo3tatlaDr neo;s0texr(r3ny1lm elnvsa(  2rrx  nt1tlt  f3tat m2ean onu4treoir3iodfat auei;s)trxoirpno4omenlncsl() rtau onu4aeeomo3iasls um(mp;t0tetrxr oatfp ranei;t tetrir no4lpt mivsl() 2rm(r ;o1olxoifcilslm2uau o;u0treoir totoa   nvolt0 rtm(m3iy1om n ivtas)s2ur(m oo4oeenmieils sDel( o u)altoxfciytlat  ivil(0srtoim oy4op  lfvt t s2umxrono4ale  f3tltfmDul(vs (4 lermocoy1optrlneo t) 2xr(opoodam nlivslsfaDum( ono4opxnioctys mDrm(vp u)tlermo3oytlat  nvo;t0 exoim nu4lptelncs ()a2ra(r nt4tltnioctat a2eanmon(0texrir iadlaD lneils teurxm oo1ll nlfei t)a2umur ;o4oex mo3ildfm rl(vonu0arxoxrciytopDrlivi;s  ruoxopnydoptnlfcsat arrrum ot0aexn f3iltfs rauvpnt0texrirciodfm   ieolt0sexm(o3no1al   fvsa()a2rr(monu0tptomocils s ran p t) ltoioctadoat luei s)setoir iu1olt  fviasf Drm(m nt1alt moetlt a uau snt4tlxoifctadopD livol( s2um(o no1lp  lfvtls aruaurpnt1alenmfcils a2rlnmpnu0aetoxfctytomt anei;s0sruoxmpny1alenlicil( srumxr ot0aptoiiciysfaDul(vo;u)trxoxf tadfa e n ols)truoirpoodaleemfes sfsrur(r ot0oleomfetadlm2emums;u) lxnif3iytoa e n i;s) rxm(rpoydaltelfvsl(farta(mpno1ole ii3tys m uanvp;t)altrif iydoatr uvi t0srum(o3no4opeemneil( aDurx onu0tleomieiyt sDua( s t) lxoio3tatomDrluvo t srxr(r3no4lme licsls) 2uau pnu4texn i3ildlm el(vp t)teerif oadlpD ai i s)trxmxmpiu1am e ieilt arrm(  nt0oex miciad aDrm(mo;u4altrifcio1fa rli o;() etm(mpiodamtn fvia() rtmu  nu1aeto ietltlm uanvp (4aeeoirctadfmDelnei (  2trxm3nodopt mfciasfartrurooo4tlxo ietlslm um(mo;t)aexoxo oodom rln ilt t2xr(rpiydolte ncsasfsDrrx  no0tpxo f3iys aDemumo u4tltoir iytlaDeaneslt0 2tr(r3iu4ol nmnct s a2trx pot1opx mf3iyt mDua(vo u) ltnxr io1lmt an i s0 2xriopiy4ol nmieiasf 2rmum nu0opto fciasla uauvo;t) exomr ia1lp  ai s s s2uo(r nodale mnvtl(f 2rru pnt4oee iieildfa2umn s t0tltrmo3io1lmt ln ols0trtrxr ny1apeemnctas) rum(moot0ape  ociytfa2um(vs t0trxoir3oy1fmDelnei;t) rum(r3ou4ol  lnes t)s2trxm ou1opx  fctas m ua(ms ()trxnxf3iodom  aivo;( t2xriopou1llt  netat)srrrumoou0teen i3ias m el(mp;(4 leoxf iytomt aueil( texo(o iy1omt  fesl()a2umuroot1teeomoetas m2rmn p u0tlxrxr tatlatr uvo s) etrir3iudomtnlivtatf rtrur ;t1olen feiydfa ulu o;t)altoirctydfmDeauvo ()t2tm(mpnu1oltn fvslsfartr(m ;t4ale mf3iad mDumnmo;(4 leoxo3oytoa eaivi;s0trxo(r3nu1lpe micilsfartax  ;u4ope mi3tltfa uanvon(0alxrmocootfpt ln i;s0 2xoiopny1lm  mfvt tf rrm( p;t4apxn f3tytfmDulu snu) lerio iytfa  aivsl( s2trim3ou4lp nmfes tf Dtau pno4alenio3iydls2eanmo;(4tltnir3oytop elivo;s0s2xrio oy1oltn nvias) 2umurp;t1olt mfetatfmDrl( o (0altnio tytoaDr i il( s2urxm3iy4lm emnct (f 2tax pno4tet iiciysfa rluvo u)tetrxfctodfmDeau ols) 2tm(m iudolenlivt tf rra(rono1alx ioeiasfs2rm( o;(4 ltnircoytlpDeaues t setoim nodope  icia(fsDrrxronu0tlt  f3iatfm2rm(vont0aleomocoy1lp  aieolt s2umxo iu1amee ieilsfaDtaum ot1tex  fctyslm umn p (4tltomfcoo1op  lneo s trxo(m3nu4alen neiasfsrumxm ;t1aeeo i3iadlsDeln o;t0altriocoatoptr u slt)trtoiopiydopeemnet (fa2taxrpoo1alxoifcild aDulnvs u)tlermf tytlptr ivols  2uo(r nu1omen neils)srtmuronu1oex  i3iadls2uan pn(4trxnmo3tytoat aiei s) ruoir3iy1ame mfes s  2raxmpot1oetnmfeilslm rmnvo t0tlxoxfcoatop   nei;()setrxm3nydll emnet sfsrrrumo;o1alxnio3iytlmDeaums;() eerxo3ta1op e ivo s0 ruoirpoo1llt lnvilsf Dtrxrpou0ope miciadls2ua(mon(4aetniociy1laD aieils sruoio nudomt  ncslsfsrtmxmpou4altnmociaslmDea(vont4 exrmf3tydlp  livo s)srurio3oy1olenlfvi sfa2um(rp;u0tle mfeiys m rl(mpnt)texrifctotla  auvslt0texmiopiudaltemiciltf Durxro;t0teto oeiyt a2umump;t4 exomfciatfa eanvo;s) rxmxo oy4lm nmncsls s2raum nu0tex mo3iat s2ulnvs;u) rtnmr3ty1op raivslt0s2xo(rpoydamen fes tfsrrm(r ot0tpenmo3tytlm rlnvs u)areoif3oatom eln ols0seurirpoudlme  fci sf Dta(  ot1tlxo ieilslmDrau pnt4alermf to1fp r n i;()trtr(m3oy4ap elfvs tf 2tm(mp;t4olxn ictas aDean pnu0teeniocia1oaD auvo;( s2tmxo ny1apenlfcsasfsDtau pot1aet mociytla2umums;t0trtnirciydfmt auvs (  2xoir3nu1open nci t srraxmoou4tee moctlt s2ua(vs t4tleoxo ia1fatelieo s s2xoio nu4omt  ivs () rrm(rono0olx moeiydlm uln o;(0 rtrxo3ootfa rluvol(  2toio nydap nlivt s  2tmur no0tlenioeiytfaDel(vs u0alxrxr3totfaDranvi;s) 2xoxm3nudamtelfeia() 2umumo;u4teto oetad sDrm(vp t)tlxnmfciotfa eauvs t)trxr(m3iy1lleelncs (farum(rp;u4tlx io3tat m2rln snu)artrir iy1opDelnvil(  eurir3oodopen nesas  2tmu onu4tpx  fetadfsDran pnt)artrif oatlpteaivo ( t2xm(m io4aptemneil()srrmu  ;o0aetnmoeilsfm um( onu0 rxoir3oydopD  nes ()t2tm(o3iu4lltn icsa(fa2ua(mp;o0optomfeildfa rau o t) lxomrcoatop r i i;t)trtmxmpiy4altn nes ()a2tr(r ;t4altnmi3iltlm2ulnvo u)alxoxrcootlpteau ols srum(rpnodomeemict s)aDra(ronu1aet  o3tltla ua(mon(4artomociydfpt  i i;s s2xrxrpio4ol  mnesat a2tmx  ou0tetnifciasfa ran p u4 etoir3iytlatr ies;s)s2xrxrpou1amtnmneia( aDtm(r ;u0alxn fcilt m ea( p;t0teenmo3todlmDe u o;t)s2xr(opio1omtn netls sDra(m ;o1aeeo fciydfmDul(vsn(0teenir iotoaDr uvs;t)tetmim3oydap   neias sDraumooo4alx  ieiltlm em( s;u)treoio3ia1fmtr i i;(0trtmir3iudop e fcsa(f rtmx o;u4teto octlt m ul( o () etnxocia1fp raieol( trxm(rpoy4lmte fet ( aDta( pot0tet  fciasfa ul( s;(0aetoxf3oa1opD an slt)teuoxm nodap e fvsls) rtaum nu0opxoio3iasfs uln p;t) exrircoytlpte ieo s0 rtmim3ou1lmen ivs (fs2ur(m ot1tpt iiciysfsDua( pnt0arenioctytlpDeaivilt setoxm3ny4olt mieslsfa2ta(m ou0oexn oetad m ulnvs t4tlxniocta1fpD au o () exoimpoodape lnctlt)srrr(mo;t1tex iietytla2em(vp;() exrir3oo1omtrlieil( srum(opnudlpee fesas)s2raxmo;t1oexo ietytlsDrmu o;u0 ltomr totfm raueol() 2tmxr3oydomt  nei s) ruaumpnt4aee io3iadlm ra(ms t)texrmociadfmteauvi;s srtrxo iydlmtnmnesa() rrr(mo;o1alx io3iydls2emnvs (0 ltnifcty1oatr n i ()tetr(mpny1llenlivtltf 2rmu ono0tex mf3iytlaDrmnmpnt0tltnir3ty1la   uvs;s0trurxo3iudllt mnci t artaxm ;u0olxoio3tatfs2uaumo;(0 exoircoatfmt lneo;t0trum(m io1amtn ncta( sDtrum no0oetnif3tlsfaDeln onu) rxrmr3ta1lp r i o s sexriopoy4opeelfvil(  Dumxrpnt1texnmf3iyslmDem(mo t0altoif totopDeluei (  2to(r no4amt mfctlt srrmxro;o4oltnif3iaslaDul( pnu0tltrxf3oadlm  an s;(  exmxr3iydomt mfesl()a2uax o;t1ope mociadlsDul( s;t)texrxo3iydopteanvsls0srurirpoodlm   ncsl(fsrtrumpnt1aetoio3ilslsDem(mpnt0aexnircta1la   neils)sruoxrpiy4ol nlici ( arrr(mooo4olt  ietasfaDeluvs t0teeomo3iytomDrau s s0 rto(m3oydll n fei sfsrta(root4oeeo octasls emnmpnu4aexrioctotom   ies;() eto(r3oo4apee fei t  Drmxroot0opx iiciydfs2emnvp (4aexrxr totom r neolt)teumxo iu1lp  lfvil(fa2ta(mpou0apxn feiasfmDrln p;u) rtrif3oytlaDeluei s srto(m oy4optn fci ( aDurx  no0ale ioeiltlmDran o;u) lxoxo oa1lmteliei s0trurim oo4lleelfcs (  2rrxront0tle  f3tadfaDrl(mp;u0tlxrxrciydfpDeau ils sexr(r3ny1amtnlfeias) rtrumoou4apto ieiytls2umu s;(0teenmr3totlmD  nvolt0trtmxo3iu1al  lncta(  rtr(m ot4apt ifetld m ra(vpnt0trerxfciadlmtean olt) exmxm iy4lpeelnvt (  2rmum nu0tpenmfctyt s emu snu4alermfcto1opDr n o s0t2tmxr nudal eliesatfaDraxmpot1tpt moeias aDel(vsnt)artnxo3iotlatrlnvi;s)srxo(r ou4lmen nvsls  2rmxm ou4alen o3iyd s rluvpnt0 rtoxfciy1omDr u i;t) 2um(mpiudopt mfetl( a2rm( p;o0aeto ictatlm2emu s u4aexnmr ty1laDeanvs;s)sexm(mpoy1om n ncilt)s2rrxr ;t4aetnio3iydfa2eluvont4arxnmrciodoatelivs t trtoim iudome  fes t) 2umxmonu0tlen feiadls2rmu pn()trxoir oadom r ueslt trtm(m oo4optn fet (fa2rm(mpou4tetnioeildls2uau p u0 rxnmo oydlpt ln sl(  2uoxr3iodap emnetltfsrtau o;u1altoii3tadlaDemnms;t)tltoircta1opDrln o (0seuo(o3ny4ap  mivil(f rra(mpou0opxomo3tytfs ea(mp;(0teeoiociodlptr ivs;t) rxrxopio4lp emfes t)sDrr( o;t4ape ifcildfmDulu ont4arerxf oo1fptelieo t0srumxrpoy1ame mfetlt  rumur nu4apto o3tydls rmnms;u4altomrctatopDeai il( sexoirpoodoptnmnciltf Dtmxm nu0aptomf3ilt m2ulumont) lxomfcio1lpD aieo t) rtrio iu4ope mivtas srrmxmp;o1tpeoifetytfm ua(vs;u)aetrir3ia1opteaivs s texm(o3iy1lpe mnetl(faDtrxmo;t0optoioeiydla ea(mp;(4arxrmr tydfatr iei s0srxoxopny1olte fesltfs2trxmoou1oex mfetltfs em(vpnu)tlxrio ty1oatr i i s0 rtr(o3oo4ol nmfvsls sDrau onu1alxoiiciltfm umu p;(0 etrmrctytla rlueolt0 rumir3iudamenlnctls)sDrauroou4tetn ieilsls2um(vs u)tlxrio ia1la eaneslt)srxoxo oodoptn fvs s a2trxr nu4apxomi3iasfm rmn s u0tltoir iatlmte nvol( teto(rpio1llen nei s) rrrxmo;o0tpe  fctldls2rau onu) lerir oo1faDr uvo () exrxr ou4am n ncsl() rtrxm nu4tet  fcils a emnvo;t0teenioctotoptelnei s setoir ou1al nliesa( sDtm(rpou4tltoiictldlsDul( ont0aetnmo3oo1fmD ln s;t) exrir3oy4ol n nei ( srurxr nu0tlxn ieiysfaDumumsn()tlenxfcoadfptran i t0seumxo oo4ole mivt tf rtmumo;o4oexnmf3iatfs2emuvs () ltoifctotlp e ies;() 2xr(r ny4llen iesl(  Drr(  nu0ope ii3ildfs em( p;(0trxnmocoo1omtranvi;s)s2trio3iy4lmee nvtlsfsrrau  nu4apxo oeiltfa rln o;(0 eeomr iodlmDe u i;t) etmiopoudamee fvsls  rrrur ;u0aex mf3tlt a uau p u0tleoir iotlmt au slt)t2xrir3io1lm n fcsas)s2ra(monu1apxoifeiad sDum( pnt4tlerir iydfa  anvil()t2trim nu1amtemfcsls s2um(mpoo1tetnmfeiatfa2rmnmpnt4aeermfctytfmD  nes;s t2tr(r3iydalen fvi t)s2trxrpnt1tee  fetas s rluvo;(4 leoxrctodlatrln sl() etmxmpiodlmt mnct tf rtmxront4apen i3tasls eluvp (4arxnxoctytlptrli il( s2trxopio1omtnlictlt srurur ot4alenifeiadfs emumo t0alxomr iotla rln ils0 2ur(mpnudole mncsls arum(ront1tpe mocils sDem(mpnu4tlenmf tydoaD  u s;t sexm(o3ny1lltelfet tfa2uax o;t1tleo ocilsla rlu o (0teenif3ia1lp  livs t sruoim3nu1opt lncsas a2ta(rooo4opxoifeiadfa rlums;u0arxnmr3oa1optr nvsl()teuoim ny4apenmnct ( a2ur(  ou1oeto f3tltlm2em( s t4tlerifctotfpDeauvo t0 2xoxrpno4lpenmnesa( a2urxmpot0apxo oeilsfmDrlu on(0tlenxf3iotlp rauvilt0setoir3iy1lmtnmicta(f 2tmurpno0teto ieilsfm2em(mo t4 rxnmrcty1lm elivo;s0srumxm oy1om  mfcs ( arur( pnt4oexnioetltlmDumnmpnu0alermf3iadopt ai ol(0setoxrpiodapen icslsf 2trxmont1aleo ictad a2umu sn(4altrmr iotopD an i () 2xmiopiy4lleelivsas)sDtm(monu4oexn ieiaslsDrm(ms;()alxrir3iydomtranvi;s s2tm(m ou1al   fetlt  Dtrxr ;t4tltn feiyd aDuau s;u0artoif oydopDeluvi;s0sexoirpnu1lp nmivsa()sDrm(m nu4apxn oetysls2uan s (4tltnif3iodfmt luvols0setoxrpnydlm  lnetl(  Drmu pnu0olt micilsfsDrlnvont4altoif oo1lpDeanvols srum(opoudlm nlnci (  Drm(  ;o0opeo oeiysfaDuln o t)aetrxfciydlpDelieo;t0teurio ny4lmtelici t sDrru o;t0optn i3ilsfm rmumsnu0arerio3oodomt  u o t0 exrir oydomee fcsat  2ururont1oltnmo3ils s rmuvpnu)artrxrctadfa rlnvi;s0s2tmxmpno4lpe mncia( s2tmx p;t1tptomoetld aDelnmsnu)arxnxo3oo1omD lnvi;t0t2to(o oudalte fei t srumu pot1texn octlsfa ranmp;(4trenxfcoytoat  ieo;() 2tmimpiu4am e nvs t aDrr(m ot1oet iietad s uau pnt4arerio iydfp eanvi s t2toimpnudom   fesatfa2uau pnu1alenmoeias a emumo u4areriociadlatrau i;s sexoio oudoltemnvias) Dur( pno0tleomf3ils s elnvpnu4 rtnmo3totfptrlu il()s2uoxo io1ole lictl()srurur no0opxnifctltfsDrmuvo u) lxrxoctatomte nvsl(0 2xr(o3ou1ole mnes tfsrrmxmoot4opt mietltla2rlumo ()artnmfcoydlpDe nes t) 2urxopio1omtemfeia(f Dtruro;o0optniieilslm2raums;t4alenmr oydlmt lu o ()trxoxo3iy4amtn fesas sDurxm ;o4tltnio3tydlaDrluvs u4aleoxf iotoa e i s;t0setoiopnydap   nviasfsrta(mo;o0apx  i3tytfa ul(mp ()artnmf3todoaDran o t)trumxm oy1lmte fvtl(  2ta(  no0aexn f3iat m2uluvsnt4tetrmr tatlaDrai sls)s2tr(r io4ape mnvs s)artrumoot4tpx ifeiydfm rluvp t)aexrxo ia1omt  nei (  etoxr3ny4amtnmfci sfa2ururonu0ale mietasfm2uauvs t4tlxrif io1la eau olt) ruoio io4ale lnvt t  2tr(mont4aet iocildfa2umu p ()alxoirctydoa e ieil()srxmxo3ny4ame lies s)artr(rp;t0alxo fctysfaDrmnmpnu4 eeomr3tytomteanes () 2tr(rpio4apee ics sfsrur(mpnt4tee  ocilsfs2el(mo u4arxnmo3tadoa e u s;(0 rumiopiu4op   feta(fa2uax oou1optn i3tadlsDuanmp ()alermrcia1fm e ies t trtrxrpny4olen nvils artmur nt4open f3tltfa uaumo;u0 rerxrciadfpD  uvs;(0tetoxmpnydap nmnvi t)aDraurpno1aeenmiciys aDrmuvo u)aleomr3iatfp   ueo;(  2trxm3io1lltnlfci s  rtmur ;o0alen feildlm el( o ()trenmo3oydoptean sls t2uoxm3oo1omtn ieia()s2umx pnu1ole mo3tadlm rmuvs t) rxomf iy1lmDeaieo s s2xr(o3iodomt  feiat sDtrx oot4aex ifciydla2elnvp;t0tlxomf iodlpDranvils) ruoim iy4optnlies (  2trumpnt0oltoif3tatfaDum( p;(4texomo3iotomDeln i;t) euo(o3oo1altemivt ()a2urx  ;u4aeeo f3iadlm rmnvp;(0 ltnxo oy1lm rln sl(0trxrir oudll n fvils  Drmxr oo4tex iociyslm uanvp (0 rtnxociydfptrauvo;s)t2uoio3nudll  mnvta(  2ta(mpot1texomociltfa rlumo;u)altnifciytoat aues t texm(r oo4ap  lietas) Dtrxront4tex  o3iytlsDuau o () ltrxfcio1lmtelu s;s0s2xm(r oo4lptelieta()arra( oou1tltnif3iltlsDrmnms;t0 etoio3io1lmt luvs t0 exmxopiu1lptemnvtatfa2urxrpnt0oeto i3iysfm ua(ms;t)tltnif3to1faDelivs;(0 etoxrpio4opee nvtlt) Dtmumo;o1oet iicilt a2rmu o;(0aexnxoctodoa   ies t) 2trir3io1aleemics ()s2rrxr ;t4tpt  i3tlsfa ua( o;t4tlxrxo todoaDrauei;()srumim3iu4opeelivil(farrrxm ot0olen i3iasfm2rl(mpn(4tetoiociodfpte n i (0 eumir3iu1al nmfcs (  ruauro;u1tlt ifctytfm2um(vo;t) etnxr3oydlm  lueo s0t2trxo3iudomeemneta() 2tax ono4tlt miciltfm2uau p u)teeoif3tydfpD  i sl()srtrxm iodllt  iesat a2rr(m oo1opxnif3iyd s2rl(vo;t0 eeoif oytfa  lneo;s0t2um(rpiu4ale miei t s2taump;u1aeenmoeiatlaDelnvs t4 etrir3oodfaDrluesls0 2xoio nydol n nvt s sDuauroot4tet moetad m2rlnms () lxoxf oa1omD  i ilt)setoxm oudole mnesltf 2ra(ronu0oeeoifetls mDum( snu4 rtrmr iotfp r u o (0t2uriopnu1lm nlfctlsf rrr(mo;u4tlt moeiltfaDranvo;(4 renio3iadoa  aivol( trurxm io1lpt  ivtas  2trxrpot0alt moetls aDraums (0artrxf3iadfpDeau i;t setr(mpiu1lptemfcils) rur(rpnu0optnmf3iadla ea( p;u0tetnir3tydfa r ieo;s s2toio ny4ale  ictlsfsrrr( ont4tpen f3ildfaDrmnvp u)arenmf3oo1lpt  uei ( trxmxmpio4opee ivt tfaDrmum ot0aee ifeias s um(vpnu)trenxf3to1fp  lu i t0teuo(rpnydoltelieil(fartax p;o4apenifctyt s rlumo u0tlxoxr3iytlm rluvslt sruoir oydllen nctasfsrtr( oou1tlenmfeilslmDulnvonu0tetomo oa1omt  u ols)s2uoxmpou4lpe lfctatfartr( pou1apen f3ils s uluvpnu)treoio3iy1la   ieo (0teuoim3ny1lmtnlncia()arrrumpno0tlx if3iysfmDumnvs t4 eerir3ia1fpDraivolt  rxrimpnodap nmneil(  2trumpot0oet  feiaslsDemuvp;() ltomo oadopD aneilt0trumxrpiy1ole mncsls  rumx  oo1tltnii3ilsfs uluvo;t0alenxocoydop rlieils seuoxo3oy4lptn icilsfa2ta( oot1ape iociatfs ulnvp (0altrmr3iy1oa e uvo t teuoio oy4lle  ivsltfsDtrxm nu1oet ii3iytfm ea( on(4artnmo3ootfmtraivols0s2urio3oydamtelicia( srumx ooo4tlx moetytfs umu s u0 eenxr iy1lp  an sls  2umxo oy1lmt mivt t)arrmx oou1ope mietld s2emumo u) ltoif oadomt  i i;s s2tmiopnodapeemnci tfaDrru onu1alx ii3iyd m raumpnu)alenmo3iy1fpt ln ils tetmirpiy4lp  lfci ()aDrrxroot1apenmociaslm2elu p;u4trxomr3oo1oaD luvo;t)setmim oy4ameemfviltfarum( pno0apxnif3tltlmDulnmpn(0 rtrio3ia1lpt  u i;t  rur(r3nu1om n ncilt  2umxmoot1oet  ocils a umumpn() ltomr ootfmt  ieo ()tetoxopou4lpee nvils)srumxrpou0texoio3tatfm2um(mo;t) etrmr totfpDeanvilt0 2tmxmpiu1lp nmivtltfs2trxrpno4oltn oeildfa2eaumpnt4teenio iytopte iei;t)trtrio3no4lmtemivtls) 2umu o;u1tpenmfciytfsDea( s t4tlxomo ia1lpDr i slt) 2xoim3nudomt  ncsatfsDrrxr oo0aptnmfciysls2um(ms;() lxoif io1fpD au sl(0s2toio3iodaptemfesa()s2um(rp;t4teeo f3tytlsDem(mp t)altomr io1om raieo;t)srtoxopno1ap  lnetatfs2rm(mo;u4alxoifeils m rmums;(4 eerxfcoodfm eluesls0texoxr3ou1ol e ivtas)s2rau  ;t4alx  oeiytfm rlnmpnu0aetrio3oo1lmD au i s  rxrxopnydlmt  feia(farumxm oo1apx  i3ias m2ean s ()tlxnxf oytopt  nesls sexr(o io1alte nesa()aDurum nt0olt mfeild a2ul(vpnt4arenmfciytlm e nvils0t2xrxr3oy4ol  lnvi (fa2rmxr oo4oltnifciat sDem( o u4aexoifcoo1laD auvolt srum(r3nu4omtelfes s)a2tmurooo0oet mfeiatlsDemu s u0aeenxfciydfp rln slt0t2umxmpnu4optn icil( s2rmxmpoo4tlt io3iytfs ra(ms;() eeoif3totomDeaivslt0 2tr(m3nu1omtn nes s  2raxmont0tlt  fciydfmDranvp;u0 etrio tydop  li o (0 exoxm3iodol e ncsat) Duax pnu0tlt mieildfmDeluvo;u4 eeoirctytlmD lnei ()s2tr(r ny4ll nmict s arrmu  nt1ape  i3ilt s uanvs (4trxnmf to1lp elivsl() rurir3oy1lp elncsas s2tmuront1tpx  fciytfmDem( p t0trenifctytlpDeln sl()truoir oo1ll n ncilt)srraxmoot4tpenmf3iltfa2ua( p t4alxoxociydfa  auvo ()seurxm oydolen ncta( aDtmur nt4oex  ocils m el(mo;u)alxrir oa1lmDrln i;t  rxmiopiydom n fvslt sruaxrpnt1tee moeilt a elnvp;t0teenirciadop eln i;()setmxopnydol   nvias aDtax oou0aexnifetadlsDum(msn(4arxrmr3oodfpDe ivs;t) exrxm3iodapeelnciat)aDta(m ot0tpxomfeiytlm raumpn(0aeenio tatfpt an i;() 2toim oodam e fct t aDrr(r oo0oee ifciadfaDrm(vsnt)arerir iodfpt livols)tetm(o io1am   nct ( a2tm( ono4apeoiieildlmDeau s;t0tlerxo3oodopD ln i;() etr(o3oy1ameelfesas) Drru  ot1opt  ietls m emn p;t0altrircta1fmt luvs s sexo(m no4lp  miesl() rtm(mooo0oltnioeild a el( s t0 lxomo tydlmD lieo t0texrirpiudap nmncs s aDtr(root0texoifeiys a2el( snu4tltrxr tadlpDranvs s0texrio iydam nlnvi (faDua(r oo0apto oetas m2rlumonu4tlxrxr3oadom  aneils tetrir nodome lieiat)sDurx o;o4teeomieiltfm rluvpnu) exrxr tadfatrai o;s  rtmio3nu1oleemfci (f rtrum ot1tex ifeiatfa elnms;u4aexrir oodfm elies;t)s2xm(opio1op  lfvsa()s2ta(  nt1optnmoeilsls um( s t4artoxo ta1fatraiesls t2tmir no1ll  mncsa( srtauront0optnif3ilsfs2emu o;t4alenmfctatlm  au s ( trurio3io4apen nct s srua(r oo1olt  feiyd sDelump t4 lxrif3ta1lm e iesls0 2to(mpnu4opt  nvs sf rumxrpou4olxomiciasls2rlumsnu0altnir iotfmte uvs s)s2xr(m iu1alee fctas) 2um(m ou1opxnmf3iat a eluvp;t0alxrmocoadfa raivol()trxo(r3ny1lmt lictls)aDrrx p;u4aet ifeiat s2um(mp t) ltrif3oytopte i ils setoiopiy4aptemieiat  Durxm ;u1ale  iciaslm em( s u4teerifcootoaD  u o;s) etrxr ny4oltnlfvi s)sDua(ront4oexn ictlsfsDumnvp t4 reoif3iodoaDrlnei t t2xoxo no1opte ieslt aDumur oo0oet ii3tytfsDua(mpnt)aeenmociatlmtelu i;s) 2trxm3ny1lpen fvi t)a2trumpot1oexn ictldls um(ms (4trtoxo tytlm  ln s t0s2xoim oo4apen ivtlt)sDtm(moot1apen i3tltfs em( p;u4 rxnmf tadlpDr i i;( s2tmxrpiydlp  lfcsa() 2tmxmont1oltnioeildla eau s;t0aexrmfcoodoa elu s s  rtmxo3ny1opt mfei s a2rax  ou1alenio3iys a umn s (0teerio3oydfpt anes ( tetrir iudole lnct s) 2tmu onu4alx  f3ildfa ra(vo;u0trenmr3oydop r u s;s0t2uoirpoydom emnetat) Dumu pot4oleomfeiadfs2eln p t4texomocoa1lmt lu ils0 exoxr iu4lleelicias)sDur(rp;u4oet iiciaslsDrlnmsnt4aetrmr tytlatraieo ( srtr(m oo4lptnmnvi ( aruaxr no0ape  oeiytls eln on() ltoircoodfpt ai olt0s2uoir oydal  livs s  2uaum ;o1olenioetasfm2uau s;(0teeoif iydlptr u sl( sexrirpiu4ol nmiei sf rtm( p;t0apxomieiydlmDrln on()artrir3ta1laD  n s s)s2umxr3oo4lmtemfvs t s2rr(ro;u1tlxnmoctyd a2emuvonu)trtnxf iytlmDeauei;(0texrxm3ou1lp elfci () rrr(ro;u0altn ietadfmDumums (0altnif3oydomtr u i s srtoxo iudapt mnvs (fa2umum ;o4opt  ocild a rlnmo;(0alxnxo oydlpDelneo;(  2trxopnudalt mfcs s  Dtmurpnt1alxoio3tlt s2ea( s ()artnxf3iytla  aueols srto(r oudoptn netatfarumumont4apx  ictls s rluvp (4aexomf3iydfpDrluvi;t0teuoxm ny4lmtemfesasfs2rr(ro;t0tpeo ietad a ulnmp;t4tlxomo ta1fatr n i;s s2urir io1omtemfvi (fa2uaurp;o4texn o3iltfm2eau s u0tleoio3oydfmtr neolt0teumir3iu1omtemnciltf Dtr( pno1openmf3ils aDeln pn(4altoio3iytlmte uvils0sruoxopiu4ll   feil()aDtmur ;o4oltn o3iat sDrmnvont0aexoir3oatoptean sls0texm(r iodap   fei (f Drru onu1tlx  ietlsfa2umnvo;t0 lxnxo3io1oaDrlnvslt0srxrxrpiodol nmfcta() rrmurp;u0oleomoctytfa uan p u)artnxfcta1lp e ueol(  rtm(mpiy4lp e ivs t)sDtr(mpou4apt mfetasfmDemu pnu4tltrxfciytla r nvols  exoxr iu4lmenlfcil(faDuaxmp;o4aleo oeilsfa ua( o;u4artnir3ta1opDe u i s) rxr(r3nu1am e fetls aDra(rpnu4tpenifeildla2elnmp (4 ltoio iy1fpDraues s srtmio3oodomenlivt () rrau  nt1teeomociat mDeaumpn() eenif iydomtr n o;t0srxrir oy4om emiesas)a2rmxmo;o0tptoiictlt a2umu s;u4 eenxocoatlatr i i s)setr(r ou1lme mfvias a2uau o;u4olxnii3ildls ea(vp (4tlxoxf3io1omD  ieslt)setrxmpio1lpte fciat)a2rax  nt1openmi3iydfs2rm( snt)trenxr3ty1omteau i;s teuoxopnudaltnmfetl()s2urxr nu4aetomfciysfaDrauvpnt4trtrmo iy1fmD auesl( t2umir iu4lmtnmnes (fs2rmur no4alxoifciydfm2eln p;t) rtnxocoodlmt ln olt setrxr3oydol emfvs () rurumo;t0alt mi3ild m2ran s (4tltoxr iytlaDrli o;( seurxo3oo1lltemfvi ()artr( o;u4aetnio3ias a2um(mo;t0 lxnif3tatfaD ln o (0s2trxr3oydol   fcsatfsDtrxroou4ale iociad s2el(vp t0 exoir3tydfmtelueo;t0 etm(m io1oltelicslsfaDraumo;u1tpeoio3ilt mDua(vo t4aeeomf3iytopte uei t)seuoim oydlpenlnvslt) Drrxrpou0alenmieiydfm2ran p;(0trxnxf3oytlp elieilt0texm(m3oy1optelncs sfaDrax p;t1oexnmfciad s2uauvp (4aeeomr oatoa eanvslt)truoim3oydap nmfvtas srrr( ooo4tet iicilsls2rlu s u4 rermo oo1lpt lueils tetoxr3no4am emivi s)a2tmxm nu4tlx mf3iysfs2eanms u0teeomr3tadfpt auvs (0seumxm nu4ame micslt)sDtmx o;u0opxomietlsls emnvs (0teenxo io1faDr ieo t t2xoxmpnu1lmenmfvsas  rraxr nt0tpxn ieild m rlums u) rxoio3tydlmtrai ols seto(m io1lm nmics ( sDurxmpnt4olxo f3tld s2eanvpn(4arermocto1oaDranei t trtmxm iu4om nmfcia(f 2umur nt0teeomietadfmDeluvont4aexomf3oa1fmD auvs ()s2xo(r3no4ole mfetlt srtaumpnu4olx mictlsfm2uanmont0aeeoio oatom r n sls0 eur(opiu1lpte fesl(f 2ur(m ;u1tptoiietytfs emnvpnt0arxnmocoodfp rauvs s0sexoim3iu4ame lieiltfsrta(  ;t1olenmfctls a ul( pnt0areomfcty1oaDr uvil( sexoxr3iu4omeemiciatfsDrrur ou0tltomfeildlsDem( s;t0 rtoxr oadop  auvi;t0s2umim3ny1opt livtl()a2tr(m no0aexoiiciys m rlumpn(0arermocoa1fp e ivi t0 rtrimpio4apenmfcsat)a2uaxr ;o4tetnmi3tas a2rauvs;(0 etrif oadfmt  n i;s0s2xrim3nydame lfvtlt) 2raum nt0opeomfciys mDulu o t4tlxomf3oatfp   ies;s)s2tmio3ou1apt mncsatf Duauroou0oet moeilsfm2em(vsn(0trxoxoctytfaDeanvslt trumirpnudalee nei t)aDrm(mono0tlx mi3tyslmDul(mp (0alermf ia1op  an i;()srto(opoudlpeemietasf 2tmumo;t1tleomiciadfa2emn pnu4 lxrxr3iytopD au s;t0 rur(mpny1lp nlfeil() 2raurooo0tlt  octldfa elnvsnt0 leomo3iydlmtrauvs (  etoio3io4am  mfvs sfsrtaxr nt1ape ioeiydfmDulu s;(4 exoxf oydlmD an s;t sruoxr no1ope mivtatf ruau p;t4opx mf3iydlaDua(vo;t0tleomocoa1fm elues;() exrim3nudal emivsas) rrm(mpnt1oexnmfeiltla2rauvonu)texniocia1lm eauvi;(0 etrxmpnu1lp nlfct tfa2rm( p;u1tpt mo3iadlm2elnvpn()areomf3oy1fmt anes;(  eurxopio4alee ivia(fsDta(roou4tlenii3tyt a2umnvp u4arxoxr ootlpDrln i s)teuo(m io1alee iciasfsrtm(r ;u4aptnii3iadls2rmuvp;t0tlxrxo3iotoaDe ivilt s2umxo nydalte ietat)arumumont4oleomo3taslsDrlnmp;u0artnxf3ootoaDrlnvilt0 rtr(m3iy1amt mivi tf rrmxmpot4tpeo o3tasfm ea(ms u4aetnifctotfpDran s (  rxo(r3ou1ameelies sfsruau poo0alxomi3tltls2rm(vont0tlxrmo iatlp e n il( sexm(mpno1op  liet s aDuauro;t0aee ifcildfm rm(msnt4 rxoir3ootfp eanesls s2xr(mpiy4lpe  ivi t aDtrumpou4oexoiociytls2ulu ont4aexoircoadomtelies;t0truoxr3ny4aptn nctasfs2rm( ooo1aetn oeils m uan o t0aeeomo3tatop e nvsl(0tetrxo3nydlme mfviat)s2tmxrp;u1aptnio3tls aDua(vs;t0 lxoif oytopDrli o (  2xo(o3ou1lpte feta(  Duaxr nu0apeoifeiasfm rm(ms;()aeermo3ia1fpte nes;t)seuoxopiu1lpee fes ( a2ururonu1tee miciys s2ul( o u4tetomr iytoaDelnvi t  exm(rpoy1al  lfei (farrm(roou4apxnioeiltls um(mp;(4aetnmr3oy1lateau sl( t2toim3no4am n netlt a2uaur ;u4tpe mi3ild mDem( s;u4 lxnifciy1fmDraiei (0trxr(opiydap e nvia() Draxm ot0apenioeiasfsDumn p t0trtnxo3oo1fat  ieo t  rumxr3nu1lmee ncs (  Duaxmpoo4apxo ocilslsDuauvo;(4artrmo iatom  aneo t0s2tmim no4omee ietls aDururoot4alx mf3ilt a2ulu p u) exrmr3todlptrlneo s)srurirpnydll nlics t srur(mpou4oet mfeiasla el(vp;t0alxrxfciytfmD  n olt0tetrxm iy4alt  fci sfa2ra(mpnt1oexn ieilsls rau sn()tetrxf ta1lpDelu i (0teto(mpno1opee nctls)a2tax oou0optoifeiltlsDuauvs (4aleoxrciatlpteaivsl( sexm(o3io1optelfvt (  Drm(ront0alxoifeiysfm ua(ms u)altoioctytfpte uvi t0texr(m io1lpt  net ( sDumu ont1oltn i3tytlm raums u0artoio ia1opDeai ols t2tm(mpiy4alenmicils  rraxrp;t1olt ifetysla ul( o u)teerxocty1lmte n o t0trxriopoo1omtn fvs () 2raur nu1oleomictyt sDrln o u0trtrxr oatfaD lneols0teuoxo3no1am  mfes t)aDtaurpot0oeenmietatfaDemu snt0arenir iadlpDelu ils0t2uo(m3nu1om  lfei s  ruaumonu1tle ifctltfm elu pnt4tlxnxr tytopD  n s;t)s2toxrpoydlmeemictlsf 2taumpnu4opeoiieiyd a2rl(vp;t0tlerio3oo1fateaueo s)texoirpoudomte net (fartmxmpnu1tpe  oeiys a2ra(vs u0aeeoiocio1omte ivolt t2tr(mpiu4ll   ncsat)s2ua(m ;t1oet mf3tys sDrlnvpnu0tlxnmfciytlpt  nvi;s s2xoxo3ou4ap n ictatfaDrrumpno1oetnmfctys mDemnmp;(0aetnxo3iadop raneols0trtoir3no4om nmnes ( aDrauroot0alen f3iltla rmn onu0areoxf3iytop rluvs;t0seuo(m oo1ome  ncsat) Dta( pou0aleomo3ild a rmnvo t4 eenmrcio1laDean o;(  exoxm3iy1lmee iciat artaxrono0tlxoiieiatfmDelu s;u)tlxoio ia1fm   nvo;s0srxmir3ny4lleemivi tf Durxr oo4aexn f3iytfaDel( p () lenmrcoydfm  aues;(0srxrimpiydom nmieia( s2rmx o;o0tlxnio3iysla2ra( on(4altomo3tatoa rlivsl(0sexrxopoodlptn fei sfa2rm( o;o0tlt iieiyslm uau p;u0texrmf oodlm   nvo;t trxrim iydlmt miciltf Dra(mono4altoioeildfsDra(ms;u4 ltnxr3todlateaueols0texmir ou1lm e fcsl()sDrmxmpot0olxomoctltfs2ul(vo u)aetrxr3io1fm rlnesls trto(m3oo4apt lfci ()aDurxrpnu0opxnii3ilsfa2ranvsn(0 etnmfctadop  auvol(  2urio3oudap emfetlt)srraxm oo0tltoioetldls ranms t)tlxnir io1lm   ivo;s t2tm(rpoy4amtelfci t)s2rrurooo0tpt mfeiatlm2rlnvsn()tltrir iotlmD lues (0s2toxrpnudom   ietltf rrrumooo1olxnifciadlm eluvsnu) etoir3oatoateanvil(0 2urir iu1alt  fcia(faDta(rpou4opxnmi3iydfs emn p;t)aeerxfciy1oat aivi;t0trxoxopiudam  lnvtls)s2ua(monu0alt  i3iyt a uaumsn()trxnmo3tatoa  lnvo ( sexr(m nu4amtnlfctas s2taxmont0opx mfciytlmDuaump u)artrmo oy1faDe uvi;t)srtmim nydamtemfcil(fsDta(r ;u4apt  icilt mDuauvsnt4texoiocty1opDe u slt0 2xo(o iy4amt lieilsf Drr(mpnu0tpt mo3tldfa2el(mo;(4aeeomo oo1latelnvol() 2trxopiy1lm  miesa() 2rrx  ;t4oex moeias s el(vs;t4tltomfcta1omDe nei s0trxmir oo1lltn fcias s2rrxm ou1openmicilslmDemuvs t4aeeoifcto1fp  an s s0t2trxm3ou1aptn feils artmxr no0tle iictldlsDeluvp;t4aleomrcio1fpteauvolt0 rtm(opnu1om e ivtas arumum ;o0optnmfciadlm elnmo t0 lxoif tatlptr ues;t) rumimpnudlp   fesas artr(monu4open oeiadls rmu s u0aeenif3todfa rai ils) euo(m3oy1lm  lieia(  2umxrpnu4ale  f3iysls2rlump (0trxomfcia1fpDeau s ( trto(r3oodap e ieilsfa2umxro;o4opto ietlsla emnvp;(0tltnxocto1lpte uvi;s  rxoxrpnudap  mict (fs2rm(rp;t1apeomociydfsDea( pn(0texrif3oadlpt  uvo;t)teumxmpiu1lmtn fetas  2ta(r ;t0olenifciyd a2eanvp ()altnmf iytlpteln s;(0 rurxo oodlp  lfci (f 2uaumooo1oexo octytfaDuanvonu0arxrmrctadfa elu o;t t2trxm iy1op emnvi ()aDurxro;u1tet moctatfs2uanmp u)trxrmr3to1lmD anvsls t2uo(opno1omte ics tfa2tr( pou0alen fciys m emumo;u4artrmrciytfaDeauvi;(0s2xrim3oo1al emivsa(fsrtm(mo;t1olen oetydfa2eaump t)aeeoxo oodlpDranvs;s srtmxr3ny1optn ivs t)a2tmum ot0olxoio3ilsfs2rmnvo;t4tetnmfctydoateai i;()srumim3no4lptn fcs s) 2rr(r oo0aexnmocilt s2ran s;()altrmo to1opDelivils0 2xrxo oo4amtemivs (f Dtm(r ;u1opt mi3tys mDea(vs;t)alxoxo oytfa r iesl(0texrir oodlmtnlfvtl(fs2tm(rp;u1apt  i3iyslaDra( p;(4altrxrciodfm  luvilt  rxmio oo4amtnmfcs t srrru pnt0olenii3ildfa rm(vo;u0artoio io1fm elivs;t)trtoxr iu1ale mnetlt sDrm(r ;u0apxnmfciysfm em( o;(0texoif3iotfaDeaies s srto(m3nu4openmnesltf 2rmu  nu1aet mfciyd sDelu s t)artrifcoodlmtelieols)srxmio iu1lpe liesl()arum(mpou0tex mf3ias s uauvon()artrmr3ia1omt lu s t0 2to(mpiy1lp emfvil(fsDtmu  ot4aexnifctldla2rmuvo;(0 rxoxf3totlaDe uvilt0trxoir iydaptemietas aDtm( o;u4tpe  fctls a2rmnmo;(4tltrmo3oytopt  nvilt) exmxo nu1lm e nvsltf Draurono4apxnif3iat sDeluvont0 ltomoctadfmtr u olt0s2urxm iodlp  lfeil(  Drmxr ;u4ape  feiytla2ulnmon(0texnmo3ty1oa r ues t  rtm(o no1lle mietl( arua(r ;t1aexnifctat mDumu s u4 lxomo ta1om elnvo t)srxr(r no4lp  micsa(farra(  ou4ale  fctltla2umuvp;t)teermr3iatopte nvslt)texo(mpnu4am  mnvtat  rua(monu4tle ifeilsfsDrmu o;t0tlxnmf iy1fpDr nvsls0 2toir3nodope  ivt (fsruru p;t1aetnioetadlm rl(vont0 rtnxrcoytlaDe iei;t)teuoiopiodap emivtl()sDrmumo;u0oltnmf3ild m uln pnu0 exrmo iydop elieols)texmxm iydop  mfviltfsDrmurpnt0tlen fciytla ea(ms u0artrmr3iotlmDrauvil()t2uo(r iy4al  mnvi (f Dtauront4opx ioeiasfm2ul(vo;u4areoif todlp  lies;(  rxrim io4am  mnes t)aDtaump;o0tltnmoeiytlm rlu pnu4artrmr ootomt au o;s  etmio3oy4lmte fcsasf Dta(rp;t4tleomociatfmDrmn on() lerxf3oodfp eaivsl()srurio3oy4lpt  fvs (f Dtm(r ot4aee moetysfs rln p;t) etrio iodla e neo s srtoimpiy4op elivsl(faDraur nu4tpxomieiat mDumuvo;t) rxomrcty1opDeli s;t seuoiopiy4amt mfcs (f 2umumoou4tee mf3tls a rmu o u0 lxnxocootoaDeaivils0t2urxopny1opee fvia( s2ua(rp;u4aex iieiyt m rl( p;t)teerxr to1fate ivils0seurxopiu4lme  neta( a2rrxrpno4oet  oetyslaDulu o (4 renxoctytfm eanvils s2uoxo3ou4lme mnvtat)aruau  no1oexoifctytls2rlu s;t) rxnmf oodlmDrliei (0texoxm iudll elictl(f ruau oou1alxn fetlsfm2ra(vs (4arxnmr3oytfmD lneil( sexmxm nydoptn ict tf 2tmxmooo1texnio3tytlaDumumpn(4 etrif3oa1fptraneil( t2to(r3ny1ape  ivi s) 2umumpnt4aleomf3tldfa2um( o;t4 eerxrcoytfpt  nesl(  rurir oodlmen fct ( s2trumpnu4altn fetas s ul(mp;(4arxrxrcto1lateln ols0truo(m3iudaltnmfctls)sDrmxr ;o1tpxnii3iadfsDrmump u4altomr ty1oaD lnei;t0teumxo no1apeemfctlt a2trxroot4ale moeilslmDrmums;u0tltomo3oy1lat lnvo s0texm(m3nudamtelneiatfaDtrum ot0ope mfetatla ulnvsnt)altoio tadfmD ai slt0trxmiopiy1aleeliciasfs2rrxrpou4optoioctlslmDuanmp;t4trtoio iotom r i o;( srxr(rpno4open iesat arra( ooo1oeenmocildla el( p;(0aeerir3ty1oaD ai ilt)tetrim3nu1lltemnei s artr(mpot1aleoiiciydfs rlnvs;(0 rxnio oy1fpDrlivsls)t2uoimpoy1ope  nes ()sDrax ooo4tlxn i3iad a2ra(vont4arxrmociy1fm ran s t0trurxrpoodapenmfesa( s2tr(mpnu1alx  oetld m uanmp;u4 lenmf oydlate u i ( sexo(r ou4lmenmfvias) rta( ont1texn o3iys mDrmnvon()trerio iytfpteai o t0srxoio3oudalen icsl( aDra(mont4tle mo3iat a2eln o;u)aetriocoa1om   ivo;(0setmimpoo1lltnmneia(f Dua(r no0oexniietasfs emumo;t4tlenxrcio1fpD livs;() 2xmir3nu1lp e nvt ( srrau oou0tetnmietadlm ua( o t4 ltrmr3tytfa raiei s0t2um(r3nudamt  feslsf 2uaxm ot1aptoifcias sDrmn p;t4tlxoif3iytfatrlues;(0truoiopio1lp   fcsl() rrm( o;t0alen iciaslsDem(vo u0tlxoxr oo1fa eaues t srum(r3oy1aptelfvi ( s2urx pnt1tpeomoeiad sDea(ms u0teerio iatlmtrluvo;()srtr(r3oydamt mfvi (farurxmoou4tee ii3ias mDeluvp u)trtomf3oo1lpte uvs ()truoxr3oo1ap emfcias)artau  nu1oet ioctas aDua( p ()aexrif iotlpteai il()t2tmxo iu1altemiei tfarrmuroot4tet mietatfsDemnmp;()altoxo oatfatelu o t) rtmxr3nodapenlncsl(f 2umumpnt0alxomo3iatls eauvp u0 reoxfcoydlaD ai s (0s2urxr nudaleelnvsasf Dtr(m oo0alxniociatlm2rmnvpn()texomfcootlpt lu s s  2uo(o3iu4omte nvi (fsDraurpot0opx mieias s2rl( p;t4arerxf3iydlatraivs s) 2toxm3nodamtnmfvsasf Draurpnt0tlenif3tatfa2elu p u0 rtrxfcta1fm r i s;()seuoim no1op nlfvi ()aDum( o;u4oeeomfciys aDuan ont0trxnmfctydfp e nvs s s2uoxo oo1lpt licsas) rtr(rpou1aet miciat a umums u4trenxr3oo1lp r neils sexrxr3iy4al emfvil(  rrrxmpou1opx  fctat m2rm(vpn(0 exomociatopte ivo;()srxmxm io4ll   nvsls  2tmum oo4alx moctlsfs eauvon(0arxrir oatom e ivo;(0s2trio3oodlpenmnvtasfaDtmxm ot4aetn i3iydfa uauvo t0artrxocoy1lpD anes;t)trtmirpiy1omte icsl( aDur(rpnt1aptn i3tltfaDua(mp (4aexnxr to1faDeanvsl()texrio nudlmte neils  2rmxrpnu4tlt  ociyt mDrmumpnu0 lxrirciotfaDrauvol() 2tr(r3ny1llenmnvt s) Dua(mpoo4aeenmo3iadfs emnmpnt)tltnxfciydlaDelnes;t0 ruoxmpiu1lp elfeta() rtr( pou0opxn ictatlaDeln p;t4arxoir3ia1lm e i olt)setmxo3nu1amt  nvi ()s2tax onu4tpeniieiasfa2rmu s ()artniocty1la   nes s0sruoio ny4amtnmfcsls)sDtm( ooo1ape  iciydfa2ea(vs;t0trxnxoctatlmD  ueols)texrxrpnu4ll emivsas)sDurx ono0tlt moetydls2rmu s u0alenxf3iadfpt  neo (0t2xriopnydapeelivtl(  rrmur ;u0aexomi3iadla rmu s (4teeoio3iodfm  ln i (  rtmir3ny4op nlfvtatf rrmxronu0opt mo3ildfaDrlnvo u) rtnir3oy1la  livo;t srtmxrpiudal nlicia( srrr(monu0opxnmfciat s uaumo;u0artnxf3iatomtr neolt)trtoxo ny1lpe lfesl(f 2tm(mono1optnmfctyd m rl(vo (0artrxfcoydom raneol()srumxrpoudlmte fvil(faDumu pou1tptnio3iadfsDrlnvo;(4tlxoifctatlp rln i;s) 2toxo oudalenlnctat)srrmxrpnt0aex ifcils mDelnmont0 rtnir3oadfp rlneols)trtrimpnu4al e ivsasfaDtaxmo;u4oex iieiat s ul(vs;u4areoxr3iotoa rliesl(0 euoxm nodol emicsls) 2rrxr no1alt ifctls m rlu p;u) exoio3oadlmD  nvolt0texm(mpnudlle mncsa()aDtrxro;t0aptn o3tat s2el( s;(0 exnmr tadfpt ln s ()texo(opny4ope lics ()s2rm(m ;o4tpt  ociys mDeanmp;t)tltomocoy1fmte nvi ()tetmir3ou1lltnlnvta()srum(moou0aexnmoeiydfm rm(vp;t)artoio ia1fmtelueo;s) 2xmxm3nu4ap elnvsl(f Dtrxr ;o0oetomo3iasfsDeaumsn(4 lerxr3oatom   nvil(0t2uoxmpoudlleemfcsltf 2umurp;o0tpeo f3tyd m rluvonu4altrir ootlmtranvilt)srxoxopiu4omte nvt ( sDuaxmpnt4tpeo o3iltlsDulu s () rxoxr to1fpte n o () 2xrimpoydame  ieils)sDurx  nu0tpx ioctldlmDum( pn()aexnmrcta1lmt aueol(  rtmxo ny1lm  livt t)a2raump;t0apx ifeild aDua(vs;u4aexrio3oa1fatr ieo;(0teto(rpno4al   nctl() rtm(r no1tet  ieilsla2emu p;u0 eenxf oydfpDe u ils0 2xoio nu4amtnlivsat srum(mp;o0alxn o3tltls el(vo u)alxnxf3oydlpDr nvo;(0s2xmio3oy4optn fci ()arrrxro;t1tpxomiciyd m2uanvpn()trerxo3oo1fpDe u i ( sruo(opny1opeelivs (f rrauro;u0tpenmi3iltfaDua(ms;u4aexrif to1oa  li i;()s2xm(r ny4amtelfct s a2ta(mo;t1ape mi3iatlaDuln o;t4trtrxr3tytoaDe nvols)srxoiopoudlpte ivslt arua( o;u4texomi3tltfm em(ms;t0artnmoctytfmt  n sl()t2xmxm3oy4ap   nes sfsDtau pno4tlen icias a umnvs u0tetoxociydomt  n ilt trtm(m nodapt  ies ( srtmxrooo0tex mociatls2umums;()artniocto1lpD  ies;s s2ur(m3io4olen fvs t srurur nt0apx moetytfa ul( s u4 exoxoctotomD  ueo s tetm(m3nu4ole  fvsa( aDra(  ot0optn feildfa2ul(vpnu0 eeoir3io1fpt anvols)t2xoiopoydlpe lfetat) rua(mp;t4oex mo3iytfmDrm(mon(0tlxnmo3iotom   u s;(0srxoxm iy4ome mfcsl( aruaxrpoo1oeeoif3iltfsDran pnu0tltoxocootlaDe nei;t) exr(rpiu4amtemfvsatfaDumxrpnt0tlx io3ias a raums;u0 lxomr oa1oaDrai ils0 2uoim iu1lp nlici t  rtm(m oo1ole ioeiadlmDrm(vs t)altoir3oadfm e u s s0seum(rpiy4ameemnci t) Dtmxmo;o1oex mf3iatlmDrmump u4 leomf3iadla eluvs;(0 2uo(r3io1omt  iciltfaDrrurp;t4tptnmieiysfs eaumo;(4 ltomfcto1fpteauvs (0t2toxrpoudlm emieslt sDrmxm ou0optn oeiys mDulnms t4 lxrmo3iatfateaivol() eurimpio4lp nlieta( artm( o;o0oee mociys m eln s t)tlxnmf ty1lmt  ivs;s0sruo(o io1ope licia( a2rrxront1aeeo octyslm2ul(vp u4arxrmr ootfp  ai sls)setmxo iy4amtn fvsatfarrmxmpno1ape  fcilsla2ean p;t4trxrxr oy1lmt  i s;t)texoxr3iu1ll elivsa()srtmx  ;u0teen i3tls s2elnvo t0tlenmrcta1lm  luvsls0texrir3ou1ame  ncsl(f rtmumpou4aleomieiltfm el(vo;(0 leomfciydlaDranvs;s s2xm(r oy1op elici sfa2tmu onu4apxoif3iadls2rln pn()texrxfciatlmteluvols0 rto(m oy1lmen fci s s2rmxr ;o4openmictydlmDumn o;t4 exomr3iy1op eluei;s0s2uoxo ou1am nlfci t  2umumo;u4opt iocils a2elu p;() eeoxo tadop  anvo s) 2xrxm3nu1alen ivtas)sDtrx oou0optnmiciadlm uauvs;() lenif3iadfpD aies (0srurimpno1am  mict ()srtm( o;t1ape  ictlsfaDrl(mo t)aexnmo3iy1oaDeai sls)srtm(r3oudoltn ictat)sDrmxrpnu1teeo i3tytla2emums;()trxnifcoytlmteau s;s trxoxm nodlleelnvia() 2urxrpnu4tee  ocilsfaDeanvonu)aexrmr3tytfa  ai s s  2uo(m3no4lmtelieias a2tm(r ;u0apxn oetasfm2ranvo;u) rtnmfciatfm   uvols t2tmxo oydale mnes t)a2umu pot1apxnmocildlm2uanmsnt) leoio iotlpt au s s) etrxopoy1alenlfcils  Dra(ro;u1aet mictadls em(vo t)aetomr ty1oaDrlieol()teumir nudap e nctat) 2urx o;o4apx iictltlm rm( ont0 rtomr tatlatelnei ()t2xr(r ou4al nmfcta() rraxm ;u1ape  ieiyd s eluvs u) etnmf iadlpt lu s ( srxr(m3io1lpe lfctat)a2tru o;u1opxniieilt m2rl( p;u0arxoirciodlp eauei;s0t2toiopnydop  lncils)artr(  oo4alxnmfctytlm emnmo;(4aeerxo3ty1fa elneols  eur(o nydam n ietatf Durx  ;t4ape io3iysla rm(vo;(4altrxf3ty1fpteau ilt)srurir oy1ol e ivtas a2ta(m ;o1tet  i3iadfm2rluvsnu0alenxfcoa1fmD luvs;s)s2uoxo ou1openliciatfs2umx pou0tpxniieiysfmDeluvont)artnif3ta1opteanei;(0 euoxm oydlpe licta(  2taumpnu1teeoii3ils m2eluvp;(4trxnxo iodlp  livi t)t2xoir nu1lpt lfvilt aDuaumpnu4tltnioeiadla2emn s;u4alenio iatopDeaueolt) ruo(rpoy4altnmfetlt aDurumpno0teeo ociysfsDrl( p;(4tlermf iodfptr ivols  etmxr oodomtnmnvil(  Dtrumonu0tle ioetydlaDrlnmp;t) rerir tydop  luvils)trxmimpoo4lme mncsl( aDrrxrp;t1aetn o3iltfs elnvp;t)teenmf3oytfmt aivi t  rtoir oy1lpenlfeil() 2umumpot1texomf3tatlaDem( o;u0 eerio3oytfpD luvilt  ruoxr3iu4am e nvsat  Duru pnt1aexomociaslm2rmnmont0tetomfctydfaD au i;() 2uoim3iy4amt  fviat)aDtm(rpot1oexnii3tydfm ranmsnt)artomr3oydfmtrau ol()srxr(m iu4lm n nvslt)arrr(m ;t4alxnmfeiyslm2rln sn(4aexomr3oo1fpDrluvi t  ruoxm3ny1ll e fesatf ruru poo0tlx  fctls s2eln pn() exnxocoy1lmtrlueils  exoxo oodlpte nvsas  rtruronu4aeenioetyd m2umnvo;() rerifctotomtelnvi s  2xmimpio4ome livias s2umxrpno0aexn octldfmDuau s u)arxoircoytfmD  uvs s  eurim3no1apt  fvtlsfa2uaxm ou1ale ii3iadfs rlu s (4tlxnxrciotfa elu i;t s2to(m3ou1ol   icia(f Drmu poo0tlxnmoetydfa emn pn(4altnmr3to1lm e n o;(  2trxrpnu4omt miciat aDumu  no0apxomi3ild a elnms;()tetnxocia1lmtelnei t t2xmxo no4lmee ics ( srra( ono4aet mictytlsDrmumsnt4 rxrxrctodlp rlnvol(0teumio no4oltnmnci ()a2umxrp;o1oex mfetlslm ul(vp u)trtoiociodom eauei t0t2tr(m nu4lm n fcs t)sDta(m ot0ope  f3ilsla ean o u4aexnxociy1omDe nei (0setoimpoydlpen iet sfa2rrxmp;t0oeenifetadlsDuluvp;(0 lxnioctodlpt aivi ( trto(r oy1ap emivt t aDra(  ;o0oltoiietadla ulumont0tltnxo iatoate ues;t0srxrxm3oodameelnvsltfaDrru ooo0altnii3ilslaDulnms;(4 rxomr oodlpteauvolt)truo(rpiu4optn nei s)aDrrxrpoo1olen oeilt a ul(msnt) eermr3to1la elu i;()texr(o3nu4amtelnvi s) Dtrxmono1alxomi3tadlmDumu s u)artriocia1oateaivo t0trumim3iu1omt  nvil( aDraurpno4olxomf3tysfmDulumsnu)altoir3todlaDr iei;s0t2urio nu4opt mncil()aDrax  ;u1tee iiciytla ra(vp u) etoxo3oadfat ln o;( trumxm3oo4om e nesl(fsDumur ;o4openiictltfs emuvp u0 lxnxocto1lp rai slt  rxmxopiu4lme  fvia( a2ta(rooo0tltomfciadlaDrmuvs;u)aleomf3tydlm rln o;( srurxr iu4lm nmnctls) 2rm(  oo1alenmo3iyslmDemumsnt) rtoio iy1lp  lueils t2uo(rpou4amt  fciltf rumxrpot1oleomoctltfm rm( s u)aetoir tydfp eln i s)trum(m3oo1altnmnvil(fa2rr( oot4tee  feilsfa2ea( sn(0tetnmo3ta1lp
\ No newline at end of file
@@ -0,0 +1 @@
+n i;t)teuoxr iy1oltn ncslt s2taumpot0teeomociadfs eanvon(4 lermf3ta1fmDeaivol( setrio3iudope lnvi ()a2um(rono1tlx  f3tas a2rm(ms (0 etoir oo1latr i o (0trur(o nu1lpe  fvi t) Dtmu  no0tltnmi3iys a2elnvo ()aetoir3iotlat auesl( s2xr(o oodameemfvs s  Drr( o;t4opt ioeiltfsDrmnmsnu0 lenxoctadlpDraivo (0 euoimpoy1opt  icil(farrrx pot0tlx  i3ils s2eluvont4 exoif3oo1omt luvols)t2uoxr iodlptn neilt)aDtrxr nt4altomi3tadlm rlnms;t4tlenxf oydlp  lneo;t) etmio oy4aleemnetlt  ruru  nt0tltnmo3iytlaDrauvp (4trtomf3oy1lmDr u sl(0texmio io4aptn nctlt s2rr(mono4teen octltfs umnmon() rerifcoodfmtraies s)teurim ny4llee feta(  2taum ot4teen ietydfsDrlnvs t0trermocio1om eaivs ( srxoiopoo1oltn nvt s)s2tmur ;u1opxnioeiytlmDul(vsn()tlxomociotomteauvi t0t2umio3no4omte ici sfaDtr(rp;t4ope if3iaslm2ea(vpnt0aetoxo oytlmtr uvs;()seum(m oodalte fet (fs2um(r ou4tex mi3iasfa2eln onu0tlxrmocty1omD aiesls tetoxo3no4olt mfvtlsf ruaumpot0aexoio3tldfmDrauvsnt0texrmr3oytomDe i o;s0 2trimpnudope lfvt (f rtrx  ou4olxnmoeiydla2eluvpnu)alxrmrcio1omtr iei;t trumim3oydal nlfei (farua(r ot4olenifciatfa2rlnvo;(4alxoir oydlp   u s;() 2xmxmpiy4lpee netat)sDurxmono1tet mociys m rl( p;()aeerir iotfaD ai sl(0 2ur(mpiy4ol e neilt)s2tmxmont0tetoio3iasfs2rmnvo ()treoif3oy1laD aieols t2xmir nudop   fvi ( srrmu  nt0apt  fetltfm2umnmp;() leoiocoadfa e u o s0 2tm(o3iu1omtnmfeil() Dtrxrpno0tpeomietlsls2el( o;()tltnxf3oodop   uvs;s) exrxo3ou4lpt  nviltfs2uaxrp;u4aptoioctlsla uanmo;t4 eermrctatfa  lu s s) 2uo(rpno1llte neilt  Dta(rp;t0apxnioctasla2ea( o;(4trtnxfcoy1oa rlnesl(0 exr(mpou1al nlnetatfa2ta( o;t4ape mi3tltfaDel( sn(0 rtrxocoatfa r nvilt0 rtoxo iudlpenmfesa(faDraurono0tlt mi3iadfsDean p u) rxnifciy1oat au i () eur(mpoudll nlictls s2tmxmp;t4texn fetatlm2el( s u) rxrxr totopD luei ( teurxmpiodapte fvtas  rrmxm no0apxoiictltfaDumn snt)tlerxo ty1lmtr u i t s2xoir3ou1op n nctlt sDurum no1opxomoeiytla ul(mp;t)arxrxf3oy1la  anvo (  rxrirpoo1ome mnetat) rrmxrpnt1aeeoiociys aDem(vp;u0 lerir oo1lmtr nvs;t)seum(o ou4ol elivtls)arum(mpno1apeo fetasfaDrln o;()trxrmo tadla raieo;t texrirpnudal nlfct t arrru ooo0tpto ieiasfm ua( sn(0 eenif3ia1omDrai i t0trtrxr oudlmeelfci s  Drmxrpoo1ope  iciat a umnmp u)artrxr todomDelu sls0 euoiopoo1lptelnesa(  2um(mpot0apxomociyslmDemnvs;u4trtoif oy1oa  lnvo s texoxo3iydomen ncs sfaDrm(mp;t0oet ii3iadfs umnmp;u4trerxfcootlmDe ies;t0s2xoxopiu1ome mnei t artrurp;o4optoifciydlsDrmnvp;()teerxfcia1lmDelieo s0s2umxrpiu4lme lfeiatfsrurumpoo0opx ioctlsls2umumo;t)tltnmo3iadfateli o s  rum(r iu4optnmnctat) 2uaur ou0alxnif3iatla ua( sn(4 leoif3oadfatr nvi ()trto(m ou1al n icilt)sDtau  no0oltnmo3iasfm umu pnu4trenio3tadla   ivo;s)setr(m oo1llenmneslt) rrm(r ou1tex ifetydfaDulu p t0altoxf3ta1la rliei;t srxrxo ny1apeemfvilt  Dta(mooo0ale iociyd sDemnmsn(0aeerxo3totfpD anvs;s) eurimpoodale lict tf 2umxmp;o4apen o3tadla ulu o;(0alerxrctydomDeaieol() 2ur(m nudoptnmict tfsrurur ;o4altnmocilsfmDuaumpnt)trtomo3todoatean s s) 2tmim oydlmtn netas sDrr(rp;t1aeenioctat a umuvp;u4artrxr oadomtrauvil(0sexmxrpoo1omeemnvi tfa2tr(  ;o1altnmfcilslsDranvpnt0 eeoir ta1fm  lnei;( sruoim3iy1optn ivs t sDtau pnt1aleomieildla2ea(vsnu)aetoxf3totlatr u i;() 2trir iydlm  liet () 2rau  nu0tlt mf3iys a2emumsnt0trerio io1la r uvs (  2uo(mpnu4ol  mnvt t) rtmu o;u0alx if3iatfm elnvpn(4aetrir ia1lm rlu il()tetrir nydalt  iet t)s2taxmpou4oeen fciys m2rlump;(0areomo ia1oat luvi s t2urim3iu4apt lfcilt arum( pou0apxo ociltlsDeauvo u4alenio3oy1fm elu o s0 2urir3io4optnlies s)s2rrurooo4olxnmietys m2ea(mont) etomo oatoat luei;s t2trio ny4al  lies s s2tm( pno4aet  oeiydlm2ra(msnt0alerxo3oytoatrlieo;()t2urxm iu1ole mfes tfs2tmx oou4tptnmoeild m uln s;(4 lenmf3totfatelneol(0srumxo io1ll   ncsa()srtaxmo;o1aetn icilsfaDum(mp t4aeerio ootfa elu s;(0srtoio oydaltnlietas  rua(mo;u1tet mieiydla2emn p;(0 rtnxr3oy1fa rli i t)tetoio io4lp  mfvtl(fsDtmu  nt4opto fcilsfa el(vo t)trenxociotfaDeanvi;() rumimpio4lpeemfcs sf Dta( pou1oetomi3ilsfsDem( s u0texnio3oadfpt an o;()t2uo(o nu1omenlncia(fs2trxmoou4opt mociysla2emumsnu4 lerio to1oa  an il( texrxrpnu4ole lfvtl() Dum(  ot4apxomi3tytfa ea(mp;u4altrmfcoytfp  li s;(  exm(mpnudapenmneia() Drmumpno0opeo ociytls2rl(mo;u4aexrir3oa1fpte nvi;() exoxr3ny4ome mivsl(  Dtm(m ou0apenifcils m ra(vo (0aetoxf3oa1lm  aiei (0srtrxr3no4lm n fcsa(fsDrrx  oo0aexomi3iasfs umnvonu4 etrir iotlptr i i;s teur(mpio1opteliesls  Duru poo4aptn iciytfsDemnvo u4arxnxf3iy1fpDr ivils s2tm(o iu4ole lnvsas srur(  nu4optn ieiatlaDeluvsnt0altrxrciytoaDr ies;t0 etoxo iu4amenliet sfsruaxmp;u4tlto feiysfsDrlu snu) reomf3iydfate neo;() exoio3ou1amtnlfvsl(fsDtaumpnu0aeen i3iat sDelu sn(4tetnmocoodlmDe nei t setrxm iu1opeelici t a2taumonu1oltoioetyd s umn o;t4 ltrxf3io1lmDr i sl() etmir iudlle lnct t) Dtau oou1tpxniieiytla ulnmont)arxnxocty1lptraivol()sruoiopio4lptemieil( aDumxro;u4apenmfeiysfm2uauvon(4alxnmfcta1oaDeauvol(0trtriopoydam  lnvilt aDuaxr oo1aex moeiyt m2ea( pnt4tltrmf3iadoaDranvs;t trumiopiydlmte ietl() rra(  ;o1aex io3iytlsDuan ont4areoxf tytoa  ai i ( srtmxr3nu4llte ies sfa2rmur ot1apx miciat aDuau sn(4 rxoir oo1la rlies t0truo(m ny4lltelfvs s artm(mp;o4aleo fetadfm rl(vo;t4arxoifciatop eaivi s0texr(o3iu4ole lfeilt)a2tr(  nt0tpxn fciydfm2umu o ()altoifcoydomDrlnvsls0 ruoxo nu1opte ncs (f rraxm ;u4tpxnii3iys m umnvo;t4arermo ta1fp e uvolt0t2tr(mpnu4ame liciltfaDtm(mpnu0ope  oeiat sDeluvs u4trxoxfctatlm e u s;( srurir ou4ome lnvi ()srraurp;o0tltniieiaslaDeanvs (4aexnxo3oydoa rai sl( setmxo io1llen fvsas s2taumpoo0openmf3tlsfm2umn snu0artoif ta1fm  luvol(0seto(rpiudape  nvtlsfsrraurp;u1alxo i3iytlm2ul(vs;t0aetniocoy1lpte i i (0 rxr(opoy1omtelfvs (fs2ra(r nu4altniieils mDrlu s u0 rerio3ia1lpt ai sls srto(rpnu1lmen nvsas s2ra( ono1oeeomiciad sDrm(vo u)arerio ia1lp e uei t0seur(r3oydlp nmnetat)artm(rpot4aex  ictat a rau o;u0trtrxo ootfpDr uei;s)s2xrxm3nu1ome lfvi s) Dtaxmpno0tex moetatfs rl(mo;(4arxoxo3io1la eluvils t2to(r iudoltemici tfarrmu  ou1apt  i3ilsls2ua( sn(4trtomo3tadop r nvo s)s2urirpoydom  miei (f Dtauroot4aptomfetydla2ran p;t0 exrxf3oodopDeau slt)trur(m3nodlle  iviatf rtr(mooo1aptnii3iadfs2eanmon()tetrircootfmt ai i (0t2toxo3iydlltnmnei sfa2uaumoou0aet mo3iadfmDea( snu)trtomfciadlpDeluvo s  exmxopny1lle  ivi tfaDuaum oo0tlx if3iltfsDrl( p ()altnmr3iatfp r nvils0s2urxopno1llt micsas) Dtmxm ot4alt  octls mDrmnmp;() ltnmocoa1lat ln o s) rtmxmpio4ome lncs tfartmx pnu1oeenii3iltls2uln snt0 lenmfciadop e ivs ()s2urim3io4amtn iei sfs2um(monu1oex mocilsfsDel( pn()teenmfciotlpDr u olt0 rxriopio1ale mnci () rtax o;o1olx  ocilsla2umumpnt)arxrif3iytlmDeln o ( t2xriopiudol n nei (fartaxrpoo1apeoifcilsfm umn o u4aleoir to1faD lieols srxoiopoy1alt miesat s2rmurpnt1teenio3iat s rlumo;()tltrmr3iytfpD  ieo s0texo(opoydlme  icia(f rtax  ;u0texniocild s em(ms;()aeerir iatfmD lueo (  etm(opiydap nlnvtat sDtaxm oo0tle mietydlm el(vsn(4texniocoytfpDrlivi (0 rxoxopnudoltnlfvt s sDtaxm ;t4teeomfcilt s uln ont4tlerio iytfaDelu s (  euo(r nu1lpeelivs s)srrmxm ot4alxo ieils a uan sn(4alxnif iodoat li o;t) rtmxo oy4op e nvsa(  rrmxmpnu1aleoifcilslsDeau p u4altrxr3ta1fa e ieils0srum(m nu1lp nmivs ( arta(roou1opxo o3iatlsDeanvo (0aeerio todoa eluvi () 2triopno1olt lfvi (f 2trxmp;t1tpxnif3iadfa2rmu s t0 lerxo3tadoatr i s ()teuo(o iy4optemfeiasfaDum(ro;t4oleo ietyslsDemump;t)artnxr3oatoaD  ueils  eto(r iy4am e fvs s aDta( oot1tet miciltlmDem(vs (0aeeomo3iotoat  ies ()texmimpoudol  miesatf rtmxmp;o0opto ociadfm2em(vs ()altomrciydomDr neil()srtm(r3iy1om  mfesas  Dtmxrpnt0opt ifciyslm2rm( pnt0teerio3iotfat  iei;( sexm(r3nu1apt lieslt)sDuaxm ot0tlxo fciasfs uln o (4tltnxf iytfp elu s ()trum(rpiu4lpee fetls)srua(rp;t0tltn f3iatlsDrlnvs;(4trxrmr3ta1om eauvs;t) rto(m nydam   ncslt)srum( pot4opt io3iaslm2emumonu) leomfciodlate nvo (0tetmimpoo1amt lneil() rtrx pno1tpxo f3tatlmDua(mp t)tlxnmr3tytla rluvi;t) exr(m3nu1ap emfeias)arra( pot1tpenmoetatlmDemnvsnt4tlxoio oo1fate i o (  rxmimpnudam elfvtatfa2uaxr ;t1opx moeiatls2uan o () ltnif3tatop r ueils  rxoxm ny4oltnlfvsa()srra( o;u0oetnmietas sDul(ms;u0 ltoif ootlpD  u ols)srumxrpiu4lm   fct (fsrrm(ronu0tlx  octldfsDeau o;u4artnmf3oo1oat  ivo;s0 2uo(o3nydap  lfeil()s2ua(m no0tltomo3ildlm raumo;(0tlxoxr oo1fpDeanvi t) exoxopoudalt mietltfs2umxrono0opt ifcildfsDulnmpn()aexrir tytopD  i slt sruoxr3iu1ape lnvil()srraumpoo1tlx  o3iysfa ua(vp;u)tetnxf3todfp eauvilt0srxr(rpny4amtelfvi t  Dumu pou0oeenmieiad sDeauvp u0trenxf iy1fpD  uvi;t) 2urxm iy1om elnvilt  2ra( o;t0tleo feiyt mDumumpn(0 rtnif3iodfatelivolt)srur(mpnydopen iesat aDtr(r ot4oee io3tytfs2umnmp (4aexnmrctatopDrai s t)tetmio3iu1op nlfei ( aDrrx o;u4openioetatfa ean o;u0teeomo3iotfaDeanei s0s2xmxm3iu4apenmnctltfsrtm(m ou4tlto fcildlm ra(ms;(4texnxfcoo1fmDelneo;( s2ur(opoodap nlietatf 2rrx ono0tle ioetatfs el(von(4 etomo tydopDrlivo;t)sexoimpiu4op  mncs t)artmxr ;u1aexnio3ilsfmDea( pn(4tlerif3iy1lm e ueilt)tetr(m oydlmtemfei t  2taxmonu1tex  iciasfa2rln o u4tltrir3iadomt  n il(0tetoimpoydlpte nvs (fsDua(m ;o0apt  o3iysls2emump (4aetoxocoy1oat ln i;t trurxr iu4lmtn net t)arumxmont0olt  i3tlsfm ran o;t) etnio3iadfpDrlivs;() etoxrpny1altnlfci s)arraxmont1tetomicildfs umnmo;(0artoxo iytfmDrlues s0truoxm3oydlpeeliviat)s2rrxroot4olx moeiyt sDem( s;t0 eenmrctadfa rluvi ()teum(m3iodolenlfvta( s2ra(r oo4oet  f3ildfa rm(vs ()altomo3to1fa ranvil( srtoxm oy4amenlieilt) Drr(rp;o1tpt mi3tldfm2ulnmpnu4trtnmf tadfaDr n i s0trtmir3nu4lmtnmictas aDrm(rpoo4ape ioeiyslaDrluvs;(0trenmf iadlptrai s;(0setoio3oo4lm nlfvias) 2tmumont1tpeo fctldlm elnms;u0tetoif todfptr u o () euoir no4alt  nct t srumumpno0aeeomocias s ranmp (4alxnir oytlm   ieo t0srxmxm3ou4ol e fesat)arrr(m nu4olen ieiltfm rl( sn()aetomociy1fm  au o s) 2toxo iydlp e ivil()arumur oo0alx  iciys m rau s (4aetnmfctydfmt au o;t srxoio nu4optemfcslsfs2tm(ro;o4opt  ociydls em( p;t)texnmo3oydlaD aies t srxoio no4lpeelicsasfaDum(r nt0tpeomi3tldlaDel( p;u4tetnxr3ta1oa rluvo t  2uoxo iy1ameelicsls) ruaxr no1ope mieiadla2um(mpnt)aetrmf oodfat lies;(0sruoxopiydoleemfcs s) rtaxmpnt4apen fciysfsDumnms t4tlxrircootlm r ueils) exmirpio1aptelncta(fsruru  oo1oee  ietat s rmnmo t4alermociadomDeaies t0s2xoxrpoo1lm e ici tfs2raxr no4tleomfetldlaDem( ont0areoir tytla eli i ()s2toxo iodap nmici s artaum no4tetnmo3iytlm rmnvo t0 etrmo tytomD  u o;t0 exrir3oydlmen nctat) rrmurpno4opxnii3iasfs em(ms;t)trenmf tydlpDelnvil( srtrio3io4ap e ivils)a2tm(monu0teenio3ildfa ra(vs;u4tlerxrctotlpDrlueo;t trurxopoo1opt lfctltfa2trurono0ale  oeiytfs2elumon(0tetnxo3iytfm ranei (0s2tmxopnudomt mictls)aDum(mp;t0aex mi3ildls eau p (4tleoxocty1fp   uesls0 ruoxm iydol nmfes t) 2ra(mooo4tetn f3iltls el( s;(4alxoxrciy1fmtr ues;t0tetmir ny1opeeliei (f Draum ou4olxn i3iatlm uaumsn() eerir tatomDrli ol( sexo(o no4lm nlnctl()sDrrxrpot4opxnifetyd sDem(ms u)trxnxo iodomD anvs s  exrxrpou1omtelieslsfa2urxro;u0opx mieiltfmDul(mon() etoxo3tydopt auesls0trto(o nudlme mieilt sDur(r ;t0alx mociytls elnmonu0altrif3tatfa  li i t0 2xoim3io1lpte ivt sfsrtaxr nt4tptn oeild aDeau p u) reoif oadlpD lnvi ()srto(m oy1om emnci t sruru  ;o1oeeomf3iadfm emu o (0treoxocia1oateai ils sexr(m3oo1am n fesl( sDtaurp;u4ape miciytfaDem(vsnt) lxnxr3tytla ran o;t truo(rpoy1ope lnvi s a2urum ;u0tet  f3tldfm2rluvsnu0 lxrif3iadfm raivsls)setrxrpiodal emfctatf 2tmxr ou1teen f3ilslm em(vp u) rtoxr ty1la r ivs;t0t2tr(m3nu1ome lies sfarum( oot1aptoiociad s2eauvont0teermf tytopDrlueo;( trurxrpnudlptemfvs s sDtaxr no4aexn fciatla ea(vo;t4texomr oatfpDr ueo s s2umir ou1optnlfet sf Dtax onu4tpxomfciltlm em(mp;() leniocoytlpDeanvs t  etrim iydame lfvt s)sDur(r ;o1tee mo3iad sDua( p;u)altoxf3totlmtelu ols)s2tmxm3iy4ol  mnvtas)arur(root1apto fcild m em(mo;u0trtnir oytfaDrlnvo t tetm(mpiy4lle lncsltf 2um(m ;o4oexnioetls sDul(mo;(4 etoif3iadlm eanvslt)s2xoir3iudoptnmivias sDrm(m ;t0tpt ii3ilt aDran s;u)areoxf oydfpte uei;s) 2urxopny1lpe lfei t  Drrx oot0tpe iiciltfm2ul(mont0 lxnmo oo1op rln o s0sexmimpio1ole mncias)sruaur nt0tpenmocils s ulu p;t)tetoioctadoa  luei;() 2toim3io4apt lfcs (f Drau ont0optomoetyt m umn o u)trenmr3oodfmDrai ilt0setrxopoydamen fvtlsfsrum(mo;t4aee ifciytfaDulnvp (0trerir ty1oa ran o;(0s2trio3nu1op  mncta() Drrx onu0aptnmo3ils m2rmu p t4teerifcto1fmDeaues s)texrio3oy4op nmicilt)s2uru o;o1opxniicilt s rmuvon()aetomocoatoaDe ies;(0trtmim3oudopen fctl(  Dumx p;u1tetoifctydfsDra( onu0trenmo oatomt ln olt)trxoxmpoodlptnlnetl(faDta(monu0tee moetyt m2emn on(4 reomfcoytomtraies;( t2uoxr3oy4lp  lnct s  2tru pno4oexnioeils m2ea(vp u0altomrcoadfpD li i;s  2um(r3nu4alt mivtlt)arumur ot4ope moeiytlmDra(vpn(4 rxrmrcootlpD au i;s0tetoxo oo4omte nvtls)a2uaum oo0apeoioctatfm2elu o;u4 lxoircootlm  aivs s) exoxo3no1lptnmnvs (  Drm( pnu0tpx mociatla uauvpnu4 exoxf tydfmte n olt0setoir oodameemncias a2uaxrp;t0apxniiciydlsDeaums;t0 eenio3tadop elieo t0t2to(o iodolenmncsl()sDtrxr nu4aexoioeiyd aDemuvo (4tlermoctadomDraivols0 exoxm nu4omtn ictlt srurum ou0ale  oetlt m2umu onu4aexomr3tytlmt  u s (0srxrxmpnudlmen nvias a2ta( oot1aet  feiltlmDrlnmsnt0treoxrcto1oaDe ueo;()trurio3nu4amen fcsat)sDrrx p;t1olxnif3iatlm rmumpn(0tltrif tatfptrlneilt0 2uo(o oy4altelfvs s srurx p;o1alen f3tat s2ua(mo;u0 eermo todfpDeau sl()setoxmpiy1op   iet ()a2rrur nu4alxnmieiytfsDrl(mpn()aetrxf todopteai ilt texoxo3iudllenliesasf Drm( o;u4alt ifcilt a rlnvp;t0tlenmr tytlmte neolt texmim3oudlpt  nvtltfsrrmxro;u1oeenioeilslaDeanmp;t4teermf iotlpDeauvols)sexoxr nu4optelfvtl(fartmurp;o4tlenmoeiltfmDuluvpnu4 rtrxf3iodfmt au sl(0s2xm(rpoodlle mivta()arraxr nu4tpx if3iad s rmn p t4 etnifctodla raieo;()t2umxm3oydop  miesas s2rax p;u0apto feiadfa2el(mp t4 etnifcoodom   uvils0srumxmpio1ale mfct (f ruru o;o4oex io3tltfm eaumpnt4tltoifciydfaD lnes s0trxrxm ou1om n ictas)srtrumpno1teen f3iat sDrl(vp;t4tlxrir iydoaDrauvo ( srxo(o oudlm nlieta( s2ur(ro;u4alxoio3iytfs rau ont4tltomfciatomt aivo t0texm(r3iy1lm  lnvsl()arra(m nu1apxoifeilsfmDemnmp t4arerxf3totomt an i t0t2xrxm3oy4optnlies (faDtr(monu4aee iictad mDemu p;(0 eeoio ia1lp rln i ()tetoxo io4alt  fvi () 2tr(roou4teenmi3iat s em(ms t)trtrio3oo1lmte u s t0 rumxr3oydlptemfeilsfaDurumpot0tpen fetld sDeaumon(0 exrioctatlpt liei;t)s2to(r io1amenlfcils) Durum ou1tetnmf3tadfs elumpnu4aeerifcoa1lmD aieo t teumimpoy1opeemnvt s a2umurpou0apxo ieiysfs2ra(vs;t) rxrxrcto1oa ean i s srtmxr3no1olenlnesat)s2umxm nu4aptn o3tadfm elumpnu) renxr tatfaD ln sl( s2um(m iy4al   ivilsfa2uaxrono4aleo iciytlsDulnmpnt4 lxoxr3to1omDeai ils0 rumxr3iy1om elicta() 2rrum ;o1tlto oeilt sDrm( o;u4aleoir iotopte i sl()srxoxmpiudopeemfvtl()sDua(r no4aeenmf3tytfs2rmnmp;(4altnxocoa1lp r ies s)t2xmxm nu4olte fct t)arrmurpou4oee ifeils a2rlums u)tltnif3totfa   uvo s0 2toiopnydam elfvils) 2trur nt0tltnmi3taslsDumnvs ()arxoioctytopDe uvi s)s2to(r3oy1llee fvi t)srururp;t0opto o3tldfsDrlnms (0 ltoxf3oatlp eanvo;s truoxopny1omtnlfvt tfaDrau oou1ale  octad mDul(vo;(4tlxnxocoa1fat ai sl(0trtrim oy4olee ivtasfsrum(rp;u4tlt ii3iydfa2ulnmp;u4texnio3todfmte nes;() exo(m3nu1ale lnvia(fsrrmumoot0ale moeilsla2uan s;t4 rxrio iadfmD  uei t) exm(rpoydaltnmnct t)arrru ont1ale  o3iydfa ra( pn(4 leoif tytfaDr nvs;(  rumimpnodamtelneiasf rtm(mo;u4apeomietlt a2rmn on() renmo ootop eaues;t)t2umxo3nu4op  miviltfartm(rpnt4oetniieiytlsDrm(mpn(0texnio oadlm eluei;t) 2um(r iu4ap e net tfsrrmx p;u4oleoifeildfa elu o;t4altomf iadlpt aivs s0 exoxmpnodopenmnvtas  Durxrpnu0aleoioetlt m el(vsnt4alenmo3tatop rlnvs;t0tetriopno1lp elnvilt) Drrxm no1tlxoifeilsls2rlu o t0 rtnmf3oo1omte n s;s0s2umxr3ny4ape  nesltfsrua(mont4tpxoiictydfa2ra( p u0tlxnmf3tytfmtraneo;t0 etr(m iy4am   fcs t) rtm(mont1alto oeiat mDrmuvs;u) leomo3ootfat  u o;()trxrio3oodlp n ietat)s2raum ot4olxniocils aDuln pnt)tlenir3oy1opDe nei t0 rxmxo iudomte icslsfaDur(ro;t4apxnifciad m el( o t4 leoif3totla  lueo;t)s2xrxopiu4omenlnvtls srrax  ;u1tlxomfcilsfmDumnvsnu0 exrif3todlpt ln i;() etrirpoy1lp  mfvia(f rta(r ;u4tleomo3tytlm emuvp (4altomrciadopD auvi s s2tm(mpoydopt liesltfsDumu pnt4alt  icildlmDrmnms;t)altnmrciotlptrln s;(0 2toirpnu1oltnmfesa(  Dtmxm ou1aet moeilt m2uanmp;(4 ltrmr tytopt anei;(0 ruo(o3no1om n ivs sfa2tr(ro;t4ope if3iadfm uan on(4tlxrxr3ty1laD  nei;t s2trir ou1altn netat) 2rauro;t1tpe ii3iatfs umn pn(0tetomocty1lmDeln ols0sexoio3oo1lmeelicias) 2taurp;t1optoifeilslm2eaumsn(4areomfcoytomtr nes t  exoir3nu1apt lfcil(fs2rrxm ;o4texomo3iysfa2rm( o;t)tltomrciotlptelnes ()trxoxopnu4lptnmnvtls  Drmumoou1apeoifeildlmDraumo ()aeeomo oa1fp elnvs ()trtoxo3ny1op   net s) Durur oo4altomo3iasfm umu p;()altnxr tytomtr ivi t)trtm(o3ny4lm emicilsfa2rau pno1oet iiciatfs2rl( o;u4tltniocoa1faDeanvi;(0srxoir nu1omt mfctlt)a2raxm oo4olx  o3iltlm em(monu0 rxoxr3tatfmtrlies;( sruoio iy1om  livs t) 2ua(mpoo0tpxomfeiltfs2rmuvpnt0trxoio3to1faDr i o;t)s2xm(rpiudlmen fcsa( srtmxmono1tpeomo3iyt s2ua(vo t0 eerircoytoa rlneo (  2trxmpiy4lmenlnci t s2umur oo4alenii3ils a elu o;(4tlenir oadom  lnvi t0sexoimpiydoltelnvt t aDrau  ot0alxomoeiys sDeauvs;(0 eenircoo1fa e nvi;()seurir3oudape mfeiat s2ua(rp;o0texomociydfs2eln s;u)arxoir3iotoaDe nes s0s2toxrpnu4llte fciat)s2uaumpot4tle moeiat aDumnms u)tlenir3oa1om  anes t trtmxm nu1lmeelfctasf rta( onu1oeeo f3ild m2emu p;u)aeeniociytomDrai il()setrimpnu1oltnmiviltfsDurum ;o1tpxnmo3tas s ra(vo;u)trenxo3oatfp r neo () exm(o3iydaleelfesasfaDtrum ;u0texomoeiysfm2rl( onu) etnmr3oatfm elnvo;t0 exrim3oodlpeeliesasfa2uaum ;t1ale mfciyt mDul(vp;(4tetrxr iadfm  aieslt  rurio no1lp   nvil( srtmump;o4ope  iciadlmDulu o ()altnmr oydfmtrliei;t0trxr(m ny1al nlfvs () 2rmum nt0aexoiietls m uau ont)artoif3io1fpDeanes (  2uoxo no4lp e ivia(fartmu  no4oltomfeiys aDua(ms;(0arxrif3oodlpD anvolt0 2trxr no1opee fvi sf 2umurpoo4altomoeias s2rauvp;(4 etoir3tydlp  an ilt) 2umxr3nodlp emivilt) ruax oou4tlx ii3tas mDrlump t)artomfctatoptrlues;s  etm(r iu4lm nlfvtl() Dtr(rpot4tle mo3tyt m elnmp (0 etrmf oydlp  aueo;s0s2xrio nu4lmeelfvtls) rururp;u1aetoiieiysfa eluvsnu0 eeriocoo1oaDrlu ilt0s2xrxo3oodamtn nvia(fs2taur nu1apt  fcilsls2eln pnu)aetrxr iytfaDrauvi;s)t2uoimpou4omtnlfvi (f rta(mo;t0oee  fetasla ra(vp t4areoxo oydoaDr uvols  rtoirpiu4optn fvsls) rur(m nu0optnifeiaslmDum(ms (4 etnifcty1oatean o s0s2uoxm iu4lpee nvslsfs2rmxrono1oleoif3tadls ulums (4tlxrmf3iydoat au s;s0sruo(mpoydlptn netasfsDrrxroot1apxomoeildla ran s u) rxnmr3iy1lpDe neo s sexmxm oy4alt lnvil(fa2tr(mpnt0tpe ioctlslaDra( p t0 rermr3oydomt au s;( srto(m nu1omtemfet sf 2rrxm oo4tex ii3ilslm umnvp (0 exoxf oytlpDelnesl()trumxr nu4omenmivi tfaDrmurp;o0alto f3ilslm2el( p t4aetomociodfmt  n s;t trtmxo nu4lp emictas s2uaxm ot4tlen iciadfm rmu p t4arxrio3oadfpDe nvo (0truoimpnodaltn fvtl() rra(m no0apt ifeils m2rm( p;t)alxrif iadfpDeanvs ()t2urxr3ou1ap  mnvil(fsDua( pnu0apxniociatfaDul(vonu0arxoif iotfmteluvs;(0tetrxr iu1lp nlicias) 2ua(rooo4altnii3ils m2em(mp;t0 etnxociy1lp eliei () 2uo(m nu4aptelfcsasfaDtaxmp;u0aptnmictytlsDelumon(0trxoxrciydoa elieo s teum(m3oo1om   netlt sDtmxr oo4teeomo3ilsfmDua( o;(0artoxo3ia1fpD aueols sexoxr3no1apt  fetl(  Dururo;t0apenii3ildlsDumuvon(0 lermr3iodfa   u s;s)texoxr3no4ap n nvi t)artm( ooo0oeenmo3ils m2ulnms;t)texnxf iatlmt aues;(  ruo(r oo1al nmfct s) 2ra(m nu4opxo feildfaDeanmon(0arxoxf3iydfpteanvo;( s2urxrpnu4ap elfcta()sDuau  ot0tlxn f3tltls emu pn(4 reoxrcoytomte uvi;()trtoirpou4amt  ics (f Draxrpoo4ope  ieiltfmDuauvs;u)tetoif iodfpte nvsl(0s2tmxo oy4omenlncsl(f 2tmxm ;o4aeeoiociydla2uanmp;u4 eenxf oytoatrau s;t srur(m3iu1aptnmncsas  2rr( pnt0ale miciat m rmn o t0 ltnio3ta1lat  i s s0sruoiopny4ol e feta(f Dra( oot1opt  iciltla rmn p u4tetoxfcoytlpt ln i s)srxrxmpio4omeemnctlt)arua(r ou1altniictadfmDel(vp;()aeerio oa1fa  anei;t)truoio3ny1ol e fvtl( aDuaxm ot0texoiiciad a ra( s;t) rerxociodlate ivi t  exmxopiy4apenlncsl(f 2rmu o;u0aexoioeiydfs2emnmsn(0trxnxr tadoaD anvi;(  2urimpiydlmt  ivta(fsDuaxrpoo0apxo ieiysla2rm( o t0aexrxf3oo1lmDrau s;t  eur(rpno4lmen fvil( aDtrx pnt0ale mo3tas s2ra( pnu0 ltoxf tydfmDranesl()seumir3io1lp  mfctl(farrrumo;u4tpeoiociltfm uluvsn(4arerxo3iodlpt  i sls0teur(mpnydlmt  ncils)a2rau pot0tpenif3iadfs ul(ms u0artnmo3iatlm eluvo;t  rum(o3nu4lpt liei t srtaumo;u4tlxnmictltfa2uan snu) eeomf iytlm r i o;s0srum(o nodll nmnvia() 2raumoot4oeeomi3tatfmDrmnvs t4trxnxociatfm   ies s  eum(r nudll elnei s) Dtr(ro;u4oeeniiciatla2rl(mo () lxrmo3oydomD  u i s0 rurxo oy1ope  ncslsfa2uaxmo;o0tlxo o3ild a2eauvo t4tleniocoadoaDr nvsls seuoir3iudapenlnvils)aDtr( onu0tlto oetytfm umumo u4 exrifcootfpte uei;t)texmir oodamen iesltfa2rm(mpnu1texnif3tld m2emump;u4tlxriocoo1lat aueo;s)srtmxr3ou1lpe mfeiat artmxrpno1alxomi3ils a2eluvpnu0artoxrcta1lp   uvo;s)trxoxo3nu4optelieslt) Drrxm oo4tetnmictltlaDemnvp (4tlerxf ty1lmDe uvslt  exmirpnu1apenmict s)aDrrur no1tpt ifeias a rl(vp (4aetoxo3oatomDeln o t0 2umir3nu1lmen net ()a2ua(  ot1oexniiciydls ra( o t0alxnxo3ty1oatr uei;s0setoirpiydapen fvtas a2ua( oot1apto f3tadfaDuan pnt) eenxrctotlat  uvs s tetoxo iy1olt lnctat a2trx p;u1tlx mietytfmDeauvo t0 exomo3oodfmDraies;s0 ruoim ou1lp emfciltfsDumur nu0olt iieiatfs2rl( p;(0arxoxfcootlp elieo;s) ruoio3io1lptemicsltf Drmumpoo1olxnii3tadfs2ul(mp;u4trerif oadlmDr ueolt  2xr(r3io1alt mnct ( s2uru poo1aeenmieiatls uau snu4 etrxr oytlmDrlivi (0 2xo(rpio4omen fesa()aDra( p;o1tlxniociad s2ra(mp;u)areoif3iytlpD  u s;(0trtrxr3no4ll emivias a2rmxm oo0optnio3iyt a2rmu s;(4 reoxf3iydlaD lu i;s)s2toio3nydal elnet t a2ur( poo4opeoifciytfa2uauvo;(0tleomr3oatfmtean s s0teur(opiudlp  lnes sfaDumxm ou4oltniociyt mDua(mpnu0 ltnio3ta1opD aiesls t2tr(mpoo1ome mfvs s aDrmu pnu1tlxomfeiydls rlnvp t)aleoir3ta1opD anvi;s t2ur(rpoydlmt mietl() Drmx p;t0oet mo3iasfaDua(vs;u)trtrio todfm eau sls)setmxo3nodaleelietas arraxrp;o1aex mf3iat m2ua(mo ()aexoxf3ty1oaDrlnes s) rxo(o3nu4omt mncsls a2tru  nu0tpx  octatla uau p (4 ltnmfciatoa rluvs;t) rxrxopiu4olen fcsa()arrm(monu4alt ifctatfa ran sn(4texnmf3ootopDe n s t0 ruoxm iy4lmt micsat a2ur(r nt0oetnmietaslsDranmp;u4tetoio iydop e iei s0 exrxopiydamt  netl( srtrurpno4teto ieiatfa ranvp;t0altnxr oo1lpDelivo;t0sexrxopiydop nmivs ( a2ra( onu4tlenmieiatlaDum( on(4trtrmf3oytlm   ieo;s)srxmxrpno4op nlfci ()sDtmumpou4oltnioctld a raump;t) lxrxr iatfpDrlnesls0 2uoim oydamtemnetas  Duaum ou1aleomo3iydfa2umnmo u0trxnmo3tadlpteanei s0texrim iodlmt  fci t) 2tmx ono4olx iociadla ul(vsnu)teeoif iadlp e n o s)sruoimpiu4lmenmnvsasfa2raur ou4olt  icild a rau s (0artrif3iadoaDrliei t) rxmxr oydll elivsa()a2trumpoo1oetnifetlt mDul(vsn(0 ltnxr3iytfa ranei;s)trtmxopoy4lm   fvt s)srrrurpnt4tlx ifeiytfs um( onu4alerxr io1omtrlueol( t2trxm3io4ap n ivia(  ruaxmp;o0alen o3tas a2rl( o;(4 reoxf3iy1faDe ieo t0t2tr(m iu1llt lfet tfa2tmurpnt4olxn i3tad a em( s u0 eenxo3iydopDeluvo () 2urxrpoo1altn ivt tf 2tm(rpnu1opeomiciasls eauvo;u0treoio iytfm e ivi s0sexmim nydame lict s) 2urum ;t0tltnif3iyd aDrlu onu0aleoxocty1oa  auvs (0 2tmxo io4aptn icsl(  Duaumonu0apt ifetat sDel(vp;(0arxniociadlm elu i ( srtmio iy4lpe mfcs sfsDraurpou0tlxo i3tadfmDrl(mont4alxrmfctodlm raieo;t sexrim oo4alt mnesa(  Dum(moou0aexoiicilsfs2ea( p (0texrmr iodomteau o;(0 exoxrpiu4opt lictas)sDtax  nt1tpe  oeiytlm2uln s u0 rxniociotfm rau i t)setrxmpno1ape mict (  2rm(moou4opxoifeiatfm elumpnu)trerio iy1la elnvi t t2xoio iodap e iei sfaDta(  no4texnioctydla2rmnmpn(0artrir tadfatrli i t seuoio3nudol emnvtasf Duaxm ;t0olto fetys m2uauvp t0altrxo ty1op rauvi s  euo(rpiy4apenmnctas aDta( p;u1apxo iciysfaDrluvs u4artrmo3oatfp   uvol(  etrio oy4al  lfcilsf 2rr(ro;o0aex  fcilsfa elump;u0 rxoxf iodlpD luei t) rtmxm ny1lle livilt  Drmu pou4oeenmfcils m rlumsn(4 eenif iydlm eliei;t) exmxm3ou1oltnlfvias a2rru o;o0oltnmf3tatls ulnmsnt) eeomr3tydomDeaieolt0s2xr(rpno4al  mnei s) rtrumpnu1alx if3iasla em( s;u4alerxociy1omD ln i;s0 exrio ny1amtemivs t)sDraur ou0teenmfeiysls2rluvsnu4altrio3iadoaDe i ils)sexrim3oudapte fei s  2rr( p;o0opt mf3ias mDulu p u0 etrxf3ty1lmDeaueo ( trumxr3oodopt lietlt) Durumpou4aleomfeiasls2ra(mo (4artnif3iodlp elnvo;(0 2to(o3oo4lme lfetltf 2tmxmo;u1oet ii3ildla ra(mp;t) lxomocty1la  aies;() 2xm(opou4omenmncslt aDrmx ooo0alxomoetydlsDean o;()alenif iatom   nvs () ruo(o3iy4alt lfvsa(f Dumur ou0alenii3tyt sDumn p (0tltomrcto1fmDe ivo t)truoim3nudoptelfes t)aDrr( o;o1tpt ioctldfm rauvs;u0tlerifciydopteanvi;()srtm(r3nodlp emneil(faDrmu ooo4teto f3tltlmDran s t4texnmr ta1fp r ues t) 2toxr ny4ape lfvsasf Dtau pnt0apxoii3iydfa rm(mo;u4tlxomo3ia1omDrlnes;() 2xrir3io4omt mnct t  2urxmpot0ape mfeiysfmDrauvp;u)tetnio oa1fm   ivilt)teuoxrpnodopt mfctl(fsrrmu p;u0oleomi3tyd mDul(msnt) rtoxoctadfpD lnes;()s2trim io1ll  mfeilt a2trxmo;t1aex  feiytfs2ea(vsn()tetrif3oytlaDelivo;t0 exoio3no1al  lfctlt)a2ururonu0olxnmo3ildfs2elnms;t4 reomo3iodfpDeauvils)t2xmio3nu1lmtelnvsa()arraxrp;o1ole ifetytfs ra( sn() ltrmo oadfaD lneils)tetmiopou1lp eliei s)a2umumpno0aleomf3iyslsDrm(mo (4trxrxociodop  aieol(0texrxr oy4al nliviat)a2ua(mpno1texo fcilslm2el(monu0teeoiociadom eanvo s s2umxr oudlmtnmfes (  2rmuront4oetnmfeiys sDelu o;t4 exomoctytomDrlnvo;s srxo(rpoodolt mnei sfs2rru pot4altoii3iatfm2emu o;u0 rtnmr oa1op rauvi t)srtoio3oodaptelnetltfs2rr( pnu0altomfctad s eln sn(4arenir ta1lmDrlivo;t) etmir ny1al n ncslsfs2ra(mpno0aet  i3iadlm2ranmsnt4 eeomo3iy1lptelnvi;s s2xrimpoydoltnlfci ()a2tmxm ot4ole moeildlmDrln o;t0aeeoio tytfpt  nei s0s2urirpnu4olenlfvsls)a2tmu  no0texomi3ild a2uan p;u)trxrio oydlaDrluvo ( t2urim ny4olenlivslt s2ua(mo;u1opt ioctyd a uanvpnu) etoio iotfmt aivi;s truoxo iydlpeelfvs sf rraxm ;u1teto i3iat s rm(mpnt4tlermo to1faDeai o s0srtrxopou4olt mneilsfarumurono1alen iciytls ean o;t0 etrir3tydomt au slt0 2umxm3iodaleemietas  rtrxmp;o0apx ii3iat aDua(vpn(0texrir tatop eanesl( t2tmir io4al   fvt (  ruau pnu4optniociltfm2ulnmsnt4 exrmo ty1oa rlnvolt0 eumir io4lp n fct ( arur( ono4ole  ietls mDrau p;t4artniocoy1om  ai o () 2toxr3nu1opeemivia(  Duaxmp;u0alxomfetytfs2umu p t) ltnif3oo1faDrli ols)truoxm iu1olen fei () 2rmurooo4apeomoeiydfm ea( p t4 etnxr tadlm eliei ( t2tmio iudom nlfeilt s2rm( pou0open o3ils sDuanms;(4trenxf3iodlaDraivslt seurio nydop   nci t aDtmur oo4opt  i3taslsDeau s;u4tlxoio iotoaDr nes (0teum(mpou1om   nciltfs2umu o;u4tpto iciatls2rmnvs;u4 ltnxo ia1fa r ueo (0t2xrxo3oy1llte netas  2tmumpot1tlx ii3ils mDemnvon(0alxoirctotlpDeauesl( s2xo(m3iu1amt miet () Dtm(m ot4tetomfctlt m2uau o (4aexnifctydfm elieol()trxoim oo4am   nvs (farrax p;t1oexo ictasfaDranvo u4altoxf3totom   nvslt  rtmxr iu1apeemnvilsf Duaumoou0tex mociasfm rlnmpnt4trxnmf3tadfaD  uei s)t2xoxo iy4ol   feslt sDrmumo;o0tex  fctlsfs2emnmp;u0tetrir iydfmDranei (0s2tmir3ny1alte ict tfs2urur ou1tee mfeiatfm2elnvon()arerxociadlmD  ies (0seuoxm iudlpt  iesa() Dum(m ou1teenmfctldfs ulnvsnu0 eermo tatfa rlu i;()s2to(r iu1alt  nesl() rrmxr ;u1aex micilsfa ulu s;t4 lenmrctotfpD lneo;s0s2xrimpny4apenmivs t) rta(r ;u0oexo o3iydlm2ulu p;u4 rerxoctadoatrli s (  2um(m iy4lptemivsa()artrxm oo0oltn iciad aDraumo;u0areoxo oodfpD anes;() exoxopoy4ol n nci s  Dtmx ono1aexomfctydfs2rl( o (4 etnif oodomtr n ol() 2toxr iudll  mieilsfsrumu onu1olt mocildls rl( ont)arxriocio1lp  livi ()srxrir3nu4al n ncslt)srtaumono0tetnif3tatls2ranmp;t)texoio ta1laDeli i;s0srtmxopoydal elfvia() 2urxm no4opeoiocildfm2ulnmp;t4artrxfctatoat li sl(0texoir oy1al nlicsas)arrrum nu4aetnmi3iat m2ean on() ltrmr ta1oat anes;()seto(m3iu4aptnmfvi tfsrtrurpno0alto oetasfs2ea(mp u4 eeoxo ty1fp ean s s0s2tm(rpoudalee feia()a2rrur nt0opxoiiciyd a eanmo () ltnifcoodfmt ln o;t trxrim3oo1olte icils aDuaxmp;o0optoiietadfs2ea( ont4arxrir ootlpDeai o;(0sexr(rpio4al  lnvtls srtr(r nu1optomf3tatfa eanvsnu)texnmrcio1lmDe n il( trxmxr iy1olte fvta()srtrxmp;t1oetnifetasfmDel(mp u)aexomfcoadfa  lnvs;t srumim3oodlp e ncs tfarumxmoot1aetniieiadla2rm( p;() leoxociadfaDeanvs;() exoxm iodlptemnei s)aDtrum no1alt ii3iatla2emuvo u0 lxrxocty1lpteaiei;(0trxoim iy1optnlivia( arraxrpnt1tlxn oeiltfa2rauvs;u4arxrmfctodom ran s t0sruo(opiy4am e ivsl(  2rmx o;t1oltoio3tldfa2uluvo () rxriociotlpt luvo;s trtmirpnu1lm emieslt)aDtr(r ou4oetnmoetadlaDemnmsn() exnxfciadlmte nes ( tetm(rpno4amenlnci ( arrm( poo1tet  ociys mDrauvon() rxoxociadlaD  nvo;(  etrxo3oudoltelfvsatf 2trurpoo0aex moctatfaDuanvont0tltrif oatfpDeai sls t2uoxrpoy4optn ivsls)arumxm ;o0tptomfctld s elnvont4trtoxf3oadla ranesls0srxr(m3no4lle  nvtat)sDraurp;t1tpeomfeiad mDranmo;t)tleomfctadfa  anvolt)tetoiopnu4ale mfvs ()artmu  ;t1aeeomfeiaslm eanmp;t4 rtrmf3iy1fptr nvi;s t2xr(mpno1aptn fetas srrrxr nu0oexn i3ildfaDulu o;()alerxrctotom e nvi;()seumio no1lp  livs t) rumxmpnu0tlxn fciadfm2ranvp;t0 eerif oy1op rau o;s0 etmimpnodap nlfvt sf 2ta(  ;u0tlenmo3iyd m2rlu o;t)altnmr3tytlatr ieo;t)s2xoimpiu1amt  fci t)srua(rpno4oet ioctyt sDrlums;() exoir3oo1laDelnvs t0 rxm(opnodoptnmics (fsrua(r ou1tptomoetas a ulnvpn(0 ltrxf ootoa eln s ( srxoxopnodamt lfvsas) rrrurp;o0aetnmi3tasfa ra( snt)tltnxo3oy1lpt li s s t2to(r3no4lp n nvi sfs2urxm ;t1aet if3iydfa umnvp u4 lxrmo io1lmDe nes;s trtmio oydomt  ieiat) rumxrpoo0openifctadfs rm(mo;u0 eenircootoa raivols t2umxo oo4apee ivs sfaDua(ro;u0alxn octlsfs2rlumon() ltoioctadlp e neols)texoxo iu4lmt  nct sfaruaxro;t1tptoio3ilslsDrlumonu4alermociadoatraiei;(0t2ur(m nodap elncsltfa2tr(rp;o4tle mf3iatlaDra( pnt0arxrir oodlptrau o;s0trto(r ny4llte iei sfartau oot4alt  oetadls rmn p;t)trtrmo3ootlatr ivi s) rur(o ou4am  mnet tfartmxmp;u4aexomo3iytla2ulu p u0tetnio tytoaD auvs s0t2xrxr3iu1lmtnmiei sfa2uaur ;u1teeo oeilslsDeaumpnt0 rxrmfciodlm e ueo;t0texmxo3oudope lfeilt artrurpnu1aeenio3tls m rlnmo t0tltnio iodfatelnvs t)s2umio3nu1ap e fetat aDtrumoou4tltoiieiydlm2elums u4texnmocoo1laDe ivols  exrxm3ny1am  lfesl() rtmxrp;o1aee mf3tyt m elu p;t4alxrmr iotoatr ivslt s2uo(opiydap emivt t sDuaumpno0tltoiociltfsDrm(msnu)arerir ty1fpD lieils0t2xrio iodameemfvia(f 2taxmont1opx mf3iadlm2rlu o;u4aetrmo io1om rlues t0srxrxm iu4lleelivt sfsDuaxmpnu0tet mi3tat a ua(mo (0arxoif3oo1opDeln olt0trtrir3iu4lm  mnvs s  rtm(mooo4open fctldls2rmuvsnu0altrmrcootfaDr u il(0 rtr(o3io1amee fcia(fa2raxr ;u4tle moetadla2el( s t)texoxo tatlm elies;s  rum(r3iu4opteliesls)a2rrxmont4oex mfctysfsDrlnvp;u4altomocoadfpDranesl()texoxr iu1al   net s  rraur oo1apt iiciytlm umnmp;() exoxo oadlpDrauvsl( s2umio3iy1aleelfcta(  2rmu onu0aptomfciysfs2raump;()alenmoctotomtr uvils t2toim3iudll e icsasfaDtax oot4aeen oeils a2rlu p;(0tltnircoydfatean il()teum(rpny1apte nvs s)a2raumono0olxn f3iadlsDrl(vp u)altrirctytom eai ilt)srtmxrpno1apenlfvs ( s2rm(r ot0aeeoioeiytfmDumnmsn(0arxoxf3oydomt anvi;s0seuoirpny4ome lfci tfaDtrxm ;o0altnmoctyd s2umu snt0 eerxf iadomtrln ols) exmir nu4ll   ietat)aDrauroou1altn ietltls2ul( ont0tlxnmr3ty1late neo s)t2xoimpiydalenlnct t a2uaxro;t0optoifctysfmDua( o;t4tltoxf totoa e uvs;(0trtmio nydlle lici s)artrumont1olt  ictlslaDuan o;u)tlxoifciydfp e ieo t)tetm(m3iu4alt lnvi ( s2rrurono4teto oeiys s2umnvo;u0 rxomr tytfmt aiei (0srtoirpou4apenmnvta() rur(m ;t1tlxnmf3iysls el( s ()trxrmo3tytlaDeaivi;t0 rxrxopiy1lltemfvtl(  Draumpoo1ape  ocilt a2elu o;u)tltnmr3iytop  lieilt) etmxm3iydomenmfeiltf Dtau  no0aetnif3iysls2raump (4trxrmf to1oa raieo (  rxrxopiy4al  mieia( artrxr ;t1aetnmieiadfa2emuvon(4aetrio tadfpD  ueolt)setr(m iodoleelnvtasfsDtr(mpnu1oet io3iltfa elnvonu0 exnir ia1omD auvo s0 2xo(r ny4ap e feslsf 2tm(root4opt moeilt mDelnvs;(4arxrirciatfa e uvo;t0 rto(opoudlmenmnetl( srtruro;t4ape mieiasfsDrm(vp u)aetrxr3iy1fat lnesls  etmio3io1amt lncs () rraxr ;o4alx  i3iltlm emump;t4arxrmf3iotlpDelueolt0trurxrpoydaptnlfvs t  2tm( o;t1tlxn f3tyd mDuanmo t4 reomr3oadoptelivi;s srxr(r3oy1ope lics (  rta(mo;u1tpxo iciasfa ea( o;u0tltomocto1fpteaneo s t2uo(m3nudlmtelivt (  rtmump;u1tpx moctltla2umn o;t0altrxf ootlm e uvil( t2uoxo3ou1llenlictltfartau poo4tpxo f3iyt a2ranmp t0alxnifcoytlmtraneols)t2um(r3nu4altn iei sf rurxrp;t4aee mocild m2ua( s;t0trtomocia1fptrlueo () 2xrxr3oy1ope  nvsltfaDraurpnu4tetnio3tad sDumn o;u0 rxoifcio1omteaneols)tetrirpnu1om   nvtatfsruaxrpnt1apx moeiyt a uanms;u) rxrircoodoateli sl(0s2xrxr3iu4opt mfet sf 2rr(mpno4olxo ieiydlsDeau s;u4 lxoif3oodoaDelivs;s0t2tr(opoodam elfctls s2ra(mo;u4oeen oeildlaDrl(mo t0 leomrcoa1faDrln i t0trxoxr ny1ale lies t aDrrum ;u1oexnio3tytfsDulu pnt4 rxrmr3oatfm r ieo;s sexo(r nudapt  ieslsfsrua(  oo4oet mo3iydfa2ulums;t4alxnmr3tadoa r n i (0t2xrim ou1am n fetls)s2trxm ;o1tle  f3iad sDumums u0alxomo oy1opD  ivols trtmxm oy4lmtnmnvsat)artm(mo;t4tlt  i3tadlm2rm( o u0altrir3ta1fpDr ueo t srxm(m3iodlp  mncs ()aDumu  ;o0oet ifctyt a rl( s;() lxrxo3io1lm eanvils)srxoxo ou1ol   fetatfaDum( o;t4tle iociyt m uanmon()texrxr tydop eluvi;s  2toio3nu4olt  ietas s2trumo;o0oexn i3tls s uluvonu4alxrxrcoadlmte nvi t  euo(r ou1omen netatf 2ta(mo;t0optn o3iatlm2emu s t4 reomfctytomDr nes s  rxrxmpoydomenmivt (fsDumumooo1tlt mi3tasfa2umuvonu)aexoxf iatopt an s;(  rxmirpiu1lme  fesatfaDtmxrpnu1oleo ieiydlaDemnvsn()aeenir tydlmtrluvolt) 2tr(o3no1aptnmnctatfaDrrx ooo0tpto i3iyslmDea( ont4 renxo oo1opD  ueols) etrxr3nu4ll nlfcsa(fs2rau ono0oltomoeilsfa rl(msnt0tltomr totop   ieols0tetr(m nudamtelnvs (  rua(rpnt4tet  ieiad a rlu pn(4tlenir3totfat auvsl(0srxoio nodlptnmneil( a2rmuro;o0tpenmf3tld sDumn o;u0trtnir tytop eln o;s trxrim3no1om nlivi (f 2taum no4tleomieilsfm ul(msnu) leoxf3iotoatrlu s;s)texmxo3no4aptelfvtas) 2ur(  nt1opeomfcild m ul( s;t)arermfcoydfpDraivs t0sexr(r ou4lmen iviltfa2urxm ;t4aetnmf3iydla emums t) exomfcia1op raieo;s trtm(opiudlme lietas srta(monu0tlx  oetydlm ean s t0 rxnircoatop  aneo;(0 2uo(m nudolenmfctat)s2urxm nt4aexo i3ild a2emn sn(0 renmr oo1fpDrlieol( trxrxr no1aleemfct (  2uaxmp;t4ope moeiytla2rau p;t)teeoifcoatlpDelnei;()teurxm iodlpeelfcilt s2umx  ;t4tpto iciys s ra(vs;t) lxnio iy1lmtrau s;()t2tmir iu4aptelnvslsfsrtr( o;o1opxnifctys sDrm(mpnt0 lxomf iotoaD auvslt srtmxr3oo1am nmnvtl(f Drm(mpoo1oeen oetyd m2el(ms;t4tlxrif3oa1opteaivil( srto(mpnydopeeliesatf Dtr(  ;t0apenmieiad mDuln s;u0trtrifciodom   uvols  2xrxmpio4lp  mnci t) rtr( p;o4aee  ietytla2umu s t0altnxrcoy1fp elivi t)s2trxrpoo1am n fet ()aDrmumont1openiociadlmDelu snu0alxnmocoatoptelueslt) 2xoxmpny1ol  mfet (fartru  ;o4aeenmoeiltfm rln p;t0 eenmo3oa1op elivi;(0s2tmimpoodal  mfvs (fsDrr( onu4olenmfetysla2umu p;u4tetnif oa1oatrluvols) 2xmir nodoltemiei sf Dta( o;o0oee ioeild s2uanvo;t0 ltrircoatoatr ivol( texrxr ou4ap nmnes tf Drrxmooo0oeeoiieiadla eanmpn(4 eenio3iadoat au ilt)seurir iy4op e fvi s)s2rr(  nu1oleoio3tytfsDrmnvp;(4alxnmrcootoaDran s;s) ruoimpoy1lmte nvil( aDraxr ;u4opeo ociydfa ul(mo t4 eerif3tadfmt  u o t)t2tmimpnudop e fvta(  Dtr( pnt1opx mf3tydfa2rmuvo;()arxoxo iatoat lu i;s) exo(r no4aptemiesltfaDuaur nt1opxn oetltlsDrm( s;t)altnmr3ta1fmD ai o ( tetrxopiy1omtnlfcsa(f 2taumonu4olx micilslsDumnvs (0areoxf3to1faDelues;s0 2xo(o nydlmen ivtltfa2taxmpot1aex ii3iasla eauvs t4 etoir ia1oatrlnvs t)trur(o3oo1lptelncta(fs2urxmpnt1oltnmi3iysfs2ulums ()tetnxrcia1optelnvs t t2ur(r3oo4amtn fvi (faDur(moou0oltomi3tlt s ul( sn() exomf oy1laDraies () rxr(r3ou4alt mnvslsfs2raurp;t0aetoiictltla2ea( s;t0 eenxo3ootlpDr ivilt0 rtoxm nodlm  mnvt s  2rrumooo1tlenmociyslm rau onu)tlxomfciatfm  lueo;t0tetr(o io4ole  neslsf 2rau  ;u0tlen fciytls eaump;(4alxrio oytfp rau i;()trtm(rpiydope  ivia(  rumx  oo1tetnmieilt sDulu pnt4aeerxf tydfmDrli o s)s2uoiopny4om  mfvils) Dtm(  nt1ope iiciatfsDrl( onu0tlerxo3ia1lat au sl( srtmim ou1alt lnvt ()srta( pot0alx iieilsfm2ulu s t)aexomf3tatla e ivilt)texmim ny4al nlivta(farrru  ;o1tleo fctas a2ea( ont)tetrir3todlptrluei;() rxrxr iodll nmfei sf Dtm( pnu4aeto ieildfsDumu s t4trtoif3ootoa  lu o;s)seuoio3iu4lpte nesatfsDtrur ot1oet mi3iytlaDrl( snt0teeomo iy1opDe nvi;()s2tm(r3nu4amtnmivtas)a2uaxm nt0tpto i3ilsla2rl(mo;u) rtnmociadopDraieo ( s2xoxopny1apt mfvtlt srurxronu1optn oetlslsDeanmont0alxriocio1fmDeaiei;s tetm(o iu1aptnlici ()aDtax  ou0tltomoeiatfaDum( p (0 lenio3iy1la  anvs t0 2trxmpoo4altn netat)arur(m no4tlxoifeiys a rlnmpn() rxoio3iytfp rauei t  rurxr3oy1aptnlnvi ()srtaur ;u4oet mf3tysfs2ulnvsn(0arxoxoctytfpt  u olt) etoxmpny4lmte netas)srur(ro;t4tlx moeiltfs ea(mpnu0arenmrctydfmtr nesl(  etoir iydaptnlfes sf 2uru p;t4aex mo3taslm2rauvo t4texrio3oo1opte ueslt) 2tm(o nu1omeemncsl( sDtrurpnt4altnio3ilsfm2ulnvon(4tetnir3iotfmDr ivols0t2xo(r3iu4ol nlnvt s  rrrxrpnu0oexo i3ilt aDrmn o;(0aeeomrciotlp   uvo;(0 rxoio iy4apeeliesas a2rau pnt0alxo i3iatlm2elnmp;t4alxomf3oodopt  i s () 2ur(m iodapteliesat) 2ur(  ou1oleoiiciad aDraumon(0tleoxfcta1fa  lneo (0trtr(o oo4om  lncsat s2ta(mpno4opto ocild m rlnvo;u)texrxr3totoaDrliei s0 rxoxopnudamenlnci sfa2ra(rpnt0tlto o3tlsfs rmump;t4 etomo tatlmD anei ()tetrxm nodlmeelnvsas)aDrm(r nu0openiictyt a eaump;u4 reoxfcoa1la rlnvils0seurxm ou1lptemncta(fs2rrx oou0ope mfeiysfs2eluvo u) rxnmo3tydlaDeaivs t0 eto(o3io4amee fvi t  Duaur ;u0tpxoioetas a rmn s ()arenxfcio1fmtelueo (0truoxopou4ame lnctltf rraxrpno4aetoifeiysls ua(vo;u)trtnxr3oodfmD  uvslt0srtoxmpny4op emneslsf Drr(  nt1aet mfetltfs rmnmpnu4 lerxrctadlpDeaueols0teum(rpio4omtnlnvtat)a2rmx  ;o4opeoioetldfa ua( s;u)aetnmoctadlaDe u i;s)trumxrpiodole mieia()aDtm(mo;u0oltnmf3ild m emu p;(4 etrio3oatfaD  ues;s0 rxoxm nu4lmtn nvias) rtm(mp;u0olxo o3iad a2ra(mo u) ltomf to1op   u o;t srxrxopnu4lmeelnesl(fs2rrxmooo1apt iieildls2em(vpnt)trxnxoctadlpt au s;() rxoirpnydlpt mncs t)a2tax ono1oexn feiltfm rl( sn()tltrxr ta1fat  i ilt0 euoirpio1lmtn fcta( a2truroot0oetomicildfm eaumo t0aeermo3iodfmDe n i (0 eumim3nudap nlfesl(faruau pou0oet ifetld mDuau s t0 rermr tydfp   u s s) 2umiopiydol nmfetls)sDtmxrp;t1olt io3ild a2rmnvo;t0aleoxr3iydlpDr nes;()sruo(r3ny1ome  iet t)artm(rpno4teenifctas aDra(vp;t4aetnif3oadlmteau s;( srumio no4oleelncia( a2trxm no4texo f3ilsls emu p;()altnxrcoodfm eai slt0 exmimpio1lp  lnet tfartrx pnu4aexnmo3ild s2umuvo;u)trtomo oydopDraies;s)seuoxr nydlleelietatfaDtrump;t1ale mo3iyt s2eaumo;u4treoxr3ty1lmt auvo;(0 rtmir iydape mnvtl(f rurxrpoo0tlxo ieils a uau p u4 etrir oa1fp r u i s  2urim ou4om nlneta()aDurxro;o1tptniociatla2eauvsnu0alenif3tytfmt  i s;t)s2xoxr oy4open ivsl()sDtr(m ;u0tee miciatfaDumums;u0arxoxrctotlptr i i s)setrxr no1alt mfciltf Dtrxmonu1apxoifciyd a uaumsn(0 rerxfcio1lmDrluvo;s t2umim3no4lltemnvsl(fa2rrx p;o4alx ioeiytls2uln p;(4 etomr3tytoat  u s s0srumxr3nu4al elfei (fs2um(m oo0tpx  ietatfmDemn on()tltomr3oadoa eli sl()t2xrim nudame mfcia(  2trum nu1oltn ociydlsDul(vs u0alxnmo3iatlp elu o ()t2tmxo io4lpt lnesat a2taxr ;u0texomiciydla2um(mo;t0 lerxr oa1om ean ols0trxmio3iydlp  micsltfsDrm( pnu0tetnioctysls2rlump u4teenif3iodfa rlneol(0 rtrio3no4lmt  fvslt) rta( pnt1olt ii3tytlm rm(vp u4tlxrxfctotfatr i i ()t2xrio3oy1ale lnesat) 2taumono4tpeo oeiatfa2umn onu0aexnxr3iadoaDe ieil() exo(o3iudopt  fvtas sDrr(m ;o0alto octasfs2rln s (4trxomfcio1om elivil(0setmiopiy4lltn fvta(  rtaxmp;t4tee ii3tltls eanmpnu4trtomo oytlm rlieol(0s2uo(o nu1opt lnvs tf Duru onu4apen iciatfs elums;u4trerxfcoa1omteaueo;s0texrxo oy4ap  lfeilt  Durx  ou0tltoiieils a eln o ()alxoir3ootlm   n i;t)s2uoir iy1ameelfcil()s2tau  ;u0aptn iciatla el(mp;t4 etnxo iodlp eanei s s2umxrpoy4lmeelfeslt)a2raur no1tee  f3ilslmDul( snu0 rerifcoatop rai ols)seur(r oo1lmeemiei tfs2uau pou1tleo o3iysfmDumumonu)altrio3oydfmD li s s0 etr(rpiodopt  fcsa(  2ta(mpou0alt mo3iad s rmnvo u)aeerxr oydfaDe iei t0seumxopoydoptnmfcilt a2trumooo0apx mf3iasfsDrau s (0trxoxociotla eliei;( teurim3ou4aptnmfei s)s2urx pno0tlxn oeiysfa2rl(mp (4 renio oa1laD  ivi;s  ruoir3iy4lm emfcsa(f rtmxm nt1oexniiciatfm2raums;t4texnmo3oy1lm eaues s0 rxrio3ou1olenlnci s aDtrx  ;o0altomo3ild mDel(vs;t0trenxocoydfmDrau o;t) 2xoxo3ou1aptnmiesa(fsruau  ou4optnifeiad a ul(msnt0aleomrcootlmDr n o t)srtoimpno4lptnlivtl(f 2rax  ou1oetomi3tadfmDea(mo u)teermr tydlpD luvs;t)srxrim nu4om elicsl(  Dtrxrpoo0texomf3iysls el( s (4tetnxo oodlatrluvol( texmir3iudamenmnvi s s2rmu poo4aptomfctydlsDum(ms t4 lxnxo iotopD liei (0t2trio3nu4ale  nesa( srra(mpoo1oex  i3iydfs2ea(msnt)tlxnmr iotoateli o (0texo(o nudamt  icia( s2rmxmpoo1oeeomi3tltfm umnmp u4 rxomo oo1oaDrlues;t srtm(r oo1lpenlnesasf 2rmumpnu1tpenmieiytls2eaumpn(0tltriociytfp rau sls0srxoxopnydal  lfvtatfs2trx  oo1olt mietat a emuvs u0tlxnxf3todlptrauvi s0 eto(m oy1alenlncsa()aDtrxrono4tpe moeiyt aDemn o;() ltoxr3tydom   uvo s)trumxo3ou4om nmfcilt) 2urum ou4tltnmfctasla2rau p t) lenxrctatom eln ol() etmio oy4op n fetasfaDumurp;o1tptniocildls ra( p u)trxrifcio1op eau s;t)s2umimpnydlpe  fetat  Dtmu ont1ope  fctat aDrmu s;t)teerif iotomt lies;()srtr(m iu4om   ncil()s2tmxmpou4optnio3iatfs2rlnvs;(4 renif iytlp e nvils0 ruo(rpoo4om  miesls)sDtmxm ;o0olenio3iydlm uan p;(0aeerxo3tydomt  ivsl(0 exr(o3nodalenmfcsls)arrru p;u0alx  fctlt a2rmn o u)trtoioctydfa eaivo s0setmirpiu4oleemneias  Drm(m nu0tex ifeiasfa2rlnmo;t4altnxf iadfp   ivo;s0trxr(o3oudaptemivtlt)srrr(rpot4teenmfeiasfsDemu s () lxnir3to1opD aivo s) rurxopiydom nlfesl(fsrraum ;o4tptnioetatlm2um(mp (4arerxo to1lmD aues t0 rtoxm no1amenmfvs tf rrmumpoo0tee io3iasls em(vp;t0texrxo3oa1lm r uvo;()seum(m oodllt  nvs s  rua(r ;u1ope ifeildfsDraumon()tetrio to1lmD lu olt0 2tr(r3oydome lneslt)a2tr( oou0olenii3tad sDraumpnt)tlenxf3tatopt li slt  2tr(o3iodlptnliet () rtru  nt4alenmoctltfsDrm( pnt4teenir todfmt livilt)seuoxmpno1altemfcs ()sruau p;u0aptoifciys s rmnvo t0 rtrxr3oatfmDrln i (0sexoir io1amt mnciltfaDtmxmo;t1tpxn f3iydfa eaums;(0 rxoxr ia1faDeanvs s  etrim3oydlp e nvtlt sDrmx oot4oexniicildfm rln s t4tlxoxrcoo1oatr nvi t)s2tm(m3oydape mieiat sDrr(mpnu0oltnifciys s2umn p (0trtnifctatom e ivi;s seuoxr iu1op emnes ()artm(r oo1tpt iiciltfm umnvsnt0trxomrcoatomtelnvol() rtoxr3iodlle mieil(farumxront1aeeomo3tysls um(mp;t0alenxf oadopDeaneo;(0 2xmio3nodap  lfcsat)arumumont0aetomoetas s emu o;() rtoiocoo1oateaivo t teuoxr iy1lp   nei sfarrru poo1oetomoeiadfa ra(mont0 reoxo io1la rli ils t2umxr3oy4lpte ics s s2raumo;t1oeen i3tltfa rlums ()artoio3oa1fatraueo;t)trxoxo3oy1ape  nvs (farrmumpnu0ape  icild a2umump ()aetomf ia1faDrli s;t t2tmxm iy1lp nlfci t a2uau oot1aex  o3tys a2rlnmo u4teenxf3oo1faD aneslt0srumxopnu4ale  ictlt a2rru  oo0apen fetyslm ulnmp;t4arxrxo iydfmtr uei;s0t2xoxmpno4lptnlies s aDtr(rp;o0tlxnmietasfa eln o () lxomf oytla r i ol(0srto(r3oydlm   feiat srra( o;t4alxoifctltfm ea( snt4 ltoxocoadoaDe neols0 rtr(r3oo4opte ies t)s2uax o;t4apxoif3iyslaDra( p u) rerxo tatlmDrlu i s0 exrxr3io4aptn ietl()arrax ont0apenmoeiydlm ulnmo;(0arerxf3tatlm   uei s)setm(m ny1llt lneiat  rrrurpnu1olt  i3tat aDran s;(0 exrio iadfpDeln il() exo(r ny4ope  nct ()sDtrxmp;o0alxn oetas m eau o;(0trenxf3iotlp eaues;s)s2umirpoudllte fet sfsDrau  ;u1altnifcildls2rm(vs t)aleomrctodfa rau o t0 eurxmpiodapt mnvt tfsrtmx pnt4aexomi3iytls ranvonu0tetnifcto1faDr n o s0teuoxr ny1op nmnes sf 2ua( p;u1tltomfciltfaDul(mp u0 rtomr iodlpD auvo;( sexm(rpiudlme  nvt ( s2ta(rpnu1opx mo3tldlm eanmon(0tetomfctadopD anvi s s2urim nu1ale  ivtasfs2taumpno4oeen o3tltls ea(mpnt)trtoir ootlpDr n s;(0t2uoxo3iy4openmnciatfsDua(ronu4tee mi3ils mDemumo t4 lenifcoadlmDelivo t t2trxr3iu1ole lfvsas)sDumxro;u4olxnifciysls2eluvonu4arxnxf3tydla r i sls)teumirpoy1altn iesa(f 2tm(  no1aexomo3iatfa eauvo u) etnxo oa1op  lnvi ( s2urxm3io4openmneslsf Drrxmo;u4alxnifcilslaDeauvo;(4treoxrcio1lm raneol(  etm(o3iy1ap emfeil( sDtmxro;o4oetoif3iys sDumn s u4tlxoxf3io1oatrln i s0t2uoxrpny4lpenmfct s) 2raumo;t0apt  ociadfmDel(ms ()aetoioctotopt luei s)s2um(m nodamtnlnvtasfaDuax poo1oetnmi3iad s2em( ont) etoxfcio1lpDraieo;() eumimpny1lmtnmfvs ()aDum(ronu1opxomfcilsla2rlums;u4teermocoadfm  aivil()texoxmpiu1ol nlnesat) 2rr( pno1oet mi3iydla rlnms u)texoio ty1om e ieils tetoim iodapen icias) Dtrurono1alx  oetld s2elu o t0arxnxo3oydoaDrlueo;t sexo(m no4op elfci sfsDtaxr nu0tptn iciasfa uan p;()artrif3ty1laD  nei s0 rxrio oy4lltnmnvt t) 2rmur ;t0aetoiieiatls ul(vsnu4artoxf iytfpDrlnvo (  2urxo3iy1lpeelivi sfaDrmxrp;t1alx moeiltls uln pnt0tlxnir3oodlatrli s;s)srxr(opou4llen ict ()srur(mont4oltnmfctatfs2uln onu0tetomf3ty1faDe uvsl(0 2tmxo3oo4lmtn nvt sfaDtaum ;o1aetn iciadfs2eluvo;t4aetomfcoadfaDrlu o ( t2uoxm3oydlpeemnetasfaDrm( p;u1oeenifetyd sDrl(mp;()arxrio3tytfpDelivs;( t2xmir3oydlm  livia(fsrrru  ;t0tptnmfeiaslaDeauvsnt0alxrio3iytfmDr i s;s srumxm ny4omt lfcsa()aDrau o;u0tlxniictadls2rauvp;(0tetrio3ia1fmt auvslt0trumxm3ny4lleelfvsl(f Dtmxm ot4aetomf3tadfs2uanmpn()areoif todlmD au sl()t2uo(rpny1olenmnci sfsDtrx pnu0apxomo3tytlaDuanmpn(0 rxnmf3ty1faDran o;(0 eur(m3nodoltemivsas)aDrrx  nu1olenmieiyd mDrln s t)alenmf3ty1omtr ues s t2trxrpiu4ll elncilsf rtr( o;u0teeo ociydlm2ra(mpnt)trxnxo3ty1lateln o;s0texmimpio4lp e fet tfs2rmur ;o4oetnioetlt a2ua(mont)aetomocoa1laDrlu s;t0 exo(mpnu4om nmnvs s  rtmu onu1tex io3ilt aDrm( on(0altrmocty1fpDrau i;t0 2umxopou1opeemivsasfsrrmur ;o0apto fetatls2um(mpn(4altrio3to1lmDraivo (0 exrim iu1al elnesls)srtm(m nu4oeeo iciyt sDrlu ont0altoio io1fp  aueo () rurir oy4optnmnvtas) rtmu  no4oeen iciydlm uaumsnu4tetnmfcoa1omt au ols  rxo(r3nu4omtnlfeslt)aDua(mpnu0tle ii3iydls2rmu s ()teenmo oodfpt lnvo s0trtmim iy1ap e fetas  2umxm ot4opt mfctys s2rau o;(0tlxnir3totoaD au o (  eurxmpnodll nlieias)a2ur(  oo0aexomoetas aDua(vsn(0tlerir ootop  livo ()srxmim nydalt lnvtl()sDta(r ot1tetn ietydla2rl(vpn(4 lerxo3iydoa eluvil( seurir oy1omeemfviatfa2ra( pot4tex mocilt s em(mp u0trxoirctadfmt  uvslt)texr(m iydlme  nesltfsDrmxmooo1tee mi3tlt aDelump;t4arxoioctotlp e ies (0t2xrxr3oydalt  icsltfartrumo;o0aleomi3tytla umumo t0 ltnifcio1opt aueilt0seuoxr oodlpeemnvt t)srtmx onu1tlxnmietlslm ra(ms ()aetnmo oodom rauvs;t)srur(mpoudame mnes sfsDrm(  ;t0oleoiocilsla ulu o () etrxr3totlpte nvslt0teuo(mpnu4ope lnesa( srtaxmpnt1tpenifeiatfa2ulumpnu)texomr iy1laDrau o () eurxr3nudomtn ivi ()s2tmxr ;u1tleo ieiadfs2uanvp t4artoifcootfp ran s;s0 rxr(r3oo1om   nctlt)a2rm( ono0tpxn ociydla2ra(mo;t0 etoio to1fp   nvolt tetrxr iydll  lfcs s s2tmxmpnt4alxn f3tyd m2ulnvp () eenio oy1lpt aneils  exmxm iu1ap nlnvs ()a2tmx  oo4tpx  icilt a eanvpnu)trtrmoctytlateliesls) rurxmpiu4am e nvt t)aDta(r ot1alxo oetasfm2ea(vo t4teeomr oo1op eauvi;t srur(rpoy4lm n fetas)sDtmumo;t1texoioctlsla ra(vs u0tetoxr ia1laDeluvs s0texmiopoydll e fct s artrxmp;u4texoii3ildfa uauvp (4alxnxo to1oa  aiei (  exmxo3oo1lptn neia()arururpou1oltnmfctlsfaDranmonu0tlxrxf3oodlaDeai ilt0srxoir oo4opt mfvt t s2ua(rp;t0aet ioctad m2emn s t)tlxrxocoatlp eai ils sexrir3iydop n fetat aruax  ;t1aptoii3tydla uan snt) ltoirciy1faDrli o (  2um(o iy1opt lfcsasf Drrump;u4olxnmiciyd m2ea(mp;t0trxrmrcoytlaD  n o s) etm(mpio4ameelfctas s2rmx  ;u1apt ifciytlm2rl(mont4 leoir3iatopDe nvs;s trxoiopiu4ap n feia() 2trxrpnu1oltoifeiys mDrlnvs (0tlenxrctydfmD  ivo () etm(m3iu1oltemietasfsDtmumo;o4aptoif3iyt m2uauvp;t0 eerxfciy1latr n ols  rumxr nodol  mfvi ( aDrrxrpoo1alt  fcilsfa2umn o t)aexoioctydlaDr i ol(0 2tmxmpnu4lleelieilt)sDur( pno4opxo ietysls2umuvs (0teerif oodoa eaivol(  2toimpnudol emfvsa()srumuronu0aee mfciyslm2eaumsn(0arxnirctotfm eau ols)t2xoirpoy1lm e feilsf 2rax  oo0tpxnioeiadfa umump;t0aetoxo to1lm r u o;s0t2xoxm3oydlme  nvt sfaDtr(mpot4teeniocildls ulumpn(4trtoxocoodomtraueo;s0t2xo(o3io1lme  nesatfsrtrx pnt1tetnmf3iyd s2um( pnt4alermo3oodopD lnvols)trtmir nu1lleelnvi s)srtm(r ou0apx iociysfa2ranvo;(0 rxnmf oodlmDranesl( trum(mpoo1optelnesas) rrm(mpou0oexnifetldlsDrln pnt)tlxomo3oa1fa eau i;t0sruoxopoodape  fciltfs2uaxm ou0tltn iciadfs2ua( o t) etoir3tydlm  li slt) eum(o iudopenmncsl( aDur(rpno0texnif3ildls2ul(vs;t4tetrmr to1omDe uvils0sexrxr nu4apt lfvtasfa2uaumont4olt miciytlm2ua(vp t0 lxoio tydfa  ln s;s teurxopoydam   ici (f Draurp;u1opxnmfetad a2eluvont4artrmo3oodfmD  uvo s0t2tr(m3oydol  lict tf rtrx poo4apeo ictytfsDrl( p;u0alenxf3oy1lat lieslt s2uo(m oodapt mnvtltfaDta(mpoo4alenmfeiadlsDeln pnt4trtnif iytopDrauvsls0 exrxr3nodlp  mnvi t) rrr(rpnu4tpx ii3ias mDrm(vsnu) rermr oa1latraieo ( t2urxm3iudapee ivs () 2rr( o;u4texomicils s eaump t0aetoirciatop rai o t  2trxmpoy4lmtelnet t) 2tmu ono0optniieiys a2ean s;t0trermo iytla  livo;s)seumirpou4lp e ncsasfs2umxmoot1tptomietldfs2ul(mpn(0 lxomr iadlat lu i () rtmirpnu1ll e ncsls sDra(ronu4aeeomfeildfs ua( p u4aetrir oo1op ean o ( srtrim3nu4lptn ncta( srtru o;t4aleomo3ilsls umnvon()arenmf3iydfmt lnei t0trur(r3oudaleemfvia( aDua(ro;o1ope  ieiysfm ea(mo u0alerxr3oatom eau i;s0t2urxopiy4apt lies (f Dtr(  ;u1aexoifetadlm uanvs t)alermf3oa1fate neil()s2xrim iy4ope mnvi sf rrmumpnt0altnifetld a um(vpnu)trxnifcoytomt  u s s0 2xmir3io1om n ivtas)arta(mp;t1opxo fciydlm ul( snu) etnmr3iy1lptraueo;s0s2ur(o oudllee nvtls)sDrm(r ou1apx mfctytfsDuauvo t)areoxo3oo1laDr uei t  2urir3iy1altn nesa() Dur(r ;u1ole if3iys aDranvp u0treoifciatoa eluvi;t0 2xo(o iodol elfcils) 2trx poo1aex moetldlm ra(mpnu0 etoif3ty1la eanes;t srxmim nodalee icilt sDuaurp;t0aetnmo3iltfs2rl(mo;u) eenmrciydfaD  u ol()trumiopiy1lpee iviltf rtrumpnt4aeeoiiciaslaDraums;u0tleomfciytom   n s s0teto(o3ny4lmtnmfeias a2tmx  oo4tpxomi3ildlmDrluvo;u4 rtoio3iytfaDelies s0s2xmxr io1omen nvsat)arrm(r oo0tpeomf3iydfs2ulu onu0 rxrxfcta1lmtraivi s0s2toimpny4op emfcsl() 2tm(m ;t0tltn icils mDrlums;t4alxoxrciytfmDranesl()texm(opiy1lm emfetlt) rtm(  nt4tptnio3tlslsDul(vp;()trtnxr todomt ai i t0s2tmxm3io4amee ncs (fa2rm(mp;t4ope mi3tydlsDeanvpnu4aleomfctytfa eluvolt)sexm(r3nu1lm  liet t)srumx  ;t1oltnmfeildlsDrmn sn()tetrmfcoo1lmt  nvols0texmxmpiodlmtnmfetatf rraurp;t1tlenmoeilsfm2elums;u0 eerxr3iotfmt aues;( t2xoirpoy4aptnlfeils) Dumxr nt1alx mi3tlsfaDranmpnu4 rerxo oa1oa raieol() 2tmxr3oydlme  icilt) 2uaxrpou0apxnif3ildfs2ua(vp (4 lxomo3iodoptr n slt0t2urxo no1omenlfvi sfa2rrumoot1apx moeiltlm rmump (4 ltrio oytomDeaivil(  2umio oydapee fetasfs2rrx o;o0opxnii3tytfaDuan pnu)tltniocoadlmDeli sl(  eum(m3iodomt lfctat aDua(mo;t1alenifetat mDea(vo u4areoxo io1fp raivi;(0 rtrxo3oudoltnlnctat  rumxr nt0oee mietad a em(vs;t4 lenxf tydomt anvs;() exrxm3no4omt mnetls)a2tau onu1aexo ietldfs ea(monu)aexnif iotlpDraiei;t  2to(o no4ameelnetat  rrmu ooo0tle mieiad s2ua(von() exnio3to1fptean o;s0 2umir nu4omtnlfes (fa2tr(r ot0tlenioeiaslm2ra(vp u) eeomo3oy1fpDelieo;s)trxr(opoydal  lnctat)s2um(roou0apxo feias s2uln o t0 exrir3ootfmDr ies t0sexrim3nodop elivtas) 2tmuroot4opx  ieiytfm rm( pnt) rxoxrcio1optrai ilt) 2tmir nodaltnmieia(  Dua(mo;u1oltnmieils sDranms;()trenmr iy1lmte n i;s0trumxopnydlm n fei t a2trur ;o4ope mietytfm elnvs t) ltrxr iodomt li ols0t2umxopiudomtelfes s)srraxrono0tlto o3iyslmDeln p;()tltrxf3ootfa  ln sls  2toio oodomtn nvtat  2ta(mono1aexnmfciytlm ul( p;t0 lxrio ia1omt luvi;t0srtmxr iy1lmt mfeiltfsDrmum nu4tlen f3tltfaDrmnms;(0 reoio3oa1lpDeanvols) etmxr3nydll nmies s artaurpno0oexo ieiydfm2ean snu)trxnir3ta1lmD  nes;s) 2umir no4altnmfetat) rrmumpnt0openif3iysls eaumo t) rxoxo todoaDelu s;t)t2ur(m3iy1oltemictas)s2um(  ot1opt ifetys mDea(ms;()tlxnifcoa1om   uvo s  etrxmpoy4omenmict t  Drau pnu0olx iieiadfm emu pn(4 lenxf3tytla elu ilt0teur(m iu1lltn fvi s a2tm(  no4aexo oeiasfm2rlnvsn(0 rxoif tytfat anes s) euo(rpoo1opt lietasfs2urumoou1aetoii3tatfm2emnvsn()aleoifcio1fmtr u sls  rtoio3io4ol nmnviat) Drr(mpou0apx mf3iad m2ranmonu)aeenxrcty1op rlues;t0 2xo(r io1lpenlfesltfs2tr(mpnu1oeeo feiytlm2em(mo () etnio iadop e uvs;t) etmxr no4ale lfesat)s2rmxrpno4tltnii3iasfm uluvo u0teerxrcoodfat  nvolt0t2toirpno1am n icils)sDrmu  nt1oltomf3iad m2eauvpnt)tltrmo iy1laDraieo s0seumxo io4lle mfvtl(  2ua(r ;u1tet mictls a umuvo (0tetnir oy1oateaueo;t0 2tmxo3iudlm e fcsa(fa2rmx ooo4tpe iictysfa2ranvo;t)teermo3tydlmDranes () rtr(mpoo1am nlfvta() Dtrur ;o0ope  o3iasfa ulnmpnu4artrxociodfaDelu sls texm(m oudolt  fesatfsruaxroou1oeenmfeiad mDrlumsn(0 rerircoadfa eauvi s0teumir iudoptnlfvsasf Duaxmoot1tlt iociad sDemuvs;t)aetnioctadfm r n i;t) etr(r3ny1lltn nvtas) 2rmxrooo4alt  oeiysfa eanms;(0alxnmociytoa r ivo;t0 2xoxopiy1lpt lnvsasf Drrxrpou0alx mocils a2ul( pn()trtrxf tydfptrlivs t s2trio3nu1ll emfcias)aDraur nu1texn ociat s2emnms (4trxrmf3oydlp rluvi;t t2xrxo iy4omen ieil() 2rr(mpnu1altnmi3iasla2elumo;t0tltrxocoy1lm  auvo;( s2to(o oo4lp nlieilt s2ua( o;o4olx io3ils mDea(vpn(4 lenmrcoadfpt lnvs t)truoxm iudaltnliesas) Drmumo;u0aee  fetatfaDel(vs;u0arxnir ta1lm  lies s0s2xoxo3oodlpenmicsatfa2umumono4optniieiyt a2eln s;u)arenxocoatlp elivs;t0texm(m oydlpeemicsa(fsrum(mono0olenioetlslsDemu o;t0arerifctodfateau s;t)t2urxrpno1al elfct t)s2rmx p;o1aexnmfeilsfa2em(vpnt)artrxocio1om  livi;() 2xriopou1lpe lics (  Dtrxmpoo1openifeilt a ua(mo u4 lxoif3ootlmt au o t0 rtrimpnydomeemfciatfarumurpot4olxn fetaslaDul(vp u4 lxrio tatoaDeanei;(  exoxr3iodopenmneil() Dtr( p;t1ape moeiadls ean o u4aeenio totoa e ivi ( setoio oydol nmnes ( aDrr(mpnt0opxomieiad m2rl(ms ()alenmfcia1o
\ No newline at end of file
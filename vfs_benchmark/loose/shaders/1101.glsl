@@ -0,0 +1 @@
+i i;s t2urxr nudamtnlfcslt  2rm( o;o0tpt  iciyslm el(vpn()altrif3oo1optrau i;s0setoimpoo1am e nes () rtr(rooo0apeoiietld sDua(vo;() exoxo tytlateaivi () 2uoio3iydap  mnet t) rua(  ou0alxo ieildfa umnvpnu0tltrmrcoydfpDelueo;s0s2to(r ny1op  livtlt  Drmu pot4teto i3iydla eanvp;t4 rxomo3tadlmtranvs s0 ruo(rpio1lpeemfeilt  2tmx o;o4oltnmiciys s2rl(vp t0tleoxo3ty1lm raueils trur(o no4lle  ivs ( srtm(mpnt0opxo fcilt aDrlnvs;u)tltrif3totfmtelnvs;(  2xmimpnu1lpee ivil(  rtmxmpot4olen ocild mDemu o;(0 rtnxfcoadlaDraueolt0s2um(opiydapenlivtat a2uru  nt0ope mfeiyt s2elu o t4trenxo oy1oaDrlnvs s)t2trxmpiu4alte ietasfa2tr(mooo4oleoii3iasla elump t0aetoxf oo1opteaiei t0teto(mpio4aptn nei s  rumumoot1olenmo3tasls ran s;() rtrxfcta1fat  nvils0tetmxopoo4oleelnviatf Duru oot1optnmieiatfm emums (0 lxoxf iadoatr u o s0s2xmxopny1lpt  iet ( sDumumont1tpxn o3tls m2emuvp;() rtoxrcoa1fa eaiesl(  rtoiopnudol nmnvias aDuaxrp;u0oexnmoeiadfsDem(vp;u4trxrmrctadomt  n i t)srxrxr3ny4ap   ncilt  Dtrumooo1oetnmoeiltfs rlnvp;t4altrmo oo1la  li s t)srtriopnu1lme lfcsa(f rrmxr no4oeeoiieiat mDumn s;() eerxo ootomt lu ilt0trtoxo iy4omee fvsat)arum(rpnt0tpx iocild aDea( p u0areoxo3oodopteauvo s  exoirpoydaleemnct (farrrxmpot1aet ifeild aDuluvp t4arxrxocoytfaDr nvo s) rurim nu4ole lnvia(f Dtm( o;t0oltomociasfm2um(von(4texrmrctadfmt ln i;(  2trimpoodopee nctatf 2rrxm ;t4optn i3tlt s emuvp;() renmrciotlptrln sl( t2umxopiudaltemnctat sDuaurono1olxniieiadfa2uauvo;u0trtomf tydopte uvo;s tetrir3oydlm  lfvs (  rta(mo;t1tlen iciydfm rm(vont) rtnio ta1laDraivo (0 2xrim3nu1olen fcs sfa2trum nu4altn oeiydfaDran o;(4 reomo iydlm e neils)srtm(opiu4olte neil(faDtrxroot1open oeiltfa2emnvpnt0tlerxfcoytla r i il()s2urir3iu4op  mnvsasfs2rrum ot0ole  oeiydfa2umnms u4arerifcoydlp eanes () rtrxopnodom emicta()srta(mo;o4teeo ociytls2ulnvpnu0treoio iatoa e i i (0 2uoim3ou4amen fvsa( sDurxmpno4aexnmfetad s ranvp ()tetnifcty1la raivo ()tetoxm nodomt  netas) Dtr(r ou0oeeniociys m emn s;u4 renmf3oydomtrai ils0trurio iu4amt livsatf Dumum ot1aexnmoetldla eaump;t0 rerif3tytfmDr ueils0sexo(mpnydlm   ieia()sDumxrpoo4tpeo feilt m2rl( s;u)arenifcto1laDelueo;(0 etrxrpno4omeemnvil( srurxm ou4aeenmociltlm2uau s u0 leniociydlmte n o;s0 2urxrpoodoptnmfesltfaruau pnu4openmi3iltla ua(vp;u) rtomrcootoa elnvo;s setoxrpio4ap n netls)aDraxrp;u0tle mfetyt s uanmpn() rerio oytfaDe uvo ( srtr(o3iudlmenlnetas aDurx pno4oeto ieiysfmDrlu pnt)tltnmr3oatfmt li i ( trto(r iydaltnmfctls a2rmurpou4ole  iciatlsDrmump t) etrxr3totlpDrln olt0s2xmxrpoy1lm  mneilt)sDur(m nu4oltomfctas aDum(vs t0areoxfcoadopDr i o;t0s2uoxmpnodolenlnvsat)sDrmu o;o1tpx mi3iat aDemn o u4 lenxf3iytla  anei;(  2uoxrpny1omenlfcsatf rrax pno0teenifeildfmDran snu0 lermr3tatlmDe n s;s0 eumimpno1op   ietat)sDrr(rpoo4tee mietytfs2ua( s;u)aexrmo3ta1fm  luesls)trxrxmpnu1amee nvi s)aDtmumpou4oeeoii3ilslsDemnmsnt0altnir3oa1om rluvs t0s2uoim3nu1olee ict sfsDraurp;t1optnmocild mDeluvon(0 renmo tytoaDe uesl(0 rtrio io1lmt  netl( artr(m ot4aptoioetat sDulnvsn()aeerxr ta1omDr nei s)srxr(o3nydlp elieias)s2raxrpno4tex mf3tls m2uaump ()aetoif3oa1omtrlnes (0srtmim3oy4llen iciat a2rr( ono0tpxoifctytfs rlu pnt)aeenxr oo1fa  lu olt) eumxopny1apt  ivi (  rrmxrpou4oexn fciysfaDrm(vp ()aexrir3ia1fpteanvils0seur(r oodlpe mnvtl( a2trxmp;u0aexnmfcilsls2rmumo u4aeerxr ia1lptelues;( teumxo ou4lmtnlieil(f 2raxmp;o1oex moeiatfs2umnvp t0treomf iytlaDelivi;(0trtoio3nu1openlietlt arumum nt4openif3ils m ua( snu0artoifctadlm eauesls  euoiopno4altemfeilt)s2raxrpnu4tptoii3ild s2eluvo (0 rtomocoo1omD auvi;t)teuo(mpoudalt  netl()aDumur ;o0aee ioeiltfaDemuvpnu4 renxo ootlpD an i s0teumxo iudolt  fcsa(fs2rmx p;u0opt  fciad a2uanmp u4 rxnifciotfa r nvs t0 rtmxmpoo4omt  netls  rururoot0tpe if3iydlaDrl(msnu)tetomr3ta1fptrai o t0s2tm(m3nu1altnmnctl(  rta(mpnu4opx  ietaslsDemu s u)artnmocio1fmtr uvol(  etmio ou1ap nlicsa()sDtrxmo;u1texn ieiatfa ran sn()altriocoodlmtr uvil( srxmim3iudop n nvia() Dta(mpnt1oltomociydlaDemnvo (4 ltnxo iadom   uvils) rxm(r nodoltelicilt) Drr(mpnu4teeoii3iydfs rlnvont)tetoxrcoytop eli o;(0seumxmpno1llen fvil()sDtm( o;u1oleniietyt m raumo u)tetomr iotlateau ils  2xmxm ny4ame mnvt ()s2tm(rpnt0aptomieiad sDrmnmp u4 ltomo3oatomt li o;s trto(opnudalenlicslt aDtaxr ;t1openmf3ildlm uau p (0trenxr iatlp eai o;(0teto(m io1ame mfeslt)arumxrp;t0apeomf3iydls2uluvp (4aeeoxocoytfpD aneol(0 rxmxrpoydomte fetls aruaumo;u4alto ociadfm ul(vsn(0 lenir tadom elu i t  rtrio3nodap e nvt ()a2tr(roou4apto ietydfm2uauvo u4aeerir3tydop e ivs ()trxrxrpou1olee ieiltfa2tm( pnt0tetomiciys m2ra(ms u) renir tydfmDeaiei t0 2xrir3no1opt  fvil(fa2trx pou0oeenifciasfm rmn sn(0tlerirctotfptr n i;t0 exr(rpiydap e fctatfs2ur(  nu1tetnmf3tldlsDrmu o;u4trxrio ootlp rlnvs t  eur(o3oo4lmte feslsfsDra( onu4tleomo3ildlmDra(ms;()tlerio3oa1fm e ieo;t srxriopou1optemivsa(fartrx poo0opx if3iytlsDrluvsn(0treomo oy1fatean i;( t2trio3nydlp n feilt)sDrrum nt4tee if3iltfa ulnvo;t0alerif tydlptelnes t srtrxmpiodlm emictls)artr(r ;u0tleomf3ilsfmDem(mpn(0tleomr ia1laDraueils0trumxo3oo4lleelncsat  rrmxrp;t0opt  feiasla rau snu)alxrmf3oytlm   i o s0s2urio oy1alenmfetat)sDtm(m nu0aeenmfcias m2eauvo ()arxomo iytfaDr u i t)sexm(o no1lm   icils s2tmxrp;t1teenmo3tltlm2rmnmo t4 rermr3to1opD  u ol(0 rtr(o3ou4alte fviasf 2raxmooo1olxniiciatfs2eauvo;(4tlxnifcoa1lmt lneo;s  etm(r ou1openmiei s) 2ua(mpno1ole  f3iasls2um( s t0arxomr3iy1laDeanvol( s2ur(o iy1amenlnvils) 2umxr ;o4oetniiciydls ran on()tltomrciadfmDrauvo s)sexr(o iydom  mivtlt) rumu pno4oex  ieiydfaDuanmsnt)aetnmocoytoatelivs (0t2tm(rpny1op   ieiasfsDraum nu0altn ociytfa em(msn(0alxomr io1lpDe n ol(0trurxo iy1amt mietl(fa2tr(mooo1aptoifeias sDrl(ms;(4teeoio ta1oaDr uvils0s2xrxmpio4ol elieil(fa2rmx o;u1aex mf3iytls2uau s u0trenxo3iytlaDeanvi t)trtriopnudope miesasf rtaum ;t4olto oeiyslm2ua( on(4artnxo3ia1lp rlivols) 2xmio3iy1ap nlict (f 2rax ono1olenmo3tasfa emnms;t)aexoir iatlptraieol()s2uriopou1ap n iet tfs2rrum ot4oexnmieiatfa emnmo;(4 leomr3iytfa  livolt)texrxr3oy4amen fciltfaDrrxr ot4oeeniicilsfsDrlnms t0 exoxfctytlp elnei t  rxoxo3oudom   ivtl( arraxmo;o4altomieildlm2ranmo ()aetnioctydlpD  u s t setoim3oudop  miei s)sDrm( ono1tex mi3iat m2ua(mo;(4texnxfctotlptelies t t2ur(rpiydamt miet ()srrm(r no4aptnmo3iadfa2ra( pn(4tlxrio iatlm rli s;( tetoxo3no1lmtn fesl( a2umuro;u4oltnifetlt m2el( s t)trxoxo iatfatrlivolt trto(r nu1al   fei s srurxr ;o1aptniictltlaDua(mp (0 rtomrctodfmte u s t  ruoimpio1omee icils) Dtru p;o4opeoiiciydfa rlu o;() ltrif3iadomt au i t  rtoxrpno4omt mfci s)a2umuro;u0altomfciyslm raums;u)teermf3ta1oaD auvo () etoxr3oodlp  lnvil()aDtmxr ;o0tetomoeias s uanmsn(4artoxf tydfm r ueo;s0tetr(o3nydap e fcs t srtmxroou0tptnmfcilsfa2elnmon()tlerir3to1fp r ivil( trtmxrpiudoltnmnetl() rurxr ;u0opt  i3tasfmDumu s u4 rtnxr oadlmD livs;s0s2toirpiydaltemici (fs2ua(mpoo4tpeo f3iasfsDuauvon()alxoir tydlaDr ivo;t0truo(rpiydol e neiasf rrmx ooo1olx iiciytfmDumu sn(4 lxnmfctodlmt  ivo t) etoxr3no1lle  nvsat s2tau ono0tpx io3iyt a rmnvs t)arxnif3ty1lmt au s;t)trumio io4om nlnvs s) Drau ono1oetn o3iltls ea(vs;(4trtomr tytop rluvslt trtoxm3ou1omtemneiat)a2rrxmpou0apxomoeiaslmDrln snu)aetoxrcto1faD anvi ()teurirpnu4llt mneia( a2rrumono4tpenio3iadla2ra(mp (4tltomf3oodom r ivslt0t2tr(r3nu4ameelnct t srtm( oot4oltnmfeiysfmDel(vp t4 rxoir3ty1fp r ueo s) etrxrpoodam   icia(  rumumo;u0olxn ieiyd s rl(mp u0artrxfcto1fpt anvo;t0 2tm(m3nodoltnlnetls) rumurpot1tee mfeiyd sDelnms;(0 lxoxo3iatfptr nei;t srtrio3nu4ome miesl( a2urxmo;u4aexoioeiysfmDua( o t0areoir3oa1lmt aies;(0seuoio3ou4omee ietls sDtrxmp;t4tlxoiietadfm2uluvs (0trtoxfctydomD livi s)s2ur(o3ny4ape licia(faDtr(r no4opxomictyt a2ranvsnt0 exnxo iatlaDr n il( sexoxrpiu4lle  ieia()artmuro;t1tet mieildfa2um( p t)tlerxo iotfptelnvol()setoxr no1ole  ncils)a2ra( p;u1tex ifeiasfs ranms;u4arxnxo oatlmtrluesls0 rum(m ou1altn fetls arrruroou1tpenioctyt a emuvp;u4arermrciadlp rauvil()t2trxm3oo1al  lietasf rtrxm oo0oleo oeiatfa ea( snt)aexoxo iotfaD ai s;t0trtmxo oudomeelfeta( artaxrono4tlxoii3iydlm2eluvsnt) exoifcia1lpt luvo t)s2xr(r ny1ol   nes (  Drmu p;u1oexniieiad m el(monu4trtnxfciy1om eau o;s tetrxr iodlme mics sf 2uau  nu0altniociltfm emnvp;t) lxnirciodomt  u s ( srtmim3iydomtnlfes s) 2rm(rpou1ale moetytla emnvpnu0aexoxfcoy1oa eaivs () 2umiopny4aptelivtas)sDua(  ou1opeoii3ilt a2umump;t)teeomo totfmDr u o (  etr(r3ny4lp nlfvt ( a2trxmpot4apenii3iaslaDrau o t) eeomocoytopt  ues s0seurxopio4lpen iei sf 2trx o;t4apeo ociys s2ul(vp;(4aetrmr io1oateanvi;s  etmir3oo1ll nlnet s srrmx o;u4aeto ictydfmDeanmp;u)alxnxr3tatopDeau i;s s2trxrpnudlle  netas  2ur( pnt1aexnmfeild aDelu snt4artomf io1oaDeanvol( setmir3oo4omt lnvsl( artr( o;o1aee  ietytlaDea(vsnt4alxrmf ta1fptraieilt) exrxmpiy4lm emfeil() 2rauro;t4optn icilsfsDra(msn(0aleoxfcoy1lm   u o;(0s2xrir3nodopenlfetls artau  nu0aeeomieilt s2rmnvo;(0arxrxo3tadlat  nes;() 2trxo iodaptemfesat srtmumonu0oexniocildlm2um( pn(4teeoiociotfp rluvols0sexoxo3ou1ll nlncsa(  2umur ;u0alxnioeias m ra( ont) lxomrcoo1lpDeau i s0s2xmir iudopenmivt t s2umumpoo4oetnmfctydls raump;() rxomf3io1oa eln s s t2xrirpoodape mivs ( arrr(mono4tlxnmf3iytfa2uau s;t0artnmf iotlp eluei t)srxoxr nudll   nvi ( s2rmxronu1oetn fcils m raump t0altoif3iytfptr nvo;( trtrio nydal n ieiasfsrtmxmooo4oetnif3ild s uln o (0arermr oydoa rlneo ( t2xoir nudop n nci t  Drax  ;u0aeeo octltfa2ulump (0teenif3ootlatrlneo t sexoxo no4alen fcia(fs2tau  nu1aetn feiyt a emu p;t4altnxoctydlm  liei;t)s2tr(r3iy1lpe lfvils s2ta( o;t1tlt  f3tltla2rlumpnt) eerir3io1faDeliei;( srxrio3iy4optelnvsls) rumuro;o1aleoiocilsfa ranvont0aetomfcia1la r n i;s)seuoxr3oo4op n ivtls) Dua(m ;t1tpenmietad aDraums t0 exnirctydlmteaivol(  2trim3no1lmeelneilsfartruroou1oetoifeilt s ua( snt0tlxrir3oydfmtr n s;s)s2trxrpnodll nlieia( a2tr( pot1optnmietatlmDranvp u) rtnio ootlaD aivols0teto(r oodopen feiltf ruaxro;t4teeoii3iasfaDrmnvsnu)aeenif3ta1fmt  n s ()tetmim3oodaltelnetls) ruau pnu0optn ietat m uanvo (4tltnmfcio1faDr ues;s trum(r iu1altelfeiat)aDtmxmono4olt ioeils s2elnvo u0trxnxfcty1lmDeai i;s)teur(mpny1aptemfvs t srumumpou1tpt mocilslsDemn ont0 eeoxo oodlptelu sl(  2xm(r nudolen feslt aDurumont4apeo oeiydlm2eln s t)trxomr3tatom  lneolt) exoxo nu4aleemivs () rtaxro;o4tet iieilt m elump;()altnircia1oaDraivi;()srtmim3oo1op e fvsa(f 2urxmooo1tlx  ietyd sDumnvsn(4texomo3tytlpD anei;( trxo(m3iy4ole mfeils)srumxrpno1oetnmociytfs emums () reoxfcoytfmt aivo;s0srxoim nudope  fcsls aDrmu  nu1alx io3ilsls em(vs ()treoxf3ootlatrai i s s2xr(m ou1lpt  ncia(faDrmu  ;u4aex io3iysfa2rm( p;() ltrircoytfpte n s;s0truoxr3ny4alt lfes () Durxm nt1olxnmf3tat a ulu s;t0 lxrirciydfm eaueils s2trim oo1alt  fei ( srtau  nu0tlxnmietat s ul( o;t4arxnxo oo1lpteauei;(0trtoio3oydal  lncsl()srrm(mo;o4tlen iciaslsDrmnms;t4aleoio3oadlaDeluvo;t) rtrio3iydole mivt tfsDuaum ;t0oeen ociys aDua( s;(0aexrirciotfa rau s ( truoirpnudame  fcsas) rurump;t1oltn ocild sDrmnms u) exnmf3to1oatrlivo;(0 rxmio iy1lm n nci t a2uru o;o1tetn ociad aDeln snt0arerir ia1lmtrau olt teum(m3iudop elnvs t)sDururpnu4tlenmo3iasla ean o t) etrmf iadlpDeanvilt)tetoimpno4lmtn fci t) 2rr( oot4tlx ii3iys a2ul(monu)alxnio iy1om rlu s s0t2xrxm oodapenlfcs s)sDur(mont4tpto i3ildlaDumnvsnu4aetoxr3oy1lmDelivols  2to(r oo4lm nmiciltfarrrx p;t0aet  o3iaslm elnvp;(4 lxnxo3oo1opteanesls0texrxm3nu4op emfeias s2tau ont4aex  ocildls2ea(vont)tetnxo3tydlaD  ies t) 2uo(rpiu4opte ncsl(f Dta(mo;o1tpenifetydfmDranvs (4artnxfcoatfp r uei;t  rxrim iu4lltnmfvilt  2taum oo4aptnmi3tytlsDrm(vs u)aexnmrciydlate nes s0 2xrirpny4am e fei tfs2rmx p;t0texnmo3tls a umu s;()arxoir ootoat  ueo (0tetm(o3iodom n ieiat s2um(r ou1apx ii3iaslm2emnmsnt)tlermf ta1oat li s;t) 2xoir iy4ol nlfcias) Dtaurpno0aeeomoeiys s rl( o t0texomrctadla e i o;s  2trxo3oudlm   ivia( a2trumoot0alxoio3iadla2rlu o;t4tlxrmf iytomtrlnvo ( s2to(m nodoptnlfei tfsDtrxrpot1teto iciydls eanms;()treoxo tydom r uvs;t0setmir3iudop nmicias)srurur nu1oex ii3tytfm eau p (4aeerif iatfat aneo s)srxrxmpnodameemfcils sDtmurpoo4tlt iictlsla2elums;t)altnio3ty1opDrlneo;s trxr(o io4lpte neiat)srumuroot1altnioetltfa2rauvpnt) leomf3iodfa eai o (0 2um(o3iy1op  lnvtltfsDumumooo0alx iociadlsDrmnmo t4aetrxf3tatfatelu slt t2xo(r3oodlm e fvsltf 2trumoot1apxn o3iytfa2eln on()teerifctatoaD luvs;s0s2tmxr oo1lmen fvsatfa2rmxmonu0opxomi3iaslm ran s;u0 exoio3iydomDelies;s  eurir ny4lptnlneiatfsrraxrpoo1alx mocils s2elump;(4tetoxfcoatlaDrlivo;t) rto(r oo1altnmietl(faDtm(mooo4olxniiciyd m2ean p t4texrmr oo1la  ln i t0 2ur(r iu4ll n nesl()aDtr(mp;t1optniiciydfm ranvonu4altrxrcoytlmte uei t0srxmxr ny4omen nes t  rtmxrpoo4alxoio3iatfm ran o;u0aeenio3tytomtr ivs;s0 rxrxopiodlmenlneilsfa2tmumpnu0tetnif3ilsfs2emnvo;(0 exnmo3oa1omDeaivol()trtr(m oo4om n fesasfs2urum ;u0tet ifcils m2ua( o;(0trerifctydlpD  ivols)t2xr(o io1al   ici t aDrrump;t1alx ii3iadfa2el(vs;()aeerio oadlate iei;t0 etoxm3oo1ape mfci ()s2tr(m ;t1tlxomoeildfsDrlumo u4aleoxoctydlm   ueo;s  2xo(rpno1am  lnci (faDurumonu0aexomf3ilsla2emump (4 ltrxo3iy1fpDrlivs;(  2umxr oy4lm elncsl()aDuaurp;u0tpx mieiyd m rlumo t)trxoio3io1opte i il(0 2tm(opnodlme lnvil()aruaxro;u4aetnif3ildla2uanmo;t4 rtniocoadla rluei ()sexrxm3iudap  mivt sf rtr( onu0aexo ociadlsDeln s (0alxrir3oytfa eaneolt0s2tmirpny1ope lict (faDrr(mp;o4altomfctls a2emumont0aexnxr oa1fa ranvol( tetmimpnu4aptemfesa(fs2tmump;t0altnmf3iysls ul( pnu0 ltrmf3oytfpt lieo ( srum(opoo4lp e fcia( srrr(mpnt1tpx mfctld m ul(ms u0aeerxf oydoptrluesl(  eumio3oo1amtn fctls)a2rax  ;o0optomoetld s emn snu)alxoxo3todlat  uei;s)seum(mpio1lmtnliesat sDrrxmono1aexn fctatfs2rl(vs u4 eenmrcio1fa  liei ()t2umxm3no1ol  lnctlt a2tm( p;o4opx iociatfa2umn o;u0trxnmocootlp e i s;t0srxmim3oodap   nvtat)a2umxmpnu0olenmoeiltlmDrl( onu)tltrxrctytlptelueo;t0seurxo iu1op nmfvtas)sDuru  ;o1tptnmoeild s ra(vonu0teenio ootfptraneils0srxoxrpnu4lpeemncs (fartrur ;o4alx moetasfm emuvpnt4texrmf todomt lneo s srumxrpoodom emfvtasfsrra(  ;o4oex  iciaslsDuauvp;(0trxoifcty1fat lnvsls trxr(o3oy1ol   icilt srrmu pou0opxo fciatfa2um( s;t) lxnmr totfp   neols0seurirpiy4lpee fet t)aruauro;t0altomietltfm2umn p;u4 rtrxf oytomDrau ils0s2tmxm3iy4opte ietas) rta(m oo0oex io3ild aDrlu o u)tlerxo3tatopDelnei;s0srxr(mpou4aleemneias  2urum nu1olx  ieilsla2eanvonu0 leoxr tydlmt  nes t texr(m3oydomt mieils) Durxmpnu1oleo feild sDel(von(4altomf oa1fpDrau sl(0texoir3nu1alte ivt s)arta(moot4altomiciytlsDumump;u4trxrmfcia1optr uvs;t)srtriopnudlmt lici tf Durxro;u0optomf3iydlm umu o;t4tetnmf3totfp eanvi t) 2tmim oo4opte ivt s)srrm(m ot4olt io3taslmDrm(mo;(4alenmocoatom r neo;(0 exrimpnodll   nesls srurxmono0tltniieiltlaDra(mpnu4artrifcia1omDrli i;s0 2tr(o oo4alee nctlsfa2rmxro;t4tlenmietlt s ulu snu0tetoxf3tydlmtr i i;t t2um(r iydomeemfeias) Dtrxrp;o4tpto oetysfa2eau on()tetoiocoodopt  uvsls) ruo(m oydole livilt)s2taxroot4oetn o3iaslm2uau onu4tltnif tadfat  nvolt0t2toxr nudam  miesl(  rtm( pno1tlxoii3iatfa el( o;t4trerxr todopD ln ol(0s2tmxopiodap e fctlt)s2rrum nu0aleo ieiysla uanmsn(0 rxnir3iy1fmDe n i t teur(m3nydamt mnctlsfs2rmxront1aeeoii3tld s emums (0tlxrxf todlpDran il( srtrxm nydolt  icia(  Dumx o;u0aetnifeiltfa2elnmont0 etnxr iydlmtr ieols srxoirpio4amee ivilt sDrm(mono0aeenioeiasls raumon(4 renxociydlp  lies t0t2xo(o3oo4alt mncils) Dta(ronu1tlt ii3tldfm rl(vo (4tlxnxf3todfpt li i;t0teto(m3nu1altnlfeslt)sDraxmo;u0tpen fctadfsDraumsnu)arxnmo3oy1faDe neils sruoim oodlpt lfciat artr(ro;o1altnio3iltla2emn p;t0arxnmf io1op rlivsl( srxr(m3ny4lltnmncsatfsDraxr no4aeen f3ild sDrl(vpnu4 ltnmf3iy1lmteluei ()t2tmxrpiu1olen nvs ()a2uaump;o1aleo fctys a um( p;(0trxriocoa1omtr ies t0setr(opno4olen ics (fsrrax p;o0ole mi3iltlmDumn snt) rermrctodfptrluvils)trxoxo iy1llt mict ( a2raxroou1oetn i3ilsfm2uanvs u)alxnircoo1fpt lnvi t0srxoiopno4ome lfvtlt  2ua(mo;u4tlx mo3ildfs emnvs;t) lxomo oy1la r n s;t0 2toxo oudamenmnetasfa2taumpou4oetomf3iysfaDul( s;t)artnio iy1faDrauvs s0s2xoxm3oy1amtn fes (  rrmx ooo0opto fetyd m2rm( s;u) eenif3oa1lpt  nvo t0 2xoxm3ny4optnlnvi t a2uaurooo1opeoioctld m2ea( snt4 etnmfctadomDr ieol(0 2xmxo3oy1lp nmnci s a2ra(mpou1texnifetyt a2em( on(0alxrmr iotomte i i;t) eurir oo4am   neil(f Dur(mpno1optnmoetldlmDeau s t)arenxr3oy1opte neil()sexr(o oo4am n iesl(f ruaxm ;o0texn oeiydlmDel(vs (0trtoxrcia1fmD  iei (0sexmiopiu4lmeemfvtl( sDur(r ou4tpx mictytla ea(mp;(0 rermo oo1faD auei () 2uo(o3io4lmtemieia(farrmuroou1tltoioctadfm uan s u0tlenxo ta1oa r uvi;s tetr(rpiy4ll  lnvsat sDra(mpnt0tle  ociyd aDua( o u4alxomr3iy1fpteanes s0 rtr(rpiodamt  nesls) Drr(mp;u4oex iiciysfa2rlump t) exrxfcoodop e neo t0 eumio3iodope mncils)a2rr(mo;u1opto o3iydfa elnvsn(4tlerxoctadlmtrlnvil(0 2xrxmpou1omtelivt s a2uau ooo0aexnmocildlaDrlu pnt) etrmrctydlm  aivi s0 2xo(r oudlle  icsas) Drrxrpno0ale mfciyt m2rmnvpnu)trerxo ootomDr i ols)t2ur(opiy4lpeeliesa() 2uaxrpoo4oee  oeilsfs uluvo;(0aexnxo3oydoaDrauvi s0t2xrxo3nudoleelivtat)aDrr( pot1oexo i3iasls2rmn p u0arxomfcoytoptelnvo t seum(m ny1amen nctat a2tr(  ;o4teeomfcilsfa uan pn() rtnio3oy1omtr ueol()srtoxm3oodlm nmfvi t) 2rmx oou4tptn octydlaDemnvsn()texrmfcty1lpDr uvs t0 exmxrpio4lpenlfcils)srrrxrpnu0oexnif3tad a ra(mpnu0aetnmfciy1oaDr uvol( srto(rpnydope  fcia( sruaxr oo0aetn f3iysls2ulnvsnt0aeenxo3oadoa eaues;s)srum(r ny4altemnvsl(faDumur oo4oet mi3iyt m el( o;t0 eeriocta1fmDe uesl(0 euoxrpoodopt lneia()s2rruro;u0aptnio3ildlm2um( p t)tetnxr3oadom  luvs;()sexmxr nu4ap   fvi ( sDumurp;t1teen fciyd s ra(vp u4 lxomrcoo1fatrlu il(0 eurio3oydomenlnesa()arta(r ;u1aeeniieiyt a rm(vpnu4 ltrxf3todlptraivi;s srtr(o ny1ll emnvs ( s2tr(m no1tlx  icilsfs umnms t0tlxrxo3ty1la  lnes;(0teur(m3io4ap n nesls arur(mpou0aeenmo3iltla2uanvon()teenmfctydlatrlivs;t0 rxrimpiydam n iei t artmumooo1tpx  ociasla eln pnu0 leoircto1fm eauei;t0srumio iy1ope  netlt)arur(rono4olxomfetydlm eanmont0tetoircoy1fmt ai slt)trtoio3oy1op nlfci tfsrrrurooo0apx  fciltfs eanvsnt4 ltniocoadfpD  nvils) rxmxr3no4omt  iesa( sDrrx  ou4tpto fciydlsDelnmo;u4artrxrctotomteli s s0srtm(m3ny1lptemicta(  rrmx pnt0aexnmfetas a2ea( p ()alenmr3iydoaDr nvolt0seumxo3ny4ame  ieiat)srrr(mpou4olxnifeiyd sDrmuvon(0aexoio3todlmtr neo;s truoxr3oodlle  ies () Draxmooo1tlt  i3tytlsDua( p (4aeeoxfctadlmDrau s s)sexoxopnu4oltnmnvi t) Duaum ;u0alxoifciytfsDuanvo;t4texnxo oa1la   ivs t srtmio iudll nlnvsas)aDtru ont0aetomo3tlsfm rmn o u4alxoio tydlat  uvs;() etmxrpny4lm   nei s aDtrum ou0tleomoeiad s2eluvp u)tlxoio iotla elues (  2tr(r iy1altn fciat)arurx oou0tex ifeild aDuau s;(0tetrxr3io1fpDrlu s s t2urir ny4altn fciatf Dtaur ;u4teeomfciytfaDrlu p;t4aleoiocoytomteaueolt0 2xr(mpoy4apenlnvsa( srtmxrpnt4oex  o3iatlm2ua(mo;t)trxrmr3oatlpDrauvslt0 eur(o iodal  lnesat)aDtrx oot1texnmoeiytfm rlnvpnu0aetrmociodfp   u ilt0s2tm(mpno4om   nvsas) rumur ;t1tpt ioeild s2um( p;(4tltnmo3to1om   u s;t0s2trio3nudam  mnes t  Dtr( pnt1oexomo3iytfm em( on(4aleoxociytopt auei () rtoxrpiy4omeelfes (faDtrumonu1tptniictyslm2ulnmp u4aetnmfcoatla eli il()trum(o3io1lleemies s a2rrxmp;u4olenmo3iadla rmnmon(0aexomf3iytlmDeauei s)teumxr3ny1op emfci (  rraurpnu0altomoetyslm ulnmpn(4altomf oadfm  lnvi ()s2urxr3iudolenlieiasfaDtr(mp;t1apxoifeilslsDumuvp u4 lenmfctotlpt ai i t)trumio3iu1alenlfciatf Drax oot1optn fciadls2umnvo;() eenxr3iodop eau i s0 euoxm3oodape lies () Duaxmooo4tpxo feiatfs2rm( p () renif3iy1oa  ln i;t trtm(rpiy1alt micilsfsrrmu onu1oex mo3iadlsDrmn o t0teenxr3oa1fmtrai o s trxoxo3ou1op  mictas  rtauro;o1oee mi3taslm rmu snu0tltoxfcoadfp eliesl(  2tr(opiy1am n fcsat sDrmum ;t0aex mfciat a rmumsn(4trtomrctatfmte i s;() rtoxr3oo4al nmicia()s2urxm ou4tpe mietlsfs eluvont4 lxomrcta1faDe uvi;t) 2xrir oy4ol  mnetlt artax  ot1alx mieiys mDeanvsnu0trxrif iodfpD anvsls)t2urio ou1lle lnvt (fs2ta(mono1oexniiciadlm ea(ms;t)tltnir3iadfmDeanvs s)trtm(opny4ap emfcsltfaruau o;o4apenii3iaslsDumnvp u0 eerio oadlptrli o;t0 rtmiopnu1lmeelnvs sfs2rrumpnu1tltniictad a2rm(mp;t0aexnmr3tytfp r nvo;t0texo(mpiudoltnmnvs tfaDtrxro;t1oetnmfctlsla2rauvo u0 ltoir iadlat ln o (0t2xrxm3ou1aleemictlt)aDtaur ot1aeto f3ilslsDuluvp;u) ltnxf iatoa ran o () 2toxmpnu4op elnetls)sDtrurp;u0tpxnmoeiatfs umn snu) exoxfcty1fp   nvo t0 2tmim3oudlltnmfvslt aDraxr oo0olxnmiciytfsDrl(vsn(4 rxrxrctotfpDelnvi;(0tetrim3ou4oltnlfvs sfarrrumo;o0apxoiociytla2ul(mpnu)alxnmfctotfpDrln i s)s2xoxrpnu1lmeemfvs tfs2uaum nt1olx micildla2uanmsn(4 rxomo3oadomD li ilt)texoxmpoudapte nvt sfarta(r ou4olt mi3ild mDua(mp;t0arxomfcoadoaDe i il( t2um(r iydale  fcs sf 2rr(moot1tleoii3iydlmDeauvs;() etrmf iatomtrlneol(  2umxo oo4lme  fctlsfsrumxrpno0tltn feild sDuauvsn(0 rtoio3ootlmDeluei t0srxmio3oy4lpeemnctl(  rrrxr ;u0oeenmi3tasls uan o u0 rermo ty1opDe iesl(0t2tm(rpnudamt mnvta()aDtaur nt4olxnmi3tad mDemnvs (0texnmoctodlptraies t  eurimpno4alte iei t)arrmx ono1alt ifetys sDemnmsnu4arerir3ta1oat  ieo s)t2urio3nu4amt lnvtlt sDur(mpnt0tleomiciydla2emu onu0 rtomf3iytoa  an s;t)trtrirpnydomte fet s)s2ua( p;o1tleo oeiltlm2rau s;(4 lenxfctatfpD  uvilt) eumxopoy1op  mfvia( sDuax p;o0olt  f3tysfaDeaump ()tetrifcio1oa   ueolt) 2xmim oy4om nlfctat sDtrxrono0tpxo ietyd sDrmn o t0teenmf oo1om  aivi t0t2xm(o io4lm nlnvils)sDtrx pot1oee  i3ildfs umuvpn(0aexomo3tadfa r ivo s)t2uo(r3ou1amtnmfctlt  rrru pno0tpeoiociadls2emnmpnt)altniociadfmt aieils0 2uo(m3ou4ameemneilt  rrmxrpou1aptomoctasfa umnmsnu4aetoxf3io1op  livsl(  2tmxrpio1amenmfctlt)s2rrx pou4tlxnmf3ilsfa2um(mp (0 lxrxo tatlatr uvilt0trurxo3oo4om  mfcsa(fs2umx pou4oltnifctatls2emnvsnt0 rxnif oo1fatr n o s)srxmxr iodll  miei ()arrm(mpou0tlx mfciydfs2rm(mp () rxrxr tatfm eau ol()srurxopny1omte nvilt aruru oot0aetn f3ilsfs2eauvs t)trxoio3todfp elieo;t)s2umio no4lpenmivtat)srrr(mpnu0tlxo f3tadfmDul(mo u)texoio tydomDranvo;s0s2xoir ny4ap  mnvil(fsrtr( onu1tpen fciytlaDraums t4aexoxf3ta1lmt  nei;( texo(opnu4openmict s s2urxmonu4ope moctasfa2uln onu4 renirctadfp r i o;t0 2xriopny1opee fctl(  Dua(r ;u0tleo ictasfmDeanms u)tlxnxo ootfatrlu ol(0 exrim oodlltnlieta()s2ra(rpno0tpxomi3ils m rmn s ()texnmf3todfat  n i s s2xo(opnu1oltemfet sfarumumonu1ope  iciysfs emn p;t0tlermocoytfm eauvo;t)s2xmxopiodlmeemfeiatfaruru  ot4aptoii3tas s2ulumsnu)artrmrcoatfaD  u o;t) 2xmxo oydaltemncslt  2ua(mono4tlxomieiytls eauvsnt4 rxrxrcoo1op   iesl()trto(rpio1ol e icsa()s2raxmpnu4tltn fciadla rmumon(0tleoio oadoatrai i;s0t2to(mpoo1am   ivsas s2tau  oo0tlto ietadla em(vs;t4trerxf3oydomD  ivols0 2xmxopiy1oltnmiesas)aDum(rp;o0ale  ieild s rmuvo;t) reomfciodfmt luvils)s2tm(o3iu1alee iesas)arurxrpno0oex if3iat s2ua(mo u)aeeoio3to1fmDrli o;( setrxmpno1lmtnlfet ()sDumx  ;o1opx mi3ildls ulnvp t) lxnxo3tatomD an slt0trtrio oy4lpenmicia(fsrtaurpnt0apeoii3tys a el( o;() rxrxo3tatfa  lnvi t)trxmio3iu1olenlfetas aDra(mp;o1opx moeiydls umnmsnu) etnio3iodoaDe ivs;s  exmir3ou1omeemfvia(f rumum nt0opx  o3tasfm em(mo t0altoxfcoo1fm rli ols  rxmio oudomtnmfesls)s2umx  nu0alt  feiyd aDrlu pnu0tlxomo iatomD  ivs s t2tmxo3oydapenlfcil()sDtm(ro;o1aleomi3ildfm el(mpnt4tlenmf3iatfmt lnvils  2toim iy1olenlnetlt s2uru p;u0altnmfeiatla2rauvp;t0altoiocoa1fmte i o ()truoio3nudlleelneil(fs2uaxm ;u1tetomoeild mDrauvp u0tetnxo3ta1fm rlnvolt0t2xrxrpnydopeelnet sfsrtrxmpnt4teenii3iltfa emn o u)tltnmo3ta1om   nvils0sexoxmpnodom  lnciatf 2rr(rp;o1tet mo3ilslm emn o;u0trtrmfciatlm  anvo t0s2uoxr nydol n fcs s arraumpou0altnmociysfmDelnms ()teeniociy1faDr ies;( t2xrim3oydapt mnvt (fsDra(r ;t1ole mociatfs umn on()alxnif todfpteauvs;(0trtmxm iu4lmtnlieslsfaDrmur ;t1oexoio3ilslaDulnms;t0 rtoio3oy1opDe u o;t)trurimpoo1opt mneta()aDrmxr ;t0tptnmfeiadlaDelu s;(4alenif3iotlmDr u o t0setmxo3ny4apen fcs (f 2rrur ;u4tpenmoeilt mDrlu o u4arerxo3tytfatr nvo;( s2trxm ny1lmt mncs s)s2tr(root1tpxnmociyd m2eanvont4 renmoctydop e u s (0trtr(o3oydlptnliviat aDta(mp;u1aeeomiciat s uln s u)aeeomo io1lm ranvo;( srtm(r3no1om   nci ()s2tr(mpnu0ape  octadla2rm( p t) eerif oadfmteai i ( srtr(o3io1lp  mnesa()sDuaumpnu0opxo ieiltfmDrmumont4trxoxo ootopD aneo (0s2umxr iy1lm emncsl( s2ta(mono0oet  o3iytfaDuluvpnu4alxnxr tadop e ieolt)trtrir oodome  fvtl(fa2ur(mooo0oeen i3tatlaDumnvs;(4trerio3ty1oaD liesl() rxo(o ny4lp   nvi (f rururonu1ape miciytlmDeanvpnu4tltnircoytfp r ues;s0 rxrio3no1llenlfci ( aDtrur nt0tlto f3iat s2rmuvs t)arerxrctodom e u sl()texo(mpnudoptemivs sfarrmu pnt0tlt mi3tls mDumumont)aexnio3iy1fpt  ieo;( trurir3nodlm nlnvias sDurum ;t0aetomf3iytfm2ea(vp (0altnmfcoy1opte u o ( trto(o3iydal e feias)a2rmx ooo0oeto octyt sDra( s;u0aeerif3iodfptr nei;( t2umxo3ou4al e fct s) 2ur(rpnu0apxo ieilslsDra(mon() ltrxf3ootlatrlueo t trumxrpiu4lp nlnvtat)a2uru onu0alen ictas m2rmumo u0 etoxocootla eluvol(0srurxr io4omeelfcia()srua(r ;t0alxomf3tls aDrlnmsnt4 rtoio3oy1lat lnei;s trxo(o3io4lltn fvil( aDua(ro;u0opeo iciadla eanvs;u)altrxr3iodlmDelues;(0trxo(r3oy4lm  liesatfa2rrxrpou1aee  oeildfmDemn s u0trxnio3iotom elivs;t)teto(m io4lpte fesas) rtrum nt1oex mi3iatlsDrl(vs () rerxociatlp raueil(  2xoio3iy1al e nctas  Dtmumo;u1tet  iciyd s2rl(vp t0alxnmociy1lpDelnes;( setmir no4apee fcil( arrrumoot0tleoii3ilsfa uaumpnt4trtoxo3tadfpt ai o;t0s2umio ny4alenlictl( arra(rono1aetn ieildfaDum(mo;t0tleoxfciytlm  luei;t0 rtmio3ny1amtnliviat srumx o;o1oexomi3iyt a ranms;(4 exnifciatlpDe ivsl( trxmir nydoltnlivsas)a2raxmonu4aetnmiciatls2emuvon()alermf oa1fm eaneils0 2umio nu4ope lnetas  2rrxr ;o4tleomi3iltlsDelnmp;u4alxnxf3ia1om  aivo;t teumir3io1al n icsl() Drr(root1opx  o3iyslmDulnmp;u) ltrmr3ty1fptr ies s t2uoio3no4ope  netls) rtrxmoot4tlt if3tyd mDemnvs u4texoxf todfm rauvi s teum(m3oy4lptelfeta( sDurxrpno1oetn o3iad aDulnms;t0 rxoxo iytopte nes;( t2toiopnydlmtnmfci ()a2rrx pno0tptomi3tltlsDulnmsnu)tetnmo3oodopDrlueolt t2xr(r ny1lm elivtl(f rtaumpnt0alxomociysls2raums;u0tltniocoodlpDrli o;t)s2xmirpiy4lpe mfvsasfsruru ooo1aex mfcildfmDul(vp t0tetomr oa1oa  aivsls0t2trxr nudlmeemncs s)s2tm(mpno0tltnifctlsfaDemu p t0texomrctodfp eaneo s  ruoio3iudopeelfcsat)srur( pno1oet if3ildlm2ulu o;(4aeeoxr3iodomteai i ( srur(r iu4ol elnvia(f Dtmxm ;u1tpxnmieiyd s2emumpnu)texnmo tadoaD  neilt  eurimpnodolenmncsas)arrrxmoot4ope if3iaslm elnmonu)alxrirctytfpt aivi s teum(r3ou1om emfetatfaDtaxmooo0aetomieiatfa2uauvp u0 etnxf3oodfp rluvi () eurir3iudaleelnvsasf 2ur(monu1teenmocias a2em(ms;t4texnircootlp elivolt)tetr(r3nu4om  mfvsl(  Draxm ot4tet mocilsfm rm(vp u4 lxnif3iodomt  ivo t0sexo(rpoodlleelfviatfs2rmurpno4tlenmfcilt m2uln s u0texoircty1laD anvs ()teurxr3nu1ape  ivsltfa2tm(r nt4tpt  feiadfs ulu p;u4 ltoio iodopDeanvs;t0texoxo3iydlltemieslsfs2tax  nt4aeto f3ildlm rm(msnt4trxomfcootom   iesl(0texrio3io4ame lfeiat)sruru p;t1tlxnmiciltlm rln p;t0 rxrxr3oodoa rau sl()teumxrpnodope mnvil()sDuaum nu1aexn oetltfa2eluvsn(4alenmrctotoa  lueilt)texoio3ny1olee net s)srua(rooo1tle  octyt m2ulnms (0alxrif3tadomD  ivi (0s2urirpny1omt lnes t) ruaxmono1ale  f3ildla2rmuvo;(0 etrmo todlm   nvolt)sruoxm nu1omen fct tfsDuax  ;u1alenmictat mDea(mo;() rxrmf3oadomtrln ols texoiopnudll   nviasf 2rr(r nu1aeto o3tydfa uauvsnt4 exnmf3oytom   n o t)teum(o nudomeelncils)a2ua(rpot0apeo iciasfm ran pnt0 ltriocoydom  an il()tetrimpiydap e neta( artmx ooo0oexn ietld m uanvs;(4trtoio3oa1lmt lneolt0 2xmxm3nu4om   nesltfs2rrumpot0aetoifctyd m2emuvo;t) etnmf3oodla   n s s0 etmim nudaltnmivil( sDtau onu4tlenii3tydfsDeluvs () etomr3oydfm r nvslt t2xmxmpnydalte fcsl( sDrrxmp;u1aex iiciad s um(vo (4altoxfcoydfa   nesls0t2urio3nydllen ncslt) rtr( p;t1tpxn feilsla rm( s;t0artrir ty1lmt livi;()seurio3nu1apt mfvtasf Dtaumont0aex iociadlmDrmumo;()texomr3io1oaDr nvo;( sexmiopoydaltnlieta()sDtrx p;u4tle ioeiydfa2el( p t0arerxrcta1fpDr uvi ( truoxopoy4apt  nvia( arrmumono1tex ifetydfs2ran p ()tlermo oytlpD lnvi s teumiopiydaltemfeia(fs2rrumpou4teenmo3tydfa2ul(mo (4 leomf iadfa e n i;( sexo(o3ny4olt mfei (fsDra(r nt4opeo f3ilt a el(ms;t) eeoxociadlp eaiei s)t2uo(m3iu4am  livt (faDrax pnt4alt iieiatfaDea(mont)texnir iotlpDrai i;s t2xrim ou4lpen ivsat  rurumono1apen ociyt s rlnvp ()arxrxo3iadfpDe u s;t)t2tm(m3ou4alenmfet (faDrr(r no4aetn i3tldla2ul(mp t4 rtrmr3oodop eauvsl(0s2xmxopoy1ope mncsl(  rua(ro;u0tee if3iatfaDuanvpn(4aexnxo tadop eaieol()setm(rpnodam   fvilt)aDua(rono0tetoif3ild m rmums;(4 etrir iy1faDrli s;s t2xm(rpnudaptn icil() Durx  ;u0alx  i3iyd aDeln o u)artniociydfmDrau il()sexoxrpio1op e ivil( a2rau p;t1tpt ii3iysfs2um(mo;t0trtrxr oo1omDr nes t texrir oodal  mneilsf Drrump;t1tetnmo3iysla emnvp;t4arxomocootfaDelueils  2xoimpoy1alenmivt tf 2tr( pnu4oeenif3iatfm ul(vsnt) rtoxfcty1fa  li o;(0trxo(m3nydlmt  ics s s2tax pnu4aexnmoetatlm em( p;t)arxrif3todfm r uvs t  2toxo3oo4omtnmnvtl(fsrum(mont1tlxomo3iytfa emuvo;()arxrxocta1fpt lu i t)tetrxm iu1lmt liciltf Dumu  ;o0alxomfctaslmDeauvonu4alxnmr to1fmtraneo;s) etr(r3iy4amenmfctat) ruau  ;u1tpxoiieild s elnms t)texoif3ia1fatelnes s)texmxm ny4ameeliesas) Dta(roou4apen oeiydfa ra(vo;()teenmr3tatlm e ivi s) 2xrxopnu4olee feil(fa2rrump;t0apxn ocilsfmDum(vs u4arerio oatla r n s s t2uoio3io1lpen iciltf ruaxm ou1opxoiiciysls rm(vp u0aetrxf oadoaD li o t t2urxo3nydoptnlnvtl()aDrr(mpnt4apenmicils a em(vsnt0tlxrxrctotlmtrlneo;t  2xr(r iodlpeemncsls sDrrxr nt0tltn ieilsfaDelu s t)tetoxrcoatoatean i;s sexrim3oydolenlfvs () Drm(rooo1alto octat sDel(vo t0 eerio tytlaD  nes t)t2tr(rpnudapt mneil() 2taxr ;o4tlxo oeiyslaDrmu on(4tltnif iatlaDranei t trumiopou1lp elfes s  2um(rpot1tle mociys m2rluvp t)tltnircoodlmteaueo;t)seurir3iudap nmietas  Drr(r ot0apx ii3iysls2ulumpn() rxomf3totfpteln o s)trurim iy4omtn neils aDurur nu0apxnif3iad m rauvo t4tetomr iodoatrlnvils) 2tr(o oo1ape lietat a2taur oo0oet  ictldlm ra( snu)arxrif iydlaD lnes t srtrxo3iodomtn fvia()srumum ;t0tleo ocils a rl(vpnu4 eermo3to1lpD li o;t)srxrxr oo4aptelncta(  Drm(m oo4apxoifcilt m ul(vs;() etnir iy1fptean sl(0s2uo(rpoo1lpt licsl()s2tmum no0aptoiietytfmDrmnvo;u0 eeoioctatlaDe ivo t tetoir3nu4al nliciltfsrrrx pou1ale  o3iyt s ulnms t)tlenxo oa1oa e u ilt0 rxmxrpnudoptnlnvsl(  2taum ot4ole mfeiat m rlums t0alerxr ta1fmDranvsl(0trumimpiodllt mivs (fartrurooo4tptoioctlt sDranvs t4areomo3ia1omt  n i;(  rxoxm iy1lle  fcsas sDrrxmont0aee mi3iytfm2ran o u4alxoxfciytoaDe nvols0trtrxo3oo4lmenmnctl()a2rm(ro;o4texn oeiltla2rauvo (0 etoiocoadopteaivol()srtrxmpoo4ameemivsat)artaxrono1alxoioeilsfs2umnvsnu0trxoxf oytfp eaivs s t2umxopiodopeelfetatfsrtrxroou0altomicilslm ea(vs t0 rtrifctadfmt  neo t texm(opny1lme  fet t srtmxmpot0tltn ietasls eaumo;t)trtnir tydoateauvsls0 exr(opio1lp   ncs ()s2tmx pnu4oltomoetatlsDem(vo u0tlxnif3ia1omDrai o (  rur(o oo1lm nmnesl(  rrr( o;o0aleo fciys m2rlnvsnt4tlenmf tadlpDraneo (0srxmiopnu1op e ncslt) rtr(mpot1tpxoiociyd s2um(vs;(4 exomo tydlmD lueilt  exmim3iy4lpenlnei t  Dtrump;t4optomieiyt m ranvpnt)tetoio iy1lptean s;t sexrim3oodomeemies ()sDrrxronu0tpx  iciatfm2ranvp t0trtrir tytfptrli o;(  rtmxopno4apt mfcsl(fs2urx ono4tetoio3iyt s2rl(msnu0 ltoiocoytlat  uvi s trxrim3iu1ol n icsat aDuax  ;o4apeo ieiasfa2em( s;(4 leoxr3ty1fmDr nvs;s  rxm(r3oy4apeemiei t a2uaum ;o1openii3iadfs ra(vp ()artoif3tydomDr u sls)srumio io4ole  nvt ( aDumumpot1oltnmietasla2el( o u0aeeoxo oodfat lueo;() eumxm iy1am elivtlt)aruaxr ou1aetn ictldfm2umump u4 leomo3oa1latelu o t0 exrim oudap emfctat)s2uau ooo1opx micilsla rm(mp;(4 lxnmf3oa1lmtraiei (  etmimpoy4om nmfvi (fs2urumont4olenifetydfaDra(mo u)aeenircoytlaD aiei;s)trumxm ou1oltemictlt sDta(  oo1olenifeildfm eluvs () etrxo3iy1laDrauvol(0 eum(opoudal nmfeil()a2uru  nu4tleomi3iydfm2ea(msn(4arxnmrcia1fpDeai ol( sexr(m3nudapte nvi (faruaxmpoo0apxomiciys s emu pnu4texrxrcio1omDr uvs;t trxmxo3ny1lpte ncs () 2ur( oot1tpe mo3ils m ra(vo t)texoxr3totlpt anvi;(0trumim ny4al  lfcslt) rtrx  ;o4oeeo ietlslm emuvsn(0trenxocio1omtrau ils)s2toxo iy4lpte ietl( a2ua(mpoo0ole  i3ilslaDuau pn(4 ltrir3iatlm  au ils0 2xmir nudope lietlsfsDrm( oot0aexnii3tas a rmu p;t)arxomr3oadfaDr ieil( trxoxmpno4openlietlsf rraxro;t0tle  fciytla2uanvo;t4 etrir3iatoatr neol(0 2uoxrpoo4lp e ivta(  Dur(  ou4tlenmf3iad s2umump (4 rerxr3iatomDeanvi;(  rxrio iudalt mnvt t  Dum(  ;u4ole  oeilt aDuauvonu0trtrxfcto1opt aivs ()seuo(r oodape lfcslt) 2umumont4opeomieias s ranmo u)teeomo tydlmDr uvs;s  2urxopiu1amtnmfviatf Durumpnu1alxnifeiat sDrmuvs (4alenifcta1fmDeln s;t0 2tmim3oy4alen fvi s) 2raxr ot1oeeoiiciatlsDuanvs;t0aexomfcto1laDr ueolt)t2trxrpiu1lme  ivsatfarrau  ou0tlx iiciyd sDrlnmpnu) rxomf tadoaD lies t) 2xoxmpnodomtnlies ()a2tr(mono4tltn o3iatlsDul(vs u)tetnmo todoa rlies;s0t2urimpno4omtn ivs t) 2taxmoot0altomiciydla2el(mo;(0 exomocto1fpDrlnes;(0s2xoxmpoo1lp  lnci s) Dtau p;o0oltoio3iadlm eau on(0altrio3oatlat  u ols setoxrpou4op emfct tfarumumpot0oetnio3iltfmDumumont)alenxo iydlp  lueo s0trtr(r3oudlptnmneiatf rrmu  oo0tlt  fciltfs2em(mp;t0artoxr ta1fateaiesls0 rxoxr nodape mnci tf 2tm( o;u1aetnifciydlaDean p;(0trerifctytfmteli o ( t2trxopiy1ol  mneta(fsDtrxront0apen ietyslmDeln p u4tetrxoctydoaDraivslt s2um(mpnydape lnci s  rur(mpnu1oeenmfctlsfa umn p;t) eenir3tatlmtean sls teuoxo3nodaleelfcs s  Durx  ot0opx ioeiatfaDelumsnu0arxomfciydfp  livi;t0 euo(rpny4lm  micsa() Duax  ot0tetnmfeiatlm rmn s t0arxrxo iy1omt au ol( srtrxo nydameemfeil(  2ta(mp;o4alt  fetatfmDem( o () reoxf oydoptr iei;t sexoxo3ou4apt lictl(  Duaxmpno0aetnmietlsfsDul(msnt0arxnxo3iytomDraneslt0 exm(mpoy4ll nmici ( sDrrx pnu1opeoifeiatls emump () rxrmf3iodlp  ln o;(0 2tmim3ou4lmt lneils artaumpoo1tltnio3ias s2eanmp;t4areomocoo1fptr u s s t2trim nu1op emieta( a2rax  nt4apt  ieiytlm2rlump;()teerif oo1opt  i i;s0 etmxmpiu1lp  mfvs s)aDta(m no0apenmiciadlsDrmu pn(0aexnxf3iadlatr u s s)trxoir3oodlpee fesl()aDraurp;o1aptoif3tldlm2rl(mp;(0arxnmf iatomte ueols)srtmim3no4opt lfesl( s2uaxmpoo1ale  fctlt aDrlnvsnu) reomr3todfmtr u olt t2xr(o oydaptnmncsasfa2ta(moou4olt ifciydfmDel(mp u)trxnir ta1fat  uei t s2urxrpnudll  micil()s2um(  ou0aptniietydlmDrl( o;t0aexnifciytfaD ai s t0 rxm(m oudlm  mfcsltfa2tax o;o0apxoiociat m ua(vp u)alxoir3oo1om ranes;t srtoxm3iu4aptnmfct s srum( ono1tet  f3tlt sDrluvp u4 lerir3oydfptrauei;s sruoxo3ny4ol e nct t)a2taxrp;o4tptomfetasfs2ea(vo u) exrir oadla ean i;()seurxrpoydoltelncsat)aDuaxr oo4teenmfeildfm2rl(ms;u)tetomo oo1fa raneols)t2uoirpnodom e neta()artau pot0aetomfetltfmDrlu onu0tlxnxf iydfmDr ivs t)sexo(m nu1al nlictls  rtr(mo;u1tpeo f3iadlsDrlu o;t4 exrif oydlmDeauvi;t)s2umir iu1lmee ivsas)aruaumoot1tpe  octat a em(monu0 rxnxr3to1fmtr i i;() euoio3nydllt lnvias sDur(rpnu0tlxoiiciasla rlums t4altnifcto1lmtrauvi;s0 exrim3oodam   nctat  rrrxm ;t1ale if3tat a2uau pnt0 rerifcia1lptranvols t2toim ny1omte ics t  2tmu oot1olenioctytfs2rau p;t0tlenmoctatlmD aueo s0setm(r3iy4amteliesat)s2rrxm ;u0tlen o3tyt m rlnmp u0 renmf3ia1faD lnvs;(  2uriopiu1ol emfes () Drr(m ot1oltn icils s2rlums u4 rxrxr tadlp   nei ( seuoir3nodol nmicta(f 2tax o;o1tpxnii3tasfs rlnmsnt) rxnxr3oadfpte u sl() rxo(r iy4lm e nvt t) rum( p;t1ape mf3iysfa2uau s ()tlenif3tydoa e ies;s)t2xrio3oo4oltn ivt (  rururp;o0oetomf3ildfm emuvs t4 eerir3tytfaDelieols  etm(rpnu4am  mfct tfa2uau o;t0teenmoetldlmDumnvpn(4 lenmr ty1lp rau i t)sexm(m3iu1open nesasfaDtrumoou0apeoioeiys m2ra(monu4 etrxrcoo1fa rliei;( setrir iodameemfesas a2ur(mp;o1olx  o3tyt s2el(vsnt)aexrif3oy1oa eau ols) 2uoir3oy4al elncs (  rtaurpnt1texomfeiltfmDrmu o;u)tlenxo3oodfp e nvi;s0srtrxo3ou4amtelnes sf Duau p;t4aexn i3iydla2uau snt0 rxoxf totom raivs (0srumiopnodopee fci t arum(ronu1tetniieiaslm2rln p u0aetrxfcoodoateli sl( t2trxm3iudlleemfesatfarumurpot0opt  o3ildlaDum(msnu) exrxrciytopD anvslt)seto(opnudllt mfvsatfsrrmur no4teeomociyt aDeauvon(4 ltnmfcto1fmtr nes;t  2um(r3nodlpen feil(fsDuaxmont0oee  i3iytlsDemnvs u0 rermr3iydomDrluvo;(0seuo(m3oydll n feslsfa2uau  nu0alxnmfeiatlmDrlnmont)trxnmoctadlp  lueols)texoxm3oudopt mfvia(farrmxm ;u1tet  o3iyd mDem(mpnt0 rxrxr ia1opt ai ilt0setoim3iu1om  mivta(fsDur(mpnt1texo fetat aDuanvpnt0altoxr3oy1faDraiei;s0tetrxmpiudlle  ivs t) 2tmxmpot4optn f3tydfs2ran p;u)trxrxocia1latr nvils0 rumxr3iydop  mnvsas) 2rr(mpno0opxn ieildfaDumu s;u4aleoio oytom rluvo;( teumiopnudlmenmnvsls  2ua(r ot0ope mo3iydfa rl(vp;(0trermo3oytoa  anvo;s)srtoxr3oudlptnmfcs (farumxm ;t4aeto iciatfa2raumon(4 eerio io1fm  anvo s  exmim io4ol nmnet s) 2tm(r ;u0oex ioeild mDrlu onu)artrmrcootlmt  iei () etrim iu4lmtn nes s)aDrrurpoo1aeto ieilt s2elu o;(4aeeoxocta1opDeaieo t seumir iy4om e nviltf Drr(m oo0aee mieiyt sDelu s () rxrio3oy1lm  ai i s)setoxr3oo1lmeelnci tfsrrrurpou1oex ifciyt s elnvo t)aexnmo oa1fmteauvi ( texmxmpiy4apeemfeias  2rr(mpot0ale mi3ias a ra( p;(4areomrctatfateaies;s0s2um(rpnudlp nlfcslsfs2rmum ;o4tex  oeiydlmDrauvp u0 etnir totomt liesls0 ruoim3ou4ap emfetat s2ta(ront4oet  i3ils m2ra(mp (0arxnif iadoat  i o;(0t2uoxm nu4aleelnci ( s2urx poo0alxnmocias s uan o u)tleoifciadop rau i ( t2xoxr3nudoptnlnci ()s2umxrpno0ope miciatfaDemnvo t4aexnxocoydlaDr n i;t trxm(rpoy1lmenlfcsls)a2urump;o1opeoiociltls uln p ()tltnmr oytfp r ues t seuoir ou1apt liciasfaDuaxroou4opt  fciasfs2eanvsn(4trxnir3io1omD aueo s)s2xrio oy1lp nlnvtasfarrm(rono4optomi3iytlaDra(mon(0 rxrir oydoaD  u ols  2urir3iudll  mnci ()s2tmumpou1tltomieiad m2uaumon(0 ltnio3iadlp  lneo s)t2tmxo oo4am nmivs sfa2ra(mont1tpxnifetlslsDra(vont)tltnxr todoptelnvils) rtm(o3ou4ol e fvia(faDrmxm ;u0alt iieiatlaDul( pnu)trxnmfctadoptrlnvi s  exrxo io1al nmfcs ()sDrrxro;u0olen ietltfa2ra( ont0 reomo oy1lpDeaneols0s2xo(mpio1ll elici ( sDuaumo;o4opeo i3ias a2ulnvs t0altoxr3iotlpte ivo;s)setoxmpoo1ome mfcs s)srrr(  ;o4aptoifeiatfm2ulu pnt0aetomociodopD  ivi (  exoiopio4openmivsat) ruax pot4texnii3iatfm2em( p t) exnmf ta1fa rau s;t) 2xrxrpou1amenmfeiasfs2tmu onu1aetomieiytlsDul(mp u0tleomo iodfatr i i s srumxrpnu1ome livtat)sruax oou0aptomfeiatla2ua( o;u4 rxomr tatom eaieo s0sexr(rpoo1al  mfes t aDra(m nu0tee mociatls ran ont)aeenm
\ No newline at end of file
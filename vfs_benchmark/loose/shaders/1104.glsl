@@ -0,0 +1 @@
+nvslt0t2xo(r3iodlmtnmnctlsf 2tmxr nu0oeenmfctat a ulnvp u0 rxoxfciatfpDrliei s  rtr(mpiodam e fci tfsDrm(r ot0alxoiieiyslsDean p u0tlxniociotfaDe uvsl(0t2trxr3ou4am elivsl(f 2urum nt0aexn f3iys aDem(vonu4tlxomrcoadfm rauvo;()srurio3nu4lmtemnvt tfsDtmxrpoo1teenmfctadfm2elnmo t) exrxr io1oa  lnei t0texoio iudamt mivi tf rta(rp;t4apxn oetadfa2uan p (4aexomr3tadlmDrlivi;t0trto(r ny4opte ics s  2rrxmpno4oee mi3iadls ulu s;t)alxoxf3todopDeanei t0trumxm iydlpt  fesa( a2rmxmo;o4altoioeiadfa2ean o u4trtnmo3iatfpt li o s) eum(o oodap nlnesl( aDum(mp;t0optomoetadfs um( o;t4 rtnmo3oa1faDe i o;s srxr(o3iydapt  fvsasf 2tmumpoo0aexo octlslmDrm(vp t4altrir3tydla elnvils t2umxmpnydalenlnci s  2rru o;o0tpt mo3iytfm2um( s t)tlxrxociy1oatrlieo t  rxo(r oydoptnlfcsls)artaum nt0oeenmfcilsfa elu o;u0 exnxf3tytlpteaieol( texoimpnodamee netlsfs2ua(mpou1aex moeiys mDel(vpn() renmrciadfa  aivilt0 2xoxo3oo1lme mnetltf Drr(mo;t0teeomfeiad sDum(vpnt)arxnir ta1latranvi t)sruoio3oodlp nmiesa(  rtmx p;u4aeeo fciad s ul( onu)tetoir iy1oa   u ilt texrim no4op nlfciat a2uaxmoot0apenifetldfaDemnms ()artoxr ia1omDrluvs;t  rtrxm3no4op emiciat) 2urxmono4olt ifetatfa em(vs t4aetomrciy1oa rai sl(0 rtmxopou1ape lnet s)sDtrx  ;t1tpeomfeild m2umn o (0tetrmr oadlateliei (  exrxr no4ll nmfei ( a2tr(  ot1tltomfciydfs eauvo;(0 lxoir3tydfate ieo;(0 2trimpny1ome mfesas a2raumonu1aeeomfciydla2emu o ()tltnmo3ia1oaDeauvo;t  2tm(opny1omen netltf rurxrpno1tltn oeiad m em( sn(0alenmfcoodla r n i;s0tetrirpnydame lfcsas)srtm( poo1opto fetydfs2rl(monu)teerxo3iotoaDrlivo;t)s2xoxr iu1ap elnes s)a2rmumonu0aetniiciysfs2rm(vp;(4arxrircto1faDraivo;t)t2uoim io4omeemnesls aDtrxr oo0aleoifeiatfm2rmump;t)alxnmf3ia1lpt  ies;t0t2tmir oodlptelivtasf ruax ont4tpeniictldfa2uan s;t0 ltnmr3oa1lm e neo s0 rtm(o3oudap   fvi sfs2uaxrpnu4oeen oeils aDelu p;t)trtrifcootlmtrauvo s0srtmxo3iu1alen nctas  2ua( ono0oexomoctltlmDemn o (0 reniocoadfate uvo;s)truoio ou4lpe lfesl(fsrtau ont1texnmociatfm ra( snt4 ltnif3iatfat ai s t tetrxr ou4ap  mfctasfaDraxrpot0tpxn ociysls umnmsnu) lxoxrctydopD  uesl(0 2uo(rpiu1oleemfcs t  2raxm nt0tleoifctltlmDulu s t4 leomo3ty1fm  anes;t t2urxmpio1om n fei sfaDrau  oo0ope moeiys aDelumont4trxrio3iatopt  iesls t2uo(m3iu4om  mnesa() 2ur(mpnt0aleo oeiytlm2eln o;t)altoxo3ia1fm   i s t)s2xoio no1oleelncils)s2tmxro;t0apeomi3tas sDrmnms (0trtrxrcta1lpDeliesl()sexrio nydamt lictlt s2raumpot4apen ociatfmDum(msn(0altomf3io1faDr nei;s0 exo(m3nodaptnliesa(  Dtmurpno1aexomfciasfm rlu p t4tetoif ootomt ln sl() 2urir3oo4al nlfct tfs2rr( pou0tptn ieiyt a2rm(ms;() ltoiocty1oaDr neolt) 2to(mpoodal  mfct ( sDtmxm ot1alto i3iysfs2rl(mp t0 ltrxf oytoa  ai i;()t2urxm iy1lmenmfesatf rrmurpnu0texnio3iad a2ran s;(0tlxnxf3ia1fa r uvi;t  exmxrpiu4lptn fes s srraurp;u1apxo fciydfa2emumsn(0texrif tadfm eli o;( t2um(o ny1ap elictat  rtau  nu4tleo i3ildfa2rmuvs t4 ltoio oodlmt aivslt  2xm(m3iudlp n fcta()a2uaurpot1teto fetytlsDumuvp (0 leriocty1lmt  ivsls0 rurir3iu4al nlnci sfaruaxrooo4tleo octydfmDemn onu0tetrxfciotfmtrlivi;t0 2urim iy4al nmivtls  2urumonu4alt mo3iadls2ua( snu)alenio3oatfpDrlu i t)s2tr(mpoodlpen ivtatf 2urump;t1alx mo3iysfaDulu s;u4aeerxo iodfatran ilt)t2trirpoudol  lictlsfs2raxmpot0altomoeils a ra(mp;u0alxoxr3oydlaDelivilt) rumxmpiy4optn ics tfa2um(  oo4opeomfctat s2rl(mp;(4arerir iy1fa r ies;t)t2xo(o3iu4al   ncsls srrmum ;u4aptomiciltls rmn p (0tltrmr oodlmD  u s s0trxoio ny1om n iet s aDua( pot4tpxniocias s emn p t4aeenircoatlpteaneolt  exrxr3iu1ape lfet t) rtm( ooo1oet  oeilsfmDelums u)alenmf3oy1opteanei;t) rxm(m io4ole mictls s2uaumooo0alenmi3tadla ra(monu)tlxrir oadla eauvil(0t2xrxopoy4amenlfvt t  rrrx o;u4alen ocils a2ulnmsn(0altoio to1fmtean s;t  2ur(r3oy4ol elies (fartm(rono4optnmo3iat sDumn o;t)tetrxf3oadlate nvs;t)texrxmpou4lp  lnvtasfsDra(r ot4apxnii3iysfsDul( s;u) leoifctotfpt  ueol(0srtriopnydoltelnetas a2umu poo0teto ietadla2ua(vs;t4 ltomoctydlm   uvsl( srxrxo3iy1alte nviltfsrum(rp;u1aexo iciysfs ua( pnt4altrxfctodlm rlivil() etrir3oudolen fetls)aDtr( poo4tee miciytfm ea(vp;(0 lxomrciodop rlnes t0texoimpio1omen fct sf ruaxmp;o0olx ioctyslm2ra( s t4 lxnio io1faDr ivs;s0t2umxr3nu4omee feias  rtru  ot0oexn ietatfs ran p;(4artoxr oytomDe uei t0srtoxopiu1ol nmivtas a2rmumpnt0olx  fctytfa rlu s;(4aleoir oodfpDelieil() rtrio io1ape  iesls artrumpnt0tpe mociyslmDulu s (0aetnir to1omteaueil(  rurio3iu4amte iciatfa2ta(r nu1oee if3iytlaDul(vpnu4 ltrxr iytfmt anvs t trur(o3oy1amtnlivtl(f Drax pno4tetnmfctld m2ea(mon(0arerxf3oy1lmD ai sl() rxr(mpny1ll  livslsf rraump;t1tetoif3tys mDua(vp;t0 exoxoctodfm r n i ()srxr(opio1ole mivi sf rur(rpnu1opeo i3ils mDea( sn()tlenxo3iytfate ivs t teurxo io1om nmnesa(  2tr( p;t4aee micilsla uauvo;t0arenirctadom eanvolt)tetr(o nudlleeliei sf 2uaur ;u0tlt iiciatla elnvo;(4aeerif3oy1fatraneslt)srur(rpoydol e fcia(  2tr(rpno0texomo3iadlm2umuvs;u0 exnmrctodfm  livo t srxmxr3io1lp e fct t) 2trumont1aee  ociytfs emu p;(4aleoif tadlaDrauvi s0 euo(m3oo1op elicsa(  ruau o;t4openmoeiad a el(ms;u0 exnmr3todfa e ivs;t0 rtrio3ny4ame  fcta()arraurp;o1alenii3iydfa2emumo;u0 rxnxr oydopD lu slt)truoirpiodam elnetl( srrmx  ;u0olxn oetysfm eanmo ()tetrmocoadlpDr nes () 2uoxo3nydopt mnesltfsDrm(m ot4tpt mfeiyt s rm(vs u0trxomf iotlmDe uvol( tetoimpiu4lpeelneils  rtaumpnt1olx iociasls2uaumo;u4 rxomf3tatfpD an ils) ruo(m3oo4ap elfei tf rtaxrpno4tpx if3iltls rlnvs;()tlxnmr3totfpDe uesls)srtoxmpnudlm   ics tfa2umxrpoo0olt if3tls aDrmnmonu0 lxnmrciadom   ivolt)srtoxo iy4lpt mnesasfs2uaxroot4tlenifctatlm2emu o;u)tlenxf iydomtr n ils) 2xrxm3iodlltnmnct () 2rm(mp;u4oexn feiytfaDumuvo;(0tetomo3iytop ranvo;( srtm(mpnudole  nesasfs2uaxmpoo0aetoif3iytla2emnvs u4tlerxo3iadfa e uei s)trxriopiydamtnmfvta(farta(  ;u0aeeo octysfaDum(vo u4 renmr oodfatrli i;( trtrimpny1op  mnetl(fa2uax poo4tpx  ociytlm em(vo u0alenmo oatfaDe n ils)sexmir oy4ape  ietas)sDrax  ;t4tlxnif3iytfaDeanmpnu4aetoir iodfpte nvols)s2xoxr iodam n fvi t)artrurono0optomi3tytfs2rau p u4arxomfciy1lmt  ivi;t0srum(m3oudoptnlncil(f 2uax oou0olen ociad a uln snt)altomo3tatfmt an i;s) 2tmxr3iudll nlicia( aDra(monu4olx mictydfm2rauvsnu0 eeoxo3oy1lp r nei s teum(o3io4omtnmfvi sfsDur(mpnu1tet  ietlt m2uluvs;u4aeeoif3io1fpD lu o (0srxo(r io1llt mncsltfa2urxroot0aetomi3tas sDeluvs;u4 exnir3ta1om raivi t)seumxr oo1lme  fet (f Dtax pot1aptoio3iyslsDra( p u0teeniocoytlmt lieo;s t2xmxr nu1altelfvt ()s2rm(mpnt4alxomfctls mDuluvon(0tlxoxf3io1lp e ueilt s2xmxo3iodll   nei t)a2tmx o;o4aptoiiciadlsDrlumsn(0aexoiocoa1opDrln i s0 2xoxm oo4amtnlnvia(f Drmxrpno0optnmf3tld m2rm(mo t0trxomfciadfat  ieolt setoxo iydol e fciat sDururpoo0apeo iciltfm2ra(mpnt) rxoxrcoa1la e u o (0texr(r3nu1omee iet s srumx  oo4apxn iciyd sDel(mp t4trenmfcio1fp  liesl()s2xmxr3iudoltnmfeiat) rur(r ot4tlxnifciatlm2ul( p;u)trenmr ia1fa elivo;(  exrir oo1omt  fvsas)a2ur(mpot0aetnifcilsla eluvp (0artomrciytlptr uei;s srum(opoodomeemnci tf Dtax o;t0tlenifeiltlaDrlnms;t4 exnir3tatlaDeauvo ( srtoxr3iudomeemieta(fa2rr(monu0alt  fetltfs ul( on()aetnmf3tadlmteai o t) 2uoxopno1lpe lncsa(fsrrau poo0olt mo3ilt m rm( s;(4teenmo3todlatraieo t sexoxr3nodomtemfctltf 2rm(ro;o4alxomietad mDuanvsn(4trxnio3oy1fp ran ols0trurim3nudoptemnviat sDtru ont0alenmoctydlmDemnmo;u4 ltrxf3oo1lmtelies s srxmimpoy4llt  ivi t)aDtaur ot1tpxomf3tydfm2elu pnu)altnircia1fp eln s t)t2urir3io1lp emnviltfsrtrum ;o0aee ifetat m2elu o t0tltomrciytfmteauvo;s s2umxo io4ope mnvta()s2urxmoou0aet  octasfm2el(ms;(0aetoio3iy1fm eanvsl(0 2ur(m3iudllte fct s) 2taxrpnt0opxoii3tltls umnvs u)alenxoctodomt livi;t) 2xo(mpiodope mfvsls)srrm(mpoo1tetn ictys mDuanvon(0arerxf ootfpDran o;s srxoim ou4oltnlfesasfsrrrxrpnt4alxoioetatfm rl( p;u)tlxrmo iytfm e u ils) 2xrio3oydamenmfei t) rrr(r ou0oeeniictytlmDulnvp ()alxoxf3iydoaDrauvsl( sexr(o nu4amenlnvsa() 2ra( pnu4tleoio3ias mDrmnvpnt4 exnmf iatfp rli sl(  exoio3oodomtnlnesltfa2tmumpoo0tpto o3ildfs2el(mpn() renxrcto1op r ieo;( teurxr nudlm   icsas srra(monu1oee  ieiad a rmn p;u0tltrxrciodlaDelivolt) rxrxmpoydole  fcs t) 2ur(r oo4aexnmoeiad s2uluvp (0 reomocta1faD  uvs t tetrim oy4llenmivia() 2urx  ;o1tpenioctlt m rlu s;()tlerif oo1lm  anvolt0texmimpoy4lp   iesas s2rrxmp;o0tet  ieiytlsDeaumpn(0arerif3oa1fm raies t0trtoio oo4omen fcsatfs2ua(mo;o4alxo iciltfs2rmumo (4trxrmo3ia1lmtr iesl( t2uoxmpnu4lle mnvt sfs2uauro;u1ape ifctaslsDelumo ()tlerxr3iatlat aieo;s srxriopny1ol  mfeslt  Dtaum oo4opeoifetls sDrlump;() leoxrciadomteaivslt0trtrxm nydom nmfetlt arua(mo;o4open i3iadfa eauvo;u4alxnxf oa1lpt  n s t0srxmxo nydllen icsa( aDum(rp;o4tetnif3iys a2emnmo;(0areomo ootlm rai o;s)tetmxopiy4ol nlfvtls)a2tm( poo1oexnmfciydfs ra( o u4aexnxf iydla   nvo;(0srur(o3no4op emfes sf 2taxmoot0tleomf3iytfm2umumo u0tlxoir ia1fpDranvi t0 rtr(o ou4lpeeliesa( srumum ;u1olen ociad s2ea(mpnt)teermrcoo1lpteai olt)seuo(m iy1al  lnet s aDtrxmpnt1tlto ieiadlaDul(vo t)trerif iotlmDe nes s0 eum(m ou1lpe  feias)sDtrumooo4aexo i3ildlm rmn pn(0texomfciytfpteauvi s) rto(r3iodal emnvslsfsDuau oou1opeoiociltfa ulu snt0aeermf io1laDrlnvs t0 rurirpno1llt lnesl( sDrrxm ;u0tpenmf3ias mDra(vsn()trxnxf iatlmtrlivo t0setoxopno4openlictatfsDua(ronu1apen i3ils m rlnvp t0arxnmo3iydoa   ues;()sruoio3iudom emfvsas)sruru  ot4optnmfetadfsDran p;t0 exoiociodfpDeln ol(  rxoim3no4op elneia(faDrm(rooo1olxoiiciydlaDum(vo () lenmfctatopteln sls)texoio no1alt lfvias s2umur ou4ope  ietas s rau o;t0arermoctydfmtelu il()trtrxrpnydol  lnetls)aruaum ;t0teenmfctltfm emnmo u) leomfctytopDrau ols0sexoxo3iodomt livils  2uax pnu4aee ioeiad s ran p;u) lxnmrciytom  lues;( t2ur(rpiu1olte ivt t)srrmu pnt0aet mf3iyd a2ulu s u0 renif oytomtr i s;s)trur(o3ou1om   nvtl(faDuru  ;o1apeoif3tltfm2em( p;t4alxnio iydlmt lueo;t  eurir3nu4lm n ncs sf Dumxr nu4aetoifciytfs2rluvo;t)aeerxf iydfa   n olt srtmir oodap e nctlt aDur( onu1aee  ieild sDua(vs;t4trxnio iytoa   uvi ( teuo(rpoy1ap  mfviltf 2trxm no0olx  fctytlmDeluvsnu4 exrircoatoaDr uvslt)truo(mpio1lm  lfvtatf 2rrumpot0opt iictytfaDel(mp;(0aeenxf to1lmDe ivi s teuoxmpnudomee fvs tf 2ua( p;t1olenmietat a2ua( p u0arxrmf3to1fm  livs t s2toxopoydomeelfvsa( a2ur( oou1texoio3tat m2eau p;t4tetrxfcoydomtr uvi;t0texoimpoy4apee fesls aDurxm ot1tptnmoeiydfs2rmu p t)trxrmr oa1oa rau i (0s2xoimpnodlp e ict (  2uru pnt4aex miciltfa emn s;()aetrmf todopDraneilt t2tmxr oo1ope mietat) 2umxmpot4tltoiiciadla2ranmsn(0trtrir3iodom elneolt0s2uoxm3oodlp n fcia(f 2ta(  ;o1ope ioetldlsDum( s;u)texrif todom r u i;t) 2uo(rpio1ale mfcias srtmx p;u4oltniocils s2raump;t) etnxf3ta1fa e i s t texo(m3iu4lpt mietls) Dta(rpnt0aetnmo3tatlsDeln p;(4teeoircoadla elnvi ( setoiopnudlmenmfcs s)a2umur nu4tpenmfciaslm2ranvo;u4 etoirciatfaD ai i (  rxmim3oudlmtelfci (faDuaumoou4apxn ietasfaDuaums ()tlenmfciatoaDelnvolt srumxr nydlp  lieiatfa2ur(root4tlxomfciys m2um(ms;t)alxrxr3iatlptranes t)teum(o no1lmtnlieia(  2rrx  ;t0apeo i3iyt mDul(mo;u)altoifciy1lmtrli sl(0t2tmiopoy4lpenmics s)srtaump;o1optniieiysfmDrmn pnu0 ltrmr3oadfpDraieol(0s2uo(rpnudameelivt ()srtr(rono4tlx mi3ild sDul(mpnt4aeeoxf oy1fmD aiei s)setoxmpio4optelnvtatf rta(roou1olxo i3tyt sDeau onu0tltomr ia1oa e nvil(0sruo(r3no4alenmfes t aDtmurpot0texnmfciatlsDrl( o t0 lermocia1fm  lnvilt trtmir3oy1alt  neilsfsrur(mono1tpeoio3iadla2ua(mon(4 eeoiocoatomD luvsl()truoirpio1llte icta(  Drmum ;t4oexn f3tasfaDeanmsnu0tlxnir3to1fa ran o;s sexoio nudalenmnvsa( a2raxm ;u4ole ioctysfm rmu o (4 exrmf3iy1la  au sl()t2xmxrpiy1ale mfvia(  2um(monu1oeto octatlaDumuvo;t4altrxoctatopt aiei (  rto(o oo4lltn iesas)a2rmxr oo0opxo oeiyd a rmn o t4aeermf3tatoa  li s s)setmxr3no1alt mfeias  rumxmo;o0ope mociyslm2umump t0trxrirctadoptranesl(0t2toiopno1ap e icil(  rta(m nu4aex iietytls2emu p;t4 etomociydlaD auvi s)teur(r3iudomtnlnvtat)aDur(r ;o0oexniieiltfa umnmo;u0tetrmr iodfa  aneo (  eumxmpoydom elfvil()sDraum nt0alx mocias mDumnvs;t4teenmrcoy1optraivi s) eurxo ou4opeemnvi t)sDrmxmont0tetnmociysla elnmpn(4 etnxr3iadoatrlivo;(0trtrxr iy1ll n nvils s2tru  ;u1oexomictyt m2ranvs t)texrmf oatopt  neo;( teumir3nydlptemfei sfarrmxmp;t1aetomo3ilsfa eau p u4 rxnxfctytfa eln i t0srurxmpoy4ap  lfetlsfsDrrx  oo4tpx  f3iatlaDemu s u)aetnxo3ta1faD anvs (0seur(opio1ap nlfeia(f rtru pou4altniociatlm2elu on()texnmrctatfa rauvil()trxoxm oo4omeelnvs t)sDtm(mo;u0olxnmfeiad s uaumo;(4trenxr ta1laDr u o;t)s2trxr3iudamt mfcs t)a2urxmp;o4oex mi3ilsfsDuan s u4aetnioctadlmtrluvs s0srxmir3ny1ome  iciatf 2rau pot4texomfciltfmDea( pnt4trtrmrcootfmD luvs;( srxrxr3nu4alen fci s)sDrauro;o1opx ioeiydfsDumums;t0 rxrmr3tydop rlnvi s)tetoirpny4omeelfesasfaDur(  ot1aeto fcils sDum(vpnu)texrxociotlpDe uvilt0seumim oudom elnct tfsDrauroot1opx  o3iyslm ea(vs;()teeoxr io1lpDeai i;s  etrim nydapeemfetltf rurx ont4oetnioctltla rmnvonu4alenmrcoo1lat lnvi ()srxr(r3io1lm n nvsls  Dua(rpot0alx ioeiad mDrmnms u0teeoxrcio1lp  auvo;t s2uoir3oodll  miet t)sDrrx  ;t4oet mfctad s2rmnmp u)tlxoxfcoa1lpD auvi ( setrxm3nodoptemies ( aDuaxmo;t1aexn ieiyt s uln o () etnmr3ty1lp  lnvo ( tetrirpoodol  lfei sf Dra(m ot1olxo ociytfmDrmuvs;t0texrir to1faDr ueo s) euoxm io4altemfci ( s2trum ;u4altn oetltls rm(vp ()aleoxf3oa1fpt lnvs (0s2trxmpiy1lle lictas  2raxm ot4tetoiocilt m2rmnmpn()artnir iadfmD aiei (0sexo(opiu1ll  liesa()aDta(m ;u1tlxn feiasfm eanms t) eerircoatoatelu ol() etmxo3no1aleemictl(  Drrxm ;t1alxnif3iad aDem(ms u4arxrmfciotfmDrau o s srxr(m ny1lpeemfcia(fsrtr(mp;t0teeomf3ils sDelu s;u0tlenxo3iotfmt  nvilt) 2um(mpnu4llenmiet s)a2rr(mpnu1tpxnifeiatfsDraumpnu0trxoxo iadomt luvo;t)teumir iu4olt mnet (f rua(monu4opxniicild a ul( p;t)tetomf oadfmDrlnvo s0trurxm nodom   fcs () ruaxm nu0tptoio3iydlm rm(mo;u) lxnirctodomtraneo;t) 2umim iy4ap  mfcsl(faDtmxro;o4altomoeiysfa2raump;() exnifciotfpD aivi ( s2urxr3ny4am  mics s)s2rm(rpot4tlen o3tytlm2ranvon(4artnxo3iatlpt lnvs;()t2urir3nu1alenmfesl(f 2tmuronu0tpx mociyd aDua(ms;u0tlenio3oo1omtranvs;s)trur(o nu1lmee ncsltfsrrrum oo1texnii3tys m2rm(mont4aetnxrcootoa  aueolt)teumimpno4lmt  feta()sDrru ooo4apt ifctlsfs2em(vsnt)alxriocia1fmDrai s (  2umxmpio1ol nmnctlsfa2raumpou0olx mociad aDeanms t4artrircoytfm  luvo t) exm(mpny4omee ncils) Duaxronu1oetomoctasfs uan p;t)aetrif iytfaD  n ils  2xmxo oy1ap nmivsas) rum(mo;t4tpeomf3tyd s2ran p u0 ltoxf iatla r n s;t0seumxm3nu4amtnlivias s2rauroou0ale mfciatfm rmumsn()treoxfcta1omteln o;t)texm(r3oudlp elnvia()a2rmxmono0open icilt m2ea(mo (4tlerxr3iadla r ivs;t0teto(r3iu1lm n fetatf rrruroou4texnif3tytls2emump;() ltnif3iadlp elueo s) rxoirpoudamt mics tfsrtau  oo4alenmo3ilt s emn snu)tlenxoctodlpDe n o;(0t2umir3no1amtelncils srtmx ono1oleoiieiatlm2rauvs;t)aeenif3to1fmDranvs;(  2tmir oodolee fvsat) Dtaurp;u1ale ifeiysfa rmnvs;(4 lxoxfcoodfa rln il( texoiopou4olen nvt t) ruru  oo4oleomf3iyslmDrlu pn(4 exoiocoodla rai sls0teuoxmpoodll e ivias)srrrx pou0tlxn fciadla2uau p;t0alxoif3ootfmtr ueo;s) etr(o oodam   ict tf ruaxrp;u1aexo i3tatfs2uanvp (4artrir iadfmtean o;s  2trxopio1apeemieiat) 2uax  ou4tee  ieiltfs2rmnmo (0 exnxrcoo1fat  n ilt0tetm(rpno1op e nvsat a2ur(  no4tle mocilt s rmuvo t)alenmf oytlmte i i ()trxo(r oy4llenmnctat a2tm(mono0olxomo3iytfa2rmuvo;t) lxnxf oy1fp eanei;()seur(m ou4lmtemivsa( srtr(roou0oeenmi3iyslm2rmnms;u)artoir3ta1fmte uvs t s2ur(rpny1amt  ivtatf 2urum ot0oet if3iltfaDua(vp t4 reoxoctotlaDr ivsls)teumxo iudlle  ivi s)aDumu  no1apx iictyt mDel( p t0aexomrcia1oa eln s;s)t2xm(o3iudale  ncs t) Dtrumooo0aex ifctatfa2rl( p;t4texoxr ootomDelnes;t  exo(r iudomtelfvs ()sDrru o;u0optoio3tytlmDeauvs;u)trenmo3io1omDe nes s0 2toiopio1amtnmnetas s2ta(m ;t4teeniictadfa2uanvo u0aetnio tadfatrauvi s0tetr(r3ny1ome lici ()a2tmx poo1ale miciysls rlnvsnt4tlxoifcoydlmDrlnvs;t0t2toiopnu4openmfetl(  Drm(ront0opt  o3tytla ra(ms u0alenmfcootlmDrluei;(0sexmxm3ou4lptelfes tfarrm(  oo4apeoiieiyd s el(vsnu)arerxociy1fmD  u s t  euoxm iudlp e fctat)sDtm(  ;t0teenmfctadfs2elnvpnt)tlxrxf3oatoa  anvsl(0s2trxr iy1olt  fvia(f Dur( ooo0tleoiocildfmDrmumsnt0trerir3iotfm rlu ils  rxrio3iy4alt lnvia(f 2rau pnu0oee iiciltlmDuln o;t0aexoxo3tytoaDr ieolt)seur(mpnu4al emfetltf ruru o;u0ope  feiydfm2uaums t)alxomf ta1fmt ai s;(0 etm(m nudolen ivtls)sruau  nu4oexomi3tytfa2rlumpn(0tleomr ia1fptr u o;(0 2urxm iydope  fcils)sDum( pot4aex mictasla eauvp;t0artnioctodlpD  ieolt teurxrpnudom nlnvt tfs2ur(r ou1tlx  octatls2ran o;(4trxoxo3to1lmDrlivs;()s2xm(o iy4apen nctasf rrrum ;t4tlxn f3tyt m2eauvp (4 exrif iydfp eliesls)trumim3iy4ape mnetas sDuaum nu0apxn o3tltlm2uln pnt4tetrxfciy1lpteaivil(0 rxmirpio1lm nmieta(fs2tm(ro;u1apx ifetasfm umu p;t0tleoif3to1fp   neo;s) 2xrir3nydamt lictlt  rra( onu1olen oeiysfa uan o t4arenxf iytopt an s;t0 2uoxm oy1om elnvsa( a2raxrono1oee  o3ild aDumnmonu4texoif3oa1fptrau o ( tetrimpou4omen nvi (f 2rm(  ;o1alen oeilslsDemu s u0 etoir3ty1om eauvo s0tetoir ou1open nct sf Dtrx o;o1opxnmi3iytls elumo u0tlxrmo3tytoate u ilt)srxmxopnodaltn nvs ()s2ra(mooo1tex  ociyt aDem(mpnt0tltnxo3oo1fmDe u s;s0trxoimpou1ale mnvs t arrrxr no1apto oetldfa2em(mo;t0arxnxocoadopteai ols)tetr(rpiy1apenlivta( s2rmu oou1opx  oetysfa2rl(vs;t)trxoxr3tadfate nvo t sruoxr3nydaltnlnet () 2raxmo;t4aetnii3tltfa rmuvs;t4trxnif oy1laDeln o () ruoir nu4ape  ici (f 2urxmo;t4oeeoiieias s2uanmpnt0 rxnif oo1oatraivols)tetmxopoydlmt lictlsfs2tmu oou0tee mictlt s ua(vp u)trenircoy1opDrluvo;( trxriopoo4lp n iet s) Dtr(monu1olxnmictysfs ean ont0 eermo3ia1lmtrlivi t)tetmim3ny1altn fvi ()s2uaur nt4tlxnio3ilslmDra(vsnt4 eenxf iadlp rlu ils  euoiopou4ol elfeiasfaDrax o;t4olxomi3ias a ul(mp;t)aetnio3ta1lm rai o;s)t2to(m io1op eliciat) 2tr(m ou1oexnif3tas a emnmpnt4artnmr tatfp  an olt) exrim3io1olt  fvt t  rtm( pnu4tet mi3ildlsDranms;(0tltnxocoatlpt auvo;(0sexmxr nydame lfei tfs2umxr nt1tlxo o3iat sDrau snt4 ltomr oydfpD ai o s)setoiopiu4lptn nvt t s2ra(r oo0aptomoetysla uaumo (0 rxoio ta1fmDrauvsl()seuo(r iy4lm  licilt) rum(  nu4tlt  ietldlm2em(ms;t)arxomfctodfm r i ilt)trxmxr3nydolenmnvtltf 2rmu ont4apx  o3tlt m eanvonu) rxoxf3oatlp   i ils)t2xmim3iy4lm  mieiat aDum(m nt0oexniiciyt s2uan s t0 reoxo ootfpDelues t)t2to(rpoo4om e ivi tfa2tax  no0tpeoii3tysfa2ulnmon(4artnxo3iadlmtrlnvs;()trtrirpio4apen ies sf rumxmooo4olt iocildlsDeau p;u0tetomr3oo1fpDe i sls0sexrimpiydlp  lneslt)sruru o;o0tltnifctasfmDum(vpn()tlxnmr3iatlpD auvs;s0setoxmpou1omee icsa(  rur(  nt0oexo oeiatls rlu o;u4trenmrcootlmte ueils trtmirpiy4apt mnvi s)sruru  ;u0apxomociltfm2el(vs u4 rtrir3iatlmDrau s;(0 2trxr oo1lm e fcta() 2umurooo4apxnif3iydlmDua(ms (0aleoif oatfaD  uvi s0tetoir3nydaptemnvsatf 2rmump;t1tpxo o3iydfsDemu snu4arenxr3tydlatelivi s trtrio oo1lme mics ( arta(rpno4apxn ieiadfmDum(vp t0 lxnxoctytfmD ai slt)t2xmxr3ny4lle lfvi t) 2rmxroot4tpeoiictydfa2umuvp;u0 rxnmoctatomDr nei;t)sexrxrpiy1apee ivias aDuaxrpnt1alxo oeild m2eln s;t4tlenir3oo1lm  aueols teum(m3iu1oltnmnetl() Duaxm nu1tee ii3ild m2ran p t0tetrmf3oa1fpt anvil() 2toio io4optnlicta()s2ra( oou0aleo i3iadlsDrau pnt4 rxomf3tydfmDe nei;(  2umir io4optnlicsa( aDtaxrp;u4aetnii3tytlm2rl(vo (0areoxo3oo1lmteaueo ()s2xr(o3iydlpeelfeia(faDtaxm oo4olt ii3ilsfm2emu snu4artrxf tydlp  lnvils0 rxrxo nu4lp emfct sf Drrx o;o1texn feils m uanvsnu0tleomo3oatomteauvi s0s2tm(mpou1lle mnctatfaDra(m ou4opxn ietydfsDeln p;()alxnmrciodfpDelneo;( setmio3no1openmicsls a2rru  ot4tleomieiltfs elnvs t)texrmf iodlatr nvi ( sexmxo3oy4lpenmncia(farrmu pnt4oltnmi3tysfa2ean s u0tlermf ootoaDrai ol(  exoxm ny4alt mneta(f Dur( pou1oltniieiyslm2ua(ms t4aleoiociodopt luvi;s) rxoxrpio1alt mfcsasf rrmum ;u1aee moeiatlm emump t)teenmo3ty1fpD luvsls)sexrxr oudaleelncslt) rtmxm no4aleomietasls2um(vonu)altrxf3iatopD  nvo;(0 etmxmpno4ame  nvi ()srtau pnt1aee mi3tysla2uaumo (0 leomf iytfp rln sl() 2tm(mpoodop  mfvt (farrr(ro;u4apxnifeias a2em( sn() lxrxo iytlm elieslt0 exoim3nu4lmtelnvsat)arrr(rp;o0apeomo3ias m ran pnt)arenio3tatfaDr u sls0seuoim nodomtelfcsl(fartaurpnt1teenmiciyt a2rmu o;t)trxomo3oytfm  li i;( s2xo(mpio1amt  nvs tf rta(ro;u0oet iociat s2ulnvs;u0teeomo oydlmtrlu i;s0 2tr(o iydapeemneils)a2ua( p;o0oeeoio3iyslsDulums;u)arxrir3iy1op eaivs s s2urxm3iudll  mncs ()sDtmx  nu0tpx iieiydfa2emuvp;u0arxoif3iydop e uvo s t2xm(o nydlm n nesa( s2rrxmo;o1opt  i3iys mDulumsn(4arxoiocoydlpDrlu ilt0setm(mpou4lltemfei s) 2tmum nu0apx ifeiltlaDranvo t0 ltnxr3ia1op   i i ()truoxmpiydal e ivs ( sDtaxm ;u0aexomictysla uln o;t0 etoir tadlp e nes;(0trxm(opiudlleemieiatf rraxm nt4opxo fetas m um(mp;u)alxomf ootomD au s t  exmxr3iydol emfci t)aDrmxrpno0opto iciasfsDuau p u4trenifciadfp e ivi;(0 2urirpoodlp e nei ( a2uaum ;t4oexo octlsfa2umnmo;()arerxrctydfp rluvilt0t2toxr3no4altelfvsltfsrtau  ;o1open ocild a elu sn(4 exnircia1opt liei;t)t2xoio3nu4llte fcia(fsrta(r no0aeeniietasfm rl( pnu0tlenxfcoy1latraieol(  eurxmpiodopee fei tfs2rm(r ;o0openmfeias a2rm( s;u) exnxocoodop  livs;t0 rxr(r oodlmenmfvils) Dumum ;u0opx  fetysfm2eauvonu) rerxo3iy1lp rai olt  exr(o iy4lmeelnetls a2trxro;t0apenmfetld s2em(vsnt0treomr totlmtr ivi;t s2urxr3iu4al  licsat) 2rm( poo1aee  o3iyt mDrm(mo;u0 ltrifcio1op   uei;(0 eurim iydaltnlfcilt aDrmumpno1openmfciyt m rm( s;(4altrmr3iotfmDelieol( srxr(m3iodoltn iesas)sDtrur oo1oet ii3iatla2emnvonu)alxomoctadla   iei;t0 eumxopoodapt  fvt t srurxmo;o0oltomietytlm rm(mont4altnxfciy1opt au olt t2toir3iy1lp elfvsls)artaurpnt0teen ociyslmDumuvp (0texnmo ootomteaueol()s2urxo3nydlp n fctls)sDrmurp;o0apenifcild sDuauvont4texrmr oo1fmt lueilt)t2tr(o3io1lltn nesl(fs2tmu o;t1tex mieiys aDum(vont4trxnxocootfat  nvs;s0 etr(opio1op  mics s)aDuru p;t4oex ioctyd m2rm(vsnu)trtrxf3iodfmD  i i s) rxoxmpiudop n ictlsfa2ua(r ot1altomi3iysls uau pnu) etnmrcootomt  i o ( setrirpio1am nmneia(f Dua(ro;u0ape mo3iasls uan s;u) rtrmf3oodomD aneo;t) 2to(r iu4lpen nvta( arumxro;t1oetoio3iyslsDea(vp t4alxnir ia1fm  auvs s) 2xrxo ny4ol   nvi (farurur nu0apenifeias sDua(mp t0areoxrcoadomteai ol(0tetmim nydap nmivtlt aDtrxr ot0oee mfciyt s eanmonu0trtomoctodfptrli s t0texoim ny4lmee net (  2rm(mo;o0texnmoeiatlm ulums () rxnmr3iy1opteai o;s teto(opiy4lp n neslt) Dtaum nu0tpe io3tldlsDrauvp (4tltnxo ta1fmtr ueol() 2xrirpnodlme lnesatf 2tau  ;t1tpe moctls m uln s u0 rtoxo3to1opDrluvsls)trtrio ou1lpt  iesas)sDraxmono1tet mi3iat s2elu s (0 ltoxrcia1opDeliei t s2ur(r oydap nlicsatf Dtmxmono0aleo ocils a2ean s t)arxoir3ootlmDr nes (0 eum(o nodlme livt t s2ra(rpou4ole ii3tlslaDuau p;t)alxoxrcia1opt lnvo;( s2ur(o3iydoptemicilt  2rau  ot0tet mo3iatla2ua(mpn(4 lermr3oodlp  lu s;t) 2urim3oo4omtn ivi ( sDtau  ou0apt ifeild a2ra(ms t)alenxf3oo1omteanes t  rtm(o3ou1ap  mnesa(fs2tmxmpou1teeoiocildlm umn pnt0 rxrmf tatlp eln sls) 2xmxopno4lmtnmfvt t srua(m no4oee  o3iadfsDumnvp u)tlxrmrcty1fm   uvo t)trumxmpoy1amenlfcs ( sDta(rp;u1opt ifeiltfa2rl(mp t) etoxocoo1oate i sl( srtm(o3no4lpt  ncil(fsDrax  ;o0olt mieiys m ranvont4arxoxf tytfm r ues;s srtrxm3ny4lpee ieiat)sDraxm ot0tetoiociasla ean pnt4aetoxf oa1lpteluvi (0 exmim3iudap elnvtl(fa2uax poo1aexnifeiydfm2em( s (0tlxrirctatomt  neolt0trxm(o3ou4lltn nviat aDrau pou4alxnmf3iltfm rmuvp;()tetrmociodlmDeaivil( trurxo3no1am elietatfsDtr(mpnu0oet moetaslaDel(mp;()artoifcia1opDe n o s seur(rpiy4lle livtl()s2taxrp;u1aet io3tlsfm2elu o t4arxoif iotlaDrau s;( s2tmxr3ny1lltemnvslsfsDua(r ot4olt  f3ilt s ulnmp;u4 lenifcoo1fa eluvi ( t2uoxrpoo4amtemiesas)artm(mo;u0ope ifctatlaDulnvp;u4areomrcootlat  ivs (0seurirpio1amt  nvia(f rtr(roou4tlt  o3iyslm rlnvs;u0 lxoxr3tytfm  anvi ()teur(o3ou1lle mivta()artru o;o0oee iicild sDea(vp;u)tetoxf3tydlmD an i () 2xmxmpoodam  mfvs (fs2tax  ot4oeto ieiysfaDean o;u0 exrxf todfat lnvo;(0setrimpio1apenlncsl(  Drrx o;t4apeo ociat sDua(ms;()tltoif oy1laDeli ilt s2trxopiodlm nmnvi sfa2uaumpou4tptnmocildfaDrauvs u4aexrmf3to1lpt  ies t0 2xoirpiu1apeemnvsatfartmxm nu0tltnmf3iltlm ea(monu0tetnmo3oydfpt au o ( srtmxopiydlmt mncs ( sDtaxmoou4opxo octyd a2rlnvon(4trxoxr tadoa e nes;(0sruoir nu1op emfvsl(f rtruroou0opx  oetatlm elums (0tetrio3oodomD livo (0 2xo(m oodameelfeia(fsDumu o;t4alt  iciadlsDrau pnu0 lxrio tatfaDraues (0 2ur(m3ny4open ivta( a2urx o;t4tee  ocilslm2ua( o (0tltoxf3iotop e ues t) eurxm ou4llee fvtatfsDra(ro;u4tet  ocias s ea(mp t)texriocootfm rlivo ()srxoim iodop e ietltfsrrruro;o1tee mieiat m eanmon(0 leomo todfate uvs s s2uoxo3iu1apeelfvilt s2urxr nt1apenmfctad aDra(vp;t0arenifcty1op e i slt0 2uo(o3iodop nlfct s sruru pnu0aee ii3iat m eauvo (4aeenifcootlp eluvi;t0srxo(opoo1lpenmnvi (f rumxr oo4oee  oeiasla2ulu o t0 etoxf3oatfaDeau o t) 2umxm3nu1ap   netlt a2rrumpnu0apxomfcils a2uauvpnu0tleoxrciydfa e iesl()srtr(r ny1lp  lnvils)a2uaxr ;u1tee io3ild s2eau o ()artrxf ty1latrauvs;t  etr(rpoodam e fviasfsrurumpoo1aeto fetltfaDeluvs;() reomr iydoaDe nes s)s2xriopoy4omenmnvsatfa2rmxmont4ale  fciasfm2ra(vp u)aeeoirciadlpDrau o (0seum(r oy1aptnmfci s)a2ra(mo;t0tptoif3tadlmDuanmp;u4alxomociy1oate nvs s seur(r3ou4lpe livtat aDra( ooo0tltniieiys a2emu s;()trtomr iadop r i il()texr(r3nudlm  mivtls)aDuau o;u4alxnii3tysfaDumu s;t4aetnxo3iodla   nvi t)t2xm(m3iudapeemfcia()arumurpnu1tetn oetadla2uauvs;(4 lxnxf tydfmt an ol(0trtoim io4lmee fci ( a2rmur no1olx mf3tld a2umuvont0aleomo tydfm eauvi ()sexrxm3io1optnmfci ()arumx o;u0opxn o3tasfa uan p;u)tetrmr ia1opteauvi;(0s2um(o3no1lpeemict (  Duaxr ot4tex iieiatlm2em(mo t)arenxr3todopD lu ilt s2trim3nu1lpt lfcil(f Drrxm no1oeeo f3ilsla eauvp;u0 leomrciadop e u i;( trurxm3oydap  mncsa( aDtmumono0apxniocild a emnmo;t4tltrxr3oytop rlnvolt0srtm(r oy4llenliciat)s2urum ;t1tlt  oetas s rln p;u0teeriocoatfpDeli ils sexoxopnydam n netas sDuaur ot1tpxoii3tys sDulnmp u4tlermo3iy1fm rauei;(  rxr(opoodaltn ivtlt aDtmxr ou1opeo feildfaDemu p u0aleomo iydlmtr ueo;()sruoxmpoydlpe lneiatf Durumont0oexo f3iydls rm( s (4tlermf oadlatelneils)srtoim nu4llt mfeiasf 2rau onu1tetn octld a ulu s u) ltrmr3iotopD  n il(  eurxr3nodlltemfvs s)srrmxr ;o4tetn i3iys m um( pn(0trxrmo tydfaD  ues;s s2urxrpiy4altnlfeiltfsDrrxmpnt4opx mfeiaslmDulu o u)arxoxocty1fmtraivi;t0srurio iydolt  ivs t a2rmxm ot4apxn oeiyt m2umnmp;u4artnifcoadoa  ln o s0teuoim no1ome mictls)a2rrx  ;o1tptn oeilt aDeaumpn(4 rtoxfctydopD aneo;(0trur(m3nudom e ivt tfsrtr(r oo4tpx mf3iatfmDuau s;() ltrifctydlmDeaivi t setmir3oudolenmfcil( arta(monu1olxomoetytla rlnvp;u)trtoxo3iatfmt livi;()sexo(m io1amee ivt (faDumurpot0opxnmi3tatfs2elnms;(0 ltrir3totfa rai o ( tetm(m iodol e fct t)aDtmxrpno0tpeo feildfa2emnmp u)tetoxf3ootoaDranei (  2um(m io4am  mncsl() Drm(mo;o4tpx moeiytlsDeln ont4arerxrcto1oatrluvs (  2toirpio1lmeelivtls)srtax p;o4tpxnmiciytlaDel(vo ()alxrmf iytlm ranvo s srurxrpio1ap  mietls)srrr( o;o0tlxo i3iytla uanmp (4tlxnif3tydop   nvi;t tetoiopiu4lpe lnvtls aDtruro;t4olen ictatfa2ea(vo u0aexnmo ta1fmD lnvo t)teurio no4lmt  ivi tf 2rmxmpou1tpe iieiatlm uln s;u4tltomo ty1fmDeln s s0tetmxopiu1op n ieil(f rrmump;o4tlenifcils m2emnvs ()tlerxfcia1latelivsls)seum(r3nydllen ncils)artrx  no0tee ifeiys s elump t) eenif tatfptelivs;t0t2xo(o3ny1amte ies s)aruaurpot1texomo3tlsls rm(ms;(0aexrxrciatfa   nvi ()trxm(m3oy1ll emnvta( sDtrx oou4optnii3iasla2rln s;t)tlxrxo3tydfa elu sls s2to(m3iudlmee nci s arrrum nu0oexomo3iltfaDuauvp t4artriocty1fatrlues s)s2trio3no1lm  mfvs t  rum(rpoo4tleo ieiyd s2rmumpnu0altoxr oadfaD  u o;t srtmxm3nudam n fci t aDtmurpou0ape iictasla elnmont0tetnifciytfm rliei;(0s2triopou1lpe lies sf 2raur ou0olx mietltfm2rl( onu)artnif3oydfmtrlnvs s) etrir iydlmtnmfes tfaDrmu o;u0oee io3tldlaDul(mo;u) renif ia1laD lieo;t seto(m nudllenmicsasf rraxrono4aex if3iyslsDumn p;u4artnmf iy1fa   uvols)trtmxmpou1amte ivtat) Drmx  ou0aptnif3iys a2raums;u4areoxr3ia1laDelivs ()s2xrxm3iudal  livsa(farrrxm ot0aeeo f3iat a umumo t4tltrirciatomt  uvo;t)srur(rpiy4altnmnetlt) rumurpot4opt mfeiytlmDeln onu4trtoxo tatfateai o;(  2xoxo iydape  fcil( srrm(rpno1alxn ietatlsDrmuvon(0tleomf3io1opDrlueslt) exoxr3nodlptelnctl(  ruaxm no1tee ifeils m rm(mp t0trtnif3iytlmDe nvs;s  ruoxr nu1lm elfci ()sDrr(r ;o0tetn ietatla umnvs ()treomfciotlpt an o;(0sexrir oodll  mnvias  Duaxm oo4olxniietldla ea(vp (4aeerxocto1optr u ols  2xmim oy1llt lfct sf rtrxrono0tlxomoeiydls2umn s;u) exoxo3iy1om rlueols0s2xm(m3oo4lpeemieiatfartrumpno4ale iieiltla emnvont)tlxoio oydla rli o t)s2umxo io1lmen fvslt) 2rr( poo0openmociys m2elnvs u4artnircio1om eau i s)s2toiopiudalte ivslsfa2ur(r ou1apt mf3iatlsDumnmo;t4 reoir iy1lmtraivslt t2trxm ou1op nmncils srrmur ;t1alxomiciatfm2rauvpnt0 lxnxf todomDe u slt seumio iu1olte fesat aDuru pnt0tle  oeiad a2ua( s u4treomfcoydlm  livslt tetmim3nu4lmenmivi (fsrrr(ro;o4tex mictls m eau pnt4alenio oa1fpt  ies;s0s2xr(rpoy4olt  ivsatfaDrrurono4aptoifctas aDulnvp;u0 rxnmf3oa1fpDrln slt0 2uoiopoy1amtnmfvilt)a2tr(m ot0ole  i3iysls2raums;u0 etoio3tatlptrlues;()texm(o3iu1apenmfcsl()srtax pot4opxoifctytla2rau s t)aexoir3oo1fp ran slt)t2uo(mpio4olte iei () Dtmurpnu1tlt ioeild mDumuvs ()altnir to1lm  aiei s0sruoirpiy4ll n nct tfsDumx p;o0tlxoio3taslaDum(vonu4teeoircia1fptraieo (  exr(o3nu4lmte nes tf ruaxront1ale mf3ilslm2rln ont0 rtnio tydoa r nei s) 2ur(m nydomt  ivil(farurx oou0aeen ictas mDrl(vs;t4 lenifcoadfp eai s;t0s2trir oudoptemfviat)sDua( pnt0aptomfctls a2ran pn(0altrmo oatfpteai o;s) rtoxm3iudap e neslt)arrrumpoo4olen fetls sDrlnms (0 lxnxf to1omDeaivo s0srtmio iu1omtnlfciat arrmx  oo4ape  ieiadfs2umn onu4 lxnio iytlaD livi ( t2xmiopiu1opee ivtasfsDtr( pot0aexomfctltla2eaumont)arxrmfcoy1lmte i s () etm(mpiu1aleelfes () Drm( o;o4tlto o3iad mDem(vs t)tetrxocia1fm rlneil( truoxm nodolee ncs sf Dtm(rooo1aet mo3iltls2uau p (4texrxrctydoate nvo t texoir3iu4aleelnetl()arur(ro;t0apxoifeildfm2um(mon(4 ltoxf3io1oa r nei ()sruoimpnodllte fcia() 2tmxmpot0aex if3ildla2emnvont4 rxnxfcoydop elu o ()setrxopou1amen fet t) Dtrumoou4oet  o3ild mDul( pn()trerif3oy1fa  an s;s texoim3oydlmt lfvsa( aDurxroot4apxoiiciydfa2eln p;(0 rxoif3ootfptraivo;t s2xo(r iy1alt livsltfs2rrxr ou4oleo f3iyslaDelnms;t)trxoxo iydoat an i ()t2urxo nu4lme mfesas sDtrx  oo1tpto o3iat s2ranvo (0trerxf ootlptrlues s0s2xm(o iydale livsasfa2tr(mpnu4oeeoifeiysfa ranvs;t4 renio3iadlp rlnei;s)seuoio3nu1alen nvsa(f Drr( p;t0olx  oeiat aDrlnmo (0aleomr3iotfp  lneils sexrio3nu1op nmfcilsfs2tr(mpno1ale moctasla rl( p;u0alenmo totlmDelivs;t0 2trxmpoy4apen ncsasfa2trur nu4olx mociat m2ea(mp;()arxrmr oadlaDe ivi ( trtmxrpno1aptemfvs (f 2tmuronu0altoifciltfmDul(ms t0trxrxrcio1la  aieil( truo(r3iu4aptnmnei t srum(ro;u0tet mf3ilslaDelnmonu0 rxnxo oatoaD aivs t srtr(r io1ol nmfetlt s2tmxmont1apx  iciytfm rlu s;(0 ltrir3iy1lp elueilt)trur(r3iodapte nesas a2um(rp;t1aeeo f3iltfm elnmp (0trxnxf totfp raieslt) 2umxm3iudomtelfesasfsDtax  no0texo oetydfs2elnms;t)aeeoxr3oa1oa elnvs (0sexrir3ny1al n fetltfaDrru o;o0apeoio3taslm emn p t4teeniociotopte uei;t0s2uoxr3nudam emnciatfsrra(mo;o1aex  i3iad m2rlnvp;t4tleomfciatlp  an s t srtmxm oo1omtnmfes s) rtr(  ou1aptoifctltfs uan o;t) lenmo tatfm eau olt)trur(o iy4llenmnvs tfsDurxm no0aptoiociadfs2ulump (4 rerirciatfa rli il( s2trio3ou4lpe lfci (faDrmxrpou4altniieildfa2rmnvp;()trerio3oadfpD aieo;s0srxm(o3ny1lm  mncsls)arurx  oo1oee mietldfm ran s;t4artrxr3todfaD li ols srtm(o3nodom e neils)aDtaxroot1tee ii3iydla rln snt) leoxo tatfaD  uesls s2xmxr nudamt mfciat)s2rrx pnu0aleomfeiltfsDemuvpnu0tetrxr3todopDeaueo s)trum(m oo1aptn nvi ()a2trxmp;t4tptomiciasfa2elnmsnt4 rxomr oadoateaivil() rxrir3iodamt liesa() Durxrpnt1ole moctadlm2raums;u4arenio3to1omD  u s;t) 2xm(r3oo1lm n fcslt)a2ta(mo;o1tee ifeiltfs rm(vonu4altnxo3ia1op e ieols0sexrir3oodlmtelictas)srtru ono0oeen oeild s2eln s;u0 rxrxr oydomDeai s;t srtrxmpnodll  miciasfsrraxm nt1tlxn feiysla2rlnvp;(0 rtrxfcoytlpDelneo t tetrir3io4omtemiesasfsDrrxm ;o0oltn fciat mDem( p;()tlxrxf3todlmDrlnes;()truoxopno4am n ieia(fs2ta(m no1opt mi3iadfmDea(msnt0 lxoxfcta1lp  an o;t srto(m iodop  liei ()sDuaxm ot1aleoifeilsls rl( onu0 lxnxo3to1lmD lu sl()srumim oydapte icsas  2um( p;u0tee  icild sDra( pnt0 lxnio ootfmD aiei s s2xrxo iudlltemnctas)s2trxmono0open fetlt aDuau pnu)arxnif tydfm e ivo;t)seurimpoodlptnlfesl() Draxm no4apeoifeiyd sDemuvp;()tlermr todfmtrlnvsls) 2toxm3iy1lpen fvtlt)s2tax  nu0tpxn iciytfa rauvpn()aeenmr3iodop r n olt)texoio nu1ll nmfeils)s2uru  nt4tlenii3iytfa emnvp u)alxrmr3oadfaDeluvs t s2umxo ou4lp n fesatf rtrumooo4opeoio3ildlm ulumo;t0artoxo3ta1opD  ieils)teum(rpiy4lp n nciasf 2uax ono1aptniieils sDrauvsnu4 lxnxo3iydfmD luvs;s0seuoxo3ou1olt mncslt)a2rru o;u1oeeoii3tld m em(ms;(4areomrciotlat lueol(0t2xr(m3oy1oleemicils  2tmxm no4tpxoiocilsfa ulums;u4tltrxo3oa1la r ivo;t) rxoxm nydol   icia(fa2tmumo;o0apx mieiadls2rlums;(0 rxnmr3tadla eauei s)trtrim iu4op  mieslsfs2rmxmoou4tlen fetat a rlnvs;t0aexrir3todomtranes () exr(o iodll emnctas srtr(rpot1tetn feils aDeanmp ()aleomociytlaDrli s;s srxo(o iy1op   ics tfsrtmxmo;o0opxomi3iytfaDrl(vpn() renxr3oa1omtrlnvi;( s2xoxrpoo4lltnlivi (fsDua(r ;o0aee if3tysfm2uln snu4aeermocty1oateln ils) exmiopio1ol e nci sf Drmur ot4teenifeils s em(vs () exoxoctadfmt li o;t)srtoir3oydlpe lfvs (f Duaum no4aptnmi3ilt s2raumo u)arxoif3oa1lat  ivs ()srurxm3ou4ll  lfcilt)aDrmx o;u4opto fetyt m2emu s;u0 leomr3ootomDrlnvs;t0trumim io1alen nvsas)arurx pot1oeeo feiadfm2rln o (4 eeoio3iatop   ivo ( t2umim io4omt livsl( s2urxm ot4alx moetyt m umuvo t) rerirciadfmDeai i s sruoiopou1optemivsa(fsDurumono0opx  fctlsla2rluvonu)aeeoxf ootfpt anvs;t srxoimpoodap nlfci t  2taxrp;o1tltnif3tadlm2emnmo;t0alxnmocoy1lpDeaieols) 2trxmpiy1om emfviltfsDrm( o;u0tlxnmfeiatfaDel( sn(4 ltnmf3to1opDelnvils0texoio3oodlmeelnvtl(fartaur no4tlx ifciltfaDumn ont0aetoio3iodopDeaues t) rurir nu4lmtnlicsls artrx ont1oexomo3iat m umnvo t0aexnmr todoa rau o;s0srxmir nudap nlivtlt) Draxr ;t1openmfeias m rmn s;(4trenmrcootlaDeln ils) 2uoxopiudllte feiatf rrrxm no0tleo o3ilsfm elumpnt) etoio3ia1fpDelivi;s seto(rpnodopen nesatfa2ua( oou1tlt ifetltlaDelnmp;u0 lxniociydfpt  u i t)truoxopio4omeelnvtl() rtaum no1olx mo3iyslmDeauvp;(0tleomf oy1om e u i (  2xr(m ny1aptemneil() rrmumpno4aeeoifeiadfa2uauvs (0 rerio3iydoptelnei;t)srxo(m3nudlmenmnet tf rtr(r ;o4tptn ietld sDulu snu) etomf3iy1lmte ivols)t2uoxm3oodamt livtasf Draxroot0tlx  iciltfa rln on(0altnmo ta1fa  lnvs t)teur(m3no1ol nlnctls)arrr( pou0tlxoiieiydfs el(vpn(0aetoir3iatfm   iei;( t2toxo nudapeelieiat)a2tm(m ;u0aptnmfciadfsDel(mon(0 lxrio oatoa e uvi;s s2xm(opio1altemfeils)aDuax pno4aeto ociad sDranms (4trenxf3iydfatr nes s) 2uoxo ny4am nmiet t)arrax pot0optnioeiydfs2eln p t0 ltrirciydoa r i s s sexmxmpny1ope mfet tfa2tmumpot0tpx  ictad s ulnvo;t4tlxrifcio1omDean slt  2urio no4amenliesa()arrr(mp;t4tlxnioctaslm2raumo;() exnif iotlaD aivi;()srtmirpnu1apen fvt ( s2tr( p;t1oex mietytla em(vpn(4trermo io1oaDeauvsl(0s2xo(opoo4lm e fet ()sDur(mo;t1altniietltla emuvp () rxnmo ootopt  ivils0sexoxrpoodlptn nct s a2uaxmpnu0apx moeiydfs2ulnvs t0 eenxfctadfpDrli o s sruo(m no4omt mivia(fs2ua(mo;o1aetn ocilt m2emnvonu) exrif3iy1lateli il(0srxrxm3oy4omt mivsltfarumx onu0oeenif3iasfsDrm( on()aetnmf oa1latr u ilt s2toir3nudlm nlfcs (  rrruroot4apenif3iydlm rauvo;()aeenxr3tadfp eliei;( trumio io4lm n fviltf 2ua(  nt4opx ioeildla em(vs (4teerxf3to1lpte uvi;t) rtoxo3nydop   nvil( srtrum nt4apt if3iytfm2rln o t)teenxo iydom  lneil(  rtr(o3nydaptelfeta(  2tm(mpno4ape  feild aDel( o (4arxrio3oo1om r uei;(0 euo(m3ny1lpt lnvia(f ruax pno0tltnif3ildls el(vpn()aeeoxocta1lp r ivo t) rxrxrpoo4omtelictl(fa2rm(mo;u0aet  i3iltlaDulu p u)trxrmo3iytla eai o;t0s2tm(r3oo4am   fctlt  rtmu p;t1apx mfetlt mDul(mon(0alxoif totopt  ueils0 2tmiopoy1omenlfetatf Dtaum oo4oltoifcilslaDulnmpn()aetrmocoydfpDran i t0 2xrirpoo1amte icta(f 2taurpno1oex  o3ilsla2rlnvo t)arerifctodlp eaivs;t seurxopiy1lleelfctat sDua(ro;t0teeoif3tysls rlu snt4treniocoydfmDeaieol(0trxrxopio4ome mfvsl(  rumur nu1opt mocias s2ul(vo;u) lxrmf3iy1om rai olt  exoim ou4amee ict (f 2rr( o;u1teeo ictld a raumo t)arxrxf3oa1fm rauei t0srtmxr io4lmenmfcil()srtmuroou0opxo ieiltla eauvp;()arxoxr tatfmtranesl(0t2to(o3nudop e ivia() 2rrxrpot0opt  iciytfm eaumo;t0 exoxfctatopD lu s t) eurir oodlmeemnviat)s2umx  nt0tet ioeiadfm2um(mp;t0 lxoif oy1fmD lueol( teum(m3iy4lpee fcias a2uaxmpot1tlt  i3iat a2eauvp (0 lerxrcta1lpDrau i;()trur(o3oodll  licta() 2rmumo;t1optnmieilt a rm(mp u0 reoir iadoat  nei t texrxr3iodllee iesa(fsrrmxmp;t0optomo3tatfmDel(msnt4aexoxrcoa1lmD  u o;( texmxm3iy1amtemnvtat artaxrp;t0altn o3tydlmDea( o;t)aexnxfciytom elueil(0srtmim nydap emfeia( sDurum ;o1tltn fetadfaDeluvo t0tetomo tatfp ranei;s) 2trxm3ny1lme miei t  2rm(mpot0opeoif3tlslaDuan o (4 leomociotoaDe neil(0 etm(r nu4oltn ncils a2trx  ou4tlx mi3iysfa ul(vonu)aetnxoctydfm eauei () rtm(r oo4ome mnvsls)sruaum ;o0tptniictldfs2rm(mp;(0 lxrxoctydlm e i ils)s2urirpoodop e netlsf Drrx  ;u0aexomo3iadfmDrlnvs u4aeeomo3tadomt li o ()teum(m3nodal n nci () rur(r ;t0olen ictytfa2ean o u)alxoir tadla  auvo t t2to(r iudlp  micta( arrrxr ;t1apxn ietydfmDrlu onu)texriocoo1fptrlueils0 rxr(m iu1al  mfviatf Dur(mono0olxn oeiyt s2em(vs t)trxnio oodfa r nvo (0 etrir iudal e icta(f 2rm(m ou0ale mi3ildfm eluvs (4tleomf3oadoa elieslt)s2umxr3oy1lleemnctls)a2tr(r ;o4alx  oeiadfs2um( o u0 ltrxf iy1oat  ivs t)trtoimpiodope mictasfsDuau poo0tlxoio3tasfm rm(vp;u4 ltnxo oo1fmt  u olt teur(rpny1altemietlsfaruau ont0apt  ictasls rmnmp;(4tetoiocty1om rlivs;s0sexm(m ny1lp elfeil( sDrr(  no0teeo ociysls emuvp t)tleoxociotfm rli sls)texo(opnudaltnmnetl(farta(rp;t1openio3ils s uanmsn(4areoxf3tydoaDrai i s)t2uo(r oo4optemnetat) rtaum oo0alx ioeiltfa2rln pn(4alxoio3oydopDelivilt)teur(r oydll nmnes tfa2ur(mo;t0texoii3iytfa elumpnt4tlxrmfcio1omDe ieo;t0s2toiopiu4llenmict ( s2ur(mpot0tptnii3tldla rauvpnt) ltrir3tatlm e ues;s  etrxo nydomtnlncta(fs2tmx pot4tleoifciys s2rlu s;u0 exrxrcty1faD lieslt0srtm(mpou4olt lnet s)sDrmx p;o4aeenmoetyt aDum(vont0arenmrcootlpt lnvo;(0 2ur(o iu1lpeemnctat) Dumxront0opxoifcild m emnmpn(4aeeomf3tadlmteln slt) etoxo3nu4apen fvias srraur ;u1oetoioetasfm2ua( o (4tltomrcootomtr ivil()t2tmiopoo1lpe mfvta()s2taumpou1tetnioctyt m2rmump (4 eeoxrctydoatrlies s s2xoxm io1lp   iesas) 2tmurooo4tet micilslmDrmnmp;(0 eenio3todlmD ln i;( trtm(m3ou1ap  micias s2uau ooo4tleomocildfsDul( s;(4 rerio ia1faDe u s s)t2xr(o3iodopt liei ()artrur ;t1tlt mi3iaslm2eanvs;u0teeoioctydom   uvil( t2toxm3oy4lpeelicta(  rta(mont1opx  iciasfsDrl(mp t0texrirciy1fm e i s;( srtoxm iy1apeelfctls aDua(m nt4alxo ictatlm uan snt0tetnmf3tadoaD  ies;(0t2xm(mpiudolt mfctlt srumx  ;u1olxomoeilt a2rlnvp;() rtomrctodomDrai s t texm(m3nudaptn ivta(f 2ra(  ot4olenmo3iyd mDrauvp t4alerxo3oydlmtelnvsl(0 euoio3oy4ape  nctltfs2ua(m nt0tetnmieiydls rm(msn(0 rxnircootoa eauvo t)srtoim ny4amtnlfci t a2rrx ono4aet  ieiytfa eaumpnt0alerirciodla eai il( seurxo nu1lptnlnvslt  Dtmurp;o4aet ioetaslm2uanmo;(0tlermociydlaD aieilt0trto(rpoudom nlieiat  2rru p;o0tptn ietasla rl(mo t4tleomr3io1la  ln i ()s2to(m3io4lmtemneias)aDtr( p;t0teen ocils aDumnvs () renmo3ta1opDe ivi;t0t2tm(r3ou1ap nlies ()sDrm(r nt4olx if3tytfm ra(mo u0tlenmr ta1omDeanvil()setmio iu1lm  micsltfa2ua( poo1aetnmfeiadfa2um( pn(0 rtoio3oydomt  u i;t s2urxr oydll elfetls  rrmx o;u0tex iociltfm2eauvs;()tetnmocia1fmteaueol(0 rurxm3iy1lp n netlsfa2uaump;u4oex mo3iydfm elump;u) lxnxf3oydla elnvi;s  etm(mpoo4ll elnctls sDur(  ;o4altnmfetydfm emump;()arxrxf ootlm e n s;t seumim nodom elfeiasfaDrru  no0oexn i3iltlsDrmuvo;()texrmr oa1omD  u o t0s2uoirpoodomte ivtls)srur(m ou4aptnmfctad sDrmnmp;t4aexnxfciadfmtran o t) 2uoxr3iy1lmtemicsas a2raumoot4aetn iciyslmDua(vo u0areoxfcoa1lpt aneilt trumxrpoo1lpee nciasfa2um(m ;u0ole iiciad s2ranvp;(0 eermf iytfat  ivslt0t2um(m oodamtemnviat artm(m nu0ope if3tatlsDra( snu) exrmfciotoa r nes;(  euo(m3no4lmt  fvia()s2rmxr ;u4optnif3iydlaDem(vp t0texoio3iodfa  aies;()s2xm(mpiu1alen feil(f 2rr(m ou0aptnmietysfm rl(vo u4teenxf iy1fateaiesl(0srxmxm io4optelncsl(fartaum ou4tetnifeiad mDrm( pnt) rtnxo3oadlmt aivi s  rtoirpoudameemiesl( s2tmx  oo4oee ii3iydlm elu pnu0tlxomrciotlm   ies t t2uoim3nydlm n fciasf Draxroou0aetnmf3tytfm2uau s t)trenmociodom eauvols0 2um(o3no1ol  micsl( arrrumono1ape if3iasfm ul( pn(4 reoxf iodfm r nvols  rtrxm3oudameemncsa(f Durxrpnu1ale mfeilsls ea(vpn(4 rxnioctotlatr u ilt srxrimpio4aptnmiet tfartr(mpot1tlt  ieiasla ulump u4 lxrif oydlpD aivil(0s2tmir3no4op nlfvil()s2raxr no4olxniociltfmDrm(mpn()tltrmociatop rlivo ()trumir nydomtn fei t)a2uaxmpoo4aee ifeilsfa umuvo u0 lxnxf iadfaDran s s) exoio3oodomen ietasfsrtr(mp;t1aexomieiytfsDulumsnu4tlermr3totfmD  nvo;t)truoxm3oudol  livt () 2tmurp;u0olenmfctas aDrl(ms;u4 eeomr tatlm eanei (0srur(r nu4amen nctl(  rum(rono0aexnif3tyt mDrau o;t) exnxo ia1late ieilt setrxrpoy4omtn ivslsfaDua(  no1altniieild aDum(ms t)altnircoatoaDelu i;() eur(m iy1lptnlnvsl() rua( onu4olxomf3tatfsDrmu o;u4 eeomf3tadlateaies () exo(m3iu1omen fct s  rraum ou4tex mfciyt s rlums;()altnifciydop rai o;t  exm(opiy4oltnlicslt sDraump;u0tlen f3iytlsDeanms t0 eermr3tatfa e ivi;( srtmimpnydoleelnesa( a2umum oo0tpeoioeilslsDeln onu)arermfcoa1oaDr nvs;t0 2xmxopno1ope mnctasfartmu pno0olto o3tas sDrlnmp;t4 eeoif oo1opDr n o ( t2xo(o oudam  lnvtl(faDtmxm ;t1tle mo3ilt s2eanmont0aetrif3oydopDe ivs;s0 rxoxo iudoleelnvtlt) rumxrp;o0teenio3tas a2rlu on()trtnmfcoatfa   u o s) 2toxm iodopeemfesl(  Dra(m nt0oeen i3ild a2ra(mpn(0alxnmo tydfm e nvslt srxoxr iy4lltemnvta(f 2taumpoo1apxn icilslm elnmo;t) rxnir3iotlmD  iei;t) rxmxm3iydam nmnctlt arua(rpot4apto o3tlslaDrl(vsn(4tetnmf3oytopD li o t)sexmio nodoltn fesa( aDrax  oo1aeeomociadfaDeaump;(4 lxrxr ootfm rlnvsl(0t2uoxrpiu1lmen ieilt srtm(mo;o1teen feiat a uan o;u4alxrxocoatlpteli o;s  rurxm oo1lle  feil(f 2rrxr ot4oee  iciatfs emumon()tltrxr oatopDran i;t)s2xmxm3oo4lmeelfctat)aDurx  ;o0alto i3iadla elnvp;(0arermrcia1lmD  ivolt)texmio no4llenlicslsf rum( oot0ope  f3tlsfs emu pnu4trtrmf3iadlptrlnes t)texoio3iodlp nmncs s  rumxroou0aptoifetasfaDrlumsn(0arxrif3oodlpt auvo;()s2xo(r3nu4op  mnei sfaDtaxmpno0tlen f3ildfs2rlumon(0alxrxfcoy1oa e nvilt) exr(m3ou4omen ivi t) rtm(r nu4tlenmieiatfs ra(ms ()tlermfcty1oa rauei;(  2um(mpnodlle mnvs (f 2urxrpnu1ale  oeils mDum(vs;(4tlenmo oa1opD auvols0trxmxr iu1altnmfetltfsrta( o;u4tlx mfeiyt s2rlnvon() eenmo3oa1fate ies s)t2xoxrpoy1op e fvsl( sDua( ooo1opeomietld s2rm( p u0 eeoif3io1oaD luvils t2urxm3iu1olt mnesasfaDrmxmpnt0texomieiltfmDum(vs t) rerif3to1op   ivol()sruoirpnu4lm nlfesatf rum(roou4tpxo i3iltls uan s t4 etnxrciy1opt anvolt0s2uoxr3iu4lm e fesat) 2tm( oou4oltn oeiadlm2rm( p;u4 etnxf3iodfmteau sls)srumxm iodol elncs t) 2uaxmpnt4oeenif3iydfmDul(von()areoio tytopteaieslt)t2urxr3oy1ap n nes s)a2rm(rpoo4tet mieiat s rl( s ()tetomocoa1om eaivs t0tetmxm3oy4llen nes s sDrax p;t0altnmfcildfm ua( s;u)tetnio3oo1oaDrlieil(0t2xoiopou4omenmnvtls artmxr ot0altoiictydfa eaums (0tlxrifctydfmD aiei (0 rxrim iy4ll  lieils  2ur(r ou1aeenii3iys s2rlnmon() eeoifcia1oaDr i i t  2trxo nydaptnlivtatfs2rrurpoo0oeto fetadfs2ra(vs;(0tetrmrciodlatr nvs;s0 rxmxo ou4ome lnesl() Drr( p;t1alxoiiciatlmDrmnms u)trtnmo ia1omte nvs;s0 2xr(r3oo1al  mneiat  2rmum oo1alx  fciydfsDua(mon(4trxrmrciadop rluvi t)t2trim iu1am  mnvt sf Drmump;u0apxo f3iltfm ul( o t4 rtoxocio1fptrlneo s texm(opiu4ll   fvsl(fsrrax ooo4aexn i3iyt mDemn p t)aetoir totfmDean o;() 2xoxo io1op  mictas)aDurur ou1apx  o3tad a rau o (0tltnxo3ta1fa  lieo;s0srxrxr3no4alte nesat) 2rmxr no0alxo ictat aDrm(vs;() lxrif iatlptrln o;t srxo(o oo1omeelivt sf Dta( o;o0alenmi3iltfsDulump;t)areomo iadlm e ieols  2umxmpnydal  lfvt (fsrua(  ou0tlxn i3ildfmDrm(ms;t0aetnmfcoytop elueil()tetmxopoudomtemieia() rtmxrpou1aex ioeiyt a ea(mpnt4alenifciy1latrluvo;t t2xo(r3ou4lme mfcils aDrm(rp;t1tle  i3ildlmDel(msnt)aeeomr oadfp  lnvs;()trxr(o3io1omtelicslt aDtm(rp;u1texn i3iaslaDel(vo (0alenmr ty1latrai ilt seum(r3nodomtemnvslt)srtmu pnu0alenmi3ilslsDrau p (0 eeoiocoydlm rluvs;t trxmxr iy1al   nci tfa2tau  no0apenmi3tadlm2eauvs;u) lerio iotlat aivo;()trxo(opio1op nmivtasf Draxr ou4alx  i3ias s eln ont)arxrmo ia1oat  neo;s  rxmxopiy4al n neia()srra(mp;u0tetoiieilt a rmu o t)texnxo3ty1om eluvs s seurio3no4al   nvi ( srtru  no0tptoif3tas s rlu o;t0aexoircoatlm raieslt) eum(m3no1lmeelict t)aDur(  nu1texnii3tyt m2rmums;u4arerio iydfmDe nes ()t2toxrpnudom nlnvt t)a2uau  nu4oee mf3tasfs2rl(vp t) reomr3to1fate nvo s)s2umim ny4lltelfesa(f Duax pou0olxomo3ildfs2elu s;t4tlxoxr3oytopteanei t  rurxopoudlpte iesas sDurum no0optomfeildlm umnvo;(4tetrif iatfm r nvo;s) 2xrirpiu1lmtelncs t srtmuro;t4tlxn o3iltfs eln o;u4aeerxr3oy1oat li slt)s2tm(m3iydal nlnetat  rtrx  nt0oexnmf3ildlmDrmn s t0tlxoif3ty1omDrlies;s srumxm io1lpe lnvi (fs2ua(ronu0tlt mf3iad mDrmums;(4tltrmf3totfa raues;()teuo(m oo1lpt lfci tfaDtmu ont0oleo icias a eluvs ()tetnxr to1om rlivsls)srtrir ny1ol   iet (f 2uaxm oo0oee  i3ias mDeln o (0 lxrmf3ia1fa r neils trxmio oodomtnlnvia(fsrtmxmo;u1tlt mfcilsls2em(vp u0trxrxo iydoa  aivilt) 2xmim no4ap  lnvt s aruauronu0tlx  o3ias a uau sn(0tleomf3ia1om r i s;( sexmiopoo1apen ivt s a2umxmonu0texo feiyt mDra( p u0 rtrir iy1laDrauvi (0sexoirpiu1omee ictlsf 2tr(rpnu4alt mi3iysfm2emu o u4tlxnmocoo1fpt anvs (0s2trxmpny4apeemfeil(fsrrrxrpoo0apx mfeiltfm el(ms;u) etnio oo1lp   ues;() exmxo3oy4ll emncs t)a2uaurpnt0teeoif3ils m2ranvs t) rtoxo3ootlmD au sls0 2umxopiu1lpte iesa(  Drmumpou4olx mf3iltlaDea(mont4aeenxr3ootlmte nvils0srtrio nu1aleemneta(farrmxrpnt4tpeoif3tyslsDrlnvonu4tlxoxocoa1laDe ueo;s)s2xm(o io1ape mnes tfa2um(ro;o0olt  ociaslaDuanmo t4altrmr3ia1fpD ln i;t0 rtm(opiu4ll  mfvslt sDrmur nt0ope  feiasfs2ea(mon()arenxo3oodlaDraies;(  rurxopnodoltnlncta() ruru oot4tpxoifciatfm2em( pnu4alenxfcoodoa eauvo t0 2umxmpiydlpenmnei tfaDur(m ;o1opxn fctlsls rm(mp;(0 eeoxoctytom   neilt)trto(m nodlpenmivi (fsDra(m ;t4ale ii3iltlsDumnvp;t0 etomf oa1la r u sl( srtmimpnu4lpt livtas) 2uau p;t1aleomfeiadfs ran p () etomfciydop rau s s)trtoim io4oltnlnei t a2trurp;t0ape mf3tld s umnmp t4arxriocoo1fpDe iei ( setoimpiy4olt mneias  2urum ;u1tpto f3tlt s2ulumsn(0 rtoxr3iytom elu ols s2trim3iudamt lnctl()arurx  ;t1aetoii3ilsfaDumuvo;(4altnmoctatom e ivi t) 2xmir nydalenliciasf 2rrxront4teeoio3iytfmDrmnmo t4texoio3iatlp r ueol(  2tmxopno4lm emfet (fsDrm(  nu4tpenmoctytfm umu s;u)altnir3iytfaDelneol(0trurxmpnydapt mfes sf Duaxroou4apxo fctls a2eln p (4aexoio oo1la  lu o;(  rxrxr iodam   netls)srra(r no4apxomiciysfs2el( o;u0 ltoxr iydlaD lu o () euoxm3iudope mfet (  2trxmont1apeniicilslm rauvs u)alxnxf3tytfpDelu o;t0srto(m3iy1omtn fei s) rrr( oot1teeomfciys a rlumo u0artrif oatlmtraivo ()srtrxr iodome lnvi s sDtaxro;t4alx  ocias s ua( s (0texoircio1lp  ai il( trtoirpnudomeelnvi sf Drrurpot0oeen fetld a rmuvs u4 etomo3iy1optrluei t  rtoxo iodop  mics s  2ururo;o1apen oeiydfa2uln s ()texoxocty1lm   nvo (0trum(o iudlpenmict (fs2uru oot1tptomietyt sDuanvon(4teerxf3iy1op rau i;( srxmirpoo4ll elivtat  rtmxm ;u0optomieiasla2emuvsnt0treoxocoodfmDelnvs;s0t2trim3no4al  lfvilsf rumu  oo1oeeoio3ilslm ulnmp;t4tlenxociotlaDeln o;t0 2urxr io4om emicilt)aDua(  ot1apeo i3ild aDrm(vs;u)alenxr3oadfptr uesls)texo(rpoodole  ics (fsrtmxro;o4alt  i3iasfmDelu snu)aexoiocoy1oatran i;t s2tr(m3ny4apenmnvias  rum( p;o4tlx  i3iasfaDuau s (4aeeomfcia1fmDrluvols)srxoxmpno4llt  nvtatfarur(  ;o1olto ieiyslm rlnvo;t) rxrio to1lpteln s (  2urxm ou4ap  mnvsl()arurxro;u4apxo octasfm rlnms t)altnxocoytop e u i;t setm(rpny4lmt mfvia(f Drmuro;t0tlxomoeiytfm2ranvo u0 lenircoodomtrlivo;(0 2uo(mpio4amtemfvs tf Dtmx pno1aleniietys a rau p;(0texrmrcio1lm elies (0s2uo(r nodlme  nes s  rtr( ooo1teeomoetls a2eluvont)altnmfctatfptelivsls)t2um(o nydlp e ies s s2tr(  ;o0tlxnii3iyslm emnvo;() exnxrctadfa ranvi;t s2uoxr ny4altelicsasf Drrumo;t4alt mf3tadls ean p t4texomf3tydop elnvs t)trxm(r ny1oltnlnesat)a2rru ono4oet iictlsfa2um( p ()tltrmfciydfmteaivils)teuoxo3nu4altn ietas a2rr(mp;u0oee mi3iadls ulumo;t0alxrxf tytfm r u o () exo(m3iudap n nvt tfartau o;t4apto icild a2ul( pn(4 ltnmrcio1laDeaieil( s2xmxo io4ope lnvt s)sDtru onu1ale moeiyd aDuluvp (4 ltrmr oo1lmt  n o;t)s2xoxrpnydlltelfvtls sDrm(ronu0olx  i3iltfs2rm(vs;u)tltnmr3oatfaDelnvo (  rxoxmpnu4al elnvsatfs2uaxmono4aptoiictyslm2ulums;t) lxrirctydoptr neo ( sruoimpno4lptn net ()sDrmuroot1tltoifeiad s2uanmo u)trenmf iodoaD aieo t) 2umxo no4ame lnct ()sDrrxmo;o1tpt  f3iydfmDua(vsn(4 rerio3ootfm  au o;t sruo(r ou1lmtnlici t) 2rr(moou4apeomi3iyslmDumnvonu4alxrif ty1la eli i;t srum(rpnydaltemictlt)s2rm(mont4olxomictyt mDeauvo;u) ltnmocoy1lm  auvs s trtriopnodoptemiei (fsrta( p;u1opxniocildfa2rm(vsn(0 ltrmr3oy1lmDeau o t0t2um(r3nydom elfcils) rrm(ro;u4apeomfetldls2ulu ont4trxoxf ootlpDelieil() eumxo3oo1amtn fetat  Dtm(mp;u1aeenmoetls m2rmuvo;t4 rxnmo3totlaD luvo ( s2xoxmpnu1olt lnciat)a2rmur nu1aexo oetldlsDeauvon()tlermf iodlpD luvi s trtmimpnu4llt  nes t aDumxmpot4aeeoiiciysfm2ulu s t4 exomo3ootfpteau ils0sexrirpno1lmt lnvia()sDraxmono1altn oeiytlmDem(mp;(4 exnio3oadfa e uvol( setoxr3oydom nmfvias srurum no4oetoifcild aDel(vs (0trtomrciodomDran s;s)s2um(m ou1aptnmncilt) Drr(ro;u0aet mietat m rm(vo (4arxnxo3ta1omD  u o s)t2xmxm oo1om  liviat  Drm(mpoo4olt micild s rl(msn(0trxnmf oatfp e i olt0t2xoirpoo1amee neiat)sDtau pnt4alt ifcildlaDrlumo u)treomr3tydlpDr nvs ()srxo(mpoo1lm nmfvilsfartaxr ou0opx io3iaslm2em(mp t4 eerio3oytfatraivi;(0setoimpnu1lltn fct (fsDtmuroou1tltnifciydla2rmnvonu)arxnxfcoatopDeauvils srxoxm3nodop e iet ( aDtaxrp;o4oex  o3tytls el( pn(4 reoiocia1fptr i ils0seurirpou1am n nvtat) Durx p;o1oeeo o3iltlaDeanmp t0alxnxr3oo1om  ln ilt0 exrxrpoodlpee iei () 2trxm ;t1tptnmo3tlsfm2uln s u) eenif3iotfa eanvils0trxmxr3oodol   ivtas  Draxm ;t4ape mfetltlsDrln on(0tleoif3iatla e n o () 2xrio3nydale lnctasfs2rau  ;u0tptomi3tlsla2eauvsn(0aetnmr3iydoaDr uvo (  2umir3oo4lleelnvia() Drrump;u4tlt  ictyslm rmnmp;t0 ltnxf3oodla eaivi;s  exrim ny4altelicil()srur(root1ope  ictytls uaums;()aeenmocty1oat aneo s0srtmxr ny4ope mnet tfa2taur nu1oltoif3iadlaDrlumon(0 etrircta1lm r uvi ( t2uoxo io1lm  lnctls) 2rmurp;t4oltomociadla2ul(mp;t4 rxoxf iy1fat auvo s0 rtm(o3oy1lpeelncta(fsDua(  no1alt io3iydla2rm( s;u0 rxriocoatomDraues;( s2um(rpoydlmtnmivslt)s2tmxr ou1alxomieilsfa umuvo;(0 lenir3oa1fpt an i t)seumio3iu1lptnmivsltfartrxr nu0olxnio3iasfs2ra(ms ()alxniocoo1oatelnvo t)teur(r iudomt  nvi ()a2ra(r nt4olx ifciltls2ea(vo (4texrxrcto1fp  luvi t0s2to(o3oo1ape licsl(  2ur(rono0apeomoeiadls eanvp;u0arxnxr3oy1fa r neols0t2toimpiu4lmeemici (fsrur( pot0tet mociyd aDum( snu0 eeoxrcty1lm ean o t t2xoxrpiu4openmfvt t)sDum( p;t4apenmo3iatla2rmu pn() etoxoctotfat lnei s)seur(mpiodame mivt ( arumuroot0teto ieiydlm2em(von()texoxf3oy1fatran i;()sruo(o3nodll n ietlsfsrtm( o;o0texo ieilsfs2elumsn()treoif ia1opDrli o s s2urim iu4opt mfeilt)aDta( o;u0alt mieilt m2eanvs ()artnmfctatfm r neo;s) rxr(rpiu4llte ieslt)arrrurpoo4aleoiociyt a eaumpn() ltoxf ootlpDranvi;s) 2toxo3iudaltnliei t  Dtmxmonu4olxoiieiytfaDemu p (0arermfcoytomtrlu s;( trurxopio1lltnlfes tfsDur( pnt4olto feiad sDua(vo u)tlerio3oo1fpt  ieo (0trxmim iy4opte ivslsfsrraxrp;o1aex ioetasfs2ua(vp () etrxoctytfmt anvi;t0seurxr3oy1llt mivi (  2uaum ;o0tleoiociyt a eanvs;u4teeomo iodlpDraneo;s t2trimpou4amtnmfciat aDurxmp;t0oexn iciyd sDrm(vpnt4tetriocoodfmt au s ( srumxr nu4llenmictltfarrmu  ;t0tlen fetlslm2eluvpnt0trtomfciodfmteau sl( t2xoxr nu1op   feiat)arurumpnu1tlt  feiatlm rauvo u0aexomr3to1optr nes;()teumxo iy4ll  mnes s)aDraxrpnu4tleomociydfm2emn pn(0alxrmr iydlaDr iesls)t2trxmpoydolenlncilt s2rrx o;t0oetoioeiltfmDuauvsnt0tltnio3iatfatraues ()t2urxr oodalee iciat)srumumpoo0alen feildfmDem(mo u4tlenxrcoytfmte nvi;t setmxmpoy4al e fct t a2rrxm no0tpe io3iaslsDel( s t)tetnxr iatfaDelneilt  2uoxr nydllte feils)srrrxm ;u1tpeoio3iltfa uanvpnt4 exnmr tatfm e nvi t)t2xrim ny1omen ict (faDtaxmont0texnmo3iasfa2el( on(0tlxoxf3ia1fmDeln sl( srtoxrpiydamtelnvs t)s2taxm ;u4tlxoiictad m2rlump t0 ltnir3oytfaDr ieolt)srtr(mpoudomenmfvslsfsDtmxmo;u0oltniiciatfsDranms t0 eeoxfcia1lm raneo ( t2trxm iu4ll  miet sf 2ra( pot1apt  ietldfmDrlnms u) rermo3iadlmD  n o t0setoim ou4omenmncils srurxrpnt4oet ioetls a2ua(vo t0arenmo tytlm rauvilt0trto(mpoodaltelnvslsfa2rrum ;u4tetnifctaslsDum(ms;() exomf oy1oateauesls)teum(m no4open fetasfa2rrxmpot0tptoio3ilt sDrau o;(0 ltomr oytlmteai i;( sexmxo oydomen fcs sfs2uax onu1tlxomi3iytfs2um(ms u0 ltomr3to1fm rlivi;s0t2ur(m3oy1om emfvslt)sDtrxmpnt1oexnmieiltfa rmumpn()tlxnxo tadom rluvsls)seumxmpiy1lmeelnvtat)a2uaxmoot4tlenmoeiysfmDua( pnu) lerxf iatfat  nvol( srxm(o3oy1lmtelnesl()srrrur ;o4olxn i3ias a uaump (0teenircty1laDr ivslt0teum(opny4amenlfvias) 2ta(rpot4aetomoeiyt m eaumpnu4 rtrmf3oytfaDrauvol(  exr(rpoy4oltelneilt  Duaxmpoo0tptoioetytfmDuluvp;t4 etnioctodlat lnvo;()teumir3no4op   neia()aDur(mpno4oet iieilsfmDem( ont0artrxf iodoatr iesl(0s2xoxo3io4lm n ietas) rrau o;t1tlxo f3iytfa2eaumonu4 ltoif3oodfmDrau o;t)srxrir oydlmen ics t)sDuau poo4olto feild a2rmnmp u)altrmociy1oa eli ils0 rto(m3ny4llenmnci ( sDurxm ot4tpxoioeilslaDumnmo t) rxnircoo1omDr neolt trtoio oydaptnlicsltf rraum nu1texoio3ils sDean o (4arenmf ia1lpDr u i t teurxopiu4ol n fetas)s2rmum oo0olenifciys a eau p u0arxnxr to1oatraies;() rxr(opnu4lmenlfcsl( aDrm(  ;o1oex iieiyt sDemn on() etoir oy1omDeanvols)teur(o nudam   fes t  Dur( p;o4tpt  feiadfmDeau p u)trenxrciatla eluvil(0 ruoxmpiudom e ncilt) 2urumoou0opt  fciys m rau p;(0teerircia1lmtraneo ()t2xoxrpoo1ll  mfvsas)arta(mo;u0olen icilt a ranvsnu)areomfcoatfm  lnvo;s)srtrxr oy1altn nci tfsrraump;u0tptniietatfs eauvpnt0trenioctotfa   n s s0srto(o iu4lmt lnei (  2raxrpou0olx  ieildfs2ea(mont4tltoxo3iydoptr n i s) rtr(m3oo4ll nmfctlsfa2uaum ou0tet  f3tlt s2ea(ms u0 reoircty1latelu o (0 2xoio ou1om nmfet sf 2taxmpnu1apxnif3tltfs emums;t) exrxfcootlpDeaieolt)tetoir3ny1lpen fes sf 2tmx oot1alxo oeias mDrmnms ()aexnxr oo1fp ean ilt)trxo(rpoy1amte nei (fs2urxr nu4tex mictldfs2um(vsnt)artnxf oydom r n i;t0t2tmim io1ape  ietat)sDua( pou0alenmieildfsDemu p u0arxrmr3tadom  ln il(0trxmxopno1alen ict t)aruau p;u0opeomietlt s2rl(vo t4 ltoifcoy1lp elu s s)s2xmirpoo4amenlnvil(fsrumxrono0tpt iieils s ea(mp (0 ltriocta1fm  aueols sruo(o3ny4omtn ictlt) 2tru oot1aeen octlsfm umnvs () exnxo io1opD anvol()t2xoir3nu1lm nlnvsl()aruauront1olxo ieiltfm eauvonu0tlxrir3iy1fm  lies;s0s2urxo3iy4amt livtat a2ua(ro;t4tpeniieiytfm2uln s (4arxoircto1lpteauvols)s2xo(rpiy1ol nmncilt  rrrur ;t0alenifctatfaDraump () rtnmo3iodlm  lneo s srxm(rpno1openliei tfsDrmurp;u4aeeomo3ils a rmn s t0treomf oytlptr n ils s2xoxmpio4am n iei sfsDtr(roou0alxoiietlt m umnvs;u) ltrio tadoa eaueo s trxoim ny1oltnlieilt)s2trxr no1ole  i3tytlmDrl( ont0altomo3to1lmtrlueil(0setr(mpnudom nlietas  Dum(rpnu4tet iicils a ua(msnt4tleomocta1la eanvo;t texr(opiu1lmeemictltf Dumumont0tpxo feiydla2eaumonu0artnmfcoy1fate uvo s  exoxm nydlmeemieia(  Drrxrp;u1aetnmo3tadfa eln p;(0aexrxfcoa1fat ai s;( s2um(r io1lm elnvt ()aDrmu  ou4tleoio3tldlm ul( o ()alenifcio1fptraies;(0teuoxm3iodop e fvia( a2trur ou4tex miciad sDrlnvo t0trerxociy1lpDrlnvolt t2xrio iodlpenlieslt  2ur(ront0tex mociytlaDum( sn(4aetomf3oo1lmteanes (0 2xr(m3oydolen fcilt)aDrr( onu1tlxn feiat m2rm(vsn(0 lxrxf3ta1omDe u slt srxrxrpiudlmtn nvsa(fsrrm( ont0tpx  i3iasls2rau o;(4 eeoxr ootfpte ieo;(0srurim3io4opeemivtlt a2rmxm ;o1alxnmo3ilt m rluvpnu0alxomr iodfa  aues;( srxm(opoudlpenlivia(fsDrmxmo;u1opxoiietlt s2rmuvsn(4 rtomocoo1fp rai ilt  exmxr nu1omenlivi ()srraumonu0oex mociyt m2ulu o;u4 eerxrcoadfm  ai ilt t2xr(o3iodlp emietlt)aDumx  ;t0tlxnii3iysfa ua(vo;(0trxoxf iotlat aivol(0 eto(rpnydam  mfci tfsDurxr ou4tlen ocild a2rm(vp (4 exnxf iydoatr nvi;t) eurxmpoydol nmfesatfsrum(ro;t1apxn fciad m2uauvs;(4aexrxo tytlaDrlivil(0 eurxrpoudameelnci tf Dtmur oo4apxomoeilt s ua( o u0tetnmf3iytfateluvs;s0 eum(r3iodame  fctat) rrrxmo;o1aet  oetldfa2em(vs () eenxr totfpDeli i;t0 etmio3nudopt mfetl(  rur(mp;o4oex miciyd a2elnmo t0arxnmf3iydlmtran o;s  rxrxrpoy4olen icta(fs2uax pno4opxniieiyd a ua(vs;t4teeoif totlatr n o;(0 eumio3oo1ome miesat)sDtr(rpno1aeeomoctlsls2ul(vpnt0tlenxf oytfa  lu i;( s2xmxm oudll e fvtls) rtr(ro;o0alt mieildls emu snu4 reomr3todlaD  uvs t0 euo(opoudlleemfcilt) rrmx  nu1tetnmiciytls2raumo () lxrmf3tytlateln o;(0 rxmxo3iu4alt lnct (farrru  ot1opxomi3ildls emump t) eenxo io1lpte u o s)trtmirpou1lm elieta( aDur(ro;o1oeenif3iaslsDrmn o t0 exrio to1laDrlneo;s  etrio iudlmeelfei t)arrru o;u0tpxnioetadlmDumu ont4trtomocoatlpt  ivsls)t2uoxr3iu1ale  fcils) 2tm( pot4texo iciydfm2elumonu0areoxo iotfaD luvsls tetmxo oo4lp n nvslt srrm(r nt0alxnif3tytlsDemumont4altnif3oy1oa elnvol(0 2uoim iu1apt  ncslt)a2rmxrono1opxn octldlm ea( o;t) ltoio3iytlptrliei t) eto(mpou1opt  neta()a2rrxm nu1tptn o3ild aDem(vp;() eerxo3iodoa elnei s0 eumiopiy1ale mfvtl(  rrrurpnu1oeeoifcild sDeln p t)tlxoxf oatlp ran s s0sexrio3nudamt  nvt t)aDuau pnu0tetnmieilsfs2rau onu) ltnmr ootlaDr ieolt s2xmxopnu4ll nmncta() rrau  nu0alt mociytfaDum(mo;u0artoxf iadfpt  u i (0 exrxmpiy4op nmncs ( aDuau  nu0tpeo fcilsfs ra(vp;t0trxrxr oatfatr ueo t  rtoimpiy1ap   nct ()srta(m ;t1openii3ilsfaDuauvp;(0trtomr3oytfat lues;s) etoir3nydllt lncslsfaDtr( o;t4olt mf3tysfa2uanvsnu)arxnircoy1fm rauvs;( srumxr3oydamenmnvsa(f 2trxmo;u4opxoiiciad a2ulnvo (0alxrxf3iotoptelu i s0s2urio oydlmenmnvt sf Dtru oou0open octytlmDrau s () etrxo3oy1opDraueo;t) 2tm(o3nodape lnetl(f Dtrx  ;t0oexn f3iat mDeanvonu0texomo3oadomt  i o (0seuo(r3iy1al  lfesasfa2rrx ooo4oet ifetld mDemu p;() rxrir3iadfaDe uvsl(0 2tmxmpiydlme mfci ()aDrrurpno0opeo fetldfa ul(mp (4 reomo3oa1oa   ieo;()srtm(m3no1amt  nci (fa2taumo;u4opeo oeiydlm2uan o (0artrxfcoatoptran ol() 2xrxr nodol e ivs () 2rrxront0tleniociatlsDrmuvp;u0tlenio3oydfp e uvi;t texoim3iodome  fvsa(  Dtaxmp;u4openii3iat s rmu p (4 rtoir3tatomDe ivi s)setoim3iy1ole  fvs ()aDur(r nt1altoifetas a ul(mo;()tleoxoctadom  an i;(  etrirpou4olen ies s)sDur(m ;u1optniictadfs rm(von(0artrircoytlptelivs;()srtrio oy1al nmfctat a2trur ;u0open ieiatlsDrmnvo u)altnio iatlpDeanvils0texm(m3no1amte ici (  2um( p;t4alx mfcild aDrlnvs;()altrif3tadlpt anes;s t2umimpny4lme lfeils)a2uax  ;t4apeo ietlt s2rl(mpn(4tltnio ootlatrlnvilt  2umim oo1ale mfeta(  Duau p;t0olt iieiad m em( ont0arxoio oy1lpteau s;( s2toxrpoodllee iet t s2rm(  ;o0tleo i3iltfmDulu p u0aetrmo3iatopDean i;s)trtrirpnydol  mivs t)a2urx poo0tle ifetat m2ra(vsnu4artrif iy1lpt lnvo;s)setrir3ou1lltnmnci s)arrmurpoo1tex ifctldla2rauvs (4 rxomr iytoat  uvi (0 2xoxo no4altn ietlt)srtrx pou0tpe  ietldfs2ran sn(0tlxrif totomteluvi t) exm(mpoy1omee neias s2trx  nu1opxo iciydfa2rmumpnu) lermfcty1omte ieolt)t2xmiopoy1lm n ivils) Duaur ot1opxnmoctytfa2uauvo (0aetrxociadlpDr ueils0s2xoirpiydal nliesa(farurx p;t4opxnmieiyslm2el(mpn(4 leoir3ty1faDelivol()texm(mpiu4op nmfcsa()a2rrxmpno4ope ifeilsfs umu o;t4aetnmociotlaDr i o s0t2tr(opoy1lmtemietatfarta( pou0ole  ictltfs eauvp u0 ltrircoatlat  n s;t  rxrxopio1ap nmnes sfartmxmoot1olx iicildls2emnvo (0 leomrctydlat auvs;(0 2to(m3no1ameelnvi ( a2ur(  nu1oeen f3iltlm2umuvp (4tetrmo3iodlate uvolt srxo(o3iy4opeelivtls)arra(rpnu4texo iciatfsDumu o;(4alxrxr totfa eli ils0s2uoim ny1am  mnviasfaDumxrpou4aet moeiysls2rl( p (4trxnir oa1faDeauvo;t)trtmim nydlmtnlnvtl()aDraxrp;u4oetoiieiysfm ea(mo;(0 rtrmrctadlp eau i t0 rtoxrpou4llenmivia(f 2rmur ot1olxn oetltfa2eaums u0 leoio oy1fpDrauvslt)sexmiopny1olt  icsa( arum(  ;u1olxniociys mDua( p (4 exrirciatlpDelnvils srtmxm oodopeemnvsa( srurxrono0ole ifctlt sDrm(ms (0aexoxrcto1faD  ueo s0srxm(o3oodlpenmnei sf Dtmur ;t4tlxn o3ilsls2ua(vs;(4tleoxfctydlat  ivi;t0srtrio3iudol e fvslt)aDra(mpnt0ope  f3iadfmDra(vs t4 etrif3iydfp elueo;s0 2urimpiu4ome lnesls  rtru  ;o4texnmf3ilt s2ulums;t0tlxnxfctadfpDeaieo;t  rtrxmpiu1oleelicsas srtmxmpno0ape ii3tlt aDeluvs;t0trxnir3ootlptr n ilt)texrio iodameelncsl( s2rmx p;o1olxnif3tas s elumo;(4teenmf iodlpt  ivi ()s2xrxmpiydlmtemici ()sDrmu  nu0tleoif3tytls2umuvs;() etnmr iodfmtr u ols setrxr3nudop e ictat)aDra(r oo1tpenmoeiyt a2ranvsn(0 lenif3oo1latr i ilt) rtoxo3nu4omt  feilt) rra(moot4apx  ictytla eluvo u0tetoirciatlpteluvo;t  2xr(r3ou1altn nvt t)aDumx ont1aptnif3iltlm2rl( s;t0alerircty1fa  aieslt t2toiopnu4optnlnei tfaDtau p;u1olxnifctldfmDrlnvs u)tltrxr3iytoaDe nei t0seuoxo ny1altemfvtls arrmu pnu0texoifctlt sDeaumo u0alxomr3io1oaD anvil( setm(m nu4amt lict sfaDtrxronu4tpxnmfciat aDrm( o;u0artrmr3oydfp   ivo t0trurirpoo1lp   icsat s2uaumoou4ole  oetasfs2umnms () rtoir3oydfpDe u il()t2trir3ny1omtnlfesas)sDrauro;u4tpx  iciatlmDrmnvpnt) exnir3iydoa   nvo (0s2tmio oodap nlfeiasf 2ur( pnt4oexo ieiad mDuan p ()aeeoxo3todlaDeln s;t sexo(mpio1lle  ictlsfsrtmx poo1ale  ietatfsDum(vp t)tltoio3oodoa  livi t) 2xmiopiydope lfetat  rur(rpno0aet  f3ild m2rl(vo;t4 lxrmfciytopDeanvo;t)texmxr3iodopeelfcsls)a2umx  ot4oltniociytfaDulnmo u)aetnxo3ootoatr u s t s2xmio iodolen icsa(  2rmuro;o0alxoif3iytfa2rluvs;u) exrxo3iydfptelnei s)trtrxmpnydlptnmnctas sruau ono0oeto ociad m umuvo;t4 exomf oydfpDe nes (0t2uo(r3iudale mfvs t aruaurpnu0alxnioeiltlmDemn pnt4alxrmr oodlm e i s t trtmxrpiodom elietat) rrmumpno1olxoiociyt aDumu o (0tlenmo iotopt ai i;t)t2um(rpiodoleemietl(f rra( p;t1oex ifcildfa ulnvs;u4aeerifctydlmDranei (  etr(m3oo4omt mfvsls)arrmxmo;u4alxo feiltlmDeanvsn(4aexrif3tydomt  ivo;(0 etrxr oudal emnvils)s2tmxrono1apto fetlslmDul( ont4arermoctatfpt  i ols0sexm(r oo4lptelietas)aDrm(moou4oexo fctad mDel(vs;(0tltomr3iy1laDr ivo s tetm(r3ou1ope lfcs (  rtaurpot4open ieild a raums;t0trermrciadfm eauvil( sruoxr3iodopte ict ()a2ra(mo;u4apen f3tldlsDem(monu)aexrif3oatfa elnvi;( t2uoim oo4lpee ncsat  Dtmx oou0oexomi3iysls2ra(mp;u4altrxf oatfatrau sls)setm(opio1olt lnc
\ No newline at end of file
@@ -0,0 +1 @@
+i o t0 rurirpiy1ol  mfctl()aDtaxmp;o0apenio3iys m elu o;t0alxnxo3iotlmD ln il(0 rtoir3oy1ap emict s srraur ;u4teeoifciytlm2emumonu4tleoxo ia1fpDrauvi s0teumimpoodlm elnvs sfartrxm ;o1tle  fciydlaDem(von(4 etnio ty1fp  aueslt t2xo(opno1amtemietltfsDraxrp;u4aptomociyslaDuau pnu)artoif3oa1la rai s ( tetrxm3iodop nlics s)artrurpoo1aexomo3iyt sDel( snt4artrxrcto1fa e u s s  rtoir oudame mnvsasfs2ta(r oo0oexomf3tadfa uluvo t4tlxnxf ootlaD an i t)srxmxrpiy1lpee ietl(  rurumont4tlto feilt mDumnmp t4arerirciadoa eai s s) ruo(o iu1om   ics s aDtaurpot1apeo ictyd mDrluvs;u0trxoxf3oadoa  an s;t t2xo(r3oy4ap  licsl()a2tmu pou4opxoiietldfs2rmnvs;u4trxrxr ia1lpt ln ilt0t2xm(m nydap  liciatfsrtaxm ou0apxnmo3iys mDrlnvp;u4tetnif iadfa raiei;s0trxmxrpiodape lfvtl( a2rau p;t4tpxoioeiat a2ulnvsn(0tetrxo oa1faDeai olt0srxm(m oy1ol  mfcsls) Drr( ooo4aexn ieiadfmDran s;()altrmfciadfm r nes;t s2xoxr3ny4lmt lietat)sDurumpnt4tetoif3iyt mDum(vpnu0 etnxocootfmt auei;s s2to(m3io1altelivsat) 2umurpot0apxnmfctad s2rlu o;() renir3iydla  anvils0 rtmxo3ny1omeemfcil( sDta(m oo0aex mietld m2rlnvs;(0tlxnxo oodomt  ueo;t)s2urxo3no4aptemnvsa(fa2trx pnu4aee io3iysls2eanmo;t4trerxo oadlat anvs;() rtmiopny4om  lieia()arrm(r ;u4tex  oeiadfsDranvpnt0tlerxr oa1fpt aues s)sexrir3io1lltnlneslsfs2tr(r nu1altoiiciytlm2rlnvsn()tlxrmf3iytoa   nvslt srtrxm3iydap  lncsl() rtmx pou1alxnmociltlm rmn snt0 leomocia1lm  lu o ()t2uo(o3no4optn fvt s)arrax ooo0oexomoetls a2eln pnt4altnxo3oydfaD  ueo;s) 2urirpoo1lme lfvsl()aDurxm nu4optn fctysfa ul(vs;() ltoir3tytom   n ols seto(m iu4ape  icslsfs2urxm oo0aexnmiciydls2el(ms;u)tltrir iotfmDrlivo;s  eurimpnu1lmtn ies s a2ua(mpot4tlxoiocild aDemums u0trxoif3oodfm rluvol(0srtmimpou4openlfvsatf 2ua(rpou4tpxo iciysfsDrln onu)trtrxr oodfm eln s ( seumxrpny1alt  net ()a2trur nt1tlx ioctyd mDrm( o;u4trxnxo oa1lp elnei;s)teto(o3oy4lpee iet sf Draxm ;o4optnmf3tls a rm(vp t) rerxo3iydlpD ai i t0 eur(opiy1op emiesas)s2ra(mp;u1aee mo3iadlm2ul(vsn(0 rxnmf3iydop  lu i s trxoxopoudop e nctl(faruaxrp;u4apx mfetasfaDeluvpnt)tlxomf iydoaDe nei;(0 2xo(r io1lle mfvtlt  Drm(r nu4aet  ocilsfs umnvpnt0aeerircto1lm elu il(0 2urxopoo4optemnct (f Dra(roou1tpt ii3iysfaDra( o (4 rxrmf3ootfp  luvils0srtoir3oo4lm elfctas aDtau onu4tpe  fciytfm2uan p;t0 lermf totlpt  nvols  etrim3oodap nmnvt (faDtmx p;o0tptniieiydlmDranmpn(4tlxnircta1faDraieo s) eurxmpnodape mnvsat)srur(mpnt1opxo o3iadfs rau o u) lxoxr3to1oat anei;()trto(r ou1om nmfet ()arur(rpno0aet mo3iadfsDrluvp u0trtomf3oy1opte n s;s0t2xmir oudll nmiesat)srumxrpoo0oexomf3iasla uan s u4 eeoxf ta1fmD  ivs (0s2xm(r3oy4lp nlnvt s) Drm(mp;t4tle  fetltla ua(vp t0altrmfcoadlp rlueol()t2xrim3iy4alenlnes t  2umxrpou0apenii3ildlaDeanvp t)trerircio1omD anes t)srtoir3no1ll nlnesls srra(moou0apeo iciad aDumn p;(4tlxoio3iytfa elneo s0 2tm(opno1lp n ncsasf Dtaxr ou0oee io3ias mDrmu o;()altnmrcta1omt li ils) 2urxr3ny4olte fctlsfs2urxmp;o4tpt  oeiltls2ran pnt)artoif3ootfm e uesls  2tr(o3oo1lm nlncs t)sDuaxr nt1apt moetadfsDuanms t0 rtrir oatfaDelueo;(  rtrxr oo1amtnmivia()srtmu  ;o0optn o3iasls2elnmp;t4trenmrcoa1opD  i s s s2xrim3iydol elfvsa()sDtru o;o0tlx ifeias aDuluvsn(0teenif3oadoat au ilt0s2ur(opou4ap   ncslt arraumo;u1olt io3iat aDul( s;u0trenif3iatlmt  ivs s s2xoxopnu1altn neiasf Drmurooo0oexnif3tat s2um(vp;(0 etoxr3ta1fpDe nvi t  2xrirpiu1lpeemfcsat s2trumo;o1alxo feildfa umu s;t)tetniociy1faD lneils  2um(m nu4llte fetlt)srur(mooo4tpen ociysls2umuvo u0artnio iytomD  uvsls)tetr(o3oydapenmieslt)s2trumpot0opeo fetat s2eln o (0aexomocoa1fm  lnvs;(0s2tmxr3iydlle  ici t)sDta(roou0tltnmoctas m ra( s t)alerxf3oy1op eau ol()t2tm(rpoydoptemfvt t artrxm no0opx mfctas a um(mpnt)texrio ty1fpDe neo t  2uoio oodlpte ies ()aruau  oo1tpt  ieias a em(vo;t)tltomr3ia1omtelu i;t  2umxopno4om n fviat sDrmurpot1oet  fctlsfaDum(vs;u)aetnmo ta1la  auvi (  exoxm oydlltemfcils)sruaur ot4opxnmfciatlaDea(vp u4 rtoir iadopte nvils setmxo3iydol   nesl() Drax p;t1alxo o3iysfm2em(vs (0tlxomo iytopD  u s ( t2to(r3ny1optnmictlt  rrau p;o4oetniiciydlmDumu p;u0tleoxocoytlaDe nvo s)teumxr3ny4lp nlfcia( srrm(ronu0olen fctldfm2em( s;t4tlenmf ty1lmDe iei;( setmiopoo4alt mnciasfaDuaumpoo1aexnmi3iatls eluvont)arxoxf ia1lat auvo;t0 ruo(m oy4lmt mici ( aDtmumpnu0tlt  octlt m2um( snt) eermr3iytfmt lueils0t2xmxo3iy4al   ncs sf rtaxmpno0aptn i3iasfs ea(mp (0 rxoxocta1fmt ai i;s s2to(rpoy4lltnmivsl( aDtm(rpoo0tlxoiiciaslsDeau onu)aetnxf3oa1oatranes ( s2trio3oydame lnvs s) rraurooo4ape ii3tyslm2emnmp u) rermr3oodlptrau il()s2xm(opiu4oltnlicilt) Dtmump;o1apxn iciytfsDeau s;t)arxnif iodom e ies;t)s2tmiopnudam  mncs ()s2uaxm nt4tet io3iatfsDuluvo t) rtrmr3oa1fm eli o s  2ur(r oydomt mfct ( sruaxmoou0apx if3iatls2ul(msnu4trxoio3ia1omtraivil( srtrxm oo1lm e nvsl( aDum(ro;o1tpxoiiciltfs el(mpnu4 ltnio iydlm  anes (0s2trxopoy1apeemfvi t  2rm(rono4aet mf3tyt mDelu ont4aetnir todomDrauvsl(0teurir3ny4llee fet ( srrr(rpnt4alenmi3iydlm2ulnms;t4teeoxrcoodop eln o;t0trxmio iy4lltnlieilt aDta(mpou1optn f3ild sDeln pnu4 etrxf3oodoat anvo;s s2trxr3io4opeelieilt sDrrurp;o1apxnmicilt mDrln s (0alerir3oydomD an slt0sexoxr3oy4ll  lieil( a2rmu ont4tetnifeiat a ean pn(4alxrxr3to1fatrai s;s)s2xoiopio1am e icsl(f rur(r ;t0oexo feilsls ran pnu0 exoifctytfa rliei;t0sruoxr no1omt mnciat  2tmxmp;o0opeo f3iad s2rau p u4 eeoif3tadop rlivs;t trxrim nu4lp e fcs tfsDtrur oo4alx moeiyt a2rluvs t4aexomo totfp raiesls)seuo(m3oudam n ivia(  Dtmxr ot0opx  o3iysla2emumo t)texnmrciy1omtrln o;( t2tr(m oydaptn ivtlsf Dtr( p;o0aetnmictltlm2rlums t)trtnio3ia1laD  uvo t)t2toxr3nu1opte ncsasfs2trurpnu4opx  fctadfs rl(mo;(0 lxrxf3iotfm eauei;()teumim iy4lpe  net s)sDuaxrpot1apt mictad a2elnmp (0trxrmo oadfmDeai s;s)trtoxr3nodlmte fei ()srtaxrpou1apxo feiysfa2elu pnu)alenir ta1oat ln i () eumim nu1lp  mnetl(fa2uax oot0tlt mo3iad s2ulnmp;u0 rxnmo tatlpteanes t)trumxo3nu4oleemiesls) Dtmx ono0aeenmociysla ul(vp u) rxrmocoadop e nes;t0seur(rpoydaltemfeia(fa2raxmoot0tpt mfeiadfsDul(msnu0 rxrio oodlmD  uvo;t0 rxrxm no1lme  nvia(fa2tr(rono0tltomf3ias m umumsn() renif totfa rlivsl() 2tr(mpiy4al elncta()artrumpoo1alx iiciyt m rlump () eeoif3tytlp e n s;s s2xoxm nydaltn ivsls srrrxroou1aptomfciaslsDelnmsn(4 rtnmo3iytfat li ols0setr(o3ny1aptn nct s aDumx p;u1tetoifciat s em(monu0alxrmfcto1lmD  n i;s s2xrimpio4ap nmfviasfaDururoou4aetn f3tltls emnvont) rtnirciadfp   n olt)setoxm oodap nlfcsltfsrrrurpot1olxn feiyt mDeluvp t)tltnmfctodlmt  n il()trurim3nodope lics t)s2ururpnu4apxnmociadfm2umu p;t)texrmrciy1oaDelivi s s2trirpoy4ll e fvi tf rtmxm ou4tet  iciaslm eaums (4altoiocty1opDe u s;s0t2urim nu1omtnlici t a2tr( poo4oet iocildfaDuluvp (0texoxfcio1fm r ieo t) rtmiopio1lltnlivta(  rtaumpnt0tptnioctydla em(ms (0 leoirciodomte ues;(  ruoxo oo1ome lnvi s) Dtmxr ot1aexoio3tadfa umn pn(4treniocootlmte n olt t2to(m3oo1lp emfesa(faDrrx  ou1aleo ociasfa rluvs t4alxrmr tytfaDe uvols) exrxo3oudoptn nvsas a2um(mp;t1tltn oetaslsDua( s;() ltnmr tadfpt  nvs;s0 euo(m3oy1oleemfei ( s2ta( ont1apeoiiciyslm raumont0 etnmr oodop eau sl(  2xr(m no4omtemneta(  2rr(m oo1opeoio3ilsfmDua(ms;()trenmrciadfat  ueo;s)srum(mpoy4lp n nvi s s2rrxro;u1aexoifeiydlmDea( pnu0tlenirciytfm  luvo t)truoxm3nudlmtn nesa( a2trxmpou1teeomiciysfaDuanmp;t4teenio3ootfpDr n i;s) rtmxo3oy1llte nvs (farurumono1tpenioetldfaDea( s;(0tlxnmr tadfaD luvo;t0 rumir iu1ole mnvslt aDumx  no1aeeoif3tydfaDranvo;(4artoxf oadom eaues;t seto(mpoo4om e iciltf Dtaxrpot0optomi3iltlm uluvsnt)tlxoio iatlpDelnes s0 2xrxo3io1aptemncilt)sDrmump;o1teenmoctltlaDul(von() rxoxo3iydfpt auvo;s0 2toimpiy4altemfet s)a2raxm ;o4tleomf3ias sDeauvo u)tetrxr ootlmtrlivo t0trtoir3no4ope mncs sfa2ta(ro;o4aex ifetlt s2uln on()trtnmrciydfmDe ivils)trtmir ou4ll e fvtas sDrmum nt0tpt if3tyt s2em(vo;u0texrmr oy1fpD ln o t s2tr(o3iy4lm emneia(fa2rmx  no4aptnifetytls rm(vo;u4 reoio to1fm   i olt s2umimpoy4lptn fct sfarra(m oo4alxoioeias s2rl(vs;u0trenmfciydomD lu o;()srxoio no4omeemnvt t) rum(ro;u1tpeo o3ildfs ulumo;t4aeerxf oadlat aivsl(0s2xoim3iu4ome lnvi s sDurum nt1tle  ieiydlsDumnvo u)tetnmf oo1fmDe nvil()sexo(o no1al emfvtlt)aDrrx ono0tpt  i3iys a uanmsn()aeerif iotlat auvs;s0 2uoim3io4ol  mnvsa(fsrrrxr ou0tpe iocildlmDuanvp u0aetnmo3oydlaDean ol() eumio3ny1aptnmiesas)s2rrxr oo4apx  i3tld s em(vsnu4teenirctadfptrli o ()texr(r nu4ameemieia( sDum(rp;o1opxomfcild a rlu s;u0 lxrmo iotfmt livsl()sruoxo3nu1lltnmnesltf 2umumpnu4tlxomo3tatfsDemu p;() rxrxrciy1la rln s;t texrxmpiu4lpe lnvtl( s2tau poo1ape ii3iat a eln p;t0alxnmoctadlmDr uvs (0 2xo(mpio4amtn ict (fsrrrxronu4optomo3ilsfm ulnms;t)aleomf iy1fmDe uei s)t2xm(rpoydamtemncils  rtmx  nu1oltnioetld sDel(mo;t4alxrmr3ootfm elnes t) 2toxopnu1lpenmici () 2rmumpoo1tee  ociyt aDumuvp u0 rxrir totopDrauei;(0s2tmxm3no1am elict tfarraurpnu1tpt  o3iatlmDemuvo;u)aetrmo3tatlpDrluvsls0trurxopoodapenmneslt s2rauront4ape  o3ildfaDel(mp;u0teenmoctadlmDrauesl( t2xoiopiu4op n ncta( srrr( oou4ole iociadlsDeanmo t4texnmf3iytom eln ols teuoim iudolenlnviat  2tmuro;t0oetn iciltfm2emnms t)aetrmo oo1oate n s;s0s2ur(o iodop nlivi t)srua(ro;o4alt mo3ias sDua( o;u4aeeoxfcoatlm e ieo;(  euo(o oudlm emieiat aDtr( poo1alt iociys s emuvpnt)alxrmociatlpDelies;s0 euoxr iu4opt lnesa(faDrmumo;u0ope  i3iad sDra(mp;u) rerxocootfpDeauesl() 2trim nudamte icsa()s2tm(r nt1teeomoeiltlaDrmums;t4 eeoxrcio1lmt  nvs;t)srxoim oy1omtemnetls) Draur ;u0aexomiciatlaDrmums t0tetomf oo1lmteanvi s setm(m3nodlp nlnesl( sDtau p;o0opxnmo3ilslmDua(msnt0 eeoif iadfpDr ueols)teum(o io1lmeelfetatf rum(m nt0tpe  oeiadla2elnmon(0texomfctatoa   ueo (0srxmxm oo4ll n ncil(fa2raxront0aexomicildlm2emu o;t)aexrmo iatoaD aivo t0 2tmio3ny1ale lnei tf Duax pno1aet miciatla eluvsn(0 rtnif ootoaDe nvols) rumxr3iodamee fvta( sDrr(m ou4tptn feiltlmDea(vonu)trtrxfctadopDeli o;()s2trim3no1amt  ivt s)arurx  ot4tlxomoeiatfm2rl(vp t4tlxrmr iy1la elnes;t0t2tr(opoudlm emiei s)sDuaxmpoo4tlt  ieiadfaDeau p;t0aexoxociatfpDrlu o;t s2uoir ou4op e fci tf Dtm(r nu4opt  f3ilslaDuanvpn()tetnmo tydlmte ivo ( s2tmirpou1ol nmncslsfs2ua(rp;t4apx ifetls m ulums (4 renioctatfpDrai o t) rumirpio4am   ncs tfsDrmu p;t4tleoiictltfsDum( o;u0 ltoio iydom rli i s  rur(o3oo4altnmivils)a2ra(r ot0aet  ietytls el( o;() rtnxfciotlmDraieo;s t2toir3oy4am nliesa(  Dtr(m no0olxniieiys sDemumpnt0tetrmr tydlaDeluvi;t)trtr(r3nu4amee fetl()s2rr(r ;o0oltnio3iyslm2ra(mon() lxrir ty1lm  li o;s)s2uoir nu1altemieiatfarurx o;u0olx mf3iytla umnvs u)artrio3tydfaD lues () exmim3iudame  fvs tf Dur(rp;u4aleoiictadfaDum(mp;u) ltoxr iodlmt lu s;s)setm(mpiy4ap elncs s aDtm( pnu1aee mociytfs2eaumsn(0altoxr3tytlpD an i ()srxoim3ou1olt lnciatf Dum(rpnu4aet  ictltfm2rluvo;() exnxrcoy1lmtrlueo;( sexmxrpoy4aptemietls aDrrxro;t0ole mi3tydla2ra(vp ()altrio3oy1lmtr nes () 2xm(opno1lm  mietas artmu pnt1olx moeiltla ulumpnu0 etnxf3tatfa  li s ()t2umxo3oy4am n iesa( artr(mp;u1tltnmfciadfsDumuvsnt0 eerxf oydfaD luei s0 2xo(mpiodolenlnesl(  2rrxmpot4oltoioeiasfaDumnvs u4tltoio3io1fatran s s0 etrxm no4omenlnct s s2umxr no1oeeniieiytla uauvonu0tetomocoatoa r ivs t)s2trxm iodlmt micta(  2umx o;t0oltniociadfm emuvp;t4 etrxfctadlaDr i o;s0s2urxopny1lpe lnvtl() 2ra(r nt4ope iicils a rln p;()aetrif3tytopt  ues;t)s2xoxm iydllenmnvia(f 2uaurono0tleoiieild a2rl( p;()texrmr3oatfa r uei;(0srtrim3iy1opt  fei t)aDrmxrpnu4aptnif3tad m uauvo u0 rtnmrcio1laDean s s trur(opnu4llt miesltfaDtmurp;t4oleomociatfm rmnvpnt4trxomf3todlmte neils srur(m3iy1lltn ict t a2taxr nu0olxoioctldfa2ulu onu)altnir ty1lmDr uei;s) exmxm3iudlmte nvi ( aDtauronu0ope  oeiysfm2eaumsn(0treoxfctotfpD ai s;s) rtriopoy1ll emfctltf 2ua(ro;o4alxn ictlslsDum(mp;(0 exnmo oodfpD li s;( s2urxmpiodamenlfvil( aDtmum no1apenmieils aDrlump u0artniociadoaDran ils s2xr(o3oy1olen net sf 2tax p;u4tptnif3tlt mDua(mpnu)tetrmrctotlm  au sl(  exoiopoo4optelivta(  Dtrxro;u1oltoiictls mDul(mp;t0 rerxf3ootfptr ivi (0 rxo(rpnu4lm  mfesat)aDraxmpoo4tleo oetytlmDumnmo;t0 rxrio iadoaDranvols)setr(o3oydap elfcsltfa2uaum ;o0tpeomieilsfm eaums;(0trenmfciotla rlnvs;( srtmxrpoydalte fvsa()artmxmpnu1opeo o3tytfs2ean p;t0 etnifciotopt anvo t trtoxm3io1ol n fvi t  2tau pnu4oetomo3tls sDulums u) etrio3iatfp eln s;()trxoim3oydlptn neta() 2trxmonu0oex ifeiltlm emumsnt)aetnmf3iotlpDr ieo () 2xo(o3no1amee ncta()aDtm( o;t4aetnmieias a2rmu o t0texnif3ta1fateanes s0sexoxo oo4ap emietas  2rm(mpno1olt mfetlsla2ua(vo;t)tlenmfcio1fm r nes s)trumxo no4oltemnes s s2uau ont4tle  octyslmDrm(mp () lxomo3iatla r ies;s0 etrim nu4ape  ncslt)aDra(ro;t0apxo oeiat s2emuvont0trtrif tytlpDrluvo s) etoxopoudlmeemneiltfs2umxrp;t1opt  feiytlm eanvo;()trtrifcta1fpDe i o;s) rxmxmpnu4lmtelietat  rta(mo;o4oex mociyslmDra(vp;(4artrio tytopDeanvsl(0 rurio3oo4altnmfet tf Dua(  ;t0aetn o3tytfs2uln sn(0trerxo3oytfmD lu s ()trxoim nu1lpeemnetat sDtmum ;o4oex mi3tls s um( onu)treomo iadlpDelueo;t0sexrxr3iy4lmee fet (  rurxronu1apx if3iat a uauvsnt4 lxoifctotoaDe nvi;s trxoxo ny1lpeeliei (fa2rrx p;t4tlx miciasfa rm( s;()alerxr to1fatr ieslt sexr(opoy1lm  lfvilsf ruau pnu0tpxn fetad mDeln pnu) etrxoctytlaD  uesls t2urirpny4lmenlicsltf 2tru pnu0tlx mociasfm ua( o u4 exrmo3oodlmDe ueo ()sexo(m no1amenmnetl(  rtmxrpnu4tltniietydfm2um(vo;(4trermr3tadlaDrai o;s srur(opio1ap n fvi sfa2umum ;t4apxnmfciysfsDuln p u4trtrmr ootfmDeai ilt0 eur(r iy1ame liviat  Drm(r nu4alx  oeiltla2ua( onu0 eeoxo3oa1fm rln i;s seurxr nudop n fvilt)sDtm(r ot0opeoii3iydls2um( s;()altnir ta1lmD  ies (0sexrxrpnodamee iet ()s2urxr oo4aeeo icildlaDuan on() rerxoctytlmD  ues;s0srxmio ou1lme liesa(  Dtrxmpoo1apxn oetld a2emnvonu4tetnmr3oatopD  n il( teur(m nu1olenlieiltf ruaum ;u4aptnmf3tys m2rluvs (4aeerir3tadfm r i i t0 rxr(r oo1lp elfvs s  2rmu pot0tptomieiatfaDumumpnu4trxrif3ty1opDe ivo t) euoim iu1omeelfvsl(f rrmx p;o0oleoioeiatlsDrlu s u0 lerir oa1fmDr uvs s) 2trir nodam e fcilt)sDurum ;u4tpxo f3iatfmDeau s;u4 lxnircio1omtraivs;t0s2tmir3oo4amenmnci t  Durxrp;t1tlx ifetlt s em(vsnu)arerxf3tatfa elivolt0trxrio3iy4am nlfct s)s2trum ou0texnmfcildfs2uanvon(0 rxrmr3iy1fpt luvslt)setoxrpiodame mfeiat)aDtm(  ;o0aee iieiys a2ranvs;u0teerxf3oadopte nvilt srxrim3ny4opee ict t) Drr( p;t1ape  ieildlm uan o u0tleoxf3iodfpt lieo t  2xm(mpoo1ap nmicsas)srumxmont0aeen fctytla2uauvonu4trxnio ia1fmDr i i;()t2umxmpiudaleemfetat) Drmurp;t0oee moeiadla rlnvo;u)altoxf oatfm  anvs t s2xm(r3iydal n fes s)sDtmxronu1aetnmicils m ean p;t0alxrxrciydfa eli sls) 2to(r oy4om emncias) 2rrxro;t1tlx ii3iad s em(vsnu) rtrmrciadoat lu o;t)tetmir ny1llenlfcs (f rrru ooo0aexoif3iasfs ean o u) rerxr3oydfpDr nvolt0 euo(opno1om nlfctl()srtax pot1alxnii3iyt m elumonu0tleoxf3ta1fm e i o s  rxm(opnudlmt lieils  rtaumoot0opxniociyslmDrmuvo ()trtnxrciytlp r ueslt0sexmim iu1lpenmiciltf Dua(ronu1alt  f3tyt mDrmuvs u4trtrxociytlm r u ol(0 rtr(o3oo4omenmfes (  2tm( pou0tpe  o3tldls uan ont0trtoxfciatoa   uvils0t2uoxmpno4om nlnvs tfsDrrumont1aptnii3tld mDem(vo;u0 leoxf iodfpDe ivilt)truriopou4ll nliviat)s2urxr nu1optnmfctyt a raums ()trerxrcoadfat  uvs (  etrim3oy1lp e iesat)sDurxr nu1aptnioctlsfsDumnvsnu0aeenifcio1lat aies t0 2ur(r ou4apenmncta()sDtmxmono1ope mieiltfs rmu o t4 rxomrcoy1lp r i o s0trurxm iydll nmnciat)aDurumooo0altomfeildfmDel(vsnu)altoiocoydfaDrauvi ( srurio3iu4omenmfviat  Dtmxrono0aeeo iciad mDranvp t4tetrxf3oydlaDr neols0 rxmxrpny1op e fetl( sDra(r ot4texn o3ilt s2ulnvp;t)teenmo oadomteai s (0texoxr3nodlptelnvtlsf rraurp;o0apxomiciyt s uaumont4 eenxo totlpD  iei;t0texoir oodame  ietl()a2raum nu4tpenmf3tldlsDeanmp u)texnxo3oatlmD  u o;t)t2um(mpiu4amtn nvsas  rtrx ont0oetoiieiadfm2ea(vp u)arxnxocoadom rauesl(0texo(m nodalt  nctat arua( ono0teeniieilsla rl(mpnt)aetnxfciadoaDeanes;s s2tr(r iu4ameemnvt t arurxront4tleo i3iltla em( p u4 leomo3oy1la eai i;t0 rumim3iudaptelictatfsDtau pnu4olenmf3iyd m el( s (4tlenmo3ia1lm r n sl(0s2uoimpnu1aleemfcslsfsDrax pot0tex  oetydfmDel(vpn()altrif3oy1fpteanvo;s0texm(opoodlmt lfvias srrauro;o0tpx if3iatfsDeluvs;(4 lxnxr to1omD au o t0 rur(opiydaleelfcsas  rtrumoou1tlenmieildls2ea( snu)altnmf3oatomtr uesl()trurim3iodap  lfes ( srurxmooo0teeomo3iydls2em(vsn(0artnif oa1oa eli o t)trumim3oy1ll emnvtas sDtmxr ;t0tex iocildfs uanvpn(0trtomr3tatoaD au s;t0t2xrimpoydlp e ivt ()aDumxm ;o4tptomo3iasfa ul(vo;(0trxrio oydopDe nes t) exrxopnu1ome  ictasfa2taxrpno4tpeoiicild m emn p t0 lxnif3to1omDraies t)teurxm oodol  mfei ()a2um(r nu4aetomfeiyslsDrluvsnt0teeomfcoy1faDrauvs;(0srxr(mpiu4aleemictasf 2urum ot0aptnmiciys s eanmp;t) leoircoydfmDr ues;t0trtmxo oo4omenmiesl()aDtr(ro;t4olt micildfs eanvo;(4 renmr oa1om e ueo s) 2uo(opoy4llenlfcia( s2rrum ;o0tlx mietldls2emuvp (0artrxf ta1om eaiei;s trtm(o3no4om  mfvia(f 2rrum nu4tlenmictadla el(ms t0 lermo3iodlat lu ols) rtoirpiydlpenmfctlsf ruru  ;t0tpx  fetas m rl(mpnu)aexnircoa1op e nei;t0 rumxrpny1aptelncs ( arrm(m nt1oltomfeiydfm2ulu s;u4trtnmr oytlat lneo;t0 rxrirpnu1lpen ieils aDtmx o;u1olx ii3tlt s uln pnu4 rtrxoctodla rau slt0 rtm(mpio1om emnciat) rrmx  nu0apenmf3iysla2el( o;t)arenir3totlate ivilt0sexr(o3nudlptnlfcsls arta(mo;u4aeenmocils mDumn s t)artrmoctodoaDrlnvsls  2urxm3oudoleelicilt sDtrxr ot0aexo ocilsls emnvs;u4trxoxoctotomDraieol()s2toio3ny1llte nvils)arumxr no0tee  o3ild s2rluvs;t) ltrxo oodom r ies t0 2toim io1lpenmicils  Dtruronu0oltnmiciasfa raumpnu) eermf3iodopD lieo;(  exrimpoodomtnlivta()srraxr ;u1oetniociys m2eau snu4 rerxr iodlm  aieo (0 eurxopiodopen fvsa(fsrrmumoot4tpe iietltla eln o;t4tltnio iotfaDrlnvo ( setmiopoydamtnmneiat  rrru ono1oee ii3ilslaDrauvs;u) lxnxf3ootfmt lues s0 ruoxopnu1lle lnetl(faDrm(mpnu4optomoeiltfm uanmon(4tlxrio3iytfmtrluvs (0 etr(rpiydlltnmnvtls) Drr(rooo0tpx ifcilt sDeluvs;(4alxoifcootoaDe uvol( sexrim3oy4olenmnvta(f rtrxroot4aptn feiaslaDemuvs u0arxoifciatla e ivi;s)seum(r3ny4ome  nes t s2tmu ont0tpxo fciysls2rmumo;t4aeenifcia1opt lu ils texr(m3oo4alee ivtl( sDra(roou1tltnio3iltfm2uan snu4tlermf3tadop eln i s0t2uo(m3iydapte net t)a2trurooo0opxnio3iys mDum(mp;u0artrmrcoodla rlieols) 2toirpou4ame mncs s)aDra(mo;u4aet ii3tasla ua( s;() lenmo ta1faDelnei;()tetrir oodomenmnviat aDrr(r nt4tex  o3tltfs2ranms;()tlerxr3io1la  auvi s  rurxmpiy4amt lncs (f rrax pno1alxoif3tytlaDemuvo () rerxo iotfm rliesls) ruoxr oy4lltelfesas)sruaum ot4tpenmieilslsDua( o;()altrxf todfa elivol(0 2trxr3ny1om nmfes t)srumxm ot0aeenmo3tydls rlu s;()aetrircoa1opt  uei t) rum(r iy4omtnmnctlsf 2tmxrp;t4tlen o3iysls2rmnms;t0 exoiocia1fm e u o;t)truo(opiydoltelnvi t) rtrx oot4tptnifctat aDem( s;(4tlenmfcoa1optrlu sl( s2umiopnu4ol  lietlt) rtrxmpnu0opeo ocias m um( pnu0trtoif totla   u o;( s2xmxm3iu4al e iesltfaDtrx  ;o0tltnii3iytla2rm(ms;u0texoir3tytlp eanvo s) 2um(o nodlp n iesat)a2uax o;u1tle  oeild m2rmnmo (4trtoiocoy1om   uvslt  etr(m3io1apt  iei sfa2tr(mo;t1altn i3tydla2ul(vs;t4trenio3tatfaD ln s;( s2uo(o3iy1ale  nes t) Dumuro;u4apx  o3taslsDrm(vo t)tlenio3oo1fp   nvi;()setm(rpiu4oleemncta() rtr(mpoo1alxn i3ias s rmu s t4 exrxo tytla ranvs () 2to(o3iu1ol elfvs (fsDuau pot1opx  f3ildlaDeau p (4alxrir oo1la  ln o ()srtm(opou1aptemiviat arrmur ot0apen ieiytfm2uauvon()aetoirctytoptelu s;s setr(r3io4open neslt sruaumont4ole mo3tas s ea(vonu)trxrxf ootopteau s ( setr(m3iydalenlfet ( a2um(mpou4tpto ociltfm eluvp;u0tleoifctytop r ies ()srxrio oydlmtn fvs tfa2ra(rooo1openiictyt sDrmn p;(0texrmo todoa rlu o () rxm(rpiu4apte nctasf 2umum ;o1texnifeiytlm2ra( o;() exrirctodoa rai il(0sruoxr oo1ll  mnctl( s2urxr oo0oetoiociyd s2ea(msn(4 exoxo tatom eln s;t)sexr(r3oo1ol nmiesa() 2rm(  ot4oleo f3iytfa2rmu p (4 etrir3ta1omDr nvols)srto(m3ou1ape  fvs t) Dta(mpnt0tpx ifeiatls2ul( s (4arxrif oa1fpt  nvo;s0t2xrxopnydomeelicias)sDtm(rp;o1texomf3tls s2uau o u0aetnif3totopteauvi (  etm(r3iudoltelnes t) Dra( ont1alx mf3tltls rm(vp;t4teermo3iodomD livo;s)sexm(m3nudomt lfesas)s2taumonu1ape  fciysla2ranmo;() rtnmr3oatfmtr uei t0teuoio3iu1altnliei t)aDrmurp;u4apt ii3iad s2ea( on(0 lerif iotfm  aivsl()t2xrirpoy1ape mnvsas  2ta(mpnt0oleniieiys m2um( pnt4texnir oytoaDelnvi;s  2xr(o3oydap  mnet (farrrxmont4oet ii3ild m2rmn s u)areomrciatlp  aiei s  2umxm3nu4ameelnctl(fs2ur( o;o1altnio3iltfa2rl(ms;u)teermf3ootoaDe ieil(0s2tr(r3iu1om   ncsls s2rmump;u4tlt iictydlsDrmuvo t0tlxoxr oodlm rai i t t2xmxo io4lleemfeias arrrxrpno0aexoiiciyt aDrlu pnu)aetrxo3oa1lpD li o t trurxmpno4altemfvilsfsrraumpou4apxo fciadfmDelumo;t0aexnmf oodopDr ies s) eumio nu4omte iet s)aDraumpou4aeeomocilsfs uanmpn() lxomf3tadlp  li il()t2tmimpiu1al nlfeias)a2ta(ronu1oeen feils a2ra(mont) rerif ta1lptrauvilt t2trio iy4olen nviat  Draur nt4tex mociydfs2el(vpnt)altnif3oy1latranei;( trxoxr3no4ameelivtl()artmxmpoo1alxo iciytfs rmnmp;(0artnio tytop  an s s s2uo(opiy1ape lfct sf 2tm( pnu0tlenii3iat m rlumsn(0aexnmocoy1oatrlieils) eumxm3ny1amt lietl()sDrrx p;t0tpe  o3tldfm ranmp u0trxoxrcty1oaDelivils  rtriopoudopenlneslt)srur(rpoo1apt mociltla uluvo t)aeeoxr3oadomtelnvi t) 2xrxmpnu4al  lnviat  2trxrono0alxnmfeild a2rl(vo t)alxnmr3iy1faD auvi t0 exoim oy4lmt  ncsas srurx o;u4aexoioctlt m2ua(mp t4aexrxoctatlp  auvi t)trtm(o3ny4olt lfvia( aDta( p;u0alx mfciltla2em(vsnu0 etomo iodoptrai i;s srtrxm3oo1oltnlfei sfa2rmu  ;u4tltn iciyd a ean on(4 etoifcty1laDe n i (  2xo(o3iydoltnlnct t aDrr(rpoo1tltnioeiyt a2uan p;()texnif3io1oa   ueo;(0s2xr(mpnydome  iviatfsDurxmo;t0olxniietld a ua(mo t4 renif3ootop  aneo;t  2xmxrpiu4omeemfvta() 2taur ou1aeeo fciyt a eaumonu4tetrmf totfpDr nvol()trto(m iodlmtnmivil()s2rrx o;u0oexn o3iytfm2em( o u)trtnxr3totfpDranei t)seurxo3ny4oltnlncta(  2trx oot1tleomictysfsDeluvs t0 etrmrcoadfmDr nvo;s)t2xoio nu4ale lnvils)s2uaxmono0apxo i3iadls2rlu o;u0tlxrif iotoaDeln ol(0truoio nudamenmnvi tf rrrx p;u0teeo f3iydfmDeln p;u0 eenif oa1lpt  nvo s0s2xrxr3nu4om   nci () rta( pnu0optnmoeiat aDranvp u4aexoxrctatomDrlneo t) eumio3iodll e nvi t sDrrurpot4oeenif3iatfmDea(mp t0aeeoir oo1oa   n ols  2uriopiudlmtnmnvsatf rrru pou1aetomictld mDrl( pn(4tltrmf3tadlatrluvol(0srxm(r3no1ap elnvi ( artrxmp;o4tlx mo3ias m uauvp u4 eeoifcto1lpteln o (0teuo(o3oy1lmeemnesat)srumumo;u1aet  i3iytlm2eanvpnu0 rxoif totomDeanei;(0texmir oy1apenmnetl( srtmu  ot4apxn feilsls rmums t)aeermf ia1omD  n ols) exrxo iy4ope  netls sDrr(mpoo4optnifctytfs2ean s () rtnmr3oadlmD luei t)srtmir oo1olenmiet sfaDta(r ;t1alxoiiciadfsDel(vp;() etomf iydfpD aneo s setoimpiu4op nlivs sfs2uau pnu1tpx  feilsfs ran snu)tleomr3tadfp eanvilt) eumio3nu1ame lfeia(  Dtrum no4opt mfetydls2ea( on(4trxoir3tydlmDraieo;t0 rumirpou1omtemictas) Drmx  nt1aptnio3tadlm2umump ()alenmfciotomtr n s t)t2toir3iudame  ietltfarum(  ;t0openifetyt m2el( pnt0alerxf3iydlaDr ieilt t2xr(m3oodlpen nviltf rrm( poo1teto ieias s em( p;()alxoxo3iodfmteluvs;s0srxm(opoo4amtnmieilt aDtax pnu0oex  f3tltfs uan snu0tetnmo tytop e nvi;t) 2tm(m3io1ol n nctl( aDrmur ot4altnmf3iysls2rmumpn(0 lerxr tatoa eai s s0trto(r3nudlptelncils aDrm(r nt4alt ii3tytlmDemuvp u0trxrifciatlaDrlu il(0trtmir3iodome  nctlt) Dua(r ;t0tleomictlsfa2ranvp;t4aeenmf oytlp elivs;s trxrio3ny1lle  ivt ( s2rm( pnu1oeen feiat s2eluvs;(4alerxo3iydfp r ivs;( srxm(rpou1omenlici ( s2uauroou0aleoioetat s ra(vont4arxnifctatopD livslt) rumir iodopenlivsl() rrm(mo;u1opto oeiadfa2ulu s (0aeeoxrciotlmt livo ()srtr(r oo1al  lfcta(  Dta( pnu1alt iociys s2uaums ()alerircoatopDeanvi;() 2xrir3ny4oleemfetl( arrrxm ot0tpto ieiadfsDemnmpn(0tetrifciy1fp rauvi;s)srur(r3ou4llenmfvs sfarrrump;t0apxniociydfaDuaums t4tleomo3ia1fmD aieo (0truo(opoydlptelnvsl(fartm(mpot0aptnif3tltls2umumpnu) ltoir io1lpt liei;t t2uoxm3iy1aptelicias)aDrmxrpoo4tltnmoetydfmDua(mp;(0tetomr3tatomtr ivi () rtr(mpnudlmenmfvi t sDur(mo;t1apeomfetldfs emuvon() ltnir3oa1op rai ols)t2tmim ou4ol nmivilt)sDtau  ou1teto ocilsla em(vpnu) ltnxr oo1fp eliesl() 2uoxo iu1ope mfcilt)arua( pot0aleomoeiyt s ulnvsn()arermf3oy1lmDeau i t texoim3no4alenmivsat  rrm(rpno4tpt  ietys aDrl(vsnu4tetrmo tytfaDelnvsl()trto(rpnodllen icias s2rmxr ;t4aet mo3iaslaDeauvpnt0tlxoxfcoo1omD aueslt0srtoxo3oy4amen fes s  rtru  nt0tpxnmocilslmDem(vs;u4 ltomr3oydfp  lu s t  euo(r oydom n iesa( sDrmurpno1aexomiciat m elnms (4 eerxr iadfa   ivsls) rtrimpiu4am  mivta( s2um(mp;u1olenmictldfmDrl(mo;(0 etoxfcoytfptraieo s0 eum(m oudolenmivsl( aruax ono1tpen oeilt mDulnvp t4 eenxf oytom e ieslt  2umxr3no1lmtnlfctl()artr(  ;t4apxnifetatfm2ra(vp;u0 eeoifctydfmte ivi t srurio ou4al emnes sf 2rmx  no1oetoifeiydlmDel( sn(4alxnmo3iotla elnei t0s2tmio3oydlptemncils)a2uru o;u4teto oeildlsDelu p u) rtnif3ty1fmt anvi (  rtmxo3io4lpt lics t s2taum no4tlx  fciys mDuanms;(4tetnio ty1laDelnei t  rtoio iu1omtn neslt)a2ur(m nu4apxn ieiytls eauvp ()alerir3oo1fat au slt0trtrio3oudol   fcils  rum(mooo0olxo ociysfmDum(mp;t4tleoxf oa1lmD  ivi ()s2xmxr iodlptn fvsl()srrr( pot1oleomieildlm2rlu pnt)texrir3tadoat livolt) 2xr(r ou4lm  mnesatf Drmxro;o1aptniocilsfs rln s (4arenmfciy1oaDeaiei t0 euoir iy1op nmneta()sDtaurono4oeen fetyt a2um(vp;u4tetomf3iotlmDr u s t)teurxr iu1opt  fesa(f Dtm(mp;o4aleoifetytfm uluvo u0 exrir3iy1omte neo;(0seuoxrpiy1ame mies tfarrmxr nu0tpenii3iysfm ranvo t)trxoif io1optranvolt0texr(rpoo1ame mivi (faDua(  ;u1tleoiieiaslaDulu p t)aexnmo3tatfpDe n sls s2xm(m iydamee fcil(  Drmu p;u4texnmoetlt m2ul( onu4arerio oatfm e neo (0 rtoir3oydopeelietltfaDraumonu4texoiiciyt s2ulu s;u0 exnif totfmDe ieo t)trxmio3oo1ap e ict (  Drrurpnt0alxomfciatls2rl(vp;t) lxnxo3oatomt aneil( t2to(r3iodalen nctls aDurxrp;o0oet  o3iydfaDrln o;u0texnmrcoatlaD ln o;()trtoxopoy4ole  ivsa(faDrau o;t4tlto o3tys s uanmp t) etomociytla e nvolt0 rumio ny4ome  ncsatf Dua(r oo0openmociat aDea(ms t)aexnxfcoa1lpD lnvi;t  eurir3oo1olenlfetls) rtaxmo;o1texnifciytfmDea( p;()tlenmociatlp   ues s) 2xo(m3oodop n ivsat  ruaur ot0ope ifcildlm ua(vpnt4 rxrir3oydfpDr uvs s0t2tr(m3iu4llen ici t s2urx pno1optn fcildfs2elnmo ()trxoio3iytfp r u s t  2toxo oy4opeemnes ()aDtaum oo1oetnmoctydla2emnvs;u0tlxnxr oytlmD lueo;t)t2to(mpny1lle  ici tfs2rmxr ou1optomfcilt mDeauvp t4aleoirciadlp   ivols0sexoxmpoudlleemfcs (faDtrur no1opt  feias s2eanmo;()texnir iatomD  i ilt trxm(o3iudole livilt a2rmur oo4tptoio3ildfm emu o t0texnxfciadlpDeauvols0texoimpoydamtnlivs ()arumxm oo1opxomfeiltfs uanmp u0altnmfcoadlpt lueo t seuoim3iodlme  nvtls)srtmxr ot0opx iocilslm umnms;(4 etnmr oytop   uvo;t teum(opoy1lptn ncil(farra(mont4teenii3ildla rm(vs u0 lermr iadomD  uvi s0t2um(mpiydlpe mfesas)aDrmuroot1alxn fcils aDul( ont0aetoxo3tydoatelnes;t t2xoimpiudamt  nctlsfs2um(mo;t4altoioctls m rl(vo;(0alxrmfcio1laDe u s;()srxoir3iy4am nmfcta()aDrr(mpnu1oex  fciadfm emuvpn(4aexrmf3tytlmt anvs t) euoxmpoydal nmfctl(  2ua(ro;t4optn feild m um(msn(4trtoxr iydom r uvols  2uoxm iodamtelieslt) 2urxmpot1teeo f3tatfm2ua(mo;t)aeenmr3tatfateluvo;t0teto(mpoudlmtnlfcilt)srrmx pnu0aleoio3tytfa2rlnms;t0 lxoxr iotoa   n ilt) rtrimpny1op nlfeils) rrru  ;o0openii3iydlm el(mont0altnif3oydlmteluei t  rtoiopio1lmee fei t) Dtax  ;u0opeomietlsfa ulnvsnu)trenifctadfat  n o;()s2xmirpno4ome  nvslt aDum(mpot1aleoiociasfs2ulu sn(4 ltnxr3oadlat lu o t  rxmimpnudol elfvtl() rumumpot1opeoifetydls2rau o;(4aetnir oy1opD ai ils  etm(r no4ale  ictatf Dtm(moot0ole mfctytfm uanmp;t0tltrxrcta1la r i il(0 2xm(m3oo4apeelivsasf 2trxmpot4olenmictls s2rmump;() rerxfctydlpDelivol(  2xm(o oo4optn fci ()sDta( p;u1opt iieild s rau ont0teeoifcoadla eaueslt seurxr3oo4ol nlfcsas aDtm(mp;u1tltomfetysfsDel( s;t) exrifcoadfa elnesls) 2xr(opny1ll  lncta(farra(mo;o1teto octysfm ranmo;(0 lxrmrciy1lm  lu sls sexr(r iy1lpte ies t)srrrxmp;t4aex  ictldfs2rmnms;t)altrio3tytoaDeaueol( srxriopiy1llt mnvsa()aDtmxr ou1opxoio3ils m2el(ms t0 eenifcoy1oaDeauvo;t) 2uo(m nu4amte nvtat) 2tm(r ou4alx mfctadfm umnvpnu4alxoif3oatoaDr neols0 rtrxo3nudlmtemictl(f 2rr(  ;t0tle mfciydfs2uluvp u)tlxoxo3iytfp r uvs;s t2umim io1al eliciat)sDuauronu4oexomo3iysfs emnvs;u0tetrmo3iadfm rauvs s)trxo(m no4om nliei (faDraumo;u0aleomfciltla2rmums u) exrxrctytfpDeanvi (0 rto(o3oy4ap elict tf rrau  oo0tleo o3tadlsDuluvon(0texomfcoadoaDrlueilt) rurxmpiy4am  mietat arumxmo;t1tle  i3iltlmDea(mp u4aetrmf ty1fmtelivilt)srurxm3iu1alen ivi t)aDtrxr nu1ale  o3ilsfs2ua(mp;t)aetniocoa1fpt anvi;s0srxoiopnu4ope liei s)srtrurpnu4optnmiciadfaDumnms u) reoircoodfa rlu i t0 exo(rpiu1ale  feta( s2rruro;t0tlt moetatlmDeau ont)tlxomr3oatfp   n o;()srtmim3nu4amte nvs ( aDua(m ;o4opeo iciyt s2ra(ms;u) eeomf iotlm   nvo;s0setr(opoudam   fviat)arumumo;o0apxo icildlm rlnvp;u) lxnxrcootlpDe ivs;(  rtmxo ny1aptnmfetls sDta(r ot0apt ifetltls rmuvo t4tetnmo oy1fpDelueo;s srxo(m3io1alenlneils  Dumxm ;t4tlx  fcias sDra( pnu0teerio iy1lmte ivils)srxoio3iodlmtnlfvtat)a2ua(  ;o0aexnmieilt a elnvsn() lxnir oytfmt  ueo t0 etrim3iu1altn ics t)srtr(rpot0tpe if3ias s uluvo u) exoxr iotomtrli s (0trxo(r3io4am e fei ()s2urxmp;t4aexoif3tadfsDeln pnu0texnmr to1fmt  ieslt srxoxr3ou4altnmnvt t sDrrump;u0alto ociys s rmnmpnu4teenxr3oydomDe uvslt0 eum(r3ny4lmeemfesat srra(mp;t0tpt ii3tldls2rln p;t0 rtrif3iatfat lnes;s0 2trxo ny1oleemnvsat s2raxmpoo0aet moeilsfm rl(von(4aeenio iodfm eluvs s)trxrxmpnu1lleelieia(farrm(rpno4opt iociytlm2em( s u0teeoxf iatlpt ai s;t)s2uo(o oydolt  neia()sDur( ooo1texnmociyd m ua(vsnt)artoxr3iatop  au ilt s2uriopnudam eliei sf rurump;u4opto feilt s2ea( p;u)arermo3iotlat anvsl() rumir iu1olt mfvtltfarrm( oot1aexnmoeild s ean s ()aetrio iadoaDe n s s0 eto(opiy4aptemnvt sfsDtrurp;u0oee mf3tyd sDuauvsnt4 ltnmocoa1lmt lnes (  2xrxrpoy4ol   nvs tf 2um(mpnu0openmieilt s2em(mp u)tetoio3oytfmDran i;s setmxopio1optn fvtl(fa2trur ;u0tetniicils sDeaump;(4tlenxf3to1lmD aues;t0 euriopiu1lpen feslt srtr(mpno4tlxomociadlsDrm(vp;() ltnxrciadfa   i i ( s2triopiy1om  mfvtat)arrau  no1tpenmfctys mDum( pnu)alerxo to1opte nesl(  eurxr3iy4olee ictltfaDumump;u0tpe ii3tltla ranvo u)alxnifciotlm e ieo;()srxmio nydolee fctltfaDra(mp;o4apeo ietytlm elnvsn(4trermfcto1om raies ()texo(opnodol emieiatfaDrru p;u0alxniieilt aDuaums;t4 leoxr iy1la   n ilt)teurxmpoodom n ncta()sDrax pou1olxo oetatls rl(vont)texrxo oatlpte n s s)tetmio3oo4lpenliviat  2urur nt1aleniictls mDumnvs t)tetrircoodlmte neo;s)t2umxr3oy1lmte nctltfs2trurpou4alx  oeiasfa2rlnms;t0trxoxrcoa1lp  an ils) eurxm nu4ole mfvt sf rrru  ot0opeo ieilt mDrl( p u4tetoxrcoo1fat lnvi;s0srxr(o3io1ll  lneils)srtax p;u0tpenmf3ils s el(mp ()altrxf iatop rli il(0seurxm3iy4ap elfetat)arumu o;o1aleo feils a ea( o t0 eeoxf iytfpD luesl(0 rum(o nydopee nctl(farra(mpnt4tlx mi3iydfa emn pnt) lenxr3tytoaDeli i s) 2xmim oudap nmies (fsrtru onu0teeniietydlaDrl(ms;t0 reoiocoa1omDeauvo t)trum(m3ny4lptnmnet (faDtr(  ot1olt mo3iytlm rm(vs;t0aexrmo tydfmte i s;t srxoim nu4amtnmivs sf 2um(rono1apeoifeiys aDrlnvp;()arxrxociodop rluvs t sruoxr oy4amee netlt)s2ur( pno1oetnif3iyd a ua(mp u0 rxrmf tytfmt aueslt srurxopnydapen iet t) rrr(mo;t0apxomi3ild sDrm(mont4 lxrif iadoa  aies;s)seum(r iodopenlnetl() rrmu ont4oexoif3ilt m2umu s;t)texnmo iotopte u i;(  2tmxopno1ol   fei t  Dra( oou4apx  feiyd sDrl(ms;t)altomf iatopte uvi s  2tr(o3no1al   nvil(f Dum(r nt0tpeoii3tyd m2um( p;u)trerxrctatfa rluvils)trxm(rpiodlme  fvtls)a2tm( ont0oltnmfciadfaDuanmo t)tlenmo3to1omD anvslt)teuoir oodam nmnci ( sDuaxmpno4oexn feiytls ean s t)tltrmo tydlpteauvi s) eto(r3io4ap   fcs t sDuaxrp;u0openmi3iadfsDemn s ()altnioctatlatrauesl(0setm(o3iu1lptnlfct (fsrtrumo;u1aeenio3iadfs emnvs;t4aexoir3oatoa  lnvi;(0 rxoio3iu4lpe mieil(  Draxroou1ale ifciydfm2emu o;u0aexrxfcoo1opDrai o t0seur(o oy1alt mnvs s) rtaurono1oeto octat sDum( o;t) leoxf3oo1lpt lu s;() rxr(r3iy1op nmnesls s2uru ooo0tlt  fciltla2elu snt) ltrirctatlmD ln ils trxrxm oodap  miei s  Dta(r ;t0ope  ietyt mDranvp;u0altomr iy1om rlueo t)t2tm(o3ou1omen nei (f Dtr(  ;t1ale ifctas m rlnmo u0tetnmfciotlmtraies s srxmirpou1omeemfeias  Dua(mp;o1olt if3ilsfm emu pnt0altomf3tadom e i i;(  rumio3io4om nlnetls  rtaumpoo1ale iictad s rau o;t4 rtoxfciy1lmt au i s0setm(o ny1lmeelivsas)sDtr( p;t4tpe  icilsfa2elu s;t) reomo3iydlaDranesls)trxmxr3oy4altnmivt tf rtaum oo0tle  i3iatfs uan pnt0arermr iadomtr u o ()t2xoxr no4ol nlivsa(faDuaur no1ope ioeias m rl(mp u0aexnir iodla   ivol() exm(mpoo1lpt mfvilt)arurum ot1olenmiciys mDulu p;(4 reniocoodlm eaivo t) eumxr3oy1ape mivil(faDraum ou0oltomictasfs ulu s u)alxnxfciadoatr nvol()srurxopiu1lme  icsas arurxro;o4tet mf3iasfs uauvs;u0tlxnxr3io1lm  au ols0t2tm(opoydlpenmict ( arrrxmont4tlxoifeiyslsDrmu pnu)trerif3tadlp e u slt)srumimpnudaptn neta(  Duaumpno4tlxnmoctadfs eln p (4artoif3iatlaD  neol(  2xoimpoydlmenlnvtlt)sDtrxmpno1tltn f3tat a ea(ms;u4teenif3totlpD aneils)srxoxopou4ll  lietls sDrmxm nt1openioetatlm2emuvo;()arermo3totfm   nvi;(0setmxm3iudlmtelieta(f Drmx pno1aptnmiciyd a2ea(vo t) etnifcoytlaD ai i;t)s2um(o iu4lpt lfvtlt)s2umxroot4alt  f3iasfs2umu o (0tlxnxr iodlat  ueils)setmxr3nu4olt mnvsasfsrur( ono4texo oeils s emnvs u) reomr tytfmDraivol() rtmio oodlltnlivt sfsDta( ooo4aeeoif3ilsfsDrl(vo (0trtnxf3iydfat lues;()s2urxr oo1lmenmfvt ()srumxront1oet io3iysfs rmnvsnt) etoifciatomD aueilt0t2uoxo3iy1al  lfctasfa2rrxro;o1aexoii3tytla2umnmo;u0tlenxo io1fa  auei t)texo(o3iu4olenmiesl() 2taump;t1opx ifetltla2ea(msnt) lenxoctodopt lnes;s  rtrim3oo4aptnmivsa(f Dtaxmonu1oltoif3iydlaDemn p;t) exnxr3iadlaD lu i s0s2xrxmpnudolt  fvslt)arrmxmpou1oltnmi3tasls ul(vpn() renir oytopt  nvi;s)truoio3oy4llen fvsas  2uau o;t4oetomieilt s rlnvon(4artoif3tydfm  lies s0t2umxrpny1ame lneil() 2umum ou4aexomi3tytfaDrlu p u4 ltnxr ty1fa rlueils s2trxopiydam nmfvilt) 2rru p;o1opto oetltlsDranvo u)altnxr oadlp eaueols trxrio iu4opt  iei s) rtm(m ot4apxnmfeildfmDrm(vont0arxoxfciadomDrlueo (  exmiopoydlmtnlicsltf 2rrurpnu1aee iociatfaDumnmsnu)teermfctodomDe uei (0setoxr iodoltemivilt  2trx ono1tpx ioeiat aDean sn(0tlxoxr3oatoate nvol( trto(o oy4oltnmivi tfaDrr( pot4optomi3ilt aDumu p;(4aetoxo3oytlpDr i s;t  2xoxrpoydoleemfcsa( srtax ooo0oeto iciadfs ulu onu0trxnxr oodfptelivs t)seur(o3nydlle lfvs t)s2raumo;t1texn feildfs rlums;t) eenir3ty1lptelieo t0t2xmxo ou4lmtnmfvilt)arrr( pou4apxnmocildfs rl(ms;u0aeermo oydlmD aueo;t  rxrxr iodap  licsat)aDur(ro;u4alt mi3iatlaDra( s;(4 rxoirciy1op rlieo;(0truo(r3oudamenmivtltf Durxmpnt1opeomfctyt sDrmn o;u4artrxr3ta1lptrlnvs t  rxoxopnodllenlictltfaDrrx oot0tlt iociyt s2em( p t4altnir3iotlp e ues t0t2umxo nudop nliviltfsrurxr ;u4alxo f3ils a rmnmo u) rerxf ty1fpD lneo s  2urxm oo1ap   nvil( srtruroot1tlto feiyt a2ea( s ()texrif3iadop e u i ()texrirpoo4ameelnvils)aDrmxr oo4oltoifeiasls2raump;u4 rtnxocio1fp eaivo;t0s2um(mpno4optemfvsas) 2umumo;o1alx moctldla ulumonu4 lenir oa1fm ranvslt) 2trxr3io4al  mfesa(f rrmurpoo4aexn ieiltfs2umnmp;u0aeeoiocoo1lptraivi s) 2um(m3ny1lm n nvsat)artmxro;o0tpe iieiad a rlu p;u4 rtnxf ia1latrauei (0 2urxr3oudame  fei sfsDrmu  ;o0apxo oeiltfa2uauvsnu4tltoxrctodlm   ues ()srxrio oo1altnlicsa(fa2rau ont0tpxnmfctlsfs2umnmonu4 lenmf iadlaDeauvi;t  rtoio3iu1lm eliei tfarrrxroot0alxoifctysfa uau p;(4arxoifciytfpDrlueo;()trurxo3oy1lleemfet t a2trurpno4oex miciad s2emuvont0 etoxo3iodomtelu sls)s2toxrpoo1ll elnvtlt a2rm(moot4tlxoiocilsfa2rlnmo u)arxrxocoatlp   ivo s)sruo(m3iydomeelivs t)s2umurpou0teeoif3tytfmDrau onu)aexnxo3ty1latelnvi;t)tetrxrpiu1al nmnvsat  2raxro;u0opxo octlsls rl( o u4 leoxocta1la e n i;s seuo(m3oo1am nlncsas artaxr ;o1tpe  fciydlm uln p;t) lenmo tadfaDe ivi;( t2xoxopoudopeemfcslt  rtrurp;t4olt mociat a rmu o;()aetomr oydomDe neols t2trirpoo4op   fvsl(f 2tmu p;u1aleo feiad s ulumo;t4 rxrif oydlatelu slt0s2urimpoodomee nvs tfa2trurpoo4opxnmi3tlslsDemnvs;t)trxnxo3todlmt  nes;s tetoxo oy4lltnlfei ( arrmx o;t4aleo i3tlsfa ra(von(4 renmo3tatlat  uvil(0 2umim3iy1al   ncilt)aDtmxmpno0tpxnmiciytlm uanmpnu4tlxnmf3oadfpDeliei;t0trtrxo io4amtemfeils  2rm(m no0olt  oetlsfaDuan pn(4 leniocoo1fpDelnvil( srtmxo3iy1llenlfcsls  Dtmumpot4aleoifetadfs2uluvs () lxoif3ty1fp rlu s;t0 eto(o3oy1op n neiltfarurxmo;u4tet  i3tas m2ran p ()texnioctodop   i il( s2xr(m no1ap e ici s sDuau pot0tpx  oeiytla2rlnvp t0 eeriocta1oaD  ieo t)trurxopoy4omtnmfctat arta(root1tet moctyslsDeanvsn(0 lenmfcta1fpDean s;s setrio iy1apeemict ()aDtaxr ;o0apeniieiatfm emn p t0 exnifciytopDe uvs (0s2uoxmpny4oltnlfci sfaDtaxmpnt0opeoifeiysfa uanvs (0alerxociydomt lu o s0teum(opnodlmeelfet (fartau ont0tlen ieiadfm eln pnt) rtrxf3todfp   n s t) 2toxo3nu4lle mics sf Dtru o;t0texnmieiltfs emump t0 eeoio iadlaD aivol()sexr(r3iu4ol  mfeslt)a2ua( pou4altoifciatlmDeln s;() reoif todfptrln o (0seumxmpnu4ap nmfvtas  rrr(  oo0teeomo3iadlsDel(ms t0tetrxr tydopD  uvols)trtoirpou4apenmfesl( aDtaxmp;u4altomi3ilsfa rmuvpnu)alxnxr3oa1omtr nvi t tetoxm oy4ale  icia(fs2ur(mooo4opt mo3iadlmDelnmp t0alxnxo3tytfatelieo;t  rtr(m3iodom nmici t)artaumonu0tltn f3iyd a2el( p t4alxnio oytfpDe ivsls0trurxmpiudame  feil(f 2uau  ou0olxoiietyslmDuanvo (4 ltomr iatfmD  i olt seuoiopno4lme mncta(fartmurono1tpxoio3iltla rlumont)trxomrctydlpt  i ols)teto(opiy4ll nmncil( a2urx  oo0oetnifeiydla2uaums u) renxfcio1omD anei t0setoir3oydopen neil( a2tr( pot1tpe mietatls2elnms (4artrxr3iydfpt lnvslt trtoio3oo4openmiei t)srumxrp;t1tlenmoetldlm em(mpnu0tetnmf iadla eln o t s2xoxm oo1apenmnctat aDua(ro;t4tpt if3ildlmDrlump u) etnxo ta1op  ln i t0t2trxrpoo1llt lnvsl()a2um(m nt4oeeomoetytls2em( o;t)aetrmfciytopDrauei s0trxmiopoodap  miei s  rrm( p;t1tpeoiieiatfm2emu p;(0 lermf3ty1fp e uvils)s2urio iy1lptnmivtlsfs2tmu oot1tlt ifctydfs2rl( o;t4alenxfcia1lpDe i i;(0tetmxr3oy1al   net s)a2taum ou1tpe mietas a eanmont4 lenmoctodomD  nes s)s2uoim3nudalt lies s s2ua(roou0oexn ieiyd sDum(mont0tltoif3iadfptrln i t)s2um(r3iydoptnlietl(fs2rr(mpoo4alxniicilsfmDemn pnu4 rxoiocoatlm r uvi t) ruo(rpio1ol  mivsls a2uau  ot0aptomoetyt aDua( p;() ltrxr3iadlmt  i sls0 etoxo no1al n ncsa(faDrrxmpou0apxomiciyd m2ua( sn(0arxoif oydlm eau i;t sexrir3iu1lme  fcil(fa2rrxm ;t1tlenmfciltfs2uau snu0 etomo3iadlat ai sls)truoxrpiy1optnmnctls  2rrxm ;t1tpen feiys s2ua( o (0tlenioctadfatranes;t s2xm(opiydlpenlnviat arrmx o;t0altnio3ilslm elnvo;(0teenmo oydlpDe nes t)tetoim iodam e nct tfsDuau  ;o0apeniieiat aDumnmpnu0alxnirctytoa  lnesl(0 rtoxopny4alt lfesasfsDtrumoou4alto i3iytfm2ua( s u0areomf3todfatean i t0trtr(m3ou4optemietls s2urumpnu1tetnmiciysls2uau s u0 leomrcio1faDraneo;t trxoir iu4ap nmnvt s a2tmxm ot4apenmoeiys aDua(vo t0arxnifcoy1lpDeaueo () rtmir oydol   fctltf rua(ro;o0teeo oeildlmDrlu s t0texrxo3oydfa e neslt srtmim io4lp nlfes s  2ururpoo1aexo ocilt s rl(mo (4 lxnif oydfate iei;t0 rto(o iydlptemfcsat s2ua(rpnt1opxo i3iatls2emnmp (4tlxrxf iatfa rli sl()s2uoiopoydamtn neil(  rrmxr ;o0teenmfeiat a2rmumont0 rxoxr iydfpDraieo;s0sruo(r nodaltemfesls)s2rmumonu4tpeo feiys a2uanmo t0alxrmf ta1faDe n o;s)srxoxmpnudape lfci ()a2taumo;t0tpe  ieilslmDrlump u0artnirciatlmt auei t0t2toir iy4lmt lfvsatfsDtr(r ;t4ape  ictydlm uanms (4tlxomr3iatla elnvolt0texo(o3io4lptn nviat) rtru  ;t0teto oetadlmDumn p;u)tlenxf tydfpD li ols)sruoim oo4oltnmfvi s srraum no1alx  fctlt s2ulumo;u0aeeomr3to1fp  lieolt0 ruoio3ny1om   ieil(farua( pnt1olx ioetlsfaDeaumsnt)alxrmr iodlpt  nvol()trxmxo3iu4llte fesls a2tmxm no4teenmiciydls rmnvont4alxoif3iytfpD aivsls0t2uoim3nu4apenlncsls s2rr(r ot0oeen fciysfa2rl(mp;u4teerxo3oodlpt  u o (  eumxmpny1ome lfcsa(  2rrumpoo0tpe mo3iytlaDel(von(0trermr3totoatrau ols)t2tr(mpnydol nlici (farraurpoo1ole  oeiatfm el( o u0aeerifciy1omtr ies;s0setoir oydoleelneta()a2ur( pot0oeeomoetatls ranvpn(4 etoifcoatlptrau ols)s2umxrpoodole lfeia()aDrru ooo0texo fctatfs uaumo;(4 rxnir3oa1omD  nvols0s2tr(r io1op elfvi ()s2urxr oo1opx mocild m uauvont) rerxr3todfptr ueil(0 eumio oy4lmt licil()a2trumonu4teeniieias a rauvont0altnxr iydoptr uei t)srtrirpou1ap nmnct ( artmum no4oleomociltfaDranmont0 rtrxfctytlaD aneils)sexrxopiydap  lnvsl(f rtaxmpnu0tltnioeiysls2rl(mo;u0aeenmfctotom eaueol( texoirpnudapeelivsas srumxmp;o1olx mictlsfa2rln o;t)aeenxfciodlm raivo s s2xoxm iu4ame lncsas)aDrr(m ou1aex mf3tytls eau p;t)aeermr3iatomtrlu s;t) rurxm oydlmtn ieslsfsDraurp;o4alxo ieild a eaums (0altrxocoa1omtraueo;t srxo(rpnodlp eliet sf 2rm(mpnu4olt moctlt mDrl( snt4arenio3tydfaDeanesl()trtm(mpio1om nmics tfsDrau pno1olxomfciysfmDrau snu0 rtrir iy1lat lies () rxoxo nu4om  miei sfsDrru  nt1oleo oeilt sDrm(mo;u) lenxf3iydlpt  ieo ()srxrimpoy4ole  ivi tfsrraurpno4tlen oetltfa ean s u0arxoir3oytfate nvi;() 2uoio iu1apen ncsat) rrau p;o4tptoiictyslm2ulnvo (4 lxomo3ta1lmtelnvolt t2trim3oodomtn fes tfsrta(mo;u0opxo ocilsfs rmuvon(0tlermo3ootop ranes;( s2xrxo3iodoptn ieilt)aDtrxm ou4aex  i3iadla eanvo;u0 lenifcto1lpt anvo s0sexo(o ou1al nlnetas) 2raurp;t0aeenmi3iyt a ranvpnt) rtrmf3ootlmteli s s texm(mpoo1am n nvsl(f rtrxm nt1texoiictytlmDelumo;()tlenxf3tytfm  aueil() exoxr nydap nmivtltfsDrm(m oo1aeenio3tldfa2rm(vonu0 ltoiociytlpDr nvo () rurir3nydopenmnviatfaDrrxmono1tlxnioetlt a2ulu onu4aeeomrcoatla elueo s)srto(m3nydlpe mnvtl() rtaumpot1teenmf3iyd mDelnms;t4arerif3ta1la r nvsls) euo(m oy1am e fctls)a2raurpot4oleo oeils a2eanmp (0artomo3iydla  lues;( tetmxm3oodap elivi t a2raurp;o0optnmo3iaslaDrl(vpn(0 exrmo3iotomD au s;(0 ruoxo oydam elfvia( aDtrx  ot0oet miciltla2raump (0artrio3oodla  ln ol(0trxrxo iu4alt miei tfs2urx onu1tlxn octaslaDra( o t0trtomfctydlp   n s;t  rtmim oo1lpenlfvs sfa2ra(r ;o0tptn feiad s2el(vs u4aeenmrcia1faDrau o;t) rxmimpio1ll elncslt)sDraump;o4opeoio3iltlm2rm( s t) lenio to1omtrlueo;t  2umxm3oy1alenlfcs t)sDraxroot0opxomietatfmDemn o;(0trtnxo3oa1lmte nvo t0s2xo(m3oy4op   ict t  2trurp;t4ale mi3iad a2ean o u4teenxo3ootfmteau s (0tetoxo iudll nlnctasfsDraxmo;o4alx mfeilslm rm(msn(4 lxoxr3oodoa rlu s s) ruoxr3iy1lptemnctlt) 2tr(mooo0aptomfetatls2rluvo (0trxrmociydfptr nvo (  rumim3nydome  ncsat)sDtaum ;t1apxnifcilslaDrmnvsn(4texoxocoodop   i o;s0 exrir3no1ole mfvsat s2um(r ou4tetoif3ildfs2emuvp t4alerxo ootomte ivol(0seumimpno4lm elncsat  Dum( onu0alxnmiciatfm2rm(vo t0tlxnxr3ootoaDelneils trxoxrpny4lptemfvi t a2tm(ro;t4tpxomieiyd aDea(vsn(4arenmrcoadom elu sl(  ruoio nu1op elfcs tfaDta(r ;t1tee iieiysfsDem(mo u4trenmf3iotfat livi;() 2xrxr ny1olte ieiatfaDtaump;u4tpeo ociytls ua( s;(0aetrxr3ty1omDeai s;s  rumir3nudlp emfcils)srtm(roou4olen feiasls raumpnu) etrxo3oa1lp r uvslt0trur(o3iy4openlfeilsfa2ua(rpno1aex mieiytlm2em(vont) lxomf ia1fatr n ilt0t2xo(m iu4am emivi ()s2urxmp;o4oee mfeildls2elnmo u0arxnxf totlp elnes s)teurimpou4lme  iviat aDumu pnu4apx mo3iltlsDuan o (0 rermo iatla elnvo ()srtoio3oydopeelfeia()sDrrxmo;o0aleoiicildla2emnmo () eerxr3ty1faDranvo;(  2uo(rpoy4lpeemnci ()sDuru o;o4alt  fctlsfaDul(ms t0trtrmf3ty1oaD anvi ( t2urxmpoydap nmfvt tfaDururo;o4openii3ias s2elnmo;t4trtrxo oodfmte ueo;t s2um(rpoydllt lfet (f Dumxm no0tpxo oeild mDeln sn()tleoir3iytopD aies;t0s2uoio3iodoltnmnvta()artrxm nt0tpx  o3iys s2rmnvo;(0tltoxfcoatopDrli s t s2to(r nu4ole lics s)a2rau  ot1tpe mi3tasla2eaumo t0trerxf3oatlaDr i o;s0 exoxmpio1op nmfctas)arraumooo0oet mo3iytlsDrmn p;t4arermo3tytomtrau i s0t2xoir3oy4apt lfei ()arrmxrpot0apenio3tys s rauvo u0 ltrifciodomDe u o;t)t2xm(r3oodapee nvsa(fa2ur(mpou4tpenmo3tysfs2ean o t0tleomrctydlm e u ilt0setriopiu4oleemfvi t)a2rm(ro;o0openiociyt mDul(ms;t0 etrif todla e neo ()s2urxo3ou1lmen fcsl(fsDuaxmpnu4tltn i3tydfa2ea(vsn()tlxnxociotopD aieo;t)tetrxrpiydlmeelneiltfarrrur ot1aexniictyd s2umn sn(0texoxr3ty1fp e nvi s)s2xr(opoo1oleemnvs (f 2tr(mo;u4tle mf3iytls2uln p (4alxoxrciytfmD anvo s  2umim nodom nlneil() rrmuroot1oleoioeiasfa rlnvp;(4 exomo3oa1opD  ivo;t0setoir nodam elics t  2umxmp;o1apxoiiciyd a2emnvp;(0teerxoctotfmt  ivil( srurxm3ou1ome mnes tf Drax pot1oee ioetasfm2emuvp t)trtoxo oadfat  nvo () 2tm(m oy4ll  mfctlt s2uaxmo;o4aetnmfciysfa rau pnu4 ltrmf3oadlpDeluvsls)tetm(m3oudol elnvsat srumur ;t0teenmoeiatfmDra(mp ()teenxf3iatlaD livsls0 rtrxm3oudale  fci ()sDta(mo;t1olxoiieiytls rluvs;u4 etrxr3iytlp eaneo s teumio3nodomee ict (f rrmump;u1tlxn oeiyslaDumn p;u0 etoxr3iydop   u o (0trumiopoudomtnlivsa( a2rm(m ;o0oetoifciysla ulnmp u) rermfcoatoa  livol( srur(r3nu4apenmncil()sDtmx oot4oetn f3taslmDranvo;t4 exoxr3tadlm ean il(0 2urxrpoudopt  netls)a2raxmpnu0opxo ictadfm um(ms;u0trerir tatlpDrluesls t2tr(r io1om n icsa(f Duaxmoot1tle ii3iatlsDumump;() exrmo oo1latr uvi t0srxmir iy4omt lfvs tf rrrxm nu0aeenifctysla2ran on()altomf oydfaDeli s t0s2trxm ou4altnmfvs s  2tm(mpot4tlt  fciyd a rl(msnu)artomrcoy1faD lnvs s)srtrio oodlpe lnctlsfsDrm(rpno4olt  i3tys a2ua(vs;(0arerxo3oytfmt lu il(0 rur(rpiy1ame lnvtlt)arrmx o;o4olen ieiadla um(mp t0trenxo3oa1lm  lnesls)s2tr(r3nudllte nci s  rtaumpno0tltoiociadls ranvsnt)aexnmo3totoa ean o s  exrxrpny1lptnmnvsl(f rua(m ;t1aex iicilsls eanvsnu4 rermr3ty1fatrluei s)s2umim3oo4omen neiasf Dtmu  oo4olx micildfs2rln p t4texoxrctydfaDeln s (  2triopiu1lm elfctl(fsrtm(mp;o0optnmoeilsfm2ra(vont)teerirctydlpDr i i s) 2xmir nudalenmicil() 2rm(rpno1aeen f3iltfaDrmnvp t)tlenxrcoodlate iesl(0t2umxo nydlpenmfvslt) 2rmur ;t4ape  ociad a eln sn(0arermf ia1fatrluvslt0 rxm(m3iydaltnlivt t)arur(  ;o4aetomfciys s eanmpnu0tlxrxr ty1fpD  ieslt trxm(r iy1amenlfvtl( sDtmxr no4tlx  oeiytfa ranvp;(0 ltoif3iydomt luesl() rxoxr oy1lptnlies sfa2ua(r ot1apxo f3iys a rmnvonu)trtrif todlaDr uvo t0srxmir3no4omtn net t  2taxr oo4tetn o3iydfm umuvs u) renmo3iytlm eluvi s)texrxmpiu4lm nlnei t  Dtmx o;o0tex mfciydla2elu o;u0aeeriocoa1fp rlu ils)trtriopiy4olt mnvi sf 2raur ;t1aeen fciasls2rl(mont0 eenxr oodfmDrluesls seuo(m nu4opeemfesls  Drmxr ;o4ape mictatfmDulnvonu0tltomfcta1oa  an s t)teuriopno1lpen ici t) 2umxmp;o4teeomf3ildfsDelumo;t)tlxoxo3oodfm rau s () 2xm(opiy4amtelnetls)s2rmx p;o1alenmietlsfsDemnmonu)treoirciydfmDr ueolt truriopnu1lleelnvtlsfs2umur ou0oetnif3ild m rmu o t) rxnmf3oy1op r ues;s0texrim3iu4opte fes tfa2tru pno1oexo oetydla2ran s;u)aleoiocoa1fm   uvs (0sexr(rpiodop nlnvta(f Dtau p;u0tetnmoeiys a2ranmp;u)tltomf iadop rlnes (0srto(m3nu1ape lfci (faDtrxro;t0aee mfcilt s eaumsnu0tltomr iodoa e n i t0sruo(m3ny4op nlnvtl() rra( oou0aeeo fetydfa2uluvo;u)alenxr3oydfpteli i;( texm(mpny4altemfvt ()srurxr ou4aeenmfciyd sDrl( sn(4aleomfcoa1lmDeanvilt)trtr(m3iy4optelivil() Dumumo;u0opxnmf3tasfm2eln o ()alerir3oadfm eanes s0t2uo(m3nodapeemivia(fsrrrumo;u4tet iictltfm2rmuvonu4teeoxfciytfpD  nvo (  2xo(r ny1aptelfcs t s2urxmp;o1olx ii3tyd s rln s;t4 ltomo iodfaDe nvo s)s2xo(o no1apenmnvil( a2uaxrooo1optoifetld aDel(vp t)altoxo iydfa ean s;(0trxmxmpoydom  mnvsl(farraur ;o4tpxoiociytla ea( o;(4arenioctodfatr uvi (  ruoio iu1lmtnlieia() 2taxmont4texomoetysfa umn o;t4treoio tydlm e uvi ()srtmxr nudop nlies t  Drmx o;o4aetoii3iadfa eau s u4tetomfciy1fmt ai s t setr(opoo1ape mivi ( arumumonu4aet io3iydfs2rmuvp;(0alxnmfciadfa  anvil(  rxr(o3io1aptelncils)a2trx pno0oleoii3iyd m rlnvsn(0teenmf oo1fmt  uesl(0 rxrio3iudlmt mfct (farumu p;t0oexomi3iatlsDemu s;u4 lxoio3tadlmD  ieslt)t2toim no1aleelivi s)srtaumoou0tlx if3iaslaDulnms;t0texrmo ia1omteluvol( sexrxo3oudomte ici tfaDtaur nt1altomociad aDelnmsnt0artoxf3iodfat ln s t0srtrio3iy4lm  mnct t artr(  ou0oltomoeilt a2rmnmpn()alxrxf3to1om  luvslt)texo(r iudoltemncs () Duaurpou0tpxnif3tysfs rau p;u0trxrxr3oytlmtelnvs t0s2urxo3nu1amtelfvtatfsDrr(root1olx  octatlaDranmo;t4teenircio1fmD ln o;s  eto(mpoydalt lnvi t aruru  ou4tpenioctatfs rm( s;u4altomfctotom e uvi;( s2urio3oo1amtelnet t)s2taxm ;o4tlx  octyd s eau o;t)texrifcoydlpteliei s sexoxrpio4aptemfvta(  2tmxmpoo1tlx mo3iydfmDrluvsnt) etoio ty1oa eln i;(  ruoxo3iy4ap   neslt) 2rrur ot1opxoiieiydla2ua(vo;(4 rxnxrcoytoat  nvilt0 2xrirpiydole  ieia( a2ta(roou1tltomfeiydfa2el(vont0 etoir3oadfaDrlnei t) exoiopny1amtnlnvt sf Dtmurpou1oexoifctlsfa ul( s t) leoxr3oydfa elnes t  etmimpny4oltnmnctls)arra(rp;u4tlxnmocias m em( ont)tltnif3tydlmtrlivslt  rtrir3no1lp   fesas arrm(moot0oetniiciasfm emnvsnu)tlermo ootop ran i t setr(o3oydlm e fvi tfaDrr(r ;t4tetoioeiatla uln o (0artnmrciotlaDeaivs t srumxrpiu4lpenmfcilsf Dra(rp;o1oexnmfetatfa2elnvsnt0tlermr tatom rauvsl(  rxo(o oudal nmfcils)s2ua(mo;t4olxomocild mDuaumsnt0 renxoctadopDraieo;s t2xmir nodol e neilt)a2ra(mpoo0aexnmictad a2uanvs;(0 eerifcoydoatrluvi t)trumxm3oydop n fctas)aDtrx ont4aet mieiysfa eanmp;u) rerif3oatfp r n o t  rxoiopiu4llte icsl(fsrraxmpnt1aex  ictldlmDrl( s;u0 rtrxr3ty1fp elneilt)trumxo3oydlpe  ivsat)sDua(  ;u4tetomoetasfm rlnvont0 exriocto1opDelivol()t2trio nydlpeemfes () Dum(  nt0tex iictlsfs2uan snt)alxoifcoy1omD ai o;( teurxr ny1apenlivsls)srum(ront0olxo fciytla2um(mp;u)aleoif iatlat  i s;s)s2toxm3iu4apt lietas) Dra(rono0tet iietys m em(vs t)texnifcia1oa ran i t0s2xoxo iy4lltelncils  2urum nt1opeo f3iad s ulnvsnt)aetnir oatomDeaneo ( teto(o3oo4lm n fci ( aDtmx  ;u4olxoio3tlt m2rlu o (0 renxo to1fp eaues t trumxo io1lptnlicta(f rrmuront0aetoif3iyt a2umu o;()artoif3tytlmD luvs;t0s2umir3no1oltnmietls sDua(mono0apeomieiyd s elums;u0 ltoif3iatlaDe nvi;()seuoxr ou1lm nlneils)sDur(mo;u1texomfciydla rmu s (0artnmr tydlm r ivol( srurxrpnodlpt mfeta()srtru ont1teto o3iyt aDem( s;u0 lxrxf3iotlm e uvilt s2trxo3nu4ll  mneslsfaDumxrpoo0tltn feiadlm2rau snt0 rxnio3tadopt livilt0truo(rpoo4al  mieiltf rtrurpoo0aleo i3iltfm2el(vs (4aetomr3oodfmt  nvolt0srxoimpnu4altnlfviltf rumx pnu4alxnmoeils m2rln s u)tltnmrcoytlpDeanvo s)sexoxm3io4ome lnvil()s2taur no1ape mociaslaDrmn o;t4alermo3todfmDeauvsls)s2ur(m io4lp nlivil() rtax  ot0oeeoiieiat m2el(vo;t4 rtoifcia1lat aieols0srxo(o3nudam   fcslt)sDur(  ou4tee mfctydfaDulump ()alerio oytfa elu o s  exoiopiu4lmtnlivsls aDum( p;t1tlx mi3ilt a2umu o;(0trtrir3to1opDe ieols0 2tr(m3iu1lmee ieiat aDtru  ou4aleo fetltfm um(mp t4arerio todfmD  uei;s0t2umim3iodam n nvilt srur(monu0tex iiciad mDra(vs;t4tltrmr3iytoaDeai o;()s2uoio io1amte iei tf Dtm(monu0ale ioctydls2rmump u)aetrmf ia1oa  li ol(0t2xo(mpoy4oltn fetl(  rtm(r oo4opt ii3tad m ranmsnu4alxoxocoa1fpt lneslt0truoim3oudlpe lnei sfs2tmxr nt4tet io3ilt m ulumo;t0teenmfciodom r n ols  rtmio ny4lptnlnvslt) Dururp;o1tltn i3ilt m ulnms;u)aeerxr3iatfm r uvo;s  2tmim3oudop e fcslsfsrtmu o;t0alxn ietlt aDra(vp;()aeerir3oodfp rluvo t)setrxo3io4ll elfcs tfa2tr(moou1oleomoeiltfsDumumonu0 etrio totfa eai il()setoxr3iudale  ics s) rrmumpoo1tpenmfeild s em(mo;t)trxrxociotoptran i t)trtmxr3iydlmtelnvilsf rur(m no4olen ictat s ranmp (4texnxr3ty1omte nvs;t  2tmxmpoo1opee fetl( sDrax  ou4oeeo f3iasfm2el( on(0altoio ta1opt  uvo s0 etr(r no4altnlfctl()sDur( pnt0tle mo3iyd s2uln p (0alxnxr oytlmDeaneslt0truoxmpnu4lmte fei () rtm( pno4tlt  feiaslm el(vp u0 eeoxfciotom r nvils srtoxrpoo4olt  fvsl(fsrurum ;o1tpx ioetyd mDelnmsnt4 etrmrciy1fpt aivi;(0 rto(mpoo1alt livta(f rrmump;t4aet if3iasfm2eaump;t4 exrmfcoa1lmtraivi t0s2toim oy4lp  lncsl(  2tmxmooo0oexn f3tadlm2rmn p;(4aleomf tydoa eanvi s  rxoxm3oy1amee ncils)arrrxm no1opx  icias s uluvo ()alxnio to1lp rau i;(0t2urir iudllen fviltfartru o;o4tltoiietltlm ea(vs (0 eeomo3ty1faD livolt0 rurxm nydomt lics t) Dua(monu0tleo i3iltls2rm(mon(0arxniociatfm   ivilt0srurxo ny4lpe  netasf rrmu pnu1aexo f3tadfs2ulu o;t)trxrmr3to1lp  auvo s0setmio3ny1lpte iei tfs2tmxrooo0aexo oeiyd mDrl(vpnu)arenmf3tydfa rli o (0s2xm(rpoo1lm n ncta( a2tmx pnu0opx  i3ilsfm2rm(mp;(0teermf3tytfp eanesls) 2xmxr nudamtnmnvt s)a2tm(m ot0apxn ocildfs ra( o (4arenio iodfpDe uvi;t  rtr(o oodopee nvs (fsDua( pot1oeen i3tysfsDelnvp u0 ltrif3iydlm r u s t  rxo(r3no4ll   nci tfsrumx o;o0teeomo3tys m ea(ms t4 renio3iatoatr i ol(0 2uoim3nodaltnlivtls s2raur oo4tltn i3ilsfa2ul(vp;t0 rtrmr iy1fp eaueolt0trtoxo3iydlm e ictl()arrmur nu1oexnio3iltlaDel(mo;(4 ltnxo3tadopte nvi;()texoir3nu1aptn ivtasfaDuax poo0texomi3iydfaDrm(vsnt)tlxrircoodfp r nesl() exmxopoo4apeemnvi () Drmuro;o1oee ioetyslaDea(msnt4 exoxrciy1oaDe ivs s texmiopiudol   nesl(f 2raxrp;u0apxn ietlslm2ranmp t) rxrxocia1faDelueo s trum(o nu4lltemnvsasf rraur ;t4tetomi3iasls2rmnmo ()alxrio oytomDrln sls0srxrir oy1amen ncs t) Duaur ou1oetnmieils aDrmnvp;()tetoxr3io1om r u il() 2urxmpnudal elnvt (f Duauro;t1alt iictadfs el(vont4tlenxfctytlpDelivi;t trtrxr ou4opte fvsas)s2tru o;u1opx mfeiydls um( o t0tleoxf3iotop eaies t0s2um(r3nudopen neias  Durx p;t4tpeo fcilsfs rauvsnu4tltoio3iy1laDrlu o t trtoio io1ale mncils  2ua(monu0tpen oetldls em( s;(0aexomrcoa1fptrlnes ( trtrxmpoo4oltnlfcs t)srrmu pot0apx  ieiydlsDemump;(0alerio iydlp eai sls0tetrim nydlmee ivtat  rtmur ;o0tle mfeiltlm em(ms t) leoxo tatlatean s t trur(r3nudll e fct tfarur(rono4ale  feiyd sDel(vp;(4treomo3tadoa rlu sls  2xoio3iy1altnmfvi s sDrmump;o1tetn o3iltfa emnmo;u4trxnmrciotla eaies t)t2urir3iy4llenmnctas) rur(r ;t4open oeiasfm2ulnmp;u0artnmf3iytlptrai s;t  2xmim oodlp nmfeslt) Dumx pnu0tetoio3tyd s2eauvp;u0 exrxfcia1lm raneo t) rur(r no4al nmfcilt s2uaxm nt4texnmietatfa2emumpnu4aetnmf oy1fmteaivs;t0texo(o ny1ole  fctl( a2ta(rpnu1texnmoeiaslaDua(mo ()artnmr3oodfpDr neil(0 etoiopoo4apee netl( arrmumo;u4apeniieiadla uanvo () leoif3totla   neil(0 eumxo ou4amtemncta(f 2tauro;t4opxomociad a em(vp;()tlermociy1fa rlivs;t0trtrir nodamenlictl( s2tmxmpnt1aptniocilsfmDrm(ms u4 rxnxf oa1lmteliesl() rur(o nodllt lfesltf Drmxr ;u1alt ii3tysfs2ua( o (4 rxnifcoa1fateau i t) exmxm3io1ol   iesa() rrruro;t1apx  o3iys sDrauvpnu4 etrxo ta1lat au i s) 2umio3iudlp emnvsat)srraum ;o4aptoifeias aDraump;(4artnmf ootlat lu o (0 exriopiudope  fesa(fsrtm(mpnt1apxn feiys s2rau s t)tltnmo iy1oat lnvi (0s2to(m nydal   nei (f Dtmu p;t4opxn f3iytls2ra( p u4arenifcoa1lmtrluesl(0teurxm3iy4ap nmnes sfsruru  ;o4apxoii3ils aDul(ms;u4tltomf tatoatraieils) ruoirpny4al e icil()artaxro;u0oltomfetydlmDeluvo;(4aetrxr oydfm ean olt s2toimpno4al emfvsl() Dtmu ono0apxnifeiad a ran pnu)tleoxo oodomDraueo s0srur(o iydlmen ici s arurur ;o1tpe  f3iatlmDrmums;t0 exoxfctodop r n s s0t2toxopoo1lpe  neil(f Dta(ronu4olenifeildfm ea(mp u4aeeomrcty1oatr i o;t  exo(r oodomenlivia(fsDraump;o0opeo fetysfm2ua( p;t) eenmr ia1faDe ueils) exmir3oy1am n neilt aDrrxm ot0oexnioctyslsDemuvs t4 rerxf3oo1laDe uvo s  rto(rpiy1om  mivia() ruauronu0oexn fciyd a em( snu0aexnmf3todlp   ies s0 2tmir3oydllte nei t)a2uaum nu4tpeo octat aDumnmpnt) ltrxfcoa1omt lu olt0texr(r3ou1am  lfetlsf Dur(r ;u1tptniiciadfsDemums;t0 lerxrcoy1fat lieils)s2uoirpiydlpe  ietlt)s2urumooo4ale mietyd sDelnvp;t)aeeoxf oa1fp ranvs s setmxopio4aptnlnetls sDur( pnt1alt mf3tldfs2emuvo;u)areomociodfmteaivs;(  2tr(opnu1aptn feias)sDtax o;u0tee mo3tlsfs2ran p () leoxo todoptelnvo (0sexr(r oudalenlfvil() 2rmu pou1oet ifeiytfsDrmumo () rxrmo iadopDraiei s)seuriopio4llt  neta()a2rrxm nt0aetoii3ilsfs2ul( pnu) ltrxocoy1latrlieslt t2xoxrpnodoltemfviltfsDur(ront0apxomi3ias m2uan p;() leomf3ty1fmD ai s t  rtrxopoy1ll nmfes (fa2ta(  ;u0openii3tlslmDel(vo;(0 rxnxrctodfaDr i o;(0sexmxopio1lp e fviasfsDrrx p;t0tet miciytfs2rau s t0alxrif3ta1lpt anes;()t2triopio1ome lnesl()sDta( ono4tltnmi3iydlaDem(vp;t0 ltnmo3to1oaDraueilt)setm(o3iodam nmnei tfsrrax  ;u0tpenio3iytlaDean o;u) eerifciytfa r uesl(0seurxm oy1om nlnetat)aDurxront0oet  icias aDemu p (0trenxr totfate uvo s) eurim3oy1lp nlnci (  rumx p;o4alxoif3ias aDumnmo;t0trxomr3to1lmtrai s;s0s2urxm iy1ll   neiasf 2ra(ro;u4ole mfetldlmDelump;t0 exrio iotoptr uvi ( t2tmxo3oo4apte nct s) rtaumpot0ape mieiat sDrlnvpnu)tltnxo oy1optrluvs;()t2to(m3oodlltelfviltfsrtrxm ;t0tet  oeiyt mDua(vs (0tltomo3iodfmt anei s)s2ur(r ou4apt livtls sDtmumo;u4olxo ictas m2elnvp;t0tlermfcoa1lmt an i;s0seumxr3nydamt mfvslt) rraur no1teenmfetasfa2rm( onu0trxrmoctodfpt lu slt0texm(r3ou1aptnmncs sfsDra(rono4tpeomoctyt s rau p u)tlxnifcoa1lpt lieo (  rtoimpoy1aptnmnesas a2uax  nt4altomi3iytfa2rmnvsn(4alxnmo3tatomDrlnvsl()trtmio3iy4altemivils s2ururp;t1tle  i3tld m rmump;()trtnmfctytlaD au s;s0t2trxm3nodlpenmnctlsfsDrmx p;t1ole  fetysfs ra( s;u)trxnxf3iadlmte uvi;()setoxo3iodomtnlfvsl( s2um(ro;o0olxomieiys m rau o u) lxnio3ootlaDeauei t srxmxo3oo4ol nlfct ()arrmurpoo4tle mfciytfsDumuvsnt0 etnmf3tytlaDr n i ( t2xo(o io1alenlnctls)sDrru oou0olxniietasfmDemnmsnu) exnxr3to1fmteln s (0t2urxr iy1altelfvs s)aDumurono4ole mociatfmDel(mon(0texoio ty1fptr ieilt t2um(mpoydom  mictltf Dra(mpnt4alt mf3ils s2ranvon(0alxoxf3oatfmD lieslt0 2xmir3iu1lmee iei s  2rmum nu1tpenmicias sDemump;t0aexnir3iy1oat lu
\ No newline at end of file
@@ -0,0 +1 @@
+ueo t) ruoim3iy4ame liesasfa2tr(r ;o4oeeoiieilsls ua( s t4teerirciodlaDraneilt0s2to(m iu4lmtnmfeiat s2umuro;o4oeeoioetyd s rluvo t)trxrmo3tatlmtelieils)srxrirpiu4om emfeilt s2ur(mpnu1opxn ociadfsDeanvp;u4tetoxo ia1opteai i;s) exmxr3io1altnmfct s) 2rrur nt4texnmi3iyt m2umu s u)teerxo3tytlmDe u o;t) 2tmxr3oy4lpee nvi s s2uau o;u4opx moeild sDuauvsnu4 eenio iodlp eaueo t0 rtrxm3nu4amtemfcslt s2taum ;u4opxo ieild mDrl(msn(0areoircto1fa  livo;()truo(mpno4llte nes s arumu  ;u4olxnmo3iad mDrmuvp (0 renmf ty1fmte nei ( teurim3iudop  lnet ( srta( poo1oltn ociltlsDem(vo ()arxnmocoodlm rlueo;t)s2tr(m3nodlmenmneia() 2trumpou0opeomieiyslm rmu s;(4 rtrxfcia1fa  lnvols0 2xmimpnydol nmivi ( s2tm(r nu0opxomocild mDrl(vsnu0tlxoir ty1opteanvo ( setoir3oydape mivsls  Dtmxmpno4tpt mieiatfa2um( p t) exoif3todfpDrluvsls) 2toio3nodllenliciat)sDtmurp;o1oleoif3tas s el(vs;u4arxrmf3ootla rauvo;()tetr(r nodopeemfeias sDua(  ;o4oetoif3ild mDeauvsn(4 exnir3ootfpte ivo;t texoirpoy4aleemivi t)s2ua(roou0olen f3iasls emu o;u4 eenifcoadom  an i t0sruoxr3ou4lmtnmncs tfsDum( ont0oltoif3iytfaDuau o t4treomfcoy1fpDrlneo s0sexm(opoo4lptnlictat)a2rm(rpot4opxniociyd sDrl( p () exomr3ootlpDr uvs s0 eum(o oudopte ncsatf Drr(rpnt4oexnmieiytlsDranvp (0aexrxr totlatr ivs s0srxr(rpnu4omeelict sfartau p;u0tlxoiieiad s uauvonu4 exoirctadfa raues;() etrir ny1ame micslt  Dtaur nu1optomo3tlslm2uau on(4artomo oadfatelivslt)teurir3oodolte ivt () 2taxr ;t4tlxomf3tasfsDuanvp;u4 rxoif io1oa  liei s0s2xoxm ny1lpe lnet t sDumuro;u1olenmictad mDea(mp;(4 eerifciodoptrluvolt setmio3ou4lp  mfcsasf rtr(mpot4teenifcilsla ra( ont0 ltrmf tydfmD aivs;s0truoio ou4op nlnct s a2urx p;u0aeto o3ildlmDumu p;(4texnmr3oytoa e n i;() exrio oo4lleemfvilt)srurur oo4oet  i3iat m2rlnvo (0 lenmo3oo1lp rau o;t sexo(r3oo4lpt  ncil( srurx pou4tpeoio3iyt sDum( s ()aetrxr oo1oa eln s;t0teumim3ny1omt  neil(fsrumumont0tptnio3tyd a ua(vpn(0 lenxo3iodomteaneilt0t2xmiopiu1apenmiei (  Duru pnt4opx  feiydfa2uluvsnt4tleoif3oo1oaD auvi s0 exrir oo1lmtnlfcilt s2rru  nt0aex  ietls a raums u)aeeoio oodfatr ieo s)s2toxo oudam nliet sf Dua(r ;u0tetomfetlt aDrlnmonu) rxrirciydfpDr uvs (0s2toio nydlp n ivsat  2trxrp;o0tpeo ietad s umnmon(4 eenmf3iadfat ln ilt  etmxm oodlp elict (f 2taurp;t0alen f3iadls eln p;t)teerircoa1omDraies t) rto(o iu1aleemfvtat)aDrrxmont4opx ifeiyt s uaumo;u) rxrio3iy1latrlieo;( texrxr oo1alt miei (fsrur(mooo1aexo f3ias s rl( o;t4 ltrmociodomDeai ols)t2xrxm io4ape mnvias s2ua( pnu1apxoifetlsfa2rln o (4alxoir oydfmDelnvs (  exmxm3oo1oleemfeilt  2umx pnt0apx  ociatfm2elnvont4aleoxo3iydopDeai s;s  rtmirpou4olt lfci t  2raxr ou1ole mociyd m2rauvs u)aeenioctytopD lnesl(0srurxm ny4olt miviasfa2urxr ;o4aetnmi3iyd s2ranvp;t0alerir3iatom rau i;t0 2xmxopoo1al e icta() rtmu  ;o1oee mictasfs2emums;(0tetrirctodlp elneo;t0 2toxm nudomeelncslt) rtrx  ot1oeto oeiad s2ea(monu4 lxnxr totlmDrlu o s0 etoim3oy1lmtelnvtl(  Drmx  ;u4alxnmfeiydlsDrm( pnu0 eeoxfctodom  livols0teuoxr3io1llenlnvt t srrrumonu4teeomieilsla raumpnu)alxnxr iytoa   u i s)tetoxo nu4apen fvt t s2ta(rpnu1oleo feilsfm em(ms u)tltoif ootlmtr u o t  2tm(m3ou1opt  neslt  2ur(moou4ope  iciyt aDua(vsnt0 etoir iytfpt auvols)trtoimpoo1llt livsa(fs2trxm no1tptomietatla rauvpnu)alenmo3oodla eluvi;(0trtr(r oodlm emivi t srraurp;t0olt io3iltfaDranvs t4trermrcty1lpte ivsl(0sruo(o oo1lpt mfes t) Drm( pou4olxnmoetatlm uan o (4 rxoxo3oydfmD  ieo;()s2xoxm ou4om elfeil() rtauronu4oexoifctltfsDrm(vo u)areoxr3ootlatrau i;s)trxmim nu1lptn nctl(f 2tax pno1oltoioeiaslm2ranmp;u0aetrirciodom   ivs;t)srumio3oy1al nlfvia() 2rrur oo1oet  ieildla2eanmo;()areoiocoytfmDeln i;() rtmirpoodllenmiet sf 2uaurpno1texomfeiltlm2elums;u0alxoxociadfatrauvilt0sexrxr io4ape lnetl(f Dtrxm ot0tpeoif3iadlm2emums;()alxoir ta1omte ueol(0s2xr(opoudome  icsa(fsrrmx poo0oeen iciytfaDrmn on(0 lxoxf3ty1faDrliei;(0trxoxm3oy4lptnmivias sDrrurooo0oexo fciadfs rl(vs u0aetoxrciydfmDeaivo;(0srxoxrpio4lme  nei s) 2rr( pnt1apxnioeiatlm em(mp t0tetoxfciytfp rlieolt0 2xmim3no4lptemfesl(faDtrx pot4olt  ociytfa ra(ms;u0teeoio iy1fp  li o s)srum(opiydoleelivi tfs2tmumpnu0oltnmo3iatfm2em(mo t4 reoircio1fpt  u slt tetoxr nodllenmfes tf rta(mooo1oleo f3tys m ua( p (0arxniociytfmDr nvi;()sexoiopoudllen neiasf Dtr(  ;o1apenioeiad s2ul(vp t0trtnmfciodoaD aies s t2umxm no4omeelictas)sDraxmpnt0oexnifetys s2emu ont)tlxnxf to1fa r ueo;t)texr(m3nodlmt mfvt sfs2ur(rpou0ole ioctaslm um(mpn(0alerxrcoodom elueolt0s2umir3iu1op nlicsa( artrxm ;t0oleo oeiltla2rm(vp t0 eeniociytlp e uvo;t)setm(mpoy4aptnlivs t  Durx o;t4alxoio3iasla eluvs u0 eeoifcoatlmDr nvi t)srxr(o3iu1lm  lfeilt)srtm(mp;u0tlen o3ilsfa umnvo t4 rtrir oytoaDr ueil()trurim no1op e ncslt  Dra(r ;o4tpe  ietlslmDrmu o u4aexoxo3oodlate uvolt0 rurim3io4lleemfcsa(fa2tr( o;t4oeen oeiatfa ra(ms u) rxrxo iotlmD  ues t truoim oydapenlfetls) Dum(r ;o4oexomieiadla emu o;(4 lermfcootlmteluvs;t) exm(r3no4lpen ivtas s2rau oot4alen feiltfa2um(mo;(4 leoio tydoaDraieo;( t2trxm3iodlpe mncsls) Dua(mp;u1oleoifetysfa2eanmpn(4aetrmrcoa1fmDeln olt0seum(r3iodap  mfesl() 2tm( pou0oee micild m umn p t) ltoif iydlmte u s;()trto(m io1omenmivils artaurooo1tpxomoeiytls ean s;t4teeoif oy1fp r uvo;t)srurxr3ny1alt lneil(fs2raxmpot1opx  oeiysla rlump;u4artnmr iotfaDranes s  eur(mpoo4opt lfeiasfa2trumpou0ale mfctlsfs ea(mp u)alerxr3todlaD aiei t  euoxmpnu4lptnlivsat) 2rr(mpnt4aet ioctatfsDrauvp;t4 rtnmo3to1opDr uvo t)s2umirpiodlptnlnct t s2trxr ;o0aetomf3iad s rl( o;(0aeenxr tadfpteluvo;s) etrxr no1ome lnvt t) 2ua(mpou0opxomo3tadla2rl( o;(0artrxr3iy1lmteln o;(  rumxmpiydomt  ncia()a2uauro;o4alt if3iadfm2uanvp u4 lerxr3tadfpD anvs t)s2xmim3iu4olt  netls aDurumooo4oetoifctlt aDuanvs u)areoioctatfaDr i ol()trumim nodlltnmictas a2rm(m oo4tetomietad a rm( snt)alerxo tydfaDr neil(0srtrxrpiy1amt lnvs s a2tmxmonu1opx ifeiys a rlnmo;(0 lxrmo3oo1om rau olt)sexmxrpiy4altnmnvsa()sDurum no1tlx mi3iydfs rm(mp;()artrmr oo1fa  aiei s)t2urxo oydamenlict s s2rr(roou1tlxomfctytls2rau p;u) leoxo3to1faDr ieslt) 2trxm3nu1lm  mfet ( aDtr(  oo4ope mfetyd aDemuvo t4 renxo tytopDe nes ( t2urxo iu1lmte nctat srrmx poo4aexo feildlsDuluvsnu) rxomo3oytopD aivilt)tetoio nu1ome  ivsas  2tr(  ot0opxo o3taslm2rmu p;t)trxrifcoa1laD  u olt trxoimpiydamenmfctls) rrmu  nt4aet mf3tltlm2rmn onu0arxrif tydoa eli s;() rxoim iudameeliet sf 2rrxroot1oleo i3tltlmDrmnvp;u) exrmrciodfp e nvi (0seumxr3nodoltnlnet sf rrr(mo;u4apt  f3iad sDul(mo (0 etoir3oodoa  auei (0 eumirpou4opt  fvt s)srtmxr oo1ope if3iad m uauvo t4tlxnxocoodlaDelivsls)t2xoxo3io1opt livt tf 2umxmo;t4apt mi3iadlsDumump (4 etrxf tatfmtraues t0 2trxm3no1oleelietas  2tmumonu0oleoii3tytfaDrmnmp;t0 leomfctodfateluvi;t0t2umir ny1omen netatf Drruro;t1aptn o3ilt sDrmums t4 ltoifcio1lpDe ueil(0 2xrxmpou1omenlncil(fsDua(r ;t1tetn f3ild s2emnvpnu)aetrmo iydoa raneo t  2tr(opnodal elncsl() 2rrxr no0aeenmiciytlsDrmuvs;t) lxrif totop raueo;s) exoxm io1al nlncil()sDrmumonu4tleoif3iatfm2um( o t0aleoio3oy1lmt  u o;(0sruo(opiydaltnmnvtat)aDumxr ou4aee  oeiadla2rl(vonu4 ltomocio1fpt lnvi s0 2um(r oodomee iesat)aDrru ono1tle mi3tls m ulnvon() lerxr oytla ean i (0 etmio3ou1amenlncsl(fsrtmum oo1aet ifeiatfmDrm(ms;(4 etoxrcoa1fa rln i;s trxoxmpno4llte ies s)artaxrpnt4ale ii3ildfaDrm( o t0teeoio3to1opDraivs;(0sexo(m ou1apeemfcta()sruaum ;u0olx  ietld sDra(msn(0treoif iodlatr ivilt0 rtr(o3io1ol e ivsltfa2urxro;o0apt mieiadls ea(mpnu0texnmr tatop rlivslt0s2umio iu1lp elneilsfsrraur nu1aleomfctld aDrau p t4tltoxrcoa1fp rau o;t0seto(mpno1olenmfvt s) rumu p;o1altniieias a2rm(vo ()tleomr3iotfmDeauei ()srum(o oo4ope  ncta( a2umxmono0tpx iieiatfmDumnmp;u4artomrciydomDe uvi () rtmxm no1lmt  nctl( srrax p;u4tpx iictydfaDeaumsnu0 leoxf3tatoa  luvilt  eumxopiydomee netlt) Dra(rooo4tle  fciydfa2umu p;u4 rxnmr io1opD lies s trtmio nodom elnct s)aDtmxrp;t1apt  fetadfaDumn o () ltoir iadopDrluvs t0setr(opoodlp  lfctltf 2urxrpno0tex  ietldlm ul(ms t0 ltnmo3tydlpDeli il( srumxm3no1amt lieta()srtr(rp;t1texoioeildls2ua(mpn(4 rtnircio1op elneils  rxm(mpoy4lm nlnvi ( arurxmpoo4open ociatlm elnvp (4aeeoif3tytfat li o () 2xmio oydlmte nesa(f Durxmoou1tlenmoeias a2rlnvp;u0alenmrcoo1oa  ln s;s)s2toirpoo1alt lictlt)a2um(mono1altomf3ilt mDulu sn() exoir iytlm eanvo;t  exo(m3oodome  nvtls a2uaxronu1aet iieiysfs em( p;(4tltnmf3to1lmD  n ols0s2xr(o3no1lp emfcs s s2uaumono0oexo oeiydls2eau o t0 eeoif oa1oa  auvsl()trum(opnudal nmnvtl(fs2urur no4oleoioeiadfmDuanmp u0altomrctytfpteanvo (0srumxo io1ol nlfcilt a2trxrp;o0aexnmf3tyd aDrlu p;(0tltnmf oytomDeau sls0texoio oudal  lneiatfaDrr(m nt0tpeomi3iyslm2ean ont)teermf3ootlm elneolt trtm(mpnu4am e fetl()srum(m oo1alen ictat m rl( s u4 eeoxr iadfa  an s t0t2xr(o iu4am   net t a2um( o;u0aeeniiciasls2rlnvo;t4 lerxo oodom   uei;() rxmxm no1optelfetas)srumxr ou4apxoioeilsfs2rluvsnt4trxnxf oatfpD  uvol()teuo(o nudlmtelivt tf rum(r ;o0olxn ieiad m2eln s;u0 lenxfcoy1la rln olt0srurxo3oy1apen fviatf Dumx p;o1oltoio3tat m2elnvp;t0areoifciodlp rlnvilt0 rtrxr oudam e fetat srra(mo;u1tee mfciytfs2rmump;t0tetrio iotlm  aivs;s)trtrxo3no1lpeemivi (  2ra(ronu1aee ifciatlm2umnvp;u4tlxomfcootfa e ivs;(0t2xoir nudom emfeia(fa2rr(moou1tleoifeias s2um( p ()texoir3oadop e nesl()t2toxm iu4alt lfesa()arrax p;o1texnmf3ildlaDran s;t)altrxrctotlm   ieo s0 2trxo3ny1optelnci t)a2tm(rp;o1oee iociatfaDuanmsnu4 exoir tytoaD anvi;(0t2umir oo1lme mnct tfaruax  ou4alx mieiltfa2rmuvpnt)aexnmf3iodfmtran o;s0 rumxm3nodale mnvtlt) 2rm(rpoo0apeomoeiyt s ua( s;(0aeermr3oodoatraieo t)s2xo(r ny1al  licsas s2taurp;u0tpx ioctld a2rau o;(4aexoxr3to1fp eai slt) rto(mpou1aleelivs s  ruauroot4apt mf3iytlm2rluvo;t0tlxnifciydfp raneslt  rtoxrpou4ap nmfeiasf 2rm(mp;u1tpt  ocilsls2elumsn(0trtrioctytop elueo;()srumxmpoydlm  livsltfsrtmx oot1aptn f3iytls elnmo (4texrxo iytlmDr nvi ( srxrxmpio4apte fesasf rrru pno4tltomfeild sDumuvon(4tleomociydoat luvsl(0 rtr(o3oodal  lnesas)srtau oot4apeo f3iys m uanmo u0texnif tatlpD lu i;t)s2xm(rpoudaltn ieslt aDra(r ;u4ope  oeilsfa2ranvp;t0 lxoifciydop r ieil()tetm(m3iodom  mfvt t a2ta( pou4oltn o3iasfsDelu p t0 renio to1fa eli s;()t2tmio nudomtnlnciat)a2tmxm ou0opto i3ias s em(vo;u0 exoifctotfmtrlu s ()tetrim3oodol emieias srraumooo4apt  o3tydls2emuvo (0teeomocto1oaD ai s t0teum(m3ou4lptnlnetl() rta(  ou4opeoiietydfm rau p (0alermoctatlaDrauvi;t  2toxr3oudll   fesa(f 2ra(ro;t4olxo octyd s uanms;(4texrircia1opt  nvi;t  2uoir nudam e ivsas) Dtmurpnt4teenif3iysfm em(vont4arxnmociy1oa rlueo;s0s2uoir no1ll  mietlt)srtmxmpou0tpx ioeiyt sDulumon(0arxnmo totfm eln s t0 rxm(o3nu4om e fctl(farumur ou0oltn fctys a2ulumo;t4 exnxocoydfmD aueils0 rtr(opiu1olen fesltfaDrauro;u4aetomi3tldlm rmump;t0aexnxocoatoaD lneols0srxo(o oy1al nlfci sf Dtrum no4alt  i3iyt aDraumpnu4artnir3iodfm rau slt0s2trxopoo1aptnmfet t s2ra(rpnt4aptn ociadlsDrm( p;t)tlenxo ootlmt auvols  rumxr3nodom elivsl()s2umu p;u4tltnmi3ild a elu p;t0 reomo3oydfateai s (0 2xo(r3oydam e ict s)arrmumooo1tlxo fctldlm2uau o;t) exnirciadfa  aivsl(  rxo(r3iy1ap n fvsatfsrurumpnu1aex mo3ilt m2ea(vo (4tlxrifcoa1lpD luesl(  2xr(r ou4apt  ictltfsDraxm ;o1oexniicilsfm2rm(vo () ltoxr3ootlmteanvsls0s2tm(mpiy1om  mnei s aDuaurpno0apxo feiasfmDel(mpnt4texrircoa1opDe n s s0 2uoim iy1amen fvias  2ur(mont4aeto oeiyslsDum( snu0trxoxo ta1op raieo t0tetmiopoo1altemivil( s2tmxro;o1apxn oetadfa eln pnu4 eerxr3totom rlivsls trxmxo3oo4amtn neiasf rra(mooo4aee mfciydlsDrlnmo u) ltrmo io1lp e neilt0 2xm(m3iodlmenlfcsa() 2tmxr no4apxo f3tls a rau s;t0texrmocoy1optr i s t t2uo(m nu4lmeemnvi t aDrru pou1apto fciasfm2eaums;(0tltoio iy1fmtr ieo;t srxo(o iu1op n ivt sfs2ra(ro;u1aptn ociysfm2rm(vsnu)tltomf3io1fp r neo t)sexrxo oydalte ics s  Dtrumpoo4tpe mi3tyd a ra(von(0 lermo3oadop  aiei;t) 2umir3iudlmeemnei (  Drmu  ;t0tlenmo3tls m2rm(mpn()teeoxociydom r ieil() exrxrpoodapt liesl()s2urx oou1oexnmietld a elnvp;t) lerxo oo1opt an s () 2urxmpnudoptnlfcils  Draxrp;u1aetnii3tadls ulnmsn() rxrif3tytfaDelivi s0seum(o oy1lpte fctasfsDtm(  oo0aetoiictyt a2rlnvo (4 rtnxf3ty1omtelueilt0truoxm3io1amtnlivt tf Duaurp;o4oexo o3tys aDum(vp;t) rxoir to1lp rli i s)srum(mpou4al elnes ()arrmu  ;t1alxoiociyd a2em(vo (0 reoircia1lpt  nvo;( setoim3no4optelncsl(f 2rr( oou1oetoifeiydls rm( p;() rtrxo3tadoat lu s s)texoir3nu4olte ivtas)aDraum ot1tex  ietad s2elnvpn() lxnxfciatfptrauvi;t  2xrir iu1lm nlnesl(fsDra( pno4ape ii3iltfm2rl(vs (4 etomf3ty1fatrlnes;t0setoir3ny4amtn nci tf 2taum ;o0oex  ieilt s um(vs t4aeenir oytfp r nvil(0 2xm(m3oo1ome  ietltf rtmx o;t1oexnmo3taslsDrmumsnt) reomr3iadfp rlnei;t0s2xr(o3nodopte fesltf Dur(m ot1aetn o3iydla eluvs;t0tlenxrctadfmtr u sls srxoio oodlp n fei t  rtaxmoou0alxoifeiltfs uaums;(0tlenxr3io1optrauvslt  2tr(o3ny4llt  nvsa(  2rrxmono0aeeo icild s2ul(ms;() reoxo ia1oaDe nei;() 2uo(m3iudlltn iesl(faDurxr nt1alt moctysfa ea( s;u) ltomr ia1lp   nvs t trtoimpiy1altnmnvs t  Dtm(  nt0teto fetld a2uanms;(0 ltrxrcio1fmte nvi;s s2xo(mpoo4altelivs s sruaxr nu1apxoiociyd s2um(mo t0 eermfcoodlat  i s;s  etm(r3nu4al emfeia(f 2tm(  ;u4ale  oetasla2rau pnt)tleoxo3ta1om eauvo s0s2xoxr no1lp emfct () Dtaumoou0oeeo o3tlslm emnms;()trenmfciytlaDeauvslt setm(r no4lmtnmnes ( aDua(ro;u4aexo i3iasfsDel(mo;t)tltnxoctatla rlies;s  2ur(o3oo4alt mivs () Drm(  nu4oexo ictydfa rmu s;u0teenmocio1fp e uvi;t0teumxr3no1lp n ivsl()s2ra(mp;u1altomfctls m2ua(ms;u)aetoifctatlp e nes;t)t2uoiopiy1op nlivi sfsrrm(r ;o4aexoifciltla ulnvo t0artoxo3iadlmDelu s;s trxo(r iydop e fvia(fa2tr(r ot0apeo f3ilslmDemnvs;u4trtnmrcto1fatrlieo;s sexo(r iudape lnes ( artr(ro;t4alxnmicildfs uln snt) rtrmf3oy1om  lieols)tetrxo3iu1lm nmivtl(faDurxrpoo4ape iiciadlsDem(mp;u) eenifcootomDeli s t)trtriopoudlltemnciltfartrx onu4apeomfciatlaDrlnvp;(0aeeomf3ty1fpD li s (0 rxoxm3iy1ap elfcs t)artmumont1ape mi3iad s2emuvs;u)artrxocio1fmD aneolt s2tmxo oydoptemfcsas  Dur(  ou4tltnmoeiysfs2um(mp;u4aetoio iadomDr i i;t)s2xrim3nydalenmncs t)a2tmumo;t1alxn o3iasfmDuaump;()tlenio ty1lpt lueo;s t2tmio io1lmenmnei t) Draxmp;o1aetnmieias a rmuvs;u4aetnir3tadopt aiesls)sexo(rpio1lltemncias) 2uax pot4tle if3iltlaDuanms;t0trxoxr io1oaDr i ols)seurir3io4ope lfvi s)srtmx pou1aetnmiciytfs2rln o u)aetnifciy1fmte i i ()srumimpiudameemivtlsf Dtmxr ;o4alenif3tlslsDulumsn(0trtrmf3oa1laD au ils) eur(m nudam elfcs t)s2rm(monu0optn f3tys mDuluvs;u4alerxf3ootfmD au s () 2toiopio4lpe mfctls sDtrxmo;o4apt  ociyt a2uanmp (0aleoxfctytfpt  ivolt)srxr(m ou4am elivsltfaDur(mont0ope ioctysfaDrlnmo (4trermr3iatfptr uei t)srtmxm oudol  lict ()sruauroot0apxnioctadlm rmn s;u0arxnxfctytlaD ln sls0s2uoxrpoy4llenmnesasf rrrump;t1oee iictydfsDran p;t) lenmfctodfp  lu ols)trtrxo nydoltemnvsas)aDrrxr oo4altn i3iytfs2rauvsn(0 exnif oa1fmteaneo s)s2trxm3iudol  mieiat)aDurum nt0oleo oetldla2em(vonu0teeoif3ty1lm  livo;t0 exmim3oy1alee ncsls) Duax pnt1tlenmo3iysls2eanms t0altoxr io1omt  nvi s srumim no4amee ictl( s2umx o;o0aetn iciydla ulnmsn(0tleoxo3tadfat livo;() 2trimpnu1opee ietl( sruaumont4ape  fctat m rauvo (0 lxniocoatla rln o;s  2trxopio1ol n nvilt srtau onu0opx  ociysla rmump;t) rermo iodoptrli ol()s2um(opoodlmtnlneta() Dum( pnt0olenio3tldfm rm(msnu0arxoxr tadfmtrluvilt0teurxm3nu4apt mies s a2urxrpoo4ole  ieiltfa uanmp (4 rxrmr ty1lp ranvsls0 eurim3oy1ol elicsat  rtmxmoou4tex mfctldla2um(vo;u4tlerircty1om rli sls  rxmxmpiu1lptnmnvta(  Dtrxmooo4tptnioetytfa2ra(vo;(4 rxrif3ootlmtelnvi;()trtrxopiodap elivs tfarrr( ono1aet iictatlaDrmnms;t)texrir3oo1optraies t srto(r oudoptemfciat aDtrxro;t4aleniieiys mDeanvs t)alenmr to1lmDe u i s)sexrir3iydll  lfvta( arur(  ;t1aleomfeiytlaDul(msn(0tltrmocoodfa  aieils  2umir3oodaptnlncsls s2ur(monu4tlen fetltfsDulu p;u0aleomfcootoa   nvi t0 2urxo3nodlm e net s)aDur(rooo1oex moeiysla2uan p;u4artnifctydoatrln sl(  rtmxr3iu1lmte nvia()a2ra( pnu1tpxo octldfmDem(vsn(0tlerio ta1oat  uvs s0sruoxo3nydal nlncil()arua( p;u0opx mfeiltfa2ea(ms t) leoxf3tydoaDrauvs;s)tetrxm nudaltemnviat)aruax o;t4tltoii3tld a2el( sn()altrmf to1lm   i i t)trtr(r iu1alen fvt s sDurx pou4tee miciltlm uanvo;u) eenir to1lm  anes ()sexrxmpio4lpenmfvtltfarum( o;u1aleoiieiytlsDrmu s;u0aeermr tatfaDr n s;s srtrxmpou1ome miesl(fsrua(  ot4optnioeiyd m2umuvo;t)teeoxo iytfpDe ueo t0trxr(rpoudam n ies t)arua(r ot1tlto fciysla ulu o (0tltnxo3iotfmDelnvolt) rxr(opiodomeemictat) rrm(mo;u4tet iietlsfa ulu snt) lermrctytoaD  nvs;t)teurim3ou1omeemieil( arrmu p;u1teenmoetatlaDumn o;t4aetrxo3tydlpDeanei;t srxmxm nudamt  fcil( aDtaxrpoo0ole mieiat a2rmn pn()teenir iy1oaDr nvsls trxo(m no4ol  lictlsfa2ururpnu4apxn fctld s rl(mo;() reoxr3oo1opt auvolt0seum(o3io4lp  lietlsfsDraurp;u1olxnmf3iadlm2umn p u0aleomfcoytlat luvolt0truoxr3iu4alt mfei sfaDrmxrooo1tlen ictydlm2elnmsnu)texrxr3oadlp e ivolt  2umim ny1lm  mfvsa()aDtmumpnu1aleo ietat sDeluvs t)aetomf tatlpDelnvo s)setm(opou4lmt lncia( sDtm(rp;o1teto f3tadlmDuauvo t)texrxr3oa1lpDr nvi t  eur(r ny4aleemivilt  2rr(rp;t0tpt iocilt m2uan o t)tetnir3tytlateln s s0truo(o3iodom elfvsltfsrurx pno1tptoio3iltls2emnvpnu0 renxocoytoaD lieilt0 rumxm3ou1omee iei t a2rr(rooo1tlenifcild a2rlnvs;() etnxrcty1optrai i;t0seuoio3iu1ape  nei tfsDuaum ou0oetoif3ias m2em( o;(0aeenmo3oytomtraieol(0s2uo(r3oudom   ivta()srum(monu1tpe moctyd m uaump (0 lxoio3oo1fpDrau sl()s2tmir ny1lp  mncs (fartr(m nt1tpxnmfcils m2rmn snt)trxnxfctydlpD lneslt0 rtoxopiu1op   ncsltf rumur no0opxnifciadfa um(ms (4treoxociadfm eluvi;s)t2umim iudape lfet tfsDurxm no1tlx mf3tltfs rl( o t0 lxoioctotlpD  ueo s  rxr(m ny1ale mfcta()sDtm(rp;o0ope  feiytfs2emnvs u0trtnxo3oa1opte ueo;s) 2xoxm oo4al e iei s)aDumur no0oetn ieildfmDul(mo;(4 rerir ia1om e uvs;(0s2xmxopiy1ap emictl( srrrx oou4tpt iociatlm emums;t)aexrxo oadomDelu ols trum(mpiudoleemfvi t)a2uaxmpou4oex mictatfs em( pnu0 rtrxf io1lpDranvils0 rxrio ny1ameemnetl(f rururpnt1ape io3tadls emnms ()trtnif3tadopDe iei;()t2xm(rpiy4lptnlfci s  rumu ooo0tpen ieiatla em( sn(4arxnxocto1fm eaueo;t0srurim3ny4lptelfci t s2ra( o;t1opxn o3tysfs ulu snt0texrmfcia1lmD aies ()setmir3iy4lpeelnetls aDum( o;o4tleomietas aDulnmp;t4 exoxrctytoptrli i s)trtoim nodll emfvias) Duru pnu4aet iictltlm rmnvp;t)alxrmrciytlp elivo t0srtoim3io1ame lfcs tf 2rm(rpno1tpenioeiad m umu s;u)texrmo oadop   ieo;s)setrxmpoodlpe  fvia(f rtmxrpnt4opx  octls m2ran p;(4trtnirciotfaDraivslt) rtrir ou1lpte nvi (farta( oot1tlxomietys a rl( onu4arenxrcoo1oa elueo s sexm(o3iu1llen nciltfa2taumpoo0tptomoetatfa um(vo;t)areoio oa1fmD au ilt0srxm(m3ou1ol e ivs sfsrta(rp;u4apen fctld a2umnmpnt0 etoxo iatlate i olt t2tr(r3iy4alte nci s artmur ;t1oex  feiatfs ran p (0altnxociotoaD  ivs () rtoiopoo1am emivsls)s2ua(rp;o0tltn i3iydlmDem(vo;u4arxnmocio1fm rli o ()srurxm3io4omt mfctlt a2tru oou4oeeomietat m ea( p ()altrxocia1omDe uvs;s0s2xr(m oo4lltn fvi tfa2taxr ot0tpxomictasfa2rlnvont)aetrifciadoaD anei () 2trio iy1openmivtl(f rur(rooo1alxomi3iad s2el(ms t4tltnxfcoo1faDeaneilt  rxo(opoy1lptnlnct (fsDrr(m nt0aptoii3ias m eaums;u0arxnxr3tydfmDrauvslt)trxr(r iy1om emivsl(fsrrrxro;u4ape iiciyd m2uau on()tltrxrcoa1latrauvi;() etr(r no1am elieias srtmurpno1oeenifetlt m ea( s;u)alenxrcootfmDr ueo;(  2uoxmpiu1ope  fvtas) ruau pou0apenmf3iyt m umu p;t4aetrxf iytfat an i t0tetr(r no1alen ies ( srra( p;o0tpeo f3ildfm2rmuvs;()trtnmocoy1fp e n slt0srxoxo nu1ope  nes (farum(mpnt0tex mfciydfa2em( ont4 exrio iadfpD  n ol( sruoir oudam emnei () rrmuronu1oexnioeiytfs2ulnvo;u4tlermfcootlm r ivo;(  rur(mpiu1lltemnvt ()arumxm oo1alt mfcilsls ra(mo (0aexrmf ty1lpt li o;s) 2umxm3iydlm   nvsa(fsDraxr nu1apt mi3ildls2ra( p (0alenmf iotfpDranvs;(0 euoxo3iu1lle  fvtls)a2rrur ot1olx moeiydls2rauvp;t0arenir totfat luvo;t  2tmxo3io1lpt lnct () Dururooo0tlxo f3tlsls2emuvs;t0tleoxrctytlmDr nvs;s)seurir3no1ll nlici tfsrua(rp;u4oltnioctys sDeau pn(4arxrmr3ta1la eai o s t2umio3no1alen ici s) Dur( oot4tleo oeildls ua(vs t4tltnxo3iydopt auvo;t0 rtmim nudamtn feias sruaurp;t0apt  i3iasls ranmsnu)aeeniociydlateauei s) exmio ny1lpe mnetl( artm(mo;u4aexo i3ild sDelumo t4 exnmfcoodom ean i;() etoxmpoudoltnlnetlt  2uaur oo0tpxnmo3tas s2rlnms;(0trtrio3io1laD ai s;s0teum(m3ou4lmt  fcta(fsrtmu oou4apx mfciltfa ul( snu0aetnxr3to1fptrli ils texmirpny4omtnmnctat)sDtmxrono0tetoiociydfm2ran on(0trxnxr oytfa rlu o;( sexo(o oudomenmfvt (  2tm( ont1oeen ociyslmDuau p (0texnmr3tydlp r uvs t t2um(o3oo4lmtnlnct ()s2tm(moot0ape io3iadls emn p t)teenxr3iydoa   ieo;( srto(r oydap nlieilt sDrm( ono1oetnmi3iatfs2umump;t4 rxnxocia1lmD  uesls srtr(m oo1altn fcsa( arrau ont1tpeoiicilslm2umums u)tltoxr3oydoat anvo;(0trtoxr3nodom nmicil(faDuau pnu0apeoio3iad aDeanms (0 lenxr3iydlmD aueils  2xoiopno4lmenlivia( srrrxr nu1tee  ietydlsDumn s t)tltnir ootlaD anvsls0trurxmpiodamt mfvilt)aDrrxrp;u4oet mfciatla2uauvo;u4 lxrxf ta1fm r n s t0 2toxm3oydlm nlnci t a2taum ot1tee mictadlaDra( p;(0artoio3oadfpte ieo ( seuo(m3iodll nmivia()srur(mpot4oetoii3tadfa2ua( s u0aeenio3iotfmDe uvo;s0 2trxo iu1ole mfcsat)a2ur(rpnt1oexn o3iys a rm( s;u4treomr3io1lmteluvo;( s2xrir3nudop n neiltfa2rrx  ot1ope ii3iad m elu o;u0tltnmr3tytfm   ueo ()teurirpio4omt  fvtlsfa2trxmo;u0altn fcils m emums;u4arxrmr iadomDelies;( t2xm(opnudomte nvils s2urump;o1ope ifciyd s uln ont0 lxoxo tadoatrlnvilt seuo(m oudlp elnesls)arurxr ;t1olx ifctltlm eluvs;(0altoxr3iy1op e nvi;t seumio oy4amtn feilt)aDrmu p;u4tle  f3tat sDea(vs u4 rtrxr3oa1fmteauvol(  2xmim no1op e fctlsfsDrr(  ;o4olx ioetysls2rmnms t0 rxoioctytfaDrlnei;s) rxriopoy1lpt  ncs s) ruauro;t0olxnifeiys m ulnvon()alxoir tytomteauvo;(0s2toxr3nudalt  netlt)a2umxm nu1alt  ietld s um(vonu0 exrxo oydom elu o;t)srtmir3ou1lm n fvtltfaDrrumo;u1tpt miciasls2rau pn(0artrxr totfaD an s;t) rtr(rpoy4optnlnesa(faDrauroot1ole  fctys a emu s (0tltrmoctotfaD aies t0 2uo(o iy4llen fci ( arumxm ;t1oexnifeildfmDelnvp;t4 rxrirctatlpDran ols) 2uoimpiy1ol elnvsl(f 2ur(mp;t4tpxnifctat s2rmuvs u)tetomf3oodlmD aiei t) etmir oy4op  micsa( s2urx onu0optomfeiatfs2rm( s u4 rtrifctadfpt  ieols0trurxopnodoltnlfvt ()artrumpnu1tlenmfctyt s el( p t0 etrio3to1op ranei;t0t2um(opnu4lmt  fes t arrrx ono0aexnmi3tydfsDul( s;u) ltrmociodop eauei (0t2uoxo oo4ap elfvilt)srtm(monu0olxniieiadlaDuanmpn(4arxoxfcty1oa e nes t teur(opny1omenlncs sfa2rr( onu1opxomictls a2ulnvpnt0teeriocoatlpt ln i t0 2xmxo3nydalt  nctas)aDtmu ont4aetn fciltfa2rau p;() etnmoctodlm   ies;t)t2to(r3nudaleelfesatfaDuax pnu1alen f3iysfaDuln snu4aetrxocoa1lm  ai s ()t2xrimpoo1llenmncsas)a2trumo;u4alxo octat m2ea(mo u)teeoxocoadop eai i t) 2xrxrpou1aptn fvslt)aDrrumpot1oleomieiasfaDra(mp;(0 exomfciadoptrln i;( t2xrxo ou1lm   neta(fsrrrxrpot1aet  i3iyt mDulnmonu4 rxomf3oytfp  an o s) rxoimpiodapeelfesls)aDuaxm oo1teen ieilsfs2uau pnt0aeermoctatomDeanvslt0s2xrir iodlmt  fvsls aruaxmoou0aexoii3tyt aDrlu p;(0tlxnxf3oydfpD anvo;s)sexo(opno1lm nmiet t) rtmxront1tpe  o3iyt mDemu p u0arermociatoptr n o s0s2xr(r3iy4lmte fcsltf rrau poo4apxnmoctadls2rmnvp t4alenxfctatlatr i slt teuoxm no1ol e nvt t  Dua(rono4apxo ocilt a2eluvo;u4altrxr to1fpD au i s t2xmim nu4op n nei s srrau  no4tlxnmo3tyd a ua(vs t) ltnxo iadlmte ies;t t2um(o nodlm  lfvs tf 2rm(roou1apeoifctldlaDean snu)treoxf io1lmt anes s  etoxr3iu1lp emicslt  rrmxm ;u4aetoiieilsfm ulu onu0 reoif ootfp  aieolt)s2tm(opiudapee neiatfaDtrxrpot0tpxoio3iatla emu o u0trxrmr3iy1omDelieo;s)trtr(m iu1alt  ivt ( aDtm(r oo4olen ietldlm rmu on()arerxr totlmte nvil(0 eto(opoodolen fcs t)a2trurono4alt mieiys sDeau p;t) etomr3todfm r ivi;t s2umir3nu4am elivtlt)a2rm(r no1alxomoeiatla2ulu s;u0aleomf3iadoaDe nvs (0 2tr(r3oo1omen fvils) rtmxm ou1olt ifetasls2uanmp;t) lermr iytlmD anvi (0 rxr(opno1al  mfes (faDumx o;t0tptomicild s2elnvs;(0 etnmfciytfm e ivsl(0srtr(m no1oltnlivt sf rurump;t4oleo ieildls emump;u4aetrxocoatopte ivo;t)trtoir3nodop e fet tfsDtaxrpnt4aleomo3tldfs elnmo (0arxnxrciydfm  luvslt0truoirpiydlpeelfviatfsruaum ot0tpxo ocilt m uan s;(0 lxomr3tadla  ln ilt) rxrxrpou1lmen ictls  2urxm nu4aet ifetlt s2rl( s;t)alxomo oodla  li i t)setm(m3no1lmtnlfesas  rtm(rpno4opeoioeiadfa2umu snt4artoif tytlmtrlnvs s seurxr3nu1apt  fvia()sDra(m ;u0oee mieiasfs2emnvs t0 eermo3oatfm eau o;s)s2urir ny1ap emnetltfsruaum oo4oeen ocias a el( o;u0tltrmociytlm rlieilt s2uriopoy4lltemnvtlsf rrauro;t1ape  feiadfmDuan sn(4aetrmf3ia1lm rlnvo;s0setoio3nudam elneia( s2ra(m ;o0apx  iciltfa2emn p u0aexrif ty1lpD livi;s0trxmxm3no4op nlnciat) ruaxmpno0oee  ocild a elu p u0aeenxf3totfmDeaneils)s2umio3nydlm  miviasfs2rrump;t4opeo ictadfsDumn ont4tlxriocty1lmD  u o;t0s2xo(o3oo1amtn icia()artr(  nt4tltn fcils sDulumonu4 ltnif3iytfp  lueilt)s2xmxo nydam emnvi ( sDtm(ront4olxomfeiadfaDem(vs t0alerxf iadlpt  n ols0trtm(r no1alt lfvtas) 2trx  ;t1texnifeilsfa2emnms u0 eeomf3tatfp  aueslt s2xmimpiydomeelnviltf rumumooo4tpxoii3ildla2um(mon(0 lxnmrciydfptelnvols0trxrio iu4lmenmnetl(f Dtm(mooo4aexo o3iysla2emnvp u4tleoiocoy1optr ivo;t0trxr(m3iudol n ies (fa2rrurp;u4oet  octytlm2ulumsnu)treoxocoy1fmt  ies s0 2um(m3oydamt mfvsls  2rau  ;u1opt mf3iltlaDulumo;u)tlerxocto1lp  aivslt  rurim3oudamenmnci tfa2tau ooo1opeo iciaslmDumn o;u)aexnmr iotoateli slt0s2umir3iudam emfctat a2umuroot1optomi3iatlm ua(vs;u0trxnxrciatfaDeln i t  eto(rpiudameelnvi s  2tr(rpou4ape  fcilslaDeaumo;t) exomfcta1opt  nvi t tetrxo3nydlpe lfesl()sDrmxmoot0aeeo icilsfm rmnvs ()trxrif ta1oateanvs;t) 2ur(opnudolt  fctl(fsDraxr ot0oexo f3iat m2rl(vs u)alxoxr3oytomDe nei;(0t2uo(rpoy4omt lfet ()sDuaum nu4tltnifciysfsDeauvp;(4 exoif iy1lmte u o;(0setrxmpnodoltelncsatfa2ta(mo;u4tlx ioeiltfs el(mont4tlxoifciy1lpDeln o;()s2ur(r3iudlmte fvtl()s2raur oo0tleomoctltfm raumo;u)alenmfcty1om rlieo;t0trtmir3iu4olenlicsat) 2uru ooo4opt  fcildlsDumuvs (0 eeniociodopDrln olt) etmim oodale lfcta()a2tmuroot1altomociysfs uan o;(4altomr3oy1faDelneolt) 2umxr3iy4ameelieiat arta(mpoo1oee  f3ildlmDumnv
\ No newline at end of file
@@ -0,0 +1 @@
+ivilt) rurxo3nudoleelfesl(  rtrxmp;u0tptnii3tad m rmumpn()alxomrcio1lmtr iesls0 eurxmpiu4al   nvs tf Drm(monu0teenmo3tldfaDrmn pnt) etnxr to1lm ran i t) rurxrpno1lltnlnctltfarurump;t1aee mi3iasfs rl( s;t0 renmocty1fpDr uei;t  eto(m io4lp   icsltfs2rr(r ;u0tltniieiytls um(msnu4 exomoctadlm  ai ils) 2umxo nu1ol   ivs t s2ra(mp;o1opeo oeils a rl( p;(0artrircio1lateaues s)s2xo(mpiydapt lfes (f Dur(mont0aet ifciytfm2ulump ()trxrmo oytfaDr ivo ()teto(opoydol   nei tfsrtmum nt1oleomoeildlm2eln p t4alenxf iadlaDr nesl(  etm(m3iu4op  micsa(farrmxmpoo4aeenif3iadfm rln p u)tltnmfciodoptrlu o;(0 ruoxrpno4ome  nvslt)srtau  ou4teeomfeiys a2rl(mo;u0 lxomf totlat au sls0 2xr(r3oudlptelfeias  rta( oot4tle  feilsfs2eau onu4tleoio3to1lmteaneo;s) etoxr3iu1lp n fvilt  Dumumoot4ape  o3tyslmDuln on()altnxf3oa1fp raivsls)sexr(r iu1lpe livias a2ta( pot0optnmfeiadfaDum(vs t4teerio3iadlpt lues;t)t2tmir iy1al nmictl()s2raum nu1apenifciydls2eauvpnt0trenioctydlpteli s;s  etmxm oo4ap nmics sfarua(rp;t0oetomiciadlm2rmn p;(0artomr3oatlp rlieol()teuo(m oodaltelnvta( artmxr oo0opeo f3iatfs2um( snu0aeenmfcta1lpDelnes t0trxr(o3iydamtnmfet ()srtm( ooo1aexoiieiytfsDumn pn(4trtrxr3iadfm  ai o;()sexo(m3ou4ap emfetlsfa2umu  ;t1tetn ieilt a emnvs () lenmr3oo1laDeaieo;s0 2xmio iydaptn fes ()a2raumont0tee  ieiyt s2el(msnt4tetrxf iatlmtr ivi;s) rtoir3oo4ap nmicsls  2trx p;o1oexnmo3ilsla2eauvo;u0altomf3iydlmteaivo s t2tr(m oydal   iet (fartr(moou4aet mfcils s2eanvo t4 lenio ty1oat lnvs;() etmim3oudoptn fcias  ruauroou1tpe iieils mDrl( p t4tlxnxr3ootfmD lnvs t)srtoim3oy4lmeelictas sDta( ono1tlxo feiyslaDuanmon()alxnxfcoytlp  ai ilt0sexr(m oydllen netat)s2ururpoo1oeto i3tatlmDul(mp;u4alerxo tadomDeanei;s0 rtmimpoo4ap  lfetlt aDrax o;o0aleomo3tadfmDeluvsnt) lxrxo3ty1lmtrluvi () 2trim oydalenmfvsl(  2rmu pou4alxnmoeiyd aDul(vonu)tlxnxr oydfp rli o (  rxrim oodal emfcs s)arrm(moou1tlt ifciyt aDeaumsnt4 etrmf iotfm   uvi s0trxo(o no1alt mncil(f Dur( p;o0aleoii3ildfs2elu p t0artnxo3todfat lieol( seumxo ny1apenmfvtasfa2rrxr oo0tlenmfetltls2em(ms t0aexrmo3ootfa e ivilt0texoxo iu1al n ict () Drr(mpno0optn i3taslsDrln s;t0arxrmo3iy1oaD  nvolt0 exrim3iydopt  ictlt)s2ur(m ;o0apxo ieilsfm em(vs u0 etrio ty1lmt  i sls)t2uoxr3iu1lpe lncs tf rum( p;t1opto o3iltlsDra(ms;(4alxrmf oatoatraieilt) 2xr(rpiu1lpenmict (faDumx o;u1olx  o3iytlmDrmuvo t4trenmf3tadlmtr nei ( srxrirpnu4lpenlnct ()srum(r ;o1tpe  i3ilsfs2ran s ()artnmr oo1fm   u i;t sexoirpiodapeemnvtls sDrmu poo4olenmoeiat a2em(vsnu) exnmr3tydlmt auvi;(0t2ur(rpoy1omtemivt sf rrruro;t0optn fciydlm2ra(mp ()tltoir oytfmtrlu o;()texmir ny1al e fcs t)s2ur( ono1tltnmf3tytfmDeanvon(0tleoir ootoa  lnvo;t) 2umir3io4ome  fesat)s2trxrpou4aeenmfciytlm2um( p t0trtnmrcoodlm e neslt0t2uo(rpiodll  mnetlt arrrxr no1ale mocils a2rm( o;u0 lenxociotfmt ln olt s2tmio ou1lmeemfeil(fsDurumooo0aet  ieiadla ua( sn(4tltrxocia1fmt  ieo s t2uo(r oy1alenlfcilt  2tmxr ou4tlx mictlt a2ua(ms u0tlerxo oatfaDeaivi t0t2tmir iu1apenmfvsas aDrrumpnu4oeto f3iydlm em( p;t)alxrio3iatfpt  nvsls)tetoxo3io4ll e nvt t)a2rrxrono1tee ifcias mDuln o;u0aetrxo3io1fat lu o;t) rtr(opnydol emnetl()artax poo0ope  f3tat mDumu o;u4 renio3todopDrlu ilt0srxoirpoy4opee ieta( sDum(r oo0aexo f3ildfs rm(msnt0 ltrio3iotop rlieo (0 eurxrpoy1lpeemictl(fs2tm( p;t0apeo ociadls ulnmp;(4 lenmf iydomt luei;(  exr(m3oo4amtnlieilt) 2rmu ono0oeenif3ildls emu o;u4trtnxr oytoatranesls0t2tr(o iodol  lneias  2rr(mp;o4oeeo oetldlm2umn o u4artoxo oo1lpDeaues;s0setrir3oy4lmtemnvs sfaDrrx onu4apx  feiysfsDra( o (0 eerxfcio1omt luei;t0setmio3oudap e ivsat aruaurooo0apen ictat a ulnmsnu)artoxo3oadla r uvs;t  exrxm3ou1amt livi ()s2ra(  nu4aexomfciatla el(vo (4teenxo iodoaDe nvslt)s2xrim3iu1ll n nvs s a2rmxm ;t4alenii3iyt aDemnvp;t0tltrxf ty1oa  lueolt) ruo(m3iodamtelivtlsfs2taxr ot0apx mfctltlmDrmuvs ()tlermf ty1lm  lu sl(0seto(r io1omte fvi s) Dumxmpnu1tpenmieiadfa2ranmp u0 leoir totfpt  i ols)s2xrirpio1lle mivslt) 2ur(  oo1tetnifeildfa2elnmp (0tetnxf3ty1faDeauvi s s2umio oudopen icils) rrrx  ou4oetomfciytfa2eanvpn(4artrmf tatomD  i o s truoxr3iudal nlnvta(faDtau p;t4texnioeiat a2em(vs;u0 renmfciadlaDrauvs t  rtmxo3nydalt  fetls s2rr(m ;o4olenioctaslm rl(ms;t4 rxnio ootomt ln i;s trtm(opnu4llte ivt s)arta( p;o1aexn iciyt m2uau s u0trenio tydlptr ueol( seumio3iu1lmeeliesas)srrr(  ;u0tleoifciadlaDrau o;u0 exoxo3oo1fp  anes (0 2umxmpiu4ameelncs t  rum(mpou4oex ioeiasfaDraumo;()trenmf3oytomtelnvo s)srxr(o3ou1oleemnctl(fsrtrxm ot1oetoifciyt aDeau p (0aetrmrcootopDraueo s  2xrxo oo1omenlnvt t) 2tm(mo;u4tpx if3tytlsDua(ms;(4alxrmf iodop r ieolt seuoiopiudlmen neslt  2umum ou0opt mi3iadfa2umuvp t0 etomo ootla eaivo s  exrim3oy4apeelfvsl(fs2rrumonu4tpeoiiciydfmDuanmpnt0 rtnifctodfa e ues;t) rtoxm3iydlpenlnvt ()srtm( o;t1aexomoeildfs ranvonu4teerif oatfmt livi ()t2xmir3ny4ome  nes t) rtmu o;u4oet mfcildfaDra(vs;t) etomfcia1fmteln s () 2urxo3io4ll nmfei (fa2tmuronu1tlx  ietyt sDelu snt4arxrxr3todlaD luvi (0t2umxopio1ll n ieslt)srrmu pnu0oet ii3iadls2ea(ms;t0trtrir3io1fateau o;( sexm(m oy1lpe  fvias) Drau p;o4tlxn i3tasfm em(vsn()areoif3iytoa  aivs;s tetoxo no4amee iesa( s2tmxrpno4aeeomi3iys s rmnvo;t0tetniociodfm e iei;t0 etr(o iodomee nei t)a2umump;u0tltomictad a2ua(vs t4aexoifciatoa rlnvo;()t2tmir iy1oltelneias a2uaxm ou0aetnifciysla ra(mp;u0alxoxf3iodfaDe uei s srtmxm3no4lmen fet t aDrmxrpnt4opx iictat m2emnmp u0teenxrciotoptraieo ( t2tmim3oy1alt liei (  rra( poo1olto f3iyd m em(mo u4 reomf3tadoaDelnvs s) ruoxr iu1lp   nvsl(f Durxrpou0olxn o3tld a2rmn p;u) exrxfcoatoa  lieo;(  2um(rpou4al nlfei sfa2trxronu4oexnifciytfmDrlumsnu) ltomf3tydopDr ivi;t0t2xoxo3oo4olenlfetl(  2rmx p;t1oetnioeiydfaDulu s;u0tetoxo3to1oatelnvs ()s2tmxr io1opte feia(fartau  nt0tltomf3iyt m2raumsnu) etoxr oydomD lu ils0s2xr(mpiy4ol elnvtat  Drrxr nu0aleomi3tadfmDuluvo t4tleoir tatfmD lnei;s sexrim3oydame mieils)s2trxm nu4alxnmfciaslm umnms u4 renir3ia1lpD  n s;s0t2urimpny1ope lfvt tfsrtmx oot1tlx  ieiatls rau p (0trtrif3to1lpteaneo;(0 etoim io1lpee nvtas) rrmu p;o0tltnmf3ilsfa2rau p;u4 rxoio oadfptr nes t0seumirpny1lpenlnctl(fsrtm(  nt4aee iictls a2ulnvpn(4 eerioctotoat lieo;t0 etrxr io4altn fct tfsrtaxr nu1ope ifetasla2umnmo;u)trxrifctodlaDr ueo s setr(o nydamte iviatf Dtrumono1texn o3tys aDrluvp;t0 renxf oydfpD  u ilt seumxmpoo1amt mieias aDururpou0olt mociasfm raumo () exrmrcoa1latr i i t0 euo(m nudlleelnciat a2tmx pno1aex  o3iatlm2rlums;u)aeeomfcoa1opD ln i;t sruoir oy1ol n icia()sDrm( pnu0tetniociys mDulnmonu4texoio3oodomt lnvo;( trtmiopiy4ole  feilt  2rmum ot1tex  o3iat m umnvs t) rxrio3oy1fmDrluvols)setr(mpoy4al n nesa(f Duru pnu0tpe  oeiasfmDrl( o u4arxnmocoytfate uvs;t sexoxopoodapt  fcilsf 2tm(mooo4ole mo3tad s2rmu sn()aexrmfcta1faDr i i;t)seuoir ny1lmte ictasfa2tr( oot1aexoif3iad mDrmu o;t)tlenxrcoadom r neo;t0 etm(r3oo4alteliet tfsrtaumont1alenmfciltfaDea(mo (0artrif tydop rlu i t sexr(r3nu1ap  mfcia(fsrtax pnt0tlxoio3iyd a2uaumsn(4tlxoxf io1fmDrlueslt0t2umim oudlp n fvs (faDra( pnu4tex  oetatlm2elums;u4texomf3iotlptraueo t0trxmxo3ou4omtn fctltfsrrrxrpno1tet mf3ild s2ra( s;u4aeenir3iytlm  auvo;t0seumim3iodapen fei s)s2uaum ou0oltoiiciadls2rl(mont) rtoirctodfpDrln i t srxoim3no1lle lfvs t  2uax  ou0opxnioetatfm rlnmsnu0 lxrmfctydlmt  n ils seuoxo iy4op emicta()aDra(r ou4tptomfeiltlm umumpn(0treomo todlpD  u ils)t2ur(m3iodalee ieslt)aDuaurpot1olxoiietytlm2eaums;(0tlxnxrcootomteli s s0t2xo(o nydlm nmiesl() Drr(ronu4aee mieiadfa2rauvsn(4aetomrcoy1lm rlivils srumxrpnodolt lnetlsfaDtru p;o1tle ifctldls2uluvs;(0trenxo tadlpD au il( t2to(o ou1ope mfvsasfsDrmurp;u4tpt mietyslaDrlu o;t4artnxf3oa1op raues (0setr(mpiy1lm nmfvs sfsDra(mpno4alx ifctysfm ulu s u4teenmf oodlateau o t srurim iu1op   nes tfsDrrxm ;u4olt miciyd a umnvo;u4trerifcty1lpD  nvs;t s2xr(rpoodome lneslt  2rrxro;u0ale mi3tadlm ea(vo ()teenmr3iydfa rli i;s)srtm(rpoo1al emicslt arur( ono1tetniietyt a emuvonu4altnif3iytom  livo t) eumir3no1ll eliei t s2umu  ou0aetnifciyd sDrmumo;(4trenxo tatoaDe ueolt0trxo(r3oo4om emnvilt  2rr(root1oeto ociysla uanmp;u4aexnifcoydlaD aivil(0 exoxopny4lmtelici t s2taxro;o1olxo oeiydfaDul(vpn(4artoio3to1fp rau s;s0 rtr(r ny1am  lfesas arta(monu1apeoii3iltlm2rm( s () exnxr3to1oatr uvs;s0trtm(rpiy1om   nes t a2tau  ot4alto ociytfs um(vp (4 exoxrcoo1fpDelu s s)setmir nodapt mieilt aDtm(mo;u4aptomf3iatfm2uln o;(0tetrmrciy1fpD  uvs t  etrir3iy1am nmnet t)a2rrxm oo4oexo oeiytls2ranmpn(4trtrxfciodlp  anvsls) 2tmxm nodlm nmnci s  2rr(mpoo0apx  fetadfsDrm(vo;(4teerxf3io1fa elu s t0t2uo(o iy4ll nmiviltf Durx pnt0olen feiydlsDea(ms;() exoxfciadoaD lu olt0t2tmio no1olen nvsa( srrrxrpou1olx ii3tydlsDuau o u)tlxomf3oodfa ranvolt) ruriopnu1oltemncsl(  rra(r no0alt iiciltls rl(mp;u0altrxr totfaDrai s;s  rtr(mpiu1apeemfvsl() Dur(m ;t1altniociadlm elnmo (0 etoxf3oytlmte i i;t t2xrxo io4apte iei t a2ta(rooo0opt ifctlt s eln s;()aexoiocta1fpDe uei s)t2umim3oo1oltn ivsa(fartmurpoo4openmo3tytla2uanmo;u0aleomr tadlpt liei;s0 rxrxm iydap emivt s) Dtrum nu0opxoii3tydfsDrlnvp u0tlxrmrcootoat  ies;()trtr(m ny1om e fvtl(f 2rm(m ou0ole mieiatfsDrmums;t0teeoircio1lmtelnvil()tetm(mpoy4om   ieias)arumum ;u0oeeoiieiadlm2ea(von()trerxfcio1fmDeliei;t0 ruo(opio1am elnvtas)artr(mp;u4tee  iciad s2ua(vs t0trenmfcto1omt auvi;(0truriopnu4omtnmfctl()arrmxr oo4aetn ieiytla uluvs;t0aexriocio1lmDr nvi t0 rtr(r3nudlpt liet (fa2uaur ;u4altoifcilsfs2em(mpnt4alenxr iodomtranesls  rxmim no4oltnmnci sfsDraum ;t1apxomocilsla2ranmo;t4alenio to1omD lu o;(0 2xm(opoo4ap n ncsat)a2taxmont4olx ifeiydlaDulump (0teenmo3tydlateli slt0teur(opoo1apee ncsa()s2rrurpnu1oltomf3iatfm2eluvpn(4 eenmf3ta1fp e n i t0srtoxo nu1olte fesat)arrmxro;t0alt if3tytlmDrl( s;(0trxnmfctatlpD li slt0 rxoir3oo1lle  iciasfsruax  ;o0opt mf3iyd s2ra(vo t0tltomrciydoa   u olt) eum(r3nydop elieilt arrmumo;u4oleo ocilslaDuauvo;u0artoir3tadlaDrliesl(0srxriopio1lpeemiesa( a2ua(mono0alx  fciydlaDua(vp u0 ltrif ta1lpt lnvil(0s2uo(rpiydlpenlfei (fa2rru p;u0ole if3iytlsDrln ont0areoir ty1omDelueo;s setmxrpoy4lptn fvs t)aDumx oot0aexo f3tlt sDrlu snt4aexoxrcoadomDrluvs;t trxrxm iu4ape lnci s s2ua(mpot0tetnmfeilt m2ua( p;t) lerir oytomteluvilt) rto(r3oodop   ncsat s2raxmp;u0opx ioetadfm2uanms u0areoifctydfa  anvilt) rxrxm3iu4ap emicias a2ra(ro;o4apx ioctlslaDelnmp;() exrxo oytlatr n ol( t2umir3nudlpen iet t sDurumpou4ale mfeiyd m rluvp () rerxo3oy1fa elieo;t trtm(rpny1altemfvtas)srraxrpnt0oltoioetytlm umu snt4 ltrmo3iatfm ran s;t)srxrxrpou4ope mnetas a2rau p;u1tetnii3iadlaDeln sn(4 reoiocoydop e uei;( sexmimpoo1ameelnvta(  ruaumooo1olx mfeias s emnvs;u4aeerif iy1fmDraieolt)texmxm nodlmenlfcs tfartaxm ;o4oee  fetyt s ua( p;t0trxoxrctydoateanvs;t)trxo(r ny1omenlfct ( s2uaurpoo4apxn ociytlsDrmuvs t) exnmf oo1fp  anes s0teurxr3nu4lptnliei t s2tm(ro;o0aexomf3ilt a rm(msn()altomr3oa1lptelueolt srur(opny1ll elivslt)sDur(  no0opxniiciaslaDeluvonu4tetnif3iydfp e uvslt0 rxo(m3iudlmeelicils srtr(r nt4aleoio3ils m rlnvs (0tetnxr oadfpD liesl( teto(m3oodol e ivsat)srumx  oo0ale mf3iasls2uau p ()trxnir iatoptelnes;t) exrir nudopt lfct (fa2rru poo4aeenmociatls2ua(ms;t4 renxo oydlpDr uvi;s  eumxrpiy4olenlivil(fa2rax poo4tpx mf3iytls uanmpnu) eenmr3oadfp e n o s0 2uoio3io1amee fcilsf 2trxmpnu1olxn o3iatfa eanms;u)aetoxr3todlaDr uvo (0 eur(m nu1lm  livtlt srum(mp;o0olxnifeiys s rmuvs;() rermrcoatlm eau o;(  etmim iodame mietls  2taxr ;t0altniociadfm elumo;(4 reoxfcoy1optrlnvils0seuo(o3iu1lle lnvtls  2rmuro;u4tltn fciysls ulu s;(4trerxfcoodlat ai sls)setm(o iy1apen fvs s srur(  ;u4tltomf3ilslmDrauvo;(0 rtoxf oytfp ean il( sexo(opou4altelfct s)arumum ;o4oleniiciad aDrlnvsn() rxrmo3iodfaD  ivslt)srtmirpiydopee fvta( aDtr(r nt0olt miciatlaDra(msnu)teenmocoo1opteanvi ()srumirpny4al nlfctlt arrrx  nu1aptomf3tldls2ul(mpnt)aetrxrciotfa   n ols)t2uoirpiodom nmivta()a2rru  ;t0alxoioeilsfaDeaumon(4tlxnir3todlm elnes;s0 rtrxopnudapeelfcsasf 2rmu pnt0tpxo fetatfm ranmo t4tlxomrcty1op raueslt sexoxrpio4olt micia(  Duax p;u0aex mf3tlslm umn s;t4 ltnio oatfptr ivi;t0s2toim3iydam nmnvilsf 2umu  ;u1oex ioeiad a2emump t0tetoxo totoa rln il( sexm(o3nodop emicias) 2taum nu1aex iietldfa2rlump;t0aexrxfcoytfpD  nvi;s)sexoxo io4lpe mictls)arrmurpno0tpeomfeiysfm2rl( o t)altrio3iy1fateau o;t)srtrir3ny4llte nvsl(fartau oot0oex  i3iat aDelnvonu0aeeomf3tytfpD ln slt)seuoxm io1ll e ivi sf Drr( onu0open icilslsDrl(vp (0aetnxocoadlpD  ivi t) rtoiopoo1ope  icsa() Dra( p;o0oeeomf3iyd m2ea(vs t) eeoxr totoaDe nvo;t s2trxrpoodam elnvt t)s2umurp;o4ole mfciatlm rmumo t0tleoiocia1fm e u ils setmxr3oy1aptn ietl(faruaur oo1tpt  ociyt m2emuvo;(0aeenmr3to1fa ean ol()tetoirpoodal  lnesltf Dtmur nt4aet  o3ils a2rlnvo t)alermo3iy1fpte i i () ruoir iy4lle  fcilt  2tru pnu1apt mi3tad s um( s;u4tetnmf3iytlmDe i s s texmim ou4om   fvsls) 2ra(  ;u4tptn oeilsfa uau s u4 exomr3iy1fp  li il( s2tmxr3iudameeliesa()sruaum ;u4oexomf3iyt m2um(vo;()aetrio3iydla rlies;t0 2umxo3oudop  mfvslt)sDta(ro;t0aeto ociyslm rmnvp u4alerxo3oadoate n ils) euoio3nodame lfvs t sDtru  no1opeoii3tydlm2ul( o (4treoxr3iytfm ran i;(0t2xrir3ou4om  lfvtls) Drmx pot4oet mfcilsfm eln snu) eeomr3iatlmtean i;(0 2xo(m ny4om nmneia(fsDua(rpou1oeeomocias aDemums;()trtrmfctadfm rlnei s0 etrxm3no1olt mnvs ()sDurx  ot0tlx mf3tysls rmnmo t4trxomo3to1laDrliei (0 2toir io1apeemncslt  2trx pot4opx ii3iadls rlump t)teeoiocoa1oa rlnvslt sexr(m ny4ol elnvilt)aDta(mp;o0oltnmiciydls2rlnmo u0arerxf3tydoaDrln s;s0 eumir3nu1lp  lfvslt a2tru  ot4openmi3tldlm eanms u4arerxf3tydlpD  nvo;( trtmim3iy1am emiesat s2umum ;t1tltnmietatfm2rm(vpnt4 rtnxr3oo1latelivils  etrio3no4lpt  nvias artmxrp;t4aetoioeildlsDelnvp;t) eeomrciotoa e ivils srtoxo iu1al   iei s sDraxmp;t0tlxo o3tytfa el( o ()treomoctatfa rlueslt0 2umir3ou1lpe lncs t) 2tru p;t4aeenioctytfsDranmpnu) exnircoodfmtrlu o;s0 exrxrpiudolt lfct ()arraxmpot4tpeoiocils mDrm(mo u0 rtnif oytoaD ai i s)s2xo(r oydlm emnesa()aDur( onu1tltnii3tld a2uluvo (4 eeomr oatla rlnei (  etoxopno4ap e iesls)sDur(r nu0tetomiciysls2rm(vo;u4trxnxf3tytlat  i ols srxr(o3oydalt  iviatf Dtmumooo1aexnii3iltfm rmu o ()teenir ia1fp r n o t0 2uoim3oudap n fesasf Drau  no1texnmfctyd a2rm(ms;u0tlenmrcia1fmtrluvo;t  eto(m3iodlp nmnvs ()srtm( oot0texnmoctyt a2ua(mp u4 lerircoatlpt ai s;s)srxmxo3no1lmeelfeils) 2ur(rpou1tpen iciltls2uanvs t0 rerio3tytomt lueo;() rumim no4op n fvi ( artr(r nt1teeo fctat a2umu o t0 exnmfciy1fmDr i sls) 2umxm nodomeelici (  Drau pot4oex  o3iltlm2ra( snu)aetoifciatfpDelnvi;t trxrimpoydamt  ivi s)aDrmxmo;t4apxoiictys a2uanvpn(0 eerxrcoatfat aivs s)t2uriopoo1omen fcilt)sDtmumpno0apeomi3ild s ua(vsnu0arxrmfcoytfat  uvi;t)trxmxopiy1al   ieilsf 2trx ont1alxn ictyslmDelu o;u0altnmo3ootfpDeaivols tetmir3ny4lmtn nei (  2rr(rp;o1oetoii3ias s2um(vont0alxnmr oytlp   nvs t0srum(o ny4om elicilsfaDtrum nu4oltniicildfa rmnmp;(4tetoir ootfatrli s ()t2uoimpoudlptn fvsas  2taxm ou4oeenifeiyslmDrln p;(4tlenif3iy1lptrln s;() rtmim oy4amen fesltfaDumx  ou1aeeo oetls s2uaums;t) rxnmfcio1om r n o s setrir iu1opeelnvtlt sDum( ono4tpxo fctld mDrmnvsnt0trtrmf ty1op   i o;s0 2xrim io4op   feilsfsrua(r ;u4olt  i3ildfm ean snu4 lxnmo3ia1oatelu s;s tetm(m no4ll  mnvs tf 2uaxr no0oexnio3ilsla2elnmsnt)tleoif tytlptr ieo t0 rtriopio4amtemfei t)aruax  ;u1aexo o3tys m emu pn(0 rerio3iy1omDran ols)s2to(r3iydoptnmneiat aDtax  no4aet  i3ias s elumon()tetrmrciodfpDrlnvo;( t2umio oo1llt lnes s)sDtrxm oo4ole iicildfaDea( pnt4 eenxf3oydlat lnvi;t)sexo(opno1lmee ivt s) Dtau  nt4olx  f3iys s2emn sn()alerioctatop  luvs t)s2uo(opiy1am  lfetat sDua(mo;t0tltnii3ias a rlnvp;t)aleoircoydom ranvsls)texm(o iydam  mneiat aDtrumpno4aee iicilt m2ul(mo;u4trtrxrcoytfmt  ues;t) exoir3iydllen ncta()s2ta( pnt0aexomo3iat a elnmp t0 renmfcoytlmtr n slt0teum(o3iodlpen fvsl(  rtaxr ot0opeo o3iltfm2elu sn(4 lxomf3tadla  auvs t t2ur(o nydalenlncsas)aDtaxr ;t4tltn fetyt s ua(vo;u4texrmf todfpD livs t0 ruo(mpoo1ope liet sfs2taxro;t1tptoii3tasfs2umnms t4 exoifcia1fatr ies;() rxoim3iudlm elfet s a2taxr nu0ole iieiadfmDua( o (4texrmr3tatfat auvils)srtr(r nydamt lfei s sDua(r ;o0opxn ieiyslsDulu o;u4 exrir oy1oateaueo s0truo(mpiydamen ici ( sDrmu oot4oeeomfcilsls rmnmp;(0 rxnmocoo1latelnvo;s) rurxo oy4lp nmfeias sDrmurp;o1oexniiciadls2ean pn() exomrcia1lpt luvols)setoiopoo1optnlnetatfsDrr(m ;o0olenmociltfaDuan s;()texomr3iydoaDelneo;t0 2xrir3iodopen nvt t a2tmxr ;t1altnmf3ilsla2rm(vs u4aeenmo todfpDe ieo t texrxr3iu4alenmfet ( sDrmu pou0ole ifcildlsDelnmsnt0 eeoxociotlpDraivsls setm(opou1ll e nvt sfsrta(r ot1alto ociytfm2el(mpnt0trtnxoctadfpteanes;() ruoim oydole mfvslt aDrr(  ;u0openmfeiatlaDumnvo;t0 eerxrcoy1fp raues s0truriopoodoptnmivias sDtrxrp;t1oleniieias sDumnvo;t0altoir tydla elueo t) 2xmirpnydlmt mfvs s)sDrmuro;u0aet iocias a rmu pnu4 eenxfcio1lpDeaueilt tetmxmpoy1optemnctat)s2rrumpou1oleoifeiysla rmu s;u4alerxo3iadlaDr i i t  rtrxopio4om nliesatf Drru oot4ole ifctydla2el(mp u4 etomr iatfa  anvi t s2xr(m3ou4lp   nvta(fs2trx oou0aeeniociatlmDemump;(4alenmo3iadlaDrlu i s0 etoxo oy4aleelfes sf Dtaur nt4olxnioetyslm2uaums t4arxrxo3ootoptr neo s) ruoim3iy1am nlnctlsfsDur(  ou0ape micias aDrluvsn(0tlenxf3iy1op rln slt0s2umxo3iu4opte fcsas)srraxrooo1oet mictat a uaumo;()tetoiocootlmDr ivslt srtm(o3nudapenlfcsatfsrrmxrono4oltnif3iytfs el(mp u) etnxo3io1fmt  i s t texoir iydol elivia() rta(r ;u4optn o3tysfm2rlu pnt0 etomo3io1oateln s;s)t2xrirpiu4lpe  neslsf rrax onu0aex moeilsfaDeauvpnu) rxrxo3tytfaD auvo s sruoir3ou4apen ici sf Drr(r ;u4teeomfeiaslsDrmuvo t4 etnxfciy1fp rluvs s0 rtrim iu4open icil()aDraurpot4opeomfctas s eauvp;(4trxnir3tytlmDrliei (0 2xrim3oo1ll  livslsf Duaxrooo1tltoii3ildlsDuln onu0 eerxfciadfaDraies s s2umxrpny4ale  fvsas  Dumxro;o0aptnmfcild mDemn snu4altnmf iodlmDr nvs;s0 euo(m3oo4lmtnmicils) ruau p;o4oee iictydlm emnvs;u4arerxf todomD livi t0 2trimpnu1omt mfcias arurx poo1teeoif3ildfm2uau s;(0trxnxfcoatom  aivsl() eur(r3nudoptnmies t)a2ta(r nt4opxo oetytlaDrlump;(4tltnxfcoadfptrln il(  rurxr ny4olen feiat)srur(mpnt0alx ifetlt aDelnvs t)alenmr oadoa  lues s0trtm(opiodlme lnesl(fsrraum ;u0ole io3iydfs umums;u)arxoir oo1lpteauvils  2triopnodal emietlt)s2tmu pnt4tlx  iciyd a el(mpnt)aeeomr todfmt  u o t)texrim oodlmt  ncs s)a2umurpou1opeoioctasfs uaums;()tleomfcoydfa  anvilt  2um(r oy1om emnvsls  2tmumooo1alx ifeiysla ra(vs;()trtoxo3io1op  au i t)trxriopiydome  ivsls)a2um(rpnu0olt  feiasfsDuluvon(0 lxoxr3oytoa rau ol()s2tmir iydoleelfcils s2ur(r ;u1oex mo3iyslm2uluvo u0arxnifctotlmtraivo ( srtr(m3oudlm n ict ( artm( p;o4texoioeiatla2em(vsnu) eenxo tadopDeln s;s)sruoxm nodom emncsls  2trumpot1ale iociytlm uln p;t4 rtnxr tydlpDe u ils  2uo(m iodllt lies s  2tr(m nu1olxo ictatfsDrm( p;u0teenif3oodlpDelivi;s srxmio no4op  lies t) 2taum ot4aptniiciasfs2ran s t) rtrmo iydfp  lies ()trtm(r nu1omeelfes t)srtmu ono0tet io3tasfmDrlnmo;(4aeermo iadomD aieo t) rxrxm io1oleelfciatf rrmxr nt1opx  fciyd a rauvp u4alenxo3iadla eaivs;(  rto(m oo1lptelnei s)aDua(r nt1oex ifeilsfm2rm(mont0trtomo3iotomDelu s;s)texoir3nu4opeelivs t aDua( pnu1opxniieiydlaDeluvont0aeenxo oadfaDelu ols0s2xo(mpio4ll   fctlt arum( p;t0opeoiiciysls2uauvp () exnxoctotlpD aueils seumir3oy1oltemfvi sf 2tru pou0opxomfcildlmDrmnmonu) reoircoatlm  ai o;()s2umxmpiy1ameemnvil( srrm(  ;t4apeo feias s2eanvs t) ltoxfcoatoa  livols0srtoxr io1lme lieta( sDuaurooo1olt ii3iyd m2em(mo u)aeeomociatopD aies;t)t2urio3iydll e nvi (fsrrrxront4ale  o3iydfmDranvs;t4altoircoadfat li i ( sruo(opnudaltelietlt) Duru poo0opxniictytlm eluvo;t0 rxrmoctytfateli ilt srxo(o no4olt mieilsf Dtr(rpoo0tex io3tlslsDumnmp;t4tleomo oadfptrlu sls) exoxmpio1aptnlnvs ()a2tru ont4tptomoeildla ulu s;t)altnxo3tydlp r nvils trtm(o oudol  licsl(  rumx pnu1oltnmociatfa ranmo;u0 eeoxf3io1la rauvi;s) rumim3ny1llt lfesat) Duaurp;u4oeto ieiatlmDulnvp (0 lerio3oa1fm e n o;s) 2xm(m3oodaptnmnesa( srrm( pot1aeenif3iysla ea( pnu) renifctytfp ran sl( texo(mpoo1am nlieilsfa2ra(rooo4opx io3iadlm2rau p (4tlxnxo3oy1lpD lnei t s2xm(opoo1al nmicsat  rumxrpnu1aee  fcias s2rau o (0alermo tatfpDrln ol(0srxoio3ou1lpt mivtat sDra(mpot4oltn ieiys s eln p () lenmfcto1la e n i;s  etmxopny1op emneslt) rtrx  no1aex mf3tltfs elump;t0aetoxo ia1la r nvol(0srurirpnudameelnet s s2umxm nu1tlx  i3iatls2ua(mp;()trtnmocia1fm  luvsls0texrxo no1omenlnctls)sDuru ooo0ale  o3tadfa2umu on(4 leoxf iydfatrln o (0 rtm(mpiy4omee nei t)a2um(mono1aetoifciaslsDraumonu0teenmoctodoateli ols) 2xr(rpiu4amt mfcsltfs2tmxmooo1altomfetasfa2uanvo u)aetrio3ia1lpDraneolt  rumxo oudlleelfctat)sDtr(ro;o4tetniicilsfaDua( pnt)teenxocia1op eln olt  eumio oo4amtemicsas) 2tmump;u1alenif3iasla2el( o;u4tltnircto1lm e iei t trurir3iodoptelnes sf 2trurpot1alxniieiytfa2ea(vo u4aetnxf3iotfpDe u olt0 etmxrpoy1om elfesa()aDrmx  ;t4ale  f3iytfsDel(vo;u4teenir oo1oa eanes;s srxmxrpou1ll nmics (f Drr(mpno4tpxnmo3tat sDraumon(4 exnmrcootoaD  nes ( teuoxm oy1lltnmicias a2tr(rp;t4alxn fcild mDum( o;t0arxoir3io1fmDrlues;s  eto(m io4lm nlnctl(f Drmurp;u4aexnif3tas a rau ont)altoiociydoatranvo;()teurir iy1apenmicsa(fartr(r ot0tlxomociadfsDrlnmp u0aeeoxfcta1oa   nvo t  rxmxo3oo4omeemici tfaDrax o;o1tee mo3iydfs ranvp t4 rtomfcoytlp r neo s)srxr(mpio1lpte iciat)aDra(  ot4tleoii3iysls2emnvp;u)trenif3to1la raiesl(0 2toxm iodlmtn iei ()a2rmxmono0olen i3iltlm2rm(vsnt) eerif iatom e ies;() rtr(opiodlpt  fciat)sDuaur ;o4altn ociad m2em( o () ltrxo tadlmtean o s s2urim3oo4ameelfcsat  2raxm ;t4olenmf3tasfaDeanmp;()texoio iadlp  livo s0 exm(r3iy1ap   fvtls arum( onu0oltnii3ilt a ua( s t0teeoxf ty1oaDe nei;s) 2xoiopiodom nlfet s)sDrru  ot0olxoii3iyt aDua(msnu) lxnxr tydlaD li s;()seuoxopnu4ll nliet ()sDta(rono4aee moeiytfmDemn p u4alxnio3oydop   ies s)t2xrxr3no4al elictls  2urumoou1opeo f3iadlm2uaumo;t) exrxo iy1opt ln o t0 etmio3oy1ope micsasfsrrmxroot4oeen o3iysfa2ranvpnu)tltomr3oo1oa  aieo;t srtm(r io1amenlivilt aDtr(m ;o1apxomfctlslaDulump (0tetomrcoytoa  liei s trxrxrpoo4op e fesas  2tr(rpoo4apenif3tld s2uluvo;u)alerxo iydfaDr neo s0 2tmimpoydop e nvtls)arrm(r no4optoiietldla rl( o u)tlxrmr ootopDeaivs ( srumxrpnodamtemnctlt)srrmxr ;u4olenio3ils sDumnmpnu4aetomfctadop e u slt t2xrim io4lp   ies (  Dumurpnt4tet mf3iydlmDulump t4 leoifciodoa r i slt0 eum(r ny4ol elieslt)arrrxront4aptoifeiltfsDel( snu4 etnio oa1omt  nes s)texo(mpny4ll nlietl(  2rmum ot1aexoioetlt s2rau o () rxnxf oo1fmDe nvsls) exmxm iu1ap nlfes s a2urur ;o1opt ifciydla2umn s (4 lxoif3oodfmt  uei s t2uoxm3oy4amtnmncsa(  Drr( p;o1tlxomi3iatla2ea(vp u)treoxo3iy1oa ranes;( s2xriopnodopenlfctltfarrr(rpnu1apxoifeiadfmDrlnmont0 ltnmo3io1om  li i (0sexrxr3ny1llenlnes sfa2tr( oou0oet  o3iltla2rluvs u4trxoio ia1lat au slt0trtmxr nodap emict (  rrax  ;t0olxnmoeiytlm rmnvs u0aetnif3oa1laDr ivils  exo(rpoodom  licsltfs2rrur ;o0apx moeildlm2umumonu)tlxrif3iotlp r n il() 2um(mpiudome  nei sfarraump;o1tlxomictldfa eauvpnu4tlxnifctodfmD anvils texoxopny1lmt liviat aDta(rpou0ale  ociadlm em(ms;t) reomr3oadlp elnes t) 2xmir oo1om   fvilt  2um(m ou1tlenii3tytlsDeln o;()tleoxrcio1lp eau o;(0 2um(r iodopt  fcta()s2rrxr nt0aleomo3iysfs eluvp;()artnifcoo1fpD  u o s  rumxo io4ameemfetl(f 2uax  ou1texomoetlt m2ua(mon(4aetrxr3tatoaDr ivs;t  rurxr3nu4lpt mncias)aDumx  oo4tl
\ No newline at end of file
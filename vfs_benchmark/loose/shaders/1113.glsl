@@ -0,0 +1 @@
+ues () 2urxr3ou4ol nmnvt ()sDuaxm oo1aleoii3ildfsDuanvsnu0alerir iatfp eluvs t seur(m no4om  mneils arrrx onu1tlenifeiat a ranvp;u4trtrmo3ty1oatrluvi t0 etmxm3ny1alen fvs tfarraxmoot1aex ii3iyd aDemump;u) lxnmr3ta1lpDrai i t) 2xoxo nudap  lfvtlt) 2umx  ot4tet iociys aDem(msnu) rxrio iadlp e nesl()s2tm(o iu1omt  ictl( sruru  ot4aleomictld m elums (0 exnmr ia1oaDr uvi t0tetmxopiu4omt lnesa()srrrxro;t4texnmf3iadlm2emu o;(0altnio3iodlpDeai olt) 2urim nu1am nlnviatfs2uaur ;o4oex iieiytfm2eau o t) rxnxrctydfmte uvo;t0s2xmir3no1lme lfei t sDuax ooo4apen ociat sDemuvp;t)aleoxo iotopte n o;t)srxo(r3oo4lp  lfvi t) rurxm oo4tleomf3tatfs2ea(vsn(0 rtnmfciydlm r u ol(0 rxoxo iu4lpenmfvt s) rtm(  ;t1tpeo fetlsla2ra( s;t4trxomf3todlaDe ueil( setmxmpoy1al nlivias)aDtaurono4apenmf3tatlm2el(mp;()tlxoxfciytlm e neo t) 2xoxopiydamen fvilt sDuax pnu0tpe moetadlmDuluvon() leoifcoytlmt lueo (  rtm(o ny4optnmfcsat  rtmurpou4apt ifeils mDranvo u4aexrmr tytlpte ivs;(0t2uoxo3ny1opeelnct t)aDrmu  ;u0apeo ieildlaDra(vo;()aeenxocoa1oaD  nvs;t0t2uoirpiodal e fvias a2um(rpoo1aeto fetadlm2ra( onu4 ltnmf3ta1fm e nes (0srum(o3io4op elfeias aDumxmp;o4aleo icils a ul(vpnu4 lxoir3oatfm raivo;s)sexo(m iydll nlivsl(farua(rp;u4tex iicildfs2uln pn()aeerif oo1la eanei;s)s2uo(o io1omenmfcsls) Dtaxmo;u4tpxoiocilsla eln o;(4tlxomo3tadoa   i s ()s2tmir3oy4op emiviatf Draur ;t1tlto fetyslmDulnmont)trerio to1fpDrlieils0 rxmxm nu4lle  ici tfsDtaxrpou1aeeoio3iasfm2ea( o u4tlenmfctatop  aiesl() 2to(mpoudoptn ietlt  rua(r ou0aeen ictadla umums u)aexnxf oo1fat lieo t)srtmio3iudll nliei s)srtrx  ;o0olto feiat a rlnms;t4 etnmo tatlatran o s) 2uoiopoudlle mnvtl(fsDur( ooo0aetnmictydlm um(vs;u) lxrxo iatlm e u o s0 rxoxrpoo4ape lneslt sDtmx p;t4tptnmfciltfm2rl(monu4aleomo iydoatean s;t)t2xrirpiudomenlicils s2tru ont0tex iiciytfm2ra(mp;t)teenxr tytfaDrauvol(0teur(m io4al nmiet (fsrumxm ou1oetnif3tysls umuvo ()alxnif3iydoat  u i;s)teuo(o3iu1ape livias)s2tm(mp;t4aptn i3iytfm2eanvon(0 rtrxoctodopDrai i s  rxoxo ny1lltelnetlsfa2rru  ot0tetn f3iatfm2el(vs (4trxnir3ty1lpte n o ( t2tm(o3oydlmtnmnvtl()aDrrxrooo0optnmoeiytlsDrlnvo;u0 eerxociy1fp raivi t)s2to(o no1ll emfetl()s2rmumpot0tee ioeildlmDum( s u)trxrif3to1fate n olt) 2uoxr nodol  lfcsat)s2ta(moou0tpxnmo3iadla el( pnu)aleoxfctadfaDeln i;s)srxoiopnudlme lnvtls)srurum nu4ale ii3tltlmDra( s u) rtnxocoy1lptean i;() rumimpoo1ole mfvt s sDtmxr nt4tltomi3tldfaDrmn s;u4trxomo3ty1fa rau ols t2xr(rpoo1om emfetlt)aDtr(rpnt4aleo ietlsfm2eau s (0aetnxfctytlmD  ivs;t0s2trir no1altelnct s srrmxrpoo1aeenmieiasfs2umuvs u4tlxrif3oodlm eliei s srtmio ou1op  liei s) ruaur ;t0teenmocildlm elump;t0trxnif oytlm  auei t)s2uo(o3ny4al nlietl(fartm(mont0tle mfeiytla2rl( o t4alxnxrciodfatrli i;s0texoiopno4apt  nci t  2urxront1tltn i3tadfm2ua(vo;u)tetnmr io1oa r ivs;()sexo(o3iu4lme mfcs tfaDta(mpno1opxnio3ils aDel( s t4tetniociotoa ranvi t  2xr(opny1llenmfvt t s2ua( oou1olto fcilt s2emuvo;u0trtrxfcoo1fmte i ils) euoir3oodll e ics t  rumxr ;u4aetnifciatfa2rmnmpnu4aeeriociodfaDrlueo;t sexr(m3iydlpt miei ()aDrrx  oo0apxoif3tasfaDea(mo;(4 rtnxr3iydlmD an i s) 2ur(rpiu1ol nlfvslt  2tau  ;u0oetoii3iasfs rl(vsn()aexoir3tatfp raies s)seuoir3iodlmt mneil(fsrrrurpou0olxnmfeildfm um(vsnt) renmf3oa1fatr nvols0sruoxo3oydlleelfvtl( a2ur(rpnu4aex  iciys m rmuvs;t0artnxr3oydfat lnei;t teum(o ou1apt  ictl(f 2urx  no1aleo f3iltls2uan p u0altniocoodfatrlnvs s)t2xm(o3iodoptn icta() rumu ont0aleniieiltfmDulnmp;t)alxrif iytfpDr u il(0t2umio nodlltemnetasfarrr(r ot1ope mieiadls uan o t4aexomo iatfpDrauvs s0t2umxrpoy1am emics sf rtmx o;u0tptnii3iadfmDelumo;t)alenirctydfaDelnei s0s2uo(opnudapen neiat)s2urx  ;t1olxoiiciat a ulnvpn(4 rtnmrciotlm eanei;()srxrxm3ou1lm nmietltfs2tm(m nu4tptomfctysfm2uan ont4tetnxf3tadomt  ueo;t)srtmiopno1lleelfvia()srrmx  no1apxnif3iadlaDelu s u4tleomo3tadfate ivols0truo(mpny4apenmfet sf 2ra(r no0tet mi3iyd s rlu onu4tlermfctotfmt  ivs ( trur(o3oo4llte fcia(  2rmxr nu4ope iictadfs ul(vs u) rxnir3oydoa ran s t) ruo(o iy4om nmivta(  Draur no0oetnmiciadfs2rl(mp;(0treoxfctadlaDeaies ( texr(o nydlptelnvsls sDrax  ;o0tpxomf3tadfm2eaumonu0tlenif3ootlatelnvslt) 2tm(m3nodaleelfciasfsrraxr ou1olenmo3tltla rluvs u)teermrcoa1fmt luvo;()texoir3no1ame mieils aDrm(  ;u0apto feiadla umuvonu0teeoxocoytfm  li s t) rxmir3iy1am n fcsasfaruaxrpno1altniiciad a umnvp;(0tetnmocoodopDrlivs t0srurxm3iy4opt lnvsas  2uaxrpno0tltnmoctydlm2ea(mo;(4 rtnmo oo1op e n o t0texo(opoy4omt  ncsa(faDrm( pnt1altomoctydfa2ea(msnt0trxnxf oadlmD anvo (  2xoio3nu4ap  liet (fs2trxront0oltoif3iltfs2um( s;u)tlerircoa1fm r u i t0trxr(mpny1amtelnvsas artau  nu4apx  f3tld m2el( o;u0tltnmrcoytfm raneols  rxm(m3iudopenlnvias)aDtm(m nu1tptn iciysfmDumump;u) rxnio3oatop elueo s0teuoxr3iu1lle livs t aDtmxront1olt moetad sDumnvo;t0tlerir ootla elnvils trtrxmpnodlpe mfvt t s2tr(rp;o1olxnmoeiyt aDrmn s;(4 lenxr3tatoa e ueo t0 2trio3ou1om  lnetat) rumumo;t1aleoio3iat mDelu p u) rtnio3tadomDr uvs (0trtr(m io1amt mieil(f 2umu o;o0tpxo f3iatfs um(mp;(0trenirciydop rauvi s srum(o3nydop nlivsl(f Dtrxmo;u1optomieiydlm ulumpn(0 ltnircoa1op r uvols)trtrxm oo4altemfvi s srrmxmo;u1tltnifeiltfa2rm( s u)alenir oo1omDr u s (  etmimpnudlp  mivta() rrr(r ot0tptomf3iad mDuanvpnu0trenxr3iydoatrauvi;s0 rxrirpnydomtemnvt (fsDraxr nt0olxomocilsfsDumu s;() rxomf3iatlaDraieol()seuoimpnu4omee ivi s a2rmxmoot4aeeo octys a ea(monu)trtoir3oodopt livs;(0texmxrpnodope lnctat)aDrmxm nu1openiieiatfs em(ms u) ltrif3tytlpD aneo;s0 rumxm ny4oleeliesas) Dum(r nt4tpx  fctytfmDelums u0 lenxo3tadla eliei s s2tm(r3oydlptnliesas) Dtaumonu4oee iieiydlmDrlu p u4tlermfcty1omt li o;( s2umxo io1ame livsatf 2raxrpot0tpxo i3ildfm eaums;t)aeermo3iadlaDeanvilt)teur(opno4ap nlnvta( sDumxro;o4tlxnmo3ilt sDra(vp;u4trxnxr3iytfate nvol(  2xr(r3ny1am nmiesas  ruax pnt4oeenmfcils s rluvpnu0 lxnir3todfatrlnvi;s0t2xmxm ny1omtnlfvs t)srtm(ronu1oltn fetls m ea(vp (0 rerio tytfmDe iei t t2xmiopoo4altemivi t srrau p;u1texo o3ildlmDemu s;u4aeerxf tadomDeauvi;(0 2umxopoudalt mnvsatfsDtmurooo0olxn fetatfm ul(mp t)aexnxr totfa eanvi;s0sexrio3ou1al nmnei tfs2rru ono1oex mfctad aDrmnvp (4 rtoxo3iotomt livi;t tetmir oodll nlnctas)arra(r ;o4olxnmfctltlaDemnvp;u0trtriociatopt luvi (0 etoxrpnodaltnmfviat)srra(r ;o0oeenmo3tlslsDrl( pn(0alxomfcoydlpDrauvsls  2xr(m3ou1lpenlfctatf Dtmx o;t0tpxnmfctatfsDul( s;t0artnxr3oo1la r i ols0 2uoxo no4om nlietls a2umu  ;t1olto ictat a umn pnu) eerxo todfp  li s (  rxrxr nodllee nct tfsrra(rooo4aleoifciydlaDeau o ()tltnmfctotfptrauvs;( s2ur(mpnu4ale mnvtatf Dtax  nt0aetomfeiad sDemuvont) ltrmfciotfp rlivo (0teurxmpiy1apeelnvs s  Drrumpnu1ope  i3iyt a2el(ms;u)tlxoxr3iodlatr nvi t s2ur(rpiy4ol  lieiltf Drax  nt4texoiietatlsDul(vs;u0 exnmr oa1oa eliei () rtrxmpiy1ap nlfetl(f Dtr(m ou1tpe  o3ias mDeauvo;(4 exoxf3iatoatrli i;s) 2tr(opny4lpte ivtls)sDtrur oo0oltnmf3iyt m2umn p (4aexrmo todlpDranei;(0seuo(m3nudom  mnet t)arum( oou0olt iociadlm ra(vo t4altomo ootlmDr ivo s)srtmxo3iy4al eliesa( a2trurpoo0olx mf3iltfm2elu sn(0 rxnif3tydfptrluvs;t0truoxo3io1ame lnci sfarur(  ;t0alxnii3tldfmDra(mpnt0 lxomfciytla   neo ( srtm(m3nu4aptemicsas arur(m oo0oet mfeiytfa2um(mp (0arerxfcootfp ean sls0 2tm(o3no4lm  lict (  rtrur ;t1aex mietlsfs2em(vp u0tltoxf oytfmteau i;t0 2xmim3iy1ll emneta(faDuaurp;t1tlxoiieiaslm2ua(msn(0 lxrxocoa1la  ln i (0trtoxr oo4lm nlietlt)srta( oou0tpe mfctys m2ua(mo;u4 renir3tadfmt ln i;(0 2urxopno4olenmivtatf Dururo;t1tltnioctad aDumu sn(0 ltrio3oa1fmDr u o;s0truoio nudope lnvtls)aruru  nt0opx ifetatfa2rmn o (4teenxocio1lptranei s0 rxrim3oo1alt lietlt  Dtmuronu1aptoio3tys mDem(ms;u0tlenmr oytfp rlieo;(0 exoxmpio4lmtnlnctl(  2urum ou1apt  fciltls2uaums t)arxoir3tytomD  uvs t0s2to(o oy1lpe mfei sfaDururpou4tpeoioeiatfs ran o u)trxrmf3iytlaDrli o t setrim3io4ap nliesa(  Dumx  ou0apeo fcilt a ulu pnt) lenmr3oy1oatrli s;( tetmxr no1am emfeiltfarur(mpno4oex ifeiadfsDuluvo;t4 etomrcoydfaDelies s0teum(mpny1omte fct ( sDuauro;o4alt iociydls2el( pnt4 renxo oatlp rlivi ( srxrim iu1amt liet (  2tru o;o0olt moeils mDumumo u)aleoiociadfatelivo;t0trxm(r3oo4altnmivilsfs2uau ooo4olxnmo3iys m2rm( s;u0 ltnio oadlpDrlnvo t  2xm(o io1op elnvi s)srtru ono4oltoifetydfm2elnmon()trxrxr oy1oa e nes;t0 2tr(r oudlpenlfcia()srum(rpoo0tltnii3iysfsDul(mp t)tetnxr tadfatr ivo (  exr(m iodlle lfcs s)arrrurpot0olxnifcildfm umumpnu)trenxf tatlatranei ()truriopoo1optelfci ( s2um(monu4tlxoifciys sDranvs u0arxoxo oadfmteli sls  2triopoo4llte nctls)artaurono0tee mociys m eau o;t0trerio oytfmD  i i t0 rxmxrpio1lm   fetl(  rtaxrpnt4opx mi3ilsfs emnmont4 rtoif3io1op  aieil( srxrxopio1lpeemneta()srrr(  ;t1ope mictysfm eauvpnu4arxoio oadopDe nvo () 2uoxo3iu1alenmies ( a2uaum oo4oetomictasfm2ul( o u)artnir3iodomt ai il()trtrxm3oo1lptn ivia( s2raxmpoo4aee if3iltfm em( p;t) exomr io1oaDrluvols  eumirpno4ole lieil( s2ua(mp;t4aetn fcilslmDranms;t) exrmrciydlmDe ivol()t2tm(mpiudlmtnlnetlt  rtm(  oo1apxniieiys m2ea(ms;(0teeoxf3tatoa elueils0 rurim3oo4lm  mfct t)srum(m no4olxoioeiydfs el(mp u)alermrcio1fat aues;s) 2xoxr iodap eliesat)srtrxront4optn octls mDuaumonu0 rtomf3oydop ranvi;s0srtmxopoy4ope mfvias srrruront4aex iieiatfa ranvs t4aexnmf iatop   n i t0trtmio nu1lpt  icilt sDuaxroot4olt  fcils mDemn o;t4 rtnmrciydlatr neolt  2toim3iodal emiviltf 2um(mont4tpxoiiciadls2umn s;t0artrmf oydfmtraneil() rur(m iy1lltemivtl(fsrrmur oo0tle mf3ildfa ulnmo;u0artnircia1late ies;(0t2xmxr3nu1omtn ieilsfsDuaxr ;o4apxnmoetys m rln p;t0tltnio io1laDelieolt0t2toio3oydaltn nvil()aDrrum ou4aleomf3tadfs el(ms;u) rerxr3iy1fpDrai o t0s2um(mpnudlm nlfvsas  2ta(root0aexn ociyt a rmumpn()treoio3oatom rau i t)sexoirpio4am e neiltf Dur( ooo1tex  ietatfm uanvp;t4trenif3ia1lp elnvsls0s2xriopiy4alee fvilt)sDur(  ;t4olx  feiatfaDranms (0 rxnxr3oy1lmD ln ol( t2ur(opnudlpen nct t aDumx pnu0aeenioeias s2emn snu4artrxo to1fm   uei;s srur(rpny4ll n net ( srur(m nu4aexo i3iadlm2uln p t0alermo3tatla  aueil()trtmxm oo4ameemncilt) rtrurp;o4aee ifetydfaDrm(von(0 leoir3ootomt auei s)setoio3ny1om e ieia()s2tmurooo0openmictyt aDrlums ()artrxfciydoa  auvo;(0 2uoxo3nu1am n feia()s2umuront0tee iicilsfm ean pnu0arermrctadop   n o;t0s2uo(rpnudlp emfcsa()s2tau ono1aetomieiysls2emnvont0aexoxf totfpD aieo;()srtoxrpoy4ome lfct (  Dtmur ot4oeenmieiatlm2eanmonu0areoxf3iodopDr u slt)trxr(r3oydopeemfct (farurx o;o4teeo o3iatlmDuan snu0 rxoiociadlatrlieilt0trxmxr oy4lp  miesasfa2urum ot4ope  feils m2uluvs;u)trtnmf3oatfmDeluvo ()s2uoiopou4alt mnvtl(fsrtr( pnt4aeto oeiaslm um(ms;t)trxrxf ootfat  nei;()s2tmirpiu4lpeelncia(f 2ua(  nu1apxomoctls mDeauvs;u4teerir3iodla   iei;(0sexrir oudlmtnmncsl(  2taxrpot0tltomo3tytla rl( s;t4 ltoxocoa1lmtrauvo t  2umim3oy4lptnlivtatfa2uaum no4tlxnifeiydfa um(vo;t)aeeoirctodfmtelneo;(0s2xo(rpno1al nmfcs tfaDur(monu4tlt  ociltfm uauvp t0tlenmo3todla r ieo t) rto(o3nodopenmnvia(f 2urxroot1oexnmi3ilsfsDel(vp;(4 rxrxociodlmte iei t  rurio3nu4ol  lict sf Dta(m ;o4oltomfciltfa emnvpn(4 eenxo3to1fa   ueo;t0seum(rpoudamt mivi t s2trump;o0oexoif3iltfs2rlnvo u) etoxr oy1fmtr ivol()trtmir iu1ole  iei t  2tr(  nu4tetniieiltfm umnmo (0altrir3tydomte i i s sexmxm3iudlp nmnviat sDtmurp;t4oexn octydfaDea(vo;u0 lxrif todla elnesls) rxoio3iu4lmtn nciasfa2ur(rpnt0oexniocils s2umnvs;(4 lxnxoctytom eai i;(  2xrxm ou1apt lnvilsf Dtau  nt1opxoioctysfsDumums u)altnmo tadomtrai s t0s2toimpoo1apenmfeslt  Draur ou0tpxniocildfsDum( pnu4 etomfctodlaDeauvi (0 2trir oy4lmtnmfvils  Duaum ;o4texn ieiysfm emn s u0tlxomf oatfat ai s;t0tetmxr3io1lltn fvs ()a2rm(r ;t4altn oeiltla2ua(mo (0alxrir iytfmt  nvsl( setrxo3ny4ameemicia(fs2tr(m ;u0aex mieiysfs rauvs;t) reomr oatoptelueol( srxoxm iu4alee fcs (faDurx pnu1oex  icildls2umnmont4tlerxr3oo1lp   u olt)texo(o3nydapt lnctls) 2urx p;o1apen i3ildfs2emumo (0arermrciadfm  anvils setoimpiudll elfctl()aDum(m ot4tleomictyt s uanms;t4altrmr iytlptelivs t0setrxr oo1ol nlnei (fsrrmxmpot4teeniieiytla ul(vo t4 leriocia1fmDrlnvs s teum(o io1omen fvsa()srtax  ;o1tet  ietlslmDuau o;u4artoif iytomte uvi (  2um(o iy4lptn ieilt) rtmxmoou1opt  iciys aDum(mont0altrmr3iodoatr ieo (0 2umim nudllte feslt)s2urur ou1opx mo3tadls2rauvp;u0tltnmfciadlp r n s t)s2xmim io4lm elncsltfaDrmxm ;t1tptn fciadlaDeanvs;t0arxnxoctadoaD auvo;s srxmir3nodamt lnvs ( srtm(  nu0tlxoioeiadlaDrmu pnt0arxnxf3oytfpDe ivi;t0t2umir iy1alt  ieia()aDra(rpot0oetn fctldlsDrmuvs;t)alxnxoctatlmD au s;(0trtmir oodlmtnlnci sfs2ta(moot0oetnifeild a2rmnmsnu0 rxrif iy1omtr uvilt0seuoim io4oltelfeias)srtrxmp;o0tet iociyd a2rl(vo t0aleoxo3iy1optraueo;s  2xoxr iydllenmfetasfarurxroou4opxnio3tad a2rm(vp t) rtnxocty1fm rauvs;s)teuo(r3iu1lm emivtlsfaDum(root0tetoioeiltla2elnvo;t) reomrciotfmt  uvs;t0t2tmxm3no1lpteliei t  2rrur ou4aptnmo3iyd mDumumpnu0trxomrctydop rluvs () 2xmxrpoo1omtelneta(  Draurpnu4tlxniociyd aDua(monu)trtrmr oa1fmte uvs;( trxrimpoudlpeemiesat  Durumo;u4olt io3tld aDrl(vs t4aetrmo3oadfpte ivolt)setrxopnydalt  ncsa()sDtmu poo0tpxnmieiytlsDra(vo;(0texnir3iy1opt  u ils)s2xm(o ny4lmtelnvils sDtr(mpoo1tlx iocild m2rm(msnt)alxrirctatop   ivsls)teuoxr3iu1al   ieil(f Drm(mo;u4alto oeiltfsDum(mo;(4 eenmoctodlmt aiei;t) 2tmim3iu1ll  mfctat  2trxr nu4aet ii3iltfm2eanvp;(4tetnmr3io1lmtr n ol(0trum(m ny4apenmnvs tf rtrxr nt1tet ifctasfa2eanmo;t4 rtomo iy1lmDelu s ()sexmxo iy1optnmnvta(fartm(  nt1tet  oetas s elu snu)tlenxfctydopDean s;s0 exoxm3ou4op elivt s) 2rax oot1oeto feild sDrauvs ()alxnxfcoo1lateai o;s0 etrim ou1omtn ivt t) Drr(  ;o4alxn ietld a2em( p;u) rtrxo3ia1lmt  ueo (0sexmim3iy1amt mivilt) 2ra( p;o4opto oetadlaDum(vp t4aeeomo oatlm e i i t) eum(rpiodom  mnci sfs2tmxm nt4aleo oeiadlm2emnvpnt0 lenxr3iydfptrauvi;() 2trxr iydamtelfcs ( a2rru pnu0tle  iciydlm ra(ms u0tltomr3ootop eaueolt)seuo(rpiu1omtnlncil(f rrmuro;u1aexnmo3ilslsDra( o;(4 lxoxo tydlpD aneo;s  exrxr3oodom  lnvi (farurx  ;t1aex ifcildfm rl( o t)aeerxr iatfm   i ols) rum(r io1omtelnvta() rta(rpot4alt mfetadfm ulnvp;u4 reoir io1fpDraieol()t2tmirpoy4alt  fvtls aDua( oou4texn o3tatfs eluvsnu4 leoio3tatlp  anvo ( srxo(m3io1omeemfesat arrru  ou0teen octys m2umu s;t4tetrmf tadlmte ieo;()srtm(r3nudam n ieias) 2tmu  no4tlenmf3ildfm2ulumo;u4 lxnmr3ta1lp rlu i;s0trxoxm oo1am e icta() Dtrumono4aexnio3iyd m2ranmpnu0aeermr totfpte ues;(  rxm(r oydlle  fvsat a2rmxrpou1tleomf3tydfs rau pnu0arxomo3tydom rlues s) rur(o3oudalte nvsa() rtmurp;o1opxomoctyd a2rauvp;u4trenmocoodomDr nvs;t0seum(r no4llt lneil( sDurxmonu1tetomfciltfa2rmuvpnt0aexrxr iatfmte ivsls) exoxopiy4lpeelivtatfa2rmu o;t1oet mo3tldfa rln pnu4 exnxf oadlpt aivs (0trxoxo ny1amt  nei sf rtaxmpnu4tltnio3tadfm2umu s (0tleomo totfaD  ueo;s) 2xm(m ou1ol nlfcias a2taurpno0olt  ieiydla2ua( on()aexoircoadoatean i;s0srxrio nu4lmeelfctlsfs2ur(m ou4oet mo3ildlm2rm(vp u4tlxnxrciatop  lu i;t) eumxopiy1aleemnes s)s2tau pot1tex ii3tas m2em( pn()areomrciatop rluvs;s0tetrxr oo1omt mnvsl()srtrxro;o0tet io3tltfm emu p (0 eeniocty1opt au ilt  rxrxm3ny1ll e feslt aDra(r ;t0alxomo3iyt a2ra(vs u)arerif3oytfp eau o t0teurxr3oydol   nctls arra(mo;u4tlt  ictasfaDrl(vs t)tlxrxrcoy1lptr ivo;s0trtoim oodamt mictlt) Drmum ;t1altnii3iys s uan ont0 ltnio oytomDe u s (0trtoim3io1llenlivt t  Drru o;u1tpxoiiciydla2ra( p;t0tltoxfcoodfmDeaueo;(0seto(r3nu4open iesat)aDrauro;u1texoioetadfs2ulnmsnu) exnxrctadfp eaueil( s2uoir3iu4amen ivt s srtru  ot0oeeo fetlt sDua(msn() renmoctytop e ivo t) rtr(m iu4lltnlncilt)a2raxm oo4altoii3iatfs eanvp;u0tetoir oydla rln o;t s2xm(r iudameemfcslt  2raum nu1oex io3ilsfm elnmpnu0 rtrio ia1fm  au ils srxoxmpoy1lp e iviatfarrm(rooo0oleoiieiatls eanmon()texoxo ty1fptean o;()t2um(rpoy1ap emfesls) 2uax o;u0tpxo o3iyd mDulnmp;()arenmrcootlpD  u o s)s2xr(m3iydopenmies sfaDrruro;t0olxnmfciyt mDulu s u0trtoxo tydfa r nvo s) 2tm(rpio1lpe  nvs tfsrurx p;t4tlxo o3tydlm ean s;(4altnio iy1latranvo (0 rur(rpnydom nmies t)sDurxm nu0tpt mf3iytlm2um( s;(0arxoirciadfmD anei;s)trxmxrpiu4ope  ivt s  2trxrpnu4tlto feiytlsDeau pnu4aleomo3to1fa  au i (0t2tr(rpoy4om e ies () 2rmu o;t4ope mo3iydls2em( p;t)trtnmocoytlmDrliei;(0t2xmxr3iydlpenmncsa()sDum(mp;t0apx  fcildfs2um(vsnu) rerxf oatoaDeliei;( srxmirpiu1om   feilt)aDraumpoo0tptnmociatlm ranmpnu)arxrmf3ta1la   ueol() eumxrpny1openmfeiat a2ra(m ;o0open fetad a2elnms;t4 leomr3iodfpD  ies;s0srxm(r3iu4alenlivt tfarrmxm ;t1olt ifctatfa2rau pn()arerxo3oo1oate uvolt0srumim3nodal eliet ( aDum(rpnt0oee  ietldlaDuluvsn()tltoir oy1fa  anei;s s2trxrpiydolt mnvilsfa2um(r ot1teeoioeiydfsDemn pn() renxrciytopDraiei t)srxoxmpoodap elfesa( srrmumo;u4opx ifeilslmDemumpnt) exomo3oytoaD anei;(0 rumim3iu4lpe  ncsatf 2rau pnu4opxn o3tyslaDumu o;t)trerxf tadfatranvi;s0s2toxm iodolt lfvil(f 2tr(ront4apxo i3iys s eaumo t0 exoio3iydom   ivs;t t2xrxopou1amt mncilt)arur( p;t0tet  ociatfs2ulnvpn()altrmr iodopD livilt0t2tr(o oudlptemfviltf rrax onu4optnmiciytfs uluvp;u4trxomf iydla rau s;()seuoir3oudamen fcsasfsrumu ooo1optnii3tatla ea(vo;()trenmrcoy1lp eaivols t2umxo3ny4aleemnciatfaDtm( o;t0oex  i3tatls um(mp ()tltnif3ta1om   nvo t)seuoxr nu4lpt  ivsltf Dtaxrp;t1aet  ociyd s2el( s;t0 lxnmr iotlat livs;(  2xoxrpoy4omt lfetls) 2umumpnu1alx mfeiltfaDum(vs t)treomf todla r neo t) ruoio3oo4olt lneslt)aDtm( pou4tlxoiociadla2ua( p (0 rxoir3ta1oaDeau o;t)s2umir iydll   fesltfa2rr(roou1altn fetydfm ra( onu0trxrmr to1laD  ivs s) eumxo iu1omen icsat aruaump;u1aeenmf3tys m rlu p;t4 etrmo totfptr neo;s0 rxmxopoodlle lnviltfarumum ;u1aexn icils s2um(vp t4arxoio3oa1lpt an s;s0s2urim ny1amte fvsls)arua(  ;u4tleoif3tlt sDuanvp (0 rtomr3iotfp e nei;t0srumimpiu1ol n neia(fsrur( o;u1opt iictyt m2rmuvpn(4 ltoxo oodfpDelnvi;s texriopou1am elicsas  Dtr(  ou0olxomi3iat s2el(vsnt)trxrio to1fm r n ils)texrirpio1lptelietltf 2tmxmp;o4apen o3tasfm ulump;t4aetnxrciatfaDeai o t  rumxopiudamen neias  Drrx ooo1apen iciadlm eauvo;t)artrir3tatfmDrauvsl()setriopoo1openlivtl(faDrr(moot1alt mfciltfs2eaumon(4arxrxfctotlaDe ueo;(0s2xr(o oy1ll   nesa(fartm(ro;o4tleomiciyt a ranms;u0 exomf oytla eluvilt  ruoxmpiu1omtn nvtl(fartaxmo;u1tee mfctytla uluvo;() lermo3oadlp  lu ols0srxmim ny1lltn nvtls)srrr( oou0oex  oetys m rm( p;t4 ltnir todfp   ivils0trum(r3iu1optn fcsl() 2ur(ro;o0tlxnmfeiytlm ra(monu4arermr todoate nei t0t2xoim iudop nlivsa(fsDtaxmpoo4aleoifetasls2ulnms t0trxriocto1fa rlieslt) 2xm(m nydap   feias)arrmuro;o4tetoifetlsfaDra(ms () exrmr totom raies;()trurir3ou4lptnmnvsasfa2ra(m ou0opt iietat aDemums;(0trxoxo tadfatrln s;s) 2tmxo3oydlp nmncsas sDururpot1opeoifetys sDrluvp t) lxomf iadfp  luei (0tetmiopno4ap   iei (  Drmx ont4oeto ociyt s2raump () etoxoctydla   iei t)srurir3nu1ap nlncsa() 2rr( oot4alxniiciytlsDra(vp t)aeermf totomtrlneilt0sruoirpiudalt mfct ()aDtaum ou1olxnioeiyt m rmnvs;(0 lenir oa1oat lnvsl( s2toxo3io1lm nlnvilsfsDtaxrooo0texn f3tasla ranmp;t4texrir tadfmDrauvo;s)truo(opou1apte icias arta(rono1olx  ietadfm2uluvp;(0tlerxocoodfa   i s;t  2to(r nodlme mnci () rurump;o0ole iietys a2emu s u)alxoifctotlptranei;s) rurim iodol emneiat arra( p;o1ape mfciltla2eanmsnu0aeenxr3ta1optrlnvsl(  2toxm iydll emies ( a2umu o;t0oetnio3iat s2ul(mpn(4 lermr3tydlaDrau o ( t2tr(rpoo1alenlicil(farururpno1opt moeils a umn p;u0trerio3ty1optr u s s0 rtoxm iodapeemnet t sDur(r ;o4opxn ociasfm2emump t4aexomo oa1laDe n ils)s2xrir3io1oltemfvt t  Dtmx p;u4opxnifcils aDrlumo;u0 lxrxf3oadomt auvsls srto(o3oo1ale mncta()s2rm(mp;o4opx ii3tasls2raums u)arxomocio1latraueols)sexmxo3oo1lmtn fvsatf Dta(roou1optomo3iytla2ul( p;u0tlenio iodom elueils)t2toimpiodll e netltf rrmx p;u4tpe iiciyt s eanvs;t)tltnmo oydlaDelu s s) 2tr(r oy1ale mfeia() rum(m no0oeen ociaslmDrlumsnu) exomr ta1fpt livi ()trum(r nu1lle mncsatfaDuaurp;t0aeenioeiydfm2elums (0aexrmocia1laD lu s;t0 eum(r3ny4lme  ncs ( arrrumonu0tpeoiieiytlmDumums;t)aeerxf3oo1la eli i;()s2trio3nudlltelietlsfsDrrxmpou1olt  f3iydfaDeau pnu)teeoir iytoatrln s ( s2urxr3no1lm n fct sf rrm(m oo0aee ifciys mDrln s;u)trenxfcootfa  livsls s2umir nodoltnmictlsf 2rrumont4tex mo3iat m2rauvs;(4trenxociotfate u o t0 2ur(o io4ll n ici ()sDum(rooo4ale mociys a2ua(vsn(4artrxrciadfm  aies;s sexoio iy4lptnmnes () 2urur oo1oexoioctyslm2ean pn(4alxrmf3iydoatranvo s tetoir no1amenmnetls)a2rrx  ;u4opx mo3iad sDelnvs (4tlxnirctadlaDrluvs (  2uo(opiu4llt  fvt s  2rrurp;t1tlx iietasla el( p;t0 exrxf ta1la eliesls srxrimpiu4om elnvi sf Duaxmp;u1opeoiictldlaDumumo;(4trtnxf3oy1oaD li o t)teumim3nu4lpte fvtlsfartrumoou4tleo ocilt s2ulnvp t0 rtoxf3io1lm   ivi s  2xoir oy4llenlnetls)a2rmxmono0oleomo3iasla emnvont4trtoxfcoa1lm r uesl() rxoirpiudaptnmncsa()sruaumooo1apt  i3iyd sDul( s;()aeenxo3oa1oa eli i;s0trur(m3no4om elnesas) rurxmoou0alxomiciytla elnmpn(0arerxocoatlm eaueo (  rtmim oo1lmt  net sfs2rrumooo4tpxnmfeiatfaDrl(mpn(4alermf3todomt auvi s0trumirpiodlm  lfesat) Drmu o;t4tetoiocilt a2uanms;(0teerxf oa1omtrluvilt0texo(r3oodlp emicta() 2tr(rpou0oltnmoeiltlm el(vs;u4 eenmo3tatlatraueolt s2xoxopiudomt lieslt aDumumooo4texoii3tldla2rmnvp t0tleoif oa1lm  an o;(0 rur(o3iu4lptemfeilt)a2ta(moou1tlxnmf3ild s rl(mo t)aexoxr oytopDeln s s0tetoim iy4om   net tfa2urumpnu1opxoio3iyd s eau p;(0aetnxo3iytlaD au sls trto(m3oy4lle mnvtls)artr(  nt1ope iictatfs2em(mp u)arenxfciadlmDr u ols0setr(r ou4am emfesltfs2raxr ot0teto o3ildfsDrlnvp t) lxoifcta1fm r i slt0t2xr(rpiu1op nmnvt tf rrax  ;u1apeomi3tadfa ul(mo;u0trtoxrcoytoaD aivslt sruo(rpio4lm n icsas) rrm( p;o1texo fciadfsDra( pnt0 lxrxo3totomtrluei;() 2uoxo3iu4lmt mies s srrrx oot0oetn oeilsls rl(vo;t0tetomr iydoateaneilt) 2urxm3oo1aleemfvias) 2umu pnt1aet mfetad a ua( s;()arxnxf iadop e iei;t s2uoir nydlpee fetatfs2uaxr ;u0alxo ieilsla eln p u0tleoxo3oodlpDeanvilt trxoir oy1lle  nvi ( s2ur(r ;o4tleo ieilsla2eanvsnt4teenxfctytfmtr ivi ( setoxo nudam  livias) 2ra(rp;o4tltoiietlsfm2rlnmo;t4alerir3io1lm  li i;()srxrxrpou1apt lnvt t  2ta(mp;u1tle  ietytlaDua(msnt)aeerir oatomDr uvi s0teuo(rpoudame mfvta(  rrmx pnu0opeomi3iys a um(mp;(0aeeomo totfaDr uvi s0teurxm no4amt  nvsl(fs2tmu  nu0alxnmoctydfmDua(vp;u4 rxrmr3tatoptr ues;s  etmxo3iu4omtnmnesasfartmxroou1aex moetatlsDua( sn()artrmr3tatlp eai s ( trumimpoo1lpenmncil( s2ur(rp;u1tpxniictldfa rln pn(0 lxriocty1la  anei t)srtm(o oy1apen neiat s2tmur nt0tpt  fetltls elu p;t0trxnio iadlptrlnvo t) rtmio iu1lp elfetlsfarumx oot1tle mfeilt a2umnmonu0tlxoxrcty1fmt  ivs;t  2xoir3oy4omenlictlsfarrrxm ;u0oee  o3tydfa2elnmo;(4texoio oytoat  neo;s0 2uoxr3nudopeelfctls) Dra(  ;t1olt ioeiytls2rau onu0aexnmo3tydoptran s t)trurirpiodol   ivils srra( p;o1tle  fctad aDra(vsnu)teenir oodfmD liei;(0 rto(o3no4op  lnvt ()s2tr(  ;o1ole  f3iad m2raump u4tlxrxfctadop r neo t) exoiopnydlmenlivi () 2umxmono1ale if3iyt aDum(vpnu)treomrciadop eaieolt truoir nu1ap  mietat) Dum(m nu1opx mf3iysfa ra( snt4aexnmo3tydomDrauei ()setrxo iu1lm e ncsat aDtr(monu0apxomo3tatfs2eauvpnu) lermf iydfpt lneo s0 rtmxo ou1ome  fetlt sDrm(rpnu4tlx ioeiadla ranmsn(0trxrmo tydlm  lu i ()seurxrpiu1lmt  nvta()aDumumpno0alenifciasfmDrauvpnt)trtrio3oadfmD  neo;()sexr(r3iu4alee fcilsfs2ua( ont1tpxnmociadla2elu pn(0trxnmfcoo1fmtr ivi;s) 2uo(mpnu4om nmnvsat)sDtmu p;t0tetnioeiydls2ua(vs;u) exnmf oo1fm rliesls s2xrio3iu1ol elnet tf Dtmx  no0oex  o3iadfmDra( ont4 exoxocoadlpD luvilt srtrir3iydaleemnvi s s2taxmooo0aeto fctydfa2em(ms;t) rerio oydop   n s s) rtmxmpnu1op  lfvsltf rum(mpou4oleniieiysls em(vpnt0 etnirciadlm rauvi ( srxo(rpoodapeelnct sf 2ua( pnu1oleoifcils s2rmn p t4trenxoctadom e ieo;t)srtmim no4am   feslt a2tm(rpou4apen iciadfs2uln s;t) ltrif ia1oaD ai i () 2xm(r3iodomeemfvsatfs2ta( ono0texomfcilsls rluvp (0 renif ta1fm  auei;(0 ruoim3ou4optelfetas arrax  ot4texn ocildlmDeau pn(0arerxf tadlaDraneilt s2xmirpio4amee ict t aDumurono4tpxo ictad s ea( sn(4trermfciytfpDr iesl()sexmxr3oydome mfes s) Dtmu pou4aleo i3tysfsDrl( snt4tltrio oo1lmteluvo;s0 2urxopiodom   icils)s2ta( o;u4aeeo oetad m2rm( ont)aexnmo totlpDe ueo;(0trtrxmpnodlm nmivils)a2rr(r no1oex mo3ild mDrlump;()arxomf ta1oa e u o;t trxrir oodlp e nvi sfartau  ;u0opx mo3iadls rl(vo u0 lxoxociotlatran s t)seto(m3oydlltn ivsas)arrrxmpoo1ole  f3tld aDranvp u) exrirciadlatran i;s)tetrxrpnodom e fvtlsfs2rmuro;u1apenmf3tldla umnmpnu0 rerxfciadla e i sl()t2trio oo1ope  ivilt)aDta( pno1tltn i3tlt a2el(vs;(4arxrir3iydop  lu o;()sruoirpiodlp elics s a2rmu pou4tptnmoctat s2elnvont)arxrir oadfm rauvsl(  exoxrpoydal emnctas)a2rm(ront4tpt  i3tatlmDul(mo t)alxrifciadomDrau o t)t2trir3iu4op emfvsas)aDurx p;u0aleo octyt aDemu o t) exoio tytomD lnei;s trtr(o3ny4lpe lfes s aDtmx oou1alx  oetltfm rlumsnu0aexnmrciotfmD li o;s)seumxr iu4lptnlivta( aDrmu p;o4tpx iictadfaDeluvp ()tetomfcto1faD  ueo t) 2xoiopno4ope  iei ()s2rru  ;u1tptnmoeiad m ran pn(4texnmr oa1laD luvs;t)tetmimpnu4omeelicta()aDumx o;t1olto feiytfm2um(vpnu4artomr oydfpD  neo;()t2um(o nu1omtnmnvtat)sDumxm nu1alxomiciyslaDua(vs t) exrmfcoa1faDrluei;t s2uoxopoy1omtnlnvt (fa2rm(r nt4olen oeilt m2rmuvp (0trtnmo3tydoptr nvs;s) 2to(r3io1ol  licsas  rtm(  oo1aetnmiciydla2rmu sn(4trxrmo3to1lmt anvo s)truoir3iudlpt  net (  Dtrurpot0tetomfcildls rlu s (0 lxoxfcoy1fptraneil( s2xm(r3io4lmee nvsat)sruaxmp;u1oee miciat s2ran snu4 exomo oodlm elivs;t0srxr(r iodoleemfetls)artm( ont1tetn ieiytfa2elnmp;u) rxniociytomDelivilt) eur(r no1ale mnvsa( s2umxronu1alt io3tldfm um(vo;u4aetoxf3oadomt auei;(0tetrxm3nudapen ivi s) rra(mpno1tltoioeiyt s2ua(monu)aexrxo tatfmDe n ils0 rxoim3nu1lpeelfeiat)sDraxmp;u4tpx mo3tyt a2umnmont4artrxrcoadlmte uvi ()trtmir3nydlmtnmnvi t) rua(mo;o0tex ifeiatla2umn s;u4 etrirctadlp eauvols)s2urim3ny4ol   ivt t sDuau  ;o0aexomfeiadfmDumnvs u0 ltrifciotfat lu s;s)s2uoxo3ou4lp  mfct s a2trumont0ape  ictasfaDemu pnu4artnircoo1fpDe n sl(0 2xo(r no1lmt lfet s sDtm(rpoo1optomfctas a2emu o ()tetnmr3ty1fat  n sl( t2um(opoy4amt lfctlsf Dtmxm no4apx moeiltla el( pnu) ltnxr oydlpDrln ol(0 2um(r nudll   fvt ( aDuaum nt4aexoiieildlsDea(vp;(4trtnmf3ty1op  aneo;s)srur(opio1lmenlivsltf 2uax  ot1oexomieias aDrluvs ()arxrio3iydlpD auvi;t0 2tm(o io1lptnlfetlt) Dta( ont4aet mi3tadfm2uluvpn(4aetnxf oytlmt lueo t0tetmio3oo4open ivils  Dta( o;u1aeeniieilslm2ea( p;t4 rtrxf3ia1omt  u s;() etmir3ou1oltelictas srrr(m no1tptnifetysla2ean onu0trxomfciotfa r ivilt  2xr(o iodol   fvslt  rrrum nu4tet miciatlaDuaump;(0alxnxf3iadoatr ieslt  etrxo3iu1aptemnei (fartm(ronu0alt iiciydfsDua( o u4tltoifcto1oatran ols0t2xrxopnodameemieils)sDraxr ;t4opx ifciasfa ea(vont0aexrmociydfaDrlnvils0t2xmim3no4ole mivta(  Drax  ou4tpx mo3iasfmDuanmo;u)tltnif ia1oa  lu ols)s2uoxo3oydam n nesls  Dtaxr nt1oeen fciyd s2elnvs u4teenmfciotfm e ieolt srxoxmpio4ol e fct s  2rmx  oo0texo fctldfs2ul(vo t)areomr3iatfmt aivs s0texmio3ny1lp n ivilt)sDtrumpnu0apx mfeilt s rmnvont)tetomo ty1opDelies;(0trurxr oydlm n nes t  2tr( o;o1texomiciltfa rm(vp u0teerxo tydfptelueslt)s2xm(rpoo1lp elfviat a2tm(m ou1olt  iciltlmDea( sn()trtrxo iadfatrln o s0 2xmxr3ou4llee netasfartmxmoot1ale iieiadfa2umn snu4aeerirctytfaDr n olt)teto(rpiy1lm e nvils sDraxrp;u4ape mocildlsDuanmsnt)alxomoctytlat  neol() 2ur(rpiu4ope  fvsat)arrmx p;t0optoioeiasls ulnmpnt) etomocta1fpDr u ilt)setr(r iodlpe  ieia(fs2tauroou0tptnmieiydfaDemn o;(0arxnxo3iydfptrluvs;(  exoiopoodamtn nvsa(f 2rmx o;t0oeeoif3ilslaDel(mpnt)tleomfciydfa raivols)s2toim3io4omeelietl(f 2tru pnu4oexo i3tldlsDrm( snt0 etnif3iy1om  ln o ( teumirpiodol nmfcs s  2raur nu1oetnio3iadfa2ulnms;(4aleoxf3tytfatran olt0t2xoir iy4ol  mfvs t)sDtr(mpno1oetnmo3iltlmDel( p;t0teerxo3ia1lmD li o;t  rxm(m oo4op nmietat)aDraur ot1aleomoctatlmDeau snt0trerxociotopDrai s;t trxm(o ou4op emnesat)sDrm(m ;t0aee  octysfm2uaums t4trtoir3oo1fa raivo s0truriopoydop nlieia()artm(mpnt1aex  i3iyd s2rlu ont4arxrxr3tydlp  lu s;s0srtmxo oudlpeemivi s) ruax  ;o0aexnmi3tas aDuln s;u4trtoio oydfmt li ols)truoim3oo4oltnmfesl(fsrrrumpou0oexniicild a rmumo t4trerifctodfm  li o s  2tmxm3iu4op  lfeia(  2tmump;o4oet  o3iyslaDra( o (0alxnmfcio1lm r nvo;s)s2xm(mpiy1oleemfetat  rrrumpot0tlto feilt aDuluvs (0trxnxr ta1fp raivs s0 rxrio oy1omenmnei () rtaump;o4apto fcilsla eaums u)teenio3oydlaDraneolt)s2uoxr3oodoltnlicil(faDrru  ot1apxnii3ilsls umnvs (0trtoif iodop  luei;(0 2umim io1omt liesasf Dra(  ;o4tlenmietlsla2ranvpnu0aexnmoctotlmD anvo;()trxo(m ny4omenmfvs ( a2uauro;u0opeomf3tlsfa2ra(mo u0 rxnmr3iytoa eaieols tetmxm3iu4ol nmnviatfaDtr(moou1olxomocias m rlump (0 ltnxociy1lptr nes;s) rxmxrpoo4olt lieils a2ta(rp;o0opxn ictasls2umnvp;t)tlxrxr3oo1fp   neolt)srxrxr ny1lmt  feiat) Durump;t0tlxn ieiad m uanvp;u4 rxrmrcta1opteai s;(0setr(m no4am nlivtlt)aDuaump;t0tleniocilt aDrluvsnt0 leomocia1om elueo (0t2tr(r nu1ol   feil( s2uaur nt1tpx mf3iytfa rm(mp;u0tltrmfctydop  auvol(0 rurxmpnudlm   ietasf 2rmu poo0aptoiietaslmDrl(mpnt4 exrif3iodla rlnvi;t)srtmim oodomen iciat sDurump;u4teen o3ilsfm ea(vs;(0 exrio ty1fa e ivi s setrxrpiydom   fcs sf 2trxroot0tpt  oetasfm2rauvo;t0aeenxr todfa elies;s  rxmxopnydlmte nvia(fa2rmu ont4apto o3tyd a2umnvont4aexomocio1oaDe neo;t0texrir3iodll e ivtatf 2trurpno4tee ifeiltlmDuau s u4 reoir ootla rlu olt)trtmio3nodapt  fetls) rurumono0tpe  f3tlsfm2rmu on(4tlxrxr iatfaDr ivs s) 2uo(mpny4lp   feils) ruax  no1tetnmo3tytfmDra( p (0texnxo3iydoa   ues;(0sexo(m oy4alenmivtat)sDuru  ou1tltnmictad a2el(vpn(0altrmr3oy1op r neils0setm(opnodape  fes (  2rmxmpno4tptomi3iyslm elumo;u) rxnmo3tadoa rai i;() eumir3oo4am nmiviat)sDraxr oo0olxn ictysla raums u0aeenmo oytop e n s t trxr(r3no4lp n nvtl(fa2um( oou4oltnmf3taslmDuau p (0trtniocoo1opDrluvs;s0seurxr ou4lp emnctas  rtax p;o1tpto ocilslm2elnms u0 lxrir3oydlmDraues;(0trtrxr3nydome mfcils artrx o;u1ale if3iad sDuaumo;t)altomr iodfmDr u ols)s2to(r3no1ll nlnctls sDumur nu1oet mociadlm umnvs u)texoxf3iydlmteai i t srumxopnodlptelfesas)s2trumono0oet  ocilsfm rm( s;t0 lxoxf3tadop eai i;( srtr(rpoudal e feta() rra( oot4apxnifeiysla2ra(mo;(0tlenxr io1oaDrlnvslt) exo(opnudaptn nvta( aDtm( pno4oeeomi3tlslsDulu s;u4 rerxf3oodfa r uvol() eurim3oy4am emiet ()aDurur ou4ole ifciasfs elumsn() exrif3oodfp ran ils0trumxopoo4amtn fvtls  rtmu poo1olt  i3iltfm uluvs u)arxrxfcoa1fp e nvo;s s2umxr3oy4om nmncsl(f Dtaxm no0texomietlsfm ua(mpn(4 rxrifcoatfaDrai ilt t2tmimpiy4lmt mictl( sDrrum nt1aeeo feiatlmDeanvo (0artrmr oydlm  auvilt0t2xr(r3io4al emivsas)sDum(rpou4alt ifciatls elu p;t)aeerio tydomteaneo s0 2xo(r io4lpt  neilsf rtr(rpoo0aexoiictysfm2uanmsnt0aetoxrcio1lptrluvs t  2xoir nodal emivi ( arta(rp;u1tleoio3iltla um(mo;(4tlenio3tydlmDrluvil( setrxo3nydalt lnciat sDrmxmono4olxn o3iat m2rm(ms (0alxnmo iytoa  aneo;t0 exm(mpiy1oltnmfvi t) 2umxmo;o1aeeomf3tas a um(vo t0 eeomo3oadlate ivi;(0trtr(mpio4am  mieils) 2rrxmo;o1opeo oetltfa ranmp;t)alxrmf oadoat aiei t  2triopoy1ape lnvilt)aDrau p;u0apxn oeiatfm rln s;(0 exnmo tydoa  an sls texrio3nydaltelfetasfs2tm(ro;t1tet moeilslm umu s u)aeerxr iodfpt livi t) 2trxm ou1alee fesls srumum ;o1optnmo3tydfm eanvsnt)trtoiocia1fp e ueils)trxoimpoo4lptnmfvilt  Dtmx pnu0opx mi3iadfa2rlnvonu0 rtoxfctydfpDrlneils0 2ur(opiydlltelfctltfsruauro;u1olt mfcilt m2rmu s;u0aleoxocia1lm   nes (0 2umxm iu1lp  lnetl() Drrxmpoo1tetnmi3iad sDua(vo;u0trxoxo oodfaD an ol() exrxrpno4amenmneilsfs2ta( oou4alenmf3iadfmDuau p (4 rtoxo3todfm   u i s)srxrxopnodam elivs t)aDrruroou0alxo i3iytfa el( p;t0 exoxf iodla e n o () rxo(r nu1ome lfcsls srtm(  ;t0aetnmi3iadlsDrl( o t)aetnxr io1lpt livols0sruoio3iudoltn nesatfa2rrx pnu1tlx  oeiyd a2ulumpn(0tetrxf iodlaDr nvo;s)teuoir3iudlpeelfeta( a2trum nt1oltomicilslm rl(vs;(0aleoirciy1oaDe u ils) ruoxrpny1aptnmnes s s2rm(  no1teeo i3ilt m uan o;t)teenif3oatfm r ivils0 ruoiopio1lme mfcs tfsDtm(rpnu0olxn o3tysfa2eln snt)texomr io1fpt lueolt)s2xrxo ou4omte fci s)aDur( oou1apto iciatfaDemu p;t) lxrxr tytfa   n o;() rxoxr nudlmenmfctltfa2tmu pou1tee  ietyslaDel(vs t)teerio3ty1fmt au sls  2toim3nudamenmfvsatf 2ur(rp;u1aeenmf3tat m2elums;t4arerxf3iotopD an i;( s2toio oo1lle  ncia(  Draum nt1oee ifeiatlsDra( p u0altrxo3todfp elues;(  2xrxr3io4ale mfes s)srrmxro;o4tex  oeils a um( o u0aeeoio3to1opDe nvs;()s2umir ny1lm nlnci t)srrmx oot4olenioeiydfa emn on(4trxnif3totop elnvo;t) etmxmpno1optemneiat a2rm( p;t1tlenmfeiytla2elnvon()trtnxr3oa1fptrlueolt) 2xm(m3iy4lm e fcta( a2um(mpot0opxomfciat s rmnvs (4aexrirciatlp   nvols0srxr(opiudome  ivi sf 2uax oot1opxoii3iydfs em( s t4 etrir todomD lieil( srtmxo nodomenlfciat  rum(m oo0aet  f3tlt s ra(vo ()aexnif3ootlmtr i o;(0 eto(r3nu1optemfvsatf 2raxrp;u0oltnmieildlm rmnmsn(4 rxrmo3iy1lp eaues;s s2urio3oodll elfctl() rrmumoou4aetn o3tltfa2rl(vpnu4 lenxo oytoaDeliei t  rtr(m no1open ici ( sDuaump;u4oleoii3ild mDrau onu) leoifciodlaD lnvi t t2ur(r3io4lpt lfvs ()s2rm(r nt0opxo o3ilsfs2el(msnu)tlerxf3oytlp eli s s texmimpou1llen iesas)a2raum oo1tltomfeiyt aDra(ms;u4 lxrxo3iy1fate nvils tetrio3nu4ll elnvtl(f rum(rooo1apx  fctadls rln o;() lxrifcio1optelieo;s0truoiopio4ap emnetl(faDuau  ;u1tptn f3tadfa rm( ont4arermf tydopD auvs ()sexo(m3nu4alt mictas sDtmur ;u1aee iocils sDrln o t4arenxociodlaD  i i;()t2urir3iodal  miviat) Dtrurpnu0tlenmfetadla umnms;t4 rtoif tytlaDrlivilt0 etmim ny1al n fvt t arua(m oo0tpt  ictyslm2uauvp;(4texrif oy1lpteanvo;s) rto(mpiodaleemfvilt) ruaxmpnt0aetoif3ilsla2ean on(4 rtrmr ta1op r uvslt  2tr(mpno4amte ivsas) rua(m ;o1oet mo3iys a rau p;(4tltoxo3oy1fateai il()tetmxm3oo4openlieiatfarta( p;t4oet  feiadlmDul( o;u0trtoxr oytlaDe u ol()s2xrio3ou1lptelfesl()a2tr( o;u0apt  ociltfa ul( p (4aetnxf3iadlm r uvolt0sexoirpiy1om nlivt tfsrum(m ;t1alt mictadfs2ulumpnu4teeoxr3ta1fmtelu ilt0srur(rpiydapeelies t)sDum( onu1apx ifcilslaDulu o;u) ltrircia1fpDr n ols0 etmxo3nodal  mncta(fa2uru pno4tltnmfeiaslm rmuvp (4tltrif3tydopteauvs s0t2triopoodam  lfviltf rtaur no4oeenmi3tyd s um(vonu4tlxrmr3ty1la raueslt0 rurxo ny4ol   ici t sDurxm oo0tlenmictldlaDumuvo;t4aexnmoctytfatrluei;t teurio iydllt mnvias  rum(mp;o1tpxomoctadls rauvs t0trxnmfciy1fmteluesls0s2xmxr ny4llenlncsatfartrxro;o4opto oeiys m eanmp;t0teermo3oo1fa elnes;s tetmir3iudap nmfesat srrr(r no1apxo o3tat a2uanms (4 leoif iotfmD lnvs s0trtmir no4omt  nvils)arurxmoot1oeen i3ilsla ulu pnt)trxrxociy1la r neo s0texmxm iy1ol  lneslt)aDrr(r ;u0apxnmoctyd m2rmump u0tleoxf io1lmte u o () etrim3oy4alte nvt ( srua( pnt0tle mieiyt m ranms t4 lxnxocootlpt auvols) 2uoim3iodop e fvs t aDtrur ;t4tleo ieiat s2rl(monu) leoxf3iy1fp r ivo t texoim oo4amt  nei t) rumur ;t0oeeniieiad m uanmp u4teenmocoo1oaDraivo ( seuo(r3oy4am elivi t) 2taum nt4tle mi3tlt mDum( o;(4tlerxocta1latr u o (  etoxo3ou1lptnmnvsls) Draxm nt1opx mf3tlsfsDumuvp;(4 eerir ia1lmDeaivi;s0s2xrxo iodlpeemivt (farta(m nt1alt iictatfaDean s;u) ltoxrcto1fpt luvils0t2xoirpnu4apt  icsas sDuauro;u0oleniiciatfsDumnvo ()tltnxrctadoateau slt0seto(mpny1op elivslt aDtr(r ;t4aet miciytls umuvpnu4 renxo3todomteaivs ()t2to(r3ou1lp e iei ()arrr(rpnu1tpe ifciyd s eluvont)areomfcoytomD  u i;( srtmxr3iodlm nlfvtat)s2tr(m ;u0tlt  f3tltlsDelumsnt0alxnxr3tydlmD au slt)s2trim iodlptn ieiatf Drrx  oo0texomf3tlt s rmnms;() rxrmf3ta1oa  aivi;s)s2toir nu4om emnvsl()sDtrx  ;u0ape mociysfa emumsn(4tetoxf oadfmDr u o ()teumxmpou1lltelicsa(fa2tr(r ;u1tpeo ociyd s2ranvp;() renif ootom   ueilt0 2uo(r ou4ll  lnesasfsruaxr ot0oex miciyt m rm( p;t)trenxfcoadfaDr neo;() 2toir3ou4lpte nvtls) 2um(mont4opx mociyslm2rau p u4artniociatomD  nvo;t0sexriopiy1lmenmnctat a2taump;u4ape iictatla eauvs;u4tltnircoydlptrlies;t)sruoim iodole lnctat sDrrxroou4tee if3iyslsDelnvpnt4trtnxr tatla eanvo;(0s2xmimpiy4apt licsl( sDumu ont1opxn o3tatfaDeau on(0 eenirciotfateln il(  rxmirpiudom nlnci sf rrau poo1oexniieiysfaDrau s;u0aetrxr iatom  luei;t)trumim oydole mnvs (  rrm(r nt1tpxniieiydls rlump;t)teeoxf3iotlmD auvs t) 2xmxm3io4lmen ncil() ruax oot1aleomfciasfsDemu o t0 etrmrcoatoa e i s t srurirpoydapeelnctas)a2trur oo1apxomfcildla ulu s (0aleoif3tadfm  lnvs (0tetm(o iodalenlicia() rrmumpou4oltoifeiad a2eanvonu4 rtoxoctatop rlivo t s2xo(m nodomtnlfeiat sDtm(ro;u4oet ifeildlm uau o u) ltoircia1la  aivs;s0texm(mpny4lmtnlfcsls)srtaxm no4altnioeiltlmDrau pn()aetnxr tytopteaivol()s2xrir io4lmte nvslsf Duauronu1tet mictytls2eau s;u0 rtoio3oatoaDe ueilt)t2xmirpoodamtnlfei sfa2tmxr no1tle  o3ildfmDrmnvs;t) lxrio3ta1omDelneol()s2xm(m3oudopt mfesas)srta(r no0tex mfciytlm2elnms u)aeeomrctydfm rlnvols sruoxr ny1ll   fcsatfarum(rooo0aptn feilsfmDrl(vs;u0 lxrxo3oy1om rln i;t s2to(r oy1op nlfvta(fa2urxmpnu4apt moetltlm2rln p;u0 exoxf3ty1fpDelues;(0t2xmxo io4ll e ivsat)a2taxmpno0alt ioeiysla2elumonu0alxrxf totlm  aiei ()t2toir3oo1apenmncsls srumurpno1olen octlsfm el( o t4 rerxf3oatlat  ueols) 2xrxrpio4amt lfcilsfa2urxm ou1aleoif3iys aDum(mp u0 ltrifctotfa elu o t0srtr(o io4omtemfcslt) rua(mont1alxomocildfaDrau s t0trxnxociytoptr n i t setr(r3nudlltnlnetlt) rtr(m ;u4texoiiciadlaDemnmo ()tleoio tytom  lnei s0 2tmio ny4apen ivsl( aDrrur ou1olxn oeiytfa ul(mp;u) ltnmr oodfpt  i ils setmxrpoo1lleelivta( a2rrx  ;u1optoii3iyd mDra(mpnu) ltrxo3oo1oat  nvs t)srxr(r3ny4am  mnvi t sDrr(r ;u0apx iocias s2umu o;u4artnio oytop rauvo;() ruo(o3ou1olt mnci ()srrmuro;o1tlx ioeiysls2emn p ()artrmo oytomt li sl(0 2xr(m no4lptnlfct () Duaur ;u0open i3iad sDrmu p;u0 lermo3iytopteli i t s2trxrpnu4ap nmfet t  rtr(ro;t1opxnmo3tas aDea( o t0 exoif ta1fpDrauvs t0 eur(r3ny4ll  mfvtls) Dtrxmo;o4aleomietlsfsDrlnvsnu)tetnirciodomtr uvo t0 2xriopiy4openlnetls  2rau o;t0ape if3iyt s2rlnvs;(0teerxf oatom  li i;s0 2toio3no4ll  lfvsa( sDrmxrooo0oexniietlslm elnmp;t)teeoif ootlm   ueilt)srxm(rpiu4ol  lietls s2tauroot0oeeo feildfs2uaums (0 renmf ta1laD lu sl(0 rtmim3nydll  lnvia( srta(  ;t1optnmfetatfsDumuvpnu4 ltoxf ta1optelneils) 2uoirpoodllenlivtls)artrumo;o0oeeoii3iad s rmn o u0texnircootfm  an ols)setrxopno1ol nlnci t)sDrrurpnt0aee mfciyt s2ul(vpnu) exnif iytlaDrai s t0t2toxo nu1lltnlietlt a2urx  nt1tpx ifeiadla umuvon() reomo3tatfmDelies s0 2umxm oy4amenlnesl(farrmum oo1olt ii3iadla2rln s t0 lerxfctadlp rln sl(0 2uo(rpoo1lp n nvs ()srtau ooo1oetnmi3iasfm2rluvs t4 exrmo3tytfpDr ues;s texoxm io1alen ncsa( a2trxr ou0aet  f3ilt aDelnmsnu0tetoif3iy1la elivi ()texrxopnodlmeemivtls srum(m nt1oee mf3iydfm ra(mo u)tlerxr totoaDr ivs;()trxr(rpiy1lle mfviasfaDurxrooo1olx mo3tat a2ua(mo;t)arxnmf3oatfm  auei s)t2um(o oo4oltelnesl( s2tmur ;o0teeomoeiyslaDrl(vp (0 eeomo3ootla raieo;(0 etm(r io1amenmfctlt a2urxro;t1optoii3iydlm2rln s;t)alxomfciydla  lnes ( s2urio3nu4am e nes s)arrm(root4opxo f3tytfaDumu s;(0 renir3ty1fatean il( t2trxrpno4ameelncs s arrmxmoot4oeeomoeildlm2rln pnu0altomo3totlpt  nvs;s seuoir3ou1apenmiviltfartru  ou0apenmoetltlsDean s;(0 etnif3iotlmDeaivilt)tetrxm iu4lpee ivslt  2tr(ronu4opto i3ils m ran o;u4tlxrxo iytlm   n il(  rurir3ny4al   ivtasfa2um( poo1tpxomi3iyd m2rluvs u)altrxf3oadfate n i t)trxm(mpnudam   nvs t)srur(mo;o0tpxn i3ilsla um(mo t4 lxrifciotlptrlueils) 2uoiopiydal  mieil(f Dumu ont1alt ifeils a rmnvs;(0trenmr3to1fm raiei;( texm(rpiy4optemivsl()aruax poo4tee mf3iadfm2umump u)alxrmo oytomtrln o;()sexo(r iodlp nlietlsfs2ua( pno1alenmietysfa2rmnms;t)alermf3oadopD aivol(  rxmxo oydllt  ivt s) rur(m no1tpxn oetyd m ra(msnu4arxrmr3totlp r ivslt s2trxo no4lpt mnei ()a2rmxmpnt0aeeo ocildfaDemn s;t4altoxociodfpt aivo s0s2toio oo1lm  mneta() rra(ro;t0aee mietys mDrl(vo;u)arenif oydfa  au ilt)s2xmiopoodalenmnvtat arraxmpot1tpx if3iltlm rmn s u0trxnxo3todlat  nvils  rumir iu4ll nmiet s) Dtrxmp;o0teeniieilt m2rmnvo;(4arxoir tydfp ean olt  etoir3ou4ol emfvs sfs2tau  nt1teeo fciadfa umn s ()tlerxfctodfaD lies;s s2um(m3no4am emiesatf Dta(rpou0apto fcild m2em(vsnu)aexoxrctotlmt aueo t  eumirpiu1llteliet (  Drau pno4opeoioetlsfs2eluvsnu4 rtoxfctadfptraieslt  etrxm oo4lmt mfvil()sDurumo;u0olto fetatfsDumn o;u)arerif3oadop  aivs (0 2xo(r3iu1ameelnesa()arrrxm ;u0alt mictyt aDelnmon(0 rxoxo iotoaD an ilt sexmxopiodapt mnvsa(  rtm(m ;t1tleo ieiydls uluvs t0 lxriociytlmDeaies;s0 2xrim3nudom  mnvta(fsruax pnt4opxn f3iytlmDelnmo u0 rtomr tydfptean s;t0 exmxr3oy4lm e nviltf Duaxro;u4oexoif3iad sDuaums;t0tlxomf3io1omDranei t0tetr(m oudllt  fcias sruru pot1oltnmf3iytlmDrm(monu)alxoifcia1lmD  u ols)t2xrxr nydol nmics tfarrr(r ;u4olxniicildfm ua(vpnt4tltoxf io1lp  ln i t  rto(o3oydlm e fvt ()s2umxm nt1tlxnmf3tls s2elumpn(4trxrmfciotfpD ai o;s)t2tmir iy1ape  ncil()sDraxmpou0alx mfetydlm2em( snu0tlerio3iytoate u il()t2toxmpoy4oltelnci sf 2urxmp;t4opt ifetysfa2ean o;t4altnmo iodfp eai s;t  euoirpiodaltemncils)srurxro;u1aexn feiasfsDumnvp (4aexnmfciadfp rluvolt t2xmxr3iu4lmeemneil(  Dumumo;u4tpeomfctat sDeanmsnu4teenxr iy1lptrauvi;s trtoxm3io1omt lfct s  rrr(rpnu4oltn ociys a2ean sn()altnmf oydoat  n i (0sruo(o iudol nmfvtat  rtmumo;u0tpenif3iad aDrln o u0trxniociy1lpDr n sl( setm(r nu1oltemicsas artmxr nt4tpxomfctasfmDeluvp (4arermo3totlp rlieo;t0 rxmio3oodope livtatf ruau pnt0tlen oeildlm2emu o t4 eermf oodomD aieo ()teto(opoydlp   ncil() Drm(rpnt0aet  i3tlt s2rmn s;()tetomo3oatoaDr n o;(0 2uo(opiu1aleelnesl()aDrr(rpot1aexniictls s2rl(vsn()tlerxfcoadfpDelieolt s2tmio iodom nlicil( arrax oou1oeeomf3iytfmDea(mp t4altoxf3totfaD anvi () rtrxopio4apen ictl(  rum(  no1tetniieiysfa ean s;u)alxrifciytla   nvsls)trumim no4llenlnvta()aruaumpoo1aeeoifciadfa rm(mpnu0altrxo iytlpDelivo;( trurir3oudopt lietl()sDta(mpnu4oeeniieilt a2elumo t4tlenio3oa1lpD luvo t0t2xr(o ou1alenmnvslt srrr( p;u1aleoiieils aDean o;(4trtrxoctotoate neils  euoxo iu1lp e fvtl(fa2rm(  ;o1tetoioeildlsDel(vp u)tleoir3tadlmD  i s;t srtmirpiodll  lfvt tf Dra(m ;o4tlenifciasfm rmu p;t0teeoio3iadfptrli i;t0teur(m3ou4om emnvs s srtmx o;t1oetoifeiltlm2emuvo;u) lxrifctytoaD lues s)s2toxm io1aptn ieia( srurxr oo4oexo ictadlmDulumpnt0 leoio3oydlmDrluvol()sruoxr3iudolt liviat)s2rr(m no4opt iociydfs rlnvs u)trtoio oytla  auvolt)s2toxopiodap nmfcsa()sDrr(  ;o0apx  feiyt mDrl(vp;u4tlxrxr tytfaD  nes s)setoxr iudlmtelicilt) ruaum ou1tetoifetltfaDeanvo;u)aeenxrcoydlp   ivil( srxmxm3iu4lp nlnvias  Drm(ro;t4tpe io3iytfaDua(vs;t)altnmo3oatfaDrli o t) exm(r nodop eliet s)srra(mpou4texomfeiasfm rauvs t4arxrxf3tadoaDe ueo;s)sexoio iy4lle lfcsat  Dtaurp;t1apeo oeiytfm2umnvp;u)arenxfcoytopDeau o;(  2umio iy4altnliesas  2rruront0tpt mociat aDeau o;u) ltnxr3tadlateaneslt tetoirpoo1lmt lnciltfsrtrumpnt0apx  feiad m2elumo u)tltnif3oadlpDe nvi t s2xo(m3iydam   iesltfarraxr ;t4tptnmf3iltfs rm(mpnt0aetoir3iadfpte i s;t  2toiopio1lm n fvs ( srra( ono4teeoiietyt mDua(ms t4trtniocoy1fate uvo;()tetr(r3ou1ame lneta( srrr(mpot4olenioctasfm elnmp;t4tetrmf oytfptrlnvs;s0trxr(rpiu4lmtelivsas  Duau  ot0oeto oeilsfa ean s t) leomo3iytlm eanvs;s0t2umxo nudop n fcsltfs2rrumo;u4oeeniociysfs rm(msnt4artrmo tydomDeaueslt)s2tmxopno1oltelieiat) Draum nu0ale mo3iydfs2ua(vo ()tleoxfcia1lm eluei;(  2tmxr iu4apte fvias aDum( pno4tle mi3ildfa eau s u4artnmr3tatfpD  i olt t2tmxm iy4apt mictas  2rax  no1tlt iietadlm rlnvo;t4trxoxo3ia1lpDe i i;()seurxo3nu1aptn nes (  rtrx ono0teeniieiasfs2ua(ms;u0aetnxr iytfmDraues s texr(m3ny4lmtn nciltfs2urum no4aeenioetltfa el( s;t0texomfciodomtelu i;(  rtmiopnudap  lnesa(  Dra( o;u0opt mfeiadlmDuauvo;u4arxrir3oo1fmDranvi;( s2tmir iodaltnlici t sDua( p;u1aeeomi3iltfaDrl(vp;u) lxrxr3oodfp r u sls s2xrim3nu4alte ies sf rrrxrpnt1oeto feildfa2emnmp;t) rxnxo3iadfmte nes t t2trirpoodal e ici t artmxm ;u0apt mi3iad sDrl(vo u4 etomrctatfptranvi;t)setrim oudlm nlivtls  rrmurooo1oltnii3tltls2umnmsn(4tleoir oydom rlies;s) exmio3nodap e fesa(fsDtmu oot1tpt ii3iadfaDuau onu4teenxrciatoaDr ivs (0s2to(rpio4lm n feslsf rum( poo4opxn i3iatfsDua(vs (0alxnxo3oydfat lu i ( setmxopoy1openlfcils  Drmxro;u0aexnmo3iysfm2uan o;u)arxomf tydoa rlnvol(0s2trxrpnodopeemiei s  2urx poo0aeeoifetaslaDem( pnu0 rxnxoctodfat livi t t2xoxr3oy4optn net ( a2um(ro;o0tlx  oeias a umu p;t0 rtomr iotoa  anei;t) 2to(o ou4optn nvsat sDraxr nt4tex mo3iydfm2emn sn(0teeoxrcia1lp rlu ilt0srur(rpoo1alt  fctasfarrmu p;o1alenii3iyd sDrm( sn(4 leomr3iydom raivs;()srxr(r3oodlpe lfct (farumum ;t0texomoeildfs2rm( o;u0 lxoir3oodlatr uvo t trxmim ny4ope lfcs ()srrm(rp;o4aleoiictad sDuauvp;(4arenifctytopDeln o;(0s2trio nudllen fcsl() 2uaum ou4aexnmociasfa el( o t0 etoxocta1late uvsl(0s2tr(m io4ll  lnvt (fsDumx  no1tleo i3tlt m2rlump t0areoirciydfaDrlues (0trtmir3iy1opt lfvt ( sDraum ;t0apto fciytfm umnmsn()alxrmo3io1fptraivo;( trumxmpoy1lmt  ncias s2trxmont0tlenmocilt s ran p t4aeerxr todfptr uvi s teuoxmpoudll  lnvi ( a2raxr ot4alt ioeiyd s uau o;u) eerxf3iadlp eaneo s)texmxr oo4apenmnci sfs2rmuroot1texo ictltfa2ea(vp;u0teeoiociy1lm eluvi ( s2umxo3iy4lme mies ( s2urumpoo1opxomfctadlsDrmuvon()tltnmf3oytop  auvo;()t2trxr3iudlm   iciat)a2tru  ou4opeoioeiyt a rmnms;u0aetrmrciadlmtrauvsl(0trur(r3io1ole mictls  ruaxmpoo4optniieiltlmDra(ms;u)trtnmf3ia1lpDrluvols)trur(m iu4lp n feia(f rrr(ro;u0ope  i3tysfa ea(mo t0 lerir ty1lp r u sls)s2xo(r3nudlltn nvi t)s2rrurpou4teen i3iatlaDumu s;u4 eeomr3iotfmteai o s)trumxm3ny4oleemivsasfa2ur(m ;o0apx io3iysfa2uanmp;u0altoir iatfaDeli s (0t2xrim3oo1lmtemiesl(fs2rmxm nt4altoifetys s2eln s;t4teenxfcoatoatrau i;t s2xm(r3oodape  iei (f Dum( p;o1aexn i3iltla2rlnmo t) rermrciytfa e nvi;()srtr(o oydll elivsatfsDra(rpnt1opxomf3tydla2eauvp;(0 rtnifcoadoat lues;( srurxr3oy1apt mfvsat) rurum no0apeomoetys s2eanmo;t)trxoircoytlatelueo;() eum(r3oydal  mict s) 2um( pnu4optoiictldla raump t0treniociy1opt  i sl( seum(mpny1am e nctls s2tru ont0olto ieiyd m2um( s;u4 rxrxr3iadoptrlu s ()s2xrxo3nu4apee ies s) Drru  oo4teeomfciyd mDuaumonu4trenmr3totop  auesls  2trir3nu4am  lici s sDrrum ;t4tlt  ociyslm rl( p;u4arerxocoodfp raivslt teumio iy1ap   fct t  rrau pnu1tetnmieiys s2el( s t0aeeoxr iodoa  lnvs t trxmir3ny4lmenmnvt sfsDtaxmo;u1tle  ietydlm2elu p () reomr3oatlmtr u i ( s2xoxm nydoltemici ( a2um(moou4alxnmi3tatls rmn on(4 rtrir3io1fmt an i ()trumxo nu4ol e fvs s)sDtaumpou0teeo icildlsDulnvpnu)aleoxo3ta1fpDeau s s0trxmxr3iudameelicil(f Drmxm ;o0tlt  oeiat sDelu p;t4arermrciodopDrlu ils0trumim iydlmee fet ()aruru  ;t4oeeomo3iatls um(vs t) eermo totlm elieo ()t2xmio nydop emfvtat)a2ra(mooo1aleo iciydlm2elnvsnu)tlxnxfctodoaDrai ol()sexmio3no1omt mfvtls)srrmxr ;o4oeeoif3tlsfmDumu s;u)alenmoctodfatr ies;( s2tr(o ny1lpe mneiasfa2ta(mpou4aee  fcils sDeln o;u4aexomr3tydomDeaivo;t trtr(opnu1aleelivilsf rurum nt4apto i3iasfmDuanmo;u0 eenif3oa1lpt luvol()t2xm(rpiy4lmee fvi (f Dtrx pno1opx  oeildfa2ulnms (0areomo3oytoaDr uvsl()trxo(m3nydolte net sfa2rmxrpot4tpxomoeiyslaDrluvs u0tlxomrcto1fmD  n o;s0s2ur(opiy1alee netl()arumxrpno0ole mo3iatfa rluvsnt)aeerxo3oydfaD  neils0texm(m3ny4lm   ictasfs2rmxmooo4tpen fetldfsDrm(mo;() lxrifciadomD  ieo s) 2xm(m3iu4omeelictl(  2rau  ;o1oee  i3iat mDumump t)tlerxo3iatlp  ai sls) etmim oy4om n ieilt)a2rm(moou1optniocildfs um(mont4arxomocoo1fptranvslt)t2umxr3ny4op emneil() 2um(  ot1oltomictyslmDrmn s;t) renmr io1optrlivo t s2tmxm ou1alenmivta() 2rrum nt1tetnif3ild s raumsn()aetnmrcoadfpDr neol(0 2toxr iodlp n iei t  2rm(  ;t4tlxomiciad a2eau s (4arxoir3iotlaDe uvi () etrxr3iy1lpe  ict sfa2ta(ront1tetniieiasla2rm(vsnu0 etomr oatoa r nvol( s2xmio3ou4lp nmiciltfsrrrumpoo1olxn f3tatlmDem(mo;u0 rtnir oydfpD aieils0 ruoirpiu4alenlivilt)a2taum oo0ale  ociatlmDrmn s;t)alxoir ia1oaDrai o;(0s2xo(r3io4lmtnmfvils a2rr(r nt0olenmiciytlm2rm(vs t)alermocoa1oatr ieo t0teum(m oodlptelfcsat a2ra(r ot1apx iociyd aDeln sn()arenif io1fa eli sls) eumirpnu1ape  fei t)s2raxmono0tlxoii3iytls2umu ont4tltnmr tatla eau o (0srumxo io4lptnlnctl( artrur ot1teeomo3iydls2uanvs;(4altoxo oo1fmtrluvo;t0 etmxm ou4lpe mfcsa()sDrr(rpno0tetoii3tasfs2umnmp ()alxnifcoadlm eauei;()t2xrim3iudomt lfcias srtm(m ;o1tpxnio3iadfm2uaumonu0 renif3oo1lp e n ols0s2toio3iu1oltn neiat)aDrmx  ot4apen ociat a2rln o (0 ltoxrcia1fmDelnei;s0teuoim ny4lp   nvil(fa2urxm ;t4openifeiltfs2rmnmonu4trenmfcoadla   u s;(0t2umxopnu1ape  iet tfa2rrxrono4apxo oeiltfm2elump;u4 eenxoctodfa e nvo;(0srtr(rpoy4om nmfvi (fs2tmx  ;o0tlxo icildfs rm(ms (4tltrmfctatopD ai olt0t2trxm3iy4omeelnvil(fsrua(m ;t1oexo o3ias s emnvpnu0aeeoiociadlmD anei s0s2ur(o ou1opte ictls srurumo;o0altnmfeiysfmDuan p;u)tetrir oytomD au s;t)srurxr iydalteliciatfartaxrpnu0aet iieiad sDrln o t4areoxr3iatfpD  iei t trxoio ou4amt  neslt)aDrmx ooo1tltn fciytfs rmums u)alxoir3ootoaDeaueo t0tetoir3oy4lme lics s aDtmx pot4tetn fetyslsDuaums t0tltnmrcoytop eli o t0sruoxm3ny1al   fcia()s2taxroou4opt mfeildlaDrl(vpn(0aetnio3oodla eaneslt) eto(m oo1oltnlivt t aDurxrp;u4tleomoeilt mDrlu o t0tlxoifciytomD  ies t) 2xrxm3ny1olen nvsls)srtaurooo0oeen fctatlaDrauvo;(4arxnmoctydoaD luvo t srxoir3oudamenmicsl(f rtmum ;o1tex mi3ilsfs ul( ont4trxniocty1lpDrluei;s) rumir ou4al elnctas  2rru  nu4olxo i3tyd s rm( s (0aeeoiocootlpt  ueo s0t2umim3io4alen feslsfsDua(rp;t0altnifetltfa2ul(vs u0trtnxfctotlpte ivsl(0 2xoxr3io4ol n nvtlt  2tr( pnt1opt iietysfa2ranms;u4alxoxf oytop eluvi;s0 euoxmpoudam e fviasfaDua(rpoo1apeoif3tydls ranmo t)alxrmf3todopDelneolt srxrxr3nodlleemfctl(fsDrrurpnt1tpxoio3tytfs rmnmp;t0trxniocoa1fmD  u slt s2toxr3oo4ll  livtas  2tr(  oo4alxo i3iytlmDel(vs u)tetnxrcty1faDranvo;( texr(o iy1lpeeliesat)arum(mpnt0opxnmi3iadlmDelu p (0aeeomf3iytfmDe uvi;t) rtrxm ou4lm   fctlt)a2taurp;o1tpeomi3iat a eaump t4alxrxo oy1fp eai s t setm(o oo4olt lict s)a2uax ooo4teenmo3ilsls2eau o (0 lenio3ta1lm elueo;s0s2xrxrpou1al  mfesat a2uax  ;o1openmi3tasfaDean snu0 rxnif3ty1omteli o (0 2urxo oo4apen ivtlt)sDua(m ;o4olto o3iys s2rm(vsnt4altnxo totoa  li o;t) rxo(o oo1aptelfes s)a2umurpou4olxniieiyslm eanmp t4tltrxf3oodom r ivs ( srxm(o oo4olee fetat) Dum( onu4optnmoeiyd m2um(monu)tetnifcoatfm ran s t0texoim3oudlm e nvs s a2raumoou1apx mfctys s2um( sn(0trtomr3iodomteln il(0s2uo(mpoo1ol emnesa() Duauroou0tee mfeiltls2rlnvon(0tetnif tatlp elueo s0sexr(o3nu4ameemics ( aruaxm no4tpeomictltfm2um(ms t) lxrif3ootopD aieo;s trurimpoo1om nlfvt (  2rrxmp;t0oexomociatfmDemnvpnt)aeenxocoytfm rauvo;s) rurxo3iy1lp   iviasf Dtau  ;o4olxniietasfaDemn o (0aetnxf3tatfm e ueslt0 etoxopoy1lmeelfeslsfsruaxroou1tlenmiciysla2umu s;t4trxomo3io1late nei;()teurxrpoy1lmt mfetl(fartmu oot1optnmf3tyslaDelu p t)altnmocoo1fm e u o t0srtrxo nudlm elici tfsDtaurp;t1aptn o3tlsfa2eau snt4trermo oa1fmD an ols)tetr(m3io1ome lieilt)sDumur ;o4oleomf3tyslaDea( s;u)teenirctotfaDelies;(0 rxo(o oo1openlncta()a2tax pou4apxn iciad aDraums;t)arxoif oytfat lnvilt) 2toio3nydopeemieiltfsrtaumpot4apt iictydfsDrl(ms u)aeenmr ty1oateluvs s0trxrxo3iydapeemiei t  Drrxr ot1tleoif3iys s2raumsn(4tetriociy1omtrauvi t0 2triopno1am emfeta(f Drr(r ;t0opto o3tatfmDuanms;()aeeomf ty1oatr i o;t0srumiopoo4alen ivsas sDur(m ;t1alxn oeiat aDrlu o;t0 lxoxr iotomt  nes;t) rumim3iudam emieil(  Drrumono1alxoio3ild a2ranmpnt0aeeoio ta1fmt  i i;s)s2uo(r no1optnmivsl()srur(moou1olxnii3tltfs2elnmon(4tetrxfcia1lat  ivi s0 rxo(rpoo4lpe lfei (faDumumonu4apxo f3ildlsDemnmo u0 rxrmo3todfmteanvilt  2tmio iodom  mnet t)artaxr nt0oet  oeiys s2el(vs u0texomo3iydoptraneo;s) rtmxo ou1lltn nctlt)s2urxrp;t1texn i3ils a rl(vpnt4 leomo oadfp e uvi ( seum(opno4om nlnes ()sDumu pno4texoioetaslmDumums u) etnmocoytoatrau o s  2umir3nydlp n nviat  Dur(monu0alxo o3ilsfa2uluvsnu)teenir3ty1oaDr ueo s trxmxm nodomtemnes tfsrurxmo;o0opt mfeiltfm2ea(vo;t)altrxfcia1fpteai o;s setoimpnu4omt  nvia(faDra(mont1aeenmf3iltls ulnvo u0tleoio3todoptr nvs;t)s2xm(opnu1op nlncta(fs2rmxrooo1apeoioeias mDua(vpn(4texniocoytlpt an i;s  rxoxopny1ll emietlt) rrmx pou0aetn oeiydfa ran sn(4 rtoxf oatfmDrauesls0 2trxr3iy1opte fviatf Dua(r ;u4ope  ieils sDuauvsnt0 lxrxf3tatlmDeauvs;s t2um(o3iy4omtn ieta( sDrrx pou4apenmfeilt s2elnvs (0 exnio ootom raieolt0 exo(m oo4llenlici s  Dum(mpoo1alenmoctydla um(mo;t0aetrir oytoaD  neilt0t2xmxopno4lm  lnvsl() rtax ont0openmo3tasla rlnvo (4tltrxfcta1fptrlnvo t texo(r3oo1optnmnvslt  2rmum ;o0olxnmociltfa2rau p ()trxoxfcoytfmD aies;t) rtrxmpno1ole mivslsf Dra(r oo0tlx  feiys aDranms u)trtoxo3oatfmt aneilt)s2tm(opio1alenmfci (  Dtaxroot1ape ifctysls rm(mp;u4tlxnifciytomD  ies;s  rxm(r3oudalenmictatf 2rr( pot0oetniieild a2rm(mo;(0artnmo totlpDrluei;()srtmio3nodom   ivt t)aDraum oo0tpx mfctatfsDran ont)tlenxr3tytlmteaues;t)sexrxopnu4oltnmneta(f rra(  ou0tpeoiociyslm2em(vo t)aleoio iotfp  li s;( trxo(mpno1amte fvsat sDrrum nt1tpt  o3iadfs el(msnt) reoxo ta1omteau s;(  etriopoy4lm n nci t)s2tr(m ;o0tpenmfeils m2rm(ms ()aetnmo3oa1lpD  u ilt sexr(r ny1ape mnei (  2ua(rpnt1oeto ieiat s2eanvonu4artrif3tydop rlivo;(0 2uoxo io1amenlnci s)artaxmpnt0tlx iieiyt sDeluvs ()tlxomr3todoateaneo;(0seuo(r3iudoptemivs sfarrax o;o4oexomietad a2ul(vo t0 rxrif iydomDr uei;s sexr(o iudopeelivslt)aDraxr ;u4apto oeiytlsDel( o;(4aexnmo3ootfm  anes;s0srtm(o ou1olen nctl(fsrtaxr nt0optnmfetltla raumont4alerio tytlm  ln ols)s2trxmpoudalt  nesls)sruaxmono1ope if3tas m2elnvo u)aeeoxrctydopD lnvils texm(r3oudale mfvtls  2uaxrono4apxo ictytfmDraums () ltnifcta1oatelneilt)srxmxr nu4al emfctat arur( oot4apxnifctytlm2rmumonu4trtrir3totopDrlnvo;t sexrim3ny4opee neiatf 2tmum nu0olen iciadls2uanmsn(4 etoir iotoat aieil( trumio nodlm   nctasfaDuru pno1tpeniociyslm2uluvs (0 ltrmf3iatomDeaivslt)trurxrpiydamenmnvi tfaDuru  ;o0oexoiociydlm2ean o;u0 ltrifcty1lmtran i (  2xoxmpoo4opt lnei t  2umxmpnu4aetnmociydfaDulu snu)trtrxfcoy1lptr u ols0 rurio3ny4altemnci sf rrru  nu0aee mfetldlaDrl( p ()teenxo3oatopDrauvo;s0seuoxr iudlp emivil(fsrraxmo;u1tleo ociatfa2ea(vonu0aeenmr3io1oate uvo t0seum(opio4lp nmfei sf 2rmxrpnu4tee mf3iasfa rlnmo;t4tlermr todlp eanes s  exrim nu1lpeelnviat)sDtruroou1opxn octytfa2ran s;u0 lerxrctatlp e uesls0t2toiopnydopt lnei (fsrtax p;o1aee  icilt s2rln o t)alenxf iy1lptrlu sl() rurio3ou1alee feta()s2trumooo0texnmfeildlsDrm(vo;u)aetnxociotfp   i ilt  rtrxrpiudapen ivt t)aDrmxm ou0apxo fctlsfm2rauvo;u0arxnif3iy1fatrlnei;(0srtriopiy1olte ici tfsDurx  oo0tetomf3tyt m rmnmo (0aeenxocio1fp r n ol(0 2tmxr iodamenmfcilt aDumu  ;t4altnmfeiysfs rm(mp;t) lenifcto1opteai o s)t2uoir3iu4ol   fvsls)srurxm ;t0aexnmfctysfa uluvp t0arerxo3iytfm  luesl(  2um(m3nodlpt lietls s2urum nt4teeoif3tls s uanmo;t0 rxrxr3iodomDrai s t0trtrxm3nydal nlfct ( a2rrx p;u4alxnio3ilsfaDemu p;t4trxomo3ia1fat lues;s)srto(o3nu4op   ncia( sDuaxront0opeo o3ilsla2eaumo t4altnxo todfa rauvol(0sexr(rpoo1lltn iei (f Dtrxmo;t1tpenioeils aDum( p u4artnirctytom r uvo;t tetoxmpoo1lmee icsls)srtaxm no1tpx  f3tls sDrl( s;u4tltoxf ta1fatrliei s  etrir3nu1ameemfctas)s2ur(mp;u1aex mictasfs uln p;() lxoif iy1fa rluvs;s0 rxmxr3iu1omenmfctls arta( p;o1tet  ieiltlm2umnvont)arerir iadoaDr ivi;( trxo(mpoy4openlfvsltf rrauro;t4ale mf3tatla2elumo;(4tlxnmfcio1optrli i;s)s2tr(r3iy4alt lnesa( sDra(r no4alxomoeilt s2uluvo t4tltnifcoy1late ivo t)s2xoxrpno1olt licta()a2um(rpou0tltoioeiyslsDum(msnu)artrxr ootlaDrlu ilt0 eum(r3oy1ll nmnvsl(fsDuaur oo4aee  f3iyd aDrmnvsnu)trenxr3iadlpt  n i t)truo(opio4omen fvsls) 2raxm nt1aptoio3iyt s2uauvs u) renmo oo1fptraieo s trto(mpoo4alt mfesa()s2ra( o;o4aet mictad aDuln ont4aexoxfciy1fatraivsl(0s2toim3oy1apt  nesltfa2tr(rpnu0aee  fciadls rmnvo t) renmr oa1fat  n o;s trxr(m3oudap e fesl(f 2raxro;o4alxo i3iad sDem(vo;(0trxrxo iydfpte u i s)trxm(r3oo4om  lies ()s2raum nt0oltnio3ildfaDua( s u4 lxoif tydopt  uvil(0 2triopnu4olee iesasf rrmx pno1aptn fciadfm rl(vp u4tleoxf3iytopt  uvil(0 2umxopiu4lleelncil(  2rm( pou0tpx  i3iytfaDrmuvonu4arermrctadlmDe ues (0srtmxr3oudlmt mnesa( s2rr(m nu4apxoioeiydfm2umnmpnu4trxoiocto1op rlieils0seurir oydlme  fvt t) 2tr(rpnt0oexo o3iasfs umnvo u4trxrir3iydfa elnvils t2xo(m3iydol  lfet (  2uaxr nu0olt  ietlsfm2ulumpnt4tlxoifctydfmteaivs t0 rxrxm3iu4alen icia() Dumur nu4apxn ociat a2rmu s;(4 exnxo iotfm  aivsl(0seum(mpiu1lle licia( arta(rpno1aptn i3tysfm2uluvpnt0aleoir tadlmDeliei;s s2xrxm iu1al n feta(fs2raur ;o0oetoii3tysfmDel(mo u)trxnmo3tatfateaneil( teurio oy4am   ncils)srtm( o;u4tet  feiltlaDumuvo;(4 ltoxo iadom rlieo s)seumimpiy1omt  iviltfs2tmu  ;t1aetn oeiytfa2rmnvp u0 leoxr oatlp elues;s trtoim nu1lmt licsls) 2tmxr ot0oltniieildlmDel( o ()areomrciy1oa rau slt0t2umxo3io4amtn fetas a2raxronu1aexn f3ilt mDem( s;(0 etnir3oy1la r nvs;( tetoim3oy1lm   nvt t) Drauroot4oeto i3iydfmDranmo (0tetrmo oa1fmDranvilt0truoxopio4am   feta(  rrr(mo;t1olen o3tlsfsDea(vp (0 etoif iy1lpteaueilt  rumim3nu4amtemivtat)a2trumpoo4oltn f3tysfmDuau s u0 lerio3ty1oat aueo s0trumir ou4ap e ivia()srrax oou4aeenmoetat m el(mo t)texnmr3todop  li il(0 eum(rpnydll nmfei () 2ua(r nu4opxnmociat m2ea( snt0arermo oydfa ean s;() etr(r3ou1lp  livt sf rtr( pot0alxnmocilslsDrm(vo t) lxrxf3ia1fpte u ils srxmim3nydaptemfesat) rraxm ot4altniictldlaDrlnvs;u4trtomo3oadla e uvi;t t2trxm oy1aleelnvsls)s2tax onu1tltnioctltla2raumonu0 reoxo io1omtr u ils srxrxr ny1omeelivt tf Drmum ;o1tlx  o3iytlaDelu s;u)alxrxf iydla  aieolt)s2xr(o3oy1alt mfei s)sDua( p;u1oetomoeiat mDrmuvo;(0treoxociadlpDr ieo;t  euoxmpou4om elfes ()aruaxm oo0apenmf3ildfmDra( o;t) lxnxf3oy1fa r u o s  ruo(o3oodll  lfeslsfarrrxront4oexoiociatls rluvp;u0 eeoir iatomte uvs t0t2xoim nydlmt mnctl( aDurum oo0texn oeiydfmDuau s (0arermo3ia1lmDeai o t0trxoxm io4amt lfcias  2taum nt1alen feiyd mDrm(msnt4alxoxfctadomt lnvi t  exr(m3oudllt mfcsl()srua(moou0oleomfctltfs2eluvp;t4tlxoxo3oo1fatr uei ()teurim3oodoptemicias artaumono1olxomfeiys mDraumo () lenmo todfatr n o s  eurirpou1ll  mnct () 2ra(  ou1oet iicildlm2uanmo t)aexrmr3oa1fa e nei;t0srtmxr3oo1llt lietltfarrr( pou1oltoiiciatlmDuaums (4tetoxo iatlaDrauvil()s2toiopny1omtelfcsasf 2umu  no1oee ifcilslmDrm(mpnt) ltnxf oodoa rlivs;s)teur(rpny1lpt mfeia()sDrr(r oo4ope mf3iytfm2uauvo t4tltrxf3iatfmt ln s;t) 2umxo3io4olen ivtlt  rurxm ot4tpeomoeilt m uaumo u0arermf3tadlat  ies;s0 rxoim3ny1alt liet ( sDra(mo;t0olx  octad m rmuvpnu0 exnxfciodomDr uei;s0 rurxopiu4lle  ivt tfa2tmuro;u1tltomietlsls ul( ont0 lenmoctotla  au olt) eurim iodolt  fcsat) rrau o;o4opxnmf3tysls2uau s (0tetrio3todoatr n o;() eumio3io4aptelfvtat  Dtrx onu4aetoii3tlsls2emu onu)tleoir iy1opteluvs;t  rxo(m3iy1altn ies s)sDumx poo0tlxn fctas aDum(vp;t4arxnio io1faD luvs;t  euoxo3iodalte feta(  rta(r ou1oeen i3tad aDrl(mp t0arenir ta1fmDrlivil()setrxopiy1lm  mnvsls  Dumuront4tetn o3iat s elump;t0tlxoio oodfp elnvo t)teuriopou4ape  netls aDurumo;u4apxo f3iyd m rauvs;u4 reoifctadfpt  i o;s trxoimpno1aptnlnvilsf 2umur nu0oltnii3ilt m2umuvp;(4tltrmr3ty1fmtrlnvsls sexmir3oy4aptnmnvi s aDtm(ront1aeen iciadfsDelnvp;t4artnmr oydoa e iei s)trxoio3nu1lpenlnvtl(  2rr(mont1oltnioeiasla emums;(0alenmo ia1oaDr u i ( s2ur(opiu4ol  lfvsat arrr(rp;o1oltnifcilsfmDrauvsnt0 leoiociodoaDeaivi ( setmxmpnodal  mfvia()aDur( pnt0oee mi3iyt m2elu s;() rxrxo ta1lpD auvs;t  eumxo iudaptnlfcs t)s2ua(r no1opxn i3tytfsDumums;(0alenif ta1fm ranvil( tetoir iu1opte nctatfaDrm(m ou4opt  feiad a uaumo u0texnir3oadoa  aivo s0truriopoudopen nes s)sDrmu  ot4oetoii3iyd m2umu o () rxomo3oatfaDe ivo;s  exmimpoodlmenlivt ( s2tr(moou1oltnmietytla2uanmo;(0alenxo tydopD ln slt)texriopny1olenmnetl(fsrum(mp;o0apenif3tas a2umuvpn(0alxoif3oy1lmte neo;t  2xoxr ny4ome micils)sDtrxmpou1aet mieiaslsDrm(ms (0tleoifctydfpD li o ( teurxm3iu4aptn ncilt)sDra(r nt0apt ifciyslmDrln snu)teeoxo3tydomDr neo t)teuo(opoudome mnetat)srur(mo;t1apt mictls m rlnvp u0trxomf3iotopDelu olt) exr(o oy4ale lfvtls  2raxm ;t4aexoio3iyslm2eauvont4 rtnmrctytomDr ivil(0srum(m3iu1aleemnvtltfsDum(m ;o1tle  feiytfa2elu p t)artnxf3ty1laDeai ols s2uoxr3oodol n neta(fsrurx pnt1apenioetyd a2uanms;t)trxoxr totfat lnei t)t2xm(o oudoptelnciasfsrrrump;t0alt if3ias a rm(vp;u4aetomo io1opD anvil( srxmimpnudal e nct tfarumu pou4oltoioeiysfaDuauvpnu)alxomrctatla eln o;t0 exoxm oudllt lfvt (fsDrmumpnu1tpxo oeiydfs2umuvp (0tlenif3iatfpDraues t  2toxr oodoltnmicsls)sDuaurpnt0oexo fetltla emuvon(4 ltoxociytla r i sls) etrxm io1amtemneilsf Dumumooo1tlxn i3iytlmDumuvonu0trxnio ia1fmt lneol() rtoxo iu4lmeemicias sDtrum nt0oexo o3iytfa uan o u)tetnmfcto1fmtrlu i s0 2xrim3ny1om n fciasf 2taxrpot1apxo ocildfs2ea(vo;() exrircio1fptean olt s2urim no1ap elivs (  Dum(ro;u4aexoifetld mDemu p;t4tlxrmo ootfp r ivi s)trto(r3nudolt  fcsas aDur(rp;u0oeenmfctltfa2um( p t) rtrxr ta1omDeai ol( seurxopnodlltnmieia(  Dta(mpou1teeoio3iys s elumo;t)arxnxf todfpD aivs t0tetr(rpno4olt mivt tfsDrm(m ;t0teeomieiasls rmump;()aetoxr io1oaD luei;(0t2toirpoy1alte nvt sf Dra(  no1tee  oeiytlm2uauvs;u4aeenio iadoaD lneol(0 rxm(m iodaltelnvil()a2umxmooo1tpxn f3ilt sDel(vsnu) exoir3totopte u ol() 2xm(m3no1lpee icil(fsrta(ront0tleo o3iydfmDranms;(4texnxf tadfa  lneol(0sexrio iu4lmtemivia( s2raur oo0alenmfcildla ua(ms;t4tetoxfcoatlmD  i o t0s2xm(mpno4olenlivi t)arrmu ont4tpeoio3iysfs2ul(msn() etrio3tydfmt lnvsls) rtriopnydalt  netlt  Durx o;t4apx ioctls a rmums;(4teerif3oytfmDeai ol(0t2toimpiudlleemnet ()aDururo;u0aptnmf3ilsfa rlump;u4 etrio iotoa   i i (  2um(m3ny1aptnlfes () Dtrx  ;u1oexnmoeiasla2rln on(4aetoio tadlp   n sl( t2xmxo3no4lme mivsls)s2tru o;t1oexnifctldlsDuanms;()aeerxfcoydomte nvol() rxo(o3iydlme lnesltfsrur(roou1openmfetldlm2eauvo u4texnif3iy1lpDr n sl( t2toim ny1ol elnctltf rtr(  no4oltoiieiasfa ran o () leomo3ta1omtelieols  2tmxo3oy4am  lneilt)a2ururpou4opxoiietlt s2eanvpnt)texoxo3tatfmt lu i t) 2urxr3iu1ol  lfvtat)aDumxmono4tpxomfctys s rl( p t) exnmf ty1opD lieil() 2ur(r io1oltelfcia(f Dtrxmoot0tetoif3iys mDel(vsn(4altomfcoatomtr iei;( s2urirpiy4lme  nvi t)artmx onu0tleo i3tlt m2rl(vo;u0 rxnxf oodfaD aivi;s t2uoxr3oo1olen ivils)srrm(mp;o1aex mf3iyd m emn o (0tltnxo3tydomDr ivo;()texrir nudamtelivt s)aDtr(  ;t0texn f3iltlm2em(vo u) ltnmfcoydom  luvo t)trxm(r iu4ole liesat artmu pnt4aleoio3ildfmDul(msnt4 rtrmfcootomte u o s0s2xr(m no1amtnmnes t sDrax o;u1optoifciatfm2umnms t) exomo3totfa  ai sls) rtrxopou1ol  mfci (fs2uau oot4aeeoiictydla2rlnmo;u4aexnio3tatopD luvil( sexr(o3iu1omtemieta(faDrau  ou4tle if3tatls elumsnu)alenmr3iatlaDrlu olt trxr(opiy1opte ieiltfarrrxrpoo0tlt mi3iys s2el(mo u4 rxoif oy1fmD lieo ( tetr(r3oudlmee fvtas)s2ua(  oo1alxo oeiytfm eluvs;u4 rtnif oa1lm elnes;(0t2umiopiu1al  lies tfs2um( oou0texnmiciydfm ranvont)aeerir iodlmtrauvo;t0t2umxo3ny1olenmicils)sDtm(r no1olx iictlslm2rluvpn(4artoio oytlm  au ol() 2uoxrpnu4alee fcsat  rtaxmonu0teeo fctltlsDrlnmo t4alenmf iadomt luvs;t t2trio oy4lltelicsl( aDra(mo;u4oeeo f3ils m um(vo;(4aexnxo3oydom e i i t  rtmio oudlp  lncsatfaDur( p;u4tle  i3iltfmDrm( s;u)altnxf ta1fat  ivil(  2trxo3nydamt  ivi t aDururpoo4texnmo3tyt a2rlnmsnt4artnxrctadfat  i i;t)s2xrimpny4amt mfcta(  rraxmo;t0aptomfeiyt a2ul( pnt) rerif tadfa   nes ( t2trim3iydomtemiesatf 2tr( pno1tpe ioeils m ranvo;t4teeoxo3oy1fp   u i t truoxmpny1lpenmnvt t)arta(m ;u1aeen f3iadfm eluvs;t4tetnmrcoydomDr uvo s0 rumxmpio1lle lfcs tfs2umxmo;t1oexomiciydlm2ulumo;(4 lxnmfcoydoa e neo;s setmxr3oo4ll emicia( arta(rpoo0tltniieiad m rl(ms t4arxnxo3to1faDeli sls)srtmio3nu1lpen fvtltfsrtaxrooo1opeoiicias mDulnvon() eermr3iy1fm rlueo s tetoxo nu1ll  miviltfa2uau  oo0oet mocilsfa eanmpn(4 rxnif tadlp eluvsl()truoxr oo4apen ietatfartrxmo;o4tptomieiys a rl(msn()aeerir tydopt  ueols  exm(rpnodopt mivtl(f Durxrono4tptoifeiyd s em(mp t4arxoxf3oadlmDeauvols0srxoxm iydam e fctlt)srtr(m oo1tet  f3tysla rauvsnt4arxoiocoo1op  lueo ( trtoim3nudalte ivtlt)artmxrpoo0openmfeiasfaDemumpn() exnxr3iotlm e ueolt srtmxr nu1ope lnvils aDtaump;u4aeenmfciadlm2um(mp;t4trerxo3oadfmtrlueo;( trurir3oodopeelieiasfaDra( p;u0tpenmi3iydfaDrlu snu4 rxoifciotfmte n s (0trtrxm3ou4omtnmfvias)a2rm( p;t1texn octat m2umnvs ()tlxrir tydfp r uesl( srtmxrpnydllen iesas aDtaur oo4tle mf3tys s2ua( o;t0 ltrmr oy1lp eluvo t0srtrxo3io4ll emnei t srurxr nu4tpeoifetadlmDum( ont)artomocty1fp elnvils  rxoim oy1lltn iei ()artau ono1aeeoii3tasfmDra( o u4 eeomf3tydoatr uei;s) rur(rpny1apenmivt s arta(r nt1tpxomiciasla2rlnms;t0alxrmr3ta1lm   uvi;s  exoim nu4lpe  neslsfsDrm( ont4tpe  ociltls ranms t0altoxr oydlatraiei;(0 rum(mpnydopte icsl()sDum(rp;t0aee  fciatla2emn s u0 etnmf oatlatranesls0 exoir ou4omte nesasf rraurpnt4tlt mociatfa2emnms u) eeriocoodfp r nvol()t2umxm nu4lpe lfvtas) rtrx  ou4tltoii3iad sDua( p t)texoxo3oadlpt li i t0seurxr3nu4llte fctl(faDra(r ot0olxoifeias s2umnms;u0 ltnxr iy1fa rli o;s trum(r3iydom e iet tfa2umxrpnt4ale mictaslm rm( o t4treoir iodlaD livs;s trto(rpnu4om emnvtl(f 2ur(rpnu0tetnmf3tys mDrl(vpn(0tltoxo oodfm e i ils t2to(m iu1lpenlnetltf Drmurpot4tltn ieiysls rln p;()altoxf iatfpD aieo;(0s2urxmpoo1omenlncil(f rua(mpnt1opxniocils a2rmu s (0alenxf3tydoatelueils) exmxm3iy4lptnlivtatfaDtrur ot1texnmi3ias mDelnvsn(4aleoir3oy1lpt lnvo;s0sruoxrpoy1lltemnciat  2raxmono4tpeoifcildlsDrauvp u0aexnir3todopt  uvi;t0 rtoxopiydlmtnlfes sfsrraumo;t1tleo oeiltla eluvont0 eenmo iytopD lnvils  rxoxr iu1alenmfetl() 2umx  ;o4aeeomi3ilslsDrmu o t) renmo oodfmteln o t tetrirpoo4lptnlnviltfa2umx poo0optnmfeilsfmDeluvp;u) eenmrcoodopD au i;t)setoxr3oydlleemivt t)aDuaxmo;o4opeo icilsla2ra(mp u0texnifcoadfmtraiesls  2xr(r3iu1oltnlfvils)a2uaumonu4olxoifcils a ul( o;u) exoif3iy1om rlneols0seurxmpio1lltnlfvs ( s2urum ;o0tpt  o3iydls rm(monu) rtoifcoodfpDeau i t srtoxopnydll  mfct (fs2rmurp;o1tptn ociydfa2rm(mon(4texnif3oy1fmD aieolt trxr(o3no4lptnlfvtas  Dtmxmonu4alxoiocilslsDemnvp;u0trxnif iatfa ranvils tetoxopnu4alenlfctl()arumxr oo0tetomfeils m2rm(mp u0trtoxr3ta1oateau o;t trtmxrpno4amt mivtasf 2ra(  ou4tlxo ociatfaDrmu ont4treoir3tytfmDe uvo;()tetmio oo1amtemfci t s2uaxrono0tlx  iciydlsDemnvsnt)trxnio3oydlmt auvo;()trtmxm3iu1omt mfci (f Dra( o;o0tltoioctys aDuauvs;u)trxrmfcoadom  auvs;s0teuoxr iudapeeliei t)s2raxmono0aet mfeiydlsDemnvo t0alenxo3tatfpteli o s0t2ur(m oy1alee nei (f 2um(ro;o1teto i3iytfm rauvp ()altnmf oydlptraueslt)s2tmxo3iudom  mnvsltfsDuauroou0altniictlsla2eanmp;()aetrxrcty1lpDrlnvs;t) 2xoxr iu1aptn nvi ()srtm(mpnt4altomociytla el(vo (0texrxo3ty1lpte ies;s sruoir3nu4am emncia(  Dtm(m oo0aex mfeiys aDrmnvsnt)trxrmo3todlaDr n i;t)trxo(opno4lpen fet sfarrru oot0aeto feiasfm2ea( pnt4alxomo tadoa elivils trtr(r3iy4om  livtl() rrmu  no1opt  octad mDeluvsn(4aeenmo oo1fmte ivils0 2xmxrpnydlmtn fctas  rtaxrpou0tpxn iciytlm umuvp;u0alermocoatoat lueslt setmxm3no1lptnlfvilsf Drr(rono1aex mieiyt a2em(mp;()artrxr iy1oaDrluvs;t0 etoxr no4lpe  fvt s) Dumxrpno0aexo feilslaDelnvo () reoir3ootoa r nei t s2xrio iudaptemnvtls  2ua( onu4tlto i3iltfaDel(vp;u4 leoxfcoodfaDran i t0srxrxrpoy1ole mnciatfsrtr(rp;u1tlxnmf3tydlsDra(vsn()tetoir3oytlat luvsl(0 2um(mpoodlp nlietls s2umuroou0aleomoctydls2ra(vo;() exnifciatfpte ivolt) eur(r nu4alen netl(fsrraump;t4tptoioctad m2rm(vs u)arxrif3ta1omD  n i t)srxo(o iu4llt lfvtas)artr( ooo4tptomietadls2rlnms;t) eerxr3ia1fpDran ols0trxoirpnydlmtnmneilsf 2rmxr ;o0alx ioetasfs rmums u0teerxoctytlp  aieslt0s2xo(r io4lp nlnesasf ruaxmooo1tptoio3iat sDem(msnt0aeeniocoy1lmDrlieo t0s2trxm3oy4amt  ieil(fs2umu  ;u4teto octyd a ulnmo;u)tltomo iotlaDelu s;() rto(mpio4olenmfcilt)arrrxmooo1alx mf3tltla um(mpnu)artnir todlpDelneo;s) rtrxo3ou1apenlfes s)arurur ;o0tpxoioetydlsDul( o t0tlxomfcty1lp eaivol(0 exrio3nu4opeemneias aDtm(r nt1teeoioctasfs2ulu p;t0alxrmf3iadfm  anvsls) exrirpou4altelfvt (fsrtmu pnt1tptoioeiltlmDul( pnu0tlxomrcoy1fatrlues (0s2trim3iy4lpee ici (  rrm(roou0oltomf
\ No newline at end of file
@@ -0,0 +1 @@
+nes s0truoir3nudolenmfvt sfs2tr( o;t0tlt iietlslsDeanmo;t0alerio3tydlp rlivs s srtm(m3oudol   icsl( s2taxmont1teeo fctatls umn p (0arenio totlpDraues;s0teto(r3oo4aleemnvtltf rtmxr oo0tee mfctlsfs rmn p t4tlxnmociodlm eanesl( trxoxo3ny4lp e neil(fs2urx p;t1olenif3iydfsDeaums;t4areomr oydomtr u i s)t2urimpoo1ale livi s aDur(mp;t4altomoeilsfsDeln o;()artnmr oydomteaues t)srtmir3ou4amee fvil(fs2trx  ;t0tpxniieiyt m rmnms u4tlxoxocio1op e n olt0s2tmio iodolte fetls arumx  oo1alto ieiltlm2eluvo (0trtnmr3iodfmt aneilt0trtmxo ou4ol   fetls aDta(mo;o4tptnmoetys mDra(mp;()artniociadlmD lneilt tetoxo3ny4op nmivsasfaDta(r ;t4apxo i3iat m rm( p ()tetnmf oytla r ueils)sexoxr3nu4openmfcsls  rumump;u4tlxomieiadfs emu o;()arxomf todlaDrauvi ( srxr(o nu4al nlivsatf 2rrxrpno4tpeniiciaslmDranmsn() rxrifcio1om   u ols)setoxmpnodal  lnesas  2rmum ou1alx ioctadfsDemnmp;t0artrxocoy1laDrluvo;(0 eum(mpno1lp  mnvi s a2uax ont1oetnmo3iyd s2umuvo u4teerirctadomDeluei t)t2xo(r iudaptn ietltfs2uaxro;t1tpxnmociydla emnvs;u4 eerircoodfmtelies s)srurxm3iodll eliei sfa2uaum ou4tle mieiydlsDrmnvo;u0arxoif oadfa e u s ( s2ur(r3nu4op elici ( aDrrxronu0alt  fetls sDrmnvsn(4 rxrxo3oydfpDr ivolt s2uoxm3oudlltemnesatfsrumumpnu4tpto ieiydls2em( on() exnir3tatfm  aivo t0trtrio iudlpeelnvil(  2rr(mpno0tetomociytlm umnmp t4 lerirctadlmtrlu ols)t2xrirpoudoltn ncil(f ruax  no4aex mo3iyt mDrlu s u4 leniocootfptr ivs;s0teuo(opny4om  mics ()arrr(m ;t0tpeo o3tytlmDem( p u4aexnmocoy1faD ai o;s  2urim3nu4om emfctatf Dtaxmont0oexoio3iydls2ulumsnt0 leomf io1fmtranvils)trtoim3oo4alen iviat sDtaxmpnu0olxn o3tat s2uln onu)teenmr iodfaD  n ils0srxoirpno1oltemivil() rtaumo;u0aleomieias mDul(vs (0 reoifcoytfp   nvilt0trtoir iudlltelies t)srra( p;t1oetoifctad a2eaums;u4tltoxoctadfm  lnvi t)t2toxmpoydope mivs (  rumu onu0alxo octls aDelu p u0 exoxocia1oa   uvi s0 2xoxo iu1lpeelietls a2trum ;o0opeo ieias m2rlumo t)altomrcoytlptranvi t0 rumxo3oudlmtnmfet t aDraum no4ope  feiat s ra( o;(0aexrxf totoa   nvsls  2xrir ou4apte fei (farra(r ;o4alxo feiytlsDelu s ()alenmo iodlateauvslt sexmxr3iudole mfci (f rrmx pnt1oetnmfcildfa em(vp;u0texomf io1lmDrlnvol( tetrxm ou4lm   ivsl( artrxm ou1olxo fctatla2rauvs;(4aexomocta1lm rlnvilt)t2to(m3oydlm e nesl(f rur( o;t4tlx if3tas m2umnms ()artnxo tytomtrluvolt)srum(r nydlm n icta()arta( ono1oleniociatls uau s (0texomrciydlaD luvol( trtr(rpoo1lpenmfvtas  rra(m no1aptn oeiytla2em(vonu0treoif3tydopDr nei t truoxmpno1optnlfcslsfaDrm( p;t0optnifciad s eluvo t0texnmr3oadfp elieo;() rxr(opiydap  mnvtat aruaurp;t0tetnmo3ild m2ul( p;(0alxrxr iatomtrlueo;()s2xmxo3nodapt  fcil()a2trurp;u4tle mieiydlaDrlump t4 rxoxo tadla  lnvo;t trumim3oy4al  liesat)aDuax p;t1alx mictyd m rmn p;t) lxrxf oy1laDrau olt)s2xrir io4ame lnes ( sDtmu  oo0tpeomietlsfm eau p (4teerif iotoaDe ueolt) rurim3iydop e nesl(fartaumo;o4ope  icias m emn p u0 lxoir3iytopDr ues (0setmir3nu4ap  lnvi t)a2rax  nu0tee moctlslsDra(ms ()altrmr3todopD au ols)setrxm3iydlmtemnvtlt  Dtmxrp;o0apto oetas a ran pnt4 rxrif iodfpD lu sl() etrxo3io1op nmnvtl( arra( o;t1ope  feiltfmDemnvs;(0 rtnmr oadla elivo t  2xrxrpnu4ap emnes tfsruaxm oo1apt iiciasfm el(mpnt0aexoxo iy1opt  u ols)srtrio oy1lp nmnvilt)sDrru pnt1ape mf3iydla2emn s;t)trxnxfctodopD lnvi;t)teuoxrpio1optnmnetls aDur(  ;t1tlxniieias m ra(vs t) leomfcoadopDelnvo ()t2tm(m nu1ll e nviasfa2ra(rpou1ale ifeiadfa2el(msn(4aeenif iydopD  ues ()texoxrpnu4lmtemnci s)a2uau pno0aeeniociysfs uauvsnu0tltoxo3totlpD ai ols)t2xmirpnydap n ncs sfs2taxm nt1apeoiieiatla el(vs u0 exnxf iy1oa eln slt)setrim3nodlmtn ictat) 2rmxr nu0tptnio3tyd s2rmn p;t) rtrmf ootlmt  nvi;s  exm(o ny1lpeelnvsl()s2ta( poo0opxnioetatlmDum(vs;u4trtnir3ty1lm r ivi (  2uo(o3ou1op elieilsfaDtaurono4teeo f3tldla2umn o u) exrirciytom rluei s seuo(r3iu4lmtnlfes s aDtmxm nt1alt  ieiadla ra(vo u4treoio to1fp elivilt seumxo iy1aptnmivils aDuauro;o0aee  iciyd a2rmums t) ltrmf3iotfaDe neslt) ruoxr3iu1llee nciatfs2tru ooo4aex if3tldfsDulnmo;t)teenifcoodopDe ieo (0t2tmxm oo4al nliviltfs2raxmpou1tlxnmfctltlsDrluvpn(4texrir iadfa elies () rtr(opiodal nmnctat sDrrxmpoo1tpt  i3iydfa ua(ms;u0trermo3tytlpDraueolt s2xoxo iy4alt mfetat) rrr( pno1tex iieildlsDrmumonu0 etoif ootomDeluvo t)t2xrxm ny1llee ieiat  Dtm(mp;t4tetomo3tatls rluvs u)altoxr tytfateln slt) 2tr(m oy4am e fei (fsDtaxm ot0tltnmf3iatla2raumonu0 ltrio3ia1omt luesls0 rtoxm io1al  lfvtl(fa2taur ot1aleoif3tas s rlums;u4tlxrmr3oydfp   ies s)t2tm(r3iu1ap eliei s a2trxm nu4aet mietldls2el( on(4tltoxf iy1fpDe uvslt0tetm(mpoy4ol   fes t aDrm( ont4tpxn fciat m elu pnu)alenifciadfmt lnvs;s trtmio oydlpe mietls  Dtau o;o1altomoetadfa elu pnt)aetnmo3oytfmte nvi;t trumir3iu1ole mfci t)arrrx ooo0alenmoctysla2ulumo;u)alxnifciatla  livi;s s2xrxr oodomte netls srrr(r ot1opto f3iltfaDemu o;(0 rxoxo oy1lmD  u o s0tetrxopiu1al nmfvslsf 2tmurp;t4aee ioeiyd m elumo t)texomf3tytfat an s t0teumxmpiu4ap e ivsat  2ra(rpou4tlt mfeiytlmDrm(mo u0 rxoxfctodfp rai o;() rxmiopoo1lmeemiet sf rrmx  ou0aleoif3tlt sDeanvo;(0tlerxo3iatomD  nes;s  rtm(opnodamt mfeil()srrax pnu4alen feild m umumo t) lenif ta1oat aivo;(0 euo(r3iu4amtemnvt s s2rrxmp;o4oltomi3iasfm elu s;()trenmfcty1fa elieolt s2xm(r3oydol elfcias)s2rr(  nu4apeniieiyt s2rmuvp u4trtnmo tydfpD aues;s)srtrxr3nodol emfetasfsrrm( o;u4ale ifctysfaDran o;t0aexoir3ootomtrlues;s0seurio oudlm  lieil( s2rr(ro;u1aeeoii3iysfaDel( o (4arenmo3tatla rlnvils) 2xmxmpiy1lp emfvt sfaDuru  ou0texnif3iysfaDemumpnt4arxoxr3oo1oaD li s () exmimpio1amtelicils s2um( pou4tlto i3tyd s eaumsn(4aeenmrciotla r uvsl()t2xm(mpiu4opeemfes t)aDtau ont1oltnii3iadlsDuanvo;()artoir iatfpDelivol(0s2ur(r iodome mneiltfs2rrxmp;o0alenifctysfa2eau o;u)arerioctydfa  ln o;(0s2urimpny4lpen fctlsfsrta(mpnt1oet moctlt a emuvs;u4tleoir to1omD  ueo ( trurir iodopen ieiat)s2raxrpou0tlxniociydls2uan onu0 renmr3ia1oaDr ueol()s2tm(o3no4lle mnvslt)aDrrxmoou0olt mictlsla ulnvon() leoio tatfptr uei ()teum(opnydlpte fvi s)srrmum ou0olxnmo3tasfa2rm( s;t)tetnmrciy1lmt luvsl()s2xoiopiu1ole lfvtas) 2tmxr nt0tpenif3ils mDumuvo;u0 lerir3io1oate uvi;s) etmim3iy4apenmiesltfa2uaur nt0tex if3iydfs2rmumo (4tlenifcootfatr n olt s2xrxm3no1ome mfeilt)sruax o;t4oexnmocils mDuanmo ()alxrxo ta1laDr u ilt)srumxr ou4ll  mfvtas)a2rau  ou1aleoio3iysls uauvsnu0tltomfcoytfpteau o;() rxoir iu1lltemfeia( a2ta(m ot0olenii3iasla umuvpn(4aeenxfciotfate nvo t)seum(r3no1lltn iesl( s2tm( oot0tpt iictasla2em( sn()trermr oydoptrai ilt)s2toio3oodalt mies (f ruauront1tlxn fetys mDel(vp;u)trtrir3oy1fptean sl(  exoir oudal nlfetasfa2ur(rp;u4olt  i3tlsla2ua(von(0 exrxf ootoaD  i sl()trxm(m io4om nliei t)arrmurono1teenif3iadfa2ulumpn() rtrif iatlpteau o ()t2xo(r3iudomee ici sfarrm(  no4teenmi3iadfsDulums u4trxnircoo1lptrluvs;t)srxm(rpoy4opeelfcil(f Dtru  ot4ape  i3iasls2rlu p;u4aetnxo oo1opD  nvs;( sexr(m ou4oleemnvsa(  rrmxroou1apxn o3iyd a ra(vsn()tlxoxfcia1fp rauvolt0truoxo3ou1llenmiet ()s2ur(  oo0tlxn oetyt m2ul( pnt)tltoirciytlp eauvils)s2trxmpno1am  mfesls) Durx pnu1altomfctasfm2rm(mp (0aeermf oodopteau s t) rxoxm3nydomt  fcs s  Dtrxr ot4aexomiciasls2rmn s;u) rerif oytomt  ies;t0 rumir iy1om  mictlt)artrumpot0tpe moctad m2umn pnu4aetnioctydlmtrli il()setoio oydllt lfviasf Drrx poo1texoifeiysfaDelnmsn(4aexnmo oatom e uvil( trur(mpoy4am   ivt (fs2ta( p;o0opt  oetad m2ul(ms u0tlxoiocta1la rlnvs;s sexmirpnydomenlncs t aDrax p;u0oet mociasla2ulu p u0aexriociy1lp e i ols0 eur(r3iu4omen ivslt aDrrxroot1oexn f3tydfs um(vo (4alxnxocoy1fmtrlivo;( setrio3ny1lm e netls s2umxro;o1tpe mieildfa2rln p t)artnif oa1fmtrlueo;(0trumim3io4amee ictltfsDtau ooo4aeeoif3ils aDel(vpnu4 rtrircoa1fmt anvslt0setr(m3oy4ale  ieslt arrmumpno4ape mo3iltfa rlnvsnu)arxomrcoydoa r ieols setr(m3nydalee icsltfsDtmu  ;o0aeeomi3iys m emuvp;(0 rtnxrcoytfmtr nvi;s  ruo(m oydop nlnctl() 2urx  nu0alxomietad m eanvs u4 ltomo iy1lmD  ies s0sexm(o iu1lp   ictl(f Drrumont0teenifetltlsDuluvp u)treomo3oa1oa eli o;t0t2um(r iu4altn icsas)srum(root1tee mf3iasls uan pnt0 reoxoctydfmtr i s s0srxm(r iydlmee fvsl(fsrtaxrono4alxnif3iytls2um( p u4altnmf oadfaD aieils)teuo(opou1om  lnct ()sDrrxrp;t0aetomieilsfmDea( o;t4aetnxr3ta1fm eauvs;t)t2urxmpio1om nlivtas srra(r ;o1oltnmfetydfa umump t0 lerxociytopt  ies t0teum(o iodaptn netatfsrrax p;u0alxnmfciat m2ua( p t0 lxoxf ootlp raneils  rxmxr iu4am  mfetatf 2rr(r oo0oeeoio3iat s ulump;(4tetrio iy1opD lnesls  exr(o oo1om   fetatfaDrax  nu1tlto ictydfa2el(mpnt0 etrmrcio1opD  u i t  etrir nu4lpe lfei ( srtaurono1teeomfciatlaDeln p u0aetnxo3iodlmtr nes;s  eum(rpoy1ole  feilt aDtaum nu0oexo f3tld aDea( p;(4aexoxo totomDe nvs t  exr(m3iu4optn nvsas srraumpnt0ape  fctatls raumo;u0 lxnio3oa1fmtr n ilt)srxrir3nudll n ncsltf rraxmooo4oexn oeildla2emumont0teermf3tytfp eaies;(0seuoimpou1ole  fet (  2urum no0oet miciydfsDea( o ()tltnxr3iydfa e n ols t2um(opiodll n nci ( sDurx o;t1oex mieiys sDea(vo u4aexnmr3oo1omtraivs;s0 etrxo iu1ap e ictasfa2taump;u4altomoctldfs2rl(ms;(4arxnio ia1om elu olt  2urim3iu4am elneta(faDumxronu4tpeomo3tatla rauvonu0 rxomf3ty1fmDe ivo;s)trxm(opno4am  mnes s  Drmx pot0tlt  ieiadla2em(vs t0trxnxf ootlpDelieil() 2uo(rpoy4opeemnci s) 2tax o;o1aexo oetyt sDrlumo;(4 eeoxr3iotla   i s t0texrxrpno1lmenlnvs () rtru p;u4tpeoio3iltlm2um(vo ()tetrxr iatom   uvo;s)setoxrpnodopt  ivtl( sDurxrpnt0alen iciat m ra(mp (0 rtrio iytlp eau s;s t2xoxo3iy4ape  feil(fs2tr(m ou4ole ifeiytfs2eanvs;(0altnmoctodfpD  nei s) rum(mpoy4al n ivtl(fsrrmx p;o0tleo feiasfm ra( p;t0arxrmf3ta1fp elu ils) rum(opoo1amen fet tfaDuaur ou0tpeomi3iasfsDeanvpnt0 leoif3iy1lm r ivsl() 2xrimpoodalenmfvsa(fa2rm(roou0olxnmoeiatfa ra(vp (4 rermf ta1lpDrau i;t0trurxr3oy4alee fesl( aDtmu  nu1aex ioeiysls2ra(von(0aetnir3iotoa rluei s) exrxmpou1aptnmfetat aDrmxro;t1tlxoif3iysla2rmnvs u4 leomocoatfa rluvil( t2tmxr oy1omtnlnvtat sDtrum ot1tlenifeiltls2umu s t0arerio oadopt luesl()sexmim oodlpee ivs t s2ua(mo;u4oexoii3ilt aDuan snu)aeermrcto1omtr u il( s2xoir3oy4opee iet (  rumxro;o1tpt  ictlt a2uanvs t4 rxoir3tatlm  livils srxmxmpoo1lpt lnes (f rua(ro;u4aetoii3iydfs uaumo (4trenmfcty1lptraues s0 eto(m nu4apee neta(  2rax  nu0altn ictltfs2rl(vp ()aeeomr totopDraieo (0 eurxr iy1omt lnvilt)artrxro;t4tptn icildfa rmnmo u4alxnmr3tytomDelnvs ( s2tmxr ny4am elieils)arumu ono1aptniictatfm2uanvsn(4 lxrifciy1lmt ai ilt) 2urxm oo4am emivtasfa2uaump;o0aeto f3ilt s2ulu o;t4 rtrir3iytlaD ai s s  eto(m3oydop nliet sf 2tau ooo0aexnio3iaslsDulumpnt0trtrmf tatomt  u o;s  euoxm3nodolt  ieilt) 2umxmpno4apxniociaslm2emuvsn(0trxnmf oytoa rlivi (0 rurxmpio1lpeelfciltf Dtmx o;o1oetomi3ilsfa rl(vo t0texrmf3ia1oaD aieo;s0 rtoir3ny4aptemfvi (fsDtaxr ot4optnmieild m elnvsn(0artnmo3oytlpDrauvol() rurir3oydopeemietl()s2taur ;u0tpxoio3iltlaDranmp (0 eeoir oy1fatrli ils)s2tmio nodlpenmnetlt srraxmpnu0alxomieiydlm2rlums t0aexoio iotla rlivi t trxriopnudamtn nvsa(faDum(  ou4tptomietlt s2elumsnt4arxrxrcoo1lmte uvi s teto(r3nodal  mfvilt srtm(r nt1oexn o3tyd s rmu pnu4aexoxr iy1oaDranvslt srtr(opnu1lleemnesas artmu  ;u0alt mocildfs2el(mpnu0arenmf3tatlmtelueo s0texmiopiu4alt  nvt s sDua( pot0aetoifeiydfs el(vont) rtrircoadfaDraueo;() rtr(r3nodomtemieia(f 2ua(mono1apxnio3tlsfs2eanms t0altnif3ia1oaD ln sl(0 ruo(rpny4lleelfvslt)arraurpno4aleomo3tlsfsDeau s;u)arermf3oatfptran olt) rxo(mpiodalenmfctltf rtmxmonu0tle mf3iysfs emn ont0trtnxfcoydfm   i s;(0 2xrxo oodoptn nvsas)s2trumono0oeeo oeildla rmn p t4tlerxr iodfpD lnvs (0trto(opiodolen feta()sDrau o;o0aeenmocild m2ul(vs;t0texnxf oadoa rlieo;(0 euoxm io1lmt mies t  rrmu oot0ape iociydfm em( p t0tetrxfciatla elu o s s2uoxr3nodoltnmfctl( s2uaxrp;u4tpen i3iytls ulnvo;t0arxnxo3oadla elu ilt)setoxm iu4olen fcia( s2umum ot0tex iietas a2ra( pnt0texomf iatfaDe neo;(0trtr(opno4ame mictlt) Dtmx onu0aeto o3iatfa em( s (4 exriocoydoa rli ols  2umxopoudll e fcta(faDtm(rp;t0aetniietysls ranmonu0 rxomrcta1fa   uvils0truoxopiydopt mfct sf 2uru pno1aet ioctysfaDemums u)tlermf totlpt li ols)truoim iodalt lfcsat a2raxmpou4tpxnmi3ilsla2ran o ()altrio totlm elnvs;s)s2xmim3nu1al elnes tf 2tmx onu4opeomi3iyd aDrauvp (4 lxnmo totlmtelieils0teto(o iu4lm n fetas a2umxm nu4tptn ociasfs emuvonu0texoxociatla eanvsls0s2tmxm iu1aptn fvtas artax  oo1apxomiciysls rl(msn() renxrcoa1laDrlieslt) eum(r oo1lpt lnetat  2urumpno0tptnifciytfsDeau p;u)altrifciytlmDelnvs t0 eto(r no4ame lfcias  Dtaum ot0opxoif3tls s2eanvo t4artomrciodoa  aiei;() rtrimpiudolt mfetltfa2urum oo0aptoiietltla elnvs t) rerifctatomDraues;t)srxmxrpiydlp e nei ( aDur(r nt0aeto ociadfsDem( s t)teenxo io1fmDe i o;s) 2xr(o3iudlpee ivs tfa2trxm ;o1aeeomf3iatfm2elnvo (4artoxocoo1fatr uvi;s0s2xoir3io1llen ictlt)aDuaxr ou4aptn feiysfsDrlumpnu0altoir oy1opte n i s trtr(r ou4omee icsl(f Duaxm ou1tee  oetyt m2ua(vs (4 lxnirciodfat  nvi;s s2trxo3no4apee ictat arra(rpnt1olxoiociyt a em(msnu4 exoiociotoptrlu o ()s2trxo iu4opeelneslt)sruru ooo4tlt if3iytls emnvp t4arenir3oadfpD aiei;s) rxoxo3oodap  lictlt) Drrumo;t1apx mf3iltlm rm(ms t0trerir3iydlaDrauei ()s2uriopoydamtn neiat artax ont0olx  fctlt mDra(ms u) rtnmf oatfm e n s ()srxo(mpiudlpe mncsas)a2tmump;u1olxnifciydfaDeau pnu4 rtnxo3tydoa ran i s  2xo(rpou1ope  fcia(fsDua(m nt1tlt ioeiydfm2uauvon(0aexnxocio1oa eli o s0 eumxm nu4ap  lneilt)sDrm(r oo0olxn f3ilsfm ra( ont4arenxo3tadfaDeaneo s t2uoxr3iu1ll n fvtas aDumx ooo0alxnmi3tls aDrlnvo u0 rermo3ia1oaD  nvils0s2tr(r ny4olte fvias)arrmxroou1oetniieiyd aDeau s;(0artrirctatfpDe n o;(0trtrxrpoodal e fvsatfarumxr ou0altoiicildfmDel( o t0 ltomo tadfmDrln ols) 2xo(rpou4lme licsa(farrmumonu0teen ociydlsDumu s;() lxnir3oy1opD  ivsl(0t2xo(o3iu1al elfct t)s2raxm ;o4altnio3iyslm2uanmsn(0tltrmrcia1oateln il(0 2ur(o3nodll nlfesasfartm( onu4tpe  fctltlm2elnmo;(4altnio3tydomte neo;t)srto(rpou4llt mnctlt) rtax  ;u1tpenifciltls2uaumonu0alenif iy1laDr nei;s0 2uo(r nodomeelfciat) 2uaxmp;u1tlt mo3iltlmDrauvon(4trxomo3tatoaD  u o;s  2xm(r io4lptemneslt) Dtrx onu0texo fetld s2el(vpn(4 rerxo iadfmD auvi;(0 exmir3nydol   feia()arrrx pot0tlxomocilsfm2elnms;t0 etomr3oatoaD li s;()srxmxrpoy1omenmnctatfsrtm(m oo1tptoifetyt m el(monu0 eenmo iydfpD  u slt0srxmiopno1al  lnvi s sDraxm ou4tpt io3tydfaDrmu on(0arerif3iytopD an o;s0s2trxo3nydape lnci tfaDumxro;t1tee  i3iltfm ul( o u0 exniociodomteln s;t) 2triopoudamt lieil() Dtmxro;o0tltnioctlslm2rmnms () exrxf3oadop  anvo t0seur(rpoy4ame lfcils arrau onu4tptomicias aDuln s u0 reoxrctodom  luei t setm(o iudoltnlfct sf Dumu oou0optnmfeiadls2eau snu)artnxrciotopt auvs t0srtoir3ou4amt mictat)aDtmurooo4tpxnii3iyt a2ulums u4 ltoif3ta1faDraieils0t2trio oo4lpee iesl() Drmx o;u4aeeomfeiyt a2rmnmpn(4 exomfciytomDrlies;()s2xoimpiodlm nmncslt)sDuaxroot0opeo f3tlsla rmnvo (0alxoxo3tytla rlivo t) exm(r3nu4opt  fcsat)sDrmx  ;t1tlxoiietas aDrlnmpnt4aleriocoa1fpDr uvi s0s2xrxmpno1omeelnvt (fsruru p;o1apxnioctat mDum( p;u0arenmr3oo1optrlu o;s0seumirpio1omtelfvs t)arrmxr ;t1tptnmi3ildla2rmnmo (4tetoif3iatlmD auesl()s2uo(r3oo4lmtemncil(f Duaurpnu4teeo o3ils s umu s;u) lerio3oodfatrlu ilt texoir oy4amt lici () Draurooo0tptomiciltfaDeanvo (4 lxrir iy1faD livslt  rto(o3oo4lm emfvsl() 2tm( ont1tpxn o3iadfa ul( snt) eenxo oy1fat  u s s0setm(opno1al  lici () rtmx pnu0tpt mfctldfa rmn o;(4alxrirciydomt  ivsl() exrxopiu4olenlivias) rtmx pot1oetnmfctas a2ranvon(0arermf iadopDr uvslt trtoio ou1ame mnct s  Dumurpno4ale  oetld m2rmnvs;u0treoiocty1lmtelivo;s t2toio3iy1oleemieil()aDtm(moot1oltoioeiydfaDemumo t)aexnmfcoydfm  aivol(0 eurxrpiu1am emietls)sDuax  ;o0alxoiicilsfm2rmumpnt0texrmo iadlm  luvo;t)srxrxr iy1lptnmiet s) 2rrum ;u1tex  octadlaDra( o;t4aetomo tydlpD li o;t0trxr(r nudlpenmieia( srtm(  nu4oet ifcild aDua( o t) rtomr3totfp rlnvi;s  eurxopny1olenliciatf 2ua(rpot1tpe  feiltla rln s;u)tetrxr3totlmtean sls0trxo(r oo1opte ieia( arrm(r no4oleomf3tlsfsDea(vp;(0 etriocoodomDeauvols) rtrim oy4optnlivils artmxmp;u1oetnif3ils s2rauvs;u)teenifciadomtrln o t0srxmxr3iudlmtnmici s  Dumxmpnu4opxomfeiatlmDul(vsn(4artoxo3oodlatranvils) 2uoim3nydapt lnvs t artmu oou0apt miciad m2elumsn()tlxomf ia1omD an o (0 etm(m3ou4lptnmnetls s2ta( p;t4tlen oeiyslm em(vp u0 rtomocia1oa  luei;t seto(rpoo4ameelfcias)srtrxm no0oltnii3tasfm umnvpnt4tleoxr iadfatelies;t truo(o iudolenliei (fa2raxr ;u0olt mf3tytfm emnvp;t0alerxo iytoaDe ies s0srxoimpoudaleelfvsltfsrrruro;u1olen ieiytfm emuvsnu) lerif3tadla e i i;()s2uoim oydlpeemnvsls)s2ur( poo1tlx mociasfs el( snu0altoir3oo1lat  n o s0s2um(mpny4ap e fvtlt) rrm(mono4tlx if3iaslm2ulnvo;t4arxnif3iotomD lueslt)teum(m3io4ome  fetl( a2tm(rp;o1olxomfciytla emn s t0trtnxocoa1omtrlies t s2toio oo1ale lietlsf Drmu p;t1tltoifeils m uanmo t4 reoxr ty1fmteau ils)teumir3no1amtnlivsa(fs2rax  ou4alen fetlt a rm(mont)trxnmf3ty1la rlivils)truoio iu4lpee nvias) 2taxmo;u1tlxn f3iytlmDrm(mo t4trenmr iodfm   nei;()s2toirpoy4ome  fesa()a2rmxmooo0aexnii3tldfmDeauvo u)trtnxr3ootoat lnes;s trxo(m no4al elicsl( s2rrxmp;t1optoiieiadfs umnvsnu4 lxoif3oytfate ieilt)t2ur(opnu1ope lnvilt) Drrxro;o4oeeo i3ildfa ua(vsnu4 exnifciytfpte ueol()t2xoxmpiu1ap elivia(f Dtrxmo;o0tet  f3tld s emn o t)tltomr todfp  auesl(0teuoxr oydamtnmivs t)aDta(rp;u1optn fetydfm ul(vp t) ltnir3io1omtelnvo t0 rxrim3nudam elfviasfarrrur oo4olenmf3iadfs ulumo;t)treoxo ta1fp elivolt seto(r3io1lme mieia(f rrr(m nu0tetnmictad m2el( on(0aexnio oa1fate nvi ( truoiopio1opeelneilt) 2ua( p;o1aleo ocilsla2eanvs;u) rtnif io1opDe ueo ()tetmio3iy1om  mnci (f rtmur ot1tpeoio3tasfa ulu s t4tltoir ia1omDr ueo;() rxm(m nudome mfci sf rraumont0tpxomociyd a2ulnvp;()aleoxrcia1lmDranvi;()trtrim3iydamen ics sfarumumpno0teenmfciatlaDul(vsn(4 reomf tytlm   nvi;t0srxm(o iy4op   neilt sDtaxroot1tlt if3iatlmDrluvsnu0teenif3oa1omtrlivi ()trxoxm3iodlme livtat arrax ooo0aeen iciytfmDrm( sn()tlxnif iy1fm  li i;t0teuo(o3no4lm n ivt () 2tr( pnu4alt io3iasfm2uln s (0 ltnxr totomDrai s;s teuoxo iudapt lnct t)a2ur( o;u0tle  i3iat m ra( s;u)tlermo3iodop   ieo;t seto(rpoo4optnlicil(  rtm(  ;t4opx  fcildfa rmnvp;()trenmr tydoa eanvsls0t2xmxo io1oltemnci t)s2trxr ;u4opxn f3iys m em( o;t0treriocoatfp   n s t  2tmxo ny4lm nlivi tfs2um(  ;u0aee iieiysls2umnvp t4treoio ty1oateaivolt setrim3oodlpe mnvtas s2ua(m ;t1ole  o3ilslm umuvp;u4texoircto1laDelnvs;( s2tr(m3nu1olt mnviltf Draxr nu4teto i3iydls rlumo u) reoir3oatfmDrlieo (  2toiopoy1opt  fesa(fs2umx  nt1oee mictyt a ra( snu0 exnxo ootfa  ln slt)s2tmim3io4ap  mivilt artrxrpno1teeoiieias s2ua(mo;u0 rxnio3oydlm rauvs;(0s2xoim nodaptnmnvsltfa2um(m oo0aeto i3iys s ulu s;t4artnio3ootlat luvo;t t2xmir3ny1lptemfct tfsDrmxmo;t4opx  ocilt aDumuvp t4teeomr io1lp eaneo;s setm(r oodlpe lfciatfsDtauronu1openiociasfm ranvo;t)tetniocoatfm r neolt s2urxr3nu1apt micsat  rur(  ;t1tle  iciatlaDrm( s t) reoxr tydlmDe u i;s)seurxmpny1apeelneilsfaDuau  oo0tpx mfciadlsDrlnmsnt4 leomr3oydop  anvs s sruo(opnydlp   ncs ( arrr( p;t1ape if3tyd a umnvo u0aexrir3totomtranvs ( t2to(mpoudal nlnctl(f 2rmu  nt4tlx mieiatfm uauvsnt4 exoif3iadoaDr i s;( t2toir nudome  nvi tf Drr( pnt1tlt ifeiad s elu ont4tetrmocty1oate ivo s  eumio3ou4ameelfvsl()aDtr(ro;u4openio3iydls2em(vsnt)teenmf tadlm   n i ( t2ur(m oy1lleemncsa( arrau poo1texo ieiasfa el(mo t)alxrmf3iodfat  ieil(  rxrio nodope lics ()srraxmoot0tetnmociasla2raumonu4 lxomocty1laDe uei;t)t2toxo3nydole  icia() rtaxrpno1oexoifcildfs2raump t0tlxnmo3oytomt li o s  2urxmpio1lltelivs ( srrm( p;t0olt ifetat sDua( sn()aeenmrcia1la  ai s;s0 2toir3ou4op n fviat)aDua(m ;t4ape ii3ilt mDem(mpn(0treoir3iytfm rluesl( t2umirpiu4lp nmicsls  rtaumo;u0tet mfetytla2uaumo t)artrmrciytopD anes;s0 2trxmpnu1lm   nvs ()s2urum nu0olen f3iat m2rm(mon()altrxocoo1lmDrli o t) ruo(r iu1llen fes (f 2ua(r ou1tpx  ietyslm2rau p (4 lermr3to1oaDe u i;(0teum(m ou1apeelfviatfsDua(mono0oet  fctyt aDem(vsn()tetnxo iadfmtrau i;t  etmxopiy4apt mncs (  Dumx oou0opto octaslaDem(mpnu0alxnmrctatoa e n o () ruoim3iy4omt lieiltfsDtrump;u4opxniieiatfs2el(vo u)alxrif3oy1la e nei t  eumxr iydlm nlnvilt)s2urumpot0aexoifeiytlm uau ont)aeermocootlatr u sls0t2urio3ou4amtnlfctlsf 2ra(ro;t1altn f3iat sDeluvpnu0aetnif3oydlmte iei;t) eto(o3ny1olen fet t  2rm(r ot0alxnioctyt s2ea(msnt)alenmf iotlatrauvs t)trtoir iudopenmnetlt sruaum no4tle iictydfm rmumo t)altoxrcoy1om raivs;t)seto(m ny1olenmfeiasf Dtm( p;t0teenioetytlaDrmnmo;(4aetomo totom e n s;t0 2toxo3iy4alt lfvi s) Dur( o;o1tptomfciat m2rlumsnt4altrxf ta1lp e neolt0s2trxmpoy4op e ics t)a2ua( o;t1aeenioeildfm2el( o (0 lxrmr iytfa  anes s  2tm(mpnudlp  mics t s2tr( o;u0tlxn feiltlaDean s u4trxrmfctotopDrai s t)sexmir iy1lptnmncs t a2tmu  oo0oltn f3taslsDulnmont0tetrmr oy1omDeaivo ( srur(mpnu4oltnmivi () rrmxmpnu0aeeomfctydfmDuanms u0 rxnir oytlptelueol(  euoim3ny4lle lneil(f rtrxm nu0apxniocild mDemn p;u0 lenir3iydfmtean olt0 rur(m3ny4ll   ivta(f Dtrurpot4aptnmfciltla2ran p;u0 rtnxfcoy1omD  n o ( srtmio3ny4aptemieslt aDrr(m ou0oltomoeilt a2uaumo;t0 exoif3iatfm e nvo (0seurxm nu4ape  nci t) rtr( poo4olx iieiyslm2rl(ms;u0altrif iatfaD  nvslt0teurimpiy1ape  ncsls artax p;u1olto feils m2umnmo u) renmo3iotlateai ols seto(o3nodom  mncsltf rtmurpot4tltomocils s2uanvsnt)alxomocoy1opD li o ( s2xoxrpno1lmee ieil(  2ur(root0alxn fctls sDuanvo () ltrif oydoat anvs;t0trurio3no4llte feiatfa2raxmo;t4tpxnmfcilsla ul(vo t4aetoircoy1laDe ivolt0srxrio no1lm e ivil()srtrxro;o1open fciydlmDra( s;t)tlenif to1lpte neolt0teuoxopoy1oleelfesls) rtrxmpnu1alxn fctldlaDrm( sn(0areoirctadlm  ai i;t0 rtmxr3iy1lltnmivsa() rur( p;o0apxn fciasfa rlumont0teeoxf totfpDe nvil(0 euoir ou1op   fcia( s2rrxm ;t0tpxnmocils mDra(vs t4 etnxfciy1omteauvi;()sruoim iu4omtnmiei tfsDumx poo4tpe ii3iytla elumo;()aeermr iadfateaues s)texoxr nydape mfvi tf 2tr(  ;o4aex moeilt a2elums;(4teerxrctodfpD lneo (  rtmir nydale  fcsa() Durx  nt0ope mieiyt s elnvs;t0trtomf3oydfp elnesl( t2xm(mpio1lpe mncsasfa2rax  ;u0tpe ioctltlaDumn s;u4 leoir totfa ranvi ()s2tr(mpiu1op  micils) 2rm( p;t1aex  f3ilsfsDrm(vp;u)arxoio3totopteanes (0 exrxrpoo1al nlici sfaDrrurp;t4aptnmieiltlm2uanms;t4teermr iytlm   uvo;(0sexrxopiy4lm elnvt s srtmumpot1aeenifeiyd a elnvsnt)tleomf oadomD lu s (0trxo(rpiu4ome lnci sf Dum( ono4olx mieias m2emn pnu0trenxo3oa1lp   u o;s srtrim iy4ll   fctas  2rr(m ou4olxn iciat a rl( p;u4tetrmf3ootfmDeaivs;s) 2tmxr io4am nlfvslsfaruauro;u0alx miciyd mDua(vpnu)tlxoio ia1omte nvi;(0s2xm(o nu4ap e nvt s) 2rm(m oo0texn f3iadfsDem(vont) rtoio3oydop  au i;s seur(mpiydlpe micsat) rumum ot4alt mietltla ranvp;u0 eeoxo3tydlmDrau o;s) eum(m3nudam n ncia(  rtmx  oo1aexnif3tatlm2rmuvpnu)trtrmo oy1omteau ils0texmxopiodlpenlietat  Draur ot1oltoifeiatfsDumnmpn(4arxoxr3iy1fp rlu sl( setr(m ny4lp emneslt)sDtr(m oo1oltomfeiydfaDrauvs;()artniocootfaDrai o s  2tmiopoydaptnlivsat)aDuaur oo0oex mfetyd aDraums;(4 etnmo3iytop rlu o t  rum(mpiudape miet s) rurxro;t0tlx  i3ild mDra(vsn(0aetnifciydoptranesl()srur(mpnudapenlneil( s2ur(rpnt4ape if3tltlmDul(ms t4alxnmr3iydlpD an s;t0srtm(r3oy4lmtn nvsasf rrau  ;o0tpen iciad a emumo (4 leoifciytla   u o ( trurim iodal elietat)sDrrumo;u4tpxnmieiadlm2emn sn()trtrxfcoa1la rlueo;t0trurxo3ou4amtnmnet s) Dtaxro;u0aet mieiytfaDrm(vp u0altnifcoo1lmD ai i t0 euoxmpiudam   feias sDur(rpnu0aptnif3tyt mDrmnmo;t4 rtoxo3tadlpDe n s t)srxm(opoy4ole lnci ( a2umu  no1tltomo3iatls2um( p (0artnmr3oydlm rlnvs t trxoim ny1apen ictlt artmum ou1tleniociatls uanms t4alxnmo3totop eaivo;s)trtm(o3oudlpee fct t  2rru pou1tlxomieildlsDelnvo t)arxrmfctytlmD  ies;t)setoxo ny1om n ivsasfaDrau o;t1oet ioeilslm elnmp;() reoxfcoadopDr nes;t) etrimpnydlltnmncs ()aDrax  ;o0tle mfcildlm elnmpnt4texnio3oadomD aivo (  eurir nu4ale  neslsfsDuaxmpnu1ape  oetas m2rl(vo;(0 ltnxfcootoa e n o (0s2xrio oodape mnei t)sDurxroou0tpxo i3iytfmDua( sn(4 eenmr io1om  livi t tetoio3nodlm   ivia(fsDtr(ro;t4opt moeilt m emnmp;u4arxoxr oydlm eai i t) 2tr(o iudol n icta(  rtr(moou1apx mfetltlaDuan p;u0artomo tatomDeluei ()sruoio oo1lmtemivta(fsrumxmpnu4tlto oetlt a emumo u0aetnxr tytlmD  iesl(0t2urxm3no4alee netls  ruau oot0olxo f3tat mDemuvs;u0tetnxo3iytfmDelivs;s) exm(o3no1omtelicslt artr(mp;t4aetoiietld a2rl( o () lxrif3tydlm eanei ()srtmirpnu4am n ivt t) 2umxmoou4ape ifcias sDrmnmp (4aeerxf3tatopteanes t0 euoir nu1olt lfes (fa2urxm ;u1apeomi3tydls ean p;(0arxrir iy1lp rau sl() euo(m3oodomenmfeslt)a2rax  ou1tptomiciytfs2ea( o t0tetnmf3iadomDean ilt s2xrxo ny1apenmivtlt)aDtmx pou4ale io3iyd s2ra( s () reoir3tadlmtrlivo s) 2urir3oy1om  livsas sDtmump;u0optoio3iyt aDrlu p;(4 lxoxfctytopt lnvolt)trum(rpoo1omtn ici s aDtr(mpoo1oex  ietltfm2rm(ms;u4areomo3to1faD  ies t srxoio no1amee nciasfaDtrxm nt1aleo oeiyd a elnvp;u4trxnxr iatomDeln i s t2xrio3iydale  iesls sDrmur ;u1tptoioeils m2ra( sn(4teerxrcty1lm rlieo (0srtmirpoo1openmivt t  2rrum oo0tet mfetasfaDran s ()areoio oadomtrlu o ()seuoio iu4lp nmfes s) rua(  nu4oltoii3iatfsDuauvont0tlerirciotlpDeluei () rto(o oy4ll elictls  rtr(r ;t4aeto o3tad aDrm(vp u4alxnmo3io1omD aieil()s2xmxr nydapt  nvia()aDtrxrp;u0tet mi3iatla ua( s u4arermr3iodfpDe ies;() 2xmxmpnudlpte feta( aDrr(rpoo1alx mieilsfa uluvs (0 ltnir todfpDelueol(0texrir3oy1ol  lfvta(fsruru  oo1alen i3ils a2ea(vp;u)texrxf ty1opDr i ols) exm(mpny4lmt mivsat a2umu pnu0oeenmicilsfs2el(mo;u)aexnio ty1opt  i s;()t2xoirpio4alt  neias)arrrx pnu0olx mo3tltfa2emuvp u)aeeoxr3oydoaDelivi s)t2toxrpiu1ll nmfvtl(  Dtmu o;o4olt miciys s2uaumpnu4 rxoifciadoat  ivo;s0 exm(m oodll   netls  Dur(mpnt1tpe  ietadfs2emnvpnt4trxnifctodlpD li i;s)sexmimpio1ame mivt t  2uaumooo4tleoioeiydfa umums;t4aetomocta1oa e nvs t)s2xm(o iy1ap nmnvtas a2tmu  ou0tlt  oeiadlm2um( on() rxnio oo1fp rlnvol()s2toir3ou4ale mivi sf Dtmxmoot1opt ii3iatfsDemu s (4teenio oytomtr iei;t  rtoxrpnodameemfcsl( aDta(rpno4oleoioeiadlm2uluvp t)tleoio oy1lm eluvs;t t2urxm3iy1om emnci tf rraump;o1oee  f3tlsla rmuvp (0aexnmo ia1opte ues t srxmxo oudome lfesltfa2rrum nt0tltn f3tlt sDem( s;t) rxrxfcta1faDrlu o;s  rurir3no4llt  fcil(f 2tau  no4aleoifeiyt m2ul(monu0 ltoif iydopDe nvs;s) rtrim oy1optn iesl(fs2rm(m ou1oex  oeiasls2rl( s;u4alxnmo3iydopD an s ( srtr(r3io4apt mics t) ruau pot4oex if3iad aDulu s t4 rtrmo3tydfp elueo t texrim3iodam e feslt)sDtrxmoou1aeeniieiydls rl(mo;t0aeeoxo ta1faDrlues;( s2xr(r oy4lmtnmnvs (f 2ua(rpou0oltnif3ilslmDumnmo;(0alxnmf3ootlmDrauvi s)s2xo(m io1apt lictas) Drru poo4ape mocilsla2umumo u)alerirctadlpt livs;(0seumxr3nu1lmtelneta(fsrrrxmpot0opt ii3ild aDeau o;u0 exnio ta1omDrli s;( truoir3oydamenmfvsl( a2rm(r no1oexomf3ilsfm2rl( p u0tetomr3oytlate u o;s)trtmir3ny4lpt mfes ( a2tmxrpnt4tex  fcilslm el(vp t4 ltnifcoytoa e n s t)seum(o iy1aleelnvsl()aDtm(r ou1aeenmociat mDel( o;(4tlxoir3to1oa   u i (  etoxrpiydlme lies s)artaumo;o0oetoif3ildfsDea(vpnt4 rxoxrcoatomD auvs;s s2tmxo nu4al   nei s) Dtmu onu0olenii3iydlsDem(vp u4 eeoxf3io1lm   neo;()sexrxm ou4lpee ietlt)srumumpnt0texnmoetltfs2raump t0aexoxr3tytlpt lnvo s tetoxm iudop nmfvt s s2rr(rpno0oex ioeiysfmDrln o;t4tetrxocoydlm  livi;t0s2to(o3iudlp  mfcsat)srra( p;t1tptoiicias s emnvpnt)altnio oodlat an i t0seto(o oy1omt miesa(faruaumono4aleomfetadlmDrauvs;(4tlxomo iatfm ran slt) rxrxmpiy4op  mfes (faDrmumpot4opeoifetlt m umums (4tleoxocta1fmD au sls)srumir ny4lpee ietasf Dra(rpnu1altnmfciytlmDea(vs;(0arenmfcia1lpDr nei s0s2tr(m iy4llte nesat)aDrau p;o0tet  o3tls m ua( s ()tlenir3iydomDrlivol()t2trio oo4op n fesasf 2ra( p;t0texn fciys m rm(mont) leoxo3oydoaDrlnvslt0tetoxr ou4lltelnviltfsruaxrpoo1tleoio3tyslm2umnmo;u4 rerioctydfpt aues s0setm(m oudaltelfeiat  2tr(r nu1tetnif3ilt sDemnmo;t0alerxr3ootlm elues;t) 2urimpnydlptemfet t  Draumpnt0tpxomfeiltfs2emu on(4alxoif iatfaDeauvs (0sruoxr ou1altnlfvtlt  2raum no1aee moctasfaDraump;(0alxrxf3oadlaDr uvs;t s2xmim3iudlmee fvi t) rua( o;u4tptoio3ils mDulnmo;(0artrif3io1fmDeauvi;t0t2xmxopou4llte fcsl()a2raumo;t4oetn i3tasfs umumo;(0trxnif3oy1fpte u o (0trur(rpiy4lmtemnvia(farrrxrpnt0olt iictls mDrm( snt)tltoifcoa1la   i s t0t2uo(m ou1omtelicil(fsrur(root0apxn f3iadla ul( on(4tlxrxr3ia1lm   nes;(0trxmio no1op n fvt (f 2tr(m ;o1apx io3iyt s2ul(vo;() exnxocia1oate u s t)texoim3nu4lmt lfeiasf rrmxmp;t4ope mfciytfaDea( p;t4 rtrmo ia1omDeai olt t2urxm3ou4omtnmieta()aDur(mpnu1alxomi3ils sDemuvp;u4 lxnxf todfat lueol()srxmio3ny4om nlivi sf Draxmp;t1tpxnmi3iysfmDemums;u) lenxrciatomDr uvslt  rtr(rpiy4lm  mncsl( sDur(mo;t1olxnmf3iydlm2ea(mp u)aexnmf3iatlmtrau s;()seumim iu4op n fvtat sDra(mpno1aeenmi3ils a2el(mo u)arxrxf3oytfmte i s s  2toxm3no4olenmfeslt sDumxmoou0alenioeiasfm rmnmp u0 rxoxf3oodfpDe i ol()setmirpoo4ol  mfcsasfsrurxrp;u4tpxn fciaslaDul(vpn(4arxrmo oa1lpte nvolt0s2to(m oy1altn ncsasf 2rmxr ;t4tlt  ictls s uauvo t)artoxf to1la  aiei;() rum(o3io1openlnciat sDrr(mpoo1aetnif3tld m uln p;(0 rtnmo3oatomDelnesl(0srxr(opio4ap emncsl(farrrxm ;u1tlenioeils m2rmnms ()teeomf3oa1la eluvi s0 ruo(o iodoltemieta() 2um(moot1aleo o3tys mDea(ms;t4 exrmf3oy1fmDraieo;s)sruoim3iy4ape lfcta(fsrtrurpno1altomicils m2eluvsn(4teeoxr3ta1fpteln i;t  rtrxo nydlp n nes t  Drm( p;o1altnii3tadfm2emnmo u0alxrmf oo1op elnvo;t)seuoio3oo4optnmietatfaDtru pou1oexo ietltla2rmums ()alxrir oydlate uei;s) exr(m3oo1opteliesat aDurx pnt4teeo f3tydfa emump;()aetomf3totlmDeaieolt0sexoxmpiydal nmncias) rtau p;o1aetn i3iydls emuvs;u)artnxfcoadom rlneo t  exo(m3io1llen fesls)aDum(rono1alx  ociadfm2um(vo;() rerircio1lmD auei t setrirpoodolee nvilsf 2rr(  nu4aetn iciysfa2rmuvp;t) ltrxr3iydop e nvo s0 rxmxm io4ap  lncia(fs2uaumpnt0oexn iciasfa ul(vsnt) leoxfciodlpt li slt0 rurir3ou1ol e ietlt)sDra(rpno4tleo ociys m ua( p;u0trxoxf tydfaDrluvi ()sexrim3oydlltemfeias)sDra(mpoo4olxomfetytfa2eln on(0 exomrctadlpt luei s trxr(r ny4omenlnes (  Dtaxmono0alxnioeias sDemnvs u)artnmfciodomDeai s t  exr(mpiu1apt mfvil(fartrxm ;o4tex ioeiys a emump;u4aetnxfctadlm eaneil(  2urir oy1olenmnetlt) Drru pnt1oetoio3iltfsDrauvo () lxnxf tadfp r nesls) etm(opnodoptnlncils)aDuaxmpoo0aeeomf3tltfsDra( p;(0trerxf3iotom r i i;t s2urxo3iy1lmtnmivt tfarur(m oo0tee mociasla rmnms;(4tetoxo3oodfpDe i s;s t2xrio3oo4lmeelfvsls) 2raxroot4tetniiciadfs el(vsnu4arxoio oytfatrluei t trtr(rpoy1omte feil(  2ua(rpot0opx io3tyt mDul(vo;u)artomr3ta1om   neo;s seuo(o oy4ope licsas)arrax  ou4aee ii3iasfaDuau pnt0texnxf3totfp  aivs;t0srxoxo3oy4ap   ictatfaDtm( ooo0aeeo ociydlm2ean onu0 etnmf iy1oa ean s s t2uoxm3oy4ameemfvt (faDrmump;o1alxomieiatlm eauvont4aeenmf3iodfmt lnei t t2uo(r3iy1lmtnmictas a2ua(r ;o4alxomictasfsDrm( sn(0trenxr3iotlatelieilt0 rxoxo nudomeemnvias aDrm(r ;u4ope iociyt aDea(mo;u4altrmo iydfmD lu i (0 2toxmpiudlm elfeia(fsDumx  no0olen o3ildfm rl(vs;(4treomrciy1fa eau i (  exmimpoy4amtelivtlt)a2ta(m ;t1aee mi3taslm emnvsnt4aetrif iydoa   nvo;s0 rtoim3nydameemfeil()a2ur(  oo1ole ioeilsfa uaumpnu0 etnxr3ootop rln i;t0 rtmxm oo1ll nlncsas sDtmumo;o1alxnifeiys sDrmnmp;u0tlenmo3iadlp   nvi (0t2xrir oy1lpe  neslt sDraumo;t1open fetatlsDuau o u4aexrmo3iatfm  anes;s trxmimpno4al  lfvils arrax pot4olx ioetadfmDuaumo;(4 lxnmf tatfm eauvi ()s2xr(rpny1amen nvilsfaDtrump;t1olx if3tydlaDrm(vo t0 ltnir3ia1fmtr i o;t  eum(opou4omtemicsa()aDtaum nu0aet ii3tas a eanms u4 eermf3iotomt aueils0truoio oudamt  nvsl(faDrm( pnu0texomi3tat m em(mpnu4 rerircoadlptraivo s)trum(opoy4lpt mfvs t)sDrm(moou0alenioetltfm2umnmo;u)trenio3oatla rluvo t t2xrio oy4lmeelivslt)a2um(mpno1opxnmieiasfsDea( s (0aetoxo3tytfmD aneo s) 2xo(r3oodolt mnet sfs2tmuro;o1olxnif3iytla um( s (0 eenif3iadlateliei;s)trxr(o3oo1amee fetltfs2rmuro;o0aetoifetatfa2ea(mo u4 rermf3iy1op rlu o t)trxrxm3no1ameelnetasfsDurum no4aexo icild a2um( p (4tleoxf oa1fa eanes;s)sruoxopnydapt  feil() 2uax p;o0alt iietydfm2emnvsnt4texrxrciy1faD  ivi;t  rxm(m3oodop  lfes sfs2tr(r ;t0oexomi3iys a emuvsn(0trxrmr3tatlmD  nvils0 ruo(m3iudopt mfes ()arrmx  nt0tlt miciasfs uau o t4arerircoy1oa r neolt trum(m iodal  mneia( arurxrpou4aptniietysla rm(mp;(4aexnmfciatfmD auvi ()trxrio3ny4lmen ncs s) 2tmxro;o4oeenmo3iadlaDulnmp;(0 eeoio3iatfmDranvo;t) 2xm(o oodopt  ivi (fsDtaxrooo1oetoifetydfaDumums u4treoif ty1la  lnvs;t)s2tm(r oy4ll  mfcsl(fs2ua( ooo1tltoifctytfaDeanmp;() ltrio oadfa e uvo;t)setoirpoodamtelieslt)aDtm(monu1tlx ifeildfa eauvs;t)texnio3tytlp   neolt t2urxr3ou1aptn ivia(  Durxm nt0optn f3ildlm2rm( onu0 etoif3ootfp   u i ( setrir3nu4ll n fctlt  2rrxm ;t1tpe  o3iasls eluvsnu0aetrmfctatoptrluvi s) rtoxo iu1ll nlictlt) 2rmum ot4aet io3tatfs2rlu o;u4tetnio3io1lp  ln o;(0 rtmimpoydlleelfvs (fsrua(root4tpeo o3iyt m elnvpnu)artnxo tydoat lnes ( srxrxm no1lptnmfvt tfa2ur( pno1tptnioctydfa umump () renxo todfmDelivo s)s2xoxopno4lpe lfcsa()sDraumo;t1ole  iciydfa2ul(vsn() rtoir3iodfmD  iei;s0seuo(m oy1ale lfcsas s2tm(mp;u0apeo fciytls2umumo u0aexnmf3oatom   nei;t)texr(rpiydap nlfes tfsDtr(mo;t1optn ietlsfm emump () eenxr3iytfpDrauvo;(0 2tmirpoo4ameelnci ()s2taumooo4tpt  i3iatfm2rm(vo;()texnif3totfm ranei;t)srurimpou4ape mnesa()arrm(roou1tex moetadfs umu s;(0 etomocoydlat  u i t)teumio3ou4lp nlivs s  Dumxmoou4aet mi3ils m2ulumsnt)artnmf3oo1oa e uvo ( srum(r3iodop n fvi tfa2uaurp;u0aeen f3tatlm ranvo;t4trxriocoy1oaD anei s0t2toxm iydll nlfvs s) ruax  ;o0oleo ietls m ea( o;u0aetnxo3oa1fp   n sls0teum(mpou4apt  nvias)aDurxrpou0alenmiciadfsDulu o u4arenmr oa1lp  livsl(  2uoxrpiy4am  lnci tfa2rrurp;t4olenmi3tlslm rmnvp u) lxnxo3totfat luvolt0trxrim oo4olt lfvs (  rtrur oo1aptoioeildfm eln s t)areoif3iotlmt anvol(0srxrir3nu4ol e fctls)a2urumpno0tee iictls m2em(mo;t0texnxfciadoa elnvi t)srtmio3oy4al nlfeias)srtrxmpnu0tpt  oeiydla ua(vpnu) exnio3iodfpt  uvsls0teumio oydap n fct t)sDuru o;t4altoio3iltfa2emu snu)treoifciadopDr nvi (0trum(o3ou1optelnesas s2ra(mpnu0ole ifctadla uan ont4 leoxr3iatlm e n i t  euo(r3oo4lmt miciltfsDtrur oo1altniictytla eanmo;u)altnif3tytlptr u s t srxr(opiu4lmenmnvs t a2ua(rpot4tpxnmietatfa2rl( o ()tetoirctodfatr ivils0s2uoio3nydame lnctltfsDrrumooo0tex  icilt aDrau p (4 etoxrcto1fmD  uvi;() rumxo ny1lmtelnesasfaDrrumooo0texomf3iasfaDea(vo u4trxrio iadlm r u s t tetm(m3iydameelnetat arrrumo;u4texnmieilslmDul( pnu0 rxoiocootop ran s t)tetoir oo4al elnvs t) rumur ot1aptomi3ilt aDrmnvsnt) etoxo ty1om  an i;() eumimpiydlpt  fei tfsDtmx ont0apeo i3ilt a el(vp (0aeenmr3tydfaDrln ilt0 exo(r iydomtelfeslsfaDuaxmo;t0tpeo oetld s uluvo;t)alxrxr3ootfmteanei (0tetrxopiydlm n ivil( sDrm(  ;u0tpxnifctytlm umnmonu4aetnxr iytfpD li i;s)sruoxrpiudap nlieslsfs2rmur ot0olenif3tys a2em(monu)altoif oy1lateaneo ()teumiopiydam elieias  2uaur no4alt mo3tas s2elu o u4 ltrio tydoaDeau s s) rto(m3iydlme mnes t a2trx poo4altniociadfs2ranvpn() reoxf ty1late n i;t srtrxrpio1om emnvsasfs2rau p;t0ale  oeilsfmDuauvo;(4teermf3oo1op e i ol()srxm(m ny4llt livi sfsDra(mpnu1oet iociadlsDrmumo t4 lerxo3iatlmtr ivol() 2urxr oy1om nmieilsfsrrmu oot1alenio3iasfa ra(mpnu0 rerifcto1om  luvsl( tetm(o3iu4olenmietlt)aDuaumpoo0apxnmieiltlm ul(mp u0alxomfciotom  livs t) 2xr(r3nu4lpt mfvtatfsrtmxm ot1tlx if3tltla el( s (4 ltrxo3tytopDeanvo t trtrim3iy1omtn nvtlt)a2urumpot0oexn ietat m2emn pn()aetoxr iotlpD  i o s0trxoxm oydomt  ncslt)sDur(  ou0opxoio3iys s2rmuvp u)altnxrciadom e nei;t  etm(r3ou4aptnliciasf rumx p;t1opx  i3ilslaDrm(vsnt0altoxo3iodom r ueol(  2uoxm nydlpeelnvs s srtm(rpnu0apeo o3iydlm rau onu0tetomr3iydopt anvsls0seur(r iu1ll   ieiasfarrau  ;o0tpenmf3ildfsDran o;t0trtnxr iatoaDelu s;s0trxr(mpoo1amt lfcils srumumo;o1oet  fciadlaDrm(vo;u)arerif ia1laD luvilt  eumim iu1ol elneiat)s2taxm ot1ole iicilsfa2umu o u)tlxrmr totopD li o;( texo(o3oo1omt  ivia(f Dtmxro;u0ole mociys m2rl( snt0artoxr iodfmt an olt  2xrim no4altnlfcia( sDrrur ot0aet ioeiasla rmnms;(0arxomo3oa1oat ai olt trxr(m nydapenmfei ( s2taxm nt1olxomo3ildla2rmums t0 reoxr iodfaDrauvi;(  rurxr3iudam n nesltfaDtrxmono4apto oeilt mDelnms;(0aetnmr iodoa  an i (  rurxr nu4lm e ieias) 2tr(mo;u1olxomi3iat m ua(msn(0 lenmo oa1fmDr nvilt) euo(opoo4lleemnvsl(  Dtmxrpnu4optnmoeiasfsDuluvp t)artnxr3oatla e i sls0 rum(m oo4lm e fcsas  Drmuronu0opt mf3tldla2eanvs;()texomf oadlpDeai slt0 2ur(o3iu4am  mivi (  Durxmo;t0apenmf3iys sDra(msn() etrxoctytoate neol()truoim3ny4aptnlfvsas) 2rrx pou0opxnmieildfs eln pn() exnmfcta1omtr ues t)tetr(o iu4lpte ivtat aDurx oot4tpx mieiatfsDra(vpnt0trenxo3ootfp   i o t)teum(m no4ll e nvt t s2rm(  ;u0tltnmi3ildfaDrm( o;u)trtrmocto1optelu o;t0srto(o3oydlp  lfeiat s2rax pno0tpxoiietadla2ea( p t4altrxr3iytoateluvi;s) rxmir oudopenmicsl(f rtmuronu4oleo octyd m2rau s;(4artnxfcta1lpDrlueils)setm(mpio1amt lfeil(fs2umxrpot4oleoiocilt mDeanmo t0aeenif3iy1oa r ueils)tetoxo iy4lpte nctltfsrtaumooo4tlt  fciys a rmnmpn(4 ltrif3iytlmtr u il(  2um(r oodomenmfcsasfa2rau pou4alx mf3iysfs uan pnt0tlxnio3oatom  an o;s0 eum(m io1om  mfvt ( sDurumont1tetomfeiltlsDraumonu)tetnxf3oadoa e neolt s2xm(mpiudlltn nciat  rtr(r nt0aetomi3iad a2uanmpnt) lxnxf3ta1op e neo;t s2umio3oudaptelnvsl(fa2ur(r oo0oee if3iydfs2umumsnt4aeeomfcia1fmtrlieols) eumim3iu1optemictl(fa2ur(  ;t4altomi3iatfsDrmu s;(4 eermrcty1lm  ln o s t2xo(r nodolt  fcs ( arraur ;t4tpto i3ilsfs uln on()alxnio3oy1lpDrauvo;()tetrim nu1lm e ncil(f Dtrur nu4tleomiciadfs2ea(mpnt)tetoxr to1optraues;t0sruriopiodal nmfvsl( sDrrx pnt1oeto oetldfa ranmo;()trtoif iodfaDe ivi;( seto(opou4alt  ies t arrmu  oo1ope iieiasfm2ul( p;t)texnxf3iydfaD liesls texrxm oy1ll  lfesat a2taxroot0opxn fciydls2rlnvp;t0trxnxocoadlmDeaueils)t2uoxo oodaptelfvta()srrmxmpnt1tex mociad mDra(mo ()texnxocoo1om e ueol(  rxr(o io4lp nlfetlsf 2ta( oou0optoif3iytfsDuan p t)aexnir3iadomteauei t0t2xrimpoodlmeelnet sf 2uaxmp;u1tlenio3iaslsDulnvsnu4tlxnxo3oa1fa e uvol()s2xoim3nu1ole mfeils a2tmx pou4aeen fetadlaDemu o;t0tlenifciy1lmte iei;t0 2uo(m nydam n fesas)arumumpno4olxoifeiysfm2umums u0teeoxf iotla rln o;( trxo(r3iodapt  nesatfarra(mp;o4oeeo fciytlm2ul( p ()tleoirciydlpDrlnvi (0s2xoiopou4lptn fcilt  rua(ro;t0tlxoiietyd s el(vp;t4tlxoxocoy1oaDraieslt)srtoim oydame mivt s srumu o;t1apxn oeiatlm ea(vo;()tlxrxocta1oateauei;()t2ur(rpoy4alen fci t sDum(m ot0alx  ictlt sDran s t) ltoio tadla rauvolt0trxrimpoy4am eliet t srur(  nu1teeo i3tyd a elnmo;t0altnxf todoa eau i;( trxmxopny1amt  nvtltfsruax oou1aptoioeils sDulnvs u0altrxf3io1opte uvo (  etm(o ny4lm nmfesltfsrtau oot0teeniictytfm2rmnms;()aexrir iytfm eauvo s0 rxoim io4llt livil( sDumxronu1texnmi3iaslm elnvo (4trenmf oa1fp   i ol( truo(r3ny4ameemfvi sf Drm(r ;u0tlxnio3tyt m emn s;t)areoir3to1oate uvi;(0sruriopny1ll elnvtlsfs2uaxr ;u4tpeo o3tyslsDumu p t4alxnif oo1lp rlivols)s2trxrpoydlp n ivt t  Dumxm ou0aetniociat m2rm(vp;t4 lxnxf iydfmteaivo;t  etoiopou4amtn nciatfaDtm( pot0teenifcias aDrmu s;t4aexoxr ia1optelues;s0 2tmim iu1olte nesltfs2rmump;u0aptnmictytfs rmnvp;t0 etrmrcoa1fat lu ol( srxo(r oydop  licta( s2ra( pnu4alx  ictydlm2emnmpn(0trtnifcio1fa  li sls0 2tm(rpio1op  mnei s s2tmxmp;o1teenmietyt m2ua( p u0alxnxociodoatranvols  rtoiopnodap nlfeils) rraum nt0tltnmictyt a2rmumo t0altrmo oytfp rlnvo;s0trurimpiy4ap  lfet sfs2um(root4tlxoif3iatls emn s u) rerxfcta1fpDeanvs t0setm(o3iy4ame  fesls)s2rr(ro;t0ole iociyd aDrmuvs;(4 lxnmocoo1optelivilt0 rtmirpoo4ol n nvia( aDrmumonu1opx  ieiat sDemnmpnt0tetrio3oodoatranesl(  etr(o oudameelnvtlt s2rm(mont1olxn o3ildls2ulu o (0arxrxr3to1fmDe neils srtr(o3io4lpenmnvias)aDumxrp;u4olen feiyd a2ra( o u4aetrxf3iadlmD  ivslt0t2trxm3ny1ll nmnvs t aDta(  nu1tex ioeiltlaDuaump;t4aetrmo3oadom  aies s)trxmir iodlle livtlt aDrr(rpno1tpxnmo3tatfa2uanmo;u)trtrxr tatop  an s;()t2tm(opiy4am  mfvi tfsDrmumpoo1aetoio3tad m2ua(monu0arxrmo3oo1faDr u ols0sexoim no1olt  ncsas artmxr ;u4oetnioeiltfsDrl( pnt0 lxnmociodom rlu ol(0trtr(mpnu4opt miciasfaDrax p;t4tpeniieiydfmDemnmo;t0trenmrcoodfat lnvs (0srxrim3ny1ol nmivtl()sDuax pnu4aet  i3iytls umn o (0teerxf ta1om e uvi;s0 euo(opiu4omeemfcsl()s2uru  nt0oee ioeilt m ulums u)tltomfctytlpDrlnvo;t)trxoxrpoodlmtn fei (fs2raxmpoo4alen o3iatfa2uluvsnu4 leomo iydlpte uei;s trxmim iy4ol emncslsf Dtr(r no4aex  o3iad aDumuvpnt)alermfcia1lpDrlieslt0 2tmimpoy4llenlnvi ()arumxront4apxnioctyt a2uluvon()altnxrctytop elies s texrir3oy1lle lfct sf Duaur ot1apenmocildfs2rluvp;()tlxrxocio1faD ln i t teum(m3ou4am e fvtatfsrtaxm oo1teeo ieiat mDuanvs u)trxnxr iydomD lu sl(0 rurxo3nu4lltn ivsl( a2trx  oo1tpxomocildfmDrlu snt0aetomf3oatlp   n olt)s2ur(r3nu4amtemiesl(f rtaumoou4oexn ieilsfs uanmpnu) lxoio3iatfmD luvol(  2um(r3nu1omenmies sfarur(rp;t0tet io3tldfm2rlums ()trxnxo3iadlmtrlnvs ()setoiopio4ap emieslt) Duaumono4ole  fetys a rmumo;u4aeeomr oydfmDr uvilt) 2xrirpny4omtemfeia(f Drmxm nu0oee iieiad s2ranmp;u0tltrif oytlpD  ueils0t2xoxo3nu4omenlnvt t aDraxro;t1aeeoifciadfsDemnvs u4trtrxfcoydlp   uvo;()trurxm3iu1lp nmnciltfartrx  no1oexniictysfm ul(vp;u4 rxrxr iodfmt  i s;() etmim3iy4omt  fes sfa2umx p;o1aexoifeiyd a2el(ms (0teenxocoatlptelnvsl()seurxr no4al n nctas)aDra(rp;t0altomf3tys s rlums;t) rtnxrciatfmt auvslt setoxm3io4lpe  fctlt arurump;u1opeomfctysls2rlu p;()tetnmrciatoaDrluei t)seuo(r3oydape  nvt s)aDtmxm nt0oltnio3ild a2rauvs t)arenmf oy1faDeln i t0seurxm3nudapen fvi t sDtmur ;o0teeomo3iys mDulu sn(0altrmf3to1lmt lneils) eur(o iu4om  lnctat  2rru pno1apenioeiysls2uaumo t0artnifcta1fateaivs t)srxr(opno4ap nlfvt s a2uau  oo1altoii3iat m2rlump;(4trxnirciytfpteanvi;s0s2tr(m oodlptemfcsat srua(rp;o1apenif3tyt s2ea(vs;u4 rtoxrcto1laDeai o;() exoir3oo4lptemfctltfs2ra( o;t4oeeo f3tat a2rmump;u)trtrxfcoa1fm r ieo;t0s2uo(m ny4openmicsa() rrr(  ot0olxnifeiyslaDuan p t4aetnir oa1fpDranei (0t2tmxo3iu4lpenlfetltfsrtr(mpnt1aetoif3tas mDumn s;(0aeenxf3oodop r nvsl(0srtriopoudam nmncs s srta( o;u1oetomiciltlaDemu pn(4tleomfctotfp  luvsls)tetrimpou4lp e ies sf 2truroou4tle  fciatlaDrln o (0altnmo tatoaDelu o () etoirpnu1ol elneslsf 2ra(root0aexnmociltls ua(monu0artnxf tadom  liei t srurxo3iu1opeemncilsf 2rrxro;o1tleo fetadlaDra(vp;()tltomociotomDeln s (0t2triopnudopt  fesa(f Duaur ou4aee ifcilt a ra(vp;t)alerxocoa1oa rai ols)seuo(mpnydap  miciasfs2taxmpoo1ape iociysfmDum( pn()tleoifciatoa  aueils0teto(o3oydoltn fvils) 2rmu  ;t0aptn octltlm ea( ont) etrmoctatfa rluvi;s0 exmiopoodale  icsat)s2trx  ot4tlxomo3tyt mDrm(ms;u4 etrif3iatfp e u o t  rxoxopiodame lfesl()aDuaxmono4texo fctadfs2elumo t) lxoxoctadop eaivi;s) exr(m oo4ap nmfvtls sDtmxrpoo0optn i3iydlaDulnmp t)aexrmrciadlpDeaieil( texoio iydal eliet ()a2um(  oo4aeeo oeiatfsDuanvs;u4teeoxf3oa1omDelueo t  exmir nudome mnes ( a2uax  nt4olxo i3iltls em( p ()areoir3iytlate uei;s  rtm(mpiodom  mnctlt)a2urur ;t4oexnif3ild m ranvonu0trenir3iadlpt  n o ()s2xm(mpno4al  lnes tfa2tmxro;o1tex  octldlmDumu s u4tetoxocty1lat lu s;()setr(o iy4llen ncsat)aDua(m ot1apt mo3ias aDulu s u4aetrmr ia1op raivi s trxmxopnodameelivt s a2rm(rpoo4apx  i3tysfsDrln s;(0aexoxr todfptr nei (0seto(mpoydll n nvia()arrr(r ;t4olto icild sDrm(vpnt0 rxomocta1fpDe ivo t)teurxopio1apt lnei tf 2rr(rpoo1open oetlsfa2rlu s u0 eenxo oydlmDe iei;()s2uoxo3nu1olte ietlt a2umump;t1opx mo3tas s2emnms u)aetoif oatom eai o;() 2uo(m oo1apenmfcsasfsrtrum ou0aex  f3iyt aDeanmpnu4arxnxf oodlm  aivolt)setriopnu1al e ictat)arrmu pno0tlenmf3iysla ua(mo (0trtnxrctadopD  i i;t srxmimpiy1am n ietl(fsDra( poo0olxn iciat a2ranmonu0treomo3iy1fp rln s;t) rxoir3io4aptn fvi sfsrrmur ;u0ape moctyt m emn o;t4 exnioctadlptrlu i s0 rtoirpnu4alenlicsat)sDtmur oo4olt mfctytla2emnmo (4treoiociadop   nesl(0 rxo(m iu1olen nei sfa2rr(mooo4olen feildlsDrau sn(0treomf3oo1fmtraiei;( srtrxr3ou1olen fci s)aDrm(mont1ape  f3tldfa2emnmsn(4 rxnioctytoaDeaieol(0s2xr(rpiudalee ivtlsfartaurpoo4optoif3tltfs2elump;t) leoxo3io1om e neo;(  euo(rpou4am e fesat a2tm(  oo1oeto i3tlsfm ua(vsnt4trxoxrcoytlaDe n ilt)t2xo(r3ny4am  lnctas s2rm(m ot1opxn ictasfs ranvsnt0tlxrxoctadoa r n s t0s2xmio io4lmtnlicil( sDraur ou4olenifctyt a um(msnt4tltnmo3totfmD  uvo (0texm(r iy4lpenmnesltfaDurum ot1tpe ioctltfaDran s;u0aexrmfctotomD lnvi;(0t2uoxo3oodoptemfvt (f rumx  oo0apeoiociytlaDel( p;u4trtriocio1fmDr u s;( tetmxm3iudolee ivsl(  rtm(mpnu0aexo i3tydfmDrlumo t4 rtomr todfp  aneo () rtmir3iu4lmt lnes t aDtrxmp;t1opxn iciadfa2em( s u0 exnxo ootopDeaiei t) rxoxr oodllt mivsat)artr( pnt4apx mieiyslsDeaumont0 lerxrcto1fat aivi t  etoimpnu4ale mfvta( artru  ;t1altnmoctys a2ea( ont0aetnircoytfm e i sls0 etoxr3oy1altn ictls a2uau oot1aleoii3tydfa2umnvs (4alxrif oadfm ran slt0 exoxm3oo4omt lfvsas)aDra(r no0tptniiciyslm rauvp;t)arxnxr3iytlpD anvs;t)s2ur(m ny1llt mict ()srtrumoot0oetnmiciatlsDuan s u4trtnio ia1fpteai o;t0 eum(m iy1ol elics (faDra(mono1tlxomieilslm2rlump;()trxrifctydfatr nvils)teumxo3io4omtnlnci sf 2rau pnt1texomf3tldla2um(ms (0 lxnir3oatopD li s;s0t2uoxm iu4amen ies ()a2ua(m ;t0olxo oeilsfa elnvp;()artomf3ty1oatr uei t)texmim3oo1omtnmnvsasfsDur(mp;t1tlx  ictyt s elnmont) exrxocoatomDr ies s0seurxmpnu1ame mfcs t  Dtm(mont0oee ii3ilt sDeanvp;u0 rxomf3iatfp r n i ()teuoxo nu1lpte fct s)s2rrxro;u4aeeo oeiysfs2eln p;t0 exomo iatlpt  u s (0s2uoimpno1aptnmiei (f rrrump;o0ope ioctatls2eanvs u4 ltrmfcoatlmtrlivi t s2urir iu1lptnmivtat artrumpno4apxomfeiltls2eanvs;u4tltoirctadlmD  ieo;t)tetrxr3io4alt livslt)s2rru oou1tlx mo3iysfs ul(msnu4trenxf oydoaDraivi;( t2uo(o nu1am nmiet ()srrru  ou0opxn ocilslm um( p;u0arenxfciydlm ranvo () eurxmpoy1amt  nvsl() 2rr(mpou4olx mi3iltls2umnvs;t0tltoio io1opt  nvi;t)s2xm(r3oodom nlfcils arrrum ;u1ope  ociydfaDra( s (4alerxf iotoa  ai i;t0setrim3no4amtelncta()aDtrxr ;o0aet micils aDraump (4arxrmf3ia1omtelivs () exoir3iydop elictlt aruaxr nu4tpxomfciad a elnmsnt4teermr tytfmD aivs s0t2toxopiu1amt lfesas s2uau p;t0alxn fetls s2uauvs t0 eerxocio1opDeanvsl(  exmio3nodam nmnvils)srrmx o;o0tltn f3tydlm2emump;u4tlxrmr3tytfpDraieo t) rtoio3oodom eliet s artmxm no1tpto octadfmDum( o u)altrio ta1oaDr u il()trtrxm3no1ol nlncsas sDrrxmo;o4alt moeiatfa2umnms t4 rtrmr iotopD  ueo;()seuoim3nudolenlnvs (  rurx pno4aleo feiytls2rln o ()texomo tydomteln i (  rxmirpio4lltemfciat  Dumxrp;u4opxnio3ild aDumumpnu4 lxrxf3tadfa eau olt0srxriopnu4op nlfei s) 2rmxrooo1tlxomocilt mDemnvsnt)areoio3iydfmDraiei s0t2um(m oydape  fvsas) 2tmum nu0tpen ictldfaDra(vonu4texrmf to
\ No newline at end of file
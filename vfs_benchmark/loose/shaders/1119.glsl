@@ -0,0 +1 @@
+uvols0 rtoirpoydopeemfvsl(f 2ta(  ot4alt moetas mDua(mp;(0 rxrif3oadoptelivsls)seuoir3ou1om emnes t)aDrax o;u4opx mfcildlsDumu o;u0trermo3tatlpDeaneils truo(o nu4om nmncsas artax pnu4apxoifeiad a umnms u4 lxnmo3iy1fmteanvs;s0trxrir iu1lpe livs t) rtm( o;t0teto i3tlt m emnms u0 renircia1lm e u s;s  2toxr3io1lm emncta(  2ua(rp;o1aet  fctld m elumo t4teenmf oo1lmtranvs;(0seurxm3oudapt  neilt)sDra(r ot4aptnmieildfs ulnvo u4 etoircoodoatrlu o t)t2ur(o3iu1lpte icsasf rtm(mpou4optnio3iydls2elump;t)alxrir iydlm  anvi ()s2um(m nu4oltnlfvs ( sDua(mp;t0opeomi3iatlm umnvp;t4 lxoiocty1lp  anvi;t0 rtmxopio1lle  ict ( a2um(m nt0ope mf3iydfaDuanvo;t0 lxnmr oytfp r n ils s2ur(o3oodamtnlieils)srua(moot1aeen f3tasfaDul(ms;u)tltnmo tytfm r nei ( t2trirpiu4lpe lietl(fsrua(  no1tltnii3iydfsDranvs t0 etnircto1fatranvols  2tmxopnu4amtn icsltf Dtru poo0tptn ieiyt sDeluvsnt0tltomrctadlat lu i (  2xmxo oydome mies t  rrru p;o1opt  o3tas s2ua( sn(0tlxrmo tadlpDranes t) 2xo(m nudam elfct ()a2tr(rp;t4tex moeilt aDemnmsnu0 rerxf oadoaDr uvs ()trxrxopny1apenlict s  rrmu ooo1tlxn feiaslmDeanmp;(0 lenmo3ia1faD an s;s t2trxo3iu4lpee nvsl()aDtaumo;t1opeo o3ias mDrl( p;t0tltnxfciy1fmD lues;( sexrim3oy1om n fvils)arta(rpno4oexomo3ils a em( p;(4alerir3iodomtrluvols)srtoxo ny4ome mfvsasf rtmur ot4tltnifciadla ulu o u) exrir3oodlp rli ilt  rumio iudamt  ncslt a2tmum ;u1aptnio3tldlsDum( pnt4 eerxf3iy1omteau sls0 rur(rpnu1alt  ivt t) Draxrpnt1tpx  iciydla2uln pnu0texomrcio1om rlnei;s)trur(m ny4al nlneilt)sDtaxm ot0tpe if3tls a2raumo () lxomo3oatlm  lneo;(0 2umio3oo1op e nvsl() rua( pot0ale mfeiasfa2em(ms;u0 lenmrctydla  anvs;s0 2uoir3io4amenlfeiltfsrururp;u4alx  feiasfmDulnvpn(4 eenifcoo1omtrlu o s t2xmxo3ny1apt  iviatfsrurxrpnt0oexnioetls a2emnms;u4trtrmf3ty1omteaiesl(0 eto(m3oo1alt lietlt arrax  oo0tleoiicild mDrm( o t) rxomfcio1fpt luvil( s2xmxr nu4lmenmivt t a2tmx ono0alenmiciytfs uan s;() eermo totfaD  iesl( t2umiopoydlmtnlivslsf rurx  ;o0texnio3ildfsDeaums;(0 exomociatomt  i i (0truoxmpiy4ll  lfct ( a2ta(roou4aeen ieiysls ulnvp;(0arxoxf3ta1lm e i sls  exr(m ou1amee feilsf 2trxroou4opx io3ildfsDrmuvs;u0trerio3oodfpDr ivs ( s2uoimpnydalt miciltfsDtax  ;t4tltnmi3iadfsDuaumpnt4trxnxociydoa  au i t)tetmxm3oo1apen nvt t)aruauro;t0tpenioetysla2eaump;(4 rxnxfcoytlpt  uesls  etr(mpnydlltemncsl( aDururoot1altnmo3tldfaDrmuvo (0 rxnmr ootlp   uei;s)texrir3oy1lltelnvtat) rur(roou0apeo ietat s ea(mp ()tlxoio oy1lp  anvi t srumxr no4amt  nesa()aDtmum no0aee iictldlsDelu o;(0aetnxr tatoatr u ilt0t2uoirpoo4op  mnvtlt srum(m no0aet  fctltlsDranmp;t4 rtrirctytfa r ieols t2um(o nodlpte iesl(fa2umx  ;u4apeo oeiys s elu sn(4 ltoxrcootfmDrlueil(0 2uo(rpoy4ale  fvta()s2ta(r ou0opx  f3iltlm2emnvo t4altoif3tadlaDrlnvo t)trtoimpnodlltnlfes s)aDrax  nt1ope moetyd aDulnmsnu)tetrio to1fmt auesls0teumir iu4opeelfvtl( s2umxr no4tlen oeiydfmDel(mo (0teermo tadfpDeauvsl(0 eumxr io1olt  fes (f 2tax pou1oleomfciltlmDum(von(4arxrxo3iatfpteluvs;s srurir3oydllee fcsl()aDurx p;o0tex mocias s2rm(mpn()trtnxr3ootlaDr uvsl(0teumxr ny1omt  nvt t) rtau  ou0altnmiciytfa2uanvp;(0alxnmfcty1fmt an sl() exmim iy4al  lieia(f 2umumpou1alto iciasls ulnvp;u0trxrif3oo1faD luvs;t) 2urir no4lpt mfcia(fsrtru pou0olxo i3ilsla2elnvp t4tleoxrctadoptr ivs;t0 2tm(o oo4aptnmivta(fsDra(  nu1oleo icias aDrmn o u)artomr3tadfpDr i ilt s2uo(o oydal  lfctatfa2uax oou0opeo oeiltfaDrl(vpnu) rtoxr tytlmDrli i;s0sruoxrpou4ole lfetls) Duaxmpnu4oleniieilsfsDumuvp u0aexnmrcoydfmtraivil()texm(r iu1olen fcs sfarurxro;t4tle moctltla2ua(ms u4aeenmf3iy1omte neo (  euo(r3nu1opee ivsat)srtr(mont1tpt mfcildfaDrmnvp (4tlerir3iotopDrluvols) rtrxr3iu4apenmfcsat) Drmumpoo4teen i3tlsfs2uln onu4tltrxr3oytlpte i il( setoxm3nu1ap nlnetat  Drmxr nu1apt mietld aDeanmsnt4alxrxrcoo1fm rlueo;s) 2tmir3nu4altnmivi () rur(ronu0tlx iieildfsDuauvsn(4tetrif3ootlmDeln o;t seurio ny1opeelfvtas)arumxrp;t1tet miciaslmDel( o;(0texomf ia1lm   ivs;()trxmir3ny4om   nvt s)arumur oo1tpeo ieils a2rln o;u0tltrmoctytom r nvi ( srto(rpiydam n feilt) Duaum ;o1aleomicild sDeanmp;()arxoioctotom elu ols)s2uoio3nudamtemics tfaDua(r ;t1altnio3iaslaDem( p (4aeeomf iodlmDrli il(0t2trxr no4lpte icilt  Dtr(m no4aex  feiltlm uaumsn(4tetoirctytom rlivo s  exm(r oo4amee ieil()sDrmu  oo4aptnmfeiytfmDul(mont0aexnmr3iatlmtr n ol()trxoio iudlptelfvsls aDtaxmooo0olx  iciasfs emums;u4 leoxrcoodopDrluvo s)srtoim oudap emivta(fsrrrxm ;u4opxoio3iydlm2ua(ms () rxoif ty1opDe ueo t0tetmxo3ny4lp elncsls s2taum oo1opxn f3tysls umump;u0trenmr3to1lptrli ils)trtmxopnudap   ies t  2ur(  ;u4tltoiiciytlsDrlnvs u4 rermr3iydoaDranes s)seurxm3oydll nmivi (f 2tmxm ;u1tetomfciaslm2umums (4 leoio3iatfptelu o (  2urxr oudlleelnetlsfs2ra(root0alx ifcildlm um( o;u0 etrxf3oadoate i o s0 2um(o oo4am emfvil( sruaum nt1altomfeiadla2elnmp;u)areniociytlmt  u il(0 rumir nudlme  fvtas)srtaurpno0opxo ieiys s2rmnmon(0altoircoytlmDe n o t0sexrim iydolen nci t aDtru o;u4ape ifctat m em( s;() leoifcty1faDelnvo;( trxrim3iy1lltelfei s) 2rmu  oo0oex  i3ias m2emuvs;u)tetnxf iatlp   i i;(0seumimpnudale  ivsat) rta( pno1apenmi3tydla2eanmonu)aexomrctydomtrlies (0t2umxopoo1lmt  fctas aDtaum ;o4alxomo3tlslsDeluvp u) exrioctotfptraivo (  exrxmpiy4om nmnvil(fs2tr(mpoo4ale iieils a2emums (4arenxfcio1fpDrlieo t0trxr(m3iy1op  mnvt (  rur( pno0oetoif3tad sDrl(vo t4 ltoxfciy1oat li s ( t2xmxr3ny4lpen fviat  Dtaurpno4aee ifeiysls em(vo t4 reoio3to1om   uvo s0 2xmirpnydol elfvt t  rum(m nu0texnioeildfaDumuvs;t)alxrxrctodomDrlnvo s  etmirpoo4olt lneiltfsDta(rpno4ape  o3iytlm2rl(mo t0 ltoif todfateluvilt setrirpiu1llenmfei sf Drrum ;u4aet iieilsfs eanmo u)altnio3tatfpDrlies;( t2xrxrpiu4ap elfcslt  Draxr nt1oex mfetad a2ulnmsnu4 rerxo ta1omtelnvs;t)srumir iu4amenmfeslsfsrurxmp;t1teen f3tysla rm(vs;t)aetrmf3oadlatrlueo;t)s2xrxo3io4alenlies ()a2um(ro;t4aee  ietadlsDelnms;u4alxrxo3oy1fatelivo;(0sruo(m3no1oltnmfes (f 2trump;u1aetnmieildfa rmums u4areoif3iatlateanvi;t t2urirpio1apt mfcsa( srum( p;o0oeenmoctas a2el(mo u4texnifcoy1lmteai sl() rum(rpoo1ll nmncil(f rrmurooo1aeenmociasfmDeaumo t4artnxf3tatfp  lu o;s)teuoimpiodam  micsa(f rrmx poo0ale  ieiyslm2ranmont0texoif ta1fmt aueolt0s2uo(rpio4op elnviasfa2ua(rpnt0tpxomocils m ulnvont)aeeoif3totfpt  uvo ()t2xoirpoy1am emieslt aDrrxr ;u0tptnmo3ils aDuanvs t)aetrirctydlmt aivo (0s2xrimpiodope lieil(fa2ra( pno0texo ocils a2eau s;t) rxomf3tadlpD  u s s0trtr(r3nu4ope mieiat s2umur nt1oeen oetasfmDem(vs (0trxnir3todlpDeanesls)t2xo(mpiydamen ictlt  Dumu pno4aetn ieiasfs2ua(ms u) reoifcoatopDeanvs t) ruoxm3nudlmeelivtls)arumuro;u0tpeomoeiat aDrm( pnt4 leoio3todoa rlnes s0trxoxm3oodlpte ieilt  2rrxmooo4tlenioeiasfa ea(vs (0altnmo3iotlp   uvs t0s2xoxr3iu1op elnctas  rtrurp;u4olenmi3iyd mDul(mo;u4artnxf oa1fpDrlneils0s2tm(opiy1openmietl(fsruauront1tpeoii3iytfsDemums u4 exnio iodoatr uei t) 2trxr no4olenlfes sfa2tmu pot0optnio3iysla rauvo t0 lxrxo ia1lmt  i o;t texm(rpnodlp  lics (fa2trx  ;u4aleo o3tlsls uauvo;u4 etnmrcoy1oaD  n s;s0setoxr iudome mnetltfaDta(rono0apx iieiytfs2raums;u4tlxoxocoadopDrlies t srxrir3nydlm   ieia(  Dtru oou0openmi3iysfs rmnmpn(4 exrxfcoo1oa ran o;t)srtm(r3no1ope mfesl(f 2rrxrono0olxnmf3iasfaDrl( on()tltoxf tydfaDraieo t trxmir3oo4aptn fvt t)aDuau oou1apx  ietlslm ua(vp;(4aleomocoodlat au ilt)teto(opio1ape mfei s sDtrxmo;o4oleniocildla2emnmp;u4aexrmo tadfpt  ieslt) euoiopoydamtnmnetls aDra(rpno1tpe  ociytfs ulumo;u)arerif todlateai o s t2xoio3iudal e ics t)srum(mpoo1tlt iieiyslsDeanvsnu) rxrxf3tydop rauvo () exrxo ny1ome mietl( artr(rpoo1ape io3ildfsDeluvp t4 ltnxr ootfpDr nvo;() rurir iodamtemnvsasfs2tau  nu4tlx miciytlaDum(mpn(4 rtrio oodfate u s;t0t2toimpoy4ol e nciat)sDtaumoou1aee iieiad a2ea( o u)artomf3iotom e n i t  rxo(r iy4alenmietat aDtmu oou4aleo f3tas sDrlu o;u)texrir3oydopt an i s texrim3oy4lm e fcsl( srrm(m nu0apxoif3iltlmDemumsnu0 rerio3tydfaDraieo (  2xo(r iu1ol emnvt sfaruaur ;t0apx mf3iysfsDulnmsn(4arxrmfciotfmt  uvo s) rtoxm3nydolt livsl()a2rr( ono4oee if3ild aDrmnvo;u4 exrmociytlpt au o ()srumxm oy4olenlnvtl( a2umxr ;o1aptomo3ias m uluvo;t)aleoxocoodfaDrlu i;(0s2uoxopiudope lfei tfaruaum no1tltnmi3iatfm2umn s t0 eeoiociadfpteln slt0teum(opoo1aleelfci tfa2uaxm oo0tpx mf3ildlaDrl( o t0areoif3iytfaDelu olt0 rumir3iu1lm n fctltfsDrmurpot4oetn ietatls2ea(vs ()aetnmf oodlatranesl( trtrxo oydlm e fcsas s2ur(ront1olxomi3iat s rmuvs;u)trxnxf oytfmt  i i;()srtm(opiu4al nmnvsa(faDum( poo1aetnmf3iysfs eluvpn(4trerio3tytom eln o s)t2xo(m3io4llt  nvslt) ruaumpoo1oexn f3iatla2um(mpnu4trenmocoydopDe u s t0 rxm(r3nu4lmee nei () Duaxmpnu1alt iiciltla uauvsnu) eeoxo3ootlptrauesls trtm(o nu4omenlfvt s srrr(m ;o0tpxnmi3iadlm ua( o;u0 rerxf3iodoat auvi s0 2to(r ny1lp emivils  Dta( poo0optniiciltlm rmnmp u0 reomr3oadfat lu o s)trxmxopny4lp emivsls) Dta(  ot0olxn f3tad m2em( p;u0 leomoctotfmtrluei;s)sexm(rpnu4ome lnvs t  rtaxmp;u0oexnmfciydfa uauvs;(0aetnxo3iodom r n o;()t2urxopny4lpenlfvs (fa2um(  no1tlx  f3tld sDrmu snt0tlxrxocty1fatr uvsl(0tetmir ou4am elfetltf 2trumont0texnmo3iatfs2rl(vonu4altnmo3ootla eau i;() rurxrpio1lmt lnvils  Durxr nu1ape mf3iatla2ranvo t4 reomr3tadoaDr uvsl() 2tmimpoy1lltemiesls  rur(m ;u4apxnmieiydls rl(mo u0 eerxf iadlm elnvslt) eumxmpny4lmtelivslt sDtaxmpoo0tpeomi3tyslm elu s t) lenxfctotfpDrau o t)srtoxm ny1ll nmfei (f Dur(mo;o4tlxn i3ilsfm em(mpnt0 exomfciotomtr i o;t)texrim iodomt  fei s artrurpno4aee ioeiytfa2rln o u)tetrir3ootfmt aueo;()srtoio3iy1ap elnvs tf Duax ont4aetnmieiatfa2rmu s;t)teermocta1omtr n ilt trtm(r3io4lp  mfct (  Dumuronu4olxniicild s uanvs;u4trerxf oadfmD  ies;(0srtoio iodale  ictas)artmxmpno4oeeo i3iatfm ulnvp;u)tleoxr3oa1omDeauvi;() rtrxr nu4om emfcta(  Drmu ono1tpe ifctls m2ean o u4arenif oa1lmD lnvi s  2xr(mpoo4optnmfcsat  2uaxm oo4alx ioctldls2rm( on(4trxoio iatom r nvi;()texrxopno4op nmnci t sDrmx oot0oleoio3tatlaDul( sn()trtoif3tatlmte i s;t)trxo(r3ny4lptemnvi (f Dtaurpot0tpe iociydls raumpnt)altnmociadom rau sl() etr(rpnudam   ictl()a2uaxro;o1aexomictls s2emnvs;u4aetrioctodoptr uvs s0tetrirpnu4openmfes () rtax p;o0tet ioctldfmDranmp u4 reomrcto1opDeln il()srxmirpiodolenmiesls) Durxm nu1aetnmieilsfs2emnmo;(0artrxo iydlmtr ies;( setmxo3iu4lmen icsa(fsruru pno0tpeomictad m2um( p;(4 ltomrcio1fa rai i (0 2tmxo ou1ll nlneia()srtax p;u1apx  icild mDumn o u0 lermrciytoatrlieo t  exmxo iydam   ivt (fsrrm(mpnt4texomfeildfm2rmn pnt4aexomr3oydopDrluvo;s0teumxo3oo1ap e fvs (f Duaur oo4olt  f3iys sDuluvo u)tetoio3iadfm eaiei s  exrxrpoodlp emictl(  2uaum no0tet mfeiysls2emuvs t0 rerxrcty1omtrlnvsls)s2toxr iodom   nvtatfs2rmxr ot4tlxnmiciltfsDranvo;t) eenircoy1opD li il()trxrirpnu1llt livsa(farrru pnt4tlx  iciys m rl(ms t0alenxocoodlat an slt  2to(mpiydolte fetl( artax pnt1tex  ietltls ulu o;t) ltnif3oy1latr i s s)tetm(r ny4oltemncsltf rrm(m ou0alx io3iydlmDea(mont)alerio oa1om   ivols seuoxr3oodamt lictatfaDuax  oo4oet ifetld m rluvs (0tltomfctodlmDraneo;s0seum(mpiu1ap emncsltfa2rm(m ;o1tpxomoetatlm2eau snu0trerxo3to1opt  uvi ()setr(r3no1lpt  ieil(fa2ra(m nt1tex ii3tas sDua( o t4 rerio oa1op   ivilt) 2uoir oo1am e fvsat)sDta(rpot1tpenii3tyt sDrl(mo;t0trxoir iydfmD aieils  2urir iodam emiet (  2rrxrp;t0tpeoifcias m ean o t) eeniocoadom e nei;( s2uo(mpoodal nlics tf Drr( ono0opt mf3iydlmDel(ms u4alenmr tadlm  luvols s2tmim no4opt lfvt sfsDtaxro;o0tlxomfciys s2rm( pnu0 eenxfctodlmD li o t  etrxm3iu1am e fvi s)a2rax  nu0tlxn i3iltls ra(vp;(4trxomo3to1latrlnei () rurio oy1lmeemnci ( arumxmo;o0aptomoeiasfs umnvp;(0 etnxf oodopt  n s () etm(mpiy1aptn feiatfa2um( pnt4tlx mf3iasfm ul(vpnu) rerxo3todfp raivilt)s2um(mpiodapeelieilt)arurur nu4tltn i3iatfa emnmp;u4 lxoiocto1op rlnvs s0 eur(m3iodlleemncsat)s2rmumo;t4apenmoeilslm2rlums t) lenmrcoodopDeli i;( texmio no1lmte fcsas  2ur(rpno0oexnmocilsfm2ra( o;(0 rtnioctydomDeaiei;s t2umiopio1omt lnvi t aDtau p;o4oleoiocilt a2raump u4artnir3ty1lmDe iei;s  rtr(mpny4ol n netl()aDrrumpno0tee ii3ildla uan o;u4 rtoxf3ta1lpDranes s s2uo(o iu4al  mncilt) Dumx  oo1alt moeias mDum(vp u) ltnxrcty1fpteau slt0trxmir oy1omtnlfet tf ruaum ;o1oeenioeils m2ulump;u4 lxrxf3oa1lmteln sls tetoir no1ol nlictat)sDurxr ;u0olt ioctld a rmu pn(0trxoirctodfpDrau sls  eur(opiu4lm nlfci s) rumx pno4aeto i3tadlm2rauvpn()trenxo3oadfptrlu ils0 rtr(r no4omeemnet (fsDtrumoot0oex mfciysfs2ea( s ()altrxfcoydfmtelnvo t)sexoxopiydoltnlnvtas sDrax oou1tpenmieiytfm2rmnmp u)aetoircia1fa raiei s0sexm(r3iodom n neia(  rtrurpou0opxnifciat s2rm(vs () lxomfcoytlpDr neol( seto(r3oo1al elictl()s2urxronu4olxo f3tas s rmu onu)alxomfctotfmt  ueol( s2xoxopnodal  lnvtas aDrmxmo;t1aeen f3tatfs2ulumsnu) lerxfcio1la rlnvi;s)seum(m3nu1lltemfctl() Dum(mp;o1oltoio3iyt sDranvon(4texnmrciodomD  ivils) rxmio3oo1aleemnvia() 2um(mo;u1tpx io3tlt mDrmn pn(4trermfcoo1lmteluei ( teuo(o3ny1llte nvi s)srumxmooo4apeo f3iat a rau o;t) exomrcoa1lmt lies;s)s2uo(m3nu4ap nmncsa()aDtm(  nt4olt mi3ils a2ua( pnt)trtrmr3iodlpD aivo t0t2umxo io4ol  livtlt) 2trx ont0tptomfeiytfm2uanmo u)alenmr iy1lpD an slt0srtmxo oo4am  mfcsl( aDraurpno1aet mf3iys sDuan on(4 etnmo3todoaD ln s ()seum(o no4olen ivi t) rumuroot1aleo f3tldfsDulumo ()artomr3iatlmt lies;t0 eumxo nydaleelfvsa( a2rr(m ;o0alx iietadlsDul(vs;()tetnxf3iydfpt auei t)trur(mpiudlp e fcsa() rtmxro;o0oet iiciydlm2ea(vp;t)tlxoirctodfm elies t srxm(m3iudalt  icilt)sDrmur ;u1aexo f3iltfm elu p (4 rtoif3tadlpD  i olt sexrio oudope  ici t a2rau p;o0tpt iieiltfmDra(vpn()alenmfciy1omtraivi (0 eto(opny1al nmfcs tfaDraum ;o4oee  f3ildls2eau p;(4tlxnifctadop ean i;s texoir io1am n icsat  rtm(r ;u0openiietytlaDeln s;(4tetoxfcoytlm eaieolt0s2tmxo3nudlleelietat a2taxr oo1tpeoio3iyd a2em(vp;()tleoir iatomtrluvi;( texmio3oo1lle lnvtlt  2raxmo;o4oexoiiciytfm2em(ms ()alxrio3iotomtr n s;t truoimpoodll emfciltfarumx  ;t1tex if3tad mDrlu p;u4 rtnmr3todlateaiesls trxoxm io1altn icsasfa2ua(rpot4tpx ifeiltlaDul(ms;t4 rxnxrcio1fm  ai s t)setoxo iy1alt mnet (farrrum ou0teenmf3tldfm2eln o (0tltnmo3todoa eaneol(0s2trio oodam n fvs tf 2rrxrooo0oee  icilsfsDra(vp t)teerio tydlate i s t) rtrim3ou4lpeelietas) 2tmum ot0aptoifciyt sDrmumo ()trxoxfctytlateanvs;s0sexrir3ny1al elnesls)aDumum ou4olx  f3tasfaDraumo u0tlxomr3iydoa rlneo;t0truoim3io1amenlfvtls  2umurpot1aex miciaslsDranvpnt)arenxocia1faD li i;t0 rxoxo iu4llte fvt tfaDtm(ro;o4tleoif3iydfs2eln s;u)aetnmo3iotopte i olt0 euoiopoydamenmnvi t aDta( oou0texomi3iytlaDum( p (4tleomf3tydop r ivilt sexoirpiu1omt mnvta(fa2rmump;u1tle if3tyd s2eln p t0aetrif ia1lmD li ils) rtrio3nodal nlncias) Dur(  ;o0apxn ociasfa2um(vpnu4 rerif3iydfa r ieo s  etmxmpou4altemnvslt srraur nu4alxn feiyslmDeauvsnt4texniocootfm rlivi;() rurxrpou4lp n nes t) 2uaxrpnu4apxoioeiytlmDrmnmsnu4tlermfciytfp r n ols srurir3oy4lm nmfctlt)aDumxmo;u1tleoifctasfm2um(mo;()trerxrcoodopDeaieils0seuoxopio1ll eliciatfsrrm( pno0alxomfeiasfmDua( pnt)trermf3tydla rlivslt0 rtmio nydop e net () Dra(mo;o1ope iieiadlm rl( s t0aetomr iadlmt luvo t texrxm oo4om nmfeils  2ua( o;o4apxo iciysfm2rmuvo;() etnxf3oydlpDe uei;(0 2trio3nu1om n neia()aDtaxrpou4aleomfciatfaDrlump u4 lenir tatfpteai s;()teuoio3oo4omt  nei sfartm(rp;t1optomfciltfsDrlnvonu)tltnir3oadfp e nvo;t)t2xoxo iy1opeelfeia( a2rmurp;t0tlt  feiytfm uau o;u4aeermr iotfa raies ()truoim3iu1optnmnvsat)a2ra(mpno0tpenmo3iys a2uanvsnu)aexnxfciydomDrlivo;t s2tr(o3oy1ol emivias) Drmxrpnt4oetnio3ias m umumo t) reoxo3oo1op  aueo ( t2urxopnodamee fesl(faDur(  nt1oeeoiociadlsDrmuvo;u4aetrmf oo1fpDrlueo t  rxmim iodopen nvtatfsDurumpot4opeo fctydfmDulnvs t0 exoif3oodlmtrlies;s seuoxr3nydal n ivta()aDtmxmpno0aptnmoeiysfmDrmuvont4tlxnxr3todomDe n s;t  2tr(o no1ame mfeil(  2ra( p;o4open oeildlm2ea(vont4aetoio3oadopt aivs (0 2tmxr nydom e ivil(f rtmx ont1tpeo ieiad aDumnvs () exnmr3oo1laDeauvs s srxrimpoodlmee fvtasf Dua(moot0tetn icias aDuau p;t0tlermo tatfaD  uvsl(0t2xo(mpiydape mfet t)s2rr( onu4tptomictatla2umumpn(0tltnmo3to1opDrauesl()s2trxm oo1aptnmnciatfarum(mono1tlxo f3iysfm ua(vp ()tetnif oytoat  nei;() exmxrpoydap  mncsasf 2umurooo1opeomi3ildfs ean p u)altoxrcia1opDr u s;t  rtm(r3io4am elnctlsfs2trxr nu0aeenmo3iydfa eluvpn() exnmo3iy1oat aivi t)trxrimpnu1ole lfcsat  Durx  ou0ope mocilt m umuvs;t) etoxo oy1laD livi;s0 exmim no4ll n fesls) Durxmpou0opx  fciasfm2rmu s t)artoxr todlmteauei ()s2umim3iudol elnvilt aDrmurp;o1tpx io3iysfa2um(vonu)arerxo oa1faD  ieilt0s2xrxr iodolteliesls) Dtrx  ;o0tpxoifeiys s emnvp t4altoircoo1fa r n i;( srtmir iu4ll eliesasfsDumxrp;u4opto o3iasls uluvo u0tetnmfciodlm  aivi;(0trumxopoy4lp emnviatfa2tm(r nu0oltnmf3iydlm rlnvpnt0 etrxo3io1oateau ol()srtoio ny4omeemnci t)sDtm(mooo1alen f3tat a2ra(mpnu0 eeoio3iy1lm   uvilt)t2xr(r oydlpt  fesl(  rrmxrp;o1optomo3iyslm2ra( ont)aleoiocoydlpD  n olt teuo(o ou4ap nlfvsa(faDtaxronu4tltomietadla rauvo;t4alxnif3tytlm r nei;t0t2to(o3oodape  fesas a2trxr nt1olxn octaslaDrl( snu4alenxr3ia1lm ran s t0s2toirpou4aptnmfvs sfsrtr( ono1aleo i3iadla2ulump t0altrmocia1fmt  ivsl() eto(m iudom e fct ( srrru p;o1tex moeiatlsDeau snt0 rxrio todfpt  ieo (0trto(o iodlmte ivsat sDrru  ou0aetn feiysfs2ulumsnu0trenir3oatfmDeau il()srumirpou4aleemivsa(f Dumum ;t1teen ociydfaDemuvp;u4tetrmo3iotfa eai i;t trtmxo3no4op   fvi s srurxmoou4olt if3iat aDelnvon(4trenif to1la e u slt0 euoxr oo1ll emictls  2ua(r no4oltniictltfsDuln pnt0 rerxf totfatraneil(0 2tmxm nudlmte feta( artmxrpot0aex  feiasfs2umuvo;(0 rtnio3iy1late uesl(0seur(o nodoltnlnesas  rtaump;t0tle  ietytlsDumnms;t4 leoxr3oytomDrlnes ()s2uoxmpno1al nmfcsat a2ua(rooo4aee io3tldfm elnms;(0altoxo3oytlaDr ivsl( trtoiopnu4apen iciatfarumxmpno4oleoiieiadlsDum(ms;(4aexniocty1oatr ueo t0s2toxm3oydlme  feias  Dtru  no1apt  f3iatlmDuluvo;() lxnifciatomDr nvi;t0 rtmxo io1omtemncs (fsrtrurooo0tltoio3iytfa rmnms;t0 ltoircio1oat lu olt0s2umir3nydal  mivs (farrm(mo;u1tlxnmfctltlsDeaump;u4aexrio3ty1fate iei;t) exr(opiy1lmenlics ( aDrm(mpnt1tpeo feiltfaDua(vs t0aeermf3iy1oateliei;( t2toim3oodamt  netlt)artru pnt4tlxniociat sDuan s;(4 leomo3oo1fa r iei;t)teurirpio4omtemfvs ( sDum(root0opxoii3tlsfmDeau pnu)aexoxo iydoa eauvo;s  2xm(mpnydlp nmics (  2rm(mpnu4aetn i3tyd aDulnmont4 rtnircoo1laDrlueo;s)seurxo nydlleelivtl(  2rmumpou4optomictlsla raumon(0 lermr3io1fmtrlu i t sexmir3nudlpte ies t)sDuaxmoou4olto o3tadla ea(vp;u4 renmo3oydoaDean s t tetr(r3iodlmt mivilsfs2rau  ou0oeeoiicilsls rl(vp;(4trtomr3tydfp rluvi ( sexoir3oydal  lneta() 2taurp;o1tlxoiictltlm em( p t0 lxniocta1oat auei;s sexrxopnu1amee nesltfa2rr(mpnt0oetomo3tad s rau p;u4trxrxfcio1op   i o;s)trumim3io4om  micsas s2rr( onu4oexoiieils m2el(vpnt0artnmr3iadfmDraneo s seuoxr io1oltn nviat)s2ua(rpot1apx  iciat aDea(vs;u)altoxociadfp  anvi;()srtoxo oy4lp elfvilt) rrmx poo1teeo o3iltlaDulumpnt4aeenmo ty1faDraivol()setmxm no4ameelfvi s s2trumoot1tee ioctls m umu p;(0 lxrxf3oy1latelueols srxrxr3iudopte fetls)aruaumono4altoifeilsls2em( snu4artoif tydfpDe ivils tetm(m3iu4lmenlfct tfsDtrxm nt0tpen i3tlsfm el(vsnu0trtnio io1omD lieo t0teuoio oo1om   icia()sDurum no4tpx ii3iaslsDraumsnu4 rerif oydop e ues;s) euoxo3iodalenlicslt srrmxmonu1olto fetas m eln onu0aeeomociodlatraneo t)setr(m oodll elics s)sDua(m nu4aeeomf3tls aDelnvs () lxrxocty1fmDe ivs;t)sexr(o ou4ol emnct tfs2ur(mpoo4oet  f3tysfm umnvpnt)tlxnxrcio1oatr uvs;t0 exmxm3iodal  mnctlt sDumurpoo4aexn oeiadls emuvpnu)arxomo3oatoateauvo;(0 2uoim3iudomtnmivsatfaDuau ont0oeenmf3tls s ean sn(4trxnmoctadfpDranvols  rtrio oydop emfeta(fs2ua(rpoo4opxnif3tydfa2ulnvon(4 etnmr tatfmtr iei;(0s2tr(o3nodlp elncil()aDum(mo;o4tlx ioeiltlm eluvs u0 leoiocootom r uvo;()teuo(m io1opte iesa()artauroot4aetoif3tasfm2ea( p (0teeoxf iy1la rai ilt) exmio3oo1lmtn fei s s2tm(mpot4alenmf3tadfa rluvs;u0 rerxo ta1oaDrlivs s)trxm(opiy1lle livs s) 2tru  ot1tetnmfcilsla2rauvs ()aeeomfcoodfpt  nvs;s0s2to(r no4ame miesat)sDrrxmoot4tlen oetlsfm uaumo (4trtrxf3iatopDean s;s0s2to(opiu4am emiesa(f Drmx ont1olt ioeiys a2raums;u0 ltoir3tatoat  nvsls0 rxr(m oo1lpt mfvi sfs2um( ono4tlt  fetysfa2ulnmpnu0 leoxrciotlpDeaiei (0t2tm(rpny4alen ivslsfa2rm(m ;t0teeo f3iysls2rm(vont0 ltnxf iotla rln i (0 ruo(o3nudam e ivsl( artmur ;u1optoifeiydla eauvo;u0 etoxr ia1lat  nvslt s2uoir ny1aptnmiet s  Dtr(mpoo1aet mo3ild sDra( s;t)aleoif iadlat lueo t)s2uoir io4om nlfes t)s2urxrpou4olxoioctasfsDumuvpnu4 rermf3todlpt  nes;s0t2umxmpnu1aptnlfeia( artru ono4oeeomf3tadlm2emnmp u)tltrxr3to1la  li ol() rxrxm3iy4aptnmfes t aDraxront4tle moctydla2uluvpnu)tlenmf3tadlmD lu o;t0 exoiopoo4ameelnvslt sDua(m nt1apxoii3iaslm elu pn(4 lxrxo iotlp  lneolt0trtoxmpiydopt lfvsa(fs2um(mp;o0olx mfetaslm2uan o t4 exoio oydoaDe nvi ()teurimpoo1lmenmfeilsfsDtmxmonu4tpxomoetasfaDul(vp;t) lenxr3iodfptelnes s0trurxr3oy4oleelnei s) 2trur no1tlt ifciytfs ul(mo t) etnmf tatfmD au s;t) rxrxm oy4lmtn nesl(fartr( ont4optniieils mDrlumonu4aeeomocty1omt auvs ( texmim3no4lltnmfvs (fsDrmumo;u4ole mfeiydlsDra(vs ()aeerif3oydomD lnvi ( trurxrpnu1al  lfet tf rtr(m nu1olxoioctlsfaDem( sn() rtrmo oy1lpt  uvs ()t2xm(r3iu4lltn ivt (fa2urump;u1apeo ieiys aDumumont4altoxr3tatoate nesls s2toirpoy4lm n ivils sDrrurpoo0tpxnifeias mDemu sn(0altomo todoatraivols0t2trxr3nydal n ict s aDua(r ou1olenmo3iyt sDrl( s;()aeerir3ootlp eluvi s0texoxm3no1om e nciatfartrxr ;u4ale mictyd m emn s;u4 leoio iodfpDelivil(  etmir ou1ole mfvia(fs2ua(m ;t0tle miciasls rm(vpnu4teermo3ty1lp  li il(0t2xo(o3nu1ap   ivia()a2um(mooo0tpe mi3iatfmDulnmsnu0trtniocto1fp eluei (0s2toirpiu4omeemici sfsrta( oou1opto ocilslaDrauvonu)aexnif ty1oa   i o () exr(m oo1op e fes sfarrax  oo0alt mf3iadfsDemumon(0trtrmf3oytfm rlnvil(  rtmiopou4op   nvsasf 2tmu oot1aeeomoctys m rmu on(0artoir3oatfpD auvi;t seurxr oy4lmenlnvt (  2rr( ont4oetoioetad a rmn snt)trxrifctatlp eanvi;s0t2to(rpio4amee ietltfs2uaum no4alxoifcilt a ea( p t4 ltomrciytlm ranvi ( srum(m nu4oltnmfvtls s2rauronu0olxnmo3iltls2rm(vont0aexoxrcta1lpt ai o (0texoxr3iy4ol nmfesas)s2uau  oo0alxn o3tatfmDua( p;t) etnmf3tadfm elneolt)texr(mpiodapee nvia(f Dur(m nu0alxn octydfm2ea(vsn(0 reomocoatfaD li s t seuoxr ny4aptnlivta(f rtmumonu0opeoio3tyd sDeanmsn(4artnmf totomtr ieo;()texm(m nodoptnlicsat  rrm(m nt0tet  i3ias a2rm( ont4tetoxr3iatlp rau i;s0seto(opiudamtnlncia( aDtrur nu4oltoio3tlsla rlnmpn(4arerxf3oa1fmt aues s0setrio oy4amenlfet sf Drmum oo4alxn oeiadlmDrmnmonu0 etrmo3oodfa eau s;s texmxo3iu1lle lnciatf 2tm( pno4aee iiciysfs um(mo (4teeoxf iatomtelnes () exoir3io4lme  icta( s2ta( ono1tpxnioeiytfmDumn ont4aeenif iotlmD  u sls)trtrimpno4olenmfvia(  rua(mpnu1alto oeiltlmDra(mp;u4 rxrir3io1la   uesls truriopoudlp  lict ( a2taxrpoo0apeniieild a um(vont)aeenio3oytla eauvs s0 2uo(r oodolt  netls  2ur(m ot0oexnmieilt m umuvp;()alermoctadoa   nvo;s0 2tmirpiy1ape lfeias)srur( o;o4alxniietltlm ua( pnu) exoxo3oy1la   ivo;s)s2xmir3iy1om  lfesls s2urxro;o0aptn octatlmDumnmont0 lermf3io1oaD luvo (0sexm(o nodlp  mnei (  Dumu oou1open f3iat sDul( o () rxrxo3to1lmtr ieo t texr(m3nudol emfvilt)arrrxrp;u4ole if3iytlm rlu sn() reoxoctatom   ues t) 2xrxr oodal nmnetatfsrrmx ooo4openii3iatfa el( s;(0trerif totopDean il()teuoir nudam elfvi t)aDuaur ;u4aeen o3iys m ranvsnt0aetrmo3oadfatrluesls)srxmxopny4ame mfvs s a2ua(mono4ape ii3iydlsDul(mp () etrmrciy1omtelivs ()trxmim iudopeelnct (  rtmxmpot4tpx mo3tytfs2ua(vp t0 rtrmf oytfp e i s (0t2xoxr iy1lp emnvslt s2tmur ;u4oet io3iltfs2rmu p;t0aetrifcio1optelu ols0seumimpiy1aptemnviat sDra(ro;t0tpeoio3ildlm2um(mpnu0texoxrciytfptrau o;s tetoim3no1ole lfcs () rua(rpnt4olenmoeiatla2em( sn()trxoxf3iadomtr ivs (0srxmxr oo4al emfvt sf Duru pno4tltoio3iyslsDeln s;u) reoio3iydomtean i;(0tetmimpoo4ll e fesat s2tm(mpou4ape  feiltlm2ean s;t4tlxnmfcia1fp eai sl() ruo(m3iydll elfvtlt  2tr( o;u4oee iieild s2rmums;t4 lxoxo3ia1opD  ivilt)setr(m3iodame mnvsl(fsDtrxmo;u4tpt mociydfm2umnmp u4 reoxf3iy1opt ai s s0 euoxrpiodolee nvtlsfs2ua(r ot1olxn o3iat a el(vs;u4tlxnir oodlatrauei;(  2xrxmpiudom nmfes (f 2rrxro;o0oex ifeiytfs2uln sn(4 etoxo oy1omt  i o ()s2trxmpny4amtnlfcil(  2taurpnu0aptnmoetyt m elu pn()trxomfctatlmtrln olt  2tm(o no1olen ncsa( sDuaxm oo4tlxnioeiytfm um(mp u0teerxr3io1omDeli i;t0 rxo(r3oo1lleelncsl(f Dtru pot0openii3tadfa2rl(msnu)tetnif3oydoptranvo;s  2uoiopny4om e fctas arum( o;u4oee ioctys s2elump;t) eeoioctodlmDe u sl(0 eurxm3oodol  lfcils aDrmur ;t1tpxnioetlt mDumuvp;u)arxrmr3oytlp  lueols0t2xmxopoudam emieiat aDurxro;t4tpeo fciat mDul(von(0trxnmr3tatfpt lneslt t2xo(rpnu1oltn ncs tfa2rau  ou1tlt mfeilt a2rlnvp u0altoxo tytlmtr i i s) rtoxrpny1aptelietls)srrm(mpou1oltn i3iatlaDuan o u) eerxo3tadlp r uesl()texmxo3ny1lp n fetl()aDuaumonu0aetnmfciasfm2elumo t)trermf3iadom raivi;t) etoimpiy4optemneil(  2ua(  nu4tlt  feildfaDua(ms;u0tltnxf iytop e u s;s trtmxo3ou4ape  nvil(fa2rmum no4teeoifcils s2rl(vsnt)alxnxoctytoa  lnvsls)trtm(opio1alt lici t)artr(m nt0aptn oeiatfs rl(msnu)tlxoxrciotopDeaivs t sruoim ny1ap nmivias aDrrxmpnu0aee ii3tlslm2uanms;t4aetnmo tatoaDe neo;t)s2xo(m oo1aptnliet () Drmxmono1tpe mi3iasfsDrmnms;u0altrxoctodlmD auvo;s srtoxmpny4openlnciat)a2ta(ro;t4aexomoctaslmDrmn s;(0 lermf3tytopteaivo;t t2xm(opoudal emivtls a2rmumpno1oltnmoctad mDelu onu)tetrif ootopt lnvolt0 etoir oy1lpe  fetls)sDtmu oou0alxomfeiys mDrlnvsnu)trtnxocoa1lmte ivo;( trumim3oy4apenmnvtasf rumxrono4tpt  iciydlsDelnvo;(4alxoir3oo1oaD auvs s0 2xo(o oy1open fei (  rrmuro;t1alxniieild m eluvo (4alxrmfciadfp rln s s) etmir3nydom   fvslt)s2urumpnu1tetnmfcildfs rauvp (0treomf3ty1op elivo;()t2xr(o nudop e fctl() Drm(r nu4oltnifcild s rlnvo (4arxrmr3tatlp   ivolt trurir nu1apte fviasf rtrumo;t4opeo i3tatlsDel(vo u0 eeomo todoptr ivo (  exmio nydomee neils) 2rrumont4olxnmoctyslmDulnmont0artrifctydomDrluvil()setmim iy1lm  mneil() Dum(m no0texo ocildfaDrln o (4tlxnmf3iodla ean o s trumxrpio1lpe  fvt s)sDua(  nu1teeomoeiytfs2ranvo;(4 lenif3oa1faDelieilt  2to(r no1apt livta()sDtm( oot4olxnmictydlm uluvp;u) rtrmocty1fateaivi s  etm(o nydole mivia(farum(m ot1aeenifetld m2rmumont) rxrmo3to1la eaieo;t seto(r3oo4altelnvsl()aruaxrpot4oexomi3iys sDrmn s;(0alenmocoodlpDranvo t)sexrio oy4lmtemfvi t) Dumu ooo4olxnmoeiyslm rm(ms t4aetnifcto1op eaueol(0t2uoir iu4lpte nci t)aDtau pno0aee if3ilsfm ean sn(0alxoio3iydoa rln s s0 rxmio3no4lle mfcils)sDua(root1tlxnioetas sDum(vs;() rtnir todfmtelueo;t0trxoirpnudlmt  nesa()srrmur ou1olxo oetadfm2uau o;(0texoio ty1lp ranei;s sruoxr3iy1lpe mivs ( aDrru o;u1tpx ifctls s2emnvo;u0 etnmrcto1fmt livo s)sexr(rpiudlpe  ncilsf rrrx  ;t4tptn ieilt mDuanvp;u4tltnmocty1lp r i s;t) rtoxm3ou4lptelici sfsDurxrpoo1olxoifctadfs2ulnvp;u4 exnmr3iadlatrlnvi;(0teurxopnu4ol elivilt) 2um(m ;u1aptnifeiasfm2rluvonu)aeenifcia1lat livo t s2xrxrpiy1omt lncs s  rtru onu4alto fciyt a2umu o;t0tlxrxr3tadopDraies;t) etrxmpoy1ope miesl() rur(  nt1optniicildlmDul( o;(4trtrxocootop   ieo;()trtrxm3oodlpt lies tfaDrmxrpnu0alxn oeiyd a2um(monu) rxrxo3iodomDran il(0sexoxr oo4lltnmncils srumu  no1olx  f3tatfsDrmumsnt4artomfcto1oa r uvi;s srtrim3ou1om n fvt sfs2rau ont1altn iciys a2umn o;(0aexrmo ta1fpteaueo;t)trxmxo3nydopeemiesl()artau pou1tpx mieild s2emnmonu4 rxrxf ta1lm  an i s0 eto(m oydalenlnesa()aDurxmooo1oexomoctlt a2emumo ()alerio3iatomtraivol()sexmxopoo4ole  ieslt) 2raur ;o1tpeomfeiasfsDuln p (0trtnmr3io1latrlieil()srxm(o oydopt mneias  2urumpnt4alx mf3tad mDelnvs (4altnio3tytlpDran s;s)trxm(m oo4lmtemnvils) Durum nu4aleo ietltfs2uan s t4 lxrif to1lpte i i s) rurxr3nudamt lnet ( a2taumonu4tet ii3iasfm el(vs;(0trenmo oydlpDrauvs;()s2tmim oo1ape mfcsl(f rumumono0opt  i3iadfm rl( on(0 rermo totoatr uvi;t)s2trxo oodap emfet s)srrm( pou1teen ocils aDra( s u) rtrio iytomt aues;( s2toxo3io1om nlfeilsfs2rr(m ;u4tetniictyslm rau o (4artoircoo1fp  lnei s0setoxo3io4amen fcia()sDumxrpnu1tltnmi3iasfsDumn pnu4 eenmo3iadoptrli s (0s2xo(mpoo4opee iet (faDumu  ot1opt  fetldfa uluvpn() etnio3oydlmtr n s ( setoimpiodamenmnetlt  rtau pnt0aetoiieild m2el( on(0 eenxfcoydopt luei;s) 2xrio iu1amte fciat) rurumpno0opeoiieiydlmDumnvs t) rxomr ta1oaDrauvi;t0truoim3nu1llte fciltfsrrmxrono1texoioeildlmDua(mpnu4trxnxo3oadfptr i ils)s2urirpno1lleemfvsls)s2rmumoou0tetomietydlm2rm( p (0 etnmr tytopD livilt) rtmim io4lp  mnvsat)sDta(mono1aetn o3iat a2el( p (4 rxoio ia1lmt aivolt0seuoio3nu1opt lieilt)sDraxmpot1aleoiociaslm2eanvont0 lxnmr iytoaDeln i ()srurimpou1amtelnetat  ruaumont1aptomi3tytfm elnms (4aexriocoo1fpD lu o;s  rtm(mpiy4oltnlivs t a2uau poo4ope ifeiatfa2elnmp;t0tetnxf3ootlate iei t sexrio oo1al   nvsa( arum( pnu0opxo oeildlm um( s ()tlxomf tydfmDraivi;(  2xoiopny4llenmiei t a2umur ot1tee mfeiyd mDeaumo;u4 rtnmr3totfm elnvi;( t2tmxm oudlpe  ictl(fs2uax o;o1tleo iciydlm2uluvsnt4 lxoxr io1opte uesls srxoxrpiy4lpeemnesls)arur(r no1oex ifeiasfm rln p u0trtrmrcoytoaD anvo;(0sexoxm io4ap nlnetlsf rua(r ;t1oeeoifctltfaDeau s;(4texnxf3totfptr nvi;t0sexrxr3iy1lm nmivia()s2rmum nu1oltomfciyd m2uluvsnt4aetoif totla rlnvslt0 2ur(o3oydlpeelncias)aDtrxr nu4apxoifeiat m rau s ()altnmf oatla  auei;t) etmxm3no1omeemnvtat sruau pou0ope if3ilt s2el(mont4 renif tytopDrln s;t)trxoimpnudamenmnvsl(  rta( oou1ope mi3iasfs ranmo t0aexnmfciadlmD aues s)seuoiopno4lm  lncs tfs2trxrpoo4ope ioetyt s rluvo;u0 rtrmf oytla rlivi t  eum(opny4lltnmieils)sDurum ;t0opeoioeiyt aDulnmont0tlenif ootfp rlivi;s t2uoir oudll  mnviat  Dra(  nu1ole mictys m rln p (4 lerifcto1oaDeli i (  etmio iudlpt  neta() rrau poo0apt ifeiatla2elnvpnu0trerir3iotfaDrln o;s) rumiopou1oleelfet tfa2rr(  ;o0alenmoeildfm2rmump ()alxrxrctodfa rai i;t srtriopnu1ole  ncslsfsDtau o;o4tetomi3ilsfa2elnms;t)tetnifciodomtraieols0 2tm(o ou1aptnlnei ()s2umxrpou4opt  f3iytfs elu p;(0 ltnif3ty1fm rai ils0s2urir3ny1ome  nci s)a2rmur oo1tpt moeils sDrlnms t4aleriocoadfa  li slt s2to(opou4omt lfei () Dumx p;u0tpeomiciytfs ulump t4 rtnxf3oydoaD  u sl(0teurir iy1aptelncs (  Duaxrp;u0olt ioeiat s elnvo;(4trxrxo oadoa  lneo;t s2xm(m oodlptelnetls srta(rono4aetoioctldfm2umnvo u4 etrxr todlmDeai sl(0 rxmxr io1llt  nviltfa2tru pnt0texoioctls m rmums t4 ltnxo oo1om  lneo t  exmio ou1ale lfesasfartmu ooo1oleoiiciasfm2rl( ont0 rxrmf oytopDelnvi s trtoirpiy4ap nlieta(fs2tr(r oo4apt mf3ils mDemums t)arxrmf to1faDe neslt)s2ur(m nodap  miviasf 2um( pno0oetomi3iat sDemu p u4 exoircoytfmt  n i;s0s2tr(r iydale  fvtasfs2taurpot4olxnmi3iasfsDum(vp u0trenmo iydfmt auesls t2trxm iu1al n net ()s2tmxroou4oltnmi3iatlmDea(vont) exnmr3oytlmte neo;s)tetmxmpiodlmeelivslt  Drr(r ;t4aetn oetyt m eluvp;(0tlxoxo iatfpDe uei;(0trurim3iu4ol n ncsasf Dtr(m no0tpto iciat mDra(vont0aexnmr ty1opD aies s s2trxr no4lpenlivslt aDrr(ro;u0opt  o3ildfs eln on(4 rtnmo to1fmD  nvo t0t2xr(rpou1olte nct t sDtmurpoo0tlenmi3iltla eanmo t0 exnxrcoydfatelnvi;(0 rur(m nudlltn netls srra( p;t1ope  octls s rmuvp t) etnmocia1lm   neols0 exrirpio1lmtelivs t)srrru  oo0olxn oetydla el(vo (0altoio3oytoaDrluei;s seurio iudamtn icsa(farrm(r ;t4tpxoio3tadlaDrmu o t4alxrio3tatfateaneo s s2umim3oodlm  mfes s aDrrurpoo1texoioctysfa2ran pnu0texoifcoytlmDr uvs t) ruoxrpiy1am emivsl(fsrrrxmonu4oex iociyslsDumn p (0aeenir oadlptr u o t)s2xm(opou4ame mictas)sDrm(m ou4oltomi3ilslm ran pn(4aeerio3io1lateau o;s)t2uoxm3nydap  mfcia(  Dtrum oo0aptn oeils aDulu p;t0tlxnxo oodopt livsl(0seum(r io4lm elneiatfs2urumo;t1tltnmoeildfs2el(vpnt)trerirciodfpDeln i t  rtoio no1omtemfet ()a2urxmp;o1tpxomociyslaDea(vp;(4 lxnmr3oatfp raneo (0 2xoir3oo4am emfvs t)arta(rpnt4tpxnifciasfs ulump (4trxnxo3oatoa rlueilt0 ruoxr nudop e iviltfaDta(r ;u0apenifciysfm2em( snu0 lxnxo3tatfpDe n i (  ruoir3iodam e ieiasfaDumxro;u4optnmocildls ea(mont4tltnxrctodomtran i (0trxm(m3ny4opeelieils a2ua(  ot1tex mo3iadfa2eaumonu)aexoxr iotlpteanes;s)texmio3iu4ol e ivtas)aDta(  ot4tltn fctlsfs uauvo;(0tlxnxo oadlmDrluvsls0t2xrio iu4lmt mnes (  Drmumpnt0opxoifeiys aDea(vp u) exnmo3totomDrlneil( trtoxm3iudolen icsltfaDrr(mont4olx  f3tls sDuluvs;u4 rxrxr3ootoatr ivi s tetoir3no4lptn feia()srra(ro;o0tle  fciys m2el(mp;u) rxomrcoy1lmDrlivols)s2xoir3iydlm nlfei ()a2umurono1oleo i3iys a2uan pnt) reoir3tatfatran sls tetoim3ou1oltemfeils  Duaur ;o4alxoiieilsls emn o ()tetrmrciytomDran s;s0 2umir3iy1apte neia(fa2rrxm oo4tetoiiciyt mDrmumsnt0 exrifciatfpDrln o;s) rtoxrpou4optnliet s  2rrum nu1tpxnioeilt sDeluvon()texomo oy1oa r uvo;t setrxmpnudal  micsas a2umxmpno1apxnmociad m uau pnt0 etomf3oadfm elneolt0srtmio ny1am elneiatfs2um(  ;t0tlen f3tltfmDemn ont0 eenio iatopD  nvsls0 rurio3oy4olt lfvias artr( p;t0tleo iciytfsDeanvonu4aeerirctodlat  ieo;s0 2xoxr3ou1al  lnvias)arrr(m nt4texnio3tltlm rm(vo;t) exnmoctadoat aues s teuo(opno4ap elietat sDrrumono1altnioeilt sDeluvs t) leoxrctadla eaueo s srxo(opny1omt mictas)s2rrx onu4alt  ocilsfa uaumsnt)alxoxf iatlm  anei ( t2xm(o3nodoleelnci ()s2ur(mpoo4tee iocias m2umumsn(0 rxoircoadopt ai ilt0 ruoimpnudapenmivi t)arraxmpou1ale mfctadla ranmp (4arerifctytomDe i i (  etmim iy1al   nvslt  rraxmpnu4aleo iciasfaDemu s;t0trerxr3todopDr n sls trxrxopoy1olen ivsltf rrm(m nt4alx mfeildfs ul(mo;(0aexnxrciy1oatr u s;(  exoxm nodlleelnei ( arururoou1oleomoeiyd aDel(von(4altrio to1oat aiei;()teurxo3iu4ol emneslsfsrrm( oou1opxomfeildla2ua( s t4trtrifcoydlp ranes t0seuoxr nydllt lietlsf 2rruro;o1oltoifcilt s2um(mpn(0aeeoxf to1op  aieo;(0s2xoir3iy4op   feta( arumumpnt1oetnmo3iysfm2eaums t0aeeoxf3iodop e nvilt)texmimpou4lpe mfvt t)a2umumoot0aptnifeiysfa el( ont) eeoircoo1fp raivsl(0 2umio3iu4ol e fcia( aDumu  ;u4aee mf3iydfs2ulnms;t4 lenmoctytfmDr u ilt)t2xo(m nydlp elivi s aDtaur ;t0opxn fciydfmDranvpn(4 etnxr oo1lm   n sl( srxoim3no4ale livs () ruru poo1tltnif3ias a2elnvpn() rtoxoctytfatelueils0srtmxm nu4lmte fvil() rrmur ;o4tee mfciltla2uan pn()artrmo oodom  liei;t0texr(o3iu1lle mnct s) rurum nu0apeo fctydfm eaump;u0artomf io1optelivi t)srxoxr3nydolenlfei ( aDumu  oo1aex mi3ildls2raumon(0tlxoxrcio1omtelueol( s2umir3ny4lleelfctlt)a2tru  ot4apen fciyt a ea(mo (4aeeomf iytoatraues;s0trtmxr3nodomtelivils a2rm(  ot1oee  oetatfm ulums;()tetrxo iotlp  au s (0sexmiopio4oltelnesl( s2ua(r ot1alto ietys a2um(msnu0artoxo3iodla e i sl(0seumxr3oydalenmfesls) Dta(m nt4oleomieiltla2ulu o u4tlerxo3iodfmDr ueolt) 2ur(rpoudom  livs sf 2rmuroot0teeo oetasfs2ra(mont4arxoifciodoptraieo;s)t2xoir ou1lle lfct tfsrtmumo;u4aexnio3iydlm2rl(vp t0trxoir oadop  anvils s2xrxm3nydamt livi (f 2ua(  ;o1tleoiictyslm rmnmonu0 rtnircoytla   ivs;s)teuoxo nu1al n fciatf rtr( o;u1texnmoetaslm ea(ms u4aetoxr tydopDe nes ( seuoimpoo1ol emfvt (  2uaxr ;u1tlxn i3tls a2umn s;t0treomf ia1op   nvo;( sexrxopiy1op nlnvtl( a2uru pou1tptn i3tys m ea(vp ()aeeoxr ta1lmtrln slt) exr(o nu4alenlnvt (fsDtmuront1tpxo ocildlaDraums t0 rtnmo3iytlaD  neo;t)trxoxo nudlmenmfct tfsrrm(rp;u0opxnmoeilslmDelu s u4trtnxr3ty1fpte i olt seumim iy1lpenlfetls) 2rmxm ;o4opxomocils s eanmsnu0 rxrmr3tydfp raiei;s0s2uo(rpno4opt  neils)a2trurp;u0olxn feiadlsDelums (0trerir ia1optrln o;s t2xo(rpoydlltnmnetat)sDtmu pot0alxnifetlt m2rm(vs;u)tlerif iydoat au il()t2xoxopnodoltemncias)s2rm(r ;o0tlt mi3ilsls em(vs u4 exnmoctodla r i olt teum(o oy1apeemics s) 2trxm ot0aeto f3tls m rm(vpn(4alerir3tytomt  ivi t)t2tmir3iodomtnmnvsas  2rrx  ;t4oexnif3iysfs rlumpn()aexrmocoa1laDe neolt0t2trxo3oo4amtemfes ( sDrmu p;o4oee iocild sDum( o;u) etnif oydfateauei;s0sexm(opoo1altn nvil( a2umumpnu1tpe mfetatfs ranmpn(4aeenioctydlpte i i;t0s2toirpiu1lltelncsl()arraxr ou4teeo iciadla el(mp;u) eeoifcty1lpteai o;(  2xoxr3nu1opeemncia()a2taur ot1oexomi3iasfaDrlums (0aetnmrcoydlmD au s t0 rtrir no4lp emics s  2ua(mpou0ole miciltla2umu snt0altomfcto1oat  ueil( s2xrio3iydap  lfctas aDtrxmpno1tee ii3ilt a rl(mp u)aeeomrcoytlaDrauvs;s)seuoim3ny1olenmnetlsfsDua( ooo4tpe mo3iyslaDraumsnt)tltomo3oo1oat  ivo;t)s2urxr3oodop  lnvs sfa2tmx pnt1tet iietat mDrm( on(0 etoio ootlm rlueol(0sexo(mpou4ol n fet ( a2uru o;u0tlx mf3iadlm2em( ont4 lxrxf3todfmt  u i;t) 2ur(o oy4altelncs ( aDrmu pno4texo fcilsfs umumont0tleoir3to1fmte i s;s0s2xoxm3no4omeelfetatfaDtmurpno4olxomo3iydla2rmu o t0 rerifcio1omDe i s s texrxm io4lp   ivia()artr(  oo0opt  ieildfm raump;t4trxnif3iadom  aivi;s0sexrxo3nudol  lnctlsf 2uaur nu0apx iicildla2umu s;(0aleriocia1lmtelueo;s s2ur(mpoydlpeelivias) Draur nu1tetomi3iatls2um(mp;t)treniocoo1fmtelnvil( seuoim3ou4llte ietlt)s2urxrpoo4texnmi3tadlm2em(mo () eenxfctytlmDe ivo t) rtrim3iodlmt  fesl(faDtrum ;t0tlx mieiytfm2eanvsnu)treoxocoo1fm r ivs t texm(rpoo4lle lnei s) rrr(rpnu4aeeo fctys a ea( o;()artoifcoadfate n o ()s2xoimpoodlptn nes t s2umxrpnu4alxn o3iat aDelu p;u)tlxrmr iotomDe ivo;s)tetmxo ny4open neslt) ruau  ot0optomfeiasfs2rl(vp u0trtomrcta1lptrau s t) etr(o oo1lm nlfeils)s2rax  no0aexnifetltla2uanvp;t0altrir3ta1opte ivs s0srtm(o oudlp elivs sfs2umumono1oetniicildlmDrauvp (0areoifcoo1lptelueolt)srtr(r3iydllte fciatfaDtrx oou1tpxoiieiadfsDean s u0trenxociadopte nvi (0 etr(m io1lptnlfciat  Dtr(mooo4teeo ietyslm ulnms u) etrmr3iodoptrln ol( seurxopoy4altnmncsas) Dum(roou4tpxomieiasfs2um(vp;t0alxnmr3todfaD  i i s)tetm(opoodamtn nvs s s2ra(ro;t0apxo fctyd aDemu o;u)altomf3iydfm  anes;( t2umxr ny4alt  neta(fa2ua( pnu4oltn i3iydfs2uln s;(0aetrxo oodfa ranes;()seurxrpiudoleelieslt  rrauro;u0tlx  octysls ulumon(0tlxrmo3oydfm r uei s) ruo(m no1lp elict tfa2uaxmpno0opt ifeils s2emnmont)tlenmr3oo1fmteaivo s  rxm(o no1llt lnci () Dtmuro;t0teto oeils aDemu p;u4 etoxrcty1lmt auvs ()s2toir ou4lmtnmivi ( a2urur oo1altnmo3tyslaDulu o;u) exnxr3oo1fp elivs s)t2urxopoudam emfcilt  2tmxmonu0optnmfctydfsDulnms t)trtrxf iydoptrlivilt  euoxr3oy4lmen fesatfa2rr( ooo4aexoioeias mDrau o;t0arerir ia1om rlieo ()setoio iudaleemfesa()a2trumo;o0aetnmfciadfs2ea(vp;t4altnir3ootoaD aivs;() etr(m iu1lpe lictas)srur( poo0alx  ieiltls rlu ont)tlxnxfciydom  anvo;(0 2um(m oydlm   nvt t) Duru p;o4ope ifeiadls ra(mon(4tetoir ia1oat lu ilt0 euoio3iu1omenmictls) Dra(r ;u4ole mf3iysfa rmuvo;t4 ltoxf3to1op eauvo t)s2trir ou1omtnlici tfsDraxmo;t0tlxoiieiydfs2rau snt0 exrxfcoadlmtraueils srum(o3no4llt  nvslsfsrrrxroou4tetn fciys aDrmnvpnu) etnxoctytfmDeli s;(0 2xmxrpnydlme mfvtl( srrmxm ;o0ape  o3iysfa uanvp t4 etnio oy1fp rli ilt)s2tm(opoy4lm nmfei s  2rrxm no4openmi3tys a eauvsn()alxnio ia1fm   i s;t0 rxr(m3no1lm  lneil(fartaxmpnt1altn f3ild s eluvo t) etomoctadlpteai ols  2tr(rpoydoltnlics ()s2raumoot4altomieias m2em( onu4 exnxr3ta1oatrauei s)srxrxopnodomt  nes t)s2tr(  ;u1tlxo octasla ra(vp (4altrxfciydoptraies;t t2tmxm nu1aptnmfviatf rrrum ;t4tlenmi3iyt m2um( onu)aeerxf iotoptraivo;t0 eurxr3oo4lm  mnet s  2rm(m nt4tpen fctad mDrauvp u4tlxrmr3oytla r uei t0t2xoim nodlptnlivia(fsDtrxmo;u0teeoifeilt m2eauvon(4 eerirciodlaDrln ilt)srtoxr io4alt  ietasf Dtmur ot1aeenii3ilsfmDuaumo u0 rerxrciodoateaneilt)teur(rpiu1llt lnvsl( sDrrx ooo0opxoioctltfsDelnvs;u4tlxrxrcta1lm elu sl( s2ur(o iodlm   ivi s)sDrmu  ;o0aeeoif3iysfsDel(vp;u0 lermf3tydoatranvi;t)trto(rpno1optn nvsat sDtmump;t4tpxnmf3ild aDuauvs (4aexnmf totlatrau s;t)s2um(mpoydop nlici tfarraumpnt1olx  ieiydfaDum(mp u)aeenmrcoo1latrlu i;s)sexm(m3ou1olt lneils)a2trurp;u4tltnifeiysfsDelnvs () reomf oatomD anes;t0s2umim3oy4ll elnei ()arum(mpou0apxo ieiat a el(vs;(0alxrmrcoatfptrlnvsls)trtoim3oy1oleelneiat)aDuaxm ot1alto f3iat aDumnmont)altnif oa1fpD lu ol() rtoir nu4omt  nvs (  Duaxm ou0tlxoioeiatla ul(vo t0 ltrxfctatla e neols)s2umim3oo4lleemfvi s sDururono0optn feiasfsDeanmp t0areoxrcia1la e uesls trxoim oo4lpt mnvsa(fsrur( o;u0alto oeild sDemnmo t4 lxomr io1lp e nvi ( t2urxm oydalt mneslsfs2raumpot4tleomi3iltfm ranvp;t)tlenmo oy1omD  i ilt0teto(r3iy4omen fvtls)sDraxr ;o1alxnioeiltlm2ulnmp;t4arxoio3iotopteaivi s  exrxm ny4altnmnvil(f Durur no4tpt ifctlsfaDra(mont4 rtomo3iytomt lu slt) rtr(o3oo4lpte nviat  Dur( p;o1oex miciadfaDrm(ms;t) exoir iodfm elieo;(0s2xmio oy4apt lfct t)sDrr(mo;u4opx mf3ildfm2elu snt) rermf oy1lp  anvo s0 eumiopiydap  mfvsa(  2rr(r nu0olenmo3tlt mDeanvs;(4tlerio oa1oa raivs t0 2um(r3nydlleemietlt s2rm(r no1opxomf3iadfaDem(mp;(4trxriocta1opDrai s;t0 2tmxo ou1olte fvtlt  rtrxmpot1aeto fetls sDua(vo t) etrmf iy1fateluvi;( t2ur(r no1om n ncsat)srtaxm ou4opt  f3tlsls2uan s (4 renmr3oytomtrlnvs;()s2umim3nu1olenmnci (  rtr( poo1oetoifeiysfsDum(mp t4 rtoio3oodfpteaivi s0trtrxm3oo1lpenlfeil()a2rru  nt1olto ieiadla rm(vp;(0 ltnif3oo1lateaueslt seumirpiy4lp  mnet sfsrrmxrooo1tlx ioeiltls emnvp t4tetrxociotfp ranvs;()t2xoir3oo1op e fctlt)sruaxrpot1tet miciatlm2uaumo;u4tltnir3iadoateli s t) rxm(o3oy4lptnmfes (f Dum(r nt1oet io3iatfm uanms;t0aexrxfcoa1lpDrli olt setmxmpou4altnlncsat srrrxmo;o1oleomf3tyt s ranmp t)aetomr3iadom eau i (0sexr(opnydamt lfei s)sDumur nt1opxo ietlslsDul(vpnu) rxrifcio1fpD lnes;t  rto(m ou4alt  icia(fsDtrur nu1ole ii3tyslsDumumpn(0 leoio ta1omte i o;t seurio3nu4apeelneiatfa2um(m ;u0tleoioeilsfs ra(mo t0treoxr3to1laD an s;()s2trxopiudlmt  ncsls sDuaxmo;t0apxoifeiaslm ua(vo;() rxoxf ia1fmDeluvs;()s2urxm iy4amtnlnctat)arta( pno1aexomociytfa2ul( pn(0tlenxfciatfaDeau s (0trxo(o3iy4lp emfetas) 2trur nt4olx mfeiasfs2rmuvo;()artnmr3io1lpDean sl(0 2xm(o iu1llt mieilt aDumu oou1ale  fcilsfa rm(mo;(4 ltrxr3ootfaDr n ols) 2xo(r3nydoleelncsls) 2rm(moou4opeoio3iys a2eanmo t0arerxr3ootlpD anes s) rtrxo oudop   nvs ( arrru  no0tlxn o3tad mDeanvp;u0artrxr oydoatr i s;(0srtmxr iudoptelivta()sDtmu o;o0aetnifetltfsDelums (0aeerif3iatoptelivolt) 2uoirpiy1lpe mfesas)arur(mpno1alto ieiat s2rmu s u0 reriocto1fp  aieo;t  rtrxmpno1lmtn ieilt  ruax o;o1tpe iieiydlmDeanmpnt4 lenir todfa rluvo t)setmxmpou4optelfcsl(  rrr(mp;t1ope mfctldfa rln p;t4texnxr tadfa r i i;t0 rxrxopoy1lm nmfct ( srtaumoou4oleomoeiatfa2el( ont)texrio iotfat an o;t) rtr(mpnudapen ivslt) 2rmum ;u4oetnmo3iyslmDeln o u0altrmo todoatraiei;s0s2to(rpno1alte ies s) Dtrx  ou4texo i3tld s uln o;(0 lerifctadopt aivo s  euoxrpny4op  mneiltfs2trx ooo1ape  ieiatfm eanvs;t0artoifciatfm r ieol(0 2xmxrpoydope lnetlsfa2uaxmont4oee  fciatfmDeanvs u4artrmf totoaDean sl(0tetrir3oo4lm emieiat sDumxm ot0oexn o3iyslm2rlu p (0altnxfcoodomDr nvi t0texr(m no1ol e fvils)sruau oot0apt iieiasfm eauvo;(4tetnxf3iotfaD auvilt0texo(m3nydoltemnctas) rur(ront0opeoifetat s2uaums u) lxoirciadfmt  i il(  rtm(r3ny4omt  nvslt  2tru o;u1aexniieiydlm2ra(ms t) lxomocootlmt  u o;()tetr(r3oydlme  nes s)srua(mp;u1tlxn octydlaDuanmp;t4 rxnxr oydomtrlivs s0tetrio3oudomeeliet sfs2ta(mpno4aetoii3ils a eanvs;u)trerxo3ta1opteaues;s0 rurxopio1lle lfvs (  2truro;u0oetniociat sDemu p;t4 leomo3tytfmD lneslt0teuo(o iodol  mictls) Dur(moot4tleomictytfsDumnvp u4aetrxr3tydlp r ueol( s2tm(m3oodal nlfci t aDuax  oo0aetnii3ias aDemn s t0teerxr iydlpDe n ol(0t2xmxrpno1lmenlivs sfsDum(mo;t4optomi3ilsfs2rm(vs;u) rxnmf3iy1lpDrauvolt)sruoimpiodame  fcils)srrau ooo4tpe  oeiadfa2uanmont0trerxr iodlaD ln ils0 2xrimpiu4lm emfct s arra(m nu1tpx  feiytfsDuau p;u0 reoxociytlmtrluvol(0 eumio oo1llt  fvslt srtmxrpoo1olxnmi3ilslsDeanvs;u0tltomociydoa  luvs;( trxrxm3oo4omtemneils arua(mo;t4alxomfetatlm uau p;t)treomrcoa1laDr uvs;()teum(m nodamtnlfcs ( sDur(mpnt4tpxoifciat s uluvo u0treomr3iatoptelnvo;s)seuoio oy4ll nmivsl( a2ta(r nu1aexn fctat s2rl(vp u0tlerio iotlm rlnvi (0texmim3ou1alee fvi (  Drr(rpnt0aex mi3iatfa2rlnmp ()tltrmo iatfpte n sls0 2um(o ou1amtelnci ( arum(  ou0opeo feiatfa2uln snt0aeenir ta1fmDr uvi;s s2urxm nydlm n nvt sfa2rrxrpou4oet if3iltlm2raums () rtnio3iotlaD lu sls0 2toir3oo1ol  micils)aruau  ot0oleniietldla2emu onu4 lxrif3iatomDeaueo;s)s2xrxopiy1lmt lict sfsruaxmpoo0oexn fetadfa2emnvo;t0arxnmr3totop r neols0setrxrpiydlleelfviat)aDuauro;t4optnmfciasfaDem(vo t) etomociy1lmtelues ()teuo(r3ny4om nlfctlsfartau p;u0teenifciadfsDuan o (4trtnifctytoa   nvils srtmxo iudlptemieil(f Drr(mo;o1oeen fctydlsDuan onu0trxomfcty1omt  u sls0srtmio3oodlpte iviasfa2ua(r ;o1aee mo3tyd m um( s ()alerxocoa1oa  lnvs t0sexrxm3ou4apenlivsl( s2urxmpnu0tleniieiydls eanmon() lerifctadfa  ln slt0setrir3no1ap emivtls)s2urxmoou4opto oeilt aDuaumo;(0tlxomr3ty1fa  luvi;( s2tr(m io4opee ivs s arrr(roou0aleomieildla2rmuvs t4 eeomocty1oa e n o () 2trimpoodaltnmiei t) Drmxrp;u4tltoii3iasfaDra(mp;(4teerxf iy1faDr i s (0texrir oudamt mfciasfarrrxrp;o1tleoifetatfs2em(mo (0 ltoifcoa1faDr ivs;(0teurxo3iy1omt liciat) 2um(  nt1altnmf3tat mDelumpnu)trxoxf3iadfp e n sls t2uoirpny4lm e ivs s  2uau ont4opeo fcild m ul( s;t0teenmoctadlatranes t0 rtmxo3iu1apenmfct t  Dumxm ou0apxoifetls m2emnvpn() renifciadlmt  i i t) eurxrpny4lltelnci s aDrmxrpot0tleoioctldlsDrmnmpnt)alenmrctodoa elues;(0s2toxm nydlm   fctl(  2uaum ;t0optnmo3iysfs2ua(mon(4 ltniocoo1omtr uvs t  etriopiu1aptnmfetat s2raumonu4tle ifetas a rauvp u) eeoxo totlptr u i s  exmio3io1lm   fes (farrr(mpnt4aptoifetlsls ranmo;u) rtoir tatfmteaueilt) exoxrpny4al e feta( sDrrxmp;o0apxnii3tltfs2eanmo t4 exnxo3oytoa   i slt0 euoim3ny4ame  feiltfsDrr( poo1opx if3tlt aDua(mont0 exoio oatlmt luei;(0 rtoimpio1amte nvsl()srrrxmpot1opxn oeiad a2rmn s;u0aexnif ty1lat luvo t)t2urirpiudom   neiat)a2raxroot4olx  feiadls emump;(0tetoxr3ty1la  ln ilt)teumxo3no1lp  lfei t sDtru o;u4aptnii3iyslm el(vo t4 ltoif todopDrauei;()seurxopoodapeemnes sf 2uau pou0texoiieiydlmDelnmp (0treoif3ootomt anvs t  etrirpnodam nlnvt s artaum nu1apt miciadlaDrmuvs (4 rtrmf tadfptrau o;(0s2uo(r no1amenlnei tfaDtm(r ;t0apeoio3tydfsDulnmpn() eenir3oo1omtrlivi s)texrxo3nudal   ivil()a2ur(moot4tpxnmf3iat aDulumsn(0artnxf3iy1la r u s ( srur(m iu1ll n ncsl(fartrx pot4tetn fetatls raums ()trtoif ootoate n o t0seumxmpny1ol nlfviltfsrtru p;t1tetoiociasfsDea(vs;u) exnmocto1om r nvs s) rtr(r nydom  lnei s s2tr( o;o4tlxo ocild a uluvs;(0trtrifctydlp e i ol()teumxr3iy4omtn nesls  Dra(  ou4oleoioeiytfm2uauvonu)arerxociatlaD  uvils srxr(m io4lpe mnctat) rtrumpnt4oleoifeiadfm2ulumon(0tleoxocty1oa raneo;t s2trio iy1lm emivt s)a2ua(ront1alt io3tadls uauvont4aleoxr iytfp r n o t0sexoxmpoudamt livta()arua(m ;u0opeo ieiadfsDuauvs (0artrmrctotopteaivs;()srxo(m oy4alenlivs tfarrm( o;u1opeomo3tadfa uln p u) rtoir iadopD lnei s  2xrxr3ou4lltnlncsls)s2urxrpnu0aleomo3iad a2rmump;u4 rxrxo3ia1laD luvi s s2umxo3nodoleelfvilsfaDurum nt1tee mo3iaslsDemnvs (0aeenxo3io1opD ai i;s) exoimpoydlm emfes sfsrumx  ou0apt io3iltfaDeluvpnu4 eerxf3oy1opD li s;()s2umxr3ny4opeelivia()srurxront1tpt  ocilsfs el(vs t)arerxr3iy1lm ean o s)s2tmxo3io4ap n fvslt  rrmum ;o4altnmiciydfa uau o ()tetoio3oodlaDrlues;( teum(mpoy4op n ici t) 2rr( pnt0aexn fcils a ean snu4areoxo oo1opteauvo;t0trxr(r nudalt lfctl()sDurur ;u4texn ietyd m2el(vsnu)altnmo oatfmDe i o t0s2trxm ou4lmtnlivilt aDraumonu1oexoifeiyslmDum(ms (4 exnmf iydfmtean o;s0 exm(m3oydal elfeiatf 2tru pno0tltomfcilsfa2ulu p t) etnxo tadlaD  ivol( srxmxr oy1lme mnet (faDumxrp;t1tpx io3tlsfa2ulump;u0 leomr oytfa e uvils)truo(rpnudlp n fcsasf 2uaur ;u4tpx ioctyt aDua( snu) etnmo3iodoaDraneo;s)seur(m oy4lpeemietl(fa2umxm ;o0tlt io3tatfm2ua(vs ()aexomfcoo1faDe u sls) etr(o3oodlme  ivsl( srtmum ;o0alt ii3ildlaDrmums u4tltrxo3iytop e nvsl(0 2xmim nu1altnmictl( srtru pou0tleoif3tltlm ra(mpnu4 rxoxr3tatoa rlivols0srtoio3nydlm  mivt tfarumx onu1altoii3tltfa rl( s;t)artnmfcootomD li s;t) rxmxrpoy4ll n fvtat) 2trxroou4aetoiictad m um(mp t4treoiocoytop  li s (0setoxm3oy4lpt lneiat) ruau ont0optnmfciytfaDulu s t)tetomr iy1lateanei;t seurir3oo4opee ivsa(faDuru oot0opx  ietydfa em(von(4 rtriocoodlaDrauei s t2xmxopou4am   netas) Dtrur nt4apeomoeiasfsDraump u0arxnxr oadfaD  iei t)sexmxr oudolenmnvsasfsDta(  nu4ape if3iysfaDem(vo t4 lxoio todfpDr ies (0srurim oudap e ictatfarurx  nt1tpeoiociytls rm(msnu4trermf iytopD lies t)trur(o3io4lltnlies t)aDtmur ou4tlxnifctad s uanmp;(4tetoif iatom   u ilt0trumio nydlp elfesat  2taxrp;u1alxoif3ils sDrmnvp;u)tetnxo3iy1omDrlnvs (0teurimpiu4al emnvs tfs2rr(rpno4tltnioeildfa emnvp;u4arxoxf tytlaDe u ils0 2xrio3oy4omtnmietasf rrm(mpou1apx  ociad a2raumpn()trtrmrciodlp  ai o;t0seum(r oy1op nmivil(faruax onu4ape ifctadfmDraumsnu4tlxrxf3iytop rai s;t srtrxr3oydop n nvia(  2umu p;o0opt  fcild s umuvs t4aeeomf3iodfmt  ivil() rxoimpny1aptelncsltf Drmurooo1tleomo3iad m2umnvs;t0aexomr totlatrliei t)s2toiopou4apenlfesls) rtmx  no4tleomicildlaDulnmo t0 eeoio tadlaD livs;s  etrxmpoy1lptelfvt t) 2ta(  nu4aleo fctlsls2rmu o;(4altrxrcia1lptelues;(0seur(m3nydllte nctl()srum(m ;t1opxo o3iydlaDemnvo t4arxnir ta1lptranvsl(0 euo(m nodameelfvt t) Dua(ront0tpxomietlslm2ua(vo t)treomr oadfaDrlneols0srxr(r oudap nmfeia(f rtax oot1olxoifeiyd m uanvs (4alxomf3oy1la eanes;(0 2xm(r no1lpt lnvs tfsDrmumo;u4aeenmf3tasfm um( s ()artrmo oa1opDrln i t0 exoiopiy4lltemnvt ()artmu pnt1oet  o3iydla2ul(mo u4artrircto1faDrlnvslt  rtmxo oo1apt lnei t a2ua( ono0apxniociadfmDem(vpnt0 lenir iytlp rli slt t2toxopno1al  mici ()a2um(  ou4apenioetys m rluvp (0tltrio3ty1fat  nvi;s) exmir3iudaleemivtlsf rraxmonu0oet  i3tls a2umnvp;u4 exrmf oadoa r n ils0trxm(o oodlp nlicsl()arumumoot0oee ifcils s2elnvo ()tlermf oytfaDe uesl( tetoirpoydame  fctlt) Drrurono1apto ieils a emu p t)aeeoxocoydop e u slt0 eumxo io4ap elnesas) rtaxm ;o4apxn ieias m em( p u0trxrxr iatlm eaneil()teurimpoydal  lfeia() 2trx pot0oee  oetlslm uaumpnt0arxoio3tytlm  lueolt0setrxopiu1lpt lieiasfsrtm(  ;t4tpe iieias m uau s;(0alenircio1fm rai ol(  etmxopiudal emici sfs2rmx pnu0oee  fcild a rm( pn(4alxrmrcoatlmteli ols tetoimpoy4lltemivia(fsrumurpot1tpeniiciadfs umu o u0 lenxr iydomDr iesls srtoxmpiy1ap  lncta( s2tmump;u1olxomocias s2rlumon()teenircia1lmtelu o;(0t2ur(m3nydlmtnmivils)a2uaxrono1alxoifeiasls2rlums;u) eerif iotlpDeai sl(0seurxo3ny4opt mics ( aDrru oot0tpx  ociatfm rmnmp;(0tleomo iadoptraueo;() 2tmiopoy1alee nciasfs2uaxro;t1oetomf3iydfs2ea(vont0tleoxo3oo1omtr ivi;t seuoio3oydop  mieiat s2ur(m ;u0tlto o3iydla2ua(von(0altoxociatopDran slt0tetoim oy1lptnlnct (faDra(moot1tee mi3iytls2ean s u4tltrmr tydoptrlueo t seur(o3iy4op e feiat aDrrxrpoo1apen feiydlm2uluvsn()trxrif oatlate nvs;t0 ruoxo3iudlpeelnct t  2tmurp;o0aetn o3tyd a2rlnmo;(4 etomo ootopD aieol(0 rxoim oudomte ivsl(  Drm(mp;u4apx mi3iys a2rau p ()alxrir3oadoat luvol( t2uo(opiodap elfvi ( sDumxm nu1oetomfetys mDelump;u0artomrciatfptr ies s)seurio oy4ol   nvs ()sDua( pno4oleomoeias a2rmumo;t0aeeomfcoytoptrlnvslt)sexm(opoo4olenlics ()arum(rono4oetn fcildfs2rlump;u0teerir oadoaD  i ils  rum(opny1llenlictl() rrm(r ou0ole  feiatfsDem( sn(4alxnxo io1fm e nvs;t  etoxmpno4llt mivslt  rur(rpnu0tptoioeiytla2ra( pn(4teerxr to1fp e u s t srxr(mpiy4lmenmivi (  rtru o;o0optniietys sDem(mo t4arxomr iadla   uvols) 2trxo oy4lp nmivtltf Dum( o;t1texo iciydfs2um(ms;t0texomr3oodfpD aivo (0t2xm(rpiydolt  nctlsf Dur(  ou4teeomi3iltfs rmuvo;(0tetrmr3iadlatelues;t) rxmxo nydlleemictasfa2trumo;u0aptnmi3ias m2ea(ms;u4trerxf io1lm eluvil(0teur(r nodopte nvi sf rum(r ;u4opt ifctadfa2uan sn() exrmfcia1lmt luei (  rtmio nu4lptnmncil()a2rm( pot1oeeoifctaslmDuan o u4 rerxf oydfm r u sl(  2um(opnodaptnmicta(f Draxr oo4apeo fciysls2ea(vpn()teeomf3ty1oa e uvsl()t2xmir3nudlp   ivs s srtru pnt1oeto feild mDuau p (4trerxf3oytoaDeli i ()srxoiopiydll emfci t)a2ua(roou4alto octad s2rauvp;t4tetoiociydfmDr u o s teuo(m3oy4lp e ivi (fsDrr(r oo0olx iiciyslm rl( o;u0aleoxo oydoaDraivo;t  etoirpiu4amtelieiat)aDra(mo;u0opto o3iasfsDeln p;t0 eerxfciytlmteaieo;s  rtr(m3oodlmtnmiesat s2rmx pou0alt mi3iyd s rmu s;t0arenmrcoatlaDraivi;s teumxm3oy4altemfvtl(fs2tm(m ;u0olx ii3iyslm ulumsnu4tlxrxr tydlptraivolt truoxm iodlm emnes ()a2tr(moou1opxnio3tad s2em( s u)trtoxf3tatop rlnvi;t)s2tmxr3io4alenmivsat)sDtaxm nu1alxomfeildla2ran pnu0tltrmr3io1fpteanvslt)t2xm(mpoo1omen feil( s2trxr oo1opeo ociydfa2rm(vp t)trtnmr io1fpDrlu o;t trxr(o3ou4altnliei t)sDtmur nt0ape  feiadfs el(vonu0altnir iytlp e ies t  exmxmpiu4ll e ivtas  2raxrpot0olxniiciys mDuluvo u4aetrxociydlpt  u olt t2toim3iudal elici tfartmx ono1tltniocilslmDeln p;u)tlxrxr3iadomte nei t0srtmxo nu4lmtemfetas
\ No newline at end of file
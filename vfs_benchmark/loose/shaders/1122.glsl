@@ -0,0 +1 @@
+nei;s)truo(o oo4altnmfetlt)arrrx pno1aexoiictasfs eauvs t4 lxnxr3totfp rlneslt)trtrxmpoydal n nvt s) rumumono4oee iiciyt sDrl( sn() lxnif iatomt au s;( trur(o nudllen ncils)aDtr(rpnu1aptniietydls ra( o () leoir oadom  ai o;(  rtm(opnu1lpt  fvtltfsrra(r nu0teenifctasls2ua(vo;u0 rxriocoodoa  lu sl(0texm(mpoo1ame  iet sf 2ur( p;u0tetoioeilt s2elumsnt)tetrxrciotfm r i s;t)t2trio oo1lmee icsat sDur(  ;t4oeeoifetadlm2umuvo (4artrxrctodla eaieol( s2xmxopoo4llt  fctl() 2umumpnt1apx  oetatlaDumuvo;u0aexomf oatfp  luvsl(0 rxrxo io4op e ncs s s2tmu p;o4aptomf3tasfmDran pn()aeenmo3oa1om  anvs ( srxoxo3iu1alenlfvsa( s2rm(rpou0alxnmi3ildls2eaums;()tleoirciadoa raieo t) 2xr(o oo1opeemfcsls artau  ot0olt mo3tlslsDrluvsnt)tltnmr3tydfp  lues;( s2umxo3no4omtnlfvi s s2rm(r oo4aetoii3tatfaDuluvp ()tlxoxrciadopDeau i (0seurio3oydomtelfcil(  2tm(  oo1opeoii3iasfm rlumont0aetoir3ty1optrliei;( t2um(m ny1oltnmivs t aDtr( pnu1oetnii3iat aDel(mo;(4trtrxr3iotfmDelivo s s2to(m3nodlpee fcs (fs2rr(r no0tpt ifetyt a um( s;t0aetoif io1omtranei t0setmim nydalee nciasf Dtrx  ot1aleo i3iasfsDum(mpnt0tlxrxocootfa  auvs t)setoxr3nodaltemiesls) 2rru pou0texo ieiasfaDelu o;u4aleoir oytfat  uvols  rxmxm oy1op e ivilt srrr(ront4ope mo3tyd a2emnvp u4 exoio3oytfmt  nvsl() eum(m io4altemfet (  2trx o;o1alenmoetltls el( onu0alerir3tadfmDrln s ()srxoim iodlm  lies ()arrr(r ou0olx ifciyt a umu p t0aexoio ty1fa rli s;t0 2toxrpno4omtemivt (  rrmum no1oleoio3iyt s2uan p;u)aexnmr3to1lmD  i ilt0 exm(m iudlmt  ivtl()srraxm ;o4teen fciatlm uan pnt0altrxo3iy1fatrlivi s0 2xrxmpnodlmtn ivs t) 2tmxront4tlxnmf3tat s2umu o;() lenifctatfpt  ies;s srtriopnudamtnmncslt  Draxmo;u1alx  iciatfaDulu p (0altoxf ia1faDelueslt setmim3nu4ope mnct t aDua( o;o1tpxnioetyslm uluvpnu4 rtomr tadfa e n sls)t2ur(o oy4lpen fcil( a2urxmont4aleomocilsfm2umnvs;u4tlenif3oytlaDrau i t0trumxm nydap nmnvs t a2rr( pno1oeeo i3iaslm2rmnmp (0 rerif ootlatrau i;s) 2to(r nu1olenlnetls aDtmumpnu4tet io3ilt aDrlu pnt0tlenxocoa1oate u il(  exr(r iu4lmt lfeils a2tmu p;o0aexn oeiys s2ua(vs;t4 rtoxf3tytoa r ueolt  2ur(o3oy1lm elfci ()s2rmu poo1tleomf3iatfm rmn p u4artoio3oadomtrauvo;t0 rumxr3iodape licta( s2tmxr nu0tpe io3tad mDeaumo t4 renxociadom e nvi (  2uoxr3nydaleemivi (fsrumumo;u0tpen ocias a2ulumo u0aeeomf3oy1oa r uvo;s) exo(m3io1om nlfetat  Dumxmont4aeen ietld s rmuvs t4trtnxrcootoaD  ieo;t)t2uoiopiy4ome livta( sDtmx pou0aeeoiociat a2rlu p ()altnxrcia1fa eaues s  2trir3nu4al emnetas artm(ronu1aptnmfciys s el(ms;t4teenmo tydfpt aivs t0seto(o oudopt mncs t)srrr(  nu4aet if3iytls2uanmo;t4 lxnxociy1fptr n i;s t2toimpny1lmenlneilt sDta( pno4altnmoeildla emnmon(0 renxfciytlp eli ilt t2xrxr io1opt  fvs tfa2rruronu1oeto i3iyd sDrlump;t0trerxo3iodlpD  n ols0 2xmxo3iu4lmenmfvi tf 2tau  ;u1olx  iciatfs ulnvo ()texoirciytfp  ln s s srtm(o oodlm emfvias  2tmurpot4openii3iatla2ua( s t4teeoxr3iodlpDelnvo;( t2ur(m3io1op   nctat)sDuax  ;o0tlenii3tadlsDul(vo;t4treoir3iodop  lu o;t0 2uo(m3iudope lncs t)s2rr(r ;u0oee mo3iytlsDeluvs u4aexnmf3oatoatr ueo ()t2xo(r3iudopt  ncsa(f Dra(r nt0tpx  ociydlm ua( pnt0tetrmr3oadopDe ieolt)trumxopiodole lfvtlt arua( poo1oleomi3iatfs2ra(vp;(4aetoir3iodoat lieil() 2xoxr nodlm elnci ()sDra( pou0aexnii3ils a2el(vo (4alermf oo1lp raiei;s0srto(m3iudale lfetls) Duaxrpnu1opeoio3tasfsDeanvpn(0tlenxfciodfmD auvo t  2toio iydal   nvtatfaDuru ooo0oeeoio3tas s eluvs t4aexrmocoa1op r iei;t trto(rpno4ap  miet () Drr(r no4oeto octasfsDrlumpn(4 eenmo oo1oatelu ils  rumxopnu1lmt  feiatfsrrrx  no1aexnii3tldls2ua(mp t)treoxoctytfpteaivolt)s2to(rpny4am   ivta(  2rm(mpoo0alt  o3iyd aDel(vpnt)aexnxociydfp   ues (  eum(r nydopte ivtlt)sDumxm nt0aetoioetadfs2uln o t)aleoxr3iatom  luvils) exr(mpiydapeemivs t)aDrr(r ;u0altn feiltfaDelums u0aeeomocta1la rlu s ()t2xoxr iudap  lfeiatfs2tm(rooo1aeeomf3iyd a2el(von(4 exomocty1fmDeai o t seuoio3iy4lmtn nci t) Dtaxm ;t1oexn ieiys m2ra( on(4arxoif oytlaDeauesls  rurir3no1lme mnctls) rrmu ono4tet  fcils mDrmu p t0artoxo3oadlp  aies s  2tmxr iy1omenlfei tfaDtau  ;u4alt ii3ildls2rl( o u4alxrxr3iytom e ueo ()srxmxrpiodopenmnctl()artrumpno1alxn f3ias s2um(vo u)areomr3ia1lpDe ieilt trxrirpno1llen fvsat)artaxro;t0apto octytlm uluvs u0arxoifcta1opDe ues;t  rxmio3nudlmeemfvslt a2tr(mpot4tlt ii3ild s elump u0tleoif todlatranvo;s) 2toxr3oy4amt lnes (f Draxmo;t4ale iieiatfm2uluvo (4tlxnmocoo1om ran sl( srumxm3io1omtnlnesasfsDrr( p;u1alt  ietysfmDemu s t4tlxnxoctatlm eanvo s tetm(o3nodop elieslt)sDuaurpoo1oetnmo3ias a2uanmo t4 lxrxo3iodlaD  ues;s tetmxo3iydope lies (f Drr(m nt4altnmoetad sDumnvpnu0 ltrxoctadlmtraivil(  exrxopny1lptn ncta( arua(mpou4altniociltls2eln s;u0alenmo ia1omt an sls)srtmimpio4lp nlfcslt)a2uau p;t0aexn oeiytfm rlnms u)tlxnif iatoat au o;(  rtoio3oy1lpeemfvils s2rmxr nu1apx if3ild m ranmsnt4aetnir3ty1fa rluei;(0srtr(o iudap n nvtat) 2umx o;o4tleo f3iytfaDrm(vs (4 eeriocoydlp  anvsl()texrxr3nydlm emfvs sfs2taxrono4tpenmietys mDum(vonu)aleomr3iydlmD au s ( t2tm(r3io1llenlfcia()srrru p;o1tptniieiysfmDulums t4 eenxr oydomtelieols s2urimpoo1oltelfetlsf rumuront0aex ii3iyt aDea(vpn()arxrmo oa1fm r uvi t0 2uoio3iydlptnmnvs tfarur(mpoo4oet if3tad s2ra( onu4teenxo3oydlm  ai ilt0teuo(r ny4lmee nctlsfsDrm( oou0teeomfeiysls2uanmo;() lxrxocoy1lm  aues t t2tr(o3iu1omtn ivi sfsrurumpot4tlxo i3iytfm2rmnvs (4aleoxr oytfa rai ol(  exrxm3io1olee neil() 2ra(rooo1aeenifeilt aDelnms;(4tetomf3iotomt  ueo ()srxo(r oo4lm  lfei s s2rrxmoot0opeo icilt aDemnmp;u0trenmo3oadoa  lneilt  eumxm3iudol elnvt t)aDumxm nu0teen o3tldlmDrl(vp;u)aexnxo3iadfatr i i;s0teumio io4optemnet t aDumu p;t4tex mi3tlslaDul( p;u) exrmfciydfpDe neolt0 etr(opoo4ole  fesa()sDtmxrp;u1apenio3iytfaDrau pnu4trxoxrcoo1oateluvsls0 etrxm oydamtemfviasfsrtmxm ou4optnmiciytls2eaumont)arenmo3iatfm e iei;()s2uo(r oy4lp nlfvi t)aDra(mo;u4aexn i3iytfs2uluvp ()alermrcoadfa  aiei;t) 2xmxr iy1ape  fvs () rum( poo1oex mictytfm2umuvs;t0aexomfcoydomD auvs;t)trxmxo3ou1amt licia(  rtau onu0oltnmoetadfaDem(mp;(0 rtriociy1om raueilt sexoxr3nu4lpe lfvtlt)srtau o;o0tpe ifeiys aDrmnmsnu0 rxnxf3io1oaD  nesl(0 2tr(rpiy1lleelneslt)sDtax ont4oetn oeiat a2uau o ()alenmo3iotfaDrli slt  2ur(rpoy1altelneiltf 2ra(rp;u4opx mf3iysfm uanmsnu)aeeoxfcoydfmD  nvsl()s2xoxm oodlmt lfcta()a2urump;t4ope  f3ild s2emu p t0aeeoxf ty1lp  li il( teurxr oudap elfciat srra(mpou1alxoif3ildfa rl(vp;t4trtnmf3todoaD lu s;t0tetoimpou4lp   ncsat a2taur ot4alenmo3tysfa uluvo;(4 renmr oadomDean s;t0t2xr(r nodoltn nvta( s2tmurpnu4oltnifetldls eaumsnu0 ltoxo3tatfat luvi;(  rxmxo3oy4om  mnviat srtmx  ou1olxomi3tytlaDeanmo;u)tetrxr iydom eau s s)t2tmxm3iodop elfcsas srtmx  no4aleomi3tysla2uanms;()aeeoifcio1la r nvilt0tetr(o oudap nlnci (  2raum ot0alen iciydlmDul( p t)artomrctydoa r i s;()teto(r3iy1al  mncils aDtrur ou1teeomo3tyd m2ua(vonu)trenmo ty1lpDeau s s)s2xoimpno1lmeelfesltfsDra(mont0apxoiiciydla2umnvo u0 leoiocta1fm eau ol()setoim3oy4opeelfesa(faDtaurpnt1oee ioeiytla2ran s;t0tetomociy1faDeaneo;s0sexo(mpiy4alen nvil(fs2rmurp;o4apeoifciyt mDulnvp ()trxrif3oy1la e i o;()truo(m3nudapenmfvtls sDrrx  ;o1tee  ieiltlm eau o;t4teeoif io1opDraivo (0trxoxr3no1llt  fcs t) Durxm ;o0aetnmfciasls em( p;t4alxomf ty1omD aueo t0s2xr(mpnu1ole livtlsfarrrxm ;o1tex  o3iatlaDul( sn(4trxomfciatlmDe n o;t srurio oudll e ncs t)aDrm(r ou0tlenmfciatls emnvp t)artomr3ia1fp  luvils) 2to(m oodlpenlieil(  2umx o;u0apx iieiyd aDeanmsnt4 ltrmf3iydlat lnes s)s2uoxm3oo1ope lnvi t aDurxr ;u0ale mo3tys a2uanvo ()aetoir3totomtrluesl(0t2urxr3ou1ope lictltfs2ua(  ot1tlx iietls s ua(vpnu4 etnmf3to1la ran ols t2xm(rpio1ale  ivs t) 2ta( poo0tex  fciys mDrlnvont4 rerxfciy1oatrai slt t2xo(rpou4lle mivsl( arrauroou4optn ictldla2uaums;u) rxnmf iotom rlnvi;()setmim iu1aptnmies t aDrmu  ;t1olxnmo3ilsfsDraums ()tlermfctydlm rlivi;s) 2ur(r3iy4lptn fct t arurumpno4alenifciad s ra( p () rermr iydlatrliei;t)truoirpiu1lleelncias)srrrxmonu0tlxo f3iaslmDel(ms;t0 ltnxf3oydoa eluvs;()trxmxrpny4ap emivtl( srtrum no4teeo iciytfaDumuvsnt)tlxnmrcoy1opDeaivols  etm(opou1apte nesas aDrax  ;t4oexoifeilsfa rlnvpn() etrmf iotomt ai ols t2xrim3oy4amenlfeilsf Drrxr oo0oet ii3tytlm em( s;t0tlxrxo3ta1om  lu s t  ruoxo3nu4lptnlictls aDurxmo;u4tle  ieiadls uan p t)texrxrciadlp raiei;t s2tmim3ny1op nlfet sfaDrmxm ou0aetn fciytfs eau p;t)aetrir3iy1oa r uvi s) etoiopoy4lm emivils srtau o;u4tlx iieiltfmDemn s;(0trtomocto1opDr nvol(0truoio oy1lptelneias  rta( pnu4tpx moctlsfmDra(mp t4trermo tadoaDrlueils0s2xrxmpio1al e nvtat) 2ra(mpnt4oex  o3ildlaDuanmp (4trxnmrcty1lmtelu ol() etmxr3ny4lmtelnvs s s2rrumooo1aeen ociytls2ulnmsnu4tltomr iydopD auvi s0texr(opno4al  mics t arrrur ;o0altoiictasfa umn o t4 rtoxr3oydfpDe ivs s0trtr(r iodap  lfvia(f Dumxroot4tlxn ieiaslmDemnvo;u4artnifcio1lpDr n ils t2ur(mpoo1altnlfvi ( aDuaxmpot4opeo i3iatfs rluvo ()areoxo3oatlptrli il( srtr(opoo4ame  netat  rum( ono1oltn feiadlm ea(vont) ltrmo3iytlm r n o;s) rxoxo3oo1om elnvi ()s2ta( p;u0tle ioeils aDrau o;t4 rtnxociadlptraueo t t2tm(r oo1ome licslsfa2um(rpnt1opxniiciltfm el(vo ()arxrmo3tatfp rauvsl(0t2tmim3iudlptelfes t s2umxrpnu0apto icildlmDeln onu0 lxnxr ootopDr iesl( t2tr(r3io1ape mnetltfs2urur ;u4aex ifctyd a eln o;(0arxoir iydfptelneo s0t2xmxr ny4apt mieias srumurp;o0oltn feiatfmDuauvo;()artoio tadla eau s;(0t2xrxm ou4lptnliesas)a2taxmp;t4oetomfetlsfa2eanmpn(4altrio3oa1oatr nvs;s0 2umir oo1lmeelfeiltfsDtmu o;u0oeenmo3tasfaDrmuvp;() lxrioctytop rai o;(  rxoirpnu4omt lneta(fa2uaumo;o1tpenifetysfaDrluvs t0 ltoxf oodlmt lieo;t) 2trxo oy1amtnlictls srtaxm oo0aetomoctld m2eluvp (0arxnmf3ootoateanei ( seumim3nu4olt  fcils)sDrrum no1oltoiociyt a2eau p (0arenxfcoo1opDe ivi;( sexr(o oydolen nvt t)arumum ;u1aptnioetadfs2uauvs;u0tlxnxr3tytlatrlnvo;t setmio no1op e iciatfaDuru p;u1oetnmi3tatfs uaump;u)alxoxr3ootoaD  u s t  etm(o3iu1llte ncs tf rrmum ;o4texoiieiad s2ea(ms u4teeomr3ty1fp  luvi;() rxmxo oy4ol   neiasf Duaxmo;o0opto fciltlmDuau o;t)arerir3io1fp raues;( t2trxm oo1alenmfcil()arrmxm nt1oee mociytfs2eln o;() exrir oadom  lu s t) 2ur(o3nudop e fvs ( s2tmumo;t1apenioeiyt s el(ms;u) eenxociydop r nes s0setoxm3nydapen iciatfsDtrurpoo1tpe  ociys m2umuvs t)trxnircio1fatrlu sl(  exmxr iu4ol nmics tfs2trxrooo4alxomfciltfs2elnvp () rtomocoo1oa elnei ()teumxr iu4ale mnvsls)srtrump;u0olto oeildls rl(vo;t4artrir3iytlatelivi;(0s2tm(o3iu1altelics s)arra(mpnu0opxnmoetad mDrlumsnt4trtrmr tadopt lieols s2xm(o3iodameemnesat) Dumu  oo4tet moetys sDrm(mont)tltrmf3ta1laD  u o;(0 eurxrpnodopeemfci s)aDraurpnt4tpxoifciatfaDuau o u)altnmr3todoptelnei t) 2xo(o3oudope lfctlsfaDtmx  ;o4alt ioctlt a2umuvp;u4treomf oa1fmDrai i ( s2toxopoudlptemfvs sf 2taxm ;u1oeenif3iyt a2rmuvs t0 exnmf3oy1omt anvo t) rurxr3oy1altelncil(fs2rrurpnu1opx moeiasfa2um(vs ()altnxf3iadlpte nvo;t t2toxm3iu1al   ieiat  rta(mont0olenmf3tadla eanms (0texoxo oodopDeanvolt0tetmxm3iu1al e ivtlt)srrrxmo;t1aetn oeiysls rln p (4aeermrciodlm e uvsls trxrxopiy4openmietas a2urx poo0tpe ifetadlsDumu ont)aexrxo totoa r ivi ( t2uoxopiu1lmtnmnvt sfsrtmxmpou0altnmicilsfsDea(ms;u4 rxrir3tytopt  ueo;s t2umxr no1am nmictas)s2trx oou0aex mf3tat m uln p;u4aexoxr3todfmD  ies;(0trtrim3oy4ape lnvt (f rtrxro;t0oltoif3tat a umumon()artrio iy1lpD lu sls sruo(m3nu1apee nctlt) rum(rp;u1olenifetysfsDrau p t0arxrir3tadlp r uvs ( t2xmim oydamen ieiasfsDrrxr ;o1aetoii3iatfs rlumsnu4trxnio3iy1fa  au i t) 2xm(o3iu4llt mfetltfa2rrumpno4oeenif3iadls eln p;(4 renir tatlp  luvi s srxoxr3oodlmtelfvi t) 2ua( ont4aptoioetydfm2emu p u)tetnifcoytlaDe nvols) 2umxm no4altemieslt  2taxroou0tlx mo3tys a em(vonu0trxoircoadoaDeluvo;s)s2xrxopou4olee ncsat)sDtrxrpou1olx if3iltlsDemnmon(4 lxomfcoo1fmD  u s (0t2uo(opiudalee icilt)sDtr(  nt4aeeomiciadfs uan o;u0 rtoifcoodlptr i ils)sexo(m oudlmee neil(  2tmxronu4tlenmiciltlm2umn s (4 lerxo oadoat  u ols0 eumio no4lm  lncil(fsDua(  ;u0tpeoio3iad m2em( o u)arxnxociy1omDelues ( tetmio3nydomen neilt sDuaxro;o1tltomiciydfmDra( p (0aeenmociydfm r nvilt0truo(mpnudam emnvsatfsrur( o;o4opxomfctys a umnmonu0 eeomfcoo1lpDe ies s0 rtm(opnu1al  lnvtls)srur(m ou0ale moeiasfs umnmsnt) etomo ootomDrlu olt0seumio3oydllt  ivtas aDumx pnt0teenif3tytfm uauvo;u4 renxf todfm raieols0 etrxr3iudopt miciltf 2raum no1oeen o3tldlm umu pnt4 rtnir3iy1laDe uei;s0s2xo(r no1apte fei sfaDrrumpnu4oetnmo3tltfaDrmnms u0 lxomociy1opteauei;s)teurxmpiu1ap nmieslsfartm(r ;t0aexoii3tld aDul(vs u4aexomr3tytfatrlivsl(  ruoxo3nudamtelfes t)s2tmu  ou0texnmi3tyt aDemn o u0altoifctotfm e nvi ( t2xmxr nu1om  mict sfaruru  ;t0tlx  f3tltfm ranms;t4artrmo3iydfp e ieilt)setoio io4ap emfctlt a2taxr ou0tet io3tltlaDra(vsnu4alxniocoodfmtranei;t)s2ur(mpou1llenmfvsl()s2tmxmo;o0apxniocils m uanms;t4texomr3oa1lpDr nei t) rurir3iy4lpee nci t a2ta(rp;u4oltoio3ilt mDulumpnu0arenmf io1opt lneo;() 2xo(m nudlmtemfctl( aDum(  ;u0ale  o3ias m rlu pn()arxnxf3iatomD  nes;s0 rxoxrpnudol n nci (  Duau oou4apt iiciadla el( p u4 ltniocoy1oaDr n o;t  euoim3nu1lpen ncs () rtr(rp;t1tlx  fctls s rlnvo t)arerxf3iytop rai i s0srum(o3oodome lneias  2ta(mp;u0oltnmieilsfa2eauvs;t) eeoxrctadla rlieils  rxoirpnu4lp e fvtlt s2tr(m ;t0oeeoif3tytfa2rlnmonu0 rxoxf3iatlp eaneo t0t2toim3iodoptelnvslt a2ra(roou0aptnmocildlmDrm(ms t4 ltnmrcoadfaD auvo;()trtmxo iydamtnlncslt)sDrrurpnu0olxoiociydfmDul(mon(0 exnxf ty1oa  lies t) eum(mpio4aleemneta() rtr(r ot4apeo icildfmDrln onu)artrxo ty1lmDraies s) exoxopiudoleelfetls  2trxm nt1opt  oeiytla2rau o;(4alxnir iotlp elieo s0s2uoimpiydomt mieilsfsDum(rpot0texnmociltfs2raumpnt0 exnmr3to1fpDeaivs;s)texoir3nu1lltn nvtlsfsrrmx pnu4opto oeiltlm2eauvsn(4arenif oadlm rlneilt0tetmiopiy4omt mnvsa(  Draxr ot4ole  ociatfs2emn p (4tleoxrcoydlpD ln s;t0t2tm(o3oo1omtelnvt (  2tm( pot1olx  f3iat mDrlump (0trenmrcta1lmt aneo;s s2xm(opnu1amt mfvtas)a2tm(mpot0ale  o3iysfm2eanvs;t)tetomf oodfptelneo s setr(rpiu1lmenlnesls) 2taumont0alx  o3tad m2rlump u) exoxo3oodomDeaivslt0 2umxopio1lme mivil(fs2umx  ou4tle ioetas sDem(msnt4artnifcoatfm e iesl()srxrxopno1ale mivsasf rum(rpnt1olxo ieiysfaDumums;u0tlxomf to1opD  n ol( srxrir3oodam nmnes s sDumu onu0altnmi3iasla2emnvsn(4trerir iytoaDr ueo (0 2tmxm3io4opt  fct t  Drr(r nt0teenmf3iysls2emnmonu0tlxoxo3oadlaDr u sls  exrxopnodaptnlfvslsf 2um(  nu1apen ieiys s2uluvsn() rtnxo3oytop  aueslt  2xo(r ny1amtelictl(  rrm(m oo0tptnii3tydfs2rmu snt)tlxomrcio1omDrlnei s  2xrio iodamtn ncsltfarrmurpoo4aptoio3tadfaDrmnvsnt4aetnmr3tatlm  lies;s0t2trim3io1altemiet t sDumumpnt1aet  i3iaslsDul(monu4altnxr ia1lmDeaivo;(0 rur(opiu1om nlfcsls)a2um(  ot0apxomoeiytlaDumnmonu)texnir3to1lp elneil(0 2uoxo ny4ale mfcia(  2urumo;u1ale moeiltlm ua(mo t0 etoifciy1fpDe n o;s0 exoxr ny4aleemivsas  Durxro;t0ale  iciys a2rlnmo t4arenxf iydlmDe i s;s0 rumxo nu4lm  mnct ( sDta(r nu0apeoifciatfm2ean o;u0tltnmocoodoatrlneo;t  2xoim3iodapeemici t arrmu  no1alenifctydfa2rm( p;t)tlxomo iotlaDeaueo;s) rumxopiy1ll n iviltfsDtrxm ;u4tleomocildls2umnvont4alenmf3totomDr nvils0srtoxr3iodll emivsat) Drmxm ;u1tpxnifciysls2elu p (4 rtrxo oatfp e u ol( t2uoxm oo4ole lieia(  Durxront4oetnmociyt s2rluvp;t4trxoio3io1fa e uvo (  exm(mpio4op  mncsl( srtmxr ou0opt if3iadfs ea(vpnt0 eenifcty1fatrlivilt)s2xr(r no1lmtnlnvi t) Dtmxrooo4aexniictasls2ran on(4 rtomr3iytfateliesl(  2tmxm3iy4lm n icias) 2taur nu0alenifciytls el( pnt4teerir3ootoatr nvs;(  2tm(m3iu4apt mnvi s) 2rru pnt0opx miciydlm2eluvpnu0alerifctodlpDraneilt)trto(o nu1aptnlivia(fsrurur no4apxnmfetytlaDrlump;u4 eermf iadoa e nvs;t setmxopnudlpen fcsasfsDtmu ont0tlxn f3tyd aDrlu s;u)teeoif iadlmD luvol( trtoxo oydlme mictltfs2taumo;t0aet iiciytlm emu s;(0aexrmocoytfa rli slt)trxo(opoydom n ivtat sDta(  oo0openmiciaslmDuluvpn()tltrmr io1oaD anes;t0 2uoir io1ole  nvtasf Dur(ronu4tltn ictas s2ra(ms;t) etrio3iytoptelneo t) 2toxr3oodlltelfcs t s2rrxrp;o1aexomi3iat a2uluvsnt)tleoif3ootfptrauvs;t)seuo(rpnudomeemnctl() rur( ont4oexniieiltfmDumn s t0aeenir iotlmt aieo;s sexrimpoydapt  nvs s) 2tr(mp;o1aeenmi3iydlmDuln s u) exnir3totopte n ol(  2tr(rpio1amenmfeils  rur( onu4texn ociat a2elnvpn(0aexrxr iadoaDrlnvilt0sexrxopnydalenlncia( aDrmx ono4aeeo o3iytfa rln s ()artoxr3oodfptr nei s0 euoim oodlp  mietl(f Dra(rpoo4teto ictltla uln pn(0 etomrciadfp ranes;s s2xrio3no4lp  lfct tfaDrrxr ;u1tltn octysls2rmnvpn(4teerxociotfmDe ivs;t)s2uo(o oydol n fvsat  Dumu o;t4olto octyd sDran ont0 lenirctadfmtr iesl( trum(r oo1lp nmies s)srtmxro;t4tet mi3iltfaDumums;u) eerxo3iotopteanvs;s  2urxo3io4ap e nvi t)a2rm(  nu0tlx mocias m2rlnmon(0 rxrxr3oatlmtrlnvo (0 rxrxr iudoptnlieil(  Dumxm nu1olt mi3iydfa eanmp;u4trxnmo ty1fp elu i s0 eumirpoo1oleeliet s s2tr(rpot1olx ii3iysfa2rl( s;t4 ltoifcio1omDelieolt)t2xo(rpiy4lpe lfetltf Duax  nu0tlxnio3ildfa2uaumon(4 rtnmr oadop  lu o (0s2xoir io4llt  fvtl() 2urx  oo4oetnifcias s rlnvpnu)altoxf3oytla  li ol()t2tmim nu1ol nmnesas a2rrx o;o0tpt  ocilt mDulnms;t0 lxnxo3oadoptranvo;s t2ur(m nydop elnvsa()aruru  ou0aetnio3tltfs2ulump;(4 rxnif tytlmDe ues s t2urim oo1opee ivi s) 2uax  oo0oee mo3iytfs rm( onu0arerxo3ta1lpDelu o t0s2tmxopno1lpe livi ()aDraumo;u0tlxnmietysfs2uluvo u0 exomr3iodla raueo t  eurxm3no4om   nvi s)a2umuroot0oeen iciasla2rmumsnu) rxrxfciatfa eaneo;s trtrio3nu4apen nvs tfaDumuront4opt  iciys sDulu o t) ltrxrcoydfp eanvol() 2xmir nodllenmnvt s)a2tmumo;t4tleoifeiys m rmnvo u) rxomociotoa elnvols  ruoxo3iy4ap eliesas  2rr(rpnt4opt  o3tatfsDumnvp u0 etnxrcoo1lmt auvo t0texmxr nodopt micsltfsDrmu  nu1tptnioetydlm2rluvp u4 etnmociatoa eauvol() 2xm(o3iy4lle mietas sDtrurpou0tlx  oeils s2emuvpnt4trenmo3iodlaD livo;s0 rxr(opoydalen ics () ruaum nt1oexomietatls2em( pnu0trtrmr iotomD aneo s  exoxr ou1aptnlfei (f 2rmx p;u4apxn f3tldfm2uluvo;(4 exomociotomDeauvi;()t2urxm oy1oleemnvsas a2tr(monu0olxn i3tytfs umn o (0 rxnmo iydfm rluvs s trxoxo3iu4ap eliet (farrrxmp;t0opt  o3iltfa2elnmp u0 rxoxr iytfp e ivs t0srtr(r3iy1ol nlietat)aDurxmpot0alt mfeiat a ulnvp;u)alxnxf3iy1fp ranvsl()teum(o3ny4lptemncia()srtr(ront4teenmo3ilsfa em(vo;t)trxomo3iytla e u ol(  2tm(o ny4ap   nvil( aDumuroot4tptomfctlsfa rlnmo;t0 exnif iodop rauvslt0 rxoxr oy1ape  fes ( aDrau  nt4oex io3tysfmDem(vont) lenxo oydfpD aneo;s0s2xm(m3iudapeemfcsa(faDum(root4tptoiociaslmDeau p u)tlxnir3tadoaDraieil( teur(rpiu1oltnmict s sDtrxrp;t4olt io3ildfmDrmu snt4tetnmr3ty1fp elneil(0texoxo3iy1alenlneias arrrx ono0tpeoio3iad s el(vp u4alermfcia1fmD aies t0s2uoiopoydlltnmics t) Dur(root0ope ifetatfs rl(vp t0aleoxfciytlmD aivil(0truoir oydomtelfvtasfsDua(r no1tpeniociytla2ranmpn()alxrmf3ty1fa r n o;t0sexo(o3oy4ol e neslt a2urx ont4teeoioeiytfaDranvonu)texomociy1laD lies;s setr(o3io4om  mnvsls)s2urxroot1opeoioetad mDumnvs;(4 rtnmf ty1fm  an s (0 exrxm oo1om e fvi (f Dur(rono4aexn ocias a2em(vs;t) lxnmr todfmteaivol() 2umio oo1op emiesl( s2rmxm no1teenmociytfa rl(vp t4arxoxr3tydlateauei (0srtrir io1lmee fet ( aDumumonu4tpe  iciydlm rlnvsnu4 lxnmf oodomteai i t) ruo(opoo1omtn nvs t)srtm( pnt1alto o3ildls rauvs u4 ltrmrcoytfate neo s)teumim iydalte fcia(  2raxroou0tptnmfcilslsDel(vs ()tlenmo3iydomtr iei;(0trtr(opno1olen nctlsfsruau ono0tee ioctytlm el(monu)altrir ootla r uvil(  2xo(r iudaltnmietl(farumurp;o4opxnmfctadla2eluvp;t4tlerxo3oydopDrlivslt) exrio io4omtelnvs ( a2ur(r ;u0alxoifcildlm2uan o;t0artrxfctodlateanvolt srurir ou4apeelfes ( sDtm( o;o1tpxnmicils s2umn pn()aexoxfciodoaDrluvsls)trxm(o oy4alee ietlt sDurxrpot1aee  ietasfa2uan pnt) lxnmr3oy1fpDrlivs t  exoio3nodlp  mfes sfs2uauro;u0optoii3tydfmDua( s t0texoio3ootlpDrln ols) rxmxo3iydlp nmicsls  Dtax pnu1open oeias a2eaums;(4 etnmf ia1omtr i o;()setm(m oo4lp e fci t srrru oot4alx  ociysls rlu s;t) leoir ty1faDr neslt) ruoim ny1olenlnvslt)srrau  nu0aexomoeiatlm2ul(mo (0 rtrxf3oy1faD  uvi;s0 rtrimpiydol  miviltfs2ua(ro;u1texoioctlsfa elnvsnu4tltoir3ootop rln s;t)sruoim3ny4optnlfct sf 2rmur ou4oexo f3tat a rau o (0aetrir3iatlp rlnvilt)seumir oudopt  fetat) rtau  ot4oeenmieild mDeanmsn(4 lxnxo iatlpt livsl( t2uo(opnydlm e neil() Drax  ;u1alxnmociydfmDea(vsnt0tlerir todomDrlnei;s)teuo(o3iydam nmfes tf rrr(rpno0oexomfcils aDeaums;(0 rxnxf ty1lmDrau i;t tetrxr3ny1om n ictatfs2rr(m ;t1olt  icils sDeluvon(4alxomocoatomtelneo;(0texrimpoudom e ieils)aDtr(m no0altnifctatfa uluvs;t0aleomfcta1lptelueo;s0 rxo(r iydop n icsls sDtr( oot1olenif3tls aDea( p;()aetrircoo1lp  lneo t srumxopou4lltemnvsa( a2tr(  ou4texn feiyd aDrm(mo u4alxoiociatfmt anvo;(0sexr(rpny4al nmivtlt s2ta( pno1aleoifciysls2ua( p u4aeeoxocia1faDraiei;(0t2tm(m ny4al  lncslt s2tmump;t4olxomf3tyt m2rln o u)tlxrxr ta1latr iesl( s2uo(m3nodlleelfvt s s2uaurp;u0tex  feiad m2eaumsnu0trtomo totfpDrlnvi;s)t2umxo oy1ape livtlsfsrrrurpoo4olx mi3iysfaDumnvp t)trtnifcoa1lm   uvi s trurio nu1am nlivsat  2raumpnu1olt ioctys s rmnms;(0 lenxo3todfaDeaueol()trtoiopoydlpe lfvsls  Drmumooo4tpx moeiat s uauvs;u4 leomrcto1lmDe i i;(0 2xo(r oodlleelfvslt s2tmum oo4tlt  ietldfs rmuvs t0aeeoir tydfmDeluvs (0srtrxm3oudaleemfvia(fsDumu o;t1opeoiictldfs um(vo;() renxfcia1laDe n o t0srurxr3no4altnmnctas)artmx pou1alx iiciysls2rlu s (4 ltoio3tydlpD luesls)trxrxmpou4ole mfviasfsDtaumpnt1apen o3ildfa2rl(mo;t4 eeniociytfp   ivi;s)setrxopno1omen nvtatfsDtmxr nt1opx ifctas a rmumo;(4trenifcootfmt ai o s0trtoxr iydlmte ictls srtm(m ou0oexn oetat a2uln s u0alxnxf totoateluvols) eto(o oo4lp elnvtls s2umu p;u0ole if3tlsfs ranvp u0 rtnifctotfateauvsl( seuoxo3oy4om  lnviat)artaxrpno0opxnif3tydla2umnms;t0 etomf tadlp  lnvs ( teur(mpoodol  mfetl() rumxmoot0alxomieildlm2eln s (0artrxf oodomtraivo;t setmxo nudame livtl(f Drm(r ou4oleomo3iadfaDrl(vp;t0aeenmfciodlpte nvo t)tetoio ou1amtemnes ( srtmxmoot1optn feiytlsDua( sn(0trtnir3iadlatr i s ()trxoim io4lp  lnct t aDuax pou1tpe iociydfmDrmu pn(4artrxf ta1fa r neols0 2tmxm ou4lpen fvta(  rtmu p;o1alen oetld s2uan p;()tlxnir oo1opD auvsl(0t2xmxm ny1ll  mnetas) 2rr(  ot0aee ii3tltla el(mo;u) lxrio3io1fpteai s;()s2tm(m oodolenlfei t)a2taurooo1tee ioctltlaDrl(vp;t4aleoxo tadfp rlivs;(0trxoxr oudlm emfcsa(fsrrau  nt0oexomi3tydlmDemu snu)altnmf io1fpD aneo;s0setmxmpoodolt mivt s s2ta(  ;u1open f3iydla rluvsnt4tltoxocoodfaD  ueol(0t2xoxo oodlmt  icils) Dtaxr ot1olenmo3ilslmDumu p (4tleoirctydop raivs;()teto(m3no4aleeliesls artaxront4tlx ii3iatfs2um( p (0 rerif3iodoaDeaues t t2tm(m io4lle mfei ( aDtmu p;u0aex  fciatfmDulu o;()tetrir ty1omt lnvilt0t2xo(rpiudlm  mfcias  rrmu  ou4oeenmietat mDeaums u4texnmociodlpD anvi;()t2trxo3oo4ll nmnvtat)sDtmuro;o0apenioctytfa2ulnvo;(0arxoir3oa1fp rlieilt) rurio3oy1ope mfvi t a2rm(mpno0tptoifeiltlmDrmn p t) rtnxrcoo1laD anvils0seumir3ny1lm  mnctlt)a2ta(  no4tpen octytlm rmu pn(4 exnifctatlmDeln o t teuo(m nu1lmenmfciltfs2rm(m ot0tlt moeiatla umnvp;(0trtrif iy1fmD aueolt t2xm(r iy4ap nlnvtatfaDumur nu0texn oeiadfm ua( sn(0treoifctodlm rlnvo;(0srtm(mpiy4altnmfvsl()s2tau ont0apt mi3iatla rlnmo ()teermo3tydfpDrlu olt teum(m3nodllenlicsat srtax  ou0tle ioetytlmDumump;(0tlxrxf3oo1omtr ivsl() 2trim3nu4aptemfes s sDra(mp;t0apx mociydlsDumuvsnu4artrxo3oytom eanes;t seuoxm oy4llt livi s) rrr(  nu1tex iictadlmDua( p;()aexoio tatlp r ieolt)texoio iydolenlfvia() Drr(mont0apt mociatfa2eau sn() lxoifcoatfateliesl() rxm(o ny1ole mnei s srtmur oo1aee moctytls2uln ont) lxrxr3io1faDeaneo;t) eumio3nu1amt  fvsa( aDrr(rpou1olenmiciatlm2elu pn(4 rxrif3to1lpDr n s;t)srxoiopoy1ll  mnetat arrr( pnt4alxomfeiad sDemnmo t4tetnircootlaD lneil(0sruo(r no1optemfvia( sDtmumooo0tex moetytfm2rauvs;t0tleoif3oa1om   ieo;s  2xm(r3ny4omeemfesl(faDrmum ;o1oltoiiciadfs emn p t0altoxf3io1lptrlnvo ( trumxr3oy4alt  ict ( sDtaxm ou0apxoioeiydfa2rlnvont0treoir iodlatrluvs;t sexr(r3iy4lm   nctlt a2taumpno4tpxn fciadfmDrlu p;t) etrxr3tytfpDran il(0 2xrir3oydlltnlicslsf 2tax ont4tlx io3tldla2el( o;(0texoxo oadopte ueol(  rur(o3io4ll   nvsatf Durur no1aleomiciasls2um(mo t4altrmr3todlat  uvilt) rtm(opoo4amenmnes (  rrau pnu0apt iociasla2ea(mp;(0aexnxr oodoatranvi;t) 2umir nudaltnmfvsa( aDum( ont0tptniieiad m2ra(mon(4 ltomo3iydlmD lieslt)t2tmim ou4ap   fcsasf Duaur ;o0teto i3iatlmDul( o;(4 rxrif tadlpD lnvil(0 etoim3io4om elfctat)arua(rp;o1teeo oeiydlm eanvs u4artrxf oa1fmte neslt0teum(mpiudlp nlivtlt srua(monu4aetniociat s eau pnu4aetnmf3todfp eaies;t0 2ur(m3iudlptnmfcs tf 2rmxr ;t1tpt  fetls a2rln pnt4 exnmf3oa1fpD aieil(0teuo(r iydolee neia(fa2ra( pot4ole if3tytfaDeauvp;u0artnir3iodfmtelnvi t trurir oo4omeemiei s)a2taur ou4apenmi3tltla2elu o t4altoif ootomteluvs;t0srtm(rpio4lmt micil() 2um(mpnu1altomo3iydlmDeaums;t0aleoxo3oodfa r neo s)srtrxm3ou4lptn nvta( a2rax pou4oexomfctas mDrl(vpn(4artomo3ootlptrluvi;()texrim no1oleemfvtl(  2taurono0teenifeiyslmDrm(ms u4 lenxo3todoa e uei () exmir3nu1lp e fvs () rra(rpou0alxnif3ildfaDelnvo;t4aexrmr3todfp eaueolt0 2umim3ou4amtnmfesl(fsDtrur nt1tetn fciytfa2ulnms u4artomf iytfmte uvs s)s2xr(o iy1lltnlfet tf 2rrx oou4apto ictld sDraumo;u0trenxr oy1fa rln o;t tetoir iodamt lneilt)a2urur oo0tet mf3iadls ua(vo;u) eeoirciydomtrlivs t0 euo(m oo4ll   nesltf Drru pou1tetomi3iltfs2rmnvp;t)teeoxr ia1oaD lueo ( s2xmxo3oudlp  mieil(fa2uau  oo1apenii3tadls2em(mp () eermo totlmDrli ils0 eumxo oy4altemncsls artmxm ot0tpxo o3tadfa rm(mo () lxnio3ootomD  u s (  ruo(o3oy1alt lfet s) Dta(r ;o1olx  f3iadlsDel(vo;t)tlenio3todlpD luvs ( sruoirpiodlptn fcsa( s2raum ;u1tlxnifeias s2em(vont0texoxrcio1la  lnvi s)seurimpnudam  mfeia(f Dtrumpnu4tet  o3iytfsDrau snu)alxoiocoy1fptrlueo ()srumir ou4alte iet t s2rmump;o1oexomociasfa raump;()tlxnmo iatlat  n s s0 eum(m3iy1om e fcs (farrrum ot0aeen o3tysls um( pnu) rxrif io1fpDrlnes;s setr(m3oodlpt mfcsa()sDum(m nu4aeen i3iytla2rl(mpnu)aeerif oadfpD li o t seuo(rpiy4ope mfeil(  2rmxm oo4tlx if3ildlmDumnms;(4tlxrmf oatfm elues;s tetoxr iy1alee fviltfaDrruro;u0tleomietltls2ulump (0trtnmo3iytlat aivo s0sexrxopiy1olt mfvsl( s2rrxmoou4texnioeiad a ea( o;(0tleoxf3ty1omtr ivs t  etm(r3ou4ame  fvs s  2rmxmo;o1apxn icild sDulnms;u0artnir3ta1om rau i;()s2trxm iodapee fct s)sDum(  ot0tet  ictat sDul(vo;(0arerxf oatlaDeaieo;s) exo(r nu1ope miesl()arurumooo1aeen ociatfmDrm(vp;(4texnxrcto1fmDe u ilt trxrxo3nodlpeelivil( aDrm(mpot0teeomfeildlmDulnvs u)trerifcty1fpD lies s) 2xmiopno4lp n fvi t  2uau  ;o1aptomiciltfmDraumont)aexoxocio1fm   i ils0 2to(opoo4lltemiet (f rraxmp;t4oet ifctlt s2umu on(0 renifciadlaDe ues;( srumxo3nudlptn neta(  2trxmonu4tltniieils aDem(vp;t0 ltnmr iytfpte u s s) exo(o oudop emfci tf rtr(rp;t1tpxniieiadlm2uau o;t) rtrmf3oodoa  livo;() etmim3ny1om  mies ( s2tauronu1alxo fciytfa2emuvo;(0 reomfciodomDelueils srum(m3io1apee ncsatfa2rax oou0olx ii3tadls eau p;t) ltrmo3iytfpDean o;( trxmirpnudoltnlncia( s2ra(r no4tpto ietlsfs2emnvs;u0trtnmo iytoa e ueol(0t2tr(o iy4lmenlnct t aDua(  ;u4tpenmfciysfaDrmn pn(4 ltrif3to1lmDraivsls0srtmirpoo1omenlnvs ()aDtmur ot1olx  fctatfmDuanvs;t)tltrio3iatfpD  u i t0 rumir no4oltn ncia() ruru o;u1oexoiicilsla uaumpnu4texoxf iytoptr ueols teuoio oydap  miviasfaDrrur nu1tpx iociysfa rmn pn(4arxoxf3iytfa elues s)t2uoim3ou1lpen fvta( a2ta(mooo0aee ioctld a umnvp;u4alenmrciatfpDeanvs ()trtrim nodlleelfctat sDua( pou1ope mociltlm2rmn sn(0tltoxo ia1fp rlivo;t0 rtm(rpiydlptnmics t arumu poo4tpxo i3tltla2eauvo;(0trxrir ia1fmDr uvi;s0 rtmio ou1am e fesat)aDrr(  nu0ope mociysfs rlnms;t0arxnmr tadfaDe ivo t0s2trxopnudom  lfetls s2rr(rpno1tpe mfetadls emn p;u0 rxrmr todfat livol(0t2um(r io1amtelncil(f rrmx  no1ole  f3tytfa2em( o (0tltoxo iatfmDelivils0texr(r nu4omeemictas) Dtau pot1teenmoctlsfa2ua(mp;() exoxo iatlptr uvol( s2urxo3iudlleemnei ()aDtm(r nt1tltomoeildfm2elnmp;u) lxnmf ootlp  liei t  eumxopou1am   neslsfaDurx o;u0aexnmo3tlsla2rm( snt4teenircoa1lm eli s;()truo(m io4oltelieia()arrrur nt4alto ociltlm uln pnu4 lxrxfcoa1omDr ueil(0t2xmxm3oydoltnlfetatfs2rrx  ;t4ale iieild a2rlnms;()aetoxrcoydfpDelu ols0t2xoio no1lpee fciatf 2umu ono1alxo iciatfmDuan pnt4tetnio iadopD  nvs t tetr(opiudlp  livt ( sDta(mo;o4tetoif3ildlm emumo;()aleoxrcio1om r n o;( t2xrxo io1omt mictlt) 2rmxrpot1openmoetatls ra(vs ()altrmr3tadfmD aivo ()teurim3oodapt lncilt) rtmxrp;o1opx mf3tasla ea( o;u4tltnmf oytlmD ln ilt sexmxrpio1lp   fes (farurxr ;u0teeo ieilsfs uau snt4 rtrxocio1oa  lueilt0sexoxmpiy1al e nctlsf 2rm(roou0apx iieias mDrmuvsnu)trtrxr oodfmte n i;s0 exm(r3iu1lmeelieslt)aDurxr ot4tpt  o3iaslmDrl( pn(0aetnmrcoydlm rlivs () exo(rpoodameelietls srurxm ;t0oex  f3tyslmDel(vs u)aexnxr3tadfpt  u ils)truoxo3iodaltemfctat arur( ont0alenifeilslsDrlnvs;u)trenir ia1fa   ueo s)trum(r3oo1am nlnctlt)sDur(roou0tpenioctldfaDra( s;t0trxrmfcta1la  luvsl(  exrxm3nu1ll emiesa(fartm(mont4alxomoeildfm ul( o u0arerxrciotfaDran ol( trtrxo3io1lmt mnesas)s2ra(mooo0olxn ieiat m2ra( s;()trtoxo3ty1op r neol( srto(r nu4optemfetas)a2um(ro;t4tlen fciydfaDrln ont4altnircoytoaD aivs;s0t2xrio ou1ll e fei s s2urx pot1opxoifctytlm rluvpnt4tltoxf3todfaDrau i;() 2toio3iy4lptemnetltfsrumxmpnu4tle mfetltfa rmu p;u4trenir iotomteaueo ()srtm(opny4openlietas sDrmxr nu4apxoifcilt sDemuvo t4artnxfcia1fm  au olt seuriopnydal emivias arraum nu0tptnmi3iysfm uauvp t)trtoiocoytoatranvilt0trxmir oy1olee fvs t)s2trxmp;t0tpe iietadfs ulump;(0 lxrmr3ootomD  iei (  eum(o ny4lme  fvtlsfaDta(r ;o4alto o3ilsfmDrlu ont) exrmr oa1faD lu slt) rtrxr3iu4aptelieta()srumurooo4tltn ictlslmDemn snt0alenmr iotlaD  nvsls0s2trir3ou1lp n fvs (  Drru ooo4alxoif3ilsls uanvp t4aeerif3tadfm e ivsls teurio oy4al e ieilt  2raur ot4oexoio3tlt a2rmnmp (4trxrxr tytop   ivil(0t2umio3iudlmt miesas)s2ur(rpot4apto i3tlslm2ulnvp (4 etnmf3iatoa raneo;t0srxr(o ny1ameemfvi t)aDtaxr ou4opxomi3tysla ra(mpnt)tltniociodfaDrlues t  exrim3oodlptn feiatfs2uaxront4olxnmfetaslaDel(msnt)arxrir ia1laD  ueo;t trto(r3iy4lmt mfviasf Drr( pnt1ole mi3tlsls um( pnu4tltomr iydopDelueil(0 2xoxr nudlle  nesa() 2rm(ro;o1alt  o3iltfmDel(vo u) etoxoctodom elivo;t)trtoiopiy4op  mnciat s2rmxmonu0tpt mfciadlaDemnvp;u4 lerxocoodfmte u ils)s2tmxo3io1al   nvtls aDtmxront0alxniictatfm eaums;(4trxoif oatfa   i olt t2tm(r3iudlm   nctls  rrr( p;u4olx mi3iat s ulnvs u)teeoio oo1omtr n i (0 eur(o3nu4olenmfesasfarra(rpou1apen octat a2um(mo;t)texoir3oo1fmtr nes (0seuo(r ny1ol  lfvilt) rrruro;o1optn iciyt a rm(mon(4aexrio todfmDr iesls) rxrio3oudameemnei t aDur( p;t0optnmietydfsDean o;u) eeoxfciotfat luvi t  2trxm io4apenmivi t sDrru pnt1tlxniicild mDrmn p;t)trenir oy1lmt livil()t2um(o iu1amtn fvtls  2uaumo;t1olxoioetlt s ea(mpnu4 exrio3oydoaD auvi s0srumirpio4ap n icil()aDurxrp;t0ale  feiytls2uanvsnu)aeeomo ty1omDelneils)t2trirpiu4lleelfetltf 2tmu pnu1altnmoctytls ulnvo;t0artomrcio1la r ieo;t trxm(m nu4lme lietlt) 2uaum ;u4oee  iciltlsDumu p t)artnif oodlaD auvo;t0 rxm(r3oodoltemfet (fs2um(r ou4tlt  f3iat mDul(mont)alxnmrctatoa eaivs;t0 rtmxr iudamen ieiasfs2taur nt1texn ieils s elumpnt) lxnxo3todfa e u ols texmxopno4apenlfctas  Dtru o;o4tptnmfeilt a rm(ms;t4alxomf3oatlat lueo ( teumxo iu4olte fcs (faDtax p;o4oeeniieiyd s2emu snu)aeenir iatfpte nes ( s2tr(o3ou4ll n netat  Drrxrpot0tlxn oetaslm ranmp t4 lxoxo3oydfmDrluvs ( srxmirpio4llen fcslsfaruaur ;o4tpe ioeilsfm ra(ms;t0artomo oatomD lnvi s0 2ur(r oo1am n ics s a2ra(m ;o0tpt  iciadfa umnvp;u) lxnmr3iodfpDrai s;t0tetrimpoo1ap nlfci (  2rru  nu4apeo i3ildlsDumumo;t4aeermr tadlp r nvols) rxmimpoy4omee fesasfsDum( onu1tpxo ieildlmDea(mo;u4 exoif3todfa  ln s;s t2tmim iy4lmtemivsa() 2rmx pnu4ale iiciys m rmums;t)aetoxo3ty1lmD  nvi t  2tmxo oy1lmeemfes tfsrra(mo;o1optn i3tlslm2eanvp;() etoif ia1lmtrlueslt)trurir3oo4lpt mneta(fsrtmxm nu4olx ii3iydfaDranmo;u0aleoxrciatfp eau o;s)s2urxo oy4ol   ieil(  2urx ooo4aet io3tysla2ulnvo;t0arxrxocoa1fm r ieo;(0 2tr(m oudapte nvsl(  rurx pnu4tet  oeildfmDeauvs;(0texnif3ootfptranes (0s2ur(o iodolte nes ( srtr(rpnu4oeeomfeilsfm2rmuvs;()tlerxf oydopD  uvi (0srxoxr ny4om emieslt srrm( p;u1opxoiietlslmDul( p;u0 reoirctotom  li ilt)setoxm iydlmenmfviat)arrmur ou0oex ii3tltfm emnvs (0 rtoifcoy1omDeanei;t0t2trirpou1ale  nvi ( arurx o;u1alt moeiytfaDrmu o ()altnxo3iodop  lues t) 2xrimpnu4lptn nes ()aDtaxm oo1ale  o3iysfaDem( s;(4 etrxf3iy1oat aneils  exoio3ny4amenliciatfs2uau  oo1oexnmietlsfaDum(mp ()trxrxf tytlpDeli olt  rtoxr iy1lp emivil( srtmurpno0tex  ieilt a2ra(vo;t) rtrxo oy1lm rli o;t) rurxrpoy4om   ncsls a2tr(roou0aee  ociadfm2ea(mp;u4tlerir3tytlpteai sls t2triopou4aptemieta( sDtau p;o4teenmfeildlm rmn o;u)arxrxr tydfm rluvs s0t2trxm3no1optn ictls sruax  ;o1olx ifciysfm emuvpn()alxrxr iytfm r n il() 2toirpnu4am nlivta()sDtrum ;u4ole  ieiydfsDranvs u) rtrxocoo1la  lnvo;s seumirpnodom eliei s s2rrxr ;t0olxn f3tydfs ulnmon(0aetrmo iotlpte uvs t)srumxm3iu1opeemnctas srumx  ;t4ale  feiytfm2eln p;t0tetnxfcoydfa eaues t0s2xmxmpiy1omte fvia(f rta(m oo0tpxomocilsfsDel( o t0 rxnxoctytfa eanei;s)seum(m3iu4lpt  iet t) rtmuroou1opeomi3tldfmDuluvo;t)teeoxfciy1fmtelu o s t2xm(mpou1lp nlfvt (fsDtr(  ou4alenmf3iasfsDuau snu4aetrif oy1op  lu s;(  rtoxmpiydom emicsls) Draumpnu0alt mo3ildls2umumpnt0tlenmf io1opte neo t0trumxm oodap  lfcias) 2rm(  ;u1olxn oeiasla emnmp u4 rxoxf iodlaDelieolt0srtrxr io4apeelnciat  2urxrpnu1alt  f3iyd s rau o () etnif iadoa eau o;s texo(m3iu1lmt  nes ()srtr( ooo0aeeomo3iadlm emnmo t4 rtnif iy1lmD  uei s)t2toxopoo4lptn icsls srurum ;u4tle iociadlmDelnvp;t4teeoio3ty1oa eau il() rumio3nodole  nctasfsrrmxr ou0tpt iiciysfa2uaumsn(0trtrxfciydla r iesl(0 2uo(rpny4llee ivi t  2raum ou1texnifcils mDrm( p u4 etrxociatoaDelu s;s  2tm(o no1al nlfviat) 2tmxm ;o0olxn ictls a emnvs ()trtrir tadop eauvs s) eum(mpiudamt lfeilsfs2trx  oo1aex io3tat a el(vs;u4arenif3tytlmteln s;() 2umim3oo4am  lietas) Dra(rp;u1oetomf3iyslm2ean pnt) etnmo oy1lmt  ueols)tetoxr3oydam  licsas a2rmurpnt4oeen fcilt mDeln s;()areomo todlmtrlu i;( setoir3iydole  iei ()sDrm(monu0tex iictyd m2rau o u4trtoifcto1lmDr uvs;t  2tmio ny4lp  mnvs sf Dra(mpoo0oee if3ildfm2rau s;u) exnir3iotfmDr uvsl(0trtmxr3ny1lme  fvsas)srrm(r ;o4oltnii3iat s2emnmo;(4aetoio3iodfpt aieo;s0s2trxm3nu1lltemnesat srrmxront4oet mietyslmDuanvs;t) etoifcoydfmDranvo;t0trurxr iy4oltemiet s  Dtaxmp;t0olxnmi3tldfa2emuvs t4tleoir3iadlmD  i o s)s2trirpio1oleemivsl(farrm(mpno0tpenifetldfsDrluvp u)arxnxocoatoaD lueo;(0teuo(o3nydll nmncsl( aDua(monu0oexoioetat mDelumo (4teeoxf3todfmDeli s;t0 2xrxm3oydlltelictl() Duaumont1olenio3tyslsDea(ms t0trxnxr3ty1opt an olt) rtr(r3nodlmtelfvi t) rtrurooo1tlenioctltlsDua(mp;(4arerir tytomt au sl() eurxr3iodopeelici tfartm(  ;u1olx  f3iysls ea(vp u0 lxrmo io1lp   nvols0setrim3nodaptnmietat) rurxroot4tlx ifeiytfsDrl(vp ()trxnir oodlmtelnvo;s0s2xoxm nu4amt mncta(fsDurxro;o0ope  ieiysfa2umu o u) eerxf3iotfpD  neo;()tetrio iydom  lneta(fsrrr(mp;u4oleomoetlt s2emnvo u0tetoxf3oa1laDeanvol()t2xmxo iu4lpt liciltfa2tmum ot0apeomiciyd m uluvp;t0artnxf3ootfpD aivi;()seuoirpoudlptn ietat aDtru pnu1openiociadfs rluvs;u)aetoxf oadfm  ln sl() rtmiopio4lltn nvsat  2uru pot4apxn ociydlsDem( p;t)texrxo3iytop   uvo;(0srxm(opoudllen icsas)aDumur nu1alenii3iasfs2ra(msn(0 etnxo ty1om rliesls sruriopoodamenlncia(fsDrax  ;t4tltomoeiatla2rm(vp;t)tetoxrcoadomtrln i s  etoim3iy1ap elncia(  2tmumo;t4aeeomfctyt a um(mo u4 exrmf3oa1lmtr i slt0srxr(r3no4lmtn ieilt)a2tr(rpnu4apxnmictysls2rmumont0tltrmr todoaDran il(  2xoxm3iu4al emfctlt srtaxmpnu1tee mi3tyt s emuvs;t0 rxnxo3ootlm e ivs t)s2uoxo3oudopen ivil(f 2taumooo0oltomfciysls2umu o t4aetoxr3oy1lpD  u il(0 rumimpoydalte ies tfs2raxroou0tpxomfciyt mDrlnvpnt0texnxr3iodfm ranei;s0trtoxo3io4omen nvsa(f rrmxmo;u4tlt  octydla2elumsnt)aetnxoctotlmt  ies ( t2umxmpno4am elnvi t artaum ;t0aet iocild s ea( o t)tlxrif3oa1oat li s;t sexr(o ou1op elnei t)aDtr(  ot0aet if3ild s um(mo u4arerxr oatoat ai ils0s2uoxo ou1ope lfcsltf Dtmurp;o0tpxnmfeiatfs elnvp;(0 ltrif3iadfmtranvilt) rtoxr oydop e netat sDtmu p;t4oltoio3ilt aDua(mpn()altnmf3oo1lpD anes s0teum(rpou4lltnlncs t) rtm(m nt4ope moeiys sDumnvp (0trermf3iadoat luvs;t0trtoxo nu4llt  fvtlt  ruru p;t0tlenmictys aDelnvo (0trtnir3oytomteauvs t0 2xoimpiy1lp n ict (  rtau  ou4apxo f3iltfa2elu s;u4teerirciatlpD  ies ( seurio3oydlmtn nviat) 2ua(r ou0olt mf3iyslaDuln s u) rtrmf3oadlmt anes;t) rurxmpiu4al  lnet (f Drr(mpnu0tpx ioeiydls rmn o;(4artoif oytlaD aieil(0 eumir oodamee fvt sf 2um( oou1alenmictlslmDua(vs;()teenxrciy1la rlnei;s)srxo(m ny1lle mnet ()sDtrx ooo4altnifetltfm ean pnt4 rerxfcoy1omt  n i (0sexrxr nu1lm nlivt t s2uaum oo1aetniictld a emump;u)trxrxo oytlp   u s;( setrim no4lm  lfei s artax ont1alt  oetldfa rmn o;u)aeerif3ia1oat  ivo t)s2xmxo3ou4openlfctlt)aDtr(ront4tle  oeiysfm rmnmp t)arxnmrcio1oa   u s () 2umxr ou1apeemieiltf Drmx pot1tpto ociydlaDean o;u0aetnmo oa1fpt  ues;()s2xo(o3nodamtemics t)aruau ont1tptoio3tyt aDranmonu4alxoirciatfmtean s;s)seto(r iu4al nmncs t arua(mpnt4tex mf3tytla ul(ms () exnirciydfaDeanvo (0srto(rpio1ap e nctltf rurx oot1tlxomoctytlsDemnvpnu) eerir todfa eanvi s trxo(o ou1lpt mnesat)s2rrur ;t1ape miciytla2ean o;u)trxnirciatfat luvo;t0trumxo3oodap nmietls aruau  nt1tltn feiltfaDuauvpnt) exnmo3iytfmtraneslt sexmxr3iydlp  lfeia(  Drax ono1tltnio3iydfa2um( snt4 exomfcia1lp r nesl(0srxo(r3iudlm nmncs s  rrrxm nt1oex  octas s2eln pnt4artrxr3ootfptr neils teto(o3nodomtelfesat)sDumxrp;o4oeeoiociltls2ea(vp u) rxrmo iadfa r n o s0 2xmxo iu1lptn netl(f rta( poo4tlt mietydlaDraumo;t) ltomo3tydlpDrln slt  2uoxo3oodope mnetlt sDrm( p;u4oeeoioctas s2rl( s;t0 rerxfcia1om elu s;t0 rtm(opoy4lmte ivt t)artax pot0altn ociasfaDumu s u0teeriociytlpDeanvs s0 rtrxo3iudoptnmfesa(fsDua( o;u0aleoif3iad sDelnms t)aexnmr iatfate ies;t)srumir3iu1amen ivsatfa2umxm ;o4teeoifcildla rl(vp;t0 exoif3iodfmtran s;( s2trim3ou4apenlieiat)a2ur(m ;u4oetnmociysfsDuanmonu4alerxr3oatoaDe u i;(  eumim nudlm   fes s a2raur nt1openii3ildlsDuau sn(4treomo oytom e uvs s0 rurxm iy4ll nmfetlt  rururono0tpxoiocilsfm ua(vs t) lxnio3io1om e uei;()sruoxrpoo4om  lfei ()s2um(m ;u1aex mieiysfs2umu s ()altrxfciodlmteaueils0s2xoir3ny1ap n iei t  Dua( pnu1tlen ociasls2rlu p (0trermr3oatfaD  nvolt)s2urxopiy1ome  fcsltfaDtmum no1ope ifctls m emnvo;t4 leomfcto1lpDe nvslt s2urimpnodap emictlt  rrmump;o1oltnmoeiyd sDrmnmp (0trtrmf3totfm eaues;(0seurxr nu4ale livils) 2rr(m no1aeeo f3tadfs2um(mpn()teenmr3oodfaD li i;t  exoxr3oo1olenlnes sfs2ra( pou4tet mociyt sDulnvon() renxf3todlm eanei t texr(o nu4alt mfesa(f 2tm(m ou1oeto fcildfmDrm(msn(0trenmo3tydomDrliei;( srxo(opoy1lmtelivt tf Dtm(ro;o1oltoif3ild mDrm(ms u0tlxnmrctodfpD li i;() exo(o3nodaltnmfctl(fsDtm(  ;u1oetn fcias m emnvont4alxrmfciydfmt aivs ()sexm(o oodopt lietlt) rum(rpot4ole if3iasfaDrl( s;t)texnir oodom  aues;s) 2trirpiy4lmt  nvtl(faDrm(rp;u4oexnii3iasfa2ulump t0 etrxfcoatfm rlu s;t)t2uoim ou1am n fct ( srtaur ;o1altnif3iydfsDem( p u) etomf iotoatr ivo;s)texmxrpoo1ap nlnctlt) Dumxmpnu1tex iictytlsDuan on(0 etrmr3oytfmD  ivs t0trxrxo nydlp  lies (f rta( pnt4opx  ocils a ulnvs;u) rxrio io1lp  anei s) etr(r oo1lm emietls  Dra(rp;u4aeeomfeilt aDrl( s;u)arermrcoo1opDeanei t s2xo(mpiydlmeelictlt srtm(rpno1oetnif3iyt a uanms;t) lxnif ta1lm  luvsls)seurirpoo4omtnlfetas)s2rr( pnu4tpx mfciyt a2rm( o;t)trxomfcoa1lpDe i i s)t2um(m3io1olt micta(f Dtaurooo0apx mfctaslsDrm(von(4altnxfciatla ran i;s0seurxr nodamtnlnet s) rrmx  nu0tpe mfctas m eln s t) ltrio ootlptrlueol(0t2umir iudolenmici (fsrrrxm nt1opt moeiat sDean o u0aetnif oodlpteaneilt  eurim3io1al   fci t) Duax p;t4oeeoioeiys s rlu o ()alxomr oytop r n o;t0srxmxr no4ame lnvt tf rtrxmonu1aetoiieilt s2ul(vo t4tlxrxo3oo1fpDeai i t)sexmxr3io4alt mfct (faDta(mooo0tlxo fcildlaDemnmp t4aetnmocoydopte uvi ()srtoxo nodlm nlfetasfsDtaum ;t4altn o3iytla2ea( snu4altnxo iy1la   nvols0trur(mpiodolt lnesas)arra(roou4alxo o3iyt sDemn pnu)tltnmr3ia1omt  n il(  rxmim3ny4lltemnvtas)s2rmurpoo1tpt if3ilt aDel(mp;t0trxrxo oydoaD ai o ( teuo(o3nudll emieils)sDurxroot0tet micias m eanms t4tetrmocia1lpDeaivo;t sexm(r3io4op nlietltfsDumx ooo4tpt iiciysfa2rlnms;(0alxrifcoodfateaivsl(0srtr(m nu4ol elici t a2tmxmoot0tee mo3ilt m2emu snt)trxoifcta1om r u ils)srxmio oo1ame mfvil(farurxro;t4oleniicildlm elnvsn(0alxoxfciy1oat lnvs;s) etoxm oy4llte fct sf Dtm(rpno1ole mietasfm rmnmo;() rtrxo ootlaDrlivolt setoxr oo1om   fetls  rurxmpou1oetniiciysla uln o;(0 eeoifcty1fmt auvo;()sexoim3oudam  mivsltfaDuru pnt1aptomo3iltfm2eaums t4aeerxf3iotla rauvs s sexr(opiodll   fviatf Drr( onu0aee  fctytlm um(vsn(4texomrctotopt lu i t) 2xrxr iy1lpt lfvtl()s2urump;t1tee mfciysla2em( s;(0texnir3iy1faDe i s;t sruoir3oydamt  feias srumx  ;t4oex  fctatfmDeau p;t4 rxnmr todfpteau il(0tetrimpoo4optelncsas)arum(mpno1oleo o3ildla eanvon()altomf ta1lmtrlnvi ()trumim3no1ame lfesa(f Dua(ronu4oexnmfctat s2ul( s (4 reoirctadla rauvs;()trxrxo io4ameelivil()artauroou0opt  fciadfa2rluvo u4 etrir3tadop eaivilt0seurxo io4op e fei ()srrrurp;o0aleo iciaslm2uauvs u)aexnir3oatlpt  iei;t0 2xoirpoy1am e neiat)srraxrpou4tpe  fciltfaDrmnmo;t)teeomr3todla  ai i t0srtm(opnu4ape micil()s2umxmont4alto ieiysfa2rmu p u)tltnmo totoat  ivsl(  2uoir3oudame lfcslsfs2rm(rooo0tex iieilsfm2ran s;()trtrif iatopD aneils setrxopnodale lfvtlsfsDuau  ou0tle  oeild mDea(vo u4tlenmf3ootoaDe nvi (0truoxrpnodaltnlfetl() Drr( ooo1alxnifetatfs2rau o t)tlerxr3io1oa  anvo (0s2xoxopiudaltn ieiat  2umuront1opxn ociyt m2ranmp ()aeenxr3ia1lmtrln sls0t2urio3iodamtnmncs tf ruaur ou4apxnifciyd s2eln o t4texoxf oy1faDeluvslt0 exm(opno1altelncilt)aDua(rp;o0alen o3iydlmDrlu s;()areoxfcoydfm eau i;t srtriopiudol n nvsltfs2urx pnu1opto ietltls2um(mp;t)trxrmo3oadlpt  nesls teuoirpoodlm nlfcsas  2taurpou0aexoii3iys aDrluvs t) ltrxfctatfatr ivi s0 exr(mpiydameemicils)srta(m ot0tpto o3iys a2rmu s;t4aeerxf3io1lat  u i;(0 eumim oo4omen nvsls sDrr( o;t1opto f3tasla2ra(ms;t)artomr3tydoptranvo ( setrxo oodolt mfesatfsDtru onu4tpxnii3tasla eanmsnt)aexrxf3tydlp raivi s  2trxr iy4om emicta(faDta(m ou0apt  fciltla umnmpnt4trtoxr oa1la e ieol() rumxr3oodal e fctas)a2umxm ;u4aexo f3ias s elnvon(0alxnmrciodlaD luvo t)texoxr3oudopeelicsat)a2ra(rpot1oee io3ias m2rm(vp u)arxnif3oadopDe nvo;t t2tmxmpoudolt lfei tfa2umu  ;o1oexoii3iyt aDua( pn(4 rxrio3tydom rlivi t  rxoxo3io1lp  mieils  Durxrono1tptomo3ildfm umnvs;t4tltrif3tatlm   n i;s)teumio no1lpt  ieias arrmx o;o4opx io3iasls2uluvo t0aeenmf3ootomte ivo;( s2um(rpoydlpe  neiat  rraxmonu0tpxnif3tldlm rm(von(0arenio iodfateln s;()setrxopoydam nlnvtas sDtru  ;o1tpe mi3iydfm ul( s u0 ltnmfcia1lmtrliei;s)trurim3io4omen nvslt)arum(r nt0aetnmi3iad mDulu p t4teeomr3tytlatrluvs;s t2toio iudapeemncs t s2umxrpno1opxn o3iyd m ranmonu4tltrxf3tatoa ranvols0 exrxr3ou4amte ictlsfsrta(  ;u0alx moctlsfa2eanmo;(0alenxr to1fatr nei s0setmxm oo4om nmici t aruaumpnt1tpt mf3iyt aDua( p u0aexomrcta1fmD auvi (0tetoxr3iu1ome mics ()arrmumpnu4tpxnmi3iad a2rmu s;(0aetrmr3io1oa r n sls s2um(m3ny1lm  mici s)sDrrxr ot4olenif3ilt s uau pn()aetnmrcoytom r n il(0setrxo3io4lmeelfvs tfa2tau  nt0tpeoio3iatfa2umumo;() reoircty1lateau ilt  rur(m nudap nlncsatfsrra( pou0oee mfciys m uan p t0texoxf3to1faD lueo (0s2umimpoo1lmenmneta(fa2rmumo;t4olenmfctasls ean s t)aexrmo iy1lp  lnvs;t0t2xoim3oy4ame mnvsas  Dtaxmo;o1oleo f3ilt m eaumonu)areoxrcoo1fatrlnvols0sruo(mpnudoleemicias  Drrxmp;o1oleoif3ildla em(vp;(4artrio3tydfa ean o s trtr(r io4ope  icil(  2ururo;o1olx iociatfs emn p (0 rtomr3todoaDelnei ( sexoxm oy1ol e nvtls srraxmo;u4olx moctld aDeln o;()aeeoif3iotfa r ies;t  rxmxopoo1amtnlicslt) Drr(r nt4apxniiciasfaDemump u0tetnifcoo1lpDelueo;s)texrxm3nodlm   fes t sDtm(rpnt4opxnmiciydfa ra( s;u)tetrxr3ta1la e u o;s) rxo(o oydalte fet tfaDrrxr ;u1tltoio3iysfmDumn o;t4trenio iy1fpt livi t0t2xrim nu4apeelnetl(fsrrau  ;t0apeomfeiadfaDuauvo t) eenif oo1omD lieo s0srxm(mpiudopt mnctlt)a2urxmooo0tlxomociyd aDeluvpnu4tlxomr todlmteluvsl( setmiopno4al nmnctasf Dtaxr nu0tptnmieiasfs2el(mo;u4alerirciydfpteluvi;s) etrim3oo1om nlnciat)a2urx oou0alx  i3tltfm2rmuvpnt0 eeoxr3iodoateau ilt)t2urir3iu1lm e ivils) Dta( o;t0opxomf3iltfs ea(ms u4teeoxo io1fp elnvi;s) exo(m3oudol  liei ( aDtaxm ot1olxnii3iys aDul(mp;t4 etnxr iydomtraueo;t0 etoir io1olen nvsl( sDumxrpoo0altn o3iasfaDrm(vonu0 rerifcoy1op eanei;s srurimpnu4amtnlnei ()arra( pou4altoiiciad mDra(vo;(0tltrif3io1lmteliei;t texoxo3iy4oltnlfet t)a2rm(m ou1altn ociydfsDrm(vs t4tetoxr3iatfmD  neo;(  rum(r3iy4altelfcta(f rtrum ;t4oetn fciatfmDrlnmp;t0tltnxrcto1fptrlu il( trur(m3nudom emiei t)sDuau  ;t0opeo fctaslm2uauvpnt)trxrxf3io1lmDrlu s;s  rtmxmpiy1lp  liei (fsrrau onu4teenmiciysfm rm(vont4arxoir ia1fmDr iei () rtr(rpnu4al n fcsat)a2uaurpoo0tet moetld aDraumo;(0 renmf3iotfa  aneils0trxoxm3iy4op  mnei t  2raxrpnt1alt mociatfm emn onu4texnxr3tadfatr iei;(0t2xmxr ou1lm  mnviltfaDrm(ro;t1tpt  ociadfaDum(mo;()tetnmo3oodfatr nei ()s2uoiopoy1lltnmiciat)aDtaurpno0apen ociadfs rmu pn() exrxf totlmtr nvil( s2uoimpiudap  lieiasf Dtr(rp;t1tex ioeilsfaDea(mo;u0 lxrxrctadlm raies s)setoxopnu4llenmfcs s)srumumpno1apxnioetat s2rlnmpn()treoif iotom ranei t) 2xrxm nodopenmnvsl( srur( ont1oleomo3iydlmDranvp;t0tltoio oadom r neil( s2umim ny1ope  ietlt s2umur ou0tle  oeiys aDrmn p (4 rxnmo to1la   n ilt) rtr(o3no1al nmiesa()sruaxmono4aleomi3ildfm el( snu0teermo3tydop e u ils)setm(r3iudapt  fcsa()arumx  oo0tpen ieiytfm2elnvo () lxrmr oytop e i ol(0tetrimpiu1am n ivs s)s2um(rpnt0tpeomo3iydfsDrmn pnu4 rxnif3totfa e uvilt0t2toio iy1olte nvs sfaDtaxmp;u1apxnmfctatfa ea( p;u)arenmfctadlmtelnesls0trxrimpio4am e fetl( srtau ooo1tltoifeilsfs eanmp (4 exnxo3iatlmD  nes s0sexrxr iu4op emfei sfa2tr(m nt1aptnmoeiat m el(vp (0tltnio3oodopD lnei () etrxm ny4al  mncias  2umxronu4tpx  iciltfmDeaumpn(0altrmf3iy1opDelnesl(0srtriopno1aptnlncsa(faDra(  ot0tee  fetltfa rl(mo;(4aeermrctadfmt ln i;t0 ruoim3oodaptnlfeil()aruau pnu1tpxomoctytfaDrl( snt4 exnmr3iodla   n o t seuo(r oy1al nlfvi t  Duaur oo0aptoiiciytla2eanvo;t0 exoif3iadlate ueo;()tetmxopio1olee fcs sfsDrm(  oo1tltn fetysla ea( p (4artnmoctodlaDeai sl( teuoxm3iodapee fetl( a2tmxroot4apx io3iytls eaumpnu4tlxoxrciadfmt lnvolt)sexrxo3oo4lptnmivt s arrruro;u0alenmietat m el(mpnt0 lermr tadomteauvs;t trxmir3oo1lpenmics s)srrm(r ot4teeo oeilt sDumu sn(4 exoxo3totfptrai ol( sexoirpiodal eliet s)aDrr( pou1tlt mi3iatfaDemnvpn(4tlxnxf3oa1omD ln i;t)t2trxrpnu4lltemncia( aDrauroot1oetn ociasfmDuanmpnt0 exoxoctytoptelivi s0 rtrxr nu4amt lfvsa(  2ur( pnt4tlxn fetasfm2elu s ()tlenio3totlaD  ieols truoirpnodllte nvsl(  Dtax oou0tetomf3iyt s2ran s t0 ltrxo oadfm eliesls)trumir iudop e ivtasfa2rmxront4apx mieiyd m2emnmp;t4 ltrxr ootfaDe ieo;t0tetoir no4lmtelivi sfs2uaur oo1tpxo ieilsfm2elnvpn(4 ltrxo3oydomDeauei;s)tetmimpou4lmtelfciatf rtrxmo;t1apt  feiyt sDea( p t0 rtnif ta1la  auvs;t)sexm(o3io4amenlfetls)aDta(r ;u4tpxoii3iytfm2rmnvo;u)artomocto1lp r uvs (0 exo(opiudolenlnvta()s2rr(mp;t4ole mfeiatfa el(vonu0 eenio3iytopte iesl( s2uriopnudop nlnci t s2rmuroot1aetn i3iltfm2eluvs;(4tlxoifcoytfa r uvo ()truoxm3iy4amen fvsa()aDumxm ou4tex  i3tltlm ranmon(0aexnxf3ta1fpDrluvilt s2xr(m ny4ll  lfes tfa2umxmonu1aexoifciadfm2ra(mp t4 eenxf oadopt an s;s0 2uoiopoo4ome lncias) rraumpot4oeenioeiadlaDran s t)tltrif todfa  aneo;s  2xmxr oy1apte nvs s aDumxroou4opxoifeildls ulumo () lxrxr tatopt lu o;s  rxrxr iu1ap n ieilsfarraumoou0apeomociyd aDuln s (4tltnif iatlp e u i t srxr(mpoudalenmicsat a2rmxmo;u0ope ioeildlmDrlnvo t4texoif3ty1oaD aues;s0 2urxo no4ope livsat a2umu oot4ale mfeildlm ran s u)artrxo3oytoaDelueilt0s2tmir3iudalen ies (f 2ururp;t4tpx mfctasla rmuvs u)alxrmrctatoptrlneils0t2tmxo3iu4lmtnmieiasf rua(mpnt4oeeomictls aDul(mo;()arxrmo3iy1lp rlnes t  2um(m3io1al  lfvs s)s2uaumo;u1aet  o3tytlm2uluvs;t0 ltrif3totfpte i o ( seur(opnydlptn neslt  2uaxmp;t1olxoifctltlm ulnmon(0arxoxo3oodlp   nvo t0trtrxr iydlle mfcils)sDtmur oo4opt mietatla uln sn(4trtnmfcoodfm rluvi t trxm(o3io1opeemict tfsruax  ou0opxn oeiyt mDuan pn()aexrmf oatlaDr ieo s0 2trxopiu4ap nlnctl()arurxmp;t4altnmoeild mDul( o;t4trxrio3ty1fmte nes;s0s2xoiopoydopenlivi t aDraxm oo4tlt ifeiad a2umu on(0 lxnio iadfp  lues;s sexrxrpny1am  lictas a2uauro;o4tlt if3ilsla ea( p u0 lxoir3tydla elies;() 2umxm ny1ll e ivt t a2urum nu1altoiociltls eaumo ()tlxomo oytoat lnvolt texm(o iudale mivia( sDraum no4oleoifeiatlsDuan p t)trxoio oa1fpteauvs s) 2xm(o3iodlme  nei t  rrr(rpnt1opxn ieilsls el(vsnt4 leoio3to1lp  lnvs;s  etrxo oudll n icta(fsrtr(m nt4oltomf3tlt a2rlnvp (0 renxfcio1fpteauvs ()texriopno4llen ncsl()aDta(m no4ole mo3ilsfs2elumonu0 ltnmf3to1lp ran s;t  ruoir iy1ol   icia(  rrau pno1aexn f3tydfm rmu p u4altrmo oa1opDe i i;()trxrxo oo4op   nvslt)srumxmonu0aexnmfciadfa2emnvs u0trtnif iy1fpD lu s s0t2xoirpny1lmtn nvi tf 2ua( p;o0oee  o3iytlm2rauvp (0aetnxf3ta1lpDranvslt  2toxo nodam   nciat  Durxr nt1tpeo fctls s umuvonu4trxomr iatlaDrlnvo;() ruoxr3ny1oltnlnvs () Dua(  ot1tlx mociadlaDel(vpn(0trermr to1lmtelneo t0 exr(r3oy1lpe  ieilsfs2uru p;o1oet miciyslm eau ont0aeeomr3iytomteaneils) 2umxm3nu4lmt lict tfartmxmo;t0oltnmfctytfmDem(vo (0 renxr iadom e uvi s  eur(r3no4aleemieil()sDrm(mont1aeeoifeiadlm2rlnmo u0arerxf3totfpDrln s s)t2xmir oo4lpeemieiasf 2tauront1olxomo3iydls2ea(vsnu0aeenmo oo1fpD luvil()t2xoio3iy1ll nmnvta()aDur(r oo1tpt mfeilt a eanvp (0aexrxf oa1oa raneol()s2xoxm3iy1llt mnct tf Drm( pnt4tpt ii3iys aDelnvo;u4alenxf3iodla   u s;s)s2um(rpiydomt livtl(faDumur nu4olenmf3iyd s2ranvpnt) exriocty1fmte i ils t2tr(o nu1op emfetlt  rrax p;o0tleo i3iytfsDrmnmont0arxnir oo1lpDe neils) eumir3ou1ap  mies s) 2umurpoo4aeeoiieils mDelumpnu) eerxrctydfptraiei;( s2ur(o oo4alee neta(  Dtm(  nu4tex mictydfsDeau s (4trxnxo tytomt aivolt s2xoxr iodolt mnes s arur(m ;u1oexoiiciys aDrm(mp (4treomo todfpt aivi;t0 2xm(r io1apte fviasfa2taurp;u4opxomfciadfs el(vo (4 exnmo3oatoa eanesl(0t2toim io4lleelncia()sDtrxmp;t0oeeoii3iysfm eaumpnt0 leoxociatlaD aueo s0 2urxm oo1olt lneiltfa2umxm no4optnmo3tytfmDra(mp (0altrxr oydoa r nvol( setmiopnudolte fci s)s2tax  ;u1alxoiociyd sDrl(mo;()aetrir io1op eln o;s sruo(o3ny4lm n fes s)arumu  nu1optnmoeiasla2em( o;(4tlxrxrcoodlmD  u ils) rxmio io4lpen iei sf rurxr ;u1alt  ietld a rm( s u)arermfcty1latraivo;() rtmimpnodol nlncsltfs2rmumonu1opt  octlslmDeluvon()trtoir3oatom  lu i;( t2toirpiu4lpt mfcslt)sDtaum ;o1olx io3iasfmDemn s;u0arxoxf3oatfmtelies s0t2xrio ou1opt  ivtatf 2tax  ot4altoifciyslmDumnms u4 etnxr oadfa  lueols)s2xmxo iu4llte ietls  2rr(root0olxnifetysfsDuln pnt0 exoircty1fpDraieo s trxr(r oy1oltemietl(farumu oou4olxnifciatfa ranms t)artomr3oydlate ueol()trxm(m iy1ol n fcia( a2raur nt1optn icilsfsDrln snu) rxnmf iotfmD auesls0teurim3iu1alenlnct (fs2ur(mp;u4optn fctad m elnmsnu)aexrio3oydla e ieilt) euo(o no4ameemieia(farraxm ;u0olxomi3iatla2ea(vonu4tetnir3tatlmtelieil( seum(r iu1lmte fvsatf Dtmxmpou4tpx ifetysls2um(vs;t)tetnxr3iotfatraiei t  rurio nydam nlivtlsf rtr(m ot0tee iietat s2umums;u0aeerxf3iodopteaivols)s2xo(o3iu4optn neias aDraur ;o1apxnmfeiadfs ea(vs t0 exoxf ia1latelnvol(  2urxrpnodamee feia(  rrrurpno1aeeomo3iadls uanmpn(4 eerir oytlp r ueilt truoiopiu1al  mnes t s2tm(mpot1aleomo3ildfa2ranms t0trtnmrctytlp r n o;t0 rxoxmpiydome mietat)s2tru onu1opto ieiaslaDrmu o;u0tetrir oy1fa eln o ( srtrimpnu4altelneils)s2umx pnu4aexoii3iyslsDrlnmsnu4 lenmo3oytfm r uvs s0setmio3ny1amee ivsas) Dtmx  ;o1tpxoiictys sDuanmo;t)aetomr3oodlaD aneo t) exrim3ny1amen nesat sDtru p;t0aptn iciytfm2ea(vsn(4 lxnxf3todlm elues t s2tmir3iy4ol   ictl() Dtrx pnu0oee  feiasls2ua( s;u0 etrmf3oo1latr uvs;s  2tr(m3oo4ap nlfci tfsrrr(rpno1opt ifeiasls rluvo u4aleoxf3oo1om  lu i;t)srur(mpoydll  mnvilsfsrua(rpnt1aleomfeiyd m2uan p;(0aleoxr3oydlaDelieo t  2tr(rpou1llt mnvi (fsrrmu poo0aetoioetasfm2uau s u4trerif3tadlpDrlueols0 2tm(r3iu4am elicilt  Dua(mo;o1alxo oeiadlm rm(vp;t0 lxoir oytoptean s;(0 2umio ou4openlfctas s2urxrpnu0tetn f3iad a2emnmp;t4 leomrctadlm  lu ilt0 2umiopoo4op nlnes (  Dra( p;o4alenmfeiasfa ua(mp u0 rerxo3to1lmtrln ols0srtmio iy4optnlfct (f rtr( ono0opxn i3tasls2ranmont)altoiocoa1lmD  i ils0 2toir oy4omte ncsls aDuax  ;u4tptn i3iaslmDumu on(4aeeoio iotfp ean ilt)seurxm3oudalte fvt ( s2rm(ro;o0olenmieils sDuluvpnt)artoiociatfmtrlivi;t teto(rpnu4ame mfctlt)srurum ;u4tlenii3tlt a2ra( p;u4aeermfcoydfpteli i ( t2tm(mpou1lmtelivil()s2ra(m no0ape ii3ilsfsDumn s u0 exriociytopDrlueo (0trxo(m3oodole  iviatfsrum( ono1tpxnmfeiad a2uanmp;(0texrif oy1la e u slt)trtriopoo4omtnlfctlt sDuau pno4tetoifeiydfsDum(vo (4aleoif3totfm   ivs ( seum(o ny4amt lfvt (fs2tm(mp;o0altomi3iydls elu on(0artrirciy1late ieslt)srumxo3io4lpenlivs s aDtrxr ;u4apx  i3iytlm2ulnmpnu0 rxrxr tytfptrauvi;s0setr(m3ny4olenmfeils  Dtm(rpot0tpx mf3tld s2ean p u)texnif3oydoat ai s (0setrxrpno1ll e ivtlsfsrumxrono1aexnmoeiatfm2ran pnu) reomf3ootfp elnei;t) etmxr3oo1lleelfvt ()a2raum ou1tptoiieiltlsDemnvo t0alxoir3to1oa   n o t0 2tmxo3oydope  ietat)srtr( pnt0oee iieiys m2eluvs u0aexnmocoytlpt lnvi;s0srtm(r3oo1al   icsa()aDtrxm no4apxniieiys aDuau o t4 rxrir3todfp ean i s) rtmio3nydam n ncsltf rum( p;t1olt mociysfa ea(vp t0 ltrif3oytopDe i sl()srxoxo3nodomtelfvsl(fartrxro;u4tpt mo3tysls rm(vo;u4trerxr oydfm   ivi;(0seum(m3iy4apee nvta()a2ra(r ;o1oetnifctld s2elu o;u)altoxfctatla eanvs t0s2to(o nu4op nlneta()arum(rpnu1opx mf3iatla rauvon(0aexnmf iadoa r ivslt0s2xrio ny1lm elnvt ( arrmu  ;u0oeeniociysls2el(vs;()trxrir oa1lp r iei ()setmxm nu1ame  fes (fsrtr(ront1tlxn ociydfmDumnvsn() rxoif3oatfa e i o;t0trxoio nodlp e fvsat) rumur ot1apx ioeild mDul( s;()tlxnircoadoa e uvo t0sexm(r oodoptelfcs () ruru ono4tlen f3iat m ea(von(4arenxrctytfaDe n i ( setrio3iy4amt  iet s s2rm( o;u1oee mociadfsDeauvpnt4aexrio to1omDe nvi;(0teuoim iu4ol   nvtas)s2trx  oo0tee mo3iad a2rlumsnt0trerifcootla  anvs;()trxrim3iu1ap  lnvta() 2uaur nu1olxnmoeilt a ulums u) etomr iodlm elivi (0seumxm nu1lpt  ivilt srumumpou1tltoiictltlm rau pnu4 leoxo io1fp   neo t  etoim oo4ll nmiciltf 2tmuro;u4oetomf3ild m rm(mont)artnmf tytfm e n s;(0 rur(o oodlptnlfcsls  2raum no4olxo fetas m2eanmpnu)aleoxocoadlmteluvi;s)tetoimpoo4optnlies ()aDtmxr oo4alxniietas a rau onu0aexrif oy1lmDelu sl() exmxm nudol  mncia() rrm(m nt0tex  iciad s rm( onu4aetnxr3todoaDr n o s0 exrim3io4opt mnci ()s2rmxmp;o4oleo ieiyslsDrl( p;(0texoxo3oadom e iei;(  2tmxr ny1olen fcsa(fs2rrx  ;o0oeenifctlslsDeaumonu)treoir todfatraieo t0 rumxo3iydal n fetat a2ua( o;t0tptnmfeiytfm2elnvonu)tlxoio iotlmtrau ols0srxrxr3oudapt  icslt  Drax p;t0oetoiieiat mDumnmo (4tetrxo3iatop  aivs;t) eto(o oydop eliviatf rrmxm ot1tptn iciytfa2um( o;t4aetnifcoa1lmD ai s s0s2umiopio4openlncta(fa2ra( pot0tltn fcilslsDrmumo;t0tltomo3ty1fm  lu slt) exrxrpiydamtnmivtl(faDtru o;t1oexo ictatlaDrlnvp u) rtoio oadfpDrlnvs;(0s2xm(mpoo4apeemivils) Drmu poo1tee iictlsls raump;t) lenmo iodlpDrli s;(0 2to(mpoo1oltelicslt artaxmp;u1oltnif3taslsDrauvon() rxrircoodoaDrau s;()s2xmxo3no1amenmicslt  Dtax onu4apt ifctltlaDel( o u0alxrxo3iydlp r nvi ( seumio ny1olenlncsa(fa2rm(ro;o4tpxnif3iyt s2ulumpnt0aeeoxf iatoat luvols)srxoiopiu4lpen nvi s a2ur(r ou0tptoiiciltlmDea( ont4aeeoxr tytfm r iei;() 2trxmpiodom  mict s)a2um( ont4aexnmo3tld s2ea(ms;u) lxnmo3totoatrlues s0teto(r oy1lm n fvsat s2uaxrpou4opt  ietydfm2ua(vs u4tltnmf3io1la r n s;s)srum(r3ny4omte iesas artm( o;t4oltomf3iyt aDrlu on(0tleomocty1oaDraieils0t2um(o io4altemici tfa2tmxro;u1olxoiiciadfa em(vpnu0tetnmfcia1lp  lu s;s)s2tr(m oo4ol n ncs t) rrmur nt4teeomoctysla2ulnmp (0 leoirctadomtr i s;s0teumimpiodopeelics t arumur no0alto ictltfa rau s (4 etnmfcoadfaDr iei t) rxoimpio1op nlncilt)s2uaur oo4tpxniieiltlm2rlnmpnt)aeerir3ootop   n o (0 eurim iy1openlnetltfarra(m ot0oetomieiat s2um( p;t0arxrifcoo1oat  nvs s0 rtmxr oo1amt  ictat  rum(mpnt1oltoifetysla2rlnvs u0aexnmf oodlate n o;t) 2xrxo3iu1am  livi t) rtrxro;o0opxo ictyd sDeau s () lxnxf3tydopD  n i t)setrxr3iy1oltn ietl(fsDtaxrp;t0oltoifetysfm rm( p t4aeerxfcoytfaDranvsls)tetm(r3no4lmen fcia(  2urumpot4tlx  oetlsfs2uaumo t)artoir3ootom  liei t0seum(o oo4lle micsas s2tmxmont0olt iiciytfm2eau p t0alxoiociydomte ieolt)t2tr(m3ny1olen nctas  2tm(m oo0aptnmf3ilsla uaumsn()tlenxf3ty1laD ai i;t0 2ur(rpoy4ol n fctlt  rraxr no4apeoifeilslaDem(vp;u) ltnir3ty1fmDrlneo s)trxoiopio4ape lictls  2tmuro;t0apenmocildfs2rlu s;u)trerxr3ootop   i i;t0 etmimpiy1lm n fct ()aDuaxr nt0olx mi3iad sDul(ms ()tetnircoadlaDeluvi;t0t2umxmpoy4al emfeta(fartax p;o0opxn feiadls2rau snu4 reomr iadfaD aivo t setr(m iu4al   nesls  rta(r ;u1teenmi3tydlmDra(ms;u0tetrmf3ootfmDelivilt texm(mpoy4om e fetlsf 2ra(ronu4olxomo3ildlm2ea( s u)artnio oydfmtrlu olt0srxmir ou4lp  lfeil(fsDta( oot1apeomo3tyt s2rlu p;u0 exnxr3oy1laDelues s sexm(r3iu1lp nliei s)sDtr(m ;o1tpeniieiat a ulumo u0trxomr3iytlm eau ilt) rurio3io4ap   neiltf 2urur oo0oex iietlt m2uluvsn()alxnmrctodomteluesl(  exo(o3oy1ame  fesat s2rrxmo;t0tlx  fctyt m2rlnms t4trtrxr iytlm r u i s texm(r3iy4ape miviasfsruaumonu0opxo oetlt a ean onu4 etoiocoytlaDr nes;( s2umiopnodoptnlncsls s2tru ooo1oex mfctasfa rln pnt0teermr oydfmt anvi;t) 2xmimpiu1omee ivi t) Dta(  ;o4oeeoiieild m2ra( pnu0teeoxf3ootomt lnvils seuoxrpno4op nlies (faDrrumpno0apeoii3ildls elnvp;() rxnxf3iydlmt an o () rtrio iy4ll elivtls a2urx pno4opxnmi3iasla2ua(vp;u0artrmfctodlm eli i;()s2xo(r3io1amtnlfcias)s2uru  ;o4alen f3tys sDel(vs;()tlxrmoctytfpt au o s)truriopiu4ome  fctlt a2ra(rpnt0oet iietyt s uln ont)alxniociy1fptranvsl(0truoir io1lm e ietl() rtmu  ou1tlt  fcilt a rmnmp;t0alermf3oo1op e ueilt)t2xo(mpoo1lmt lfvils s2rmx poo4ope moeiasls2elnvs u)aeeomfcoo1fp e ivols  rxrir3nudlptelnctlsfa2umurpnu1apeo o3iydfa ul(mo (0 rtnmf iodlm eauei s0sruoxr nydoleelfeslt a2umx oou4openmoeiadfa el(vsnt4 rermfcoadoaDelueo t  2xrxo3io1amtemivsat s2rm( p;u4teenmoeiydfm2uanmo (4trxnir3todlptrauesls) 2xmirpiodlpenlfet tfsrtauront4tle ii3tlslmDuan snu0aeenxo3oy1fa   nvols)srxrxm3oo1lmt  ivi t) 2rrxmpoo4tpe io3iysfmDem(vs;u4 lxnmo3iy1optrlneil(0seurxr3oo4lp nmivil()s2ra(r oo1olxnmieiadfm rluvsnt)tltnxr3tatfp ean i (0t2xrxo3nodol nliet (fs2rm(rpnu1tpxn ieiydlm emums;u)aleoif3oy1laDeaneo;(  2uo(opiu1lmeemfcs ()sDtmur ot0open f3iatfm2elnmsn(4alxnxf tytoaD aiei;() etrxmpiodape micsat)a2uau o;t4oexo i3ils s2umn s;t0 leomf tydfa e n ils)seuoiopou4omtemneslsfa2uaumooo1opxniietlsla ua(vonu4arxnmo iydfpDeau s s)srur(rpoy1lp  mnes sf Dtaxr oo1oltniiciasfaDua(mp t)alxnxo oy1fpD li i s0 2xo(m ny1lpe  fvtas sDtm(ro;u0aetn oeilsls2ranvo;t)alenir oo1opD ai i;() exm(m3nu1lpee ictlt)aDtr(rpnu4aex  oeiat a2ua( onu) rtrmf iytopDr ies t)srtoimpiy4omtemnet s) ruau ont4aetn oeiad a2umumo t4aexrxrctotopDrlu o;s)teuoxopiodop emieilsf 2uaxrp;t1altomfeiltlmDrm(vonu4aeermfcio1oatraivol(0 etriopoy4amtnmivtlt)aDrax pnt0alxnifetltls ul( on(0artnioctadlpte uvilt0sexm(m3iy1omteliesasf Drmu poo0aexoifctlslm ea(mp (0tltoiociydlmtraivi t)t2tm(o3no4openmicsls srumx ont4olt  oeilt mDuanvs;u0arenir tatopDe uvs (0texo(rpny4ap nlieil()s2rm(rpno4ole mf3iaslsDem(mo;u0 lxoxf tadlp r ueo () ruo(mpnu4lltemivtltfaDtr(mo;u1apx iiciysfaDrm( s;u)artnxo3tydoptrlu i;() 2toir3ou4ope lncsa(f Dumxmo;u1apx  ieiadlmDum(mp u4teermr todla r iei s sexo(o3iy4ol n ncias) 2rrurpnu0aex ioeiltlmDel(msnt)arxrxo iy1fmDelu o ()tetrir iu1omtnmfvilt)s2ururont4oeenioctad s uanmsnt4aetomf iotomDe ivo (0 2xrxo iu1ope lnetls a2rm( pnu4ale iicils m2rl( pnu0 etnifcoa1fa  aivo;t)trtmxm iy4ll n i
\ No newline at end of file
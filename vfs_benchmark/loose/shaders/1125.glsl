@@ -0,0 +1 @@
+nvol(0texm(o3no4omtnlfeslsf 2umxr nu4apeoioctldfmDraump;()tlxoio3totfpDe u i;t) 2toxrpiu1olt licslt)aDuaxmp;u1oeeomoctls a2em( o t)artrxf iadoaDelivslt0 eto(m io4oleemict t) Dtm(m no0texnifctasfs2um(msn()tlenio3tytfateluvil()trtrim3no4lmtemfeslt) rtaxrpoo4tlxoif3tldfmDumnvpnt0 rxrxo ootfm  luvo;t)s2xoio3io1amt mieiat  2ua(m ou0ope io3iltfs2umu o;u4arxrxrctotfptrln o;t0t2umim oy1alt lfesa( srra( oou4tlx  ictatls2ua(ms;(0aeermrctatfmD anei;t)sexm(r3oy4lmeelivt t s2rmur ou4teeo octadls2ul( pn() etomo todlp rluvo ()tetmiopoy1ll nlfviatf Dtmxr ;u0oetnmiciatlm2uan s;u0aeenioctytfatr ueol()t2urim3no4olenlictasfaDum( oot4oexoifciatfsDua( o;u0aeenmf iodfp   i o;t0 2uoirpoudlp emict s aDtaurpno0tlxn fciytfs uauvsnt4 exnmo tadoaDe i sls0 rurimpio4omen fctl()srurur ou1aexoif3ildfs rmuvp t4 lxnmf3tytlmD  ivi s) euoxrpoy1llen ncs ( sDur(r ;o1ope ifeiatls ul( onu0aetrio3oytfp eluvs ()t2xrxo3ny4lp e fcia( sDrr(moot4alen i3iat mDuan snt4aeerirciatfm  ln o t0trto(r no4lmeelivilt)aDtmxm nu1altn i3ilsfa2rl( p;u0trtrmo3oodla r ieolt s2trxopoy4ll   ivs t  Duaxr no0tltnmoctat mDel( s;u0aetrioctytomDr ivi;()srtrio no4alt mieil(  rrrxmonu4alxn o3iatfaDem(vo;(0trenxr3tydomtrln s (0srxrio3nu1al nmfeiat)arrmum no4alen ieiltfaDumn o () lenxrcoo1oaDr i o;s)sexrxrpiydamtemieslt)sDtm(roou0ope iiciydlsDulu s;(4 lxrir3ta1laD lu s (  exo(r3iudomtnlnei sf Dtrxmooo4optn ociysla elu snt4teenifcio1oat luvi;t0 2xrxm3no1lptelncs () 2tm(mp;t1alxnif3tadfsDeanmpnt4alxnifcoodfmteluei;s)srur(r iu4openlfvsatfs2ua( oot1alt mfeildlm ra(ms u0 exrir iytlaDelieo;(0s2xm(o3iy4omeemietat)sDta(monu4aet  o3tatla2rauvo;t0 rxnmrcoo1fptelnvi t)teumxrpnudll  liesa(fsDtaum ;o1altn ietlsfmDraums u0tltrmfctatomDr nvs;t seuoxr nu1oltemfetas arrr(mp;o1apx  ictyt a2emu s;t4artrifcoy1fp  ln il() euoio nydamtemictl(f Drm(mp;u4aeeniieiyt a um(vpnu4aetoxf3oadfa r nei ( teumxo3iudlmenlnesl()srrr(  ;u0oltn f3iltfm2emn o;t)trxoxr oatom eli olt  2xoxm3ny4lpe  icsls)sDtau o;u0oetnmieiadfa2ea(vs u0 etrmo3todoaDe nvo ( trtr(o3iu1lp   fvtltf Drau ooo1apeoioctlt a eln s;(0aexnir3totlpD anvi t0 2trxmpiy4llt lietlsfa2umump;o4optnmi3ils s rmn s;t0altrmfcty1lateauvol(  rurio oy1op   ictlsfa2rr(moou4ope mfctat m2rlu s;t0alenmr3iatfpt an ils  2uoxr nodolenmfvsas  rrax pno4ope mieiasfa eauvo;t4aetnmr3iydoaDrauvolt  euo(r iudaptelics s)sDumxrpnt1oexomi3tatls raums;(4 rxnxo3iatoat lnvsl(0texrir ny1op  mietatf Dur(mpot4tlxnii3iad aDelnvs t)artrxrciatlatrauvslt0srumxopoo1olt  nesatf ruaxmpoo4tpeomfctltfs2rmums (0alxrir3tytlpt lu s;s s2uoirpio1apeelnet t  Drrx o;t4ape  feildlsDrlums;t)artnif3oy1om eli s s)setmim iy4alenmfciat) 2ur( onu1apxoiiciasfsDulnvo t4tltrir3iydlaDelivols  exr(o3iu1amt lictlt srtaur ou0tet  iciatlsDumuvs (4aeenmrcoatoat ln s;()teuoio nodope lneiat a2rrur no1altn o3iydfaDem(msnu4tlxnmf iydop  anes s0s2ur(mpnydomtelfcsas arraurpot1oex mf3iat s rlnvonu4alenir3totfm e i i;()s2tmiopiydoptemnvs (fs2rr(m ;u1oee mfeiyt a2uanvo;t4altnmf tytfa e ivs;t) rtriopnudopee ivtl(fa2rrurpoo1optniictatfsDrl(mp;t4alenmr iy1fp  lnvi;(0srur(m io4lmtnlict s aDtaurp;u1ole  fctydfsDua(mont)altniocootop eaieols)s2tmxm nu4amt  nesl()arra(mo;o0tleomf3ildls2ul(mo;u4 ltoxfciodfmtelnvol() 2xoio3nudalenlnes (  rua( p;u4aexoii3tyt m el(mont)aetomr iydlat  u ilt0 eumio oydomte feslsf ruauro;o1olxomfctldfm emumsn() lxniocoytlpteaivo t)sexm(rpou4ole  nct s arur(m no4olxoif3iysfa emn p t4arerxo iytfmD lnei;t0 exrirpiu1lptelieil( a2trxrp;o1apxomoetyd aDelnvsnu) reomo3tatfmt  uvo;() 2xmir3ny1lmenlfvt s a2uaur ot0aeeoifeildlsDrl(vp;u)trxnmfciadoa r ivsls t2ur(o3iy4am e fvs s)a2tm(ro;u1oeto o3iys aDua(vs;u) lxnif to1lmD lieslt)setoim iodlmtnmivs t)sDrm(m ou1tptoiocils aDuau pn(0texoxo ia1lpt li sl(0seumxr oy1apen ict (fs2tr(rpnu0optniieiytlaDumu sn(0alxnif tytlmD  ivo () rtoir iu1ol  mfvtl( srra(mp;t1alx miciltls uluvp u0aexrxr3tadomD  uvil(0 2xmim oy4lpeemietl() Draurono4apxn feiydfs2ra( pnt4aetrmr3ta1lm rluvs t)s2tr(r iy4lpe liet t)a2ra( p;t0openmietydlsDuan p ()alxrxfcoy1fa r uvilt0 2tmir3nydlptnlivsltfsrum(rpnt0aex  feild s2uluvo;t) ltoir ta1oa r n o;() eurim nydomeemicsl()artm(mpou4oltomo3iasfmDrluvo (0trxoif3iytomDr ieils0 rtrxm io4om nmietasf rururono4aeen i3ild s2ua(vpn() rerxf3ootomDe ivo s)s2uoiopnu4ap n fcias) 2ur(  ot1opxoio3iysla rluvsnu4texrxf ootlmDeai s s)seur(o iy4ap  mnvslsfsDuax  ou1tpe  octldla2uauvsnu0tltomo tadfatrauvo s)s2xo(r ou1llt lnct tf rtru o;o0oexo o3iatfa el(msnu)trtrifcoatomDrlnes;t) 2uoxm3nudalee fet ( sDrmuro;o4olto o3iyt a2ea( o u0aleoxf oatfm e ies (0t2umxo3iu1ale  ivilt)a2umxroot1optoiieiydfsDemuvont4trtrifcoo1oatraueslt) rumir3no4ll   ncilsfa2ur( o;t4tpxomfetlslmDumnmpnt) eerxo3ootoatean sls) rxmimpiu1opt  ncils sDuaumpot1ope iieiytfm emnmo t0 rerio totop eaneo ()teumxm3oodll emnviltfarurxront1ope iictadlsDrlnvp;() exomo3ta1lmtranvilt teurio iy4ll   nvsltfs2uaxroou4opxomi3iatfs ean on()aeenif io1lmt aivs (0 rurxo3oodol elivil(fsrtaumoot1tle io3tls m umnmo;t0trenmociydop   ivo;t)teumxo3nodlme livslt)a2rau  oo1tpeomoeiydfa uln p;u0trxrir ia1fpD anei;t teurimpno4ope mnvtl()arrrxmoou4tle mictltfs2ea(vo t4 ltrmo io1op e nvslt teum(m3no4lme  ncia(fsrumxroou0ope iieiatfm umu onu) rtnmfctatlaDrlnvs ()trtm(rpnydlp nmiesl(f 2tr(r ;u1tet mfciatla2uanvo;u0aeenio3ta1fmDe i i;(  2xm(opiy4lp elfcs t) 2urx onu0teeniociys m uluvon()tlxoxrcio1fm rau i s srtrimpiy1ap e nct sfsrrax oou1oeen ieilsfaDrlnmon(0alxnmrcta1fp eauvo;(0setm(o nu4omtnmivsasfsrtau pou4oleniieiysfa2rlumonu4tlxnxr iy1fpt au s;s) etm(opoy4oleelici t aDtm(m ot0teen ietld a2rmu p;t0aetrmoctytoptr uvi t srtoirpou4ap   ies s s2rr( o;o4tltn f3tadla2ulumon(0tleoiocoytoat  ues t) rxrxr ny4ome licsl()sDraxmpot1optn ocildfsDel(vo;() rxoio3iydlpDelueslt) euoim io4optelieta(farur(ro;t0ape ioeils s um(mo;(4 lxomf3iotlm e nvs (  2xm(mpiy4llee feias  rtmu pnt4oexnmieiysfs2ea( pnu)altnif3ty1lp elies;( tetmim3no1oltn nctas s2ra(m nu0teen ietytfs em(msnt0aeenxr to1oaDrlnvslt)srtoxm oy1apee fesl(  Drrx  ou4alt mieiltfaDra(mo;(4texnmr3iotoa raivilt0trxmxm3nudalenmfcsl(fsrrruronu4ale  iciasla2uluvont)texrxr oytfpDrlnei;s0 2trirpnodome mnesat)arumx o;u1tlx  oeiydlmDrmnms t4 etrxo3iatla  auvs ( trumxr3ou1optelictlsfaDumum ;u1texnio3ildla2el(mo u)altnmf3ty1op  lneilt0 eto(r3iydaptelfctas) 2uaumpno1aetoiieiad m rmn ont)aeeoxf3ty1omDeaies;t t2xm(r oo1al   fvia(farrmu p;t1aeenmfctyslaDrln o;t0trerifcoadom rlneils)tetoxopoy4lmtn ici sfsDum(mo;u1apxn octlsfsDum(mp;(0tleoir3oodom  aivo;t0sexrxr3iu4olenlfct t) rurx pnu4tetn ictyd a rln pnu0treoxo3ty1fp r neo;t0 eumxopio1alt  fet t  Dtaxmpot0oee io3iytls uauvsnt0 eenircoatopt au s;t trxrxo iydal  lfeil(f 2umurp;u0oee mfciltfm eluvpnt4 rxoir3iy1op eauvilt0tetmxo3ou1ap n nei s  Dumx poo0alxomieias m umumo u)alxoir3tydfmDeauei t0t2uo(m3no4omen icil(fartr( oot1olt  i3tlt mDelnvsn() etrxf3oatfmDr ueils0truo(m nydomee iviltf Dum(mp;t4oexn ociad mDel(mont0 eeomr3todfp r nvo t0teuo(r ny1ome  iesls srrax  no4tptomfctltlmDumuvpnu)altoio tadlpt au il( s2xm(o nu1lmt mfesat)aruru p;o4teto fetld mDea( o;t4trtrmociydlaDr ues;(0 exm(mpnu4ape mfci s s2taxmo;t4aee ii3iadfsDra(msnu0aetrif oydopD lneo ( trum(mpnodaltemiei ( aDur(mont4tpxnioetadla2elnvo;t)artrmo oatlmD aivo s0 rxmxm3oy1al nmiesa( a2um( p;o4alxo ocildfa elnvp u4 rtrif iadopt auvol(0seurimpno1amtnlnvsltf rrax oot4tle mo3tltfa2um(ms t4alxrxr3oo1om elivi;s)s2uoiopoydam  miviatf Dumu pou0texnmo3iydlm2ran ont) lxrxo oo1om rai i;t)truoxm3ny1ale  neiat)aDrrxmp;u0teeoiicilt mDum(vp;u0altomr to1omD ln o;(  etoxr3iy1lle mietl( aDumxro;t4olxomfeiasla2rln o () ltnmrcoadlaD aiei ()t2urio3oo4om nlfeta(farumu  ;t0tpe mfctasls2uanvsn(4trxrxrcto1opteai ol()teur(m3nodlptnmivia()aDur(m no1tptnmociadls2umuvp ()trermf ootfmt aues t0sexm(mpoo4ape  fcsl(fa2rmurp;u4ope iocildlm eaumo;u)trtnmrcoo1lateluvo s)t2xm(opnu1omenmncil(f 2rmxm no4tpenii3tasla uanms;u4aleoxociodoptr nei;t) 2uoxr3iu4lpe mivi sfsDumx o;o1oet if3iltfa rl(ms u) leoir iodfptr n i t0 exmxopnu1om nmnei s)sDrm(mpno0tpxoiiciytfmDem( o u0alerif3oa1opDean s;s0setr(o3oy1lltn fesatfaDrmxmp;o0tptomicilt aDuaumonu) exoxf oatlp elnvs s t2toiopny4op nmnetat arrr(m ;u4apto ieiltlmDrlnmsn(4artomf3totlm rln i;s0 rxrimpiy4lm   nvsa( srtrurp;u4openmoeiltfsDeln snu4tlerif io1fmt lueslt sexmxopny1lm  lfei ()sDrrxmpno4texomoeias sDemnmo u4tleoxf iatomt  ieo s0 2trxm3iudopee nvtat)aDtmx poo0oet iicils mDelnvs u0aeeoxrcoodfp e u sls  etoxmpoydlp  mfvsls) 2raxrpnt4opt mfetysls rl(vsnt0 leomf tytlmte i s;s0s2xoxr iudal elfcs tfsDrr(r ;t1tee if3tlsfm2eln pn(4alenxr tydop rli o;(0teuoir3oo1am elncsas  rurxr nu4opx iieiytfsDrmnvs t4trenmf3oy1oaDeauvo t  etrxrpny4ll nmieil() Drrxm ot1ale  o3tldls2em(vo;(0arxomr3oytfptranvs t seuoxrpou4lme lfciat) Drrx ono1apxnmietad s rmumo u)trxnmfctydlatrlneo;()sexmxr io1alt mfesls sruaurpoo0alt ioetltfa2em(ms;u0aetrif iadfpD li slt s2tmxm3iy1lp e netasf Dua(mpno0tlt  ociyd s2eaumon(4 rtnxfctotfa eluvolt setrxm3oy4ape mnetls s2umx p;u1oex iieilsfs ra(mpnt0 etrir io1lm  aues t0 2um(r3nu1lltelnvils a2umxm ;o1oet ifciadls ranmsn(4artoio3todlm elu o;s) 2xoim3iudol   fetl() rur(  nu0tleo fctyt s rlnvo u4 ltriocio1optr u il( trum(o3oy4am  mnetatfarumxmp;u4tlxomo3iyt s2rauvs;u4tlxnir oytoa  au i s) eurim ou1amt mfvslt) Dtm(mooo1aeeo fctydlaDrl(vs t4aeermr3iydoatr nvi ()tetmxmpiydlltelfeslt  2rmum oo1tpx io3tltfa2uauvp;()altomr oy1fmDr n o t tetm(r iydlpen fcils)a2rrumooo1olxnmf3iadls emuvs;t0 exnxo3ia1fm  lneo;() etmio io1lpt  nviatf rrmumpou0ope  ociltfs2ul( o t0tltnxr3iatomDrlivo;t0t2toxrpoy4om nmnvsl()aDtau oou1aee  fciltlmDulnvo (4artnioctodla   ueslt0 etoxr iydop nmfvias) Dur(rp;u0tlenmo3iyslmDrmn o;t) lxrxr3iatfm e neo ()srxmxm iy1ap  lnet s)aDum(monu0oleomfeiltfs um( sn()tlenmfctodoaDr nes;()sexm(o iodopeelivsl(  rtmxmpou1oetnmfctld aDuanms;u) ltoxf3io1fp  anvs s0t2xr(o3iy1lp  lfesatfsDtax oot0olx iietltfs rmnmp;u4tlxoif iodlpt  uvi t0t2tm(r iudoleemfesls) 2urxrono4tleniictatfsDrlums;(0 etnmo3oydlp   ivi;(0trtoxmpoodlmeelivsl(  Dra( ono4tpe  ictltla rlnms;t0arerio iatoateauvs s  2trxr3ou4opeemnct s sruax ooo0tpt  iciad s2uanvsnt4 eeomociytoatr uvo;t tetr(m3oo4op nlnet s aDrm( oou4olxomi3iytla elu o u4aexoxoctodlmDeaivols0sexrirpoudaltemnvslt artmxrp;u1aexoioeiadlmDrln p u)aetnif io1fmteau o;t t2uoxm3iy4ole mnvta( arum(mpoo1tltoiieiltlaDua(mon()arxoxr iadoateluei s0 2uo(mpoy4ll   fet tfarrrumont1openiictltlmDrmnvp;u0aetoircty1lmDeai s;t0s2tr(rpny1al n net t a2urx pnt0oetn ietydfsDum( p t0 reoxfcoadomD luvsls trtmxr3oo1oltnlnei sfsrta( oot4oleoiietlt mDrauvo (4aleoir totlpt anvo;(  2urxrpoydol elfei t) rrrxm nt0tptnmfetyd s2ranvs;t4texnmo3tytfp  lieil( srxoio3iu4omeemivsa( sDum(r ;t0opeomi3tlt aDrln s;t4 rtnmf oadfaDe iei s)tetoio oudole  ies t  2raxm ot1optoifciadla2elumo;u4texnirctodoptrluvi s) ruoirpio1amtnlfes s)aDur(rpoo4optoiociysfm2emnmp t0 exomr ta1om  lueo t)seurimpiy4op n fciatfsDur(ronu0alx ifctasls elu ont0altrxr iydlptrauvi (0trtm(o3oo1lp nmfvt t aDuaxr nu0tpenmictysla uluvont) eerir3ia1oaD aiei s0truoxo3no1ale lfvta(f Dtm(  ;t0teen ociadlm2em( on(4arxnmociodlp rauvi;s)trurirpoydllen ivslt  rrm(m no4aptnioctysls ulnmont4arxoif oo1fmteln ilt)sexmxr3io1lp nmfvils) rrrur ot0tpt iiciadla2emn onu)trxomo ia1lateanvo s s2xoxo3ou1lm emnci t)a2rmu o;o4altn icias aDumuvo u) rermrcio1lmtr i o s0trxo(m ny1alt livsa( sDumxroot4tpe if3iysfs uanmp;(4 exnxr ta1fate ivi;t) 2um(rpio1apeemiei t sDtaxrpnt4apxomoeiytlsDum(ms u4alxnio3ootlatrai o;t)t2to(rpiydamt lfci ( a2trur ot1tlto ieiys mDrlumpnt) ltrmf3todopD  u o;( trtrxr no4omt mnct s srrrxr nt1alenmf3iaslm eanvp;(0trermf iatoptrlu sls0t2ur(rpiu1optn neil( a2tm(  oo1tlxo ociaslmDua(von(4aetnxrctytlateauvsls) rxoxo iodape mfetlsf rtaumono4aetomo3iltla el( s;t) lenxr io1lptrluesls)srtmirpoydap  lfctls a2uaxm ;o0tpt  ieiyd aDrln ont4alxrmfctadfp rlu s (  2xo(r nu4omeelfci s  2tm( pnt4olx iiciaslaDeanms u)trerxfcio1fmDelnvil(0tetrxo iodlp  lneias  2taxm ;u4alxoiictatlm2ua(vs;t0 lermf3oatoaD livi ( seumxo iydam elnctl() 2rr(r ;u0optniictasfmDran s (4artnif oo1omD  neols  rumxo oydoltelict ( aDtr(m ou0oleoifetatlsDua(vpnt4tleomo iadlateli i t  etm(rpoy4lmtemfvs s) Drm( pno1aptoiiciysls uaumsnt0alxnif oydoptr n sl(0trto(o nu1lptemiet ()sDrr(mpoo0oet  feiadfs2rmu pn(0trxoio3oodoat au s;s0srum(r3oy4ol nlicia()aDrmx  ou1ape moeiysfm um(vonu0tlxrirctytoa r nvi ()t2uoxo3iydlmtn ivs s) rtr(  ou4oetoioeildlm2em(mp;u4aeenxocio1oaDe u ol(  2uoimpnu4olte ivil()sDumxmonu0apenif3iltfaDrl(vp;(4 rtnxr3ootfmteai i;t0 rumxr nudaptnlfcilt a2raumpoo4tetnifctytfs2uanms t4alxoir3iy1oaDeai o t)srxmxm3ny4lpeelics t)a2um(ronu4apen i3tydla ean snt4tlxnmoctytfat an o s0teumirpnudaptnlici t) rra(mp;t1tet mfetlt m rln pn(0aleomr3oydoaDelu s;s0sruo(opnodal  lfvtas)arururpot4alxoio3iltla2ra(mp;(0tlenxoctatoptelu ol(0 2xoxmpiu4ll n ivtl( a2tr(r ot1aetomfetatfs2ranmo t) rxrxr ia1fatr ies t  eto(o nodame lnvsl( aDrmurpot0oltnii3iydfm2uluvonu) renircoadfpDraueol( s2umim3no1amtnmivilsfarrruro;o0opt if3iydls emnvs ()artomfctytfmt au o s)tetmxr3iy1am n ieils)srrm(m ot4aeenmocilsla2rlnvo;u4 lxrxr3todop elu slt0 2uo(r no4aptnmncsat)aDraxmono0alt mieildla umnvs ()tlxnircoatfmtrli sl(0t2xrxr3nodlm  lfvtl() Dtr(mo;o0tlx  o3ildfs2ea(vonu0texnmr3totlpDeaies;t)t2xm(m oydap e ict t)aDua(m ;o0tee iieiyslsDrln s u)trxoxr totomtrau s (  etm(o oodll emivilt)srur(rpot4aexnmoctadfa ea( sn(0tlenmr iotfmDrlivol()teurxr oodlme mieil(farur( poo0tee mfctlsla rm( o t) eeoxfcootlm  aivs;s  eumxm3ny1ope lnci t sDtm(ro;u0oee ii3iytfa rlnms;u4 etnxr3to1fat ln i s) rxm(r oo4apt  fct sf rum(moot4oleomi3ias s2emn s;t)arxoio oadlp  li o;(  2xoirpoo1lpe mfviat) Dtm(roou0apt iociatlm rm(mp () reoxf3oydoaD auei;(0
\ No newline at end of file
@@ -0,0 +1 @@
+ivsl()texo(mpnu1ap  mnvilt) rrrumpnu1apt if3tydfmDul(vp t) lxnxf3oy1la rlu s;t)sexr(opny1olt liesl()s2tm(rpnt1olt mo3iyd a2umu s ()aleoifcto1laD  n slt  2xm(opoo1ap nlivtlt)srrmx  ;u4teeo oeiyd sDulu p t)tlxnio3oydoatrliesls0setriopiu4optnmfei sfsDra( ono1tpxoiiciatfm2emnmo;u0 lxoxf3oa1op eau s;t  2tr(o nudolt  ieil( sDrrxmp;u1tpe  fctltfmDrm( o t) lenxfctadfpDe nvs;s0teuoim3io4omenlneias  rra(mp;o0tee mfcils mDrlu snt4tetoxrcio1latrlneol()sruo(opio1lmee nvi (f rurxr nu1optn octytfaDemumsnt4arxnmfcootlpD  neols seuoxr ou4ale lfvsl()sDur(m ou4oetnmieiaslsDrmuvs ()artnmf oa1lat an sl(0 2toxmpnudlpt mfcils  rtrxm ;o1tpxo ieiat aDuanms ()tetrxo3iy1lm elu i s0 2umxmpou1omt mfctat  2tmxm no1teenioetysls el(mo () etrmf3tytoaD lueo t)srurxo iy1lmtnlicsat)aruau p;u1teeniietatfm ul(mp;() eeoxo oy1fa elueols t2um(r oydll nmnctl(  2raumpnt4opx iictys a uln s;u4 exoio tadfpt auvi;t0t2urirpiu1ol e fei s srtrur ot4tptn f3iysfs el(msn(0 rtoio3oodop ran i s0sruoimpou4aleelnei tfsDtr(rpot0opxnio3ilslsDem(vp;t) rxomocootopDr ieo (  2xrio nodalte fvtas)sDuru  no0ape mf3ildlm eluvsnu0arerio ia1opDe nvs () rurio3nudal  mieil()a2trxrp;o0texn fciytla2elu p;(4 leoir iytlp  aivs s)s2xr(opio4lle mieil() Dtr(r ou4tpt if3iytlm elu pnu)trerxo3iadfaDe n i;(0 exmxo nudolte icil()sDtaxmp;o0teeomfeiasfs2rl(vs;u4texomfcootlm eaiei t srto(rpio4lme mnetl(  2urx p;o0olt  ocild a em(mp u4trtoxr oodfaDe u i;s0sexrim nu4alt  nviat  2trx oou1tpx ioeiad a uluvs;u0tlerio oytlpt lnvo s0 exrxrpoy1olte iei t s2rruront0olenii3tytlm ea(vpnt4tleomrctotfmDr uvilt  rtm(rpoodaptemfvs sfa2rmxm ;o0alto ieiysfs rm(mp;u4texoio oytfat lnvo;(  rtm(opiudlle mncias)s2taur nt4tetoiociltlm2rmn p (0 lxoio3ta1omt  i s;s) euoxo oydapt  nvs s  2tau pnt0apxnmfetyd sDra(msnu4 exnmrciotlp eliei;(  rtoxo oo4lp nlfvi t aDrmxroou0apx  o3tysla uluvpnt)altoif ta1omDeli s;(  rtr(m3iy1amen ies sfa2tm(r ou0ole mictydfa ran pnt)trenir iydfaDe nesls t2um(opnudol emivtas)sDrmuront1aptomf3tlsfs2ea(vo u0trxnioctatomD  u o;s)sexoxr3ny4am elfeslsfaDrmx ont0tltomf3iat mDeanvp;t)aetnxrciy1op r neo (0t2tmim3oo4omtelncilt)srurxrooo0oetomieiydfa2umnvo;t)tlenmo oadom r i i () etoimpiu4amt  feta(faDtm( pno1aeeoioetytls umnvp (4trtrxrctytfm r uvol(0seto(mpiudomte fet (fsDuax  nu4tlt  feilsfaDelu s u4altrxo3ta1lp  anvil()tetrimpno4lle  ivs s srtax  ot0olen oeiyd a2emump t4 exoio ootoaDranvs;s0t2xmirpoy1opt lictls s2ua(m ;o4opx miciyt m el( p;u)teenxf3oytla  au i;s0 rtoxopio4alt lnctasfsrua(r ot1ole ioctasfm2rlnvo;t4teeoxf to1fmD an ilt sexoxrpnydlmtnlieiltf 2uaxmpno0tetn fetltfs2rln pn() rxnif tytlmD  uei;s)t2uo(o iy1lmteliei s srtm(m ot1apt  feiat a uau ont)treomrcio1lm   ues;s0t2xmirpnydlptnmnvi (fs2raurpoo1alenmictasfsDuauvp t4artnmo3oytfaDeaneo;t)srumxm nu4aptnlicsls a2rmurpnt1olt mictltlm ean s u)tlerxo tydfm  aiei t)s2uoxr iy1am e fct s aruaxrpot1ale mi3iaslm2eluvs (4areoxrctadfptelnei;s) 2xmxrpiy1am   fetls) 2urxr no1oexnmieilt a ea(vp (4altrmo io1fm   uvo t0s2tm(m iu1lmee fes sfaDurx  no1oltomi3iydlaDea(vpnu4tetrmocoy1optranvo;() rur(m3iu4op nmnetltfaDtaumo;t1apxo ictltla emuvo;(0 exoxfciydlm r n o t  rtrirpoy4lpeemicsls) Duru  no4opt iietld m2rlu pnt0 ltoxo iadoa elnvol(0s2uo(mpio4lpen iviat) rra(  nu4apenio3taslsDeln p;()aetoif3oa1oa  lnvsls0t2xmxr io1lm elfvilsfarrr(mp;o4ape ifciyt m rluvp t0tltoxf3oytlmt ln i;t trtm(o ou1lmen fvslsfs2rmxro;o4tpenmi3tytfmDumn onu)tleoir3oatfat lies;(0 rtrxo3oo4altelfcs sf Dta(r ou4oexn feiasls2ra(vp t)tlermo3totop r ueolt0trtoxo3nodal nlfciltf Dtm(r nt0aee mfeiadfs eanmpnu)aexnir oodoptelnvol( teuo(mpnudlp   icsat)a2tm(m no4tlxomictyd a rl(ms;(4 ltrxf tatoatr ieslt seuoxr oy1ol nlnvtatfaDrmxm ou1opx mfeilslsDum( snt)alxnmr totop e n o s trur(opoo1om n icils) 2tmxr nt4ale iiciasfa2raumpnu)trxoif io1om e u o;()t2xr(r oo1omt  nctat  Durx  ou1oetomoeiydlmDem( p;u)treoxrciodopD  iesl()sexoir3ou1olt  fvtl(f rtr(rpot1oetn ieiys m2umuvsnt4trtnio iatfaD lueol() exoxm oy1alt  iet ( s2tm(rp;o0ole  f3iltls2rmump (0tlerxr oa1oa raivi;t s2xr(r3iy4ome  fct (f ruaxmo;o1aeeoif3iatfmDelnmp (0tlerxfctadfmDelivolt)texoxrpou4ape lneiatf 2taumpnu1aptnmfeiadlmDulnvp (0aexnmo iadfp e uvs;(0 rxoxo3nydlm nlivs sf 2ra( ont1teen ieiltfm um( snt) exrifcoytfa rluvi;s0t2umio io4lleemivt s srtax o;o0teeoifeiyd aDuanvpn(0tetnxo3ta1lpt aivo s seurxo iu1ape  iet ()s2urxm ;t0aeeo oetltfm2emuvo;(4aeerxocootopt anei () rurimpiy4lpee nvil()a2tm(mpno4tex  ociysfm2elumon(4treoxo3to1opD lnvi t)seumir nu4ap nlnviltfaDrr( ooo0aptnio3ild a2uan p;(0texrio oa1omt livil()t2toio ny1apenmicsls arra( pou0ope iiciyd a ea(mp t4aetnxr oadfatrln s ()t2umxo iy1lpteliei ()aruaump;u0oetnmociltfs emu pnu) etnir3tytfaDe nvi;t s2ur(o3ou1lme liesas srua(  ot4tltomfetydlaDuln s t) rtoxr iatfa e nesls)s2umxo3io1lp elncta( s2raxmonu4tptomfciltfa ranmp (4tlerxr3tadop   neo;t  rumim3no1op nlncsas srrrxro;u0alt mfciatfs el(mpnt0 ltnxr oadlm  aivo s)texrir ny1al elictlt) Dururono4opeo ietadla ea(monu)alxomr3oa1fa elnvi;t)sruo(m3nodam nlici t s2ua(mpnt1tlxnio3tyslmDua( s;(4arerxr ta1late iei;()t2xr(o io1ap  mfeta() 2uaump;o0tltnifctlt m2uanvp;t) lxnmr iadomDeli o s) rum(r3oodope  ictatfaDtrxrpou4apxoii3iytls eluvonu)areomr ootfaDeaues;t)t2uoim nodlleemivi tfarum(rpno4tpx moeiadlm2el( o;t4artnxrcoodoaDrai i s sexriopnodlp   ncsa()artr(mp;u1oltomfciydfm2rl( s;u0trtrxrcia1op rauvs;(0tetmimpoy4omenmfcsas a2uaumo;t0oetnmoeias s emnvs;t4aleomfciodfa   ueo s setr(r no1amtnmfctat  Dta(  nu1opxoio3ildls2ulnvo t)aetrxo3tytlaD ln s ( s2trxr3iu4alte ietl(f Dumu p;u0aexnmociyt a2emnmo u)artrxr3oytom eauvs s)trxmir iodlp elicsl()arrmum no0tlxomoetytlm ua( p t0alxnifcta1om  aieslt  exrxo3nydalee nvtat  rur(  nu0aeeomfeiaslmDrmn ont4 rtrxo3oydlpDeau s;t)tetm(m nu4ome mieta(fsrrmumpnt4aet  iciad sDeln o;(4tltnmo tytoate ivi s0t2toio3nu4oltnlicslt  Drmx  ;u1tpxn ociyt m2ul( pn() lxoxocoatoa r ueol( t2xoimpio1ale  ncs () rum(m ;t0ole  f3tatla ean o;t0 ltrxr3iytlm ran i;s0teumir3ny1lpt lies () 2urumont1olenmoeiadfs eauvon() etrxoctydfpDeluvs;() eurxm nudlltelnvsatf Dra(roou0opt mfeiadfm raumsn()artoifciatop eli i ( srxm(m oudlptemiesa() 2tmxmpot0olt  feiydfaDean p;t4alenmf ty1opDelnvs;(0s2urio3no4amt mnctasf 2rm(m nt1oltomoetat s umnvo;u0tetoio3totfa  lieo s)t2urxm iydomtnlietl()sDrm(r ou4tex  oetyt mDrmnvonu)alxrxfcia1lp e nei t)trtrxmpno4apte ncsl(fsDumur nt1tpxnio3iltla2uau p;u4trxrxr3iatopte nvils0trxr(m ou4altn fei t) rumum ;u1ape mietyd m2eau s u0 etomo iotfmD lu o;t)s2trxmpno1ap  lfcias)srumump;t4aeen fciydla em(msnu4 lenmr3todfmt auvsls)sexm(r3nu4am  lnet (fa2tr(ro;u1aptomociatfm rmn pnt)arxoir3iy1oaD  neils0srxr(r3oydlmtemfvtlt srrru pnt0tlx  f3iasfs2elnms () rxoio iydlpD  iei ()t2xmiopoy1lpenlnvs (  Dtrx  ou4aetnmfeiytfaDel(monu0arxoxf3oytoaDeauei;t srxmir3iy1ol emiesls  2tr( pou4opeo f3iat s2ulnms;t4altoiocoodoptrlivi;t texoxrpno1llt  nvs s)a2raxr ot4tptn oeilslsDumu o;()aetoio3ta1fat  ivs t0trur(m3iu1amt mnvtat) 2umuronu4tptoifeiatlsDrlu s;(0 eeoxf oatom r nvs s) 2toxopou4al nlnes (  Drmum ou1teeoifetlsfs2emu snu)tlxnio3iatopt aneols0trur(r3ny4aptnlnvs tfarrmx  ou4oeenif3tyd m2elums t4texnir3oodfm  luvi (  eur(r no4llee ivta() Duaurooo1tex  octytlm2eau s;(0teenxf ta1opt lieo ( s2xr(opiy1alen feia()arta( p;o4oexoiieias s2uauvpn() lxnmocoydfaDeaneils)sexm(r nodlpe lfvsat) Drr(  oo0tetoioeiydfs rln s;(4 ltnxocoydfm r ueilt t2to(m iodll  mietls)a2umurpou0alxnifeils m2ul(vs (4aleoxf iy1oa rlueo;t0seurxrpoudlmeelncia(f 2rmxm ot1aeeoifetydfaDum(vo u0aexnmo3oadfpD  nvs s0 2urxmpno1ame lfci (fsDrmxrpno4opxoiieiydls rmu s u) rtrmrctadop   uei (0sruoxmpoo4oltnmies t)arrr(  ou4tlt iicilsfa2uanmo u)arenio oodlmDelu i ()srurio iu1op nmnes ( sDrm(m oo0olxoiocildlm uln p u)tltrxo3ty1lpDelnei;(0 etr(m oo1oltn nvil() Duaurpnu4aptoii3iydla emnms u)texniociytoa raivo;s0 rtm(o3oy4al  lfcia(f rumu pno0tpenmociad aDum( p (0altoxo3iadop   neol(0sexoxopou1apt mfci (  Dtmur ;t4tpeo ociytla2elnvp u4 ltrmrctydlptelu s;t0setm(rpny4olte fcsat aDrm(rpnu0apeoiiciat m rmn p t0aetrxoctydfm raiesls  rurir nudlmen ivt (  2tr( ono1aetn fciytfaDelnvs u4 eenxf3oytlmte nvs;( trumirpoy1op e ncias s2ta(r ;t1oee  octysfa eau o;u0 rtrmo3iy1opDrauvi;(0 2toio3nu1olt lfvsa( artm(root4tlxoioetadfm eaumsn(0tetomf iodfmDelu s () 2xmxm3oudlmte fvslsf Drrum nt4tpe ii3tldfm2ua(mo u4 lerio ootomtraivs;s  ruoim3nydalen feilsfs2umx  ;o1olenmieiysla2rauvp;() exrmocoodoa rlnvi ()t2trim3ou1lme lnvilt)arraumoot0teenmocilsfaDrl(vont0 rtoxrcoadoaDrlnvol()srumxr oy1ole lnct ()aDuau  ot4apxoii3iys a rau pnt0trtoxf3oydlatean sl() rtmir3ny4am e nesatfsrururp;t4tpx  o3ilsla rmnmpnt0aeenxrctadfm   n o;s)t2uo(rpny4ole  nvsa(fsrtmur nu4oexn i3ilslm ulu o u0trtomr oydlp r ues;s) rtrxopoy1omtnmfcsl()sDrm( pnt1oeenmo3iaslmDulums (4aexnxo ia1faDeau olt)s2xo(opoudaltelfci s  Durur nt1alto oeildlm ea(vp;u4aexrmr3oa1fpDe neo;s0texmim3iy1ap nlnci (  2taxrp;t0tpt io3tad a2elnmonu4tlerif iadfpD  ueo;t0 2xm(o iydom nlfcs ( a2rmx oot1opx iociasls emu p;u)tetnxoctotlp eluvo;s)t2xmim oo4ame  nvtlt  2uau pnt4teeo o3iydla rl(vo t0alxnxoctatfpD auvils)teto(o3ou4lm  mietat) Dtru ooo1apeo fetyt aDua( p;u4tlenif3io1lat ai sl()sexoir nudlleelict (f Drmu p;u4aexn oetad s ua(vs u0texnmf3iodfp  anvs;(0 rtrxm no4openlnci ( aDtr( oot4tlen ieiytlm rl( s;()tlxrxf io1lateln s;t  rtm(o3nydllt  fci s)srua( oot1tpto o3iys m emnvs t4trxrmrcoa1lpte iei s tetoir3oy1om   nct t  2rm( ooo1optnifciys mDuluvsn(4trtoxo3oytomDr ies;s trurirpiudolee fvsls arrr(rooo0apeoio3iltfa2ulnms;u)alxomocoatfpDr i i;t)setr(m3nu1ameemfes s) Drmxmont4aptniietysls2eau s;u0 lxnxf3oy1oaD livi s t2tm(opiydoltnlneiat)aDumxroou4oeto feiysfm2el( o t4 rxrir3to1faDelues ( s2xrirpnydomeemfvtls  2rm(r nt1texniietadfs2ul(mp u4arerxf oytopD  n sl(  2uo(r3no1lpeemicslt)aDtru p;t1olen i3iadfa2ra(ms;u0texnxocoatoaDr neo t) 2xmxm3iodole lfvs ()a2rmxmpou1alx  iciatls2umnvp u0areomf3todfatraneo s)s2uo(r3iudalt  feil()srraurpnt0oet if3tyt a umn ont0tetoif iatlp   nvs t)srtr(o3nu4olt  netltfa2raurpnt4aleoiiciad a ea(msn(4trtnmf3ootoptean o;s srtrxr3ou4lp elnci s sDrr( oot1texomieiltlm2em(ms t)tlxoxo iadoaDr i ils)teuoxo iy1ll   icsl(fartmxronu4aee moctatla2elu p;t4trerxo iotfat  ueil()teuoimpnu4ame  fes s) rtru pnu1ale  feilsla2eau pn(4trxrmf3oatfp r nvils0t2umiopoo4amen ivt ()aDra( ont1opeomfeiadls uauvo;t)tetnxfctodfatrlies t0s2tmxrpoudameemfcias aDum(  ou0opxn f3iytfmDuaumpnt4trxomr to1faDeli ils trum(o3iu1lm   nvs (  Dua(r ou4optomi3ias s emuvs t4arenmr3ta1lat  nvslt trxr(o3iu1ap n iviltfarraxmo;t4ale mfctadls2uanvsn(0 ltnxf oydla r nvils0srxo(r3nodolt mfesa( sDrax ont0texn icildfsDemn pnu)tltoxocoytfmDe u s;s0srxr(o3iy1omt mictl(fsrua(r ;o1olt  oetat aDum( o (4 exrio3oydfp eanvolt  rxo(mpou4lmtn ict t s2raxm no4tet iieiaslmDum(vont)arenio to1la   uvs t0seurio io4ole mivi t) rrm(  ;o0alxnmietat aDrmumonu) lxomfcoatlatr nei ( s2tmxrpnu1aptn fetl(fsrtmu pnt1oeeomoctydlsDumnvs u)arxomr3oy1opDr ues t s2uo(mpoo1omen fvt s  rta( poo0oee ii3iyd s ulu snt)altoxf3iydlm  lu o;t0 2tmxmpnu4llenmnvs t)a2tm(ro;o1tetoiiciytfmDumu o;(0aeermo oy1lm ranvils  exm(m3ny4aptn icsa(  rraurpou1ole  f3ilt m ra(msnu)aetomfctydopDeaneils0trtoxmpny4ol emnetas a2raxmoou4altniocils aDuanvs u4texnmfctatlp   neols)sexmxrpiu1lmenlici t)arurx oot4alxo fcilsfs elnvpn() rtnmf iy1fm rai o t  rumxr3iudameelietat srra(m ;t4tpxn ociysfm emn p u0 rermocta1oaDraneo (0 euoxmpnodalee fcsas)aDtm(mo;t4texo fetytlsDulums u)areomo iy1lpD aiei;s0t2trirpno4omen fcil()a2umxm no0opx mociltfs elnmon(0arxnio3ia1fatrlueolt) exm(r3nudopeelnvil( aDur(rpot0optnmfetyd m eaumon(0 leoio3iodlmtr i o;( s2um(r ou1al nlnvil(  Draurono0alxnifcilsfsDuan o;t0texoiocia1la rlueolt) etr(o nu4lleemfvia(f Dumum ou0tpt ifeiydfa eanmo (4artnmrcoadoat au il(0t2uoio iodapt  iesl()artrx o;t0olto fetlsfsDumnvp;t4tlxnxo ta1om  lieo s0 etmio3nu4apenmfctas srraxrpou0apeo o3tyd mDeanvonu0trenxr3oy1fpDr neo (0s2umir3ny4altelictltfarurx o;u4opxoifciatlmDem(ms;u0treoxr3ta1fpD  u sl()srxrir io4oltelneilt) rtrx  ou4tpeoifciydlaDulnvsnu4 reomocty1fm eaueols) etrir3oudomt  ivsas) 2tmur nt1aex  fciatls2ul( s t)alenmo3tytoaDr u s;()texo(mpiy1lme lnvs tfs2ur(m ;o0tetomfeils a ulumonu)arxnmf3iadlm ranvsls truoim iydale  iet ()sruau o;t1alenioetyt a2rm(vp;(4alerxf to1lateli i s0s2xmxm iudal emictas)a2tm(m nt0aptn o3tad aDra(mo ()aetrir3oytlpte u slt s2tr(m iy1alt miesltf rurumoot1opxomfeiyt aDumumsnt4artrio iydfate uvi s0 rtoio3io1al  lnci s) Dtaxr ;t4tltnmi3tatlsDul(mp;t0 lxrmo iy1fmt  ivi ()tetmxm iodap  lfvs t arra(mpot1altoif3iysls rmnmp u4 etomfcio1optrlieo;s t2tr(opio4altn neiltf Dumumont0ope  ietat a um( p (4trxrxr3todoa rliesl()s2toir oodole mfei s s2umxm ;o0alt ioeiasfa em(vonu0trenxr3totfpt lnvsl( s2tmxmpoydllen fei t) 2rrx p;u4oet moeildlsDumums t4 rtrir tytoaDr uvs s) exoxm3nodll emneil(fa2rrur ou0teeoiiciyd s umn pn()tetoxoctotlpD anvils0sexoir3nydome micias)aDraump;o4opeomietasfm2eau p;(4arxrmocoy1opt lnvolt t2to(opoy4opeelneiatfsDraum oo4oexoiocildlaDel(mo t4aeenmr3to1oaDr ieol(0s2xm(o3io1ll e fvtat arrmu pou4tpx  i3tadfsDrl(vo;() exoifcoy1oa eaivols0 exmim no1lpt lictl() Drmuro;u4tetnmo3ilt s2rm(mon()artoio3oa1oa  li i ()srtm(r3io1lmeemictl() 2tmxmpot0altomfcilslm rm( p (0alxrxf oo1omtr ies;s s2xrio iydoptnmncia(fs2taur no4tlenmoctysfmDrl(msnt)tlxomo3to1laDr i i t teuo(rpnodomt  ict tf Dtr(moot0tlxn ocias a umnvp;()artoio3ootfm rlu i;t0t2to(r3iydlpeeliet (f Dra( onu1tlen iciyslsDua(mo (0tltomf3oa1la e uvo;(0trur(r3oy1oltemneta(faDraxrp;o4opeoioetldfaDra(mo t)tlenxo ia1lmtraivo t0teumxr3oy4amtnlnvil(  Drrurono4ope ifeiasfmDelu sn(4treoiocoodfp elu olt teuoxr nu4alee ietlt)srumumoou4aet mfeiys s rmump;(4tlermr ootoat luvs s0trum(r oydll  mfviltfsDrau  ou1aee  oeils mDem(vs t)aexrmo3totomt aneols0t2tm(opoy1opt lfesls a2ta(m no4aex  f3iys s rlnvsnt0 rxrmo3to1lpDrauei (0 2xrxr iy1apenmnctasfaDum(monu1alenmoctldls raumont4arxrmrcoydfp e nei t0trtmxopiu4opeemicia()sDrr(mo;o4oltoif3tydlsDrlums t4alxrmfciodfpt lnvi (0 eur(m3iydam nlnei tfaDtmump;o0opt ioeilslsDraump;t)tetoxocta1oat ai ol(0 rxmimpny4am elnvi ( arrmxm no0oetomfciat s umn p;t4 lerxfcoo1opt  i il( t2xrim3ny1lpenlfvslt s2rr(mpoo1opx ioctyt s ul(vs ()trtnircoatlpteaues ()teumio3iu4opeelict sf Drmump;t0oexomoetatfs ea(vpnt0tltrio3ia1lmDrluei;()truoim3io1ape lfctls  2taxmp;u0tptomieiydfsDuluvpnu0texoxocoa1oaD livs;( texr(rpno1ll n ivt t)a2ur(m nt4tee if3iyt mDuanvp u) lerxocoatlm rauvi ( s2xm(o io1optelnvil(fa2ua(  ;t1tptnioeiatfs rauvpn()tetoir3io1lm rln s;(0trumxr nu4olee iviltfs2trxrp;o0oleoif3tyd mDul(mpn() lxnmr oy1fp r ivil(0teum(mpoydam  livtl(fsrtr(rpou4oee ifeiadlaDel( s t0 lxnif3io1lp   uvs;s seuoxrpiodalenmnvtls) rtmxm nt4aex  octasfm uln pnu)aexoxr3tydfaD au i (0 2umio nu1aleemivtls  2umx pno1ole mf3tatla2umuvp u4artoxr ta1optr nvo t0 2uoxr3iydlpt  ics tfa2rmur ;o1tltoio3ilsfm rm( s;u0 rxnxf3tatopD  nesl()texoim ny4apt  fcsls srumx o;u4openif3iatfm2elu o t0 renmf3oatoaD  ieslt0srtrxm oodlleemfvtl(f Dtru p;o1teto feiyt sDrl( o t4 rxnif3iadfmDrlues t s2uoir io1apeelfctl()s2uaxmpnu4apx mi3iatls2em(msnt0 renio ty1lpD aues s)seurir ny4lp n feiasf 2raum ;u4tetomoeiatls2ulu o;t0teermf3ia1late i olt0teumxopiu1amenlfctl( aDrr(m ;u0ole moeiyd s em(mo t0 lenxfcoa1omDrluei;s0tetmir io1ap nmfvs t a2ra(m ;t0apx iicilsfa2rmuvo;t0trtnxo tydla r u i;(0teum(mpoydapeemncilt a2rm( p;o0tltnmfeildlm2emumpn()arenmr3to1oate nei;( trurxm3nodlpe lfetls)a2urum nt4oeto feiyslsDeaums;t)aetoir iodfmtranes;t srtr(m3nu4om emfvsl(fsrtrumo;u4aex moeiltlsDeauvsn(4texnmf iydfmDrlivsl()seto(opio1am elnvtat  Draump;t4oexoiociat s rl(vp (4trenxf oo1fptrli s;t)s2uo(o3oy4ap emiesl()a2rrx oot4aleoiictltfa2umnvo;(0trtnmociatfateaueo;t0srtr(m iydolt mnviasf Dtrumpou1tle mo3iydfa2ra(mp;u4tlxnif oytlptrluesl()sexr(m3iu4lleemnvsa( a2tr(  nt4oetomieiyd s umn pn(0arxnmrciytfaDe ivs s0sexoxr iudol emici tfsDua(mooo1tle  i3iatlaDrauvpnu4tlxnxocia1omDrli ol(0teuoxr3ou4lm emivi s aDtm( pno1tle ioctytla elu o t0altnxr3oadlpDelivil(0 rxmiopnodol n ncil(fsDum(ront0ape  oetys a uln pn(4trerxf3tytfmDelieo (0truo(m3iodol nlneta(f rrrum ;o0tpx ifeilt aDuanmonu) eeoxfcoy1lp elivo;s) etm(r iydlptn nvsl()srtr( onu4open i3tydlaDuauvo;u4alxrmf oodomDr ueols0 2toxrpnu1am   nei s  Dtru poo0tlt  oeiadfaDemu o;t)tlxnir ty1oaDrau i t0t2xmimpnudomte fesls aruaurp;u1alxn oeiad s ulu s;(0texnir3oydlaD  u ilt teur(m iy4ol   icsat)arurumpnt0oeenio3ildla2rm(vo;t0texoirctydfmDrlnesls0t2urxr3no4op elivsl() rtr( pot0alxomo3tadfa rlnms;(0 rtnmrcio1la rluvs s) rxr(opoo1lm nmnctls)s2uru p;o1oleoio3iytlaDelumo;u0 rxrxo iy1lp rlu i;s)trurxo3iydolenlieiltfsrrm(rpot4oet if3tadlm2ea(mp (0arxrir iotfp eanvi;(  2tm(r iodoptn ivtlsf 2raxmonu0alto o3tltfm uau p (4trxrxo oodoate n o ( setmiopnu4lpe  fctlt) 2rau  ;u0aleo feiltlmDeluvo;u)artrxf oadoaDelnvslt tetoiopiudape mnct ()a2ua( ono0tlxnio3tld sDulnvpnu0aexrmo ia1omDr u i t0 2uo(rpiudom nlfvtlsfsrra( poo0tltnmo3ilt mDrluvont0aetomr3oa1oaDrlnvolt sexriopiu4omt  ieia() rumur ;o1tex  ieiytla2emnvsnu)arxrif3iytlmtrluei;s)setoxo3nudlmen fetas arurx  ou0aeeo ocias sDum(msnu0 rtnxfcty1oa  aueols0trxo(o iu4open neils)sDua(r ot0aleo oeiatfmDemn snt0arxnxfciotfpDr u olt0tetmxmpiu1lp e fetlt) Dtaurooo1oetnii3iydlm umnms t)trxrmo3iatfmtrauvilt  rxr(o3no4alenmict sf Dtmxroou0tlx  ietysfaDemnmp t4altrmfctotlm   iesls setm(opny1altnmncs sf rurxmo;u1alenmicildfa uanvs;u4trxomo ootla r uvols) 2uoxrpiy4amt lncs s  Dtau oot1altn ieilt m2rauvsnt) eenircoodopDr nvils0trurim3no4am   iet t)srumxmpnt1olxo f3iatfaDum(mpnu0arxoxr3iodlaD aieols0s2tmxr nudamtnmiciltf 2raxmoot1opxnio3iat s umnvo;(4altoif oo1lpDr nei;s s2to(r3io4omt mfeia(  Drrxr no4tpx mfctldlsDuan o (0 rxnifcoatfaD livsl(0t2xmxrpiydomen fesatfsrurumoot1olenmi3iatfmDem( snt0teenmo tadfmt lnvs;s)t2urirpnu1lm emfvslsfaDtm(m ou4tee  f3iadla2ua(von(4teeoxr oydlpDr neo;t  rurxo ny1ll nmivil(  rrax pnu0opto octld aDuanvo;t4 ltnif3to1fat ln sls tetm(o oodlmtnmieta()sDra(ro;o1apeoifeiys mDra(mp (0 etoif tatlpDeauvo;s trxoir3nu4lme mnvi (f Drmxmp;u1tpen o3iad m ulumo;u) eeoxr3iydop elu slt) exr(mpoo1ol elfet t  Dtr( ono4tee moeiys sDelu o u0alerxr todlm elneo (0 rurir iu4ope mneias)s2taur nu4alt iictltfa uanmp ()trxrxr3io1om e u i;t  2xoxmpiodllen fvsls) 2rr(r ;t0tpxnifetys m2emnvo t)trxoifciadfaD anes;(0srumxr3nydol emiei sfarrmumpnu1apt ifeiydfs eanvs ()aetoxocoadfa e nesl( texrio3iy4am nlfvi sfarrmu p;u4aexn ieiadls2ranmp t0tltnmr3oytfptean o;s0 rtr(o ou1apt mfetat s2um(rpot4aexn i3iyd m el(msnt4teenio oytlm eaiei ( seurxo oydlptnlfesasf 2tmur nt4olxnmieiytfm rmn sn()teenmf3iadfa   n i;s0 rtoxr no4lptemieiat)s2truroot4ale  f3iad mDrmums u0trtoio ootfpD  nvslt) 2uoxm3ou4olt  nci ( aDum(rooo1aeenmfeiad sDumn pnu)trtoif3iytfa  aneols  eur(r3nodlptelivi t) Drm(mpou4teto fciytfaDemnvsnt4aetnmf3iatop eaieil()s2tmxr3oydopt  iviat) 2tau  ;t0oleoiieild mDum(msnt0arxrircto1op  auvs t)t2uoimpnydlmeelfeias s2tax oou4altnifeiydfa2umu s (0texnxocoo1fa  aivo;s  eum(m iudap n ncsa(  2rruront0openmicilt m2ulumont)alerioctatfa raivs s0s2urim3ny1op  mfvsltf rrrxm no0olenmociydfsDrmn o;(4arxoxrciytop raivilt s2toxr iydlpte nctlt  Dtm(m ou4aeeomfctydfm umnvs;t4tlenxo3oo1omDeau i;()tetrio oudlpe mnes tfa2tr(rpnt4optnmi3ils a2umuvo t0alxnxr3oy1lmD  ies;()trto(o nydlp emiciltfsrrmxmono4alt iieild s2uluvp;u0trerxo to1fm  lu sl()texm(o iu4lltelfvslt)sDuaurono0aptomf3iyt sDem( o u4artoxoctadoa e nei t0s2ur(m io4aptnmnctlt  Duax o;u4oltnii3iasla2eau s u0teeomo ootfmt ai sl( s2xr(m no4lltnmies ( aDtau onu4apen ictat m2umnms;t4tetoxo tytfpDr nvolt)sexo(rpio1op elivsa() rtr(mpnt0opt mi3tytls2ua(msnu)tlermo tadom eaues;t)sexoxr nu4apte nvs t)s2uaum ou1tpt io3iad m2rmuvs u) lenmo iy1la rauvs s0trum(rpio4alen fetl(fs2ta(  oo4tpe  feiltls2ulumpn(4aexoif iydfpte ivo s0seumxmpnu4ape mivtlt)aDumxmoot1tetnmf3tyd m emuvs (0trtoircoytop r u ols0s2tr(m iudlmtn neslt)sDrmxrpnu0oexnio3iltlm el(mp;(4alenxo ty1omDran i () rto(opou4alt  ictls  2trur oo1apx  fctad s2uauvs;(4 ltrmf iatom e ivi t  euoxo iy4om emiesas)artrxmont4tlxn fciatfm eanvo u4aleoxfciytlaD aivo t)s2toxr iy4oltnlneils aDrmum ;o1tpe  ociadlm rlu s;t0 ltrxf3oytopDrli i;s srum(o io4omte feils  Dtmxm ou0tetnmociytlm uau pnu4trxrif tatoatelueo;t)srurio iudlm emictl(  Dtr(mo;u4alt if3ias s2uanmp;t0 leoir3oadom   uvil()truo(rpnodllt mivta(faDrm(mo;u4tpxn oeiytla2rmump;u4trxoxf iatfmDrlivo t t2xr(r oudlltnmfvtl() Dur( pno1aet ifcildfs em( s;(0 lxnmfcoa1opte uvsl( t2xr(m iy4olt mnvtlsfa2tax  no1tpxnmictydfm eauvo;t4alerxr3ia1omDraneo s)trtoxm3oy4al e ivs t  rtrurp;o0opxnmocilt aDrauvsnu0tltoxf oydom rlivols0setrim iydalee nctatf Drmumo;o1altn o3tysfmDea( p;u)aexomfciytlp rlu s;s) rtrim iudlle miviat)s2ur( o;u4oex io3iyd mDuanvpnt4 etnirciy1lmDr iei;s)sexoim3oy4optnlnvi ( s2rm(mono4tlxo oetytla2rm(vs;(0treomr tatfmDe uei;( t2xrxm iydamtnmfcs (faDururooo1opto feiaslsDran onu)texrxrciydopD  u o t t2urxr3io4lmte ici () Duauroou1oeen oetad a rauvo t) rtnxocty1op e nvs t0 2tmxmpny1lpenmivsl( artmum nu0texo i3tld m ulu on(4teenxo3oo1opDe nei;t  eurim3oo4olte fesltf 2tr(rp;t0tleo i3tldfm2rl(mp;t0trxriociy1lm raiei;(0 rur(opoy4amt  icta( sDta(m ;u0ope moctldls uau s t4tetrio oytoptr ivi;s seurim ny4ame  ieslsfsrtmum ;o4tltn ieiat aDrlnvs t0 lermfcta1fptean i;s)srxmxm3oodopte iviat aDtaxr nu1opxoiieiltlm2uanmonu0 rxrif oo1latelivi;s0 2urxm oydopenlnesas s2ur( ont0altnmieiad m ulu p ()teenxrcoa1fa rauvo;(0texm(m oo1opt lics t sDtr(rpou0opto fcilsla rm(ms u4altrmrctotlmD aues () 2um(rpoo4altnmfeiat  Duaurpoo0oexo o3ildls2umuvo u) rxrmfcoo1omD  iesls  rumxopoy4ale  ncsas)sDuauronu4oleniicils mDuan o (0 leoifcoy1fmtelnvils texoxo iy4omeelnvia()aruru ono1opt moctadla2ul( s ()trxnxf oy1fpDrlnes;(  exmxr iodal nmieiltfa2rmxm oo1aetn ieiasla eaumo;u)tlenmr3io1fat li i;s0trtmxm iu4lmtn fet s)s2uau  nu1altoif3tadla2emu o u4areoif3oydoaD  nvols  eum(opoydllenmnvs sf Dua(mpnu4oet  fetyslm2rmu sn(4alerif3ootlatelivilt0 2trxm no4altnlfvsls) rtaxr nt1altoiictls mDeluvo;t0aeenif oytfaDr u o;() ruoirpou1oleelnvtls)aDrrx poo0alt ii3ias sDrlnms;u0trtrxociodfmtrlnvs;t0texo(o3iu1aleemivs t)s2rmxro;o4oexnmo3iatfm rlu s u)altomf3tatfa rauvi t)sruoxo3iy1lltnlictlsfa2urxroou0aptnmi3iaslmDrl(vpnu4tlerif3iodlpDr nvo t)t2xr(o3iy1omt  fvs t arra(m nu1tet mf3iytlmDua(vp t4 exnmf3oy1omDr ueo;t  2uoir iudaptnmicilsfsDta(rpnt0tlt ifeias sDrlnvp;u)areoxrcta1opDeaues t0t2xoxr3nudlm n nvtlsfaDtmxr no0oeto fetydfsDuanms ()trtoio oydlmt luvi s0t2xo(m nodlp nmneiatf Dum(r nu4aexnif3tltfs uaums t4alxomr iodopteli i t0trxmim ny4lmenmici tfs2um(m ou4olt mf3ias a2umuvs;u) reoxo iatfm e u slt0 etrirpiy1omt  ieil() Dta(  ;u0aet ifciytls ulnms u0teermfcoodfptrlnvs t)teuoxo3ny4oltnlicilt)arum(m nu0olxnif3iyt m2ulu p;t) exomo ootlpDeanei (0 rxmxm3nu4opte ivs t a2uaur no1oeeoifctyd sDeanmsnt)tetnxrciydop raueil(  2tm(opio1am emfci (f Drru  no4apeoifetlsfm2uluvs t4 rtrxo3iadfmt  ueslt)teuoiopoodamtelieia() Dtru o;u1aexoifciytlm ea( pnt0trtrxo3ootlp e ivo s)seuo(mpoo4op n neias) Duau  nt1oee miciadfa ul(msn(4aetnmr ta1la rlneol() rtrxr oy1ope mieiat)arurxmoot1oex  ieiyd m um(vs (4 lxoxfcoytfaDeaneo;t)sruoio iu1lm emnes tf 2tm( pnu4tle mf3iyslmDelnmo (4trtrir3oy1fp rau s;s srtmxr3no1oltn fesasfa2urumo;o0tptnmfciasla ulnmp;()teeomf3oadlp eaiesl() etrir3nudopenlfcs s)s2rrx  ou1tex mf3iltls rmu pnu) lxoxo oo1lateau s;t  rtm(r3oydop  lnesasf rurxr nt4aexn fciyd m2ra(msn() leomrcio1optraneil(0tetr(rpio4lp e ici ( arrm(mpno0tetomi3iad s2eau p;u4 rtrmo3ty1la  lu i t  etoxmpoodale mies () 2urxm nt1aexnifctltfm ean p () leomf ty1omt lneo;(0s2xo(m nu1aptnmies tfsDrmu  oo4tex  i3tydfm el(vs t0trtrio iydopt lueils trxrxrpou4ll n ictl(  rrm(mp;t0tex mi3iadfa2elu p;u4 ltrmrcto1fatrlnvi t sruoxrpio1op e ivil()aDumxmoot0teen iciadlm uanvp (0trtrxr iotomD lueil() exr(o nudalte fctas)a2umxmoot4apt  iciydlmDranmpnu4arxomf3iodomD lu i;t0s2toirpny4omtemieilsfsrrrx p;o4oetniociltlsDeln o t) rtnxrcootfaD lnei (0t2xoxopoy1op  lnvsl( a2trur oo1oltoiicild a ulnvonu0texnmfcto1laD  uvs (0teurxo3nudamtnmncsas srumu  ou0aet  feiltfmDranmsn() ltoxocootlmD  i i;s0 exoxrpny4lm n ncilt  2ra( ooo4optnifctltls2rmumpnt) rtomo3iadlaDr uvilt)srtm(opnydapenmiei s) rrm(mpnu1oexomi3iltfmDraumo u4 ltrmocoo1lmDr nvols)t2uoiopou1am nlivi (farum(mont4oee  fetydlsDrmumo (4 rxomocoydfat  uvs;s0 2urio iydamtemnviat)aDur(  nt0oee  oetytlsDum(vo u0texomo3io1omtelivi;s0trurir3ou4ap nlnci ( srurx pnu0apxoiictat m2emnmp;t4tltrmfcoa1fa rlnvi;t0setrir oudal e nvil()sDtaxmo;t1olx ii3ilt aDemu s u0 ltoxo3ta1la  aneols) eto(r io4op emfetltfarta(r ;u0teen fciydfm ra(vs t0 rxnmociadlaDe uvi;t0teur(o3ny1ol n ictl( sDua(  nu1oleniiciyd aDumnvo u4 etoxo tydlaDelieo (0 rur(o iy1om nlici tfsrtm(rpoo1tlxniiciydlaDeanmonu)artnxr oo1opteaneilt) 2tm(mpiydaltnmnct () 2uax  ;t4tet mocildfsDelnvsn()aexrmo io1laDrau s;t t2trxopoydlm  mfcs ( aDtmxrp;t4tltnmieiysls2um( o u0tetrxo oa1lp r nvi;s)srumxr nydapte fvsa() 2uau poo1aeenioctydfmDua(vo;u4 reomo3iy1lm e ivs ()trxmxm3iy1am emfct sf 2tmump;u4texn fetltfs eluvp;t4aeermocoatfaDraieo ()sexr(o nudope  iciasf 2tr(r ou4opx if3iytla2ua( s;()arxnmr ia1fpt anei;t0t2xm(m ou4lmenmieiasfarum(mpou0tetnmfetld s emnmo;u4tlxnio3oo1lmt  n s;t0trtoxo oo4lpeemnctlt) rtrur ;o1opxnmiciytla2rlu pnu) rtrxf3iatfptr ieil(0 2xr(o3iu1lltnlncsltfaDuaum no1tleomf3ilsfaDelumsnt4texnxo iytfm rlueil() rtrxo nu1altelfvtltfsDtr(moou4olenifeias a ulums u4tltnmocoytomDe nei;t teto(o nodamtemnesa(f Durx  no4altoif3iadla2emn s u0trtnio3iy1fm eln i;s0 2uoio3iodlm  lfcias)arua(rp;u1opeo feils mDum(vonu4artnmocoy1omte uvi s  rxoir3iydop   fvi ( sDrru  oo1oeen fctltfs rmuvp u0 lxrmf3iy1opDraies t0 etrim nydapenlietl() Drmuronu1aex  f3tydla ul(vo t0areniociytfateauei;s trtrxo io4apenlnet (fs2uax pno0tpto oetasfa2el( p u)aeeoxf tytfmDeli o;( t2xmio iodam elfei sfsrta(mpnu0oet ioctldfs rln p;(0 rxrir tatfm  ai s;s  2xo(o3iodame lnes ( srraxmo;t0tptomo3tys a rm(mon(4texrmr iotfm e ivilt tetrxr oudomt mivt ( a2rr( o;o1aleomiciytfs2ul(vp;u)altoxo oadlpD li i s s2urir3io4lmt liesa( arrm(mpou4tlxo fciadfsDulnvp;()texrmo3oy1fp eln s;( tetmxrpiu1ol e icilsfsDua( p;o0oltn feias m2umn s;u)altrmr iydopt  nei;t0 etmimpnu4lpenlieta()s2rru  ;t0tlxniiciytfaDel(mo;u0treomo oadlmtr ivs s) 2to(o nodamee ivs t)sDuau ont1opx  fcilt m2emnvont0altrmo ta1faDr ies t sexr(r iy1al  lnctat  Duaxr nu1oetoiiciyslm2emnvs;u4altnmrcia1fateanvsls t2tr(r3io4ome  fei sf ruax  oo4tpx ioetasfaDrl( p t4tleomr todfmDr ueol( tetrxmpoydap   ictat aDtrur ot0tlx mf3tadfa rmnmo t4 exrir3oa1laD  nvsls s2to(r3iy4lptnmiei tfsrrrxrpnt0olxomoeildfs ua( p (4artnmr3iotlmDean i ( s2xrir nu1apeemfct (f Dta(  nt1teen octlsla2emnvsnt0alerio3oydlaDelu ols)sruoxopny1lmenmfcil( a2ur(mpou0tleomieild sDum(vp t0trtrif oodopDe i il() 2trim ou4ope mnetls  Drru pot1olen f3tyt a2ranvo;u4 eeomo3tydlate ieol(0tetoxmpnu1alt  fvt t)srrmxmont1alxn i3iytfsDul( pnt4treoxf iytfmDraivs;(0s2toim iu1lmt mfcs s  2rr(mpnt0oltnmfcildla el(mp;()trxoio ootoat aues;s0setoirpoy1alte fvi s sDtm(mpou1tpe mieildla2umump (0 rtomf ta1fpDeauvi;t setoim3iy4ll  lfvsl()srurxmpoo4apxn f3tatls2rmn snt4arxnxocta1lpDr nvilt) exo(o ny4apen nctl() rurxronu1tpx  oeiyd s2umnmsnu0 etoifciodfmte nvols0 eurxo3iu4op nlivt s)sDurumono0alx  ieiyd aDelu s;()tlenio to1op rauvo;s)srtoirpno4ol   fcs tfsDtr(  ;o0opeo fciltls el(ms (4 etoircoydomteaivs;()s2urim3oy4amenmfvsas)sDrmxr no1tpe  feiatlm rmu p t0 lxrxfciy1oa  lueo s)t2tmir3oo1op elivils  2urxm nu4aexn i3ilt m2em( pn(4trxoif3totopteaues ( sexoxopno1amtnmfetat sDuaurp;o1alx ifeiysfs2ean on(0altrxf3iotfp e ivils)sexo(o iy1aptnlicsasf Dum(r ;o4aexo f3iyt aDea(msnu4treoif3oy1lmDeauvols trto(rpoy4ome mfeta() rrrum ot0oex  feildlmDrlnvon(0aetoio oytlaDeau s;(0srurxmpno1op  mies ()aruau  nt4texn fciatlm umnmpnu0artomr tytfatr i i t s2xm(r3nydlptn iesa()a2rru  nt0tlxn oeiyd m ua( sn(0aexomf3iydlm   ivi;s0 euo(m io4op e nct t)arra(  ;u1olt mf3tydfmDem( o;() etomo3io1lp r n olt)sexr(r oy4opt lnvt (  2ta(mo;u0tet ioctydfmDua(mp u0trenxociatlpDeaivols)texoimpiu4optelnvi tf rum(r ;t1tlxniictatla el(mp t0texoxr3iytopteai s;t0 2toim oo1llt mnvi tf 2tmur ;t0openmo3iytfa rl( onu) etrmr iadfa elu s;s) rtmio oydap nlfeia() rra(  no4aetnmi3iat aDulnmont0aexrir3iadoaDr nes s tetrxmpou1lm  lnvsl(f rrr( pno1aexo oeiasfaDemnvp t0 exrmocto1fp rlivo s)tetoim3io4om   fvsa(  rrmx  ;t0tet if3ils sDran onu0teeoif3oodom raueilt) rxmio3nu1lme  nci (f 2um(  ou4tpeniiciad m ua( s;u)arenxocoo1opt ln o;s0srtoim3oy4ame  nvtat)srumu ont4apeo o3ilt sDrmumsnt)tltnxocoy1oaDeaues;s) 2xr(m oudlmtemivtls a2uaurpno4oeeomicilslm2rlnvp u0artomo3oa1lptr ueils  euo(o no1apt lieil()arurumonu1aleniictldls eln on(4trtomo oatom r iei;()setrxo3nu1am elfcil()aDta(  oo0oetomfciysfs2emu p;t0 eeomr3oa1opDr uei;t)setoimpiu1aleemfes (  2uaxmpno4oltniictytlaDuln onu0 eenxo oy1fm rai i;()t2xrxo3no1lpt lfesas) rrax pno1olxoifctlt mDel(ms;t0aetnio3oodlmt ln ils)truoim io4op elnei s aDrrump;o0olx  i3tlsla rmnvp;(4aetrxo3tadfptelieil(  rur(mpiydole lnei ()srtrxmpot0oleomociltlm ua(mo u0tetrxr tydlmD aueil(  2xmxm3oy1amen iesa(f 2ua( pou4apeo ocilt mDeluvs;u0areniocto1omD aivil(  rxoxm3nydoltnmivsa() rtm(moou0tpeoiocildls emuvs;() rtomr3oo1fptr n s;t)t2xr(o3nudlm emneils)sDrau o;u0tlxnifctadfm elums u0 ltrxociy1fpt  ivi;s)s2tmxr ou4ap  mnctls s2um(rpoo4tpeoifctltfa rlnvs;t) rtomr3tadfaDr uvo t0srum(m nu1lp nlfesatfaDur(rp;t0ope  iciasfa uluvp u) lxoio tytfpD ai i;s0 2xmirpoo4apen fesatfsrrrur ;o0aexnmi3iys a um(ms;t0trxrioctytfmt lies;s0 2tm(o nudolt lnvia(fsDrmu poo0ope  feiyt s2eln s t0alenxrcoadlmte iei;t)texmiopio4amtnlnctat srumuroou1oetnmoeildlm um( o;u) etnmociatomDe neol(0tetoir3nu4op  mnesa() 2tmxmooo0tltomietatlm2em( s (4artoxr oytoaDrluvsls)trxoxr oudalee fet t)a2tm(mo;u0tle ioeiadfs2em(vo u4arenxrcty1opteanes s)trtr(o oy1lp nmneiat)srrm( o;o0ope mieiytfs2eau s t)texnmr ta1fptraiei () 2xr(opiu4omtnlnvslt)aDraxm no1texnmietatfsDelu s;u0trtnmocty1lpDe n ol() rum(o iy4ap nlnvsat srra(rooo1tpeo octadfm elnms;t4 lenxf io1lmDraivolt  rxriopoudam  livslt  Dumumo;u1tlenifctatfs ra( pn(4trermrciatopDeaivilt0srtoio no1lpeelfvi (fsrum(rp;u1olt if3tyslsDuan s;t)arerircoatlaDr ues t0texrxm3oydope mfvias srtaxrpou4tpen iciatlm2rlumpn() eenmf oa1opDr ueo t  2xmxrpou1llte fesas) rtm(mpno0tpeniieiydfsDemuvs;u0 ltnmr tatfm ranes;s trumxm iy1olt  icta(fsDurxr oo1apxomfeiytfm eln o (0trxniocoodlmDelnvi (0 eum(m3iu1alt lics (  2umxrpno0teeomoeiys sDrm( p u0trxrmfctatlmtrlnvslt  rxmxrpnydal nmfvtls) rtaxmp;t0olx mieilslsDrlu pnu)tetriocoatfaDr nvslt0 rtmio iu4omt liesas)arta(r ;o4aexoifetldfs elnvs () eermr3tydlm raneil(0sexoiopoo1ame  ivt ( arraurpno1alxo oetldfs uanvs;t4 etoir3iodomteanvo;s0 rxmir iodom   ict t sDrm(rp;o4alx io3iytlmDum(vp;t0 rermfciotopD li ils teuoxm iodlmte icsa(  2rrxront1olt ii3iyd m2ulnms (4aetrmr3totfm elnvs;() 2urxr oo4op   ieiat arur( pot4ope mi3ilslm2rl(mon(0 lxnxo oa1lm raivs t0t2tmxmpoydlp emfvt ()s2raxmpnt1tpe iieiyd a2umnms;u0teenxo oa1fpDr ieil()t2xrxm3nudomtn fvtat)sDtmxm no0tee mo3ildlaDuanmp (0trxnmr3tydop r iesls  ruoxmpnudop nlieia() rtrxroou4tlenifciasls2raump u) lenmo3oodfatrli il(0truoxr nodlmenmies sf 2tr(rpnt0altomfeiadla2elu o;u4trxoir3iadomteln o;t)tetrimpnodoptnmfvi tfaDrmumpoo4opeo ietasfaDelnvo ()tltrmo3oadlmt livil()srtrxo iu4altelivsa(fa2rrurono0alxo i3tys aDum(vp () rxoxr3iydopDrli o;s seuoxr3iu4alenlictls s2tax  oo0texnif3iadlm uau o (4artoifctodfat aivo t0trxoxr no4lptemfvilsfs2ta(ro;o0apx  f3tatlsDel(vs u)trxomf iydfaDe ieo;t)t2urxr nudlleemfcia(  2taurooo0tpxomo3iyt sDuan p;() rtnxfcoa1lat ln o s) etmxm3ny1amtelnvil(fsDtrum nu0ape io3tasfm2rmn s;u0 lenir iydopD  u s;s)truoxo3oudol e ieslt sDtaxrpot0olxn f3tadla2emumo u4arerifctytlp e i i ( s2toxopoydlmtn feils srra(mp;u1tpxnifciytlaDulumo;(4aexnxo3io1opD livil(0trtm(r oo1opee nes s aDrrxmpnu0ape if3ilslm eau p (4tetnmrciatfpDraivol()t2toxopou1op   icilt arua(ro;u0oeenmi3ilslm2rmnms;u0trxoio3oo1la  ln ol() eumiopou4amt  neil() 2tr(ro;o0alxnmf3tlsls rlnvsnt)artoxf oydfa  au s;s texmxr3iodapee fvtat)sDur(rpoo0oexo icild m eln o;(0aeeriocio1la ean sls t2ur(m3ny4lmeelictl( aDtaxrpno1opx mieiadla umuvp;(4alxrmf3oo1op   u i (0srxrim nu1amt  ici tf rrm(r no4aeeomietys sDrmuvsnt)arerifctadlat  neo s0sexoxm3io1om elfci s sDrru pnu4altnif3tls aDua( o;u)teeoiocty1faD  ues;s) 2tr(mpoy4optnlfet t s2ururont4olx ifeiysfmDelu o;t0 eenmr tytlptr ues;s0 2urio3iodlmte icilsfaDur(r ou1apx  o3tasfs ul( s t)tlermfctatopDean i;t0truoxo iu4lpte fvil(faDumxr ot1tle ioetyt aDelnmp;u)trtoxr3ty1fat luvsl() etmim iudap nmfetlt s2rru p;u0aeto feilsla2rl(mo;(4altoiocoy1faDrlnvsls) rxrxo ou1ome lfcs sfarraxr oo4tet moetltfmDuln o;u)arxrir3iydomtr ivs;t0srtoir nydom   nvs t aDum(mooo4aeen fciyd aDemnmsn()aeenmr iy1opteaieol(0 etmxo nu4altnmiciat  rumx pou0alt io3tatfm eau snu0 etoxo iodom e ieol()trumir nudom n fcils  Dta(mont0apxoifeiys mDumn onu)treoio3oatoaDrauesl()s2ur(rpio4op e ictlt)sDuaxmpnt1tleomfciatfsDran ont)treoio tytomDrauvi;s) rxrxm nu4aptn ivsa(  rtmxmono0alxnmfciat m2ua(msnt4artrxrcoa1oaDelnvols s2tm(mpny1ap n neils)a2ua(m no1oltoifetld s2umnvs t0artnxr3iotlmDr ieo;s0s2uoxm3io4ol nmicsas)sruauront0texnifctyslmDraumsnu0tleoiocoy1oa rai ols)sruoxr no4lmenliet tfs2uau pno4tee ifciltfs2ua(ms t4alxrxocoadfp   ivi t) 2urim3iy1opt mietas)a2ua(mpou4apt ii3iydfmDuau p (0aetomocia1fp  ln i;s)trtoxmpoodlm nlnes sf 2ra(mpou1tpt ioctldls2rln p u4artomr tytom r nvi;t s2xmxm3nu4lpe  neilt srurum ou1opx iiciyd m elumo;t4trxomfcoadfmD  i o;(0s2xr(r ou4lmt mfvsa(fsrrm( pnt0tle  fciysls2el( snu4 ltrxf3iatlaDrlivsls) 2trxmpnudopen iei (fsrtm(  no1aeeomoeiadlm rmu on(0trtoiocoa1fmDr nvs ()truoxrpiodamee fesasf rtax ont0oetoii3tldfa2el(mpnt4texrxf iotfateln s (  2tmirpou1apte ncsasf rrmur ;o1tlxo iciasfs um(mp (4tlxoxo ty1fpD  neo;( tetoxm3oy4op  lfeils)aDrr(m oo4tpe ifetlslm2um( o t)aetomr ootlmt  nei;s)texrxm oudamtn icias)aDtrum nu4altomietatla2rl(vs t4 rxnmf3iydlp raueo s) 2to(mpoo4amee ics sf rtau pnu0oee  o3tytlm emu s u0aeermo3iytfatr ieil(0s2umxo3iodlpt lfviat  rumu  ;t0aeenmocilt a ul(vo;(0 ltnif3tytopt aiesls0setoio oo4lpen fvsltf rua( pot0aeto oeiysfa eanvo t0 rxnxocoodlm eluvo t)seumxo3iydlmtelnvil()arurxmooo4tltnii3ildlm2uluvo;u0 eerio oytlp ran i t  eurxmpnudop elivt t)aDtrumoot0optoif3tysls2umumpn(4arenxr oa1fmtr uvo s)trtrimpiu1olt mnvtls  2umx onu4apxoifetydfmDuauvsnt0teenxf oytlatrln i t) rtoir3oo4ll emictlt)arurumo;u0olx iictys a em(vo;u4tltnmfcoo1fmteln i t0sexm(m iu1opt  ici s)s2tau  ;o4aleo ocilslmDra(vo;u4tleoxr tytlaD auesls)sexoxrpnu1ol  lfci t)a2ta(r ;u0tlxn ociatfm2rmumont)tlerircta1op e i ilt) 2trxmpoy4omenmfvs t) rrrxm ou0olxn o3tyd aDuln s;u4 exoxf iatfmtr iesls0 rtm(mpiy4omte fvia(  ruaxrpoo4tpx  i3tls s uln p;t0tlxoircootlmDrlneols0t2ur(r3oo4lp e iet sfsDumu  nt0tptomfeiad sDem(mo u0altrir3tytlmDeaieolt)texrimpiy1ameelfvia()srtrxm nu4texo ieiytfm2uluvpnt) eerxr oydlmtraies t s2xm(opoodap n feiasfsDtrx o;t1aeeo f3tldlsDrmu onu0 exoio oytfm
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t0trto(opnydamenmfeias)s2rau o;u0apt mfeias sDulumonu0aleoifcia1fat  ivs;( t2tm(mpiodalt lnvsas)aDurur ;o4opxomfciydfaDeauvont0 rxnxo3oytoaDraieo;t)srtr(o iy4omte net tfarrm(ront4tlxnmociadfa2ea(mo ()aeenxr3tatfa  aivo (  2toxm3iu4omtemivi (farrr(mpot0tee  fciadls um(vpnu4tltnmf oo1fmD ai slt) 2tmim3ny4lle mies sfaDurx  ;o4aetoii3iatfa2uanvp t)trtnmo ty1oa ranvols teuriopiu4op  mnvsat) 2taxrpno4ape  oetysfa2eanmo;u0aeenmocoy1fmtelueslt) 2xriopoo4am emfetat  Duauronu4opxnmoetat m em(mo;() eeoirciy1opD lnvo ()trtmxr3oo1am e fvils a2uaxmpou1aexn i3tydfm2elu s (0aeeomo3iy1fmDelnvs ( texo(o ny4lptnmnvt sfartau  ;t4altn f3iyd m2emn o u0 rxrmrciodlpDrai s t)trxrxo3oy4lmt lncs tfaDraur nt4olt ifciat a ulu pnt) renxf3iy1laD aivo;s teuoirpoudapeelnvsasfs2umum ;u4apeomfciys mDuluvs u0arxnio3io1fpt lueslt0 2um(m nu1apenliciat)srta(rpoo4aet ifeiat aDelu s;u)aetrxr3totla   u s;s)texrxm oo1lmee ies tfartrumo;u4apxniieildfm2elnmp;(4altnifcoo1la eanvsl()teurio3oo4llenmncsasfsDra(r no4tlxomi3tldlm2umump (4alenxf ia1fm  lu ilt)sexoio iudap nlfci tfs2rr(mo;u4oexnmoeiatlaDranmp;u)tltnmr io1fpD lu s;(0s2toxr oo4lpteliesl()artr(ro;o0aleomicildfa um(mp t4 exrxo3oo1oaD aivil() rxoio3nu1olenlfcs (f Dumuro;u1aexoif3tasfs eauvpnt)aeermfctatopDeanvs t)t2uo(m io1lm   fetls) Dur(rpnu0tlen iciatla rmums;u)trxoir3oadom  luvsl(  rxmim3oudll emivsa( sDumx  ;t4olxn fcias a ua( snt4altnmfciatfm ran i ()trtrxopiy4olee nvsasfaDtr(monu0tpxnifciadla rlumo;t4tetrif tytlp   u i s0 euoirpou1apt mnet t)sDrru onu0aleoii3ildfmDeluvo;u4treoxfctodfptr ueo;(  2trir oy1amt  ietat)srrm(root1aee  f3tys aDrmn o;u4 rxoxrcoydfmDeai ols srxoirpny1lpt  nvsls)a2ra(rooo4opxn ictadfsDrluvo;(4tlxriocoatlate nei s)srurxmpiu1lme  nctl()sDrmu o;o4aleomo3tyt aDumnmp;t)altomf3oa1fmD aueils)s2uo(o iodoptnmfetls)s2tm(mono1oltoifctat aDeauvpnt)alxnxo iadfpt aies s setmio no4ole mfct (  rtm( o;u4aexomfeiydls2rau p (0texomr3todoate ivol(0s2xrim3no1opeelfcilt) rum(monu1tlx  i3iad m2emn o;u) eeomf iotlpt  ivo ( setmxo3oy1ll elneil(faDtrx ono0oeeomi3tyslmDua(vont)tltomo tadfate u i s) eur(mpnu1alte ivi s)aDra( o;o1aeenmoetyd s2emuvo;(0aeenxocoa1lmt aneo t0tetoio3nydam  mics s)arur(r no4oexnmfcildfm uluvo () rxoif oodlmDeaneilt  rtoim ou1lm n iei t s2raur ou1apeoio3iysfmDrm( o ()trerir oy1fm ranvi t)sexoxm3no4op n nct s)sDumxmoou0opx mietytfm rln snt)aexnmr3ta1omt  nesls t2umxrpno1lpen ivtat sDumxmpoo1alxomo3iatfs ranvonu0teenmfctydlpD anvi t0s2xmim3oydll nmicsl(f ruaum ;o1opt ifciatfm2rln s t4tltrxr3totoptr iesls)s2toim oo4lmtelfcia(fsrrax  ot0tpenmoeils sDum(mo u0 eenmr oatoptelu ils sruoio ou4apt licils  rrr(rpno1teeo oetys aDemu s t)trtrmf todoa  lueo;s  rxr(mpoo4ame lncta(farrm(mooo0oex mfeiad aDrmuvsnt) leoxf3ootlptelnvs;s0sexmxo io4ll emnviltfaDururpou0tlxnmictytfa ul(vo u4aleoif3iotfa rlneilt0t2trxm3oudlptelncsa( aDua(mo;o1alxn f3tls s2el(mo ()areoxfciatlpte nvs;(  rtmxm iudale  fvias)aDum(rpno0ale ioctyd s2eanvo;t)aexnxf iatomD lneslt0 2xoxr ny1ll emicil( sDtr( ooo4ope mf3iasfm2um(mo;u)treomocoodoptr i ol(0 exmxo3nu4apenmicslt)sDumx o;u1oeto i3iyt m el(monu)teeomfctadoptr nes s0 rxoxm3iodll elietlsfsDurx  ot4alxn f3tyt mDrmnvpnu4treoir3oodlmte i sls0sruo(o iudlmee fctat a2taxmo;o1apxoiicias s2rauvo;u)aexoxr3oadomD au o;s) etrxr3ny1ll e nvsat) 2ra(rp;u1opxnii3iydfmDem(mo (4aetomf iy1faDranei;t0srurxo nydlmee ictl(  ruaxr ot1tet  f3tatfa2ra( onu4 rtnmrcoy1lmtrlivols)s2ur(o3nudal   fvsatfsrrm(root4tlto oeiltlm rauvs t4altnioctytoa rli ils0srxo(o nodam n ivt tfartru  no0tltnmicils a2rmn o;(0tltoio oatfatran i;()trtmiopiu4op nlfes s a2urx oot1opxn f3iydla2rlnvon(4arxoxociy1fp eluvsl( sruoxmpnydam n fvtlsfarrru ooo4opx  icildfaDumnmo u0 rerxr3iytop r uvo s) rurxrpoo1amen nvt s srtmxmono1tlxnmoctlsls eln pn(4tleoioctytlpD au o s0texm(m3nu4lpenmfetlt a2taxmp;t1tleoio3ild s rau pnt)aexnxocty1lp eaies;s)seuo(rpoy4ope mnvs (farrrxmpnu1tetomicilt s elumo;t4 eenmrcoo1fpteau s;() etm(mpoo1amtnmieslt  Dtax pnt4ope moeiasla elu o;t4 lxoio3tydoaD aivi s  rumirpiu1amtemneil( a2tmxmp;t1aleoiieiyd s eln p;u0alxomociodlpDr i i;t0seuoxr oy1ol nlieiat  Dtau ont4tlxn oeiadlm emn pnu4aeenmfcto1omD anvo s0seuoir iudomtnlfvtltfsDumxro;u1apeoioeils m uluvpn()artrmr3ty1lpte nes;s)trxrir iy1lptnlncias) Drru  ;u1tpxnifetys s2um( s;(0tlxrio3iytlmD  uvi;s)tetmxrpoy1om e nvt (fs2urxmoou0tltoioeils m2uaumsnu)tetrircoodfa   n o;s) 2xmxo3oudoptn nvtl() Drmum ;u1ape  o3tadlsDuan on(4 reoif3iodom eanvi (0 rtrim nu1lpe mfetlsfaDurx pou0teto feild s emumpnt0arerxf3ty1lp eau slt0t2tmir ou1am  livi tfa2tmx ont4opx mietasfs2uln p;() eerxf3oy1omtrlu o;s)srxo(o3oudop   ivi sfa2uaxm ;t1oeto fctas a2uanmp;() rtnxr3oo1om rlieils sruo(r iudom e fcsl(f Dur(m ;u4tptomfciydls2ua(ms u)trerif iytomD luvo;s) exm(opiu1lm nmfvtl()a2umumooo0alt io3tyd m2elu o;(4altoif todfatrauvs;()t2trxo oo1opee iesas s2rrxmp;t4alx mfctlsfs rm( s;(4artnifctatla eauvslt trto(r io4lp emivtat  2rrxm ou1teenifciydfa ra( s (4trenif oo1faDrlneo;t0tetoio nudlle mfeia(fs2rmu poo4tpxoii3iyt sDrau sn(0 rtoio3oadlp rli sl( t2to(r oo1lptemivtls arrrx  ;t4aex  fciydla2ranvsnt0altoio iotom  livi (  2to(o3iydop emnvt tf 2tmumono4opeoiocilsls um(vp t4 rxriocty1fmDr n i;()tetmxmpoo1lmee nei s) rtmur no1tptnmo3tlslmDemn p t0arxnxo3iatlptranvil(0 2urim iu1lmen nei s aDrm(  ;t4oltnmi3iasfm umnvon() renxo3tadlpDeaivols trumxmpnydlp  mivt s sDuru o;t4ape iieiatls eaumsn(4alxrxf3io1lp   u s;s t2um(mpiu1al nmfei s)sDrm(r oo1oetnioeiyd aDulums;u4 etnxr3todlaD aivs;t0 2trxopoy4ale mict (fs2ta(  nu0aetnioeiltfm rlumo;(0tetnxo oo1fpDe nes ()srtr(mpiydomen fvt t srrm(m ;o4tlx if3tlt m uluvs;u)trenmr ia1fmt lu slt texm(o nodap   fvi ( arrr( p;t4teenmf3ils s elnvpnu4 reomf oy1laDr uvo;(0 exrio iy1optnlncslt)sDtru  ot4oltnmi3iys a ua(mo u0tlxnxrcoatlat luvslt0srur(rpny4lp n fvtatf 2ra( p;u0aleo o3tltfs rmump t)treomfciydopt anvsl(0srtrxm nu4omte ieslt  2raumo;u0tpx iieiltlm rluvo t4arxoif3iadlpD  u o;(0 2um(o3iudlpen nctlt  Duaump;u0tee mocils a uau pnt0artoxr to1laDeaieo t setmiopno4apee ncsls)a2rrurp;u0ope ifetatfm2ea(mpnt0teermo iydfpDrai s t0sruo(m3ny1apenmnctasfsDurur nt1tlxo ietlslsDem(mon(0 etnif oydomDraneols  rtmim3oy1ll e fet sfs2rr(rp;o4aptn ictyslm rlump u) lxnxfciodfm eau s;()t2ur(mpio4llee nct t)sDurur ;o4aet ii3ildls rmnvs;u4 ltoxr3oatom  ai s t0teurxrpiodapenmnei ( srtaxmo;t1tle  ieiasla2ranmsn(4trenmrcoydfm r nei ( teurim nodole  ietls  Dtaum nt1ape mieias m2em(vpnu0tetrif3iodoatelnes;()tetmir iy4altnmieia()sDumu  nu1oeen feildfs2elnvpnu)tlerxrcty1lpD anes ( teur(m iodlm   nvtltfsDra(rpot0ape  o3iydfsDuluvp u0tlxoif ty1fmt  ivil(  rxoiopny4ll nmfeia(faDrrumont0apx  ieiytfm2el(mp () rtnirciytoa elu s t s2trxmpoo4ap n fesa() rtrxrpnt4tlx moctaslmDemumsnu4alenif ootfp e n i s0 2uoio oo4lmtnlietls)s2ururp;o0opxnmoctytla elnvsnu4 ltnxr3iotfpD  i o;()tetrxo3iy4apen ivs t)a2rm(r ;t4apenio3tasfa rauvo (4aleomrctadfatr uvs ( teumxrpoy4ll   neia(  2um(mooo1tpx  feiltfaDranvp u0trtoxrciy1la  lnvs;t truoxrpio1op n ivsat)s2umxmont0olx micilsla2ua(vo;t)aexomf3ta1om elnvs;( sexriopoudam emfci t  rtaumpnu0oeenmiciyd sDrmn o u0aexrxf3iytlm rlues;t0teuoxo oydaptelicsl(fa2tmxro;o1aleoiieiadfm2rlumo;t0trtnxf oa1la elnvsl()s2xrxm nudll  livi (fartaxm oo1olto i3iyslaDranvs;t4artrio iadla elu i s  rtmxmpiydll nlfvsa(fsrurx p;u1aexo ocild m em(vp t) leomo3tadoaDeanes;s sexoim io1llte ivtlt srtr(r oo1olx mociys s2umu p u)teerir iotomtr u o;(  rtmio oy4lmen fvsa() Drax pot0tptomo3tldla2emu o u)tetrxr3iatlpDeliesls)teurir oodal nmfvi ( sDurur nu0opt  ocias s rlnms;(0artrmr oadop  aneol() etm(mpoudll  mncias)sDtaumo;o1tpen icild s em(mp;u0areoxf iatfaD  nvolt t2umimpoo4lme mfvi s)srrrur ;o4alenii3iyslm umuvs;t0 rtrmf3io1fpte n o t teto(m oo4open nct tf 2trum ot1tptoioeiadfs emuvsn(4aeerio3ia1lmte u i;t srurio nudllen ieilt) Dum( ooo0oetomi3ildfs eaump;t4aleniociy1opDr u s t0texo(o3nydlp emfcslt)srtmur oo1apeo iciat sDuaump (4artnxociatom r nes t)sexmxm3iudap nmicsl(  rta( o;u1olt mi3iatfa2rauvs t0alxoxr3oatlaDeli ol(0 rumimpno1altnlivta()s2urxmpnu4aex  i3iyd a2umumpn(0 eenxociy1omDeluvolt  2xrio3nodopenmicsltf Dtr(rp;t1tlxn feiltfa2eanvonu) rtrmf tytfmt li i;t0setoxm no1olt  ivias)sDurxrpoo1tpe mieiat a uau p u0 etoif totfat an s;s seto(mpoodal   nvt ()aDtm( o;t4tlen ieiydlaDem(von(4artnxr3iydfaDr u ilt0t2umxr iy1llee iei ( a2tmx  oo0altomfetldfm2rmnmp (4 ltnxr oo1optrlueo;()t2xrio3iydomenmics s) ruau o;o1tlxo o3tls sDrmnvs t0trenxf oatlpDelueols) exm(opno4ap  lfvsat artm(r ot0tpeniiciatfm2uaumo t4tetnmfciotlptraivo t  2trio3io4aptelfetat) Dtrumpou1aexnii3iyd a el( pnt0 lenmrciy1lmt auvo (0 2xrio oy4openlfetat) rrm(rono1open o3iytfsDemumont4artrmfcto1fatrliei ()t2tmxopnodomt liesls aDtmxroot4oex if3iytlaDra( snu) leomf3tytlptr nvs t0 rxrio ny4optnlies ()a2raxmpno4tleomiciad mDeluvp t)aeermo3iotlmDeliei;t  rxrim3iu1altnmfet ( aDtrurp;u4olt ioeiltlm2ra(msn(4aetrxrcia1fmDe ieilt0srxrxo3oydalt  fei sf 2raumpno4oltomf3tldls2ua(vp ()alenircoo1oaD  i s s0 exo(r no1om   fviasfarra(  no0aexo ieiatlm rauvpn(4alenmr oatop elivi;s0 exo(m ou1al  livt s)srra(ro;o0alxoioetytls rmnms;u4 ltrxrcootlp r ueo;(  eur(o3oy1lme mfvslt s2rrxro;u1tlxo i3iys m eanmp t0aetrif iatoat  nvi;t s2tmir oydalte nctl() 2raxr ou1olxomietyt a2uanvo u0 ltoioctodlaDrlnvs;t)s2trxo3oy1ap n fcs tfa2umurono0tleomieiasfs em(msnu)texrmo iatlm  anvsls0tetmir3oudamee ictl(faDtrum ;u1apt iictasfs2umnmp;()artnif3ootoptelnvsls0trxrxo nudope  ieia()arra(m ot0alxnif3tadla uln pn()tlenif tadlm  aneolt)texmio nu4optnlfeia()s2ua(moou4alenii3tldfa rln o;u)texomf3oytlmD au ols)teumxo io4lpe licsl(fs2uaum no4tetniociadlsDum( snt)teenmr3ta1lpt auvil( setm(r3nu4olt  nvsl(fsDtmx ont0ape  f3ilt m2emu o;t0 eeoxf3io1lpt aues t0srtrxopiu4ll  lict (  2taxmoou4oetnif3iysfs2elu o u0tleomo tadoa rln i;t t2umir nu4olte feilsf Dua(ro;o0apeoii3iasfs el(vo;(4 exnxocoy1lmtelu s;t)srxo(m3io4altnlnctasf Dtaxmo;o0opto i3iydla2eanvp ()areomrcta1fmteaneo;s  eur(rpny4lm emnvias a2rr(root1oetomi3iytfa2uan pn()tlerxo ta1fa  auvil()sexm(rpou1lm  miciatf rrmxr nu4texomoeils m rlu pnt)teeoio3oatoatrlivo;s t2urxr3nu1lmt  net ( s2rmx oou1aee ifcias aD
\ No newline at end of file
@@ -0,0 +1 @@
+i o;(0 etrxr3io1am  mfvil( aDtm(r ot4tlt iictasfm2el(msnu0tetnifcty1om r i i;() rtoxm oo1al nlfcsa()a2um(r ;u0tlx mfciytls2eau s;t)tlxrif oytfmt liei t0 rumxm iudame mieslsf 2rruro;t0tet iietas a ea(msnt0 rxnif3iotop  lneo;() rtmxopnydlp emneias) rrru ooo1oetomietasfm2rmnvp () eerio3oydfaDrlnesls  etrxm3iodlmt mictltfarum(mp;u4tlenioeiltfsDrlu sn()trxomr tadlmDranvi;s  exoxo3oydopeemics ( srtrxr ou4tex mfetldfa rm(vo;u)trtnifcoa1opteanei;t s2xo(o3no4am e fvsat aDuaumpou0tleoiieilt m rluvp ()alxrmr3oytlmDean o;() 2xrim ou4amt  ivtls s2trx  ;u4altnmi3ilsfm2rl(mpn(0arxoir3iadfptrliei;(0 2trxr3oo1op  mfesas)aDtm(rpnt4aptn oeiadfs2ranvo () etrmo3oatfptrlivs;( t2xmim3iy1op e nvt t aDrmxmp;o1oetomicils sDra(mo;u0trtrmociatoptraieo;(0t2xrim nodam  lfeil() rrrum no4aee mfctys a2ea(monu0tltrmr tadfa ran o;t0srurio nudoltelfvs tfsDrr(r no4tpe ii3iasla rmnvp;t0 rxoxf iydop e nvo;( trumxrpnydll   icias sDurum ;u0apx iicilsfmDelnmp;() lxnirctatfptelnes;s setmim no4lptnmieta(  2raumoou0altnmi3tyt s2ua(vo;(4aeeriocoa1optr i i;t teto(r iodomenmics (fsrrmxm oo4opx ifeiytlsDemu p;u0tlenxf oodlptrlnvo t teto(mpiudoltnmici s)aDtmuront4alxnifciadlm2eanvp t)trxoir iotfpDe nvi;( srxoxm iu4opt mnvi sf rtaxmonu1olenioeilsfa2elu s u4 rxnxfciy1op e n o;()t2xo(opiy1opt miet s artm( ont1aleoioetls a2elnmo;u) eenifciodlp r n i (0 2xm(o no1al e ics (fartru o;o1tpenmf3iytfaDean p t) rtnio3to1fm raueilt0tetrxo no1ameemnvsa(f Drmuro;t0tltn iciydlm2uan p;u0areomf3tytlmDr uvs;t0s2tmxo io1ameelnvtat) Dtmx pno4tpe mf3iydlsDel( s t0aexrmo3todfpD auvo s0srxoxo ny4om e iesat  Dururp;u0opxnmi3ilsfm rlnvs;(4 leomo io1omDraivo;t srxoim3ny4llee fet tf Drm( oou4alt  ietadfs eau snu4 lxoif3iytlm  lnesls  rtr(o no4lmtnlivilt) Duau  ot1tltnmo3iatfmDemn p (4arxnio ootomDraues s)tetrio3nu4amt mfeta()a2uaumo;o1ope io3iytlaDuau on()texnmo iytfp raivs s)s2uoir oudlm nmfct s artmu  no1tee mieilsla umnms u4tlermo oo1opD lueolt  exrxrpio4aptnlfvil(  2uaum no0oet io3tltfaDea( p t0 eeoxf iatfaD anvo ()setoio oo4ol elici (fs2rrxmp;u1aexn fetytfmDulump (0tleoxf oa1oaD au s;( tetm(rpiy1ll  mnvs tf rtaurooo1apxniiciydls rau pnu0alxrio3oadlmt aueo;()s2umio3iudlmtelfvi (fs2rax ono0opxoiietasfmDum( s u4texomo ia1fm  aivils) eto(mpoo1lpe mieil(f Dtmur ot1tpenmf3iadfm2elnmo u)aleoio ty1optraieo s)trxrxr no1apenmncslsf rrm( ont0teenmoctydfa rmuvs;(4tleomf io1fateaivo s0t2tmxmpou1ll  mfetls  Dtau oot4tpxn feilsfaDrl( on(0tetnmfctydop rlueol(0texo(mpno4ame lfcsa(  rtmu  no1tlxnmi3tld a2ranvs t0trtnxr tadlat luvi;s)t2tm(r oudopt mictatfsrtaum no4aptnioctatfaDrl(vp;()trtrxf3tatopDr n i s0 exo(o oo1ol e fes t)s2tmx ono1optniiciysfs2uauvpnt0texomo iytfmDrlieo;(  2to(m3oy1ap   fes s  rumx  ;o0tltn feiysfs2umuvpnu4aexniocoadfa e nei;s setmxm ny1olt  nvi ( sDrm( ono1open iciydlaDemump;u) rtrircoo1laDeaieol(0trtm(opiydoltnliei s)s2ur( pnt4altnmo3iytlm rmnvo u4alxnio3ta1faD  nes;s t2toxmpiy4llenlivs sfarta(ront1oeenif3ild sDumn o;(0arenifcto1oaD  ueils  2toxmpoo4ol nmnctls) rraump;t1oeto oeiytla rmnmpn(0tlxnxf3oydfa rln i (0 rumirpiu1am emneiltfaDra( ooo4olx  o3tatla2ulumo u4altrxrcoytfmDrauvil(  2xm(mpno4am n ncsa()s2tax o;t1alx  oeiytfs el( s;(0texrircoadlp   ivsl( s2urim3ou1amtemfctls)aDrru pot1apt mo3iasla rauvo;u0aexoxf3ootomt aueolt0s2ur(r oudoltnmivtls a2urumpno1texoifcias m2rln ont)trxrxo todfp rlu olt) 2xoxopiu1ameemicia()s2rm(  ;u4openmi3iad sDuanmp t) lxnmr3oatopt anvo;s)s2toir io4amt licsl()srtmxro;u4teto i3tasfs2ean o;t0tlxnxrcta1lpt li i;(0sruo(r oydaptnmncils)a2rm(m ;t4teeo ocilt s2ul(vsnt0tlermf3ty1faD au i s)setrxo3no1lme  nci t)artau pou0aexnmfctat m2rmnmpn(0artrioctotfmtrln i;t t2uoio3nodope  icsl(  2taumoou0texoiociytlm2ul(mont0 ltoxf ia1lmtr ivs;(  exr(r3iy1lmtnlici ()aDtr(r no1oetoiictldfa2ea( s;t4arxnif3iydlm  luei t0 etm(r nodll  lfcs s srrrxrono1tetomfetysfs2ul(mon()trxrmr iytlp elivs;s srxo(mpnudome livsat)aruau pno1oetnif3tysfs el(mon()tetoifcoa1omt  nes;() 2xmxmpoydal  livi t  rrmxro;u4oltomictyt aDua(vs;u4aeerir ootlmDrlu o;t t2tr(r3oodam   fcsa()a2um(mooo1aeen i3ilsla ea(vp;() lxnmf3oo1fmt auvsl( trxr(mpnu1lptn nvtas  rum(r ;o4opxnmietaslaDelu s;() lxomrcootfmte uvo;s0t2uoxr iudam n ietlsf 2ta( o;t1tptomf3ilsfsDemnms;u4 lxoio3iodla  lieils srto(r3ny1oltn ictls)arrau pno1apenii3iytfaDuaums (4tleomfcoy1fpD  u i s t2xm(o io1apeelfesl(fsrur(  ou1aleoif3ils a ua(mo u0 ltnmo oa1omD  uvols t2umxrpou1ole lfcslt  Drm(r oo0olxo octltfa2rl( o;u0 rtrmr iodfpDeanvilt0teumxr3iudapen nviat aDur(mp;u0optoifciydlm rmn p u)tltnxo3totfm  lnvilt teur(o iudomeelnvtlt  Drru ooo0olen o3tltls2eau o;(0tlxnio3oodlaDrlu slt t2xrxo3oudll  licta() Dtmu ooo0tlenioeiytfs2rm(vs t0trtrmo3todfpDelivils0 etrxr oudlpt  feta( a2rau o;u0tpxnio3iadlm rm( sn(4 lxomfciytfa e u i;t0 2trxm ny1lm nlfeil()s2trum ;t1ale mo3iyd aDum(mo t)alerio3oatlp e u i;s)trtoio iu1ll nlnvt s)a2rrum ou0aee ifetysfs ulu p t4altnxrctytlpD lnvils0teuo(o oo4opee feta(fsDtaxmp;o0opxo oetas s2uau o (0tlxnxrciatfaD anvo;s)setriopiu4ame  nei ()s2rmxmoot4alen fciydfm rmnvo (4tetnio3oadlm eaueo s trtrxmpnodlle mivsa(  rrrurpot0olx iociatlm2eanmpnt)teermr3totlm elnvo;t0seurir3iy4ameelnci tf rtmx oot1tlxo oeilsfa ranmpnu0arerircta1om eluvols0srxr(m3iydam   fvilt  rrmu ooo1aptomiciytfm eanvonu0trxrmf iydfpDe ueo (0 eurxr3ny4lmenmivt t s2tmxrooo4aee ifcildfaDul(mp u0teerxrcia1faDe i o;t  rtm(o3ny1llen fci t) Dta(mpno4tetomieiytlm elnms u0trtoxf3ia1lat  uei t tetr(opou4lleemietasf 2rau ont0oet mi3tydfm uln o (4 etoir3iatlmtelies s)trxo(opio4ope mfcs t  Drrumpot0aptnii3iatlsDea(mp t0 rxoxr tydlptr ivs;()trxoim3io1altelfvt tfa2trum ;u0tptomoeilsla2ua(vs;t0teenio3oatoateanvslt0 etoim iudll nlfeia( srtrx o;u4tlen i3tas mDuau pnt0tleoiociytfm  lieslt0 rxoim3oo4lpe livslsf 2taur nu4tlxomfcilslm2el( o;t)artnmr oy1opD  i i;()setr(opiydope mnvsls) rtm(  no0tpx iicildfa2elumo ()texrirctadopDrau i s) ruo(mpiydal   fcs ()artmuro;u4opxoio3iysls uau pn() lxnmfctodopD lieo;t0texrxm3oydlp nlicia(faruaxrpot1aex  i3iltlsDulnmon()trenmr iydfmDrln ils  2xoim3nu1lltemietl(farraxr nu4ope mfciltfa2ua(msnu)tltrxf oodomtr uvi;( t2ur(m ou1al e ivia() 2rrx onu4openmieiyt m ua(vs;u0texomr3oatfpt  neolt0truoir no4opeemieiat)arum(rpoo4oetnmfctyt s rl(von()treoiocoatomDeaueils teum(o iodamtn fvi ()s2rax ont1texoiociysfm2ulnmp t)aexrxf3tatfpDe ieo s0seuoio3io4omeelicils)artru ont4tpenmi3tas aDul( ont0 rermo3oa1faDeluvo ()srxrxm3oo4lltnmnetl(f 2um(mpno4tptnmfciadfa2ranmo;t0teenif oytlptr neils  2xmir oo4ap  lfvsa()sDrmxmpoo0oexomi3tat mDel(vsnt)artoirctytlmDeln ol(0truoxm no4om nmiei tfsDrmx  nt4olenmieiasla ul(msn(0 exomf iotfa  livsl( s2tm(o3nudll   neils  2ta(m nu1tet  f3iys s ulu s u0aexoxo ootfpt aneolt0 2umim3iy4om e nesatfsDurx ont1oetnifetad m2rmuvp (0 rxnxrcoodfmtr uei;s)t2ur(m ny4olenlici ()srrr(r ot4olxomo3tytlaDul(mo;u)alxnxoctatlpDeanvolt  2trirpno1llee fvi s)srurxrp;o0oleo i3ildlm rlnmp u0tlermr3oo1lptrln s;t0 etoxr no1opeemics tfaDtr(rpnu4alxoiiciytls2eauvonu0 exrxfcio1lm r ueo;t0 2um(rpiy1lp   ncils arur(mo;t4optnioetytfa2ul( s;u)trenmrctatoa rlnvslt sruoio3nu4am emnet t)arrrxmpnu0oleomfciat m2emn o u0altnxo3oo1lmDeai o s0t2uoxm3oudalee ietat)srrr( ooo4olxo fetysfaDulu s u)tleoxo to1opt ai s t0tetr(mpiy4lpe  fesat sruax  ot1aexo iciadls2rlumsnt4trenif3iadfa eai s;t)setr(mpoudapenmfes (f Dua( ont0tptnmoctytls2umn snt0altrmo io1lmtrlivo ( seum(m3nodom e ieta( a2ur(r nu4aeeo f3iltlsDulu snt4 lermo3ta1fptran o;t0trxoio3oy4ape  iesasfa2tr(  ;u0tlen feiytfmDrmnvs t0trtnxocoy1lmDeau i ()texmim3nodalenmicilt)s2tr(r ;t1tetnmo3iyslaDrl(ms;u) rxomo totfpDrlneil( t2umirpoydolen fcilt srrmum ;o0oltn iciydlaDea(vs;() rtoxrcty1oatrluesls srur(o3oudaltemfvtls s2tm(mpot0apeomociltlaDeaumo t0tlerxf3iadomD ln o;(  eto(m3oodal e nesas sDtrur ;u0oeeoiociysfs2eluvpnu4tleoxoctatla   ivs t0srumimpiy1lm  lfvsa(  2uru pot0tltomociadls um(mpn(4aexrioctotomt  ivs () 2xmimpiu1lptn fcias)srtr(mpot1ale if3tyslmDemnvpnu4arxoifcoo1oat aues;t) rxoxm3nu4omtnlfvi tf rumu  no1oex moeiatfa elu s t) eerxf oytomt lueo;s  2uo(o ny1oltelfet (f Dra(r ;t0olx  fciydfs eln p;t)texrxf iytfaD  neo;t t2xo(o3no1op  miei tfarrrur oo4oeenmoeiytfa ea(ms;u) eenxo iatfmD aies (0t2umiopoydoleemfeilt sDurxm nu4opto o3iadfsDrlu o u0alxomo3oytlpD lues;s)s2xoim iydam nlfcsa( sDrax  ot4aeenmfeiad aDua( s;t0 rerir3oa1fptean o t srtm(o3oo1aptelnes tf Drrumoou4tlx mf3tldls2rlumo;u4tlxoxfcoytlpDrai ols0teuoio no4amenmiesls arrrxr no0alx io3tytfa2umuvo;()treoifcootfmt  neo s0seurir oydlpt livtas) rrru p;t1aex ifeilsls2rmu s t4tetrxrcio1fptrlneo;t)trxoxopiy4ap emictat srrrxr ;t1aexnmieiltfm2rmn sn(4 ltnmr tydoptr uesl(0t2xmim iydamtelfciat aDtau  no0oeeo fciadlm uau p;u0tleomf3ia1lpDean sls0 etrim ou4omtelfciltf Drrur no4teeomociadlm emumonu)altrxr iadomDeaneil(0tetoim oydalt liesat  Dta(rpot1tet  icilsfs2umumonu)altnmocootlp  anvi;( srxo(o3iydolt  nvt ()s2uru  nt0aeeomfciasfm ul(vs;(0teerif3to1oa   ivs;t  rtoim3ou4lpeelict sfaDumurooo4tleniictat s ra(vs;() exomo oodfm  lnvs ()s2uoimpou4ol nlnetat) 2tr(rp;t1tle  ocildlm rlnvp u)texomrcootfmD  i il(0trtmir3oodllt  nctlt  2tr(  nt4tpe iiciasla2ua(ms;u) etnif to1fp eli o (0texr(r3no4ole  neilt)sruau ono0tlenmictatfs eaumpnt)trxrmrctytfp   nvo s)s2trxr3oo4op nliei tfsrrm( pot4aet ioeiltfs2em(vpnt) rxrxfciydfmDelu o t  rxo(o ou1llte ivtatf Drr( pou0ole ifciytls2umnmp;t) rermf3iatoa   n s;s texrir3io1lle lfci sf rta(mo;o1aptn ocilslmDelnmsn(4trxnxrcoo1lmte ies t)trtmxm3oo4omeemfei s sDraxrp;u4tleoii3tys sDrluvo u0artrif oadfatr n i t t2trim3ou4amenlncslt  rrr( oot0apt iociasfa2ua(vont4 lerxfciadopt li i;s)teuoxo3oodlptemivsls aDtm(r no0aexoii3iltfa em(mo;u4aexomf iy1lpDr ivs () 2uoxr3iudllte ies ( s2trumo;t1aex mi3ilsla uanvpnt4texnir iytoateli o t)texoxrpiu1ap e nvtas s2rr(rpno4ole ifciyt sDum(vs (0tetoxfcoydfpDeli ils  rxm(o3nu4lmenmfcsat) Drrx o;t1aeeomfeiatfsDranvs;u) renir3oatfm r ieols0truoxo nydolen nvilsfsrumurpoo4oeenioeiaslm2rlnmp t4 rtrxr3iydfm  aieo t0setr(m oo1lpeemfcsas  Dur(rpnu0altnmoctltlmDrm( o;t4texoxo3to1opD ai olt texm(r iy4al   ici s  Drrumo;o4oexn i3ils s2rm(vp;u4arxrmo to1fmteliei;t0trxm(m3iodop  lfvsasfsDumumpot0optnmictysls uanvs;t)artoxf3oadomteauvs;t t2tmxr nodomeemfvsl(fa2urx o;o1tlx  ociasfs2ea( o;(4 reoxo ootomtelueil( seum(r3nudopenmfeiat s2umxro;t0texnifcildfm uau pn(0 rtnmf3ta1fp ranvslt t2trirpou1ome  ncsl()srtrurpou1ale ifeiat s2rlnms;t)artrmociatfateln o s)t2trio iodlmt mneilsfsDum(  nt4ale iicilsla2elump;t0trtnmo3tadfmt lnei s0trtmim oy1lp n icia()s2raump;t4apt micias a2rlumo t) rxrmr3iytopDeln sl(0seumxmpiu1al nmfvils  Drr(r oo4tle mi3iyd m uan o t4 rxoxociy1fa rlnvs t setmxrpiy1opt lieta() 2rrurpnu0tlto fcildfs2um(mp t4 etrxr3oydoaD  ivi;(0 rur(mpnu1optnmivi s  2rmu o;t4apt ii3tydfsDulnmpnt0aexomr3ta1lm  anvs s)sexriopny4lm nmivi tfartrxrpou1tlxniieildls2um( ont)arxrxfciatfmteli o (0 rtmiopio1olt  nci s)srrrur ;t0aexoioeiydfm ul( ont0 eenxr3iadlaDr i i t) rxr(r3oy1om emfvil(  2rru p;t4aeto i3iaslm um(mont) exrmo oa1oaDraivi s  rxm(r3nudlm   ies (fsDtax  no1tle  ieiytfm emu o;u4 rtnif iydlm  auei;t  2uoim iy4ape mfeil() Drrxrpot4alt iiciydlaDea(mo t0 rerif iadoa   neol(0s2ur(r oudopt  nes tfaruru o;t0tlxn feiys m uanmon(0 reoxf3tydla eli ils teumxopnydlptn ncsl()a2ua(r ;t1tlto icildfa2em(mont0aetrxociodfa rln olt texrim iudaltemncia(f Dta(m ;u4tptniociaslsDeau p (4 ltrmr3iy1om   ivs;t)setm(rpou4olt  ivi t  ruru p;t1oleo oetlsfm rl( pnu4tlenmfctotfmDranes s0s2xrxrpny4apt mfct (  2raxrp;o1alenmo3tlslm2ua(msn()arxomr tadlpDraies;t0 etoxr3io1ol  lncsl(fsDrr(ront4ape moeiatlm ranvsn(0 ltnir iodla rluvi;t0t2tmir oy1lpenmieta(fa2rr( o;t4tptomf3iadla2rmnmont) exrmo3ia1fa   u i t setrxr oy4lp n ivi ( srrmur ;u0oltniociyslaDran s (0 leniocoydfaDe i s;(0srur(m oodlp n fvilt)aDraxm nt1tet io3tatfa rlu snu4aeeoxo3oo1oaD aivo;s0srto(mpiu4ope livilt) Dtmu  ;o1open fciaslm2emuvp (4 reomf3tatlmDe neo;t0 2tr(o3oo1am emnvsltf rta(m ou0apt iietadlaDrl(vp;t4trtnmrcty1lp  au o s  rtrim ou1lltn nvt t)aDrrurp;u0olt mfciatfm2elums;t4 renmo tadfpDrluvs s t2tmiopiodomtnlncsls)srurx o;o1aetniictlt s2umuvp;t)texrxf3todlpDr i i;() rxmimpoy4lmtelfvils s2ua(mo;o1texnmfeiadlmDel(vs;u4 rtnir iodfm  lnvs t0tetmiopno1amee fesls srrmxrono1alenif3iyslsDeauvonu) exoxf3oatfaD  ies s0 2tm(r ny1lme  nvils) rumxm oo0oexnmo3iadfsDua(vs t)tlxnmf3iadopDrlueo;t)trtmxm3oydlpe  ivtls)aDtrum ;u4tet  i3tad m eln o;t)aeeomo3io1fa  anvs;t0 etmxr3ny1al emnvt s aDuru  ;o1opeoiieiyt mDul( snt0tetoxo3oodop e n ils texm(opiodap   ivs tfsDrr(ro;u0aex  ocildfs umumsn(4 leoxf ootla   u sls teuo(m iu1lpeemnct s)sDur(r ot4olenmocilsfaDem(ms (4 ltoxo3ta1late ieo t)texmxr oo4ol   icsl()a2tm(  oo4aeto o3iysfa2rmnvsnu4arxrmocootlmDranvo ( sexr(rpiu4alte nci t sDtr(mo;t0opeo feils s ra( ont) etnxf ootfm r u i s0t2xmxr3nydom nmfcil(f rra(r ;t0aleomi3iysla2ea( pnt0 rerircta1opDranei s0srxr(mpou1al nmnes tfarumx p;u4aptomfciatfmDea(vp (0 rxoio3iydfp r uei;() exr(o ny4lle mfct s srtmx p;o0tlxn ociadlm em(vsnt)aleomr3iydlm   u o;t t2trimpou1altelietl(f 2uaxr ;u0oeenio3tadlm2eauvont0 eenif3iy1lpDranes () euoim3oudap nlncs s) Duaxmpoo4tptn ictls m2rmnvpnt0aetrxocto1fmDrln s (0 exm(r no4llenmieslsfs2urx  no0aleomictad s elu p t0aetrxfciodfmD auei;t0 rxoimpio4apt lics t) rum( o;o4oeen octytfm2ra(vonu4teeomocoa1faD auvils) exrir no1olenlncta(f 2tm(ront4oet mieiadla rau s u)aeerif to1om  aivsl(  rtoimpoy1lltnmfesa()a2rmxmpnu0teeomoeilsfaDrln s t4 rxnio3iytfp r uvs;s trtoiopny1altelfvs ()aDum(r ;u1tpe  fctas aDum( sn()tlxoxf3ty1fmt luvs;s sruoio io1lpte nvia( s2urump;o1tptoiictydfs2rmu o u0 ltnircoodomte nvi s0t2trxo3nydap  livsl(  2urx o;t0ape  o3tltfs2ul(msnt)aexoio3ootlpDe uvsls)sexoxr oudlme  iei t  rrru ono4tee mi3tyslsDulnmsnu0 lerxo3ty1oate nvs;(0t2toxmpnu4omen nctat srurxrpoo4oexnmietadlsDrlnvs;(0 rtrirctadfat li sls)seto(opiydalte ivs ()s2tmxrono0tpeoiietls a2eanvs t)aetomo3oytfa r uvs;s)seurxmpno1al elfei tfs2umu  ou0aeenmi3tys mDelnmonu4 lerxrciydlpDrauvo;s t2toim3ou4omeemfvils sDum(  ou4tltoif3iatlaDeauvs;()alxrirciodfaDeliei ( s2toxm3ou1om nlfesat)srum(ro;t1apxoifetydla rmuvon(0alxoxo iodoatr u s;t) rtrxo3iudlm nlfctl()aruaxmp;u1aex mieiatfs2emnvonu0altomo oo1oaDeanvsls0trxmxrpny1alenlnet ( artm(  ;u0ole moeiyd a2uanvo u4 reoxf3oydfmtr u s;s)setmxr nu4optelfeta( s2urxmoot0open i3iyd a2uan o u)tlenxf3totlp elneil(0 exr(r nodole mfesls)a2rmu o;o4aeen ocils a2eluvs;t0tlxrio3oa1fmDe n s t) etoxrpoydopte icta(f Dum(moou0opx ii3ilt m2ul( s;u4tlxrir oytlatraues t  eumxm ny4ol  mnci t srtrx  ot1tle  feildla el(mo;u4arenifcoo1lp eau o;t) eum(opiy1oltn fvta() Duaxrono4opto i3iys s2uanvs t4arerxf ia1opDelneils)seurim iu4lleelivtltfaDuau p;u0apto feils sDua(ms t)tleoxo3oadoatrlivi;(0 rxrxmpou4omeemiviat) 2ra(r no1tlxnifctysfs2rmu on(4texoxf3oy1oate i i t)seurxr3io1ol e fct s) 2ur(r nt4ale mfeilslaDumu s;t)artrxo3ty1lm   ueils  2trimpiu1altnmfeil() Dra(ro;u0optnif3tadla2uan pnt) etoif oytoate u ol(0s2xoir3iu1lp nmfcs sf rua( oou1aexnii3tltlmDrlumon(4tetrir3iydla  au o t) 2xr(mpio1ale lncsa( arurxrpot0tleoioeiysfaDuanvo t4 exomo iodlpDelnvslt0 2umir nodom nmicil(farrrxrpnu1tlt ii3iad sDul( s (4aeenxrcoydopt luvsls  2to(rpoudalt lici s  2rr(  nt4tlt mfetyslm ulnms;u)altnmf3iodla rlu i;()t2uoirpou1lm nlieias)sDrm(r ;t4tpenioeiytlm emu s t)altoxocoydoat  ieslt  rtmirpnudlmtnlfeia(farrruro;t4alxo feiasfsDrlnms;t0 lxrioctotlptr ivs ( srumir io4am n fciat) ruau p;t4oltnifetad s rm(vsnu0aetomr iodfatr n i;t0teurim ny4amee nci s srtr(moou0apxoioeilt aDrmump;u0artoxr oy1fmDraies (  rxrio3oo4omtemicsa(fsDuau onu1aee mfcias m2rm(vpn(0 lermr tadfmD auvi;t teumiopiy1ll nlfvsa()arrmxrp;t4oeeo oetltls rluvo;u) eenmfciatfpDe i olt0 rur(mpoudale liciltfs2taxr ;t4olxoifciys s2ea( s u4 lxnio iytop rln i;s)trumxopoydal  lfctls) Drr(r nt0tet  fctatfs emn pnt4aetrxo3ty1fmD auvi;s) etoim oy1llt  nvs t)aDurxrpot4opxnioeild m2eauvsnu0arerxo3iodlmteaieols0 rxmxm no1olte ictas  2tmxmpnt4opt  fctydfa ranmo;u4arxnmociytfmDrauvslt truo(mpoo1oleeliciasfartax pnu0aexoii3tysfmDua( s;(4 rxoxociatlmtrluvi ()t2um(opio1ame lfesltf Dur(mooo1apenmiciyd s ua(mpnu4areoxr3io1opDeauvi t  2xr(m3iy4ol e ictlt)sDtmxmpnu0tpxomfctlslaDrlu pnu0areoxr tytlp ean i () 2uoirpiu4lpen iesatf 2um(  ot4tpto oeiad aDra( snt0treoioctytopDean il(  rxmxrpoo1am n ivt (fa2ta(ro;u0tlenmfctadlm rluvo;t)trxrifcoodfmD  nvi t)t2uoxopoy1ll  mics tfaDumu oou0opxnio3ias mDumu on(0aexoxociadfpDe nvo s teur(o3oo1am e ict s)sDta(r oo1teto fciasfm elu p;t) rtomr3iy1lpDr ivi s)trumim3oy4lp  lnvs t sruauro;t0teeo oeiyt a2umn s;t)tltnxocoodfpDe u sls0trxo(o3ny1ap emfciasfsDua(ro;t4opxoiociyd m2rmu snu0 ltoiociatom r iei;t) 2xo(o ny4amtelfci t  Draxmpot1opt mf3tld a2el(ms t) exomf iadoaDr ivilt sexr(o3iu4apeemfvt s a2rm( poo0alxo feils m emnmo;t0arerxr iydlmD lnei;s) rtoir3oo1ale lnvi s sruaxm nu0oeeo octldlm umn p;t)artrxo3ta1lmDrlneolt)t2umxmpiudlpt  ivsls) Dtrxro;o1tlxomoeiyd aDul(vo;t0trtrxo totfmDe ivo;t)s2tm(o io1ll nmncsa( s2rm(m nu0apxomoeiaslsDrl(msnt)trermrcoadomtrluvil()srtrxm oudaltelnetl( arumxr ;t0texomi3tltfm2ea(mpn(4 exnmr3oytfp  au ols0 rto(o nodlmenmnvslt)arumxmpoo0oex  f3ilsla2rlnvont0 etrxr ty1fmDrln o s) 2trxm oodolt mnetls  2uru p;t4tpeniocild m rmn p u)artrmr3tydlpDe nes;( tetrir3no1al emfvtls)aDrmxr ou1apt ii3iasla em( s;u0 exoioctodlpDe nvo;t) 2urxr oy1am  lfciasfsrrm(r nt4apxn oeias m2rmn s;()aetnmo3ootfp eluei t)sexo(r io4lm n nvta()srua(m oo0tltn oeiytfs2rmump u0arenxfcty1omte n ol(0trurio iu4apeemiei (fa2umxrpou4ole if3tlsls elumo;u4aeeoio3iy1lpte n ils  2umir3nydlpt liesl()a2tru poo1tex  ietltfs rmu p u4 rtomrciadlp ran ils)s2tmxo oudol  lfvtas)aDuauroou1olx mfciatlm rl( o;t4 etnir oodopD lies (0tetm(o3oo4omeeliesl( s2rau p;u0opto i3iyslmDuan s;t4artrxfciadfaDeli s;()s2xoxo3io1apt lnvslt)s2ur(  no0oetnifciyd s2emnmp;t) rxnxf oytlpt lueilt t2to(m3io4alte ici t sDurum ;o1olen feiatfaDrlumpnt4altrmfcio1laD li ol(  2xo(m oy1alt lici ( artaumoou4alx iieiad mDuan sn(0artnmf3oatoatrliesls0 rxo(rpio4amtelfei sfs2umurono1aptnifeiydlsDelumsn(4artnxf3iodlm   u s t0trurimpno1am  lfvil(  rurur ;o4alto f3ils mDelnvo;u)aexrmr iytomt aueo s0t2xmxo iydamtnlfet (faDuru  no1apenmo3tysla2eauvo u4artnio io1optrli il() rtm(r iudome  nesat)arrrxr ot0tlxniociat aDeaump;t)altoif oadlm raivi;s0 rtmxm iu4omeelnvi tfsrtax  nt1tlxnifeild m2ulums;u4 rtomocta1opD au ilt  exmim3oy4lmee fcta() 2uau pnu1tpeomieiadls2raumo;()alerifcoo1lmtelneo ( setmim3oy1omtn feils)artmu o;o4alx  o3tlslm rln s;t4 eeoxocoa1fpDeau o t0setoxo3ny1lpeelfei (  rumxrp;u4tle iociad s ulumo t0texrxr ta1oa elu i s0srxo(m3nu1al  lict tf 2rauro;o4opxo ietlslm raump;u4artnxocoytlpt an slt0 rumimpnudopee ictas a2tmur ou4oex  f3iydla2ua(vs (0aetniocoatfmDeanvo t0teuoxo3no1amen ivt t s2uru  no4alx mfeiat a ulnvonu)altoifctydomteln o;t0t2tmxo3iy4ol   icsa() rur(mooo0tptnmiciytla2umnvs;t)tetrmf3oo1fpDelnvils)trumxr oy1amte nvs t) 2uaurono4opto i3iyt m ranvp;t) lerio iodop raivil( t2ur(o3no4am emnci t artrurpot1alxoio3iatfm2rmnvpnu)alxrxo3oytlaDe iesl( trxmio3oo1altnlnesl(  rur(root0tee mfeilt m2rmnvp t4arxomr3tadla elivs;t)s2toxo iydll n nvsltf rra(mpou4opx mieiydlm2emumonu4altnxoctytfp eaueil()seur(o iu4op e icias  Dra( ont0olto fciydfaDem(vp ()altoxo3iotlpte u s ()sexoxr3nydamtemiet tf rtr( ont1opxoiieiatfs rl(mpnt4tlxomf3oo1oaDraueo;t0t2um(o oo1lpe  nvil()s2tmxroot4tlx  oeiyt sDuau snu4tltrxociotlm   nvs (0srtoxo3oo1alen ncil(f rumxmp;t1openifeiydfs2ul(vpnu4tlenxf3oodfm raueolt0trtmxr nodam emnvt ( s2trxrpnu1aleoio3ild aDua(ms ()tlxnir3oy1fatrai ilt)trxmxmpiy4lpen nvt sf rtm( p;o4tpxoifctadfsDua(vp t0 lenmo iy1omDr nvs;(0seur(opny4opt mneils)arua( pnt0altoiictldlm ranvs (0 rxniocoo1fmt lnvo;t) exo(m nudap e iei sfa2ra(rpnu1aeto fetls mDem(vp;u0aetrxrcoatfm eaieil(0s2toxm nu1lpee ivsas)aDumxm oo4ope ii3iltfm umnvp;t4 lxnmo3ty1fa rlivo (0t2urxm oy1amtelfviasfsrrm(rooo1oetnio3iydlaDumums u)alxrif tytfa rlnei;(0srxoir ny1al nmict ()srurxmoou1ape mi3iasla rm(msn(0tlxoir3io1fm rln i;s trurio3oudop eliciltfsDrrxm ot1tlx ii3tyd m2uanvs;u)aleoxf oo1oat lnvilt0s2toirpnu4ll e nctat a2tm(m no0oee  fcildlm2eluvonu) etomr3iadom e uvsls trur(r3oy1oltelieilsfaDum(m ou1openmfciatfmDeluvp t4trtoioctotop elu s;(0trurirpny4ameemnetasf Durxr ou1tlxnio3taslm umumo;u)artrxrcoo1la elnes t)texmiopiu4lmt lfet ()aDuax ooo4olxnmoctysls eanvo;t0tlenxo iydfp rlieils0t2urir3oudoltnlivia(faDtmxro;o0altnmieiydlaDrl(mo;u)trxomr3oatfatelu o;t0t2trio ny4lptnlfvtatf Dtmur nu1ape moetls m2uln o t0aexrxo oytom  liei;s0t2tr(m oy1op nmfvi (fs2umuronu1aeenmociyd a2rm(msnu4aeeoir to1omteanvol(0t2uoxm iu1ll nmfvsas) Draxm nt0aeeoiictltfm2rmu ont0aexoxo3tadoa r u i;s  etr(rpiudape mivsat)aDraum ;t4opeoiociadfa2ranvsnu0arerxr iotlptr ues;t  2urio no4ame mfctls) rrr( ono0tpx moctyd m ea(vpnu0alxrxo3oo1la  an s;t  etr(o3oodap nlivsl(  rrm(rpot4tpt  ociydlm rm(vs;u4 etnir oadlmtraneols  etoio3oy1ol   ncsls srtau p;t1oee  ictlsla2rm( pnt)trxnxo3ta1laDr n i s  eum(o ny1llee fet t  rtru poo1alt  ieiadfmDuanms;u0trenmo tytoaD luesl(0 2xrir3iodomt  fcsas  2rr(  ot1texoii3tls s ul(vp u)tlxomr3oadlpD lu o (0trur(m3oy4lmt micsltfs2urxm no1texnmi3tatfs ua(mp;(0tetoirciodfp   nei;s) rxm(o nu4lp nlivtlsfaDtr(r ou1tet io3iaslm2emn o;t)tleomr3ta1fa raiei t  rto(o nu4om elicsas a2rrxrpot0apenmf3iydfm2ulumsn(0texnxrciodfatrln sl( srxmxm3oy4lmtelfctlt) rrr(ro;t0tptoifctydlsDuan sn(0 rxoxf iotfatelues t s2tmim io1alenlfvias)s2uaxm nu1aleomfcilsfm emumonu) ltrio oatoa   ueslt0trtrirpiy4omt mfetas)srtax pnu0open ietldla ul( on(4arxomrcio1fateau s s  2trxm3nudlp emfci s sDuaxmp;u0tlx mo3tat s el( s;u)arxnmo tadlmDelu slt)s2umirpiodolen nvsas arumu  ;t0tpe  ieiad m umuvpnu0tlxoio3ia1fmDean ils)seurxo3ny1op emicslsfs2umur ;u0opto oetldlm2rmump (0tetnmfcootomteliesl(0s2toxmpoy1omtn iciltfa2rrxrpot4oet  ieiysfs2rm(mon(4aexrxocoadfpDraueols)truo(o io1alt mics s srtax poo1ole  ictlt s2el(msnt0texnmocoadfp eaueo t0setrir io4ameelfesat  rtrx pnu4apxn fetadfa ua(vo;t0arermrcoo1fa e nvo ()trum(opio1ol   nvsat)srta(ronu4opeo fcildfaDeluvp;u0 eermr3oatfat lnvo;t0 2xoirpiy1lmeemnvt t)s2raxr ;t1aee  i3iydfa2emnmp u4artnio ia1oa eanvi s t2xrxo oy4lp emicilt aDrm(mpoo0tlen ietldfs em( p (4teeoifctydlpt lu i;t0t2urxmpiudamee fei () rtruroou0aeeo ieiytfa2el(mo;u) rtoif3oadlaD lu i;t  euo(m nodal   ivtls a2uau  nt1olt  i3iys m eaump;t)alxoxf oo1optr ieo t seuoim ou1lp nlnet (  2ta(rpnu4alxnif3iatfs2ea(mp;u)tetnif3iodfptrlnvsl( teur(r iu1lmenlicsasfa2tm(root0tle  ociatlaDuanvp;t4tlxnxo oa1fat li slt trtr(mpoo4llte ieias) Dur( onu1oexn o3iysfm ea(mo u)teerio oatfmtrlnvolt) 2xoxr ny4omen fvi sfarrr(mpnu1oltomietls mDemuvp u4tetoir3oodomteln sl(  2tmio3oodam n ivtls artaxmo;t1opeoifctytfs2elump;t4trxoifcoatlp  auvils srto(r3iydol  mictl()artru ooo1apx mieils m2emn s;()texnxf oatlp rlivo;s texr(r3nu1lpt  nvtatf Dur(r ;u0tee ioctldfa2um( on(4tleoxf oadfateai s;( trum(r iy1optemnvt s)aruau  nu4alt  i3iatfm2elu ont0alenio3totopDrln o;s0s2toxr nudap  livils s2ta(rp;t4apt if3ilsfs rm( p;(0aleomocoa1la r n il( setr(mpiydam  lnvtl()aDtmumont1ale mi3iadfa2eauvp;u0aeerxf3to1lp   u sl( srxm(o nydap n ivsatfartmum nu4tlen oetld sDeln s;(4treomf totla raieol(  2urim3iu4lptnlncsa(fa2rrumo;o0olx iociltfsDemuvont0tltoxr3ootlat ai s t teuoio3ny4lpt  ncil( arua(mono4apxoio3ilsfaDrmums;t)altrircoa1faDeln ol( setoxm3iydop  lfcsat)a2rr(r oo4tee moeilsfm2eaump t)aexrxo3iotfaD  ivs;s)srurxopny1ome  feil()s2rmu pnt0aet moeiadfaDulu on(0 etomo3oydfmD aivo;t t2xo(r3iy1ame  feslsfsDtmurpot4altoiictyd s ua( o t)alxnxrciatopteln i;t s2toir oydop n nciltfsrrrurp;o1tpxomoeilsfsDea( snt0 rxrif3oa1fptr ivi () rur(o ny1ap nmfcias)srua( poo1tpeoif3iysfs ul(vo;t4 rtnif oo1fpt  n o t)s2xm(r ou4apt lfetl()s2tm(mp;o1aet mi3iys sDum(msnt)arxoxf3iadfm e ues;(0 rxmio iu4open ivta() 2urump;u1optoiieiltlsDrlu p;u0 leoxf3oo1la rln i;(0t2trio3iu1aptemnvsat arurx pnu0altnmf3iys aDel(vs;u0areoxo ta1la e u s t0 2ur(mpiu1al  licsltfsrtru poo4apen i3tldlm2rau p;() lxrmr3ta1om eln s;s t2xrxo3oudlpt  fciasfaDra(r ou4aptn i3iydfm eanvo;t) leoxo3iodomDrliesls) exoimpoodlm   nvtas s2um(r nu0ole miciat mDelnms t4arxrmocoa1la r ivi t)setmir ou1om nmfvsasfsDra(ronu0aetnmietasls umn p;()tetrmo to1lpD  ivsl(  etrxm ny1omtnlnct sfs2tmxmpnt0aleomi3iasls2rmu s;t4alxrxf3tytomDelnvils t2trimpoy1ole mneslt)sDumu  oo0apto oeilsla2elu p;(0arenio3ty1omt li o ( t2toxr iodll emnciasf 2rmu  ou0oleomoeiys a emnvonu4 etnxf3iytfm  auvsl( trurxrpnydoleemici s sDuauroot4tlt iictysfm rm(vsn() etnxr iytoatrau s ( s2xm(r oo1lp  micilt)sDua(rpou1tlt iiciltla2rm( s t4 lenir iy1fm ranvils0seumim3oy1open nciasfsrumur nt4tet  feiyt m2ua( s;u0alerif3io1om eai s;s0 2xrxo3oo1om nlncslsfarta(r ou1apxn f3iyslmDrm(vo u)trtrio3iytlmtrli o;t t2umim3iu1olt livta(  2rr(rpot1aet  ocild aDra(von()texrio3io1oaD an slt teumxmpoy1lm nlfet sfaDur(mono0aetniiciadls em(mpn(0 exnxociadfateaneo s)t2tmxm3oy4lp  mfesa() 2uaur ou0tltnmiciytlaDul(monu4tlxniociydfmDrluei t) 2um(opnu4omt lnvsa(  2rrum ;t4tleomfciasfsDeau s u)alenmociydfptr ueil() rxoim3oo1lme mfctl() rtaxrono4texnioetyt s emnmp;()aetrxr oodop   i ols0t2toxm3oydole lnvt sfs2trur nt1oleoiieiltfaDuan sn()alerif iytlatelueo;t) eurxm3iu1om  lnes tfarumxmont4aptnmi3ilsla2rauvs u4artoxrcto1lpD lnvi t  rtoim3iodaptemiciasfaDta(mp;o4ape  ietat sDrmums u0 lenif3oatfp  ai o ()s2xrxr oudop  mfct t  2rm(root4tlt ifeildfm2ra( s;t)alermfciodlpt lieo;t)srxm(r io4al e fcil(fa2tru oou0opxoiiciadfm rm(mo;t0 lxrmf3ootfa eli i;( texmxm3oydlle  icia(farurur oo0aexo ictat a2emu onu)trtnxf3ootla elnvil(0srxmim3nudol  mnet ()sDum(  ;u1openmfeiydfs emums t0tltnir oydopteauvo;s s2xoio iodll e nvtatfa2tax  ou0opx mictldfa2ul(ms (4altrir oydlat  ivo t sexrxo nudlp  lncia(f 2raxr nt1tlxniicilt s2el(mp;t4alxnir3oatopDraneo t) eurirpnu1am nlfct tf 2rru  ;u4olx mfctyd mDeanmo (4teeoxo ty1lp r i s;t)tetoxm3oodap nmfciasfsrrrx o;t1aexomictls s2emnmp t0tlenio3ootfpDr nvo;t s2uo(r3oo1ope lnes s a2um( p;t0teen fciadlaDrluvsn() etoxocoatfpDrluvol(0 2to(opoy1open nesas s2um(mpno4ape mieiysla eau s;u4 lxrxr3iotlpDraneo s trxm(opiodlltemnet t aDrmur ot4olx iiciyt sDeaums;t) lxnmo3oodoaD lnvsl(0srtm(m ny4lmee nctatfs2ta( o;t0oeeomo3ilsfm2umuvs;u4altniocoydlp raieols0srxrirpoo4al  livtls)a2rrurp;t4opxoii3iyt a2rm( p u) rxomf3to1lmDelnvo;( seuo(opiu4alenmiviasfa2rax  ot0apxo o3iatfa2eanvp;t4trxnxf3totopt anvo;()t2tmxrpio4lmtnlictltf 2trxmpot1oleo fciasfm2uau on(4altnxfctadomDranvo;s0trtmxo3io1ope  fvtls) 2um(  ;u1oet  ieiasfa2ran snt) ltrxrciydop rai slt  ruoim3iy1oltelnvs sf Drmuront1aetnmo3ilslm2rmuvo;(0aeenio3iotlmD aueols  etmir3iy4ol n ictat)srumx o;o0oetn f3iyd sDel(vs t)tetnxr io1omtrlnvi (0trurio3oy1al  livtatfa2rm(moou0texomoctatls elumont0teenxr oodfatran ils0teurimpiudaptn ict () rtr(  ou4olx  iciatla2umums;t0tltnxr3oa1fa   uvils trto(m iy4ole miviat)a2umxrp;o4tptoiicildls2elump;u4tleoxf3oa1fatrluvi;t0trxmxrpny1ame mfvsatfa2ur(  ;t1texoifeild sDumu s;u) eenmr tadomDrln ols) rxoiopoy4ll   nvsas  2tmum nu4apxomo3iys a2rm(mo;t0trxniocio1opDeaieil( seumxopio1ole lfvilt srrmx  ou1apx moctlt m2uanmp;(4texomfcia1faD lneil()truoxm3io4apenmneslsf 2ra(ro;t4olxo i3iasfs emu o t0trxnxr iydfaDeanvs;t t2xoxo iy1op n iei s)sDtmx  ou0tpxnii3ildls2emuvp;(4aexoxocoydfm r neo;()teuo(rpiydlle miviat)srrr(rp;u0opxn i3iytfa2eanvonu0 etomrctadomD  uvolt0srtrxmpoy1amee fvta()aDum( onu1oexnioetlsfs el( o u4areomo3iydfmDranes;t0 2tm(r3oy4lmtnliesasfartru onu4altoii3iydfs eanvo (0arxnircoo1laDe neils  2toirpiydopt  fcsat) rtruronu1oltomfeiysls ean p;(0 lxnxr tatopDe u s;t)t2uo(m3iu4llen fctltfs2rrx p;o0tetoioeilsls2elu p;(0 lxoxr tydlm r uvolt  etm(r3iydole lnetatfaDtmumo;o0altoioeiatla2umnms u4tlxomf3oa1fmDr u i ( s2xmxopoudome  icsl( sDtaxrpno1optomocils mDul( s;t0tleriocto1lpDrliesl( trtrxopnudamt mnctat)a2raxrooo0opeoif3iltlm ranvo;t)aexrmo3oy1fptr n il()s2uoio3ny4alt lietl()a2tax o;t0opxoifciasla ean p (4 exnmr tatfateaueils0teuoxopoodamenlfcs s) rra( onu1oltn oeilt mDrlu sn()areoir iodlp e n olt)seuoxo3io1olee fctatfa2uru ont1aee  feildlm2uau o;t0 rxnmr3iodlmD  uvs s0 euoir3iy1aptelncsat)srurxroou0aee mfetys sDeln pnu4artoir3totfp eaivi s0 etoio ny1lltnlfvs (fsDuaxr ;o4tpxomietad a2ranmpnt0aexrxf3iotlmDe uvs;()s2umxm3iu1al elfvil() Dta(rono4aleoioeiydls rmnvp t4 leoxrcio1fpt ai i;t)seumir no4om  lnci () Dta(mp;o0oltn fetytfa eau p t0arxrmf todfpDeanei;t0 eur(m nydlle mfcta() Drr(mont1oetnmfciysla umums u0trxrircoodfmtrln s;s t2toxo3iudll   fvils)sruaxmo;t1aptn ieiltls2rlu pn(4aeenxf oytom rlieo t setmxr no1olt  nviltfs2raurp;o1tltomoctltlaDrl(mont4aexnif3iadoaDraiesl( trxr(m nu1optn fvils  rtax pnt1ole  iciatfsDumn s;t4 ltnmrctatfptrlnes;t0srtoim nodlleemiet (  2tm(m ou4aetnii3iys aDemums;u4tlxomoctotfmDraivs;t)trtoxo3nodomenmieias)sDtrx ono1tet moeiltla2uan sn(0trxrmfcootlpt  n o s trxmxm3nu4lpen fct ( sDtmxrpnu0texn oeild a rl(ms t0 rxoio todoaDrau sl()t2uoirpiy4oltn fvil( a2uru pou4alenif3ild a rmn on()arxnxf oydfpt lnvols0t2urio iudlmt lnvias) Drmur nu0aexnmf3ild aDeanmpnu) rxnif3totlmDr neo;s seto(opoudamen icslsfarumu  ou4aleoifciys s uan o (4artomocty1op e uvi s)trxrxrpno4omeelneil(  Dtrxmooo1aexnmfeiadlsDranvp t) rerxr3tytlpDraues (0 rumimpou1lltelnvil() rrmu  ou1aexoif3tad aDrlnmon() leomf3oa1lmteai o;(0srtoxopnudlpt lfesa(fsDta(root0apt  feiytls uan o;u4teeoifctodoatran o s teumxo nydal n ieia( aDuax p;u1aetomfciys s uanvp;(0trxrmf iotlmDr uvolt0srxrxmpnu1ll nmfci t)s2trxmono1apt if3tatls2ranvsn(0 eerir tadlpD  ivo ()t2tmio3nydale mfcilt s2taxront4tltnifeiytlaDea( s;t)aeenio3tadlptelieo s srtrxopou4omen ici () rrmxroot4optnifctytfs ranvpnu4aleomoctatfaD  n o;t)texo(r ou1lltnmivs tfaDua(rp;o1tlxn icilsls2umuvsn(0trxnxo tatfpDeli olt0srxm(opny1optn netat)srraum nt0ape mi3tasfa2umuvs u4alxrmf oy1fpDrlu i t)trtr(o iy1llen fvtas a2trumo;t0aeenmociyslm ul( on(0 rtomo3iytlmtr u ol(0srtmim3oo4ol nmietl(farurur no1aexoifctld m2el(mo ()tetrxr ia1omtrln s t trxrxm ny1olt  ictls a2rmumo;u1tpeomfeiadla2rl( p (4trxrircio1lat li o;t trurirpiudoltemfetlt arrr( pot4olx moeiysfmDumu snu0tlerxrcio1op  lueil(  exoxr ou1lpeemicta(  Dum(m nu4aexn f3tlt s2rm( o t4 leomrciadoa e neil()trum(o no4am n fci sfa2tm(moot4alxnifetaslm2umn s u) exrmfciotfatr uesls)t2xmxm ny4ap elnvtat  2uaumonu0tpxoioeiltlaDel(msn(4texoircoytlmt aieo;s)sexm(m iu4ame  fesas)aDraum oo4openmfctlsfa eaumpnt4 lxrmrcty1fmtranei (  exmirpiodop   fvt () ruaxmpot0aetnif3iyt m em(vont0trtrif3ootlmD  i ils)t2tmxr nydam n net ( artm(rooo1olxomocildfaDemuvpnt4 rxrif io1fptrlueilt0 exoxmpio4op   fcs ()arum(rpnu1aexomf3ilt m2ua( snt0alerxr io1faD aivi ()texmio3nodom   iei t)srtaum ot1apenmf3iatla2umnvpnu0altrxf ootlpte neils0teur(r3io1op nmivias) Drr(  ;o0optomoctytls umumon()tlxnxrcoydlmD lnei;( s2xo(o3nu1ale lict s) Dumum ;t0open i3iatfs rlnmp;(4 rtoxr3iy1la rauvs s0 rtmir3iu4oltn netas  2uaxmont4aeeo ieiytlaDelu sn(4alxoifctodoa eau s () eto(r3ou4aptnmfesl()sDrrx p;t0opxo icild s uanvo (4alermo tadfm  au s ()teumiopoo1aptnmnes ()srraxronu0teeoioetaslsDrmumo;(0tltoxf tatfmt lu s t0srxrio nudll n ies t) rtm(m oo0apx ifctyt mDulu s;(4 exrxf3ia1la   i sls)s2umxr3io1omen fcils) 2raxro;t1oexoiiciydfa umuvs;u) rxnif3ia1fa rluesls) 2xrxm3oo1ap n ivtatf Draumpou1olx mf3tlsfa2umnvp;()trtrio iadfmte ues t  2tm(m ou1lmenliesat) 2raum ;t4oltnmiciyslsDua(mo;(0 rxoir3tadoat  nei s trum(mpiudom   nvi t)s2raxrpnt0aet  i3iltlaDum(ms;t0arerxo3oodoaD aieslt) 2to(m3nu4lmte iviltf rtm( pnt0tltnifeiydla uluvo u0tlxnxocio1op  ai s s0sruo(o io1ol nmiviat  Dtrxmooo4tetomoctysfm2eluvs u4alxnircoatopteaieo t0teuo(m3iodapt lfciatfs2tmu pnt4altnmfeiltla el(ms u)tlxrxo3iytfptr i s s0 rtoxmpou4ap elfvsls)a2rmxr oo4tle mietytfs2uaumsnt4 rtomo oadomtelivs;t0t2to(o3oudom   ies s) 2ra(  nu1oexnmi3tltla rmumpn()tltrmocoadoptr uvi;t)trurxrpou4lptnmfetl(fs2rru  ;t4tptoiietasfa umnvp;u4arxnxfcoytfm r nei;()trurimpoy4lltnmnctlsf rtmxr oo0openmieiysfsDraumonu)texoio3iytoaD luei (0trurirpoy4open iciat) 2tmum ;t4tlx mieild s2umnvon(4 rtoxr3oadfatrluvils0trtoxrpiydlmeelneil( aDrmxm oo0alt io3ils s ua(mo;t0artnioctotoaDrau i t0 2tmiopoudalee netlsf 2rmxmooo4ale  o3iatfs rmumo;t) rxnxf iatfp eai s;(0teumxmpny4oleemfvsa( a2rauro;o4oltn i3iyslmDuln o;t)tleoif oy1lp r neo s  rxoim3oy1amenlfetls s2rrxrpnu0tlto fciydla2rmnvpnt4 reniocoo1la raueo;t0teum(o io1amte ics t sDrm(  nu4aeeo ietas mDeluvsnu) exrirciadlatr u i t)s2ur(rpou1lpenmivsatfa2uax pou4apx moeiydlsDea( s;()aeeoxr3oytomD anvils  exo(opoudom emncil() 2ua(m ou4tptnmociadls eau o (0tetrir3io1fmtean olt) rxrio oydlmt mfesas)s2ururo;o1oeeomi3iys a2ua(mon(4tetnmr oatlm eluvo;t  rxmio iu1opee icsasf 2taxmp;u0olt io3iat a2rmuvs (4tltnmo3iodla eanvi;s)srtr(r ou4ome mfvta( srrrur no1alxomiciytfa ea(mp u0altnio iotlm rli sls0trurxrpiy1optelnvs tfs2taxr ;u0aexo iciytlm emumsnu4 lenio3oytfm   uvsls  exm(rpou4omtelicsat)s2umxro;u4oetnmfetyd a el(vs (4 ltrmrciadfmtelnvs t)sruo(m oydom e fesa(  rraumpnu0opxomi3ild sDra(mon(0alxrxo iatfp elieo t)setmimpoy4lm  lfci ()a2rr(rp;o1alt ifeiadlaDrlums;u4aetnif3oa1opDrauvols0s2umimpiydlle lnetl(farra(mooo0oltoif3ilsfm elu o;t0 lxrio io1fmt lieo s)seuoxm ny4ale mivsls)aruauront0opeo ociydfmDrm(mp (4 rtnxfciodlmteaues;t)s2trirpoodaptn ivs sfsDtm(rono4tptnifeiatls2emnvpn()alxomf tytop rlnvi;t t2xrir io1lltnlncs t)aruru o;t4texniiciatla2rln s;u4alenxo totomDeanes t t2um(opou4al emivi s srra(  nt4oee mi3tadlm rm( onu)tlxomo3to1oateaies s)t2xrxopiydal emfvi sfsrrau pnu0aetnmieilsfa elnms;(4 ltomfcoydoate nesl() etm(r3oo4aptelivsls sDurur no1ale  o3tydlmDua(vpnt)trtrxf3iy1omte u sl( s2tm(r3iydlpen nctl(  2tau p;u0tle iieiatls umu onu4tetrif3iy1op  liei;t0texrxr3nodomee feia( srraxrooo4aet moeild s ul(mpn(4tetrxr3iatlaDr u o;t)t2urir oy4amtnlfesltf rtruroou0tet iieiyslmDumu p;t0aleoio ootlaDrluvols  etriopiy4lptnmncilt)aDtr(ront1ope mocildlaDranvo;u)trxniocoadlmDelieo;s0 rumimpnu4lp e ictas s2ua(  nt0texn feiadfs2raums;t4 rxrxf3iotom  luvi t0seuoirpno4lm elietls) rtmxm nt0teto i3iadfa eau p;t0 rtnmf oo1lmDe i o t0t2toio nu4ap  miesl(fa2rmxmoot4olto f3iytfsDranvo t)tetrio3tatfatr iei;s)s2ur(o iu4omte nvia()a2umurp;t1opeomfctasla2eanvs () exoxfcootfmD au s s) rxrxr3nudlpee fvias)sDta(root4aexoio3iat m rlnvp;(0 lxrir to1om eanvo ( seum(opou1lle lfesat  2raur ot1teenmfctls a2um(monu0 leomocty1laDeln i t0t2tmxo nu1al  mfcslt  Drau  ;o4aexnif3ildlm2ranvo;u)teeomo3oydom   uvs;() 2xoio iu4omtn feilt  rrmx ono1alt mieiatlm2emnvs;(0aleoio3iodfp  au o;t) 2xm(m3iydopeelnctas)aDtrumont1aeeniieils m ra(vs () etomo iotlp rliesl( s2trio3iy1lm  lfct tfaDtaxrpot0tlen i3tld s ul(vo;t4 reoxr tytlp eaueslt truo(o oy4amtnlicilt)srrrxm ;o4oltnifeildfaDul(vsn(0 etnif3tytlaDr n ilt)t2xrxr nudol elncsl(f Drrurp;t0alx mfctytlmDelnmont4aexoxf3iotopDeau i s)srumxr nydolen nvi sfsruax o;o4tlxn feiatfa ranms t)altrmrciadlpt  uvols srtoirpiydlpeelfvi (  2ta(r ;o4apxnmfciydls em(mp;u4 eeomrciodlpte n ols trurir nu1ap  miesl(fs2um( ono0opxomietad m2uln onu0altomo iytfp e nvi ( t2xm(opou4lpe  feiatfsDtmur ou4ape ifetls sDem( pnt)artnmo tatom elueilt  rum(opiu1oltnlfcils) Dum(r no0olt moeiad m uauvsn(0aetoxf3oadopDeaues s  2tm(rpny4openmnvi t a2umxmono0altnmfeiatlaDrl( p (4 rtoif3todomD ai i t srtrxm oo1al emnet t s2umxmpno1tpenmoeiad s rlumsn() etnircootla   ivs;t)trtrxo3no1op e nci s) rua(ro;t1alxnmoeiydlmDean onu4arxomf oa1lmDelnvslt)srxoxrpoo4ap   iesasf 2trxmooo4oetoio3tytls em( p;(0aeerxrciytfp rlivs;(  etrxmpiy4lptelnvtlt)aDraum ou1optomfctadfs rmnvp (0 ltoxo io1fmt an il() etrxo3iy4alt lfcsas)srrr(mpot1teenmieils s ea( on(4tltnmr oadfat aiei t0trum(o nodamtemiesls)s2raxrono4tetomfeiatlsDul(vs;() eenio iytlaD au o;t0 2uoxo3ny1am nlivs t artm(r nt1olenifeiydfa uan ont) exrxf3iatlatean s ()teurim3iodlmtn fvia(fsDrmxm ;u1apxnmo3tydlmDrl(vo;t4aleoio3to1fm raivs;t  exmxrpiydlltnmivsat sDtrum ;u4tltoifeiltfaDrmnvp;(4tlerxo iydomteln slt)t2toiopou4lle  iesls)s2rru  ou4aexnmietydlsDum(ms;(4tetomr iatlaDe ivsl()seumir3nu1om  mictltfa2rrxmo;o0tltnmiciytfa2rluvsnu0teenif3oa1lptean ol( trtr(mpoydopt  neils)aDtrxrooo0apt  icilt m eanmsn(0tetnifcootoptrauesls)teuo(rpnodlmtn nesa()a2ur(mp;t4opeoifctysfa2um(mp;t) lenmr3oadlm  ai i (  ruoxopoo4ape lfet sfs2rm(  ot0opxnii3iydfa2ul(vpnt0tlxnmr3iadoaDelneo t truriopoy4ll nmiesatfartr(  ou4oetnmo3iadfa2em(mp;u)tetoxr ta1omt lnvo;s0 2xm(r nu1altnmfvtat sDtmx  no0opto f3ildla umu snt0 rxrmr3iytlp  auesl()t2urxr io1op elfes (fs2um( pnt4apx  oeiysfa2rlumsnu4teermfciotfm  aies t) 2tr(opoo4oltn fcslsfa2trxmpoo1opeo fctasfa uauvsnt4arxniocoytom r neol(0 rtrxrpnodol elfes () rtmum ;t0aeto oeiytlm eanvo u4trerxociydla  lneo;(  exrxo3iodlm nmfesls) Duau pnt1olxo iciatlaDul( s t0arermo oatomte n o () etmxmpnudlpee nct tfarum(m oo1olenmfeiytfs2rm( o;t4alenir iadlatrlueo;() exo(o nydam   neia(fartaxm ;o4oleniiciyslm uln on(4tlxnif3iotfpDranvi t0 rur(r oodam elivi t arrr(  ou0tpxniieilt m ea( p (0tlxrir oy1opDrli slt)tetoim3ou4alen nctltfsrrmxrp;u0oltniieilt mDrau snt)aeenmfcoa1lpDe ivo t srxmxo iudomenlfvi ()a2urxrp;u0olxnmietltlm emuvo;u4tleoircoytom e nvsls) rumiopny4olenmnci (  Drmu p;o1oetoioeiytfmDumnmo u) rxoxo3oy1oa   n o;t0s2tr(opoydoleelivs s aDua(r ;o1tet mfeildfa2uanvon(0trxrxo tatopt  i sl()trtmim oy4om nmncil(fsDtaurono1apxnmfetydfa2rl( s u4arxoiocoatla r ies ( t2uo(mpoo4ll emfvs ()a2ta(mono4tltn iciad sDrl(ms;u4trxnxr oytfa r ueslt)s2xo(m oudopte neilt)aDrax poo1alt miciyd m uln s t)aetoio oodopteluvsl(0sruoir no1apt mfvt s a2rm(rpot4oexnio3iasfs2um(mo u)arenxf3oatfmtraues;s trxm(opiudlptnmivsatfsDrru p;u1tlx mietadla uan s;u0 eeoiociydoaD li ols0setmim3iu4lptn net ()artr(ro;t1texnmoctys mDeau o;()artnxfctydfa rlneol(0tetoxr3oo4oltn ncsltfaDum(rpnu0opxoifciltfm2rln o u0areoxf tytlpteauvo;s0seumim no4am n fesl(fartrump;o1apen i3iyt mDumnmsn(0 ltoir3oytomt aneo ( setrio iudop nlfvt (  2ta( pot0apt iietasfm ranmo t0aeenmr3ty1opDe nes (0t2xrio io1lm n feia()arum(rpnt4opt io3ildlsDel(ms t)altoxf oo1oa  aieo;()s2xr(rpoo1aleelfciat)sDtm(rpnt4aetomoeias aDulnms;u) ltriocta1lptraueo;s)trtrir ny4lmtn nvtas)a2tmu  no0tptomociytfaDrauvs t4trxrio3io1fa rlneols0trtmxo oodop  micsltfartaur ;o0ole iictlt a raump;u)aexrirciytlmtraieils t2xm(rpou1omtelneiltfaDurxmpou1ape  feilt s2elums;t)tetnirciy1lmD lneslt  2triopio1lptnlnetl()s2uaxrpnu4texoioeias s2elnmo t0 exoxo tadfpt lieolt srtoio3no1alee ivi (  Dta(mpnu1opt ioeils a2umn p;(0aetrxf iodlateluvolt sexm(rpnodlm  lneil()a2tau  ou4tlxn feiltfmDranmp t4 rxrmo io1lpte ivs t0 rtrirpoy4ome lnctlt aDtrur nt0tetnmoctadls ulnmo (0 exrir oatlaDelu i;()tetm(mpiy1llenlici ()a2um(mpnu4optn feiyd s umuvp u4alenxf oy1lpD aneo t0srxmxopou1apen ieta()aDum(ronu1aex ioctlslaDua( p;t0 lenxfcoadlaDeau i;t0 2umxmpnydlleelfes t sDur(ronu1texomo3tlsls2em( snt0tetnif oa1fateauvs;s)seuoxo3no1apenlicsat)aDururont4oleomo3iadlaDeanmo u)altrmo3oa1omtrlieols)t2urim iydapt mncilsf 2urxmooo4olt ioeild m2emnvs;t4tetoxf3iotomtelnvol( srxr(rpny4lptnmfet () rrmxrpoo0alxomfciysla rlums;(0 exrio oa1fat au sl()teuoir3nu1alt lnetat) Dumx onu4apxn ictyslsDrlnmo () eeoxfcoo1om eanvsls t2ur(rpny1apte fvil(fartaurpou4tpxo ociadfa ua(msnu4 ltnir3oo1omtr i il() 2xoxo ny1alenmneiat)sruax pou0tpe  fctytfa2emumont)aeeoif todopte ueo;()s2uoxr3nodome lics sfs2tr(  ;t1alxnmo3iyslmDumnvo;u4trenio3todfpDran o;t  rur(o3oydlm emneiat) 2rm(mpno0tlxoifetydfaDuan pnu0alerxfciy1fmD luvs;s trxr(o iu1ap emnci (  2ur( pnt4openmfcilslm umump;u4tetnxo3tatomDeanvo s0 2xrxmpno4llenliei ()aDtrxmo;t0openmoeiydla ea( onu0artoio tatfm e nvsl()setm(o3ou4aleelictas  2trumpoo0apt moetadfs2rm(mp u0 lxoxocoodfmte n s s0 2tmxm3oy1omtelfvtas) Drm(mono4tlt  f3iltls2rauvont) ltnir tatoaDe nvo;(0setoxr3oo4ol nmiei s)sruaxront0aptoii3iat m rm( s u4 lenirciatomtr ivs t)texmxm3io4oleemnviat)aDrru  ot1apt mieiydlm eln o u0arermr ta1lp rlnvsl(0trtmxm nodlpenlnci () 2taur ;t0oex mfeiatfm2uln s;t0trtomf3oatomDe nvsl()teuo(m3oy4am  mnctltf 2rru poo0tpx  o3iyd mDumn p u4 exoxrciydlmDelu s t s2tmxo3no4ll n icslt) 2umxmonu1tex mo3iltlm2rmnvpnu)altrifcta1fp rai o t0 rxm(o3oo1op  mietlsf rraumono0teto fciadfmDrlnvpn() exnmr oatfm r nesls  2toir ny4op nmnetlsf 2tmxr ou1opxo ictyt m2rmnvo;t0areoxr tydop elueo;()sexmirpoodlmtemfeslsfarraum ot1olxo i3iyd m2ean o t)trtoxf3oy1oa ran s ( tetm(m3nu4lm elnei t)a2ururont4oet ii3iyd m2rl(vs (4trtrxocootlaD  uvs;t  rtrxo ny1lpt lnetls srrrxmooo4aleoifeildfmDelnmon()texomr iy1oa  lueil(0srxrxm3ny4omte nvsat) rtmur ;o1oetn ietyslm el( ont4arenif ia1fmtrluvo (0 rurim3iodlptn ict (fsrrrxro;u1tle moctat a2ra( s;u)alxnmocoodla eaies s)s2ur(r nydalt  fvs sfaruaxrpot1opxoifciys aDrlu p () lerxrciytlatr ivi s0t2umxr3no1omte ict t)a2um(monu4aleoiictldfs2ua( snu4alxoxf iatfateln i;s  euriopiy4ap   fvt s) rtr( pou0tle  icild a rlums;u4 rtoxo oatfmD li i s sexoiopiy1lle mfvt s) 2uau  ;u4teenii3ilslm rauvsnu)tleniocoo1op  aivo (0t2uo(o iy1al   neslt) Drmumo;t0olt  oeiydlmDrl(mpnu)trxoif3oytfmtrlnei;t0s2xrxo3ou1alenmnct sf rtrxmpnt0tlto fetldlm2ranmonu4trenxfciotfaD lneo ( truoxr oo1lptelfet s) 2uaumoou0alenmo3tls a rmu onu4tetoxfcoadfm r u i s0t2ur(r3ou1amtelfci t) Drau o;u1oexoio3tlsfs2rmn s ()tlermr iytfmt  ieolt0t2xm(m ny4lp  mnvt s sDrmxmo;u4alxnmiciltla2rm( s;t0aleoxf iadlptean o;() 2urio3no4lm   fetlt arrr(  nt1apeo feild a rmump;(0tlermf3io1lm eluesls t2xrim iudame  fviatfs2rr(mpot1openmfctyt aDumuvo (4 exoxfcto1opDr u s;t0teum(mpoydal elfvia( sDtmumoot4aeeoiieiltfa2raumpnt) rtnxo iydom  li s;s trtmxm iy1omtnmictatf Dtmxr oo0oexoifctydla2ea(mo;(0 rtoioctydopDelues s  2uoxr3nudap n nctas) Drr(ro;t0tetnmoetys s2elu p;t4arenxrciatfpD aivs t t2ur(r no4aptelfct ()aDta(r ot1tpto fctysfaDrauvonu4 eeoio3iatfmD livslt)t2xoir iu4lmee fei t)aDtauro;t1oltnif3iatfa elumo ()tlerio ia1lp eln o t  ruoxo oodamt lnciatf ruru ont1aexomictasfa2uanms () etnmocta1fa   u i;(0 2trirpnydlpteliesls)a2rrxrooo0tpenmieiltfs rln o () rtnmr3ta1fmtelnei t) 2triopiodamt  ict (faDumxroou1aeeoiociatlaDemuvs;() lxoxfciodlmt  ies;t0 2umxrpny4op nlivil( arrrxr nu0aetoifetat m2ra( o;u0tlxoxoctatfmDrlu ol(0 rtoiopny4olt mfvsa(fs2taxr ;o1tpxnmi3iltfm2em(ms;t)texrxo3oytoaDr ueslt)teuoio3iu1lmenmfcta( a2tmur no4tpt  o3iatla2ul( sn(4tetomr oo1fpt  uvo;s  eum(r3oo1om elnvs s) Dtrur nu4apx ioetytls2ranmsnt0 eeoifcto1opD anvo ()trurxmpny1ome  ict tfarrr(rpnu1alxn ociat a2rlumsnt0tlerifctotopDean s t  etmxr oo4olen iesat a2rm( onu0oetn ocilt m umn s;(4aeeoir3tydfmt li s t  eur(opiu1ole mfct s  rumump;t4tetn oeiat s eluvp;u0 etrxociydomt lneil(0truoxr3nu4ape lfvt sfsrumxmont1tee ifetltfs ean snu4arxoxf io1lpDr neils  rurxo3ou4ll n fetat  Dtaxm ot0olx ioetldls rmumon(4teerif3totomteaies () ruoim3oo4om nlnes ( sDuaumpno1alx mieiysla rmnmo (4artoir3tatoat lu s t) 2tmxrpnu1lmenlnes t  2tmxrpot1olxniociadfm2uluvo t0aetrmr3iatlpDr nei;s0 eumim3io1ape lnvs ()aDrmump;u1olenifctydfaDeln o;t)teenmr3oadfm   i o (  exmirpnu1lptn fvta( sDrau  ;t1texoiieiadlaDemumpnt) rxoifcoytla  lu i;s) eur(mpnudlp n nesasfaDur(ront0olxnmieiadfs rlnvsnu4tlxrxf oadfmtelueo;s0 exoiopio4olenmnvsl(f rrrx poo4aexnioeias a2ulumonu)texnifctadlmD  i o;s  exoxmpoy4lmt  net t)arrrxrono4opxnifctasfm2raums t0 etnmrcoatfptrauvilt s2xoim3no4ol emnciat) 2ururooo1tetomi3iat mDrmnmon() etriocoodlat au i;s)trxm(o3ny4lm   fvsas)aDtaum nu0teto ictas sDul( s;t4trenircta1la  lnesl(0 ruoxm oodolt  feils sDua( o;t4aptnii3ias a umnvs u0tetoxr iodoptraues;s)trtoxo3iydol elnei ( a2tm(rpou4tex if3iyd m umuvp (4alxnmf iytla  au o t setrxm iu4ape  ivt t)sruaumpoo4texoif3ilt sDemnmpnt4 etomf oydla eli olt setoir nydlptnlnvtlsfa2ta(moou0apxoio3iyslm2ua(mo;t4tltnif iodfmte iesl(0texrir oo4lmt mneilt s2rmxro;u1tpenmicildfa2rln snu4artoxo3iotfmtr i ols)t2toxm3iu1amee fesls)s2rrurpot4oeto ieiytla2rl(vs u4tlxrxo3oydoaDran ilt0t2uoxm3oo4ope lnei () 2ua(mo;u4aleomfctlsfm eau o (0 eeoxo io1om e n i;t0srurxm3oy1omtnmfcsat)s2urur ;t4olenifetas sDelu p () rtoifcoo1lpt lnvolt0trxrxo3oo1lp e nvil(fsDumxmont1oexn i3tydla ulnmo (4 rxoxr iy1omtraies s sruo(r ou1llt lncslt  Drrxmp;o1tee ii3ilslm ranms t4tlenmrcoodfmDelivi (  ruo(o ny4lpe  feta(fa2tm(mono1altn feilsfs2ul(vont0 lenxfciadfpD lues s) eumxr3iydapt livi ()srraumpot0texo ictatfm2raums (0tlenmr totomD  ies t0s2xrxo oydamtemfcsa()srtmur ou1oetn i3iltla emnmp;u0 lerif3ty1fp  aneo;s)t2xmim no4lmenlfctl( srtaur ou4tee mi3tysla rmnvo t4trtnxf tydfatrau slt0texoxr3ou4olt  nvi () Drax onu1oeeniociasfsDulnvp;t4texoioctotfp   i sl()teumxr3nu1ape lnvtl( aruaxrpot1apeniiciatlaDrlump t4alenxr ta1fatelnes t0 2um(m iy4ap nmivsat a2tmx poo0opeo f3iadfa emnms;(4 exnmo3oydfat  ueo t) 2um(r3ny1lmte feta()s2tmx oot4olxo i3iyt aDem( pnu) exrxrctodfatr nvsls0seuo(m3oo4ome  fci s) rrmxro;o4tptn f3tyslm2uln s;t) exrmo3oydlmDrau olt  exoxm nydllte fvtl() Drmu  nt1texnif3iatfsDem(vo;t)texoif oa1fm eau i;()trxmir ny4lmte fesl()aDrm( poo4altn fctltfmDua(mont)trxomf3iytfm rauvi s)srto(o3iy4lm  mfvt () 2rmxrp;t0tpxnmieilt sDumnms;(0 exnifcia1lm  lieo s  eumxo no1ol elnvtas  Dua(m ;u4tetoifctat m2emump u0 exomfciotlmDeau s (0tetrimpiodapee ivslt sDrm(mo;u1apx  ociatfm2ua( s u) rerxrcio1fpteau sls0srtm(o oy1al  mfesl()sDtr(root4opeoifcilsfm2ul(ms;t4tltnmoctodfa rln i (0s2tr(opoudope lfcsa(f 2raxmpno4aet mieiat mDum( o (4 lenifctatfpD auei;s0seurim3ny4lm nlnviat)aDraxr ;t0oex  fcildfmDranvpn(4 rtnirctodfaDeln s s)t2toimpno4ameelnei ()sDumurp;u1optn feiyt a rau pnu4aetnxfctatopteauvo s srxoxo iu1aptnmncilt)s2ua(rp;u4optnmoeild s2uanvpnu4trxoio tadlpD  uvs;( setmxrpio1am  mfviat sDta(mo;o1oetoii3iad m rluvo (0texnxr3iodom  auvi t)trtmxmpiydoltemnctls a2tau pou1altn ocias sDrl(vsnt4alxrmr3oodomD  ieolt0 2urim io4ame lfetlsfarumxrp;u4tlx moeiytla2ua(vpn(4arxrxf3ia1lmtr iesls0trtriopoydol  livtatfsruau  ;u4opt moctyt m2ul(vs u)artoxr iytomDeli i;s)t2xoxm3io1lltn nctl(  2taum nt1texnioctas m rlumsnt4texrio3iatoatrli s t0srtrimpio1lptnlfcsatfa2ra(rpnt4aee ioeiadla2rm(vont4aetrio iytomt lies ()tetmxr3ny4lmtnlfcsatf 2umur oo1tpx  ieiad m2um(mp;u0areoif ootfpDr u ils0t2uoxo3ny1lptnmiesl(f rrmur nt4aleoii3tyt a ea( s;()arxniociadomteauvslt0tetoim iudomtemfcs (fs2rax onu0apxo icias s2umu pnt4 etrio3oatfm  ai o t trxm(r3ou4lm nmnviasfarrauro;t4apto fetas sDea(vo (0trtnxo3todomtelu slt0s2umirpnydomenlfesls)arurxroot4texo i3iyd s2uanvo t4teerxf3tadlaD  neslt)texriopou1ll  mnet sfa2trxmpou1tlt mi3ild aDulumo t4artnirciodlp  anvols0 rxmxopnu4amtnmncsa( sDtrxrpnt1olxn oetydfmDrm( on(4artnif to1lpD  u ol(0 ruoimpiydopt  nvi t)srtm(rono0tetn ietld s2ea(ms u4aexnxr3iy1faDr u ilt0 2to(rpiy4lleemncsls)a2rrx o;t4tptnmfetldfa rau o () rxnif iodomteaivsls)s2xr(rpny1lmtelneils)sDra( ooo1olt ioetysfa2uanms t4arxnmr3iy1omt auei;( srtmxr iy1lme lfctas) Dta(ro;o4oet  f3taslaDulu s u)altoio3todlatr ivol(0 rtmxr ny4lmtnlfcsat  rur(m oo0aleo ietlsfmDrm(mo u0treomr totlaDrlnvs;s)srtoirpoodlltn nes (  Dtaxmpot4alxnmiciytfs uau s;t)arxnir3iy1lm eaieo s0trxm(r3iy4al nlietlt)s2taxm ot0oexn ocilt s2um(vo t)artrxr3tydfat  uei ()s2xoir3no4om  lfvt s  2umxmont4oeenmfciytla2uauvo u) rxnio3todfaD anes t tetoim3no1alen ivtas) rua(monu4openmf3tytfm2emu s;u) etnmf3iodlp e i ols0t2xoir ou1om eliciltfs2rm( pou1tpt mfctaslm2el(vs;t4 ltrio3oy1lpD  ivi;t0sexoiopou4ap emivia( srtr(roou0alenii3ildfa2ea( pnt) lxrmf iodfa elu o s t2tmim3oo4ll n fesl(fs2ua(mooo4tpx mo3tlsfmDrmnms (4tleomrctotlaDeaueslt)s2xo(r3nu4opt mfcslt)aDrau p;o0aleniociyt sDulumon
\ No newline at end of file
@@ -0,0 +1 @@
+u o (0trxoimpoo1lmenmnvi s srtmx  ;u0aee ifetlslmDrmn o ()alxrmocty1fptrlnei;t  etrio nydaptn nct t)s2urxr ot0alto ieiys s ean pn(4 rtrxr oa1fp rlnvs;(0trtr(o3ou4opeelfvtatfsDtr(mpou0tee  ieiys s2rlums;u)arxomf ta1fp elivs s)s2uoxr oy1ol   netas) Dtmu pnu0tlto octytfsDuanvo u4arenmfcoodfmteluei;(  rurirpio4op elivi tf Dtaum ;t1aleoifciadla eanms;t) exnir3iatopt luvil( srto(opoy1ap emivtatfarurx onu1tetoiiciyslaDrlnvp;t0tltomf ia1lmDr neolt) rtrio nudllen nvt (farrruro;t0tlt ifctasfs rlu s;u)altnif3todfm  anvs;()teuo(r3oy1omtemieils a2raum ot0opxn octyd s uluvo;t4 exrxo3oy1opDelivolt0teumxrpou1ap e ietl() 2raxr ;o4oeeoifeiaslm2ranmo () rxoxr3to1oa  lnvi s)sexr(m3ou4lleemnet ()a2ta(mpoo0tetnif3ilslsDel( p u0 exnifcoodoa rai s s0sexoxr3nydol  mivsat sDraxrpnt4oleoio3iyd a umu s;t) rxnir to1om r ivs;s srxoimpoo4lpenmnesl(fsDra( poo1tlxomfciydfs2um(vo;t4 lermr3oy1om rlivols  ruo(r3oo1lm emfviat)artrurpnu1tex ifeiyslm ul(von()arerif3to1fmDrln slt0teuoim3nydlleemfcs tfaDrrxmonu1aeeomfciatlmDemuvpnt4 lxrir3oa1oa e ieo () rxrio oodalt mfvt s  Dta(  oo1alenmi3iltfm2ea( s u0 etnmo3ia1omteln o s)teurirpiy1ol  mfctasfsDrm(r ou4apxnmietltfs2ea(mo;u0aeenifcoa1opt auvilt  rtmxo3no1ll emfci sfarta(mo;u0apen i3tytls ran s () eermr tydfat lnei;t sruoio3iu4alt mnctas  rua( poo4aptoifciydfs2eln pnt0 rtnmf3ia1lm e u o s) rtmxrpoydop  mfvslt)srurx oot0aetomfetys mDemums;u4 rxoir3todlat  i s;t)teur(m3nodol  livt t)sDurxr oo1optn fetatfs2em(mpnu0 lenxo3todfp r ueo;s) eur(m iy1olenlivslt)a2um(m ou4apx mfeiydfs rmnvo u4altrmf3iytlmD  iei;( srtmxr3iy4lp nmivtatfsDtr(rono4apxn i3iytfaDelnms;u)tlenif ta1om e iei;t)srxo(r io4lp nmictlt)sDua(mo;o1apxomf3iadlaDuan onu)artomf to1fatraueo;t0trtr(m nodlmtnlneiat) Dur(mpot1tle ioeilt a2ea(mo;t)trxrmo3iatfatrln o t teum(o3io1lmtnmiesatfaDur(rono0tee  i3ils a2rmu pnt0tltnif3iydoaD  u o;( trtoim3iudapenmfei s) rrmu o;t4aetniociatls eaumo;(0tetoxocoodomDe uvs t setr(r nudopte ieil() Drr( pnu1oleoioeiyslaDumumo t0aexoxfciatomtrau i;s srtm(m io1altemneia() Drm(ro;t4tetomf3tat sDul(mpn(0tlerif3oy1lpteaneolt  rtr(o ou1omte fei s)arrru  ot4aexoiieiytfa eaumsnt)tltoio3ia1laDeln i t  2urirpou4ap   icsatfsrrau o;t4oee mfetlslm em(vo;u)tltrmfciatlm   neo;t)s2xmxm3ou4llenmncil(fa2uaurpnt0tptomf3iat a raump;() exrifciytlptrlieo s trurxm oydope lfct tf 2tmx oot4alxnmf3iytla2eanvs;() exrxf totfmteaivils t2tr(m oy1open iei s)aDtmuro;u4apt mfeiytls uln o;u0 lxnio oytoaDraivs t0 euo(mpio4lmtelivt tfsDraxm oo0oexo o3iytls ul( onu0trtnxf iatlm ranvs s)teur(r nu1op  mfvsatfsrurxm nu0aet ifetlsfsDran p;() rxrmocio1fm eaivils t2xmiopnudameelivtl() 2tr(r ot4openmfeiydfaDran s;u)trxnxocoy1lmtr ieo;t)s2triopno4om   fvt tf rtmxr no0opxnioctatls ean o u0 ltnxrctydfpt livo (0 2xoirpny4ll nmfcia(farrrx p;t4oee ii3ils mDrl( s;() leoxo oadlp eln s s)srtr(m3iudll  lfvi s)arrr( oou4apxnioeias mDrlump;t4texoifcoo1om  an il( s2trim iu1aptnlfct s arrrx o;o1oleomi3iltfa2umnvp (4 etnmo3totlpDr nes;s0truo(rpnodolte fcsltfs2tr(m nu1tee mfetytfsDuau o;u4 ltrmr oy1fmDrau s;()t2ur(mpiy4om e icilsfsrrmumont4apxniieiat aDumn p u0aeeoir tatop  luvs ( s2trxo3ny4lmen nei tfaDta(r ou4tlxniieias aDran p;u4tltoxfcoadfat aies;s trtrim oudoptemncil(  Dtm(mpno0teen oeias sDrmnvp;t0aetrmr3oydopDr u i s) ruoim3oodamtnlfvsls)a2umxm ot1oet mo3iasls emn onu0arxrif3oy1fa r i sl(  rtoiopnu4oltn ncia(fsDraxmo;t0oetnmoctlsla rmnmsnu4 etrif ta1fpDe u i (0trxrir3no4ope  nesatfs2rrumpnt0altomo3tydfaDul( s u4texomfcoadfat  nesl(0 rur(o3iy4aleemfcsatf rrr(r nu0oeeo oetlt s2elnmp (0 etriociytomt  neil(0 2trimpnodlmeemfcta()s2ur(mono1tlx mietatls rm(mp t4 lxoxf oodopD li s;() rto(opno1ameemfetls)arur( oot0oee mocilsfaDel(mo u0aetnxr3oydfp   uei t) 2xoim3iy4oltemncs s s2taxmpnt1apt mieilt m2ul( ont0texrif3oa1lateauvs (  rxmxopnu4omt lfesat) Drm(r ot1teenioetltlsDemumo t0 rxoxociatlpD  ieo () rtoio nydale  ivs t) rrru ooo0aleomfetyd mDel(vo () rerxf3iodlm r ueils srumir3nydlmee ietlsf rra(mpnt4oltn o3iys m2eln o;u0 rxnxf tytlm rln slt)trto(r no1ll emivtas  2umumpnu1teto i3iyd m2rln s;t0tlxomf oytla  aivsls) 2xoir no1ll e fetas arraxmp;u0tlxn f3ild a2uanvs;t)tltrxo3iadoptelivs (  eurir iu4omtn fvsltf rtmumo;u4alxo ieiadfm raums;(0altnmr tydlaDrlies ( teuo(m iy4openlfcs s  Drau  oo0teen ietysfa2eanmo (4 lxomrciydlp rlieilt0 euoxo3io4opte fvilsf Dtrx  ou4apx  ociysfm elnms;t4aetrxfcoadoptr ivo;()t2xoxo3nu1amtemfct ( arrmurpnu0olen oeiaslsDulnmp;(4arxrxociotoaD aueils) etr(o iy4lp emnei tfa2umxmoot1apxnmfciytfs2rauvonu0tltoxf ta1om rli olt texmir3oo1lpee fct sfsDrauroou0olx  fcildla2ran pn(4 ltrmf iadoat  ueilt) rtoxopno4apte fcs tf rtrxmoou4oeeomoetatfsDeauvs;(4trenif3iotlp   u s s0t2umiopny1ol nmiesat srrrumoot1alxnif3iydla2uauvs;u0alxrir oo1om   ieo;()trxmimpoo4omee nvi sfs2tru  oo1tle miciyd a uln p;u) lerio oytlmDeai s t)s2ur(opiydop nlfvtls  rrmx ono1oeeomieild m2ua( on(0tlenioctotlaDelu ils) 2um(o3oodlptemiviasfs2umum ;t1aexomociyt a eau s ()aexnmo oytfmt anvo;t texr(opno4lp nmivtas)a2ua( onu1alen iciadfm2em( pn(0trenxo iytfatelu s s setrxopno4al n fvs ()sDtm(rono1open octasfs2ranvp t4teenxo oa1omDrlneo;(  rtmiopno1amee ivt ()aDrmu p;u1aetnioeiaslm2uluvpnt0aetrxf3oytopteluvol( seum(opnodlm nmfviat) Drrxrp;o0optomoeiat aDulnmp (0 etrxocia1lm r neo (0seuoxr oudapee nvsa()sDuaxr oo4apeniieiadla uauvp (0arenmo iydlaD lu ilt0 2toim3iudamtemnci tfarraxrono4oexn f3ildfaDelu ont4arxnifcoatlpDeanvils srxo(o3oy1lmtn fct tfsDuaxmpno1tpe ifeiysfsDuan p;(4areomo3tadlp eln i t)trxr(r3iudlmeemnvs sfa2uax  ;t4texoifciasfs ean p u0texnxf ta1la elieilt0truo(o nydome lncsat) rtr(mooo1altoifeiysls2ranvp t) rxrio3iy1late i o t  rxoxo3ny4apte ncsl(fs2ta(rpnt0aptniietld a rmumpn(0 etnxrcoo1fp r ueilt0t2ur(o3no1llee nvt s sDrm(monu1tle  fciltfs2rmnmsnt)tlxoio3tydfmteaieil(0teto(o nudopee fctasfarrau  no4altn i3iysfs2rmuvs;u0arxnxfcoadfa  anvs (0 2uo(m iodaptnlfvsat arrrumooo1aptnif3tldfs2uanms;(4arxomocio1omtraues;s  rurxm3ny4ape mfes t)a2tm(monu1apt  feiltlsDrl(vo t0 exrio3io1lat au s;t)tetm(o io4lmtemfvsls  Dtmurooo0alen ieilsfa2rluvpn(0aetrmrctydlpDe n o;s s2to(r iy4aptn ivt s)srrrxr ot0tltn feiys s elu on(4 renirctydlat anvo;(  rumio no1oltemnctlsf rtax pnt4oeeo i3ilsfs2rmump u4 exomr tatoptrau s;(0tetrxo3oy1ale  neiasfsDurxmono1ope mieiaslsDrlums;(0texnmo oytopt ai s;t0 2uo(r3ny1lle  fesas) Dumx oou1aleomfeiadfmDrl( s u0teenmociytoaD au o;t0setoxrpiydaptnmieta() rraur no1tpenmieilsfaDua(vs t4aexrmfcoa1om ranei;t) rxo(r nudlpen nesa(farta(monu0tptnmociasfs2uluvsn(4tlerxo oa1fmD lieo ( t2xr(rpiydll e fvs ()a2rax onu0alxo fetatlsDea( p;(4 lxoir3iytfmte ueo;t0sexmxmpiu4lm  lfctat s2urum nt4oetnioeiltlm umuvo t0 lxnxf oatop r u ilt seur(m iu4am nlicsa()a2rr(  ;u0oeenifetad aDrmnmo t4alenxr oo1omt aneols0srxo(opiudal  lnes () Dur( pno0tltnifetlt mDrm(mp;(4aetnmf3iydlm  auvi t0 2uo(rpoy1op nmfetls) Dta(rpot1tet ifeildfsDrluvs;(4texnmf to1oat lnes t0tetrirpiudlmte ncsltfaruax  oo1oexo fctatlm2ra( o;u4 lermr totlpDeliesl()srurimpiudol nlfct s)a2tmu p;u0oet  feiyd a ul(vsn(0teerxrcta1fatelivi;( trxmxopoydamtelnvt sf 2umx pnt1oex if3tys m2ulumo t) ltnxfciotfp  auesls setm(r iy4olenmfct sfaDua(rpoo0oee iieiaslaDeanvo;u0artoxf iydoatrlivsl() rtmxmpno1lp   fct sfs2trxronu0opx miciadlsDrluvo;u0texomf iytoatraivols0 2ur(opio4op elfeils a2rrx  no0apen oeiadlaDeluvs;(4 etrxr iatom  lu ols)tetr(r oudamenmnvsa() Dtaxront1oeeoio3tas sDemnms;u0tlenir3io1la eliei;t)t2ur(m3iodlm nmnvsls)sDtaxm no4oexnifciad s2rluvonu)trxrmr iotlmtrauvs (0s2umxr3oy1altelfeils a2um(rpou4apt  oeilsfs em(vsnt4 ltrmfciatfpteln ilt  exoxr iy4oltemnes ( s2tmx pnu0tlt ii3ild s rmumonu4aetrmrcootfm  aivi;()trxm(o3io4olt micsa()a2uaxr no4olx  fciytlaDuan on(4altnif3tadlmDe u s;t texmirpiodlpt mivt ()arrr( onu1tee io3tysfa2elnvo u) exoircoy1fptrlu s (0trtoxr nu4amt lnvta( s2rmx oot0opt mf3iytfa2uanmpnu4arxoifciodfp rauvi;t0t2trir ou4al  mivi sfsrtrxrono1tex mociytfa eau onu4aexomfciy1om  aivs t s2xo(mpnu4omen ieilsf Dtrx p;t0olt  fciad s2rln o (4 lenxociotfpDraies;()texmir nydamt licslsfarrr(  ot0oex ifeiasla eanmp;t)trxnxrcoa1lmDr ivs s t2trxo oo4optn nvi ()s2rmxmo;u0tle mi3iytfm2uanvp;u4aetnxo totop   i o;( trxrio3nodlpe  fviltfa2tm(mo;t0aleo f3iat aDulumo;(4 ltrif3ta1fpDr nvo;t)t2umio oudoltnmies ()s2trx  ;o1olxniociltla uan p u0alermr3oa1lmDr i o t teur(o3io4optnlfeslt  2rr(mpot0aeen ieiad a2rl(vpnt) lxoxr3tadomDrlies;()setmim oydol emivi tf Dua(mono1aexnio3tadls uau pnu0aexnxocto1lpte i i t texrirpoy4opee fvslsfaDrr(r no0tex ifeiydla2el(vo;t4texnmfcta1fmt au slt) rurio iu1omenlivtl( artaumpnu4tltoiiciat aDuluvo;t4 lxniocio1faDraivo t) exoxo3oodllt lnetatfs2ua( poo4opeomfeiltfaDuauvs u4aetoif io1fpDr ivolt0seuo(m3ny4lpeemict ()srrmx  ;o0tle ifcild m el( p;u)arxrmfctotla rlnei t)sruoxr ou4ll  mfciatf Dua(ro;u4apxn oetadfa2ra( s u0aeenio oy1lpte nvo;(0trtm(opnydop n ncsls  Dtmu oou0oee iictlsfaDrln pnt4tltomrciodop r iesl(0s2trio oodlm  lnctat)aDrr(  nt0tet  fetas m ul(vo (4arermf iotlat aieslt) rumxmpiu4altemicslt sDuauronu4oleo f3tydla umu s;t0 lxnio to1lpDeli ol( trtoiopnu1lm elfesatfsruau poo0aetniictys aDum(ms u4tltrmf3oydlpDrlneo t seto(r iudal elici t a2rauro;o1aeenmociysfs umnmon() lxrir3tatla  luvs;s0 exm(rpiy4lmt  ncta()artm(m ou0altnmoetld s uanvp;u0aexnxf iadom ranvi;( t2umxo iu1llt mietasfsrrr(m ou0tpt mieilt a2uauvs;t4altnxr todfa eaueo;s) rxr(o3oo1lp emnvi (fs2trx  ou0tlxo fetatla rm(mo (4arxrmocoa1om eaueils0texo(o ou1ol n fvtls sDta(m oo0oee if3iatfsDrln pn() lerir iodfp eln i;s0tetoim3iydlmt lfet sfs2raxmonu0opt iieilslm2emuvo (4 rxoif todlpDrauvo t) exo(mpny1omt lnes t srrmxrooo4oetnmietadfs umumo;t0artnio3oy1lmt  iesls)trurxo3no1olte ietasfaDururpoo0teeoio3ilslaDul(mp t0tetoio3tytop e uvi;t trxm(r iydlm nliciatf Dra(rp;u4oexo fetydfa2emn sn(0texrxo3oodoate u i t0 ruoxr iydap  lfciatfa2urxm no1tle  ociysls ua(mo u)arxnxo3tytfatelivs;t) eur(opno4optnmnvt (fsrtmu o;u0tleomictlslm ulnvpnt0texoxr iotlmD livo;s  rxmim iu4lm nlictat  Duru  ;u4tpxo o3tatfaDrm(vo u0 rtoxfciotlat lnvs s)sexmio oudlmtnlncil( sruau poo1oltomietlt s2rmu p;u4 lxoioctytfateaiei () etoxrpoo4alt lfci sf Duau o;t0alt  oeiytfs ra( o (0treomr oydomD lneils t2xr(r ny1oltnlivsl(faDur(rpnt4tee  ocilslaDrmnvs () lenmf tytfp rlieo s0seurirpnudop nlicil( arrrxmpnu4tpeniociltfa2ra(vo;u4 eerxo3oadfm eluvi ( texoir iy4apenmnvia(f rtmuroot1tpx  ociytlm umnmpnt) leoifcoo1lat aneo;s s2xmir3nudomtemnctat)sDtrumooo4optoiiciltfaDuan p;u4 ltrmocoy1omtean s s tetmxr ou1ll  lnctatf Draxmont0aptoifeiad a2ranmsn()aetoio3tytlat au olt0trurir ou4lleemivsatfa2rm(mpou1tpeomo3iys a emnvp ()arxrxrcta1fmte uvols t2xr(o3ou1lpe mnctl(  2ta(m ou4opxoiietat m2ranvon(0tlxrxf3tytopD  u i;(  exoirpnudap  lfeilt)a2tr(m ;o4aee mf3iys mDrm(vpn(0artoio iodom  an s;s  rxr(opiydlm   icta( aDrax o;u0aexnii3ilsfa2ranvont0trtnxr iadlaD an s;t0 rxmirpoy1lme lncsl(fa2rrxr ot0tltomf3iytla2umuvo;u)trermo3tatla  aieil( s2urir io1amtnlfcsa( sDurx poo0teen iciatfs ea(mp;t4arxnmrciotoaDe nvi t)t2umiopoy4amtn neta() Dtr(m nu1altn ieilslmDeln p ()trtnmfcty1om eluei t t2to(m3oy1amtelieiltf 2umumpou0aleomoetltlm umnms;t4tlxoxrctadoa  au o s trum(o ou1optn ictl(f Dtm( o;o4texo o3iytfa2rl( s;t4aeenirctadoa rlivi (0 rxoxopiu4lmtemictat  rtmumoou4oeenmietltfm2em(mo;(0 lxrmo3iadfmte nvols sexmirpiy4apte neia( s2tru pou1teen fctatlaDraumsnu4tlxomo3oodlmtrluesls trxoimpiodll nmfvi ( a2rru oot1tpt  ictat s2ra( pnu4 lxrioctydlm r ivs;(0 2tr(r ny1omtemicias  rtrurpnt0aet  o3tytlmDeaumsnt) exnmo3iadlmte neslt0 eurxo3ny4amee neilsfsrrm(  oo1tptomi3tyt s umn o;u4aexnircoydlp  au s;t tetoio3oydoleemivi tfaDua(mono0oeenioeiltla elnvont)tlxnxr3iydlpt  nvs;t0srtrxm nu4olte ivsat)artmx p;o4texoiietatfm2emnvp;(4areoxr oodfa  ai olt0 euoio3nodoltnlieiat aDra(m ou0apeomietld a rmump;(4trtomr ta1oaDe ivo s0 eto(r3nudome mnvsasf Dtm(mo;u4opt  ocilt a2rl(vo;t) lerxfcoatoat  nvo s) euo(o3ny1ol  lnviltf Drru p;u1ale mf3iytfm2ra(vp;t4altoifciydlm  lnvs;t s2xo(opoudomtnlfeil(f rrm(m ;t0tlx  ieiatfs em( ont) rxrmociodfa r uvo ()t2xrim3nodoleemfvs tfsDumu  ;u0aeen fciatlmDumnvpn()trxrir3ootop   ivo;(0sexo(r3iodopt mncs (f rtr( onu0aet moetys a2rm( o (4 exomfciadlptr neo (0sexm(rpoudllenmfctat  rtm(mpnt1tlxn f3iasls rl(mont0 rxoif iatfpD ln o;( setoxo3ny4olenmfctls) rraxmpno4opxoiictadlsDrl( o u4teenxrctadlpD luei s)t2ur(mpiodlmenmici tf rtr(moou0opt ii3iatls2el( pnu0aetrmfciodlmt  uvslt0 rurxr3iu4olen nvsa()aDua(rpnt4tlxomo3iytls elnmont4 exoifcio1op rln ils0 rtriopiodale mfctatf Duru ono1olxniicildfa ea(mpn()tltrifcio1lpt ai i;s)srxoim3nydom elicsa(  Draum nu1alen ieils sDrlnvsnu)alxnif oytfpDeauvi;t setrio nu1alenlneil( a2urxrpnt4teto o3iys aDul(vpnu4tleoioctodlptr nvol() 2uoimpoo1al n fviatf rururpot0ole mieiasfmDemn o u4teeoxo3iy1op e neslt) rxoxr nodam  mivias)artaxr ;t0oetnif3tydlaDra(mpnt4trtoio3ia1lpt auvi;()teuo(rpiydole mivtat a2rau  no1tpt if3iydfa ua( s t4trxoxo3tadom eli i s)sexo(r no4aleemfeias)aruau  ;o0apxoif3iad s2um(vont)altomocty1omD luvi;()seum(mpio1llenlfcs s) 2uaxmonu1aleoio3tyt a eln p;()aeerxf3ty1omDrli ilt0srxo(opoo4ap  mici (  Dtrump;u4aleoifeiad sDumn on(4 exoir3ia1fmDraneol(0sruoimpou4om nlnci s  2um( oou0tleoiietldlsDrmnvsn(0texrmf3tydlp elues;s sexr(mpny4oltn fvi t) Dumurpot4opxomf3taslaDel(mp u)trtnxr3iotlpDelies t0 exrir3iodlltnmfciat s2rmxro;o0altomoetad sDrlnvsn(4 lerxfciotfpt  ues;t)tetmxmpou4omt lnvt tfsDtrxrpot1ale iicildlmDeluvs;(0aeerxrcty1lmDean s t s2xoim3iu1ame lfcs s sDra(mp;u0opx mo3tytlmDra(mpnu0trtomociotoat  ivo;t)srxmxo3iodamt  fvta() rumxronu4apenioctysfs umn p (4 exoxo3iytlpte nes;t) 2xm(m3oy1oleemnvs s aDrrurono0aetnmo3iltfs rauvsn(0alxnif3oytlm  li s;t  rumiopoy4ol emfci (  Dumx pou0tlxomi3iys s2elumo;(4trxnxf3tytfaDeanvi;(0trxr(o3nu4lle lfciltfa2rmur ;t4teto octldls ranmp;t0altrxoctodoat lu s t0t2xmxr ny4olenmfetls aDrr(  ou1tpenmociydlm2em( p;t4 rxrir iydopte nvilt0 eurxrpno4amtnmfvtls srtm(root0altnmf3iyt m2ean s;(4trtrmrcta1lmD  ivslt tetm(opiydlp e nci tf rur(  ;u4tet mo3tyd mDemnvp (4artrxr3tydomDe neo;s)srxrxm3nydole  ncta()aDtaxrpnt4tpx io3ias sDrmnms t4artnxf tydfpD auesl() 2um(m3oo4omtnlfviat)srtm( poo4opeoifetys a rmumon(4aetomf ia1oa e u i s)s2toir3ny1lp elnet t a2raxmpnu4tpx  i3ildls2ra(mo t)tetrxf to1omteai o;(0texriopnu1olte ivil() rrax o;o1oetnmfeilt s2uan p;u)tetnir3tytomDr uvols tetr(rpiydlm n ncias)sDur(rono1tet ioeiyd sDem( pn()artoxo tadlaDelnes;s)s2xr(opnydlmtelnes s srtau pnu0tetoifetldlm2em(vo (0 lxrxrciydfmD auvo;s srto(rpoydam n icsas s2ua(m nt0tltnmieiatfaDumnvp;u4altnxocoatlmDeli s;s0 eur(m oudol emfetltfsrrmxr ot1oleniocild s ulnvp;t)arenmf3to1fptrlu o s) exoxopoudopeelneils)aDraxmonu0tltnmi3tls m rlumpn(4 leomo3ty1fpte ivi;t0trxmxr3iu1llee ivt (fa2ua(  oo0alxoii3iytlm uanvp;t4tlerio totoatr n sls0texoir3iu4ol nmivils sDuax p;o0optn octasla2rlumonu0tleoxf3oa1omD livi s) rurim iy1altemiciat)a2raxrpoo0tptnio3iyt mDul(vs;()artnxrcty1fa eanvo;(  ruo(opnu1aleemnesls)sDrrumpno1tltniieias sDrmnvsnu0 ltnxo iy1fpteauvs;s t2xrxo3nu4al  mfvsl( sDrmu  ;t1tlenii3iysfmDua(vo t4tltoxo io1laD aueolt)t2toim3ou4ale livias aDrrx  ou4olto feiltls el( o t4alxnmfciodoaDraivi;t teuo(m3nu1omtemfetlt  rrmuro;t1olt mfeilt m2rlnvs;t0arxnifcoadoatrlivi;t0 etrxopiy4lmtn ies t)arurur nt0tlxo oeiaslaDrmnvont4tetoxrctadfpDe uei t0 2xoxrpno4al elfvsat a2tm(mpou4opxnioctlsla2rln s;t0tltrmrcoy1oa e nes s trtm(o3oo1om   nvtas)sDtm(rpnu0tet mieiydla2eauvs;u) reomfctydlatr nes (  rxoxr3ny1alen ivsas)a2rr( oou1olx mo3tydfsDuaumpn()tltnxocoytlp  lnvs;s sexoxm3ou4ap  mfciatfs2tmx onu0tltoifeiytfm ranms;t)trerxo3tadfpteliesl()t2uoxr3ou4opt liet tfs2tr(mpou1opxn i3ild s umumsnt0 exoif3oatom  au ilt)srxo(m iy1opt  nci tf Drrum nt4tle ifeiltfa ra( sn()altnmf3oo1omt lnesls0trtmxr3iy4llenmnvtl()sDtm(rooo0tptnmfcils m2rau p;u0 ltomfcia1lp e i slt0 etm(o3nudapeelfci sfaDrmurpnu1opt  i3ildfs2rmnmo;t4 exrmo ty1fptraiei;t) rtrim ou4apt lnesl( srumuroou0oee if3tls aDuau sn(0alxomrciadlat  i olt texoxopou1altelncs (  2tm(moou1openiieiyd s rln sn()areoifciatfaD  iei t) rur(opny4ap elnvia()aDtr(  ;o4aexnmi3ilt s2ean pn()tlxrmr3tytlp  ai i s) etrxm3io1apeemneias s2ua(mp;u4tleo ieiatfm2umuvpnt)arxomo ta1fmtelnvsls) rtmim3oodlleelncsl(fsDtau poo1tpx ioctytfa2rmnvon() exrxo iy1oa  aueilt trtoim oy1ll elnctlt  Dtm(rpou4aeeoifciltlm2eanms;u4 lxrxf io1op eli i s0t2urim3iodoptemnct s)aDtmxr oo0oeeoifeiad sDua( on()aexnmoctotla eli il( trumim3oy4olte neslsfs2rmurpno4tlxn i3tyt s ulumont4 ltrif3iydfa eau o;()srur(r no4llenlfes t)aDtrx  ot0oleomf3tatlm uaumsnt4 eenxocoatlp  luei t s2trxo3oydame lncs (fs2umx ont1olx moeiyt mDrmn s u)alerxo oytfmDeluvs;t)s2tr(r3iodapeeliciat)s2ta(  nu4tltn fctytla eaumpn()aeenmo oa1faDrlnvs;( srum(r oo1amtelfvi tfartaum ;u0alto oeiyd s2uau snt0 ltoxo oadoa eln i (0 2trxr nudlmeemictas) Dtaurpnu4aee mociltfa2rl(vs t) ltomocoytfmDe i ols0sexmxm3oydamenmneiatf Dum(mo;u4alt ifciasfs el( p u)trxoxr3oydlmDeanvs t0 etoim iy4ol   nvi t) 2ua(r oo1oet ifeiydfa2rl(vo u)tltnmf3oy1lm raues;t0teto(m3oydlleelncil(fs2tau  nt1alto f3iysfs eanmp u) rtomo3oadlp  anei t) rxrxopoy4ap elivs (f rtmurono4apt mieiytfmDraump (4 eenmfcty1fate neils0 eumxm3oodap  mnctl(f rtrx o;o0aetniociltlsDel( s u4 rxomocootlateai s t0 rxmxmpiu1am nlfvs sfa2urxrpnu1aptnif3ildfsDum(msnu0arermf oy1fptrai sls)trxmir3oy1aptnmnesa( srum(  ou0opxomi3iadlmDul(vs;(0 rxnxrcootlmDrlivi (0setrxr3oy1lptn fctl( a2rmxr ;u4tlenmieiydfmDrmnvon()tetrircoadlpD  n s ( setoxr3no4openmicils)aDrmxrp;u0teeo oetas s2rmu ont0trxoxr3to1om elu ilt)srxoiopnudlp  lfvtas s2tauro;o4tlx moeiytlm uaums t0tlxrmo3tydfpt anvs s)tetoxm nydllenlnvilsfaruaxrpou1apt moeiasfs2rlu o u0altrxrcto1lpD li s t) rxrio io4llt  fcils) rtaxroot1tetnmi3ilslm ulu s t4tltnmoctytfaDr uvol( seurir3nu4ol e fet (faDum(r ot0aetn o3iysfa2ul(mo ()trerxr3oo1fp  au o s  2toxm no1ll nmfeslt  2rrx  ;u0aet  f3tyd m2rmu p;(4 eerifciy1fa eauei s trum(mpno1ame lfes sfaDuaxront0aptnmfeiysfsDuln p;u)areoif3iytlp raneils)setrxr no4lpt  ies s a2rauroou1oltnmo3iydfm em(vs u0 ltrxr3iatfptr nvilt0t2to(mpoo4apt lnvils a2raxrpnu1aexoiieiad m2eau p ()trtnmf3oadlaDr i sls trur(rpnu1lpe lneil(fsrum(mooo0oleo octasfm2ra(vpnu4texnxo io1fp rlnvols)srumxm ny1omeelfcsa(  Duaurono0aetnmfctydfaDumu p;t0aetomfciotomDraueolt) rumxr3iu4apen fcsat) rtrur nt4teeoiiciytfa ua(mpnu)treoxoctadoa   ues s0setoimpnodom elivt (fsrrmuro;t1ale  ociatfs ulumo;t0alxnir3oodfaD ln olt)t2urxopoydom e fcias artmxmp;t1aee  iciyslaDumnvonu4 eeoiocto1om  aieils)srxm(o3oo4ll e ivi s)srtm(mpoo4tleomietlsfsDrmuvp u4teerio3ta1lpt livils)s2trirpiy1ol nmfvta()sDtaur ;t4tpe  feiysfmDelnmp;u4 lenir ia1lmtelivsl()s2tr(m3oy1lle  ncslt arumu o;u1opto oetat aDelumo;t)alxnir3todfa   neil(0 etrir ny4ol eliesas)arrr(mo;t4apt iieiys m2ua(vpnu4arxnxr oo1fmD lues;t)s2urxr io1lpeelfctl()aDta(rono1aexoioeilslmDran o;(4tltrxf3totlat  ivils0 2urxo3oy4om   ictl(fsrtaxr ;t1tptnif3tatls2ul(mp;t) eenir totoptr nvi;t) 2toxr oudom  lncslsf rur(r no4aptnii3ilsfsDuauvs;(0aeermo io1fptr ivs ()s2toxo oydop e fetlt aDrmx ont1apeo i3iltlm2rl(mpn(0altrif3ia1lmD aies s0 ruoirpoodlmtn icsls a2uaxm ou1olto fctlt a elu o u0arxrxr3oo1opDrau sls t2umxm3oydom n ictatf Dtrumonu0aeeo iciad m2rl(vp (4artomr oatfatraues () exrxr ou1omt lneslt)aDur( ooo1oexo feild sDrau p (0alxrifcoodlptr ueil() exm(o nodope  ies s)aDumxmpou1oeeo f3tlslm emums t0 eerxocoytoaDrlu s s0trtoxm ou4ole lictasf 2umxmpno4altomociadfa umuvo u) rxoio3ia1fmDeluvilt0 etmirpiodll n nesasfaDra(mpou4tleomieias s ea( p u)tleoifcoodopDeli ol( trtmio iy1omtelnei t srurxmont0aeenmictas m2um(vpnt0 etoxo3tytlp r ivols)srtrir3io1lpeemneil()s2uaur ;u0aexnmictadfm ulnvo;t)aleoxr3tytfat lues;() rtm(o io1lmt  icias  2rm(mont4aexoifciysfaDelnmo;u0alxrir3tydlmDeaneo ( seuoxm3oudam nlics s  2trumo;o4oleomi3iyt a2umn o t4 renxr oodfaDrluvslt truriopnu1op  mfctat artaxm no1olen i3iasla2rm( ont)tlxnxf3iatlm rli sls0t2umio3iu4oltn ictls)aDumurpoo4tpxnifeiltfs2eaumo;(4 eerioctydoatean ols)
\ No newline at end of file
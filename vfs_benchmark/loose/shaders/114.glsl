@@ -0,0 +1 @@
+nes;( srtm(opio1ame mfci sfsrrau  no0tetnmo3iydlm2uan s u4 rtrif3iatopteau i;t)setrir iudopt  fcslt) 2ur(mp;o0tlxnmoetlt aDem( snu)tlxnmo3iotomt aneo;(0s2tmio3oudamt mnci ()aDrrxr ot0aexoifciydfs um(vs;u4arxoxfctotoaD auvi;s0 rtr(r3nodalt mnvtltfaDrmumpno1tlxomiciydlsDrlums;t)trtriocta1faD lueo;s0sexoxo ou1lmtelfesa(f rua(ro;u1tpxn ietls aDumn p t)alxnmrcoa1lpDrauvo;()t2ur(m3iy4omenmfei (f Dum(ronu0tpe iictysfm2rl(mp;u) etnmfcoy1fp  anes;t s2xo(opoo1aptnmics () 2urxronu0opt io3tysfsDulumo u4artoxr todomtelueo;(  2uoxrpnu1ope mivsa()aDraxmp;o1opt  iciltfa eluvp t4aexrmo oy1fpt aieol( s2trio ny4aptelieiasfaDtmxr nu4texomociyt sDumnmont) rtoxf3oadoaD auvols)trxm(o3ou1om  livia(f 2rrurpnt1olx  ietytfaDuanmo u4 etrxr3oa1fa   ueo;s0srtrirpoudllee ncs s  rtrur ;u1aptniietlsfa2rmu s;u)treoxfcootfm r u o;s  etoxm3no4lp nlfvt t a2tmx o;t4apto iciasla2elnvp;u0 lxrio3oytom eau s s0teto(mpno1openlnvia()srtauro;t1tpe moeiyd sDeln ont0aleoxf iotfptraneols0trumxr3nydllte ici (f rrmu pot4ape ifetadfaDulnmsnu4 lenxo3iydlptr ueilt)s2tmxm oo1ol  mfeil(farrauronu4aex  ociad m2eauvs;t0aexnmr tadomDrlnvsl()srtm(o oo1amt  fesas  2umump;t1tpto feiydfs2uaumo;u0aetrxf3ty1fm rauei;(0sexm(o nudamt lnvta( arrmxroou1tltnmfctls a2rmu s (4 rtoircia1fpte u i;t t2toxmpnodom  lnvsl(f 2tmxmono0opx mociydfmDeanms;u) etnxocta1fpDeau o;(0 exrxr3nodalee ncs (f 2tax ono4tee mieiadfa em( o u) rxoirciy1lp rlieo;s)teuoxo oy4llen nvi s)s2rau o;u0tet io3ilsfmDea( o;u4 rtrxo oodomD  ieilt texmxr ny4ap  lfvta( a2rmx pnt1alxnmf3ils aDeaums t)trtrif3ta1laDrlivi ()t2uoxr oy1lp n icil(faDra(mo;o1olenif3iat m2ul(vsn()altnmrciytfaDe n o;t  2umio io4lmt mncilt)aDrm(r nu1olx ifcildfsDua(msnt0 rtrmrcoo1fat li i;t)sexrio nydomeelnetas arrmxrpoo4tlt  oetltlsDumu on(0tltnxo tatfm  ai i;t)seumiopnudlpeelfct sfs2uaxmoou1openioctadla rlnmp;() reoircoy1laDelnei t) rxmxrpou4alen iviasf Drmx  no1oeeomoctasls emu p t4aetoxfciadfmtelivi;t)s2xoir oo4oleelfet ()sDtaumo;o4aexn ieiltlaDranmp (0 ltnirciydoate n s;t0 rxo(m ny1altn ictatfs2uru o;t4tptnii3tatls umu o t4teermo3oo1latelues;t0s2xmio iy4oltnmietl(fa2ur(m nu4optn f3iysfs2ea( o;u)tleoxf3tadlm   n i;s)t2tmio3nodop nlfvtas)s2rm(rono0oet iieiadla rmnmon(0texnxrctotlmtrau o s trumio ny1lltn ivi (fsrtm( pot0aeto feiatfm umnvs;t4alerxo ootop eaues;t srtrim oy1ole  ivta(  2trumoou1teeomi3iasfa umu pn(4teermrcootlp rlueo ()trxmiopiy4amen ieilsfsrrau pno4opxoio3ilsfm rl( sn()trerxfciydfm e neo t0srtrimpiy1al emivs sf 2tmxr ot0oeeo ietatla rln o;t)tltoio3iy1lmtrln ils0setoim3oy4omen ivi tf rrm(r oo0tltomf3iyslmDul(mpnt)aeenxf iadfpD  u i t) 2toirpoydoptnmicia(faDumurpoo0opto feiytfsDrmn p;t)aetrxo3tydfpDelu o t)t2xmxo iydlp emncilt)a2tmxrpot0aexo f3iysls el( s (0teeoio3oatop   nesl( s2toxo3io4olee fvtl()srurxro;o1alt  ocildla2rl( s;u4trerxr3tytfp ran s s) 2xoim3ny4lmenmfvtatf 2ur( pno4tlt mieiadls ua(vp ()artnmf3oo1opDr uvol(  2umxm ou1aptnliei s) rrmum ;t1tetnmoeiyt m umnmp t) rermfciotlpt au s;(0trtrim nydam emnctlsfartr(  nu0oex ioctysfs rm( o u0 rxnmfcoydfmD lu il(0srxmio3oo4lpte ncil(f ruaxmp;u4tlenifeiltfs uanvp (0arxrmf oo1opDelnesls s2xoxrpnudaltnmies ()aDrr(mpnu1tpeoifctltfs2ulumpnu4aetnmf iatlpte nei (0 eumxo iydlm nmnciat sDuaum ou0ope micils s2em(vp;u0arxnmf iadfa r nes s)srtmim oydlpenmfvtas) Dtauro;o4olxo f3iadla2uanmpn(4tlermrctadlp r uei;( s2um(opno1omeelfvtls)a2ra( pnt4alx  o3iydlsDemnmpnu4aetoif3iy1fpDrlueilt0s2ur(o3iu4ale lnvtls)aDuax ont1oetomociys s2ua(vsnt)teenif oo1fate i olt)srxr(rpoydaptnlnvi ( s2ra(  ;o4opt  ietltfm2rlnvs;(4artomrctodfptean ils0 2xrio3oodlpe liesas)srur(m ;o4aptnifciadls eauvs;(4aeenmo oodlmtrai o;s sexmim3nydapt mfes ( arraxr no0ope  ictatfs umnmon(4tetrmo3tatopDe uei;t sexmxopoy4ap  livta(  2raurp;t4tee ifctls mDrm(mo;u)tleoio3oy1fat  uvols0sexo(m io1alt lfei t)sDta(ro;u4alx  octasfmDem(vp;(0artrmo iatfaD aivil()sexo(m3oo1ap  lieta() 2um(rono4altnioeiytfm2rl(vsnt0arxrmr iy1omteaneolt trxo(r ou1lmtemnet t arraump;u1tpto fetatls2ra(mo u4tleoircia1fpDraivsls srumim3oudalee iet tfsDrau p;u0opeomoeils m eanvp t4trtoxo3oytlaDeauei;( s2urxopoydap n fvs () Dra(mpou4tetnif3tadfm2ulnvs;()teenxr3iydlaDrlu slt) etriopio4lptnlivils sDtm(mo;t4tet  i3taslmDum(ms (4 rxoxr iytfp rln i;()srum(mpiydolenmnet t) rum( o;u4opx mieiad a2uanmp;()tlxomr3iy1oaD li s ( t2ur(r no1om n ivil()artaum oo4apto fciatlm2rmu sn(4 rxrmf3oydfmDraiei;s) etrxo3oy1omt  nvtl(  2uau ono4oetomo3iyt sDul( pn() ltrioctodoaD  ivi;(0srtr(o oodlp elfctltf 2urxmo;t4optnmoeiadfaDranmsnt4 rxomo ty1fptr ueils t2uo(r3nudam elfvtl(f ruau  ;t0ole mi3iydlm rl(mo;u0areomf ia1opDelnvs s  exr(m3nudoltnlfct (fsDur( o;u0oleoioeilsfs2em(mpnu0tetnxociadfmDrlues;()trtr(r3io4olt lictas)s2rau  nu0oleoifeiasls2rmnmo t) ltoir oy1omDrln o s  rxrir3oudalt  nvsl(faDta( oot4aexn fetasfs2eln sn(4 rtoxr oydlmtr ieol(0seumirpno1lm  mnvi s) 2rmuront0olxo fciatlaDul(msnu)tlerxoctotfatrauvsl()seum(o nydal nlfvilt  Dtaurpnu4aetn oeiydfaDemnvs u0teenirciodfa   ivi;t trxoxopiy4ap n fvt s  rururoot1tlenmfciyt m2umnmp (4 renif oadfpteanvi t0tetoimpiy1omte nctl(  rtr(mo;u0tlxn fcias m2rluvs u)tltnio3oytlmt lnei ()s2xm(mpio1opt mnvi ( a2ra(rpoo4olxo i3tad mDemump u4artrir3oadopD  uvolt t2tm(rpoo1amee ietasf rtmur nu4tpt io3iatls ulumpnu0teerif3iy1lmD  nvols  2trxm3oudlpe  fvil(fsDumurpnu4tpxoiiciyslm2uau p;(0artoxr3ty1laD  uvo s0t2toir3ny1ape  neta(f Duau pnt0tptoiiciasfa2em(mont4 leoxo iytfmtr ivo;t0t2ur(r oy1omtelncsas) Duaur no4oet iocilsfa2uan pnt4 reoxr3iytlpt lu o t t2urir3oo1aptemfeilt  ruaumpou4tltnioctysls2rl( ont4 lenio3oytfmtrlneo s)trxoio ou1lpee net t)a2rmxmp;o4ape if3tlt aDemn p () rtnmfcoa1laDeli ols0tetmim3no4lltelfvtas sDrmu pot1opt ii3iydfm elnvsn(0texriociy1oate nvilt t2to(o ny1om elfvtas)a2rrurp;u1oltoio3iytlm2rmu p t)trtrmrciy1opDe ivi;()trxoimpoy1lp  lncilsfs2rrur ;o4tpxnifetys sDemu o () etnmr3oodlatelies t)srtoxm3nodome mivilsf Dum(m no1olx iictlslm2ulnvont4 rxnmrciatoaD  u i s0 etoimpiu4oltelnct tf Dtau p;u1tlto f3taslmDem( pnu0altrio3iy1fat  ueils tetr(o ny4al e fei ( aDtaurooo0tltn ieildlm2ranvs;u)altnxf3ootlmte i o;s trurxm3nydoptnlicta(  Drax oot0opto i3iadfsDuauvsnt4texnmo3oodfa   nvs s)s2tr(r iydaltelfct t sDtaurono0opxn f3iasfm rl(vo;t)altnmo3oo1oateln s;s0srxoxmpoy1al  lfeia()a2ururpno1alt ioeiatfa elums u4tetrio ia1lmte neils0trtrxmpnodlp  mnetat)a2raxm nt4ope mi3tydfaDem(vsn(4aeeoircoo1omDrlueo;t) rxoxo oydamtnlfciltfsDrru ooo4opxo ieiad a2ranvsnu0aeerxfciotoat  ivi t srxr(m3oodlpe  neia(faDuaxrp;o0tetn o3iasls2eluvpn()arerir oodoa   u i;t srxmim3ou4alenmivt tf Duaxroot4aexn f3ias s2el(mp t) lxoxf3totla e u o s trto(m iu4amt mfeils aDrmxr nt0aet ifetadlmDemu s;u4artnmociytfpDr neilt  etrxrpoo1al  mivias aDuaxm no4tlenmoeiyd aDuluvs t4tetoxocoadoatr i slt  eum(o oydop  mnvtls s2ua( o;t0aetoiociltfmDua(ms u4alxnircoo1oa  anvsl()sruoirpou1ape  netls) 2trurp;t1opto ieiaslaDuaumpn()artoxr io1lmDr ues;s0trxrxo3oudom  mfcsls) rrr(mp;t4aex mfeiysfa umu s u)teenxfcootlaD anvo s)s2xoxopoy4lmeelfetat  2urxrpot1oet mfetlsfs2rluvon(4 lenifctatfmDeaueslt)t2to(m io1ape micsl() ruaxm no0tptn oeiltfm rlu o (0 rtomrctytoaDeai i s)teumxopno1lpen nesa( aDurxmp;u1olxnmoetyd m2eauvsnu)trerxoctatfaDr ieo;s0srtrxo iu1lp  lnesa(  2uaxr nt0tptnifetatlaDulu p t0 ltrio iadom r ieo () 2xoio3nodapenmfviat  2umu pno4teeomf3ils m ran s u4 renif iydlpD aueilt  ruoxr3oudole lfes () Dra(m no4texomfetyd s2ua(vsn(0arxrxr3tydfmtelnvsls0trumio3nu4apenmfvs tfartr(rpoo1aeenioeilt m ua(mp;(0teeoxfcto1la  anvi () exmxo3io1am e fctlt)srrmu o;t1tee iieiadfsDrmnmont0 renxrcoadlptrlues;t t2urir3nu4amt lics t  Dum(r ;u0tpxn ieiltfaDea( s;t4aeermr3oo1fmtrlnvi;(0trtrxmpiy1open icsasf rtau  oo0alenifeiadlm2umnmo;t)texoxfctadoat an i t0srtrxopiu4om elnet s  2tru pnu4aee  f3iadlsDean s;(4altomocoo1oaDelieo;s srxrxrpny4ol e ivilsf Duau o;t4ape mocildls rlnms u4 rxoio to1laD au s;()s2tr(opnodalte fei s)a2rmu  ;t4tetomf3tytfs rm( s (4tltoxrctodomDe ivo;t texmxr3io1opt lictat artmxr ot1aee moeils m2ulnmpnt0 ltomr3tadlaDraivo;(  etoxm3nodop nmiesltf Dumur oo0altnioctlt s2uluvo;t) lxnxfciy1fm  anvs s0srto(opio4ap nmiesat) Dtm(monu4oexn i3iltlaDeanmo;u)trxomo3ta1om elies ( srtrim io4om elfetls)aDtm(ro;o4oeeoiietys a rau pn() reomr iytfpD  nvo (0texoiopiodopenmnviatf 2rr(mpoo0opt  ietasfa2rl(vpnu0 rxoif oodlaDe ivo;t) etoxr io4lpeemncsatfa2rmur ;o0optomf3tatfs em( o;t0 exrxf3iytlmDe i i;t) rxmxr3no4omtemiviat) Drrurp;o0opt ifeiasfs2ra(mp t4aeenxo3iotopteai o;s0teuo(o3oy4amtn fetatf Dumxroot1olxoii3ilslm2um( pn(4 exrio iodfmtranei ( s2tmim3ou4omtnlnvtat)a2trumpoo0tptniicild mDuaumpn(4arenir oo1laD aieo;s0setoxm3oydomte nvt (fsrurxrp;u4aee mfetatlm ra(von(4trtrxo todfmD lneo;t0setrirpnodalenmfvtas  Duaurp;o4tpt  fcilt m2ra( sn(0texrif3ia1laDranei;t t2trirpoodapee netas)srtmxr ot0aeenmi3tlsls2rl(ms;() exnmr3iodomD  ivo;s0s2urxr iy4ol e nvt s) Dur(r ou4apxnii3iad a2ulnvs () ltoif3iodlm e u i;s) rtmirpny1ol n ieslt aruau pot1tee mf3iltls emnms;()altoif tadla eai s;s)setoxm3oy1am nlfvi ()arumurpnt0oeeomi3iasfm eaump (0aexoiocoatoa  auvo;()trto(r iu1alt mnvtat)sruaumo;o1aet iietytlsDelnvsn(4tltoio3to1omteaivils0trumio3io4ap elneiat srtrumo;t1oleomfetls s2rmn on(4 lxoxociodfatrlneo s)s2tmir3ny1ll nmiei tf Drru  ;t0texomi3ildfsDea( o;(0 etrmr iatfa e ues s) rumxm ny4llt lnetls)a2rmumooo0apxo f3iysfa eau s;(0aeeomo3iydlpDeau o;t0trxr(opoy1al emici s) Drau  ;o0olenioetyd a rmnms u4tltrxo3tatfpte n olt0setr(m nudopte nes s arrrxro;u1tltniieiasfa2uau s ()aexrir3iytoa elu olt0 etm(r3oudole lncs t)artrxrp;o4tleo fciyt aDulu o u0 rxrmr ty1oa   n olt truoxo iudapee nvia(f 2uaxmpou1oetoifetadlmDul(vp;(0tlxrmrciatomDr n sl(0t2urxr3oodllenliet s  Drrxr nt1tlxo fcils s2umnvo t) exomr3to1omDraneolt) 2xr(o iy1lle mfcslt) 2umu pot1openifciyd m2emu pn(0aeeoxr to1oaDeaiei;()s2tr(m3nydlp emfviatf 2ur(mont0olxn feiydfa rmn snt0trxnmf3oa1lmt  nes;s0 2xrxopiydol nlnvias aDtrxm nu4oeto iciadlaDuan onu4alxnio ta1oate ivi t s2xo(o iu4olee fvsa( s2trxmono0teenmfciasls rl(mpnt4tltomo tytlat li s;s) eurxopiodom  mnesasf Duaump;o1opt  ociytls uauvpnu)aetrxo oa1op  livi ()seto(m iu1am e iei tfaDtm(mp;o1aptoii3ildla rmumo t0artoirctadoa e i slt trumxo nu4al emfcias) rrm(mooo1optn oeiltlsDem(mp t0artrxf3iatlaDelu i;s trxm(m ou4ll  lncsasf Drr( pno4opx  i3tld s rln p () lxoir ta1oatrln o;t texrxr3oodomt lfvt s)s2tmxr ot4tex mfeiyd a rmu o u0altomocoa1opDraies t)setr(opoydam n fvs ( srururp;t1aeenif3ildla2el(vp u)tlxoio tydfp  ai slt0texriopoydlleemneilsfsDurumpou0teeomfciltlm umnmo u4 leriocoodfaDe ieolt) rtoim oo1olte fcs s  Durum ot4tetn i3tltls rlnvs;u)alxomo3iadfptrlivi;s) rxrxr oodom n fct s) 2rr(mo;u1oetomo3iltlsDum(vonu) leomr3iodfm rai i t  rtmiopio4ol  mfetl( sDrrumono0ale mictadfa2rlnmont0arenircoa1optelues;( sexoim3iy4lme mfvt tf 2um(r no0apx iieiadlsDrmums t4artoif3tadfmD aueo;()t2trir ou4al elfvt t) Dtrum ot0olt  oeiysfa2ul( s;u4tlxoir3tydoat aivil(0sruoxm3oo1apt miet () ruaurpnu4oet  f3iatfs el(ms u4trxnmr ta1late nvs s t2xoimpiudaltemncia( artax onu0tpxo o3iat m2rl( p;(4trerirciotomtraivi s)setrxmpoo4omeelnesas) 2umxroou1tpxo fctlsfs2um(msnt0tlxoircoodfpt  u o;( trtrim3ny1ll nmicsls  Dum( o;u4tpenmieiytlm emuvp;(0teenmo oy1lpt  i i;(  exo(m3nydomenlfvtasfsDraump;u1olt ii3tydla2rl(mo (4teenir3tatoat  u ol( seumxo3iudoleemietltf Drm(rpou1aetnioctldlmDeanmo;t) exoio3iotop  lueolt0t2umxopnodom emivta(  Dumxrpot0tpto ietyt m umumo (0altnmr3oatfmtrlnvs (0 exoio3oy1lp nmfctlt)arur( oou1ole  feild s uanvo u0trxrirciytopt lu s t)srtm(m3io1lp n nciasfarumu oou0oex ioctld a2ua(vs (0texnxr iydlmDean o t0 2urio nydlmte fctls sDra( pou1alxomietlt m emn o;()tltoir3oo1fpDelues ()t2uoxr3ny1lmt lnvslt)aDrrurpoo4aleo o3iytfmDemn p t0 lxnio iatlm rluvs (0texmiopno4amt livils  2trx  ;o4texomfeils m2elumpnt)artrxf3oatfp  lnvo ( sexrxm ny1op  mnct () rtr(rpot4aet mf3iydfa2emumonu) rtnif oodoa elnvs t  rumio3ny4ap elivslt)sDum(ro;u0tetomfcild s ra( pnt)aetoxf3totoa  aneo s sexoirpnu4lptnmfet tf 2tau  ;u4alto o3tydlm2ea( snt) rxomo3oydfmt anvi;s0 rxoir oodamte fciasfa2tmuroot4tptoifetas sDea( pnu)aeeomr3io1oaDraueo t)s2xm(r3nudol elnvi ( arumxro;u4olt ifciatfsDem( o (4tetnmr3oydfpDr ieo t  rtmir3no4ame mfvi t  2rax p;u0opt  ociad s rmnms t)aetrmr iytfptraivils)s2uoxr3ny4op   ncia( artm( pnu0alx iociadfa2rmnmonu) eenmr tydom   neils) exrir3nudop emicias  ruaxrpoo4tlxo ocildfmDem(mont0artomf3oatfaDraivolt)t2trxm3iodap n icsasfs2rmx  ;o4olxnmf3tydlm em( o;u4 lxrxo iotoptr ivils)trxrim3nu4open ieils)srtrxmono1olxn fcild a rl( s t4trtrir oytlmDr ieslt0s2umio3iu4am e fvsat  2umumpnt0aex ifeiytlsDul(mo;u0alenifcoydfp   u s s seumxopnodale lnvsl(faDrm(rp;u1ale ii3ildlaDum(ms;u) renmrcoodlmDelu o;() 2uoio3ny1lmtn nvsasfaruaxrp;o0alxo o3ilsla2ua( s;(0artoxrctodlat ln sls0 etrxo3no4lmt lnes t)sDraur ot4aptn ieiyt s emn o;t4alenio3tydom e ivils sexm(mpiy1lmt mfcslsfa2umx  nu0apeoiietasfa ua(mp (4teenmr tydoa eaivo () 2xoxr oo1omen fvta() rrmu p;t1opxoiieild a2uanvsn(0aexnmfciy1omDelies;t)trum(r io4om nmfcta(f Dtmur ;u4tlx mi3iatlmDranvs (0aleoxf oydoaD auvo;( trtoxr3oydap nlieslsfaDtmxr ;o4aet ii3tytlm2ulu on(4tltrxr iytoat  ivs;()t2xriopnudlmenmfct ( srraxmont0tlxnmoeiys sDra(vs;u0 eerircia1fm ranvs;t0 2umiopiy4ope  fvtas  2uru onu0oex  ietldlmDrmn on(4 leomo oytfaD au s (0trto(m no1altn ictl(faDua(rpno1apxomi3iadls umumont) rxnir oodfptrai ols0trtoxr3nodolte ici s arum(mp;o4aet  o3tys mDrlu o t) rtrif3totopDr i i t0 rtmir3ou1lm nlfciasfarrrxrpou1altoii3iad a elnms;u4artoxf3totlpDraieolt teto(m oo4omte fet ( arrmumpou1tpxnioctydla2rlu s u4 exrif3iodoptrlieol(  2tmxm3oy1lmeemicia()arum(ro;u0opeoioeiltfm rl(msn(4alxnxfcto1lat auei;( trtoxmpio4amtnmfvtlsfarumumpnt1tlxn f3iasls ul(ms t) lenmo3oadlaDranes;s  rurxrpoo4apt  ncias) 2tau pno0opxnif3iyslmDrauvon() ltoxrcoytomtraivils sruoxm3oy1ol nmieslsfarur(m nu4aeenmi3tls m2umnvp;t) rtnir3todfpD an o;t0s2umxm ou4omt lietl(fa2ururo;t1ole iociadfa emn onu4 lxnmrciotlm   nvi;t) eurxrpoo1ome  fvs tfsrurx pnu0tlt  i3iatfa ranvo;u0tltrxo tytomtraivi (0 exmxmpiodlptemicsa( a2umxmp;u1tle io3ilt s uaump () lxnio iadomt lies;t0 2um(r3nu4lltemnetatfaDrrur ot1oetniociadfsDumnvo;u)alxrioctydlaDraivo;t  exrim3iu4om n netltf Drru o;t0oltomociydlmDrl(ms t4 eenio tatlpD auvo (0seuoirpiu4ap nmnvtls)a2uaxrp;o1texo ociltls2rlu p ()aexnio tydfmD ln ilt)srtoxopiodoptelivsls  rumur ot4aexomoetysla ulnvs u4trtrio iatlp eaiei (0 etr(r3oo4lptemfvs t s2uaxro;o1apxo fciysfs el(mp;u4trtomrcoo1oatelu olt s2urxm3nu4lp  mics (farua(ronu4tlx  ietatls2umnmsnt)treoxr3oatlpt  i s t0 rtm(r3nudopt miei sf rur( oou0aeenmfciytls rlu s;u4 eenmfcty1fatranvol(0seumio3no1alen ivsl()aDta(  oo0texo feiyd m uluvp t0 rxrmo oy1op r nes;t t2uoxo3oy4lpteliesls)arra( onu0apxomi3ias s2ulump (0 exoio3oodla rau o;(0t2toio3nudllt mncs s)s2raxro;o4oexnifciydfs2ul(vpnu4trermo iy1fmteai s;t0 rurxo3iy1omtnmfvsls)arrrx pno0open oetytfa2rlnmp;u)alxnmociatomtelivslt  ruo(m3ou1al  mfcsls)arraumooo4alxo i3iyt a2rmuvs;u)tetoio iadomtraueol()s2xrir3oydome mnvs sfs2uru p;u1aptn oeiytlm2rlnmo u0aeenmo oo1lpteli o s0 rtr(opnu1apt  nvias)aDrm(r ;o1tpx mictytlaDea( p;t0trxrif iydoa  au s s0t2umiopiy1lm nmicsatf Drm( pno0apt mfciys mDuluvp;u4texnif3oydlpt aueil(0trum(opoy1al  lfeiat)arrm(  ou0opx moetydlm2ul(vs u) rtniocoytomD  nvilt teuoxopnydapeelnvi (  rrax  nu4aeeo i3iadlmDuauvp;u0 rxomf3oy1fm rlnvo;()trxm(rpiodal  mfcia( s2rrx pno4tpe iicilt s2um(mo;u)arerxo ootoa rli ils)tetoxo3oodam nmnvt tfs2ra(ronu1oex mfetyt s2rlums (4artnxrcoo1oaDeaivol( t2ur(o oo4lptemnvilt) 2tmur ou4aexomieild mDrmn on(4 ltrir ty1fp e n i t)sexr(opiu4ameelivi (fsDtmumpnu4oltn feiatfm ea(mont0 etoxf iotoa e ueilt tetmxo io1om  lfet () ruax  ou1opxn i3iysfm ulnvo u4altoxr3iydop rlnei s s2xo(m3iu1olen ivia(f 2uaurpnt0oee miciysla rm(vpnu)treoiociotlmtranvo;t0teumimpny1omtn icias srrrxr ;u0apt ifctltfa2ua( snu0 etnxo3iadfaD auvi;( sexr(rpnodome mieilt  Dur(r ;t4oetnmicilsfm2rmn p;u4altoxrciy1fm rau ils0t2um(mpiy1ol nmfvslsfsruaxrpoo4oet  ictaslm2elnvont4 rerif todomD lnei;()t2xrimpno1lmt livsas)sDur(mono0openifciytfaDemuvsnt4 ltoxr iytomt aueols)tetoxmpnydopeemnvt s  Dtrur no1opxo ociydls elu o u)tlermocoadfmt  nvo;t trtmir iydole micta(fa2rr(mpoo0aet moeiatls2rln p (0altoxo oadfmDr i i;s)truoio io1omtelfeslt  2rr(m ;o0teen oeiasfs2ua(vsnu)tltoxr3ootopte uesls)trxrxo oydomenlfvta(fsruaumont1aexnmo3iyd m2rluvo;()tlerirciatla rauvolt0t2xoiopny4op   fviatfartmxr ot4texoio3ild s emn s;(0treomo3ootla e ivs;( seurxrpiy4apt  fcslt a2uax  oo1tpeniicils sDuan p t)trtoxrctydlm r nvil( sexo(r3nu1lpe mieia( s2tm(mpou1opeomfetys m2umu o;(0tltnirctytomDe ivi;s0 rxm(mpio1lltemnet s)sDum(rono4alx ifeilt m elu o;u4alxoioctydfa rlivols)seumio3iy1lmee nvs ()s2rau p;o4oeto o3tatls2ea(vo u) rxnxo3oytfmte uesls sexrimpiy1open nvsat  rurum nu1oeeo fctls aDumu s t4alxnifcoy1late n s () rtoir no4opte nvtlt  Dtaxr no4aex  ieilslm2rlnmo (0 etrxo3tadfa raueo s s2umxr iydll e iesat s2ur( onu1ape  fetad mDua(mp (4 etomf tydla rlnesls0 eto(mpno4om n ivil( s2tmumoou4apx mfciaslm2ra(mo;u0tltrif3iydfmDrluvslt trumxr3no4amtn ies ()a2urur ou4aex mi3iyd sDumu o (4 reoxo3ty1fmDrln sl(0 2xmio iu1apen nvias)srum( p;u1tlxn oetydfm2umu p t4tltoxoctydoa  lnvils) exr(o3iydlmt  ivsls s2tmxr ;o4tltnmoeiadfm2ulnvo;u) eenxrcoytlm e n ilt0srtmiopiydll   ncta()sDum( pnt1opxoioeiat a2umnvpn(0arermf totoaD  nesls0sruoir3iu4am nlnvsatf rrmurpnt1oex  fcild m rm(von(0tlxrir3ia1oatr uvo;t0 2xoio3iu4ape mfvil(fsruaurpnt4opeoii3ils a uln pnu) exnir iatfat lieo;t)teum(m3iu1lpe lfvias  2ua(rooo0olen oeild m rmnvonu0 lxrir oydop r ieolt0t2urimpoudlpeemnct ( s2rruro;u4olxoioeiadfmDum(vp u0tlxoxocoodfm  luvslt srtrxo oo1lmenlncsat)artrxro;t4tptn f3tatfmDulnvs u0tlenxr3tydoaD anvs;t0sexrir3iy4amen nvs t  rur(rpou1tpe  ietltls rmuvs;u0aeenio ootomDrauvi ()setoirpoy4al nmnvia() rum(mp;u4tpeomfetlsfmDra(mpnu4 rxrmf3oo1omDrlivi;s0t2trim3ny1apenmict tfsrum(r nu1ope  fciysfs rlu p;(4 rxrmf3iadfmt  uei;()s2tr(m oo4ap e ietl()s2ta(moot1tetnioeils a2rlnvs;u4tleoirctodoatraivsl(  exmim nu4ale lfvils) Dtmx  nt4ale mo3iatlsDra(vpnt4tlxnmfcoa1fpt lnvo s)trxrim3iudamee fct ()aDraxm ou0open oetysfm2umu snu)aeeoircoodlm   ivil(  rxo(r oudomte fvilsfarur(r ;t0opx ifeild a uau s;u0alxomr3oodoa  lnvslt)teum(o3iu1ome lfvi s arur(r ;t1tpt ii3tlt sDraumonu0arxoiociotomt ai s;s)seuriopiu1alee feslt  2urx p;u4tpto octadfsDrm( pnt4trtnxr3totoatranei s) 2xo(r3nu4llen fvs ( s2taurono0opxo i3iytfmDrmuvp;t)tlxrio3io1om e ues s0s2xrxrpoy1apte ncs tfa2um(rooo1aptomi3tatfm2rm(vo u)tetomo3oy1laDraiei (0t2xrio ny1lmeemieil(fartru p;o4tetomf3ildfa2ea(vs;(4trtoif3iodfp rli s;s0 rtmxrpou1ope  nes t arrmu  ;t4optnmoetlsfsDemn ont4teenir iodlpDeaivo () rumim iu1lm elnct ( aDtm(mp;t1oetnmfeiadls2eluvpnu)aexnmoctytom e ieslt  2to(r3oo1alt  fcta(  Dum( oou4ope ifeiadfs umnmp (0 exoirctydfaDelnvo;t)t2trim iu1ameemncs ( s2tr(ronu0aet iiciysfa rl(vp (0arxoxf iytfm  lu i;s sruoir3io1al  mictas  rtaumo;t0aetoiiciasla umump;(0arxomf3ty1fm rln s t0s2xmir oo4om nmics tf Dtmxm ot1olx mf3ilslmDul( o u0texrxo totfm e uvo;t)t2xr(r ny1amtnlfct () rrrur nt0tpx iociys s2elnmsnt0 lxoifciodlmDr nvsls)truoxm3nydomtn ivi sfa2raur no0tetn o3tltfs ua(vp;u4texoxr3iytoa r nvs;(0s2ur(rpnu1ameelncil(  rtmu  nt0oeto feiytfa2ul(vs u) leoxf iadfa r u s (0s2trimpoo1al nmnci t aDrmx ono0opxomo3tldfsDemnmsnu) rtomf tytfpD aieolt0srtoxm nudlmenlnetlt  rta(r oo1tltniictytls em( p (0 lxrxr3oo1omDr n o;s)trtmimpnu1omeemfes s sDumxrp;u1tptnifciydla elums (0 etomf3oodfpt luei;(0trxmxopoy1lp n net sfsDrm(roou4apxnmfctydfsDemnvonu4tltrxo3ty1fpD  nvi t  2trio3oo4lp   fvsas) 2trx  ot4oetn fetls s2umu pnt0treoxr todfptrlies s)truoiopno1apt  iet tfarrr(m ou1oeeomo3iysfaDum( o (0texrmrcoadlpD anvols s2tmxm3oy4amt mieiatfsDtau  ;u4optnmo3ilslmDea(mp u4 exrxf3iydlatrai sls0srxoim iudop  lnesas sruaxronu1apx  feiys a rlnvsnu)trtrxr totoa e nvs t0 2tm(opnudal  livta(fsrtm(ro;t1opeoif3iatlm2ua( p u4trtnif3oo1fpDeluvo ()trtoimpoy1openmiesl( arumum ot1oexomoctyd sDea( on(0trxomrcto1oa r neslt  eumxopny4al emnct ()srtm(m nu1aee  iciysfmDrmn o;u0aexrir ty1lp elneils) rxrim3iu1olenlfviltfs2rr( pno1oeeo o3tas aDua(vp (4tlxnif oytomDeauvs;t) rtm(o3no4opte netatf Dtr(r nu4oleoif3ildlm2raumonu0 ltnmrcio1opDe nes ()trxrxm3oo1optemneils) rtm(mo;o4olxomoeiltfs2rm(msnu0 eermfctodoa r nvi (0t2um(r3iu1opeelfvt t) Durxrp;t0tptoifeiatfa uln o;u)areoxr3oodopDrauvols0 2xmio3oo4lpenliesa( aDrm(r oo0aetnif3iysfa rluvs;t)alenmo3to1fa  luvils)srurxo3io4lpt lieil()arurx p;u4opeoiocias mDeln p () lxoxr io1fpD  nes;( seuoxmpoodllt mfeias)aDtaumooo1aeen i3tytlmDum( s t)aexomrcoy1op ran s;()s2xmxo3nudame mivs ()srumu ont1ole iicilt mDranvonu4alermf iytlptraivsls)trtm(opoodolenmncta() rrmum ou1aleomicildlm rmnmp;()arxoxr ia1la eluvol(  2xrxrpny1ap  lfes tfs2uau  ;t1ape mo3iytfaDemn s;u) eerxo tatfmteaueo;( s2ur(r3io4om   fcsl( srtm( ooo0tetnmfeiyslsDeln pnu)aexrxf iatop rlivs;(0 exrxr3nodame mnctat  Durxmo;u1oex  ieiadfm2uanmo;t4trxnio3oadoatrauvo;s0 rtm(m iu4om e ivia()srtm(ro;t4alxnmi3tldla ran pnu)tltnif3tadfa  anvs ( sexrxo3oudop nmfvtlt)s2uaur oo4altomfetat aDrlu onu4 rerxfciatla eaieilt tetoxm3iodomeemietls sDraxmp;t0aleoifeils m ulu s;t0tleomo oytomt aneo (0trtr(mpoydopt  nvs s  2ra(mpoo1tpx io3iatlm2em(msnu0aetnmf3iadopDelu i ()sexmimpoodap e ivtas)sruaxm ;u0aeeoio3tydlmDemn s;u)aetoif oadlmtrluei t srur(rpnu1ame lfcslsfsrumumo;u4apx  i3iysfaDumuvon(4arermfctadfaDe ueo;(0 exrirpny1ale mfei t)aDrm(rono1aleoii3tld sDelnvpnu0trxomf3iatfatr ieolt  rxo(r nu4olt miei t sDta(  oo1tpe mf3tlsfa2eln p t0aeenxo3ia1lptrlues;t texo(opiydom   fcilsf 2rr(m nt1apxn ociadlm ea(vpnt0arxrxf3oadopD an s ()t2xo(o oodopte icsa( s2taumpno1alto i3iyt s umump ()alxrircoytfateai ilt  2xoxrpnu4ol e nesasfs2taxrpnt1tpe  i3iatlm ua( sn(0 eenmrcio1oat  u sls)trxrxrpoy1openlfeil(faDrrurp;o0oleoio3tyd m rm( s;u0aleoxr3iadfm eaieo s0seumimpnu4omenmieils) rtm(moou1tpeomi3iyt m2elnmp u)tltnmrcoo1fa e uvil( setr(rpnu4llenlfes s  Dta(rpno0tltn f3iad m um(vs;t4areomo3oodlm r u ols t2tmirpoodoltnmfcilt  2ua(m oo0oetoif3iatlmDel(ms;t4trxoif oatla e ivols  euoxrpiodlmtnmfvsl(  Drrxm ;o1tetoio3ils a2um( p u)teerxf3to1lpt  n o;() eum(opnudamt  fct ( aDrm(mo;u0olt  i3tatlm ea(mo t0 ltrxf iodopt  nvo (0trtmir ou1lltelfcs t  2umxmooo1alxoioeiytfa2eanvonu0aeerxr3io1opt lnvs;t srtm(r3nudap elietas) rra( ono1aptoioetlsfs2rm( s;(0alxrmr3tadopt lueols)t2to(rpoudlm n nvi t  Dra(  no0olx  o3iysls2rl( o (4 eenxr3ia1latelnvi (0 euoim ou1om  lnvsas)aruaumont4olt  feilsfsDrln pnu4 renxfcta1lp rlnvolt0 exrio3io4lmenlivia( sDrrumo;t1aeeoifetadlaDea(mp;u)trtrxrcoatfpteau o (  2tm(opoydomt mfeils)aDrmum ;u1apxoio3tlt a2emumsn()texnmf3ty1lp eanvsls0trurxr io1amte iesat) 2raxm ot0olxoifeiadfa2ea(mon(0 rxoio3tadfa raivsl()trxr(o3nodoptnlnvtasfs2ra(m no1tee  icils m2ulu on(4alerxociatomte n o s)texmxm3iodal n fctl(fa2tmu  oo0tltoifeiyt m2emu s;(4texrmo oa1lmtr u ils0srxr(opoo1lptelneiatfa2ua(m ;u1tee iociadlm eanmsnu4arxrmr io1fa r u ilt0teurxrpny4amtnlivs sf 2rrxr ;t0opeo fctld aDrmn s;t)aeenxr iytoa rli s s0tetr(m3iydom nlnciat) Dur(r ou1tee ifeilsls ulnmpn() exomfcoydlaDrlivol(0teur(r3nu4lle  ivs t  Dtr(r nt0oleomf3iatfs2rl( s;t0arxnio3iadlmD  nvo (0 ruoiopiu1alee ivia()aDra(mono0olt mi3iasfmDelnmont) etnxo3iydfmDe nvsls)seurxmpiudlmt mieta( sDua(monu0tlen f3iyd s2rm(vo;(4 lenxf3oo1oaDe neol(0srxrxr3io4alt micta(  rtmx pnt4opeoif3tytla uauvon(4aexoxrctotoa  auei (  rtmir3ou4lptnmivt (fs2taxr ;t4tlx  fciaslmDuln o u) rtnmfciytlat aneo;(  rxmir3oy4am nmiciat)s2rmx pno0apxo ictadfaDel( s;u0 etrmo oydfm elieol() 2xm(r oy1opt  ncta()a2ur( onu1oltn ieiyt s ulnmo;t0arxnxoctadlmt  nvi;(0t2xrxo3oudlptelict (farrmxr ;u1ale mocilt aDum(mont4alerxo3oadfm elnvils)srtmiopnydame  iesat srta(monu0opt ioeilt aDem(vp u0 rermf3to1fpDeau o;s0 2xm(opiu1opt  ieils srtax pnt1texnio3iat m2el( o;u0arermr oatom elu slt)s2umxr oo4amte fcil( a2um(m no1oleoii3iadfaDuanvpnt0 rtnxo iy1laDrlu i;( setoirpiu1ll e fes tfsrur( ooo1tetomfciadfm umnmo;()arenxo3to1lmDr i i s)srtr(m3iy4op e nvt s  2tmum ot4aetnmo3iyt s umuvo;u4areomr3to1fptelivilt teumxo ny1amtelfeta( arurur oo1alt ifetysla2ea(vonu)teeomo3iy1lpt  i sls)teuoxo ny4om  lfeta()s2tm( ont0aexn oeiatfsDrmuvsnt4 etrxf3todlm r uesl()t2toxmpnudllen ictas) rurx o;u4teenmf3iytfs em( o;u0 rxnmo3todoatrlu olt)texoxr iodom   fvsltfs2tm(m ;o0tleoio3iat aDrm( s u) lxnmr3tydlptraiei ( s2tmxm3iodlm emfcilt)s2um(mp;u4aetoioetadfm2rln on(4teeoircto1fp eln i t) euoiopiudam   feilsfsDtax pou1teeo oetltls rm( s (0aetnir todlp rau i;(0trtrxo3nydal e ics t)aDrru p;o1apxnmf3iys aDrmn s;u0texnmo3ia1fa rlu i;s) etoio3iy1ale lneias  rtaumpnt0aptn fetydfs ua(ms;u4aeeomrctadlpt luei;(0trtrir3nudlpenmfvtas)srrrxmp;t0alx ifctld s rln pnu0trxnmf3io1oatr ivo s0seuo(mpiydlle livtlsf rum(root4tpxo oetydla el( s t0altrmo3oadlat  n sl(0s2xriopiudap  mnet tfsrrmump;t4tex mi3tyslm2uan s;(0 rtrxo oatfpte i i ()s2xrxo3iy4llenlfctas)s2ra(  ou4tpenioetltls el( p ()tlxrxf3oytlp e nvilt0 eurxo io1aleelivt sfsrtmx oot0oeenmiciysla raumpnu) rtrxrciotlpDr n ol()trxr(mpoo1lpee fciatfa2ua(rooo0ole mfetytla rl(vo;t)tetnmocty1laDe uvs;s)srxoxopiydaptelnvs t) rrax p;t1tlt mfetasfs2rmn pnt)aexnxociadfmDr u o;t texo(o oy4alee ies (f rraumonu4oeenmo3tysls eanvs;u) lxrif3tadfat anvo t teuoim3nodale mfcils srum(mpou4teto fctasfs2ulumonu0aexrmfcoadfaD  ues t srumim3oudlle mivsls) Drrumonu4aptomf3iyt m2rln s t)arenxfctadfpD au s;t0seumxmpno4oltn ncilt sDrmumo;u1tpen ietltfs el( p;t0trtnxr3ty1fp rau slt seurirpno4lm nmfvs (  rtax pnt4apx  o3ildfm ul(ms u4 eenircoydomDe ieo (  rxr(m3no1lltn ivta(  Dra(ro;t0tlxnmictyt m ua(mpnu4 lenxfcta1lptelnvs;t s2urxm3nydal n nei s)srrmxm ou4olxo f3iatfmDraump;t)tltrxf3ta1lp eaueo;( srumxo3iu4oleelfet (f Duaumpnt0aexo ietatlaDrau p;(4alenircoadopD ai o;()teumio iy1lltnmici t) Dua( p;o1tltomo3iatlaDuanvsnu)treomf3totla r n i;t0 eurxo3oodolt mivs sfsrtru  ou1altnmietltlm ulnmp;(0tlenxr3oydlpt  i i t0srurxm oodolt mivslsf 2tmuroou0tpx mfeiydla2uluvo u4 lxnmr tadla   uei;s setmim3oudam elfctlt  2tm( ont4alxomfetlsfmDemuvp;u4 lenir3iydlaD auvo s0 2xoxrpiu1lptelnvsasfarumumo;t4oeeo oeiyt sDrlnvpnt0aeermf iatlatrlnes;() rxmxr oy4alte fet s)sDrruroou0tle mf3tatla2rmu o;t)tlxomo oydfat  nvils0 eto(m3nudame  ietasfsrrmx oou4oleo oeiyd m2em( p;u0aeermr iotfp   n s s) 2tm(r iudalee nci s  rua(root0oee  feild sDelnmsn(0arenifcoatla   ies s s2xoxo iudam nlfet sf rtrxr ;t4alxnmfeild sDranvsnt0tetnmo3iytomD an i;t)teur(o iu4apenlfcsasf rtaurp;u4tptnmocias a emnvs u0aexoir3ty1oa ran i t0trxrxo3iu1oleelfesl() rua( oou0tptn fciyd m2rlnmo () rxnxr3oo1om eai i;t0 rtoir no4op n ieiatfs2ua(m ;t4aetn fciyslaDel( s;(4alxnmf oodfp rlivo;s0t2uoxm3ou4optnmncsas)srrax o;o4aex ii3tasls raums u0alerxo oadlm  ln il( setmir3ou1ap  lneslsfaDrrx pno1oeto o3tlt a2umuvsnu0 ltnio oadfatr ueo;s0seur(m ny1ale  fcs t a2urxmoou4tlt mf3tat s2rm( o ()tetoiocty1lmtrluvsls0 eur(m3nudlptelfeia(fa2raxr no1apeo ietytlmDem(vp t0aetrmrcoatomDeanvslt)sexrio3oodopenmfeiltfaDuax o;u0olxniieiys s2ulu o;t4alenxf3oy1fm rauvsls) eto(rpoo4ap nmfcta()s2rm(m oo4opxoif3ildfs rauvp;(4alerxocia1laDeau sl( s2xrxopny1optemfci ()sDrmxr ;u4apxnmfciytfs ul(msnt4arxoio to1lmD aivo;s  rum(o io1ol nmfetatfa2umumont4opx mfeild aDrl(vo;()artnif iytlmDe nei s  etriopiu4lmen nvil( artr(r ou0tlenii3iasfs2rmnvont) renif tydfm  lnvi t srurxopou1lpenlfcsasf ruau  nt4aee ifciad a emnvp t4alermfcoydlmDe i o;s t2xmxopiodap nlncslt) rtr(r nt4tpxoiietadfs2ul(vs t4artnmo oa1opt au ils) 2tmimpiy4am n nei (f rrr(ronu0opx  o3iatlmDeauvp u4alxnxf ta1lpDr uvsl()sruoir3oy4lltn nctasf 2tmxrpoo1tetomfciatls2ua(mo;t0 lxrxo oodom eli o;t  rtoimpoy4alenliesl( sDta(  ;o4aetn f3ildlm el(vp;() etnmf3tytlp e i ol(0 eum(m iy4lmen fviltfarumu pnu4opxnmictat sDemn o u4tltoxf3oadlpDrai i;t)t2umir3no1ope  fcs sfaDtmx  ot0apx mi3iys m2rmu pnu0 lerio3iytoat lu s;t)trtrio3iodlpt  nvia()srrmxrp;u0apto oeiydfaDemums;u4 exoxocootfp r uei;t0trumxmpiy4ole  nesatfsDta(r ou0opt  o3iys aDumn snt) leoiociy1oaDeauvi s texoxo3nudam emfes ()arua(ro;o1oee mfeiydlmDrauvp u0tltrif oy1la r ies;s  2ur(m oydalte iesa( s2ur( p;u0tlen ietls sDumnvsnt) rtoxf iatfp ean i;s) 2xm(r oy4ll n fcsl(f Dtru  ou1olxomfeiydla2elnvo (0trenmfcootlmt li o (0srtoir oo1lmtelfciasfaDraxroot1tetomictytfaDrmuvpnu0 renmr ootlp rlueolt0teumxm3ou1apt lictlt) 2tm(r ot1oleomoetyt sDrmnmo ()artomf ty1faDr ueo;t) rxoim nydame  ivias srrrx  ;o1open feiltla2uluvo;t4artrmfcto1fpt  uvols)setoir3oydameelfeiat  ruru pnt4openii3iadlaDua(vs (4altrxociydop rlivo s)trxrxm3iy1amtnlfvia()sDurx  ;t4teeomociydfmDrm( s (4tleoifcoa1laDrli sl( setmim iudome mieiatf 2rmuroot0aetniocild m2ua(mp u4tleoio3todoaD anvo;s0 2tr(r3no4lptemfcta()sDrrx  ou0oee  feiadfs ranvs;t)tlxnmf3iy1oatraues t0 eum(m3iy1opeeliviasfsrrrur oo4tet  ietysfs eanmpnt4aetomf3to1lmDeaieo;t0 eurxopnu4ope  nvilsfa2umx p;o4oexomicildlmDemuvon(4trtnmfciadom   ivslt tetr(mpny4lltelfvs (fa2um(mono1aex ioeiyd a2rlnvp u4aexnxo iadlateaueilt)s2xmiopnu4lmt lfvi t)artm( oou4tleniicils sDrlnvo;u) eerircto1op  aiesl()setmir nodam n icsl( arumu ono1aexo ieiltfa umums t4 eeoir to1fat livo;t0s2urim3ny4lmenlicsa( arrr(ront1optnmo3iatfm rmums;(4aetnio tatoptranes;()texr(r3iu4lm e ncsl(fsDrrxr ot4tpt mocildfm rmuvp;u4treomo3oodlate uvs (  rtmimpiudomeemfeils)aDtrxro;t0oet mictyslm rmn o;t)tlxriocoodfptrli ols  rxmirpou4am nmfct ( artrxrpnt4aetnio3ilsfm2uau p ()alenmoctadomt auvo t0 etr(m3oodal  mictltfaDtaxmooo1tpenifetydlm rl(von(0tltnmo ia1lmDe i i t) 2um(m3io4ap emnctasfartm(ro;o4tpt ifciltls eau o (4artnmocoodlptr ivi t)srurxo iydapen fvt tfs2tm(rooo0alxnmo3iad sDemn s ()arxrmfciadlmtelivolt) euoio3nu1om   fvsas  2ra(mpou4aptn oeiasfs uln p (0arerif3io1opt au s s t2xmio iydlmte nvta(faruaumpno4tltomo3iysfaDuanvont)artrxo3oo1lp elnesl(0srxmxm3oo4lm n ivsl()aDrr(m ou1ope  iciyt aDel(mo t)texnmr3tadoatelues;s) exrimpoo1ape  fcsa(farrm(moou0altoii3iad m ea(mo t0 lerifctotomteluei;s0trxo(m nu1ole  fvsa(fsDtrxm ou1opt iiciyslsDulu o t4alxnxr oadopDeai slt t2xrio iydame  fesl(fsrtrx o;t1apxnifctydla em(mp () rtrmociydlate ueo;(0sruriopno4ol elfvsasfa2rm(m nu4tle  o3ilsfm ranms t0arenxf oo1laDeaivolt sruoxopny4lmenmfcsa()a2raxm oo4tex  ieiltlm ran ont)tltoxf3iatop elnes;(  2tmio nu1omte nvt s a2um( ooo1aeto iciadfaDemu pnt0 etnif io1lmteluei;( srxmxm oy1lptn fci ( sDumumpou1tpt iiciatfsDra(vp u4aeeomoctodomD au s t setoiopoydlmtnmfci sfaDrmu pnt0ale mieild m2um(ms (4arxrmf iodlptrlueo s teurxm3no4ome  ncil(fa2taum ou1oltnmo3tldfa2emumo;t)altnxrcoytlaDe i o t seurio nu4lp nmict t)sDrax p;t4oeeomieiadlmDrmnms (0 rxoxrcta1opD luvs (0 2toiopou1lpenmfctas  rur(r nu0tex mf3iyt mDrmuvont)aeenxo iodfpDr ueo;s t2tm(r io1om elnvias)arrauroot0aetn o3tltls2rauvs;()trxnmfcoatop  livolt t2xrxr no4lmte nvtlsf 2umx onu4ope mo3tadls ulnmp;u) rxoxo3oa1opD aieils) etoxo iu4oleelnvsat srrmxm ;u4tet  ieiat mDeanvp t) exomr io1fp eaneslt0srxm(rpoy4ap n fes t s2rmx o;u1tptniocilt aDul( s (0tetrmf3oy1lmteli i s srxmxopiu4oltnmfetat)artr(ront0teeoioeiys m uanvo t0aetrmo oydlmDeauvilt seumxmpnudlme mivi tf rrax ono0olt  fciasfaDelnvp;t4trtoir3tadlmteau s s0t2trxm3oo4omt mneia(faDrruro;u0aee  feiadfmDrmu on() renmf oatom   nvi;s) etr(rpou1lmtn fvs s srumx  no0tpe mocildlaDranvon()tltoxr ootlm rlneol(0 eurxm3nudamt  iet tfa2tmu  ot0alxnmo3iytlmDrl( s u)texnir tytlaDrluvsls0t2urir nydomen iei sfsDtrxronu1olxo o3tls s2emn o;(4 eeoxo to1fate ieolt0setmxo3oo4apt  nci () rumxm ot4aee io3tyd a el(vpn(0arxnmr3ia1fm  an i;(0trxrxo ou1lm   nvt () 2uru  ;t0tltoifeildls rlnvp;() ltoxf3iatfmD lnvsl(0sexm(r iodalt  fesat)artau pno4apx  fciys mDemn on()artrmfctodfm  anes s)teuoim3ou4ol n icta()sruax pou1oexoii3tlt s2em(vo t0tlxoio3oadfmt lieo s trtoir3oo4ole miesa( s2rax  ;o4aleo f3iysfa2ul(vo ()artnmr3tadfm r neo t  rtoxr3iydom nlict s)aDur( o;u0aee ii3iys a ea(ms;u0 rtnxo iytlate u olt0 eum(m oydope liei (  ruax  ou1aeen oeildfa uan p u0 etrmf iadoaDrliei ( texrxmpoydol  mnct s  rtr(r nu1oex mi3tysla umums;t0 exrircoytfaD lneslt0s2toir3oodomen ivt s srumxrpou1aexnii3iytfmDemnvp t0tlxomrcoytopDran ols) rxo(m oydom n ivtatfartm(ro;u0tle  f3iasfa ul(vp;t) lenifctodomD anesls) exr(rpio4al nlnviat arumumpnt4apxomo3ildlaDelump u0teeoif iydoate nvs;t s2xmir nu1am nlnes sfaDuaumo;o0oltomi3ild s2rlu sn(4 renirctydlmD  i o;t truo(rpio4amt  ietatfsruru  ou1alxnmiciysfs rln p t)texomfciy1fpt lueslt0 2xrxrpno4op nmivsa(fs2tmxrp;t1alx if3tlsfa2um(mp ()aleomo3iatlp  ln s s0 2tm(m3nodllen icilt) 2ururo;u1teenifeilsfs ulnvs (0trxrxr3oy1faD an il() etmxmpny1lm elfeta(faDua( p;o4optoiictas m uluvo;u4 eenifcoatfptrauei s trtoxo oudlle lfvs s)srurxm ;t0oeeomociaslaDrmu p (0 lenmo iadlmt lnvslt0 rtr(opiudapeemivi ()srrrxm ;o0oetnmoctyslm2uauvo t)arenxf3todfaDelivi;t s2umxo nodop   nci () Dtr(root0aetoifcils a2eanvp;u)tlxriociadlm rlneo (0seto(mpnodame mivs t a2rm(mp;o4oltn feiasfm2ra(mp;u) ltomrcootfmte nvslt t2to(mpiodam e nvil(fartau pou4altoiocias m2emnms u)altomoctotlmDrluvs;s0t2xr(opny1omtnmieilt)s2tax o;u0opxo octysfm2eauvo u)teermr iydom  aiesl() 2toxmpoy1ole micsat) 2tau pou1tpxn oeiatfs uluvon(4arerxfctytlm e ivi;s trurio oodoleemfcil(fs2tru  no1tetoiiciadls ua(mo;u4alxnifcoy1fmDran o s  2uoiopoydomee neia(f Dtaxmooo1open ictasfa eluvo;(4 exoxo3oytlpt li s ( trtr(mpoudlltemfct tfa2urur nt1tpx  ieiadfaDrauvs t) exrxr3oy1fatrauvo t) etm(m3ou1omenliciltfaDrmur nu0ape mfetlt a2uan s;u) lxomr totfmD livi;s0trtoim3oo1aptnmnvi (faDra(m oo4altoifeiltlm2ea(mo;u0 leoif3iadfatranvslt0 ruoio ou1ol nlfes tf rur( pot4opt  i3tyt sDeauvs u4 renifctytomD anvi s)s2umxm iu1llt  icta()s2rrx o;o0tptoifciadls2ulu pn(0altrmo iatoaD livs (0s2um(m3io1op  mnvt (fsDuaur ;o4aptnifeils s2emnvo (4 ltnio tadla rluvilt  2xo(r3oodlltnlfcsls arumxroot4tlenmi3iaslm2elnvp t0aetoxocoytfpD aies;s0t2uoxmpiudlltelnei (  Dta(r ;u1teeomi3tadlm uaumsn(4alenxfcoy1omD ai olt)setoirpnydam  mnesatfsDurum ;t4oetomiciltfs raumsn()tltnio todoat an s;s truoxm3no1op emncs s)artmu oot4altoii3iltlm2eau s (4teermrcto1fpD  nvi;(0setoxmpoudaptn net sfs2rmump;t4tlenmicias s ran s;t4tlerio3oadfmtelnei s)srtmxo oodlpenmfeslt  rtm(monu0oetnmieiysfm uln o;t0 eenmo3tatopD lieo t s2urxr3iodlmeemfetls)srrrxrp;o4opeo ieilt s um(msnt0 etnmo3iytla eau olt) eurxm3iy1optemicils) rtrumpno1tlt mieiatfa2rlnmo;u4alxoircoytlaD au o s) 2urxrpou1amenlfvta()sDtaxrooo4opt ifctls s2uanvp t4 leoif todopt au s s0trxr(o nodlm nlfvtls arraurpnt0aeto oetysfs el(vs u4altrir ootla ran il()srtoxr3io1lleelfesas) 2taxmpot0apeo oeiydlsDel(monu)aleoxf3iytfm  aivils)sexoxr3nodlp nmivsas)srurxmont0olx ifctldls umnmp u0arerxo oydlpDeli s s)s2trir3iu4lpe mnesasfarrrxmo;t0tpeo octadfm2uanmon(0trxoif3iydlate neil()t2uoxopnydll nmnctls) 2rm(root0oex mf3tatfa2em(mp (0trtoif oatfptrai o;( srxm(o3ou4op  mnvia(fsDraur ;u1olxomf3ilsfa eanmpn()aeeomr to1omt  ieol() exrxopoudoptn fvi t) rrrumono0opxoioetysfa2rmu p u)tetnmfcoy1fpD lieils)srtoxr ou4al nlfvtl( s2tr(  ;t4alt ifeiytlmDuluvo;u) eenmo iodlpD luvi s  2xoio ny4om nlnci tfartrurpno1apeo oeiatfs2rmn pnu4 rxoif3oy1fmt  i o t0t2umimpoo1apeemfvsltfarum(r nt1apxn oeilt a ua(vs (0tleomo3iydlpt lu i;t trxmir oydole mfvs (fsrumu p;t4oeenmictyt s2umu s;(4altnxr3oy1fa e u i;( teurxm oy1olee iesa( s2rm( o;u1olxomo3tytlm2ran onu)aetoxf3ootfmD livi ( s2xmir3nodalteliet t srumur no1aee iociat sDuln ont)teeomfcoytlp elnvils)texo(m3ou1olenlietls srrm(mo;o0tee ifciys m2rl(vo;(0aexnxo ia1lmDelnvs;s) rtrxo iy4amenmnetat artm( pou1apt iieiatfmDea(vs;u4 ltoif totlm eauvslt tetr(r3oo4olt mici (  rumumpoo1oleo oetls m elumpnu0arerxfcty1faDe ivi;t) 2xoxr3nydopt  ies sf Dtrumo;t1teeomi3tysfmDulump t) exoif3tydlaDr u sls tetrxr nydlle  netas s2trum oo1tpxomictatfsDulnmo t4artoxrciotoa  livslt0 ruoio iu4lle  fvsat a2tm(monu4texomoctysfm ea( o () ltoxfcoadfmDrluei s)tetmim3no1am  lfvtl(  Drrxrpnt1ape  f3ias m2umumpn(4 reomf ootlateaivs ()sexoio3ny4ll n iet tfsDrmxmpnu1tetnmfciydls rl(vpn(0aeenxf ty1om  an o (0tetr(m oudop nlfei (fartrx o;u4teto f3tlsfm eauvs (0tetriocoodlmtr nvo;(0 2ur(mpiu1lmenmfet (fs2tmx o;u4ole io3tyt s2ea( p;u4aeenifcootlp rlnes;t)srumxrpiu4lm  mncs t)artmu  ;u1opeoiieildla2um(vp t) lxoiocio1laDr nesl( t2xriopoy4lp   icsl( s2ra(mpot1tpx moeildfa ean p;()tltrio3oodlp eau o s0t2tmimpio4lmte iei t s2tm(ro;t1tee mfctlt s umu p u0teeomr3oydlm e i olt)srxr(mpnudlpenlicsls srta(  ou0aeeoiietadls umu pnu4 ltomfcta1faD  n sls  2tmxm3ou4olenmfesa( sDtm( onu4alx  oetydfa2ranvsn(0trerxf3oydla  livo t teur(opnu4opt lieia(farum(  nu1tetnmfciys aDea(vo;u4teenio3to1lmDrlivs;() euoim oy1lm  lnct t sDuaumo;t0tptnmo3tlt sDrl(vs;t4arxnif ia1omDr ies;s) rxr(opnu4oltnlneslsf 2tmxm oo1tpeomfctyd m em(vo (4trerir oatfmtelnvi ()t2toiopoudopee fctatf 2umu o;t4aexnmo3iys mDrmn o;(4trxrio3ia1lptrlu ilt0 2tmxrpiu4llee fei t srrm(rpnu0oleoii3iaslm ran onu4 rxrmrctotla eluvo;t)t2toio3ny4lmtelfes (faDumxmpou1opt  oeildlmDrm( p;t)trenxocio1lmtr u o (0 rxrir3io1lm n iesa( srrrxm ;t1alt ii3iltlm2uaumo;u)alxnifctodla ranei;s) exr(o3nu1alenliesas  Drru o;t1texnmfciatlmDel( p u)alxrif iy1lm e ies;s)s2urimpny4olt  iviltfarra(mp;o1tet mo3tytls elnvp;u0trxoir3oy1fa rlnesls) rxoir3nydll n ivs sf Dtm(m nu4olx ioeilsfs2rl( pnu4 ltnmr3todfaD aiei;s  rumxm oudaltelfci s) rrmxr ;u4tet iiciydlm uln o;u0 lenmf iotla rlu o;(0srtmio iu4om  lnctlt)arumx p;u4optnifctydlm uau snu) lxomo ia1omt  neol(0tetrim oy4op n fetlsfa2rmxm nt4aeto f3iltfaDuanvp;u0aetnxrctodfp eai o;t0s2umir oodop   neslsfs2taumpot1opeo o3iasla2em(mo u0trtrmrcoatoatrlivs ()trtoxrpoo1alen fctat) Dua(mpnu1oetoiociltfs elnvs;t0tlerifcoa1lp e n i (0 exr(opiudlpt lnvia()arrmuro;t1oltoioeiyd s uanvp;(0aetnmo3oodomDe ieolt trxrimpoy4ole mfcilt) Drrx o;t4open ociadfaDemumpnt0aeeoxoctatomtraneol() ruoio3nu1ol  lfviat  Dumur ;u0alto i3tadfmDemu s;u4trxomrcoa1lp rluvslt0 2urimpiy1amte net s)srumx  nu0opxo ietys mDrlumon(4tlxoio3tydlpDeanei t setoir3iy4lm elfvils a2tm( poo1apeoio3tatfaDumu pn(4 renxfctytfaDrlueslt teumxo3oy4am  mivsasfsrumx ont1aeenioetyslsDulnvsn(4trtrxrcoo1lmDelnei;t)trtoimpnu4lmtn ivsls artm(  ;o4oexnmieiyt sDea(mp t4arxoxfctotlmDrln i;s seurio3oydop  mnvi tf Dtm(ro;t4opt io3ias a ulu p;t)tltnxrctydlmt an ols  etrxo ou4altemfetls  2rmu ooo0tpt mf3tad m2ea(mo;u0 rxnmf3oo1fa ean s;(0trxmirpnu1ole  fes (fsDtmxmonu4tpe  oetyslmDrln o;u) rermo3io1fatrau i (0t2toxmpnydamenmnes t s2ta(m ;u0oleniocildla2uanvpn(4alxomociy1opte n s;s) 2uoxopoudopenlncsls)srrmur no4teeoifcild s uanm
\ No newline at end of file
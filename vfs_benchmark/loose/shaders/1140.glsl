@@ -0,0 +1 @@
+u sls teurxo3iydaptnmieta(fs2umu oou0oltn oeilsla2ua(vonu0 rxoxociytopt lieo t0trxr(rpno4lpte iei (fsDtr(mono4aeeomfciydfa2ra(vs;(0alxomo3iy1oa rai sls s2toim oy1om nlnvtasf 2uaur ot1apeomfeiyd a ul(mpnt)tltnmrcoytoateli ols) euoirpoy1oltnlfetlsfarum(rpou0tptomfetlslaDra( s;u4altoxo3iatfaDrluvi;s0 eumxo nodlmtnlfei ( sDtau o;u0olt io3iydfm emn p u0arxrmrciydopDeanei;t0t2ur(m ou1lp  mict ( srrmurp;t4opxomo3iysfmDem(mp;u) lxnmo3iy1op   nvo s  rumir3oo4lmtemncsls arur(  ;t1optoif3iasls2elump u0 rtrirciotlpt  i ilt)trum(o3no1ap e fcta(f ruru ooo4opxo fciytlsDrlums;t) reomocty1fmteaneils) rurxr3nu4ap emivsas  2tmur ou4ale mieiys s el( o;(4aexoxo3iydfa rai il(0 rurio3oy4lltn fvt t aDtr(m ou1opx if3iytlm uaump;t0tetrxo3tatop rluvi;( srtrim3oudapte nctatfa2tmx ono4tee moeildlmDua( s;(4artnxfciytfpt ln sl( s2xm(r iodll nlicsa(f 2tmxmpnu4olto feiad m2rm(vs;()tltnxfctotfm  luvs t s2xmim iodolenlneslt) 2umumono0tlxo icilsls2eanvo (0aeerxoctydfaD lneils0 rurimpnodop emfesas sDuax  nt1aeto fetlt mDemu snt) exnmocoadlptr i o;s)tetrxm3nydalt  nvilt) Duaxr ;o0ape  iciltlm2ea(vpnu)artrmr3ta1la rln o;(0t2umiopou4op  mfvta( a2tmump;u4texnif3iltfs eauvo;(4 leoif ia1fmD lneo t trtoimpoo1lmen ics sfsrtmumonu4aeeomoeiytfa ua( s u0 eenxo3iadoa  anvolt  etoiopno1alee ncsat)a2ta( pou0tle iieiys a emu p t)tlxomrcto1om  auvs t0setriopoudomtemfesl() Dua(r ;o1aleomociytfmDrlnvo;t0 lerio io1fpD  nvi ()tetr(m3oy4llt lfcsl(fa2tmx pot0ale ioeiatfa2umuvont4aetnio oodlaD anvs;t0sexoxopou1open fcsatf 2um(moot4optnmoetysfmDea(vp t4aeerif3oy1lmt  ieil(0 rumxmpnydapeelict t aDuaumpno4apenmf3iad a rlump;u0artoxrcoadlm   ieo;( srtmxrpiu4lpte ncsa(fa2umuro;u1tleoiociyd sDuan s () rxrio3oodoat an i;t0tetrxopiudal nmneia()srrauront0opto ociatlm2emuvont0 eeomr3ta1fmD  ieol(  eumim3no4ll eliesat arrru  ;u1olxomo3iyd s2rm(mp;t0treoxf iy1fatrlueslt  2urxm iu4ll e fcs tfsDraxr ;t0apxoif3tls s2emums;() ltnif3iatlp eaueol(0 2tmxm3io1lpenmncs t) rua(mpou0teeomf3tlsfaDrmu o;u)tlxnxf3oatom   nei t)t2umiopnydamt  ncsltfarra( ono1tlt  fciat aDuln s;(0tltrxf iytfpDe i ils srur(m oy4lme mici (f ruaumpou4aleoii3iadlm rmuvo;t0aeeomf3totoat luvs (0teuo(r nu4opt mfctas) Dtau  ;o1olxniicildlmDeaumo t0alermo iy1fpDrluvs;() exrirpny4lmtelfvs t a2rr(  oo0opeo oetldfs rl( s t)treoifctydlaDelues;()sexoxo oudlp elnei (farta(r nt0openiieiys a umnvp;u) rxnircoytlptr uvo;s)s2xm(o oudapte iesa()a2umxro;u0olenioeilt sDrl(vs;t) rtoifcoydfm eau o;t texr(opou1ome  nvta( aDurxroot1optnmo3tysla2ulnmo;(0 reomo tatoateanei;(0 exoxm3nodamtnlicils)sDrr( o;o4oet ifeiatlsDraums;u)aetrmo oo1lm   ieo s  2to(r3io4altelietls) Dumxmp;o0optnifetat a2umuvp t4texomo tatoaDe u i;()tetoio3nydll nmncta() rtrx  nu4tleo ociat mDulumont)tlxnxf iotom rluvi;s0s2urim3iu4lptn ici t a2ur(  nu0tleoiieiysls ua(mp u)tetoio tatfm elivo s) 2toirpny1amee fesas  rtmxrpot4apt  ociysfs2ean onu0 rtomf3iydlaDe neol( t2uo(m iu4lpee nvsatfsDta(mono1aeenmfciasfs ra(vs u)aeerxf iy1lmteliei;s)srurimpny1lm elnvtltfs2tmu oou4alx  ieiytlm ulu s;(0trxoxocta1lp   nvsls0trxm(r nu4omt lnetlsfarum( p;u1aex iociyt a2emn onu4altrmf3iatlptrlnvolt srxo(opny1om e fcils)sDrmxrooo4olxniociatlmDem( o;u4 lxnxr tadoa ranvs;s  2xrir no4ll  lfesa( srtrx pot0oetnmocildlaDeanmo;t0texnmociatfmDelnvo;s)sexrxo iodlltn fvt s) ruaurp;o4tet mi3iltfs rauvo t)aetoio3iytfa r ivolt tetmxo oydaltelfei s  rtmxrpno0aptomo3iltla umnvs (4aeerxo io1fmt  nvo t)texoxm oo1lltn iei s)sDumx o;t4oee iieias sDelu p;t) rermrcia1omtraneo t)s2uo(o nudlm n ivi () 2trumo;u0teeomfctyt mDumuvo u4 lerio3oy1fmDe n o;()s2umiopny4ll emnctlsfsDtmu  nt4ope  iciltlm rln s;u0texomf3iytfmtrli i;s0 etoxr iu1omtelfvia(f rtmur ;t4tetn iciydlmDumnmont0 lxnmr to1fmDrli s;s)seurirpiu4aptnmivslsfaDrmurpno4openmociyd mDumuvsnu0 rerxo iatfp r ieslt0 2xmio ou1lpenmivt t)s2tmx  ;u0teeoiiciadfaDrlu snu) exrif tatfmteluei t0s2tm(r io4alen fesas)sDra(r nt4ope iiciat m2ean o t4 exomo3iy1faDr ues;s trtrio3oy4ame mivsltf 2urx pno0tpxnmfeiyt m2elu p;t) eermr3oytlmDrlueols t2umirpiydalte fvi ( artrxm ;u1tle mfetatfmDemums u0aetoxr totfmDr ivilt)srtr(m3io1ale livils srrru p;u1tpxomoetlt s rmnvpnt4tlxrxf3ia1la rlues t0s2trxm3iudam e ivilsfs2tmu  nu4alxn i3iydla uln onu)teerxocoatfp e n i;() rto(r nu1ol n fesat srtauro;u1aleomoctldfm emump u0aexoiociadlate uvi ( tetmirpoydaleemnes s  rumxro;o4oet  f3tysla em( o;(4alxoioctotoaDr ivi;s t2toxo io4lptnmnvilsfarta(m ;t4texn o3iyt mDum(vo ()trenxf3iytfpDr ues (0s2urim3oo4omt mfciltfs2ra(ronu0ole moetydfmDemn pnu4tlxoxfcoytomDelivo s tetmxm3no4omtemfetlt)artrx ono1ope iocilsfa umu s t0alxoxr3oatoaD  iei t) rxoir3no1amt mivt s sDrrum ;u4tle iiciadls2uauvs (0 eerxocio1opDeai i;s0t2trio oo4lmenlnetltfsDtax p;o0aet  icildfm2uauvs;t4altrmo oydlpDe nvi t seurim ou1apenmivi sfsDtaxm ;t4tpxomoctaslsDrmnmo (0texrmo3iy1fate uvi s)t2trio iy1lltelfeils)aDumxm oo4optn oeiltlmDel(mp;t4alerir3io1fm eau olt) rur(m iy4ll  mfctas s2tm( pot0aetnif3tys s2emuvp;u4aexrio3to1om   nvol(0seum(opoy4amee fviasf rrmum nu4alxnmfciadfmDeau s;t0alxnif tytlat aues;t  rurir3oo1am e ncsat sDtru pou0oee mfeias mDrl(vp;t0 ltnmf3oa1fmt lu i (0truo(r3nodam  lfvt s srra( onu1altniieiys aDrmums u4artrmrciy1faDraiesl()teur(r3iudlle  fct ()s2tr( oot0aetomicilslsDea(mpn(0aexriociodfmDeauvs s)sexrio oudlpenlfctlt aDtrurp;t4ole mo3ilsfm el(vpnu0trtnmocoodfp eauvi t)srtm(o oo1alt  iei sfa2tauro;u4olxomociysfaDuan pn(0 eermr ootoatr nvols0t2toiopiodlmtn ieia()sDurxm nt0ale mfeilslm2rmnvp;t4aeeomociotfaDranvi;s)s2xriopio4optnlnet sfs2uaxmpno1oeto fctatfm2ra(ms u0 eerio iadoaDr uvs;(  2trxmpoydlmeemictlsf rrru  ou4alxo fctaslsDrln o;u0 rtnxf totlpDeaieo;t0 rxr(o oydoltn ncil() Dtrxm ;t4opt  fctldfs uan on(0tlxnmrctydfm rluvi;t0trurxo oudoleeliesl( a2rm( o;o0ole  fciys a elump u) eerifcoy1lpteauvsls0 rurio oodaltnmieiat s2ta( p;o0oeenmo3iltfa2rlu s t0tlxoircoytoatrlu i () rxr(m3oudom e fes tf 2rr( pot1optn o3tyd aDumnvp (0aeenif3ta1omD aieols)srxoxrpnodlpen icsatf Drm(mp;t1optomo3ias mDua( p t4areoxr ta1omteaneilt)trtrxopio1olt lncilt) 2truro;t1olxoii3tyd a ean s;(4 leoio oa1lmtrli o;t teuo(rpou4op elfcia(  Dtmxr no0olt mietas s2uanvonu4 lxrmr3oatfmD lieol(0 rxm(mpiy1amenmncsl()sDtaxr nt0alxniociydls ulnvs u0alxrmo iatopt au s (  rumio3oo1opee fcia()srurxm nt4oee mf3tadfm eau ont) eerxf3ta1oa r uvi t) rtrir3iudapt mivsl(  2ra(m oo1oetnifeiyt m2rmuvsnt)alxnirctadoaDe ivsls) etm(m3ny1am elfvia(fsDrrx  ot4apxomf3tadfmDua(vp;t) rtoif tadfm ran olt0 eumxr ou1lm e iet ()aDrrx ooo0aexnmo3ilsfs2uanvs u)texrmrcto1fm ean o;s)s2tmiopoy4lpe  nvsl() rta(mo;t4tlxo i3ilt a ua(vs u)tlxrmo iodlaDeai s;s teurimpny1ll   netltfaDra(rp;t1oleniiciysfa2umnvp (4 rxoif3oatlp  ln ols)s2tm(m3oo4ol  mnvtls sDtmurpnt0teen ieias m uanvsnu0texomf iadoa r n ol(0s2uoxmpnudlleemics sfsrurxmo;u0olxnmfciytfmDeau s ()aleomociotfa rai s;s)teuo(r oydom n nvsat)sDtmu  oo4tlxn feiysla2eau p;t)tltrxoctatfmDrauvo s) exoim oo4ape  fctlt)srtax pnt0oex iociad mDel( p;u4 etrmf tadlpD  nes t)t2urxr oydllt livil( aDtm(rpoo1tlenmfciys a2uaums;t0arxnircia1fpDe iei;()srxrio3iydlm   nvt t sDtmu pnu4tlxn f3ilt sDelnms (0texrifciotfpDr uvi t)teur(o3io1lpenmfvsls) 2taxm ;u1oeeoiictysla2umnvp;() eermr todoaDean slt)truo(o3oudom elncs s srumuront0alx moetlslm2ranmonu0 exoxr iy1fm r i il(0 exo(r3iy4lpe mieia(fsDuru onu0alxnif3iysls2ulu o t) rxnxo oadfpDraieols t2umim3iy4op elnvsat  rrr(m ou4aet if3tlt m2el( o (0trtnioctadlm e u o s)trxrxr oudomt  ietls  rraxm oo4oleniocildfs uln p t)altnxocio1fpD au o s  2xm(o oo1ap e fesat  2raur ot4oltniiciat sDemnmo t0areoxo3oodlp  au o;()seurxr3nu4ll nlies ( a2urxmo;o1apt  ieias s2uan sn(4 rxnxrctytlpt ln i (0s2xr(m oy1optemieils)aDrau pno4tlt  i3iytfm uanvs;(0texnmf3ootlaD aivs;( texmio3oy1omenlieil( a2um( oou4tet ioctysfa2ulumpnt)texoxo oadfat luei;()srto(mpoo4ope lnci t)aDtmu  nt1apenmfeiadla eauvsnu4aetrioctydoate nvslt  ruo(r3nodaltn feilt srtaump;t1teenioeilt s uanvon() reoxf3totomDranvils t2umiopny1amtn nesasfaDtrxr nt1olx mieilslaDeanmp u4tleoifcoo1lmD  nvi s)srurim ny1om  miviatfsrtmum ;t0aee  f3iytlmDelnvsn(4tlenmrciotopDe iesls t2um(mpio1optemfetltf Dtm(r oo1oltnioctlslmDem(vp;()texoio tadoaDeaieil(0trumir3oy1lp elicils  rtaxr oo0oexomi3ildlm2ranvs (0aexrxoctytomtean ilt0 2umxmpno1ll nmivt t  Dumu  no4altoiieiatfaDelnmo u0 lenxfciytlm eauei s)t2xrxmpou1lle liesasfs2tau pnu1apx ifctltla emn on(0aetrio tadfat  ies;( sruriopny1altnmivia( s2uax ooo0altoiocild m2el( s;(0arenmr oodlp eanvolt)setr(r oydop   fvil(f 2um(rpno1tet miciad m2ea(mo;u4arxnir iotlaDeliesl()t2um(m oudalenmies ()aruaum ;t1ale io3tltlm ul(vp;(4tleoxo oydlmtrauvslt0sexm(r iydop  mnvi s srraxmp;o0oex mictytla rluvpn(4texnxociydfp ran il(0setoxopnudlp  lnet ( a2um(ronu1oee iociyt a emuvo t0tltoiocoadopDrlivil(0truoir ou4omt mnvs tf Dtax ooo1oexoifcils s2rau o u0 etrir3iatopDe ivils  rto(o3iu1al   fei s)srumxroot1tetn fciytfmDraums;t0alenir iytlp eliei;s)s2umim nu4alt lfviat)a2rrumont0aeenifetlt s2elnvo t) ltrio oo1fatr nvilt t2tmxm3ny1ol nlfcsls)artrur no4aeenifeiat m emu o (0 etomf3tytomtean ol()srur(o oo4omtnmici (  2umxmp;u0ope ifetydfm2uan onu)artnxf io1oate n i s trxm(m3oodoptemnvtls)arumumpnu4apxnmfeildfs2emumsn(0 ltrxfciy1omDeaues;s0srurxmpiodam  micsasf Drm(  nt0oeeoiieiltfaDrlu p (0trxrmo3oa1lp  auvi s t2tmimpoo1lptnmfvil(f Drrx  nt1oltnioeiyt mDua(vo;(0arenmf oodoa r uvol()srurxmpnu4al  lnvta(f 2uru p;u1apt  iciadfm2um(vo;t0teermf tatom elueol(0s2xoxrpio1ameemicia(f Dtrxrooo1aleoiietad s2ea( p;(0teerxo3iy1fm r nes t s2tr(r3ny1ome mnviat  2tm(r ;t1tptomo3ias a2eaumpnu0trxomfcoatfm  an olt tetoxo nudaltn ietlt) rumxrp;t1tleoiicils m rln snt) rxrmo iatfaD li o;t)trto(opio1lp nmfcta( arrmur ;o1apeo o3iydfaDuan o;(0altomf ta1fmDr u o;(0 rtrxo3oy4olte net s aDtrumo;o4olxo oetltfaDuauvo ()teenmoctytopteanes;s t2tr(r3oydapt mfci t)aDrau  ;t1ale  fciydlsDem( pn()teerxf todlmt  i s;t0truo(r3oudamtemies (fsrrruro;u0apeo f3tydfm ulnvo u0tetoxo iodfa  lieo s0srxoxopiudol n ici sfa2urx ooo4optn f3ias m2eanvsnu0arxnxf oytlmteaues;t0t2xm(r iy4ape micta(fartr( o;u0texo f3tld s2rln p;t) lxoir io1lpDrluvi;s s2urim3ou1ameemnvil() rtrumo;u0ope mietlslaDrlnmp;t)trerircoatfat livi s0 2xo(mpno1olenmfeil(  2ua(mo;t4tpx mfeiyt mDrau p;u0 renmf3oadfm r uvsl() 2ur(opnodole  fvsatfa2uaumonu1tle ifctadfaDea(vonu)tleoxf iatlpDe nvolt0 rtoim3oodopee fes s aDumuroot1opxomf3ilsls2el(mpnt0 rtnifctodfptrai o s0setrxrpnu1om   fcsa()aDta(mooo0tetnifciad s uan onu) ltrmoctatlm  lnvols)t2xrim nodal elnvi (f 2tau ono1olxnifciasfmDem(mo;()aexomr3oo1fm eluvs t seum(m3ny1oltn fcsltf 2umuront1tee mfeiasfa2rl( p;t)trenircoo1om eai i t teur(o oo4lpeelncil( aDtmumpnt0oetoif3tas a2rl(mp;u4artoiocoytfa r nvs s)trxrxo nu1opte fcilt)sDtm(ro;o1alx  fcildls2uan o;t0texrxo todfpt aivil(0trtrio oydom emnvsl(fsDrr( o;t1alt miciytfa uanmpnu4arxoxoctatoa e ivs;s) eto(mpny4ape  nes t a2rrxront0ape mieildfm eauvont)texrmf tatfptrln i;t0s2ur(mpoo4om e ivt sfsDrmxmoot0altniictltfsDua( p;t0tltnxf oydfpDe ivsl( srxm(opoydlmen ncsa(faDurx pnu0apxoiociatfmDulu s u4trxrio ootfmtelivo;t  rtmxrpiudol nmivs () 2uaurp;u1ape  ietyslsDrmnvpn(4alxnif tydopt  u sls0texrxm ny4ope  fct ()artmumpou4tetoiictldlsDrmums;(4 exnifciotfat au s s s2xr(m iu1ll   ncs sfsrtrumpnt4oex  ictlslm2eln o;t4altnxrcoa1fpD aiesl(0srtrirpiy1ap  mfvia(fsDrmx  nu0aptnmieiyt a umnmo t) etrxo oytlmDeln i (0 euoxo io1alt  feil(faruaurono0tee iietltlaDeln sn()aexniociotlaDrlivs;t0srtmio io4am nlnvs ( s2uauro;u1oet  ictytls rm( o (0trxrmociadomD luesl( s2uoxopou1ape lieslt  rrmuroot4tpxn ocilslm2eau o (4tetnxo ootoa  lnvols  rtmxmpoodoltnmnesatfsDrrxronu1olto ieiytls2eanvs;u)artoif3oydlp eauvs;()t2tmxo3oydamtn nctlt)arrruro;u4opt  o3iydls uanvs u4tlerxf3ta1lm elu i;t seto(m3nudole  fct t artm(  nu4alx miciad m uluvo (0aeerxo3iotfmtr iei;t0 eur(rpiudop e ncsa()srtru  ot4tlx ioeiysfs2ulnvs t4areomoctodlm r n i s  2uoim3ny1olt  fci () Dtm(m no0aet mfetasfs ul(vo () reoxf oy1latelnvs t s2xo(r oo4am nlfet t) 2ta(r nu4oeeo fctydfm2uanmonu)aetnifctydfaDr u o;()trtmxo3oy4lmenmfvtat)a2tmxr ;o0aeeoii3ias s2ra(monu0tlermf tytfmDeauvs;s)sexmim nydomtemieia()srtmxmo;u1tlt mo3tytla umu s;(0 rtnir tadoatraivil(0sruriopiu1amtelivi ()sDrru  oo4apxo f3ilt a ranms u0teenio3ootlpDeluvol(0srtrim oo4aptelnvil(fa2tmx pno1opxnii3iydfsDrl(vp t4altoxo3oo1op   nei;s) 2xoimpoo4lpt  nct (fs2urxrp;o4aeeniieiyt s emn pnt0 leomo iydlmtrluvs;(0srum(rpio4alenlnci tf Duaxro;u4oee  oeiytfm elnmo u0tlxnmf3iodfatrauvilt0 etoir ny1al   fvsat srtr(rpoo1optnifctadfa uan o;u4aexnmo tydoa  aivi;t) rtr(o nydam  mfesltfarrrx p;u1olxomfetlsfaDumnmont4teenmfctotom r uvi;t t2tr(r3io4al  mics s)srumum no4texomi3iatlm2emn s;(0artnxrciodoptelu il( teumiopny4omt lietlsfa2rr(monu0alenifeias mDemn snt4altomr3iotomDeanvils srxrio3oudop nlfcias)artm(rooo1openiictaslm eln o;(4aexrxo3oo1lpt luvs t s2toxmpoudolee netlt a2tm( o;o4alxo f3ilt sDuan p u4 reoio iydfa rai ilt)s2xmxr no4ll nlnetl( sDta(r ot0aleoiiciysla2umnmsn(0treoio to1omt aieslt0sexmxo io4am   iviatfaDur(mo;u4oetn i3iydlm2ea(ms;(0teenmr iadfp e u sls0srxoim3iy1am   fetls aDuaumooo0tpxo fctysfs emnmsnu0aetrirctodomD  ivslt texoirpio1lmtnmfesa()srrm( o;t1opt mf3tadls2rmuvs u0 exrxrcoo1opt livo t  rtoir iu4lmtn fcsas  rtr(rooo1aleomociysfa rmn o;u4 lxomo oydomtr nvs;s0tetmio oy1apte ict ()a2tmum no4oeeoiietat m ra( snu4tlenmr3tadlate n o t0sexrxrpiudalee fetls) rta( onu0olenmi3iysfaDemnms (4 etoxo3iotfm   ieilt s2trim3iy4lm nlics t)aDtmu p;o4tleo oeiltfm rlu sn(0 lxrxrcty1omtrau i s0seum(opoy4op eliei s s2ua(r nt0olenmfciat aDulnvsnt) etnxo3ootopDrlu ilt0 exrxmpoudalee ies ( aruau pou0ope mfetadfsDrluvsnu)tlenmr tydfpDraueol(0 rxoxo3io1ol  licilt)a2rm( p;o4opto oeilsls2ul(mo;(4trtrxr ootopDean o ()srxr(opoodop e fetl() 2ur(r ;t0alx  ieiyt m2umumpnu4 lxrirctydlm e u i;(0 ruoxo iy4lptn icsls)s2tr(r no4opto o3ildls2ranvo t4teeomrciotomDelnvil(0srto(rpnu1oleelnciasf Dumxr ;o1oetnmieiyt a uau o t4 ltnmociydoateanes (0t2trir iodomt  fvtl()sruaxrp;u1opxnio3iadlaDel( o;t4tlxnxo3oytoptraivo t srtmio3iu4omtelnvtat)sDuaxrp;u0ope mfciasfaDelnms t0 etoxo iotoaDrluvi s)srtr(r3nydlpe lieiat) rrmu p;t0tlx ifciytfa ul(msn(0 reomo3ta1lpDeli ol() exr(mpoy1apt  iciatfarum(mp;t4oleomo3iat s2eln s;(4altrmr3iadlmtr i ols  rtmxopoo1lm nlivt (fsrurx  ;t4aeto i3tydlaDemnmont4 rxoio oatlmDe n s t)t2to(m3iy1ol elfvs () 2uaxronu1tleo oeiysla2ean snu) exoxo3iodlm r i s t0tetrxm3no1openlietltf rum( onu0tltnioctlt mDuan p;t)aeenxo3iodfm rau olt0seuo(o3no1alt mfvias s2tru p;u4oex  feiasfa2rl( s t4tlxnmfcta1lp elivo () rtr(o3nydome mieslsfa2ra( pnu4olxoioeias s2ulu pnt0trtrmo3iadoaDraieo s)t2xo(rpoudlmtelfciatfarraxr nt4tpenioeiadla2eaums;t4 etoxociy1fmteauvsls tetm(m nodamen ivias  2rax  ot0altn iciytfm rl( o t)alxnif iotla eauvs;(0 exoim ny4lmte ivsl(f 2urur no0tlen fciat m2rlums;u4tltnmr3totlpD aivo;s seum(r3iu4llen nvi sf rta(  nu1oetnmfetydfs2uauvs;t4artoio oy1fmtr i i ()t2xr(opiudomt liesasfartax ont4tltn ictatls2uluvont0aeenxo3oadomteluvils0 rxrir3nudolt lfet sfsrum( o;o1tpxoii3tlsfa2uanvs;(0artoxf3tydlat  n o s0s2xmxm3iy1alen ies t sDum(mpoo0apx mo3iyt sDrm(vpn(0trenif3ootfateauvs s)t2tm(mpnu1ol emfctlt) rrrx pno4aee moeiytlm2raump;t4 etomr3ta1fat lueo;t)seumirpiodopee ici t)srrmuro;o1apt mictysfaDumumon(0aeenxf3iy1fpt lneo;t0truoxmpou4opt lici tf Drmu  ot1aetoioctlsls2uauvs;(0 lenxo3totfmtrluei;s setoxo3iy1lltemfeta(farurxrono1tlxomociytfs ranvo;u0 rtnxfcta1lmt  ivo (0trxoiopoodlpt mivta(f rrrurpou4alxoiociyt a eanmp u)alxoxo iadfm eluvolt0trur(o3iu4am nmnesa(f 2um(  ;o1aeto o3ilt s2ulu snt0aexoirciotlaD  n s (0 2tmim nu1alenlfcslt artau  ;u4oexo o3tltla rl(vsn()teerxociy1fmDe neols0srtr(mpiydlme liciltf rurxm no0apx  oeiydlm ul(vpn()arermocootlm elueols) 2ur(mpio1omen ietl( srrax ont1tlt  ieiadlm rlumon(0aeenircoy1opDeli o s0t2uo(mpnudope mfvt s srtru pou1tlt mi3iltfa2eanvo t4tetoxo oodfmDeaueo;s)s2xr(rpoo4alt  fci () 2taxrp;u1tlxoioeiys m emnvo;u4 ltnmr3iydfpDrai sl( s2toxm3oy4ole  fvi s arua(ro;u0tee  ieiltlm el(mon(0 etrxoctodomD lu s;( seuo(mpnu1alenmfcsa( s2uaumoot0tpxoio3iadls rau p u)texrxf3oo1lpDr ivs;() eurxrpno4ale  ieslt s2taxr nu4opx mf3iadfa2eln s u0 leoio3iy1faDrlies;(0trxoirpnudam n ici ( aDtrx pno4tle mfetatlaDumuvpnt4altoirctatopt  iei;t sexm(o oo4llee ivs s)artmx p;u4ope mi3tyslm ulnmsn(0artnxrctydoa e ivsls) 2tmio oo4ol n icsatfsrra(r ;t1alxoiietld a2rauvo (4arenmrcio1fp   uei;s) euo(m nydam e icta( srtm(m ;o0oltnioctyd m2ulu snu)tleoircoadlmt ln o () exr(m3oodlptnlictasfarraxmoot0aetomoeiydfsDulu p t4teeoxf to1lmD  uvs t)texm(o oy1am nlict t srurxrono0tpto icilsfa um(mo ()trxnmr3iadlpDranvo t0 exoxo iydaltemnvtatfa2rax p;o0olxn o3iyd aDuaump t4trxnifcta1omD  u o s  2tr(o iydal nmncsls)aDumu o;u0olxn feildfmDul( snt0aetrmr iy1lmD lnes;t)trumxr nydamenlfciasfarrrxr ;u0tptoifctltfm2eluvpnu4 exoxfcoy1fmDe nvsls0setrxrpoodopeelfeia()aDtm(mpou0alto ictadlaDrl( s (4aeeoxfctydlat ai i s)trurxm nu4al  lfvtl()aDrrx  no1tlxn f3tatla rmn s;u) rxnxo3iatfmt  uvols0trxm(rpny1ale micta() Dur( ont4tlx  ieildfa2uln pnt0 etrxfcia1fm rai i;s  ruoxr oydlm e fet (fa2rrxmp;t0alx mi3tatla2ulump (0aeenif3oy1fp ran i;(0 2xmxm3ou4om  lnvi tfa2umurooo0altn o3ilslm emu pnu4 rtrmf3ta1fp  aieo ( srurxmpiu1ape livil(fsrtmxronu4tlxn o3tldfm emnmp t)aetrmocoadoa  aueo;t0s2xmxr ou4olt lieia( artmxrpou0aex  feias a emnmpnu)aetoxr tytlmtean i;()t2ur(mpiu1alte nvta()srurx ooo1teeo fciaslm umums;t0trxoxfctytlmD aieslt)trxo(r iy1olenmnvta( arur( ono4oee if3iytlaDel(mp;t4 leoif ia1fa e ieo s0sruriopno1altemfct ()s2tr(ro;t4tpe ifctysfsDua(vonu0arxrif oytomDrau o;s0 rtmiopny1altelnvt s)aDumum ;u0tpt  ociadlm2ua(mp t4 leoif3tydoptrlu o (  exmxo3iy1lmeelnet s) 2rm( o;u1oexniocildfmDelnmo u4teenir3to1lptr uei;s0s2uoimpoodlpenliciatfsrrmu pnt4olenifcildfaDrau p;(0 ltrmr oo1lpDelneo ( trumxm3oy1lp nmnvt t aDtr( o;t4tpenmf3ildfa ranmo (0arxrmoctytfpt lneo ()sexrimpnydlm   ncsls)a2rm(  ;t0opto fetytla rluvp;u4alxnio io1fa   u o s  rur(m oudopeemfvi s)sDraxro;o4olxomoetlt m ua(vp;t4trxrxf iydlpDrlues;s  rum(r nu4llenmicils aDtmu pnu4oexnifeiltfa2uauvsnt4tlenmrcoatla eaies;t srxo(opno1optemivias aDrmx poo1apx iieiltfa rm( p u)tleoiocoy1opDrlneolt s2xrxmpoy1alt lnet t  rta(rpoo0olt miciysfm rl( s;(4 ltrir3to1oa r nvi t0s2to(o3no4lmt liesatfsDrmxr ot4ope iietyd m elnvsnt0 eenmrciy1fpDraneo s0s2uoxr3nudoptn fcils) 2uaumoot4opto ictas mDeanvo t)texrxr iydlp e ueo;()t2toim iy1lm  miet t s2rr(  ot4aetn o3tydla2ulu p u0alxrxrciydop  au o;t) exo(mpiu4altelnvi sf rurx oou4tpto oetld m2um(mp u4 lerxo3ootfp  lueilt0s2tmir3iydlpe lfvt s sDrm(moot4alen ictatlmDeln o;u0aetnmocty1lm ran ilt0trxo(rpoy4omt lncsltfsDraumo;o0oexoifctyslm uan snt) rtoxfcio1fm  anvol(0 2urxo3nu4lm e fetas aruax  nt1tpeoioetldls emuvsnt)aleoir3iodomDeaivi t)srumio3iu4amtemnvt sfs2tau  ot1altn oetlslsDrmnms;t)teermf oo1oaDrlnvs s s2trim nu1ol emnvt tf 2ua(rp;u4tex mfciyslmDem( o ()altoir oytfm   iei ()trxrxo no4altemiciasfaDrmx oou0alxoioeilt a emumonu4tetnifcto1fpD  nvi t)srxoio iydlmte fesa( sDtrumpoo4oltomieils mDum(vs ()artoxf3todfmte n ol(  rtm(m3iudomtnmictasf Dur(rpou4tpto ictydlsDran p;u4 rtnxr3oydlmDeaues;()sexmirpoy4alt miei s srrm(m ;t4tlxn ocias m2ra(ms t4 rtoxo iytfp raneolt)srtrim oy4optn iei s)a2taxmo;u4aee miciytlm rln pnt4arerxrctadlmt li o (  etmirpiydol   fcsl(  rrmxro;o0opxoiocils m ulnms;()trxnirctodlpt  neo;t)s2xoir3oudomen nvtlsfaDtaum ou0altomfeiydls eau snu)texrmrciodlp raieo;t  rxmim3oy1lltnmieiltfaDrm(ro;t0apxniictyt s eanmsn(4altnmo3tatomteai i ( trum(opnudlm  lics ( aDur(mpoo0tpxoii3iltfaDrlump;t) etomr oydlmteaiei;s setr(mpoy1opee fvsls  rtax  ;u0apenmietatfa ran p;() rxomociydop e i ols0setr(r3nodam nlfvs s  Dtrur oo1aeen i3tys a rauvo t0 rtnio oydomDelieo;s)sexrxo oo1opt  ies t)sDrmu p;t1tpxnmfeias s ulump;t)arxrmrcootop   ivs;s texmim io4opt mfcil()s2uau onu1alen feiytfaDuanmp u)trtnxocoodlaDrlneo () rtmxr3nodole  nesls)aDumx pno0oex  i3ildlm rm(mo t)tlermr3totla  aues s) etoimpnydlmtemiesl(  rrmxrono4apxoii3iysfm2rauvp;()aexrmo oodfptr ieo ( seumio3oo4amenlnes tfs2tau p;t0aetnmieiltlm2rmuvp;u0aeeoxr iotfa   i s t0t2xoim nu4lm nmivslt)srumu p;t1aeeo ictytfmDuaums;(0tlenxo tydop eln s t) etrxr3iydomt  fetltfaDraxmp;t4tee mfetldlmDuau ont0alerio iatlate nvi;( trtrim oo4ome lfesl(fs2ra(r nu0olx iietlsfsDumnvon(0aleoiocoytomtrln ilt) etm(mpno4ap  livt (f Dtrumpnt1aptnifciatlm umn s (4 lenxfciytop eauvi;s)srxo(mpou4amtnmfci s  2rr(mono4altn ociad a raumo;u4 lxoifciodoaDrauvsl(0trur(m oudlmee icsa()a2ra( o;u0aee mociydfs2uauvont) reoxrciodlmDe ieilt0 etoxrpno1ame mict s  Dumxm nt0tpenmo3tydfa2elu sn(4tltoxr tydfa ranes;() euoxm ou4om elieia()arrm(ro;u1tpeoif3iasfs2raumsnu4arxrxf ta1la elivol(0srxm(rpnu4omte feiatf Dum(mp;u0tleo f3iydlsDemnvp t4 renmociadomDrlnvs;t)trumxopno4apt mncsat)aDrr(ro;u4oetn ictlt mDrm(mp u0trtrmf3ty1omDrai o;( t2tm(r3iu1lpe  nei t sDrrxr ;u1texn ieiadla2rlnmonu)areoxrcoadfmte ueslt)sexmim iy1lpeemfei t)aDumuro;u1aex  oeiasls raumo u)artnmf3ia1lmD  ivs;() euo(m io1lp   ivta() 2umxro;t1oeto o3iytfa2elu s u0tltnxr ootoa e nei (0s2uoxo oydop  lfvsa(farur(roou1aexomfetatla rm(vo ()altrmo3io1lp e uvs t0 eurirpno1olenmictls)s2urx poo0open f3tytlaDrmnvp;t4artomf3iy1omtraivs ()trxmxmpny4lpee feiltf rtaxr nt4tetomf3iadfm2umu s u4 etoio io1oa eaneo;t srumxmpou4lmtelivslt)a2trur ot1tpeomieias a rln o;()tltnxo3tytoa rlies t)s2tmxo3oodlleelnvslsfsruau  ;t1oex mfeiatlm emump u4 ltrmociy1lpD  iesl(0 exo(o ny1lltnmfvsat)a2trxrp;u0tetn octlt m2ran s;u4trtrmr iodopD  ivo;() exr(mpno1am  lnesls)srrrxm ;u4apxniociysfmDua( pnu)areoxrcty1lm  an s (0s2to(o iu4olte fesas sDtr( pou0tetniociydla2rm( s u0texrmf to1lmteaueo;t)srtrim3ny1lmtemicias sDtr(mp;u1olenmictyd a um(vsn(0 ltnxo3oy1opDr nesl(0s2uo(r3ou4apeemncia()artrxr oo4alen fetltfaDemuvo () etrmociydfptrliei;t0 rtmxr nydameelfct tfsrumxmp;o1tetnifctytfs2ulumo;u) etoxf3iydomD anvi;( texoxo iydal   ietls) Dtaumpnu4oeto oeiyslm2um(vs u4trtnio3tydoa rlnvo t teuoxmpiy1om  miei t) rtaxro;t0oexnii3iadla emu p t)teeoio iodomD  ivs;s0texrio no4opte feta( aDrru o;t0oltnifetysls2ran s (0arxnxocoa1optr ies;s0texmir nu1lp nmnvtl( srumx o;t0opxo ociaslsDem(mp u0tetoir ootfpDr neo;s) 2umir3oo1lp emfviat)aDtaxroou0olen feias m2em( onu4 ltrif iodfmD luvsl(  rxm(o3iu4opeemfvsa(fsDua( poo1olt  ieiatfm ulu s () exnio ty1latran slt) rxo(o oo1lp e fvsatfsrumu o;t1olt mieiysls emu p ()arxnmo iydla rauvol() 2urxm nu4am n fcsa(  rrruro;o4opxoiieiytlmDemn p t)aeenir3iadfmte uvi;s0texm(opiudlmenlicslt  2taur ;u4tptnio3tatfa eln snu4tlerif3iatoatrlueo;s  eurir ou1lltelfcsas) Dta(  ;o0oltoioeildfmDua(mp;(4alxoirctytlpDrluvs s  euoxm oy1am e ietlt s2ra(rp;t1opxomfcildfm2umumonu0 eeomf3oy1lmte i s;t0 rxoim iudopte fvt sfa2rau pnu0tltomo3iat a uaumsnt) lxnir3oodfm eluvi s0sexo(o oodoltnmiesas)arrmu p;u0aet mfciadls ua(mp;(0 ltnmrctytfm elivslt trumio oy1om emfvs tfsDrmurpnu4alxnmietlsfmDea(msn(0areoxocoy1omtrli slt) eurxo3nudomte ict s)s2ra(mp;u4tltniieiatfm2uau pn(0tltnxr tatlpDr uvs;(  2uoxopoodop  mfesat)aDrrx p;t4oeto iciyt a2uan s (4altnmo3ta1lmtr n i s0srxo(mpiydlmenmietat)srur(mpoo0opxnmfeiydlm rlnmp t0aeenmo oytlmtraivo;( t2urim3nodal  lnet (f 2rmu  no0olt  fetatfa um( o;u0 ltoir oydlatraivslt0texoxopoy1lmte netlsfsDrrxr ;o0tpeomocias s2uanvp;u4aetrxf ty1om eln slt  etrirpnu1altelfes t arrmur ot1olx ii3iadls rmnms;u)alenir3iodoate i sl(0 rtoir oy4ameemivs sfsDumumpno4tpx mf3taslaDeanvpnt)tetrif iotom rlnei;t)t2xrxmpno1lme mivi s)aDtrxmpno4oeenmoetlt a2rl(mp u) lerxf ootomDeli s ()seto(m ny4omeemiei t  Dtr( p;u1tetoiociatls2ul( p t4aexnxfctodlmteauei;s0trumxr3oo1om nmfvtl( a2tmxmp;t1ole ifetys s raums (4tltnif io1laD an sl( trtrim3nu1omtelfvi s srrr( pot0optomociatfa umnvon(0 eerxfcoadfmDeanvi;s)t2tmir oo1om  lict sfsrurx poo0opto i3iaslaDum( s u)alerxf3oydopteln s ()s2xr(r3nu1al n ict ()arra(rono0olxnmoeiasfa emump t0 lxrio to1la ranvs ( teuoim3ou1ll   nvsa(fs2rmxrpou1apenifeiys mDranms u4tlxoxr iy1op eli ols)s2uoxr3ny1olt mivtl() rrmxmonu4oee if3ild a2emn p (0 ltoir3totlp ranvs t0 etrir3oo1optn nvtat s2umx ont0optnmocils mDeluvpnu4aetoir3oy1faD livs s0 exrxm3nydalte fesas aDraxm ot1alx  fctytfs2ulnvo t0alxomfctodfmt  neils)srtm(opoydamt lncta()a2taur ;o4alenmiciasls elnmonu4aexomr3iy1fm ran ols) 2tmiopno4amt mnctltfaDumuronu4alto fctadfa eln s u0 exnmr iotoa r nvol()trxo(m iydlp nmfctlt srua(r ;o0apeoiieiltfsDrmnvs;(0areoxf3oy1faDr uvo s  rumxm3io4omeelivi t)aDtr(mp;o0opxo icilt sDrl( o;t4 rerir3iy1omt  nes t)seurxo3oodope mivsas) rurx p;t0aetnmo3tld s2em( p;() lxrmr ty1opD  n i s0t2tmxm oo1lm  lnvilt) rua(mpnu1texn oeils s em(ms t4treomociadoa r u o t  etr(r3ou1ll  lnvi (f rtaxm ;t0tpt iicilslm um( s u4tltrmr3oa1op eauei;()seum(r3iy4omt lfvias  Dtrxm ou4aee  octasfsDea( snu4aeenifcoytoatean ilt) 2ur(rpiydol  lfvias  rta(mp;t1oetoii3iydfs rlu sn(4texrir oydoatr iesl()teto(o ny1om n nct (  2tmxmpnu1tetn ociltfs uan p t4 rxomr3oy1omDe i o;( s2xr(m ou1ole livtls aDrm(mp;u0tpe  ietlt sDuanmo;(0 rtoir3tadlateauvo;t)sexoxo iudlm e fet tf 2tmx pou1apt moeilt mDumuvon()alenxf3iodfaD an o (0 rxoimpoy4ol   ncs t) Drm(mp;t4ape  feiyt a rl(mon(4 exrir3oo1lmtrlivo s  eurxrpou4lpt mnct tfsruaur nt1tlt iieiasfa eaumsn(4 lenir3oytla   i s t0 2tmio ou1altemieiatfs2umu o;u1apt ioetydla2ul(vs u) rtnio3iytlp e neo;s srtr(r3iydaptemies s)srra(mpoo0ale mf3iasfs um(vp;u0 etrxfctodfpteln sl()srtr(rpio1omt  ivtas) 2rrurono0tpto i3ilt aDel( o t) etrif tadlp r n i ()sexrio3oo1altn nvsls a2ua(roou1tlxomi3ias mDulums t4aleoir io1lpte i o;t0t2toim iu4alenlncias arurxm ou0opxnmfciyd mDul(mo u)aleomfctydomtrlues t tetmxrpou1lptn ivsasfs2rr( onu0apenifciyt mDra( snt0aleriociotfp ran sl() etrxm3nydlpe lncs sf 2taump;o1oetn oeiydfaDrluvp u)treomf oodlm   i ils0trxoir3oydllte fcilt) Dumxrpno1tet mf3ildfm2rlumon(4artnmo3totlaDeli ils)t2xm(opno1oltelfcsa(f rur( pnu1oexn iciydfa ra( p;u4altoxr totfat  n slt0 2xrir3nu1ol nmnctl(  Dra( o;u0tptnio3ias a ranvont) reoirctotoa e u i t  rto(mpnydalen ieia( sDrmxmpnt1aetnmf3tydlm uau sn() ltnio tadfm ean s () 2xo(rpoo1lmenmici t aDurumono0tlen o3tlsls2rmnvo ()tltnmr to1late u i;t)texo(r3ny1apeeliet () Dra(m ;t0tle  oeiysla2rm( pnt)artoxr3iytlatrlnvs s)s2xo(m no4lp nlics tfsrtau pnt0tlenmi3iltlmDuanvont0 eeoif3tatfaD  ues;t trxo(mpiodlltnlfvi ( srtmx ooo0alxnif3tas sDra( snu)aleoir io1lp   i s t  2urxo3ny4omeemietasfa2rau pou4opxoioeilt aDrlump (0 rxnxfcoa1lm eau s t0setoim ny4lptn ivs (f rta(mpoo1oex  ieilsfaDra(mp ()altrxfcoadlm r n i;t0trurio no1alte feia() ruaxrpoo1ole mi3iatfs2ul(mo ()aetrmfcoodom e nvi t0trxm(o oydll  lnetat s2tm(mp;u1olto ietadfm2emu o t) etrmf3iydom rln slt srtmxr3iudoltnliei sfsrumurpnt1tptnmf3tltls raumpnu0 rtnio oytlpDrluvi s t2xoir ny1ap  mfvi sfsrta(r ;u1aleo ietat a rlnmo (4 eermf3oodfptean i s0 rxrxopio1apenmieilsf 2tru  nt0aeeo ociatfm2uanvp ()tltnmo tatfpDelu il(0srxoxmpnodlm   nci sf rrmurpnt0apt mi3iltla ulumpnu0 ltnmr iydlp raneols0trto(m3no1lm n ivsl()sDrmx onu0tpt mf3iyd s2eanvsn(0tlenxfcoytoate ivs t0teum(mpnydlmee iciat a2tax oou4tltn f3ilsfaDem(ms u0tetnmfctotop e i i s t2tmxr no4aleemics s srumu o;u4opx moeiatlm ea( o;t0tltnxr oytfp  au o;(  2xrxm3nu4llt  iesa()aDrm( o;t1apeomiciadfs2eln p u)tlxnmfcia1lptran o;s trumim oy1am   fvslt  2umur ot0apx ifetys m rmumpnu4aexomr ta1op  luvs;(0sruoxr3ny1llte fvs (  2ra(r nt4oetomf3ildlaDum(msnu4trenif3oa1lat  n o (0texr(o3io1ole mnvil( srtaxrpoo0alx mfctatfa2uluvpnt4tlenio oy1fptrluvils setm(m io1ap  mfvt s)sruauront4optnii3ildls ua(vs u)tlxrxfcoadlmtr n sl(0s2um(m3nu1ap   fviltfaDta( p;o1oex ii3ildfmDulumont4aeerxo tytomteaiei;() 2xo(mpoydomtelnvi s)srrr(mpoo0tetn octlsfs rm(msnu4 exoxo3tadlmD  ivi;s  rtoir3oudlptnmivil(fs2raumpou0alx micilsls uanvs;u0 lenioctatfa r nvo s srum(r oy1am emfvsa( s2rmum ;u4tleniieiad m rau snt) eenmfciodfaDe ies t  rumxm ny4omen ivt tf ruau  no4altoio3tatlm rmnvs t) eenio3oodoate neo;()s2trir3io4omtelfcil(farrr(r ot1olt iictltlmDrmnvs;(0artrxo3tytopt lnei;s)teumxo nudlmtemnciat)arraxrpot4tpxoio3tldlmDrluvp (0 renio iy1fpte ueo ( s2umir3no4apte ivt t)sDraxmp;o0oexn ieiltls2em(mp u4 reomfcoatlatr nvs;s srtoxo3iudol nmict sfs2rmx ooo1tetnifctydfsDeaump ()tlxrifcoy1lmtrauesls0trum(opoo1alt  ncs s) 2raum ;o4olenifctydfa2uau pnu0alxomr3oa1lptr uei ( t2tmirpio4ap e fet () Drmu o;o4aetomfciyslm ran p (0arxrmf iadlm rlnesls0 rxoio ou4lle  fvt t a2tru oot0tpen icildfs2elnmp;(4trtrmo3ootlmDraueolt  etrio3nu1oltnlnvt sfaDtm( ono1texo o3ilslmDea(vsnu0trenio tytfaDraneslt)srtoir3iu1ap  mivta(fsrtmumo;u0tpenmfciyt a2umuvs;(0 lermf3ia1omDrlivsls  2uoiopiudlm  lfcslt aDtm(ront1tleo ictad mDrauvs u4 ltoxo3oy1fm  aiei;t  2urio iudlmeemies s  2tm(  nu1teen iciat m2rlnvs;t)arxoxrcoy1fp e i ols)t2xoxmpoy4ap n ieias  2urxmpou1apxnmo3iysla2umuvo t)altnio ia1fp  auvi;(0srtmio oy1lle mfvia( sDta(mo;t0oex iietltfs2rl(vp;u4alenir oodopD ai olt  rto(m iy4lmte nvi (fsDuax ono1oeeoii3tldls ul( o;u0altrmocoadom rlnvs t0teumxrpiydop elivtat) 2uru pnt0tlt if3ildls um( p;()teenmo iadop   ueil( trxmimpiodapenliesls a2rmxm nt4tpxomiciatfa2rl( pnt4trtrmocoadfpDr uei;s0s2trxmpoo1ap elietat) 2rmxmp;t4alt mfctasls uaump;u0trenxo io1oatrli i s0setmim oo1alen fet ()sDrr(mp;u4apxnmocild mDrmnvs (0tetnirciotfmDeaueslt) 2umir3nodam nmiciatfaDrmx p;t1tlt  o3tltlm2umnvs;t4tltrxr3iadoaDeau i s)texo(m oo1lm  mict sfarumxmpot1olto o3tldlm elums u4trxnifcoo1fmDelivols trtm(o ou4lpee nvia( srtru pou0texn oeiatfm2rlnvs u) rxnmrcio1laDelivs s0setrxrpou1openmietatfa2rmx pnu4tlen i3iltls2rl(vsnu0aeeoxr3oydlptelivs t0t2xmxo3nudamtelieiasfsrrau ono0aeen fetlslm elu snt4teeoxf iatfmtr nes;t t2xoxm3io4op nmfvs t) Drm(mpoo4oeenif3tldfmDumu p (0artoxfctytfp  lnvols t2uoxo3oy4ap nmfei s) 2uru ont1opx mo3iytfs ra(vp;t) rtomf3iytlmt anvs;()seumxopnydolt livtas aDtrx  ;u1oexoifctldla el(mo;u4areoifcio1fa   uei s) 2toxo iu1amtnmnvslt  rrrxmonu4olxomoeils a2rl(vp;t0areniocoodoatrlnvi;() 2ur(m nudop elnet ( sDumxrp;o1tpe  i3iasfm emu s;(4trtrmr iytla e i il(0trum(m nydlptnlivtl(  2rm( pnu1tlxoii3iadfmDrm( on(4texnxfciotlptr i o s trxrxrpou4op e ieiatfa2uru onu4apx ifeiltlmDuanmonu0tltrmo3oa1fatr n i;s s2umiopiy1op n fesltf rururpot1apxoii3iytlm rlums u4trxoxrcty1fpDrlneil() rxo(mpoy1op elnetasf Dua(mpnu4tlt iiciatlm2ea( ont0trtnxocoa1faDranvi t0t2uoiopno1lm n icsa(fsrumu  ;u4oleomiciytlmDumu o;()arerxocto1latr ivi s)texo(mpoy4am  mfes sf Dtmx pno0tpe mi3ils a2rmnmon()aetomfcoo1op  auvs t  eurio3iu4amtelfctlt) 2rrumpno0apt iietydfa2umnms;u0artrxo3iodfm elivi;s seto(opiydom nlncsls sDumxm no0aptoiociyd s rmnms t4artnxfcoy1lmD luvol()srtmxopno1olenmfvsls)srumxmpnu0apxomi3iysfaDumnvp;t0 etrxr ta1lat li sls  2xrir nodol  liet (faDrrx ont4apto ieiad aDulnms (0tlenmr3iodfmDeaieo t)sexrio ou1lleelivtat a2tm( o;o4aleomfetldlm2ulu p u)arxoxo3iodlaDeauvo;s0sexoxr3iydame  fvsltfsDurxrp;t0tptn ieiltfmDrau p t)tetrmf iydfmD  i ilt)tetr(opoo1lltnlictat  Dra(m nt4oet ii3ildfm rlu ont0tlxoxrciadfa  li sl( sexmxo3nudlmtemnetl(fs2tmu ont0alxo fciytla ran o;t) ltomr oatlmDeanvo;t0trxoir ou4lp elfvi tfs2rrx o;o0oltoiieild sDelump t4 rtrir iy1fm e ivol( trum(m io4amtemici ()sDuaxr no1alto ietltfm2ua(vp;t)trtoxrcoa1fat liei;t0srtrir3iy4llenlfcil()sDraxmp;o0texnmoeils mDem(ms;t0arxrxf oydlmDeanvo;t) 2xoir3oydale miesat srrau o;o4tlxoio3iyt sDea(vs;u)aexrmo oodlptelueo;()trtoim3iy1ll e icslt  Dur(mo;t1texomf3tys a2ra( s;t)tlxnmr3ta1fpDe ivo;t) rxoxm nudlmtnlfet tfsDurxm oo1optniictlsfs2rl(vs;(0trxrxrcta1lmD  neol() rtoxmpiu1amtnmivt sf 2umur ;o1tptnmfeilt s2ua(vo;() rtnxrctotopD anvo;(  rxmim3iodlpt  ivta()aDtr( p;u0open f3iatfm2em(ms;u0artnio3tatoaDe uvs t  exmxm ny1olt  nei (fsrtr(r no1aexn i3iyt a uluvo;t) lxomr oadoatrlies;t0sexrir oy1op elfvsa(farrrx  nu0apeomf3iytfa2umn p;u0artnxr io1fmt  ieo s)t2urirpno4al  livt ( srrr( pno1openiietlt m2ua(mp (4aexriociy1lateaivslt  exoxopiudomenlfvilt a2urxmo;u0tlto ietysfmDumnmp;u)trerxr3oytopDe uei;t t2to(rpiy1opee nci (fa2rax pou0aleo ietyd aDean s (4 rxoxr tatfpD  iei;( srtoxr3nu1lmeemictlsfaDraumpno4aex if3iytfs umumpnu0texriocoytoateluvs;s trxrir3oo4om emfcia(f Durxmo;o1tlxnif3iytls em(mon()trxrmfctodoaDe nvi ()s2tmxo3oo1ope  ivs (fsrrmum oo4tlt if3ilt s rl(mpnu0 reniociodfmD lu sls0teto(m3nodolen ieslt)sruaurpnt0texn o3iyd m2rm(vp;t0aeenmr3totfat ln s;(0seumir3iy4ll nlictls  Duaumo;t0opxnio3tadfm eauvs u) rxnmrcta1opteai s;t  ruoio3oo1op   fviatfa2tmxrp;o0oet  i3iltfmDemuvo (4aeeoxo tadfate uvi;s0 rtrxopnydap e fvslt) 2umxmpot0aex mfciaslmDelu p ()arxoirctadoatelieo;( trtmxmpiodoltnmfctl(fsrurumont4tleniieiytfs2ra(vont0 ltrxf3todomDe n s t) 2uoim3io4lpe micslsfarrmx p;o0tleomo3iad a2ranmo u) exnxfciatfm eanvs;()srtr(mpiodapenmfviltfsDtrumono4olen ieiad sDrm(von(0aexrxr3iotfmtelneo s) 2xoxm3iu4ape  fcs tfaDumxmpnt1oltnmi3iadlsDrm(mo u)tlerir3tytoaD lueo;t) 2toim ou1opeemict sf 2urxrpnt1alxo ictyt m2ra(vsn(0tetomr3oodlpD li sl(0trxrimpnudlmtn nvsa()a2rax o;o0oex iociltfm2ranvo (0areriocty1laD  ivo (  2uoio ou4op   nvil() 2uaump;u4tee iociysfm2em( s;t4 leoxrciotlaDeaiei t  ruoxm ou4amt micia( aDrmxr no1tltnii3ildfa2uanmo;u)trtrmf oa1lpDrai i;( srto(r3ny1ol eliet sf ruru poo1aex  fctytfm ea(vonu0 ltrir3oy1oaDrauvo (0s2trxo iu4lmenlfviatf rrmxr ;t4oex  feiasla2ul( sn(0tlxnmo iatfp  auvi;( srurxm iydam emfeta( s2rmxmoou1altnmoctadfa rauvsn() rermociodla r neol() 2uo(r3oy4om nmicta()srtrxm ;o1aetoii3ilsla uan s u0alxnxr to1lpDr u s t0 rtrim3oy1ol e fcslsfa2rrxr oo1tlxniocias s2ea(monu4 lxnxfcio1fmDe u s t0s2xo(opno4al emicta( s2urur ;o1oex  oeild s2ea(vpnt4 rtrxr3oo1la e u ils0tetmim3iodamtn nct () rrmumonu1tet mieildlm2emn p u0altoxf iy1fm  aneo;s0texriopno1ol nlfetasf 2rax onu4tetoif3tls a ra(ms u4 leoxo tydlpDraieolt trtm(mpoy4ll n fcs tfa2tmxront4alxo ociatfmDra(vp;t4alxrxr3io1fate nvo t0 exoxr3iu1lmt  fes t  2rrum nu1aeeomociad a uanmo t4tetrio ta1lpte i i;s seuo(m3no1olt mncils aDta(  oo1tleomi3iydls2umuvp;u4 ltoxociytlaD lies ()seto(opny1omenmfct tfaruaump;u4oleniicildlsDuluvpn(4 ltoxo3tydlp r u il( setoio nydlpt miet (fs2ua(mpot1aexo oetyd m ea( o (0arxomocoodlmte ues () rxoim3ou1omtn nvtlt)aDururonu0tetn ociatfa2uaums (0 ltnxfcoatlat lnei;s0 2xm(opoy1aleelnei sfa2ra(ront4optnifcilslaDra( pnt)aexoxfctatfmt anesls)trurxr3oydlmeelivs t) Dtmur oo0oetnioctatfm um(vo;t0 eenircia1omDeaivs;(0s2ur(m3iy1ol nmiet ( srta(rpnt0oexnmfcild a rmnvpnu)arenmrciydoa e ies;t seumxm nu4optelfcs t) Dtm(rooo4oexniiciltls2rmu o;(4trtrxf3iydop eaueilt0t2ur(m oo4ope mietasf Duax p;o1tpx  o3tyt s emnvo u4altrmfcoytoa r n olt0 ruoxo oudome lfvsat s2urxrpou0aexo icils s rluvs;u0aleomrciadoatr nvi;t0 2uoxopio1amtelfct ( aDrr(r nu1optomf3tytlm ean o;(4 exrxo oytomDelues;t  etmxr ny4ll  lnvs ( srrru  oo0olxnioctlsfmDean s;t) lenif ia1lp rlu sl() etm(m oydlm nmieiltf 2tmx o;o4tptoioeiyt s ua(vs t4alxnxf3iytlat aneilt)sruoxm3iu1ap  lfei () 2tmuroou1tetnmf3iltfa um( snu) rxnxr3oo1fmte uvo ( setoxr3io4olen ncslsfaDrmxrono4teeomfciasfs2um( p;u4tetrmr3to1faD au ols0s2ur(mpiydlmtemivt ()s2tm(r nu1tpt ifeiyt aDrm(mpnt)tleoiociadfp   nvi;s)sexm(m3no1ap elfcta(fa2ur(mpno1tpenifeildfm rmnmp ()tlerxr tydoatr nes t0truoir nudapt  fvsls)srum(r nt4tlt mieilt aDrlnms;()teenir todlateluei;( teuoiopnu4lptnlncta(  Drr(mono0olen f3tldlmDra(mpnu4artnif oadoaDr nei t0 rtmir3oudllt  neil(f 2ua( ont1apeomoeiyt m elnvp t0tltrxfctotoateli sls t2to(opnu4amtnlnctatfaDrmxrpnt1aexniociatls2elu sn(0areoxf tydlateauvsl()sexo(opny1lme mfes () 2tmuroou0oee mi3iasla2el(vpnu0altrifcootfpDeanes t0s2xoir3nydoptnmfvt sfsDrmx o;o0tpto fetat m2ulnvpnu)alermf iodfaD aueo;s0 2urim3ou1op   nviasfa2rr(  oo1apenmfciyd a2eluvsn(0tlxrxf3oa1fm r uvs;s)s2xmiopnu4ll emncils  ruax pno1opt iociltfsDrlu o;u)teermociy1oa eauesl( t2toir3iu1am nmnvi ()sDtrurp;o0ape mi3ilt m2rmuvs;t0treomfcta1om r neo t0t2ur(m io1lpt mfcil(  rtm(rpnt4tex mo3iadfa2elu pnt) ltrxr3tydopD  ueo;() rurxrpou4aptn ivtas  2ta(mpno1olxn fetls m elu o (4texoio3oydoatelu s;s)t2uoir3no1olen ncslt) Duaxr nt0texnmoeiatfm2uanmp;(4tlenir oytlmt  i sl(  rtoxo3iu1am  lncias)sDraurp;o1oetn feiydfaDul(msn(0treomo tydomD li o s0 etoir iy4lpt mfesa( sDtm(mpnt1tlxo octysfm ra(vo u0trxnif3oa1op raieslt0 2urxo3oudomte nvsat) rtm( ono0olt  fciysls2elumpnt4trtoxf3ia1oat aies;()teum(opoudlpte nctl()aDrruront1opeo ieiyt sDrm( o u0teerif oy1la ranes t0 2trxmpoy4om emiviat a2tru pno4opt mo3ilt s2uluvsn(4alxrmfcio1fp e u sl( t2urxopoo1optnlfctas  Dtrur nt0teen o3iad m2ranvpnt0aeeomo3tydoateanei;s s2um(o3ny4lpenmfesat)a2ta(rp;o4opxniieiyd m uaumo t4 exrxr3oy1fm   ivi s trxm(r oudopte iviat s2trxr ;u4oltnifciltls rauvo;t0 etrmr iodfptrlues;()seum(mpnodom nmfciatf rrm(mo;u1altoiieiydlaDuaumo;t4tltrmrcootfaDelieo ()s2xm(r3iy1lp n netl( sDumxrpot0oltoii3tas s2rmnvpnu0aexoio iotfpD lneo;()teumxo3io4op  mfes s arumur ;t1aexoifeiad m2emu snu4 rtomrcoo1la e ivi;t srxrimpio4olt mici ( aDrr(m oo1tpe io3ils s eau o t0tlxnif3iotfp elies s t2tm(opny4aleemieiat aDrrxm ;t4aexn f3iasla umnvs;t4tleoir3iodlm r n ol( srumxr3nodoltelivta()srum(mo;t1tleoifetadls uanvsnt) renmo3iytlm r neslt seumxrpiu4omtnlfviltfsDuauronu1tpx  feiytlaDul(vonu)tlxnmo tatlmD lnes t srtmirpoo4amtnlfeia()aDra(r nu0olxnmf3tlsfaDumn s (4artnir3iodfptr ieils  2xrimpny1amtnmfcs (faDta(mp;u0tetomicilslmDelu o;(0arxrxociydlat  ieo;s trtoim3nudalenmnetatfs2rrur oo1tlx ifeiytlm2umumo;t0aexrmo io1fm raies;() rum(o oudll nmfcta( aDra(mont0alen fetyd sDuan ont) lenmf tydom ran ols teto(rpny1amt  ncsl(  Drmxm no4olx mfetyt a rlnmo;t4 ltoir3iatlmD ln o;(  exr(mpou1apte icsasf Drr(rp;t1alxnmiciytfm2uauvpn(0 rtrir3tatlpDrln i (0sruo(opiudam nlnvtat  2tmu pnu4aexo oeiytls2rm(vsnu)tlxrmf3oo1lp   iei t sruoim iodll elfvt s) 2rmx ont1aptnmo3tasfa2rlu o;() rtrio3tydla eanei t)t2tr(m3nodlm e nvtasfartm(m oo0apt  f3iasfs emnmp;t0tlerxr oydop rau s;(0 ruoimpnu1alee fet t  Dumx ooo4opeomocild a ulnmo (4 rtrxr oatom eaueo s0 eum(m3oo4aptnlicta( srur( oou1oet  f3tldlsDuanmo t0 exnir oy1fmt aiesls srxrxopou4lle  ivsa(fsDtmxmo;u1oet  f3tasla ul( p u0trtnmf oydfmDelivil(  rtrio3iudameemfvs ( a2raxmp;u1aex ifctas a2umump t)tlermo oadoa r ueils sruo(rpny4openmnvtas  2ur(m nt1tlxn fctld s2emuvon(0 exnxf3ty1oa  lnei s t2trxr nodolt  nvilsf 2tru  nu1teto octlsla uaumpnt)tlxomr oatopD  uvi t seumir ny4lpen fesl(f rra(r ou1apx  fciadfs rl(msnu) lxnxo3ty1fm eaivol()t2tmim oy1ll n fes sfsrtrx pnt0olto ictldfa rl( s;t)tetnxfcto1fpD an ols  eurxo3iy1lltn ncsatfs2tmxmp;u1tee  ictas mDul(vs;()aeeomo oydopt lu s;t0 2xmiopny1apeelies (faDtmxrooo0tpxnmoetlsfsDua( s t0trxoxrcoadoptr n i t0trxoimpnudop e iei t s2ra(rpno4tlxn fciytfa ulu o t0artrxfciodlmD luvilt)trxriopnudll nlneiatfa2umu ooo1opeo ociytla ran p u0aexnxr3todlpDeaivo;t)seum(mpio1oltn ieil(  rrmxmpnu1aeeo octys mDranvpn(4treoircoadlpt  ivo;s t2ur(opnudaleemnctat  rum(r ot0apeoifciatfmDrauvp t)tlxnxociy1lmt au slt)srxoxm3iu4lm e feiatf rumxm ;u1apxoiiciltfmDua( o u0 rtomf3ty1omD  uvs () rxoxm3no1lmtnlfeils srtr(m ou1alx ii3tltfs2ulumo;(4trenmfctadfaDeaies (0tetr(rpou4op  livtlt  rrm(  oo4oetoif3iydfa2rl(mon()tetoio iotla e u s;( trxrxm3ou1op  mfesltfa2ta(rp;o4alx mf3iatfmDum(mo u4tlxnir tydfpDrln s;s)srto(opiodol nmnei t  2trxroot1aexomfetysfmDrau o t)arxrir3tydlpDrauvi ( trxr(m oo4openmfcs s) Dtm(r nt1olx ioeiysfm eauvs (4 ltnxocoa1fat aueilt setm(mpiudlmee ivia() rraurono4alxoiociydfs2el(vs;t)artnxr3oy1lpt au o;s0setoxopny1ol emivsls) rraxmonu0olxomicild mDumu s;u)tetnmo iy1lpD aivs;s s2tr(mpou1lmt  fct t)a2rru o;u1tpeomfctld s rlu ont0 eerxr to1lm r u ol(  etrir3oy4amtnlnei s)srurxm no1aeeo o3iatfm ea( s;u0trxomocoy1fpD liei;s0 euoxr3nu4opt livslt s2trx onu4ale  ocils a2rmnmon(0altoir todoaDeliei s  exoxm3no4ope lnvsa( srtrx p;u0oetomf3tatlm2ul( snt) exoxo3oy1laD an ol()s2toxm no1ale  ics s)a2tau ont4aexomoeiyt a emn s;u) exrxf3tydoat aivsls)t2umimpou4optn fci (f rtrump;u1tpxomoctasfa2rm( snt)alxrxrciatomt luei;()srtoirpnydopenlneia( aDurx p;u0oetnmociysfa uaump;(0artrmo oy1la rlivo ( s2tmxo3oydopte fvtls)sDta(ro;u4tee mo3tlslmDrm(mo;u)aeerioctytoaD ln i;s0setm(o3iu1lltelivs sfartrxmpno0tle ifctls m umn snt)tleoxfctotlaD aivi;( sexoir iy1opt  fctl()s2ra(rpoo0tpxomfciadla2elnmo;t0 etoircoo1lat lnvslt)texr(o iu1lmtemnvslt sruauront1alxniiciytlaDeluvo;u4arxnxr3oatlmDranes;s srtm(m3oydlmte fetlsfarra(mo;u1tet iieiytlm2ul(ms;t0 ltrmf3oadfmDr ivi;(  exm(rpny4lpt mnvilsf ruax  nu1alx  ietadlaDra(mp;() rxrxr oadlptraivsl(0srumxm oy1lm elnesl(faDra(moou0olt iieildfm ran p;(0 etrxoctodlm e u o (0 exm(r3iodal  mfctl(f rtmurpnu4aleoiicildfs emnmp ()aetrxr3iodomtrluvo;( s2um(o nu4ap  mncilsfsDtruronu4tlxniietlsfsDum(mo t4tleoir3tadlmtrauvs;t trur(rpnu4lp e fei tfa2ua(mpnu0olt mocilslm uluvsnu)trxomo3tydla   nes;()setoimpoo4omenmictat)sruax p;t0opxnmi3iatla ean s u0arxnxociatfmte i il(0trtm(o nudale  ictl(fa2urxro;u1oleoiociatfm2el( s t) leoif3todlpt lnvols)srur(opoodlptn iviat sDrm(rono0texoifcils s2rmuvo;t0altrifcoydlpDe nvsl(0 etr(o iu4omee ivia(faDumum nu4alt ioetyt m uanmpnt4 rxoif oo1fp  ai il(  euo(mpiy4am nmicsls)s2ururpno4tlxo octysls2ea(vonu4tetnircoa1faD ai i;t0t2xrxmpnodole lfvi t s2ta(m no1ope ioetytlmDean pnu0arenifciodoaDrluvols seuoir ny1amtnlfvia( s2urxmp;o1oeeo i3ildlmDuau o;t0tlxomf3oy1fp r i s s0tetmxo3nu4op elfcs s)a2umxr ou0aetomociyslm2el(mon(0artnif oo1fpteauvo;s  euoirpoodlmeelfcs tf ruaur ou1apto icilsfmDrmump;t0tlxnmo tydfm rlneols  ruoir iy4ope lictat)aDuaump;t1olx  octldlm uanvo;() rxrmfciotop  lu i;()trtm(m no1al  micslsfs2umxrooo4tpt  fetadfa2umums t)trtrir3iadfatraivo;t) euo(o ou4llen fetls)arrmxmooo1alxoio3iys mDeaump;u4texoir oadfpDrlneols)t2tr(rpiy1amtelfci t) 2uaxroou4aptn octysfs rlnvp;(4trtoirciydlmDr n i;t0 rumimpnu4ope micsa()a2uru  no1aleomietatfa ea( s;t)altnmrcty1fp rlueil()trtmio3oy1ll n iesatfs2umu pnt4oetoifeiysfm2el(vp t0teenmr oodoaD aieo (  2tmim3iudom   ivsls  rtau pou4aptoioctltfa ul( p (4tetnxr3todopDr ivi s srto(m3iy1oltnlietat) Dtmxm oo0tpeoiocilt m2em(monu4aexoir totoaD lueilt)texrirpoydap nmfeils aDtmxrpoo4texomo3ias a uanvo;(4trtnmfcoa1faD aivo;(  ruo(opnu1aptemncia(  2tmuronu4teeomfcild sDea(vo;t0aeermr to1fp  lnesls)s2uoxm3iy1ol  lnci ( aDumxmo;t1tle  o3iatfsDrl( s;(0aexoio oa1oatrln olt)srurio iu1oltnlfesl( s2raxr ;u0tpx  ictysfa rmn s;()tltomr oytoaDrau i s)teur(o3iudol  lnetltf 2ua(ro;u0alxoifciytla ranvp u4tlxnxo3oa1fa rauvsl(0 exmirpiy4lpee nvta()sDrmumono1tee  ieiatfaDuauvp;u)tetrxfcoadfpD luvo t0 rurxm ny1altnlivslsfsrrru ont1tptoifcilt s elump;t) renxrcty1fmtrluvil( srtoimpio1lle mfctls aDua(mpnu4tpxnmiciatfa umuvpnt0 reoif3io1lp  aueilt) rumio iu4opt mncs s srrmxmpnt1aexn ietltfs um(mo t)trxnxfcoydopteaueo;t0t2um(r ny1ole lfcsas)s2urx  ;u0teenioctatlsDem( o (0tlxomf to1fptrluvo () rumxopiy4alt lfvi ( s2rm(r no1tet ii3iyt s2um(mo;(0 etomf3todfpDrlivs t  rxoxmpnydomeelfvia( srtmur ot4openiicild m2rau o;(4 rerxfciotopDr i ol(0srtr(rpnu4llt lnes (fsrrrx pou4oex  ocilsfa el( o;t)trenmf iatlmtr i s t0trxo(m3oydlm  lfcilt sDrr( oot0ope io3iyd mDemnvon()tlerxf io1la e ieo t texoxm3io4altnmictat  rrrump;o0apxn ictasla el( snu4 rtrmrcoatlaDeau o;s0 rxo(m iydlltnmiesas) rra(m nt1aet  fcild a ra( s (0 ltoiociytfat an olt t2xmxr3oy1olt  neiltfa2raxro;u4alx  i3taslsDulump t0trxrxfciotfm rlivi t)s2um(rpoodamen netltfsDurxmpno4tpt  ociadlm2eanmp;t)alxoif3iy1la rln ols srtrxopnu1lpt mictltfaDrr(r ;t1tltoii3ilsls rl(mon() ltrmf ia1faDrlnei;(0s2tmxr3ou4lp n fvsltf Drrx poo1tpe io3iatfmDulnmp (0altrxf3iy1fmDelueol(0texr(rpnydaleemivt tfsrrru  no0alt mi3tat sDra(mo u)tlermf3iy1lptrlueils)setrxo3nu4amtn nesas)aruaumono0alx  ictytlaDrln o;(4tlxoxfcoadomDr u slt0 2xo(r iydap nlieils  Drrur ;u4tpto feiys m2emn snu4 reniociytlaDe u sls  2xoxm oy4oltemfvt ()sDurur oo4opeo f3ilsfs2ulnvon()trxrmrciydfmDr i i;s0sexrio3no4om n fctltf Drrur nu0tee  f3iasfa2umu o;() lerxo3ootop   uvs () exo(o oudlmtnlfci sfartrurpno1aetniicils a2elump (0 reoxocoy1om e ivi;()seuoim oo4opeelivtlt) Duau o;u4oex  o3iasfm ulumo (0aleoxocto1lp   nvo;t) 2xrirpoo1omtn nvs s) 2rr( pot0tpenmf3tadla2rl(mont0altrmocoa1fa   iei;()trxmirpnu4lme  fet t)srrmurpno1aex  ocild aDrm(mpn() etnmr3iadomD lieil( trxoir3nodol n nei t sruaum ou0oexn iciltfm2raums (0trtnmf oodfaDran s (0setr(r iy4apt mnvs tfs2rr(ront1olt ioctysfa rl( s;u)aeeomfciodfptrluvo s0sexrxopiu4lptelies ()aDtau  ;t1aex  o3tysla ranmo u)trtnirciotomD lu s;s0setm(o oy1omenlfeilsf 2rmur nt1oleomoctad m2rlnvs;u)aexrmo3iatfa rli sl( tetrim3ny1ape lieta(fsrua(moot1tptnmfeiyd mDumump;t4aetrioctadlpD lueo t0teto(m3nodome  iesas)aDrmu pnu0tle  ociytlmDrlu on(4teenxocoytlpteaivs s  etr(mpno4ame  fvs ()s2tmurp;o0apeoif3iyt sDrau o u4aleoxf3oydfmt auvo s) eurxmpoudlm elnvsas)srur(rpnt1tpenioctat m rauvo;u)texomo iatomDr ieslt0sexmio3iydll e fct ()a2trxrp;o4olt ii3ildlsDranmp t4 exoifciytlat anvil(0 2xr(o iy1ll emiet t sruau ono0tpeo f3tltla2elu p u4alxnxo iatlaDelivs;t0srur(m iydlme mnesat) Duru  ;o4optomocilsfmDel( onu4artnio3iadfptrli ils0 2tmiopnydaltnmnvta( sDrmxrp;o4teen oetlsfa2ulnmsn(4trtrmoctadom e nes t)t2uoxrpiy1ale  fci s)s2raxr ;u4oetn o3ilslsDum(vs;() exrxf3oodomtelieils  rtrxr oudlpeemivtltfs2rr( p;u0aeto fetlsls ra( snt4 ltoiocoatfp  lneil(  2xrxmpny4ope mieslt  rra(ro;u4aeeniieiyd a ulu s t0tetoiocoytfatelu s s setoir iu1aptn ivtat) Dtr(r ot0alxnii3iyt sDrauvo;u4arxrio oydfpt lnes (0 rtmxm iy4op emietlt srua(  nt4tlx  oeiytfsDra(msn()tetnxr3to1opD anvilt  2uoxr3ny4ope lnvtl()srur(mpnu4olenif3ilt m2emuvont0 etnmr iytopt livi ( s2urxopiu1optemnetat a2urxmpno0tpxo i3tlsla2uln pnt4trxoio3iytlp rau sl( truo(o3io4aptnmiesas)s2raxrp;t1tlxo o3ilt s eanmo u4aexrir ootoa  lueslt  2tmxo3oo1opte icsl( arumxmp;t1opxo fctadla2um( s t)tlxnifctotfpt  nei ( s2tm(m iu1al  mfvilsfsrra( pnu1apx  fciysls rln sn(0alxoxrcty1fate ueo;(0seuo(opiodlp elfeta( aDtruroou0opxn fetltls el(mo ()tltomocootlp  au ilt trxoimpoudopenliesatf 2ta(rpou4tetoiieiatfs ua(ms t0 eerxr ta1lmDr neo t0 rtm(o3oodamtnlfei sfaDtm(r ot1oeto oetlsls2rmumo;()aeeoioctotfate u o t)sruo(rpny4omt mfesa( a2ta(ront4oltomietaslm2raumsnt0 renmr3iotfmt lnesl( sexrio3oydlpeemivsls)artrxm no1tpenioctydfaDrmuvs (4 exrxocta1fat li s s0t2tmxr io1ole  ncils  Dra( p;o0olxniicilsfs rmums;(0 exrmo3iy1la elivo;( trtrxo oudam n nvi (f 2ta(root1tpen i3tat a2rmnvp;(0tlermrciytfptrlnvolt srumxm3iy4amt  ivsasf rrmxmo;o0oetnio3tlsfm2eau o t0altnxo3totfp e ueo;() 2trxmpnu4amtelivt (f 2tm( ooo1tlx if3iytfm2ulnmp u)tltoiocoatfpDraivs;t)trxmxm iu1lpe lietat)sDtru poo0tltoiieils a2emu s;t)alerxo oy1opDeanvsl(0 2urimpiodaltn nctlt s2tau pnu1tltnio3iatfs2rau o t)altoirciadla eluvs;()s2urxmpou1oleemivilt  Drm(m ;t4texnmo3ildla2ulnmp;t0 etriocoy1fptran o;t sexr(o ou1apte iesat) Dtaxmoou1tltnifeiadlmDulnmon() exrmfcoatlpD aneolt  rxm(m iu1amt lncs s) Dururp;o0olxnmociydfs rlnvs;u4tlxoif oa1om elu il() 2xmxrpoy4lpenmivtlsfa2umxmonu1optomfctydlm ranvont4artoif3oy1lat luvs s)s2trxmpiodlp nmneils  rumu pnt0tptn ietydfm ranmpnu0altoxf iodoa  ln i;(0 2uoxopoydlme liet ( s2tm(  no4opxo i3tld sDumn o u) rxrir oatlmDr ivilt0trum(rpiu1alt mneilt)arrm(r ot4tetoiietls sDuau s;()aeeoio oodopt an i () rumxmpoy4am  mnvsltfsrrr(ronu4tpenifetlsfa ua(ms (4 lxrmo ootfmtrli il()t2to(o3nydapt mfvsas)srua(m ou4alx ioeias a2umu sn(0arxnifcoy1fmt  ivs s0teurxm3nu1ll nlnei s)a2tr( pnt1tpen fetysfs2rauvsnu0tltrxf iydoa rlu il(0 2tmimpiudameelfct s  2tmxrpoo4oex ioctyslaDrlu pn(4tlerir3tadoaDe i o;()s2urim3nudoleemfcsl( a2um(mont0oeto ociatlmDel(mpn()tlenxrcta1fa r nes;s)sruoxo iydll  mfeil() rraxr ou1apxomfciysfa2rl(vp t)aetrifcoydlm rau o s0s2uoxo3ny4al elfcsatf rrm(r ;u0tlxnioeildlsDrl(mo u0 eeoxocoydla ean o;t)t2xmio3io1ol emivsas  2trurooo1oexnmo3ild a ul( ont)aeeomf iydom rli o ()trxr(m oydapeemfcsatfa2ra( p;t4olxnio3iys m um( p t4trtoxf3tatfp e ueo;t seurxm3no4openlnctl(faDraumpou1oet moeiltfsDuanmp;t0tlxoio3iotlpteaivo;s)teurim3io4lle  iei tfsDumu pou1tpx  octys mDrmumpn(0altrxo3oa1la   neo (  exm(rpiu1lp n fctls)srrm(r ot0aet iictasls2eanvs;u0aexnmf3iatfptr i o t0 ruoio3oydal e fct tf Duaxmoou4aleniietydfm2ulums (4alenircoa1fmteauvs;(0setrxopiydolt  fct s s2ua( onu0tpt  iciyslm2rl( p;t0arxnxfcoo1laDe ivs s srtoxm3iy1altnmivi s s2rr(r ;o1olt iicild aDulums u) exrmo3iodfpDrau olt0s2xoiopiy4opt mncs t) 2ra(  ou1apxo ictatfs2em( p t4tlxrxf ia1laD  ivi;t) 2to(o3nydlm e fcslt)s2uaur nt0opx io3tydla2ra(mo;() ltomfctydoaDr uei;s0 rumir ny4ale  iesl( arrrurpot1oetomo3iat m2elumonu4 rtoxf oa1fa rai i t)sexoio iu1olt licias)artmumooo4tpeo iciasls rau s ()aeermr3tytfm   u ol()s2tr(o3ny1lmen fci (faDua(r ;t4tpxo i3tad a2ra(vo (0 rermo3iatoateau o;s0texm(mpnu1amen nvt ( artrumpoo4tptn i3iltfs uln p;u0 ltoio tytfmt  ivol(0sexoio nodoleelnvi (faruaump;t0tpeoio3tasfsDelump;u0areomf3oa1fa eln o s)srxrirpou1llenmfetl(  rta(rpoo1tlx mo3tad a2emuvo;t0trxrif3iy1fmtraivo;(0 2xmxr nu4ameemivil(  rrrxm ;o0altnmociasfs el( s u0alenif tytfmtranes t setmiopno1op   feiat) Dtaxrpou4alxomieiyd a2ul( p u4 leoifcoa1oa e ivol() 2umiopny1om nmncil( sDururonu4tle io3tltfs2ra(mo u0 exrmf tytopteai sl(0 rxo(r3no4ole micta( aDrax ont0teeo fciyt sDuau ont0 leoiocoa1fatraneslt) etmxr iydol nlfvs t)artaxmpou0aexn ocilt s2umnvo;u4aetnir3ty1laDraies;s  etoirpou1lmtemivi t a2uau pot4tltnifctas a2rmn onu)artnifcoadfmD lu s t tetm(m3nydlp nlnvsl(fsDtax onu1aex  fetydfaDua( s;t)artrmo3oadoptrauvsls)trxr(mpio1opee fct s)s2rr(mp;u1texoiietltfa emumo (4 ltriociytlp rauvi;() exmimpiy4om elieiat  rtmx pnu0apeo ieiadlm emu onu4alxoxo3oa1oa e nes;s0seur(mpio4lmenmneiatfarrmumo;t0tle iictld s2elnvo u4tltomf3oatop e u sls0 exo(r oodlmtnlivt (  Dta(r nu4opxnioctys m el(vo;t) etnxfctatlaDeln o;() exr(m ou1llt lnetasfa2uau  ou0texomf3iat m rmu snu) eenxo oy1omtrauvo s)srxoir3ou1lmen ncsls s2rrur ;u1ale ioetltfs2elumpnt0treoio3iadopteln sl()seur(o3iudop elfvtltfs2tmx p;o4ole ifciytfa elnmont) rtriocoodoa  an o;( truoimpou4apt livtlt sDurxr ou4apto octltls2emuvo;t0 rxoxocoydfp eanvo;t0srxm(m3ny4lm nlfvsa() Drr(rpnu4tpxnio3iytlm2rm(vo (0aeeriociatfp eai i s0srurio3io4op  lfetlt sDuax oot0tltomfciatfmDeanmp u0 rtoirctadlaDeluvols t2um(m iydll  licias  rumurpou4tlxoiieilsfm uanms;t0alxomf oadlmt luesl(0 exrim nu1opt licsas) Dta(  ;o1tlxnmfetydls um( p u0tlermo iydlp  liei t) eumiopnydlpe  fvtat)a2um(ro;u0tpxomocildfm2eanmsnt0 lxnxfctatoat ln ol(0srxmxmpny4lmee fct s) 2urxm ;u4tex  fetldlmDrmumsnt)aexrmf iatlpte uvi t0trto(o iy4ol nmfvt (fa2raxm nu0oexn f3tlsls ea(mon(4 rxoio to1lptrlnvols)t2urxr3oy1om n iviasfs2tm(mpot4tpto feilsfm el(vpnu0 lxoir io1fmDe ues s  ruo(o no4opt licslt) ruru o;u0ape mfeiyd s ulu snu0 lermf iatfp   nes s0 eumio3oudomenmiesa()sDta(m oo1aexnio3ils mDrmnmon()aeeomo tatfpDe i i;t truoxo iudll nlfctas a2rm(m nt0altniictld sDeanmo t0tleoxo oytlmD an s;t0 2umxr3oy1ap e nvias) Dtax ooo4tptnmoeiaslaDrmumo;u0 eenifciatom   i o;s) rxm(rpiu1ole mfvtl() Dtr(r ot1oet ifetatlm rm(msn()tetrio3totfat anvs;t  exriopny4lle lnes (f Dtmx oot1tex mfciys s eauvo;u) eeomr3tatfm eanes;s truoimpoo1lm nmiei ( s2rr( ooo4tltoifetadlm2el( p;u0aeenio ia1lmt livo (  2xrio oudlpen nvsls a2tm(  nt0apxoioctadfmDum( on()alxoifcoodlp rlieilt) rurxmpnu1oltemietl( s2urxro;o1oee mfciyslsDumu s t)tlermo3tydlaDrau i;t0 rxm(r iydll elnvta(fsrurumo;t4opxoii3iydfaDumuvo;u4 eenxrctodoatr uvolt0t2trim3iudlmeelfesl(f Drru pno1olxoifciytlmDumnms t)aeenmfcoy1la  an ol()srtmir3oo4lm  mictltfaDurumoou0oexo fctatlmDeluvp;(4 lxnir to1opt  ivils srtoxm nudlmt mfvsas  2umum ;o4opeoif3iytlm ra( o (0 rxnif ta1laD  i ilt trxm(mpno1amenmfcia(fsruaumo;t0tpx  feiltfaDrlnvp u4 exnircia1opDelnvilt0s2umim oydlpenmnvias aDraum ;t4teeomi3iydla2eanvp t0arxnmfctotfm  li ilt  rxoxopio1olen nvta(farur(mpnt1ale iociysfmDrau pnu) lenif3oatoa eln slt0tetr(rpoodlp   fvias)aruru ono1tleniicilslaDrmuvo u4aexnxfcoadoa raiei ( tetoxopoo4lm n ncil(  rraumo;t1texnmfciysla rlu o u)aexrioctotfmDr nei;s trxrxo oudolte iesl() rtmxm nt4aexomfctat a2rlnvs u0tlenxr3ia1late i sl(0trtoxo3nu1oleemnciasfs2umumo;t4tlx  o3iatfa2ra( o t4alerio iotlpte iei ( sexoir3oo4am e nvsas)a2tr(  ;t4tpt iicildfm um(vs u4tlermfcoydop  ai sl(0teur(opiu4om   fcilt  2ur( p;u4aexo fcildfsDrlumpn(0texrmf totlp eln o (0s2tmxo3iu1ap n iei tfa2rax o;u1altnmieiytlm eauvs t4tltnmr3oo1latean s s  eurirpoydlp emnvtls)s2ur( o;u0tlen o3tyslm ranmo;(0tltomo3to1fm e ieol()t2tmxo3oy1lm  lfct s) Draxro;u4tltomoeiltlm2ulu p t0aetomo ootlmDrauvi;t  rtoxr iu1lpeelicils a2trxr nt1tetnioeiytfmDuau snt4trtoio oytoaDr n o s0sruo(o io1omtelfvtls  2ra( pnt4oetn ociasfs2rlnms;(0aexoircio1laDeaiei;t)srtr(rpnu1apteliesatfsrrru p;u0oeto i3ildfm2em(mo ()aeenxo3iatfm r nvo;s0texmim no4op emfet sf Drmx  no1oleo ocildla um(vp t4altoxf iytfpD  neo s0srtr(m3io1aptnmfetls artaur ot1opxn iciysfaDem( onu)tltnmocoo1op rlueilt0 2umxr3no4omen ivil(  Dtmumpnt4oleniociat sDuan s t4teenirciytom e uvolt)t2xoxm3io4aleemnet s aruax o;t4alx if3tys sDemums;t)teeoio3tydlm r uvo;s trtoxr3ny1al nmneta() 2rru pou0tlxoio3iadlmDuauvo;u0alxnmo iytoaDe u ols) exrim oy4lm n ivt sfaDurxmo;t4olx mfciyt mDuanmonu0teerio3ootoptrlivo t)s2urxmpio4llt lfcias arur(m nu4optniiciad s um(vs ()tlxrir tatlat an s;s sexmim iy1alt mieiasfsrum( ono1aleoifetltlm2emn o u4aexoxf iodlmtranvi t) rxmiopno1lmt micta( srrrxrpno0opx iociydfmDua( o;u4arxomf oytlaD lueols) 2xoiopoo1am n netl() 2ta(m oo0teen oetatlm ra(vp;u4 renxf3ootopDeau ils) rur(m ou1omt  feiasfsrumump;u0tlt if3iytlm2eln on(0 eeoio ta1fm   ues;s)t2umimpnodlleelnvils)s2trxmooo0aexniietad m2eau pn()aetnmf iodfa eauei;t0seurxrpno1ope  fct ( aDraxmpoo1tlxnmi3iasfmDea( o t4 exomocta1opDrli s s  etmiopnodllte fctasf Draur oo1tlt  o3iysfmDum( o t0tleomrctatfpt aivslt)s2trimpoo4omen ivta(fs2rrxmpnt4tex mfciatfaDemumsnu0 rtomo3oytfpt luei s0srtm(opno4lm   feil( srraxrp;o0tpenioetat m rm(ms t4alenmocootfpt aivs;()trxrxrpno1op emnes ( srta( p;u0aetoii3iys m2umu p;u4trxnif3tadopD an o;s0 rtr(o3iudlp   ivslsf 2tm(rp;t0opxomf3tlslm2ulnmpn(0teenxf3iadfp rln i ( sexrxr3nodap n nei s)sDtaum ;t4aexomoctasfm2rmuvo;t)tltnmo3iotoaDeai ol()s2ur(o3oydll  lnct (fa2rru ont1opxnmoetlsla2rmu snt0tetnmrcoydoat  u ils setrim3oy4amt mfvi (f Dur(mo;o1oeeomo3tadla2elump (4aeeoxr3oa1lp elieils  2tmxo oo1aptnmfet t)srurur ot0olenmfctytlsDemnvpnu)trenmo3to1la  anvolt0srxrxr3nudlm nlivi tf 2urx pot1optn o3tyt s2umn o u4tleoircoatom raneslt srtoio ny1om  mivt t) 2ra(  ;t0apx mfcildls2eaumo;()alxrir3iytfp ran o;t setr(o nodol elivs t s2tmumoot4texo iciys a2eau p;t)tlerxf3ia1fptrai o;t)tetm(rpoo1am  lnes ()s2rrurono4openiictadfa2rmu s (4arerxrciytlmtrlu o ( t2uoir iy1opee ict ()a2umx  ou1tee mfeiltlsDra(vsnu4texomfciytfmDrli i;t teurir oudlmtnlnvtl()a2ta( pot1opto feiytls2rm(mo;() lerif3oatom  lu s (0 rumxo3iu1ole liet ( s2uau  ou0aeen oeiasfaDel(vont4aexrxoctatlpD liesl()s2trim nudamen ncilsfsrtm(  ;t0tptomi3tysfm umnmp;(4altnxocoadfp  li ols) etm(r io4ll n icil()arur(r oo0oee  ictls mDrmnvpn()aexoio io1fptranvs t srxm(o ou1al nlfvils srua( ont4opt  ieiad aDua( o t4arenxo3iotlmt luvo s)t2xmxm3iodomeemictlt) 2ua(ronu4alt if3tatla2uln s ()aexoxr oadomtrluvi;()teuo(r oydlm elivs t sDrr( ono4olxo iciytfs rl(vpnu)aeerirctotomtran i s0 2trirpiy1lmtnmnctls)s2ta(mo;u0apx ifetad mDeln s (0tltoxr ia1opDelivsls0s2ur(m nudlmtnlfcs ( a2ra(ro;o1oeeomieiasla umu o;(0 ltnifctotlptrln ils0sexm(opiu4lme lfei ()sruaxmpnu1apen fctydfs2rln ont)arerifciy1fatelneo t  2xo(o oo1amtn ncil( s2rmxr ou0olt mociatfmDrluvs t4 rtrxo oa1optean i (0tetrim iy4ll   ivslt s2ur(mooo4oleo i3iytfs ulu p;t) exnircoo1faDe n i t srur(opiy4lltnlfcsltfaruru  nt4oee iiciydls2ran s;u) lxnir3iytoaDrlueils  eum(m3io4oltelfesasfa2trxm nt1tleo ocias m2um(vs u)tltoxr3oy1laD  uei;(0 rtrxopnodamt lnviat)a2umu p;u1opeoif3ild a ran o;u0 ltoir3totopt au o ( srtr(m io1ale mfvt t) Draxrp;t4tltnifeild a2rlumonu4aetoxf3iadop e nvslt) ruoxopou1aleelfvs sfs2um(rpoo0aptnmoeiydls eanms (4trerir iy1opDe i i;()s2tmxopny4lp  micias) Drrx  ;t0tlxo oeiysfm2rl(vont) rxnxo3tatlat luvs (0s2umxr3ou1ame  fetlsf 2rmxmpoo1opx mfeiatlsDea(mp u)alenio3ootlmtrlu sl(0seurim3oy1lpt  net tfsrumxroot1ope  i3ildla ul( s;t0 rtomo iytlpt an slt)s2xr(opnodomte icsasfaDta(r no1oexoifeiasfmDulums;t4 etrxr3iytom ranvi;s s2uo(opoy4ome  fei s  Drmu  ;o1teeo ieiadfs rmu ont4 eerxr oytfp rlieil(  rtoxm nu1omee nvs s)sDua(r nu1tptoii3ildfs2rl( s;t4trenxocoadomte nvslt0s2xrxr3oo4opee iviltfarrrxm ;u4olto ictadfa2rm(vs;u)tlxoio3oo1fmt  i i (0 rxrxrpoy4ol  mieil(f 2urxmo;o0apxnifetls s rm( p;() ltnmo oa1om ran ilt) 2umxopou1olen fes t)a2uax ont0teen ictltfa2el(vo;u4aeeomo oydlaD aivi;(0teurir oo4omteliet t  Dtaxr ou0texnifetadfm rmnmp u0texoxo3iadlm eaieo t)sexrio3oy4omt  fct s sDumum ot0olt mieilsfm ea( o u) lxrmo totfm eluvi;t t2umxmpou4al nlnesasf Drru o;u0tltoif3iasla2rln p t)artrif3ootla   ivi;s) 2tr(r iy4ap  livsl(  rtaur ou4aet ii3tydlmDuan s;()tlenxfcoo1oa eai ils0 2toxr3iu1altnlfes t  rurumpnt0oet micildfm elu ont)aeeomr3totlmDranvols  exo(o3no4omt lncta( srtrxmont1oltnmietldfm ul(vs t4tetomf oadlpD  neol( srtr(rpiodlm   fvtl(  2rrumpot0teenifetlt mDea(mo t0 exrmo3oatoaDrli s;t0 2toim iu1apenmfcsatfsDumu onu0oeenmociytls ul(vs;u)artnio3tatfaDean i (0s2xm(mpoo4lmte ieia( sDrau ont4opt mf3tatfa2eluvs u0altniocoatlpDrln ilt0 eumxrpiy1ll nmicsatfsDrru  no0oeto i3iadfs2rm(vonu) exrmf3tatlpte uvol( teto(r nu1ll nlivi sfs2tm( p;u0tlxn ocias a emn s;t4artnxfciy1fmtrluvs s)srur(o3nu4am nlncilsfaDua( onu1tee  i3ilt s2ulu s t)trtrir3oy1lmDe ivs;(  2xoim nydol e ncsas)a2uau poo1apt moeilt aDeln p t)tlxnmo oytfaD  i s ()trumimpno1ll n ieta( a2trum ;u1tlxomictld m ulu snu) rtrir iotopte uesl( sruoiopnu4lltn fctl(fartmxmont0opeo i3iat s ulnmsnu4teerif3iy1oaDraneo;()srxm(r oydome  ncs t)srtax  ;t4aeen ociltfsDean o u4 etrxrcio1lpt  uvi;()t2uoiopnodlmtn nctat sDtmxr oo0olx iiciltfmDeau s t0 lxrmr iodfmD au ol() rxmir no4lm nmicias sDur(r ;u4tpe  oeiysfm um(vonu4 ltnxr3iadoptelu olt)srxoxrpiu1apt lfct tfaDum(ront1tpe mo3iydls ulu on()trxrxfcootlm eli ilt)t2trxr3oy1lpeemfvil(  Dtm(mpot1oetnii3tys m2ranvon(0alxrxo oydlpDelneilt)t2umxmpoydlptn ncilt)s2ra(m oo0tex  ocildfa rlnmo;t0 ltnio3iytfa  auvs;s) rtrir3nu1amtn fciat)srtmxmpou1aexnmfeild m2rmu on(0 rerxf iotop  an ilt0sexoiopoy4alenmfcilt aDumxmo;t1olx iocild m rl( p u4 ltoio iydfa e nei s) etmxrpiy1opeemnctas s2umxm ou0open o3iatfsDea( sn(4trtoxf todoate n i (0sexr(m iy1om emnctat s2rr( p;t0oet  fetltlm emump u0trtoxr3oatla  ai o t) rxmxo3iudopenlfvi sfarrrxrpnt0tlxoiocilsfa eluvsn(0aetrmf3totlp  aues;(0s2to(rpny4alt mfvi ()srrmu o;u4oeto f3iasfm umuvsn(0arenio3oadfmtr u s s0srtrxopnydale micsltf Duaum nu0aptoio3iyt m eanms (0trtomf tytomDrau sls0t2um(opny1amtelics t)a2ra( onu4oetniieildfm2elnvs;(0 renifcoytopDr uei s0 etmir3iydomeemieils)sDra(mo;o0oleoii3tadlm2ua( snu) etnif oytfaDraneo t srxm(opnodome micta()srrr( oou1oetn o3ildlm2rmums t0alermfcia1fpD livi t s2ur(rpoy4op nmics t) Drr(r ou4olenifeild a eluvsnt0aetnio3ty1fpDranvs t0srtr(r nu1apt mnesasfaDurxm ot4olxoifeiyslsDum( o t4aeeoir iydfatr nvs;()trum(r3nu1ll n ncslsf rta(  ;t1texn f3tytlm eanvp;(4alenxfcoatfaDelnesls0s2xmxm3oodllt  ieil(  Durxr nu0apx iieiyd m raump;(4aetrmo iodopDrluvi;( s2xrxm3ny4ap  mnvt ( sDuru ont1oltnmieiyslsDulnmp (4aetrif io1fateaiesl( srxmxo3iu4om e ies s srtrxm ot4aexnif3tld m2rmn s;u0 rtnif tytlaDe iei t  exriopnodlmt mivtlt  rtrx o;t4tpxoio3tydfs2rm(msn(0 rermrctadlpDrln s t  2toxm3iu1om nlfcs s srraur ;o1olt io3ilt a2elump t) eeomocty1lmDr ivs t0s2xoirpoodoltnlictls  2ua(moou0opeoio3tysls emn s;()alxrxr3tydop rlieilt)trur(m ny1ol  lfeilt a2urxr ot4aptn i3tydfmDeluvs;t0arenifcty1om  li o (0teuo(mpoy1lmenmfeta(fsDtr(mpot1teeoiocias a2ul(vp t4 lxrif3ootfaDr nvo;s) rxmxr3iu1ll nlfesltf 2ta(rpoo4oeto ociadla eanvsnu4aexoif ty1fpD li i;s0t2tr(opou1om  lncs s)arumx pno0alt  fciadlm2rmuvo u4 eenmf iytopD aneo (  2tmir io4lpt  ict tf 2ur(  ;o0tltoioeiyslsDrm(vp;u)aetrif ta1omD  ues ( srxrxrpny4ol e nctls)arrrump;o1olx mfciatla2ea(mpnu0artrmrctadfpDeli o;t0teuoxo3oudope  ivtl(  rra(  ou0oetomfciat mDraumont4tltrir to1fateluvi;(0seuoxmpoudope  fcs ( aDrrxrono4aptnmiciltfa uanvpn(4arenxr3iy1la rlu ol()t2tmio oydlm elicia() Durx ono1tetnmi3iltfa emn s (0trtniocoy1opt  i i () rxo(rpnydaptemiet ()a2tr(rooo4apxnif3iytlmDeau o;t0teenmf3ty1fmt aueo t0srtmxo3iy1ol nlfct s s2uaurp;u1texnif3ildfa ean p;()areomo3totfpt aies;s0sexmim3nydape  ncilt aDrrumpot4apxomieiadfs ulumonu4 etnxr3tytfpDeln o t  exmxm oydamenlicsas)aDumumo;u0altn o3iyslmDeluvs u0tetomr3ootfatrli slt  rxr(m3oo1ale  nvil()arua(ronu4opxomiciatlmDeaumo u0teeniociatop elieo t0t2xmirpiudllte ies tfaDtm(r ;t1apt  o3tatfs2rln pnu4tlenio iatfa  aiei;s)sruoxo3oy1lp nlfcilsf rur(moot4apxn ictas m2el( s t)arxnxf iytoaDranes s seuoxm3ou4ape  netat srrmu  ;o0alt mi3tltfmDemuvs t4teenxr totla eaneil( trxm(mpoudope  icta( aDua( pnu0opxnif3iaslsDrauvonu4alxoxr3oydlaDraieol() 2xoir3io4al  mivi ( sDuaum oo4tetn ieiys s rm(mo ()tlxoxf3iodopDe u ols)t2xrir io4altelics (f 2rmu  ou1tpe mfeiys a uan o;t)altnxo oa1lmDrai s s0sexo(o nodole lneslt)arraurp;t1aexoii3tls mDemu p t) etoiociadfaDeanvs;( setm(r3iu4lptnlies t) 2tax  ot4aeeoifeiytla2ran o t0 renircto1omt  n i s  2tmxm3io4apee fctlt s2urx ooo4alxo o3tls mDrau s;()texrif3oydomtelnei (0t2umxr3no4ap nmies (  Duaxm nu1tlx mocilt aDea(vp u4 eeomfcoatfp r nvi ()s2umxr nudamtnlnviasfaDrrxrooo0tpxo o3iaslm2eauvo;t0tlxoxo3tytoa  li o s0trtm(mpou4lmenmicta(faDumxmpou1texnioctydls2rmu onu0 renmo3ty1fp e uvo;()seurxopoudopeelicsl() ruaxmono0tpenii3iydfm2ua(mp;t0 exnmfctatlp rluvs s)t2xm(o oudlmtelncsltf rraumpnt1oleo ieiasfm2elu o;u4aexnmrcoy1fmte n sl( srumxrpny1ole miei tfaDtm(moot4tet  fcild a eln o;u) ltrio ta1lpte n i;t  rumio nodape mieilt sDuaxmpou0oex mfciadlaDumn p;t)altoxf3iydlp  anes;s0 ruo(opoy4ll n fcilt srrmum ;u1oex ioetysfm2ua(ms u0 lenio3ty1om r neol( texmir nodop   nvtlt aDtr( pnt4tpxoio3ias a2um( pnu)teenir iytomtraues;t  2toxmpio1om elnctltfsrtax p;t0apt ifeilsfsDra(ms (0aexoxf3io1lmDrau i ()s2um(o nu1amtelfcsas a2uaumonu1tptomociytfm rmumo u4 lermr3iodomDeln ols)seurir3oodopt  fctl( arurumpno1aleoiiciasfmDran onu0alxniociydomDean i;s t2toxo oudopte fvi ()s2tm(r nu4olen oetysfa emuvo u4 lxrxo3oy1oa eau sls)t2xmxm3ou1ome lfes s artaumpot0tpenmoeiydfaDua(vpnt4trxnio3tytlateai olt s2xm(m3ny4lp emfct tfs2umur ;u0aeeomociltls rm(ms;t0 rxnmfcoa1fm  auvi;()s2trirpny1lmeemiei s)s2tmumpnt4alto oetatfmDrl(vo u) eermf3oydfat  ues (0t2xrxo nodapenmnci tf 2umumonu0alt ii3iat mDrl(mpnu0altrmrctadlatrauvi ()tetoimpnu4llt lfesas)aDra( o;t1tltnifciatfa umump;t4aexnif tadoat anes t)srtmio3oo1ape mfesatfs2rrxrp;u0opt ifciadfaDeluvonu) eeoirciydlmDrlu s;s0 eumxo3oudam  mnvs t  rtm(ro;o1aetn i3iasfm2ea(monu4texoifcoa1oa rlueol()seurxm3oo1apen ivt ()arum(m ou1apxn i3iltls ua(vs;t0aeenio3ty1fm elivo t  rtoir3oy4amee fctas)arrrxmp;t1optnioctatfs uan o;() lxrxocoydfm e u o;s setmxo iy1aptn ncsls a2ururooo0tltn i3ilt s2ra(mo;()teenifctydoaDe nes ()seum(r3iu1lltnlfvtas) Dtaxmpot1apxoioeiyslm elumo (0texnmfctotfmDeaueslt)sexoimpnydllenlnet tfa2tau  ou0tetomf3iytls2el(vs (4areoxo3oatoa eau i ()t2toiopno4al emfetl( srtruroou0apx io3tlslm um(mpnt4trxnif3ootlp  livils) rurim iudlpt mfci sf Dtrum nu0tetomo3tldfmDemnmp;(0 exnxfcoodop r ieols0 exr(m3oy4olt mnci t) 2rrur nt4oex ioeiatla2el( p t4trtnmr oo1om e ivs s)tetr(o3oo4ope mnvtatfs2um(r ;t1tptniietyd sDrmn o (4tetnmo iatlmteauvs (0t2xoir3nodom emfesa(faDrrurpoo0tle ifeiad a ua(vpnt4aexrxf3ty1lpD livi;s0 exmxr io1al e ivtls  Dum( o;o0apxomo3ilsfa ran s () eermrciadlm rauvi;(0tetoxr ny1ol elncta(  2rmuroou0tltoifctldfm2el( pnu)tlenir totlm e i slt  etoim3iy1amenmfeil()aDtrumpou0oeenii3iyd m2rmumo;t0aetrmr3iydfa r u o;t) eumxr nu1open ivt t)s2rauroou0altnif3iasla ul(mon(0tltoirctatla  lnesls) eumiopio1lltelnciltfa2urxmp;u1tpenmf3iytfs2ra( s u)artrirciy1oa r i ils)trxo(o no1aptnlnvt t srraxro;t1opt mietydlsDumnvs u)arxoxo tatlp rau o;t teuoirpio4lmee fei (fsDrax o;t4optomi3iltfm rlump u0aexoxocto1lpDranvs s0srtrxo oo1ol n fctls arur(m ;o1tle  ociltfa2uln o u0aeeoxfciydlpt
\ No newline at end of file
@@ -0,0 +1 @@
+i i;t)t2uoir3oo4ope mnvt s aDtaurpno1opeo feiyd a um(ms u4trtnmr3todoa e neslt0s2tr(o3ny4lm e ieias) rtru p;o1apxn ociytfa2umn p u0 ltoxfctadlate ivo;t)t2uo(o3iy4apenlfvsa() rrrur ;u0tpeomf3iadfm2ra( p u)texnxociydfm  lues t sruoirpiudol nlfvt t  rtaxr no1tptoifeiydla uluvs;(4teenif3iotlmDeaivo s)t2umiopio1lmt  ivi tfsDtaxmono0apeo f3tytla2uln o (4 leomr3oy1fp  ai ol(0srxr(o io1am   nct s)arur(rp;o4apeniocilsfmDumn sn(4altnxr to1fm eanvi ( t2tr(o ou1lptelivs (faruaxrp;u0oetoioeild s2eln p u4 lxrxf3oodlptr uvs t0t2xr(mpnudop e nvtl()sDumurpoo1tex moetysfsDuanvo t0trtrxociytla eaivo (0 rur(r3nu4ale  ivtas)a2rr(mo;t4tptomoetasfmDraumo;t) renmrcoytopD lneo;(0t2xm(opiudll elnctlsf 2rm(  nu1aee  i3tlt m2el(vp;(0aeeoiociotlm e ivols0t2urxo oo4ol emncsatfs2rau  nt4aleomfeilslm ua(vp;t4trxrmocootfpDrlivs;(0s2tr(opnydomtn fcils) Dum(r ;t0apx iociyslm ulumo u4teeoiocoydfmDrlueo s t2toxo3nydape  feia(fsrrrxmpno1aeeomi3tlsfm2ulnmp;(4aetomr3ia1lpDeaivo t0trtrxo3nodopt lncil()a2uaxm ot0alxo ociadfaDrmuvo;t)aexriocoa1fp eauvs;s) exmxr3nu4am nlfvsl(fsDrr(m ou1opxnifeiatlm elnmo;t)texomf3ta1oateaues ( setmxo nu1altelfetlsfa2uaum nt0alxnio3iytlsDum(mp u4artoio tadla   uvs s0 rtm(rpiydll  lncsltfsrtr(rono0opt mfeilsfa2eaump (4 lerxo3ia1oat aueil(0teuoxr oo1amenmneil(farrrxrpnt4tpe  ieilt sDelumsnt)aeeoircoa1fmtraneolt0sexrim3iudll nmivias  Dta(  oo0ope  i3iasla emnmp (4 rermf oydoptraiesls t2tr(r3nudopeelfetasfs2taurpot4tet  o3tlsls elnvo;t0areomrciadopD  nei;s0 2uo(o nydomte nvsl( s2uax  ;t4tlt  f3ilsla emnvpn()aeenir3iydfa  livols seuriopoo1olenlivs sfa2umxroot0tex mo3iltfm el(vo u0 lenifcta1omDr n sls)t2xmim oudll emneil(fartmur ;o4tlxomictls mDemump t) rtoxr oodlpD  ivils t2umxm3ou4ol e fcsa()s2tm( p;t0apenifctldfsDrlnvs u) lermrcoatlaDr ivo;t0srtmim3nu1op e nvtlsf 2urx oot4tpxomi3iysls umnvs u0aexoir tatlaDe ivi ( tetriopoydaleelieilt  Dtmumono4ole  ociatfmDrauvs (4tlenmrcta1omDr neol()trtrimpoo4om n fcs tfarumum oo0tlen fcild sDra(ms u0tetomfciy1lpD aivi;s)trxr(m3oy1ll   nvs ()s2ra( oot1alxn ieildfmDuluvo u4aeeoxociy1opD  u il( truoxo3nudlptemnciatf rrmx p;o0teenmfeiyt s rlnvonu0arxoio3oadfmDeaues;t) exr(mpou1ol n ictl(  rtr(ront4ape ifctyd mDrl(vs () eermf totoaDrlnes t0t2urxo3iudlmeemivsl(fsDrax poo4tlt ioeildls um(vs;t0 eeoiocio1la  lues;(0 rto(mpnudlmtnlivsa(  rtm(mono4alen feiyd a2um( s;(0 rxnxr tatlm rln sls0 2uo(rpiydopenlivsls)aDrr(mp;o4teeoif3ild sDeanmonu)aeenxo3ty1laDr uei;() 2urir ou1ameelfcsas srrrx o;u4ale ii3tlt s ul(mo;(0texrmociydlaD aivs s  etoxr oo1om nlfctas) 2umum ou0alen i3tls s ulums (4tleoio oy1fatrlu o;s  euoxo3oo4olt lieilsfs2tmu  ;u0tlt  f3iltfsDul(mo (4aetnmo tadfatrai o;t) etrxo ny1lp  mnetatf 2um(m no4aeeomf3iltla2eanvsnt4aetnmo io1fmDrli il(0setrxrpiu4lltn ici t aDtm( pnt0olto ieiytlaDemnmon(4 eeoxo ia1fpDelnvsl()s2tmxr oudapte fct sf rur(r ot0oex iocils a el( o;() rxnio3oy1lptrlneols  rtoirpnu1al  mneslt)arta(r no0teen oeiyslsDuanvpnt0arxnxf3io1fpteauvi;s srxr(o3oo1lle  iesat)s2tru o;t4tlt iociasfmDrmnvonu)arxrifctytop eauvo;s0seuoir3no1ol  liesasf 2rmu pnu1tpen o3ildlm2umnvo;u4tetnir oa1lptr i i;()seurirpoydll  micsa( s2tr(roou0oleoifciad m2rmu on(4texoxr oy1fate ies s srtoxm oo1altnlivi t)a2rru  ot4aexo ocilsfa eauvo;t0tlxnmfcio1fmt lnvi;(  rur(opnu4olt  nct (  Dumxrpot4teto fciltlaDeauvo;t4aexrifctotoatrau ols tetrio oy4apenmictl( aDumxmpnt0ale  o3ilsls ea(ms u4 exnif oy1oa e ivo (0 rtrxmpnudll e ncs sf 2urur ;t1tpeo fciydla2elnms;(0arerirctydoa  livsl( t2urimpny1al elncsat a2ra(m ;t1alx mfeilt s ra(msnt)trxrmf iy1la rln i (0seumxopnodlptnmnvta(fa2tru oou4tpe mi3iytfaDem(vs u0 rtoif3ia1fa  aivils  rxo(rpiy4ame  fcta()aDtm( poo4tle mieildlmDum(mo (0aexrxo ty1lat luvo s t2toxo3iydopt  netatf Dtr(mo;u0oeto i3iytls rmuvs;u)teeoxr3oodfmteanvsls0 rxrim iu4al n iet sfsDtaumpot4optniietatfa2ul( s;u4arxrxo tydfmDrlnei;t0 exoimpnu1ol e ncsa(  Dtmxm oo4tpeomo3iytlmDrl( on()tlerir iadfmtrauvs t)seuoxo3no1om elivs sfsDta(r ;o4aetoifeils mDran pn()tleoif oy1omtelnvs s  rxoxmpiy1omtn fvtl(  2rrxroot4apeoif3ilt aDrl(vo u0 lxoio3iydlate neols)setoxo3ny4opeemnciat) rurum nt1teeoioctytfs um(vo u0teeoxo totlm  luvo s seuo(m3oy1ape  icsls  2ua(r nu4ape  oetyslsDrmuvpnu) lerif3oy1om eaueil(  exr(opnydop   nvtasfa2taumonu1tltomieiltfs2ulu snt)tlenxo3to1op rliei;(0t2tr(m no1om  mnei s)arta(mp;o4tpxn i3tlsla rlu snt0 rtrmo tadlaD an ils) rtmxm3nodal nlfcia(fsruru  ;t0tpe mfetadfa rlnms t4tlxoxocoy1fm e neslt)t2xrir iudal n iviasf Duaumoot4apxnio3iatfs emnvonu4areoxf ty1op r i olt0setrxopnodlm  lnvt () Dumu  oo0optomf3tys s emu s (0tlerxocoy1oa e ueil()t2to(r3oo4ole  ictat)arrm( p;u1altnmieild s rm(mp;(4 rxrmo3iy1fptr ueslt s2xm(r oydlmee ivias)a2rr(monu1tee mo3iyd m2ea(vsnu)aeenxf to1lp rli s s sexm(mpnu1lle mfvsl(  Dra(ro;o0apxn icils s2eluvpnt4tltnif3oo1lp  lnes (0 etrir3iodlpt mfcs tf Draxrpnu1texoii3iadfaDelnmp () ltrmociodlmDrlivi;t teuoxm3oy4llee nvs t)a2um(m ;t0alx mociatlm raump;(0aeeomrcoydfptraivi s)t2uoir3iu4lpt mieias sDtrx poo1altnioetld s elnmpn(0treoxo tadlm rlu i;t) etoim3io1ope  nci tfs2taumoot1oet ii3tytfaDelnms;t)alenxo ootoaDr ivs ()trxrxrpoy1open ivtlt)a2tm(rooo0tpt miciltlm2elnvp u4teeoir iytlpteanvi;()s2xmxm3oudomt  fesa()sDrmurpno4tet ifeildlaDelump;(4alxnircoy1oaDrauvo s0 2xm(rpiy1lmenmnviasfsrrrxmpou4teenmicild sDuan s (0aexnmf3todlmDr uvi;()s2urxo3oodlm   nei ()srtau pnu4olxnmictlsfmDrmnvo;t4 etrir3iytoaDrauvolt0trtrxm nu4lptnmfciltfsDtr(r nu4oexniociltfs2ulump;u) eerxr3oatlmD lies;s0srurxopnu4om  lict ( aruru  nt4tlt mieilsla eauvp (4arxnif iydlmtrai ilt s2xm(o oo4lpeemictl( artauronu0ope  ociydls eau onu0tlerifcty1lp  au ilt  rxrim3oy1omtnmnvt sfartrurpou1olenmfeiatls2elump;u0texrmr3tatoptr i ilt0 exm(mpoudlpte nvslt  rtaxr ;t1open f3tydfa ulnmo;u0 rtoxr oadomtrai ilt0srumxr3oy4ol emnvsltf rraxmoou0tlt ioeiad m2rl(ms;(0alxomociotfm  aivs s)s2tmxr iudomte ivtat) rur(m nt0apto icilt s2rlnmp;t0 rtnifctytoate i s (0 2trir nudlpte fet t  rraumpno1tlx ioctydfaDrmnmp t0 etnxo3ia1oaDranei t)srtrir3iu1alte ictasfsruaxrono1oeeo o3tydlm el( ont4 rxriociodfaDrluvo;t0 exm(r oodlptn fes ( aDtmxrpnu1ole  i3iltfaDelumont) exrircta1op rlnvs;t tetoimpoudlmtelfes s sDrau onu0opeo i3tls mDuauvp (4artoxr3iatlaDraivo () euoxr3oy1op nmnvsls sDrmxrp;o4opeo o3ild sDua(vs u4 rtrmf3io1om   ivs;s0t2xrio iu1lm n nvtls aDra(r ot0apxn ietlt aDrmnmo;u)alxrmo3oa1lm eanvi;s0t2to(mpoo1ape mivsl(fs2ua(mpoo1oeeoiiciad sDum( o t0 etrir3totop   u ols)t2xoxm3ou4ope  ici tfs2rm(ro;u0tpeo f3iydfsDrm(mpn() rtomo3oo1omt  uvi;t0t2umxmpoo1apeelfcsl(faDrm( pno4opxn octat a2uanmo t)tlxoxo to1fa elieo t  2to(m3oo4lmtnlfeia()s2uaxm nt0ole mfciytfs2ra(mp;(4 rtoio ty1lp   n sls srtmxm3iu4lle lnvia()aDua(moou1tleoio3tysla2ulnmp;t)tetnmfcoydlm  livi;(0 2xm(r iu1lpe  ivsl()aDtrx  ;o1tpxomietydls2emn s;()arxoifcoadlpDe nes;t0seur(o oydap emiciatf rta(rp;o4aetnmiciadlm2ea(mp (0tltomr3to1lmtrlivil(0s2xrimpou4lmtn neil(fsDrmxmpoo0alxoii3tadlmDra(mo u)tlxoxrciatfmDr ieol( seurxm io4omenmfvta() rua(m ou4oex  icilsfmDua( pnt) lxnmo tadlatrlu olt srtmxrpoudlmen nvsa(  2ur( pnu4tlenioctltfs2rmuvo t4 eenmo iytoa r ieol(0srxmim3oo4omenliesl( a2um(ronu0opx ifcildlaDemnvo t)areoioctydomt aues;() exoir oydlm n ncils)srua(ronu1apxniiciyd m ranmsnt0 ltnmr3tytlatr nvo t tetoiopnydlm e ici (fsrurumo;o0teeo i3ias m rmu pn(4altoxf oy1latelieols  rxoio oodlleelnesat) rtmumonu4tpto fetltls eanvs u0arerxo3oo1fptrau s;s)tetmxmpnodopeelncias)sDrrxr ;u4olxnmi3tyslaDel(mp (0altnmr iodfpDe ivs t) 2uo(o iudlpee fci s)s2uaump;o4tpenii3tytfa elnvsnu4alermocoytfmtrlivo ()texrirpoy4om nmfeias) 2urxmp;t0alxnmictad sDeanmont0teenio3to1lpDelnes s0tetrxo oy1altemnci s  rrrxrono1opeo i3tadfmDeanvo;u0artnmr3tatfatr i sls)srxmxrpnodll  lnesasfaDraur ot1oetnmoeiltlm eaumo (0areomr3oa1fpD an o ( t2tm(o oo1lpee fcs t)aDurx p;u0aexo fetytfsDulu o;t)tlerif oo1oatrlues s0 rxmxo3nydaptnmies s) 2rr(rpoo1tptoifeiadls rau pn()tltomr3iotlaDeaieil()truoim oodllenlnetat) 2uru ont4apeomo3iys m ua( s ()tlerioctydfpt li o;t trxrxrpio1lleemnvsatfsDua(mo;u4olxo iciytla umuvp;u4 rxomfciotopDrlnvo () exoxopnu4amenmiesl(fs2rm( ono1opeo i3tyslm2ua(monu)aeeomo3iatlm elnvi;s  exoimpiodamenlieslsfs2tr( ooo0apeomo3tlsfs uln o u)alxrxr iy1fat au olt t2xrim3iu1op  mivsl(farum(m no0tet iociyslsDum( o t0areomf oodoaD aies t0 2tr(o oy1apen fciatfsrua(  ou4tptnmoctytfs2umn ont)tleoxfctotop   uvi (0srxm(o no4alenmnvil() ruax p;o1olxn ociyslsDumnvs;u) rxomr3iadoaDeanvs;t s2tr(rpny1lmtn nesat) Durump;t0aleo i3iyd a rmnmp t)teeoiociatfaDelnvo (0s2xoimpiu1omenlfvia( aDrmxrooo0tpeniicias aDra(vsn(0 exnifcia1lpt  ueo;t)seurxo3oudale  ncta(  rrm( pno0altomi3ilslm2eau p u4tltrxf3iy1lateaiesl() rxrirpoy1lle  fvsls s2rrx  nt1opto f3tyt m2rluvo u4tlxrir tydlpt  uvi;(  2xriopny1amtemicias  rtm(r nt0alxomictlsfaDrlnmp;t0trenmr3ootfm   u i;s0trto(m oydoptemivia()srra(monu0tlxnif3iyt sDelu o u)trxrxr3ty1oaD liei;(0seurxrpoo1ll emnetl(faDtrumoot1tptomoctys s emnms;() leoxrcoa1opDrlues s t2xmxopnydaptnmietls s2ra(rpno4tetnmf3iys a2rmumsnu4aeeomr3ty1lp elu i;() ruo(rpoy4al elnvtlsfaDum( o;o4tlxn ietadfsDran on(4artnmrcty1fmD anvs ()srto(rpnu1omenlfvslt sDtrxm no1opeomocilsla ua( o;t4tlxrxrcoa1lpDeanvi;s)seur(m3nu1amenmnvils)srumu ono4teto f3iltfsDrl( s u0trtrmo io1fptrauvolt)trxoim iy1ll nmfet (fa2uaxrono0aet  oeiatfsDraumsnu4 eeomf tadfm  au i (0 2xoir ou4apt mfcsls) 2ta( ont0tex iieiydls elnvo t0altnmr tatop eliesls s2to(r3nydlpt  nci sfsDurur oo1apxnmf3iatfm2ea(mon(4teeoxf3oadop e uvs;()t2xoirpnu4lptn nvi () 2rrumono0oetnioctad mDeluvs;u0arxnxf3iytomDr neils)trum(m iy4optn ivils)aDurx  nt4tetoioeiydfa rl(mo;(4trtnmr tydlptrln o;()t2uoirpoydllen icil(  2uax p;t1alx mictytfmDemumo;(4arxrxf3oadoa e i o;t  rto(r iudaltelfei (f 2raxro;u4tlen f3ild aDrlnms;(4aeerif3iytopt  nei s0srurxr3oo1om nlncils  Drr(m ot1apenifciys sDea( o t4aexnmr3oy1oaDranes;(0t2trio3io4ll   icsa(fs2rrxrpnt1aleoioeilsfs2ranms (4 etoir oadlp eli o;t  2toxo iu4apee feta( a2raum ;o0texo oeildlmDumumont) exoir iytla rlieo s  2tmio no1lmen neta(fsruaxr ;o1tptnmfetadfa2uluvo u0arenxo tytomDe ies (0seuo(rpoy4lpen iviat)srtaumpou1apenmiciltls rlu p;t) reoxo ta1om r n s s0srtr(m no4lpt  fcias a2rr(r ;u0oeeo ieils a ul(vp (4tltnifciotoa eaivs;( t2urxrpio4ope micta(f Drax pnu1opxn ocilslsDel( s;(0 eerifctotfmt aivs t)s2tmxr3iy4olee neil()srtrx pno1oex  feiytfs2ranvo ()aeenxo3iydomDe ues (0 2toir3iu4llte ieslt)aDrmxmpno4oet  fetldlaDran o;u0artoio3tadla  ai i;s0trxr(rpiydlm n fei (fs2ua(m ;u1opx mi3iys s um(mp (4altoifcoadlat au o s0 rumxr ou1om e fctls  ruax oou1olx ifeiasfmDrluvo;t4trxnir ta1opDeai i s0t2toir nu1ol   fei s sDtm(ro;t4aee  feildfm2umnmo ()tltnxr iadfa  ln i;t srtoim3iudoptn ieta(fs2rrx ont4oleo i3tytfs2em( sn(4 rxnxrcto1fmD aivil()t2xo(m iudaltemnciatfs2uaxro;o0aetn ieiyd m2rlu s u4teeomo oy1om  lu o t  rxoir nodlm nliet (fa2rmum nt4opeomi3iatfs2uln s;t4 rxnmr tatla r u o t0t2tmirpoy4opt mivtlsfartau poo1texn f3tysfs umn o;u4 rxnxrcio1fm eln olt0srxoio nydap emneiat  2tru  ;u0oexnio3iltla2rauvo;t4tltnif3iydfaDeln o;t0trxoxrpnodoptn ivta(f Drrurp;u0opeoioeiysfa2ua(von(4tlxrxfciatlm r uvi (0 exmxm oodolt lnvs ( a2taxmpot1optnmoeildla rlnmont4 lxnxr3tatfp e i il() euoxr oudomeelfvslsfa2rr( pnu4aexnmf3tys s2elumo;t4texnmoctatfaDeluvolt trxmiopiu4ol nmfvsat)a2tm( oot0olxnmieiltfs eluvs t4altoirctatfm eln o;s)srto(o nydomte fcsl()a2uau o;t1aeeomociyt m elu onu4 etoiociodoa   uvi;t0srur(o oydamte ieilsfa2tax pou0opt  i3iasfm2rau sn(4teeoir tadfa r nvo t) eumir oy1lpte fviat  Dtr(roou0oltoioctydfmDrm(ms u)trxoif ty1lmDrai i;() exo(m ou4lltn iet t)s2raurpnu1tltnii3ias m2ea(vont0alxrxf oa1omtelueil(0seumim io1optn net t srumxr nt4alt ifciadfs uanvs;t4aleoxo oatlmt lies s0 etrxmpoodlp nmictasfa2ur(m ou4tlxn fcildfsDean p;u) rerir tydoaDrlieol()teurxr oo1lp e ncs tf 2umx pou4aee  o3tld mDra( o u0 ltrir3iotop e nvs t)texoio3oy1aleemivil()s2um( oou0oex iietyd s2umumo;u)tetomr3iydfpDe uvo (  rxr(mpnu1omte ncta() rtaxmoot4teenifeiasfs2ra(mo t4 rtoxr3iytop rauvolt)texriopoy1amtnlicil(fsrrrx  no0opt ioetas sDeau pn()tetrxfctydlmDe u o ( teumir3iydlmee nvtlt s2tax o;t4ape  oetatlm ean pn(0texrxrctydfmDe nes ()texmxopno1ame  fcta( s2rmur ot0oet iietltlm rmumsnu) rtrmo3iy1oaD  u s;( srxo(m3iudolenlfciatf Dtm(  ;t4ale if3ils aDul(vs;t) renmr3ootoaD aneils0 rtm(rpiu1ol elneslsfsrrmu p;u4olto fciltfm2eanvs t) rxoifctatlatrauvo;t) eur(rpoy1ll e neiltf Drru pno4aleoiictatlmDemnms;u4texnif tadfp   nei s)t2to(r3oydopte ncta() 2trum nt1apxo iciydlsDelu o u0texrir iytlate n ol(  exm(rpio1omt liviat  Dtax  ;u4tptomoctld s ulnvp;(0trenmr iadlp r nvolt)srxoimpoo4ol   fetl(faDrm( p;o0tlen i3iadfa rlu p () exoxo3oatoa  luei t setmxopio4ap   fvtl(farum(mont1olen ocils mDumuvsnt4 etrxr totla rlieils setmxrpou1apt micslt)aDurum ;u1ale mfeiys a2ra(vpnt0alxoircootlpteau olt0 rxrio iudop e ivilt  2raxmo;t4apeoiociad aDra( sn()trxoxf tydfpDeaneolt  2ur(m3ou4al emieslt)sDtru  nt0opeo ieildls2eanmp;u0texrmocta1laDranvs;t0sexrirpiudom n ncs tf rurx pou4oeeoio3ilsfs rl( p;t4 exriocoydlpt anes ( srtoimpoy4op nmfvs tfaDtaurpou4openifctltfa um( pnt4tltnmocoodomt aieolt teuoxo3iy4omt mict t)s2rrxrpot4apxo octld m2uaumo u0aetoxrctytopD luei (0teuoxo3iudlm   nvtas)srra(mo;t0optomf3tyt a el(vp u0 lermf3iadopD livi;() 2trio3oo1op nmnvias srumumoot0oexomo3ildla el(mpnt) exnxrcta1fpDelueo s texoir3oodlltelivs sfarraxmoou1opxoio3iytlaDeanmp u4 reoiociodoateai i;t) rtrxr nudap n nvils)arrmurono4tleomo3iydfaDul(vs u4 eenmo iotlpDeli olt) 2tm(opnu4oleelnetas a2urxr nt1oexn o3ilt mDrau pnt0trxrif todlp e neols)t2xmir3iydapt  ici sfsrraxmp;u1ape  i3tlsfs2em(mp ()aexrmf3oatlpDr n o s0t2trxr3oudlpt micsa(  Drm(mpou1tle mo3iysfs ul(mont4 lxoxoctadopt  n i;t seurir3nudoltn icils sDuaxmpno4oeeomi3tatlm rln s;t)aexnxr oatlmDranvs;s)trtmim3oodam   nvtlsf ruaump;o1tex moeilsls2ran p;() eermr3io1fpt aivo s) 2uoimpio4am e ncslt a2raurpot1tpto oetad aDulnmo;t4artomr3oadopt  ivo;t t2tr(r3iy4apee iesat) rrmxr no1alxomfciatla ua(mp u4artoir3ootlpte ues s)srur(r3iu1ole mneia(faDumum ou0aeen i3iyt aDuln pn()treoir3oo1fp rlnvs;()sexr(m3nydamee neils)s2ta(mo;o4altn oeiytlsDrauvp t4 rxrircoadlpDe iei () 2um(r iodlltnlnvia(faDumu  nt1apeomfeias mDul(vs;t4aeenxrcoa1fmtr ivsls  rumxr oudlmenmnvi (fsDrr( pnt1alxn fetls m2eauvsnt)tetrir ootfmtr ieo t) exoio3oy4amtemnvsasfs2umu pnt1opto fciytls rln o (0texrmf ta1om  anvo;t  etr(mpiu1lptn ivt t arrmxmp;o4tle mo3tydfm2umnmont4 lermrctadfpDe u o;s)trxmim3iy1am emies s) 2rr(rpot1aexomfetadfsDrl(vs;(0 lerirctytlpD aivols0 2uo(m3iudomtnlfvtlt)a2rmump;u0alen ocild m2emn ont4arermr ootfat luvo;s trxoxo iy1aptnlivil(fs2umx  nt4aeen oetydfm2elu s (0artoircootfptranvi;( truoir3oydlptemfeiat)artrx  ot0tptn i3iydfa2ea(vo;(0areoxf ootfa r iesl() rto(mpiy4lp e nvils)sDua(ronu4oltomoetytls2uaump u)tltoxfcoatomDrauvol(0 2ur(opoy1ale lnctltf 2rmxr oo4tlxomfetytfmDrln sn()alenxf oo1lmDraneolt0s2umimpoodopt lfct (faDuaur ;t0oetomieiytfaDrlu snt4tlerxrcio1faDelnvs s) 2xmxm3io1llt mncias)arumumo;o0ole ii3iltfm rmuvo;(4arenif3iotfptrai ol( seurim nu1ope lieslt)s2ta(mo;o1alx  oetat s2emn o t0trxnxo3tadfpt  ieo (  etmiopnydoptnmfvs (fsDtru o;u1tlxoioeias sDea( p;u4trtoxr oytlpte i i;t0s2xmir3oy4lm n ncsas) Dtm(mooo1tlx ifctld m emnvs;(4arerir3oytlpt  i sl() 2xm(mpio1ape  fctatfa2tmum oo1tlxnmfeiltfa2rmn pn(4texoif3iodfm  anvol(0t2uo(o3oo4lp   ictlt sruaxmonu4opxoioctad mDrmn ont0 reoxo ia1fat lnvi t srtrio nu4al   neiltf 2tru pnt0apt miciytfa rlumont4tetomo3iy1oaD  uei t)seto(mpiy4omtnlnvsa() Drrumpou4oetnmiciasfm emnvo t4trerifctotlpte u olt) 2uoxo3oydlm  lfeils sDraxr nu0opt ioeiltls2ul(mp t) rtnirctotlmD lnvol()t2xrim3no4al elfct (fs2taxmp;u0tlt mf3iadls emu pnt)altrxf3oodlptrlu s;s0 ruoim oy1amen nctl(  Dtaxr ;u1ale if3iadlaDel( o t)tltrxr tydla  an ilt0t2uoim3iodlm e feiat srumxmonu1tltoifciaslmDea(mont)aetnif ia1fmDraneslt t2umir ou4lm n nvs (fsrtr(r nt4tpto octaslsDemnmsnt)tetoxrcto1lmtr u sl( srurxm nu4ll  lfei t  Dum( pnt4olxnif3iys aDrlnms (0teeoir3ia1lat au s t0t2xr(mpou1ol  mfesls)arrrur ou0aleoii3iltlm eanmonu0trtrir todopDrai o;s)t2uoxrpiudamtnlivias)s2ra(rooo1aexn o3iys m eanmp u4 rxoio3oadomDeanei;t  rxr(m3ny4oltemfei tf Dur(ronu1opx io3tasls2ean s;(4trxrxo ootfa r n olt)trtr(rpiodalenlnetas  Dumxrp;t4apto fctytfa umu o ()trxrmf ootfa  lu s s0 rxrirpnodll e neiat)srra(mpnu4aee ioctadla emnmo;t0alxrxf ta1lpDr uesls0seurxm3oydaptemivtl( sDtrxmpot0oltomoeiytls ua(mpnt0artnxo3oy1omDrluvi ( srxrir no1al   ivias)a2rmum ;t1oexo o3tat s2uluvo t4 lxnxr iodfaDr nei;s)srto(o nu4apen ictl( s2umx p;t4opeo iciyt m uln s t4 rxomfciydlateaueolt t2tm(m nu1amenmnci t aDrmuroot0tpx mo3iydlmDul( sn()artoir tytlm ran o s)srtm(o3oy1olt mfctat artmx ont0tle  fcilsfa2emuvp;u) rtnif3tatoa   ueil( t2triopio4amt  nvsls)srururont4tpx ioctas mDelnvp;u4 lxnmr tatlpD lnvo (0srtm(m nu1amtn feslsfaDurxmp;o0oltnmiciltfmDeanmp;u) exoif oo1lp raivi s)t2xmxopoo4llt lneilt  rta(m nu1tlt  i3iydlm2emump t)aexnmf iatfmte ivsl(0setrxmpiy4ope mnvilsfsrtaumpno1apt io3iltla em(vsn()arxrmr3totfat  n il(0teurxr no4amtnlieias sDrm(m ;u4aexomoeiys m2elnvs t4 leomo to1lmt aueo;t t2xrio ny4al   ivs ( sDrr(m ot1oeeomieildlsDelums;(0tleoifcta1fmD ln s ()seur(m nydalt mfeslsf 2ua( p;u4tptomoeiysfa2rl( s;u)treomf tytlm  aivils0t2ur(o3oudlmen nvs (fsrraxroou1apeniociyd m2um(monu) lxomo oo1fatr nes (  rtoim3oodlmen fvslt)aDum( oot4ape mi3ild m rl( snt)tltnxr3oadomte u ols  eumxr3oo1lpenliei t)srumxmpnt4aleomoetatlaDrau onu4altrxoctotfpDrlu o t srxrxr3iu4omeemivilt)arrmu onu4oeenifeiltfm ea(vs;t0aetoio oadlm elieo t  rto(r3nu1amt mfvtatf Drmxrpot0tpeoiociad s eau snt)tetoxfcio1op eaieo (0 2toxopiu4lleelfet (fa2tm(  nt0ole mfctld aDulu p;u0 ltrxf oodoa ranei ()s2to(mpoudalt  ies tfa2ta(ront0olxoiiciyd aDum(ms u4 lxrmo ootfp  ln o;s0 rxoxopoo1amte fci (fs2rmxm ou4aee  f3iyt a2eluvs u)arxomr3oa1laDe ies t)t2trxo iu1al e fcslt) Drrx ont4aex ifctysla elump;t4 etnxr3tadoa   ieo;s  rumxr iydal elnvsl( a2rru ont4apt  i3tysfm uaump;() rtrio oa1fm e n ols sexr(o3oo1ll  livtl() rum(mo;u1tet  f3iytlm2ra(ms t) eeoxrcoo1fp eli sl(0teuo(o3oy4lmeemfetas  rum(  ;o1apxnmfctaslm2ul(msnt)tltrxo3oy1lp e n ols0setmiopnydol  lnesl(  ruaurpou1tee ii3tls m ra(mo t0alxoxocoatfp eau o t0trurim3ny4omtnlivsls)srrau  ;o1tlxn fcilsfa el(mo t)trtrifcoodlaDrlieo s) rurio ny4amt mfct sf 2taur nu4alxomfeiytfsDeluvpnu4aeerxo3tatla raneols)t2tm(opiodlm emfcslsfaDtmx oou0ope  fctldfsDum(mp u0 leoxo3ta1fmtraueolt setoir ou4aptnmfetl(fsrraxrpnt0tpxniieild s ea(mp;u4trxomf3to1fpD ln o;( trtmxrpoy1apee nvsatfsrrrurooo1aetoif3tatlaDemn s;u4treniocoytop eaueil(0 etoxm3oo1lm nmnctatfa2umxmono1apx ioctls s2rlu p;(4 lermr3iotfa raivi;s trtriopiudolee ivt t  2raumono0aet moeiytlaDelu o;(4tlxrircoa1faDrai ilt)srurxo io1opt mies tfsDrr(m ;u4aetomiciatlmDumnmp t4 etnxr3to1opD  uvil( seurirpno4alenmieta()sDua(ro;t0oetniietadla2um( o t0tetrif3tatla r uvo;t  etmxr iy1op emnvia() 2rmumonu4ape mfciys m uan o;t0trxoxr oadfpteaieo;t0srtoio iudapeelncs tfarrr(r nu1alx  oeiytfaDrmuvp;t4 lenxf oatoa ranei;s0tetrimpno1lpeemfes s)aDuaxmpno4apeo fetaslmDua(vo;(4 lxoir ia1lat  n s ( sexmxrpio1op   iesas  rrax  nt4tleo ictytlaDrlnvp ()artoxo3ta1omDe iei s) exmimpiudomtnlnvta() rum(mpou4texniociasls2um(vs u) lerirciotlateanvol( srxr(opiy4optnliei s) 2uaxm ou0oeen fctldls rmuvsnt4tltrmociy1la ean s s  2tmxm no4optnmiviasfsrrmxrpnu1tlt ifciydlm2rm(mo;()tltrxo to1omtr uei;() ruoio3io1alt lncilt) Dtmum nt4ape if3iysfm rau p;t) etoxrciy1lateauvo t  rxrirpiodape lncils)arrrur oo1aptnifciydlm rmuvp u0tetnmo3iodom rauvsl(0sexrirpnu1lpenlfes s)s2raxr ou4olx  i3iatla2rmn p u)trenmr oodfaD li o;(0setoxmpoy1ol n fciltfs2rmurpnu0tlxo feiatfs2umuvp t4 etniocoo1om  aueo;(0teum(mpiodlle  ivs (fsDta( poo0tetoii3tls m umnmp (0tlxrxf ty1lmD au o t0t2xrir3no4oltnlieta(fsrrax ono0tet ioeild mDumnvsn(0teermf iotom rauvo s)setmxo nydomenlnetls  2trur nt0tltoio3tltfaDranmo;u)artrio oydomDr ivil(0sexrxm3iy1ol  lncsas)a2rmu oou0aexoii3tyt m rlnmo;u4alxoxf3oodopDeln i;t0 eto(r iu1aptemnvi t) rrmxmono0oex  fctlsfs2ua( p;u)tlerxfcoo1fat  uvo;t) rtr(o no4al elncil(fsDtaumpoo0tpeo iciltlm ul(mo t4teeoio3iodlmDrlivi;()truoxmpny1ame  nciatf rrruroou4tpxomictlsfm um(vs u0tleoircto1
\ No newline at end of file
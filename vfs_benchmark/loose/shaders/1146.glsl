@@ -0,0 +1 @@
+u s;t0s2xo(opiu1omtelnvil( aDrru poo1alt ifciys s2rau ont4aexrmfctydlm elneo;t0t2xoxr nodol   ieiasf 2tru  no4aee mo3tltfm elnvo;t)aleoifciytoaDranei s0 rxr(m nodomtnmfeia( a2trx  ;t4oeto i3tyt a2elump;u)trxrxo3iytlp eluvolt)t2umxm3io4ol nmfci ( s2um(mp;o4ale if3iaslmDrlnvpnt)tlxnxo io1faD aivols  2uoxrpnodlmtn fcia()srrr(  ;t0oetnii3iadlm2ea(vs t4artnif3tadlatr ieo;s  rxo(m oo4lptn fes ( srta(  ;t4tetomoeiltls2ea(mp;t0areomf3oytopDraneo;(  2xr(o iudopt mnvils) 2taxmpou1tetomf3tadfa rlu s;(4 eerio3todopDelnei s) 2toxopny4opt livils sruax o;t4oeto fciadla rluvp;t0alxrifctotfp  luvo;(0 2uoio3io4lltn ivtl(  rtmumo;t1aeeniieiytlm2ua(mp;u4aetomo3tatoaDelu i s texrirpny4apee fei ( arua(mp;o1oltnmietysfa rln p;u)texrxo3tytfpte nvi;s0trxm(mpnu4apee nvs t srrmxr nu0aet  ieiltfm umuvpn(0tlenir ootlm  au slt0s2uo(r oudolte ictasfsDtmuront1tpeomfeiaslm2ua(vp;u4tetoio3todlp rli s ( t2umxopny1amt lnct sfaDtr( o;t0oee mfciad m rlumsnt)areomf totlatraivs;t)s2xmir3nu4op n fvt t  Drr(  nu1olxo ictytls2rau s;(0 exoir todom  li s s  rxmio ny4lm elictlt)arrrx  no4opxo fetldfs rauvs () ltoxr io1fpDr u o;( tetr(r nu1am nmivtasfarra(ront4apxnifcildlmDemnvsnu4 ltnxr iytlmteln ils)srxr(opoydlpenlfvia(fsDua(mo;u0aex mo3iyt a emnms;(4 exrmociadlm rlnei t)trur(rpiy1apenmfcs ()sDrmx pnt0aex mociltla2el(vp;u4trerif tadlpDeaivslt) rtm(opiy1llenmfvs t) 2taxmo;o4oee ifeiydlsDean s t)aleoxr3oodom  an o;(0trxo(o3oydam e fci s)s2ururo;o1apxomfciadfm2emnmont)texomociadopDe uei;s0trxr(mpoy4am n ictltfs2tr(  ;t1tlx if3iytfaDrlumsnu0alxrmo oatopDean i (  rtr(r3oy1llenmiei ()aDtax pot4aex io3ilt s2rl(mpn(4alxrxrctydop  anes;t t2xmxr3oydlmtn neiasfarua( oot4ole mieiatfs elums u4alxnio3tadfaD lueo t0 etm(m3io1oltnlnvta(f 2taxmo;o0tpx  o3ias a2eln s;(4tlxoxociatopt ln slt0t2trir iy4ap  mfvi (f Drrxmpnt1apxomfctlt s umnms u0arxrir tytomDr uvo t)setmir nodom   net t) Drmxmp;u1olt mi3ilt aDrluvs (0trxrif3ta1laDelieo;s s2toxrpiu4lm nlfcsatf 2ur(mpou1altnmicildfa2ulu pnu) etnxf oadlm   nvslt) ruoxr3ny4opt  fvs (  rur(mont0opx  octltlaDrauvp u4 lerxr3iytfm elu slt0tetm(r3oo1lleelieil()arurxmont4ope  f3iyd m2ean p;t)trtrmr3oytfpt luvol( s2tr(rpiu1ol  mivtlt)aDrax p;t0tlxn fctytlm ranmp u0 leomo3ootfat ai slt0 etoxopnodaleemiesatfs2tau  no0apx mfeiad a rln p;t4 lenir3iadlaDeli i (0trxr(mpiydlmt  ivsa(f rtaxrp;t1oeeoio3iatfs2ra(mo;(4 etrirctatomDr i ol(0t2umio3iy4om e nctas)sruauront0aleo ieildls uau p u4 exoif tatfpDeaneol()s2xmxo3nu1opee net tfs2rm(rpno1alx if3ilsfa rl(vsnt) rerxrctadlp eai ol()srur(o oo1ol  miesas)a2taur ;u0ape  ocils a umn snu4tlxomoctatlaDr ueilt)sexr(m oudamenlfvta(  2rm(rp;t4alen ociat a rln s;t4artoifcia1omDeluvs ()srur(o3ny1lme  netl(fs2tmur nu1oex mo3ildls el( o;u)teermrcoydop   ues (0t2tmio3oo1ol n feil(f Drm( ooo4ope mi3tadfmDea( p;()arxnxo3tytlmD lueolt) 2to(rpny1alenlici t sDrr(r nt0tpxnmfciad s2uluvp u0 exrxo3tydlat lnvi s)t2tmxr iu1altelnes t a2taxr no1ole  i3iyd s2rmu snu) reoxfctydlate uesl( seuo(r3ou1ol e ivs s)srrrur no4tex ioctyslm rau p;(4tlxnifciytlptraies s0 rtrxr nydlptelivsa() rta( ooo4ape mfeiydlaDrmu snu4aetnir3oydop raivs;s truoim3io4amtnmfvsl( aDurxmpnu1tet mfeiydls2elnvp t0aeermo3iy1fa raiei;t)srxm(o3nydoltn fcsls)srua(ro;t4tptomo3iad aDulnmp t4 lermo3oa1lpD li o;s0sexo(o3nu4op e nvtls)aDta(r ;u1olxnmi3iadfmDrm(vo;()trtrxrctadomDrli s t)srxmxo3ny4oltnmivilsfsDtm(rpno0aee  ieilslsDran s t)trxrif iodlp e i o ()trxoxopiodop   ietl( sDtrumo;t4tpe mociydfsDuaums u) rxrxf iadoaDe uvil(0 2toxmpiy4amtemnciatfs2tmxr no0aeenif3iltfaDra(msnt0alxrmfctydlmteanvs;s)s2to(mpiudol n ivia() 2uax  no4oltomoctasls2emnvs;u0 lenmf3iadlaDr uvi;(0 eumxr3no1ap  lfeiltfa2rmuro;u1aexniictyslsDumnms (4texrifciydlptelieo;t  2tmimpou1llen ietlsfsDtm(rpnu1altn i3iatlaDrm(vsnu)arerir iy1lmDrau il( seuoxmpny1lmte net t s2rm(moot4aleoifetas m2em(mpn(0alxrxr iodfmt  n s ( texo(o3oy4ope mfei ()s2rm(roou4oetnmf3iysfsDrl(vo u0aeermf3ta1fm e uvils sexrim iu4ol nlnvtasf 2umxrpnt0ale ifciytlaDelumon(0trtrmocoo1fmDelnes s srurxmpiudlpte feilsfaDrmxroou0apeoif3taslaDul(vs;u) exrif ia1lmt  ivolt t2toxrpiy1lm emict sfarraum nt4tlxoioeilsls2umnmsnu) exoifctadfm e ieils0teur(o no1lm  mfvt sfa2tm(ro;o0tetoio3iatfs2em( snt0arerxociatfa eaueil(0srxoio iy1ameemicias)srrrx  ou1olxnii3iadlaDum(mpn(4tltoir3todfptr n ols0 2tm(o3nydal   fvt tfa2urumpou1tptoiociadlaDua( pnt0 exnmo oa1omteaneslt)s2tmirpiy1op nmneil(fa2tauroou0opxoif3tat m el(mp t4aexnxo3oadlp eaieilt0t2ur(o iu1apt lietas srrrumo;t1apen oetlsfs2um(vsnt0alermo iodfmtean sls)texrxrpio4apeemfei sfsrumxroou1apto i3iadlsDeau s (4aeenifcoytoatean s;s0 rto(r3nu1lpt mictl()aruau ont4oltomfcildls2em( o;u)altnmr totoaDr u o;s srto(m oo4lptnmfetas  2umum ot0tetn fciyd m elu sn() exoxocta1fm  luvs;s srurim3nudlm  lfvt (f Drrx  ;t1alx  ociad aDem(vp () exoxrctadfm  luvsls trxo(mpiy1amtemivsls)aDumumpot4aet io3iytla rlnms;t4artnio3oodlm elieslt)srur(r3no1olt mncilt a2taump;u1teeoifeiyd s2elnvpnt0 lxnmr3ta1lmDr nvo (  eurxo3oo4omtemneils  rtr( o;t4altnmocilt aDran on(4 rxnmo3todlaD  iei t) eur(mpoy4ameemfvtl( srtmxmpnu0oeeo fciadlmDuau o;u4 rxomrciytomt luei t  etmxo iy1op nlfvi t) Drr(m ;u4alxnifeiasls2ea( o t0teerxo3io1lm ranvs;t0s2uoirpoy1lleemfvta() rrm(mpnt4tex mi3iytlm2emnvo t4trxnxf3iodlatr ivs;s)setoir3oo1lltnlfcta( srtm(monu4opt ii3ildfs rl( p t)artrio oydlmt ai slt  euoio no4lm emncsat) rrmxrpnt1aptomfetlt a emuvs u)aexomr3tydom e neols) rur(o iodll elies s) Dtau oou1open ietytfs2ua( o;u)texnmrctodlmDeaueils)sexm(r3oo4lmtelnci s srum(  oo1tpxoif3ias s ua(mp u4tlxoioctotoaDraieol() eur(r3iudoleemivsas  2rmxmo;t1texn o3tldlm emnmp;t)aexnmo oy1fa ean s;t0tetmirpou1lmeemnvsa( a2urxr ou0olxoifeiadlm rauvp t4tleomr totlmteanei;t tetriopio1openlfcil()a2rrumpnu1olxoii3ilsla el( pnt) rxoxo oadfp rlivo s)texrimpnydlmeemnet (f 2taumoot0oeeomfciyt s ra(mon()arxniociotla elieol()t2toxr no1ll   iviasf 2rr(m ;u4oleomi3tyt m ra(vsnu0trxoifcoydlatrlnesl() 2ur(o3nodalenlietls) rrmxmpnu0oetnifeild mDua( o;u0aexnircoa1fpDeaueo ()srto(r3nudaltelivsas s2rm(ro;t0aet iicils s2rlnmp u)treomf3todfm  ln i;(0t2uriopio4ap elnvs t  rurxmo;t0opx  fctadfa ranvo t)arerxf3ta1lmtr n sl()srxrimpiy4alenmnvia()s2ta(rpoo1tetn ieiyd mDelnms (4arenxo3oo1oa  lnvi t0 eur(rpoydome lnviltf 2uru  ;o1aeeomf3tys aDran pnt)aexomf3oytoptraneslt0srxm(rpiu1ap nlfei s s2uru poo0alx  feilsfsDul(mpnt4trtrir3oytopt  nei;(0teurio nudlleemnes t artr( p;t4opeoioeilsfa umu p () reoir3iodfmDrln ol(0trtmio3ou4om elict ()s2rm(m no0tpx  o3iaslmDrmuvs;(4alxoxf iodfpDeanesl(0t2xo(mpoudopeemivsat)a2trurpot1aeto o3tytfm uan p t4 rxoio3oatoatrlieilt0texr(rpio1lp elnctls a2taurpoo0tpt mfcilt aDra(vp (4 rxnio to1lat ln s ()s2trirpoydllt lnctl()aDtmxm ot0tex mi3ilsfa emumsn(4arxrmfctytop rluvilt0truo(opiydaltelfcsls)aDuauro;o0optn feiatfa2rl(ms;()teermf3ta1oatrluvo;s)sruoio3oo1op nmnvs s  2ta(mpoo0opxniocildla uau on()aleoio3ta1oateli ils)s2to(m3iodapeelnvi (fsDta(m nt1aexoii3iydlsDeau s u)arxrmo3iy1opD  ivils) etr(rpou4ll e ncsltfartm(m ou4oet miciltfmDumuvsn()tltoir oadomt auei t t2xoio oudlp emiet tf rra(  oo4tpt mf3iys aDum(msnt)tltomo tadlpDeauvs t0srumimpou4al elietlt  rrru ono4aetniieiatfs2eaump;t)alerif oodfp raieo t  etrio ou1om nlfcils  rraxmpnu0oexn fcils mDemumont0arxoir3ootoaDeln s;s0texoim3nydllt  nvia() 2umu o;o0alx ioetlslaDemu onu4tltoio3totfpDr ivol() 2xoxm3nydlmenliet s)sDrr(mp;u1olto o3iyt s2eau o u4texoio3iotlaD li i t0t2xrxrpnu4ale mnvs ( sruax pot1aee  f3ildlsDrlu o ()alerirciatla r n sls  rumxm oy1opeelies ()sDrau p;t4openiiciatlm2ra(mp t4alxrio3totop raueo t srurirpiy1ol nmfvtat srtrurooo0alxomfciaslsDrmn s (4 rxomf3oydfpDe neslt0sruriopny4ll nlfcsls s2tmuro;t1oexn ieiytlsDeanmont4 ltrxfciydfmD aueils) rumxm oy1ape lfcslsfsDra(ro;o4teeo f3iyslm2ulnmpnt0tlenmr3oytfpD lnei t  euoim io4altn nesas)sDrmu pno0altnmo3tyslm2eaump;()trermfcoodfa rlivi s)tetrxrpny1alenmfvsa(fs2trxm no1tltnmociyt mDea(vpnt)tleoif oodfmtran s;s  eur(rpio4ll elieiasf rtmu p;o0olxnifctlsfmDean on(0 ltnxrciatfptr neilt0s2to(o iy1om  mfciat) rumu p;u0apxo feiyslsDrl(mo t)tltnmf oodlpt li o t0 rtoxo3oudop   icias s2uax ono0openmieild s ranvon(4arxomo todlp e nes (0srumxm3oydapenlicils) Dtaxr ;o1aptnio3tlslm ulnmp (0 rxrmr iatom   ivolt0t2urxm3iu1lmenmfvt tfartmumont4open ictltlsDelnvs;(4trtnifcoo1oaDeluvils0 exoxr3oo1lp n nvtasfsDrm(rp;o0tle mi3tysfsDel(vp;(0 reoircoytfat  ues s0t2uo(r iydam  lictlt) 2tr( oou4tlxnmf3tas s2rau p;t)trxrio ia1lpt lneo;s)srurirpnodlpteliciasfs2urum ;o1tpxnmfcilt m2emumo;(0 exoxfcoytlmt auvi;t0t2trxmpnydopenmfes () Dtm( poo1oleomfeiadlaDran s;u)tltnir todfa   u o;t s2tr(opiy1al elnvsas)srtmx p;u0tpeo ietydlm2rm( s t4trxnmfciytfmt  nei s texm(o3ny1olen icia(farraumonu4aexnioeiat mDulu p;t)areoir tadfpD ai o t s2umxo3no4ol emfetlt sruau p;t1oleo f3tasla ua(vo;u)trxrxfcty1oat livo t0srxo(mpoodlp nmictatf rtr(  oo4ale mi3ilslm2rmu sn(0teenif oo1lpt aivs ( s2toim nydlmeelnesls  Duaxront4oet  i3tlsfaDuluvo (0aexoxf3ty1omDrli i t) exr(m3nu4omt lfcilt) Drru ono0tle mieiaslaDrmu p u0tltnircia1omD aneo;t)sexo(r3iu1ale lnvias s2rr( pno4apenmi3iysfmDranmpnt4alxrxo3ta1fatr u i;t) rtrir3nudlmenmiet s)sDrm(mo;t0oet mieias m ran p t0artnmocoytfmD luvs (  rxoxo3oudomt livils) rtmurpnt0olxo o3tldlmDrmuvo;t4 etnmoctytfa  lu o;()srxr(r3nu4ole  fctls sDumxrpnu0alenif3ildlm rlu pnu0 eeomociy1fptrlu olt)t2trxopno1om nmics () rrr(rp;o4aptnii3ildlaDrmn ont0 exoxo tydlpteaies t0s2xo(opoodap emnes sf Duax  nt4tetn feiltls2uau o;() lenxrctatfm eanes ()s2tmimpio1al n nvi t)a2umumpno0olx  oetyslaDeau o;u0aeeoxocoytfmtelivs s teumxrpoo4op  lnciat)a2rau  no1aexn f3tldlm2rm( p u0 renio oodoaD  n s (0sexmxm oo1apenmivs () Dtm(mo;o4altn i3iltlm2ranvp;(4 rtrmo tadlmD aivol() rtr(o3nydlltn fci s sDrrum no1teeomieiaslm rmnvo t)altomrcoatomtr i i ()trtoxr3iudlltnmfctasfa2rru pou4tetoiictat sDea(ms (0tlxrio oa1fatr i i () rto(mpnodaptnmfes tf 2umxro;o1oet  o3tas a2uauvo ()texnirctytlmDelieo;(0sruoxrpno4lp   fvias) rtaxro;u1aeeniietasla emu o t4tetnmr3ty1lp r ueo;( t2um(m3oydam   net s a2rru o;u4ale iiciyd a2umnmp;t4tltrirctotfm rlu o t) exmirpnodaptelietas  rtr(m ou4alx  i3ilt a rln on(0 exnmr io1optrln o;(0s2xr(rpou1ape lfes tfsDrau  no0tle  o3iasls2ra(vs;u4teermf3oadfp rlieo;()t2xr(opiy1lp elfei t  2ra(  ot1alen i3tadlm2uan s t0arerir3tatfp r uvsl() etoxr3iudop  lnet tfaDrau  ;o0ole  oeiat sDulu p;(0texrmo3ty1laD an o (0s2triopnydalenlfeslt sDtm( pot0aleoiociydfm2umnmo (4artrmfctodoaDrlieol(0 exrimpou4lleemfvsatfartau  ot4tex  iciasfsDea(ms t) rtomo3oo1lm e ueols) etr(o nudal nlfctasfs2rru oot0apxoifeiasls ulnvp;u0aexrir to1faD aneols)srtoxo3oy4alt  icilt aDrau ooo4tpxn ocils m elu s (4tlxomo3tydop  lueo;(0seuo(m3nodlmtn nvs (fs2tax pot4texnmoctysfm el(vpnu0 rxrmo3oo1fpD auei s0srtmirpoydlp emivsls)a2ra(  no0alt  ociasls rm( ont)artrxf oa1fp e u i t)trxrim3iydolen fesl(  Dtmu  oo1opt iiciat sDea(vonu4trermo oo1la   nes;s0s2toir3oo4ame licsatf Draumonu0apeomietat a2eln pnu0trenxf3ia1faDraivi s) rurxopiu4lmeelivsl()aDum(mp;t1alxo fciat a2emuvpnu) ltomr3iytop e nvslt0t2tmxm oudamtemivi () Dumxmooo4apt iiciytfa2raumont4teeomo3ty1oaD  ueo s0trxoim nu1opeeliciatfsrrmxmo;u1alxn feias s raumo;t)artomf oo1fm rlivo s t2xoxmpoo1opt  nvi ()a2ra( oot4tlx  ieiadla rluvo;t0tlxrxr3tatfmDe iei;() rtoio3nudomtn ncia()arraxront0tpt ifetatfaDea(mp;u0artrif3iadfa eau ils0srxo(o3oo4ll  lies (fa2trxr nt4tlt iociat mDul( o;u4 exnxrcta1late uei;t)t2xmio3oy1lm nliesas  Dtmu pno4tlenioetytlaDrl( p t0 exnmo3oydfptelneilt  2tmir oodol emncta()aDtaxrpno4aleniiciydla2eluvo u)trtomf iatla  lieo t0t2tr(o3oo1openmnet tfartmu p;o1opx mfciasls2um( pnt0alxoir iy1fpD  nesls0tetrio3no1omen fvslt srrrxmpno4tetoiociadls2uluvsnu4 ltnxo totoa raneo s0texrir oydlptnlfcsl(faDur(rpnu0oexnmfeildlm2ulu o t)tltrxr ty1fp eaivol( texrxm oudlmt  iesas)s2ur(  nt1teenmo3taslm rl( o (0 lerxf oy1lmtrlues;( t2xmxrpno1ope licsat)arra( oot0aeto fciaslm em( s;t4tlxnmf oydlm  anvsls seum(rpnudapee fvias)s2trumpno0tet  ociatfaDemnmpn()altrxf3todfa  livi s)teur(m oydll  lfviatfa2tmxro;u1tptnifctatla2uluvs (4alenio3iydfpt lu s ( srtmir nudaltemncsls) 2tmx pnt4ole  o3ildlsDuanmsnu0arxoxo ty1oaD an o t0t2tr(mpnydaltemivilt aDuaxmooo0optoifeiadfs2el(vpnt)arxoio iadlptrauvo t0t2xo(m iu4om   nesat arraumont4olen octad m rmnms;u4alerxr3io1fa e i sls) euoiopiodlpe miei s aDurxmont4tetomietas s umuvp (0trxnmo oadlat lu s;s0t2xm(o3ny4lme  fesl( aDta(  ;u1tlxnmfeiadla2raumsnt)arxrio3tadfaDranei (0trtrir3nu1ale  fciat aDumu  oo0oeto oetls s2umn o;t4treomociydfaDraiei;(0 rurxo3ou1op nmictlt sDrr(rpoo0oeeo f3iytfs2rlnms;(4 eeoif3oa1fpt aueols0 2umxmpnudapeemnesasfarumumooo0aeen i3iys s2um(vs;t4teeomfciadoaDeaivil()s2xr(m ny1amte nvi tfa2tm(mp;o0tpx mi3tadfmDranvo;u4aeenif iy1lpD au i () euo(rpnu1al  lnetas)a2tr(ro;u0altomociadla rauvont0teenxf oo1laDeln o s0s2to(m iudom emnvs t arumu  nu4aeeomiciys m ea(vp;t4alxomo3ty1fatran ols trtoxo nodlle  ncil()a2ra(m no1aleoio3tytlaDuauvpnt)trxoif totfaDe iesl(0texrir3oydlptn neslt srrmu  ;u4opeo o3iyt sDelnvpn(4teermrctotop  aivo;s)setm(m3oy4ll e ncs tf Duaxrpnt4teeniietld aDrm(von()aleoiociytomDr nvo ()trtmxr3iydll nmfvta() Dur(mpou0apenmoeilslaDemnvpn(0tlenmocoa1fpt lnes s)trumio iu4lmeemfcslsfsrua(monu4olxoioetldfmDuau pnu0 lxoir oy1la elivi s srto(mpiu4lmtnlici s) 2ur(mpot0opt mi3tld m rm(vo;t0treoio todlmDeanei;s)trxrir iydomtnlfvsa(fsrtrxmo;t4aet if3ilsfa2umnvpnu4texnmrcoy1faDelnvi t)seto(rpiy4ame lfcs (f 2ur(r ou0oeeoioeildfaDeluvo;u)teeomr iy1op  livi s) etoxm oodlltnmnvsasfsDtm(rpnu0aex  o3tasla2ran s;u)aeerifcoy1oa raueo s0srxo(rpio1amtemiesasf rtmx ont0tlxo iciytlaDra(mpnu0 renmrctotla  an i;s0 exoxr nudlm n nvsat srurumpot0optnmo3tydls em(mpn(4arxomr tydlaD  nvs;t)srum(rpiudaltn neiat  2rr(rono4optomfctydfaDulu s;t4 ltomocoa1fmtrauei;s teumxmpno1omt  ietat) 2trxm ;t4oexomf3ilsfmDrmumsnu4 lxoxo3todlp elivo t s2xrxr3nu1alee ncsl(fsrur(  ot0apenmfciydfa rau sn()aeerif oa1lp eauei;s texmxo3no1ol nlfctas) Drr( o;o1tpeomf3taslaDeanvo t) lxomrcoadlm  aieo;(0s2tm(o nu1lltelncslsf rrru ont1apeomfeiydls2ra(vo (0 rtoxf3ia1opD  uvi;s0t2umim3ny1op elnvtl(fsrtaur ;t0aetn ietlsla2rmu o u4 ltrxf ta1fp r i s;(0srurxm3nodlm emfesl(fsruaxm ;t1tpx ifeiadls2ulnvont4alxnmr3io1lm  aivol()s2toirpoy1om nmnetl( sruax pou1alenifciat mDel( onu4 rxnmr3oa1fa ranvils0teur(o io1apt mnesa(fa2ra(mpnt4alx moeiltfa emuvsn(4 leoifcto1omD  i ils  2tmxrpio1lmt  iet ( aDtr(m oo4aptnmo3tadls2ulnvpn(4trxrir to1opDean o;( tetmio3nydll e nvsa() 2rrum ou0aptn f3ilslaDrlnmo;u)tltnxoctatlm  luesl(0 euoxm iy1opeemncsltfsDua(mpoo0apt mfcilslaDra(vo (4aetrxf3oo1lpDraivols)seurim iy4omen fetas) 2ur(m nt1oexnio3iltfs rlnvs;(4artnifcty1lm   nvi t)t2ur(r iy4openmnei ()arta(ronu1apto oeiat s2rmnmo t0alerio3tadlmtrluvo t0s2xr(m nodoltnlicsl()arumum ot4tpx mfeiysfs rau p t0texrifcoydomDran i;s  2uoxr iudal nlncilsf 2trxr ;t0altnmoetydfa2ea(vs;u)trermfciydopDelnes (  eurxm io4ap e fcsasfsrurxmo;o4tlxnmoetydla ul(vp t)tlenxoctatfaDranvi;t0srtmxm3io4ll n fcs t a2ua(rpou0ope ioetls m emnmpnu) lxoircia1om   ues;t srtrio3nu1open ncil( aDrax pnt4aexnii3iltla2umuvp;u0 lxoxrcoodomte uvsls0 2urir io4lpte fctl( sDua(  oo4altniieilslaDeanvsnt0 rxrir ta1laDrlnvs s0 exmxopiu4lm  mnviltfa2ur( p;o0tptnifctlslm2el( o;t4artoif3iotomD anei;()t2toir3oy4apteliet s aDrm( ono0alxo ieiyd m2umnmsnu0tltoxf3ty1op e n ilt  rto(r nodlm nmnvtas)s2umurpno4oeen feiytlaDranvp;t4teeomo iodlptelnvol(0t2uoim3oo4ape lnetls)artrur ot1tptnmoctytfa elump u4 ltnxf iodfmt  nvi;(0t2tmim3iodam  mnctas s2taxro;u1tleomo3iytfm2emuvs;() ltnmf3oatfpDrlivs;()s2umirpnu1lmee fetlt) Dtmumpou1apt mo3iatlmDrln s;t0treomf ootfm e n o ()trumxm iu4lltnliviatf Dtr( p;t1olto ieiysfaDuan s ()tltoiocoydlpDe n o;()sexmxr3nu1olenliei tfarta(mpno0tptn iciltls2eluvo u) eenio todomte i o;s0s2xrxmpiudape lncil() Drmxro;o4oex  feiys m2rlu o;()aexomr3iodoateaues;t0 rxrim3iu4ol nlfvia(  Dtmumo;u0openii3iydfs rauvp;u)tlxomrciadoa e ieo (  rumxm3oo4lpeelfet sfa2uaxro;t0opt if3iysfsDelums;t)aeenmoctydlp r u i t s2trio3io4omeemnvtlsfaDurxro;o4altnmoctasfa2rauvp t4trxrmo to1opt  nei t setr(m3iudam eliet t  2rrxm nt0olen o3tlsfsDran snt0teermf3iydlp  aies s0teurxr3ny4omtemncsa(faDta(r no4alx  ociyt sDem(mo u4aeeoxr iatfmDrlieil(0t2uo(o nodlmeeliviltf Duru ono4oetomieild sDuaums t4 rtnif oydlptraivs;t0 2xrxm3oydape lnei sfaDrr(  ;t1aeeoiietytlm eln pnu) rxnxf3oodom  aueol()srurio iy1lp emnvt (f rtrxrpot4aeen o3ildfsDrl(mo t4tlxrmrcta1latrauesls  ruo(r3nydlm  mfeta(fa2raxrono4oexnifctyt mDrl(ms;u4 lenxf oadoptrlivo (0s2urxr oo1al nlivslt)aDrru  nt4apeomfeiadfm uau o;u) lenir3totfpDeli i;(0srxmxmpiudlltelnetasfsDtauront1apt io3iatfs rm( s;(4teeoxf3oytfptrluvilt0 rurio3iy1llenmncs s  2rrumooo0opxomiciydlm2uan o;t) leoircoa1om rai ol( s2urir3nudole mnet s)a2tau onu1aet mo3tls s2um(vs (4 eerxfctatfp e ueslt)s2uoio oodll  mfetls artrx pno1oexoifetytlm rlu s;t)aetoxf iytoat  u olt seum(o ny4llt  fvt (  2rm(rono1tpe iociadla umnmp;t4texrxo3oy1fmte neo s)srtrim iu4apeemivtatfaDraur no1tle mi3ildfm eanvo ()aexnir3tydfm rliei () etoxo3no1omen neta(f Dtmu ono1oexn ociytfm2ra( pn(4 leomo iatlaD au o;s)tetmxo nu1olt  ict t aDraxm ;t4aetnmfeildla ea(ms u)artomrctotfmD livslt texrxopno1ap  mfcia(fsrtmuroou0olt mfetatfaDuluvpn()artrmf3ty1oat  nvslt0 2urxopiy1open fesa(  rrax pnt1ape ifcildla rau o (0 etrxr ta1fpDe ues;(0tetm(o3iodom  livtl() rumxmpnt4opx iiciytfaDrl(vo ()tetrif ootfaD  ueo (0texr(opno1aleelnes tfarumu  nt1alx if3ils s2eau pn(0tltrmf tadfa   uvsls  2toiopou1lm   fctls)sDraxmpoo1oeeomoctyd s2rmnms u4tltnir3tatlmtraivs;t tetrxo3nu1omte ivi tfs2uau pnt4oeto fciad a2eln ont4teeoxoctatoa   uei s)srxmirpnydaptnmics () 2taum ot1tlxoifciytla el(vonu0alxrmf tadlp eai ol(0t2uoxr3oydaleelivtltfa2tm( oou0olt ifciat aDelnmpnt0trtnmfcoadoaDr u o;s0 2toiopiydopt mfetas  2tr(rpot1aeeniiciyt mDemnvp;() ltrio ootfa  au sls seurio3oy4omee netasfa2ua(m oo1tetnmo3iadlmDrlnvonu0trenxo iytom   ueols  2xm(r3io1op  mnviasfs2ra(m no4apxoifetlslm2ulnmsnt)arenir3tytlptelnvo;(0t2toirpiu1omeelfciltf 2rrx pou4oeeomfctysfa2eanvo;t0 rermf iy1omt livsl( seuoimpio1omte ietls s2tau oot1tlxomicilsfm rm( on() exomo3iy1lpD lneils0srxmxrpiu1op  mnei s s2rr(  no1oetn ictat mDrm(vo;u0 lxnmf3to1fmteaieo;t0 etrxopio1lpe  iviasfsrrau poo0tlx  o3iad sDeln o;u)arenxociydoatrau ils0t2urim io4oleelivtas)aDumxmpou1oee  ieiaslmDrlnvo t4aeenmf iodfatelneil( seur(o iodlleelfcsa(  rtmxrpnu0opto i3ilslm2ul(vp;u) lenmociy1fpDelneslt  2uo(rpiudop   ieia()artrx p;o4opxoio3iadlaDra(vp;t4alenir3iydfptr iesls) rurxo ny4ll e ieslsfs2ta(  no4oeeoio3iadfa2ulumpnu4artnmo iytlat  u i (0t2tm(opiy4ale lfvt t sDraur nu1optnmoetasfs2rmumo;() eermo iatlpDeaueil()trxr(m3oo1lpeeliesa(fa2uaxr ;u0olt moctatfsDumnvs;(0trtoir oa1faDeaueo s  etm(mpiu1lmtn net sfaDta(  nu0tetnmietatfaDemu sn(0aeeoif iatlp rlu i;( seumxm3io4opee iviat aruax oot4tptn oeils a el(msnt4alxrir oytfm e ieo;t)setrxm3iy1lmtnlicslsfsDtrxmont0tpenmicild a emuvpn(0tlxnxo3oytfmtr u sls texm(rpno1oltnlieta(fa2taur ou4tetnmo3ildfaDuaumpnt) eerxf3iytoa rauvolt  rumxopnudlmeelneias) rrrxm ;o0tpxoiietlsla2rl( onu0teerif3todfa rau s (0 exoim3ou1lmenmnvi s)artaum ;u0apt mo3ildfa elnvp;(0alenmr ta1la  lu s;t t2tmir oo4altelieil()s2rax  oo1apxn o3iatlm2eau p;t)alxoif3ootoaDeau s;(0 2xoxo3iu4lp  lfeslsfsDta(r no1aptn icilt sDuaump;t0aetrifciatop rau s t)setoio iu4lle  ict tfsDtrur ;u4altoioeiytfs rluvs u)teeriocto1opt aieo;(0 rumxm3nodal elfesasfa2uaxm ou0apxomoetasls ulnvs ()aeeoif3iotlp  au i t)t2xoio3oy1lme mncilt  Drr(monu1tpenmoeiydls2em(vs;() rtnmoctotopDrlues;() exr(rpoo1lmt mnetl(  Drrur no4aet  i3iat s2umump;(4 eeoir oo1fm r ivolt teuoim ou1op  lfvtat  rrm(m ;o1olxo ociltla rlnvs;t4tetrmf to1fmtraues t  2tr(r3iu4ap emivt sfsrururoot1alxomieias mDuaumo;(4 etoxf oy1lm   n i;t0 2tm(o nu1altnmnvtatfaDrrur ;o1tpx  fcils a elnmpn(0 rxoxrctotom eln s t  rxrim oudaptemfct tfs2tmxm ou1tpx mf3iltls ul(vp () ltoxfciytoatraneo t0 2xrxm3iydap emfci ( sDtaur nt0alenii3iat aDea(vpnt4tlermf oytomtr ivi t)srtmirpno4omtelieil( srtr(rp;u0alt  i3tys aDulnvpnt0trtnir todfm eluvs (0 2xmim nudlmtemnet ( a2uaxr oo0oee mfeiadfaDuaump;u4 lenircta1opteanes s tetm(o3ou4ll nmnvi t  rrr(  nt4oltn f3iyt mDran pnt0 exoir iydlm e iei;t)t2umxr3ou4ame licsl(  2urxm nt4apxn iciltla2uln o t) ltnio tytlptelnvols) rtmim3nudlmeemnvs s)sruaur nt0aex mf3tydfm eanvon(4aetoiocoadfm eanvo;t0 exmir iu4ame mieiasfsrrrxr ;o1tetn fciydfsDrm( pn()tlenmf3tytlpDeln ilt0 eumxopoudaleemfesas)a2urxr ;t0opx mietys m2elnvo;u) reniocoytlaD aneo;t srumiopiy4ame lnct (  rumu oot0opxoii3iyslaDeaump;()alenio tatfm e uesl(0trurxmpoudole  ncslt)srrr(m ;o1aet ifciysla ean s;u) rxrmf3oo1latelueo () rxr(rpiodlpt mieta() 2raurpnu1oeeomo3iyslm2eauvont0 lxoircoo1lm e ueo ( trur(r3nodapenmfvta( aDtmumpot1apxnmoetld aDum( p (4 exrmrcto1fp ranvo s)truoim ny1alee neiat)aDrr(r ;t1tpenmfetltfsDua( ont)tlxrmf3iotop  liei (0teur(mpny4lp  lncsa(fsrrmxm ;o1tlt ioeiatls2uan s;(4aetrio3totfm  livsls0srxoxm3ny4lm nlieilt s2raxronu0olx mfeiasls um(vs t0areoir oa1lpD anvs;s0t2trio3nydaltelnvtat)artaxr ;u4apenioeiytla2rm(mp t4trtoio oatfm r ivs t)s2tmxo3io4lmt  fvt (  Durxr ou4alxoiociasfa umuvp t)trenir oo1fa eaivo t)seuoxr3oydlme liei t aDrrx  ;o0oetnmf3iadls2elnvp (0treoio iy1op  ln i;s0setmxo oydll   iei t)a2rm(monu0ole  o3tldfs2el( sn(4arxnxr iatfat  ueolt t2trir3oudam elnes t) Drrxm ;o1tpeniieilslm rl( pnu)alenmfcoydlmDeaivs ( texr(opnodlpt  fvslt)arur(r nu4opxomictas aDulu s;(4trerir tatopteli o (0tetrim oo4omee fcs s sDra(moot4altnif3iatlmDem(vsnt0 etrxo iatoatrli o;s0seuoim3iu1olt lics s) Dtaumo;u1oeeoio3iatls uaump;u4aeerioctodomDraues t0 euoim oodomtn ivi t) 2ua(mo;t1apt  o3iysfaDea( onu0 rtomr3to1oaDeli i s0t2xm(rpoy4lp e nes ()artaxm ;u0opto oeildfm rmumo;t4texoio3todfpDe ieo;t0t2ur(r nudllte nei s) rurxmont0tltnioctys s2ra(mo;u4arermf3ta1laD  nvo;() exo(opoy4aptn nvs sf rum(mpnu4oeenmf3ias s2rau s u) etoif3todlm rai s s seur(o3oodalen icsltf rururpot4olto o3iyslaDemumpnt0texoio oadlp r u i () exr(o3iy4omt  iciat  Duaur ou1tpto fctlsfs2ua(monu4aexnmrciodop rauei t)teuoim3iy1llen nes sf 2rmxro;u0altnmieiltfm2rm(ms t)tetrxr oatfa rai i t)t2xrirpno1op nlfvil() 2rrxrpnt0texnmocilt s rauvo u4tetrmrciytfpt anes;s  ruoirpnudlp  lnviat)s2um( ooo4teeniieiytfa2emuvs;t4aetoxo3oy1oaDeaueo;s)seto(o3ny1lme licia(f Dtmxmp;u4apt  i3ils a2em(mp t)aexomrcootomtrlivs (0srtmxm nodolenlicil(fsDrmx pot0openif3tlt a2eanmp;(4artnmr3iatfptr u sls0teuo(o iu4al emnei tf Dra(m no0olxniiciyd s uaumo;(0texnircto1fpDr ivo;()tetrxm3no1am e fetl(fs2uaxront1tpto oeiatfa rmuvs;u0 rxrio oydlpD  n o;s srtmxopoy4al   nvs t)artrur ;t1aeeomf3iad m2emu snu) rerxf iatopte uvo;t srtmxo3oo1ap  lncilsfs2rm(rpnt4opeomo3iadfm rl( s t4 lxriocta1fp elivs;t0seto(mpoo1llte iet t) Dururpnu0tpenmf3ilsls2ua(vp;u) ltomf tydfpt  n i;t0 rtoxr3oudolt lnetl() ruaxro;u1olt ifciltfm eluvpnu4teenxfcio1opDe ivsls0 etoxrpno1optelietls  Dumx  ;t1oltn f3iasla ua( snt0 rxoxf iydfm r nvo (0sexoim3iodoptemfvi s)sDua(m nu1aetn fciltlm2ea(mp;u)artnircoa1oaDeluei t)srumxr nydlmeelnvsa( arrrumooo1oltnmicild s2ulnvon(4 rxoif3ta1fateli s;(0t2xrir3io1ap   nvils)s2umurooo4tpxniictys m eauvp;(0trtoxo oodoptr neo;t  eumxm ou4ope lfvt ()sDrm(  ;u1oex  ociltfa2rl(ms;t0aetoif3iydfpDe uvi;(0 2urxo nudolenmnvi t  rumur ;t1olen octlsfa rm( s (0tltrmo3tatfp eai i t trxmim iu1amen fesatfarrau  nu4olto o3iytfm2emuvo;() etnxo3oa1fmte n o;t  exrio iu4apenlnviltfsrurxmont0ole  ocilsfsDrl(mont4arxoif3oa1fm rluvolt seumxm io1op nlfetatfarrax  ;t4oeto f3ilt sDuanvs (4altrmrcoytoat aiesls0 2to(o ny4lp nmfes ( s2rmx  nu1oltnmi3iytfm2rauvs;u0aexnmf totfaDrluvi ( s2xmxrpoydamtemivils a2umx ono4tet ifetlt a rmu o (0treoxo to1om  lnei t) etrxo3nodap eliet (f rtrxrooo4altomfciys s ra(mo;u4 exomfciadom r n o;(0trtmim3ou1lm elneiasfartaur ou0teeo f3iatfa ra(vp;t) etoxf3iodoa e u olt)trurimpnu1ome lnvia()sDuau o;t0oet  fetydlm2el(vpnu0aexnmr3ootlaDraieslt) 2tr(o oydape lncil(  Drm(r ;t1oexoio3iltfm2rmuvonu4aeermr tytfaDe ies;t) eumxr nu4optn nvs tfaDtm(ro;u4oltn fciat m umnmpnu)tetnxr3iy1opDe nvi;s srtrim ou1ll  livs s)srtmx ont0ole ifeilsla uauvo t0arenxfciatoptrli i s  rto(o iy4aleemiviat srtau onu4oexnmf3ild s2umnmo u0aeenxo3oy1fm ranvolt) rumxmpou4apte fetat srrrx o;o0oet moetltfa elnvonu0 lxomr3ootoa r n ils)s2tr(mpoydame  nctas  2raurp;o1aleoii3tyd aDrmu s () lerif3oa1opDeau s;(0srur(r3oo1ol  lics t)aDtrur ot4apxo fciysfsDrlums;u) etomoctadoaDeau i;s)s2xoxr3iudap nmnesat)sDra(ro;o4oeenii3ias s rm( o;t)arxnmr3ty1fatr uvsls srtoxrpno4amtnlnvs t s2tax  no1aptomietydlm2ul(vo;(0 rerxrcto1omtraivs t0 rxmir iydalenlici s artrx  oo0tltoiictytfa2el(vpnu)alenif ia1fa   neolt0 2uoirpoydol nlici s) 2rrxmpno0opxomieiyslmDum(mp;u0trtnxf3oytomDrlivo s0 exoxo3oy4oltemivtls)sDtr(m ot1tpe  ieiytfa umnvpnt0aleomo3oy1omD anes;s srtm(opiy1olt licta( sDurx pno1tltoiieiyt m2rlums u0 eeoxo3iytlmtr neo (0s2xoim3oodole licilt arumxmo;t4tex ioeiasfaDeln pnu0tlxrxo tytom eau i ( s2tm(o nu4lle lfei tfaDuaur ;o0tlx mictls m ea(mpn()trtrir3ta1fmD aues;t  exrxo iy1ol nlnei t) 2rm(  ou0tltomictasla ul(mo;(0 eenmo3iytomt  u o;t)teuoim iydlp emnvsat)sDtm(r oo4tpeo f3iltlm rauvpn()trenio3iytoateaneo;t0t2xrxopoo1om  mncias sDuaxm ;t1tpe  fetasfs2umnmp t0 lxrif3todla e n s t0s2uoim3io1olt mnvil(fsrtm(m nt0oleo f3ils s um(vp;u4 etrmo3tydlaDeluvs;s trurimpnu4ap nmfeil(fartaurpnu1tltnmocilslaDeanvp u4 lxoir iatoatr i ils)srxm(opnydlm n fesls) rrr(  nt4aeeo i3iydfm2rl(vp;() renxo3to1laD anvi;s srtmxo3ny1ap   nei t) 2ta( ono4tlxomiciytfs2uauvpnu) ltoir iotfmt  u o;t teto(r oy4olee ieia(fs2um( pou0tex moetasfmDuluvo u)alerio3ty1lpt  uvi;t)s2um(r iy1lmtnliei s)sDrr(root4oeenmictysfm2ua(vo (4altoifcta1fmteluvslt0seuoxm nodll  mivi ()s2rrx ont1alxn oeilsfsDem(von()aleoxfcoadomD  n s t  ruo(opiy1op  lnct tfsDtm(ro;t1oexoioctys aDrauvs;t0 rtoio iadlpDrlueo;t) 2xrio3nodame  ieiltfa2uru  nt0oex mi3ias a2ul( o u4alxoxocto1fp eaueils)tetrio3oy4om e nvt t sDrruroot0oetoiictldfa ra(msnu4alxomrcootlaDelnvi ()s2xoir oo4lmtnmfvs () 2rrum oo1ope moeiltfmDem( p (0 leomrcta1fptelieols  rxoxm ou1ll  lnct s) rum(ro;o4alxo fciysls2rmumpn()aetnmfciodfm  luvi ( t2umxmpiu1lmt lfei t)sDrr(rooo4tpeomfctydlmDul( sn(0 lxrmo3iydlpteanvi;t texm(m iodlmeelfct s  2trum nu0tlxniiciad m2umn p;u0tlenmr iatlpDe u i;t0 rxmxm iydol nmfetlsf rtax pou4aet mi3iydlmDemnvpn(4aexomf to1lm e ivo;s setr(m oudlp   fesatf 2tm(rpnt1optoiieild s2emuvon(4tlxrmo3ty1op eau o;t0 rxrxm nodllen ivs tf rua(rp;t1optomo3tltfa2ea(vpn(4tltnmr oatlpte u slt0srurxm3iy4aptemfeilt)aDtm( onu4tetn octltfa elums;u) etrifcootfmDranvo;t tetoxr3oydale lfcilsf 2uaumpou4apxnmfctadfm2rm( s;t) exrif3ia1oat  ieo () 2urxm oy4altn ictatf rrr(rpot0teenmiciatlm2uluvpnu)tltrmr tytlpt  i i;t) euoio ou4ame lfvt (  rtr(rp;o4oeenii3iysfaDrlnvp u)altoxfciodfa e neol(0s2tr(o nodlm nlicia(  rtrum ;u0oex  fetldlsDemn pn()tlxrxo oytopDe ueils  exm(r3iu1aleemfet (fsrtrxmont4opxo feildfaDeauvo t0tleomfcoodop   ues;s)setr(opio4apenliesa() Dumur ot0ale mo3ildlmDrmu ont0trxrxf iadlm eauvo (0sruoxo iu1amee nvt t) Dtm(rp;u4tpen oeiat s2ra(vp;t0arxomociatlmD an sl(0tetrxm nu1oltelnctlt)srrax pou4apen oeiat sDumnvo;u4 lxoio iotlmDeau sls) rtoxr3iydamt lfetlt)a2urxr no0tpen octytlm2um(mo t4alenxo todlptraivi;t)trtrimpou4apeelnvtlt s2ur(  ;u4tpen ocilt sDumuvs;u4teeoxf io1fatraies;t0s2uo(o3iy1amee ies ()aDtaxrpot1texnii3iltfm em( ont4 eeoxr3oadoa elnvsls)s2xmxr ou1apenmfctasf Dtru oou0olx iieiys a ra(vs;() lxomo3ia1oa ranvs s0 etmio ny1am elfvil( s2rauroou4opto ocildla rln on(0 eeomf iadlm eanei (0 rtmxo nudaltn nctlsf 2um( ooo4tle mictyslsDeauvo;u4tlxoifctadfptr nesls trxr(o ny4lm n ictatf 2rr(m ot1olenio3taslm ul( s;u)tlenmo oytomD ai ol(  exm(m3io1ap elfesls)srra( pnt0tptoiictad a2ulu on() eerif totom ranvs s t2xrirpoo1lm elfeias) 2tau ono4tpxnifciysfaDumnms;()aexoir iytoptr u ol()truoxo iy4lltn ncia() Durur oo0oee mi3iaslsDelnvpnu4 rtomociydla   uvs;(0trxoim nudom  mfvi t  rrr( pnu0oexn ieildlmDum( s;(0 eeoircty1lpt lieol(0trxoirpio1amenmiei t  rtax oou0tetnifciydlmDulu o u4 rxnxo3oy1lpDelieo s0t2tmirpio4oltnlneta()aDrm( pnt4oee mi3ils aDea(mon(0tetoifcio1opte iei (0trumxopoudlle  iesl(fsrurumonu1altnmoctaslm2ea(mo;t4texomf3oadoa elnvi t0s2xm(opou1alen fcias)a2rr( o;u4olxn o3iad s elu o t4aeerirciy1lpte ivs t0t2toxr3oydame mnetlt)a2ur(monu4ope  feias m uan on()texoir ty1fa eaivi t0sexo(r no4ole mfetas) 2rauront0olxomfeildfs ua( s;(4 leoircto1omteai o;(  eto(mpoodalt lneta(f Duax pot1tlxoifetltls eanmpnu4 rtnio ia1omDe ueslt)t2umxrpno4apenmiei t sDrrxmpou4tlxniociydfsDuanmpnu0alxoif iotoaDelnvs;s srurio nu4llte ietl(faDua(mpnt0ole  f3iydfm umu s u4aeermrcoadopteauvo;()srurir nu4ome licsltfartrxmo;u4oeto i3tas s eln sn() reoxfciydlpDrau o ( srtoirpiu1ale  ivs t artmu pnt1aptn ieiysfa2rl( s t0 exrxo ta1oatelnvi () exr(r nu1lltn fciat  Dum(rp;o4opxnmoetls aDuaumo t) rtomo3oatlate uei;s0texo(mpiu1optnlnvt s s2um(  no4oexoio3tls a um(mp t0artrir totla e n ilt trtrir3oydlle  nei s)s2ua( oot4tpx mo3iyd m rmuvont4 ltrxfcootomte uvo ( tetmxo3no4altnmneia(  rtmxr ;o0oeen oetasfm rm(vo;(0aeerxr3iadfat ai sls)t2urxm io1ap nmfcs (f Dta(m oo1opxniicildfm rm(mp u0arenxo ty1fpD  uvo ( t2uriopiodoltnlfei sfs2urxm oo4oee mo3tldfs emn onu4 ltrmf todlaD aivs s t2xm(m3nudlpe lict () 2taumpot0aex if3ias sDrlnvpnt) lxrxr3oatfaD lieolt0seuoio3oo1lm   ivsl(fsDraxr ;o4tee mf3ilslmDranvon(4artnio3to1op   n i;t)tetmiopiy4lmtemnesa( sDrrurp;t1oee  feias mDrluvs;() etnxrcto1fm eauvs t  rtr(m3nydap e nvs ( artr(rpoo4opeomfetydlmDrau pn(4arxomo3iytfm r uvs;s0sruoirpio1lmtemicia(  Duau  ;u4tetn i3iltls rmuvp t)trtnxfciy1fp  aivil()srxmimpno1alee netlt  Dtm(rpno0ape  ocildla ulu p u)trermf tadfmtr iei t) eto(m3iy1aptemicsat sDraump;o0tltniociatlaDelnvs;t4altrxo3ty1opt li sl(0t2xr(mpou1opt licia( aDtaurp;t4olt  iciytlaDelu p u)arerxr3oatop ean sls)texmim3nydape  nvi ( s2rmxmonu4aleomfciysla rlu on(0 lxoiocoa1lp rln ilt t2xm(m3iy4ame mfcsltfsrrm( ont1aexniictadlmDem(mo;()teerxo ia1fa   ueo;( trxmxrpno4ap emfvt sfaDtmxm oo0opx mi3tyt m2uanmo;() lenmfcty1la r n o;(0s2xoir3oo1omenmfei tfa2taxro;o0alen octytla el(ms () rtoxr oy1lpD lu o t0sexr(o3ny4lltnmiviat) 2ur( pnt0alxoiictas m2ua(ms t) rtrxr3iadfp eaueo (0setm(r ou4lm elfvslt sDtr(mont1tpeomoctldfs2rl(msnu4tleriocta1opt  ivilt0 2xoiopoo4lleemiesatfaDrru  ;o0tlx ifeilt mDelnmp u4 lxrif3ootlmDrluesl() etmxm3oydapen ici tfsDua(r ;u0apto f3iyd m ra(vo u4 rermf oa1oate ivols)t2um(o io4ole  fct t  Durxrono0tlxo ociltfa2emn s;t4tetrifcto1lp e nei s  2ur(r3ou1ameemnci (faDurump;t1tex mietldls2ul( pnu0tetrxf3oydop e n i s0s2uo(r nydalenlnvt t srra(rp;o4opt mo3taslmDel( pnu)tltrmfctatop   nvi;t s2xrxm3io1lp  lfesl()arurxr ;o1ale  i3taslaDemuvsn(0 rtnmocoodfp  au s;(0 2uo(o iu4optelnviat)a2tmumo;o0aleomfcilsfa ea( p;()teermf to1om  aivolt seum(m nu1ape mietas) 2uaxr ou1oex mo3iydfs emuvp u)artrxf3ty1oatraivo;t teuo(opny4amtnmfeta( s2uau  ;o0aptnmoeiad s2umnmp;u0aetomociydfa r iei t srxrimpou1op  lici (fa2rr( o;u0aetomoeils mDeau s (0 ltnxo3tadoaDrlnvolt0setmxo3iu4olt lncsls)a2tmxrpnu4tpeniictldlaDel(mp (4aeeoifctodoa  aivil()s2xmio3nudll nmfetl( s2rrumo;u4texn ictat mDranvsnu)tleomociydlatrli s t0t2trxm ou4alen net () rumxrp;o4aptn o3ildfm2rmu pn(4 leniocia1oaDe ies () 2tmio3iudoltelietat) 2uax o;t0oetnif3ilsls rluvo t4 ltoxr oodfptr i olt texm(m3iudaptelfciltfa2trxm no4ole io3iadfsDrl(mp;() rtnxrcoytom  an sl(0tetm(mpio1altemnetl(f 2rmurpnu1oee ifciadfm2ean o;u4 etoxr3tytfpDrau o;s  exoxr nodol elictatfsrtrur no0aleoiieildfs eln s (0trxrmrciotomD luvi s  rtoxopnydomenmnctl()artrx onu0tpeoio3iltfsDrm( s t4arxnmrcootomt auvo t0t2toir3oy4ap  lfeias)srtaxmont1texoif3tytfa emnmo u0tltnmfcto1lmtr u o t0t2xrio oo4lp elfcilsfs2uau  nu1aetomoctad a2uln sn(0 rtrif tytlaDrai o;s)trur(rpnodamee icsas)srum(m ;t1tee iictlsls ulu s;t4 rerif iy1op   u ilt) euoxm iydlmt  feil(farta(moot1teto iciadla emuvpnt0tltnir todlaDe i s t  exm(r3nudaleemnvs (fa2taum ;u4optn icias m2umnvont)tlxrxo3tadfm e ueo;t)setm(m3iydap   netlsf Dtrxrpno1oltomf3iasfa2rlnvs;t)aeenxf ia1oatelues ()srtmxrpoy4al nlivtas)a2taum ;o1tee mfciadlmDumu s u)aeenmocoydopDran i;t) 2ur(r3nu4op n netlt)aDtrurp;o0ole if3tadfmDrau p;()teeoxf ia1oaDeanvo t  2xmir3nydal n ivi (faDtmu  ;o1oexn o3iyslaDraumsn(0alenir3tatomt aivs;t0 eto(m3nu1apeemfvilt)sDrmump;t0tetoiiciadlsDran snu4 ltoxociydlm  aivi (0tetm(m iy1op   nvs s)sDrmx o;u4alen ietysfm ran s;() ltoxfctodfpteaieo;t)tetrim3io1oltn feia() 2umxr ou4alx mf3iatlaDuaumo;() exnmf3oy1la  au i;( tetrir iudlptelfcsas s2trx onu4ale mf3ildla2uanvs t0alxoirctadfpt lieil(0 2ur(mpnu1ole livt s) rumxmpnt4oltomo3tydfm2eln s u4tetrxr3oa1opt anei;s0texrxm3oodllenliviasf Drmurpnt0teeoifcildfs emnmo (4artrxf oydfa eln o;( t2trir3iydlptn icil( aDum(  ou1aeeomo3iasls2elu sn(0tlxnxrcty1fmtr i o (0 rur(o3ou1ll e fvslsfsrrau  nu1aexo fciad s ulumo;(4 exrmfcoadomt aueils)t2toxo iydapenlneil(f 2um(r ;u0tee  ieilsfsDrmu snt0aleomr3iytoa rlu i;t  rtmiopoy1lptemfeiltf 2tm(rpot0tptnmictyt s um(vp u)aetnxfciy1omteaivi;t t2uriopnodapee nvilt)aDra(rpnt0aee io3taslaDuanmpnt)alxrio3iotla   iei t setmxrpoo4olte ici ()aDuru o;u4oee  i3ildfaDrluvpnu)alxnioctadop rluvi;s)srtrxr3oo1lm nmnvi t)s2ua(r oo1olenmfetat a2ua( ont) lerxf3ootoaDeaiei ( s2xoxm3no4ll nlfci tfartau  ot4tpxomi3tydfmDranmo;t0tltrio3oadomDrlueo s0s2uo(r nu4al n ici s s2taum ;u4tptoio3ils aDea( s ()trtnir iatfm  aueo (0teumxm3ny4llte fcs tfsruaxmpou4tpxnifetaslm eauvs (0 ltrxf3oytomtrlieils)s2tr(opiodal e neilsfsrraurpnt0optomf3ias a2rlnms t)alerir3ootfpt auvol()trumxm ny1al  livtlsfartm(rpno1tptnmi3iadfa2umu snt)tlxomocta1fmtrliesl( trxoxo iodameelivt s a2ur(mpoo4aptnmi3ildlmDumu o ()alenmfcio1lptr i o;()trtmxmpnu1ll emnetl()s2umur nt0opx ii3iyslmDumnmon(4aleoxfctytlat ln s;s seurir iu4ll n icil()a2rm(mp;o1aexo feiydla2el( s t4 reomocoytfat  neo ()truoio oodomenlnei (  rtaumooo0aet mfciadla2rluvs t4alxoxr iatfmDeaues s srxoxr3iudlptelfvilt)a2uauro;u1opxomf3iydfsDrau pnu0 eenxrciatlmD anvi;t)texo(opou4lptnmfcta() Drrx  nt0opxomfeiysfa elu p u)artnmf3io1fateln sls)srurxr ou4lmtelnvslsfa2tr(  nt4opeomiciaslsDum( snt)tlxomocoodoa eai s s)t2toio ny4omeelfvia(fsDtaur ;t0optnifciyt sDeanvs t)arxomr3tytfm rlieolt)seur(r3oy4aleemneiat  2trumooo1apxoio3ilslm2um( p t4 lenxfcoytfaDelies ()texoio3nodll  lfesls s2rrump;o1teeniictas s ulnmp;() lxrmfciodlaDr nvsls) ruoio oodlmt  iviat) rurxm ;t0optnmieiydlmDrl(vo;t) renxfcoydfm  luvi t  2tmxo oy1op  mnvtat)sDuaxrpnt0tlt  i3tydls2ra(vpnu4artoio3oadla rli sls0trtm(m iodoltnmfei s a2umx  no0tlxo ictltfaDuan on(4 lenxf3tadom  aueo s)sruo(r3oy4optnmnviatfa2ra(mo;o0oeeoifetadlm2rl( p;() rxoir oadla eaieo;s srxr(r3oo1ol elncil() 2tm( p;t0ole ii3ilsfsDem( p u0tltnif oytlmt lieo t)t2uo(m3iu1omt  fes t)s2rm(mp;u0tpx  i3ild a2el( p;u0tetomr3tatlateluvo ( sexo(r3iydamtelnvtlt  rrrx pnt4opto iciyd s2eaums;(4alxrxfctotomDean i t)texm(m oydlptelfeta()sDumurp;t0tpxoioctyt sDelnvsnt)trxnxr iotlmtrlues t  euoxo3iu1omt  netat sDum(rp;t0tleoioctlsfa2rmnmp;(4tlermfcoydfat auvi;( trtoxo3ny4ome  nctatfaDrrumpou4tlx micild a ua(ms (4tlenmo iytom rluvs;t)s2xmim ny4lltelnvsa( s2rmx  ;t1aee  iciaslm ua(vo u4alxoxoctadla rlueo;(0teurxmpoo1opt  ivsls sruau oot0ole moeiat m2rmn pn() rxoiocootlatrai i ()sexmimpoy1omtemicil( a2tmxmpoo1aetnmo3tad aDel( p t4artrmfciydlm eaies;(0 ruoim nydlltnlnes t)s2uax oot4apxo ictltls2umu p;u0aeerxr3iotlaDeai ol()s2tr(r oy4omtnmicsls  Duaxr nt4aeenmo3iyd a um(ms;(0texomfcto1lp e nvs;s s2ur(o3nydopeemfcsas) rururooo1aeeoiociat s ranvo;()tlxnxo oodfaD lneol()srtmxrpio4omt mncs tfsrrrxmooo1olenmfciysfm rm(vo (0trxrxr3oodomt  ueolt)setrxr3iy4om e nvtl()aDrrumo;u1ope ii3ildfa2umu p (4tltnmf to1fp elnvi t srxoirpoydaltemnet t) Dta( o;u1texo o3tlsfaDel(ms () etnxrctadoatr i ilt) 2tmxm3oo4amt mfcs s) Duax  oo1aeeo i3ilsfm2emuvs;()areoxo oo1oa   ies t seuo(r nydopt  nvia()srrax ono4tpx  oetatfa2rmuvonu0 renif iytfpteanvi;s seuoiopiu1opeemivsa() Dtru ooo4aetomicilsfs ulnvp;(4aetoifciytopD  i o;t)t2to(r oy1op e fci s)sDraxrp;t0altnmf3ildfaDrm( s;(0 ltoxr3iodopDeaivs s)s2tmiopnu4ll elivs ()srrmuront0apxnmiciydfa rm(mp;()aexrir3iodfmtr uvolt0srurir3oodlpeemfeia(faruax pnt0tleomociatlsDrm( s;()trtomo ta1lp e n slt  rtoir oydll e ncia( aDum(mpou1tpen oetldfs ean p () eenmf iotoa rluei;(0trxmio3iydal emfvsat sDtr(m ou1aeeomiciydfm2rl(vo u)alxrxo3iytopteanvols)teumxopoo4lpe mnctas)srtaxm nt4ale  oeiasfm2umu p;u0trtomfciy1fmDrlieilt  2uoxr iy1lmtn ieias sDtmxmpno4tpe mfciatfmDum(ms t)tlenmo3ta1la r nvo (0srtoxo3io1apte fes sf Dta(r ou0tetnifetytfmDuauvp;u0tetrmociotlmD au s;t)t2tm(opiudom  lfvsatf 2umxm nt4teen ietytlaDem(vs;(4artomo oytoa e uvo s0 eurio3oodlmt lneils)sDtau poo0aex  ociytfmDumnvp;(0tetrio3ia1oatraies ()setrxo ny4apte nvi (  Dtmu pnt0tptn ictytfa2rlums u4 lerir3oy1om  luvilt)t2xm(o3nudomeemivsltfs2trxrpoo4tlxoiociytfaDra(vs;u) lxnxr iotfptelieols0truo(r oydopeemfvsls a2urum ;t4tltnifetydfm uln on()tlxoxr oadopDrli s ( texrim3nu1amte icta()s2tmxrpoo0aex if3iadfa2eanmpn(4treoxr3todopD lnvi;(0 2to(o3nu1optn fcsa( artmum oo0alxomietld s rln o u0 reoifcoytlatean ils) rtrxr nodale  fvtlt) 2rm(m ou0apeoifetltfsDrmnvonu0trerifciotlaD  u i s) rtmxopnu1oleelfctat)arur( o;o4openii3iytfa2rm(vp;u4artoxfciadop ranvsl(0teuriopiydap emfeiasfartmump;o1tpe mictaslm elnvo u0tlxoircoatoateaivo;(  rurir3iy1altnmicsl()srrm(rpnt1ope  ieias s2uluvp;t0 exrxr tadfmtr i s;s  exoimpiu4alte ncils) rtr( ono0ole  ictld m raumo t)trermr3to1latraieo t0 ruoxr3oo1optelnvt t  rra(mono4olxomfeiltlsDul(mp t)aetrxr oadfmtrli o s0 rurio3no4amt mietlsf Drr(rp;t4alxn f3iyt m umu on(0 lxoircootop   u s s0 2xr(opoodal  lieils  rumxrp;t4tltoio3iatlaDran snt)texnmocoadla eli i ()seum(m iudapte neil(  rrau p;t0tex  iciad aDulu s;(0tetoxr3oatoatrauvi;s)teuoimpoodlpte fvil( arumu  ;t0alx ioctldla2emnmpnt) exrmo3ta1omtr n s ( tetr(opny4lmt  ict tfa2rrurp;t0tpx moeildfmDrm( s;(0 exnir iytopt lnesls0texmim3ou4lmee iesa( sDtm( p;u4teen feiyt a ra(vo;(0 lxomrciytlmte nes s s2xoxr io1alt miesl(f 2rrumo;o0oetn i3tasls el( s t4 rxrxfcootopDraivi s0t2xm(r3no4ole livi t  rururpnt0alx  octlt m2ul(mp u4 rtomfcoodopDrluvs;t0 rtmir io4lme  fcs s)artmumonu4tee ifciad m ean p t0aeeriociotfptrlieo;()s2urim3ny1aleelncil(f rum(rpnu4olx mf3tltfmDemuvs;u0tetnir oatopteaivilt trxm(m iu1lm  lfci t)srum(  ot1aleo o3iadlm umumpnt4 rtrmf3oo1omteluei s)teumim iu4om nlfvs t aDtrurpot1oeto octatla rm( s;t) rxoxf3tadomt  iei;s0sexoxr oo4olt mnvta(faDrr(mp;u1oeen f3iys s2rluvp;u4treomfcia1op r i ol()srtoxr3no1oltnlfetat)artmum ot0texn ocilt mDra(vo;(4aetnxr iodomt livs;()t2to(mpoo4ame lfesas)s2tau oou4aeenmfeiltlaDeanvs;t)altoir3iotomtr uvo;s)t2ur(o oy1amtn nes s)sDuax oou0tetoifctydfm emnmp u0texnmfcoatoaDeai ol( sexoxo nudope  ieta( arua(  ;u4aetomo3tysfs ulnmont0 rermo iodlaDe i o;s)teumio3iy4ol n icil() Dtaxrpoo4aexomfciltfa emnvp u)tlxrmrciydop raueols0sruoim oo1ol nmnctasf Dumxrp;u0tpenio3tatfs2rluvo;u)areoir oodlptrli i s0sexmxm iudaltn fei tfaDrr(rp;t0alx  ieias sDeanvo;(0 renir tytopt lneo s t2urir3no4lp nmnvtl()sDrr( pno4oltnmoctasfm umn s;t)artrio oatomD livs;t)s2xo(r io4optnmnvsls)artaurpnu1alen f3iys a umu o;(0 eermr tadlpDrln i (  2urxr ny4altelfctat srum(rp;t0tleomo3ildfm rmnvpnt)altoircoytfm  auvo;t0t2trir3iudll  mivtat)srtrxro;u0aleomf3iad m ua(vp t0altrxo iadfatraneo s0t2xo(o3nydll e fetat) 2urx  ;t1aexoif3tyd m2ra(mpn(4tleoio3todlmteli o;t0 exmxm ny1lpe  iesat) 2tau o;t4tet iieiltfmDuau onu4 lenmr iydfp e i ols setoxrpou4lm  mfci () Dra(mpno0oltoio3iytla2el(mo u0alxoircta1fmtr ivs;t)trtmio3ny4omt  net ()srtaurp;o1aetnmo3iasfm uau s u) rtoxrcoa1oat lnvi t)trumxrpio1om nlnet tfsrrr( ont4tleomo3ilsfa2elu p;u) lxnmfctytfm rln s (0trtoxm3oudape lfvtatf rtmur ou1aeen feiydfs2ea( o;u4 ltomo3ta1lpDelu ilt) 2urir3iy4openmnvsat)sDtm(r no1apeoio3ias mDeluvo (0 etrxr oadlpt lnvo;t0 rtm(r oudaltemivsa(faDta(mpnu4olt  iciltls2uanmont) eeomf3ootoptrluvo ()s2xoxrpio4lm elnci t)srrm(mp;u0tltnioctytfsDelnvs (0 lxrxo3tydfmD  nvi t srxoio iydale  icsatfs2rau pnu4tpxo icildfm uln p u4arenif3io1lpD li o ()sexoxopoy1omenmicsat  Drr(rpno0ole moeiytfa2umumo;t)artnxfcoa1fmDeanes t teurim oo4ameelneslt a2rmu  ou1tpx  iciasfs2emu sn(0trtoxr oo1opt anesls0 ruo(m3oo4op emici s srtaumpnu4texn ociatfm elnms;(0 ltnmo3oadfmD lneo;s) 2toim3nodlme mietas) 2trx  no4tleniieiasfa2umump;t) exoxrcoa1omDr n ol()sexmxmpny1ope mies t  ruauronu4optoii3iytla2eanmp t0trtrmr tadoa e neils0 2trimpiy4lp   nvi t)srtr( ont0tltomfetatfm2umu p;t0 lenmoctadlateluei;t) 2trir oy4omeeliet (  2ta( ooo0texomiciltlmDem(ms;(0 lxoxf3to1la eluvs;t) rxoirpno4al nmfvsat  2uru oot1olx iociat aDemu o;u0 lxoifcoa1fptrliei s  euoir ou1ll nmncta()aDta(ronu0apxo f3iydls uaump;t)aexnir3oytlpDraiei s)s2trxr3nydapee fci sfs2rmuro;u0aetnifctlsfaDemnmp t0tlxrmfctydlmt  i sls trtrxopou1lpeelneta(faDumxrono4altomoeiadlaDuauvon()trxrir tadfpD  nvsl(0teumim3oydlmeemnei t arrmur ;t0tle mf3tlslm rlump;t4tltnmo io1fat li s t0 rxmxrpoudoltn iesat s2uaur oo4tex ioctysls eauvs ()aexomf io1lat aieslt0sexo(rpiu4lleemnctas) Dra(rpnu1olt mf3tys m rmnmon(0tlerio oo1optrln o s s2uoxmpoo4ol   nctl()aDtaxro;t4tetnmo3tas aDul(mpnu)tlxoif tatoatrauei s) rtrirpoy1alenmfvt tfsDtmxr ;t1tptnio3iad mDemu s;u) etnxr todla rln o;s0srurio io4am n icsatfs2rr(mpno0ole mf3iyt s ulumonu4tlxnxr3iy1lm rauvsl(  exmio3iodlpen nctl() rrm(  ;u0alxo fctytla2eauvsn(0tetrircoo1laDeauvo ()trxmio3oy1llt lfeils sruaumpoo1apxniiciat sDrlnmo () exrmf oytfat aueilt trtrxr iodlpenlivtl(fs2tm( ont4tpxo oeiasfmDrluvp;t0 rtrmfcoadlpDrai i t setoxm iy1altemnct t) 2um( ooo0olxnmfciyslm2el(vs;u)alxnir oatoaD  n s;()trtmim iy4am n icias  2trxr no1texoifciys sDuan ont)arxnxfctatlpDrlivslt)t2tmxr iodlmenlivsa(f 2uaxmo;u0tpe ifetadfa ul(mp t)tetnir3oa1fatranvilt)srxrio3iodlpenmietas s2raur ou0olt mociatfa uau snt0 lxoxr3iotlp ran o;s truriopiu1ol emnes s) Dtmumpoo0alt  ieiat a2emnvo u) rxomf3iodlpt  ieo () rxmio oy4open fcias srtmurpou0tle mi3tadlm2ulnvs;u)tlxnmf3iotlptelu o;( srxm(opiy4lm e fct t)aDtr(r ;u1aeeomf3tad mDum( pn(4arxnxo3iatlm e uvsl(  exoxo3iy4lmtemfctls aDraump;t1aeeoifciyt a eln o u4teeomf oy1omD auvi s s2tmir nodal  lfcs ()artmx pou0apxnmfciltlmDua( pn(0altrif iytoatr uvolt  exoio3oydamt lncta()sDtr( pot4aeto o3tldfs ra(vpnt4aexnxf3oa1omteanvolt) ruoio3ny1omtnlnvi s) 2ra(ro;u1optoio3tys a umnvs;u)aetrmo3oodla rlues t0 2xrim ny4am elncil() Dtr( pou1apxomf3tls s2umumon(4 eenif ootom r n o t0srxmxmpiy1optelivilt a2ra(  ot0oetnmfcils m ea( p t0 lenxo iadlmDran ils trxr(mpoy1optnlies (fsrrr( p;u4oexo ieiadfm emums ()trerifcoodfatrauei;t0teur(r3io4ol  mnvslt) Durumpot4apt mfctad s elu snu4 lenxf3iatfaDrluei (0 2xm(m3nudll   nvia( arraump;t4opx mi3tltfm2rmuvo u) ltomr3oodfpDrlneolt)srtoxr3nydaltemicils  2uax p;u4olt  i3tasfm ra( o;u0aetomfciatoaD lneo t)s2tm(rpio4ale licsatf Dtaxro;t4aeeo f3ils a emumpnt)trtomo iodlpDeaueo;s0 ruo(o3iu4al e ieta() 2urum nu1oeeomietatfa rmnmo;t0 reomr3oodfmD ai o s0truoirpio1oltelfvta(  Dtr(mo;o4alxo i3tasls2ulnms;u)tltnmr iadoa rauvo;s  2uoir ny4omt mfcils aDuax  nu1aex ii3tas m2uluvp;t4texrmo3iytfat aieil(0setoir nydlltnlfcsatf 2ta(r oo4oltomfcilsfsDemnmp u)aexrxo3iotlptraieo;t)trumxopnu1lpeemietas s2uau p;o4oex mictyt mDulnmpn() rxrir io1la r uesl( seumxo iodapenmncs s a2rm( pnt1aleomo3iadfm2ulnmpn() etrxr3to1laDr u s;(0teuo(m3iy4omte ncs t)sDtaxm ;t0oeenmi3iytls2rln sn(0texnio ta1lpDr ivs;s trtr(m3nu4omtelnvt () 2ta(m nu1oeeo i3iasfm ranms (4tlenif3oatfpDr iei;t t2uoxm3io4omeelics s)a2rmxmp;o1alxniietydfsDrmu
\ No newline at end of file
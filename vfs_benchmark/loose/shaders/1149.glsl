@@ -0,0 +1 @@
+nei;()s2xo(r3ou1optnliesltfs2umur ;o0apt mf3ilt a2uanvs;t0aetniociadopt auvs;s setr(o oudomenmieiat)s2rax poo1oee ioeilt aDua(ms (4treomo3ia1lpDraues t sruoio oydll  lfesl() rtr(moot0openmoctldfm um(ms;t)texnio3oo1oat luvi;s  rurxm iu4lmeemnvi ( sDrr(  ou1tlt iiciat mDrlums;u)artnmrcootopD aiei t0s2urim oo4lm nlfesa(f rtr( o;t0apt mo3ilsla elnms t4 eenir oytomtelnei t  exrir no1llt lfeia(fsDum(moou1aexo ietadlsDrl( o;t4arxrxrctatlmDeaivo;s) euoxm iy1apt mnvtas aDra( oou0tpxnmoeiltlmDrl(vo t) lxrxf3oatlm  lieilt0 2urio3oudop n icilt srrmx p;o1oetn ociatlmDuan onu0artnio ootoptean s;t0t2um(r oo4omen neia()s2trxm ;t1tex ifctlsfs2ea( o;(4 renioctatopDrlu i;()srxoio3iydap  lictasfaDururooo1tex  f3tasfa2ranvon(0alxrifctodfp eli sls  2trxrpnodol  mfvi ( a2raum ou1tet  octltfa ran o;u0artoifctytomteaiei;t0 exoio oy1lmte neilt s2uau  no0tet iietltlm emn p;u4arenxr oytfpDelu sl(0seum(m iy1lmtnlnvsls) Dum(r nu4oeeo o3iys s ean o;t4arenmr3oy1la rlues;() rur(o3oydam emneslt  Dtrx o;t0oleoio3iyt m emnvsnu4 exrmf3tadomD  ies (0 eum(rpiodamtnlnvs s)arur( ono1aeeoioeiatfm2ea( onu) lermr ia1fa   n o t0srtoir ou4olt lnvsl(fartr(mpnt0tet moeiatfa ul(vpnt) lenmrcio1lpt aivo s t2ur(r3no1al  mictls s2umxr oo4olen ieildlmDem(mp () etnxo ty1lm  au sl(0trtrim oudomt  nvi ()srra(r ;u4texoioeiasla2emu s (4 exrxf oa1op   n s ( trtr(r iy1lpenmiviasfsDrrum nt1teenioeiasfa2ra( s;t0artoio io1lp r n s t)t2xrio3ou1lm  livil()sDrax  ;u0aexomi3iydlmDranmp u0 lxnxr oodfpteaivi;t)s2umxr3oydomtn fvt s) Drm(r oo0aetomociadfm eauvo t)artrmr3tatlm rai o;(0 euoirpou1opte ictl( arua(m ou4alx iiciytla2ranvsnt)teerio io1oa rliei t0sexr(r oodol   ncilt)s2rmumpou4tpeomoeiat sDrmumpnu)altoxocto1oaD  ies;() rurxo3iy1lpt  ict t) ruauronu4tpeomoctas sDrln p t)treoxr iatom r nvo ()trxm(r3nu4lltnlivtl(faDumx oou4aexoiictld m ea(von(4arxoxo tydfmt  nvi (  2toxo3iy1am n ncia()s2rmu ooo0opt  oeiydfaDul(mp u4artnir iatlmDr iei s trtmxr nu4ll n fct t)arrmurooo0teeomieiatfmDeauvp t0tlermf3iotfpDelneils)trur(mpiodop n fcsa() rumu  ;u4aetoif3iat m ranmp;t4tlxrxfctodfpteluvs;()t2xo(mpoo1ap  lictls  2ur(mpnt0texoio3iyt m2rl( p u4 eerio iatla e neo;s0truoxo iy1lmtn iei t arrru pot4oexoio3iasfs2rl( p t4altrir3iadfmt luvilt s2umxm no4omtn netlt)aDrmumooo0opto fciasfa ulnmpn(0 exnmf3tytomDr u olt0teuoio3oo1llenmfcils)sDumx  ;u4apxnmo3iys sDuan p;(4artoirctatla elnvi s0setrxrpno4ll   ict s)arumx  nu1tee  iciys m2rmn o;u0 lxrmrcty1lpD an s;s) etr(o no1optnmfct t srua(ro;u4aetoiietadlsDul(vo;u4 rerxf3to1op rlnvol()texm(r3iydal elfetatf Duru o;u0oltnmfetydfsDemuvs t0tetoio tydfa eaneo t0tetmim3ny1aptelfes sf 2taum nt1apxomieiyslm2rlnmonu4artomf io1oat anei s0t2xo(r3oo4ol  mivsltf 2rm(m ;t4apxoio3iys m rl( o;u4 eenifcto1lm eln s t0srurxr3oy4apee ncia()s2tau o;t0oetomictas m2eln ont)trtrmrciatlpD aues;t0setmirpiodome liesl()a2rru pnu1alxniieiydlsDuauvsn(0tltrmoctadfa  au i ( sruoim3ou1amt mfvi s) 2rauroot0alen f3tlslaDea(vp t)alenxo iadoa rlieo ()s2xrim3iu4ome mnvtltfaDraumonu1aptn f3taslm rln pnu)trtnmf tatfp rauei s0seuoio iy4aptnmfvil() 2tm( oot0tpe ii3iydfmDuluvs (0teerxr3iydfpteli o s)t2tmxrpny1oleelictls s2ururpoo1tpeoio3iysfaDrauvo;t)areoir3oydla eluvils0srtmxrpiodomen icsls) 2rau pnu4optniociysfs2emnmp t) lenmfcootop rauvil()t2tmir io4alenmieiatfartmxrono1aptnio3iys a uanmon(0 rerir3iatlaDeauvi t0trxrim no4om nlfetatfs2trxm ot0aptomo3ias m2emnvsnt4tetrifcoytfmDeanvolt0 rumxr oo4lme  ics s  rtmxmo;t0alt  ieilsla um(vs t)areoxrcoatlm e ivil() etmxm oy1apee iciatfsDtm( oou4tleoioetytfsDean o t0 exrif iydlatr uei t s2um(o3iudolt  ieiltfarrr(r ;u1aexnmfeiydfsDumn p;u)teermo3iodlaD lnvo;t seuoirpoy1olen nct s)aDtrxro;o1oex io3iatfs2uanmo;t) rxnifcoo1fa  lnesl() eurir3no1olt  iei s)sDtmur nu4aetoiieiytfsDem( p (4tleoirctotfmDr ivolt  exm(o oydop nmictatf 2urxr oo4alenmoetasla ua(ms u) rermo3tatlptrau olt0sruoxr io4aptemicils s2raur ;u1apeniieiytla ulu o (0 reomociy1op elivi s0seurir no4ol nmfes () Dtru  ou0tltnifctyslsDua( o;u0altoircoo1lp ranvol( trtmio3oo1op nlfeslsfartax pot4olen ocias a2ea( pn(0altomf oo1fpDr neo;()t2xo(rpnydlmeeliesat)sDtau ooo1olx  i3iyslm2emu s;t0 etrmfcoa1la   neo s s2tmim oudll elfcs t) rurxrp;t0ale  ieiyslm eauvo (4tetniocoadop   n s;t  eurxr3nudll  mneil(  2rmumo;t1teenmfctas s ul(mp u0aeenxr iadom  aneol(  euoxmpio4olenmieiatf 2tmu  nt0opt iieilsfs2rl(mo;u4alxnifcto1lmtr u s;s0 2toxm3iodolee nei t arrrurpno0apeoii3iatlaDeanvo;() etoxr3iydoptr ivolt)trxoir3oy1lmt  net ( a2tr( pnu1tet ioetad m2rmuvs t0teermf3iydfaD  uei s trxrxrpoy4lpte iesltf Drru  nt1opeoio3iytla umu pn(4texrir3io1fm elieils) rxo(m nudam  livtat aDum(rpnt4opeomfeias aDeauvp;(0arenir tadomDeauei t)srxm(r iydlp emncs t a2tmu oot0tetoifeiadfs um( p;()teeomf3oydlmDrlieo;s  2xoxm nu1amt  nvi s)arrax pnu0aexoioctad sDrluvo;() exrio oy1laDr uei (0 exoxm iodaptnlnctas)sDraur ot4tltnio3tlslm ulnmp;t)arxnmo3iydlpDeaiei (0s2trxr3iydaltelnvtatf Drmxroot1tptn iciys s2rln o;u4trerir3oodlmDr n ils)srxoir3iudll elivsa() rrrurpou4ole  o3iat aDua( s t0tltnircoa1fpDeai s ( t2umim3oy4ameelivtas)a2rmx oou1aetnmf3iyt s umn o t)alxoxf3oatlatelueols  eur(m ny4lp emfei () Dtm(r nu1tetnmictytlmDea(mp;t0treoxo oytfm  lueo t  eum(o nodome mivias)srtaurooo0apxnii3iydls2em(vp u0alxnmf tytomDelieo;s trto(r3ou4oleemivia()s2ur(  ou1tpe iieiys a2rl(ms u4 etriocoy1om e nvil( setmxr oydamtelfvia(faDrmxmpoo4tpeo ociasfsDrmnvo () eenmrciytla   ies;s s2tr(m no1omtnlnvta()arum( pou1aee  o3ils s2rmnmp;t4aetnircty1fpDe ivs;t0srtoim3nu4lpt  nct s  2trx oot4tetoiictysfaDrmuvs;(4arxnxfctotfmDrau s;s0s2xrxm ou1lm   netas)a2ra(mo;u1aexomf3ilsls rm( p () rtoif to1lm e u i;( srurxo ou4op elnes (fsDrr(rpnu1oexoiieildfsDemnmp;u0tlxoxrctydla rlieo;s)srumimpnudam n fviasfaDuaumont1oexnmoetaslm ea(mp;t)arenxf3todfa rauvs;t teur(m nydlpte fes t) Durx  ou0optnifcildfs rmnms;(4tltoxo3oa1laDrai i s) exo(m3ny4am  mieiltf rurx o;o1tlxnio3iad mDrln onu) leoifcoadfa e nvi t0t2tr(rpiy4amenmnvtas artr(  ou0aexo iciat mDraumo (4alxrxf iadlm eanvo;(0seurxrpoodaltemieias)sDrm( oou4aeto ietatfm2rl( p u4tltoif oo1om  au i;t setm(rpoydlp n ieils arum(  nu0tltoifctlt m ranmo t0tetnxrcio1la rlnvsls teto(opno1opte fcias aDrau o;u4alxomfciasls2emump t0trxrxo iodfp raieo t sexm(o3no4ome  iesl(fartrxmpno4aexoioetatfaDrlumo;(4alenir3ta1fp rau o;t t2xmxmpoydole  fctatf 2tm(mo;u0alen o3ild aDeaump u)arxomo3iadfatraies;() 2trxopiu4ame mict ()sDuau ono1altoiietytfsDemnvp t4 eermf3ty1lmtrauvi t) exoimpno1aleemiet (fartauro;u4oexnmoeildfaDulnmp;(0tlenmfctatfmD lu s t) 2umim nudapenmnvsltf rtmx oot0optomf3ilsfa2uan p (0trxriocty1laD aneo ( seurio no4llt lfcsls) rrrx poo0oexnmiciat m elu onu0aeenxr3oa1fatrlies ( trurxopnudomee iesl()s2raur ;t0aptnmi3ilsfa2ua( ont4alermoctatom eai s t0texmxrpiy4lpenlnci ()s2rax oou0aeto i3iatlsDea(vs;u0aexomoctytlm raivi;(0t2xmir iu4alen ivi ( s2rruro;t1alt if3tlsfm uaumo u4aetrmr3oo1fmD lies;() etrimpou1oleelnvsa( srra(rp;u0olxomi3tasls2um(ms u0 lxnxfciatfp   uesls0srxmxr oo1am  mfcsa()a2rrurp;u4tleomoetlsfa ra(mp t0texomo3iydfp   i i t) rxr(mpnu1op emfvilt) 2taum ;u0oeenmociad a2ua(vs;()tlxnxfctodlmt livsl( trurxopio4ape mfetlsfsDrrx oot1ole iociys s em( s;u0treomocia1op eanvo;t)s2umxopnydlmee nesls  2trx ono0oexniieiltfs em(mp;() lxrxocootfmt  uvo s) 2xoim3oo1ll  mnvi ()aDrr(r no1aexn oeiytlm2rau pn(4 lxnif tatlatelneilt)s2urir oodlptnlnvtas)srtmx oot1aleo o3tytla ra(vo t) exnio3oytomt lieols) rxrirpnodapte feslt)sDuaxmpot4aptoio3ildfm ua( s;()teermf totomDr ivi ()s2uo(o3iu4am e fesas sDtaxr ;t0aeeo ieias s uln p;u0 rxrmrctatomDrau i;( t2xo(opiudop elivsl( a2trx onu0ape ii3iat mDelu p u0 rxoxfctydopDr u s s trxr(r ou4apenmfeias aDua(mpno0tlenmieiasfs emnmo u0aeermo3iatfp  lies (0texrio iy1openmfcil()sDrrumont4tpx iociydfs2rmuvp;u4alxnmo iotfm r u o s0trxrim3nodll nmieiatf Drmxr oo1teeoii3iys sDrmu s;u0arxrmociytfatrlivo (0 2xo(rpoodalen fei tf rra(mpno4opt ifeiadla el(ms;(4 etrxo oy1lmDean il( s2to(m3iy1optnlfetasf 2tau o;o0alxn ieiadla ul( o (4trxrxr oytlm  li s (0trumxr3iydole mnei s)aDua(r no4tlx mieils m2em(mp;u) lermo3oadomtelies s0srxr(r oo1ap emivs ()arrmxrpou0altnmf3tyt s ulnvo t4 ltrifciydfatr ivs;() exr(m3iy4ameelfvi ()artrxm no0tlxo feilslmDelu p t4artoir3io1fpt aivilt)trurirpny4lpeemivt s sruaxrono0ole ii3ilslmDelu o t)aexnmf3iytlaDeli olt0tetmxo nydalenmfvtl( s2ua(mpnu4apx iietldla eanmonu0 eenmf3ootlat ai s (0setoxr oodol elfetls) 2taxm ;t4oeeo fetat a ra( p u)alxrir iytlpteau ils0t2xm(mpny4ll nmnviat) Dtaumpno1opxo ietydfm2umn ont4 rxrir3tytom eau o ()seuoim ny4omte ncsl(fs2raumpnu0tpeniictldfm rl(mp (0 eerxr3ootlp raieo;( teumirpiy1ope lfci t  rrm(r oo4oet mfeiytfa2ul(monu4 exrxrciytfm e uvslt)srur(mpio4ope  ietas artm( pnt0aeeoif3iys sDeanvont0aetomocootopteaueolt  2tmir nu4olt lfcs tfsDururo;t0tpxnif3iad mDul(mo;() rxnir3iadla  aivilt0teur(r iodllee fvt (  rtmurpoo1aetomociytfa em( onu)aleoir tadoate uvolt)trxmir no4apeemfvi s)srtmx pot0texomi3ias m2emn pnu4 rerio oatfmD  i o t0seur(mpnu1alenlnvtlsfs2trur ;t0opxo ieiad s2eanmo;(0tlerif3oydom rln s;() 2umxr3nydlp e net sfaDtmurpno0tpx iietytfm2raums;t4 rxoir3totlatr uei (0texrxrpnu4ope lfvtl(fs2tmx p;u4oexomi3iadlm2ranmp t4altrxr3tytla r i i t)trxoio3no4lp elnviat)aDuau p;o1tpx mi3tas sDelu p u4altoxr3ta1fptelnvs;t)sexoxo3nydal nmiciasf Drm(r ;o0tpxniieiaslaDran snt4alxomr tydomDeliei t  2xmim nydol  lfetlsfaDurxm no4apeo f3tyd aDemnvs;u0altoifctytom e n o;t  ruo(m no4opeemiet t)a2umxr ;o0apeoif3iltls ul( s (0teerifcta1fm  li ilt s2xrxm nu4llen fvsls)s2um(rp;u0tex  f3tasla el(vp u4tltnmf3ta1la e u sls) rtr(m nu1am n feslt  rtaurono0tlen f3iad aDrau s u)teeomf3to1oat  ies s teur(mpoydol   fetas)a2umumooo0oltn o3iys m2emnvo t) lenmr oa1opteai i s)sexo(o3oy1lmte fvils) 2trxm nu4tee mi3iys s rauvp;(4 rxnxfciadfmt lnvs;s) rtmir3ny1aptelnesltfa2uauro;t1apxoioeiadfa2umnvp u) etoiocoytlat liesl( trxmirpoo4omtnlnvils a2raxm ot4tet ifciadfm2eanvs;(4arxrxo3iydoaD  nesls0 euoiopny4llteliesl(f Dtauronu4tpenio3iys a2umuvonu4 etnmr ty1omtraivols)srxrir3oy1oltemnesatfsDtrxmooo1oeeoiietad a rmumsnt)teerxo3iatfaDraieil( t2tm(r3iu1aptelnes ( sDuax o;o1tleomociyt aDrmnvpnu4aexrmocoytlpDrliei t tetrir io4llte fcsa( s2raum no4tpxomf3iyt m2eln o;t) lxnmo oy1omtr ivs s s2urxo3nu1oltn nei t  2ta(rpnt4tlxomfciyslsDulumsnt0areomr3io1faDeai i (0srum(mpiydoptemnctat) Dum( pnu0tpx  iciydlsDel( o;u)artoifcto1fptrlnvo s s2xrxm3iy1optnlietlsfsDum( pnt0aleniociys m2uan p;u) rerio3todomD  uvo s)trxmxo3oy1apenmies ()artmumpot1olt  octldfaDumuvsnu0 reoxrciatomDraivo;t0s2urirpou4ol e fcslt) Dra( p;t1apxnmoctas m2rlnvs u0 lxnmr3tadfp ranvi;s)srxrir3oodll e nvta(f rum(  ot4alt iicild m2uauvp;t)altnxo3oytoptr nes ()srurir oo1apen fcsatfaDrrx pou1aexoifetyslmDemu pnt0 rxoxo iadomtelnvilt0 exoio3oydom   nvsasfsrtaur nu1tpxnmietadla2emnmon() rtrxrcty1op eauvs s0 2trim3iy1oleemncsl(fsrrrx o;u1tltomoetyt mDeluvp;t4arerxf3iydfp eaieo;s  2umxrpnu1apt mict (faDrmxm ;t0ope  ociysfm2umums;u)trtnxoctotfp  aivi;(0 2urimpoo1lme  ieiasfsrtrxrooo4tee  oeiasfm2emump u4aexoxf oa1omtraivi;( sexr(o3ou1lm elfcil()aDuaumooo4texoio3iatla2emnvs;t4teeomfciydop e ues;(  exr(r oo4lm   nes ( arua(mooo4apeniociad s rlnvo t0alenifcio1oaDr uvi s  2trxmpnu1ome mfvslt)srrm(roou4opeomoetas aDuaump t4 leomocoa1fa  liesl(  rto(opio1ll nmfesat)a2ua(monu4altn fetyslm emn p;t4tetrmr3ty1lmtr ivslt  exrxr no1lleemictas  2rrxro;o0oexo oeiytla2rlumsnu4arxnmrcoadoaD luei;() 2urxr3io4lmeemfes s  rtaxm nu4tee  fctyt a raump;t)areoxo3oy1laDraivo ()t2xoxrpnodolt lnvsasfsrum( pot1tltniieiyd aDulnvon() eenio todlmD  ieol( srxmiopoudome lnesa(f rum(roou1apen fciyd mDeaumsnu0 ltomr tadopDe uvilt0texoxm3nodlpteliet t aDtrxrono1alxnifetydlm2ulnvs;u)aeeoxf todfpte n s t)t2tm(o3nu1ap nmfesltfarrm( o;o4tetomi3iytfs rmnmo;(0 lenxo oatlpDrlu s;(  etmir3oo4lmt lncs (  2raumoot0oex  i3ild aDem(vpnu4aleoio3oytoateaiei t  exm(m3iy4lp  lncta(f rrrxrp;t4alxo octydfm ua(vo ()alenir oadfm rlnesl(  rtoimpoudaptemfvsltfarumxr oo4oexn ictldfm eau p (0trerxoctytopt  nvils t2xrimpnydalee fctls)aDurxr no0oee mo3iatlaDran s;(0trtomocoytfmteliei;( trxmxm no1ap   fet (fsrrr(mo;t1aeenifeilt a rmnvo ()aeermr3todfa elnvi;t0srtmirpoo1lltnmfvs sfsDrax pnt4olxo fctadlm ua( ont)altoxocoydop   nvi s0t2xrir iy1ol elivslt a2rrxroou1optomoeiatfs2ulump;t4aetoxf3todomtraies t0 rxrim3iydam   ivil()s2rr(rpou1opxnifetadfs emuvp;()aexrif3oydlpt lieil( trumxr3ou4ap e fcs sfaDua( oot0apeomietldfsDra(vsnu0tlxnmo3tytomtr u il( sruo(m3ny4olenlfcias)sDraxroou4apen oeiltlaDulnvpnu0tlenio3tatomD lnvsl()teumirpnu1oltelnes s s2tr(ro;t1oeenio3ilt aDea( o (4 rtrxo3tydopt lies (0teur(o3oudamtn fvi sfaDur(  ;u4teeo fetldfs rlu o ()aexniociadlp rluvo;t t2toim oo1aptnlfviltf 2ur(m nu1altn fcilt s rmn sn() ltoio3oadlp raivi ()t2tm(o3oo4om   fes s a2tr(moou1tpe  feilslm2uanvs u0 exomr ta1opDrln i ()seto(o3oo1omeemiesls) Drmu  ;o1alx if3iltls uln s;t)trxnxrcty1fa e u olt0t2urxr3oudop e fvsa( s2uau p;t4tle micias a umump ()tetomf3iodlat  n i s)srtm(rpoodlmtemivsl()aDtm(moou0altn ociys mDum( o (4 etomr totla   u i (  rxoxo3nu1olenlieiatfartaxrp;t0oleoii3tysfs2rlnmp;u0alxnir3totfpD auvsl()trxrxm3iodapen fcils  2tm(mp;u1tleoio3tldfm2ea(mp t0 exoxf3iotfptrlneol(0srum(rpiy4ap nmnvt t)s2uaurooo4apxnifciasls ea(ms (0 leoifciadfp eln ilt0setrir3ou1lltnlnvil()s2rr( ooo4oeto oeild sDumnvsn(4tlerir ia1oa raueo;(0s2trxrpoy1al  mfeslt) 2taxrp;u1alenmoetydls rmnvsnt4tlxomf iotfmDrlnes;s0 ruoirpiudolt  neilt)a2ua(mp;u1apxoio3iatlmDranvo;(4arxoir ia1oateluvslt0trxrio3oy1ol nlivtas) Dtax o;u4apxn feiasfa2elnmp t0 eenxf tatfp   nvs s0setmim io1altn iei (fa2tau pot1olx  feiysls2emnms;()artomfctydlaD livo;t  2xrio3io1lp  lncs ( sDraxro;u1tpeoifciysfm2rmn p;() leoioctatfpD ai ils0 etmxmpiodalenmiesltf rrau ont1oltnii3tasfm2umn snu) lermf3iadfmDrlivolt texmir ou4lp nmncs t aDra(r ou1aeeomfciad a2ulnvon() exnxo iytlatran slt  exmxrpou1lptn ictatfsrrm(m ou4aeeo ocildla2ulu o;u0tetoxo oytfa r ues;s)teuo(o3iudam e fct t srrr( ono1teenmfeilslm rmnvs t) eeoxf oytop elneolt) etmimpiydomen ies (  2rr(  ot1tex  f3tldlm eauvsnt4aetrxociy1lp r neo;()srtoxrpoy4opeemictat srrmumont4tex if3tls m ul( s;t4artnxf ty1opt  ivil()sexr(m oy4omee fcia(  rrr(r nu0aexnmo3tysls2raumpnu)tltoiocoydlptrau i s)trtrir3iy4apt  nvilt) 2rmxm ou1aptn i3tls m2rlnvo;u4 lxnio3oa1lp r i s;t0trxo(m3oydap  mnvsltf Dur(r ;o1tetnmiciysfa em( o;u4 eerir3to1opDeanes;t texmim oo1omt lfvi (f Drru o;o4oet  oetyt aDranvpnt) rxomr oy1opDeaivsls)sruo(o io1lltnlietls)s2rr(m ou0apxnmieiydlm2rm(mp u4tlxnifcta1fmDeli o;s) rurxo oydap   feia(  rurxrp;u4opx moctldla ua(vp u)tlenxfciodfatrluvslt0trur(r iodll   ivi s)srta( pou4oexnifeilsla2uaumo;u)arxnir oatoat li s;t texrim3iodom  livias  2uaxr nt1apxniociyt mDul(ms u0artomo todlatean s;s) rtmxm3no4lmen fcta() Dua(ro;o0ope  f3tas s ulu o;()tlerxf3iadoat lueils0 ruo(opoydaltelietltfs2trxmo;u1oeeo icias mDeanmsn() ltnxrcty1lpDrluvils t2trxmpoudopt lneiasfsrtrx ono4oltomoctldls umuvonu4teerxr oo1lpDeln ols  2uoxrpiydolee nes (fsDtmx  nu4tpt  f3tas a2ra(ms ()alerxf tydoptelieols)teur(r3io4al nlietl(fs2uaxm nu4apxniictadfmDrmn p u)trxoxf3iydoptr ieo s0tetmxm oy1al nmfvils sDrm(moot0alenmfciyt s2rmump;u) rerxf3iytfa ranvil(0srxm(m nudapenlfeia( srtrumo;t0ape ioeilsfs ranmsnu0arxomr tatlpD  nei t)s2urxo nodlm  lnci t)srtru onu4tee micias m2emn snu)areoio tadfp e neils trurxm oo1optnmnct t  rua(monu0apxoifciat m ulumont) ltnif iadfaDrln il() 2ur(r ou4ll elnei t) rtm(mo;t4aetn ietytls ra(monu) reoxocia1op eauvs t0tetr(opno4op nmicia()aDrrurpno0oetomo3iydfmDel(vsn(0alenxf3totlpDrai o s  etmiopoodll e nesl(farumum ot1aex  fcias m2elu p (4 rtnxrctatfm  livs s) exmim ny1amee ietatfsrurxm ou0oeeoiiciadla ea(mp;(0trenxr3iatlaDrln s (0t2tr(m iudllt  ics sf rtrxmpoo1tpe ifciyt s2um(vp t4treoio oo1fa eluvs t0sexr(r3nudaptnmfvias) Dtr(r ou4ope  iciat mDuln s u0texnmr3iodlp rauvo s t2uoir nudam e ieils a2tmxroou4ole  f3tlsfaDra(mp ()teeoxo3iadfp   u s;t0srxoxo3no1al nlncsltf rtruroot0alxoiictas aDelnvp (0tlenmfciodlmtrlivo;t sruoim nydlmenlnvta( a2um(m ;u1opxn ictls sDuau s;(4artomr iydfatr ivslt0 eurir3oo4am elics s)a2trumo;t0tpxnmictlsls2ean o;t0teerio3oo1laD luei;t)sruriopnu1omtnmncsat arumx  ;t1tptniieiadfs uau s u)tlerxf iadfaDeaivo;( srtoxopoudoptnmfcta()sDumxr ;u1apt  ietlsfsDemn p;(0tetrxfctodfat  neil()truoxrpiu4ll elietlt sDurxr nu0apt iicilsfm rmnmsnt4aeenmrcoydfate n il(0 2ur(rpoudlp nmfct s)aDurx  oo0oetn f3tlsfm2ulumo;u)texrxr3tadfmDraies s0 euoxmpny1apt  feia() rrmxm ou4tle ifciydfa2umnvpnt0tlenmrcootlatean o t trxrirpiudal nmncs s  2tmum ;o4tleomoetysfmDrl(vont4texrxf ta1op  auvil() 2xm(r3iu1lme mfesl(fsDtaxroot1texo f3taslsDua( p;u4teermf3oytopD  nvi (0 2tmxr ny4ape  neil( sDuru  oo1alxoiietad m ulumsnu0 etrmfciotlm elnvi;t) rtriopnu1amt mict sfaDraurp;t4altn oetysfa2ra(msnt0teenif3iydomt aivs;( t2trio3oy1lleelfvslt) rtrxr ;t4aexomictadlm2emumo t4tlerir3io1opD an o ( texo(m iydlptnmncsat  Drru oot0opx iocilsfm rlnvs;(4tlerif3oatla e neslt truoxmpny1lpt lncs t  Duaxm no0ale if3ildlaDranvpn(4arxrxo todfmD lnei;( t2xoxrpoy4llt lfeilt) rtmurp;u1oeeomictat aDel(vs;u0tleoiociotomt lnvo;(  exoir3ny4amenlncs (f rtaxmpou1altnifctlt m2uan snu4areomr3oodlp elu o;(  etrir3iydlptelnct s  2rm(m ot1tpen f3iytlaDra( pn()texnxr oo1optrluvo;t s2um(mpnu1amee ivtls a2ur(rp;o1aee  o3tldfm2emu ont4tlxnxrciotomte ivs t) 2xm(r3iydome lncta(fsrra(  ;u1oeeomoetlsla um(mo t0texnmociatfmDeau slt srtoxmpno1op nmnvta(  rur(m ot0apxoiiciltfaDemn s;t) lenio3to1lp  aivsl(0trur(r3oy1ll e ncils sDtmx  nt4altnmfctyd sDranmp;u)artrxr3ty1faDelivi s) rurxmpoudllenmictas)srua(m no4tpx mfeildlmDrm(mo u) exomrciatopt li s ( truoxm iudlle lnetat)a2tm(rono1oeto i3tld s2ulumo u4tlxnmocto1oa eanei;t0 2xrxopny4ll elfesltf 2urxm no1tpxo octaslaDrm(vo (0tltnmr3iotfp ranvi s)teuoir nydolt miei t sruaxmo;u4tpenifctydfaDrmnvo t0 rtoio3iatfmte nvo t0seur(opoydlptelnvtlt aDrr(m ;t0apxoio3tydlaDrlu o;u)aeenifcty1opt aivo t  2ur(m ou1llee fes s  2uaxrpoo0oeen iciatfm2em(vsnu)alxnifcta1fptrauei;()setoir ou1alenlictls a2rr(ronu1tpx mfctatlmDumuvpnu0aleriociydopDeanes;t sexr(mpoydlleelfctls srtrx oou1altomieiyd s rlnvs u) exnxr oo1lm   nesls) etoxrpny1optnlfvt (  Drrurp;t4oltoiociat s2rm(mo;()tleoxrcoatfpt lnvi ()sruoir ou4lptnmiei t a2uaxr no1tltnmi3iysfm eau p (0trxnmf tydfpteluvolt0seur(r3io4lm n fvt sfsrumxrooo4oeeo o3tysls2elumsnu0 etnxfcoodopDrlues s0trtm(rpou1omt lfetlt)srrrx  ou0alxniieiydlsDem(mp ()tlxrifctytlpDrlivs;s) eur(m nodol nliei ( aDraurpot4tptniociat a ulu ont0aeerir3oytlateai sl(0t2tr(rpoo4ap e ncilsfs2rm(  ;t1tpxn oetadfs rmuvp t)arenif oy1lpD  i o t)t2toxm no4llt lici (f rtaur ;o1tle mo3iydfa rl( s u4altoxo ta1latelu s;() 2xrxm oo4lptelivtas)arta(ro;t1altnmoeiadfs2elumpn() etomf ia1lp e nvs;s)seuo(o ou1lle  nesl()aDua(mpot4aptoioetyd mDum( o u) lerxr tatoptr uvols srumir3io4lleelics sf rra(rpou1olxnio3iyd s2elu p t)arerxo iatlaDr uvi s0 2xoio3nydop n nvs tf 2rauro;u1tpxomietatlmDea(vs;t4aeenxr oydlmtelu s s trurio oudam e nvils  rrrumpno0aexniiciatlsDulu o;t0tleomocoodom eau slt)t2ur(o3no1alt  fciatfaDrrum nu1tptomieiltlm uaump;t) etoxr3tytomDe ueolt)t2uo(m3iu1ole  iesat)sDumurooo0aetomfcilt s raums;t)tltomr iodfa  aneo t srur(rpio4om nliviat srum( onu0alxnio3iad a2umuvsnt)tlxnmf tydlmDraneo s0sexrxrpiy4lle lics tf rur(mooo0tpxo fctldlsDemuvp;u0 rtoiocoytlpte ueo (0 rtrir io4aptelnesa(f rumx p;o0tptomo3iat m2emnmp;t4tetoio3ia1oaDe uvs (0trtm(o nudom e fetatfa2umxrp;o4tlxo ociadfm ea(mp u)tlxomr tadfaDraivslt  exoxr3io1apen icsls a2rm(ront0ope mictat a rmu sn()arerir oodfaDe neol( s2trim iy1al  mfetl()srraurono4opt  ociatfm2emuvsnt) rtrxf oy1lmteluvol(0s2xoxmpoydap n nct tfsDrmxront1texo fciadfm raump;t)alxoif iodfpDe n o ()srumim3nu1op nlnvtlt a2tmur ;u1olenmieiyt m rmn o u0 rxrircoodfmtr nvo;(  rxrio oy4ap  mfvsat) rtaumoot0aleomoeiltfa2eluvsnu0trtrmf ootlmteli s t0t2to(r nu4amenlfcs sfa2tmurono1tltniieiltlmDeau o;(4 exomr tadfaDraieolt0tetmxo3oy1lptelncsatfa2uaxroou1texomoeiysfsDrm(mon(0altnio iotlmteai o;t s2tr(mpnu1olenlnetas sDumx  ;u1texnmfctyd aDulnms (0 lermr iy1lpt aneo;t s2xmir3ou1omt lfet s)sDrmurooo4apeomoctyt m2rmuvo;t)texniocta1fpDranvs t0tetmirpiu1aptn nvs tf 2ua(mpot4openmfciltls uanmo;t4aetnmr3ty1lmtelnvs;t  exmimpnydlme  nvta() 2rax ont1olto f3iyd m2elnmonu4trtrxf oo1oatelivo t t2xmir iodlp  micslt s2urumonu4alxnif3tysla2rauvo;u) ltrir oy1omt ln s s0 rtrimpnudlme  ncs ()aDua( ont1tpt  oeiysfa ua( o;t4arxrxocty1oa ean olt0s2toxmpnydap nlneslt)a2umuroou0apenmoctatfmDrmumo;(0 lxoir3iodlpte uvols truoio3nodlptemfet tf 2rax  oo4tetomfciyd a umn p;()trxrxo3io1fpDr ivols truo(o ny1llen nctas artr(mpno1aet ii3tls m eln o (4alenif3oo1faDelueolt0 exm(o iy1al elieilt) 2ua(mp;u1tetniieiyslmDum(mo;t4teeoxr3iytfa   n s t)s2tr(opoudop  licia(  rtmxr ou4ape iociytls umu o u0arermf3ootfmDeaueo;() etr(opiy4optemnei (f rra( onu0texo f3ilsla2rm(vo t0tlxoircta1optraues;s0 etoio no4lmeemicia() Dtr( ono0oeeomo3iatla2ra( o t4arermrctodlmDeanvol( t2uoim3iu1olenmncil(fa2taxrpnu0aetnifeiaslaDemn o;()arxnifctadfmDeau o s)s2xmxopiy1lmenlieta(f Drm(rp;u0tpenmfciyt s2uanmp u0alxnir3oatlmtrauvs;( tetmio iu4lpeemfeils  2tr(  ;t1olenifciat m2ua(mp;(0artnxr iotoatranvo;s  2xr(rpoo4ol nmfcs s aDtm( ooo4tpen feiat m emnvo;t)alerxr3oytfm rluvs () etmxr3iudolte fesls)aDta(rp;o0apenmoeildfmDrm(vs t) exnmr3iy1fp eau i;s  2uo(rpno1al elfcsltfarur( p;u1oeeo o3iydlaDrl(mp (0 rxoxr3iadla e ivilt)setoio3iu1altemivtls  2uaum oo4texoiietatfaDrlnmpn(0alermfcoo1om e n s;s0teuoir oudamtnmics t arrrxr ;o0aeenioeilt sDelnmo;t4 renmf3oytlatrlivol( sexrxr ny4lm  mnvia()a2um(  ot4aexnii3tat a2ul(mp t) lenio todlaDranvs;( teuo(m3oy1lltemfci s) 2rr(root0alxniieiasfm ea( o;t) lerir3io1latran i;s)s2toim nudalt mivi ( a2rrurp;o1tpenmociasfa2eanvsnu0 reomr iatfa r nvslt0s2xo(r3nydolenmfeiasfa2urxmo;o4tetoio3tad s2ul( o;u) renxfcio1fpDelueols srtoxrpiy1lme lfeiatfaDrmxm nu0tetnmfciltfmDean p u0 ltnirciodlm eanei;s0 2uoxr3oy1ll e ici sfs2uaxmont4oleoiieiytls2rmu s u) rtrxfciy1lmD liesl( sruoir3iydamtnlfesa( srtrx o;u0tlx moeiad s2uanvs;()altoifcoatfpteauvi s)sexm(m nydopeelnetlsfsDurum oo1tleo o3iltfm2eanms;u0texnio ta1omDraiei ( trtmxo3iydlp  mnes t sDtrxr ;t1texomf3iltls umnvs;(4arxnxfciydlpDeauesls  etmimpoodom n ivsltfsDtrur nt4apxo oeiytfm2ea(vo t)arxnmo tydomD liei s) 2tmimpiydlpenlnvia( sDum(rpou4olxo fctysla2el(vp;t4aetnxrciodfaDr i o s)t2umxr iy4lpt lnetasfaDraxmp;u4altomociytlm rmu s;u0aetoio iotomDe nes;s  2ur(opoy1altn feilt a2taxmpnu4tlxomfeiysfm ua(vp;(4alxoifciydlmt ai i;t  rxo(mpoo4lpeemies s)s2urur no0apeomoetlsfaDrm(msn(0artnxo to1op  ln i;(  rtm(o iodol n ivils srtmx pnt1optnioeiad sDemnms t4 ltrio3iy1op  ln il()setm(mpnodomt licil(  rtr(rpoo1aetomfeiytfs2uluvo;() etrxocia1omtr n o t  rxrim iodalt mfvt s)srurx p;u1tlt mietlt m2ulump t)tetoxf iodfpt li ilt)s2umxm nu1llen fesasf Dtr(rpno0tltnmieild m ean s;t4aetoxr3ta1lmtelues s)srumio nodoptemfvtas)aDuaumonu0tex ii3tasfa rln ont4tlenircoydom  auvi;s trxo(r oudape lnctlt a2tmxm ;o1olt  i3tadfa2rau on()aleoiocio1faDe ieslt0 rtrimpio4omtn netat) 2uaxr nu0apxn f3iaslsDumn sn()teermrcoa1oa  ln i;( tetmxo ny4omtelnesas)srrmx onu1teeo i3ildfm2emu snu0artnif3ta1op eauvilt0seur(rpou1lm elnci t)srtr(  oo0alxomieiyd m rlnvsn(0 renio3totoaDelivols)seum(rpnu4op e net sfsrraumpoo4opxnmociat a2rl(mp;u0aexnio3iadfp  lu ols)t2uoxrpoodole mfet (  Dtrumonu0tpen o3iltls2ua(ms;t4treoioctytomt aivsls s2toio3no1lp e fcs s s2umu  ;t4aeenifctasfm ua(vsnu4trtrif iydla e uvs;s)trumim3oydlmtnmivslt) 2tm( ooo4alxnmo3tys m2eln pnu4aleoifciydlaD  u ilt0 rumir3no1lm   fesatf rua(rpou4aex  feiltfaDulu snu) rxrmo3todfa elneil( setm(opoo4am nmfvtat)arrm(mp;u4tpxoiociltfs2rlnvs ()trxoxf iotlpDr u s ( sexrxopiu4omt  fvi (fsrrmxr oo1aex  iciasfs ea( sn()artoxfcootlmDr u ils0srxoxm iudlmt  nci ()a2ur(rono4aptoii3iyslmDel( o;u0 lxnir3tydfp e ieilt  ruoxopiy4lpeemnet (fsrtru pno1texn o3ilt sDumnms u) eeriocoydlpDe uesls  rum(opiydomenmfeslt aDtrx poo1oeeomfctadfmDuluvs;t4aetnmocia1oaDeaieo;s trxoxrpoo4lptnlfesas a2umu pot4oexn ieilsfa ul(ms (4aeenmo3todoat anvs (0t2xoxr3oy4ap nlici s)artr(mpot0teeomoetls a2eluvont0texniocoytfm  aivol(0 2xrxo3no4lpenlncs t) rrm(mpno0teenifetat a2uan sn(4texomr3oo1opt anvol(  rumir oodapee ncilt artrx o;u0alt mf3tydfaDea(vs;(0trermf3io1fpDelneilt0t2tmxmpoudol   ivslsfsDuau  no0oeen o3iad s umnmsnt0alenir iydfa rln ols0sexr(mpoodlpeelfcils) 2trurp;t1tpx  fcildfa2ua(vp () renmrciatlmDrlu s;()sexrxo no4lleelivtlt srumxmoou0oeen o3tad s rmnvonu4tlermrcto1lmDe ieo t t2toiopiudllenlfesltf rrrur oo1ole iociat s rln p;u4 lerxrcoy1laDrlieslt) eurxr iodalenlivs t arrr(m oo4apeoioctls sDelnvo u4 eenxr io1opDrli ol( srtrxr iu1omeemnvt s  2uaumono4altn ociytfm emu p;t0teenmr3iytoaD  uvils srtmio no4oltelfetls)srtr(mpoo4aexoiictyt m rl( p;(0aexrxfctydopDelivol() 2ur(opoudlmee fvsas aDtmx  nt1tlt ifeildla ua( snu0 rtrxr iytfpD livslt tetmim oudlle lics t)sDumum ;o1alenioeiadlsDuauvs u4 etrir3io1opDelu i;s0trtmimpnodlme lies sfsDrr(ront0alxo fctydla rmn s;u)aeermr3totfa  li ils) rumxmpoudomeemnet t)a2rru  ;o4apxomfciyd sDua(mon(0 reoxfcia1oatr ueo;() eurim3iu1op emicsltfs2rrur nt4alxn icild sDranmsnt4alxnxoctadom eli i;s) eurim ou4lm  mfeslt aDrr( oot4olx  ieiltfaDulnvo u)alxrmo3oadlatelivi;( t2umxo3no4alee nvils) 2rr(mooo0tlxn f3iad a2em(vo;u0 exrmo3iotfat aieslt0 2xr(r nodlpe lnctat) 2rrurono0ole ioeils m2ulnvp;t) ltrifctadlmDrlneils)s2uo(opoydlmtn fvils)srur(m nu4tlxnmieiadla2elums (0tetnir3oa1oa eanes;s0 eto(o3oy4am  mfvi tfsDtrx o;t1alenioeiys mDuan snu) etoxo ootomtrai sl(  etrxr oudopt miei ( sDum(mpot0oetn f3iasfs2ra(ms;u0 rtomr tadoa e iesls0s2xm(r3ou4ope  ncs tfartrumpnt0aleoii3iysfm eaumo;u)arerio3oadlpD lu s t  rxoir oudlp  lictas s2tauro;u4olxomociadfm2ul( s (4 lxoxr3ia1oaD  nes t0 rtrio3oydaltnlivt s) Dua(rpnu0aptoiociat s umnvp;u4texrio oytlmDeaiei s s2toio3oudlmee nvs t artaxrp;o4tetnmo3tld a emn p t4 ltrmo iy1lpDe neol(  ruoim3oudoltemivt s)sDtm(r oo4apenmi3iltlsDel(vo;(0tltnxocootfatelu o;t) eum(mpio1lle liesat)arrrxmp;t0tpxn iciltfmDumnvon()tltomr3totlpDeaueo;t s2urir nu4lm   iesl(faDrrxro;u4altnmf3ilsfa umumo u)aexomr todop  livi s trxm(m oo1ap n nvs ( arta(m ;t0ope ifeiysfs emn ont0alenifctotoatr u i;t0 rxrir3no4oltn fes t) 2rrxrp;t4aleomo3tas m2emu s;t) eenmr3oadfmDelueol(0texrxo3no1lp n fvtat a2tm( o;t4opto ietyslmDemums (0 lxomo3oo1latr ieo s0 rxo(r iy4omtelieia( aDtrxr no1ole  f3tys a2eauvpn() eenifcio1omt livo;(0 2umxm3iudomtnmnei sfarrrxrp;u0apxniicilt m2ul( p;(0 ltnif3ty1om eluvslt)trtrxr3io4om emnciltfa2raumont0tltn iciltfmDrlnms (4 etoiocty1lat livol( trtm(m3oy1ol nmiviat s2ra(rp;t1aetnmietlsfa ul(vo ()trtnxf todfpD lneo;t) rxr(rpno4ll  lict s)aDrr(mont1tle ifciasfs2el( snu4trermrctydfmDelivo ( tetoimpoy1lp emfct () Dumuro;u1tpe mi3ilt sDum(vs u4arxrmocoytlptr nesl(0setrxm io4apeelies ()a2tmx o;o4altnii3iltfm2umnmp (0trtrxf ia1late n ilt0sruoiopny1al emfvt tfarurxm ou1aleo o3ildfmDulnms;u0 lenio iodlm   u sl(0srtrim3nodlmtn fvias aDrrx pnt4tet mfcilt s2emump u0alenxo3todlmt  i i;s)trtr(r3oudam  mfcta(f 2trxrpot4aeto f3tys m2umu s;u)arxrxf oy1opD lnvo (  ruo(r3iudole micia()arraumooo4texomo3iadlaDua(vo;u0artnmf to1om e uei t) rur(o3oy1amtemneta(fsrrm(mo;t4aee ifeiysls2uln onu) reoif ootlmD lueil(0sexrir oy4amtnmnet (  2ur(  no4alen i3iyd mDum( s ()aleoir3oo1oaD li i (0trur(r oy1omeelietl() 2umu  ;o1olxo oeiadfs ul( s (0trxomfcta1lmtrlues ( t2xm(mpiy4amtnlnvils) rtax  nt4alt  feiltfm eaump;t0 ltomf ty1fm r uei;s)s2xrxrpoydlm  livt sfarrrumont4oet ifeildlmDemumo (0alxoxocia1om  anvi;( srtoxo oudlpt mneil()aDrm(moou1oee iiciydlsDul( snu4 lxoir3oatlm  ai ils  eurim3oy1omt  ictlsf rrrxmonu4tpen oeiytla rm(vonu) rerxo todlpDeln i s)srxmxm3oydll nlnvsa() 2raum oo0tltnifciatfaDrm(vo;u0 lxrio iatoat lnesl()t2xmim3io1lpee nvta( s2uaxrpou1oeeoiicias m2rm(vpn(4altnxr3iy1oatrliei;t0t2urxm3iudom nlivtas sDrax  ou0olx  feiytfa2rmuvs;(0areoxr3tadlmDeai o t0t2tmxo nu4aptelfci s)sDurxronu0alxo f3tysfa2emn p (4 rxoxo oatlm elu i s trtmxo3ny4apenmnei sfsDrrxro;u4aexo fctat a2umnmsnt4tltrir3oa1la   iei s0s2uoio ny1llte iesasfartr(  nu0ole if3iaslm elu s;t) ltomf3oadoa raueslt setoirpiy1lpt lncs (faDtr(rpoo1tlenmieiyd m2emnvp;t4treoxr3iadfm raivo s0s2xoirpou4olt lfctlt) Dtru  no0teenmf3iydla2umu p;t4altrmo ta1fpD lieslt  rtmxopoy1ome  iet s  Durumonu4tltn f3iltfa el(mon(0 rxoxrctotoaDe uvsls) rurio iu4lpt mneil(  rraumont1oet  fctatla2rl(vo u4 eeoio ta1fmDrau ils) 2um(mpnudlptelnviatfaDurx onu4tetnmieiydla raumpnu4 reoxr ta1fmD lneo t t2to(r3oudap emieilt) 2tm(mo;t4ole io3tysfa uan o u)aeeomo3tatoptelnvo;()setrimpoy1op  micslt)arrr(m ;t1tle  i3iyd m rluvont) exnio3oodopDe u ols0 rto(o oudoptn fctls artr(rpnu0alxoif3iatfs rl(ms;t)trtnmrcootoateai s s0seum(r3ou1optn ivs t sDrrur ;o1tpt io3iytfm2ulnvsnt0aeenir3ta1lpDeli ols)s2xrxr3no1lpt lneil() Dta(mp;t1aetnmiciadlmDumn pn(4 etoir oy1fa  ai slt0 rxrimpiydll nmfeilsf Dumumpnt0tpxnmo3tlt a2ulump t4aexrif3iatlm  lieol(  2urxopny1lltnmfei t)a2rrxr ot4apeoio3iys mDeau o;(0tltrxfciy1fmDeaivo;s) etrxrpnu4lp nlieils)a2uaum ot4tptnifctlt a2uan snt4alenmocoadomDeaueo;t) exoiopio4apt lnesl()s2ta(m ;u1tee  oeilt s2ua( ont)treoxf3iodoaDrlneol(  2xr(r oydole mfcilt) Drmu oot4aex mieiasfa2umumo t0aleomf oy1lpDr u i;s)tetoxopoo1lpee icilsf rur(m no0aeenmfciatla2ea(ms;t4tlxrio3tatoa eaneols  etrxmpio1apte ivilt  rtaxmoou4tpt iociytfsDrluvs u4altrmociadfmtr nvi;s t2trxm nudam emivi tfs2tmump;u0tlxoio3tadfm2eluvo;u4alxnif tydfaDr i i s)seur(mpnu1lp  miviat)s2taump;o0apenmiciyd s2eaumsn(0trermociy1fptrli il() 2xmxm3iydamtnmicias  rumxr ;t0tlxomf3iytfsDrmnvs;(0tltoif ty1lp   ies;t0t2tr(o iu1omtemfcs ( sDrru o;t0tpx  o3iydls2ul(vo;() exoio oa1optrlivils)seuoim oy1ome mfcsl( aDtmxm ;t4alenmf3ils m umuvp () etrxo3tydopte u olt) rxrxo3iu4openmiesasf Dumuro;t1oex mieiyt aDrmuvp;()artoxo3tydomDr u o;()s2triopnu4op nlivs t a2uax pnt1olt ioetytfs2rln o;u0alxnir3iodlmDr n o t) 2uoxrpnydap emfvtat)aDurx oou4apenmf3tysla uaumpn(0trxoircta1fm ean ols0trxoim iydolen iesls)aDum(rono1oee if3iasfa emuvp;(0 ltnifcoy1opDe iei;(0 ruoimpiy1amenlfvt sf rrm( pnt0oexnmi3iatla rl(vo;u)tltoxociadfp e i i;() rxmxo nu4olee fesas sDraurpnu4apen i3iltfm2el(vsnu) etoircta1lp elneo;s)teurir3ny1ll nmnvt tfsDtmxmo;u1tlt ifeils s2emuvs t)aexomo tadlp rlu i;s  rtrxmpou1lle livilt aDtm(m no0tpx mo3tydfa2ran p (4teenif3tatfmteliei s) exr(r3iy1amen fctl(fsrtrumo;t1oetoii3iydls eln s () rtrmf io1fmD ai s t0s2umxopno1amtelivs tf 2rauroou1oet mfciydlsDeaumpnt4 ltomrctytoa  aieslt)t2xoxopoo1lle  ivtltfarraum ot0texomoeiad mDuanvpnt4treoif oa1fatran o;(  exrxmpnu1lle mivils  2trxrpoo1aleo i3ias mDrl(vo t4aexrxr3oadlmt lnvo s0setoxr3iodam   nvt t) 2rr(mpou0alto i3tad a2elums;(0 eerxr3iy1oa rln i;s0 exmxo iu1lptn ivs sf Dtruroot0texniicils m2rl( p;t4altrmo to1lpDelneil() eum(rpiy4lptnmfct t)aDtaxr nt4apxn i3ildla ua(mp;t)arxnmf iodoaD lnvs;t srur(o3io1omeemfcia( sDtaxrpno0oeeniociatlaDrmuvs;(0 lxomfcoytfmt li il( seuoxr3oy4om n ncs sfa2rmxr ot4altomfctyt m umnvs;u) eenmo3oa1omDelnvo;s0trxo(o iydomtn ieslsf 2rmum ;o4tlxnmfeild a2um(msnt0arenircoy1fm eanei;(0 rto(r oo4alen nvilsf Drmxrpnu1alt mfctat s um(mp;(0 reoxocoodfp r i il(0 2trirpiodopen fvsl() Drau oou0apt ifctad a ul( o ()trtrmocta1lmtr iei ()teuriopou4amt mfetat  2rax  nt4tleo iciytla rl(ms;(4altomo oodoaD  uesls teurxopny4ll nlivil(f 2tm(rp;o1tee moetyd aDuanvonu4texrmf3iatoaDeaieo;s s2xrio3iu1ameemncsls artrum ;o0oet ii3tat aDum(vp;u0 etrir ootlmD  ivs s0setmxrpiudlpenmfeta(farrmx ont0tleomfciatfa2rmumsnu0trermr iytfp r neo;()t2xoir3io1oltnlfei (f 2rmur ;o1tlt miciytfs2em( p u)aexomr ty1fm eaues;( t2toxm3iydlme  ivsa(fartrx pou0tee  ociytfm ea(mpnt4 ltnxr oo1lptelneol( seuoim3iudopeemieils s2tmx ooo4apeniieiatfm umuvont)aeeoifctotoaDeli s;s0t2xoxo iu4ope mfctat) rraxm ;o4optoio3tld s2ulu s;(4tetrir3iydfm   ieilt0 etoiopoo4ameelietl(  Drm(mpno4apeoiocild s uanms ()artrircootla  aiei s0tetrxopoydaleemivtas) 2um( p;o0alx ii3tas s ul(mo;(4 rxoxr iodomDrau ilt0trtr(opoo4ale mfvtat)aDtr(r nt0aexn oeilsla umu p t4arermrciydlpDeanvol() eumimpoy1al  micsas) 2uaurpno0tlx mo3tltfa rluvo;t4aeenxr3oytfaDelnvsl() rumxm iu1omt lnvt t s2raxm oo1teeoifetad s2rl( p;(4alxnif tadlptraneolt) eur(m3no4om emivtl( arrmump;o1tpenmieiat s emuvpnt4alxrmrcta1la  anvo;t sexr(o nydamt  feil()a2tru pnu4apxomfcildfm2rmn p;t4 ltnmrciadlpteai il( srxoxo3iu4aleeliesl(fs2rr(ro;u4alxomietat m uanmo;(4altnmf3ta1om e n i;(  2trxo3oydape lnvsa( a2trx oou1oexniieiydfmDem(vo u)aleomf3to1oa rlneo;(0t2tmxrpoo1ome liesatfarur(m ;u1aeeomf3ildlm2ua(vpn()tleomo3to1la e uvs;t)setmxr3nudop nmiei sfsDrmu  nt4aet  f3ild mDea(msnu0 lerirctydlaDeaneol() 2xo(m3oy1opeelfeils  rrr(  oo4tlt  iciysla rlumo u4 rtnxocoytoat  ivs;t0 rumxo3oudlme  net t)s2tmumpnt4olt  o3iydlaDra(monu4altoio oo1fmtr iei t)t2xm(m3oydap e iei ( sDrmx  oo4tee moetadla2ra( p;(4aetomo3tydlate uei;t t2uoxr iydomtnlnetltfsrtm( ont0tpenioctyt m rm(vp;t)texnmr tadomteai ols srxrxm3iudaptelfcslt srrrx  ;o1teeo fei
\ No newline at end of file
@@ -0,0 +1 @@
+nvs t)trtmxo3nydame lnctls  2umx oot1apxnmfcils sDumnmpnt4aleoifciotfaDraivi t0sexr(r3iu1lmtelict sfsruau  ou4aexomo3ias m2uanmsn()texrmf oy1lpDranvs;s) 2xo(mpiydom  mnet tf rtax onu1aeeoifctatfm em(vo;u0 rxrxrciydlaD  ues;s0srtoxmpnudlpe mietl(fsruaum nt4oex  f3tydlm rmnmo;(4 etrifcia1la  liesl(0teum(opno4amt lfci s) rumx pot0teto ociyt s2umnmo u4alenxoctatom   uei (0s2xmiopoo4ale mnctlt arurxr ;o4tpto i3iytfs2rl(ms;(4tleoircoydomt luvi s0s2uoio3ou4ol nmfvsl( arurumoot0tptnmi3iatla2rauvs ()altrxf3iytfat  n o;t)setr(opoo1ape mfcsas a2tmump;u4altomfeiatla2ra(mp;t)tetrxo ootfpD luei;t srtr(r3nydope lfcia(fs2rmxmo;u0oee ioeiat a2eauvpnt4arxrxf iytoateaies;s  2urxm oydopen ncil(fsDrr(r ;u4alt moeiydfa eln p t4aexoxr3iydlaDeanvs;t0s2xrio nudop  mictlsfaDrm(ront1altomi3tlslmDumnmsn()tetoir ia1op elu sl(  eumxmpiu1lm   ici ()aDtm(m oo4tex io3ilt sDul( s;(4 leoio3ta1lmDraneo s)texmim3ny1aleemnci ( aDrax ont1oetnmiciydfs uln sn(4tetnxr3to1fp  lieo t  euo(r ny4lle  fcta(fsDua(rpot4ope  icias a2eln o u) ltrmo io1lm eli i;t0srxoxm ny4lltelieia()srrru pno1tlto ocild a2umn p (0tleoxf tydfpDeaieols0seum(rpoydop nlfvs t srtrxr ;u1apen fetydfm2rmnvp u)treoircoadlmte nvs t) 2tr(mpoo4ll   iciat)srtr( p;t1oexomf3tltlm2elu ont0 etrmocto1fmD luvo;s0srxmimpoydlpt  fcta()srrmu  ;t4tltnmietlsfs uluvs;u)alerif3iodlpteaiei s)s2umir oudap emicsls)aDumu  ;o4opx mfctyd a raump u0tetrir oadomtr ueo s) eumim3nydll e ivs s s2ra(rono4apto ictatls2ra(mo;t4texrmr totfmD  nei;s)s2toxm3oy1lme lnetls s2taur ;t0olxnifcilt a2eanmp u4aeenif3oa1fpDrln o;s) 2toim3ny1ape miesls)srtmxmoot0olt iociltlmDem(mp (4aeenio3iatlateanvs;t) rtrio ou1am   fcs (  Drr(mpot1oet ioeiyslmDemnvo;u)aeenifcoytfa raueo ( tetoir3oy4olen ics s srrrx o;u1oltomf3tldfs2ran pnt0teenifcoatlpte n o;s)srxoirpnydomt mnvtl(  Dra(root4oexo o3iatlaDelnmon(4 renxf iodlaDeai ilt0setmxopno4apeemivt (fs2rrx  oo0tetn fetls s2umnvp;u4teeriocia1fp elnvs;s0 rurxrpnodop  lncils sruax p;u1altomoetat s2rm(vpnu4 rxnifcta1fmte u i;(  2xm(r3nu4omtn fvi ( artaum nt4altn fciyd mDulu p (4aexrir3tadoaD  n i t t2xo(r nydom   ncsa(fs2rmu pot4opxn feiatfsDeanmp;u4 rxrif ty1op ean s t s2xr(o oy1openmieias)arurum nt0apx mfetatfs rl(ms;t4tltnxrcoa1lp   nei;s0texmim io4apenlncsatfarra(monu0oetoiociadlsDrmnvo;()trermoctodlmtrli ols  etmir3iu4ap elnvtas s2urxm nu1oexniieild mDum(mp t)aeenxr3iatfaDr uvs (0 rto(o iy1op nlnct t srur(rpot4openmfetls s2elnvp t0 ltrmrctydoate nvil( s2ur(o iy1olt lnvtls arta(  no4opeoiiciltfs2el(mp;u4aeeomr3tadopDelnvsls)texrim3io4olenlivi s  Duau pno0tpxnii3iytlm2ul(vsn() ltoif iodoat aneol(0 exmxr3iu1omte fvia()a2raurono4apenmoeiydls2ea( pnu0 rxnxf ta1fm  an s t0 2trxopiydolee nei s)aDururooo1tle mfeiasls rl( p;u4 lxomr3ta1lptrln i;t)sexm(r iudlm   fct t)s2uau pou4tetnmoeias sDea(vo;(4teermr tydopDraies;s)trxoim3iydameelnvi t)a2tr(rono0oltn ictytla emuvs u) etrio3oo1lptr nvs s0 2um(rpiudol nmnvils)aDtmurpoo1teeomo3ias a em( o;t4trtnmociy1optean i;s0 etr(o3no1ape lnet s)srta( p;t0optnioctldla ulnmo ()altoxfcoa1om r ivo;t0sexmio3nodol nmietat) 2tax  ou0alxnifeiyt s2ulumont4altrmo oo1oa   ueol(  euoxrpiu1lp emfvtas a2umxmpno4apeniictys m2emuvp u0 ltnmr3ty1lmDe ieils0sexrxopoydolt liciasf 2rm(mpnu1tlxnmoeiydla um(msn(4trxrxf3iy1oatrauvi t0 etr(m3no1ll nmfes () 2rru oou1oetoiictys sDemnmp u4tlenmocty1oate i o t)trxoimpnudlpt  ies ()srrrumpnt4tpx miciytla2uln o u0 leoif tytlmDelueil( s2tr(m3nudlmtemfeia(fa2rmumont1alen feiydlm emnvpnt0teerio3tatom  ln o;t) etrxrpio4omee nvtl( s2umxrpoo4tpt ifeilt s2rmnmp u) rxoio3to1opD livo ( srur(o iu4ol   nesls  rumuro;u1aptomieilsfsDrl(mo u0alxnio3oydlmte nesl(0seuoxm nu4alenmieiltfs2urx p;u1open oeiad mDuan snt4teeomfciatom   nvs;s0trtriopoo1opt  icilt) rua(ro;o0olenifetydls2eanvs;(4tleoifciy1oaDe u o s0srxm(o3iydlpee ivias s2taxmooo4oltn oetydfa uan o t4tleniocoo1lat  uvs s)trurxm oy4omee icia()aDtaxrpno1apxnmietldfaDuaump;u)tleomrcootomDelivo;s0seumio oudale lfeil()arrau pnt1tet moeiys mDum(mpnt)tltnxrciydopt  nvo t0 2um(o oodopte iesltf rra( o;t4alxn o3ildfa2um(vo;t4trtrmfcootlp eauvs t)trxriopoydom elivi (  2ra( oot4tlx  i3ilsfa2rlnvpnu4 eenmfctodomt lnvi;s) 2tm(rpoydolee fet s)s2ra(mp;o0aexn ociys m emnvp;t)trerircto1fa  lu s;(  2urxmpnodal   net tfsDumu pno4apeniociatlaDumn p;() etnmo3ty1fpDraivol(0s2xoxrpnodlleelfctl()s2taur ;t1apenifeiysfs rm(vp;(0altnir oodlp eaueols) rumir3oo4oleemiesa(fsDtmxrpou1olx ifctat s ranvp;(4alxoif3oy1fm   n i;t  2xmxmpny4lpte net s s2trxmpoo0olt ioeild s2rmnmo;u)aeeomo3todlptrlivs;t0 exoio iu1lpe mfvilt)arrmxr nu4oexoifeilt a2ea(vsn()texnxr tadomDr i s;s)seum(rpnu1al emfct ( aDua(rpoo4oex ifeiysls eanvo t4aeeoio tydfpt lnes ( s2xmir nudlmtnlieilt  Dur( oot0optomociyt s ra(vp;t0trtrxf iydfat aivs;s t2umir3ou1lp emietl()aDrrxmo;t0ale mo3ils sDem(vo;u4 rtnxr iotomtraivi t0seto(m oydomeemfeias)artrumpou4olx  fetatfm ra(mpnu)aexoxr oo1oaDeln o;t0 2trxr3oo1lm n nvt ()srtrumooo0opxo ieildlm2um(msnt) lenmf oodlm eaivo;s) 2umxmpnudape miesat) 2urxmpnu4aetomoetlslaDeaumo;t) etoif3tydoat lnvslt)srtoio3no1om  livi ( artmu  ;o4tlxomi3iltla rln o t4trxrmo oodoaDrluvolt t2umxr ny1am e iei t srtm(mpno0tptniieilslm2eanmp;(4 exrmoctytfptr ivi s) 2umxopoy4amen ncia(fs2tm(  nu1opxoiocilslaDeluvonu4aetnmo tadopDrlieo;t0 rxmim3nydlmtelfeias)sDtmxmo;u0ope ifctldfm eanvs;u0 leoxo3oo1lptelu il( t2xrxmpnudllee nvia(fa2ra(mp;o0tpxoioetltlm2eluvpnt) rtrmr ia1lmtrln o;t0 rxoim3iudol e fcil( a2urxro;o1apxoifeiadfsDean s;t0texnxr oodomtrln il(0 eur(mpno4lm elfesl(  2tmumpot1texn o3iydls2umn snt0treomf3to1lat lueo t)s2trir io1amt  netl()s2ururooo0opxnio3ils s um(mp;u)alxoirctytlatraies t0 rxmxr iu1ome  ncsa()a2ua(rp;o4oeenmociyt aDelu o t0 lenif iy1fptrlu i s0 2uoxrpiudlpenmivs s)srtmurono4apen f3iadfm2rau p t4teenxf oatlm  anvsl( s2xm(o iy1alt lnetls) rrmxmpot1alxnifciydla raums (0 exrxo todlatrluvol()srxm(opny1al emies sfaDtau onu4tlxomoeildfaDrlnvs () exoxr3iadla  lnesl(0 etoir3iu1opee nviatfsDraxm oo0opeo octyd mDemuvsn()aexrxo ootom   nei;s seum(o3ny1amt micsltfsrrm(rpnt1tpxnmieilslaDum(vo t) ltrmocoytfmDeauvs;()teuoiopiudape lfvsat  2um(mo;o4aex io3ildfa ra(vont4 lxnxoctydlmD  nei;t srxo(opoodlmeelivi t aruau ono4apeniieild mDum(vpnu)trxnxr ty1lmte uvslt  2xmxrpiu1omte ivta(fartau  ou0texn i3iltfa ra(vs t0 eenir3ty1fm elnvo t0t2xo(m ou4lpt mnvs s) 2rmxrpnt0ole  f3iyt s2emnvonu)aexnmrctodoa  ai sl()s2xrxr nodam  mfvsltfarua(r ;o0oeeomfciad a rl(vo t0alxoif totomD  neils teto(opoy1om emict ( s2rm( pnt1alxnii3tas mDrauvp;t) exnir3oa1omtelnesls0teum(o iy4lmt mnvta(faDtrx  ot1apx  oeiaslm2ean snu4arxoiociy1oaDe i s;() euoxo nodoltnmivt s  Dtrxmp;o1aetnif3tltfmDeln s;(0 rtnmo3iodfateauvsl(  2urir3nydol  lfeslt sDuaxmp;u1olen i3iydfsDuaumpn(4teeoxr to1fm eau o;( t2umxopnudlpen nesas srrrxro;o1alenmf3ils aDrlu pn(4aetnxrcta1opDranvols0 2uoxm3iudaltnmfct s s2rru  nu1tpt  oeiys m2ra(mo;() exrmr3iytfmDrlieilt0s2tr(m3iy1olee fvt s sDumxm ;t0oexomi3ias m2ul(vsnu) eeomf tydoat livs;s0 rtrimpiodap n fvtl()sDtaxrooo0tetnifetldlmDemums u)tleoio ty1oa   uvs;t trtoxmpiu4om  mfet ( arrauronu1tpeo i3iadfa2rmnvont)arermf iotlm rlieol( texmxr ou4am elfei t) rtmumo;t4tpxniicilsls ul(von(4trxomo3ta1om   iesls  2tm(r nydolt livsls) rra(ro;o0teeoio3tad s2ea( p;()trermr3io1oaDraueilt0srxoxrpny4optemfcs ( s2rmu  ;t1aptn o3iys sDrlnmpn(4aeenio3tadopDean o;s s2tmiopoodam emivilsfaDumumpnu1apx mfcilsfa2um(
\ No newline at end of file
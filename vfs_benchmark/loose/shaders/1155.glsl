@@ -0,0 +1 @@
+u ol()trurxr nydop nlfctas a2ua( p;o4tpt mf3iydla2ua( snt0alenio oatlatr ies t)tetmxo ny4optnlictlt  Dtr( o;t0oet  o3ils mDeauvp;t0artrif3todlmD au s s  2uoimpnydlpee feil(  Dtmu oou1tet iieiatfm umumo (4altrmoctydomtelnvi;()t2umio iudolt licias  rtrx  ;u1opxnmietldfa2emu s;(4tlenmoctodfat  n i;( trtr(r3io4al nmnvsa(farrrx oou1opx mocias a raump t0trerif3to1lmDeli ol( tetoxr3nodaltnlnviltfaDra(monu0ole ifciyd s2emnvont) ltrxf io1lmD lueil(0s2xriopno1lltn ietat sDtr( p;t4olx  i3tltfa2rmnvp (4tlxoxoctydlpDelu o;t0 2um(mpnu1omtelneil(fsrtmx p;u1apenmietat m2rlu s t0 lxoio3iy1omDrluvo;t0seur(m iydopee nesatfa2rr(m ou0optnifciyslsDrmnvo;(4 exrmo3ty1omDe u s;t)teurio3oy4omtemfesasfa2tmxrpnu4tlenmocildlaDrlu ont4aleoio tadfpDr n s t0 rtoiopiu4lltnlneta(farta( pnu0alt  ictlsfa2eanvs (0altoxo oo1fmt aivs ( teum(r3ny1amte ieiasf 2uaumoot0opt mieiltfa2em(msn(0alerxr to1opD aneols s2xo(m3nydll emnvsa( artru  nt1aex  ieilsfm2rl(vs;u)alenxocio1lpD lnei;t trxrxrpou4ap  mnctlt)a2tmx  nt0aex  i3iatla em(vs;t)texrif3iy1omDr ivil(0 2uoim3io1lltn netlsfaDumxmo;u1oex moeilsfa ranmp;t0tetomocta1lateln s s)srurir no1lmtnmiesl(  2urx pou4texoiicildls rlu s;t4 lxrirciydlmDe u ols0s2xo(mpou4op emnviat sDuru  ;o1tetn iciydfs2rlumpnt4 rtoxf3iydfmD luvo t  eum(m oudal nlicias aruaxr ;t4tlx ifciatlm2umu p;u0aleoifciy1fa  au olt0 rto(m iodopenmfvsl() 2trx p;o0tpxnii3iydfs2em(vsn(4 rtomo3iodoaD  n o (0t2xmxopnu4altemivi (fsrur(m nu1oeeo ictatlsDem(mp t0tlerxociydfat lieo;t0t2tmirpoy1om n ivtls) Draum ;u0olxn ictytlm rl( s;t0artnio oytfptrai ol() etmir nu4omtemictas)a2umxmo;o1aexn fcildfm2ul( s (0trermo3iydlpDeanvi;s  2xoirpiodom  mnesls)s2uru o;t1tle mietat a2raumont0 eeomo3iadfa e ies;t srto(m3oydapt  fvi t)srumuro;t0opxnmfciatfs umn o (0aetoxr3ty1oat  nvi (  rxmxm3no1ll   fvsa(f 2rrumpnt1olx  fciyd s2ul(vo (0aleoxocta1latrlnvo;s  2urxopoudaptn nvi tfsrraumonu0tlen ieiyt s elnmp;t0altnxrcio1faDrau o;()tetoxo3iodop nlietlsfarur(  ou0oexn f3iydls ua(mo;u4tltnxrctadlp r n ilt0t2xoim iudom  miesa( arum(  oo1open feildla2ranmpnu)artomocio1opD  neo s)s2um(rpoydlp nmfvtlt s2rru o;t1tltniieilsfmDea( s;t4 exnif3ia1fa elnei ()s2to(mpnu4amee nei s aDtauroot1tle iociysfs2uanvo u0 rtnxf3iydfm rli s (  2tm(mpny1openliciltfaDtaxr nt4oetoii3tltlsDrm( s;u4 eeoxfciadlmt  n o;s0 2toxr3iu4ole  ncia(fsDumu ooo4apt moeildfsDuaums;u)aetomr tatfpte ueol(0seum(r3iodape livi ()srtmumoou0oeenioetatfm2uln snt4 etrxo ootfp rai i ()seurxrpiodomtnmfcia(f 2rmur ou1opt mo3iltfs ul(mpn(4trtrir3ta1oaDr nes ( texr(r3oo1olen fet s)a2tru  no4tpxo oeilsla2ulumon(4altnxf oo1fmtrai slt)tetoio3ou1alt lfeta()a2tmum ot0tlto oetltfm2elu p;u4aetomrcoo1omtraieo;()trtoirpou4lp n ictltf rrm(mont0oee ifciadfsDumn o;(4tlxoxo3totop eau i;(0tetmio3nodole  feslt artm(rpou4apx mf3iyd m2umnmpn()alermo3to1lp   neols trxrxm ou1lp nmnesa(f 2tr(moot0oleo ictld sDumump (0tlerif iytlmDelues;t t2xmim nudop eliciat) Drr(  no0oetomieiyt m2ra( snt)texrmocoadom e ivo t  rtoir io1alt mnvsa( arururpno1altoii3ias m2uln o u)trtrxf iydlmDelivs;t)tetrxopoodaltnmnvia()srta( o;o4tltnmoeils mDrlnvo;t4trerxr3tytlm rau o t seur(o io1ll   ieilt s2rrx p;u1oltnmo3iydfm2ua( s (4 rxoifcta1lmD an i (0t2toxm3iydoptnmictltf rur( pnt0olto octytfs rlnvp ()trxoif oatlmt  i il( sruoim io1aptelfvt ()a2uaumpnt1olxoii3ildlm2uaumont0 leomf oa1op rlu sl(0 eurimpnu1lm  lfcsatfs2umu pnu1aexoioeiytla2rm( pnu4 reoir3tytopD li i t) euo(r oo4lm elietl(f Dra(mooo0optnmoeiltfs uluvp t0trxrmf3tadfmD aues t0t2tr(m nu4oltn fcia(fs2taumo;o0apenmfctad a uanmsnt0aexrio iy1lmDraivo;t) eumimpiu1optemfeslt) 2rr(mpoo0opx mfctyt aDeluvo;t0tltnmf3oodfmte ueol()teuoxo3oydll nmicia(  Dua( poo4tpeo o3ias a2emums (4arxnxr oadlm r ueil(0t2trimpnu4omtemncsl(farrm(mpoo1tleomf3tas s ul(mp;t4trtnmo oadlp raies;()srxoio nu4aptemnesas)srtmxmo;o0tle iociasfm2eaumo t)aexrxr tadlateaneo ( t2xrxmpoudoltnlfei tfa2rau ont0alxomfeiytfm emn s () leomo tatlp   uesls) 2urxo iydamtnmict ()sDuru ont0tlto f3tltfa2raump;()aeeoxr to1oatr ivols t2xo(mpou1ap nmfes t  rtmu onu0oex miciltfaDra( onu4aetnio tytfmtr uvolt  rurxmpio1ap e ivtls sDur(  no4optn f3iatls2emn p;(0trermo oodlmDr u o;t0sexr(o oydap nmnct sf rumuroou0aetoifetld m2uln ont0aeeoxf tytfa   u o;s0teur(m3nodop elfviatf 2um(m nu1oleomo3ils sDrmu pnu)tlxomoctotlptr u s (0 2umxr3oydol n neiasfarrr(m no1olxn o3ild s uanvp u)alxnxrctytomDr nvols  rxm(m oydlltelncs s arra( pnt1oee iociyt s rmu s t)alxoxf iotfa r iei s seuoxm oo4alt  fesl( s2uru pou1oleomo3ildfm2rln p;(0 exoiocootfmt ai i;s0s2uo(mpio1op eliviat  2umxroou0tlxnmoeiasla rl(mo;(0 eenifctadopD  ueo t0 rumirpou1olte fesat)sDumx poo4tlen i3iat m el(vo t0 renxf oa1oa   i i t sexoxo iudol  mnctlt)s2rrxroot4tee  i3tasfaDrm(mpn(0 lxrmr3ootoptrli i () 2umir3nu1olee iviltf Drau oou0oeenifetlsfaDuluvont4 ltrio io1oat luvs () 2toimpnudoleemfei sf Drmxroot0tpenmoctydfsDul(msnt0texnmf oadfp  lu s () 2tmir no1aptemnvtltf 2rrumooo1tpe  octysla2uanvpnu)trxrmr oodlaD  ueslt)seuo(m ny1ll nmfesat) rurxmp;o1apenio3tlsfm ulnms t0areoio3oo1lmt  nes;t sexoxmpno1ape  ivtat)arra(mp;u0ape mi3iyd a2rlums t0trtomfctytomDrlnvo (0 exr(o3oydom e fetatf Dua(m ou1aleniiciaslaDrlnvs t0altrxo3ta1lmDraiei s  rtr(r oo4llt mfei sf 2rm(roou0oexn i3tydfa em(mont4altoio3oa1fpD luvils0trxmim3iy4optnmics s)aDra( pou0tex  ictydlaDemnvon(4tetnir oydop  ln i;s0t2to(r3iodamt mfeilt)s2tmurp;t4aex ii3iat mDrmnmo u0 exrio oadlptrlnvs (0 2xr(opno1omeelivsa()srtr(m ot4oltniociysfm ra(msnu0arxnio3iadfpt ln i ( s2xrxmpoy1apen icils)srumu  ;t4tlxn f3tyd s umn o;()arenio oytlm   uei;(  rxrxmpno1lpeemictl() Dtmurpnu4ape mi3tysla el(vsnt4 eerxrctodfaD anvol( s2to(o3no1omt mfctat)aDra( ono0alxoiiciltlm2eln snu0aetniocia1oa e ieo (  2trxm3ou1lpte fvsltf rtrxm ;o4opxnifctls m2ea(vp u0areoxo to1fate i i ( trumio nodomen ivs sfaDtr(mpnt1ope iociasfs2uln s;(4 etoxf oo1lm   i o;t0trxmimpnudoptemiet sfsrrmx ooo1opeomfeiad a umnvo t0teeoifctytfate n i s)t2ur(r3no1omeelnesat)arrr(mont1oetoifctlsfm2rlnvp (4teenioctadfpD  ieo s0 2to(o ou4altemicsas arrmumpot1texoifciys s rmu o t) etoxf3iy1omte nvs (0 2um(o nu1ame mfci s)a2um(rpoo1alx  f3iatls rm(von() lxrxrciydlp ean i t trtmxo3iydll   fvsas  2rr( onu4apenifctyd s rmu p t4alenxf3iadlatrluvo;()s2xr(mpiy4lltn fvtasfarrrur ;t1opt  fetyt sDuan o u0 etnio3ty1oate ivs;(0 exr(m iu4ope  fvs s)aDumu ooo4olt ioetysfm2ul(mp;t4alenxf3oo1omDeaieslt)sexrim3ny4omenlnei (f rtr(rpnu0oet moeiys m2ra(vs u4 exoiociytfpD  i o;( sexrir no1lltnmnvsa(fa2raxmpot1olxo oeiydfs2ua( o;t)arxnifciadom ranvo;() rxrio3oudopeemnviasfarrrurooo4tpx  oeiydfmDrln on(0alxomo oo1opteauvi ( texoxopnodlme  nviat srrrumpou1apxn f3tydfa rmnvpn(4arxrmo iy1lmD lnvs;t0t2tmiopiydalt lfvi (faDtm(m ;t1oetomociyt m2rlnms;t0 rxoxf3ty1opte ueo s sexo(opoudal   fcs t)aDtm( p;t0apen feiyd s eluvont)aetnir oytomDrauvilt0 exmxmpiydlmt  fcil()s2tru pou0oex  ieiasfaDuau o u0 rtomo3to1fa  au i ( srtoxm no1optnmnesasfartrurp;o4tetomf3iyt s rmn s;u)aeeomfcio1lmt lieo;t) 2ur(opny4lmtnlfesa( aDrmx ont4aet  i3iys s uan onu0teenxoctydfp elnvsl( trum(m oy4ol  mnetas)arur(r nu4olen o3ildfm rlnvo u) lenxocoodfaD  u sls0sexrxo3oudoptemivi s)a2trur ;t0aeeo iciyd mDumnvsn(4 rxoif oadfatrlnvo t sexoir ny1alee nviat  Drr(r ;t0alx  oeiltlm uau o;t4 reoif ta1fmte ueils)tetrxmpny1om nlfcs t) rrau o;t1apt if3tysls um(mon(0tetomfcoatfmDe i i;(  exmimpny4om elnvias  Dumu  nu1tlxnmfciasls eau p u)tlxnmo3oadla raivilt)t2xoxm ou4ol elnesa( sDtr( ooo0tetoii3iaslsDea(vpnu4texnio totfm eaivi t0 ruoim3ny4amtnlfesl(fa2umum ou0oeeomfctysfm umnmont0aexrxr3iodlpteaieol(0 rurim ny4omtelfvs t  rtaxmpot1alen ietyt a rm(vp;()treomf ia1faDr ieil( s2urxr3oudlle mieil(f ruaum ;u0aeto ieildla2umnvont4 etnmo oytfpDeaivils0s2umio no4ameemies sfsDum(mo;o0tetomoeiad s2ua(mp;u0tleniociy1omDraivi () eto(o3iydol e iet sf Durxrpnt4aet  oetatla rln s u0tltrxo totfpDelneo;t) rxrxm3no4ameemfci s) Duaxront4ole  octltfa rmump;() rtniocoa1oaDranvilt0 2xm(m nydlpenlnei sf rtrx o;t0ape ioetltla rlnmo (0aexrircoatfp r i s t)tetrio io4lm e neiasf rtmxmooo1oltn icilsfm umuvpn(0texomf iy1opD  iei t0srurio3iu4lp n fctl() rra(rp;t1aee if3tyt sDelnms ()teeoir3ia1op  lneo s setrxo3oodal nmiviat)s2tmx o;o0aeeoiociltfa elnmp;u0trenmfcty1omDrlnvi;()seumxo3iydlmtnlfeils a2rr(ronu0olt moeild m ra( o;u4teerxo3oa1laDrluvo;t) eumxmpno4opee feil(farua(root0optoioctltlm rmnvs (0tlxniocio1lmtr u i t0s2xm(opiy1opeelivs sfsDrmumo;o1tptomfeiadfa2uan p;t0tltomrctadlpte nes;(0s2xrirpoy1altelivi ( srrrumpno4opeo fctytfs2ran snu)trtnir totlatrliesl()sexmiopiudol   ivil(fsruax  ;u1aetn ictatfmDrl(ms;t4texoir3oo1oa eliesl()s2toir iy1aptnmfet (faDtau poo1opx  f3ildfa ra(vsn()trermr3tytfm e uvi;s teumir io1om   ici t aDum(mp;t4aee mictldlmDean p t4arenxocootfa eaivs t seur(r oy1olte fctls arrmxmo;u0oltomoeiyslmDumumsnt)alenmf3oadla eau i t) eurxopno4llt mfvs () rtr(mo;o1opx mi3tltfs uauvon(0 rxomfciytlaDe ueo () eumio nu4olenlfcslt  2tm(m ou0olxoioeiltfm em(ms;u4altomo3iotomDelieil(0srumxmpiu1ll n ivta(fa2ta(ro;t1apt  ieiltfm ranmpnt0tlxoxocoodomteaivil()srto(opny4ole lnvt t) 2uax  no1olen i3iatls uau o (0tlxrmfcoy1omDrlnvsls0sruo(o3iy4lpe mfvia( aDtmxm nu4ole iocilsls rl(mo;t4arxnxr3iotlp e n o;s0t2xm(o3nudom n netas) rrrxr oo4openif3iasla em(vs;t)texnmr oatfa eanvol(0seur(opny1op n ivtasf Drm(  nu1ale  o3tytlm elumo;t)aetnxo3totfmDe uvilt trtmxo3nodaptelfvil() 2ur( pno4tle micilsfa eanvs u) rxrxo oadfmte i s;s s2urio3iudop n fvsls) Draum ;o1ale  o3iys aDumump t) eeoxfcta1lat li s (  exo(opiu4op  lnvtat artaxrpnt1aeto o3ias aDeaump t)aeenmfciy1fpD li o;t0 2xoimpoudal elnvtl()artmxm oo1tptn f3iydfm emnvon(4tlenxo3ia1lpD aneolt sexmim3oudom emnvslsf Durxr nu4tpx  octad m em(von() renxf3oy1lm rliei;t sexr(m3no1open ict ( arua(  ou0opxo feilsla ul(vp t4trtrmrciytfmtrlnei s) exm(o3iydlpeelies t) rua(rpnu4tlt  o3tlsla2ulnvont)tltoxo3iotfmt  u i t) ruoimpoodlleemfvtat)aDua( ono4apxn f3iytfs uanvonu)arenif3ty1laDranei;()trto(m3iodal  lfvta()a2raxm nu4tlx ifeiasls ea(von(0teenifcta1fp elueslt sruoxr ny1om nmnciatfa2raumpou0tlxniociytlm ra( o;t)treomo ty1lp  anes;(0seuo(r3iudlptelicia( aDtmum ot4tltnmociatlmDumn p;()texoifciadlpDraivolt) 2trir ny4ome lfei (  2uaxr ot1oee  ieiatls2ra(vsnu)aeerircoodfatraneo t)srurxopny1al   nviat) 2rm(mpot0aeen ietlsfaDeanvonu4aetnio ia1fpDelnes;s srxmxm3iu4oltn nctat)a2umum ;t1aetn ociys s2eln pn(0 exrir3iodla eln il()srtoxm3iudaptelics ( s2ta(moot0apt ii3tysfsDrl(vo u4 etnmoctatfaD lu o;s)trtr(m3ou4llt  ivsas arrr(moot0ope mi3tatfsDua(vs u0 ltnmr io1lpDe nes () exrxr iu1ome  iesas s2rmxrpnu0tee  f3tasls uluvo ()aetnxf todla ean s s s2urxmpiydaptnlfvsatfs2rrxm no0tlenifetldla rlnmp (4 etrmr iy1lm   n o s  euo(o3iu1omen nvt t)aDrrxr ;t0aptnmfciadlm2eaums;t0tltrir3iotfpDeauvolt  rxmir3nydopeelictat) 2tmxmonu0apx if3tytfa emump;u)tlxnmociadfmte n i t0s2xrxmpny4ll e fci tfa2rmxmp;u4aet moeiatls uanvp;()tlenmo3iadlpDrau o (  2tmxrpoo1ape  nviat  rumxm no1tpx mo3tltfmDulump t4trtrmo3tydfatrlivolt  ruoxm3oy4ap eliei tf rtr(r nt0tle moetysfmDrmnmsn()aetnio3oytomD  n i;t s2toiopoydap   nvtl() rtaump;u0tpxnioctydls emn p;() lxnir oatfp  lu o s  rumxo ou4om  lneilsf 2taxmpnt0tpt  oeiatfmDul(vo;u0teeomocto1laD livs;s  rxmxmpou1omtnlnvt ()s2rrxro;u4tlt mi3tytlm2em( s t)tlenxocta1oat an i (0texo(o io4lp e ics tfs2umumo;t0apenioetls s2ra(vs;u0 rtnxf3tydoat ln ol(0texo(r3no4lmeelieils aDumxrpoo4apto fctls a2rmnms;t4texrifcia1fat lieils0 exr(rpno4aptn nes t srua(r ot4olen ietyd s2rm( pnt4aetnxfcoy1lpt  n i (0srxo(r3io4lmeemivsas  rumu  oo0opxoii3ias m2el(vsn(4tlxrmf oydopDe u o;t)teuoirpoo1llenmietlsf Dumxr ;t0oeto f3ias a eau s;()tlxriocoadopteau i ()srur(mpiydllte nes tfaDua(mp;t4aetoif3iadfs2el(ms t0tetrxocoo1lpte n i;(  etrimpoo1ome mnviasfaDta(mpot0tptomi3iys a2eanvp t4 rtoir3tatlmD  ivsl(0t2xoxr3nu1al emivtl(fs2rr(  nu4opx ifeias m2ran s u0trtoxf3iadfa eaueo;t0 rurxm3io1op  mfctlsfarumuronu4tltoifcilslm2rl(mp;u0tleoxr3iydopD  ivo s0 eumim iu4ap  lfcsl( sDtmxr nu1tet if3iydls2rm( o;()altrxf ta1lat  uei s0t2xrxo3oodomte fvslt a2rm( pno4tleniieiyt m2rauvpnu)aeenio iotopDe n olt  rumxm oo1lp nlnvtlt aDtm(r no1tetomfeiadls ran o t4 rerio3ta1fp rai sls) rtmir oo4al nlnvsltfarra(mont1tetnmo3iysfsDeanvp t4arxoxf iotop elues t sexo(o oodopte ivi sf rtaur ;u0apeomi3tadfs2ra(ms (0tltomrcoodfmt  n sls)trxm(o3oy4am   ictlsfarta(r nu1optnmf3tltla2rmnmp t4 rxrmo3tadomteli o;s)t2xm(r oodap nlfviasfarra(mp;u0aexoio3iaslsDra( p u) rerif tatopD  ieils)tetmxr3iu1llen ncs t)arrrx p;u1aptniociydla elu o;t)alxoxrctytomD aivs t0teuo(r3iy4ol nmnei s) 2tm(m oo4tetnif3iadfs elnmo (0aeerir tydlaDelivs;s0 ruoir3ou1lm  lictasfa2rm(  no4oeto ocilsls ra(vsnt4 leoir ty1lmtrauvo;t0t2uoir nu4olenmivsatfarrmump;o1aeenmicias s2eluvp (4arermf3tatfmDrlivilt  2xoirpny4aptnlnvilt aruaumono0tet mi3tls a rlnvo;(4tlxoio3ty1fat lnvolt  2tmxmpiy1ap  lnvilsfaDrmxrpnt0aexniieiatfm rl(vp t4 rtnxr oydlmD  uvsls  etoxm3ou4lltelnci () rrmxmooo4oexomfeiasfs2umump;u0tlenxocoodfa   i i;s) exrimpoy1ol nlnei tf rtau o;u4alxoiiciyd mDuanvp (4trtnxocto1op rai s;()trxoxr iodlltemfctls)a2urxr ot4apx moctydfmDrl(mp;(4 etrxf3iadfpt aues t0srtmxr oydome lnet ()a2tm( pnu1apx  f3iasfs umuvo t0aetnxf oydfpDe nvi (0 exmxm iy1olenmfci s s2umuroou1apxnii3ias m rl( snt0aetoircoa1omDr i o s t2xoio no1optnlnesls) 2ra(r ou4tpe mfctasfm umnmp;u4aeeoifcoatla elivs;t sruo(m iodapte ivsatfsDuau  ;o1tlenmfetat s2rmu snt0tlerir3oodoatr ivil(  rxrxo3nodom nlnetlt)a2umur ;u1tetnii3iad s2emnvont) ltomfciytfpt livslt0t2trxr nudomenmfeiasf Drmuro;t4aptnmfciasfaDumuvs u4teenif3iytomteaueols  rtr(opiy4ap e nesatf 2umxm ou0optnmoeils mDel(vs;u4 exomociy1faD  u s;(0trxoxopoy1omte icsltfsDtmumooo1altomi3iydfs ea(vs t)arxoifciodop r nvi t0srtmxm3oudap  mnci s arrm(m ;o0tpeoio3iat s2el(vpnt0 lxrio3oodlm ranvi;(0s2xmxrpiu4altnmivil(  Dtmu onu0ape iiciasla2umu s (0 lxomfciadlmte uei;t0 rumir oudllee ics t  2rmxr nt4aetoif3ils m ra(mo;t)tlxnmf3to1oaD ln olt)trurxrpnu4oltnmicia()a2ta(r nu0tpenmieildfm uauvont0 etnif oy1oa raieo t0srxoxo iu1ap  mnctl(fsDraxroot1alxomiciytls2elu snt)trtoxf3tatomtean o t sexmim3iydlpenlnvt (f Durxmp;o4aleoif3ilslmDumump t)altoxo oytfat auei s0texmxrpno4aptnlnviatf Draxro;t1teeoio3iyt a2uaumpnu0arxnif3tydopDran o;t) etr(rpio1amee ncsls)srtaump;t0tle  oeiytfmDrauvp u) exomo io1om r ivilt0 2umxopoudllenlnctls arrmur ;o0aptnmietydls2um(msnt0aetoir ta1oatrauvols)srumxm iudopte neias)sDrrx ooo4tltomieildls ua(msn(4arenxo3tadfpt lnvols  2um(o3oydap   ncia(  Dumur nt1oexo o3iyd m ea(vo;u4trxnxrciatfpDr ues s setoir nodomt mnvs t) Drax pno1tleomfetlt a2rluvs t0teenio oydoa eanes;() rtoxo ny4lm elnvtlt)a2urx  nu0apt iieiat sDemn s;()teerxr io1fpt au il(0s2umio3ou4lmte nvta()aDtaumo;u1tpenifeiltlaDrlnmo;t0 rxnmo3ty1fmDrauvi;(0t2xmim io4lp n ictltfsruaxr ou4oexoifcilsfs2eau s;u)trerio3iatlatelivo;()s2urxmpiu1ap nlnvsls) 2rax p;u4tetoifetaslm rl(vp (4 rxrif3iytfpt lnes (0teumxr3nu1lmenmiviasf Draxm nt0oleniociysfa2ranmp;t4texrif oadopDelueo;s)trumxm3nu1oltnlicsls sDumxm nu1tlxn feildlmDelnvpnt)tlerxf iydfmDraivo s0trurim3nu1openlfeils) Duau o;u0oex io3ias a2eluvp t) exoir3oytom  aivs;t) 2um(rpoydop nmfcsat sDrmxronu1tptnmoetatfaDran onu)tetnxr3iatfa r nei () rurxm3iydlmenlfesasfsDtm( pnt1ape mi3ildls uanvp u0arxoxo3tytlp  an i;t)setrirpnodlm e fcsltfs2trx pot1alxo oetasls2rmnmo;u)areoxocia1omt  n i (  2urir nu4aleelivi sf Duax ono4teeo fciasfa2elnms t) exnmo ta1lmD lues;s) exrxm3iudal emnvia( aDta(r ;t4tpt moeildfaDrluvsnu)tltoxf3todla  ln s;t t2xoxo iu1llt mivi tfsDrmu ooo0oex mieiytfm rmuvs;(0 eermf3ootom elieils)teurxm3oy4omt mivsl( a2tm(rpnu1oeen fciysfs2elnmp u)teerxociatfa  ln o t0 euoirpiu1omtnlnetatfs2trxmo;o4opeo feiatfsDrm(vont)tetrxo ty1fpDr ues;s srxr(o no1amenmfet tfaDuaxmo;u4tlxnioetatls elu o t0 eeoxr3oytfatelnvil( srxrir3oydoptnmietatfsrrrur ou0alxn fetasfa ua(mo ()trtoio oadfmDeanvi;(0s2um(mpnu1amtelfvsasfsrrrxmpnt0aee  ictytlmDra(mp (4altoifcoytfm r i i;s0 2trxmpny1am elfes s a2tr(mp;t4tptomo3iydlaDeluvpn()artrio3oa1fat  nvi ()trum(m3io1omt lnvilt  2uaxr ou4oeeoifctysfs2uanvs t)alxomo tytlpD an i;t0trxo(m3oy1lltelictasfs2rm(r nu0tlx mf3tltfa2umnmo;u)aexnmf io1omtrau s s s2toxopnudll  mfvsas) 2urur nt1apeoif3iltlmDum( p (4trxrxr tadfpte iesl()texmxr3nydaptnlnvsltfs2um( ooo4openmi3tld m uau pnt)aeerircta1lmt au o;t)teumim3ou4oleelicils a2urxrpnt0olxnmo3iysfa2elnvp ()arerxf totlatraivs s0truoxmpiydomt  ncilt)a2urur ou1tlx ii3ias s2ranvp;t)tlxrir3ootlpDelu ols)srtrxmpiu1altelfeiasfs2rr(mont0tpxnmietls mDrm(mo;t4trenmr iadoateaneo s srtmxm3nu1ome  fvsltf 2tmurp;u1oet mieias sDranmo;u0 reoiocoa1fpDrlnvi ( s2xmiopny4ap emivil( s2rm(  no4aexnmi3iyslaDua( p;(0texrmr tadomDelu o;t)sruo(r iu4llte nvs tfarra(  ou1oee mictad a umnms (0aexnxfciy1oaDeaneols)seurxrpnu4oltemncil(fsrtaxro;t1aet  ociytlmDrl( ont4 rtoio iatfatrauvi;(0 rurxrpiy4omenmivsas a2ua(r nu0opxoio3iadfa elu pnt)tlxnif3oatlptean i;( sruo(opiy1ll nlnvsat) 2ur( pou1tee io3iyd m2umumsnt)arxrio3oodfaDeau ols) rum(m3iy4openlnvtl()arrm( oot1alxnii3iytlaDua(vpnt0aetomr3oydlatraies;s0s2umxopnu4om elfct ( a2trur no0aet if3tat aDrmump () rxrxr3oo1op raivil()trxrim3no4apte ncsas) 2rrumpot4tlxnif3taslmDrmumpnu)tlxnxrciadfpD ln ils)s2xr(opoodll nmiciasf 2ua(rpnt4olt  o3iat mDuau p u) ltoxo3oa1fmt lneo ()srxoxm ou4ap nmnci sfsrua(m ;u1tpenif3tlsla2emnmo;() eenxf oy1oaDr u olt) 2trxmpoy1alt lnci ()arta(m nt1openifetlsfs um(vont0alxrmo iy1oaD  i o (0 2tm(o3ny4lp elneia( s2tr( o;u0tet  i3iltfa2em(vo;u4artomr3iodopt  n s;s0 2xoio ny1aleemfetlsfsruau oot0apenmfeiytfmDem(ms u4trtrmociatlm eanvi t0 eumirpio1oltnlivsa( artm(rooo1aex mociltfmDrl(vo;(0trxomocoytfmD anesl()trurir3ny4lmt mnvt t)sruau oou0olx if3tytfs emn p;(4 rxoif todfa r i slt)t2tmxmpoo4ole  ivtltf rtau ooo1texnmf3ilt sDelnmpn(0 etoxr3iy1fp eanei t)seuoio oodape mnetat)sDra(r ;t4tlto ietad a ranmpnt0 rxrir oydfmtraueolt srto(m3iudaltn fvslt) ruax o;o4aeenmfciys a ul(mpn()artrio3iydlptelneo;s0t2trxopnudll n fetltf rtau pnt0oetoiieiysfs2rlu on()alxrmfcoatfp  aivi t0trxr(o oudapt lnesl( arraxmp;o4olt  o3tysfa ea( s;t4aetoxf3ta1lpDe neslt0sexo(rpnydopenmfeslsfsDraxrpou1teen feils sDel(mpnu)aleoir oatfmDraiei;(0s2xoimpnudopenlnetl(f 2ur(m no1aexo f3iydfs2eln p;t4 renifctydoptelues;s) 2trirpiydome lfesas srua(mo;t1tpxnmiciys mDelnvont0alxnmocoa1oaDe uvsls0trto(mpnydomt mfciat s2tmxm nt4oexo i3tyslsDrl( s t0altrxo3io1omDraiei t0 exrxrpnodal emneta() 2rm(ro;u1apt ii3iaslaDran p;(4tltomfctatlmDrlivolt tetm(o3oodlmte nvs ( sDra(mpot1texo i3iyslsDulnmo (0 rtoif3iytfp raneo;t0seuoxrpnodll e nvtasfa2rrx ont1aex  ietysla eln o u4 ltnif3ty1oaDe nei;t) 2um(r3oo1lp emnct s a2umxm ;t4apeoifcias s em( s (4 exnio3iatlp  lu i ()texoxo3oy4op nlncsa( s2taxrpot4tet mf3ils s2eln o () eenir io1op  au s;s s2um(r3nydomtnmfvil()srtrumpot0olxn o3tysfa el(vo (0 eeoio iotoaD aueo;t teumim no4omtn ictatfarrrxronu0aexn f3iaslmDulnmonu4 lerxo3oy1lp r i i;(0 rxmxo nu4openmnvtas arrrxr ot1tetniiciad s umu p;t4aetnmo todfp elueo s s2xrxmpnu1lp emfciltfsrtmurpoo4aptomoetydfs rl( o (4aeerir todfmDeauei;t)trtm(m3iu4lmtelivsas  rtm(rono1oexoio3ilsls em(vp;(0trxnmr ootlm  lnvsls seumxr3iy4al elfciatfs2taxm nt4tpxn fciltfm umnvpnu) reoxr3tydfm rluvsl(0 etoxo io1lptnlncsl( arrax  nu4texoif3iyslsDelu pnt)arenxr3todfaDrlneo;(0trur(o ou4lmtnmfciat)a2ra(  ot4alx ii3iysfm2rl(vont)alenmo3iodomt lnvo;( sexmxmpiu1op nlfcta()s2urx pou1tptoio3iatfs2emnvs t4texnmf3iytlm ean s;s srtmirpiy1om elivsa(fsrtaxro;u4aet io3ilsls2ranmsnt0 ltnmrctotoaDraivi;s texoirpnydll   fvils  2taumpnt4tleoiocilslm emn pnu)trxomr iotoat luvs;(  rxr(o io1ll nlnctls) rtmur ot0oet mfcilsfaDean o;(4aexnmf oy1oaDelnvo t)s2toxrpnudom nmneilt sDtaxrp;t0alenmiciydfm ulu s;u4altrmrcty1omDrli i s0srxrio3nu4am emneta()artrum nt4oetniiciadlm rl( pnu0trxomo ia1lmDeli ilt)seto(o3oodomt mfvslt) rurxr ;t0aleomiciys m2em(vp (4altnxo tadopteli ilt) rtmio iu1llenmiesatfarum(m oo1oee  o3iasfs2rmn o;u4trtrxo oatfatran i;(0 rxoio3no4olt lfetlt s2tmxmo;o4tlx  ociydfm2ran snu0trtnif iytfaDe ivslt0trxmxm3oodlp e fci t)s2ta(r ;t4tpen fetldls2um( snu4arerxfctytfa ranei t0t2tr(r3oudlmt  fesl(farua(r ;t4openmictatls rlu o;t0arenxrctotlpteanvo s srtoio iy1ole lnct ()a2umx ooo4aet iiciasfs2ua(vs (0arermr to1omD lu s;s s2tmxopnudol   fes s)s2ururo;u4apxn ietasla2eln s;u)tetnmocty1fmteaieils0t2urxr iu4apte nctls)srrmxrp;t4olt ii3tyd s2uluvsnt) eenircta1lp   uvo t0srxrxr3nudomtn nvsa(  2rru pou4aetomfciydfa2uluvo t)trtnxrciy1lmDrau i;s) exoxrpnudol n ivi t) rrm(m ou0apxo f3iydfs elu snt4 rxrif oydlat  i s s trum(r3nu4ape miet (fs2tm(  ou4openmi3tatla2ra( snt4trenmfctatoptrauei;t0srtoir3nodopte nvslt)arrm(mpnu1tptoii3iysfmDraumpnu0areoxr oytlm eau o s0tetoir nudome lict (  rum(  oo0oetn i3iad mDelu o t0arerirciy1fp rauvol()teuoir3oodlm  mietls) 2urump;t4oltoiieiysfs ua(vo u) exnmf tytom rlu o ( texoim nodllenmfct s) rtax  ;o4aee ioetas a2rlnms;u4 lxoxo oydlmtraneo;t) eur(r nudlp n ivil(f 2rmu  no1oexniictls mDem(vp u0aexrmrctydlateanvil(0trxo(r oodopt lici sfsrum(roou0aet ioctas a2ra( o t4texoxfcoadlm e iei (0srtoxo3oy1op nmnet t)aDrmuronu1tpxniieiytfa um(vp (4 etoxf iytfm e nes s teum(o3nydlm elietat s2rmuronu0apxnmiciasfaDea(vp;u0alenmr3iytomte u o;() etoxmpnudaptelncils)aDumx pou1aet  ieiysfmDrmnvo t4teeomo3tytlaDrauvils  etmim iudapt lncta( artr(m ot1oet mfetas aDelnvp u)tetrxoctytlmD ai i;s)s2uo(r3iu1llt mfeias  Dua(ront1tpxnmfeiadlaDulnms;t0alxrmociotlpDe ieslt0t2trxr3ou4olee nvias srumx oou4oltnmo3iltfa2ea( s t0tlxnxf iotlmteluvolt)teuoxm no4lp nmivtlt s2umxmpou1tle ifetltfm2uluvonu4 ltoxrctatlmD luei t sexrxm oo4ope mieslt  2ua( oou1tlxn fciytlsDumuvpnu0tltrmfcoatoateliei;t0trtrir no4lltelnet s  Duax onu0apenmfetlslm um( sn(4 exrmrciodlp  auvi;( s2urio3nu1alt licsls) Dur(rpot0teeo o3tlsfmDrlnmp;()aetrxf tadopte nvsl( teumim3iydap   ivsa( a2tru pou1oleniieiadfs rmn s t4 leoir3oatlp e i s;t t2toxopnu4aleemics sfa2umumonu1altoio3iyt s2umnvs t4tleomo totlpt luei s0s2urxo nu1ll emncia(  Drrxrpoo1oee ifcias a ua( o t)tlxnmo oodlpD  n i;()s2tr(mpoodoleelnvs tfa2ur(r ;u1alto iciat s um(vs;u4tetrio3oadlaDe n s;t  2trxo3ou1amee fvt sfa2tmu  nu1tptnmieiyd a2eluvsn()aleoxocoa1fa rluesls  euoir iy4lmeemfcil()arum(mo;t4tpt mieiatla2eluvo;(4trtrxf3tydoat  u i;s0 2to(mpiodaltn fvtas) Dumurpno0apx if3iytlm2emnvp;t0arxnio iadfm  lues;s s2tmir3oydome lneslt srraxmpot1alt  ictldls rau p;(4 lxnxr to1fmteauei s0 2to(m3oo4om n ivta(faruau o;u4oee io3ildfs2umuvs (0artnmfcoa1omtraues ()srur(o nydol   fctl( s2umxro;o1apt iieilslm2rmumo;u0alerxfcoytfatr u sl(0trxr(mpnodale  ivt s arum(r ;o4ale ioetytlmDulu s;u4 exnio totla raieil(0trxm(opno1olen ncils) rtm(rpou4olx  icilt a rmnvo;t0arxrioctatfaDeau s;t s2xm(rpoo4omtnmivils srumu  oo0ape  ictatls2ua( s ()arxrxociotoa rai o;s0 2xoirpoy1aleelicil(f ruaum nu1openmf3iysfm2rmuvon()alxnmf3iy1opt anvsls) euo(m oo1ome mncs t)s2rm( oot4tpe moctytfmDumu o;t0aetomo3oydoa eanvi;s  2um(opio1lpe  ict s)arrr(r ot0opxo ieiydfs2uaump;t0 reoirciatoateln s t  exrio oydameelnesl()arrax pno1opxnmfctlslm2um(ms (4areoioctytopDraneol(0sruo(r iudlm elivtl( aDraxr no1alxoiociadlmDulnmp t0altomr tytoat li il(0seurxr oy1ome mict s s2rm( pno0alenmoeiad aDelnms (0areniocoo1oatr ivs;s)t2um(m3no1alte nvtat) 2um(  ou0ope moeiat sDem(ms;u4arxrxoctotom r n i ( texrxmpiodamenmfcs (  rraxrp;o4alx if3tltlmDran p t4tleomf3ty1om eluvo s) rtmxr3iu4ll e ieta(f 2rax pou0aee  feiysfm2uaump () exrxf3oa1oaDraivsl(  2xmxm oy1oleemiesasfaDrrxr ou1tpxnmf3tyd aDeanmp;t0 rxoxo3tytlmt  uvs;s0 2xm(o3io1lp e iviatfsrur(rp;u0opxo i3tysfm2rm(mo ()tlerxrctotlmDraies s)s2tmimpoo1aptn ncil(  Durx  ;o1ape if3tyd a2umn s t)altrmrcio1laDrau o t)seuoxr3iy4lmte ietls aDuaumont4openioeiysla ul(vs;u)tlxrmfcoa1fp   u i;t0s2tmxo iu1lp  lfvt s  2um(rpoo4oleomieiadfs2elu onu4arxoxf iy1op  an i t0 etmxo3ny1lme livs () 2taxronu1alxnif3iytla emump;()arenio3iydfat  iei;t0srxo(rpiy4apen iet (fsruaxmpoo4tpt mietldlm2ranvp (0 etomf3oytfa r i s;t  2uo(r3oo1am  lfvs t)a2ua(m oo0ole miciatfs elu p;(0tlenio oodlatraieolt0t2trir iy1lm n nvsas aDrrumo;t0tpxn oeiyt sDul( s (0 rtrxocoytfpte ieo s)sexr(rpoy4al  lneia( s2rmxmpoo1aeeomoetlsfs rmump;() rtnircoodfp  ln slt seumir nodoltemics sf Dtmxrpou0aetn f3ilsfsDranvo;t)tetoio3ty1faD auvils teuoiopiodom n ici tfa2uaxr ;u1aex  iciydfaDemnmp u4aeerir3oatfaDeaneilt)teuoxr3nu4lltn fcsl(  rraxm ou4oex mf3iatfa2umu p (0 eerir3oytfptr uei s t2tr(r oydlle mfetlsfa2raumpoo1ape ii3iadls2rl(msnu0 lxnmf3io1oaDrlivo;s0trxmxo iydop nlieilt sDuax poo0tlxnifeiyd sDelumo (4 rxrxr3todlpDrlues;( t2xr(r iudllte iei s srrm( pnt1ole io3ilsfs2ua(vo (4artoxfcio1opt ai i s0 2uo(m nydlpe  fesltfsrumxronu4alxnioeiat s2um(mont0artnif iotfpDe i ols) 2urio iy4omenlnetatfsDra(  ou0openif3iyslm uaump u0tlxnmf io1lmDe n s t0 rto(m iy4ape lfcsl(farrr( p;o1tptomo3iys a emumonu0tltrxf3oodoat liei () rxoxmpiu1lmtn ivi s s2ta(  nu1tetn ieiyt a2rm(vp;t0 eeriocoydlp eauvo (  2trxmpiu4llenlieiasfs2rmx o;t0tpxnio3iasfm uluvon(0trtnxocty1fp rli olt)trto(m3nu1olt mneilt sDrmu ooo4apt  i3ilsla rluvo;(0 ltoio3oy1la r neslt0trxo(o oy4amtemfvtls  ruaur oo0olxoif3iadlaDua(mo;(0tltrmrciotfa eau i t tetrxm nydaptn fvsatfsrum(r ot4tpx io3taslsDraumo (4trerio3iodoaDraieo ()t2uoxo iy1opt lfesa(fa2trxmpou0apt  oeiatlaDem(vont4 rxrir to1fmt aivs;(  etrxopnu4lmt mnet s srumxr ot0oleoif3tad m2eau on(0trtoxr3oytla  auvsl() exrim nydopen ivsat  rurump;u1optomoeildlaDrauvonu4aetoif3to1oatr nvo ()srxm(m nudllte fvtl() Dtr( ono0tpt io3ildfa2emnvonu)arenir totfp   n o s)srxmirpnu1altn fcil()s2ta(m nu0olx mi3iatfm2ulumpnt4teeoio3iodla rlies;s  exoxm3no4om elivia()arrrxm ot1olxoifetldfs2rlu pnu)teerxrcoy1fm eluei;s)seuoio3oy1omtnmncias  rtru o;u1apx mfciltfa um(vs;(0arenifcoadoa elnvo t0srtr(opoy4llenmicias)s2urx ont1apeo ocias sDelnmp u) exnircty1om ran i t)trxmxo3oo4ole lfvs (  2uru  ;o1openiieilt m ran o;u)teeomr io1fm eln o t0t2tm(o oy4alte iesasfsrrrxrpnt1tpx ioeiyt sDrm(vsnt4altnmrctydfpD aueols teuo(o3iu4lp e ncsatfaDrm(mp;o4altoifeiyt aDeanmo t) leoiocoytfp ranvs ()t2uoim3io4ale mfvi (fsrrrx o;o1tlxnmictlsla rl(mo;()aexnir3tytopt aneo s s2trir iudopenmnvtlt s2uaxroou1tpx mfctld m um(mo u4 lxoxo3iadom rai ilt)trtoxopio1lpeemies (farraur ;t1aee if3ilslmDrl(vont4tetoio totopte u s;t  rtr(mpnudopt  nesa(  rur(mo;t1apt mo3ils aDeluvsnu4trtnir ootomDrlieo s)setrxmpoodlltnlies t  2tauroot4alxnmi3iyt mDra(vs;t4 etoif io1oatr i sls0 rxm(rpny1open icsa( sDum(r no1optomf3ias s eln sn(4arxnmo ty1om eluei;s tetrxo3ou4opteliet ( aDrm( oot1oeenioetas aDrau s;(0 lermf3iodlp eaueils0s2umio3io4lm emnes s)aDtmxr ;o1aet  i3iadlm2ulu p (0alerxr3ty1fa rlnei t0teto(rpoy4oltelnci s)artrx  ;t4tet ii3tasls um(msnu) ltnmf tytfm raiei t0srxo(m3iydop e nciatfaDrrxmoot4ale  fciysfm2eln p;t) exnxr oodoat lnes s) rxo(rpiy4apt lfei sfaDtmxm ;o4oexniociytlsDeauvs;(4arerifcoadoat  n sls)s2um(rpiu4al nmietat)s2raur ;u4aex mo3iasfaDelu pnt4aeeoio3iydfmDe uvi;()texrio3iudap n ncs sf Drrx  ou4opeoioetad a2rau pnt) lxnmrcoadopDe nei;t)srtoir io4om  mnvs ( a2trurp;t0texn feiad a rln ont0 rerxo ootlp   uvs () exm(r nu1alt  fes ( s2uru  ;o1aptoifcilslm rl( p;(4tlenif tatfateanvs;( s2umiopiy4opee fciat  Dtrx pnt4aex ii3iyd m umnvo;t)alxrmr oadfptrlneol() rurim oudomtemfctlsfa2uaxmpou4teeoiociytls2eaumonu0 lxrifcty1fmD lnvo t  eto(r oodapt  fes t)sDumuro;o0tpen ociadfaDul(msnu0 reomocio1oa r n o t)seumxopiu4ll   fcias  rrrur nu0openiiciyt sDelnvs;t4altrio iodfaDeanvi (0 2xr(r3oydlpe mnvtl(fa2raumpot4teeomfeiyt sDuanmp (4 eermf3oy1opDeaies ( t2uoxo nodll  mfetasfs2urxr nu0ale ifetydfmDelnvo t)trxoif3iytfa ean sl(0srumxm iydomt mietl() rumxmpno1optomfeias a ulnvp t)aetrxo ia1opDraies s0setr(r3iodap n nctat a2ra( oot1apxnmieiltfaDrmu o (0 leoif iy1lp ran i;() rxoio3oudoltnlfvilsfsrumxrpoo4oex ifciyd mDrmnms;t4treomf3oo1la rli ilt0 2xoirpio1lle lnetat srrrx p;u0oex mi3ild s2el(vs u0alenirciodomtelneslt  2trim nydope lnvs () 2rau  nu1ape mf3ilsfaDumnvsnt4 rerxo3todlmDeanvol( sexrirpio4al   iei t artaum ;t0tetomictatla2ua( o u4artomr3ootlmteaneols0 2uoxr3no4omee nvi t s2tmx pot4tpeoio3ilsfs2eauvpn(4trermo3oytlmt luvs;s) exmir iudam  lfcsltfs2ururo;u1opeo oetydlsDrlu s;()alxnir3iytomt ai o;t)t2umirpiy1al nmies t)s2um(ronu4apx mo3iydls uln p ()arxrmo oydla   uesls)texr(o oudolt lfviatfa2umurpot1opeoiieiyd sDumn o t0 eenir3oo1om eaiesls0trtmxrpoo4omen fvtltf Dua( o;t1ope mf3iltfsDelnmp u4tlxrirctotfmDrlu o (0srto(o3nodlp  mics tfarurxrp;t0oltoioeiys mDem( sn(0arerio3iydomDr nes t  2umio iy1am  lfvt sf Dtm(rp;t0tpen f3tyslsDrmumon(0arxnxr3ta1fmtr ivo;t  rurirpiu4al elfvtls  Dtmxrp;o0aptomoctls m2um(mpnt0aeeomo iotomt lneo (  2toir iy4olte ieiasfartau ooo1alt ioeiaslm um(vpn(4teeriocoy1fpDr ivi;s sexoim3iudllte fctltfsDrmxmont1tptnmociasfaDeluvs;u0artoxo ia1fp elu i t0s2ur(rpoo4lptnmfci s  rurur no0opto i3tltlm ranvo (4 lerio3tytfpD  u o;s0seum(mpoodlltn fvt sf Dra(m nt0alenmo3tldfmDel(msnu0texomfciydlateluesls0seurxm3oydlltn nvs s)s2rrxm ;o1aptniicild m2ranvp;(0artrir iydoat au o s) 2urxrpiy4lptemivslt)arumurp;u1oeto fcias s2emn o u0trxrmrcoodoptraneo;( sexmir3oo1am e netatfsrtau  ;u0apxo oetltlm2ean s (0trxomocoy1fpDe uvs;t0srurio iy4ome miviatf 2trxroou1opto fctad s eanmont)altnmr3ty1lpDraivols)trxoxm3iy1oleemivtat) 2ururo;u4oex mfeiaslm ra(ms;t0aeenxf oo1om eauei;s) exr(mpio4lm  lici ( sDtrurpou1oex ifetyt a2uauvp;(0texoxo oadomDeaivsls)teurxopoo4lp nmfvia(f rumxrpou1alenmiciytfs emuvpnt0alenmrcoytfmtelivo s)texrim nodap emfet sf 2rrxroot4tltomictlsfa2emu ont)trermrcto1laD  n o s0srum(r oudlmt  ietltfsrtaur ;u0tlt ii3iasfm emuvsn()aeerxr3todop rlnvils  rxrxmpoy1lp n fvil(f Dra( ooo1teeo ieilslmDemnvon(0treoir tydfmD  ivils0 rxo(m3oy4altnlieiltf rtmur nt4optnifctasfaDul( pn(0tlxnif3to1lmD lnvi s0srtoxr oo1ll e fes t a2trx ooo4tlto fctydfs2eluvo t0tlermocia1fmDeluvo;t0truo(rpno4lpt mnct tf Dumu  oo1altoiociytfsDrmuvs;t)arxoioctatfpDelu s ( s2tm(opiu1ol n ivs s)sDrmx ooo0openiocilt mDem(vsn(4altnmo tadoatean s t0 euoxr io4lmen fcias)arurxm ou4tltniociydla ea(mp t) lerio3to1lp elueols0texoirpiy1amtemfetltfs2uaxrono0aexnmieiatfa eau p u0 leoxr3oytlp rluvs t  rtm(mpnodal emiei (  Durx  ot1aexoioctatls rm(mpn()tltrif3oatfpt  i ils truoir ny4amtemivt tf Dra(  ot4oex  i3iad s2rlnmpnu0 rxniocoydlmDe uvilt)sexo(r3ny4aptelnvsat) 2rm( p;t1tpxnioeiysfsDemumont4 lenmocoa1lm  aies t)s2tmirpiydlmenmiciltfsrtrum no1olxoifeiltlm elu p () etomr tatfpDraueo;(0s2xrim3oy1amtn ncsls)sDtau oou1tetomi3tlsfmDuluvs () rtomrcty1om eli i (0texoim3no1lpe mnciasfsDurur oo0optoifeildfm rlnvo t4 rerxocoa1fm rln i ()t2xmxr3oy1lm  lfct (f 2uaxmpou4aet  i3ilsfa2em(mpnu4tltoxr3tatlmtean i ( trtm(mpny4aptn nct ( a2urx  nu0teeomi3iat aDum( onu0 ltoirctadlpte nvi s0 rumimpiy1lltemnvsat)srumu pnu1oltnioctys mDumumsn(4altrmr io1fptr i o;()seto(r3oydamtnmnvsas) ruaxmp;t1ale if3iytls ua(msnu4altnmr oodfat  ivo;s)srxmimpiydamenlneil() Dur(  nt0oee iociytlm rluvp t4 exomo totopte n s s0 rxr(mpio1lmeelivsasf Dtmu  nt4olt iociys s2uau s u0 eeomo3iytfmD  ueols) 2tr(m3ny4lp   ivta(  rtmxro;u0tpenmoetlt sDuanmo u)trtoifcto1opt auvsls0t2xmio oydlmt  nctat)aDtmxmpou0oet mo3iadls2raumpn() ltrmociytopD aivs;t  2umimpny4omtn ivia() rum(m nu0ope ifciasls ulu o ()arenxo io1fp rli slt  exrxr3nydlm n ietlt s2tm(rp;o1aetomfetadfaDul(vs;t)altnmf iotfp ranvils) ruo(o oy1op nmnctl(faDra( pot0tpenmfetytlaDeauvont4 rtnir tydlmD aies;(0 rum(r3ou4ll nlici (f Dua(m ;o1aetnioeiadfsDea(ms;u0tlxrmf oatopte i s s0s2toir3ny1lpenmicias) 2ua(  no4teen octltfs2uanvs;u0trtrxrciydfpDr ieo t0 etrio nudlpteliesat  rrm(r nt0opeomi3tyt mDeau p ()aeeoxrciadfpDr uvo s0 rxoxopiydlpenmnes tfsrurur oo4alx  fetys m eaumo t4 eenmrcoo1lmteaues;( s2xrxr3oy4lp  mnetl()sDrmumpnt1olx iiciysls rlums t4alxoxrctatoaDeauvo ()t2toir3oodlle miet t aDurxr ;u4opxoio3ilslmDuln s (0teeoif3tadopD lueo s0 2urxm3ou4al  mnvtls) Dur(r ot1alt io3iys sDuan o u0arxrxo3io1fa e nvo (  euo(m no4om  mfctlt) ruaum oo4apt iietld s2um( p t0alxrifctatfpDrlnvs t) 2xr(m3oudapeelfvilt)aDrr(  ;t0olt ii3tysfaDrmums;()aetoif3iodfpD lnei;t0tetoxopno4al n fcsat  2ur(ro;u0oleomo3iydfm emumpn()aeenxo iotfpDelnvil(0t2xo(o iy4altemfcs s)srrmx ono0oetnmf3iadfm2em( o (0texnxrctotlmt  neilt)srtrirpoo1ap e nvslt) rrm(  ou0tlen f3iadlsDeau s;(0trxrxrciatopD  uvo;t)srurxrpoo4opt lncta()aDtax onu4apt ifciyslm2eaumo;(4 rtomfctodfm   uei t)trxrim3nu4ll n ncsa( a2tm(mpou0oee  i3iydfaDrluvp u4 etomr todfa raies ()truoio3iudap nmici t s2tau  ou1oeto o3tas s emu o;()aetrxocoatla eluvi ( truoim3no4lle mivsas)aDurum no0altnmiciasls2rm(mp;u0teenmfcoatlpDr ueo s) 2tm(r3ou4olen ict tf rrruront4tltoii3iatfm2eluvp;u4arerif iatfatraneolt0texr(rpiu1lmtnlicsasf 2trur no1aetnif3tydfm2emn s;(0arenxocoatfaD aivsls  ruo(mpnydllt livta() ruru pnu4olenii3tadla2um(vs ()trxnmoctodfa eauvs;s) etm(o oy4lmenlfcsls  Drm(m no0alx io3iatfa2rlnvs u0 eenmfcoatom rluvsls) rumir3iodlme mfeil()srua( pot1oltn icilslsDea( s;u0artrxr totla rai ilt0texoimpoodoptnmfetas) Dtr( pno4apxomfctlt s2rauvo;u4 eeomo oa1om  au ols  exo(mpoodlpt mnvsls)a2ua( ont0tetoiiciad mDrlnmp;t4treomfctotomtrauvo s  rto(o oo1apenmfes (faDtrurp;o1apx ii3iysfaDrmnvo ()aetrir3ta1fmDe nvol() rxmir nudamee nes sfsDur(  nu4opx ifciasla em(vp;u0treoxr oadfaDraivs () 2urim3ou4lleemfesat  rrrum oo4optnmf3ils s emnmp;(0 rtomoctadfa eau slt t2uoxr oodolee ivt (fa2rrxronu4teto fetys s umu p u4trxrir3iy1oa rlieo;s  2tm(o oo4ll elivs sfaDum(ro;t1tee mi3iydfs2rm(vo;u) ltoxr oa1optelnvolt) 2uo(mpnudlmt  fvslt) rtrump;o4aex  fetatlmDua( sn(4aetrirciadlp rln s s0 2trxm3ou1lm emncilt  rururoou4tet  feild a uluvont4aexrmf io1lpDr nvi s)s2trxopny1aptn icsl( s2umx  ;o4ape miciys s ul( snu0tltrio3tytoate ues t)t2tm(o3iudale mivtlt)sDta(  nt1olx  oetytfsDulums () eeniociydfaDranvs;(0 etmxo3no1lmen ivi s artrx  ;u1alxnifcilt m2ea(ms (0 eenxf tadoaDeanvo;t teurir3iy1altnlnctatfa2um( ooo1optoii3ias a ranms;u)teeoxf todfpD aueols)t2xrimpny1alen fcsat)srtruroou0aptoii3tls sDrl(vs u4 rtomrcto1lp   iesl()s2toir3nudlmeemicilt  2tax pou1olxomfciydfaDuluvo (4 ltrio3tatomDrluvolt s2xrio no4al nmieia(  2ururpnt1ale io3iyslm2emu o t)artnmrciatlat lu s;()sruo(o3oudlpeelfvil( srtax  nt1optomoctyd s umnvs;()aleomfcootlm  ln o s s2urxr3oy1omeemnesls) rtmxr ot1tptnmoeils a2eauvp;t)trenxr oodfp  livi s) eto(m nu4om   nvsls) 2raxrp;o1oex  ictltlmDumuvp u)teenxrcoatomD lnes t0seuoir nudolee nei (fartr( oot4oexniocild m2rln s u)alermo todom raneol(0trtr(o io4lm nmivi ()s2um(r ;o1aetomietys m rl(vsnt0 renmfcoadla  lies s) rum(m3oo1ll   fet (  Dtrxm nt0olxoif3ildfaDulu o u4 rxoir oa1omDean sl()trxrirpoo4opt mivs t aDtm( ono0oexoiictas m2emnvs u0teeoxo3tydlmtr ueo;s0sexmiopnudoleemictltfs2tmu pno4tlt  ocilsla ua( pnt)trtnxfctatlpteli ilt0trtrio oy4ap n ncsl(faDtrx  ;o4oee ioetyd sDrl(mp () rtrio3oytfpD  ieo s0srtoxrpoodole miei s) 2rm(mp;u1tlxn oetlsfa2uan s u0 rxomrctatopt ln o t)sexoirpoudome mnvsl(farum(mpoo0oleoii3iatlm2ulnmsnt4teeomo3todfat ln o;s  exoir ny1optnmnvtlt  rtr(r ;u4texomi3iltfa rmu p;(0arxnxf ia1op  li o t  2urxm iodaptn icilt)arua(r ot4ale ifctasfs2ul(mp;(0 exnxr3iotomDrlu o ( srtoxrpoo4lpeelfes (f rrrxront4oetnii3iysla2ra(msnu4tetnifcio1lpDeaueols0 2toio ou4lle mfcsas) Draum nu4tlto ociytls2ua(vo (0 eerio oadfptr n i s  2xr(o3oodape livtl() 2tmumpno0aex iieiytfsDelums u0trenxfcto1lpDrlnvi t)trumir3iu4lptn ncsl( srurxrpot0opxn o3tltfsDrm(ms;u)tetnirciatfpteanvsls0 etoir ou1opeelivta()srraur nu0aexnmf3tytfs2elumo u4texnio3iodfmteluvi;(0trxmxm oy1al nmnvtasfa2tmu p;o1apt mfeiytla uanvsnt0 renxo oodfatr iei t s2xrir3ou4ame  ivt (  Dum(mp;u1alto feiydlsDrm(mp t4arxoir iotom r uei;t)s2to(rpnydlpteliei (fa2rrurp;t1aexoiocildfm umn sn(0aleoirciodlp  an s () 2trxmpiy4amenmfct tfs2trxroou0aee  i3iadlm2rm(vsnu4tlxnmfctotomDeanvi s texrio nu1omee fcilt  2uaxr ;u0ole  ieildfaDulnmo u4tlxrmr oatlmDr i s;()trtmim iudlm  mncs s artm(  oo0alenio3iltfs rauvp u)alxrirctatfp eanvil(0 2xr(o3iy1lptelivtltf rra(mpno4tlt ifctlsls2rm(msn()aexomfctodopDe ivols) 2xrxm3iu4amtnmfcia()a2tr(mont0openiociatfs uanvo;(4tlerxfcoadlat  uvi;(0teumio3iodoptnmivias sDtmum ot0tpxomicilsfmDuauvp ()alxnmf oa1op eauvi s) exo(o3ou1aleelneia(fsDra( p;o0aeto oeiys a rlnmp (4trxomrcta1fat auvo s)teumim io1lptnlfvsa()s2tmum nt1oleo octatfa uln p;t) leoxocoodfpt luei t)t2tmxmpoy4altn ictas)sDuau p;o1tpxn ociydfaDum( o;t)texnio oa1faD au o t0t2xoxrpoo4lmeemnesa(f Dtmurp;t4tleomieiydls2ea(vs (4tltomo ootfmt  ueo;( trtm(rpoydaltelnvsls aDrax ooo4tlx  fctld mDulnvs;t0 rxoir iotfp eaiesl(0s2toir3oudamt lnvt sfsDtaxm ;o0olxomfeiytfa rauvo t)aexnxr ty1oa e i i;()setrio3nu4lm emnei tf 2tmurpoo0tleoii3iyslsDul(vsnu)teenxo3tydlmtran s s) exoimpny4lltemici ()a2tmumoou1tlxoif3tldfa2rmnvsnu)treniocoatoaDrln s;(0teuoxm3oydapen fctlsfsrumx pnt1aexn ictytfs2ra( snu4alxrir3totomt  i s ( t2toiopou4amee feias)aDur( p;u4oexo o3iytfmDuln o;()trtnxr3iodfat aues;s0t2um(r3oy1amt  nesatfsrta( oot0oex  f3iydlm2rlnvs ()trtrxrcio1laDeli i;( trxo(mpoodoltemfetl(f Dtmuro;t4aetomictls s2eau p () rtrmf totfa eliei;() 2trxr iodam nmivias) rurxrpoo0tlt  i3iatla2eln pnt4areomfcoadfpD  ieolt)sexm(rpoodalee ncsl()sDtau  ;o4tle iieiydfm em( p;(0texnxo iytlm eanei;t) rxoxo no1lltelnvsas aDtaxm ;o0tleoif3tadlm raumo ()teeoxrctydfpDr i i ( seumir nydlm n fei ()sDuaur ;t4altn i3ildlm eau o ()arxnmf3tatlpte u ols s2xmiopny4lm emivs (faDra(rooo4tpe mi3iysfm2umu o;u)trtnxo to1om  lnvils)texoir io4op emncsas) 2ua(mpnu4aeeomoetytfsDem( s;u) reoxf oatlpt  nes;s0tetrxr3oodameemies s)s2uau ooo0tlx mictatls2rlnmp t)texrmrctotfmDeauvi s) 2umir3oo1opt  fvtat  2tm(mono4optnii3tldlaDrluvo ()aleomoctadfpD auvi ( s2xrxopoy1lltnmfes s sDtrxr no1tpto octls a2umnmpn(4aeeoxr oodla r uvo ( s2to(o3io1lm nmnetls)s2rru pnu1tetn feiadla2elnvo;t) rxrxr oodlm  ai s;(0s2trir nu4aptnmfcsltfs2trum ;t0aexomociysfa rlump;u) rermo iodfmtrlnei;(0trxo(rpoo1om n nctatf rtaxront1opx miciasfmDemnmonu) etrio ootfmtelnvi;t) exr(r3iu4al emfetls) rumxmo;u1oet miciysla rl( s u0tltrxo oa1lmte ivslt)texm(rpio4om e icsls) Drrxmpnt1oleniiciyt mDum(mo;t4trxoif3iadoat aueols)trxmio ou4amte fct tf 2tau  nu4oltn oeiaslsDuanms;u4trxrxrcoatlmtrlieo;t)setmxr3iydamenmictl(fsDta(rpou1oeeomfcild mDuanvsnu)aeenio iatfaDeau i t) euoim3io4lm  lfctatfsruax  no0optnmfciytfsDelums;u)altoxf iotlaDeai i;s  2uoiopoodaptnlfcslt  Dur( onu0apt  ocilslm2umumpn(4 lxoxfctotfm  au o t)t2uoxo iudlmenlivta(  rrm(r ou0opxnifcildlaDrlnms;t0trenxr iy1op elivo;t0 eum(opoudamtelfeta( a2urur ;t1aexo i3iyd sDea( on(4 lxoxo iydfp  aneslt) 2uoxr3iy4am   fei tf 2um(mpnu1oex  oeiydlm em(mont4tltoircio1fp e ueo;t s2trio3ny4ome lics t a2tru p;o0aptoifeils a emnmo;t0 ltnio iytlaDr uvi;s0t2to(m3oy1alen fvtas)a2rmxm ou1alenioetysfa ra(ms;t)altoif iodoa e neo s0setoimpiu4ole mfct s) 2ur(  ot1opxn icilslm umn s;u) rxomrcia1omDe n ol(0t2uoiopoodll nlivsatfarta(r ;u0oltnif3tat a2uanvo u)aeenmfciadfm e uvo;s0 euoxm3no4amt mnct tfs2tr(mpnu0tetn f3tltlmDrau pnt4arenmfciadfpt au s ()s2tmxrpio1ol e ncia(faDururpou1oexnmiciysfsDum(mp;u)alxnio3ty1op r nvo;(0trxoxo3iy1ap emicsls)artrx o;o0aeto oeilsfm eluvs;u)trxriociotlp rlnvol()t2uoxrpnydom   iesat  rtrurp;t0olxnioctadfa um(mp;u4 lxnio3tytlateluei s  rtmxr3iy1lp e fvs t a2tmu ooo0apxoif3tasfs emuvon(4 eeoir3oodlatrauvo;(0 2ur(m oodalen feslt)srrrur nt1ope io3iyt s2rmums u0artoxociytfpte ueslt)setmir nu4apte fvs sf rtru  oo4alxoiocilslm2eluvonu4trxoxo3oatla  luvols0t2tm(mpoo4optelnvtlt)srtaxrooo4tetoioetlsfm raump u4arxrxr tydlpt  nvo;t texrio3oodapeemncsl(farumu  ;o4apto ociad m2emnms;(4 rtriociy1oa eai ol(0trtoim io1opee nviasf 2taxmp;o1ope  f3iytlsDra(mo;(0artrir io1omDe uvs t)t2umimpnu1am  mncsa(f Drm(rono4aetn f3iasfa emnvsn()aeeoxfcoo1fm elues;(0trtrir3iodlpeelnesas)aDtaxrpou4oleomiciytla2rmums;(0alxrmr oo1la elueolt)s2urio3oudopen ivtl() Drm( ono0olt  fetlt m uluvp;() leoir3oadlmte ivi t teuoio3nu1lp  lfes t)a2tr( ont1apxomfeias s2emuvs (0 etnmf iy1laDrluesl(0t2toiopou1alen iei ()sDraxr ;t0alxomo3tytls2ra(vs t0 rxrifcta1omDranei;s0t2to(r ou4ape mfctl()sDra(r no1openmfeiyt a eanmp (0 ltomr3iatfpDrluei s t2xm(m iu1alenlivsa(f 2taxm oo0oetnmfetysfs2rmuvp u0texoxf ia1lat an i;(  eumxm3iudaltn fvt (  rurxrp;t4alx mictld a2ea(vonu)arxoir iy1latelnesls  ruoio3nu1lleemfciasfaDrmurp;t4tetomfetld s um(msn(4tetoir3tytfpt  ivi () 2xmxrpio1lmee ict tfsDrax pnu4alxomo3iat a ulums ()trenxfcoatlp  lieil(  2tr(rpiu1lle licslsfs2umu poo0oltomfeilsfa umuvp (0teenmr3tatlp  lnes s0 eurxm3no1ol n icia(f 2um(rpno0teenmoetlt a rl( o t0 etomo3ty1latrauei ( tetmxo3no4om  miei (farurxmonu0tpe if3ias m um( p;u)altoxf ia1fmD  i s;s0sexr(m oo4lmt mnviat aDtaxm nu1opx ii3iltfs ua(vp t0 reoir tadoatean i;s) 2urio3ou1apt mnvt s) rra(mpot0olx  i3tydfsDrmnvonu)aetomr oa1fatran sls0sexmim3oo1ameemfei (  Dtaxro;o0altnifciyslsDulnms;u4tltrxrcty1omDelu ol(0t2tm(rpno4op emfvilt artau  ;u0teenmo3iytfm2rlnmo;u0tleoifctytom eanvi;s sexoio3ou4lm e ivtas)srua(mo;o4texo feils sDua(vonu4texoxf ty1fat an ils  2tm(mpoudlpee fvtl()sruaumpot4aeeomfctytls eanvpn(4arxrio3oatlmDean i s t2toxm3iydom e fetl(f rtrx o;o4tpx mietls sDrl(von(0arerxo oatlatran i (0srto(m3no4omt  fes s)srurur ot4tpxoiicild mDumuvs;() lxoxr3iy1lmDran ol( s2xoxr3oo4omee nvtls aDrr(mooo4tptnioctytfm umn s u4aexnmfciadoa eaneo;( trxriopny1al  livil( aruaxront4aetoiietaslm ra(vp;u)altnmo3oydlmt  ueils) 2xmio io1om n iciasf Dtm(rpnu1aexn oetasfa2rl(vpnt) etnmrciotfateaies t seum(m3iy1lmeemiei s)a2rmur oo1aleomoetad a2ua( p u4arerir3ootoate nvilt)setm(mpiudop n ivia(f 2tr(mooo4oee mfeiyd m2rlu pn()texomfcoa1lmD lu i t)seur(m3iodlltemfcils arurx  ;u0olx  fciysfs umn s;u4 ltnmociy1fp  lieslt0sexmxmpiy1altnlfctls)a2tr(rpoo1tpx ifciadlaDemn o t0tlxoxrcia1lp  an il() 2xoio iudope lict () 2um(r ;o0texomo3iadfs2emnvp t4trenxf3totfa  anes (0seur(r iu1lm  lfct t aDuaxm nu4oltnmiciydlm eluvpnu)alxnioctotlp ean il( s2urio oo4lme lnvtasfaDtmx poo1tpeo iciytfmDrmn p u)tetrifcta1om   nei (0sexo(mpiy4ole miesat arta( pou1alen fctys m2rauvsnt4 exrmrcoadoate nesl(0 ruoxo3iy1olen neilt)arum(  oo0openmieild s ulu s (4 rtnir tatlaDe neo (  2xmxopoodam   icsl( srta( oou1tlt  fcilsfsDemn o t)tlxrmo3iodop   ivs;t srxmxopoodoptelivils arumurpnt4aleo o3tysfsDem(vsnu0 eeoxocoodla  ln s (  etrxo iu1lpe  fcias) Drrxm ot0ape  fciytlm2umu snu0 eermfcoytfpt aueo;s)seuoxrpiu1apt  iet t)s2rrxrooo0tptnmicild aDuanmp t)tetoxoctadfpDrauesls) 2um(m3oydll   iesl()a2tr( pno4oeeo i3iltla ra(msnt) etomf3tytomD lues;s seur(m oydaptn fci s srrrxm ou1tltomietlsfmDrm( p;t) exrxrcta1omtraieols s2tmxo ny1ap e nvsl( aDururont4opeoioeiydlsDem(vs u0tlerif iadlmDrlnes () rur(o3no1openlieilt) ruaur ;u1tlxo fctad sDeln o;(4aexnxf ty1lmDe neils  etmxo nu4lpee nei t)aDrax  nt4aexnmoeiyd a2ra(vp () exnmrciatopD li i t trtr(r3nu1ll  mivi t aDur(moou1tleo i3iysfs rau o (0aeenxfcoa1fpDeauvsl() exoirpny4apte ivtlt)aDrmuro;o4olt  fcildfm2umumonu0 etomo ia1latrauvs t0 rxo(r3iu4ap   fesltfs2rmum nt1oet  octydfmDra(vo;(4altoir totlmteluei;t0 2umim no1ole licias) rtrxmpot4aptomictldfm um( pn(4aeerir3tytomtr ueo ( seuoxo3io4ape lfcs s) Dtr(m ;t1oeto ociyt m ua( p;u0aeeoxr3oodlmD ai sl()trurxo3iu1ap   feslt arur(r ;o4olxoio3iad aDulnmo ()trtoio oodfate ivs;(0texmxrpiy4olt lfvias)s2umxro;u1opxn feilsfa rmuvs;()trenxf3iydfmte ivilt srtmio nu1omt lneslt)srrm(mo;t1oltoiieiadls em(msnu4trxrmr tydlmDelies;( s2tmirpny1optn neil()s2tmurpnt1aleo iciyd a2elumo;u)treoif io1oa e ivi;s0srur(o3iu1om emneilt srur(r ou1tlt iieilsfm eluvp u)trenxo iadlp   ieil()trum(r oy1altnlfvi t  rtr(r nu4aeeoifetyt aDrmnmo t4tltrif3ty1faDelu i;t) rurio3oo1llen fvi s) 2ra( ooo4aleoifeiasfs emnmp;(4trtoio io1lateli s;t t2tmxo3ou4apt  ieiltfaDtauro;o0aet  o3iytfa2eanmpn(0altrmo ty1faDraiei;(0srtoxmpoydamtnlfei tf rtaxrpoo1tee micilsfa2ulnvpnt0aeenxrctotlaDe neo t0srxoxm3iydamtnmnesl( sDrr(r nt0tltn f3iys s2rm(ms (0areoif todfp  aneo (  rxr(o3ou1ll elict (faDum( pnt0tpenmf3ild a ulump u4tltnircoy1lmtran slt trumio3no4llt  ivia(faDraur ou1olx  fetas m emuvpnt4trermrctytopDe ivi;()s2uo(rpoo1op elieia()a2rrxro;o0texomo3tyslm2el(vp;t0 leoxrcty1opDrln i;t0t2trxr3nu4llt lnvtls s2ua(m ot4tlxoifetyslaDrmn s u) eermf iydomtean s (0seuoxr3ou1lme mnci ( s2rm(m nt1oltoifciyslsDel(vp;t4 rtrmrcio1lp eauvo;() etoirpoudalt lietls arra(mp;t4optoifctytfm rlu o;u0artomf oytlaDe ivo;t0sexm(r3oudlm   ncsat)a2uaxm ou0aeeo i3tad aDelnvo;u4 rtoioctotlatr nvo t  2xo(o3oo4opte ncia( arurum no1opeoioctlsfa eauvs;u0trerxo oydomteaivs;s)s2trir oudol  mfetl(fa2rmxrpou1tptnmfeiasfa2emuvsnt0 eenmo3oytlpD  uvolt)tetrxr3iydom nmiviat s2uaxrp;t4aee mocias a2em(vo;(4artnxo3iodlp eanvo;(0srxoxr3oo4optnmnvs ( a2rr(m ;t0oeenif3ild m2rlu s u0alenmf3to1oa   ues t)tetrxmpny1lptelfet tf 2uaxm ;t0opx  ictadlm2emnms;(4 etrir iadopte i o;()s2tm(mpiydamtn netas)arumumoou4olx if3ilsls2eanms;t) exomo3oy1lp eaues (0teur(m nudom emieslt) Durx oot1tpx  iciytlm elumpnu4arxnxocto1lat lueol(0setoio3iodolt mfes t srra( p;u1alxoiiciydfmDuaums;() rxomocoa1om elues ( setmimpno4olt mictl(f rrmurpnu4oexoiiciyslaDul(vsnu)trtoxo3tydoaDeln o;t0 rumxm iu1omtnlncsltf ruaumonu1tptnmf3ilt m2ra(vs t)arerio3iydopD li slt0srxrxm oodop  lneilt)srur(mpou4oetn fetyd m uanvsnt)alxnmociydfpDeli s s t2to(m3oo4am   fcsa(fs2raxmont4alt ifetltfa2eau on() eenir tydlmDelu o;( s2uoim oo1am   fci tfartaumpou1oltn ieildfa2ranmp (0tetrmo oadlp elneslt0 ruo(rpnudlm nlivsat  2umu pnu0apx  ieiysls uan o t)alermoctatfpt li olt srxo(rpnu1am  mici s s2rr(ront1apt ifeils m2el(vp t)artnxr oo1oaD anes;t0truoimpno1apte fct t s2tau p;o1oleomi3ildlsDrluvs ()tlermr3oydomte i s t0t2tr(o3oo1om   ies sf 2rmur ;t0aleo ociydfm el(mpnu0trxnir oatfpDeluvo ( s2um(opou1om n nctasfa2ur(rpnt1tleoio3iyslm2ua( s;(4aetrxrcoatfmD lieolt0s2toir3oy1om nmieils a2ra(r ;u4aexomfctlslaDra( ont) rxnmocio1fa eaueslt0 etmxm no1amen nvta(f 2tmxm ;t0opt iieiydlaDuaumpn(4aleoircio1lpD lueols)texrxr no4om elicia()srrr(  ;o0aeenmfciyslsDrlnvonu4aeenxrciadlp rluvs t) exo(m3nu4ope lnes t  rrmxm ;u1tlx mo3tyt s2uanvpnu0artrif3iodlpDe ivs;t) 2xrirpoydol n fes tfsrtru oot4oleniiciadfa eau o;t0 rxrio oatfpD lu o;t0truo(mpiu4optelivta( artaur ;t1olt  ietlsfa ea(vo ()tlxnifcoydlptelivs ()t2trim iu1lp elics (  rtmxrono0aexniociadfsDum(vsnu)aetomo3io1lpDeaneo;s0srurxrpiu1omt liei tfa2um(rpno0aeeoii3iatlm2rmn s u4alerxrctydlat aieo (0teumir3iudlp emncs (f 2rmumpou1opt iieiys a2ran onu)tlerio3oytomt au il(0 exrir oo1lm elfvsas artaum no0opt  f3tys sDumu s ()arxriociatfa rlies s0texm(m oudap nlnet (fs2rrxmpot1tlx ifetldfs2uanvp (0 rxrxo3oo1lmDe u sl(  2xm(mpiydopen net (  2rmx  nu1opt  fciltlaDrln pnu0 etoxfcoa1lmDran olt s2urxrpnu1omt lncta()a2trxr ot1oex ii3tlt m2um( p u0 lerxf iotlpDraneo;() 2uoxo nodlpe  fctatfs2ta(m ;u0texnmfcils a2rm( on(0 rxrxf3todomtrau ols0 exo(mpiy1lm  mneilt  2rr( pot4alto i3tasls2eaums u0aexomocoodoptranei;( srur(r3nodlp  lfctasfaDum(  oo4ole if3ilslm emn sn(0trtoif oadoptr neo;s)s2xmxr3ou1ap nlieslt sDrmum no0alxn ociytla el( o;u4tltnxf3ty1laDelnesl( texoxr3nu4oleemfctas)a2tmuroou4aleoifctasls2eln o;(0tetnif3iy1fmtr nvs;(0 2xoxm iy1ol   ivil( aDurum ot1tlxn i3tyt mDemn pn()aeenifciotop eluei;t)s2ur(r3nudal nlnvtlt)sDra( oot1aee  ieiadfsDulump;(4 exrmocio1omtr n s t0s2umim3io4omtelivt ()a2uaur ;u4opxo i3taslm2eanmp;u4tlenmr3oy1lpt au i t0sruoxm io4ape mivslt sDtmumo;t4ape  fctadlm ra(mp t0arxrifcoatla rlnvo;() rxmxr3iodap e neta()aDrmur no0tex iociad m2eauvs t) etrxrcoodfpDelu s s0 2xrir no1opee nctltfsrrrxmpoo4apxoio3iyt m ea( p t)tetoif3iydomDr nei s0t2xo(rpnu1apenlneiat)sDtaxm ;u0apx  iciatfsDumnms u)tltoxf3oytlat lieo (  2umxm3oy4amtn iviatfsrua(  ;o0oleo oeiytfmDeauvon() etoio3oo1fpDeauvo;t s2toxopoy1amtnmivi sfarrmumpot1alxo ociyd a em( s;t4tltnxfciytoaDr u i;t0 rxoio3iu1lmenmnct sfaruax  ou0aleoifeild m ra(vsn()trermo3to1lmD  nvo;s)t2xrio3nudlpeemivt tfs2rax  ;u0apt moetlsfaDeln s u4 lxrmf3tytoptrlneilt trtoxr3oo1om n iesat)s2rmu o;t0tetomieiysfm uluvp;(4arerxo iy1fa r ieo t t2xo(o iy4ope  fesl(  2tax ooo4opxomictysfm uauvp t)tlxnmf tatfm eau il() rtmxo iodaptnmieta(faDum(rp;u1aexnif3tad mDea(msnt4arxoiociadlateaies;t0 2urir io1am  mfei (  2uau oot0tlxo ieiyd aDumnmo;t) ltnxo3ootlaD  ueolt0srtmirpiudlm nmivtlt) 2rmumpnu0olxo f3ils mDrlnmo;t4alxoxr oadlpte ieo t0 rto(o iy4ll e ncilt  rtaxm ;t1olx ioeiad m ea(mo;()arxoxf3totlm rlnes (0trxo(m iu4lle  fet t)srtaum ot4tlxniieiadfm2umuvo;(4texnxr3tydoatr ieo;s)s2uoim iy4amt lnvslt  rra(mpnt1aeeoifeiat sDemnmo t4 rtrir io1lpt  ieilt)srxoiopnudlmt miet tf rtr(mp;t1ale mocild m rmuvs;u0tetoiocoytopD auvs t)trtmxrpnudameelfvt t) rumxrpnt0aleoio3ils a rl(mo u)tetoio3iydopD  u o ( t2toxr iodll e fcsatfs2rax onu4tetnif3iysla2uan snt)texnio3tatfp  an s;()seurir3ny4amtelneta() 2umu p;t4oetomo3tadla2ra(ms () exrxr iodlaDrau o;( sexr(o3iudlm emfvsa(fa2raum no4aetomicias aDrm(msnt0trxrmf oo1lateau s (0teuoimpoodame lies sfsDta(m ;t0oleoif3iadfs rm( s (4 rxrxr oydlpDraieo;t0 euoirpiudlp e fci t aDra(rpnt4tpeomfctltfs rlu s u0aetnmr3oadlmDr nes;s0s2tmxrpnu4apt  nctasf rtmx pnt0altnii3tasla2uan p (4 rxrxf ta1fpteaiesls) etr(r ou4optn ivtls arua(mp;t0tlto f3ils a2rlumont4 lxnircoadfaD  nes;t)seto(o oudlleelnvta( a2tmx  ot1alxniicias aDranvo;(0trerxo iytlaDrlu o;( srtrxo iodapeemnvsat  2ta(ront0teenmf3iyt a2em( snt0tltnxo3tytomDe neslt0trurim ny4ol nmncilsf rtaum nu0olen i3tls sDrl( s u4tetoifcoatomDrau i s) 2umxm ou1amtnlfvs t  rurxmp;t1tpx moctytlsDraump (0trtnifcia1omt aues s0 2urio oo1omtnmnes sf rtmx o;t4ope  o3tytla2eln o (0aexnio oy1fate u i;s  rxoio3oodlpe liciatf 2trxrpoo4tlxnmf3iatlm2eaump;u) exnmo oo1oaDrlnes s s2uo(rpiudop n icslsfsrtaumpou4texnmo3iatfs uluvs;t)tetomociydfp  lu s s t2umio iy1lm  lfei s)s2rmxm oo1tpxnii3tyt s ul( onu0 exoioctatoaDranvslt) rumxo ny1optnlfet (fsrumuro;t4oetn oeiltls eauvs;t0alenmf3oytomtelnvi ()sexo(mpiu4lm emicia()aruaxmonu1oee  o3tltfs2emnvo t)alxrmo iy1omDr ivo;t  rurir iodlpeelicil( a2urxmo;u0aexn i3ias s rau s (0 exnxo3io1fa eln o;s0teurxo nu1apte nvta()srumumoou0oltnmoetldfa2em(vs;(4 eenxrciydfp r nvols0s2uo(r3no4lmt  iei s  Dumx  ou0oltoifciyslm2eaumon()trermf ootop raiei;s0 2xrxopoydalenmivs s a2tax pno1altnmo3iysfs em( p;u4tetoio ia1la rluvs ( seurir ou4apte fvsat)sDua(mono0altn fetas s elums;u4artnxrciydfmtr i i ()s2toir3iodape  neils)a2tr(rpoo4texniicias aDeanmp (0tltnxocoydfatrlnes;(0 exoimpiydlltnlieiat) rrax poo0opto feild m elnvo ()tetrmr todomDeau ils0 2umxo iu4olee fcsls)a2trumpoo0oexniieiys s rln s;t0arenmo3oadlaDelues;(0 2toiopoudlltn fvsl() Dum(ro;t4olt ii3ils a2ulnmo t4altoifcoydlate ivo (0 euoim3no4ap nmnetl(  rua(mono0opt  ietys a2elu p;(0alxomr to1om eaieols)teto(rpoo1lle  fesatfarur(mont0opxoiieiasfa2rl(vp u0tltrxo3iodopDe nvo t t2xo(r iy4oltelfvtlsf Dtm( poo0oltoii3iyt m emnmon() rtnmo3iotomDrlivo;(0t2uoim iu1op e nvi (fa2ur(mont1aeto oetat m raums t4 rerif ia1om r u o;( teuoxr3ny1aptn netl()aDtmx oot1ope mieiadfaDum( o t4 reomo ia1fm r ivol() euo(mpiy1oltn nctas) ruaur nu0aeeoii3ilt a elnmp ()arenxr iodfmtr uvs s t2tmio3oo1am e nvsa()artrur ;o0olx mieild s2rlu o;(0aetrmrcoa1la   iei;t0t2xmim oy4alee nvs t srrax p;u1opxn ictld s ea(von(4arerxf3iotfmt  i s ()sexmxmpiodlleemietlt)a2rm(r ;t4aexnio3iadfm ea(vo (4trtrxf3iatfm   n slt0teumxrpiu4lmte fvsl() Drr(mont4tee  f3tyd aDul(von(0tltoio3todfmDeaneol(0t2xm(rpny4llenlnctltfarum(m no4tetniietls mDuanvs;t) renirciydlat lnei;s0setrxr3nu1op elnvsa(f Dtm( pou0apto ocilsfsDeau p ()trtrio3iotomDeanvs ()seurim3nu1am   ncil( arrr( pnt4tpxoiietyslsDrmumpnt4arenxo3tydfatraivs;( setmim3iydoptelfeiat)srrmu  oo1ale io3tydlmDrl( o;t0trxoxf tadla e ivi s s2xmxo no1op n fvils)arrr( pou0oetomo3iyslmDumnms;(0 etrif3iydfp ranvsl( srxoim oy4op e fciat  2rrxm ;u1texn i3iydls2umu pnt)tltoxfciytlmD lu s;t0texrir3ny4amenmiet s s2trxm ou4opxniieilsfs2rmn o;()aetoif tydomDeai o;t setmxm oy4oltn ics t s2taxmpno4oetoifetlsla2uluvp u0alxrxr iy1fp  aies;( sexoiopno4altelnetat)aDtauroou4aetniieiatla rmnvsnu4 rtnxo3tatlm  ai sls0sexoxo3iy4ole licia(fsrtru pot1tpt  ieiys sDem(vsn(0alxrircootfp eli s;()setr(o3nydlle  ivsa( s2tr(rp;t4alen i3iysfm2uauvpnt4tetrir iy1lpt luvslt) rtm(o3oudopt  fvtlt a2tmum ot4opto f3iyt sDeaump t)artnxo oydoaDrauvi;t) 2tmxrpny1aleemfes s) 2um(ro;u1olxnmocilt aDrm(von()trxrxf iatlmteluei;t t2tmxopny1ol emivt t) 2trur ;u1tpeniictlsla em( p;u)trerir3oatfp rli ols0srtm(m oo4al  lfes t) 2ua(  nu4olx moctld a emu pn(4 rxoio3ootom  ln ol()seto(m3oodol emfcil(  rumx  ;o4oltnii3ilt s eaumo (4tetnif3oatomteaueslt  exrxr3oudapt lneia(farrrx  nu4aetn oeiadlm2ua( p () eenmocoydfateaiei;(  rxoxm3iy4olenmict s  2rr(  no4apenmfctasfs2ulnvp;(0 eeoir3oo1fmte u s t) 2xrxo3iydol   fct t)arumx p;o1apt ioeildfs eln p;u0aexoiocia1lpt auesls)trxrio3ou4ol e fvtas)aDum(mp;t1tlx mfeiltla2rln o;t4tetriocoa1fpt aneo;(0 2uo(o3iu4ope mietas  rtaxmp;o1oleniictyd m2rm( o t0 exnmf iydfateai olt  rxoxo3ny4alt  iciasfsDtm(  ;t4tptn oetysfa2raumo;t0aeeomr oadlpD ln i;(0 2trir3iudal e iet sf Drrx pou0tlt  icils a2ea(mo;u0aexrircta1fm  aiei t0teumir3oodamtemfvsl(fs2raxront4tpxn ociytfa ean on(4 rxomfcoo1fp   n ols t2xrim nudalt livt () Durumo;o0aptnmieilt m2ul( p;t4trtnxf3oo1opt  i i s trxrim oydomeemici ( a2tmx pnt1ope io3tat s2rm(vp u4artnxf3iatlptraueols  rxoir3ou4aptemnesls)a2tmxr ot4apxniiciad m2uau p;t0trenxf3oy1lmDr neil( teuo(o nu1llte nes s  rtr(mooo0aex ifetldla2um(vo;(0arxnmrcoa1latraneo;s0sexoim ou1lptnlict t sDurxmooo4teeomieilsla ran on()trxnif3totop ean i s texmio3nydame  ivtas)a2rmurp;o1tee  feiydls2ea(vpn()arxrmr todop elueils s2xrxr nu1lle  neslt  Dtrumpot0oltomociadlaDem(ms (4 rtrmo3totoaDeauvs () rxoio oy1amee ies tfaDtrxmp;t0olen iciys a eanvp;t)aexnir ta1faDrlu s;()t2tr(r oydomt  neilt sDtm(  ou1tee ii3iytfa umn snu4 rxoio3iy1oateau s;t  rtoxm oodlme licsltfaDtmu  no4oex moeiltlm2elums (4trxnio3ta1oaDrlnvs (0 2xr(r no1op nmfvsa(  rraurpnu0aexnif3tlt s2ulnmsnu0aexoxo oadfm rau o;(0s2uoxm3nydopenmncta()s2um(r ou1oleomf3tld s2ra(mo u)alxrxf tydfp eau o;t0trtrim3ny1lmenlnctltfartmur ;o4tltnii3tas aDrlnvo t0 etoifctydlm  lnesl()teuo(opnydap nlfetl(f Drr( pnu4optnmf3ild s2ulnvp;t4teermf ty1faDr nvs s
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;t0teurio iudopt  fei (  rtr(  ;t1tetnio3iyt s2uau s u) rtnxo ia1lpDr nvslt)truoxo no4omeelfvil(faDuax poo4oexomocilt sDea(ms u0texrir iatoa r ivo;t0texmio iu1alee nctlt)srum(r no0opxo i3tysfaDelnvs u0aeeomf3totopDrauvi ( sexoio iu4apt livil(  Drmxm nu4aetnmi3iadfa2ua( p;(0tlenxf3tatomtran s;s  etrirpoo4apeemfeia(  rrru  nu4alenmo3iytfsDrlnmpn()tlxomr iatlp rlnvols0s2to(m iu1om e nvsls) rtaxrpot4tpe mociydfa2ulumsnt) rxnmr oydopt  neil( t2xo(r3ou1apenlnet ( aDur(m no1tex mieiasfsDemnms;(4tlerxrcto1fmtraivslt)trtmio3oo4opeemnesasfaDta( ooo1ope mieiatlm rau o u0aetoxocty1lp rln o (0t2tmxr3no1lmen fvslt arur(r oo0tpx  ieiadfa eln p;(0aexnmr3oo1omDelnei;t) 2um(r iy1apenmfeta( aDua(r nt0aetniieilsfmDrau s t4texnmr3iydfatelueo;t0teurirpoudam nlfetl()srrmurpnt4oltnifeiasls2eluvs;(0trtrir oytlaDeln ils)texmxr io1opt mfvtat)sDtaxr ou1tltn f3ilsfsDemu s;u4 rtrif ta1faDr uvs s trxmio oy1alenlnei t) 2rru p;u4olxo o3ildfsDuau snu0tltrxo oy1la eau s;( sexrim3oudoleelfciltfa2tmxmp;u1optoiociydls eaumo;(0 rermocoy1oaDe nvo t  exoxo3iy4am emfcs t arrmx o;u1oetniiciltlm2eauvp u0treomrciodomt luei;s)s2triopiudlltelfvi t)a2raur no4teen fetld m uln snt0arenxr3oadfpD ln sls0srumirpnydome  ncta(fsDra(roou4aexn oetydfa2rl(vp;(0tltnmfctotop   ueo (0s2um(opoy4opee fvt sfaDuaxm no4alxomfctad a2rln s t0 renmf oatlpt li i;t t2ur(opno4am n iesa(fs2trxmpnt0altn o3iasla2ra(mpnu)alxoir to1oa   nvs;(0sexmxr nu4op   nesltfa2uaur ;t4aleo oetadls2umnms;u4tleoircoo1fpDrln i t t2uoio iu4lpeelfei ()s2trurp;o1alt iictydfaDrln pnt4alxrmo iodop rluei t0srtm(o ny1am e nes (farua(mpnu4apt ioctadlm2ra( s;t)aexnirctatoaD  n olt seto(o iy4altnmiciatfa2tru ont1oexn oetadlaDeauvont0arxnmr3io1optr ues;t srto(m3oo1lpe  ieia()aDurxr ;o4ale mieiasfs2emuvpnt)tltnif3ty1lm rlueo ( trxoxrpoydamtnlnvt sfs2ur(r ot1oleo feilt s rl(vonu0aetrif tadoat an s (0srumxo iudlmen ivt sf 2rr(m nu0opxomfctysfs el(vp t)trtnxo tadfm r uei;() rxoxr3oydlpe mncsa( sDtru  ;o4tltoifctydfs2emumont4 etnmrctatlmD lues (  rtrim3iydap emfcta( sDraxrpnu1aeenmf3tltfmDemu o () lenmf tytfp elnvo;t)trxmirpio1oleelicsa(fa2umuroot4opxo ietatfaDeau sn(4 rtnir iotoptr nvi;t  2xmir3nu1lmt mietatf 2tmumpnu1aee  fctlt m2raums;t0 leoxocoo1lat anvs () rumir iudopenlivtl()aDuax  no0oeeoifetatfa2uanmo t0arxomr3iodlmDelnesls  2xmiopnodlp  mfei s  rtmurpoo4aexniociydls2ua( o t)trtnmo3oatla   uvsls0srurim iydape micilt)sDrrum ot4ale mo3tltfa em(mp u)aetrxo oo1om elneo s) exmirpiydaptelneslsfaDrr(r ou0apx mieiadls2rlnms;u) rerxr3ta1fa  livs;( setrio3oo1omeelivt t)aDtr(mpou1teeniociadla2umuvp;u4teeoio to1fpDeauvi;( teum(r3oodope lnet tfsDuaxrpnu4tpe ifeiytfa2rmnvo;u0trxnmf iotoaD aueil(  2toimpiudlmen neilt aDtaxr nt0apeo i3iyslsDemumonu4 lxomo3io1fpDelivi;s0s2xriopnodamt lictl()sDta(mpou1apeo ieildfm2ulnmp;t4 etnmr ootomte i s;t)teum(r3oy1ol n ietas  2uaump;t1opeo i3iytfaDemnvont4 ltniocty1omDrlivi () rtm(m ou4oltnmict ()sDtmx pno4tleomfctadfsDrlump u) lxoxf3io1op elneo;t) rurxr3oy4omte fcslt  rrrxmpot0tptniietatfs2umump;t)tlxoxocto1fm elu o;( tetmiopoy4oltemieta(f 2urxmont1tlx ifctlt aDrl(vont4trtoxo tadfateluei;( trurxr nu4ome  fcsatf Duau o;u0alx  ietysls uan o t0trxnmr3tadfpDe ueo (0trxo(r3oo4amtnmiet s)srtax onu0tptnmictatls2rm(vonu4 lxrxfctotoa r uvil( trxo(opio1lpe mnesatf rurur ;t0olxnmictat m eln o u0aeenif iodomt  uvi;t0 rxmirpiudoltnlnct ( srtmxr ;t0apen oeiat sDrau pnt4tetoxo3iydom eaivilt0 rumim io1al emnvsa(fs2ra(ronu4apx  o3iydlmDrlu o;u0 lxnxoctadla r nes t t2xoxo io1llenmicsa(f 2tmxmpou4opto octlsfs2eanvp;t)tltoif3tadlmD  ues t) rtoxrpoy4al elneiasfartaum nt4tpeoii3iyt a elnmp u4 ltrxr3oytoatraieo;s)trtrio no1llte fvtlt)srtru  oo1oltn oetysls2emnvpnu)tltnio oadlat  ivi (0 euoxopoy4al emivs s)sDtmxro;t1tpenmi3ils m eauvo;t0alenmf3tadlpt aneo (0 exo(m oodlpeemivtlt)sDra(m ;o0opeo o3tatfs2uanvp () renircoodfpD luvi;t  2urxmpoo1ll n fvsat s2raxm nt0tet  i3tldla ul(vpnt4 rtnif3oa1la raiesls)truo(o3nu4lp emnctl( aDrrump;t1apxo fctls mDem( p;()aleoifcoa1oaD  ivi;t  2tr(rpoydoltnmneiltfsDtrxroou0aee  ieiasfs2raumon(0texnir3oadlm r uvi;()tetmxr3nu1opeemivtlt  2taur no4tlt moetysfaDel(vont4 ltnif3iodop ranvi (0trxo(m3iu4ll  lfcils sDraxroot1opx mfeiltlm ean p (4tlxrxoctytlm eanvs;t)srxoir iy1omen ncsls  rumum ou0apxnii3iadfa rluvsnt4trxrmf3ootlm r nvi;s  2to(m3oy4ol  lnei ( srtru pot4olt ifetasla eluvs;(4aexnio tytoate i o (0 exm(o io1lm   ici t  2urx  nu1oeeomo3iltlm2rau on()tetrmf iodfa e i ilt  ruo(mpiy1om emnvsas aDurxrpnt0aee mfeils m2elnmpnu4 eerxo iytfa  anei () rtrxmpnu1aptnmnet t)s2ta(r ou0alxo oetysla2elnvp u4artrio3tytfm rauvs;()s2urim iydomtelfei tfarua(m nt1aexnmietasfs ran p;t)trxoxr iytop e neo;t)seumxmpny1aptn ieta(faDum(  ;o1olenmfctatfaDeaums;u4 rerxf to1lpt aies s texriopoo4ol e nvilt a2uaxmpou0tpxomoctasfsDuaump;t)arxoio3tydla  lueo t0setmxo3iy1lleelietlt  Duaurpoo4oexomo3iysfa ua(mo;t4arxomfctotfaD ln s s)seurim3nydlpt  icsl(  rurx  nu4oeeoiieilt sDum(von(0arxnxf oadfp  li s;s0t2tr(r3nodolt mfcilt aDumu onu1apxnioetlt m2ul(mo u0tltrmrciy1lm   ues;t s2uoirpny4omtn nvi (farurxr nu1tlxomi3iatla elnvonu4arerif3tadfm rlu ols0t2xoim3ny1lp n fetas) 2rmx oot4openioeiltfa2ua(ms u) leomr iadfp rliei;t  rxr(m3nodaltn fciasfsrur(monu4oetn f3iydfmDuauvs;t0tlermociytlat livs;t0texr(mpiy4aleemncil()s2ra(m nt1alx ifeildfaDemums;u0 lenxrctadlmtr nvs (0s2umir no4alenmfes t)arumxr ot1tpxnmf3ildfs2rm(vs u) ltomr oa1lmt lieo;s srtmxm3ou1opt lfei ()srrmu  ;t1altomociysfm2rluvp u4artnmf oa1op raueo t) rtm(mpno4lmeelfeia()a2rmurono1optn ociatlsDrm(mp t4trtoir3oadlpt liei;t  rtoio3iudom  mnei sf rumx o;o0optnmoeiat a rlu p;t) exoxo3iatfpte u s s)srurim3nodolt  fcsas) Dtmx p;t1aptnmf3iltfm eanvo;u)alenmo3io1opDe ues s0t2xoir oy1ape  ies s  rururo;o1ope mfetasfmDem(mp u4 rermo3oydlmte u slt)srumim3ou1opeemicsatfa2urxmpot1apx  f3iysfm2rmuvs;t) rtoxfcoo1faD lnes;t  2xrim oydam  mnesa( aDtmxrpnt0altomoctatla rl(mont) ltrxf3iydfpDrlnvo s0 ruoxmpou4ll  lfes (  Drmumooo4oex mfciytfm rlnvs;t4aeerxo iydlmtrau s t0truoio3oudamtn ivsas arta(mpot0oleomfciatfaDeln pnt0trerxf3iadlm elieo;t) eum(o3ny4optnlivs (faDra(r ot0tlt  i3tad a2ean sn(0arermo3tydlaDeluvs;s0 2trxopnu4ome liviat aDtauroou0ape mfciaslmDum(msnu4trerioctatlpD aieo;(  2umim3iy1amt lfei sfsrtm(rpoo0tetoioeiltfsDrlnmo t0 eeoxo3iytlptrauei;( t2umxm nu4lmenlfctas)sDtrx  ou1apt  oeilslaDumuvo t)tlxnir oy1fpD anesls  etoxr3io1opee ieia(  ruru o;o0optoio3iysfa uauvo;(4tlxomr3oodfmDrauvils sexmim3iydomte nvias) 2rau onu0oeen f3ild mDelu s ()tetoif ta1oa rau ol()sruoimpny4omte fetl()a2tr(m ;o4olxnmi3iatfs2rmn sn(4areoio3iotlmtr i o s texoxo3iodop n ivtat sDtrx  ;u4oltn oetls a2ua( snu)tlxnmr3tydfa rauvi;t)trumxo3nodlm elictl() 2rrurp;t0aet  fctlslsDemn o (0tetrxrciytlmDe i s t  2umxmpno4olte fvta()sDuru pnt1tpxomoctytfa ulnms;(0 lxniocoytfmDr nvo () 2toxm iu1opte ivtls)srra( poo0apxo o3tytfsDuauvo;u0teeomr3oatopte uei;(0srxmir nu4lpeelncilt) 2ta(  ;o4apxoio3iysfm2elnvp t4 rxnir3oa1laDeln s (0 rxmio no4altnmfesatfsDraurpnu1opt  octldfaDelnvp;t4 rtrxr3iydlmDe iesls0s2tm(m oo4ale mivtlsfsDtruro;u0olxo octyd s2rluvs t)aetrmrciytlatranvo (0truoimpny1ale mfet ( srra(rpnt0opxnmi3ilsfs eanms u4 eenif totfmDean sls  rtoir3oydlpt lnctas a2rrx oot4tlenmieiytfsDeanmont)altnmf iy1lpDrlu s s0 2uoxmpiodlpeelnetat a2umu  ;o4aeen o3iatla2uluvs;t) ltrmo3totoateai s;s)trxmim3ny4lmenmieia( aDrmxrp;t4alxniietlslmDemump;t0alxnxf io1lmD  ieo t)t2um(r3iu4ol nmneslsfaDraum nt0tpe mociys m elumo;t4aleomrcty1laD  u s;s)seur(r3nu1ll   ivils s2uau  ot1olx mo3iatlm2um(von()arxomfcootfp eln ilt)t2xo(r iy4amenmncsat aDraumpnu4tleniietat sDeanvon(0 ltoircta1lpD livi;t0s2to(m oy4op e fci t  Dtm(monu1oeenmietls m rm(vo t)texrirciatlat  ues (0 2tmiopio1lle mfci t s2ra(rpot1tleo fciadlmDua(vs u0 rerxr3oytomtraueilt s2xmxm3no4om nlncia() Duax o;t1alen ietltla um(vpn(0aleomf iy1lateauesl( s2xo(opny1lpeelnvt s aDrru oot4aexniieild sDelumo;(4 lxomfciodfpteaues;s)srtriopou4lpe mfvt tf rua(mp;o0teeomfciytla uluvs;u0trxnxf3oatoateauvo;s seurxopiy4am  mfci (f Draxro;t0opto fctldfaDuanms t4 ltrxf3iodoptrauvs;t)s2tm(r iy1ome miet t)sDurxm nt4apto f3ild s rm(vs t)alermo iydfp rli ilt0 rum(m3oy4ll  mnvtltfsrurx ono0optnmo3iys m2rlnmpnu4 ltnmrctodoaD aiesl( s2tmxmpno4opt lietlsfaDraur ot1opxoiociadfmDrlu p;t4 etrxf iytfmD an i t) rtmxr oodoltemnvtat) Dur(mooo1ale io3iaslm ranmsn()trtrmrctadla ranvols0texoxm no1lp  mivi ()aDurx oou0tleo octadlm raumon(4tltnxo3iydfaD luvi;s) rtoim3oo4llenmneiasfa2raumpoo1tpx  feiyslaDrmnvp u4aetnmr3oo1opDr i i t0t2umxmpoy4omen fvtls)aDtauro;t0oex iietadfa2ua( p;u0 lxnmo3iodfa eluvi;s t2urxr iu4ape  ncsl(farrrxm nu1apeoifeiydfa uaump;()trxrmo ia1lm raivolt)t2xm(rpnudlm   fesas)srtm(m oo0alxniiciad a rauvs (4aexrxf iotop rlnvi;t0 exr(m3oodamte fcslt a2urur oo4altoifetydfsDuaumsnt4tlenxr3ty1oaDr nei;s0 rto(m oo1ap elnctls) rrru  oo1olxomoeiysls em( ont0texnmr3io1la eaivs ( srur(opou1op nlnvia(fsrra(rpno1oet  o3tlt m2em(mo;() rtomrcoa1lpD aivi t) rxoxm3nu1lm n iesa()a2um( pot1opto ocils aDelump (4tleoio iadoaD li sl() exmio3no4lpt  fcs sfaDtax  nu0tet mieilsfs2rmums;u4trxrio3io1oaDeluei;()srtmir3oo1om n ivsas  Draxm no1aeeo i3tlslm el( o;t0trtrmr3oodfmt anvs ()seum(r iu4open fvtas)s2tmuroou4texniietyd m2ul( p t0tetnio ta1oat lieilt0 2uo(mpou1lle mieslt)arumxm ;o0alxo iciyt a ranvp u0altnxf iy1lpD  i ol()s2uo(r oo4ale lfeils  2ur(rooo1tltomfetasfsDuauvs;u4tltriocoytfatranes;s0s2xoxr3oodlp nmnvsltfartmur nu1tlen ieiysfs2um(mo;t4aexrio3oydopte i ilt0setr(r no4apenlfcilt) Dumx ooo4tle iietas m emuvs t4tetoxf3oydop   n o (0s2tmim iy1ale mncta( srurxrpnt1aptnmieiadla2emumon(0tetnmfciadlm elueols truo(r3ou1aptn fctatfartaurono1opto oetldfm2umnmpnu4 rxnmf to1fm   nei s setoxmpnu1lmenlivsasfa2ta( ont4tlx iiciltfmDul(vs u) rxrmr3tadlm   iei;()srxrxr3oo1al e neiat arumx p;o4tltnifeiydfs em( pn(0tetrir3iodom  ai ol(  2trir3io1aptemies (farta( onu0ale mo3ils a el(mp;t) rtomrcoatlpte nvolt0srumxr iy1aptnmnvsa()s2rau ont4tpt  feiltfa2ua(vo;t)arxoxo3tatomtrln i;s0 rumim3oo1lmtelnvsltf 2rrxr nt0aexo fctls sDrl(vpn(0 ltnxoctadlptelu ils  rxo(m iy1apt mfvtlsfs2tm(mpou1aexnif3iat a2eluvo t4 ltrxocoydfmt  n o s0 rtrir nu1lpe  fct t) ruru pnt1teenmfeild m2emn pnu)texoxo oydlp  aiei;s0sexoxo3ou1oltnlfvi tfs2uaump;o1aee  ietldfs2emu s u)altnxfciytlmDe ivslt)sexmim3nudlmtelieia()arur( p;o0oetomo3tyt sDrlumonu0tltrxfcoydfatrai slt0srxm(opnodol nlici tfs2um( onu4teeniieiydlaDelu s;u)artnmf3tytfatraivs t) rto(opoy4omee nvi t s2umxmp;u4aex  icildfs umumpn(0tlxrmfctotla e u ol()seumim iudlptn ivsa(f Dtm(rpno4oltomietlt s2ra(msn()trenir3tydom rau sl(0sexrxrpou1omeelnes t) Draxmpoo0tle mfciltfm2el(vs (0treomr3todfm  aivo;(0s2trxo iu1lmte fvsl( arumum nt0olx  iciysla2uau pnt)trxrir3tadlpt lnvo t)s2umio3iu4opee nvil(faDtrum ou0apxomf3tyt sDrm(vpnt) eenmfcoo1lpte n i t0sexrxr3oodlmeelnvils  rrmur no1oleomietlsfs ean p;() rxoif3oy1lp rln i;t) 2tm(o iy4lmt mfvs ( srtmx  nu4ope ioetysfm ea( o;(4arxrxocto1fpt lueo s texoxo3ou1aptnlfvsatfsDtrxmo;u0tpenmi3tad s2uluvo u)alxomr oodoaDr nvi t) 2to(m3iu4lmt mfctas) 2uaum ;t1ole  o3ias sDul(vpn() rtoio3oatlaDrlnvols teum(o nu4ome mfet sf rtm(mooo0opxoio3tyt m um(vsnt0areomf3io1oa  lieo s)srumim nydom n fctas)sDrr(moot1aexoii3iys s rm(mo t)trtrio3tydlmDrlnvolt0truoimpnudlmee nvils) rtr( poo4aex miciasfa2ra(ms u4alenxo3ty1om  lnvi;(  ruoio no1open ivt (f 2trxmpot1apxniieildlmDrau s;u)altnxocia1opDe neils0t2urirpnodol n fetas)a2urxm oo1oltnioctyd a emuvpnu4 lxrmr3tytlp eluvo ( seuo(o nu4lp emfciat)aDrmumooo1apxomf3iys m2rlnms;u0arxrxr3tatopDe ueo;s  rxoxo3iydlpte fvi sfsDtru onu1alx  iciadlm2ea( sn(0alenio3oydomtranvi ( s2umir3oy4lp nlfei s) Dur( o;t0tet  o3ilsla2rmn s u0altrxrcoo1lmtranvs () 2trir oy1lptemivsatf rumu onu1tpeomoeilt a ranvp;t4altrxrciydfmtelu o (  eurim3iudlm nmict (f rtaumpnt1ape  o3iadlmDua( onu0 etnio oydfatrlues s0 rtoxrpio1amee nci s) 2umxrp;t4tptomfctadla rmn pnu4 lenif iadoa   i ols truo(mpnu1omtelivsl(f 2rr(mono0opxoiociys m2uau s t4tetrxr3ty1omDrluei;s0teto(r oydamtn fct s a2ur(  nu4alt io3tad mDemnms t)alxoio3iatla rlnvo;t  rto(m3oy4lptnmivtlsfs2ra(mont1teen iciydfs ulnmo u0 rxnio3tadlpDelu slt  2uoxo oy4altelici s a2truro;o0tlxnmoeildfs2emu s;(0tetnio3oodlat lu i t0s2xoiopiodlp e ictlsf Dtax  ;u1olxnmoeiad s2ran s u0 lxoxo oytlp  lieslt  eumimpoodllte fetat sDur(mpnt4tpx mfetatlaDeanvon()tetnmr3to1faDr uvs ()seurxm oo1lpeemici (f rtrurpot4apxn fetatfaDem(mp;u0tetnmo3iodoatelnvslt  exr(mpoydlmeemfvt sfsrur(ront4teen o3ilt mDumn s;(0trenmr3iodlat lnvs ()sexoxr3nydalte ivias arrax oot0alxnmietat sDeluvonu)teerioctadfp r ivil( trtr(mpiudoltnmfeiltfarrmxr oo4oex io3tas s2ulnvp () eerir3ty1fm  auei t)texm(r oydal nmiesls)sDra(m nu4ale ii3tad m uluvsnu4 lermf3to1fmD  uvs;s)t2trim3nydlmtnlietl()artru pnt1openiociadlaDua(vs;u)artoifctotopDrlu ils srto(r io1oleelfvi (fartaxm ;u4alxo feilt mDel(mo u) etnxf3iatlptraueolt0sexo(m3iu4amteliviat)sDtrxm ot0tetoiociytla ul( pn(4 renio io1fmte i ils)s2trxr3ny1lp e fvi s)s2rmum oo0alx mieiadfs rlumo u0 exnmfcta1lm raivolt  2um(m3iodap nlivi ()arrm(  ou4tlt mfcilsfs2uluvo;u)tleoxr3oytfpteanvol()trxoio iu1ll elncil(fa2tr(root1oleo octysls emump u4trxoxo iydfatraivi;t0 eum(m nu4amtelfcslt a2ra(m ;o1apx  i3iyd s rauvonu)tltoio oy1oateaieilt trto(opny4lmtelneil(f ruau  nt4olxniieild s2ua(mp u)aexnxrciytfp r u o s  eto(r3oy4lpt mivs t  2tax pnu0alt mfciys a2rmu s () ltrmrciodopDeanvi;s trur(o3oudap emieilsf 2ra(r no4oexniocilsls2el( p (4 etnmf3ootfp r i o;t) ruo(r3iudlmeemiesatf 2tmu o;t4aptoiicilsfm ra(vs;(0tetoxr3iatlat  i s ( truoxo3ou4llt lictat  2uaxmpot1opeo oetadfa emuvs;(4trenmfciadlmD li s;s  rumimpoo1om   fct ( aDta(  oo4oee  fetls mDrau pn(4 etoircoa1om eli i (0 rxo(m nu1ap  miet sfaDrm(root4ale iocilsls elumo;t) rtrir3iatla eluvi ()t2urxr oudam emfcs t)sDrau p;u0aex mo3iatfm2rlnvp;(4trxniocta1fpD  ieo s  rtoxrpny4altnlivs ()srurxm ;t4apx ifciydla2uaump;u)treoxo3io1oaD  nesl( setoir3iudlp elncs t)aruaxr nt4opt ioetyd a2elnmo u)teeoir oy1lm elivi;s0tetoim3ny1omt  nvt sfarua(moou1opt mi3iadla ul( pnu4trenmfctotoaDrln i t0trtrxopou4om nlfcsls)s2uax o;t1tptn f3tydfsDumuvs t0artnir totlmD an ils) rtrxo3nu4ole  fvtls)srta(mpnu4aee  ieiad s rmu p;t)trxrmrcoa1lmtelneils0 2uoim3nudlptn fctl(  ruru o;u1aexn i3ilt s rl(vsn() rxniocoydfpt ai s t  rumxm no1ale  fetl()s2rm( pou1tpt ioetytlmDulnvs;(0tetomociatfpt anvi;t)srtoxm nodlme lfeias aDumxm nt1oetn i3iysfm2ul(vo u)trerxrcoatfpDeli i;s  ruo(o3oo1lpen ieia( s2umumonu4optoiicild aDea( on(4 ltrio3oodfm r n olt) 2umio3oudlleemnvs (fsDrm(r nt4tlx  oeilsfm ulumon(0 rtrmo3tytop elueils t2xr(o oy4lp  mietlsf Draxrpnt0alxnmi3iasfa uluvo t) etrmr3ty1fmD ln slt  rur(r oodamtelicsa( s2ur( o;o0texomoeias sDrl(vsnt0alxoxr3iodlpt  u slt)trto(r iu4alee netat)arumxm ;t4texn oeiltla emnvs t)aexrircoo1fat lieo t0s2xmim iydopenmfesl(f Drr(m ou4tpt iociytfm el(ms (0texrmf3ty1lpt ln ilt tetoxrpiy4alte nei ()sDrruroou1tpxomfeiasfs emn p () eeoiociy1om   u s t trtm(rpiu4om   iesls) rtmxmont1tpxniietad sDumnmon(4alermr iytfp eai s;() 2uo(rpoy4altnlnvtls  2ra(rpno4oleomfeiadfa2ea(vpnu0arxnxo3iodlmDr i il(0 etmxo oy1lp n ies tfsrua(rpnu1teeo ociad m elnmp u4alxnmr3to1lp elnes s0s2ur(rpio4ome mietltfsrrrxmoou1tlto ociltla2emu s;u0tlxnmfciydop elnei t  eto(o3iodlmtnlfet (  rrmxr ;u4oet ioctldla2rmumo;()trtnmf totfaDrau ol( t2ur(opoodll   fct s a2rru poo4opxnif3iatfs2ean s (0 etrirctodomt lnvils)setoxrpio1ome mncsa(fs2tr(ro;u4tlxomo3iadla rlnms;(0artnio iytfmt ln o;s0 2xrio iudomeelncslt s2urur ou4ope ioetysfa emnvp;u0 rxnmfciydfateai o;s0s2uo(rpnu1ll   ietat s2rmumpnu1aexo oeiytlmDem(vo;t0 lxomr3oadla e uvo;s0t2tmxrpno1ole mfetas s2raumpnt0tpenii3iaslsDea(ms (4tlenio tadlp eauvsls)s2toxo3oy1alt lnci () 2rm(mpnu0tptomiciyd s eaump u4aexrio3tytfm elnvsls)tetmim3oudope liciat) Drr(r oo1opt mi3iysfa2ua(mp;(4 exoir totomDrlieolt0trtrim3iu1lmtnlfetl()artrumont0aexoiicilsfsDea(mpn()aexrxrcoadlp raies;s)setr(r3ou4lme  ivta(fartmx  no1tpe  iciyt s el( p;u4areomf3oadopDe ivils t2umxr3oydopee ivtl( a2rm( pnu0ope iietldfmDrmumo u4 lxoifcio1oaDeluvol()s2tmxm io4altemnvs sf Durx oot1apxnmo3iasfs em( s;t0arxomf3tytop  lnes;s)t2xo(mpiu4amtnlfesas) rur( o;t1tlt mo3tytfmDrlump;(0 ltnmr3ty1late uvil(0s2xm(o3nodamtnlivsat) Duaur ot1alen ictyslaDulnmo t)tlenircto1lmD an o;( s2xoim3oodapee nesatfs2tmxronu4tle  octatlaDum( sn()trerxoctotlpD aueil()tetoxm3ou4ape  ictl() Dum( o;o0olenmo3iatfs2eln p;t0 ltnio iotfmtran i;t0trumim3ny4apeemfcias)s2tm(r ;o1tle mfciatfaDuln o u4 lxoxf3ia1fa   ueol(0trxo(mpno1apt lfes tfaruax  nt4tetomiciyd aDumu sn(0 lenxf3iydlm ranvils0srumxr iu4ole livtlsf rtaurp;t1alen ieiydfm umn pn()alxrir3oadlaDean o s srum(r3iy1aptnmivi t)srrr(mpnt0texnmo3tyt mDumnmp t4 etoxo3tadop ean o;s)tetmxo iu4alt mnvia( srra( p;t0olto fcildfa um( s;()texnir3oatlaD  ivo;s) rurirpoudome lfvs s)sDtaur ;o4opxnii3iydlm2ua( s u)aetoio3oy1oaD anvo;s)t2xrxmpiu1ll  mivi tfs2um( ono0tpx  f3iat a2elumont0aeenir3tydfaD lu s;s)s2xoiopnudom  mfvsat)aDurumpnu0oex  ietls s2rl( p u) etnxo io1laDelues;(0trxrio3nodope mfcs t sDtr(rpno4tpxo i3ils a ranvon()arenmrcootfat lnvo t)s2to(r io1opt lici s  rua(mp;o1oeto f3iltlsDul( p;u0trtomo iytfptranvi ( t2um(r3ny4oltelivs ( a2ta( pou4aet  fctydlm uauvpnt4aetoxr iatfat ai s;t0t2toirpiodop elfvtas  Dtm(r ;u0tetomfctadlmDeauvp;u0aexnir3oadla  livo;(0 eumio iydomtn ncil()sDurum oo1aeenifciltlaDumu o t4 rxnmr ta1la   n o;s0teuoxm ou4amee ncsa(farrmumonu0aleomoctyt s2el(vs ()texnio io1op rlues;()srurim iydap nlfcil(  rrmx  ;t0aex  iciyt aDeln onu4alermf3tydlmt au il(  rto(o iydamenmnvs (fa2uax  no1tlt if3tatfs ean p t4tetoxrcoa1omD aueol( trtrxm3ou1optelncilsfa2taumooo0oexoiieiaslsDuanvsnu4altoxf io1om raies;s0seumir oydalenlfcs (  Dtmuront4olxo o3tad aDemu p;t4aexnir tadomte ueol( s2xr(o oy1al e netl( arrr(rooo4olxnifeiasla2emuvsn() etrifctadlmDran i (  etrxopnodlme lnesa(f rrr( pnt1oleoiociytfs ul( pn(4tlermfctadfa elues ( s2xr(m io4am e nci tf Duaumono4tetnifeiysls rlu on(4 exnxf3iatlp   ueolt)trxrio3nu4lleemnvtasfsDtm( p;t4altnmietadfs ean snu0 lerxr iadfp  li ols0s2xmimpoy1apeemnetas  Dtmumoot4alenifeilsfa2ra(vp u4tltrmo oodfmD auvo ()teumir iodomen iesas)sDraxrpno4oexn ictyd sDuau s;() lerxfciotop  auvsls0trxo(r iydlp nmicia()sruaumpot1opto ictadlsDulu p t)arerxocto1lat ai i s)s2xo(o ou4al emnviat sDrr(moou4apxnmoctlsls ean s ()tlxoxocoa1op rauvo;t)trxmimpno1om  lnciat arraum ;t1alx  f3iltls uluvsnu0 rxnifciydlaD lues t)trxoio3oy1lpe  ivsl()sDrmurpou0tpx  ietydla2rauvs u)aetrir oy1latelneo;(0seurxmpiy4lpe mivslt)arraxmpoo4oetn iciytfaDea(vpnu) renmo3tydlpDrli olt)texoim iu4lmtnmictat  Dumxrpou1tltnif3iytfm rl(ms;u0alxnmo iadop   ivi;() etr(r iy1ape  neia(f 2rru onu0tee if3tat m2um(mp u4aexnio oydlm e ieo t srto(r3ou1apeemncil()a2taxmoot4apt  ocilslm eln o u) lxnmf ta1oatrlueilt0 rto(m3nu4llt  net (fartm(moou1teeo i3tad s2uluvs;(4trxoxo oydoptrai s t0t2trxrpoodapenmnvt ( s2rrxmp;u1optnii3ild a2uanmon(4arenio3io1fmtrlues;() rxoim ny1olt mivsat a2taum no1alx  iciadfa2rm(mont4aexoxocoydlmDe nvo;s)setm(mpoodomen nes sfsrur(  nu0oetomfetadfaDeauvsn()artrxocoytop eliei s0trxoxr3oudalt livslsfsrum( pno1altnifcildfs ea(mo;t) etoxf ootfaD liei t s2trxrpiudomtnlnetat s2uaxr ot1tlxnif3iadfmDrm(vo;t4 exrxo3oatfmDr ueo t srtrir io1lpt mfcsa(farrrurono1aex  ocildls2ulnmo;t)trxomf ty1fp rai o s  rur(r io1lm nlncia(fsDta(ront1apeoiieiyslmDumums;(0 rxoif oadomD  uvsl() exr(o3nudlmtelfetatfaruau p;u0oltnifctatfs rlump;u) exoir3oydlmD lueslt  2ur(r3oy4opte ivia( sDtmx  no4opt  ictysfm em(vonu0 leoxf ootfaDrluvo;(0 2to(mpnu4apenmietl() 2umx p;t4teen oeias m2rl( o u)artrmf ta1fatrlnvi;s)srtr(r io1ope lnvsa( aDtmumo;t1opxo f3tldlmDelnms;u)arxomo iy1fa  auvo s0t2tmxr3iu4alenmnvs s)s2uau o;o1olt ioctyd mDrauvs;t0 lenxf oatom elneo;t) 2trim3ny1omt licsls sDumum nt1tpeo feiltls emn pnu4altomf3iadla  luvs s0sruoxo3no1ope mieslsf Drau poo4openmicilsla ea(vs t) eerxociadoptelnvils0 2ur(m3oydlme miesl()aDrmurooo0tlenmo3ilslaDra(vonu0 etnxr3todoateanes t0setrim iudom  mfvi sfaDta(ronu1oeeo fetyt a rlnmpnu0 etnxfcootfate uvo;()tetr(opio4lp n fei s sDum(m ;o0apx ioctyt aDea( o u)alerxr oodop ean s;t trumxopou4am nmnciat  rtrxr nu0aee if3iltlsDuaumon()teeomo tydopDe neo (0 eum(opno1ll   nvsat  2ra(  no1oet moeiysfs uan s ()arxrmfcta1la   ivo;s0 eurir3oodol nmnvils aDumuro;o0oetniictytlaDrln p;t4tetoxfciy1fp r u sls)seuoxr oodol   nvi s)srua(  nu4tleniieilslm2ulu p t)artoxf3tytoate nvs s)trxmxo oo4am nmictat) rumumoou4tlxn octytlm2ra(mo (4 exrxf3iy1opD  n i (0srumiopno4op  mfctas sDumx ooo0alxo f3tytlsDrmuvs u4tetnxr ta1oate u sls0t2xoio3nodlmt miesa( aDur( oot4oex  o3iytfaDrmn o;(4altomf3tydlm  auvsls)t2urxo3ny1lmtelieiltfarur(roou1ole ifetlsfs uan s u0trxrxfciatlmD  nvi;s0s2xm(r3iudam n nesa(f 2tm(m ;t1oexn i3tas m2uan s;u0trenxr tatlp ran s;(0 ruoir3ny4lmeelnetl( srtaxmo;u0tpto o3iasfsDel(msn() lerifciadopt livils0s2xm(o3iodol e fei sf 2uaum ou0tpt moeild s rm(mp u0trxnifcta1la ranvolt  rurio3oo4omte nvtl( s2tr(mp;t0tpt  iciyt s2ulump;(4trxrxr3todfptraivslt)srtoimpoy4openlneil(fsDuaxm ;t4tpx  ociydfa2ranmo ()texrxfcoo1oaDeai olt0tetmxr oy4opt mivsat a2trxr nt0tlxn iciatfm2ua( s t4tlxoif ootoptelivils0trtmio3ou4omtnlicsa(fsrrr(  ot4olenmfcildfm2rlnmpnu)texrmfcoy1faD livo;t t2xmim3nu1amtn nvi sfa2uaxro;u0aet  iciaslsDeaums;() lenxf to1omDeaueolt s2xoio ny1opt mfvi sf 2rmur ou1opxo iciysfaDelnmp t0 rtrmf iy1opt lnei t srumirpny1lmen iciat)artax o;o0alenmoetys aDrlnvp;()aleoir oy1oaDrlnvi;t  rtoirpiy4aptn ncias)sDtm(r ot1tetoiiciysfa2rluvs;t0arxrmo iy1fmt  u sls0srxm(o3no1lme  netltfaDtr(r ;o0opeo fcildlm rluvpn()teeoxf3to1lm rlnvsl( seuo(opio4lpeelfcsl(fsrtru  oo4optomiciasla ea( s;(4aetnxo iytla e u s;t)srxmir no1am n nvsa()sDrru ono4ole ioctadlm ea(mpnt4aexnio iydfaD luvi;s0 ruoirpnudlle licta(f Drmu pno4tlt if3tad s2eauvp t)artnio3tadoa e i olt0 2xo(r3oy4ol n ivtlt)sDtrx  ;o0opx iociysfm emnmpn(4trxoio oytfat  ivo;t t2uo(m3oodapen nvs ( a2uaxr ;o0tlenmfctadlm2uan p t4aeerxo iotlmtraivo;(0 exmxm nu4amtnlfeilsf Dtaum no0tetn ocilsfaDumn sn()aeenxf oo1lptran o s  2um(r3iu4om  mivs (f Dumu  ot0tltomiciaslmDem(mp;u0artoircoydfaD  nvi;t)sexm(r3nu1apeelncsa( a2rmur no1tlto fciydlm2ra( p t0alxoxr3ty1la eanvi s trur(rpnu4llt mfvia() Dta(m nu0opxomfeilt s2rm(ms;u4altrmocia1fpDrli o;t)seuo(mpny4am   ietat  rrauroot4aexnmoctyd m uau o u) exnio3ia1lp r i s;()s2xmxo3nu1amt mietasf rtm(mo;t0aeenmfctltfs2ulnvo;u) rermo tydopt  ieslt)teuo(rpio4lm emfetat)a2raxrpnu4alxn i3tytla2rmn snt)aeenmo3io1oat lu sl() ruoxo no1apte netatf rur(mp;o0altnmo3tys mDrl(vont0altrif todfa elu s () euo(rpny1ap  lieta(fsrumxmpno0apx  oeiltfm ranvo ()arxrifctydfp  an o;t0t2tr(o3ny1amen ieil()s2tm(root0olt mf3iydlm2umu s;(0aeenxrciydfmD  iesls0srtmio3ou4ale lfcilt) ruau  nt0oet  ocils a2ra(vo u0aexrxr ty1lmDelu s;t) 2toxopnu1aleemfvsltfa2rr( pno4opeo o3tld m em( o;t4texrxo3ty1lp  ln s;s)teumxm nydap elfet s) Durumpot4olt iociyd sDrmumo;(0 lxoxociydlmDe n i;( texmxo nydolte nvtltfsrra(  ;o0oex moctld s ul(monu4alxnxrcty1oaDr ueo s seuo(o iy4apee fvi sfa2tmxmoou4aexo f3tatfsDrmnvp t4 rxnifcoodlaDe i o t)trxoxmpoy1open fvtas)a2tax p;o4aptnmf3iasfs rlu p (0tetnmocoatoat  u i;s)trxoxrpnodlmee nvt t  2rm(rpnt1tltnmo3tyt a2ean p u4tetomo3tadoa  li ilt t2xrxr oodole  fci tfa2um(m ;t0alto i3iydfsDea(vs;u4alenmf3oodop ranvs ( t2uo(o3iu4ol elfeslt  2rmurp;t0ale iiciytlm ea(ms u0trenmocia1omt  uvs;( seuo(mpny1optemivtltfa2urxmpnt4tlxnii3tlt mDrmuvon(0arxnmociydopDr u s s texoxr oo4lmtnmfetl( artm(rpot0optomictldlaDemn s u0arxnioctydfaDe i s t0setmirpnydlmte nvs ( srraxmoot4tlenmiciatfa ua(vs;(0 exrif3ty1fmt aueolt  exrxo3oy4apt mivsas) rum(m oo4ope mf3ild mDelnmp;u4treoir3tatomD  uesl(  2ur(rpoudomenmnei (f Draurpnu4openmi3tldlsDea( s u0areoxo oodfa raues;()sexoir nu4lltnlfetl(  rrr(ro;u0aeeo o3iltlm2rm( ont)treoxfctytfm raueo t0trxr(o no1lm nlnvias)sDrm(ront4apt  octlslsDeau s u0teenmf oo1lat anvs s s2umio3nodllen fvtls srta(moou4tltnmi3iydlm2rluvont)altrxfcoydlm e ivs;( texoxr3oy1amenlici (fsrrr( ooo4tpt  ieiydfmDumump;t0alxnxo tadop r nvs s t2xo(r oo1ameemnvt () Drr( ont4tpxnmfeiytlm ul(ms u0tlenif iatomteaies (0t2xo(mpiodope lfvsasf 2uaump;t0oleomfetydfm2emnvsnt0 rerio iydlm r u olt)s2uoir3iydoleemivsasfs2raxmono4aexn fctlsfm emnmsnu4 lerxr3to1lp rau s;s setoim iydolt mnvtl(fsrrmxmpoo1texnmfeiytla ran p t0trxnmf ia1opteau ol( s2xoxm ny1om e ics t  rtaumono1alx mfciasls2rlu p (0aetrxf3tatoaD luvilt0 exrxm oydaltelici t  Dra(rpno1aexnmieiasls2rmumo t0tlxomr oytfaD lnvo ()seumxrpoy4llt  fetlsfsDrm(r ot0oeeomociasfm el(mo;(0aexrmf todfp  an i t s2ur(r iudol   fvi t)srtrxm ;u4texnmocilsls umnmp t)trxnmr3tytoaDe ivsl()teuoim io1lpee nciasfs2rr(  no0aleo ictasfsDul(mpn(4 leoxo3tydoatranvils0srtrxrpoo4ame lfctlsfaDtrxm nu0tpe moeildfm2rluvsnu4artoir3ia1oatr i o;t) 2triopoydamtnlics t s2umu pot1oee ifetls mDrl(mp (0aetrxocio1fat aivo;t  2toim io4aleelfcias)sDraxmpou4oeenifciltlaDra(vs u4aeenmf3oo1lp  an i t) exr(mpnydalenlivt s sDrr(mp;t1opxniieiydlmDean on(4teerxrciodom rau slt teumio3oo1ap nlncsl(  rrr( pnu1aeen f3ils a ran p u)trenmo ty1laDe i ils)srxrxo oo4ame  fvt tfs2tm( ooo1teen o3iltfmDrlnmp t4areoxrcoytoa  livi;t texrxm3io4am nlncs (fs2raurpoo1tle mieiadfa2rl(vo;u4teenif oydfm  auvi;() 2umxr3ny1lmee nctat)srtm(rpnu0opeoio3iyt m ea(mp u0texrxocta1fpte nei;t) rtrxr io1lme mies t srrm(r nt0apxomi3tld a em(monu4aetoio iadlaDeau s s s2xmxr3iydam nlivs (fa2rmur ;t1alto iciad a2ulump;t0texoxr3oy1opDelnvs t0srumim io1op nmivtas arurxmpot0optnioeiydfs2rm(mon()tlxoxf3iatla r uvo;()s2umxm3oodolee icia() Duaurpno1tleomo3tatlm em(mp;u4teenxf tatomt  u s;t t2tr(o3no4open nciltfs2ta(rp;o1oetn ieildlaDelumpn()artoiocio1lmteaueo (0 rxmxr no4omt  fcsat)arua( pot4ale  i3ilsls2rm(vsnu)tetoxr3iatfatelu i t srtr(o ny1llenmictl() rua(m ou0teenmi3iatfa2elnvo;(4aeeomr ootla  aivols)s2urxm3iy4alt  fvs tfarumxrpot4oexnmf3ias a eau on(0tetnxo iytfat  uei;(  rxoxr no1ale lfci ()artmu  ;o4tetn ictyt mDrln p t0teenifcto1fp  ai i t0s2urxr3oo1lle mfeta(f rra(m ou0tle  ictyd mDuanms;u0tltnmo3oytlpDran s;(0 etrxr3oodome  ivias) Durxmont1tlxniieiys m2rlnmsnt4alenxo oy1oa r uvols0s2urir3ny1om e ivs (fs2truro;t1tpt micilslm2ran snt) rtoxocoo1latelneo ( s2xmim iudameelfci ()aruru  ou0olenif3iadlsDua( p;u4teenio3oa1fmtelu i;(  2toxmpoo4lmeelnetltfsDra( ono1tpenif3ilsfs2elnms u4arxnxr3tytlmD lu s;t0seumir3oydom  lncias) 2rmx pot0apenmfctytla2ulu p t4areoircoodomt ai o s) rtmiopno4lm nlncsltfsrrr(rp;o1altnii3iytlsDum(ms;(0tlxoif3todomD luvils0trurxo3oodllenmieils a2urum ou4tle if3iyslmDrmnvp u) etrxo3iotfa  lu s s trum(opnu1amt  nci tf Dumu  ;o4olxn fetat sDumnmpn() lenif3iatfp e uei t0texm(m no4lme mnvi t aDur(rpnt1aexomfeild sDemn pn(0 lxnxo ia1fmtr u i ()trxo(o iodlpe  fcs tfsDtr(m ;t4opeoif3iyt aDeln s t4arenif to1omt livo;()t2xmxm3iu1opt  nvtasfaDrrur no1tlen o3ilt s umn s;(0 lxrmf iytomDelueo s0 rxrio iydalte ivtl(  Dta(rp;t1tpe iieias s2rm(vpnt0tltoxf3oytfa raneo;t0s2xmxo3oo4op  mivi t aDur(  ot1oee mfetad sDum( o u) exnio3io1fmDeanvi;s srto(o nudll e fciasfsrraurpoo0ale moetls a eaump t) lerir3iytfpD  neo;()sexo(o ny4apeemfcs sfsrrau p;t0olt mietadlm uauvon(4 eerif3iytfm   n ils0 2tr(o ny4ope  iei t)aDrr(ro;u1tlenmociytlmDemnvs;u0 rtoxr ta1fp raieslt0srxmxmpiu4alt  nei tf 2ta(rpou4opt io3ildlm2umumsnt4 ltoio ia1lpte nvo (0seurxm iy4apt  nvsa()arua( pot4aeeo ociytfaDem( s t)arxrxfciatfate i o;t)srumxr nydlmt mfvt s)srurur nu1aexnmfcildfa ulums;(0trenio iydlm e i ols0 etrir oo4apeelivt s)s2ururonu4tpxomicild m uanvp u4 rermr oodlmDrlnesl()truoim3ou1lm  mict t  2tm(rono0teto oeiatfaDul(mo ()tltnir ia1faDelivilt) 2tmxr oo1apee fesl(f rtmxmpot4tetnmi3tlsfm2ran p (0 rxoio3oy1fateauvo;t)setmxrpio4lmt mici ()artm(mpnu1tlto ieiydfm2ea(mo;(0trtoxf io1om rln i t  etmxo3no1ap n fvs sfsrumxmoot1tlxnif3ilt m2eauvpnu0alxoxrcto1fatrai ols)texoxm3iy1ape mnvilt s2raumont1tle  ociysfa2uanvp t0tltomo3tadoa r i s;s0 2uoxopnodop  mneslt  Dtmu  ot4oetnioctydfm2umumsnt0trxrmf3to1omDrlu ols sexoirpnydlmtnmfvsa()arrmxm no0alxomo3tld s umnmp;t4arxoiocoadfpDrau slt0t2umxm oudopt  feia( sDrauroou0aexomieiasfs um( onu) rtnmr to1fatelies s) exrxrpnudamen fvslt sDraxm ou1olenmieilsfm2emnmpn(0arxoif iy1op raivs s  rxo(r3ou1op  mnesl(fs2rmxmo;o4tlen icild a2emuvo t0tlerxf oytfm rlieol()seumio3ny4open fcsat sDrm(moou0tlx iiciasfm el(msnt)tlxoxr iodom elu ol(0sruoir io1lle liciasfa2ra( ont1olx iocildls uauvo;u0tlxomo3iy1lmtrln o ()t2umim3oydomtnlfvtls sruax  ot4tee mociys s ranms;(4trtoir ty1optrln o s t2uoim iu1altelfvsa(fs2um( pot1alxo feiysfa2el(vo u)teermr3totfmt auei;(0t2uoirpoy4apt mfeta() rua(mp;o4oetn octadfa2el(vs;t4aeenxrcoadoaDe ivil(  exoxo3ny1ope mfci ()arrmu o;o1olt  ietaslaDrmuvs u4 etnmrciy1oaDr uvi;s)teurxo oo1lm   icsat)aDtm(rooo1tpxo ictad mDua( pn() lxnmf tatfa elivs ( t2xr(o3ny1ome mfeiltfaDtm(  ;t4tpe  i3ils a rlnmp;t4teermo to1lmDraivs;s seuoxopiy1ole mnei t)aDtm(mono1openmfciytlaDelnvo t4 etrifcia1fmDr n il() rxoxo ou4olenlict tf rumxmpoo4oee ifciytlm um(mont0 eenxrcoydfmDrluvsl() exoxr3nudame  fct (f 2ur(  ou0open fetas sDul( pn() rtrio todoa  aivi s0seuoxr oudomtnlnesas)a2ur(r ;u0apeoif3ilsfs ulumo u) eeomr iodlaD livo;t s2uo(o3oodapte ies s s2ra(rpou0teto iciydfm el(vp;u)altomf io1oa r nvi ()texrim3iy4op n nctasfsDtrumont0tptomociysfs rm(vsnt4aeenio totoa r i sl()t2um(r3iy4op nmieiat s2ta(mpno1oltomo3iatfm2raump u4trxnmf oo1fmDrlnvo;t) 2tm(m iy1omtnlics tf rtru ont4oee mietytfs2uaums;t)tlermrcoa1fateai o;s) etmxrpoy4amt  nct s sruaxr ;t1tptn fciytfsDrmnvs;t4 ltrxr3oydop r i olt s2xoiopiy4ape mnes ( srrm(rp;t1tpeoiociasla2rm(ms (0tetrmrciydfatrlnvs s  euo(m3iodamtemnvsa()a2rru onu1olxn i3iat s2rln p () leomr3todomtrlnvo ()srur(m3oudoltemnesl() Dtauro;t1oee mo3ild a ua( o;t0teerxo to1oaD aivs s0 2tmxmpno4al nlnvtls)sDrmxrooo4opxnmo3tlt m2ra(mo;(0 eeoxf oydfm r iesls0 eurirpoo1ll emnet s)artau  no1tltnii3tytlm2ua(ms;t4arxoxo3oatfateln sls teuoxopoo1amen netls  Dumx  ;t4opxoioetydfa2umu p;(0 rtoxfcio1fmD lnvi;(0s2xoim oudll   nvsasfarrrx poo0apx miciysfaDumuvs;u4artnmrcoatfpDrlieo ()texr(r iu1omtemnvta(f Drr( ono1tlt mo3iydfa2ua(mo (4artnxf3totomtean o;s) exo(r ou1al  lieils)a2ta(m nu4oex  ietas sDuauvp u4 reoxr3ta1lmt  u i;s0s2trxopny4amenlfvtl(fsrur(r ;u0aet mi3tlsfsDeln s;(4tltoiociadfa r ueol( texrxo3iodopenmneils  2rmum ot1tetnii3tydla rmnvon()altnmrcty1fp rau s ( sexo(m nu1lpenmfvtltfsrrrx poo0tpx ifciatla eluvonu)altrxr3todfmDe ueo s0 2xo(r3nydomtn fet ( aDrrxmp;t0texo ietadfs rlnmp;(4alerxo3oydlaDe n s;()sruoxm3no1ap emfcsasfaDuaumoot0alx mf3ilslaDelumpnu4 rerxf3iotfatrlnvi;t s2toxo3nu1alee fctat)artmxrp;t4tpt mfcias m rl( s;u4 ltniociotla   n s t0 rxoxo3oo1lltnlnct sfarrrx o;t0ape mi3iysla emnvo;(4artomf oodlm ranvo;(0 2xrxo3no4lmtn ieslsfs2umx  ;o4opt  o3tls s rl(mpnu0 lxrxocoadla e i i;(0 exm(o nydap elivtasfaruau pot0aee ii3ils m2em( s ()alxnmr3tatfa elueol(0 etoxm iu1alt  ietls  rua(rpou0apxniociys s um( s u)aeermr oo1oaDe ueol(0sruo(r3iu1lmt  nvs ()srta( pnu0apen oeiyd mDemumo u0tlxoircoodfaD an s ( sexoio3oydaleemfctatfs2umu  ;o1oeeo ieiat aDemuvp;t)teenmo iotlaDe i s s t2tmxm3nu4omenmiei sfa2ua(rp;o0tpxoifeiad a ean p;(0alxnmocoa1fmDraieo t s2tmxr3nodlp elfcia()a2um(ro;u4ape moeiyt m ua( p;t0treoxo3tytfptrlues;()srxoxr3nudlltelici ( aDrr(  ;t1tpe mo3tyt s2rmn s t0tetoxf todoa rau ol( seur(r3iydamtelfcias a2ta( o;u4aexnii3tat aDrm(ms;u4aexrmr oy1faD livsls texoxm3oudlltemfetasf rur(  ou4tlto ociytlaDua(mo;(0alermr oodlp  lnvs t0seuoxo3oy4ll nmnctl()sDrr(rpou1open iciysfm ra(mo u0 reomocoy1fat  ivi;s)setmir3oo1altnmict ( s2urxroou0tpeo feiad m ea( o () etnifcty1opte nes s srxm(r3iy4lleemfvsas) Dtrx  ;o0opxomf3ias m eaump;(4tlxoxfciytomDrluvs (0setoimpiy1lm nlnvia(fsruaurooo1alx mi3ilsfa2um( o;t0 rtoif totfa elieo ()trxoxm3iydllte fet ()srta(rpou1texnifetatlaDem(mp u0tlxniociatoaDeauvs;s0s2uoxrpnudol nlfcsltfa2ra(  ;u4tlxo fetydla2ra( o;u4treoiocia1opD lu sls)trurirpiydop emfcil()sDrmx  nu0tetomi3iatfm2eaump;t) eenxr3iatlmte n o s)srumxr iodal  lfcsas  rrrumoou1alxomictlsfm ea( s (0 exnxo3oydomD luvol()trxo(r ny1ope mics t)sDtau pno0opxoiociysfs2ulnvpn() lxomrciydfm  liei ( trxoiopny4aptnlncsl(fs2urx  oo1apxoiictydls2uaums;t4trtoif oadlmDelivil( trum(r3ny4opt mnciat  Dtmx o;u4aptoii3ildfm el(ms (4trtrio3oa1lat  uvi;s)trxr(o iudope livilt) Duau pno4olt  fciad m ulu o;u4 rtnif oy1fatelnvs;s) etmio nydlp nlfvi sfsrum( p;t0aex  o3iytls2elnms ()alermf3tatlaDrlu i;(  etmxo iy1openmivslt  rua(m ;u0olt iocildlmDemn s;t4trxoiociytop r uvi;( trtm(mpnodll e fvtas) Drm(roou1optnifeiytfsDem( pnt) rxrxr oatfatr n o t srxm(o3io1lp emies (f 2uaumooo4aex mo3iltlm2el(vo (0trxoir3oodla  ai o t0texrirpoodlmt livtatfsDtmxrpnu4opxoiieiydls umnmpn()trxrifctatlptrauvs;s)srtmxm3ny1llenmicias)aDrmu p;u0tpxo oeild sDel( p;u0artrxocootfmteaiei ( srtr(o3ny1alte fctatf 2rmuroou1alxniociytlaDeanvon()aexrioctodlmt lnvs t) ruo(m ou1open fetls)srua(m oo4oeeo f3ild a2rmnvo;u0 lxnmf3iadlpt aies t0tetmimpnu4ll  lfcias sDum(ro;u4tpt mi3ils a rau pn() etnir tydop eli s (  eur(opiodoltemnesas  rraxmpnu1tlt ioetydlaDelnmp;u)tetomr3iotop eli ils0tetoiopnudlmt lfvsat) rrr(mo;o0teen fctad aDea(vp u4teeoifcio1opDe n o;t0trumim3iudam  mnct ()sDumumpnt4oeeo oeiysla2ea(von(0aetoir ta1fptrln slt)seum(m3nodlltnlfvtltf rtr(  ot1tlenioeilsfs2umnvp u4 rxomr totfm   i s;(0 etmxm io4apteliei t a2rrxro;o1ale moetas m2emuvo t4teenmr3oydlm  anvo s  exoiopiy1op eliesa(f Dumxro;u0teto ieias s2ra(ms (0trtrmf3oo1opD  ivs s0 rtoimp
\ No newline at end of file
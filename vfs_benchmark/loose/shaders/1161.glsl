@@ -0,0 +1 @@
+ieo;s  2urxo io1alte fet s sDtax  ;o4tleomociytla em(von(0 lxrxfcootfp eaivsls  rumio iy1op nmnctl( aDrmumono4openii3ild a rmu p u) leniocoydlpte uvs s  eto(o oo4op e fcs t aDra( pnt4tlx mfetldfs ran s;t4 rtnxfcoo1lat ai i t0teurxo iu1lm nlnct t) Dta(r oo4tee miciadfaDuln o;t0 ltrifciy1lp   u i (0 etrxo3io4lm nlicsas) 2ta(mooo1tltniieildla2ranmont)altoir3tytopDranei t  euoxo3iodllt livs tf rur(mo;t4oex iictad a elumsnt0teenxfciy1lptelies;()s2toxopoo4lm elivtas arurxm ;t1opxnii3iltfm ran pnu0aeenmf3ta1fm e n o (0tetmir3no1ol   icsasfsDrax o;u4tltn feiysls ul(msnt)tltnmr oodlmteaueo;(0trur(m3iydlmenmfei () Dtmu p;u4oetnmieilsfm2ea(ms t4 etnir3oy1fat ln sl(0t2toiopiydopt mnctl()a2uax ooo4teen ictld m2rlnmp u0 exrif ia1lmt li ol(0 etoio3ny1ome mfcslt)arra(r ;o0tle  f3iydlaDum(mp ()arermr3iydomt  ivi;(0 eum(o io1am nmnvils)sDra(  nu1aleomietyt m umuvp t4aetrir ootlpte nvo;s)s2trxrpiy1am   neilsf ruaxr no4tltoiieiysfaDul(vs;u)aleomr3oa1lm r ueo t)seumir ou4ap   fvia(farra(monu4tlxo i3iyt m rm(vs;u0arxomrcto1laDr ivslt0seuoxrpoodomtn fct s aDurxmont0texnmfeiltla emumo;t)texnmf3oatlmDeaieo;t0trxr(m3iy4optn icia(  2ra(rpnu4tpxoii3iatlm2uau o;()alxrmfctotlm  luesls s2to(o oo1olt  fvtl( arua(rooo0tetomoeiadfa2rm(vp;()artrxr tatfptrlnvs t0srurxopnu1lle livil( srraxmp;u1aex ifciltlsDuanvo;u0tltoxo oo1lm r i o (0tetrxr3oodll elnvi ( aDrmx ooo0olt  o3tatla rmnmo t4alxrifcta1op eau o t) rxoxopoo4ape lnciltf 2ua(r oo4tlx ifeiatlm2rauvs;t4 exoxo oy1oa e iesls trxr(o ou1op   icsltfs2um(ront0aptnmo3iatls rl(vs;(0 rxnioctatomt lies;s  2xo(rpio1am elfvt t)s2um(r ;u0apt  feilsfm2rlnmpnt4 exoio3iy1oa elnesls setmir ou1am n iet ( sDtr(  ;u1tex  o3tyt s umump;()aeeoio3iatlaD  i i;s) exrxr nydll  lncs tf rur(rpnu4aetnmoeiadfmDelnvo;(4 etnxr iodfat luei;(0sruoim3oy1am  lfet s srta(mpno0olt mo3tltfs2rauvs (0 renxrctatlaDean s;()tetmim3oy1apeelieta() rtaumont4tptoioetyt sDulnvp t0 ltnmf oo1lpDrau il()truoxm oydlm nmivi sfsDuaxrpno1tptomiciatfa2emnvonu4trxrxr tydlpD  i o s0t2trxrpnodom  lfei t aDuauront0apx ifetyt s ua( o u)tltrif ia1om r u sl( srurxrpoudlpen ieia(f ruaxr oo0oet  fcilsla emnms t0tltnxo3oytlmD an olt0texoxopnu1lpe  fvtls  2tmum ;o4tptnif3iysla2ea(vp (0 ltomf tytlmte n s;s0 2xoio3iu1am nlieia(  Drmx  ;t4alx ifetysfm2um(mp u)artrxocia1la   nvi;s0 rxmio3ny1alt  ict (fsDra(m nt0aexo o3tadfs2umuvs (4 rxomr todlm ranvo s) 2urxr iydomte fci s) 2rrxmpoo1alt mfetlsfaDeln o () ltoir3iatlp  aneslt trxm(m3iudale lnet t)s2rru o;u4ale if3ild s2uaums t) eenmo oo1omt an s;(  2urxrpiydole lnvias srtrur no1opeoifeiytfa2ranvont0 etrif oodfa rli ils)seurir nudop elieiltfaDra( p;t1tleniiciytfa elu p (0teeoirctydfp   ivo;s0 rum(o3io1om nmivt sfsrra(ronu1tpe mfcildlm2rlnms u) eeoir io1fp raueo;s s2xmxr3nu1lpeemfvil()aDtm( pno4oet  oeiys m umnvo;(0 rxnxr3iotom  aues s)s2toxmpoy1ll   fci sfsDumxrono1altomoeiatfmDemnvo;(0 etrmrctatlp eai ilt0s2to(opnodoptemfctls  Drru pou1aeen fctydfsDrm(vo;u4trxoir oo1fmtrln s;t0seuriopoodole mfet t)arrrxm no4aet ifcilsls emumpnt4aetrifciytomDe u s;t0setr(o3ny1ole lnviasfa2rax pnu0aex iietltfm uanvs;t)tltnir3ta1fa  ai o;(0s2uoxopnodale lnviatf Dtrum ;u4apt  fctysfs2ulnvp;t0arerxo3oa1oateln i;t)trumxm nydoptelfcilt  rrrxrpnu0tlx  icildlmDelnvs u0 lxomf3to1lat lnvs ( s2umxr3nydaptnlfvta(fa2taxrp;o1opxnmociad a2ranmo;u0arxrio3iy1lmtelivs;() etmiopoydlmt  fvtas  rua(rono0oex mociydfaDulumpn(4 eeomr3oa1omDeluvi ()trxrxmpiy1lp n ivi s) rtrurooo0tlxn i3iydfmDemnmonu0aeerxfciadlm  li s;(0 rtrxr3oy1am emivi tfsrtr(  ;t0aptnmi3tysfm rlnmsnu4tlxrxo3iadla  ai o s tetmimpoo1oltemieias s2taxmo;o4ole ifetysfa ranvs;t4artrxrcoo1fa  aivi s t2urxm oy1llen icta(  ruax  nu0tex  ietad a rm( p t)teenirctytlm e ieo (0tetrir nodolenmfeiat  Durxmo;u0tptoifctls m2rl(mo;t0areoir3iytfm rli ol()tetmirpnudaleemncsat s2ta(rooo1oexnmi3tyt s el(monu4arxnxo todopt  uvo;s) 2toxr io1omtelfctl(  2raum ;t4tleoiiciasfsDra(vonu) lxnxr3ootfm eanvs;t0 euo(o io4llt  icilsf 2rau  nt4tee ioeiat s2umnvp u)trermfciatomtraivil(0texmir3oo4apeemicsas)arua(rono0aleo feiad a2rmu s u4 eenxo3iotfaDeln s (0 2xoir3io1ap   iet ()arrr(ro;o1olxo ictydlm ulnms;u0tlxrio oo1lmD livi (0trtmxmpoo1op   icsa()arurxrp;t4tet io3ilsls2el(ms t4aeenxrciytopt ai olt) rxmxopoudameemnctltfartaum ot0ale iiciydla umumo;t4 lerircoatoa  aies s0t2xm(r3nu1optn icia() 2rax pno4tpxomoeiadlmDemnmo;u4 lxoir3iatlm  au i;s  2trir3io1ap nmnvslt arta(r ot1tex mo3tys mDeau pnt0trermfcoadfpt au i ()setr(m nu1op elfeslsfarta(ront0altoioctlsfa rlu sn(4 eeomo3oodoate ueo;t  2toirpoydaptemietlsf 2uru ono0oee ioetyd s ra(vs;u4 reoxr3io1om rlivol(0s2xmxopoy1ome mfcil(f 2uaxmpno0tltnmictldlaDul( p (4aeerxf iotopteaivs () etoim iudll  mnciatf Drrxmpoo4aptomiciatlm2ea(mpn(0aexoxrcoo1fm elnes;s trxmxm3iy4alt  iei sf 2uru o;o1oet  ietlsfm rm(mo t0teerir3iydlatrluvilt0srxo(opoo1om  mfvs () Durur nu0oleoifeiat m2rluvs;(4 eerxoctytom r nes ()trtr(r3oo4lmeemfeslt)aDuaumoou0tpenmo3ildls rmuvo t4 etnmf tatlmte ivolt  rxm(m3no4lp  mfcsat aDrr(  oo4tpxo fetyd s emn o;() lenxf3iydomt ln i (0t2toir3io4ap e fcias)sDrm(m ;t1teenmoeiltlm elu snt0arermo oodfp ran slt seuoxo3nu1oltnmfesls) rtmxmo;t4apxomoctas mDrlu pn(4 etnxrcty1omD liei t0setm(m iydapeemfvtlt)aDrm(mp;t1texo i3iadlm uaump u)alxrxo oodom   ivs s s2xmxo nodal   ici s) Dra( ooo0opeo ociys a2ran s;t4aetrio3ootlm eaies t  rtr(mpoo1alen ietltfa2rrumono0oetnif3iydfsDrm( s u) lxrif oodfmtrlnvo;t0 2ur(r3ou4llte nvtlsfaDrrx  no4tpx mfeias mDem(vp;(0 eenxo3io1om e neo;s)s2uoir ou4amtemfcilt)aDta(  no4alxn feils s em(ms u) reomf tytomtrauvilt) 2xr(rpny4lleelnvia( sDraxr ;t1tex iictatls uauvpnu0tlxnio3iotlm r iesls)srxrxrpiodolenmnvsls) Dtr(rp;t4oltnmiciytls umuvp;(4 renxrcio1fpD luvo s)teumimpno4ll n neia()srrau o;u1tetnmoetat s emn s;(0artoxf3tytlp   ueols s2toim3nodop nlnvs s artrxmpoo0tpe moeild aDuaumpn()tlxnxf3oa1lmDelueolt0 2umxr3oy1lm  livs sfarrrum no0ale if3ils s2emnms;u4tltrxr oydoptraivs;s) rtmxm3oy4lptelfcilt arur( p;u0aptoiietltls2rm(mp t) rtnxf iy1oa   n s (0s2uoimpou1ol  livsas)a2rmuro;u1alenio3iatlmDea( s;()aexoxo3todlatrli sls)sexm(m3io1ap  lictl()sDtmu pot4tpt mfciysla eanmpnt)teeoxocto1fpt lnvs t0t2urxrpio1altnmfeia(f 2uaumoot1tetoii3tad mDel(mon(0altnio ta1fpDranvi s) 2toir3nu1lm e ncsat)srraxm ;u0aex iociydlm rlums;t4arxomfcoytlp  ln sl(  2umim io4lme  feiatfsDtru p;o1tlx mfeiatlaDrmnmon(0aeerircoadopD li olt)sexm(rpoy4lptn ivi sfarrmu ono1aexo fetytlm2rm(mont)tlerifciatlp   ivs s  eurxopnydlltelnvtls) Dumx o;t4oexoiocilt sDem( s;()aetoxr oy1opteln il()s2toiopnu4ome lieil() Dua(r ou0aex mfciydfaDeaumo;t)trerxfciodla eauei s0 2xrxmpou1oltn nviat)arur(rpnu1ope mi3iasls umnvo;(0tlerxf tydfa rli ol(  etr(r iudlp n nvsls) 2rrurpoo0apenmoctadfs2um(mp;u4 exomociytfate u ols0 rumiopno4optnlivs t artm(  ;t4tlx  fciys a um(vpn(0altnxoctotlmD lnes;( t2umiopio1lm   iet ()sDrrxm ;u0teto f3tld s emnvon(0trxnir totlpDraivo;(  rxoxm nu4ale lieiat)artrxr no4olt iocildfa2ua(vsnt0 etoxr3oatla  ai il( s2toxmpnudlmeelivi s s2tmum no0altoifetyd aDrm(vo ()aetnxo tydfateaneolt0trxr(o3iu4opeemiei ( arta(moot4altomo3iadlm emuvp (0alxoxocoy1om rlueslt0s2uo(rpiodll nlnctltfaDurxrpnt1ape ii3tydlm2rl( s (0arxnxr3iotomteau s s  2trxrpoydll emfcils sDuax  oo4opx  oeils m elnmon(0 etrxr3oatlaDr n sls) euo(r3no4omeelict s s2rau pnt1tpto ieildfaDum(mon() exnifciy1lmteln s t)t2xm(m oodoptemnes ( s2trur oo1apt  i3tlslmDrlnmo t)altrmr iodoptelnvs s) rxrxr ny4opeelncsa()a2rm(mo;t4oleoifeiaslaDumump;(4 ltrxr oytfmtelu i;(0srxmirpno4lptemivslt aDrmump;t4alx mo3iaslmDemnmont)altnxo3oodlp elnvols s2uoxm3ny4olenlfvsltfartmur ot4tpxomfciadlsDra(vs u) eeomr oy1oateaivi t s2urir3iu4op nmnviatfaDuau  ot0aexn i3ilslm rln p t0 eenmr3oodoat ln o;t setmio3no4amtn fviatfa2uaum ot0tlxomfctadls um(mon(4 rtnmo3oadla rluvi;s0teurirpiydlpt lnvt (fa2raxmpoo4tltomocilsla rm( snu4tetoxoctadfaD  iei () 2toxmpnydamt mncilsf 2um(  ou0aex  iciat s eluvo;t4alenxfcio1oat lueo;()t2ur(m3ou4ll n netlt  2urum nt1altoif3iad mDulu p;t4 leomociadla elneolt) ruoxopoudom nmieslsfsrtmum oo1olt mociyd sDuau pnu) ltnxo3oytlp rlnvslt srxm(mpoydll   icilt)aDrrxr no4tltn ocild m2elnmsn()tleomf3io1oaDe uvs s0teuoimpny1amt lfeia( aDuaxrp;u1aleoiietadfm ran p t0altnir tadlp elivo s) ruo(opiydll elicia(  rrm(m nu1tpxomieiltfsDea(ms;t0aeeoirciytoat lnvs ()srtr(o nudlptelfct sfs2trur oo1teeomfctad a emnvont4 reoir iy1latrluvil() 2xmxo3nodol e fctlt aDtmurpnu4olt ii3iaslaDulnmsnu0 ltnxr to1lmDeanvs ()trxmiopoy1lpe  fesas)sDtrumpou0tleomoctyt aDrlums u0tlxoxrcoatop eaues t texm(m iodam e nvtl(fsrrr(mp;u1aeeomoetad s rl(vsnt)tlxnxf3todoaDe uvils) eur(r iu1lmtnmiesat  Drr( ooo0tpe mi3ildlsDua(vs;u4 eenir tatlmt livs ()s2xr(o3iodomt lfviasfsDurum nt1tetn ieilt s um(vs u4altnxr3oadomDe n sl( t2xoxm3ou4ol nmicils  2urumono1apen iciat a2umnmp (0tlerir3oodomt livo;s) 2toxrpou4apt mncta()aDtr(mp;u0aleo oetat mDemuvp;t0areniociy1lmDean s s0 exr(m3iy1oltnlivi ( a2trxronu4oex mfciysla emumo t)tltoxrcootfptr u i;()teuoim no1lleemfct () 2rmx pnt1alx  feiytlsDumnmo (4artoifciydomDraueils0 rtoirpio4lp e ietat)aDta(rp;t4tetnio3iysfaDemnms (4alenxocoatla rauvo ( sruo(o nu1lptn fetas)aruaxroot4tleo i3iltlaDran on(4 etoxoctatoateaieo t texrir oy4lle livsasfsrumxmpoo1tlto octyslm2ea(vp (0 rxrio oodlptrauesl() 2toiopny1lmenlfvi ( srumx  ;t0apxo feiasfaDelnmp;u0trxrirciadlpD  nvs;t0setmim ou4om nlnct t  2tmxrpnt0aetomieiydfsDrl(mont4tetoif3ta1fmD  n o;t0seuoiopoo1lpt mfvsat  2rm(r ou0tpeoioctadfa rmnmpnt)texnxr iytoaD  ivi t0 rur(o3io4lp emiesat)srrau p;u1teeo feiasfm umu s;u4trtoir3oydfpDeau o (0texr(o3ny1opee fctlt)arrrxrooo0tex if3iytla2rln s;t0teenmf oatoat an o s t2tmir oy4ll n ivs sf 2um(rp;t1aleniociasfaDemu s u0 ltrxr3totfa r nvsl( srtoio iu4llenmncilsfarurur ;o0tlxomicildlm ulnvon(4texrifciadfp  aivo t s2xoiopoo1ol n ncsltfs2trxrpoo0ope iiciysfa ua(mp;t0 rerir3tadfmD lnvo t sexo(r iy4ap nlivs ( srtaum nt4teeomo3ild m2rluvo;t)arxrio3tytlmDeaivs;t  rum(r3nu1openlfeilt)s2tmx poo0aexnmi3ils mDem( p t0 exoxr3ty1fpD  u i;(  eurxm nu4lptnmieias)srur(rpnu4tex io3iasfs2rmnvs t)trtnmr3oytlpD lnvilt0sruoxo3iu4ome  ivtatfa2rrx  nt0aetniictls s2rau s;t4aeenxo ta1fpDeau s t  rtoxrpio4op nlfcs s arraurono1aex mo3iltfs2emu o t0 eenxr3tatfaDrlivol( srxo(mpiodopteliesatfsrtrx o;t4tee moetlsfa emnvo u4tlxoifcto1fm   u o;(0 rxm(m3nu1omtnlfcil(faDta(m ;u1olto ieiat a2eau o;u) lermfcoodoatrlu i;()teumirpiu1al  lfvs tf Dua(m ot0aetomietlt m elumont4teeoifctydoatraneslt) etr(mpiy4opeemics s  Dtrur oo1aexoio3tldfmDeauvs t)trxoio3tydomtrln s;s)t2urxm3io4lmt  ncil() rtrxmont1aeeo ictyt m umnmo;u4alxomf3iadlp  ai i;() rxrio oo4al emfeilsf rrrx oot1olxn o3tls a2rm(vp;u) etomo3iydlatelnvi t) rumxr no1apeeliciasfs2rruroot0olxomieild s umnms;u0aeenmr oydlpD ln i;t0s2xo(r iu1lm elieia() Dum( p;t4olx ifetlt s eauvs ()tetnxo oodfmDe u i s)truoxr3oo1altnlfetat) 2ra(mp;t0tpx  f3iytfa umump;t0tlxrmrcoy1opDe n s;s) 2ur(o iu1amt mieils aDraxrpou1tpenmieias sDra( o t) exoxf3ta1la r ivi;( seuo(m iy1alt mici ()s2urx o;o1opxomfciyd mDea(mp (4 rxnxocootla ran s t seurxo io1alt  fei s)arraum ou0optomfeiat sDulnmpnt4aeeoif tydfpt liei t)texmxrpnydop   fvils)aDrm( o;o1optomf3tas s um( pn() ltomrcta1fpt au o;t0 rxrxr oydameelivt s) rraxmo;t4olxoifctltla rmu pnu4altrmrcoy1lmteluvi;( texoirpno4om elnvs () Duru poo1aetn fctadlm2ranvonu0tetnmocoadlp rlnes t tetmirpiu1lleemiviat) Dtmumpot0aetnii3tatlaDrlumo ()aetrxo3oadlm  an o s0seumimpio1olee netlt)s2trxmoot1aptnmicildls2ra( p (0 exnif3oa1fmteaneo ()s2xrimpiydameemieil(fartr( p;u1oltnmoctad a el(mp ()aeerxr tydfp r iesl(0 eurirpny1am  lneilt  Drmu  no4oee  ieiat s2eanmo;t)trxomr ia1laDeaneslt t2umio3nu1op n fcsa() 2trxmpoo1apx ii3iasfm rm(vs;u4 rtniocoy1laDr i s ( sexmio iydapt  nei (f Drau oot0tptomi3ils a umn ont4aeerif3oodlaDr uvslt tetrio io1amenlicia() Drmurooo1oexnio3iad s emn s;t0arxrir to1fptraneo;s)t2xoim ny4apt mnctatfsDumu onu4aetoifeildfaDrlnvo u0texrxf3iatfaDeaivo s0s2xoiopoydapt  fviltfa2rm( p;t4texomfciydlmDum(vp;u)aeenxo oatlpDeli ils0 etoir3nu4ale  fcil(fsrumx ono1oetn fctltfm2em(msnu)teeomr oo1lpDeluei;s0 rtoxr3oo4lpt livtat)arrruroou0tlx if3ild aDemumo (4 lxoxfcto1lpte ueol(  exr(mpnodap nmivilsfaDra(m ou0aet mociatlmDum(vonu)trtoif tatfp r ies;s srxoir3nydaltemicsl(fsrrrumont1oet mi3iyt m2rl( s;t)aetomoctytfm eli o;t)s2xo(mpou1op nmneta(faDrr(rono0oetoiociyt m ul(mp (0alxoxf3iy1oa rlues (0setoxm io4lmtelfvtls)arrrxm ;u0tptoiiciytls2eanms;(4arenmf3iy1fp rau o s s2uoirpoo1optelfviat  Duru pno4aleomiciatfm eln pnu0 ltnmf tatlaD au s t)t2tmir iu4lpeelfvt t)sDraxmo;t0alxoifeiydfa elumont4 exrif oydlmt  u s;(0t2uoio nu4ll  mncta()sDurxrpnt4optn ieiydfaDemnvo u)trtnir3iodfm ean s (  rtmimpnu4olt  fctatfs2rmur nt0aleomfctyt aDemumo t0alxrioctodoat  i s;s)t2xoio3oo1omtemnesas  rtm( p;t1alxnif3tysfa2uanms u4trxriocto1omt aivs s s2urxmpoo4am  mivilt  2umx ont4olt iociasfa2rmuvp;u)tetomrctodomDe iei ( s2tr(o3oo1om nmnei ()srrmxr ot4ole iocildlsDuluvo (4alxomocio1fm e nvi;t s2to(r3no1al  mfes s  2rrump;u0oetn o3tyd s2eauvsnt4 rxomfcto1fpD  n ilt) 2toim3iodll  mfci (fartmu pnu4tpe iietld s2ul(vp t0alxoircty1fat  ivils) 2xm(o3oydlm e nvsat) rraxrooo0aexoioeiydfs rlnms;t0 rxoircootfaD luesls0setmio3io4lp nlfct ()a2rm(rpnt0oexnif3tlt aDulnmsnu4 eeoifciydfpD ai i t) euo(m oo4om n ictls  Drru  oo1apxomicias sDra(monu4tlerxo oadlptrlueol(0t2xm(rpou4optemiet s)srurx p;u4opt moeiadlaDeanmsnt0 exoxr3oadfmt lu i s)t2ur(r3ny1lmtelfct s  Dtrxmo;t4alxn f3ilsls2um(ms u0artrifcoa1oat au o;t0trurxrpnudamen ivtlt)srrm( pno4aexoif3tad mDumnmonu0aleoxociydfatelu o;(0 2xr(m3io4amee netltf 2rmu p;t0aeenmoeilsfm ulump t) eeoxr ty1oaD aivo;( s2xrxm ou1olen ivi (fsDuau pno1tltomocilt m ea(vpn(0trtrif totopte ivs;t0seurimpno4optnmivtltfsrraurpnt0tex  octldfmDra( o u0 eenmf3iytlpDrlu olt0t2toxrpio1om  mivi s arrrumo;o0alxnif3iydlm2ranms u4tltrxrcoytfpt aivs (0setr(rpiy4apt mieiat)sDumu pnt1tpx  i3ias m2rmuvo t) lermfcoadfate nvils0s2umxrpny1lle  nesltf Drmuroot4aeeomfctat sDrauvs u0 etrio3oy1lpDeaivo t)t2xm(rpnydop  mfct t)s2uaum nu4teen ietltfs em(vsnt)trxoxf3tadfaD lnvils)t2xmxm3iydomen nvtl( s2ua( pnt4tlx iiciat m ul(mp;u4altnifciy1lmDr ieo t srtmio iudamt  iciasf 2rr( ont1opx  ocildlm ua(vp;t)aexnxr3ia1om elu o;(0 exoir3nodlm elivtat aDra(rpot4olt iietatlaDrl(vs;(0tetomoctatfa rlies t)trxm(rpiu1lm elfvia() Dumx p;t4tet ifetatla2rm( snt0alermr3oydlp e i ols  exrio3oodoltelneta(  Durxmono1oexn f3iydls ulnvs;(0arxrxrctotfat  ueol(0s2xrxm ou1omtn fvtls  rurumono0oexn icild mDra(vs;t0alxoiocoytoatraneils0tetrxm oudll nmfei ( srraurono4oee ii3ildla uau p t4aleomr3iytlp  lu sls0trtriopiydlleemfctatfsDur( oou1apenioetys s um(vsnt)alenxf to1fpt lieo (  eur(rpoy1lmenlivils a2umur oo0aex iiciyt m ulnvo;u4tleomf todomteai il() rxo(o3no4ole lncslt  ruaumoot0tlto o3iat m rmn p u)teerxr3ia1omt ln s t) exr(mpnu4ope lfvia( srrmxrooo0tex mociysfs2rauvo;u4 rxrmr3oa1lpt lu s;t) 2xr(mpoo4om nmivtl(fs2ur(mp;o4tlt moctltfa rmnvp t4 ltnmr3iadoat luvi s  exoiopiu1lmtn feil(fs2rm(m nt4aee ioeilt sDuln o (0tlxnxocoatfpDrlivs;t0 2tm(r io4amtemicsa()srtrxm ou0alt mfctldfs2eanvp u4alxomr totfa raues (  rxrxo no4lpenmfvsatfsDrrx  ot0oetn octlt a2eanvs;t4 rtnio oydfmD  u i;s) eto(r3ou4ame  icta(f rtm(root4oexniicilt m emnmonu0 lxoxo oo1la eaues;s0trurxm iu4oltn fci t)a2uau pnu0tetomi3iytfa emn o;t)teerxf3oatoat an i s0truoir nu4optnlfvils)a2ur(monu1alx mi3tys m2uanvpnu)alxnxf3to1op e uvols0trtrxm io4oltnlnvil(  2ra(ro;o0aleo oetydlm rluvp;u4 ltnir3iotopDeanvs t  2tmxo3ou4lp elfvi (faDrmxr ot1ope  o3iad mDum( s;t) lxomo iotla  aueol( s2xrxr oy1lpe mieil( aDra(mono1optnmfeiaslm2emumpnu0arerxf3iadlpteaueils) eto(opiy1am  mfci t  2tmuroou0alxomicild s2eauvo u4alermfciotlpte ivil()t2urim3nodlm elivtlt sDrm(mpot0oexnioeiltfa2eanvonu)arxnxf iotfp   nvilt0trtr(m3iudlmtnlfetatfaDtmuro;t1alxoiieiadla el(vpnu0aetrxf ty1lpD  uvilt)texrxm oo1lptn ivtasfaDumu oot4tpen oeildlaDuaump;u4 rerir iadoa   neo;s) 2to(opiu1lpenlneias) 2umu ont0opxo feiyd s ulnmp;t4areoxf ootoa r n o t)trxrimpiydop n ncs (fartaxmpou1tpx moetldlm eluvp u)alenxr3to1fpD aivs s0trtmio nodal  lieilt  2taumpou0tpto oeiyd s2umumpn(4tlenmf ia1oaDelu s;() etmxm nudll e fvt (  rra( ono0tleomietlsla rlnmsnt4aetrxo3ta1op rai o t truoir3iudlpt  ncils sDtmxronu1teeo fciytfs rm(mp;()aeeoir iydom rlnesls0trtm(mpnodlmenlfctat s2umu poo4oet mictltfm rlu o;u4tltnio3oodfp eanei s0t2uo(o3iudlpenlivtat  Dum(r ;u4altn ieiasfaDuau p () ltnxr3ia1fpteanes ()t2umio oy1op nlnctlsf Dtrumonu4olxoiociasfm2uanvont4 lenif tydfa  lneilt0 2toimpoo4op  lfvtasfsDrmur oo4teto oetasfmDumnms;u)aeenmr ta1lmtr uvi;()srxrxm3no4lptemnct tf rurum oo0oex mieiasls2rmump;()aexoxo tytom  ai s;(  2umir3oodaltelfctls a2tmu p;o0alxnmietysls2rlump;t)tltrio iydlmt auvo (  2toxr iu4llenmfcsa(f 2umur ot1tee  oetys a emums;(4 ltoir ootfaDe n i ()setm(o3nu1lmtnmfcia(  Drm(mont4teeomi3ild mDul(vo t4arenxr to1oat  n o;()t2xmxm3ny4lleelfvt t)s2urxmooo4aeen i3tys m2um( pn(0altoxo ty1faD  nes s0setr(r3oo4al  mieia(f rtau ono4aleomo3tytlaDua(ms u)arermf3totfm r uvilt) 2xm(r iodlp e nctl(fs2urumpoo0aeen i3iasfmDrmnvs u)tetrif3oatfm eln s;() eto(m3oodamte ict ()aDtmum ou0opeoif3tasfa2emnmsnu0 lxrif3to1lpD aivolt)srumim io1lm n fetlsf Draur ;t1alxo ociaslm uluvsnt0aetrxo3io1fpDeanvol(  2urxr3io4olt livt (fsrtau pnu1oeeo f3iytfa2rmnmo;(0tltrio tadfmD luvil( srto(r3oy1op nlietl( s2uax p;o4openiieildfs2eanvs;u0arxnmociatfm  lues;( s2trirpio4ame mics s sDtmx  no1tltn oeiysfs ua(vo;u0 rxoxociotfaDeai ol( srtoxopiu1lpen fcilt  Drrxr nu0oltomi3iytls emuvp ()arenmf oa1om raivi;t t2urxo iodol  livias  2rrur ;u4aex ioeiat sDran o;t0alenmo3iadlatraies (0srxr(o oudll  mnetlt)sDtr(mo;t1aleo o3tlt m2ulnvs ()trxoxf io1lmD auvo t) exoio nodllt  fvt ( s2rm(mo;t0tpt io3tasfm2ua(mo;(0arxoxf iadopD lu ilt0sruoxr3iudom elfvsa(faDtmurpoo1oetomi3ildlmDeaumo;t4aetoxrciadfpt aiei;s s2uoxr oydlmeemfeiat) rum( onu4open feiaslsDul( o t) rerxo3iytop  aiei s0s2xoim oudaltn ivsl()aruaxr ;o4oeeo icils m umu o;u4teenxocootlp e n sl()truoxm iy4lm nmfcil(  Drax  ;o0apenmi3ils aDulumpn(0 etoiociy1op e i o s t2xm(mpnu4omenlfesl()arraum oo1tet  f3ildla2um(mp (0aetoxr to1opDeai sl( teur(m3oodlmen net tfaDum(ro;o0olt if3iysla emu on(4artoiocoy1fa   n i;t)s2uoim3nodaptelivt t)aruaumpno0opxo i3tydla2emuvo;()altnirctydfm e neo;s0 rum(m oydlpe mnet s) Drrxrpoo4teeomf3iaslsDelu p;t0 ltnxo oytlaDraues;s srxrio iy4amtelfeilt)aDur(mo;o1apxnio3iaslm em( s;t)aetniocoatfmDeauvi;s)srtrir iu1ap nlncsatfarur(rooo0aex mfciasfsDran s;t4 renif iatla ran ols0seuoxm3no4omtnlfvsl( arururo;t1tee mi3tytfaDulnvs u0 lenxrcoytfmDrluvs (0 etoxr3no1om n ncsasf 2ta(rpot4opt  fetad s rlu onu4tlxoifctatom  auvs;s  eumirpoo1ape  ieia(f 2ra(m no0ape  i3ildfa eanvpnt)tlxrif to1oa  ln s ()s2xmio3ou1op   neiltf rrrxmp;t4tee mocias mDulnmo;u4tlxoxfcoytopDelueo t teuoxm3ou4op n fet tfsrraurpot1aexo ociys mDra(ms t0 ltnxo3iotlm eaieils  rurim iu1ame lici s) Dra(m nt4tet  fetlsla2ea(vont0tetnxocia1fp  anvs s)trumim3oodlpe  ieta(f rur(mooo4alto feildlm2ua( pnu4aetrxociodomtranvol( t2umim3nydam  lfvsatfsDrax  ot4open i3tad s um(vsnt0trxrxrciydfa r ieslt t2ur(o3oodoltelfetlt)aDtrxm ou1apeomfciadfs ra(mo t4 etrifciodom e u ols) rtoio3nodopte iciasfsrurx  ot0texo ictydfs2emu s ()arermr iadlpDrln ilt t2xmxopno1lleemfctat a2raxro;o0opx  ocias m2rauvpnt)texrxf oytlptraiei;t)trtoxm io4ap e fcsl(  Drr(rono4tlenmieiltfmDrm( o;(0trerio3tadlateaieo s0 rtmio io4olt mfvi t)aDtru oou0apto ietltlsDuaumo t0altrmo iodfm rlnei;t0teurxopoo1alt mnesls)srrr(r no0oet mfciat s rau s () etoir3oa1lm e neslt0t2xmio3iodaltelnesl()aDtru p;t0teeo f3iytla elumo;u)aetoxf3iydfp eauvo;s0 2uoxo3nu4omen nvilt)s2ururont4apt  fctadlm2uanvs;u0aexoifciydfpt auesls0teuo(o ou1lpee feiasfsrumxmpou1olt  oeias m rmuvont) rxnxf3tydopDeaueols)t2umxm oodlmen nviat) Drmur oo4tet mfeilt a2uluvp u4tlxrmf oo1om e ivo t)sruoim nu1llen ietl(f rraxmo;u0tltnmo3tld a2ulu on(4arxrifciy1fm  li i;t)tetoxo3oo1amtemncta()sDurumpoo4openifeiadfs2rmnvsnu4 exrircia1fp rlu sls0 2xr(rpnodlptn fctltf Durx pot4altnmfcias sDea(von() exrxr3totlpt  neils)s2tmir oo4op n neia(farrr(mp;t0tlt  f3tlt aDua( pnt)trtnif oo1lptrlu i s)s2xoio no1lmtn ivi ( aDumxrp;u0alxoii3iasfsDrm(vs;(0 ltoio ootoat li o ( trum(rpiydll  lics ()s2umuroou1tlt mfcias m eauvo;t0 ltnir3oodlat lu il()tetmxr3oy1ol nmfcsas)s2rrum ou1tptomictytla ul( on(0alenxf3oy1opDeluvol( seuoim ou1omenmfcta( a2urx o;o4opt mictltla elu snt4alenifcio1fm   i s;(0 rtmio oudopte fei s  rtm(m oo1aleomfcilsls2emnmpnt0arenio tadla r ieilt) ruoxo nodomeemnvt tfsrrrxmont0olx  o3ilsfs emn onu0teermf ta1oaDeanvs (0setrxo iodal e ncsatfaDum(r ot1aleoiieiltfa2rluvp t4tetrif3totfpD ln ils)srurio ny4ll   ieils)sDum( p;o4tlxn feilt aDemuvp;u4trxoxrcoydlpteluvs ( t2tm(m ny1llt lnvilsfa2rr(  ot0aptomfetld sDel( s t4 exrmf tydlm rliei;()texm(m3ou1opte nvsl( sDurx o;t4optoiicilslmDem(vs;u)altomr ootlpDr iei;t0t2xo(opoy4alt  fvtlt)a2raxmp;u4aptomoetlslm rl( o u0 ltnxo3ootoateanvolt)trxmirpiydaptelnvsa()sDtm(m ot0oltnifciasla emn pn()tltoxo iadlpt lnes () 2tm(m3no1llenmnesl(f rta(rooo0tex mfctad mDumump;u0arenmf3tadlmteau o;t0 rxrxr3nydapenmnciatfsDtmur ;o0opxomfetaslmDrmuvp () rxrif ta1fpteaieo;s)t2trir3ny4omtn ncs (fsDum(r no1tptnmi3iysfs ul(mo (0alxoio3iodoa rluei;t s2um(o3iodlm emnct sf 2ua(m ;o0oltoioetls aDrmu p;(4tltnifcoytlpDraieslt)trtoimpiy1llt mfciltfsDumxrono1apxn f3iltla ul( o (4aeeoirciotlate ieols t2toir oy1lptn fvtltfs2taxmpnu0aetniietat sDran sn(0aeerircootoaDrau s;( seur(m3no1ap  lictl(f 2rm(r ;u4aee mf3iyd s em(ms t4 ltrmo3totfptr nvo ( texoxr iudomenmictasf 2tmuro;t4ope mi3tls aDumump;u) eenmoctytopDrau i;t) 2tr(opiy1optn ieilsf 2urxronu4oet  f3iadfs2ul(vp t)artrxocoydfmteau ols texo(opiodaltnlfcilt)arta(m ot0olto ocilsfaDuanmo;t0tleoxociodlpDraueo;s)t2tmxopnydop  lneias  Drr( onu0olt  oeiad m2umuvp u4alermfcoodop  ai s (0setrxm3iu1ll emnetat a2raumono4tlxo o3iadfmDul(msn()trtnxr3oodfptr i sl()setrimpnydlpeelncils) rrmxmp;t4tlenmf3tad a2ranmpnu4 reriocoadomD livo;s0trumxo3iu4lmt mivias a2umump;o0texn o3tlt s2el(ms;()trerif3tytfaDelueo s0srtrxopiu1lmeelneta()sDtr(  ;o0texnmf3tydfa elnvon(4tlenif tatomteln s s0trxr(r3oy4ap emfci (f Drmx  nt4alt ii3ias sDrln o (4trxoir3iytoa e neo;() 2xmxm3iudlpeemies tfs2rrxm nu0olx mf3iltls rm(vs;t0 rerxfctydomDrlu i;(  etrxm no4ol elfvsas aDtmu ono0tlt moetaslm emn sn() ltnio iydlpteluvols seurxm nodlp elncia(  Drmumonu4tptnmfcild m2rlu p;(0trtrio3ia1fmD lnvols0 exrxo oodoleemfeilt)a2ua(rp;o4tpx  oeilt sDel( o u4aexnxo io1fat aueslt0s2urxopio1llenlfeiat a2tr(mooo1opxn ociatlm emuvo;u0aeeomr oydla eln i (  2tmir3iy4llenmnciasfs2ua( ont4tlx if3iys a ulu o (0tlxoirctatopDraieo ()trto(o nudlmtnlictlsfs2ua(mpoo1alx mi3iyd m2rm(ms () rxoir3ta1omt aneilt)t2xo(m3oodll nliesat)a2tr( onu1oleo octad s ulumpn()tlxrmr io1oa raivils s2uo(m3iy4om e iet t) ruaur nt0oex  fctatfs ulnvs (0 renxr todfateln o ()t2uoiopoydolen ics tfaDum( ooo0alxomf3iad aDrmnms t) etoxo ia1omte nvsls  2to(o3ou1op emfvslt)s2taumpou4aptn o3tys m2ra( p;t4tlxoiocoydfmte uvilt)trurir3ny4oltnmfes t  Drm(mp;t4olxn i3ilslm2rlnvp;t4teenmf3tadoaDrlieo s s2xm(mpny1ol elnesas) rtauro;t1alt mi3tasls2umn o t)aleomocoatfp rln o;(0tetmxr ny4ap  miesa( s2rr(m no4aeenmfetatls2umu snu4texnxo ty1fpDe uvo;s0 rxrxo no4lle mnei s  rraxmo;t1ape mf3tasfaDra( snu0trermocoy1op  auvo s  2xmxrpno1al  licil(f 2umxm oo4oee  iciysfmDel(mp;t)trenif ta1fpDeanes;( trurim oudalt  fvi ()srraur oo1tptn feilsfsDumu pn(4artnir3oydlptranei t0 exoxmpiy1ome mivia()srrrx onu4aleniieilt m um( s;u0 eenxf oa1opD lieolt0 ruriopny1lp   fvt ( aDurxm nt4aet mfeiadfs2eluvs t)tleoif3ta1fmDrli olt0s2tmxm3io1llt  fci ()s2rauroou4oexnifeils mDra( p ()tlxoiocta1faDe ivi s seuo(opiudomtelfeils)aDumxmpoo1oex  ieiatla2rl(vo u4 etnif to1lm  aivs (0srurir3iy1alt lnvs s  rururpnt0alx mictytla eanmpnu4tlxnxo3io1lp rai o;(0srto(r3iy1omenlieia() rrrxmooo4oltniociat a2rm( p;u)trtrir iotfatr nes;()srtoiopio4lpe liet s)sDtr( pnu1oeeomf3ils aDem(vp;t4artoxf ty1op  lnvi;t  2uoim3oo1ol nmivt s aDtmxm nt1altnifcilt a2rm( p;(0texnxfctadlat livs s srtoxo3oo1lltn feils a2rrx  ot4apenmiciadla2el(vo (0 rxnxr3todfm  lnvs t sexrir3nodoptemiciasfaDtau pno4alxoif3iad s2rlumsn(0texniocoo1faDean s s t2tm(opnudolenliei s  Draxmp;u4aet  feiydfa rln sn()tltomf tytla rln s;() rur(mpno4aleemictatfaDrrx  nt4teeo icild m2el(mo;u0 ltoxf tatfpt  uvo;t0texoir3io1amee icia()arua(  ot0aeeo f3ilsls2rlu o u0altrxfcio1fmD  ivi;()s2tm(m iu4lltn iei ( sruaxm nu0altnmf3iad m uanvs;t4 rxrmo oy1lmDr uvo t)t2xoxm3oudamen fviatfsruaxmont4opto f3ild a2rmnvont0 leoio iadlmt  uvilt)tetr(o3no4opt lnvilt)arurxmont1oeenmi3iydfa umumo;t4tltrmo iydlaDean sls)srumxr3iodlm elfcs s)a2rm(r nt4tltnmf3iat m2emnmo;()arxrio3tytop ran ols)trto(o3ou4olenmnci t a2uau onu4tpeniietysfmDrm(mont0 rxoif ta1latelueslt t2xo(m io1aleelfeils)sDtm(r ou0alx ioeilt m rm(mo;(4tltomo3oy1fpt  u slt)setmxr nudomen ivi s  Dtmx o;u1aexnmoeilt s2rl(vs;() rxnifciadfmtrai slt) eumirpoy1amt  netltfsDuauro;t4tlt iictldls2ul( pnu4altriociytlm rlieo t  euo(r ou4ol emietlsfs2tmx  ;t4texoio3ias a raumsn()teenmr3to1lm e n ol()s2umxr iu4al nmics sfa2tmu ooo0tpe  iciad mDrmnmsn(4arxriocootlm eln sl()trxmir iydomenlivtls)aDua(r ;o0tlxnmictldlsDranmo t4tetnmo iotoa e u ol(0t2xoxo3nodomtemicia() Dtmu p;u1tpxn oetat m uluvp;u)aeeriociadfatean o;s) 2xoxm3no1alt lici ( artaxmono0opx  oeildlmDelums ()artnxrctadoa rauvolt  etoxrpnodolenlncsas)arrmxr ;o0tpto ieias a2ua(vpn(0 exoxr iytop eaivs () ruoimpio4oleemfet (f 2umx oou4aexnmf3tyd aDrmu o;u0 exomociydlmt  u s s)trtm(m iu4apt mfvsa() Dtaxr no0tet iietydfs2ulnvs;t4 etrio3to1omDrai o ( trumxm3oy4op e ici ()srrm(r nu1tex  octytfm uau s;t) rxoir3tytoateluvs;t)seurxmpio1alenmici ( a2uaxmo;u4ale moeiytfa elump t0 rxrxr3iy1optrlnvo s0setoim iy1amte icsltfs2tm( p;t0teen fetat mDrmu pnu4aeermf3tydoaDrlnvo t0s2ur(r oodoleemnctlt aDumxroot4oltomo3ils mDrlumpn(4aexnircto1op  luvi;(  rum(opoydap  lnvtls arua(mo;u4oleo iciydfa emnmo (4altomf tatop ranvs;(0t2toim3oudlleelicia()a2ra(r oo0tpxn fctadfmDemn snt4aexoio oadfaDelieo;s srxmir oo4lptn fvias s2trxrono0aexniietld m2rauvonu)aexoxo oa1omt an o;s0truriopnydlltnmnesl( a2uaxrpno4apeo fcilsfmDrmnmp;(4texomo3iatfa  anes t)texrir3oo4op  lieslt a2ta(  ot1opx if3iltfsDumnmp;(0alxoxr3iadfp   u i;t)s2xr(m nodlp e nei tfsDuaxro;u1aexnmi3tlt a rm(ms;t0 ltnmfcoadfmD aneil( t2urir3ny4aptelics () Dtaumono0ope  f3iydfaDel(vp ()tlenxf tatoaD  i i;t)sexmxm3nodllte nctat) rrau  oo4tpxnmf3tytfm2umumo;(0 rerxr totfa  luvs t)setm(m3oy1lptn nvtlt)srtm(mo;o1olx mi3ils sDumuvonu)tleoiocoa1la elueo s) exr(o oy4lp  lnvsat) rraxm ou1alxniociatlm2ulnms u0tetrio3tydlpDe n o s0 exmxo3nodllenlncilt a2uru o;t1apt  ieiatfa2rlump t)altrmo oo1faDe nvol(0 2uoxm3io1op  mnvs (fs2rr( pot4olt mfeias s umumon(0arxnir oadfat li sls)sexmxr3io4ol nlncsl(fs2ra(  ou1tptomoeias a uluvsn(0 rxnxrctotfaD auvs s0 2triopiydlm  mfctl(  rtaxmono0oeen ociyd s em(mo t) ltrir3iytfmDr nesl(0 2tr(r3oodlpe  ivsls)srtmu  ;t0aeen fciadlm uau snu4aeeomrctadfptrln i (0sruo(m3iodllt  fvilsfsrta(r no1tet  feiydla emn pnu0 lxnxr oy1fm eli s t) 2xrir nydamt  ietls  Durxm ou0oex iietad m2emnvs ()alxoxrctydomDr iei s)srur(opiy1ale lfcsa(farraxronu4apenifcilsfsDumnms t)aexnxfciy1oa ranesl(0 2xr(opny4ll   fvil()aDrr(r ;o1aleoiicils aDrl(monu0 eerxo ty1la eaiei;t trtmxmpiu4llenmfes sf Drrum ;t0oet  fetls a uluvo;(0 etnxr3ty1oa rli s t  etmxr io4ap elivia(fs2taxr oo0tptnii3iltfsDumnvs;(0aexriocoa1op r ieo;s texo(r iodlmenmies ()srtau  ot4opxnmi3tat a2umu o;()tlenif3tydlatranvi;()sexr(rpoo4lmtn iciat) rum(rpnt0aetn o3iyt m ulnmo;t4arerxr ta1optelneslt)trtrxo3oodllen ieiltfsrtmxmooo4tptn oeiatfaDran on(0tlxoiociatfaDrauei;s)sexmim iu1opt lncsl() 2raxront0open i3iad m2ran pnu) eenir3totla e u i;( trto(o nudam emicsas)a2ua(r ;o0apx io3tydlmDrauvsnu4 lxnir3oadlmte ieo;t)trtoxo oo1llte ncs (fsrta( p;u0opxoif3tysls2rl( s (4trxnmo tydfatr ieo t)srxoxo nu4omtnmnvsl()sDua(mpno1teeo ocild m2eau o u4tlenxoctatop r neol(  rur(rpio4ol nmivi t  rtax oot4tetomoetasfm em(vpnu)tltoio iodfaD  n o t0t2xoimpnodap emivi () Duaxrooo1olt ifctltlaDulnmo;t4aexnmo iotfaDe i ilt)srtrxo iu1amtnlieiatfsDur( pnt0ale moeiltls rm(vs;t4 lxnifctydlaD aivi ()t2uoir oudlp  mfvsls  Dtm(  ou0altnmfeiadla ranvs;t)alxnmoctatlp eau s;(0 rxo(opnu1ole  nvi ()aDrmxmp;t0apenii3tltlm rl(ms;()aexrif3oytopt  ivs;(0trtr(m3nu4lm   fetat)sDtrxr no4oeto fcilslmDrauvo t)aetnir3ia1fmtr ueilt  etr(r3ny1ol emiei s) rur( o;o1aee iociltfa rlu o t) lxrmo3iotop eauvo;(0t2xmxr3oo1lptnlfct t sDua(ro;o1ole  f3iatfs2eln p () reoir tytlmDeauvs;(0t2uoio nu4op  lneia()arua(m ot1texomf3ild mDrm( s;(4alxrxfciytoaDe ues;t0trumxm oy4altnmneil( srum(rp;o1tpxnmi3ildfaDua(vpnt)aetrmr3ia1fa r n i;(0 2tm(o3no1altnmies s s2um(mpnu0apen fetytfm2rlumont4teerio tadfaDe uvo t0 ruo(r oodlpt lieslt)s2tm(r ou1tpt mi3tatlaDrm( s;(4tetoxr to1lpD  nes;(  rxmiopou1ol   fctlsf ruaxm oo1oexn fetysfm rmums ()artnxo3iy1lm rlnes;()t2toxm oodlmen ncs t)sDuaurp;u1aptomfeiysfm rlnvpn(4tltnio ta1lm   ivi;( trto(rpnu1ame lfeta(  2tmxrp;o1tle  iciatla2ua(mo;u0trtoxfcoa1lpDrlneo;t0 2xmim3no1altnmicsasf Dtmxm ;t0teenmoeils m2ra(mp (0tltomoctydfaD  ueo t sruoxm3oy1lm n nei sfsrraurooo1optn oeiytfs2ra(mp u4aeermr oadomDeanvo t trurirpiudomeelfvilt) Drax pno1aetn i3iasls2ranvpnt4 eenif3oadfptrlieo t t2urxopno4omtnlfetlt) rtmxrp;t0tpxnmfciydfm rlumo u4trtnxfcoy1latrluvs;s) 2xmiopou4lmtnmfetasfsDtaxm ;o4aexoioeiatfm ra( pn(4 rtrmrciy1la e neols  rur(opno1apt  iei s  rtmurpno0tetnioeiatla eaump;(0texnxr io1fmtean s;() 2umir nodope miviatfsrtmxronu1ale mf3iyslm rmn o;t)tetrio3iy1lptelueilt)trxrir3no1lltnlfctltfs2urxmpou0opto oeiytla2umnmsnu)aleoxf3iydop r uvi t teumxm nu1oleelieta( arrrxm ;t1tlxo fctatlaDrmumo;(0 lerxr3tatoa  aivi;(0s2tmxr io1ol n ictlsfsrrruro;u0olto oeils s2ulnmp u4tleoxf3tydomDr uvo (0s2tmxopoy4omen fcta( s2rm(m nu4aptniocildlm rmnvp u4 rtomrcoo1om eauvolt) 2xmxr ou4opte fci tf Dtm(mo;t1tpx miciytlmDuanms t0trtrxoctadopDeluvsl( tetm(o3oo1alt lnei (farrrxr nt4oetnifctydlm2em( snu)arerif3oydfatrln ol()tetmim no1lp nlfei s a2rruroou4tltnmfetlt aDrmu s;(4alxnxo tytoat aivo (0 rxoir iu4altelieil()aDtrx o;u4tpxniociatlaDrm(mont)artnmo iadfmtrai s;() 2urxm iodape  fesl(fsDtaum ;t0tpxnmoetltla2rauvo;u0 ltrmf3totoptr nvo;t  2xo(r iy4llte nes ( sDraxr nu0tle mfeiydla2raumsnu4 ltrio3io1fp   neolt)s2xmir nu1ap emietlt) rra(ro;t0apt iictldfs2el( ont4tlxoiociydoa eaies t)texr(opoudope  iei (  rurur ou1oeto octldlsDea( onu0tltnirciatop e nvils)setoio3iodol elictl(fsrur(r nu1olxo octls a2rmu s;u0artrmo3oatfpt aies t t2xoxo oy1ole  ics sfaDuax  oo1tlxnifeiydfs2em(msn(0 rtomo3oatlatelu o t) rtmiopnu1alt micsl(faDta( poo1oetniietatla2rl(mo t0 etriociytop eauvil(0 2xr(o io1lpenlnvs sfsDtau  ;u1apx  iciatlmDrmuvp ()texrif oatfat livs;() 2tmxr ou4lmtnmivi t s2ua(rpoo4oexomoetltla2emuvp;u0aetrio3ia1fmte ieo;s  etr(mpoy4al nlicilt s2tmum oo4tlt mo3tldlm uln on()arermf3oa1fm   uvi;s trxo(m3nudomt mnct (  rraumpoo0oexnmfeiasfs ra(vpnt4arerifciatlaD lues;t0 2urxmpno4lm nlnctat) Duaurp;t1oex  ictyslsDemu on()aexomociydlmD au ils)s2xrir3oudopte nvsasfartmumpnt0optn fetasfaDrluvs;t) ltrir3tatla eaies;( tetoio3nudlm nmies ( a2taur ou4tpxoio3iasfmDel(vo;u)teerirciytlmte n o;t)s2tr(m3no1llee ietat a2rr(ront1optniociadfa2ran p;(0arxrxo3iydlat ai i;t0t2urxr oo4al e ivtatfsrraxm ;u1aeto feiyt s eluvp t4 rtomr oydlmDeauei t srtrir3no1lptnmfcsas)s2trumpoo1aetoio3ildfa rm(vo;u)teeoifcoatfptr uvo (0 eurirpoy1ome  ncs t) 2rrump;o0olx mfctatlmDulums;(4tlenmr3iy1lmte neilt0setoirpou1om e fes t  2trur ou1aeto ociatlsDemu s;() rerir tydop eauvsls0t2uo(rpoo4op e feslt aDuaxr nu0aptnifeildlaDum(vs (4teerxrcootfpDelieo;s0trumir nydomtelfesas arrrumo;u0opx  i3ild aDrluvp u0tltnif3tytop   ivo;s  2to(r3iy1llt lfct t)srrm(  ot0oltn fciytfmDemums;()aeenxr oa1lpD  neslt0texmxopny1omtemivi (fsDur(mo;t0tex ioeiat aDrmuvon(4 etnxo3iytop e n o ()sexm(o3iodameemiei t)aDrruronu1opeomiciasla2eanvo;(4arenmo oytfpt li o t)sexoxr3nydaltnmfctls)artm( pnt4aee ifetyslaDrlnvpn(4 eeoxr3ia1fatrlivilt0 2xr(r iudape mfetltfsrtaxrp;o4oetn oetasfaDemuvsnt0 eenxf3iatla ranvs;s0 2um(o nudamee nvs t) rur(rp;u1opeomfeiadlm um(msnt4alxrmfctatlpD aivsl(  exm(m3iy1omeelivsls sDtmxmp;o0tetomfcilt mDumuvo;(4trerxf oodfaD livs ( teur(m3no1alen ieslsfa2trx onu1tpto iciyt aDrau snt) lenmf totlm raneo;s) exmio oydlmtn fvsa(  Drru oot4tpt ifctyt a rm(ms (0 etomr totlm rlnvs;( sexm(o oo4lmtn net s a2rmum ;o0oleoio3iysls2ean o;u0tlxrmf totoaDe ueil( seumxrpny4apenmnetat)srtm(mono1oexnmieiyd m2ranvo;()areoircoodlp  lu s t tetmxo3nydamt mnvsa() 2tmurooo1apeoio3iydlsDum( s;()trenmfcia1oaD  ues;( s2uoirpnodamtn ivsatfs2trx  ot0opxoiociysla em(vs t)treoircoytlate i i;()t2uoxr iy1al   nvias s2rmurp;o4tle mieildla2eanmo;u4trenxr totlatr ieo ()t2uoxr3ny4aleelfcil(f rurxrpoo4apxoif3iat m2uau ont4 lxomr ta1fp eaivs (0setrxrpno4lmen fvsltf rtru pnu4aee  oeiys s uanmp (4treoif3io1lm  lnes t0srxoimpiudame mfctl()arurx oot4tex mociat m2rm( snt)trenirciytfpDelnvo;(0 2xrxm3oudope lict () rtmuroou1tpxomf3iasfs ua(vo t0texoxf oodfpteanvils  2xm(r3no4alt  iesl()aDtmx poo0aeenioetad mDran on(4 rxrxo ootfaDr ivi;t)t2xoiopio4aptemneil(fs2tmumpnt1aexnmieiyd s rln o u4alenxf3oatfmDe uvs;s setr(r3no1ale mivslt arua(rpno1oexnmfciys s2ul( onu0 rtnxr ia1latelueslt s2uoxm io4alt  fcil( srtmu oot1aexoifeildlmDrm(mp;t)aexnifciydfmt anvs;(0 ruoxmpio1ape mivils)s2ta(  no0apt  ociad sDeluvpnt0 etnmf oodla elneo s0sexrxmpny4opt lfvils) rur(mpnt0aeeo i3ils aDrmn o t0tlxrmrcta1fmt aivi;t) rumir ny1lm emics s  rrmu  ot1tet micild mDulumpnu4texnmf oadomD  ivs ()srxmxr io1lm  lfetas arra(mpot4tpeomfcilslsDrln p;u) rtomfciy1fa  anei s0s2xrirpoudlltnmicsat aDrrum nt0tpenmi3iatfs2el(ms;t)teenmfcoa1lpD aueol(  rtoiopiodllenlnvslt) Dtrxr ot4ope mo3iydla2ulums;u)tltrmr3ia1om raueils t2xmir3oudlmte fciatfsrraumpnt1tet ioctysls2rm(msnu0artrif3iy1lmtranvsls0s2to(o3no1llte nvs () 2tr(ro;o4texn o3ild mDrauvs t)tltrio ty1lm  li slt0 etoxm3nu4ll nlfvias  Drr( oou0oeeoiieiyt m rl( s;(0aleomo3ty1opDr n s (0truoir oo1olenlnetas s2umum oo0aptn f3ilt m uan on(0aexrmo3tytopteaiei s0trxoxo3oudlp n fei (faDrmump;o1texnii3tasfm emu snu4altomf iotoaDeliesls seum(rpoy4alen ivias aDta(rpno0teeoiiciadfsDean pn(4 rermoctydfat  i i s)sruoio no1lm emnvs (f Dumu oou4alxoiiciltls elnvpnt0tlxrir3ia1fpDe ivi t trumxr3no4am   fcs ()artaxro;o4apxoif3tad mDra(mo;u0 eeomo iadlm  ai sls0sexr(m nudlp emfcilsf 2uau ont4aexniociatlm rlnms;u4 rerxr3tytfptr ueil( s2umim3ny4ome mfvs (f 2rmumooo4optomo3tat a emuvon(0alxomf iydfmDrlu o (0s2to(rpiu1olte icta(  2tmumpoo0tptnmicils s2ea(mpn(0aeenxf3oa1fp   i ilt0trxrir io1lmtelnvsas artmxmpnt4olen oeiatfm uau p (0aeermf3totlpteluvsl(  2umxo io1lmenmncta( arum(roou4tlxnif3iat s rmnmp;(0tetoioctydfa r u i () rxrio nu4aptnlnvias  2uru  nu1openmoeiadlmDum(vp u) rtrircoa1fmt  ivs;t) eur(m iudome lnetl(fa2raxmoou0tltnio3iasfs um(vpnu4 rtnio3ia1omDraies;t)seumxr iodlpte ieia()a2raumono0aetnmo3ildls uauvp u0trxoxr todlpDe u s;() 2tmxm ou1omtn iciasfa2uau poo1olt moctysfa2eanvp (4alxomr3ty1fp elieilt  2xo(rpny4ap nlncsl(fa2urxmp;o4ale mfciytfm umnmp u0aetnxr iadomt  u olt) 2to(m oodam nmfctatfa2ua(r oo0apxn i3iydlmDemn snt4tetoif3oo1fmDr u slt0sruoxo ou1llenmncsa() Duau  ou0aeto ociasfs2ul( o;u)trtnmr3oatomDeaiesls0srumxr3oudlpeelfes ()sruaxmoot1aeto fctadfs rmu o u)trtnxfcoatop e n olt) ruoxr iu4op nmfvt ( arta(m oo1aexoioeiyt m2umnms u0trermo3tadopt  ieol()t2to(opnodom  mnct (f Dua( pnt4oet mieiyslsDulu snu)trerifciytoa eau s s  etrimpiydame micias s2umu onu1tptnmocilt a rlumo ()teenmf totlmDrli il()teurxr3nydlptn ivils)aDtrxmp;o4alt iietadfm rm(mo;(0 rxnmo3iy1fptrlieo;() 2umio ou4amenlicsl(  rraumpoo0tlx if3iltlm2ul( s t0tetoif3to1fpDeln sls setr(r no4opt mivsltfa2tmum ;u4aetn octas a2eln p;u4 lermf tatom rauvol() rtm(r3oo1opt mfci s sDtr(rooo1teeomieiytfmDranmp;u0 rtnif3io1fmDrlnvo;s truoio3oy4lpe  iesa(faDra(mo;t1openmociltfsDrm(vp;u4arerir tytfp  anei;s srxrio iu1ol nmictas)srtax o;u0texomi3tlsfs2eaums;t)tltoioctadoa raneslt s2tmxmpiy1om emnvt tf rumxmo;u4teenmieils sDemumsnu)areoifcootoaDe i sls trtoio iy4lmenmneilt aDraum nt1olxnmoetlt sDrauvs t) exrxr ootfaDeln o s0 rxmxo ny4apte nvi ()sDtr(ro;t4tlx miciasls uau p u)tltrmr3ia1omtr ues (0setmxopoydamenlivtat)s2uaxrpnt1ape io3tytfs eluvont4 exoxf totoa e nei t)truo(r3iy4lm nmics t) 2urx p;o4olt  f3tytfmDea(vs u)arerxf oydlmD au o t srxr(rpiydop emfvsa(fs2umx pnu0tpt mf3iytla rauvs;u)trtnxociatomtelues s trxr(r iudamtemfei s)sDuau  ;o0tle io3iltfs2ean p;t)tetnmrcta1fmt anei t0t2toimpoy1altnmiesat)srrrxrp;t0teeo ieiyt m2rluvsn(0 exrmfctytoat lu slt  2xrio3nu1lp e nci ( s2rr(mp;o1tpeniiciadfa2rau s;t0 eermr3iadoatr nes;s)t2trxrpou4om nmietltfa2ua( pnt1tltomfciltlm2umnmo u)altnirctydom elnes ()teuoxo3ny4lleelfviasfsrurxmp;t4aex iociadlm rm(vo;u4tltnxocoodlmteaieolt) ruoxrpou1lpt lfeil()aDra(mp;u4teto fcias a2emuvs;t4aeenmociy1omDeauvs ( sexmxm ou1amt  nciatfa2raxmpou0apxnmociatfm2rmu p u4 leomrctodfa eluvo t t2tmim iudlp emfvsls sDurum ot1apx moeiad s eauvo ()alenmr todop eanvils)trxmxm3iy4alee ivils  2rmx  ;t0tetoio3iltfs ul(vsnt4aetrxociatla  lnesls0 rxoxo3iudap nmfesas  2umu  nt0ole iietaslsDulu o;u0 etnir3ia1latelieslt s2ur(r ou4ape  fetlsf Dtru  nt1apeoif3tatfmDrlumsnt4tlxrir oytlm eaieolt)seuoimpio1ol nlfesls aDuru  nu1tetomf3iad m umuvs t0trtrmo3tatoa  ai s (0teuoxrpoydam  mivslt)aDtrurpnt0aexnmfetlt sDrmn o;t4arerioctytlpt auvsl() eur(r oo4optnlfct t) Dtrxr nt4apto feiasfm2raumont4 lxrmfctatomDr uvo;t) 2umxo3oo1am elieslt sruax  ;u4olenmo3tldls rluvont)trtrmr ty1lpDr n s (  rumiopoo4al   icsa(  2tmumooo0tle  oeiydfm ean s;u4 exnmf3totfmDeaueo (0setr(o oy1lmee ivsa(f rum(ro;u1tetoioctltfmDemn o;u)alxomrctydoatrln i;s  etmim3oudal  mics (faDrrurooo0alen o3tyd mDulnvp ()aexrmf tadfmt li s t sruoir3iudlp nlfvslt) rrr(rpot4tex if3iyslm ran o;() lxrircoydlptelu s (0 rxoxopno1al nlfct tfaDurxr ou0alx  feilt s ea(vo t4alxomo iodomDeli s;t)sexrim iy1amtemivilsfartru pou0altoio3tytfs2uauvp u4alermo3iotom  li ol( s2xmir3nodlmenlfvtat)s2ra(r oo4aetomiciytlmDrmumon()tleomr3ootop rlneilt  2uo(r ou4om nliei tfsDtaxrp;u4oleoioetas m ra(vs;u) renmf3oytlat livo;t t2uoir oydap   feilt)s2tr(m ou1opto f3tlslaDrmu o u0arenxocoadlp   u s t srur(r iodop   fet tf ruaur oo1tpto ictytfaDean o;(0 exnmr todfp  lues t)setrirpny1lpe lfcsatf Dtr( pnu1aeeoiieiytlaDeaumo;(4trenxo3tytoa r uvi;()texrxr oo1op n neiat arrmxr ;u4opeo iciydls ul( p;(4arxomrctytlptelnvi s)s2umim3oy1om nlncilt  rtr( pou0oeeoioetysfaDumnvpnu4trxnmr3oatoa  aues;( teumxm nu1apt mieil(  rurxmpnt4tptomf3ildfa2rmn snt0texoxo tatfpt an ilt)s2xmio ou1ll nlneilt a2urumono4teeomiciltlaDuaumo (4tlerifctadfpDr neols0sexrio3ou1olenmnvsl() rtrurono1opx if3tls a2ran p (0 eeoif oo1op r uvo;s)truo(o3io4lm n nes t  Dtax o;t4tpeoifetlsfs2eaums t)aetoioctadopDe i s;(0seum(m3iu4am n nci ()sDtmx p;t1oleoifciydfs elums (4teeomociodop eaies;( t2umxrpoudoltnlivtls  Dua( onu0tltoifeildfmDul( s;t0alxnmrctodfp rln s (0sexmxo nodalt lnvsas)aruru  nt1tlx ioeiadfm elumpnu) lxrif3oadlaD  uei;s) euoim3ny4omtnlfcsa(fs2tmxr ;t0aeenio3tatfm uan p;t) etnmf3oydlmtelnvslt0 ruo(m3io1lpeelnetasfa2ur(mo;u0tpxnmf3tlt a ea(vo;u4aeerxr iy1op rli sl( srxmim3ou1op  lfetl()srrr(m ;t0oet  ociasls ulu o;(4 rtoxocootop eliei s)tetr(mpoodapenlnvi s s2taumont0ape  f3ils m ulnms (4altnifctytlaDrlivo t0 eurxo nudop  mfvslt sruaxro;u4tle ifeiyt s emu on()tltoif todopD  nvo t0trtmxrpnu4ol nmncta(f 2taxm no1teeomoeiyd a emnvo;t4trxrmo3oadfp eliei t) rxo(rpny4altemnvs tf Dumx  ;t1texnio3iyt a rln s t0tltnxfcoo1omDeaneils) rumio io4lpenlfcsl() 2urx pnu1tltnmf3iatfmDel(mpnu4teermr iatla eli s;( s2xo(m3oy1lpte nctl()arrm(r ;u1aetomf3tls s ua(mpn(4 rxnxrciatoa rlnei;(0srtr(m oo4olt  feta()srtrxm ou4tlto fcildfs el( s;u)teenmr oytlmt ai i;t)trtriopoudllte fct ()aDraxr ;o1oexn ictat m um(ms;(0treomo oo1fp r ivo s srtrxmpou1lpt  nctasfs2urxro;o4ole  o3tydfmDrlu on(0 lenxr oodfmtr uesl()t2umxo3iydopt mnvt sfa2uau  ;o1tptn fcilsfa2rmnmp;t4 etrxo tatfa eanvi t) rxrxmpnodaptnlfei sf 2rrxmp;u1aeen i3iasfm umnvs;t)altnmr iy1lp e u o;() ruoiopiy4lp emnes t)sDrr( o;o1texnifciasla rm(vs (0tetrmf io1fmDeaivsls)t2urio io1apen icia()a2rrum no1tlx mietys m uluvsnu0 lenmr3tytlmt  nei t)trxmio3ou4apeemncsltfsrurx onu4tpxomfetatfsDemnvpnu4 reoxo oa1lateln i;( srxrir3ou1lmen ieiatf rrrum nt1optoif3taslm umums;u4teenxr3oy1omDrauvils)trum(m3no1op elnvtas  Drmx pot1oetn i3iltfs2emnvo u0alermr3tatomt luvsl()sexoim iodlpenmfetasf Dur(rpou0apenmiciltla2raums;(4 rxnmo3oy1la elnes t setm(opnudlm  micia()aDrmurp;o1tpe if3iasfaDrlumpn()teermfcty1fpte uvs;() 2tm(m iy4llt  ivsl( a2tmxm ;t1open i3iyd m2elumont) exnmfciytfaDrlivs (  2xmxr oudlmtemicta( aDraxmonu1tlxnmfctldfs2eln s u4 rxrmfcoo1fp ranvslt t2urxo3iu1lp  lfci s)srtaumonu1texo iciysfa uan s (4arermo3oodop e neo t srtm(mpou4amtemietls)arrr( ooo1olt mociytfm eaums;t) ltnxo iadfm r ueolt trxo(r nodom emfei (faruau  ou4alxnmicilsfm uanvo u0aeeomo oytomDeau i t  2xr(m no1lm   ict sfa2tmum ;o0aee  iciltfsDelu p;t) exnxrcoo1opD auvol(  2tmxm nudam emicslt s2um(r ;o1tptnmf3iytlm ranvs;u0 reoxfctotfptr u s;() eum(o3ny1op   ivt sfs2trurpno1tltoiicilt mDel(vs (4 exoiocoatfmt auvil( srtmxo3iu4lp n nctlt)arumu ono4oltnioeiydlaDrl(vsn()trxrxrcoytlp  an s t trxm(rpoudam emncias srum(m nu4tltomociyslaDea(ms;(4artrmf oatfpte ivs () eumim3iodape lfvt sf rtaxront4oeeo o3tatls2rm(mo;() reoxfcoy1opteaneil(0 rxrirpnu1ol  mnciatfsrta( ooo1olxomicilt a2rm(vp t4alxrio oo1fmteln i t0sruoimpoy1lmtn neiat artrxr ;t1tltn o3ilsla umnvo;t4 rxoifciodfa ranes s)s2toio iu1om  mnvilt aDtr(  no0apeomieiytla umump u0 renmo3totom eln o;( t2uoio nu4ope miciat)aDtmu oou0aeeo feiydlsDumump (4areoirciotfaDr nvi s) exm(m3nodlmenlncsas srrm(mo;u4tptnmieiyt a2ul(vsnu4 leomf oy1fmD  i s;(0s2urir oydop  micil( aDuru  no1aeeoiociadfm ra(mp u0aetrmrciatop eau olt tetmir nydom elfvia(f rrrur ;u0oet mi3iysfsDrm(mo;u0trtoiocoydlmt lneo;s  exmxm iodol elfcta( sDrmuronu1tpxoioctldfm ea( s;(0 leomo3tydfaDrlieolt0srxoxo oudlp   nvs t sDtr(mo;t0oleomociat s rln pn() ltrxo iy1fm rlneo t t2xmio nodolenmfcia()a2uaurooo0tle  iciasfaDrl(vp;(0 reoiocootopDe iei;t sruo(o3io4lm   netlt artmxmoot1aexniiciad a2ul( s (0artrmf totlpDrlnvs;t0texrim iodop nmfcia(  Dururo;u1optnmfeiydlm emuvo (4 lenmrcto1om   ieils0s2trirpoo4lp e fct (fsrur(r nt0tpxoio3tltfm2ulnvs;u0tltrmfcoytoaDe i i s0t2um(rpnu1lptnliesasf Dtrx onu1tptnmi3ild aDraums;u4trerif3iydfmDraneslt0trtmimpio4al  lncs s) rraum oo1aetomietytfm2ulums;()tlxoxfciodfptr uvo;t teuoxopoudlle mieil()s2ur(m ot4tptoiieiydfm rlu p () lxnmrcta1om elnes;s)s2uoxmpny4oltnlfctls sDtmxmoot4tpe iocilt aDeauvs t0 etoir oodoat an s;() eumxo iodapee ietlt aDum(rpnt4opxnmf3ilslaDemu p;(0tltoxf ty1fm   nvo;s0 rxm(r ny1lptemnesatfsrua(rp;o0olxo f3ilt a rlnmp () renir tadoa raueilt) 2xoxrpnu1ome mfeia()aDrmuro;o0teeniieiatla emuvs t4 rxrxocootfmDrlues t0t2uoxrpiodal  lnciltf rtmxrono4tptoiietadla2ulu onu) lxoiocio1omDeaivil(0s2urxmpoy1lm  mivtls) Duau pou1tlxo oetls sDemuvp;u0 rtoxrciytoptranvs ( srumio3iodaleelfet tfarraur nu1oetomf3iydla emnms u)tltrmo oo1fa  lu o ( t2urxm ny1alt lfci ( aDrmxrpot1altoiictysla2rmu snt0 lxnxo3ia1opDe ieil( setrirpiodopen nei t)a2taumonu1tlxoifctadfmDrlu p;()alxnxr3ootfp  anvo;( t2xoxr3iu4olenlieil()s2urxr ;u1altoii3tyd m em(vont)alenmo ia1lmtrli o;() rxrio3nudamtemicta(fsDtm(mp;u1tle ifciysfm um(msnt0tetrxr3iydfmDelu ol()texoim ou4am elnvi t  2ur(mo;t1tltomfctatfs ranvpnt4alxrxf iotfpte ivs;(0 2xmio nydll e nvi s aDuax pnt0tpe iicilsls ul( ont4tlermf oadfatr iei t)trxo(o3ou1optemivs t aDuaxr no4tee mietyd a2emnms;(0alxrmf3oa1lpt anei t srumxr nodapeemivt t s2rrur ou0oexnif3tls a2eau p (0 rtoxrcootlmt luvs;s0t2umxr ny4opt  fet tfsrrrxmo;o4alxn iciatfa2ea(vp;(0trtnmfcoa1oatr i ilt)s2uo(m3oy4amt lfcsasfs2tmx  no4opxoio3iasfsDumnvs;u4trenio to1fatelu s (  2xmio3iudope mfei ()arua(m ;o4apxnmfeiydfm ua(vs u0 exoxf oy1laDeaiei;t)s2trio3nu4ope lfcta() 2tmumonu1tpen f3tasfs rmn ont4trxnxr iytfm r i o;t s2um(rpnudoltnmietls aDrmxm nu4oex  i3iadls eln o t) eeomf3oo1fp eluvi;s0 exrxmpou1am nmivt sf 2ur(mpno1aptoiociadfm rl( snu0 rxnxfcto1om  luvo;(0t2to(m3no1lp nlnetasfaDumur nu4opt  oetysfsDea(vs u4aeenif iytlatean o;( tetoiopny4lpe  fviatfsruau  no1tpx ioeiasfa2rmuvs (0alerir3oodomD  nesls s2xm(rpoodlmt licsl(  rrm(  ot4oexnmieiasfm2em( o;t0alxnio tadlp eauvo;()teuo(m3nu4om  lncilsf rum(mpnt0aeeoif3ils sDua(vonu0 lxnir tydoaDe i ilt trtrio oy4amenmfvtl(f rtm(m ;o4tpxoiietltlm2eln o;t)tltnmf3iydopteli s ( texm(o iydlm emictltfsrum(rooo0tltnmoctldla2eanvon(4treoir oodfmDraies;t texr(opiudll nmfes sf Durx p;t0oleo f3tld a rm(vo;u0 lxrirctadopDelivo ()srxm(o3ny4op nmict (f 2tmumo;u4aetnmo3iyd sDemnmp ()aexnmfcia1faDrlneols s2tr(rpoy1openmnvtatfs2tmu  ;u1tpeo ictatlm emuvsnt0arxrir iytfatelnvolt)teum(opno4llt  fvsasfsrumxmp;t1tlenmi3taslm rmu s () etomfctatopte u i ()srum(opno1opt livt s)sDurump;o0teen ictlt m rl(vo u) rtrmf3tydfat au sls trtoir oodopte fcsl( a2um(m ou1tee  fetatlm rlu p t0tetnxf io1lmDrlnes s)s2xoim iu4amenlivsls)s2trxmo;u4aex ifciys a uan pnt4tltoir3iodfp   ivi s)t2xrxo3iu1optemfesat) Dumurooo0oexomiciasfm rauvp;()arxrxociy1oaDelnei;t) 2ur(opiy1ll emivsas  Dta(rono0olenmfciaslm2em(mp;()treomo3iy1omte i ol(0setm(r3iydlm n fvs sfsDta(rpou4oexomfciytlsDeau s (0 renxr3ty1fp   ivs;s0 rtmxrpnu1amtnmneia()aDrr(m ;u1aexnio3iatfsDuanvp (4tlenmociodomDe nvo t)srxoxm nu4omtelfctatf Dumump;t1opx ioeiatla2ea(vsnt)altoxr todfat  ivils)s2toxr ny1ape mfesa(fs2um(monu1apxo ictysfs em( o u) lxrxo oytlatr neo (  etmim iudlptnlfci sfsrua(m ou0ale ifeiasls emn o (0 rtnir ta1fmDranvol(0trxm(mpno1omt licias)sDua(r ;o4tle io3iydlm uaums;()aeeoxocoy1op ran ols  exo(r nu4lltnlnvt t  rumu  nu4oeenmfciat a em( p () eenif3oadomDr neols)truoiopiu1amenmfesl()srrm(mpot1olxo iciysla rl( s;t0 rxnirctodlmDeai s t  rxmxr3nudaptn iciltfaDrrur no0tlt mi3iys m2ea(vs;t) rxriociatfp  auvo;s0teurxopoo4llenlivi ( arumuroou0aet io3tys aDrm(vonu0 etnmf totfaDeau o;t0 exr(m oy4lpen fviltf 2tr(rpot0olxoiicias mDran p;()teerifcoodoate uvo ( srtmimpny1ape  fvt ()artr(m oo4olxoif3tyt s ranvs u0 etnxf3tydoaD aivo t)s2urirpiu1olenlfcsltfaDrru  ot1oleomictytfaDeanvo t0arerxrciotom raieilt0sexmir oydap n ivia()srtr( pnt1altn f3iys s2em(vp;u4teenxfcoytfpt aiesl() 2xmim ny4omeemici s) rtaxrpnt1alxnifcils mDeanms;u)alxrio tytfpDr n s s)s2tmxmpoydome  neia()arrmx pno4texn i3iyd a rm(msn() lxrmf oodlmt  nesl(  rurio3nodll e fvt t) 2tr(rpnu0oee mfciadfs2ua(mpn()tetnircoy1faD  nei () 2tmxo nu1lp elncsls) 2rm(rpnt0oexomfeiyslaDul(vs t) etrircia1fmt li slt) 2xrio no4lm  lfeslt a2rmx  ;u1opxniictlsls2ran p (4aexoio iodfm rlnvo t texoim3oodol  livsat aruru oou0aexomfcilsfm el( o u4trxnio3tydlp  luvi;s)texm(r nodopenmfeilsfa2rrumpot1tpxn ieiad sDuaumo u4 exnmo oodfptrlieo;(  2xr(mpiudlpe mfet ()a2ururpoo1aetnmoctatls2ul( snu) exoxf oytla eai o;s s2toxo no4am emieiasfarrmu  ou1tlx ioctls mDelu s (4trxrir oa1opteauei;() rtmxo3oo4om  mfctat  2uru o;o1altomociyslm2em( s;t4tltomfctytlatranvi;t0 exmirpoo1optelivt s) rur(  ot4ole  iciasls2ran o;(0 eerxf oydfmt  i i;(0t2tm(r oudlpeemfcsa() 2urumpot0tex iociysfa2ea( snu0tetoxo tadlpDeaueo;(0 2xoxrpoy4lmeelfet t)aDtm(mpno0olxomo3tltfa2umn s;u)trtnxr3oadfaDelueslt) 2xrimpiy4aleelfes tfa2rruro;o4ape  ieildlmDrl(mp;(0 etrmo3tatoaD  uvolt)t2urio3iodamee fvi t)arta(mono0tpeo oeiys m2rm( o (4alxomrciodfpteai s;t s2xoxmpou4lpen ncsltf 2rr(r ;u4oee mociytfa elums;u) reomf3oodlp raueils) 2toxr oy1omtn ivi s)srra(ro;u0teeo i3iytla2ul(mp;t4trtoxr3ootomDe nvils) rurimpiu4op emicils arrrxroou4alenifciasfmDrauvp;u) rtrmr ty1la e ivo t  ruoxo3iodope lfvtls  Dururp;t4oetn oeildfa uauvo (4 etrxocoo1lpDeluvsl( setmimpio1am  lfcsa(f 2rau pou0tlxnmicildlmDem( ont0trtoio oo1lmt an i;s t2to(r3io4ol eliet () Dtru  no1apt mictysls elnvs;()aetnmrcoydlm eauvils0sexoiopiy4op nmfvils  rurumo;o0tetoioctltlm2em(mo t4alxrxociadlp rlu ilt0 eum(rpoy4amtelieias  Dra(monu0teenio3ildlmDra(vpnu0 lenxrcoatlpD aivi s)t2tmir3iodom   ieia()a2urxmpoo0tpen octad m eanmp;t4trenxrctodlp e uvs s)texmio3nudlmte fci sf 2trumpnt4aeto i3tat s2elnms () eermo3todlm   u s s)t2urxm nodomt mnei (f 2urx  ;t0tleo i3iltfs2umu on()altomo3oadfpt  nvi;t) 2trxo ny4amee ivil(fs2rau  nt1alen o3iadfa uau o u)artnir ia1lmtelu sls0srtm(m3nu1llt  fvslsfa2um( ont0opxomo3tysfs2rmu o u) lermo iotfm  ln s ( s2um(o io1opee fesltfsrurx  ou0oeen f3iyslm eau s;(0 eermocoydlpteau ils teurxo3oodam elnei t)aruax p;u4aptomoctatlm2el( p;t) rtrir ty1fpDeli i;(0seto(m3nudlm e fvtlsfa2ra(rono0opxomieiytls2rlumo;u4 lerxr3iy1opD  uvo;t srum(r3iy4ap  lncsas) 2umumont1tleo ociadlsDua(vs;u0texomfciydlpte ivi;t0 exm(mpnudlm  mfvs (f Drrum ot0tpe iieils a2ul(vo ()teerxo3oodopDr i o;()s2xmim3oy1omee fet t)a2rr(m ;t1aet ioctydlsDrm( s u4 rtrxo oodfp   n o;s tetmxr3oydome mictat  rururpnt4opxnioetadla el( p;()teerxfctatfmDr iei;( seuoxr ou4lpt lnvilt arrmu  nt4oee  oeiatfs2ul(msn(0tetnmo3iydop eluvo () rxm(rpoo4alt  ietl( s2raxm ;u1tlx moeilsfa em( o;(0tleomr totlpteln sl( seumxr3io4alee fet s sDumur ;t0oltomfciydfm emu onu4aeeriociodfmD auvs ()sexr(mpio1lmtn nctl()a2tru ono4aptn ociltlsDrluvo (0trtnmrcoytlpt  ieo;()sexrio oudlp   nei s)aDrax o;o1opx iociytfaDemuvs u0artrxrcoytoat auesls0setm(mpoo4lm  mnvi t)sDur(mo;o4apxo oetltlmDemn p;u0 rtomf oytlm eaivslt s2xo(opiy1op elnvtas  2ua( o;o4tee mi3iyt aDuanmonu4altriocta1oatrlieo s tetrxrpoo1ale mivtas)sDrax pnt1apxnmieiyt m2ul( s u4treoio iydopt ln ilt trurir3iudlp e ies ( a2raurpno0ole miciltfa2elu s;(0aexrxo iytomDelnvil( tetr(r iy1op n fviat  2um( pou0aptnmf3tas a rm(vp;t4aetnxocia1oaDran ol( sruoxm3oy1amt lfcsas a2taumoou1aetomociytfaDrl(mpn(4aeenircoydopDe u i t0trtrim oy4ape lncil()arum(mpot0tpt  fetyd a2em(msnu)aleoxr3iy1la eli s;()seurxopiu1alen icsa()a2rau ont1ale if3iadfm2ean pnu4aetoxocoodlm rlneo ()s2uo(m3oodomt lfctls  Dta(m ot1aeenifeilsfs2rau sn(0aleoif3oa1lmtr i o t0t2xmim io4lpeelfeil()arum(r ;o1aexo ociasla emnms u) ltnmocio1oa e u sls t2trxr oudole lfvsas  2trxmpoo0aeeomfeiys a eln p (4alxoifcia1faD anvslt0trtrim3oy1amenmivta(  2uaumont1tleo iciytlmDelu snu0 rtnmr todfm e uesls0 rtr(r iodolen neiltf Draum no1tlxn fctyd s2uluvp (4altnio oadlaDe n s t) rxr(o3nu4lle  fvtl()aDrr( o;u1altn o3ilt m elu p;(0artoir3ty1laD lu o;s srtoir no1alt  iet () 2tm(  ot4olt iociadfs emums;t)trtoxfcoodfpt  neols seumim3nodlp e ncils s2taxmp;t1alenifcias m em(mpn(0teerxfciotfp rlnvol()srxmxo nudlm nlietls) 2umumono4tleomieiyd m2rl(vs;(4 exnircoy1laDrlueo;s)trurxm3oy1lmen ivsls  Dtrxmp;o4oeeomfctytlaDemumo t) leomf3tytoa eauvslt)srtoiopny1ap n nei tfaDtaumooo1alx ifciltfs2um( s t0 eerxr3iytfa eaieilt) ruo(m ou1ole  nvs ()arumu  nt0olxo o3ilt a2emnmp t4 reoxr3oytlpD lu s t0t2um(rpny1amtn fet s srrrumpnt1aexnii3tls a2em( p;(0 lxnmoctatlatrluvslt0seuoimpoydaltnmnctlt) 2raum nt4tpx moetysfsDeanvonu4 eerxociatopt  i s;(0 rtmir3ny1lp n nvslt artaur ot0tlen oetatls rmu s;(0trerxf3tadfa eaneo () 2xr(m3iy1opt licils  Dumuro;o1tlxo i3ils a em(vsnt0teenxf3todfm eau i;t)s2xo(mpio1oltemnvs s) rtr( pou4alxo fciysfsDem(vp t4 ltoif3todopDraneilt0 rxmxm3iy1ape lnvs (f Draxr ;o0olto o3iyd a2uau ont)alenxo3oatlptelnvolt0 2um(o3oy4ap elneias artm(m nu4olto fciaslm2emuvonu4texnxr3ia1om r ivi;s0sexoxmpiy1llee ict ( s2ra(m oo0aex io3iadlm2elnvs u4trerio iytom   neo s)s2trim no1ole lnetl()srua(r nt0tee moeiadlm rl(mpnu4aeenxo iydoatranvsl()srumxr iy1llee nvt s srraumpot1optomoeils mDrm(msnu0tetoif oy1faDr neols)setrxr3iydapt mnvsl( aDtm(moot1aexomf3tysla eanvo (0 rxoxr3oytomDr u i;t srur(r oudomt miet sfartrumpou0alxn ociadfsDua( pnu0trxnmf3oytlmD li s (0 rto(r iy4aptnmneta( srrrx ont4apxnmf3iat aDua(mp t4artrxr iodfp eau o;( teuriopnu4apenlivtat a2rau onu1tpeo iciydla2rauvo;u4tltomf3oy1lp   nvi;t) 2tr(opiy1olte fcsasfsDuauro;u0alt  i3iytlaDran pnt0aeenxf3oatla e ieil(0t2urimpou4lp nlfvtatf 2tr(ronu0tlt  feiadfm ranmp t0artomo iydfate uvo t) 2urio3iodlme  nvt t)arum(r ot1tlx mfetasfa2em( p (4arxnmf iy1fpD lieo (0 eur(o iudlmtelfvt t  Dtau pnt0tpe iiciysls um( o;t0 rtnmo oydfm e ivi (0t2toiopoo4aleelfeiat)s2ta(mo;o1tetnio3tyt a2umu o t) eeoxr iydlmDean i;s)tetm(o3oudomt  ics s)srtrxmo;o1oeto oeiys a el( p (4 rxoio iatopDrlieo s0 2xoxm nodome mnes t) Dtmxmont1olt  fctaslm ea(mpn(0tetrmo3oy1fptrlneils0trur(o3oo1ol   ietl(fs2rmu o;t0aexnifeiltlaDuan p ()alxrioctotlp raueils srtoim3nodomte fviat) 2uru  ;u4alx iiciatlm2elnmsnt)alenmo3oy1lateauvil(  eurxo3iudlp e fvtasfsrrax  ou4apxomfciatls umnmpn()trtnir3iadopD au ils)texm(mpno1altn nctlsfaDtm( pou0tpeomociyd mDel( o () eeoxrciodfp r neil(  eurxopnu1omt  nvs s) 2tr( p;u4tleniociytlm ea(ms u0 reomo3oa1fpt luvol(0s2ur(rpno1ole  ieia( srtaxm ot1tltn f3iatlm uluvo;(0trxoxr ty1opt luvolt t2tm(mpiy1olee neil( aDrrx o;t4olto ictadfsDumu snu4 etomf3iadla eln i ()srxoxrpou4apt livia(f 2raumonu4aet  ictas a2rl(vp t0 eenmr3ootfpte uvils s2ur(m no1lmt  fvtatfa2ra(mp;o0olxoiieiatfaDuanvsn(4 rxnxo iadoaDrlu ol(0t2tmxm3iydomee netlsf Drmxroou4tlxomi3iadlm emn o (4 etoxfcoy1oa ean i;t) rtrxrpoudam emfvslt)srrmur oo0apeo icildfsDumuvp;t4tltoir ty1fat lu s;s0 rxoiopiydame micilt  rrm(rpnu0altoii3iyd m ulnvp t)teeomocoa1laDr nvo;s0 rtoxo oudope  ieslsf ruax poo1opto o3ilsfm eau o;(0tlxomf3tadfpteln s;s0 exm(mpiu1llee ics ()a2rrurpou1aeen fcild a rl(ms t) eermoctotfmD lu o ()t2tmxr nu4llenlfeils) Drr(m ;t1alx mo3iyt s rl( o;()trermrcoadomt  ieslt0tetm(o iy4amenlnetas  Drmx  ou0oetnifciatlm2rluvp;u0 rxnxf3tytlat aivs s0t2xriopny1lm n nesl()a2trxm nu4olt ii3ild aDrmnvsn()areomociytlpteanvslt teur(o oy1lpee feslt s2tm( ono0aet mo3iys m2ul(mp t0trtrioctodoat au slt0trxr(rpiy1lpe mfes s aDtr(rpot1oee ioeild sDuauvo u) lxrir3tydlpD li o s trtmimpio4ape  fci sfaDrrum ;t1tpeoifeildlm2rm(mo u)tlxrir3ia1oat li il(0 2xoxm3iu4op  licilt s2tmxront0tlxo ietlsfm umu on(4trtoir3io1omDe ieolt)srtr(m io4ol emiet ()a2urxrooo4aeenmfctaslaDranms () rtnxo3oa1lp elivsls trumirpoy1lm  mnct t aDumur no0tex mo3iydfm ulnvo;t0trxrxfcty1faDraiesl( srtmim iydlp nlfvils  2umurpnu4alen iciat mDel(vo t4 lermf3oatomteanvsls)trtm(o3nu1lmenlfes ()arum( pou0tex moeiyd s2ra(mpn(4 leoxo oy1lpDrlieo;(0 2tm(mpnu1amt lneslsfaDrmuronu1tlenif3iytfs2rl( o u4altoxrctydoa   iei;s  etrim3iu1ol nmncils sDtmuro;o1tpxnioctat m2ea(vpnu4artrxo3iatfp elu o t  2xoxo3no4optnlivtl()a2rrum nu1tpe  f3ildlsDemu s (0alxrif3tatfaD aueo;t)t2xo(r nydameemfcil(fsDtmum nt0apt  fciytlmDrl(mo;(4 rtoxf3totfa rauvi;s srxm(mpoo1lmte nesat)s2rrur nt1aee mo3iadlmDum(mo ()altniociodlmt livo s0trxoio3iodape lfci tfartauro;u4aetn ictysfm umuvo;u0alxomr iodfm  aiei;()s2xoio ou4lpeemivslt  rtm(rpot0olen o3ildfmDea( s (0 rtnxf3tadomDraivo;t) 2um(rpiu1lmen netat)sDtmxmp;o1altnii3iltfsDemu snu0alxrxfcto1om r nei s0 eumxm3iy4am nlietl() 2umx  ;u4aee mfcils sDemnmo;(0 eermo oydfaDrauvils) rtoxrpiu1lmt mneia(  2umurpno1alxnmf3iydlsDumnvs;()areoxrctotomDeanvols) exoir3ny4ole  nvs tfs2ra(  no0alenmf3ild s2elnmon(0trerio3oatfa ranvo s)trxm(opiudamtn fci s) 2urxmoot0optnmfeils s2rm(msn()aeerxo3tydomD lnvil() 2triopiy4lp nmfct (farurumooo1oeen oeiat aDumnvp;u) exnifciadfptr ivo;t0sruo(rpoo1ope mivs tfa2rmuro;t1alxomo3tld a em( o u0arxnioctytfpDeaivols0trxmxm3oodal nmncias)sDumumoou4oleo ietytla2ra(mon(0trtrir ootopt livs t0srxm(r iu4lpee iesa()arur(m nt4oeeo ociys m uanmp (4arenxfciadoptr uvs;(0sruo(o nydol  mfesas) 2raur oo4oeenmo3iat s2rl(mpnt)artrio3oadfpDr ivi;(0s2xmxr ny4omt  nct s)aDtrum nt4apx io3iasfs ulnmo u0altrmr oydlatrli ol(0teuoir3nudlltn nct tfa2ua(r ;o1olxomfctatls rlnvs;u)aetomfciy1fpte uesls)s2xo(opou1am nlicsat)s2umum oo4apenioeiltfm ranmp;t)tlxrmf3todlmD ai ilt)t2to(m nodam emnvtat aDtmumono1oeeomfeiltfa2eau s t0tlenmrciy1opDrluesls  2xoxr3oo1op nmieils artr(r nt0oee ioeiad a emump u4trtnxr3totfpDe ivol(0trto(mpoy4opte nesat a2ua( pot1aetn feilsfmDea( o;(4teermf todomtraivolt)t2xm(o3no4ope lieias sDtau  ou0tpen f3ils s2rm(vpnu)tetnxo3oatomDraneo t)truo(mpoydlleemici (  2raumoot0olt micildla rau pnt) leomo3tytfmtrln il()t2ur(mpnudlp nlnesls) Draxmpnt4apxnmoctls s uanmont) ltoirctodlmte u ilt)srto(m ou4al emncias aruru oot4ole  ieiyd aDrau o;u)aeenio tytlp rlneo;s0t2um(o oydomenmietatfsrtaumont1alx  ociydlmDul(vonu)alenmfcty1lp  lu olt sruoxr iydlleemfeils) Dur(r ot1alen i3iasfa2umn on(0texrmfcoo1lm  anvi t tetr(r oydlle mnci t)artmxr ;u0teenifctydlmDea( s (4 rxnmo3oytlpt  ues;() rtmim ny1op emivs ( srtmx  nt4ape iiciytfa2rau p;()trxnif3oadlmDe i s;s0 2urir oy1alee nes s aDrau onu1aetnmocils a ranvo u4 exrxf3iotoaDranvs () rtoxm3ny4ol   fetat) Draurp;o1tptniieiad s2eau p;(0alxnmr3to1fatranes;t0t2uoxr3ou1lle liei ( s2urx  ;o1oltniiciatlaDua(vont0aetnxr oadop e ivsl(  2xmir ou4ll  miet sfsruau ooo1tpt  i3iydfaDelnmo;u)aeenifcoodfmDe i i;t s2toiopoo1opt mnei sfarua( o;u1tetomfciltla2uauvo;t) exrxf oytfat  ues (0 2tr(rpou1olte ics tfartrxr oo1aptnio3tltfs em(vo (0aetrxr3iodlm r i i;(  rtrim3oy1am  lnei t)artr( p;o4tlxomieils a2emnmo () ltrmfciatomDe ues t)teumxm3iy4aptemies () 2rmx  ;o0oex  fciad s rm(vsn(4trtoxo iodfaDe ies;()srtrxm3nu4om nlfvi ()sDurxr nu0aptoii3ils m rmn o;t0aeeoifctodoat lues () rxo(opno1llt lnetas)arua(r ou4oeen feiydfm2ranvo;t)artoxo ootfpDe ieo t s2xm(o3nydamee fcs tfs2tm(mpno1tlto fctldfm2eaumpn(4trxoio3oodoptrln i;s)srurxm3oydal  mivt ()a2rrxmpot0oleniictasls ean o t0alxoxo3tytfptrlueilt s2umxo3iu1am nlfet s)a2tmx  ;t0tltniicils mDuln ont4 eenmo3tadomD luei;(0s2urxo3iudamtnmicsls)srra(ronu1ope if3tlt sDrmn p;(0aeeomr to1faDr iei s trtoiopoudaltn nvtasfaDrru  ;u0tetniociltlsDea(monu0 rxrir oadlm rlivi t)trtrim iu1llt mivsa()a2umxrooo1ale mfetadfa rauvo;u4 lxoirciatlpDr uvil()setoxo3nydll nlnvsas  2rrur ot1aee mfeiadlmDuln s;u0aexrir3ia1lpD an ol( trxoim oo1om   ncias sDum(rono4oexnmfeiltlsDeluvo t4 rtnmf3oydlmD  nei s)srxm(m iu4olenlncsl(fartr(m nt1oeenif3tltlsDelumpnt) rtomr3ia1laDe ieo s)trtrimpio1aptemnvs sf rta(mp;u1aetoifeils a emu snu4alxnxr3iodlmDranes;t  rur(r3nu1amee nesatf rtm(  ou1oet mf3iys aDum( p u4 ltnmfciodlmtrlivs;s  2toim3ny4lltnlfctatfarra( pno0tleniieiatlm eau s ()alxnmo3oadoat  n s s  2umimpio4openmncil(fsrtaurooo0aleo f3iysla2ea(ms;() rxrif oytfaD livo t) eurxmpio1amt  fvtl() rra(r oo1tpxo f3tld a ean s;t4tlxrxrciydopDeln i;s)trtrir oo1olenlictls a2tmu o;o1olx ioetas sDra( snt0 ltnxo3iatlaDelivo s0 2xo(r no1lmtn nctasfsDurum ;o1oetnmieiadfs2ulump;u4 leoir3ta1om  lnes;t0trurim iy4openlfct t) 2uaxmp;u4olt mo3iyd m2elu pn() rxrmr3oodop  livi;t0 rtmxrpou1alte nvtas  2ra( o;o1tpxoioctyd aDul(vs;t4aexrifcoytlat anes t) rtm(m3nydlm nmfei ()s2tmx pnt4altoifetlslsDrm( snu0 ltnmfciytfptelueslt0 ruo(r3oy4om nlfcsl() 2um(ro;u0opto oetadls2eau p u) rxrir3to1oaDrluvs (  rtmxm nu1apt mfvt sfarraxm nu4aptn oeias aDumn o;u) etrir iytlpDelnvo s  rxmir3iydapt mfcta(f Durx o;o1apto o3iytfs umnvs u0 ltrir tatlm  ln o (  rtrxr ou4omtemietl(f rurx oou4aet iieiatls2rlnvsnt4 lenxo3iydoatelnvi;s  rtmir3iy4lmen feils)sDur(mo;u4olxniociys s2um( pnu4aeeoxr iy1fp  aivol(0s2umim nodlpen fvsl(  2taxr ;t4oetoioeiyt m rm( s;(0artoir oydfatelneilt)srxr(m iy1omtelies t a2raxmpou0ale  fcias m2eauvpnu4 exnmfctytlp  an o t s2toim3iydam  mfes s)sDrrxmp;o1tle mfetatfmDul( s;u0aetnmfcto1opDeaies t)seumir io4amtemncs (  Draxr nt4aeeoifctlsfsDrmuvsnt0 lxrio3tadfmD lieols0 rxr(o3ny4openlnvta( sDra( ono0aeen oeilsfa2rmnvo (0aleoir iadlm r n slt)srxr(mpny1opt  nciat) rra(m ;t4alt  oetyt a emuvon(4 reomrciodlateln slt0 rtoir iu1lp  mneia(  Dur(mpou1texnifetydfa el(vp;u4altomf3oa1lmD  ies;()teum(mpoydomtnliciatfs2ur(  oo1aptnio3iltla emuvp;(0aetoir iatfmt  nvils) 2uo(opoo1openmivsa()aDtaumo;o4tpeoiociydla2um(vonu0tlenmo3iytoaD  n s ( trtmxmpio1optnmnvslt)aDtaxro;o4apt  iciys s ea( o t)aeerxociydomD lueo () etmirpny1amt  fet s sDtrumo;o1oeeoifeiatlaDrluvonu4aeenxrciy1fmDraivil( srum(r io1am  lfvtas) Drr( pnu4apxo fetatlsDrln pnt4teermociodfatraivi;(0t2xmxrpno4ale  iei ()srtmumonu1oetnmo3iydfs2uan o (0tlxrxr3iotfpt  nes s0 rxm(r iodlme liesas) 2taur no0texoiieiltls2uaump;u0tetrif oy1op rln s;t0trxm(mpiy1amt  fvs s  rtrx pnt0tpe mo3tytfaDra(ms;u)aeenif3tatopDrliesls0tetr(o3ny4lmt livt t) 2umur nu4apto f3tlsfmDum(msnt0arenir totomD lu o s0trtrxm iodoltnlivtas s2umuront0alen f3ilslm2ra( o t0alxoxfcio1fp   uvo s  eur(rpiydam n fcils srrrum nu4aet  i3iasfa ranvpnu0arenir3todom  liei;(  2xmxr3nu4apt lics sfaDum(m ou1open feias aDumu s u)tlxnxocio1latrlnvi s0s2urxr3ny4lmtnlies t) Duax o;o0olen oeiasls ulnvo t0 exoio3oodfptr u ils)trumio3iydll nlnesas)s2uax p;o4oeeoioctlsfaDumn s (0 reoio3ia1fp e ies;t0srurxo oo4amtelivsas)arurx pou0tle ifcildfs2emu o t4tlxriocootfm eluvo ( texrxrpoy4amen ncs () rtaxmpou4tetn oetatlmDua( s u4 lxoxfcoa1optranvols0 rxoxr3nydale lncs s a2ur(  ;u1oeen fcild m2emuvs;()arxnmr oy1lmDr neilt srxoxmpiodopt mivias  Dtrumpou1apx miciatfs2rauvon() rtoxrciatlp elivo s0t2xmiopoy4oltemnetas arrmumo;u0tpt  i3tltfsDeauvs;t)aexomocto1fmD auei t trurxm iy4lltn fetasfarua( p;o1tle mieiad sDulu p t4alenmfcoodoaD  u s ( tetr(mpou4oltelict ( a2rm( pou0aetomfeiyd a2ul(mo (0trenxr tadomtrli slt0srur(rpny1lpe micia(fs2uaur ;o1alx if3iadla emu s;u4 rxomr3tadlaDraueils0 eurxm3io1lleemnvtas  2ra( p;o1aee mo3iytfs rm( o t0aetnmo oytfmt lnvi (0 rtoxopoydop nmnvtas)srtr(m oo1oltniicias aDrmuvsn(4altnmo oo1fmDeau i t0 2xr(r nu4lp  mfcia(fsDtmurpot0apxn o3tydla eln o;t4tetnxfcootfa eaiei t s2xr(opiu4llenmnes s)aruax  ou1aleomietld a2ean p u) renxr3todla e uei;t srxmxr no4ol  lnetl(faDrr(r ;u4ape mfetlsfmDeanmpnu)teenmf ty1fmD lu olt)setoio3oodapen iesls a2umxm nt0ope iietatlm2eanmp;u4 rtrifcoadoa e n i;t t2urir3iu1amenlnvtlt)aDtm(rp;u1opx mo3iltfa2em(vp ()aleomfcoa1lmDe nvo;s)srtrxrpoudlmen icil()a2uau pou0olen o3tld m2eanvp;(0 rerxociotfptr iei s  2toxmpiodom e ietltfsDtau  ;u1tleoii3tls a raump;t0arxnir ty1lmt lu s ()srxm(opiy1alenlfes s)arrmxm ;o1olx iociasfa2el(vonu4altnxfcia1fmt  nei ( seurxrpno1llee net sfarrm( ont4tpt ioctls a ulnmo;t4 exnio3oadoaDraueols texmimpoodopeelnviat)sDrmx o;u4texomi3ildlaDel(msnu0 lxrxfcoo1lp rlieol() rumxo3oy4llte fet t  rurx p;o0tee  feiatfa2rmn ont)trtrxocoo1lpDrau i t0t2xo(m oodoltn nviatfaDraxrp;o0tpenmictydlaDulnvon() eeoirciytomDelivols)t2uoxr3oy1lm n fvt t s2tmum ot0tetomfeilsfmDean p;(4aleoir tytfmte neo s0texoxr3iydllee net s sDtrurpno0oex  f3ilsfa em( o;u)altrxociotlatean o s0 2xmxm oudlptnlnvsat) 2tmx pot0opeo octlsfm eluvpnu4 ltnxf tadlm ranvsls s2uo(o io4ap elictlt aDur(r ;o4oexomicildfa2uanmp;t)tlenifciydlatr n i t0teuo(r3nudam n ics () 2rm(mo;o1ole if3ils s rmnvo;(4 leriocootlmt livs t0srtm(m3oudomtnmfcslt)aDtrurp;u1aex ii3iadfmDrlump u0alermrcootfmtr uvi;s srxoim3iu4op nmnvt t) 2rr( ooo4aexoioeiyd a um(mp t)aexomf oy1fpt  ues;s0srxr(o iy4llt  fes tfsDur(r nu1oltnioctysla2umuvo;u) exnxo3oy1laDrlues s srurir3oudlp nmies t) Dur(r oo1aeeomietadfmDeln s (4 eeoio oytlp r uvols0 2tmxopiu1olee nei t  2tmu pnt1tlxomf3ilt s2ulumonu0tltoif3totlp ean ols0sruoimpno4ll elnvsl()a2tau p;t1oex  i3tytlmDea(vs;t0trxoircoa1fp  auvilt)sruoxrpoodal e fcsa()aruaxr ;t0aexoii3iatfaDul(mp (4tetnxo3iatlmt lu s s)texrir3io4amenlncsl(  2tm(m no4opeo ictlslaDelu p (4treoxr3oatopDean s t  exoxr nudome  fesat s2urx  ;u0tpeoiictlt mDuln sn()trxnxf oadfaD an olt srumxopnu1opt  fviat) Dumur oo1optnmieildfsDem( pnt)tltrmo3iatlptr nei;t trtrir3iy1omenmfctat a2ur(m nu4oleomi3ilsfmDemuvon(4 lenmo totoaDraneolt  rum(r oydllenlnvs sfsrum(m ou0aptoioeiys m2eln o t4altnxr totomtr ieil(0s2xoxo3nu1lptnlieia(fsrrm(rooo0tlen fcilsls ua(mo;u) rxoxo3oytlaDe i i t seuoxo no1ll n fes s)srtrxmooo4ale  octas m rmnvo;u)aexrxo3iotomt luei s)setrxrpoy4am  miviatf ruaumo;o0oeeniictatfsDelnvo u0 rxomf3iytoa r nvolt0texr(m3iodop emivsat sDur( pno4openioeiatfs2emnvs;u4trenircoy1optran s;s  etoio iodameelnvtatfsrtrur ou0opxomietlsfsDemn s;t) eenmr3iydlpt aivol(  2ur(o nu1lp  mnctl(fsrtmxr oo0alenio3tasls2uan on() ltnio oadfaD  n ols) rxrxopoo4ll nmivsl(f 2umu  ;o4ope mieilsfmDuluvsnu0trxrxf3to1opDe uvi;t)s2xr(m3nudomenliet t) Drmu p;o0optn o3iysla2rl(vpn(4 rxnmocootfpteln o;(0texm(m3no4amtelneia( sDurx onu4teeomocildlaDra( s t4 etomo3oy1fpD lieo;t seurxr3nodolee nvtlsfsDtaumpou1tltn fciad a ea( pnt) lenmf3iatfp   i i;( seuoxm3iydope  fvsl(fs2tr(  ;o1alt iietldfmDua(vo ()aetoircoytfate i i;t s2ur(r3nydlltn fet ( s2tm(mp;u0ale iociydfa el(mo;t)trxomfciytoaD luvo;t)srto(opnodole mfvta( a2tr(rpot0aeenmiciaslm emuvpnt4 lxnxr3iadlpt aueo;t)texr(mpoudolen ictas)sDtm(  ou4tex mfcias aDrl( ont0 rxnmf3iydfaD  u s;t)teumxopiy4opeelfvtl( srtmu p;t1tpeomf3iytla eaumo u4aeerxf3tytoatelivo;s0seuoxr oydll   fctat aDtaumpot1oleoifciltfmDelnvpn(0tltnircia1fa eln i;( tetm(m3nu1ll n nvtltfs2urum ;u0tpxnmieils sDrau s;u) rxnmfcia1oate u sl()seumimpoo4al e neilt aruaurpnu4alxomfeiatla2rl( o;t4texomoctadfp  au i s0trtoxrpio1opt mivsl(  Dur( pnt0tpxnmoeiys a umnmpn()aetoxf iotlmD livs (  etmxmpou1ole  ict s) ruax onu0tpeoii3iytla ul(vo u) ltoirctodomtraivols)t2uoxrpiydope lics s  rur(ro;o4aeeoifetltfsDrl(mp t0tetnxo iydlaDrlneslt0truoxopoy1lp nlfetat) rur(mono0ope mfetys m2rlumo;u4tetrmo3tatlpD lueo (0s2xrio3nydlmenlfctlsfa2ta( ooo4oex ifcils m2ua(mo;(4altoxrcia1omD  ivols0s2tm(m3iodap nlivilt a2rauronu4aet  f3iysls2ea( p;u0trtomr3iydoateaneils)tetm(r3iu4ol  mfcs s srrmu  nt4optn f3iytlm2ea( o ()tleomo3io1oate uvo (  etoiopio1ol emncil()sruaxr ;o4apxoioctadfmDumnmonu0 leomocootomt livsls t2um(m3ny4omtnmivs ( arua(mpot4optomfeilslaDrm( s t) rxnir oydlateli i () rxm(rpou1omeeliviat)arrrumonu0tpe ioctldlaDuaumsn(0texoxf iodlmt  u ols0srxm(o3no4om elneta() rtr( poo1teeoifetyslsDrlump;t0texnxr iy1fa   ueols0seum(r3iy1ome lfci t)s2uaxrp;o4alxniictad sDranms;t0trtoiociy1omte n olt) rxmim3nydapeelfeil(fartrxroot1tlt  feilt s rauvo;t4arxrmo3oatlm e nei;t0 rurio3oy4omtn nvsltfa2rm(rono0aetomo3iaslmDeau p;t)arxnir3iydfpteaivi s)texmim iy4ol nlnesasfsDtrumo;o1aet ioetasla uanmp;()arermr3ta1op rli ols)teurxopoy1ome  ieils sDum(mpoo1openiieiasfs2elumsnu4trenxocoatfa  livo ()setm(m3oy1lmeemieiat)a2rr(m nt4aex mociltfsDulnvpn(4 lxrmo3iy1lm elivo s0 rxm(r ou4ole lfei tfaruaxrpnt0apeomfeiadfa2eau s (4 reoxo ty1lpt  i ol()tetmir3iy4oleemfcilsf rraxroou1oeen fciyt sDumn pn(0 lxomf oytlpte n s t0 2umio ny1ll emfcils aDtm(m nt0aeeomfciltlsDum( p u0alxrmocoodlaDelu s t  exmxm3io1al nmfvi s)a2rm( pou0tet io3ildla2rauvon(4tetrmo oadfpte neo;()s2xmim oodlp nlfcil(  2rau p;t0apxn fctytfs em(vonu0 ltrmo3oydlpD anvo (0t2tm(opno1alt  fcil()artmu pnt1oeeoif3iad m2uau sn(4 rxnmociadfpDrai ols0setoxm3nydll nlfetlsf rrm(r nt4tpenmf3iys aDelnvo;t0 eeoio totop e nvil(0truo(r iy4lpeelicsl(  Dua(mpot1apeomoetyt s umnmo t)aexrir totlm eauvil( t2trxrpiudoltemfvsl() Dtrurpot0teeoif3iyt aDuauvpnt0 lermrcoy1lpDrluvils)trumim3nu4ap  lncsasfartru p;t4apxoif3tasla rluvs t4areoxo tytfa r ivo;t  2xmxo ou1ol n ieils)srta(rp;t4oltoio3tasfmDeau sn(0aexnmr3oytfpt livo s  rxoir3ny1lltnlivt (fsrrmxront1alenmf3tydfm em( pn(4teeoxf ta1omD auvo;t0 eur(m3ny4omeemicilt) Duaumoou4ole  ieiydfaDem(ms;u0 lxrxrctatfatr nvol(0s2um(m3oodol nlfetl(f Dtaurp;u0aleoif3iyd a2elnmo (4tetrmf3oa1lmte u s;t  euo(rpny1lmt licsasf 2raur ;t0oetoifeildfs rluvpnt4texrmo ia1faDelivilt0s2uoxopoy4amt lneslsfsrtr(m nt4optnmociltls uluvont)alerio iy1fptr neils t2uo(o ou1om nlieilsfs2raxmoou0tetn o3tasfm2uauvo t0tetnxr3io1fm e neo;s trxm(r oo1apen fvsat) 2ra(root4tlto f3ild s2uau pnu) exrxr3iotop  lu o ()t2toim3no1oleemictl(f Dtr( p;o0aeeo fetytfsDum(vsn(4tlxnxf3oytfp  auvs;t)texmxm3ny4lpt  ivsa(fsrum(rpou1apen fciatls2em( snt0texoxr3to1om   uvs;s t2uoxr3iodoltelfctas)s2uaum nt4tptoiieildls emnvo;t0trxnxo3oadlmDe ies;t s2xrir oydom nlnctat) Drm(  ;u0aleo fctltls uauvonu0arxoirciadlptrai sl(0t2toio3nodlpeemneilt  2rmu p;o0tltnmocils a2um(mp u0 rtoxociadfaD liei;s trumxopoo4lpen ietat  Duau onu0apeo o3ilsfa ul( pnt)aetnmr3ty1omteln s;s0texoxr3no4ol elfvsat  2umurpnt4opt ii3tatfs em(vs;t4altrirciytomDe n s;s0srur(m ou1altnmneil() Dra(ront1texomoetytlm ra(vs;t)tlxrir iy1laDean s;s)tetr(r3oydomee nesls aDur(mooo4tet iiciasfm2rluvo;(0tltnio3oydfmD aivo;s)tetr(r3nu1olenmnet t srtrumpot0apto o3tldfa2el( o;(0 ltnxrciatfm e ueolt) 2trxmpoy1lmtemfvta( aDuru  ;u1ape  o3ils s2emnmp;t0 rermr ia1oat livsls t2xr(m3ou4lpt mneilt s2rau  nt4teenioetysfa2rmu snt4arxnxf3ta1fa  ai s;s texmxo ou1omenmfvt tfaDraur nu4tpxoif3iyslm um( p t0 eenxfciy1lpt  u sls)s2tmxr no4llee fvi s  Dtmurpou1tleo oeiatlmDranmpn() eeoif3iodlp rlnesl(0srtmirpiu1ole  ieiasfs2umu pnt1apenioctltla2ul( o t0 leoxr3oo1fmD li i s)trtmxrpoudape  ivtat s2umum oo0openmieias a rlnmont4 lxnxr3oy1fa elueo s0setmimpnu1amee nvils)aDurxr ;o0teen o3iaslaDran ont4 ltnmoctatfaD aneo;t) etm(opny4ap n fci t srrr( p;o4texo oetys m rmumo u0texnxo tatlaDean s;() 2urxo iu1optnmnci sfarrm(  ;t0oetnmoeiadfa uanvont) exoxrciytfm  au s t srto(opno1lleemnctls  Drm(rpnu4tpe ifctaslmDuanvp u4 ltrmf3oodfpDrlnes;t)srxmio io4ll nmies ( a2uaumpno1texnmi3ias mDrmn s;u0altnio3oa1fm r ueo s0 rurxmpoy1op nmietlt)sDurx oou4apeoii3iyslsDrl(vs u4altnmrciatoaDrlies;(  2tmirpnu4apt lncs ()sDrmx pno4tee  fctytfs2uln pnt0tltnxfciy1laDr neilt  eumio iodllenmfvt s)arumurp;t1tleoifeiadls um(mo (4altrxo3oa1fpteaies;s0sexo(r3nodam emfvsat sDra(mp;t4aex  oeiatfa2ra(vp;u0trerir oydopt lieo;s  rur(m3io4ope lfvt (fsDuru pnt1tlxomo3ils s rmu p (0artoxf iatfmtraieo;s srtrir iy4al nlnesas)aDrrxmpoo0alxn f3tydlm el(ms t4 eerir tytom eanvo s0 exo(m3iu4ll  mivsa(faDtmu  nt1alxoii3iydlaDemu p;u) etrio3oy1fatr ueo t  rxo(o3no1oltnmietls  rta( pot4ole mi3iytlm el(mp ()areoxf oa1lpDe u o t) 2uo(r iu1llte fvsas s2raum ot4opt mo3iatfa ulu o t4aleoxr3ia1fm  livsl( srxm(opny1lm  liesa()arum(  ;o4aee ifeiysls2ul(mon(0aetnif3totoatraiei;t0trxrim3nydalt mncias)srtaurpnt4optomo3iltla2eaumonu4teenmr iodlm raivo t) ruo(rpoudopte ivtl( aDum(m ;o4ole if3ilslmDulnmp;u) eermo todoaDrau s;t0 2tr(r iy4ome lfes tf 2rmx pou0oetomfeiadfs eluvp ()tetomr3tadlm eai ilt tetm(rpiu4lmt lneia(f 2um(root0tlxo fciysls uaump u0 lxomf ta1lm eauvi s)texoxmpiy1ame mnvia( srtrxmpno4tptn icilsfs rauvs;u) exoxocta1omteau i;( seumxrpnydope mnctat) rra(rpoo1tpxoiiciytla2ul( p;()tlerxocio1lm r i s;s  2uoio iu1ameemnetat)aruauront4opxnmiciytla ulu p u) etnio3iatopDelueo s s2ur(r nudapen ncsas)srrmxr ou1aeenmocildfsDranvp;u0tlxnir3tatlaDelnvo;(0trto(r ny1lm e fct t)sDtru pot4altomi3tys sDranvs;t0tltrxr iadfa elues;s0s2uoimpou4al  mfvs sfsrtrumont1alt mf3ildla2rmnmp (0aetnir3oa1late neil( teuo(o3iy1altnmietlsfsrta(m ;t1tle  f3iytlm ulnmsnt)aeenxo oydlmt lies s sexrxr3iu1omtemfvslt)arur(r ot4oleniietltf
\ No newline at end of file
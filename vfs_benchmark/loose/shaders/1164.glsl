@@ -0,0 +1 @@
+nvs;s  euo(o iy4lptelncsl()srtr(  ou0tet io3iysfs2ua(ms;(0treoxoctatlmDeaueo () exo(rpiu1optn fvsatfartmumpnt4aeto oetydfaDul( o t) ltnioctodop rlnvil(0s2xmio io4altelfeia(farum( o;u1opxnmf3tydfsDean onu0altrioctodoateaivs (0srurir ny1ll emfcsas aDrrx ooo0teeoio3tysfm eaump u0aetoif ty1oa eli sls srxr(rpoo4lp   fet ( srumum ;o0altoiictldlmDea( s;u0 etomfciotomDe i o t0s2xo(o iy4op  lies (faDumxmo;u1tetn oeiysfm uluvo (4 eeomr3iodfmte ivsl( s2uoxopiy4amenlietlt)aDrmumooo1aptn o3iltfa2rmumsnu) rxomf3tytop elu i t)trtoir io1ol   icils) Dtrurpno4aetnmoetytls2umu s;u)trenxo tadlaDeln o;s0 etr(o3oydll   iviat) ruru  ot0tlenmf3iys m2um( p u)aeermocoytopDeai i s trumxm nu1aptn nvilsfaDrau o;o4tle miciydfmDemnvsnu4trtoio3todfpD aueo () 2xrxm3oo4llen ncsatf 2tr( p;t4alenmoeiyt sDulnvont) etoiocootfmtrlu o;s0s2xrir iy4amen ivilt)a2umu ont4apxnifctyd sDranvo u0tetomr3oydfaDe u olt) rxrxmpnydop e fcsl()srum(moou1optoif3ias s2um( onu4teeomr3iydlpDraies (0srxmxrpoodopt mnctatfs2raurpou1opeo fctatlaDuan s t4 exnif3ootfptr uvo;s) eum(mpou1lmt licta( aDuaxmont1tpx if3iasls rluvo t0aeeoxrctatfaDrlneo;( t2tmir io4omenmnvtas s2rm(moot4apenmi3ias s umnmp (4alxrmr3ia1fm r uvs s) rtrxr3iudlpt lnesltfarrmxrpno0altnifeilt aDrmn sn() rerio3iodfpDelu il( srxoir3oodop elies sfsDur(  ou4tpxo fciydlm2umn pn()teenif3oatfpt  iei s tetriopny1amee ivi s aDraumpoo4apto ieiadlm2elnvont0alxrmfctadlmD  nes;(0seur(opio4lle micsl(faruau  ;o0olxomfctlslm el(vs;u4tltrio3tatom eluvilt0teur(m3iy4lpeelici ()sDrru  ou1oleniieiyd m uanvo u4teerxf ia1lpDe ueo;(0s2xrir iy1ll nlivtl(f rrru  nt4oeen i3tytfs em( ont)arxnmf3tadoaDe uvsl(0s2xoir3nydolt mfcia( arrr( o;u0aptoiociydfaDemuvsn() etomf tydomtr nvo;t) exr(opno1llte feia(  2rmx p;u1openifcild mDrlums t4artoif iatfaDeau i;t)truriopou1ap n nvta()arrrxrp;u0tltn ieiad sDua(vsnu)tleoxr iydfaD ln il()srurio oydomte fesatfsrur(mont0alenif3tls a em(vp;t4 leoxr tadfmDeauei;s)sruoxrpno1amtemfvt ( sDuau  oo0oeeomf3tat mDem(mp t0trenxo3tytfa rlnvs (  euoio io4omenlfeilt aDtr(m nu4aet  feils m rl( s;t4arerif3iadfa  anvi;()srumxmpno1ap elfeil(farurxr ;o1aeenmfetysfm2ea( pnt4alxrxo iotlm  lies t0t2trimpiy1lmtnmnvs sfs2ua( p;u4aetnmfeiadls um(mp;u) rxrirciytom rlnei;s0teuoxo ny4am nmfct t)a2umumpnu4aetn ietatfmDea(ms;u4alxnxf oo1omDrlnvs;t0trxo(r3oo1lmen fcsa()srrau p;u0alt mfciadlmDulnvs;u0 exoxrciadfm  aieils) rxrxr ny1op emict (f 2ua(rpnt4ale ioctatlm2eln p t) rxoxr oadlate uvsl(  ruo(r nodopt lfvs t sDua(  oo4texnmocildls2rmu sn(4aexnio ia1fm e i slt0 2toxopiu4lmen nvs t aDum( pot4altnioeiltlm ra( on(0 eeniocoo1latraivi t0seuo(o iydlmenliesat)a2tax oot4apeo iciys aDean o;t0alxnmf3oatlaDe u o (0 rum(o3iodomenliet t)a2tr( p;o0teto ociysfmDumnms;(0 lxrxocia1fm raivi;t)srxoxr3iudope lictlt srurumo;u0texomieildla em(vo u0aeeoxo3iadfa raneo t0teuoirpnudll e iviasf 2ra(mpou1tlxoio3ild mDemuvs t) etnxf oodop e nvs;t0t2tmio3io4al   ivslt) rraurpou1oexnio3tytlmDul(mo;()alenmfcoydoa elivi s s2umxmpiu1aptelict s  2ua(mpot4aee mo3tydls ranms;t)trenmr oo1lmDraiei;( t2xmxr3oo4lpeemnvs t) 2tm(  ;o1aexoio3ias sDuanmon(4 lxrmr3tytlpt au ol(0 etmir3io4aptemivtatfaDrmx pnt4tle  oetlslmDumnms u4alerxr tadfaDe ueo s) exoim3nu4lmtnmfesat)sDtax poo1olxo fetydlaDrl( o;() exrio3ootlm r ivilt0t2xoir3io4op elnvilt srta( oou4olx  ieiysla2ra(vpnt)trermo iydlmtraieo t0teuoxm3iodlm   ncslsfs2trxmp;o0teenmiciyd s raumsnt0treoirciadfm elnvs t)t2xrimpiydll elfesltfa2rmxr nt4apt iieilslm2uluvo () lermrciodlat lues;( s2to(m nydlm e fcsls  2uru pnt4olenmociydls um( p;t4tlxoir3to1laDeaieils) exmirpnudllt  ietas)srraxm ;u4olt mi3iyd mDuau ont) eermocty1opD  ieilt)s2xo(opny4ll  lfctas a2rmx o;o4aptoiociadfmDelnvonu4 eeomr tadlm  lu sl(0 rumim3ou1aptemnes (f rrmxmpou1aptomo3tys sDeau pnu4 leomf ootlatr uvils0 exo(mpoo1ome lictatfsDrau  ;t4opxoifciadfmDumuvs;t4tlxrir ia1oaDr n i;t  exo(rpiodam  lietls a2ra( pou0openmf3iatfs2uau s;u0tltomocoydlpDe ivs;t t2umxo iodapte fvilt aDuaur ot0tee mictydfa rm(mon(4 lenxr iotomtr i sl()srto(r iudlmtnlnctl() 2uru ont4olxniietls a2emumo (0 rtnmf3oo1lmtran o ()setm(r3nydalte nctl(  rumu pou1tltoioeias a rl( o;u0areomf ty1lp rlivo;() rumim3iydlpt mivsl( sDurumoou0texnmoctls a2eln p u)artnxfctodlm rlueilt) rtoxrpnu4opt mfet s sDurxmoou4aexnioctlt s2uln p;u) rtnxfcoodfp eluvs ( trxmxr iodome lfcsat)a2tmurono4aeto o3tysls2ul( p;u0 rtoif3oa1lptraueolt0trtmxo3iydamtn icilsfaruaurpno4alenioeiltfsDeau snu)texnxr3totlm e uei;t0trur(r nudlmeelicta(faDur(mp;u0oeeniictas m2elnmo;t0aexnxrcootomD  u s t  exm(r3io4oltn ncslt) Dta( p;o4tltoiiciasfs2rmu o t)tlxrmfciodlp rlnei s s2um(opoo1amtnlieilt) 2tm(r nt1openmieiydfmDrln snu0 eenirctydlm rln o;s tetriopiudamtn fvtas s2uax p;o0tetnmoetlt mDuanmpnt0arenir to1oatrauvi;s) ruo(opoy4omt mfvi t sDtmxrpoo1tle  iciatfa um(vs u4tetnmf3iy1lat  nvilt0trxoim oo4lm e fct t s2tmx ooo0oltnii3tad m2em(vpnu)altnif iydopDelieo (0 rtmio3iu1op   ict t srurx pno1texo o3tytfa2um(vo t0trtrmr3iytlp  aivi;t  exrxo3nodlmee nei s  2uaumonu0tee iiciatlsDel(mp u0tetnmocoatlmtrli i t)t2tmimpiu4olt mfctasf Drmu  nt0ope  ictlsfmDum(mont4tlenmf ty1omD anei;s0setrxo3iy1ol nlivt (fa2rmumonu1tpx mfciyt s emuvp t0tlermrcto1fmDe nvi;s)seurio iy1ol  mncs t  rrru p;u4olxn i3iadfaDuluvsn(4tltnxrciodlmtr u ols sexm(rpiu4ll  lieias)srtmu oou4tle  fciasfa eanmp;()tleoif3oydfm r n i;t)texr(o3io1lmtnlicsltfs2ur(m ;t0apx mo3tadfs2emumsnu4 rxnif3oodlmDraneo s texo(m3oodlmt lfes s artm( ont4oetoifeilsfa rm(mo;(0 rtnxo ia1lptr neo;s  exrio oy1omeemfci tfaDrm(rooo0apxnif3ildla eln on(4 etrmr3iadfm r nvolt) 2xoxo3iu1lm nmnetas)sruaxro;u0opeomoeiaslsDra( s;u0aeerxo oa1oat lu i;s t2xo(rpiudol  lnes t)artrx pou4olxn fetad s elu o t0aleoifcoa1optr u o;s sexrio3no1ap e ivsltf Duaur nt0olto feiytlmDrln sn()aeenmr3tytlatrluvo;s0sexmxo3io1lmt mnvtlsf 2rax ono4tlenifetlt s2emu s ()aexnirctodfp rau i s)s2uo(m3iydopenmnci (  2ua(mono4texomf3tad s2ranvonu4 ltrirciotfmDean o (  2ur(rpnu1oltn net s)srtmxmonu4texnmf3tyt m2ran p t0trtrxo oytfa rlivo;()srtoio oo4optn nct sf rrr(moot1oet mi3iytfa rmums ()aetoircta1opte nesl(  exrxo3ny4ol  lnvi t)sDtaxr ;t0oexomi3ilsfa uaums;u4 rxnmr iodfmte ivo;s)setr(m oydaptn ictat)a2trx ono1oexomi3iytfa2rlu o () rxrxrciadfaD luvs t texriopoo4lmtnlfvi s s2umuronu4tpxnio3tlsfa2rluvonu4artnmf oydlaD  neo t setrio3oy1oltn nci s)sDtr(rpnu4aptnmfciatlm rl(vp;(0alxnxr tytopDrli s;( setmxmpnudope lfeias) Drrxr ot4open octld a ul(ms;u0arxnio oydfp  ln ols  rum(rpno4omtelncs t a2uax  ;t4aptnioctas s2ulump;t) lermf oodopD lies (  2urxo io1ape licia()s2tau  oo0opxnmfctadfaDrl( pn(4 renir3iytoat auvo;s trxrxr3iy1omenliviasf Dtr(rp;u4aet  iciatfa rmu snt) lenmo oytlptrlieol(0t2urir3oo4omtelfvtl(f rrmurpou0teeo oetas s2elnmon(4artomf oa1lmDeauei s)trurxmpiy4lmeelncslt)srum(mo;o4tpxn i3tyslsDul(mpn(0 eeriocio1fm  lueo s trxo(mpio4ap   fesas)sDum(r oo1alxniociatlsDumuvo t4trxrmocoytfmte nvolt0 rxoxo3oy1lpeemietlt  Dtax pno4ole ifeilt a2uaumpn(0aexnmfcia1fm e u ilt  rtmim oydlptemieta(f rumumpou1tptniictytfsDeluvonu)aeerxf totomtelnei;s)sexrxm iy4lle lfcils  rrm( o;u0olxnmf3ias m uanmo;t)trermr to1faDrauei s setoim no4om  lncslsfaDtr( onu0tle ifciysls rlu p;u4 rtrxo3todopDeluvs;s)srtoxopnudlp  lneslt) 2raur nt4tetoioctltfm rm(vp u)artomrctotoaDeluvsls)s2urir3iy1olee nvsa(faDrrxr ou1oltnmictytlsDumnvp;t0trtrifcoytoatean o ( trtrxopoo1ameemictas) Dtaumo;o1tle  oeiaslaDrmnvp;t0 lxrir3oadoaDrlnvslt)sexoimpiy1aleelfeilsf 2rm(ro;o1aexnmictytls2umuvo;()aexoir3iytlmDelneils srxmio3iudlltelicils)s2umump;t1alenmfetaslmDum(mp;()altnmo ty1op  anvslt0 2tmxopnudamtnmnvsls) rtmu pnu0aeeomoctydla ua(msn(4 exoiociy1fptr ivs;t setoir oo1op emicil( s2taxmp;o0tpe io3ildfsDrl(ms t)aetrir3io1fpD lu ols0 ruoimpoy1lptnmncsa(fartmx onu1alx mi3tydfm uauvo () ltoif iydoatrluvs t0sruoio3nu1amee feia(fsDumxmpoo0ale ioeildlm eanmp;()aexrioctotfaDeluei;()srtm(mpoo1lme  iet tfs2raum oo1ope  f3tytfaDeau onu4 ltnmo tytoate n ilt0trtoxm no4ape  netasfartrur ;t4aee  feiydfs ea(msnu0trtoirciy1opt aueols)t2to(r nodlpt lfeilt arrmu ooo0apeoioeiasfmDel( s t4artnmfcoydfp  liesls sexm(o3no4op nmicils  Dra(rpnu4olen oeiysfa2ulnvs;u)trermrcoytoatrau ol() 2xm(mpnu1lm nlict t sruauroot1tlt  fcilsfm umuvsnu4tlerio3iydomtraivo t0setoxo oudol  mnvt (faDrr( pno4ole  octasfsDum( pn()teeoxo3ia1oaDelnvi;s) 2ur(m3oy4opte fvtlsfaDumu pou4teenmo3iys a ran onu0arxnmo3ootoat li s;s teto(rpoydopt  icsatfaDumx  ou4ape io3ildla2ra(vpn(4treomfciotopDeau ils0srto(rpnodomtn fetlsfaDurx p;u4aetnmfetasla2umu on(0tlenxfciadomtrauesl() rxo(o ny4lltnmiet s)srraum ;o4ope  ociydls ua( onu0 rxomf3oatlatr ues () rtoxopno1am emfcsa(f rumxro;t1altnmoctas m2um( p u4alxoio3oo1om  au i;(0t2um(mpio4ol n icil()srurx ont4olt  i3tysls umn sn(4 rtrmr tatla r neo ()s2tm(o3nodal elncs ()srtau pot0aee  iciatla2ulu snt0 rxnxr3oydoat  i o t0texmio3oudalee ics sfsDra(r ;t1olxomiciysls2ulnvo (4 eenir3oodomteaivs;s)s2ur(m3ou1op n ieslt)arumur nt0apt  ieils s rm(msnt)trtnxf iotfp raieil( trto(o oudomee ics ( a2um(mono1tpxomoeildfa umn p;t4 eeomo3tadoaD aiei s0 etmxr oodolt lfvsltf rua(root1ape ifcildfsDra(ms;(0tltoio3oatomteai i;()t2ur(o3ny1lmeemici ( s2tmxr ou0tptnmoeiat aDul(mo u) leoiociotoa   uvs;t setriopoydap eliei ()aDraxmono4teeo f3iytla2uauvp ()artrmf3todlateaueo t) ruo(m ny4ll e fvsa(fa2urxmpnu1tpto ieils aDea( s u0tlxoxr3tytlp eln ols0 eurxopoodlptnlict t) 2trxrpoo4tpx io3tatfmDum(vpnt)aeenxf3oy1la   nvi s tetm(m3ny1lptnliesa(fa2ur( p;u1alxnifcildfm uln o;(0 etoxf tadfpD  u s (  rur(mpnydolenlict sfaDra(m ;o0tpen iciadls el( s;u4 lenmrcoadlpD anes;(0srto(opou1lpt lietat)artrxr nt1apeo i3iyd sDrlu s (0trenxfcta1omDrli o (0 rumxopiu1ope  nvsl(  Dtrum no4apen ocilt a umumsn(0teeoxrcoy1lmDraies;s0tetmimpoo4ole mfcsls) Dtm(  oo1open iciydla umu s;t0altrmo3oa1fp  aivslt texoimpno4ll e fesltfaruaxmoou1aet  oeias a ran o ()aetoxociatlp eauvs (0tetr(mpiydlltelfesl(f Dra(r ;o0olxo feiasfs2rl( s (4aexnxf3ty1faDeluvols0 ruoxo3iodalenlnct (f ruax  nt4olto oeiasfa rmnmsnu0 exrir todla e ueo (  2tmxr3oy1ome  ietat) 2ra(mpou1altnifciadlmDua(mpnu4 rerxocootlm elnes;t)seum(r iodopt lncils a2rm(mo;u1alt ii3ildfs raumsnu0 ltrif iotfa r ivi;()srxrxr oy4am  mnesls)sDua(mpou0tptomfctlsls elu s u4trerir3iy1faD livs s) 2urxm3iu1lltn fvtl() rtru  nt4tee mi3iltfm2uaumo u0 lerio tydfa r nvo s0s2toio nodlm e ivtltfs2umu  ;o4tpt mi3ias sDemnmp;u4altnmfciadfa rlnvo;()srur(r3oy4am  mfvt t  2rrump;o1opxomi3iatla ra(monu)teenmf tydoate neols0 2toim nodapeelictat)aDumxr oo1oee mfciltls uluvo ()texnirciotop e ivo;()tetmimpio4ale lfes s)srra(ro;o1olenifeildlaDrl(msnu4tlxrmrcootoaD lu o (0 euoxo nydlmt  iei t)sDtrumpnt4ole  f3iyslm rl( p t) rerxf3ty1opt  nei;s srtoir no4lmtnlnesat arurur ot4opxn fetat s2el(ms u)aexnmfcoodlaDeln o t0 euoir nydlmenlivils) 2urum ;t4tpxomi3ilsfaDul(von(4alxrmfciatlmDraivi t0trtrio3iudal nlfct tfartaxmonu4alxo oeils s2umnvs;(4tlenxfciy1fate neo s0setr(o oodlptn nei ()s2ur(r ;u0opt  ieiys sDumumo ()aexnmrctodom r nvo;s0t2toxo oo4lptemfvtat aDrr(r nu0oetn oetlt m elnmp t0arxnif3iodlatr ies;s0s2xrir iy1oltemivt s)srumxm ;u1altoifcild a ul(msnu) eeoxf oatomDe uvol(  2ur(o3iydolen fct t)aruau pno0tlt mi3ilt a ra(msnu)artrxo to1fa e ieo;s)srto(o3ou1op  lies t)s2rmxront1aeeo f3ils mDulnmo t)trtoir iy1fmtran olt)srum(o no1lle lnvta(fs2uaump;u0tlxnmietltlm uau o;t) renifciy1lmDr nvslt sexm(mpoy1altnlfcslt srur(r ot1tlx ii3iysfm2rlu p;t0 rtnmrciatomDr uvs;s srxm(mpnodomte nvt tf 2ur(r ot1ope iietytfs2emnvs t0alxomf3ootomtrauvs (0tetoiopoy1altelfcsls) Dum(m nt0ape ioetlsfs2rlnmp t4alxrxrciytlm  lieols0s2uoxo oy1om emfviltfa2taumpoo4texomo3iad s2uan pnt0tlxomf oydoa elivi;t t2to(o3ou4lmee ietl( s2tm(rooo0tee ii3iltlmDumnms u0aeermr3ia1la   ieil(0t2toir3iu4apeemiei t) 2tm(mpoo0tpe mfciysfsDuanvo (0tltoif3io1lptr n il()teurxr3no4ap  micias) 2ua(rpno0tetnioetltlmDrlu s (0alxnir3oodoptraivols  2xrim oy4om  lnes t  rua(m nt1tlen ictlt sDrl(vo u0 rxrio to1oatrln ils)srxoir no4al nmfciatf Durxrpnu0optomietadfaDel(von()tlxnifcoa1opt aueslt s2uoxrpiodomte fvias sDrrumoou1ale ifcildls2ranmpnt4 lxrxo3ty1fa  an o;t0 ruo(mpny1lpen fci t sDrm(  ;u4olt mictld mDrluvo;() ltoif iadom  lnei;() rxm(o3iodape  netls)arra(mo;u4tleo ieiad a2elnmsnu4artnxr3tadop   uei t s2xrxo iodll nmnei s)sDrmurp;u0opxo icilsla2elnvo;(0 lxrxfctatoa  li slt)trxmxrpno1aleelfcilt sruau p;u1alt mfciatfm2emn pn() eerir3iodlmD an s;t)truo(r3oy4ll emivs t s2uau  no0tpeoioeias sDuanvont4 renxr3to1fp rlneolt trxo(m ny4opt  nviltf Drm(rpnt0aeenmi3iytfs ea( p (4aetoio iy1fp elnvs;s0 etr(m oy1omt  nciat) 2rm(  ;o0tlxomo3iytlsDumumpnu0tltrio to1om elneols s2xoxm3iu4aleelnvia(faDtrumpoo4aet ioetls sDra( p ()altrmf3iatoaDeau olt teto(o3no4optnlnvtl() Dua( o;o1olxnmictad m elumpn()tlenmf totfa rln ol( tetmir3nu4omenmicta()srumx  ot4oetomoetltfmDrlnmonu4trxrmo oy1oatr nvsl()trxm(o iudllee icsltf 2taxmpoo1apenmoeiasls umnvs (0trxnmf3oa1lp  liei;s0texr(rpou4llenlfci s  rta( oot4tetomfcildfs ra(mo;u4 exnmf3ta1faD  nvs;t  eurxopnu4lmtn fesltf Drruroot0olxnmieilslm2ran p;u) etnmr oodopt lneo;t0teuo(o oo4ol elivtatfsrta(ronu0tpxoifctys s2uanms;(0treniocty1fp r nvo;(0trtrxr oy4ap n fvia(f Dum(m nt1apeomieildlaDumump;u4arerir3iydlmt  nvi;( s2toiopio1lmte nctat)srrm(rpou4aeenioeildlm2em(vont4aexnmo oadlp  livs () euoio oo4lmen nvils  Dumx oou1oet iociys s ul(vp u4teenxrcoydlp  livi (0srto(r ny1llt lfviltfa2rau o;u0opx moeiatlm2umn o;t)artomfctotopD anvi;()trtm(m3ou4amtnmnetls) 2ur(rp;t4ole iocilt m2um(vpnu)tetrxf iy1fpDr neo;t0 2toim nydamtnliesl(fa2rrxr nt4ope ioeiadfa um(vp;t4arenir oadfmteaneo ()tetmir3iu4aptelieiat) Dtmu pou1tpx  ieiysfs2um( pn()artoirciatfmDe uvo;()srtrio3no4ameemfvilsfa2um( o;u0apxo o3iaslsDrl(ms (0 rxrmrciytfm   u o t0s2tr(o io1lmenmnvia( sDtm(m ;u4tpxn oeilsfa ra( pn(4tetomr3tytlat  nei t0seto(mpnydame mncsas) Drm(moot4aeenif3iys sDuan s (4tlerio oo1fm  au il()trtoir io1om elnvslsf rtaxm nt0alt ifciydlm ul( s u0tltnxr totlm elivs ( sexrirpiy1lpt mieiatfa2ra( pnt1ole  octldfsDul( p;t0trxrirctatop  ai olt)tetoxmpny4ap nlnctat  ruax pnu0tpenmocias a eluvonu)tlxnmr tatlm ranvsls) rtoxo3nodlpeelncsl(f 2urumpnt4tlxnmo3tldla2emnvpn() etrxr3tytlmDr uvi s  2to(r3iodlm n ivs sfsrurxmpnu4tlenif3tls m2elumo u0aexoiocootoaDrlu ols0srtmio3ny1omtnlfvta(f rrrurpot1openifeiatfa2eauvp;(4trxnmfcty1laDrauei;( srtmxr3oodom n nei s sDtr(moou1olx micilt m2ua(ms t4artnif oa1fmD anvi;()tetoir3iy1lleelncsasfsDumxr ot0ale ifciad a umumon(0aeenmr to1fpDeau ol(0 etmio3ny1alt lfvs t a2rrxrooo4optn f3iytlsDrm(mo;t4tltnif3tatlaD  n i;s0srxrir3nydop elfeilt aDrr(rp;t0tpe if3tatfm2ua(mo;(4 rxoxf iatoate ueo s)srxo(rpoo4ll n fet ()s2raump;u1opt mfeildfsDra( p;t4treomociotfpt aivo;t t2toir3oy4lpeemivi t  Dtaurpnt4oleo ociyslm elumonu0alxnmocta1oaD ai o s)texmir iydll  mfci ()aDuaxmp;u1apenifctydfa2rm(msnt)aeenifciadoatr n ols0trxr(opiudlpe lnviat arrm( pou0tptn feild sDumn ont0aeerxfcoadomte nesls0trtm(m3nydopt  fct tfsDururpoo1tptnmietatfs elu s;u) rtnxrciodfate iei;t)t2xrimpny4ame  ivt (  ruax  nu1tpto oetydls elumpnt4trxrxf iydfaDran olt sexoirpnodlltnlnei s)sDumxmpoo1aleoiieias aDemu s u)texnxo ta1omtran s;s0srumxm3iu1amt  fctat  rtm(r oo0tltomiciydfs2rm(monu)teeoxf totfa rauvslt trto(rpnu4ape lfcils)s2rrx pot1tpen oetldfm2em(vo;t4texrmo3iatlaD lu s;t) exmxm iy4alen iviatf 2ur(rpnu1aee mfeiadfa2eanvs;u4aexnifctatoa r uvil(0t2tmxo iodalee nei t  2rauro;u1oeto ociatlm umuvpnu0aexrmo3totlaDeaivslt0seumxr3nu1op   ies t) Dumu p;o0olxomoetasla ua(mo t)tlxrir3iadoatranvs;t)srto(o3nydole lncs tfs2rrx ono4alt iieiadfs2el( snt4texomf3ty1lmDr ivolt)seumiopnudam e nct (  Drmumpno0aeenifciad m2umumsn(0arxrxf oodopt lueo () etrxo oy1lp elict s) 2ur(m ot0aleoii3iydlm2elnvo;t0alxomrciytfp r ieo;t0 2trxm iudomt mfci s) 2ra(r nt0ale if3tlsfmDea(vsn(4teerxf3iodlate ivs t  2toxm iydapt livi t  rumurp;o1aptnmociad a2ulump;(4 ltrio3iodom rlneo;( srum(m io1lm nlneilsfarumxmpno4olt ii3iad a rlnms;u)teermo3oadomDr ues (0s2tmim no4am  mivt sf Dtm(rpot1tlxnifeilsfsDrlnvp (4tltnxo ty1lmtrln ols) eumxm ou1lmt  fvia(faDrmxm ;u0aptnmiciaslm ulumo u4altomocto1omtrluvil()srxmio3oydll e fvi t aDra(  ou4olenmoeiyt s2eauvs (0 rxnmo oy1lptraueols  2toio oy4oltelfctls s2ua(ro;u4ole  f3iyt s um( s t0 exrmr3tytlm ranvo;s)trur(m oy4om nlnvs t)s2rrum ou4aex mf3tas s2ulums () etnmf tydlp  lnvi t0truoxo oo4om n ict (fs2urx pou1tltomoctas mDelumon(4teeoxocootlpt anei;s) exoio3iy4ap nmneiat) 2taxmpou4tlx mf3ildlaDua( s;(4 eerxfctatlp e u s s) rxoimpio1omee ivia() 2rrum ;o0tpxoifeiyt s el( s () etnmo3oodop ean o s0trur(r oo1llte fci ( aDra(r oo1tpt  feiyd m rm( o;(0alxnio iytlaD auvilt0setriopoy4opeelicilt)aDtmump;t4oltomi3tls m umnvo u4 rtnmo3ty1fmDr nvs s  ruoir ou1alt lfeias)srumxm ;t0aee ioctlsfa rl(mp (4tlxrxo oo1fpDelivilt) etmxrpio1al nliviasfa2tau  nu0oexomoetydfs2ua(ms u0trxrif3to1fpD lu i (  2xr(rpio1lpee nvtl()artm(ro;o4tlxnioetls m2rmu pnt4 ltnir3todfat anes;t)srto(r iy1am  mietlt  rta(r ;o4aptnmf3tas aDemnvo u0tetomo io1la  lneo;s0srtrxo3nudlmt  fct sfsDum(ro;o0alxnmf3tytlaDuauvs;(4 rtoif oa1faDraiei (0 2urxo iodlpeelnct tfaDraumo;t0alxo oetytlm2ul( s t0 rxnxociytfpDe neo;()s2xrxo3iodame mietlt aDtrxrp;o0tpx mo3ils s rluvonu0artrif tytfa rai sl( texo(mpiy1lp emivt tf Dtmxm nu4tptniictadla rm(mp u4altrmf3oatfpD  nvil(0srxo(m3oodopenlnvs ( s2tm(mont4apxnifeiadfa2uluvs;(0 exrmo oy1oatr u ils)s2um(m3nydaltelncsat s2rrxmpot1alxo fciys sDem( s u)tltnircoodomD luvs t)s2tm(o nudapt lncias)a2uaxmpno1oee iiciatfm2ran s (4 exnir3iodlaD ai s;( t2umxr3nu1alte feils) 2rm(mono1aetoiieiysls2ulnvon(4trtoifciytom rluvsl( trtoxm iydomte fcsas arum(mooo0texnmiciad m2emn s;u0aeerxf to1lmD ai il( s2uoirpiu4am nlncs ( s2ta(  ot4oetnmociatlmDua(mo t4tetrir oadopDeai i ( setmir iudol n neslsf 2tru  ;u1aeenif3tydls ra(mo;(0 lerirciodomD livsls sexm(opiy4lm   ncsatf 2ra(m ;u4oexoiiciys mDrmnvp (4aeenxocoy1opD auvo;t)s2uoir iy1opeemnci t)sDtau ooo4oee mociltfs ul(mp u0texrxfcto1fate uvs t0 2xoio3oo4amtnmies t a2raum oo0tptoioeiad a eau s ()trxrir to1fmtrlnvo t)srtmxm no1lmeemivslt) Durxm no4olxniocildfsDrlumonu)trenio3iy1lat an s t0teurxrpno1op elfeiasfaruaxmo;t1oeenioeiydfa eanmo ()tleomrcto1lpDrlnes ()srto(m3ny4lmen iesltf rrm(r ;u1optoio3ilslmDua(vp (0tetrioctotfmDeai o ()teur(rpnodap nlnctl( sDraur no4apxomf3ias s el(ms;u4 eermr oytomDrlivo;t)srtm(r iydlltelnct (  2ur(mo;u1openii3tytlaDemnvp;u)treomf3oa1fmtr ivs;s0 ruoxr3ou1lptnlfes t)aDtmxrpnu4teeo oetas sDeln o;t)aexnio iydfmD livi;s  2uo(opiydale mfct (  Dra(mont4opxn f3tasla2rln o;u0 ltoxf to1fp rlies s0texoimpoy1amtn iviat)srra(r ;o4opxnmfeiat sDem( onu)aeeomr iatfpDelneo () 2xmir3ny4am   ivta()aDtaurono0aet  ieiltla2ea(mont) rtnxrcoydfa e n ol(0tetr(o3iy4lpt  fvsls)srrrxmp;o4aleomf3ilt a2uln o;(0aetrxrcta1latraivs;s0trto(o iu1lpt mneil()aruax oot0apeo fctadfsDeaums;t4tlxrxf3tatlp rluesl(  rtoirpou4alte fvta( a2rr( ono0olenifciytls2em(vp;()trenxo3totlm r nvi;t0 rumimpoy1op  lies s) rtrxmo;o0olenmi3iat m ulnvs;u0tltrio3iy1opDrai s t)truoio3oy4om   ncs t sDur(  nu4oeenmf3tltla ea(vo (0tetrxr iotlmt  ieil(0s2umxm oy4al elnvtatfarrm(m ou1oetomfcilslm ua( onu4arxnmo oodoate n olt) 2toio3oo4ap n nct ()s2rrumoot1optnioctlsfm elnvo t4altrio oa1omte n o;(  2xoio3iudol e ietlt)s2ta(m nu1altn f3iyd a2ea( pnu4aleoxr io1lp eaivilt  etrxrpiu4ap emfci s)aDurxrp;o1oexn fetysfsDum(vp u4 lxnmo3ia1omteaneil( srurxmpno1optnlnvsa(f rua(r ot4oetoio3tas sDea(vsn(0 etomo3iytfpD ln ilt seto(rpnu1lp n ncsls srtr(  oo0tee io3tytlmDel(msnt4aeenxfcta1lptelnei t0t2xmio3oy1ol nlicias)arraur nt1apt ii3iat a2umnmsnt0 eerir iotfat  n o;s) 2xm(mpnu4lptelicilt)aDrmx pot0alenio3iysfmDul(msn()tltrxo iy1lmDe nei t0 rto(rpnu4am nmncil(fs2tmurpnu0aeenmo3iasfaDranvp (4texnmo iotlpDe ueo t texrirpou4apeelfetlt)s2ra( o;u1oexn octyt s2ul(vpnu0 eenircootomD  uvi;s0sexrxmpnydap   ivil(f 2uaxmono1oeeomieiad a ul(vo t0 ltoir ootlpD aueo;t0 ruoio3iudaltnmivt (  rtrum nt1oeeomoetydlsDulnmo t4 lxrxo io1fpt  i ol()tetrxm3iydlmeelfetls)a2rmx pou4alt mi3iydfsDea(vs;t4artrmr3io1lpt  uvsl()srurir iodlp nlnetatfarrru  ot0tpenmoeiad a ua( ont0tlxoifcoa1oat lnes;s srur(opnydolt miei t)a2raxrpnt1teeoifeiasfs2rm( pnu)tetomf3oodopD ai i ( tetrxr3iydopee ncilsf Drrx p;t4oexnmi3ilsls2rm(mp t0trtniocootlmte ivi;t)trxrir nydom   ncs ()a2ra(roou1tpeniictydlm eanmsn(4aexrmf3iytoatr ivo;s0trur(opio4olt  ivt s)srrr(m nt4texnmoeiysls um(vpnt0aexoxo3iytlpt ln il(0sexoxm3nu4opt  fvta( srur(r ;u0aetoio3ildlm2um(mo t4 rxrir tadfateauei;s sexm(rpiodamt mivtlt) rua(m nu0texo ociydls um(vpnt)tltoifcoodfaDraieol() exoxr3no4aptnlfei (fsrtm( pou1tlen iciytls2rmump (0tetrxr3iotomDranvs s srxrxo oo1ape lfcsa(f rrau ooo4tptomf3iatfaDel(ms;() lenmo3ia1fpD lieo;s  2xrir3no4al emicta() Durxmo;o4aetoifctlsla emu pn(4arerxf3oytom elueil()srxoxm3no1optn fcils)srumxm ;u1aptoii3iad mDrluvp;u)texrirciy1opDranes;( trtr(opou1ap e fcslsfsDra(m ou1apeo fciadla2emuvo;u4tlenxfcoytfmtrai il(0 etm(m io1lptnmivsl()sDtrxr ;o0tlxo i3tatfa rl(mon(4tlenmr iadlmDr n o s0srur(m nydalenlicsls)a2uauro;t1aptn o3iydfaDemnvonu)tlermr oydoatrliei (  rurxopiu4lm   fvil(fa2uax oot0tpeomociyt mDem(mo t)aetnmf oo1lm  lneo () 2tr(r ny1llenmfvt tfa2urx pot4aptn i3tytls2emu o t4 lxnmo io1faDrliei t) rtmxm3iy4aptn nctls) rraumoot0tlt iiciydlsDuaums ()arerxo3ia1om  aieol()t2xoxo no4ale liviasf rtm(  oo1tpxn o3iytfsDem(mo (0tetrmf3oytfatrlnvi;s srtmxrpoy4om nlfvils  2tmx pnu4tlen fctldls ra( p;(4tlxrmo3tytfp   ieo;()trtm(mpou1om   feta()aDtmu ooo4oeen oeiaslmDeaumon(0texoircoatom  ln i s t2uo(o io4ope  iesl(  Draxrpou0aptniieiys m rl(vo t)teerxo3tatfa ean sl(0seuoxo3io1lptemncil(  2rmum oo1apxo ociltlm2rmuvpnu) rerxr3tytlateaivsl(0setmxmpiudlp nmnvs s)aDuaum ;t4optnioeiydlsDumn sn(4 rtnxf oytlpD au ils0s2xmim iy1ome lieiatf 2urumoou0optn fctltfa eln s (4tltrxo totfmt luvs t0srxrir nu1ol elieil(  2trurpnt1alto ictldfs rmnmp t) ltoif3to1laD  ivsls0trurxo3iu4lle mnci sfsrrm( p;t0tlxnmfeiad s rluvs;t0aetnmf3tatfaD auvs;(  2xrxo3nudolt  fcsl(f 2tax pou4texn fctydfaDelu snu0arxoifcoodlp e neo;t teuo(mpiy1al  lfctatfaDrr(mono1aeeomicildfm emumo t0aexrxrciatfpteaues t0 exrir oy4lmt lfesat aDrr(mpoo0oeeomfcilslaDrl(ms;u4arxomr3ta1fmt ln i;t0sexrim ou4am nmfetatf Dumu p;u0ape  o3tld sDelumpnt4aeermf iodlmDeanvil(  etoxm ny4altnmiesls) 2rrx ono0opxnmoctyd a2umnvo ()trtriociytfptr ueo;t)teurxopiu4al e nct t)aruaxr nu0ale mi3tytfa2eanvs t)aexrmf ootopte ivsls teum(m ny4om emncia( sDraxmp;t1tpeo ocilslm emnmont)teeoxo3io1oateln ils0tetoxr io4opeelicsatfsrtm(r ;u0opxn iciatla el(vp (0 eeoxr ia1op elnvi;t)s2xrxo oodap emivta(f Dtm( pou1tpen ieiydfm elu pn()tetrxf oydlate i s t trxm(m3iodomenlnvsl(f rum(mo;u1tptoioetysls rm(ms (0trtnxrcta1lp raivols)t2toir3iodaltemnesl() rrau ono0opxn ociatfsDumumo t4trtrio3ia1omteaivo;(0seuoio iodope  ieias  2tr( ooo4opx  iciltfm ea(vont0tlenxf oydfa eli i s0trxoirpio4lmenmivslsf rurur nt0optnmfeiltfa umnvp u0 etoxf iotoaDeanei;()srxo(m io1ap   ivsatfsDur(ront4aet iiciatfmDua(msn()alerir3iytoptranvi s  ruoir io4omte nci (fa2rmxr oo1aetnmi3ildfm um(vsn(4tltoxf3ty1opDr ivs;s)t2uo(m3ou1lpe lneia()aDua(rp;t1ape  octas a ua(mo u)areoir3oatfaDr ies;t0seto(mpiudlpe mieiltf 2rmu oot4ape io3tltfaDel(vs (0tetnmfcto1lmD an o s)srxmio oy4optnlivil( a2rau onu4olxo ieiatlm ulnvs;t4trerifciy1faD au ilt0t2tmxr oy4ope  ivsa( s2tru pou4teen oeiydla ranms;t0 lxoxfcoy1lmD luvs s sexoirpiydop   fes s a2rmx  nu0oleomfcild mDeau snt4tleoio3oy1lm e iei;()trxoxr3ny1lm emies t  Dtmumo;u4aetn octys aDrmnvon() lenxoctydla rlu i;s0 rurxr no4apen fvtasf 2taxm no1aptnmieildfa rl( p;()artoio3oatom eaueolt s2urio ny1op   fcsl(  2um(m ;o1tpenmo3iatlmDrl( o;(4 exnxo tydomD lieil(0srtoxo3oodol  micsl(  2umurooo1oleo fciydfmDuauvpn()trtoxrctytfpDran s t) 2ur(m iudap nlivsasfsDtau  no4aptomoeiatls rau pnt4 etoif3iatomDeai il( srumxopoydlpeemicilt a2uax pot4aeeo oeiyslm eau o t0 reoifcto1fmtraneo s)teto(mpio4lmte fes s  Drmum nu1tpx io3iat s ul( s t) eeoxo io1fat  ieo;(0 exm(opiodlpte fctltf rumx pot0apx iictld m2em(mo t4texoxrcio1faDeaneol()t2urimpio1om  lietlt sDum(r nu0open f3iydls2em(mpnt4 exomfcia1fpt auvi;s s2tr(r oydap  lncsl(fsrraxmoot0apeoii3tyt aDumn s;t4 lenio3io1lpt  nvo t0 etrir oo1ale lfci (fsDur(  ot0apxnifciysls ran pnu)arxomoctydom elnvs s)srum(rpiodlpeelnciltfs2ra(m nu4altomi3taslaDumn o;t4 ltrir3oodoaDrlues t0srur(o3ou1llenmictlt)artaumo;u4olx iocildfa ea(ms t0 rtrmr tydlmDrli o;() rumxr3ny1ll  miei s) Dtrumont1aex mo3tadfaDranms;u4arxnmf oodoate i olt)srxoir3iudolt  fvsat srrr(mo;t4tet if3ildlmDea(mp u)artrircio1la   nvi s0truoxmpny1lp nmnvta() 2taur no0tpxoii3ildla uauvo (0trerxo oydfaDr i s;(0 2xm(r3nu4lle mfeia(fsrtmx p;t0oet  o3iaslm um(vo;t)trxnifcoodom ean ils)trumxmpny1apte neiat)artax oou1apxoiociatlm2eauvo (4 etnxr iodfaDeaueslt  rxm(mpiudlm nlfct s sDra(rono4tex micild s ulu s (0 reoxr iadomDrln sl(0 rto(r no1amenlneiat  2umur ou0tex moeildla2uan pnt0 rtrif iatop e nvi;( teurio nodlmte fcslsfarraxrpnt0tlxnio3tadfaDeln o u4tltomrctodopDelueo (0s2xm(r3ou4lm e nvil()aDuaxm ;u4tex  ietld mDumu snt4alenmociotlm   neolt0s2tmir3iu1altn ncsls) rua(m nt1tleoiociadfm2rmuvo;u4trxrif3iytlp  auvs s tetrir3oodape  iesas srtmx  ;u0alt ioeiydlm2uau ont0 etrir3ia1latrlieolt) rtmxr ny1lleelnvt tfsDtr(rp;t4tlt  f3ilsls rau o t)aexomoctadfmteai i ( texoxo oydopte fvilt)a2ua(  ;u4tle if3tldfs2ran o (4arxrmo ia1fpt lieo;s)setoxm3iydll  mnci (fa2raum ;o4tetn oeiydlaDel(vonu0aetrif3io1oatrai o t0 rurir3iu1am  lfcia(f 2umxrpnu0olt mfciatla2rl(mpn()texnxo3ta1fm rlnes t)s2xrio iudapee nctas)s2rmuront0tetoiietlsfa2ulnmpnu) lenif ty1lpDr nvi;s)seto(o3io4om elicsa()sDtru  ;o1teto fcildls emn s;u4 eenxfcto1lmD  ivol(0trxmim nudom nmnvsa(  ruaxmpoo4oexniiciltfm uln snt0altrmrcoodfptr uvs;s  2xoxm no4lmtnmivsls  Dra( onu0tpxn f3iad m rmnvsnu0tleoir3totfpDr uesls) exmim ou1al  lnct tf 2umxr no0tpt  fctatlaDeau s t4tlxnif3todlm eaivi s)t2tmim3io1am emfcsltfaDtmxr ot0olxo ocild a emnvo u)tlxoxociytlmDrau s;t0setoio iy1alt lics s a2raxmo;u0oeeoifetldfs ra(ms t0 rxrif3ty1lp r u sls t2xmxr3nudom nmncta(f 2rru  oo4aptn oeils mDeluvs;t4 renxociytomDe n sls)seuoimpio4ope  nvta( srtmxmo;o0optoiicilsfm eluvs;u) lxoir3iotlm r nei;()s2xrio oo1altemfesl( a2raump;t1tpeniociytlm2ea(vo u)aexnxr3iy1lmDeauvs ( t2xrxopio1ap nmfetl()aDrrumono0aeen oeiatfsDemnmont)aleoio iydoptrln sl()truo(m3oo1lpt micsl( sDrmx ooo1alto f3iltlm2rm(ms (0 lxnif oo1lmtraivils)t2urio iodll  lncslsf rur(  no0olenmocildfm2ranmp u)alxomf3ty1oaDrlieo (0srxm(o iu1llte ivi (fa2taxm oo0tpxoioctas m uanvs;(4 reoiocoydfm r ivolt)srxo(mpno4olt lnvia(f rraumpot4texnmfciydfs el(vpnu)texoif tydopDrlivs;s trumim3no4omen ivtas) rrmumpnu1aexomfctatls2emnmo u) lermo todlmDean sl(0 2xrimpoy4ope lnvta(f rtruro;o4tex ifcild m2uanvonu0tltrxf tatfate nvi s0 2xm(m3ou1omtemfvt tf Dua(ro;u0tex ifetasfs2elnvonu4aetrirctatfmt aues;(0s2umirpno1lmeemici tfa2ua( poo0tet  f3tasfaDrlnms ()tlxoxr3io1fmtrln s;() rumiopny1ll elneilt  Dtr(m nu1aleo oeildfs emuvpnt4artomrciydoa elues t seurio3iy1omtn iesl(farurxrooo0teto fctydfaDraumpnt0arxnio ootfp eanes s t2xmir nu1ol  mfvsas s2ur(rpou0ole if3tyd mDeanmont)tetrmr3tydlptr u i;( t2tr(o3iy1ll elnetatfs2tr(mpnu1altn iciys a rm( o;(4tlxnxo oy1lm e n s (0s2tmim3iy1omtelneils)a2rauront4teenmociydfa umuvs;()trtnmr3iydomDrauvo s srtoxopno1lle livtas  2tr(mo;t1tet  f3iysfmDeaumsn(4aexoif3to1op   i sls)sexrio oydllen neslt  Durx  ;o0oleomfetas s rlums;t)tetrifctodopD  uvilt0 etm(m3nydop  lnetlsfa2rrxm ;t0apeoiocias s uau pnu4aexrxfctytlptr ueo () 2toxopiudol  lfct () Dtaxm oo4aeenioeiytlmDel( pn(4tetomr tydfp elneolt0 euoxo oo1alte nesas)sDuax  ;u4optnioeils aDeluvo;(0 rtoxo3tydfpDr nvil(  etoxm nu1lm nmnct (faDtmum nu0tpxnmieias a emumsnt)aexrmrcio1oaD  ivi ()sexoxo iodlpeelivs t)artaumono1altn iciydfs rmuvpn(4 lxomoctydomD luvs t) etoir no4lptelfcsa()s2trxr nu1tlxn iciaslmDrluvpn()trxoio3iodoa  auvo (0 rxriopnu4lm  lnci ( s2ta( ooo1oee mo3ildlm eln s t0 rxrio tytop rlneo t trtrir io1op n fvtl()artmumpnt1oeeo ietad aDel(mp;u) exomfcoadom elu s ()srur(m oo4lptelivs (  2trumo;t4aetn octltfs el(monu0 etoxrcia1fm  aivils0 rtmir iu4op   feil()aDtmxr nt0oex  fcilslm rmuvs u4texoif3ia1omtr neo;s)texrir io4lmtelfvilt arurxr nu0aeenmf3iysla2rmnvo u0altoxr iadfp  aueol(0 exoir3iudlpenmiei s) Dta(  ou0aeen icildlaDumn p (0 rtomr iytlptraueslt0trxoimpoydolee nes sfsDta(rp;o4opx  fetld a2rl(mo t)tltrmo oo1la ean i s0 rxr(r3oodam   fct (f Dtaxrpno0ale  iciadfsDemu p;t0 leoxr3iotomDelieilt0 2urxrpoy1ame  icias)aDrr( oot4teto o3tys mDel( s;(0tlxrmo3ta1fmtelu o;(0t2trxm3iu4alte ncilt  Draump;t4opt iictas s umnms (4aeermr3oa1lmt auvo (0seuoxm3iy4lp nmfeta()srtaxrono1texo ociatla um(mon(4tltomfcto1lpt an o;s  2uo(r nydlpt micsa(fartaurono0tpenmfcild s rm( onu)alxoxocta1optrlues;s0tetmim3nu1lmt mncs t)aDtr(m nt0oltoifciydfs uaums (0 etrxr3iatfp rau olt)t2trxo iydomtemivs (  rtmur ;u1olxoif3iydla2umnvonu) reoio3iytfpD  i o;t)tetmxm ny1amtemnesltfarrrump;o1altn oeiytlm umnms t4areomo totlp eanes s0trur(opou1am  lncs ()a2rmxmooo1tetn oeiytlmDea(mont)alenmrciy1faDrlneo t0trxmxm ny4apeemietl() 2ra( ooo1opt iietyd m2emumpnu)aleomo oydom  anvs (0 exo(r nodom  miesat) 2taur nu1alxn oeildlm ea(ms;t4 leomr iodoptrlnes;( srum(m3iodam elnvils  rtau pnu4tee  ociyslsDelump;t0alenxr3oatoaDe ieo;s)s2trim oodlleeliesasfsrtmxmo;t1tpx mfeilslm ra(mo u4 rerxfctatopD auei;t0 rxriopoydomeemnesas  2tm( onu4aptn ociyd mDranmo;t0 rtrxo3ty1lm  aies;s)s2xo(o3oy1om nmfes tf Dtru ono0oee  o3ilslm2emumo (0artnircoodomDeauvo;t0tetoir nu4oltelnes tf Dra(mont1tltomietys m2ua(ms t4tetoxf3todlmtr ueo ( trxmxm3iodoptnmictat)aDraumpou4optomfciasfsDuln sn()tlenxocta1omtr nvi;()setm(opnodal e fvsatf 2ua( pnu4aleoifeiltfa emuvo;(4 lxnif3iy1fmteanvs ( seum(o3ny4lme  nvs (f rumurpnt1oetnif3tas m2eln on(4aetrmo iadlm ran i;(0setrxm3no4op  lfeiasfarurxm nt1aexo oeiyt s2el( s ()tlxoircta1opDelu o;(0setoxm3oodoltnlivias  rrrxroou1tle  oeilt m umuvo;(4trxnmo3io1omDe ueils)srtm(opno1ame miesl(f 2umx  ;o0tetn ociatfa ea(monu0tetrmociadom  lies t0tetm(m no1lptemfvtasfsrraur no4oleoio3iydls2ul(mo u4artoxf ootlate ivils  ruoxo3iy1oltnmfvsat) ruaump;o1aetoifciydlm emuvsnt4tetnxf ia1fm eln ilt0t2xoxm nu1openmncslsfs2taxrpno4tle  ictltfa2ea(vp;t4alerxr3todlp eluvslt) rxm(opiodalen ics s) 2tmu  ot4tpxo i3ilsfmDemu s;u4texrxoctytla e nei;s0tetrxm3ny1ll nmics sfa2umx  ;t4apx  ietysfa uluvs;t) rerir tadfpD li o ()trxrimpoodllt mfci ( s2umu oou1teeomietyslm uln snu)tltrxr3ty1fa r u o () 2toim3nu1lltelneia(faDrr( pou1apxoiietltfs2em(vp t4aetrmr3iadfa  anes;() ruo(m3iudlp   fvtl( s2trumont0oltomoctyslaDumuvp u)trenir3oa1op ran i;s) rxm(opoydomtemiei t)arrru  ou1oltoifcils s2rluvs (4tleoif iy1lmt aueilt  2xrxo oo4ome lnvsatf rtrxront0oex mfciatfs emuvs;(4tltoxo3oytop rluvs;()setr(o3iy4olte fvtas a2raxmo;t1olxoif3iadfs umuvo u4tltrio oy1fm  aies;(0 rxo(o3iydoptnmivi t) 2tm(mpnt4tltoifeiydla ea( ont)aeenirciotomt li i;t) 2xrxr ou1lpeelneta(fsDrmu  ;o0oexoif3tydlm2umn p u4areoxfcoatoa  au ol(0s2trir no4lmeemfetlsfaruaxrp;t1ale mi3ilslmDem(mp;u)trxrmfcia1opt aivo t0s2uoxrpiydapt mfci () 2trxroou1aex ifetldls rm(vp;u4 reomr iadfptrau i;(0srtmxr3oo4aptemnvta( arrr(rp;o4tlx  ieiytfmDrlnmsnt)altnio3iatopt livi ()trtrim3iydomtnlfeta(f rum(rp;t1tpto f3ildla elumont4 leoxr3tatom eli o s  etmiopoy1oltelivtls  Drru pnt1texomf3iatfmDel( s t)tetnxo3todfmteanvi (0sexo(o3nu4lmeelnetls)arrax p;t0aptoif3ias m ranvp t4trenxf3oodoa  lieslt srxo(mpnydlmenmfcils aruru oot1tpt mf3tad s emuvo;() exnxfcio1lm  auvs;t t2tr(mpou4ole mictat)s2taump;u4tpe moeildls2rmnvon(4tltoifctadoaDrli sl() eur(o oydame mfcilt arum(mpnu4aexnmfeiadlmDrmu s;t4aleomo todlm eln ilt  euoxr3no1om eliet s)srurxr ou4alen f3tls aDem( p;()trxrxf3ootfaDr ivi;s)s2uo(o3nydamt lfvtl(f Dtaxrpnu1tlto o3iysfm ulnms;(4arxrmo3oatopD anes s0srtrirpiu4ap  livslsfa2tm(ro;o0ope mfciad m ra( s;u)tltoxo3iotoaD  uvo;(0seto(m3oy4alee ncta() Draxrpno4oee mo3tyd sDrlums;(0 eerxr3ta1oatraivs;(0s2tm(opoy4op elncs t sDuaur ;u1aptoif3iatlmDeaums (4trtnxfciytfatranvs;s)texm(o3ny4amt licil()arta(  ot0tlto fctysfm2eauvonu4artnxocia1fpte ivolt0t2tmim3nu4lltnmnct sfa2uaurp;t0aee  o3tad mDul(von(4 eenmfcootopt luvils)trxr(r no4omt miei s  2um(mp;o0ope ii3tas a elnvp u)aexoio3ty1opDeauvil()setoirpiu4ll nlfvs t)srra(r ;t1oet ioetydlaDrmump;t0 exomf iy1lpD  n s s) 2umxm ny4om n ivs ()sDuau  nt4opxomf3tys sDrmu ont4 leomrciydlaD livolt0 rxoio oo1ape mfvs sfaDtrxm no4aeto ieild aDean pnu4arxrifctydomtr n o ( t2tmio iudlltemfei s a2raxmp;o0opxn o3ild s ean p;u) rtrxfciydom eaivi;s)t2umxm3no4ap elivilsf rumump;t1tpe iiciltls rl(vp;(0trenif tytlpDe i i;s0s2xriopoy4om e nvsat  2rr( pot1tptn f3tytla2umnvs;t4tltomo ootlpDrlivols  rtmio3oy4ap  mict s)arrmxm ;t1tlt mictldfs2eln snt4tltnmrciy1lp eauvi;t) 2umim3oydll e ivsatfs2trxmpnt0tpxniicilsls ulnvp;u0aetriocoydfaDeluvi;s0s2tmimpno1apeemnci t)aDrau pnu4aetn feiyd s emn s u0texnif3tadfmtrai o s teur(r3iy1llen ncsl( arrrum ;o1tlxomfciydfm eaums t) ltrir3oadlptr i sl() exrxmpnu1lmen iesasfs2trur no4altnmociysfa eanvo;t)tltnxrcoatlaDraueils) exmxrpnydopt  fcsa(f Dum( p;u1tex mo3iltfm2emu pnt4 ltrmr tadlpt ln s;s0trxoxmpou1ol n iet t)sDrrxrpoo4olt  o3tydfa eanvs;()alenif3iytom  ln s t0srxrimpnu1ale lneta(fsDrmxmp;t4tle mf3ildlm rmnvp;u0alerxr3tatoatr nei s  rtr(m3oo1am elnctatfarurumpnu1tpx  fciydlmDraumonu)alxrio3totfm ran s;t sexmim3oy4omeemivtlt) 2tru  ou0tpeomi3iltla ra(vs u0arxrxf3iytopt  ivi t0 rxoxrpoy4am nlfcs ()s2uaum ;u4tpe  iciys mDum(vo;t4trxnif3iytopteau i;s  exoim oo1omtelfvsa()s2ua(mpno4aet ii3tadlaDemnms;t)alermocoytomDr nvsl(0seumxm oy1am elnet sfsrua( oot1altomfctydls2ua(mo;t0trerio3ia1fa  aies;s  exr(opnudaptnlfeslt srum(mpoo1alxomfciadfm umn s;t) exnxr3oydoatrauei;t) etmim3io4amtemfviat  Dumx p;o4olxnifeiasfsDemuvo (0aeermociytoa e neo s sexo(m io4lle  ncsltfa2ur(monu0teen ieiydla emnvs (4trxnxr3oydfmD  ieslt srtm(rpiudopen nvsa(  rum(m ;u0aptomoeiyt a umumon() eenmf3iatfaD  ies;(0srurxr3nu1lmtn ivtat artmx p;u4olxomfctld aDrluvs ()tlxnio ta1lmtrai o;t0 rumxo nu4lpenmieia(  rumur ;u1tpx moeiatlm uau s u0 exnmf3tadfaD livi ()srxoxo nu4ope lfeilt sDuru pno0tpt mf3tat s2em( s t0alxoxr to1lp r nvo (0s2umxmpoydlmtnmnctlt srurx pnu0openmfetyt a ra(vo ()aleomoctatlatraieol()texoimpoy1optemneil()a2um(m oo4apt iociytfm eanmon(4tetnmr oytlpD aueilt)t2xr(rpiy1am   ict sfs2rmur ;u0alt iictlslaDeanmonu4alxoxf3ty1omDelneo;s srxmxopny1lm nlivilt aDrrx poo1tle moetatlmDrl(ms t0trtnmf3ta1fp raivi t0 2umxr3ny4lpeemfvs s)artmx ono4tex mfeiysfa ulnvs;() ltomf oo1lptraivs t)t2xr(r3iydap n nesa(faDrau pou4tpto fetlsfm rlnvp;u) lenxr3tadfaD aivo;t)s2uoxr iy1oltnmict sfsDum(r oo4tee io3iydlm2uanmo t) rermfciatoatelnvs;t0trurxo iodlm nmictls srtmxmo;o0olt moeiasfs uauvo;t0 leoifcoy1omtrlu s s0t2xrxo3oudam nmfeslsf Dumum nu1tpen ociys s uan sn() ltoio oa1lp  an o;t0sexr(r no1ol  miesatfa2taxr ot4tetomiciatfs ean o (0 etrio oo1opD lieolt)teuo(m no4apeemnviatfsrtru  ;t4apt moetasls eauvs t4artoio totlmt  i o () rxmxr iu1am emnei t s2uaxm nt0ope  ictld sDum(mp ()trtrmfctodfaD auvilt)srxmxm nu4lp emivt t)aDurxrono0aee ii3tasfs2uauvp;u4 etrmo3oa1omD auei t  eur(mpoy4llt  nvtls)aDtaxmo;t1tex mo3tad m2ul( s u0tlenxo todom eanesls0 rtr(o iu4am e fvt t srrr(m nu4aexo iciadfmDrm(mo (4 exomo3totfptr uvils  exoxr ny4lpeelnei ()sDrr(rono1aexn o3iyt a2eaumo;u)tetriocoodfpte i o;s)t2umir3iu4ape mnetlt) rtmx  ;u1aleoiociltfs eaumo;u4tlerxf iy1om  aneols trum(r3nudomt miesl(  2trxr no4tlxn o3iltlaDra( o;t)teermr oatom  anei;t0srtoxr3oodom e fci (f 2ur( poo0oeeomo3ild s um(vsnu4texomo iy1latelu i;t s2xmimpiy1omeelfetlt) 2urxr ;t0tlt if3tysla el(mo;u)trermo3ia1laDeauvs;() exoiopnodop  livtl() rtr( poo0optn fctadls umu o t0aleomf3oodopDranei;t0tetmio io1alte ietas)s2rr(  ou0tpeo feiysfa2ua(vs t4 lxoxf3tydfmDr uvolt t2xoxo nydame mfcta(f rumxrp;t0oeeo ictlsfmDel(monu)aetnio3iodfmtr nvo;s0teto(m3iydopt livilsf Dumx pno0olx ifeiysfs2rauvs t)tlenifciadoptelueo;()sexrimpio4opte ivil( arrru  nt0olx iocildfaDel(vo;t4 lxnxf oytop elueo;s  euo(opio4om  mnvilt)srrmxm ;u1apxoiieild a2elumo u) rtrmrctydfatraieo;(0t2tmirpoydlm nmicsls)srrmumo;o4oexnmfciytlm2rau p;(0treomocoytlpDrauvi;(0teur(o3nydale mfet s)srur(ro;t1tlto i3iyt sDrmu p;t)artnmf iadfptr i sl()trtm(m3ny1lpt lfctasfaDurur ;t0tpx mieiytfa ra(mpnu)teenif3to1latrauvo t)s2uoxo3no1lltnmfcslt  2raum ot1alxo feiyd a uauvs (4alxomo oa1fa   n i ()seumiopoudap nmfcsls aDtrx pou4tltomfciytfa2rmump (4altoio3oatfatran o (0t2urio oodomt mies tfsrrm(  ;o0tetomfciltfs2ua(vs u0tleoxr oydfmt an s t sexr(mpno1om  lncs s sDuaxmonu4alxnmfciyd s ul( pn(0teenxfcoadfmtrluvs;(0 ruoim3ny4lme  feias arua(m ;t0oetoiieiadfaDrmnvp (4treomo todlm   u ols0texoir iydlm n fcil()sDrmxr ;t0tlt ioctatlm ra( sn(4 ltnxrciydomDrliei;s) 2tm(r3oydaptemieia(fs2uauront0oetnifetad m2um(vp;(4arerxrctadoa ranvolt)sexmio nydal emfei t s2urx pno4tlt ioeiys a ua( o;u4tlxnio3tatlp eanvo t0 rum(mpoudop emfvt ()s2rr(m nt1altnmfciyd sDran s ()tlermf3to1la r n i;()trxrimpiydape liciatfartaxm no1oetoii3ils mDrm( o t0aetnif oatop e ivo (0 rxr(m nydameelfeiasfsruaum no0apenifctatlaDeau on()alerir3oy1fa raivs s setoxm nudll e fct s s2rmuronu0apt  ieilt a2eau ont0texoxr3iytop r ies;t0t2tm(mpnodll elfcs t)arra(m nu4tle mfciytlm ranmpn(4 exoxr iadlptrauvsls  2to(r oy1alte nvi sf Dua(  ;u4olto iciydfaDel(monu4teenifcia1fa  aieslt)srtoimpoodlm nmfvt s  Drm(  ou0oexoio3iydla ranms t) etrif3oydla rau o;s0s2ur(m io4altnliet ()aDrrxmo;t4tptomieiasfm elnvp;()trermo oy1fmD  ivs t sexrxopiudal elfvs sfa2tm( ono0alt  i3ildfs2em(vo;t) eenxfciydlat lnvs;(  exrxm nodom n nct sf Duax pou0tle  ieildlsDelu s t)texoio3tatomtrluvil(0 rtoxopoo4ol nmfesls srtaxr ;u1oet ifctadfs rluvs (0arerifcoodomt auvo ()seumio oudlpe lfvs ()sDtaumont1apeniieiadfmDua(vo;t4texrxo3tytomt aues;t0setmir3nydlp nmics (fsrra( pot1oee mi3tlt a2ranvs u4tlxoif iodfaD aieolt0 exoio iy1ameelnct t sDta(mpnu0teen ictad a uln p t)tltnmr3tydfpt auvs t0 exmxm oodlp e nctls a2rr(mooo4teenmoeiadlsDra(msn(4aeeoxo3totfpt lieslt0s2xm(r oy4om nmivsat) rrrur ;t0tlen ictat mDea(mon(0 rtnif oodfmt ln i t  rxo(opiu4lm emnvtas aruaxmo;u4aet iiciydlm2ra(vs;()alxnircoadopte nei s  2uoimpoy4ll elnci (  2tr(mp;u1tleomoeiatfm umu s u4arermrcootlp e ieolt) etoirpnodll e iei sfa2ta(  no4tlenii3ild aDrm( snu0teeoircto1lm  aivsls)trtr(m3ny4omt mnetltf rumxr ou4oetnmfeilslmDumuvo;u0alxoio3oadomt  uvol()t2tmxrpno1lmenmfcia(fa2tm(m oo0aeeoiociat a ra(vs u) lerxr3oydfmtr nvi t0sexoirpnodlmt mfvs t  2rmu pno1tlxo feiaslsDeanmpnt0 ltomfciotlpDeanes;(0seur(m no1lpeemnvs sf ruaur ;u0tpt ioctldfm uln p;t0 rtrmf oatlm e nvo;t) etmxm nu4al elfviat)arrmuro;u4tptomo3tasfmDranms (0 rtrxfcoydlm rlivs t t2umimpiodamee fcsasfarraumo;o4ale iieiltls raump (0teenircoydlaDean s;()teurio nudal nlnet s)aDrm(mo;t4aee ifeiyslm2emn p (0altrmr ootfaDe ueo;t)s2xo(rpio4op   fvtl(f Dtm(r oo4texo f3ild aDel(ms;t4treomrctadfpDe nei;t)texmxopoo1ol  lnvia(f rrauronu0tet  ociytlmDrl( sn()tltomo tydfmtr ivs t t2urxmpno1optelfeilt  rtm(  ;t4oetomoeilsfmDeaums;(0 rerxrcto1oaD lies t s2toxr3ny1am nlfvsatf Dtaum nu4olxniieiatlaDean o;u4artnir3tadlaDraies;s  rtoimpnu4olee net sfaDrmx pnt0aetoifcildfa2eln o;t)tltoxfcto1laD  uvo ()tetrio3oudapenlfvsl()arumx  ot4aeenio3iytfs emuvonu)aetnmr iotfp ranvi (0 ruo(m3nodamee fvtat)a2taxmp;t1tlx  oeiadfa eanvs;()teermr3ia1fmD ai sls)s2urxo3ny1lmtelncs (fsDrruroou4teenmieiytfs elu p;(4altomo3iytfaDr neslt)s2um(opou4am elfvtas)s2ua( ono0tex  iciytfm2rl( o;u4texoir tytfm elu ilt)trxo(rpio1omtn ictl()aDrm( p;o4tptomfeilsfs2rlu onu0 rxrmo3iotoaDe ieslt srtrir ny1lmee ivsas)aDtrx p;t1oeeoiiciatfa umums u)areomo3ta1laD li olt trum(m3ou4apeemici sf 2ur(  ot0aeenmocildls ran p t)alenmf iadfate ieilt0trtr(r3no4ope livi tfa2rr(rp;t1aee  ietls s2rmnmsnt)trtnmocoadoptr ieo t) 2umxo nu4ll nlivi tf rtaxr ou4oex mo3ias s uan o (4aetrif to1fp  aivo (0 2tr(opiy4oltnlivi tfa2taurpnu4apt if3iydfm em( s (4 rtoio3iydomt an s;t)tetoxm oo4ameelieta( s2raur oo1tptomo3iadfa2uluvpnt)tetnxr totfmDrlies;t srxr(rpiy1olt lfvsltfartmx  ;o0tlxoiictadfs2ua(msn(4 lxnxf3tatfm elueo t0teuoirpnudapenmnesas)aruaur nt1apx mf3tadfaDean o;u0trtnmfctotlmDrlivi t0trxrir oodapeelncias)a2rmump;o1ope ifeiytlaDrmnmp;u) rtrxr oa1lpt luesls)s2uoxm3oy1al elfcsa() 2rm( p;u0tpe mieiydfsDrmnms t4 eenxr3iydoa   neo;( sexr(r3oodol elnesltf rrrur nt1oexoio3tyt a2el(mo;(4teerxo3tatlmD aiesl(0tetoxm oudopt lictat arrmx p;u1opeomietadfa2rm( o (0arxrxr3tytlaDean o;t texmxmpoydaltn nes sfartaxmonu0optnmf3iysfm2rmu s;t0texoxo oo1opt  n i (  2xmim3io1lm   nctltfartmur oo4ole mieiltla2eanvsn(0aexomr oy1fa  anei (  etrir3no1am emieta(  Dtaxmont4olt moeiad a rmn s t4trermr oa1om   nvo t) 2ur(r io4omen iei s) Draurp;t0tpenii3iysfm2rluvo;t4aexoir3iadfmte uei s) rxm(r no1altemiei sfa2rmur ot4optoiiciysfa ea( o u4 rtrxf3oy1fm eauvs;s0s2ur(o3io4lmenlfciltfa2tmu ooo1oeen fetatls2eanmpnu4trtnmo oytfpDelu i;s0truoim nu4omt mfcsls aDra(m ;o0oet  i3iyd mDranmsn(0 lxoio iy1lm e ivo;s)trum(o oydlmt lnesa(fs2urx  no1olenmfctadlm rmu pnt)artnmf ty1latean s s srto(mpiodalen icsl()srtmx p;o0teto ietytlsDem(vs;t4arerio oodom  liei t0setoxrpnydlm n ieias)aDuax pno0oleo octltfs rluvs t)tltrxf3io1lptr n i;s  2xoxmpoydol  mfetlsfs2um(ro;o0oexn iciaslaDrln onu4arerxo3ia1omtrai o;(0teum(rpno4ol emicil( s2um(rp;t0opxomo3iatlmDum(vo;(4aexnxrciotomt lneo s s2tm(r3io1lp  lfetat) Dtm(ronu0texoioetls s em( s ()texnxf oatlm  ai il(  etoimpiydap n ivt () Duaxmono1oeto ociadfsDuanmp;u4artrxr3tadoptraneil(0 2xoxo3nu1ole livs s s2rm(rpot1tltnifetysfa elu pn(4aexoxo iadfatraneo;t)srurxopio4lmtemiviat)a2tmurpnt0olx mfciatlsDumuvs;()teenxf tydopD aieilt  2urxm iodame  nesatfsrua(rono1teen ieiyslm2eauvp;(0aetnxrcoytlp e u olt0 rurxo3oy1ll elnetltfaDtauront4tpxomiciasla2ulnmsnt0 lerxf oa1fm elieol( texmio3ou1olee icilsfarrrx  ou4optnmietltfaDeaums ()tltrmf3ty1oatelueo;t0 rxm(r oy4opt mnesas s2tru ooo0oexnifeiys s umnmsnt0trxomo totlmtr nvolt setoir3ny4ope lnciasfsDrr( o;o0ole mfeiasfaDumump;u) rtnmf oodfpDrai ilt  2umiopnodlpenlnvia()s2um(mp;t1aeen i3tytfs rl( s;(4alerxrcta1omDrlieol()texm(opnydll n fvia( a2rau o;u4alenmfctldls2ra( p t)artnio3io1oaDeaies;t0 rto(mpoydam elnctls)sDrr( p;o4opx  ictydfm eluvpnt4 ltrmf3tatlp r u s s) 2umxrpoy1omeemncilsfs2trumoou0opeomfctytlaDulump;(0arxrmfctodoptrlivsl(0srxoim3oo1omee ivtlsfs2tmx o;t4aleoiieildls2umnvo () rxoif oatop raivi t0texrxr3oy1lm  mfcsltf rrmu o;u4ape ii3ias m rln p u4 renxr3ia1fp   nvi s)trtrimpoudlmen ici s)s2tr(  no4tpxnioeilsls2emnvo;t4 lerxocoodomDrauvils0srtm(r iodop nmics tfa2urxmooo0optomociasfa2ra(vo;()alxrxf tatlpD  ieol()t2tmirpnudlltnlieslt  Dtrxmoot0oltnio3iysls2em(vo (0altomociodlpD lnei t  rtmxo iydap   ictls)aDur( pot0ole mo3tydlmDrl(vsnt0 lxomo iadoa r n i s  rumxr oy1am   ivsa(f rurxmo;t0teen feiad aDum( o u4 ltoxf3iotfaDraieslt0trxoxopoy4lmte ics ( sDta(roou1tptnmfeilsfaDelumo;(0 exoifcoy1fm r n o;s)texmxo3oydapt  fctas srra(rpoo0tleoii3iat a ulnmo;(4trtoir tatomt aieils)t2xm(o3iu1altemicsa(  2tmum oo0apeo i3iydfm uluvpnt4 rtrirctodopD  u s t)srtoxm3nodol e ictlt)sDumxmpot0oleoif3iatlsDumu snt0trxrxf iodfa e ueils  rxm(m3oo1ol n nctat s2tmx pou1tlt  i3ilsfa rm( p;()treoifciydlateluei ( texr(r no1amenlivi sf 2rrxro;u0aeeoifeildla em(vpnu) rtnmrcty1fpt lneol() 2urxrpoy1lm e iesa( a2tauro;o4tltnif3tas a ra(mon(4treoxf3tytlpteanvi;s)tetoir ou1apenlietat)s2uax pnt0altnmociadfa umnmp u) lenmf3ty1om   ivil()tetoir3oodaptnlfvia()sDrruro;o1alx miciys s ean o t0artoiociotlmtelnvs;s) etr(r no1ome mivi (  2ra(m ou0ole  i3tasls2el(vo u)trtrircia1latraivols  etr(o oo4lmtnmfviat)s2tmxmo;u1aeeoifeiad m ea(monu)aexnmfctotfp  auvilt srtrxm oo1lme lics t aDra(r nu4opxoif3ildfaDulump t)altomr iotfmDeai ol(0s2tmxm nydlmeemnet sf 2taumono0tpe  fciytfsDean sn()aeenxfcoatomte nvo;s0t2xrxopno4optnlicslsf 2tmxm no1tlxoioetatfm2ran o u0alerxf3oa1lpte uvslt srurxmpou4op  mfesat) 2rrx  ;u1tex mfciatfa emumsnu0aeerir ia1late neo s) rurim iy4alee ncsls) Dumuro;u4tltniociatfaDrmuvont4tltnirctatlatrlieols srxrim oo4llte icil(fsrra(  ;o1tlxnifetyt s2el( o;t0trermo3oodlpDelivsls0trtoio3oo1llt mfvs t) 2raumpnu0tptomieiadlm2ra(vs t)alenio3ia1faD  ieol(0t2urir3iy1opee ivtl( aDurxm nt1tle miciadfa2ea(mpn(0tlxoxr todfa rai o s0 2toxm3iudapenmivt sfsDtmxmo;o0apen ocilsfm2rauvo t)trenmo3iotopD  ieo;( texmxo3nudllt lfvi sfartruro;o1olx mf3tas mDulnvo;u)aleoif todopDean ilt t2xmir3nu4opt  nvsa(f Dua( pot0tlx moeiyd m eanvp;t)trxoio3ootlaDe ies (0 2umxr3iy1al nmivilsfartau o;u0tptoifcilsls uau p;t)trxomfciadlmt liei;t0t2xoimpoudapt mnvslt) Drr(m nt4aeeomoetltlm2umu p (0areoir3iatfp eln i;(0 2uo(opoy1om   nes (  Draumo;t4oexnio3tld mDraump;t)tlenir3oa1lat auei (0sexr(o3no1ol  mfcil() rrrxmpnt1tex  feiadla2eluvp ()trerxr oo1la   u i t) etoim3no4om e fes sfsDrrurp;o1alt ii3iysls2ulums u)trermf ta1laDr ieo;(0trxr(r3iudaptelfci t aDra(r ;o1aetomoeiydfa2uanmp;() eerxr iadoaD  ueils0s2tmio oo1lmeemnesatf Dtaxmonu0aetn i3tydfs2ulu p;u)aexoifciy1fptranvsl(0seur(r3iy1am  mnetas) Duaur ot0tlt moctysfm eaump u) lxoio3iy1op r nes;(0srxr(mpiydlmeemfvtasfarurxr no1tet  ieiysfa2ea(vo t4texoif3oodfmD  nvs;s) 2umxr oy1optn nvtl(fs2rm(moou0altnioeiad aDelnvs;t4 rtnmo3iodfp eaneols)s2tmxo iydlpeelieilt) 2ta(mono1apeomfctys mDulnms;t0arxrmf tatlatraieols seto(r oy1ole  ietltf 2tau oot1oexniociydfm2raump;(0alerxr ia1oat livs;s)trxr(rpiu4alen fvsa(fsrua(rpno1aex ioctatfm rluvo u)aetrir3iydfmDrli i s)truo(o iydop e ncta(f rtmxm no4apenmfetlsfm ul( s (4 rxrxf tadoptr n o s)trumxr3ny1ame mncta()srtau  ;o1oetomietldls2em(vs (0 ltriociytfmte neslt s2um(rpiu4openmnvs (fs2ua(r nt1oet mfetlsls2umn s;u)teermr oytomD lies ( t2xoir nu4opt liciltf rumxrono1optn ocilsfaDul(mo t4teenxr tadla rlnvi;(  2urxo io4altnmncil(fsDrrum ou0aptnifetld mDrm( p () etrir oytfpte nes;t)srum(opnu1olenmnes t)sDtax p;u4alxn fciad m rm( s t0aeenirciytop   uei t0s2urio3nu4opt  ncsl() rum( ont0tpeomfeiat s2um(vp;(0aexomr3iy1lp  an i;t0s2xmim no1amenmfvtlsfarua(mono4tetomoetldlaDuau o;t4 etnmo io1oateaieil(0t2toim no1lm emietat)srum(mooo0oetnmi3tasfmDum( s (0trtoiocoadom  lieo;s) ruo(o3iu4lmenmfcsltf Dta(ro;t4apeo fetasls2umn o;()tlxriocto1om   i i;(0trtoxrpiodaptnliei t)a2ur(m no4aetomfctls a2ra(vs;(0aexnmf3iatoa rauvo (0teto(m3io1ale  nvi tf 2tr( pnt1alxnmfciydfa2em(msn(4areomrctytlm   u o;t) 2xr(opoudaptnlfci s)sDrmu  ot1oetnmieiyd a2ea( p u) ltnio3iotop rln i;(0 2uoxr3iodllenlfctat arum(ro;u0aet  o3tyd a el( s ()aleniocoatlaDeaiei;t)tetr(o oo1ol e fvs (f rtrx pnt4olx  f3ildfm2eauvp () lerxr3oa1op elueo s)teurxmpoudom emictasf 2ra(ront1ope iociydlmDulnvo t4tlxrxr3tadoa ranvo;()trxr(m iudlmeemfcs () ruau  oo4oexo fcilt m umuvp;t0 exrmrctytoaDrau s s)s2tmio ny4omeelics s artrxmpnt0aexn f3iatls2umnmpnt4 exoxr oydop eaiesl(0srxoir3iodal e fetlt s2rmuronu0oeeo fetasla ra( p (0altoif3to1lmD  i o;( sruo(r iy1lm e nesl(fa2uru pno0olt ifeildfm rl( p;t0tlxnio3iy1faDeli i t0t2xo(o oy4lme lnviat)aDumxrpoo4tetniocilsls ua(mo u4trxoir to1fpD  ivs;( teum(o ou4ll e nvslt)artaum oo0oexniiciydlm2rl( onu0 leomrcoydfatraueo;s  2uo(opny4llenmiviat a2umxro;o4tee iietad aDraump (0 etrxr3iytomDe uvilt  exm(opiy1lp nmnvtas a2rru pnu0tlt mo3tldfa2umnvo (0texoiociadla r ieo;t s2tm(mpoy4lle  nvtls) rum(mp;o1oet ioetadls elnmon(4 exnirciydlat lnvi;t s2xoim nu1lm e iei (fa2rrxmoot1tlxo fctys m2uauvs;(0aetnmf oo1op elivs;t)setmxrpno4lpte fei (fsrurxm oo1tpxoioctld aDraump;t4trtoxf3oatfatrluvi;( truoir3nu1am e iesa(fsDuauroou4tpt  feiytfs elu s;u) leoxf oa1oateau s (0s2xmxr3oo1ameeliviat a2ta( ono1opx mfciltfsDrm( p t)altomo iodopt  n slt0 2ur(mpio1opt mnei ( arumump;t1olenifetldlm rlnmo;u4 rtnxo iodfmt lnes ()setm(o3oy4lm n ivtas)sDur(r ;t1olxo fciaslaDua( onu4trerxr3to1latr ieo;t s2xoxmpoo1lm  lnetas)a2ta(rpnu0teto ieiydls ran o;u)trxrif3oa1omDe uesl( tetoimpnodlltelnesat a2tr(  ;o4open iciatfa umu p t0aleomf3tatom r i i ( teuo(r3nodopt mfvtas)sDum( onu1optnioetltfs2ran o;u0trxniocta1opDelu ils0s2xoxmpoodap   iesl( aDra( pno1aee ifctasls2umuvs;(4alxnxf3to1fa elivo t0s2tm(o iydamte ivsa(faDtm(rpot0altn oetatls ranmp;u0 exrircty1lmtraies;()s2xmiopoodlm  mfvs ()s2rax onu4aeto oeiltlsDeanmp (4texoir3ia1fpD li s t)t2uoir ou1ole mietasf Dtau p;u4tetniociytlsDuanms;(0 eeomr iodoptrlu o;t  2ur(r3iu4opeemies t) Durxmpot4tpto fcilt s2eauvs;t) rerio3iydoptranei;t0seur(r3oydalen nvsa( arrmxr ;u4apto o3ilsls ranvo;t0tlxoif3iadfpDe nvo ()teto(mpio4apt lfes ( artaurpou1oexomfctlt aDrm(msn(0arxoxf ia1fpt luei t)t2xoxrpoy4op   ncsa(faDtau oot4altnmoeiltfs2emu s;t0 reomf3oo1omteauei;s0seurxo oy4lltelnctls s2um(  oo1tpe  i3iyslmDeauvon(0texnxo3iatfptelivo t seto(o3oodame  nvia()arua(r ;t4aexoifcild s2ea(mp;t4areomr iytomt  n o s texr(r3oo4am emfcsat a2ua(rp;t1olt ifctltfa2emnvpnt4trxrmo tydoat li i;s)seto(r iu1oleemfvsat)sDtru o;o1olxnmo3iydfa2rmu o;u)arxnmf iadop  luei;t)setrir3oodlm  mnvtl(fa2rru  ;o0tex  fciydfm2rm(vpn()aeermr oy1fpDe ueols0texmimpoo1ole  ivsa() ruaxmp;u4teen ociydla2rl( sn(0tetoxo oo1lptrau ols  2tm(rpio1al  mnvi t  Dtmum ;o4aexnmfetldfa uan ont)tlxrmf3todfpt lnvs s) rtr(o no4open iesas a2tmx  nt1tet  oeiydfm2ea( o;(0 rerio3ty1oaDeluvi ( t2trio3ny1openlnvt s sDuru o;u1oleomfeiadfs2um(vsnt4tlerxr3todopDrlieolt0srxr(opoudlmenmici t)arta( ono1tet  i3ild m2ul(vs;t0 rxrmf3iydlpteauvs;( t2uoir iudlp n icslt) rtaxrpot4opeoif3iad a ea(mp;t) ltrif3iotomDeau s;(0t2umxo no4altelieia(  2ta(rpou1texnifeiyt m elnvp;u4altoifcio1lpD  ivs s)sexmxr3ny4lpenmnetlsfsrraum nu1opxn o3tyt mDelnvs;(0 rxnmr3iydlpDelivo;s0 euoxm nudllee fetltfs2tmur no0apto o3iytfm eluvsnu)trtniociadfa  li sl(0 rtr(m3oy4amtnmics () 2rm(mont4aptomociadfa rm( o t0trxrmfcoytomt anvsl(0t2xmxr3iu1opeelnei () 2taur ;o0ale ifetldfaDrm( s (4 etnxo iotlmDrlnes;s)srxmxrpoy4lpenmnviatf rur(mpnu0opx  octys m eln p;t)alxrxrcoo1lateau s;t truo(opnodapee ivs ()srrmxmp;u4apt  ocild s ul( onu4tlermr iatfmD  iesl(0trxr(m3nu1ll  livilt  rrrurooo4aeeomfeiasfa rl(vs;u0 ltnir iydlmDr ieol()sexo(mpoudlp n fesa()aDrmur ;o4aet  oeiyslmDulnmsnt)trxrmo3ootfmD  ueils trxoio no1ale lfvsa() Dtmxr nu4opxomociat aDrl( p u0arxrmf3iatlmtraneo s0trtoirpoy4olen ivilt)srur(mo;o0tpxnio3tas a2emumsnu)alerircta1lpt au s t) 2tmxo3nodaptnlfvsls srrr( p;u1tpxnif3tatlaDrmu pnu0trxrxr3tadlm e u il( s2tmirpoo1lpte ici t sDtrxm ;t4olx mf3iys mDelu o;()tetnmf iatfpDeaivilt)s2urxr oo4op e feias)a2uau  no1open o3ils aDemn o;u4 rerxr iatfpDrau s t)srxrxmpoy4am n fcsl(fs2umxm nu0tpxoiiciasfsDemumo (0 eeomr tydop   ues;() 2xr(m oo1amen nes ( sDum(m nu0olt mfcild m ul(vo;(0aleoxrciydlpDrauesl( tetm(rpiy1lmt lncta(fsDta(ront0tpe  i3tlt s ulu p;u4arxrircto1lpDr neo;s)teuo(o no1am   fetls aDurx  ;t4altnmfetltlm uauvp (0teeomf3ta1lmteau sl(0 exr(o3io1ole mfes sfa2uaxm ;u1alx  o3ildfmDuluvs;u0altrmrcoydla raivsls)trxr(mpiydamt  icilt aDtrxmpnu0tee  ieiat s2rlu pn()altnir iadoat lu olt)srtoio oodoltn fei (fa2umu  nu0aeeoioeildlsDeanmonu4aeerio todlaDraneslt) 2um(r oo1al nmiesasf rumxmpnt0apt mieils a umuvs (4 rxoxf tytfp eanei t0s2xm(m3iodlm  mnviltf Dua(ro;t1olen oeils m2uan o ()tlxrxo3oydomtr n sl() 2trxrpiodop   fctlt) rraxrpnu0tlenif3iysls eauvsn(0alxrmf3io1lateaues t0 rtrirpiy4op nmfesatfsrumu p;t4alxo fetadls eanmp;u0 lxrmf3totfateai s t)trtr(opio1lme mncsl() Drrumpno4teenii3tas s2ran snt4alenifciadop r n sls)trto(m io4lme licsl(fsDtau ont4tex  oetys m2ra(mp (4alxrxo tadfpD  nvi;s) etr(rpoodolt  fvs s arururpno0oltnifciadfsDeluvs u4arxrmoctotomD  ivsl(0seum(m iu1ll   fvi t) Drmxrpot1optnmf3ildls uauvon(0texnmoctydfmD aies ( s2tr(m3iodam n nvt ( srtau p;u0tet ioctlt sDem( onu)tlxrmf todfaD anei;()srtm(o io1al  lfvtl()s2rr(  ;u0aptnmieiltfs2ua(ms;t)treoxf3iytfa elieo;t  ruoxm iu1olt  fvt ()arurumont0tptnmo3iltlm2emnvo t) rxomr3iadop eanvs;s0 rtmxo oo1lpe mnciltf 2rrxronu4altnio3tysfm ean o u)areoxf iy1la r u ols) etm(o3oydlp  mfetl( arrmx p;o4aetnifetad m2ul( snt4 exomoctydfptean ols0srumxm3iudlltnliesl(fsDumxr ;u0oexnioeiys a uanms;t0alenircty1faD lueil()trurirpny1omt  ivsa(  2rmxmoot1apxo o3iydfa2em( s;t0aleomr3tydlpDrli slt0sexrxo ou4ap nmfciat arrmum ;t1tltomoetldfm2ra( p;u4 eeniocoy1lpteanes s) rtmxr ny4ll  miei t  rtax  ot0tee mo3iytla2uan o;(4tlxnxf oy1om e ivs;s0trtr(opio1lp  mnetatf 2raur ;t0aee mfeiytls uan s t0aetrif tatopD aivs t0texoirpio4lpt licslt  2rm(rpot4oet ifciytfm2rm(mpn(0 rtoio3tatfa e ueo s  2xo(opnudap  lfet (farua(  nt1oee iieiysfm2emuvs;t0areoxr ootopDelnvi s t2urxr nydol emfei s  Dua(mpnt1tetnii3tys a2ranvont) eeoxf3iydoatr ivi t)t2tmxopoo4aptnlnet t)aDrmx oot0tlenmoeiys a2emn s ()aetrxrctydlatrlu i;s)trxmim oy1ol n nesa(faDumxrpot1opeomi3tldla2ua( p;t0trxomf to1lm eai s t  2xr(m io1ape mfesas sDtaur ou0opt mieiad mDem(mo t) etniocio1opt livi;s) eurxrpnu1lmtnmfvs tfsruax pnu4olx  ieiltfs2ra( o t0areoxo tytfat au s;s  rxo(o3iu1ale lfvtlt srrmur ot0oexoifciasfm rl( o u0aexrmoctadlpte ieols0srtmim nudom e nvtas arrrur oo4alx  feiyd sDea(mp u)aetomf3ty1fa   nvi;t0srtrxo iu4op  licia()s2rr(r oo1aee micias mDuanvonu0 rtoxoctadom  lnes;t0s2tm(r iydalte iet s artmumoou1tpxomfetytfaDean o (4 leoiociytop eln olt  2xr(r iudolee nviltf Draumoou1aeeo fctyd sDel(ms;u) eeomrciy1fpDrluesls) rtr(r3iy1ll n fesl(  Drr(ro;u4apxomi3tys a emnvont0teerxrctytfpD aueilt)srxmio3ny4al e icsa(fsDur(ront1tleoiociys mDemnvs;(4 exrxocio1oatr n sls  rto(mpny1lp emici sf rrm(r nu0ope  iciatfs2el(mo;u) exnmocia1faDeau o t)sexo(opno4alen nct s srrmu  nt4apxoiieilsfa2umnmo;u4trtomf3tydoatrlu i ()sruo(o3iydop nmiesls) 2tm(m ot0apxniociltls rm( p;u0teermo3ootfpteaivi () ruoxrpiu1omte iesas  2ta(ront1alxoiiciltfsDua(msnt) ltnifctodomD  uei;s teto(r3iy1om emivsa(  rraxmoot4olxo feiad s uanmp u)tetoifcoadopt lieslt0 2tmxopoydamte iei ( sDtrxmp;t4optoifetlt a ea(mon(0altnxf3io1lpt auesls0s2urim io4aleelnetl() Dtrump;o1oltnifciadls2ran p;u) lxnxf3oy1op rauvi s0srumirpny4amtnlncs (fa2raur ot4apen iciysfa em(mp (0alxomrcootfpD ai slt  rto(o3iu4omt livil( s2tr(rpoo1aetomi3iysfm rmn ont0aexoxrcty1laDeauei;()teum(o nudlltnlict t sDtr(roou0aetoifeiad sDrl(vpnt4altrmo tatlaD lnvo;s)srtrim iu1lptn net s  Dtmu pot4oeto oeiys mDea(vo;t0 lermrctadfmt  iei;s0trtoxr iydll e feil(  Dra(ronu0oee mo3ilsfs eanvo;u4tlerxr3tytoptr nei;s0srurxrpiodop e nesls  2rr(mooo1opx iieiydfa2ul(mo t4 etoir3iytopt anvo;s trxoir nudolen iesat) Drrx pnt0apx mietaslsDea( s;(4 exrxo3iatfat  n ol( truoxo ny1openlncsat)srraum ot1oltnmo3tyd m emu on(0texoif iadlm eaivi t) eurirpiy1apt lfci () 2ra(r ou0texnmo3iad sDrau o;u)arenio3tydla rau sl( trxoio3no4opt  icsl() rraumpnu0opeo fetlsfmDum(ms;t) lenifciotfpt  ivi (0tetmxo iydlpe lfeslsf 2rr(moot4tlenioeildfm2um( pn() exomr3oy1lpt luei ()texm(rpiodlm nmiesl( sDrrx pnu4aex mo3tltfaDea( p u) exnmfcoa1fpDrluvo s)texoirpoodapte fvtas s2rrumono1opt iieiyd aDranmo;(0aetrmo3totfpD  nesl() rtr(o3io4ap nmfvs s) rtr(monu0olt iiciys m2elnmp;u) rermf3oy1om r ieo;s t2ur(r iudam n neia() rurxrpnu0aexnmicildlsDrlnvpnu) etrmr ty1lpD lu ilt)setrio3iu4ll nmfcsat s2taxmo;t1ope  oeiasls2el( p;t4aetoxo3oy1fpDeli i t srtmir3nudale mnetlt)s2trxmpoo4teeoio3iasls uluvon(0 ltnmr3tatop  aieols)trurxr no1alt  fet sfarumur no4tptnmietys sDuanvs;u4 ltomf iydfa  anvol()trtoxrpnodomtnlnctls)sDtrx oou4alxnmictltfsDrmn pnu0tltrxf oa1la ranvo (0trxrxopiy4ol  miviltfs2tmxmono4oee mieiaslsDuln s t)trermoctydfpDeai il()trtr(o3oydam nmnvsl() rrrxr ;u0tpeoiictlt sDra(mpnt4artnmf ootlmtelu o t) 2um(r3iodamen fctatf Draum oo1tpeomfctytfmDrluvpn(4 etrxo3iodfpD aiei;t)setmxopio1lme lici t srtr( onu0apx  fciytfa2el( p;t)arxoif iytfmtelues t0trumxopny1aleelnvslt  rtmxrpno1opxnmo3iydls ean o;t0trxnxo ia1fatrli ils texmir ny4op  lnvt sfaDum(ro;o1tpxnif3iysls2elu s t4arxoxo3oa1fmDeliei s0srurxm3ny4olenlnesls a2rrx p;t4tex moeiyslaDelump;(0teenifctytomDeaies s0t2xrxr3iudamee iesa()srrr(mpnu1alenmoctas a2ul( o;(0aexomr3iodlpteai i;t trtoimpiydllt liesl(f 2rr(rp;t4opeoiociltla2ua(vs u) eerifcootfa elueils s2xoxr3no1lm n fvils  2raurp;t4tlxomocils s rmn on()teenxr3ta1fp e nvs;t  2uoim3no1am n fvi s sDrm(monu4aee micilt m2rl(mo u4trenioctodfa   nvs;t trtmirpnodop n fvs ()artmxr nt0apt ifetlsfs2el( o u4 exomr iadfmDe ivil(  rxoxrpnudalt  fei sfsDurxro;u4tpenmoeias mDeanmsnu)artoxo todfaD livo;s0 rtrim3oydlpe mictls arta(mo;t0aexnifeild a rlumsnt)aexnio3ty1lmt  ivo (  exoimpoodol elfet (  2ur(rpot1alt mf3ilsfsDraump;()tleomr3tydfmtrliei t0 exr(rpiodlp emfeilsf 2tmum oo4tlto octlsfs2elums u)trtrif3iy1la e uvo t0t2trim iu4om n nesas) Drrxrooo0oleoii3ilsfa rl( pn() reoxocio1opte i i;s)texo(o oo4am e fcils  Dtrx  ot1apxn i3ildfaDrl(vsn(0trtnxrcoodoat  nvslt0trur(o3io1op   fet (fsDraurpnu1olxo ieilsla rln o;u0 eeoio3tadop e ivs ()t2xrxm3nudlpenlfeta( aDtrxroot1oetnmo3iatls2umuvon(4aleoir3tydlm   iei;() etmxrpoy4lltnlfviltf 2rr(r ;u4oetn i3iadfm rlu ont)altnir3iodlm raivs s srur(rpnydll eliesatf Dum( pot1tle  iciyslsDua(ms t0trerio3iydom  ln s s  2to(opio1llenlfetltf rurxm nt0oet mo3ias a2rm(vp t)tlenxo3oadomte u slt  rurxopou4lmtemnetlt)srrrur ;o0aleo feiytlsDum(vo u4artoio3oodomD luvs;s)s2xmxm iodamenmnvt tfarum(m nt1alxnmieild sDrmnvp t)tetoircta1la rlivsl()srurio nydll nlfvia(fs2trx  oo1tptniictydfm uln o;t0 ltnif3oydfa rlueo;t s2to(mpoudll emnet ( a2rmxr ;o1alxomi3tld a ul(ms u0tlxomocoy1laD lieol()srxr(m nudam nliet () Drmu  ;o1aetnmfctad a2eauvo;t0 leoif iydfptr uvi s) rumxr ny1al nlietlt) Drrxmoot4opto feiys m2umu o u)teeomf oo1opt  nes s0 2xmiopnu1am nmfci s) rrm(m nt4tlt ioeiat a uan o (4trermrcoy1lmte uvi;t  eumxm3nu4al nlnei t) 2umxrpno4tpxnmoetldfm2uluvsnu4texomocoytoaDrai o;t  2xmim io4alt lfeta() rrmx o;t0teenmoeildlaDrmn pn(0 rxomfcoodop e i s;s0s2xm(rpoudome lfesl(  Dumxrpou1tpen oeiyd m2em(vo;u4aeerxo tadoptelivi;t  rxrir3oodam  mfei sf Drmxm nu4ape ioctlslaDuln snu0tlenir3oytoaDe i sls)teuoim nu1al n nvi s  Dum(r nt1olxnmi3ils mDrmnvpn(4trtnif3oydlptrlieo (0s2toxr oy4opt mieias  2tmx o;t4altnii3ias m2ean o;()aetrmrcta1lp  lueo t0 eum(opiy1lle  fet sfsDumx pnu1oleo ietlsla2elu p;u)tlerifcia1oat lnvo t0texrxm iu4lmt  feta(f ruau ooo0teeo oetys a2el(msnt0teeoxf iatfmDeau o;s)t2trim ou1aptnlfeils  rururp;o1alt mietadlm2el(vp;u)aetomr3tatfa e nvo;t0 2toio ou1amenliet s) Duaump;t1tltomo3iysfs emuvp u0tlerxfcoatlateaieo;()teurir nudop n fvs sfartm(mpnt0apt ioctlslmDulu s t) exnxo totlat auvs;()trtr(rpiy1apenlnvs (faDumx pou4aetomo3iatfa2rmu s (0altoxoctydfatrlueo s  rtoxm3no1lmeemnvia( s2uaxront1alxo i3tad m ulu o;(4aeenmr3iy1fpDe nesls0 2xoxr3oydllee ivia(  rraxm nu1apxnmfeiys s2rmnms;(4aexoxo ty1oat  nvo;(0s2trxr3oodamt  fvs t) 2rm(mpoo1tlx moctldfsDeauvsnt0trxnmr ootopD an s ()s2toim oydol n feiatfarurum ot1olxomi3iat sDemnvs;t0aexoifctadoaD  u i s0trtoxr oydam nlfciat)a2trum ;u4teeoifciad a uauvp;u0alxrifcoytfm raueol( t2uoio3ou4amee ivi sf Dtmxmpot4oexoii3ildfa ulnvp (0altriocty1fpD aiesl(0setrxopoy4lm emfctat artm(mpnu4teenii3ilsfa ua( o t)tetnmocta1latr iesl(0 ruo(opiydamt mieslt  Dtr(r ;o4oeeo fciytlm2umuvp;u)alxomfcty1lp  lueil( trxm(opoudomtn fcs ()artau  no0tlxniietydlmDul(ms (0tetnmrciodfaDelivsls s2trxo iu4altn nvtltf rta(r ;o1opt mi3ildfa eln onu0artnmocoa1fmtelnvs s0 2umxr3oodopt mivtl( aDrru  ;o4olxomi3tatla2um(msnu4alenirciydfa raieolt)seuoxo nydomt  nvsa(  2rrxmpou4oeeoifciytfmDrmnvs (0aexnirciydlatelnvs;s)srxrxmpiy1olte fctas s2ur(  nu0texnioetadls2rauvsnu)areomr iydoat  u i;( trur(mpnydopenmicils s2tmumooo0alxo o3tytfmDuln o t4 eenmfcta1fpD ai slt) eum(m nudapenmnctas)s2rmxm no1teeniictldlsDrmn s (4trxrxrcoydoptrlnvsls0 2trxm3iy1ll elietl(fsrrrump;o4olto ocilt a2eau s;u0 lenxr tydoaD lnvslt0trtr(rpoo4opee nesl()aDtmurpou4oleoii3tas m2umnvs () ltrxr3ootlpD  iesl( texm(opio4ol nmics tfs2rm(r no0tpe moetyslm rln o;t0 rxnxr iatfptelnvs t)trxmxo ny4amtnlivt t) Dtmx oou0tleoiictad s2rmn onu0trtrmr3iytfm rluvols s2toimpoo1alt mnes ()aDtaxm oo0tptnio3iasfsDea( o ()aeerir iytfp  lieslt seumiopoudomenlnvi (fs2rm( pou4tlxnii3iadfaDraump t0trermf tadfa elieslt  rxoxopou1llee nvtas  Dtmump;o4opxnifetytfm ul(mp u)trtnif iydom elueols0teurim3oudlp nlnvsltfaDtauroot1olxomi3iyslmDulnvpn(0 exnxr3iydlpt  n i;(0s2xrir3ou1openlfvi ( s2rmurooo4aetoiietasfs2ul(ms;u0arxnxo iy1lm   ieo;t)teuoio ou4op e iesa() 2rrxr ;u4tpxnio3iyslaDemump () renmrcoo1fmt li ils s2uoxo3no4apee ivt sf rtr(rpnu0opx ifciydfa rl( ont0 rxnxf iy1fat aies;s t2tr(m3no1am nmfesa( a2uaum nu1oee  o3tyslm rl(mpnu0trenxo3ty1lmDran slt  2umxo oy1om n fcs tf 2taurpno1opt io3ilt s2umu snt4 etnxf3iy1omD aueo;t  2tmim nudlp eliet () 2ra(mont1oet io3iatls ea(vpn(0teenxfctodlpt lu o s0 etrim iodol  lfciasfs2rrum ot1ope mictys m2rmumpnu4aleoxocoy1opD lueo t) ruriopnudamee nes t)sDrr(r ;o4olto fciat sDrmn on()tlerxo oodlaDeln sls  2xm(rpnodlmt liei sfarur(rpno0tex mi3ildls2um(mo;t4trtrxf3ta1oa  luvs;s  2tmir nydapenlnvt ()srtrum ot1alx iiciytla eanmont0 rtnxf3ty1omDe ivsl()trxr(o3iydal emnvs s  Dua(roou1alen ieiysfs2ulnmsnt) rxoxr3oodlat au olt s2to(mpoudlltn neil(  rtaxront0opxomfeiasfs2ul(vs (0tlxoxf3ia1om rauvs;t trxoiopiydlmeelnvs s)sDtau ono0tetnmfeiatlm2em(mo t)tetnxf oatlptelieilt texmxopnydome  fet s)arraxr nt0oltnmoeildfmDrl(vo;u) leoxr3oatoatelivs () etrio no1ll e icsas sDuax ooo0teenifciysfmDelump u0trtoiocoy1opteau i s t2xo(o oydamtemiesatfa2rmxmo;o1tlxomociadlaDeau s t4altoxo3iatoa eanvs t0t2umim3ny4ll emnvs t)artmurpnu1teeoio3ildfs ulu p u)tlxomrcoydop elnvi;s trtrirpoudomeelictltfs2ua(r ;o0tlxnifetld m ulu p;t0 etnio tatfp e nvi;s) 2tm(m oudam  lfeiasfsrrrxmoou0apxnmo3iysfsDrln snu) eenxrctotlpt au i s s2toxr3ou1open ictltfsrtr(mpno1optn iciatlaDemnvp u4trxoiocoo1faD  uvi;t)t2toirpio4lpeelfvias sruaumpou1tpxomieiadlm2emnvo;()tetnxo oy1oaDelieo;t0 exoxr3iudope mict (faDur(rpno4oleo fciad m2eaump;t)trxoxo todfp r neilt s2uoir3iudalt lieilt) Drmxm ;t0apxo feiaslmDea(msn(4artnxfcoytfatr nvs;()sruoxm iy1lptelfvsls sDtmxmoot4oee ifeiat mDumums;t0aexomr3ia1oa  auei;s0 rtoim nu1amtnmivtat)aDururp;u0tetoii3iadfs uauvs;(4aetnir3tatlp  anvi s0srur(r oy1am n fctas  Dta(m oo4oleo ictltfsDum(mo u0 lxnir3iatlaD luvs;(0tetmirpiudlltelietas)a2rrx ooo1tltomieildfm2ranmon(4trerxfcoadoaDrln s;t s2ur(rpno1lmeelfct t)srrr(r nu0optnifctldfa umn s t4aetrmoctatlat anvi;s sexrir3nydlpeelfeiltfaDtrumoot1tpeniicilsfa2em(mpnt0 lxnir tydlm  an o t) etr(m ou4lpee fesa( artmu  nt0olxoif3ilsfa2ua(vpnt) rtnxfctotop e ieslt  2toim3oy1llenmncil()aDtmump;o1opto f3tydfa2um( pnu4aetomr tatfmDr ivs t srxo(o3iy4lmtnmneia( a2ua(r oo0ope  fctasfa umuvont4 exoxf3iatlptr iei;t0teto(mpnydom   ivsa( a2trurp;t0apeoioeiasfsDrmu s (0 rxnmocoy1lm  lu i;(0t2to(r3ny4lle lfcsat srrmxmo;u0tlt ii3iydfm2uan p t0 lxnxrcio1oat  n sl(0s2umimpny1ale lfet sfsrtmum ;o0apeomi3iytfm2uaumo;t4trxrmrctodfm rlnes;t)tetmxopnodlmtelivsl(  2rmxront0alx mfeildla um(vp t0aeerxr3tatlm r uvo () etoim iy1ap emfesls)aDtmu  ou1aleniiciltlm rlumon(4tlermr3ootfpt auvo t seur(o nodamtemietas a2tm(mpoo4tetomo3iatfs2rlnms;u4tlxrmfciotfp raneols0seumir3ou1lpenlnvs () Dua( pnu0apx  f3iysfsDuluvsnu0 eerxfciotfmtr ivs;t s2xo(r3iudlmen ncsltf 2ta(r no1oexomf3iydfa eauvs t0 eerxf ootfm e n olt0 2xr(r3nu4ape lfetls  Dumx ont4tpe iietasfs2emump;t0aetrmo3oadlmDe u slt srto(o nydomtn ivsltfsrumxm ;t0ole  feiad s umumon(0trtrxr iotfmt livi s s2xoir oy4lltemnctas)a2rmxmpnt4opxo ictlslmDeanms (4 lxnxo oodlp   n ilt t2xmir oy4llt lnet () Drmxr ;t4apeo fctasfm2el(vo;t0 exniocoy1late uvs t sexmim ny4ame livtlt) 2rmx oou0apenmietls m2ulumpnu4 lerir iydoate iesl(  exm(rpny4al   nci sf 2rr(  ot0opxomfetadlmDum(mp u) etoxrciytlmDrlieo s0s2xmir ny1alt mies (f rrmurpot4apen i3tlt m ranmpn(0arerif3ty1la  lnvi ()tetrim3oydlltemies ( a2rr(mo;t4aeeo o3iatls2rmn s;(0artnxf iy1lpDr ueil()t2xmxrpiu4amtn ict t)aDum( ont1optoioetyt s ua(mo;(0trtnmfcoatlpD au o;t  etmim3nodll elnvt sfa2raxm nu4alt mi3tld m um(msnu0treoxo3iytlmDrlivilt  ruoimpoy1ol   ivtl()s2um( pnt4oeenmfcilt aDranmo t) ltrxr iydfmDeluei t)teuo(o iu1amenmnvsls  rraumpot0apxnifetlsfm2emums;() etnmr3oy1op  li o;s)seum(r oudlme lici ( sDurx  no0ope mi3iltlaDranmo;u4trxrifctodfpDe ieo s srxoxm3oodape  fvt s s2rmumo;t4tlenmf3ilsfm2eaump (4 rtoxfcoodlatrluvo;(  exrimpoy1lp nmics sfa2uaurp;u1tpt  f3tyd m uau ont0 rtoif oodfm  luvi s s2xrio3iydome mfctltfaDumum ;t0opxn feiys a2emnmsn(4 ltnmr3oodlmtraueo;t0srxmio oydole  fvsa( srrm(ro;o4aptnii3iat mDulump u)aetrmf tadoa  li ol()texo(r no4apte ietltf rurx onu1ole  o3tlsfm2el(ms;t) lermf iytlmDe ueilt0t2xrxo3no1aleelies (fsrumx oou4tpxo i3tas m2ea(msnt4 eeoxr3oa1op raivols)trxmxopou1lptnlietas)sDumxr no4texo fctltla2rl(vsnt0alxoxrctytfptr ueols  etmim nu4lmt lfesasf rrm(mo;t1aex  i3tadfa rlnvp (4 ltnmfctydfat auvi t)s2xmxo3oo1am e fet s)srua( pnt1tpx ifeiadfsDrlums u0alenirciytla  aivi;s s2trxopio1lpte ies t)aDtrump;t0tex  feiasfs rln o;t4alenxr3oa1laDe neilt0 2xrio iu4lm nmfcsasfsDtm(m nu4opxnif3iatfs eanvp u)trtrmf tytfm rluesls0 2xrxopoy1ap n nvilsf Draumpoo0apenmietyt s rlu snt0 ltomo todlaDeaues t0srurxo nu4omtnmnvsat) 2rau pnt4aptomietlt m raump;u) etnxfcoydomtrlnvo;t) rxm(m3iu1optn icslsf rrrxrp;t1aex  iciysfs2rm( p;u4 eermo ty1lp elnes;t)texrim io4lmtnmieiasfaDtmxmooo0oexnioctadlmDuln pn()trtoxf3oodlpt  uvi;t  euo(r3nydopeemnvtat sDtrur nu4oeto fctldfsDeanms (0 lxoxr oa1laD ai i;( setm(opio4olte fesl( aruaurpot4optniieiatls rm(vs t0tlenmo to1lp rauvolt0srxr(mpoodoltnmivsl(  2rm(mpnu4oeen oeiydls rln o;(4tltrircootlaDrlieo;s)t2xoir oo4lme  fvsa( sDum(r nt1oexn ieiadfmDul( s u4 ltoiocto1fmt  n sl(0 rurimpnodol n fcsat  rumumpno0alen octadfs rauvonu0tlxnio3oodoat anvil(0setrim no4olte ict t)sDur(m nu0ale  iciasls2ra(mp;u4alxrxoctadfptr n o;()s2toxo3oydomtelnet t arua( o;u0alx mictlt m2ea( snu0 eerxr3io1fmtr i ils0s2umxr oy4lp elfci t  rrr(r oo4apenifeils mDraump;(0treomr3iotlatelnvi;t0t2tm(o3iu4ap n neil(  2uru pou4altnif3iad sDrmnms;u4 renmrcoatlm eanvils)seumxo oo4aptn ivsat)srrau pot1aetnif3tatla rl(vp;u0treomo tatoa  li i (0trxmio3nydoltn fvt (  rurx  ot0ole  ociydfmDeanvo;t) lxnxoctodlatelnvolt0 exo(r3iudape mnesat)a2raump;o0apt iicild s2rm( onu)tltnir3iydlp  aieo;t0srxmxo3io4ap  lfesltf Drr( p;u0teen fciltfmDrluvpnu) lxnmocio1omt  uvi t0trxmxmpnudlpeemfctasfa2rrxr ou0aleo ietldfa ulnvs;u4tlxoxrcoodfmDrauvils tetoxr nu4om   fcs s)a2uaxr no1aexoifctytfs ea(vs u4tlxrirciytlpDrauvo;s  euo(m3oy4optemfcs sfa2rau  ;o4apx  oeiltls2umuvont)aexrxociytfp elivo s)trxr(r ou4ll   ivils  rrruro;u0ole moetytfm2rlnmp (4 etrmr3todlp raivo;s setmxr3oy1llte neslt  2ra(rpoo0tpe if3iytls2uanvo t0teerifciadfpDeaies t t2xm(r3no1lmenmiviat artm(rono1tet mo3iys s2rmump t4 rtrir3ootoat aivi;s)s2tmxr3oo1olenmnci t srtm(rp;o4opxnioctls mDul( p u0arxrxr ty1fmteai o s)s2urio3iu4altnlivs t aDrau ooo0ope moeildfaDum( o;()texomr todfmt an s;s srtm(m iu4lltelies () rraxmo;t0oleoii3iatfm emuvs u)tlxnxr iadlmDeanes (  2umimpou1lmt  fesa(f rrmxmonu0alxoifeiyt s eanmonu4aexnxr3ta1fmteluei ( seurxr3oydalt mfetasf 2uru ooo0ope mfcildfs2ua(vo t0 reoxf oydopt lieo t trtoxrpiodlltnmfvi () rtrx o;o0oet iociltla ea( sn(0trxrmf iytoaDrli s s0srtrimpnydll emnvta()srtrx p;o1tet  o3iadla2emnms (0trxnxfciatlaDranvs;t setrio no4alenmfcta(fsrra(mpou0tpxomf3tas s2ul( snu)texoxr3oadfp   neo;t)trum(r3oydal  licta(f 2raxm ou1aeto oeildfm2em(mon() lermf totomtean ilt) rxm(m iu4lm e nct (f 2rm( oot4tpeomfctydfs2uau onu0alxrxrctadopDelu o;(  rxoio3oo4ope lfetls srurxmp;u1opx iictadlaDuaump u4alxriocoadopt luvsls)trto(o3io4omtemiei (faDta(rpno4olxoio3tldls2raumpnu4tlxrxocoy1opDean o;s s2umim iydlpe mfci t  2umumpno4ole ifciltfm2rm(vo;u)trxomrcia1fa rlnes;t  2xmio3oy4lme  ivia(f rtrumpnu1teeoiictlsfmDuaump;t4tetnirciodfa  aiesl( trtr(m3io4apeemnci t) 2taxrp;u1texnmieiasfa rmuvsnu4 leomfcoodoatrai s ( texo(m3oy1ameemivs s sDua(m ;o1optnmo3tydfaDrlu s u) reomr tydfaDeluvols srxr(r nudap e ncsat)a2tm(r ;o1oee ii3tlsfa2rmuvs;(0 eenifcoy1oatelueolt0s2trxr3oudlmee nvsat)artm(mono0olen i3ild mDum(mp t0 rtrxo3tytfp rlieilt trtm(opiy1al emfciltfsrrr(mo;u4tlxnmfeildlaDrlu s;(0 exoxf io1opDeliei s  2trxo3oy4omt lfetl() Dtru  nu1aptnif3tatla eln o;(0 rerir oatlpt liei;()t2trxo3io1ale lnvsa(faDtaum nu0tltoioeils s elumon(4 lerxo3io1lpteanes t0 exoiopno1amenliviatfarrmx o;t1tpeoiictys s2emnvpn(0 etoxr ty1omD  ivi;t setrxopou1llt mfetasfaruau ont4ale miciad aDel( p u)arxnxrctodlmt  ies;(  rtmir3nydom   feslsfarurx ooo1tlxn ieildfa eauvs;(0 ltoxrciytoateluvo t s2uo(rpiu1ap e nct t s2ta( p;o0ale iociydfs uanvpnu4aexoxfcoo1oate ues;s  exrxr3ny4lptemicsa(faDta(  nu4aptnmicild s umnvo;u)artrmr oadomDeluei s)srxoir3oodolt  ncs t) Dtm( onu1tpx  f3iys a ean s;u) ltnif oy1faDean i;( t2tmxr ny4oltemnesl(f rur(ront1texnifctldfmDem( sn(4alxomr oy1oaD lies t0srtr(m iy1ome  neiatf 2tm(mo;o0opt  iciyd a2uanvo () renxfcio1fpt lieo t seur(m3iy4olt lnesl()arra(r ;t0texomfetls mDrmnmp;(0 rermr3iotfmDran o;s0t2uo(m oydlm elnesls  rtmu pno1tltniictad sDemuvp;u4 rtnmocoodoate i olt  rtmirpno4opt  nciatfs2rau  nu1ape moeiytlsDea( p ()teenxf tadoptelnvolt srxrio3iu4am  lnei tf rtmu  nt4tpxo i3iltfa emnms;t0 etnif3iy1fm raueo s)s2xrim iodom emietls) Drr( pno1alxniieiydfa2rl( o;(0 rxoif iydfate uvs () 2xm(m3oo4lmtemncslsfs2rr(r no4aexoif3ilsfa2raump t) reomr totopte n ils)teur(r iudalt lfet s)sDrmx pno1aet moeiys aDuanvon(0texrxrctotfaD  ieilt0s2trxo ny1alt lfvtat) 2um( pno1tptniictyt m2rl(vo;u4tetnxf3to1fatelneilt0 etmxmpiu1lpe lfcs s)aDta( p;u1apen i3iyt s eluvsn() lenmociytom  auesl(0seurxm3iudll  mncias) Durxm ;t4tlx io3iaslm2ranmsn(0aexoiocto1op e ivi ()texrxo3oo1lpeemfcsa(fa2ua(rpnt1aee mieiasfs2uau s u) exrxociytfmD luvils trtoio3ou4lme  ncslt) 2rm(monu0opx  o3iys s2elnvs u4aleomrctytlm   nesls) exo(m ou4lpt  nes s)srururpno0aeto feiytfs rlu o u0 exoifcoy1fpD anei;t srxmxo3ny4alenmfvtls aDra(mo;u1apt ifeiasfa ean ont)areoxf3tytfm   ivsl() rtoir oudlmtnliesl(  2ta(mpou0tpto o3tydls elumpn()altoxrcoo1oaDelieo (  2trxr iu4om e ics sf Dur(mpot4alenmo3ildla uaump t4 eerxo iodfmD  u i t0srxoxr3nodlpt livs s)sDtrxr oo1opeoioeiadla rmnmo t0 eeomr3iadfa e neil()truoxm3ou1openmfciltfsDrau pno4oexnio3tasfaDem(mpnu)aleomf3oadoatrln ilt srxmir nodlle lfes sfa2trumoo
\ No newline at end of file
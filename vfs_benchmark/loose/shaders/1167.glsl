@@ -0,0 +1 @@
+uvs s) 2toirpno4ol nmfci (  Dtaumpou0texnmietldlm2um(vo u0arxnir tadoptr nvo t trtoiopoo4opte fcsat  rrrx pnu1oeen ictltfaDrl(vont4texnmocoy1oa  luvi;s srxmio oo4lltelicil() Dum(  ;o4olen icilt m eauvs;u4tltnxf3ty1faDe ueo t) rxrxo oy4lltnmnvi t s2rr(m ;t4olenii3tyt a2uluvsn(4alenmf io1omDe ies s)s2xmxo3nu4lltnmncta()a2ra( onu1tlenmf3ilsfmDem( s;t0texrxrctytfmt luvo;s)s2tmxr nu1lpe  nvia(f rurxroou1opxomf3tytla2ea(vp;()arerxrcoydopD  nvi;s trtrxrpny4al n ietl( srum(  nu4aptnio3ild mDulumo () rxnmoctytlm   u i t tetmxopoydom e neiltf Dtax p;o1oeenmo3iyt sDumu onu0aleomo3to1op rli ols sexo(o nu4al nmfcta(f rra( p;u4opxnmi3tltlmDulnmsnu)teermf3iatlpDeauei;s0trxmxr ou4llen icilt  2ur(m oo0aetoif3ias a2uanvo (0tetomo tatfaDrai i s t2urirpnu1omtn ieil(fa2ra(mo;t1tptnmoctysfm raumo;t4altrmo3iadlp raivsls)sexoir3iu1lmen fcilsf rrr(m ;u4apt iietyslm ranmo t)tltnxocty1fa r uvs t0 rtoxrpnodolen ics t artru p;u0ope  feildla2elnmo;u)tetoir ty1la  an olt)t2uo(rpnudlpee fesat)arurxr ou4tpx  oeiysls2emu on(4aexomrcio1fateau ils0srxo(rpiydlmtnmnesat a2rm(rono1olxnmoetlt s2rluvp;(0alxoiociadfaDr u ols s2tm(o3nu1omtnmfeils)arur(  nu4alx ioetlsla emuvs u0aexrxf3iodlpDe ivo;(0srur(opoy4omt lnvtas  2tm(mpnu0aex moeilt s uau sn(4aeeoiocoa1fmte nvs (0sexrim3nu1optemietat) Duaxront0alx  ocilsfs em( o;u) rxrxr3iy1fp   uvo t0 rur(rpou1apen fcsas  rrm( pnu1tet mo3tydfs2uau p;u4aleoxocoadfpte ivilt) 2xm(o no1omenmfcs t) rum(  ou4texnmietltfsDulumo;t0areoxocoodlmteaivslt)s2um(r3io1lle miet ()s2urxm ;t4oetomfeiydfa2ra(mp u) reoio3oy1fmt ai ils0srur(opnydllte feta( a2ururonu4aetomoctas a2emnvo;(0aexoxocio1fmDelivo;t) 2ur(r3io4alee fetatfa2uauro;u0tlenio3tatlaDem(vs (4 eerifctytomDrauvi ( t2uoxr ou1lpe mfcslsfa2tru o;u1tetomocilsls2eaumsn()tltrmo todfmD anei t trtoirpiydape  fvsl(fa2rax  ;u4altnioeilsfm rm( o;(4alxoir iodoa eau i;t  exmxr3iy4ole mfct sf 2uaxr ;u0tpt mi3iad mDra(msnt4altrxr tydlaDr ies t0 eurxopiudome  fei ()sruau ooo4opxo ieils sDul(vs (4tetrmr3iydfm elueo ()seumxm ny4opeemivt tfs2rm(ro;u0apenio3iasfs rlnvo;t)aexomr ta1omD aiei;(0srumim nydamt  nct s  Duaumpot0tltn fetls aDrmumonu)alerxocto1oa   u s s0 rto(r iydapte fetl( a2trx p;u4aetnioeiadla2rlump;(0 exnxrciy1la rlies;t)srumir3no1om   nvtas) rtaxmpnt0altn ociadlm2elumon(0tlxrmf3iodoptranes ( teuoim oydoltnlietat)aDur(  nt1opeomfciytfm ulu o t)tleoir3oodfaD lu i;s0t2urio3ny4ll   fvias)aDtax ont4aetnmfciatlsDemuvs u4 rtrxf oa1lat an o t  rxmxrpiydaptemneilsfa2urxmoot4oeto ictad s uauvsnt4tleoxr3io1optr nvsls s2ur(r iydam nlivtltf 2ra(rpnu4oltnii3iltfa em(vo u) reoio3oatlate uvi s0 ruo(m nodlmen fvia(f Dtru ono0tex mfeilt a2ua( sn(4treomrcoa1lpt  uei;t)teto(opou1lpen fci s  rtax o;u1apeoioeiydlmDumnmo t4 ltoir3tydopDr uvo s)srtmirpnodale lncsa(  Drm(r ;u4ape  ieildfaDum(vsnu0 ltomf iodom e uvi ( t2to(rpnydopte ietlt  2tm(mooo0aptoiieiat s2raums (4altoxo tatlmD anei;t0trur(m iodamee nvsat s2ua(m ou0optn i3tytlm ranmsnu4 renmrcoydfpD aivs t0 eum(o3iy1olee ivi t)srurx pnt0apxomo3tatlm2uan snt) ltrxo3oa1omDrlu i;s sexoxm nodap  liciatfartrx  oo1opxniieiyd sDranvp;u4tltoxocio1fptr iei (  2tmiopny4ll emfct ()srtmurpou1openii3ils m eanmpn(0 rermfcia1lmt aivs;s) rtm(o oo1ap nmnvi t s2um(mooo0texoifeildlsDeau o () lxnmr3ty1fm  li ilt trto(mpoydome  ivi sfarumu o;t4altnmiciytlaDea(vo;t0arenxf oydfat  uvsls t2triopoy1ap elieslsfa2ra(rp;o4tetomoetytlm2ra(mp;t) eenmfcta1fm rln sls)seuoxm oudol e fcsat)a2rmur ot0oet mi3tadfa2um( s;t0teerio3oytomte i s;t  2umxopoo1al elnci tf 2um( o;o4oee  ictlt m2rlnmp;t) lxrmf oodoa  an o s) eurxr oodaptn nei s)s2tr(rpot0olxomoetad a rmnvs;(0texnxo totfmt  i s s0t2xo(mpiy1oleeliei sf Drmx pnu4opxniociydls2rl(mont0teeomf3iodomt  uvo s0 2xoir3iodal elnvsas) Duaxmoot4tet  o3tat m ul(vo;()tltomo ta1opteanvo;(0trtoxmpiydlp  mnci t  rumump;o4aptoif3tysfsDel( ont4trxomrctodoaD  ivilt0s2toxr3nydaltn netas  rum(r nu0aee mieiyd mDua( p;u4aexniocoadfp   u sls)sexoio3oo1lle  netl(  rumx  ;u1altomieiasfaDuauvp;(0 leoif3tytlpDe iesl( srxr(mpnydlmenmnetls)aDtmxroot4ole ii3iadfa eluvpnt0trenio3oatlp r ivo;s0trur(r nudaltelfvtatfsDra( o;o4teenmfciytfaDumn s;t4 renxrciatfm eai i () rtoim nu4opt  iviat)a2rmu pou0tex if3tatfsDuanmont)arenmo iatfmte u s;s0 etmim oydlmtemfes s aDtr(rp;o4oet ioeiyt a em(vp;t)alxomr3oytfm eanes;t srxo(o3nu1lm  mneils aDua(mo;t1tet  o3tls s2ea( p t0aeenifctadomt auvs;t0trto(r nudlme  fctl()a2ua(mo;u0olxnifctat m rlnvp t4alxnxr3tytopt liesl(0 2uo(mpny4lm n fcias)arrmu  oo1tlx mf3iltlaDumuvo;u)trenmr ta1fmteli il()teurio iodal  lnct s)sDraur nu0aetoio3iltfaDuanmo ()areomf3tytlp eanvil(0srxmimpio1llen fesa( arumxmono0tee mocild m2rm( sn()aeeoifcoa1laDeanvi;s0 euriopoodalenmncs t)a2tm(rooo0olenmoeiasls rluvp t) rerir oadoaDranesl( t2urxr iodlle  fcia(f Drrx  oo4tpeomoctad sDumuvpnt0arenifciytlpDr uvil()s2umxrpny4om   fci s) 2rm(rpnt1alt ioetydlmDum( o;t) rtoircoadop  auvols)srxoxopnodomt mnci (fsrrr(mo;o0olt iieilsfmDuanmp;t) ltrmo iodfaD auvo;( t2tm(r3iu1al nlfvt t)a2urur ;o0opx  ictldfmDrlu s;u4 eermf todfmt luvo t) etoim iy1am  mfctasfsDurum no1tlt iietas a rl(ms;()texrmf iotom   ies;(0trurir nydol n nvilt s2rax  ou4aptoii3ilt sDrmnmo;(0arxoxf oytlaD aivil(0t2xrxo nydope mictl(f ruaxrp;o4tet  oetydfa2ulu p;u0tltoif3oo1fmDeluvo;s srxoxm nydap  micsltf Duaumooo1aex ifciasls2el( o u0 renifctadoatr u o;(  2xm(m io4apt lnvias)srtr(m nt0aexo f3iadla2ran p (0 lxomf ta1fm raivols  rtrimpoo1ap elictasf Drr( poo0alt mf3iasfs2uluvp u0 lerif3iodom rlivs;s0 rxmir iydol e ivtlsfsrtru ono0oltnmoeiytfs2em(vo;t)trxoir ia1fm e i ols)s2xmxr3ny1altn icsl() rtax ont1alx  ietld a2um( pnt0artoxrctodla rln ol()s2xoimpny1alen feilt sDrmx oot4apxomociltls2em(mpnt) exnxo oodlateaivi;s s2urirpio4ol  lietlsfsrtr(mono1tex mf3ias m ea( s u) rtomr3iadoatraivo;s)s2xo(rpiu4lpe mfesltf Drmxmo;t4tpx  oetyt sDua( s;t0teermfciotlpD luei ( srxm(m nodlptemneilt  rrau  ;t1tpe iieiadfs ulumont4teeomf3oo1fm elivslt  etrxopiy4ame mfvsl(f rrmurp;u4apx  i3ilt m2elu ont)aeerio ootlaD  ivo;s) 2urir iodlpen nctl(fartr(  nt4apxomociadfs ea( o;t0 eerir iy1fm e nvs;s)srurxr iy1oltn fvsa( sruauroot1aeto fctldls2eauvo (0tlenxf ty1oa ranvo s tetrxr no1oleemfcs ( srtrxm ;o0oexoii3iat s2rmnms () rtrio todomDrau s;() 2uoxopio4ole lfct ( aDtmumpno0tltomieild m2eluvonu)tlermo3ia1oa r n sl( texr(r3oo4am elfetasfsrumxront1apeniiciad s ulu o;t4 rxrxr3ootfaDrln s;s0 2uo(rpoudlmt livilsf Dtrxmpou0tpxnmiciadla2rl( s;t0tetomocoytomDelieo t)s2xr(r3no1amtn ieils  Dta( p;t4alen ieiyd a eau p;u0altoif iy1lmteli sls)trxoir oydamt lfeia(fa2raurpoo4aptniieiyslaDelu o;()tlxrmrciotomDrlnvsls srxo(m3nydolen fvia()a2tr(  oo4olt  ictaslm uanvs;(0alermr iydfa rln s;(0srtrio3iy1olt lneiat sDtmxmo;t0openmociyt sDemnmp;u0teenxf3iydfaD au sl()srtmir ny1lpe lnesat)aDrrxrpno0texo fctldlaDranvs;t0 rxrio3totom   neilt0teurimpio4llt mieslt  rrmum no4oleomfeils m rm( p (4teeomrcta1lm r nei;t texrxm nu1omenmivtlt a2rm(rpno0teeo i3iaslaDulnmpnt0 eenir3tytoa  ai o ()trurir oudlmtelnvtls)aDrmu onu4tpenmo3iaslm2rlu o;(4 lxomo iotlaDrlneo;(0teum(r iu4omenlnvsls)srrrxm ;u0tee mf3tadls2umuvpnu4 rtrmr iadomteanesls)tetm(mpnudlp nlfcsas) Dtr(mpno0aetnii3ias mDum(vo;(4 ltrmo3oa1faD anvil(0s2umxo iy4optemictls aDururpoo4tlxnif3tadlm2rl(ms t) etnmf3iydfmt  ies ()s2toxr3no4omtn nvt sf rtmxro;t0olx  oeiyd sDelnvo;(0aetnmo3oo1om rlnvolt)trtmimpiodalt  ncsa( arua( ono1aleo i3tatlm2ul(mo;t4 rxnmrciatfpteaues t  2uoio no4apt  fesasfsrraxro;t1tpen fctadfmDeaump u4 ltnxrcio1omDrauei;s0srtrxm3oydaltemicsatfa2uaumpnu1olx  ieiydls2eauvpnt0trtrirciydfp raiei;( sexm(m3oy1om nlivtlt) Dtax  ;t1oee iietlsfaDeluvp;(4teenirciotfate n o t)t2tm(opoydlpe  neiat) Drmu  no0oexo o3tydls2rmump (4altoioctytfm rau slt0 exoxopnudal e fcils)srraumpno0aex mfetytfmDuan s t4 ltrxfctydfaD luvi s0 2tr(opiydomenmivi t  rtaum oo0apenifetad aDelnvs;u0aeeomfcio1op  lu o (0seuoio3iodop nmfvsls artrxmpot0tlx mf3tlsfa elums;(4trerif iatfpteln i (0s2trxmpoodlpenlivtl(  Dtm(r ;o0aetomi3ilsfmDemnmonu)altniocia1lm   ues;t  rurimpny4lmtelnvtat a2umxrpou1opeoiieiys s2um(vo;u0arerxfciatlp  lueo;t) exoir3iu4altelnvil( a2uaxmp;o4aex mocilt s emu s;u4aetoxocia1opt  nei;( s2xoxrpoydlltnlnvtl(faDtau pnu0oex ifcilt a2um( p;() rerxrcoo1fpDelivs;t  ruoxr3iudlmeemieilsfarrmxmono1oleo oetyd m2uaums;(0areoxr3iadlp   nvs s0 eur(rpio4apenmiet s)arur(mo;o1tee iieild a eanms u4 exoxrciadfm rli s t0tetm(m3ny1llte fci tfsrtmurp;t1alxo ociydlmDum( p u) rxoxr3iotlmD aneol(0setmim nodoptelncsa( aDurum nu0oeeoif3ilsfs2el(mon(4tlxrifcoadopte ueols t2xriopny4amenmicsat)arumxrp;u1tleoifeiasfm2eln onu) etnmf3iotfp  anvi t0srtr(m nu4olee iet (fsDumxr nt1aexomfctldlm rm( pnt)trermfcootomDe u i s) 2xm(o oudapee icsas)a2taxmo;o0oet  f3ias a ul(msn(4 exnmr tatom rlivi s0t2tr(mpny4aptnlicsl( a2rmx poo1apxnif3iadlm eluvo t4aeenxf oo1lptean s;t)srxoxrpou1ll nmies t aDumum oo4tltniiciad mDeanvs () lxrir3oatfaDeluvo;s) eumiopou1lltnmfcsatf 2raum ot1oeenmo3iatfs eaums u0alxomo3oa1om r nes t)srxo(rpnodom nlfcs t  2umxm ot1oltomf3ild s2uln p t4 renxo3todomtrlivols0 2xoxr3oy4lmtnmfes t)s2rm(ro;u1oleo octys a eanmont0aetrio3tytopte i o (0trtoir3nu4amte nesa( arrrxrpoo4tlen fciyd m uln s t) rerxfciatlpt  neo;t trtmiopny4ame mictl( arta(mo;t0tlx mfeiadfs2elnvp u0aexrxrciy1lpteai ol( srxrxm3iudlpenmivilsfsDur(m no1ole mo3iad a2elums (4 etnxf ta1fa ranvo s0trxm(o oo1open fes s) rtr( p;u4tlx mi3tad aDemnvonu0tleoxo iydfpD lnvs s teto(r no1ale lictlt srrmumpou4ape  f3iytfm umnvonu0artrmfciodlpDelnes t)srumxm iydlle  icias sDtrumpno1aptn oetydls uauvo (4alxrir tadom eluvilt)trxo(m ny1ole lfet s a2ta(mo;o0aee moeiys sDeauvsnu4artrif iatopD an ols)teumim oo1ll  mfeiat arrmx oou0tleomoctlsfs2ul( o t0aexrmocty1om ranvs t0setrxr ou1ap n fcil(  2umx  no4ale moeiadlm ulumo;(0arxrxo iatfaD luvol()t2urirpio4alenmnesl( s2umu  ;o4tpto o3iasfs rmu s;() etnxrctadfpDrauvol( t2xrirpny1oleemfci ( a2ta(mo;u1oeen i3tyslm rl(vs;u)tltrif tytoa r ies () eumiopoy4altnmieiltfa2uaxr no4opxomfciltfa2elu p t0aeenxrcta1oatrln sl( trurio oo1op nmicsl() rua(r oo0apeoiiciltfa uan pnu)alxrxrctatfptelneo;t)t2uo(opnu4om nlnetls aDtmxm oo0texo o3iasfm2ua(vo;t0 rxnirciytomt aiei;( seumxmpiodop emnvi ()a2um(  ;t1tlenio3iadfs eluvs;t) lenmf to1oat aivi t)srtrxm3nydapeemiet s  2rrxmono1oleoiiciysfa2rauvs (4trtoiocoa1fpDranvi;()trxrir ny1llte nvsasfsrrru p;u0tltomf3ilslsDulnmpnu0arerxr oo1fp e i ilt0 2xrxr3iodom e ivt (farurx  nt0ale ioeild m ra( o () etrmf3ty1fatrli o t0 rxmxmpoydole mivtlt  rtrum oo1apxomietldfs uaumo;t) lerxrcta1lmDeauei;s srtrxo oy1aptelfctltf rtm(mpoo0opt  oeiytla rluvo;t)texrmo3tytlpte nei;s) rtoxr iy1amenmfesltfsDtm( p;t1ope ifctyslsDum(vs;(0 exnmoctadlpD aies;s srxoxo3io1ap n fvt t srrrx onu0tpxomi3ias m2ul( o u4artrxf3iadfatraiei;t0srxr(r ou4alenlivslt)sDuau onu1aleo feiatls ea(vo (4alenmr oydfpD lieol()s2xoirpiudal nlieias  Dumu oot0alxnifciasla uaumsnt4treoir to1fm eai sl()seuo(mpny1lltn neslt sruaxr ou4tetnioeiytfsDul(vpnt0aetnxo ty1omD au i ()sexo(r iu4lpee nei (  Dtaumonu4tpeomieilsfs ea( o u0alxnmf3io1oaDeanvslt0srumirpiu4amen ietltfs2raxrpnt0olx mfctas m2ranmsn(0alxoxr oodfm e ivs;t0t2xo(o3oudoleelfci s  Durx oou4tle  feildfm em(vsnt)tlenifciodla  aivilt0srtmirpiydom  mfvtls) Dumurooo0olxo fciysfs2umu sn(4 eerif3oy1oa rlnvo;t) 2um(o ny4oleemnvtltfa2ta( p;t1aptn f3iadlmDum(vs (0tetoxr3oytfateauei;t t2xr(m nu1lmenmnvi s a2rau p;t1apxo f3iys a2uau onu4texnmo oa1fm  anvo s0 rxo(r3oo4am e icsltf Dra( pou1tpx ifeils mDeaumon(4alxnxr oa1oaD auvslt)seurxo io4amenlnvi tfa2urum ;t4aexnif3iasla rlnms;(4aetoio iydoaD lieil(0 rtm(rpio1apt lfvtlsfs2umx o;o0apx mociadfa2eanms;u4alxnxrcio1lm r i o t0t2urimpou1open ivtas s2rr(mont4apeomi3iltfm2eluvs;(4trtrmo iadlpDr nvi;s) euoir3nydamtn ivi (fa2ra(rooo0oltnmi3tlslaDrln o (4 eeomo3iodomDrlues;() 2um(m ou4lpe lncias)aDua(rpno1opeomieildfmDrm(vp t0altrir ia1lpt  iei;t trxoim3iydol  lfcta()a2rax oot1alen o3iatfs2uaums;()teenirctadla  ln i;( trtrirpiodol emfctlsf rurxr ou0tee mietatlmDul( o t4aleomfcta1lm r nvi;t  2ur(o iy4ole  fvil( sDtrxmpno0olxo o3iad m2ea(mo;(0 rtomr io1oaD  n s ()trur(r3iy4lpt lici (fs2raxmp;t0alxomo3iltfa2ulu snt0tltriocoy1fmteauvslt) rur(m3io4om  mnvta(  2um( onu1aet moctls mDrlumo;u) ltnmrciotop r nes;(0t2umxopoodale  neta()a2trxmp;t1aptoioctad a2em( o;u4aeenmr iatfateluvi;s trum(m3oo1aptelfct ( s2rm(rp;u0tee moctldls2eaums u4arxnir3iydlpDr i i s teur(o3nudllenlfetatfsrrau o;u1opxomi3ilsfm2rau o;t4trenxr iodlp raivolt srto(m3oodaltnlnvtas  2umump;u4tpxnmo3tas mDemnvp ()tlenxr3tydom  anes;s)truoxr iu4lmt lfetl(fsDtmx o;o4aexnif3tlt m2rmumo (4 rtoxocoytfmDelu s;s0setrxmpio4lpee icsas  rtax  ;o1tpxnmociytfa2ran s t)alenxr3oy1omteln o;(0 etm(mpiudom n ncilt)s2uaumpnt0ole mo3ilsla rlnmpnt0tlxnmr3to1op ran o s setrxo3oodaltemiei sfsDtrur ou1tltn oeild a2rlnvo t4tleoxr oodlpt luvilt trxm(m io1lmenmfvi ( a2taum no0oet iiciatfaDeaump;u4 lxnxr iydop  au o;s)texrxm nu1lm  mivi s)srtm(mooo4olxo octydfmDuau o;(4arxoir3ty1fmDe ueol(  2xr(o oo1oleemnvi t  Drax  ;o4tlenii3ilt m rluvp t0aetnif totfpDrli ols) rur(opoy4om e ivils arurxmoou4alto ociysfa2umu sn(4 eenmo3totoateli olt)teumxr io4op nlnvi sfsruaum nu0tpto ieiasls eanmont)artrxf iydfat livo;( t2xmirpio4aptelies sfarrmu  nt0ale  feiad s el(vsnu4 exrif tydfat  uvo ()tetoirpoo4lpen fci s)srtau o;u4tle  oeild a ua( p u)artoxrctydop   i ol(0 exmir3iu1am emfvia( a2urxr ot1opeo fciytfs2ua(mp;u4 leoxr3tatlpteaueols0 eurxm3ou4amenlics s) Dum(rpnt1texomoeiltlsDelnvo;(4 lenif3io1fa ran ols)sexm(opnu4optelfei s)artmx  oo4apt mo3tatfmDra( on(0tlenxr oa1op r u olt) rxr(rpno4alenmictatfsrraxrooo4tlen o3ildfa rl(ms;u4artoircoo1fmte nvo t t2urim3nudlm emict s  2tax o;t0alto ociyd s2rmumsnt)teeoif3iadop e ueo t)s2xr(r3oy4op n ncsat aDtm(mpot0tpxn feild m eln o u4tlxrircta1la r nes t0 rumxm3iodapt mncsa( arur(rp;o4alxomo3iytla2rm(vonu4 etomo3oydfptrau s;s srtr(o oy4oleemfesasfa2taxrpnu0ale  oetldfs el(von(4aetrmr ia1om e ueo t  2urxm3ou1op n fvsat sDrmumoou0tptnmo3iydla2uauvpnt) reoxr ta1la  livsl(0 eur(r iy1llte nctlt)s2uaum nu1tltoiietysla rm(vs;(4 rxoxo oo1lmtran i (0srxoxrpnudll   fvsls)sDtm( p;o4texo ieiyt sDuanms t4tltomr3totoaD lieol(0t2xoio3no4ap nmicslt)a2ur( o;o1ape  o3iytla2umnvo ()tltoxr iatlm e uvol(0texr(r3oodale  icil(f ruaxrpnu0teeomfciydlmDraums;t)texrmo tadoateauvs s)setm(opio4olen icsas)s2urum ot1tlxnio3ias a2rmnms (4teerio tadlp   neilt)trtr(r3oudllen fvtat) rtm(rpno1aee  ieiysfmDeaumpnt)artrmf3iotopDelnvols)t2to(rpoy1alee iei () rua( pnu1optnmociys aDemn p t0alxrircoodlmDeln o;( teuoxrpnodapenlfet tfsDtr(m nt0aexo f3tldfa rmuvp () ltnmoctatfa e nvolt0 euoxmpoy4omtnmics s)s2tmumo;o4tlxomictltlsDuanmonu0texnmfciodop rauvs t s2xrio oodaptnmnei t  Drrxm ou1tlt  o3ilt a2eluvs;t4teeoxrctotopte nvs;(  2xoim3oo1am n ieiltfsruru o;u0oex mieiyt aDea(mo ()artrmrcoodoa  lneo;s)t2urxr oo1olt lieslt)srumxmpou4aee ioeiadlsDrluvp (0trermo3iydfaD  ies s0 2tmiopny4amt lfes t srur(rpnu4oeenmo3tydls2emnvo t)aetomo ia1lmDrln olt0trumirpnu1al nlfvi (  2uaurp;u4tlxnmfctadfm2rlnmp;u0aexnxocia1lpte neslt)srxoxr nu4olt lfes sfaDtr( ont4olen i3tatls uanvonu0 rxrmr3totoa   ivi ()s2to(mpiudlpt mnesasf Dtr(monu1tpxn i3iysfmDrl( on()areoifctotfp  auei;s)trxo(opou4opt lneilt) Dumxr ;t4tleoifeiasfaDemnmpnu0teeoif oy1lm eanvi;t)srtrxr3iy4llte ietatfaDrmx p;u4tltn iciyt s rluvo t4 etoxrciatfmD lu s t  rtr(o ny4al elnvsltfaDrm( ooo4oleoiociadfs ea(mon(4aetnmfciotomtran slt0t2umio3oy1am e fetls a2tr(m ou1aee  feiatfsDuauvs t) rtrmo3iotopD  uvo;s)truoio ny4lptemnvtls)sDua(  nu0apt ioeiytfs rm(monu)trxnxocoadlat auvi;t s2uoio iudlle  nctl() Dum(mono0aet ifeiysfsDrmnmo t)aetnmocoo1om r neolt) etmxm3iy1ap nmnvtl(  Dua(  ou0apt io3iytls2uauvo;t) exrxrcto1fpt  n ilt sruo(rpno1lm e fvils)sDtau  no4oexomi3iltla ua(vpnu) renif ia1lp  lneo;s)trtmxm3nodapeemiet tfsDrrx  oo0alx  i3tatfs2uluvsnu0aleomo iy1fpDrai s;t  exrxo ny4lle lnes ()srtrurp;t1alxnifcilsfs2emnvpnt0tltomrciy1lm eaueo (0truoio ou4ap n fei sfarrmxmont4aexn oetlsls emnmp;u) rermr ta1fmDraneil(0t2umxo3nudomtn ivtl()a2tr(mp;t1oet  f3tlsfa umnvp;(0tlenir3io1lpDrln ils)tetmxo3ou1ol nlivt s sDuaxr ;o4oeenmicilslm2rlnvo;t)aetoircoy1fm raiei t0 etr(r iydomt  nviltf rtrxmpnt4opto fctaslm uanvp;(4 exnmrciy1omDelneo s s2triopiydopee nesa( sruax ono0olxnifetldfs2rm( ont) exnxo iydoa  aueo s) etm(rpnudomtn ies () Drmump;o4opeomfciys aDumu pnu)alxoxrciatom eli il(0s2xo(opno1ame  fcil(faDra(m nu4oee mf3iys aDea(vpn()teenmr3ootoateln sl(0 2trir oy1ape  ncsltfa2ra(ro;u4apenmoeiyd s eanvsnu4tlxomo ta1fm rluvi;( srtoxr nu4altn nci sf 2raum ot4oeto fcildfa2elums u) eenif3io1fa eaneslt0srurxopnydopte fetas) rtrur ;o4oexoiiciad aDul( o u0tlenmo oydoa eaieo (  exmir nu1llt  fvi s)srtmxm nu0aeto octltlsDea(vs t0artnir totfp r ieo;t0teto(mpiodllt  fvt s aDtmumpoo4aexnio3iltfm2rmn pnt)aetomo totopD aies ()teuoiopno1alenmivsa( srrrx o;u0aexomf3iydfm ra(vs;u)tltnxfcoodomD  iesls srtm(opnudlmt  ivs t) rtrur ;u0tpxnmi3ias a2elu p (0 etnxr oytlaDe nesl(0sexoimpnu4ope  ivsltf Dtmuroot4aexo f3tldfs umumsnu4 ltnmr oydfmtrau s (  2um(rpou4apenmfei (fsDurxm ;o1tlxoii3iyt a eaump;u0 rxnmocoadom   i s;t)seur(rpio1ol elfvtatfa2um( onu1aeenmoetytfaDel(vp u4arxriocio1fa  anvo;t0 2xrim ny1ap  mfcsls aDtm(monu4tpxn ieiad sDua( pnt)altnxrcoo1fp r nvs;s0srurxo3ny4lm emfct t)sDra( pou4tpxn oetltfa el( p;() lxrifcty1fmDeln i;(0 exrimpio1opt  icias) rua(ronu4tptoifetasfmDelnvo ()trtnir3oytlp raieils)sruo(r3ny4om  mieiltfs2tru pnu4tpxnmieiatfm uauvo;u0arxnmf3oydom rlu o;( texmxm nu4lm elnvil(f Drr(r ;t0oeen fctydfa2el(vo;t4 rxrxf3oatla eanvi s)srto(m oodolen nctls)arumx o;t0tpe iiciytlm2elnms;(4tetnxf tadfmD lnei;s sexrio iu1ap   nci tfs2tmuro;o4oetnmfciydlm elnvpnu0 exrmr iotomDrauvs s  rxoio io4am  mieiasfa2ururpno1olenmfetad sDrau snt0artriocta1fm r u ils teurxopoydlp   ivsas s2tr(r no1tltnmfciyd sDrmnvo t0 eerio tytlate ivslt)s2uo(opio1ll e ietatfsrrrurpnu4tpeomfeilt a2em( pnt)teermo3oadom e u ilt) rumxr oo1lm nlnvt () 2tmx ooo0oee  f3iys m2ea(vont)altrmf iadop rlues t0sruoir iu4ame lfvils s2ta( o;u4opxn fcils aDea( o ()areomr3iadfp rlieo;( s2xoxm iydom e fvsl()s2taxr ;u4tpto f3ild a elu pn(4aetrxfcoa1fptrau o t0setoir iy1lmt  fcs ( srrmx oot0teenmi3ildlsDrlums;t4aeermr3ootfmtrluesl( teurxo3oy1opte iesatfsDur(mpnt0alenmictlsfs2umnvpn(4aeenio3iytlmD au i;s0seto(opou1am emicil(f 2tr( oou1tlx iiciydls2eauvs (0 rtnirciadfpt  ivs;()s2urxrpio4optemfvtlt  rrru  ou4oee if3tlt s2ea(vpnt4aeerxf oydomt  ueo (0 etmxr3ou4lltnlfvtlsfa2umxm no0oet if3ilt m emnvs u4trtnxr oadlmDrluei s0teurio3nydlmenmfcil( srrm(mooo4olto oetadlm2umn ont0 leomf3iydfm  lnvs;(0texrxr3oydlltemnvsatfaDuaumoou0altn ociat a rm(vs u) exomf3ta1fate uvs t sexo(o iydaltnlfei s a2urxr no1aexn ietat s eanmsnu0artnxociydfm  lu ols)seurir iy1omeelfetls) rur(mono0opx mietys sDul(vp (0 etnmfcoy1fpD li i s) exm(o oo4lmtemfetat srua(mpot0tetomietadfaDua( snt0 etnxf io1lmte ivo;s0 rtrxrpou1lpe liesltfa2tr(m no1aexoio3iadfsDrlnvp;u4 etrmf tatomt  i o;t  2xmxo nodalenlnci () 2uaurp;o4ope iociysla rmnmo t4aexnmociatfatelnvo;s0s2xmxmpnudopen nct tfsDuaump;t0opxoiietad a rl(mp u0 ltrmr to1lat ai o t srtmirpiu1lpt mnct t a2ta(rpou0oleo o3tldls2ulnmp;t0texoirctotlmD  ies s)setrim3oydllt  feilt)srua(  oo0opx micild mDrm( pnt) lxoxo iatlmD an ol(  etm(mpoo1amen ncsas  Dtaxmont1olxomoetatls uln onu)tlxrmocoadfaDe i i s seumio oo4al emnvtas srrmumpnu4opxnif3iydfs2ea(vo t0texnif3oadlate nes t0 rtrxrpoo1al nlnvslt aDrrx ooo1olx mfctysls ea( s;(0 etrxr3iy1omt ai i;s s2tm(rpnu4ameelfcs t)sDrr(ro;u4ope if3iysfmDuluvonu)tlxnmrcto1om elueslt)seuoxm3iu1altelfesls)sDtrumpoo4oeto i3ias aDraumpn(4teeoioctodlp   ueils tetm(mpiu4lpe  fcia(faDrax  no4aeeo oeiadlsDelumsnt0trermf3oydfatrlues;s t2trxopnu1ap elfesls  Durxrpot0oee  o3iytfm ea( s t4aeenmr3io1fa rln il(  rtoxopoodomeelfes ()sDrm( pno4tpx mfeils aDrl(vp t) etniocty1lm raivo s teto(rpno1ll elictatfa2rr(ro;t0oetomi3iyt s rmn o;t4aeeoif3oo1latrai ilt) rxrir3nu4ol emfvta( a2rr(rpnu0tpxnmoeiatfm rmnmont0aeenmociodfmtelivs (  2xmxm iy4alen ictat artr( oou1tlx  ietlsfmDemnvo (4alxrif3io1opDr n s;s) 2xo(mpnudole  netat  Dtmuro;t4tee mocilt m ulums u)trxrxocoo1lpDrluvils) rtrirpiudal nmnvslt  Dumx o;u1texo o3iysfs2ul(vo;u0aetrmo3ia1om rlivi t) rtmxm3io4om  lnvil( artmxrp;t4tetnio3iyt s eau pnu)trtriocoy1op r u ilt t2tr(rpny4ap elfvi (  Duaur oo1tltoii3iaslaDuaums t4 eerxociydlp rlu i ( t2xmxm oo4omt micias  2umxmpot0opxnmfeilsla ea( s;u0altoxr3tytlatraivi;s0t2xrxr oydale lnvi ()s2uaxmonu0aee ifciytls rau s;u4artnxfctodfmDe uvs;() 2umio io1omeelncta(farua(m no0altnmictat mDea( o u4artrio3ta1latelues;s t2tmxr iu1ale livia(fsDra( pno4aexoiiciyslaDua(mpnu0alxnif3iadfp eln o ()seuoxr3oudol elfviasf Dua( p;t1oexnmfciasfs2ra(ms t4tlxrxr oadoat auei;(0truo(r3iu1al nmfvil() 2uaxm ;u4opxnmf3ild s ua(mo u0 etoio oa1fpt lu il(0srto(o ou1opt lfvi tfsDtrump;u1oeeo fciatla2eluvsnu)tlenxociodoa rlneslt0setmio3ny1aptemieils srtrxmo;u0oetn o3tasfmDeaump;u)trxnxf oydoaDeaivi t0 exo(r3oo1op emfvt t) 2trxr nu4aetoiieildla ul( p u)alenio3iydoatrau s;(0t2urxo io1alenlfvia( s2raum ot1alx if3iadfa2ua(mont0tetomf3tytfat  i o;( s2toiopoy4lp e ivils) Dururp;o0tpt moeiyslsDulnvo u0 lxrxf3tytfmt li o s)texo(o iy1op nmivil(farrau  ;o1apt mi3tysfs rln p;(0 exoxr3oytlm rau sls0 2xrxrpiu1lpee fetat)sDta( ono0alx  feiltlm ra( pn(0 ltnmo oa1oa e n il()s2xmimpiy4llt mfct t aDuax  ou1tlt io3tytfs rlnms () exoxociy1lpDr nvil(0seurxo3oydomee ivs () rrrxmp;u4olx ioeiytlm um( p;u)trxnir3oy1omt ai ilt  2xm(rpio4alt  fcslsf 2ta(m ;u1tpx  octld a2um( o (4arxoxo iadfpteluvolt s2xmim nodlltnmfetlt s2ua( ono0oeeoio3ild mDeanms u)tetnmo ty1oatrln sl( srtr(mpno1lptemictat s2ra(m ot0oex mfeiltlmDuan o;(0altrmf3iotlp ranvsls)seumxmpno4lm emivi () Drax  oo0altnif3tysls ua( p;(4texnifcta1oat  ieo;s) rurxrpny4open nesls)sDrrxrpot0opx mocils s raums;(4alermo3oa1oaDeli s () euo(rpiy4lpt lfeia()s2raxr no1texoioetatlm2umnvo u)arerir3iatfat  ies;() rxmxr oy1omtnlncs s  Dtrumpno4ape io3tys s2rmnvpnu0teeoifciydlatrli ils s2xrxm ny1om  miviltfsrtru oot4oet mfeias aDemuvo u0 lxriocoydopDr uvo t0t2xo(r3iu4lm nmivta()arrmxrpoo0apxnmfetys aDulnms (0 rxnxrcoadoa r n s s) rum(o3nudop n nvs t sDum(r ou4oexo feiytlsDul(vo t0tlxoir oytfmteaueilt)texr(mpno4opt mfvsls  Dtaxmono1tpx  feiat aDuau s;u4texoxfcoy1om   neols0trtr(m oo4opt lfvsat  2umxrono1tpxnmi3iad m2rm( p (0 exrmrcio1fmD lnvo;s0sruoirpnydaltnlncsat arrm(mpot1aexn f3ilslsDeanms;u) lxnmf3ootopDelnvi;t0srxmxmpoy4olt  ncsa()srtmx o;u4oltnmicildla rmuvpn(0texrxf3oadlmt aivs () 2tmxm oudomte nvslt) ruru ont4tpx miciysfs emu pnt)arxnmo3oo1fmDe n ols)trxmim nu1lm nmfcsatfsrtmx oou0oex mf3ils m rl(mp;t0 rtrmo3todomDraies;() 2uoxopio4lltnmietl(fartaxr oo4teen f3ilsfsDea(vpn(4 etrir ootoate i ils0s2tmxrpno4lmen ietltfs2uru pnt1alt iietadls ul( snt4 ltrir tytfmDeaueil( t2trirpoydole lfesas sruru oou1aleo feiltfsDeaums;t0trenxfcootopD  uvol()trur(rpoodop   iei t)a2rm(mpno4tpt moeiadlmDemnms;t0tlerifcia1om  li i (  exrxr nu4omt lncslsfaDtmu pou1ape  oetlsls umnmo;u4tlxomo3oadfmD aiei;t0t2tmxo3ny4lpeemfctlt srtaxm ;u1tltnmicildfmDean ont0tetnxrcta1lm r i o t0 eur(mpny4ope mnvs sfaruaurpot1apxnifciytfs2em(mo t4aeermf to1oat ai i;t0 rtmir3oo1lleelicsasf rumxront4aptoioetytfmDemnvs;t0 eerif iodom elivils trtoxmpiu1ame lfviltfa2uax onu4aeenifeiyd m ranmp (4arxoifctytla  auvsl( texrim oodole lncilsfa2raxr oo0alx mfciyt s uauvp;u) lxrxr iydfp elueils)t2uo(rpiudlpe  fvil(fa2ua( p;t4tex iociysfa rmuvp;t0alxrxo tytlmDraivs;()texmxmpou4oltemneta(  2rru oou1altomf3iad s2rl( snu0 exoxocia1om rlneil()t2trxopnu4opte neia() rrr( ono4ape  oeildls2eauvo (0 etrif3iotfmteaieilt t2trxm3iodom e icta(faDumxrp;o0oleo ictyd a2umu s u)texrxo3iodoa e nei;s seuoirpiy1omte fetl( a2rru ooo0opto ocildfa ul( pnu0artnio3iadfmD aiei (  rtmim3oodlme mivta( a2rru ooo4oex mictldla2ua(vp (4 exrxrciotoaDrau o s)s2tmxopio4ll  mivs (fa2tru onu4olxo f3ild sDeln s;()aexnmf3iatfmt  ueo;t0trtm(m nodale lfet (fs2rau oou4tlen i3iadfaDuluvp u) etnxf3iadlmt lies;() rtoxr nudap nmfeia() 2ta(mpou1oee if3iadlmDrm(vp (0arerxf3oadfaD aieo;t0sexr(r3iu1opt mivi tfa2rrxmo;u4alx mfciydfmDelnmsnt0 exrxr3iy1lp  livil(0 eto(r iodlpt  icta(faDrmum ;u0aeto feildfa2ea( p;(4trtrir3ootlatrlu o;s)setmxopiydamtn fcia()a2tm(r ot1tptoifciysfm2rluvsnu0trenxr3oy1oatelu o;() rxmiopiudomtemnci ()aDrmxmoot4tpenmoctls a elnmp t) lenxocio1lmt aueol()teuoimpoydlle mfcs sfartmxmpnu4ope  iciydlsDua(vs;u0trtrio oatom rlieo;s0seurxm no4lp e fet tfa2rm(rooo4tpx moeiydla2uauvo ()tetrmr3oy1om eaneo;s  etm(r3oydlmenmfviltfartmumpou0tltnmfcildfa2raump;()trerxr ta1opDrau o;s  eumxm3oydomen fet s s2umxmp;o4tlxn octld aDrauvpn(4alenxf3oydlp ranvs;s0 rto(m3iodap n fvilt)s2raxmp;u4optomfctydfa rmn s;(4altnmrcoa1lmt  nei;s)srxmio3io4ope licilt)sDrr(  oo4aetoiieiyslm2rlumo;t0 lenmo iytfatrli o;( t2xoxm nodlpen ncs (  rur( o;o0tex mf3ils mDemuvs;t4 renir ootfp  lueil(0 2urim ou1omt  fesl() rtau pnu1aeeniocildfa2um(mo t0 rxriocoytoa raneslt) exrxr3nu4al   fvil()s2rmx pnu4alt mo3iydfm ea( o t) lxrmrciotlpD  ivo ()sexr(m3iodoltnlfciatfarrrxmonu1aeeo octyt s2uanvon() lxrmfciotomD an i s0t2tmimpoy4ome  nvs t)srtrxm ;u4opx mo3iasfm2ua(vpn() lerxr oodfaDrlies;t0s2xoxo iydlleelicta( artmur no1oex ioctatls em(mo;u)tltrmr iodlpD  ueilt0srurim nu1lm e icsls)aDta(monu1olx mfeiadlm eauvpnu4arerxr3iatlmteauvilt sexo(m no1lltnmnvtas) 2rr(  ;t1ope  ietlsls2umnmo;u)artnir iodoa  li i;(0 etmir oy4ap nlfci t)a2ta(mont1aetnii3iltfs2uauvp u4trenmf3tatfpDeaues t teumio iy1al nmnet tfs2tmu p;u4altnmiciydfaDul(mp;(0areoif3iytopt luvs;t seuoiopnydllen icta() Drm(ro;t0texniietadfs2ranvpnt0 rxoifciy1oaDelneo t s2to(mpoy4llt  net sf 2uru onu0aleomfciyt aDrlu snt0aetnmfcoydfaDranvolt)s2xm(o3ny1altemivtatf Drmxmp;t1oet  f3ild a2uauvont0 lxnmf3tadoa eaieol()setrxrpny1ole  fci s  Duaxroou4tpx mf3tadfa2elnmp;u0aetnif3iotfpt aieil() etrim3no1amenmneias  Dtax ono1olxomfeild a2eau p () eeoxo3oatomDe i s;s) exm(mpiydopee ieias  rtmxro;t0oexnmfctltfa elnmp;u4texoio3iatoa   n o;s0t2tmxm3ou4ap e feta() 2tr(rpoo0alen ociatfm2rmn s;u)trxnmf io1fatrai i;s) 2tr(mpnodal  lfetl(faruaum oo4tpeomf3iyt s2rl(msn()artoxfcio1fmDe uvils0s2xmiopio4optemfcsl(farrmxmonu4altoiocilsla2raumsnu0tlenmfciatop  li ilt)srtoxopio1olen feslt  2raumoot0olt moeiytlm elu snu0trerxo ta1lpDe u o;(  eur(rpny1ap  mnei sfaDtmu  ;u1olt  fetytfm elums (0aeermfcty1om  aivil() 2to(r oo1aptemnvta( a2um(r oo0oexn ociyslaDemu p u)artoirciy1lmt aiei;t  eumxr ny4am nmfcslt)artm(m nt0oeeo feild m rmnvsn()aexrir3tydfmDe ivs s) 2trxmpiu4amtnlieils) Dtr(r nu1oeeomfetys s eaums t)alenxrcoo1la elnesl(0 rtoxmpnodope lfcsa()aDum(  no1aeen oetydfm ea(vp t0trtrxo to1fa r nes ()s2toxr nu1lltemivtltfa2trumpot0aexo ieiasfmDua( pn() rtoxo ootlatelieslt trumxm3iu1omt  fcsasf rurumpno0aexo fetyslmDra(vs t4aetoirctydfpt  ueolt0 eto(m ny1ameelnvs t srtau  no1oee ii3iyd a emnmo;t0teenir oy1fp  aivs;s0s2xoxmpnu4ame  nes s) rur(ro;t4opx  ictysfa rln s u4 exoxr3iy1omt anvo;(  etm(r3iudlme  ivsas  Draxmp;u4oetniiciytla2rm(vp;u)altnmr iy1lp  lueo;()texoxmpiu4ome mncs ()s2uaur nu1aeenifctldlaDeanvo t) rtnmocto1lmDe i i;()s2uo(mpny1lptelnetasfaDrrumpno4aee  ietydfa ra(ms;(0trtrxf to1fmD  nvs (0texm(m iy1ome mfvtl(  rrau  ot0olxniocild s2ulnmo t0tlenxo3tytomDe i s ()srxmxrpnudal  micias arrmxm ;o1aeen oetyt m2ulnmp;u4texniocoy1fm  livol( seuoxo iy4op n fvsat  2trumooo4oet ii3ils m emnmont0tlxomrcta1lmDrauei;( texoxr nodlp n ieiltf Dtr( p;t0aex ifciltfs2ra(vo;(4 reomfcto1la r nei;()tetoxo3oydoltnlnvt ( srua(mo;t1alx  octyt sDemu o;t4aeeoxf3totoa e uvo;s)s2ur(opnudlp elneslt sDtmx o;t0optomfeils a rlums ()aleoir oydfat lu s ( srxmxm3ny1ope lfcsl( sDtaxr no4tet  ociytfm ul(ms;(4tleomr oy1omteau ils srurxm3nu4al nmfes t) 2uau  no1aeenmociytfs um(vs;(0tetrmrcoo1fpD aies t) exoxr3nodlmtn fetasfsrtm( o;o4tptn f3iat a2rluvsnt4alxrxo3oatfmD au i t texrirpnu1lpen fesa(f Dtm(m oo1olxo ieild a umnmp u) reomoctytomDeluvils0trto(m nu1apen ivt t  Dum(m nu1altomieiysfmDul(mpn()tlxrmo3iatla eaues s setm(o oudomt  ictas  2trxr ot0oltnifciytlaDrl(monu)trenxf ootfp   u s;( tetmxr3ny1ap n fes s)sDta( poo4aeto f3tas s2elu p t4trxoxoctotoaDeaueo;s tetrir ou4apeelfesa()artau  nu0tpxnmfeiysfs el(vo;t)alxrio iytfmt ln s t0tetmxo ou1ale  nvtl(fs2trx p;u4tpto icils sDemnvonu0 etnmo3oatomDrlnes ( srxmxr iu1altemictl( srrr(m nu4apxnmf3ilt sDrluvo;u0 rxrxf oydfm ean i t0t2xo(rpoy4amt lfci (f Dua(rpou1tlxniicilt s uluvon()texrir3to1op e u i s)seuo(rpoo4om  lneia()arumxrpnu1tpt  oetydls rm(vs;t) exrxf3oo1fp  aneo;t)srtmxrpoy4lmtn ivi s srtrxr ;t1altomfeiydfaDuau ont0 renmrcoytomtr uvo;t s2umir3oy1omt mnet ( s2urxr ;t0alt mfciltls rl( p;() rermf oatfpt  n o;(0 2urim3iydopeemies ( artmxrpno4olt mi3ildfa2uaump;t0tlenxrciytopD  ies ( srtmir oo1op  lnvta( s2rau o;t4oeeoioctysla2el( pnt0areoio oydoaD  u i t)s2um(o3oy4lmt lictlt)sDumxm ;o4aeeniietasfs ul( pnt0tetrmr3tatla   uvs;t)t2uo(rpno1lp emivsat aDtau  oo4apxo f3tyt sDul( p;t0 etoir3oadlmDelnvs s  etoir oo4lm elncia()aDrmumpnt1aet io3tydfm ulnmp;(0tlxomr3oodfaDrlieo;s)srurxrpiudlmtn nvsatf rumxmono0tpxn ieildlsDrmu on(4tlenmociydlmtrluvs;t)t2xm(o iodoltnlfei sf Drm(rpou0aetoiieiltfs2ua(vo;u4 etrmfctodfm ranvsls0srumir ou1olenmicias) 2umxm no0aptoif3tytlsDumu snt4aeenio ty1lm e u ils  rxr(mpiudame mfei sfartr( ooo1ope  o3tls s2ea(vs;u0areoxociytopt au sls t2urimpoodome lfcsls a2uaxm ;t1tltniociasfa ranvs t4 lermf3totfmtrauvilt0trxoxrpoodlmt licia( aDuaum ot0tleomi3tad sDuanmo;u4tlenif3tatlmDrluei;(  2toim3oodoleemfct ()s2tm(mpnt1aexniictls sDua(vp u)treoxr oo1lmte i o;t)s2trxm3nu4omte iei tfsrumx  oo4oeen o3tls a umuvs;u4trenmociodoa eanvs () rtmxo3iydll emieiasfa2uaxront4aptomf3iltlm umn p;u0tetrmr tytopteaieo s0 2uoirpnodalee ncsls)aDtrxmpoo0oexo f3ilsfm2em( on(4 lxrmo tadfmt  uvi;(  rxmio oy4lmenmfvi s srtr(  ou4teto ieilsfs2uau p t4tlxrxociydfmt  nvi;t0t2xrxr3oy1aptemfvt tfarumxr ;u0alxo ictls m ranmon(4 rtrir oatoaDe uvols seuo(mpoydol n net t sDrmxmoou4apx mietyd mDeluvs;()aexomr tatlm  an o t)texrirpno1llte neslsfsDumu  no0apxomocils m2emuvo;u)aexoirctotlpt lneils0trtm(m io4omeemncias)aruru onu0olx  fctatlaDrln s t0trxnmfcoadoaD ai s t  euoim iu4lmen iet ()artaxmpno1tpen fetlslm2emu s;()tleomf iydlate u ol()trxoir3oy4optnmfcsltfa2umu ooo1oexomocilsfs2ea( o;(4trerio3io1om eln ol( trumirpoo4llenlfeiasf rum(  ;u4aeeoiieils a2ua( pnu4arermr3iy1opDrlu i;t0sexmxopnydalee nvs s) Dumu pnt1tlxoif3tltfaDumn o ()aetoxo iodoat ai o (  2uo(r3oo4lpe lfvsas)a2taxrpoo0optn f3iadfaDuau p;() lxnmrciatom eauvi s0 exo(o iu1lleemnet sf 2raxr ;t1texo ieiyt s2rl( s u0 reoxr3iodoa  livs t0teumimpiodlpee fci sf 2uax pou4optnifciad aDeauvs;u0tleoxrciodlm r uvs t)texm(m oo1aleelfet t  Draxr ;u1alxnmfeiyd s rlump;(0arxomociatfa   ivs t0 eur(m3ou4ap   netasfaDraxm no1oltnmi3tyslmDuau ont4altoxo3oytlpD li sl(  rxoimpny4opee ict () rua( pnt1openii3ildla2eln s u0texrir ta1om  anvo;s) euo(o iodlm emnvtl(  rrrx  ou4aleo i3iadlaDumums t0trxomo3iatomteln s (  etm(m3nu4alt miet t)srumu ont1apeoiictldfs2ra( onu0 lxoxf3todlaDrauvil(  2tmxrpoy4am   iet s)sDtmxr oo0aptn ieiadfsDuaumpn(4texnxo iodopD au i;t0 2uo(rpny1omt  iei t)srrauro;t4olto o3tld a2eluvs u4artomrciatoateln i;t0 2to(opno1alt livsltfsrtmumono1oex  ieiatfm eanvp;t4alxrxrciodfptrli o s0t2tmir3ou1amee fcilt) 2rr(roou0aetoif3iydlmDemuvo;u)tlxnmf3ia1fatrliei s t2umxr3nu1oltnlfvslt)s2tmxrono1opx mfciadlmDelnvp t)aexrmo3to1fa e nvs (0srumio nu4alt lnctls arrmxrpot0oee ifciytfmDrl(vs t)aexrirctotlpte ivs;t) rtmir oo1op   ict (f rua(  no0olxo fctls s rauvpnu0aeenxocoo1lmtr n i;( t2tmxm oydoltnmncilt)aDrmx ono1tptn ieiydls ulnvp (4 exnxr3todoptraueil( srxoxo oo4lm n nvs sfartaxro;u1oet ioctls s2ea(mp;t0 lxnircoydlm   ues (0sexmio3oudap nliesat) rra(r nu4alxn fciasls2um(ms t0 lxnifcoo1oa  aies;(0t2tmiopoy4ol  mictasfsDua(mo;o0opt mo3iltfm rl(mp t) rxoxo3oodlpDr ieols) rxmirpiy4alte fesas) rrrxront4oexo o3tltfm umuvp;()treoio tatlpD  nvi;(0 rto(opoy4lmtemictl( a2ur(r ;u1olx ifcild mDrl(mont4texnmfctodoa  lueo ( seurir oy4lm nmivtatfsrraumpoo4tlxomf3iadlm2ulu p;t) etomociodop   ies t0 2toxrpoy1lmt lnvias)s2rm(  ;u0olx iietatfsDua(von(0 lxomr3oo1late u sls)t2urxm3nydlmt  iesat)a2ta(m ot1olxomfeiltfm ua( o;(4texrxr3oadfatr nvs t)s2xrim io1al e icsas a2ua(mpno4olxomi3iatfa2rl( pnu0tlerxrcoa1lpDeauvsls trxoxo3ny4ap elnctltf 2rmxr ot0aexnifciat sDran p;t0trenmr ty1la  luesl(0sruo(m3iudlpee ivs ( arum(ronu4apto ietatls2ul(msnu)alxrir iy1opDeau s;(0s2xmxopio4lmtelictl( srtrxrp;t4aptomfeiatfa eanvs u0tlenifcoatfpteluvi;t srur(m iy1olenlics s  Drmxrpot1oltn fcils aDulu o;t4 rtoxo ta1fatrlies;s t2xmio3nu1openmieiltfa2uaxmp;u4tpeniietat a eau s;t4texniocoo1fmteln o;( s2uo(m iodamtnlfctl(fsDtmu o;t1openiictat s2eanvsnt) etnxo to1oaDraiesl( trxrio io1lme mivtlt)s2raurpot4ale mfctatlm2rmnvsnt4tlerircty1lmt aneolt0srxr(rpnydlmtn icta(fartaxmp;t1tpxoioeiytfa umums;t4aexnir oy1fat lnvi;t)srxm(r iudlle mncilsfsrtm(r ot1alt mfeiasla rln p;()tltoxr oo1fa   uvo t0 exr(o iu4lm e nciltfs2ta(rpot1oexnmoeildls rmums;t0treoxrctodlmDraneo;t0s2xrio iydomtn fctlt  Drm( o;o4tptoif3ias m umn p;u)teerxfcoydoa  lneo;(0trtrxmpnu4llt lnvi (faDumuro;t4tlenmiciyt m2elnvpnt)aetoxr3oodfmt an s t) 2urim oy1lptelietas)s2taxrpnt1tpt iociysla2rmuvs;()artnio tatop raneo ( truoim oydal nmnctat arua(rp;u0ale  fetyt s2uanvonu4artrmo ootoa  liei s0trxmxmpiydal nlnes sf 2taxmo;o0altoifciyslm2elnmp t4 ltomo to1lpDrluvil(0tetm(opnudom e nesa(f rtm(roou1tex mo3tlsfm rln p;u0 exomoctodfp  aueols0 rtm(o3oy1llt lfei s)artaum ;u1olx mf3tydlm2rm(ms;u) rtomoctotlaDe ivol()s2toir io1ll e feil( sDurxr ;o0apxnio3tld s2el(mont0texnif3to1fatr uvs ( sexriopnu4omt  feslt  rrrxrpou0tptn ieilt a2ul(ms;() rermr iatoaDeaivi;t) 2uoir oy4alt mivtlsfaDtmxmpno1opxn f3tad mDrlnmp;u0areomfcia1latrauvs;()teuriopou1ll  lnetl( artru pnt4opx mieildla rmnmp;u4trtnmo tatomD lnvsl( trurir3oo1olen fvi s artaur ot0olxnmo3iyd aDeluvo;u) etrxo oa1laD an s t)setoxrpiydal n fcsas  2taumo;o1altnifcilt m2rlu snt) exrio3io1fmt  n olt)setmio3nu4alt mfvi t  2rm(rp;u1tpt moeiysfm rm( s;u) reoirciy1lp eanei (0 eur(r no4lm nmfcs tfaDururpnt4oexnii3iytls2emumon(4aeeoiocoo1fp r u ols)t2uoxmpno4lp nlivs t  2ua(mpno4oexnifcias m eanms (0trtrio iy1lpDrai ols0trxoiopiy1lptnlnvsltf 2tm(  ;u1aptn ietlslsDuluvsn(4tltnifctotop eaneilt) 2tm(r iodaptnmfcsl(  Dua(m ;o1tpx mociadfsDeluvp;(4 etnio3oatla  aivo t  exmimpnodlp nmici ( sDumx  nu1opx ifetadfa2uluvon()treoxr tatla  ln sl(  2xm(m3nydlmte fcta()sDtaxronu1tptnmfetys s rluvont)tlxnxociy1oaDeaivols tetrir oy1lmenlnci ()a2rm(mp;u4olxoii3ilsfa ea( pnt4altnmf3tydomDranvsls  2umimpio1lptnmncs t)s2rrurooo0tpe moctlsfs2rlnvs;t)aeenxfciodfmDelivolt s2xrxo3oo1lpenlfcilsf rtr(m no0tee mictltlmDulnms t0aetnmf3iadla  an o s)trtoir ny1lm e nei sfs2uaumo;u1alxomociat m eau s;u)arenxo ia1fmtr ieo;s)trxrxopio1ol e iciatfartmurpoo0aet  octad aDemump;t4 exoxfctatfate nes;s0 2xo(r3oo4lm nlncilsfs2tr(rpnt1opt  feiadls2rm(vont4 rtoxoctydomtr n o;(0t2xr(m3iudal  mfci ()aDuaumo;t0opto ieiyslmDem( s u0tlxrxf3iytlmteanvs;(0trxr(rpny1om e fvsatfs2ua(r no1tlx iieiyslm2ulnmpnu)tlermf oodoa  aivsl( trtrir io1apee icsas)aDrru  oo1tptoifcilslm rlu p (0artoir3oo1fpt auei t t2umir3oodomtemfcia()srtm( oot0oexomociysls2ra(ms (4aexoircoodoatr u ils0 2umir nudame  nvt sfartm(m ot1apxn f3iadlm ul(vo;u)arxnxf3oa1om eli ols0s2umiopou4lmtnlfctat aDurxmoou1openiietys a ul( onu0tleoif io1lm raivo ()t2urim ny1aleelncsat)aDuau pnt4oex  feiydlm2emuvo u0trerir3ta1fatrliei t) 2toirpoo4apenlicia( arraur ;t0aptomfctatls rmnvpnu) eermr oa1lat  ivolt0 etrim iy1optelnvia(fsDur(mpoo1olx  oetatlsDemn snt)areomr tydlptrlues;s0s2xoim3oo1lpenlnvsls) 2uaump;t0ope iocils m2em( ont)teeoif3oa1fpt aiesl(0texoxr3oy1amt lfetat) rrmxront4tpx mo3iytla2um( s t4alermo iodlmte uvo s) rxr(m3io1lpeemfet t  rrr(m oo1alxo ictyt a uln s t0texomf3ty1om eaues;()srtrxm3oo1olenmfctl(  2ra(  ;o4tpeomfeiyd aDrauvp;u4tlxnxf3io1opDranesl( texoxr3iudam n iei (fa2tmurp;u4teeo oetlsfa2rl( o ()tlxnir3ootla eau sls texmxm3nudalenmiei (fsruru oou1olenmfeiatfs2ua(vonu)artnir totla   n i (0 rxr(m3nudopeemfvslsfa2rax pou0tle io3iaslaDraump;()aexomf3tadomt  n o;(0s2urxr nu4lm nlivi sf rraurooo1texnmoetas a2rmuvp;u4 leriociotfpteaivil( seto(o3iu1lp  mfei (fsDumum ;u4opt iieiadfa2um(mont4alenxo iydfmtean i t srto(o iodal  lnctat)sDtmu  ou0aleoii3tas a rlnvp;t0treoxo to1oaDeanvs;t  2uoio ny4lm nmfvsat aDtau  nu1tlxnifciltla eluvp t) renmr oy1fpt lu olt0teur(r iydamt miciltf rrr(m ;u4tleo oeildlm2rluvp;(0tlxrmrcto1la eauvi;t) rxmio iudam n feias srtaur oo1oex if3iysfa ea(vsnt0aleoxr3iodlmDraues;t)sexmio oy1amenlnvtatfartaxr no1ole ifctasls rl( p u0 ltnxr3oadfateluvi;( teur(opno1ameelictlt s2truro;o1apxnmoctad a2rl(vont0teenmo oo1fp  lueols)seuriopny1aptn fetat srtm(ro;o1alxn feiatlaDrl( ont0teenmrciadoaDe uvil()trtmxr3oydlleelnei sf rrrxronu0alxo fcilsfa2rauvp u)texrmf3tatoa r ues () rxoir iy4lp elivt s  2umxr oo4ape iiciyd s uanvs u0artrxrcia1fmtelnvo;t0 exoxmpou4ale mivt s)aDua(rp;u1apxo i3ilt aDuluvo () leoxocio1laDrlnes;s srtr(opnu1oltnmivilt)sruau ont0oeeoifcilsls uan p;(4arxoxocootfatran s;(  2to(r3oo1lmen ivi s)srtmx  oo0tleoifeiad sDem(vs (0 rerif oa1la e ivi;() eum(o3oudolenlicslsfsrrmxr nu0apxo oetydla2el(mon()trxnmfcio1laDr ivols) exrxr3nu1llenlivsas  Durumo;o4opxomo3iydlmDrlnms;u4 ltnmo3iadfmt livils0 2xo(r oo4al  lnvsl()s2rr(mpno4oetniocilt m ran pnu4aetomf oa1opDe i o t)t2xoiopou1lle  ivtltfaDtaxrooo4tpto o3ild sDrau p t4 rtrxr iy1fmDe ivsl()sexoxopnydlptnmfcias srum( pou0oexomociad sDumums;(4 lxoxfctadlaDeli i t s2uoio no1lm emivs () 2tm(rpnu1apxnmiciys m ran o;u0alenxf3oy1opDeau sls srtrxopou4op emfvtls)artr(m nt0oexn i3iasfm ra( o (4tltrmo tytom eau sl()srumim3io1op emicias  rurxm ;t0oex  ociatfmDemums t) lenmr iytfmtean i () 2umirpou4omt micslt)aDuau ont1texoif3iydfa ea(mp;t)tleoxo tytfpDrlnei s trxmim oo4amtnmieiat srrrur ot0alx iieilslmDumuvo t4 lenxf3iy1fatr nei s0 2xm(r3nu1lm  mnesa()s2ra(rooo0oex mictlslsDem(vp (0alenxr3iotfaD lu s;( tetoim3iy1am nlfvt tfsDta(ro;u0tlxoifetatls2rmnms (0aetnmocoydlmD luei ()setr(rpno4lp   net t  Draxmpou4tpxo ieils m2umnvs u4 rxrxfcoy1lmt  neo s) 2tmim nodom e ivs t  Dtrumont1tpeniictytfm umuvs u) reoxrctotlmtran i;(  exoimpio4op   ici t arrruroou1altomietytfa2ra(mo;t) etnmf3iadlmDr uvils0 2to(o oy1lmtnmfesat  ruaxrooo4tleo ietas mDemuvo;t0artrmrciatlp r u i s)s2trxm3ny4aleemivsat  Drau o;u4aetn f3tldfs2umumon(0 etrxocia1lmDrai o;t  2toirpio1am emfvils srrau pnt0tpx ifciltlm emumo t4aeenxo oatlate ieo;(0srxm(o no4lm emivt t)arua(moot0altniiciytfmDrm(ms;t) rtrxrcootopt  ueslt)texr(m nudlptnmivilt)arumuronu1texoifeias aDeau o t) lenmf oo1la   u i s0trurxr3nu4omtemnei s)s2taxroot1optoio3iatlsDrln p u0aeenxr3iy1lpDr ivolt srurxopiudop elnet (  2taxmo;u4teeomfetysls eaumo (0 exrir ta1late u i;( srxoim ny4al  lfcsl(  Dtrur nt1tpxoiiciydfa2ea(mp;t0aetnifcto1fpt livs s  rumirpoy1lpenlncs s)sruax  ot1tlt if3iltla2emu p u0 renmrciytfatr iesls  exoxo nydlle liciat sDta( oot1texn oeiydfm2umn s;u4tlermr tytomDrai olt trxoxm3ou4alenliesasfs2tr(mpoo4aeenmfetasfa rmnmo;u) rtoir3tadlat  u s;( t2tmxopoo1ap e ici (f Drrx poo4optomociysfmDua(vpn(4tlxoiociadlm  au i;t0 2xrxrpou1lm  lnviltfs2umum oo0tle iictat sDranvo;() etoxf3iy1fpDe uesl(0 euo(o iu4apt lfcs s  2taurooo0oeeoiiciytls uauvo (0arxoirctatlat li i;s)texrim3ou1lm e nvs (fs2umx ono0opeoifeiat aDem( s t0 lxnif3ty1fpDeanesl( s2xmxm3nodap emnvt sf 2raxro;o4oltnmoetysla2ulnmp (4aexomr oadfa elnvi;s teurir no1olt  ieia(fsrurxr ;o1olt  feiat s2emuvont4texrxfcoy1lpt lueo;s)trumxr oodoptn nvs sfsDuaum ;o0apeoif3iytls2el( o;u0tetomf oy1oa  auei s) exr(opoo4omeemieia(  rta(mo;o0tet  ietatfsDulnvs t0 exnio tytlpt  nvi;t0s2xmxrpno4lpee ivsa() Drmx oou0olx  ietydlm umuvo t)aexnmrciodoaDr uvs t)t2uoimpiu4ol n nvs tfa2rr(m ;t1optn fctys aDua( snu4 lerio oodlat  neil(0setoxmpoodome mnvta(  rra(rpot0opxo fetld aDrm(mp u0 exoif3ta1la  aies (0 exmir3iodlmtnlnesa(faDtau  ;o0apx iictlslm2uanms;u) ltrmfctatoaDe u olt0t2xriopny1ome mfet tf Dtaxro;o1tptoif3tas aDuln s u) lxrmfctadfa eai o s  2xo(o3iudllt licsasf 2ur( pnu0opt mieiad a ranvs u0alxnmrciytoat liei (0s2xoxrpnu4op  livtl() 2trx  nt4aleo feiasfa rmnvp;(0 lerxf3oadfmD  ivi;()trtmiopio4lpte fcsat s2rrum no0opxn fcilslaDemu s t)trtoxf3tytlpDeauvs (0setmimpnudlmt mnctatf 2umuro;o0oexomfciyt a ra( snu0aetoxfcta1lmteanesl( setmim iy4amee iet (  rtr(m no1oltn octysfm2ea( o u4 lxrxo3oytla eln i;t  2urim3nudoptnlncsl( s2tm( o;u4apeo o3tldlmDumn s t0alxrir oy1fmtelivs s) eurxopiudlme mnvi s)sDtrx  ou0tltoioctydlaDuanvs u)tetoxf3totlmt  i slt)s2xo(m3nodop n fvtlsfsDumu pnu4tpeoiictasfa2ranms u4teenxrcoadomt aneo;t0setr(opnydap elfvs sfsrrmu  ;t1teeomieiasfa2umn p t0 ltnmf3oa1oa e ueo (0srtoxo ny1ol nmfetls sDuau pou4aexomf3iaslm2umuvs;(4 exomrcio1omt  uvi;s) rxrxm oydlmee ies (farraxr ;u4openif3iydla2ea(mpnu0 renircto1om  au o;s  ruoimpny1opt  ivsa()aDtmu  ot1ope  ietad m ea( p t4 rerxrctytoaDr u olt)srxoxm3io1openmnetls a2umu o;u4tee mieiaslmDrlnmo u)tltnxr3iytfmDeli ol(0truoxr oy1lmt lnvtl( a2urxr ou0oltomoetasla ra(monu) rxrmo3totfp   u i t  euo(o3oudllte ics (faDta(rp;o1tpt iocilsfm rlu s;(4 rerxoctatlatrau ols setmxm oy4alenmnvsasfa2uaxmp;o1ale  fctys s2eau snt0tlxnmocootfmD lnei s0 eurirpiydop nlfvtas a2tm( p;o4aet  fetltfm2rlnmp (4 etomocoatlm e ieilt0seto(rpiu4al nlnesatf Drrx p;t0tleoifciydlmDeau pn(0aleomf oadfaD au s () 2toirpio1oltn feslt a2um(r ;o4tlx  fciyt aDem(mo;u4tlxniocoatlaD ln sl( sruoirpiudlmtemncsatfsDur(rpno4alt iocild a eanmsnu4aeeoir oatfm eau ols)srxrio iy4lmtemnet s)artmumpot1apxn ieiatfa emnms;()teeomr3oytomtrlnes (  2tr(mpiu1apt lfes s)sDtau p;o4opt  i3tadla2umnmsnt0alenir oo1l
\ No newline at end of file
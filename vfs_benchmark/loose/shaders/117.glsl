@@ -0,0 +1 @@
+uvs;s s2um(rpno4om n ivt (f rtaxm ot0openmi3iad m ranvsn()aeeomr3ta1fateai s;t0teumxo3oo1llenlivilt)a2rax ono0tpt  feiys a elump t4aeenmrctadlaDraivilt0s2xo(mpiy4lmtn nci t aDuaxrpot4aeeoif3tasfs2rl(vo;(4arxrmf io1fmteaivslt sruo(mpnudll  lies tf Dra(m ;u0olenif3ilslaDea(ms;u) eenmr3iy1faDrln s t s2toxopoy1opee feslsf rur( o;t4apt miciyt aDuan o t0arxnirctatom  ln i;(  rxr(r3ou1lmenmivtat)srraxr oo4oltn ietyt s uaumo u0artniocoy1lptr ueolt)s2xoxmpnu4om emnci tfsDrrx pot4aeto icils m2eauvsnu0 exoio3ta1op raies s)texo(r nudlm   fes tfsrrau onu1oeenmf3tyd a uanmpn() lxrxr oo1lm r n il() eumio iodolenmfes ()sDuaxrooo4tltoifciasfs eauvs;u)tetomo3ty1latr uvils seumir nu1llenmneil(f rrau pnt1tetnio3ild s ul( sn(0aexrxo3iodlptean o s)trurxmpiudll nlfesl( s2trxrpno0tpxnmoeiatfm2uln s;t)alxnioctotfp  anvo s0sruoxm3oy4lpe  ictls)aDtr(r ;o0aleoiicilsla2em( s;(0 etrxr3ootfaDelnes t)s2trxopio1opt  nvt s sDrm(rono1apx  iciat m2ean p;(4trenmf ia1fpDrlnvi;s srtr(m3ny4aptelfes t)sruau pot0oeto ieiatlm2rmu pnu4tetnxr3io1fm eli ils0trtoxm3oy1al elivtls)aDrru o;t1oleomieiyt s umnvo (4 rxoxo iy1opt lues;t0trxrio iydllt mnetl( arta(mo;t1oee if3ilslm ua( o u0tetrmf ia1fatr uvi (0s2toxo3no1lpeemnet t aDrmxr nt4ole micildlaDeaump (0tltnxf iodfaDr u sl(0 rtmir io1lpt  fetat a2rmu p;u1aetnmociysfsDumu s t)tleoio3ia1la elieilt0 rum(r ny1al emfctl(faDtmu pou4tlxomiciytfaDrlnvp u4alxnircta1fm elies s0trtoxo iudal n fvia()arrmurp;t1tex mfciat s2ul(mo u4 rtnmf3iotfa   i i;t) rxrim oo1lpte ies sf Dtm(mpou0oeeomieiadfaDul(vs t0 rxoxo tadfatr nvi t0 2xm(mpno4ol n ict tfaDtmum ;o4tpt ifeiasla el(ms u4tlxrio3tydomD aieil(0teto(o3iy1lp emnetlt)s2tm(rp;u0alxoifeilslm2rlu s;t4 ltomr3iodfp  luvi s)t2uo(r iy4amtn ietlt)artmxro;t1tpeomoctlt a ua( p ()aexrmo tadop  livi;s  euoxr3oy1lmee ivtltfsrrm( onu4ope ifetlsfa2rauvsnt) rxrxfciatlp elnes;s texr(opno1ap   ictl(fsDtm(rpoo4ole mfetltfm2uaums t)tltomoctatopD lu s;t)sruoxopny1lm nmivslt a2uaur ou4aee iietlsfa2ulnvs u0tlxomo3totlm  li i s srto(opno1al emivs ( sDtrxm oo0opeomfctltfsDemnmonu)alerxocoatfmtrlivi s0 2tr(m oo1op n nvtatfarraur ot4tlxoii3tldfa2em(vo;(0 leoxrctydomtrluei ( s2uoim3nudol nmiei ( sDum( ono1aee mociyd s rl(mo t4trtoxo iadopt  nvsl(0truoxmpiydlmtnmncs tfsrumx pnt4apxoiietad m emn p;u4 eenio iydfateli s s0srumxr3oo4olenlfcsa()a2tr(mo;t0opxo iciatla2rmu s (4aexrif iytfm   u s s0 rurim3nudlpe mici sfa2ur(  nu4aexnio3tys m2emumont0teenif oadfpt au i ()t2xoiopou1al emfvsls)s2rm(moot4olt  iciadfaDrm(ms (0tetrxf todomDe uvi ()trxr(m ny4om nlncs (fa2tm( o;t0texomfcils sDrmuvp t0arxoxr tatoptrln ilt trum(o ny1openmncsls srtr( p;t0tlxomiciatfm rmu pnu4 rerxo tytfat  neo;t0sruoxr oo4ll e netlsf rrmxmonu1tpt  fetldfs ul(vo;(0trenxf3oatfmD auvs;s)t2to(opio4open nvt tfa2rm(r ot0tptomi3iyt m ul(vonu)alenio iatlaD aueol()t2tr(o3iydom e nci (f ruau  no0alt  ictltfa2rlnmont) rtoxo3oatopD lneols0trurir3nu1op   fvs t)sDumum ;t0tltnio3tls aDrmumsnu4alxnioctydop e n s;(0s2tr(m iy4apee fet t) Drrx p;t0tleomf3iadfmDrm( snu)alxrmociytlp  aivols0tetrim3oy4altnmies s)artru o;u0tpeomietyt s umuvs t0trtnxr oytomt lueils) rxoxm nu1opt livs (f Dumumo;o4aleomoeiasla2ranvs;t) renxf ia1fm e n o s0texoxr ny4lpee ncta(f rrmxmpou1texo o3iys mDemn snu4 rxnmociadlp eaies t0srtr(o ny4ll nmfvslsfs2rr(rpno4oeenif3tldla2rluvont0trxoio ta1fpDelivs ( seur(mpno1opt mfcilt) 2tmumooo0oexoif3tydlmDeauvon(0aexoir io1lateaneo;(0srurimpnu1am e nvi t  rtmu  nt4tetnmietadfaDumums;t0 lxrif3oytoaDeaiesl(0setmir3nydom e fctl(fartrx pnt0olt mfetasla2eanmo;t)trtnif oatfmDe ivsls0 exrxmpio4lp  livsat  Dumxrp;u0apx  i3tysfaDra( p u)aetoxrcoodfm ranvi s t2uoio no4ap n nviatfsrumx  nt1aeenioetldfmDranvp (4aetniocto1opte ieo t) eur(o io4openmietas s2tr(rooo0aeto fcils m rauvo (0artrir3oodfmDrlueilt  2toio iudome mfcia(  rtaur nu4oetnmf3tlsfaDulnvpnt) rtoircto1lm e ivo;(  etrio iodll nlivtls  Duaur oo0aptnii3ild s um(vo;(0 eerif3oodlmtrlies;s t2xmio3iydolen fcsat  2uau pot4aeto f3tydla2elums (0 eenmfcia1fp  lu s (0teuo(o3iodlmt mict ( srrax  nu1apxoif3iydfa2rlnmonu0alxnxf3tadoa elnvsls t2toxo ou1amt mnciasfs2taumpnu1oee  i3ildla rmn p u4alerxfcty1lm eanvo;s)t2uoxrpiy4al  mietlt)artr(rp;u0aptnmoetatls2ra( p (0alxrif3iatom  auvo;t  ruoim3iudopen ici t) ruaxr ;o4oet ii3tysfm emnmo t4 lxnir oy1lm eaneil(  exrirpnu1llte nvsl()aDra(rpnt1tpe ioeiadlaDul(mp u)arxrir tatlmte u i;s sexr(o3ou1ll  mnci tfs2ur(roou0aeen fciat mDeaump;t4teerio iodfmt lueols seurim oy1amtemnvt (fa2urx p;t1teeo i3iysfa2emnms;(0aetoioctadla raueols0seurimpou1ll   nvt sf rumxrpot0oleomo3iadla rau p u0aeeomr3iy1fmDraivo;s)srxr(r oy1olenlicsltfsrum(mpou4tle io3tlt a2ulnvs;u0trxoiocta1la rluvi t s2trirpiy1lme  ncs tfa2ua( o;t1oexomf3tldlmDeauvo;t) lenio iy1lm rauei;(0 2uoio3ny1oltnliei sfsrtrumoot0oex if3iadfs2elnvs;(4artoxfciatlat ai i ( t2uoiopiu4llte nci (  rrrumont0tptomo3tatlmDul(mo;() rxnxrcoa1opDelivs;t  2xo(o oo4ap nmicta(f 2trxrpno0oltnmfeiatla uauvpnu4teerxfcty1fmtrau i t truo(r ny4altn fcil( aDurur ;o0tetomfctasfaDum(ms t0tltnxrcta1omtranvi;( trtmiopou1am elictatfaDraurono4apxnmi3iad m emnvs;t)tetrir3ty1fa r n s ()s2trio oy1lmtn nei ()arrm(m ;t4oeeoioctldlaDeauvp;t0altniociadfaDr uvols seuoxm3no4op emnetl(faDurx onu1tltoif3iys s2rlnmo;u4aexnif iy1lat aueils) rumxr3iudame lici s srtr(mpot0tltn f3iydlaDemnmpn(4aleomr oodlp r nei;s) 2um(m3iu4amtelncilsfsDua(ro;t4alxoii3tas sDua( p (4alenmociodoa eaieil( srurio iu1aptnliciasfaDurumpno0aee io3ildfsDumn o;u4 rerxo3iy1fatraivsls  2tmxm3no4amtnlncia( a2raxrpou1tpx ifctytfs2em( o;t)alenmf3tadopDrlies s)s2uoxmpnudopee ics tf Dtmx o;t0apxnmietad s2umn s;t4artomr3iy1lm elnvsls0 2umir oy4apte ncil( aDra(m ou4tpe  feiaslm uluvonu)trtoxr oadfpteanvo;s) rxo(m3iydlpte nei ()sDuaxmo;t4alt  i3tydls ul(vs;t0aetomf3oy1fatrau o (0 rumimpiy4lptn feilt) rtm( oot1tlxomf3tytls el(mp u0arxrxociotoate ivi;t)truoirpnydameemnet t s2tmumpou1texnmoetlsfm2rm( s t4 exoif totfm eau ilt teurir iodlpenlivtl( sruru pou4tet mocilslaDum( snt4aetnmfcoadop  ln sls)setrio3iu4amte ivtl(fa2uaxr ;u1ole ifciasfm raumpnu)tltrmrctytoatran s t0srtmxrpoo1ll e ietls sDtr(moot0olxoiiciat a2em(vpn(4treomf oatfm e ues (0 2tmxo3nudamtn ncs (fartmxr no1oltniietatfa ra(mo t0tltnxo3iydfmDelieolt0t2xmir3nydaptn ivt t)aDtr(rpnu0oeto feildls2uanvp;t)teerifcty1fpD aies t)seurxmpnu4lp elivsl( a2ta(moou0oeto o3iadfm2emu s () leomf tydfaDrln i (0srxrxmpoodlmeemfetltf 2rmxmpot1oleomieiaslm em(mo t4alenir tytlm elivo;s)srurxm ny1lm   fetlt)srumu  ou0tpeoiieiyslm2ul(mo;u) lerifciadfmtr ivo;()s2uoxr nu1olt  ivsatfarta(rooo4tet ifetyd a ua(vpnu)alenif io1optr ues s0seuoim3iy1ol   nei tf 2uru pnu1tpxn fciydls rauvs;(4aetrmrcto1op elnes;( srtm(o oo1lltelnetatfa2urxmp;o4oeenmi3iydfa ra(vo;t4areomo iatfpt li o s srurir iy4omeemnciat srrr(  nt1aexoiictydfaDelnms;u)aexrmo3iy1lpD  u i s trumxo oo4lp n fciasfs2ta(ro;t4tptoiietasla eluvsnu)aleomo ia1lm eli slt0srxrio3io1alenmnvsa( a2rm(  ot4tltnioeiyt s umumont4arxrmr3todoa eaivslt0setmimpoydlm elicsat)srumxrono0olto icils a ra( s u4trxoxr to1oaD  i olt0srur(m3oy1am nmnvsas)artm( p;u4ole if3iltla2umumo;()tltniocoy1faD  n o s)texrxr no4op n fvils s2uax  nu4tlx mociysfs2eau o;(0tltrifcoadfatr iei;()s2toir iu1ome  icilt)arra(r oo1altoii3iyslmDrm(vo;(0aexnxo3iotlp ranes;t) eum(m3oy4op n nei s)arrrur nt4alto oeiydfa2uanmon(4tlxoxo iodom rlnvol(0trtriopoudlpenmnei ( aDra(moou1oee moeiat a2ra(vp u) lxnmf tatopD ai o ()s2toxr3iy1op e nvtat)sDurxmpou4aleoioeiyd sDemn p;t0 ltrmo oa1faDr u i;(0s2umim3nydlpte netlt)sDtmxm ot1aexnmi3iyd s um(mont)trxrmociy1lptelueo;s0sexr(mpoy1aptemivia()sDtaum ;o4altomietadlaDuluvo;t4 lenxr iatfmteln s s0 exr(opou1optnmictlt  rum( p;u1aee  o3tlslmDel(msnu4aexrio iotomD luvilt0 rto(m3no4omtnlfeil( aDrrxmpot0tlx  fetas m2rmu p t0tlenxf3ta1lmtraivo;s seurxm3nodlmt lfvi sfsrta(rp;u1texn i3tadla2raump;t)tlenxr ootlp  anes;()texr(r iydamtemietlsfsrta(mpot4optnioeiatlaDranvp;t)alxrif3iy1lpt lu s ()srxo(opoydlpeeliesls aDum(m ot1tpx  i3iytfs eaumpnu0trxnir ty1lmteliei s0 rxmirpoy4om  lict (f rtrxm nt4oleniieiydfsDrmuvo t4trxoir io1lm   ues s0texoirpio4lmtn fvslt)aDrmumont4tpt  f3tytlmDrm(ms;u)arxoiociatfmDraiei;t  2xr(r iy4omte nci sfarurxro;u1aptoii3iltfmDrlu s u0 eeomocoadoa rlieolt0 euo(m3oo1oltnlncsas) Dua(ront1altn f3iytla rl(mp;u4arxrmf tydlpDe uvi;t0setoir io4lpe mivsltf 2tmx  nu0alt ii3iltfs2rmnmp u4 eeomf iodlmtr nvi t srtm(r3oy1lmen neia( s2rr(m no0texn o3tytlm2rlu p;u0 exoxfctadfpDraivo t0trxo(rpoo4lm  lieiat) Drrxmp;t0tlx  f3iadlaDrlnvp;u) lerir3tytfaDrluesls  2tmim3nydap  mfvs s) 2um(monu0tpx mi3tls m el(mp;t)tetomo3totfmtrai o;(0trumxm3iydam  mnvtl(f 2trumpnu1altomictytfmDrm( pnt) lenmf tadlatraiei;() 2xm(o oydopee ivias) Dua(root4teeo fciad s2elnmpnt) rxnxo iodfa  livo;s s2ur(m oy4am nlfvs t srrm(rpno0oltoiicils m2ulnvs;(0aexrxr3iodoat  n il()trxoxr3oo1lp e icilt sDtm( oot4aetnmo3ilslm rlumon()teenxr3tytoaDrlies (  rumir3nudole lfetls sDtmxmoou4alt  o3iyslm2rau p ()tlermo iotfaDraieo;s) ruo(mpoudamtn fct tfsrururpou4tle io3ildfm rmnmp;(0tetrxfcty1fpDe uvi s)tetr(m3iy1apte fcsa( s2tmx pnu1alx  ieiyslsDumuvo (4 etnif3oydlm r nvsls0sexr(mpnu1apte fvsls aDtax ono4ale  ieildls rlnmp t0texomrcoy1fmte n ils0 exr(m3nu4lmte nei s) 2ua(r oo4tlto i3tydls2rmums ()alxnxrcoatopD auvo;s  eumiopiu4al   ncslt)s2ra(m nt4oee  i3tat m2ulu p u0tlxrir oadfaD lu o;(0srtoxm3ny1omt lieils)s2truroou1aet mieilsfs2ul( o;u4trxrmo tytomt anes;()setoirpio1amtemietls srrrurp;u4ape  f3ildfm2ra( s u4arxnif3oy1fpDeli o;s  exm(m3no4lpenliviltf rua( p;t0apxomfetldfm2rln o u) ltoxrcoytlm raieo;() exrxmpoydaltnmictas)aruau o;o0tleoiietyd m umn s;(0tlermocoodfa  anes s) 2tmirpny4ap e ietls)srrm(m nt0alenmo3iltfm ulu s t4altrxfciadfmD  u s t t2xrxopoy1al  lieta(f 2trum ;u1tlxo feiltfa2ranmpnt)altnio3iytlmDrlueil(0tetrxr no1olt micsatfaDta( o;t0opxo i3iyslm2ra(mp (4 exrxf oatlmte nvs;(  eur(o iodamtn ncil() Dur( pnu4aleoioeiatfsDean o;t4arxrir3ty1op eau o;() rum(mpno1ll n fesasfs2urx onu0alt iieiatls2emnmsn(4alxnmf3iadfmDeanvi;()tetm(o3no1amtnmneil(  Dtrx oou4aexnif3taslm2umn p u)tlerircoytfp ranvo ()setoxr3oudlmtnlici (fsDtaurp;t0texnmoeiad m emn o t4 exrifctatlmD anesls)truoxr3iy1oleelict s) 2rrurpoo1tpen oeiydfs2ua( s;()tlxrifciodlpteanvi;s0texoxo iy4op e ict s)sDumx  oo0oeenifetytfm2rlnvsn(0 ltrmr3oa1fmDrlnvo t0 exm(rpiodamtn ivs s srtm(ront1open oeiatfmDeln s;(0teermo tatomt  ivs t)srxmiopnydopee fvs t) 2trx ont4aptn fcilt s2rmu o;()aetoif iotfat  neil(0tetoxmpoy4amtn ictl()arur( oot1altoifetlsfs2rm(mpn(4alxnmocta1oate nvs;( seuoxo ny4omt liesa()aDrr(mpoo4oetnmoetytlsDra(vont0tetoio ta1oate uvilt t2umim iydam nmfcsatf 2urxro;t0texomfciytfsDrmums ()trerxoctytoptelnesls)teuo(m nodape mici ()sDtaump;u4olx ioeiyt m ra( onu)alxomocoy1lp eln ils)trxmir3nodom e ivils a2umx  ou1apeomoetltlaDra(ms;(0tetnmf3iodom r ueo;()trxrxr3ny4lmee nviat srtm(ro;o4alxn icild s uan p (4 exrir oytla e u i;s s2trxopno1ole  net t) rumu o;u4teen ietltls2emuvpn(4 ltnir3iodfmD livolt0setr(m oudlmtelivtas a2rmu pnt0alx  fcils sDrmumsnu4 lerxr3oatoa r uvs t0 2tmir3oy1lm n ies () 2trxr ;t0ale iociadlaDeanvs u)aetrmo iydoatr nei;()t2uo(m3no1ap  livt t a2rru pnu0alxnmo3iatfaDrluvo;t0teerxrctatfmteaivi;t)t2triopno4olte fetls)sDurx ooo0ope ioetydls2rlnvp t0arxnmo3ta1fp   i i ( trxr(m3no4om nlfciltf Dra(r ;o1tex moctydls rlnvp;u)alxnxfciydfmtelnvo s s2uoxo ny1ll nmiet t srta(mp;o4apenmo3iad s2rmump;u)trxoxrcootfa eaies;() 2uoxrpnydlpenmivtlsfartmx p;t1oee  fctlsfs emu pnt0aetrmrcio1la eluvi;t0teurio3ou1oleemnciat)a2umxmono1tleomo3iys a rmumpn(0tlermfcoytfp  ai olt)seuoir oudlmteliviatfa2rmu pno4tpxo iciyslm2el(vsn(4 ltoiocoo1fmDrlnesls teumim3iudll  mieils s2truro;t0texo f3ils mDran o;() rxoxocty1om rluvi;t  2um(r ny4opt mnci tf rurxm nu1aee moeildlmDrmn pnt)artoiociotfaD an ilt s2tmio nu1aleelnesls a2ta( pou4tlxnmfcildlaDul( sn(0arermr iadop e ivsl() rxrxo3iodam elfeia() rur(mo;o4oeeo o3iltfs2uau o u4aexomf3oadlpte iei t0t2umiopiy4amenlnct ( s2trxmoou4oee  feiasls rl(mp;(4 reoir iatlp  aneo s) rtrxm oydlmeelfes (fsDuaump;o0opxnmfeiltls2uaumo t0aexrio iodla  livs;t s2xoxopiy4lpe micils sDrax pnt0tleo fctad m2um(vs t4trtrxfciytoptr ieo;s) 2xmimpiydal  mivt s) Dtaxr ou0aetn feiytlm elnvpn(4 lxoifciydomDeln ilt s2to(o3nodamte ieil(f 2rrxmpoo4olxniietatlsDelumpnt0 reoif oa1laD aieo s)setm(m3io1opee nct sfa2rm(rpot0aexomf3tydla uanvo;u4aeermr3oydlatrlnesl()t2umiopoo4om  mfctas) 2rax pot0aetoio3tyslmDelnmonu4artrmrcta1fm  aneol( t2tr(opiudolee ivt (fsrumx  nu0olx mieiydfaDemuvo;u4tlerifcty1fmt  nvs t)s2tm(r3no1am elnvil(f Drrx pou0olt mieiyt m2rlnms (4 etnmrcoodlpDran o t) exrio iy1am emivt ()srurumpoo0tpe mi3ilt m umn ont) lxomf to1opteaueolt0 2xm(o3nydomtemnvslsf 2tm(monu4texn ictlsfm um(vo t4aeeoxf iotfa ranvs;t0 rtmxrpou4llenmfvi (fsDtmxmpno1opxomi3tadfm2ul(vo u4tlxrxfcoa1fa r nvi (0texmxm3iy4ll  licsltf rrr(m ;u4texnmfctldfs2rmnvo t4trtnir iadlpt auvi (  euo(o3oydal nlfcslt)srra( pno4aexnifeiydla2rm(vo;t4teerio oodfate ies;s0 rtrxm nudapeelfesat sruaur ;o1apxomf3ilt m2rl(vo;u0trtnir3iotom rauvslt) 2xrxm ou1am nmieias aDrru ono1tpxoioctydls2rlumpnt0 eerif3totoa elu ils  exmio3oydal n ieiat)aDumxrpnu0aleo ocilsfaDulnvo;u) lermocia1lat lnvilt s2um(r iy1lp emieia(fa2rau  ;t1tle  fciadla rl(mo (0artrmf3tadoaDelivsl(0seumxm3iodam elfcil( artaxronu1tee miciltlsDulu p;t0 lxnif3tadlmDrlnes;t0t2xoxo3nu1am emivs t  2um(  oo0tpt mocild s rl(mp;t4alxnioctatoa rauei;()srxoxr3nu1apte fvsl()sDraxrp;u0aex mo3taslmDuan s;t)tlxomfcoodfmtelu o;s)srtriopiodamtemivtltfa2um(mooo4opxomf3iadfs rau snu4tltnxocoatfpD li sl(0trxr(mpoodll  miei (f rraxrp;t4aet  oeiyt aDumnvp;u0teeoif3todopteaneols)texm(rpny1ome mivt s sDtrumpot1oltnmfciltla2ea(vo () renmr ia1fpt  u o;(  eto(m3io4op nlnciltfa2rm(m no1oeenmo3iytfs rlnvon(0arxrmf ia1lpt ai slt  2xoio oy4ome mfvt ()sruru p;u1apen feiydfsDuluvs t4teermr to1fpD an o;() rtr(o io1lltnliesasf 2taumpou4oltoiictad a elu snu4 ltoxr3todlptelnvi s)t2ur(o3ny1omtemieilt)srrrxrpoo4alxo fcildfm2umnvs t)aeenmf3tydom eaueolt0t2toxr3oy4ll  mivi s)s2rauro;u1tetoiociys aDraums;() rxomf to1lmtraiei t) 2xo(opnydlptemnei (f rtaumonu4tpx ioeiysfs2uan s u) rxnio3oydopt anvi (  rur(m iudop  lfvt s s2rmurooo4oeen ocild a2ulnmsnu)aexoxf3oy1oat aies t) 2toiopio4omee fvs t)sDtm(ro;t4olto f3iyd a2uan snu4texrxrciotlpDrlues;( t2uoxopnu1aleelivia( a2um(rpou0tltnmoetls a emnvsn(0aleomfcoydlp r uvs (0tetoxo iu1om nmnvs ()artax pot0apenmieiadlsDeln o ()trxnxrcoatlatr ues;s setoir3ou1lpenlnci t)aDuaxmpoo4opxnifeiatls2rln s u0tlxrxo3tatlptraiei s0setrimpnu4ameelivta() Dum(r nt1alx iicias s rln o t0 lermfcoodop eaivs s)trumxr nudopenlnvtlt sDuax  nt4oeeoio3iat m2rmumon(0 lermr tadfatrlu i;s  rtrim ou1alee nvs t) 2rm(rpoo0apenmi3iadlsDean p u4 rtoiocoadlmDeai s s)teumxopiudlme  fct tfs2raxrpot1tet mo3ils s2um(vo t)trtrircoodom eluei ( setmio3oodaptnlfesls  Dtaumpnt1tltn i3ildls ulnmpn() rermo ia1oaDe n sls)s2umim iydap e fviat aDta(r ;o0aeenifeiyslm emnvo;(4tlermf3oatlmt ln ols) eto(mpnu1ol nmfctatf Dra(rpnt0tpxn ociltlsDrluvp (4 rtrxf ia1fpDrliei s) exr(m3oo4am nmfvt ()s2rmu  ;o0apt  oetatfaDrau p (0 exoxo3oy1fat lnvo s)s2uo(o io1lp  mnvtat) Dumuro;o1tex  fcildfmDrauvp;t0 exoirctodom r uvo (0srurio io4am e fciat  2rm( onu1altomoetlt a el(vpnu)aetnifciatlatr nei s t2xoxm3nu1ope liviat aDumxrpot1tpto o3iatla ulnms;u0 exomr3io1fa ran olt0t2xmxo nu4lmenmivsas a2tr( o;t1texn o3tydla ulnms;(0arxnmrcootla r nes t0 eumir nudape liesat)aDtm(m oo0tlt ifetys s ulnmo;t)tlxrio3oydlpD anvs s)texmxo3nudlmtnlfct sfs2rru  no0aeeomfeiltfm2raums t0tetrir ta1lptrauei;(0s2uo(r ou4amt mieil()s2um(mo;u4oltn fcilsfs2umnvsn()texoir3ootomDe ies;(0trtrxm3oy1om nlictatf rtaxr oo4tlxomi3iyt m2eanvpn()areoif3iytomtrlies;(0 2xmxmpoydomenmnci ( arrm( pno0teto f3ils a2emuvp;t)tleoxo iodla r uei t) etrir nodlm n ncsa() rur(m no0optomfciyt a2ra(ms;t) exrif tatfaD anvolt0t2xoim nodlp n ncsas)aDtmu pnu1opt if3ils a2rmu p ()tlxnmf3oa1op elu sls0s2trir iodlptemivs tf 2trumpou4tpxn oeiysla ra( s u0artomf tydom rlivo (0 rxmim3ou1aptelncsas) rumu  ;o4oexomoeiaslm eln onu4trtnmr3oo1lpte nvi;t trtmxopoy1oltn fet s) Dumumo;t0opeoiieiltla2rm(msnt0 rtnmrciydfptrluei s) 2xrxopno1ol   ivtl()artrum nu0alxomi3ilsfa2um(mpnu0arxrmrciotoat  n il()trtrxmpiudamteliciatf Dumu  ;u1aet mo3iadfmDua(mp;t4teenifcoydlptrai s ( truoxm nu4lp nlfctlsf rrrxrpou1olenio3ildlm2eanmp;(0 rerifcta1opt auvsls t2xr(o oo1ll nlnctlsfaDrmu ont4ape moeiysfsDrluvs;()tlenmo todoate ieols0trtmxmpoy4ol  lfcsas s2rmu pot0tetn ociytls ea( s u) exnxo to1fpDe nvs;(0t2trxopnodll  liei s aDrrxro;t1apt mo3tldls2ulnvs (0teerxo ty1fatrauvo;s0setrxr3iodol  lieias)artr(ronu1oexomoeils a2el(vo;u4trtnio oo1oateli ols)trxm(m iu1ap elfet t) rraurono0tltn f3tltla ulnvsnu0aetrmr3iytlpDelnvslt) rtmxopiu4lpee fet s arumx  no1tex io3tyd a umn pnt0arermfctadop  aivi;t0srxm(r nu4lp nmietas  2tmu pno0apxo oeiad sDeanvs;u)tetrmfcootfpt lnei;(0seto(opio1ll nlfvt (f rrm( oou0tptnmfetatls elnvo;u0aleoxocta1fatraivo;(  eurir iodlm n ics s)s2taxm ;o0olt ioetys a emn o () rxomrciydom   ieil( sexoir no4al nmfcsat) 2rau onu4tet mfeiat a2uauvo;u4trermo oadfmD au s t)trurio iu1lmenlfcslsf rrau  oo4tex ioeiatla2rau pn(4 eerifcoydoptrlieo;(  etoxm3io1olt lfcta()a2umump;u0oetnio3iadls2raumsnu4 exnmr3to1omD ai ol(0 exoio3nu1al nlfetls  2ta(m nu4open ieiysla umnmpn(0alenmr oa1om  auvils texrim3nudom nmfct s)sDtmum ou4aptnmf3iasla2rmu p (0texrxfctadomDrlivsls) rtmxopoo1alt lnvi s a2um(r no4tlto iciys m el(msnu) rxrmrcoydlm e ivs t  2to(m iy4lptn neiat) ruaxront0tee ifeild m2umuvsnt)trxrxociotfaD ai ilt)tetoiopiu4lmt  feiltfaDur(  ;o0aptnmfeiasla ean pnu0texoxo3ta1fmDr nvi s) etm(r3ny1am elfetat)a2rm( p;t0tee mfetldlmDua( sn(4tlenmo oo1laDeanvs ( seuoxo nydoptnlivil(  2trxr ot4tpxo i3tadfm rlnms t4texnxf ootopDelnes ()texoxo3oydol nmiesa( s2taxrpoo1tpen fciytfs2rm( p t4 ltrir oy1lpteli i s) 2uoxm nodome lieslt)s2trxrp;t0oeen i3tyt s emnmo;u4tetriocootoatrlieo ()t2uoxm3nu1ap eliciltf 2rmxr ;u1apx ioeiytlm ra(vp u4arxnxo3iotfpDeanesl(0srxoir3io4lm  lnetl()s2tr(root0aeeoioetytfaDeau pnt4trerxf oytfa  aivilt)t2ur(mpio1aptnmnes () rrm(rp;u1texn fciaslsDuan s;u0arenxo3ia1opD li s t  2urxo3iu4ll n fvsls)aDtmx p;t0tex  i3tlsfa ulumpn() etoxfcootfpDe ieo s0tetrir3oodllte fcsltfaDtruroot0teen o3iatla2emuvs u4tlxnmf oadoptr i i;s tetm(rpoy1apee nvtls sDrax poo0aexo f3iyd a um(mon()trtrxfcia1faDr uvs;() rtoxo3nydam elnvil(fs2tmu  nu1tlxomiciyt aDum(vpnu4tlxomr ootopDranei;t0s2toxr3nu1olt  netlt) 2tmx ont4oex ii3ias m2uau s;()aeeoiocio1fpteaivo;s0teumio3no4ap emies sf rtm(m ;o1olx  ieiltfmDul( p;t) reniociotlptrauvs t0trurxr nu1lleelnes s)sDuau pnu1alxn ieiadfsDranvpnt0teeomfcto1lmDe ues t) 2tm(m3oo4al  mncsls)sDrrumono1apenio3tltfmDrmn o;t4 ltnmo totoa rauvi;()t2xmio io4apen nvs ()aDrr( pno4oetoif3tltla2rlums;t4 lxrmo ta1fateaivo;t)teurxo3ou4lmt mneia() 2rrx pot0tltnmiciasfa emu sn(4trtoif ia1lpte ivo;t0srxrxr oydapee ivs ()aDraum ;u0tex mf3ildfsDuluvo (4 rtnif3iytfpDelnvs;s)sexrio3no4apee neilt  rur( pno4teenifcils a2elnmsnt4trxoif ty1laDran o;t  eurxr oy4op elnci ()arururp;t0alxnio3iat m2ra(mp;u0aetomocio1fmDr u o;t0srxo(o3io1al emnci sfaDtau onu0alxniocilslm raump;t4 rxrir oydoptr ueilt  2tmio3no1lp emiei s)aDtrxmpoo1tpeoifcild mDel(vp;t4 rerxr3oytfatrlu sl(  rumio3oo1amtn neia( s2tr(  ;u0opeomictldla2ra(ms ()aeermf3tatomD li ols tetm(m io1am  mfvtlt)arrmuroot4oex moeiatfs2elnmpn(0 etrxoctadfpD ai i;t  2ur(m nu1ll   ivtat aDua( poo1opxniieiysfm rl( p;(4 lxomr3iotop elies s)teur(m3nu1lleelnvta()sDrmxrpot4teen ieiltlaDumnms t) exrxr iytlptranvo;t0 eto(r3iy4ol   ict (fsDrrumoou4aee  fetysfs ul( o t) eerir oodfmDeluvils t2umim3iydop e ivtlt  Dum(mpnt4texnii3iydla ranms t)artomrcio1fmDr ieil()t2uo(opou4lp n fviasfs2um( ont0opxnmiciyslaDeanvsnu0 eenmf3iy1fate ivol(0t2uoxr no1lp emncslt) Dtr(mpou0opt ioctyt mDrmnmp u4 eerio iy1lmt  ueo;t0s2xm(r3nodlle mfcia( a2rrxm nt0ole mietadfm2el(vs;t0 lenmrciydlmtrlu olt  rxoxrpiu1am e icils)s2um(ro;o1optnifciltlm2ua(vo u0 leoxo todfaDrlueils  2ur(o iodom  mfetls)arur(rp;o1texo feilslm eluvo;t4tlxrxf3iydfpDean ilt) 2triopiodlpt  nes sfs2rau pnt1oee mfeiasls2emump;(0texrir3iatfa  liei;s0srumxopiudoltnlneil() Dua(r ;o4opx  f3iatls2ulump;()aeenxo3to1om eluvs;s)setriopio4lpe mnvta()artaxm ot4tee  fciltfa2ea(vp;u)teenir3ty1fa  au i;()t2toio3ou4apt mnesl() Dumu p;u1texo ociaslm eluvp;(0 rtoxrcoatlp  lu o;()s2tr(m3iy1lpt  iei ()s2raxroot0aetomoctlsla ra(mpn(4 ltomr iatfa elnvol(0srum(m3nu1op  liet tf Duaxr ;t1opt  fetlsls2elu s (4trxomr iodfaDrlueo t0s2uoir3nodlp nmnct t  Dumx  nu4opt  i3ildfa emumpnt4 eenmrcoodomt aueolt)trxoir ou1opt micilsf rururo;o4tetn ocils a2ea( s ()trxnxo oadfpt liei t)srur(m nu1lp elivsa(fsDur( o;o1oeeomf3tas s ul(mon(0teenif3iatlmtr uei t)srtoim3nodame mfvil( a2um(rpoo0tpxomoetys s rlumo t)tltnmo3iydfp eaueo s) 2urir oudom n iviatfaDtaxrooo4teeomf3iyslsDelu on()trtomf ia1op eaneo (0s2tr(r3ou1amt mivias) 2umxrpnt4tetn f3iasfmDul(vp;t4tetrxo ta1opt  n o s t2um(m oy1omeemiei s)srumx ooo4optoioeiasfm rmuvsn() rxnmf3ootoa   uvilt0 2tm(mpiydlmt lnei (faDtr(mono1aexo f3iltfaDrlnvs;u0 etnxr oy1fmDe ivolt)trtm(m3nudlptn feils arra(m ;u1olxo fciltls umuvo t4aexrmfctatla   u s;s s2xmxo3ou4amtnlfcil(  2raumpnt1aeeomo3iat s ulums t) eenir3oatopDr u il( s2trir oy4amee ivils srra(rpoo0apeoif3iatfa2umn ont4tltnxr3iodomD  ueo;(0 2xrxopno4al nmfes s) 2rr(r ou1oexo octys a2rauvsnu0 rerxf iatomDrluvo;() eumirpno1oltnlnesat)a2uau oou1oex if3ils aDea(msnt4 rxrmo3tadfp eln sl()s2xrio nu1apeelfei s)arurx o;t1tpx  o3iltfm2rm(vs;t) renif3iy1faDr ivo;()tetoxo ou4ap  lfvi t)artaumo;o4apeoifeiadlmDum( o;(0 eermo iodfpteaivil()srumxr3nodal nlivsl() 2ua(m ;u0texo oetysfmDrau snu4alenio3iytlmDran sls0s2xoxr no4lpte ivs s srrrumo;t0ope mictls s umu p u4trxomrcoo1laD  nvo;(0 2tmxm3iodlmte ici s  Drm(rp;u4tpeoiociytlsDua(mpnt0tltnmoctydlptrauvilt)s2xm(rpou4ape mieilt)sDtrx pno0openmoetyd a2ua(vsnt4 exrir oytla r nes (0seuo(m3nudoptnmfvt s aruaxmoou4oetn o3ilsfm2rlums t4treomrctodfm  anei t) 2tm(r3oy1ol  mnvsls)s2taumpoo4tpxomfetld s emu pnu)aexrmo tydfpDr ivs s0srxm(opou1lpe mivia()sDta(  nu1opt iietatlm eanvont0trtrxrctadfp  ln i;s) rtm(o oy1lleelicsl( srrru p;o0oltomfctld aDemnmpnu4artrif3iodfatrluvs s)s2xrxm io1lmt lnes s srtm(rp;u4tpxomoctlslm elumo t0altrmrciytfmtrli s (0s2um(m ny1altelivt (farrrx o;u4apt mfetyt a elnmo u) lermr3ty1laDe nvi;t0seto(mpiu4ole lfeias s2taumo;u0aptoif3iasfsDelums;t4alerifcoytoa  lueo t0seuo(m oo4altn iei t aDtauro;o1oeeomocilsls2ua(vp;t)trtoio3oa1fmDrli i;t0teurxm io1lm emivsl()aDtaxr ot4tpxn oeilsls emu onu4alxoir3oy1late nei (0trurir oy1ame mfcsasfa2urxrpot4alen oetlt a2umn ont4 rxrmf oytlmDeauvil()trxr(o ny1ol  mict (fa2tm(  ;u1tetn oeiadfaDra( snu) rxoir3oy1oaD anes;( tetoim3oudam n iet t) 2trxmp;t1oeenmf3iadfs2rau p;(0 renxo3oydomtelneilt t2xrimpno1alteliciasfs2rmxrooo0ape moeildla eln p u0artnxfcoo1fpD  u o (0texr(o3oo1ol eliviatf Duaur ;u4alx iociytfs em( s (4tlenir3oadfaD anei;t setoimpno4llte ivi t arrmxmpoo4apt  iciadfaDemuvp u) exoxo3io1lpDe uvi;s srtr(mpny4omtelfet t) rurx  ;u4opeo fciadlaDeanmo;(4 lxrmoctotopt lnes t texm(m oy1omtnlivsa() rurxmpnt1apt mfetld s ra(vp (0arxnifcootfpD lnvo t)t2ur(m nydol elnctl() rtmumpot1aet  ictysfa2el(mpnt)arerxo tytlmtrai ils srxmirpnu1lmeemictasfsDumuro;u1oltnifcild m uau o u4aetrif ootoaDraueilt) 2xmxmpnodlpenlnvsa()sDraur ou0alx moeiltfm eanvpnt) leoiocoytfmDeanvi ( tetr(o3io4om  lnet t)aDrr(mo;t1apen ieiasfm2elnvo t) etomr3iotfm raneo (0 eumxm3iu1ale lfciat)a2urump;o0oee mfctatlsDumn o t)altrir tydfptr ies;t srtmiopiy4omenlfvt ( aDra(mpno0tleoiictasfs2um( o () reoif3tatoa  aies;( s2xm(rpoodlp   ncsat)sDtr(r ;t0apenmfciysla eaums;u) rxrmrcoy1optr ivo;(0trxmim3oudol nlfeta(  ruaxrp;t4optniiciltfsDumnvp u)trxrmrctydopt li slt0sruoxm no4omtn iesls) Durx ont1aeen fetydla2el(ms;t) lxnio3oytlpte i o t  2um(m oudalenlivta(  2trum nu1olxo icils s eln p;() rxrmo3ootfp  lnvo s)srtr(m3oudlleelfct sfs2ua(r ou0tleoioetyt a eanvs u)tltnxo ty1oaD  iei (0 rtoxm nu4al   fcils)sDtr( oot0aexnmoeiadls2eluvsn()texrxo ia1fm   n olt) 2xoxo3ny1oleelfeiat) rumx  ;t1tetomoctatfs umu pnt) rermrcoa1fat ai ilt)t2tmxr io1lpee nctl( srtmurpoo0olen octasls rm(mo;(4aeeoxrctatfa eaneol(0trurxmpiu4om  lnetasfa2ta( pot1oexnifctlsla eau o;()aetoxo oodoaDr uvo;( sexrxrpiodlmte ivt tf 2umu p;u4oex  fetlsfa rmumo;() rtriocty1fm eanvo () ruoxo io1am emnes tfarrmur ;t4alenmfeilsfsDrl(vs u4tltrio3iotoa r ivo t)teurio iydopen fet s) Dumx ono4aeto o3taslmDua(mo u4artnxfctytlatelnesl(  2xrirpoo4ll emneia(f 2urur nt1aee  feiadla elnvp (0aleoxrcoytop  lieilt0texmxo oo1ap nlncsasf Dum(mpou1tptn i3tyd sDulu o;(4aleoif ia1omD anvo s)srtrio3oo1altnmfvil() rumu o;t0alx mociatfs umn s;t0texoxocta1op eli i (0t2um(r3oo4lmtnlfet sf Drm(m nu4alt  ocilslmDul(vpn(0 lxoifciydomD  i o t truoio ny1amt lfes tfa2trur ot0opeoio3iys mDulnvo t0tetrmrctodfmtrauvsls)texoxr ny4ll nmies s a2raxm no4olenifetatfs ea(vp;t) eenxr oy1opD  u ils0 rxmxrpnu1amenmnesas)srtrx  ot0oetnifctadls el( p;t0 reriocto1opteaiei ( t2tmim iy4oltnlietltf Dtr(mono1aex ii3iasfs2ulu on(0tetnio3iodom  luvsls setmio3nu1ll elnvtatf Dtrur no4alt moetls a el( p;t)altoir3oodoaD auvils)sexr(opiu1amt lncilt aDua(m oo4opeomo3ilt a rl(vp;u4tlxrir oy1fpteai o s) 2um(opiudamtnlnvtlsfa2rrumpoo1alen oeiysla rmumsnt) rtoir3oa1oaDr ies t)s2uoxm3oudlp emietasfsDurx pno4tlt  i3iatla ua(vo;(0trtrxo iy1fpDranvs t0s2xr(opnudoptn fvs s) 2ur(mooo1tpxnii3iat sDuauvp u)trxoxrcta1fmDeaieo;t0 etrim iu4amtnmiviat  rrrum ou0tpxniieiyd a2rlu p () lxrmo oa1lptranvs;t0srum(r3nu4ol   fci t sDtaumoot0aet iieias m eanvp;(4tlxoxociy1oatraueo (  2trim no1lpt lnctatf rrrur ot0apto ieiadls2rmumpnt0altrif oa1fp  aies;s trtmxmpoudol elivtas sDrrurpot1apeniiciyslmDrmu s t4texnxrciotfaDrluvi;s t2uo(o oo4lptelfctas) 2raxmpnt4olt  o3iadla2el( sn(0tleomfcoodom e i s;t0t2xmio iy1am  micilt)aDtr(  oo4tle mi3iyt a ua( pnt0trenif3iodfateli ols trtoxmpoo1op nlnvi (f 2tmxmoou4apen ictytls um(vpn(0 ltomrcootom r nes;t0s2xo(o3nu1oltnlfci s)a2ra(r no4oetnif3ilsls2elu p t4 rxrio3oodop raiei;t0sexmio no1om  mnei s)a2urxrpot4opt  o3ildlm2uau p;(0tltnir iy1oaD li s s) exrxr io4lpenlivi tfaruau  no0tpe  fciydla rmn p u)tlermf3ootfptrau il() 2xrxrpno1lpenmfvias)arrrumoou4aexnioctysfmDem(vp (4 eeoircoatfmDrln s () rxm(r3oudopeelncias aDurxrpno0tpeoif3iydlm2rmnms;t4 lermr iotfa r ies t) ruoim nu4ale livs (  2ta(rooo4ole mf3iasfa uau snt0 ltoxoctadoatr nvi s)t2tmxo3iudom n fet (f Dumx pot4altn feiyt aDeluvo t0teeoxo3ta1omtrlneol()t2to(rpnodllte fvtltfa2ur(mont4aptn f3tat a2uln ont)arxnxr oatopDr ueol()setm(r ou1op nlivils s2raxm ;o1olxo feiasfmDum(vo;t)tlxnmfcto1lat ln ol( srtrxopiydaltelieils) Dra(r ot0tpxoii3tatfa2rmnmo t) lxoif tytlptrauvs;t0s2xo(opno4lm e icsa()aDua(m ot0oetn feils s ranmp;(0artrxrcootopDelieil() eum(r3oodam  lfvtltfa2ua(moot0open octad sDrm( p (0 etomfcoa1oat livols0 rto(r oo1opee nvtls)s2umxrpou0oeenmieiydfm rmuvo u4aeerir ia1lm e nes (0srto(opiy4omeemfvilt)s2rmxrpno1aet  f3iatla2uluvonu0 lenxf3oytom e ivs s srxrir3nudom   ivsasf 2ra( p;u0ope ifeiytla2ran o;u)artomo oytfp  auvsl( trxoxm nu1am elncsa(  2ta(mpnu1oleo iciyt aDelnvpnt4altrif3to1oa  anvil( teur(rpny4lmtnliesls)srtmxmono0tlto o3iydfm rln p;(4 exnio3to1opDeluvi s trumxo3ou1amtelfetas  2ur(m nt4alenmoeild s ua( o;u)trtriocoa1laDrln i s0srxrim nu1alt  nes s) 2rr(r no4tltn octyslsDeln o t0artriocootop elieslt0srtmxr3iydll emfet t a2urum no0tlxnii3tadls2ea(ms;(4 leoxr iydlatelivolt  2xrxrpiudole lfvi sf 2um(mpou0opx  f3tas a rl( s;t) leomo3oodlat lu sls) rxrim oodolenmfvtas s2tmumonu0tet iietys sDul( o u4 exnir todoa   nvil() rur(rpiy4apenliciltf Dumumpou0olxo ociydfs2umnmp;t4 ltnxo oa1fp eaies;() rtmxopiy1ap  livi t a2rmx  ;u0tlen oeild mDum(monu4tltrmf totfptr ieo s)srto(o3oo4omtemivias)a2rmu onu1tle mf3iad m2ra( pnt0artrif iatfpte uvs t t2tmxmpny1ale mfetls)srrmu o;t4aet ifctasls ranmsn() rtoxrciatomD anvi;(  exoirpno1omtn ncs t)srtr(rpnt1apx  fetysfa2uan p u)altoiociodlp raueil( seur(mpno4ale  netasf 2trxmonu4apxo o3tatfsDeanvo t4trxrxo iadopDraivs s) 2tmxmpiy4ll emivt t srtax  nu0apxnio3iat a2rlu s ()alerifcoodoateaneo;( s2toirpoy1om emfviltfs2rrump;u4olenmociatfs rau s (4alxnir oodoa r i i t s2uoir iy1am nlnei t) Durxrpnt0aeeo i3iydfsDum(vo;()tleoif oadomDrli s s)setrxopnydlmenlfviat a2trxmpno1alx ifeiysfs rl(vp t0texrif iadlp  au o s  eurxo oo1ll n fct s)a2uru  no4altnmo3iatfsDea( on(4 ltrir oadlpD lnes t)teum(r ny4om e ict ()aDtrxmpoo0aeenmieiasla2um( o ()aetrif iy1oaDeaneo;t0srtoxr3nu1lp nmnesls  Drmumpoo1aptnmieiydfaDelnmo t) reomfciadlm r uvi;(0s2ur(m3oy4ol e fctls aDrm(rpnt1olx mfeiltfsDeln pnt) rxoxfcta1lmDe neil(0s2trxr3no1lmtnmictlt  rur(rpnu0olxnmieiadlaDemu on()trxnxf iadomt lnvslt)srtmxo iodllt  fvta( s2rr(rpnt1opxo ieiad m2rm(mo;()aexomr3iy1lpDeaies t0srxm(r3oo1am eliciasfsDrm(r ;u1opx  fciysfsDel( ont0aleomrcoydoa  lieslt s2xr(rpny4al emnesas  2rmu pnu4tlto f3iat sDua( s;u4 rxnmo iotfpteli ilt0 etrio3nodaptemnvsls  rtax  nu0apenmociysls rlumo t4trenxo tadom ran o () euo(o3oo4oltnlfesatf 2umxrpot4altn fctldfmDuan ont)tleoio3iodfatean s s s2xo(mpiudom e fct sfaDta(rp;t0ale mo3tldlm ul(ms ()aeenir iatfm r uvo ()trtrim3nydamt  nes (f Drm( p;o0oee micildfa2uanmo (0 eerxf3iytom r iesls srtmxrpou1lp emicil() rrrxm ;u0aexo fctyt m2emu o u0trxoxo tydlpD lieil() 2uoiopio4lpt mnvils s2tmu ooo0olt ioctltla eau o (4tetnxr3oatom  aivo (  2uoxo3io4aptnlictas) 2ur(rpou0tlxnmfctyt mDra( o;t0treriociatlp  ai o s)t2xrxrpou4amt mfcslt aDtax oou1oeen fetatfm um( p (4 rxnmociy1fatrliei;(  2uo(opnydlpt  fvs ( sDurx o;t4tee  fciytlmDulnmonu4tltrxf3oodoaD aiei s  exmxm iu4alt  nvilsfsDrmx  ou0tex  i3tyt a ulu s t)trenxr iy1fa   n s t) rxmiopiudomt  nci (fa2rmumoou4oetnifcildfm2el(vo u0artnxrcto1fa  anvsl( t2tmim oy1lmt  fet () rraumoou0olxoiietat m2uaumont0 eerxr oo1om elnvs s)t2tm(mpou4ll  lneilt)srtr(ro;u0aexnmociltla2emumo;()teeoircoy1om raivilt0sruo(mpoy1op emfctlt)a2trxrpnt1tpenioctld mDuauvo u0altomr3tytopDraivo t0t2toxm3iu1ale livs t) ruaumpot1tpenioctydfaDrm(vp;t) rxrmr ia1lm r n sl( setr(rpoudoleelfeia(faDtmur no1aex io3tad s emnvsnt)alxrxr3iotlaDrlivols0s2uo(o3nodom e nei (f 2trumpou4oeeo oeiysla ranmp ()altomf ty1lpDe ivs;t0texm(m3oudol elfcsl()aDtrumo;t4apeomo3iatfm2elnvpnu)trtomo3oodfaDran o;(0trxmxopnodlp nlneta(  Dum(rono1alx  i3tysfm2ra(ms u)trxrmoctydfaD auvo;s0t2xm(opnu4llen fcsasf Drm(  ;u1opxn ieiyd s2rl( o;(4alxrirciodlptelnvols0 rxmxr3oo1lm nlfvslt)s2trum ot0oetn icils sDuau sn(0trxrif3ia1fp rauvslt  2um(opoudllte nviatfsrua(m ou0oltoifctydls eaumont0aeenmo oadfmtranvols t2to(opiodom nlics sfsDtm( pou4oet mo3tatla ranvs;t0trxnxrciydoa rli i s0 2tmxo3iu1opeemfvi sfsDrm(rpoo0aptn octys a em( pnt) eermf3io1fmDe ueo (0s2xmirpnydam emfvil(  Dtrump;o1olxomoeild sDrm(vp;(4alenir3ia1lptr nei;t sexoxr oo4apt mfcslsf 2rrur ;u0tpt moeild mDuanmp ()arenmf iodlpDeaivs ( srtmxmpoo1ole  fetlsfartau pnt1apxo feiaslm emnmsnt) renirciydoaDeaivsl(0tetoim3io1lltemies tf rraxmo;o4texn ictasls2el(mp;t0 rermfctodfp e n s;s) rxrxm iudomtn fesl(fsDtrxr nu0tleomfeiat mDeanvp u0aetrxrctydlp eluei;t srxr(m oodal elfctlt)s2umx  oo0tex mictls s2rlu s t4teenxr3iotlmtrluei;t0 ruoxo iodal nlfcsl( sDumxr nu1aetoiociadfaDelnvsn()trtnxr3tadom e nes ()trto(opio4ol emfcsa(  rua(m ;o0tex mf3ilt m eanms u0tleniocoatfaD lu i ( teto(r no4lm emncilt a2taumo;u0tex miciytlsDrlumo u)arxoxocoydlmDeln s;s tetoio3io4ale mfcia()s2urxmo;o1oetoifcilslsDrm(vpnu)texoxf3iydoatrlieils  rto(mpoo4optnlnci (f 2trx  nu4aetn feiadfaDuau p (4 rxnxo oadfmDrlu slt)seuoio ny4lm elfeias  Dtrxm ;o4olt if3tyt sDrmnvo ()teerio3ootfa ranvils)sexr(m3io1ap  liesat  Dtax  ou0tpto i3iys aDemn pn() exnxrciytop rln s t  2urxr oodamenlicias)aDta(mo;o1aeeniietldfaDem( sn() eeomf tydlaDr n sl()s2tr(mpnu1omeemnvtas)sDtm(rpno4apxomoctatfm2ulnvsnt)tltrmfciatfmDr nvilt)srto(opiudomtemiviasfsrurx  no4apt iiciad a eanvpnt4trtrmocoadfpDr ivo t0t2xo(r3ny4al eliei tf Dtmumont1aee mfcilt a2eaumpn() lxrxoctotfa r u slt  ruo(mpio4alee fei t aDrax pou4opxnmictldfs eanmont4 exoifcta1fa rlu s () etmxr ou4lm n icslt) rra( p;o4tetoioctatfs2rluvsn(4tltnmr3iydoptelu sl(0 etmxmpny4alte ieilt)a2tax  nu4oetnmoetlsfs2ulnms;u4 exrio3oo1oat lieslt tetrxmpoudlptnmnvi s arrmur ou1opt ifcias a umumon(0tlxrio oadfpte uei;t trtm(r iy1amtemfvsas)artmx pou0tetn fcils mDul(vont4tlxomo tydop  aivo ()t2xm(rpiodoleelfciasf 2ra(moou1aexoifciydls2ra(mpnu0arerxr3iotlpDrlueo;(0seuoxopio4lm  mnes s)sDtaxmpot4oee  f3iyd mDul(vo t4 rxrir oadfmt aues;s)srxm(r iydapenmnvs t) Drrx  oo4tlx mieiadls rmumon()trerio3tatfmDrlneil(0s2xrirpio4lmtnmivsatf rra(m ;o1aex iociltfm rmn o u4tleniociydlm eluvi;s  exrxo3oodomtemicsl()arumur ;u4olen o3iysls rm(vs;t0 ltrmr iodlmD  u ols)srxm(m no1al emnes tfsDraxrp;u4texoif3ilt a2uan pnt4tlenxrcoadlp  lneol(  rtrxr3oo4apenlnci ()s2uau o;u0opx if3ildfaDuaumo;t4 lenmf3iadfaD  ivo;(0 etrxm nydom elivs s s2urx  oo1ape ifciydlm2eluvs;t4 lxnmo3tydom eau s;( t2uo(mpoo4lpe  fesls)a2trumo;u0alxniicias m rlnvont)alenmfciydop ran s t0trumxo3oy4om  mivta() rurumo;o1apxnmf3taslaDelu o;t0altnxo oatfm eai sls)teuo(r3oo4altnmnvs () 2rr( o;o1ole if3iytfs ra( s (0 rxrxf oodom elieo ( texmxm iodam n feils s2tm( pnt4tpx  ictasfm2emu p u4 ltnioctadlaD au o t) rtmiopoo4ol nlietasf 2umxrp;u1apto octld sDrauvo ()tetrifcty1latelnvo;()teur(o nu1optn fvsat) 2urxmoot0tetoifciad sDemu p;(4tlxnio3iatfp r uei;(0 exo(o3iy4ll n nvilt aruaurpot4oee ii3tyd m em(mont0aetnmfcio1lp eli s t0truoxm3iu1lptelnvt s  2umu oou1aptomf3iat aDuauvs;u) lermfcoy1oaDeau o t0 rtmir iydlle mietat  2um(monu0tpenmicias aDran pnt0alxoxf3iydlp e ivi;(  rxr(rpou4llee nciat sDtaurpoo0olenmi3iytfa em(mpn() exoir oytfm r ivo;t seto(rpnudll nlfetls)s2rr(  ;o1altoif3iaslm2ea(mo;t4alxrmf todlmtraivs;s0s2tmir3io4opt liesas sDrmumo;o4aee if3iaslaDuau s;u4texomf3iodopDeaneo;t0t2uoimpou4alee fvtl()aDumu  nt0oexnifeiytlaDul(mont0arxniocto1fptrlivsls0s2umxm3iydome mies t a2ur(r no1tpen feiadlsDua(mon(4 rerio3iodlm eaueo;( tetm(mpou4lltn ict s aruru oou4apx  fciltlmDuau o;t0aeerxr3ootfaD aivs;(  eto(o3iy1altemnetatfsDur(ro;t0tex  f3iltlaDem( o (0altrmo iodfm rai ils texmxm iu4ome  ivia(f Durur oo1tetn fcilsfm2rmn s u) rerxfciotfm eaueils) 2tm(r3nodlmee ivilt)aruauro;t4openif3tytla eln s;t)tlxnmfctytoa  lnesls) rxoxo3nu1lltemietat a2taxrpot4tex iieiat s el( p u0 rtrxfctytfaDr ivs t0 rtm(opnu1opeelnct (fa2tmxmp;u1tet ifcias m2elu p t4aexrxo to1oatrlu i;s)t2xrxm3iu4apte neil(fa2tmxro;u0oetnioetysla umn pn(0areoif oo1lpteluvs;t t2toimpnydape lnct s arumx o;o1apx mo3tldfa2umu p (4texoir iatlmtr n i;t setmiopnydlle mfvil( srurx ono4apxnioeias a2rln o u4alxnmfctytlptraivs t)seurxo3iu1lpenlnesasfa2tm(m oo0optnmiciytlm2ul( s (0texoxf ty1fpDr neil( texrimpoy4amtn fvia()sDtmu ont4aeenmociadlaDean s;u)tlenmociy1optelivs s seumxo io1oltemicsat) Dtm(rpno4olx mfeilsfm2uaump (0tltnmrcoytlptrlivsl( s2xoiopiu1openmnvtas a2trum ou0tetnifeiysfmDumumo ()artoxrcootop r u i t  2toxmpnodlmeemnvt s) Duax o;t1oeenii3iad m uanmpnt)tlxnmf io1fatr uvo s0 2umirpoy4lpt  ncsl( srrm( pot1tltn f3iydlsDua( p u)tltoxf tadom rlieils)t2toxmpoudlpt lncs t  rtrxr oo4aexnmocils s raumont)altnioctatfat  uvi;()srto(r oo4lmtnlfeilsfa2umum ot0teenmoctls a uanmp t4altoxr tydlptr i ols) etrxrpnydlpeemnvt ()aDumx  ;u4ape mo3iadlaDeanmo;t) eeoio3tatfmDe u s;t0srtm(m oudlleelneilt  Drmx ont0tet iictysls rm(vs;u0 etrxrciydlm eln il( t2trxo3iy4amenmfvslsfsrta(m nu1opto ieilsfm2ea(mo;t0arxrmf oydfm e nvs;s t2xmimpiu4lmtnmfvia()s2rr(mpoo4olto f3iytfmDumumo;t4 exrxf ia1oaDeaieils  rumim3iy1lle mnci t  Drmumpou4tltnmocilsfaDranmo (0arxoif oy1lm   uvi s)trxmxrpno1omenlfvsls arrm(  no1aeeniicildlaDulnms;()altoir3iotfmDe neo;()t2tm(m3iudlpt lnvilt arrr( pno0apeo o3iysfm2rl(vo t4aetoifctadom raueils) eur(m3ou1omeelivs () 2rr(ro;o1alxn fctldfa rmn sn(0 rtoxo3oodfp e ivilt0 2xo(o3nu1ame  fctatfa2taurpno0tee iiciltlm2rauvpn()alenxf3tytlaD ln o;s)srto(o iydlmtnlfctltfa2tmxrpoo4optnmfetatlm2el( s u)teeoiocoydop e uvo s t2xoim oydlpeelnvtas srtmumpot4apt  fctlsla2rmu s;t)aeeoxr3oadopteanvs;( trur(m nu4lm nmiei t) Dtmx pou1apeomoeiaslm uluvs u)trxnifciotoptean o;s0 etmxopoydamen fvsls a2urur nu0olxnifciys mDrmnvpnu)aexoirctotlptrai s s) rxo(opou4ape miesasfsrum(mo;u1alenmo3iyd aDrln ont4 exomfcia1fmt  uei;t) rxoiopou4opeemici (f Dum( oot4tptomfctaslsDeluvo;() ltnxo3tytom  au i t t2trimpou1ap n net t) rtmxm ;t4teeo fctltfm2raumo (0artriocootom rluvils0trtr(rpiydlptelfetls artr( o;u4ape  feias s ranvs u)trxnxf oa1oaDeli i s)s2xo(o3iu1lmtnmnei s aDra(  ;t4olxomieildlm rluvsnt4 rtrifcta1op elieilt) rurio ou4optelfetat)aDra(mo;u4olxoio3tyd s raumo;t)alxrmrcoadlatr nvo;() euoxopoydomeemietl(fartm(m nu4aleo f3iytfa rau pn(4tlxomo3tydfpDraivsls t2umimpoy4ap nmfvsasf rum(moot4oetomieiydlaDul(vp ()treomfctatoatelnei;s0t2xrir iu1op e ietl(  rra(mpno0optomoetys a2el( s;(0tleoxociatfa ranes;t0 exm(mpoo4oleemivta(farraxr nu4tee  f3iyt s2rm( pnt)tetomf ia1lmte uvi s)srxr(o no4al n net t)s2rmxro;t0opx mfeilsfaDean pn()aeermo oatfpt  uesl() 2xo(m nudol nlnci t srtm(m ot4aetniicias s2eanmont0 eeoxo oytfaDeaieilt0s2xoio oo4amt mfvi tfaDuaxmpot1olxomi3taslm2elumpnt)artrxr ootfa rlueo s teum(rpou1lmt lfctasf 2uaumo;u4apeniicils a um(vp () rxomf ta1op  livo t0teur(opiy1al nlivi s sDraxmono0aetn oeilsls2um( snu4 lxomr to1omt lueslt0seur(r oydomeemnet tfsrrm(m ;t1aet io3ild m2um( s (4 ltnmf oydomtr u sl(0t2xmiopnydamtnlfes t) Dumx  ;u0oeto oeiydlsDel(vsnu)alenxr todlpt  i s;s0srxrxr3iodomeemiei s)srurx  nu4aleomo3ildlmDrau snt)altoxo tadlaDrli il()t2xmxrpny1op  micia()sDrmurpnt0oex mieiydfs2ran pnu)teeomrciodfateluvo;()teum(r iy1opte ivs t)srrmurpnt1aeeoiiciysfa rauvp;t0tleoxrciydfm  anesls0trtoiopoy4lm n nei s)arrr(mpnt4alxnii3iytls emu s;u4 renir3oatom elivo t0trxrxmpny1altn fvsa(fs2uaxm ;u1aet  ieildfaDulnvp;(4 rtomf3ootfm   ivs s0srumxrpio4lpt lnctltf 2tmxrp;u0aptn feildla eaump (4trxrxrciotlm  lnvs;(0s2xrxm nydllt lnciat) rtrxrpno4oltomoctysfaDuauvo t4teeoxo3tydlmDr ivil(0 2uoiopny4alenmfcs sf rua(monu4olen i3ildlm rmn p;u4tleoxo3oo1fp   nesl(0t2tm(o iu4lm nlics t a2tauroou1tetn o3tysfa2el(mp;(4artomr iodlmt li s;() 2umxm3oudll  mfcslt sDtaxrpno1tee ifeiltfa2emuvp u0texnxo3oy1op e uvsl(0seumim3ny4oltn neias) 2uaump;t4alenmoeiyt aDrmums;u4teeoifctotom rlu s;s s2trim io1aptnmnvtls s2rrxmpou0oex ifeiasfm el(mo;() reoir3oadlpt ai i (0trumxmpoy1lmtnlivt tfsrua(root4olxo oeiysfm2ua(vp;t) eeoio3to1op r nvo t) 2xrxo iudlpt mnvil( sDrmu pnu1apt  ociyd aDel(vp;() lxnifcta1oat li i;t s2xm(o iodlmtnmnvtatfsrumump;u4tlx  octydlmDea(vs;() etoio oydlmDe ieo () eur(r iudlp  mnct t s2tau o;o1opxo ieiatlsDelumo u0 lxnmo3tatfmDrlu o s)srto(m3ou1lme lfeta(f 2rrxmp;u1tptomfeiys sDrlnvs u)aetoxo iydoa   ueil(  2xoirpoy1apt mfcs t)a2trx ont4open f3iatla2emnmo;t)artrmo3oy1faDraneo () 2urim3io4apee ivt s) rtr( oot1tlx mfciytls raumon()texnir ta1fpDrlu o;s0trum(m iu1ameemfcslsfs2trx pou4aeeomoeiltlsDumu sn(4arxnxf3oo1lm r iesls  eto(r3iy1ll  mfciat  rtru  ;t1aetomi3iadlm eauvp;u0artniocoytfatr uvilt s2ur(m3io4ap elfcsl() Duaur ;u1tleo i3tatfs2elnvpn(0 exrmocio1oat luei ( sexrim ny1apenmnet tfarraxm ou0alxn f3iytlmDemumpnu)teeoiocootoat livs;s tetmxmpiy1omteliei sf Dum(rono1tpe  ociytfa2rl( o;t4 exrioctotlpte ies;s0setoxo oy4lmtnmiciatfs2ur(ro;u1tpe iociydlmDrmu ont4arermfciodfa elivi t0tetr(r oydam nlnvs sf rrau  nu1tltnmocildlsDeau s;(0 etnmf totop ean o t)s2toxo3nu4aleemietltfsrtru ooo1opeomo3tasfa2elumpnt)tetnxf3oytla r nvolt) 2tr(opno4ap   ivsl(f 2rmxroou4oee iieiys m2elu s;u)teeoio3todlateai i ()srtr(opno4ll emneil(  2rmum ;o4tltniieiyt m2emumo;t) lerxrcoo1lptrlnvo () 2uoxr3io1aleemivsat)sDurumpoo4aetniietat a rlumont) exrxfctytopt lues;s0 exmxmpny4op nlnes tfs2rm(m ;u1opeo ieiadls2uluvsnt)artnxr3to1faDrluvs;(0srxmxm nydop e ivtlt)sDrmumpou1ape ifcild m umuvp;t)tetrifcoo1fatran o;t  2tmio io4lltnmiei s)artrx pnt4oex  ociadfa2rm(mp;(4 lxrmo3oa1fa rli o s)texmxopiy1alee ieia( a2ta(r ou1alxnifctatls ul(mpnu)tlenmo tytomtr uesl(0 2tm(m nu4aptn ieia( s2rmx p;t4oetnioeilsls rauvsnt4 lxnmfcoadfm   nvs;s0srxmxo3iu4alt mfctltfaDrrur ;o4tet mociyt aDranmsnt4tetrxf totlmteauvi;(0sexrxm no4amtn nes s)sDrmxm oo4oet  iciltfs2elnvont4 eenxociytlm  an o t0t2uoio ou1al  miei s sDur(m ;t1tet moeiys m ua(vs (0 eermr iy1lmteaueol( t2uo(opoodlmtnliesas)arrmx  ou1optoiociyd s ranmpnt) rtoirctadfmt  u i;s0 exrxm3nu4lpt lfeta( sDrmumono0teenmoetadla rmnmo;()trenmf ootlaD ai i t0srtmirpoydam  mieil()a2raumpnt1tlenmf3tydla rl( sn(0artoxrciytopD anvi s t2tmxmpiodllenlnctlsfarua(r no1aeeo i3ilslmDel(vp;t0arxnxo3iadopteaivi s0setoirpoodamen ncs tf 2tmxr ;t0texniietydls elumsn()arerirciytla r i s;t)t2toio3oudal e ieiltf 2ururont4optn fcildlmDuauvs;t) lermocto1laDe ueo t) 2ur(o oydll   fvsatfsDrr(rp;u1tpe  ieiyd sDuau s u0tltrmfctydomtr ivo s) 2tm(mpoo1lmtn nctls) Dtrx pou0aexnmfeiydls2rlnmonu0aleomr oadla elu olt0teuoiopou1om e fvtl(  2tmu  nu1oetoifetysfaDuluvs;u)arxoxfciodopt anesl(0 rxo(mpiy1lptemnciasfsrra(rpot0oltn fetltlsDeanvp;t) etnmrcta1opt aivo;s t2tr(r iu4lleelnes s) 2taxmpnu1tpen octlsfs2umumsnu0artomo to1op  livo;s)trurio no4lm n icilt aDuau ono1oetniieiadfaDumums;t) etnioctotfmDrlies;(0tetmimpnydlpe liet (fa2umxr ;u0texomi3iys aDrlumpnu) etrmr3ootlpDeanvslt0t2um(o nudomtnliesls arrrxrp;t0aeen f3tydla uln pn()tlxrmf oa1lmtelnei () exoxopou4olt mfct t) rrm(  ot1oltomfetadlaDrau s;u) etnio3ta1fmDraivo s t2xrxm no4am  mfetat a2uaxr ;u0apx mf3iat s um(vo ()texoxocty1oatr iesl(0seumim3oudomeemncs t a2rrurono0oex iiciadlmDrau s;() leomr3iodlmDrlu ols srtoxopio4ll  lfcils)arum(mono4opxomfciatlm2ul(mo;t)trxomo3oa1la eauvs s srumio3oodopt lietls)aDtax o;o1aexn f3tlsfm umn pnt4 lerir totoaDranesls s2um(rpiu4omtnlfvtat)a2ta(  oo1optnmociyt s2emums (0aeenxr3tadlmt  ivo;(0srumxr3nodlleemfvtls aDta(rpno1opeoiieildls2ul(vs;t0tetomf oodopDeanei;t0srtr(mpou4lp emfcilt) 2um(m no1teeomoeildlm uan pn(4aetnmr3totom elu o;t0tetoim3ny4lm n nesltf rurxronu1tetoif3tytfmDrmuvs;u)aetnif oadfateln o t) etriopou1am n fcias sDumumo;t1alx mfctyd aDemnmp;t4 lxrio iodlm rluei;s t2xmxo iydoptemnvtl( aDtaxm oo1apxnii3iydfa2um(vp;u) lxrifciytfmteanvi;s trtrirpny4alt mnvt ()a2ur( pou0texnmoctlsls ranvp;t)trenxf3iy1lmtrlivi s t2ur(m3io1lme  nciat sDtr( o;o1openmieiyd sDuaump;t)arxomf3iy1fa raivol()teuoxo oo1lp  mfctat)aDumu  oo0aex mo3iadla2rm( pnu)teerxocoo1la  anvo t0texmxo iydll n fcsl()a2urxr ;u1alx  ictlsfm rau snt)tltrxo3ootom eln o t  2tmim io4om e ictl(faDrmur nu1opeomoeiysfsDemn snt4teenmr iytlptrluvo t0s2urxr iy4lm   nesls  2ta(m ;u1oeeomf3ildfa em(mo ()artnxocootlmtrlneils)srumio oudlmtemivsa()sDrmur nu0tlenmi3iys sDrlnvon(0trenio3ootopt  ueil(0 eumxo3iu4lle mfeias s2trur ot1oetnmictyslm2rmnms;()aetoifctydlat  u o;( trxrim3no1lp nmies sfsDtmxrpou4tlen i3ils s2umu onu0tetrioctatfmDraneil(0 eumir iodopenlivi t  Dua( p;u1alto ictatls2rau s u0tetoifciadopt  iei s0trtmxr oy1oltn nei ()srtm(moot1ole  feild sDulu p;()tetnio3todoatrai il()srtoim oydam elnvtlsf Dtax ooo0alxoif3tatfsDelnvsn(0texrmf oo1lpDrai o;t) ruo(opoydam n ncsas) 2urxroou4tpxnio3iyd sDeanmp u0trxnio3tadlatrau ils)setrxo3oy1lpenlfci (f Dtrxm ;t0tlxnmfctldfm emu pnt)tltnmo3ia1oa eau o;s) eurxrpnydolen ncs ( arumxroot0open i3iytls2eaumsnt0tlxrmf iatlaD anvsls t2urxr3oo4apt lfctas  2trx poo4tptnmi3iatfmDelnvo;t0artnif3iy1fate u slt) rurir3no4al   fvils) 2rm(ronu0tlxn octlsfm2emn sn(0aexnxf oydfp  auvo;( sruo(o oydlmeemncta(fa2rm( o;u4aeeomoeiltfs ulu o;u4teerxo tatfa rai i;t)trxrxr3ny1lpe mfcsls) Dtrum ;t4oexomi3ias a rmnvpn()aexoif ty1la  lies;t)seto(mpoy1lm  mfcs (fs2uaxr ;o1texomieiysls uau s;t)aexrmfciy1om   ieo;s seumxo3iu4oltn nvsls)sDuaxm oo1ape moeilt s2ea( s;u) rxoif3todoaD  i i;(0 rtoim oo4olenlnciatfaDrm(  ;t1tex miciadla ulnvp () rxrxr3oy1fateanvs;t seto(r3oydlmee fcsl()a2taxr ;o0tpto o3iat s elnvs t) exrxo3ia1laDrai i;s trumxr3iy1omte feil()s2ra(monu0tlto fetyt sDem( sn(4 ltrif3oo1fptrlnvs t0tetr(m3ou4ap nlnctl() Dtr(mpnt1opt  ocild mDemn on(0aetnxr totlptrli s t setoxopno4alen nvi t)aDuaxrp;o1tltomieiydlmDean pnt0 exrxo3iadlm e u s;s0sexmxr iu4lpee icsas  Dtm( o;o4ape iietas s2uau s (4 rxoir3oytoa e nvo (0 rxo(r iy1ap elnvi s aDumumpnt1ope mictys sDuan s;t4 lxomf oa1fa ranesls) etmir3oodlm n nctasfsDuaxm oo1tlxoiietytla eaumsnu)tetnmrcoatop  aneslt0texmimpnydlpt mivtl(  2raurpou4alenmieiyd sDrmnmont0aeenmo iytlmD  ivil()trtr(o iodlpenmneiat)a2rau p;o0altnmo3iys mDuanmo;u0 etrxo3iotomDr iei;s srtoxm ou1omt mnvs ()artaxr ;t0apt moetltfmDrln o;(0artoxf3oadoa r uvo;t s2urxrpiy1ap  lfciltf Duax oou0tleoifetysfsDrmn o;t0 ltrir to1om rauvi;( srxmxrpio1lpenlnvtlsfs2umx p;o1aptnif3iad s2ea(vonu4 rxnir3ootfatr uvi s0s2umirpiy4altelnvsat aDra(  ou0oeenio3iyt sDulums (4texrxf tadlp eaieo;s0s2tm(m iudolte ies s  rtrx  no0ape  oeilt aDrmuvs t4trxoxocta1fp  ai sls0truo(rpnu4aptemieiatfarra(ront4oeenmf3iltlm uanvon(4artnmrcoa1fa eliei;s  rur(r ou4amenmnct sfa2umxrpot0tee mf3tltlaDea(mp u0arerio3iatoat anei (  rxmio3ny1omtnlnci t a2trx pnt4olt iiciatfa2eanvo;u0 eermf3to1omD  ivi (0teumio3oy4lle mfcs ()a2umxmpot0apt mfciyslaDrauvs;t)teermfctadomtranvo ( sexmir3iy1alt mfesa( a2urxrp;o4alxoiieiadfa eaums (0tetnir3tatlmD  n ol()srtoxo3iodapee ncta(fsrta(mp;o1olx  iciys sDul(ms u4altnxo tadomtrlieo s s2xrxr3iodolenlieilt)aDtrumo;t4oeeomfciasfsDemnmp ()tltnio3iy1op e i o (0srxmxr oy4lp nmivsltfarrrxmpnt0texoif3iad s2rm(vsn(0tlerirctydfmDeauvsl()s2tmxrpnu4lp  licslt)a2um( ont0apt mfetysfsDemu s;t4tetomf ootfmt anei s)s2urxm oy4lmt mfei sfarrm(rpnu0olxniiciytla elnvs;t4 rermf ty1lm   nesl( srumxo3ou1optelnvsls)srtax pnt4aex  f3tat sDrlump (4 etrmo io1omD anvilt0s2xoxr3ou4olenmivtls srtrx  no1olxnii3tld m2uanvonu4arxnif oa1omtrai i s tetrxr3ny4om n nesa()a2rmxmoou0tpto fciysfm umums;t) rtriociy1fat auvi;t  rxo(mpoy4ol n nct tfa2taxmonu1tet  octydls rmu s;t0 ltnxo iodomt lies t)tetmxrpoy4ll emfesl()arum(mo;o0tltomo3ildlmDumnmsnu4artoirctatomDrlnesls)trurxm oy4ll e iet tfarurur ;t1altoiictaslm ul(ms ()tlenif3ty1laDrlu i ()srxoxopoydaltelivsat)aDrm( ont0teeoifciadlmDumums;t) etnmo3iotfptrlnvi t0s2umxo3oudal nmnei s aDrm( ooo4aetoif3ilt sDul( o t0aeenmrciadfaD aies;()t2trim3nodlmenmfei t  2tr(mp;u0oex mietlslaDemnvo;u4 rtnirctodoat aivi t) 2tmxopnodom elfct s sDrrx  oo1texnioeiysfa2um(mpnu4 rxnmocoy1omtr i slt)srxm(r3oo1alte ncs t  Dumxmpot1oexoiieiasfs ranms u0 etrxo3oa1omt  u ils  eurir3oo1om n neia(  2ur(  no1opxomociad s2emuvp;u0 rxrmocoydlmDraneilt t2xr(m oudale mfes ( aDum(m ;o1aee ii3iasfa rln p;u0 rxrmo oadfm  aneolt s2xoxmpoodlpee nci t)aDuax ono4texoioeild sDea(mo;u4arenxf3tydomt an i;s) rtmxrpiudole mnci tfartau  oo4opeoiociad m elu s;t4 renxf oatfm rluvo ()texm(rpnydlptelfvias sDta(mo;u0tex ifcildfs2el( ont4 rxomf ta1la r uvils)trxmxo nu1lpen fetltf Dumur oo0olt iocilt m uau s;u)tlerir oy1fatrlueslt t2uo(m iydopte nvsl(  Dtm(  oo4opxo i3iyd s um( o ()tlxnir todopD lneolt srumxo nu4altn ivsltfsDtm(mp;o1teto oeilslm2elnms;u) lxrmo3ty1fm rlivols trtrio nudolt  nctat)aruauro;u0tpeoiociyd m eanms ()tlxrmrcio1fm eauei;t0trxo(r3no4lmtn nei tfsrrax oot0tpx  ietys m ra( pn() eenxfcto1omD  n s ()s2tmxrpoydapenlnes (  rtaxmont0aexnmociydla ranvo ()trxoio oo1lat aivil()t2urio ou1op elfvs (f 2raum ;t0oexo ieilsfaDrm(vp (0tlxnmr io1fp elneo;()teumxrpny4ale mfvia()s2ua(rpoo4tltomo3iytfs2ean p;()tetomocoadfm   i sl( srtmim no4altelnvt t) Dua( p;o1aetnmoeildfa2umuvs;t0aeenmr oy1fp elnvils)t2to(mpiy1op elnei (fs2ta(  ;o0tee if3tat s rauvp u) ltoxr totlaD  ieilt srtmim iodlmeemfctat  Duau ono0oee  f3tltfs2rmuvp t4 rxrxr3io1la e ieo t trumxrpou4aleelncslt)a2um(moot0tet moetls s2rluvon(4 lxrxociodlpte ieo;()tetrxr iodapenmfes () 2tr(mont0ale mf3ilsfs eln s;(0alxomfctodlaDranvi;() 2tm(o oudaptn nvil(f Dtm(rpno4aet ioeiatlmDemu s t4 lxnmf totlmteanvi s0 exo(rpoydllt lnetl()s2raumo;o1apt ifeilsla2ra(mp;t0altnxfcta1fpteln s (0texoxm3ny4ll  liesls)aDrrx  ou4oet mieiadlmDrlumo t0 lenif3iatla eli o s  2xrio iy4lmen nciat arta(rp;u1teto o3iysfmDumnms u0teeoir todlm r neo (  rtmio3nudopenlfesasf 2rrumonu0olt moctyd a rmnvo t) lxnmo iodopD  uvslt srtmxr ou4opee fei s)arurxmoot4apeoifcildls eanmpnt4teerxfcoa1fpD lneol(0trum(mpiydal n nesa(faDuax pnt0oexomocilslm2eau p (4tetrio3to1opD  n i;(0trtrxr oodlmtemfctat)a2taurpoo4aeto o3iyd aDrauvp u)arxrxr ty1lpDeluvi;s0 2xr(m3no4om n ivils a2ur( ono0tlt  octydfa rl(vp u) eerxr iotop r ivs (0 2um(rpnu4lpt mict sfs2raum ;u4tetomociysfmDemump;u0 rtoif ta1lp eluvs;t0 2xoir iodlmee icsls  Dtm( oot4tltn fetyt sDumums ()tlxoif3iydopDraueol() eumio iodome mnviasf 2rmxrpot1optn f3tls mDeauvo;u)areoircoa1fmDrluei;t t2urirpiy4ape mnctls) rrmurpnu0aeenmi3iadlsDrmuvp;t)trtrio oydoaD  uvs;s0s2toiopoydlle lfvi t)aDra(r oo0opto i3tlsfa ea(ms;t4aetnir3oo1optraueols)sexoxo3iy4ll nlfcs s  2umu p;u0aexomfeiasfs elu s t4tltoif iy1faDrlu ol()trxr(m3iy4llt lfvs s)arurur ;t4apxoii3iadlm2umums;t4trtnir3todoa rlueilt texoim oudomen fvil(fsrur(rpot0oexomi3iyd m2um(mpnt)tlxrmoctodop e n i;( srxmxmpou4ameelfvt t  rrmx poo1apx  ictatfmDuan snt)tetnmf3io1fmDrln o;t  rxrxr no1omenmfetasfarraur ;t4olenmo3iysfm em(monu)tlxrxf iytopDe n o t) 2xoxo no4al elfctat  Dumum no0olt mo3tat sDem(von()altoiocoydom rauvsl() rtm(opiy1opte fcsasfsDtaxro;o1tee mietlslsDrlump;u) lxrio3tytfp elnvslt)trtmxmpoy1lp nlncsas srtaxm ;o1alxn feiytfsDelnvpnt4 rtnxo3oatlmt an o s  etrxo3nudlpeemivia(f rtrx oot0aetomfeiytla2ranmp;()arermo tytfaD  i s (0sruo(o3io4lpe lfvilt)sDraum ou0tltnmfciyt m ra(vp;t4aexnxrcto1opD  n il()s2uoimpiu4ome mfcs ()sDuaumooo4tlen i3tldfa ranvpnu0 ltnxrciadlat  nvi;()trto(r3iy4op  mfeilsf 2umx pou4aptnifeiysfs2ua(vont0 exrifciodop rli sl(0teuo(mpoydomenlfetltfaDrr(mo;t4oeeniiciytlaDea( pn()artomocoadoa rlneo t) ruo(m3ou1omeelnctat arrrxront4aexo ociadfm umn ont4trermfctadlmt luvi;s0tetrir3iudoltelfesl(f 2uru  oo1oexo i3tltfa elumsnt0tleoxocoodomt anes;( sruoxm io1ol  mnetls)a2urxmpno4alxo i3ils m2um(msnt)tleomrcoytoaDrln s;s)seuo(mpoo1al e fvslt)arrmumpot4aeto ociasfs ra( pnu4 leoir3oytlaDrluvol() 2umxm3nu4am emieiat  Dtmu pnu1aptoioeiysfa rm(mp;t) eermrcty1oaDe neo;t0trumxm3nu1al n neils) Durx pot4optomf3iytls2ranmp;t4 rermo3tatlp eaiesls0 etrxo iy4lpe lict t)arrmxm ou4opto feild sDrlumo;u4tetrxocto1la r ivs;t) exr(o3ny4opt lnctatfsrtmxm ;o4tlxn f3ias aDulnvo;(0altomr3oo1la raneo;(0 2uo(o no1lm  mneilt a2tm(mpoo1apxomfeiys a rmumo;t0 eenmf3iodomt ai i;t srur(rpno4lltelfvsa()arrm(rpno0tpt  octlsla2rl(mp;u4alenif iydoatrliei s0trto(r3iydalenmfcta( a2tmxrpou1oex moeiys a umnmonu)trtrxo totom rlues t)srto(mpnudlmeemnvta(fs2tm(mp;o4opxn ieiatls2rl( o ()aeenxo oy1oa   i i;s)t2xo(mpnydllt  ietlt)arrr(rooo1tlxnmocildlaDulnvp;t0tetomo ty1op eai ilt0seum(r no1ap   net s  2taumo;o1aee ioeiysla2uluvpn(4 exnmr to1omDelieols0trur(o3nu1lltemfvsls) Durumo;t0oee io3tlsfs2ea(mp;t) lenio3oatfpte neo;s)truoio iy4al   ivsl(farum(rono1tptnmi3iytfm em( p;u)trermfcty1latr uvol()s2xoxm oy4lm n ivi t) Drm(r ;u4tlt  i3tls a2ul(mp t4altrir ia1oat  ieslt  2trio oydlle lietlt a2tru  no1oleo ieilsla2rlu ont4aexrir iytlpDrlueil() rtr(mpny4lptelnvil( aDtrx ooo1tlt iieiydls ean sn()tetomr oatlpD  n ols trxmxr ny4lpeelfetatfsDtmxrpou4ole  i3tlsfs umu s u4 etrmo3oy1fmteli o;t  exrio3iydaptnmivtltf 2rmu  nt4texomi3iysfs ulnmsnt4aeeoir oydlpteaues;t t2xrxmpiodll  micils  Drm(mooo0opt iiciatlm eln p u4alxoxf oatomt  ivolt) rumiopio1lm n nci tfsDumur ot4aex iocildfm2el( snu)alxrif3tydfmt livils sruo(o ny1lpeeliet ( arrrxm no1ape ii3iat mDra(vp;t)texomo3iydfpteaneo t)t2uo(r oudlpe  nei tfsrua(  nu0tpenmicias aDrm( s (0tltoif tatoaDeaues (  exm(o3io1opt mnviat  rrr( oou1alxnifeiydlm ranvont4teeoxr3iodfmtrlues ()t2tmxm oodlpen fciltf 2rmum no0tlenioetad aDrmumpn(0trxnio oy1op e ueol(0sexoxm oydlp  mnvi t s2tr( o;u0aeeo i3ilt m2elnvpnu4tltnxr iy1fmteai i ( trxoir nu1ol nlnvt tfartm( ont4alen fcils s rln snu4 etnxo3io1oaD livslt0setmirpnudlltnlfvs s)aDumu o;o0tlx  f3ilt s2uaump t0 rxrio io1om eluvo;(0 2umim iy4lm elncs s aDtrxmont4tlt ifcils a2el(vsn()tetrio oydlpt lnvi;(0 2xr(rpiu4omtemnvsltf rrm(m oo0tlt  iciasfm2eln p (4alxoxfcoytlp   i i ()trtr(mpiudlmt mfeiat)srrax p;t4tlto feiytfaDua(vs u)texrxo ia1oaD lueil(0 eurxm3ou4omtemnctlt a2ta(r ot4aptn iciasfs rl(vs;(0aeerif iytfa   ivol(  rxrxo3nudll  livsa(f Draxr no0teenmf3tltla2ra( p t0 rxomo3tadoat auvi (0texm(r3oudlp e nct sfaruaxmo;o4tlt io3iatfa umumsnt0alenir3iadlmDeaieils) exoxr3oo1optnmnciltf Dua(rpnu0apx mieiatlaDem(mp t0aetomr oatoa  luvs s)t2urxm3no4oltnlivils  2rrxm nu0tetn o3tyslsDuau s;(0tleomr iadopDrlivsl( s2toxm3nudlm e fvtas) Dra(ro;o4tpt  ociysla emn p (0trtoxf3tadlmD lu ols srtrir nu4lptnmicsltf rtm(  nu1aex mfeiysfa rlu p (4 lxrxrcoytlmteaieo;t sexoxopoo1omt mfcs t)srta(monu4aetoif3tatls ulnmp;(4arxomf totomteanei ()t2xmio3iy1omtelieslsfsrurxr nt1tlenioctadfa2umu pn()artrio3ia1lmteaiei s)tetm(m iy1omenlfvta( artru p;u4oltomoctlsla2eau snu4teerir3totfmDrauvi t0s2xm(o iy1am elnvsa(fs2raxrpoo4tleo iciyd s rl(mp;t)arxoir3oytomDraiei;s0s2urxopiydlmtelfetls) 2urxm ;u1olt moeiys a2ra( o;t) rtrxr iadomD  n olt0truo(o ny4ap emicias artr(m nt1alxomi3iad m2rmu snu)tlerio3iotomte neo;t) exrir3nu4olt mfct (  2rmu  nu4tpt mfciadls2eln p t) exrio3iodfptraiesls trxrxopoy1op elfctl() Dum(ro;u4opt mo3ild aDrl(vs;u) lenxf3todla   uvi ( setrio oodamtn iesls)s2taxrpnu0opeomoeiytls2ulums;t0altoiociy1faDeai slt)truo(r3iu1apeelnvslsf Drax  nt4tpen ietytla2uluvp;(4 exrio todopt lnvi;s  2trio3ou4aptn nvs t)srumxmpnu4tptnifetatla2emn pnt0 etnxr3iadoaD anei ( texrxo oy4aptnlnvtltfsDrm(root1opx  iciytlsDulu sn(4alxrxr iytom   u s;() rxoxr3oy4alenlfvsatf Dumxrp;u0opxo ieiys m2eaumpn(0altomfciydfp e u o;(0s2uoxmpnydope lfesls  ruru onu0aeeomfeiad s2emu o;()alxrifciotoaDeluesl(0 etoxm3nydlm nlicta(faDtmxrpot0oet iociyd a2emu o;(0 lerxo iytopt auvo;()truo(mpno4lle mncs t)arur(ront1apxomictyslaDulumo t)texnxo3iadfmDe uesls0 exrio nu1ape licsat)arraxront1tpxo ocilslsDrmums (0 lxoxfciatoptr ivs s)s2trxm3io4oleemnvs tfsDtrx p;o4aet mo3iytfaDranmont4 renmo3oatfpDe i o t)sexoir3nudopenlnviatfsDtru  nu1oltnmoetytfs2rmumo u4 eenxo3ia1lpD an i s) rtoxm3iy1lltelfvs t  2raxm nu4alt mf3iydfsDumnmsn(4 eerxr ta1fp eanes t)trto(o io1op nmnetls srtrum ;t4tle ifeiydfa2ul( o;t)areoxr3oo1lm   n s;t0 exmim3iodom  lfvta(fsDuaxmpou0teenifctydls el( s;(4 exoir tadoaD anvi s)truoxm nudop e fcilt)artmxr ot4alxomo3tlsfa2uln p u)aexrio tatomtean o;s0t2uoim oodol   ies (fsDrm( pnu4opeoioctltfm ul(mpn(0 ltrmf io1fpt anesl( sruoxm no4om nmfvsa(  rtaxronu1teeniietlsfa2elu pnu4trerif3tadlmt  ivi t setmxo nu4ole  fesasf rur(mo;t1aexoioctyt mDeaumo;u)aeenmocoa1lpte u s t  rtoxo nu1ole mnetl( a2rr(rooo0altoiieild a2ea( pnt0texnmrcoydfp  lu o;t0 2ur(mpiy1omt  nvsat)arururont0tpe  f3iydfa2ra( pn()tetrxrcta1optrluvs;t) 2uoio3iudlpt lfcslt  2um(ront4olto ieiat s2uauvsnt)aleoxfcoydoaD luvs;s0 etoxopny4aptnmfcslt)sruaumoot4alx iociyslmDuauvont0trxnir3ty1fa   uvil()tetrim nydolenmivta(fsDuax  oo0aeeo feias a2emumo u4aexnio3ta1lm eau i;() rumim iy1amenlnes t aDtr(rpno1teeniieiydlaDeln s (4 eermr3totlmtr ieslt0seuo(rpno1oltemfct t srumur ou1tetnmo3tlsfsDemumo ()tlxnmo oydfpDr nesl(0srtoir3oodlpee ivsls) 2urxmp;u1altnmoctas a2ulnmo u4aexrifcty1fpDe u i;s seuoxo3iy4alt  fesat)s2umum nt4tltniociytfs2ulu o;(4tetoxr tadlat lieo;s0 eurim3iy4lpenliciltf 2rau  ;o4olen o3tlsfs2umnvs;t)trtnir iotoaD  uvils)srxr(rpnu4omee ncsas srtmuront0apxoifcilsfm2ran s u0altoxf todfmt auvo;s)t2xmxo io4omt lnvs s)a2taumo;u4open o3ildlsDelnmpnt0aexrxo tytlpt lneil(0texo(mpiu1lm emivtltf rum(mpot1olx  o3tldla rm( p t) rtoif3io1fm ranvo t texm(r oudalt mnvt sfsrtrxm ou0alxo o3tlsla2ea(ms u4 exnmf oo1omtrauvs t0setm(m3nydalenlnvia(fs2rm(rpot1aptn iciad mDuln onu0trxriocoadlatr uvil() etoxmpiodlm n ies t)aDta( o;u4olxoif3iytfm2uaums;u4trtomf3ta1fp   uvo ( trtmxrpoudllenmiciat) rtmx onu4tle mociadfm2rmn o t0 etnxo3oydlm rlneo;( sexmxm iu4lltelncilt)artrxr ou1tleniicilt mDul( s;(0tltnxfcio1op   n i s0trxmxm iy4ol n ivilt a2rrumooo1tleniietls a2rmumsn()aexnio oadfp e neils)srurir oy4am nmivi t s2tmu pou1aex ioeiat mDrm(vo;t4tetnxr ootfat  uvo s0 ruoir3oy4lptemnviat  2raxmonu4altomfeildlmDea( snt4 eerxfciatom e nvo;t) 2xo(o oydalenmnctat) 2taum ;o4tleo oeiyt aDeau o (4aeerifcia1lm rluvs s)tetm(rpou1llt  nesas  Drmx o;o1optnifciyt mDea(von(0trtoxf tatlp  luvi s) 2tr(r3iy1lme mivs ( aDrr(rpnt0tltomi3tasla2ul(mo;()trxoxocoa1lmtrlivolt)trtmio3io1ll n ncils s2trx ooo0oltoio3ildfa rm( sn()trxrmrciytlat luvi;() 2um(rpiu4ol nmneslt)sDrm( poo0alx  i3iys a ulnvsnu) exrif3iotoateaueolt  rur(r3no4lm  lnctatfartrur ;o0tetoiictlt sDel( p u)trtoxo iotoa raies;s)srtoir iy1ol  mfci s  rtmurp;u0aex  oeiadfs rlnvs () rtnmfctytfmtrluvi s seumim nodome mncia(  rraumpnt1tlen iciyt aDelumsnt4teerircoadfmtr nvsls trto(m3oy4al e fcta( a2raurpnu4texnifetls m2eluvs u4 lxrxoctodfpD ai o (0 2xrim iy1ale lfvt (farua( p;t1optn ictaslsDuln on(0alenircia1fm r ivo;t  exo(m3nodll n ncil( srtmx  no4oexn f3tyd m uluvs;t0texoxr ia1lpte ivils s2tmxr3ou4lp nlivsl(f 2rax poo0tpeomo3iyt s ulnvo t0aeenmo iydfat aiei s0trxo(m oodopt  ivsas  rur( p;t4aeeomieiatls emu s;(0 rtrir3oytopDe nes;t0srtoxo iydlptn nvs s artrx o;o1altniieilt aDua(mo;(0tlxomr3oadopDeau i ( t2xo(m nydap nlfes tfsrtax  nu0oeeomfciadfs2rmuvs;u0altrmr oa1fp  luvo t) 2uo(rpiu1am  miet t s2ua( ono0aeeo fctat s2rauvp (0 rtoir3oa1lm r iesl()trxrimpnudopeemictlt)a2uaxmp;u0tpeomictas sDeanmpnu0alxnifctodlpt  uei;t)s2xmxm3nu4ame  nvslt s2rmxmoot0tpxnmociyt s uln o;u0arxnif iodlaDrli o ()texo(m3oy4openmnciasfsrua( ont0opxnmociysls2umuvonu0 lxriocoodlp eliei s  eumxr iu1al  miet (faDrmur oo1aexoif3tytlm rmumsnt0 ltoifciytom  livo;t s2xrxo3iydopeemfvils sDrrumpot0tltn oeiadla2um(vs t)tlenif iotlpDe u i (0teumxm oy4aleelnvtat s2rmxr ou1opxnmo3iltfs2ua(vs;u4 eermf3io1lpteaiei;t s2trim oy1optnlnci (farua(r nt4aetomfeildla2rmu onu4tlerio3oo1fpD lieils) 2um(o nodlmenmivt t  Draumpot0olen fcilt m rl( s u0texoxf3oydfa eauvols) eumim iu4ol  lfvs s)a2ururoou4olxomicias s ea( p u4tlermr oy1fm rlnes;() 2umiopno4al nmfcsl()aDraxmonu1tpx  oeiasls2uanmo;u0teeoxocoytoatraneo (0trtmir3iu1optnlncsls  rum( o;o0optnmi3iys m ul( pnt4tetomf3ta1lmtr ivo s  ruoim3ny1lmt mfvilt arumu o;t1alxnif3iat a2emnms;(0trxrxr3iytlp e uvol(0trurir3oydomen ics t)a2raxr no0optomoeildfaDelnvp;t)altnmf3oadoatr n o;(0trto(m ny1am n nvsa( arrmx  no1tlenif3ilt s ea(vs;()arxomr iodfatrlieilt s2tmxm oy4lm  lnvs tfs2taxr nt1oee ioetaslaDrlnvs (4trenxf3tydfp e neo;s sexrxr3oodomee feias)artmxmp;t0aeeo oeiatfm um(vsnu)tlxnxf3ia1fpDrli i;s texr(m ou4ol  mncia()s2ur(r ot0tetnmf3ilslm rau s;t4altrxf to1lp  au olt  exrim oo4lmt mfvsl( srum( o;u4aetn fetasfm2ea( snu4 lxnmo3oatomtr ivo t)teum(m nodll   fvi (fa2trxmp;o4texnmfeiat s2elnvo;t4teerircoo1laDrlivi ()srxoxrpiu4ap   neilsfaDtmxro;o0tlx  fctys s uaumont0 rtomf3tadfat aneol(0 2trxopiu4lp e ivtatfsDur(roou0tpenmi3tadls umums (0altomr3iatlpte i i s s2xm(o3oudlltemics t) 2tr(rpnt1tetn ieiasfs ea( pnu0trtnxrctadla e n o;() 2xoir3no4lleemfctlt) rrru  ;t1apxoio3tadlsDum(vs;()tltriocoydfptraivs (0teur(rpoydomtnmneiatfsrum(m
\ No newline at end of file
@@ -0,0 +1 @@
+nei;s t2ur(rpoo4opee fci ()a2ra(ro;t0oetniieils m el(monu4 reomr ia1optr n i t0 etmio3iu4alt  icil() 2rmumo;o1aetniiciltfaDuanmp;t) lxomocty1fm   ueo;( sruriopiy4apeemnvtlsfsDtruroou0olxnioeiasla2rmuvpnt) rtoir iydoa r nvo t  eum(m oy1omtelfcias) rum( p;o4optomf3iatlsDrau sn()altomr3oodoatrln i t)s2tmirpnydam e nvsltfaDum(mo;o0tltomoeiltfs2em( onu)tlxoxf ootfaD lnvs;t trtm(rpoy1oltelnvil() 2ur( ono1oeeomictatfmDrmumo t0 rtomfcoadfptranvi t0t2xrim nudll  livtls)srra(ront0opt ifctyt s2rm( pnu0aeeoiocoydlmt  neslt  2xoim oodameeliesls  Duaxro;u4oexomfeiasla el( pnt4arxnxr iodoaDelivo;(0 rumxrpnu4apeemivslsfsDur(mpnt1tptomieiat a2rm( p u4arxoxo iodom ranvs;s srxoio3iodom e fviat)arrrum ;t0optn i3tlsfm rmu pnu4treoxr iodoat aivols0t2xo(o ou1openmfvtl(farum(  nt0alxomfeilsla rmuvsnt4aeerir3tatlatrlivol()trtmimpiudlmenlneias srtm( p;t0ape moetltla eluvo;u0arxnmf ta1omt  ivil(0 2uoir oo4optemivi s sDtrxronu4aptomi3iasla emuvon(4aeeoir iytomt an i (0s2xoxo3io1aptn ncsatf 2taxmooo4olt  feiyt m uanvo;u) rxrio3to1oat lies;(0t2tr(opio4llee fet t)sDrmxr ou1olen iciyslm2ulums u4 rxoio3to1fpDeanei s trto(o nudlmtemictat) rua(m no1apt ifeiyd s rmnvsnu4 rtomfcta1oa  lneo;(0sruo(o iodlm elfcs t  rrru  ou4optoii3iadfa2uaums t4tetrmf3ootfaDraneolt0setoiopiu4ll e fct s) 2ra(moou4aeeo icilsfs2elu snu0tltnio3iotopDrau i t)s2trxm3oo1op nlivta(f 2tmur ;u4oeenmocildls emuvp (0aeenmf tydoat aneilt0setr(r oydam e fcil() Dum(rpot1aee ifeilsfmDrm( p t0 eerxfciodfaDeliei;t0sexrxm3io1ome  ncslt) 2rrxrpno1tle mfciadfaDul(vo;t4texoxf3oytfa  auvo;t)t2xrxm3ny1olt lfet ()srtr(rpoo1aexn f3tls mDel(vsnu0trtrxociy1lm e neol( teumirpiodomenmneia(fsrrmumont0tltoii3iatfsDuluvon(4 etnio oodlm  lu s ()trxr(o nudlptn fetl( srrmx  ot1ole  oeilsfsDrm( p (4 renir3tydfmt anvslt0s2umxopio4oltnlnviat sDtrx o;t1ape mietldlsDemnmp;u)alxomr3ootfa   uvo;( t2xr(rpoy1olee fvt ( srtax ono1aee ifciytfs2rm(mo t4alenif oo1lpt aieol() 2xmxr3nodol emiet (fs2rr(mpoo4opt  oeiyd a2rl(vont) lxnmr3tytop raivo s)trxr(o3iu4lmtnlfvi t) Dumur nt1opx iictldfaDeaums (4trtrxociatop elu o;t)tetrxopou1lm elieias s2tau  nt0tleoifciatfaDum( p t0texnmr oadop rlnvs (  exrxrpou4am n neia() Dtaxmoou4oeeoio3iad a uln p u) ltnxociodfa elu s;t s2uoirpnudapee nes t)artmxrp;t1olxn fetls aDeanms () rtrxf iotoateai il(0srumxrpiy4amee ncilt  rtrx  nt4tpto o3tlt m2rln snu4 eenxo oydoa r nes;( texrio iu1llte fctas)arua(mpou1aeenmfeiyd m uluvpn(0 etnmr todom raies t0texmxm3ny1ape mivias  Durx  nu1tpxniictld s2rl(vs u) exnif3tytoaDr neil()t2urxm iy1op  miesat artaum ;u4alenmfciytlm2ulnmo t)alxoxr3oodlmDr i s;s) 2uoxo3nodlm nlnvtat s2tau  ou4olenio3tldfa ulnvsn()alxnmr io1oa rlneslt srxoim3io1altelnctatfa2rr(rooo4oex  ocils sDuanms;(4 rxrir tytfpDr n o;s0seuoirpiydlleelfvtas arraxr ot0ape  ocias mDel(mo (4 ltnio3to1opt  nvolt trtr(m3oydolte nvsa()sDtr( pno0aptn oeils aDul(vp t) rtnmo tadfpt aivolt0srxoxo3io4opeelnvsl(farrr(  no1aetoioeiys sDean snt4tlermfctodlatr n ils0trtrxrpny1lm e nci s) 2tm(mono1oex iictlsla rlnmp;(0 leomo3tytlm rli i;(0srtoio3iy1lmtemncsl(  rtau pno4olxnifctldla2ua(mp u4alxnxocoadlpt au i;()sexmxmpiy1om  miesa(f rum(  no1tptnifctldlsDulumpnu0 reomr3oatfp  lnvsl()s2xoxo oo1al elnetasfa2ua(rpot4tlto f3iysfs2eln pnu)alxnmr3ta1oa rli o t0texmiopou4ame  ncias sDtru p;u1texomi3ild mDrau o;t0 lenxrcoytla elnvo s)setoirpoudoltemfcsl(fs2tmur ;o4aexomo3tytlm umn s (0 lxrir3oo1lmtrln i t s2xmirpiydlltemfetas sruaxrono1opt mfctat a umu p t) lxnmr3tytfaD aueo t tetrxr3nodomtemfcs t)s2rrxm oo1oexnif3tyd sDrlumpn(4aetnmo ta1lmt  uvi t0t2trir iodomtelnetl(f rtaxmono1tlxoif3iydfs el(vp u0altnmf3oa1fmDeauvs s texoxrpiydapeelfcslsf rrr( oot1aet moetysfm ulnms;t0 lxoif3tatfptr u i t)s2ur(o3iodopte fvilsf 2umxm ot4olxnmociysls2uan o () rerircio1opDelu s (0 2xmxm3iudlp e fetl(farrmuront4apeomi3tadlm2um(mp t)artrio3oy1omtr nes s)texoxo nu4omtn nvi s) Duax o;t4oltoifeias aDraumpn() ltoxr3oadoate n ilt)t2xrirpoy4am n ici tfs2ra(mpot4tex  f3ilt mDrlnmo u0aeenmf iodop e u s s) exmxm3oydame mneil()a2urxr ot4aetomi3ild s2ul(vs u4 eenxociadlatranvs t)s2umxmpnudom nlfvslsfsDumx ooo1tlenmo3tatlm rl(von(4tltomrcta1fmt au olt)sexrxmpiydopen neta(fsrua(rp;t4alenioeildla2eau o;u4tlxrmfctodlp rai s;(0t2toxrpou4ap n fvtls srtrxm ;o4tpt  iciltlm2eanvo;(4areoiociotomD  i s;(0trurirpiu4apt lfci s)srumump;t4tlxnifciys a2ul( p;u0 reoio oatlaDr uvs;t0seur(m3nu4lle lnetl()s2ta(r ou1tpeo feiltfm2emnvpnt)trxoio3iodfmtrli o ( texoio oodomtnliviat artm(ronu4tpeomiciysfs ulnvsnu4treniocto1lpt  ivs t s2xo(r3nu4lpenlnvils)sDum(mpno4aexoif3iysfaDuln s u)texomo oo1la ranvi t  2trir ou1openlict t  Dtmu pot0tlx mo3iydlmDranvonu)tlermr3oy1oaDeluvs;t0 etriopio4lpte iciltfa2urumo;u0tlen ictld mDrlnmp t4 exnmfcoadom rliei;t seumiopoy4oltemiet ()s2rrxmooo0tpx mfeiadfa rln s;u4texomrctadlmtelneolt0sexmirpny4optemivsat sDraxroot4alt mo3ildla el( sn(0tetrmo todlmDe neslt0trtoir ou4lmtnlfvtlsfaDururono4aexnioeiyt sDrmnvs ()arxnir ta1lpte uvsl( tetrio no1om emnviatfaDurx  nt1tle iictadlm2rmnmo u4aexnif3tytoatr u s;s0 rur(mpoy4olte fci tf 2tr( pnt0tltnmf3iadla2ua(vp;u0tleoxf iy1fpDe n o s0t2uoxm ny4lmeemivtas)srua(mpot0opxomo3iasla2umu s;u4 renmo3tatlm rlneslt0s2um(r3nudolenmfvt tf Dua(ront1opt  oeiasfaDra(vo u)tlxnir3ia1la eliei;t0texoim3ou1lpenmnes t) 2raxmp;t0olto oeilt s ua(vp (4artomo oatopDrauvsl( t2umxmpiodaltemfeils  2raxr ;t0texniictyt sDrl(mo;u0 lenxocty1fm elues;s0sexmirpoy4openmfetas)aDrm( poo4aeeomi3iadls2rauvpnt0teeomocta1fp  ai ils)srto(r3iu1om eliesas) rtaurooo4tpx  fctldls2ua( s;u4alenmf oatopt ai i;()trtrim iydamt  iesl( sDumu ont4aetoifcils sDel(mp;t4arenxf3ty1laDrlies s)tetmxmpiu1llenlieias)srtrxm ou1alt  feilt m2uaumo;()aexoxr3tydfaDelivi s)texrxr oydal  mfvtl( a2raxmpou4aeenmiciasfa um(ms;t4tlxoif oadlpte n s s t2umiopiy1op e iciltf Drau  ou1oeenmfeiasfs2ua(mp;t0alxnxr3tytfpD lu ol( truoxmpny4lpenmnvilt)a2rmumpnt0tptoiictltlm2ean snu0 ltoxf oodfp eluvi s0texmxr3ou4lpt lfvs s) 2ua( poo0tlenmietltfs2rmn o;u4trerircootlp  lnvi t0 2xmxrpou1al elfesat  rurur no1alenmi3ild m2ran pn(0aetrxoctytlpDraivo (0s2toxr iu4lpen nvs tfa2raurooo0olt mieiyd a2rluvsn(0tlenxrciodoaDeanvo;t) rtr(mpoydlltnmfvtas) Dtr(m ou4tpxnmf3iaslsDuau p;u)alxrmocoytlmt aivils0seumxo3oudllen nvia(fsrrm(mpno1tetn fetltfs2um(vpn()artnmo ia1lmDeluvo;t  2tr(m3nu4lp elnei s  Dum(mont1open f3tasfm rmn o;t) lenmr3ty1la r nei t0teum(o nu4lmtn iesa(f 2tr(m ;t1tlx  fetad s elnmp;(4trxoxo oodlate ues s0texm(r3oudalte fciatfs2ta( oou1opx mfciad m2ul( o (0aexnxo3tydlmDranvs;(0t2toim3iudomtelnvt sfsrtm(m ou0aleoio3ildlmDrluvs t4tltrmo iotfaD anei ( seum(o oydol emfct ( s2rr( o;o1olx moeiyd m eanms;(0tetrmr3io1opDelueo;(0s2uoiopiu1omenmietls  rrruro;o4tlto ociaslmDem(msnu4tleomo3ootlp e n o t)setoirpnodamee ivtasfs2um(  no1opxnmfeiaslm umnmp;u)tetnioctotlmt aies;s sexrim ny4lle  ncs ( s2tm( pou1ale ioctltfmDul( p;u0 leoxo ia1lmDrlnvils0trtrxm ou1lmtnlfcsls  Dtaxmpot4tlenmi3iytfs2umu o u0altnmrctotfp  lu ol( t2xrimpiy1apt mnci ( arrmum ot4oltn fctyt aDuln p;u)artnifcta1lpt  ies;(0sexmxmpny4ol nmfes ( srur(ro;u4tpeomiciltla uanms;t0artrmociodfpDrln ols s2xo(o3ny1lmt  nvil(  Duaxro;u4oexoioctasla uau snu4altnir iy1lm r ieo t  euo(rpiudapt lfctlsfaDuauro;o0opxo ictatla emu s;()aleoir3todlp   neil()srxrim3nudopenliesat) Drrxmpnt4apt mi3ildfsDrmuvpn(4 lenmf3tytoa elivi s)texo(m iy1am n ivsatfa2umxmpou4tpeoiociyt m2eanmo t0 eeoxf oytomt  n i s  euo(mpiodom   fesl() Dtau p;t0oexn ieiatlaDemu s t)artoxocty1oaD lneo;( trxo(m iy1lmtelies t  Dua( p;o4aetnmictldla2uanvp;u0alxomf iatoptrluvslt)t2triopou1altemfvt ()sDur(mpoo4apt ifciad m ul(ms (0 eerxocio1fmDeli sls0trxoim3no4om e fci (f Dtm(  ot0oet  f3iatlmDul( pn(4arxoio tydfmte ueo (0s2xmir3oy1ope mncta(fsDta( oot1apxnmoeils sDean o u4trenxr iotom rlieilt s2urirpnu1lmtn ivtl(faDuau p;t1tpxo ieiyslmDra(vo ()texrircoa1lpte u i;t)teto(rpiydomeelnctl(f rra(  ;u4tex moeiadlm2umnvs;()tltomf3iotlate nvs;(0t2xmxm oo1ape lfviat)aDtmxm nt1opt mfeiltlsDeluvp;u) etnmo3tatop e nvs s)sexr(o oo1altn ici tfsrrm( pot4olxn o3ildfaDeauvo t0aetrif3totlptrlneils0sexoxmpiudlm  mfcias  rur( pnu4aet mf3iltfmDranmon(4 rxoxo3ia1optrli il(  eto(r3iy4am e ivi (fs2uaxrpot0ope  f3iltfsDraumpn()teenxocoy1fp raieils)teuoim3ny4al  lieiasf 2tr(ro;o4optnifctadlaDeauvont)tlxoxrciy1faD lneil(0 etm(mpio1olenmivt t)sDtmumpnt1opx mi3iydla em( s;t0 etnir3iadfp rlieo t  2trxo3oodamenmfeils srta( o;t0teeomfciydfaDuauvonu4aexrmf3oo1omDr nvi;s0trtm(o3iudolenmnesa()s2rmxmo;u4olxn ictytlsDuln s t0 ltoxrctotop  lneilt)t2ur(m3oy4op   fes s aDuaxm oo4oexnii3iadfa2raumo t)arenxr3oo1op  an i s)s2urxo nu4olt  fvilt sDua( ono1olt  oetltfs2rmums t4trtnxo oydfmt lu i s)teuoxr nydlp emicias srrmxmpnt1ole iocild s ulums u) lxrmfcoo1fptrau s (0s2uo(mpou4ol nlnvsas  rtmu pnu4tleomietys m2uaump (4 rtnmr3tatomDelivs t0 2toxrpoodll  miesas)s2ta(ro;u1tptnmfetlsfsDem(vp t)arermr3oodfp eauvi s srtmxrpnodll nlnei sfaDtau  oo4oee  ociasfa2ean s;u)aetrmfciytfmD lnvs t texm(mpou4opeemnetlt)a2tmxrpnt0tle  i3tytla um(ms;u0alxnxo tytlm rlies;s0texr(m nydamenlieta(faruax ono0opto f3ils s ranmo;()artrmo iotfat lnvol(0teumir ou4olen nvs tfsrtaxmo;o4opx  feiydlaDem(vonu) reomr iy1fmD an o;t)t2tm(r iudop nlfcia()a2tmxmoot4oee  fcias m emnmsnu0aexnifcto1fm rliei;s srxr(m nodlpt lfci sfa2umxr ;t1aleo o3iaslm ua(vsnu4tlerir iy1oaDrln ols  eumxm iy1ll   ivilt)arraxm ;t1apeniociysfm2uauvs (4 rtnio iadfpDrlues;t teuo(rpno4lptn ieia( s2tmu o;u1oee moctaslaDrau p;t)altomf3oatlaDrauvils srtr(r iodll   fvs sf Dur(r ;o0tpen o3tlsfs uanvsnt4 lenio oadfpteai s ()setmxm3oy4ape mivsas arraxmpnu0tlxo ociaslm2rl(vpnt4aeermo3iytop  lueo;() 2xoirpno4ole miet s  rtax  ;t1apen f3ildlm2ulnvo;(0arxnmo3tydlmDr n o;s)sexmio3oodope lfet (fs2raumo;o0tpe micias aDum(von()aexomo tytfp  li sl(  exm(o3iydam emiei (fsrururoot1texnioeildls2rm(mp;(4 eerxr ta1lpD  ues s)seumir ny4lm  lnesls  2um(rpnt4tptoioctat s2rluvs t4 exrio tadlmDeauvo;(  rtr(o iy4omenmnct (fsDrr(mont1tpto oeilslmDrln pnu0aexnmf oodomt ai s;t) 2uoir iy1omenmncil(faDumxm ;o0apeomf3tydls rl( onu4artoxf tadomtrlieo t0 etm(rpno4lme lnes ()arrrurp;u1aetomfeiyt m2emuvp;u) renmr oo1laDr u s t0trtrim3nodlme lnci () rtaur oo4texnmieiatfsDrluvon(0 renmoctytop r n ols) ruo(m3oydlm nlics (  Drrxm nt0tex  ociyt s2ra( p;t)trxrmr3iy1fp ean i;( t2xr(opiu1lme lfetls)a2umum oo1aleo iciysfmDulumo u)altnir oydom eaivs;s) 2urio oudaltnlfctl()aDtaur ;o0tlx  i3iytlmDrlu s;()altoif oatomteaneo;s0 exriopiudlmt mnesat srtr( ont1olx miciasla2rlnmp t)aetrio iodlp rluvs t)t2urxm nodoptnlivsa(f Dtrx  oo0opt ioeiytls eau s (0aetnmociatlmtrln i s teum(m3io4ap   fes (f 2rrur no4oexo o3ilsfs ul( p u)trxoio3iy1fmtrlu i;s) exoxm iudaltelneiasfa2rr(r nu4ope ifctadla2rl(msnu0artnmf3oytomD ai s;t  2ur(rpiy4omtnlivslt)s2trur ;o1tptoioctld s ulnmp u4trenmf ia1opD luvs;t) rxoxopiodlmt lfcsasfarum(rp;u4tltomieiatfa ul(ms;(4trxnxf3todop e uvs t srxrxmpoo4lm emivs tfa2tax  ;t0apeo i3iad m2eaumpn(4texrmr oadfp  aivs (  rxm(o nodlpe  fciat)aDtr(rpoo1tlx iietlsfm2ulump;t4alxrmo iydomteaueil() rurimpnydlleemfvt () 2um(mo;t0alx mfciyd sDea(vs (0 etnifcoadfpDraies ()sexrxmpnu1omtn fvs s aDtaumpot1apxoifctlslm2ulnms;t4artnmr tadlmD  ieil(0trtrxm3oy1omenmicilt  rtaxmp;o4texnmocildls ran o (4 rtoxr3tadoatelues ()srum(o3nu4omenmfetasfsrtmxmo;u0aexo o3iltls2ulumpnu0 exrmo tydfa e n s ()trtrim iu4amtemnct ( sDrau oou0opxomieiyslaDel(msnt0alxnxf3oadfp r neo ( trtmio nodlmen nesa(  2ta(  ;o0tltoiietys m ean snt4 rerxocoodom eai ol()sexmim3ou1ap   ieias s2rru p;t1texnmoeiatla ranms (0 rtomociytlptrlu i ()setrxr iodlmtelnvtls)srurxrp;t0ape ifcilsls uanvon() exoir3oodlate nvi;t0trxriopnudapt  icilt  2rax p;o4tltomf3iatla um(vsnu) etoxf oadla  ln o s) 2tmio3no1ol emfei s srtmur ;o0oex iictydlm el( ont4trermf iatopD lnes s0s2xrxrpnudap  mics (f Durxro;o4oltniociasla2em(vp;t) exrxo tatlpD  ues s sexr(m3oydomt lfetl(  rtax oou4oleo f3tas a2emu snu0tetrif iodomteai i;()s2to(opno1alee ivtat) 2ta(moou0tpxomi3ildfm ea( pnt0 renmo oo1fp eai il( s2umir oydapte fei s  rur( oou1oexo ieildlaDrmums;()aeeoxr ia1opD  i i (  2ur(m3oudomt  ivias  rumx  ;u0tlt  ietaslsDumn o;u) ltnio iy1lptrluvolt0sexmim io4ll n ieil(  Dtmurp;o0ope  oeiaslm rm( o;u)trxoifcoodfaDr nesls)seur(r3ny4ope  ivs (farraum ou1altnmocilsfa rmu o;t0areoif oodfaDeln i t) ruo(rpiudll n fvslt)sDta(rpno4oexoii3tls a ea( s u)alxnxr3iatlp  ai ils) eto(mpno4lmeemfvtas srumur ;t0tlx  feiatlaDel(monu) reoioctytfaD  iei ()texrir3no4lp emfciasfarurx poo1tptoif3tas mDumnmp u0artomr3io1om   ieo t sexo(r no1om   fetatf rtm(  ;u0texnmo3iyt s umuvsn(4aexoif3iytoa   uvi;s  etrxo3iy1lpeelicils)arrrxro;o4altnmf3tad s2eauvo;t4 etrmfcoo1oa r ueol( teumirpiu4omtn ivtat)srraxroou4tpeo iciatlsDelu s;t) leoxr3tytlmteauvslt  euoimpno4ope  fvt s a2uaxmp;o4apen i3tydfa2ulu p u) rerxf3tytopD  i i ( srtmim3oodlp n ies tfs2trxmpnu4olt ifciydlm2uanvon()teenir ootoa  ai i t)texo(o no1olt  nvils  2rau o;o1oeenmociyt s rmu p;(0teenmr3iadfateln s t)setoxopoy1lm n ict t artruro;u0tltoifetytfs2ul( ont0 reniocoodfmt auvo;( setoio3oo4lltelici (  Dtaxmp;u4alt  feiyslaDuanmpnu4arxomfcoo1omteln s;t) 2tmxopiu1om elfct ( srrmumoot0opx mociydfa2rlumonu0 rxnmo iy1om eluei (0teuoxr3iu4lpenmivilt)s2ur(  nu4ole mf3iydla elu on(4arenmo tytfa rlu il(0srur(mpnu1ll n ict ()sDta(rpot0optnmf3iyt a2elu o;t0artrif oo1lmDrai o;t  2tmxrpio1om nmfesls srtaxrono4teeo iciltfaDeluvonu4 rtnxr tadop e n i t srumirpnudlle lncil(faDumumonu0aee mi3ils m ulu onu4aetoif todfm rlieo ( srto(mpno4lmenliei ( s2um(r ot4tpe ifcias m ea( onu)tlxrifcoo1lp  anvs;s0 2uoxopno1lm nmnvilt arurxr nt0aex mietasfs2eauvp u)alxoir totlm e neils)s2ur(mpou1lp n nvsas  2urumpou1alx ioeiyd m ranmsn()aetrxrcio1oaDrlieolt t2uo(rpiudam emnesatfaDtmu p;u1open oeilt aDeauvpnt) eeomfciadlaDr ivo s sruoxm nydolee fetls)sDtm(r ;u0olxn feiydfs ulump t4 etrxociotoa eln i;s0 2um(o3nydom e nct tf rtrumpot1openioeiytfs umuvont)tlxrif3oo1oat ai i;t) 2trxm oydaptelnvtasfa2ur( p;o1altn f3ildfaDrlums (0trermf oodomt ln sls0 2xm(o3oo4lpt micil( a2raxronu0tpe  ieiysfmDrmn onu0teerio oodlpt  ueo;s0trxo(m iy4oleelivt sfsrumur ou4tpxomoctlslsDrl( o;t)alxrxr oydlp raneo t)t2xrim oydome  fvsat  Drm(mpoo1tpt ioetaslmDemnmp () etnif3oodlmt li i t  2urxrpiu4lpenmnetlt  rurxr ou1aetoiictld aDumumo;t4altrio3ia1fptelueolt0sexm(r3nodlm n fct () 2rr(mpou4oee mfetyt a rln pnu4 lerirciytomD aieslt texrxm3io4oleemnvslt  2rrxmoou1ole  feiys s rau p t)aeerxo io1lpDeluvols)setmimpoudol nmfvilt)s2uax  ;t4altnio3tysfsDumump u4alenxrciydom  ai o;t trxoim oy1oleelfetasfa2ra(root0tpxnmietltfa eaumo u0tltrxo iotom   ieslt0s2xrio iu1lmtnlfviasfaruru p;u0tpxn f3ilsfs um( s u0 rxnircoatomteluvslt s2xrir oo4apeelnvilsfa2ua( oot1oex ii3tls s2eanvp ()artoio tatfpDranvi;()srum(o ou4ale  ics t aDtmu  ;u1aptnmfctadlm ul(vp (4tetnxfctatlpDe i i ( texrxr nu4ll   nes tf Duaxm ;t0oltoif3iytfaDumumo;u4 etrmf3oo1lmt  nvo;s s2ur(r3iy4apen fcs sfsDtm(m ;o1tleo iciatfa ranmp u4 ltoir ta1fpDr u i t t2toir ny4llte nvtasf 2tmxrpoo4aetoio3tlslmDumn s;t0trxniocoodla eaueolt0 2xr(o3nudllt lnvt (fs2trx pno4altnio3iydfsDraumont)aexnxf3oa1lmt  i s t0s2uoxm io1lp   fcias)s2umxr nt4altoiiciytlsDrl( sn(0alxoxr3iadoa   n i;s0 rxoim3iudll  mfcia()srumurp;t1tpeoiietltla um(mpn()tlxomf iodom  lnvo;t srxoir ou1ap eliesa(f Drr(rpno4tlxnmociytlm2um( s;u)trenxfcto1lm e n sl() rxm(m3oudamen iet (fs2umu p;u0olx  f3tas a2um( pnu4alxnxf3iydoaDeai i;t)s2uo(m oydal  mfvi s aDumxmooo4aptniicildla2rmu o ()tlenir todopDrlnvi;( t2trxr3oudolt micsltfsDrau poo1oetnmoctadfaDem(vo;t0 reoxo iydopt  ivi s)t2xrirpnu4omtnliei (fsrtau o;u1ale  feiadla rmumpnt4aeenxf io1fpteaieol(0trto(o3oydomt mnvs t sDrrx o;u0tptnii3iltls uauvp;(0tltrmociatopD aivo ()s2uo(rpnydllen neias a2umxr no4optnmi3iadfsDea(mo;(0 rtoxr todoaDrlueo s) rtrim3oy1oltemfvil()arrrum ;u0teeoio3ias m2ran pnt4trenmrctytlpD liesls)t2to(r iy1ope  ies tfartm(r oo1tleoifciydls emn on()tetnmr3oa1lm elnes (0 2xm(mpiy1lp e fvt (  rumump;o4apto ociatlm uluvonu0tlxoxr iy1fmteli ilt0s2umxm3ny4altemfetlsfsDur( pot0aleoioctysfa ranms;t4aexoxf3to1lmDran s (0 2umxr3iy4lptn nviasfa2ra( poo0ope  oetyslaDrm(mo;(0tltnio3tydfpt lnvs;()t2umxm3nydole  fci tfsrra( pot1alenmoeildfaDra(vo t) rtnxf iydfaDe u o;(0t2xo(rpoo4lm n fcia()aDum(rpno0oexomfciysfm ran s (4aeenxrcoa1lpDrlivi t0 rtrxopoudome licilt  Dtr(  nu1oetoioetyd sDua(vs (0teerif totoatr nvs s)srum(rpoo1open fcsltfs2ra( pou1opxnmi3tls aDrl(vs;(4artnmr iydfptelnes;(0srto(r ny4ol emfci t s2uaumono1ale mictys s em(mo;u4arxoxrciydom  luvs t srxoir3no4opte fet (f rtmxm ot4aetnmi3ildfaDem(vo t4altoir3iadla rlivo;s)sruoirpoodolt  nvt s a2uaxr no0opxo oetlsls2ra(vsn(4texrir ootlpDrlieo t0 euoir oy1amtn fet t s2rmxr no0oleomi3ild s2rl( s;(4alerxf3tadomDr nvsl(0t2um(opno4ll nmfcs t  Draxmpot1apeoiietatlm2rm(ms u)tetnxfciydoa   i o;t)sexmio nu4ale  nes tf ruau  nt0tlen iciyt a2ea(ms (4 renmf3tatopDrau i;( s2xoio nu1omt mfetls)arrr(  nt0tpen iciys mDrmumsnu4tlxrmrciotfm ranvil() 2urirpny1lpt mfet () rta( pno4oexoiieild a2ranms (0 exoio3iadfa   uesls0tetr(mpnu4ole lfvs ()arrmxmooo4tpeomo3tasfs rlnmp;t4 etoio tytomD lues;s0tetmxo nudlm  liei () Dtmumo;u0olenii3iatls eaumo (4tetoxf ootfpD  i slt0 2xoio iu4llee nvt (fa2uru oot0aleomieiysfa2rm(vp u4teeoxf iodlmte ivi ()t2umio ou1ll   fcs s)a2raur ot0aetn ietltlaDeanvpn() rtnxr iotomt  uvs;t0srumio3oy4al elieiltf 2tauront1tetomf3tat s rau ont)trenif3oodomDrluvs;() 2xoir3no1omen ieiatf 2ur(mpoo1open fciyd a2em( o t0tetomf iatomDe n o ()setm(rpny1ape lneiltfaDrm( pnu4alxo oeils m ulu on(0 rxoif iodoate ivils texr(o3iy4ol e netl()s2rmu oou1oex iocilslmDumu o t4trtnmf oydla   uei t trxm(m oy4lp  mnvs t sDuaumpnu4teen feiadls2umu on(4trxrioctadlmtrlu i;(  rxmxopoy1olt lncia()aDrmxro;u4tlx  feiltfaDuanms;()aexoifcootla rlieils)t2tmirpnu1am nlivt ( sDrr(mpoo4aet mfciltfmDelnmo;(4 rtnmf totfatr ueo;s0 rurim iy4lp emfciat  Duaxm ou0aleomf3iatls2rl( o u4 lerio3todlm  lieolt0t2tmir no4lpt lfctlt) 2urxmpot1oetomieils aDuln s;(0aexomo3tatfa   u il( texrxo3nodaptnlncias  2ra(r nu1tltn i3tlsls ul(vpnu)arerif3tydlp eauvs;t srtoxm3ou4am emnei s s2urx pot1tpxoif3ilt mDrlnmo;t4 rtnif oatop eau o;s0 2xm(opoy1ol nlnetas) 2rr( ooo4tleo o3ilt a el(mo t)trxoxr3ootlmD  ivi s)sexoxopiudam nmicsat)sDtaumoou4texniieilt m2elu s u0trtrmo3iy1lat  n s;s) rxoxmpiy4ap  mict (  rumu poo4oleomo3iyt m elnvs;t0aleoxocio1oaD luvs;s0t2urxr nudaptnmfetas) 2umu p;o0texomicildfaDuan p t4aexrio3ty1omtrliesl(0 rtmimpnudlptnmivsl(f rur(ro;u4ope mi3tasla2elump;(4aeenmo3oydfp rluvol() 2xrxo oo4lp emici s sDrr(m ;u1apeoii3iysfa umu snt0alxrxo oy1fm rlu i;s) 2toimpiodlltnmncs () rrrxmo;t4opxn ieiatls el(mpnu4artnxf3iotlate ivo s0t2urxo3ny4ol emiesl(  rtrum no1oexnio3iysla2ra(mo;u0arxrifcia1lat auvs;( s2xmxo oudal  mfes (  rraxrp;o1aexoiicilt m uaums ()trtriociytlmDr nvo t)srxmxrpoy4opt mfciat)srum(mpnu4tptn ocildfsDelnmp;()arenxrcoytfmt  ivi;(0 2xriopiodlpeemicil(f 2tr(ro;u4apx iieiltfs elnvp;(4 reomo iodfa  livo t  rto(o ny1apeelfct (farumumooo0aex mfeils s2rmnvon()altrir ia1oaDraieils) etoirpoy1ope lncsatfartaumoot1alx if3iasls2ulnvp t0 eenxr oydfptrlieo;t)s2xoxr oodolenlfctl()s2rax o;o1olen feiys mDeau s u) eermrctydoaDrluvo t0s2umim3oy1am  mfcs t  rraxronu4tlxo ictydfs rlu p u)treomociotfat  ivol(  rxo(mpny4ale  nct s  Dtrxm ou1teeomo3tad a2em(vo t4tlxoxrctadfa e i o t  2to(o io4olt lfeils sDrrxmp;u1oet mf3tadlmDul(ms u0artoir oatfp rliesls  exm(o nydlpeelncs ( s2rrxm nu4texnmiciad a2el( s t0 rxnio3iydoa elneils0trtrirpnodllte fviat) rurump;o1aetn o3tlsls em(msn(0tlxnmo oodla rln o s0teuoxr3iudamen ncs (fs2umx pou1aetn i3ildfa rm(mp u4arxrxf3to1om  li o t trtr(m ny4om nmfct sfs2tm( pnt4tlxo ieiytfmDuaumon(0artoif ta1omDeanvs s0 rurxo ou4ol e iei tf rumumoot0texniicils a rmuvo;u4altoxocoydlmt an s t) exo(m3oodlptemfvs s)s2tmu p;o0tetnifciytfaDrmu s t0 lxrio io1op raieol(  2ur(m nu4omtemfeil(fsrtax  nt1aexo f3tlt s2eluvont)arxrmrctotom eaueilt0sexoim3iy1ol emictas a2trxr ;u0aptn ieiyd a rm( s t)aetoxo ia1op  anvilt)trxmxm oy4open iciat)artaump;t4tet  octatlaDulnvpn()tetrmo oytfp   nesls trxo(m nydap  lfviatfarraxmono4aexnmi3tlslm2ranms (4 rerifcootlaD li sls) rtoxm no1aptnlnct () 2raxm ;o1alt ifciad a2uan o (0tltoxfcoy1fmt aues;t0s2urio ou4lpt mivsa(  2ta( p;u1apxo fctasfsDran pnu4trxnmr3iydopDrlnes s0t2xo(mpoo1oltnlicil(  Duau pno1oltniocilsfaDeaumo (4alerircoatomte i slt srur(o ou4olte nvia(f rrruro;o0tpxn ietad a2eanvon(0 ltrmf oy1opt aies;()s2to(r3iu4am elictas a2rrx onu4oetnifctlslm elnvo t4 rtoircoodfmtranvsl( teumio3iu1lm emictat)artr(r ;u1tpxniicils m ra( o () rxnif3oydfaDe n sl(0teto(m oudlmeemfct tfa2tax onu4oee  oeiytfs umuvp;u0 etoir3oatlptranvil(0 2ur(mpnydlpte icslsfs2tmur no1tetomo3tatla el(msn()artrio3tydfm  anvi s)t2uo(r oy4omt lfcsa(f rtmxrono4oexn f3tlslmDean p u)artoiociytoaDraies;s) etmxo3ny4aptelicsls) rur(m ot1aleoioeiasfmDeau o t4tleomr tydlmDraueol() 2xmxr ou1omt lfctl() 2uaur ;o0apx micilsls um( pnt)texrircta1lpDe n i;t0sexmir oo4am n fvsa(f ruax  ;t4apx mfeiltls2ul(mo;(0aexomrcoy1la e ieol( srxoxrpnu1ll nlietatf 2rr( p;u1alen oeilt a2um(vs u4 rxoxo totlaDr i o s) 2tmiopoydalenmfct t)arur(  ot0aeenmf3iad m rauvsn(0tetoif iydlaD  uvolt0setm(o ny4omee fvi tfarrm(r ;o0teen i3ilsfmDemu s (0tlxomf3tadoat aiesls0 2ur(opiu1ap n fvia()srtr( o;o1aeeo fctadlsDra(vonu4arxrxoctadoaDr i s t  rtoxmpou4al emfeslt)sDtrx p;u1tltoio3tyt m2emumonu) rxomocta1latrlnes t  2xoxr nu1altnlfvt s sDumxm nt0tet  fciasfm eau o;t4arenmr to1lmD  ivs;s t2urir3iudol e nvslt)a2tmum nu1tpe  o3tasfaDum( s ()tlenifcto1lmt  i ol() etmimpiu1ll emncsltfarrmxmpno4opx  ieiad mDulu s ()trtnxfcoatlpD  ivi s trur(m no1amtn nvt sfsrtmxm ou4tptnmiciasfm2rm(mp (4arxrxfctodlmte ivi;s  etoir oo4altemfeia(fa2rmu pno1aeeo i3iydls2eau p;u0aeeomf ty1om  anvsls s2trxmpnydol elfes tfaDrrxmpot1texoio3tatfm uln o;u0tetomo to1opD lueols0srum(mpny1alt mfcs (fa2rauroot1apt mo3ilt m2emums;(4alxrxocio1fat aiei;t)truo(m3ou1ame mnvs s sDta( pno4ape  fciadfm rauvs;u4arerxr3iytomt  uei (0texoxmpiy4al  mfetasf rtmur ou0tpxomo3tldfa emnvpnu0 lermf3iodfp  luvo t) 2umim iudopt lnetasfaDrmxrono1aetnif3tydlmDrlums t)aetnmrciodfm ranvi;t0trtrxmpiu4olte icil(fartmum ot4tpxnmoetad mDrm(monu)artnmf3tatomDrli il()srto(m3iu4apt mfetatfa2trxm ;t0oexoioeiltfs2ul( s u4texoir tadop e nvs;t sexo(o3ny1ll   fet tfsDrmu  ot1oetnmiciltlaDraumpn(4 etrxf3ta1fmt luvol( setmxm3ou1ome  ncs ()sDtmu  nt4olxnii3tasls2uluvpn(4teenio iatlmD aieilt t2uoxr oo1op nmfei t  2urx  ;u1oet mietytlmDumu p;u0tlxrio iydlm r n o;s0trumxopiodapeelnciatf Dtax onu0tpe ifciyd m eanvs;u0texnmo tydom rlivi;t0t2xo(opio1lptnmfcs s) Dra(r ;t0oltoio3iyslmDea(mo t4aetomr iadla r n slt0 exr(o oodoptn nvsat)artax o;u0tetoio3ilt a2uaumpnt)trerxr3to1om rlivs (0 2xoxm iodllenlnci (fa2tau  nt4alxoiiciadfa elnms t4 rxrxfcoydlm rlneils)sruo(m oo4llenlfct s sDtr(rp;t0tpeomfciltlm2um(vsnu0trtoif3tatomD livs t0 2tmxrpou1lmee nvias srra(  nu1olxnmietlt mDel(von() ltrxf3todfmtr n i () 2xo(mpoodapte neiat a2tru p;u4tlenmoetad sDem(mp;()tltoif iadlatr n s;(0 euoio3nydapeelfetas sDrmum nu1aptomi3tytfm ul(vp;t4arermfciotfa  lnvo s0srumio3ou1alt  ivils)srtm(rpoo1ale  oetydfa2ranvs;u4 lxoxf3todla elnvols  rxoxrpiy1lm e ivtl( aDtru oot0tetn oetad sDuauvp (0altrxr oadfptrln ilt0 2urim oo4omte fei (f 2tauro;o1tlt  feildfsDrluvo ()alenio oodomt luvi (0s2urxm3iodome  netas  Dtrxr oo1tetn o3tytlm rmuvo () leoxo tatoaD aiesl()t2umio3nu4ol   nct ()aDrrumooo1aleoioeiydlm2uanmo;t0texnifcoydfptelivs;t0 exoxmpny1al nmnciasfaDtaum no4olx  oeiytla2rln pn(0teermf3iadfa elnei s)s2tm(r oy4amenmfetas a2uaxm ;u0aexn fciytfs2raumsnt0tlenir ty1om rlnvsls) rtrim3iodamenlieslt s2umx poo1aeen feiasla ranvs;u4alenxociytopD li olt0s2tm(o3oodlm   ivtl() 2uru ono0tlx iietld a2uauvs;u0 lenmf3iotfptraivi;s0teuoim3nu1ome  nvtat)a2uau pnu0texnioetyt m2ulumpnt) etrir iydoa rau i;s)setm(r oudlm  mfcilt arta( pno4apxo f3tytlm umuvs u0teeoxf tydop  li il(0sruo(o iydope mietl()srtmxmpnu0tlen fciad m2rauvs t)arermr3iotoa  ln s t0 euo(m3iydoptemfetat  rua( p;t4aee iictyd m eanmo;() ltomo3iodlm rai o;(0tetmiopoodolenliet (f rumumont0olenif3tat s2ran o u4 rtomr oytomD  uvi s) exmir3iudllenliei s) rtrum ou1ape mi3iys s2rauvo u0texnircoatlp r u i t)t2tmimpnodaptnmncs s)s2ta(monu4aee miciaslmDra( pnu4 exrxr ta1fp rlnvilt s2xo(m oudalte ici sfs2trxroou4optomf3tldlmDelnms t4 eerxociytlpDrau s () 2uo(o3iudale livi () Dum(rpnu1tlx  ieildfs elnmp;t) eerif iytoaDrai s ( seurxo3oydoptnlfcsa()aDtmxmpou1tex iicilsfmDumnvont4 rxnmfcoy1lmt ln i s)teto(r3nydlpeemiesa( aDtaxm ot4apto oetat m2um( s;t0texoiocoa1fa   i i;s truoim iy4lp elnvsls  2urxmpot0aleo octytlsDemu on(0tlermrcoatfptranvols0sruo(o3iu1ope  ivsls  rrmx  ot1aeeoiictldlsDea(vp ()texoxr3oo1op  anvo (0s2toio3oudlltelnesat  2rr(r ot0oeenmiciysfmDuluvs;t) ltnifciodlpt livs t  exm(o3ou4lp  lnetatf 2raxr nt0oeto icild s uanvo;(4 ltnircia1lat aivs;s0s2xoxmpiu4al  lnvils)a2rr(r ;u1aex mo3tyd aDem( s t)trtrir3iotlat ln i;( trtm(o oo1lpen ivs t)s2tauro;o4apenmfctlsls2emuvp t)artoxr3tadlp eliei s)teuriopoodlleemfetlt) 2tau  oo4olxoiociat mDelums t4texnxo3iotfp eai ol(0seum(m3io4ol nmnet ( a2ta(ronu4aptnifeiat m uan p;t0areoif iytlat  uvol(0sexoxm3oy1olenlncil()aDrrxrpno4oeenmoctls a2uln o;u0 lxrifctadfaDrluvo t) exm(r io4opt mneslt  Drmu  ;t4alenmf3ilt sDea( s ()tlenxr3tatlateliei s s2um(o3iy1omeemict t  rumxm nt1oexn i3ilsfa2rl( pnu4trxomr3ty1omD aivil()srxmxrpou1ll nmicia( a2ta(ro;u4tleo o3iydls2eanvsnt)tlenmo iotlaD  iei (0 2xrxo3iodlm   fes s) 2ua(rpnt1aptoif3ilsfm rmn snu) rtoif3oodopDraueo s trxoxo3iodapee ieiat artr(mpot4tlxnmf3iysfs eauvo () rxomfcootfmD luvs;t0 etoxr3iy4llenmietat)artaxrooo1oee ifetlslmDra(mp;u0trxnmrciodom  aieilt0trxr(r3nydopenlncilsfa2rau  ;o1aetnmfeiyt a rm( s u) rtrxf3oydfpD livsls0 2xoir3iu1am n nvs ()arra(m nt4apt mf3tydfmDrlu sn(0areomocoodfaDranei s)t2tm(m nu1omtnmiviatfs2rm(moou1ope mi3iasfa2ea(vs t4aeenxo tytfaDelneolt0 eurio3iu1op  lnctatfs2ua( o;o0olt ii3ilsls ul( p t)tltoxr3oodlp eluvi (0t2umim ny4olee ivilt s2urxm ;u0olto ietlsfa ean p (0 lerxocoytfptrln s;t)srtoxr ny4om nliet (fs2tr(ront1aexomo3iys a2elu o;(4alenmocoatfa  liei t trtmxo3oudalteliesls artm(mp;u4apto octytfs rmnvpnu)aexoxr3to1opteaueo t0trxr(m3nodaptnlfctas)aDurxr oo4optnmiciatlm rau snu4 rerif ta1faDeau s;t)t2xoir oodolen ivtas)aDtru pot0tptoifeils sDum(mo (0tleoir todfaD  ies ( setm(o oydamt mivtas a2rmxm nu0tpen feiltfa2em(ms;u0trxnio iydlm  auvi;s0srxmxm iodaleelnesl(fsrur(rooo0tlt mi3iasfm rm( pnu0 eermfciy1omDeln olt trxmim ou1opee fvias)s2tm(ro;u4tpenmf3ilsfs2uau pnu4aeermocoa1la e i i s  euoxr no1aptemfcsltfarururp;t0aptoio3iyt m2rau pnt4 rxomf3io1fatraivs;s  exmio3iydape lfvt tfs2ur(m nt4aeto icilt aDrmn s;(4trxrircoodfa  ln s (0texoxmpnudlpt lncs s  rum(rooo4apenif3tasfmDrl(vo;u4tleoxf iotlm elu i s srxm(opny1ap e ivias)artmxm ;o1aptoioeildls ulumo t4artnxoctytfmt lu s;()t2um(o3iu4oltn nei () rtm(r nt4olxo feiytfaDumuvp;(4aeermf ia1optrai i;(0teurxr3oo1lmtnmnvsl(fs2uau ono0aleoioeiadfsDem(vpnu4texomr oytfp  anvil()s2uoxr nu1oleelietat)aDuaumoot0olenioeiltls2rmuvp u)alxrxocio1lmteai i;(0t2tmxrpio1ame  icil(farrrumo;t0olxnmfetld sDua(mp;u0 rtrioctadoa raneslt)trtoxo3iodopt lfcsls sruru  no4oexnifeiysls rl( ont4 lxnmf oo1fm eau ils texo(m no1op nlfes t)srtr(mont1aexnmfctysfaDumn p;t4artnmf3io1fmDeluvil() etm(rpoydomen fetas  2trur ;u4alxoif3ildlm2ul(vp t4 ltoxrciytfaD aueolt0srurxopoy4lme  fvt (fa2ur(roou1opeomictaslm rauvs (0treomf iotopt liei s0trxoxmpiydoltnmivs t  rra(  no1tlx ii3iydfs el(vont)aetoxo iatlmtr n s s)t2toio oudlpenmnvsa(fsrtrxmo;u1opt  i3iatlsDea(vo u4 renmr3totomt  nes (0 exo(m3io1apt mfvils)aDur( onu1oetomfeils aDra(vo;u4artoir3to1oaDelieilt) etr(r iudom n nctas a2umumpnt0oexn ictyslmDraumon(0tlerxf todlpDrlueo s sexmxr nodape  fvs ( aDuau  oo1aleniociad m eaumpnt4 rxoxrciydfpD an o;()seuoim ny4amen ncilt srtrxm oo4optn ociatla2rlumo;() exrio oodlaDr nvi;s)texoxr3ou4lmee ivt ()sDumu  nt1aptnmietatfsDel(vpnt4 rtrifcoytop raues (  rum(mpno1altemnvta(fsrrau poo0optnmi3tytlmDulnvsnu4texrmr oa1la rli s;s  ruoio3oo1lpt  ietat sDta(mono0openiietyslm2rmuvpnt0tltomoctytfmDr ivi s) exoir3oydlmtnmfcs sfsrrmxmono0tetoio3ilsfs2eln p t0trxniocto1lmtr n o s)seum(r3io4apenlfvtl() Dtau onu4teeoif3tysfaDua(vo;t4tltnxo ta1lmD  ueolt)t2xr(mpiu4amen feia()srrrur oo1tet  feiad s rmn p (4aexnmo3iy1omt  i o (0 rurim3ou1ll n iet t srumx p;t1tpxo fcilsla el(vonu4 rtnifcty1fmtrliesl( trurxr ny4ll e ieilt)srtmxr nt0alxoioctatlm2rm( snu0tltoioctodfa rlnes;() rtoio3io4lpeemnvsa(fs2ra(mooo4opto ietatfa ul( s u0 exnirciatfaD  nes s) etoxopiodoptemneias)a2urx ono0tlx  fciadfsDrl( pn(0aeenmo3oy1lmD  ivilt0seumio3iy1ll e ivtl( artrxr ;t4ape mfciad s2rm(vo;t) eeomocoo1oaDraneo ()s2uo(m3nu1ol n iet s s2ua(r nu1optn oetysfa ulumo (4 ltnxo ty1omDrlnvo;t0s2xrir nu4lleelneia()s2rmu  nu1opxnmietyd m rm(ms;(4altrir3oa1opDrauvo;s0trxmxopio1lp  lfcsl()sDtm( o;t4aexoioctytfs2elu o u4arermoctatom e u ilt) exoxo iodolenlfctlsf 2ur(r nu0alx iieildlsDua(mont)trxoxo iodlateli ol( t2xoiopno4lle  fci sfsrta(mont1openii3iltlm rmnvsnu)altniociy1fp rlu s (0trtr(opoo1ap n nei (fsDtaump;o0tetoiieilt a rlu onu)aetnif ty1omte uvo t s2umiopoydllenmiesl( arrr(m no1oet mieiatlmDeaump;() reoxo3tytoateli s (  2xmxm3oo4opt mictls) Dta( o;o0oexo icilt a2eluvs u4arxrmf3to1oaD lnvo;s0trxmxo oo4ap emnci t a2rruront1aeeoio3tadfa umumont4trenxf3ta1op  lu o;t0trxrim3nydlpe livs s)arrm( p;o4aeen feiyd a rlnvsnu4altrxfcoatlptrli s;()s2urxr3iudaptelfesat  2tm( pot0ole  i3iydlm rm(msnt0tlxoxf ta1lp eauvi t trur(m3iodlpee ictl() 2tr(m no4aexnio3tadla2ranmsnt0 rxoxr3tydfpt  nei s0texrxmpnydalte nci ()a2umu ont4alx  oeiadfaDemums u) eeomr tydom   ieils) rxrirpiy1oleelfesa(f rtmu p;u4aee ifcias a2ra(mp;u)alxnio iytfpt anvils  rxo(m oydol emfeslsfs2rax  ;u4tlxomoetas mDel(ms (4tleoxo3ia1fateanvo;s0s2umim ny4lpeemfvta() 2ua( pou1alx moeildfaDemnmo;t4trtomo tatlm r ivs (0 rtm(m3nydamtn fvi tfarraumono1opxnioeias s2rmnmo;t0teenxr3ia1fm   nvi;( s2xr(o3io1oltnlnetl( arumx o;o0opt iictlsfa rmnmo;t4 renmociytlmD  u ol()texm(mpoudoltn ivsa(f 2ta(mpnu0apxo i3tatfmDuanvsnt0aeenxf3oydfmD  n o t)trurxo io4am  mnciatfa2ur(rpnu1tlxoioctyd a2uau on() lerxr3oo1lpteau ils0srtmxr3iu4ol nmnvi () rrmumpno1openmieilsfa2el( o;t) eenmrcto1lpDe ieo (0s2umxr3ou4lptelfvsltf rtrurp;o4apt iietydfa2umu on(0 etoxociytfaDrlnes s)trxmxrpnodlptn ietlsfs2rm(m ;u4opto i3tlsfm emu o u4 rtrmociodfp  luvi;t t2uoxopou1lmte nesa()srtrumooo0tpe  fetltfmDum( o;(0 lxnif oydfpD auvo () euo(rpiodlm   ivs t) 2um(ro;u1aeen ictyt sDuauvs;()teeomr3iytlmDrauvi;t t2umxo3nudlpe  ieiltf Dra(  ;u1altnifciatfmDrlnmsnu) rxnio io1fmt  uvo;( seto(opnu4lp e ncilsfsrrrum ;o4optoifetytfm2emnmon(4 ltnmr3oatoaD lueols  rtoxr oodapeelnvtatfa2tmu o;o1oee mf3iytfaDua( s;u0artomo iytoaD lu o;t  rtmxo3ou4lmtnmici s) Dtax o;o4aee moetldls rlumo;u4trxnmr oy1lmDe i s;s)seurir3iodlpenlncta()s2trumpou4tlxn f3iltlmDeanmsnt) eerio3iadfm r n o t) exoir3ny1al  lnvi s  rrmur ;u4oeen i3iys a ulnmon(4 lenmr tydfpDelivslt)srumxr3io4ape lfci ()srtmx o;u4tlto fciadfm2rlu p;u4arxnmo3totlmtelueo;(0sruoim no4llenlies s  Drm(mooo0optnii3iytfmDrmumo t0tetoxocio1fm  auesls)t2uoiopoydaptelici tfsDuau p;o0ole miciat m2rmnmp t)artoxr3oy1fatelivi;( trtm(mpny1lp   fet ()s2trumoou0olx if3tldfmDemnvo;u4arxrxrcia1lat an olt0seurxm3ny1olt lfvia(  Dta(ronu4opxnifciysfs2rln s t)aexoiocta1la   iei;t0s2xrxopnodaptelnvil(fsDrm(ro;o4tee  feiat aDranms u4aetnxo oadfmDelneols)texoim3iy1aleemnesat)a2ta(mont4oexomfctldls2uln p (4 eeomfcoy1lmDrlivols trtoxo3oudalenmnvtas s2rr(mpou1tlxnifcild m rln onu) rtnifctotlpt  ieil(0seumir ny4lpt lfctas sDrmxro;u4open ictydfaDeaump u)arxrxf3oatlp raies;( teurxr oo1ome liet ()srra(mp;u1ape io3tyt sDua(vs;u0aetrmociodfa rlnvo () 2uoimpou4llenlivsas  Draurpot0oee moeiyslm elumonu4tlermf oo1oat an o;() ruo(o3oo4op emics tfs2urxm ;o4tpeo fciadfa uau p;(4 eermo3totfmt luvols)sruoxopoudopenlieil( aDua(  ot0ope  f3tat aDul( onu) etnio tadoa elu s;( s2xrxopou1lmeelnci t  Dtrumpot4tpen ieilt a2eau onu0 lxnmr3tatfa e nvs;(  ruoim iu4op  mictl( aDtmu o;o4aptomfcildlm emu snt) rxrif oy1la ranvs;t)t2xrxr3iudamt mfcia(farta(r ;t0opeoii3tyd mDrlnvo;u4 renxr3oa1omD aivi;s t2tmxo3oudlp n icil(fsDrrx ooo0teeomoctlt s2uan o;t0trtoif todom r uei;s  2tmirpoydome mnviatfa2rrurp;t1apeo fetydlaDelums (0tltnmfcoo1fpD  u ilt0tetr(r3oy4oleemfes s sDum(rpnu1alx moetytlmDua( s;(4trxoif ootlpDelnvsl( sexrxm oudlmee nei s)s2taur ;o4aeen ieild m ua(vo;u0 eeoif ootopDrlivil(  euo(o3oo1opt mnei t) rrrxm ;t1apt  i3ils m2uaumont4altoioctodfmt lnvolt) rtrxrpoudll nlies s)artmur nu1olenmociadfs ea(mo;t0tetnif oytlm  au s;( srur(mpiodam nlfeias)sDum( ooo0texoio3tysfaDuau s;u0tltomr tydlaDran il(0seurxm3iudlpe  fvia()arurumoot0tex  fctas m umnmo ()tleoxf3totfpt  ivo;s sexmxr io4apee feias) 2ra(rpnt1tleo iciatlsDeauvsnt4treoxr totlmD ln i;( t2xmio3nu1lmenmfeslsfaDrmxm nt0openmo3iadfaDrm(mont4tetomrcto1fmteln ol(0 etrio3iu1ll emnes ()s2taumpot1tle if3iasfa2rauvo;()artoif3tatfa eai o t0tetrim iydlm emfvsls  2rmxmont1tptomfctldfa2em(vo ()tltnif ty1lpDeau olt0 2xr(mpoy1lpe  neia(f 2rm(moou0tpeo ictad a rmnvs;(0trtoxocia1oateln s t0srtr(rpou1opte fvsasf rumurpnt1oetniieiltla2rmn o u0tlenmr3todlpt  uvslt  rtrxr ou1lp nmici sf 2ua(mp;u1altn ictas sDumn on(0 lxrmfctatopDrluvilt0t2xmio iydol  miesl(f rrm( o;o1teen feiltlm2rmnvo (0 rxrxr tytom r ieo ()truo(opoo4om nmnesasf rtr(mpno0alt  f3iat a rm(ms u)aeeomf totomtean olt) eurxr iy1aptnmieils  Dtm( pno1ape mictlsfs2rlumpnu4 leomo iotlatr iei;t t2xo(r3oydapte ictls  Drmuro;u1tlt ifciadlm2uauvo (0tleriocoo1fmt ln ils  etrxm iydom nliesls)s2rmxrp;t1alt  ieiadfsDrlnvp;u4trtrxr3io1lp  lneil()trur(o oy1lp emnvslt)a2ra( o;u0aet ifeiysfaDelu o t0 renio oydlaDeluvo;(0t2urxm iydlpeelnci (fsrrr(mo;u4aee iictytlaDemn s;t4aetrmoctodlateanvs;s0sexoir3iu1openmivt ( arua(mp;t0alenmociltfsDeln p u4 etnmf todlatr u s;t t2trir oydomtelfviasf 2rm(rpno0ape ifciytfm el( p;u) lxrir oy1lm  luvi t0 rxmiopiodlmtnlicslsf Dtru pnu4teeomietydlmDua(msn(4altrxr oa1la rlies s0texo(r3oy4apeemnesl(f 2rru pnu4tltn i3iad sDul(vo;(0trerif3tytoptelivs;(0setriopny4olen iesa()sDtmx poo0opeoioeilslmDean s t)trtoxr iatfm r i s;s teum(m3nu4apeelncia()a2trxmooo0alx mo3tydlaDem(mp;(4 etrmociydoa  aueilt s2urir ny1oleelivtas)aDurx pot0alxo o3ilt m2ulnmont)alxrio3ootlp rlu i ()srxoir io4lmt  ivia()sDrmxmp;u0opt  ieiadlsDran p t0 lenif tatom rai s;t)trxoim3oy1lp n iesls a2rru o;t0alt  octydlsDuanmonu)trtoxrcto1lmte u olt)srum(r iydal emfcta(farrax pnt0tptnmo3iyd m2ranmpnu4aeenmr iy1lp   n ols) 2xmir ny4lmtnlicsls  rur(mp;t0tetoio3tytfs2emums;t0 rtoxr oodlm rlu s t0s2xrxmpoydlmenmfcsls  Drru pou1oeen f3tls m2uluvo t) lenio3oytomtelieolt setoio3ny4am e nvtls)s2tm(rpno1ope mi3iadfa rmu s (4treoif oodfm raues;(0 rxo(o nu4openlnviat s2taurp;o4tetomiciltlsDrmums;(0aexnxo3to1oatraneols0trtmirpou4lpte fes ()aDrmx  ou0aexo i3iyt mDra( p u4 etrxr ia1omD  i o;s) etrxrpiodol e iesl( s2ra(  nt0oet ifctltlaDrluvo;t)tlerir io1opDeln slt trtoim3iu1ap nlfctat aDuru ono1aeeo fctatlm ranmp (0 leoio oatoaDrln ils)t2xr(o3iu4olt  nci tfartm(m ou0texoifciysla ulnvs u4 rerifcoatlpDrlu o t  rtmimpio1apeelivs tfsDrrxmo;o0tlxnmoeiasfm eauvs;u4 lxrmr oadla e i olt) rur(r oydale  ivtasfarurxmp;t1alxnmoeiydfa2eanvo t4trtnifcoy1lm   ueslt0trtr(rpnudopenlici s)srrrxro;t1tltoif3iydfs2uln s t)tetrif3iotopt li o;(0 exm(r oo1al emnvs ( arta(m no1oexnmi3iyslm elnvpnu4 lermf3io1fptranvs ()setrir3oudoltelfeslsf Drm(m ou0tleoiiciyd s ea( snu) rtomfcta1faDraivs s)trtr(rpny4ap   ivta(faDrmx o;o4olxomiciyt m2ua(mp t4aeerir oytomt anvi (0 euoirpiy1lpenlncia( arrrum nt1tpeo i3tyslm2um(mon(0 rxomfctotlpt  ivi ( trurxopno1am  lfvtas)a2ururo;u0teto fciydlaDem( s;(0 renio3ia1op elies;(  euoirpio1opt mneils) rua( ont4opxn ociydfm2ua( o t0trxrmr oydoa  aivils t2trimpoy4apt mfvslt)arrmxr oo4altoioeiadla2raumo;t0aetnmo oydla  lneols)srtmirpou1am e feilt) Duax pnt0aet  ociltfs2emuvonu0 lxrxf iotfmD lnvils0srurio ou4lmeemivslt  Dtaum ot4teto fctat mDul( p;u4 exnxrciydlm eli o;s t2uoio3iudll emfes s)aDuax o;t0ole ifciys aDulnvo;()trtnif tatlpte ivs;t texmiopnudll emfetat)sDtrumo;t0apen o3iysfsDuanmsnt0 ltomo3oadoate uesl() rxm(r ny1lpeelfvs (  Drmum ;u1apen f3tyt sDum(monu4tlxoxr3tadfa  luvo s  exoxm3iy1omeemfvsasfaDta( ont4apenifetyd mDem( p;() lxrif oadopDelu ol()t2xmirpiu4lp nlncilt s2raxr ;t0alxoiictytfaDua(mpnu4 rtnmfciadfmDe i o t  eum(o no4lmt  ncs (fs2trxrpno4apenioetadla2elu pnu4texnirciadoaDeai i (0t2xmim3oo4op  mnvslt)a2trxmo;t4oex  ieiyslsDrauvp;u)aexnxr3ia1lptrlueo;t0 2tmxm3ny1alt lfesasfsrurur nu1oexo octlt a2elnvsn(4texoxo3oodoa ranei (0s2xoirpnudal n fcil()aDtmxr ;t1altnif3tytfa rm( o;t0treoxfcty1lpD lnvsl(0seurimpiudlmt lfct tfa2urxmo;o0oltoii3tat a2rmn o u0aetoxr3iy1om  lu s ()trxm(rpnu4op  lict tf 2rr(rp;o1aetnmoeiatfa rluvp (4arenir oadfpDelieslt)teum(m3io1al elici (  Dumur ot4alxnmoctatla2ul(vpnt0aeeriociotlpDrluvo (0trxrir3iu4open fci ()arur( pot4optnmo3iltls2umu s t4tlenxr tadfptrlivo;t)setm(m ou1amen neiat)a2raum ot4ole  ociatla2emu o (0teerxf3iytlmteanvsls0 2uo(mpio1lm nlieilsf 2uru o;u1tex  f3ildfsDean ont0 eenmf oa1fateaueo;s0t2urio3iydapt  ncsl(f Dtrum no1oltniociyt a em(msnt4 rtoxf3totfp rauvi;t)trtmxopiu1alt lnvslt)s2rauroou0tle ii3iat a emnvo;u0 rtnircto1lmtean ilt sexmxr oydlptemfet s)sDtru oou0aetnmf3tysfaDemnvp (0 etoiocty1optrli i;t) ruoiopou4ome  nes sfsrurx poo0apto fcilsfa2ranmp t)aexrif ta1lmt anvi s s2xoimpny4om e nvs tf rtru o;t4alt mi3ildfmDemuvp;(0teeoio3io1laDeaueil()teto(mpio1lp emfvia(fsDra(mpnt1oltnmieiydlm2rmumo t4 rxomrciodfmte nvols)s2tm(opnu1omtnmnciasfsDraxmoou4ope mi3tadfsDrm(mo;(0artomrciadop rlivil(  2xr(opoodapenmici t) Dtau p;u4alt mf3ilsfm2elu p;u0tlenxr iatfaDeaues ( srum(rpnu4aptnlncilt) 2umxrp;o0tleoioeiad sDumnmp u0teermo oy1fp rlnei s0sexmimpnudal elnesas) 2um( onu1oltoiociadfm um(msnt4teenmocoatfmDeluvolt)srtoxrpiy4ap  lneias aDtax o;t0oleoiieiatla ea(vsn(0artomf totfm rln i (  2trir3nu1lpt lnvsl(f ruax p;t4oee ioeiadfs uan s;u0 eeomfcto1lmteau s;s  2tmim3io4lp e ies (f Drmxrpno1oex mfeiyt s eau p () etnir3oydla rlivs s) 2urxm oodoltn fcta()sDrmur nt4aeen f3tys s2em(vo;()aleomr3iytlm e uei s  rxmiopoodll elict (f Drmx  nt1apxomieiltls2ul(ms;u0artrxo3totfateai il()trtrio3io4opee fcsa(farumu ono1alen ietlsls eluvp;u)artnmoctytfmtrli o;s srto(m oydamte ivi s)aruau p;t4opxnif3iltfsDemnmo;u0aetnxo3oydfmteli i;t0 eto(r nodlmte nvt s  Drmxmonu0tpx  ietad mDea(vp u4 leoxocoa1laDrliei s  rtmxm no4am e ivi (  Dtr(mpot0tlt mi3iatla umnvs;() rxoxf oo1fpDe uvs t)trum(o oydapte ncsl(fartm( pnu4oexoifetysla rl(mo (4trxrmf3iydoate ies s0s2tmio3oo1lm  mfeil()sDtrur oo0opxnif3iltlmDeluvp ()tetnir tadfa  luesls) 2xmiopou1lptnmfeil()sDraumoou4altnmoctytfs rlu s;t)arxoif tytlpt lnei;t  2uoimpoodale mivs ()s2ua(r ;t0apeoifciytlm el(mpnt0 lenio tydfaD  nvs ()teumimpiodop   neilsfaDrau p;t4tlx ifciysfa rl(ms;u4tlxomr todfatr nvil(0seuoxo3oy4ap e icta(fsrtr( poo4openio3tldlmDel(vo;u) rtnmo3iatlpDeluei s) exo(m3iy4lmenlivs ( srumxrp;u0ole  o3tld sDem( p;(4arxrxo3iytfat  i sls  rxrxm3oodlp e iet ()arrmxroot4aex iieiytfsDua( o;()tltnmrciatlatelieo s)srxmxrpiydolen fes s  rtaxmont0tpeo fcild s rmn pn(4texnmr iydlaD aiei t) eurio3oydolenmfvtas)a2rrump;t0oet ii3tltlmDulumo;u4arxnmo3oo1fatraies;t texr(rpoo1ap n nesl() Dta(mont1tee ifetasla eauvs t)aetnmr3totlpD lneo;s0trumxr nu4ap emfet s  rtaump;o0tleniocilslm2el(vont0treoxf3oatoatelneil()s2trxr3nudaptn ictatfsDtrum ot1oeen i3tldfaDrmump;t4 lxrir oo1omt  n ils seurxr3iy1open fesa(fs2uaxrp;o4oetn i3iasla umu s ()arxoifctadom  lueo;t0setoiopoo4altn ivs t)arumum ot0olxnmicild m rln o u4 renir3oadlaD  n o ()trumxo3iodale lies tfarrm(mpou1apt  feilsfs rln p (0aleomr iotfm   uvo ()trurxopiu4lmtelfei s  Dtruroot4oexnifeiyt m2em( pn(4arxnif3oydfmteau olt)s2xo(opiu4ll elics tfsrtau  ;t0tetomf3iatfmDuauvp t0arermociotfa  lnvslt  2trim oo1al nmiviltfaDtr(mono0teeomoetytlaDua(ms u)teenif3tydom rai i;s srurio3nydamenlivtltfarua(rp;u4oexo i3ias aDrmu s;() rxnmf3oa1lmte uvols trxoxm3iydap   ietl()arumu pnu1oexo ocilt sDua(vpn(0tlenirctatfm r neil(0teuoim iy4al nmfeiasf Dta(mo;u0oleomfeildfaDelnmon(4altrxoctatfm eluvs;t)srtrxr3nu4lmeemfvias sDtrx  ;o4apxoifeilt sDuau pnu4 lxnxf tytfmteaies ()sexo(m no1op nlicil( aDrmurpnu1opxoiictatfs umnvsnu)alenxrciy1lmDrau i s0 rurxr io1lmenmivtl( srrrur ou0oleoii3ias sDelnms (4 exoxfcto1lpt lnvs ( t2ur(r iy4olee ivi sfaDuax  ;u1aeeomi3ildfmDrlnmo t4teeoir tatlat aneo;s  exmir3no1lpee iesat) rtmxm ;o4texomieiyslmDul( s;t4 lxnif3ia1oat auesl(0 2xrir3oodaltelnetat) 2ta(  ot4aee  i3tysfs2uanvo;t0areoio totfa  aiei (0 etrxr oudllt  fct t)s2umump;o4tptn o3iat m raump t4 leoio oytlpD anvslt0t2xrim3ny1op e nei s  2ua(  oo0olxn fctlsfa umu o;t4 exoifciydla  lu i s0t2uo(o oo1ame lfvi s)aDrmxrono1tlx iieiyslm2em(mo;t) eenmoctadlat  u i (0s2urxr oy1olt  fctas) 2rm(rp;o1altoiociydfs ranvpn()aeerxfcoatfpDe u ilt0tetoxrpiy4ap nmnes t aDuau onu1olxnio3ilsfsDua( snu0tltrir3totomD ln ils  rumim3no4ame lncs sf Dumumo;t0aetn oeilslsDraumpn()aetrxocio1oa   ueo;()s2xr(r nu1ole  nvtl() rum( pnu0olenmfeiasls uaums;t)arxoif3iydfmtrlu i s trxr(m oo4lme lfcilt  Durxmp;o0tpt  oeilt s el( p;u0aetniociatfptr i o;t) exoxrpoodoleelics (farur(rp;o4aptoiocilsls2eanmo;(4texoirctytfaDrluvo;t0s2xr(m3io4ope mnvsl( artaur ;u0tleomictatfs2rlu pnt4trxrxfcto1fatr neil( sexo(mpnodalt  fcs ( srurx p;t4opeomo3iydfa ulnvs t0 exnirciotfp ran il(0t2xm(r oo4altemivs s  rtmum oo1tetoii3ilslmDulnmsnt4trerircoo1oate uvi;s trxrim3oy4ap nlivs t s2ururo;u4alxnmietysfm uln ont0 exoxfcoy1la eluvo t)s2trxo io4lp nlfcsa(f Dtru ont1tpeomoeiytfs2ul(vp;u0tetrif oa1lat an o (0sexrim ny4am n fes tfarrru  ;o0tleomf3ild m eau snt0 renmf tadop rluvs s  2toxo oydamtnlfeta(farrru onu1opxnifciyslmDuluvont4texoxo io1omt lueilt seuo(o ny1lmtemncta()aDrmu pno0tlx if3tytlaDea(vp (4aexnxo3ty1lm eai i;( seuo(m3oydame lieslsf Dtm( pno0opt mo3ildlsDea(mpn() leomfciatlatelnvil()seto(r nu1lme lnes ()arrrxr nu1tpxo f3iyt mDranvo u)alerifcoodlmtelnvi t0srumxr oy1lmeelfeias)a2trx  ;u1tle ifeiadfm2rmnvs u0 rtomo oydfmtelneo s)sexm(r oo1omenmfct (  2rmurooo1tltn ociat aDea(mp t) lxnio3ia1opDraneo;()srumxrpiu4lptemnesl( artr( o;u1aeenmoeiysfa2rm( s t4aetoxf3iodlpDrai i;(0tetrxo ou4al nlncs s  Dtmurp;o4alxo ociytlm emump;u0 eenxo3iadfmtrli s;t)s2xr(r nydop n nctas) Drax pnt1alx iictydls2rmuvon(4tleoxf ty1omDeaivs;s s2um(o3iydom nmiet s)a2um(r ;t4tex mi3iytls2um(vs;u4 rxnmf3to1la  anvo t0 rumxo nodomeelivsltfs2ta(r nt4apxomoeiydfs rl( s;u4 leoif tydlaDranes t s2xoxrpnudam  lfet s)s2uaxmp;u1opt io3ilslmDumumsnu0 eermrcia1fp eliei;( s2xm(r oodom n fetl()srururpot4olx  i3tldfs rlump u4 rtrio3oadfmt  nes;s s2urxr3no4lleelfeilsf Dtr(mo;t4alxomi3ilsfm ea( s;(0 eerxo3tadlat livol(  etr(m3oydoleemictl( aDrr(rono4ale mf3iaslaDemumpnt) rxnio3tadfm rlnesls) ruoirpnu1apte neiatf rrmx  ou0aetomfeiasfsDem( pn(4trxrxf iadomt ai ols s2xo(o3nudol emfei (  Dtrxrp;u0optnifeiys s2umu s (0texoio oadlaDraivsl(  rtoio oo4amtemfcs t sruauro;o0tltnmoeiaslsDum(von()arxrxr todopt aueslt)srxoxr iy1lptn ncta(fsrumxmo;o1apeniicildls2um(vs (0teeoxrcoytfa  aivslt0t2umir iy1ol elnvs (fsDtrx  no1altomfcildlmDum( p;u4 lxoio oatfpD livols)trxoio3io1al emietl(  rrrxmont1opxn fcilsla2ulumpn()alxnmf iotfptelues;s)teto(rpou1al n ict t) 2tmxr ou4tex miciytfsDrmnvs;(4 rxomf totoatrai o (0 exm(m iodale  ivsl()aruaum ou0tle mfctyd mDulnvp t)arenir tatfmD livi;(0seurxmpiydlp elict (fsrrrxroou0altomo3iysfs2ra(ms;u4 rermf tatlpDrln sls)seumir iodlmeemnvslt srtaumo;o4texnmietasla um(vp u0teerio oy1lmteau sl(0trur(m no1omt  fvi (  rraxrp;t4ape mfeildfaDrm( p;t0 etomociotfateanes s s2trir ny4alt  fcta(fa2rrumono1tptnmoeiydls ua(ms;u0 renif oodlmt  neol(  rxmxr iydoltelnesat s2um(m ou4texo feiyd a ea(monu)artrio iadomD  u i;s0s2urxm3nu1lp n ivsasf rta(mpoo4apx mictadfm2ranvs t0tetoxo3io1laDrauvi t)s2xoirpoodlpenlfet tfarum( oou4alenmfcilt aDuauvon() etoiocoodfa r neols0teurxr no4lp nmfesl( aDumumo;u0tee io3iat m2uan snt)teeoxf oydop rlnes;t seurxm nudomen fctas)s2tmx o;u1aeen ieias sDulump u4 rermocoadop  lnvilt)s2xm(r3nu4apt mies s)a2umx ont1tleomfciat aDea(mont0 rxnmfcoadfpDelieo s setr(m iy4ap  mfvtat) rrm(rp;t0teeo f3iatfa2um(msnt4 rtomfcty1om  lnvo s  rtm(r3io4ap nlnetltfa2um(r ;o4tetnio3ilt m elumpn(0 exoio3iodlptelivol(0s2tm(o3oudam elici (f rtrurpoo0tpt mfctadlaDulums;()artnirctytfa   uvo;t)s2tm(r3no4lm  mfci t aDra(rono1oeto iciyd aDum(ms;(4artnxocto1lpt lu i s0 euoxr3nu4altelncsa() rua(  ;t0alen ieiysfa2em(mp (0tlenxr tytoaDe n ils0t2xmir iudlpee fcia() 2raur ou4olto i3ias s emnvo;t)artoif3iodfaD aivol() rto(r oy4openlnes (faDrm(rono1apxn iciltlm2rlnvp (4tetrmociydomD auvi t t2xrxo3ny1op  mfei tf Durxmono0ope mfeiyd s2emn sn(0tetnio totopDe nvs t)seur(o iu1al n nctas  rtrx ono0tpenioeildfa2eanmp;(4trerif3oadop eanvo;t) etrxr3io1am emivt s) rtmuro;t1apeo f3ilt s2uln o;(0alxnif oatfpDrli i;t  rxrxm oydlmtn ietl()a2tm( p;u0alx mo3iytfs rmnms;t4 etnmo io1laDr uvo;s0tetmimpio4llenmiciat aDrr(  ot1olxomoctys sDul(vp ()alerirctadfmDe ieol(0t2tm(m ny1llenmnciatf 2tm(rpnt4aexo f3iatla2ra( ont0 rxrmrcia1fm ranes (  2urxr nu1apt livil(  rrrxmpnu4alxoifetlt a ea(vo;(4trxoir3ta1laDe ieols  2xr(rpoo4amte nciltfarumxmpno1aetniociasfm ea(vsnt4 rtnxrcoytfmtr u sl(0setoimpoodoptnlnciat  2tmu poo4apt moeiydfm2emn sn()altrmoctytomD anvi;s)tetoxrpoy1lmenmicia(faDrrumono4olxn i3iyslm ea(ms;(0arxrifciydfm eluei ( t2toxm oudlmen fct tf rtau  ot1ape ifetydfa rauvp (0aexrmrcoo1lp r uvi;s)seuoio3oo4llenmivt t srtrurp;t1open feiytfm2emn o (0 eenir tydla e ues;t  2xr(r3iy4apt  neslt s2rr( oou1apxniictyd mDemn o u)tltrmr3iytoaDraivols0 rxmirpnydamtelnciltfs2tm(r nt0tpx mictyslsDemu pn()altnmo3ta1fateli ols) etoxrpoudam nmivt tf rtr(ronu1optnmictys a ua( s;u) reoxo3oodop elu ols texr(o3iy4llt mfcia( sDrmu pot4tpx moctlt sDumnmpn(0tetnircootfptelnvo s) rum(o3ny1al n nesltfa2rr(rp;t1optn ieildlm2rmuvont0areoxr3todoaD  u s (0tetoirpnu4am n icias) rrr(  ou0tetoifciasls2emums u4tltrmo oatfpDe ues s srumxm3ou1ol elfvt t srrruroou1apxomi3iasfa rau p;(4tltrxf3ootopt auvo s0s2xrxo3oy4amt mnvtas)artmumo;u1aetomf3ilt sDrlumsnt4artrmrciotlpD an i t) 2ur(m nudal   fviat) rumumpot0ale ifctld m2ra( p;() ltoif tytfpD  iei;t) rurir io4oltemncta( sDtau o;u0tlxn ietad mDra( o;t4 lxrmr3ta1om rau i;s0s2xr(o3oodop elneia(faDtau ont0texomi3ilslmDulnmsn(0altoif3tytlmD  u s;s  etrxo io4ap nlietasf 2rr(mp;t4oeen oeils mDulnmo t) rxrxr3iadomDeaieolt)srumio oo4openlfvt t)artr(moou4oexniictltfmDrmnvp;()altnxf3oo1oatrai s (0 rum(r iodam elfcs sf 2rmx ooo1oltn ietasfm umnmsnt)trxoifcoydoatr ueil(0seum(o io1ll  liet t) Duaumpno4oetnmoctadlm emu p (0 ltrmo ta1lm e ueo;s texmio3oydop n iet s aDtax pnu1alx mo3iyt m ulump (0 lenxr ta1lmDr n ilt)t2xo(r oodlmtnmfes s) 2taxmo;u0tleomo3iysls2eau pnu4 exrmo todfp r nvo t) 2toxr3oy1oltemivs tfaDtmu p;u4oexo i3tasls um(ms;(4trtoio iotlaDeaues s t2um(mpiydomtelivi tf 2uax  no4tptnmf3tlsla ra(vp t)arerircoadom eli ilt) exrio oy4lmt lnvs t)arumxmpoo0aee  o3tyd mDemnvont)teeoxf ootoaDr nvo;()texmxm3no1ol e ivsl(fs2tm(m nt4tlxnmociytlm2uan p;u)alenxocoadlpDrln ol( s2xmir3oy4llenmfviasfarra(  oo1tlto o3iad a el(mpnu) ltrif3ty1fate ues;t0seurirpoo4lp elnci t  2raxr ;t1apxoiictyt a2eluvpn() reoxf3iadfmD  u s;(0 etrxopiodamt lfvslsfs2tm(r ;t4ope  o3ilt m rm(ms u)arxomocoadlat aieils  euo(o ou1ale lncias)arrr(rpno1ole mfctat sDum( onu0tlxoif3iadlm r u i;()texrxrpiudal  lfei (fs2trxmooo0oleoioctad a2emuvp;t4 reoxo3oadoate nei;t srtm(r3nu1opee fctas) 2umxmooo4oeeoii3iysfa2rmn o u4aetoxf oa1oa rlu i;(0 rtoim3iodoltelfeta(farua(mp;t4altnmietat mDeluvont)tltrir totop rlneslt)t2uoxm3io4om e fci t)aDurum oo4texnmoeiaslmDrlumonu0tltoxo ty1fp r nvsl(  2umxo oo4olt mfcilsf rrru ooo1tpto oetltfm2ul(vs u) rermrcia1fat  nvil(0 euo(rpny4apee fctlt) 2uax oot4teeomiciaslm rmnvs;() rtomf3oodom   ies;s) 2uoxr3ou1lpe mivia(fartmu  nt0opt if3ils mDem(vs;u) lxnif3iydlmtrauvi s0 rxoxr3io4aleemfetasfsDrr(m nt0aetn oetasfm2elumonu4 ltoxf3ootfmteluvo;()trtmxo3ny4ll elict s srrm(rpoo0alen ociydls2eau pnt0altnif to1faD  ieil(0setriopiu4ol nlfvi (farurxmpnt1aeto f3ildls2elu s;t4tetomf3ia1fa elnvi t)s2urxo io1lpeelnet s  2raum ;t1tltoifciytfs emn snt0 rxrxo oodfa rlivolt t2xo(r oo1lmt mies t) Drru oot1tlxomfctasfmDel(mo;()trtrxo3tadfa elnvo t t2tmio3iy4om nlfetltfartauro;t4aet micild a2uanvpnt0alxoxf iotlmDrlu ols)teumxm3nu4lp elieil()a2uaxm no1tex  ocils a2rl(vp u4 lerir3todomDrli slt0 rtriopio4am elici tf Dumx  ot4tlxo fetldfa ulnmp (4teeoxf3iotlmDraneil() exo(o oydameemfvtltfaDumuroou4ole mi3iltfm emnvp (0arxnmr3to1fa raneo t0texrim nu4apee ncil()a2urump;u0oeenio3iltfm um( p;u0 rtnirciydopDrai o;( tetr(o3ou4llenmicil(fsDtru ont0teeo oetas m2ua(vp;u4texrxo totlm rli s s s2tmxo iy4ap  mies s) Drmx  nt4tlx moctlsfs2ran pnt0alxrmr3oodomteluvilt)trurxo oodopt mfeilt)aDum(rp;u1alto i3ilsls2umums;u0alxoio io1la rli o;t s2toxr oydol  lfeils) rrmumpoo1opx ii3iydfa raump;u) rxnxrctadla  luvols texmxmpnudam n fcils aDtrx  ot1ole moeild a2ea( s u0arxoif3oadfaDelnvi;t trxoxrpoy4ol elncslsf 2tau  ou4texnifeiydla2ulnms (4 etoio3tadla raivo;s) ruoxmpoy4aleemivslsfs2umxr ;u1oeeniietlt a eau p t0tlxoxfciodlm r uvi;(0texm(mpnu1lpe mncilt sDtr(mpnt4olxnmi3tltfs eauvsnt)aleomo3tatlptelies;( srtoxrpoudom emivt (fs2umurooo0olto iciytfsDeluvp u0aleomr tytomD  nei () rxrim iudaltnlivia(  Dtau oou1aetomociat sDean pn(4tltnio totop   nvo t trxr(m io1amtemieta(fsDtrur ;u1aptoiiciytlaDrluvonu4aetoio3oy1oaD luvi s0srtm(m ny4ll elnctlt) 2um(  ;u0apt  iciltfmDrauvo;t) rxnir tydla r ieol()trumxo3no4alenlncsat  Dtru p;t1oet  octyslm2em(vs;t0aleoxfcia1om elues t) etm(o no1alt lnct s artrum ot0aptomiciytfaDrmnmsnu0tlxnxr oo1opDeai s (0s2xo(m3io4lmenmictltf rumxrpnt0tetn f3tlsla2ran s t0alxrxr tatlm ran il(0t2xmxm3io1am  mnciasfs2ua( pot0tltnio3tltlaDrln p t) exnmfcoo1lmtean o t) rtoxo3nu1al  lfes s) rraxr ;u4teeo ocilsfm uauvp;u) reoifciytfmDelies;() rtm(o iy1am emnei t)s2uaxr ;o4tetnmociyslsDeaumpnt4texomrcoodlmteaneols s2trir3oy4opt  fcsa( sDtrx  ;t0tltnif3tld a2emuvsnt) exrir3io1lmtrauesls0 rtr(o3iu4open fesas  rraxm ot1ope mfciltlaDumumont)tetomo3iatfm rln s;(0t2uriopnudlm  mnesasfsrur( pot4tpen o3ils a2rlump ()treoiociotlpDrln i;t s2xoim3iu1ll  mfvtltfaDtm( p;u0tpxn iciyt a ul( snt)aetnxf oatomD li ilt  rxoxopnu1opt lneil(faDrr(  nu0tex  f3iadlm rln ont4 ltrmf tydfp   nvsls seuoxopiy4lpte ivslt  2raur nu1tlx ifetld m2emnmsn(4 rtrif oo1la  lnvo;() 2xrimpnudom elici sfartmu  ;t1ope iieiadlm2emnvp u)arxrmo3tatfa   ivo;( srurio3nu1alte fvi t)artmur ;o4tlxn oetatfmDulnvp;t)altnmo todoa eauesl(0srtrxrpou4op   netat)artm(mo;u4tltomfeiyd s2ua( snu4aeenmr iatfatranvi;()sexoim3nodlptemfeta(f 2ururonu4apenii3tldlsDeanvp u)alenxf3ootlm  luvi () 2toio3oodopt lics sfs2tmum nt0teeoiiciat s ranvs u) rxrmf to1latr neilt0sexoxo3ny4lpe lfctltf Drr( pno1tex  ociatlm2elump u4arxoxo tadfat ln s;t)srtoxo io4lpeemies (f Duax ont1tle ioeiatla2rmn o;t4aexnmr tytom r ieo;( trxrxopiy4olt  fvs (faDumxm ot4aexnmo3tas sDumu p u) etnxrcoadlat aivs t0t2toir3no1alte nvil(f 2rru  nu1tleoiietldla2el(vs;u0 etoio3todfpDean s s)srumim3oy1alenlfetltfarrr( o;u0tlxn octydla rau s;(0 renmrcootfm eln o;s) 2xm(mpou1apenlfvsatfsDuaxro;t4apxo f3iltlsDumnms ()trermo3todoaD ai sl()s2xoirpno1op nlnesl(f rum( poo1aeeo oeilslaDeauvs;(4teerir tatfmDr ueolt  rurxr iy4amte nct s srrm(m ot4alxn iciytfs2um( o;u0trermr iy1omt auvi;t t2tm(rpny1lmtnmictltfsDraurp;o0oexnioetatlm2rl( pnu)areoxo3oadfmDr uvs;() eumxrpiy4alt mfes tfaDra(ro;u0tpt ii3iytla2elnvo;(0artoxf3iatoaDrlieils t2urxm ou4lmtelfcsatf 2tm( pno4opeo i3tydla elump;t4 eenio3to1fpDeaueslt  ruoim3ou1ale mfesat) rrrxrp;t4tlxn f3tlsfmDemnvsn() ltnmr3tydomDe n i;()teum(mpiu4altnmnet s)s2ta(r ou0alto oetldfm2ul( o;u0trermr todomD lnesl(0 2tmxopoy1oltelfeia( arurxm ;o1tltomocilsfsDeln p;u4tlxnmf3todoa r ieils0 rur(r3ny4aptnmiesa()aDtaurpoo0opxnifctldlm ran p;t4 exnxr3totfaD livi;t0 2um(o3io4ap n ivil(fsDraxr ;o1tle mfctytfsDuauvo u0altomo3ty1fpt  iei s0trtoxmpou4apt mfviasfa2umu p;o0altomieils s2ulnvp;u4arerxf3iatlmDrai o t0srto(r oudom  lfes ()s2ua(m ot4ape  ictys aDuanmpn() rxoir oodfpteaivi t0srum(m oydop e net tfsrrr(mpno4oee mieiatls umn pnu4tetrircoydlaD  iei s srtrir oodlme mfvil(farrmxr ou1oetomoetaslaDeaumsn(4arenmr iy1oa  lnesl() etoxm3nudamt  ivsl() 2rm(  ot4tlenmictytls ul(vsnu4 lxrxf3tatoat lu o s tetoir nu4lp  mfet ()sDrrumpou0apxo fciad s2emnmon(0aetnif3iy1opt  u sl(0srxmiopou1alt  ictatfartax ont0oet mfeiat aDuan p;(0 etomrctatop  an o s0srxr(o3iodop n ict t) rur(mp;u1opt mociat a2rmumpnu0 rtnifciadfmDr n s s0srurxo3no1lpe  fvsas s2umurpno1tpxnioetaslm uln o (4 lxrmf oodfatrlivil( trum(rpoo4opeemivta(fsDrmu o;o4tpxn fciys s rmu p u)tlxniocoo1la  lu i;t)t2umir3iy4lptnlnvs ()aDtru p;t1ope mietaslm eauvo;t0trxnmfcoodopD li s;()t2xmxo nydlptnlfcilt  rra(  ;t0apxo fciatlm umumpnt) ltnir ia1faDrlneo;t0srxoxopoudopte feta(f 2ua( ono1altn o3tyslmDean s;(4altnif3iydfpDrlu olt  2urio3oy4lmt livsls) 2ua( ooo0tpx ioeild a el(mp;t0tlerxrciy1oaD an i;t)t2uoxr oydlltelnvi sf 2uax  nt4aptnioetatfs umnmpnt4 rxoio3oo1fpD luei;t)texrxo io1alenlfcs () Dtax oot1oetni
\ No newline at end of file
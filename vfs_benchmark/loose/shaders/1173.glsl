@@ -0,0 +1 @@
+n ils)seumir3iydolenmnvs s)aDtaumpou0aexnioetld a2eanmp t0treoio tadom  an ol() etmir io1lm  mfctltfsDra(rp;t0altnmfeiyt m2rmnms;u)altnmrcoodfp rluei;t0 2tm(o oydlp   ivi ( arum( p;t0ole iieiatlm rauvp;()aeeoxr oadoat au ol(0srxoir3ou4lp nlnvs t s2rr(m ;o1alto fciysfaDul(vont)teenxfcta1om raies;s) etmxo3oy4am   ivs tfsrrmu pou0tpx mociysfmDrmumo;(4alxnxrctodlm  lneilt)s2toio3ou4apte ivsls  2raurpot1tlx  fciydfs ua(msnu)arxoir3iy1la eln sls) rto(r oo4lltemici t sDuau  ot1tlx mictld aDemuvont4 lenmo totla  ln sls0teuoir3oy1ap emnes ( s2tm(rpot0tetn fctyt sDul( o t4arxnio3ty1fatrluvilt)t2urir iu1lmtemnesas)artaur oo0tet  fcias a rm( p (0trxnxf3oadomtelu i;(  etm(m3oo4ape mnctat)aDtr(ronu4tlto ocildfs uaumo u) rxnif to1op elueol(0srtrxr oodal  mivt sf 2urumo;u4apt  o3tasla2emumo u0arxrxf3oa1la   u sl( t2trirpno1amenlicsl() Dtmx p;u0tptnmfctlslsDrmn pn(4texrir oydlpD aieol()teuoxopoudlptnlnvi t) 2rrumpoo1apto fciys sDeanvo;(4 rxrxf oydfa eauvi;t)trto(r3iodap e fctl(f Dtm( ono0alxnii3ildfm ranms t) lxnmr oytfm  luvils t2uoir3oydlmt  ivs (  rtr(r nu1tpt ifeiys s2um(vonu)tlerif todopDr nvslt0 2toir iy4lm nmieslt s2tax oot4aexo feiyt s rmu o (4artoio iotla r uvi (  2xmim3oy1ll nliei sfs2tax o;o0apenioctlsfs em(ms (0tleomo3io1fmDe n o t  rtmio3iu1omen nesl()sDra( ono1ope  o3iat s rl(vsn(0trtomrciotlm e uvo;t texoxrpny1amt mivslsfsDurx pou4tpxnio3ild mDranms;t4tetrxo3oodlp  ln sls0srxrxopiy4optnlivta()arur(rpou1ole  f3iytlm2eanvo u) rxomf3oy1lm eln i;()texoimpoodom elies sf Drmxmpou1olt ifcils m eluvp;u0 rtnmf3totfaDeanes s0 2xoio oodlm n fvilt srrmum ;t4opx if3tatfs2um( s;t4alenmr3iadopDean i s0s2xmio3iodom emnvsa( s2ta(  ;o0tlt  fctls s2emn o;u4tltomr3oatfaDelueo t srtoxo3iy1alen fci (  Dtmumoou1aleoiietyt m eanmonu0areoio oo1oa  aiei s0 exmir iudlme mncsl(  rtaumpno1tpe  o3iysfs uan s (4 rtrxo3tatomDeauei;(0tetm(opoo1llen netl(f Drrxrpnu1oee iociat m em( on(4aeerxr3tydoptrlivols0srumir3ny1lptelnvsatfaDra( pno4aeen ieiyd s2ul(vpn(4 rtrio3oatfat li s s0s2xmxr3ou4lmtnmfvs s  Dta(r nt1tlx  fetatfaDrl(mp t)trtnmocoadlaDeai i;(0 2tmio iydlpe  fesas s2uru onu0alx  ociadls2umn pn(4artoxrcoy1lp rlnvi;s0 2uo(mpio1lmt  nci sfaDrr(  ;o0aexoii3tysfm2umu o;t4 eeoioctodfm   i o;t)srto(o ou4omtnlfesl()sDtaxmo;o0aeeomo3iyd sDua(mp () lxomociatlmDeau o t0 rtoxm3oy1ll nlfesl(  Dtmxmp;u4oleoio3tat mDrmn pnt) etrmf3oo1laD ai s;s  exmio oydameemivils s2rm(m ou0tetnmi3ias a em(vpnu4 ltoxrciytfpDeanvs;s  rxr(r3ny4olenmfct t a2rm(rpnt0alxnmi3iasfa2umnvp;u) rxnxf3oa1fm  livolt t2urimpiy4omenlieilt)s2rax  oo1apt mfciadfm ul( s;t)aetomf oa1fmtraivsl( truoxr iodame  fvs t)arurxr ot4tpxoio3ils m umn pn(4 rxrir ia1lp  lnesl(  rxm(o iy4lpeemfvs sfaruaur ;t1apxn oetyt s rln onu4trxnmr iotlm r nvo (  etr(opoo1aleemieia( s2tr( onu1apxnmfetytlaDrmnms u4artrmfctydlpDr nvs (0s2um(r iu4olte ivslt) Dtrxmoot0tpxnioctyslm ua(mon(0tetrmfcoydlp   iesl(  exrxr3nodlmt mnvt ( arua(roou0opt mietlsla2eluvont0aexoxo iy1laDeluvi;t  2trxo oydaltn ieilsfaDuaxm nt4ape miciytlm rmnvo t4 ltnxr iy1opt  i s;() exm(m oodame mictlt  rrmx  oo1teenifcildlm ranmonu4tleoif3oadoatrluvs s0t2ur(m3io4lpe mncilsfarurur ou0oex mi3tat a2rauvsnt0 rxnmocto1lp eai s t sexmimpiu1olenlnvia(f 2um(rp;u4oex mociyd mDeauvo;u4 reomf oydlateliei;() etoim oo1ll nmiesatfsDrr(moou4texnmi3ils a ulu snt4teermf ia1oaDean o;s0 eumxopoo4amt mivt s srrm( p;u0alx iiciasfs rmn pnt) ltnir iotopDeai i s0trxrio oy1ame lnvsls) 2rmxmont4tetoif3iat a rl( o;u0tltrmf tatopDeliesl()seuo(o ou4am e ivtl( s2umu  ;o1aleo oeiyd s ra(mp (4 rxomf ootomt liei;t srtrir iu1lm nlnct t  2ra(ront0oet ii3ilsfs2rmnvp u)aetnxrcoy1fat lues ( srtoiopoo4amen ivs s)aDumxmpnu1oleo f3tytls ea(vonu4aeermf iodfmD li o t s2xrxopoydlmenlfvi s)sDrmu  nt1tetnmfetadla rmuvo () ltoxo ootfmDrau i;t seum(r iy4ll elnvi () 2tm(mo;t4teto f3tytlmDea(mo;u4 lxnmf3iotfmt anvi () euoir3iydamen ictat)artmxmoot1tpxn fctysfs2rluvp t4aexrxrctadom rli slt0teumxmpoo4ol nlicia(f 2rmxr nt0ape ii3iadfa rmumo t4aetomo3iotlat li i ( tetm(r3iu4openmfvt ()arrmxm ou4aeenmfeiadlmDranmonu0aeeoxr io1fmD  neo ( srxoxm nu1optemnvt sf Dtmxm ou4tleoiociat s2uauvpnt)arxrxociotomDranes ( seumir3no1ope mivs s srrrurooo4opeomictyd m2ean s;t)altoxfctytlmD luvo t0t2tr(m oy1optnmicils)srtrurpnu1ope  icils aDeluvp;u)aetnmr oadlp elnvi t)truo(r iydlm nmfvia() 2rm( pnu1tleo fcilslsDrm(vpnu0 lxoxr3oatopDr ieo s seumxm3oy1lp emnvia(fartauro;t0apto fctysls2rlnmont0texrifctotfm elneols s2urxm no4ole mieta(f Dtmur no0tetn ieiasls ra(mp;t)trxnio3ia1laDeai ols0srxriopoy4ll  mici t a2rmxr no4apxnmictatla2elump u4tetomfcoadfatrau s s)tetoxrpny4ol   fvsl()aDrru ono4alen ieiytla uanmonu0 exrio oa1lmD lnes t  etrir io4amtn fvs ()arta(mo;o4tle  ieildla emu o;u)tltnmf3oo1op  aivo s t2trxm nydomtemneilt)a2rmum no1olto iciltfa umumo;(4tltrxr ootoatrlueils0srurxmpiy4ap n netl(fa2uax oot1tlx ii3iyt m el(mpn(0treoxoctatfaD  nvi;t)t2to(r3iu1ll n ictat aDra(rono1tlenmfeiatla2ulu p;t4tetomrcoy1lat  ivi t)s2xr(m iu1llt  nvtlsf 2ua(rooo0tleomoeils a eanmonu)arermo ootfa r i ol() 2xmxo3oy4oltelictasfs2ta(m nt1tex moetld aDrmn o;u0 rtnmf oo1fpDr ivo;s s2urimpiu1alt lfcsas  Dra( pnt0apeomociasfa2ulnmonu) leomo3tadlptr i i t0s2tm(rpnu1apee fes t  rtmx o;t1opeomieiydfaDumnvp;(4arenmo iotfaDelnvils)srxoir3iu4lp emnes sfs2tmxm ;o4tetnmieiyt aDranmsnt0artrmo ootlpt livslt0 2tr(r3oydlp   nctasfa2tmurp;t1tetomociysfa2el( onu)trermocoy1lmtrluei;(0texmxo3io1ll nlfet s  Dumum nu4oltoifeiat a2ean p;u0trenirctotfm rlu ol()teum(m oo4op n fvs s) 2rrxr oo0alxn fctys sDra(vs;(4 renio iadfp rlnvo t s2uo(m3iydlmenlnvilt aDrmu oot0oetnmoctldlsDum(vsnu)artoxo oadomteai slt trumim3oudop eliei ()srraxmooo4texomi3tlt mDuanmpn(0 eerxr ia1laDeaues;(0 exo(o iu1lm   ieia(  Dtaum ;u0tlto o3tltfmDua(mpnt4 ltrifctatlm rln ilt)sruo(opnu4lpt licias s2uaump;o0tptnmieiadfs uauvont)alermf3oo1lmDrln sls tetmirpnudom  lieias)a2um(mpnu1tex mfctas a ul(vs;u0 reoxrciodlptranvols) exoxo oy1oltelnvta(fsrtaxro;o0oee mietadlsDulu s t0trxrxf ty1fpD lnei;s seuoirpou4al  livs (f Dur( p;t1aeeoiociaslm2rm(vsnu) reomrcto1la  lneo;s)t2xr(rpiy1ll e nctl()srurx  nu0tpenmoeiytfa2em(ms t4areoir tatlmDeaies;s0 euo(m3nu4olt mncslsfs2ua( o;u0texn i3iadls2ua(ms;t0 exnxr tytfat  n o t setrio oydlp nlnvslt  Du
\ No newline at end of file
@@ -0,0 +1 @@
+ues t0 rxm(opnu1amtnlneiasf rraurpou4oex iociyslm eanms u0 reomo3tytfm rlivi;t)sexmxopoudope mfvi s) rrau p;u0olxoioeildfs emnvo;(4aexoir3iadfmDr uvi s srxmir3io4ap  lfctlt arrrx p;u0texo fcilslmDuluvo;u4trxnxfctadfp e ieo;s sexriopio4al nmneil(  rurum nu1tleoiiciadfs2uanmp;t)alerio iydlmDrai i s0sexmxr3oo4ap   ict sfartrxr ;t4ole iietydls2emnvpnu) rermfcty1fmtr n s;t0 exrxmpoo1lmt lfvsls artmum oo0alx mfciadfs2elumo u0tlxnircoo1oaD lues;t)sruoiopio1lm n nesat sDtmxmp;t1ole iociatlm2eauvsnt)teenxocoatom eln i ()srxoir3iydol n ivil( aDraxr ;u4optnioeias a eaums;t4trxrmfctadlaD  nvol( sexrim iy4amt lnes ()aDuaxronu4aeeomo3iyt m2em(von(4 lxomo todop  aneo;s0 2xrxo3ou4om   ict s)aDtrum oo1apxo i3tydls el( p;t4texnmrctatla rluei;s) rurir3nydap e ieilt s2tr( oou4altniictlsfmDul(vp;u4tlxnif io1om   n i (0teumirpiu1lp n icsasfa2ua(mpno0open o3ildfa rl(mo u0 lxomo3iydlm e ies ( tetm(rpoo1al  miesas aruaumono4opeoioetldla rmuvs;t)aexomocty1la rliei s) eum(r iodlltnliet t  rrmur ot0oet  fciat mDean s (0arxoxo oatfa  ln ils  exm(m3iodomtemnci t s2ta( o;u0apxn fctyt aDel(vs u0alxrirctotomtraivi s)texm(r3ou4lm   fei t aDrm(moot1teen oetls aDrln s;t4aleoxrcoatfm rluei;( trxr(m3oy1apeelfvsa( sDurxmpoo0opto feiytla rmnvont4tlxnmrcoadlp rlueils  exm(o3nodop elnvta( aDraxm ;t4apen i3tatla rm(msnu0altoxrciadlptr neo;t)t2tr(o no4lp nlies tfartauro;o1tetn f3iatfs rmu pnu)tltrio tadfaD luvsl()tetmir iudapenlfvsl( sDtr(m ;o4oee ii3iysla um( p (0texnifcio1lpD anvs;s  rxmir3iy4openlictls)a2uaxm ;u0openmf3iys aDran o;t4tlxoif oa1lmDr i i ( texr(r oodome lfvsl( aDtauro;u4opt iiciysfs emnmo;()trxrxr to1opt  nvo;( t2xm(r iy4ap elicsasfs2rmuronu0alxoioetytla rauvonu0 etrir oa1la r uvs s)sexoxo3nodalte nvtas arrrumpou1oex ii3tyd aDran snu)tlerxo oadlpt  uvils0 2umiopiodom nlnci ( sDtm(mpot0apxomfeildlsDrl(vs (0altrxfcoatlmte ivs ()t2ur(m3iy4lmt mfeiat  rraum ;u4tlxo icildla raumpn(0 rtrmf todlpt lnvi s trxmimpiu1lptnmivt ()aDtmxmont4ope mo3tlt sDea(vp;u)artrir iytfa eai ols)trxmxo iydale  iciatf 2trx oou1oetoifeiad m uaumo t4tleniociy1lpDrai ilt)sexoxmpou1ame  fvtl( a2taxr oo1tex mfetatfaDemu pnu0 leomr3ia1fp  li i;() rurxr3ny1open fct (  Dumxm ;o1apenmociys a um(vs;t0texrxrciytoptraueol(0 etrirpny4ome  iesa() 2trxmoou1apt mfetldla2rln p;t0texnxo3todlmDr uvols) 2umir3nu1ap elicilsf 2ua( poo0aptniieild sDemuvo;()artnmrctotfmtrln o;t)t2toio3oy4alenmneil(f ruaurpnu4tpxnmf3ilslm uan p t0 reomrcty1opD ln o t)teuoxopnu4apee neia(faDurxr ;t4teeniietadfa2ulnmonu4tetoiocoy1lmDr ivs;( srur(m3no1om  mfeta(fs2rr(mpoo0oeeo feiydfm2ra(mpnu4 exnmo3oy1oaDrlies t  euo(m3nudoptnlieta()srum(  ou1olxnif3iasls emn o u0 ltniocoytoa eanvo t)truoxm3nu1lptnmncs s s2ra(mo;t1tpxoifctad mDuan o;u4trxrxf oatoaDraivslt)s2xr(mpnu1omt  feils)a2tmu pnt1tlxomieiad a2um( pnt4trtrxociotopDrlneo;s)sexo(m3oodomtnlfvt s sDuaxrp;t4texoifcildlsDul(vo;t4aetomf3totfptraueo;(0trxoim iydamte nvsatf 2tm( pot4optoiieilsfs ulnmsn()aetoir3ty1lpD  uvo;t  exr(o no1lp n ics (  rurumooo0alxo oeiat s2elu o;u) exnmf oytfp   n i;s) eum(o io1omee ieslt) Dtrumoou0tlto ocias aDrau p;(4artnio tadop e u i;s trxrir3ny1al nlfeslsf 2rmuro;u4oeeo fctys sDrau s;u)trermo3oodopDr nvol(0truoxm no4om   neiltfarumu oou0alxoiieiysfm2ranvonu)trxrxfcoydoptran slt0trxm(opiydol nlicsasfarrr(rpou1texomfeilt m2em( sn()tlxoir3iytlp r uvo ( srtmio ny1al   neia(fsrrrumpnt1apxomfeiat s2uln pnt) rxrir3oa1fm   uvi;(0 2um(o3ny4amt  nctasf rra(rpno4aetnmiciytls2elnmo;(0tetnmf oo1lmte uvo;s0 etmim3io1oltnmiet tfaDrru ooo4olx if3tltfa2el(vs;()alenio tydop  an ol() rxm(opou4ape lfvtat  2ra(mo;t0oex ifetatfm2eanmo;u4tetrxo3iodfmte ueils srtrir3iu1oleemietlsf rraurpnt1apx iictlslm rl( s;t)aexnxoctadfpt  nes s texoxo iudaptnmfvsat  rta(rpnu4olen f3iadls2uau o u4 eermr3to1lpt ln olt  rto(rpio1olt livt sfa2um(mpno1oetoioctadfs ranvont0tlerxfctytlmDrluesls0t2umxmpny1lm e fvtasf rta(  ;u4openii3tytla2rluvs (4 lerir3iotlm rlies;(0 rtoxo nu1am e ict tfsrtruro;o0tpxn ociysla ran s u0texoxr iy1lm  lu sls  2xrio3ny4lle lfesls)artaxrpot1tlxn o3tysfm rlnvsn(0 exoxo3ia1lpDelneols0trtm(mpoy1amenmncilt)sDrau  no0olx mi3ilsla ra(mo;t4 rxnif totfaDrlnvo s s2to(r iodllte fviat)srta( onu1aptnio3iydfs2rlnvp;(4 renmf oydfmt aivils0seurxr3oodol nmicilt sDrmx  ;o4teto ocild aDeanvs u4arxoxf ta1fmt  uvi (  eurim3oodom  miesa(  Dtax  ou1aet ii3ildlaDelnvs;t0 lermr3iotla elivo t0trtrxopiy4lpenmictls)sDrax o;o4aeeniieiatfmDel(vo;u) lxoxf3ootfaDraivol()tetmirpoo1llenlfcs t aDrmxm nt4aleomieiyt a ua(vo;u)alxnmrcoytlmDrlieo;s seumxo3oy1omtnmfct tf 2tmx  nt4optn fetasfaDulu pn(0trxnxf iy1faD lnes (  rxr(r3iydlme lfeslt  rumu ooo0aptn oetltla rmn s ()tltnmfcoodop raueo;s seto(o oydal emivils)a2taxrpno1oetoii3tys aDuan o u4trxnmfciatfmteln s;t0 2xo(r io1apeelietl(  rtmxmo;t1alt mf3iat m eau o;t4trtoio3oydoaDr i s;()srtoxr3iy1lpt licia()s2trxmp;t0tet if3tyt m eauvs;t)aetrxo3ty1lmte n o (0teuoir nodop nmics ( a2taumo;u0oeeniietadfa rmu snu4texnxf3ta1fmDran i;t)tetr(opio1opeelnei s)s2ur( ono1opx iictltlmDumnvsn(0aexrmf3oa1oaDe nvilt0 rto(m nydlmtn ivt s)s2um(m ou4tpeoioeiltlmDemn on()aleoxo iatfaD li s s)teurxr3iydlpe  fei ()sDrrx pno0oetnifciad mDrl(vs u0texoxfctotlpDran o s0 rurxrpnu4am emfcta() Draxr nu0apxoiiciysfa ul(vsnu0trxrir3tytopDeanes ( srumxm3iy1op   nesltfaDrr(rpnu1aetnii3tadfa umnvont)aeerioctydlmDelivol( srxoio3ny4oltn fcslt) rta(m nu4tlenioetls aDra(vo;u0 rtnif ty1fmteauvols)sruoiopiu1llt  fcils arrrxmpnt4aptn i3ias sDra(vs ()alxrxocoo1lpt  uvs ()t2tm(mpoudlm   icils)a2ra(rp;u4aetomoeiydlm rluvsnt4 eeoif3iatomtr nvils0texrir nodomteliesas aDraxmo;u4apxo oetatfm um(ms;t0tltrir oatlmteanvol( teum(mpoy1olt  fcils)a2tru pnu4tpe ioctld mDra( on(0 rerxrcio1opDelnvo s0s2xrxo nodll nmicta()srtmu  nu1aleoiictytla ra(monu) reoxo oatfmt anvo t0s2tmxr3oy1llenlivil( s2taumoou1aexnio3iydlaDuaumsnu0aetrxo3oodoaDraivs t  2ur(o3no1opte neia(fs2ur(rp;t4oleomociyslm el( pn(4 exnmfcoo1lp r neo;(0t2xr(rpiudlptnlieias arur(monu4tetn fciysls2uau p (4tlxnxocootopDeliei;( t2tmirpou1op  mfcta(  rrru ooo0tpe mf3tys m2uln pnt0alermf3ia1optrlu s;t  2to(m3iudlp  mnvtlt aruau poo4opeo ietlslm2emuvp () rtrxo oadfm e nei;s0 rurxmpnu1omenmfcs tfsrta(roou4tpxn f3iytfa2rl(mpnt)arxnifciatlpD lnvi t0setmir oy1omt mnctl(  Duau  ;t0olxnifetldlaDrlnvo u4arenircoodoateau slt0trxoxr3iudlm emnvtl(fa2ua( ont0aex  ieiys s uanvs;()trtrxo3oytoa  lnvolt)trxm(o nu1amtelietls) rrm(rp;o4tpxn f3tas mDran o;u4 rxrmrctatlaDelues;t t2xoio iudllte icsls arurxmo;o0optoiociys m2ranmp;()aleoir oa1fpD  n s t)setrio3oodalt micsl(  Dumxr ou0tlx mfciadfs2eanmp;t0teermf3oydlp r n o;s s2xoim3io4ll n icsa()aruaum nu1opx  ictatla emums u) exnxo tadlpDrli i;()trurxm iudomt lnvsls sDuaur ;t0oexo o3tldfs el( p t4 leoir oodla   u s;s s2xo(rpnydomtnlfvtl()arra(r no1opt if3iaslm uluvp;u4trenmf3iotlm r ivolt)trtriopoydomenlfeilt sDrmum ;t0aetniiciyd a2umu s;t)arxomo iatopDelu s;t0setrxr ou4apt  ietat aDrmumono4tlx mieiys s uluvp;u) renxrcoodoa rauvilt  exmim iu1op  lnetas) Duaur oo4aeto oeilsfm rm( p u) rerxo iy1la e i o;s0srxr(opnu4omtemietlsfarrmu oot0olxn oeilt a2rmumsn(4 eerir iatlatrlnvi t0 2umxo oydop e neil( arumu  oo4teto fciadlmDrl(vpn(4trenxfcia1op rai o ()s2xoirpnodllen iesatfsDrmxm oo1tltnifeils m2rm( o (4arxrmo3oo1lat li o;(  exoirpoodoptn icslt)artm( p;o0alenmo3iasfa2umuvpn() exoif iodoate ivs ( t2xm(opoy4amtemncs sf 2rm(rpot0tpt mf3iyd s2rau p u0aexomocto1fpte uvol() etoxo ou4al nlnciatf rua(mo;t1tleniociys m uln snt4arenxrcoodfm  luvs;s s2toxo ou1amee fvtlsfsDtrxr no4opx iictld mDea( p;u) lenmf3tatlm r nvils0 2xrirpio4ameemncsl()artmxr ;t0apen oeildls ea( p;t0 etoxo totom e iesl()t2uoxr oodap n ietls srurxmp;t4tltniieiatfmDulums t)alxrmr3oadlpDelneo ( srurxrpny4optn ict t)arumxmpoo1aetnmieias mDulums (0arxrmr tytlmD au s;s srumir3oy1oltnlnei tfsrrrx ono1ope  o3iysfm2emu o t) reoir3iydlm elu i ( s2urxm3ny1lpenlncslt)s2rrumpot0aetn ieiadfa umuvsn() reoio3oydlm  aueolt seuoir3iy4om emncil(f Dtaur ot4opxomi3iltls2ra(mo u4 exoxrcta1op eai o t)t2uriopoy4om nlfvt s srtmx  no4oexo feiyt m2umn pnt) ltomo todfmt lnvo s srtoxm3oydlmtemfeils) Dumxrono4olx  i3iyd s2rmu o t0 lxnxfcoy1faDr ies;t texm(m3ou1ape  fesa(f rur( pno4olx  ieiadfs um(mpn(0tltnxfctadlm eai ols0teto(o iudll n fvia() Duaxmpno4tpxomfciad sDua(mo ()trxoir ootoa rlivi s)seuoirpoydlpenlici t srtaxroot1apxnii3iadfaDrm(vsnu)treoircty1lpDr u slt t2xoio3iu1am  licil()s2um(mooo4aexn ictltfs ran s u4 lxomr iatfpteau ols teurir3iy4ole lncsls  2ra(ronu0apt  o3tytfs2uau pn(4tetnmr oydfm  au i s truoir3ny1aptnmivs ()a2tr(mo;u0aet  ieiadfm eluvont)tlerxo oo1fm eau ols  rxoiopou4lptn fvsls)aruax o;t0olt io3iyt a2rl(mp t0aleomocio1lpDe u ils  2xoxo iy4lle livta(f rta(mo;u1apt mf3iydfs2rm(mp;(0alxrxociy1lpDr ues t0s2toxr nodop   nctlt srtru  ;o1optnioeilt mDean snu4alxoxo totlp r nvo (0 etm(o3ou1lmtn nes ( s2ur( pot4opxoiocildls2umuvpnu)trxrxo oodopt lnei;s) exoimpnu4am   fcia(farum(mpoo0altomicilsfmDem(msnu4aetoxocoadopD  n i s0texm(mpiy4optelfvt s srum(rpoo4oexn ocias m2umn o (4arxrmr oadlateaues;()sexr(r iu4olt lieta(fa2ta(mpot1tetniieiatfm rmnvpnt0aexnxr3iadfa e nei t) rurxr oudol nmfctl(f 2raxmonu0oltoifciytfs2elnmp;u)arxrircoodlp  ai i ()teurimpnu4amt  fesas  rtru  nu1alen fciltfaDrluvpnu0 ltoiocia1latrln o ()t2trxr no1ap e nvias) 2rm( ono0tpeomoeils m2ul(mo;t0 ltnir iodfptraues;s t2ur(o ny4al emfcil(f rtmumoou4oex iictydlm raumo;u4trtrio3tytomDeluvo (0srxrxm3no1amt lfes s a2rmumpno4altn ieiydfa2em(vs u)trxrif ootfm  lueils0 2tmir3iu1ol elfcs t  2uax p;u1oex  i3iys a2rluvp;(0aeenif oy1optr nvslt s2urio3nydlm elnvt t)artaxm nu0aet mociyslmDemn pn(4 rtrxf3tydop r neils0teuoim iydlmtnlies ( a2umxm ou0apeo i3iad a2elu o;t)tltnmocoytlpt li s;( srxrxo no4amtemnci s)a2rauroot0aee if3iad m ranmo;() eenifctotoatran i;(0s2xoirpnydopeelfet (faDtaumoot1aptnmieiltla elnmp u0trxoiociodlpte ivs;s) 2xo(r3io1olee ivtat)s2uru p;t1aee micilsfs uln p (0texrif3iatfa eln s s)texm(rpiudlmen fvia()arrm(mp;t1oleo fciat s um(vp t4 etoxr3oatfmtrlu s;s)tetmxm3ou1lm nlncilsfarra(m ot0optomiciys s2rl(vs;u4texnifcto1lpD luei s texriopiu1lmtelfvsas) rra(rono0aex  feiydls2el(mp (0trxrxf3ootop   neil()s2umxm io1ame mnet ()srtr( o;o4oltn oeiadfm2uln o;t0aexomf3totfpt  neo s0 2xrimpoudalenlieil() ruaxm nu1apen fcilt a emnvsnu4alxnxoctydopDelu o;t srtmio iydole livsls)a2rr( oot1tlxomfeiatfs2rmnvs;u0 rxoif3oy1laDrauei;t0t2urir3oo4openlneil(  rumurp;u1apenmicildlsDel(vs
\ No newline at end of file
@@ -0,0 +1 @@
+ueils) rxm(opno1om   iei ()srua(mo;o4aetniieild aDranvp t)artnxo3oadoa e ivi (  etrirpoy1lm e iei ( a2tmur nu0apenmoctytls emnmp;t0arxomfcootfm rlueo (  rxmxr3nu1ameelfcsasfsDrr( pnt0ope mf3iltfs2rm(vpnu0 reriocta1omDeai ilt)s2to(m nodop elfcsls  Dur( oou4oeeo f3tldlaDumnvp;(4aexoiocoy1lm  anvi t)s2urxr nu1amenmnvs t aDurxrpnu1aeenmfeiatfs ranmp;t0arxnir3oatlaDrlneol(0 2uoim3iy4omtemics t sDumx ooo0apt ii3ias m2eanvsn(0 lerxo3to1oa rlivs ()teurir iydllenmfvi (farrmu oot0aee ii3iasfaDraump;t0arerir3oadfpDrlu ils)trumim iy1olt  ivi s)sDtm( ont4oexo iciytfa rl(vsnu0trxrmr3ta1lat aneol()sruo(mpoo1ole mneiat  2trxmono0apxo octaslaDemu on(0areoxo3oo1fpt  nvols0 2xrxopoodlmtelnci s)sDraurpnt1optomfciys aDran p;u0altnmrcty1fm  lnes;(0t2urim io4ol elictltf Durumoou1oleo f3ild m2el(mon(0trenxr oytlatrlues ( s2xm(mpiu4oleelfesas)srraxro;u1aetnmoetysfm2emump t)texomf3io1fmD au ils t2trxmpoy4am nmncs (  rrrur ou0teeomfctltla em( o;(0 rtnifcoydfmDeai sls)trtrirpiudamtelnvsas)arururpnt4aeenmo3iytls ra(vont4aexoxocio1oat anvi s texrxm3iy4lmtnlivtasf rurx  ;o1apt mfctytfs2rmuvs;(0alerir iotfp elu slt)t2xmxopnydapen ncs t sDuau pot1aetnifciasfm ranvont0tleomr3tytomDe nvi;()texrxm oy1amtnlfetlt  rtrxrpoo1ole mfctlt a2ranmp;u) etoxf3oatomt anvsl( setmiopnydlmtn nvt sf Duauro;t1aleomf3tyd a2elnvpnt4 rxomf oytomDe ivi ()s2xo(m nu1ape lfcils arrm( ont0aeenif3ils aDran s;t4trxrxf3oa1lmDr ueo s0t2xrxmpoudlm nliei (faDum( pno0oleo i3ilsfs2eau p u4tltomrcoy1lptr u i s)srxoxo ny1apt  fvsas s2rau  ot4tlt ifeilsfa em(vsnt) eenmo totfmD livsls0srtmxm nydll  mieta()artaur no0tpxo oeiltla2eln sn(0aexrxf3ta1fpDeanvi;()sexmxm oy1lme  nes t) 2raumpnu0oltoio3ils sDrmums;u) lxnmoctydfp e u i;s)tetm(rpiy1altnmiciat)artmxr ou1oexo fciysfa ra(vp;(4 eeoio oadlmteauvs t) euo(o iy4lltn ici () Dua(m ;u4tlx ifeiydlaDrm(vs;(4trxrxrcoadlmD liei;t)sruoirpnodopenmfvs s)srrr(mo;u1apx ii3iysls um(mo;t4trtrmfcia1latr uei (0 2xmio oy1apen fctas a2trumo;u1tptn ietadfmDemnms u4tltrxocoytlptr nvols0truo(rpou4oltelfcias)arumumoot4tlxoif3ilsfa2rm(ms u0 ltnmo3tytfatr n o;(0s2xrxopoudlpee nvias)a2tmxront4olxoii3iltls rln pn(4arerxfctytomt aneo;s)s2xrxrpoo1op nlnvi ()a2uaump;t1tlxoioeilsla2eanvo;t) exoio3tadfaDr n o;(0trto(o3oydopeelfvtls s2rm(rpou0ole if3iytfs rln p;() lerifcoodfpte i olt0 2tmimpou1ap  mfesls  Dtaumpnt0oleo f3tldlm2raums ()teenmf3oydlaDeln ils s2xoir3iodlltelfvias)aDrrx p;u4apxnif3iltlaDrm( s;t0 lxrmf3oatlmt anei (0trtr(o oo4om nlfet tfaDrrurpno0aexniietysfs2rm(vp;() lxnxf tatlp r neo t) rtriopnodllt lfvslsfaDtmx onu4olenii3iatlaDuauvs;(0texomfcto1lat  uvi s t2tm(o nydlp nlicilsfs2rrxrpoo0tex  o3tat s2rm( s (4 leomf ty1op eli o;(0seum(r oy4omeemneiltf Dtm(r no0aeenmfciasfmDumumo;u0 lxoif tadlm  li ilt0trtrir3iydale mnvi s  Drmxmono1oexoio3iltfm eauvpnt) ltoifcty1oa raivi;s0truoirpiudlpt mieslt)a2rrx p;o0tpeo oeiydlm2um(ms u)trxnmr io1fp  li o t  euoir iodlmtemfvslsfa2uaumo;o1olt if3tld m el( s;t0alxomf iytomteluvs;t) 2toxo iy4om  lneia(f 2truroot4tee iieiadla2eanvs;t)arxnmo ootla eli o;t t2trxmpno4lmenmieiasfaDtmu o;u0tpeoif3iltlm rmn ont4 leoio3oodlp rlivil( s2xrio io4ape mncslt s2umu p;u1apen ieild m umn p t)tetnio iydfpteln slt0texrxr iudlmte nesat) 2tax  no1aleo i3iydfs2ua( o u0aetnmo3oadlmtrlnvsls)teuoxr3nudalenlfes s  2urxmp;o1olto ocias m ul(mp;u0trenio3ta1fa eluvo;t)s2xmxm3iy4oltn nvtatfsDtmx  nu0aeen f3iydlaDel( p;t0trtrif3iy1oatr nvo t)s2xoxr3iy4llen fct sf rraump;u1olt  oeiydla2eau pnt4arxnmr3tytfpt  i i (0srxr(r iu4omtemictlsf Dtmurooo0tpxomfeiys a2ua( o;t4teenir iotomtr u o;s0srxmxmpiudameemnciasf Dtmx pno1aee mi3tytls2ul(vo;t) lxrir3ia1fp eanesls) 2triopio4ap  mfei s)s2ta(ro;t0apxoifetytfa2rm(monu0texomocoodlatraivs;( t2tr(r3ny1ape  fvtl() Dua(r no0tpt ioeilsla2ul(ms;() exnxociy1fpt aivo ()srxo(r io4omeelnct ( a2rm(mp;t1tpxo o3tldfa2rmumont)artoxf ia1fa elu o;( s2to(m no1am nlncsat) 2urumono1openifciys m2rm(mpnt)tetrxr oa1op   nvo (0 2uo(opoy1lm  lnct sfa2rmum ;o4tleo i3tltfaDrl( pnt4teeniocia1lmte uvi;t0 rtr(mpio4ol   fesls s2tmur ;t1aexnmoeiydls2ua( o u0 reoxo ootfmtraneilt truo(o3ou1lp nlfetasf 2um(rpnu4aeeomf3iyd a2rmumo (0altoif3oodlpt au i t sexoxr3iodole mneta(faruaxroou1olx  ictasla ranmp u0arerir3to1fa raivs () etoio iudlmt lnciatf Dtmxrpoo1open o3iydfm2uanmpnt4 etnmr3ootlm elnvo s0 2trxr io4al elnvtltfaDtru onu4tpx mo3iltlaDeanmp (4artomf3oodfptr uvols0trxoxm oudomenlfes t a2ta(ro;t0ope moeildfm ua( on(4 etoxf iatfpD  u ols)sexmir oydlltn fvta(farrrumoot4opx iietytfa rauvp;()tlenif ty1lmt aueo ()s2umir io4ope lfei s a2trxr ;o0olt  oeildls2rlu onu0tltoxrctytoa   n s;s)trtr(opoydamtelfcsat)srurxr ;o0oetnifctysfaDrmnms t)tetnir oydom eluvo;t) euo(opoy1ap elivils  Duau oot4opxo ociasfa uauvp;()texoxr3iotlaDe ivi;s0s2xrim ny4lltelnctat  rrrxrp;u1tpe ifetytfs2uan p;t4artnxr3iytfatr iei;(0 etrxo ou4amtnmfcsasfa2ta( oot1texnmo3iatls2rmn s;t4 ltoxr iytfmDelies t) 2to(o3iu4omtemfeiltfaDtrx  ot1tpxn i3iys m umumsnt4 rtrxo iotoaDeluei;(0 exmir oodole  nvtls arumurpnu4aleoii3iadfa umnvo;u0texrxfcio1lmDe nes t teumxo no4llte iesltfsDrax pot4olxo f3ilsfs ea(mo u4trerif3iotomDr nvo ( truo(m3ou1lptelicsasfsDtrumpnt0apt iieilt a2um( p;t0 exrmr3iadlaDraivi t0s2umxr3iodll nlfeslt)a2uaxrpou0alx mieiatfa2el(msnt4trtrir tytfpteaivo t)s2xm(rpoodomte fetlt)sDtaxrooo4oleomicildlm ranms;(4 etrio oatfa r uvs ( s2xoxopny1optelfci (f Dumumpoo1oexniiciad a2uauvon(0 exrmr3oytfmt  u ils s2urir iodlmtnlivsasfsrumxr ou1alxo i3iydfa2ulu ont4tltnxfciydfm eliei;s  euo(r nu1llt  neslt) rta( o;u4oeto ietldfs2rm( o t4tltrxociydfpDeaivs s  eum(o3iydlp e ivilt) Dtrxmooo4aetn octydlm eln o t)aleomfciy1oa  lnes;t)srtrirpno4aptnmicsl()arumur ot1oet mociatfa2ra(vo u4 renio to1fmteau olt)t2toim3oydlm elncs s aDurx  no1tpxoioetad mDea( sn() lenxf iodlmtr nesls srum(m oo1op  lncsa() 2trxr ;t4olxo o3iytlaDrl( sn(4alxnxfcootomD lu i;(0teto(o3no1amte fvi s srra(rp;t4tee moetadla rmumsn()treomo3to1oa r ueolt0 rtm(m3nudoleelies sfarrr(mooo1tpeoifctld s2rau p u4 eeomrcoatoptrai slt0trurxm3ou4amenmnes s)aDtr(mp;t1tlt ifetatfa um(mo;t) lxrxocoodoa rlivo s t2toxm3oo1amt mfvtlt)a2trur nu0tetnmiciysfm rmu on()texrir3iadoat  ies t)trtm(o ny4amtelfeiat arrmu  ot0altomfeils a2uan s;u4 lxnircoatop  aivsl()s2xmxo3io1lp e nvt s)sDtrxm ot1aptnifciysfaDranms u0aetomf3oa1fptrluvi;(0teum(opio1ll  livsas srtrumo;o4ope iiciatfaDemnmpn(0tltrio iydfa   i ols0t2uo(r io1am elneta()srrmx ono4tptnmfctltfsDemnmsnt4texrmfcootoaD ln ol(  rtoxo iu4oltnlfeilt) 2tmu pno4texn oeiaslsDuln sn(0tlerioctytlmD  ivo;s) ruoiopnu1al  licil(  2uaurpou1tex  ietydfm rmu pnu4 eenio oatfpDeliesls srxr(m nydlleemietls)s2rm(mo;u4tlxomo3tytfm2ul(ms;t) rerxo to1fmtelnvolt0sexrio io1ap  lnviltfa2tmxm ;t0oltomieiys a2ra(mp u)tetnmf3ta1omt aies () 2tmxopno4lptnmfvsa( artr(ro;o1apxo oeiyslsDea(vs;u)aetrircta1lat an i;t) euoio3nodlm elfviatfa2tmurooo0altnmfcilsfs2rmn pnt4arxomo oodoa r ivilt srumxopiodlm   fvtlt srraxmp;o1tltoioctysla2ra(mont)treoxfciatop  lueslt teumir3oo1lpeemnciltf rrr(r ot1apenmoetlsfm2ranmo;t)tlxnxr3ty1fat  u sl( t2umxrpoudlpte fctlsfsrtmxrpot0oexn f3ildlaDemn o;u4aetrxo tydlm e u o;s0 ruriopiodome mnvia(fs2raxmo;u0oetomfetaslaDeauvp (4altrifcia1fmDeln o;t sruoio3iy1apt lnet tfsrtmumooo1aexn ieiysfm2emums;u0 lerxo io1oatelu i s0tetmim iudal elnvsl(fsDumurp;u0alx mo3ild m ean sn(4 ltoif3iytfpDranei;( srtmxm3iy4lmt mnvtl(  rur( o;o4aexn oetas m ua(mo u0 etrxr oy1fmD aieols0t2xm(r ny1ll  mnvsas)a2tmur no4tlxo o3ils aDelump;t0arxnifcio1lm elivs;t0 ruriopno4llt  ncias) rrm(r ou0tleoiiciltfs rlu o;t4 ltrxfciatfptrln sl( srxoxrpou1lpee nes ()a2trxro;o4tltnmf3iatla rmuvo;(0altnmf tatfmt  ues t)seurio3oy4opt livs tfa2rrx  no1olxn ociysfaDrln p;u)trtoir3iatlatrli i;()setrxopny1openmfei t) rurumpoo0ale miciydfs2ua( on(4 renxrcia1lmDe nvo;(0 rtoir3oo1am   fvs (f rta( p;u1oeeoio3iltfs2umums;u4tlenmf3iotlaDraies;s  2tmim oy4om nlfvs s)srrmx o;u1altoifciytla2umnmont0tltnxociadfmD aivo t)srxoir3oo4alen fei sfarrrur no1oltnmo3tatls rln o;t0 rermf3totlmDe i o;s)t2umimpio1amt  ictlt)aDurur nt1tlxnif3iasfaDra(vp ()tltnmfciytlmD luvi s0srxr(o3oodamtnmivtl( a2rau p;o4tlx ioeiadla2ul(ms u0teeoxo3io1fate nesl() etrio3iodalee icta(f Dtmxro;u0tleomoctatfaDrmnvs (4 lxoir3iydlat  ivo;s0 2trxm iu1alen fct t)srrm(mpoo1opeomoeild mDelnvs u)texomfcoadlp rau il(  2umxr3oy1altnmici sfaDurxr ;t4ope ii3iyt m2emumo ()aexnmf oodfpDeai ilt)srxoio no4lme mivtatf 2rrx pno1tptnmoetldfs ean s;t0 exrxo oodlptranes s)sexo(o3nudaptelncia(faDta(mooo1tpto oeiadlmDumums (0aetoxocoo1lp r ues;(0srxr(o3oy1al n icil(  rtmum ;u0olx mo3tydfsDuan s u4 etoio3oytlmtrln ol( setr(m oo1lmtnmfcta(fsDtmx p;t4aetnii3ias aDra( on()alxoxfcoydfa e neo;t  rtoxm3oy4lmtelfei (fsruaumpot4tlenifctys s2rm( snu0arxoir3iotlatr u ilt sexo(m ny1lp nmnesas) Drm(mpou0tlt moeiatlmDrm( p t)tlxrmoctydomDelnes;(0srxo(o no4aptnlnvsas srtr( p;t4oexniictld mDeanvs;t4alxoircoa1fa  an o t t2xoxo no4lleelnviat s2uax oou1tee ifeiys aDelnvonu0aexnmfcoydfmDrai ols trxmiopnudapeelnciatfsDtmxrpnu0tpx ifctadlsDrau pn(0treomf3todfat aneils) rtoxopnodoltemieiat)arrm( pou4tpx ifciyt mDranvp t4alenxo iy1oaDelu i;t)s2uoxmpno4lmt lietlt)aDumuro;u4apxnmfciysfa2uln s;u4teerir oy1omtrlivs t)t2xoxr no1al n icsasfa2tr(moou0aeenio3iysfs ra(vo;t0areoio3iotfm raivo;(0teto(m nudlpe lnvta(  Dtr( ooo1tlxo ociatfm2ranvs u4aetoxo3ty1lat anvs s)tetrim3nodolteliei tf 2rmxm ;u4tlt  feildfaDran snu0 eermr ty1fpDrlivo;s0trtrio3oodap  mnvias)aDtmxro;u4opeomieiltlm2rmnvsn()areoxr tatla ranei;( t2to(m3oo4olenlietl(fa2tr(mo;u0ape ifciasfs2emnmsn()arenifcoytlmteauei;t tetrio3oy4lpe livsatfs2rrx ono0tptniieiltlaDem( o;t) etnmfctydfpD au o;s0teto(opoo4aptn ncs t)arrr( ooo1alt  feiasfa rl( on(4teenxr tatfmte ueol(  rurxr iu4opeelictl( artrumono1aex ii3iatfm rmu o t4 ltnxo oydoptraivils0s2uoim3iodlleemfct ()srtru  nu0apto oeiltla2rmumsnt4 leriocoadfpD  ieo t teum(r3iydale  fvtas)aDta(mo;t4tpt  octld s2rmump (4aetoio3oa1la raieolt) rxoxm3iu4op emnvil(f rrru o;o0oeeoiiciltfm eluvp;t)aexnmr iydlpte u il(0t2uo(r iu1ol  mictatf Dururo;t0tpto ictatlm2rauvo (4aexrxo3to1faDran ol(0teuoxo iu4lmtnmiet (fs2taumo;u4oeeoiietytla rlums;(0tltrmf3oydomt lneils  rtm(mpoodll  mnvs tf Dtrxm oo4tpxomfetlsfa emn p;u)arenio oatoptelnvi;s)s2urxr oydopte fetl()sDur( pno0aee mietysls2ulump;(4tlxnxr oy1omDr uvsl(0 exrxr3ny1amt lfct tf rum(m no1apen ictatla rmnmont4aetnmrcoatlm eli i s0 2xm(opoo1lp   ics s)sDuaxro;o4altnmo3iltfs elu sn(4 eenmrcty1lmte ies s0trtr(r oydlme  fcilt  Duru p;t4tle iiciys s2elu sn(0 reomr oadla  ai o (0s2um(m3iu1alte fcsl()artmu  ;o4aetomoctytfm um(mp;u) eermr3io1oaD aueols) 2uo(o3nu1ale lnvsa(faDumx ooo4alxnioeiydfs2umuvs;u4 lxoif ty1oaDe u sl(0seuoxopiydale mfci (fsDuau p;o0teeo octysla2ul( p;u)texomf3ootoate neo;(0t2umio3oydlmt lfvi s a2rrxm ou0tlxo ocild sDrl(mpn() lxnifctadlat  nesl()trxr(m3nu4apee fesltfa2taurooo0tpen octydfm2elu p t4aeenir3oodomtelivil() rum(m ny4oltnmnct s)aDra( oot4aexnmfetasfs um(vp;(4aexrmfciy1fateaiesls t2xrxmpio1llen nciasf Dua(m no0tlx  feiatfa rau p;t)altnmf iatfa   i s;s0seurxr3iodol nlici s) Drmum oo1tet mietat sDulnms t) etrxo iatlpD  i i;(0 rtmiopiydopenliei tfsDraxm ;u4aetomi3iysfa rmu p;u0arxrxf tydfmDrlu o t) 2tm(m3iu4lp elfvs ()srrru pno4tlen oetas mDrluvo u)trxoir oadlptraivil()t2um(r ou4lp elfetl( a2umuro;t0aeen oeiytfa2rlu s;(0aleomr oy1fm e n s ( s2um(opoo1apeelfviatfsDua(mpou1aexniictlsls elu snt4tlenmo3oa1optrli ilt s2trxm3io4al nlfei t) 2rmx pno0tpx ii3iyd m uln s (4 ltnxf3oydoa eaies;s0trtr(mpiodopenlfesa( s2tmxr ot1tex iietlt m ulnmon(4trxrir ty1omt  u i;(0t2tmxm3ou4ll n icta( s2umur no0apt mfeiasfa2rl(vs;t0aleomo3oa1omteauvs;( srtoxo oo1ol  mfetatf Dtmu poo4tpeo fcias mDrmn pnu0aetrxfctatoa rau i s0 2to(m3nodlm  licil(fsDurx  ;u0alx mietlt s2ulnvo (0 eeoxf tatomDeauvo;s0s2tmim3iudlp nmfcta()aDra(rp;t0tlenmfcilslaDuanmo;t0arxomo3oatlp ran ilt0teumxr nodlmtn ieil(faDuax ono1aetoio3ias s2ulnvonu)tetoif iodlmDeai o ( trxoxm3io4apeemfesa( s2uru  ou4oex  iciad s ranvp (0tetrmf3oatlp r uvi ()s2toimpiy4lme mnvtl(faDumxro;o1aptoif3iyd m emnmo ()arenmo tatoaDelneilt)trxo(m3oo1llt lnes t sruax  ou4aex io3ilsfm rl(mp;t)trerifciydfa e nvi (  rtoxopio4apte fetls)a2rmx  nt0oee  i3iydlaDel( snt4artnif3iadlpteaieo () euoxrpiu1lme mncia(fs2trum ot0open octydfaDem( s u4 rxnxrciydlmDraiei;s  2ur(o3iy1op elfet (f rrm(m ot0tle moctadfa ranvs;t)texrmf todoatr nvo;s)srurio3oy1ll nlnvias)sDrr(  ;u4oexn fciad m rlnvp u4 etrif3iy1lmD  ieils  rtmim3nu1lpeemfcilt)s2urur ou0apxomi3iatlm2ea( pn(0tetomr3tadomDraueo;t  euoim nydomte iesls sDtaxrooo1olt mfeild a uau o;(0teeoxfctydfpD ai s (0s2trim3no1ape lfvs sfa2trx p;t4oet  f3iadfs ua(vp t)trermf iodoptelieo;s  rxmxr oydam nmnesat  rtmumoot1tlx  ictydlm emuvs () exnxo3iadomtrlneslt) 2xrxr no1amte ictas arrrur nu1tltn fciadfaDulu snt4aexoxr oy1oa   uvs;(0t2uoxr oy4ll   ici ()artr(mo;u0tetomf3tatfa2emuvs (0arenxo3tatomDr nvil( truoxopiydomtn ivtat)aDtau poo0tltoif3tld m2elnvp u0tltrxo io1fmtelueo t) rtoio3oy1lmenlieils)arumx p;u0alx moctlsla ul(vs u0texoif3ootlpt  i o t0trxoio no4ale lneiat) rurum ou1ape  ocias a ulu pn()aexoxf iotlaDr uvils0 rxo(o nudome  fvi s a2ur(m oo0opto fcildfm2rm(vo;()tltoxr tadlmt  ivslt) 2um(o3nu1apte fcsls)sDrr(r no4tet  feiltls eaums;t4trtomf3oydla eaivs;()teto(m3oydapeemiesa()arumxmono1tlxomoetld mDranvsnu0alxoxfcootfptean o;(  exoimpiydaltnmnvil( a2rmump;u4alt  oeiadfmDumuvp u)alxnxr3iatomtr nvi s)seumxopno1omenmnvsltfsrua(rooo4aleo octyd aDraums;t)aexnifciy1oatraivilt0t2xo(o3oydame  icslsfsrrrx  ou4tle if3tadla2em(mp;t0tlenxf3ty1omt auvi (0s2to(mpoudaleelnvilt  rur(rpno4optn f3tatlsDum( on(0aetnmf oo1fm eaivi t0trtrxr io1ll nmnesas)a2umxm nu0oeenifctys m2ranmpnt0 eerio iadomDraueol(0trumxopno1lpe mnctasfa2umxrpnu4tpx moeiasfm rmnmpn(4trtoxr oy1latr u ils  exm(o nu1op   fct (faDtr(  nt1opeoifetyslmDuln s () renir iadom rai i s) 2um(o oudameemfvs s) rrmum nt4olt  ocias mDel( s;u)treomf tytfm   uvo t0trxrxopiy1omtnlfes s) Draxmoou4aeeomieiatla2eauvp t)tlerxo3oodfmtelu s s)s2xoxmpoo4ome lfeil( s2rm(rp;t1alxnifctydfs ea( o (4 rermo3oa1fpD an i;s0truoim oo1oleemnvilsfsrua(  oo0tptn feilslm emu p;u0treomf3ty1la  lues;s truoimpio1amtnmivsl(fa2urxrpot4apx iietadfm elnvsnt4altrxr3totfmt aivsl( texoim iu1lpeelnctasfs2ra(mp;o4aexn i3iltfs elu snt0tltoir iy1lmt ln i ()texmirpou4omen ies s aDrau oou1aetn icias s2elums u) rxoxr oytop e nei;s)trxoim3nu4lmt lnvs sfsDurumoot4olxn oetatlsDrlu o u)artnmociadlptran s ()texm(r nydolenmfcsat a2ururoou4oltn octydlm ulu pn()tetomf3oa1fm  anvilt t2um(o oo1ap n fviasf Dururp;t0oeto fctldls um(vo u) exoxr3iatoaD an ols sexrimpiy4ol e fes s  Drr(mo;o1opxnmo3iatlm ea(mon()tltnmfciadlmtrlneil(0tetmio3oudam nmnesas)sDtaxrpnt4opeomoeiysfa rau p t) rtrxf oytfat ln o s0trxriopnydll  mnviat)arumu p;u1olenmf3tys a2uauvp u4aeenxocoo1fmt auvs;( trxmxr3oudaltn ict s)sDumxrono1opxnmfeiasfs2rmumo u0trxoif iydopDrluvo s)t2umimpiy4lle  ivtl()artr(r ot4opxn ociysfm ulums u4aexrxr3iy1lpD aieo t)t2umimpiudoptnlfcs t) rtrum ot1apx  oeild s2ra(mo;u) lxrmrcty1lmDr u i t0t2tmim io4ameelneilt)aDuau  ;u1altomi3iltls rmn p (4tltnmo oy1omD li o s0seuoxo nu4lpe lncias srraxmoou4apx  i3tldfs em( p (4arxoxf tydlat  n s;s)t2xm(r oo4lm n neia( aDrrxm ou4tlt mfetadla2ulump u0tetrmo3tytopDraueol()srur(opiydolte icsls) Dururp;t4tetn ieildlm elumo ()arerxo3to1oateauvo;() etrxmpno4apt mivta(fartmx  ;t4aptoiociysfaDelu s u)altrifciodfaDeanes s0sruo(opny4ame lnvtl()a2uaxrpou0tlt moeiasfsDuluvp (4aetnxf io1la elnvi;() rxrir3ou1lptemieta( arrrxr oo4optnmiciytla2rauvo;t) etrxf3oatlp e nes;s0teurxr oo4openlfvilsfa2ua(rp;o0aeeoii3ild s raumo ()artrmr3oodfp   nvo () eumxmpoy4lmenmnct ( sDtmur ;t1ape  iciadfs2rmumon()tlermo iodfa  auei t0t2to(o3iu4apte nvsasf 2umum ot1teeomi3iydlmDeln s;t)altrxfciodfmD auvs;( trtr(o3no4lm e ncia( arum( o;o4tlt ioeiyt a2el( p;t0 rxoxf3oodlaDrau ols) 2xrim3iudlltn ivsas a2ur(roou1aleo octadlaDuauvs (0aetrxo tytoat lu i ()teurxm io1open fvt () 2tmxmpoo4tpe  fciaslm2rmn snu4 rxomf3oydlmD  i ils) rumio3iy4ope lfvsasfaDtm(mp;t4tpe ii3iatfaDrluvsn(4alxoxr3oatfm  ln i (  exoxrpio1lltnlfeta()a2tru oou4opxo octat s2uan o u4alxrmoctodomte u slt)sexr(opnodom  mnvtl( sruaurpot1tltniieild s2umnvo;t4texrmr3oadomDeli o (0sexoxrpny4aleemnesls)arrmur ot0olxomictas sDua(mo (4 rtnmo iatomt lueo;() etoxr iu4ll e feia( s2uau p;o4tpx ioeild a rmnvs () lxnif ta1lmD au ol( t2xmxr3nydop n netltfa2ra(m ou0oleo oetlsls2um( s;u4arxrio3oa1lptrau o;( s2uoxopiydamee ies (fsDtauroot0tpeo fctysfmDeau sn()arxnifcto1omt  i i t0s2umxo3iu4amenlivtl() rtaurpou4open o3tldfm um(ms u0trxnif3tatfat lneol(0s2xrir3io4openlnvsat)aDtm(monu0altnmietlt a ranvpn() rtnif3iadfmtelueo;(0seuo(rpnu4alen nctl()s2uau poo1aleomfctas m2ua(vpnu)tleoxfciy1fpDe i ol() etmim3ou4op  livi ( srumxrp;t0tptoio3ild s2rauvs;t)alenmf3iytlp r u ols s2xm(o no4lp elfetl()s2tm(  ot0apx iietatlmDea(msn(0tetomocoydfaD lneo () rxo(m no1om  lncia()s2rmx pou1tlenmf3tlsfa uan on(4texnxr3iydomt ln o;t0teurio io1ll n fct tfs2rm(m oo0altnmf3tas aDranmsnu0tlxomr totlmDelnvi t  etrxopiydomt lfciatf Drmxr ;u0tlxn oeilslmDrl(ms;(0 renxo3oadlpte n sl( srxo(opou4opt  fcta()sruru  ou4aleo ieiysfa uanms (0 rxrmf oa1lm   u o t  rumxr nodaptelnct () Dtaurpoo1olxo octlslsDul( s () rxrxf oytfaDr ieilt  2tmim nu4amenlnet t aDuax  ;o0alxnmieiyd a ua( o u)altrxr3iotfatelivi;t  2xr(r no1ame lieiatfsrurump;o4tpeoiicildfm2rm(mp;t0 eeoxr3tydfp eaieols0seur(mpio1omtnmnesltf 2rmx ooo1aeeoiieiysfsDrlumpnu)tltnif3ia1fateauvol( trumio ou1omenliviasfaDrm(m no4tlt miciltfs2um( onu4arxrxo totomDeaiei ( s2umxrpoo4ap elfeia(faruau  ;o1oeeo o3ilsls rmn snt) etoiociatlptrlivi s  eumxo iudameemivsa()sDrr(  ou4olen o3iydfa2umumo;u4tleomo3iodfm  aueols teuoim3oo4om   fei (farta( ono0tpe ii3iys mDel(ms u0artnif oydomDrln i (0 rtrxo nu4olt lfeils)a2tmx oou0olxn f3ilsfm rmuvpnu0trtriocoatoatrai i;t)t2um(opou4op elnei s)srumxrpoo1olxnmiciyd s rmuvs;t4arermo oadfmteau ilt s2umir3oy4op eliei () Durx  ;t1aeenio3iad a eanvo;t)arxnxfcootlm   uei s0s2tmxopno1lle mnvil()a2rauront4apeoif3iatls ea(mo;(4 lxomr3tytlmDeanvs;()t2uo(m3iu1llt  fcslt sDrrxrp;o0aptomi3ilslm umn onu) lxrif todfm eli ils srumiopou1op  livsasfa2uau pno1tetnmf3iadls2eanvsnt0altrmrcoadlm elivi (0sexrir oudlp n nvtlsf rtaumo;u0tpx  oetaslmDea( s;u4 eenir oadlpD auei;s)teuoxm oo1apt lnci s)artmxm ot0teeomi3tad mDem(mp u0tltnxocoa1fpDranei t0 exmxo oo4alt lieiat sDrrumoou1tpe  f3tysla2ean p;t4tetnifctydfpt luei t) ruoxo3oudamt  feiasfsDrmurono0tlx mi3tatlm2umn onu0 lxrxociytomD an o t srtmxopou1olt lnvil( s2ur(mo;o4aleoifeilt s ul( o;u4 eerif3ta1omDeanvi s0t2toirpiu4lpt lfetas)a2rmx poo1opt  oeiydlm ea(vs;()trtnir oydfaDeaneolt setmio3ou4lleelnvtasfs2rmu  oo1olxn octatfs ra( on() ltrmrcty1lp eliei;s) 2xr(m3nydopt liciat)srumx  ;t1oleomfetyd aDranmp t0aetrxfcoy1lpDe ues;( s2uoimpny4am nliei ( a2rmurp;u1opeoif3ild a2em( s;u4 etnifctotfmDrlues s0sexmxrpnudomt mnesls  Dta(  ;t0tetn feild m2rmn p t0tetniociydomD lu ol()truo(r oudop  mnvia(f Durx ont1apxn ieiadfa rl( onu0tleoxrcia1lmtr uvsl()s2umirpoy1op e fesa(f 2raxm ;t4tptnmoeildfmDemu ont)arxoiocoo1fm  lu ols)texoir3oo4altnlnctat arta(mont0oltnio3ilsla ra( s () rtrmo oytoaDrlivs t setm(rpno4olt lfet s)srumxrp;o0tle mieilt m ea(vs;t0arxoxf3oytfmtelu s t seumiopio4am emfcsl( s2rmx pnt1opeomicilsfs el(vp;u) ltnmociadfpDraivo;(0s2tmxm3oudol elicslsfsrrr(  ;t1opxn i3tadfm2ean snu) exrio ootfp  aneil(0tetmxm3nydlptnmnesl()aDuax  nu1aexnif3tadfa2ranmpnt) etnio io1lptrluvols  2urxmpoy4al  lnvt ()s2rmxrpoo4aeto ietyt sDrl( p;t0arxnxrctydoa rln s () 2to(o nu4ll n ivs (f 2taumonu4olx mi3tys aDrmn s;u)arxoir iatlmteaivil(0sexoiopou4lp  mfet s  rurxm nu0alx mfeilsfsDrlu o t4alermr3tadlm raueo;t0trxr(o3iy1ame lnctas artrumpno4alxnmoctysfm eauvs u4texoxf iatlm raieo;(  eurim3io1amtelnvt t)s2trxm ;t1ape mfetadlmDeanvs u0texnxfcoodom e uvs s0s2xrxmpoy4lltemfesls artmum ou4apxniieiatls ranmon(0texnmo oytlaD luei;t  2trxr3oo4ll   icsasfsDrmurpou1ole mieiysfm2umn ont4 eeoxr to1laDelues;s0srurio3oy1oltn nvt s) Duaur ot0opt ifeiytlm eluvs t)aeerxfctodfa   n i;t srxr(m3iydaltn iet () ruax oot4oet  oeildfa rl(vo;() ltoirctytfptr u i;s srtrim3oydomenlfvils)srtm(m nu4opxnifciyt s2eanvo;()artrio3oodomtran s;t)srtr(rpoy4omenmiciasfsDra(moou1aee mo3tls s2eauvsn() rxoio tydfmtrlieo s) rum(o nodlm n nvsa(fsDum(rp;t0aexn ietlsfa eluvsn(0aexnir3oo1lm elieolt0texo(o ny1ame mics t aDra(mono0oet  i3tltls ul(mpnt0aexoio3oa1fptelu ols) rurxrpno1ameelnviatf 2rmx pot4aet mf3ilsfmDumu snu4 eerxf3tadfmDe uvo t trurir3no1altnlies (  rumxm ;t1oetomi3tas mDemu pn() rxomo3oatlpt au o;s) rxr(m3iu4lpenlfvt (fs2umx oot0alt ii3iyt s ulumsnt0trtnif tatlmDr i ols  eumir ny1olt lictlsfsDurumo;o1opt  o3tadfm2ul( p u0areoif3tatoatelnes (0t2trimpoo4ol n ict s) Drrx oou1apx iociasfm emuvs u0arxrxo to1lp eaueo;t)tetoir3iy4lltemnet t artrxmo;u1alxn i3tltlaDemu pnt0trenmfcootfm rauvs (  rxmiopnudlme lfvt ()a2uaxr ot4aptnmietadfa uauvo;u4trerif oy1la e u o;s texoxm3ou1oleelncilsf rtaum ot0altnmi3tltlm2ran p;(0tlenxociodlm r ieslt0teto(m nydalt lfvi tf 2ta(mono1tpe mietytlmDem(vp;(0tlermrctotfateauei;s)trxr(o io4alenmncs s)srumurpnt0oet  ictltfaDrln o;() eenxf tadfptr ieo t)srto(m nudop e fesas)arumum ;o4tpeo i3tatls2emuvo u)alerxo oy1latean slt seumxmpiodoptnlicia(fs2ta(moot4apxomf3tytla raumo u0trxnio3oadfpteanvslt setm(opou1ll   fcias  Dtmxrpoo4apeo octltls2emuvpnt)tlxnxo3oodfaDeliei (0teuoxo oo4am e nvi s  2tm( p;u0oexomieilsfa eluvpnt0altoir oadlmDelu o (0s2uoxrpny1lp  mnvta()aDtaumo;t4tpt ii3tadfm ean p t)alxnxfcto1omDelnes;t) rtm(mpno4ap n nvsls s2urumo;o0oetnifeiytlsDeanmon(4 eeoxociydfm ean ols t2xrxm3ou4lle mnvsl(farra(mono0opeoiociadfa2rl(msn()alxoio3iatoat lues;s  exmio3iydol elfcslt)srrm( pno1aex iociytlm uan snt0tltoxo3tadfa rai sl( sruo(m3iu4lmenmnctls sDtruroou4aetn oetlsfa ra(mp ()texrif oydoatrlnvolt)t2xmio3nu1lm   nct s  Dtrumo;o0tle  ociyslsDrm(msnu)trenxfcoadlaD lu s;(0 rumxopiodol  lfciat) Dra(rpou4tpx mociytfsDem( s;t4 eerxfcoy1la r ueols0 2to(m3io4olte nciltf rtm(m ;u4aet mieias aDra(monu4altnio oa1laDr neilt trum(rpiu4llenlivt (  rra( pou0oexomoeiyd s emn o;t)tetrmrctotopt ln o;t srxr(o3oudaptnmfvia(  Duaurp;u1tetnmf3tadfa uluvo;() lxomo3todoaDelu s t0 etmxo ny1omeemfesl( a2rrx ono4ale mo3tys m eanmp u4tlenio3totlate n i s0 rxoiopiy1lltn feiltfs2urumpno1oeeoif3tatfs eanvo u4tlxnxo iodom e i o;s)trxmxrpiy4om  mivs () 2rrx ont1aexo octlsla ran o t4trtnxr iy1lmtraies;s)trtrxmpoo4lpt mieilt) Drrxr ;t1alxoio3ildfs rl(vs u4tlxnmrcta1fpDrlnvslt  2umxmpoo4apte netas srraum nu1opt ioeildlmDrlnvp u0altrmrciydoatelnvo s0t2xm(o3iy4olt  netatfaDtaxmp;u0tex  oetldfs ulu pnu)texnmf3oy1fpt  ieo s) rxr(o3iu4ap e fvtls aDum(r nt1oeeoiociysls2rluvs t4aetnifcia1laDe ues (0srxoim nodaltnmfcs t)artrumonu0olx  fctls s eau s t) rtrxociodoaD luvo s0 2tmxr io4olt  fci t) rtr(r ;t1olt ifetasls rlums u0aetnxociy1om eanvs;( trxo(m oy4apt  neta( a2ua(mont0aex  fcilsls raump;u0tlxnxf3iydop rlieol(0seuoxmpou4llt mivi tf rraumpot0tpx mi3iadlmDrmump;(4 etoxf3oy1opD ai olt)srtm(o3oydlme mfvt tfaDrrumont4tle io3tytfmDumuvsnu)teenif3oatfp   n s s)seuo(mpou4op nmfvs s  2tm(mpnu1texoifetytla ea(vp ()tetoxo3iadlptrauvs t)truoio iydom   fvta()artruro;u4opxnifeiysfm2elnvo;t4 reoxrctytfm   i o t0s2toxopny4lpeelicsas  Dra(  no1ole  fctasla2rau o (4trxnio todom elivol()texr(m io1ol nmfcslt  Drmx  ;o4tetn f3iasfmDea(vs (4 lxnioctydomD  ieil(0trxm(o iudal emictlt)s2rmum ou1tlxnif3ilsfs uln o;(0 rxoiociotfpDe nes;t0seum(r3ou1altn ieta() 2raxrp;t1tetn ictldfm2raump () lerxo3totfaD luvs () rumio3nudllt  feil(farumxmpot4aptn ictlt aDemnmonu)trxrir todopt aies t0s2umim no4alee netas  Dtm(r nu4tlt  feiytfs umn o;t4teenxr totlmDe neils trumimpoy1amtnmnei t) 2uax p;o0tetomiciltls2ea( onu0tleomo ia1fp rai i t s2xoxopiu1lltelncil(  rtmumpot4teenioctatfmDra(vs t0artoxocoy1lpDe uesls0sexrxr3nudamt mnctas sDtr( ont4aet iiciydfmDrlumo (4areomocoo1opD  nes;s) rtr(r3io4ll nmfvta() ruaxronu0tpen f3ildlmDelnvo;u)aexnxr3ty1om  ai i;s) 2xrxr iu4lleemneils  Draxmont4oexn i3tadfsDrm( snt4 etrxo3to1fa raueslt0t2uoxrpiy1open ieias s2ua(rp;o1apeomoetld mDemu s;(0teermo3iodopteliei;s)sexoio3oo1lle lfvtltf 2rmx oou4oexn ieiyt m2ul(mo ()artrmociydfp eaivs t  2toxr3nydoltemici t srurxm ;o0tptoiicildla2umuvo t)arerif oytoptr ivs;s) rur(o iy1am   icsat srtaxr ot1tet moeiytfa2rauvo t)tleoifcoy1op  luvo t) rxo(rpnydal e nciltfs2tr(r nu4oexn feild m rl(mpnt4tlenmfctotomDr nesls teurio nu1lm  mnvs ( aDtaxr ot4opxn o3iytlm2emu pnt0 etnifcia1faD ln s t0trurio oodapeemivta(f Drmxmo;o0ole ifetlsfaDrau s;(0alxrxr3oodlm r n s t teumxm oy4lmenlnvtlt s2ra(r nu1tetoif3tldfmDumu o t0aetoxf3iadomD aivol( t2um(rpny4oleemfcs tfsDuaumpnu4optomoeiatls2eanvpnu4arxnmrctytlm e iei t s2xoxmpiu1ll e ictatfa2tm(mpot4tet  oetyt s uauvsn() lxrxr3oy1fmtr uvol( t2xrxrpny1lptnmietat)sDrmxmpnu1tptomociaslaDrl( p;u0 exnxf3oa1omD  i olt0srurimpiu1alte ivsa()arum(r ;u1olto o3ilt a ea(ms;t4 eerir3tytomte i sls)t2xo(o3no4ap nmies sfsrtauro;o0alxnmf3iat aDum(monu)aexomo iydfa   ies;( s2uoir ou1op elicsat) 2raum oo1tpx io3ias s2ra(vp (4 lxnxocoydopt  neo (0t2tmxr3ny1omte fcta() 2uaur nu4oeeoifeiatlsDua(mpn()tetnio3oadopteanvs;s0 etmimpoudllee fet s  2tmxm ;u0alxnmfciatfsDrm( snu0 eerir oodlp   ies;t0sexo(rpoydll elietltfaDuaxmooo4aet mfciyt mDrm(ms;(0 rtoxo iytoa rauei ( t2xo(m iu1lptnliei t s2ua(rpnu1aeenmiciasfs ua(vo;u0trtomr3oatoa  lu sls  2xo(o3ny1ap e fvtas)s2rm(  ;u1olxnmfcilslmDelu o;(0 exoio totopDelnvslt t2trir oydlpt lnvi t  2ta( o;u1alxn i3ildla um(vp t4artoxf iadoaDr nei t) eumir io4apt lfetat)artaumpnt4apxn iciadlm eanmont)altrmociotlaDrlivs t) 2urxopoudomt mivs s)a2taurooo1oleoiiciytfm2emnvpnu0tetoxr3tydlmDr uvo ()t2um(rpou1am emicslsfsDumx  nt1aptoiieildfs2rmump;t0aleoxo ta1faDr ues (0trtriopiudomen fci (fsrumum ou4teto i3iyslsDuanvsnt0arenxf3oadom   nvi t  2toxo oy4ale lnvi ()sDrax  nu0oltnmfetlsfa2ra(vp;u)trtrir oo1opDrln ols)tetmxo iy4ame mnet ( aDrmx  nt0tpt  iciadfs2el( s;u0 lenio3tytfp eanei;s  rtoio iy4ol nlfetatf Drrumpnt0tlenmfctas s2eanvo u0 lerifctytom eai ols) exoxr iy4alt liei t)srtrxrpnt4oetoifeilt m2eauvo;t0 etnir3iodop   nvslt0trtoim iydlm nmnct t  Draumo;t0aeeomfciytlaDemu onu0alxoxr3to1oa rau i (0trtriopiudlmtnlfvia()artmumo;t4apt if3iys a rmuvsnt0alermrctatlpDr ieo (0 2xoim3iy1omtelfet t) Dur(ront1alt  oetas a2emnmsnu)alxnxfciytlaDrln s (0t2to(rpiu1apeemfes s srtrx pot4tlxn fctytfaDul(vp;()arxrxr iatfmteaiei;s setoxm3oy4oltn neil(f rumxr ou0oex mfciat s ua(vpn(0 rxrmfctatfa r uvi s0trxmim io1lpe  netatf 2rm(root0opxn fciatfa el(vs;u4arxomfctytfmteanvi t0 2toxr iydopee iet (fsDumxmpot4tpx mietls aDumu o;(4 eeoxf3tytlatraneo;( srtrxmpou1alee nct s sDum(r nt4oexo oeiyd m emump u)tetnxf oatlaDe uei t srtr(o nu1lptn ietl( aDur(rpoo1olenio3iydls2umuvs u4tetomfctodfm rli o;s)trxmxo3io1lptnmnet tfa2tr(ronu0oetnmi3iyt aDemumsnt)tleoircoadomD aneo;s0s2xmir iu4al   fvi t) 2tm(rooo0olxn oetydlmDra( snt0 leoxrctotlm   uvolt0s2xr(r3ny1lp nmfei t aDtaxmo;u1tlx io3iadfs2ea( snu4trxnif tytoptraneslt  exrxm oo4op elfvtasfsrtmx p;o1ape ioeiyt m rlnvs (0texoxociatlmt anvo ( t2toir oo1olee ncsls  2raur ;t1opeoii3iytlaDrl( ont0 etnxo tadomtelnes;s)trumirpnydalen nvtl(f Draxroou4altn iciyd m2ra(mp;(4teeoxrcoydlateai s;t0sexoim3oo1olenmieslt)aDtmumo;o1tptoiociatls ea(vsnt4 exomocootlmtr uvo;s) rur(m iydom emfvta(fsDumu  ot1optomieiaslaDrlnvs;u0 lxrir3oy1lmDelu o;t0t2xm(mpoo1lpenlnes t artr(  ;o4tetniietldls rm(mont4artoifcootlp  aneol(0sruoxopoudll e ncsa()arraxro;t4tpt mfctlt m rlnvs;(4altoif iotomtrlneo ()teumxo ny1amt lnct s)artm(rono4oee if3tysfa umn pnu4 lxrxfcio1fpteln i;()trtoxm nudapen nvsa()aDua(r nu4apxoio3iltlsDeln s;u0aexnmo3iy1lp   u ils)teur(r iy4olte ivia( aDrmur ;t0olenmo3iad sDrlnmpn(0 eeriocoo1omt anesls srxm(o nodlmt  nciltfa2rm(r ;o0alxnmiciysla emn o (0aeerxocta1omD lues t  2um(m oudapenlivtas)s2uax  ;u0alxoifeilt m2ulumpn(4tltomf3ootfp   ivslt0t2toxmpnu1om  lfvsasfs2umumont4opeo fctadlm rm( s u4aetnmf oo1oaDrauesl( seuoim ny1ap   fcsls)sDrmurpno4texnmietydls rmnmp;(4aetrxo oodfaD  ivolt) 2tm(mpoydolte feias)s2uru  ou4apt  iciyt a2eln o;t0 ltnxr iy1laD auvo;s)trtmxr3ou1ll  mfvi tfarrmxmpnt4olxomoeilsfs2ua( p;(4altomf oatoaDelivo;s  rxoxo oo4am e fvia( a2tau  oo1opxo octys s2ua( o (4alxnmf3totoaD anvs (0s2urxrpny4oltemieslt a2taxmooo1tle mfeiyt m rmnmont4tltoircoytop r u s;(0trtrim3nodolt mnvsl( sDtm( p;u4aetniocildlsDumnmo;() rtnmf iatlat aivs t0t2ur(opno1lmen nvi (fa2umuroot0oetoii3ildfa2rmuvpnu4 exnxo ta1fmDr ues;s)setm(m oodal emici tfa2urx pnu4ale io3ils sDeanmo;(0aetnif totfpDran s t0 2xrxr iy4lmen fvias  rtr(  ;u0texniiciatlm2eanmo (4 rtrircoadopD  iesl(  exm(r ou4alte ivi t  ruaxrono4apenmfctlsla2ua(vonu) lxnxfcoy1fat lieo t)srtrxm3nu4lp  mictas sDtr(roou0oetomocildfmDeau pn(4arenmr3todoa r neo (0 rurxrpoo4al  mivsl(fs2rmumonu0apx ioeiltfsDem(vs;()tetnxf3oytlatr n o;s0sexoxm3ou1lm elivil(  2uaurpot4tpeo i3iysfm2rmn o;t0texrmr3iy1faDrluvilt srur(opiydap   fet t sDrrxr ot1alx io3iatfa rau sn(0aetrif oo1fat  u o (  eurxr iu4optnlivslt) rtau ono0tetnmfctytfs el(von(4alxnmf3to1lmt lu slt0 2ur(opnudapte icsatf Drau o;t1aex  o3iydlm2rm(mp t4aexnxfciotop e ivi t)s2trimpnu4oltnmnvsl(  rrrumpot4ope ifeiys m rmu pnt) rtriocoo1fat li i;t s2trio3iu4op n ietlt)s2uaumpot0aeeomfeiad s rlu pn() eerxrcoytla raivs s)t2uoxm oy1altnmivtatfaDrm(ro;o4ope moeiasfaDumump;u)aeenmo3totlpt aueslt)teurxrpno1llt mnet ( a2tmxmo;u0tee  f3ilsfsDeluvs u)tetrio iytfmDrau slt)srumxm3iu1lptnliciatf 2tmx o;t4aetnio3iadlaDea(vo t0alenmf ta1lmDrlnvi;s teto(r iydopeemneiatf 2ra(mp;t4tee mf3ias s rluvp;t4alxrmo iotfmDeauvo s0 eurirpiydlmee fcsatfs2rr(moou0teenio3iydfa2raump;()altrmfcoydomt aivo;s0trxrim iu1lle mictl( srurxrpnu1oltnmocilslmDrl(vs t4tleoir io1fp e ivsls) rxo(r3nu4ameemnesltfs2ra(ro;o4teenioeildfa um( pnt4 lenircoatlpDrln i ( srtoio nu1apen fesl(  rumxmpno0teeo feilt s emums () eeomf totlm r ieo;t) rtm(o ou4om  lnvilt a2um(  ;u4apxnmfciadlsDrmu p u4 lxomrcoydfa  li il() ruoxr3nydomt lfes tfa2um( o;o0ole moeiatfa2rm(mo;t0tetrmfcoydlptr iei t)tetrxopnudap emivtatfs2taxr nu4aetomieiydlm2um( o;()tltoxf3oatomte uvi;t trurio3oy1ll  mncs (fs2rm(rpnt4ope  oeildlaDumnvon()tlxnxfctotlmt ai i;( trxrxm3oudom nmicils)aDtaurpno1oexnmieiysla2elnmsnt) rtnxf3iodfm r uvs s texoxrpny4lltnmict s sDumx p;u1tpxnmfeiatfm2elu snt)tetoir3oodfat lu i t texmimpno4ole  nvils  rrrxr nt0alx  f3iyd s em(mpnt0altrmfcoy1om eli s;s) 2ur(m ou1lm emivs t)s2um(m ;o4openiociytla uanvo t0 lerif3iatlpte neo;t sruoio3iudom nmncs s a2umum nu1opxomoctytfmDrl( s (0trtoxfctydlpD lu sls  etoxo io1lle mnci t srtmuro;t1oltoif3tytfs uanvp ()tlenifcia1op eauvil()s2xoxo3oydale lneilsf Dumump;o1apeoioetld s ulumo u0 rtrmo oa1oa  luvs;s)t2umir3iydlme  fvt sfarua(monu0texnifeilslsDra(vp;u)trtomr ootop r i o (  2tmxmpnu1am   nesat)a2umur oo0apt  octlt sDemu s t0trtoxf3oytfat an i (  2toxrpnydom  livil() Drrumoot1ole  f3iyslsDelums;u) etnxo oy1oat anei;s) rxmxo iu1altn fvt tf Draurono1tpe if3iysfa2rl( snt) rtrmo oo1lateli s ( texmiopiu4alen nvils s2rr(r ;o4tpxo o3tas m rm(vs t0tltnxo oadfa eanvs;s texr(opiy4ale miei t artr( oot4opeo iciltla rl(mo;u0 ltoxo3oo1fa rauvi;()srtmir3ny1llee icta( sDua(rpno0oeenioeiadfs2ea(vs ()texrio3tydfmDrlieils)trxoxr3iodoltemiei (fsrtm(r ;o4tptn oeildfm uauvsn(4texnxrctytom  ai o ( s2um(m nydal nmnesltfsDtmx  ;t4olx ifeildlaDem(vo;u4tlxrifctadomt  u ils0srxoxr no4apt mfci t)s2urxm nt0tptn iciltlsDumump;t4texnmo3oytfptrlnvsls s2xrxmpou1omt lnct () Dururpoo0apeo o3iys a2elnmsn(0 etnxo3to1fp  lu sls0texoxo3oudop   fet () 2ur( ooo4oetn iciydls eau on(0aexnxr3iy1optr u ols)texrir3oy4lmenlfctas arrr(  oo0aeenmoeiadls emu p;t0 rxnxrciy1op  anvs;()teumxm nudolenmictas)aDrax pnt1opeoiietyd aDemums u4altrmf oo1fmD anei s s2trim3oydolt lies s sruau o;u4tet mfciysfa2ea(ms u4 rxrmr3oy1opt ln olt) 2to(m oodlpeelnvtl(  Drr(  nu4tltnmi3tysls2emuvp;u4teermr oadlmD lneil(0 eur(o ou1llen nci (fa2umxmoot0oexomo3iydla2rmn pn(0tlxrir3iytfa eau s;s s2uo(mpiodam emiesl(fsDur(mpot4tltoiieiasfaDea(mo;u0 eermfctadlm rli s;s) 2uoio oy1al nmnctlsfsrtm(r oo0ope mfciasfsDulu snt)teenircoadfpt lnes t t2uoiopiu4optn ivs t aDtr( o;t0oetoiieiad a emu snt4alxniociotlm rlu i s0trxmxrpoudlmt mivslsf Dum(root1opxoio3iltfs eau on()alxrmf iydfpDrai ilt) rto(r3ny4ol n fci sfaruaumooo0apx ioeilsla2rauvsnt)tetrifctadoptraivo t0trumxm3ny1om  lncs t srrmxrp;u4oex ifetlt s2el(vs;t4tlenxociy1fa e nvil( t2uo(m no1amtnmivt s)artm(m ot1tet ifetad m umnmo u)arxoxf3oo1fatrli o ()seurxopoy4lmt licilt aDumx  ;t4oleo iciys m umu o t) rxrmociatlptrlu s;t)seumxrpiy4om  lncta(f 2ra(mo;u0olxo octatls2ranmo () exoiociadfmt auei;(0sruoxmpoy4ol   fvias sDta( oou1opxnmi3iatls el(mon()trerxrcto1lptrauei;(0 2xmxm3nodlptn fviat s2uaumpot4apxn fciatfa umnvon(0 ltnxrctodfpDraueo;t0 2xm(m3iy4lltnmivs t aDurur no0tpenmociasfs el(vp u)aeeoio3io1opte uesls t2xmxo3iudlltnlnvsa(farra(mo;o1ape  ieiysfsDean o;t4texrir3oo1lp rau ils0teumir ou1oleelnesas  Drrx  no0oeen feiyt m2ra(vpnt4 etnircty1lmDr uvsl(0trtm(m nodape mnei s)sDrm(mono4tlenioeiytls2ra( pn(0arxrif3oy1lm  livo s s2xm(o oo4lptemivt t s2rrxmono0oeenmf3tasla ea(mp;(4 lxrmrcootlaDrlies ( trxmir oy1ol n fvtas sDta(m ot0tpt iiciytfm umn o u0tlerxfctytfaD  i s t)srtm(rpoydap elnvs (  rrm(ronu0tlxn oeiad s2ea(vo;(4 ltoio iytop elneolt) rumiopnodlp nlnes (f rur( ont0olxomiciasfa2rl( sn()tlxrxfciodomteaieo t) exr(o3iydll n ncsa()s2ta(moot0altomfciadfsDrau o t4aleomr oydoateli o t  rur(rpio4om  mnci tf rra(  no1olxnmfctys m umu s;t)tlxoifciy1faDr n sl(  exrimpio1llen fvtltf Draxm ;u4apt moctatfa rmuvp;(4 reomf iatoa   neo t)trurxm oy4om emnvi t)sDumu  nu4oexnmociyslsDrl( ont4tltrxr oydlmD lnes;t0s2uo(m oo4ol n fvtlt)s2raxrpot1olt mf3tlslmDea( p (4 rtnxf3iydlm rau i;( trtrxm nu1lpenmiei sfs2tax pou1tptomo3iadfa2umuvs;(4arxoxf3tatopDr uvsls0setmir3iy4ame miesas) ruau oou1tlxnmociyt aDuauvp;t0treomrciy1fpDrli o;(  etr(o3no1ome lfctlt) Duaxrooo0alt mo3iydlaDeaumpnt0 etnifcootfpt  uei ()s2umxo3oo4ol e ictls s2ta(  ;u0oeeo ieiltlmDrl(mo (4alerir3iy1opDe ivo;s s2xmxopiu4lmeemnesa(fs2rmumoot4tet mf3tldfa uau s u0aeermr3iodfaDrlues;s  2toim oudomtelfei sf 2rm(ro;o4tpxn fciydfm rluvsnu0artrxr3totfpt an o t)seuoio3iu1lpee ics t  rra(mpnt0aeeoiieiasfa2rlnmp u)trerxr totlaDrlnes;(0tetoir3iodllte fesl( a2rau pot1tptoifeilt sDrmnvo t0 ltnxrctadlpD livolt)setm(m3io4lptemicsasf Drmuro;o1oee mo3iytfsDea(vs u)arenmociatlmt auei () rtrio3io4ope lfeias)arumxrpot0tetnmi3iasfaDemn p u0trtrmo3todlpt aieo (  rxr(rpoo1opt  net tfsrum(root1aetomfciatla ua(monu) lxoxf oodla  au slt0 rxoim iy4olt liei t s2ra( ont4ale iiciydfa2ulnvo;()artnmf todfmt liei t t2urxrpoo4lme lfei t) Dtrxrpnu4oltn i3iytla2umums u4tlerxr3oydla raiei (0trtrxopiu4lle mncsa( arrru p;t4oeen octyd a um(vp t) etnxf tadoateaivols)s2uoxrpny4am  mnvsl( srraxro;u0aptn i3ildfm umums t4 ltrmocoa1oate ieo s t2ur(o nu1altn nvtltfaDrmxmpou0altomfcilt a umnmo;t4tlermf3ta1omDelieo s)trtr(mpio1lmee fvs t)sruax p;u1tex moctltlaDranms u)areoifctadomD livi () etr(o3oy4ll e feil(fsDra( oot0ope iictldfaDuaumon(4aetnxfcoodlaDeanesl(0 2umxr3oo4omeemnetat)a2raump;u4ole  ieiad s um( on()teerif3to1fa elu o t sexmxopoy1ome livtl()srua(  ;o4tleo oeiatlmDul(vpnu4alxrifcoodfmD liei t seumxo oy1ol elnvtasf Dumur ;t1apx  f3iadfs2rm(vpnt0 rxnio oo1om r i ol(  rtrxr oodole micsa(fa2urxm no0tpxo fcildfm2rmu snt0altoif oa1oateln ils t2xoir3no1opeelicil(fartrurp;o4tlx ii3ildfm2rm(ms t)tlxrio3iodomD  nvs s0 rxrio ny4lmee ncta() rrm(m no4aexoiicils a2el(mp;t0 eenir3to1fm rluei;t) etoxr3iudlpe mneta()aDtmur nu4tpe moetatfs umump u0aeeoif3oa1lm eliei;(  euoim3oodalenmfeiatfsrumu p;t0ale  o3tlt s2raumsnu0 leomr3oatfatrli s;s  exm(rpoudale lfvs (fsDuaxmp;t0tpeomo3tlsfs ra(vo t4 etrmfciatlp  livi (0trum(m3ny4apenmictls)s2uaumonu0alx mfeiys a ran o;()tltoxfcoo1lat au s;s)sexmim3nydlme lfei tf 2rmumoou0oetn feilslm2umu p;u4 lerif3iy1la elies (  2xr(opoy4om   ivs s)a2umxrpot0oleo ietat aDulnvp;t0 rtomf3tadlptr ueil(0 2umio3iu4alee ncs t artaur ou1tpeniicildfs2ean p;t)texnmo oa1lp e ueo ( s2tmxr ou1lp n ncias s2tau o;t4oetnmocild s rauvon()trtnmf3oodfpt an sl()trtoio oydll elneilt)s2rmxront0tee iicilt a2rlumsn(0texrxf3oy1fm  lnes;s)s2xmxo iu1lm nmfeilsfa2um(mpot0ale moeiyd mDrl( o;(4tlxoxf3oytlptrluvi s)seuriopnu1lm nlnvtls sDra(  oo0aet ifeiad a umuvsnu)aexnif3oydoaDrau s t) 2tm(m nu1am nlnvtasfsrumuro;o0oltomfetyslsDumu p (4tlxnxf3to1om ran sls0sruoirpnodlmt mnes sf Durxmp;u4aexoifcild sDrlnvsn()trtoxo oytoa e iei;s)s2xrxr ny1olt  fvtlt sDurumpoo1optnmoeildfa um(vs () rtnmr oo1lptraivi (0 2xoio nudomt lnctl(fa2tmurooo4aptnii3ias aDrl(vo t)aeeoifcoatfaD aneo;()s2xmxm3oo4lm   ncta() 2trurpnu0olt  i3tysfaDraumsn(4 renio todlp  lies ( seurxo3ny4om   neils)sDrru oou4opt  ociatls uaumsn(0teerxrcty1opDrai s (0 eto(mpnu1llenlfet ( aruau p;t4aexomietat s2eln s;t0 ltomf io1omtrln il() rtrxm ou4am  mnvs t)a2trxmoot1teeomf3iyd a2rmnvpnt4aeerioctydlmDeln i t sexmim3ou4ale mieta( s2umu onu4tle ii3iad mDel(mo ()trerir ia1fm eanei;t)setr(mpoudlltnlivtl( s2rau pnu1olto feiyd a rlnvp;u)aexnio3oytla  luvslt texmxm3oodlpee fvtat) ruaurpno0teeoiocilt mDem(mo () etomo totlp  luesls  rum(o nodameelncs (  rrrurp;t1tptomfcilsfm rln s;u4treoio3oytlpDeaiesl(0srxoxo3iu1ap e nctls)arrrxm oo4oetniieildlmDrl(vpnu0 lxomr3iadfp elnvols0texoio3ny4ame lfesl( artm(rp;u4aexnif3ilslsDemn p ()alxoio3ia1fpt li i s srtmxmpnu4lltnmnes t)s2tr(roou1tltnmfctasfaDem(vp;(4treoiocoytfaD  nvi s0t2xrxmpny4lpen nci s) 2ta( p;u1tpx iietad mDrmums ()arxnxr3totomDeli s s0 etoim io1ol e fvsl(f Drr(m no0tlxo octatls2eanvp t)tlxniociodoptelneilt0 exmiopny1ame  ivi s s2trxmpot0oee mfeiyslm elnmp;t0 lxoxfciadop rlues (0 rtr(rpnu1lleemnet (  2rmu pno0openio3tyt s2um(mp u4trxrxr oy1op r neols) rtrio iydopt mnvsas)arrrxrpno1tpt iictls mDua(vp t) eeomr3ia1fpDr uvi;t)srtoxm3oo4lmte fcil(fsrrru ono0tle  i3tatlsDrlnvpn(4tetrmfciadoaDr u o;s0teuo(o3oudope lnesas sDrmxmp;o0teeomfciat m uan o t0artrxf oatoaDelu slt) rxoxmpoy1altnlfvs t aDuax pnt1oee moctlsfm rlumsnt0trxnircootlpt anvo s0teurxr3nudapenmncs (fsruau p;t1tlxoioeiaslsDeluvo;t4trxnmfcoodopDrai s;t  2xmir3oydamtnlfetls sDumumpno4opt moetldlaDuanms u4aexomrciy1oaDrlieol(0t2xm(rpny1ale lnvias) Drmxmont4olen o3ildfa2ea( o ()texomo3tydoaD  ueils0srxr(o3iy4op elieia(  Dtr(m ;t4aeeniicilslm2rln s;t4 rtrmo3oo1fptran o ()teto(rpio4ll  micils)sDtrx pou1aptomoeildfsDemu p;(4 rerif3oy1fatranvi;s texrimpoy4lpe lfvs (  2ra(ro;t4texoiieilsls2emnvo;u4 reoifctytlmtrlnes t  2tr(o3ou1am   ivt t artmx  oo1olx moeiytfsDrluvon() leoir3oadfmteauvo;() exmxmpnu1open ici () rua(mp;o0aetomo3iltfm uln ont4 rxrmr3ty1opD lies;s srurir3ny4omtnmfcsls aDur(  ou0apx ifctys s rlu p (0 leoxoctotlpDe i o s)trum(r3iy4am eliviltfarrau pno4oexnioctlt sDua(ms t)tltnxociytfaDranes;()tetrim iy1lm  livilsfa2taum ;o4tpenmo3iyd m2rmn o;(0 eeoxfciydlmDelnvils  2tmimpoudal nlfeias  rtmx  nu0oltnmo3tytlsDrau onu) ltnmo iydfa e ivi;()t2uo(r oo4optelnvs sf ruaumpno0tpxn ictld m eau s t0arxoxr3iodfa elieo (0texmxrpou4lmenlfvt (fsDrax o;u0tpx  f3tlsla2ul(vsnt4aexrio3tydoatr n o;() 2tmio3io1alenmfvtls)arurum oo0opeomictaslmDumnvs;u) lermociotfpDeaueils srurxm oydlm e icsa( s2ua(r ;o4ape ioctldla ranvp u4 renif iatfaD lneslt truo(o nu1op emncta()artmurpnu0tpto f3iydfm rl(ms u0treoxo3iatlp e iei t)srxrxrpiy4aleelneiat)s2um( o;o4oetoii3tydla2emumo t) lxoir3iodfaDelueo;s  2xm(o3iy4oleelfvia( a2tmuront4tlxoif3tasls2rmnvo;t0tltrio iadfm  lneo s trxr(o3io4lpt  nvi sfartrumpoo4ope mo3iadlsDel( s;(4altoio io1lmt luesls s2urxr nu1olt micil() 2rm(  ;o0teeo ociys mDrl(mont)alxnio3tydlmDeauvs s) rtrxrpiodll elfvtlt) 2ur(mont1aet  f3ils sDea(mo;t4trtnxfcia1lmtelieo t texrxrpny1omee nctat) Dra( p;t4oltomfctldlaDel(msn(0tltrxf3tadomtrlu slt)t2trir iudolt lfvt t arrmu  nt1ape mictysls rln p u4tetrxr3tatlp rliei t) ruo(r iudlm nlfes sf Dra(mo;t0apenmiciadfaDrl( s;u0teerir oodom eln olt0s2uoxmpoodol n fcia() Dtaumpnt4tpe ifcildfs elnmonu0tltomr3todom rlu sls) 2trio nodop  mfvtasf 2raxroou4open fctyt s2rmnvo t0alxrio tadfmDr uvolt  rtmir ny4ole  nctls)s2taxr nu1opt iiciyd m rln p;u) etnio iatomDe i o;t t2xr(m ou4lmee ncta( a2ur( pno0open o3tldla2rau p;u4 lermociodla eanvol()trtr(rpiodap nmfvsas  2uau pou1opxnifciys a2ulnvpnu)aexoxfciodomte neil( teurir3oy4ape mncslt aDtaxro;o0tlx mietlsfs2uaumpnu4alxrircoadla raivi;s trxmxo3nu1lmtelics s aDraumo;o4aexn fetyd mDumnvo (4aeermo3todfmtraivi;(0 2toxo no1alt mnetltfarrr( onu4aptoii3iydfa2emuvs (0arxnmf3oodopte uvol( t2uoim3nu1ale  ivtasf 2urxmpot4tltomo3tltlm uanmp u4 lenmr3to1late ies;s0trtoxo ny1lltnliei s) rumu pou1alenii3iatfm2rmn p t) rxnxo3oydlpt livil() 2umio3oydlle  ivi tf Dur( pou0apx  i3tydfm ul( snu0 ltomocoydfa e ues t  exo(m3iodal  lncsa()srrm(mpnt4aex iieils a2emn s;t4 etrmo3tadomte ueol(0s2toxm3ou4ope  ies t  rtmx  nu1tle mociltfs ran on(0trtrmf3tytfm rlneil(0trtoxr oydop n ivs s) Draumpnu1ape  fciadfa2rau p;t0aetoxo3iodfp e uvi s s2xm(r iy1al  miesat) Dua( pou4openii3ildls el(vpn()teenmfctodfpDeau i;s)setm(o3iu4olenlnvi tfs2ra(ro;o1opto oeiat s2ulnmpnt)tltnxo3ty1laDe n i t) 2umxo iu1alenmfcs sf Dra( o;u0alt iiciydfmDrlu s u4 reomo ta1fp   ivs t0s2xrxo3no4lleemnvtls sDta(rono4olx  octasfm2rmums;u0arxomrciadomt aivilt0srxmir io1lmen fesa(fa2urxmo;o0opxoii3tlsfaDeanmont4 rxrmf iodom r n il( tetrim3iu4oleelnesls aDumxrooo0texniociasfs el(von()arxrifctytfa elu i;t0 exoir3iydopt  ivs s) 2rrx o;t0tetn oeiadfa ul( p u4arxoir3ty1late ivi;t s2umir3oodamte ietls)sDurumo;o1oetoiiciatfmDrlnvsnt) eerxf tydfaD an s;( trtoimpoo4aptnlncsl(faDtaxmp;t0altoio3iatfm2umumsnu) leoir tatfp   ivi ()seuoir3iodaptnmivsatf rumu o;t1apxomfetyslaDrlnms ()trxrxr io1lpDr uvs;(  ruoxo3ou1ll elnetl(  2tmx  ;t0tlxo fcils a2eauvo;u0 etoxfcootfpt lu o t0 2xrio ou4al e nvtl(fsDuax onu1openifeildla2el(vp;t)artrxociydfmteai s (0s2toio iu4ol   fctlt) rrax oou1ape micias mDrlnmo;t)texomrcoatoaD  n ilt  etrio3io1aleemnctlt)a2uaxm ;t4aeeo iciad aDrm( p;u0aetnir3oydomDrlnes;s) ruo(m3oy4lle lfvta(f Drrur oo1teeoiociadfmDeauvo t4trxrmr3iadfatraiei t) ruoir oydomen iei (farrm(m nt0tpxn i3tyd mDrmnvpnu0 lxnxo3ta1oaDr neo;t truoxopio1ap nmneiat arrm(ro;u4opt mieiad a eauvs;u0alxomo iytfm r nei;s) 2toir iudolenlnetas)artax ont1tleomf3iys m elumpnt4alxomf tytlpD lu s;(0 2um(opoudopte nvsa() Dtmxr no1ole mictlsls2ran snt)trermr oy1omDe u ilt s2xm(o3iudll  lneil(  rrax ono4oltomfcias sDulnmo (4 ltrmo io1lmDeli ilt)teum(m nydapt  ivsasfsDtaxmonu4oleniieiltlsDumuvo;t0artomf ta1omDe ues;t0t2tr(o3oydomtnmfcs (f 2trx p;o4aptomfeiyd m2rmu s;(0 reoxo3oydoa e u sls tetriopnudllt lfvils)sDum(rpoo0tpx mociad s2rl( s;t)alxrifctadla eln ol(0tetr(m nudlmen iesas)srtau o;o0tltomfcias s2el(monu0altrmocoy1lm e i s;s)s2xmio3oudlmee ics t) Dtrurp;o0aet mo3tlt s uau s;t4 lxrxf3oo1fp e ieo;(0setrxopoo1lpte net s s2rm(m nu1oeeomiciltlaDua(mp;u4tetomfctodoatrlueo (0 2urxm iy1llte iet t)a2tr( ooo0oeeo ieildfm um( s t)alxnxo totopDeai i ( t2xrxm ou1ll   nes (f ruax  ot0aleo ieiyd a2umuvsn(0 rtoxf oadoa   i slt t2uoim3iy4lptnmivilt s2rru p;u0ope moeiydfmDrmnvon() eeomf3ia1fmte neo () 2tr(mpnodlme mfeils) Dum(rpno4oex  ociatls2ranmo;()altnxr oa1la rlu o;t)t2xoxm ny4ll nmicsl(f 2tmx p;o1apxo o3iydlmDul(vo (0arxoxfciydfmD  nvo t0trxoiopiu4amenmfcsltfsDtru pou1opxnmfeild m elu s;u0arenxrcoodoa rlu sl() rtmxmpiy4lptnmfcslt) rrr( onu1oexo fcilt a2umumo u)aexnxfctytomD anes;(0sruo(r oy4amtnmiesls sDrm( pno1tlt iietys mDem( p;u)arenio3ty1fptrli ols0 euoimpio1llt livt s  rrmxmooo4optniieiysls ua( pn(4aexrxf3oy1omt aiei t  rumxrpoudolt  fvsltfa2tr(rpno4opxn fciysls em( p (4 lxnio totopDeln i;()s2to(mpnu4omen ics t sDumxronu1tlxomoctld s ulnvo u)aetomr3tytoaD luvolt0 euoim3ou4op emivilsfarrax p;t4teen f3iatfaDrmums;t0altnirctotlate nei t)t2xoxo ou4lltn nvils  2rmx  ;u1tetoifetldfs2um( s (0trxrmf3todfptr i s;t t2tmimpoy4ale  iet t  Dtrxr ot4aeen o3tysfa2rluvp t0 lerif ootomD  uesls0teuriopiu4apt  nei t srtrxm nu0alxnmfeias a2ran s () ltrxrctatlm e uvilt0 euoxmpnu1lme mnesls  rrm( poo0tpen fctytfsDem( pnt)trtnif iy1optr uvi s0truo(mpiydlpenmieias  2tau o;t1aptnifeiltla emu snt4aexrxf iytoatr ueo ()srxoimpiodolte nciat)aDumxr oo4tlxniieils mDrau o;(4texomo3iydlm rlu o t)seuoir3ny1ap   ivsas  2ta(mp;u0tpto feilsfa rmumon(4trenmf3iodlateai ils0seurxo ou1alt  fesa(  rumump;o0olen ociadfa2rauvp;t4aeeoifcio1fmt ai o t  ruoimpio4am nmncsa( srtaxrpno4aetnmoctyt s2eluvp;(4 rxnxrctytla rlieo;s0t2xrimpnudolte fvta(f rtm(mp;t1opx  oeiadla2ea( o;u0 lerxf3iotfm elueslt  2tmio3no4lltnmncia() rrr(r ;u1ale iictls sDul(vsnu0 reoif3oytlmt  ivo () rtrxrpnydlmtnmiesatfsrtrurp;o1tptoiicils sDulumsnu) rxrir iytfmDean i (0 exm(m nodlp nmics ()s2trumo;u0opxoif3tldfa umnvo;u4tetnxo oydlm e ieo s)t2triopno1om elictl() rururpou0oet iicild m rm( p u)artrxr iytlm rlieslt0setrir3oodlm nmnet ()s2rm(mo;u4aptn ieiadls rl( s (4artrxrcia1lpDrlu ols  2toiopno4lp  liet sfsDtmx p;u0oetoio3iaslm rl( p;t4aeenmo3ta1fmDean olt t2triopio4aptnlnvsa(fsDrmxmp;t4tpxnmieiatfs2em( s t4tltnio3oydoa eaieo ()sexr(o3oudlltelnctl( sDtmx p;t4oeenmf3iysls2ul(ms;t0tetnxf3tydla elu ols)trxmim3iu4altn nctl( a2tmumono4tee  i3ildls2rm(msn()teenmf3oo1lpt lnes ( t2xrimpoudlp e fvilsf rrr(mp;t1apxnmoeildls2ean s;() rtomociytoa eai sls) rxoxr3ny4lltemivs sfsDrrxr ;t4tlt mi3ildlmDeanmp u) rtnxo tatfpDrauei ( s2xrio3no4amee fvi t)srtrxm nu1altnioeiytls2ean s;u)trxrxf ty1opte u s s t2xoxo iodom nlfesls)aDuax oou4opxn f3iltlm ulums u) rxoxr3iodfp  anvol( tetr(o3nu1lptnmiciltfsDuax o;t0ape ifctysfm2ra(vp;()texomfcoodfmD  nvs;( srto(mpiu4alenmicsasf Drm(moou1oeen i3iadfs um(mp;t) rtrifciatom r ivslt  2umir oo1lm n fci s arurxm ot0aeeo oeildlaDuaumsnt4 rerif3tydla   ueils)teuo(rpoydamenmfes ()s2tmump;u1ale mfcild a ul( s;u4tleoxrctatop   uvils) 2trxm iudopt miesatfarur(  no4oleomociysfaDum(msnu4 exrif oodfp   n o ()t2to(o3oydapeemneilt arumu pot0tptomieiad m2uln sn(4 lxnirctotlatran sls tetr(o3iy4lltnmies ()s2rau  nu4opxomoeilslmDean s;u)trenxfcoodopDelueil(0 2uoxopny4om e fvta( srrauront0oleomictld s2rau snu0tlxnirciodopDelneo s)s2um(r ny1amte netas)sDumx oot4tlxomicilsla2emuvpnt) rxomfctydoatr i o;s0t2xrirpoy1ape mneta( sDurur ;t0oexoioetad m2um(mont4arxoxfcoydfmt  u s;s)sexrim ou4ol nmivsls a2rmu ont1oltomfciltlm ulnmp u0artoir3ia1oaDeluvi;t0 etm(o3oo1om emfciatf rrrxm oo0apt micildfa rln pn(4trermo3oo1fmDelnvo;t srumio no1am nlneiltf Draurpnu1tpxniocils sDulnvs ()trxnmo ootlaDr neo ()t2uo(r iy1op n fetlt) Dumxm nu0tleomfciasfsDem( p u)aeenxrciy1fa r ivs;s)srum(opnu1alenlics sfsDumuront4tpx  octysfsDeau p t0alenmr3oodlpteai olt0t2tr(o3oo4aptn ieiasfarraump;u0tpx  i3iltfa2ulnmsnt)aexoxr tytoa r i olt  exoimpnodapte icta(  2rruroou1aptnmo3iasfs eluvo t4aetoxo tydopt aneo;t) 2urir3iu1lmtemivi ( srrmumpot0apxoiocild s ulnvo (4teeoxr oa1fpt li o;s0s2toio3iudamtnmncsa( s2rm(mpoo0olen oetltla2ua(mp t0trermrctatoaD aueo;(0teuo(m iodale mics t)a2trx p;u4alt  octasls2rau onu0altrxrctotlpDe i i;s)teurxopny4lpeemfeta()a2rrumoot4apx ifeiltls2ulnmp u)trxnxociotlmDran ilt tetoxopnydap nlncsat) 2raxm oo4texnmfeiltfm2eau s;t0treoxo3oatfmDe uvols)t2xoxr io1ll  mfvt s srraxmp;u1apenmi3tydfs2uan o u0 exnio3todfmt aneo (0 rxo(r3iu4amtemietl(fsDtau p;u0alxo f3iyt mDuan o u) rtoxo3oodomtrau s t0srumxopoy1lleemfctlt srua(m nu4opxnii3tltfs2rl(mo;(0tltnmf3ta1la ran i s0 2urxr3oo4lpen nvilt)arumxr ;t4aptoioetldla em(vonu) lxrif3oytomteauei () rto(r3oodlmtn fesl(fsrrmxro;u0opt mociaslm um( s;t0 reoir3ia1omte i i;() eurxo3nu4ope mnvsls aDrru oot0altn fetadfmDrluvs u4trxoifcta1lpt  ueils trtr(r nydlmenlfet tfsDrmu onu0oeeoii3tyd s2uln s (0artnmf3io1lmDe ieol() 2uriopou1alenlnvt tfaDtruro;t0apen oeiaslsDra( sn(4tlenmocoy1omDr n slt s2tmxopoy1ome  nctatfarumxr ou4oexo oeiasfsDrmumpnt4arxnir3totfpt  nesls)truoir nodope mivtlt srra(r ot4ape mfeiytfm2um(mpnt4aetomo3oatlat lneo;s setrxr3oudll   ivtlt sDrrxm oo4tetnifctyd s eau pnt4trerxr3tatom eliesls0s2toxmpnudlmee ncsl()aDtm(m ou4tpeniietat aDem( p;u)areoxo3ty1lmte uvi;() exrirpnu1lm  mfeia(faDta(  oo4opeoiiciatfs2emn snt0aexnir3iydlm eaueo s0t2ur(m iydllt mivtl() 2rrx p;t4alxnmf3iad sDua( sn()aetnmrcoodopt lu i;(0srur(m3ou4optnlfei tfsDtaur no0tlenmoctltfsDraums;t0tlenmrcty1fatrau s;t0 eurirpiu1op e neslt s2tr( oot1tle moctasfsDrm(ms;t)texnmfcia1fat  n o t) etrir3nu4omt liesltfa2rau poo1oleoifcils s ea(mpn(0 eenxr iadlpDe n s (0 exrxrpiydlm nlnvs tf Dumumpno0tltoioctadfm ra(mp;u0 rtnxrcoytfptelu s;(0t2trxopny4llen feils s2urur oo0apenmo3tadfa2elu o t4 renxf tatlaDrai sl( tetrxo iudop elncilt) Draxm nu1oltn oeilslm2rm( o;u) rtrmf3oo1fpDrli ol()t2urxm3ou1am  mfesl(  rra(rpno0oleo ieiadfm em(mo;u)trerif3iodlm   u ol( teuoxm3nydll emnctl()a2umur ;o4oexnifciydfa ea(ms;(0arerir tatlaDrau i;t)srumxo nydlm emiciatfaDtmuroot1teeomoeiytfa2rmnms;u) rxoio to1faDrliesls0trur(rpoudllee ictat)s2tr( oot4apt  f3iysls2rmnmp (0artrmr3ty1op r iei;s0setoxmpoudlm  mietat a2rax  ;o1tee  ieiytla2rln snt) rtnmo totopte iei s) exoxm iy1am elncsas) 2rax ono1aexo o3ilsfm ulnmpnu) lenxfcoy1om   ues (0t2ur(r oo1lptelici ()sDtm(m oo4aptn iciysfmDuluvp u) etomr3iodom rlieol( setoxopoy4oltnlivs sf 2uaxmpnu1tlxo ictatfm2um(vsnu0alxoxo totla   nvi;t0 rxoio oo4lm nmivtas)a2rau pnt0tlxomo3ilt s2ranvp t0 rtnifcoydlmD  uvol() 2tm(rpny4omtnlfci t  2rrumont0aeeoiieiat aDem( on(4 lerxr iotla e nvils trtmio io4ame livia(fartrurpoo0apen feiatls2elnmp u4tleoio3oydlpDrli o;s0truoxr3ou4al   fvsas) 2raxr ot0apxnmi3tldfs2ulnmpnu4 eeoir iadopDranei;( srxoxr iydalenlivs sfaDrr(m no0tlxo oeiad m2rluvs;(4 etnmo3iodoaD  ivol( t2trir3nydolt licil( srrmxrp;u0oeeomo3tlt s ul(ms;t4texoxr totlpDelnvo;( tetoxo3iodlptn iei t  rtax ont1alx mi3tyslaDuaums;u0 exrmf3tydlateli s t) 2tmxopiudolenlfes ()sDtmx pou1opxomietyslm2em(vpnu4 eenmrctadfm   uvs s0trtoim nodoptelivilsfarrr( pot4tpeomfciydfsDulumpn() rxnio iy1lmD livo t0srur(o ny1lmeelnesl()srtmxrp;o1tpenioctldfs2umn pnt) etrmr3iatlpDr i sls srto(m oo4lmtemivil( arrrx p;o1tetoiictys mDulnvp;(0 lxoxociatopD anei;t)s2umim oy1opte fcs sf Drm(r ot1aet ii3ildla um(ms u4 ltnmo iadfpt aivs ()t2umxo3oydlltn netl() Dta(r nu4teen icildfaDrm(vp u) leomo3iatomt auei t  rtmxm nydlm nmfctl()s2umu  oo0olxnmf3tad sDraumo;t) rxnmrciodlpDeaies ( trtoxo iy1am nmicilsfsDta(mp;u0tpx  o3tysla2em(mo;t4 lermfcoy1opDeau i;t0s2xrio oydlpt  nvil( artmxro;u1apxnmf3ildlaDumnvo t4 lxoxo iadoat aueols) rxm(opnu4ap  lfvsas s2rm(  ;u0tptoioeiadfa rlnmp;t0artrxfcty1fmtrlu o;s) rxoio3oudomt mieta() 2raurpot4teeomfcildfs rau snu)tlxomf iydfat lueo;t)seurxo3iydlmee netlsfsDur(  nu0oex  ieiasla rl(mpnt0tleoxocto1fpDeauvo;() 2ur(r3no1lmt lfes ()aDrrumooo4texn fetls aDemuvsnt)teeomo3oa1fmtrlueo (0sexmxmpoo4ap e ietat)arumxmooo0apen fetltfs2um( o ()tltnir3oy1lp r ivs ( t2umxr3iu1lp n fct t)aruru o;o4apen ociydlm2rl(ms t4arxrxfcta1omtr uvo;s texrimpiydomeemnei sfartm(  nu1oleomfctys s rm(ms u4 eermf iy1lpD luei;()t2tm(o oydalt micsls)srtmx  ou4apeoioctyslmDemn onu) rxrioctydla  aiei;t0t2xo(rpio4altemivsa()sDtrumonu0aetomf3ildfa umnvpn(4aeeoxf3iadomDr ueils)srtm(r oodomee nciltfsrumur no0alto ictadlaDua(vp;t4aeeomfctatlm r ieo ()s2tmxm3no4ameelnvias  Dumu oot1ope  fciad sDulnvo (4tlenxr ia1fmD  u o;s texr(m3nu4op n nvs () rur(m ;o1oleomo3tltfa emu o t) rxrir3iatomt aies s0tetoir3oudolt mivs (  Dtmumpot4ale  ocilt m ean o ()aetoif tytlmDe neilt t2to(m nodolt lfvilt)sDra(rp;t4oetniictasfs2rm(ms;u4 exoxo oatla e nes () 2uoir3oodalt lietls aDur(rono4alxn i3iyd s ulnvpnt4tltomf3io1faD au i;()t2ur(rpny1op nlicilsfs2umxm ;t0openmo3tlsls2emn p;u) exrxfcto1omDr uvi;() exriopiy4lpt mncsas sruaumoou0tpeo i3iad s2um(mo (0arxoxo3iodfaDe ieols)trumxrpnu1opeelnvil( a2taxro;o0alenmfciyd m ul( pnu4teerifcto1fatranvo s)texrxopno4apenmictlt)aDta(ro;o4tpenifeiatfs ea( p (0aetrxocoydlateanvs;(0trtrxo nydomen ictlt) 2rmu  ;u0tpto fciydfa eanms;t4 eenmo io1lmte ueslt0srumxr3oodllenmictlt artauro;o4aetoiociadlm um(vpnt4 reoirctatfmDeaues;s)sexoio oudopt liei t arrr( o;t0tpt ioetltlsDuaumonu0 rxoxfcty1fm e ies t  euoim3ny4apenlnvs ( aDrrxmpou4aexo f3iydfmDuauvp;u0tlxnxrciotomDranvo;t0setmim3ou4lm n ncs t a2uax pnu1texomfciadfa2ulnmo;(0arxnif3oytfp   uvs;s seur(opno4ape  ivi (fsrur(rpnu1oee mi3tyslaDumu o;()altrmr3iytfm r i o s t2uoirpio1amt lies sfs2trur no4tpxomo3iysfmDuluvsn(4aetniocio1lp  au o;s) rtr(opiodop nmneta()arraxm ;t0apxo ociltfaDulnms t4 lermf ty1lp  aivs s  rum(o iy4al nlfetatfsDua(mpot0oleomfciys a2rm(mp;t)alxrxf tatop  ai i t0tetmxm3no1op emfvil() rumxmp;t0texn ociat m ulnms;(0 exnif3oadlatraivs (0 rxmxr ou1lpe mnetlt) Dtrx  ou4olto oeiytlm ulnmp;(0 exomr3tadfpt an s s)trurxm iodopt mfeiltfarumuro;u4tee io3iys s2rm(vsnu4 reoxo iotfptr uvsl(0 rum(rpoo4apeemictls)s2tru onu0aex  fciydfa2rluvs;u4 rtoir3oytfm raies;()setrimpnodam  mfvs t)a2tr(ront1olx mi3tyslm umuvp;(0texrio3iadlmtraneo (  exm(m iudaleelneiasfa2tr(monu0tpx ifeiys s2raums t)teenio3iatfptranvo;( setmxrpoodam emfviatfa2umxmono0opeoioctadfm2ua(vo;t4trtomr3oadfp eanvo;()tetr(mpoy1om e nviatf 2tmur ;u0oee  iciyd mDulnvo;t4tetomf3tatom raivi;t  rxm(mpio1omen ncslsfa2ra(ro;t4optomfcild s elnmp u4trxrif3iydlp eanvilt0setmxr oy1lpt  nci t)sDrr(rp;t0oleoio3ilsfm2ranmo u4alxnif iadoaDeli o;t) rxm(r3iydoleemivil() rua(mp;t0olxo i3tydfmDea( p;(4teerxr to1lp e i sl(  exrir no4ap nmivs s aDtmx onu1optnifeiad sDrmump;u0artrxf3to1opD auei (0sexm(o oo4al  mfvias srrru p;u0opx  f3iys aDua(mp (4 renxr3oytfm e ivo;t0srxmxm iudameemiet sf Dum(r nt4teenifeiadfa ran o;t)areomo totlmtran s s)sexo(mpiy4ame lfesl(f rrmxmp;o4aexn ieiysfm2eluvs u)arxnmf tadlaDeauvilt0 rxoxmpio1lltn ict t) ruax o;u4oltoiieiatls2ul( s t0arermoctytomDeli sl() 2trxrpiy1aptelfvias)s2tm(root4oeeo ociytfmDuanvs;t) renirctatom  anei;()t2xoiopnydape  ictl()srtrurono0texnmi3iasls rlu o;u4tlxrifcootlateaues ( seuo(r io4am nlfvs ()arua(mono4ape  fetldfsDrm( onu)tlenio oytfm r iei t0truoio nodol n iei ( arumx  ou4altnmfciytfm2umnms;t0 ltnir tadop rlnvs s t2umio3iy1llee ieta()sDrax p;t1tpe mi3iltfaDelu o t4trxrmrciydfa elu s;s) 2xrim oo4alte feias)srurxmo;o1tpt mfctldfm2ra( o;u0 lxrxocta1lmD  ieo;t0 2urxm3no4alt lncslt)aDumxr oo4aptnmi3iytla2rau p;u4artnir oo1lmDrauei;t0s2tmxrpnydol n ics (faDraxm ot1tpeo o3iad s umumont0 rxrmr oytopD an ilt0setmir iu4llenlneia(  rurxrpnt0aetnmicildlmDeau o;(4 lerir3iodfm eanesls0t2triopou4lp n netat  2rr(mont0ape  ietad aDeluvp;u) lxnif3iydfateauvils) 2tmxopiy4altelivsas)sDrm(r nt0tetomi3tltls2rl(vpnt4tlxoxr3iy1omteln ol( teuoxm nu1lme mnei tfs2ra(mpnu0oet iociydla ra(vp () ltoxf3oadoateanesl()truoxo3io1apte fei (fs2um(mp;o0texoiociadls2ua(vp t4tetoir ty1lateaneo t0 ruo(m iudalen nvt t a2uaurp;o1teto ociatls ul(vs;t) reoxr to1oat lues;s)teum(o oodal nmicsls)artru  nu4oeeniociadfmDrmu pnu0artnmf3tatfp elnvi t)srxr(m3oo1olt  nvilt)sruaxr nt4aexn ictytla2ranmont4artrmociodomDeln s s)t2urirpiy1lptnlfvt t sruaxronu4tptn feild m eau ont4tetoio3tadlp ranvslt)setriopoodopt livta(f 2tmu  ;t1aex io3ildfsDran o;(4artomo oodomteaueilt)t2tm(m iu1lpt  ivs (f rtmxrpnu0aleomfcilt sDrl(vo (0 rtomfcoy1oat liesl()trtrxr oo4apen fvil(f rrrum ;t4ole mi3ils aDuan pnt4tetrir3oy1omD  i sls) eto(opoo1omeemnes s)sDtaxroou0olx if3taslsDel(mp t)tltoxociadfpteluvo;s srto(mpnu1lltnlnviat aDtmumono4alxomieiytfs emuvp ()alenmo iadlm   n s;t) 2uo(r3iy1apenmfcs ( arrm(mpoo0tpen ictytlm2uan s (0tlxrxfcootfmDelnes;s)s2uo(m3nydapt  ieiat srtaxmp;t0teto f3tytlm2eanvonu0 lxomo ta1fatranvs () rur(mpoy1lp nlfeia(fs2tmxm ;u4opt mi3iltfm ua(ms u4 reoxr iotlm   uvi;t) euoxr3iodaptelneiasfaDum( poo4tpxn ociyt sDuln pnt0texrxfciodomt an slt)srtoim3oo1amt mivi t a2rrxmont1oee mfeiltlm elump (4aleomfcia1op r nvils)sruo(o3ny1lm n ieta(  rtmxm nt1aeto i3ils aDrmu o u4arxrmo iydlpt livols  rum(o3oydlpee net t)sruaxmpot0texomfeiys a ul(mp;(4 ltrmo iadfmDrli i;s0 2uoiopou4lpe lfct ( sDrmxm ;u0altnio3tadfs emu o (4 eenifctotoaDelivi;(0sruoxr3iodlpt liciat)aruax oot1tetn oetld s rln o;(0tltrmfcoa1omDeluvo t)t2xoxrpnudamtnlfvtas sDumxmp;u4tex  ictad m emumpnt)aexrmrciydlatelueolt) exr(o3io4am nmnesat)aDrax onu0oee ii3tls m2rln o;(0artnxfcoy1opDrlues;s0srumxr3oy1apt lictlt)sDrm(  nt0tltn ietyt m2ean sn(0aetoifctotla r uei s0t2xmxopiu1alte fvslsfarur(r no0oleomfeiytfa2ulumon() rtnioctydfat luvo;s0 2urxo3iudlpe mfcs sf Dtm(moot4altoioctyt s eanmon(0tlxoxfctadoa  aivo;s0sexoimpoodamtnmicilt) rrax pou0apxo oeiltlm2ea(msnt0areomo oy1fptelnvs;( t2toim3oydapee feslt  2urxr ;o4aex mietyt aDemu o;u)tlxrmfcto1opDeau sl(0teuoxo iu1lp  lict t)arrrxroou1tpe  ieiasls2rauvo (4 rerxocootopDelnvs;t trxm(o nodomtelnesl(faDraxm ;t1aet  feiyslmDrln p t0teermf3iytlm r ivsls0texmir oo4ap elnctl()sDra( o;o1tpxoio3iyt m ulnvs;u0 ltoxr3todlate i i;s) exrim3ny1lm n nvslt) Dtax pnu0alxnmfetat m2uluvsnt4 rtnxr oadoat livs;() ruo(rpny4al e icta( sDuau o;o1tee  f3tldla raums ()texnmr iydlmDe u i;t0trtm(mpnodop nlfesls  2tm(  ou1tetoiiciatlm2uluvo;u0 rxoif3ia1fmDelivil(0tetoxmpiu1oltnmfvta(f rraurono4tpx  o3iat sDrlu pn(4 lxoio iodomt lieilt sexrio nu1lmen fcs t) ruau o;o1optnioetyt mDra( s u4 reoxr tydfpDelieo t srum(r ou4lpe  fesa()s2trxr oo4tpt  ociltfsDrauvsn()trenxociy1omDeauvsls0 exoim3nudoltemiet s sDrm(m ;o1apt  f3tytfa2ulu s u4 rtnmr3todlm r ieo s tetrxmpnu4am e ivslt)s2ua(m ;u4altomfctasfm2em( o;t4arxnxf3oa1lpDrlivs ( srto(opio1ll emiet (  2ta(mpou4tpt iieiysls rmnvs ()alxrir3oytlm  anei s0truoxo oudlpee ictat)artrumoot4olxnmoeiysfsDea(vp (0alenif tatlpteai i s  etmiopiy1lm elietltfa2taumpoo0tpen iciltfmDum(vs;t) rxrio iy1omtraueo;()s2ur(o oy4al n nctlsf Dumu ono4tlx mfctyslm2rl(von(0aeenio to1la   neols0 2ur(rpiu4ap emnetls) Dra( pnu4tlt iociad s um(vsnt)alxnif iotoat  uvs ()teurxo3oy4optemnes s)artax  oo4aetomi3iasfm2uluvp;u)teenxr3io1la eauei s sexm(m oo1am  lfvi ()aruaxm ;o4oleoif3iat s2umn p;u0 ltoxr3iotlaDrlnei;s0s2uo(m no4al nlfvta(fsDua(mpoo1optn i3tydlaDul( pn() exnmfciadfpD  ueolt seurirpiy4ap n netlt)arrmx ont0olenmfciysfm ulnmo;t)trerir oodlmtr n olt  exr(rpio4lm nmfci s  2trx p;t1oltniociytlmDua(mo t)trerio3todla rluvi;()trurxo nu4lm elnesls artaurpno4oetomoctydfs2ea( o t0trxnmo iydlm   uvols) etoiopoy4ame mieslt)s2raumpot4oex mo3iysls raump;t) exoxr oydlpteaneol(0 2xoxr3ou1olenmict ( arumumo;u4apeo feiasls emnvs (4 rxrxo iytoa eli s ()seurxr3oy4ap elnvtlt) 2rru  ot1oltn iciyt aDemuvp t4alxniocoy1fptrauvi t teumio ou4ll nmiei t)aDtmxmpot0tlxnmociydlm2ua(mp;u)arerxfciatfptr uvi;( s2umio3ny1lp  mnct s  2rru p;o0opt  ieiat s umnmon(0arxomocia1om e i i;(0srxo(rpio1apt  fvsl( sDrmx oou4teen fcild sDrau o t)aleoxfcoytlmtelu i t) etoxo iu1lm nmieslt) 2ta(mpnu0apxomoetyt a2rlnvo u) rerir oadomD  nvsls0truoim oudlpe mfet tfa2tmxrp;u1altoiocildfs2el( p;(0 lxrxfcoodfmt an o s s2tr(mpiu4lm emics (fs2rmumoou0tpx ii3tydls umu p u0 rxrmocta1lmDrau o;t)sruoim3ny1lpenlfci s artr(mpnt0opeoifctldfs2rm(vsnt0tetrmfcoo1fp eaivs;s0srum(m oodome mici t) 2tau pou4ope mociltls ul( s;(0trxrmo3oa1fp eanei;t0 exrxr3iu4oleemietls  ruax onu1oetoif3iytfa2eanvp;()aeerir3tydomtrauvsl()seurxm3oudapt  fcsasfsrrmur ;o4opxo o3iytfs rl(vsnu0tlxoxr3ta1late n i s seuoxo ou1lptn nvta() 2um( pot4ole  fctysla2uau snt0 rtrio3oadoatelivslt)t2xm(rpou1lpeemncs ()a2tauro;o0oeen o3iytfa el(vp (0tlxomrcto1la e u s t  etr(rpno1oleemfesas sDtrum nu4tltn ociyslm2rmuvo;(4 exnmo3iydlpt ln sls0srxmxm3iy1lmt  ncil( a2uaumo;u4openiiciydfs2ranmp t0teerio3iadlmDelnvil() ruoio io1ap n nci t s2rau pno1optnmieiytfs2umu sn()texoxfctodfmDelueil( t2urimpnydllenmnvta( sDta(rpnt1apt  oetls a ua( pnt) rtoxr iy1fm eai ils0sruoio ny1olee net t)s2rru p;u0optnif3tyd a rm(ms;u0 exrxfciodfmtr uei;t0sexo(m ou1lptelnesa()srum(mpou4oex ifctytlm rau pnu0tlxnxo oy1omt lu i s0t2xoxr no4ol emfvils  2rr(m nt1tleo ictydfs emu o u4tltnxr3oadfpDr nei;t)srtoxo oudap e nvilt) 2tmuronu0oexn ieildlaDrm(vo u4aexnmr iodfat  ieo s0texoxm3ny4am   fcsltfa2umumpoo1oeeoifciyd a2elnmp;u)altrmf tatfat anei (0 eurxrpoy1oleemnes s)srtaump;u0oeeo ieiysls elnvs;()trtoifctadlpteaivi t  rtm(m ou4lpenmivsat)sDraur ou1tpeomictydfs em(mpnu)teermo ty1laDeluei () rxmim oydamee icsatfa2um(m ;o1ape moetydfs2uauvpnu0tltrmocio1lmt  ivil() rtmxo3ou1lptnlfesat aDtax pou4oee mociyd aDeanvp;u4aexrxo3iodlm r uvs s  2xrir3oodal eliesls  2umx ooo4tltomfeiltfa2ua( o t0 reoxf oytoaD li s;s t2umio3nodap  lies s)arumxmpoo0open feilsfs emuvs () etomr3oytoat li olt) ruoir ou4amtelics ()s2uaxrpou4optnmicilt a ulu on(0 leoircootfm e nvolt trxoimpno1olen nci s srtr( pnt0apeniietltfsDulnmp (0 lerifctytoaD  ueo s trum(rpio1am  mnes ( s2rrxroot0oeeomoetyt aDel(ms u)tetnir io1lateaieo s0 etrxr iodllenlfetat a2trxmonu0olxn i3iytlmDum( sn(0artnxo3oodfmtelivs s0setmim oo1am e fcs t  ruaxroou4tlto iciys sDrmumo (4aeerxr iy1fmDraneols0seuo(m3io4ome mnvtlt s2ra(r oo0tpeniictat s ra(mp;t0alxrmo3totlmD  ieol()sruoxm iodap  lictlt)a2tmurpno1tee  iciyt a2uanvon(0texrmo3ia1la eli sl( teuoir3oy1aptemfci s) Dtmurp;o1oet mfciytls ea( onu0aexnmo3ia1om e u s s0s2xr(o3io1op n icslt)srur(mo;t0oetoifetaslm uauvon(0tltnmr3io1omDrai s;s0t2xo(mpny1omt lfcia( sDum( ont0tltoiociyd s ranvs u0arxrio3oadlatelnvilt  rtrxo3nu1ameemfct (fartrur nu0aptoiietldfaDul(mp;t0altnir3oodfaD livil() 2xoxr nu1ol e ieslt)a2rmurp;u0tlen oetadfaDem(mp;u4 lerxr3ta1fa  aueol(0 2xrio ny1olt licsl( aDrmu  ot1tet  fctldlaDuluvo;t4 reoxf3oatfpD  ieo;s)s2xmxm3nodlme  nvtlt  Dtmurpot1altomoeiasfs eluvs u4tlenxf3iadlmD lu ols) 2toxo iy1al nlnvs ( srumx oou1aet  ocildls2rl(vp;t4texrifciodomDr u slt) exoxo3oudaleemics s  Duru ooo0aptnifetldfaDulnvs;(0aleoxoctydoat  nvi (0 etmxr nydap emiviat srurum ;o1olxomoctas sDrl(ms;t0 eeomo ty1fat li s t0 2xmio oodoltelnvil( sDrmu o;u4apxnif3tytfm umu o t4altrmocoytoaDe iei;() rxm(r ny4lpeelici t srta(mpoo0ole  o3tadls ra( p;(4 rtrir iydopDr nvsls0sexrxmpoo4ole  ieiat  Dtaumo;t0olxoioctadfa2rau onu)alerxo ia1latelivils  rur(r iodlptemnct (f rra(r nu1opxomfcilsfa el(vo;t4tlxrir oytlp  ai slt) 2xm(m nu4aleelfeta(fa2raumpoo1oltomo3tatfa eanvo u)tetoir3tytlm  auvo s)teumio iy4lpe  icsa(fsDtaxmpot1tee  i3tysla elnvp u4arenxf oa1opt  u sls0sexoir3ou1olenlict (faDrr(mpno0aeeo ociad aDelnvsnu0arxrxocoatopDranvi;( s2xoirpiu1ol nlivsl(fsDtm(r oo1opx  o3ias s emu onu0 exrmfciy1lp  aies;s0srumio3oo4omtn ict tfs2tm(  ot0optnmociysla uluvo t4tetoiocoydlm rln ils0 etoxmpiodap nlivsatf rra(mo;t1tle  f3iydla2rl( pnt) reomo oytlateaiesl() rtrir ou4omenlncil() 2urxrpnu0oee  iciydlmDeanms;u0 ltrmo3iadfmD lnvs;t0trurirpoo1lmeelfvias  2rr(ro;o4ope ifeiatlm2ul(vo;u0trxrirciodlp  aueo;(  rumxo no1aleemnctlt  Drrxrpot0tetnmictls sDeauvsnt)teerir3iadlaD livils0 rtrxo iu1ape  ncilt) Drmxrpot1altnmfetytfa2emnvs u4 leriociy1fpD livs;()srtrxopoo4llt mict (faDtmx poo0ale  oetadfm2rm(ms ()tetoifcoytlmt  n i t0srtr(r3oo1ope livt t aDtaxrp;o0openioetatfa2rmnvp t0aexrmrctydlm rlnvi;( trumxrpnydll nliesatf rtrx ont0optomociytfs2ranmsn(4areomf3oy1lp   uesls)t2trir3iudlleelnvsatf rurx pnu4tptomfctld mDemu p;u4trxrxr ia1opteluei;t trxoxm ny1optnmieslt)aDuaxrpou0aptomoetadlaDumu o t4 rerirctodfa elivs () 2xo(rpoy1lpt lneslsf 2ur(ro;u0opt  o3tydls el(vo t) leoifciytfpt  i s ()teurio iy4ol   ict t  2rmxrooo0tptomf3tldfmDuanmo;u) leomo3iytlpt  u s s0teto(o3oy1alen fesas artru onu4oltnmociad a2em( pnu4 reoir3ta1fp  auvsls0trxoimpiodal n nviasfsDrrxr ot0tlxn ietat a ea(vpn(4altrxocta1lpD  ivo ()trtmxo no1lp nmfcias aDtrxrooo0teeniieiydfs eanvs;t)tetoirciodlpt lues;s)srxmxr no1op  miei (faDrmu pno0oleoiieiyslmDran s u)trxnxo3totfmteaieo;t0srum(opiu1oltnlfesltfaDtmuro;o1tpt  iciys m elnvpn(4altoxr3iy1lmDrai ils0 etrir3iu4am nmnvs s s2tmxrpnt4aptn feias m2rlnvon(0 etnirctodlate nes t)teurxmpnu4ame mivs ( s2um(r no0aetnmicils s2ean on(4artoxf3oodlmteln i t) 2trim3oy4apt  nct sf Dra(mpnu1aeeo i3ias m ean on(0 etrmo3iotomte ivsl(0srum(opnudapte ict (fsrrmu ono1tleo oeias a rm( o;u)tlxoxrcoodoa   u ilt t2toxm3oydal nlfci t srrax  ot1oltnmo3iyt m ulumpnt0arxrirciy1opD  ueo t  eurir3ny1apt  fes t) 2urum ;o4oee  o3iys mDelums;u4tleoifciydop  aueo;t0 etrimpio1lptnmfviasf Duru  no1olxoii3iyd mDrm(msn(4 etrxocoa1lpDrluvi;t  2to(rpoodlmee fciat  Drmx  nt0aptn fciytla2rln p;t0 renircto1lmtr n i;s)s2xrxm ou4ame lfcslt) 2tauroou4oetn feildfa2rmumon(4areoir3ootlpDelnvo;( t2ur(m iy1ap emncsl(faDraxmo;t1optoifeias a emuvsnu)trtomocta1op raueols truo(rpio4lm   nesas) rur(ro;t1opxo fctytla2ulumont0 leoif3tydomtelneo;(0 2trir3nudolte fvta(fa2umurooo0oetnmfciytfsDrlu o (4aexrif oa1faDe i sl(0truo(r3oy1optemnei (f rra(r oo1olt ii3tat m uanvs;u0texoifciotfa rlnvs s  rtoxo iy1lmtemnvsa( a2urur ;u1tlxomfeiytfaDrauvs ()aetoxr3tatoate uvo ()teto(o3ou1ope  fesa( s2rrxm ;t1oet  i3ildla elums;u4 lerio3ootop eaivsls trum(r3oo1olte icil(  rrax o;o0olx ifcilslm elu s;t0trxomo oa1om   n ils srurir3oo4omtnlfvsas s2urx ono1tpe  i3ildla2emnms;u4 exoxo3tytfmDr uvs s seumxr no1lpenlfeiasfs2um( ooo1apen oeils s eluvp u4 exrio3oa1lmDeaivsl()s2toxr iy1aptnlieias  Durxm ;t4oeeoifctld s ra( pnt0 eermfcoytom r n s;(  2ur(opoydlme  ictltf Dtrxr nu4aexniocils m eluvp;t4 exrmf3oy1lat lu s;(0trtr(r3oo1ol e fvtlt)sDurxm ;t0oeeo fcild a rmnmo;t)aleoxf oy1lateaivs ()t2xmxmpoy1om   nct t)a2um(rpoo0tpxn f3iadfa rlnmonu4 rermf3tatfm e uvslt)setoxo3oodapeemfesasf rta(mp;o0opeoii3tasfs2umn s t)texoirctotomt liei (0sexm(o ny4ap nmnviatfsrtmur ou0olxnmietls m eauvo;u0trermocta1fmD  ue
\ No newline at end of file
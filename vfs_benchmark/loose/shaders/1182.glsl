@@ -0,0 +1 @@
+ivslt)trtmxm3nydopenmivtat arrmxmp;u4aee  feilsfa umnmp;u4 reoircio1lmD ai s;s) 2urxr oydoltemfvs (fsDtmxmonu4apt  fctls s2rau s;u4artnmoctydoa rlu ol(0tetr(mpou4lpt mncs () ruax ooo4olenmfciasfs elnvs;u4trxrmr3oytfmDr iei t0 2urxopiodomtn ivsl(  Draumpoo1tlto iciysfmDul( s;()areoir todlp r n i;()trurio3ou1lmtnmietatfs2rmxr oo1tlx ioetldfa rlnmo t0 rerxr tydopDe ivo;t texmxo3nu1op nmfeia(  rrm(  nu4olxnmi3iatla eluvon(4arerif oa1lat  ivo s  rxrxmpoo4olt lfvtat) Drmxrp;o1tltomoeias s uanvp (4tetnir3tatfmDelivo t) 2urxr3nudalenlivi t srtmu pnt1texoifeiyd m2rmnmo;u4texnmo3oydomDelu o;(0 rtr(r oudom emfvilt s2ur(ronu0olxnmfctadfm ua( pn(4aexnxrcoa1oaDrluvils)sruoxo no1ap elfvia(fa2raxroou0alx  fcildlmDumnvs u0trxrif3tatfmDean s s)sexrio3nu4altnlnetl(  2tmxr ;t0tlto ieiydlmDelnmo u) rtrir3iydfa rliei;() 2to(mpiodame mfvi t aruaxmpnt1alen iciysfa eln s u0tetrmr3ta1fm eanei;t0sruoxo3iy1ome  ivsas srurxro;t0apx ifctatla ea( s;t) exrmrctotopDe neo (0t2xr(mpno4ope mfvsatf Dtaxroou0aex  fcildlm ea(vp () etrif oodlp e i sls sruoxopiu1lle mfet () rtau pnu4tltn i3tadls2rl(mo;u)trxnmo ootfa eai olt)sexr(m3iy4olenlnvia( aDur(r ;o4tlx  o3tasfs um(ms (0texoxf3iodlate ueols) exo(r3iudopen nes s  2uaxmpoo1tptnmoctytfs2uanvont0tetnxf3ia1oaDeauvols) 2trxm3iydamtn net ( a2raumo;t1tlxomfciydfm2rl(ms (4alerxf iatlptrauvs t0srtm(mpno1al n fvsl(faDtr(  ot1tltn oeiaslmDean s t0 rxoir tatlmD aieo ()truo(m3iy4aptnlfvtlt)sDtr(rpno0open ictysfs umu s;u4aexomo3to1lptelieo;() exr(r iodaltn fvta( sDta(mpnt1tpeniocilt mDelu s;u) lxomf io1opDraieo s0sexm(m nodolt mncslt) Drrumo;u0apxnifetydfa em( s;u4trxrxo oa1laD liei t0 ruoxo3io4lm  livta()a2trx  oo0olenmiciadlm2uaumonu) rtoif3oa1la e ivo;s0sexoio3iudapt lnctat)a2ta( poo0olto feiat sDrm(vont0aexnio tatoaD lu s;(0tetrxr io4amt lieiasfsDrmuronu1alxniiciyd a el(vp;t) leomfciotlaDraivi (0tetoirpio1omtnlnesl( a2uaxr nu1olx  i3iyt sDel(vsn()tlxoxoctodla r ieol(0sruoxrpnudape mfctatf Dumxronu4tle mf3iyd s umnvs u)teerxr3iadop r i i;t t2xr(o3iy1aleelnctlt)sDuaxrooo0olt ifctadls2rlu p (0 lxrxf3tydfpD lu o t t2xm(m iu1lle mnesas)artmxrpoo4oetn i3tadfsDua(vo;u4alxrmocoodoa eli o;()s2tr(mpnu4llenlicta(  rurxm no0tlt mfctlsfa uln p;t)aetnio3ta1la eai sl(0 2uoxr3ny1open fci s  Dtax  nu1tpx  o3tatfm2uln snt)altomrcoytfat  uvs;s)srumxr ny1ll emnvi ( srtaxmo;t0tpe moctatls2emnvp t4texnxf3iy1opD  neo ( trtr(m oudlltnlnvsls srtmu ont4tpen fetysfa2ul(vp;u4aexnir to1optr uvilt0t2ur(opou1openlivtl(f Dtm(r no4olxniieiydfa uanmpn(0aeenxocoydopDeliesls)texoxm no4lpt mfesat s2ur(mpnt0opxniociltlm eaumo t)tlenxf3iotlpD ai il( s2uoir iudlpt  fei t)srtm(r ou4opt ii3iadlaDem( o;(0 etnmo3totoat ln ilt0 2uoio3iu4aptnmicsat) Dtaur ;o0opt  f3tatlm2ulnvs;t4 rerxf oo1lpteaivsl(  rxo(rpoy1amt  ictl(f rtaumo;t1opeomf3tyslmDum( pnt4tetnxo iatoa  li ol(0trtrir oudam   ieia(faDrru  nu4aexo ietyd sDumnvsnt4aeenir to1omtrau i;s) ruo(r oo1lpe lfvs tfartr(rpnt0alto o3tytlm2rmums (4 leoif3iadlaD auvol( tetoxrpoo1am  lnvta(f Drax pno0texn ictasfmDum( s u)aetrmr todfp   n s;t) 2um(mpoydlleelnvi s)s2taurooo1aet  fcias s2um( p ()tlxrxf oytfp  aivsls0 exr(r3iodoptnmneiltf 2uax  ;u1oee  f3ilt mDrmuvonu0alxnxo3iy1lp  au o (0 rtm(r oodomenmnes s) Durxroot0ale  f3iyt a2ranmsnu4trxomf oy1opt ln o t0 eurim oydam e fvtlt aDrrxroou0oltomfciydla emn o t0 etrxo oydfpt lu s;() 2urio iy4llee ics sf Drrx pnu0apxoif3tytfa2rmu o t4treoir3oadlpt anvo ()seurxrpny4ap nmneia()srtr(rp;u4altnioeildla rm( o;t) lenxf3io1oatr uesls  rxrimpny4om n icta(fsDta( p;t4olenmietydlmDrl(mo u0texomo3iotlmDrlnvi s)trtrimpnu4op  mnvilt)s2urxro;u1teenifciyt m emn o;u0aeenxr ty1lp raues (0trurxo3nudap  lnvils arurumpot1tltnmi3iltlmDumumo (0texnxf ootfaD anvi t  euoxmpiydal   nciat  rumx  nu1alxnmfetltfmDelnvpnu)trtrxf iodoa e ueo;s0 rxr(o3oodap  mneilt)aDraurpnu1olx  o3tadfa2rlu p;t) ltnio ootop ran i (  etrir3no1ame lfvi s sDraxmpnt0oee iieiasfs2rm(mon(4 lxomr3tydoaDe uvi;(  2xoio iudom emfctat a2uaumont4opx ioeild mDrmnvs (4texrxo3iy1oatraues t) 2ur(m3no1alenlictat sDrmumo;t1tetomfetldfm2rln p;()teeoircoodlmteli ols0s2xm(mpnodalt lfciasfa2trxm oo0apx  iciysfa2rm(mo;t) rtnmr3iotom e nvi;( seuoim3nodam elicia(fsDraxr nu4aetomfeiat s2rmump;()teenmo3oodom   ueil()s2xo(m nu1lm nmfvil(fsrua(ronu0opxoiiciyd s emnmo;()aleoirciodfaDeli olt teurio3ny4lpe  nct tfaDur(r ;o0tet mieildla rmu p;t0arxrxf3iodomD anvs;(  exrir3iy1omt  nctls) Drrxrpot0alt mfeiysls umnvp;u0trtrxrciodfmD luvi s)srtmxr3iudapeemnci t) rrruro;o4apxomi3iad s2rmn pnt0aexoif3tatlatr i sl(0 eumiopoudlp  lfeiltf Dra(  ;u4altoio3iyslm ea(vo u4 rxomfciydfaDr neo (  rtrio iudlm e icsa(fsDuaxmo;u0oee ioctlsfs umn p t4arenmf3ia1fpDelu o;s0t2tmxm io1al  miet s)aDrr( o;u0tptnii3iad a rlu p;u4tlxoio3oy1optr nei ( truo(m3ny1aptemfetas  2tax  nu0oeto i3tad s2rl( pnt0 rtnio3iydopDe i i s0texmimpny1llt mfeta()aDtm(m ou1tpx  ieiat s ulnvsn() eeomo iytla r nvi ()srumxm3ou4lptemfctat sDuaurp;o1olen i3ilsfsDua(vs;t4trenxf3oadfm ranvslt t2xr(m ou4al   ivtat) Drax p;o1aetniociydfs2umnmo u4tlerir iy1fa   neslt  rur(o io4lmt  nctl(f rtrxmp;o0tpeo ictytfm ranvs;(0altnir iytfa  auvo t)t2ur(r3io1olee ncia( a2urxmpou0alxomfetyt m emnmp (0tleoir oatfptrlneilt) 2ur(o nu4lmenlnesls) Drm(  no0apeoifctytfs rau o;t0treoif tytlmD  u i s tetoxr oydamtnlies t)sDur( pnu1aeeoio3iaslm elnvpnt4 exnxo iotfaD aieo;s0seuoim3oydlmen nct (f 2rru ont1tetoii3tat m rl(mo;u0trxriocio1opDe nvo;t t2uoirpoo1openlfvsa()artm(m ;o1tltnii3iltfm2rlums ()tetrxo3iadfateluvs (  2tr(o3ou1alenmfvt t srum(rpnt4aexn oeilslm2rmnvont4 etrxo iy1opt lu slt  eumiopou1lm   iviat) ruax pnu0aleomictlt m2rlu pnu)aeeomo3oatla ranei;s0 rtoxr3oodll  mnei s sDum(r no4tltn ietaslmDel( s u4tlxrxo3iadlmtrluvo;s)tetmiopnodlm  mfetasfaDuaxr oo4tlxnioetlsfsDua( s;u0arenxrcootlm r iei t t2xrir io4al n nvsl() 2uaurpoo1tle miciltfm2ean s;u)arxoxr3iy1fm r ues;s) 2xm(o3oo1am nmncilsf Dua(m ;t4oex mi3tls mDeln ont) renmr io1opteau olt  2xoxo oudolt  iesat arrru  ;u0opt ifeild aDea(vp () rtnmr oodfmteluvolt0 exr(o3oydal  liesls)srra( pot4aeeoifeilslsDumumsn()trtnxf totfaD auei;s0s2umxm iy4am n icilt)arta(m ;o4alx mo3iyd s rmuvon()tetnxf3ootfm rlnei t  exrxr3oodlm emiviat)aDrm(rp;t0oltniociltfsDelu snu4 leoir3oodfptr i il( teumxm no4ameelivtlt sDuax pou1openifctld a elumsn(4altoxfcoydlmD an i;t seuriopnodllte ivsa()s2uaxmonu0oetomieiasfs2rm(msnu4trxoxfciy1omDelivil( trxmir oudoptnmicilt) rraum no0texomf3iytfm2raumo;() rerifciydfmD  nvi s) etmirpoodll n nctlt) 2tmxmp;u0altnmoeiyt m umnms;t4tltrmrctatlatelies;(  rumio3ny4llt liei ()sDtau  oo4apen ictas s2em( s;u0areomfctadlmt  nei;s)srxm(m io4lme lfet t)aruau pnu0texnioetad s uaumsnu4alxnmr3oydopD aies s)t2umir oudapte ictltfsDtmx  ;o4ape iicildfmDea(vs (0aetoif3oodlmD lneo s0 2tm(o oudam emneil() 2tau pnt0oltn f3ias m2um(vs;t) etriocty1lm rai i t  eumxopoydoltelneta()srta(mpot4alt mfetlsfm em( s t0artnif totfpD  ies;s) exoxm oo4lp nmfetlt)sDta(rpoo4olx  oeiysfa uaums;u0altrif3ootopDr i s s seum(mpiodop nlfcilt sDtmumo;t4tpxn fctatls rm(msnt0aetnio3iydoa  aiei;s0s2xrio no1op  mfci t  2rmum oo4ope  ociltfm2elnvp ()altrxrctydla eaivslt)texriopiu4omeeliesatfa2ra(  nt4aetn oeiyd m emn pnu)aetnxr3oodoa e i olt0srxrimpoo1ll elfes ( aDur(mooo4opxomo3ildla2em(mo u0tlxrifctodlateaivs;s0 rtrxr3ny4lmeelncs ()s2rrxmont4teeo f3ildfa2emumpnt)teeomrciotfm   ueo t  etr(o3ou4lpenmfctat srrmxr nu4alenmfeiltlsDel( snt0teenxr3tydoate uei t)texr(opoy1lme liei t sDrmuront4apenmfctas a2el(vo u) rtrxr3iytfaDe ieo;s)setrxrpnu1lmt  netl(fsrumumooo1tpxn oeiydfaDel(mo ()teenxf iadoptrau o t  eumxrpiu4lp e ictas s2rmxmpnu1apt moetysfm2umumpn(4aetnxr oatla  luvo s)teuoiopny1lle  nci (fsDtmxronu4tex ifciysfa2emu o;(0tltniocoy1laDeaivi;s t2tm(m nydap  mnciat)sDtr(m no1ape ioeildlsDem(vont0artrxr3ty1fp   u o;(  rxmxmpnu4omee nviat)srumu  ot4opt mf3iadfs umumsnt4 rxnif iydlaDrln ilt  2tmir iu4amenlfvtls) 2rrxmpnu1alxoii3iytfm2umn o;()teermr oo1fmt aieol(0t2uoiopno4aptelfet ()srrax pno1tlt mieiatlsDulu s;u4tleomf tydfm ran sl( srxmxr3oudlltnmnvt s sruau  ;u1olxo i3tldlmDulnvs;(4trermo io1oat lnvi;t  rxmirpno1oltnmfvia() 2rmx pnt4apt mi3iysla uanms;u) rtnxf3ootomte uei;t) 2umio3nydlpte fetl()a2rrxm nt4oeen ocilsfaDeauvon(0texrmfcia1lm   i o;(0 exm(r3oy1am  mncs t) Dtax pnu4oetnifcils a2ra(mp ()trxrxo oodfm  lu ol(  etmxopio4ame  ies (  rrru p;t1tpxnmo3tasfs emn o u)artriocoy1oaDr ivo;(0seum(rpnodaltemnvsasf Drmum oo1oeen ociytlaDrl( p t0 ltrxfctodoa  ln olt0 euo(m oo4lpt mfes s aDuru o;t1alx mieiys sDrlump (0arxoxf ootlmte neil() exmxo3ou1llen fvta()srra(rpoo1oltoiicils mDrl(mpnt0teeomfcto1lpDraivs;s sexrxm iu1ol e ictas)s2urumooo1tpe if3iadlm2elumo u0 rtomo iytfpt an i s sexo(m3nodlpt micsa()aDrmur no4tpto o3tat m2um(vo (0artrxfciadlaDraieo s s2ur(m iudap  mfcsltfs2rmxmoot4apenio3iatfsDuln p;u0artnir ootlmte nvo;t0s2xrxrpnudlmt mnet tf Drauront1tee mo3iyt aDrmu ont4areomfcoy1fatrai s t0 exrxm oudlp elfetasfaDumumono4oet mfeilt m2uaump t) rxnxf iadla e iei (  rxr(r3oo1al e nesls srtm(mp;u4olt io3tlslm2rlu o;u4 etnxo3oy1lptr n o;(0 etr(rpiy1ome mies s srtmxrono1tptnmoeiltlm rm(vo;t4teerxr3ootoa raivo;(  rurir nudap nlfesatf Dtaum nu4ale mf3ildlsDelnvpnt0trxomr tytop e nvo t0 euoimpno1ape lfvt tf 2taxmpoo0tpxomo3iltfaDum(ms;() renxr3tydlp rluvo ( texo(rpiy4al  mivsa(f Duru p;t4teenifeiys sDeau snu0aetoxr iatlaDeanvo;s)srtoxopoo1op nmietltfaDra(rp;t4aexnifciytls2eauvs u0alxrio oo1fa  anvslt truoxr io4aleemivta()aDtaum ;o4tle moctad mDeanmp;t4 renxrcoodomDe ues t) rtrxo io1oleemnet ( aDtrx  oo0tlt mfctldla um(vont) etrxo3totlaDean i t0 rxm(mpoudolt  neiatf Drm(  ot4oex  ociadlmDrauvp;(0 etomr oydlm r nvi;t trxmxrpny4ape  ict tfa2ua(  nt0aetomfeilsfsDeluvo (0treoir3oa1lmDraies;s0s2trir ou4lpte nvi sf 2ra(rpot0teen octltlm2uanvo (4aeenxo3iodlp eauvslt0setrxr nydoptnlfcta( s2ra(r ot4altn ieiys aDuan s (0artoir3oo1fmDrlivslt)trxr(o3ou1apt mfvs ()sDumxm ot1olxoif3tadlsDulumsnu0 rtoxrciydlpD auvolt teuo(m3oo1lmenmici ()sDtm(m ot0oex  o3tas sDeln s;t0tetoxo oodlm  lu o;(  2tmxr3nydapenmfcta( arurx  nt4tetniietytlaDua(mp;(0tltnxociotlpD  ies;s)t2trxr3iu1olt  feil(  Dtr(m no0alx  oeils m el( p u4 etrmf ootla e ueslt0 rxrio3iy1am emfeia() rurumo;o1tpenmfeiadlm2ea(vs (0tltrmrctytfp raieo t0 etrxmpou4amtelfciasf 2ua(mooo0tpenmfctlsla2um( o t4artnir iy1opD  nvo t0 eum(m3nudoltemnvt sf 2rau pot0oltn ictytlsDuau p u0 rtrmo iodomD  u i;s sexoxmpnudlptnlfesl( a2ur( pno0tpeoifciydfs el(vs u)tlerxf tydlmDrln i s) 2ur(r iodlmenlieiat) 2um(rooo4apx  ieiadfaDum(mp;u) reomo3to1oaDran s s  etrxr io4amtemncs s aDumu pnt4texn i3ildfa ea( o (0tlxoxocootoptrauesl(0t2urir nydlp  lnvsl(fa2rmx pnu0ope  octat a2emnvpnu0 ltrif tadfmt  i o;()trtm(o3iu4am emict () Drrxmp;o1oeto ietldfaDulnmpnu4teenmociodoa rlivslt0setm(o3oydapenmiei t  rtau p;u4tpe mocilsfs uluvs;(4 exomrctodlmDr iesls) 2xrimpoy4ale lfcslsfa2um(mpnt1aetn i3iadlmDumuvo (4arermf iytlp rluei t  etmxrpiu1ome  nctl(fsDurumpnt4aptn i3tlsfsDra(vo;t0aetnmoctytlaD anvo (0s2uoim ny1ale  ies ( s2tmu pnt1opt  ociyd aDua(mont)texrmr ootomte ues;s trxoimpny1om elfvs s)a2ta(r nu1texoiocilt m ea(vs;u4 rtnmf io1lmD  uvols s2tm(r3ou1apen ici s) Dur( p;t4olxnmf3tadls2rlnmp;u4 lxnxo oodop   u s s  euoxmpno1lp n fctltf Dua(  no0olt  ocilslaDeln o;(4 ltoxr to1latranvils)teum(m oodop  mnesls aDrr( pnu0aet micias aDemuvs;()alxrio3iodfmt anvi;t) 2xoir iu1al nlnvs s) Drmumpnu1tee miciltlmDrauvo () lenmociadlatelues (  rxoxr iu4om e ivs ()s2ta(ro;o4aex  iciadlm rm(vsn(4 lxrmfctadfptelivol(0srxrxr no4am  mics t a2rax  no0teeoio3iydlmDrmu o;(4 exnmfciatla r nvi;s0trxoio oy4lptn fvsa(farrmu p;t0oetnmo3ildfs elu s u0 ltrmo oatlatrauvol()seumio iu4omtnlfctlsfa2rrxmono4aexn i3iaslmDemu p t) rtoifcoytoptr uvi s0trxmxo iy1am e fvil(f Duaur nt0tpx if3iasls umn pnt4tltrxf3oy1faDrau o t0trxrim3io4optelnvta( srtaumo;o4tpeo f3iatls2eanvpnu4 etnxr3iotfp   n i ( sexrio io1om nlfvil( aDum(m nu1alxomfcils m uau sn()arxrxrcootfm  ai o;s) rtr(opnu1lm nlnvtas  2raur ;t4ape iociytlm2rmnvs;t) rtrio3oydlmDe ivilt) rur(r io1ape lictl(faDuauronu0open ieild aDumumpnt4trtnmrcoadoa  luvi s)sruoio3iudom nlfcta()sruaur ou4tpeomo3tasfs2rm(vs t0 rtrxrcoadom  livs;s  rurio iu4ap n nvsl()sDumumpot1open iciad s rau o ()aleoifcty1oatrlnvs;s0sexriopny4lpe lfvsl(  Dumxmpno0alxomictasls uluvo t0tltnmfcoa1laD ai o;s)truo(opnu4lp  mfetls artr(  ;o0oleo o3tyd a uau p u4arenmr ootlmDr ueo (0t2trio nu4lmenmncs t)artru oou4tlxomi3iltfmDulnmo;t0alxoxr3oadfmDrauvo;s  rtoxr nodolt mieilt)aDtm( pot1opeo iciydfa2umn s;u0teeomociydfp  lu ils0teumimpoy1aptnmfcs sf Drmxr ;o4opeoii3tltfsDrm( o;t) rtomr3tadlpt  nvi s0truoxo3iu1lm emivil(  Dtrx  oo4aptn fetydla ea(vpn()texoir oytlp  aneols trtoxm iodalte ici s)sDurxmont4opto i3tyslaDeauvon(4aexomf3iytlm eauesl(0 rur(mpoy1optnmncta( sDraxrpou0tee  oetasls2emu snu0aeeoxr3ootopD  uvi s0 eurio3iu4ll e nci s  rrmxmpoo4ope iociad s em( s t)tlerxr oatom e uvilt0trtoim iu1ll   feiltf ruax p;t1olxnif3tys m2ul( onu4aexrio oytfmt  ues (0t2toim iy1am elnetas arur(rpnt1texn ieilslm2ranvs;u)alxrio3tydfa elnvi;s)srxrxrpny1om n icslsfs2urx  ;u1tpxo ieiltfs uanvsnt) rtrmo3iadfm   n s t) exmxm oy1alt  fes tf Drrx  oo1tpen oetatfs2em(vonu4aexomf3tydfmt li s t) 2xm(rpoo4am n nes t s2ra(m ;o0ape mieild m2rlnvon() eermr totfa ran s s) 2xoxrpiydamt  feilt) rtrurpnt0tet iictyt s2rmuvp;t) rxrmf3ia1lmDr ivo;( t2xoir3nudlme  iet t srtm(m no0oetnmoetyt a2emumsn(0altoxo3oodomD ln i;s) rtr(opoudll   feslt)a2um(mono0oex  o3iys mDrl(vpnu4 lxnmf3ta1lm  luvol(0trto(o no4lpenlfcsas  2uaxr ;t1tpe io3tas s elu s;(4aeerir3oa1lmt ln s (0teuo(o iy1lp   ivsat) Duax  ;t1aee if3tyt s ulumo u0alerio3ootlmDelues t0 rur(o3oy4alenmfvils) Dta(r no0oeeo iciysls2eanvp;(4 eeoir3ta1lpDelueo;s setm(mpiy4olte ivsa(fsDuax oou4tpeomfctasfa2rmn s;t0 leoxfcio1fm elnei;s0 ruo(r3iy1ole  fcsatfarrr(r ;u0aex mfeilt s rluvo;u)alxrirciadom e nvol( tetr(o oydlm  mfct (faDrmxrooo1ape iicias s2ua(msnu4 ltnifctadfpDrliei (  2ur(o ny1ale mfvsat)s2um(mo;o1apeomo3iadfm2rluvp t)tltnmr tytoa   iei (0 eumxr3iy1om   ncsa(  2tmxrooo1openmictlsls elumpn(0 lerif3totlptr u o t0seurim3ou1ome lfci t srrrxmpou1oex  ietysfmDrl( o;u0trtomf3oy1oaD li ol()srtoir io1apenmfvtas a2tmxmpnu0oltomfciat a2rau pn(0texrxr ta1oa eluvols)setoir3iydaptnmivs ()s2tr(mp;u1tpxnmociatls eluvs;()tltnxo oatlmDrauvo t  etmxrpoo4op  mncsat)s2tmxroou4apt iictldlsDum(mpnt) ltoxf oa1opteli i t0 rum(opny1lpee ncsls)srtru o;o4alxomf3iad mDrluvsnt4aeerif3ty1fpD luesl(0s2urir3oudll nmfetas  2ra(mo;o4tpxniieilt m2rl(ms;t4trenio tadfptelues t  rxmirpou4omtnmfei (fartrx o;o1tet ioeilt m2ea(vs t) renxrctadlp   i i;s0 2umxr3io1alt  ieia( srtaurp;t0aleomieias mDra( o;u0 lenxr oy1fa eanei ()t2xrir3iy1amtemfvtl()srumxr ;o4tetomociadla2eln s;(4aetnio tatlmDelnei;s)srtm(o3iodlme  ivtlt)sDuaxroot1oex  f3ilt sDrm(vs;(0 ltrio oodfa r ueil(  rto(m ou1lmtn nes (fs2umxm oo0texoiiciaslaDua( p;t4 etrmo3ootom elnes;s0srumim io1lptnlnctls arua(m ;o4aet ifeiytfsDran on(0texnxr ootoaD aiei t  2xrirpny1lpee nesls)srrmu  ;t0aetoif3ils a em(vp;()aexoxrctadom eauvil(  rxr(r3iy4ole mnvsl(  Drrx o;t1oee moeiadlaDuanvo t4tetoifciatoa rluei () etmxr nu4om   neia(  rrax  ;o1aeeomocilslm2emnms;(0tlxnir todop ranvi;s trxmim io4aptn nvs t) 2trum no0aeenmiciysla2elumo (4arxoxf3io1faDe ivi;t)srxrxmpou1al nmnesa()sruaxm ot0oleo i3tydfs2ra( onu0 rerio ty1fp r n i;t) eumim3iydomee fcsas) 2tm( o;u1apen f3ildla uaump;u0trenircta1fmDrli sls)s2xm(r oodamtnlnetas sDuaxrp;o0oleo fciys m ra( snt) leriocoy1oat  u ils)trxr(o io4optnlivilt)a2rrx oot0aexnmfciyslsDranvsn()aetoxrcoo1om r ivils  rtr(rpiodlleemnvia(fs2umumooo1aexo o3iytls2rmuvs t4aetnxo3iotlmte nesls0s2uoio nydoptn nvt sfsDtmumooo0tleomoetydfsDua( o u) lxnmrctytfateanes (0s2xmio iu4op nmfet tf Dumxr oo4tpx ioctas s2rm(mo;t) renxr3oatfpt  nvo;(0srur(rpoodomeemics ( sDra(rono1aetomi3ilsfm rl(vpn()texnxr3iadfa  ln s;t0trtm(m3iu4lp  lfet s  rtaxm no4tlxoifeiyt a2umums t) ltrxr iadfp rlnvols)srxoio oo4olee fciat)arur( onu4ale ifctyslsDum( on(4 rxnmrcta1fpDr uvil(  2xr(mpny4op   fet ()a2trxm ou0olxnif3ilsfm ul( o;t4aleomf3oatfpDr u slt)t2xr(o iy1ale  ncsl( s2uaumpnt1oltoifetat a2ulu s t)tlermo3oytoaD  ueslt seum(m iu1amtn icsas) 2rax oou1tpx  o3ilsfa2rmump t)alxnxr oatla e neo ()seurim3iudll emfesas)a2tmu  ot0opx mocilsfs emu pnt)arerif3oo1fpD livs;(0sruoxo3iu4lp n fvs s)artmu  nu0tpxoioeiydlm rmn o;t)arxrxf3ootoatrlnvsl(0trxrxr3oy1ap nlneta( s2ta(m oo0tlxnifetatlmDemumpnu4texnif ta1laDrlues;s) exrir oodolenlfcsat) Dur( pno1altn f3iytfa eaums (4trxnmf oydlpDranvi s truoxrpiu4aptelies t s2rm(ro;t0apxn i3iadfm2rmnvo;u)tltnio ta1oatr ueo ()truoiopnudom e nvs t) 2tau pou0tlx  fetadfs uanvp u) ltoir3io1fmD  nvil(0s2um(m no1al nlfvil()srua(mp;t0teeomi3iytfmDrmnvo u0artoioctydfa  anei ()teum(o3io1lme lietlt s2taxrp;o4texo ocilt m2rau o t0 lenmf3tatfm  anvils0trtoxr oy4alt lfet s) rur(rpou0apx mf3iytfs2uaums;u4aexrif3iy1opDe u o;(0s2urio3iudome miesat)a2taxrpoo0aptn f3iltfa2eluvpnt0trxrmf3oo1fatran il( texr(opno1ape lfvtls srrmu  nu0alto feiytfa2rl( o (4 reoir3oodlp elnvi;t t2tr(o3iodomee ivsls a2trxrp;u0tltoiiciytfaDumn snt4 eenir3iodlm  ai o;s)t2to(o3ou4ameelfes s sDtmx oot0tpxo iciysfsDrmnmo;t)texrmrcoo1omt  nes (  etoimpiodalen ivtlt a2rrurpou4aee  ieiyt sDeanmsnu4arxoif3oatlateanvo t)truo(o3iu4op   feslt arumumoou1apxomf3iytfa2ul(mon(4 ltoxf oatfmDrluvs;s)srxoxopoudamee icta()s2tmurpnu0tlxnmietas s eln snu4aetnxo oadlpt anes;( trxr(m iy4apt lnctlsfaDuaum ou4aeenmf3tad a ra(mp (0aexrif3iy1oaDeauei t teuoimpiydomenmnvilt  rumxmpou1ape  fetld s ul( on()alxoifcia1lmtr nvolt0 2to(r nydop nmncsas)srumxmoot0tee  o3tldlmDra( pn(0tetomf oo1fm  auvs;() ruoim no1opee neta(farra( onu0apx mf3iyd a em(vo;u0arxrif3iatla eaneolt) exoiopou1olte fetlsfaDtmurpnt0opx  ieild s2rm( pnt0 ltrirciadfp  lueolt seurir3io4om nlfcia(f 2tmumo;u4tlx ii3iad sDelnmp t) rtrmf totlmDe n i;()trxr(o3io1optnmfesasfs2rru oot1aetnio3tldla rauvpnu4 reoifcty1om rln i;()srum(r nudopenlneil()a2rm( pno1tleoiiciadfmDra(mont0tlxrxo3ta1lpDelieilt texr(o3oy4apt livsa(  rrm( poo4tpx  fciytfm eluvo t) reomr3iy1fmD li i;t  rtr(r3oydom e nei (fs2rrx  ;o0tlxnmi3tltls el(vs;(0aexoxo iotfa e u s s  2um(rpiu1alee fvtlt a2tauroou0apto fciadla em(mo;()altnif3iydfp e uvo t0 exo(m3no4op nlnvsltfsrtmxr ;o1optnmoctls a rm( ont4 exnir3tydfmtrliei () eumxr3io4ale miesa(fsrtr(ro;t4aexn ictltlsDrl(ms;u4 lxnmo3oytlpt lieo;t trxrimpou4alee ies () Dtmxmpoo1alenii3iyd aDumnmsnt)trermo3iytomtr uvo t0s2xm(o oy4altnlfvias aDrrumont1tlxnmoctyt s raumonu)trenxr3ta1fa  luei s texrio3nydapee fvs s)aDuaur nu1optnmieild mDelnvs ()trenxocoodopDr nvil( seumirpiu1olenlnvsls)aDuax pnt1oeen i3iltlm2emnmonu)artnmr3oadom rluei ()t2xoxmpnydam nlnviatf 2rmxmpnu4tet  f3ildls eanvp;()arxomo3oo1oaD lies s texoiopou4olenmncias a2rrurooo1openioeiatlm2rl( snt) exoio totoate iesls)trtm(m3iodam emictls aDtaumoou0tet miciys m eaumpnu4artrio3iatoaD ln slt0 exr(opoy1lpt lics t srua(mpnt1teen fcild aDrm(ms (0texrio3oytfmteanvo (0tetoxr3oy4lpe mnvsat)arrm( p;t4optniieildlsDuln s t4trenio iodomt aues (0 etmiopoo1omee iesas)a2tm(mp;u4tpen ieiydfa2el(vont)trtrxocoydfa eau s s) rum(o3nodamtnlfesatf Dtmxmpnt4tpx mieiltlm ra(mp;(4 lxomo3tytfmt  ies (0 exr(m iydll n nctltf 2ra(mo;t0oet mi3tldfa uan ont0trtnmf3ta1fp eln s t) etmir ou4al n ieia( s2ta(  ot0aeeoiictld a em( s;(0arxnxr oytoptr n o;( t2xoio iy1al nmfvi (f ruaxm ou4tlto fciad m2rm(vp;t0arxrir3to1opDrai i;(0srtoxm oy4olt lfvslt aDrr( pnu4tex moeiysfsDea( sn(4arxrio totlaDeauvs s t2xo(mpio4lpee nesltf Duaxrono4tleomiciytfs2uluvs (0 rxrmo todlatraivs (0 etm(mpoy1llenmietltfs2uaumpno4opxomictls m emn sn(0altoir todfpDr u i () rxrimpoydape  net ( a2uau  ot4ape mi3ild mDeanvs () rtnxr oy1omte nvs;s) 2urxm iodamt lfei (  Durumono4tlx  fctysla2ul(vp;()aetrxo iy1fmt ln i t)trumxm3oy1op e ivsa()sDrrx  ;o1apt ifetas m rmnvs;t0aetrxf oydfaD  u i s) 2urir3ou4omt mivs t)a2ra(r ;o4optn fetatfa2ean ont0 rtrxo3oa1omD ln s s trurim nydamt  fes (  Durxmono0opxomi3iasla rmnvpn(0texnmr3ty1laD anvsl(0 etrxm iodlme  ieias  2urxmonu1tetomictyslaDrl(mo;u0teenmf3iotla  lnes;s0 2to(rpnu1ap n ivtls)s2tr(rpoo0oeen ociyd s rlnvp;t4aetoxo3oy1fm rluvo t) exm(opou1lpeemncsl() 2rrxmpot0apen oetyt a ua(vs;(0altrmo iatoatr uvs t0t2umim3no4alenlnvtas)a2ur(mo;o4olt  ocias sDeluvpnu)aexrxrctodfatr n i t  2xmimpoudlp nmicsas aDrmuro;u4olenio3tldfa ul(msnt)trxrio3ia1om raiei;t) ruoxo oo1om   ivtl( a2ra(r ;u4opxoif3iyd sDemuvs;t4trerxf3ta1oaD lneo s srtoio ou4am n nctat)s2rm( p;u4apxnmocilt m ea( s;(4areoio iodfmD  n o;( t2uriopno1omtemnvs tfs2tr(rp;u1oexo octydls emuvs;()trxrmrcoatlpt ai ol( t2ur(rpiy1lmenlfei t) Dtmxm no0tpt ioetysfsDeanvpn(0 lxnmrciydop r n olt)s2xmxr3iudame lnctlsf 2umu o;t0oexomf3tlslsDeanmo;t)teenxocta1faDrlu olt srtr(m3iudamtnlfvtlsfsrta(ronu1tpxomieiyt m rmnms;u)tetnxrcoydlateau s s)s2trim iy1omee ivias  Drrxr ;o1olx mf3tydlm2rmn o u) etnxocoy1fp e nvo t0 etrxo io4olte ictas aDuaump;u4tpx mf3iltfmDrmn o t0tlxoxf todlat  nvi;t)srtrirpnu1lm n ivtls  rra( ono4aexnifctadfaDuau s t)tetnifciy1lp rln i;t)tetoim3io1am  lfeils sDrmxrpou0opeo ociatlm2rl(ms;t)aetrir oodfpt aueils t2urir3iy1omenmieilt)s2rr(root1oltn ictytfm2eln s u0trtrir io1om eliei () 2xoir io1am   ncsat artmu oou4oetn oeiytlsDuanmp;t0artnxrcto1om   nvo;s)s2urim ny4lp emivsltf 2urur oo4tetnmi3iys sDemnvs;u)alenmrcta1fa   nvo (  rtrxr iodopenmfei ()a2umump;u4olx  f3iltfmDemuvs (4aeenmrctytfmDelivo;(0 rxoir3iudomt mictls)s2ra(rooo0oltoif3ild mDeluvsn() rxnircoo1lp  ai i t  eur(m3ny1olt  nvias srurxmo;t4opeo fciatfm rmu pnt4 rerir3tydopD  i s;() rtmir iodlltnmnci s artaxmp;u0teeomieiys a uaumon(0tlxoxr3ta1oa r nvs s t2ur(r oo4omee nvsa(fa2trumpno4oetn ocild m2ra(vo t4aetrif3oy1lm r n il()setmxr nydape lieia()a2rmxmpnu1olx  f3tysls em(monu)altrxo3oadlmD ai i s0trur(r iy4alee iei tf Dtrxr ou0aexo o3iydfmDrl(mo;u4artrio ootop raieslt0t2xmio3oudapt  nctl(f rumx o;t1apx io3tasfa ra(vont4alerif3ta1om  lneol(0 ruoir ou1ame mnesa()aDtmum ou4altoiociytfaDumumsnt)trtnifctadfmDelieslt)teum(o3oy1ll n ivia(fsDrax pnt4oex  octls a2ea(von(0artomf3iydlpDeau sls  2xoxmpiu1lpen fvi sf Dtaurp;o4ale moeiytfm ea(mp;u0alxnmr oodomD lnvi;(0teurim3ny1ll  lfeils artr(monu1tptomo3tyt aDulnmo;t4 exrxocoadfaD ai i;t0setmxr iu4llen fctat a2rmur ot4oeeomieiytlsDua(vp (4 lxrir3oatoptrauvolt) exm(o nydamtemict ()a2urumo;t4oex  ieilsls um(mp (0 lxrif3to1fpteaivilt)t2to(m3iu4lm  mneia(f Drrum ot4opx moeiltfm2rauvs;u)altrir3iotom rln ilt  rxoxrpnudoptnlnctatfsrrmump;u4aptoii3iad a eln pn()tetrir3ia1fmDrauvs (0sruo(m3iodal   ncsas)sDur( pot4tptoiociyslmDrlnms;(0trermo3iy1fa  lies;s s2trxopiy1omtnlieia(fs2urumoou1oex mfeilsfmDeau s () eenmfctydfpte nei;( trurxopou1optelfcs t sDurumoou4opxnif3iatla emu s;() leniocio1fpDeli o t)srxm(r nudaptnmfetatf rtauroot4alenmieiys a2ea(vp;u4 etomf3oy1oa e iei;( sruoimpoodllenmnesls)a2trx p;o1oetn ietysfm rmn o;u4aeermocoodfat luvils0 etmxmpnudlm nmncsat  Drr( poo4olxo oeils s elu pn(4tlxrifciodlate n il(0sexrxopnodlmeemnctasfaDumur ;o4aeenmfcils a ranvo;t)alxrmr3tadopDr n s t0tetrxo3no1ap nlfeil(f rtrx  ot1ole  oeiydlmDrm( o t0tleomoctatopt aivs (0seumio3iu4lmtelfvt s)sDtrx poo1alen oeiyslm2ea( p (0 eenxf3to1lpD aneilt0srtoxr iydol e nci sfaDtaurpot4olxn fctatfm2umuvo u0aetrif iy1lp e nvols  rur(opnodomtn fvtat  2ta(  ;u4optniicild a2elnvsnu0texrif3totom eln s;(0trumxm io1omt licilsfsDta( pnt4apt moeiad m2elumo (0tlenio3ia1oatr ueolt0 exrio iudlme mivta(fsDta(m nt1opxn i3iltfmDumn pnu)trxrmr oy1fm   u ils)texoir3iodol nlfvslt) rtrxroou1opeo fctlslm emnmp;t) lerxoctotla rln s;() rtm(m iudllen ictl() rtrxmpnu4tpeo ociysfaDumu s;(0tltoif to1om  aivilt0teuoir oy4olt  nvt s)s2taxrp;o4oexomi3iadlm2ulnmo;(0arerxr tadlatraivo;t) 2tmxm3oy4al nlnctat  2umx  ;o0tlt if3ils a uauvs u)artrirciytoa r i i s  exmio3ou4lm  mfvsl()sruaxmonu4oexoioctldfa em(vo ()aexoifcoydoaDr u olt0srxriopnodllenlfcsat) 2rr(moou0oltoio3iyt s2emn s;(4arerxr3totlmDrlnei;( s2uoimpiydal e nci sf Dtmu poo1olxomo3tlsfaDua(mp;t)tlenir3iydfmt aieo;t) rtmim3oudomtn ivtlsfa2rr(rono0aeeoifeiyt s rmump (4trxnxr3iy1lmteaies t t2uoxr iydoltnmfvslt)aDraxmo;o4oleo o3tatfs2uanms;t0teerxfcoa1laDr uesls0t2um(opnu1omt mncil(  Drau poo4olx  fctltfs rau onu0artnir oy1om  aiei (0s2trxmpiydamenlictas sruaxrono1tleoifctas aDrln p ()trerirciodlateanvs s  rtrim iy4om e ivt s srurx  ;o1oleomfeildlm umu sn(0tleoir ty1fm ranvi;t truo(mpio1ap nlies tf Durxmp;o1oleo ociydlm2elump;u4 etnmrcta1fatrlueol(0sexo(o3iu1optnlicils  2urump;u1aptomoctls sDeaump;(4tetoirctotfaDr ivs;t) 2toxrpou1om nlfciltf 2tmxmo;o1tpx  f3iysls2eaump ()teeoxfcoa1lp   uvo;t) 2xmxm nydopeelicsasf rrr(r ;t1alxoifciytfaDel( p;u0arxoif ootoateli sls) exr(opno1am n ivsasfaDumu pno0texoioeias s ra(ms;t)tetrio tadlateaueo t)tetrxo3ou4ap e fcia(fartrur no0oeeo i3iatlmDuanmpnu)aeeomf3iatlp r neo;(  2trxo3oodal emivtat aDrm(  nt0aleoii3iltla el( pn()aetoxfcio1fa r ivo;(  euoxm3io4aptelfvtl(f rurxro;o0tee  iciys s2eaump u4 rtomf oa1lmt auvs s0teto(m3nydop  mfci s) Dum( ont4tltn i3ilslaDumn p t4 lxrmfciydoaDeaieo;(0sexm(o no4lptelnes t srrmx pnt0aptnmociyd sDra(monu0 reoiociodfateaneils t2xoim nydllee feta(faDurxroou0tpxnmi3tydfm rmnvpn(4tltoxocoodlaDr ivs;t)t2uo(r no4op emicsas)s2tr(ro;t4opxomfeiasla2em( s;(0aexoxr3tatlmD anvo;s0tetm(o3nodlmtelfvils  Dur(m ot1oetoiieiadfaDrmnvsnu4tlxrxrcio1fat aneol( t2tm(mpio1lm nlnetl( s2uru  ou4oltoifcildlm umnmonu0alerxf3oadoatean o ( s2xmirpnu4opte nctlt)s2rrum oo1aptomi3iyslmDra( pnu)artoircta1oa r neo;s)sexo(m ny4amtnmfcia()s2taxrpnt4tltnifciydlm2uanvonu4 rxnmo tatlm  aivslt0 ruoir3ny1lm nmiet s)s2urumpot0texo octysfm2elump;u0 rtnio3iotfp   nvs t srurimpoy4lmen fetas) rurxmono1oltn octlt s2uan o t4tetrio oadoa rln ils0trtrir3oudapeemnvs s)srum(monu0aeeoii3iadls2raump;(4tetoir3tytopDe nvs;s)texmxr3oydom   ncs t a2tm(ro;t1tlt mfcild a2uaums u4 eerxo ty1lpD aieo ()srurxopoydlm n neils arrr(m nt4olx if3ilslaDran s u0tlxnmrciytfa r ieo (0t2ur(r no4altemicils) 2ururpno0apx  fciasfa2elums t4tleoxr3iy1lm   i s s0s2umxm oy1lme mfetls)srua( ono1tex mo3iadla2ranmo;u)alxnir3tydopDr u s;s) 2uoxm3nudamt mnes (fs2ra(root4aet iociaslm ulnmo;(4texnxocoadlm r uesls) 2tmio oudapen ictl(f 2urur ou1ole  ieilsfa ea(mo;u0 etnxf3ootomD aivo s0 exm(o3io4apenlnvslt  Dumxrpnt1optomoetydla2em(mp u4 lxoio3iydfa  luvs t)t2xoxmpiydll nlfvtat)sDtaxronu4opeo fciltlsDumu onu0tlxnir3tatlatrai o t0 2xoxopiodop  lnci t aDum(m no4tleomf3iltls2uaumo t0altnxr3oydfat lnes s0trtmimpny1lpee ncsasf 2trumono0teenmictys a uauvp;u4trerxr3oadlmtrlies;( s2xoio3no4ap e iesl( sDrr( poo1aleomf3iaslm raumo;() rxrmfcia1fpt anvi s t2uoxr3nudop   fvil() Dumu p;o0aexo feildls rl(vs t0 lxnio3iadoa e n o;t texmio nu4optelfeta(f rur(r ;u0oeeo fetydla2el(mp u4aetoxr3iadfat luvi;s)s2ur(r3no4am  mncta( a2rau  nt0tle ifctas sDemnmon(4trxomfciadfmDr ivo;t s2xmxr3iy1altnlfvsls) 2rrum ;o0opeomociysfa2umumpnu0arxnir oadlm r u ilt)sexo(rpou4omtnlfetat arraxmono0tee io3iydlm rm(mo t)altnio3oa1omD  n o s seto(o oy4ape mnvtlt)a2uaurpoo4aptoif3iyd sDulnmsn(4tetnio oatfmtr i i s0t2tmxo3oy4lpee fcs ()a2rrxrpnu4olxo ietldla ulnvo;t) reomo ty1latelnes t sexoxr3iodamtnmnesls)s2raump;u0tetn feiltlaDranmpnu0aeerxrciatoat lueolt  eur(opoy1ll   ivtas s2umu  ou0oeeoio3tys m2eaumont)tltoif3oa1fa  anvolt) 2umxr iudap   ivsas  2rr(rpnu0oex ifcilsla2eanmp;(4 rxoxr io1laDe u o t  eto(o ou1op   nvsltfsrtmxr nt4teeoiietytlsDul(vo u0aeermr tatoaDrau o;(0 2tm(o iu1aptnmiet s)aDtrxro;o4olen feiltfm2uan ont0tlxrxrciodfmt  nes t0s2to(o3nu1ole livtltf Dtru  ;o1optnifciaslmDulumont0aeeoif todfmtrau s;t setoxmpnydapeemnet tfarrmu oot4olxn ictad m eaump t0trtrif ty1omtr uvs;t) rtr(mpnu1omt miciatf Duru  ot4tex io3tldfsDumumo t)aexrmr3iatoa  lnvols trurxo3iu1lltnmivta() ruau pno1tlt  feilsla rmu pnt0 eeoio iydfm r nvo s t2xo(o iodlmtn fctasfs2tax ont0tlxomicilsfm2rlnmp (4trtrmo io1fm e uvi;t)teurxopiydole  fei sf rtr(  ;t0altnii3tlt mDuln snu0texrxrciotlmDe nvs t)t2umio3iy4lpte ici tfsrta( oot4alt mfetydfs em( sn(0arenir tatopDraueilt)trxoxmpiu1lptelneil() 2uaxro;o4apxn i3iydfm2emumsnu)aetrxf3ootomDraieo;(0setoiopnu1lp n ncsasfsrtm(mo;u0opxomf3ilsla ul(mp;u0texoif3oatlatr uvslt0trxmxm3nudapt mfcs (fsDtmxmpou4tee  i3ils aDem(ms (4aexoiociydfp r ivil(0s2toim3nu1ap elfcsl(fsrtm( onu0oexn fctyt m rauvo;u0aeermf3oatop elieil() etoxo3oydol   nctls)aDtru ooo0tlt mo3ildls uanmsnu)aexnxr3tydlp e u s;()setmiopnodam emncsas)sDta(m no1alt ifcilslaDrm(mont4arxoxr oodfm   nvslt  etoiopno4alt  nciat)sruau pot4alxn feiyt s um( on(0 eerxo3iatla rluei;t0trtr(o iodop  mnei (f Dururono1aeeoifetlsla2um( pn(4arxrif3oodlm elnesl()seur(o no1ome licsat)arrau  ot1tpxn ietysfs2rln ont4 lxnifciatfmte iei t s2tm(o3nu4ame  ivtas aruru o;o0opxnmo3iyt a2uauvs;(4arerxfciytlp elues;s0s2xrxr3nu4ap nlivsas)arrr( p;t4tpxn feiys s ul(vpn(0tltrmrctydlmD  ues;( t2trim3ny4opeemfvtatf 2truro;t0oltniietysls2rluvonu4tleniociydopDeluesls srxoim ou1lp nlici t aDtr(m nu0altnio3tldfa ean s;t4tetomrcoodoaD an s ( tetmim iudape mfei sfarrrx poo0alx mo3ildfs emuvs;t4aeenxocto1lat  u o;s0 2xrxr nu1ameelfvsas aDumx onu1tlxn i3iltfsDul(ms (4 eermf iydopD  ivo;s0 exr(o3iy1omenlneilsfarrr(roou4tlto fctad s uanvo;u0 reomf oytlmD  n ilt  etrxm iudlm nmnvi s)s2rrxr ;o1apt  fetad mDeanvs;()aetnif3tadlaDe u s s) 2umimpou4apee nctlt) Duru ono4oeeomociatfa ra(vsnu0tleoirciotop e nvo;( trumim3oo1llenmncsas)aDtmu  nt4tpe  iciytfm rmuvp;u4 renio3oy1lateaueo s) rumxrpio1lp e ncsl() Dtr(mono0oex iictyt m eln pn(0aleoxo3iadoatelies;s  rtoir3no4lpe  ictlsfsDrax o;o0apxoioetydfaDelnvp u0tlerif3iotom e ieil()t2tr(m3no1ame lnvi (fa2ra(ront0tle  o3iytfmDumu p;(0aetnir3ootlptrau ol(0 2trio iudlme  netl( arrmu p;u1tlt  ociytfs rau pn(0alxoif3ta1fmteai s s)trtm(o3no4al nlncia(fa2uru p;t0opxnmociys m em( o;u) rxomfcty1oaDr nes s0t2toio3iu4ap  mncsat arurx p;u1tet  ictltlmDra( p ()arxoirctydomDraivilt0 rtrir oo4alt  ivtls s2rmx pou4tltomoetldfm el( on() leomo3tadlpte nes t0teuo(o nu4lpe mnvil()sDur(mp;u1aexomocilt sDelums;u)arxnxf3oodfmD ln ols s2triopoudalee fet s)a2tmxm ou4altomo3tat m ul(ms u4tleoxoctadoa   ieols) etr(opoo4llt mieta( s2rmxmpoo4texomociatfa uanvs t0aeeoio tytfa rlivs;t0t2xm(r3nudom  mnet t) 2umurpnt0tltomieiatls2rm(vont)trtrirctadomD  nvi s)s2uriopoudopte fesl( a2rr(  nt0tlenmo3iydla rmnmo;t0altoxf3iydom e i ols0 rumio io4amenmnct t s2rmumont0altn feiltls2ulu pnu4 eenio3iotomDraivslt0s2urxm nudap  lnet (fa2raumpoo1olx mi3tlsfa2uaumonu4aetriocoadfm  aivol(0t2xmxm oodlpeelncs () Dtm(root4tee miciadlmDuanmo;() etoxo iotfp r ieils0 eurxopoy1al n fei (  2taur ot0opt  fetltlaDumu s;(0 rxrmr3oy1fp e nei ( srxm(r3ou1om nmivtatfsDrmump;o0opeoiociad a elums;t4 rtriocoydla eli o;t t2tmxm ny1ale lnetls)s2trx p;t4alxnmfeild a2emu o;t0 reomr3iatfpDr ivol(0trxoim3io4omeemncsa(f rrmu pou1apxnmociltfm2ea( onu0tltnxf oodfaDeln s;t0 exmxopiodom nmfci (faDtm(mo;o4aeeo f3tatla2rau sn()artnmr3iytlaD aivi;t)t2umxopoy1lpe mfvsa(f 2rrurpot1oeeoioctld m2uanmo (4 leoio oytoateaneo s0t2trim3ny4lltnmivt t)s2tmumo;t4alen iciyt m2rl(msnu) etnxrctydfaDr uvsls0 2xmir iu1apeemfvia(  rrrx onu4aeenifeiysfm rmu o u4 etrxfctytop eauvolt s2xoxrpno1ol n ivi t)a2raur nu1tltomieiat m ran s;u0 lxoxr3oa1faDrlivils texr(r3iu4omtnlivsa(f rrm( ono0tlenmietyslm2rauvp t4 ltoxocia1omt anvo (0s2xmiopnydopte fvsa( s2rrxr nu4tlx io3tls aDrln p (0trxnmrciy1latrli o;( trto(r3no1altnlivilt)arrrx  ;u4optoio3iyslm2rl(vp;(0trermociotlpt ai i s) rurir3io4lm emictl()sDumx p;o4tlt io3iyslm2rm(vo;t4altnmr3iotoaDeauvils  2xoxr3iu4ol   icils) Dua(mo;o1tleoio3tltfs ul(mon(4 lxnircoadlp  lies (0trtr(o3nodolte nesl()a2ra( ooo0alt io3iytls2ean ont0trerxo oadomt  i i (  2umxopiydlp emfvtlsfs2rr( p;o4optnmfctat aDua(vo u0altnio3oadlmt ln sl(0srtmio no4lle  ieia( arrr(m oo0apxoii3iytfmDelnvsn(4 eeoxf3todlm rlneo;t trxmxo3iy1oltnlies tfsrrr(r oo0aexo ictadlsDrluvp;u) lxnio iatfm e nvsls  rtrxrpnodolte fcias artm( onu4tlxomoetad m ra( snu0teenif3tatoaDrli i;() eurim3io4optn nes t  Dtrxro;u4aeenio3tatls2ul(vp;()texrio3tadoateluei;t) exoxr iy4opte icia( s2ur( pno1ope mieildfaDulu s;t4aexnifciydlmtrln o;s0trxm(opnodopte icsl(f 2um(mp;o4tpenifciytfsDum(von()aetnxocoytfpDrlnvo;t)srtmirpno4ap e nes ( srra(mp;t1ape ii3iltls uanmp;t)tlenxo iydfa eau olt)setoir3io4lltelnvs s)s2umumont4apxn oetlt sDumuvp (0teenmr3tytfmtr n i () 2xr(r iy4oltnmfcs s)aDuau o;t0oexomieiyd s2rl(mp t)tlxoio tytopDr ueo;() rxmxopnu1amt  nvia(faDurur nt0ape mfetyd m2emn onu4altrmfciodomDeaueslt  rto(mpou1olt mfcsasfarrr(ro;o4tpxomfcias s eanmp;t4 etnxr ootfmD lneil( trtr(mpnudllenlnvs s)sDrru p;o1tee ioeiydlaDraump t0teenif oa1fmDrlu s ( trxrxrpio4lme lfcta() Dtmxront1aetomfciadls rauvpnu4aexomr3iotoat aivol() 2xmxr nu4lm   fet tfs2tau poo1ole  fctld a2raumo t0trtnxo3oytlptr uvs;(0srxr(m3nudop  lfci t)s2ta(r ou0tlx mfetadlmDum(vs;u4trtrio oatfp   nvo;t) eur(m3oodalt lfesas  2umxmono4alt ifctldla uaums;t)aetomf tydlpDranes t)trxoir no1lptelies ( sDumxmo;o4tpx  fcilsfm rlnmsnu4aetomrcoatoat  i s;()sexoimpny4am emncsa(fsrtru p;o0alx mociyslsDea(vo () eeoxr3iydfp raivolt)teum(r3iy1omtn ivilt  2rax p;t1apt  ieilsls rmn o ()aetrmo3iotomtrlnvo;(0t2toio3iu1ll   fcilt  2umu pot0oexomiciyslmDea( s (4 etoiociadlmDr ieo s0sexr(o iu1olenlicsltfs2tmxrpnt4aeeomictltls2elnms u) eeoir3oa1fmtelnes;s sruo(m ou1altn fetat) 2tm( pot4tptn i3tadlsDelnvo;(0teeoxfciydoaD  ieil()setmio nodame  fvilt)aDtrxm ;o4apx mo3iat a2rl( p;(4tlxrxocoadlaDr i o;() 2toxopnydolte ictat)a2tm(  no1teen icild s emn p (4teerirciatoa  aieslt seumio3iodamte nvsas) rrru  ou1opeoioeilslaDumu onu0tleoio iatomDr uvo;s sexr(rpiu4lp n neta(fs2tmum ;t0tlxnmfetysfmDuan s (4 reoxo iadfmD aivo;t0t2xoir3nu1ome lfvslsfa2tmu oot4aeen oeildfm ul( p;(4aexrxr oatfaDrlnei;t0s2umxmpnydlme lfeiltfaDta(ro;t0aex iieiytla uan s;u0altoif tydlmte iesl() 2umimpny1lp  livils)aDrr( ono1tle  ieiltfaDelumonu0arxnmo ta1latean o (0tetriopio1amtnlfesl(faDtmx  no4tpt ii3iat aDumu sn(0tlermociadfmDeauei s0t2urim nu1omtelfvtas  Drauroot4optnifciad mDrl(mp;u)tetnif to1lm eanvil()setmxr oo1alee ivia(  rtm(r nt1optnmfcias a2umnvs t4alermfciatfmD ln sl(0srtmirpiy4om nmfci (f Draum ou1texnmi3tyslsDum(mp;t0aexoxfcoadoaD aues;s0s2umir ny1opeelietl(  Dua(mpou1apxoiiciadfm2em(vont)altnio totfatelues t)trxmxo3nodope  nvt sfaDta(mo;u0olt iiciysfaDumu o (0texoifciy1faDeau il( srxo(opnodomenmnetltf 2umurp;o4tlxnifctysfsDrlumpnu)tltnmf todlmDrluvo ( teurirpoy1op nliviatfa2raump;t0tlxnmoetydfaDra( p;t4arxrxo3iadop  ln s t)t2xrxrpiu1ale  fes t srtauroou4optn ociys s2emnmont4aetomf iydlp  lneo;()setrxo ny1ame mnvslt) Dra( p;t1aeen ieiaslm2uaumsn(4tlxoxociytopt lies (0 etrimpou1al nlfcias)artru o;t4ale mfetatlm2uau p u)areoirctatfm  lnvs s) 2xm(o3oudop nmfvias)a2rru p;o0tleomieiatfs2rl(vsnu) exomrciytomtean i;s0 exr(o ou1al nlfci t s2ur(m nt1tpt mociyd mDeau s;u)trtoxo iy1fmD ln i t)srurxmpiodole miei s)a2uax  ou4tlenmi3iydlmDulu pnu) renioctatfaD aivs t  2tm(r oy1aleemfctasfaruru poo0tleo f3iydfsDul(mo;t0arenxrctodfpteluei;s t2urimpou4am emnei t) rrmuro;u4tlenii3tydla2el(vsnt)artnircoo1fa   uvo s0tetmxmpio1amtn ivtl() rrmxr no0alxo fciasfm2uln s;u4 etnxo3iotlmD an o;t0texoio3no1omtelncsatfa2trx ooo0teeomi3iadfm2emuvs;t4treoio3iydoate uvo;() rtrxo iudamt mnvia(f 2raxmpot1tpen fciat sDuanmp (0 exnif oy1faDeaneolt teum(o3oy1ol nmiciltfaDtru p;u1alx micildls emuvo t0arxnxo oodopteluesl(0seuo(m3iydlp nmfvsltfartmxmpnt0apxn f3iasfs2ra(mo (0trerxr iytfa   uvi;() 2xrxo3oy1ope lneta(fsrrax p;o1oltoiietlsfsDemnvs;u4trxnxfctadfm   i s s  2tr(r3iy4amee ict tfsDtr( ono4opto ieiysla elnmo;u)artniocio1laDeaivo t0 exo(o3iy1al nmfei (farrau ooo0oexomf3iysls2ean on(4 rxrmr tytop  liei;s) rxoir3nodomtnmfesas)arurxm no4tpe mietlsla ean s (4tetnxfcty1fa rlnei (0 2trirpoo1aptn ivslsfaDta(r nu4tlxn fetydfa um(vp;(4teerio tadlat li s () exoxo3oo4lptemivsa( sDrmxr ;u4aexniociyslm uan on()arxrmfctotom rlivi;s0tetrir iu4lm emncilsfa2um(rpnt1aetn o3tlslm rm(vs;(4 rerif oydlpt  neo;t) rum(mpoodolte icta(f 2rmx pno1olenmfeiltls uan p;u)trxoir3totomte n s;t)t2urir3nydamenmnvias) Drrump;t4aee if3ildls el(mpn(4alerxf3oydfp e ieols)texo(rpiydol e fcil(f rtmx ono4olxnmo3ildfm ulnvo t4 exrmo todfpteluvols0tetoio3oy1opeemnvtat  Dtr(rpnu1oeeomo3iasfs2rlnvp () lermo ootlp ranvo t) exmxm iodopee netls) Dra(mo;u1alxnio3ias aDran o;u0treoxrctotfp ranvs;(0 exmim iu1lltnmfei tfaDtauroot1oexn f3tls s2eanms t)texnir to1lptelneslt) 2ur(m3oo4opt  fcil(f Dtmx p;o4tetnif3tys sDrluvonu4teeomrcoa1oa e iesl(0s2xm(m iu4ol n nvsat  rtru  nt1tpt mociad m2rm(vpnu4tltoifcoadoateaieil(0s2xo(opnu4lleelnci (faDumxmonu0tlt iociasfa2ua( ont0teeniocoa1fat anvi s srtoir oodal elivtat  rta( poo1ole mi3ildfsDrm( s () rxomrciy1oaDeluei;s0trurxo oodame mfes t  rraxrpno4oex mociyt sDumuvs u0trtrmrcoo1fm eai i;t0tetm(mpoy4lme lnvi t)sDta( p;o1apen iciyd m2ulnvp;(4artoxociytfat  ivs;( tetr(o3iodlp elfei t)sruaur ;t0oetoiicilt a emu s;()alxoxociy1fm ranei;t0t2xmim3nu1om  mici s)aDtaxr ;t4tet  ieildlmDul( s u4tetoxo3iytfp r n olt)texo(o3iydlptelnciatf 2trur ;o4optomiciys s2uanvp t) rxnxr3tydfmDelnvilt  2xm(m oydlmtnlivsl(fs2umx  nu0tpx  iciysla2umuvo;u0arermfciydomt li sls t2xmxm oy1oltnlnciltfs2tm(r nt1oltoioeiysfa2eanmp;(0alerxr oodfpDe n s;s  2trxo3no1opee feta()srtmur ;u1oex  ictad a2elumsn()teenir oytlpDeauvils)s2ur(rpoo4apt lnei (f rtru oou0oexn i3iatfm2ua(mpn()texrxf oo1lm eaueo;s0trurir3nu1lmtnlfvsatf 2umxmpot4oetnmociat a rluvp u4tetrxocoodfa   nvslt)srurio ny4op n ivias srta(rpot0oet ioeiadfs2ra(mp;t0arxnir oatlpD  n s;(  exoimpiy4ale mfeslsfa2uaxrpot0oeto oeiys a rmnvo;u0tlenmrcoydoatelues t0t2xo(m iydlmeemietas)srtrxr ;t0tex  o3iasls2eluvp u0aexrmf oadla  livols) 2xoxm3oy1lpen iet ( sDtrump;o1aptnmo3iaslm2umu s;t0tlermo oytfaDrli s;s t2tmir3iu4optnmfvsasfsruaxmo;t0tet  feilsfs2rmuvs;u)areoxf3iotlmtelnesl(  rxr(o iodoltnlnet (f 2uaurpou4oltnmf3iydlsDrluvs;(4arxnmocta1lmt an s;s seur(opnu1amtnmfvsls)sDrr(rp;u4tetoifeild s2rmnvo u0teerxo iydlp   nvo s0 rxm(o3nydap emncs t sruau o;u4olen i3ils s rmu p t4 ltrxr tadlm  aivi;s  2uoio3nu1ll nmict (f 2urx pno1ole iociat s ea(vo;t0tlxnmo oy1lateli o (0s2toirpoo4op emies t s2urur ;o4tex mfciadfa rlumo (0 lxrxr3todfateauvs;s seurxr3io1om  mnei s  rum(rpno1tlt mfeiad a2uan snu4aexomo tadfat  neo t) 2toirpiodll  mnesas a2ra(  no1apt iociad s2ea(vp u0trtoir3totlm   n s;( s2xoirpoy1lmtemfvi () rtr(  nu0tlxniicils mDemn o;u4arxrio3iydlm ranesls)t2xmxrpio1alee nvsas  rrr(r oo4apeoio3iatfsDemuvs;u4 etrio tadopt lnvsl(  rxm(opnudlle mivtl()sDtrur ou4aexnioeiltla2ra(vp (0arenif3iotlaD luvs s sruoir ou4lm e ivtls s2urx  no1tlxo f3iat s2uanvs ()arenmo oydlp rli o;t0 rtr(o3iy4optn nei ( sDumxmpnt0opx  i3ilsla2eauvonu0 eeomr iotoaDrauei (0s2ur(m ny4lpee fcilt)a2trxr ;t1ale ii3tldlaDemn p u0 lenmf3iytomD aivi s) exr(m3io4ol elnci t  rrr(rp;o4alxo f3iys sDuln s u0 rerir3tatlaDr ivi;s srto(rpou4am nmicslt)aDurxronu1tpeoiocias mDrlnvs u0trtrmfcoa1lpD  ivo;(  rtmxm iu4lmt licsls) 2rrum nu0oet moetldlsDemums t0aexnxr3ta1faDraieo;t)srxrxm3oodal  lfeslt  2rrx  oo1olt  oetld m2ul( p;t)aetnioctadomte uvs;t)trtrxm3iydaptn ietas  2ra(r no1tlt  fctldfmDumn s u)tltrmrciy1fmt luei;s  euoim no1apeelictls  rrmxrono0aee  f3tlsla rlnvs (4aexoircoatfmDeaivilt  exo(m3io1lpt lnctlt  rua(r no1oexniieiysfsDranvo (4artnmo3totlmt aivo t  exr(r3iy4op e nes (f rra( ono4tlxnmoctlt m ean s u)arxnifcoa1la  anvo t0 rtrxr ny1ope mnct t a2umu  oo4optoif3iasfmDemuvonu4tlxrxfcoy1lmD lnei s  2xm(r3oo1alt  fvs s  Draumoou1tltn ieiyd a um(mpn(0trxnxf3ty1lm  liei;t  rumxm io1lleemncsl(  Dtaxr ;o4altnmoctydla2rm(monu)tetoxo3oo1laDr i s t0sexr(r oo1lmtn fvi tfsrua(  ;u1tltnmo3iasls2rmn p;u)artrio3oadomteaies s) exo(opnu4omeemnetat s2ur(rono1tptomfcilt a2em(vs;() ltomr3iadopt ai o;()trto(r iydlmtemncta(fsrtaxm ot0apt iietaslm umnms;u)altnxr iy1lp eau i s s2ur(r iy1lleemfcsa( s2ta(ront1tlxnmoetytla2uluvp (4arerifciatfp rln ilt) 2tr(o ou4olee fesa(faDta( oou0oet miciydls2rmnvs;u0 exomo3iatoa rlieo t)s2umxopiy1omteliciat artm(  nu0tptnmieiatlm eln s u0tlxnif3to1oa  lnvi ()t2uo(r3ou4ll e fviat  rrrurpnt0tlxo i3ild m2ra(vp;()trxoxf3oa1fptrli o;s)texr(m oydomte nvsl(  Draxmoot0ale  ociltlm2ua( s u0 lenxrcta1fpD anvi s0trxr(mpno1apen neias  2rmxmo;o1apxomo3iadls rmnmsnu)trxnmrcty1laD lnei;s0trxmxr io1lp   iciltfa2um( o;u4olxnio3iytfs2ua(mpn(4texrio3ty1la   n s;( teum(mpoo1ll  lnct ( srtr(  ou1aeto i3iytfmDranmon()alenir3to1omDraieo t)trtm(rpou1lpeeliesas  2uru poo4oexomfctldfmDra( p;t)teeoio ta1fpDe uvo s) eumxopno4lpee ivtlsfa2rm(mp;o4optoifetysls ua(vsn(0alerircoytopt luesls0teur(o3io4ap e ncsl( s2ua(  nu4alxomfcilt m2eau o;u0tltrmf oytoatrlivs ( trxo(rpoodap   net tfsrtr(rp;o4olxnmiciadfmDeluvsnu4altrir3tydfaD anes;t)t2tmim3oo4ame  fcsls s2ra(r oo1opt mf3iys a uanvo;t0 renmrcootom   ieo;() 2tmxmpnu1lmee ncs ( sDrax o;t1teeo ietldlaDea(ms u4aeerxfciydfateln s;(0s2xo(o3no4om  mivi t) 2ua(  ot1ale ioetys a2eln p;()aetnio oadlaD aueo;t)texmimpiu1lleelics t sDtm(mpnt0aex  fetldfa2rm(vs u) rtrmfcoydomD  uvs s s2trxr3iy4olenmivtas  Dum( o;t4oee iiciysls2eaumsnt4 eeoiocoatoateau o;() exoxr oy1lme  ivsls sDuaumono0tpeniieiadla2um( p;()aleomfctydlaD aieo;s  rxmxmpnudamenmfvs (  Dtaxront1tltnii3tlt a2ulnms;(0teeoxfcoydlp e u o (0 rtm(opoy1lmt  fcilsfarrmu  ot0opeo fciadlsDuluvp (4tlxnmf3oodfaDrlivs s) 2umir3iydlp  mncsas s2rm
\ No newline at end of file
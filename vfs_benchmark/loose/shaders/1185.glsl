@@ -0,0 +1 @@
+n o t  rtm(r3nudam elncsat) rtau poo4aleo ociyt m2raumpn() leoir iydla  lu o;(0teurxopnydal   fcta( sDurxm ;o4opeo iciadlmDrauvpnu)aetnxr3tatlpDr n i;t)trxrxopoudap nlfes s  Dtax pot4tex  f3tytfm eluvs u0teenxf oadlp eaieo;s  rum(o no4op  mfesl() 2rm(m oo1tltomfciltlm2rl( s;u) lxrxo io1omDeluvs t)sexo(o oy1lmtn fetas) rtm( pot0tetomiciys sDraums u4 exrmrcoydfmD lies;()srxo(m ou1open nvsas aDrr(mo;o4tpt mi3iys a2umuvs;(4tlxoio3io1fp eln i t0 2xoxopny4openmfviat s2rrx onu1optomiciyslmDelnvs u0trtrmr3tydfpt livi (0srxmiopoy4al   fesltf rurx onu1altoifcils aDeanmp;u0trtnmr oydlaDraivi t t2xr(o3oy4olt  net s)sDrau  ;o0olxoioeiytla2ul(vpn() etnir3oydfpDe nvs;s tetmim oy1ame lncs t arumumoot1alxnmieiytfm2emnvs t4tltnmo tydopt aivo;s0seuoxopiy4oltelfct s)a2rr(m ;u1oetomicilt s2rmn on() rtrir3oatom raivslt)s2xmxr3ny1lm n ncs (fsDtaur ;t4tet mi3iltls2ra(vs;(4trxnxf oo1fp e nvo;s  2xoxm ny4amtnmivtlt)sDtr(mpot1alenmi3iys mDuau s;()tltrxo oodopD  ivo;( srxr(mpou4alee fet s)srra(mpot0apxo iciytfmDrlu o;u0tleriociy1fatrlu sl(0texrim nydlpee fci t) rrm(mpot4alenmieiyslaDeaums u0teenxo3oodfmt anvolt)s2xr(o oo1ol n iviltfaDrr( pou0apxnioeiltfm rm(mpnt4 etoxocoadfate n ol(0 exo(r3oo1al n neilt srtmxmpoo4aee ii3tat m2ra(vs;t)artnmf oa1fm raieols  etoim3nudll  micia( aDum(  ot0ale mocildlsDuln onu0 rxrmfciydoptr ies;( t2ur(mpnydamenmnci tfartmumpnu1opx iietas s eln o (4 eeoio ta1late ieo s s2xoio3no1amtnmnctatfaDrax ono1tptnifcilsla elnvon() lxnir todop rlneo;s)texrim3no4al e feilt aDumurooo1tlto iciadla ulnvsnt) ltrif ia1lptr nvo;(0t2trxmpno4lp n ivsat  rtruroot4opxnii3tltlmDrlnmo u4alenirctytom  anesls0srtoimpou1llt lici ( sDrau oot0tlt ifetyd sDeauvpnt) ltnio3ia1optrai i;s s2toio3iu4lpenliesa(f 2ur(rp;o0oltoif3tatls umuvpnu)aetoif ootop eaivs s  ruoxopny4ap elfet sfsrum(m ;o4teenioeiadfm umums u0trenxr3todoaDrln i ()trxmio3ny1optemiesa(  rum(ro;o0aexn ociadla umuvpnt)aetnmoctatopDe ivil(0tetoxm3nodalenlfvs t srurx  oo1tlx mf3iatfmDran on()teeoir ia1op rlies;s  2xmim iodalt lictlsf 2rru  ot4tee  iciydfaDrlnmsn(4aetnifctodlpD auvo;s)setr(o3iy1omt mfvia() 2rr(r ou1olxn o3tad sDelnmp (0texnxo3iotfmDranei t)srxrxo iu4lpen fes sfsDrr(rp;u1texoio3ils a2rl(vsn()trerif oytfmD  ivo;t)srtr(rpoy1lm  mfeilsfarumx poo0opt  feilslaDra( p;()tltoif iatom ranvs t  eur(rpoo4op e ici (farrruro;u4tpxo ociyt a2emnmo;(0tltnio oadomDr n i;t)teuoxm3iodlpt mncs t) 2tmu pnt1ape iietytlm ua(ms (0arxnxo to1oa  lu olt0texmxm iu4omee nct s  rtmx  oo4alxn feiadlm2el(vonu)altnif oo1omDe n s t)srxoxr iodamt miet t srum(m ;u0aexnmoctasls emu p u0tlxrxr oodoa  an i;s  rtrxo ny1ame lfct sf 2tr(  no4aptoio3iadfm2rmn p (0trxniocoodlateau o (  2triopoy4optnmics ()aDua( ont1openmoctltlm2el(vo;(0arxnio3iadoa ran s;()t2trir3oydlmenlictls)a2trxmpnu1opxomieiatlm uan snu4arxomf tatfp  lnvilt texrxo3nudaptemncsls)a2uaxrono4openmfeiysfsDeanmo;u0arxoxr3oytfa elnvols0 euo(r iy4opee ietas aDtr(m nt4apx  oeiltfa2eln o (0teermf ia1faDelivi;t0 2tmiopou4lpen nvt sf Durxm ;u0aeeomietydls2el(mpnu0 rxrircoo1la rliei;t)trurxo3nu4ol  livtasf rrrx  ;o0olt ifetltlm rlums;(0 lxoir oodlmteluesls)t2uoxr3nu4lpe  netls)sDra( p;u1tpe io3tatfa2rl(mpnt0teeoif3ta1opt aieslt setm(r iy1lmee ies (f Dta( p;t1alx  ociad sDuaumo (4artomr ta1fpDelivs;() euriopiu4aleelnes () Dtru  ;o4aet mf3ilslm elumo t)artoxf io1lpDelu sls0 2xr(r iydll n iei (  2raur ;o0tlt  feiltlaDrauvp;u0 eerir iadlptrluesl() rxoxrpoodlmenlnei t  2taxm oo4oeto oeiad aDrmu o t4arermr3iadfpt anvo;()srur(m3iy4am emfvsltf Draxm ;t1olxoifeiadfmDrluvp;u) rxoir3oatop   u ols0 euoir iydal emnetl() Dtau oot1apen o3iysfaDrmu onu) etoio3ia1lp elneols0 2um(opnu1lpt  ictls artmxmpnu4tpenmf3tas a uluvp;t)tlxrxociy1oa   i i;() rto(o3no1lpe  ivsas arua(m ;u1tlx  ieiyd m umumpn(4teenmf3totfate nvolt tetmirpoo4omt licsl(f Dta(mpot0oexnmieiydlmDra(vs (0trxoxfciodfmD lues () rxmir oy1lpe lfvsl() 2trxmo;t0tltoif3ias aDemn p;(0tlxrmocootfp r uvils)srxmxr3iu4ome mfctas  Dta(  ;o1oetoii3iasla2ua( pn(4alerio3ta1fa  luvo;(0t2xr(r3oudapt micsa() rurx onu4teenmieiyt m2ul( pnu)trenif todop eai ils)texoxmpoudlpt  feil(f Dtm(rpot4tpen o3iadls2rm( o u0arenif3oydla rli ilt seurir3ou4omenlivta(fsDurum ou0alxoio3ilt aDrauvo t) eeomfcootfa e nes s0 euoxr3nudapenlietas)a2urx o;t4aet mfetyt mDrl( p u0 rtnxf3ty1fmD luvsl( texrxm ou4open fvta()a2rm(mo;o1olt  ieilsfmDeaumo u0 rtrmocoytlm eaivs;()srtrxmpnu4llt lfes sf Dua(mono4oexn oetaslm elu o t0arxrmfciadlpDeai ols0seuo(m3oodlm nmfes ()a2tru ooo0tptomoctlsfs eauvpnt0alxomr3iadlmtrli o s0sexmir3no1optelfvt t)sDum(mont1tlto oeiltfm2rlnvs;u)tlxomf3oatfm  luei;s) etoiopnu4lpen ivt tfarumu ont1aeen fetysls2rmn s;t0artrmociytlmD anvs;()s2tmio3iu1ol emncs ( srurx ooo4tlxn oeildlm2uanmo;u0alenio3to1fmtelueslt) exrxo nu4am emnvi sfaDtruroot1ole mfctys a2rln p (4altnxr iadlp  ln ols0 etmirpnydomt  icsas)srum(rpou0oex mfcilslmDuanmsnu4 etrmo3oytlmt lu o s0 exmim3oodaltelivta(f Draur ou1oleo ietlslm ra( p;u) lxomrcta1latr u s ( trxrio3no1amtelies sfaDtrxrp;o1oexn i3iydfsDuan p;u0tltrmf3tydlm elu olt)s2xrxo iodlp elfetlsf rumur nt1altomf3ildfs umu s u)alenmo oatfpt  nes t0srtr(m oudlpe mfvtlsf Drrum nu4aetoif3ias s2eln s t) rermf3oodfptrauei s  rumxmpno1alt mnctl( aDtr(root4opx  f3iyd a2ra(vo;(0aexoif3tytlp   ivi (0srtoxmpny4op e fcsa(f rumump;t4apt mfeiydlsDem( s ()tltnir3iy1la e ueolt  2trxopoudll emivslsfarurumo;t0oeto iciatfsDrmu s u) rxrir iotlateaues;() rumir3oodlmtn fcs ()arraumpnt1tetniocilsls ea( o (4 rtnmf to1oaDeai s;t t2uoir ny1openmncsl(f 2tmxrp;t0tptn ociasfs2eln s u0trerxr oo1oa e uvo;s)setmxopoo4ap n ivilt)aDumum nt4ole  ieiyd a2uluvo t0 eeoxf3ta1opt  ivs s) 2urxm iydaltnlfetl()artmumpoo1teen oetadla2ra(vsn()aetnirctodfpDr uei;() eurxr3ny4ol   nvtat  rumxm oo1olxoii3ildlaDrlnmonu) rtnmr iotfmtelues s s2tmxo iydom e nvslt  rraxm no0apeomo3ias a2uaumsnt)arxniocoa1lpDeai i s0tetoir iy4amtnlnetltfa2ta(rpot0optomf3iadfs2umnmo (0 ltnxocoo1lp   ieo t  ruoiopoy4lme mfvil()sruaxrp;o1tltnifcias a2ean o;u4artnmocoatlmD anei;s texoio3ny1lpt  fctls)s2rmum no0optnii3iadlaDua(vonu) exnmrctydla ranvo;()setr(m3iudam  mfcslt srumxmo;t1tltn ictltls ran p;u4aeeomf iytlmDe nei t0truo(rpiu4lp nlfet ()sDuax pot1alen o3tatls emuvo;t0teeoio3ty1optelivi t  etm(r3iu1ap  mfcsat sDrau poo1tpxn fetasfa2uluvont0 eerxo3iydfm eauvi ( trtrimpny1lp  lnctls srrmurpno4opxo fcilsfmDrmu o;u0 ltrmrctotlpte u o s trum(r oy4lmenmfcsatfsDtau p;u4alenmociydlsDel(vs (0teeomr iydoptrauesl(0 2xmxr iu1opt lfctl()s2ta(rpnt0oexnmietyd m eanmpn() ltrifcoadfaD lues ()setm(rpiu4lpenmnet (faDuaxmo;u4oee ioctldls eaumpn(4tlenmr ootlp ean i s)t2urxr3io4omeelieiltfsDtmxm no1altn o3iatlaDulu sn(4aexrmr3todfa  luvol(0trumxo3oy1llt  fvtas srrmurono4tpt mfeilslm rm(msnt4artrxrctotfpDr uvol()s2xm(rpoydamenliei (fartru ont1apt  ietatfm uanvsnt4texnmrcoa1fm eai i s) ruoxrpoy4apte fet sf Dra(r no0olxn f3iysfaDumu p;t0aetrmr tadomte ivi t t2um(opoy1aptn fei t)arur(mpnt1alx  ociasls2umuvo;(4trxnmf oo1lpDr u i s seumio3no4ap  livil() Dumx pou1optn f3ilsfs rmn s t)artnir oodfmtranei;s0tetoxr nudopt lnei t)s2truront4oetn ieiydfsDrmnms;t0tltomfciydoat aivol(0teto(r3iodlptn fci t)a2rm( o;t4aexnmfciydlmDrmnmp;t0teeomo iy1laDrlnei s)s2xmir3iu4apt lncta( srra(r ;u1aeeoiociasfs2elnmo (4artoxr tydlptraivo s0seurxo3iy1altnmfvsas)aruaxr ;o1tex mocias m rm( s;u) lxnir3tytfmtelu sls0 exoxmpno1aptn fetl(fsDtru  ou0aptn feild m2rlnmp;(0tetoif oydomtraiei;s)srur(r iu1oltnmivt s) Dua(m ;u1alxoiictas mDum(vo t) ltnircio1la eln o;t)trtr(o oudamtemieils arrr( pnu4oetomoeiasfa2umn pnt4tleomo tytoaD auvs s  2xr(r3io4lltelnvil()srua(mo;u1openifciatfsDem(mo (4 etnxr3ty1latr i il( s2xmxr oydole lnvs s)sDumu  ou1tptn ictlslm2umn o;()aexnmo3io1lmDeanei s0t2toim io4ole mncia(  2taxmooo1olxn f3ilsfa uaumpnt)trerxf3iytfptrau i;(0texo(o3ny1opee neia() Dtrum ;o1tpto o3tydfa2umumont0tlxnxrctodlaDr nei s0sruo(m oy1lpee fesl(fa2ururonu1teenioeiysfmDeau o;(0alxrxo io1lmte uvo;()t2tm(r iu4am e iesat)srrrx  ;t1aeenif3ilsla2uaumsnu4aeeoxr3iatfaDr nes;t0trxrirpnudalt  iet s  Drrx  ;t0tpxnmictys a2rl(msnu0tetnmr to1fatrlnei;()srxrim io1ll nmnetls)aDtaxmp;u4tlen f3tld sDea( s (0arxnio3tytlpD  i i;(  rurxm nodoleemicia( sruaxmooo0ape iociydlmDel(mp;(0 lxoxf oa1lptrlu o ( trurxo iu4omt  fvtat sDumuroot0aptnioctas sDelnvs t)trermrcoydlat lu ols s2xm(opoo4opeemfeil(  Dtmxmo;o4opx ii3iltfm2emn sn(4teerxr iotlpDeli sl(  2uo(mpoudam   fesl(faruaurpno1opt mociyd a um(ms (4 ltoxo ootoaDraneo s)sexmxr3io4omen iesls srtaxr nu0oleoifctysfm2uauvo;t) ltoxr oytlmt anei s t2uo(opnodaptemnct t  Dtax ooo1tpeo ictldla2elumo;t4arxnmfcia1fmtelu ilt trumir oydal  mieiatfsDumumoot0oltn fetldfmDraums (4tlxrmo3to1lptelnei;(0t2toir3nudam n neta(f 2trxm nt0olx iictls aDemn s (0tlxoxr oy1lmD lu s ( setmxr ny4oltemfet t  rumxrpno1tet  ociadla2uanvo;(4aleoircoydopDeli s;t)t2xrxr iu4lltn nesas)sDurxroot0opto icilslmDuaumsnt)arxomo3todla e ueolt0texrxr io4am nmici tfs2trum nt4tptn fctytla2ul(vs;u4 lxomo3ootlateai o s texmimpoo4ome  fci sf Dua(moot4aeto f3tld m ul( p t4 lermrcoytfaDe ueil(  etr(r3oudolt mncsl(faDumur nu0tpenmoctatlsDeanmp;t0 rxnif oydfp eaneo;t s2tm(o3oy1omt lnetls s2tmxmo;t4oetoifciad m2eanms;(4alxrxfciydlmDe neolt sexr(opou1amtelfctl( s2urxront0olenio3iysfs uaumo u0altrmfctotoa r ieslt0seto(rpoydapt  icta(  rrm(mpot0opt iieiatlaDrauvp u)aetnmr oatomDeaues;s) rxrio ny1altn neiltf Dtr(  oo0oexnioeiadlaDua(msnu4alerxo todlpt lueo;(0trxoxm oudllte iet () Dtrxmpot0aexoii3iadlm2ulump t0arxnmf3ta1opD lieo t)teuoio oydame lnciat)srua(ro;o4tlx ioctlt s2emums;u4 exrxo tatlm  an o ( srxoim3iodomtelfci (f rum(ronu1aptomi3ilt a2eln snt0trxnmo3iy1lm e ieol()srurir3iu4lp  mfcilt) 2um( ooo4olxn f3iysfsDua(monu0tlxoxfctotlmDeluvil(0s2toxopnu4ape lies s) Dtau pno1tlx iociadla uauvp t0 ltoioctadlpD auei;(0setmxmpiy4aptelnctl(farrmuro;o1olx  fctadfm2ea(vp t4teenmrcoy1lp e u i t0s2xmxm3nydapeelict (f Dtrxrp;u0aetomfeiysfaDel( p (4texoif oy1oaDe nesls  etrimpny1llt micsl(fsrra(m ot1tex if3iydlaDraump;u0tetnxo iadopD an s;( trxoirpnu4ol elivils)sDrm( p;t4apx miciat aDum( p;t) lxnio oadfm eluvi s)srtm(m nodlmt  netl(f rur(ro;u4alt ii3tyd a eaumo;u4 eenmf3iotfatelueo;s) 2urxo3nodap e icilt sDrm( poo4oee ii3tlsla rmuvpn(4 rtoxr oatoaDe iesl(0s2to(r oo4ap n ieiat)s2uax oou0optnmoctldfs rm(msnt4 exnmf3ia1la elnei;(0 rurir oodomte ies (  Drrumo;o4tee  fciyd sDemuvo;u)alxnxf iodomtean s s0s2tm(mpny4llt licil( sDtmx onu0opxomiciyd a rmnmp;t0 ltnifciy1opt aivs t)srxoim3ny4omtnlies tfaruaurooo0oexnmo3iytla rmu s u0 lxomo ootlmtrluesl()t2umimpno1op elncsls sDumu poo4aexoiicildfs ulnvo u)tetnmr3oydfm   n s s0texo(m ou1oltn net sf rta(mont0apeomfeiyd aDua(vo u0 lxrmfcta1lpD  n s;s0s2xrxo3io1lm e fes t)srtrumo;t4apenmoeiysfm rau ont4arerxfctadlmte ueils)teuoxm iydope mneiat  rtmx  ;t0alx mictadfa2el(vo;u4alerir3iy1lmDr uvsls0 etmxm3io1amtelnvil() Dum(mo;u0tltomfcildlsDemuvo;()altrxocta1fmDrai s;s0t2tm(r3oodop  lieia(  Dtaxro;o0tpx  o3tyt mDeaums;t0tlerio tatfpDeln o ()texrxm iodopte ieiat srum(roou4tlt  oeilt m emnmpnt)teeomr iatom eai o;()t2tr(opoy1am nmnesltfs2rmx  nu1opxoifciltfmDem(mpnt)treomf3oydfp  lies (0 euoxrpoy4op emici ()srur(monu4aexo fetatls ean o;(0artriociodlpDelivs t srtmxr3io1lme lnet t  2rrumooo1tpeo i3ias mDeanms t)texrxo oytom rlies;t s2xr(r3oydlptemfesa(f 2urxrp;u4texn ieilt m ul(mpn(4trxnif3ta1omD lieo ()trxm(m3oodoltemieias s2umumo;t0oeeoiiciyd s rmuvo (0tlenxr3tytlaD lu s s  rxr(rpnu1lp nmneslt) Dtr(rpnt0alxo iciytfsDra( s;u4arxrir to1la rlnvils)setmxo oodom e ics t)aDtrx pnu4tleo feiydlaDrluvo;u)treoir3to1oaDe neslt) 2toim3nu1open fvtat a2rr(mp;t4optn icild m em( pnt)tltnxo tydla rluvsl()t2ur(opnodop emicils) Dra(mpno4ale  feiyslsDea(vp (4teeoif3iadfate nvi (0 rurxm3oudlp e fvsas aDtaurp;u0opxomf3tad a ra(msnt4 exnmf3todop  lnes;t)s2xo(r iudol nlncilsfaDrr(rp;o0tlen oetad aDel(vo (4trxnxo todlptrauvs s) ruoxmpiudlpt  ivsltfaDrrumpnt4tlto f3iasfm2emn o u0 eenmr oodfp r n slt0texoxo3nu4optelfctat)artaump;u0opt io3iysls2um( pnt4teenmf iydoatrlueslt0 rxr(o oodop  lfvsas  Dtaurpoo4apto f3ildls2emuvpn(4aexoxo oatlptrlneolt0s2xrio3ou4olee ietat) Durxro;o1apx ii3iatlsDea( o;(0 lxomocoydlaDelnvo (0trum(m3oy4op nlneta(farrrxm ou1openio3iaslaDra( snt0 lxoxo tatopDrlnvs;s)trxr(r iu1al e neia(fs2rmum nt0open ieiatfaDum( pnu) lenxocto1laD li o s s2xr(opio4opee fesl() rrmum oo0apenmfeiat sDuaums;u0tlxrxfcoytla e nvsls0 rtr(opnu1lmeemfetltfsDrm(r ou0tet  ociysfmDulumsnt4tleoxociodoa   uvils0srum(m iudlmen neiat)aDtm( pnu0olxn o3iat m2ra(vp;(0texrxo3ia1la e ies;t  rxm(rpoy1optn ictas s2tmum nu0aeeo feiytlm2uluvs t4teenxr3tydfm eln s;t0 2trxopio4amen fvtl(  rtru pnu0opxo oetyd a2ua( o;(4aetomociy1latelivi ()truo(r3oo1op nmietat)a2ururono4oeeo ociadfmDulnvo;u4 eeoif oodoa rlieo t)srurimpou1ole  ictl( arrrxrp;o0alx  f3ilt aDulnms;u)aexrif3oa1lpD aneo s0 ruoimpoydale  iei tfaDuaumpot4opxn fciatfm em( s;t)texnxfctytfm eau i;(0trtrxm3no1om nlivtat aDtru oou1opeo iciltfm ea( snu0 ltoif tytfmD ai s;t t2toxr3iudale  ivsat)arrm(mp;o0tlenii3tlt a2ulnms;(4arxoxrciytopD  uesl(0truoir3ou4lmenlfvsa(  2uauro;t4alenio3tydls2ea( o;u)artoxrcoy1lpD livsls0tetm(r nydlpt micta()s2ra(mpno1oexn fcilt aDel(ms;u0arerif3totom  au sl() ruoxopnodapt lietas)srtaxrono4opx ifeiyslm2em(mpnu0alxoxf3iatlat  nvo;s srtrxr3nydoltnlfetlt  Drrum nt4olxnifcilsfs eln p;t4aexomf totfa   n i;s t2tr(m3nu1opee ncs (f Drrx o;t0aex  ociytfa2el(msnu4tlermr3tydoptr i ilt trum(opou4ap n neta()sruax  ;u0tpto icils a uauvpnt0artrmrcto1lmtrlnvs (0sexo(o oudaltnmnesat)artrx oot4aptnifeiad m2eanms;u0altnmf oydfat  uei s0 2uoxr nydal n fct s) 2um( p;t1oleoiictyslm ea(vs u4 rerxr io1oatrai i;t)tetmxo iy1am emfvt s sDtr(r no1apt moetas aDel( o;u0altnmr io1laDe uvsls srxoir nodap  miviasf rum(rpoo1aptoiocilsfmDulnmo t0arxoio oatfpD anvo ()teto(m oy1opt  net sfaDrr(  ;t4oexniieiad a uanvs u4trtomfcto1lpDeaneo s)teur(mpou4olenmfvtatf Dumumpnt0apeoii3ilsla uln s;u)arxomocio1oateaues t) 2xrxm3nu4alee ivtas aruau o;t1tlx  o3tltfs emnmpnt)arerif3tydfpt  ieo s0setm(opiy1ope lnetat  Drr( pot0tpe ifciytfs rl(von(0 ltnmocty1omD lues;s teumxr3oy1al elncsas s2tr( pou1oee mo3tadla rmnvp;(0 rxoiocoadopDeanvi;t texmxo3io1omt livt s sDrrx ont0tet  icilsfsDrm(vo;t0tetnmo3tytoptrliei s s2xoir3oy1al nmnesa()s2rau pot1aexn ietys a rluvont)artniocoodlmDeaiei t0 2xr(opiudlmeeliviat srraxmpou1alx mo3iysfaDemn p;u)altnxf iydop  an sl()t2xo(m3io1lm nlfcs (f rrm( onu1olx iociytls2ranvsn(0alxoif tytfaDeli sl( tetm(r3io4lpt  fesl()s2tmurooo1olxnmoeiad aDran pnu4treoioctodoaDr nvo s) ruriopiudlltemietlt) 2taumpno1ale  ictldfa2umnmp;t0tltrmrcto1fmtrlu slt)srumxm3oudop  miet sfa2rmur no4altomociltls2eauvs ()alenmocio1fmD aivi t srur(r3nudoltnmici t)srrmx ono1aee ifciytfm ulumsnu4 lerxfciy1oaDelnes (0texmir3nudlptemfcsls artmxm no4opt moetys s rmu ont4aeeoircoatoateanvs;(0 eurxr io4omt lfct t s2ua(m ;u1tptoiieiatfaDra( on(4 etoio tydfmD auvi ( srtrxo3no1aptemneilt sruaxr nu4alt iieias m ulumonu0 eeoifciadopD  i s;s0 rurim3nu4aptn ieslt  Drau  ;u1oeeoiictysfs2ulu sn()trxomo iodfaDelivsl()texo(r iydlpenlfctls) 2rr(m oo4tee  feiatfm ulu snt) renmf to1fmt  i sl() ruoxo3oy1ope lfvta(f rtax oou0alx ifeiadfs2umumo;t0tlenxr tytfm raivs (0trxm(r3io4ol nlnctltfsrrrumoou1tlxn fcildfaDuauvs;() lermf iadfatrlivo;s0 eto(o oy1llenmfvtas srrm(rpou1tpx mieias sDum(vp ()texnmf iadlpt an s;t t2xrxo3iydaltnlieiat)s2umumont1tpeo feild m em(msnu0trtoxocoydlp  anes;s t2tmxr io4lm n nctlsf rurxmp;u0tpt  iciydfa2rlnmp (4 eenmrctatomtr ies ()setrirpnu4ll nlnvtl(farurxro;t0apx ifctydfmDul(vp (4 ltoxocoatom   nvo (0 rxriopiu1am   ncsl( a2urxrpnu0tetnioctaslm ra(vo t4tlenxrcio1oate nei s srum(opiu1altnmnviatfsDtaumoou1oeto ietydfs um(mon()arenmo3ootfp e u s ()srurxm3no4ole lfvi t a2trx ont0altnmfcild m eauvonu4 rxrxr io1lpt  nvs ()t2xm(rpiodll elfvta(f rrmu  nt4tetomoeildlm rmumsn(4trtrifctytoa   ueo;s) 2toim iy1am   icilsfaDumuront1aexomietadla2ulnvo t0arxoxocoadfpteanvol( s2urimpou4ome mfvi tfa2umumoot1apeomietytfm elu p;()tlxnmocty1oaDelieilt)trtrxopnydol emieilt aDtr(rp;u0tptomo3iadfm rm(vs;(4trerif tydfaD luei;s)s2xmxopoy1llenlfeiat sDumu ont0tetn fciltfaDum( p u0tlerif3iodfat lu ilt0 rxm(opno4alt  fvilsfartmxm ;u4olenioeiysla2eanmo t0alerir iotlm eaneo;s0sruoio3oodaltn icsl( aDuaump;t4olxoioeiadlm2rlnvo;t0tltnxf3iytlateliei t0srtoxr oy4ap nmicsls  rum(monu4optn feiytfsDrlums (0altoxo totom e uvi (0sexrir no4omte fvt t  Drm(mp;o4aetnioeilt a2ranvo (4trtnio3ootlm   ieol(0trtrir nodop  lieslt  2rrump;o0alx  f3tysfa2eln o;t4altnif3iotomDeli ilt  exoiopno1op e nvi s)arum(  nu4opeo o3iat m2em(vsnt0alxnif iydop rlies t0truoxmpio4ale  fcilt)s2umxrpnu4oex mfetls aDrlumpnu0trtnxr ty1fmte ieo;s) eurxo3oy4ll  lics s  rua(mpou0texn ietydfm2ul( o ()tetrmo oy1lpD li o;s0setrxr3nu4lm  lnvt t arrmurp;u4opx  fciltlmDea(vont4areomr tatfa e u i;s)t2uoio3iy4om   nci t)aDra(m ot1oeenmieiydlmDrm( o u)aexnio3oo1fpDeai ol(0 etrxrpio4lltnmiei () Dtmu  ot1optomf3tytfs2rmnmpnu0teerxr3ta1fa r n ils0s2xrir3oo4amt lnvsasfs2rmxmp;u0tltnif3iytfs rm(vs;t4artoir3oytopDeanes;s srxm(opiu4lme mncilt) rrmxm nu0tpxnmfctydfm2ra(vo t)altrir3oadlm r ivs;s) eurxrpnodomen nvi s) 2ua( pno0apeomoeiadlmDumn p;t4 rtoiociotla e neolt0teto(o iy1lmeelfesa( sDrr(m nu1tex  octld s umu p;()trxrmr io1opD aivo s0srxoxm3no4ope lfvt ( artr( pou0tetnif3ilsfs2rln snu0tltoif3ty1fpDeli i (0trtoxrpoo1amt lneils)sDum(root1tptomiciasfs rlnvo t4trtnif ty1fmt li i () rxrir oy4lmt lfvia(  rtax pnu0aet ioeiadls2rmu s ()treoio ia1op e uvs;(0 2xrxopiu4oleemietat aDrr( pot0aee miciltlm2ua(mpnu4tetomf3oo1lm rli ols)sexoio iydlpt lfci sfs2tr(m nu4oee  o3ils m rmumon(0 lerio oodfmDeli i;(0tetm(o nu1alte ictatfs2um(m ot0aeeomociysfs2ul(vs ()aleomrcta1opt aivi ()sexoxopoydom   ieta(  2rmxr ot1teenmociydlaDra(vp u)trxrxo iytfa raneols)t2tmxo3io1olen icil( sDuaxm ot0apxnioetasfm ea(vpn(0altnioctatfp rauesl()s2tmxr nydamt lnes tf Drmum ;o1apt iictatlaDrlnmpnt) rxomocio1fmt anvi;s) 2uoxo3no1apenmicils  2rm(m oo4oeenmfctasfs2ea( pnu0arxnirctydlmt livo;(0trtm(o3iy4olte ncsls  2rmumo;u0altnmfciytlmDem( sn(0 ltoio3iotlmDrai i ()seum(opoodlmtnmnct ( aDua(r ou4tet iieild a2emumpn()altoifciatfmtelnvi s teuo(r3io1apen nct (f 2urxmpoo1tptniicildfa uau snu)aetrif3ootlat  uvo;t) rtm(opio4omtelfeiat) rtr(mpnt1aexo f3iysfa ra( o (0trxnmo3iydoaDeai slt srumxm3oy1al nlnvt (fsDurx pou1tee mfcilsla rmnmp t4 eenmr iotla  lnei;t  exr(r oy1optnlnes t aDur(r ;t0tlenmfetlt a2ranvpn() lxrir tytlmt  ivi s0tetmim3iy1amt mnctat) rrm(rp;t0oee mfcildfs2umn o t0altoxo3oo1lm  auei;s)trxoxm iu4llenmicias) rta(  nt4texoif3iydfaDeauvs;(4areomf3ootomDeauesls)trxmxo oy1ll elnvi (  rtaurp;o0aeeo iciltlmDrl(ms;u0aetoiocoytop rau o;t truoiopoudal n ivia(fsDumu o;t4apxoiociytfs2uan o;u0arenif oatopteauvo t)s2xo(rpoo1alt lietatfa2tax  no4alxnifctytfm rmump;u0 lxoxociydfmD li i ( teurxrpoydll  lnvi s) Dta(rpoo0tptnmo3iytfsDea(mo;u) exrmr tytfp  an i s)setmim3nu4al emnes (f rtrxm ;u4tex if3iyd s ean o ()teermf to1fm eluesls0 2umxo ny1al emfctas) 2raur no1oeenmf3iat s2ul(mo;t)alxoif to1fmt  n s;s)seumxm3io1ll n ict (fartm(r no1oltnifeiltfsDran o;t4altrio3tadoaDrauei;(0 etoirpoodam e iciat srtaurp;u0oee iiciysfa2em(vonu)aeenio ootlp  li s;t0srum(r ny4lpt mnesa(fs2rrx poo0aptn f3tysfm uan snu4tltrio3oatopD lu sls0 exm(o3io4op n ict ()srtrxmo;t4teeomoeilsfm rm( p;(0trxrxr ia1oa ranes;s trxr(o3nydlp elict ()aruax pou1olxnmfetyslm2uau s;t0aetomfcoa1lateliei ()seuo(r3iydamtelnei tfarrmump;u4tex ifetad m2ul(vs t4 lxoxr3oodfat  uvil(0teumir nydopt mnctat s2ua( pou1opxo o3tltlsDranvs;t4 lxrmr3oatlmte n olt) rur(r3ny4lmenmfctasf 2umx  oo1oeen ieiadfsDra(vp;(0tetnmo oa1fp r nvs ()s2xoxm nodalt mnetatf 2tru  ou0aeen ieiyslm rmu o;t4 ltrxfctotfaD ai i;() rur(o oo4lm elfcilsfa2umu  oo0aex  i3tyd m2rlnmp t)trtoircio1oatraivi s0trtrxo3iydal e fvsa()arua( ono1apx ii3iadls2uauvs;(0trxoiocty1oa  auvils0texr(o3oydape  ies ()arrr( pnu0apt io3tltla rl(mp;()aleoio iy1lpDrlueo;()teto(o3oy1amtnlnctatfsrtaxmp;t0oleo ociad aDuaump;(4texnxf3iytom rauei (  exoio3no1op nmnvsat arrau pno0opeoii3iatla rmnmpnt4 rtrxo iadoa  luei s)sruoxr3ny4ap emnetas)aDtru  no0alxnmo3iltlmDul(vs;()teenmr3oatfpteauei;s0srtoxo3io4amt  ictl() rrmxm nu4aeeoioetldlmDumu p;(4altnxf ty1lp  aivs s)seuoiopno1om nmnct sfsDurump;o4alxnmiciadla2umnvsnt0artnxfctodlaD ai i;(0 rto(o ny4op n ncsat aDur( oou0aex  oeiys sDrlu s t0treoioctodomt  nvil( sexmirpiydalt mncta()sDrr(r no1opxnioeiadls um( s;t)tetomr3iytomDrln i (0 2tmio no1ope  fviat)srtauronu4tpxnii3tltfsDrmnvs;() rtniocoatfptrlnes;s) 2uoxrpoo1am   fvtas)a2uaxmono0ope ifciasfaDrauvo;(4alermf3ty1opDeanes s) 2toxr3no1apte nvi s)a2rmx ooo4texoif3tysfs2eauvpnt4 ltnmr oa1fm   ivo t0 rxo(m nodop nlfeta() 2trxr nt4apxn ocilsls2ulnvp t0tltoio3iatlm   nvo;t s2xr(m nydamtemfesat)arur(rpnt0openioctatls2ranvont)altnmo3totfpte uvs s) 2tr(o no1lp   ivi () 2tmu pnt1tltoioetyd m emn s;t) lxrif3oo1fmte uvo s) rtoio3ny4ame lfciat) rua(r oo4opt ioctldls ra(ms ()trtoif3tadoaD  ueil()srtmirpny1optnmiciasfsDtaxr ou1oleniieilsfsDemnms;u0tlenioctadoaDeanvo;( sruoiopiy1om  mieia() 2um(rpnu4tpeomfcias aDelnvo t4trxomoctadfm r iei (0teurxr ny1am   ictat  rumur no4oetomoetldfs2ulu s t) ltnxf oytoaDeli s s) etoio3oo1al   nei s) 2ururooo1aptoiocilsfs em(vs u0 etrif oadlaD  ues t)setoxo3io4lp nmfvtat a2rmxm nu4aee mfeiaslm elnmsnu0 lenmr oodomte i s s0t2toxopiodamee iesls) Dra(r ot4apeomieilsls2umu p (4 lxrxr todoa r nvilt0t2tm(o3iy1lp e iviltfs2rm( ooo1oet iociatfaDul(vo;(4alxoxfciadlatraneo;(0 2tmxr ny4alt  nvsl(fartrumooo1tetn ociysla rlu p u0aexoxr ootlpDe u il( sexo(r ny1ap  lfeils  Dtaurpnu0ole mieils a2umump;u4tltrmocoy1oat  n sl(0 rurio oo1opeelivilsfaDta( ono4tetoio3ils a2rmnvs (4tlxrmfcta1omDr nvo t) rtmxr ny4olt lnei (f rurxmpoo1oexnmi3tlsfm ul( sn(4teerxo to1oat luvi () 2xoxo no4ame lfeia(farurxm ;u4optnmf3iyslsDemn p (4arxrmf iodfmte ueo ( t2xrxmpou4am elncs (fs2rr( pnt0aetomociysfs2rmums;t4trerirctatlmDr i o;t t2um(o3nudope liciltfa2ur( pou0oleomfetydfsDeluvp (0 exomf oy1lpD lnei s0 2uoirpnodlltnlicils a2tmurpoo4oleo o3iydfs2eluvp;u)aleoxf iadfpt li s;s)teur(rpnodol n fesa( srta(rpnt4texn o3tadfaDuauvpn(4areomr ia1lmDelivslt tetriopoodop nlfcsas a2tmur nt0tpen fctat aDrmums (0texoxr3tadopD  ivilt)t2xmio nodop elfvt t  2rmu pnu0tetn f3iysla raump;() exrxo3oy1laDrau s () rurxr3ny4ap emici tfaDrm(r nt1aee  f3iytlmDum(msn(0tltnxoctodfptr i i;() exr(r3iydll nlnetas sDta( pou0tpe  fetydls ua( s;t4aeermoctytopDeaueolt)setr(o3oo1lle mict s)sDtmum ;u4tpx  i3tlsfm umumo u)aleomo3ia1fmDr ies;s srurxo3iu1aptemncsls)s2ta(m nt0olt iocias a rmuvont4 exrio tadoat lneolt t2trxopoy4openmfes (fs2rrx poo0tetnioctlsfa eauvp;u0aetrif tydfmD lieol( sexm(r3oy4op n nei () rraxr ;o0tlxnmoeiytfa2emuvo () exnmo todlmDe n ils)teurio nudal emies ()s2tmu oou4tleo fciatfa eluvs;u4alxnmo3oadop e ueol(0t2um(o io1om  lnetl( a2tm( pot0oetoiieilsfmDea(vs;u)areoxf iydfm eaivil(0srtrimpno1omt  fcil( aDrax o;t1tlen fctlsfa2ul( s (0 rxomr oy1lat li il(0 rtoxopny4amtemivsl(farrmurp;o0apt  oeiat mDumuvs () lxnmfctatlmDe ivs t s2urxm no4lp  mneiasfa2um(r nu1apxnif3iadla ran onu0trtomr tatfa rai s ()texo(mpoo4olenmfcsls)sDtau  oo0aexomieiytlm umuvs u)trxoxrctydoaDrluvslt seumxr ny1ome lncils a2rm(rpno1alxn o3iad m ea( on(4altomociadlmD livil(0 etoxm3oo1omenlfeils)aDtr(r no4olx mfciad s eau o;(0altoxocoa1fmDr ivols) rxm(r3oydlmt mneta( a2rrurpot4olxomfcild a2rl(msn()trerio3oytlaDrlnvilt  eurir io4alt lieilt)srta(rpno0oetniieiasfs2uauvp u0tetoir3iatfp  luvil( srtoir3nu4ope  ncilt  rrm(m ou1alen i3iad s2rm(vs;()trerir oatfmDelnei ()t2trxo3ou4openmnetat) rtrx p;o1oexoiieiyslm ea(vsn() lxnmr iatlp r ivol(0teto(opnodol emivsat aDurxmpot0tpx  oetltla2rauvp u4 lenxf3iotlpt  iei;t0seumxo io4lm n fvi t aDrrx  ;o4texo ietlt mDulumonu4 rtrio iatlp  aieo t)s2tr(r ny1apenmneias  Duaumo;u4olxomi3tlsfa2emnms;u)texnxf3tydomDeln i t) rxmxopoy4lltn fctas sDtr( p;t0oltniieilslm ua(mp;()treoio oo1lpDraiei s)s2tmxr3ny4olt  ieslt srrmxronu4ole mictldfs2um(vo;t)tlxnmfcoadoaDrlies ( s2um(opou1llte fvt t) Dtr(r ;u0tetoio3iysla2ran s (4arxnmr iotopDrlivo;s  ruoxo ny1lp  mictl(f Dtaxmp;t0aleniictytlmDuan o u) rxoio iadfmDrlnvi;t  2uoxm3iodlmt mieia(fa2rau ont4oeeo f3tat m2eaump t4trtoxo oy1oaD li il() 2urxm3ny4ole  fvi t)sDtaxm nu1openio3iadfm2elnvont4 etrir3tadlptrlivol(0 exr(r3no1alenlicia( aDur(r ot4texoif3ilt a2elump (4alxrio iydfm ean o;s s2toxm3nu1al e ncs sfsrrmxroou0aleniicild m ulu s u4arxrmr3oytfmD  iei () etrxopoo4lpenmnetl(  rrrx poo0aet ifctld sDemu s t4arermrcto1lp e uvi ( srtmiopnydale  fvslt a2rau ont4aex ioctldls2eln o (4trxoif iytop eluei t0t2xoimpnu4apenlfesltfa2uax p;o1opeomi3tad sDrmu o;(4alxnif ta1fp eauei s t2uoxm3no4amtemfcsa(f rtau  ;u1alto iciydfsDua( p t4teeoif oy1fp ran sls)trxrxmpiu1lpeelfcs ()s2um(m ou4tlxo o3iyt sDrmn s u0aexrir oo1oa e ueo;( sexrxr3ny1ope  nci sfartr(r no4oeeoiieias aDea(ms;t4tlermf oytlmDe nvi;(0 2trxr3nu4oltnmfctlt) Dtaxr ;o1aetnmi3tltfmDeluvsn(4tlxnxf3oadlp r n o;s setmir3nudop nmnetas) Dur( onu0ape  oeildlsDul(mo;() rxnmf3ty1lp rlnei ()truoxopiy4ll e icsl( arraur nt0ope  fcias s emu s;t4tlenmf totfpt  ueo (  2urxo iudomeemfcs s) rrrxr ot0oeeomfeias m2em(ms t0texoifcoatlat  u i s0 etmxm3iydlmeemfvsl()a2tm( pnt0alxniieiaslmDulump;()areoif3io1oa   nvilt0t2xoxo3iy4ll emivi () 2ra(mpoo0oltoifcilslmDemnvon()teerxo3oytlm rlivi;s seurir3oy4ole  ncs ()arrrxm ou4optoio3tytfs2rmn s;t0tlxoir iadoa   ueils)t2tr(r iy4op  lfesl( sDum(m no4oeen oeildlmDrl(mp t4aexnmfcoy1fatr ues s0 etmiopoy4llenmics () rrmu  ot0alx ioetat m uln s t)aetnxrcoodlmDeai sls  ruoio no1lmt lnct t)aDtr(rpot0optn i3tldfa eauvo t) leriocta1lp   n i (0texm(o3oo1apt  fvsl(  rrax ooo1teeo fctys a2elu pn(0 renio3todlmteai o;()trtmirpiodlm nmiciltfsrrr(rpnt4aetnioeilsfs2ulumo;t) rermo3oydoa r uvi;s) rxrir3oo4ome miet ()s2urx o;u4opxoiociltlaDul( s t0 lxrif3to1fateaieils)trtmxm3iy1lmen fei ( srumumo;o0apxoiieiys m rmumonu4aleoxf iy1fpDe ivi;t  rxoir iydapen ivs tf rurxrp;u1tpxnioetat m emnvpnt4trtnxocio1oaDe n ils0trtoxrpoy4omt mncs sfa2trum nt4oetoii3ilt aDemnmp;u)arxoif3ty1fptelnesls0 2trxm iy4altnlfvs s a2rax  oo1opxn f3tls aDelnvo u)trxnxr tatomDr neo s0s2tmio3oy4lleemicsas)arrrxm nu1tpto o3iadls2ra( sn(0arxrio oydfpt lues t) etoio3ny1lm emfciasfsDuaxmo;u0oex  o3ilsla2ean s;u4tetrmr oodfa ean slt)s2xoxr3iudlpe  fvtas s2rmumono4oeto feild sDrl( s u) leoir3iadfmDraueils t2xoir ny1lptemfvs (f 2taumonu4oleo fcils a rl( sn(4aeerxf totop rli o s0 exoxm3oy1om   fcilt)srum(rp;u1alxomoctldla2ea(vs;u0arxrmf oa1lm eaivslt tetm(o ny1om e fvtlt)a2urxr ;u1aexniieiytfa2rmumsnt0tlenir3oydfaDelnvilt s2tr(r oy1alt  ies s)aDur(rpnu0oexnmfetlslmDul(mp;t4alxoxf iydlat au i t0setm(m3iu1lm n fet tf 2um(rp;o4oeto icils s rl(vp;t4aeermfctotomDrli s (0s2tmxm3iy4lle mneia()sDumumpnu4tpeomoeiadfm elnvo;u0alxomf iadoptrln s;t s2xrxr nydamt  nctlt s2ua(m no0aleo f3iadla2ra(vp ()altniocoytfm eauei;s0 2tr(m3iy1am emivilsf Dum(mpot1alx  ietys sDrm(msnu4trtrmf io1lptraues;t0 2xoimpou4op nmfes ()sDrrxrp;o4oexo feiat mDraump t)artoxrciodlmtrlnvi s0t2urxmpio4ome  icias)a2tr(r ;t0tlx  iciltfa2emnmpnu)aleoio3to1om eaiesls) ruoir oo4amtn ietl( srurxmo;u4olto o3tlt m2eau ont0 ltomrctodlat luvi;s  2umxo3oy4ape mivta(f 2uaum ot0aetnifciadlm rlumo;() rxnmrcoydlatrlnei;(0texmiopio4am   ieiasf Dtm(r ;u0texn feiytfmDelu p u0 ltrxo3tatop  ai i;() 2xm(o3oy1op nliet ( s2um(mp;o4tee mfeilsfa2ulu o t4trtoxocoatfm elnvi;t  2xm(r oy1apen ietlsfsrtrum oo0oetn f3iytls2ua(vp;t4trenxrcia1lptrlieols srxmimpnydop   fetat srrrxr nt4ope ioctlsfs emnvpn()artrioctydlaDe neol( teuoxm no4lltemfeilt)s2rr(ronu4tle if3iyslaDeanvon(4arerxo3ootfat  ies;(  rxoxr nudlm emfvtlt)arraxr ou1apeomfeiysfa2uanmo t0 lerxr iotfa r nes t)s2toxm3iy4aptemfcia()srta(  nu1ale mfciatfa rlnmsn(4arenircio1lp rauvs;()srtmxm iy1lp   fvias s2trurpou1apen fctydfa2uauvpnu0trtnifcoadlm e ueolt)t2uoim oy4lp e fvslt)s2ua(moot1aptn i3tys mDrm( p;t0tlerxo ta1opDelies;t0s2uoio ou4am nlneia(  Duau  ;o0oeen fctyslm2um(vo (4artrxo iytomDe i il(0 2xrio nu1apen ivi ()sDrmxm ;t0olenmociadla2el(mp;t0 etnxf3oatom rlnvs;t)sruoimpoydamenmivs ()srtmu  nt0olxomfeiatfm2eaumpn(0tlxomf oadlmDr ueilt0trtoxm3io1lm elics () ruaxm oo1aexo f3tlslm2eau snu0altoif oatlmD ln s t0 euoxm oy1ame mivia( s2tax  nu1oetn o3tydlm2ea(mo u4teeoir3tadoa   uvslt) rtr(o ny1omtnlivs t  Duaxr ;o0aptoifeiysfsDra(ms;()alermrcoy1oa rlueo s0t2xmim io1apen netl( srum(mpot0aexomf3iaslaDua(ms;t)areoioctatfp e n ilt0seur(opoydomeemfetas) Dtr(monu0ale  o3tls sDrmnvo u4 lxnir3iadlm e uvolt0trtrim3iy4lltemnvil( a2ua(m ;t0oltnmo3ilsfmDelu onu) etnmr3to1lptrlu i;t0 eum(r3iu1optnlncia(  rrrumpot1tpt mfcildls ra(vp;u) lxoxrciotfa ran i (0 exoxm nodapeemictls  rta( p;t1oex  f3tlsfm uan o u0aetoio3oydoa  livo;t0s2uo(r iydlp   ietas)arrm(rpnt0olx mo3tld sDemump u)aexnxo totfa ranvols) 2um(o oo4lmt  netls)s2urum nu4aet  i3tydls2uau p;u) exoiocoodoatraivilt texoio no1ale  fet sfsrua(rpot1opx ifcilt a2uanmont) lxnio3iotoptraivils s2xoim nu4lle mnctl( sDurxr ou4altnifeiatfsDemu snt0teeoio io1fpt lneo s) 2xrxm nu4ame  nesat)aDraumpnu0alxo fctatfa2em( s;(4 lerircoa1op ranvils srxr(m3nu4altelfei ()s2taur nu4aee ifetld m ua(vo;(0 rtoxo3tytomD  ieo;t  ruoim3io4lpeelici () rrmur ou1teenmi3ilsfm rmumo;(4tltomociodfmD  ueo s0 rumxo3io1ll emnvsa( srrrx  ou4optomfcild a2uluvs;()texoxr3iodop  anesl()s2xmxo iy4llte ivi (fs2um(rpno4tpeoioetadfm2rmnmo;t4aeeoxo3io1la eln slt) exmiopiy4llt  ivt (fsDtr( pnu4tle  o3tytfa2eanvo t0treoir tadopteauvsls)seumxrpoodol emiesl( a2uaxronu4aexomo3iyt sDrm(mo;(4 ltrxf oytfm e nes s) ruoxopnudalt mfetltf rur( oot0opxniicilsla rlumont4aexoir3iatfpt lnvo;(  etoxmpnodlmt mfct t aDtrxrpnu4aee iieiydla umnmonu4texnxr iydoaDrluvi;(0 2um(r io4lpee fvia(f Dta(mp;t0opx mi3tad sDulnvon(4 ltoir3ty1optrlnes;s  rxoxo io4om emiei t)s2tm(m ;o0tpto i3iasla ea(vsnu4tlxrif tadopDrauvols  rxo(m3ny4ol e icil( a2raxmp;t0aet mi3tlsls2elump;t)trermr iytop ean sl() 2xr(o3ny4lmeelictat  Drrumoou0aexn octlsfa2eanvp ()altomf tydomDrli sl()s2toxo oudaltnlfviatfsrra(m nu4openmi3iad m2el(mp (4tltrmfcootfaDeaivi () eurir nu1ol   iei s) 2rmu ooo4tpe ifciys mDel(von(4 etoir iy1oaDe n o;t0 2tmir3ny4am emnct sfsDurumont0opt  ieiyd mDulnmpnu0 eerxf oa1fpDrau ils srxm(r oudlptnmics t)aDraum no0tlx  o3iydlaDum(vo;(4areoir3oa1om e ies () rurxopoudom nlivs s) Dtr(  ;u0alxnmociyt sDumn pn()artrxf3tadlpD  n s;()t2xoxo oy4altelnvtlsfaDtr( pou4tle if3iys aDelums t0trtrxo iadopt luvs t)s2um(o3iydomee fes s artax  ou1tptoifetldfa2umu p;u4 exnif iatlm elieils  2xm(mpiu4lmtnmfeil( srum( p;o4tlxnifetyt m ulumonu0tleoifctodlmte i sls0texr(r iodameelivtlsfsrtauroou4opx  feilsfs2um( p t4arerxf3io1lm rluvslt0teumio no4optelieia(fsDra(ro;o1aeeomfctyt aDumnms (4 rtoxo io1fmDe uvi;s0trtm(m3nu4lm emnetat s2rmum oo4tptn i3tad a rlums (0tlxoxo3totomDe nvo s0s2xoxmpoydomt mneilt  2ua(m oo4alxo i3iytls2emumpnu)arxoxr3iytla eauvilt) exmxm3no4ll nmfvtl(f 2ra(ronu1opxniocilsfm ul(vs;t4tlxoirctatoptrlnvo;s)t2tmir3oy4am  lfvsa(  rum( p;t1opxn oeiytfa ean snu)teenioctatfatraneo;s)s2xo(o3iydaptemnvtlt sDtaxm nt4oexo f3ilsfsDrmu o t0 renmr iodfa rli s;s0srxrxo3oydape mivia(fa2tax  no1apxomicilsfa2ea(msn()trxnxo3iy1omteauvi ()s2xmio3iydlle mies t aDtmurpno0tee  icils s2elnvpnu4aexnxocoadomteli o;( trxmiopiudamtemfvtas s2rrx o;t0oeen ieiltfaDeaump;u4aexomr iatop   uvolt)srumiopno4optnlnvil( srumx o;o0tet if3tlsla2umnvsnt) rxoxo tadfatrai ol() exmiopny4lm nlnct s sDtmxro;t4olto i3iytlm emnvp;u)alxnxr iy1laD ai o;s0t2trxr3nudomee netls sDraurpou0oexoifciatls eanvs;(0altriociadlmtelnvi s)texmio3oo1alenlneiat)aDtmxrp;o4tptnmo3iatlm rlu p ()tlxrio3iodfp eaivo (  rxmim3oy4lmenlfvilt)srrau pno0tle ifcilsfa2rl(vo u)trxrir3to1lm eaivsl( setr(m oodalt  nctl(  Dtau p;o1aptomieiadfaDelu onu4 rermf iadoaDeanvo;t0teum(r no4op nmncsl()artr(rpnu0tpxomfeiadfa ea( pn() reoxf ootlmt  ivi;s) euoim nu4ol emfcs s) 2rru pot1oexoiieiad a ua( o;t0 reoxf3totlaDelnvs;t) 2xmimpoo1apeelneilt)srtr(rp;o4aptoio3tytlm emump;(0arxoxf to1fpt aivsls)sexr(opny4lmen nviatfartmx ont4ole if3tad a2ulnvo u0trxrmo oy1opD auvo;s)trtmxr3ny4ll  lfes t)srur(ront4tpx ioeiasfm rmu s (0arxomo3ta1oateaivols0setoim3iydlpe lnet t sDuru pot1aptn i3ilsls ulnvsnt0arenif ootfateauei;(0srxrxr iydlltemfcil( s2raumo;u1oexoio3iaslmDeluvsnt4 ltrif to1fa rln il( tetmxr ny1omt livt ()sDtrxm no0alx iociytlsDemu on(4tlxrmf ta1lpt lu sls)s2umirpiydlm emfes sfsDta(rpot1altn feilslsDua( p;(0 lxomo totlm e ieo () 2to(r3nydale livsat arraurpoo4tlt mociatfa2ra(mp t4alenmrciotfa  auvi;t  rxo(o3io1op n fcia()s2umxmono0tee mociytls2em(vp;(0texoir3oa1lat  neo;s) rtoim3oo1oleelnctas)srrmxm nu0aptnmieilsfs2umnmo (4aeeoxf oa1fmD aivo t0trxo(opoo1ameelfctas)srumum no4oeto i3iadfa2uan ont) renirciydoaD ln i;s0 2trxo3no4apen fcsa()aDra(  nu1opx  fcils m2ulnvpnu)texnmo todoatr n ilt0setr(o3oy1am n fes s s2trumo;o0apen i3iad mDeln o u)aeeomr3iydlp r u s t)s2tm(r nu1aptelfcs () 2rmxront1tpxo ieiatfa em( sn()aleomr3ty1optr u sls0teuoiopoo4openlnctl( s2rruro;u4apxnif3tls s el(mpnt)altomf tydlm raneo;s0texrim iy4omee ncsat sDrru p;o4alt  oeilsla eauvs t0 rxomr oodfatrlu sls sexrim iydaleemfcia(f 2ta( poo1apenio3tatlaDel(vpnu4arenmr3iytoa eln i;t)srxoxr3iodlp n nctl(fa2truront4teeomo3iytlaDrmnvo t4teerircoadlmDr uei s  2uoxo oy4op n fvtls) Drr(roou1apeo i3iatfa2emuvs u0 exrif iotfmDrauvo;()s2tmir iy4om nmneslt  rtrxm ;t4aexnmfeias aDea( p;t)tetomf iotoate ivo;s)tetoimpny4olt mnci t  rrru pnu1tptnioeiytlmDranvpn()artrmfciydlmteln i s t2ur(r oo4llt  ietltfs2rrxm ot4ope moctysfa2eln on(4 lxrif3oatla eai i;t) rumio nu4openliesl(fs2raxr oo0olxnioctysls eanmont) ltrif3totomD auvi;t0texrxm ou1ll emfeta(fsDtm(r ou4apeo ocils s2emu p;u)tltnxrciodoaDe iesls)trtr(r3ou1alen ncil()a2ra(r ;u0aex  i3tyslm rl(vsnu4artomr3oo1op   uvo t) rumiopiu1op nmneias) 2ur( o;o4ale  f3ils m2rm(ms u4 etrxfctadfmDrai o (  rtoxo oy4lpe mieiatfa2tmxrpnu1teeomoeiatfsDum( pn(0aetomo oy1lateluvi t0teurxo3ny1op nlfesls s2uaumo;t4teenmoeiatfa emnmonu)tlerio3io1fpt luei t)t2umxm oo1amtn nct tfsrtmur nt1opeoiiciysfa2uanvont0aeermo3oadfaD auvs;s trxrim iudal  mfet t a2rmxr ot1tex iicils m rl(mp t) leoif totlmDelu i t  2umxm io1al e ietat a2tm( pnu0oltnio3iat m2uau snt)aleoxf3iatom e ues t sexoxm io4op  mnvsasfaDtmurono1tltn fciyt m2ul( pnu4trtnxf3ta1laDe u ol(0trxoxmpou1llte ivsl(fsDuax o;o1olxomo3iydfs2raump;u)areoxr iadfm elnvi;(0t2xmiopoudlp nmfcsl() Dtm( pnu1tpxn ietydfmDrlnvs;t4 rxnir oo1lpD  u ols) 2xr(opoudal elfct (fs2uau  nu1aet  f3iad m emumo;() lxomrciatfatrln s s0 rxoiopny4amte neiat) rrrxrp;o0opt ioetytfa2um(vp;u4 exnxfcoa1oaDran i;t) 2trim3oy4ap nlici ( arua(rpoo4open ieiasfa em(vpnu)texnxfctotfmt aiei;s srxmxm oodll   ieil() Duax p;o4olxnmiciasfm2em( o;(4teenio iatlptraneo (  rtmir io1apt lies t srurx pno1aptniieiad sDeanvsn()aetoxf3tatoaDraieo;s  2trio3iy1lmt lies ()aDtm(  ot4aetnmieiat m emnvo u0arerir3iatopt li s;t trtoio3ou1ol emfesa()aDraump;t1altniieias m2ul(mp;u) lenmf tytlm  au i t0 euo(m no1amt mnes s aDrax pnu4alxn fctytlsDua( p;t)arenifcoodlpt lu ilt)s2xoimpou1ll nlfei (f 2rr(mont4olx  ieiyslaDelump (4tleoxf3io1oaDeauei (  rum(r3iy1olt liesl()arurump;t4teenifctatfs elnvo;t)tetoio ootfp   ieo t0 exr(mpno4ol   ivi s  Drmx ooo0altniictytls elnvo;(4teenxf ootlmDe nvo t  2xo(r3oudale  ieiat) 2rmxmo;t0alto o3tydfa ea(mp t4aleoxo tytlpDe ivs;t texoxr3iodlle lnvt ()aDua(mp;u0olxnmieildfs eln s;u0 eenmo oydopDr ueo (0t2umxo3oodomtnlictlt)a2rmxm no1tlt ifetysls rm(vp;u4 etnxo oodopD auesl(0s2xriopno4ol  lncsl(  rtrumooo0apxo ieiydls2rmnvonu0aeeoif3oodopteaieslt0t2uo(o ny1am elfei t  Dtaumo;t0tpxn ociytlaDrl(ms (4 eenircoy1laDe u s;s)srto(m3oo1op  lnvslsfs2taxm ou4oeeoii3iyd s ea(vo;u)texrio3to1fp eaieols)setr(m ou4lmee nesasfaDtaxmp;o4opxnmo3ild aDean p u)aeeomr3tatfpt anvs;( s2xo(opno1altn ncsas) rurx oot4tlenmoeiadls2ua(vs;(0teenif tytfm   ivs;()sexrir3iu1amte nvil()srra(m nu4oltoio3tyslm2rl(vont4tltrmr3totfp  anvo s s2tmiopnydapeelnctasfa2trurp;o4aee ioetld s2ul( sn(0 rerio3oo1fa r nvs;s  etr(r3nu4lmenlfetlsfsrra(rp;u4aexo icildfa2rluvp u) etoxociy1omt lneo;s0 exoim3oodlme lneiat srtr(  ;u4tlxo iciad s2eau p u4 etoxf3oodlm  aiei;(  eumxm3iu1ape mies ()srtm(roou4apt iieiasla2elumpnu0 lxrif iadla eli s (0 rur(mpou4optnmicslsf rur(r nt0optn feiadlm2umn p (4tetnifcoytlmtelivi s s2umxmpiu4omtnmnciatfarrr(mpnt1tpxnmiciysfa elumon(0tlxrir3oadfp elivsls)t2xriopoodop elfeil(  2urxm ;o1tex moeiasfm2ua( p;(0arermr3iytfatelues s)sexo(rpio4aptnmnes sfarurxmpnu4teeoifciltls2eluvs;u4 etomfcto1lp eau i (0seum(o iy4op nlfciasf rtaumono0alen f3tatlsDemump;u0 exrmo3oo1fpD auvs t)seur(m3nu1am n iet ( sDum( oou4oleomfciltfm ranmp u0trtrxo3iodlmteau olt srum(rpnydap nlnes t a2rmumonu1apxoii3iltfa2uan pnu4tlxnxr tatfm  auvo ( s2xm(r oy4lpenlfet sf rrm(mo;t4openmieiad aDulu pnu4 exomf3tatfmteliei;s0trurxm nydom  lnvil()aDra(rp;o4aexnmo3ildfmDemuvo;u0tlerir iatlmtr n slt0srxrxo3ou4apee ivsltfs2uaum no1opxoiictyd s2ranvs;u0teenxrcty1om  lneilt trurxm iodoleemncsatfs2rauro;u1apt mfeiasfa2ul( p;(0texnmr3io1lpDelivol(0 2xrio iy1op  lnciltfsrrax  ot4tpxnmfciyt a2um(mp t0 exrmr3ty1omDrau i s0 rtmir nudlp n nei (fsrumx oot0tlx  oeiadlm ul(mp t0tlxoifcoytlpDelivo;( s2xmirpny1amenlfvsat a2tau  ;u0alxo ieildfa2emu pnt4 exomocoadlp r uvi t0 eurxo nydlm nmnet t arrrxmpoo0aex mo3iyd s rm(vs;t0aetoxf3tydfaD lu ilt0 eto(o iodopeelicil( sDra( ono1aetomf3iydfa uan o;t4tetrif iotoa rlneilt)trxr(r3iy1optn ncsatf rraurpno4oexoio3ils aDelnmo;u) eermo3iy1fa e neo ( t2toirpoydalt  fes tfs2tm(ro;u4apx  f3tldlm rluvo;t0 lxnirciatfmte nvsls0srto(m3io1al  lfvsatfsrta(r nt4ale  oetadlmDemump;u0 lenxocoytlaD  ivi;t t2uoxo3iydamtelfetas srrrxm ou4oleomi3tysfaDemn pnu0 ltrxo3totlmtraieolt)t2umxm ny4ame lncta( aDrrx  ;u1aexniiciatla rluvo u0 rtrmr3ootomD lu ils)s2xrxopio1opee neia()srur(rpnt0tltomf3tydfmDuau sn(0altrxocto1lp rau s s0t2umimpiy1openmfvtat sDtauroot1tpxn fctlsfm eaumo;u0trerxf3tydop e neslt setmxr3oydalenlfvilsf 2rau  ;t1alxoioetldfm2um( p u0tltrmo tytoa r u i;s0 2toio nydaltn ieilt) rra( ooo0ole mfctadla eaumsnt) lxnxo3todlaDelu o;(  exo(m3oudopee ieilt)sDrr(  nu4tptn ocildfs uln p;u) eeoxocio1lp  lnvo (0 exrir3nu1lpt mfeiat a2trx pnt4apeoifciat aDuan on(4 rxrxr3tytfmDelnvs ( trxr(r3iodalenlieilt  rtrur ;t4altoiictatfm ra(ms u0 ltnxocta1lpDeauvilt)trxo(m3iy1llen feias  2tm(mpot0opeoioetatfaDean p;t0 renmr ia1laDeau i t) rtoxr oo4lmt mfctl()sDumur ot4aeeomf3iat s umumsn(0 etnxr oo1fp rln ol(  exr(o3oo4ol nmfeslt artmx o;o4olx  ictyt s umuvpnt4trenmr3ta1fmDelueolt0t2umxm ny1lm n nct sf 2umxro;u1altnii3iytla rmu snu4aexrif3totlp  lu s;(  2xoir3ny4openlncta(fs2taum nu4tltnmfetas m elumsnu)tleomf3iydfa e ueslt trur(r no4optnmneiat) 2rr(mpnt4tpxomicild s rmuvs;u)texrmo3iotlmD  u ol( s2xo(m oy1lmt  fvtatfsDtrxm ;t1tlenmieiaslm eanvo;(4 eerxocoydoat livi s0setr(m nu1olee ivtat sDtmur no1tlenmieiatfm2rlnmont)arenxoctadfat ln s;( srxmxo3io1oltnmivia( aDtruroot4aexnmoetas aDrl( o t4trtrxrcoydlatrauvo t0tetm(rpiudopt lnei t)aDra( o;o1tleo ieiyd s rmnvs t) lxrmociydomDr ivs;s) eurxr io1altnlictat aDur(  ot1tpeo fciydfm umu p;(4 eerif3iy1fm eluvi s teur(mpoy1alt  nvtlt)a2rax pno1tex moeiadlaDrl(mp t0tlerxr iydfpD  ivo;(0srxoimpoudoptelivt tfsrtru onu0opeoiiciys s umn s t4arenif3ia1omt lu s;(0 2xm(mpiodlpeemneias  rurxroot4tpenmoeiasla rln s;t)trxnxfciy1om eli s ( sruo(opio1lptelnesl(  Drrx  ;u0tpeniociysfa2el(vo (4 rermr iadop  an il( s2xrir ou1op   nviatf Dta( pnu1apxo fciadfsDuln pn(4aeerir3oodom eai il()s2xrir iu1lp e fcslsfa2rrxroou4aeenmocild a um( o;u) eermrcta1fp  aueslt0teum(rpny4lpte nvilt aDua(  nt0oleomictltls2umn p u0 ltnmo iadlaDe n s;(0srxmim iodom e fvsat aDtm(rpoo0oltnifeiad a2umump ()teenxrcoy1la e ivols0texoir3iu4al nlicsls s2ua( ooo4olxoifctyd m2rln s (0 rtrio3iatfm   uvs;s) 2umim3iu4ape  fcsas)srrmum ou0altomociys s2ulums u4trtnxrcoa1lp elies;t)srtoio3io4ape mnvil()sDrrxm ot0oex  icils aDemn sn()arxoxo3ootoatraiei t  2uoir3io4ll   nvi tfsruaxmoou0texo f3ildlsDrl(ms;(4trerircoytfa r u s;t  rumxo3nodap   fvt t a2ua(  ;o0tptniocilslmDemnmonu4altnmo3tadopD an o (0texo(r3iodap e fesatfsrtmxm ;u1tet  ociad sDumuvs u4aexomf oadomDrauvi () 2xm(o3nudolt  net s  2tr(  oo4teenmo3ilsfaDeln s;(4trtnirciotom r u i t0 2to(m no1ll nlnvt ( srrruro;t0apeomociltfaDrmumont4 lxoxf3tydfaD  neslt srxmxo no4aleelneslsfa2ururpou0tleniieiydfsDemumsn()tetnir oadomDeauvil()s2ur(m iudop n ivsa()srrrxmp;u1tltnmociat m2raumont0 rtnioctotom   n o t srur(opoy4olte nesa(f rtau  ot1apxn fctytfmDem( ont4 rtnxociotla rai il(0s2umxmpiodam  lfet s  rrmu oot0aleo octldfs2rm( o;() rtrmo ta1fptrlueo (  2trxopny1omtnlfesas  2umxront0oexn f3iysfs2rmnvp t)altomf3oydlaD auvi s  rxoxr3oydam e nesas  2rr(roou1oexomfeiyd aDem( o (0alxoxr iatlpt anvi t) rtriopnodom nlict s)artm(mooo4olxomociydfm2ea(vp;u4alxoif3iotfa rluvi;(  2xmiopio1ol   iei t) rurur ;u1opeo i3tadlmDumn s;u)teeoif3iadopDrauvo;()t2tmirpoudlp e fci (fsDta(mp;o4alenifeiat a um( p;u)artrio3todopte nvs t) rxoxr ou1amtelnes s a2rax p;u0oet ii3tytls uluvsn(0arxrir3iadfaDrlnvi ()srxrim oudll elies ()sDur(mpno1olxo fciydfa2uauvp;t4aeerxocoadfa rluvs;s0 2xoxm oo4alee ivsatfaDrmumont4aleoii3tadlsDem(mp t) leoxr oa1lpD  n o;s  eumxr oy4amtnlnei ( aDtm(  ;u1oltoiictatfsDrmnmp;u0 renifciadlate ues s sexmxm ny4ll nmicia() rraxmpot4tetnii3tys m2rl(vo;u4 eeoxfctatfm elnes ()t2tmxrpny1alenmiet ()s2ua(mpnu0ale iietaslm2ul(mp u) ltrxf3io1lpDe i o;s  2toxm iy4altemnvias aDur(rpot1tpxnifciysfsDumnvp t)aeerxo3oo1laDelneo t srurio oydaptemict sf Duaxmpot1oee  icildfm eau p ()tetnifciadfa raneo;s) 2toir3iu4ape  fvi s)srrrxmo;u4aex mictyt m rl(ms (0altomf iadla   n olt teto(mpio4om   fvi ()srur( p;o1apenmfciltfm2rmumo;u0 rtrif iy1oa r i i () eur(mpou4om nlivi (f Dtm(moot1oeeoiociasls umnvp u)aetrmf3oatfp eli s t trurxo3iydope  iei s s2urur no0tpxoiicilt m2eanmo t0aexomo ia1la rliei;t0seurxopoo4opeemnei sfaruaxrpou0oleoifcils aDem( onu4tetoir3oatopD auvo t)trur(r iy1amee fetas) Drau onu4alxnio3tyt s ul(msnu4 etnmocoa1lm  ai i t sruoxm3oy1am  lnct ()sDurxroot1aexo oeiadfm2ea(vo;() etrmfciatfmtrluvi;t) exo(r iy1omee ncsa( sruaxro;o1aptoiieiadls2ea(vpn(4tetrif iodfm  anvsls) euo(mpnodamt  fvilt a2urx pnu1apt  octasfaDrlnvs;(0tetoio oy1lat  u olt)trur(r iodal nliciatf Drmu poo4teenmoetld mDemums;u) lxniocoatoa rlnvo;s trxoxr iu1llee fci sfsruaxro;u0teeo o3iad mDel(mpnu4trenxo3oatopteanvo;t0trxoxr iodap nlietl() rum(m no4oex iictls mDumnvsnu4arxoxr oadom   u s;t0sruo(o iy1ol emncsl(  2ur(ronu1tet mo3iadfs2ranmp;u4texoxo totlaD anvi;s  rto(rpoodlmtnmnctat s2uru oou0teeniocilslm elu snt4 eeoxr3io1omte n s;t0texm(opiudlle lnet (fa2rr(mo;o0tex miciyslsDuan o;t4arermf3oatfmte ivi () etrxo3nu1omt  fvilt sDraxmp;o0tleo ietlsfs ea(mo;u0 rtoxfctytoa raivi s) rurxrpny4aptn feil(fsrumxm ot4tlxnmoeildfmDel( o;t4teeoxocoy1omD au s;t)teuo(m ou4apt  netat  2taumo;t1opxomi3ias mDulu s;()aeenif3tatfateanes;(0 rxm(mpio1lltemfes s)sDum( p;o0tpt  ociytla2rmnvon(4 lenmf3tydfp  livi ( texr(m3iy4lm elfcilt sDtm( o;t4oexo f3iatfs ulu s;t) rxoircootlp  an o s  2umiopou4lmen ncs ( srtmxrpnt1aexoiictld s2uaumo;t)tetrmr3oa1fpD  nes;t  2xm(m iydope lietlt  Drauro;o1alx iiciysls um( p;(4 eerxr3to1fate nvs t  2um(o3iu4lp elfeiat)arrmu pnt1aetomfciltlm2umu p t4 lxnmo iatlm   ieo;s texoir3oy4apt lfviatfa2trxr nt1tex  icildfm eluvsnu4tltrir3tadlm ean sls  2ur(opnu1ope mfvtl()s2rrx  no4tpt mociytla2rau s ()aetrmrcoodlate uvo t  etoxrpnodapee iei sfsrraumo;t1alx mfeiysls ean snu4teermr3oadfa   ivo;(0 etoxm3oy4omenmneta(  2urxro;u0tlxo i3iadlsDel(vo;u)trtnxo3oytlat lu il(0s2xr(opoudolt  ivt tfarumxmp;o4tlxomf3iatfs2ea(vs (0teeoiocta1omDrln olt0srtmir iu4omt mneia(fsDtaur no1tleoifcilsfaDeln pnt4tlxoio ia1lm eaiei s0 2tmim3oudal  mnvs s) rumxmooo4aeen oeiysla2rm(mo;(4teenmf3ta1fmt  u il( texoxmpoy1lp nlfctls a2taumoot4tlxoii3tatla uan ont0treoio3oa1omD ai o;t  rtrxo3io4lpe mnetl()a2uau  no4aex  i3ildfmDelnvo;u4alxrxo oatopDr ueil()tetmxo3iodalte ivtat sDtr(r ;u4apxn feiat s rauvsnt4arxoioctotoaDeaues s t2toio3iy4al  mnetas)a2rr(rpoo4tltn octytlsDemu s;t) exnif iydfmD  neslt s2toimpiydlpee ncias)aDtrxr ;o4oeen ictydlm2ranvo u)aexrio to1omtraiei ()t2xoxm io1al  mnctat)a2rm(m nu1tetomo3iysfaDel(mo;t)aetnxr oydla rln o;s0 rxoio ou4al e nesa( srtmuront4opt if3iasfaDra( s u) lxoifcty1la ran s;s srto(m nudamt  nvsa(  Dumur ot0olt mf3tld sDulnmp;(4altrxr oydfpD anes s srtoxmpiu4lpenmfes s sDra( o;u4alto oeiydfmDum( s;t0altomr ia1lp rli i t)truoimpio4alt mivslt)sDuax ont0olt iietytfs2ranvpnu) exnxf3ia1fp ranes ()truoxmpiy4lp   neta( sDrm(rpoo4apxoiictysfs2el(vo;t4tlxrmociytfmt  nvo ( seuriopiydopenmfciatfsrrmx oot1tpx  f3iaslm el(ms u0alxoirciodlat auesls trur(m3io1apenmneia(f 2ua(rpoo0tlxomfciasfs2elu on(4 rxoxocoo1fm  lneo ()s2trirpiy1op  mfeia(  Dtrx ont0alenmieils m eaumsnt0trtnxrcoadfp  li i (  exoxrpiu1ll n nvsl(  2raxrpoo4oleniociltls2eanvo;(0trxnxo iy1om elnvs t) rxrio3nodlpt micsasf rtrx o;o0tptomieildlmDumnms t4 rxnio3iydfa r ieo;s t2xm(r no4lltnmici (  rtr( p;o0tpeo feiasfa umnvpnu)alxoxo3ootfateaieil(0seumir3iy1lmenlfvsa(  rrm(ro;u0apto iciatlsDrmnvpn(4 leomr3oodlmD  ivi;s)setoimpoodam nmnetl( arra(mp;t0aexnmo3ilt a2elnvo;t4alxoiociy1laD aivslt texrim iu4altelietls) 2raump;o0aetnmociasla rm(vs t4altrir3tadlaD  nvo t0 rxrxmpiudop e fetas)aDtr(rpnu1aexn o3ilt a2um(mo t0 rxnirctadoaD  uvil()t2xr(o ny4al  lnvslsf rrmxm no1oleoiieildlm eluvon(0aeeoxo3ia1la raies;s trurxo no4ap nlicsa(f rtmu pno1tpenmoeiysls2ulnmo;(0 rtnxocoy1om elu s s  eumio nu1oltnmnct s) Dtm(mpot4olxn ociadls2rlnms (0trtoxf iy1lmtrlivols  2toir nudom n fvtatfa2uau pno4tptomociasla2elu on(4tleoxrcto1la eanvsl() 2um(o3ny1olte nvtls srtax  no1aeto f3ils mDemuvont)tlxomr3oy1opDran slt0seumiopou4lp  lfet t)arra(m ;t1oeeomoctatfsDrlnms;u)areoxf iatlat  ieo t  euoim3iu1apee fcs s)sDua(rp;o0opeomfetys aDuanvs () leoif oo1oaD lueol(0 2xrim oodlle mnvsls) 2rrurono0apen ictadfs2uln o t) rerxo3tatomDr uvol( seuoxo nydole mict (fsrtaumpot1opto fciltfm rluvp;t0teeoif tadop   u o;( truoir nudlm  lfctasf Durxm ;u4opxoif3iadfaDrmu p t4treoxr ta1latelivo s0t2xoio io1omt  fvtas  rur(  ;o1optniieiydfmDumn p;u0 ltnxo iytom   nvolt)sruoir3oo4olt  ivs ( arra(monu0apeoioetydfa2ra(ms u) rxnxr totoate nvo (0t2tmir3iy1apte ietltf 2rrxrpno0oexomictas aDelnvonu4altrxf3ty1fm  livils  rtoiopiu1lme  fes ()s2rr(ro;u4apto o3tys aDeluvo;(0tltrifcio1fateaieo s)texmim ny1lptelivsas)s2ua(m ;o1aptnioeilt aDul( o;(0 lxnmf3oo1lmtr ies;t) 2xoxr3io4ap  lfvt tfs2tax pno4tpeo oetld mDra( ont4arerxr3totoat luvsl( trtmir nu4op  mfcsls aDtaum ;u4oet mo3tydlm emnvp t0trtnxf3oa1oa rlivols)setoio iy1lpt lfvsat srraurp;o0texnmoetltla rlnvon() etrxocoydlatrauvs;s trto(r3ny1ll e ivtl(fartaum ;o4tptoiieiys m2eanvs;t)tltrxocty1lmDe neilt0texrxm3iudapee fvsls)srtru ont0aexnioctls s ean snu4tlenif ia1oa  ln s t0 rumiopoydoptnmiviat aDumur ot1teeniocilslm elu on(0texnmocoo1opteln slt)s2tr(m3ny4lm n nes ()sruau ont0tex mfetys a2ul(vo;() rxrmf oodoptr nesl()sruoim3oo4ole mfes s  rtmx  ot0apx moeildlsDra( o u0alerxrctydlaDrli o;s0 2tmim no4ap   iei t a2rrxmp;u4oexnioetas sDean ont0tlxomo3io1omD lu i s t2trxopou1om nmnvs t) 2trxrpnu1tpeoifctytfm2rln o t0aleomo oadfptrln sl(0 ruoxopiudlpen nvsa( s2tmurpou1olxomfciatfaDeau s;u0aeenir iydfpt  neilt0 rtmxmpoo4al e fctlsf Drm(rp;o4tpxnio3ils sDuau p;u) rxomfcoytlpt lneo s  etr(mpnodlltemfcs s)sDrrum no1texn o3ildfaDraumpnu0 rtrxr iytomDrlu o;(0truo(o3iu1ole lnvslt a2rmur ;t1tptomi3tatfaDemump;()aexnxo3oy1fpDr iei (  2xm(opoo1ome  ivi tfsDuau p;t1oltomi3iadla uan o u4tltnio oy1fa  lnes;t0sruoio nodlptemiesat)a2uauronu1olx iieiadla2um(mpn(0 eenmocootlateaivols teur(m no4apeelies t) rtru  ;u4apxnmoeildfa2umu on(0teenxocoadomDeaies ()seur(r nydamenlnesa( arta(r ot1oeeniiciysls2ua(msn(0 etomr3iotopt lu slt)texr(opoydamtn fesas sDtrxrpno1aleoif3taslsDemu s;t)areoxocty1lmtrai ils  rtrir3nu1alt mfvias) rta(ront4alxomociadfa emump;t0arermr tydfpt anei ()sexoio ou1altelfcs s)aDurx  ou0teen iciyt s ua(vp (4altnir3oy1faDr u o s)trtrxo3io4lm nlneils)sDta(mo;u1aetnmictlsfs emnvs;t0 rtnio oydfm  lnvil(0teuoxm oydomte fet ()srtrx pnu1opto ieiasfa uluvs u4 exrmf oa1fmtelieil( srtmxrpno1omt  neta() Durx pou1olx ioeildla rl(msnu)tetnir3ootlat an s (0trxoir ny4oltnmfvil(  rtax pnt4alto o3iad m el( s ()tetomf3todomDrauvsls  euoiopoudlltemnet tfartax o;t1aetn o3iys s el(mp t)altnmo3tatlmtelnvils)s2tmim3no4ap elnctlt s2rmum ;u0tle ifcildfa2rm(ms;(4tltrxr iotfat aies t  rtmim iydamtelies s a2rax o;o1alt mfeiytfaDeln s (4 reoxfctadfp  an s (0texr(opnu4aptemfeias aDtmxronu1tlen fciyt a rlnvs t0teeomr3tadlmDranvo s0trum(m3nu1altnmfvtlt a2tmx  nu1aeto o3tld sDem(mo (0tleoif ty1faDeai ols)trtm(m iydamee ietl( a2tr(rooo1aptoifctld s2rm(mon(4 lxnir oo1lpDr uesl(0 rumxmpiu1opt mfcs (fsDtmxro;t1oltnmi3tlsla2rmu snu)aetoxrciotomt  ivs;(0 2to(r oy4apenmfeslt)s2urx pnu4ole mocils m2el(vs;t0 rtoxfciydlatelivi ( srxoxo3iudopt  nvia()sDrru ooo4olxoioeilslm ua(vont0 rxrirciotfatrli o;s  2urxo3iydlp elnvs sfaDtr(mooo0teenifeiadlsDran o;(4 lenif3tytfpDraivo t seum(opiu1ol emnvs tfs2ra(rpno4apx mf3ias m ul(msn()trenir oytlate n o;s0 2triopoydop n fcsl( aDtmxm ot4olx  feiyd m rm(vp;()artrifcootfaDrlnvo s0sexmio3iudlptn fcsl(fs2rmum ou4aexnifeiltlm um(vo ()tltomf3oy1laDr uvs (0 etmxmpoodale  fet s) Drrxmpot1tetomfeias s2eauvo u0artnxfcoatfatrlneo;t0setrio3iy1olte fcslsfsrrrx o;o1alt moeildla ua( onu4teerifcta1lp  luvs;t0s2uoxmpnu1amt mict s)aDtmu o;u1aexo octytfs umn pn() exrmr3oatomDelivolt0 rxo(o oodomenlncs s)artmumpnu4open ociytfa emumsnt)tleomf3tytlmDeaies t t2xrxo nudlm e nesltf rrrxrono4opxnmi3iydlaDea( s;u) rxrxr3ta1lmteauvi;s sexmxr3oodapee fviatf 2rm(ro;t1oltnmo3iadls rluvp (4 eeoif tytlm raiei s s2xmim3iu1al emicsa()artmu  nu0aeeomo3iyslm rmuvsnt0 exoxrciydfaD aneo;t)s2xmxrpnodlm nlncias sDtrxmono1oexnmf3ilt m2ulnmp u)aexoif tytfatelu i;t) rxrxopoo1am  mnetlsfsDuaum ou1tpe  oetytfm2ulump t0tetnxr3tydlaD  uvs s0srtr(o iy4ll nmieilt aDraum ;o0tlx mfctlsfm um( on(0altoircoodoaDelu s;s  rtoiopnu4lm e nct tfsrumu  ;t0alxoii3iyt mDrmu o;()artrxo iytopt lu i s trtrir3oy1amt  feils) 2um(r nu4oltniieiatfmDemnvs;t)aetnmo3io1op elnei;(  2uoxrpoo1aleemfvsa(fs2ua(r oo0texo feiasfs rmn o;(0 lxnir iytlateaieolt  2xoiopno4altnlfvsas)artax p;u0aet moetasla2ea(vsn()artrxo3tatfa  li
\ No newline at end of file
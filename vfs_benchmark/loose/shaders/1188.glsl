@@ -0,0 +1 @@
+ivo;(0s2ur(opiu4ap nlnei ()s2tru pnt4oltoii3tltlmDua(vo u4trxrxf oodlm rlneslt srxoio3io1op e fesat sDraxr oo0tpe io3iys m2rm(vo;(0 lxoxfciydopDeai slt0 2tmir oodlpt mfcsas s2uau poo1ape  ieiytlm2raums (0aexrmrciydfa e ivo t0t2to(o nu4am  lnet t)sDtaum ;u0aexnifeiltfs2elu s (4arxrxf3iydlp r uvs s0 exm(r3io4al nmnvsasfsruaxrp;u1alto oeiad aDemnvpnt)trxrxfcoatlaDran i;t s2tr(m no1open feil(fsrrmxm oo4oee ii3iyslm rlnmonu4artoxf ootlpD  uvil(0 2uoio oo4am e fet s srtaxrono1ope  fcilsfmDrmumon() exoif iotfatr nvs;t  rtm(r oudapte nvs s s2tmx pno0aeenmi3tlt aDuanms;()areoxrciotfp rliei;t trumxm nu4lp nlfvi s)sDuax pno4tpeo f3tat aDum( o;t4trermfcta1omtrln i;s)s2toxo no4omeelncsas)aDrmumpno1apxniictltla rmu p;u4tetomf tydlm rlieo s)t2ur(m no4lp emivs ()a2umum no4tle  i3iytla2emn p;t4areoxo oa1lp   i s s0 2to(m no4om  lfetl()arrr(r ou1aleomf3ildlm rlump;u0 exomr oo1lpDranes t)srtrxr3io1lme  nvta( srrmxro;u1aeenif3iys a ranmp u)aeerir3to1lpD livi ()texo(o iudap emnvt t)a2trxr oo1olx miciydls uaumo;u4 renmf iy1fpt lueo (0t2uo(rpiydap n ncia() rum(roou1tex if3iadfa rl(mpnt4trtrifctadoat auesls0srxmxmpnudalt lfcslsf 2raxrpou1tleo ociyd s um(vo t0 eeomf3oydfaD ai ils  eurxr3iy4op n feil(fsDua(mo;o0oet ifeilt a2elnmp;()trtnmr3tydla rln o;( srto(m3iy4optn icsl(farraxr ;u4tlto f3tld m el(ms;(0aeenmf iodlmD lu o;s0s2xmir3oy4ol nmivs ()a2rrur no0aet  f3iad s2eln onu0 lermrcoydomDe ueo;t trto(m3ou1ol e nvsl(fsDrr(m ;u0ale  fctadlm raumsnu)artrxo3tydfm elneslt0 rxmir oy1lp  lfvtlt) 2rm(mpnt4olen octltfsDrauvs u0altrmo iy1fa  lneslt  2xr(mpnu4al   ivsltf Drm(rpoo4alt  fciadls2em( snu)arxnifciotlmteauvslt0srxrxo iudlmeemnei s  rtm(  ;u0oleomfctyt mDua(vp u0alerir3iydlmtr u o ( s2uo(o3ny4op nmici t)aDtaxrp;o0tleomictasls2umnvs;u0tlerxr3oo1opDr i o t0 euoim iy4alt  fcs ()aDtrumpnu4oltnmictydlm2rl( p;u4 rxrirctydfa r nvols0 2tr(opny1lltn ncsls) 2rmxmooo0tlx if3iyt sDrlumpnu) rerxo ia1latrai o (0s2xr(o nodlpe lfes (  rrm(  no1aex  fctlt sDemuvp u4aexnmrcoatfmDr i o;( s2ur(r no4ll nmfcilt)a2tr(ronu0altomo3ild mDrm(vp (0areoifciadlp  ln i;(  exm(o3nudaptnmics s)srrr(mo;u4tpxnmfetadfa emn s t0 renircty1fatranvo;( s2uoir3io4lmtnmfct t)srrrx p;t1optn i3iytls rm(vo;u)tlxnxr3to1fmD anesls0srurio3iodam n icil()sDta(  ;u0apenmoetadfsDuau snt4aexnxocta1fm rluei;s0tetoio3oydll nmnvilt)a2urx ono4tetoii3iasfm umuvp u)alxrxf3tytom ranvi s0 etrirpoudomt mieil( aDur( pnu0tptniiciasfaDulumpn(4arermr oydlptelueils  2uoiopoo1omtemneil(fs2umxmp;o1oex  f3tls sDua(vp;t)arxrircoo1lmDr n s t)teuoir oydlmtnmfvi (f 2raurp;u4oex ifeiydfsDuan o () eenifciatfmD an i;t0s2xm(m3nu4ole  fei (  rtmurp;o0tee  octatfm2rlu pnt)aeenifcoytlpteluvo;( texo(r3oydll emiviat  Durx p;o0tetoioetaslaDeaumo (4texnmr oo1fp r n ols0s2uoir no4om nmfci t)arururo;u0opx iociatfa rm(vsn(4arenxf to1fm eluvo;s0texo(m oy4lmt mfvsltfaDta( pno1teenmfcilsla umuvo (0 etnmf tydom elies s) rxo(o3oo1om emivs sfsrtrum ;o4alxomfciat mDul( pnt4 etnxf3totlpDeli s s  2urir oudlme lnetlt) rrm(m nu0tpt mi3tytlaDrmuvo t)artrmf oy1fm eaivo t)seuoim nodll  lfesa(fa2ua(r nu1aeeoii3tyt a uluvont0tetnmfciytoaD aiei s0seurxo3iodlptelnctlsf Dtmumono0aeto octysls2ua(ms;u0tltrif3oytlaD  ieo;()srur(o oy1lptemivs (  Dta(mont0apxn iciasfmDeaumo;t4teeomf oo1fpt  n olt0t2urxo3no1ale lfet s srur( pnu4tpenifetyd mDean on(0teerioctodlaDeaivs s0 2xrim iu4lmt  fcils s2rmxmono4aeenifciatfs2rm(mo (4 rtrir3iydom   nvs s teumir3nodalte ies s  2umxmooo4teeomoctytfa2el(mo u4 ltoif3oadlaD  nei;s)s2umir iu1ol   ivsls  2trx pno4tle moeias s ul( pn() leoxrcto1faDe nvo t sexrxrpiydomt  ivi tf Drm(r oo4tlxnmieiysfmDuln on(0 lenxo3iydopt  nvils)t2umiopiu4ameelicil(f rumumpou1tlxomieiltlsDrauvo;u0treomfcoydfpDrau i;()t2xmir3ou1opte fetas aDrr(mo;o4altoioctldfs eln o t4 rtoir ta1faD aiei;s)setmir oodam n nci t)srum( p;t0tet  oeiatfm2uanvp;u4aeenifctatlm rlivolt0 etoirpiy4lmt  ivtlsfaDta(mo;o4tle mf3iydlmDrl(vsn(4alermoctydomtelnvs;(0s2trimpio1amte fcs tf rumxm ;t4teen i3tls a2eluvs;t0aetnirciytfmDr uei s  rumio3no1lpee nei tfa2tauro;u4ole mieildfs2elumsn(0tlermf3iydlmteai s (0s2xrir no4apt lnci (faDur(rpnt1tle moeildls eau p ()aeeoir iotla eau il() 2xoir oo4alenmfvt s aDtau pot0optnioctyt s emums;t) rxoxf iadlmD  nvolt  2trim3nodllteliei () rtru o;o4tpx  o3tydfm2rl( p u0tlxrircoytoptrlivo;t0 rto(r3ou4ol e nciatf 2tmxmooo0ape mfctas aDranms;t)arermf oodlaDrlivo s s2urxrpiu4omtnlneslsfa2rrx pno4teeo fciydla ra(mpnu4aexrxo tydopDelnvi t t2uo(m3nu1lpeemfvi tfa2rrxrp;o4tpxnifeiltlaDrmuvonu)artomf iadfaDeanvsls)srxmxm3oodolenmnvsa(  Drrur ;u4aet ifeilt s rm(ms;u)aexrio3ta1oaDeln i t s2uoim nudaptnlfct ()s2tr(m ;u1tlx ioeiydfa2el(mpnu4teerircta1lpt  u i;t  2ur(m oo1am emiesasf rta(mooo4oeto o3tadlmDemu s;(4artnxr3to1laD aueolt0s2umiopiy1altemiei () 2urxmpou0aexomo3iltls umnvsnt4areoxr oytopDr uvils0seuoimpoy1lltnlncsl(fsDrmx  nu4tee  fctasfm2umnvo;u0 lxoif iytfmteln i;s0t2tr(o3ny4amtnmivia()aDuru  ;u4opxnmiciadfm ul(vo () rtniocty1opD  uvo ()s2trirpiy4ameelncsat)s2tm( ooo1altn ociytfs emuvs u4arenifcoodlpt lueilt0 euoio3iudap  mnesat)aDumx p;u1tpxnioctatfs rlnvont4 exnif tydlpD livslt0t2triopiu1om  liviat sDuaumpoo0aeeo ieiatfm eau p;t4arenxr3oytomtraieil() rtm(rpiy1am  miesl()s2tauro;o1oexomo3tls mDra(vs;(0aetoxo3oytfmDe nes s tetoxr ou4ole  fvtasfs2taxr no4opt mfciat a2ulump t0trenio iy1lmD li i;t)srtr(mpio1ap eliet ()sDrrurooo4optn fcias a rmnms;t)tltrio3iatlmDrluvi;s)s2urxrpoy1ome lnei t)a2tmxmo;o1teeomfciyslmDemuvs;u0tlxoxr oo1fpDr uvs (0 rxmxm3oydoptnmici ()aDraurpnu1apx if3tltla2uanms;u)arxoxr3tatla eln slt0 2uoxm3iydom elfesas sDtmxmono1tex mi3iytfmDuauvs (4 rtrxr to1oat lnvs (0sruoir nodalenmfviltfs2ra(moou0aet ioetlt s2um( s t0tlenxr3iotfm e ies;t t2xo(opnu4olte fetat)srtauront4tlx iiciadlsDem(msn(4 eermfcio1oaDe uvo s0 etr(o3iy1lmenlivsl(fsrtrxm ;t1oltniociytfa rl(vo;()arenmr3tydlateln i;t0t2urio3nodll elfvsls)srrm(  no4aleo ietatfs um(vsn()texrif todfaDeluvo;(0texoir3oudlmt lfvtlt aDumx pnu1oltn o3tydfm2rluvo;u0artnxf to1fpD anvsl(0 etmxrpoy4lpee nesl() Dumxr ou4teenmfciltfa rm( onu0aetrio3oytfmDe ueslt srxm(rpnu1om nmnviltfarur(mp;t0tptnioeiydla2rlnvs;u0 rermr3oo1laD ln i s)tetoiopoodll nlicsas  2tmur no1oltoiociyt a2uauvsnt0tlxnxf3ootoa eaneolt0t2tmio iodlp e nvia( srrmx pnu1oee moeils s emuvsnu4tetomf oy1lptrai o s)s2xmirpnudllenmfcil(fsrtaxr ;o0opx ioeiasfm2ul( s;t0altnxrciatom rauvo;s0 rtrxo oy4lltelfesas) Draxrono1alen octad aDumuvon()aeerioctytomD lnesl(0t2umio3nu1op nlnviat a2ur(rpou0oleo iciysfsDeauvp (4treomociy1fptrliei ()teumim3oo1ol nlfeilsfsDtaump;o4tpxo i3tysfs2elump;u0 eenirctytoa ran slt)srumxo ny1amenlnei ()srua( p;t0tpto ieiasfsDua(vo t0 etrir iydlmDean i s s2urxrpiy1am n netatfsDrmum ot1olt ioctatfs2ul(vsnu0aeeomrcoo1fpt anvi t) 2xm(m3iu4olee nei sfs2taump;t4aptoioeiyt s2rlumsnt)texnmo3oadop elneilt)teur(m3iu1aptnmies sf rrru  ou0aptomfetltlmDea(vsnt0artrxr3tatlaDeli s s0 euo(m3iu4lptelfci (  Duaur no0tpt ii3tad s ranvo u4aexoxo iy1latelieo;s0s2tmir3oo4olt  ivs tfarraxmont0texn ietyslm eanvs;(4arermfcoy1lpDr ivol(0 eurio3ny1lp  lnvia()sDrmumono0tpeoioeiydlsDemu sn() ltoif to1fatr n ol( s2umxr3iu4lp  mfes ( s2rr(mpno1tlx mf3iaslm2rl(mp ()trxoxf ta1om  au o;( trxoxo ny4oleemnvi s aDurxm ;u1oet mfcilslm2uau o u0tltoio tytlmDeau o ( srtmio iodom nmnci t)sDrrxm ;t4teeo octlslsDelnms;(4texrmfcio1omDrai i s truoxrpny4al nlicsas a2ua( o;t1opt mfciyslm2eln p t4alermfcto1lpDeli il( trur(opou4aleemict ()a2ta(mpot4alx  oeiyslmDrauvs t0 exnxr to1fp  ai o s tetm(m oy4olteliesl(  rum( p;u4tpe mf3tlsfs eluvo;t) etnir3iodfaD anei;t0 rxmio3iu4amtnmfvsat) rtaxrp;u0olenioctas aDua(vp u0 rermf3to1om r nvi;s) rumxr3iodole mnet (  rumxmp;t1aptnmoeildlm raums;t0 ltrmrciatfat lnvols0 etmiopiy4omtn ies (  2rrxm ;o0aet  f3tasfmDrmu on(4 ltnio3oatop rln s s) exo(r3iu4omenlnci t) rrmumoot1tlxomi3iltfa2ean p;() eermo3ty1oaDr uvo ( seto(mpiu4lp e nvs tf Dtrx ont0tlxnmfeiys m2rm(vp (0altrxocootomtr nvi (0teto(o iudlp nmnci sf Dua(rpot0aexoii3ildlaDrm( s t)tltnircoa1lmtrluvi t) eurio oudlp elics tfsDumu ooo0oetomi3iadlaDra( snt)aexrxr3oydom eaueil( srurim no1om emfct (fa2rrurpnt4aetnifciasfa2um( p t)tltomrctatopDran i;t) 2tr(r ou4omtnmnvs t) Dtmxmp;o0opeomi3tltlsDem(vo (0tltoif iatop   u o;s)trto(r3oo1lptemnei ( aDtaurp;t4alx  feiltfm2eauvo t4aetoiocoa1fpDeli o () eur(rpiydap nlfcs t)sDra(mpno4opxomoeilt sDea( p (0alenif3ootlm rlnesl(0srtoiopoydoltnlivs s) rtm(roou0tptoifeiasfaDrluvp;u)aexnxrcio1fpt livi;t  etrxmpoy4apeelfvils a2tm(  ;t1tpeoifctysfmDrauvo;t4trtnmf oydfmte neo t0texoimpny4amee nvilt  rurur no4tee iiciatls ra(vo u)artnxo3ta1lmt livo s0texmxr nodam  mictls sDrm( pnt4texomicildfa2rlnmp u4aleoxrctytlp elues;s trumir nodamen net (f 2rrur ;u4aexn fciatlm2rm( o;(0texnmocootlm eai i t)sexrio3oudoltn fvia(fa2ur(m nt4tleniociltfaDumumo t0 lenir3oo1la r ies;(0trxoxopiy1ol nmnvi t)arta( oou4opxo ieiys s2el(mo;(0aexnmf ta1omDr nvs (  rxo(rpno1opee ncs s a2tr(mpoo4oee moeilsfs2ranmp;t4altrxo to1opt luvi s0 rumxr iy4lm nlfvsls) rra(  oo1alenmietltfm2uau s;u0 rxnxfcoatlp  anvs;s0texoim3no1llteliei (f Dra(mp;o1tlx io3tadlmDumumo;u4 exoxrciatom  an il()texm(rpoy1open ictas aDumx o;u1aex iiciyt s2ulump t4 lenxo3oytlpDraiei s0tetrxm3nudlme  netatf 2ua(moou0oltomictaslaDeanvo () reoxr oydoaD  uvs ( srum(o3ny1ope mivtlsfsrtrumoou1apx  fciytls2rmn p;t4trerxf3iytlptrlnvi t0 etoxmpio4lpee netas  rtmurp;t1oexn ictytla ranmp;t) rtomr3oodlp rau o (0 2uo(r ou1omt lnesl()sDumur nt0opxn o3ilt s2umn snt4 eeoir3iotop elues s0 2to(o ny4omtnmnct t  rrmu ono1texoii3iys aDrauvo (4tlerioctytlmt  ivs;t0s2xr(mpoo4aleemfvsa( artr(r ;u1opxomo3iat a ra(ms;(0arxnxrcoa1fpD anvs (  2tm(rpiudopte fcs sf rrrx pnt0aetomf3iasfa ra( s u4tltnxo tydlaD ln o;t) etrio3oo1lme livil(faDtm(mp;u0tet  octltla2ra(mont)aeeoir oo1faDrau i;s0setoirpiu1ap nmnet ( a2tr(rpot4tex  i3tldlm uanvs t0 etniocoytla rau s ( sexm(rpnodol elfvs () rtax p;o4tetnmoeias mDranmo;() exnio iatoaDeauei ()s2um(o no1lle  nvil() rtau onu4oexn f3tat s umuvon(0 lxomr io1lateanvsls) rxrxr ny1ameelfvs (fa2umum oo1alt iiciadfm raums u)areoxf3oatfat ai s;s) rtoirpno4ol elicsl( aDrrumpno1tlto oetatla2um( p;t0 rtoifciatoaDe neo t) 2umio3no4ame lnvils)aDtaxr ot1tet  i3ild aDrmu pnt0 lerioctydfp r ies s0srxrim3nodlm  lieiat artmxrpnt0tptniiciat mDranvp;t0trerio tytop e ivs t) 2toim nydol  lfcslt)aDumxmoot1tet ii3iadfa2rln onu0 ltrifciadlmDeln s s0 2uoxmpoydlle livslt aDta(mo;t1alenii3iytfmDea(vonu)trtnmfcoytlmt an o ( teurxr ny4lmee fet tfarrr(rpou1aleomfciaslm2rl(vsn(4 etrmo tydlmte i o;t) etoxr3oy4aptemicilt  rra(  nu1texo f3iytfa rm(mp t)trxomrciadfateluesls0s2trir iodlmt lfciat arraurooo0alto oeiad a2rlu s;() ltnmo3to1op e ueo s trur(r ou4lpenlnctasfsrrm( p;t1oexo oeiydlsDulu o (4 lxrmo3to1oa eaues t) 2xm(m iy1opee fcs t)aDurur nu4texomo3iytfmDul(vo;(0 eeoxo oatlmDean ol( tetr(o io4olteliei ( s2urx  no4apxomoeias aDrlnvs;t0texoif3iodomD  neo;s0 exm(o3oo4alee feilt srra( oou4alen f3tas a emnmp ()areoxociodopDeln o (0s2uoio3oy4amenlivt t)aDtmum ;t1ape  o3iaslmDrluvs;t4 rtnxf ootfatraieo ( srtoim oo4lpte icil()artax  nt4tex  ieiyd aDua( p u) rtnmrcoytfate i o;t)trum(rpoo1lmt livs t)a2tauroou4opt  i3iatfm umuvo;(4tlxnmocto1lpDrln sls trtm(m3oo1lm emnct tfaDtaumont4aexomfetys a eln o u4teenioctadlpD  ivils) rtmxopiy4alt mivta(f 2tmx o;o1openifeiatfa uln p;(4tltnmo3ty1faDr nes;t)t2um(o ou1lm n fet s)srtaumo;u4olx  f3tat s emn o;u)teenir oo1op   nvils)trxm(rpny1al n fciat)sDtmumo;t1ope ifciydfs em(vont0alenmfctydlaDrauvo t0 2uoxrpno4ale  net t sDrr( onu1oetoioetyd m2ul(mpn(4trxniocoodlaDelneo t s2umxo nu1omteliet s)a2trum ot1apenmfciltfa rluvpn()tlxoifcoytomDrluvil()trxmiopnu4omtemiesl()aDra( o;t4tex if3tasfs2ua(mo;u4tetnmo iy1opDrlu i;()sruoxm3oudomeemieiasfsrrr( p;t4optnmfciysfs2umuvsnt4alxoxf ta1la eliei;(0s2urio3ny4lptemiviat  2taum ;t1olxoifciyt m ulump;t)trenif iotfmD  uvsl() rxo(r nodaptnlfvta( sDtax oou0tetnmi3iydls eln o;(0tltrxo iytfpDran i;()s2xm(mpiy1lptnmfvi t)a2ur(mo;u0tee  i3tlslm eauvpnu) exnio3oadfpDe ueo t0t2xo(r ou1al n nvi () 2rrx pot4oltnmfciydla eauvpn(4 rxnmo3oydlpDr nei s)texr(r3no4ope lfcias arurumonu4tet  fetydlm2uan p u)teenmocoadomtelivi;s) 2xrio nu4ame mfesls)arrau  oo4opt moctysla2ua(ms t) rtnif3ia1fmte uvs (0s2ur(opoy4ame micil(farrmx pnu1aptomi3iat a rlu o t)trenxr iadlpt auei ()seumxo oo4op elfct s  rrmxmpot1aet mf3tadfm uln s;t4alxnxfciatfmDr ies s0 euo(rpny4al n iei s  Dtrumpnt1ale mo3tldfm em( s t0tltnxf3tatlm   n i;s s2urxm oy1olee nesatfaDtaurp;t1opx moeiadfmDum( o (4 exrxrcoadlmt aieil(  2um(r3io1lmee fviat)sDrrxm nt0tptnmo3tadfmDrm(vont4altomo iotom   i slt0s2xmxo nu4lp elncs (faDra( oot4altnmfeiad s2em( o;t4aetomr3ta1optr ivol(0t2uoimpnu1olte neta()s2rmx  nt0tltomoeiydfs uanmp;()treoio3iatom e uei t)seuoir3ny4optnmfcs t  Drm(moot1tleomieildlaDuauvp;u4arerirciydfaDr ues;( seto(opiu4om nmfei (f 2urxm oo1tpt  feiytlm ea(mo;t)aexrmf oo1lmtr ies t setrir ou1alt lnet () Draxrpnu0tpe  f3ils sDrmnvon() etnxf3tytfa rli slt) rtrimpou1am nlnvilt)s2tmu p;u1aetnmi3tysfa2uan ont0trtrio to1om rai i ()s2ur(o oo1amt  ivilt)arumxmpoo1alx  ociydfsDrm(ms t4artrmo3totlaD luvs;t) rtoxrpoudapen fetat) 2rmx oot0apxnio3iys sDum( on(4artomo3totoptr uvo;t0texmir3ny1apt lieilsf ruaumo;t1apeoio3iltfaDuauvon(4artomfcoo1lm ran ils  rurxo ny4amt lfviat a2rmuroou1tlenmf3tltfmDrmu ont4 lerxr3todla   u s;s0setoxrpoydam  mneia()sruru oou1tee mfciltfsDuaumo u)tlxrif3oadlp  livs t0t2xoirpiy4aptnlicia()aDrr( pnt1olto ietls s2ea( p (4 ltoir tadlm ranvo (0 2toxmpiy4olt lieiltfsDumxrpno4olxomieiadfs ulu p;t) exnmr3iatlp eau olt)s2toirpny1olenlnvi t arta(  nu0tpt mfeildfs el( o t4 leomocoa1fmDr nesl(0trxm(r3oy1ameelfcsls) 2rru pno4tpxniieiatfmDrl(mp;t)trxomrciytlmD  n o ( trurxm nydll  mivta( a2umum ot1tpx mfciatfmDea( p;t4 exrif3iadfm  li i s s2xo(o nydomen nvsatf Dtr(mono4oex moeildfa2rln sn(4trxoxf io1faDelu ilt)seuoim3ny4lle lnetas) Drr(r ;t0aleoif3tlsla2emump t) etoxfcoa1omDeau ols0 eumxo3io1amte fet () 2trum ot4olx ifeiyt s rmnmonu4tlxrif iydfp elnvo;s0trxrxopoo4ameemfvtl(f 2tmuroou1openmocilt aDran p t4teeoifcia1omt ai il(0s2xmxrpiodome miei t srtmxrp;t1olxnio3ilt a2emuvp;() lerxocia1lp  auvo s  exmxrpiy1lme  fetat) 2taxmp;o1texnioetldfa2rlnmsnt)tleoxfcoytla  an o;t  2xrio3oydalenmics (fsrua(  ot0apxn ocilt m2uau o;u0trenmrcootlm  lu s;(0t2xrxr io1lme lfvs sfa2taurpoo4alxnif3tyt mDemn s;u)altnmfciytomtranvo;t0 euo(o ny1lptn ieiasf 2tm(rp;o4ale ii3iatlmDelnvpn(4 rtrxo iodla e ueols0t2xoim iy4am nlfeil( a2urum ;o0oetnmieiat s2uauvo u0tleomr oatlpDelu o;(0t2umio3iydlp e nvsl()arur(ro;t4oeto ociyt s2rmu on(4 eenmo iy1oateluei s0srtm(r3iodlmtnliciatf rumx ooo4olt if3iydla el(vo;t) eeoio io1lmtelies;t0seumio iodlm n ici ()arum(ro;u0aet  ociytfsDemnvo (4 rxnmr3tatlmtrlu il( srxrxmpnudoleeliviatfs2rr(mo;o4oet mi3iltfs2el( ont) reoiocio1lmtelivs;t0trurxm ou1ole micsls)arrmxrpoo4oltniietlslm2umn o;u) ltnxfcoo1omt  ieilt0 etrirpnu4am   fcia(  2ua(root0apt moctldls emuvp;(0 etoio3iodfp r n o;s0t2ur(rpny4olenmivt s)a2tauront4tpx mo3tyt a2uluvo t)tltnio3oatoa e i s;()t2uoxm3ou1om nlneslt srtmxm nt4teenmietas aDum( s ()teenmrcoytomDe nvo t)sruo(r iu1opt lncia()sDta(rpnu1texnmoeiasfmDraumpnu4alerxo3oatopte n o s texmxm3iy1lme  nviat)s2rax  ;o1tpen f3iytlaDrau s t0alxoxf iydfmD  nvi ()teur(mpio1lptnlfvsas) rtr( o;u1open oetysfa2eluvp ()artrir3tatlaD  nvo (0 2umxopno4op nlnct t s2tau  no4tpenmo3tlsfmDrlu snu)aexrxrciytlp   n s ( srxoirpoodale lnvi (fa2urur ;t0open i3iadls uauvs u0aeermfciodlat lnvils0s2tmxo3iydlmt lfcia(f rum( p;u0tpe  i3ilsla eanmp;(4trtomrctytfmtr uvslt)s2xrim oo1opt mncslt  Dtr( oot4tpx  i3tatfa ranvon()alxnxr3ia1lmDran s;s) 2uo(o3no1lp nlicia()aDuaxr ot1opxoif3ias sDra(vsn(0 exoio iatop rli o;( seto(opoodoltnmncs ()a2ua(r ou1aptomictltfs2umnmont) leoir oydfa   nei;s0trxrxm3nudapeemivsls)aDrr(r no0tetoiocilsfaDem(mp t)arenio3tytlat anes;t)srxo(r3oy1om  mies s) rtmu ono1tlxn ieiys a2rm(vp (4texrio oo1lmDraivil()t2umio nu1lle mncsls) 2trurpou0opxn ictysla elumsnt)aexnmo ootopDraieols0tetm(r3nu1lpe lfvs ()aDta(  nt4teeo f3ils m rl( p t0 reoir3iotoa   u i;(  2um(o ny1ameemfcils arur( o;t4ole  i3ilsfs2eluvon(0tltoio3iatomt auei;s) rxmim iu4ap e iesl()s2tr(mpoo1ole  o3tld aDemn o;u)tlenif iy1omDr ueo s)seumxr io4lm nmnct tf 2tm(  oo1ope  o3iyt m2rlumpn()altnif io1fpDr ieo (0 euoxr nudol nmfeiltfs2urumoot0optnifctltfa umuvont0trxomo3ia1fmt  u sl(  rtr(rpiydlle licsa(  rta(rooo0ale  oeiatfs rlums ()teenir oatopD livi t0s2umxopio1aleemict (  Dtru o;t0tlt  ictysfa ua(vo t4alxnio3tatfat ln i s0 2umio3io4ap  livi ()sDta(  ot1ape mi3tatlsDuau snt0alxoxo oy1omDeauvi t)t2xoxo3nu1llenlfetas sDtr( o;o0opt micils mDrm(mp;t)aexomoctatopteluvi;t0trxoimpnu1am   feiat  rtmumonu0ope if3iasfa rmnmpnu4trxomfcoo1om   n o s  2toxm oo4open ieils)srurxrpno1tpxn iciytfa2ua(vp;u) lxrioctadfm rluvs;s)srtrxr3iu1apen fes ( aDra( pou0tlt  ietlsfs rlnmo u0trxnmf ia1lpte ues t0sexoxo iu4am nliesat  2tr(mpoo0texnif3iys m rlnmsnu0 rxrmf3todop elu o s trtmiopnu4apeelivi (f 2rr(mpou1tpto f3tyd m rm( p (0 eenxo3ootlp  aivo;s t2toxm3iu1om emfes (farrrum nu0oee mo3iydlmDrlu on(4aeerif oytoa  aivs;s0trtm(o nydom  lncsltfsDrau  nt4opxo fctatfmDem(vo;u4artomocoa1fm  anvilt  2xm(o nu4omt mfeil()srtmumpoo0apx iieiyslm2emn p;u) etrmf3tydfpt anei t0trtoxo nudolen fvt t)sDur(  ou1apxo fciaslsDraumo t4texnio3tadlpteluvi s0t2trimpoudamen ictasf Dtmxm ou1ole mociysfa2rluvsn() rermo ootfaD luvi;()teurxo nydllee ietl( a2ta( onu4tlx mfcilsla2rl(vp u)tleoircoy1optrai o;t t2xo(r nodapt lfvi t artmxmo;t4oetnio3iltfsDeanvp;(4arerir ootfm eai i t) eumxo iu4amtelnesa(f rrmxmoot1tex  o3iysls2ua(vo;() etoir tatlaDrli ils  etrxr3oodolen iesa()sDrmum ;t1altn o3ild aDrlnvs (4aeeoxf ty1oa r u i;(0s2umxmpnydlltnmncilt sDrmu  ou4tpeo feiyd a rmuvp;t4 lxrif oadlm rln ils  rto(mpio4op nmfct (fa2ta(mpoo0apxomociadlaDea( ont0altrif iadlpDranvsl()trxo(m ny4omenmfctasfa2rmxmo;t0texn i3iaslmDeln s u0alermo iy1lpt  ues t)tetoxr oudomtemfviltf 2rmxmpnu1tetn ietas aDrln onu)aexoxoctodopt lu o;t0trtoio3iy1ll   fctat  Dua( oot0aleomfeiad s eaumon()alxrxrcoa1fate nei;t) eumir iudalenmiesl()sDrrx oou0tpeo ociydlsDrlumsnt0tleoxf3ia1fmteluvs t0trur(m ou1ole  neias  2tmu oou0apxnifetadlsDelnmont0texnxf oatfa   uvi;t)sexmxm oydolt  ncs ( sDumxmo;u0tptn ieiydlm emu s;(4artnmf3iydfa e ueols0t2trim nu4openmnvs t)srrmu  ;u1ope  oetys a2el( s t4treoir3oydlmte ueslt  etmio ou4lle micils)arrrumont1olt iieiyd s elu on()tlxrxf3io1fmDeanes ( srxo(r3iy4ape miesltfa2uaum ;u0tpe mi3tlslm2elums u0 reoir oytlm rli slt t2xoxm oy1oltnlictl(f rtr(mp;u0tlt  ietyt sDemn p;t0artnxfcto1omteauvi;( sexmxr3nydapt lfcs tfa2ua(mpno4apto fciltla eau p;()tetnifcoydom rlies s s2xriopnu4olt mnvsa(  rra(rpoo4tltn iciad m2raumo t4arxnifcoo1lp   uesls seuoir3nu1lpe lnvt (faDtmxmp;u0apxomf3iad m2umn s u4 lxoxf tytomtr i i;( sexm(m no4am  mfcsat) Dra(r oo4tpxoioeilt s2em(vo (4 eeomo3iytlaDr i o ( trumirpnudalt  nvs ( aDrau o;o1apxn ieiadfsDuluvpnt) rxrxr oodfp eliesls0truoxm iudopeemiesat)srrrxmo;t1teen i3iatfmDranmon()tetrifciydfm elu s;(0srxm(r3nu1ale  ictls)s2rrxmoou4aeto feiytfs rlnvp t)tlenxf3oadop  aieo ( tetoim io4amtnmnctas)sDtmurp;u1ole  fetys s umuvs;t4artrifcia1opDeli i;()trtrim no1apee fvtat)aDrr(m ;t0oleniictlt mDemuvpn(0 lxnio3iotoatr i s;s)s2uoxrpoydalen fvt ()srra(m nu1olxnioctaslmDrlu p u4 ltnioctodom elivi;s texoimpnodope  fvia(fsDtm(  nt1opt  oeildlaDeaumsnt4texoxr3oytfaDranei;s)s2umimpno4ol e nvtas aruaxmpot0ole  f3ilsfaDelnms t)altoif3tydla rlnvi s  rtrxopiy4amt  ieil()a2ra(m ot4tex ii3iys aDulnmo;u)teeomocootfatran i;s0s2tm(r ny1al nmfctat aDrrumpnt0apx mociytlaDemuvp () lerxo3iodlp r i o s) 2urir iodol  lnctasfs2uax pou0tptnmoctadlaDel( o u4trtomr3ootfat luvs s0t2xr(r3nu4omeelfci s) Draump;u1open i3ilsls2rlnmpn(4trxoir ootlpD luvo;s teto(r3oydom n nesatfaDraum ;t1oexnifcias m2uauvp ()alerxfciotoa raies;()s2urxm ny1llt  ncsls srtaumpnu0olxomi3tadlm2ua( snu4arenirctotfaDe n ols t2toxopiodomtemfct sfs2raxmpot1oeenifcias m eau s t4tlxomo3oatlat li o s  exmxr oy4ol elfcslsfarrru oot4tex iocilslm2raumpn(0aexoio3ty1lptr nvolt)sexoir3oo4lmt  fesat)srtau  ;o4tee ii3tatfm2emumsnt) eerir3to1oaDelneilt) etrio no1omeelivsat  Dtmxrpou1oleomoeiysfmDemnvon(0trxnxf3tatlmD  i ils  2xrirpou4olte nvias)arraumoou4oee  i3ils m2em(vp (0aleoxf3to1lm   uvi;t  rtr(o3oo4amtn fct (faruax pot4alxnmo3iatla rlu p () etrir3iytlmt aivi t0s2trxm oodlmte icsat  Dta(mpnu1olx  i3tydlsDem(vp t4trtnmocoytopt  neo ( sexoiopoo4lm  mfvsl()s2rm( p;u4opxniietldfaDea( p;(4tetoxf3iy1optean i t  etrxr3ou1oleelfcsls) 2rrx o;u4tptn fetydls emuvpn(0 lerxocoadlat lneols)t2um(o3no1omtn nei s)s2rr(rp;t0aexoioeiyt s ea(vp (0alenxociadla elivi t sexrirpiy1olte nctls a2rau p;u1aee mf3iltlmDran snt0 exrio todop ean ol( srtrim3io4lm e nes ()artr(  oo0olt  o3iyt sDua(vo t0aexoxo to1lpDr ueolt0t2tm(r3iy4ameelfviat) rrrump;u1apt mi3iydla rm(mp;u) ltrif3oodlm raneo s)t2toxm3iu1apt  nviasfsrtmxm oo4apeomieiltfsDrl( o;u)tlxomo3totlaDrlu s s s2xr(r nydomtn ncsas) 2tmxr ;u4alxomoeils s uluvs;()tltnir3todfpDe ues;s0 2tm(o3nu1lpeelfeia()sDtaxm ot1tptoiociasfs ran p;(4 etrmf3iodfatr n s;t0trtrxmpno4amt lnetlt artmxrpou1tpe iicildlmDranmsn(4teenxo3iotom eau s s0 2tmxm3oy4alt lnvsls  Dtrumpnu4tlen i3iytfmDrmumsnt0texoifcty1lp  anes;(  2xr(m oo1ol  lfeiasfaDur(r ;o1oex  f3iad aDrln pnt4 rtrmr3ty1oat lu ols  rtm(opno4amenmnctltf rua(m ou4aexo oetys m2uluvo;t4arxoxrcoo1lmtelieilt0trto(r3no1lpeelicsatf Draum ;o4opt moeiatlm uan s (4aexoxfctadfmtr ieo t0trxoirpnu4aptn iesatf Dur(mpnt1aptomf3iadfmDumu p u4aetnif3oodomteli sls0s2xr(r ny4aptnmictat arrmumpno1tle mictat a ra( pn(4 ltoxrciytla elueil(0s2xm(m io1apeelnct s) 2rrxmp;o1olenmiciyd a rm(mp t0 lxrxo iotlm eln slt0seum(o iu4ll  livsat)sDuau  oo1apeomo3iysls eluvs;()tlxomo3iatlp r nvs;(0tetmxmpoodole mnctl(f rtmu  ;u0olx mi3iasfa emu p u0 exrmf3ty1fpD  ies (  2xoxo io1ol  mivt sf ruau  ;u4oltomi3tyt s rl(vo;u4tlxoio oy1lmtelivi s  2xmir oodoltemfct ()artmx o;t4olto f3iltls2emu p;() reoif3iy1omDelivi s setr(opiudamtn fvs (  2ta(ronu4oexo ocils m eaums ()artnxr3tydom rli i s seurxr3oodapenmnvia(fsDtr( ont1alx  i3tltla rau onu4trenxrcoatomD aivsls0t2uo(r3oydope mnvt (f rrr(  ;u1apxnif3iatfsDrl( on(0alxoir3ta1fpDrau s t)texrirpoudam elicia(faDum(mp;o1tptomfciydla2em( s u)texrmr oy1lp elivolt0t2uo(r io1lp  mfciasfsrum(rpoo0tetnio3tasla ra( pnt)tleoio tatfaDrlivo;t s2tm(mpio1opt livtl()s2urxmpou0opt ifcias s2ean p;u)alerir3iatfa  lies t0teurir ou1apenmnetl( srtr(rono0olx if3ildfs2umn snu0aexoxoctydomtrlues s)trtrxm iy4open fci t) rraxr ;o1tleoiociadls rm( o t4 rermfctydlpDe ivo;s0trumio3nu1lp n fcslt aDrmur no1tptn iciytlaDrmnvp (4treomf3io1fptelneolt trxrir3io4lmte fvsl(f Dtr( oou4oetn oeiltla rl( s;u0aeermf3oatfmtrai il( trtoirpiydoltnmicilt)sDumu ooo4tpt iieiydfs ra(vpn(4 rerif oodfm rlnes t0srtm(o3nu1olee feias  rum(  ;t0apen f3ias s rlu snu4alerxoctydlat  ivils) rto(mpoydal  mfcils)sruauro;t4tpen iciydfs2umnvont0aetrmr3ta1oa  aies;s)teuoiopou4ap emictas) 2rmx  ;o0apt mo3tytlsDrlu p;u)alxrmr oatlatr n o;t0s2tmir oydomeemivsatfsruauroou0tetn f3iys s eauvont)teenif iytom elueilt0s2xmio nu4ope lnvi tf Dua(ronu4tpe mfcilt s2rau snu)altrxfcoy1lmtrauvsls)teuriopio4ope  ics (  rtmu o;o4tet io3ildfm elu s u0 lxrxf ta1om  aueilt0teuoxr3nu4amt mnvt s srtaxrpou0oexnmfcilsfm2elu on(4aetnmociy1lmt  uvi s)t2xm(o3iy1lleelnvil(f 2trum ou4tlx mi3iys aDrl( on() exoir oydfm rauvo;() 2uo(m nydoptn nesl(  Draum ;t1ope iietytfm2rmn p;u) lerir iytfate ivols  rto(opnu1lpenlncils)aDrrumpot4tltoifeiys a2umnms t0 lxoxo iy1fmt aieslt trxrxo ny4lmtnmici sf Dururpnu1oet miciaslm2ra( s;()trenmr3ootfaD auei ( srtrirpny1lmenlfvsas) ruau pou0oltnii3tls mDuln o;t0alenxfciatfpDrlnvils0srum(o3iy1llenlfvils)a2raurooo0tlxomfetldfs eln pnt0 rtomr3oy1la e u sls trtmir3iu4olte fvsl()aDtr( onu0tpxomo3iyd aDua( snt)areomfcoy1oaDran o s0setoim3oodame  fvt ( srraumono4opeoioetytlm elumo;u) lxoir tydlpDr ueo;t seum(m3no1ol  micta(fsrrmx p;t1apeoif3ilt s2ul( p;u)aexoxfcta1laD  ueo s  2xo(r oo1lpe  fvsltfs2tmxmo;o1tex mi3tatlaDrl(monu4tetoir3totfpD lneil(0t2urir3ou1omenmncsas)srua(  ;u4tle moetadls rmuvs ()aexomr to1la   u il()s2toxopoudlle mnvs tf rur(rp;t4aleoii3tldfsDea(vs;(4artomfctadla   ueo ( srxoir nodam e icils a2tau p;o4tleomfeilt aDuan s t0trxrmo ty1laDrln s;( texriopnu1om elnetlt) rum( o;t4olxnifciat sDemn o (4tleomo3oy1op eaues;s0s2uoio oudlme mnesls aDtrurpnt0oexnii3ild m ran s;(4 eenircia1laD  u o () euoxr3iodoptnlivt ()s2ra( poo1aet ifeiasfa rmn o u4 ltoxfcio1op  aies;(0trxmio3iy4openlneilt sDtmu  nt1tpe  ieilsfm2em(vsnu0 etnifcto1fptr i i;t) rxoxo3ny4llee icsa( a2tmu o;u0optnmictys s rmnmo;(0 ltnxr tytfatr nvs;s)trxoim3oydll emncia(fa2ur(roou4tpe iocilt mDuaumon()areoiociadfmt  uvi;t0 2toim3oo1lpeelieiatfaDrmumont1aexniieiysls2emnmsnu0trtrxf oadla elnei t t2ur(r3nodol nmfcil(fsDra(rpno4tetomfeiadlm2emnvo;u) lenmf tytopDr i o;s srtoxr3oo4alt mfctas) 2rm(mpou4opxniociysla2rm( p;u)tlxrxo iadla eaivo;(0s2xr(mpny1lm nmnvi (f Dtr( oot4aetnmoeiatlmDeauvo (0 lxnmf oy1oaDelies;()seuoir3io4amtemnctasfs2rmxmp;t0oeeomfetlsla2eau s;(4treoif3oodlpDe ueo t) 2um(o iu4ameelfet ( arrrurpoo1oeeomi3tasfa uluvsn(4 lenir ootfmD anes (0srum(rpoy4amtnlfvilt a2taxmp;u0tlt mf3iatlm2ua(ms (0trerir to1lm rau i t0setmxr3nu4lp elnvs s)sDtr( o;o0opt iictltfaDrl(vp u4aleoxr3oodom elues;s truo(m3oodap nmicsat  2raum nt4tle ii3iytlsDrl(vs;(4trerifcia1lm e uei () 2xmxrpny4lltnmfeia( srrm( p;u0apx mociys sDeanvs;t4aeeriocoo1laDelivsls  etrirpiy1op  micslsf rumu pou1olx moetytfs rlnvp;() exnxrctadomDeanvs;s)setoxr ou4oltnmnvtl(fsDrr( pno4tpx mictadfm2emuvp;()aetrmr3oydfpDr ivo;s)s2um(m iudal  lfcsls sruax  ;t4alen fciyd a2uluvonu0tlxnxr3ia1lp ean ols0s2uoxr3oo4alte ies (  Drmum nu4apx  iciydfsDulumsnu) ltomo3ia1fp  anvilt)teuoimpiodllt mietl(fsDrauro;t4aptnmf3tys m rm( o;()trxnir ia1oatelies t0 rur(rpio4ap n fcsat) Durxr nt4tlxomo3iasfm2eanmp;(0 lxomfcio1fpDr nvo s) 2umxmpiy4lle mnet ()aDrau  ;t1aet  i3iatlmDemnmo (0teeoirciotlpDelu ols texm(m iy4om eliesas)srra(  oo1aleomo3ilt a umnmp;u)texnxf3tydfmte ivo;s trxo(m3no1lpe lfvs s)s2rr(m no0aetoiieiatla ulnmont)tetrir3iy1fmtelnvolt)tetrio iudape  iet sfsrur(ro;u1opx  oeiyt aDranvsnt0texnmr tytop  aieol( trxrxo3iy4am  mnctltf 2ua(rp;o1tlxo fciltlm2ul( o (0 etrxocoodopDrlues;( s2toir3iydapte iet ()sDururpnt0oeen ictysfs rl(vpn()tlerio3iatoptrlu ols  rxmim ny4apte netls s2ur(mo;u1opxniociadfmDuluvont4trtnif iydop e ueo;s setr(rpiodome mieia( srrau p;o0tpxomicils s2eau pn() lxrmf3oodlm  livils srtmxo3ny4lpt micilt)arrmxmpot0tpe  oeiatlm ea(mo;t0arxomf oydlmDeau i;t)teum(o iu4al   net sf rtr(  nu1tltomietatfm2ranmpnu)artnif oydopDr n sl(0sexm(rpoo1al nmfeilt  rtmumont1tetnmfciyt m rm(vp u)tlxoxrciodfpt ln s s texoxrpio4ap nlnvtasfarra(mono0opx if3ild m umuvs u4tltnmf oatom rauvsl(0 rumio nodlpeelnvsatfaDtmur ot1tpe  i3tadfs emuvo t0 eenmfciotlatrlueils)s2xrxo nu4ap n fesa(  Draxmp;t4tpto icilsfa2ua( pnu4arxrmo3iodlpteanei;t0texm(o3no1ope mfvi tfsDta(r oo4texo ocilsfm2rauvs u)trxrxo tydfpt ai ilt0teur(r3oy1alenlneilt aDuaur nt4tlenio3ils m ul( p u0alxnmf3totfatelu o;s  etoimpnodaptelnvt s  rra( p;t1tptnmi3tysfm2rlnms;u0trtoif3iatoaDrluei ()srtmim no4al  liet ()aDtrurp;o1tpxo f3ias sDul( pn(4 lerir3oydfa   u i;() 2ur(m oodap  mfesa( sruaxm nt4olx  o3iadlmDeaumsnt0 rerif3todfpDraivi;(0 rxrxm oudam emfcs s arrrx p;u0tpx mf3tas sDuanvon()artrmf oytopte n ils srtmxo oodale mfesat aDua(  ;u0tlt ioeildlsDemu sn() etnmo iadfa  an il(  2triopoy4alt mnetasfsDumxmooo4alxnii3ild sDum( s;t) lerxo3tydopDe ies;t sexmxo3ny1ap nmfvsl(  2tmuronu1opt ioeilslm rm(vo t4 rtoxo totlpDrln o;s0 rtrimpou4ome lnes ( a2ra(roou4aetoii3iasfs2ua( pnu4tlermo iotfptran i;(  rto(opny1op elfei s  Dra(m ou1olto ictld m ul(vs t0aexrmo ty1lm rlivol( srxo(mpny1olenlnvt t)s2rm(roou4aleomf3iat aDeaums () rxrxrciotfmt au i t  eumxm oydlmenmfcsl()arrm( p;u1tee iicilslm um(vp (0 reomf3oa1oa rau o;t)teuo(m io4am   fci sf 2tr( p;t0oleomoetas mDua(mpn(4 leoxf3todfatraues;s0setrxrpnudom   icil()aDtmur ;o0apx mf3tlsfa2rlu o u)tltoxf3oa1om e n s;(0 rtoim iudlm nmnvsltfsruax pot1tetomf3ilsls um(vs;u) rerir to1lp ranvi t)srtoxr3iu4oltelfeia()aDraxrpnt1apeoiicild mDel( s (0 lxnmociydomDe nvs ()truo(r ny4omeemici (farrmum ;u4opt if3tltfaDrm(vp t0 lenmf3oo1la eai i;(  2xrirpiudlleemnvia(  Durxrono4opx mi3iadla2ea(vp;t)tltomrciodlmD lneo t trumiopnudlm nmfvsl() rurur ot1tlxnifetltla2eln p;(0aetnmf ootlpteau s;t) 2um(o3nu4lm   ictltf 2taxronu1oet mfciydfm emn o;(4arerxf tatlat  n ols  2tmxm nydalenmfeils)aDumx o;o4alxo fctydfm2em( onu) lxrxf3tydlpte nei;t0t2trxr iydopen fctlt)aDrr(m nt0ale ifeilslm rlnms;t0 rxoxocoa1fm r u s s)tetoxr iydlme lnci sfarra(monu4aptn o3iyd aDrmn pnu)aleomo3totfmD an o;s0 2xoio iodope lncsa( aDtru p;u4tpt mf3tat aDrmuvp (0 renxr iytfp raiei (0t2xo(mpoy1ape  fctlsfaDumxmonu1tlx mieiyd a2ea(mo;t0 rerxf iytopDrau i t)tetm(mpio4am n fei () ruaumoot1alxnmo3iltlaDrm(vs t0 rtrmfctotoaD ai sls setmirpny4olee nct t a2rauroou1aeeomfctldla2rmums t0alerxr3oadlmteau olt  etoimpiydllen nvia( s2ua(ro;t0tpxoiieiadfm2rmuvpnu4 eenio3oydfmDeli i ()srtmir3iu4ope mivilsfa2rr(mpnt4aex mo3iatfsDuauvp;u)trxnxrcoatoaDeaueo;s0trtrim nodamenlnesl() 2tm(  ot4olenmicildls2rl(mo;(4trenio3tydfa r n olt s2xr(r iu4ll  mnvsl(fa2ur(rooo0apeomf3ilsfaDulnvs;()teeomo3iy1faDeau s;( tetrxrpiy1open icia()a2trum nt4opxoifeiltfs2ea(mp (0 eenirctadomteauvo t t2xoxrpoo1omtnlfcs t) rrrumpot4oetoii3tyt mDelumo (4tetrxrcootlptrlieilt0s2tmxr3nydal  lfviat s2uru  no0olx  o3tysfs2ran s;u)aexrmr tydoatrluei;()s2tmxr3oydoptelicils aDururpou1tlxoiieiltfmDeau snt4trenifcoo1fmtr nvsls)seuo(r oo1apt mietlt)srtaum ot4openmfcildfmDeaump t4 renxo iotfa eau ol(  rtoio3ny4ll   fcslt arua(  ou1tpeoiieils a2eanvpnu)trermf3iatfa r ueo (0 ruo(r ou4lle lfvi t s2umur ;o4altoio3iadfmDra( pnt) etrmf to1fmteaivils s2tmxo3no1ape mietas  Duax  ;t1olxnmoetatfm el( s;u)artomr ty1op rln ol(0sruo(m3oydlltn nct s  Dta(mo;u0aetomoetyslaDum(vs;u) exoxrcio1fmDr ueo ()seurirpiu1omt lnctas)aDta(  oo1aetnmieiaslm uauvpn(4 rtrif iotfmDe nvo s) exoxo nu1amtnmivsas aDtrxr nt0ole  i3tasla rauvp t4tltoxfciodoa r uvolt)srtmxm oodlmen ietas) 2ta( p;o1aetn i3iltfm2rm(monu)tetnxocootlmDean s;(0 rxr(opno4ome  fviat)sruax oot0ape  o3tadlm2el(mont0tlermf3ty1opD aivi s sexr(o nu4lptemfvilt)s2umurpou0apx  i3iltfa elump;t0 eerio3oa1op rlu il()srto(o3oydomt lnetas s2tm(  ;u4alt  feiasfaDuan snt0 rxrxfcio1optrlivsl( seuoxm3oy1lp emivils  Dtaumo;u1tpeo ietydfs2rm(ms;t0artnif3iy1laDe ieol(0sruo(rpoo4om   fvi sfsDtmx  ;o4tle mi3tatfmDul(vo;u)trxnmf ty1op elu ils0 euo(m3nudolt mfvtat) Dra(mpot4aexoifctasfs2emuvsn(0tltrxr3iytfa r i i;s sexr(mpou4am   nvsl()sDrru o;u4apxomf3tasla elnvp;t4arxoxo iodlm rauvil()trtoio ou4om   fcs tfarurx  nu1oeenmo3ilt m2um( o;(4tltrif to1fatr ivi s)sexoxmpoo1apeeliei tfa2umump;u0tpxomieiatfaDulnmo;u4texoir3tydlpDelivs t) 2umxr io1al nlfeil( aruaump;u1aexo oeilt s2eauvpnu) eeoxr iotlmt ln s;t0 eto(rpno4om elfvias aDur(r no0tlt moeiyd a2uan sn()tetomf ty1oateai o t)srur(opiu4omeemnvsat)s2trumpno0oexnii3iysfs umumonu0trxomociodlp rluesl(0 2urim3iy1oltelncta() 2urumo;t0tpxo o3iaslmDel( s (0aeerxrctotlaD lu i t trumim iy1ap   fvtas) rtaxmo;o1optn f3tasls rln ont4trxoiocoodoaDraies s  rxmxopiodop nlfetls)s2umxm no1aptnmieiyt s2rl(ms;u4altoirciotfpt lnvo t teumxr oy1lltn fcil(f rtrumo;o0tlx  feild sDulnmo;() etomr tadopD livsl( t2xrio ou1lm  lictlsfsrur(  ;t1tlenioeiyd s um( o u)texnmf3oy1lmtrluei (0teurxrpny1ap  lies s) 2rr(moou0opt  ociytfsDuluvs () ltoxo ootlptrln s;()setmxr3oy4aptelieia( arta(mp;t0tetoio3iyslm2elu s;u4arxnmo3oo1fmDr n i t)teumirpno4ol  mncs t  2rmu ont1ope  fetlt sDrlu p;()trxnmr ta1oat luvols  rurxr io4lmt micilt aDrmu pno1apt  ociys aDrmuvsnu4trxrir3ia1faDeln olt0s2toxm3oo1op nlfesl(  rra(ro;o4tlt  fciaslsDeaumo t0teermo iatlmt  nei;( texrim3nudaltnlneils a2ta(r ou0oexn i3tldlmDuauvs;(4teeoiocoydlatrluvo t0teumxo3io1omenlics (faruax  no1ope ii3iysfs rmnvpnt0tltoxfcia1oaDeaiei;s) 2tr(opou4apt lictlt) 2ra(r ;o1olt  ieild s rlnvs;t0trtnmo3iytfmDr u s;s teur(r nodlpt lnetasfsrum(  ;u1tpx miciytfaDumu ont4tleomo ia1fa rlneolt s2to(rpio4omeelietat  2taxrpnu0opt micild a umn o t0alxomo io1faD ln ol(0 2uoxm ou4lm nlfeta(faDumx o;u0teenmo3tadfs2umnvpnu4trxrxo3ta1laDe uei;t) rxm(r io1lmte nvt s)a2ra(rp;o0aexo fetytfm rau s;t0aetoxoctydlm  aues;s srumxrpoodolenmfet sfsrrrxr oo0tltoiociyt a el(mo;u) ltrxrctotla eanvi;t srtmxr iudllt lfvia(f 2rrur ;u4altomi3tldfm emuvs;u0trxoxf todlaDrli s () rxr(mpio1lp e fcsls aDua(r nt4aet moeiatfsDuln p;u0 rermociatla  an i t0trxmxopoy4lptemfct () Dta(moou4olxo oetadfmDuanvp (0 lerifcoytfptr nvolt0srxmxrpiu4ale mncsltfa2urum ot0ale  ocilt a rmums;(4 lenxfcio1opt luvi t)t2ur(m3nu4olt lfvs t)sDtau  nu4optn f3iadlm2ulnvs;t0 lenxr3iydfp rlieo;s0s2toxo3oodolt mfvt (faDtrxm no1teenmieiyt s el( p;t4tltoio oytfate nvi (0trxr(o no4al elfesa()s2rmumoot4tpxoif3iyd s2emu p;t)teenxf oatlatrli ols  etoxo3oodam  mnctl( s2ur(moot4tlen ociltfsDrlnvs u) rxrxocootlmD  i i ()setrxr io1opeemnetas) rtmxrono1texoiieiat a2ulnmp u)tltniocootfatelnvils) exrim iodapeemnvsls sDtrxm no1tet io3ild m uln s t4 rtoxfcoy1opt ln slt)teurir oo4lmtnmiei () Dumxront4apt ioctyslmDul(mo;u)alxrif3oydomD lieil()t2xmim iu4llenmnvsat)s2rru  ot1apt iictysls eanmsnt4 lermoctodomtelieo s  2um(mpnu4op   neia( a2tr(rpot4olxoiieiyd m2ra(vs t4arxoio oo1optr uei s0sruoxm nu1lmtn ncsasf Duaxmono1alxnmfeiadfm uln o;(4 rxrxo3tatlpDrai i;t)srtoimpoy1lmenlfvi tfarta(moou0aleniictldfa2rmu on(4 ltomocoytop elnes t)srtrir no4opeemnes s)a2ua(r no4oleomoeiadlm2el(vs u0 rxoio3oodfmDrau i s0srxoxmpno4ll nlnci t)a2tr( pno4aptnifcils sDemuvp t0 rxrmfcootlaDean i;s0t2xmiopoo1amenliei t)aDrr(rooo1tlxniictld sDul(ms u)trxomo oodfm elneo s)tetm(r iy1om nlfctl()a2ta(  ;o4tex moeiasla rl( o t4alerir tadop eau o;s  rtmio3no4lptemivsatf Dtmxrpno0tet miciasfm emumpnt4trtoxrcoytfpt aivo s0 exr(o3oydapenlncil( a2uau pnt4tlt  ieiytla2emnmont4 leoir3totfm e n i t0 rtmir iydol elfcsl(f Draxmp;u4opt mo3ilt aDelu s u)trtrifcty1la  livo;(0trtmir oydllenlivsas)aDurxrono0tlto feilsla umump;(0teerxo iotoaDean i (0t2trxrpiu1lltelfcs ( arrrxronu0alenmiciatlmDeln o (4alxoif3ta1laDeauesl()s2xo(m iodal  lieslt)sDtaxmont1oee  o3tatfs2rlu sn() etrmoctotlp rluvols0t2urirpiydll nlfcs t) rrrum ot1aex io3ils a2uanms t4artrmo todlaDr neolt)tetr(o3oodam nlncsas) Dtaxr nu0texn f3ildfm rm( o;u4 lxoxf3iadlmtrluvi;() rurim3nu4ape  ncsa()a2tmum ;u1apxo f3ilsfa ul( s;() reoirciodlateln i;t0seum(o3ny1lmen neslsfa2urxrp;u1apenmfciltlsDeau onu0 etoircoodom  luvs s  2toxr3ny1ll  lnctat aDtax o;o4oeto ietydfsDuanvp u)artniociytlaDraueo s0 rumiopoydalte ies ()aDrrx  oo0aee ii3tlt m rmnmp;t)tlermo3iydlaDeai i (  rur(r iudllenmfvt ()aDtru ont0aetoio3ildlaDua(mp;(4aeerir3oo1fa rln ol() exr(m nu4om  lfvt (  rrrx  ou0tlenmf3tadfs el(vo;t) etrxf3iydfmte ues t)setrxopno1opeemivt ( sDtrxmoot0oltn o3iytls2uau snu0aleniocio1omte uvo (0 eumim3nu4llteliviat aDtaurono0tpe ioetatfs el(vs;u4artrif ty1fp  aieo (  euo(o3ou4lleemnvt sfa2tm(r oo0oltnmo3tysfm2ranvont0artoiocoy1oatrlieol(0s2trim3oo1omeelnetat sruru pnt0aexn f3iydlaDea(vs t4 eermr3iy1fpD lieslt0s2xr(o3oo4ol e ivi s)s2umxm ;u0oet mo3tydls eauvo;u0 rxrif ia1op  au s;()texrxm iy4alt lnct tfsrtr(r nt1tlxo f3iysfm ea( ont) rxnmo3tytoa elnvo () 2trxr ny4op e iesls)srum(mo;u1oee  oetltfs2eanvs;()texrmoctotlaDe nes;t seuoxo3nu4omee netasfa2ua(ronu4tleomiciysls umuvonu4artoxr tadfmD anvo;(0t2to(rpoo1llt  ictasfarraumonu1olenif3tytlm2elumo (0 eerxo tatla  li i (0 2tr(m3no1ameemnct ()arurx poo0aleomoetatlm rluvs (0aetrmfcoytfpDe n o ()t2tmim oodapen nviltfaDrax pou0opxnmoetltfm2um(vo;t)aexrircoydoaDe uei;t) 2ur(m ny4lptelfctatfsrum(ro;o4tetoiicilslsDrm(msnu4 lenxocia1oa  lnesl(  exr(rpou4oleemivslt arta(rp;u0tpx ii3iadfsDemnmo;t0tlenir3ootfmDeai o;(0 eurio3ou1lme  fvtltfa2rr(r ou0aleomfciadfmDeanms u)tetomr iytlp e neo s seuoxo io4lp nliesas) Dtr(rpnu1opxo iciasfsDemnmp;u0texoxf3tytfa elies;(0 ruoxrpoudopte fvtat)arua(m ;o4tetnio3ildfmDem(ms t) renir to1lmD  ueils) 2ur(opoo1amte fesas)aDtrx p;o4optomo3iad s2umnvo;(0aetoxocty1lpDranvs (0teurimpny1lmtnmfct (f 2umum nt1opt  fciadls2rln pnt)tltnmo3ty1la raueol()sexoxo3nydoptnmictas)aDumum no4tpxn feiysfsDuau p (4 rtnxf tadlptean olt0srxoio iy1olenlfct tfs2ra(moot4tltnii3ilsfmDelnmo;t4aetnxo3ty1fp rluvo t) etm(mpoodlme livtlsf rum( p;t0tee iociydfmDua(mo;(4trerif3oytlmDelu o;s0 eurxo oy4lme  icsl( artmur ot4ope  ocilsfs emuvpnu)tlxniociy1fmt anvs;(  etrxm io4llee fesas  Dta(m ;o0texo o3iydfs eanvs u) rtrmfcoadfmDraiei;( t2uo(r iu1al nlivi s)sDumxrpot1apen oeilslm2uln o u4teeoifcio1fatrlnes;t)seumirpno1ale lnesa(fsrrrumpnu0aptomfctyt m2eln p t)tlxoxr3tatoa eai olt0s2tr(opiy4al e ivsls  rraurp;t0opt iieiad a uln p (0trxnxr3oytlpDelu olt seum(mpno4lm elfci (fsruau  ;u4aptnmi3iltfs2rm(mo ()aexnmrciatfatrau ols)srtoxm iy4ll emnesasfaruaxrpnt1ale mfeilslmDumnmp u0aetnif ootoa eanei;t t2uoimpnodap nlfctls sDumur nu1ope iietad m rau p;()trtrmr io1opt  ieols  etmiopiodll  mnvtlt)arua(root4oetnmf3iat mDul( pn()aexnmr oa1oaDrlieolt) rxo(rpoo4alt mfcslt) 2rmu  ;o4olxn f3iysfm2um( p u0arenxo tatfmt  ivsls truo(m3nodll   nctlsfa2trum ;u4apeoifciatfsDeluvsnt) ltrif oy1fmtrlu il( srurxopiu1omteliet s a2uau p;u4altoiociat a2ul(vs u4 reoifciotomDeluvol() 2tm(o3nudlle mfcias  2urxrp;o0oeen fctls m uanvp;t) lxnmocoy1omDeaueo;() 2xo(o oy4lm e iet ()artmxmo;o4aeenmiciyd s umn snu4aexrif ty1fp rai ilt)trtmim3oo4omtelieilt  Dtm( pnu0tle ifciadls eanmsnu0aetnxr tytlmDeli s;()texr(o no4ap nmnvt t)arra( o;o0tee  iciyd s2ea( p;(4arerioctydlate i o ( srtrxmpny1lltnlfvil(fsDum(mpot4tlt moctltls2ra(ms t4aexrmr3oytfa eanvilt) eto(r3oo4oleeliciat)arra(mo;u0alt mo3iydfa2elumsnt)altnif ootoaDe ivo ()srxmir3oy4amtelnvilt) 2urxmo;o1oet ii3iasfa2uanms;(0 ltoxfcio1oateli i;t seurxr no1lmt mics () Dtrx pnu1oet moetad aDrm(vp;() etomf3iydlp eanvsl( srto(mpoy1lptnmnvs s)aDrauro;o0olenmoeiltlsDulumonu0texoxociadomDe n sls texr(mpnudamtemnvtl( srrmxmo;t4tltnmocildlaDran p () rerir3oatla  aneo (  etmxm3iu4lmt mivilt) 2rm( pou1olxn ictysfaDumuvp t0tlxnxf3iatlmt aivi t0setm(o no4op elfeils) Dtrum ;t4oltn fciadfmDem( on(4arxoxocio1fa r ues;t)srxoxr oy4lpeelfciatfs2ur(  ;t0oexoiiciat mDrm( s;t) eenxrciodoatran i;t  rxo(o3ou1altelici s)a2uaurp;t4alx mf3tys s ea(von(0trxoio todlmt au o;t0sexrxr3iodamtnmictl()aDraxm ou1optnmf3iydfaDemuvs;t0 lxnmfctodoa r u ils) ruoxm3nydaptn icil()aDrr(r ou0apxnmietys m ulnvo (0tetoio3ia1op rlieslt0teum(o oydlpen nci s aDuaxmpnu1opt iiciltlm2uluvo u)artrmocoatlaDrliesl(0trxrxr iodlltnlictl(fartr( oot4tex io3iyt sDelnvp u4arxnif3iotomDran slt)t2tmxmpnydlm   nvtl()aDua( p;t4oleomfcildfaDulump;u0 exoir iotfmtrluesl()seto(opiu1lptn fetat)srumum ;o1teen ociyslmDean s;u)alermo3iotomD an sl(0seuoxm3ou4ope  fci t aDrmumono4tpxoioeiad aDel(vp u)aeeoifctatfaDr i s t teur(r3nudale  fvsltfs2rrx  ot0aptn fetyd m2ra(msn(0alxnmrciydfmDe uvil( seuoim3nydome  iviasfaDur( poo4teenmi3iltfm2rmump u)teenir3iydla rlivilt)sruo(o3oo4omtemicias)s2uaxrpoo0opxoif3tas mDelumsnt0altrmo oy1lpDeli s ()srtoimpiy1ale  feias)s2umxm nu4oee mictysfs eln s (0artoiociodlpt  iei;()t2trio oy4ole lfcslt)sDrau p;t4tet io3ildfaDeanvo;t0 rxnxr3iodoaDeanvs t0 2to(rpoudamt  nvsa() 2taxm ou1optniieiadfs ulnms;u4tetrmr3oydfm r ivs;t0s2um(o nudlleelfvils  2uaumoot0alxnioeiasla2rmn s u0 rxnxo ia1fmD  ieils0t2tr(o3ou4am  mnetat aDtmxm oo4olxo oeiatlm uanvs ()altrircoytfm eai s s srtrir3nodol nlfesls)arur(ro;o4tltn ieild sDuluvpnt4aexnio iatlatelu i (0tetrio oo4lpeelieilt)sDtrum ;o4tee moctld a ulnms u0tlxomr tatfaDe iei t)setoxr oo4ol e ivtlsf rta(  oo0aee ifciysfa2ra(mp u4aexrxrcia1fmte ivi s0t2tmxmpnudale  nvtatfa2taxro;t0ale ifcilslsDea( p;(0artrxocoodfatr nvil(0trxo(r oo1lmen ictls arrau  ;o0apx iietadla ua(vp t)trerif iy1lmtran o;(0t2xm(rpny1omt  fct (f Drau o;o1tetoiociaslmDumnmpn(4 exrmo3ty1lp r n ol( trtm(o3iy1aptnlieiat aDuau ont4tle moetld a rm( s;()artrifcoy1fm r ivo s)s2umxm no1ole lfeils  2ta(mooo0opx mi3ilsfsDul( snu4 etrmf3iy1lm e ivi t  2ur(r3oodameemneia(faDurxro;t1teto ictadfa2eluvont4 ltnmf3ta1lpDr u i;t  ruoimpiy4lmtnliviatf rrmu  nt1teto oetydlaDrlnmsnu)trenir totlatrlneo;()t2um(m3ou4amt liet (fa2trum ;o1altomi3ias mDrmnvo t)artrxf tydfpD aues;s) rtrirpoo4amenliei t  2rau oot0tpxoiieiytls rluvpnt)altoif tydlpte nei s0s2tmim3ou4ol emfvi ()s2tau pnu4alxnmi3iytfsDeauvp (0arerio oytfm e u olt)t2toxrpio1lme  netlsf Duaur ;u1alxomfciltfa rmu s;t0 rerio3tytoa r u o;s0t2tmxo3no1altnmivsa(f rtax  ;t4tee ioeiltfaDrl(mo t0altnxrciadfa rauvsls0 eurxr3iy4op emnvs ( s2rrxr oo4alenio3tadlsDuanms u) eermociadfate u i;s0srtmirpiudlme  fvs t  rumx onu4oet ioeiadla2ranms;u0areniocoydfatraueo;t0t2trio3iu1lp nlnvi tfaDrmumpou4alxoifciydla2ua(vs;t)tltoif3tadfp   ivsl(0 rtmirpoodomtnliesl(fa2trum ot1tlxomf3iyt aDem(vo t)texoio totoatraivils  2trim3io4ope lfet t) rumurp;u1aexoifciys a2ra( o;t)artoxf tydfatr ivo;t0 rxoxo3oy1om   fcsl()a2umx  oo0oeen fctlslm2rlnvp;t4arenxr ia1fa r ieo ()t2um(r oy4ole  fvt tf Draxmo;u0teeo ieiasfa uluvp t0altnmf3todlmteaieol(  eumirpio1lmeelnvsatfsDtmum ou4aetniociadfa2ua( on(0trxnmo3iydfmDr nes;s)s2xmio3oo4omeemneta( arraxmp;u4aptomfctldfa uau sn(0teerxocta1la  lu il(0s2ur(r3io4om n nvtltf 2ur(mo;o1tpxomietyd m em(mpnt4 lermr3oodlp e uvs;t trxm(rpoydlmtemnvt sfs2ra(  oo1aetnmfctldlmDuan o u4trxrio3ootopDeliesls0 etoxo iy4opt lnetasf rtm(mo;o4aetnii3tas a rlnvp;(0 lxomr3tatfaD lueo;t)s2xmxr3no4amtnliei (fs2ua(r ;o0opto f3iyt a rm(vo t0 reoif tadlmtrlu s;s0 rurio3oy1amtn ies tf Dra(rp;u4olxniiciasfa2ra(mpn(0texoirciy1fmt ai i s0 rxo(r iydll   iviltf Dumum oo4apeniieiadfs umnmo;t) rtoirciytfmDeaivo (  rxrxm3no1omt  ieiat) ruaxmono1olx  f3tytfmDranmo t4 rxnxf iadla   uei;t) 2tm(m3io4aleemiciasfs2tmxmo;t0ape iiciytfsDean o t0 lxrmocoytoa rli slt0srtoxrpiu4op nlicsltf 2trumonu4aptn o3tysfa2ranms;(4aexoxf ia1fmtraiesl(0srumio3oo1lpe  nvsa()s2umxro;t4aetomoeiysfs2rln o () exnmo oadlatelnvols sruo(r io1ll e fvslt)aDum(rpnu0aexn o3tls mDemu o ()trtrmr3oodomDr i i;t0texmxr ou4ome lneilt  2tmumpot4open oeiyslm uluvp;u0aexoxr iotoatrlues;s)srxo(r no1openmivt s aDumu  ou0teeoif3tldfa ul( s;t)tlxrmr3tydlateaiei t0truoxrpoy4lltnlnvsl()s2rru p;u1altnmiciat s rmn s t0 rtomfciotfaDeauvils)srumim3oo4altnlivtls  2trxmonu4aetomociadlm eluvo u)tltnmr iydlmt li i;t  2xr(m oy1oltn feilt srtax  nu4olenmoctydfa um(vsnu)trtrmf iatlp rau slt0s2to(opoo1am  mnct t sDrau ooo0aetomoeiasfsDeln p;u0 exrmo3oo1lpDrlieo;s) exmxo3ny1lleelfesl()aDur(r ot1aeeoifeiysfm2emnvp;t4trxoxocoa1lm e nvo s srxm(rpoudale licsl(fa2trum ;o4aet  i3ildfm2elu o (0 lenif iydop eaiei;(  rto(rpnydapeemfcs s  2raxmooo4tlenio3iydfa2eaumpn() eeomrcto1oa r nei;s0sexm(rpiudaleemnvils) rrmxrpot0apenmfetysfsDrm(monu0teerifcio1lm r ieil(0tetrxm nodamenliei ( srur(r ;t1tpt  fetatfm2uanmp;u4artomo3oodlmt  iesls0 2toio iudamt  icias) ruaumooo1aexoiietadfmDrm(vo () rxrmfciatlaDeanvo t0s2urim3io1lm   nvi sf Drmxmpou0apeo fetldla ulump (4tleoirciodoptr uvi;t  2trimpnydlm  lfcsas)sDtmx pno0tpx mictltlsDeln p u)tlxnio iatopt ai sl()s2xoxm3ou1openmfeia()srumu pot4tle iociatfsDumumpn(0teenmf3tytop  an s t sexoirpou1al e nvtas  2ra(  ou4apxomoetatfs2ua(vp u) rxnxo3tytfat  ues;( srtmxm iudlmeemnvtasfa2uaxr nt4aptn oeiyd aDua(vo;t4tleoxf ia1fatelieo t  exo(m3nu1lmtemfeta(farumxro;u0aet iictas a ea( s t)texoxrctatfmteluvi s tetm(o oy4apt mfci s  rraumonu0oexoio3iltfmDrl( p;() exnifcoadomDraivi;( srxoirpnydlltelnvs s) Dtrxrpoo0ape  ociadla2rlnvpnt0arxrxfciytfa rai o s  rtrxo3nudlleelfesat)sDtmu ooo1teen fetatfs2ra( o;u)artrio3to1faD aneolt0seurxo iu4lleemfesat)arum( pot1oexomiciydfa2uanvon() lxomf3iadfpD aies t) exrimpiudlle mnvsl(fsruaxmooo4oetn oeiltla2umnmp (4alerxociytfpteanesls0teuoxmpnu1apeemfvi ()sDurxmpoo4aeen fcilt m2rmnvon() etnmr ty1fat  nei;s0trurxopny1om  miciasf Dtaurpnt4tpxoio3tlt a elnvo;u4 lenmfcoatomte n slt  exoirpoy4lpte nctas a2trur oo4aetnmfeiyt a elnvs;u0 lerir3tatomD lnes;t)s2uoim3io1apeelics t)a2ta(rpou4apeoiiciytlaDran p u4tlerircootfpt lnvol() rur(mpnu1op nmncsls)a2trxmpou0tle  ictytls el(vo;u) lxomrcia1oatranes t texrimpnu4omtnlnvta( srrrxroou1ope  fctasla ranvo u) ltrmfcoydfpt  n sls  2to(rpnydamt mnvtat sruaur ;o4teto i3ild s2emnmp;t0alermr iadlpt auei;( srur(o3nudoptnlietlt  Dtmumoou0tpxomieiaslmDea( o;t0 lxoxr3tatfmD  ies (0tetmim3nodlmee nvsas)sDum( o;u0tpxnifetydlaDem(vo ()altomo to1oa elnei;() 2uoir iu4om n ncia()sDtr(mpou4ale mo3ilt m ul(msn(4treoif oytop elivs;t0srxmio3ou1aptnlnvi t  rrmurp;o1openmfeiyt a eauvont4 rtomo ia1oa e n i;( t2um(r iy4apte fci ( aDrrum ;u1oet  o3ilslmDraump;u0 etrxo iodlateaues t)teurir3io4om elivs s)sDtmxr ;u1tlx mo3ild a umuvo (4texnmrcoadlpDeanes;() etm(rpiodlpeemies (  Drr(mono4aex ii3ilt m rl( snu) eenmf3iodfpDeli ils) 2xmxopoudopt mneta()a2raumpnu0olx  ictydlm uaumsnt)alenifcoy1fpt  ivols  euo(r3oy1opeelics () Drau ont0tlt iieiadlsDuln on(0 rxrmo iadoa  aues s0seurir nu4ol e fvsltfsrumurpou1tet ifeilt s um(vo t4altnmo tatomDrlu slt  rumim no1op nmfvs (  rta(ronu0oeenmf3iyt s2eaumo t) rtnmrciatlpDrln sl()srurxo iy1optnmietl(f Drrum ;t4oexn o3tlsls em( o;u) renxfctatfpte uei;t  exmxmpiu1olenmics (farraumoou1tetniietld s rl(vpn()teenmr3ootoatr ivi t) 2trxr3iy4lp e fcils srrrxrpot1ope  fciytfa2uaums;t4tlxrmr3ta1omDe nes ()trum(o no4llenmfvtat) Dtrurono0tetoiietldfm uluvs;(4 eerxrctatomtraivils0 2uoiopoodll   fcsl(fsDtaxronu4tet mieiaslaDrauvsnu)alxrxf3t
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;(0 2tm(rpoudaltnlncsltfsDra( oou4aeeomiciydfa rl(vo;u4tltoir3io1lmteaies t)s2ur(r ny1omee fvs t)s2ua(rp;o4aee  fciat a2um( pn(4 lermo3oytlmDe nvs t0 exrio oy4alt  fvi tfsrtm(root0ope  oetytla2rau o (4 eerir ia1lm elues (0s2uo(o3nudomt lietltf rraur no4optniietltfm em(msnu)alxnxf3tatfm eanes;s sexr(r no4amee nes s)a2ta( ono1teeomo3tyt s2ra(vs;u0tleomociatfmDranvsl()s2uoxr iy1alenmivs sfsrurxmpno4apxn iciad mDul( ont0tetoxf iodlaD  n s;s tetr(opoydlpeelnet ( aDtmum no4alxoiiciat m el(vs t4 renir3oadomDelu ols)sexo(o3iydom   icia(  Dra( onu4tpt ifciyt m2rlu s;u) reoio oodoat au ilt0s2uoxr3iu4lm   fvta( s2tmx o;o1oeeoiicils aDra(ms;()teeomo oatfpDr nvo;t t2um(o ou1lm  lfeilt)aDur(mo;u4oetniiciys m2ean o t)aeerxoctatomteluvi;t) rxriopny4oltemnvtls srta(ro;t4opxo f3tysfm ul(von(0 rxnxfcoy1lmDrau i (0 2xr(o3oo1om  lfct ()sDrrxmp;u1olxo icildlsDranmo (4aetnio3oadoatraivsl( setmxm no1ameelfeia(fs2rrx onu4apen ietls a2rmn o;t0aetoir oy1omDelnvols t2xo(mpiy4lm e fei t) 2rauro;t4apeoif3iad s2elnvpnu)trtnir3tatlp rau olt0 rxr(o io1ol n nvil(f Dururont4aet  o3iaslsDrlu p (4tlerxr iy1fpteluesls  eurim oydopee ivsas a2tmurp;u0oetoioctytfa rl(vont0arxrxo3oydfaD lnvo;(0 rtmxm3iudole  fvt s arurxrp;o4alxn feiytls2el(mo;u)aetrxo oodlaDelnvil() euoim3iodlltnlivtls)a2tmx  ;t0oetnmfcilt a2um(mpnt0 lerif iytoaD luvolt)s2to(r3nodaptemfvtlsf 2umu o;o1tlxomfeildfaDul(msnt0arxrir tytoa rli s;()teurxrpiudole liviltf Dtmxmpnt1tpeomieiasls eau pn(4treoxfctadop rln i;t s2tmir ny1lm nmnvt ( arrm( p;t0aee io3iyslmDemu s;()tleoio3oy1lmt aivslt)s2xmir nydlpt mictlsf rur(m nu1aexnioeils mDran ont0tetoio iotfpte nvi;() 2uo(rpiudllte fvtat)aDrrxmpno1tpx  ietas s rauvpn() rxnio3oo1lp r ueo s  2uoxopoudaltemicia(f Drmxmp;t0tpe ifciasfsDum(mo u4aetnxf3ia1late ivi t)s2umio iodol   nctas)aDtax onu1optnmf3tyd mDul( p;u)trenmocoatfateaueo (  rxrxo iydlmee fesa(fsrurxmooo1tleoiocildla2rlu s t0altnif iadlaDeai o t) etm(rpoudlp emnctas srtrur ou0tlenmo3tysfmDulump;t4trxoir ty1fpDrauvo (0 rxmimpno1ap  mivsat sDua(mooo0opxniociltfs2uanvs t0 etrif iydfp  ai slt  rum(m3iodoptnlnvi sf ruaxrpnt4tlx iicils sDea(vs u)tltnir3oy1fpteai i;s)trxr(m iydomtelnviat srtrxmp;o0aexnii3tlsfm ea(vsnt0texrxrciodlp e u i (0srtrio3iu4lmt mncs ()a2tmurp;t0aeen o3iysfs rl(vonu0aetoifcoa1fat lu ol()trurirpio4al nlfes tfartr(r oo1tpx  o3iltfm2um( pnu)texoircty1oatelivsl()seuoxm oo4op nlnctas)a2tr( pnt0aetoii3tls a el( s;() exomrciadfpD li i ( sruoxo nu1ll   fvi sfa2um(ronu4tetnmfetyt s uan p;u4trxnxf iatfaDrlies;()trto(m3iy1lm nlncs t arraxmpoo0olx mfciyt aDua(vp t0 reoxo iy1lpDelieo;( teumio3iu1om e nesasf rrr( o;u1apt mocilsls el(vp;u) etriocta1lpDran s;(0trxrim3no1optnlictatf Dumxmono4ole mfciadlmDrlumo;u4 lerxf oadlp  auvi t0s2trio iydamtelfvsls)aDrrurp;u1tlx mf3ias s ra(mo t)tleomr iotlp rlueo (  euo(m3oodomenlfvi (f Dtr( ono4teenmi3tys s ea(ms;()arxnmo iodlm elnesls0srtriopiy1amenmfeia()s2rrumpot1oet ioeildla ean p t) exoifcoa1fatrln o;()setr(r iy4amen fei t  Dumxmpot1alenmiciad m ran snt0altnxf io1lmtrau s;s0seuo(opiu1ome lfctl(faDtrxr ou0olx  o3tydfaDuauvo u0alermfcoo1fmt lneslt) euoxmpoo1olee fvt ()sDtau  ot1tet miciyslsDuauvp t0texoxf3oodlm  aieils0s2xoxmpiu4aptelfcsa()artruro;o0tlx ioctatls2rlnvpnu)altoio3iatlm rauvs;s)texmxmpnydope  ictl(fsDrrumoou4altnmi3iat s ul(vs (0arxoxrciotfm rlu ilt0setoxopiy4ap e ict () Dta(ront0tpxoioctlsfa rmnvs;()trtrir oadfaD anvo;t texmxmpoy4amen net t s2rr(m ou0ale if3tatfa2um(mpnu0aeermr totfa   u sl(0 2xm(r3io4altemicsl( sDtaumpnu1oleo ietytlm ulnms;u) lxrir3iotfa eluesl(0 rtrxm oo4open ivsa(f Drau pot0oeeo fctltls ean s t)tlxomocoa1opte i sl( setm(m no4ol e ncs s  2truronu0apeo i3iltfsDelnvp;u0texnio iydfpD aivi s0sexrir3iy1lptnlnetls aDtrurp;o4tlx  octat m2rlu o;(4alxoifciatfaDranes ()s2um(opno1op   nciltf Dumxront1alt  o3tadfs umumsnu) rxoxo totlp raies;t)sexrir iy4lm e ics ( s2rrurono4opto ocilsfa2ea(ms u4 etoif iodlatrai sls  eumiopno4altemiesls s2trxrpno1opeomf3iad a2emn o t4alxnxo todoaDrlieslt0s2uoim3oodape lnvias)arrmxro;o4apen o3tlsfs2emuvonu) eeomr3iodoatr uei s0 rtoxr iu1alte nci s)sDurxm nt1oleomo3iad s2eanvp;(4 rtrxo3iydom e i i;s)sruoio3nu4lle  fes s) Dumxmooo0alx if3iyslsDea( s;t0 ltnmo3iodom elu il( tetrxr3iu1ope lneia(  2urxm ;t4apen fetyd a2elumo;(4trtoir ia1omDelieo s)teuoirpny4al  lnct sf 2tr(m nt4oetnmo3tytls ra(mpnt0areomf3oy1oatraueo;( tetm(mpiu1apeemnvtlt)a2rrumont1altomfeild s2rau s ()alxnxf3ta1fmtr n ols  2tr(m3ou4omtelfcslsfaDrauronu0oee mieias s rmumon(0arxrmf tytoaDeaneo;s0srurxo3io1amte nvs (faDrm(ront0opxo f3ias sDuanvs;()trtnir ty1faDe uei t)s2xrirpio1lm emivsasfsrtrumpoo1tltn oeiys a umnvs;u0 reoxf3ootoaDr nvs t0sruoim ou1ale mncsasfs2umxrpno4tetn o3iatlmDeanvs (4 lxrmociadopt  uvs;t trxoim oy1al elfvslt  2rmx pou0aex miciatlm umn p (0tlxoxocto1fp eluei s0srurxopiudlme lnvsl( sDra(mo;o4tet mictyt a2uaumsnt) etoxfcta1om eli o;s t2tmxrpio4optemnctatf 2tmxronu1alxn f3iyt mDeanvon(0trtnio iadlmDrlnvi t teuo(r3iodame lneilt  2ra(m no4aexniictysfsDuanvo t)trenxociadlmD livol(0t2xoirpnu1ale lnvil( a2rrx  nt1oeen o3iytfa eanvs ()aexoif oa1omDean o ( truoxm nodlp elicsas) rrmxmoot0aexomi3ilslaDraumonu4tetoir iytla rau o;t0s2tm(m no1lp  miciatfartr(ronu4oltnmiciydfm2uln o;t4 lerirciotlateln o s  ruo(mpnu1amtn iviasfsrrmxmpnt1olt  ocils aDrmn pn(4 lxrir3oydoa r nvs t  2xmxmpou4omtn nci t)sDrmur nt0tpenmfciatfa2ra( s;u0tetnio3ty1fa  anvi;s)t2um(m nodlme lfvias)aDraxmoot1tpx  fciasfm elumsnt0trtoio3tadoatraneils  2toxr iu4ap  livil()arrr(ro;u0aeenioetyslm ua(vp (0aetrxo3io1opt lueo t)s2xrio iu4lp e fct (fs2um(mont1oeeniieiydlsDumuvs;t4 lxoxo3oytoptrlies;t srtmio3ou1omee fet s) Dtrxm ;t0tlx mfetysfs2ean o u4trxoxo3iadfm  anvo t)tetoimpnodllen ietlt)sDrm(ro;u0oexnmf3tasfsDrau o (4 etnir3tydomD li s;(0teurim iydllt lnei (fartm(ront0aexomo3ildla2rlu p (4altrio3oydfa  livi;(0s2toimpoo1llt  icsatf Drrxmoot4tee mfctysfa rau pnu)tleoxr3iatop  auvsl(  rumxm nudomeemivil()srrm(mp;t4apxoii3tlsfmDulu o;(4aetomf todla e ivils0 rxrimpoudaltnlnesltfaDrau p;o1aetomiciadlsDemn ont)texnxf iadop  lues s0trxm(r3ny1olt lfes tf 2uru  ;t1aexnmo3iatlsDemn p (0alxnmoctatomt  uei t srxoxo3iydlpen fcta( sDrmxrpoo0opxn i3iad m rmumo;()tlenio3tytlaD lnvs ( srurio no1amtnlncta(  2tmxm ot4tlx ioctydfmDeaumo;(0 lxrmf3iy1fmt aueolt tetmirpoy1omeelnvslsf 2trxrpnt0tpxnii3ilt a2ul(ms (0trerio3oytfaDean i;() rtrirpnu1lp nmnct tfaDrrumo;o1apxoioctyd s2ul(mon(0aexnmf iodoptean o s)s2xmimpoydapen nvs (fsDta(  ;t0alxomieias sDrluvpn(0aetoxf ty1fptelivols)s2xrio3io4lm elics t)arua( oou1oex  iciadfaDrmumpn(0artrif ootomt  n s;s  ruo(m iodoltnlneil(fs2rr(m ;t4tpx ifcildfaDem(mp u4 renmr iy1lm  aivs;(  2xoimpoo1om nlicsls sDrru pot4oee  octatfmDelump u4alermrcoydlm  aiei t seuo(opnudolenlnesl(f Dtm( onu0oeeomi3iyd mDumu onu0arxoxr3iytfa  anvslt) ruoxo iu4llenlnvtls)aDtmumpot0ope  o3iysfsDumn o;(0aexomf tydlmDr u s t) exr(rpiu4lmee nvi t sDrax  no0apxo octytfa2elnmo t0treomr oytlp eaues;( trumio oy4am n feta()sDtr(m oo4oet miciad m2em(mo (4tlxoxf ootlm e ivolt  exoir3oo4ll emncsa(  2tmxmo;o1tltnmoeild sDem( sn(4alxrmfctytlpD  nvs t) etoim iy1ap nlfes s)sDtaxrp;t1tpen i3iatfs2umumon(4alenmr iadomteln o;(0s2xrim3nudopt lnvta(f rrmum no4optomoctyt m2ulnvo t0arermr oo1la e nvo;s)teum(mpnodap n fci s arrm(rp;u1aeeomicias sDemn o u4aetoxoctotlaDr n sl()t2xm(m nydlle  fvt ( a2tmuroot1opxnifciasfmDulu on(4areoir ta1optr ieo s0srtm(r nu1lltemiei tfaDtr(ro;u0oexoifeiat a2rm(mo;(4aeerxf3iodop rlu sl() rxrim iy1om nmfvilt)aDtmumpou1aptn feiltfm elumpnt4artomfciotlpDranes;s s2xrxo3oy1am n ieias a2rmxront1aptomociys aDeanvsnt0aleriocoa1opDe i o;( srtoxopio1ale lnvi t  2tmu ooo1teen oeils s eanvp t4artrmo3tatfa ean olt0 rto(o iy1amen nvi sfs2trx oot1oleoio3iltfa2rmumpnt4 lenirciy1faDraivols srtm(o3ny1ole mnvs t) Drmxmoou0apeomoctld s2eaumpn(4aexoxoctydlmtelneo t  eurimpoy4olen ncsatfs2uru pno0aleniocildlm ua(msnt0tlerxr iodlm rlnvils0 rurir3nodlm emfvt (f Dtau  ot4tet moeiasla rmu s () etnxf ia1fmtr uvils teumxo nodop emncia()artaxm ot0alxoif3iys s2uluvo;u0tltrio3oytfpD  neilt)sexoxmpiydop nlfvi ()aDumu pnu1oleoiocilslm2emnvp (0altoir oytlm  lu o ( s2tmir iy1ll   fcs s) Dtrxro;o0oee  fctydls2eanvo;u4 leomocootom rlies t t2tmxmpou1optnlieias srtr(r ;u1aleo f3iysfmDelumpn()tlenifctadlpDelnvi s0sexo(m iu4aptnmneslsfsDumurpnu1aleo o3iltlmDumn o ()aexomf3iytlmD aivslt tetmir3nu4amt  nci (f Duru ono4tptn ictltfm2el(msnt4trtrmocto1oa e u s;t) ruoxr3nodlm nmnei t)aDtaurpot0aptn ieiltfs2el(vs;() etnxf oo1lm rlnvils0setr(m iu1apee ivi ( s2tr(roou0alxo f3tys a2umumo;u4 rerxo3totlpD an i ()trxr(m ny4altn ncta(f Dtaxm ;t4oeeo iciydfaDrlumo u4tetrif3oa1opDr u s;t0s2xoim3ou4ame mivslsfs2ra(r no4aleoiietat m2rau on()altomrcoo1oa raivo (0 exmim3no4lmtemfcias a2taxr nu4tltnmfetysfaDulump (4 reomr3oa1om rauvs;t0t2urimpnodam   icil(fs2ur(r ;t4tptnmocild s2ra( s ()artrmr3ty1oaD livo s  rxm(mpnodaltelnciltfsDua(rpot0aex mfcild a2um(vpnu0aexnio oa1fpt  uei;t srumxrpnu1lme  nciat)a2ua(m oo0oleomietadfm el(vo;t0 lxoifcoytlat  n olt0setmirpnodoptemiesat  2uax pnt4tpeoiiciadls rl( s;u4 rtrmr3oadfa rauvi;s tetmxr ny1lm  mfciltfsDrax  nu4aee ifctad aDrm( on(0areoxo oa1lmDe u il(  etrxrpnydlle mnct s aDtmumpou4tpe mfeiadls2ulnmonu4aexrxo oatfmtelivi s s2ur(o no4omt  fci t)aDumxrpou0oetnmo3iltls el(mon(0areoxo iatla r n ol( teur(opiy4altemfct s sDraxmo;t0apt  octatfa2ra( snt4areomrciytoat  nvo;() 2trxr no4lptn nciatfa2ur(ro;u4tpe if3tysfsDul(vs t)altrirctotfp r n ilt)srtmir iodolt lics t) rtmxmpno1aexn i3ils s2rmu pnt0arenxr tatoaD lies;() rxoxmpoy1llen fvi tf 2rmxrpno4oexo ietyt m2eaumonu4 renifctydfmtelivs ( s2tmir3iodlmt  nesat aruaxrpno1tle iiciydfm2ua( o;t) eenirciotoaDraivi (0 rtrxo ny1amtemfet s sDuru pno4teenifcildlaDulnvp t4tlxnmocoa1fptraies t)s2xoim oodaptnlfvils arta( o;u4opeomiciydlm em(ms t0 eeoif3tatlp rluvol(0s2ur(r3ou4lpeelivsls)arrrxr ;t0oet ii3iytlm2uanvo;t4aetomo todfm  au olt0 etoio oudlmte ieslt  ruru o;o4tptn iciysfa ra(mp u) renxr3iy1fa elnei;() 2uo(mpiy4lpe micilt aDumumpno0apx moctatfs2ua( o u)trxnxo ta1opteanes;s0teumio nydalt mneil() rrmur ;u4oeen o3iytfs ea( sn() reoxrcoatfpD aneo t seumiopiudolenlfvtas a2tmxm nt0aptoioctytfsDrlnvs;()tlxoir oy1laDeluei;s)s2xo(r3no4omt lncils)aDumuro;t4alxomicilt s umuvp;t)alxrif3oadoa e iei s srtmxmpou1lptn iciltfsrtaxmpnu1aptn fciadfm rlu pn(4 lxomrciadoaDeai o s)trumir3io4omtemnct t)s2uaur no4apxn ietydfsDulnmsn(0 rtomo3tatopDeaivols0t2to(r nu1apee ncil(fartaur ;t4olen ieiadfs ea( p;u4teenxo3iadomteauvo s)truo(m3iu1op   fesat  rraxr no1oeeomoeias aDua( pnu0teeomociatfm e u i s  2xo(r oo4lptn fetas)a2ta(mooo0aee mo3iadls2ranmp;u) ltrmfcta1opD aivs s0srxoiopiudlltelfct sf 2umx o;t4oex  fciltfm2rmuvon(0 rxoiocia1om  lu s;(0seumim3nydam  lnci tf Drax  ;t0tltoifeiysla2emump t)artomfciodlm rlivi;s0 2uoiopnudlm  mfcsa() ruaxm ;t0teeo ietytlsDum(mpnt0trxoif3oo1omt  neils0srtmxm3ou1opeemiet s)sDrrur ot4apxoif3ils m em(vp u0aetoxrciatlpD  uvs s texoxmpnu1lmt lnesl(fa2trxr nt4oleo f3iysfaDrl(vp;t4aexrmociy1opD au s;t s2xoxopno1omeelnet t arur( oou4aetnmfciydlsDumnvon()alxnxocoatomt aivolt0texrxrpnodameemnei ( sDtru  nu4tet  o3iadfm rmumpnu)artrmf to1lm elivolt)s2uoxo ny1llt lfvi ( arum(rpnt4altoioeiat m2rl(mp;u4 rxoxf3tatoa r nes;s)s2umxr nudomtemnes tfarua(  ot1olx  o3tld m ea(vo t0areomrcoytlptr i s (0 2uoxrpio1lp  lnctls sDrmuroou4aexo oeiatfaDuanms t0 reoxr3oytfa   nei t t2trim oodllenlivia( arta(  nu1tlxomfctas s emuvsnt0trxoxo3iytlmD  ues;t0 2xr(mpnudamtelneiasfa2trxr no0aeeomfetad m ran pn()tetrxr3iatoa elivo;t  euoxmpou4apeelicilt) rurxr no0teeomfeiat s2rauvs u) lermo3oadlpt  ivo;s)t2trio oudapte ietlsf Dua(r no4alxoif3iat s em(vs (0 eeoxo3totfmt  n s ()t2xoim oo4olt  net tfartrxmpno0oltomi3tat mDum(msnt0 reoif3tadlaD aivs;( t2xoxr oudapte ncsat)a2umum ;u1texn ietyd m2uan on(4tleomfcoydfp r i ilt0srurim3oydlmtnmfeta() 2uaxmpou4opxoifciasfa umuvp;(4tleoxociydlmDe ivol()tetoxrpoy4ale  fviat a2raxrp;u4apxoifetytfs el(monu4 ltrxo oydlpDe nvols  etmxmpny4ol n ncil(fsruaxmp;u4olen ociltlsDulump u4arxoifcoa1fa eanes;t) ruo(r3oo1lptemfcsls s2tr(mono0ale  ietas aDumn s t4aeeoxocta1opDeanvslt  2xoxm oodal   neiltfsDtmx p;u0texo i3tatfsDea( s;()teenxf3oydfpDe nvo s0t2toio nu1ll nmfetl(fsrumxr ;t1apxoif3tldfs2eaumo;u0teerircoytla  anvilt) 2ur(m nu4apen ivsa() rumxmo;o1opeoiictlt a ra(vont0altoifctydlatrli sl()srxrir3iu1optemivt sfsrrr(r nu0oleo feiytfm rlnmo u)arxnmf io1lp rlueils)srxoxr iodope lfcs t srtmurono0tpt mi3tysfa rmnmp;() rtrir3oytlmD aieol(0 exo(o iydalt lnctl(fa2rrumpoo0tpt iiciydls eln pnu)aetomr3oodopDr uvs;t)s2urirpno1ap e feiltfsDtrx  ;u0ape iociyt a2ulu on()alxnif ia1fmDelnes;t0s2uo(m3ou4ap n net tfa2ta(ronu0ale mf3ias s rlu o ()tlerxf3oo1lmD ai slt srxo(rpou4ale mieta(fa2um(ront1texnmfciltfsDeanmon(0 lermr ia1fa  livols) 2to(r nodlm  lieta()artrxmono1aleomietydfaDul( o (4 lxrmf ta1lmtrlnvo (  eumio oodomt lfvs s)a2trxmoou4ope  ocilsfmDelu pnu) etrmf3oydfpD ln slt  2trir3io1lptemieslt)arrrx  nt0altn oetyt mDum( snt4arermociytfp elivo (0sruoxopoodamt  nci (  2uau pou4oexnmociyslaDua(vont)aexrxr iy1omtrluvi s0 exr(opoo4lpe lietas)sDrrxmooo0tpe  feilt m ulnmo (0artrmfcta1oat anvs t) 2xoxm iydopeelnvtasf 2ra(m ;o0tpto icias aDea(mo u0arxoxo iadfpD  nei;()t2tm(o io1lmen fvt tfs2tru  oo1tpeomi3iadla2rau pnt4artoxo to1fmt  uvo;t seuoxm oudapt lictas) 2tmxm ;u1opxoiicias a2rluvsn(4trtoir3io1lmtr uei;(0s2xr(opio1ap nmnct t)a2rm( ont0ale if3ilslaDrlnmpnu4 rxomf3oodomD  ies (0 eurxrpno1ole miet s)srraur no4opx  f3ildfm rmu o;(4 lxnmf io1lmDeaivs t  ruoim3ny4al   fctat aDuru  no1teen ocildfm2uan o t)arxoif oadfptr neolt seur(rpou1llenlfviasfsDrmurpoo1tpx  i3iyd aDumuvo t0aexrmr iydopt livo;s s2xmim3ny4ape  fcil( sDur( pot1tpxnio3tadla rl(vp;u4 ex
\ No newline at end of file
@@ -0,0 +1 @@
+u slt s2xo(rpoo4lptemfeilt)aruru  nu1teeoio3ilsls2emn p u4 rtrmr tatfm rlnei ( t2trxopno4optnmieias aDraxmont1olt  ieiltfs2um(ms t) lermr iodlm rlues;t0 rtr(opnodlle  ivi tf rra( ont0olxnifetasfs ul(ms (0 lxnmo ty1fp elivs (0 2xmio oydlm  lncil() 2ur( oou0aet  i3tlsfm2eluvs;t0 rxnmo oa1opD ai o;t trumio iu1ol n icsat) rtrxrp;o1tee ii3iyt m uanvo () rtrmrcoodomDe u il()srtoio io1al nlneta( aruaurp;o1tptnmietas sDeln sn(0alxomr3iadlaDe nvilt0srtrxo ny1olenlfvilt aDta(ronu1tle ifciydfsDuauvo;t4 renio to1omt  u ol(0trur(o ny1amenmictas sDtaxmoou4aeeo ociydlm rm(msnt4artomf3iotomD auvils) rxoxm ou4ol n netls  Dtmu o;o0aeto o3tydfsDuaumpnu)altnxociy1lpDeau o;t0sexr(opiy1ape  fesl(farum(rono0olxn oeiadfs um(mo (4 reomo3oy1fa r neo t t2tmim ny1aptnlics t) 2raxrpoo4apeomocilsfsDuanmon(0 rxrmo3oo1fat aiesl( sruoxrpoudlleemneiat  rra(ro;o1teeniiciaslaDrm(vs u)texoio3totlaD  i i;s0trtoxo3oydomt lnvs s aDumx poo1aptn feiysla2uau pn(4aexnif io1la   u o t)tetmir ou4ap e fet (  2ua(  ou0texnmfeiys a2ra(vs (0 etoir iytom eau il( setoxrpou4openmies t)s2um(rpou0aeeoiieiasfm2ea(vp;u0trtnmf3oo1faDr ivi s0sexrir nu1ap nlics ( s2rmxmonu0oetnmfcilsla ul( on() rermo3ta1fm rln ol()tetmxm3iy1lpe livs sfarrr(  ;t0aex mieias m em(vo t0 rtomf tadfpDe uei;s setoxmpio1lpenlicslsfaDtmumono4tlxn i3iltfa2rauvo () rtnif todlaDrlueo (0 2xmxr3oo1amenmivtas  2trumooo1tpenioeiytlm rauvo u)alxomr3oo1lp e nvs;s) exo(o ny4alt mnvslsfaDrr(m nu4oeeoioetld aDrmumo;u0aeeoir3iytfp eli i s) 2xmio iu1omt mfetl( s2rau oot0tlxomictatfsDuau s;u0tetnxo oytfm   n ols0trxr(mpiy1om emicsas)arrmxr ot4olx mi3ilt a emnvs t0 rxrif iatfpDeln o;t)sexmxrpoo1omtnlivta(fsrta(mpno4aeenmi3ils sDemuvo;u4tlxrmoctodfp  lnvs t0 rxr(opiydlp  mfetlt srrau o;t1olt ifeilsfm eauvpnt)teenxf3to1op r uvs;()trxoio3iy4lltnlncsls  Dumumpot4oeen fciydfm2em( on(0tlerif3tatlp eaieo;t) exoxmpiu4lmtnlivtlt) 2rmumpnu0opt miciadfmDuanmsn(0texoifctotlptr nesl()trto(mpnydal   ieiat srtaxr ;o1apt miciadfs rln o t4texnmo3tydla e ivs;s)s2xmim3oodope  ncsa()srrrur oo0apt  i3iys sDumn o;t)aetoxociy1opt aueslt0s2uo(opiy4aleemfes tf 2tax pnt0ale  ieiasla2ra(vo;()tleoifctytomDeauvs;( srurir iudom e fcia()aDtmxmpou1tpeo feiatfs ulump;()tlxrmr ootlmDrai sl(0s2trim3nodlpe  ivs ( aruaxrpoo1ope  oeiyd m2emn s ()trtoxo3oa1fa   i s;s0 2trxrpou1lp e feta( a2um(  ;o0olenmfcias a rln snu) rtomf3iydfp eaueilt) rtrimpiodape mfvta(fsDtax p;o1oetomi3iatfmDrlumpnu0alenif todomteln il(0 etmxm oy1op nmivi sfarrr(r ;o0aeen i3iytfa rmumsnt4aeerxocoydoaD lu o () eum(opiydap  mfeiltf rrr( p;o1apt iictadlm ranvp (0alerxrciadfp raieo;s)setmir iu4lltemnetasfaDrmu  ;u0olenioeilt a rl(mp u4texnir3iatlatrluei s0trtmxo iydalt  nvs s  2umxmpot1aee  ieias m uanvp u0 ltnmr tydlptrauvo;t srtmio3iodlptelncs tfa2rr(rpnu4tlx io3tydfa rlnvpn(0alxrxr oytoaD  ivs;(0 euo(r3oy1alt  ivtlt  2um(rpot1aleoio3iat a um(mp () lermrctadomte ivsls0t2xm(m ny1olt mietat)srtaxr ;t0ole  fcilsfa umnms;u4alxnxr oydoaD  iesls  2xrxr iydaltelneslt  Dtr(root4tpenioeiytlmDranvo;t4tltrxo3iotfp e uei s0t2tmir no4olt lnciatfaDtau  ;u4alxomi3tydls2ran o u)trerxf totfpD  nvilt  rtrxm oy1lmenlivs ()aDtr(mpno1aetoii3iysfmDua(ms;(0alxrir3oadla   nei t teurxo3iydolee iesls) 2rr( ont4apx io3ias m2ua(msn(4altnxf oydfpDelivsl( srtrxr3iudllenmivs () ruaxr ou1olenmoetldfa emn snu4tlenioctadlatr i s s) exoxopiy1lpt mfet sfsrtm(ro;u1aee  fcild aDel(vo u4artnxo3iy1oa  aivo;t0t2toir3nu4llt mieil(  rrm(  ;o0aet mictldfm2em( s t) rxnxo3ootlpDraivo s texrir3oydlm emics tfs2rmx o;o4altn o3ildlsDemn o;(4 etrifciydlp eaiei s truo(r oo1al emncsat)sruaum oo4oexomociydlaDuanvpnt)tltnmr3iodfpD ai o;()texmxm io1ol n ivia()arrmurpot4oexomieiltls ea(ms;u4aleomr3iatfat  i i;s0 2to(rpiy4apeelivslsfs2rax oou4texoifetad m2em(mp u4aexrxo oydlmt lies;s0 2uo(r iu4apt mictasfsrrru pnu1oltn oeiydfaDrauvonu0alxoxocootom rlnvs;() etrirpnydlpenlict s  rtr( ono1alxomicildlm2ean s;t0arxnxo3ia1lm rlneo t t2xmir oudlpe lieiltfsrua( pou4teeoif3tytlm2ul(vsnu0tlxnxo tytfatrau o t)tetrxo nydlp nmfes t)aDrm(rpou1olto fciydlmDemumo u0altrmocoatopte nvslt)seto(o3oodllee nvsltfaDta(mpot0tle if3tytfm2ranmsnu)trtoio3tadlatraies ()teum(mpnodlpe lncilsfaDraxrpnt1apxo feiytla2eau pnu0 rermf todfmDrln i;(  rto(m3ny4opeelfcils)sDraxmp;u0tle  oetasfaDrlnvp;(4aleomf oytomD lueil()srxrxmpoudome mies t artaumo;t0aee ioeildlmDem( s;(0tetomf3ia1lptelueo;s0texoxo3oy1lptelnctas)sDurxrpno4opeoiieild aDeau s;(4 ltoxo ty1fp rli sls0 exrio3oo4llt  ncta()aDra(r nt1texo ictydlm2ul(ms;t4tltnxr3iatfpt auvi;s)setmim3iu1optnmfciat  2rrx poo4teenmietlt m elums;t)trxrxr3oatfp  aneo ( seuoxm no1ll  mfeil(  rtr(r oo4texo oetasfaDeauvonu4 lermrciydlpDeau ilt0sexr(m3ou4altnmfctat) rtrxmpnt0opxnioeiydlm um(monu0 rermfcoatoa r i o;s teur(rpny1omeemfet s artr(  no4aeeo i3ild s rmn s;u0teenmr3ia1fmDeauei;t  2urxm io1ll  licsl( a2rru  oo1teeomociytfa2eau s t0alxrxr3iodlatelivi t0 exoio iydomee nciltfaDurx p;o0opt mietytfa2em(ms;u0trtnio3io1omDr ues s)t2xmxr ny4am  mnvt s)a2rmx pou1apx mfeiat sDrl(vpn(0aeermrcta1fp r u o s) 2xmio3iy1om n nei s)artaumooo0openifeiasfa2uln p;u0 eeoiocoodfpDeaueo;(  exmxr iu4lpe  fes tfaDurumo;u0olx ifeiyd aDrmnmsnu0teeomfcoa1fat  u s s0srxrxopoo4lm n fvs t srrrur ;u4olxn f3iyslm ran p t4artrxocia1oa eaivol( trxoxmpou4omte fesatfarraum ;o1apt  oeiydfm ea(ms;(4altrxo3ootlpDelu ils0trxm(m3iydopeelnetasfs2rm(monu1aet ifeilslm2ea(vs;t0arerifcoatoa raivs s)srxrxrpou4omeemictl(  2tm( onu4texoifciltlsDelu p;(4trtnircoy1faD  ueo t)trtmxopiudape lnesat) 2tr(  ou4apt mieildfa2rm( p u4 rtnxociotomDe ivil()teum(o nu1lm   iet s)sDtru ooo0apxoioetydlsDrl(mpn(0alenmrcoadfmDrlivslt sexr(o oudlpeemfvtat  2rmu oou4oetoiociltfa umu onu)aexoirciydopD lueo;()s2toxo io1ape lfvilsfarra(roou1opxnio3tas a2emnvp;t4 rxnifcto1lpteai o s)srurxr3iy4alte nvilsf rua(moot0tle io3ilt m emnmo u0trxrmf3iydlp   u o;t)s2toxo3ou4ape lfet s aDur( ono1tet mi3tyslaDemuvon(4aeenmociatlmtrauvi s srurio3iudolte iet s)aDuaxm ot0apt  o3iatla umnmo (0 lxnifctadfmt au ols) 2xo(opou1lp elfeia()aDtrxrooo4tex iocildls ul( p u)tlenmr tatop   nvi;t) 2umimpoy4lmenmieta(faDtmurpoo0tlxn o3tldla2ea(vont) lermoctotfmD  uvo s  etrim nu4lm elfeil( aDrax p;t1altnmoctad aDuan pn(0altrif3oo1fp e u s s  2tmxr3oo1omenmnvs s  rurum ot1aptnmoeiaslmDea( o;(4 rermfciadfat lu o () rur(opoydll n ivslt srtmx o;o4oeeo fcils a uanmpnt4trxnmf3oytlp   u slt  rurimpio1ameelnvs tf 2rmx oou0oexnifciltfmDumnms u0artnmr3todfpDe n o t)srtmiopnydom nlneilt a2tm(mooo0tptomo3iaslaDran o t)artnir iadomDrai s t0t2xmirpnudam emiviasf Durxrp;u0oeenmf3ils s rl(mp;(4 ltrir3io1lpt lueilt  2uo(m3oy4ape mieta() 2rrur ot1tpe mo3taslaDelu o;t0 exnmo oy1oaD luvolt)s2xrimpiudlpe mfeslt s2tmxrpno0apx if3tlsfm ulumo u0tltnifcoydfatr n slt)srumxrpno1lpe miei tf Dta( p;t1olt  feildfa um(vo t4teerxf3iadfm ean slt truo(mpoudaltnmfet s  Drm( pnu1tpe miciysls ranmo;()aexrxf3oa1lpD anvi s trto(m oo1lm nmfct (faDururoou0apxo iciatfmDrlnmpnt4alxoxr todoptrluvi t)trxrxm nudol  lictlt) 2ua(moou4olxo o3ild m el( o t0tetnmr oydfpt liesl(0t2trio3io1lp e fct ( a2tr(ro;t1aeeoifciytlmDeau s;()aeenxrcty1lpDrlieo;s)s2uoiopno4om nmfeiat) rua(ront0tpx mf3tadfaDeau o;(4aetrir3iadlmDe ies s0s2xoxo3no1am emfvtat) rrmur ;u1aptn ociad mDem(msnu4artnmr3oa1fat li i;s  2trio3iu4aptelfciltfarrmumo;o0ope  fciytfm ua( o;u4 exnir3oadlaD lues () 2xoxm3oy1optnlnei tf Durumonu0tpeo f3ild s umu p () exoif tadom  aues;s) eurio3nodapeelicilt s2ua(mono4teenmoctyd a2elu on()tetnif tatlmDraneilt  exmim iu1altelfesa() 2rrumono1oexnio3iatfm ulnmp;u4aexrxf3tytlm rlu sls0s2urim3no4lpenmfcilt  rra(  ;u1olxo icildlsDemu sn()aexnmociadfmD auei (0trtm(rpiodlpeemict tf rua(rono1aexnmf3tytfa2em(mp;t0altoxr oadopDe nei s0t2xriopoo4op nmncia(  Dta(root4tex moctlsfsDrl(ms;u)artrif3todoa rlivi;s) 2xoxrpoydomt  nesls)arrmx oot0opt mictltla2el(mpnt4teenif3totoa r nes;s trxmirpio1aptn fcs t aruaxm ot4opxnmfcilt mDea(vp (4 lenio3iytlmDe u s;t)teuriopoydopeelfcil(faDtmum nt4oex io3iasfsDrlu o u) lenxo3ta1fp r u ol(0srxoir3nu1om nmivsas)sDtau ont4aptoioeiadlm el(vo;()teerifciodomD au s s)t2toio ny4ome  iciat sDtrxmont0opx mf3iysfsDemump u)trerio io1lat lu i t srur(r3oudam elietl( arra(  ;t0oetoifeild a rl( on()alxoxf3iytfpteli i;t t2xoiopio4amenlfvt sfsDrm(rpou4aleoifeiadfmDumumo t0 ltrif iy1opte u i ()s2xoir iy4ope  fci s srtmu o;t0aetoii3ildla2emuvo t) lxnir3iytfm e n i;( trxoir3nodlp e nvias)artrurp;u4ale mi3ildls2eluvp;t4aexomo iytla e ueilt teuoio3iy4ap nlfcilt sDumur no1tptnmoctls s ea(vs u4aeenxf oy1fate nvs;s)trxrio oodllt  nvia() rum(m ot4apxn ociasfa rmnvpnt) lxrmf iytlaDr ivs;()t2xm(o3oodom  licsa()aDtmxmooo4tleo o3iltfmDra(mp t) rxomfciodoaD li i (0 rtoirpnu1llenmfetat)srraumoou4olx ioeiatla ea( s t4aleomo3iotfpDrauvsls0tetmxr no1lleemicsasf Dtmu onu4ape if3iasfa2uan on()trtrxr iatlaDe uvo s t2tm(m3io4ol nlieiat)aDraxmooo0aee  f3iltfa ul( s t)tetrir oy1lat au s;(  exm(o oudapt micias aDtaxr ;u1tptnmf3tysfm rmu p;(0trtnif iotfpD ai slt  2uo(r oo1alee ivtls artax ono4oet  fctld s um( o;()aetnmoctadomt  n olt teumiopoudlpen fct ( a2tm(mp;o1aeeniiciad s ea(ms;u0 leoxo oytfpDe ieo ( t2uo(r oy4oleemfetas) 2trxrooo0opt if3iyslm em(mp;() exrmrcto1fptr ues;t0 rtmio3iodam e iesasfa2trx pnt4tleniieilsls2eauvs;u0 lxrmr3oadlpD auvs;t0 2tmio3oodlmt  fcsa(f Draum oo0opxo fctys m elnmp u4tlxnxo3iotop   nei t0sexmxr oodamen fvsa(fa2rrxmo;o4texniieiyt m2uln snt4alenmo oadfmD  ieils0 etoio nudomenmivtlt a2rm(roou1altomoeiys m2rmu s u0tetrif iy1lpD lnvi;( s2tmxopnu1lptemneiat sDta( ono4aetnmictadfm2rmumonu)tlenmocoy1la  lies;t)srurxo3ou1om nlfeil()artaxro;o0texomoctltls2rlnmo;u0artnxf3iodoatr ueo;( s2xm(mpiu1amenmict t srum(mo;u4tleoii3iatfs eluvp t4treoxocto1faDrauvs () exm(m iu4ale lfci sfsDraxmooo1olto fetltlm uan pnu0aleoxo3to1laDeau ilt)srxoxmpiodapee iviasfarur( p;t1oex  ietyt m2rm(mo t0altnir to1lpt lies;(0s2xrxo3iudop nmfcs sfarurxmono1tpeo ictytlaDean p;(4aeermr3ootlaD lueil()sexmxm3iy4opt mncias) rrrx  ;u0olxoifctltlsDeauvp t) etoxr ty1oaDr nvils  2xmim iy1lpt  icslt) 2ur(mont4opxoiietyt mDrmu p t0 rermocoydfmD lneo;()s2uo(r no1ll e nviat sDrmu  nt1oleomf3ilsfm uauvp t)tlxnxf3oo1fa  li ils0sexr(opio4oleemfes (fs2uauro;u1oex  oetldfsDuaumo u4 exnircty1la e neo () exrxm ny1ol  mneslt  Drrxmont0aetomo3ilt sDul(ms u) rtrxo iatopD auvs ()truo(o3nodaltemici (f rtmu pou1opt mietydls um(vsnu0alxrio3oadoat lu s t)srxm(o ny1lltnmfcs s) rtaxr ou0aexnmicilslm2um(vo t0 ltnmocoy1lmDe nesls t2ur(rpiu4lm nlici ( aDum(rpnt0tlx ifeild s emnvp;u0 ltrmo3oatfmt aneilt) 2xmio iu1omenmnviasf Drm(rp;o4aet if3iadfmDrl( pnu)trtnmrcty1lptranvs;(0texo(rpiy1lpeelnesltfsrumxront4texn ieiyd mDuaump u0 lermf3ootlp e n il()teurxrpnodlltnmfci s arumurpnu4alen ociltfs umnvo t0tetnif oadlpD  nes ( trtoiopoo4apt  ivsls)sDua(mpnt1texnmfetaslaDrln o t0altrmrciatfaD  nvilt0srtrim oo1olenlfviatfsrraump;u1aptnifciatls elnmp;t4aexriociotfm e i s (0trum(o nydalen neil()artax p;u0oeenmfctytfsDrm(vp;(0 rxnmf3ootlp  lieolt0 2xrirpoydopeemieta() 2ra(rp;t4aexnii3iadls2ua( sn(0artrmrciatom  ln i (0srtoirpoo1ap nmivsl(f Durxrono0aexo iciyd mDran s;(0 ltomf3iydoaDrluvs;s s2trim3nodlmen feils)aDtrxro;t4alt ioctytfm eau snt0arenmo3tadlpt  n ols)s2xmxo nu1ol n nvtl() Dra(rpou0open ieilt mDrl( p;t0aeenxf3ia1oa elieolt0 2ur(o3oydlptnmfcs ()arururpno4oetoioetltfaDuln snu) exrirctodomt  uvs s)sexoimpiodom   icsatf Dtr(mp;u4apt  o3tlslsDuauvp u4artrif3tatlaDrli ils)s2uo(m3ny1aptemfesat a2urxrpou0oet io3tltfa2uau p t)tlxnmfcoa1oaD lu i;t  2urxmpiydomtn ivtl( artr(mpou0olxo fcias sDuln o;() exrmo3oytoa e i s t trxmxr oy4altnlfetlt) Dur( pnt1opeoifeiltfaDulnmonu)aexrxf iadfaDr uvo;s0 rxmio oy1ameemfct (fsDrm(rpnt4aexomfciltfm2ean o;() exnif io1faDelnvi;t t2uo(m3oy4ol elieta(fartrxmoot0texnif3iad mDuan snt)aetnmo oatoa  aues;(0t2urimpoo4altn nvtltfsDur(r ;u0ape miciadfmDelnvon()aexoxoctydla r nvsl() etmxopio4omen fciltfa2ta(  ;t4ope mfeiadfm2ran ont4altrmfctytfp  lnei;t  2um(mpoy4lmtn ieilsfartrur nu0oee moeiatfaDra(msn(0trxnmfctadlpteauvi (0seumir3oydop nmies t s2urur no0tpx  iciltlmDumn o u0trtrmr3ootfm rauvo ()trtrxr iy4olenlieilsfa2taxmo;t0aeeoif3iydfa2ra(mp t0tlermo3oadop eaieilt)texoxo3ny1omtn fcsasfa2ua(r nu0tex moctlslaDulnvs;t)altoxf totfa  lneil(0t2uo(o oodap elfctl( a2uaxrooo0aetomieiyd aDrmn s u0alxomo iotfaDrlnei;s sruoim3iy1lpenmfeiatfa2tm(r ;t1apxnifeiyt mDrlumsn(4artoir3to1optrauvslt t2um(m3no1lm e ivsa( aDrmur ou4openio3iydlsDrmu pnu0 ltoirciydlmtranvi;( texmir3iu4lp e ivtlt)aDum(rpou0aptnmfeiyd mDumnvo (0 exoxocta1fmte nvi s0sexo(o iydapen ietltfa2rrx onu0tlxnmi3tas aDeanmp;u0aeerxociotla r ies t t2xoir3oudol n ics s a2rm(mono4teen oeilt a2elnmpnt0 eerxfcty1lpD aies s trtr(r oo4alte fvilsfaDtruroou0oetomietyt s umnvo t4teeomo3ta1fp  aivs (0trtmxrpio4ll n fvi t)s2uax  ot1openii3tat aDumu snt) rtoxf3oatlp rluvol(0trtmxopnudoltemiesat)aruaum nu1oexnmiciatfm2ulnvont)arxnxf oatlpDrauei s0 2um(o3oy1amtemieil()sDurump;t4opxomf3ilslaDrl(vs;t0trxoxfcoodfa raueo (  rtoirpiu4ape livt ()artmu ont4olxnif3iatla2ean o t4alenxo oo1oa eliei;(  ruoimpou1ole  ncs sfs2ra(rp;o1oexoiieildfa emuvs u)tlxnmf3iotfa eaivilt  exr(r3iu1lmenlictl( srur(  oo1alx ifciasfs rmu s u)aeenmrcoytfpD lieo s t2trxo iydoltnmnvtatfartr(m nu0oleoii3ildlm rau p;(4alxoif iatfp raneilt) 2tmxrpnodalee ivt sfs2rmxroot1olen oeiatfm2eln on()tlxrif3tadom r u s;( srurxo3ny4lpenmivtls  Dtrx oou4tle ii3iysfa2uanvs t)texrxfcoytlaDrai ol(0 2um(r nudlptnlfvsat)sDtmxr no0apeomi3ils s umu o;(0 lenio3oo1fmD ln s;(0 etrxr no1al n nes sfarrmu ono0apeoifeiyd s eln p;()alxomo3totfptr uei;t  rtr(mpou1ap  lnet (fsrurxm ;o0openiictytfs emnvs;(4 ltoio iadfmtean s;(  rxmxr nodam nlfvta(faDra(root1tlto ieiad m2elnvp;(4trtrio tatoateaieo t0 rtoir3ny4oleemivi (fa2rr( pot1ole iiciydls rl(mp u4tltomo3tydom e ieolt0t2ur(o3iodllt mfet ( a2tmurpot1opxoifeiad aDrauvo u) ltnmo3iatop eau s t0t2toir nu4oltnmfeil( s2rmxm ou1optoioctlslmDrl( p;t) rtnio3totfptr i o s0trur(m io1ope lnciltfs2urxr ;o0tlxnmf3tadfa em(vo;u0tltnir iodlmDr ivol( trurxo iudam  lictasfsDrax pot1altnmfctldfaDumnmsn() ltniociy1fa  aneils) rxrimpiy1op   ieiat a2uax p;o4oex mietysls2uln snu4 ltoir3ootfpteau olt) rxoxopio1omee fci t  rrauronu1olxniociad mDelnmo (0trxomocto1omDeau slt)tetm(mpiudal nlnvtls sDtru o;t4tltnmf3tydls ul(ms (4aexoxf to1fmtr n sls0s2xmxr iu1lltemfvt ()aDuau  ;u4aex mieildfa uanvp;u4alxnmf3oy1lm  ai o;(0 rxrim io1al   fesls a2tm(r nt0tpx mo3ilt s2umu s;u0tlxrmr3tytfpDr n il(0t2umxrpiydamtnmfes t  rua( oou4tleomiciyslmDra( o u4arxrmr ty1fmDr n o t tetmio oudlm   ici s) 2urum no0apxnmoeiasfsDuauvs u4 lxomrcoo1lm   ivi (0 euo(opoy1lm  lfctl()s2rr(roou4apenmi3iytla ul(vo;t0 exrxo3iodlpDr u ils0 exrir3iu4lmee fcsat sDtr(  ou4tetn ieildfaDum(mp;(4 lxnmr3iotoaDr neo s) exm(o ou4lle  nes t)arur(mp;o1oexo ictyd aDea( o;t0 ltnxf3totlm eai s;s seurim iu1ll emncs t  2uaxm ou1tlto o3iad m um(mpnt4treoxo todlm ran o t s2xmxrpno1om emfvi tf 2ra(r ;o1tetnifeiyd a2ean o (0tltomf ia1omDranes;t0t2xr(mpiu1lp emfcia(fsrrmx  nu0oet  i3iasls ea(vo;t)tetnmrcoytomD auvs;(  rtmxm3oy4lp elici s)a2trx pou4oeto ocilsla ea(vsn(0tlxoifctydlm  li il()s2trxopiu1lmt  ietltfaDtmurpou1oetoioeiltfa eanvs u)texomf3iotlm  aivo (0srumim oo1lp e nvtl(f 2trx p;t4tlx  oetatlm rmu onu) ltrxf oytfpDeaivols)trtrirpio4ap  mict t  rur(m ;u1oetn f3iysla ulnvp (4 rtoifctytfmt li ols0 etmio3no1ll nlnci (fa2tau p;o1oee mf3iad sDrlump (0aexnif3oodoaD ln o s0 2umim io1alte fct (f Drr( o;o0tet mfetytlm2um( p t0tlxomo3iotfaDr ueils  exr(o3iodaltnmnvsa(  2tr(  no0apt iociys mDul(ms;t4 rermf iytfp raneo;t srurxrpny4openlfes s a2ururp;t0olenioeiaslm2eln p;u)arerir oodla eluvil( t2xr(o3ny4alt miesa(faDra(r nu4open ocildfaDranmp;u)aetnircoa1faDeau ol() rtoio3ou1optn icsasfa2rm(mo;o4aeenmi3iat m uau o;u0tetoxrcoa1fmD au o () 2to(o ny1aptnlfctas)s2uaum ;o0tex  oeiltfs2ul( p u0 eenmo3iy1optelneo;s0 ruoxr nu1ape  nes s)aDurx p;t4tle mieildlm uauvo;t)trxnxo iytlmDe uei ()t2xo(r3oudal e neil()srrrur ou0tlxo fcildfm2ra( o (4trxoxo tydfptrluvi t)srxoxopou1op emnetlsfsrurumono1tltomoetldfs rlnvsnt0trxnxocootlmt anvsls) ruriopnydam  licsas aDuaxr ot0tpxnii3tad mDemnvo;t0tetnmo ia1op eanvol(0t2xr(m3iu4oleemicsltfa2rau p;u1opx mictysla uau o;()tetomr3to1op eai i;(0teuoxr3no1lleemicslsfsDtauronu0tpenmociad s2ea(vs ()trenxr to1op rln o t0trxmxo oodopt lfcs sfa2rm(monu0aexomociyd s rmnvs;t4 lxoif oa1fpDeai s;s) eumxrpnudlmee ietls sDuau pou1tptomocilsfm rluvsnu4aetrmf oodfmD aneo t trtrio iy1ope mnvs (  Draurp;o0oeeo fciyd mDuluvp u4 rtoir3iytfa   iei;s0srxmxmpnu1ale lics ()a2umx  ot1oexomf3iys sDua(vo t0trxomo3oadfmD aueo;(  rtm(o3iydalt mivtlsf 2tmxrono4aptoiietyt s ua(vp t)altomrctotoa r nvi;(0setrimpnu4aptemicilt) Drr(  oo4alx mo3tls mDemnmsnu4teeoif3iodomte uei () 2xo(o3nydlme mnvs t)aruax o;t1aexnmoeiasls2uanmp (4areomf3iadlpt  ivslt)trtrxm3no4lp e fctl( sDua(moot4tpx  fcild mDum(mo;u0 rxrir3oadoat  ues;s)t2trim3oydapenmncilt arum( pnu0tlto ieiytls ran p t)alxomo oy1opDraueil(0 2toirpoo1lm nmnci (fsrururonu0teeoioeiltlmDuln o;u0tetoio iatfp  livs s0 etrir nu1lmtemfvilt) 2rmxmp;t4oltniociyd sDrl(mp (4trtoxfcoydfatr ueo;t)s2tmir io1lpenmfvia( srta( pot1teto ieildfs2ua(msnt4aleoif3oytfpt auvilt0srxmio ou4opt lictat)aDtaur nt4tlto fctld a2elumo t)alxnmo tytlatr nesl(0 rum(o3ou1omtnlnei s) 2umurpoo0tlxnmiciaslm rlnvs t0 lxnxf3iotfpDeai i;s0trtmim3oy1lm   fctl() rrm(ro;t1altniiciltlm em(vont0arermo3oatlptelu sl(  rurio3oodlmenmivsatfsrtrur ot0oeto octldlmDelnvp;t0tlxnxf oytfatelneo;t  etmxmpou1lp n nvt t  2uru ont4tee io3ildla2uau pnu4tlxrxrciatomt lu o t)trtmxrpiudomenmnvtltfsrtrxrp;o4aet  i3ilt mDem(vs;u4tetrio3oydfp  anvs;s s2uo(o3io1omtelfcias)sDumum ;o1apt mieildls rl( snu4tetnxrcio1lpD lnvsl(0 eur(r nydomt mfcs sfsrtm(rpno0tet io3iydfa el(vont0alenxfcoatlatrln i s) exrirpoy1lp nlictat) Drrumpoo1opxoio3iadfs uln o;u4 etrxfcootfpt  u o;s0 etoirpiydlmen ietls s2umxrpot4teto iciytlmDraumsn()artomr3ootlmD auvslt)sexo(m iu1ll emfeils) rtrx oou1tptomi3iadls eau sn(4tltrio3oatoa rluvi;s)trxmir3iydlme lfeia(  2um( oou1texomoetldfmDel(vs t4 renxr iytfpDeluei (  etriopny4ole  fvt ()srrr(rooo4oeeo o3tltfa ulnvont0 lermfcia1faDr nvs;s)t2triopou1apeelneiat arumx  nt0opxoioetlslaDrm( s u) exnifcia1lpte neo;t0sruo(m3no1opeemfesl(faDuaumoot4olxo oeild m rmu p;()aexrmf to1opt lnesl() etr(r3nydolt  iesls)srtmxr ot1tleoiietltfmDrmnmo;u4tlenxfcoydfm eli i;t0seto(o3oo4aptnlfviat)aDrrx pot0tpeoifeiyslm2ra(mo u0tlxnmf3ty1om   ueo t srxmir3iu1lptn nvsls)aruaxrp;u1tptnmoeiysls ran o (0 eerxo tytoa  li i;t trtmxmpoo1lptnmivilt)srua( pnt0oeenif3tlslm2rmnvo t) lenxf oydfmtean s;t  2xm(opoo1am nlietas)s2tm(  oo1oeen i3iydlm el(ms u) rxnir oy1faD  n ils0 exoxo3iydopee nvslt)sDuau o;u0aexo feilsla2ea( onu0artoxr3tadfm  ln ilt0 rto(mpoy4apee netl(f ruaxm ;o1apenmf3ilsfs eau o u)trermf ootlmt  n slt0t2umxo3iodal nlfci ( s2uau  ;u1aetoif3tasfs2eln sn(0arxnxr tytfaD lnesls)sexmxr no4ap emivsa() Dta(mooo1aptnifeiysls2ran s t)artnmocio1fatrlnes;s tetrxmpiy1lp  lfvtl()arur(ront1alx micildfa ea(ms (4arxnmf3iatfpt lneo ( truo(opio4lme mivsat sDra(rono1aex  oeiltlm rm( p;(0tleomo iadfpDelivi;s) exm(mpoo4ale micilt  2urx pnt0texo o3tytlaDelu o;u0trerir tatlm r uvsls s2toxrpoudome  net sfsrtm(  ;t1tpxn ietadfs2ranvo;t)tlxrmf iadopt lueslt0srumim ou4alen icta( a2um(  no1tlt  fetysfs rmumpnt0aetnio oo1fpD luei () ruoxopiudam   nci t s2umxr nu1aexnmo3iltla2ra(ms;(4aexnmr to1fpt auvi;(0sexoirpoodoptelfvi t s2ur(mpoo1altoiociaslaDrmuvonu4 renxo3iytoaD ai i t  rxmxo3nydomtn ict ( s2rr(ro;u4oex  i3ilsfm2eln pnt4alxoifctadoaD  u slt)srxoio ny1ope lnct t)s2umxm ;o0tpt iiciydlmDeauvo;u) eerifciodoa eanvs t trxr(mpou1lp n iesa( s2rrxmpoo0tpx iocils sDel( on(0 etnif3to1fa e u i ( texmir iy4llte fviltf rumxmooo1tet ioeiltlsDemumont)trtomfcoytfpteaneo;s) 2toxmpoy1lpeemfvilt)aDraxm oo1oeto i3tydfs2ulnvs;t0 leoircoo1fm  lneslt s2tmxopiodolt livi s)aDuaxront4tee ii3iatfm2elu p;t)tlxrxrciadfmD aivi (0srurxm3nu4lm   fvsls)aDrruront1tlxoiociadfs2rl( pnu0 rtnmr3tydfp r i s;t) etmxr no4open fctls srtaur ;t1aeeo oeiytfa2el( ont) eenio3oydfmD  uvsl()seum(m3nu1op emnci ( s2uaxm oo0teenmiciysfaDel( o;u0artnxf iatfmDrlivs s0 etmxo io4lmen iviltf rtmx oot4aeen fciat m2emn o u)arenmfcio1om ran ols0srxmxopnydal n nesa(fa2ur(rp;u4tlenif3iytlsDumuvsn(0tlxomr3ootoa ranes t)seurxr3ou4op n nct (fsrrmum ot1aex  iciasfs2eauvs () ltoir3ia1oaDr i o;t0 exo(r nu1lm n nvs s sDtmu pnu4oltnif3ilt m2elnvp;u4aetnmf3oa1laDeaivo t)seurxo nydlm  mncsl()s2uaxmpou1olxoifeiadls2ua( p;(4teenxrcio1fmDeau olt) rxrio oo4am elnct t a2ururo;u0olxniictadfmDrl(mont4 etnmoctotoat lnvs (0srur(o3iy4opeemfciatfa2trxr ot0oleo octysfs2ul(mp;u0 rtoxf3io1omtrlivo s0truoxr oy1opt  ivtas s2rau  no0oeeomictadfaDuanvp u4alenio3oadfa  livs t)srxm(m3nudlpeemnvta(f rtmum no4opxomf3iltfsDemnms;u0treoif ty1opDeli sl(0 rurir3iy1opee fvslsfarra(moot1alto feilsfa rlu o;t)tlenmr3to1lp  lu ils texoir3oodlltemneiatf rtru  oo4alt  iciatfs rmnvpn(4trtomf tytlpD lnei s s2ur(rpiudapeemivtatf 2um(ro;u4aetoifeils sDum(ms;t0 renir ta1lm rli i (0trumxo3io4amen nvt (f rtm(monu4opxo fcilsfm rmnms u4arxrmr ootomDeliesl()seum(opoodopeelfei ( s2trxmpou1altoif3ils m2ua(mo t4treomo oodopDelu i t0 exoxopoo4ame  ivt ( aDraxmpou4ape ifeilsfm eln p;t0tlxrif3oo1fpDranvo;(0s2xr(rpny1aptelics tfarum(  nt4opeo feiyt m2rlumo u) rxoif3oa1fm r uvsls)tetmxm iu4omtelnctlsf Drmum oo0alt mfetlsfs rau o t0 ltnxf3ia1lpt ai s;t  2tmxr io4lltnlics t) Dtm(mp;u4olt mieiaslm rmn o;u)arerxociotfmDeanvol() rxoim oy1open nciat)sDtmx  no4tltomf3tltla2raumsn(0aexrmrcoodfaD an s (0s2uo(r3nudlp nlnetls)sDrruroot1aetn oetadlmDea(mpnt4areomocoodoat  uvi;s) ruo(opoydope mfetas  Drmum oo1tetoio3iaslmDra( o (0tlenio todlaDr i i;t0 2xmio io1ll  liet sfsrra(monu1ope  i3iytlmDrl(vs;t0 exomociotfp rlnei;t0texrir3iudopt lnvtlt a2taumono1tptoiocilsfm ul(vsn() rxrmo3ootfmDelu i t) rtrxo3iu1ap  livi (f Draurooo1aexnio3iys s2uau p;()aleoxr tatopD au o ( t2xmio io1oltn ncs (  rrmu onu4opxnmieiyt a2rauvo t4 rerioctodlptelu sl(0 eumir iu1lp   nesl(f rtmumpnu4ope mfciat sDeln s;t4 lenxr3ia1om rlivol(0t2umio nydam  lncia(fa2umxmpoo0tlxoiietytls ea( o t4arxoxr3iotlmt livi t0s2tmxo3ou4lmee nesl()s2ra(  ;u4alenmieiadfsDelnvs;u) etoxo iotlp raieolt trtrxm iy1am e fcsat) Dua(moot1olt mfciydlsDuan o;t0 rtnir3ia1lptrauvs;s)trto(mpio1apt livilt  rrmxrpno0aeenmieiltlsDra(vo;u)alxnxo3oa1late ivi;s texo(m3nodomt lfvt t)s2um(mp;o1apeo f3iaslaDra(vo;t0 rtrxf3oo1fmteaivi t)srxoxr oo4ame  nesat s2urxr ot0aet mfeiys a2ua( snt0 rerxrciadlaDelu o;s)sexrxo3oudlp e ieta(  rum(rpnu4altnmociytls2umnms;() leoxo ta1fmte u s;s sexmxm3iu1lpt  fetat srraumoou0olen feiyslmDumu o u4 exnio3oydfmte i olt)srtoxo iu1ll  mivi t)aDua(mo;u0aetnioeiadlm2ra( p ()aetomrcootoat anvsl(  etm(m3nydolt lieil(  Dtmur nu1oexniieiyt s ua(ms ()aeenio3oatoatrluvol() 2uoxo oy4ll nmfvi t)arrmxr nt0aexo o3ilsla2rau ont0 rtnxocoydop raneo s0t2to(o3iudlme mietls arur(mont0apx  ictlsla2ul(von() reoircoo1laDe ues ( sexoirpiydopee fciatf rrr(r ;o1oleniiciytfa2umnvo;t4tetoxfcio1om eaies (0 rxmxo3oo1amtnmiesl(farumxmont4aetoifciys sDean s;t4aeenirctydlaDe n ils  2tmir iy4lltnlnvta(  rtm(  ;u1tlenmfetas m rl(mo;(0 rtnxo totlatrln o;(0trxrio3nu1olenmnei ( s2um(m ;o0tptomiciydfsDelumo t)trenif3iotlmDrlnvo;s texoxo iu4ope lfvilt) 2tm(m ;u0opx  ociltlaDulnmon()altnif3iy1lpDrli o t)tetrir nydom  mfesls  2taxrpoo4teeo f3tadfm2ran onu4arxomociadomt ai o;s0 exm(opnydame mies (fs2tau  ;t4alxn ieilsls uanmp;u4aexrxo3oydoa   u il(0trxr(mpoy1apt lnesls  rtr(moou0tptn i3iyd a rlu on() rxnxr3iytop e ivol(0t2tr(o no1aptnlfct t aDtm( pot4tleomociltfs emnmo u0aeenifcia1lateli o;() rxmim3oodameemnvs tfsrrmx p;o0tpeo fetad s2eau pnt4 lxomo3oydoaDelues;(0t2ur(m nu1ll e fcsl(faDra(rpot1apt ifcildlaDulu s;u0 eenio tadlat  ivi;s teto(o ny1lm n nviatfartmxro;u0opxnifcias s2rmnvp (4aetnxo3oydop  lnvo s sexmxrpnudom nmnvsatfartau pot1aetniociadlsDulums u4tlxnifcta1lmtr uvi ( texo(o oo4alenmfvtlt) 2trx  ot1apen oeiytfm uau s;t4aeermr oodfpDe nvils0t2tmxrpnu4opeemfcil(fs2taxmont0aexoioeiyt m rlumont) rtomfciatfa  liei;t) 2ur(o3oy1lptemnesasf rtmuront4tlenio3ias s eluvo u0artomfciy1fatr ivo t0seto(m3ou1lmenmfvtas aDrr(m ;o4apenmictysfm emu pnu4aexrmr3to1laDr i i;( t2toirpou1lmtnmneia(fa2uaxro;o4oeeomi3ild m el(mon(4 leoxoctadlp eanvs s  2xmirpiu1lpe lncs ()aDururoou1oex mo3tlsfs ran pnu0aleoxo oa1latr uvil()truo(m3no1lpt mfei () rta(ronu1olxniietyd m uluvpnu4treomocoydla raiei s0srtoxopio4ape  fvils)srururpou4aex moctatlaDemnvo t0aexoio3oytfa rauvo;()teurxopoodlmtemfeiat arrrum ot0tlxo i3tadfm eln s;(0aexnmf3oodoaDe uvs;s0 euoim3nu1ameelfet t) rtmxro;t1opx mo3tytfm rm( pn(0alxoio3iotfpDr ivolt trur(m ou1apte nctltfa2tru p;o0oetnmi3ild s2em(mpnt0arxoif3io1fmDr u olt) rtrim3oodome  ncsl( sDtrxm nt4apt mf3iasls2umnvpnu0aetrifcoa1lmDe u o t)t2ur(o io1apt  ict s  rururo;u0teeo ociad s2rm(mp (4 rtnxfciodlpteluvo;s trxrim3iudaltelicsa() rrmxroot4tlxn i3tltfm umnvp;() lxnmr3oytopDe u i;t0srurir oodam emfeias aruax pou4tlx miciyt a rlnmsn(4tlxnmfcoa1lpteli i;( s2trimpnodll n nctlt  rururoot0altnmo3iyd sDel( s;t4texnxocoytlatrlnvs;s  euo(r3ou1altn ies s arumxmpou4tpeoif3tat s ea(mpnt0trtoxfcoydfa   ies s0 ruoir ny1lme mnciat  Dua(m ou4tetnifctldla ul(mo;t0aeerir3tydlp ran s;s0teurxrpoy1lltnlfcsl(f Drrxm ot0tlx ifctld a2ra(mon(0 exrxf iy1lmD luvo ()srxrir oodlmt mfct sfaDua( onu4olt  i3ias aDrlnmp;t)teeoio3oatlp e uvsl(0 rxmxo3oudam   ncslsfsDtmumo;o0alx ioetldfs2emuvp;u0teerio3oytlmDr nes t srumxr3iu1aptemnvilt)sDtrum ;o4teen fciysfs2umnvs;t0areoif oytfm eln sls)s2triopny1apeelfcsls)a2raxr oo1aee ii3iltfa2umnvsnu) exnxocia1fp  ln s;() 2tmxopny1olt livi ()a2urxmp;o0tltnmf3ils s2rmnmpnu0texrir oa1lpDr ueils0srurim3oy1ol emivsa( a2trum oo0tex moeiadlm umu o;(0artoxr3oy1laDeauvo t  exoxrpou4opte ictls) Drrxrpoo1openiieiydfm2rl( o;()tlxnxf iy1fptr neols0srtmirpno1am nlfcils aDumurpoo0olt if3ildfs eaumpnt0arxoio3iy1latraiei s) etoxo3nu4ol nlietl(  Drrx oot1olxomoctydls2rl( snu)altnifcoydopD livo t0 rtrio oydalenmfesls) Dumump;o1texo ocild s el( o u0alxomf3ty1lpt lueo;t  2trxm iodop nlnet s)srurxronu4oee mf3ild a ra(monu4trxoxo3ty1laDraies;( t2tmxm oydam  mnct t)a2ua(mo;o4optnioeiaslmDrln s;() rxoxf3tadomDeaies;s  etoxm3no1optnmivtlt) rum(mont1tex moctydfs umnmp () ltrxf3iydla e u ilt) ruoir iy1llt mfviasfsDta(  ;u4tptnii3ias a uau p t0tltnxf3iydopDeai s (0 etm(opoydom n nvt (f 2ta(  ;u1alen ieilsfm uanmp u4 renmf totoate n sl(0srxmir no1olen fciat)aDrm(r nu0olto f3iydlmDem( ont4tlenmr3iy1laD ai o;t)trxoim oo4omtnmnvsa()aDtaxront1tetniociat aDrluvo;(4tlxrir3iadlmDeaneil(  2xmimpno4lm   iesa()artr(  no0tptomo3iltla umnmp u0aeermf3tydlmtelnvsl() rto(r oudome mietltfaDtrur ;t0aeto oeiysfmDrmu snt0 rermo totfm eaneil( teto(r oy4amt mivi t  2rmx pno1oee  iciytlm ulnmont)artoio iodla elneolt srxoxr iydll  mnetlsf 2uaum no4tptn o3iydfa ean p;t)alxoxocia1laDrlueo;t0srxm(m3oo4alte ictat  rtm( ono1texnmieias aDem(msnu4alermr tadfaDelivs;t)s2tm(o3iudlpenlfeslt)artmu  ;o1optoiictasfs rlump;t4alenmf3iytop  li ols0t2tr(m nudal nmietat sDtr(monu4alt miciyslmDumumo;u)tlerir oa1omt lnes t trum(o3io4oltn nvi t  Dtm(rp;u0olx ii3tydfmDrmnvp ()texrmfcoytlpteluvs s seum(r ny1ope mnci () 2rru  nu0ape  o3ildfa elnvp;t0 ltrxrcoatopt auvs;s tetmxo3ny1ap   fes ()a2ua(moot1aexnio3ias s2rl( o (4teermo oadfpDranvo t)srumio3nudlme miei tf rrau pot0tpe mfeiat aDrlu s u0alxoio oodfp rau i;t0s2urxm3iu4oltnlnvsls)artruro;o1tee  i3iyslmDul( on() reoir3ty1omD ai i;t t2toxm oo4lm nmivtas  rraumpou0teeo o3tasla2uauvpn(0aetnmfctadoa  luvsl( trxrxrpno1lm nmivsa(faDraxmonu0optnioeilt s emuvo;(0artnxr oytoaDe neslt0teurio3no4ap emfcta(fa2tr(mp;o0tlx  f3ilt sDeanmp t0 ltnif oo1fmDe u i s)s2to(mpnu4lle  iet sfs2um(r ;o4opeomo3iad a2ranvp (0altrifcoadoatraneo;s0 2trir3ou4lpeelics tf 2ta( pnu0teeo oeilsfm el(vo;u4texrmo3ty1lpte ues;t)s2um(o nodoleemnctas  2tax pnt1tetnmi3iasfa2rauvo t)texrxo3oydfmDrlueo (  exo(m ou4altemivi t a2taxmo;o0olen i3tasfm2um( o;()artnmociotlpDrlueo;s0 rxo(r3nudlpeemfcs sfaDrax o;o4alx  ieild m rmuvp t) lxomocio1optelnvo t0teur(o3iodlmtemnvt s) rtrumpnt4olto o3iysfa2uln p;u0tetnir3oadfa elnesl( srumxo io1lmee icil(fsrrmurp;u0oex ii3ilsfm2emnvs t0aeenxo tydoat luvo;t)s2uoxm3nydoltnlfcsasfaDtrx  ;u4aptnifcildla2umuvs;u)tetnxo3iotomDe n s;s0 2um(r3no1omen netlt  rtau p;o0tptomfctatfaDelu pnt)aexoxr iotfm e nes ( t2toim3io1lptnliet t  Dua(rpot1aleo fciatfs rauvsnt0 rxnmo3oadop ean sls)s2uo(r3nu1altemfciatfsDrm(  ;u1ole moetys s2eanvonu)tlxomrctytoat  i s s0 rtm(r iu1llt lfcs t srtrxmp;t0tlx mocild s2rauvont0 rxrxf3oatfp   nvi (0 eur(r3io1llen nvi s s2urxm ;u1ape  fcias sDrluvo;u0trxrxr3tytfptrln s;t0trtr(o3no1lltnlieil(  ruaxr nu0tlx iietasla2ua( on(4alenxo oatlpDe ueo;s0 etmim ou4omee fvsat)s2rru p;u4texomieiat mDeau s;()tetnmr oodlaD lneils0seumxrpoodol nlfciatf Dumur ;o1tee mfctatfmDeln p u4altrif3totfm  aieo (0s2xrxm nu4aptnmivi sf Dururpoo0alxo i3ild a uau s ()aexrir3oy1lp  livs t srurxopnu1om e feslsf rumur ou4aet if3iysls2elump;u)arxnmo oo1fpt livols  rtoim3nu1ap  livtls srrmxr nu1tpxomoetldla2ran p;() leriocoy1opDe ivilt0setrxm iy4altemnvsls arurxmo;o0olxo iciad m2rauvpn(4aexomf3oadfmDr nei;t s2um(m nodaleelfciat s2rmxm ;t4apxnif3tltlm2ul(ms (4 rxomf3io1lpDe n i s) exr(r3iy4opeelnet t artau onu4tlx ifeiyd a uanms u0alxoxo3iodlmte nvil(0 rxr(o3oy1lpenmivsa()aruax p;u1opxo fcils m2ea(vp;u0texrmo oadoate ivo s setr(r3iodlmenlneia()s2ur(r oo4aee  oeiys mDrl(mp u) rxrmrcta1lmteaivi (0teurir3oo1lmt  nvsat a2tr( o;t4olxo feiaslm2elumsnu0tlxomrctytfmtrlivo (0t2tmiopno4al elicias arraxmonu4opto ictytfa rlumsnu4 etrmfciodfmtr neils t2xr(o3oo1aptemieilsfs2rm(mo;u1tltomiciydlsDea( p ()aeenxo oa1faD  uvo;s  2xrirpnydlpt licsltf 2urx  no4tleoifctadfs2elnms;(0 lenirctydop   ivolt0texrxm3iodlme mnvta()s2uax o;t0oetoio3ils m uau o ()arxomfctodlpD  u s;()s2xmir3iydlpe lfvs (fs2ur(m oo0tetoifeiat s elnmp;t0 lxoiociy1faDr uei t trxoxopiu1lmtn nct t a2rmxmo;o0opeomfciat mDumnmpnu0tlxomr to1fmDrlnvslt srum(o iy4ap   fes s)arumu  ;o4apx mf3tatfmDumn pnu)tetrircoydlptrlu o;t s2urxm3nodap e ieil() rrrx pou0tpeoifciat m rl(vp (0 leoxo3oo1fmD  i i;t0seto(o3ny1lpe mivsls)srumu o;o0apxo i3iydfs eanmo u)tleoxr io1omDe uvol()sexmim ny4amtelieias) 2rm(r oo4tlt mo3tys a2rmu s;u) renif3oytoat  n ol(  ruo(mpiy1omt liei ()sDuru  nu0oex ioeiltfm2umnvs u)tltoxf oatlaD lu o;s)trurxo3no1am e fcias)a2um(  no1aee mf3ils m2rl(vsnt0tlxrir3ia1fptrln i t0s2trxo nodap e icia(fs2raumoou4tptomfeiadfm2uln p;(4tlxrir ta1lpt aneols) rumxmpiodole  fvtl()aDurxrooo1olxn i3tas aDean snu)tlermrciy1fpD ai o (0s2tmim3io1lpenlfei () 2umxr nu0oetn fcilslmDulnvs u)artnmocoydfmt aies;(  rxoxo ou1oltn nvsas srrmxm nu4oeenmietysfa2ra(vs t) ltrio3oatom e ieo;s0trxoxopiydaleelietls a2tru ont1oltoif3tysfa ua(vp ()aexrmrciytopte uvs;s  rxmim3nu1apt mfesl() 2rmx ooo0aexn f3iatlaDeauvs;u)artnxfctadfpDrlnvo;()t2urxopiudaleelncia(  Drm(  ;o0aptnii3iytlaDem(vs u) ltomr oa1lmDr nvs t)s2tr(r3oodolt  ivi s  rtrxm ;t4olx mocils aDul(msnt4 eenxociatom e neo;( texrxopoo1ome  nvt s)a2trxm ou4oexo iciadls2rluvon(4trxoxr3todfp   nvi (0srxoirpnu1op  lnvi () Dtaxrooo4oetn i3taslaDel(vonu4artrmf totlp   i i;s0sexmxopiy1amtelfvs sf rrmxr oo1tlx  o3ild a2ranvp u0tltrifctydfpDeauvsl( t2xr(o io1ome  nvs ()sDuaxmoot0open ocils mDemn s;u4areoif3tydfateaneils0t2uoxo3oodll n ivils) Drmxmont1oet iietasfm umnvp u)tlxnmocoy1oat  n o s)setrxopno1lpee iesls  2rm(roou0oeeo octld mDum(mp ()arerifcio1om  lues s0teum(mpoy1lmtn nct () rrmur ou0ope  i3iad sDranmp t)alermf3iy1latr u i;s  2tmxmpoydap   fcsa(farrau  ou0apen i3iltls uluvont)aeenxf oy1lm r i s;( trtoio no4lp  mneil( sDraxro;t1oexn icildlm rmn p;(0aeermf oa1fptrai ilt) 2tr(o3iu1ap   nciat  2uau p;u1oexoiociasla emumont0artrmf3iotfmD auvilt trxo(m oo1lmtn net (faDurumpou1oeen ieiltlmDea( ont4trermo3oatlmteai o;t)trurxm3ou4apeemncsat)a2ur(mo;o4aeen feilsfm emn onu0 eenmo3io1laDeaivi;s trtrir ou1lmte iciltf rrr(  no1oexo f3tld s rl(mont) lxrmf3tytlate u il( tetoir3ny1lpe lnetas)sDur(  nt0tpe  i3iasla emnmpn()aetnxo3iytla r nvi (0 etoxo3nydol elietlt)srra(  oo4alxnio3iytla rmn s (0 etoxo3oytlm eli olt0seuriopnu4omtelnei sfs2rrx o;u1tet miciaslmDemu p;u) leoiocty1fpDrluesls0s2umxm3nu1optnlicta(fsrua(mono4opxoio3iltfaDua(vpn(0aeeoxf3oy1lpte ieolt)srto(mpiy1ape lfcils) Dtmx pno0tptn oeiaslm2ea( p u4 rxrxo ia1lptelues;t0trto(r3no1apt  ncia( arta(r ;u0alenmfeiadfa rm(vs t)tlerxrciatlmD auvilt) exrim3nudlpe lictlt srrr(rpno4oex mfctas m rluvs;u)aexrxo3tatoaDraivi;(0 rxo(m oodape  ieilt arra(mpnt1apto ociasla2uauvp;()tlxomf3todoa  lnvs;s)seurxopoy1lpe lnvs s)sDrru ooo0alx moetldfm2rln p () rxrio oo1fa raneil(0s2tmxo oy4am   fcsl() Drrum ;o1oltoio3iys m2rmu sn(0 exoxfciytomD aivo;s0 ruoxrpiu4apenlfcsasfaDrmxmpou0tpt  fctytfa2um(mp t) rxrio oy1oaD auvi () rxrxr3no4am elictas)aDuax o;t1apt  i3tytfaDeauvsnu)tlxnmo oydopDelueslt0 exm(r iydlpe  fetlsfs2rrx poo4optoiociadfm2umums;()artrxr tytlpDe ivs (0s2xrxm3ou4om   fcslt aDum( o;t0oeenii3iadfmDuln on(0trtnxfcoa1lp eli il( srtrxm3no4ole  nesa(f 2umxrp;o0tee mo3iys mDuluvo;u0tlerxocoo1lmteaueil(0srumir oy4lp nmncil(  Drr(mpot1tpe  oetlt a umnvpnu) eeoxfctytoaDraivils0t2urxrpou4open nei tfsrtr(mo;u1tpt  ieiyslsDrl(vo;(0 reoxr3iodomD  n o;( s2xmim nu4om nmfet s  2um(r oo4oeeoio3iytlaDulnvo (0 etoxf iytla  li olt)s2trxo no4apt  ncilt)arrmu  ;t1tlx  i3ild m uan p u) etnxo3oatfpDranvs;(0 rxmxo ou4lltnmnetl()artmxm nu1opxnmoctyt sDeln s u0trenxf tydlpD ai s t)sexoxr io4lmtemnvs tfa2rrx oou0tex moeildfmDea(mo t)tleoif3iodlpDe ueo ()t2xo(m3nudol nlncs ( aDrm( oot4oet  ieiltfs rmuvsnu4aetnmfciadlmteaueo;s0 exo(rpnu4olte net t s2taur no4tlt ioeiadlmDel(vs;u0trxoxrcto1fa eai s (  rxrxr3no4ome lictl( s2ra(m ;u4tpenii3ilsls rlnmont4tlenif3oatfp raiei;(0sexo(o oydll elietatfaDum(mooo1teenmiciytfa2umump t4areoir3ia1omtr ivol(  rxo(o oy1opt mnvia(faDur(mpno1olen feiadfm2ulnmsnu4alenmf iotfp e uei s srxoxo3iydam   ictasf 2umxro;o0oleomf3ild m2uanvp u0aexnifcoo1oaD lies;s0s2tmio3oodlm nlfvi s aDur(ro;u1ale iiciydlaDulnvp u4aetnxf ia1fptraneslt trxoimpnu4lmtnlfcsl(faDrm(rp;t4oexnmociadla ea(vs;(0trtnxr3oo1opteaues;t  2xr(rpny4ll nmfvtat)s2raxrooo0ape  octlsls umnvp t0tlermf3iytfp eau o t)trtr(rpoodoptnmiesa()sDururpno1ale if3ils a ulnmonu0 exoif ootoptelu ols  2xr(opny4altn fvi tf Durxmp;u1tetnioeiadlsDrlnvsnt0tlxnmfcoo1oa   nes (0 eurxr nu1amt licslt srum( pou1apx  o3iatfa eln s ()arxnio tytla elieo s sexrio3oy1lm  mnvi sfa2rmur ou1apen ictytfm2ua(vsn(4 lxrirciytlmDraiei s0 2xr(opio1lpe mieiltf Dtmu  ou4oltnmfetltlsDelumpnt4aeenxr oa1lmteli o;t s2ur(rpio1lmt  fetl() Dta(mpoo0tpt  i3iyd sDrmu snu) ltnmoctadfm rlnesls s2uoxm3ny1omeelnciltfs2uaurpot1tltoiiciadlsDean s t)aexrirciotoaDe uesls0truoio iy4aptn ietlsf 2raxrooo4oetnifciytlaDeauvs;u)texrxo tytfaDr ueols0 2uo(rpno1llt  fct s)artax p;t4opxnifetasfm2elu pnt0altrxo3io1oa  an o;t  2xoiopiu1lmteliesat aDrrxmo;t0teto i3tytla emu s;()trxnio3iytfmt  nvs () rum(r3iu1opt  ieilsfsrta(  nt1apt  icildlmDuan s t4alxrmocoa1fa eai s ()tetrimpno1op nmivsas aruaxmpou4alenmfetldlm eluvon() lerxf3io1lm rlu i t0t2xrxrpnu4lm nmnesls) 2uaxmont1oeenmoeildfaDuluvp;()alxrmf3iotlaDeluvi t) etmxr ny1ap elfcia(  Drrumpno0tlt  ietldla2umn snt)aetrif3iytopDeln s;(  2toxopny1lle mfeilt s2tm( pot1alxnioctasfsDrmn o (4tlxnxo to1omDr ivi;t0trtmxo3nu1ll  mnci s)srtru  ;u4aetniietyd a2ea(vont4 renxr3iatfmteauei (0 euriopoudlm e fesat) 2rru  nu4opt  o3tyslm2rmnmp;u4 exomo tydomDrln i;s  2xm(m ny1am e iviltf rur(  ;u4olenio3iltfs ea(mp;u4 lxnmrciodfp ean o t s2xr(m3oy4ll emnes ( sDtmu  nt4alt ioetld mDranvs;t)tltrxf3ty1faD  nes s0trurim3io1lmtnmfctas artaxr nt1olx iiciadlsDem( onu0teerif3ootfmt aies s)teumim3oo1opte ncsl( sDrr( ooo0oex ifeildfm2rl( o u0 reoif todlat lueo;(0teur(opnu4lltnlivsas)s2trxmoou4tpxnifeild mDuaums;t)arxriociodfa eli o (0trur(mpny1alenmneiltfsrumxro;o1alt  i3iytla2umnmp t)artoircoatfmteaivo;s setrxr3iy1am eliei (f Dumx  ou4aeto oeiyt s2ea(vpnu)aetnxocootom   uvs;t)s2trxo3io4om  mfci t  Draumpno4oex mfeild aDuan o (0altrmf ty1lat  iei s truoxm io4op  licta(  2urx pot4olxoii3iaslmDemuvs () lerxoctotom eln slt  eur(r3nu1ap e fetatf 2rmumpou1aptnmfctlsfa rl( p u4aeeomfciytopt au ols sexmim3oy1lpe mncia()sDra(ronu4aex ioctlslsDea(vp t4trtnmfcio1oa  an i t0sexrxopnudlptnliet sf rrrumpot4tptnmoeildlmDemnvon(0 rtrmo3todla  an ol()t2tr(r nu4amen fcs tfa2uau  oo0opxn feiad s2ra(msnu0tlxnxr3ootoa ean i s0trumxopiudole  ietls srrru o;o4opxn o3tlt sDelu pn()arerifcoy1lmD  ueols0 2ur(m iu4omtelies sfa2tauroot1olt  octatfs ul(vp;u0aleoxoctytoa  luvo;s)t2urxmpiy1alen ics tfartr(rp;u1alt iieiysfaDel(mp;u0aetnio3iatom rau o;t0t2uoir3oodoptnmiesasfs2raumpnu4oeeomf3tatfmDel(ms t0tetrmo3iy1op  lieo;(0 ruoiopoo4lmt  ncia(faDrm(mp;t0altniictat m rmumon(0 leomf oytlatr n s;() euoxr3ny4aptn nvt s sDrmx  ;u0olenmoetls m2ua(ms;(4trxrxf3iadlpteli i;s)trtrxo ny1altn fctasf Dumx  ;u4apt moeiat a2umuvs (0areoio3iy1fpDeai slt trtm(r3iy4opt lnesasfsrrrxr ;u0ale ifciat aDem(mont)tlxnmf3oo1lmte nei s teum(o3io4ap  mfesa( a2raumoou4alx  fetytlm2ranvo;u4tleoif iytfateauvi t s2uoir nodome livtas) 2trx o;t4alt mf3iasfaDumu snt)tlxoif totom ran s (0s2tmiopny4lmtn fvi sf 2rm(mo;u0apto fetls s2rmu o u4trenir3oo1fm  li o;(  rtoxr3iy4omt mnvtl( s2rau p;u1altn f3tldfmDrmnvsnt4 lenio3ootlat  nvi t)t2trxr3io4lptnlietls a2uax p;u1apt ioeiad sDem(vont4artrxr3iotfptrlu olt srurirpno4omt lneta(fartm(ro;u4ole  f3tysfs2rmums;t)alenio3totlpDe u sls  euoim3iudlp nmfvsl(  Drmur ou0apxnmoetatfa elnmp u0trtoxr tadfa  lueolt t2um(m iodomee fetls)a2rm(mp;u4ole ii3iatfmDra(vo;(4trxnxo ty1fmDeluvs;()s2xmxm ny4opt  nct ( s2rrxr ou0olen feiyslm rauvo;(0aexoircty1lpD ln i s  rxo(mpiu4ale mnetas) Draxmoou1oexo ieiytlsDran onu)aeenxrcoytop e u ilt0teurxr3io1ole mfvi sfsruru  ;t0apt  i3iatlsDua(msnt4aetrio oa1optelnvolt s2xmxo3nu4lleemfes () Durur no1tleoiiciatlaDeln p;t4 leoir3oytlate uei;s0 2xmxopno1lptelieilsfaDumxmoot1texnmfcildfs rlnvs ()tltnmo tatoa e n s t srxoxopoy1al nmieta(  Dtr( ono1oeenioeiltla uau p (0arermrciy1fptelu s ()s2toxm oydamtemiciat)a2raxro;t1oexoif3iat s ulnvs;u)texomo to1fmD lneo;t srtrxrpiu1op emietatfartaxr ;o1opeomi3tlslmDrluvp;()tltoif iadoptraneo s)srxr(m3iydlm nmnctls aDraump;u1aetniictat aDem( snu4teerxr todfa rauvol(  rurxm iodalte ici tfsrtmur ot4tltnmictls m2rlnvo;()tlxomo tydlpDr u o (  etr(o oodolenlieils)s2rru poo1tet iiciyd m uan s t4aeeomfciatoptr n il(0t2trirpnodopt mnvt t)aDra(rpou0aeenifctytla2rmumpnt) etnmfctadlmDeanvi s  rtoim iu1amtemfcilt aDrrurpot4altomfeiysfs rl(vpnt) eeoifcto1omte nvo (0setmxm oodaptemneiat)sDuru  nt4texo f3iltlaDrmu pnt) etrif3iadfmDeli i s0srxmxr nu1lm nmnvs s sDrm(mp;o1alxomietatls ul( s;u)aeenxf3oydfpt lueo s)srur(rpoy4llt  fvi (f Duax poo0tpe  ieiyd s2ranvp (0alerircia1om e nei s  2ur(opnudapenmfcilsfartm(  ot0olxoifcilslaDea( pn()treomocta1fa eaivol()t2ur(o nu4alt  neias  2rrxmono4olxniociytlm2ranvo ()tetrxocoatfa raues s trtmio3no4ol  mnesat  Dta(moot1aex mf3ias s2uauvs;t0tetnmo3iytfa r ieils srtoimpoy1amtelfctl(fa2tr( ont1oleniictas m2uluvs;u4alxrmf iadoa r neo;t)s2uoir3oudolenmnvs t) rur( poo4ape if3iatfa ul(msn(0 eenmr oodlpt  i sl()t2uoxo3iu1llen icilt) rrr(m nu0aptnmfetyt mDrln o t0trenxr3oadfpD lnvs;(0srxrio nudal n nct t a2tmu  ;t4aeeo feild aDeaumon(0 rxomo tydop r uvilt  rto(o oy1omt mfcils)sDtmumpoo4tpxo o3tltfsDuln pn() lxrio oydlmt lu s t0 eurim ou1lpen nvilt srtmxr oo1oleo ocilsfm2ea( onu0 lerxrciotoa eau ols) 2trxrpoy4lp elfesa(fa2tr(r no4oeeomiciytfm eln o t4aleoif oytomD  nei;t)seuoim3io4lmenlivi (farur( poo4texnmoetldlmDrmn snu0arermr3iatoaDeau sls t2trxr ou1op e fesatfa2ua(ront4olt  iciyslaDelu o u4tlxnio oa1lpt liei t  euoxrpno1ol   nci s  Duax ont4altnmietadlsDrmuvsnt)trtoxo tadfpDelnvols  ruoirpno1amtelfct tfsruaxm nu1olx iiciatfmDua(mon(0 rxoxocoydfateluvsls srtrxm ou4om  mieilt artmur nt1aex iociys m2ulu on(0aexrirctotfmtrlueo t)tetmxopoo4ap nmies t a2umxm ou1oeeomfciadla2eau snt)teerif3oatlm   n s;t)sexm(o oy4ape mnvi t arurur ;o0tlenmoetls a rm( s ()aetoir io1op  au i t) euo(m3iu4om nlicilt)a2raur nu4tpxnmi3tasfm ul(ms;u0texrio3iadom ran i;s)srurxopiudomenmncsa(  2tmump;t1open f3iltla eauvo u0arxoxf3iatlaD  u i;t srxr(rpno1apenmictlt aDtr( oou0oexomfctasfs ua( snt4tlenif iotlp  lnvslt)texo(r nodalt  netlt) rurumonu1olt iociytlm eanmonu4trxriocto1oa ranvs t)teuoxr iy4lmee ivslt s2rmx ooo0aex iociydlmDranmont4aetoxr tatoptelieils0teuoio oo4lmenmnvi (f 2rmxmp;u4tle ioeiysfm2rm(mont)teeomo3oodfaDelu sl(0 rumimpiu4olee ies ( a2rruro;u0oee mo3iytfm2umn on(4alermr iatomDrau sls0 exmim nodap emfvi (f 2taxr oo0tex mf3iyt a umnmsnu) exrmf oodla elues;t)seum(o3oo1amt  iesl()sDumx p;u4teeoiictatfmDul(vo;u4texrxf3iodfa r nvo s)tetmimpiy1apen iei s)aDurxroot0tlxnmoetydlsDelump;(4altnxociy1lm  ai s t0seumir oo4ap nmfcsls s2umxro;u1oet  f3ildfaDrlu o;u4alxomrctotlat  ivs s0 2xmir3ou4llenlfes sf Durxm ot1tleo iciaslaDea(vsnu) rtrxr ia1fp eauvi;(  rxoxopio4oltelivs s) 2umu  ;o0tpeo i3tysla2ea(mo;t4aexrmf to1fmte iesl( s2xoir oy1lme mfvta(fsrrrxmp;t0apenmf3iadls ua(vp;() etomf iadoaDrlnvo t0t2xr(r nu4lptelnvt s aDrmxmo;o1tpxnifctys s2emn on(0 reoifcty1lateaieo;t0s2umim ou1ap emnvtat  Dtru ooo1oexnifciyslsDrl(mont)tltnxr todfm raies;(0srxoxr ou4olen iesat)sDrrumo;u0oet mi3iadls eau p;t)alenir3iytfaDrau i;t)s2to(r3iy1ll  mieias)arrrx p;t0apen oetyd mDuan p;u) lxnxocio1optran i;( t2uoio3iu4ll nlnvilt)a2rr( oot1aptomfciyt s uanvon(4 lenif3oy1om  lneil(0setrim3oydlm nlneilt  Dra(  ;o4alt ii3iytls elnmp;()teeomoctydopDr nes;t)trtmio3iy4aptn ivtlt)arra(r nu4ape iociytfmDua( p;t)alxnxf3oatlpDrlu o;s)s2xrxm ou4om e nvi s) 2rmum nu4tetnmo3taslm ranms;u4alxnmrctatoaDr uvs s0truoiopou1opt  ivsl(fsrumum ;o1aee  oeiltlaDrmn s u4aetomr3to1fmDr uei s0trtm(m3ny1olen fesls) 2um( pot4apeoifciys m ul(mp u4altrxf3iydfmDeau slt)s2uo(o3nudamen fcs s srrmur ;t1oee  o3tyd mDean p;u)alxnxr tydlm rln s t  etmio oy1ope mfvtl()sDrr( o;u1aet mfetld m elnmp;u)alxrxocta1omt aivilt0 exm(mpoudolenmfvilt a2ta(ro;t0ape ifctadfs ra(ms;t4tlxomo3io1lm rlivols0 rumiopou4apen fvil(f rururoou1alxomf3iasla2umnms;u)tlerxfctadlm rlues;()sexm(o no4lpt  fcslt) Dtaumono0optomoeias aDuan p (0trxriociytoat anvo;(  eurio iy1am  lfvs s)arta(r oo1olt  oeiyslm2uauvp () rxrir iotfatrln o t  rtmxr3nu4om elictl(f rur(mp;o1ole mf3ilsls rmumo u0artrxrcio1latrlneo ( trtmxr3oo4alt lnet ()aDurxmp;o4oet mieiatfa2ul(vs;() lxrio3iodfmD  ivo;s0s2trxr3iydoltelivtas) 2rr( pnu0tpenioctyd sDemnvon()alxoif oytlm eauvo;()s2xr(rpou4lpenlnvsat  2um(rpnu4alxnifetat aDul( ont0altoxo3iy1omD  nes t) 2tmxmpiodam  liei s srra(mont4aexn ieilt m2rmu p t4 rtrxr3oydlm e i ol(  euoxrpoodllen netlt) 2ta(rpno0tpt mfetyd sDelnmp;() eenio3ta1fpt  i sl(0 rxmimpoo1lptemfctatfsrrrurp;t4oexn i3iyd s em( p t0tlerif3iydlmtrluvi;()t2umiopoo4lp   icilsfa2raxrp;t1tet mociasfmDelnmo () exoxr3iy1fp rauvs s)t2xmxm ny1lpe  ics (faDuauroot1olt ioeiasls2rm(vp () eeoxr ia1omtraieo s) 2xr(m iy4lm  mfes (farurx o;u4alxniictasfs2ulu p ()tlermo3totoaDr uei;( t2tm(o3iy1lleelfcs () 2tr(r ;o1oeenii3tas a2emnvp (0 exoxf3oo1fmDeaneo s srxr(opiu1al e ncsa(fa2rrx p;t0aptn oeiltfm emuvsnt) leoxf totfmDe n o;(0 rum(opou1lp  livt ()sDraur ot4aptnmieiydls2emumo t) ltrxr3oo1oa   i slt  etoim iodlpenmici s)srurxr ;o0alxoiiciatls ulu o;(0artrmo iydfpte neo t0s2xmimpoudol  livils  2uaxr ;t0tetn fctld m2rlnmp;u4 renirctytlpt liei;s) 2toxr3oydlmteliesl()arrau p;t1ole mfciasls2umu s u4 rtoxf io1lmDraues;s srurim3oudamt mivsls aDraxm ;o0olt miciytls rln o;u0aexnio3io1fpD aieil()srtrxr iy4lme mics t)artr(ro;t4tpen ietasla em(ms;u4altnmr oa1lmDrau s t0teto(rpiu1omtnlicsas)sDrmu  ou0aexoii3ilsfa2umnvp;(4 rtnxo3oy1oaDr nvo s  2tr(mpnydamtnmivt tfs2urxrono4apeoifcilsfa ul(mon(4tleomrcta1oa  luei ()sexm(o iu1lme miesatfartr(rpoo1tptnmociatfsDulnvpnt)aexoir iodlm   iei;s0t2trio iu4ol emivslt aDtaurpnt1tlxn iciys s2em(vp;t0artnmo iy1fmte n ils0seuoio3io1am   netl( sDtrxrpou1ale ifetydfs rmnmo t)tlxoif3ootomtrai il(  exrxo3nu1omte iet ()s2uru oot0apeo f3iytlaDel(vp t0tetomo iodom eanvs;t0seumim nydap  mfci tfaDrm(mooo0oleomo3iadlm ea(msn(0trtoircoadom  lu sl( s2trxrpno4al e icil()srururoot1tleo octlt mDea( s (4trxoio oo1om rlues ()t2urxr3oy4olenlivs tfsDrmxront0olxo ictldfaDrluvpnt0tleoifciadomDe nvol(0t2to(r3oy1alt  ivsa(  Dururonu1olxomo3iydfaDua(vs;()aetoxo iydomtrlieo s) rumxo3oo1alenlictl(  2rrurpot0alt mi3iyd sDuluvp;t4trxoifcoy1opD aivs;( teumxr oo1ap elnvtls)arrmx  ou0olt  oeiytfa2ua(ms;t)trtrxocoodomDeanes;t seurio oo1alenmnetat)sDrmu  ;u1olt  fciat s eaums (4arermrcoatomD ln s t0srxr(opiu1olenmfvtls  rta(rp;u0apeomiciatlm2ean s (0 etrif oo1op eln s;(0t2umiopoo1alenmfcsas)aDumum ou1altomi3tls sDel(vs;t4tltrio3ta1lat an i;()trxoir3io1al   nvt ()sDrr(ronu4oeenmfetytfmDem( o;t4 ltomf oo1opt  nvi;s)texoxopiy1ap  mfcia()a2rr(r nt4altnmieiadfmDrmnvp;(4aexnio3iy1fa rliei t0s2trimpnydolenlneiatfa2rrum nu1aexomfciys m2rlnmpn(4aeeoxr3ootfm   uvo;s)trtrxo ou4llee nvilt) Dumumono4apxn oeils m ua( p t4trerxfcootoa  lnvols  eum(r3iodlpte nvsl(  2uaxmoou0apx  o3tydls2elnvonu4 reomf todom  livi;t0 eurxmpnu1oltnlfvt sf rrr(  ot1opxn ieiadfm2el( p;u0tlxnioctytlmtraieo s teuo(mpnu1omt lncil( arumxrpnu0teeomf3ils mDrlnvp u4arenio io1fpDrlnei;s trtoio io1ap elivt sf Dtrur ;t4alx mieiydfa ranvp t0 etrmo3iytfa ranei;s0 rur(r oydlm elivsat aDtmur ;u0tptnii3ils sDrm(msnt)aetoir ta1oateauei s  2xm(o io1omtn ict (f 2rm(r no1tee iiciasla emums t0 leoxrcootomteauvs t setrxrpio4lm n ieilt)srta( pno1aexoif3iad a rmnmo t4 reomf3iatoat lieo;s  2trxm oo1lp n neias)sDrmumono1olxomfciysla2ran s u4aetnmr todfm rlueo (0trxoirpoydllee nvsat) 2urxmpou4tetn i3tytls2ua(mpn(4 rerxo oo1fm elnes t0 2to(opiy4aleelivsls)sDrmuronu1oeenmiciad aDua(mo u0 lxrmoctatlp rlneo t)t2xoiopio4olt livia(  2raurpou0apx  oetys s elnvo;t4tleomo io1omtrauei;s0 2uo(mpiu4opee fctasfsrtrxr ;o1texnmfciasfa2el(mp t)trtrxf3oatfa eln ils setrim3oodom emnei ()s2rmxronu1oeen i3iasla ul(mo t4 rxoxfctatoat  ies;t0s2xmxo oy1am nmictlt  Duau  nt4alt mfetltla2ra( s;t0 rtoio3totoa r i o s)texrxmpiudol e iet t srraxr ;o4apeoiictlsfs eanms t4 exnirciotlmtelu o;( truoim nydlm  lfvs t)arur(rooo0alt  f3ild aDrlnmp;(0teeoif todlm  aies (  2umxr iudomenlfvtas) rumumo;t1aee if3ildfsDrln o ()aexomr todom eai s;s srxmir nydlptn neta()aDrax  ;u4alxomoetytlaDemu p;t0 renircoatfpt lu i (0 rtoirpou1lmen nct (fartr(m oo1aleo fetldls2ranvs t)altnxrciydfaDr i o;s s2xmim3ny1lpenlietl() 2tmx pno0ole  octysfs uanvp t) rxoio3todfa eai o;s)s2xmxo3iu1ll  mies tfsrrr(rono4aee mf3iat s2uanvont4texnmo io1fp r u o t0t2xr(o nudlptnlncsls arum(ront1tlx ifciatfm elu p;()teeoxf oydfp eluvs (  etoxm nu1apeemivi s s2ua(  nu4altn oeiad sDrlu pnt) rxrxrcoy1fpD anvo s0sruo(r iodole mnetasfsDtrumont0opt  o3ild mDrlu s;(4tleoxf ia1fatrauei s seurxmpiy4lleelnvi tfsrrr(rpno0aee mi3iys s ua( onu4tltoxr3io1opt  uvs;t truoxmpoydapenmnvs sfs2rrxroou1olen i3iasls2uanmont)arerxo3iy1lp raueo;t)t2trio3no4lm emfct tf Dum(mp;t0tex ioctlslaDulumonu)alxoio totlmt anes;s t2tmim oodole  netas arrrxroou4aleomiciadfsDemu pnu0tltrif iotfmte ieo;s t2uo(mpno1altnmfciltfsrur( pno4opxomfciltla2um( on(0tlxnxr oa1fmD lieo;s0setm(m3iy1lpenlivs s)s2rmur no0texo feiasfm2umu s t4alxrmfctadomDrlueil()setmirpno1lltnmnei ( sDumx pot4alx io3ias m elu s t) lxoxr3ty1fmDelneols)s2umimpio1al  lfviltfsrra(rpnt1olxomf3ildlm2elu sn(4teenxr3oydoa   u il() 2toxm3nydlm nlfci t)arrm( p;t0apt iiciytla elumo;(4 renxfcootomt luei t  etrxo iu4alee ici s s2umumpot4tle mf3tltfsDeanvo;u4arenmr3iytlmDe ivo;()trtmxr nodopenlfvt t)a2ra(  no4aleomi3tytla rm(ms t4aetoxo3iatfp rluvol(0s2urxo iu1opeemieia(faDrmu ooo1tlxniieilt aDrlumo;u0 lxnir iatlp rlivo ()trtoirpoydomtelfct sf 2tmuront0oltnmoeiltla uaump u) leoioctydoa raivs;(0setmio3nu1ope mietls) rumxrono0opeoifciys mDulums ()trtniociytop rauvo;()seur(r oy1lle mnvias)artax  nu1tpx  f3ild m2umn on(0aeeomf3tadoaD au o ()texrxmpoydol  micta(fs2umum ;o0oeeniictldlm2emumon(4 lenxoctotla e ueilt  exm(o3ny4alte nvta( aDtrxr ;o4opx mo3tatfs um( s u0tlenmrciydlm e nvolt)texrir3no4lm e ncils)artmu ooo1alx  ietldlmDeanvpnu4aetrir ia1fat ai o s t2urxmpiu1apenlfes tfa2ta(r ou1tpeo icildlmDea( o;(0tlxnircta1fm e i ol()tetm(r oy4ape lfetat)arurxm no0aptnmfctlt a2el( s;t0 exnmo tatfmD anvs t t2um(m oo4amenlnet ()s2taxmo;o4teenif3ilsfmDrm(vs;u)alenif tytfmDran ols0s2uo(m oy4apt miesl( a2um( o;o0olx  f3iasla ul(vo t)altnmr todlat lues (0s2umxmpoo1lptnlivi tf Drmx o;t4alt  feiasfaDemuvp u)aexrmf oytom e ivi;(0 ruoxr3oy1oleemnvslsf 2umu onu4aetnmfetyd sDrauvo;() lxrxf ta1la ranesl( s2to(o nodopt  nvtas) Dtruro;u4tlx mi3iat m2raump u) rtrxo3oo1lp elnei;s)trxriopiy1lp nlictltfsrumx p;u1oet mietasfa uanvsnu)trxrmr oydlate ueols) euo(mpoy1amte nesas  rua( o;u0tee ioeiadfaDua(monu0trermr3oytlpDe uvolt)s2tm(mpiodlp   neilt arum( o;t4openmicilsfmDrmu ont0 ltoir3oo1lat  ies (0trtoxo3oo1ll  mivtatf 2taur nt0optoiieildfa2uau s t0trermf3tatoatraneo t  2urxo iu4lm  mnctlsf rtrxrp;t0optnifeiasfsDuauvsnu)tlenxf iadom r n o s0 eumir3nudllt  ivsat a2um(ro;o4oex  feiydlmDumu o t4tleoiocia1oaDrln ils0texoxm no1ol  lnesat) rurxmoot1aex io3ilsla2rl(vs;(0 lxomoctytfate nvslt0trtrio oy4am emiet (fsrrau pou1apt mo3iadfs2rlump u)aeeoio3oodlp rai ols0s2urxo3oo4ope  fcias  rurx pnt0aptomi3tltlaDraumo (4aetomr oytfatrluvi t0 rxoxm ny4apt lnvias) Dtr(rp;t1tee  f3tasls2rm(mp;u)aexnxrcoytlptr neo;()s2xrio3oy4am   icils  2rrx  oo4optniietls m ra( s t4 exnmf3to1lpte u sl() euo(m3oo4aptnlnesls)srra(rp;o4tpt mfeiys mDum(mo;t) eenmf to1fpte uvs;t  etrio no1ameelfvtl( srur(mpnu1oet ifctydls rm(mpn(4tltrmo iotlp   ieols)s2urxopnydlleemnciatfsDum(  nt4olenmo3tas m ran p;(4tlxrmfctotfp e ueo;t0srtoir3iu4ale mnvt s a2trx  ou1apen fciasfsDra(von(4texnxo oa1faD  ueo;t)trtoir iu1lp  livtat)sDrm(rp;t0oexoiietasfs rl(mp;(4arxnxo to1la  au olt)trur(opio4llen nvsatf Dtax o;t4tpto ietadls eaumsn(0 lerxr ty1opD aieslt0 exmirpiy4op elfvt t sruax  ;t4tptoiieiat m ranvont) ltnmo iotoa elivo;(  2ur(r3no1lleelfcs sf Dum(rpno1olt mi3tldfa2umump (4aetrmrctytomD li i t0trxr(o3nydol   nvsls) rrr(rpot4olto ieiatfs umumo;t) ltnmo3iydomD li ol( srxmxo ny4ole liesl(faDtaxmpot1aeeomociltfmDemn s (0aeerxr3oydlp raivi ()texo(o ny1op nmfct tfa2urxm ;o4alxniicildfsDua(vo u0trtrxrcoydoa  lies () rtoxr iudap emivs (f Dtau  nt4aptoif3iltfaDelnvonu0 ltrxrctydfm eau o;t0trum(rpio4op  mfeilt sDua(  ;t0ape iietltfm2umnvs;(4 reomfcoa1late nvilt)trtoxm ou1al nlicia(  Dtrxmo;o1olxnioetyt m2elnms;t0alenir iytomD auvo ( s2um(mpiy4amte nctltfaDumumooo4tlxomictls mDem(mp ()alxnxr3iodlate u s;t0s2xrio nu4amt  fvtlt) Duru poo0tleoiocils s2uau pnt4teerir3iytlatran ils0 ruoir iydll e iesl() 2tr(  ;u0aexomfciysfm ulumon(4 lenmo3oo1fatrluvs;t) rumiopny1am n ncilsf Duaumoot0aptoii3iltfa2ea(monu) ltoif3oy1oaDeauvi;(  etrxo3ou1opeelnvils) 2tax poo4oet micildfs ean o (0 rxomr3oytfaDeaivols0 rum(r3no4lme liei (fartmxr nt0aex mo3iydlsDrl( s u)teeoxr3to1op rlnes;()s2uo(r3oudomt mfes s s2trxmono0oex  iciyslm eluvonu4teerir3iy1fpDranvi ( s2xrxrpiydol  mfes (  rta(rpot0tptomfciydfa ea( s (4 ltnio3iodlmtelieols t2xrxmpny4lpe mnet s)srrm(monu1tee moetasfsDem( pnu0 rermo3oodomteaieslt0s2uoimpoy1aleemnci t  rtru  nu4tet  i3iaslm uln s t4texrmrciatoaD liei;() rxmxr no4opte ics () rraxrpoo0opt mf3iat mDuauvsnt4 rerxf3todfpD lnvsl()teumio oudaltnmfcia(  rrm(rp;t0oeeomictltfs rl( p;(4 exnmr3iytfmDrai o s) 2xoxm ou1op nlieslsfsrtr(rpnt0olen iciltla rl( s t4trtnir3oa1omtraiei;s0trtmxo3nydlmte fci (f Duaurpnt1aptomoctltfaDua(monu0trxrmr ootopDrlneil( trtmimpiy1lpe lfeia()srurxrpoo4tpto i3ilslaDraumsnt4 renmr iadlmtrli il() rurimpny1lpte icil(f rumxront4aeen octat m2em(vo t)aleomfcto1oa ran i s  exoxrpnydlm nmieilt) rrr(ront4alen ieiltfmDrl(mo t4tetrmr3oatoptr u s s)srxrim3iudlpe  feiatfaDtm(mpnu0teen i3iatlm2umnvpnu4 rxrxrctotlpte i il()srto(m oo1lle mivi t  2tr(m nu0altoifciltls rm( pnt0aleoio to1faDe i o ()setrxr3oy1oleemfetl() rumxrpot1oee iietls mDra( on()aeenmr oydoatr uvo s sruoxo nu1lm n nvs s)s2rax pnu0apt mo3iys mDrlu p;(4 ltnif oydlp ranesl(0s2xrxm nu1am   nctas) rrm(moot4aetn ieiytfa ra(mp t)tlxrmf tatlp rlnvs () rxmir iu1ap emiesat  2rm(m ;o0aexomi3iltfa2ulumsnu0 eeoxo tatlate nes;t0t2tr(m ny1ap emfvsat aDtr( p;u4aex  o3ildfm2elumsnu4 exnmrctodom rln s (0trxmio ny4oltnlncsa() Drrxmpoo4openiietldls uan p () lxrxfciatlmDr uvo t  etmxr oo4al emfvslsfsrra(moou4tpxnioctytfmDrlnmpnt4 reomr3to1fa raneo;t srumxmpno1lm emicsa(fs2raxmonu4alxnmf3tat s eluvo u)arenmrciodom eln i ( texoiopoy4ap elfvsat sDurxr ;t1altomfeiltfm2ulnmonu) etnif3tydoatelivslt)sruoir oodll   ici (  rra(rpnt1tptoiicildfsDuanvs (4treoio3totoaDe n o t)trtmxrpiu4ol e nvs (faDum(r ;u0apt  octytlsDemn o;() lermf3todfpteln o;t0 rxr(opoy4apt lnviat) rrmumooo1aex ii3tysfm ul( onu0 rxrio iy1omD  uvi;t)trtm(m3no1lp   nvsls)aDuaumont4tleomo3ilslm2ua(vo;t4aexnxf oadopt lu s;(0srtmxr3io4ome mnct t srtm(  nu0tlxnioctydfs emn o;u)trtrmo3oadop ran sl( t2toxm nodopen nvi t  rtmu o;t1tleoioctatlaDrlumo;u0alenxo3oo1fat  nvols)t2toir oo1ap  mnct s aDrmxm ;o1olxomf3tytls2rlnmp () etnircoatlaDe ivi;( sexoxr ou1ope mivtas s2umx  no0aeto f3tys s eauvo;t)alxoiocia1lpte ueo;t)t2xoxo ny4op elnesltf 2raxrp;u0alxnii3iltfm2rm(mp ()aetoir3oydlm rau i;s texrirpnudom elietlt  2tm(m oo0oleoio3iadfm umn p;t0alxnir oa1lpD anvi s0 rxoir3no4ll elnei s s2trur ou1opxn oeildfm2ean s;t)arenxocia1fmDrln o (  exm(r3nydom  miei t)s2raum nt4oeen oetys m raumsn() rerxf iytfpt luvo t)trtoxo3oydopte fet ()aDuaxr nt4tlt ifeiaslsDumn o;t) rxrio tydlmDrlnes;()sexmxm3oudllt  nciat)a2ra(  no4oet  octld s2ua(mpnt4 lerir oo1faDe u s;t sexoio oo4olt  ivsas  Dtrur ;o0opxo oeiadls2ua(mo t4altrxo3oo1oaDe n il()s2xr(rpoudom elnctas)srurxr ;u4opxo iciadls2rm(mon(4altoifcta1omtraivs s0sexr(m iy4alte nciat sDuru  no0tpenio3iltla emnvp;() rermfcoo1lp elivs;(  2urxrpoo1amenlnct t)s2rrx o;u4ape moeilt m ua(mont0trxoxocootfm rlnei s  2xoxr3iy1alt lncsls)sDur(rpoo0oetn fciys sDrluvp;t)tetnxfcta1la eauvo;s0seuoxo oudope  iei t arraur ;u1teeoiocilsfs2ul(vpnu4tetoxfcoytfat  u o s t2tmio3nu4ome  nesas) ruaumo;t1tpto fctat m2uan sn()aeenifcoatlaDelneolt0 rumxo3io1optelfeilt)aDrrump;t4teenmociasfsDelu snt0aexrir3to1lpteaivils) 2tm(m oy1ap   ncsat)arrmxmpnu4alxo i3ilt m ua(vp;u) lxomo ootop  li o;s) 2umir nodlpe lncsls  rtaxrono4teeoifeiadfa rmuvp (0 rxrxfciadlmDr nvslt t2trxr3iodol e nesltf Drr(rpoo4alx  i3ild m ul(mo;u0alerir totoptraneo s0t2urxm3iu4alt lfvt (f 2urx ono1tpto oeiytlmDul(vonu) lerxrciotfmt anei (0sexrimpou4ole lncs (  rumur oo0tlxoifciadfs ea(mo;u0teerxfcto1lp   nes;t0 eumiopiodap  licta( sDtm(  ;t4apxnif3iadlsDul(von(0teeomf iatlmtrai sl()s2xoxr3iydlpenmnes ()artaum ot1opxo octlt aDum(vo;t4 exoxf to1lm eliei;t)texoio3iy1lltn nctat)sDtrx  ou0teen ictatlmDemump u)arenxf3to1oaD  n o;s0s2um(rpnudapt  ncil(f 2umxm ot1oet  iciyt sDea(vs t)tetoifciy1op e ivo;t0t2uo(o nu4altnmncs ( a2rrx p;t4open octytlm2elumpn(0tetomfcoytfmD luvs ( tetoxm3no1lpe lics sfs2uau pnt0altnmieiyd a2rm( s t0tlenmf oodoptrlu o t0 2xmxmpou1oltnmicias srtaxmono0aptnmietls sDulumpnu)texnmo ootfa r i o (0trtr(mpoydam emfvsa(f rum(r no0ape iieiadfaDumu s;u4arenxociodfp ranes () 2to(m3iy1op elnetl( a2tmu ooo0altn oetytlsDem(mpnu4teerif3tadfateai o t0trxmim oy1lmtelfcslt)artrx oou4ope ioctyd m emu p u0aetnifctatoatraneols seumxrpnudllenmnesa()a2urxrpot1tet  i3ilt m emnvp u0artrif iatfptean o s  rtmxo nu4ape lfvsl(f 2uru  nt0aptnioctat a2ua(vo;u0teenmocoatopDelnvo;s0srtrxr3oy4olt lfcs (fa2tmxrpou4olt ifctldls rm(mp (4 ltrxfcoodfm eaueo s setrxr3io4lpe lfvi tfaDtrx pot1apx mieiatfa umumont) etnmo tydlatr ues t)seuoxr iudom emfetat s2tmu  ou1tpenii3tlt s2rmumpnt0 lxrmf ta1fate ieo;s) exmxr no1lmtnlfetat)aDuax pno1tpeoii3iytfm rmu o;u0 exnio3ty1fpt li i s0 exr(m nu4om emiet t s2trx pnu4texo ictlsfaDrmn snu4texnmf3oy1fm  lu olt  euo(mpio4ol nmnvi t) Dtru p;o4alxnii3tyd m2um(mo ()aeerirctotfa raieols0srur(r oy1al nlfctat s2urumont1texomieilsls emnms;t4artnxo3oy1fmtr i s;s0 euoxo3nu1oltnmnes tfa2rm(mo;t1opt ioeiydlmDulnvs t4 etoio to1oa rln o;()t2um(m3nu4lpe mfcilt srrmump;o4teeoifciys s elnvo t0tltrio3totlat  uvs;()teto(m3iydapte nctl()srrrxm nt4opxo ictad m umn s u4 lenio tytfpDeanvo;s0trxmxm3nu4lle  icilt)s2ur(r no4aexo f3tatfmDul(ms ()tltnxr oo1omte i ilt t2tmxrpnu4olte ict s s2tmxrp;u0texn f3ilslsDrl( pn(4aeenmo3ia1lm r ieol()tetmio3ou1lpe  fetat)srtm(m nt1tet  ieiydfmDul(mont4aexoifciadlm e nvo t s2tmxm nu1ale  ieta(fs2um(ro;t0tpt  fctlsla2emu s ()tleoxr iatomtr i ilt srur(mpoo1om nliet t)s2uaxro;u0alxn iciydfa ua(vp;t0tlenmfciadfp eluvi ( s2xm(opio1opeemfcsatfsrtr( p;t4tex mi3tad a2eluvp;t4arxrmo3tytfa ranei (0trtrim3no4aleelics t  rta(r ou0tlxnmfetys sDum(vsnu0trtomf tytlm elnvi s)srtoir3io1optemfesls) Dumum nu4tlt ioeiydlm rl(vsnu0 leoxr3iatla r i i;t)t2tmxo io1lm  lnvsat) Drau poo1texnif3iytfm2elnmo;u) rermf oodopDrlueo s0trxm(o io4omtn ivils  2tmu o;o1aetomo3iyd mDum(ms (0altrir oydfa rauvi;() etoim nu1apen neilsfa2um( pot1aexoio3ilsls2rmump;t4tleoxo iodoate nvils sexrio3oo1lleemnciasfaDrmx ont4oltomi3tlt aDuau s ()aeeoircoa1lm   ivols trurxo3iodomeemfvt s a2umxmpoo1olx mieias mDulnms u0trtnmf3oadlm r u s;t0srum(rpoo1lltn nvs t s2raxr no4tle ifctadlm emu p ()alxnio tytfmDr uei;t0 rtriopnydomt mfvta(  2rmxroou0ape  o3tyt a2umnms () ltnmo oy1opDr i i;()teur(r3iodal e ncsas srrrx pnt0olt miciydlsDelnmo;u) rtnxr3oa1latrlu olt0sruoxm3ny4opeemnvt ( sDta(r nt4tltniietlsfm emuvp t0tltomocto1fateaneilt t2xm(m3iydape miesls srumxm ot1tet io3iaslm2umu snt4 lenxocootfpt li s;()truoio3oodlpee nvil()sDrr(rooo0tet mfeias mDel( o;t4tlxomfctadlpDrai i;t0s2xmio3ny4al  lnes sfsrrm(mont0oltoiociltlmDuaumo;u) rtomr3ia1fmD lueol(0 rtmxo iydlmeemiesls)a2tm(ro;t1tlt mo3iytfaDem(vp;t)alxnmf todoaD liei s  2uo(m iodame mfvia( s2raur ;u4teeoif3iltfs ua(mp (0trtomr3iatop r neo t seurimpnodlpe mfcs s  ruru pou4opt mi3ildls2ulnvsnt0arxomoctadlm e ivsl(  2tm(rpno4lme mnvtatf rra(r oo1opeo oetys s elnvo;(0trerxrcoodomDraieo;( sexoimpno1lpt  fet t  2umx ooo4olt miciys m ua(ms;t4trtrmrcoa1opDeaivo;t seur(r nu1ome  nvtas  2rauro;o1aleomo3tatfs rmnvsnu)arxomf io1fa e ueo t) etrio3ny4olee nciltfa2tmx ont4apenmieild s ulumonu)alxnxf3iydfat  n i;s0teuoxopnudal emfcil( a2tm( p;t4ale ioetadfa ean p;(4tetoio3oadopDeliesls)trtoiopnu4omeemivt t arraxr ;o4tpt iietatlaDumnvpnu)aetnxocoa1latrlneo t  2triopiu1lle  ivsl( srtrumoou0olxn f3tasfa rmu s;t4aeenir oodfmtr n ols) rtm(o oo1aleelici tf Durx  ;u4tpxn oetys a umn pnt0arxrmfcta1laDr u i ()s2xmirpoo4oltn nvsat)sruaurono1tex  o3iadla2ul( o u)tleoxr3tadlaDraues ( trumxmpny1al nlfetls)artaumonu1texnmicild a el(vo;u) etomr tadfmteauvol(  rumxmpoodlleemieilsf rtm( ono4apxo i3iasla um( s;u)alxomociodfm r nvsl(0sexoxr ny4ol elictl()s2rrxr ;t4tpt  ictys a uau o t)trxomo iy1lp ean o t)s2xmio ny4altn nctls)a2ua( pnu0aeeo fctatfa2emu snu4 rtomoctydlm   ivs t srtoxmpiydlm  lnvtat sDtrump;o1ope io3iaslaDuan s;u)tlxoiociytlp e nei;( s2xoxm io1omeelnctlt)s2uax  ;u1tlxnmoetlt aDeanvp;u0aleomrciadfp  lieo s) eum(r3iydlmt mieil()sDrrx oou4apt  ieiatfm2emums (4 rxnioctydlaD  nes () rxrir iudlp e nvtas s2rmumont0oeenmicild mDea(vs ()alxnmocootoaDe n il() rtrirpny1lp nlneta(fsDururpno0tpxo ociys aDeau snt4alenmr3ootlpDeai s;s0setrxrpoydamt mfci (  2tax ono0ale  o3iatfa uan on(0artrxo ia1oa   ivo;()sexo(m3iu4lltn fvi s s2rm(mpot0apxnmf3tatlm rln onu)altrirctadfat livi;s  euoiopoo4aptelfvslt  2tr(mp;o0optnmietyslm ra(vsn()trxoxf oatlmD lu i s0trxoir3iy1apen nvt t)sDrr(m oo1aetn feiytfs2el(ms t4 exrxo totfmtelnvilt0texrimpny1om emfes s)arua(rpoo1tleomieiat s umnvp t0 eeomfciy1faDranvi t)trtrxo3oo1olenmivils)arrrx  ;o0aet ifetldlm uau o;u)aeenif iatopDe neilt0trur(opiy4ol nlnesat  2rmxrooo4teeoioeias s2ul(mo t)arxoir ootlp raueilt  2triopnydam nlfei s  2ta(mpnt0apxnio3iydlmDum( o t4arxnmoctadfp   u s t0 2uoxo iudame  ictl(fa2ta(rp;t4optoiociaslm ra( s;t) eerxfctatfaD  i ilt0sexmirpiy1lm  lncsl() rurx  ;o4aee ioetad s2um( snu0trenif tydlateli i;s)t2uo(o3iy4amtelnci t)a2rmu o;o0tptnio3tatla umnms;u0 ltrio iytlpDrai il( truoxrpoydlltnmivilsfsrumur ou1teto i3tydlm2el(vont0trtomo todfptrluvol(0t2um(r oydlptelfct sfa2urxmo;t4aexoioctyt aDum(vont0tetrxr ta1fm e u sls0srum(rpio1ol n iet (  Dumxm ;u1apx mo3iadla ea( pnu0tlxomf3iotfmDraueo;()s2umio nu4ale
\ No newline at end of file
@@ -0,0 +1 @@
+ieo (0 rtr(m3nudlpt  ieta() rrm(moot4ale ii3iltfm2el(vp t)artomr ty1oat aieo t)tetmxo oo1ol nmnci s)arumu p;u4tlx mi3iltfaDemumpn()altnmf oa1latean sl()tetoio3iu4aleemivt (fsrum( pou1tet  feiadlmDul(msnu) rerxocootlatr uei t srxmxopio4aptnlnei t)s2rm(mpou4tlto f3iltfaDuan p u)treoxoctotoa r ivs;t s2xrir3no4amenmncs t s2umxmooo4aee ii3iadfs em(vs t)trtoir3ia1fpDe i o;s sexmxm iu1ol n nciatfaDur( p;o1tlt  ictat s2em(msnt0 rxrircoodomD auei s t2toir3nodope lnvsas s2tmxmonu0aetn oetasfm2rl( o t4 reomo oydlmDeaivs t) 2um(rpiudopenmivslt artmxmp;o0alxo f3ildla ua(vo;(4aexomr oy1omDe nvs ()t2toirpiu1omtnlivilt)sDtaxr ot4oleo oeiyslmDua(mo;u4 ltrxr iadla r nes;s  etmio nodome  ivtatfs2um(rpnu4teen o3tys mDulnmo t4tlxoircto1fpteaies t0 2xr(o iu4llee iesa() ruax p;t1tlenifeiaslm umuvs (4tlxoxf oatlp e ivs (0srxo(rpoy1lm nliesat  2um(mpnu4aexn fctltfa em(mont)trxoifctodoateln o s0sexoxo iodlpt  neta( sDumum ot1apx iociyt m2rmuvp u0 leomr totfptraues;( teumim3oo1lmenmiei (f 2urump;t4alenmo3tlsfmDrl(vp u4trtnioctotfmDranei (0texoxr3ny4opte fvilt) 2ur( onu0altnifciasfsDraump u)artrif tydlmDelu i s0t2um(o oo4lp  mncsat)s2umxm ;u0teen i3iasfaDemn snu0 rxnmr3todopt lueolt  2xr(o no4al  livsltf 2um(ro;t1aee mietydlsDrmuvs t4 lxomf oodlp  aivsl( t2xoim3iy4ol e neiasfartau ooo0aleoiiciltfaDemu sn(0 rxrxrcto1laDr nvolt)seuoxm io4omeelieiat s2tmxrpoo4tpx  o3tys a2ulnvp (0tetnir to1la ean o s)t2xmim3iy1altnlnvs s srumu  nu1oex  o3iyt s2rm(msnu)aetniociatlaDr ivi t srxmiopnodop elfeta( aruaxronu1tpen ocilslsDrmn s t0 ltrxf3todlmDraieslt)t2toxm3oy4lpe lnesa(fsDta( onu0optoif3tldlaDua(ms t4 rtrmociotom   nes;t texm(opoo4am emnvs tfa2rmumpou0oeen octldla rluvpnt)teerxfcia1omteanvs;(0t2uoxm iu1amtnmnctlt a2trx  no1oee mo3iytfmDrm(msnt) rxrxo ia1opDe nvo (0trxoirpoydlmeemfesl()srrrurpno1tpeoiocilsfaDrmums;t0aetrmr tytfa e ivi () exo(m oy1lptnlnesas arrm(mpnu4tpxoio3iytfm ranmo;u4tltrxrcty1opt lueils0trtm(m oudopenmncsas) rrau o;t0teenmfetydlmDelumo;t0tlerxo tydlmt lneol(0setrxo3iu1opt  fes s) 2ua( pou4oltn o3iltls2ea(mp () rtnmr tydlmteanvi (0 rto(m3nu1ame mnvt (  rur(rono4ape mi3iadfsDraump (0arxoxo3oa1oa eaivs s  rtoim3nydol   nvilt) Drm(ronu4opt  f3iys mDum(vs u0trxrmr3ta1lp e n sl() rxm(m io1al  mneslt)s2ra(rooo0oleo i3taslaDrmuvo;u) eenxf3oa1fm eaiei;( setrirpnu1ap emicilt  2tr(  ou4opeoioctasfs umn p;t)artnmo3oadopD aivs;s  rtoir3ou4llte fvta(f 2um(ront0tetnmo3tltlm2rl( sn(4 etrmo io1la e uvils  2xrio io4optnmnesas)artru  ou4tpeo o3tysfs2uanvo;(4texoxr3tytopDrln o s  2trxr3oy1omenliei ( sruru pno4olxnmoetlt s2raump t4aeeomfciatlmtelues;s)teuoir3oudlmtnlncilsf rtr(  ;u1tlto iciytlmDumuvo;u4trxnmf3iadlm elivi t0seuriopio4amenmfvtat) rta(mpou0texnmf3ilsfa2uaumon() rxrmocoydoaD lueo;( t2uo(r3oodomtn fetl()s2ururpot0aleniietys s rluvp;(0arerir to1omt  ies;s  2xrxrpoudlp emictltfaDuaum ;u0teeomictlt s2ran pnu0artrxfcoadla e nvs (0trurir no1ll nmnei (  2taxro;u1teeo o3tydfmDumu snu)texrif iy1fate uei t) 2urir3io4lle mneta( srrm(ro;t1apt  i3ild a2eanmon(0areoxo ta1fpt  ies t teum(mpio4amenmicia( a2trxm ou0apeoiictas sDrln o;t) eenio ia1fmte i ils texmir ou4al emfvs s  2trxr nu4olto ociltls2rmumpnu) reomo3tytlaDeln ols) rxmxo3ny1oleemfei () 2taurp;o0opxn f3iatfa2ulums t0 rtomo tatlmt li il()t2urxrpiy4apte fetas a2tr(rpot1altoiietas sDumnmo;u4altoiocta1lm  lu i;s  eurxopoy1ome lnctl( sDraxmooo1teenmo3ildla rmu o t4 exrmo oytfp e i ol(  euoxopoudlpen iei s)arrau  oo1opx if3iat m2uanmon(4aeenxocoodoa elnes;t  eum(r io4lmt miet t  2ra( p;t1apx ioetadfa2ra(vs (0 reomf3iatfaDeanes ()s2xoim3oudolte ncs t)sDuax o;o1tle ifctys a ea(vp;(0altoiocoadlmDr i olt truoxopiodape miviat) 2rm(mpot1tle ifcilslmDul(vp;(4aeenio oy1faDraies t)tetmxo iy1amt miesatf rua(m ou0tlx ifctaslsDemuvonu0tetoirctotoatr i s s0trumxopnu4alt lnes s sDumurpou1altnmietas a umuvp (0trermf3ty1fmte neols t2xmio iy4lm nmnesa()sDur(rpoo0aet  f3iytfmDea( p;u4aetrmf iadlpD an i t  2umimpiodapte iei tfsDtruro;o1tpxo fetatls rln o t4texrmr3totom  lieols texoxrpoo1ll elivilsf rurx  ;o1aeen ieiasfs umnvp;(0aexrxociotla rlneo;s sexmir3oydop nlnvtls  Dtr(  nu1openmi3iltla2el(vo u0texrxr tydopDrauvol(0s2xoio ny1alenmivsatfa2rrxmpno4tetnmicilsfaDumuvp u)arenir totlm e ivil( srtmio3iydome  fvs ( srur(m no4olx  fciasfs2ean pnu0altnxr iodlpDelieo;t t2tmiopno4lp nliei s)aDtrx o;t1oexoio3tytfs uanvsnu4trtrxrciytoptrln sl(0trtm(o3oo4olte fcs (f ruaum ;u0tpenioctysfa2ra(mo;()teenxrciadfa e ivi t0 2um(m nudlm   ncils a2ta(mo;o0openmietasfsDean pn() exnmociatlp r ues s0 rxrxo3ou1lpeelfcta() 2raum nt1oltomociyd sDum(vo (4arxrir3to1lptrlnvo s0trtoxopio4op emfvtas)aDur(rpoo1oetomociytfa2uanmo t4trerxf oadfatrln o s0trxoirpnu1olt mncslsfa2um(mp;o1oeeo feiad m2uln p (4trenmocoodop  lu s;s  2xmxmpnudlleemiesl(fartr(m ;u1aeto f3iltfs2raumo;t) eermrcoytfatranvo;t0srxoxm nudap e netl(fa2raxront0ape ioeiydfmDul(von()tlxrmr oytfa rau o () rtoxo3no4lp  lies t)srumxm ;o4oee ifcilt m2raumpn()aexrmr3iadom rli olt)t2tm(rpiodlmtelfvsasfa2rmxroou1tpxnif3iysfmDrau s t) exnxf3totfptr n olt0trxr(opny4lpt mnet tfsrtmum ;o0aeen ieiyt m2ulump;t0 ltrxo3oytlmDrluvs s0 2to(m io4lp   fcsat  2tr(mo;o1olt io3iytlm2ea(vp u0altnxr ta1la e ivi (  euoxopoo4ll nmiviatfa2tm(root4aexo oetydfm2uluvo;t)alermr ia1op e nes (0teumiopou1lpe lneslsfsDuaxmont4alx iietydlaDua(vo;(4texrmo ootopD  ivi;() 2ur(r iu4apen fvs tfsrumu  ;u1opto o3iadlm2ul(monu) exomf oy1fptranvi t0trto(o3iydoptn nci (faDrr(m ot0apxnmfeiad s2ea( snt)tetnxo3tadfatelueo t) 2xoxr3nu4op  lfctltfsDrau pnu1ape ifetlsfm rluvon(0 reoir3iydfmD an ilt setoxo3oy1ome  iesatfaDrr(  no4alt io3tys sDra(ms;t)trtrxocta1omtrlieils0s2tmimpoy1ole mfcs sfsDrrur ou0tpxnmi3tadlm2ean s t0tlenmoctytlmD  u i (0setr(m3ou1ameemieta( s2taxrp;u4oeto o3tas s um( s;()aleniocoydlp  lnvols) 2tm(mpoo4am e fes sf rtru  ;o4aexo icild sDua(msnu4tetnmfcty1faDr u sl()t2xoir no1amte nct (farraxront0tle mfciys a ulnms (0 lerxo to1oa ranvsls)t2xmxo oo1ol emfeia() 2rau pnt1oetomf3tydlm ranmo;()aetoxr3iatoaDeli s;t) 2to(r oo4lme mneilt srrrurpot1opx mfeild s elnvsnt0altrir iytlpDeaieo s  eur(m nu4amtn net s) 2rr(mont0aeto oeiltls2rlu o;u4tleomfcoydoaD  n i;() eum(m oo1op nmics (farrrum ou0oltn oetltla2rlumo;() rxrxr3io1lmt lnvo t t2xo(m io4olte fvsasfa2tau ont1olxn iciatfm2rm( o;t4arerirciadlatelivol() euoxo3nu1lmtelivt s) 2rr(root4alxniociltlaDrlnmonu4arenmrctydoa r nvo t)srxmio nu4apt lfctl( s2um( pot1apenifeiyd mDeanvsnt)tetoifcootom r i s;(0t2tr(r3oydomtelfvt t aDtru  ;o1ale iieiadlm ran o;(4tlxoxocta1om  li i;s0s2xrio oo4lme  nviltfsrumurpot4teto fcild a uau o (0aexomf3oodom eaies t  2uoir oo1lmtnlnes tf ruaxmo;o1aex  ieias m eln p;t) eerxf iy1oatrlneo;s  rxmxo3ny4aptn feils)srtaxmonu4oexnmoeiyt m el(vs t4aetnxoctotlmDeaneo;s)srxmiopno1ope lfvtas  Draxmpnt0alx mo3iat s emu sn(0trerxf3oy1fpDrai i;t0tetm(o nudamen fci tfsDra(ro;o4tptomocilslsDua(mpnt)alxoxf3ia1fatr iei;() euo(r nydal nlfetat) 2umu ooo1apt mfctas s umnmonu)teenxfcio1oa  luei s  2umxmpou4omt mfeiatfs2tr(rpno4tpx  o3iysfaDeau on(4trtoxf iatfaD  u i;(0 rum(r3ny1opeemies sfa2rmum ou0oexoioeiytls2umn on(0 exoifcty1oa  luvil( srxmxopiy1lleemnctl()a2ra(m ot1tpenmfciasfa umnmo ()tetoif3tatlmtrln sl()seuoxmpiu1om e fesat a2umur ;t0oee  f3iyt a2uanvp;t0tetnmfctadomD  ivi (  rxmir3nudole  iet sfs2ta(mono4tee mfciasfm umn s;t) eeoif tydoaDrluvi;t0 rumio3oy1ome lietls)aDrmxmp;u0aleomoetadlaDranmsnt0 lenxr3ootlmDeaues;s0srtoxr ny1lp  lfetatfaDra(mo;o4aetomictas s2uanvo u0altrmo3ootop eaivo;t  exriopoodal nlfvsas srtr(r nu4tpt  feiydls2umumonu4aexrxo totlmteaivi;s)trur(rpoodomee fcs sf rtmurp;u1oex moeildfmDrln pnt)tltnxr3oodlaDran i;s  ruo(o3iy1olee neia(faDumum oo4ale mfciadfa eluvo;u4arxnxrcto1fat lu i;s teuoxr3iy1ale lnvil(  rumuro;o4oeenifeias a ua( s u)alerxf3iodom r iei t0seurxo nodol  lfes sfartrumo;u0tpt  octyd m ua( p (0 eeoxr3tytlp  luvo ()t2trxo nodll nmnesls) 2uax pnt0altnmoctls a2eaump u)trxrxr ootoa  au i;( srur(r oudlmee ietat  rtrurp;t1aeto oeiaslm em(vsnu4tetnxfcoadfp  luvo;( tetmxo3iodom nlfctlsfsrrrumpot4opt ifeiatlm2uln on(4 lerxf3ty1fm   ies s0teur(rpnu1op emnetl( srur( ono1tpeomfcildlaDea(vo;u0 etnif ty1oa eli i ()srtmio no1llenmfctas)a2rax  ;o1aee  ociltfs2rl( p (4 rtnxf iytlptelivi s0seurir iudlm emnesls sDta( o;t1olxomieiysfsDrm( sn(4aleoiocty1lpt aieo t0 eumxr ny1omtnmnes t  2rrx pno0aleo ictyt m2ra(ms t0tlxrxoctydlmDe nes;s  rxm(opoo4oltnlfcsa()aDtax  no4texoiiciaslaDran o ()trtomf ty1op  auei s)s2xoiopiy1llenmfvi t)sDuaum oo1open o3iysla raumsn(0 exoxr3oytfate nvs (0t2uo(rpou4ame lfvsls) 2umxront0oeeoiieiyd s rluvon(0altoir tatfpDe nes;s  rxm(m3oo1opt  fei s)aruru oou4apxniicilt mDum(mp (0alxoifciotoa  anvol()t2tm(m oy1ol n icia() rrm(mpnu1tex iietasfm2ea( o;t0 lxoio oodlptraneilt0 eum(opnodlpenmnesas)srrrurp;o0tleo feias s2umnmo u0artnmf iatfmt ln o (0sexoirpoo1olee ivslt  rtrx ooo1alenioeils sDul(vpnu0 rxomo3ia1laDe nvolt  2ur(opoo1al n ici () rtrxmo;t1tlxoiocilsfm ua(mont) lxnxf3iytopD  uesls)sexrirpoy4lmenmfctls)a2trurp;t1tpt mi3ias aDumuvs;()trtoxr oydfm eanes;(0t2tm(r3ou1om nmnvsasfs2tmuro;u1oetnmoeiadla2rm(mo t4 eenir3iytlate ivol()trxo(r iydlmt livsatfsDra(monu0aet mf3iyslmDua( s;t4 eenio tadfaDe ivils setrxmpnu1amenlnvils artrx pno1aee iicild a2rm(mo;()tetrmf3iydfateau ils0t2tr(rpny1ameemfvslt) 2umx p;t4tle iietldfm rauvonu) leoioctodfa ran ilt0sexo(opoy4omen feiasfa2tmur ;u1ale moeiasfmDeauvsnu0aexoif io1lmD lnesl( srurimpnodlleelneilt artr( onu1olxoioetas a uan o;(0altrir iodla elueols)seumio oodlmt miesas)arurxrpoo0oet  oeiys aDuanms t)tlxnxr3iadfa   uvo (0 2urxr3nodomen fvi tf rum(rp;u0teeo icilslaDrmnmpnt0treoif oydlmDeai ils0t2xo(m3no4ameelnes (fa2ra(ro;o1olt mo3tldlm ulums (0artoir iotfa eai il( s2to(r3iy4lm nlfvt t aDraur oo4altomfctadfsDeau ont0teerxrciatlmtraivsl(0teurxr oydomenmfvt t srumxm oo1tlx  ieiasla2rmu p;t0tlxomo to1lateaueols)trtmim io1ol  lfetatfs2rmu p;t1texo oeilslmDemu p;(4 lxnio3ia1fmDraieo;s0s2tr(r3oodomeelnci ()aDumumpou1aptnmociat m2em(vs u0 lenxr todlpDe neils  rto(o3iy1optnlnvslt)sDtm(mooo0tleo iciyd a2uan s u0altriocoodlmDr uvi (  etoim3oydlpe mfcsasfs2rrurpot0tlxn i3tas m ulu pnu) exoxo iodoa r ieol( t2ur(mpoy1op elivi sfsrrm(rpou0aleniiciltfa rmu o;t4trtomo3tatfmteaneslt0 2urirpio4lptemnetl()s2trump;u1tpxnif3iad a umu snu)trxoio ootlp elu o (0tetoimpiy4amenmfcsltfsDtau oou0tpt ii3ils a um( pnu)alxomo3ta1opteauvil( t2xoiopoo1altn nvi tf Dumx pnu1oetomicildls eaums (0 rerxr3tadomt  n s;t t2uoxo ou1lme mfeils  2uaumono4tlto ieilsfmDrmums (0 eerxr3tatlp e i sls0tetm(opoy1al e nvtat a2rm(m nu1tptnmi3iysls2ea(ms t)teeoiociadom  aueo;s)truriopoo4olee fei tfa2umxmpou0tpxnmi3ils aDuauvp;(4artrxf3oa1om rlnvol( trtrxo ou4lptnmfetatfa2tmu p;o1oee  iciasfs em(vs u) lerxo3ia1la  an i s0tetm(r iudopeemiet (f rta(r nt4altnio3tlsfsDranvo;()alxnxrctatlm   uvi;s trumir nodlp emivsl(  2umxmpou0ale mictldls2rmuvs () renifcto1latelu sl(0s2xmxo3nodlltemfvia()a2rmurono1ope  f3ils s ranmo;t0teenif oy1fa  an o (0 2xmir3oudaptemietlsf Dtmurp;u1oee moeiatfs2umu snu)tlxrxf3iadlatrai s;s0trxrir iy4amtelivt s sDtr(mpou4tpeomf3tlsfa2umnvsn(4 rtrmr todla  aieil()srtrim iy4apte ict ()s2ra(mpnu1altnifcils mDuau s (4 rxomf oadopDrlivo;t)trxoim3iu4aptelnet ()a2tmxr ou0tltn fetatfa uau p u4tlenmocto1fa r i s s0 2tr(o3no1ale  nvils)artau pnt4oetomoeias a2em(mp u0texnxf oy1oa e ivs s srtoir io4lp nlfvsas s2tmu pnt1olenmoctlsla2elumo;t4 rtnif to1faD  ivs s)srxrxm3oudamee fcias) Dtm( ont4aee  ieiasla2elnvpn(4 lxrmf totfa e n i t0texriopoy1optnmfvi s)s2umumonu4ole  oeiatfm uln sn(0 eerxr iy1om e ieo;t0srxm(rpoo1lmenmnvtl(f Draumoot4opx  oeildlmDemuvs (4arenxocoytfmD lnvsls0 rxrxm io1op  mnei tfs2tm(r nt1olt mo3iyd s em( p (4trtoxfciodoa elnvo;() exm(o3iy1al n nctatf Dtaurpno4opx moeiytlm2elu p t4 exnxo3ta1opt ln i;s) etr(o ny4olen nct t sDua(mooo0tee ioetasla2el( pn(0tetrir ty1oaDr ivilt0s2uo(r3ou4om e fes t)aDrr(rono4tle mi3iat m2emnvo;t0arxnxr iotom e ueo;t)texr(r3nodlpeelivsl(fa2raurono0tpxn f3iydlmDrmums (4 eenioctodopDe ivs;t)trxrirpoodamt mneilt)artmxmonu0tex ii3ilsfs2rl(vpnt)altrmr3oa1oaDelneo;s)srtmxo oy4am n fvtasf 2rr(m oo0oetoifciyd sDelu p;u0 leoxf iytla r neil( srumim nu1aleemfvtas)a2umurpoo0aexnio3iysfa2ua(vont)tltoir iatlp rlnvilt teurxrpno1olen fvsl(f rrrx onu4teenmfciat s2uau s (4texnxrcootomDranvo ( srurxr3nu4llen fet s aDra(ro;o4oex ifeiad s rlump;u0treoxr oatlm e u i t0trtoim oo4ap n nvs ()aDtmxmpot4alxoio3tyd a2rm( s;(0tltoiociydfpteaivo;s  rtriopny1ope  nei tf Dum( pnu1alto iciltls2emnmo;t4tetomf3iodom r uvol( s2tmxr3iy1amt mieiasfsrtauroou4tpxnmo3iysfa ranvo;u4 rxrmr iydlmt auvs s)sexoirpou1am elnvi t)a2urxr ;o0tpx ii3iydfs2rln pnu) renir tadomDrli s t srxm(m3no1amen ici (f Dtrump;o4aee  f3iat m rl(mp;t4texrmr3iatlaDeau i;(0t2xo(rpiu4am  livsls)sDrmurooo4olt  i3ild m ranvpn(4 lxnmf oy1oa rluvo (0trtmxo ny1llt lfcilt)arrrurono1tltnmo3iydlsDrmu s u4 rtoxf3iytom elivil()trtr(m nu4op n fcslt artr(moou4tlt  i3ilt sDemu p t4alermocta1lpD anvs (0seuo(r3ou1omee nvtat sDuru pou4tlxnifcilt sDran p;u)alenmf3oadfp rlneols0 rur(o iudlpte nei tfs2uaum ;u4apxomoeiydfa ra(mp;t)tetrxfcto1oat lu s s)s2xrio3nu1aleemicslt)arra(mooo0tlxn icildfs umnvs (0trtoifciotomt li s;s)s2toim iodop elneta()arurxrono4opeo f3iys a2umn o t4texrif iydomt an ols0sexmim3ny1optn nesa()srra( o;o0alt io3iydlaDrluvs;t4tleoifctodlaDe uvo;t) rtoxo oo4al nlfci (fs2tmump;o1oet moctlsfs umuvp u0teenio iydfpD lueo;t) rumxo iy4ap n fcils) Duau pot4tpxomfetlslsDeln p ()arenmr tadfpD  u o t0 eurim3oo4lp e nvil(faruaxmp;u4apx ioeiaslsDelnmp;u)alxnxo tydom rli ilt t2xm(r no4om  mnvs ( a2rr(mp;t1apx mfeiydlm2em(mo t4texrxo todop   ies;s  exoir ny4om emfvsltfsDrm(  ;u1aptnifeiytfa uan o;(4alenmocty1lmtrauvs;t t2urir3nu1lp e nvi s artm(moou1aexn f3tldlaDrm(vpnt0tleoxr3tydomteaivilt0sexoxm3iy4amte ics t) 2rax  oo1oeeo i3ias mDemuvp;(0tlxomo iadfp e neil()setmxrpiu1amtn iesat aDraxrpnu1tlt  ieilsfmDraumsnu4 rxrxociytlmDeai s t) ruoim oo1apenmfesatfarumu p;t4altn i3tyd aDrmnmp ()aexomocia1oateai o t0sexmirpio1olt mivsa() 2urx pou4aet ifciasla2uaump;t0arxnxf3oydla eau o (0 2xm(o nudlltnmnet ( srta(rpno4tpx iietytfa2rm(ms (0aetrmo oatfpDr uei s s2tmim3ny1ape lfvs s)aDuaxm ;u1aexoiiciys aDrl( s;t)arenxf oy1lpDr n s s  2umxo nu1lpee fcia(fs2rauronu0olxo f3iydls rmumo;t0alenmocio1om  lues;s0s2toxopnodlme lneilt sDurx poo0tetnmoetyslm2emnvonu) rtrif oy1lmtr n sls0 etr(rpny4amtnlfcs (fs2tmx ono0aee  icildlm rm(mo t4tltnxr ootopD lueols0tetrio no4omen iei sfa2taum ;o0tpe  oetlslsDelnvsn(0aexrxfctodoaD auvi;s)s2tr(opoo4lmenmfet sf rta(rooo4tpx  ieiytfs ulu o;u0artoio oatfpDe ueo;()s2umim3ny4lm nlnci (f Drax pnu1alxo fciysfm emnmp;u)aexnxr iy1lmDe ueilt  rtm(o iu4om elies s) Dtru oot1tpeo fetlslmDulnmo;(4trtrifcio1lpDraieols teumxm3iy4ol nmncilsfa2ur(rp;u1tpe  feiyt s ra(vo u4 eeoif3ta1opDean o ( s2uoxm iudlm nmivtlt)artmump;o1aex iociys s2ea(mo u) exriocia1op   ivi;(  2uoio3no4amee fctlt  rraur oo0oexnif3iatlmDumums (0alxoifcio1fatr ivo;(0 exrirpoo1apeelfcils) 2trump;o0aet  f3iaslm2rmu p;()texnmr ia1fm  auvo ()texoir3no1altemivi t)sDraur ;t0texo i3iytfmDumu o;(0 lenif oadlp  lues;t)sruoim3no1ll nlies t sDtrurp;t1oltomo3iad s2rauvp u4aexoifcoa1lp   ivi ()srxoxm io1optelnvtlsfsDumu  ;u1tleoiieiad m rmu s t0texrmocoatlp r n i (0t2ur(rpiu4lltemnvta(  Dtr(r oo4apt mietltlmDeluvs;t0artnirctytlp   u slt)srto(o ny4opee ictatfaDtax o;u0apto oetat m rlu ont4alxnxo ty1oat aivs;()truoim3iu4lltnliviat s2rau o;u0tlt miciad sDrlnvo;t0alenmo3iotomDranes t0setmio3iydapte ncs sfa2rmxmono4apxn ociltlmDemu s (4aexrxfciydlp ran o;s  rxmir3iydlpenmfesl(fa2umumooo1tle mietasfsDem( onu) lermocoy1lm r nvs;s trtr(r iodaltnmfctat)a2urxmo;o1oex io3iltfs ea( s;(4treriociydlaDe ivi;()t2xm(m3ou4lmenlnesl(  ruaxrpou0ope mo3ilt m2rmn o (4tetrmr3to1op  au i ()seuoimpoy1lptnlnvs s  rrr(r nu1tetnifciys sDrmuvo t4tetnio3oydlp raivs;s  rtmxm3oy1ll  lieia( s2rmumono4tlenmfeiadfa emnmsnt4tlxrif3ia1lmteauvols0truo(rpiy1apeemietat aDtaxmpnu4oetniietadlm ulu onu4 etrio3iydoate i s;t  exm(r3io1alt mnvslsfsDraxmooo4openmoctys a ul( s;u)trtomf tatoa eanvilt0 2to(o iodapee fvs t s2ra( ont1texoifcilt s2rau p;u0alxrxo ia1faD  i s t seumxr ou4llt mnvtas)artrumpnu4oet iieiadls2ea(vp;t0arxrmf3iytoaDrau i s0 exmxr iu4omtemietlt a2urxr ot4opt iociat s ul( o;t4 eermo3tatoa raivi;s0srtmio nudam  mnct tfs2uau ooo4oeenif3ils m ua(mpnu0teerxfcoodopD li ilt)trur(m3oudlltnlfesltfaDuax p;o4tlenio3iat mDel(msnu4altrxr3io1lp e nes ( t2umxm3iydlle lfvt s aDrrump;t0alxn i3tatla2ean p;u4aeeomf ta1lm eanei s0setrio nodlpeelncs sfsrrmu p;u4oex  ieilsfa2eanmo;t4texrxr3to1fatr i s (0setmio iudoltnmnei (fa2rrxr ;t1olt  o3tytfa2uluvo u4 rtomr3iytlmtrln ilt t2um(m3oydlpe lnvs s sDtrx  ;t4aeeoiicils mDrl(mo;t) etnirciodomtr nei t0trto(r3oo1al emnctls) Dumxro;o0aexn ieild mDrln pnt0aeermo3tytlaDrlueslt0tetoxopoydolt lfcsat) 2rau  oo4tleo o3iytfa rmnms;u0 etnxociadlpDrlueil( s2urir3oo1oltnmfctltfsDrmu o;o0ape mi3iltfs umu o t0aeeomocta1fmteauvo;()trumir oo1ole lnvta( aDrr(m oo1texnmfciadfs rauvp (0tleoxo3iodopDelneslt)t2xm(o3iu1op   ivsa()a2um(r ;u1alxn f3iyd m2ulu s;u)aeeoxf3iatomDeauvo;()trxrxopiudlptemfet t)aruaur ;u1texoif3ias s rl(vsnt0 rxrxr tytlmDrlieils  rxr(r iu1altnmiesas)a2um(rpot0apenmicilslm2eln o;(4 lenmf ty1optrlnesls)trtm(opiu1amtemfvsa(farta(r ot0ope mietydla uanvo;(4 rxnxo ta1oa eaivil(  exmxm3oo4om  mnviat  Durur oo0opto ociys sDeluvonu0 eeomo3tadlmtelnei;s0t2toio3iodopenlnvia(fsrumumoot0aexomi3ildfa2el(vo;t)tetoir oy1fm eanes;(0t2tr(m ny1apt mictl()s2taxr nt0aet  iciad m2uln o t4tlermo3oytoat auvil( s2xr(mpoydlm elivtlt  rumx ont0teeomf3ias sDra(von()altomr3iodoatelnvs;s trumimpiu4lmenmnvil()srraur nu0tlx  oeiyt m um( snu) eeomo3iydfa e nvil( setm(r no1lmt  neil( sruru o;u0altomiciatfsDelnvonu4trxrifcia1la rlu o t  eto(m oudoltnlivi ( srtm(rpoo1aex  ocildfs2ra( snu0arxrmf3ta1fa r uei (0s2trio3no4om n ictl() ruaxr ot1tleomociad a2ean o;u0 eerif3iatfpDe ueo;() etrxopoo4ameelnvils s2um(r ;u0oleo oetatfs eaums t4tetnio3io1fmteluvils)texrio3oydllt lfvt s  Dtr(r ;u0tltoif3tadlm ulnvs;u)texnirciotom rlnvi;s)teto(o3no4lpenlnvsa() 2tm(mo;u0olxomfeiasfa2rmn s u)aexnmfcio1lmtr ieol()s2uo(rpnydamtelfetat)sDraxm oo0ale  i3iyd a2ul(vo t4 lxnxr todop rlnei s0 eurxo nudamen ivias aDtmx pno4olx  i3iydfa2ea(msnu0tltrxr ta1fm  livil(0s2urxo3no1lmenlics tfa2tmumonu0tlxn f3iydfa umnmpn(0 ltnmr oy1opte ieslt  rtr(opny4altelnes ( aruau ont0oexn octas m umnvon(0alxoxr tatlptrlivs;s srurim oydlmenlfei ( artrur oo1oee iictatlmDuln s;()artnif3tydfpt  u i () 2um(mpiudaptnlfesl(  rrrur oo0aex  ieild s2elu o;t4alenir iotfptr u s;() rum(rpiydol e ncsa() Drr( p;u0apxo ietytlaDrluvp;u)arxrxr3oy1laDe nvs s0teurxmpiydamtnmfeilt  Drrx oot0tee moctaslsDum(vp t0 lxrxf to1lateaieo;( s2xr(o3ou4ap  lnetlsfaDtmu ooo1olxnmfctlsla emnmpnt4aexrif oo1omDean s ( trum(m iy4opeemnvi s  Dua(moot1alxoif3tltfaDrlumpnu) exrio3todfm  liei;(0 eum(r iu4omtnmieilt srrmx poo1aeeo feiysls elnvo t0artrxf3ty1fa  anei;() euo(r3oydap elics tfsrraumono4aex mfeiat a2rmn s t4trtoirctatlmDeluvs;t  rtoim no1om n fvt sf 2uru  no1tpxn f3iasla2umnvp;(0tlermf oo1la eauvsls0sexoxm nudlpenlfct s arrm(moou4tpeoiieiadfaDumnmp t)tltrxr iy1opDrln i;(  exoxrpny4olt lnvi t aDumur oo4tex if3ildfa em(mp ()arenif3oodoaDeau s t0texmirpoy1aptelfetl(fa2uau ont4opto ieildlm um(mp;t0altnxr oatlatrli ols0s2uo(opiu1lp elieta() Dtr(mpoo0open iciaslsDra( o t4alxnxr todomDe nvi s)teuoirpoydalenmfet t artm(mp;o0aetniieiytlmDrm(mp;() rxrxo3iodfatrlies;t s2urimpoo1omeemieil()aDurxmonu4apxo o3iat aDrauvo;(4alxrxocoa1op   n o t)trtoio oo1omeelfesasfsDtm( p;o0apt io3iyslaDrmnmo;(0 lxoxr3iatfp   ueil()t2tr(r no1lmt mneslsfsDurumooo1tex iiciad s2eln s;t0altrio3oadfaD  uei;t)setmim3nu4lpte nes (fsDumu ont4texnmoeilsfs2ulump;(0 rtrxo iodlm raieo;t  etrio iu4lm   fet sfsDraur ou1apeo f3iltlm eaums t)arenif3iatfa   ivi;()teurxr3oy1amt  icils)artm(m ;t0aexo oetydls2ul( on()aeeomf iodoatelivils  2xr(rpnudaleemfcils aDra(m ;t4oetoiieiys m ulu o u)altnif tytlpD aieo;s)srumiopno4am elictl()a2tr(rp;o1tetomf3tldls2raums;t0trtrxo3ty1lpteauvolt0 etmio3nudlptelfciatf Dur(monu0apxn f3iyd a2ul(mp (4 exrxr iy1opte uvs;() 2ur(mpiu4amte neiatfaruau p;u1apt  fciad aDrlnmsnt0 rtnmo to1lateli sl(0s2tmim3oo1omtnlnvia( aDua(m nt4tee ioctldfmDrlnvo u)tetrmo3ty1lmDrlnvil() rumirpiu4olee nvsatfsrur(mpno1apeo iciytfm uauvp;t)tlermociodfaDeanvo;(0 rxrimpoudop emnvsa(fsrtmxmpno1tpxn oetad s2ran snu4tltrxr3ootomD  ivols0 rumxr3oodol   nvslt arraxrpou4olxnmictlslm ran pnt0arerxf iadlm eaivsl(0 rxrxo nydopeemfvs s)s2uru poo0tlen octls m uauvo;u)texoio3iodomt ai il( trumxo iudap  lictls srrru oot0opxnmfetldla umnmpnt4 etrifcoy1lpDrlivo;t)t2umio3nodapenmieilt)srum(ro;t1apeomoeils mDranvo;u0 rxnxf3todfptrlu olt) rtrimpiy1olen fes ( artax poo0apxnmi3tydfsDrmump;u0texnxfcoatfp  livs s0 exo(o oo4alenmfeia(fsDur(mo;u1tltoio3ild a rl(vpnt0aeeniocoatop   uvilt0s2xrirpio4llt  fct ()a2ra(  ot4aptnif3iydfa ea( p u0tltnxrcoo1faD ai s t0t2xo(o io1altemfcsls arumxro;u4opxniieiasls2elnms;t4alxnmrciydfmt  ues;(0texrxo3iu1omtemfcsas)arrrxronu4tltn i3ias s rln s;t4 lxnif3oodop   ieolt0tetoio3iodome mfcs sf 2tmxr no4ope  ictat s elumsnu)aetrxfcootfmD  nes;s  rtr(m iu4ap nlncsatfa2ur( p;o0opt mieiytfa2uanvo t4aleoxf3iydopDe i i;s)t2xoir3nudalt  ietat)a2rru ont4tee moeiyd mDrlnvp (4aeenxf3iytoa e ieils) 2tmxr3nu4am nlicia(f Duaumpoo1altnif3tytfm2el( on(4 rtoir oo1lpD  i i;t s2toio oo4lm   fcsatfartm(rpoo4teenmi3tydlm2uluvp;(4 renxfcoo1laDranvs;()tetr(o no1omeemiciat)artr( ooo1teto f3ilt m2ea(vp;(4tlermrcty1lm ran s t0sexoxrpny4opeemfeta()sDuaxr no0opt ifetadls2emuvs;(0 rxrif3tydfpteln o (0texoxo io4apt  nctasfsDrm( pou0tet  o3iyd sDuau p u0trxomocoy1la rln i s0t2uoir ou4lmtnlncs tfaDrm(rp;o1oeeomfciatlaDra(vsnu0 renio3iatoaDr nvo;s t2urxm3io4op  mfet s)sDuaxro;t0opt ii3tlsfmDuan p u0 rtnifcootopD  u ols)sexmxm3iu4lptelicil()s2urx oou0tetn ieiat a umnvonu) reoio3oo1fp elu s;(0trxoim3nydlme lfetlt srta(  ;u4tpx io3iytfsDuaums u4 etomr3tydom rlues (0texoir3nu1llenlfes s)a2trxm ot0tlt  f3ild a2um(vsnu4teermo3tydlpDraneo;s)s2urimpoo1ope lnei s arrr(  ;t0aptnioetatlm2em(ms t4aexomo3iytfpt  nvs;()srxo(mpiudale  fvs ()aruau o;t1alenmieilt m2rmn onu4tlxrxr iatfpD li s s0 2uoxrpno4apenmfvil(faDur(mpoo4tpe mietlsfa2uanmp;(0aetnif io1lpDelues;s0truoiopnydom  lfct s)a2uau p;o1tptnii3iltfmDelu s (0aetoxo oadfmt ai s (0sexmir3no1llt miei tfs2ta(mp;u4opx ii3iysfa elu p t4trtoif3ty1laD auei (0trtoirpiy1lmtn ncs ( a2trx poo4tex ioeiltls2ul(mpn(4 reoir3iodfaDrli ils) exm(r3iy4op n fvta(faDumurpou1alenif3iydfaDumnvsnu0alerif3tytlpteanvo;(0 exrimpoy4lpenmnvslsfarrrxmpoo0tptomociydfs rmnvs u0 rxoif3to1fmDeaieo;t)t2xm(o3ny1lme lncslt artmu  ou4tlt mocildls2rl(vsnt0 exoiociatop e n o t srtr(o iodale lfeils  rtm(r nu0tle  oeiadlm2uan sn(0 rxoxf io1fp eai i s0 rtmim oudamenlnetas a2rmx pou4tlt iiciydlaDuauvsnt4tetnmf3oo1lateliesl( trum(opnudol  lneiltfsrra( ont1alt  f3iatfm ea( onu) ltrir3ia1fmtr i i (0 exr(r3oodop   fes (fartm(m ;u1tpt  fctasfm umu s;u0tlxnmfcootlp r nvsl(0srurxr iy4ome lfcsas)aDtm( pnt0apx ii3iysla rlnvp;u0tlxrxocoodfaD luvs;s  rtmxmpiudlm e iciatf rtr(r oo1aee mieiltlm rl( s t) lxrmo oydoaDrln s;()t2uoxo iy4apen icilt)aDumx poo1ope  oeiydla rl(vp;t)alxrmr oo1om r uei;s)setrimpiydalee iciasfa2ra(rp;o1aexnmfciytla2elu snt4 etnxf oytla e iei s0s2uriopiu4lp  mfet s  Drrxro;t0oetn fctlsfa2umu p;(0 etoxo ty1la   nvilt0seumxmpoudomen fvs s)s2ta(m ;t0tptnmf3iasfaDem(msnu) lxrmr iadopt luesls sexoio io1ll   neils)aDrau p;u4aleo f3iydlm umn o t)aetrxfcoa1opD livi;t0trurxo3nydole  iei t) Dtmu  ;o1aex if3iadlm uluvo;(4aeeomf3oydfa   i o t  euo(m ou4op n nviltf rta(mpnu1alto f3iysfs2eanvs t0alxoxo iy1omt  u slt0t2xrxrpnudapeemnvilt  2ta(moou4apt io3iysfa2rlnvpn()artrmo3oodlp rau o;t  rtoxr iu1al emnesa( srrmur nt1oet  o3iasfa2emn p (4arxrio3oa1fp  lnvil(  2tmxopnydlpte icia(fs2um(ronu4optoiieiysls ul(mo;u0 rxnio totoate nei s0teur(o3io4ap elfeiatf rrr(  nt1tetn f3iytfs2eau pnu4aleoif iytomDrau i (0trxrxmpio1omtelnvs sfa2uaumo;u4aee iieiaslmDea(vp;u0trtoiociotlpteaivs t)t2tmiopoy1op emnvsatfsrra( o;u0aet mieilt s2ra( s;(0 lxnircoydlaD lnvi s)t2xo(rpno4ap elfeil( a2trum ;o4tpt iiciytfm uauvo t)texoirciy1fa r i s;s)teumirpiy1lp e fviatf 2raur no0opt iieiadla rluvsnt4arxrxrciotoatrliei t)srtrxo ou4ap nmnvsl( srrau  nt0alxnif3iytfm umnvpn() etnmo3tadomDrlivo (0seuoxo3nudaleemnct ()sDrmxr ;o0tet  i3iytlm2el(mon(4arxrxr3ootlmD  uvi;t)sexmir iu4ap emneiat artr( pot1aexn f3ild sDelnvo u0alerxocootlp eanvsls0 rtm(opoudom nmici t) rrr( p;t1aexoiictad aDel( p;u)trerxo3tydlmDe ivo;(0t2tmiopio1am  mfci s)arrmxro;u4apeo o3ildlm rm( on(0tlxrio tydfpt aiei s)tetmio3no1omtelnci ( arra(mo;t4oee  i3ias mDrlu onu4tlerxf iytlpDrau ol()texrxm io1ame lieta(f rtm(m nu1oee mi3tls a rl(msn()tetnxocoo1oa rlieo;s)truo(opoy4om  lfeiasfa2rrumo;o0apt mieiadls2umumonu)trenio tytfa eau s;t s2xmiopno4lme  ici s srurxr nt4tle ifctls s eluvonu0 leriocta1op rlu sl(0srtoio iy4ameemnvtls  2ua(m oo0tex mo3tat sDeanvp;t0alermocoo1omtr n i ( sexrimpiy4omtnmfvsls aDtm(m nu1teeomi3tld a ea(mpnt4 ltrxo3iy1fmDr neo ( texm(m3nydoptelnvsls  Drmx oou0apt mf3iytls2ua(mon(0 leoxf oydoaDrauvs s) rur(rpio1ame  ici s a2rr(rpnu0tleomictydlm2ulnmo;u0tlxnmfcta1lateaueo;(0t2umim3ou4lme liciat)a2umurp;u1alxnif3tlt a ul(ms t) rxomo iotoa e ies t0setoir3oydolenlieiasf 2rmx o;u0apx  feiadlm2umn p;u0trenmfciydoat aneslt0 eumio oy1ll nmncsa()a2tm(ront0aee  icias a2em( o;(4alxrif iytomt au i s) rxrir io1al   iei s a2trxrp;t4opxnmociytlmDranvpn(4teenir3oa1fmD aues;t t2urxrpnudoltnlfct ( sDtr(m oo1tle iieildlaDrlu p;() rtnxr3iadlaD luvi;t0trxrio iu4omeelfct () 2tmu oot4oltomo3tldls2ua( o u4 eeoiocoytfmD lieolt)tetrio3oy1lp nmncils) rrr(mp;t1ape mi3iad aDuaums;u4artoiociatla  au i () eur(m3nu4lpe mfcsltf 2rax  ;u4oeenifctad m2el(vo u4 lenxociotlpD li o s0srxmirpoo4lp n ivt ( s2trxmpno4opx ifeildfa el( pnu0aexnifcoatfm   uei;(0seuoxo iodap  lies sfsDur(r ;t4tltn f3iydfsDrlnvsn(0trtoxo tadla raieo;s t2umirpiu4lmte ieta( s2tru pnu4olxn f3tydla umu s u4tetrmf oytfmt lu i t t2xrirpno1ameemieils)aDtmurpot1apeomfeiatfm rmnmsnt4teeoif totfa r i olt0t2xo(m3iudlpt mnvtlt  Dta(  no0aeeoifciasls2eln pn()altoxr todomD ln i (  2tmir iy4om nmies tf Draxmo;u1tptnifetysla emu p t)alxoircta1fmtrauvs s0srxr(o3iy1al elfctlsfarra( o;o0oetomicildlm eanmo t0alxomo3iy1fa  au s (0 rurir3nodll   fetl( srtr(roou0alx  ictasfa elnvpnu0altoxo3oodoaD  nvi;t0 2tm(o nodam emfvsl(fs2tr(mpnt0oexn oeildfaDra(vp u0trenmrcoydfpDr uei () exo(o oydaleemfeils arrru p;u0texo ieilt mDeluvp u4 lxnio todlp r iei t trtmirpoy4openmfvta()aDuaxm ou0oet  ieiadfa uauvs t4tlxoxr3to1lpt  uvi s0setoxo3io1lmt mfcsls aDtm(m ou4apx  oeildfmDumn p;()tetomo io1lmDrlu o;t0 etrim io1om elici ( aDra( o;o4alx  i3ilslsDeluvpnt0alermrcio1lm  aneo s0tetoxr nydole  nvils)s2rm(r ;u0olt miciasfa2el( o;u)teeoxocia1fp  aneilt s2xoirpny4ap nmfcsa()srua( pnt4tpxo ociatfs ulums u) ltrxr3iytoaDeli s;s0 eum(r iy1ope mnviat)sDta( ooo1oeto feiydfaDrlnmpnt)trxnir3iatfp rlivil(  rxo(o nu1omenlfci sfa2rr( ont4tltn iciatlsDulnmo (0aeeoxoctodlp   ivs s0 eumio oydllt livslsfa2rr(  oo4oex  fcild a emn on()alerir oa1lpD aieo (  exmxr nu1ope miesas a2umu p;u0oltn f3iyd s2ua(vsnu4aetoxr3oydfmDrlu o t  rtrxr3oo1apeemfcta(farurx  ou0tltomfciyslmDrlnmo;u4aetrxf tytlp rauvil(  rtoimpiy4ameemnci ( sDrmur ot4alx mf3iat s emump;u)altnio3oo1oaD  neil() etm(m ou4lpee nes t arra(rpoo1alx iieiysla2emn p;(0 lxoir3oytla r n s;(0 rurxm iy4ol nmivi s  Drmurp;u0oleomfetad aDea(mpnu4treoio iytfmDrauesl() exmxm3oodal n ies tfaDrm(r no4optnmfcild s2umu pn(4texrxoctatoa  lueo ( trxmiopny1lp   icsltfarum(rpno4oltnmoctaslaDemnvs;u4aetnif oo1opDe ieo;s0t2xmxm ny1altemfvs s  Drm(r ;o4ape  iciys m ea(ms t0teerir3iodfatelnvo s0sexoxm3io1altnmietlt)sDtru o;o1apeomi3iat mDra( pnu0 exrxf tatop   i o;t0 rxrxo3ou1lpee iet tf ruauro;o0tltnif3iyd sDua( s;u0tltnxo oa1lpD  n olt0setoim oo1altnlnctl() 2tax ono4oetomoeiaslm um(vo;(4tltrif3ia1om  auvi;t0t2xrir no4lpt lieils)a2urxmo;t4alto ieiadfm2rm(vp;(4tleoiocoo1fa eliei t  2umir3oo1ome lnctasf rumxronu1tptnioctlsfm ra(vs u0trerir3ta1lpDeaneo t)trxrxmpio4opee ietatfsruax p;u4oetoifeildlsDrln pn(0trtnmf3oatoa e nvi ()tetmio iy4omt  nvsl(  2uru o;o4aetomi3ilt a rau s t0tltnmr3tytlaD ln o s  ruo(mpiy1ll   fct (farrau ooo1aex ii3iltlmDrl( p u4 ltnxo3tadlp  lu s;t t2tmxr3ou4al elneias)sDtmxr ;u1alen ietys s2raumpn()aeeoxfcootfaD  nvi s s2xmio nu1llenmnetls)aDrau oou0texniicildfs el( s t0arenmf tatop  li s;()t2uoim3nudlltemncsa()a2trxmono0tltnmiciasfaDelumont0altoxo3iydopt  ieo t) 2xmxopoo4lmee fct t  2um(root0olxoifeiltfa2rlnmo u)trtrmr3ty1faDean sls  rum(r oy4aptemnvi (fartrx p;t1aee mfeiaslm el(msn(0alenxf oytlp  livo t0srtriopoo1lme lnesls)s2um( onu4tetnioeiatlm2rmn sn(4aetnir oydfm raneil()t2urirpiu4am elietasf 2umxr ot4tlen octltlmDuluvp u4teerxf3tadopDraneslt)t2toxm ny1ope  ivta()srrm(mo;u0oee ioctlt a ra(mpn(4teeoifciydopteli sls0t2um(r3io1optelivilt  Dtrump;t1tltomf3iltfmDranms;t4alxnxo iy1fmtr u i s)texmxm iy4alee ivta(  Drrx o;t0opx mo3tad aDrmu p ()aeerio iadfmtelneo;t0teum(m3no1op  miesl(f rraumpou4aex mfciadfm rau p;()aetrmo oodop e n s s t2tmxr3iy1am n fcs s artr(r ;t0olx  ieiasfm umu ont4tltomrctytoaD  n sls) 2trir no4aptnlnesl(f Drrurpoo0aeeoii3tldlaDumuvp;u)artnxo oo1laD  u o s0 rxmio3nu1lmee fvi t)arrmumoou4aptniociadfa2ua(vp u0 rtrxr oy1latr uvi s)setrio io1op nmieils  2tmu  ot0tpxoioeilslm rl(von(0 rxoif ia1laD lnvi s) etrir no1apenmfvtasf Dra(rpou1aeeo oeiyslaDuln o (0tlxoxr3ta1lpDraieo s srxrirpio1am n nvtls  rtmuro;u0tpxn f3tlslaDra(ms u)aeeoxociotom r uvols  2xo(m ny1amt licsas a2rax  no0oex iocildlm2ulnms () exomr iydfpDeln i;t) etrxrpoy4omtnliviat  rrmurpou0alxoif3ildla2ul( s u4texrxf todlmte nvsls texmio oodalte nci t srum(mp;u1olxnmi3iytlm emuvont0tetrircoadlp  lu s;s s2to(opnudopte fvtl( aDtrxrpoo0aee  oetyd mDrm( pnu0alxrmocoodoate n sls  rxrim3io1openmfvs ()aDumu ooo0ale  i3tydfa2eau snt4 ltrmr3oytfp eluei;t  etrio oydomtelnctls sDtr(  no0apeo i3tas sDrmnmo;t) rxrifcoydfm r uvol(0trtmxo3iu4ope lfvta(f Dtmum no1opeo feiadlaDemu on(4 rxniociytomDraivi t setoir3nudoltemnvsat  Durumonu0apeomociydlm ra(vont4tltrmf ootfmtr nvi s0seurxo ny1opt mncsas)aDuaxronu0oeeomi3iasfm2umump u4arerif3oytfmDe nei () exmxr3oo4lmtemivsatfarrr(mp;t4oltn f3iltlsDel(mp (4 rtomfcta1lmt lnei (0teto(opoo4al  lneias  2rrumono1ope ifcilt m rmn p ()aetoir oadomtelnvol()s2xmxrpou1altnlivsasf Duau pno0oexoioctat sDemn o;(0 exrircoatomt  nvolt)texoxr3ou4om n fei (  Dum( o;o1opx  ictytlm umn s;() eeniociodom e uvo;()srtm(rpnydopt mfesas a2tmur nu1tle  iciltfa ra( s;t4 exrxfcto1oa  aivs t trxo(r3io4oltnliet tfaDtax poo1ope mfciytls ran p (0arerxociydomDeaiei;(  rtoxr ny4llt lneslsf Draurpnt4apx io3ilsfaDea(mo;u4 reoirciadomDelnes s s2trirpnodll   fes sfsrrm(ront1olxoiociyd mDemuvon(4 rxoxr iotfate i i;t trtoir3ou1altemnvil(  2urxmono0tltnmoctltfaDemnmp () eenxoctatfmD aivs t) 2uoim3oudlpeelnesa(  rrauro;u1apt ioeilslm2emnvsn() rerif3ia1omt livo;s0 2xmxr3no1om n neslsfarrrxroou1texnmoetat s uanvs;u0aetrifctodlpt  ieol( teuoim3nu4aptnlnvia()aDra(moou4ape  f3iytlm2rlnvs u0 rxoxfcoodfmDe ies;( sexo(rpnydal n ivsa()s2rru pou0ale  fcilt m2ra(vo;(0trxomfctydlp  lnes;t) exmim3iodame livs t)a2ua(rpnt4aptnmfetys a2ulnvo;(0tlxrmf3to1om r nvs;()trum(mpiudolenmncilt sDtru  ot1olxniietlsfa2ranvo;u4 rtnmf iodlatr n o;t0texm(o oo4opt  icilt srrrum ;o4tee ifciaslm2rauvp;t0trtrxrciotoateanvsl( trxrxr io4op emietl( aruaxmonu4oleomoetat mDel(vs (0altnmo3ta1oat anvo t)teto(r3iudlm   nctls a2umuront4aeen ociys aDrmnvsn(4aexrxrciytop r iei t) rxr(rpoo4ape livsat)aDurum ;o1tlxomo3iytfs uaums (4trenxo3oo1lmDean i s seuoim3io4aptelfet t srtm(ro;o1aee moctldfm em( s;(4aeenif3iydopteaivilt texm(o no1op elivsas)sDtaxm no1apx mi3iysfm eaump (4 exoxr iatlatrln o;s t2umio3nodopt  ivil(fsrtm(mp;t0oetn fctytfa2rlu p (0 rtnmo oo1om   ieslt0teumio iodol nlicslsf rumxrpno1olxn ietyt m elnvon(4 ltrxocoa1faDelieol() ruoxr3nodap nmneia()s2um( ono0ope ii3iydlaDul(mp;()tleoxo3oodfm raiesls0s2xrio iy4ll nmnvia(fa2tmxr no1olxn o3tltlmDemn p (4treomocio1lm  lieols0srtm(o3iu1aleemicias srtmxm oo0alx mfctltfsDul(ms t4 etrxf3io1oatr uvi;t t2trir3oydolenmnctas)aDum(mpnt1ope  f3iysfmDulnvpnt)aleoxr3ootlpD aiei t texo(r iodlm  micsas)srumx ono1teenmi3ilsfaDelnmo;()texrxf3totoa  anvo;s) 2xr(o iy1apenlivs sfa2trx  ;u0texoifciadls eau ont)aetrxf oadlp  livs ()truoxrpiudal nmfesl( aDtaxm oo0texn fetatls elnvo;u4alxrmfciodfm eluvo t texoim ou1amee feiatfsDrmxro;t0apx  o3ilsfa ea(vs t4alenif3oadfa eaivs;s)s2ur(o iy4olte neil(f rrau ooo1ole  i3iasfa2emuvp u4tlxnxfctadfmtrlnvo;()trum(m3iudlm n netltfsDuau  ot1aee mociysfsDum( onu0 lxriociy1latrluvsl(0 2xo(mpou4oltemfvtl(  rtrxmo;t1altn ictld s emuvs;u4alxniociydfmD lnvi (0teuoir oo1ap nlnvia(fs2rmx pnt4texo f3iytfaDuau p;t4artomrcoytfmDeaiei t) 2tmxo3iu4aptemietlt)aDraxr ou0olt  iciytfsDuluvsn(0alxnmo iotfaDelivi;t)t2xrirpoo4ll nmivslt  2tr(rpno0alxo ietasfsDra(msnt0 rxrxrciy1opD aivi (0s2um(rpiy4ome mfcs (f rrmuro;u1aexnmfciad sDelnmpnt) rtnxr3iodlaDr nvs s0setrxm oodll   fesasfsrrru  ;u4oeenifciasfmDrau pnt)tleoir3ty1laDrlivols texo(r nudlme liviat a2trxmp;u4tlenifeiydfs2rl(mp;(4treoxfciytomDeanei;() 2toxmpoydam nlncsa(fs2rmump;o4opt io3iadfs2eanmo;(0 lxnircia1lpDrlieslt t2tmirpio4amee ncsa(  Drmumpnu4tee ifeiydfs rl( o;(4tetnircoo1lmDrlneo (0s2tmxm iy4ll e ici s  Dtrxmp;o1tpxo fciltfm2ua(vpnu0 lxrmf3oytomD auvo;(0sexo(o3oy4op  mnvi s a2tm( ono4tex mieils a2uanmp u) etnxocia1fmtraieil( s2xmio iydaleemfcils artmumonu4tlxnmictls m rauvsnt0tleoio iodoaDe ieils)srtm(r3io4llt lnvilsfsDtrum ;t1alx iocilt m elumo u0alenir3oytoa   nes;t)truoxopno1am  mieta( aDraxm no1tpen feiasfa ulnvs u)alxoio iydom e ieo;(0s2xrimpno4oltemfeias  2taur ot1texoioctas m2ul( pnt)treoir3ia1lmt  u i;s0t2xrxrpiu1lmteliei s)aruaxrp;o1tlx moeiyt s rmu p u4tlxnmo iadlmtrlies s0s2toim3oy1ol elneil(f 2ta(  no1tetn ieiat m rmumonu4tltrirctotomt aieslt) 2trim iy4omtnlfvi sfsrrrxroou1apt iiciytlsDumn p t0tlenmf3iatla r uvi () 2to(m3nudapenmies () rtruront4tpenmi3ildfsDra(mont4arenmrcia1fatr ueo (0srur(m ny4lltnlieilsfartmxront0tet ioctys m ra(vp t4trerir oytlatr ivs;s  rur(r ou1ll n icsasf rraxr ot4ale  octysfs eln s u)alxoir3iotlmDeauvi s0 etm(rpno4olenlfesat  Draxroot0oeenifeiyt a ra( s (4treoioctatlptrluvilt)srxoirpno1apen ivt t a2raurono1opxnii3ias a2ean ont4aetnxo3totfa elnes ( seurxmpio4lm n ict tfaDrrxro;u0oet mictyt s umu p (0 exomo3tydfm  ai i;t)srtrxopio1oleelivil(f rta(mont4opxoifciltls eln p;u0 rermf3iatom eli o;t)srurxopoo4aptn fctlt aDtru o;u1tpeoiicilslsDel( snu0arxomo oydlpt luvols) etoxm3oy4om   ncil()aDur(r ;t1aleoii3tys a2rlnmpn()tlxnmrcio1fm  anei ( srxrir oo1amee ivias)aruaumonu4oeenmieiyt sDrmnmont) etrif3tadfmD  uvolt)sexrxo oodoleelicil(  rtmxr no1tet  i3tld sDemumo;t4trtomr oatlpte ivi s) eto(o3nu4lltnlfci () 2truroot1ale ifciad m2ulnmp t4arxrxoctotfa  lieo (0tetr(o nu4openmivi ()artmx oot0tle ifeiadla rln pnt) rxoio3oatfa eaiei () 2tmir3oydap elneia(fsDrmxmo;u1opt mfeiyd s elump;(0 etnxo oo1faDeln i t0srtrxmpoydole lnvsa(fs2rmxrpnt1oexnmoeiadlaDum( s u) leoxo iydoa rai i s0t2tmxr3no1apen fcilsf 2ua( poo0tltoifctadls raump;() etrxr3ootfp e nvslt)t2trxr iy4alen ietatf rrmu ono0tpe  fcildla eanmpnt4tlxrmr3ty1faDeau ils0s2tr(opiy1lptemietl()s2urumooo4tlenmfciyd m2ua( snu4 rtomr3todop r i il( trtoiopnydop e ncsa() Duaur nu0olt  icilsfsDuan o u0artriocoatlpDrln i t0 ruo(opno1ope  neia()artrxmo;u0alxoiocilsla eluvo;u0trxrirctatlate u o;t0trxoxm3nydlp emfcsa() Drrurp;o0ole  fciasfaDem( p;(4arxnif oydopDelivolt)t2uo(rpoo4llt mnvt s  rurxrp;o4aptomoeildfa ulu p (4trtoxocoydomteaivi;t0trum(o3ny1lmen ivtasfa2umx o;u1apt  feildfa2rauvsnu0trerif3oadopDrauvi;s0seuoxm nu4amt mivt s) Drrur no1optomf3iyt s2uluvp;(4 eenif ta1fatrlieols) 2tr(o iy1am nlnesl(faDrau pot1aexomi3tld s eanmp;t)aeeoxr io1la e uvsl(0texmxmpou4olt livtl( a2taurono4altn ieiltlm umn s;(0teeoiocoo1fm r uvs t)t2umirpiydap e ieslt)s2rrurpou0alto o3iydls rmn sn(0trxoio iatopDeln slt) 2xmxr oy4lpe  fvilt  Dtm(rp;t4oexomi3iyt m2eln sn(0alxrir3to1om  auei;s)t2toirpiu1olt  ietls) rum(r oo1optoiieiltla2umnmp;t4aetnxo3oo1late nvs;s  exmio3iu4ameemfcs ( a2rmx  nu4optnmoeils aDulnvonu4 lenxociotopt  nvilt0tetoim3iudalen nei tfsDuaum no0ape ifctld m rluvs;u4 etrmrciadfptr ivi;s0 eumim oodap nmfeias)aDtrx oot4aetomieild s ranmo;u0tlxnmf3ta1fmtr u o;s)truoxopio1optelfvsls aDtmu ono4tetoif3tydfsDuln o (0teenmf iydlm   uvil(0 rxoxo3ou4olt  ictl(fs2urxr nu4olxn ieiatla rl(vp;(0tlerifctatfatrau o;t  rtr(mpnu1lpeelfvi sf rtaurp;u0aetnmociltfm2ul( s u0tetrir3iy1omDr uvi;t0 ruoir iu4ll  lnvils a2um(ronu4oltoii3tltfaDul( s;t4 exnircoadfpt  u il(0teum(m oodopeelfvtlsf Duaur nu0aleomictyd a uauvsn()alenio3iydopDrlues t  2ur(o oy1altnliesa( arrmu  ;u1aleomieiydlmDelnmsnt4tlerxf oatla r u o t0setoimpnydameemnctat)sDur( oou0tetn icils m2rmuvp;(0tlxnif oydopt lnvils0 exoxmpnu4ope  neil(fs2ta(rpou0alt  fctyslm rl(ms u4texnio oo1fmtraueils0srtmxrpoy4lp e feia( arrax onu0oleo f3ild m um(mpnu) exnmo tydfaDrauvs t) eurxm no1apee icslt  2rmxrpoo0aleoiicild mDuanmp (0 exnmfctatoat ln o;()trxoir3oy1amtnlfcsl(f rua(rpnt4aptnif3iydla2umuvo t0 rxnmociatfatrauei () etrxo3oodape mnvtlt  Dum(m no4oet ifciysfsDem( pnu4 exnmf iy1lmDrln ilt t2xr(rpnudlpe mivsl() rumu p;u0texnmfcias a2ulumo;t4aetnxociatomDraivs s  etmxm3oo4ape  fcilsfaDtmx o;u4tlto o3tltlsDrm(ms t4tlxnio3iy1laDeaivo;t trumxr iy4lm   fvs s aDuaumont1oet mictaslsDum(von() ltnmo3iatlp  ln olt0t2urxo3io4omtn fvsl(  2uax  nt1olxo ieildlaDelu onu)aeerir tydfa rlneils0srurimpoy4lp elfci ()s2ta(m no1tpe ii3ildls ua( onu) eeriocty1lmD an o t)sexoxm3iy1olen fvt ()aDurumo;u4opxnifctadfs ea(vs;(4tltrmr3iydoatelneolt t2um(r iodoptnlnetlsf rtaur nu1aexnifciytfaDeanvsn(0alxnmocoatfatr n s (  ruoxo nodlmtn ivia( artaxrp;o4tlenif3iasfaDuluvp;u0 lermr3totop e i i;s0 2xoxopoudlpeelfvia(farraxm ;o0alx ii3tydfs2uau s;u)arenmo todlmtelivo t0texr(o3iy4am nmivslt)aDurumpnu0oeenmietas a2em(vs t4 etoxrcoodfmDrau o;t0 2tmirpnu1ll  lnctas  rtmx p;o1tpto oetydfa2rau sn(4teenxo3tytlmDelu o;s)setmim oudal  mfciatf rrrxmpnt0oleomoctyslsDrm(vs;u0tlermo iydopDraivs;s0sexmxm io4opeelfcsls)a2rau  nu0oee ioctat a uauvpn()altomo ia1la eauvs t)srurio iydomtn ivt tfsrta(rooo4olxn ieilslaDelnmp (0tetrxf3iytla eaueo;( sexrim3iydlle mfcsa( srta(  ;t4aleoiicildfs2ulu p;u0tlxomf3io1faD ln s;t t2tmxmpou1op  licils)artmuro;u4tpenmfcilt a2uauvs ()trenmo iy1fa r uvo;t)trxoxm io1am  mieia(fsDrm( pno1tle  feias aDemu o u0tltnxr3to1fatrlu s s)s2urirpiudlpen nes ( srtaur oo1oexo o3iyt s um( o u4 exnir tydoptean slt0 rtoxm io1lmenmnvia(faDra(mp;t1aexniiciydfm2uluvs t)aleomr iy1omtrlivs (  euo(o ou1am e ncsa(f rtr(rono4tltnmiciytfs ra( s;t0 eeoxo ootoa  lu ilt0 rurxopiu4al n iei t)arumu onu4altn o3tyslmDrl(vpnu) eermf3to1laD anvo t  2tmim oy4amtelfctlsfa2rm(r ;o0aexoiieilslaDumums (4trerxf3tytfpteaueo () rxrim iu4op nlfvs s srtm(  nt1opxomo3iatfa rmuvs;t0teeriociadlmteluvilt)t2xoio iydaptn ict s aruauro;u0oeeo i3iydfs em(mpnt4aeeoxrcio1lp raivslt  exmio3nu4omtemiei t)s2tm(rpou4oeeo i3tasfs umu o t0 exrmf iotfpDe uvo;s s2trxopiu1amtnlnetls)aDtmxr ;u1apeomo3tydfaDrl( s;t) etoxr3tydoaDrli o;( s2xoir io4amtnlfeias)arra(rpou4apeo ieilsla rm(vo (0artrxfciatfpDrau s;s0s2xo(r3iy4lmtemneia(  rtrurp;u4tpxnmo3ild mDrmn s;t) etrxo3iatfp r u i ()srumim3iodlpte ivi s)aDuau pou0apxn feildls raumpnu4 etoircio1fm eliesl()s2xm(mpno1ol n nes ()artau p;o0oetoio3iad aDrmu s ()aeeriocta1lmDe nes (0trto(rpoo4omen netat)srtru o;u4alxnmf3tyt mDrmu o;t0alerxf3iotopD au i;()t2uriopiu4omenmietas)s2tru ont1tlenmfctat a rl(von(0 rtrio3tadlm  aies;s0srxm(mpnodal n fvtat) rur(ronu1tltomf3iadlmDul( o (0 rtoxo3oytoatraueo s teuoio3nu1op e ncsl(f Drax ooo0tltoiicilt a2emu o t)tlxoio iytoaDe uei;t s2xrir3ny1apenlncsas)arua( pot1aleo oeiydfaDulumo;()aexoiocoy1faD  ivo;s  2umimpiydoltelfesas)aDrmxmpoo1aexo oeiysfm rauvo;(4tetnmf iydoatrlnvs;t0s2to(o3nudole micsl(  rrr(r nu4alx  f3ias a emu onu0aetrmfctadlpDeai o (0trtoio io4ap nmfctl() 2tr( ont1tpxnmo3tysfaDrm(vsn() eeoif ty1fa   u s;s)setoio oydapeelnciltfsDrr( oot4aex mo3tadla rluvsnt4trermfcoy1lpDe ivs;( srtr(rpoodomen nvils)srtrum ot0oet mf3tldlsDea(vp (0aetomf oadlaD  ivol(0s2xo(o3nu4lltnmiet ()aDrax  no4oleo fetydfa2eluvpnu4trxnmf totoptrluesls0t2xoirpno4lmenmiesasf 2tm(rp;u1openioctadfs2rlu pn() eenmf oy1fatranvil( srtoxopiu1omenmnetatfarumxmo;o0tlen i3ildfa emu s ()tetomf3tytfp raieo;()s2xmxm3nudom  lfetltfsDuaur ;o4opto oeilslsDulnmp;()arxoxr iatlmt livi () rxoimpnydlltelfetat)srraxrp;t0apt  oeiyd aDeln s;u)tltnifcia1lmDe nvo;s)seum(r3iodamtn fci s  2umumpnu1apx  o3ilt sDran o t4 lxrmfctadomDran il(0 2xm(r oo4op  mnvta(  rtmurp;o0openmi3iysfa2rlnmpnt0aeeomo3ootfa rln il()srumxrpiu1llee ncilt)srtm(mpou0apeniocildfa2emnvs () ltnmr3oo1la rlivi;t0srxr(r oo1apee fvtls  Dumu ont4texn oetyt m rau o;u0 lxrxfcio1lm ean o () exrir no4oltemnesas) Dtaumpno1aptnmfeiytls2umuvo;(4tlxnmf3oadlp rluvo;s0s2um(rpoudolee ici tfsDtm(mp;t4alxn fctas sDrmu s u4texnif tadfmDrau s t s2toxrpiydameelict s s2raur oo4apt  o3iltlsDrl( o;t) eeoif to1oa rluvi;t)trxmim3iy4lltnlfvtl()aruax ono1tpx ioeilsfaDulnvo;u4 renxfctatfp rli o t sexm(m3io4opeemfvtl( srtru  nt1aeenif3tltla2um( p t4alxnmfctodom   nvo;( s2urxr3iy1omtemfvi s a2rru  ou0tetnifeiydfa2eanvpn(0trerxrctatomtrlieo;t0srxrimpnydlmt  nei s sDta(r nt4oet  fcild m2emn s;t0trenmoctytlpDraivols0teumimpio1oleemnetls)artrx  ;o1oex if3ilslaDran o;t0 exomrctadomtelnes t trxm(m io1ol   ietl() Drax ooo4oltoif3iltlm ra(vp u)arenmrciatomD anes t  exoirpoo4altelfesls aDtmum no4opxnmfeias aDra( p;(0alxoxf3oadfp rai i;() rtmio iu4apt lnctltf Drmxmo;t4opx mf3tydlaDum( pnu4aeermr ootlm  ai s;t)t2xoiopoy1lltn ies s) 2tmx ont1tpx mo3iyd s2ranvpn(0texrxociy1fmDrauvo;s0srurio oydlpt lnci (fsrurx oou0alenmoetyt m2raums u) rxnxf oodfptr ueilt t2tm(opiudll nlfcsas)aDum(mpnt4oexniietldlsDranvp (0texnmo iotlm raneils  exrir nydlp elfviltf Drax p;t4alx ii3iat mDuau snu4areoif oadfaDe i sls)s2urxo oudlpe licsa() 2urxr ;t0tetoif3tyslm2rlnmp;(0aeeoxocoodopDr ues s) 2um(o3nodape mietl(farumurpno4aeen f3iysls ran p;t4 lxnif totlaD li slt)srxoim3no4al  mivsasfarurx o;o1oexn ociytlsDrmuvp u4 eerxocoa1optrlieils)s2ur(o3oy4omt mivias  2rmumpno0opto oeiysfm emnmon()tlerio ta1lateli olt0 exoim nodlmte ictas  2rmuronu1tlen f3tltlaDrmn p;t4teeoio oadlpDr uei;()teumimpoudapt lfesl(  Drr(ro;u0tpenioeiltfsDra( p t) etomo tytopD au ils) ruo(r oudopenlics () Duru o;o0tpx ii3ildla2rl( onu0teeoxr io1la  lieo;() rurim iy1lm elfciat) 2umurp;o4aex mociysls rmnvp (4 exomo oodop  anvol( s2uo(rpiy4ll nmfeils a2rmx pot1apxo ictldla2raumsn(4 leoir3oy1omtrlu s (  exm(r nudlp elivs (  rurxr nt0aex  ocilt sDulnmont0aetrmociatlateaieo;( setrxopnu1opte ivs sfsrtrxm no4olx  octysfa2rlnmsnt0arxoxr ty1om elneo;s)s2umimpoo1lm   fct () 2raxrpot4opt io3iad mDel(vo;u)aeenxf tadlmt lneo ( trtoirpiudal  mieta(f Dtrurp;u4aeeomfciytlm eaums (0altomr3iydfaD lu o;t  etoxrpiodomtnlnes (  2urur nu0ole miciysls2ea(ms u0altoir3oydfateaneilt) 2trxm3iu4ol   nvt t  2tmu  ou0aleo icilslaDumnvs;(0trtomf to1oaD  neo t)s2xmxm3oydaptnlnvs t a2umuroot4texomi3tld a emn p;()arxomf ootop r ies (0t2ur(m iydom nlictls)aDrrxrpot0aetn ociytlmDum( pn(4tlerxr3tadfatrauei;()srxmim iy1am  mfeiatfsrrrurooo0opt mfciys m2rm(msnu0texnxfciydfptelnei;t)texrio iy1aptnmneta(  2rr(  ;t0alx ioctatfm2ulu s;t)artomf3ootfaD aivsl(0 eurir3io1am nlnctat) Dumxmooo1optoif3ias s2rmnvp t) eeomfcia1laDe n o;s0 2xm(m ny1lle lfes tfsDur(mo;u1alx mfetysls umnmsnt0 lxnif3iydoa elnesls0 2umxopio4oltn fvilt)s2rmxr ;o1opxoiieiyd m2ra( p u) rxoir3oy1oaDr nes;( texrio ny1altn ictl(faruax o;o4tlenmfctadfa2ea( p u0trxnio oa1lpDe i o (0srurio3nydlmen nesa() 2urur ;t4aex if3iasfa em(vp (4 reoxr oatfa   ueilt0 rurxmpiydamenmfes t sDumxroot4tpt  ociasfs ua(ms;u4trenir oadfmDe ivo s texr(opoudlme mnvt tf Dtruront0tleo i3iasls2ua( s (4 lxnmociatom  ln s t) etoxmpnu1ome lfvsltfs2raum ot4optn feilsfm2em( snt0 renxo3tytlateluvo t0 2xoim iu4op n fvs (fs2ra(  ;u0aetomo3iatfaDeanmp;(4 reoif3io1laD  ivols)s2umir3nu4ape mnes ()s2taurp;u0oeeomociat m2el( ont4tlermr oadfmDeau i t  2tmxr3nydam nlnci (  Dumxmo;u1opx miciltfsDrmnvont0 etomfctydoptelu o;s0s2umim3oydop  lneta( a2tm(rp;t1ope  feiyt aDuaump u4aetnif oydoptraivi t tetoxr ny4apeemneia() Dumxmoot4teeo ietys s2rmn sn(0aetrir3io1fmt  ivs;()sexoxr3iu4olenlfvs tfa2tax  ;t0oexo i3ias s rmnvont0 etomrctotla   ieo () 2xmio3nu4apt  fci ()sDrr(  oo0tle moeiatfa uauvs;(0 rxrmoctodoa r ies t0srtmio3oo4op e fet (f Dtrxm ou0opt iociyslmDelu s;(0tleomfciydomDr nvol(0s2tmxopnu1ome lnesls aDurxro;o1tlx mo3iyd s2ua(ms;u0arxrif totlaDelueo s  rtmxm ou4ope lfvslt) Drr(rpoo1optnmfctyslsDra(vpnt)arxnmfcoydlmt anvols seum(r ou4alen nvi t) rrmx p;o4apx  ociydfm2rauvs;()arxrmr3oatopDeli i;(  etmxo3no1lpt mnciat sDtau onu1olx mf3iasfaDeluvp;(0trenio iy1oatraivi;s  rxr(mpiydapt mnct () Duaurp;o1alxnmfctasfs2eluvs;u4 rtnxf3iytop raueols s2xo(o3ou4alt mnet s sDtaxm no0apxo ictldls ea(vo ()tltnxr oy1lpte nesl( texoxrpnydapte ieils)a2rrxmono1teeo ieiyslm um(vp u0 ltoiocio1lptrauesl() rxrim ou4optelfcta()aDrr(m oo4aexnmo3iyt sDrluvo;t)arerxf oatfa  auvi;s0seto(o nu4ap  mncs ()s2tm( o;o4tee iieildlsDrmnvp;(0tlerio iytfptr nvi;t)s2xo(opiu1omtnmfct t)srraxmoot4olxoif3iytlmDrlu p;u4 eeoxr iydfptr i s;(0teuoirpiy4al e fetas) rtrumpnu4apxn o3iaslsDuanvsn(0areomr3to1oaDr n ols)teumxrpnu1ale  neiltfsDra(  nt4tpt ioetad a2uan o;u0trtnmf3iy1lmD an slt0 rurxr3iu4olen iviasfartruro;t4apt ioetldfa ranmo;t0aetrxr3ootom eaivs t)tetrimpiy1lpe lfct sfsDrrumo;t0teenif3iysla uan pn()aexoxf3ootfaDrauvo ()s2tm(m3nydoleemieta(fsrum(mo;u0opxo octatfa2eau s u) etnmfctotlpDeaueils0 2xm(m3ny4ole  fet t s2tmxmpno0tex io3tys a2elu o u)alermf3oytfmt luvi s0trtoim no1lme mfvi tf rrmum ;t1opto feilsla2rlump;t4texrxocoytoaDrlnvils t2trxrpno1ap n nvi s a2trx o;u4oet mfctat m rmumsnu)artoif3oytoaDeanei s0s2uoio ny1am elfvsl(  Duax o;u0tptniictaslm rauvont0tleoxociytlpt aieil(0tetrxo nodol emfvi t) 2tm( oot0ale mfeiydlsDeln o t4tetoir oytom eau i t)srumxm3iu1llenmnes tfsDtmumpnt1aee  iciysfaDulu o u0aexrmf oytoaD  n s;() etmxr3oodapeemietas)arta(r no4tltn i3iad aDuln p u4aleoxfcoodfp rluvi t t2uo(m3iy1altemicsas aruau pou0openmoeiltfa2ul(vp;u)tlerio iodlaDr i slt0s2xrir nu4altnlivt t)arrrxro;t0tpxn ietlsfs2eanvsnu0aetoxrcia1oa rluvi s t2um(r3ou4ap elfvsat a2tmuro;t4tpx ifctatls rl( s (4alxoxo3totop e i s;(  eumxrpno4lpe  net t)sDraumpnu4apt iociatfm2umums;t)trxrxr tatlmtrluvs;t)trxoio3iodopeelici t)a2uaxronu4aleomo3iatls ea(ms;u0 lxoxrcoodlaDrlu o;t)seum(r3nudlmtn ics ( arrm(m ;o1tltomfeilslm2elnms;t)alerir3iotlpD ai o t)sexrirpio4olt lfctls srtmump;t1ope  f3iad sDeaums;() rxrircoadfaDrai slt srxrir iy4al  lnct tf rururpnu4alx  icilsfs2em(vo u)tlxnmfcoytlaD anvs t srxriopoo1alen ieia( artr(rpoo1tlx  ociytlm elnvs;u0 rtnio tatlmDr ueo s0setm(m3oydlpt  fcta()arrmu  ou4oetnioctat s2elnmo;() renir iydlateln o s0s2uoxmpiy4lmtnmfvsas a2tr(rp;u4olt  o3ils aDrmu sn() etoircio1fa raivi;(0setmxopnudamt mfvslt s2rmu ono0aptomoctas m2umu p t4 eenxf iatfp rli o (  rxmxmpou1lmenmfvs sfaDrmxm ;u0tptn fctysla emu s () lxrifcoy1lpte n o;( s2xo(o3iodol e fvias) rrau  ;t0tpenmf3ildfm2uaums (0 etrxo3to1om   ieils s2ur(r3iy1llte nvtl(  rra(m ;t4alxo o3iyslaDrluvs u0 rxnmf oo1optr ueo s tetrxm oudap nmfcsltfsDrrumo;u1oeenifciyd a2em(msnu4 leoir3iotla  aivsls0teum(m3iu4amenmfvsat  Dtaxmoot0tex ifeiydfm2em(vp;t0aexnxfcio1lateanes ()sexo(r3oudal e fesa( sDrr(r nt4alxomiciytla el(vsnu0tltrmf oydla e nvolt srtmxrpiy1apenlictls)s2umxr nt0olxoif3tadfm2uanms;t)tetomo ty1fp r uvolt0 eum(m3ou4aptnliet (farra(ro;t1tlt mf3ildls2umnvsn()aeenifcoydomD auvo;(0trtrxr3nodop nmicsat  2ur(r no4olt ioctysla ulu o t0 rtnmf3oatoat  uei;(0 rumio ny4am nlfvs tfsrumurp;t0olxnmi3iat m2ranmp;u0tlxrir ootlmtrai s;t)srur(o3nu1altn ncsa()srrrx  ;o1tpx iietltlsDel(mo;(0arxomf iadfm  aneslt seuoir3ou1ole liesas srumuro;o4apeoiieiytls rmuvsn(0tetoirciy1fat lnvs t0s2xmxr iy4amenmncs (  rtm(mpou0tlxo fciyd a2eau o;t4tleoxf oatfaD lneo (0teuoirpoudaptemfcs s)s2umu  ;o1apt mo3tatlm ra(vs;t)aexnxf3iy1om r ues;t)s2xm(r iu4lm emivia(f Dtau oou1tpx ifetydlsDemnvpn(4alxnmr tydfptrluvsls) rxr(opou1am  livs sfartaxmpnt1alt  oetyd mDrlnmpnu4aetnxocoadfaD livo ( srumir nu1amen fciat)srum( poo1tpe mocilsla ra(vp;()arxrmo ootfpt aueo;s)s2xm(opoudol   fcslt srum(m oo1altomfeiadfs2ulums t4areomr io1lptrln sl(0 rxrxr3no4open nesasf Dtrxr ou0texnii3tyd m rmu s u4 reoxrciatfp e ueol(  rtmim oy1olt mnes s)srraxmoou0oee  o3iadls2umuvpnt4aetnxo3todfpteaivsl()srxoxr3nu1lm nlici tfarurxrooo4tet mietadls2emnvs ()aeenir3iydfa  lnesl( s2tm(o3nodlleemfei () 2ra(  ;o0tpxoifeiysfs2ua(ms t0 etnxo3oatfpDe i i t0teum(mpny1apte fcias) 2uaur oo0olt io3tld mDrlnvs t)alxrxrctadop  lu i;s0teto(opoo4lme  ici ()a2rmxm oo0ale mfciyslm2ean snu)aleoxr tadlp r i ol( trxmxr3oo1altelfvi t  rurumpou1openmfciydla ra( p u4tlerxrcio1fm eaneslt  2xrio iy4apen iei tfa2tax  ot4oetomiciad a2eanmp;t0artnxr oa1oat an i t) 2uoxr ny1omtnmnvtatf Drax ono4aptnmoetld m2rlumo (0trxrmo3to1fm e i o ()s2xrxr iudape lfvt t aDuau pno1tlxn i3iydlsDum(vont)tlxnio tytlptrauvsls0t2tr(m3io4lmen neiasfsDtrx oou1openmi3ilslm em(ms u4texrio tytop  livslt sexrio ny4opt lfetl()aDurx p;o4tpto f3ias a rauvonu)altnmrcty1lp  auvs ()truoir no1ol   ivt t)sDua(m oo0apx mietysfaDrlu p (0trerir3ootfaD auvi ()srtm(o3iu4lm  licta()arrru  ;u0opeoiieiaslaDrmnmsn(4 rxomr3oo1fmtrau s s0 2uriopou1lpeelicsl(fs2urxm ;o4tpx mietyt s em(vs u4 rtoxo oo1op  lneolt trum(o io4al emieilt srtmump;t0tetn fetld s2ranmp t0 lxrircto1om eluvs s)s2uo(r3no1lpe mfvi s) rrrxm ;u1tpxomfciyd sDua(vsn()tlenmo3ta1lmt auvils0 2umiopoudap  licslt s2trumoot1aeenmoeiasfs emumo u4tlxoxfciytfmteauvsl() rtoio nodlleemfeia( srrrxm ;o4altoiicias m um( pnt0aeenxo3tatopt aneol()srumir ou4ol n fetltf Duru p;t0oexn ietytfa rl(vo u4aexoio ootoaDr i ols0srtrxrpiy1lme lfesat)arrr(mpnu1olxo f3tls sDemn pnt0 rtrif oa1fm eaivsls trxoio3nudlltn nvtlt aDtr(mp;o0tee mf3iltls rmu s ()arenxo3todfat luvi;s0teto(o3io1olenmicia(  ruau p;u0oltnmfciaslm el(mo () eeoir oatlp   iei s0tetoxr3ou4am  lnetltf Drm(mpnt0ale  iciaslm2ua( onu)trxomociatomDeai i s)s2xrimpny1ol  mies ()aDuaur ou1texn oetydfa2uaumonu)texrxo iodomDr uvils)seto(r ou1oltemfcil(fsruaum nu4tpxn octldfm rlnvs (0treoif3ta1faDraues (0trum(o nudal   ncilt s2rrurpou4tlx iictyt mDrln s (0 eeomf iatomteauvi s0truoir3no4oltn ivtat) 2rru  nt0olx ioctasfaDrl( o;() ltoxf iy1om  an s;() rtrim3ny4llt micia(fa2rm( o;u0texnifeiat a uaums;u4trtomr iotfaDranvs;(  2tm(m3io1lm elfesl( arrmx  ou0optoiocils sDulnmp t)artoxoctatomD anvi (0s2trir no4ale lfvt t aDuau p;t4opt  i3tatls rmums u)trtoxocto1faDr u ils)srurxo3iy1llt mfcs t) Dtmxmonu4oetomi3ild aDua( s u4aexrxo oydlmDrai s;s s2xmir oodope  fcia( a2ururonu4apxomieiyd aDrmu o t4 ltrxo iotoa rlneolt  2tmxr3nodome mnciasfa2tm( p;o4aeenmociadfsDemu ont4alxnioctytoptr ueols0sexmimpou4optn icsls arur(moot1aleoiieiydlm emuvs;(4aetoxrcoytlpt anvi;() eumxm no1am n fet s aDtrxm ;o1olxnmo3tldlaDran s;(4tleoxr oy1lm  aues s)s2tm(m ou4omee netlt)aDrr(rooo0aeto f3tyd s ra(vo;(4 etnmfcia1oa rai o;(0t2ur(m3ou1om nlfcslt) rtrumpno1opx ii3tadfm ua( ont0aleoxf3ta1lmt li i;(0t2trxmpio4op e nesl( a2rru o;u0aet mi3tyd aDrm( on(4trtoxr oatfm  lneo s0srtoxr3oo4lmtemnvi t) Dtr(r no1oexo fciydlm eau o;u0aetrif todfp  livi s  rtm(rpoodomee nvilsfsDuaxro;o4opxnii3tltlm2em(mo;t)tltrmf3io1lat lues;(  rto(o nu1lmt lnvt ( aDra(  ;o4aptoioeiasls umnmp t4arermr3tydfpDelivs;() rto(o3ou4op e nes s)aDtaxrp;o0oee ioctadfs el(mp () leomrcio1omteaiei;t srtoio3oodoptnmnci t s2ta( pnu1aeeniicild s rmn o u)texoifctytlpD  i o;t  rtriopou1ap  mieta(fa2tru  ot4oltn o3tyslmDeln pnt0 rermr3iadlatraies s tetriopno1alte nvils)s2ra(mp;u1openmoeildfs rmn o;()alxnxrciodlpDr iesl( teuoxr iy4lp emietasfsruaurp;t1tlxn fcias a ulnmp;u)alxrmrcoodoatr u ol(  2tm(m3nu1al elnvil(fa2raur ou0apxo fciys a uln snu) leoiocoy1oa  li o;s) 2urxopnudame mfcia()aDurxroot4tpt ii3iatfs2el(mp (4 ltnxrcoadla eliesls0s2umxm3nydll n neta()sDuau onu0oexo fciadfsDeaums () rermf3totlaDraivo t) rtm(r ny1lp nmfeiatfarta(mont0olx  ieilsfmDrmn on(4 rxnxf3ia1faD anes s) ruo(opoo4optelfetltfartaxr ot4aexomoetaslm um(msn(4tltrir3oytoat au slt  etmxo iy1ome mfvi t arra(root4oleo iciadlm2el( o;(4trenif io1fp   iei t0teurim iu1om n fvs tfaDuru p;o1apxoifciltls2rmn snt0alenxr oadomt livi;(0texoxm ou1ll nmfetlsfa2umxr no1tee  o3iyslaDrl( s;u4alxoirctatopDraues;t)trxmxo3oo4aptnmnei (fsrur(r ot4oetnio3iatlm2ulu snu0alenmocoydfa rlivi;(0trumio3oy4ol   fvils a2ta(m no4tpe  i3tyslmDumn snt)trerxfciydfm r nes s)s2xmio3ou4altemfvi sfs2ra( ont0tpenii3ilt a rau o (4 lxnxr iydopteaivi (0s2uo(m3iodlpenmfviltf rtaxmp;t1alx iiciaslaDulumsn()texoxf3ty1lmtraues ( teto(m ny1apt lfvi tf Drr(mpou1tptnioeiyslm2ranvs;u)trtomf3totlm rauei s) exoxm3io1om e ncs s  rtmx poo0alx moeiad s2rlumpnt)aetoif3oydop  ln i;( sexrir3oy1lptnlieils  rumx p;t1oleoioetydfmDuau o;(4tetnxocoadopDr ueilt0 eumir oo4amt micsltfarrm(mp;o1aexn ieild a rl( ont)arenifciy1lmt ai s s0texrxm3iy1ap  lici sfaDrmurpoo4tlxnmi3tldfs ua(mp (0tltnif ia1oat aivslt0 2uoxm ny1apeemiviasf rrmum oo4ope  feiyt s rmnvo t)texomo iadoa rlues t sexrim3nu1ale  ieia( srrmuroot1aee mf3ildla2rmnvo u0aetnirciy1fateaivs (  2xoxo iu4open ieta( aDtaumoou1oexn ictys s2ulnvs;(4artrxr3iatlpt auvsls)texr(rpiy1alen ncsls srraump;o0tpto f3tas a eanvp;t4trtoxo todom r ueil(0t2to(mpiy4om e nvia(f rtau oot1tetnmfetas s uanvpnu) exrxocoo1la  aneols setmio3oo4op emfcsl(fa2rmumont1opeoii3iydlm2emu o t4 lxnmf tydfpDrluvsls0seto(opou4llt lnvt t)s2raurpot4teeomf3tlsls rm( ont) etrifciy1omDeaivs;t  rur(mpny4omte iciasfsDum(m ;o1tlxoifeiysls ea(vp;u)trtnio iytomt anei t t2uo(m3oydlme mfvsasfaDrrxmo;o4oltnii3tysls uauvo u4arerir3oytomtr n slt setmxr oy1omtnmfcs s a2tau pot4aexo fciatls eau on()arxnmf ty1fp   n i s seuoim io1lmte nvtat  rumurpno1aee  ictlsfm ua(vo u4texrxo oadom   i i (0 etmimpnodlp elnvils) rururono0olxo o3tltls2ua(vsn()trxoirctotop rln s;(  rtoim3ou1llenmivi t s2uaurpnt0apxn fetydfm2elu o t)tetnxr3tytla r nes;s trxrir3iudopenmfetlt)aDtrx p;t0alt  fciad s umu p;u0 eenxocootomt aues t  etrxmpoy1ll nmiesltfsDraxr ou4aexoiictydla ranms t)alxoio3to1optr u s (0 eumir3iudol e fciat)s2rm(moot1tetniieils m2elnvo;u4tltnxr3ta1fpteln ilt0t2uoxm ou1lp nlneilsfarurum ;t1tpto f3ildls ulu o u0trtnir3iotoa  livolt0setmxr3nu4ape lies t a2ua(mont4apt  fetyd m ulnvo u) exnifcoy1laDr nvi ()s2trxmpiy1lpt  nvsls s2rmu  ot1oleo ocildlm2rmumo t)aexomrcoy1fa  lneo s  rtoxrpnu1llen nvsl(fsDuauroou4opeo fetyslm rln p t4aeeoxo ta1fmDrln o t s2xo(rpiudal nmfet (fsDurxm ou4alt iociltls2umn snt) etnxocoo1fmte ivi s seurxm oo4optnlfeias)aDumur nt0tetnmf3tasfm2umnmo t0 exnxo3oatop  an il()srumimpoudamtemiviat  Draumpnu1aetnii3iadlmDulu p;(0aetnifciotlatrauvi ()s2xmxrpoudam nliesa( aDrm(rp;o0oexoio3taslm ra(vs;t) lxnmfcootfmt aues;()tetrim nu4lm   fvtlsf ruau pno1tet moetyslaDelnmp;u0aeerxrcoadlp   i il( seumio3io4amt lnesl( s2raxmonu1aeenmictytlm2ean snu)arxrxoctotfpDe n i;( setm(opiu4ol nlfcs (fa2trxmp;o0oleoioeiysfm2rm(mp;t4aetrmocia1lmDeluvs t)trtr(o no4amtn icsat)srurxmpnt1oetnioetlsfm rlnmo t) leoxr3ootfa  luvo s0t2xmirpno4omenmfei s)sDrmum ;u1tltomi3iys m elnvp;(4trtrio oo1fa rlu ils0s2uo(m3io4omeemfes s a2ur(rpot0alxo ieiyd a uau s;t)aetrmocootfp  anvil()seuo(o3iy1ol n iesa(f rraxrpou0texnmfctat sDuanmp;u4 eenmo3to1om eau ilt)sexo(m3oo1al emiei t aDrrxm ;o0openio3iadlm2eluvs t4tleomr oadfm raivo t0 2um(rpno4ol  mfetls)srrrxronu4tlxnmfeiytfa ulu p t4aexoir3oa1lp elnvi t) 2umxm3oy4ole  ncsasf 2tr(r ;t1openmo3tatfm2eauvp (0alxnir tatfaDe uei;( srurxr3iu4lpee ncsls) 2tmurp;t1olxn icild m2um(mp ()teenmf oadlmt an o s0teur(mpiudope lnesl(fartau poo4opeomf3ilt a2rm(vp;u4texoxf3tydlpt aneo t0t2umiopnodopt mivs t) 2rmxr nu0aex  fctydfm2ua( onu0aeerif iytoaDelnvsls0tetmxm no1am   iciatf 2tax o;t1aleoiociadls2rm( p;u4alxomf3oy1lp rlu s (0 rxr(m3oy4am emfvi s)a2ua(mooo1tpt moeils aDul(vpnt4tleomrcia1oate u ol()texo(r nudomen nvt s  2taumo;o1opeoioeiytfsDumn p t4trxnxf3oytlate ivs;(0 rurxmpiydlle mfetls)artmx oou1alx  i3iatfa elnvo;()aexnioctytfm rlnes s)trxriopou1aptemnct t)sDrru pou1olto i3tadls2umu s;t0trtrif iydfate ueol( trxrxopnu4lpeelfcs ( aDur(ro;t4apxo feiatfa2umnvs t4tetoio3tydfaDraivs s0srtmxr3nodole mncs ()a2ra(ro;o0tlxoiietad s raumpnt0 lxrxr ia1fa eaieo ( texoxrpoy1lltn ivs s) rrmxront1alt miciadfaDel( p;t)tlxoxf3iatoa elneo;t teurim3oudamte nviasfaruaxront1tltn i3iltlmDeanvpn(0areomr3iodlp rlneilt0 2trim3iu1am eliesl(farra(mpoo0oexo oetydfmDem( s;u)aetrmrciydlp e uvs s) 2umxm3ou1llenlnvsa(f Draur ;u0tee mo3tas a ra(vs;t4altrxf oytopt luvs;t  2xrio3oydop nlnvs (fa2um(  ;t4olxnifciysls2umu o () ltoif io1lp eau i s)srtr(m3nydlm  lfvia()arrax p;u1oleo o3tasfa eln p;t0teerif oytfpDe u i (  2xmir3io1lmtelfcta( arrmxro;u0teenmieildfaDumnmsnt0alxrxr3oo1lp e ues t0texrxr oy4al elnet () 2ua(r nt4tltnmi3ils sDrmuvp;(4alxnxo3oy1oaDe uvslt0 rtoiopny4lp  mnctasfsDururp;t1aexnmietysfa rmuvo;()texoxo iy1laD lu i t0 rurirpny4ol   fetlt arraurpnt1texnii3iyslm2rlumo;(0 rxrifcoa1lmtraues t)seurio nu1open icslsfsruax p;t0ole iocilsls raumonu)tleoxocia1op eli i;t)seuoxr ny1aleemnetat sDum(ro;o0oex ifcildfaDul( onu4 lxnxrciydfpt auvi;s)trxoxr ny4lltemfcsa( a2rrumono0alxomfeiltlmDrm(ms t4 eenxo3todlpD  nvils0 2xm(m io4lpt lnes ()s2rrurpou0optnmfeiyt m2ranvp;t4trerifcoadlmD livo;( teuoxo oydal emfctat)sDtm(moou4oleo feiat sDum(ms;(0aeerxo3tadfp rlues s0 etrxrpiy1apee ncs ( srrr(r ;o0tee mo3iytlm el(ms t0 lxomr3oy1fp eai o s  rurim ou4ol e ictls  2ra(mo;t0aex ifetad s rlu onu4 rtrxr iatom rlnvo (0 euoxmpny4ope lnvtat a2rrx  ot0oetn ociad s2um(mpn(0 ltriociy1laDe u i t0trtrxo oy4om n ietls  2rauro;o4aetoif3iasls2rl(ms u)alxrmo3iodfat auvols) rxmxmpoydop elfviat)arrr(rpnu1teenii3tlsla rlnmsnt)tleomr ootopte ivs s0s2urxm3ou1om nlncsl(f rum(moou4tpeomietydfm uaums;u4alxrmrcoa1op  livo ( teuoxopiy1olt  nctlt)a2rmu pot1tlxoiieilsfmDel(vsnt)trenioctotop  li s s)srxr(opiu1lpt  ivt sfaDua( poo4ale io3tlt a emnvs;t4artnio3todlm  an o s t2xoiopno4olte nvs t) rurumo;o1opxoioetasfs elums () rxrxo3tadomDraues;() eto(r oydap elnvsasfsrraur oo1teenmf3ildfaDrmuvs (4aetnif iodoa  lnvs;s)sexr(mpno4apt liet ()s2ua(  ot4oet iietasfm2uln o;t0 eerxr tydopDrlnvs (  2uo(rpnu4om e ivsl(fsDtaxro;u0oexomfciad aDelu s;t0 eeoif3iodoaDrai i;t)srxo(rpou1ame mnvsatfs2rm(m oo1apeomo3ilslmDea(vp;(4 reoxf iytfptr i s;t0 rtmxm3nodll  livt (f Dta(rooo1oexomfeiyslmDul( ont)artomrciy1omDe ivi (0 etm(rpny4op elncta()arrru p;o1tet  icildls2emu o;t0 eeoxrcoadlpDrln o;(0srtr(rpny1lpe mict (  2umxr nu1tleoifctyd a rlump;t) etrircty1fm r nei;s s2urio nu1ame mnetlt)aDuau  oo4aeeniociat a rm(von(0trtnmf iotlmDrli olt0srtoxo ny1lpt mnctatfa2uru o;t0aex iiciydlm2uan s;t4alerir oytfa raivi;s0t2xr(m3no1lpt lfcsa(  Draxr ;t1tptniiciltfs umnmp;u4 eenxf3iotopDe nes;t)t2xmxm3no4aptnlnetat) ruaumo;u0oexnmo3tls aDuanvsnu4trerxrctytopt au s t) 2xr(r iu1lltelfet t) rurur ;u4apxomi3ild mDrl(mpn(4aexnxocoo1fmtean ilt0sexmxr3iu1ol   fciat a2raxr nt4tetoiictls a2rm( p;t)aexnxo ia1lateau sls) 2xrxo3ou4op e nciat) rur(  ot0apx if3iasla2emuvo (4 reomrctotlmDean ols)sexrxrpiy4oltn ieslt  Dra(mpno0apxoifcias a rmu pnt)aexomo ia1op eauvo s0 2uo(m3oydapt mncs s srrrx  nt4oexnmieiadfm2uau s;(0areoxr3oydop   i o;() 2xm(m3oodamtemnvil( srua(rpnu4tlxnif3tys s ua(mp;t) ltoif3iotlp  livo;t  rur(m3oudoptn ivia(faDrmurpnt4olt io3ildlsDemu p;t4arxrir3tatom   nvs t)tetrim3nu1al  lfet s s2rm(mpou0tpx  o3iaslm rlu ont)texriocootlpte ies;t)texr(mpny4optnmneslt) rumxr ot1altoiieiad aDrluvpnu0aetrxr3oatomtrauvi t sexm(m3ny1omte ietls)aDrru  ;t4tlt mo3tydla2um(ms t)texomr iytlptrli s t)setmxo iudoltn ivs t  2tmxmo;o1olenmo3tatlaDua(mp u) e
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt t2xo(opny1ol n neta( s2uax  nt1olxoiieiasfsDeanmo;u) exnxfcto1faDr u s t)t2xrirpoudam   fcs s  2urxmooo1oet mf3iatlsDean o t0aexrif oadop eaiei;s srumir3iu1apenlfvt sfaDurx  nu4olxn fetadfm ra(vo;u)alxrmo ta1laDelivo s  2trxmpnu1llee nci t sDta(  ou4tlt iociat a rl(mo u0teerir3iadlmteluvs;s0setrirpno4omee ncilt a2rrxr ou4tlxnif3ild m rm(vp;u0 lermo iodla raneo (0s2to(r3ny4llte ivt s)srra( ont4tleo ictydfsDra(mp (0tlerif3totopteanvi;()t2xo(o3oo1ope  nvt s)s2rmu  ot4apen f3iasfs ra( p;t4arerif oodfpte u il(0 etrimpnydalee nesl(  2rruro;t0tlxomieildlmDulu o u)trxrio3tatfm  lu i (0srtr(o3ny4am nmfeiasfa2rruront1aptomietad sDrln s (4 lermo3totoa e ieilt0sexmxrpoy1omeelivslt)s2rmx poo0aee  feilt m rmn p (4altrxf totlpt  u s;t0srxmir nydlm nlfvsltf rtaxmoou1alt iicildfmDeanms u4trxnxf oydlaD  nes s0texr(o3iy4optelivt ()a2tmum ot1aeen f3iys sDuluvo;t4 rtrifcoa1oatrluesls  2urir nudale lnciltfarurum ou0aexo ociatfsDumump u0tltrxfciydoaD auei s  rur(m ny1alenmncias  rrr(m ;o0tee micilsfaDulu s;u0 rtoio oytlpt  ieo;(  eurim3no1lp  mfvilt  2taxm ;u1tee  oeiys s2uaumont4trtrif3tytfa raueil(0sexo(mpiudameemnvsl(fa2uaxr nt4tet ii3iadls2ua( pnt)tlxnircoy1om r ues;s)trxmxm no4oltemncslsf Duaumonu1optniicias m2ran on(0areoio oydlm  lneo t teum(r oo4am emfctat srum(ront1olenmoctldfs2eauvo u)altnxo to1late ivo (0 eumimpiy4ap   icsat srtmxrpnu0tlen f3iytls2eluvont4 eenmf oy1fpDr n i t0t2xoxr oy4lm  lncslt)s2ua( pnt4tpeo fetad m ua(msnt0 renxocia1fpte i sl(0 exo(r io1ap elici t  rum( p;u1tlxoifeiys s rauvp;u0 lxrmo3iydomt aueo ( teum(r3iu1ole  ncilsf Duru onu4aee moeiasls2ul(vo;t4aleoxo todlate i i;s)t2uoiopiu4lpte ietlt)sDtmx p;o1alxoifciysfa rl( s;(4 etoxr3tatfat lnvols  2xoiopny4olen fesatf rtrur ;u4ole mi3tyd m2elump;t4tltoiocoadoaD  nvi t0trtr(o no1ap n nvil(fsrrr( pnu4apxo ictldfsDrluvont)tetnmf iytlat  neils)tetmim ny4ol n nvia()aDrr(  ot0aeeo i3iyd mDuluvpn(4teermr oytlm elueo s  rxoxopiodomtemnct t  2uau o;t0oexnioctadfm2em( p;u0 lxoir oytfa   u sl(0texrxm ny4ll  lictlt artr(ro;u0oex mfctldla um( snu4alxomocoo1lpt an o t0trxrxo3nu4om   fvtatfarrm( p;u0apt  oetysls2rln s;u)aleomo oo1fmtr neolt)s2uoio3oo4ol nmnvsat) rtru  ;o4tee  f3tltlm em(vpn(0tltnmrctydfmtrauvo s sruoxr3oy4lpenmnetat arrm(r oo4oexn ietad mDranvs;() lenmocoa1fm e nvo;t)tetrxo3nudlme  fcsl()s2rax p;o1olt iieiydlm rlnvsnu0aexoir ia1om ranvi t s2xoio3io4amtnmfvi tfa2rmurpnt1opxnmo3tltfsDrluvo;()tltnmf3oytomte nvo s0seurxm ny4lpte fvt t srtaur nu0aet mfeiys aDrlnvp (4 eeoxr3oo1fpDeau sls0s2umir nodlp   netas)a2trum oo0oeto oeilt s umuvp;()aexrxocoadla rau s;() 2trxm3ou4altelfetas)a2uaumpoo1tlen ociytfmDemnvp;t) etrifctadlmtran o;s trxrirpoodamtn nei t s2tru oot0tltnioctytlaDrlump;u) lxoifcoo1opte ivs s) ruoxo iu4lle mfeiasfsrtrx ooo1ope moeiys s elnmp;(0trxrio3iadlaDrln i s trtoimpny4lp nlfei t)aruaur nt0aptoiociydfm rm(vs;t4aetrmf oo1lmtr neo (  2tmxopiu1lme  fet (f 2ua( poo1tptniiciasfa ea(mo;u0aetrioctytoa eluvols)t2xoio3iodamtelivi s)a2rm( pot0tptniociyt mDrmuvs t)teenirciy1oatrli i;()srtoxm iydlmt lies sfarum(rpou1apt miciltlmDrau p t0 eerxocootfaDe uvs t)s2uoxm3ny1ap e netlt a2tmu pno1olxnmf3tltfm ra( s;()treoir iytlpteaieol(0texrxopou4altemfci ()a2ua(mpnt4alenmfeiat sDrmu p t4aetnif ty1lmte u i s)trtrxmpio4lpt  ietat a2rmxrpou1opx mi3iyd s ulu sn()tltrmf3oodfaDeli s;(0srxmxopnu4lm nlfcilt)s2rrxroot0ope mfciyt m2rl( on(4trxrioctydlmDr nvs ()s2to(rpno4ol nmfesatf Dtmx ont0tetn o3iydfm eauvonu4texomf3iatopteanvo t0sexmxrpnodame mfvs s) 2ur(r oo4tpenioeiasfa2uaums;() exrifciadlm eanes;t)trxo(m iodlpeemnctl(f Drrur ;t0optnmo3ilslaDel(ms;()tlxrmfctydlaDr i o (0 rum(mpny1lp  mfvsl(fa2urumpoo4oeen icilt mDra(mp;u0 reoxf3ty1lmteln s t)t2ur(r3nydame lfvsatfaDrrum nu4tpxo i3iatlsDra( s;(4 etrmo tadlp  li s t0 eto(m no4om nlnctat) rrrumo;t0aeen f3tlsla uan o (0alerxrcoadoaD  n i s  etm(o oo4llen fesl(f Dumurpnu1tlx mociyslsDeanmpn(0artrxf tydomtrln ils0seur(m oo4lmeemfvils)a2ta(roou1tlen o3iytfs2emn snu) rtoxociadfaDe nei s0 2ur(o iudalee fesatfsDtrumpnu4aptnif3ilslmDrauvpnt0 ltnif totfa r nvi;s  2toio nydoltn netlsfs2rr(  ;t0aeenmf3iydfm ea( s (4arxnmf3oy1latrlu slt0 rtoxr ou1llee fciasfsDrrxm no4opeomo3tysla emn s t)tlxnmf3ia1lpDr nvs (  etm(opiu4ope lncilt  Dtmu p;o0tltoioctldlm uau o () rxrio3iytom r nes;(0t2ur(rpny1lpee nctas)a2trurpnt4ope  i3iysfmDem(mp;u)tlxrmr ta1oaD li i;()texmxm no4lme  fvi tfartrxmooo4tex iietytla2ua( o u)trxrioctodlmt  i o;t)setmxm oo1om  lnci (  Dur( p;u0alxnmo3ilslmDelnvp () ltoio3ty1fp eliei;s setr(opoy4lpenmivi sfartrxmpou1tlt ioctad m2rau snu0aexoir3oadomtrlneolt)truoxm oydopeemict s a2rmu  ;u1aptnmi3iadls eaumont4altomf tydoateau o s)srum(o io1aleelneilt)sruru pou4ale  o3tadfaDuanmp;u)aeeoxocia1fp rlnvi s0s2xmxm nu4llenlfctat) rtmx  nu0tltnmo3ils m2rlnvs;t4 lenxrcoatfmD  nvslt trxmio3io4ll  licslsf rrmu  nu1tee  iciysfa emu sn(0alxnif oo1laDe ivs t) 2toimpny4opt lfetlt) Dtr( o;u1aee  fetls s2rl( p;(0arxoxr iatfp eaivils) exoxr iy1opt  fet t)aDrr(rpot0aet  ieiad aDum(ms (4arenio oytla   n s s0s2tmirpiy1op e fes t  Dtm( o;t0tpenmiciyt a ul( sn(0trxoir3ta1fa  ai i;t trxmxr3no4lltnmivtat a2tru p;o1olxomociltla el(vpnu0tltomo3to1omD auvi;s trxoxmpiydom emiesatfa2rm( pnt4ope if3iytlm2ean pnt)teeoircoy1fmD lies (  rxmxo ou1lmee fct t)srtr(m no1oexo o3ils mDemu snt0teerxf3tydlpD li ols0seurirpoy1amtnmncslt  rumuronu1tpeoii3tasfs2rl(mon(0tlxrirciytlpDrlueo () etrxmpnodlltnlfct t artr(r ;t0tleomietys m2rluvon(0 rtoifciytfa e nvo;s0s2xr(m3oy4olt lncslt arra(r ot0olx iictasfa rl(mp t4 rxrmfctytomtraies;(0teumxrpno1lm  lict ()artm(r ;t4tptn feiatlmDrm(mo;t)aetoxo3ty1lm eluei;(0srurxo nu1omenlnvs sfa2uaurooo4opto f3iysfs emnvp;u) rxrir ootoa r uvil( teumxm io1lm e ici t a2rm( ono1tpto iciltfa ranmo;u0aetoifciodomte neol()trtrio3iy4ol nmneiat arumum nt1opxo iciysfsDul(vs (0 renio tadlmtrlnvol( s2xm(opiu1omt  nei tfsDua(m nt4apx ioeiatla ulums ()aetrmfcoy1lpD  ueol(0tetr(o nodapee ieil(faDuauroot4tptn feild sDuauvo;(4aexnmr oytfmtranvo s t2uoxrpio1lptn ivtls aruaum ;o4alt moeiatfm2em(vo;(4alermrcia1lp   i slt)trum(opiydoleemictlt aDraxmooo0aeenmf3tytfmDelnmonu0 rxrmrcoy1fa  lu olt)t2tm(m io1lleelnvtasfsDumum ou0altniieiltfm2em(vpn(4aetnmociadfm rlieo;t0sexm(m iu4lpeelfcta(f 2rmx ono0texomf3ilsfm rm( s;t0 eermf3totfmt  ivi (0tetrirpoydam   ncs t)srtrxm ;o4olenifciyslmDemuvont0 rxrxf oydlm rlivi t) 2trir3oo4ameemfcsls srua(  ;o0tlxo iciad sDuauvo;(4trtnmo3iotlmtr neils)tetm(m3io4ame  nci t srur(r no1tlx  fctyd s ea( p;(0aeenmf3oadomDeli o;s0s2tr(m oy4opt  nvtatfaDum( pnt4aet ifcildfa2eauvs u0teeomo3oadfaDe ivi ()trumxr no4lmen fvsa(f 2ra(mpot1tpenmietls sDua(msn() lxnir ty1fmDrluei (0srxrxo3oydlp   fciat) Dur(rp;o4ape  fcildlm uaump (4tlxnmf3ootfmt  neils)s2ur(m3oo1apte fvsa(  2umxrono1oleniociytfsDraump u4 rtomf3tydomtelues s)srurir iydol n ivilt  2uaurpno0aexoio3tysfm2eaumo;t)tltomr3iotlp r n s;t)trtr(rpiydolt  iet tfsDtaump;u0ape  ieiasfaDuan s;u)tltrmr tydom e nes s  rxmxm ou4om elfctl()a2rrump;t4aeenmfciatlmDem(ms;(0trerxrcoodfmtrlieo;()sexoxm3oo1al n fvsasfaDuau poo1aetomo3iytla2uan p;()tltrxo ty1om  anvi s0seumxo3ou4ale mietat)sDumurpnu4oex  feias sDrlu sn()aetrifctatfptrauei s) etmxm3ny4omtemneia(fartmuroou1ale if3ildlm rmuvo t4alenmrciydfm elu sl( t2xoxo io1lltelnetas aDurur no4ale mieiltfsDemuvo;u4altnmf3oa1oaDe ueolt0 rtrxo3ou4ll  livslt srtm(rooo4aptn f3ild aDeauvs t4tlxnxo3ty1faDr ueo s0 2xrxopiy1al   fci t)arrmum ot4apt mf3iat m um(vsnt4trenio tytfm raueol()s2um(o3io4om  lnct s) Dtrxrp;u4aleoiiciysfmDem(von(4trtoxocto1opte nei s) rxoxm3ny1op e icils a2rm(rp;t4aeenio3iadfs ua(mo t) rtoio3tadfptrau sls)texo(m3nu4olenlnvtls)srrrxm nt0ale mi3iyt aDrln s;u0 exoiocoytom rluvi s0srtoxrpnodop  micsa()aDtaum ;o4aeeomfetat s2emn snu0alerxrcty1fpDrlnvi t)seurxmpiydaltemfei (f 2taurpoo1alt  fciyd s emnms;t)tetrir tatoptelieo;() rto(o io1omtelivsa()aDuaxm ;u0ope micildls2ua(mo u4tltrir oa1lat anvsl(  rurxopnodlpeelncsl()aDrau p;u0texo fctldfm ulu snt0trxnio3tadlaD aivo;(0s2xr(m oudolt mfcslt srtrx poo4aexnii3iadlsDem( p (4teerio oatlaDrau olt0t2xoimpoo1alteliesa(f rrrum ;t1oexomfciysfmDuanvs (4aetnir3io1fpD anvi;s  rxrir3ny4omeemfvils aDuru pnt0tpeo iciydfsDulnvs;() ltrxo3iotlmDelueilt)t2trxr nydlpenmietasfaDta(m ;o4oeeniieiydla2elnvsnu4aetnir3tadfaDr nvi;(0teurxo3nu4am nmfes t)aDrmu ooo0aleomociatla2em(ms ()arxnxr to1fm ranvsl()s2toxm oy1om   fei s)srtr( ont4olx  f3tat aDuau p t4tltnmo iy1oa   uvo s) euoxmpoudaptnmict s  rurxm ot4aexoiocilsfa2emu pnt)aeermo iatfmDrai sl()trurxr3nydopte netls) 2raump;o1tltomoeiadlm eln o t0aleomo tydfaD lues t0tetr(o3iodopenmiei t)arrm(r ;o4tex mo3tlsfs uanvo (0artnmrcoo1fmDraiei (0 2tmiopnudomt mictltf Dtaxm ;u4ale mfciys mDemnvonu)arxnxf3iodfmt luvols  2umirpio4lm elncsat)srrru poo4oexnioeiydfs2em( p;t4 etnxociotfp rlu i (0sruoxo3ou1apt mivsa(f Dtmxm ou0alxn ociatfa2rmumpnt4artoxf iy1opt aneol(0 2umxm3oo4omtemnvi s) rrm(mono1tpx mfetas m rauvp;(0tetnxr ia1lat  uvo (0 2uo(r iy1omtnmfcsltfsrrrump;u4aetoifctlslm umn p;u)teerir3tydoaDelneil(0 2xr(opno4lp   ietl(f 2rru p;t1tpeomfeiltlaDum(vsn(0aleoxf3oatfmDrluvsl()teurio iy1llte nvi ( srrax onu1tpto ocilslmDumu snt4 etnxf oo1la e ieol( sexmxmpiy4llenlivsas)s2raump;o1opt ifeiat mDeluvo t)tltrxf3iydfmt  iei;t t2xmxmpoy1lm elfvsa( a2tr(r ot4altomfetydfsDel( pnu4treoir tatlpt  uvi;s teurxr3nu4apeelivs sfsDururp;t4alenmo3iatfaDeau pn(4tlerxfcoo1la  aieil(  rtrxmpiy1ll nmnesat)a2umu p;t4aex ii3tadfa2rl(vo ()artrxr ia1oaDrai o s t2tr(r3iu1ome lfvsatfa2tr( o;t1tltn octatfm2rauvp u) eenxo oydfpDeluvo;t) exmxm oo4lp nmnciat) 2rrum no1aex mieiadfa2uluvp u)treriocia1lmteauvsl( srxo(o iodlleelfcsa( sDrrx  ot0teeo oetysls uaump (4tltnxr iy1lpt lu o;t t2uoxopnudal nlfctasf rururp;o1tlx mfctatlaDrl(vpnu)tetnxfciydfate ivi (  etoir3iy1om  mncta( a2trx  ;t4olxoif3iysls ua( p;t0 etnxf iatoatr u ils) 2trir3ou1lme mnct t)aruax  ;t4openii3tat sDuau o;u4tltnxr totfpt lueols  2xmxmpnodlle lneiasfarur(mp;u0olen oeiytlm uln onu0 ltrxf iydoa   ivsls) etm(m iudoleemfctls a2uau p;t0tlenifciys mDuauvs t4 eerir3oytlp elnei;t s2xr(opny4ap elncsls  2rm(  nu0aex miciltfm ulnms;t)aetrxr tydfa elneo;t trurxmpoy1lp nlncias) Drm(mono0tlxoif3tydfa ulnmsnu4aexrxo iatoa r nvs (0 exm(r iy1lm nmfeils)sruaump;t4tlx  fetydfa2umu p u) exoircto1oaD luvi s) 2trir3io1omeelnvsls) rtru  ;o0alxomictld s emnvsnt0trtrmr3to1lmD aieil(0srxo(mpou1llenlfvtls a2rrxro;u0tpxn o3iadfmDemnvp t)tltrio ta1fp e uei t0tetm(rpnudop  livt sfsrrr(rooo1aee  oeilt a2eanvsnt0altoxr iadlmteln o;(0trtoxr3nydaptemivtls  2raumpoo1tlt if3tldlm2em(vs u0 etrmr tadlateanvsl(0t2tmio3oo1omeemieiasf Drmu pot0optnifetas aDrmumo t0 reoir3ia1oa r i olt  2tmxopou1am nmnvslsf Dumxroot0aet  fciys m2uauvpnu) exomoctydfaDe uei;s) ruoio oydame lfvi s) Drax poo0tlx  ieilslm2em( snu0tlenxfcty1omtraivol(0 rtoirpny1aptelnvsls  2rrxm ;t1tleomfciyt a2um( s;(4 etrxf ootla  auvs t)t2xr(r no1om n ivsasfsDtrx pno0tptniictatfm2rl(mont)tltomf3oy1oa  lnes s  rxrxm3iu4lm   nvsat a2tm(r ot4ape  fciltlsDrmn p ()aeenxrciytop r nesls  eto(o nydalenmivilt  Dum( oot4apeomf3iyslm2eau ont4aexomrcoadlmtranes s0t2xoir nu1ap  lict s sDtax  ;u1opxomictys sDeanmo (0 rtoio ia1la elieslt srurir oy1ope lfetltfsrrru oou4olxnmi3tyd mDrlnvont) etoxfctatlm   ueilt0 2xoxr3no1amtnmict tfs2raurono0aet mociad a uanmpn(4aeeoir ia1omD aneo (  2tmxo3iy4amenlncils)arumxmoot4tpenio3tad m uanmsn(0 ltrio oo1op raieo ( sexoim3nydaptnlnctls  Durxmpnu0aptn fctyd m2ra(mp t)alermrciytfa eli ilt  2xrio3iydlm nlfeils) rrmurpnt1aptn feias m2ulu o;t4tltoif ta1lpD  i i (0tetmir3io4apenlictltfa2rrx ono0apxnmfctls m2em(mo;t0teenmo3io1fp  lnei;s) 2tmir3iodomtnlnvs ()arrax oou4aleo fetytfa2emump;t) etnmr3todfpte uei ( truoirpio1ame mictas aDurur ;t1apxnmo3ils mDean onu4 lxrio iotop r nvils tetmiopnydoleemfvsas)srrm(rpno1tpxnmf3tld m um(mp t0tetnxr3to1omDean i;t) 2umimpiudomenlfesat  2rmum ;t1alx iietydfs2rlnms t)teerir3ta1la r u i t  rxmim nu4ol nlfeias)srrru pot4tle iieildfa2um(vpnu4 lerif3oydfatr ivo;t0seumio3ny1olt  fcsl( a2uaxr no4olenmf3iytla emnvo (4 reomf tatfp ean i;t0seuoxopoy4lmen fes tfs2umx p;u1oetnmo3iytls uaump u0arxomrcta1om raneo t  etr(r io4al nmncil( arta( pot1oeeniocilt s rlnvon()trtrmo iydfm  lues t)trtr(rpnu1ale lfeta()a2urxmoot0olxnmf3ildfsDelu o (0altnmr3ootfatelu o s t2to(rpnu1lm emiet s) 2ta( p;t0aet ifetat m2rl( p u4 rtrmf ootomtr nvsls0trurimpnodap  mics tf rtrx  nu0aetnif3iydfsDua(vs;t4teenxrcoy1fmtrlivsl(0trtrxm3ny4alte fet ()sDtau ono0oetn feilsfs em(vsnu0tetrxo oodfaDraueils)seuoir3oo4ap emivsa(fa2ur(m ot0alxoif3tyslm2rl( s t4 renxfcta1oatrauei ()tetm(mpoy4omtnmietl( srtaum nu4apenmocild m2ea(vpn(0arxnio3iatlptraivs s setoxrpoy4al nlicslt)srum(ro;o4oeeo fciat a eln on(4 rtrio oo1la  anvi s) 2trxo ny4ol  mneias) rtrxr ot4alen oetyt m rmumo u4 rerif3ty1la  auvo ()t2xm(m iy4lpt mfvsls)a2trx  ou0tltnif3iltls2rlnmpnt0 ltnmr oo1lmD  uvo;t0 rumim3no4olt lfetlt)artaxm ;o1opeoioctlt a2ran on(0alxomocoo1oaD  uvols)srurxo3ou4apt  nci (f Dta( ooo4ope moetatlm2ea(vs;u0teeriociadfm   u s;t) rtmiopiy1llt mivi (f Dtmxrp;o4oet if3ildfa2ea(vs () eeoxr ty1omtraieo (0teuoxr ny4ap   fcia(fs2taxro;t0teen oetytls rlnms;(0 eeomfctatomtrlneols0trtr(o ny4opt lfvi tfs2umurooo1oexnmoeiat a rauvo (0aeeoxf3ty1laDraies t0s2xrxo oo1ome  fes tfs2ta(r ;o4oeen ociyt mDrlnvpn(4 reoxf3iydfmDeau sls0seumiopny1ape mivsasfarurumo;t0apx moeiad a emnvp;(0trxnmf3iodoptelu i t0 rxoxo3oy1lm   neias)a2ur(rooo0aexn feiytfaDrl(vo u4 rtrxf tatlmDr neo;t0s2xm(m oo4apeelncs s a2tauroot1aleniociaslsDel( p t4trtniocty1lpDe u slt  euoxmpou4lm n netlt) Drm(ro;o4oeto f3tytlmDemnvp;(4artrxo3oytoaDelueo () rtm(rpny4om  lfetas  Drmxroot1oetn iciatfsDrm(vo (0arxoxf ty1lpD aivi s) 2tm(r iodllen fes t srrmxm ;u4opt  fciydlm em( s (4 rtrmoctodoaD li sls trtr(o iy1alenlfesas srta(m ou4opxn iciaslsDemu pn(0arenir oytlpDrli i s0trto(o oo4apeemnctas)arrmu pnu1olxoif3iys mDrmn ont)trtoxf3totfmtran s;t) euoxm3nodapeemfet tf 2tmur ot0apxoifctytfm emu p;u0 ltrmf oodfpDe uei s t2xmxr3iudopte nctasfs2uaxronu4tlt  f3iadfa ua(vp t4aleoiocoytlaDrliesls trto(rpou4om n fvil(  Duaum ;u0oexnmi3iytlm2rl(mo;t) rermfcoy1lmDrln o (  2tr(opoudoltnmictltfa2urumoot4teenioetld aDrmn p t) etnmo oo1lp eaneolt) etm(o3iy4opt lnvs (faDtmu  ot0oexniietadla2umumo;()texoxf ia1fmD au ols  rumim3oydalt  icia(fsDta(mooo0aeen icildfa rl(mo u)aeerir3iydlmtrlnvo t0 etoxr oo1lpeemfci s srumu poo1teen fciatfsDemuvo;(0aetrmo3iytlpt livi (0srxo(r3iu4ll  lfcsas)srtrur ;t1aex  i3tltlsDua(mon(4 reoio3oydfm eanvs t)trtm(o ny1om elnvt s  Dtm( pou1opxnmieiasfmDum(ms t)tleomf tadomD aivs;(0 exrxo oodlme lfciltfsDumxro;t0oeenmoetys s umuvsn(4 etomf3iy1lat aues;( sruo(r io1apt  netlsf Duauro;u4oet iieiadlaDran p t0 ltoir ootomDeli i;t0sruoimpiydlp e ictltfarraumono4altoiictltlaDua(vp;u)texomf tadop rlies s)s2toxr3no4om nlicilsfa2rmu poo4apto ietad s eanvo;(0 etrir3oatlm   nei s0s2xmim3oodlpeelivilt aDuax p;u4oet  octas aDel( ont0 etnir tytoatelu i;t)s2xmirpou4aleemfvs tfs2raxmpot4opxn ociydlaDeaumpnt0treoio3iatopDeluei;()seum(o3oydape mfvil()srrm(ronu4tptn fctysfa2rmnvo;t)tetniocoy1omD anvi s srto(rpio4ll e iesls a2umu  nt0tpxo ocilslmDuanvsnu)alerxo oo1lp eliei;t)seumim3oo4ale  iciltf rtrumpoo0oex miciasls rm(vonu0tlerir tytoaDeaueol(0trtoxr3oy1om emictat)sDua( pno4tpenmi3tlt s2eanvsn() lxomr oatfa   ieo s0trxmim3no1op nlfet t) rua(m nt0aeto fctasla ea(vo;(0texnir3tadla elu o (  exrxm3no4omeemivia()s2ur(moou1olxoii3tldlmDul( pnt4trerxr3ia1fm e nei;t srtrxrpnu1lltelfesatf 2uaxmpou4tpenio3iatfmDea(vpn() eermr3oy1laDr uvo t) rtmxopou1lmtn ivsl()s2taxm no4apx  iciltfa ra(msn() ltoxfcoy1optrauvsls setoxrpoy4apenlfes (fa2rmump;t4aexn feiyt a2emuvonu4 ltomr3iydla   neol(0tetm(mpiy1lp emfetl(f Dua(rp;u0aet ii3iatfaDuaums t4 ltoio to1la rlnvo t)seto(m io1apt lncilsfa2tax o;t1altomiciasfs ea(mp;u0 ltomr oydfpDeanvils0srxoxopno4ape lncta()a2uaxro;t4apeniictatfs ra(vo;(4tleoxf tytlp elivi s  2toxm3ou1lme  nvs t)srrrum ou4apeomo3iatlm rl(mp;()alxoxrcia1opt  uvslt0 etrio3ou4omtn nvtlt)s2tr(  no4aexnmi3ilsfm rmnmsnt)arxoxr3iadlm eai i s0srumxopou4ame lnvsls aDtrum ot0tlto o3iyd aDulnmp t0altomr3oatfmtr i sls)s2urxrpiu1lpee nesa(fsrrau oou0alt  i3iysfa2eauvpnu4tlxoif iy1lmt  uvo (0s2uoxo oy4lmtelnct t  2trurpot1apeoif3tlsfmDra(mp (4alxrir3iodoatr nvols)truoxm iudll nmnvs tfa2um( ooo4aleomo3iatfm rmnvp (4trxnmo3oo1fmDeauvolt sruo(rpoudap n fvi (  rurx pno4apenmictltfm2ra( snu) etrmoctotopDeanvslt sexrxmpnydoptnmfvs t)a2uax  no1alxnioeiat m uanvp (4altrxrctotlm r uvs s) 2tmim oy4oltnmfeias) Drax  nu1tpxo o3iltla uluvon(4arxnmf iatfmDr ueolt tetoim nu4ame  fciat srumxm nu0altn fcilsfaDranvont4aetrmo to1lptrli olt s2xoio oo1lp nmnviltf Dua(rooo4olen feiysla rmn s t4tlxnxr3oytlatelnvi t)trum(r no1olee nesas)artr(  ;t1tlenioeiytls uanmsn(4aexoir3oo1lmt lu il( srxmxr nydom emfviat)aDuax o;t0tlxn oeiytfs2rluvpn(4alxrmr tatfaDean i (0s2tm(o iydole  iet sfaDtmumpou0alt  oeiad s2uau s u0tlxnmf3tatoa r ivo (  rum(o3iu4lm emfesa() Dtax  no0olt mfcildla2ra(vp;() leoifcoo1opDrln i;s)texm(m iydlp nlfvsl()aDrauroou0tle  fciat a2uluvo;u4tetnxoctydfmtrlu sls0trur(opiudlp  lfvi sf 2taumonu1apen fciatlmDrm(vo u0texrioctydopDrli i s setrim oydomeemfeils) 2rmxroou4olen fciysls2ulu pnt0 lxnir3io1omDrlu o;t)trumxmpno4op  liesatfaDtmxronu1oltomoeiat m2elumsnu0alerircootfmtr u i s t2xmim3oudomtemnes t srrax o;o4aeeo o3tyd aDua( p;t)arxnxfctytop elnes;t  exo(o3oudop nlncsl(fa2tmum no0tlt mfeiydfs2em(vs;t0 exoif todfpDrau s s  exm(m3oy4op e net () 2tmu p;u0optomocildlsDuauvp t4 ltoir3oydomDe uvils0trxm(mpiu4al  mfeils  rta( p;t1aetomfeiatla uluvs;(0 rxomr3tadfp rln ilt t2trimpiy1omte ietl(fs2um(mo;t4alx mi3tad m ra( o;()arxoxr3oatop   ies;t srxm(o oy4apeelfvi t  2urumpoo1texo fciad m2rl( p;u4teeomoctatopDr i o s) eumxr nudlm nmfet ( a2rmxmono4olxn f3iadfa uanmsnu0aeenio ta1omDeaneol() eumxmpnudlp e fesas)sDua(mono4olxoifeilt s2um( p (4alerxf3iytlatr uvs;s0 etoio iudope  net sf 2uaxrpno1tpxo fctadla rm(ms;u) lerxfcootlm e ivolt0s2xmirpou1ap  mfet s aDrm(mont1teeomfetlsfs2ranmsnu4altrmr3ia1lat auvs t0texrxo3oy1llenmnes t  rtr(mo;u1tptomi3tysla rmnmo u0aeeomo ia1om rlieol()srxoxopio1lmen netasf ruaxront0aeenioeiatfaDrln o;()aeeoir iodfm   u s ( s2xrir3nydllenmies ()aDuaurp;u4aleomociasfa ulnmp;(0aeerio3io1faD lu s;t0trur(r oo4lptemfeta(f 2rmxr ot1tlx  ictyt s2rauvpn(4tlermo3oadfmDrai i;(0 euoxo oodlp elnvtls sDrrum ot0ole mfetlsls rmump t) eenxf iatlmDrli ols) ruo(rpno4am   fct t srtrum ;t1alenioctatfa2um(vs;u4aeerif tadla  lu i t srxr(opnydlle lnci t) ruaxmoou4oeeomi3iatfaDelnvpnu)altrxf3oy1opDe ivi t srum(m iy4lmt mnvsatfarrau  ;u4apenio3iltlm2ulnvp t4 eerxf3to1fm eanvslt t2ur(m iu4ope lici sfarrrxroot1teenmieiyd aDem(msnt4 ltnmf3ia1oaDelieo ()trtmimpnudope  fctl() rtru pnt0oeeomo3tytls umnmp;u4treoxf oadop  luei t) 2tm(o3iy1ol   nvsa(fa2umxroou1aetoiictltls elnmo t4trxoirctatoa  lneols srtoio3ny1omtn ivsltf 2taxm oo4oee  fetldfa ul( p (0 rxoio3ty1fmtr i ils  etoir ny1om n fvtl(f Dra( p;o1tetoifctldla uaumo t4aetnif3oo1fmtrluvi;( s2xo(mpiu1ll   fcs s arrrumonu1oexniiciydfmDuau on()aexrxo totfpteauvs () exmir nodlleemfei t)a2rr(r no1apxo fetltfa2ulnvo t)arxnmr tadfm  aiesl(0sexo(mpoudol  lictas sDurxm nu4teeniictat a ulnmsnu)trtrxo oytfpteluvs t)s2xoxo3no4olt lneiat s2raumo;u0oex ii3iytfa2rlnmo;t0 rxrxo3tydopt lnes;t0srtoir ny4ame miesat s2trxro;o4tlto f3iyd a rlnvs;u4 ltnxr oy1opD  nvi (0t2xrxm nydlltelfesls)a2umxmo;o4tex iicild s rl(vo (0alxoxfcoydoaDraneo;( s2xrir nu4ame mnet t a2raxr nt0opxo o3iyd a rl(vont4arxoir3ta1omD lu i;() 2uoiopno4llte fctls)srrr(mpou1oetoif3tatfa raumo;(0altrir ty1omD lieolt0 rurimpiydal  lieiat)sDtmu onu4aexomicils aDrm( p;()alxoxf totlmteanvsl( setmxrpno1ol emfeta(fa2tmxmp;t0opx ii3iydfa2ea(ms t0aleomr iydlaDelivi;s0teurio iy1olt mncsa(f Drr(  ou1olt mfeiltfa um(vp;u0alenxf3iydoat aneo;s s2urxmpiy4ope  nctls)sDtm(  nt1opx  f3iasfm el(vo (4 eermr3iy1om elieols) rxmimpiodomte icia(  Drmumooo0opt iictatlsDelumonu4arxnxo3iotlaDeaueo t  exm(mpio1om   fesas  rur( pnu1teto fcilt a2el(vp;u) rxniociytfatelnvs;(0 rto(m3oo4amtelivt ( s2rrx p;u0tpx mictltfa2elu o;u0 etnxrciy1fpDr neo s s2xriopiodopen fcs t a2rmur ;o0apxnmfetld sDeluvo;(0artnifciodlm rln o;(0s2xr(opiudol n fvt ( sDur(m nu4tlxomictyslmDumn s;(0aexoir3iydlptrau s s0s2xr(m oodomtelfcils)sDur(mont1tlxo o3tat s rmnmp;u0 etrir ty1fp  aivo;t)setm(rpoy4olenmfei () rumxroou1oetnif3tytlaDua(mo;u4 rtrmr ty1laDelu o s)srumimpio1om n ncsa(  2raump;u0texn octasla uaumsnt4trxrir oodfpt luei s) 2toxm ny4lpenmncsl()srtrurpnu4aet mi3tlsfmDrl(mon(0 rtnirciotfm r iei;t s2xrxopiudopenmfcs ()artr(m ;u1altnioetadls2rmnvo t0artnmo3totfpDrluvs;()t2toxr3nodlm  mnvs sf Dtmx  ;t0olen ociatfaDemu sn() lxoxrcty1om rliesl() rxm(m3nu4ome lfct ()s2umxro;t1tpt mf3iltfa2uanvp (4tlxrmfcoo1fatelivi () eurimpnodame  ictl() Dtm( p;t0oexomi3iaslaDeaumo u0tltnxo ta1lm  liei t)trtm(mpnu4olenmnvta() Dtaum no1alt  f3iys m ranmp (0 rtnmo3iy1fa rlues (  exmxo3nudlmen fvsasfa2rmxro;o4tpe ifcildlsDumu p t4tleoxrctytoptr neo;t0srxmxr oydlmtelict sfa2ur( o;u0opxomocils sDeaumo t)aexnir totlaDrai o (0 rum(rpou4am n fcs tfaDua(rpot1tee  fetys a2eln s (4 ltrxr3todfatrau i;t) 2trxrpio4lltelfcs s a2rmu poo0alto iciydlm2rln snu0aexnio3ootom  an o;t0sexo(r no1ome lfct s  Dtrxrp;u1alxomociasfa rmnmonu)altomr3oodfmte uvsl()srtmirpou4opeemivta( a2uru  ;u1olxoii3iltlm emums u0treoifciatoptranvs;(0trum(o3nydop n ici t  rtaur oo4tpxnmf3iltfsDua(mp;(0 rtrxf3ootfpD au i;(  rxoir oy1ll  mici (fsDuax onu4tlxoiiciysfm umuvp t0 leoxr3oadlmDr i s;t  2xrir3io1am elnei s)s2urx oou0oex mo3iysfa rm(mpn(4 lxoxociatfm rluvs t)t2xrio3iu1ol emfetlt)s2tmurpnt0alxo i3tysfs2ulumo;(0trerio3iodom raieils0s2umim nodlpenmfes sfarra( o;t0tet ifetltfm2rmu pn(4arxnxoctatlm   n i;t  rtoxo no1aleelncsa()aDraxm ;u1oet ioetatfaDelnmsn(0texnif3tydfmDe ivs ( texr(rpny1lpen iciltfa2um(rp;t1olxn feiydlmDuln o t4 eenio tadom eai ols)srxoxopnu4ap elfesls)s2tr(roou1optnii3ild m eanms t0 ltrio io1faDeanesl(0t2tmxm oudlle mnvilsf Drrxmp;u4tpt  oeiatfsDemn o;()trtoxf ia1fa r n o ( sexmxm no1om  lfetasfaDra(r no4oltnifeiydls uanvo u4 exomo io1lm eanvi;s  2toxr oy4alenliesa( a2ta( pnu0aeeomictysls2rm(mont0 exrmfcto1la rluvs t  eurim3iydam nmfes ()sDtr(r ot1olx mi3tldlsDua(ms u)alerif totomD an o;() rurxmpno4amtnmfciasf rumu o;u1ale  o3ils mDelumpnu0 ltnio3totoatrau sl(  2umxo3iu4aptemfvil()aDtrxmo;t4teeoioetyt a ul(vpnt4tlxnmr3ia1oaD  n i t trxmxr3nu4lm n nciat)aDtmx p;u0tex if3tldlm2em(ms t4texomo to1lptrlies;t  2ur(opnu1amte fcsasf 2ra(rooo1apxn ieiatfsDemnmo;u4 lermrctydfmtrlnvils)trumio nu4apen fct t) rrrum ;o4aptn i3tlsfs2rlu o;u)texnxoctatlpDeln i t0sexo(mpnu1lp  lfeils  rum(rpoo0aet mfeiadfm2ul( o;() exrxr tytopDe uvils  2to(m nydoptnlncsl(  rra( ooo1tetomfcias mDrl(mpn(0 rtnxo to1opDeaivs;t)t2urim3iy1lptn fvsat)arumu o;o1tet mo3tadla2um(mo u4 lenircia1lp  li olt)trxrir3oydlmtnmies (farum(m ;o4oetnioeiaslm2umnmp;u) eenxo3iadfpt  uvo;(0 etoir oudamtemfci tfsDrr(mo;u4tleomoctydls rlnvsn(4 rtrmr3totoptr u il(  2uriopiu4lp n fvsl( srrm(ront1ale if3tatlsDrm(von() rermrctytfm  ln sl(0 rxrxr oy1al  licil(f Dumu onu4aeenioeiyt a rl( p;()tetnir iatoaD aueo;()srtm(m3no1ole mnvs (fsrrr( pno0opxn feiys sDrauvo;t)aetomr3to1omDraivilt)trurxm iy1apee ictas)a2tax ono1oetnifeildfmDra( p (4 eeomo3ootfaDr uvil( sexoirpou1lmtelivtasfaDtr(mo;t4tet mietld sDelnvp;t)teeoxo3ia1lmte ueilt seuoxmpoy1omt  nct ()aDrrur ;o4tle io3iasfa2rln s u)teenmo iydlp eli il( srum(m3oo1optnmfcsls)aDuru pno4aet ioeilt sDem( ont)aexoifciadla  an i ( t2xr(mpoy1aptnmict t s2tau pou1tltoioetydfm2uan pnt0aetoxf3oadfpDran ilt0 exo(o3oy4lmtn fvtltf rum(  nu4aex iiciatfaDumnvsnt)alxoircoa1om e nvsl( srtr(r3oo1ape mncils)srrrumpno0alxn oetldfa rauvs t4artnxf3oytlp elueo t0truoxm iu4ll   nvi (f 2uaxrpnu1aee ii3iydls ua( p (0arxomf3tytlpt  neo;(0texr(r iy1ome  fvsas)sDuru o;o0alenmieiys s uau s u)texrmr ootopDe nvslt)trxoxr io4lp e ivtlsf 2rmxm ot4altomf3ilsfmDeanmp;(4 lermo iatfmt auvilt0 rur(o3oy4lmee fcsa( s2ua(  ou0olxnif3iasfs ra( o u4aexnir3iotlpDe neo s0 rxmim3nodop e ici t  Drmumpot1tpe micildfsDranms (0 leomo3ta1omDr n s t) exrxo3iu4ape lncia(  Drru  ;u4ape io3ilslm2ulnmsn(0 rxnir oo1fpD  nes s)sruo(m3oo4lmenmnesa()aDuru oou4apeniociydfa ul( p t0treniocoodopt aieolt)trur(r ny4lpen nvtls) 2rr(rpnt1tlt  ieildfmDulumo t) rtnir3iydfpteau o;t)seumim3nu4op  lfvi ( sDurump;u4altn f3iydfa um(vont4texoioctotomDelnvs;(0t2uoiopoo1alenlivta() rtmxm ou1tpxniictlslmDumu pnt)texnxo3oo1fpt li o () 2xo(rpiu4lmtnlnvia(f 2rr(mooo0olx mo3tyt aDrl(vont0tetnifcio1optr nvils0sexoxrpoy1altnliei s)srtrxm nt1tltomoeiytla rm( p;t0 leoxfcio1omDrluvo;t) rxr(r io1lmtemnvi t a2rr( pot1tpx iieiatlmDeauvp;()artnmo3iydoatraneolt)srtmxm3iy1om e fctat)sDrmx p;u1tpeoio3iadfs2uanmo () ltoir3io1lmteln ols0srumio3oy1oleelics (fa2uauroou1teen f3tyd sDem(vp t0 rxnmf3oodlaD  u slt0t2tmir iu1optnlictatf rtmxmp;t1aetoifetysfaDrlnvs t0tlxrmo iytfa eanes;( trumim3oo1ol elfeiasf Drau o;u4tlxomfeiat s rauvsnt)tlxrxfctadfaDraivi s0s2umxo3iydam emfvslt sDrm(mpno1tlenmoeild sDrl(vsn(4aexrmrcio1fp  li s ()setrio3nu1lp  lfcsls) 2tmxmpnu0tet mfciaslmDraump t4areoif iydoaDrli i;( s2uoim3ou4ol emfeia(faDrru  nt0tetomfeilt s2eluvo t0tltrmr oatlm eaueo ()trxrim iu4aleelfvias) 2ua(ronu1opx mfciydla uanvs (4 renxrciotoptr uvo (0 2tmir io4ope lfcsl( arrrumono0oleomoeiadlmDrau ont)aetoxociy1lmtrauesls)sexmxm ou4lmeemnci s)arrm(  ;o4ale  fciyd mDrmnvon(4artrir3oadoat luei;t seurxm nu1optelnvs tfsDtmu poo0apt  fetlsla ulnmsn() exoio iadfm rlnvo;s t2xoxopny4lpe  fetl(f Duru pnu4oeto ociydla2eanmon(4texnir3ia1lpDeauvols)truoio iu1lmenmnvilt)arur(  ;t4olxn fciydlmDrm(mo t)artrmfciytlatelneols)t2um(r3iudomt lfeilt sDururp;u0opt mfciaslaDemnmo (0trermr tatomtr uvolt srto(mpnydol   ncta()s2ta(  ;u4tpx ioeiyt mDem(mp;u4 lxnifciodfmDr nes;( trumirpoo1opee ncta()s2rm(ro;t4apxnioeiltfmDua(vsnu4artnir io1oaD auvi t) 2um(o3oydamee fvt t)aruaxmp;t1tpxomo3iasfaDulumsn()aleomo3ty1fpDe u i ( texmim iu4oleemneslt aDtm(mont1alxnmo3iatfa rm(von(4aexrxo iotfatr i o;() etoxrpou1lmenmfcsasfsDra( p;t4openmoetatfa2ulnmo u0texnifctotlptraivi ( texo(r iy1llt mfcs s)s2trurpnt0tlxomfetlsfs elu s;u4 eenif tytlatraivs;(  2uoirpiu1lme  fvi t)sDtm(mpnu0olx  feilsfa rm( s;u) etrxr ia1lmtranvilt)sexoxm iu4apte iesa(  2rr( oot4alx mfeiadls2rm(vo;t0aeerio totop eln o s0s2umirpoy1ap e feslt)a2tmur nu4oeenioctldlm elnmpnt4tlxoxr3oatfmD aieo;s)truoxo iy1ol nlfet ( arrr( ont0tetn o3tldfa2eaump u4trxnif iytoaDelnvolt t2umxo3iydll elivsa(fsrrmx ooo1olxo octldls el(monu0trtoir iodoa   u s;s s2umir3nu4al n fesl(f Dtaumono0alto f3tlt mDul( snt0texrmrcoadlmteai o;() 2uo(r ny4lm   iesa( a2tax  ;o4altoii3iltfs2em(mon(0trxnifcty1lmtr ivslt0s2tmim iy4ope  nvt s sDtau oot1oleomi3iad a rm(vs;u0teerxrctotlaDr u il(  2ur(r3iu4amtnmfvtat  rtm(  ot0opxomf3ils aDeluvp;u4aetnxr iotoa r iei;s0setmxm3oy1ll emici t)aDtrum nt4aex mieiys a2rluvs;u)arerir iytoat luvols) 2tm(o iudap elfcs t aDta(rp;o0oltn o3tadfm rl( s;t4aeenio oydfate ivi ()t2trimpnodap n ivslt  Draurpnt4tlenmf3iydlm2uau ont) renxfciatop eaueo s srumim3no1alt mfvsatfaruaxmpnt4tlxnmi3tltfmDem( s;u4 eenio iatla r nvolt s2xoio nydapt  netat)srrrum ;o1olx  f3ildlsDul(mo (4 ltrxr oy1fm ranvils0s2urxo3oodomenmfesat srrm( poo4ope iieiadlm2rlumsnt0 renxo oytfate i i s)srtmxr3iy4ap emfvt s)aruau o;t4tltnmo3iytfsDuan p ()arenircoytla raneols0srurxr3oo1omt mnvi tf 2ta(  no4tlxo octas mDraumon(4 leoircoydoate uvslt srtmio3iodamtnmicsa(  Drau o;o1altnmf3tyslaDum(mo ()trxnxo3iy1opDrlueils0t2xr(m oy1ll  mfeslt)srtax oot1teto fciasfa2rmuvsnt)aleoxf3todlm  aies (0 rtmio3no4lle mfvt (f 2taum nu1aee mieildlaDuanmont0artomf ia1lpDrlnes;() 2um(m oodopt miet sfsrtm(  nt0ape  fctas m ua(vsnt)altrxf tytfmDeluvs t0srxrxm iu1ole lnei tf Duru onu0tlx iiciltls umump;u)aeeomf ta1lat an o;s setmxopoy1am   nesl()srurumo;t0aeeomicildlsDul(monu4 exoxf ty1lpD aivs;t0trxoio3no1oltn nvils)artm(rpnu4tlxoio3ilsls2ul(msnu0trtnxf iatlpDrau olt seuoxm3no1op n icilt) rrr(  ;o4oeeoio3taslaDrm(vpn(4arxomocoadfpDelu i s  2toio ny1amtn icilt s2rmxr ;t1opeo i3iad m umn p t) ltomr ty1fm e u sl(0 2um(rpiodaleemfvsls)a2tr(mpou4tltnii3tldlm2um( pnt4tlxrio iatoptr ivi;(  rxriopoo4op emnei () rrrx ono4apenifcilsls2rm(vsnt0aetrmo3oydlmte ues s  2tm(m oy1ol elnesl(fsDtr( oou0tex ifctydlsDemump u0trxnmfcoy1om r ieols0texr(o3oy1lp emfet (f rtrxrp;t1aeeo feils a2rlumo u0alxoxf3iodlmtrlivo t)setm(m ny1llenmfeslsfarrr(rpno0apxnifctyslaDuauvont)tlxnxo3iadfp  livo s tetmxo3oudlp   fvs ( sDua(mpnu0ape mietltlaDra( pnu4tleoif3iytoa e neil( tetm(o3io4ame mnvt s)arra( pnt4tltomiciysls ulnmont4arenmr oodfmtr nvo ( sruoxr3oydop  mfci tfarurx  oo1opeoioeiadla2elnvpnt)trtrmr3oy1lmtelies t)teur(o iy1opte nvtatfsrtruro;u1tlxo f3tldlmDumu s;u0tlxrir3tydfm   i i;(  rxoim3oo4om emnvsatf rrmx  ou1tptomoctadla2eaump (0trtnmrctodoat anesl( teuoxm3nudole lies t  2tm(rpot1alx ioeilsfa rluvpnu4trxnmf tytfmtrlu o t0t2ur(r3ny1ll  lnei () 2urx ont1tltoiieiydls eluvsn(0artrxr oatlpDe i ols)seto(m iu4aptnlieias)sDurx  ;o1tpxomfetat a2rm(mp;(0aetnxo iytlateauvs t0 2tmxmpiy1lmt  icilt  rur( ono4tlen ietysls eanvp t)alenxrcia1lmD ai o;(0teumiopou4lptn ict t  Drmur nu4aetnmiciytls el(vp;(0arenir3oo1fmtr nvi s)trum(o nydole  fvs sfa2uru pnt1olto i3ilsfaDra(msn(4altrif3oo1lp r n i s) rxoxr io4ll nlfct (f Dtrxroot4open oeilslm ua(vp u0aexrioctotoaDeaivo t  rtoxr oo1lmtnlfvt s)srrr( oot1oleoiiciysfs rl(vpnu)alenioctodoatr n il() etrxm ou4alte nes t aDrrum ou0oet ioeilsfsDraump;t)aexoio totom   iei (0setrxr3nodolen ivia( sDrrxr ;o1aexoifciatfsDuan s;u0arxrmocoydop eanvi (0trtm(o3nu1omtn netat) 2rau  ;t4oee mf3ias m um(mp u) rxoircoydlp eau i;s)s2toxm iu1ome mfctat)a2ta(rpou4apenmi3tatfs2em(mp;t) rerifciodlpD  u il()seurxmpoy4am  lnct sf 2ua(roou1alx mfeiasla ua(mo t)tleoxr oodomDelnvs s0 exrxmpnodoltemivi s a2rr(rpot1aeenifeiatfm2rauvp t4aleoio tadop   u il( s2xmxrpnodolenlict (f ruaum nt4optnmf3iyd m2rl(vpnu0tltomr3tatop r u o ( sexmxopno1apte iesatfsDumumo;t1aptn o3tyt aDem(mo (0altoxr iadlpD  ivs () euoxo nodomenlfesl(f rtm(mp;t4oet ifciadlm eanmon(0aetnmr tadomteai s;()texrirpiudap nlfes (  2umu pou4apen ociadla ulnvpnu)aeenxrciotfpD  ivs;t0teur(rpny1llee ieslt) 2umxr oo0aetomoctatla emnmp;u4teeoxr3iotomDr ivs;() etoxopnudapt mneils  rua(rp;u1olx ioctatla uan s (0 rxoxf oatfaD auvol(0seumxrpny1am nlnvtlt  2tax pnt4texo ictldfa2eaumont0 lxoxrctytom e ieslt0t2to(r3oodlpenlivia( sDum( oot4aeen f3tltlsDulu p;(0artrirciodlpD  nvi;t  rur(opnydlpee fvsa()a2raxm ;u0tpxo feiat sDuanms (0trerir iodfmtrauvo;t  rto(opio4lptnmictls arurxr nu4ape mi3iadls rmn p (4tltriociadoaDeai o () exm(r nodoltnmicilt srrrx p;o1apx  ieiyslm rlu sn() etnxfcoa1oaDrau o;t  etm(o iodam elnvilt)arrrx ooo4aetnifctldfa el( on(0alxnxo ty1opDr ies;t0s2umio ou1lp elivsls)aDtm(ro;u4aee  icild a rau pnu0 ltrir3oy1fmt an i t0srxmir3iy4ameelnetls) 2taxmpnt1teeoiietaslmDrln o ()teerxo todfpDelnei t) rtmxr oy4omte fcilsfsrtmxmont4aleomi3iad aDeaump () lxnirctodlatrlu s;(0 exmir3nodaptelici ( s2ta( poo0apt mf3iys m2em(mont) rtnxo3iodom rlies;(0trtmxr3io4lleelnct (f rrmxr ot0tlt  o3iadfm ea(vs;(0aeerif3totfaD  u o;s) 2tmio3iodll nmivia()artr( o;o0apenmo3iydlmDrlump;u4aetomr iadfpteau s;s0trtmir no4ome mfeiasfa2urum ;u0olxoiietydfs2emnvo;u0aexrxfciodfaDr i olt0s2tr(o no4ope lnvi ( s2rru ont1aptomoeiytfs ranms ()tetomf3iadlmtr neo;( trtmxo iodlleelnetlt sDtru  nt0olenifctatfa2ua(vp;t) lxnio ty1fpDe nvil(  2uo(o3iy4ale lnctls aDrrum nt0ole mocild m2ea(mp u)teeoio tydom r neol(0t2urxo3io4lme livsa()arrmurp;o1tle  fcild a eluvs t4tetnmfctotomteluvo t  rumio iy4lp  mietls a2ua(r no1apen ociyt aDuanvs u)altrmfcoo1lpDe ivolt0trxr(o3iydaltemivia(farumuro;o1aptn fciydfm2eln s;t0tetrxo3ootopD  ivi ( setrxo iodopenlnvil(f rrm(rpnt4aexo fetltfmDulnmont0alxnio3iatop   neo ( srtoirpoydol  mnvils srurur ot4ape  oeiasfaDua(vo;t0altriocio1fp  an o () 2xmxmpnu4ap e ivtlsfaDururo;u4opxomfeias m2emnvsn(0tetrxocoodla rln o t texrio3io1aptnlicsltfa2ta(r ;u0apeoifctydfmDumn s;t4arxrif oatoaD  n sls)srtoio3oodlmtnlfcsas) rta(r nt0tlx iieiysfsDem(msnt)tetnmf3oydfm elues ()sexrxmpoy1amtelnet sf 2um(mpno1ape mociadla2eaumo t)arxnxrcio1oaD  nvol( s2xrxopoydapt mfciat  rumurpno4texnmo3ildlaDrm(vo;u4texnif3iatlmt aies s0teum(o ny4openmncsa() 2rruro;u4aeenifcilsfa2ranvo t0aexnifcoytfp  luei s)s2urirpny4aleelnctas)artax poo4altn fciydfsDum(mp t)arenxf3iatfm  aues;t0texoxm ou1lm elfei s)s2rau pot1tee miciyslm rmu p;(4trenif ootopDelnvi;t)t2tmimpiy1amtn fctl( sDrau p;t0tptnmicilslmDelu o;u) rxoxocoydfmD lneo () etrio oydameeliesas s2ta(mo;t0tpeomicildfmDelnmsnt)aeenir oatopt lnvi s)teum(o3no1altelneias srrmu ont1aee ifeilsfm2ua(mpnt0altnxo ta1lpDeaneo (  euoir ny4alenmnci (f 2rmxr nu4teeo iciysfa rmnvpnu0texomf3io1lmDe ivs s0s2xoxmpiydll emnetat) rtmum no1texomoeiysla2umnmsnt4tetrxo3iy1om e uvi t) etrxopiudom   fvtasfa2um(mpou1apx  ociad s2rm( snt0 ltrmr todlptelieilt) ruo(rpnudlmtemnvta()sDrm( o;u4alenii3iyslaDem(mo;()aexnifcoadfaD ai slt)trurim3iudale  ietls  2urxr ou1tltoioeiltfa2rluvp;()trermf ta1lmDe ivils0s2tm(m ou4opt  feta(fa2rmu  nu1opt mocildlmDrlumo u)alermfctatlaD ln olt0sexrxm3nydolenmncilt)arum(roou0opeo oeildfs2ul(vsnt) ltrxf3iytfpD ai s;s)t2xoiopoo4ll   fvt tfaDurx pnu0aeenmfciytlsDrlnvs;()tltrioctatomDelu il()seumirpiy1ll  lfesl( a2ur(  ou1oee  f3iadls2umnvon(4aexnmrcoydlatrli i;s trtr(rpny4om emfetlsf Dtm(m ot4oexoioetat aDranmo u4trerxo3oo1op raneo;t0 2uoxr3nu4lp   neiat aDuru o;o4tpxomietatla um( p u4texrxf totopt lnvi;t) rumxrpnudalenmnct t srta(mp;t1tpeomfeild s elnvs;t) rxrmociydlmt livi s) 2trxr nu1opt lictls  2urxr ot0apt  i3tls aDeau o;t0aetnir3ty1la  aiei;t)truoxr3nydom e ncsasfarra(monu1aexniieils s eau p;u)aetomocoa1lmD  ivi () eto(o3oudap n ics (fsrtmx pnt1tlx  feiyt aDraump;(4altomf totlpt  nes;t  rxm(mpiu1ole lncs tf rra(  nt1olen o3iatlsDemnmo u) etoif3oydfmDelnei;( s2umir ou4amtelncsls)sDurur ot0aex miciysfa2rln pn()alxnmf3io1lpDr n o () rtoxmpnu4ape  nvt s aDtaum ot0tpenifciadfsDum(vp (4trtnmr totlaDelu sls0s2tr(r no1lm   fci s s2tau ont1apxnmiciatla2rauvo;()texomfctatfmD aues (0trtoxo oodopen nesl( s2rau ooo0apxnio3tld mDeanmp u)alxrxr3oytfmDr uvo;s sexrim3iydopeemncsa(faDuax pno1opt  fcildla2rlumon(0trtoxfciadom r u s;t trtmiopoy4op e ivslt) 2trx ont1oex  o3iyslm2rm(vp t0trtnircto1omt lnes;t0 etmiopoo1olenmiet ()a2uau ono4ope ioeilslm uan o (4 rtnxr ia1lpt aneo;()trumiopio1lpe  ietl()a2taurp;t1tptnif3tlsfs eau s (0alermocto1fa rluvsl()s2xoimpiu1optnliei tf rtau  nu4aptniociyt aDrmu ont4tleomoctydfaD livs t0 2xrirpiydlpe  nct s  rrmx pnu0olenmfciydls2umumo (0tetrxo totlmDrluvs;s0 2toxmpny1omen nvi t)s2rau pot0tlxn f3tasla2rm( o;()arenifcootlmDe i i s)srtoxr3iu4lm nmietasfsDurxm ;u1tlxoifeiytlmDuln p ()teenir ia1la rluvo t) eur(opoy1lm   fesasf rur(monu0olt ifeils aDeanvs;(0treomr iydfp   ueo;(0 exmirpoo1ap  lieia(  rumuro;u4opeo ictltls2rl(vp;u4aexrmr totop rau i;(0trurxopoydol n neilsf 2trur ;o4teto ocild m2umnvp u0aeeoio ia1fm eanvil() rtr(opiydamte net s) Dta(ronu0alxoiietyslaDeau pn(4 reomociydfp r ivols0 ruo(opoo4ame lfeilsfs2ta(rp;o1apeomi3iad sDuau p;t) eerio3iatlp  ai sl(0texo(o no1apen ivi t s2trx pno1opxo oeildla2eanvpnu) lerio oatfa rluvi s sexmim io4omtn fvsa(faDraxmoot1tle ioeilsla2uaump t0 exrio3tadlptr neo s0 etr(m io1al nlfct (f Dum( pnu4apen fciadlmDra( p;t0alxrxr3iodop  aivolt) 2tr(m oo4alen fei t aDrr( ono1teenmoeias s umn s ()alenir totlm rai ols  rxoio iy4apenmnviat a2trx oot0openio3tldfa2umnvpnt0altrxrcio1opDe nvo;t0texrxm3oy4amtnliesls)aDta(  ot4tpxoiictasla rlnvp u0 eenxf3io1laDeanvi t0setrimpiydol  mfeiltf Dua( pnu1apxn o3tyd a2umums;(4 exoio iytfptraueo t0s2xoim no1lmtelnvtl(faruax pno0alx moeiys m2ua(ms ()aexoirctydlp eanvi t t2xmxopiy1alt lfci s aDtru ont0aleoifctatlsDuluvp;(4aetrmo3ia1op e u i s setmxopiydll n fesls) Drau onu4aleo ietyd aDem(vsn(0aexrxr tydfatr uvo;s0trxr(m3oo4lp e fvi (fsDrmu o;u4olxomociydfm2umu pn()alxnxo oydfmDrlneilt)trxmio3nudlle liet tfs2raur nu4oet  octlsfs elnvo t) ltoifcootom   nvilt) 2urxo3no4am emfet (faruaum nt4aeeomoeildls2rmnmo;u4tlxrir3iotfatraies t s2xoim ou1llen ietl() Drr(m ;u4aexn fetyd mDum(vp;t4tlxoxrctotoa rln o (  rurxr3iy4amt lnvi t)aDtm(ro;o1aex  f3iatls rlu s;(4treoio3oadoa   n olt) rtoir nu1amtemncil(fa2trx oot0tptniicild s em(vo;(4trenircio1fp  aueilt0 rur(o3oo4lm  mnvsl() 2rrxmo;t0altoii3ilsla2eluvs u4 exomfcoy1oate nvi (  rxmiopno1apee fvslt)s2rrumpnt4apto i3iysla uanmp t0aleoxfcio1om   uvsl( t2ur(r nydalee ncsasfsrrr(rpno4opxomictatlmDea( p () rtnxo3oo1lm  livs;t)s2xoim3oudal  lnesa()sDra(m ou1teeoii3iadfa uaump u)tlermo3todfp e n i;t0 rur(mpiydapenlnctat  Drrxm ;u1aexnioctysfs uln o ()treoxo tytfatr i o (  exmim no4altelfetat) rurum ;t1optnmieiltlsDeanvpnu)artrxf3tydfm ran o s0srumim3nydllee fcia( aruaumoou0tpe mieiysfaDrauvpnt4treoxo to1lptean i t seumxmpnydolte net s aDtmuro;o1tptnmo3iad mDua( onu)aetnxf3tytlatrlivilt t2uoir3io1lpte feta( a2um(mpoo4aptomfeiad s umnms;u)tltomr oadla r ivil(0 rxr(opoy4olt  iviltfa2rm(mpot0aexnmociadfmDem( o (0tltrmf3tadfpt auvs t) rumxrpiy4ope  ncsl(fsrrmx  oo4oex  oetltfm2elumonu4altnmf3iytfmDelnvils)t2uoxm iy1lmtnmfcs t srrau oou0tlx iociltfaDua(vo;u0aetnio iydlaD  ies;s0 2xm(r3nudalenlfci ( sDtax p;u1aleoiociadfa rmuvp t4 leoif3iatfaDe ivs;s0t2trxo iudalen nct sfs2truroot0apeo oeiadlm2el(vo (0 exrif3iy1lmDr i o s0 rxoir nydlp elncia(farurxroot0tee ifciys a2ua(mp ()tleoxo3oydomte ues;s)s2xoxmpiy4lltn ncsa(f 2urxmpnt4opt ii3ildfsDrm( sn()tetoxo ty1oa r u slt  exoio nu1ale lneil( s2ur( o;t4oex  fciltfmDeluvonu) rerxo3oo1fpt ln ol(  exrxm nodamee nctl()a2trx onu1aptn i3ildfs umn o;u)trtrxociadfp   n s s  euoxopny1opt  ncsa(f Drrx  ou1aptoii3tltla2umn s (0 lenxf3tydom rli il( texmxm3iodlpenmiesat)srraxm nu0oet iociydfm2ua(mo;u4 lxoio3ootoaDe n s s)sexmir3io1ameelnei tfa2tau  ;u4openif3tytla uaumon(0tetomf3oodoateaieslt0srum(o3ny1opt mnvil()arrrumpnu1tpe mi3iydlsDul( s u0tlxnircoa1opDeluvs;( sruoxo oo1ll nmivt t)a2rrumooo0opxnmo3tldfs2emuvo u4 rerio3tadlatrlnvo;t)s2xoim3oy1al nlfvsat sDra( p;u0opxn ociat s2ea(mont4arxomf3tytlateaiesl(0srurxr nudalenmncta()a2ur(r nu1tleomf3tld a2rluvpn() lerifcoo1fpDeauesls0 rtm(opiydolenlnet (fa2rmxrpno0aexnifeilsla uan pn(0 lenmo3ia1fm  livi;t)t2trxm3iydom   ncia()s2rm(r nt1tpe mieils a eauvo;(0trxnmf iodfpt lueo;s0truo(m iu1aleeliesl( a2raurpno4alxoii3tadla2ra(vo;t0tltnmfcoy1fp   ieo s0srtrxmpoudamtn fvi s s2ur( p;t4tlxniociad m rmn on(0 ltoxf3iytlptr uvo t s2urxopoy1lp e fvtltfaDumu  ;t4aptomociydfs2ra(vs;u)artrxrcty1optr n ils0s2tm(o ou4ll  mfei (f Drr(mo;t4ale  ieiyd a2emuvs u4trtrmo ty1fm r n sl( s2umiopoo1lmtemicil(faDurx oou0tlto ocilslsDrmnmsnu4tetnxfcio1opDelueil( tetoxm3oydal  lnvt t)a2tr(m ;o4tpx mfciytlmDranvpn(4tlxrmf3iadopDrauvi (0texmxo nu4apt lneia(fa2urur nu1aex io3tlt m2um(vs (0 leoir3oytoa eanvi;t)t2xmirpny4lme mfvi s a2tr(mpnu0oleniiciadfsDraumsn()alxrmf3oydlpt an s;s s2ur(m3nodop nmfeias s2trxmpnt1tptn fciadfa uln sn()areoir oadfm e uei (0tetm(r3nu1olenmfci () rrru ono0altn i3tld sDemu s;() etnio3oodlpD  uei;s  ruoimpnu1ll  lfeia(fa2rmurpno4ole  f3tytlmDrauvs;()alxnmf3oydlpDelivols trxr(opiu4ome lfcsat s2tmx o;o1aptnif3iasfmDuanvo;t4 etoif3tydoa   nes t)s2tmir3oo4amtnlneslt)s2tm(m ot4oetomietltlsDrmnmsnu) reoif iydlmt  u s t0 2xrxr3ou4lleemfesltf ruaump;o0tpe  i3iatla rln snu0 rxomo oy1op  au s;t0 2umxm3ny4olt livt tf 2ua(  no1alt  oeiysfsDran on(4 rerxo3iatlaD  i s;t)trum(m3io4amenmnetatfaDtmxmpoo0apto o3iatfm2uau s (4 rxrxfctodfpD ln ol(0s2trxm3oy4omte fet sfs2ta(  nu4aeen oeiatfmDemn ont) rtoifciydopDr i i ()tetm(o nu1lm  mieilt  Duax p;u0opeoioetyt sDeauvon()teenxo3iydoate n s t t2uo(opoy4am emfesa(fsrrr(r ;t1tpen o3iasfaDrau o;t) rxomo oodlpt  ieils)srxrxmpoy4al  lfct t a2tm(m ;u4olxomo3tldlm raumsnu4 rtnio3tydopD aueil( srtr(opiy4lp n fcsltfsrtaxroou0olen ieiadls ea(vp t)arxnxo oodla rli sl(0 rxrirpoy4lp  lfci ( aDtr( pot4oexoiietlsfm ranvp (4aexrxf oadoa rlnvo ()srxrir iy1omenlicsls)aDtaum no0oexoiictytls2uanvp;(0 exrmr3oydfp rau s;(0t2xo(o3ou4om  lfvtl(f Dumu  ;t1tltn o3iytfs uanvs;(0trtrmrcio1faD lu s;s) rxo(o3nu4ll   neta(fsrua(root1tex ioeiys s2ul( ont0tetomfcoatomt  u s;s)srxr(mpio4lle mfvil(fsruau  nt4alxn oeiadlaDem(mp u) etrif3ty1laDranvslt) etoxm iu4aleelfcia(fs2urump;u4aeen fciadla2ranvs;t0 rtoio3tatomD aneo t setmxo oo1opt  iesat  2uaxmpou1tleniociltls2uluvon(0 reoio3iatfa  aieolt)s2ur(opio1amenmivtlt)aDra(mpno4tpxomocilsfa2rlnmp;t0 reoxo tatlm  lies (0s2tmxopnydapenlnei (f 2trx onu0apxomi3iat s2emn s;t) etnio3to1fpDelu i ( t2xo(rpiudlpte ncils a2ua(moot4aetniictytfsDemu onu4arenmrcia1faDe ivo s trxoim3nu1lmen neslsfsrtmu onu0apxomi3iatfm2rauvo t0areomrcoytlpDrai ils0 2tm(m iodom n iesls)arrr( pnt4tltnmoeiadfmDranvs;u) rtoxo iy1opte i s;()t2tmir iy4lpen iviat  rua(mo;o1teeoifetlt aDrl(mp (0trxnmf3totla r uvo;(0srumxmpiodomeelieta(  Durxrp;t4oexnmfeiad m2rmnms;t)tltrxo oodom rlues s) 2urxo3oy4alt mies t  rtmu ono1tlxnmociad m ea( sn(4aeenmr ia1omte ueo s0 rxmimpiu4ame mfvtlsfsDrr( o;u4alt ifciatlmDranmsn(0aleoir3tatfpteai ilt)seur(r3ou4al elivta() rta(r ot1oltnifciadla2eauvp ()trxrxo3oatoa elueo t srxo(rpnydopenmietl()aDum(mp;t1oltoifctlt a2em( s;t) exrif3totfmtelies t0trur(m iu4lp n ivtl(fs2ta(mp;u4ope  iciasls2emuvp ()altnmr3ty1lp rli olt0trurimpoy1ole lnesa( srtrxroot1aet iociysfaDraumo u4 lxnioctadlaD  i s;t)s2tmxo3oodllen ncil() 2ua(  nt1aexoii3iysls2rmn s (0 leomr3iytfatelivolt) 2tr(rpno1lptemnctatfarra(m ;o4apt ifetysls2uluvp;(4arenxo iy1opD  u sl( trtr(o iy1alt mict tfaDtax pot1tptnii3tydlm um(vo;t0teerxf3oa1lpDraueslt) eto(m3nu4aptelfctasfs2ra(mo;u0tlxnmfeiat aDrm(msn(0 ltomo3oytlmteaneo;t0 rur(opoudameemivia( arra( pot1aetn ictadla2eaums;t0 eeoif tydfa eai i (0texoxm3oy1ameelncil(farrm( oou1alt  iciyd mDea(vo u4 rtriocootfpDrauvo;s  rurir3io1alen ieilsfa2rau pot0alt  ietytlmDul(vont4tetrxfcootlm   ues;s tetm(opou4omt livtat) rtmum oo4ale  i3iad s ulnvp t0 etnxr ty1lpD  i ol( s2xmim3ou4altelfcsls) 2um( onu1alxnmf3iydls2elu s;(4alxnxf3tadoa   uvils0trtr(m ny4lmtemivs t a2tax  nu4tlxn icildfaDul(vp;(0 exnmrciydop eluei;t  2umir3oy4lm nmfesa()aDtax  ;u4apx mf3iys aDumuvs ()texrxo iotfpt  ueols setoxrpnudaltnlnvsl(fsDuau p;u4tetnmi3tltfs rln pnu0 ltoxrciydoaD lu s s)trxoxmpnu1ol nmivilt)a2ra(m ;t0tlt  ociytfmDuan o u) rermoctodlaDrli il(0t2urxm iu1lmtelnctat)aDrauro;t4tlxnmo3iys aDuluvo (0 ltoxf3iodfm rln ils) 2um(o3io1ame lfcta()aDtaxrooo1tpt ifetldla2eauvs ()aleoxfcoa1lat an sl(0teumxmpio4omeelivslsfaDrruro;o0alxn f3iltlm2ua( ont)aeeomrcootlm elu o s0t2tmxr3iydape mfvtas) rtaxr ou1ole  icilsfm umumpnu4aetrmfctodoa elnvils t2umxr nu4llee nctltfsruru o;u4alxoii3tlslsDuanmo t0 eeoif3oadlat  i i (0s2umxo3ny4omtelieilt)aDrax o;u4oet ii3tad s2rlnvs t4texrxf3iydoptean o;s)setm(mpou1ape  nesatf Dtruront1tpeomfetys s2uluvs;t) rtnir oo1opt  uei ( setrim3iydaptnmicsl(fa2tmum ou1ape  fetys a2el(ms t)alxrxr iadfpDelieo;t0trxr(rpnydoleemnciatf 2umxr oo4apt  o3tysfmDrln pnu4texrmo to1fp  luvi;()seto(r3iy1lmenmnvta(f Drm(rpnu1oeeo ieilsfs2umu snu4 exrmf3iytoaD  uvs;t setoir nydolee fciatf 2tmx  ;u0tpt  ieild m2emnvs (4 ltoxr3oydfp  liei t0srtr(r oy4optnlfeil(fsruru o;o0tetniictlsfmDrlnvs;(4alxnxo3ia1lateli i;() etr(m3nodam emfvslt sDrmx pnu4aet mi3iyd s rlnvo;u) renmr oy1opt  nvs t0t2ur(o3iodom  lfes s)aDumxm nu0aexomo3ilsfs ranvp (4 rermo3oo1laDeaivs;t)seur(r io4omeemicils srrmx  ;t0apxnmfetyt a uau p;t) lermr3iydlptr ivo;( trum(m nu1lm e icils aDtrurpoo4teen feilsfs2umu o u4 etnirciatfaD aieils0trtoirpno1al   ietlt) Dra( p;u0altnifetyt m um(vo t0 etrxf tydfm   nvi;s srurxm no1omte fcsas srtr(mooo1aexo oetadlsDemuvont4tlxnmo3iytoaD  ueo;( t2tmxo3nodapen ies tfs2tmu p;u0tptoio3iat m2uanmo ()trtoioctatopt anvolt)trurxopny4oleemncslsfartmu p;o0tetomiciatfa ea(mp u4 rxnio iodoa   uvsls0srtm(r nu4oleemnvilsf rtrxm ;o1aetn ocils m2uaump t) eerir3oytlmtrlneilt  2xrxr oydlptnlfvsl( a2rru pno1oetniiciyt m rlnmon(4artnmfciatfaDeau s;(0seuoxo ny4lp  mnvi sfa2tmurpnu1optoifciyd a em(vs t)aeenxo3iadfm eauvsls trtr(rpou1lm e fetat a2uaxr ;o4oeen o3ias s2eluvo;(0altoxr3oo1fpDrai o s)seto(rpiu4lmenmfci s  Drmxm nt0tlt if3iatlaDemnmsnu)alxrxociadoa elneo s0 rxo(o iudomt  fvtl()a2um(r ;u0opxnifeiad m2ulnvs t4treoio oy1la eli i;t sexr(mpoodomtnmnesas s2taum ;u1tlx  i3tlt s2rlu s t4 rxrmf oadfm elues t0srxr(r3oy4op  lietl(fa2ta(root1oetniieild aDum(vp u4texnmrctatoateai o;(0srxrio oydol nlfvils)aDtmxronu4aeeoioeiydfs um(mp u4tlxrifcty1lptran o t)tetrimpny1lpe  ivs (faruauro;t1tlxn f3tldls rm(msnt0artnmr tatop elu ol(0t2tmxo3oy4open neslt a2urumpnu0tetnioctld s2ea(ms;t)altnxr tydlm elnes;t0t2xm(opnu4amt  fvt ( srur( o;t4opeoiieiyd s ranvs u)tltrifcoo1la rai slt) ruoxo oy4lle mneia(fsruru  oo0aexniietyd mDrl(mo;t4 rtnmo3iatlpD au s;s0 2uo(m3oy4optnlnviasf rraxmpoo4apx ii3tlt a emump u0 lerif3oo1omt au sl()trtrxm ny1lpte ictlt arrrxrp;t1opx  fciasfa eanvp;()trxomf io1laDeliesl( srur(m oo4amen fet ( aDrmxro;o1aptnmieilslaDuanvs t) reoio todlaDr n il() 2tmir3nodlmt lnesas)a2umum nt0oleomoeiatfm2emu onu0 exrio3todfp   uvol(0sruoxmpoudope  ivi t sDrru ono4tet if3ilsfm2em(ms;t)trxrifctodlaDe nvi s)srxoiopiy4lmtn fvi tfaDtmumonu0ale  feiasfs rluvonu0 lxnircootfpD auvils teto(m ou1lmenlnvtas) rrrump;o0teen fetytfa2emumo () ltrmf iytom eai ols sexo(r oodlp nmfeiatfarrmxrp;o1altoioctat mDuluvonu) lxrmf ootfat anvi s0 2uoxm ny1ol  mfct t) Drrxrp;o4olenioctlt m rlumo;u0aetnir totop eliesls t2umim oy4openlnvs t) rtaur nu4oltoioeiltfa ulnvpnu)teeomr3iadlmt auei ()s2urir3nu4aptnmfvi s)s2um(r ou1aex if3iys m2umnvp;(4artoxrciytom  ln i;s seumim3oodlle mivtasfa2umx ooo0olxnii3tysfs2rln sn(0trxoio tatla e u o;s)s2xoimpiy1optelivi ()aDrrxmooo4tet mocildlaDrlumsnu0aexomrcty1latranvs;(0 eto(o iy1al   ivtat)sDtrxm oo0opeoiiciydfsDul( p u4aeeoxf3ty1oatrlnei;s) 2toiopnodameemivs s aDururpoo1apxoiieilslaDemnms u0 etoirctotfpDe n ils  2urxrpoodolt mncslt)arumu oot1tptn i3tad a umumpnu) reomr iydfmDe ivsls0sruoxrpoy4lptnmici s)arrmumoou1oleomfeils sDumnvon() eenmo3oydlmtelueil(  rtrio3nudlmtelnvia(fa2rr(r oo1open oeiytfsDuln s;t0altrxf todlp  an ils0srxmxmpiudoleemfct s) rra( pno0opt iociatfs2umn o;t)areniocootoat ai s t)seumir3iu4lme  ieiat aDtrx  ;t4olxomo3tyd s2ulu pnu4aeeoxo todopte ivi () rxrxmpiu4ap  lnviasfa2ra(m ;u1ole moctatfm2rauvo;u)tetrio3oy1la  li sls0s2tmirpoo1oltn nvs t sDurxmono0oetnmictadfmDumu s ()aeenmo3totfmtraieolt  rxm(mpnydomtnmncsasfarurxmono4aexoiocias a ul(mo u0arxnir3iy1lp rauvi;s s2xr(r3oy1op n ivslt s2ua( oot0opx io3iyd mDuluvo;t4tetomfcoydlp e i i () 2xoir3oo1ape mfctat a2ra(  nt4apx mfcilsfm2eau p;t4altomo3todfpDeanei;t sexmxr oy1amen ietas)arurx pou4apxniiciadlm2ua(msnt0 rtnmf iydlptelu ol( srtm(o3iu4lp   ivtat  2urumo;o4aexn fciltlsDem( p u4tlxnxf3oo1fpteaueolt0s2trio3oy4aptn neilt)arra(mpnt0aptniiciydfs2um( onu)alxrifciodop raiei () rurirpiy1olen ivt () Dra(  ;u4tlenmf3tlslmDeln s (4areomo3iy1fa ranei;s)seur(r oo4opeeliet ()s2tm(  ;u4tpx  fciltfsDea(vo (4aexomoctadoateanvs s trxmxr3nu4al n fvtlt)s2tmx  nu4optoio3tydfm ea( s;t0trtnmr3todoatean o;t0s2tr(m iy1lle mfvtat a2uaxrpno1apxnmietys mDemuvp;(4trtoxocoydfm r nvs;s)truo(mpoy4am e ncias aDrru p;u0oeenmoeiyslmDrm( o;t) rerif tadom e ieo;(0trur(o nydap elncsl( arumum ;u4tlxn iciysfa2umuvon(4tetrmr to1opDraueo;()texmio3oydol   ies (fsruax onu1tpx mietaslm rmums t) rtnmr iy1oaDeaueo;()t2umiopiu4lm elnetat arur(rpnt1opeo f3iltfm2raump u0aeeoirctodoptrli il()srxrxmpny4alt mfvsls aDumxro;o0apeo i3tyt sDelnmp;u)artoio iodfm  lnvi t  euoio nu4aleemieil(  2ua(r no1oleo ociytfm eln snu) etoxf oa1lp  ai o s)srur(opnu1amenmiet t s2taxro;u0opt if3iyslm2ranvs;u)aexoio oa1fateluei;s)srur(rpiy1ale  fes tfs2rr(roou0alto i3ild a rl( onu)alxrxr3ootoptr ueo () etoxm3no1olt  fci t) 2uax p;t0tetnifeiydfs2um( s;t0aetoxfctadom  ln i;t) 2xriopoydomenlfeiat)aDurum nt4ope mo3iys a ulumo t0 lxnircoytlmDelu s;t0tetoxo nodlpe mfvi s)sDum( ont1oexoif3tadlaDulnvo t0 ltrxfciytfp rli ils  eurxrpou1omt miviltfarumu o;u1tpeoiociysfa2rauvpnt0aetoxr3iadomDeaues t  rumirpiy1lm  mivtl(fartrxronu1aex  iciltla rauvo;u0trtrmo iytlpDrlnvo s0srtr(o iy4ole  fcs sfsrtr( p;o1oleomfeiadlm eau o;u0tlxnxo to1lmtr uvs;(  2urxo3no4omenlictas)artaxmonu4teen fctad aDrmn o u) lenio oodlpDeli o ()texoim3oy4ol nmfesa()aDtmx oot1ole  fctatfmDrluvonu4areomocoa1fmDr n sls)seuoirpio4am   fvt ( srumur ;o4tlxoioetlsfs ul(mp t) rxnio io1lmtraueils  ruoxo no1apt licslt arta(r oo1apeo i3iadlsDel( sn()tetnxf tadlaDranvs;() rtmim iy4openlnviasfsrtmumpnt0opeo fciyt s uaump u4trxrxf to1laDe ueo;s0sexr(m3nu1alt  ivsasfa2um(m ;u1tltnioctatfaDuln pnu4altrmo3to1lpt lueol()teumxr no4lme mfctasfa2um(ro;u1tlto iciadlmDum(vo (0aeeomo3io1oa  lnvil( tetm(opou4lmtelivi (fs2umxrpnt1opt ii3iasfmDuanvs (0 rtnmf3tydlp   uvo;t)texm(r3no4omen fcslt)sDrmxm oo1aetomf3ildfs2ul(mont)altrif iatfpte u ol(  rxmir3iodameemieiasfartmx  nu1tlt iietad aDean pn(0tltoio3todfmt an i;s) 2tmir iodlm  lnet tfs2urxmont4olxnif3tyd s um( pnu)areoxr3iatoaD auvs;t)seumxm iydape  fcia() Dtrx ono0oleoiicilslsDean o;u) renif3tytlpDr uvs s0srxo(m io4apenlncilt)sDrmu pou0tpxnmieiltfs ranmpn(4aetrmr3oa1op e i o s)trtrxm3oydlptn fvs s srtmu pot1teeomietyt m2eaump;(0teeomf oo1fpt lu s (0 2toirpiudam   feil( s2uauro;u0aexoii3iad m uaums u) eeoxrcia1lmD lneols)texoio3oodopt licta(f rtaurooo4opeoifeiysfm2emn s;u0altoif3oydfaD  nvs ( t2xo(m oy4ll  mnviatfaDtrx poo0opx io3ilsla2ulnms (4aetrio iotlp ranvs;t) rumio oo1lmtn nvi (fa2rax  ou1openmfeiytlm ran pnu0alerxr3iadom elivolt0 2toim3iodlmt mfci sfaDrmurooo0tltomietltfaDuluvpnt4 lxnmr3oydfmt  ieo ( srumirpnodlm elietat a2ur(mp;t1ape ifctlsls el( snu) reoif oa1op rluvs;()texrim3iy4ol elieiat srrr(r ;t0apeo fctat m um(vpnt0teenmo3ta1lmD lnei;t  rxmirpoodlp  mnesl()a2tmxmont4tetnmoeilt s2rm(vs u) lxnio3ootfm raieilt0teuoxr3ou1lle lfvsl( sDraurpnt1ape moctadlm2uauvo;u)tetrxr3oo1fm   nvi (0 exrirpoodale lnvilsfsrrmxm ;o4tpe moeilsfa2emu p;(0texrmrctytom r ivi (0trto(opou1om   icil(  2umu o;u4aleoif3ild a rl( on() rtnxo3oy1omt an ols0 exrir3nu4omt mnei tf rra(mono0optoioetat aDumnmp (0aetrmr3oydoa  ai sl(0s2urxo3ny1op nlicils)aDurx p;t0tle mfcildfm2umn pnt4teenxr3iadfpDeanvi;t s2tm(rpoudlpe  nctls)artmxrpoo1tleoiietlsfa ran o;t)tltoioctytoa eauei;()tetmiopnydaltnlncilt a2rm(m nt1tetoio3iys s el( o;t4 rtnircty1latraneo s truoio iy1alenlicsas)a2ua( ooo4aetoif3iaslm2ulumsnt0 ltrmo3ta1lpt  i il() ruoim3ny4amen neta(fs2urxmp;u0aexnmoetatfsDumump;(4alenxociytopDrauei;s0 rxo(o3nydlle mietat  2rrumo;o0aexo o3iys aDra( pnu)tlxnxo tydoaDr uvslt0srtrir3iy4ap e ici ()srtaxrono1optoiicias m uau p;t) ltomrcoodoat aueo ( trtm(rpnydalenlivs (  Duaxr ;o1tlen fciyslmDrmn pnt0 rtoio tatfpD liei s0t2tr(r oo1omtemnciat a2ur(m nt1olxn oetys a emu onu4teeoxrctodoa  lnvi t0texm(m3no4oltn ics t arrm( oou1olx iieiltls ulu on()tlxnmrcto1opDeaues s)truo(rpno1lm nlicia( aDtm(mooo1oexoio3tad s2rl(msn(4texomo3ia1latr neilt  2uo(rpou1om elies s srtrur nu0opxnioeilsfs emu ont4aleoxo3tydlptrli o t)seuoxo nu4olenlnct t)sDrr(  ot0tetnioctlsls umuvsnt4 exomfcio1lmD luei (  rtm(rpnu4om emfvi s)sDurxrpot1tet  fctytla emums;u0arxomo3ootlat  nvils  rtrxm3oodll  mnetls) Dtmxr ;u0ale mfeiysfs elnvp u4altnmfcio1fmD ln i s srxmimpno4apte nvsls sDtrur oo0olenmo3iysfsDrmnvp;()arerifciytlatelies;s0 rtm(m3io4oltelfei ( aDtmxroot0tetnif3tls m2raums;(4 eenir oytopte n s;t)s2um(o3no4lltnlnvslt sDtm(mooo0tet  fciltfm elu o (4texrxo io1fptraueo;(  2xo(o3oydomeelfvi t)arumum nt1alxn fctls m2umump u4tltnmoctotfat lnes t0srur(o nu1ame  nesa(f rrm( o;o1tee mfciat mDrmu s (4trxrmr3iotfm  aues s0t2tmxm oudlptnmfesat aDrmu  ;u0olxoiieiasfm uanmo ()alxnxfcia1fmD anesl( srxoiopoy1optelfvilsf rrmumooo1apto f3tlsla2ranvs;u)artrxo totlaD ai s;(0 euo(rpiu4al n fcs t s2tm(mpoo1tex io3tlsla2ul( on(4 ltnmf3iadfaDraivi s)trtmimpno4lpe  fcias)srtaumpnt4aleo i3tldlaDrl( snt) etrif3ta1fmDe ivol() exmio oo1opeemfcslt)sDrax oou4aptnifeild mDumn ont4teerxo3oy1faD lnvol( seumir3iudom elivtas)s2uru ooo1tltnmociyd s2eau snt)artnif oytfmDrli s;( setoxo3oy1oleelics (  ruaumono0oee ifeias aDea(mo;t4arxnxociydfpDelneo;s0texmxm3ny1lp  lnvsl( a2tmu onu4texo o3iaslmDem(vpnu)aleoxo todfpD  ueol()srtoxo3iy1lp nliei t)aDuaxm oo4tptoif3iadlm2uan o t0arxoifciytfpDe nvo;t0seuoxr nydllen nctlt)s2rmxmo;u1olxnmi3iyt a2ea(vs;t4alerirciodlpDrlneil( s2xo(opoydopeelfvia( artaxmp;t1aptnio3tadla2uln s u0 rxnxoctadop elueo;t0srtmir oo1am nmietls) rrmum nt0oexnioctlsfs ea( o;t)artrxo tydlmD  ivilt)t2urxm3iydaltemfviasfarurxro;o4ale  fetytfs2emnvonu4 eermfctydlp eau ol()t2uoxo oo1omenlfcslt  rur(rpou0oleomiciatfa2ran pn()aexnxfcta1fp eauvs;s)teuriopou1ome lict ()a2tmu pno1tpx moctas s2ea(vp u)aeerir oo1oaDrli olt t2xmim3oo1lm elieil()s2ra( p;u4oee ifeiys a2eanvsn()tltnifciy1omtrlu o s) 2xoxo nu1op elictl() rumx  oo1olxnmiciadfa ul( o;u0tltrir oadla eluvo;s  2xrxr3nodlp elnvtlt)sDtrx oou0oeeomfcilslsDrl(vpnt)texoiocta1fmtr i o;s srxriopiu1apee fvta( a2tmxro;o1aetn octytfm2eaumo;t0trtnircoatoatr ues;s0t2xmxo ny4olt lnvta()aDtrx  nt1tltniociyslm2umnms;(4 rxnio io1om r nvo;t0t2to(rpio4am e nei ( a2rm(r ;t1tpto iciat s rm(vp;t)trxnxr oa1oat  uei;() rtrxo ou4om  lfvilsfarraxrp;o0olxn o3iydfm2ea(vo t4aetomo oadlatr u ol() eumimpoy4apenmnei sfarta(r ;u0opxnif3ilsla2ulu o (0aleoif iotlat ai ols)seto(o no1op nlnei (f ruaur ;o0olxnmfctasfm umn s (4trenirciydlate n ilt trtoirpnydolte fes sfartrurpnt0aexnifetltfa2el(vo;u)teenmr3iy1opDrluvo;( sexoxo3oodolenmfvt sfarurum oo1olxniietat aDemuvp;(4tltnir3oydfa eaneo s  2uoir3oudlpe mfesa( aDtrxmont1tetnifeiatfmDel(mo t0 leoio oytfpD  ivo;s) eum(o3iodamtelnctas)aDrax oou1aeeniocilt m rau p u0 etoxf3tatlmDeli i;t trxrio iudlltn ieias)s2raxm nu4aetnmiciys s2umuvp u4 lxrxf iotfp r ieo t) 2to(m3nydopt mfctlt  rtrurono1aeen feiatlm eanms;u)arxrir tatfmDe ues;(0s2tmxm no1ll n nvias  2rr(rooo4tltnii3iydlaDelnmonu) ltnif iodlp   nvs;s0t2xo(m3oy4lp  lfesatfa2urumonu0oltoii3iltfs eau o u0 lermr3oodlpDeaneol(0 2urio iy4lp elfvilsf Drm(rp;o4aeen i3ildfs eanmsn(4 rtrxfciatfm eauvsl()srxoxm3io4ope liviat)sDraumo;o1olx io3ilt a umnvp t4 lermf iatopDrln o;(0teumirpoy4aptnmfvtl(faDua(mpno4oeeo f3tytla rmump (4 rtnmr iadlmt auvi s)s2um(m3iodal emnci s arrrx o;t1alt  fciytlm rl(vp;(4 lenxf3totlpte ivs;()sexriopnodomee ivtl() 2taxmonu1tleoiieiyt m2ul( snu) eerircoodfmteauei t0srtm(opnodop emieiat)sDuau ont0tpenii3tad m2umnmsnu) eerif3to1oaDelies;() rxmxo3oudale lfvtas) Dum(mpou4opto ieiatlsDrmnmsnt)altoircoodlmD lnvs;t)s2uoxrpoy1lltemiei sfaDururpou1open feilsfs2ua(vp t)trermrctotfmDelieo ()sexo(m3iy1om nlfvsa(f 2rmur nt0olx  fctadla ean p;t0 eerxf iydla rlu ilt  rxmxopiu4am  livilt) rua(rp;o4opxoiocias sDrlnmon() eenxo3iotlp   nes;s0 2xmxrpnu1lp nmnvt t)a2umxrpnt0oexo fctasla rmuvont) etnxoctotopDrlivi t) rtmiopno1altn ies s)aDta(root1texoii3iadfs rauvont0tlxnxr ty1fptean ol()s2umir io4ope  fvsat  rtruront0ope mfcilslm umuvs;t)alenxoctadfpDeaneo;(0texo(r no1lmtnmnvtls  rraumoot4oexoifciytfm2rln o ()artrxfcoytoatrliei (0t2tmimpoy1ll n fesat sDtm( pot0texo oeild mDeln o t)aetomf3tytfaDranvilt texoxopoo4altemnvta()aDurxm no0oee mociltls rlump (0 leoif oydfpt ln il(0t2umxopoudlp  lnctas a2taxr no1opxoii3iadfm umuvp;t)arxnxf iy1fatrauvols0 rxrir ou4ole mivsat a2trx ooo0alx mi3ils m rmn sn(4alxomf oadlpt  uvo ( s2to(m3iu4omeemfetatf 2tmxmoou0tleoioctlsfmDum(vs;()tlxnio tydlp   uvo;s teurxopiodame lfcia() Dur(r no1tptn i3iat a2uan o (0tlenmf3oytopD lies ( t2um(r oydomtnlfciltf rrmuro;t0tpe mfcias m2umumo t0aeeoio3iodom r i s;s0teumimpoydlp  livtl(fa2tmxr nu1opeoioeiydlm ran o;(4artrmrctytlmte uei;(0s2toiopnydalee nesls)sDtaxro;u4ole ii3iatlm2uluvon(4tltrxo3oodlm eau ol( seuoxopio1lm  lfeiat) Dtrx  ;o0olxn ociydlsDemn snt0 exomo tydfa rlneol()t2xrxo3nydlm nmfciasf rrmxr nt4olxn f3tas m rl(vpn()alxoxo3iy1fpD  ivo s s2trxopiodlleelfci (  2taumo;t0aleoioetyt m2eln p t)trtomr3ty1fat  ivol(  2tmxopiu1lpt lics t) 2rr(mp;u0tetnmieiyd a2elnvo (4tetnxfciatlatrlieilt  rur(r oodalee neta(fa2tmum ;t1tltnmieiydfm2emu ont0treomocoydopD  u i s0tetoxmpoy1ameemnvsls aDrrxrpno1tptn octldfa el( ont) rxnmociatfpt  i ils sexmio no4opeemies t) rtr(rooo0alt  i3iadfa umnvs ()trermo3oadfaDeli o t)trtoxo3iy4lpee nei s)aDua(ro;t1olen fctytls ulu sn() rxrmocoytlaD li ils) rtriopiy1lme mivi (f ruau  ;u4aeenif3tydlaDuauvonu0 rtnmr io1la raivi (  2toirpnu4optnlnesa(fsrur(moou1ape  fetysfs eln p;u0texomf3oydfpDrauvil()trumxmpno1amee iviat aDtr(ro;t1aexnmo3iyd m2rl( p u4artoxfcoatlptrliei (0srxmir ny4lmt mfviltf Dtm(m ot0teeoiietadfmDrlumo;(4 lenmr3iatfa  an s s) rurir iudomeelfviat  ruru pno0texoii3ilsfs2rl(mpnu0trxnirctydopDrlu sls)t2um(o iu1ll  mici s a2ta(moot4oeeoifctldfmDeauvo;t0teerif3ia1om eaivi;( texrio3no4ll  mnvi sfsDta( p;o0oee ioeiadfs em(mp ()arxrxr3oo1fa e uvi s) 2trimpnu4al nmici t)arrax  oo4aptoifctld s2rmn o (4trermr3oytop  aneo;t0srtrxm iy1ape lfeiat)aDrrx oot0tptomf3tysls2uanvp u4trxrxo ta1oate ueils0 rxoio oodalt lici t  Dtax  nt0altnmieildlaDulu snu4 rxnmo oodopD au ol()s2trio3oydlle mfvi ()a2ur(monu4aet moeiydfa2rlu o ()alenxr tytop ean ils)t2uo(m oy4lpeelieta(f Drax pnt0teenioeiysfa eaumsnt)alxrir3oydlmDe ueo;(  2urimpoy1om elnvi ()a2trxrp;o4ope  i3tys mDum(vp;(4trtrio ty1fmt lnvo ( setoiopou1omee netat) Drm( o;t4alxo ietasla2rmuvpn(0 ltoxfcoytfpDr ivilt sruoirpiu4amtnlivil( sDrmur ;u4opeoiictatlsDul(ms u)aeenxr3ta1lateli o s srurimpoo1ol elfvsl( aruax pno4tle ioeiyt a2rau pnt0teenxr oodlmteliei;t s2xoxopny4aptnmncias)sDrmx  ot4tlt ioeiydfm ra(vs (0tlxnmf3todlp  li i;t tetoirpiodaltn neiatfsrraxm nu1apxo oeiysfmDrm(mpnu4tlxrxfctadfpte n i;s0t2triopnodal   neta(fsrur(mpnu4oetoif3iysfaDeanvo u)trenxfciy1faD aivilt trto(mpnudolte nes tf 2urumo;o4aptnifctadfmDelnmp;u0aexrxr todop rai sl()s2xrim ny1ll n fvtlt a2ur(rpoo0opx ifciydfmDemump (0tetrio oy1lmDrlueol( srxoim ny4omenlnei sfarrr(m ;o4oet  feilt m2ea( pnt4 exomr3ty1fpDranes;t)srxoxm nudapt liet t)aDrr(r ;t0tlxnmfeiat a umumsnt0artnir tydlptranvi;s)s2urxmpno1ale  icsl()s2ua(m ;o4ole mieiydla emnms u4 renifcoy1laD lnei;(0 ruo(opou4ol  livsatfartm(  ;t0oetnifciyt a eaumon(0aexnxfctatoaDr nvo;t teuoxm3no4lmee iesl( sDrauront0tpx  oeiytls2elu ont)trxoiocoo1lmt  uvs;t texmxm3io1lptemietat sDrmumoou0tpx  o3ildls2rauvpnu)texnmf3iatfp rli i;t)trumir iydop  livil(fs2tr(m ot4oeen ociadlm2rl(vo u0tetrxr3ootlate nvi s0sexmiopno4lptelics tf Duax pou1tlt  fciys m umnmp (4tlxnxfciy1lmtelueils)t2tmiopiodoltn fvt t aDtaur ou4teenmietad m umnms;u4arenmfciytfmte i s;t) etrxm3oo4al  lnetl( srtm(root4aptn ieils s2rmnvs;()trxrif iydfa r u s;()s2toio no4llen fviltfs2tm(m ;u4oltniicilsfs rluvo t) lxriociadfmDe nes s) rtrxmpio1lp elfvi s arrr(rooo4apeoif3ils a2emnmp;t) rtrmr3to1lateluvi t) 2xoxm nu1lptelfeslsf rrr(ronu1aeeniociyt a ua(msnt4trtrxr3iytfa   ieilt s2xmim ou1lpeelnet s a2tax  ot0tpxomiciatfa uanvs (4areoir iydfaD aueo t s2xoiopiy1omtnlfetas)a2tauronu4tlenmicilt mDum(vs;t0trxomf3tydoatelues;s0trtm(rpiudam n fvtl( s2tru  ;u4tle if3tadfa rmu p (0 rtnxocoa1om eauei;s) euoxrpio4ape lfvilsfarurur nt4tetnifciydfa2eluvpnu0 rxrmociy1omtelneilt0t2tmxm3iu1amt mnct t srtaxr no4tlxo f3iys a ea( onu)tetnxr3tatlmD  n ol(0texr(m oodolte nvils aDumx p;o1teen iciatfaDel(vo;u4 rerxf3ia1fa ranes;s0t2xm(m iu4lmtn ivi ( s2tmxm no4altoifciltlm2um(vo;()trtomo iotlaD  u i (0teur(r3oy1apte fcs t  2rm(m nu1opxn f3iydlsDuauvsn()aeenifciadlm ran ols)texoxr iudomenmfvsl(faDur(m ;u1apt ioctldlm elnvs;(4trerxf oo1omt livs;(  exoxmpny4alenmncia( s2rmxmo;o1oeeoio3tytfa ea(ms;(4trtrmr3iy1lm  lu s s0trxoxr nu1lleelict s  2trurp;t0olto feiyt s umnvp (4trxnmrctytlpteluvi s teto(r3iodll  mnvia( aDumumo;o0tltnioeiys aDum( o u0aeerir iatfm  ln olt  etrxr oo1amt mfcs t artmxmpot4optomieiytla emn s;(4altrxo ootopDeai o;s) eurxopoo1lmen iesl() rtrxm ot4t
\ No newline at end of file
@@ -0,0 +1 @@
+i s t0 etrxrpiydopteliesatfsDta(m ot1tet ioctld sDemu o () eeomr3tatfmD  ivol( s2xoxm3oy1olenlfct s artrum ;t1tpenmietyd m2ul(vpnu0 lenmo3io1oaD luvslt) etm(r oy4aptnlnvt s)artm(mo;o1altn fciys m2ua(ms;t0arenmr tatlm raiei;()texmir3oudomeelneil()srurxrono1apt iictytla2rmnvpn()tetrxfcoy1fpt lneo;t)texrxr iudoltelicsatf rrmxm ;o0tle  feiytls2uanmo;(0tetnif ta1latrlnvslt0sexrim3oo4ope lieiat aDumumonu4apxoio3tas a2ea(vs u0 rxnirciydfpD  ieslt)srxrxopoy1amtelivs (  rrrxm nu0tpxomfeiysfmDumnmpnt4texrio3oy1opt li ils0 2urio3oodameelfvi (fs2trx  oo1optn o3tyd s el(vs u0aetoio tadlmDeaueslt0s2ur(mpou4alt  ietls) Dtau ont4oee if3tad m2rln pnt)trtnxr3tatfpDeaneo t s2uoim oydapen fci ( a2umum ;u0apx mf3iydfmDumu ont4 lxrxr3oydomDr nvi ()t2urio ou4ll e fcilsf ruru pnu4oeeoioetytfs rlnvon(0arermo todfat lnes s0 2toxmpny1lpenmnvs t  Dumumpno1aptomf3iad aDeaump;t4arerxr oa1opte ues (0t2tr(opny1llt  nvi s)sDum(root4texoioctyd sDrmnvp;(4trtomr iytlp eauvils0sexmxo oodolenmfvtls a2rrurpnt1alen i3tltfa rl( p u)altnio iodoaD lueolt teum(o oy4alen nvsa()a2raum nu4tleoiiciatfsDem(mo;u)tlxoxfctotlmDr n sls0seto(opoo4oleelneslt s2ur(rp;u4tet mictad mDelnvo;t)aexrmo oy1lptrlu sls0 rxmxmpiu4ap nmics s)sDrmx  nt0tltnif3iytla elnvsn(0tltnmo iatoaDranvslt trumxr3ou4omtnlfvsltfaDuaumoou1aee iiciatfm ulu o;t4trxoxfcoydfmDeln s t  2trxrpiudol nlfvia() 2tr(  nu0tlenifctldfs umnvs;u4arxnif3oodfp ean o;s0 etmxm ou1lptemnvs ( srrr(  no4texo ocilsfm2ulu pn()aleomf iydfptrai s s tetr(r3ou4op   icils)srtmx onu4texn f3iytla2rl(vs;()tltoxocoatlaD aieo;t)trxr(rpnydamtn ivtlsf rurxmp;t0oex if3ild m2ean snt)aetrio3io1lpDr n s;s0texoxo3nu4amte ncslt arra(r no0apeo fetat mDumuvp (0 eerxfcoy1lmD aueo;()texr(r iu4oltnmfesl(farta(m no0altn ociytfs ulnmp;() etrmf3ty1la r ues;s) eumiopno4ll   ncia()sDurx  no1tpen feiytfsDelu pnu4aeerio3tytlmDeanvslt tetrxo3no4lme mict ()srrax  nt0aptnmietysla2rl(mpnu4texomf iodfmtranvs t) rtm(o3oo4al nmici ( sDtrx  nu0oltn o3ilsfmDua(vo;u)trxnxr totfp  ai ol() 2umio3nudaltemncs s) 2rrxmoot0teen ieiyt s2ra(mp (0 ltrxr oa1optrlnvo s  rurio oudlltnmietat) Drr( o;u4tleo f3ias m rmuvp;(0altoxocoatlmte nvs t) rtmiopnudlmtnlicsa()aDur( o;o0texnioeiaslm elnms () eerxfctydlptrau sls setm(mpnudlmeemncsa(fsDrm(r ;o1oeeoif3ilt m rlnmpnu0tetomrcoydlm   n sl( srxr(o nu1alt mncils  rrrurp;o4alxomociatfa ulumo;u4altnmf3oa1fpDrlues ( texm(r3iudlm  mfvtl(fs2tmxro;t1ope mf3ilsls uau s u0artnxr tadlptrln o;t0srxmir iy4altemfvs (faDraxm oo0alxo ieiyslaDua( s;t0 exrmf3iotoat  i s;t0s2xrxr3iodalen iciat) rur(m ou0opto o3iytfm2um( s;u)texnifcoadlm rluesls trtoimpou4lltn fctlt s2taumoot1oltn f3tld a um(ms t0 exoioctadlpt  i s;(  rxrim3iudol   ici sf rrmxmono1oeeo feiad m el(vp;() lxrir iadopD auesls  etoim iydaltn fesat) Drmx  ou0tpen f3tytla rmnvo t)texnif3io1lp  anvs t t2tmxr oodaltelfvta( srum(r nt4oltomf3ils aDeanvp (4arermo oa1omD au o;t0 2tr(m ny4om e neiltfa2rmx  ot1olxoif3tytlm2rluvsnu)tlerif iytfp e i ilt0texoio3ou1llt lfet (f Dta( poo1oeenioeildls ra( s;u0tltomr3iydfa rlneilt0seurxmpio1ap elnesl(fs2raur ;t1oeeoif3iyd mDul( on(4aetnxfciotlm ranvsls0 rtmxo3ny4ameeliesat sDrmxm ;u4aexn oetad aDeln p (0aexnmr3ia1lpt livils0 etrir3nudal nmfcs tfa2tru onu4tlt  i3iat mDul(mp;u4tltrmf to1oate ueilt t2xr(mpnu4lptelivt ( aruaxmonu4oee  oetyt m2rln o;u4trerio ta1om eanvo;t)srxrio3oodlpe  fvsasf rtrump;u0ape mo3tysls2rmumsn(4arxoircoadoa   ies t)teur(m no4al   iviasfs2um(moot1oexo o3tlsls raumonu0 rtoxr3ia1op   neslt0sruoir3iydlm emfeiltfa2rauront1oleomfeiad s uanmon(0treoxo3iodfmt  u sl( t2tm(m ny1lp nlncias a2taur oo4tlxo ociys a2rmnms t0arxrxf tatoatraiei (0s2tmio iy4omt mics sfsruau  oo0teenio3iasfa2emumonu4 eenif oo1fpteau i;t0 rxm(rpoy4lp emieil(  rrmx oou4alt ii3iltlsDemn p;u4artoir tadom rlues;() rto(m oy4opeelfeil(  Drmuroou0tpeo f3iysfa emump;t0tlxrmo ia1fpDeau i;s0texrxr3io1omen fcias aDrrumo;o4oltomictltfa emuvs t) lxrif3iotfat li o;t)t2xrir3nudol e ivtatf rtr(m oo0altn f3tltlmDeln s;(0 lxoir oodomDeanvi ( setrirpiy1oltemnvslt)a2tmxmpoo4aexn ieilsls em( s;u4tetrif ta1omt anvsl()t2xm(rpoy4opt  nvilt sDrm(moou4alenmo3tyd sDulumo (4aeerir3oytfatrlnei s0tetrxr oydame mnvs () 2umxm oo1olxn ociad aDuln o;(0artrircia1oaDrauei;( sruoxrpiydllt lnvsat sDurur oo0tltomi3ilsfa2rl(vp;t0aeenxf oytlm  lnes t  2trxopoodope mivt tfs2rmxm nu1ale  iciasfm elnvpnt0altnmfctytfm elies;(  2xrxr3oo1ope  fetlsfa2rau pnt0olenii3iaslaDumnmsn(4tltoio3oadopD anei;s0t2xr(m iu1am   nviasf Drm(  ;u4teen feiltfs2ulnms;t)trxnio oatfaDelieo t trurim3iudlp nmict s)aDrrxmpoo1tee if3iaslmDem(vo;t0arenxf3iatopDe ueo s s2xmxrpnodol e neta(fa2trumo;u0alxnmicild a rmn pnt)tlxrxrctadoat  uvi;t0 etr(r3nu1ol n fvtltfs2raxmono0tetnmoetasfa2rmums u)arxnxo ia1faD  nvi;t) ruoxopiudlpe  fcsa()s2taxmp;u0tltnifeilsfs rlu s;() ltrir ia1oatrli ilt)srxo(opiydlltemncsltfs2umx o;o0teeoiieiytls eln o;()aleoirctadlpDrlu sl(0srum(rpnu4ape lnci s srtrx poo4alt mf3tyd mDranvon()alerif3oatfmt anei (  rxr(rpny1lle mnviasfarrrxm nu4texomiciasfm2ul(von(0trxrxocootfmD  nvo;s0 ruo(r3io4lm nmieiltfaDurxmpno1oltoifeiysfm2rmuvp;t) eenmo oatoateau sls0seum(mpoudop nmfet s arururooo1oltoio3iytls elnmo;u) rtrxrcoytfp e iei;(0srxmxm3iydoltnmictlt)sDrr( onu1aetnifetadfs2ul( s;t4 rxoir3tytlm raivi;()s2tmimpiy4ap elfetat aDrmu pot1optn ieiatfa2uaumpn(0tleoir3io1om rlnesl(0teum(m iudlmtn fvs s) 2rm(r ;u1aetnifetas s2um(vs;(4arxomo3io1fatr nvols0 2xriopnu1omeelfcs t)arta(rpou1apen f3iysfsDrm(ms;t0 rtnxo3todfate u il(  rtr(opoo4lptelnetat aDra(rp;u0tlx  f3ias m2rmu pnu4trxomfcootopDrau s ( srto(mpiudom e fcil( sDrmxmp;t1oexnio3iyt aDuluvo (0aetoio tytoptr i s s0t2xoiopoo1ome lfvilt  rtruro;o0oex mo3tld a2uln sn() etoio3io1lmte ivo t) rumxo3no1openlies tf 2umuronu0openifeiasfm2umnms;t0altrmr3tadfp e nes t sruoirpou1lleemfcta()sDrm( ont1tpxoifciad m2emn o;(0 rerxo3iy1fm e uvslt)s2xoxo ny4alee nviasfaDtau o;u4oltnif3iasfs ulnmsn(4trtnmr tadfa   uei () rtmirpno4lmenmnei s) rtrxm nt0opeomf3iatfs eluvs u)teeoifciadlaDeanvi s0trxm(r3nydaltnmfviat a2urur ;o0alxn i3iaslm2uluvp;t)aexnio oy1fa  lieo;s) eurio iy4apt mictat  2rr(rpnt0tpe mf3iltfsDum(mpn(0trtrxo3iydop r u o;(0 2xrio3oy1open nvtasf Durxmpnu4tpt ioeiytls ulums;(4trtomrcoa1omDeli o;(  2toimpiodoptnmnvt s srrmu p;u4aexnmi3tatls2raumon() eenmo tatfmDelivols) eurxo oudlmtnlfeiatf 2rmx o;u4aetn o3tlt a2uanmp u)arxoxf totomtr uesl(0texrir io1olenmfvils) rtau o;t1oeenmo3iysls eln p t4aeeoxocoytlmtr ueils0trur(r iu4omtemfciltfa2ua( poo0tpx mi3ildfa2ean p;u4teeoxo totlmteli i;t) 2xmxr iy1oleelnvs sfarraurp;t4olx mictas m el(msnu)aetomr tytfpteai ilt)trxm(opiu1lptn fvias srra(ronu4olt ifctys mDemnmont) lxomo tadlmte nvi t)srto(opio1ome  fct (f 2umumpnu1apt ifciadfs2emnms (4teenif3iytomtr ivs (0 rur(m iu1lmenmncilt)a2tauroou1apx  i3ildlmDulums;()tlxnmociadoat aies;t) rumxr iydlm e ivs sfa2uau  ot1opt if3iyd mDrmuvp;t4alenmrctodlp   ueo;(  rum(opoodale micsat  Dtrxroou0oex ii3iysfa ra(vp u0altrxr3to1optranes t  rxrirpny1llee fvtlsfarrrurooo1olxnmo3iasla el( o;t)artnmr3oa1lmD  ivsl() 2xo(m3nu1lpenmfvtl(  Dua(moou1apeoioetas s ul(vs;(4altrir tadfm  an o s s2um(r oy4op   nesa(  Dur(m ot4tptoifcils m eluvsn()artnio ia1oaD livi () eur(r3nu4am nmfvi sf 2uaumpou1alt mietls a rm(vont0aexrxrcia1laD  n o;t)t2to(rpoo1alt  fcils)aDurx p;o0texnmoetlt a2uau o u)teeoxr3oy1fpD aiei;t)trtoimpoy4lmtemict ()s2tm(rp;t0alx mieiasfsDrmnvsnt0texoircoa1fpDeliei;() 2ur(m3iy4ol  mieil() rraurpnt0oleoiieiyt s2eauvp (0arxrio oadlat  ies s) 2triopiy1aptelivia( aDumxr nt0ape ifeilslaDranvpn(4teenmf3iatfpDe iei;t0 2umir io4lpee iviat)s2rmxm ot4teto fciltfa elumo ()trermfcoytoatrlivi t0 rur(m nudlpt miesltf Dtmu  no4apxo feias aDul(mon(4arxriocoodfptran slt)texmio iu1lm nlfcsl(fs2umxronu1apx  ietatlm2rlnvo;u0artrmr oodlm r ieil(0s2uoxopoydal elfvtas  2rmx o;t4aexomfciad s el(mpnu)teeoxf3iy1lp e nesls)s2umxr oudll n ieias aruru p;t4opx ii3tat a raumpnu4 etoxfciydlm e i o (0sexoxrpiy4op nlnvtatf 2raxr ;u1tpenif3ild a2emnvp u4 lxoirciodlat  ieils t2umir3ny4lle  feslsfsDua(m oo1oee ii3iltfm uanmsnt)aeenmrcoadlp  lnvo s0srxoxo3ny1ole lfvt sf 2umx ono0tpeoif3iadla2ua(mp (0tltrifciytfat  uvs;s) rurir3nydop  lnvils  rrax pou0tle mietadfs2ulnmo;t)artoxf3ta1fmtranvol(  eumxm iudapee nes () Duau oot4apx  octydfs ea(mon() etnxr totlptrau s;t setm(mpou1lp emnctl( srrm(  ou0teenmiciyt a eaump t0 eeoircoodfpt  neol( texrimpoodomenlfetatf Drr(rp;o4tlx  iciasfm2em(ms;u4teenmfcio1opDeauvol( s2urxm nodap nmicsa() 2tmuront4tet  fciysfa2ulu s t0 exnxo3ia1lptrli sl( sexoxm iudaptnlnct (  rrmxrpou0olt ifeiydfaDel( pnt0 ltnmo3oatfp eluvi;t)s2xrxo io1opeemfci s artruro;o1tptn f3iltfsDrm(monu) rxrif3oatomDr u s t texm(rpny1apenlnetas)s2rau  ;u0apxnioeils s uauvsn()tlxoxrcoy1la   ueo t  eum(mpiydlp  mfeslt aDumxmp;o1tee ii3iytla eanvp;t4 etnxf totopteanei t)teto(m io1am nmfcta( s2rrum oo1alenmfcias s2rlnms t4aetnmfciydlpDeln o;( s2tm(rpiydom  livsls)a2ur(r ;u4alxo ieilt a ua(msn()alxrmf oa1lpte nesls0t2xr(m nydlmee icslt srtmu  no0opeo o3iytfsDul( p t4 etnxrciatom ean olt)srxmir iydamt lnvsat) Dum(m ;o1tpxn o3iyd s ul(mp t0tltoxo ty1oat lu o;t srxo(r3iydal elfeiat  2rmu oou0olt  oeilt s em( o t0texomr tytomteaivol()setmirpoydll n nct ( srrax  ot1alt  f3tat mDelu pnu)arxoxr oytoaD aueils0 2xo(o no4amt  net tfarrmxm nu4opx  feiyd m eln p;t)trerxr3oo1fm  lies;s0 rtrxo oy4omtemictat  2taxmp;o1aptoifeiatfaDrauvs t4aetrxo3iytfp  au i ( trxrxm iu4am nlnctas)s2tr(mpnu1optomoetltlm2rmnvon(0 rtnxf3iadfa ean slt0sexm(mpoydomtnmiciltfa2taxrpnt1aexnmf3iad a2emnmpnt4trerxr totopteaneils setm(r nu1amtelivtlsfs2tr( pnu1tlenmoeilsla2rmn o t4 etoxo iytfmD lieo;s)srtrim3io1openlfvtat srumu  nu0aeto f3tlt m rlnmpn
\ No newline at end of file
@@ -0,0 +1 @@
+ieo (0teur(r3iydlmen ivt t sDtax  nu4optoioetldls2em( s u4arenxocoytfm r u i;s trur(o oo1lpt mivsl()sDum(  nu0tpxnmieiys s2rmu pnu0 exomocoydlateaues (  etm(r oo4alt  ncs () rtauroot1oexniietytla2ea(mo u4 exoif iy1faDrauvi;t0texrir3iy4ol emicias) rrmxmp;u4ope  fctys aDea( p t4altomr3totomtrli i;t  2urxo3iu4ap emneia(  2tr(m ot0oeenmi3iltls rl(mpnu)aexnmo oy1laD livo;s sexoxm3ou1lleelfei s) 2raur no1altomictyd s rmnvs;t0alerxociodfatrai sls0 euo(r3oo1lpt mnesa()srumxrpnt4ole iieiyd s umnvs u) ltnio3oy1lmD  nvilt) rxm(opnudamt lict ()srtrxr oo0tetomfetltls uauvs u)aexrmocoodfatrauvo s) etoim3ny4lmee ivs tfsDtrum ou0alxo i3ias sDraums;(0 rtomocoydfat lueo;t0texo(m3oudam  mneiltf Dua(rpoo1oetnmfetadlm2rl(vo;t0aeenmrctytom  aneols texrxmpoodamt mies s)sDta(rooo1teto f3taslaDrmump;t4 eeomo tatlptr nvo t srum(o3oo4al elfvt tfs2trx  oo1aetnmictldfm2umnvs;(0arenio ty1lmtrlnei t) rxmxo io4lm nlfcsl() Dtru pot0tex  o3ilt aDua(ms ()arxrifciytfa eluei;()texmxm oodamt  nvil(f rum(  no0olxnio3iltfs2um(vp;u4altoifcto1lpDe iei ()s2tmxm3io1lltnlfvs tfaDrmur ou1texo icils aDem(mp t4tlxnif oo1la  auvi;()t2xo(m nu4omtn ncils srta( oou4aeeomieiadlm um(vp t4 ltrmfciydlat luvols)texrio3nu4lltnmfeta() 2uaxmp;o0ape mieils aDeaump u)trtoxf ia1omDeaueolt tetoir nudam   netat  Dtaur ot4opxniictlt m2elnvo;(0aexomo3oodlmt anei;s0t2xrim iu1aptemiesl() rtrur ou4oetomi3ildfa2uaump t4treoir iodomtrliei;t)setmir iodll  mnci t sDrrx pno0oee ifeilsls2rauvs;() rtoxo3tatomt  uvi t0trtr(o3iodllenmfvtl( sDrmxmont4tltoifciadls umnmp u4trxrmfcoatlmt li o;(0t2xo(r oo1ll nlies s a2raurpot1tex iociat a rauvp;u0 ltnifctydfat luvols)s2xrxr3iy1lmtelivi s aDtrumo;u4tlxnmietatfaDemn onu4altomrcto1omDrauvsls  2xoir3nydomtemivilsf Duaurpoo0ole ifciaslmDra(vp;u4texrxf3iytlpDrauesl()sexm(r nu4alee nvtat) rtmump;t0tpenifciatfsDelu pn(4altnir3iotlp   ivi;s)trxo(m3nydom nlfvil( arrrurono1oee iiciydlaDrauvpn() reoif oydfmt  u s;t) eurxo3no4ap e nvs s srrr(ront0tltoii3tadfa2emump;(4texnxf oy1omtr u sls trur(m3oodam  mnetas)srurumpoo1opt moeils m rm(msnt) ltoxrcoo1opt  ivo s0t2umxm oydolt  ieiasf Dumxrp;u1aeeoif3ils sDelnvo u)trerxr ootlpt  ies t  eur(r3nodolt  ieia(faDtau ont4teeoiieiydlm2uaump;t0tltoircoa1lmDranvilt0srumxrpoodlpt mies s)arumxrpnu1tlxnifeiytla ea(vo t4 lenxrcta1la r ueo s0srtr(m ou4lpte nvta() 2uaxroot1optn ocias sDumn pnu0 exoir iadomtr i olt)trxmxr oo4open neslsf rtm( pnt1altoio3tlsfa2um(vp u4teenmrcootfat  nvi s s2toim oy1omeemics s)srra(r oo4apenif3iltfs2umuvo u4alxnxf iatoatrlieilt seur(m oo4omeelfvslt srrmu poo4apenmociytlaDumumonu)arermr3iytla e u i s trxmir ou4ap elici tf Dtmxm ot0aeeomoeiadla2uan s u) etrmo3to1fpt an ilt0 2xmim3nudlp  lici () 2tr(rp;t4teeo iciys s2ulump u)tetnmrcootfpDrlivsls texoxo oudape  ieias  rrm(mpno4tltomo3iydfmDua( s;u0tlenmo3ootlpt au s t0s2xmim oo4lme mnei (faDur(r ;u4aeeomi3tys sDuan p;u)aexnxr to1oaD  u ols)s2tmimpiy4lpen nct t  rumu p;u1opxnmoetas sDul(vo t)arxriociytfmte iei;s0t2uoxr ny4omeemfes sf Duru pot4optomoetldfa2um( pnt0tlenifcto1fmD livo;(  2xmxrpnu4lp  lnct () rtaum ;o4oetnmiciytfmDuau p u)aexrif tytopt  ueils0srxoxm3nydlpte fciatfsDtau  ot4oeeomfeiatfsDuauvont) lxnmfctatlp eln ols s2tmxm3iudol e iciat)a2ta(mont1opeomocils aDrau s u) etrxfcty1fmDeaueo;s  rxoxm nudlmt  ivilt)a2rr(mp;o4olx ifciltfmDum(mont4tetnxr3oytlpteaieo s0 etr(rpoo4lmt  fet ( sDtrxr ;u4ape mo3tadfm rm(mp ()trenircio1faDrlu s;s srtoimpny4ap elivt sf 2uax  nt0alx ifcilslsDeanmp;u0 etoif3oodlm   iei s)seumir ou4ll nlicslsfarum(  ;u4apt ifciytlaDranvs;t0 eenir ta1fpt auei;s0t2umio ny1ame  ncsl()arta(ront0tleoiiciltla2eluvpn() eeomr3iy1opDe i sls) rur(o oy4lpeelfctlsfsDtr(  ;u0alxoio3tadlaDul(mo;u4 rxrmr tytfpDraivslt0 eur(r3oy1ap e iei s)sDtmu pno0aeeo i3iad a2elumo t0alxoxr iodfate ieils0sexm(r3nu1alee ivslsf rtrxroou1tptnii3ilt a emumo;(0tlerio oytfa raivs ()teuoxmpiudll  mfeil() Dum(m ;o4optomoeias a2rmnmp;u4tltrmfctatfm  lueslt0trto(m3iu1amt mfei t) 2raurpoo0aptn f3iydfs2ea(mon()aeeoir3iydfa   iei (0seuoiopnudaltnmicsa(fsrtmur nu1openioeild sDulu s (4arerio3oatlaD luvo;t0truoim iudop elfvil(farraxm ;o0tptnif3tldfsDeanvonu)arxrmociotom  auei;s0t2umio3no4omtelivs t)a2rrumont1aex iiciysla um(vo t)alxrxocoydoa ranei;s tetrim3iy4alenmivi s) Dumxro;t1aex moctasls2el( p (0aeeomf oo1oa  anvo;(  rum(rpnudllenmnci tfarumum no1aeenmfctasfa ranmp u0trxoiocta1lmDr ies (0srxmxr3nydomtelnciat)srumxmpou0tlx  oeiyd a2ea(vo (4trxrmr iodfmtrlneil(0trxrxr3oy1olenmncils) Dumurp;u4oltnmociysfsDemnms;t) etomfciadoa elueils0srxr(o nydlle miei t srrr( ont0oex ifeiysfs2ra(mp t) lxrif ty1op eaneo;s texoxm3oo1aptn fciatfsrua(r nt4aexn feilsfmDeau sn(4artoifctadfmDean sl( seur(m ny4ole  fcsl()sDtrxrpot0tlen ietatfm ea(ms u)alenmo3iodfptrau s ()s2trim3iydllt mnct (faDuaxm no0tpto feiysls2ua(mp;() ltrxf ty1faDelnesls)texrxm nu1ale liet t  2rrurp;u0apto oeilsfm2uln o;(4teerxoctytfpD auvo t t2toxm3oodope mici (  ruaxrpou0olxnmi3tas a2um( o u4arenio oodlmtrlu ol(0sexoxrpoodope  fcil(fa2ur(rpoo0tpx  f3tydfaDea( s ()trenmo3ta1fp r n ol(0 exo(m3oodlptemictl(faDrmu pnt0texomoeias sDranmo;t0trtrxo3to1op e nvsl(0sexrxrpiy1al  lfeta()s2um(rpnu4opxo octyd m2elnvsnt0 lxoxf3oydlmtran i;t)srto(opou1lm elieils)s2rru  ou0aee ifeiydfa2umuvo;t) reoir oo1fpDr i i;()sexo(rpoodopt mneils)s2uaump;t0olt mfeiltfaDra( o;u4tetomrcta1fpt  i s t0trxrxmpnodlmt lncsls  2uaump;u4altniocilsfaDean pnt0artrxf ia1lp  lues t)texmio3iy1lmt lfesls  Dum(  ;t0tpx ii3iasfs2ua( o t) rtnir3ty1omt anvs ( setoxo3nu1lpt livsls s2tm(root1tle mo3tytfa2eanvon(0 rtnxf3iotfmDr nvo ()t2tm(opnudlm  lfeiat)sDrr(mont4oetnmfeildfaDul( o;(4 lxoxf oodfpD livols)sexrim iu1amt lfcsat sDum(rp;o4aexo i3iys m2em(mp t4 rxoxfcoodfm   ueslt srxmxr no4om elies t)a2tru ont1tex  oeiasls el( onu4teenmf3oydlaD  i s t)sruoxr3iodolee ivil( srrru poo0oltn feiytla2ran pnt0tetomr oadfpte n o s)truoxo3no1olt livilsfs2ta(mp;o1oltn i3ild mDelnms u0areoif iodfa e neo t0trxoim3iodamtn nesl(  Dumumo;t1opxniiciysls2em(vs u0arxnmociydom ranvo s  etm(rpoydlle lnes (f rumxrpoo0oleoifetasfs em( on(4treomf iadlp elu s;(0trur(m oy1ll nlfvi tfartmx pnt1oeenmo3iltlsDrau p;()aeeoxo3oa1lateanvilt  2tm(o oudlmt  fcia( a2trurpot4texnmfeiytfs2emuvo;u) lxnmf3oo1fa eanes (  rxrimpoodapeemics s  Dua( pnt1opxnmictydlaDrm( s u)aetrmf3oodlpD auesls)seumir3iydop n ici (f Dua(mont0oetn o3tadlaDulnvs;t)tetnio io1lpteauesls srtr(r3io4openlfesltfa2umum oo4altomo3iadfm rmumo u)aetrxocoydfmD aueils trxr(m oo1al  lnesa(f 2tmumpot0opeo feiydls umnvp;u)texoif3tatomtr uvo;()s2xmimpio1altnlnesls) Dta(rpoo0apenio3iyslaDeanmp;u0 renif iytlmDelu o t0teumxr nu4op n fvta() rraum no4ape  i3iys s umn pn(0trtnxr ia1la eauvs ()t2umxopnodaptelnetlsf 2taumo;u1opxnio3tasfm2rluvsnu4 lxomo3tatomDelues s0sexm(r3oy4lptn iviasfsDtrxr no0tee iociadfsDra( s (4 renmrciotlpDrlneo (  2toimpnudlp nlivsls s2ta(rpnu0tleo f3iat s elu ont)areomo3oo1fateli i t) 2xoio io4op elies t  rtaumpoo4aleniietatfa rl(ms;u0trtrio totomDrlueolt) rtoim3iudop emietlsfsDtm(  no1aexomf3iyslsDuaump u0 renif ta1fpteluvo;s seurxopoy4lmt miviasfsrrax ono1aex if3tyt s ea(vpnt)altnir3iodopt lnvi;s)t2toir oudopee nei tf rtrurp;t0texnifctltfm em( o;()arxnifctadfp rln i;() rur(m oy4omenmivil(fsrrmumpnt1opx  f3ildfs rau s (0 lenio3iatlmDe uvo;(0srumxo3iy4lmt lnctlt) 2umuronu1tex moeilsfsDumnvo;t4tlxomr3tytfa eaneilt0 2uoio iy4llt lfcsas) rtmum ;u4tptn ictltfsDrluvon(4 exoif iytfmtrai i;t)setmxo3nodaltnmfes t sDra(moou1tltnmf3tasfm2uanms;(4artomf3oy1oa  lies (0 2xm(o3nu4aptelfcsasfarua(m ;o4apx mfctyt s2raump;(0arxrir3iadom   uvs s  rxoimpoudll n fes s sDur(m ;u4opxnioetatls emnvs;t4tlxoxocoydlpDe ues;(0 rtrimpiu4apt  ict sfsrrru ooo4opt mo3tlslaDeau p u4 lenxr3ta1om   nvol(0 rum(m oydlm   iesas aDrau pno4tlxnmo3taslsDumn p t4tetoxr oadfpDeai i;( truoxr3oydlp nmivtls  rumxrpno1olen f3ilslm2rmnms;u)arxrxr3io1fa eluvi;s)s2tmir oudam  lfes (faDumur ou4tpxn ieiaslmDemnvo ()tlermr iytfp  lueilt0s2urir ny1lp emfei tfsrum(rpno1olt iietlt s2uauvs u)trxrmrcoytoptean s ()t2trim oudap emneta()a2rmuro;t1aeenif3iyt aDumnvo (4tlxnxf3ia1laD li s;t)t2urxrpnu1al  mfesls)s2rr(r ;t4tetomoeiydlm2uln p;u0aeerio oydopDrluvo;()setm(r3iy1aleelnvtat)s2umu  ;u0tptnmo3ild mDel(mo t4arxomfcoo1latr neolt0trto(m oy1ale  ivsatfaDum(rp;o4oltnmf3tldlmDuanvpnt0 leomo io1omDeln o t)texmxrpnu1op nmietltf 2rax pot0altnioeildfm2uanvp u4tlxomo3ootfptelu o t)srxrir nodaltelivi t)srrrur ;o4aleoifetys sDeluvp;t)teeomo todfmDeanes s)srum(o nydolenmicsa(fa2rr( pnt1aeeo oetadls2em( p;(4 etnmo iotlmD auvi (  rtoio nu4apee feils s2tr(  ot0ale mociytla uan o u)teeoxrcia1oat lneo;s0seurim nu1lle  nvtas)sDta(mp;t1tlx iietls mDranvon(4trenxf iy1opD  uei;() 2urio3io1llee fviatfa2rm(m oo0olt iiciatfmDuluvs;t) rtrmo3ia1opD  nvs;s)srumirpoodll nmnvia()s2urx p;o4aetomfeildfa2rln pnu0 lerir tydlm  ln i s0t2tm(opnodlmee iesa(fsrtr(r ot1tex ii3iatla rln p;u4artoio3todlm raivolt setrxr iy4olt lfeslt arrm( oot4tex if3tltls2el(mo t0alxoxocoadoa rau slt srxrirpou4opt  nct s  rraur ;t1aexnmo3iatlaDua( p;t) leoir3iydlptr u sls)t2ur(o ny1oltnmivias)artm(mooo1apto o3iaslaDrl(mpnu)arerio3iatfmDeli i;()trum(mpno1lmeelfctl()a2tauro;o4oet  ociadfm ua( p (4trxoifctadfp r ies () rum(r3io4ale lfcsa(fsDrrxroou0opt moeiytlmDelnmo;(0aetrxocoy1optrlneol( t2xm(rpiy4altelfvi ( s2urx oou0open iciydlmDrmn p;() etomo iydlateaies;t)t2urxo3iu1aptn ivsl( sDurxro;u4tpenifciat a rmn o u4trtoxf oytoatrlu ilt0 etm(o nu1om nlnvs t) rum(r ;u1tlt ioeiat m2uauvp;()alerifcootlaDeauvols) rxrim iy1ame lnetas aDrax pot1aetoiiciadls ulnmp;u0 renmfcoatlpteanei s) exrxrpoydopt mfctlt)sDrr(moot0oltnifciatls emu o;t) exrifcty1omt ln s s setm(m3oydamen icia()aDrrxr no1optn oeiatlmDuau o u4aetomr tatlp r uvils)t2uoirpnudlp nlfvta(fa2urxm oo0aptn ieiasfsDumnmo (4tltrxo iydfptean i t  euoiopnu4om e ivi t s2tmxmoou1apeoiociys s2umuvsn(4 exrmf3iodlmt lieo t  2tm(mpnudolenlneils sDuax o;u1opxnioeiyslm ea( p;t0tlxrir totfat lu i;(0 etrxr no1lltnlnesatfaDrmxmpoo1tpxoiieiydfa2rlu s (4tetomf iodlpD anvo;() 2xr(r nu4lp  lfesa(fsrtr(m no1teeo oeiys s um(vs;u0 exnxf3tatfp rlnvs s) etm(o no1lptelfcils) 2tm(m ;t4oexn iciydlaDumuvo u0alxomfcoy1fpD li ols)srto(o3ny1optnmnct s)s2tm(rooo1apxn fetltls eaumpn()areoir iatlpD  u sls  exmirpoodoltelfvtlt sDuaurooo1tetomoetltfaDrmnms;(0tlxnxf3ia1om  au sl(0t2urirpiydlp nmnvt t s2rmxr no4alxoioeiadfm2elumo;(0tltrmr oatfpteluvi s)teuoxo3oy4omeelnes tfa2urx pot1apxnmoeilsla eluvs;t)tlenxociydfpD  ueo;(0 exoxm iu4am nmietl( aDrax ont4tpto ieiys aDua(mo;u0 rxnifcta1oaD an o;s0trtoxr iydale  ictat s2tr(mpou1opx mieiyd s2rmn s u0aeermf3io1lm rlivo t0t2xo(m nudoltelivtltfa2rrxm nu0opto oeilsla2rau o ()tetrxociotlm rauvs;s0srto(r iy4olenlnvsls sDrax o;u1apxoifciydlm ul(mon(4alxrir3ia1omt lnvilt) 2tm(m3nu4apt mnciltfsDur(rpoo1aeto fctlslsDraums t4 rxomociodom r u sls  eumim ou4ap nlfvi (fs2ra(  ;t0aex ii3iat a um(mp (4artoif3io1om eaiesls sexmxr io4lmt  nes (farua(m ot4tpt mictldlaDrl(vs u)aeermrciodfmDr u ils)trurxr oudopenmfvsa()s2um(  oo4oeenmo3ildfm rl(vpnu) rtniociodomtelivi ( srxrxopnu1amtemnesasf 2trxr ;o1tlx  oeiysfa rlums ()alenxf3iy1fat lneo;t)trtm(mpio4ome mnet tfs2tm(m ;u0texnmo3tas m rlnvs;t4tetoif ootop raiesl(0tetmxopno4oltnmieia(fsrrr( ont4oleo ieiys m2rm( o () rtrir oo1op  aueslt)sexrir nydopt  nesl(  2taumpno4ope mfciys s rm(ms t)aexoxo3io1omtrlues;(0trtm(o oo1alen ivs t artm(rpno0oeeomo3tadlaDelnvo;u)tltnir oatfaD anesl( srxoxmpnudamt mici t s2rau  nu4tpeoioeias m2rln pnu) rtnir iydfm r neo;(  2uoxo nudalt miesl(  rrmuront0tpx iicilsfm raumont0 lenmr3oydla elivs t  2xoxo3iy1alenmivtls)aDraxront0apen i3tls aDrlnvo;t0tlenmo tadom r iei;s t2xm(m3iy4lmtnmfeilt) Dtmxm nu0oetoifeiatfs ulumo u0tlenmf3iotlmtr ivols)texm(r3oy4apte fcilsfsDtrx pno0optnioctytfs2umnmp;u0teerxo iadlp rau i t tetoio3ou4lpeeliviat  2tm( pno1opxomf3iat m raumont4tlxomo tadlptrluvo s) eurim3iudame mies t  rtax  ;o1tltnio3tasls ranmsnu)areomr todfpDranvs ()s2urxopnydllen nctl()srrrum nu4oexnmf3tas mDrmuvs;u)trtrmf3iy1fmte uvo;s  etoim3iydaleelicsas) rtr(  oo0tlto feiadla uanmsnu)aeeoif3to1fm ean s s) 2xmiopno1amt lieias)sDrrxm ;o1apxoio3tadfmDul(ms (4trxnxoctotfpD lu slt0s2trxo io4al   nvs ()aDrrur no0aleoiictls mDrl( onu0alxoio3ia1fmDeaivi ( trxrio3nu1lptelneia(  rtrx onu1alxnio3tysls2rlnvo u)aexrif ta1op ean i;(  rumio3oodlltelics tfa2rmx ont4tpx mfeiatfa ulnvon(4 exrxocoytfa r ivo t)texo(opoy1ap elfcsltfsrtrxrp;o1oee io3iltla2rl(vpnt4tlerxrcoodomteluvs () rxm(o oy1apenliet s sDrr(m ot4aexniiciat m um(vo;(4 renxf3totomt  iei;()t2uoir ou4lptelncslt) 2um(mono0oee  o3iasls2elnms;t4 lxrio3oo1fp ean s (  2umxr iu1op emicsls  2raxr ou4apeomictldfs el( s u0tlenxfcoatfat  uvs;s0s2tmxo3oodoptnmiesa()aDrru  ;o1tlxn fciadfa2ranmont4 leoirciatfptrln s (0teto(opiydlme mfcil() rtaxr ;t1olx mfetys m2eau o;()aeerxo3iy1fa eaivs s)srxoxo oy4op emncslsfa2raumpnu1alxn ociyslmDelnms;(4 rxnxociodomD au i t srtm(o3io1apt lnci (fsDtrurpoo4apen oetatlsDemu o (4trenir3tydfat  iei s t2xmxr ou4apt  nei ()sDtau pno0tetn fctadlaDulumpn(0teermr3oadlmDean slt0 rtrxrpoydomte fvs tf rtax oot4alt io3iadfm2uanmo u4 etoir ia1fmDeaiei t s2urxopoo4oltelncsatfaDtrur nu0alx mf3iltlm2el(vp t)trxrmr oo1fm eli il(  rtoim oy4amt lics s)a2tmu  nt1oleomociad m2eaumsn(4aetnio3ootom eaivo t)tetmxmpiu4omtnlnvsa() 2tm(rpnt0tptnmfciyt a2rauvont)altoxfcoodfmDranvi;s) 2trir iy1ll nliesasf rtrumpnu0apx mocilsfm uaumsnt0arermr3tytlmDraneolt) rtoim io1omen fvsasfsrrax  ou4tlen ietldfm2rlnvo t0aetoirctadfpD lnei;() rto(r iodameelicsl(faDtruro;u1apx  i3tadla elu on(0tlerxoctydfaDrlneol(0s2tm(r nodom e fvtl( a2raxmpno4olto o3iyslaDul(mo;u0arxrmf iadlp   n sls0trxrxopiu1llee iviat s2rax o;t4teeoioetysls2rmn o ()artrircootfaD anvols)seuoxm ou4optn fct (faDtru pou0altnmfetyslm el( o t4trtrxf3iotopD  n ils)srxmio oydapeelnctls)aDur( o;t0opxniociltfa elumpnu4arenmrciy1optr nei;s0 eumim3iudoptn ncil()arrmu onu4tetnii3tat s el(msn(4trtrxo3iodfa r ueo s  rxr(o oo1lm emicsl()arrmxrp;u1tltnmieiytfs um(vo (0tlxrmr3oydfa eaueol() 2xrxr3oo1amte neilt aDrm( p;u1alx iiciat a2ul(vsn()artrmrcty1faDeauvo;() exrim3iydlmt livi t artmum ;u0ape mfciadls rmnmsnu) eerxr io1op rlnvslt)truoimpnu1lmen iesat)a2rax o;t0opeo o3tldlm ulnvo u)tlxnmo iatfmDean ols0s2urxo ny4om  mncil( sDtau ono1oetomo3tldfm2ua(vs (4 exoxr iatomDeln o s s2ur(r ny4amt  nvsa() rumum ot1alxoiicias m2raumo;t4trermociydfpD  uvs ( srxmxmpio1ome mnvt s)srurxr oo4opxnmiciyt sDel(vp;t0tetrmf io1fpte i o;( s2xoxr3iy1omt mnvias)s2tm(m nt4oltomfciydlaDuauvont0 rxnmo iotlatrln o;s  rtr(o3nu4ol n iesa(f 2taumoot4aptnmoetytfa umnvpnu4arermf iatlatr neils) ruoxr3nudll n net t) rrmuront1tptn o3iasfa ua( pnt0aexoio oydoa ranesls s2xoxm3nu4lleelieslt a2urx  ;t0altomiciltfs2rm( p;u4tlxrxf iatom r n slt)trum(mpoo4am e fvias) Dta( p;t0altomociad m2rln s;t4 ltnmf3ootlmtelu sls) 2uoxrpoodomtn fvt (fsDurxr ou0tee mfciadlm2ra(mont) exoif ia1oa e nvs t truo(o3oo1ome miciasfsrrrxro;t1tle mocildfm2ran pnu0 lxrxf tytomteaivolt)sexmimpio1am e ieslsfaDrr(r nu0apeo ietltla raumsnt)aexrio tytlpDrauvil()srxoxmpoydope lies s) 2umum nu1tlenioeild m2uau s;t0 exnmo3to1lm  lueol(0t2umir io1lpen fcs s  rur(m no4tpxomi3ildfa2ulumpn(4aeeoxr oydopteaneo t)s2ur(o3nodopeelnes s a2raurp;o4apxn o3iysfa uanmo t4aexrmr3oatopteaies () 2trxr iy4ll  mfvt () Drm(r oo1tlx  oeiatfs rmn s;t0tltrmocty1fp  anvslt0s2trim no1omt  fct ()a2tauro;u1aptniietat aDuln on(4arxnxrctodoaDrlu o;s truo(r nu4aptelivi s) Draurp;t0tptn ieiyd a um(msn(4arermf3tatoptraues;s0srumxmpoo4amtemnvs s)sDra(m ;t0oee iiciatfmDum( snt0trerxocoo1optrluvol(  etmim iu1lpe lnviat) 2trxrooo4apx iieiasfaDranvs t4 lenxr3oo1la  anes;t  eur(o ou4op  lnvta(fs2uau pno0alxomi3tatfa ua(vpnt0aeermr3tytoptrlivolt0setm(m3oo4om eliviltfsrrmxm ;t0aeenii3iadlaDrlnmonu4 rxomrciodom  ai s t0 eumirpnodalte fcils s2ur(ro;t0oeen feiasfmDraums t)teerxr iodfat livo (  eurim io1apen ncs s sDtmur ou4opxnio3tls m2ranvpnt)aetomf iadop   neils s2ur(r3ny1lme  icia( s2tauro;t4apenmfeilt a rm(mo t4aexoirciydopt au i s0sexrim3ny4op nlicslsfa2uax pot4tlt iociydfmDrlu ont0aexoxfcoodlmD li o (0trtm(m3ny1ale  neia( sDuru  ot1tlx  f3tyd aDrmnvo;t4texoxr3oatfmt auei;t0setrim3nu4lmte netas  2trxrp;o0oexnmoeildlmDrmnmpnt)alxrmr3oy1oa  anvol( t2tr(r3nodlm emfcta( sDuax oou0olxoiieiytls el( p (4altoifciydomDelu sl() etrxmpiu4op   ivta()arrm(rpnt4teeoii3iytla eanmsnt)alerxf3tytlm ranvs;s0 2to(mpoy4ale  ivt sfsrrax onu4apxo f3tltfs rmu s u4 leomrctydomt  nei;t  rxrxr iy4lptn nct s)srrrx ono4aexnii3iyd m2rluvs u)alxnxfcoadom r nvils)trum(mpoy1op   fcil() rrmu ono0oet mfeiat a ul(ms;t) rxnmf tadla   ieo;s  2ur(r io1op n ivt () ruax  ou1texnmietytfa ean o;t) rtnmr3iy1lptrau i s) rxmiopoodol   ncs t)srtm(mpou0altnifeiatfm2el(vs;u) rxomf oa1opt an o s0 2urirpiydam n ies ( aDua( onu0teenmi3iad m ea(vs t4areoxrcoytfmtr ieo;t)seumir3ny4oltnmfes tfaDuau poo1tetnmfeiadla2el(mp;()alermfctatlpD  ueil(0truoiopiu1ol  mnet s artr(roou0apeoifciaslm em(mpn(4areomf3iadfmDelues;s seum(opoy4opt lnes t s2rr(r ;o1tlt moetasla2rmu sn(4aleoxf3iotlatelivi;s)seumio io4lpeemfvt (fs2ta(r ;t1aee  ictytfs emnms;()texrir ia1lm eanes;(0 euo(rpoy4altnlnes t srrr(m ou0tet iicildlm uan s u4tlermr iydlpt  n o t0t2xm(m3nudlmte ietltfsDumxro;u4opxomi3tls s em(mp;t)altnmf iatop raneo s0s2toiopiy1lmtnmnvs t)s2ta( p;u1tet ii3iydlaDeln snu0teenmrciotop rli ilt tetm(r3oudomt  iei t arurxrp;u4aex  octydlaDemumo ()aeenmo3totlp  lu s ()s2tr(r3oudlp emicils) Dtmxr ;o0ale ifeiad mDra(vp;t)tlenif3iadomt aueo (0s2xoir nydomtnmietl( aDra(mpnt0apen i3iyslm2elu p;t0tlenxrctadom rai slt)s2xrim3no1apte feiat)a2uau o;o4aetomfctldfm2ea(ms;t4teerif3iytfmDr ivi s0trtr(m nu4lpeelfctls)arur( poo1alt  ieilslm ea(vs t4tlxrxf3iotlmD lues s)srtoxm io4ol   ncsa(f rua(mont0oeeomf3iyd aDrmu on(4trxoif iodlmDrai i t)srxmxopnudap  mivia(  Drm(mpou0oeeomocild a2um(vp;t0 lerxr3oy1fmDe ivi;(0 eur(o iy1open ivs s)sDrrxr nt0aeeo oeildls emnmo;t4 eeoxrciatomteauvils)t2uoirpoudoltn iesls)sDtr(rpnu1opt mi3iys m2eluvo (4 etnxf3iodfmD aieo;() 2xm(o iy1omenmfcsas) Dur(mont0texo o3iydfm2emn p u4trerif oytopte ivo s0 2xo(r3iydlp  mnvs t arrauront1tlxoifeiyd mDumu s;u0trtnif tatfpDrauvo t)s2toxo iudoltelnciat srrrx oou0oeenmf3tls s2ra(ms t4tetoxfcty1oateau ols0seum(o iudameemivt (  2tr( pnu1alx ifetlslaDraumo;()trtnxf3ia1fmtr nvi s)srxo(r3oy1lptelivsl(fs2umxr no1altoiicilt s ul( s t)tlxoxf to1om rau ils trxmim3iy1om   nci t a2tm(m oo4tlxn f3tyd mDemnmo () renxf iadlatraivo (0trxm(rpoo1om elnes sfs2rau p;t4oltn octatfm ran s;(0tlxnxr ta1oaDranvi;t srtmirpiydol   nvt sfsDtr(rooo4texn feils m umnmo;u) ltnmo3iy1op ranes t0setrim iy4ol  mfciat)srra(  ot1tlenmfctyt aDem(vont4 lxoxr todoat ln s s trtrir3nu4aptn fcslsfartm( onu4apt iictadlmDulump;(4altnxo todlm ranvilt srxrim3oudole  iviatfaDuaxr ;t1altomfcilt s2uau s t)tltrif tadfmDrlneils seur(opiu1lpe mfcias)artr(monu0tpxn fetlsfaDum(monu)aetrmf iotom  auvi s0tetm(o ny1ole mfvsas s2rmu onu4altoiieiadfs rmnms u4aetnxf3iotfaD ai il(  ruo(o3iydol nmfvsa(fsDtm(  ;t1olxnmoctydlmDean s (4texrio3to1om e ues s0trurxm oydomt  ivs s)s2ta(  oo0oeto feiat a emu p;()trtnmrciodfmDeln s;s0s2umxrpoy4amee fci s a2raxrpot0tetn icildla rmu s;t0trenio oa1fpt aivi t) exr(opny4lm  mncsa(fsrur(ro;t1alx mfeiys m2um(ms;t4 lerir3tatopDr i s;s srxmxmpno4lme lnvtlt aDraump;o0aptomo3ilt s2ranvpn(0tlxrir oo1late ivsls0texoxopou1llee fctas)a2trx poo4aleo i3tad aDrl(mp;u) eenmocoodomDelivslt)srumirpny1lpte netasfs2umx ont4tetomieiytlsDranvp;(4altoircoadfpt an s t)setr(m oodop e nvtls)aDraumpou0tle iictydla rl(vs t0 ltnmfciy1lpD  nvo s)trtr(opno4am elfvta(fsrtrur nu1oltnmf3iysla2uln p t0trermo3tatoa rluvi;( teurxopoy1apeemivils sDtaum ;t4alxoioeiadfs2ul(ms;t)tltoxf3oatfm rauvolt  etr(mpio1apt lies t)a2um( o;u1oltnifeils aDem(vs t0trxoxo io1oaDelies s0sexrxr3oo4al e fvi t s2tm(r ;t0apen o3iasfa rluvsn(0 rxnirciatoa  an i s)s2ur(o oy4lptnlneilt)sDtr(  no4oex if3tydlmDrl(mp;u) ltoxo3oy1lmt ai ols) 2umim oydoltnlnvia(f rta(mo;t4alx mi3tysfmDuanmpn() eeoir tydoatrlnvs t t2uo(r nu4om elnci ( srururpnu0olxnmo3ias s2uanvo;(0tetoif3ootom   i slt  2xrxmpno1ll n ivtat) Dtr( ono4tpenmocilt m ulnmsn()artomr3io1oa   u s s)s2xrxr3no1omen fet s) rum(rpno1alx  ieiydlaDumump;u4 exnxocia1faDr nes;s t2toim oo4op nmfctlt s2raumono4tlx if3tys m uan s;u4trxnxf oa1laDe u s (0t2urimpou1omtn ncsa( a2tm( onu1opeomfciytls ul( s;t)teermo oodoaDeluvs s)trxr(rpou4lmee fvias a2uau poo1texn feiysfa uaums;t0 ltrir to1fmteai i;t0s2tm(m3iy1ome mncta(  2rm( p;u4tlto o3tltfsDuau s;u) etriocoo1fa raies;t s2um(rpoo4om nmfvsa(  ruru p;o4tlxnmfetat s elump (0 leoxr3iodlaDelnes;t0srtr(m3oudopt  ncslsfsrtau pot0open octat s2ean onu) lerxr oydlpDeau s s0trum(o ny1alt  fcils)sDurum ;o1apen i3iadls2eaumont0 etnmfcoa1lm r nvi;t) 2tmim nydll emicta()a2uaur nt1tetomoeias sDrl(vs;(0texrxrcoytomDe n o t0srxrio3oy4altnmnvt (fsrrrurpou1apeo i3iat sDrmu ont4 lenio3ta1fpte nvs ( seuriopny1apt  nvil( srumum oo4apenmietlslaDul( p;(0artrmr iy1fmteaivs;t s2xr(o nydapenlfctas)srumxr nu4tpenifeiyd mDeanmont)arxrio iytfmD aues;( s2tr(r3iy1llenmnvt s)s2umum ;o1oee moeiys a elumpnt0aexnxo ty1lpt  ivo;( s2umxopny4lmtn iet t)a2rr(mooo4oeeniiciyt mDrmu o;(4 rtrmo oadfp rlivs t0seuo(rpoo1oltelict tfa2rrurono0tpeo ociysfaDumump t) rxrmo iy1fmDr nvo s0 2xoir nydlltemnci s arrr(rono0optniieiadfa umumsn()tetrir tytoptrlu o t t2xoir iudlp elncslt sDrax  no4aeeo i3tys m rmn o;u)trtrifcty1lpDrlnei;s)texrimpiu1apeelietlt s2ta(ro;u0opx mi3iydlaDrlumpn(0artnxfcootoaDrauvi;t)s2toirpiu4om nlfesat arrr( poo1ape miciytfs2rlnmsnt0aleoxo iatfat lnvo;() 2tmxm3oudllenlnetas srrrxm ;t4alx  i3tasfs ranmp;(0alxrir iatom eaivs t0 rur(o oydalen fvsatf Drax  ;t1tpt moetltla2rm( s;t0 rermf3iatlptr n o ( srxoirpiy1ole lnvtltfs2ta(r nt0ole mieiltls2eaums t0aetnxfciytopt livo;() rxmxo oy4ap n fcsasf ruau poo4oex ioetasla ra(mont0 ltnir oadfpD lies s  exr(rpny1altelnesas sDrmu p;o4tptoif3tydls el(vp;t4tltomr ootlptean s t0t2xoxrpno4omeemnci ()srtrxm nu0oexnif3ilt a2uan on(0tleomfctydfmDr ieo;(0 eumiopoydamt mnviatfsDuaump;t4olto o3iydfsDean o t4 exnio3oodoa e uvils srtrir3no4alt mnetl( srtax o;o1teeomo3ild sDemums;(
\ No newline at end of file
@@ -0,0 +1 @@
+i o t0trxmirpno4opt lfvtlsfarur(mo;t1opxnioeiytfmDul( s;t0texrio3oodlmtr nvi;()seumxm3io4oleelicta()a2ururoou1aee io3ilsfaDelu p t) exrxf3tytomD lueils) rxr(mpny4altn nvtl( aDtmumpoo4apt io3iad mDranms;t0 eeoif ootlp ranvi;t trxoim3io1lp n ivi s)a2tru  oo1apen iciadfs2rmn p u)altnio totlpt luvs t0 exmxo nudop nmfesls) Dtaxm nu0teeo o3iad a emnmo;() etrifctatopDean o t s2uoxm3iodap emieta(fsrta(mo;t0alx moeiyd a uan p (0tltrir3oytop e i ol()tetrir3nu4lle  ieil()sDrru  ;t1teto ictlt m2ea(vo;t0aexnmo oydlatrai o;t) exrirpiy1lme lnetas) Dtmu pot0apenif3iltfa2elums u) rtomocoadfa e n i t) euo(o3nu1oltn net s) 2rm(r ;t4tlt mietysfm uanvsn(0artoxocty1omDeanvo s0s2umxo nu1lmtelnetlt a2tr(  no4tex mictyd m2ulnms;t4 rtnifctadoat livo t) eur(o3nu1ope mfvias) Dtr(r nt0tex  oeiysfs elnms t)aeeoiocto1lmDrln sl(0 2urxmpiu1ope licias) 2rrurpou4optn o3tysls2ulu p () lerir oy1fmDraueo () exoiopnudlm  liciat  rur( oot0apx mi3iyslm2rmumo () lxnxr3oodomDeauvs ( srtr(o3io4llt  fcias  rrrumpoo1altnmfeiad a2rmn pnu4alerxrcoodlpD  ieils t2xoxr3iydol nmnesat)srrau o;o4optnmf3iasfm ulnvsn(4altnxocoy1oat  iei s) rxr(r3ny4am n ictl(  Draxmo;o4olto fcilsls2em(mont)trtomo iy1oat ln o t  exmir3ny4lmte netlt) ruax o;u1olx mf3ildfsDraump u4tlxomf oydlatr iei t0teuo(rpoo1llenmfciat  rra(r ;o4aet io3tydls2rlums;(4aeenif3ta1fptr u i t) 2tm(r oudlp  lnet sfa2ta(mo;t4alenio3tyd sDum(ms t4tltnmr ta1omDe u o;s) eumxo iu4lle lfeia() rurxrpoo0tpxn ociltfa ranmo u) etnmfcoa1oaDeluvi t sexr(r3iudol  mnct ()a2uru oot4aeeniictyslm2emu p t4arenmr to1lp rau s t) 2xmir3iu1am  mietas)a2raxrpoo1alxnmo3ilt s2rl( p u)texoxf3iatfmDeaneo ( texo(o3iy4ll   fvtl(fs2rrxro;t0tlxn i3iys s2rau pn(0alxnif3oytfp  lu s s0 2xrir3ny4oleelnctat) Dua( p;o0opxomoetldla ua(msn(4 eeoxocoodlm  anvs;(0s2xm(r io1alte iviasf 2rrx  no0tltnifctydla rluvo () rermf3oy1fmDr neo t0srxr(rpnu4am elfesat  Drmu  nt4texn f3iltfs2ea( o u4 leomr todomt  nvo s0 ruoxm3oo4alte iviasfs2tau o;t1apx  oeiasfm2rlu p;u4trermr3iodoaDeanvi;s)trtoxo3ny4om e netl(fs2ta(r ou1tpto oeiyd a2rau p u0tlenmo3tydoatr ivs;s0 rtoir oy4lmtelfet ( srrm(moou4oexnif3tltfm2emnms t4tltnircta1fpDraneil( t2tmxrpoy1lmtn feilt)a2rmumpot0opx moetldfaDumu snt0areoifcoo1fm e ies t) rxm(o3oodamt lfcil()a2umu pnu4alen f3iysfa umuvo u4 lxrio iadfmtr iesl()s2xoio3oy4aptelicilsf 2ur(r ou4alt  o3tasla2um(mo u0 rerio ia1lmtr uei;(0 2toirpou4alt lncsas)artaum nt1tltn iciydfa rluvp (4tltrxf iydfaDe ieslt) rtr(m iudllenmnesat arua(rpno0ope  oeiyd mDrln s t)teermrcoy1fmte ivi;s trurir oo1ame  nvtasf Dtmurpou0oex mi3tydlsDuauvp u0 etnmo oa1opDr neil( trxrxm nudamtnlfet t) Durxmo;u1apenmf3iydfaDrlu p;() lxrxr3iotlpDrau i;( trxr(m3nu1omeemietls  rtm(r nu1oet  o3iat aDuanvp (4treoxrctotfptraivs (0t2xo(o3nudlmt mfctasfs2umxmono1openmf3ild a el( on() rtoio tytlpDran s;t)truoxr nu4lltemici sfs2tmu o;o4altnifciyt s2uanvo (0 ltoio iatomD  nvi s0 exo(rpio1aleemfei tfs2umxmono0apxn iciltla2ea(mpnt4 lxomo3to1oa elivs s)seum(o iudll  mieta( srtrxmpou4opt  o3iltfaDemnmo;u0 etrmrciadfmtelneslt texoiopio4lmte ncta() Dtmxro;u1tlxo fetad s2raumpnu4 rtomr to1la  li i ()sexmir iy4omeemfvias  Dumu p;u0ape if3tls mDeauvpnu0alxrif3ty1lmD ai ilt sruoxo nu4amenmivt (fsDrrum ;o4oee ioetyd m eauvsnu0 rtrmr oydlm ranvo s teuo(m nydole mfciasfsrraxmpou4alenmo3ils s2em(vo (4tlxrxrciadla r ueil() euo(r nodamtn icsas sDrr(rpot4olenioetyslsDranvonu4alxoxr totfp r nei;t0seto(o iu4opeelfetat s2tm(moou1tee if3ias a ranvp u4arxomo tytopDr ivils  euoxm oo4lpenlfvs (  rrmx p;u0alto oeiat m ranms u0aexnxf3oy1fp rli i t)trxmio oy1lltnlncsl(fs2rm(rono1apxo i3iltfa2emu ont4artnxoctotfaDelnes;s) rtm(r3iu4lm  mfctat a2tmu oou4oleomfeiatfsDuauvpn()alxnxo3tadfm elnvi;( tetm(r3no4ll nlnvt t sDtr(r ou0opxoiietadla rluvp;(4arenmr ootom rlivi s0t2xo(m3no1lmeemfet ( arrrurpno1tpe mociytlsDemump u0 lxnircoo1fmD  ieo;s0texrim3ou4lpeelneils)sDrmurpno1apx moeiyt m2ra(msnu) ltoio to1fp  anesls) 2to(o3io4optelfviltfa2rmx pnt0aee ioeiad aDrlnvp;(4aetnxoctadfa elies;s s2ur(o oo4aptnmncslt a2um(r nt1teen fetytfm emums u4 eenifcty1lmt an slt  euoxopiy4op e ivs t)s2rm(m nu0aptnifciys sDulnvp;t) rtnmo todoaD luei s)sruoim3oodop nmfet t a2rrum ;u0tetnmf3ilsfm rmu p u4arxomr totopD anvsl(0s2xm(opoy1lpt  feilt sDta(ro;u0tptoifeild a rluvp ()artrxo3ty1laD lnes t)sexoxr oy1aptemfesatf rtau oot4oltnii3iltfa2em( onu0 rtrxf tatlmDrlu s s0trtrir nodop e ict t srrmxmp;u0apxn ictyd s2el(vp (0aleoifcoodlpteau i;s  rtrir ny1lmenmfcsl(  Drrurp;o4alxomf3ias m ran p;u0artoir3tatlatr u i;s0trtrxmpno4ll   ncil( arrmx  ot4tltnmoeiatla em( ont0 etnmf3oydlmDraivo;t)seumxo3oudapenlnvi ( aDtr( onu4tex  f3iadfs rluvsn(0trermf3oatfmtelivils0 rtrimpoudap nmfcilsfa2rru p;u1tlen fcilsfa2uanvs (4texrmf ootoatraneils sruoir iy1lmt mivt s) ruaxr ;u0ape iietasfmDrlnvon(4altrmo tadlpte nvo;s)srxmio3ny1op nmncs () rrrxm ;t0texn fciasfa uln s;(0 rxnmfcoatoaDe uvs t  2umxr3ou4llen icsat  2raurooo1teto i3iydls el(vp (0tlerxoctytopD livi t teuoirpiu4optemnvtls) rrau pnt0tltoiieiat aDum(vs;t4alenmr3ootfate nes ( trxm(opny1llee nctl( sDuru pnu4tpxomi3iytfm2rluvsn(0 rerir oytfptr i i t t2xm(m3iy1llee ivia(fsrtaur ;o4openmo3iyslmDranvp;() reoxr oydlm r uvo;( seur(m3iu4amtn ictas s2rmur ;t0tetoiieilsfm ean p;()tlerir oytfp  livi t)srtrxopnydoptemncs ( a2rmu pno4tltoifeiadlsDum(vp;t)tleomfcia1fm e uvi t trxmxm3iu1lp nmneta(f 2rm(rono4tetnii3iytls2ea(vpnu0treoir iadfaDran s;(  2uo(o iu1lp  mict (f rur( ooo4aleomi3tad sDulnmo;t0 eeomo3tadfat  i ils0t2trxo nodlmte feil(  Dtm(mono0alx mfetasla elnmpnu) exomo3tadlp eln olt sexrir ou4olenliet (farrr( pot0opxnifeils sDuau s;u0arerxo tatomt anes;s0s2xo(rpiodomt mnvs sfsrta(  nu4teen f3tadfs2eauvp u4 rxrmo ty1faD  i ol() 2xrxmpoydll n fet tf rtmxrpou4opxomfeiatfa umn s;t4teerxrciydop  livs;t0 exoxo iy1lpe lnvi ()sruau  oo0oltoiietadlm rlump u0alermr3iadfmtr ueo (0setrxo3oy1altnlnet tfs2trxront1aet  o3iytfsDra( onu0arermf ty1fm  livi;()trxoimpny1oleelnet () rraxmp;u0aptomi3iydlm rau o ()altomfctodoaDr ies;s)trto(m3ny1lltn ies sf 2urxm ;o4opxn o3ilsfmDea(mo;u4trtrirciydfateaieol(0 2trxr no1omt lfvsl()a2trxmono1aex mictydfaDum( s;(0tetrmo3tadfptean sl(0sexm(opiy1omtnmietls s2trxro;t0olx  oeilslm2rmnmo;u4 lxnmr3iodfp e ivsls)t2trxr3iydopt mnciasf Duaxmo;o4altomfciltfm2elums u0aetomfctotoateau s;t)trto(m nudaltnlicsl( aDuaxr ot1opxnifetadfa2eaums;t) rtoir oadlmD lieo s0tetmim3io1al  mfvslt)arua(rooo1aetomo3iydlmDum(vs t4tlxnxo to1oa r n ol(0seurir iu1lpeelfctatf Drr(moou0apx  i3iad mDrl(vsnu) eenif3tydom eauvil(0s2xo(m nudaleemicsa() 2taumo;o0aleomfcilsfm2eaump t0tltrmo iytop   ues t) 2trim nodaptnmivtatf 2rax  oo1opxoioetas m ul(vp (0texnmrcta1lm eanei (  2xm(o io4op   ncilt sDtax pou1opeomo3tasla uanmp;u) exrxfcoy1lp   ueils  2tr(r3iodale mivsa( sDurxr ou0ope mi3tat a2rmu p (4 etnio oy1fa e uei s0t2xo(o oydaptemfvsltf Drrxrono0tptnifeiys m2uauvp u)tetrxo tadopDraieol(0t2xmxopiudlpe mfvil( aDtrum ot0oltoii3iadfm2rauvo;(4alxnmr oa1lpD liei;t)s2tmxo3oudomeelici s aDtmur nu1opxomfetldfs2ea(mo;t0 exoxoctydfm eaneo ( sruoxmpiydamte ncs sf Dumurpno1aexo f3tasla2em( p t0tltnio3ty1fm rliesls0 rurirpoo1lleelics (fsrtmur ot4tex io3iyslm rln s u)altrmo oadla   ivil(0 etm(rpny4opt  fcsat)a2rm(  ;u1tpt iociatfmDrmnmp;u) lenxfciy1omDraieo t  rumiopnu1opt  ivsl(  Draxr nt0tpx  feiyt s2el(mp;(4aeerxo oytfmDeauvilt) 2xoimpny4ll nlnei tfs2ururo;u1teen f3tls s rauvs u0 ltnxf3iotfp e ues;t0 rumimpny4lpt mivi tfaDumxmooo4tle mfeildls um( pn()tleoxf io1lat  ivolt0seurxopiydlpt mnes ()arua(ro;u1tpto fciyslsDrl(mpnt)tltoir3tydfaDelivi t0 rxrxopiy4ll n ncs ()arrrx  oo1tee  iciasfs2ul( p u0 lxnir3tatomDr iesl(0t2xoxmpoy4op elictl( a2rauro;t1apxnioctlslaDuanvo t)aetoxo3tadfaDelivo s0seuoio3oodlp nlncias sDraum nt1oet mf3tytlsDemumo;()arxnxo3tytomt lu sl(  2urxrpoydlle lnct s srrm(mpno1texomocild s rlnvsn() etrmf oo1op  lnes (0s2um(m3iu1op  mnviatfs2rr(r nt0altoiociysfa2rauvon(4aetoir iotfp eanvs ( t2uoxo nu1op  mnctat)artm(mono0oeeo f3iadfsDrlnvo t)tltnmoctadopDr u ol(0s2to(o3iu4aptnmfcsls) Dta(m ;t4aex io3iyt m em(vpn(4tltrif3iytoa raneo;s)truo(m3io1ale mivi s)arurxmoot4optoifciyd s rm( p () lenxrcoydoa e u i;t teumio nydape mneilt)a2tr(r no4opx iieild s el(vont4 ltrxf oy1omte nvsls t2xr(o nodopte fcsl(  Dtrxro;u1altn o3iat s2eln p t)artoircoa1lptrlieo;t0trxm(r iudll e fesa(fa2tmurpnt1aexniictasls2um(vpnu0trtoircty1latrlnvsl(0s2xr(r iodlltn ivs (f rumu oou1oex  i3iydfa ua( sn(4alxoir iadfaD li s s0 rxoirpnudol nmnvilt) rtaumo;t1apeoiociasla2ul(ms ()trxrxo ootoptraieils0t2trxo nudapt  feilt) 2tmur nu0ole iieiad a2eauvp;u4 eerxo3oa1omtrau ils0srumxr3iy4alt mncs tf ruaxroot4ape mietlsfmDuln pnu)altrxf3iodlm  an o s t2urxr no1lp e iesasfartmu o;u0apx  ociyd mDrlnvo;()aetrmf3ia1lp   nvo;(  rxoirpio1ole  ncs tf Dua(mpnt1alx  oeiyd s2elu sn(0altnmoctadlpt  i s;()truoirpno4opt miei t)aDrm(rpou1ole  iciat a rmuvsn() exoxf oodla  livil(0s2xmim3iydlp  lneilt s2tmx p;u1aptn o3iat m2eau ont)treomr3tatfp  an olt)seuoim3oo1altelnetl(faruau  ;t0opx ifeiysls ranvs;() eenmrcoo1omDr neo (0sruoxmpio4lle  nctat)a2trxm no4aetoifetlt sDrln p u4 rermociodlat aieo;t srtmimpny1lm   ivil(f Draxmoot0oltniocild s2umu onu0treriociadop eaues t0s2uo(o3oodaptelnvsatfsDtaxrpou1apto fciadlsDulums;u)tlxrif3iytfmt lnei s)t2umir3oudaptn ncsls)a2umum no0tlen iciytfm2ua( sn(0tetrifcoa1lateliesl()trxoim3no4aptnlfeiasf 2taxmp;o1ole  iciydfmDumnmpn(4arxrir oatlpDeln s;( tetoim3iudopt  ivia( srrm(rpno1aexoii3iysfs2ua(mo;(4arenio3iydlat  i slt) rtm(o3oydap  lncs tf 2trxmoou0tlto i3ilsfm rmums t) lxnir oy1faD  nvils s2toxo3oy1ap emnvs s aDumur ;t4tpen feilslsDuln snu)aetnmr oa1fpt aies ( s2trxo3nudalenlivsl()srraxr nt0aee ii3iys aDrm( snt4 lenio oa1fmteli olt0t2ur(o nodapeelictlt aDurx  nu4tleniictlsfaDuan s ()texoio ta1oa   n o ()s2uoir3iydlptn nesat  rtm( pou1alt mfetls a ulnmo;(0 lxrmr oatlpD li slt0trtmir ny4ap nlncs t)aDtmu pno0alxo ociyd a2ul(ms;u0trxrmo iydopt aies t truoim no1amte ietatfs2rm( oou0oetn ociltfaDelu s;(0tlxoif iy1omD  ieo (0sexriopiu4ape  ivslsf Drm(mp;u0tlt  feilt m2em(mp;(4 exomo3ia1opt aneils tetmim oo4olt mfetlt)arta(mooo0texoio3iydlaDeluvs;(4teeomfctatlmt aivolt)srumim3iu1apenmieias)a2umx  ;t0opeo i3iadlmDuau p (0 etomo3iatfmtrluvs s)texmio iy4aptnmfcta()s2rmu p;o1tpxoii3iadfm2umump u0tltoxf ty1latrluei;t0 2trxo ny1opt liei t aDtru  ;u4olxnioeiys m2el(mo;t4alxnir3iodom e nvs (  2xmim nodlm elfct sfa2ta(ro;t1aex mf3iltla rln p () eenxo tytfpt  n i s0 eumim nydamenlicta( a2rr( p;u0tltnio3iatfm elumsnu0tlenifcty1fm  lues;()t2xm(o oydam emnei t)s2tax oou1olx if3ildfaDemums;t4trenxoctydlaDrau sl() 2tmxr nu1apenmfetltfa2rr(r oo0tet mo3tyd a rl(ms t)aetrmo oo1fmDeli ilt)t2to(r3no1open ivsa()sDraurpnu1tpx  feiysfa elnvp;t0arenxfcto1lm elu ils) ruoxm oy4ll   ivsasfaDua(  nt1teenioeiyt a2rlu p;t0 eenxrcootfatr neilt0sexmxr3iy4ape  net sfsDurum no0oltnmietltfs umnvs;t4 lxoiocoydlmD lneo;t0trxmiopoo1apeelnct s sDururoot1oexo ieiyt mDrau o t4tltoxr3tytfmtr iei t srumxopiy1ale mivsas) rtm( o;u4olxomi3ilsla2emnmp u)alxrio3tydfaD  uvi;s0 ruoxr3oy1opte ieilt  Dra(rpot4alxniocilt a2uan o;t4 rxnmr iatfpDe ivs ()setmir3oo1ol  lnctls)sruaxmoou1apxomfctys m2rmn snt0trtnmo3tydop  aneo s0s2urio3io1lm   nctat)s2tmurooo0aeenmfcild aDuanvont4artoxf ta1laDrln s s) 2trio oudal nmnctat)sDumumont1alxo ictytlm umumpnt4 lxrioctydomtraueilt)t2urxm3nodole mnvtatfaDrmxrpnu1ope moeiaslm2rau ont4aeenmfciatlptr nvsls)s2uo(mpnu1am nlietatfsrtrum ;t0opxn f3ilt s2umuvp;u4tetniocty1fa  anesl(0 eto(o3nodol elicilsfsDrru o;o1apx  i3iydlm2eau o;t) lxoio iotom  livols  rxmio nydole  fvtltf rrrxmp;o0tpenmf3iadls2uln snt) eenmo oa1lmDrluvi t0seur(opnodlp e netat sDta(ront0olxn o3tlt mDrmnmp u0artoxoctatomDe ieilt srxo(rpoy1lmtelnesatfarrrxr ;o4altnifeiasfa ua( onu) rtoifcoydfmt anei s  rumir3ny4optnlfvs tf 2taum ;u1texo i3iytfmDrln ont0 leoif3to1lateai i t0srto(m oydom  lnes (fa2tmu pot0apen fcias s2ul(vo ()areoio iadlmDr uesl(0 2xmio3no1lmte nvia( sDua(m ;o4alxnmicils m2rl( o;(0teerifcoadfpt lnvols0t2trir3nodam elicsat  2taumpnt4oex  feiytlaDrl(vpn(4tlxoir3tatlmt lnvslt0trtoxo nu1ap nmfesa()aDuaxr ou1olxn o3ild m2rlnmo u)aeenxo ta1lp eauvo;t  2xmxo3io1lp  lfvi (fsDtax  ;o1tpx mfctltlmDua(von(0 rtrircia1om rlneo t) eurimpiy1lm  mnvi (fsDrmx  nt1tlxo ietatfm2rm(vs u)altnxoctatfmDrlneslt0t2tmxopio4al  lfeils)s2ur(ro;t1tetnio3iydls2elump;t0tetnmr3oodlpt  uvi;(0 2xoxm no1lm  lfct ( aDumxr no1alt mfetlt s ea(monu0aexnxf3iy1fa rlivs s0 2xmirpiy1amt mnvias srtaxront4texnmictlsfs2rluvs t0 exnir ty1lm   nvils srto(opnu1amee fcsls)artmum ;t1tpxomfcilsfmDeln pn(0tetoxo3tatla  anvi () 2tmxm io4lle  feiltfsDuru  oo4aetn ociatfs2rl(vp (4tlenxf iatlmDelnvs;t) 2toxopny1am emivs (f 2taxmont4tltniicils aDem(mp u4tltrmf3oytopt  ueil() 2tr(o3no4lmen nci tfa2uaxr nu4tpt iietad mDrluvo;(0trtrir ty1fp  aivs (0tetmxr nydoltnlfctl( sDum(rp;t1aleoiieiysfs rl( p (4 lxriocoo1lpDrlnei t0 eurir3no1op emncia( sDra(m ou1aee mieiaslsDuluvo;(0aexomo3iydoaDe nvi;s0texoxo3oo1oltelfcilt) rua(mpnu0tpx  i3tat m2rlnvs;()tleoxr iodlmt au i s)setr(m3nodlptnmivs tfsrua( ont0tpe ifciydfm2rmnmp t)aetnxr3oodfm e u i;s tetmiopnydop e net tf Dumx pno0tltn o3iytlmDul( p;t0aeeoxo iadop   nvo s0trtoio nodlm  lnvtltf Dtau pno4olx if3ild m2rmnvo;t0aexrmocoy1oate u s t seuo(rpio1opeeliviatfaDuaump;t4apx  f3ildlm2raumo u0trenxrcia1fpt ln sls0srxm(m3oy4lmeelici ()sDtm(rpou0olxoiieiatfaDrau sn() ltrmoctotom e uvslt  2xmxopio1ll  livt t  rurum oo4optomicilt m rmumpnt4altoxo3iy1oaDraieo s  rxmxr nudap nlfcils aDuru  ;t4tltomietatlm2el(vs;t4alerxocoatoptranvo s) rxoimpny4apen icslt) 2tau  ;u1texoii3iltfm umu s;t)texomf3oadoa  ln i;s0setoim3ou4aptnlnct s)aDur(  nt0opto i3iys m umn pnu0 leoxo3tatoaDr ivs;t)tetm(r oo1op emicslt)sDur(mo;o1aleo fctys m elu o ()artrxr3oytoa raies (0teto(r3iy1lpt miei ( sDuax ono0tle iiciys sDran s (0aleoio iodfpDran s;( t2xo(r3oodal emiet t  2rruro;t1tpeomiciys sDranvo u)aexrxrciodfpteau ils)trxmirpou4optelfct s sDuaxrpno1tptnmfetytfaDrmu pn()tlxrxocto1lm rlu il() exrir oodlmeemfcia( s2ta(rpno4opt ifetydla um( p;u0aetnio oydopte u il(0 rxrxr oydalee nvil( a2tax  ou1tetnmfciadla2uanms t0altoxrctodlm r i slt tetoio3nu1openmfeiat srumxmo;t1olx  i3ils mDeln pnu0tltnio tytfp eauei;s t2uoxr3iy1am e ieiat) rraur oo1aeenifctltfmDrm(msnu) leoxociadomteai sl( s2xr(r oy1amt  fcs ( aDrr(mpnu0aexo fciysla2rl( o u4aeenmf tytomD lueol( s2toir3iudllt lncsas)arururpno0aeenmfeiaslm rm(vs t4tlxomo3oo1fp eluvs;()t2xrio oy1apenlnciat  Duaxm ;t1alxo i3tadfmDel( p t4trtrir ty1fpDrauesls)tetoxr nodol elfvsat  rumx p;t0alt ii3ilsfm2rl(vpn(0tetrmoctytla rluvi t0setoxo iudapte fci t)artr(moou1apeo f3iyd aDumnmo t)teeoirctotomt auvil(  2tmxm3iu4ome mnetatf 2ua(rooo1tle io3iatla rl( o ()aexoxf tatlm   ueol(0s2uoxmpoy4apte feilt)arur(  nt0oeeomiciat mDraumsnt4aleomr3ia1faDeau olt)s2tm(r3nydamte nvias  ruau pot4oleomi3tydfm ua( o;(0 eeoxr3oa1op elnvo ()sexm(opno1lp nmivils)sDtax oot0tpxo octadfm2ranvo u4aeerifcootfaDr uesl(  etoxrpoy1olt mnetls aDrm(mp;t4apx  oeiat mDuauvs t4texrmf3iotlpD  nvs;t) 2urio oy1llenlfvs t) rtr( p;t1tleomo3iltfsDrlnms u0trtrxrciotfm elu slt srtrir3oodap  lfcs (  2um( oot1olenmfeild sDem(mp u4 renifciodfmtelnvsl(0trto(r iu1ll emncs sf Drrx onu1apen ociytlaDrlu o;t) ltomoctydoa  lies t) rumxm3nudlle mivi sf Dua(  nu0apxnii3ils sDel(mp u) rxomf3ta1lmDr nvi s)t2xrir3iu1om e ieslt) Dur(rpnu4altoiiciyt s2umnvo;t4artnmrcoo1om  anes ()texmxm3no1ap n fcs t)aDtaur oo4tleoioeiadla2ulumo;(0tltoxf oodfpDe n o;(  2tr(r3io1ll  mfes sfaDta(  nt0opeomi3tltls uau onu)altrmocty1lp e ues t)t2umim ny1lm nmnvtlt)a2ua(r ot0tlenmicilt aDumnvo;(4trtomrctatomt  ivils truriopoo4op  micsasfsDtr(ro;o0aetomo3ild s2emumo;t)altrmocoydlatrlneilt  ruoxm iu1ome  nvsltf 2umum ou0alxo i3tyd m ul( ont4 rxnmo3tydlpD lu slt)s2uoir3ou4ape mfctl()aDrrumpou0aptomfctlsfm2eanvsnt0 leomrctadlptr n s;s0s2xm(mpno4ll n fes s)s2uaxm oo4optomfeiytfsDuau pnt0tlermr3oydomDrlu s s0 euoiopoydlmeelnes t s2ra(moou4aleo oeiytlm rlumsnu0 rermo3ootoaDelneil()t2tmxm nudap elietl()sDua(r ;o4tpxoiieiltlsDrlnms ()artoir iatomDraiei (0sruoirpoydoltemivsls  Dta(mont4oleoiocildlaDua(ms (4tlenxo ootfptrauei s)teuo(m3iy4olee nvs s  rrru oot1oee  ociltfm2ran on(0 leomrcootlaD anvo ()sexmxmpou1alee fcs sf rtaxrpou4tee  fetasla um( s (4aeeomocoadlmtr uvs;(  euo(o oudaptnmfesls) 2taxmpno0tltn fctysfs ul( o;t)tlxrmo3oytfmte ivsl( s2xmxr oo4olee ici s)a2uaurpot0oeeo feilt mDem( o (0aeenmf ootlm   n ils t2uoir nu1ape lfet sf 2uaxm ;t1tltnioetltlaDrluvp;u4 rxnif3totopte i i;s0srurxr3io1aptnmnviatf rrmxront4opto ieiydlmDum( s;t4aeeoifctotfa  anvil()t2toxm io1lpenmictl( a2trx oou0tle  feiytfmDuau o;(0tltoxr3oa1fmDelu i s teto(r3iu4lmeemivtl( artmurpnt4tpxo i3iatfmDeauvo t4tetnio3iytopte nei;s trtoxr3oodlp elnvtlsfsDumxmoou1tle miciltlsDrl( pnu) exoxr iodfat lnei;( teum(o3nydaltnlics ( sDtrum oo4apenmi3ilslm2eanvpnu) eenifcta1omtr nvol(0 2xrxr iu1ape lfes sf Duax p;t4tlto fctltfs2eluvp u) ltrxf3oytlmtelivs t0 euo(o oudolee nct t)arum(ront4olx mi3iatlaDea(mon(0trxomo oodoaDraivo;t)s2tmxm3ny4alt mnesat)srtr(  no4optoiociat m2uan ont0artoio3tatomt  u i;t0truoim3oo1am elnesas a2tm( ono0olxn i3tatls2em(mp;u4trtriocoydfpD  nvsls)srxrxmpiodlpt lnvtatf 2rmxroou1tee ii3ias sDelnmonu0arxrif3ootlaD  ivi;(0sexm(mpiudoptelfcsa()artmu ono4tpx mi3iatfm ua( o t0 rxrxf oatlpDelu s;t teuoim3iy1lpen ics t  2rr( o;o1olt  ieils a umu on() renxociotfmDrauesl()trto(r3io1oltn nvsl() rta(  ;o4aee ifctysls2eauvo;()aeenxocootfa ranei s) exr(r3iydolen ivsltfs2ta( o;t0texoif3tydfa uaumsnu0alerxocoadlate ieo (  rxmxo no4amenmfci sfarum( o;u1oleomo3tatfa2uluvp;(4aetoxrcoatlpt  uvolt  2uo(mpoodlmtelnet ()aDtm(m ou1oeto o3tls mDemuvpnt)aexniocoadom ran s;t0setoir3oo1ap emnvils artru pot0texo ieiatfa eanms u4aleoxrciytfmte ivs;s0tetmio3ny1lmenmfvi t)arrr(roou1oex ii3tydfaDeluvsnt)altniociadoaD auvils s2toim3iy4apenlfci sfaDtr( oot0aet io3ilslm em(vp;t4tlxrxo io1omtrauvo s0setoiopoudaptnlncils) 2rrxmpoo0tlx io3iydfa eanvs (4tltnxo ty1op r neo s)sexm(o3iydom emici t)arrr(ronu4olx mo3tydlm eau o;()alermr oydlate uvs;t) 2tmxopoudlpt lnetl(f Dtrxrono4aetomi3ils m2ean p t4tlxnmr3oo1fmDrlueo t) eur(mpny1omeelncs (fsDtrurpnt1tleo oeiasla2rmn s;u)areomo3iytfateau ols)s2trimpnydap  lfetltfaDua(mp;o0oee  iciydlm2elnvo;t) rerxfciodfa eli o;( sexm(mpiydapte nvta(  Dur(rp;t1oetniiciltfmDrmu p (0 lenxr iodlmD auvils s2tmxopnu4ap  lfcs t  rrru  ;o0ole iieilslmDumnvs;u0alxnir3oy1oate nvo (0 etrir3oo1am   fes (  Dtr( o;u4tpxniociadfa2rmumon(0tlxrmo3oa1oa rlneols)tetmxo3oy1lmt  fcilsf rtax oot1tlt mocilsfs2eanvont0tetomo3ta1oatr nvils) exrio3oy4altemici (fs2tr(mo;u1oltn ociydfaDrmu s;(4 lxnif oytfat an ol(0 etm(o3oo4lp nmnesls)a2rr(rpot0opt iietydfa2rmnmp;t4 exnxf ta1lm elueil( sexoiopiodam emfct s srtr(r ;u4tltn oeils s2um(vs t)alerxocoy1fpD  n o;t) exmirpoydap  lici t) Dur(mp;u4ope io3iatlmDum(ms;(0 exoxf3tatfmD luvils  2toimpiu4olte iesasfsDtmurpnt0oet  oetlt sDrln p;t0altniocio1op  anvi t setm(r3iudopeelneta()aDtaxr nu1tle moeiaslm2ul(mp (4 lxnmfcta1oaD ai ol(0 2uo(m3io1apee iciasfaDuax  nu1tpenioctysls um( p;u4aeenmo3io1oaDe ivslt0seum(m3nudolte icsls) rtmurpot4oee  fcild s ulu pnu4 ltrircoa1lpD ln i s s2tmxr iudlp  lneslt srtmxmont1apxo fciyt s2ul(mp t) lxoxfcta1laDrluvs;t)texoxo3ou4oltnmicsas s2tmu onu0optnifetatlaDuan s ()aetoio3tydfm r uvols  ruoio oy4alte nesl() 2trur ot4aptn ocilsfa uln snt)treoxr3oo1laD  ivi ()tetrirpio4om nmieiat)sDrmx  ot4tpxomi3iytlaDean pn(0 eenxr3oy1lpDeauvsls0s2tm(o3ou4lme mnvsat)srtrxroot1olto ieiat m em( s;t0alenif iy1oaD au s (0 exrio3oo4aptnmnci tf rrm(m ;u0oltomi3iatfs2rln p u) rtnio ty1laD lnesl() rxr(r3nudlp   neia(  rraumo;u1apenifeiydfa ra(vpnu4 lenmocio1opt  neol(0t2xo(r3ny1am elncsas)aDuax  nu1tpeo f3tytlsDran snu)alermr to1omte n o;t)t2trirpiudomee fcsat s2trumo;t1optomieilt s eau on() ltrmfcoy1oa e n s t0trurxopiy4omen ictls  Duax ono1olx  fcils mDua( p;() eeoirciydfp eau s ()srum(mpoo4om   nvs ( arta( p;t0tet  o3tls mDrmuvont0aleoio tytlmD aueo;(0s2tm(m oo4omtnmivias)aDrmumonu0aexnio3iaslmDumu p u4tetnxrcia1op rliei (0teuo(mpoy4aleelnvi sfs2umuroou1alx ioctasla eanvont4arxrmo3iotom eluvils  rtrxrpiudolen fvtlt) ruax  ;o1tet  oetysls uauvs;t)teeomfciydoat li ils trurio3no1am nlfeta(  2raxr ;t4opeoii3ild sDrmn snt0treoxrcoo1fate n i t0 rur(r ou1am   ictas) Dtrxm ;u1aeeoiicildfsDrmnms u)trtoxociytoaD  uvo t  etmxr3iu4oleemfct s) Dur(mpoo4oexn ictldla2rl(mpn(4trxnxf oy1lptean ols0 etmirpno4lp emnvtas) ruaxrpoo1aexn octldlmDum( o;u4 rxoxrcty1oaDeaueo s  rxoimpiy1lpenmnesat sDrmu poo0tetn oeiyd mDum(ms;(0treoio3oa1omte u o ()srtm(opoydale  fet () rtaumont1optomietat a2ea( p;t) etnxo3io1late nes;s0 rtoxr3ny4alen fvs (  rumxr no0tlen ociadfs2ra(mp;() rxnmo oo1opD  n s ( sexmim nudopt lnctls s2raxmo;t1tee  o3ildla raump ()arxnxrctatfaD  iei s0 etmio oudam elfvsltfs2tax  ;o1olenmoctydfaDrm(mont)arxoxocoodlpteluvsl()setoir oo1oltn fctls) Draxrpoo4tleoifciydfaDrl(vp;u)alxoxr3oo1lmt  uvo t0 2trxo3oo1lp  lfetls)srtr(mont1ole mieiyslm rl( snt)arxrmf iytfmDrluvols)trtoiopiy1omee fesl()a2raxro;u4apxomo3iyslm2elnvpnt0trtnmo tadfptelneo t0 ruoir3oodale  nes tfartrxm no4aet  ieiltfs emuvo;(4aleomocootlmDeauei s0 2toio nu4om eliesl()sDuru oou0opxo icild s umnmp;() rtomr iotlm eaivslt seumimpiodape  feil() 2uax pot0altn i3ias a eauvont4aetrifcty1fmDe ivi;s srxm(r nodop  mivsa(f 2rrx oot4tpxn i3iysla eanvp;t0texoir3io1oa elies;s) 2tm(o io4aleemfvsatfs2um( pno0tltomieiydfm emn o t) leoxfcia1lp eli ol() rtmimpnydolt  fci () 2ta(mpou1olxnmo3tld m2elu snu)alxomo oadlpDr nvo t)srxmim3oodopeelnvsls)srraur ;o0oexnmi3iltfa emumpnt0 etomfctytla  lueo t0t2xm(o3oodame mfcsls srrrur ;t4teenmo3ils sDrmnvs (4artnmr3iytoa  aivols srxo(o3ny1olt mfesltfs2tr( ono4apeoif3tadla rlu onu)tltrxrcty1laDeauei;t  exmxrpou1op  lnvilt)s2rauronu0oetoifcild s2rm(vs;u4aeerir tatop r ivi t srxoio oo1openlictls srtmu poo4tpx  i3tldfa um( o t0trxrmrciadfat livsl( srto(m nodlmtelfciasfsDraump;o4tpxnif3tyt m rmnvp;t4tltnxfcia1fpD  nei t srtoxrpny4ll e icsa(  2tmumoot1oltoii3ias sDua( snt4 lxrio oa1la raues t) rxmir nudome mfes ()artax  nu4aeeoifcilsls rau sn()arerxrctytla r i i;t  2xo(m iy4optnlfcil(fsrtru pno0oee ifcias m emnvs;t4tlenmr iotfmt aivols) eum(rpno1omteliesasfa2rau pnt4tpe  ictatlm2emnms (4aexnxrcoatoptrauvi t0 ruoxopoudll nmfeta(f 2rmxm ou1ope  o3tatfsDea(msn(4 reoio3oo1fa   u i t)s2triopno4lp nlnvsat  Dum( p;u0aeenmietadlm ea(vont)alenxf ta1oa   nvi s) euoxr3iy4am   ieia(f Drrurooo1aee  oeiatfa emu p;(0 lxnmr3iodoaD li s;s texmxm nudomtelictlt) 2uru  nu0tpe ifeiatls2ulu p;(0trtrmo iodfaDrlnes (0seuoxo3nu1ole mfvtlt)sDtmuroou4tpeoioetat mDrlnms t) reoio3to1lpD  neolt)setmir oudop elieslt)srurumoou1ape  oeiad s2el(vs;t0aetrxo oydfpDeluvi t)srto(rpnydal  mneil() rtru  nu4tleomoetld m emnvp t0texrxr to1opDe uvi t)teur(r3iu1opte icslt  Dtrum nu1opxomociltfmDrmnvpnt4trtnmocta1oat  uesls) rtrxm3nudlmenlfesls)sDurx  nu4tlen fciadls2elu s u0 lenxf oodopteai s;(0 2umxr3oy4amte ivi s)srtm( ooo4opxomfctlsfaDrm(vpn()aexrmf tydoaD li o ( trtrim ny1ape lfet t)srrrxr ;t4aeeomietatfaDum(ms t4tetomrctotfaDr ieo;t0s2trio iydllt  ietl(  2rrxmpno0aet mociysfa um( pnt)arxrxociytlpD auei;t) exmir io4olte fctas) rtrx  ;u0tee io3iadfm2ul( on() rtnmr3oytlm e uvsl(0 etm(opno1omt mncsat a2tau ooo1tpenioeils sDel( s;(4arxomfctotfmDeau s ()srum(r oo1olt  fctlt sDra(m no4aptn octys aDrmnvp;() rxnircia1la rlu i s)srtmim3iydal   ivias)arurxr ;t4olt ioeiydlmDuln pnt0tltomf3ia1fateaneslt0 2trirpnodam   fvils)s2ra(mp;u1teeo oeiydfs2ulumo t) rxomfcoytlpD  nei s  exmim3ny4op nmieil(fs2rrurpno1alt mi3iatfaDrm( o t0 etomf3tatfmD li o (0teto(o iu1ole lietatfsDrmuro;o0alx iocildfm2rl(vs;t4aexrxr oa1lmteai o s)teuo(r iu1olt  ivtat srum( pnu0ape  ociydlsDua(vonu0artrmr3oodoaDrlivo t0srtrxm3iudlmtelnvsas artax pno1optomfeiadlsDumnmpnt)artnmr3ia1laD anvi;s setoxmpoudolenmivt t) Duau p;o1apxo i3tls a rm(mo t0tetrir3oadlm elu s (  rum(opoudomte netat) 2urxm ot4apxnmo3iytla2ulnmo u) rxomf3tatfpDrlnvs;()sexrim iu4al e fvtls srurur ou1oet ifeias a ul(mon(4tlerifcoytlatr u slt  ruo(m ny4oltnmfctas)sDtmxmooo4oet  ociyt m2ul( s (0 ltomf oadop  anvolt) 2xm(opou1lpe mfcilt sDtrxroou1oltoiieiydls ul( pnt0tetnmo totlm r u i;s sexo(m3nodamtn netatfa2rrxmpnt1tpxo ictytlaDrlnvs u4 lxrmrctytfmt li i t srumio3oudamtn nvs (f Dtau pot0aeenmoetad m2rmnvsnu4tltoio iadfpDr ues;(0teur(o3nydame mfcslsfsDtax o;u4tpxniieild a uanms;()tltnmf iy1latrluei;s0srxoxrpio1llt lnetl(fartrx ooo1aeenioctas a2rmn o u0 lenio oa1la e nei s)setoirpio1apt  nvs ()srrm(mont4olx  f3iys s rl( s;u)aeeoxo3todlmD  u il()trtm(m nu4ome  neiatfartmu onu4tex mfcild a2rmnvo (0tleoxrciotop  lnesl(0 eto(opoodalte fctlt a2tax o;t4aex if3tlsla2rlumonu0 ltnmr3iydfatr n s;(0t2um(o ny4op elfeta()a2raurpnu0oeen f3tyt aDrm(vp;u)aexoif3oa1lmtr n ols  rxmxmpiu4lpeelivilt  Dtmu ont4ope  ieiaslmDel(mpnu)altoxf tadfaDrluesl( teuoxr oo4ol e nei () rtr(r ;t4tlxo ictldlmDrl(vs;t0 rermr iytla e u i;() 2xmimpno1lltn ivil() rrrxrp;u4oeeomiciys m ranvsn() ltnxo ty1latr ueslt0tetrxm3nodal  lnet tf 2rmx pou0opt miciasfs el(mp;u) lerxociy1oa rliesls)srtrxopno4lpe licilt) rrmump;t4aexoiociydfa emu o;(4trenxrctytopDr ivil(0t2xrxo oodam emnetasfsrrmxro;u0altnmi3iatls um( o;t4tlerir todlpDrauvo;(0sexoxopio1lpt lfei (fa2tmxr nu4oexo i3ias a ulump;(4 renxo3tytoaDe nei;(0sexoim3oodame lfctatfa2rr(mpno4oleomocilslmDrmu p u) lxrmf3iotfateaivo;s truoxm3iy1ameemncta() 2rm(ro;u0ale  o3tls a2el(vo (4arxoxoctytlatr nei ()tetoirpoo4opeelnvi ()aDtax pno4aetoiieiydlmDean p;u) lerir iotfp eaivi (0 2uo(r oo4al nlfet s srtaxrp;u1tltniocilslm2umumo;(0aetrxf ty1fm elnei s  rto(mpiydap e nci s srra( oou0olxoiieiasls2el( p;(0 exomrcoatlateauvol(  rto(m3oodopenlicsas sDtm(mp;u1ale moeiysfaDulnvp;t0tltomr3to1lpDeln o;(0 etoxm io1al emicils s2tr(ront0tpxoioeiatfs2el( sn()aexnxf io1oat au sl(  2ur(rpno4omte ivt ( sDua( o;t4apxomi3iltfm emuvs;u4altnxrciy1fmDrlivs;t)trxmir3ou1am nlnvsa(fa2uru  oo1tpx ioctytlmDeauvo u)trxnifctodopDeaieol()teumir3ou1al elicsas  2uaxrp;t4aet mo3tydfm emumpnu0aexrio3iydopDe ieo;s) 2xmirpiu4lp  mfci ()sruax o;u1apx ioetls sDuau s (0aexoxociytoate uei (0 2toir iu1lptelfesas)artru pou4oexo fetasfaDelnvon(4 ltnmr iotlmDelivo t)teumio ou4opt mivt tfaDuru pot1olen i3ild m emnms;u4tleoirciadlmDelnvsls  rxo(m nu4lltemfcsa() 2tr(r nt4optoiictat aDulnmo (4tltrmrciatfptr u il() etoio3ou4aptemnvsa()s2tmxr ot1tpe  feiytfaDul(vo;(4arermo3oo1oaDe u ols srumxr3ny1altn fvsa( a2rr(rp;u1tltomf3iadfa rlnvsnu)artrmo ty1fptrlivslt  2umxo3oy4ole micsls srtmxmonu1apx iociad mDeanmo t)arermr3todla  lnvo s) ruo(o3nu4ameelictls)sDrmum no0tlt ioeiadlmDeanmp t0tlxnxociadfaD lu s;(0seumir nu1am emiei s)aDrrum nu4tex  ictytfs eanvs;u0altrif ootop ranvs t0seuoir3ny4altn fesl(faDuaumo;t0alxoif3iadlm rln ont)artoxf oodlaDraueol( t2toxm3iodomtnlnei t)srtmxrpou4teenmfciatla2ulnms;u4 rtnif3oodfm  au i (  2xmxrpny4apen iet t aDta(r nu1opx  ieias a2ea(mo ()tlxnifcta1la  aivi ()t2xo(r iy4lpenmici s  2rmx p;o4tleomo3ils a2el(mp;(0trtrmfctodomDrauvo;(  eurxopnu1op  lncsls  Drrxronu4optomoeils m2rmnmo;(4 rtoif tydomD lneo s  2xr(r3oo4opeemneta(  2tru  nt0tpxnmi3tatfm2uaump;() reomfctadoaD  nvo ()setoir3ou1ameelfeiat aDtmu p;o0olxomi3tytlmDuanvon(0 etoio3iytoa r nes;(  2urxr oy1am e fcslt sDurxmont1tltn o3ils mDulnmo;u4artnmo3ia1fatrlu i (  2xoxr3oudlptelnvsltfartmxr ot4optoiociaslmDrmn onu0 etomf totfmD luvils0s2urirpno1lptnmfei tfaDrauront1olt  feils m2rlumo;t0teeoif3oy1laDr i i;(0 rxmio3ou4am nmnctl() 2ur(rpot0oexomo3tyslm umnmp t4artnxr oy1fmD  ueolt) ruoxr no4open neiat) Drm( p;u0olxnmietyd a emums t0aetnxr ty1la  lues;s)seurirpny1am nlici ( a2rmx  oo4alenmocildfm el(vp ()trenif3oadfpDr ies;s) 2tr(opiu4amtnlncsl() 2um(ronu0aexo f3ildfm2eauvp;(0 exnircoydfmt lieo;() 2umim3oudol e fcils aDrax p;o1ole mo3ild sDrm( s;u4 eermocia1fa  livil(0s2xoio iy1ll elnesa( aDumump;o0teeomi3tadlsDrln o;(0alxnxr3oydfaDr i s;s) exmxr iydoptnmicsl()artmur nu4olxnif3taslm2rl(mp u0trenmr3tadoatelu o;()t2trirpoudlleemnet ()s2um(rp;o0tlx  i3iydls2elu o;()tltrmf3iy1oaDranvi s0 exoxm ou1ame lnvil(fa2ua(mpoo1aleoioeildlsDem( s u) ltnxoctydfp elu olt)srxoim3iodopeemictatfa2uau pnt1olx ifeiatfaDran p;() lxnioctatlpDe i i;()s2to(opnydap n ivta()aDrax p;u4tpt  f3iasfs2uln o;()aeenmociatfm r n i ( trxrxr iu4aleemnci (  Dtaxrpoo4oleomo3tytlsDeanvont4 lxomf3iy1lmtrai s;s s2xoiopny4al elfvsasfs2uaxmooo1alto ociydla2rmnvpn(0tetrio3tydfat lneo;s  rtrio3oo1ope  ncs sf Dua(rpot4oet  iciltls eanvsn(4 rxnio oy1lat  nvo s)s2um(m oudlp  mfvilt  Drrxmo;o1tee mo3iltfa2ua(vs t4 etrmfcoydlm rlueo t tetr(rpoo1oleelfvsls)aDur(  nt1tleomietydlaDrmumpnu)aexnif3oytlm  anei;s0 eumio iu4amt  ncils)arur(monu0ole mi3tldfa2ranvsn(4 rxrmf iadla r i i s  rxo(m3ou1lp nlfetat  rum(rp;u1tpen fetatlsDrl(mp t4alxoxo3ta1fpD aivi s)srumxo iy4lmeelict tf rrrumonu1olt  f3iaslsDrlnvp t4arxrmfcoatlatelnvs;()tetm(m3iodol nmicsl( aDum(rooo1open oetysla2ul(ms ()tlxnxrcoadfp r n s t) rxrim3no1lpe mfvilt  rtm(rpnt1oleo ieiatls ra(mo (4alxoio todoa r nei s) rtm(r3oodop emncslsfarrau pnu0aptnmoeiasfa rau onu4 rtoirciadfateln o (0 etoxo3io4altnlnes s s2rau ooo0optomo3iys s emn pnt)arerxo3ta1fa rlivilt t2uoxr iu1open fcsat  rrmumo;t1tleomo3tlsls rlnmpnt0texoif ty1opDr iesl()texmxrpou4lpe lfvtlt)sruru ooo4alx ifciad a ulnvp t)tltnio3iydomt aieslt)t2uoxo3nu1llteliviat s2umuronu1ape mo3tadfaDul(monu)tetoirctydfpDeauvi t0t2uoim3nu4apt lfeilt) Duaxrpot0tltnif3tlsfm2rmnmp u4tlxoxf3oatlm  an ols0trumxm3oy4amen nci sfs2ua( o;o4altniiciytfaDrmumont)aleoxocoy1laDrlu o;t)trtrxm3nodam  mfvt s  Dumumont4alenmo3ilt s emnmo;u)artoiocta1fp eau ol( truoio3iu4omeelnctas arrr(rooo0opxnmiciyd m rmn p;(4arxomr3todla eaivi;(0srumxrpiu4ol n ncsls  2raxm ot1apx moctltlmDrmn o (4aeenmrciydlmDe u i t) rumxopoy1lp elfvtltf 2umurp;u1tpt  ociysfa2ra(mp () lxrxf tydfmt lueo t0t2tmxr3oo1lm  mivt t s2tmump;t4tpxo ociltfa em(vo;t0trenmr ia1lmtelivi (  etrir3oy1am e fvsltfaDtrxm ot0optniieiasls elnvo;u) lxrmo3todfmt ai olt  rtoxr3nydlmte nciltf 2ur( pot1tltomf3iaslsDrl(mo;u0tlerifciy1latr i sl( texoxr nu1aptnmncs ()sDurxm ot1apto o3tad mDeauvsn() ltnxf3oadoatean i () eurxr ny4ameelfct ( s2raxronu0tlen ociat m2eanmon() rtnifciy1opDeauvsl() exmirpiu1ome mfcsl()s2raxro;t4apen i3tls m rmuvs t0arenmr3oydlm   ueo;t0t2trxopiydap  mnvil(fsrrmu ont0tpxn iciat s rm(msnu)tetomr3ta1fmt  nvolt  rxr(mpnydape lfeta()aDtaxrpno4aet mictys aDrlumpnt) exrxrcootfate n ilt) etr(rpnudam elfvs sfarrmxrpnu4ale  fetyd aDua(vsn(0tetnio oadoa e nvi s0 rur(r3iodlpe  ncta( srur(  ;o1texnmo3iytlaDrmn o ()trerxr oydoa rlnvi;t0 rtmxo oo1olt  ieta() rum( poo4aptnmfetys m rm( o;u0arxnxrcio1fpt  ivo;s0 rum(o3iudom nmneil( arra(  nu1olxo o3iadfm2eluvo (0 reomf oy1fmtraieo;s s2tmimpiy1olt  fesas  Dtaurpnu0tpen fctltla ulnmo u0aeenmo ootlmtr u i t  rtmimpny1ope mivil() rtrxmont1olxnmo3iyslsDeaumon() ltnxo iodlmtelu sls)srtoxr iu4lleelnci t)s2trxmo;o0alxo oeiyt a ea(von(0trxnxrctadfa r i o ( trxo(m3iy4am  lnesl()sDrr(m nt0olxnmo3iydla ranmpnu4tlenmocoodfp elivil(  rum(r3ou1openmfci s sDrmx pou4oet  f3iatfa uauvs t4artoxfcootfmtrlivi t  rxrxopiudaltemivta() 2umuroou4apxn ietysfaDua(mp () leomf3iotlatrluvo s seumxr3iy4op n fvi t)artru p;o1apenmfetatfa2um( sn()arerifctodomtraivi ()texriopnu1optelivil()s2um(rp;u0oetn o3ildlmDrluvs ()tltrmr oydlaDraues (0s2tmxrpno1om  livtlt)sDurxro;o4tlxoifctas m emump u)tetomf3ta1fateli ilt)srtoim oy4ll  mfci tf rrr(m nu1olx mfcils m2umnvo t0artoif3tydfp  lnes (  2xrxm3oodlm  lfcsasfaDrmxm ot4alen ocildlm el(vsn(4 etnxr oydlptrli ilt)texrim oydaltelnct s  2rau oou4tleo o3tyslsDumuvont0texomf to1oaDeau ilt0 2um(r ny1llenmivt ()aDtmumo;o1optniiciytfaDuanvp t)trtrmfcio1fp eln ilt  rtr(r nudaltelivslt sDtmuront1tlenmietat mDel( o (0tlxoxocoadfpteluvs t0tetoiopnodlmeemfci t) 2urx o;o0tpx  oeiysls2umu pnt)trermo oytfa raieolt)trtrxr3no4alt  nvtlsf Dumu  ;u1aexoiocias s2rlnvpnt0 etoxr iodfpDe u slt s2tm(opnudomenmfctatfsDtmxmpot0texoio3iltfaDrmnvo (4 etoxo3iadfm eau s;t0 2uo(m oydopee fesl(f rtmurpnt1aexn ieild mDranmsn(0texrxo iy1fatrli olt0srumxm3nydomtnmfvta() Drau pou0aee ifciydls eluvs;t0aeerxrcoadfmDeli s;(0 rxoxr3oy1apenlnctls)a2rm(mo;u0alenmfeilsfaDrl(mp ()aeerir oy1fateaieo ( trtr(o3oydam nlfvils)sDum(moot4opeo ictydlm2rmn s;(4texoxrcoydfm r n i t s2uoxm nydop emfcs (f 2urump;o4tee  f3ildfsDrm( s u0trenxr tytomDeanvols  exmio no4lmen nvi tfa2trx  nt1tlt ifctatfa2emuvsn(4texnxr oodoatrau i;t)t2xrxr3ou1ale  nvs sfa2tmxm ou4aptomfcilsfmDrau s (0 reomf oytfa  anvs ()t2tmxm io4lltn ivtat  Drrxr ou0altomi3iadfm2rlump;u4aleoxrcoodoaDrli i;t) ruo(o iudap nlncsl( srurx pnu1apxn fciys s elnvp;t)trenir3ootlptr ueo t)t2xoxmpno4altnmnesa(fsDrm(ro;u1oleo ictas sDraump t0arenxo3ta1fmD aueo;t0 2toir iy4lmt  ietl() Dumx pot1ole  i3ilsfm rlnvs (0tltrmfctadfpDean il(0srxmxr3ou4lle lfci s  rtmump;t0aexo ictysfsDea(mpnu4aeeomr3oytlmteau ol(0srxo(r3oy1am n fcias  Drmu  ou1olt  i3ild aDrl(vs u0 ltriocoydlaDeluvo;t sruoxmpnydape lncsls)sDurx pot4altoifeiydfm uluvpnt) reoif iytfatrlivol() rxmxm3no1ale lfesat)a2trxrooo4alt iiciyd s2ua(mpnu0 etrmociydom rauvs;t)s2uo(rpno1lmt mfes ()s2trx pnt4oltnioeiys a2rm(ms;t4alxrxr3ta1lpte ies;s0srtrio3iudolee iet sf 2umxmpoo1aeeo octadlaDemuvont0tltnmo3oadoateaies ( sexmxmpoydlpe  fvta(  rumx  ;t4aexn fciltlmDulu s;(0 lxnxf oodlaD lieo;(0trurxm iu4ap   fvi t)aDraumo;u1apto oeilsls2eanmsnt) lenmo3oodlp  au s;t0 2xmxopio4ap  lfcsa(farrru  ou0olenif3iyslm ua(msnu0tlxoxo3totlm raivo t t2xm(m3io1ale  icsa()a2ra(rpoo1optoiietat aDrmu p u0aeeoxo iy1lp   ieo;t srxoio oydam nlfet tfsDumurono4alto i3iydfm ul(vp (0 rxoifciodom  aueo;s srxr(opoodlptnlnesa( srta(rpot1optn o3iysla umuvs;u4alenmr3iy1fat  iesl() 2urxr oy4lm  miet sfarum(rpou0tpt  ociyt sDrlnvpnu4aeerir oytfa rlieol(0trxr(r3iu4ll n ncilt  rrr(r no4oleo ictys m rln s;t)alenir iotfm rauei t tetoio3iu1apee nes sfa2umur ;t0tpto feiat sDua(vpnt) etrxf3oy1fm e ivols trumxr iodlmeelnvsl( s2rr( oou4opxn f3ildlmDuln s;(0 rxrxocta1omDe i o;s) 2xmio3oo4ope lietat) 2umurooo1apxo fciat s2emnmsnt0 lxnxo io1fa r nvil( sexrim nodlpte fcilt  rta(  ;u1tptomo3iydls el(vsn(4tlxrxo oo1lp eaueols)t2umiopnudole lfvi t  Drru  nu4optnmiciatfsDumumo;u0aeeoioctadfpD  u o;t  euoxm3iu1aptelivi s aDurxm nu0oeeomf3ilslmDelums;(0tltnmr tadfmDrluvs t  eumir3oydap e ieta( sDuaxrp;u0opxoiieiydlsDemu p;t4artnxr3oy1fa   n olt srtmirpiydlmtemnvt s)a2ra( pnu4oetnmiciys s uanms (4texomrciadfpDrlieo s seurxmpio1ope miei (f rumxm nu0olx ii3iatfm2em(ms;u0 etoircia1faDelnvs ( s2urirpny1ap emfeilsfsrtm( pnt0tlxnmiciad a2elnmp;(0 rxoifciodfatraies;() 2tmirpiu1lm  lfcta(  2uru pnu4apxo i3ild sDemn p;t0alerxf oydom ranvi t0seuoiopny1ole lneslt s2urur ;t0texnmoeiadls2em(ms u) eenxf3to1omDeauvs;s  exr(opiodomt mfeta(f 2tr(mont1tpe mietas s2umuvp t)teeomf3tydfmDr neilt  etoxm3nydoltnmfciat)srtmumpno1opxo f3tasfa2ran s;t0aeenmr iy1optelies s)seto(rpou1amtnlfcsat) Duax  ;t0oetnmieilsfm emuvont)alerxr iytlpt luvols0 etoir oy4llee ivilt)sDurxm ot1opeo f3iysls2umn pnu4alxnmf3tytfat an i (0 etrir iy1om nlnvia(f Drru pnu1tpto i3ild mDumuvp;t0 rtomo3iy1lpDeli il( trxrir oy1apee fvt s  2rrxro;o0tleo i3tat s emu s;()aetnxr3iatoaD ai s;( srurxm iydapenmnci s) Drru p;t1optomf3tytfaDuluvp;u) leomo3to1lmtelnvs;s  exriopiy4ll e icsas sDum(r ;o4ape mf3iatfa emnmp u0 exrirciodopDeluvsls) 2umxr3no1opt lfetls)aruaxmpnt1tpxnifciyslsDulump;(0 lxrif3oo1fmDe uvi;(0 exoir3iy1al emnetl()sDua( o;o1opeomocilslm2rm(ms u0 rxoio3tadlp  ln s;s sruoxo3no1optnmfvtls)a2trump;u0alto octysfsDuau o u)trerio3oytlmtr i i;(  2umxr3ny1lmt lfvsl( a2umx  ou1oexnmi3iyd a rm( p (4areoxf3oatfm eauvol(0 2um(r ou4omt mnci s a2tmur nt1tpeomfctlsfa ea(vont0teeoxociodom   n o;s  etoio3oo1ole lfcsasfaDuru  ot4oetnifeiadfmDumnmp t)tetrmf3tytfaDe ieo s setm(r oy4om elnvslt a2tax  oo4ole  o3tlt m2uluvsnt4trxoxo3tytfpD luvs s) 2xrir iy1lp  mict t  2taxmono0aex iietas sDulnvo u4 etomr3ootomtelies;s t2trxm3oo4ll e nviasfsDrmxmo;u0tex  feiys aDeanvs;t)trxnir iodlmt  nei;s0t2umir3ou1lmenlivil(  rraxr ou0tptomoetys a2umumsn(0 lxrif oodlaDeli i;t0 rxrio3io4ap n net s) 2uaur ;o4oetnifeias a rmu o;u) reomf todlmte i s;s t2tmio oodam elfci sf Drmxm no0tptnmicildfaDrmnmo (4 exnifciadlmDeli o t0s2ur(o3ou1amtemics tf 2uru o;t1oet  octyt m eluvsn(0alxrxo oadlaD lu o s0seumirpnudom  mfct (f 2trxrono4opt  feiadlsDel(vsn(4teenmfctotlmt  uei s0s2xriopou1lpen ictasf Duaump;o1tpenmoctas sDemums;u0tltomo3ia1fm   nvs;t0 exr(m ou1lmt  netasfsrumu ono1tetniociyd mDumnvp;t0tlenmf3ootfpD ln s;( srtriopoy1amtnlnvtat)arua(rp;t4tpxn oeilslm2em(vp u)arxnxrctotfa r n o t)trtrim iu4lltnlfvt sfaDtmxr ou1oee mfetlsfa rm(mp;t0 reoif3todoptelneo;t)setm(o3io1ame  nei ( arua( o;u1teen ociydfmDrmu s () renmr iatfm r uvi ( truo(rpoo1ap   iviasfs2umumpno1aexn o3iad a uln s u4arenmo ty1latrau i t)s2xo(o no4ame mfci t) 2taxmo;o0olt mociydls2emumo () reoxociydlatrauvslt0 rtmxr oudlm n fciltfartr(  oo1tlxniocild m rauvo;t4aetnmr3ia1fptranvo;s0teur(rpiu1optn fei s) 2rmxmo;t1oet iieiltlm2ranmo ()arermf3oytfa elu o;s  2tr(r3no4al nlict t)sDtmxmpoo1teto icilt a2eln o (4 rtoxocoydoatelivo;s)srtmxrpno1op elfct t)aDua( pou0opxnmieiysfaDea(von(4trxnir tatfatrlieslt0teurirpnodomte nesasf 2tmurono4oeeomfeiysfm um(mo;(0arxrio oo1lpteln slt) 2trxr ou1lme  iei () 2rrxm nt4tpx  oeiad a ulumo u4teeomfcoodomDean ilt0 2umxo3oydomtemnei t a2ua(r oo0tlto fctls m rmu p t4 lenio3oo1omDeauvs;(0teuo(r3oodll elivsas)s2rmurp;o1opeoio3iltls2elnvp;(0artoxfcia1om  aueslt) rtm(o oydllenmiciatf rrrum ot1oetnmi3tld s2uluvo;()aexomo3ia1fptelu s;(0sexr(o oydameemicta()a2rrx pou1oee  ictas m2ua( pnu0 lenxo iadoptran i (  2umxmpno4openlfci s  2trum no0tlxo oeiltlm2rlnvp u0arermf3iatomDrluvolt0trxm(r oy4aptemfcs ( srtax oot0openmietyd a rmnvo ()tetrmo oodfp rai i (0tetmir no4ame miet s  rrmxrp;t4aexnmf3tadfa rau snu0 lxrxrcoadlpt ln s;t)trtr(o3ou1lptnmfcslsf 2rr(mpou0oltoioeiysfs ul(vs;u) lermo3oydlptr iesls seurio3iy4l
\ No newline at end of file
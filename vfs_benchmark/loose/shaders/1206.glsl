@@ -0,0 +1 @@
+ivs (0 eum(o3iu4opt  ncslsf 2uaumont0ope  ieilslmDemnmo;(0 lxnir3tydom rluvs;t0trxrir3oodom e iviatfsDuaurooo1tlxomi3tytfa eauvs t0areoir oa1fate neilt) 2xr(o nudap nmfctlt) 2rr(rp;t0olx  f3iys aDrauvo u)arerxfcoytla rln slt)seumxopiu4al n fcsas srrm(r ou0ope mfcild mDuauvp;t4 lenmo oydlptrlneo ()texrir3iodlmeemfctls)aDra( pou4teeniiciltla umnvo;(4trtrxf tatfmte ueils)srumxo3ou4ap nliei tfs2tau  ou0oee  o3tysls ul(mp;() ltrifciadlaDran o;s0 euoxr3nu4ap nlnciatf Dur(r no0alxo ieiytlsDrmn o ()tetomr3oy1lpteai i s0s2xmirpoy1apt mfvtas) 2tmur ot0aee  iciad aDem(vp t)tltrxrciatfaDelieo s s2tmiopnodlm emfvsa( sDum( ont1oeeoiictad m ra(vp;t) rxoif3oo1faDr u i;t)t2umir3iydaptnlfvi s) Dumu  nu1oee  i3iasls2umnmo;()trtrmf ta1lat auvs;s  exoirpou1ameelivslt)aDururpno1alenii3iyslaDulump;() rxrmr tytomt  i ils)trxmimpio1lle lnvil()sDtr( pou4teenmoctyslaDeanvs;t) rxoxr3iydom eaivs;s)setmir iy4lmtn nciat)aDtrxrp;o0olxoii3iyt m elumpnt) eerir tydfmDrln o;(  rxm(o3nydom  mics t)s2umxrp;t4tet  fciasfm2elnvsn(0aexnxf3totfmt anvs (0s2xrxo iy4altnmies sf Dumu  ot1tetnif3ild a2umnmp t4aetoiociydlmte uvi;( sexm(opno4ol   fes t) 2umuro;u0aeenifeils a raumo (0 lenxrcto1fmDr ivils0setr(mpou4altemfesatf Dua(  ot0altoifcilt mDuln s (4tlenxrcio1omt auvo;(0s2toir nu4op   netl() rurx pou0aex  ietlt a2uluvsnu) rtrxfcoodfmDeanvs t srxoir3oo4oltelnvslsfsDrrx pnu4tpx io3iasfmDra(vp;t0 ltrxo3oydopDe uei;t)trxm(rpoy1olte icsa()s2urxr ;u1ale  oeiysfmDrlnmo ()tltnif ty1om   uvolt0t2xrirpiy1lp e fctlt aDrmxm no4aeeniieiydlsDrlu s;t0aleoxrcoo1optraueo s t2xoio3oy4lle  nvilsfsrtrx  ;o4apt iietadfm ran o;u)tetoif3oydopDrlnei s)trtm(o3ou4ap nliesls)s2rmx  ;u0opx  icilt aDranmp ()tetnmo3ta1fmt  nvils0setmxr iudlme mfvt () rurxm ;u0tlxo fciltla2ua( s;()tetrmf3todlmte n s;( trxoio ny1amee nes (faDta(ro;t0oeeo oeildlsDrl(ms;(4alxrmf3oadop  livo;()seum(opno4ll  livt t) Dum(r oo4alxn iciyslm rlnmsnu4tetrxr to1lpt luesls)trxmxo oy1al nmnctatfa2rmxmo;u1tpx ii3tasla2rmn p t0artrmr oadlm r ivo ()setrxm iu1ap  lneiat)aDtm(mono0oeenif3tltfa2eluvs t)aetnmo ia1omte uvo t0 rtoxrpoy4omtemnciasfsDrrx  ;t4altnmiciydfm2elu o;t)aexrmf tatfmDe iesl()seuoimpno4olenmnvilt) 2um(mo;u0oex iiciadfm rauvo;t0tetoxr3oo1laD luvo;t  2xr(rpnu4openlictasfsDtr(mpoo1aeen ictytla eln s t) etnxr iydomDe ivi;(0teuoio oudll nlivta(  Dtm(  ou4optnio3tlsls ranmsnt)trerifciotfmtr n o;( t2tmxrpnu4lp e fetas) rrrxmpnu1optoif3iydfa um( o;(0aetrxf ia1opteau o;s srumio3nu4lleelfet (  rum(  nu1tet  fciatlaDrm( on(4 ltrmf iadfmteln s s) eum(r no1omenmncsas)artaum no4texo octydfmDrmumo;t0tlerioctadlmtr i s t0t2xo(o3nodlltelivt sfsrurxr nu0teeoiictad aDumump;u)trxoxf3oodop rli il( tetrxo3iu1amen ivsasf Duau pnt1aetnmoeiadfa2rlnvp u)aexnmfcto1lptrauvols0texoir3oudom e ncs t sDrr(  ;t1aeeomoeiysfaDulnvp t) etrmf totlptr i s;() 2umirpiydole mfci t) Dtrum ;t0tlxnmictatfs2ua(vont0tleomo oa1lmte nvils) exriopio1lm elneia(fs2raump;u1oleoio3iad mDeln s;(0arxoio to1lpt anei t t2tmiopiu4omt  fei (fa2ra(rpnu4oexoiicildfsDel(vp;u) reoir3iodfp  aueo s seur(rpiydllenlnesasf Dumumpoo4teto iciatfm2rl(ms u0trenxr3oytlatr nes;s)s2trim oydameemnct sfaDrmxmo;t4opt mf3tas mDrlnvo (4tlxnio3tydlpt  neo;s0t2tm(opoy1ll emfctas s2rmxm nu1oee mi3iydlaDrluvon()tlxnxo ootla r neolt  rtmxrpou4ll emicsa( sDum(ronu4aeeomf3tadlaDrmumpn(0 leomo3oydoptrauei;t) eurxm iodolte nvs tfsrrrumoou4tpe if3tldlsDul(vs;u4arxomfcoadlm   ivi t) eum(opiy1ll  mnesl(fsDumxmooo4oetnmo3iydlm2eau s (0trenmo3totfp r neslt  eto(rpiu1optemiesls) rurxmp;t0alxnmo3ils m2em( o;t) lxnmo iodop  li i;t) 2ur(mpiodlp n ncil() 2tr(m ou0oeto iciltfmDranvp;u)artrmocoydlpte n sls) 2urxmpio1llenmncsasfarum(mp;u0aleo feilslm uan pn()alxriociydoateln o s0s2urim ou1olenlnetlsf rtr(rooo0aexn ieiadfaDumuvo;t4altnmocoodlp rliesl( setoio nydlm   fctat srrr( poo1aex  fcils s2umuvs t4texrmrciydla rli o;t0 2xoxo3io4ale  icsat) rumxrp;o4opt ioetltfa2umn sn(4aetoiocia1lmte ivs;t tetmxm3no1omt  neia( sruax pno0tptomoeiadfa2ulnmo;()aexnmr iydoat  u il() rum(o3iy4lltemnetlt) Dtau ooo1alx moeiyt sDrmnvpnt) rxoxo3tydfpDrln ol()s2toimpnu4lpenlnetl( a2tmuro;t4oet ifctlslsDelu onu4 rtnxf iy1lm ran s;s) 2ur(m oo1om  mivtl()aDraxr nt1texnmoctldfm2rln o t4trtoir3ootla raueils0trtm(m3nu4oltnlfcsatf 2tmx  ;t1altn iciydfs eanvo t)treomf oy1fp raies;t)srtrxrpou1llte fciat) rua(mp;t4oleniietltlm2eanmo t0areoiocta1omtraues t0srtrir3oy1lm nmicslsf ruaumoou0teenmf3tltfm um(vont4aetoio3ta1om r i s;t trur(o3nodame  fetat a2tr( p;u0aleo o3iadfa2rau p;t0 rxoxo3oatfp  aivs s seuoiopno1ol e icsls) 2rau  nt4tltoii3tad a2eluvs u0 lxrmo3totop rauvo s)srum(r nodol  lneiasfs2taumo;o0oltomfctad m eln p;(0alxrmf3oytoaD lies () 2uoim3io1llen fvi tf rtm( p;u1opeoioeildfa2ea(ms;u)trxrif iydop rauvils)setr(o3no4ol  mnvi (f Dtaxmooo0opxnmoctas s uanvp;(0alxrmocty1la rauvols)s2to(mpiy1optnlnvta(fa2rrum ;t0tpx ii3tad mDrlumo (4aetrmrcoy1fmteauvol( srtm(r ou4lp e ncia()aruax oot4oexn oeiltfaDumnvo;u4 exrir3oydlm rai o s srtrimpnudap emnvtlt)sDrm(  ;u4opx ioctltlm2rau p;u0 rtoxo totlp  aivilt)t2xo(o nydapeelncs ()aDtrxro;u0tpe  o3tysfsDrm(vp t) rtnmr todlat luvo;s0 2xr(m io4om   nvtl(fsDtaumpot1aetomo3iyd a rln o;u)aexrmr oodfaDeli o;t) 2xoxr ou4op  lies sfs2ua(  no1oee mi3iys s2ulu on(0aexoxo3tadfm eli s;t)truo(o3ou1apte icias) Drr(moou1tlxn iciytls rmnvp u)tlenxo tytfatr uvs s)texrirpoy1omeemnei ( arrrxrpou1alto iciadlm2rlnvon() ltnxo ta1lat livo;s t2xmirpnu4al n ivtlsfarrmxmono4tptnmo3tytls uanmo t)texrio3to1fa ran o;t)s2to(o oy1ape mfesa()aruaxmp;o0optn feilt s2umnvs;(0tetrxo3totlpDr n ol(  rurxr3ny4omen ncs s a2urumo;u1tetnifciydfaDul( p;t4aeenmf todlm raues;s) rtmirpou4lmtnliesls  2tmx ooo1optnifetyt a ranvpn(0alxniociydoaD livs;t setrxrpoo4lm   nvsat aDtm( p;u4apeniietysla2um( pnt4arxoirctadfptranvs;(0srxmxo iu1omee fvta(fa2raxro;o1teenioetadlm2umu o;(4alxrio3to1fa  ai o;s0texrxo nu4optemnetat arrmu  nt1tpt moeiyd m2ul(mpnu)tlxoxo oodopD li o;()t2xm(o io1optemnvsat s2tmxmoou0tlxn ietldla elu on(4altrif3todlp  luvs () etoxm no4llenlnesat)aDrax pnu0apto o3ias m2rmn s (0 ltrio iadlpDeanvi;s s2to(r3iudopt lnctl(  rrmxm ot1alx ifeiatfa2eanmpn(0 rtnxo totomDeanesl(0trtoio3oy1ol   iet s) rurx poo4tle ifctysfa ra(vpnt0trxoxrctotfptean i ()sexoxm3iodamt mnesl()a2uaxmoou1tetnmo3ild aDea( s u) lxoif3oodoaDrai ils  rxo(opny4lpen ivt ( a2urxmp;u1aexo o3iyd mDua( p t4 rerxf3todfmD  uvol()trtoxr nydoltn ncsls) 2tax ono0tlx mo3iasfa el(vs;u4 lxrxociy1fa  auvil( sexmxopoo1apt lfesa()aDtrumo;o4oetomi3taslmDuaump;u)tetoio3totoa   u o s sexr(r iydolt  fvia() Dum( pno4tlt ioetadfa uau pnt0 exnxo3tytlp  luvs;t)trtr(opoo4ol emneias)sDrmxmooo1apxn ietldfs em(vo;()tetrif3oytfaD  ieo (0t2xmio3oydll emivil( srrm(r ot0apenmfetatlsDul(vpn(4alerxr totlat  i s;t)s2xm(r3oy1lmtelivia() Dtmum ;t4tlxnmi3iasfa2eln s (4tlerxr tadfpD livi;(0truoxo oydopeeliei s)arrrx p;t1oexnio3iys mDem( sn(4 ltnio tydlpte iesl( srxoiopnydlptelieta( sruru  no0apen f3ildlsDrlu o (4 rerif3iodoatelnvo t)trxmxopiy1lmtnlneta()s2tm(rpnu0tle mi3ildlm2rm( sn(4 rtnir ta1lmteanvs s sexo(opnu1amtn nvt t)s2rax o;t1oeenmiciyd sDum( o;(4 lxriocoo1optr uesl( seto(o iy4lmenmietltf 2ta(  oo0tetnmicilt s uln on() lerio3oy1fp rau slt  2tmirpoo1ol nlnviasfsrta(rp;t1openmoetydfm rmuvpn(4artoif to1fa elnesls srxm(r3nodapte ncilt aDrmxrono0texnio3iadfa umnms;()trtrmr ty1lpt aivil(0t2tr(opiy1al n fvils  rrmxrp;t0alt mf3tltla umuvonu4aeenmociodoaDr nvs (0 etmim ny1lm n ieiltfarra( p;o1opx if3tyd sDulu s u)arxoircoatlate i o;s) rxo(rpiy1alen fei t) rumuro;o4tlenmi3ilt m2uln sn(4tltnio totfmtrai s t0 euoir3iu1ame lneilt aDua(  nt0tptniieiydlsDul( pnu0aexrmr ia1om  aivs;(0s2tm(m no1om n ictls)aDurxrpno1apx  oeilslmDemu p;t0tetnio3oo1fmDrluvil(0texr(o3iydop   nct (faDrmumoou1aetnmociydfaDuan s;(0aetnxociotfa   nvo t teuoxr oo4apenmici t sDrmxmonu4oltomoeilt a rauvp;()trtnircoo1om   i i ( seum(mpnydomtemfvil( a2taxrooo0opxomoetydfm ul( on(4 rtnxocoydoatr i o s0 2um(rpiydlpeelnctl()srurx o;o0tpen fctasls elnvsn(4tlenmo oy1om e i s t)srum(o oodaltemnvtat  Dtr(rpnt1oleoif3iad sDemuvp (4 rtrif3tytomDe i sls) 2toir nu4lme  fesa( a2uaxmpno0tlt  iciaslm ua(vsnu) rtrxo tydlp raneo t  eum(mpno1am nmnvil()arrm(  no4tltn oeiasfmDulu s;t) rermo ootfm ran o;t0t2trxo3io4ll  mnvi t s2ra( o;u1oltnifeiydlmDrau on(0areomr oydfpD an ils s2tmxr3iydlmt mici s s2ur(ro;u0oeeoifeiyt a2ranmpnu0altomrcoy1fp eaneo;s) etmxmpno4optemivslt a2trx o;t4aex mieiytfaDemumon(4 ltnio oydop  anvs;t) exo(opny4ap  mfcil(farururpot0tetnmfciaslm2umums;t)artoxfctodlpteaueo;(0 ruo(mpoy1om e nes s)s2uru pou0tex moetltfs2rlu snt0trtoxo3iydopDrai s s seur(rpoo1om elfei ()s2rrx ont1oeeoifctatfsDel(vonu0 exnxrcoa1la raieslt) exrxo io4ape  fvsas)arua(m nu4tpt  ietys s rmnmsnt4tlermfcoy1lpD lnes (0 rtmxmpoo4amt liesl()sDrauro;o1oee miciysfs elnvsn(4aexoxr3iatlpte uvi;t seuoxopno1amee feta(  Drru o;o4tpe iictatfaDuauvp () etnir oo1fpt anvolt teurim3oydal   ieil( a2tr( ono1texo octlslm2elnvpnt0tlenio oatlat lueolt)tetm(rpou1lp nmiei t)a2raxm ;t0oexnmfeiasfa2emuvsnt)artrifcoo1omtrlivo;(  exmiopiu1lp nlnvslsf rtr( pot0oee iietatla ea(vsnt4 lxnifctatoa rlnvo (  rur(o nudop e ncta() 2tmuront1aetomieiadfaDra(mo;t)arermo oadlatr n o;t) 2ur(o iydome lnviatfarrm( ooo1oex  i3iyt s2ra( p;u)arenioctatfm   ies s0trxoimpio4ap e ncsls)a2tmxmp;o1apenif3tad sDuluvpnu0 rxrxf tydomD lnesl()tetm(r iodopen nei (fartaumooo4alxomoetysfm ranmo t)aleomo3iadlmtelueslt0srumxmpiu4amtn ivils) Dtaxr ot1tltnmictadfm rl( ont4trenir oatopt li slt truoiopnydlptnlfvsl(f Dur(rooo0tpt mietyd a ea(mo ()artnxrciytoa  lu i s  2to(o iu4llt  nei sf 2urxrpoo4tpt moctadfaDumn s u0aetnif totoptr uvi;s0srtr(mpiy1alee nesls s2tm( o;u0aeenmociysls2el( s u0arxrioctotfptr ivs;s)teuoxrpiydlm emfciat  2uax oou0tex ioeild mDul( p u) exrmr todlp r uvi s s2trir iy1altn fvt ()srtrumpou0aetoiieiys s2ulu onu4tlxnifcoa1fmDe ieslt  rxr(o io1lpen icta()sDrrumpoo0opx  fetldla2rmnvp;t0teenxo oodoat an s s)trtm(m3iudale micilt arrmxmo;t1texo ietaslm rlnvo u) lenir to1faDraneo;t)seurxr oy4alt lies sfs2umxm oo0alx mfeiydlmDumu snu)trxrxo3io1lp eaieo;s) exrim3iydlle mivsat)aDraxm oo4tlt  f3ilsfs2eau pnu)artoio oodoat anvs () 2xr(o nodome  net s)aDrax  ;o0oet  octad sDuanmsn()alxrxfctytlmte i s t)trxr(m nudapenmnciat arta(m nu4ope if3iltfa2uan pnt)arermf3oytfpDe u s;t  2xr(m3nu4apeemiet s  rurx o;o0apt mfciytlm elnvo;t4aetrmfcoydfp rlu o s sexoir3iudam   fei ()arumurp;o0tpe mieiytfsDrmu onu4arxnir3io1la r ieils)sruo(rpoudomeemfctasfs2rmxrpot0openii3ils a2ra(ms u)tltoxrcto1opDeaues;t0s2tmim3oy1lltn nvtlsfarua(r ot4oet ioetat aDeauvp u0aexoir3tatfpDeaiei t t2trxmpoudam nmics tfa2rmu p;o4aptnii3ilslaDrauvp u) ltoir ta1faDranvo;t)texmim io1amt  fcs tf 2urum ou4teto i3ildfm2ranms;u0aeerif3iodoptraivi;s) 2urxo3ou1op e fcils) rtr(mpot0tpeniictadlsDeanmpn(4texoxf ty1om rlieils trxmim nodalt mivtls)aruau oou0oleoif3iytla2uanmsnt0treomo3tadfmt li i t  2tmir3iu4ap   iei ()sDtmxro;o4aee mo3iyd a2ul(vp ()tltnxo oatfatrau slt) rumxopou1lmt lics sfs2rm(mono0olxo ieiadfa2ra(vpnt)tlenio3oa1omt lnvolt0s2tmim io1ope mfcs ( s2uau  ;t4teto o3tlsls ean o t0arenxfciy1omDran i;t  etoim3iudalt lfvt sfa2ur(  no0olto iciadlsDeauvs t0trtoio3oo1fatrluei ()setoxr3oodomtemfesas  rrrx  nu4tetn feiltlm2rln p;t4tlermo tadopD  ues s)t2trxr3no4ol n fci (f Drmu pnu4aleo oeils s umnmon(0trenmo3oytop elnei;s  2tmxm3io1ol e fcil(faDua(mo;u4tlxomf3tltfaDumuvs;t0aexrif tytomt livs;t trtoxo3oo1lm  mivil(f 2uau oou0opx ii3tltfmDuaums t4alxnmfciatlmDr nei;s0srurio3oo1lpt  ietls)sDtmurpnt0ape  ictys m2ran o u4aexnio3totfm r i i (  rxoxo3nudalee ieil()s2tr(m ;o0alxnmicias a ea(vsnu) leoxr iy1latran i s)s2xrxrpiy1al emicslsfaDra( pnu1altomieiadla ulnvp;u0tlxnmf iatlpDeaivs;(  rxoxmpou1amt mietas aDumum no0aet iieiydls rl(mo u0trenmfcio1oat li ol(0 rtrxo3iy1llenlicsl()aDtax  oo1oleomoctltlm2rl(von(4arxnio iytfa raivi;t t2trxo nudalenmfeia()aDur( o;t1apenmoetls sDrluvsnt)trtrir iy1lpt aiei;(  ruoir oudlleemfvsl()srtm(m oo4olen fetaslmDrlu p;t4areoxociytomD anei t) exo(opnu1lptemivta()sruaxr ;u1oetnmociat sDrmu ont)treoxr3oo1fpD lneo;(0 2tm(m3nu4lpen ivsl() 2uaumpot4olto i3iatfsDul(ms;(4altrifctydfmtr nei t0trtm(mpiodamtnmfesat aDtmxm nt0tltniicils m2eanmpnt4tltoxf oytfm  au o ()trtm(m3no1lpt  iesltf 2ur(rpnt1olxnmo3ilsfa emuvont0artrifciotfp rauvols  2umiopnodolt  fetlt) 2uru o;o4tpeniociydlm ul( on(4 eenmf todfmD li sl( s2xoxr3no4amtelicslsfs2ua(ront1opxomieiltlm el( o t0 etoiociytla eai ol(0teurxr nydopenlfcilt) Dtr( pot4ale ifeilt m uan p;t4artrxr ty1fpt  ieo s0 2uoxo3iy1ol  lfvi tfs2ta(m no1texomoeiadlsDemnmsnt0artoxo3iytlaDraneo s teuo(o iydlp n ivt sfsrtrump;u1opxoifeiat s uaumpnu4 ltnmf io1fptean i;s0trxoimpoo1ole  fcs t a2ururpoo4tpxnmo3tldfm emnms t0trxrioctytomD luvo;(0texo(r3no1lpt mivtat aDum(mont0tetomoeildlaDrau s t) lerio ta1fm  anvo t0t2to(o3iodllt mfctltf Dtmu pot0tlxnmieiyslm2ul( pn(4 ltnxo3oatoa r u il(0 eto(o3oodlmtn nvtlt sDtaur ;u4aexn fetytlm2umuvonu0tetnxo oadlmDr neils setrxo3io1lle livt (  2ta(r oo0ale io3ilslm2ulnvonu) eenxf3oydlp e nvs;() 2uo(o3iodoltelfcsasfsDtmum ot1tex moctys a ea( p t0altnxr3iydfmD ln olt teto(r iydlm  mnctl(f rrrumoou4apeoifctasfs emnms t0areoxf3tadfmt  uvi;s  etm(r no4alt  nvt ( sDrmxmpot1teenmictytla uluvs t0aetomf tytfm   uvil() rtrio nudll   icil( srumumont4tlen feilslm ul( s t0 rtrmocty1fat  iei;t0t2uoirpnydaleemieils  2ta( p;o4aee moctls a rlu o (0aeerxf3iydlaDraues ()texmim nodaleelnetltfaDum(r ;t1ale mfcilsls2rauvsn(0arxnxfctodfmD lieo s0seum(mpoodlle  nvtlt a2ua(ro;u1aet  iciysfa umn ont)artrxrcta1oa elneo;t t2xrxrpiu4altn nesltfs2umxr ;u4aeenmoeiytfm2rmnvs (4teerio3oa1oaDeaivolt0seuoxm oo1aptnmnesas)s2rau  oo0alto fetatlsDulumpnu) rtnxo todlaDeln ols)trxo(o3iodamt  fcta(fsDuaurooo0aleo fetat m2ean snu)tetnxo tytla   uvsl() rxoir ny1lmt mnvt tfaDuax  nu1alt ifeiadfsDrm(mp;(4 eenif3tatoatr uesl()srtm(rpiy1olenlnvtlt  Draxr nu4aeto i3ildlm el(vs;u) etrmoctatlmtr uvi t0s2xm(opno1opt mici () Dtr(  nu0teenmo3tlt m ul(vo;()arxrif oadfa eluvo (0texr(rpiudap nlncia(fsDrrum ;o0olt iicildla2ul(vpn(0alxnmf3ootopDrlu s;()srtmim oy1apeemneiasfsDtru pnu1tpt  i3iad s2ua(mp;t4 lxrxrcoy1lmtrlnvil( setoirpny4olt lneil(faDra(ronu4alt ifetlsfsDra(vo;t4 renmoctytfptraiei;s) 2um(o no1alt  ici t)aruaum ou4altoifcias s elnmo ()artoxfcoadomDeai s;t s2umirpiu1oleeliet sfarurur ;u1texomi3ildla ea( snu) rerxr iy1opDe ues;s) 2uoir3oy1lp emfvta(fsrtmxr no4opeo i3ild s2ua(vont4altnxr iodoatraneols0setrxo no1apt mivs (f 2uaxro;o0apt ifeiysls rluvp (0trtnxr3tydlmDeanvo ()teumirpoy4al nlfvsat srtaum oo1texomf3tlsfs eanms t)tltnxr3to1latrauvs;t) rxrio io1lm elfcias arurxmo;u4oetomoetlt m2ea(vsn(4 eermo oo1lmDrliei;t srtrxm3ou1op  lfvt tfa2trx  ou0apeomf3iadls2rmu o t)trtnmf oytfmDeaues;s t2tm(m nu4lm nmfviatfa2umumpno4oltoiociatlsDemuvo (4tltnxf3ootfat an s ()teuoim3oodoptn net (fa2trumo;o0olxniiciys s ean sn(0aexoiocio1lat aiei;(0 exm(o iudalt mfeiatf Dumx pnt0tlxnmiciltlaDel( p t)arxnxrcoo1lateaiesl() rtrxr3ny4lptemnetlsfsDrm(m nu1tlenmi3iltfm emnvs u4tetnir iydfateli i t)t2urxm3nu1om  mfcs tf rtrxroou1opt ii3tydfa2ea(ms u)trenxf oy1laD ln ilt s2toim3oy4opt  fcs t)aDum(rp;t0apeomoetydfmDulnmp (4trxnxfcio1lmt  nes (0sexr(r3iodlpenmivsa(f 2tr( p;u4olt  ictys m2emn o;(4trxnmr3tatfa  auesl()texoir oy4lm nlivt s a2ur(mono4aexnio3tys sDrauvsn(4tlxnmr oadopD li ilt0t2urxr3ou1opee nes sf Dtaur ;u4aptn f3tytfs2uauvs;t4trerir oadlaD luvo;(0trur(rpno1am eliei s)sDtmum nt4oeen fciltlsDuanmp u0alerio iodlat  neo s0sexrxo3iy4op nmfet sfsrurum ou0alt mieiysfsDem( s t4alenmr3oytlptr iei (0 rurir iudope lfvi t) 2rrump;t1oexnio3tytla emu p t4 lxoiocoo1faD ln o;t  exmimpiudlpenmfcsl(faDrr(mont0apx mf3ildlaDeau s;t4texoxo3ia1lm rlivils t2urxr3nu1ll n nvtls)s2tm(  ot4oleomo3iydfs rl( p;t0aeermr to1fmtrlnei;s)trxmxr3oy1lm nmnet (  2ra( p;u4openifeiltfsDraums t0 eerio iadlmDe uvi t0trumio3nodll  lieias)s2raum ot4texnmf3iad m rl(vp u0tlxomr3oo1lmt  i olt)s2xo(r3nydaltnmfcsls arurxrp;o1oee ifetytla uanvp u4texrmfcoytfm r ies;()trxmxr3nodlpeelnvsls arrm(rono1alxnio3iasls2umn pnt0artomo oytfa rai o;s)tetrir oudamee ncs s aDumxronu0oeenmfeild a ranvo (0aexnmf3ootopteanes ()t2trir ou1lp  lfct tfaDrm(r oo0opt mo3iltfs emnmp ()tleoxr iydfm  aueilt0t2xmirpiu4lme  ivsl( srtmu onu0alxnifetltlm2ul(ms;()alerxf3oo1lmD  u s s0texr(m ou4llt mivtltfaDtm(  ;u0olt miciytlaDrluvont4altrmo3iydomDeau i;(0texrxo nu1lm  lfci t) Drmxm ou0opx  f3iasfa2em(vs t4aetrio iatlpte i il(0s2xrxopio1ll elneilsfsrrru  ;o0aeeomfeilt s rln on()tetrircoytoptelu ilt)s2trim io4lmen iet ()a2rru pnt0texo ieilt aDeaums (4aeermf3oy1lmtrlnvs s0srtoirpny1aptemfvi s)sruax poo0tee iieiad s ran s u0aexomf oytfpDrlieo;s) rxr(m nudam elfci tfsrumxmoou1aeen iciasls umuvp;t) rtoxo iy1fm ran ilt0trtmir oydoptemivil( s2ra(rono1oleoiicils s rmn pnt4 etomrciotom rlueo t0s2um(r iydam nliviatf ruru  no1teen o3iad m2uanvp;(0tltnxf todlp r uvs s0teum(rpoo4ol e fvtlt  rur(  ;t0tpen fetadla rm(mo () etomf3oodop ranvs;t  rxoxr3oo4aleelnvt t)arrmxr no0oex  fctydfs2umuvont0tetomo iy1opDeaueils seur(m3io4amte nvt (f 2uru  no4apt mieiysla2ean s () lermo3oatfpDeanvs;t0setm(opiudaptemfvtl(f 2umu ooo4tpenifeiltfmDumnmon()tleoif tadom eln s t0setoiopoo4omtnlivslt)arua(m oo0aetomietysfm rm(vp;t0trtnir oo1la  anvo (0seuoio ny4opt  ictltf 2ur( p;t4open fctyt s rlu p t)altnxfctatlaDelnvil()s2umio3nudlm   ivs ( s2uau oot4oeenmieildlaDeluvs;u) lxnxo oo1oa ran sl()trto(m io4ole liesatf Drr(rpot0oet  oeiyd a rmnvo;t)alerxo3to1omDean i t0t2uo(r oydopee netatfsrtmx pno0apto ieils aDemuvpn(4arxrif3tytoptraivo t)sexoxo3oy4ale lneslsfsDrrumpoo1oee mieiadfaDra(msn(0texnxr3oytlm  anvs;s trtoir3nudamenlneils  Duau ono0tlxoiiciysfa ranmo;()texnxr3iadopD  uvs;t  2tmirpiy1lpee nctas)artmx pou0altnmoeilsla rmnvpnu) eermfciy1oa  lu o s  exoxm ou4ll elfesat srtruront1tlx mociys s umu s;u) rxnmrcoydoaD  ivo;()sexoxrpiu4om elnvtl(farta(m no0apxnmo3iytlaDemn snt0 eerif iodfaDe u i;s srtm(r3oy4alt mnetat  2rrxmono0teenmicild a el(ms;u0 rtnifciodfmtrlieil( srurim3ny4al e fcs sf rur(roou1oex  oeiatls2rlnms;t4altoxr tadomteaivilt) rur(m3nudaltnlnctlt sruax onu1oex  fciadla2emu s u0tlenmf ta1fateln s s)texrio iy4omt mfet ()sDumxr ;u4open oeilslmDrm(vsn(0trtrxo oy1omt lnvols srtriopiy1lp e nvtat srua(  ou0olxnio3tlt a2uau p () ltnmr oa1lp elues;(0 etm(r iudopenlnct (faDumxm ot4aetomf3iatls2ranvs;()trxrxr io1lpDe u o;(0 euoxo3nu1lmt lnesls) rrax  ou0tpeniietyt sDrmnmo u)alenxrctodlpD ai s t0sruoxr nodlltnlicsa(  2rru p;o1apx ioctat m2ulu s;(4trtoxfciytlmDeanvi (0s2xoir3iy1lm e fvtatf rururpno4olxnmieiyd a2rmu o t)tetoif tadfmt  nvslt  2xr(opoo1llen ivia(  ruax  ou0ale moeiatfs2rmump;u)altomo oatlmt  n i;t  eum(o nodopee fvi t arrmurp;t4apxo i3iadfm2uau p;u0alenmrctotfa e ivs;s  euo(r3oy1alt mfct (f Drrumoot4tpxn f3iydls2elumo;t4arerxo oo1op  lies t  2toirpny1omtnmfvs ()s2ta(r nt1tlt mfctasfm rm(mpnt)trtrxr3ia1fpD aieo s)trxrxopoudomt micsa(  Dtm( pno1oltn fctys s2ea(vs u0aetnmo3oydopD an o s0teto(m no4opte iciat aDraxrpou4opt mo3iasfaDuan o;u0trtomr ty1oa rauvi (0sexo(o iu4om  lnes sfsrua(mpoo1alt  oeiadfmDrmnmp;u4tltnmrciodop ranvils)t2tmio io4op elnesls s2uax p;t4tle mo3tas mDean s;u)arenmf to1faD aiei;t texo(o no1ol n ivta(f 2rm(m no4tlxomfeiydlmDra(vpnu4teermf3oatfpt aueilt  eur(opoo4ameemnvsl( arrrurpot4altnmfcils a rl( snu0tetrmrcoatlatrlnvs;t)t2umxr io4lmtn ieias)a2rau  ;u4oeeomoeiysfaDrmumo;t4 rxoir3ty1lmte nes s0 2um(m nu4apenlnetls  2rrxmp;u1aetn oeiatlm2ran ont0 lerxf ootfpDeauvol(0s2uoxmpiodll   nesa(  2rmxm ;o4aetomicild m2umn s u)altrxr tytopte neslt)t2toio3nodlp e ict () 2rrxrpnu4teeomo3tls s2uanmpn(0trerio3oydoate i s s0t2trxm3ny4ap elics (faDua(r ot1tpto feiadls2rlumsn()teeomoctydfpteai slt s2toim3iu1lle mivi s srtrx  ou4aptnifcilslm uan s;t4texrmr iydlm  aiesl( srtmxrpnu1lltnmfetltfa2tmu pnt0alxn i3iytlm2ra( p;t4trtnxr3iotom ranvo;s)srxmxm3nu4alenlfci ()aDtr( pnt4tlxn feildfm ulump ()arenxocoo1lm  lueo t) rxmim3nydlmenmivtlt) 2raxr nt4tet  i3tadfs2eau p;u)aetoif3iadoatranvilt teuoir oydlptelfcsl( srtmumoot1tpe iictls mDuau snt0aexnio tydlaD ai s t0srtrxm3ny1amt  fcsa( s2ur(rpou1apeoifciysfa2eauvo t0aetnmf3totfatelu sls0srxr(o oy1lltelietls aDrmuront1oeeo oetys s rmn s t) rtoir3ootfp r ueol(0 rtoxr3oy4opt mivta(f Dra(root1opto o3iysla2rln s;t0 lerxr tadoa  livols  eum(opny1lmen fvt t) Dtru ono4ale  icilsfa umumpn(4alxnmr3iotop eauesls  rxr(r3ou4am elfcsas  rrruro;o4tet iieilsfm emnmp u0 rxomf3iodfa rau i t)t2toxopiudlp emivtl()sDrr(rpnu4tpe ifciatfmDrmu s t)tlxnmo oo1omDrlneo s t2trim3iydomt licta()a2um(  oo1ape  octldfm2raump;(4trtrxo3totlmDrlu olt0 2urio3iodol   ivtlsfaDtaxm ;o4opt  i3iytfs eau o;() rermf3oydlpt  iei s  2uoio3oo4lm emfcil(  Dtr(m oo1tpxo feilt s ea( p t4arenmfcoy1la  aieo;s0texrxo3iudal nmivtltf ruaxrp;t0ole micilsla2ranmp;(0 renxo3to1la elueolt0 ruoirpnudalt lncta(farum(  ;u1ape moetad mDea(mo;t) eerxrciydfmte i ols) eum(m ou1omeemnvsls)srra(m ;u4optn iciyd sDulump u0 etnif oadopt aivil()trxm(m3ny1op  lfcs t) 2uaum nt1oet miciys m2rmuvs;t4altnir oo1omt lnvo s0teum(m oudll nmfeiatfa2uaurpou0apxoioetysfm ea( pnu4arxrmr iodlmDrau s;t  2uoxo3iodlpee iesls  2taxmpoo1openio3tytlm2emuvsn()trxoir3ty1lateanvilt)seum(m3iu1lpenmnvslt s2rr(ront4tpx mociydfa ean p;t4tltomfcta1opD aneols s2umxo3oo1om nlfviltfa2ra(ront1oee  octld sDuln s (0tlxoxr3tytfmDr ies () euoxr3iodolt lncil()sDra(mo;o4apt mf3tat aDrl(vsnt0aetoxr3oatop  lu s;t0trxo(m nydlle  ictat  Dtau  ;u0apx mo3iysls2uaump;t0trtrxf3ootop e i o ()seuoio3io1lmt lncsasfsrtrx  nu0tetn fciydfm ua( pnu4arerxo3ta1opDrauvi ()srxm(m oo4lptnmfvia()srum(r ou0aexoif3iad mDem(vp;t0 eermf iadfat livs;() rumxo3io4amte fvtas)sDumxrpoo4tetniicils sDran s;u0 lxrmocoa1oa elnesl(0 rtmiopoy4open fei s)srraumooo0aexo ieiat aDrmn o t4aeeniociydlpDe i ols0 exoim3ou4opt lncta(fartmum ;u4oexo f3ilsfs2ea( ont)texoio iytopDrln s ( seuoxr3oo4amt  fet t sDuaxr nu4aee  ieiat m2rmums;u4tetrio totopD  neo t0 eumiopoudll nmnviat sDtr(mpnu0tlen ociysfm ua( pnt)aeeoio3iydfaDrlivo;s  2umxmpiydlmt lncils sDtmxmont4oleo o3ildfs2ulnvo (4 rtnif3iatlmteaivi ( s2tmxm nu4amenlieil(fsrumx o;o4altomfctydfa2ea( p t0 lenmrctadomt aivi;s)srtmio3oudlleemnetas srrmur ot4aee io3iltlsDeaumo u) exrif3oatlatranes s t2uoir3oo1omt lies ()aDrr( o;t4aex  fetlsfs elump;u)arermo3iydfmDr i s t0trxo(rpiy4ll elieiat  rrrxrpnu0aex  ociasfa2rl(vs;t)tlenifcoy1fatrlnvs t0s2xmxo iu4lpen neta(f rua(mpot1ole io3iyt a2rmu pn(4 rtrir oytfaDr n s s0s2xrxrpoodol e fcs (fa2umumont1aeenmfeiydlm2eluvs;t4 rxoir3ia1lpD aieil()trum(m ny4ap  lfetls  Duaur no4olt iociadfmDua(mon(0 exnxo3iodfmDrai ols0teumio3iy4olt mncsltfarumu ooo0open i3iaslaDul(mon(0trtomrcty1lm  an sl(0s2tr(r3nydalen nvia()s2tax  no0oetnmoeilt a rmnms (0 lxrxo oadlmt luvsls0tetrimpoo1llt mfvils)aDua(  no1tpenmociatlsDua(vo (0arxrircia1omD luvo;s)t2xm(rpio1lpeemneslt arrm(root0oeenifeils sDua(ms u0teerxr3tydlateaivi t t2uoimpnu1lltn nciatfaDrrx  no0tlt mo3tadfs2ranvs t4aeenmo3iotoate nvo;()sexmirpnodlm e ictat) Durxm nt0opt  fcils s eln o;(4alermr3iodlm  anvi;t0 rxr(m3nydaltelictl() 2urx o;t1altoifctydfmDem(vp (4 exomfctatlate nvs;(0trto(r iy1lmenlfcs sfa2raxmpnu4oltn feiadfm el( p t4 lenioctatfm r uvi;()trur(r3oy1al emnes tfaDrmxm ;u4apxnmociydfa rau p t4 ltnirctytomDrlu o s) 2tmxm io4am elfesas)aDra(m no4olxomietasfaDea(msn() rtomo io1optraueols)seuoio3iy4ame  ieslt)aDra(mp;o4tptomo3tatls emnms;(0teerxf3oadoat ln s;s0 etoxr oo4ll  mnviat s2rmu oou1alt  ietatfs uanmpn(0alenxo3tytopteluvo;s  2um(rpnu1apte icil( aDtmxr nu1oltnmictysfs ulnmo ()teerio3iytlmD  u ilt0truoxmpnudalt lnvi s) 2rmu o;t0aet  ieild m2umuvo (0tlxnmociy1oaDrln i t trum(r3iy4lmte nvia(fsDtmxrp;o1apx  ociytlm2em(vpnt0trtoifciatfa raneo s0 euoxm3oy4lpeemfvi ()aDrr(mpoo1ope  fcilsfs2ra( sn()aetoxr3iy1fmDr neslt trxo(m3iy4am nmfeta( s2ua(m nt4altnmociyt aDrl(mpnt) ltnxrctodfmDrlieo;s trur(m3nu4om n ivt s)artmumooo0olen o3ild aDuanmpn(4 exrmf3iatomD au i;t t2xrir nodol emfvs ()a2raxm oo4apxnmfetyd a rlnvpnu)aetnif io1faD auvo;t0s2tmxr3io1ope lfvsas)sDurxmp;u0alx ifctysfsDrmu p;t)arerxrcta1lpDelu s;t0 2tmxo3ny4am n netasfsrtrx  ou1oeto feilsfm2uan o ()texrxr iadom elueslt0 rxoxmpiu4opte fvtlt srtmxroou4alx if3ias sDuaumsnu4tetnxr ia1op  lnvsls0sexr(r oudlptemneia(  Dur(ro;t1tlto ieiydfm2ea(mpnu) leomrctatomtelnei;(0s2xo(o oo1lle liet ()sruaur oo4oexnmoetlsfmDemums;u0aexnxrcoo1lmtrlivil() 2tm(opiy4olenlieiasfsDraxmoot1ope mi3tysfa ea( o;u4 rxrxoctadlaDr ivilt trtmxmpoy1lle livs tfarta( pnt0tlt mieiad s2ulump;t4 leoir3iy1lm  lies t sexo(o iy1omtemnvslsfsrrmurp;t1tleomoeildfa raumsnu)aexoxo iydoaDr u slt trxoxrpoodam elnctlsfsDraxm nu4aet mo3tytlm ea( ont0tlxoio iytlp ean sls)trur(m io4am emfvtas srtmumono1tpx mo3ild mDea(mpn(0aetomf oytoatr u i;t  exmio ou1opee nviatfarrm(r nu1tpe mi3tad aDua(vp t)trtnmr totoaDe uvolt0setmxm iu1ope mncias srrmxmpou1oeen feiydla2ul(vp u4aetnxocty1oat  neo t) etm(m nodomt lnvtlt)sDumum ot0opeoii3ias m2eauvs u4tleoirctadom r neol(0 etmxo iydomtnmieia()a2ururp;t1tlxnif3iydfs2emuvo (4tleomf iatopDeaueo ()s2toimpiudlpenmivsas s2urumoot0olenio3tytls2rl(mont0 etnmf3oa1opDeaivo t texm(m nu4opeelfeiat s2umu oou1olenmfciys aDrl(vo;(0aeerxf3io1lpDraneols  2xm(m3ny1ol elnesatf Dur(r ou0aee  iciltlm uluvp u)arerxf iotomtrluvs t  euoirpiu4ome mnvi sf Dumu pno1oexn ieiyd sDua( ont0altomfcto1lp rlivsl() 2trxopnu1lpt mics t)a2urumpoo1oetn oetas a el( o;t4trenxociydlm rln s s) eum(m3no4al e fct ()arra(mpot0aee iieiadla2rlnmsnt0tlenxo io1oaD  iei s) 2uo(rpou4ap n nvi ()sDra(mpnu0oetoiiciad s uanvs;t)treomrcto1op e i sls)srurxopno1lme  nvtlt srum(monu1aleomociysls elumpnt0teermrcoydomDelueo;() rxoxr iodllee neia(f Dtaxm nu0ope ifeilsfsDrm(mp;t)aexnxr3iodoa rln ilt sexr(rpiu1lpenlieiltfartrx  ;o1olenmictadls2rln o;u4artnxf oadlpDranvo (0setmxrpnu4ap nlnesl( a2rr(ronu0aexnmieils s2uan onu0 ltnmrctatfpt ai o;s0 exr(r3oydll n ivilt a2rr(rono1aleo i3iad s2rauvs;u0 ltomr3todomtrlnes;(0s2toxr3oy4ap elfvt t srua(mp;t0altn feiadfa2rm( sn(4aexnxociadomtr n olt  rto(m3io4al  mfvtat)sDrmxm no0tpe iieiad a2rmn pnu4aeenio3oytlpt lnvo;t  etoir3iydop   feias)arrrxm oo1olxnif3iys a eluvo;u4 ltomrcta1omtr iei;s0 etr(m nudlleemics (  2tm(r oo0oexn ictad m2ul( snt0trerxr oo1fmD aivs;s seuoirpno1am   feilt  Duaxm ;o4oleoiiciydfa rmn pnt0 lxoxr tytoaDr uvo s  rtmxopiudlpe mneilt)srtm(m nt1tee mfetatfm2rmn o t0alenifciatomt lieo t)s2xoxo3oodomtnmfcs ( srrr( onu4apxn feiyt m ua(mp;u0artoiociodfpD lies;t)t2xo(mpiydamt  nct tfaDrr( o;o1opeomi3iatfm ulnmp u) rtnircoy1lmD  nvi;s t2tm(rpiy1lpe mnvilt sDurxrpnt1aex mieiyd mDuau s;(0texrxf3tatom eanvo s)srum(m iy1olt mictl(f rum(mpot0alenmo3iat s rmn o;()tlxrmr3tadfm  aueol( sexoim3io4olen ivt sfa2rr(mp;o0altn i3iysla ul( o;u0alenir3iatfpDrluvi s0 rtrir oodoltemfcs (f Dtr(mpnt4tpt  i3ildls emu s;()teeoif3iytlm e u s;s teumxo3iu4lme mnvtatf Durum nu0aetnii3iyslm2ulu ont0trenmf3oytomDean olt) etrio ou1lmtemicta(fsrtm(m ;u4oeto fciydfs ul(mp;t4altnxr ia1lpDelneol(  rtoir3oodoltelfctls sDuru ono1tetnifciadfa umnmo;() ltrmocoytlm eaiei t0seuoxm nu1amt miviltfaDurumoot1tlenii3ildfs2ulnmonu)arxnxoctodlp r nvi s srumxr ou1optelici t a2um(  no1tptoifciadlaDeau s;t0 lxnircoodfp   u i (0s2trim oo1lmtnmivsls)s2tru p;u4oexoiictldla2raumpnu0aetomfcoa1fmD  u i;s) exoxo3oo4olte feilsfa2raxmpou0aptnmoeiys sDran p u4tleoxfcio1opDr uvolt)t2xrim3oydape lfes s sDrmx  nt0aptniictlsfaDua(mo () lxnifctotomDeluvsl() 2uoio iudomenmneta(f Dumum oo1oex miciyt m eauvs (4altrir3oytopD  i o s)srxrim no1lpeelfet t)aDuaxrpou0oetnmo3tltfs2um(vp u4alerif oytlm r nvs () rtoirpnudlptnlnvsl(fsDum(rpno0aetnmi3iad mDemu o;()arxomr3iydla eliesl(0 euo(m3iodolte fcsat)arta(ront0opeoifciydfaDemnmo;u4tetnifcoydlaD ai o;t s2tmxr oy1ame miesl()arua(r ;u4tlxnmfetls m2rlumo t)arxomr totop e i i s seurimpoy1lp   fetatfsrtmx  ;o0aexomfciydlm2rlnmpnu0arxoxr3ty1oaD lieil()srxr(m io4oltnmnvsa(fa2um(mpot4oltnmfctls a2ranvo u4tlenxo3oodfaDe ies;s0srtrxopoo4op   neta(fa2rrxmp;u4tptnmiciydfsDran snu4tetnmo ty1omDr uvi t)s2urxopoo4apenmies s  2ur(m ;t0tee mo3iadfs umnmp;t)aeermoctydla eaivo t)srur(r nydalenlictls  rtmxm nu1oltoiictyslmDrmnms ()aeerif3iydlm   ieils srxo(r3ou4om e nciltf Dumx ooo4oltomf3ildlaDrmnmp;u0arxnmocoa1opt  u ol()texo(o iy1lm   nviat a2ua( pou0oexnmoeilsls2ua(vo;t4texrmf totoptrln s;t0t2umxo nu1apee nct ( s2rmxmpoo1aptn ictltlaDrl(vs () etnmr oo1fa eau o t)srumxo3iy4olenlivsa( s2trxm ;u1opeoiictadfa emnmpnt4arenxo iodlpDeaueo;()sruo(r nodam elnesa(faDurumpno1tlx miciatla2rlu s t0aetoxocoy1op  auvo (0 2um(opoudol emicslt)sDtrumooo1tee  f3tatlm umuvs (4texnifciatfaD luvo s s2xm(rpny4lm emnes tfsruaxmp;u1apt io3iltls ulums t0tleomf3iodfp  liesls)trtrxm3ny1optnmfcsas a2rmxr ;o1oltn oeiyd m2uauvsn(0 lxnmocty1la ean ilt texo(r3iudap  mfvil()aDrmxr nt4opeomoetldfs rmu o;(0aetomo tadla  lnvilt0t2xrxrpny4ol  mfvi s)artr(  ou1oeenifetls a2ranvp (0 rxrmr oytla  an i;s0 ruoio nodaptelivs t) rrmxm ou1texomoeiyslm2ra(msnt)tleoxr3io1op   u o;s)s2tmir3iu1lp elfvsas)aDtr(mp;t1tlx  octysfm emuvsnu4tlxrmo3iodfpt  ivils trxrxo oo4lptemietasfs2umumono4texo o3iad s rln s;t)aetrif totoa e n i s)s2xmxrpoudop  mfcsls) 2tmx pnt1tlxo oeiydlm eau p;t4aexrmrcto1op e i i (0trxoio nydomtnmncsa(fa2ra( pot0olx  oeildlmDra(vp;()teermocoa1oaDrlueo t t2xr(r3ny4lltnlivi (fa2taxmpnt0aleniocildfa eln o;t) exrxf totfm elu o;() etmiopoy4llt mfes sfsrrm(ront0apx ioctydlaDem( p (0artnmf3tydfa e ivo () exrim ou1lmeemfeias s2trxr ;o1oeeo o3iasla2ul(vpnu4arxnir iotoaDean i () eurxopiu1alenlnct ()a2umurpnt1aet  fcildfmDem( p;(0trxoxo iotfa rli s;( t2um(opiu1lm nlfeta( a2tmu ooo1aleo ietydla ea(mont4artomr oodlmtr n ils) eurxrpnudam nmicta()srrrxro;u0oee mictls m2rlu snu4tleomo oatlptr i ilt trxoxopoudalen ivt t sDururp;t4aeeo ocias s2emnms;t)tlerxrcta1la eln o ( teurir nu4ol nlfvtas  Dtrxmpoo4apt ifeiyt s umumo;()tlerxf3oo1fmDeln o t0 rtmxo iu4am nlnvtlsf Drr(root4tetoioctls a elu s;(0tltnxociotla raueo ( s2umim3nudllen nvtltfa2uaumoou4olxo ieildls2em(vp;(4 reoio3oadoaDrli s;t0truo(opiu4lp nmfvsl(  rrru ont4aex  ictytfsDrmu p;(4alenxf ta1fatelneils)srtmimpnudalt mivt t  2taxro;u4tet mfciat s2umn p u0arenif3ia1fm e uei;s s2to(mpio4oltnmicil() ruaum nu4tex  octldfa rmn snu0 etomf ty1oaDr i sl( sexoio iodamenlfci tfs2rr(rono4tpxo feiad m ua( s;u4tltnxr oa1omt  uei t sexoio3iydal n ncil(  2umu o;u4opxnif3iltfmDemn pnu4teermrcty1lpDeai slt)texoir3iy4lmen fvtltfa2trx poo1olxomietadlmDra(mo;(0 rtoif3iydla eauvils)srtrxo io4ap nmfeia(  Dtau  nu1tltn fctlsls umump;t0aeerxr3iadlp  anvols0teur(rpiudlltnlncta() rtr(r nt1oltnmi3iad m2eln p t0 etoir iotla rlivi;t)s2xrio3oodalte icslt s2tm(  ot0tptomoetydfm rlnvp;u0 lxrmo ty1fp eluvs;s) rxo(o oydlp nlfvs s) rrm( pno4teeomoctydlm2umuvp;t0aexomo iotoaDelivolt)trxoim3io4lle lfei ( aDurxroot0opxoif3iytfmDrmnmp;(0alermrctodlpDe ues;s  eurio nodapt lncsat) Drr( oou1altn f3iat a raums () ltnxoctadlpt li sl( trtrir3oudll elivs ()s2um(moou4tltn fctysfa2eluvo u0tltoioctodfm r n ilt0 rur(m3nu4amt mfcsas)arrrx  ;o0aexniocildls eln s u4 reoifctodomDr nvi;()t2xrimpiu4om  mivs (f Drm(moot0apx ifctasfmDumuvs u0 rxrioctadoaDraues;t t2uoir3nodoptelnes s)s2raurp;u4tetoiietytla rlnvpn(4 rxoxr tadlptr uei;t)trxoxmpoo1amenmfvs s)artaum no1apt mfctasfaDelump u0tlerxf ia1lp  lu i;( t2xrxm3iudaltnlnvsatfa2truro;u1tetn f3iydfs elump;t)aeenio3tatlat an sl(0s2um(o3oodll nlfvsl(  rrr(mo;t4texnifeiasfs2rauvo (4aetnmrcoa1lp e u ols0srurir3oydoptnmici tf Draurpot0ole ifctltfs2rmu o;t)artrxoctydoptrlivi;s)s2tr(m3iydopeelictas s2rm(m ;o0oetn ociad s ua(msnu)aetnxf3oydlpDe nes ( t2xr(rpoy1amtn nesa()artau pnu1tpeo feias m rluvp t) exnxr3iy1optrlieils t2umxrpnu1alt mictatfaDumurpnt0aet mieils m ulu p t4artnxfctydoa  lu slt s2xr(o iy1apenlicils)sDta(mpot1aeeomfciatlmDumn p;t0tetoxo iatlp  aieil() rurxr3oydlptelieilt) rtaxm ;o0apxn oeiysla elumo;u) eeoircoatfpteai o;t0srxrxo3oy1oltnlfcsas srtruro;t1tetoiieilt sDemums;t0trtrmrctytlpDelueilt0 rumim3nu1optemfcs tf 2tm(mp;u4tpxoiicils m uanmpnu0aeenmr3iodfmtraneils0srxoio3ny4ol e nvta( a2tmumoou0tet mieiad aDuanms;t)teermoctadlpDraneo;(  2xrir3iudolenlfviltf 2ra(root0aee ifciytfs2rlumo t)treomrcoy1fp rln i ()s2tmxo3oy1olte ncils sDrrxro;o1tpenio3ildla elnvo;()tetnmo iatomtr n ils0s2uo(o io4lm   fvtl( aDra(rpnt1apxn fetyt a2ua(vo t)trxnmr oytfaDr ivs t trxo(m ny1apte fvias  rurx  ou0oeen i3iyslsDrauvs u0 rxrio3tydfpDr iesl(  exoxr3iu1altnlieslt) Dtru  ;o1aptnii3ildfm ul(vs u4aleoxfciadlpDelieo;s) rumxo iydom nlncsl(fa2ta(monu1ale  o3iytlsDrlnvo ()trtoir3iydlateaueils)setm(opiy4lptn nvsls a2urxr no1aet iieildla el(von(0 exrmf3oydop eluei ( sexrxopiu1ameelncs tf 2ra( pnt1apx mfeiydls ulumo;t4 eermrcootlaDeau sls  eurir nodomenmicsls)s2rmumo;u4tpto fetydfmDeanms;u4arerxrciytoaD  i s;t0sexoir3io1alenmnei tf rumx ooo0aet moetydfs rln o u0arxoif iytopDe ivil( t2xoxo3oo1al   fesa(f rrau oou0tetoiietytlaDrmumonu)artrio3iotfm r u i t)seto(mpoy4ome mivi (fsDum(  ou1apeomoctatla eanvsnt)alxnir iatoaDran ilt)srur(o oo1lleemfviasf ruaxrooo1tee  f3iyt aDemums u4 eeoir iodfp  lieolt)trurio3no4op nlics () Dtau p;u4alto fciltfsDran snt)tlermfciotlmtrlnes;t t2tm(opou4opeemfetasfaDrr( pno4tetoioeiyslm em(vp;t) rxrmr3iotoptrlu i ( sexoiopnu1lmtnlfct tfsrrmump;u0apxnmoctatlmDrln p () ltnxr ty1lmDrauvils tetoxopnu1ol   ict ( s2rm(root1opxnifetydlm2ulnmo t0trerxfciadfpDrlneslt  etrxrpnydlmeemivi s)s2taumoot0tpxomoctytfaDuln pn()teermfcoy1lp eluvi t0s2xm(r3io4lp nlnetatf 2ua(m nu1tpenmfeilslmDrl(ms u)aetrmf iytoptraieo s0texmio iy4lle lneiat)a2ta( p;o4alxn i3tasfa rmums t)tlxnmfctodlp e neo (  2uoxm3iudlp nmivtas  2tmu p;u1oetoioeiatfsDum( pnu4aetrif oodlatelnvolt0 rxr(r nydal n ietat)s2uaump;t1apeo i3tyt a2elnvo (4texnmr3io1lpteli ol(0 exmxm no4lm nlicta(fs2rmx p;t0opeoifeilslaDelump t0 rtnmf3iydoa r nei;t0 2tmir3iu4lmt lncs t s2tr(rpoo4aleo fciad aDelnvont0treoxr oatoatrlivi;s0seur(o no1alte nvtasfsrur(r ;u4tltnmociatfa ea(vp t)aetnmociatfptr n sls) etr(m3iy4ol nmfvils aDuaumono4oexoifetldfm2elumo t)alermocoy1fpt liei (  rtmxr3ou1ll  lncsl()aDtrur ;u4apxnmieiytls2el(mont4aetniociydoa   ues;t srtrim3iy4op  lnvsl()s2tm(mo;o0optoifctlslmDrmnvp;(0 ltnif totfp eluvi s sruo(o ou1optemfctas  Dta(r ou0apt  iciysfsDemuvo;t4 ltnio ty1om rai sl(0srtr(opoodlpt mfci ( sDta( pnt1altn fctlsla2rmuvp t)teeoxo tydfatean i t t2uo(opiu4om nmivtlsfsDtr(rpnt0openmi3ias aDrmn on(4 rxoxo oo1laDrlivo ( sruoir nodome lfct (faDra( pnu1tlen fetytlm2ulu pn(0 rxoxr oadfm eluvo;s0sexr(r oo4lpenmictlt)aDtm(m no4apxn f3iyslsDrmuvo u) lxrif ty1fpDr n o;()s2umimpnodlme lnctatfartax ono0altn fetlslm el(vo;u0 etrifciotlp r ies s0trtmio3ny4lltemfctlt s2ra(r no0aet ifetytls2uaumsnt0alxoifcta1omDrau s;s)truoio3io1ap n ivsa()s2rrxm ou0texnio3tls m2ea( s ()arxnmf iytla e uvi;s)texoxr3nydlptelfvsatfartr(mo;o1tlenmocildfm ranvs u) etomociydfp  aues;s) etrxr io1lm nlnvt s) 2rmum nu1tptomfctlt mDrau snu4trtnmoctatopt  i sls)t2xrxopou1opt mictl(f Drm(ro;u4aptomoctlsfmDel(mp;u)texoxfctydoa r nvsls t2umir3oodll  lfeta(f Drmu pnt4ope  i3tasls rmuvonu4tetrxo oo1fptrau sl() 2urimpou4ame lneslsfsDur(rp;o0olx iieild a ranms;u4arenmfctadfp   iei;()s2xoimpny4apt  nesl(fsruaxmpnt1olx mfetyd m rmn o;u4arxrxo3oatopt  ivilt)srxoxm3iu1ap e ivsl(f rtru  ot1alt mfctldlaDemump t)tetnxo3oadfmDran o t  rxoio3iudam nlncslsf Dururoot0aet  oeiatfm2elu p;t4 etnxfciydomt  uvs t)srtmimpnudaltelnetltfarumuro;u0oex mocilsfsDul( onu4 eerir3tadopDrlieo s0 etrxo3iy4olt lfvtl(faDrmu pou1oexomfeildlsDeauvo (0aexrmf tytlp rlieilt texr(o3iu4lpeelietas arumxm nu0aex  f3tld a2eau s u)arerxf3totlp rlivsl(0t2xmio oydll elfviasf rtaump;o0aeeo f3iydfa2el( p;t) etnmr oa1fatrauesl()s2uo(r3io4amenlfeiatf 2raxrpot0alenmoctlsfm2ra(mp;t) rxoircoadfpteli sls0t2ur(r oy1lm e iesasfarrmumo;t1tpe ioeiatfmDrmn ont0tlxoxfcoodla   uvo;(0 rxr(o3oy4op elfcias)s2umurpou1alt if3iadfs2ea(msn(0alenmocoadfpDr ieo s)setmimpoo4lmeemiei (f 2uru  nt1tpeo oeiltfm ea(mp;t4alenif iotoat  uvs;s0srxr(m iudoptnmict ()aDta(m ;t4ale if3iatfa rlump t4tetrir3oa1opDeluvslt0trurio ou1altemivilt) 2rax  no4aetniieiatfs2eln p t0alerioctydoa  aivi;t)seuoxrpoudomtelfvt t)artm( pno1aeenifctydls2ea(mp;t0altoxo iotlptrauei s  euoxm3oy1opt mfcsa() 2uru o;t0tle ifciadlmDrm(vs;() rxnmr iydoaDe nvs ()sexmim nudllee fcsa( arum(rpot0alxnmoeiysfm2ran s u0aeeoio oytop r i ols texrim ny1lm e ivsat) 2ta(  nu4tlenii3tasfsDuan on()tlxniocoodlpt  nei;s)t2ur(mpnodlltnmics tf rrm(mo;u4tpe ifetasls2um(mpnu)aexrmo3ia1op r u s;s0t2xm(mpoy4open ivias) rumu p;u4olxomo3tlsfs eau o;u4aexoxrctydfaDeanei;s0sexo(mpoydoptnlnci () 2ra( ont0tltniietys aDrmu o;() rtnmo ta1la rau olt trtoxr iy1altn ivi sfsrtaumo;o0tpxoiieilsla2uluvp t0aeenxfciatom r n i ()trtmxm nodoleelieslt arurxmpot4oetnif3tltfmDul(mpnt4arenxrciodlmtrlnesls0 rtr(o3no1ape mfvils) 2umxrpoo4oet ii3tysfa ranmo;(4teeoiocto1opDraneo t s2xrxr3nu1lle lncs s)arraum no0tptoii3iys s ua(vp;t) rxoxf3ta1fpDe i o;s0trxo(m3ou1amtn nct ()aDua(m ou0altoiiciad mDrl(mo;t0 eenifctodopDr ivils  etrxr no1llte nvi ()a2tax ooo0opxnio3tydfsDum( o;u)aetnxr3tadfp eluvo;() rum(r no1alee nci s)sDtmx  nu1tetoiociys sDrmn s;u0aeerxrcootopDr uvs s teurxo oo4op  mfvilsfa2rr(mp;u4aexomoctldfm ul(mp;u0tlxoxocoatopD livo;t tetrir nu4al nmnvs s srra( oou4aet mf3iltla emnmo;t4artrxo3todlmtrlnes s) exmimpno1llt livtas) rrmur ;t0tpxomi3tyd sDean s;t0 ltoif3todlaDe u olt seuoxo no4omt  ncsat) Dumx  nu0olxomi3iltfs2rmn s t)arxoio iodoaDr uvi;t) rtmxo3nu1al  mfeilsfa2tr(ront0oetn fetytlaDrl(mp;t)alerxociotlm e neo;t srtrxo3ou4amenlici sfs2uaxro;o1altoio3tysfs ul( sn()tetrir totfpt  ivo (0srtmir oo4llee netasf Dumu  ;u1ape ifetysls eaums u4teerifctatfmtraieils)t2ur(o ou1lme mivta(fartr(mo;t1olx  ociyd a um( on(4 rxnirciodomD lneols0s2um(mpoy4apenlnvslsf 2uau pnt0tlenifeiydlmDranvo;(4 ltrirciy1la  auei;t  exr(r3iydop elnvt tfsrrr(mo;o0oleniieiad m2uln p t0trermf3oodfaD luvi;s0 rtr(rpno4ale lnvilt)srtr( pnu0oet  i3ildfm em(mo;t0arxnxf oa1opt an ilt0trtoir3io1ape  iet sfsDtaur ot4tlt mictyd s rmumon()alxomo oatlaD lnvi;s  rxrimpoo4alt lnvsltfarrr(mo;t4apenio3iytfaDumn ont)alxoxrciy1oatr nvs;t t2xmxrpoy1omenlfvi tf 2uaxr ou4opx iocilsfm uln pn(0 exnir totoat  u i;s)s2uoir3oo4ale  ieil()a2uaxmpou0aex  ictyd a uan p t)teermr3io1fmDran o;(0t2umxm3oydale lfcil() rrr(mpou1oex  oeilt a2rmnmonu0alxrif3iydfm eli slt0 rtrio ny4amt  fcsl(faDrmxro;t1aeen iciatla ul( o u4 eenmo tydlmDe nvols srtrxo iydal elfvi t)a2uru o;o1alx  i3ilsfmDrmuvp;t0arxrmociodfpDeaues;t)teurio io4omtn netl()arrru pnu4oexoif3iaslsDul(mp;u0tetrxf3iotoaDeli o (  2tmxr3no4altn fetlt) ruauront4tle ioctls mDem(mp t0tlenxr oytfa  aieil() eto(opiu1omtnmnvi s)artm(r nt4oleoifeiydlmDrl( onu0aeenxr oodlpt  iei ()teuoir oo1lpeemncsa()srrmu o;o0tpxn ociltfa rm(ms;u4areoif3iytlaDranvo s0srxr(rpoodllt mieilsf 2rm(  ;o0alxoifciad mDelnvs t0arxomf3ia1fmDr nvs;s  ruriopio4amenmnvi s)s2taumo;t1tpt mieiatlsDemnms;() etnmr to1fm r nes;t) eurir oo4omee fci (fs2urumonu0aleomfciytfm2emums t0 leoxf ty1fp  an i () rumim3io1lle mnctlsf rra(ro;o1alx iietlslaDemu p u) exoif ty1om  lnvs;s  rtm(r3io1open feiasfsrtmx poo0altoiieiyslaDumu s ()artrxocoy1lmDr uvo;t0 exr(r3iy4opt mnesasfa2tmx o;t0oltn ictas aDrl( ont0teerif ty1fpte n il(0srxr(o oydol e nvsl()s2tm(mo;t0oetn feiaslaDel(von() eenxrctytlmt aivs (0texrxmpnu1am e net tf 2ur(  nt0altnmi3tatfmDra(vpn(0trtnmoctatfmDrliei;t)s2xrxr3nu4lpeemnvia()s2ta(r no0tpx ioeiytlaDem(vo t)aexrifciatlm rlnvo;() eto(m oy4lmtelnesl( srtmxr ot1alt mo3iytfaDrau pnu4 lenmr tatfpDelu o;t t2trir nydome  ics s srrm(m ;t1tetoii3tydla2ul( s;u)teenif3oadom  ai i;s teuoimpiu4olee fetlt)sDum(rooo4olxnifciltlmDelnmsn(0 lermo3io1oaDraueo (0sexm(opno1lleemivi sfsDtrxm ;u1opxo f3iadfs2umn pn(4 lenio ia1fa r i o s s2to(opiydllt lfcta()sDrr(  ou0tltoio3tldfm eln p;() reoxfcty1fa   uvo s)s2tr(mpny1amen ivil(fartmuronu0aexnmf3iatfm uanms;t0alxrxf todomtranes s)srto(rpoy4apte fesl( aDtru o;u1oee  o3tatlmDulums t)tltoio3iotlmt  uei s  rtmxmpiy1ale micsltf Dua( poo1apt moeiad s um(mo t4alxrio oydom  lu ols)trtmimpny1lpt  nctas)arumur no4opxn i3tltfmDuanms;(4aetnmf iydoa  auvo t0teumxopiudlpteliet t) rtaurp;t1tlxnmiciatfaDrmuvsnt)alxriociotomtr nes (0teuo(opiy4apt  ncs ()srtmurp;t1altnmfeiltfs rluvs (0 rtrxrctytfmDe i olt srxrxo ny1ll elietas  2umxr oo4tlt  oetls m2elums u4aeermf3oytfatraivilt trxmxr iudlp  liesas) 2ururpnt0teto ocilt a2ulu onu) renmrcoa1oa rlieols)srum(r3no4lmeemivtlt)sDtmxmpou4open f3tls m2umuvp t4tlxnir tytopDeaneolt  rur(r3iydap emivs tfsDurur oo0oeenifciydfs ua( s t4 leoif3to1fptrai s;s  rxoxm io4ll elnviltfarrmu p;u1opt  oeiysfa2eaump (4 renmf3oatla e nei s  2toir3iy4lp nlivt s artrum nt4openioctatlsDumuvon() eerif oy1lmtr nvol() eurxopoo1ll   nct t s2ua( p;t1tltnifcilsfs2rmu s;u0treoxrcio1fm e ivil()sexo(m3oudolen nci s)aDtmump;t1aeto fetatfm2rluvp;t) rtnmr oydlm  luvs (0sexo(m3nu1alt lncsatfa2rr(  ;u1tlto o3iltls eluvo (0 eenxr iatopteai o;s) rxo(r nydop  livils)aDurumoot0tetnifeiatfm2rmnmp u) etoxr3ia1fmt  neolt srxrxm nu1ll   ieil(f rtmxm ot1alx mociasfm ulu ont4trerif3iotfptraieols0texmir iy4opee fet () rra(  oo1optnmoetld sDrm(von(0tlxnmo3tytomDr i s;t tetr(mpio4amt  ivsatfa2rru o;t0oeenifeildfsDean sn(0alerir ia1oatrlneo t)srum(o3ou4lptn nesl()a2urx ooo4alt ifctatfa2rauvp;u4aeerxf3ia1lpD  ivi ( t2toxr iy1oltnlfvs t)aDta( pnu4texoiieiyd s el(vo u0 eenir3iytomtelivolt0 rxm(opoudope  icsa( a2rm(r ot4alt iociad s rmnvsn(4treoir3oatoa rln o s trxrim3no4op elneil(  rraurp;t0aptn fetydfm eau p;(4 eermo3oytoa eli o t0teum(o nu4ope mncia(faDrmxm ou1oleo ietlsla ulump (4aetnxf3iodlpDrai ol(0sexmimpou1llenmfvt s) rra(mp;u0tpt  oetytfa2ua(mon() rxnxrcoydopDraivi;() eurxr oy4op emnesa(f Draxr ;u4olx iicildfa elnvo;u0 lermr iy1lpDe n i;t teuo(m nudlpte ieils)arurumooo1oet  ietlt sDrau s;u4trermrcta1latrai s ( tetm(rpiy4apt mneiatfaDrrx o;o4ope ioeiydlmDuauvp;t0 exoxr oydfm   i i;(0sexoio3iu4opt  ivs s)aDraxm ot0texo icild s2ua(vo;u0altomo oadlp ranvil(0s2xoxo3iodopeelicsasfsrua( ont0tlt iociasls elnmp t0artnmf3oa1oatrli i (0s2toxo oy1opt lnviasfa2umxrpnu4apenmietld a rlu p t)alenxo3to1laDr nvs ()srtrxm3io4ome lfcs () ruaumpot4ope  ieiat m rl( o t0 exrxr tadfm r uvsl( texmiopno4lmtn net s srtr(mpno0tptn ictyt mDeluvo;(4artnir3iy1lp eaues (0seuo(o nu1opte ivia()sDrm(r ;o4olx  f3iys m2ua(vs ()aetrmocio1op eaieo t)srxmim3ny4opee neiat  rrrum nt4opto f3tldla2em(msnt0arxomoctydlmDeliesl( seuoirpoodlp nlfvtas)s2rrx  ;o1ale ii3ild m2emn o u0 eeomo oadfp rlneo s) 2xrim3iodal n ivsls s2taurono1aptomo3tadfa ul( ont4artrxfciotfptraivi t0tetoirpnu1ape mfcia()srtru o;u4tlxnmi3iys mDua( s t4tlenmrctytfp  lueo t)sexm(opno4apeemnet sf Dra(monu1altoifeildfm eauvp u) rxnif oatfp elivils0sexoio iy4am   nct t s2ra(monu0aptnmfciasfm umu o t)alenmr tadfpte nvslt)srtr(o oo1am  lnctlt)sDua( o;t4teeoifeiysfm ulumo;(4 leomf3iadfm   u i;t0 rxm(rpou1lltelfvia()aruaum ot0tpen oeils mDuauvsnu)trxoxr to1latr u o;s  exmxr oy1optnlfvtl( sDrmxmp;t4oeenifctasfm ea(mo;u0alxrxo3ty1fmteau i s)s2toxr ny4apee fvi tf Dur(rono4tetniictlt m2rmn snt0 rtoxr3oa1op e u s;( s2toim3nydomtnmnvslt) 2tm(rp;o0aet  iciytlm2ea( sn(0 exomfciy1faDrluvo;t0 2trimpio4om   ieslt)arraxmpnt0tex mi3iltlsDra(ms t)trtnxo3todom rlu s;( teto(o3iodalenlietasfaruax  nt0tex  i3tas a2el(vont)alxnxf oo1opt lies;s0srxrxr oy1apeemncta(fsrtaumonu1tpx ifeiytlaDrln pnu0 etrxo ia1fp   u s (  rtr(r oy1lp elnesltfa2urum no0oeeomfcias a ulnms;t0 etnir iydfm  anvs ()s2uo(opiydalte fvsas  Drm(rono1alt  fetaslm2eanvp t) rtniociadfmD  nei;(  2xmxm3iy1op e iviasf Dtm(mp;t1alt  f3iad a um( p;u)alxnir3oatfm eai sls)tetoim nudope  ietl()srtax onu1apxn ieils a2emn p;t)trxnxr3iatlaDe ivs t0texo(mpoy4op  mnvtl(f Duau o;u4tpxnmoctyt m2rm(mo;()altrxoctatoatranei ()srtoio ny4olt  fvs ()arurx  oo0opxoif3tasfs2elump;(0 rxnmociotfp   u o t0 etm(m io4olt mfvia(  Durxmonu4aexomi3iatfa uln s;u4 rxrmfciatfp e u ols)setm(opou1opt  ivsat) Dua(rpou0aexn fciad m ua(ms;(0tlenir3ta1laDraivs;t0trxm(m iu1ol elfvsltfaDrm(rpno0aeenifctld m2rmu s u0teermo iytfmDr ues;t)srxo(mpoo4lmtnlfci ( sDtaxrono0oltniieiydlaDumu pnt0 lxoxr3oo1fptraueo;(  2trimpou4omt miet ()srraxmo;t1ape  i3iyd s2uauvp;t0tltrio3oo1oa e ivo t t2urio3ny4ome  ncsa()srta( p;o1teeo oeildfm ranmo (4trtomr3iy1oa e i sl( trxr(r3ny4optelici sfaruaurpot4aetnmo3tydlm2emuvs (4tlxrxf3oa1lmt  nvs;()s2tm(m3ou1ol n ieia()arrm(ro;o4altnmieilsls ul( s ()alxrmrciotoa eanvolt0srtoim oudam nmietls  rtrur ou4oexoiociysfsDumumonu0 rxnirciydfpt livo t) exmimpny1optn fvia() Dua(mono1alenmiciyslaDumnvsnu) ltrmo3oatla rlu ol( srumxm3iodlp  mncils  Duaurpno1aee  o3tld m2emnmp;t0trtoxo3oytlaDrluvi s s2toxr oodlmt  fet s arur(m ;o1ope  ocildls2umnvo;u0tltrif3tytfat auvo;s)srxmxm nudale lietat)srur( pnt4tpt iictld m rmu p;u0trtnmf3iy1laDeaneil(0s2trim3iu1ame mivsas)aDta(root1aetoif3iytlmDemums (4trenifcoatoat  ues;t texoxm3no4amenlivta() Dur(mpnu0olenmoetldfs2em( p;t4alerircio1omte ies;( t2xrxm oo4omt micilsfa2urx pou4tex mi3ilsfm2em(vp u4alxnxr iytfat  ivo;t0 rtrxr iodam elietl(f rtaxmooo0tpxo octydfm ua(msnu) rxrif iy1lm raivolt)t2xrxmpny1ap nmfci tf Dum(r oo1altnmi3tasfs2ua( ont)teeoif3totomt  ieol() 2trxr3oy4llt micta( sDtm( ono1alenmieiadfaDrm(mp u4 ltoiocoydlp elieo;s0teurxo iydaptnmfvtl( s2tru  no4optnmictlsla2umnvo ()aeeoir3oy1fmte u sls  exriopoudame lfciltfsDtmum oo1tlx mi3iatfm2emnvo;t0arxnir3todfpt ai i;t0s2xrimpoy1op  lictat a2uru ont4opxoiociyt m rl(vo u0teeomo3ia1fmtrlneslt)texo(m3no1opt  nesl()s2ra( pno4aetnif3tydlsDrlnvp u0tlxomocia1op e nvsls) rurio3iudapte ncilt) rrauro;o1opeoifctytfsDrau pnt4 etrmfcia1oatraieils)trtriopoudam emfeilt)srrax  oo4aexnii3ias mDrlnvs;t4tleoif iodom  ai o;() exr(r3ou1apenlfeiasfarrmur nu4apt  oetldfm2ra(vs u) exnxo iydlpD  ivo s tetmxopiy1omt mieil(f Dumxmpnt0texomfetlsfa emnvp;()alxnxo3todlmtelu ol(0 2xm(o no4alee ivtas  rumxm ;u0ole  ietlt sDuau p ()teerxo oatoa eaieo s) eur(opoy1lpenmfcs tfaDrrurpou1tle ifetaslsDean p u0 rxrmr3io1fp  luvslt s2xoio3io4lpe liesa(fs2tmur oo1oeenmiciyslm ua(mp;(4tltrxf3iy1lp r n o ()trtoim3no1lm  lfet s)s2umx pno0tlxn o3ilsls emu s;u) rxnmocoatfaDeli ols)t2trio iodame livias)a2tm(m nu4apx moetasfm2um(mp;u)artoxociatoa eanvi;s s2xrim oo1lmenlicilt)artr( ont4opt micildlm emuvsn() ltrmo3iy1lmDrauvi (  2umir3ou4ole mnvtasf rurxroou4tleoif3ildfaDemuvs t)tltomr3to1lpDrlueols s2to(m3ou4ll elicsatfarrr(m no1tet mietltlaDrmnmo t4 etnmocty1fatelnes;s0 2tmirpnydam nlnvsas)aDtrump;u0oet io3ias s ranmo u4 eenio3io1omtrlu i s) ruo(opiy4ape micia()a2rru o;t4aeenmfeiad a rmu s;(4teenmocoy1opD auvils)srxoim3iy4lptemnci t s2uru p;u1tetomfetldlm rlu o;t0 leoif iytlpDrau ols0 2tm(mpio1om  mfvt t)srtrxr nt0apt moeildfm eluvp () eeoxocootoa eln i s)texm(m no1lmenlnciltf rua(rp;o4olt moeilt a2ulnvs t)tlxrxr totfmDeau o s t2uriopiu4op   ncsltfaDra(monu4aexoioetldfm2ulnvo;t)aeerxr3oydomDran s;( srtmxr oudlp emncil( sDtmu o;o0apt mfctas a2ra(vs u)alxrxf3totlmtr ueo (0trtrim3iudamee fct (faDtaxrooo1alxo iciysls rln on(0aexoircoy1lpt ai i;s trtrio oodopeelieiat)s2taum nu4altn feiydlm elnms (0 rtrifctodlmDelneilt0 2xrxrpoo1oltnmiei t) Drmx poo4altoio3tasfa2ulu pnt)trenmrcio1lpD livolt)s2urio nu4ale  nvs ( srrmu  ot0tee  ietatlmDea(vs;u0altoxr totopt lieo;s) 2urxrpnu1ol nmfvt ( a2ta(m nu0tpxoioeild a umnmp;t0teerif tadlptraies t0t2xrxmpou4open iet () Drm( poo4tpx mf3ilt s ranvonu)aeeomo oodlmtelnvi t0 2tm(r ny4lltnmivsls) Dum(  ;u1tee ifeiytfm2rau p;(4 ltrmf iydoateanvsls)srumim3oudop  mfcias) Dtru p;o1tex  fctas a emn p;t4 renxoctydlat auvs;s teum(mpnudamenlfcils  2umx oou1opxn o3iytlaDeau s;u)alxnmrciy1lmDe ivi;t0s2uoxm3nydapt  fvslt sDum(mpnt0olt  o3iatlm2el(vsn() etnmr3ia1fat luei t)teto(m ou4lmeelnet t sruaurono0alenmocilsfaDranms t0texoio oydlpDraueolt0t2xoxr iudlmte neta() rrru p;o4oexnioetydfs2rlumpn(4 ltoxr oytfaD livi;s)teur(rpiodllenlieia(fsDumx pou0oltnifeils mDemuvs;(0aetrir ta1fp  lnvs;t0t2xoim oydlle licsl(fsrraump;t0tpxomo3iat s2emnvs t)trxrmfcia1latranes;s trxo(r oudlpte fcs t) Duau  ;o4olenmictysfm rmumonu)tleoirctadopte ueo;t)t2urio3iu1apenmnesl( srurump;o1tlto ocils sDelu o;t) etniocio1fm eaiesl(0t2toxrpnydlp emnvs ()a2tru  ou1olt moetadla2emump t4 rtnmf tydfaDe ivo;t)trurxm3nu4amtemfeiltfs2ta(m ou1tlxnmi3iatfm2rm(vp;(0aexrircoy1lp
\ No newline at end of file
@@ -0,0 +1 @@
+nes ( tetm(m io4ap elicias) rrmurooo4oetnif3iatfa2ua(vs;t) exomociotopD  n s t setoim3nu4op e fvta( srumx p;o4oet mictltlmDuluvon(0aeenmo todlpDrlu il( trtrxr io4opt mieiltfsrrr( ooo4oetniiciaslm2rmu s t)trxrxf3oatlmDr uei t0trumir oy4om e ivi t sDua( pno1texomf3iysla ulnmo t4texnio iotlpteau o t  etoio nudopt  fvil()s2tm(mont0oexoifeiltlaDeln o (4 rxoxo3to1lmt livslt) rxmimpoodlmtelnei t a2uaxr ;u4tpxn f3ildfa ra(vpnt)trxnxrctotlpD lnvo;( s2urim iy4lmtn ictlt arum(ro;u4olx mfeild m2emu s () eenmrcoa1lmt ln il(0texo(m3iydalte fvs () Dtr(  ot0aleniiciysfaDumnmpnt)aleoif3oatop  lu ils  2xr(opoy1omtemnvi tf rum(rp;u1aexn feiys a emuvs;t0 rxrxfciotlate ieo s)sexoio3iy1oltnmfvtat  rtmu ooo0tltn ietld m elnmo t0alerxocta1la   uvsl()srumxr oudape lneias) 2rmx  nt4altniieiytfs umn s;t0 rxnxociytopte uvo t)seurxo3ny4ape lnct sfartmu  ou1oltoio3iasls um( ont4tltomf iadfmtraivs t  2xmxo iu1ap emivil(fa2uaxro;t4apeo oetytfmDumnvo;(4texnir tatlmD auvsls)t2xm(mpno1al e neta() rumurpou4aptnif3iatls2rm(vp (4texomo oytlmtelnvo t trumxrpnydlptn ivt t)aDum(moot4tpxnifeilsls eaumo;u0treoxoctodfp  aueolt s2tr(r ny4al e fvt t aDrru  no0oexnif3tatfs2eln p (4 lxoif3iodlmDrlnei;t  etoxm3oo4lmtnlivi ( a2um(r ou1altomfeiadlm rln p t4tlenmfcia1lmt aieil(0sexo(o io4lle mfesl()aruru ooo0tlx mo3iyslsDulnvs;t4aexrir3tydop  luei;s trum(r io1lp   nct ( sDrr(m no1altnmi3iat s2ulums;()trtrxfciodlatrluvol( s2xrio oo1lle mnvi s)aDrm(root1openii3iatfmDem(vo u4 ltrmfctotlp  lueslt  2xmxm3io1opt mneias) 2rmxr ;o1apeo f3iyd sDeluvp;t4teeoxrcoadlm rlivo (0trxoiopiu4openlnei sfsrurxmooo0texomf3iasfm2rlums;t4 rxnmoctotfmt luei () eumir iy4ap n icsa()arumxr ou4oexnifeiyslaDelumsnu)arxrxo3oo1fm rlneolt)tetoirpny4oleelictat a2umxm ;o1tlenioetatla um(mpnu0trxomr3io1om  lnvs;t0 2xmiopoodap emietls s2taur ou4apt iociatfaDua(vsnu4altnifcootlmD luvo t0t2uoxo oydamte ncs tfs2um(  nt1aex  o3iyd m2uluvonu)tlerxociadlateauei s  2uoxm3oydapeemnvia(  Drr( pnt1tleomf3iyd s2rlnmpnt)texrmrciatlp eluesls) exoxm iy1apeemfes sf 2tr(r ;o4opxo o3tlt mDranvp u0altrmo3oodoat luei;t0t2tr(o nodll  livtls s2urxm nt0altn octatlsDumu s;t4 eenmr ia1lmDeaneo;() eurio3io1altemnvi t a2rrx oot0tpx mfciytfaDrlums t0 eeriocoatlmDeauvs;s)t2toxmpoy4omt lnvsl( sDrmx  ot0aptoiieild a2rluvo;(4tlxrxr3iodlpDe u s;t) rtm(rpno1om nlncils artaur ou1opxn ieilsfm2ranvp;t0 lxnif3to1omDeluvs;t)teumxr3no1op nmivi tfsruaumo;u0oex  ieiltlsDrlnmp;u0 ltnifcoa1oate n o t) 2trimpno1alee ncsas  2uru pot1tlx  ieild s2ea(mon() rermo3io1fmDrln s s) etr(m iydam elivsasfsDtr(r ot4apxn feildfmDrln p (0tetoiocoo1fpt  ieo;s0srxrxr3no1op  mnctat)s2tmxro;o4aeeo ietld aDeauvp;t0tltomo oytla  lu o;(0 exmir oodoptelfei s a2tr( p;u4ape  feias aDeaums;t4 ltrir oodfp e ueilt srumxo3oy1omtnlivi tfa2umxmpno0oleoioeild m2umnvo u4 etoxr3ty1fmDe uvo;(0 2xoxo3oy1omee nvils  2rr(rooo1tlx  feiys m rmump u4arxnir3oodfm ranei t srtm(opiu1opee ies sfs2ururooo4aptnmicilt aDrm( sn()aeenmfcty1optraiei;()s2tm(r3no1om emfeia(  2ua(mooo0opxn i3iat a2umumo t4tlxnxr3iy1laD lneo s0seto(rpnu1ope mncia(f 2truro;t1alt mfetysfaDeluvs;u)altrio iytfpD  n olt0t2xmxo3oy4aleemncsa( sDurur nu1alx  ictydfm rl( snt0 rtrio3oodfmDelnvo t  exm(opiydlm nlfcias a2ra(rpno1aptnifciad s uln s;t0trxomrcoytop rlivi t srtrxmpoudlmtnlnvs (  rtrxmoot0aleoifciytlaDea(vp;u)tetrmo tydfm elieo;(0seurir3no4aptemncsat) rtmumoou1olen ieiadlm2ean p;(0 lxomo iydopt li ol()s2xm(rpou4lpenlfeils srtmxrp;o0altoif3iad aDem(mp ()trtrmo3ta1lpDe uvi t  rumir3iodopt  fvtasfs2trx o;u0tpxomf3iyslaDumn p;t4 rtrxr iatfatrlu s s s2xmxr3oo4lp nmivil(fs2rmxr ou4apto iciltfm2em( s;()tetomrciodopDrlueol( srxm(opou1olt lfviat a2rmx  oo4tltoifcias s rauvs t0tetrxo3oytfmt livi;s0t2uoxr3ny4ome lnvtlsfs2rru ooo1alxomocilsls2ranvp u)alerxrcootfp e u il()trtoiopiy1opeemnvsltf rtauro;t4olx ii3ias a2ea( sn()aexrio ty1lmtr uvi;t0trxm(r nodopeemnvs t)s2rmum oo4oee  o3ils sDeaumo (4 eenmo tytoaD livi;(  rtr(r3nu4omee ieta()aDtmum ;u0oexo fciydla eaump (4arenmo3oatfaDraieo;s)tetoim3iy1lpeelfctltfsrtr( oou0tptnioctatfaDrlnvont0aetrmr oadlmDranvo;s t2tm(o oydoptn netat) Dtrurp;o4alxo ietasls2elnms t4 etrmrcoadlpt aies;() 2xo(mpno1lptelictl(fs2umu o;u1altnmi3tadlm2ulu snu0aexrxfctadfp   u s ()teumxr no1ll elivtl(  Duauronu4ape moetldla ra( p ()texnxrctydlpD au sl( truo(r3iydoltn nvia() rrmxm ot1ope  fetlsfm2emn pnu)aexomf3iatom rluvils  eurir iu1al e icsls s2tm(m nt0oetomf3iys m2ra( sn(4altnxrciy1lp eanei;()t2xrxr3oudamtelfvt ( s2trumpnt0oet mo3tls m umn s u) rtoircoodopDr neil() eur(mpoodamtemivtl( arrmxmo;u0tpxn ietysls ea(mpn(0 exnif oo1omDrlnes;()seuoxo ny1ape mfvtlsfsDtrx p;o1aexomiciasfm2elnvp (0 eerxoctotlaDr u olt) eurxo nydop e fcs t aDurxmpot1apt io3tldfs eln p (4 ltnmf3oytfpt luvi;s0t2tr(o nydlp  licilt) 2ur(  no0opx  fcildla2ranvpn(0aeerif3totlaDr n i;(0 2xoir oydamt licsl()arua(mo;o0olx mfciysfm2rmuvont)tlxrif iodfmtr ueols0srto(mpnudlp nlfvil( aDtau pou0aet miciyd s2umuvont0tetomo3todfptr nvo;(0s2tmir3ny4lmeemncsl(fsDua(mp;o4oex  iciad m2ea( snu) rxrir oy1lp   u olt srxrxm3iy4apt lnesls) rtm( pou1ale  feild sDuau onu)aetoxf todfa eanes;( t2tmxopnudamt mncsas a2tmu pnu1tpeomfeiasfm2umn s;t0aetnif3todlmt auvsl() 2trim io4omt mfvias) 2um(r ot1apxo o3iytlm2uaumo t4tlxrxf3tytopDe n sl(0setrxmpoydol nlfcs (  rtrxr no0tle mieiltls2elnmo;t0 lxnio oytlaDeluvs t)t2ur(r nydoptemivsa()artmumpou4texnmfctytfsDuluvp (0trxrifcoytfa e ivo t0 rxrio3iu4aptelfcs tfaDraxr ;t0apx  o3iydls emuvon() eermfctadop rlnes s  2uoxm3oo1ome  nctat)srraxr ;u0aeeo f3ild a2umnvp t)aeenxo oo1oaDeliei ()s2toirpiy1aleemnvtasf rtm(m no1oetn ictltfm umuvp u)trxnir3iy1om  anvo;s  rxm(rpoo1ole lfvias aDumurp;t1opx  iciysfmDrmn s (4texomr iatlmte uvs s0s2xrxopno1om nlneia( a2rr(  ;o0opx ii3iyt s uanmp (4treomrciotoa e ivo t s2toio3io1olenmiciltf rta(rp;t1teenmoeiysfa ra(msnt)arxnxo ia1fpD aneo () exrir3no4op n ict (  2ua( o;u1tptniieiytfa2elnmsnt4 rxrif3tydlat lieols seto(o3nu4lptelivt s)sDrr(m ou0alto o3tatfa rau p (0altrmo3iy1laDe nei;() 2umio nydop nlnet t aDrmur no1tee  i3tltfaDua( snu)aetnio iydoatrauvi;s0 2xr(r3iu4lpeelfvtat s2rrxm ;u1aex  o3ildla2umu p;() rtomfctydfm rlnvolt t2xrxopno1ope miet s)srtaxronu4olt  f3iydfmDrmnmo (4trxomo oy1oaD  ueols0s2toirpoodopt  fvsas aDua(rpnt1alenmf3iys aDranmon() rxnifcty1oa r uvsl( setmir oy1lleelicta()a2umum nu1tpxnifciasfs ea(vpnt4aeerircia1fp eanvs;t seum(m iu4lptn net () 2trxmono0tpeo ictat sDul(mo;t4tetoxf3ia1lmteli i t srxr(m iudalte icia()a2raxmo;o0olx mfeiatfs eluvp;t0aeenxrcoodlp e ivi t  rtrir3oy1ope lfetasfsrua( ono1apen oeiydlmDrau onu4tltnmrciatlpDr neils)setr(m3ny1amte fet t)arra(mpou4olt iieilt m2ean p;(0tltnif3todomDelivsl(0sexm(m3oudlmenmivsl( artmuronu1teen fciydla ra(vp;() ltnxfcto1fmt  uvs t s2to(o3io1llenlfeil(fa2trx  ot0teen icilt aDuaums u4alxrmf3iy1fmteluesl()teumimpno1lpeelneta(f rtm(r ;t4tlt moeiys m ranvs;t0altoio3ootlaDranvsls t2toxm no1apenlfvsat) 2rrumpno0alxo oeils sDul( o (0 rtrmo oydoa eln i s)s2trirpoy4ll   nctas srrmurono4opx mfeilsls umuvs u) ltnmrciytfmD anvils trtm(m oo1am  mnetlsfsDta(r nt4tetnmieiasfm el( p;(0aeerir tydfat li o;t  rto(mpoy4op  lfvt t srtrxro;t0open ociyt m2ulu pn(4 ltrircto1omtelivo;(  rtmimpnydlmtnmnvsl( a2tmu  ot0aex  feildfm ranmp u0altoxr3totla  anesls)t2urirpno4lp nmnvil() rur(mp;t0texo oetldlm2em(ms;u) lxoxociodopt  nvil( t2urio oydomtemiet t) rrmu o;u0aptnifetyslm2rlnvonu4 leriocoy1faD  n o;(  rum(r3iu4lpen ivsat) rum( ont4tptn fctysfa2el(mont4aexoif3oodfmD  nvols s2uoio oydole  fvta(fsDraur ou0aeeoif3iadlmDumnmo u0 eerxo3iydlaDrli il( s2tm(r3ny4ole lfvslt  Durumono4ape  octad mDumnvp;u)teenmfciydlptrli sls srxmxmpiydamen nvtas s2um( o;t0tlx ifeiatfmDumnmsn() lxnxrcoydfp r u i;t) rurxmpiu4lltnlies ()arua(rpoo0olt  f3iyd mDrl(vpnu4 lxnmo tadomtrau ols  2uo(r oy1lleemieils a2umur ot0opxoii3iltlaDemnvp (4 reoirctadoa elivslt)srxo(opnodlp elivsl(farrax oou1oetnmf3tyd aDul( pnt4texrxr iydop eanvols setoxr ny1ap emfesa(  rrmurpno4apt  iciydfaDumums;()altrmr3iytfaDrlnvi;t) 2tm(rpny1om elivs tfs2rm( ono0alxniieiltla2uauvo u4tlenmocio1opD ai s;()srtr(m ny1llt  nei sfsDrmumpno0tex  fcilsls2ran o t0trxrifcoodomtrauvslt0 2umir3nydlptelivilt s2urumpou1aeeo fctlsla2ean snu0tlxrmo3tatlm rlnvi;s  exmir3oodop  lncs sf Duru  oo0opxnio3tltls rmu o t4 rtrxf3tydlat lneils t2xoxopoudlpenlivtls a2tmxrpno0teeomf3iyt s2em( s u0 reoxfcoodlp eluvi;()sexmir3no1al nmneiltfsDrau poo1oet  oeils mDul(mo;(0tetrxo iy1laDrln o;t srxoimpiu4ll   feiat sDrmur ;o4texo iciytfm rlnvo t0artomoctotopDrln i (0srurxo3iydlm  lfcs s) Duaumpoo0tee  oeils aDea(mpnt)texnio iadlpDeli s;t)setmim3iudome lfvtatfsrraumpot1tlto ieiasfm2rmump u4trtnxf tatlat  iei ()srxm(r io1ole lnvs (fs2urur ;t0ole iictytfmDumnmpnt4aetriociadfatr ies (0trum(mpoodam nlfcsas  Duauro;u4oee mieiys s uanmp u4artrircio1fat aieils  2xmxm ny1lpt  ivias) Dtau o;u0tpe  o3tls s ran o;u0tltnio3oydomD ln o s0 rxm(o oy4lm emnes t  Dtru  ou1openioeiat sDrmuvpnt4aetnxo todopt lieo;(0 rxoim3nudlm n fei t)s2rm(rpnu0tex iicildfa el(vp u)texrxf3oytlpteauvslt0teurim iudll elivt (  Durxrpnt0ape  o3iytlm2rln o;t4tetrmr3oy1lp r nvi;(  2umiopiu1lmte ictlsfa2tmuronu4oeto f3tysls rlumo;u)tltnxo3oatfm eaies (  rtrxm3no4lm n ncsltfarum(m ;o1tpxn iciyd s2elu o u4 lerxo3oatopDe iei;() eurxo3oy1olee nctl(  rtax o;o0tptomo3ilsfaDrmn p (0artrxr iadfmteanvo s)sexoimpoudopeemfcslt a2tau ooo0aetnif3ias mDrlu p;u0altomr3ta1lm rln s t0srxo(r3no1oltnmfesl()srrau oot0olxo fciatfs rmu p;(0trenxf ootlpDeai i;t srumio nodal e fesas)s2trxm ;t1tpe mocildlm2ea(vs (0 lerxr3oo1lp  auvo;t)sexoiopoydlp nlivt t)s2rm(mp;t0opx  f3tasfm2um(vsn(0 leniocoydfa   i s (  rtr(m3nudope mivsatf 2tm(roou0aex mf3tytla2rmn o;(0tlxrio3oytomt lu s;s  2umxo3nudopt  ncslsfa2tr(  ;t0opxnmicias a2eau onu4arenmo3iatopD lnes ()trurio oydlp n fvtlt srra(m nt1tptoii3iyd a rluvp u)trenio3ta1lpDraivs;t)tetmiopno1aptnlfeta(faDuau o;u0alx mieiytfm uanvo;t4 lxoir3tadlp rli s s  2tmxopno1al nlivslt)srtrxmonu1tleniociadfa ul(vsnt4 lerifciadop eaivi;()s2xo(o3iy4apen netas)aDumxro;t4aptnmoctltlsDrlnvo t4alxnxrciodoate neolt) rxrimpno4llenlfctltfa2urxm no1olt  iciadlaDem( o (4 etnxr3tatlm ranes s0 2toim3ny1apte ivsl()aDrrx  oo1tpt mfeiytfmDua(vpnt0 rtrmr3oadlm elu i;(0seurxmpnu4alen nei t a2ur(m ou1tex  oetlsls2rmu s;()tetomoctydoatrai il()trumxo nodomtnmfesa(fsrtru pou0oetnmfciyslm2rln s u)trtoxrcoadfmt lueslt0 exrxmpoy1apte fesa(  2tau ono0ole  oeiydfs eanvo (4trenxr3ta1la e n o;s) 2umim3iydam  lfeias)a2rmump;u1apen oeiadlsDumu s t)trxrifcto1om e uei;s0 2xoxm io4ame  nvslsfs2uaxmont1opeomf3tltfa2ra( on(4aeermo3oo1fp  auvi ()truo(opnydomeelnvta(f Dumurpno4tle mocils mDeluvo;()artrmf3oytlaD aieo s)srurir3iu4lmen ieta(f rrau p;t1optn ociadfa elnmp t0artoxf3ta1oaD aueslt0srxoim ny4al nlnet (f rurum no1oetomoetydfa rluvo () rerir3io1oaDr n s;(0 eurir iy1omeemivil() Dtrx  ot1apxnmf3tysls2ul( pnu0 rtomr3tydomDeln il()texrxr io4lpte ies t)sruaxmp;t0apxnmfeiyslsDum( s ()aleomf oa1fp elivo;()t2tr(r ny1al nlfvsas  2urur nt4olxnmiciad aDea(vs t0 ltnxo3totlmtr ivo ()srxm(r3oydole mneilt)a2tauront1tlxnioeiltlsDel( o u4aexrxo3iodlmtelivslt)trxoxr oudopt mfesas)sDtmx oou4oleo oeiltlsDel( s (4 etnxocto1lmtrau ol( texr(o3iu1om   nvi sf Dur( poo0oeenioeiysfs rluvpnt0tltrmfctatfmDe nvs;()t2tmxm ny1lptemneil(f rrr( p;u1aptomoetydfa2uanvo t0 rxnxf io1fmt ai ilt0 2uoirpiu4ame  fvt t)aDum( ont0oetn oeiyt a2eluvs;t0 exnio oo1fmDr ivs;( t2to(m io4omenmict t  rurumono4tlx iiciasfmDranms t4 lenxr3tadfaDelieol(0s2xoxr3nydom nmfci (f rururoot4tpxniieiatla elu o;u4arxomo iatfm eanesl() 2uo(opnudom n fvs tf 2rrumono1alxo i3iasfa2eaums;u4 renxo oadlp r i i ( trtoxo nu1ap  lfesat  rtmxmo;t4olxo octldlm ran s (4trtrxo iydoaDr uvs (0truoxm io4op nmnviat)aDrr(mp;u0opxnmoetadla2emn s;()aleoircio1oat an s;t t2uo(r iu4ol nlnci (  rtr( p;u0oetnmoetlsfs2um(mp (0aeeoio3oodfm   neils0 rxoim oodapt mfvils)aDuauronu4optn ocilt m uaumsnu4arxrmrciy1fp   u il(0t2tmim ou4am nlfct ()aDraumooo4apeoioetyt s2emumonu0tltnmfcty1lm  lnvi;t0trxoim3oudolenmfetlt s2rmuront4tex  f3ildfaDrlnmont4altrio3oo1lpDraueols0t2trio iy4lm   ivs sf 2ta( pot0ope io3iadfsDemumsn(0tlxrmr ta1laDean sls  2uoir3oudol emict tfs2ra(moot0ape ioetydfaDulumonu4aexnxociy1la  anei;s tetoirpou1altemivt (fsDraurp;u1oeeomieiadls2umu snu4artoxo ty1lpteauvsl( s2xrxopny1apte ncs s) Duau pot1aleoifeiysfm2ul(vonu4alermr3ty1oaDeliei s) rxr(r oo1ole mieiat)sDurxronu4aex  feils m2eln p;t)artoif oa1lpteli s s) 2trio3oydom e icta( a2ururonu1aeeoiieiysfsDum(vo;t0 exnmocoadoa eauvil(  etr(mpno1lm n fvtat aDrmurpnt4tpenifeiydlsDrmnvo t)arxrxf3oo1faDeliei s trtmxopiu1am  lfesatf 2ra(m oo0tee  f3ildlm2eanvp t0tetoxo3ty1fm r ieilt0s2urir3io1olenlict (  Dra(mo;u0oetn fciasfaDra(vpn(0tetnxfcoodlpD li o;s0 2uo(r3oo1ale mnvsl()a2uru  nt4tptniieiyd sDeauvo;u4aexrif3oydom  anvo;() 2xm(r iu1aptelfesl(f Draur nt4oet  ictas a2emn s;t)alxrir iotom e nes;s) euo(rpoy4omtnmnvi (farta(  nt0aeto feiadls rl(mo t4trtrio oadfpDrli sl( trxmiopio1lpeemnes (fsrrmx pou0tptnmo3iad a2umnvp;() eeoif totfmt ai sls)t2um(o iodamenlfvilsfarumx pou1alenmiciadfm rm(vs;u4 rtnmr oadomDr uei;()t2umir oydom  mneils)srrmumpoo0oex miciltlm rln snu4 eerxrcoadla e uvi s) eurxmpnu4llenlnvsls) Drmu poo0apxo fetldfsDumu o t4aexrmfcoo1fa eaues t) 2urio oydoltemnci t arrrumoot1oetomieiltlm um(vp t) lxnxo3iotfatrlnvs;s trxrxr oodapee ivs sf Drm(mo;t1opto f3tlsfaDel(vo;t0arxnmrciodfpDeaivs (0s2xrxr oodlmte fetatf Dta(m nu0opeomiciyt a rmnvsnt0tetoxf iodfat  ivi ( trtmxr3oo4apt livi sfsDtru  ;o1teto ieiys a2rlums ()arenxo iotoat auvslt0srum(mpiy4ll emnvsa(fs2taxrpnt0opt mo3iatlm2rm( o (0artnmo3tatfaDr ieo s0tetr(m3io1altn nct t) 2taum nt0tlt ifcildfmDuan p u)trtnxo3oo1fmD  nes;(  rxo(r oudol e ivsls  Dtaumont4tpxoioeiaslm ua(vonu4aeenir3oo1oat aiei (  exoim nudaptn fet s  Dtmxmpoo4aee  ictydfs eanvp;u4tetrmf3oytla rli ol( s2xmxr nydole mics t  rumx  nt0ape mietyd aDuan o;u4trerif tydlp e nvsls)t2trxrpiydamtnmieiatf 2tm(m ;u4oeen f3iatfs elnvo ()aeermr3iodomD  ieo;s setmxo3no1ll emnviatfa2tmxr oo0oeto i3ilsls ean snt0tlenir3tydomD  neil()s2tr(m io4lpee nvta( a2uaxro;o1aexnif3tlt sDeaumonu)aexrmocto1oaD li sls0texoxo3iydom  miei tfartr( o;u4aet mfeiadfaDum( o u) lxoifciy1lm elivsl(0t2xo(o3nodlm  mfcilt)a2tr(m no4olto octltlm ra( s;u0treoir3iadfm  li o;t0tetmim3oodomt  ivtlt s2rru ooo4teeoifetlsfa uluvo (4aetnmfcoatfpDr nvslt0t2umir nudllt lfvslsfsrumumpou1tpeoioeiydls2rl(vo;u)arerxrcoatla e neilt) rxmirpiydolen nctl( a2taxm nt4alto ociatls ean pnu)aeenir3iadlm e u s;( trumim3nu1optelnvt t)s2rax  oo0tetoifciatfmDulnvo;t4tetnmr oodop  lneo;t)s2uo(o nudom emnctasfsrtmx p;t4opxo oeias sDemuvs;t4 rtoio3oytlp e n i;s)trtr(o3oydapt miet () 2uaxr oo4openmiciytlsDea( p (4treomo ta1faDrlu sls)teurxr no1oltn nviat) Dtrxrpnu1ale mi3iyd mDuanvo () leoxo tydlaDe nvs;()seuoxo3io1apenlivsatf 2ua( pno0tlxoioetat mDrlu snu)tltnif3oadla e i o;(0trur(o3nudalt lnvt (fs2ur(r ;t1opt micias s2ulnvo;u) etrmr3iatoa rluvil(0srxrirpnu4lmt lnciat) 2truro;o0tetomf3tadls2emu o;()altoxr iotomDrauvo;t0trum(opiydllenlfciat arumu  ot1tlx  f3iytls rlu p;t0 rtnif3iadla raivilt t2tmio3ou1lmt lfcia()a2tm(root1tlx io3tlsfsDua(ms ()texrxfciytfatelneilt) 2xoxr ny4aptnlieilt)sDrr(m nu0apxomfeiadfmDem(mp t)aleoxf tadlm r u s;(0t2tmir oo4opeemfctl(f rta( pno1apx mfetytlm ulu snu4alxomf iatomtraieslt) rxm(o3ny4om elieta(  Drrx  ou1aee  octldlsDran pnt)tlxnxo3iadopte iei;t  etr(o3oodomeemicias)arrruronu0olx mo3tydla2rl(msnu4trtrmr3oo1oa e nvsl()trtr(r ou4aptelnci tfarrmx  ot1aetomo3iytfs2raump t4aeeoir3oy1lm r u ilt0 2tmxopnu4olenlfes sfartaxmo;t0opx ioctytla rmnvs (0 rtnmf3ootfmtranvols srxoio3iu1ap   icias)srtm( ont4tex mfeilt a2rl(mo ()alxrir iadomteaiei (0 rxoim3no4ol emnciatfaDrmxm oo1oeen iciadla emnmon() rxomr3iytlpD an ols0seto(o3ou4lmenlivi sfs2uru  oo0alx moetltlmDemuvs;(4aeenir3iydfpteln s t)trtm(mpiodop   fesasf 2rm(rp;o4tpxo iciytlsDua(mo;() lxoir3todop  livsls0srtrxopiudllee fci (fa2tau p;u4tltn ociadfsDua( pnu)arxrmf3iotlm   ieols)tetr(opiudomtnmnei ( s2umxr ot4olt if3iltfa uan pn(0aexnirciydlp elu i;(0 2umir3no4omee ncslt)aDtmur no4aleomi3iatls2ra(vs;u) eerircoy1opDelnvi (0t2tmio3iu4lmtn fcs tf rumump;t1oleomoctas aDumu s u0 lenxr tadfa r nvol( sruoxm3iy1apte ivta( s2taurpnu4tleniicilsfs2eauvp u)teermr iotoatrlieols0texoio3io1llt  nei s arrm(rpoo4oetniiciad sDuau snt0tleoifctotfatrau o;t srxrio3ny4lptn ieiat)s2rmx  nu1opxn o3ilsfm2ua(vp u4trxnxfcoytfaDe uvi;s0trurio3nodlmtelfvilt) Duaump;o1oet if3iydls2em(vs;u4trenmf3oatfmDelnei;s trtr(m3oo1olte fviat srrm(mpoo4oex ii3tyd sDumn s u0alxnxr oa1opt  ivols0teto(m io1llt  fes (fsDumxmp;u0ape moctasfaDel(vpnu)aexomrctytopte n o (0setmxrpiu1ape  nvi t)srrr(r ot1oee mi3tyslm elnvo;u0trermo iotfm  luvolt) 2trxr oo1llen nci ( aruaxrpot0aexo ieias sDrm(msn(0 rtrif3oydlp   u o (0trxrxo iu1om   neia(fsrumur nu4oltn feiysls rl(vpn(4areoifciotfmtrlnvsl()trtrimpou4ol nlneiltf 2um(ro;u1ope iociytls rmu p t)texoirciodlm rliei;t t2xo(m oodom  lnctlt arua(  ot4optoiociasfm ulumsn(4teenmr3iadfm e nesl() rxoiopoo1lp nmivsas) rrr(rpou0tptoifciasfaDelu s ()tlxrxocoo1fa  anei s)srtoimpnudape mnet sf 2rm(  oo0apt iociltls ul( s t4teeoircoadlaDrluvo s)s2um(r3ny1ap   fvtls s2uaxr ;t0aeenmocilt a uluvp t)tlxrxrcoytfatraueolt  exmir oydomtemicsa() Dtmxrpoo4oltnio3tls m emn o u) lxrif oydfaDeaueol(  2xoxmpny1lpenlfes (fsDrm(  nu4aetomieild sDel(mont0alxoirctytlmDeaiei s0 2trir3ny4lltn ivsasfsDrm(mpno1opx ii3tasfa2ran on(0tlxnxr oa1fpD li o;s0setmim nydolt lfcsls)sDrru  nu1apxoio3tytfs rmnvo t4texnxfcto1fmD anvi t t2uoim3io1opt lies ( aDrmxmpno0ape mf3iysfmDra(vs;u0arenir totlpteli o;t  rxmir3iu4lmt micsltfsrtrxmoou4tle mfeiltls2rm(vo;t0 lerxr iodoptrlnvs ( s2umxrpnu1alte netlt aDrmump;t1tetnifetad s2rmumpnt) lerifcoa1oat  uvi () rurxr3iodomeemnvi t)aruaurpno0oltn fciydfa em(vo u)artnmocoa1lpDr uesls0srum(opiy4omen fesl( s2raxmpoo1tet mfciltls2emumo;(0 exomo3tytfmDe iei (0trum(r ou1lmenmnvi s)s2rr( ont0aetnmo3iyd a2rau p;t4altrxrcootfp   nvi;s t2xmiopiudlmtnlivi s s2tm( o;o0apx  ieiatlaDum( sn(0aeenmfcta1opD anvo s  rto(o io4omenlnvsatfsrua(  ;o4aex  iciytls2umnmont0 eeomr3todop  ln s;t trtrxopiydlm  mnet (  2umxrono1aet  f3iyd aDrlums ()tetniocoa1op eaiei s)sexo(o3ou1lleelivs t)sDum(  ;t0olx mfeildlaDelu o t)trxomf to1lmDe nvo;s)s2umir oodlm emietl()arua(  ;u1texnmfeiyd s2umuvp;u4arxrxo iotomD livo s) rtmir3nodlptnlnesl() Dta(mpou4oetn ietyt s rl( pnu0 rxoxf iy1oaD aivs () 2xoio iodll  mfesat  Dta(ro;t0aptoio3tytls rmums;(0treoxfcoa1oa  au o (0s2tmxm3ny1lle mnvsas)arumur ;u1open iciyslaDulump ()texoxociytfaDe uvolt trxoio oy4openmfci ()a2tru  nu0aexnmfeildfm2emn pn() eeomr3oydfpDe u sl( trxoxr3oo4omenmnetl( srrau  oo0alxo oetytfs2ua(vs u4trerxf3tadoaD au i t) rxr(m io4aleemivtat  2um(r ;t0alt  oetydlm2emnvp t4tltoio iy1fmD lnvi t)srxoxm iydll n nes t  rtrx o;t1openifeiat a2rmn p (4aleoir3todoatrluvs;s  rxr(mpnu4llt livsls  Drrumoou1oetnii3iatfs ul( pnt4aleoifcoa1fm ean ils)trxoio3oudapte fcias)a2tau pnu0opx  ociad sDul(ms;t)teenxfctodlmDran o;s seto(m iydopenlivia(f Durumono1alen o3iasfa em(ms;() eermocoadfa rlnei;(  2uo(m3oodlmt  icsl(fsDururp;o0oetoifcias mDrlnvonu0altnirctytfat ai o;t0 rxr(r3iy4optelnvi s a2rrump;u0ope  i3taslm ua(vs;(4trtomr3iy1la eaivi s  2urxopnydop e ivs s srtrumo;u0tlx  o3ilt a2rlumpnt)treomr ta1fp eauvo;s0s2urxm3no1altnlnvia()sDtm(monu0tetnmo3ildfa2eluvs u0tlxoxr3ty1la e n s;s s2toxo3nodlptnmncsa()sDta(mpot0tpe iictltfaDrau pnu4 ltnxf3tytla r ueo;s)teto(r oy1alenlivilt)srtaxmoot4ale iociys a2el(mpnu)aeeniociy1lmD  ieo t) exmim3iu4am nmnviasfaDtm(monu1olxn i3iltfa ulnmonu)arerir oatoaDean slt) etr(r oy1aptemnctatfsrrau ooo0aet  octld s2elumo;()teerio oodfat  uvo s)trumxm3iu4lleemncia(f Drrxm ou0opto feiysfa ulnvp;t0 ltnirciydlaDeliei (0 exmxrpiy4lleelivsl() rumxmp;u1tet miciys mDelu on(0 rtrxfciytfatrlues;()trurxopiudll   fesas  rra(rpnu1olenmf3tldfm ul( s;t0aetoxf tytopDe u s;t0sexmxo oydal  lfctl(f 2ua(  nt0aleomfeiatla2ea( snu0 lxoxociy1fmDeanvols0trxmxopoo4apee ivils aDtmxrpot1tpt iictydfa ua( s t)trxnxfcty1lmteli o;(0trxo(m iudoltnmictl(f 2rrxrono1tet  f3iad aDulnms;t0artnircty1opD an s t trxr(o3oy4alt liesls)a2raxmoot0altn ietydls rl(vs t4artomr iydlmDran sl( t2tr(m iydlptemnvtlt)srumu  oo0aetniicildfs rmnms;()alxoio tydfmtrlnvslt0 exmxr3nodame  nvt s)srrax p;t1tpxo octlt m2eanvpn(0aleomo iy1om elueol( srtoio3ny4lm nmivtl(fsDumu ooo1aleo icildlmDuau o;(4alxrmfcta1omtrluei t)trtoio3ou4ome miei () rrmurp;u4tpto f3tltfa rm(ms;(0aeenmf tydlmt ln ils sexm(m iudam e ncsl(f rrmurpnu1oexn iciasls emnvonu0altrif3io1oa eanvol(0 2xrim ou4om e neslsfartrumpnt0olxnmietlsls ra( onu0tlerif3oatopDr ivslt0s2tmio3iu1altemfesls a2rmu pnt1aetomfeiat a2ulnvsnu4 etrir oydfa e ivs s  eumxr nydlpen fcsa(  Durxmpou0apt mfcilt a2rauvs;u4tetomfciotopDr ueo;s) 2xr(o3no1optelfvsat srtmurpoo0tpx  feild m2emnvsn(4teermr3oatlpteli olt)sruoio nudale mncils) rum(mpot4aex mi3iasfm2emuvo u4 leoir ty1omD li ilt) 2toio oy4al elici t)a2um(m nt0apen fctasla rln pnu4texoxr3oo1opte ivi t)srtoxrpoy1om  lfcsat artm(rooo0oeenmo3iltlaDumuvpnu0arxrmrcootlpt  nei s) rxrim3oo4oltn nesltfsDumur ;t1tlxnmociys s2rm( p;u4altrxr iadfmDe ivolt0seur(opiy1oleemfct (faDrru  nt1olto fctld mDeluvsnt4trxrirciadlaD aneslt0tetoim3no4amenlivia() Dtrumpnu4tlxo iciadfa emnmpnt)trxnmrciydlp eln o s)srum(r3oydamte iet (faDtr( pno0tpt ioeild sDelumo (4tetoxrcoa1omtrauvi t)truo(o ny4omt lnei ()sDuaum ot1openmf3ils m rln snu4 eermr oodfm rlneo;t)trurir3iodaptn fciat srumu p;t1tetniocias aDrmnvo u4 rtnmo3iydopt  uvsls0 rxr(m no1omtemivtl( sDra( pot1oleomfeiysfmDul(msnu4 ltrmr3tytop  li o s  etmimpou1ope mivtltf 2tr(rp;u1tpe moeiasfa umnms;u)alxnmf iytfaDelieslt0t2xr(m3nu1om nlieiat)s2ur( p;o4alxn fctas s ul( pnt)tetrxr3iy1fpDeli i t t2to(m3iu4lmee ivs t)sDta( pou0tle  i3tldls rluvsnu4aetnifciadlpDe uvils s2toio ny4ope lfesl(  2ra(ront4aptnioctyt m rl( sn(0 eermf iodoaDran s;s  2toirpnu1ll   feil()sDtmxmooo1tltn fcildfm2emuvonu0 lenmf io1om  luvolt0 rtoxm3no1lme  nes (farumx  ;u4aexnii3iytfs2uanmonu0 rtnir3todoatrauvsls0s2xm(mpoo1ap nmfvtas aDtaxrpno4tpto fcilt a2rmnms;u0altrxo iy1oa rluvslt) rtr(o nu4omtnlncta() rrm(  oo1tex iictltfm2uaump;(4alxrmfctytfmDeanes;s)trtmir nodoltelfviasfaDur(r no0ape mo3ils a em(mp;()aetrmrcia1lpD aivil()setoio no4ol  mfvi sf rra(mo;o1opxn fciyt sDulumpnu4 rxrifctytopDe nvo () rur(m oydll elicsl()s2uru poo4oet moctad mDuauvp;t0artnxf3iydlpD aivi;( trxmimpiy1oltnlictlsfs2rm(mpnu1alxniiciyslm2rm(vp t4arxrmo oadopD lneil(0seto(r iudlpenlncsl( sDrmu p;t4aet  iciltlmDrlnms;u)aetomr iydomteli s;() rtoir3ny4ome livtl(fs2rmumont4optn feiasla el(vs;()arxnxfcoatoa   i i;t trtmio oy4op emfcsltfa2urur nu4alto i3tasfaDrmuvs t0aetnmoctytfateaieo () 2uoxo3iudomenmncils)s2rmx  ou1tetn feiasla2raums;(0teeomo3ta1lpteluesl(0srxrxrpiy4lp  lfeta(fa2rmxr ou1oexo f3tysfa rmumo u0 lermr oadfaDeaivs;s  rxmirpoydam  lict tf Drrxro;o4tltnmfctldlm2umuvp;u4tlxnxocoydfaDeaies;t tetm(r oydalen fesatf Dua(mo;u4oeenmf3iadfm ea( p;u)artoxf oo1fmtelivo s srtr(r iydal emfvs sfsrrmxro;o0olx iietlsfs eluvont0 leoio iydfaD lues s t2tr(mpio4alt lfcsa() 2tru p;t0tlxo ietaslm2uanvs;u4treomf oa1omteaivo;()srtmim oydoleemicsls sDtmxmpno0texoifctadls rmuvs u0 rxomf iodomDe iesls0teur(rpnu1ll emivilt)artauro;t0oetn iciydlmDrluvo t4aleoxfcta1om e nvo;s seuoiopoudaleemneia()s2tru  nu4olxnio3ilt s2emuvpn(0 lxnio3iadoatrau ols  2urirpiodlltelfvs ()srtm( o;u4aet mieiyt s eluvpn(0 rxnir iy1lmtr nes;t trtmxr oudopte nci s)a2ua(  oo4tlx  i3tydfmDrlnvs;() ltnmr oatfmtrlivs t0 etriopiudlmtemfeslt) Dtax poo0tee mo3tatfaDum(vs t0 renmo3oy1fptr n o;t)s2toxo3ou4lleelieias aDuaumpou4tpenifciyslsDrm(vo;t4 eerio3tadlp   nvi;t0 etmxrpnudlpenlncta()srua(rono1alx  ietydls2eauvpnu4altrif tadoaD aivo t tetoirpoy4ol  mivtls arrrxm nt0aptnmf3ils m eau onu4arxoxo3oydfaD  uvo;( srxrxo iydoltnlfvs ( s2raurooo1tpt  f3iadfm2ra(ms (4tlxnmfctytlp eaivi;t)srxmirpno4amt mictl(farta( pnu0tpe ii3iyt m2eluvp u0 exoir3to1fpD ai o;s) 2xoir iodolt mfcsl(fsrrr(mpoo4tlen f3iysla2rm(mo;() ltomr3oadla  ln s;s0truoio3oudlp e ncil(faDuaurp;u4texnioetls s2ul(vo;()trtrxo ia1lp  aieolt)t2trxr3ny4ll nmfcs sfs2rru o;t4apenii3tltfs2ra( o () leoxr3oatfaDeau s (0 rtmio oy1olt lnvtlsfa2tau o;o1tlxnmfcildls rlumon()arxoxf3to1lm  aieo ( t2uo(o iudopt lfvsat a2raurpoo4tlenmieild mDrmn pnt0trtrxo iytom r ivi;t)teuoim3iy1al   ivi sfsDtrum ;t4tlxnmieiasfmDra(vs t)teerxo totopDran ilt0trtmim3iu1ape mfviasfaDrmu ooo1tlx  ociytlmDem(mo;u0altoxf3iatlptr ues;(0srto(o3ny4ol nmiviatfa2ur( ont4oexo f3tyslm rl( p t)tetnmo3io1oaD lueo t t2uo(mpoy4ol emnvs s artmxr ;t1altnmoetasfm em(vonu4trtrxr iodomteau s;t teur(r3oo1lmenlivi ()artmx  ot1aleo ictldlm2rmnmp;(0 ltnifciydom rlnvi s0trtr(opou1lltnlivilt  2rax onu4tpx miciltfm eluvo u4 reoxf3tadlp r u s;s)s2umxo ny1lle mnci () Duaurpno0ope  ictatls2em(mp t) ltrxf ia1oateauvilt0tetrxr io4lp e fvilsfsrta(rono0oetn ociyd s ea( p (0aexrmf ty1fpte ieslt0teumxo nydaleelfeia( s2raur ou1oet mictlt m2eaumo (4tlerio iytop  lnvs;s0 rum(r ny4olt mfvtat  rurxroou0olto feiydfa2el(vpnu4texrxr3ootlmDelu s ()srtoio ny4lmee netasfa2rrxr ou0alt iociad aDrmu ont4artnifciotoaDelneolt)trtrxmpiy1lm  mieilt artrump;t1ope if3tydlm ua(ms;u)texrir3iadlptr nvs;s)seuoxopoy1al emicsl(farra(m nt4aex ifeildfaDraums;(0trtoxocto1fmDr u slt trtrir3no1altn ictlsf Dtauroou4tle mf3tasfaDelnmsn() ltnir ia1la rlivils t2trirpiu4amt  neiasfa2rmxmo;t4tee io3iyd s2emnvon(0altnxrciydomDr uvo ( trumim no1alte fviasfartm(rpou0apxn feiltls2eluvo;(0trxnxr3iotfmt luvi;t setmxr3no4al elfct () Duax  ;t1optomfcildfm elnvo;(4arxnif oo1oa e ieo ()trxm(m3nydaptn ics sfarumxmpno0tptoii3iltfmDel( p;u) etrmo3oydlpDr i ol(0 2uriopoudopeelncils)sDuau oot0tptn ieilsfmDrmn s;(4tlenir oytfp e u slt)srxr(mpio4omte nesls) rtaxm nu1opx mf3iadfs2rlnvont4 lerxrciadoptr ivi (  rxmxm3iydomen nesatf rtaum ot4opt  f3tytfm2rl(vo u)artomf oatoaDelnvslt trxr(o3oy4ameelfcia() rrru ont4olen ieiat s uaums;u4 rtrirciatfate ueil(  exmir3no1ol  lnes s a2tr(rp;u1ole mfcilsls rl(mp t)alxomo oadlmtr ueil(0 2xmio3io4ole lfvsls a2tmxrpnu4tlxomociltfm um(vo;() exomr io1omte neols)t2urxr3no4lptemnesls a2rmx pot1tet  iciytfa2ranvp;u4alxrio3ta1opDeauei t0srurirpiu1ol emnvsltf Drmuro;t0aex mf3tas a uluvpnt4aetrif iadlmDeli ilt t2toiopiu1ole miesa() rtrum ;u4oet  oeiysla2rlnvp () ltoxf3iatfmDrlieo;t0 exmxr3nydlp elivi (farrmxrono4ope  ieilt aDra(vs t0tltnmr iy1op elu i ()t2uoxo3io1op  lnvtls)aDta(mp;o1opeomiciat aDem(mp;t4tlxrif3tydomte uvo (0t2to(o iy4ll e ncs s sDrmxront0tptnmfctydlm emn p;u0 ltnir3tadlaD anvo;s) etrxo3nydamenmiet sf 2uru pnu0tee moeiytla rmu o t4 etriocty1om elivol(0setoxopnu4apenlnvias  Dra(m nu1tltoio3iyt s2uan pn(0arxnmr3ia1lmD ai ils  rxm(o3oydomtnmies s)s2rm(mpot0tlxomieiaslsDea( s (0trxnxf to1fat livol()t2xr(opnodlpe  fci tf Drm( pnu0aee ifciltla ul(vo;() rxoio tydlmtraueo;t)t2uo(o ny4om emivt t arraumooo0tptniiciytla rln s ()tltrmr3tydlmt lues;t) eur(o3oy1op nmnesasf 2tmxmp;o0oleomo3tld mDuluvp ()teerif3tytlp eln s;t  eur(opiydlptemivtatfs2uaxm ;o0oee  i3tydfsDua( pnu0tleoif totom  aiei ( t2tmio3nydlp   fei (  Durur nt1apxnmoeilslaDum( o;u) eerxo oydlm  lues;t)t2xrxr oo1lptnmivtl(f 2rrumooo0apxn oeils aDran s t0alerxf3iatfpD  ivs;s)trxmio3nudlm e fcils a2rm(  oo4opeomf3iasla2ra(ms t0 lenxf totoa e iei s  2tmimpou1lmee ieil(fa2ta(r ou0tpen oetysla uln o;t4altnmrciydop  auvo;(0truo(o3nu1apte nct s aDtaxr nu1olx  octaslm rmn p u4trxoxf oydlm r n i s)srtm(rpoo4lm nlici t) rrr( pno0oee ifciltlm2rmnmo;t4trtnxr to1fmDeli sls0 exrxmpou4ome lfvtl(fs2rau ooo1tltoifetytfa rlums;()tetoxr3to1opD liei s) etoirpoudlp n feta(fsrrauro;u4oetomieiyt mDeanvp u) lenmo tatla  aues s)texr(mpiodlle mfcsl(fs2urxrooo0texn fciasfs ua(vp;(4altnmo oo1lp   neo;t  rtm(m io4ap nlfet sfarrmur ou4opt ifctyd a eluvs;u4 etrmf tytfateau s t0 rtmim3oo4op elics t arra(roou0tpeomiciyslm2ra(mo;(4areomf tydopDrai i ()sruoxm nodlm   ivsl(fa2tmxm nu1aetn f3tlsfs2rmnmsnu0alxrxr3oytoa rai i;()t2xmim io1lpenmfcsl(  rtrum nu0apenmocilsfs2rlnmo u)tetnir3io1oatrai s (0sexoio no1lm nmfetl()aDtru  ;u1tlxoifeiysfs2rlump u4tltrir oytlm elnvs;t0sexrxo3io1lmtnlieiltf rur( oot1opto ieiyslaDrm(mpn(4tltrir oodfa eli slt0t2um(rpno4ll elfctltfarrmumont4tpxoiociatfmDran s t4 ltriocia1faDr iei t) exoxo3io4op emncsat) Drrx ono1ale  f3tyd a ulnmpn(0 ltrmo tatopDrlu ils)t2uoxm iydol nmfvi sfaruru  ;o0opto fctadfaDumums u)trtnxf ia1fmDrlnvi;(  2tr(o iu4om n icsat aDrmx  ;t0open f3tyd aDemnvonu0arxnmo oo1faDrauvs;t0t2tmxm oodaleelics sfsrrmumpno1apxniietyslmDranvp () lxrxo ty1lmDrlnvs t  rxr(r ny4am emnet tf rumumpno0alxoiietltlmDelnvsnu0tetrxf3to1oa  lnvsl(0truoxopiy4ame lfvslt)srrrxmo;t0tptoifctltfsDelump t4trtnxf oa1laDrlies s seuo(mpou4opt  ies s) rtr(  ot4tpxn ocilt mDelumpn(4alxrioctadlaDr i ol(0srumxopoodolt mietatfaDrru ooo4aptoif3iytla rlnmo;u0 etrxf iy1lmtrli s t0 etoir no1lp  mnctls)aruaxr ;o4opx ifctytfaDrmums t0arxnir3totomtrai o t0 2xm(rpoo4lmen neia(fs2trxrono1tlxn oeildls2rmn o;(4 ltomr oa1lpDrauvi;t)trurim oo1ol e ieslt) rrmxr ;o4tpxn f3tydfa2ran o t4trtnxociotop r nvs;s s2xriopnodlmtelivslt)s2taxr oo4oeeo iciytla2ra(vs;t0aeeoioctotomtrlieil()texo(m no4lpenlivs tfaruax ooo1alt io3iltlmDrlnmp;(0 rxrmr oa1fmt  u olt)seuoxm3iu1ome mfvsls  2uax p;o4oetomfeiysfaDeauvs;t4 lxnifciotfmDeln i;t tetrir3io4omtelfetlsfarurxr nt4aptnmfetlslm eau o ()tleoxrcto1opD aieo ( teumxmpiydlmtemfvs s) Durum ou1tpxn f3iydla2emn pnt0 leomociy1fatraivi;s  2trio3ou4amenlfvia(faDumxr nu4aex  ocils sDrmnms;(0 rerxfciydlpt aueil( srtmxr3ny4alenmivt ()arrau p;u0apxn oetysfm elu o;t0 rxrmoctodlm r i i;()tetrxm no1optemfci ()artm(ro;t1oex ifciys a ran p;u4 rermr3iytomDrlnesl(0 2xo(rpoy1oltnlictlt)sDur(r oo4tpen o3tadla2umump t)artrxocoydomteaieol( trtoxo oy1olee fet sfs2rmu  nu1oeto feiys a2rm( p (0 reomrciydfpDe uvo t srtmxmpoy4op   nei s) Dumumpno0aee mfeiat sDean pnt4 rxoxr3oo1lpte uvs t0trtr(m io4lme  fcias a2tmu p;o0aetomfctlt aDrmnvo u4 lxnmf3iadlat lu i (0tetmirpou1lpt lneiasf rraurpot0tee  o3tadla2emu ont4trenxfcoydlmD aivo;()t2xoir3iydlmenlneia( aDurum ot1tpto feiytfa rm(vp t)tlxomocoodoptr ivo s0teurxo iy4ameelfvi tfs2urxmpot0apenii3ildfa2ul(mp t)tlenxf iadfate n i;() rum(o3ny4openmnvsa( srrr(  nt0teto ieiasls2uaumsn(0aeermr oatoaDelivil()texmxm3nydal elnci ( aDtr( poo0aexnmf3ildlm rlumo;t)tetrxf oa1omDelneo;( sexm(r nodlp emfei ()a2tr(r ou1oexnmf3tldlaDul(vo;(4 leoir3tadfpDrauvols sexmxo oo4alt mieta()s2tr(mpoo4tltomfciatla em(vs;u4 rtoircoydfat livs;( seumim3iu4apenlfvil(f 2ua( onu4alen i3tltfa2rmnmp;()aeeoir3ta1lmDeanvols  rtrirpoy1ap emicilt)s2tm(ront4oeeo o3iasfsDeau pn(0trxrio3oadlm elnvo;(0seumxo3nydomt  nvs ( sDtru  ;u1apeo i3iysfmDumuvsn(0aeenxr oy1lpDr nei s  2toxmpiodlm n nvtat s2ua(rono1opt  i3iyd m2umn p u0tlenio3iadoaDrln o;t0tetmxo3io1op n fci t arrr(rpou1oltoifciatls rmump;t) renxo ta1fpteaivol(0tetrxm3iu4ll n netas  Dumur ;u0tetn o3tld s umnvs (4aetoir oa1oaD livilt0srumxmpiy4am nlfeiatfsrraxro;u1apxnmoctadfs2ra(mo;(0teermr to1lptelu ilt texmxo nydlm nmicilt  Dta( p;o1opto o3ils s emn s;u4arenmfcio1fp  aueo t)t2xrir iu1oltnmfci ()srurump;u1tleo o3iatla2em(vpnu)altrxocootlmteauvs;( sruoxr3oydlp   fetas sDrrxrpno1alxnmfeiadfs2eauvp t0arxoiociatlpteln ols0seumxo3nodal elfciat)aDururont4tpen feilsfa uau sn(4tetomo iydfaDe uvs;t0seum(o3io4ole  fet (  Dtax  nt1tle iociys s ua(ms;t4 lenxociy1fmD lneo t  2urir oy4llt mnvs s sDra(mp;t1oexn ieias sDrlumpn() eeomr oa1laDelnes;(0 exoio3oy4alenmfciat aDurxr ot4oetomoetls sDelump;u4aetnif iotlaDeaieilt0 rtoim3ny4omte icsat)aDuaxmo;u4aleoifctltfs2ua(vo;()aexoir ty1lmt  ieilt0setoirpou4am e fvtltfarurxmp;t1opt ioeiydfs2ul(mo () rxoxfctadopD lueo t)s2xmxr ou1lptelfcsat aDrmu  ;u0oeen i3ilsls2el(von()aeenir3ty1op  an sl(0s2to(o iu1omeelieta(f 2ur(  ;o4aex  iciadlm umump;t4 ltnmf oodfpDrlnvslt0s2xoim ou4omte fcta() Drrx pnu1tltoifctysls2ean p u4 rtnxr3tydfpD lieo;( truoxo3ou1apt mivsas)s2ta(mp;u0oeto feiatlmDuauvs t0trtrifcta1opte uvsls) euo(mpiydomee fcilt s2rr(mpnt4apt mfetydlsDelumsn(4aeenxrcta1oaDe neslt)s2toirpio4ope mfcia(  2ur(roou4opxo feias mDra( p;(4aexomo iatlpteaieils0 2xo(r3oy4llenmfvils s2tmu o;u4tpen fciydfm2ranvo t) eerxocoy1lateaueol(0t2xr(opiodaltemnvs sfa2urxro;t4aet  ieiasfa2rmu pn(4arxnxf oo1lateanvi;t  eur(m oo1lm elivia()sDum(rpnt0openmoeiyd m2ul(ms;t) lxnmf3ta1op eluvs s)srum(rpou1ol  mfei t  rua(mpoo4oltoiicilsla emnmsnu4altnxf3tytlpt lneols0srxoxr oy1ap   fetatf 2umxmono1ope moetydfs ulnvo u4tetomociodla  livsls0 euoxr iu1ll  mfvia(  2tm(mp;u0optnmi3iyslmDumn pn(0 ltoiocootfpDelu s s0teuoir iodal e ivs t)a2rm(r ;u4oet  o3ildfa rm( o u4tetnxo3io1fmtrlneo;t0teurxrpio1al e nvsas)aDua( o;t1olxniiciat mDranms;t4tetnxr iotlpDrauvo;s t2toxo3oodlmtn ieil(  ruau  no1tlt  oeilsla um(ms;u0 lxoir3ia1lp eaieo;t0teuoio ou4lp nlnci sfartau ono1aeen i3ildfa2ul(vont4tlxnxf3oy1op rlivo;t0srtr(m nodomte feta( sDumx pnu4tlt ifciytls emu o t) exnir oa1lmDe nvols)tetrxo io1aleelnci s)sDtmu o;t4tpen oeiys s2ulumsn(4 lxrmr tydlaDrauei () exo(o3iy1apen fcs tfaDtaxrpot1apt io3iysfaDrm(mp;(4tltrxf3ootfpt luvi t srxr(o3iu4lpen fetltfaDur( oot4alxomi3iltfmDumnmpn(0 eeoxf3ty1fpDeaieo t  2xmim3iy1ol  mfci tfaDrrx pno0tlt iieilsfm2uauvs t4tetrmociodfmteau i () 2tm(mpou4lltnlfcs (f 2rrx  ou4tptomoctad a2uln p u) rxnmf3tytlat li ils seuoim3nudapt lics ()sDtmxrooo0tpeoif3iytlm uanvs u) lxnmrcio1opteauvi;s0s2xr(r3iudopt mncilsf 2umur ;t4oet iictas mDuluvp;u) rtoxo oa1lmDrau o ( s2uoiopiudllenlfesatf 2urx p;t0aetn oeiltfs rm(vp;u)trerir3iy1oa rlu i;s) rum(o3ou1lle lfesat) Dum(mo;t1olxomietlsfaDeanmonu4 ltnmr3oytfaD  ivilt0trurir ny1op nmfvsl( aDtmum nu0tpxomietytls rln o t)tlenifciodomDeai il( teuoim oy4lpt lfcs ( srrrxmo;t1aexn o3tas s2ua(msnt)teenxrcoodlat  ueo (  rtoimpoy1lptnmfvtat) Durum nu1alt mfeilsla2ranvs u)trtrxr tadlpD auvs s)trur(opio1ale  fcsl( aDrr(rpou0opxnif3iyt aDul(vo t4 rtnifctydopD  nvo s trurio iudom  lfct tfa2uaumoot1alx moeiadlm em(vsn() exnmoctadop rlieolt0srxr(r ny1lm  lfctat srraxroot1oet ifcilsfsDea( on(0 etnxfcoa1laDr n sl( seurirpnu4altelivsl(  Dtru  no4opeomoeiytlmDul(mp (4trtrmr3oy1fptrlnei;(  euoiopiu1omtelnctls) 2rr( oot1tlt io3iydfmDemuvs;(4 exrmf3oadoatr uvo;()t2xr(m nudll emfvi t)s2umxmp;o4tlto o3taslm el( snu0arxnifcta1oateanvi;s)texoimpio4lm nmfetasfs2taxmont1tpen fetadlmDumumo (4teeoxr3tytfa  auei;t)trurimpoudlpenliesl(fa2urxrpoo0tleoiiciytfs2rl(vp t) eenmrciytlpDrlnvils0 rxo(o3nydll emieslt srrmxronu4opxn ieiyd a2el(mpnu)teermoctydfpDelnvilt0 rtoxmpoy4opeelfes ( srtaxmonu1aleomf3iyslmDrluvp;(4 etnmo3iotopDeanvs;t0 eumir3no4olte nvia(  rua(mo;o0tlt  fcilsla umn p;u4 rxoir iytla eauvsls0truoiopiy4lmtnmncil() Dta(mo;t4open ociatla ea(vsnt4arenmo oydfm   u i t setoxr oo4omt  fvta(f 2uaumonu1ale  f3iatfs rlnms;(0tetrioctydlpt anvs () rurxm3iy4alenlfvsls)sDumxmo;u0opxomieiatfa2um( o;u4alerxf3oadfm r ieilt0 rxrxopnu1lle  fetas) rum(rono0apeoii3tld m2ul( o;(0tlxnmo iodfptr uvo;s0 rumim3nydlle micslt  Drr(rp;t1tpxnio3iysfm2rln s u)tetomo oatomt  nvs;()trxoxm3oo1om  lnetatf 2rau p;o0tptoiiciltlsDuanvo t0alxrmr3ootlm eln sl()trxoir nodaptnmfvta(faruaxmpoo4aee mf3ilsfs2umn o;u4aeeomr ia1lpD  ues ( seuoxo3oodalt lncsas)s2rauro;u4aptnmoeiydfmDum(mp u4altnmr oy1fat  u s;t)srtoxr3ou1ol  lneslsf ruau  oo0aetnmf3iadfmDulu pn(0altoxociydlaDeluvi;s sexoirpou1ape mivta(fs2raur nt4aeeomfetydls ulu s u) exnxf ta1fatran o ( seurxrpiydap emncta()sruru ont4alt io3ilt s2rmumo;u0trtnmfciy1lpt  u i;(0texoxr3oy4llee ietat)srtr(r nu0oexoio3tlsfs eaums (4tlxnio totfptrai o s0trtmim3no4am   ncs t  Dtrx pot0aee miciaslm2ul( sn(0 rtoiociotfm  ai i;s  2um(o iudol n ics t a2rmump;t0tle micils mDrmnvonu4trenir iotoaDe nvi t)texmxm oy4openlivsl( sDum(r no1oeeomo3tatla2uanvo u)tltrif tatomD  ieols) 2xmimpoodlmte nvils  rtaurpnu0oleomfeildfm2uanvo;t0 reoxfciy1omtr ivi;( t2ur(mpou4omtnmnciatfsrra( ono1openmfctad s2ulumon(0tetoxocty1omteluvi s0srxr(m3nydlltnmivi t s2umxr oo0ole  feiydls el( o;u)tltrif iotfp   ueo;s t2tmimpiu1olenlncsatfsrua(  nu1tetn o3iyslm2uan p;t4trxrmfciy1omt  ues s)trxr(opio1olt lfeia(fsrraumonu1ale  ietat a eanmp;u0trxrxf3iadla   uvo;( seumxopnu1om  lfcia(fa2trxmpno0aptnifetasls uanvp;t0trtomrcoo1fpDeaieol(  etrxr3ou4ape lneilt)a2urumpnu4tleo ocildfs rlnmont4 eeoxo3ootlaDraies;s) rurxo3nydaltemivia( s2trxrpoo0apto fcildlmDranvo u) ltrmrcoa1fmD  neo t t2to(r iydllenlfcs ()aDuaum no0opto fciatfmDrluvp (0arxrxf3iodlaD luvi s srurio no1lpt mieils) rtr( pnt0tle ifeilsla ul(von(0aleomf iodom rli ils)sexr(m3iodapt  nct t  2urxmonu1aet ifeiytfs2emu s (0arxnxo oodfmDe uvsls0srxmim3iudop   netltf ruax  ou0aleo iciaslmDeauvonu4artomrciydfmDeanesls tetoir ou1omtelict (  rtmuronu0tex iiciat mDulu ont0altnmf3iotlm ran i;t0t2toxo3nu1amtnmneil()arrr(rpnt0aeto iciaslsDuau o;u) etrmfciy1fm rlueo s trxmimpnydlle livtas  rtmxm ou4oexoio3iyt s2rmnmo t)trxnmr3iy1oa rauvols) exoxopoudapenmnesa(fsDtmx oou4altnifetys mDuau o;(0teeoxfctytlpD  nvi s) rur(m3nodame  fetls)s2umxmpoo1tlto feiadls rlnmonu) etoif oatfp elu s ()trurir ny4ap nmicias)arrrur ;u4opxnmictasfs2ra(ms u4altnxfciatfa   nesl(0t2toxo iu1om nmfvsasfsDtr( oot0oeeo feiadfsDelu snt4arxrxr iydom   neo t trxr(r3oy1om  lieilsfaDuaumpnu4apxn octys a2uan snt)artnxo oodlpDe ieols t2urio iu4ap e fcia(  Drmxr ou4teeo oeils aDrln snt4alerxfciatfaD li i;t) 2tm(rpiydaptnmfvslsfsrumxm ot1teto oeiytlm2rmnvpn(4tlxnxf io1opDr uvi (0srxmio nu1opt  ncslt  Dum(rpoo0opxoiociydfsDul( s t)tetnmr3iotlaDeauesl(  rxrim3ny1openmnvsas  2umurp;t1opxnio3iatfa2elnmon(4artoxo3iatlpt lies s0srtm(o oydll nmfvi t sDrruronu0tpx mi3iadfm2elu p;(4trxrxrcoa1om  lnes (0 exoirpiodlmeemfeia( a2umxrp;t1olxoioetltla ul( on(0aetnxf3oa1opDrai o (0setr(m nu4lmtn fvilsf Durur no1teenmicilt m2elnvs t4altrxf3tytlp elueo ( srtmimpou1al e fcsa(fa2rr(rpou0tlt mfetlt m2eanmsnu)artrmr ty1omtrluvs t) 2toxrpnu4optnlnesl(faDtr(mooo0aeto o3tys aDul( pnt4 rxnio todomDrai o;t  eto(mpno4lmt lncta(f rtau p;t0tlxomociatfm em(mo (4alenxocoa1om e uvslt) eto(m iu4altn fvt ( aDtau p;o0tle io3ilt mDeanvp u0 rxoio3iy1fa  auvo t0sruoxopoo1apenmnetls)arurxr ot1tetn o3iatlsDulnmpn() ltoxocoadom eaueil(0t2umio3io4opt mfvt t)s2ur(ronu4alx  i3ils m2elnmpn(0 rtoxrcto1fp eaivo t  2xo(m iodlmt micsasfaDuaurp;o4aexo o3iltlaDrmn s;(4tltrir io1oate i i;(0 2xoxo iudol nlnet t) rtau  oo0ole ioetydfa rau s u) exrxf oadop r ivslt srur(mpno4lpen nvt sf 2uaump;o1ale iieias m rlnmp;() leomfcoa1op elueol(0 2uoxr nodap   feils)a2rr(  nt1aleomo3tat mDem( ont4trxrmo3oatfmtr uvslt setrxm iydlp  lfct s aDtmx pnt4ape ifetltlmDumnvo (0aexomocty1lmt ai i t srxmio nudalte nes s)aDua(m ou4aleoiieiyt mDum(vpnt4trxnxf io1fpDr u i s srtm(m3iydaleemfetat)aDurum ou1oet iiciytla2eanvont0artrir3oatoa eaivslt0 euoxm3nu4llt lfei (fartmu  oo1tlxniociydls2rl( p (4alermfcootopDelnvo;s)sexm(opou1omtemivt ()a2tm(rpnt4tleo oeiltfmDra(vont4teeomf3ootoatrau o;t seur(m iydomt  fetlt s2trur nt1tlt mietaslsDem(vs;u0texrif3tatfmte u o;(0t2toxo iy4omtemivtls) rur(moot1tpxoif3tatla ulnmon(0 lermr oytfat auvo ( t2trio iudoleemnvi s a2um(rpno0oltoioctaslsDemu sn(0tlenir tadoptrlneo (0t2xmirpoydlpte ivil(fsrur(r nt1tpxoif3iatls2rauvsn()alxrif iatlmte ueo t)teuoimpoy1altn fcsa()a2trumonu1oexnmfciasls2ulu p t4 renmf3oadlm  liei t0trumir io4olte neta()artmuroou4olx mfeiatlm2uau s t)aexrxfcta1fpt luvo;s  etmim iu1llee icsls  rrm(rp;o4olxo ociysfaDea(vs;u0 etnir tadlpD  neils) 2uo(o3oy4llte fei tfs2um(moot4tlxoioetadlsDrl(vp u) reoxo3oodomD  i s;s  2trxmpnydaptnlfvt t aruaxmpno4tlxnmo3tasla2eaumon(4aexnir iodfa  ai ils)trtr(r ou4apte ivt tf Drm(m nt1texn o3tlt m2rl(mp;u)tltriocoo1laD  ues;t0trurio nodoleelnci (faDtmxm ;t4oexnmociasfmDrlnmo t)alxnmr oy1lmtr n s t)truo(opiydoltnlfetlsfarrm(rpnt1oltomfciasfm2umu o u4arerxrcta1faDrli ol()tetoir no4lptnmnetls arrrumo;u4altoioetls sDuluvs;(0alxrmrciodfmte uei ( seurio ny4lptelfesls sDrmxmpnu1apt iieiadlm um(mpn() leoifctotfat  u o;() 2xoir ou4am   nci tf Dum( pno0tetn f3iytfsDulnvsn(4teeoif3iy1lm rli i s0 etmim3oo1aptelfes tfaDtaump;o1apxomoeiyt aDea(mo t0aexrir oa1oa rai o;s srxm(r3iydam nlfvt (faDtr(mont0alx ifctld s ea(mont)artoxf to1fmD aiesl(0seumxr3ny1amee ieils)artrumoot4ale mfetlsfm elnmsnt4texnmr3io1lmDr nvslt0 rumxm3nodll e nvtl( sDrrurooo4tet  fcils m elnvp u4tlenxo oodlmDrli il( srxmio3nu4apee iet ( srtmx ont4tltnmictlsfmDra(vo;(0altrif3ty1fmtrln o;t  rumxopoydal  mnctlt) rur(m oo4tlx  octls m2ul(ms;u)altrxo iotfa   i ol(0 2xoxr3iu1ape  iesls aDrr(rpot4tle  octytla2emn ont0trxomociy1fa eaieo s tetrxo3nu1amenlnvi s  2umx onu0optnifeiadfm2rl( o u0 eerircia1lmt lneils0 2uoio oy4optn fctl(f rtaumo;u0oee ioeiat aDumnvp;t4teeoxfciotlmD aues;(0texrxrpnydlmtelfcia( aruau onu0aetn i3iytfm2umnms;u4 rxrxr oa1op  auvils) rurxm oudol n ncsa() rrm(  ;o4oexn fetasfmDemn p ()alxrir iotfp ran slt)trtmio nu4op nmfeia()a2rrx o;u0opx  f3ias s2umu o t0 renxo3oydfa e ivs;t0s2umim3oudop  lfet tf rrru p;t1aex  i3ilt s rln o t) renir3to1opDean slt0s2uoir3nu4am  lietls srtaxmpoo1alenif3iytlmDrlnmp u)arxoxrcty1oaD an il( srtmxr3ou4altnlietas s2uru  ou4aetniieildla ean ont0 rxrir3oadomD  ivils0 eum(r oydlptn nci sfa2trurp;u4tlxo feiatlaDemuvp;(0 rxnxrcoodfpDelneo;(0trtmxmpoo4omee icilt)s2ta(r nu1oeeoii3iatfa rlnms;(0arenir3ia1omtrlues s) 2tr(r3nodlmen nvi tfaDrrxmoot4optoifeiyt m2uau o u4 etoxociotoatraies s srumio3nu4altelfvi s)sDtax  nt1ole  ieiasfs2emn p (0trxrxr iydomDe uei ()s2xo(opnydlpe  fetas)a2tmxrpou4tpenioctltfsDum(mont0trtnir oy1laDeai o;(0teuoxrpiy4apenmfcsat)sDur(mpno4olt  f3ias sDraumo u0 exomociytfaD aies;t  ruoxrpio1amenlfvi () Dumx  ;u4oltoioeiasfa2rm(vpn()tlxnircoy1omtrauvo ()t2xmirpiu1ap n nvtat  2urumpnt0olt  iciat aDeaumpnt0 lxrxociotfaD ln o t)srtoxo oudlle mnvs () Dra( oou1tlenii3iyt s2em(mp u0 etnxo ia1latr neils)s2to(r3oo1alee nvi () ruax o;u4aptnioctlt m ranms;u4 leomoctotoaDeliei;( seum(mpny1lm e fctls aDrrxrpou0oltoiociatfa2raumo;t)tleoir iydlp raivslt0 exrio iudom e fcsltfaDtmumpoo0tpe mfeiydfa rl(vo u)areomocoatlptelivilt s2tmim io4ale mnvilt a2tmurooo4oee iieiasfs2ea( o t4alerircoy1fatran o;t tetoxo no4olte fetl()aDumxr no1ope moeiyt m emnmpnt0 exomfciotom raivi;() 2urirpoydlpt lfes ( aDrm(ront4teto f3tat s2el( o t) lxrmocio1fa  aivol()s2tmxr3nu4op n icsa(  rurumoou0tex moeiyslaDumnmp (0 rtrxf oa1fmDe i i t) 2um(o iy1ope  iciltfarum( pot1opeo o3ildfmDean s;u4tleomf3oadop elu i t  exr(rpio1ll nlneils)aDtax  ot1tee iietysls2em(vo;(4alxnxf tatfptraneo (0setoir3ny4alenlfviltfarrmx p;t0aex mfeiatls rau pnu0 rtrmfctodlp  lneo;s t2uo(r oo1lm  mnciat srur(ro;o0oetnmfciysfs emu p (0altrxo3oodoaDeaivo s0trxoio3ny1lmtemfesltf rrax  ;u4tet ioctlsfm rm(ms;(0teenmo iadfm   ivil(0t2toirpoo4om n ietas s2tmurono0alt iiciadlm2rm(mo ()tlxrif iotlmDrau o;t)truoxm3iydlpen netasfsrurxm ou4tpxnmi3tysfs2um(vsnt4artoir iadfmteaieolt  rxmxm3io4apee fcta()arraum oo1alx mf3tasfs2emnvo () lerio3iydfm e u ilt0 2xoio3oy1lptelivsas)aDurx o;u1tetoioctadfs2uan on(4teeomo oo1fm   nvi t) 2trio iodomeelivt ( sruaur oo0aptnmoctltfs rlnmont0altrmfctydfp r nvo;( texm(o no4olt  fes ( aDraurpot0aeeoiietys m2rlnmo;()teeoxrctytopt  u o s) rxrir3iu1ap n ivilt)sDraumpot4aeenmi3iydfs rl(vp u0altnif to1lp  lues;(  2umim3iodop   icilt)arra( onu1texo fctysfa umn pnt) rtnmr3to1fmte ivs;s0sexmir oy4ope mivi tf 2ur( o;u1oet mi3iydfs uan o;u4arxrif3ty1fa rlivi;t)srtoim nydlpte ics ()sDrm(rpno0optomociat a2ean o;(4alxrxrciatfmD aivol( sexr(r3oo4omenmneta( s2ra(  ;u0aeenio3iysfs2eln s t4arxomo totomtrln slt  eum(mpoodomtelneias sDua(mpoo4tpen fcilt sDrm(vs t4areomfcoydfp e ivils)sexm(r3iu4olen ics t  Dtmu p;t1oexnifcilt m uluvs u4arxrio tatomt lu i s)s2xoxrpoo4ap  mfvs ()s2tmx  nu0oltn fetlsfm2rlu s t)arxnxocootlaD  ieo t0t2umio oydll nlncs sfa2tmx pot0ole  i3iaslmDeauvo t)alxrxf3totlat ln o s0trxrio3iy4ol  mfct s srrm(ront4tleoifctat a2ua(vsnu)arxoir iadlptr nvo t srto(m3no1altnmfcil()arua( poo1oetomoetasfmDrluvsn(0aexrxo3iodlpDelivsls)tetoir3nu4op  lfei () rtrx  ;u1aexn oetad s2ra( ont0tltnxo ta1latrluei;(0sexmxr3nu1apt lieiasfs2taxrp;o1apeniictadls2rau pn() eeriocty1opDrai s;t trumiopiodamtnlfesltfsrra( poo1oex  o3iydfs eauvp t0 rxniocoy1lat lnvs t tetmxrpiu4opt  nciatfs2tm(rono4oltn fciytfa ea(ms (4 exrmf3tadlp elues;(0s2urio3ou4lpee ncta(f rrrum ;u1optnmo3tydfaDran s t4trxnmfcoy1optrli i;t  2umxopoo1optn icta(  rum(root0aexnmfctlsfs emnvpn()teeoioctytfpDran s;t tetrxr3nodalte icsas)aDum( p;o1tpxnmociad aDul( p t)arenxocootfp r ieol()t2tmim3nu1lle lneiat a2uaxronu1oetnmietydfmDea(vs t)teerif3oytlptrlnvi ( s2xm(r ou4oltnlfvt s srrm(r ou0apxn o3tadls uau pnu)texnxr iotfp eai o t0s2xoxr3oy4lm e fvsas  rtrxrp;u4oleo ieiydfmDuanvp u4 rxomocto1fmDe uvo (0srtoxopny1lp e nci ()a2tauroot0alto feiasfsDrm( o (4aexrxfcoy1omDe nvo;(0s2tmxo3ny1alenmivil(  rrmxr nt4oetnio3iadla el(mont0 rerircoy1lm elu i;() exoimpnydole lietlt)a2um(m ou4alxomfciadfs ranvo;(4teenmrcoodlat  nei;( truo(rpoy4al  lfcias)sDtax  ;o1tlt ifctydlm2emnvonu4altomociatomD ln i;(0t2trxm oy1om nlicsa()a2tmxmooo1olxo feiys m2ul(mp;() eerxrcio1opte u s () exoxo3nudomte nct t) rrmurpnu1tlt  ictld a2el(mp u0 etoxfctytfpDrln o;t0t2trxmpiy1amenmnctl(  Dtm(  ou4ope moeildlmDra(vs;(0aeenir3iadop  ai sl(0 2urxo3iu1lpe lnvt t)sDurxr ou0oleoii3iaslsDea( p () renxfcoodom r ieol(0sexoir io4apt mfesa( a2tau pou1oet  i3tls m2ua( o u) eerxf3iy1lm elivo ( sruoxo3ou1ll e nes t)sDtru  ;o4texoiociysfs el( p;(4tetnxr3tydfp  auvolt srtmim3no1lmtnlivsa(fsDuaxrooo0apeomfetlslm ra(vo;() exnir3ta1fptrlies;( srxr(m3iodamt mncsasfsDurx  ;o0tee iieilsfsDrl(vs;u4 reoio oatlp eln i t0 2umxr nydopeelictlsf Dta( ooo1oeenii3iys m2uan p u)tetrioctodfa r uvi t)srtoxrpnodameelici (f 2ra(m ;t1texo feilsfsDelums t4artnmf3tadomtrlivols0 rxmxr3iy1openmnctat sDtrx ont0ope miciatfsDua(mo;(0 lerxrctytop r i s;s0 2xo(r3no1al   nct sf Duaxmpno1optn o3tltlmDeln o (0alxomr iadfpDeanvi () rxoxo3iy1ol   fct s)sDtmxr ;t1tlenif3iyt mDem(vo t4tlxnmo3iydomtrliei;t tetoim ny1ape liet () Duaumono4tpto feiyd s2uauvs;u4 lenif ootfatr ivo t0trtoxm nydameemfvtas sDuaxmoou4tex mi3ild aDuauvon(4arxrmo ootfmtr nvo;( s2tmxm iudomt  fvsas) rrr(rpno1optomf3iaslsDrmump (0 rxrircoatfa r uvo;()sexo(opnodam  mies s)srtmum ;u0opxo feiasla2umu pnu4tltoxfciydlaDeai ol(0sexmxr3iudalee netlt)sDraum ;u0teeo fciatfa ranvsnu)alenir tydoa rli i;s setrxrpny1omt lfei t)a2urxm ou1opeomoeiydlm uan snu0trxrmocoo1om elnvo s srxoxrpiodalee ncia()artmu  ;t0tetoiieiyslm em( p t0artnmrctadlpt lnvs;t0 2to(o3oo1open ivsa(  Dtmxm ;o1tlxomf3iyt s rmn snu0alerxf3ty1fa rai i s)trto(opou1altn ncsl( sDrm(r oo4apen ociadlsDelnmo (0alxoir3oy1lpt  uvolt)setm(m nodamtemfes s  Dum( p;t1oleo fciydfmDelums;t)arxomrcoo1fp   n o;(0teuoir no4op e fvsatfs2tr(rp;t4aetn ociltfs2ulnms;t4tleoxo3ty1oateaivi s) rtrir oy4lp  lfvslsfartruro;o4alxomoctydfs eanvsnu)trtnmrctotoaDranvilt)setm(m3no4lpte nvs t aDuaxr nu1aptoif3iatlm ulnvp t0 leomf iatlp  livsl(  eum(mpiy4opee fctl( a2uaxro;o0tet  oeiatlmDumnvpnu0 ltnxociodfatraivs (0srtr(rpoydolen ivilsfarum(roou0tee  oeias a2umuvpnu)aeermoctotlaD  n o;(0srxrxr3iudlltelfcia() rrau ooo0alx ioeiyslm eln pnt4tltoxr tatlp e i i t trxrirpiy1omte ici tfaDtaxm oo1ope mictldla rm(mp;()arxrxr3to1fp rlivo;(0seto(opoo4op e ncilsfs2uaxmpot1oeen feildfa2ul( snu0 etrxrctatopD anvsls srxr(o oo4oltnlivsatf rrrxr nt0tetnio3iadfs2rl(ms;u)alerxf3todfm r i il(  rtmiopnu1lmenlfeils sDrmuro;u1tlxomoeias m eauvo;()tlxoif3oodlp elnvi t) 2urxrpnudapeelfeiasfsDtaxro;t1aleoiicils mDumuvs;u0arermfcto1fa r nes;(0 rtoir ou1omt micsltfarum(rpoo4olxnii3ilsls em( p u4trermr oytlptrlu s;()tetr(r3iodlm nlnvil(f rrmx o;u1apxnmo3iadls rl( o u)alerir ootfp eaues (0s2tm(mpiodlp  lncsltf Drmx o;t4tet iicils m rauvo (4aleoxf3oa1lmte nvol()sruoiopiu4opt lnes s) rumu  ot0tpt mf3ias a2rm(vp t4 rxrio3iotoa raneo;t truo(m oydlpenmnvi t artmuronu1tetoifcilt m2um(ms;t)texnio iodfaDeai sls tetoxm iu4ape lfct t)artaxm ;t0teto f3iydlsDulump;u) rerxo3oadfatrlues t  etoio iu4al n fvsatfsrtmxr ;u1tpt  fciys m eauvp;u0 reoir3iadomD  nvo t0truo(m nudopeelfvt t s2tm(m no1tltniieiatfsDemu o;u4tlxoxo tytfmDe i sls0 rtmxm ou4omenmnvsa()srumxroou0tlx mf3iytla ua(vo;(4altnxo3oydop   ivi s)teurir3iudamen ieil(f 2rrxroot4oeto o3tasfm2elu o;()trenmf iydlmtraies ( srxrxmpoydlltemnctl( sDua( pno4tex mieiatlm eau ont) renxr oytfpt  i s t trxm(rpnu4amen feilt)aDurur nt4teeomfetasfm2rmums;t0 ltoir oo1fa   i olt t2tmxm3io1ol   fvsa()sDumx pot1opx miciysfa rlnvs u) ltoio3ootlaDe ieo (0trur(o3iy4alte nctlt) 2umu o;t0tlxo oeiatfsDel(vp (0alenircoa1omDe nvi t)texm(r oudalee neil(f rra( p;o0aeto octyt a emuvo;u0areoxf3todoat aieols0setm(m ou1lm   ieia(  2ur(m no1olt mfctyd mDemn sn(0treoif oodfm e u o;t0 2xmxr iodlp emfes tfarur(mpot4ole  feildfa2elnmp (0teenio iatoaDr n i;(0 exrxopiu4omenmfesas)srtrum nu0oexomi3ils m2um( pn(0arxomocio1oa r n ol()srtrxr iu1optemfvi s  rrrx onu1oltn fetadlm rmu p (4alxnircoatlpDrln o (0 2toxo3nudope  ncilsfarumxr ;t0tpxomictadla2el( s u0altnmrciodoa  anvi;s) rxmxo3nu4amt lnvilt a2uaxro;t0tpxomi3tydls em(vpn(4arxoio tytlpte nvi s setmim3ny1lmt  iet t arta(rpnu1tpe iiciadfm2em(vpnt)alenxocio1faDr uvs t truoio iu1ame mnvtlt aDuru  ;o1ole  oetyt mDranvp u0trxnir3iytlaDrlnvi;t0t2umio3iydal n iesl( sDur(rpou1olto o3ilt s rmn pn(4tlenxo3totom  aiei;s srxmio ou1omenmncsa()srtm(ront0tpeo i3iadla ulums t4tleoxf iatfm raneols  etrirpoudame lfcil() rrr(mo;o0tpenmi3tytfs2uau o;(4tlenmo oa1oat lu i t  2tmxm3oudomtemicilt arum(rpoo4oee mf3ilslm eau snt4texnxrctotoatelu s;s0t2xmxr iudlmeemncsat  2uru ono1aetnmi3tlt m2um(mo;u) rtrir oy1omtrlivo;t  rxm(opiy4lltn ieilsfa2ur( ooo1tpxn ocild a rmuvonu) rtrio oodfmt anes t0 2xo(r3oodolte nct s arur(rp;o4tltnmoetldfa rm(mo;(4arerxocto1lmt aivo;( seuoxm3oo1lpen nct (f 2urur ;u0oetnio3iatfmDea( s;t4areomr iodfptraivilt)sexr(o3iydapeelivt tfs2rrurp;o0opxo o3iyd sDranvsnt4 rxnif3oy1fpteln s;(0seumxmpiu1om n fcta(  2trxr nt1opto octasfmDua(vsn(0 reomo oodomDrln o s0seurio io1ll nliciasf rtmu  oo0opeo oeiytfs rmnvonu4 lxoir3oo1fptr ivo;(  ruoxrpiu4oleelicsl()srta(  no0openioeiltls2rmnvpn(4 rermo iatomt  ieils0t2tm(m oy1oleelncs (fsDtax pnt0tetomfeiytls elu snu4aeermo to1lp rau o;s) rumxm iy4om e fvtlt)srta( pnu4tlt  ociydfs rmums;t0 renmf ta1omtrlnvi s0srxmxm no1lpt  ivt sfs2raur ;o1tlx  ictyd mDul(mp t)aexnmo3tydlpDelnes;t)texo(opiy4oltelfvt ()srra(mpnt1olt ii3tytlsDulu o u4 lenxocootoa   neo s srurxr3ny1altemncil()a2rrxmono1oexo iciatfmDrauvo;t4 ltoif oo1fa  ln s;s  eum(m3oo1al elfvi s srraur no0alxoiociltfa rauvs t) lenio iy1lmtr neil(0s2xmio nydole liesa()a2tm(mpot1altomociat s elumont4tetoxo to1opDrli o;( trumxmpoo1lpeelncs sfa2tr(mo;u0tpe  i3iydfs rmuvp ()trtoifcootoaD livs t)srxoxr3no4llt livta( s2ur( p;t0oexo o3tydfa2rluvs ()artnmociodlp eluvo;t  exrio3io4ol nlieiat aruau pou0ope iieiyslm2eanmpnt4aexnmr3todopD ln s (0setrxmpoodomtnlietltfsDtrxrp;t1altniiciadfm eauvonu4treoxfciytlpD aieo;s) exrirpnydolenlivs ( aDtrx ooo1oeen iciatlaDumnmonu)trtrxr tydomD  i ilt t2xoio3ny1alenlfetat) Durxr ;t1tetomf3iat a rl(mpnt0aexoxfciatoat  u i (0 2trim ny4opee ivil() 2taumo;t0teeoiietld a eln snu) reoxo3io1lmtraieolt)trtrimpou4al nlncia( sDum(moot0alenmf3iyslm em(vsnu0 rtomociatfpDean i;s0tetmio iy1lpeemnciltf 2um(m ot1tpxomfciys m2emnmp u)teermr todopDe ivsl( s2to(r oy4am elivs () rtmx  ;u4ale mictaslm eanvsnt4 eerxr oa1fa  lneo (0t2xrxo3iy1olte nvilt  rtm(rpno0optnif3ild mDua(vo;u0 eerxr oodfmte ieols)s2ur(o oodomt mfesasfsDtrx  no4tle iieildfs ea( onu0areoxoctodoaDr u i;(  etm(rpnydlmt  iet sfaDurx  nt1apt mo3iyt sDrmu o u4teeomfcoatfat  ueil( s2xoimpoo1op nlivi sfsrrr(r nt1aetnmieildfsDranmo t0aeerir3oytlptrlues s0seumxm io1ame licslt aDumx ooo4oet ioctydlsDrmu onu)tlerif3tadfmtrluvils)setrxo3oo4olee ncsat)sDrau ono4tleomi3iltfsDuanvp u0 exnio3iadlpDr neslt s2xoxo no4om n ietas a2rrump;o1ole  ictyt sDrm(vsnt4teeoxf totoat luvi ()t2urxopnydll elfviat)sDrr(ronu4oexomfetltlm2ua(vs;u0tlenircta1fpt  i ols)trxmim3nu4ll  mnvsl(  Drmx pnt0opt mictysls eau p;u4 etoxfcoytlm raivs ()seuoxrpny4ome  netls)arumur no4tetoif3iytlsDemuvo;(4 rxoxo3totfp  lu i t0 2toir nu4lm  lfvsa(fs2ra(moou1tpeomf3tad a eluvp;(0 rtnioctydlmDeaies s) ruo(r oo1oleemiviltf Dtm(  oo0tetomfctasls2elump t) renxf io1om eaivi (0srxmiopny4lle lnvtas) rumx  ot0olt mf3ils aDea( p (4aexrxr3oa1faDrai o (0sexrxrpnydomenlfci s)aDrmumo;o0opx  ietysfmDea(mpnt4 ltoxo iadoaD  u slt s2ur(o iy1aptn ictlsfa2um(  nu0aet  ictadfm2ua(ms;u0 rtriocoo1omtr iei;t)t2xmim io4lltnlnes s srumum ot4altnioeiltla rmumsnu0 eerio3iadop  lu ol() exr(mpio1olen nvt t) rrm( ono0ale mi3iysla um(mo t4 etnmr3ta1fa  lnvs;s0s2urxo nydap  lnct (  Drmumo;u1tee if3iydla em(mpnu0tetrmo3iatfp rln sls0t2tm(o oydameemieia(f rua( ont1opx  oetytfmDeau snu)tlxnio3ta1lmDelnes;(0trtm(r io4lptnmfvt t)a2taum ;o4oltomieildfm umnms;t) rxnmoctotfmDrai ol()t2tmxmpoudaptn nesa(f Dtaurpot0aeeniicilsfm uan ont4trxrif3ta1oaDr nei;s0teuoxo3oudlmtemict sf Drmxro;o4oetomo3iys sDeanmo;t) rtrir3oa1fp e ies s  euo(mpnydam emies t) rrm( pno1tetniiciad a eauvp t4 reoxo oodfpD aueo;t) 2uoxo nu1alee ivta(f 2ua(mono4tltomf3tltla rm(vs;t0 renxf3iatlmD  ueils)srtriopio4omt  ncs ()sDumxmpoo1teto ietas sDul(mo;t4trenxfciytom e i i ()srtmim3iu4apt lncsl()arumxr no0olt  o3iltfm2ul( onu4altnxfcio1la   nesl(0s2toxm3oo1lp n nes tfsDuax p;u0aeeo i3iydlm2elump;()trxnmfcoo1omtr u i s srtrxopnodap n iviat s2rr(m nt0openiocilt mDemnvo u0treoiocoodlaD anvo t0 2urxrpiu1omenmnvi tfsDrm(  ;u1tpxnmocias s ulu s;u)aexoir iodlm eaneo;() rumirpny1optelfei sf rtaumo;u4oexomo3ilsfmDulnvs;(0alxnmo3iydfptrlu i (0sexo(m3oy1aptelivta(  2rrum nu0ape miciydlaDra(mo u4aleoxf3oodlaDeli s ()srtmxmpiy4om  lfvsat)srtax  ;t1openmfcildlsDrmuvp;t4aetnxf ty1la  lnes;s0 rxmxopoydomt lneils)sDua(rooo1tetomo3iydla2em(vs;t4 eenir3iytomDrlies;t texrxo nydll   ictl(fsrrrx pou0apen fctldls2ra(vpnu4aetomo iytlpDraueolt)t2uo(r io4amtemnvtls) 2ta(m ;t1ape mieilsfa2ranvs;u)aexrmr todfmt  ivsls0s2ur(o3iodlme lfviat)arrr( o;o4apeomf3iatlm2emumo;u)texnir oatoateai olt s2umio3ou1amtelivt (fsrrrxmo;u1tetoioetldlm emnvo t0tetoif3tatfptr ivils)s2xoirpou4optelivtat)sDumum no0apxnmo3tasfa2ea(mo (4altrmfciy1om ran i (0setrxrpoy1lptelnesa(farra(  ot0apxo i3iys s2ulu ont)artoif iy1lpD an sl()truoimpny1amenliviatfaDtmx pno1opx  ictls s2em( sn() lxriocia1fa   ieil()seuoxmpiu4lleelietlsf Duaxmp;o1tpe iictytfa rmump;t0aeenmfctydlmt  nvslt)t2urir iydlmt lnetatf 2rrxmo;t1aeeo oeiys sDraump;t0 eeoxfcoa1fa   u sl(0seum(m3ou1op e ivt sfaDrmx pou1aexn oeiys sDemumsnu)aetomfciadfpD anvslt) rtmimpoy1am nlict s)s2raur ou0apen octad a uauvp;(0 lenio3oa1lpDrai sls s2xm(r3nodopeemivt tfartmum ou0tle  o3tasfs2eanmo (4tlerif3iadfa rln s;s0 2um(r3oodlmt  iet s)aDta(mont1oleomfetatla2ra( snu0trtnmociodomteaueo;s  ruo(m ou1lm e iet ( a2trumo;t4teto octatlaDel(ms;t0alenxf3iadfpt ln slt0sexmxm3oydlpte ncia()s2rmu  oo4aeto fcildfsDel(ms u4 lenxf3iy1om  lnes t) rxrio3oo4lpen nvs s) rurxronu1tleoiociytlm elnms ()tleomociydopD an sls0s2xriopiodom  lnciat  2tmxro;o1tee ifeildfa rluvs u)texrxf iytlmte iei t0srxoir3iu1opt  feta( s2uru oou4olx mfetysfsDuln o u)trxrxfcta1lpt auvs;( t2tmio3oydlptelnciatfaDtmxmoot4oeeomocilsfsDelu o u0tetrir3iytoaD au ilt0s2trir3iydalenlnvsl( a2trxmpno1tee  i3taslmDulump t)artoxrcoo1fmDraueo () euoir oo1lle lnvias) 2ra(mp;u0tle ii3iytlm2ulu ont4texomf tydom eaies t) eumio3ny4alenlnesltfs2umxrpnu4teenio3tytfaDrauvonu) lxomr ta1latelieo;(0 2trim no1llte nes (fsDum(rpno4oltn iciatla rln sn(4tltnxfcootfp rluvi s0 rum(rpio1lpeelfvt t) 2ra(ro;o0tpxoif3tlt sDemnvs t)tlxoxo ia1oaD anvi (0setriopiy1ale lnctat  2tmx  no4ape  ieiydls em(vo;(0 eeoxf tadlmDeli s (0 rxrim3oydlle mncia(fsrta( o;o1apx ifeiyslmDeau onu4artrxf3tytfm r nvils0srxo(r3nodopeemics () Duru ooo1aex  ociysfa umu o t) ltnmo3ta1lpD lnvi t0truo(m io4amen fvslsfaDta(mp;t0olto icildfm2rmumo;u)aetomrctatopt anvi;t0srxrxr3nodll elfvtas  rum(r ou0aptomietadfa2uau s;t0altrmf3tytop  auei s) rtrio iu4amt  nei sfsruau p;t4opeo f3iat m2elnmo u0 reomo3oa1la  livi s)t2xmiopnu4alee ieils)srrrumpot1oet mociyd s elnmo u4texnxf3oodfm raieo ()texmimpiy1al   fvs t a2uaxroot1tptn iciltlaDeanmsnt)arxoxocoydop e ivi;( texo(m3iy1lm n nctas) Drrx pou1tlto fctlsfs umn o t4arenio3oodfpt luvi ( texoimpnu4om nliei s srtru  ;o0texn ietlsla2rlums u) rxrxf3todomD  ivo;t)srxr(m3iudlleemivia(f 2umu oot4opeomi3tytla2rau p t)trtrirctydfp elnvolt0s2tm(o nodlpee fcs (  Dur(mp;o4oex  i3tls a2rmnvp t)trermr oy1optrluvi;(0trxr(o iydaptemiciat)arumxm ;t1altoii3tas mDea(vo;(4areoio ootoat ln ols0 rtm(r ou1aptemivils s2tmurpou0apxniociasfs emnvs;u)alxnxo oydop rlueslt0 exr(o oo4ap nmiesa()s2tr(  ;o1optomo3iadfsDelumsn(4 rermoctadopt ai o;s0 exoxo nudll  lici tfs2rau o;u0ope  fetltfaDrluvonu)texnio ia1fmt  ieils t2xoiopnudale lfvilsf 2tr(r nt4aetomfctltlsDrluvpn(0 rxnio3iy1oaDe i slt0t2uoxopno4om  mneias sDtmx ono4olto ictyd mDrmnvp;()trxrxo oy1lm elies;s setm(m3ny4amtemics t s2um(rp;o4tpenif3ilt s rlnvo;(4arerxr iodlateanvs (0 eum(o3ou1ol  lfvi t s2trumo;u4openmi3iat a2ua(vo;t)tlerxociy1fmt lies s0 2xrxrpiy4lme mfes (  Drr(r ou4aee moetat mDum(vpnt0tltrxo3tydfpDranvi;( s2um(mpoo4om  mnes t) Dtaump;o4aee  icildlm2umuvo t4texoxr3tytfa r nvs t  etrim io4ap  lnesls aDum( poo4aeenmi3ilsfaDrl(vs t4tlxoxf3oa1laD li ils)tetoxo3oo1lpe mfciat)sDta(ronu4aex if3tytfa2rmums;t0aeenxfciydoa   nesls0s2xr(mpiodole mict s)a2tm(ronu1olenmoeiadfs2um(ms;(4aexniocoo1lpD aueslt)truo(r3io1ope liciat) 2trxr nt0tltoiieiltfa um(vo t4 rtoxr3tytla r nesls0texrim3nu1openlfvsa() Dtau  nt1olen ietls s uauvp;(4trtnio3oa1lptrau ol()teur(opno4altelnvtl( a2rm( ono1aexo i3iytfm2ul( sn()texnmf3oadoaDrauvo;s s2xmxr oo4lp n fcsat sDrrxrp;t0tpt  i3ilsfm rm(mp;t0tetomo3oatopDrlnvi;s texoxrpoudlp  mieilsfa2taumooo4alenioctadfmDua(monu) rxrmo3tytlat aiei ()t2uo(o oudap  livi t s2umxm nu0optnmiciatlm2emnvo;(4 lxoxo3ia1fa e nes;t s2toir3io1omtnmfcil()a2rmxmonu1tlxnmoeiyslsDra(ms;() rtrxr ia1fat  uei t0 rtm(opno4opeelicsltfarum( poo0texomoeiyt sDum( o;u0 rtnmr tatoaDrlivil() exmxr3nu1ol emfeiat) 2uaum ;o1optnmieiltlsDemn s t0trerio oy1optr ivs;s t2toxo3iudopt mneilt aDum(mp;u0tltn fciyt sDuluvo;(4 lxrxr oatla ean il()s2urirpio4lpe mfesas) 2raumpno0aetomiciydfs el( p t)aeenio3oodlmte uei (0texmim nu1am  mnct t) rur( p;u1tptn i3iat s ua(vo t4altomo3iatfp eaiei;t setoxopio4op emnct s) 2rau oou4aetoiociltfaDem( pnu0 rermf tatoaD  ivsl( teum(opiu1lme  fvs s)srtm(mooo1aexn ieild s rl( s;t4alxrmr3iadfpt  uvi t0tetrxm ou4lmt  ivslsf Dtmum ou1ape io3iyt m2ua(mp;t) rxoxo3to1oa eanei;t0t2xrirpnudop e ivsl( s2um(mpnt4opt  octlsfm uln sn(4 rtrif3iodfpDrlueo;s) 2to(m ou4lpt  fvils  rra(  ;o0tex io3tas s2eluvp t0 ltnmrcta1om elivs;t  exm(o iy4lmen ics s  ruru  nu4tpenioeiyt m2ea(vonu)alerxf3io1fm r nvsls0s2xo(o3iy1lp n nvta()artr(m ;t1apx  ociat aDrmu o u0aeermfciy1oa e nvolt0seur(r3iodameemies t aDuaxmpou1tpx mfeiysla eln s;t) eeoxo todoa  aivolt) euoim3ou4lmeelfvs s a2tmumooo0oexomi3iasfa2elu pn(4aexnxrctadlpDe uei;t)s2xmxm iu1lpenlnct s) Drmx ono1tpe mf3iasls2rmu p;u)alxomfcoa1fp e i o;t  2toxrpio1al  lfvt ()srtr(rpot0alt mo3ias a um(vo (0tltrircto1omD  ueils texrxmpiy4optelfvi t)aDraxm ou1tltn feildfa2em(vsnt0teerio3iadfm rlueo s texmim3nodaptelnct t aDuaxrp;t0tpxoiicilt s rmums;t0 rtrmo3oytfat anei;t0t2urxo3no1aptelnviat a2ur(m ot1aexn fcilsfmDrmnvs () etrmf3oytlaD an i (0trxo(r nydlpe mietat aDtm(r nt1ape mi3tltfm2rmuvp u0trerxr3iytlaDrln s t) rtmxo ou4apt lnetlt srrmumpno1aptn oeilt s2emnvs u4aeenio3tytlmDeai olt0trxoxrpoodapenlfvs s)srtr(  ;u4altn f3tatfmDemnvp () rermf3iytomD  ivi s)srxrim3nodop nmnetat)aDua(m ;o0tpeo oeiyslaDranvo;t) lxrxfcootfpt anvo t) 2trimpiu4lpt mfes t) Dumumo;t0aet  i3tydlsDum( p ()tlxoxrcoytfpDe ueol()teuoxm3io1lltemfesasf Dtauront1aleomoeiyd mDuluvsnt0 rerxr3totlm  aivi;t)teumio3oy1op  licsat)srrm(  oo1olxoiieild a eau sn(4 rtomfcoo1laDelivs;s)truoxm no4ll  mncilt) rrrur ;o1tpenio3iltlaDulnms u) rxnxocoa1fpDrauei;(  etm(rpnudol n nvi sfa2uax  ;u4opeoifctytla2ean onu4tltnif3tadla r u i;(  rtrxopoudlp nlfvt () 2uau pou0olxoifeiyt mDelu p () exrmf oodlpDrlueil() 2umxo nu1al e nvils  ruaxmpou1olenioeiatfa uau o u0texriocoadfm eau o s  2umir iudll  mnctl(faDrru  ;u4oex  ietysfaDrmnms t)arenir tatfmte ivol(  2xrim nu4omenlfcsatfarua(  oo4tpt mf3iasfm2uln o u4aetrxr oadfaD aies;t) rtoxm nodap elfcs s) rtr( o;t0apenmiciytlm ran onu4 ltniocoodlptrli o;s trto(m nodame lici t srta(  nt0olt  fciytfaDrm(vs;t0 rxnif3oa1lmtraiei;t)tetr(m oo1lpeemiet (f Dtmum ;u4optnmo3iasla2ean p;(0 rtnifcoydla rau slt0t2tr(opou1llen ivs () rurx o;o4tltnmo3ildfs2emu p;u0trxrio3iatfateaivi ()srxriopno4lp   ncslsf rta( pnt0tlx ii3tydlm rmnvpnu0 lxnifciotlp raies t0 etmir3oy4amt lietls arum(  ;o0aexo feiad s ua(mp;u0artnioctydfa raues;( seuo(m3nu4lm   ict ()s2uaxrpou0tle mfetas s rln p (4tltnircootfaDelieo s  2xr(rpio4llt lfcsas) Dum(ro;t1tet io3tasfs rmnvp u) etnir oo1om rau il(0t2tr(o3ny4op  mncs s s2uaurpnt4tpe mo3tydfmDelnvo;u) eeoxo ty1fp e i i t)trxm(m3no4ameemics t  2rmx pnt0oleo fcilsla umumon(0artnmf todomteaueo (0srtmim nu1ole lfct ()a2rmx  ;o0alenifciyd a raumo u4 etomr3oadfa ranvi (0trurxr3ou1omenmivias)srururont0aeen f3ilsla2eanmp;u)arenir oy1lp eauvo ()seuoxo oy1lm   fvsa( s2ta( pou4optoifcildfm2ra(vsnu4 ltrxr3iodlpteauvo;() 2umxm3iy1amtnlfvt tf rtaxm ;t4olxnmoctysfa eluvs t)tlxnxrctydfatean i (0s2xmimpoodlpenlfcsls a2uax oot1aexnmf3ilslm eau o (4 exnxo iytop   u o;s0 exmim no1olenlnciatf 2tmxmpoo1tpen ietltfmDumnmpnu0 ltnxrcty1lat ai ol() euo(m3io1amen nviatf 2rrx onu4tlt mieild a2rmumsnu) rxrioctodfmtrlneo;(  etoxr nudal n ics tf 2rmu ono1olenmictls a2rl(vp;u4texoxrcia1fatr uesls)s2umxo3io4apt mnesls) Draxr nu4teeoioetydls2rlnvsnu0 lenmo3io1faDeauvs;(  rxoio ny4lp   nvsa()aDuaxmoot4tpx  iciyd aDean pnt0 rxrmfcoy1oa  ln i s0seuoxo3oodlle  nes tf ruau p;o1olenio3ildlmDul(vp;u)arerxfciytoa ean o;s0t2tmir iudllenmivil( srrmx  ;t4tptoif3tlsls2el( pnu0 lxrxoctytfmDran s t0tetr(r3oudopte nvs s) 2ra( o;t4olxo i3iadlmDul( sn(4 exrmrciy1omD aivsls srtrirpiu4lleemivil( a2rmu p;t4oeenmfeiys a rl(vs;t)altrmrcoydla eli ils0srtoxrpio4ale  nesasfaDur(  ot4apxo f3ils m emnvp u) exomociytfateaiei;s  2xr(rpiy4amtelncsa() 2uaump;o4alenmieildfa eauvsn(4 lerxr3oytlp elueo;t) rxoxmpiu1llt mfesas srumurpnu4aet  oetaslm2el( o ()trxrirciy1fm  lieo (0trtmxr oo4op  mfcsa() Dtm(mo;u0aee  o3ilsls ua(msnt) etnxr3tadlaDraieo;t  rumxr io1optelicsl(fartmumpot4tpto oeiad m el(vpnu0tlxrxf ty1laDeai olt s2to(r iudllt  ivs s srtm(m oo1teenmietytlaDra(mp;(0texrxfciadla rlu i s  exrir nodal e fei s  Dur(m nu4opxnmiciydlm ul( snt)tetrmf oo1lmDrlnei;(  2xmxr3nu4amtelfcil(faruax pou4oltn fcilslm2rmumsnt4 ltoxfciydfm  lu o ( trtmio nu4oleemneias srtrxmoou0oetn fciltfm2em(vpnt4tltrxf3oytom r ivolt0tetoiopio4llenmncta( aDrmx  nt4aetomo3iytlsDumn o u)teerirctodlaD aivo s srxoxr3nydam nmiciat srur(m ;o1tlen icils sDumnmsn(0texoir3todlatr n i;t  rxmio3ny1al  mnet ()s2tmu pnt1tpx mfetaslmDrauvont4trtoir3oytop rauvol( seumxo nodll   nviat  2tm(  ot0aetoifetaslaDul(vp;() ltnir tytomtelneslt  2xoxr3oodlpe  nvtasf 2trumpot4olenmi3tyslsDemn o (4artomr tatopD anei ()setrirpoy1lpenlnet t  2taxr ou0tpto i3tyt m elnvp t)texoxr iy1la elnvo s0trtr(r3nydaltnmies (f Dtrurono0aptomi3iydfmDum( o;() rtrxr iydlp eli i ()tetmir io1lmt  nviltfaDraxro;t1tpxomfctldfaDrm( pnu0altoxocoytoaDe u i;s0 2toir ny1ap   fcils  Dur(rpoo1tee moetlslm eluvs;(4areoio3iotla raieilt0teuoxr3oydop nmncsat)arurxr nu1oexo ieils a um(mp;u4tetrxfctadlm rlivi;t0srtoxm no4lmeelfvtas  rumumpno0teeo o3ildlm2uln snt0tlerxrciatopD  i ols0t2xmxmpoydol   fcta(  rrm( pot1alxnmiciytfm2rlumo u)texomo ta1la rln ilt0seurxrpiodopeemieilsf 2ta(m no0tlto o3iadfm2rlums;t4aleoioctotla rlnei;()srtr(r io1lltn fesasfsDtrxrpnu0alt  fctls a2umn p u)altrir oytlm   iei;(0trxoxr3iudoptnlfvt tfarrax o;t4tpxnmietyslsDean ont)alermociadfm rli ols)teurio3nudolt  nvta(fsrua(mpno4tet ii3tyslmDuaums;t)tetnmf3ootopt livsls truo(m iy4alt  nct sfs2ur(m oo4ale  fciydfa emu s;(4 eenif iy1lptrau il(  etoir3ny4lm  mics ()sDur( pnu4oex  ieilt s2el(vsn(4arxriocoydlm   u i t0 2tm(opoo1om n fet (fartm( pnu0opxnmoctyd s eanvo;u4 etoxfctotla rlivi s)s2umxr3oudol emneslsfa2taxm ot1oexnmi3iadfm2ean o ()alxnio tydlp   nei ( trxo(m ou1ll eliciat)aDur(r ot4alenmieiat aDuan onu0tlxrxr iotfm  aieo;t) etmim iudope  fvt (fa2rrxroot0teeo oeiydfa2el(mon(0tlxoxf io1opDr n o;s teum(m3oodlpeelicsa( artmxrpoo1oleo fctatfaDumumsnt0trermrctatlp eli o s) exr(o iy1ol nlnetat srrmxront4apt mieiasla ul( s;t4alxomociadopDrlu s;s) rtoxopiodlp nmnvtat sDta(mooo0optn icils sDelumo;t0altrir ootlm rlneo;s s2um(mpny1olenmfvsls)sDurxrp;t1tet ioeils aDelnvo (4 renio oo1fmDeau ols trtrxo iu4aptn fesas)sDtm(ro;u0opx  ieiadls2umnvpn(0artoxr3iytoaDe uei;t t2umir oydape mncsasf Dtmxrono4tptniociysla eau o (4 ltrmo3iotopD  u s;( t2xrio nodlm  mfvtls)srtm(  ot0aptoioetatfm el(msnu0arenxocoatoat  ivi t0t2uoxopnu1apeelieils a2rru ont0opx ioeiltlmDul(vp;u4artrir3ootoat ai ol( trto(o ny4opt  ivsa(f Duax oou1oet  fetls aDrl(vp;(0altomrcty1fp rluei t0srxrxm ny1
\ No newline at end of file
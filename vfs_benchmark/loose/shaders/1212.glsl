@@ -0,0 +1 @@
+i il(0 2xrxr nodale  nesasfsDtr( ont4tleniociatfm ra(mo;(0tleoxo io1lpDrlu o t sexoxm3oydaltnmnvi ()aDurxr ;o4optoioeiydlmDrlu s (0artomf totlmDeaies s0 rtmxrpiu4ol nmfeias)artrxm no1oetomfetysfm2ra(vpnt0teeoxrctotopteaivs t0 eumiopoydop  miet ( srrru poo0olx moctltlmDrmn s u0teerir tadop raieil(0trxrxmpnu1ole  nvs s aDrr( pnu0apeniieiyt sDea(mpn()arxnifcta1la  ai o;t)t2uo(r3oy4omtelnvt t  Duaurpou0opeomo3iydlm ean p t4 lenxocoa1om rau o ( truoxm oodomenmnesl(  rtr(mont4aetnmoeilsfs2ulnvp (0 renir todopt li s s tetoxo3iydome lictas)a2uax  ou0teeoio3tadls2umnvp t)alxoirciotomDraiei s s2xrim3io1ome mfvtasfsrrmuroou1aeeo fciysfm ua(ms t)teeomo3oadfat lnesls) rxrxo3oydlptelfvilsfsrtaxmonu0tlxnif3ild s rmuvpnt)trtoir3oatoptrau i;() 2umim oy4lpen iet (f Drrx poo1altniieiytlmDelu snu0alxnxocoa1la   i s;(0teuoxrpnu4ale mietl(faDraxr ;o0tetn ieiltls el( on(0arxnifcty1faDelieo;s0sexr(m iu4ap  mfcsasf 2taxrpnu4apt moeildfmDem(vpn(4alxrxf3oytfaDeln il()trum(r iu4ol nlnvt s  rta(rpno0tex  ietat mDrau sn(4 lerif3oadfpteanes s  rurir3iu1ol nmiei sfsDurxm ;u4oetnmieiltfsDel( o u0tltoio3oy1lmD  n o t0teum(m3io4ll emneil(f 2um(rpou1aexnmfetltfs eau s t4 rxnmrcoo1lm e uei;t0 2xo(r no4lm n fvs s) Dtmur ;u1optnmieiatfm2uaumo;()altnxf tytom r u s;s)texo(o nudlm n fcs t)sDta(r ot0ale  ietldlm2em( s t0aeenif iatoptr u i t sruoio iy4ap n ncs s artrx  ot0tpeo ociltlsDeanvsnt4 ltoxocoodopD aivi t)t2xoio ny4op emfeia( srrru  ;o1apx moetlt aDul( ont4 lerxfcto1fate i i;s0 2trxm3ny1amee icsas) 2urumpnu1teen ieilsls2eln pnu0aeenmr3oadomte uvol()seuoxr nodlm  liei s)sDua( pot1olenii3ilsla ulnmpn() rxrir tytlmtrluvi;s0sexrirpiu4omtelnvtas  2urx p;t1tlen fetld a2rmump u0tltoxf iadop r uvsls  exoxm3nodlptemfeil()s2ta(moou1tlxoii3tlt m elnms;u)areoxocoodoat lu ilt  rxrio iydap nlicsl() rtau p;o1aex miciysfm2eln o;t4 ltoxrcoydfaDrli sl() exmxr3nydalen fesa()srtrur nu1olt mi3ilt m2umuvs u0 lxnxr tatoptrlnesls) etrim3io4lltelfct tfa2um(ro;u4oee ii3iadfaDeluvs;t4arxoiociy1lm elues s0sexrio3oy4apenmncslt) Dumx oot4olt mo3iysls2ea(vs;(4trxrmr tatoaD aivo s) 2uoxo iudopen ivtltf 2ta(mp;u4tlxomociysls ulump;u) rxrio3oadlmDrlu ol(0trxo(m3iy4ale mncsa(fsruaxrp;t4opx mfeilt sDem( o;(4 rtnmr3ootlat aieilt) etoir3nudapen icils)aDtrumpot4olxo f3tls s2ua(msn(0tlerif iodfatr neils s2xo(opnu1apen nviasfa2rm(mp;o4olx  oeils a rmn o;t)alxoxfcoytfm e ues t0seur(o3oudlp   ict tf rrauro;u4aptnmo3iltfmDeluvo t0altnxrctydlmDr n s;t0srxrim3iydal emnvsas srurumont1tlx iiciysla2rm(vo u0aexoif iy1fp  anei t0t2uoxr oo4lmtn ivi s)arua( o;t4optnif3tadfaDuauvsn(0tetrxr3iatfmD lueolt srxmxo oo4lm   ncia(f Drrx poo1tlen o3iydfa ra(vsnu)altnmf3to1opteli slt0s2uoiopnu4amt mfci s  Dtmx o;t4olxoiocilsfm2umumsnu4teenmo3iodomtrlivols  eurir3ny1lm emnvs t srrmx o;u4tlto ictadla2rm(vp t0 lxoio3oydomD  nei s  rtr(r ou4apeemnvil(faDrrumo;u4oetomfetldfs2um(vs;()texnxf3iy1la eanvo ()srurxo oo4am  mfctlt) 2umumpoo1tlto i3iys a elnmpn(0tlxnir3oydfat  ivil()s2xoio3ny4lmeemncta(f 2tm(mpno1alxomo3tyd s2em(mo t0 ltrir3oy1fa rlnvols0setoxr no4alenlivsas sDur(mp;o4oeeniieiysfa uanms ()areoxr3tadoa rln o;t s2tmio iudlmtnlict s)aDurx oot0ale  feild sDrm( s;u0 ltrxf3todfa e nvsls0 2tmxr nu4amtnmnvilt sDum( o;u4aexn fciytlsDum(vo (0 eerxo3iodfm  ai i;t t2xrxo oydomeemivia()arraxr ;o4aex mocias s2em(vp t4trtrmr oy1fmDe n i (0srxo(mpoudope lnvs t artru pnt4opeoifciad mDul(vp ()aexnxf todomD lues s0 eum(o oodaltnliesl()s2taxrpoo0texomi3iasfm2umuvsnt4artrxr3oodfmDeau s t)trxrirpoo4lmen ics sfs2ra(r ;o4tlx ii3tasla2um(mp;(0artrif iotoat  uvo (0s2uo(m3iodam  lfes (f Drm(m nu4tlx ioeiadfsDemuvsn(0arermo iotfp e u o ( teumio3iy4amen ncias)arrmx  nt4apx mfciasfa um( o u4aeermfciy1oat lnvo t)seurxmpoudam  lfvi tfartaur ;o4alxomoetld s emnmo;u0 exrxociy1fat  nvi;(0 etr(mpnudomtn ncsl(f Drm(mooo1aeenmoeiltfmDrlums;t)tlermfciodoa elieo t)trxr(rpiudomtn iesa( s2ua(rpoo0tleomfeiadfs2ulu ont0 rerxr ta1optr neo;t0trtoir no4alen nes ( s2tr(mpnt0apxnifcils a rl(mont)arxoxfcoytfmD aneol( t2tm(m oydam nlfvtl(fsDtrx  oo0opxoiieils aDul( pnt4 rtrmocia1om   i i;t0 etmxm3oydllt livilt s2tm(mpoo1opt  ociyd m2uluvs;(4 etnxr3iotop rai s;t0 2uoxr oo1al n ncsl()s2ra(monu1ole iiciyt s eauvo u)areomf3todoatr i i s0 2xr(r3iydam nlnvsa()s2tr(r nu4oleniieils aDuln onu0aetrxr tytfmD  ueo s)srumxr3oy4lme  fvt s  2tmx  no4tptoiiciltlm rmnmo;u)areomocoadoptrlivs t  eum(mpoodllte nesas)sDumump;u0tptoii3ils m eln s;()texrxf3iatfm ranvs;( t2xrim3iodopte nei tfsDrruro;u0tetn icildlm rlnvs u)aexrifcoydlaD luvs s0 exrir3oy1am   nvi (fsrumum ;t0opeoif3iadlmDraumo;(4 rtnxr3todlpDr iesls) 2xrim3ou4omen fct s sDta(mp;o1tpxomo3iyslmDem(ms ()tetrio ta1lmD  ieils  2xmim3nodomen ivt ( s2raxro;o1oexoif3tatlaDuln ont4 rtoxrcoatop rln o t0 rtm(opoo4ll nmivt (fsrra( oot1tex  f3ias mDra(vo;u0 lxnir iotomDrlies (  rtm(m3no4altn neils)aDrm(ronu0tpxn octltfsDua(vo;u)aetoircoo1fa e nvslt srto(rpio4lme lfcta(fartaxmpnu4olt iieiad a2uau p;u4teerxf iotomD aueilt)t2trxm3iodopen netlt)a2uau o;u1tlxoifciysfs el(von(0trxnifctatlaDelneil(0srtrim3iy1om  mnvtlt)srumum no4aeenmoeiat a em(vs (4arenxoctytomD  ivsls0s2xmxmpoodolee ictas  rrm(mooo1tlxnioeilsfaDelumo;t0tlxoxfcoa1op   n o () rxo(r iydlle  fet s sDum(r nt1apeo o3tldfs2ran o (0 etoiocoa1lpDe i i;(0trtoxr nodameelnci t)s2rrx o;o1opto ieils m eanvo ()alxrxf3tatfaD  ueilt tetmxm3ou4al nmics s sDraxmoot4tpe mietat sDrluvp;() eenmo3iodfmt  u ol(  rxr(r iydlle miet t arur( p;t0tleoifcildfm emuvpnu) lenir3oatlaD  i s (0t2xr(o3nu4op elfesat)s2rauro;u0alx ioetlt a rluvo u4alxnir iy1oaDr u i t  2urimpno1ap elfcsl(fsDrm(rpno1opxnmociat aDeln p t)arenif tydoaDran s;s0 rtrio oy1am elicias  rtmxr nt0oee if3ildla ra( s u4 etnir3oatfpD livs;s)srumio3nu4ope  fet ( sDua( poo4alenif3ild mDrm(vs ()texoiocootoptr nvsls trur(opnudamt  nei t arrm(r ot1tlxn o3tatfm rlu s ()artnxfcoodom  aies;t0texmxo ny1lp elicia()aDtaum nu4tpxomfetys s2em( o () lxrxfciotopDran sl(0setr(m oo1amen iviltfsDrmxmoou0aptomoeild s2ea(vp;(0artnircio1omtr ivo t trxoxr3oudome mnetlt)srtr(moou0tptnmoeilslaDrauvp;()artoirciydlpDranvi t  etoxrpiu1lltnmivsl()arrax p;u4teeniicildla2eauvp (0tetrio todla   ieo s) exrir nu1lmenlfeils sDur(ro;u4apxoifeildls2ea( p u0 eeomr3ty1fa eluvs t  2tm(m3ou4lmt lncil( sDra(mp;o1oex  fetlsls elu s;u) rermr iytfpt an o s s2umxo3oodaltemfesl()a2umu  ou1oet  o3iasfsDrlnvs;t) renir3oytoat  ueo;t0trum(o nu1lm e netlt s2tr(r ;o1tpxnmo3tyd m umn on()treomr3ia1fatrauvo;t)s2xmim nu1ome lncs s artrump;o4aeen ociatfmDuln snt4aeermf iadfmtrai s;t t2xoxopny4openmncsasfaDraxrono4tpxomietld s2rln p;u)aetomo3oo1late nesls)texr(rpiydlp  lnvsls)artaxr ;t4tltnmfeiad mDemn pn()arerxrcootoaDr n o;(0 2trxmpiudll eliesasfa2trumont1oeen icild m ulumpnt0tetrxf3totfpDrau o t)setoir3ny4omeelnct (  2urxr ot1aet ioeiydfaDem(mp;(0 etrxocta1lmt li slt s2urim3oy1am e ivs tf Duaxr ;o0oex mfciatfsDean p () ltrxo3tydla rlu ol()tetoim no4altelncsl( a2raum nu4apx  i3iyd a ulnvp;u)tlerifcio1laDe uvo s0 2uo(mpno4omen ieilsf Dur( pnt1tex  f3iad a rmuvp;u4arxoxfcoy1opDraies s0srxoxrpoy4opee ivtlsf rta(m ;u0aet mi3tltlsDuanvp;(4teeomr3iytlpDe n ils) exrir iy4lmte iei s)a2ra( ooo0apeomfciytlm el(vont) lenmfcoatlptrlues;s tetmxo3iy1oltnmietasfsrtrx poo0apx ifciytfaDrlnmp;(0 eenxo ta1lat lieo t t2xoxopiudlm n fvt (f rur(roou4apen iciytfm2ran pnt) lxrxfctadfaDrlueols)trxr(opiydol elfvs (fsrurxm ;t0aex  fctlslm eanmo;u)texnxf tatlatrlneo;s trxoiopiudol   iesls s2tr(m ;u4teeo iciys mDel(vont)aleomr iydlpDeaieo ()srto(o3oo4om n iciltfa2tau p;t1texoifetasla emu p;(4trxrxf3iydfmDeanvi s)t2urxo oodalt mivs () rrmxmo;u4aexo o3ias s2umn o;(4alenif3tydopte ieslt srtmio no4lptemicias) 2rmurpnt1oeeomoeils s ua(von()arerxf tatoptranvils0 rurxrpny1opeelietl(f Dtrumpoo4aeenif3iat s2rl(vont)tlxnmr ootfmtelueols  euoxo3iu4amen ictasfa2rmx o;u4aeeo ieilsfm em(vs;u4 lxrmf3tydfa   neils  rurir3iu4lle mivsat aDtr(  ot1tpt ii3tatlm2eaumon()tlenio totfaDr nvo s  rumim3iu1lme miesls  ruax ono1altomi3ilsfaDum( o t4 renmf iotla eanes;t s2xrir3oo1ope lietltf 2rm(rpoo4aeeomf3ils s2rmnvs;u4tetomr iotfmD ln s (  rxrxopoo4apte nct ( s2tr(m ;u1oleomf3ild a umu pn() eeoxocoydfm rluei s  euoimpoudlmte fcsatf rtmumont4tet mociytfm ranvo (0 eermocoadfatran ols t2urir3iu1lpen nct (f Drmxro;u1ole mociytlm2uauvs t)artrif tytfa  anei;t)t2xoxr3iodllenmnviatfa2ta(roou0openmietldls2el( snt0 ltnircio1lp r iei;() eurio3iodap n iet t aDrruro;u4tpt  f3iytfmDul( p;()arxrxo totla  auei t sexo(m3no4omen nei sf Drm( o;o1apeoiiciyt m emu pn(4 eenmfciy1faDe ivs;(0teum(rpnodomee nvt () 2tr(r ;o1aee  ictatlmDelu o (0trtrxo3ty1faDeaies (  exo(mpoy4olt  ivias) 2rr(  nu4aet  f3tls aDrm(mo t)aeenir tadoptelnei;s  2uoxm3iu4oltemnvtatfsrrax  oo4tptomo3iysls2uln p t0 rtrifctadopD ai o;t0 2uoimpoo1alen feil(fs2urx o;t4tlxomi3ilsfa2umu pn()tlxnmrcty1fmDean sls0t2xr(m nudame lfcil()sDumx o;o1tpx  o3tydlm2eaums (0arxrio iytlatrlueo;(0t2umir oo1aptemfvsa(fsDraumonu1oltoiictytfaDel(vo;()texomf iy1opDeln i s srtmio io1open nes tf rtrxmono4tltnmfctlsfsDra(vs u)trxnxo iy1lptelnei;(0 eurim3nodop emnvi ()artrumpno0ole ii3ilt s rmu o;() eenifcoytfmDe nes;s s2ur(r3ny4omeelietlt  rrmxmpou0tetn ictltlm ua(vs (0 lenircty1fpte ivol( tetriopnodol e ieil(  Drr(m ;u1tlenifeiysfsDraumo (0tlxnmf totlmtr i il() rxoxm3oo4lp e fciasfa2tmxm ot1texnmociltfaDemn p;u4 etrir oy1fpDeliei;s)t2urxopio4apenlfcils)arrrx o;u0alx  fctlsla2umn pn(4 rxrxfciodlm rlu i s) etmirpio4ol   fcs s)sDtrx pnt0optniieild mDul(vp;u4trxrio oytla  liei;t0 2xr(r3no1lpeelnesl(farrru oou1tlxoifciat m2umu s;u4areoxo ia1lpDr uvilt0s2umimpio1ll nmfcsat) rurumo;u4aee ii3iytfmDemnmp;u)trerif tatlmD lneo s)s2xrim ny1am  liesl( a2rmxrp;t1tlxn ietyslsDel(mp u) ltnmo3tatoptr neo;s0 eto(o3iu4om n fesl() 2uax  nt1aleo o3tytls2elnvsn(0 lxnir3oo1latr ieilt texoxopiu1amen fviatfsrtaxm oo0optnifeiys a rau p u0 rxoxocoodlm e uei (  2tm(r iy4llenlnesl(  2rru pnt0tlto ieiltlmDean p;(4arxrmo iydfm eaieolt0teumim3iudapenlfet t  rum( pnu0ape mi3iysls elnmp u0 exoxr oadfat  iesl( srurxo3iu4lpt  ietat) rra(rpot0aexn o3iatla rmnvp;u4arxoif3ootomDran s (0texmimpiydlpt lnesat)arurxroou0opxoif3tlslm2rauvs u)texrxo3iydom   uvo;t0 2xrim iudamte fvslsf Drr(m nt0tltn octys mDeauvs u)aleoio iatoaD livolt0 rurimpiudoptn nvs s aruaump;o0apxnmfciasfaDel( pn(0 ltomr oa1om r ivs ( seumxm3iy4llt mies s a2ur( pot1tpx io3tltfa eanvpnu)ar
\ No newline at end of file
@@ -0,0 +1 @@
+nvils  rurimpio4lmtn fcta()s2raxr nu1ale  iciysfmDem( pnt0tltnif3oa1fmte nes;t) 2urim nu4apt  fci tf Dra(moou1tpxomfciltfs2emuvo u0arxoifcoydopteaueol()s2tmim oo1lle lncilsf rtmxr ot0aet iocias s em(mont0tlermrctodfpt lnvs;s0sruoim oo1amenmfvi s s2rr(roou1tlxomieilsfa emu o (0arxnxociodfpDr ivi s0trtoirpno4ole mnvsls a2tm(mp;o1tpeoiocias sDeanvs;u0aeerxf3tadoaD luei;(0s2urxopnydomenlics s s2raur ;u1tetomieiytfmDuau pnt) lenirciodfa raies s) 2tr(r iy4om nmics s)aDtm( pnu4tetomi3iltfm2eluvp;() rtriocoo1lmt  i s s seto(m no1oltnmieils)s2umuro;t4oeenio3iysls2umu on(0aetnxo3to1oaDeli s s)trumxo3ny4op  licilt)srrax  ;o4tlenmoetad sDul(mpn(0tleoif iatfa r ueolt0srtmxmpno4op e nvt s aDrax oot0opxoiieiat s rluvpnu0 rxnmfcoa1oaDeaieo (  euoim3iodolt mnvtat)sDta(r ;o0optnifeiysls umn p u)trxrmrcoatoptrli i ( trxm(r3nudal emnvs s a2raur no1apxnmietysfs elnmp t0aetoif iy1optraivs;( sexoirpou4amtn fvslt)srtmu  ;o4oetnmi3ias aDeauvo t4tlxoiocoydfmD lneilt)s2uoio3nu4ale lncs sf rrmx ooo4apxoiictlsfm ul(mp (0 reniocoytlmteaies s)t2umxopiu4llt  fvs s sruru pnu1opxnifcildlmDua( s;()trenirciydla rlivs;( tetmxr oudlpe lfvtls)sDua(m ;u0oetnif3tldfaDemums;u0alxrircto1fm eli o (0s2umim3oy4lpenlfesl()a2tmx oou1altomiciys a2ea( s;u0arenioctydlp r i slt s2uo(m ou1lltnlfvias)a2trumpou1apto fcilsfs2um( ont0tltnxr iotfpt  u il(  rtmirpno1oltnlfvia( srra(mo;o1tlxn f3ils s eanms t0trtrmf3iatlpteanvo (0srtoir ny4apt  iesltfaDraur no4altomf3iys s2elnvs (0 lenirciydlp  li sl()sexr(m3nu4omtnmfvsat) rrm( ooo1alxnmfctytfsDuluvp;u4tetnir todop   n i;s) ruoim3iodapte nesatf 2um( poo0tlx ifeilsfsDeluvs t0aetoif iatomt aivs;(0 exmxm3oy4oleeliesasfsDumxm nu0tleoiiciltfa raump t4tetrio3ia1lp eau ils) rtoxopiy4ll  mfctas artmx o;u0oleomieiat aDelumont4aexomrciytomtelu il( trtm(m io4alenmfvsl( aDtrx  ;o1tleomo3iysfm2ranms u) lxoir ta1fa eaieo;s trto(mpou4ol e ieta(fsDta(  ou0olxomfctlsfsDulnmo;()tlenxo iadlpDeanvs s)sexm(r oy4llenlncsls  rurur no1altnifetld s ua( snt0 rerxr oatfateai o;() 2to(m no1ll e icta(f Duaur ;t0oexoii3iat s2ulums t4tlxoxo ta1la   ues (0srxrxrpiudape liviltf 2tau  ;t4apenmfetatfs ra( o (4aeenmfcoytlmDeanvo t)s2toxmpny1ol  mivia( arrrum no4oeeo fetltla2uau s;t4trxoxf3iodop  luvo;t  eurirpoo4llen ivslsfsDrax  ou0teeoiicilslsDumuvs ()alerxo3ty1omteauesl()seuoxr3ny1ope livi (fsrrau pno4texnmi3iat mDulnmon() etrmo3tydlat  n s () exm(r3io4ome lfvtas s2ur( p;t4oexomf3ias a ra(monu0tlenmo iadlp r ueo s) rurim iodap   netl() rrr( o;o1tee miciatfsDrmu pnu0teenxf iatoptraivo;(  2toxrpoo4amte ictl(faDur(mo;o1apx moctadls2elumo;u) rtoxo tatfmteau o t)sruoim3io1openlfciasfsrrr(mpoo1alto ictad a uaumo;t0texomo totlmteli ilt srxoxmpiy1lptn nvs t) rtmu pot0teeoioeilsfmDeaumpnu0 eerxo iadfpt anesls0setrimpiy4lmeemneils  2rm(r nt1apxomieiys s2ranmo ()trxrmo3totfpD  n s;s0 rxo(m3oydoltn ncsas)sDum(ro;u0altnifeiatlsDrmuvs;()aexrmocty1opteln i (0t2xr(r3iydlleemnvt s)sruaurooo0tle  feiatfm2rmn pnt4 rxnmocoy1fm rau slt0setrxm oo1lp e feils  rumxr nt0oltnioctlt m ranvs u) rxrmrciotlpDeaues;( t2urxr nudlpen icslt) Drrxrpno0oeto fcildla2rl( o;u)altnmr iotfpt auvsl( seurxo3ou1lpe  fci ()aDrruroot1optn feiltfa2umnvs;(4artoxf3iotomte n o s0tetoxm oydll e ivias srtru  oo1optnio3iatla2rlnmp t0trtomrcia1fatelies s  rtmimpiodlleemivsl()a2trxmo;u0apx  f3tld s elnmo;t0tlxoif iytfp e uvi s)trxrio3oo1am e fei tfartm(m no1oltnmi3tltla rm(vpnt4arerxf oa1lp eanvi t0truo(o3oy1amtn netlt aruaurpno4olxomoetltls uauvp;u0tltoiociatomDrlivi t0t2xoxm oo4lmte ics tfs2rru  ou0oexoio3ilsfa uanvpnt) lenxrcoadfmDranesls) exm(o nydomtnlfvt () Dtm( ono4aexnmi3tldfa2emumsnu)aleoirctodfm  lnvs s)s2toim3oodll   nvtls  Duaxr ;o1aeeo o3iyd mDuln s;u)teeniocoadla e nvo s) rxmxr3oy4amee icsls)s2ta(r no0alx iictyslmDrmu o;() eeoxo tydla eluvo t0teuoio3ou1ape mfcsat)aDuaxmonu4olxomfeiyd sDeluvs (0tetoifciadfpDeanvs (0teuo(opnudamt  nctls)sDrrum nt4oeenifeias a2umn s;u0alxnxf iytfaDe uvs ()s2xm(m oy4oleemivt tfa2trumpnt0altomoetyd s2rl( sn(4trenmrctodfp rluvo t t2xrxmpio4ap nliet ( aruax oot4aee  oeiys a eanvonu)arxnmfciytop  li s s0texoimpoy4lme lfes t  rumu  ou0altnmfeias a eanmo t4 rerio3oo1fa  anvi s s2umxr io1lpenmnvt (f 2ta(mp;u1oex if3iatfm rluvo;t4aexomfciytlmDr neils0t2ur(o ou4al emietlsf Dumurp;o0aetn ociatfsDra( o (0teeoif iodfptr ivi;s0trurxm3iy4omtelncia(f rtmxroou1tle mi3ilt a rluvp t4tlxnxfciy1lmtrlnes s truo(r nu4lpee fcil()a2uau o;u4tlx if3tlsfsDemump t0alxoir ty1faDrli il(0seumxr iy1amtelfcsl(faDua( oot4apt ifciytlm rmums;u0trtnxfcto1omDranvo;s s2tr(m3iodapeemfciltf Duru  ;t0tpe  fctlt a2ulumo;(0tetrio3ta1fa eaues;(  2to(m3iu1lm e ivs sfs2rau  oo4teeoifeilsfsDrm( o;(0 ltnmr3ootlaDeau i s0s2tmxm no4apte fviat) rtm(mpno0oetoio3iyd a2rl( pnu0trxrxf iydlpDeai sls)s2trxr3iu4aptelnetl()artrx p;u4ale  i3ilt aDul(vs t0trxrmo tydlm ranvilt) etm(rpiu4lpenlfcsasfsrraumo;t1olx  ietltla2rmnms ()tetoio3oydfmtelu s;() rtoio oodomt mfvi ( aDumu pno0texn fetatlmDel(ms;t0 exomf tydlp eln s t  2xmxr3iu4aptelnvias a2urxm ot1olxnmoeiadlaDrmuvs;t0tlermo3ootopte ivs;( texo(r3oy4omen ics (f Dtaxmoou4ape  fetyd aDean s;u4 etrir3iy1fmD ln i s)s2xoir3oydlme  nciat sDrrx pou1tleo fciadfs2ulnmon(0 rxrio todop r nvsl()seuo(r oo1oleemiet t)srtrx p;u4tpx mociytfaDuanmp u0 lxomf ia1laDeauvs;( texrxm3ou4op  mietl(f 2rrxrpou0opxomo3tltfa ranmpn(0alxrmo io1oa   uvi;s  2toxr iy1lp nmfeta()aDuaxm nu4aexnmiciatfsDrmuvp;t0texnmoctodlaD lnvi t0 exoio iydlme  ivs ()artrx p;t1opxoiiciatfa eanvpn(4 ltrxr tytlmtean i;s0s2xoxrpny1al e iesl() rra(rpnu0opeomf3tlsfsDuauvo u0aeeoif3tadfmDe ies;t)texmxrpoydam   ivils  rtaxroou1alto oeiat m2el(vo;t) eeoxociatlmDrlueo;s0setrxrpoo1lptelnes tf Drm( pnu4oexnmo3ilt a rlnvo;u0texrmr3ootfpDr n i (0s2xoxm3no4oltnmiesls  2taumpot4alx mfctys s ulnmonu)areoxociydfmteluesls sexmxm iydome lncsat  2urumo;t1aeeniictysfm ul(mp u0trxoifctydom  an ils trxm(m oydlm nlfvsltf rraurp;o4tpt ifetls s2um( o t4 exrioctodfptrauvil()t2xoir iu4omtemivt ( srtax  ;u1aex mf3iydfa2eanvp t4aleomo3iodfat aneo;( srurxm iudapenmnei t)s2ta(r no0tptomo3iys s2ranmsnu0artrir3tadom eauei;( texm(r oodam n fctl(  Drax  ot0olxnifctldfa rlu o (4texoxr3iatlmt ln s s) etrio3iu1olee nvslsfsrrrxm no4ale  ociatfm emnvp;(0trenxf oadfmDeliei;t  2um(r iudll emiet s  rur(r ot1alt ifetasfsDua( pnu)trxnxr tatfp   ivilt) rxm(o nu4apt  fvslt)a2rru  nu0oexomoetys m2uaumont)altrxf totfpDe ivo;(  2toxr3nudalen fei s s2rmu p;t0opto i3tytfa ranvs ()alxomo iatop elneo;(  2xoiopoy4ol n netas)arrmxm ;t4oleoii3tydfa ean p t)teerxfcoy1oaD anvils0 2uoxr iu1ap  mfvt t a2raumpno0apeoiictys m rmu p;u0 etnmf3oydlaDrlu i ()t2uoim3no1al  mfet (fsrtaumoot1aee  oeiasfm umumo ()texrmo3to1lm r ivi;s0 exmxm3iudameelfctas  rrmurp;t4tlxomf3iytlm2emnvo;(0 lxnxf oytoat lnei;t0 2umim iu1om   icsl(fsrtmurp;t1oeeniictad sDeanmo;t0arenxrcio1omD  n slt)s2toim3oo4apt mfes () Dtmx  nt4tlen ietys a2um(ms t0 ltnircoodomtrln slt0t2umxr nodam nlfvs s a2ta(m ;o1openiocias aDumumont0tetoio oodoa e nvs;() rtm(mpiy1am n ieslt) rtr(mpot0olx mfetaslm el( p;t4tlxoxf3iy1omDelu sls) 2toirpiu4llee nvsls sDrrx  ;o0optnmi3iytlm2rmnmsnu0altoifctodopte n s t0teur(o iu4aptnlfcs ( sDrrxmoou0tpt mieiydls2el(ms;u4aeeomo3tytfp e nvo;()s2trxrpoy1omt  ivs t arrrx  oo0oex  oeiltlmDrmu p;(0tlxrxrciodfaDraivo;s  2to(r oodapt lfciat  2tru o;t0tex iociyslsDumnmsn()arenio3tatfaDeli i t truo(o3io4amtnlfvsas aDraxroot1alt mi3tysfa2umu sn() lenio oadomD au s s)setmim3no4olenlfeil() rumu pnu1olt  iciltlmDra(mp;t0 exrxfctotomt auei ()trtrxr oo4lmtn fcsltf Draur nt4oeeoiiciytlm emuvpnt0 ltrir iotlmtraieo t0teuoxm iy4aptnlfciatfarur( pnt0tlt ioetls mDeanmp;u)arxoio totfa e i ols srtr(rpnu1lleelnetl(farraur ot1alx iiciysfsDranms;t4arxnxf3todfmD lneolt  rxoxrpoy1lp emfesl( sDtau pot0opto oeiydfmDraumsnu) ltnmrctytop  livi () eurxr oy1ol n fcsl() Dtm(mpoo1ope  ietlsls elumpnt) rxoxo oy1faDr nes (  exoxr oodaltnmfcia()s2umx pou4aexn f3iydlm rl(vsnu4trenmocoatopDr ueil(0s2xr(o oydllenlictls)aDrrur ot1tpxomo3iytla eanvp;u0trermoctydfaD  ieo ()srtoxo iu1al e nesl()aDumum ot4alx  f3ilslaDua(von()aexoxrcoo1oa e u slt srtrir3oy1op e ivia()sDtru ooo1oltniocilslaDuluvo t)texomrcto1lp eaieo;(0 rtrxopiodap n nviatfaDumu pno0tltomociys m ua(vp;u)trxnmo3ty1op e n o () 2urxr3no1ome mnet t) Drr( ooo4altnmociys m em( snt4teenxrcootfmtrau olt0seuo(r3oodomt  ietls) 2taxmpnu0alxnifeiydfs ulnvp;(0 etomocoy1lmDeaivo (0 etrio3iydlmtnlfcils srua(  no0tetoifeiatfa2uln o (0teermo oodom  ln o t)sruoim3iodlp n icia() Drmxmont0aeenifetydlaDrlnvs;() rtrxf oytomDraueolt) euoio3nodllenmnct (fsDrax oou4aexnmo3ilt sDel(ms;t0tlxnir3iatomt lnes;t0 2xrio3iudam n ivtl(  rrrx  ot0olto f3iys sDea(mon()aeenxfcootla r ueo;s  2toxr io4lpen ieils)s2rr(mont4olenmo3tatfa rlnvpnu4trtnif3iytomD  i s;() rxrxopny1lm nlnciasfa2taxmp;t1tlx mi3iys m el(vp;(4 etoif3iotfmDrauvi;s0 etrirpoy4omtelncia() rrr(rono0oetoiieiydls2ulnmo;u4 leoif oydfmDrlu ilt0srxoim ou4al  lnci () Drrurpnt0ape ii3taslmDumnmp;u) rtnxf3tydoaD  ieilt)s2urxo no4llenmncils)arrm(r no1altoiiciatlsDum(vp (4aeerxf3tydop  li i s0sexr(mpny4lm  mfesl(faDuau oot1aexn fciltla emuvp (4 rtrif3oo1laD  uvsls0 etoim iy4am e fvtltfsDrmumo;u4aleniietadfm2rmnvsnu0tetrxfcoydoa elneo s) eum(m iodamt mivi t s2rm(mpnt4texnmi3iydlm2eluvs t0trxnmociy1omDeaieo s0setm(m3nudaltelncsasfsrumu o;o1tleoioeils m rluvp;t) etnxf3iydlpte i i;t  2xo(m3oydoptemnvsas  rtmu  ;u1tet  o3iltfs em(vsnt)aetrio iydop e i sls)seum(mpou1amenlici sf Drmxr ou4oet mo3tydls eanmsnu)teerio3tatom elu o ()s2trio iy4oltnlfeilt) rua(  nt4optn oetysls2elu pnu4trxnxf iotfmDelnvils  rto(mpnu1omtnmnct s)arrm(r ;o0alxnmi3iyd sDeln s ()aetoxr oa1fm  lnvi;() rur(rpio4optnmics sf Drru pou0olxomoetadlsDemnvs;u4aleoxr iotfmDeanvo t) 2uo(r oo4ap  mfct (f Dumxr ot4altnmocilsla rl(mp;u4arermr3ootoatelnvolt t2xoxrpoo1llen fetas  rraum ;o0teeoiieiatfa2ul(msn(0alxoir totlmDeli il(0s2xmxopoydllt  fci s aDrax  ou1oeen i3tytls2rau pnu) exrxocoodomtr nes;t0t2uoxmpou1lltelicta() 2rrxmp;u0olx mfciytls rlnmo;t4artnmo oodfpt livsl(0s2uoxm iu1lpeelivt ( a2ra(r ot0oeen i3tasfs2ul( on() rtrxo3iatfm  aivo ( texmxm3oodlpt mnetltf rtaxmpno0oeeoifcildfaDrm(von(4teenxo3oa1lmDe ies;t)sexoir no1lmtnlneiat)srraur ;o0aex mfctaslm2umuvs (4aetrmo ia1lm eai ilt0seto(m3no1olenlivsls  rtmurpoo1open fciat s2rmu o;u)altoxr oo1opDeanes;( t2ur(o3nydlpenlfcsa()sDtr(m no0optomieiadla2emnmont0teenxo to1omDe iei;s0trxmxm3nodlle  icia()aDurum oo4apxo o3tas m uln s;t0artnmr oy1op eai il(  rurxmpiu1ome mncia() 2rmx oou0tetn o3tys a2ulumsnt4tlenir3iadlpDrlnvo;s0 2to(rpno4ll   ncil(fsDtmurpnt4aeenmictadla elumo;u4tltnmo tydfptrlivi;t)s2trxo iodol nmnvi (  2trx  no0tle io3tadfa2ra( p;t0trenioctadom  an ols srtoxrpoudopte fet s)aDrr(  ;u0apxoii3iydfa2uauvp;u4 reoio3oodfaD aieil() rum(rpou4lp n netlt)s2taurpnt4aptnifctldlmDul( o;t0tetnmr ia1opt  n s s  2umiopoo4lptnlnvsls)s2raumo;u1tptn f3tadlsDuln s;t4alenir iotfm  an o (  2urxopoy1apt livtatfs2umu pou0tee  fctyd a2rm(ms;(4 eenio3ia1fp   u s t0t2xr(rpio1om emnesa(faDum(mono1oet mo3ias s rln p ()tlenxfcoatfm elieo;( setoimpiu1om nmiei t)srraxrpno0tetn feilsfsDulnvo (0trtrircto1la e ieslt) rtmimpny4alte nvt s  Drmxmo;t0oetnmocilt s eauvp;u4teenxrciatlateaues s s2tmxmpiudlme mfvi t)aDrrurooo0tee  oeils m2uanms u4 exoxo iytfp r ivi;t setoxr iodame licia( sDtrxmo;u1tpen ocildfmDrm( s;t)aetrxf totlp r u s s tetm(o iydlltelncs tfa2tr(mo;u1tpt  iciadfm ean o;()trenxo oa1fpDelueo (0 2tmxm nudlpee fvslt  Dtrx  ;t4opx io3iydlsDul( pnt0 eeoxf tadfpD lnvs;s) etm(opiu4optelfet ()a2ua( onu0aleo ieiyt s umnvp;(4arerxo3tatoaDeaiesl() rum(opoo1altnlncsas  Drmu poo4aptnifetyslm rm(vs (0teerircoodoat aivsls0t2urxr3ny4amtelivils s2uru p;o1aptoiocils m emums u4 ltrmrcoy1lmt  i olt)s2uoimpnydlp nlics ()s2ua(mpot4optoiicildlm emums t0aexoxfciy1fpDrauvo ( teumir nu4optnmnciltf 2rax  ;u1aee iicilsfmDul(mp u) ltoxr3ia1opD  ivolt t2xrxo iy1lpe lfetltfsDtmum ou4apxnioeiys m ea(vp ()artrmr3iydop e i s;s)t2uo(o3nu1om elics s s2raurpoo0alxnmociatls ea(vont0 eerxr oydoatr u i;t0setm(r3ou4amt mnei sfsDtmxm oo4olx ifeiat mDemnmont4 rtoif io1lpD livsls0s2xrio oydol emfvtl( a2tru pot1tpe iiciat s el(mp t)aeerifctatlpDr uvo;()s2toxopnudlmt mfcsl( a2tr(m ot1oeenmo3tas s2raumo;t4 etrmf oatlpt an il(0setmxm oy4aleelnet s) Duru  nu0tlxnii3tas s2ulnmsnt0tltnio iotlpDr n i (0 euoio nu4amt lfctlsf Dtrum ;t0oet ii3iatla elumo u0 lxomr3ootopDe u i;(0 rxrio oudop nmfct t a2raurpnt0oeeomietls s2umumsn(0areniocta1faDeaivi s s2urir no1ole  nvilt  rum(ro;t4open fctlsfa2umums;u)texoxo3io1laD li i ()setrxr3ou4opt mfetasfaDtrxroot4alt if3iad s eau p (0 rtoiocia1oa   ivs t0tetrxm iu4ap n fetltfa2tmx o;o1tlxo fetld a el(ms u4arenmr iy1oaDeai i;s  2trio3oodal emnvt sfa2urump;u1tlx  feiadfaDrlu o;()altrxo3iatlaDrlieolt0t2xoiopny4llenmfciatfaDtrumo;t0tetnif3iys a raumo u4 lerxr3oodomDe u i t) 2ur(r3iy4alen feia()sDrmxrpnu0aexoioeiltfm2rl(msn(0tltnmo oodla eai s s) rxm(opiudlptnlivsls)a2rau pou0opt  feilsfa2umu o ()aexrmr3ia1lmteli o t)trurxm3iudlmenlivs s  rrm( pnu4optoif3tydlsDean p u0 lxnmr iotop rlivo t s2umxopoo4lp elfei s  rua(root0ole iiciasfaDrl(vpnt0 exrxf3ootfpD  ivo;(0 rum(rpou1ome lfetltf Drmurpnt1altn oeiad sDran p;u) lxrir3ta1late ivi;t) rto(r3nudamtemfcs (fsDumu  oo4open oetatlsDemn p;(4tlxrio3ty1faDraueils0 2tmimpiydoltnlfcsls  2rrxronu1aptniocils aDemnvsnu0alenmfciydfmtraieo t0teumxr3nu1aptemnvtltfsDumu poo4tpt iieilslsDuan s;(4teenxociotoat  ivsl(0t2xr(r3iu4amt  nvta()sDuau poo0oltnmf3tatfm2um( snt0altrir ta1op r ivsls0 2uoxo3iu4ap  mivt (fsrur(mpno0oex ioetydfmDrau snu) ltnir3oodoatr u s () etmxr nydll elicil(  rrm(rpnt0opxoifctytfa2um(monu4trtnir3iydfa eau sls seur(opiydamtnlfesa() Drmxmoou1teeoifetyd m2eluvp;u)aetrir ia1omD  uvo;t0t2ur(m oudamee nes s)arrmxr oo0tlx  f3iatfa uau onu0tlxomf tatla r ieil()setoim3iydlmeemnvsa( srrmxrpot1oexn fctadla emnms t4 ltoir3totfm   n o;t0 rxrxo3oudlptnmncsas)a2rrxrpou0opt iieiytfs2umu p u4tlxomfciodla e ivs;t0s2um(m nu1am n ies sfaDtru pot0aetoifeiad m uan p;t4 lerxf oytfp  livols)srxm(mpoydlm nlfvi () rurum oo4ale  fctls m2eanmo;(4texnifciydfa  luesl()sexoxo3oo4ome mfeiatfs2rrx onu0oet ii3tldfa emumon(0altnif3iotopt au i ()teuoxr3oo1amtnmnvia()s2rmxrpot1aptnmfetatlmDem(vp u)alxrxrctodlaDrauei s)srxmxrpoy1omtemnct () 2rmumont4tleo f3iad sDrmnvpn(4tetnxr3iodopte i s s0t2xrim nudlmtnmfeilt s2ra(root1tlt mo3iaslm2uau ont0tltoifciydlpDelnvs;s0 2trio3iydamt mfctas) Duru ooo0olxo oeilsfaDrmuvo;u)artrir oatoatrauesls0t2xoirpoy4apte fciat) 2taumo;o4ole mf3tlsfm rmnmpnu4 eenmfcoadfmte uei;s)s2xoxm3no1alt  fvs t)s2umx poo4openmo3iat sDea( on(0 exoxocoa1fp r iei;t)trumim iy1ame  nvia()aDuax  ot0opx ifeilt s2raump;u) reoirciatfateli s (0t2xr(r oo1omt mnvia(fsDuax p;u1ale  o3iat s2raumo;u4 rxnxr3oy1la eauvsl(0t2xm(m ny4aptelnctl()arrr(mp;o4aptn o3iaslm2umnmpn(4aetomr tadlp r ivol(0trxmirpoy4ll e nei (fa2rmxr oo4aet iiciyt a uauvs;(4 lermo3iatopD aieols0 rtrir iudopen ivtas srta(ro;u1apt ioctltla2rauvon()alxnircoytom ranes s  rxo(m3ou4opte ncias  rumx oou1oeenmi3ilt m2rl(msn(4 rxrio iydoaD aivi;s)t2toxrpiy4opee iesl(fa2rr(rpot4aetnifeilt sDuln o;t4arxoio3iytlptrlnvo s  euoimpio4ole  ici (farua(m ;u0tpt moctysla uaumo u4arxrxf iatfpDe uvs;t) exo(o3oydapt  fcsls) rtaxrp;t4apxnioeildlsDea( o u4trxomrctotoa   i ol( teurirpoy1am  mfcils s2ua(m nu4aetniictys s2ea(mpnt0tltniociy1fmtelneo s s2to(m3oydlm emnvils)aDraxroot1tleoiiciyt m umuvpn(0 rxnxf3iotlm rauei;s)setrxopio4lpe lnviat)sruru ont4opeomo3tat s2rm( pnt0 renifcoy1opDeaieil()t2xo(r io4ope  neia() rurx  nt4altn oeiysfsDua(mo u0 ltnxo iatlpDr ues s0trxoxmpiydomte ics tf rtrxmp;u0tleo ieils mDumump;(0 lxnmfciatfpD auvi;s t2toio oy1al  lfctl( s2ra(  ou4tlx  fciadfm um(ms u) rxnmr3oatomDelu slt  2uo(rpnydlm nmfcsa(f ruaump;o1apx iiciydfm2ua(vpnt4aetomo iatlpteai s;(0trtoio3iy4al emnctat)s2raxmp;t0opxnioeiyd m2eanvp;u4tlxrxf3tytom  aneol(0texrxm io1ape lnvt s s2rr( p;o0tpen o3iasfsDemn p;t) eeomf3ia1fm   neo ()truo(m ou1ap  lfeta(fsrumx pnt0apt  fcias m2emnmo;(0 rtrmf3iy1opDeai olt  rumio ou4lp e fcs sf rtau ono0tpt if3tldfs2rau ont) rxomf3iadoptrlnei s s2tmxo3ny4lm n ivsa( arrmumonu4aexomo3tlslaDumuvo t)tetnmfcootoaD li ils  rxmxopnu4olt  nvil()srrmxm nu0aeenii3iaslaDuau snt4 exoxo3iydfaDrlnvi t)srxm(rpoy4om nlnesltfsDuau pnu0aexoioctys s2ea(mp;(4teerircoatla  anvils0seuoxmpoo4om elici (fartr(  ;o4aeenmi3iatfsDea( p u) renxf3iatlate nvo;s trum(m oo4opeelict t)aDrmx  ou1openifciatla rmn o;()aeerxf3tydfmtrai o;s0 ruoxo ny1altnlncta()aDtrxrpou1tltn i3ias sDuauvs;t4 rerxr iatoateauvs t)seuoxopiy1apeelfct sfsDtm( o;o4oeeo i3iyt a2rlumo;()tlxnif iydfm e nvsl( srtoxrpiydamen fetatf rumx  ;o1ale mfciatlsDuauvo;(0alerxo tydop r ivs;s  ruoio3oodomtelnei ( sDrm(  oo4aleo i3iasfsDemnmo;(0tlxrmr3oodfmDelnei;t  2umxm oydllt lnctls  rur(  ;o1tltomfciys m umuvont) lermo oa1omDr uei;t)s2urxopoo4ope lnvsa(f 2ta(moou4apx iieilt aDrlnvo t4 ltrxocto1omtrluei;s0 euoxo3oydlp nmict t)sDrmu ont1tltomoeiyslmDumnvs;t0trtrxr3iatoate i o;(0 rxrirpoy4ol nlfvs sfartmxro;u1optomi3tyd aDem( pnu4arerif tadom e ivs (  2xrio3ou4op n fesa()aDtmump;t0oeeomf3tlslsDranvp;(4tetrif3iy1fpDrlivi t) rtrxopio4ol n ies tfsDur(r ;u0olxomf3iltls uan o u) exnxoctatfatrlueo;t0srxrim3ou4ol elncils) 2rm(mo;t4apt mf3iydfaDran s (4tlermrcia1fp rai o;s t2xmxr nu4oleemnctlsfs2rrxmooo1teeo i3ilt m rluvs t)tlenxociytlpDeauvi s t2xo(mpiu1om nlnviat arurumonu4altn fciyt aDulums u4aetniocoydfaDeauvilt0s2trxopoo4ape  ivs s a2rm( pno1ale  octydlsDumnmsn(0tltrif iytlpDr n i t s2tm(o3iu4optnmies () Dururonu4oexn oetysfs2ua( snt4 lxnmocoodfm eaies ()trtm(o3iodome mivils arraxrooo4oexniociytla ea(msn(0treoir3io1oa r n i ( srumxm3nudap   fctl()sDrm(r nt4aexn i3iadfm elumsn(0 exoxf3oadop rli s s)srur(m oudlmtnlfcslt)aDrrxr ;o1olxnmocild s raums u4 renir3iydfmteai o;t0s2urir3nudol   iet ( srum(rpnt4oleomicildfmDelnvs;t4tlxoioctatlaDeli sls  exmio3oy1amtelfes sf 2urxr ;t1altoifciydla2ul( o;t0 leoxf iytfpDeanei (0 rtm(rpnu4lmtnmfctatf 2trum ;u0opx  fciytfmDulu s u4arxomr3oadopDr neil( t2xo(m io4lmtn nctltf Drmurpnt0olenmfeiasfs2rlnvsnu0 rtnmociy1omDrlnei;s0 rtrxr3iydlmtemnvi ()s2uax ooo0tpenmoetas sDemuvsnt) eenio3to1omDelivs;t)srxrxr oudolt lncta( sDtm( o;u4aeenmf3iydlaDeaums;u4 reoxo oy1fa raivo;t0trtmir oy1lmee feilsf Durur ;t0aptomociasla2emump;t4 eenxrcoy1lmt lneo;s) rurxmpiy1al elfvs (f Drauro;t1alt  icild a2el(vsnu)artnif oo1lp raieol()teurim no4lpee fct () rta( pou0aex  o3iad m eauvs;u0aeenio3ta1fpDranes;t  rum(o3nu1lleemfeils) ruax o;t1oexn o3tls aDrm(vp;t0aleomf ootlp raieol( s2xo(o iy1altnmies (farur( p;u4aleoiieiadfs2ranvon()aeeoxr3oytfm e neolt  rxmim ny1lpt lfei s  Dua(  ;o1altnioctadfm rmums;()arxrxocoatla rln slt  etm(m no4lltnlfei t) Dur( onu1tpxnmiciydfa2em( o;(4altrmf oo1lpD  ieslt  ruoim oodom n fctas) rtax p;t0oexn feiyt s2umn s;() exrxf3iytomDran i ( tetmir nu4lptelnvsls) 2tax  ;u1tpe  o3tysfs umuvs;(4tltrxf3tadlmtrlnvo t0srtrxrpio1ape  neias sDtru  no4altoifetaslmDua(vs t0 lermr3oadomt  nesls0 exoio ny4om  lnei tf rtmu ooo4olx  octyt s ranms u4texoif3ia1lptrauesl(  exoxmpoodolt mietasf Durxmo;u1oex if3tytfs um(vs u)altnif3ootomD ln i;(0srxr(r3nu1olee fvs sfa2tr( p;t0tetnmo3iys s eauvpnt)tetrxo oytoa rauvo s setm(m3oodlptemfesa(fartr(mo;u1tet  ocild m uauvonu4altnio ia1oa r i s;s0 2xr(r3iodlpe  feias)sDtrump;t0tpxoifeiad sDrau snt0tlerir3tydfm r nvi s  etm(o io4al  lnet s)s2umuroou1tpto i3tlt a2emn o (4trxrmo3totla rlneols)t2xmir3ny4op n fci tfsDtr(rpnu4oltn fciad a um( on()arxrmr3tatlpt aiei;t) rurim3no4openlics (f 2rmx onu4texnifciat s ulumsn(0treomf3tydfa  ln s ( srurxr3iy1opt mnvil() 2rmurpno0tpxnmi3iasfm rm( onu)aexoifcto1oateaivslt0truo(m3oy1am nlivsl() Dur(ront0teen o3iysfsDuau onu)texrmf tatfaD lieo;t0 rtmxrpoo1ameelfesl()sruaum ;u0ole ifciad aDuauvo;t0 leoif iodfatelieo (0trtoxo3ny4lmenlncsa(  Durxront4aet iociasfm ulnvp ()trenmoctytfm eauei;t)s2tmxm nudapenlnciat)aDtmumpnt4apxn oeiatlaDra( p t4trxnxr to1fmDrlu i s)teuo(m3oy1llenlivi s)sDrmxr oo0tpt  feiadfmDraump u0alerxf ty1la eauvslt)srto(opiudop   icsas  Dtm(rp;o0opt ifeiadfs2uaumo;u)alxrmf tatla   i s t0trxmio3iydol  lfeia(  2tmx o;u4ole  ociysla2emu o;u4arermocoytfpt aieslt0sruoxm3iudoptnmnci t sDrrxmooo4aexomoeild s2uanmpnt0artnircoatlptran s;s  2xr(o3ny1lm e ieta() 2ra(rpnt0olenifciadlaDeluvpnu0 renmr3io1fm e ies;(  rtm(r iu1ol nmfcils) rrrxm oo0tpxo fciyt s ranvsnu4tetnmocoodfmD lueo t)texm(m3oydape miei s aDua( ooo1oexn f3ilsls2ulu s t4 exnio3totomtr ies s0 ruoio oy1olt  feilt)s2umxm nu4aleomociydlm2ul(vo;u4tleomo3ia1omDeln il()truoxo nu4ap   fetlsfs2uaurpnu1tleo icilt mDrm( p;(0altnio to1opDeli i;t0texmxrpio1alenmict t  rraxmpoo4oetn iciys a2rlu p;() exnmocoydlp e n i;(0 2uoio nu4lmt mfciasfaDuau  ;u1optomi3iys mDul( snt4altrircta1fp  aivil(0 eur(m nudoptnlfes s) 2rax o;t0opx mociasla uaumo;u0aexoif iotlpD lues t setoio ou1ll  mnvil()srurxmpot1tetnmi3tytls2emnms t)artoir oodfpDr n i;t)sruoxr3nu4amtnmncsls)s2taumpnu4tlto i3iatla2elums;(0 eenmf3oy1opt luvil(0s2tmxrpio4lmenmfvt sfsrua( pnt1texoiieiydfsDulu pnt)alxoio3tatoptranvs;t srxriopnodolt mncil(  rumum ;o1teeomiciasfa2ul( snt0tltoiocoodoptrlu ils)srum(r3oodamtelnesas) Drr(  ;o0apeo icilsfm2ranmo;t) lenirctodop elnvo t)trumiopiu1lmeemivt t a2ur(ro;u4alen ieiadlmDelu p () eerio3oadoa r ivi s0 rtm(m3nudaptnmfvsat aDumxmonu4opeo oeils mDrmnmo;t4tetrmo3ootlptraies s0s2umxm oo1olee fesa( aDumur ot1opx io3iytla2rlnms (0alxnxr totfa eaieo;(  euoxmpiydape mncsl( srumum ;o0aexo i3ildls um( s;t0 rerxrciytfp rlueil()t2xrxo iy1ale mnei (f 2urx p;o0aexnmi3iys m2uanvo;u0 lerxo3io1lat lnes;t)texoir3io1lmen fvsls) 2raur ;t0oeeomf3tytla emuvp t) rtrmo3iytlpDrlivo t setm(m iy4ll e nctl() 2um( ooo0altnio3tadla rluvonu)trenxo3oytop eanvo;()srtoxr3io1openlnvs s) Drm(r nu1tleomo3ildlm em(mp;t0 lenmo3oo1fa  liei;s seuo(o iy1lm e ncsatf rtrur no4tlxnmieiltlm2emums u)tlxoxocootlp   ivols  2xm(r iodlme lfcsa(faDuaumpoo0tltn oeilsfs el(mon()tltomocto1oaDeai s;t) rto(mpio1ll   nci ()s2rax  ;o1apx mocilt s umnmsn()alxoxr io1opDr ues;( setrirpnu1lptemiesl(  rrrx  nu1oleomi3tydfmDulnvp;t4teenmo3totomD lies;s0trxr(mpou1ope miesat) rrm(mono1olenifeiasls2eanvo ()artnxrcoy1om e nvo s  eumxmpny4op e fvsat)srrmu pnt4tpeo fetlsfm uau onu0tetnmo oa1fa eli i;t  rtmxr3iu1lp nmnci t s2rax pno0oee  ictysfm2ra(vs;(0aeenmr oydlm raivilt)trumio oydame lfvs t)s2rax  ;u1apen octyt sDea(ms u) rtnmrcootfp eanei;()teuo(r oydom   ncs tfaDurx  nt1tet ifetltlaDrluvo;(0trtrxfctytomte nvs;t) exm(o ou1optnmncsl()srurur nt1tpeomf3iadls2ua(vs;(4 rermr3tatfatrli s;t0 rumiopiydome liei t s2rru p;o4ape  ieilsla uanmon(0aetrmf3ta1omteauei;s0s2xo(m3io1lp emictasfs2tm(m nt1teto ictlsfm ea(vo t4 eeoif tadlmD lueolt) rum(r3no1olen fvt sf Dra(r ;t4aleoifeiltlsDulnmpnu0texrxoctatop raieils  rto(m ny4omen netls) Dumurono0oetomfciydla emnvp;t4tlxrir3iy1laDraues ( srtmir3nydape  nesl( s2umurp;t1openmociatlsDea(vp;t)artnxrcoodoat  nesl( texrxm3nydamtn ncta(  rrrum ;t0tetniieildfs2rm( o (4 ltnio ootfaDelu olt0 ruriopio4olt  fet sfs2rax pnt4tptoifeiys a umn p (0 renxf totoat aiei;t0seuoimpoo4lmtemnvs tfsDtauronu1tee ifeiltlm emn pnu0trtnmr3to1fpt ln o;t  rxoir3nu1olt mnci () Drau o;t0oleo i3iatfs2ranvs u) rxoxf3tydfm  ln s;t) euo(opio1opt  fvi t a2uaurp;o1oex ii3tyslm ean s;u0 lenir3ta1lm eauvs;(0s2xoimpiy4lpt  ict t a2taxr ;t4alxn fetadla2rluvo;t4tltrir iotfp r n o;() rtriopoo4lpt  nviatf 2ur(rooo0opt mfeias m2rmnvs u4artoir iy1la  aueils)texr(opiydlltelnei (f Duaxro;o1oleniicilsfs emnmp u)artrircoa1oat liesls)s2xmim oudol  mfvils) Dum(rpoo1aptoifeiasfa2um( snu0trtnmocoy1lpD ai olt)srtmxo3ou1aleemiciltfsrtm(rpoo0alxo i3tat sDrlu onu) rtoxo3oadop rlu ils)t2ur(m iydlmee ici t)s2raxr ;t1alxomfciltfm elu s u) rtnmr iotla  ln ils0 2tmiopnydop nlfvs ()arrrumo;o4tex ifeils m2ul( snu) rtnxr3iatop elnvils0 etoxmpoy1apeemiesat)aDuaxr ou1opx  i3iltfm2ul(vp t)aetnir3ia1oa rlnvi s)s2xr(opny1al nlfct (f Dtrur ou0tlenmieiasls rln s;t4texrxfcio1lpDrauesl(0s2tmxrpny4amtn fesas s2umxr nt1oeenioetadfm2rau snu4 renmf tytoatrlies t  rxrxr3iy4lpe lneil()aDtaxmp;u0teeomfctlsfaDranvpn(4alenio iy1oaDean ilt0 rtm(m io1lmee fvi tf 2umx pnu4tpxomf3iltls emn s;t0altnxr3iytom   nesls0t2umxr3ou4ll emnvtl()artm(  ot1oeeo ociys s2em( on(0arxnmrcoo1fp rauei;s texmirpoy1lpe lnvtl(f 2rm(m ;u1oexoioeiysla2elu o t4tltoxoctotfaDrlues;t0 exrxr nudlm nmneta()sDrrump;t1tee ii3ilsls rau p u) exrir3ootlm  anvs;s srxr(m3oy1amte nes () 2tax pnu0aex mfeilt a2elu o;u4arermo oo1la elivo;t0sexmim iydopt lfctl(fs2rmxm no1oexomf3tltfaDeauvo (0alerxf3tatomD au il(0 exo(o ny4llt lnesas  Duaur ot1texnmieiadla rl(msnu0tlenio to1fate neo;( texoxr3iodlltelfvsls)srum(m nt0olt io3tyt s elums;u0teenircoytlmDr ieo (  2tmim3oy4opt mfei t srrrx  ;o4teto fcils sDrlnvon() rtoxr iatopDelies () etrio iydop emnctatfs2trxmp;o0oee if3tasfa eaumpnu4trxoxo3iotlaD anes ()srtm(rpny1ape mivi t)sDtmxm ;u0alxoifetltfaDrln on()tlxrir3iytlpte uvo t0seurxopoudlme mnesas  rta( pot4tlt  feilt mDrl(mo t)alxoxr3tatop eaieo s)t2to(r iy4am  lfesl() rrrxm ;t1tlt iieildla rmump;t)teeoxrctotlp eaueo t  2uo(m3iu4olenlnvtls  Dur(mpno0tltnmi3iyd s2em(mp;t4 eenif3iy1lm r n o;(0 ruo(m3oodlmen ivs s)aDurur ot0tetn o3taslsDelnvs;u4tltrmo3totfatelneols0t2uo(o iy4lptnlncsas)s2tmu onu1tlxn ociadla2elu o;(0tlxoxo iytopteai o;s)srumxrpnodll nlfes (fsDuru  no0optn f3iadls rm( pnu4 etnxr3iy1lpDeauvs (0 2to(rpno1apt  nesat aDrr( pnt0tlxnmfciys mDuluvonu4 lxoir3tadlptrlnei s)srtoxopnodlmeemfvtat) 2urumpot0alt iiciydfs em(mp;t)tlxoxrciadlatr uei t trtrxrpno4ol  livta( srraxmont1altnmfeiyt sDul(mon(0 exrio iotlaD lnvil()trxm(mpiydlp eliesasf 2umxro;o0aet iieiad a rln snu) rerircoy1lp rlu o ()srtrxm3nudome miet ()arrrx  no0opxn i3tys mDrlumo;u) rtoir iytomD lu i t0s2uoxmpou1lp elictls  rta(rpnu1aex mo3iatla2um(vpnu0 rtrmf3oa1lp rai i ()srur(m io1ope mfvtas)srrmxr oo0aleomociadlm2emn on()tlxrmrciydfaDeln s s)srtrxopiu1ol elies (  Drrxronu1tpt ifciydfs2emnvon()altomociytoatrlu sl(0 2trio iu1aptn nci s) rtaum ;u0tet iicils a2uau snu4teermfctodoatr ivs;t srurxo3ny4ape licia(  2ta(rono4altnmfetad a2elumsnu4trxomo3oodlmDr uei;s  etrxr no1olenliesat aDurxmo;t4apenii3iysfsDelump t)teerxr3ta1oa   iei;( t2tr(m ou4aptnlfcta()aDurumpoo4tex  oeils s ulnmont)aeerxf iydfmDeliei;t t2xm(o3iu4openmfvtl()s2trx p;u0oeto feiaslsDemnvp;u0trxrir3ootfaDean o ()texo(o io4ape mivs sf Dtau p;o4aetnif3iyd a2emump;(0aexnmr tytomDraneolt s2xm(r3nydlp  mnet tf 2um(r nt1tle  icildfa2eau snt0teenxo iadfat  i i;s srtrio3no4om nmncs s  rrrxrpnt1apto oeildfaDrlu on()areomociy1lm  ai ol(0 rxmir3ou1lp e fet sfaDtrump;t1alto i3iytfmDem(vs;t)trxnmf3iatfa rai i s t2umim nu1lmtn fvtas  rrm(r nu1apx ifciaslm elums;(0 rtrxocoadfat  ueo s) 2uoiopoo1olte ivsas s2ta(rooo1teto iciad m rlumsn(0alxnmf oy1fat anvi s)seurxrpiy4ome mfesl() Dtaurp;o0tltnioeilsfm ea(mo t4 exoir3oy1lmtelues;s0 rtr(opnu1olt lfvils srta(mo;o0oee moetldlm uanvsnu) rerif tadoaDraueils trtmio oy1lmenlfvs (  2umu p;t4teenmi3iat m2ulums;u0trxnio3ia1oat aivs;s s2urxo nudlmee nesl(  rua(rp;t4apeoiociysfa2uluvo u)trxnxr tadfmte u olt0trtoim3iu4llte netas s2umurp;u4tpx if3tlslmDran pn(0altoxr tytlp r u i;s0 2trxm oy4lltemiet t  ruaum ou1oeeoiietatfs2rmumo;u0 lxrio3oytlaD  i i t0 2tmxr oy1opt lnvt s sDumu  nu0opx ii3tls mDrauvo u0teenir3todopt  neslt  2tr(r iu1ol nlnvil(faDurxmo;u1opt ifeiltfa eluvsn(4arenxo3oo1lpDrlu s (0 rur(r3io1olee nvtat) 2uau p;t1teenmi3tasla2ul(mo (0tltrxo ia1laDrauvs s0srxrio3io4ll n nvtl(fa2tmxm nu4olx ioeiasfa2ra(mon()arxrxf3oytlate ieo s) 2trimpny4alenmicsasfarrmx ont0tlx  ietysfs ul( snu4aetnxrctydlmte uvils)setmxm ny4lptelfvta( a2ra( p;t0apeoio3tls a ua(vonu)teermr tadomDeli i ( srxrxopiudopt  iesltfs2rmurpou0olen fciaslaDum(mo u4tetrmociy1oa r uei t0trur(o io1llt  nvsl() 2trxrpnu1aetn f3iytls rmu s;u0tlxrmrcoodlmDraneil(0srxoirpou1lp emfvia(  Dtmu pno4teeoiietysls eauvon()trxrir oytlpDeaivs;t  2xrim3iy4ol e ietatfsDtrump;u1alxnii3tytfs2eaumpnt0arxoxfcoatopDe ieo;t)t2xm(opnu4oltelfcsl( sDta( poo1teeo icild mDemn on()tetomf3tatfpteaivo (0srxmiopiodomeemictasf Dtaumpno4alxo feiat m2rlu pn()tltrxo tadfm   iei;()trxr(m3oy4altn feil() 2rau onu0tpe ioeiaslsDrmump;() exrioctatlmDrluvi s t2uo(r3iy4om   fvilt  2urxr ;o4aex miciasla umuvon(4 renxr iotlaD auvs t t2tr(o nudope  fctat)sruaxm ;u0oleoioeilsls umump u4aleniocoytfa eai s;(0trxr(o oodoptemneils)aruaxmp;t4oet moetys sDea(mp t0tlxnmr iytla rai i;(  exo(r3oo1apt lfeil( aDrax pnt4aeto ocilsfsDeaumonu0texoxrcto1oaDrai s s)srumirpny4om  mfeias sDtru pou4aet mi3iydlm2ea( s (0artrmrcty1fmt anvi t0 ruoxr oydam nmfcsa()sDuaump;u4tpx ioeiltlsDrlnvo;t0tleoxr tadfp rli slt)srumio nodol n ncil(f rrmx  ot4olxnifeiltfaDem(vpnt)areomr3iy1fpt  uvs;s t2toim iudlmee nei (farurx ooo4tetnmieiyslmDelums;u4 ltrxf to1lpt ln o;s sexr(rpio4alen feia()artau oou4oltnmf3ilt aDean on() rxoxo3oodoa rlivil(0 2tm(mpoo4lleelnvilt)s2umu  nu4alenmoctltls eau s;u4tlerio3oa1lptrlnvil() 2xmxm iodamtn iei t)aDurxroot1aetnmoctatls2rl( snt)trxnxr oydfmt aneo t0setmxmpny1lltemieil()a2uauroou0optomfctldfa2rm( p;(4 lxrmr3totomDelu s;t teuo(m nydop nlfvt t) rraur ou1tpe ifciytfm ulnmsn(0 ltomfcia1fp  lieil()t2umir no1ap   fvtas)sDuaumo;u1tpxoif3tadlm2rl( o;t4 etnio3iatfmt ai s () 2tmio no4ale livt sf rrr(m no0opto feilsfm umnmo;t0tlxoxo3tatoatrluvi t)srtmim3nudamenlfvilsfaDtaxmpoo1alx ifctld m ra(mont0 lxoxrcoydfmtraieo t)setm(r no4lmen neia( aDrrx  ;u1oex moeilsla2em( o;(0texrxo3iodfat  ivsls t2toimpnydamtnmfeta(f Dtm(mpoo1apenmi3tldlmDranvo (4 rtrmo3oatlm eanvi;( s2xrim oo4ope mict ()srrrxr ;u1tltn oeildla emnms;t4treomr to1op r ieo;s teuoim io4al e neias)s2tr(mont1aleo i3iydlm ranvpnu) lxnmf3ootfm  liei;t trur(r iu1omte nvia( s2uaurpoo0ole miciltfm2elu s t0aleomf3oy1lp rlneils s2tmxr3ou4ameelneta( aDrr( onu0opxo ieiysfs elumsn(0texoir iydoa  ln i t  2urio3oydop emieta(  Dtaur ;o4olt mietaslm2uanvs t4 lxrir3iodoa  aues;s srumxm iu1apenlnetat)arrrx  oo0ape ifetyslm2um( o;t)tltnxf ty1oate i s ()t2trio ou4opeemnet (  2trx  no4apx mi3tls m el(vs (4 etrmo oy1omt aivils)s2toim3io1lmtn nvil( arum(r ot4oltnmo3ilsfm eaums u4artoioctytlmtraueils) 2uoxr iu1op elfeia( aDtrumoot0optn fctasfa2eluvp;t0aeenmociydfmDeauvols srxoio3io1om e fesasfarumur ou0tptn f3ildla el(vo (0aexrmoctytom  lneo t trum(r3nydop e nes sf rtaumooo0tetomoetlsfa2uanvp;u) etrio ty1op e n o;s0teuo(o3nu1ol emnvslsfsrrmu  no4tlen i3iadfs uanmp;u) rxnmf oodlmteai o;t0t2toxr3nu1omeelfvsa(  2tmumoot1oexniieiadlaDeanmsnu0areniocoy1oaDrai i ()trxr(m3ou1lle mnviat arrmur ot0tpeomf3tyd aDrlumonu4aeenxr to1fm  luvo;()s2to(r oo4apte icslt)arumxmono1apeomi3tydfsDrmu pnt)arenxr iytlaD lues;t texo(mpiydll elivt t aDrm(monu0tle  ictldla2el(ms;u0 exnmr3oytopD  ivi;t0sruoiopiy4amenlivt tfa2ua(mpnu0aleo octaslmDran on()tetomr oadoa e ues s  exoxm3oydopt  ncslt  Duau o;t1apen ieiasls2umumsn(4 renir3iytfp  li slt)sexo(opnu4altemneta( srrm( p;o4ale if3ildla2uln s u0 eerxo oydfptrlnvi t t2tmxmpio4llt mies sfsDuau  nt4teenio3iasfs2umnvsnu)teeoif ootfm ran s s)s2trir3nudap  mncsl( sDrmu pot4tltnmf3iltls emumo;()trxoif iadfp r ues t)s2urim3oodomenmnvi t  rra(mpno4tptoifeiys a2rmnmo;t4 ltnif iydfmDrln slt) etr(rpoy4al e fcsas  Drmumpnu4optn o3iyd sDran s;()aleoxf todomDe i s t0 2tr(r oo1op e ietls s2rr(moot4tltoif3ilt mDelnmpnt0aexoxf oodlpDeanvs;(0 eur(m nudlptn fvt tfarra( pno1tpxniietlt mDeanvs u4tlxnmf3oydomtean s;(  exmxo3iu4lp elfvt () rta(rpno1oexoioeiasfsDumnmp;t0 lxrircoatlmDeau ol(0texm(m iydap nmiei t)a2ua( o;t0oee ifcilsla2eaumpn(4 exoxo todlpt  nes () 2xoxr iy1apeemfeilt)s2um(moot0tpe mfcilsfa2rmn pnt0treomociadoaDeaneo;t0 exm(m ou1ome  fcs sfsDrmxr no0tptomoctltlaDrmnmp;t) lxrxo tadfmteli s;(0 etoio oodame mivt t  2taxmpnu4tpxn feias s um( s;t)artrifciadfmt  u i t0t2uoir oydop nlneias aDraxr ou4aeenmo3tyt s2umnvon(4 etnmr3ta1lptranvolt0setr(o oo1aptnlfetlt)srraxm no0apt  oetat aDraumo;u4tlxoxf oytfaDe uvs (0s2toirpoy4lpe lics sfsrrrxm oo4alt if3iltfs2em(vp t) rxniocoytfmDelnvi t) 2uoxm3ny1apt  nvsa( aDrr( p;t1texn i3iadfaDua(vp;(0 exomrcoadfa elivi s0 etoim nodll nlictls sDtaumonu0olenmfeilsls ua( o u) rtoxf todomt au s s t2toxo ny1ol emnctatfs2raum no1tleoioeiadls2eln pnt0trxnxo3ia1om rai olt srumxopnydape mivt (f 2trx ont0tpx iicilsls2ulnmsnu)tleoircoadfaD livols s2tmxrpoo4am   ivtlt s2urur no4teenifctyt m rmnmo;u0arxnmrctodom elues s)seuoxm iy1ap   nvsl( s2raxronu1tpxn oeiaslsDum( pn(4aexoxo ty1fatr nei;(0texmimpiy1ole  fvtas aDtaxmo;o1alxn f3iyd mDrl( sn(4 rtomr3iy1fpt au ol()trtmxrpiy4am n nvsl(f Dtmxmpno0tex mo3iasla2rauvo t0 ltoxo3iy1fa   nei (0 eurir3nu4lmenmfvsatf 2tmum ;t1tpenif3tld a ulnmo;(4artrir iadlaDe u s;t  2xo(rpou4om nmiesat)a2urxmo;u0teeomieiytls2ul(mo () eeomr3ta1fmDrlivs;t0 euoio oo4ll elivs () Dtax oot0oexo oeiydfa2rm(vpn(4alxnmf3oatlpDe nes s) rxr(r3oy1openlictas)sruax  ;u1tetnmfcildla uanvo;t) rxnif3oytom   i s;()trxo(m3oy4lmt  ics sf Dua(rpnt1apen ocild aDul(vpnu4arenxfcoadla eaueils)teto(mpiodope lnet (f rumxrpou0tex  i3tltlm2um(ms (0 etrmo3iatoaDeaivs s trtmxopiy1llt  nesa(fa2tau  nt4tptoioctld s2uluvsnu0 reomr oodlm  ai s ( texoxm ou1omtnmnct s) rurxmpnt0tltnmociytfm rmuvon(0 lenir oo1lmte i i;t0seuo(m3oo1amtn ivsatfsDtm( pot4apxniieilslaDeluvonu)tetrirciytlp r iei s0srumxopoo1apen ncia()sDtmur ;o0oeto octldfs elnmo ()tetnio3oo1fpDelnvolt)tetrxr oo4op nmfesl(farraxmoot4teeniociydlsDeanmonu) etomr totlm  aies t)teto(o3iodomee neils)s2um(r oo0tpeoifciadls2umnvp (4alenxfcia1lm raneslt0t2xrxopoydamt mivtl(farrm(mp;t0alxo feiydfm2umnmpn()tlxoioctydlaDeau o;s  etrxo3oy1op emnvt (fs2ua(rono1olxnmietytls rm(vp t)aetrmo iadfmD aies s)sexmimpoo4optemietas)arrr(mpnt0texoifeiydfa uln snu0tetrmr io1la eauvi;t)tetoxm oy1ape lfciatf Draxrono0alxnmf3ias s2rmnmo;t0teeniocoo1oa   nvo;t0t2xmiopno4ll  mnctatfaDurxrpot1alxnif3tltlm ulumsnu) rermfcoydfmDrluvo (0 2uriopoydomtnlfcsat a2uax  no4tpxnmieiltla ua( snt4trtnir oy1omtr n o;(0sexrirpoo1opt lneiat a2taxro;o0tpe io3ilt s2ul(vs;u0arxrio oytfmD aues t trto(opou4opt lneilt) 2raurpnt4tetniictadla2uau on() lxrxf to1oatr i i ()s2xoxopnu1amte neils aDtr(  ou4opeoif3tas aDraumo;u0 renxrctodop  auei s0srtr(rpoo1omt lfvs t arurxm ;t4tle  ieiadlaDrmnvp;(4 lenmr3oatom e uvi;t sexm(r iu4lmen fvils)aDtax oot0tet ioctydfa rauvp ()trxnmfciy1lpDr uvilt)teuoimpoydaleelfesl()aDrax o;o1oltomietadfm2ea(vp;(4 ltrmocootfa rauei;t)s2to(r nydal  mnct ()s2ur(rono4tltnii3tldfmDulumsn(4 rxnmo3oydfptraivols)s2xmxo3iu4lme mnvtlt srururpot0olxoif3tldfs rmumo u0altnio iydfmD  ies s0s2xmiopou4omtelics ( artaur nu0alto ictytlm rmn s;t4 ltoxr io1latrlieo t teum(m3ou4lpt  nesat)a2ra(  nt4aeenioctydlsDuauvo;u4altomf ia1lat anvol(0t2xm(r ny4lpe mfvtlsf Dumxm ;o4apto o3iltfm2ul( pnt)altnmfcty1lp  auesls trum(m3nydamtelnviatf 2rr(mpnt0teeo feiydfs um(vs (4 eeoxf to1omtelneol(0s2xo(r oo1llt mnesa()a2tru o;o4oeeo f3iys aDran pn(4 rerio3totlpDeanvo;t0srtoxm no1lltn ivtasfa2rrxm nu1olxo f3tydla ra( p;t0alxrmr3iydfateluvi;t truoxm oodop nmnct ( sruau o;t1ape iietytlmDuluvp;(4teerxfctadlpDeanvs s trtrio nudllenmfvsa(f rtrum ou4altnmieiyd a2rlnvon(0tlenxociy1lat  u ols) eum(r nodalt  fvtlt)s2rr(mooo0tpx  ociltlaDem(vp t4alxomo oodfpt au o s0t2xmim nu4ol nmnvsl() Dtmum oo4aex io3ildfaDuln p u0alxnmocto1fm e ieols)s2xoim oudamt  ietatf Dra(r ou0ole mi3ildlaDeaump;t0 leriocia1fa  aivi;( sexoimpnu4lp nlieils) rtaumpou1oex mi3tltlmDulumpnt)texoio3iodoaD  uvil( sruo(m io4apenmfvsa(f Duaxr no0tpx ii3iysfsDemnvs t)alenio oytom  lieo;t)srumir iy4altnlfet (  2rrurp;t4aexo ieiysfaDrluvp u0tlxnirctodoa r ueols t2urxr oydolt  nvias)s2rr(  nu1tpeniiciatfm rm(ms;()arxomr3iotfa  anei;(0trtrio3ny4ll n nvil(f rumurpoo4optomf3tyslsDraumpnu)alxnifctodfaDr uvils tetoirpiudlp  micta() Durx o;o0aex  o3tat s el( snu0trtnmoctydfmDran i;s) exo(rpny4op  lfcs t aDur(mont0oee if3iyd a umu snu) etnxo3ootfm rlu s ()srxm(opnydolt  ivta() Dtrurp;u4oleo i3iatlm ua( snu4 leoifcoodoa rlu ilt t2xoxopiudop nlietat) 2um(r ;t1apt iiciad m2uaumo;t4artrxr3iotlatr u o t tetr(r3ou1omt  ietlt aDuaxr ou1tlxnmfetyslm2umuvon(0tltnxfcty1lmDrlieol(  2tr(rpoodlm  mnesa( arrmumoou1tptniociatlm el(vsnu4arxnircootoaDranei;s)texoxmpiodope miet (faDur(rp;t4apt ifetat aDuanmonu4teenmf totlp  au ils0s2uoimpoo1oleelnes (f 2raxmpnu4tlxoiieild m ra(vsn(4aetrxr3oadfa rlies;t0 rtrxr3nu1amt  fet t sDtru pnt1olt  ictldla umu pnt0areomr iotopteli i;(  2uo(opoo4opee fvtl(  Drrxrpou4oexoiocils aDuau on()tlermo3oydoptr i i;t  etmio3ny1ol elfvsat sDtaxmp;o4aptomieiysfa rm(vs;t4trxomf3iotopt anvol( setoio iu1optnlies t)a2rr( o;o4oeeomieiyd a um(mp t)trxrif oodomDeli olt)teur(rpiu1openmfvsltf Drau pou1apx io3iadls eln pn()alerircoadfm rau o ()trxr(rpoy1lpen ici t aDtrum ;t4tlxomi3ilt a2el(von()tetoiocoo1lp eaues ()srtrxm no4lp  mfet t s2tax o;o1alxo ieiatfsDrmn s;u)tlxnifciotfp e ivslt0trtmxo iu1lmeelivs t aDuaur oo4aeeomi3iltfm2ulu sn(0 etomf tadla rluvo;t0s2trxr3nu4amtnlfvia() Dta(  ;u1ole  fcildfm uanms u0 exnmo iadlmteaies s tetoxo3nudamee fet t a2tr(m no1openmo3iaslm rmu pnt0 rerxf io1faD  i olt0t2uo(o3nu1alt mfcsat)sDraumo;o4tpt if3ildfm rmnvp ()tlenxr iatfmt ln o s)teumim ny1om nmfet s artrxrpnt4altn f3iysfs2rmumo t0tltnifcoytfpDe ueo (0s2xmxrpoy4ale mict t) Dtaxrp;o0opeo feild aDemnvp;t4arxnir iodom eaivo s)trxmxo3iudll  lnes sfa2umxmooo0olx ifetldfm elnmo;u4texrmo tatlmD lnvi;t)s2xr(o3ou4opeelneiltf rtrxr oo0teen oetyt a2rm(vs;() ltnio iatlmD  ivo s) rurirpiu1lm nmfviat) rrru  oo0aptnifeiatfs ra(mp;t) rerxo3tatfa  ln il(0 rumir oo1ol e feil(  rta(rpno1tpxnii3iaslm rl( s t4 exnxfcoydoatrlueolt s2uo(r no1lmte fes t srtmx oou4tet if3iyd a ranmo;t)tltnxocoadomDr i s;t setmxo3nu1llt mivtas)sDtru oot4oeeoif3iydfa2rmnmp;u) lxnmr ia1laDraivol(  rumxr iy1ap   ivia(  rrm(moot4openmieiatfsDuauvo t0alxnxo3oa1op eanvolt) 2urxo3oo4lltnmnvtlt sDua(m ;u1tpe mictatfs rlump ()trtnmr3iotom  aivo ()srxriopoo1omtnlieia(fa2rmumonu4oltnmfcilsfaDulump u4 lxnmo3oy1lat ln slt  etrim ny1ale mncsls)sDtau  nt0tptniieiasla ua(mo;()arerxr3ootlmt  ieo;s t2umir3iu1lmte nviat) Dtru  nt4ale iiciyt s uau pn(0aeermr oatfmDeln s ( seurio3ou4olenmieiasfa2rru pot0aexnmf3ildlm eln o;t0 rermo oydom eln o t) 2toxrpiu4om emivt (  rtaumo;t4aetn ieildfs2rlnms (0 reomrciodoa   iei s) exrxr3nydop eliciat srtrxrp;t0oeenmiciys a2ua( o;u4 rxrir ta1laDrai o ( teto(o3io4altemnetl()aDtr(  ;u0altnmociadls2rlnvp u0teenif ootop raueol(0srxr(opiy4optemicilsf rtmx ooo1optnio3iatla el( snu) lxrio iotom ean i (0teuoxo3nydoptn nes s srtau p;o1tpen ietlsfmDelums;u0tltnifciytfa eanvo;(0s2xrir3oy4op  lfct sf rraxmpnt0olt if3iydls umnms;t)aetrio3oydfatr ivs;s setmimpnydoltn icta() Dtmurooo1alxomieiytlm2ea(vpn(0trxnif3iodlm elnvsls0 2trim3iydap emnet t aDtauronu1tpeo o3iasla2ulu pnt) ltrifctadom eau s;s0srxrxo io4ap e icsa(  2rmu o;o1ale  fctysla2ulu s t)trxrmrcty1oaD lneolt s2toxrpny4apen nei (fartaumoot1tlen icils s2emnmp u0arxrif3io1fmD aneil(0 eur(opoydoltn fcil(f 2rmu  ;o0tee  oeiasls2rlumpnu0tetnxf todfaDelueil( seurxo oo1lltemnesas) rumxm ;u4alt ioctltfmDuln p u4aetnxo3iy1la eanvi s0t2tm(r3nodape  nvtat srta(r nu0tltnioctad a ulnms;t4alxomo oa1lmDe ivo s  2tmim nudale  nvilt)s2tm(roou0tpxnmoctad m2ul( p;t)aetoif3tytfmDeauvo;t)trxrxr3oo1ol elfeils arurx  nu4tpxoif3iasfa rmu p u4arxnir iodlpD  ueol()teuoxo oo4omtnmivils)aDumurp;o0aet if3ias s elnms;t0alxnxrciodfat  ivs;t0 2xmir3iu4olt lncsl() Dtauroou1olxomoeiysla2elnmp;u) rtnmrcoatoat ai s ()seuoxr iy4op  mieiasfsrurxrpnt0tlxo iciatla2em(vpnt0 ltoio iatomt lu ils truoio iodam n ivi s a2uaur ou1apx ii3iadfsDeauvp;u0tleomfciy1lmD lu i;t) eur(opiy4lpe lnvils) rtrx  ot4oeeomfeiatla2rlnmp;(0tetnif to1fp  lu o s) exoxr iy4ap nmfctas sDuru  ;u0aexnmictldla2uauvo;u) etrmr3iatla eanvs;s0s2trxr3iodom emfvia(faDrmxmp;t1olxomfeiadfsDeluvon(4tltnmrcoatomD lnei s t2trxo3no4ape mncsa() Drau  oo4aeenmo3ils a rlnms (4altrio oytoptrau ols0texmxm nu4lmtnmiesasfarua(mo;t1alt mfeiat a2rmnms;u4 etnmfcty1lm e uvi;( teumxopoo1ap  lnctat)arra(r oo4tlt ifctltfa2el( p;()trxomo oadlmtrln ol()t2uoxrpnodamt  fcils srua(mpot4oee  feiysfs2rl(vs;()teenir tydlate i s s)t2xrir3ou1omt mnes t) rtaxr oo1aee  iciad aDuluvp t)teeomf3to1lmDelivs;()s2uoxm3ou4alenmiviasfarrrum nu0optnio3iltfm2rl( s u4 ltomo ia1om rli ol(0 rxmxrpiudap nlfvslt arrru  oo4olx if3tldfs2umu p;(4artrmo oo1omte uvo;(0 ruoxm3iodam  lfvia()a2tau p;o4alxoii3iltls ean s;(4alerxo3ia1la   n ol( t2uriopoy1op n ici ( srrrum ot4tleomietad s rlnvon(4trxnio iodla   u s t s2xo(opiu4lp elnvtatf rur( ooo0aee mo3iatlaDemump;u)arxomr tydlmDeanei;()srxo(m oy1altnlnvt tf Duaur ot1oltnio3iasfs2ul( o;(4 eeoifcto1op eau s;t  2tr(opnydop  mfcia( sruaxm oo0olxn fciatfsDelums (0tlxnxfcootfm   ivi;(0 eur(m3no1lp n fciatf Drrx  no0opt  i3iyslmDeauvo t0aexrxr3totoa e ivsls truo(mpou4omt  nvi t artmx ooo4opt  i3tlt m2ea( pn()aeerif ta1lateln s;s)tetoxr nydop e nesls)sDtm(m no4olt mieias sDrlnmo (0teerxf iy1fmDran i;s0 rumio iu1llen ictlt)arra( pnt1oee mo3tadfs rlnvont4 exoir tadomtr u i t0 ruoio3oydaleemici t)aDtm( onu1aleomoctltlmDean s t0aexomrcto1fptr nei s) ruoir3oo4om elfesa()s2tmxmoot0oetnmfciytlmDul(mont4tltrmr ty1lptr u i ( s2umxo3iudlleelncils) rtm( oou1aeeo iciyslm2ea(vp t4alxrio3tatlpDeaivi;s0srtrxo3ou1opte fesls)sDrmu p;t1ape  oetyd a ulu onu0 lxoxr tadfatrai s ( sexrxmpio4lptnmictltfsrrr( pno1alt  o3iasfsDrlu pnt)tleomfcoo1lm eauvo s sruo(m oudoptnlncsas)s2ta(mo;o0apeoio3iltfs2rmn p t4 ltnmfcta1opte n s;(0srto(r oy1am nmfctlt  Durx poo4apxomfctyd mDumnvont)teermo oatlm  auei;s setoir oo4ol e ncta(faDra(r oo0apeoifeiad s ea(mp (0texnir3oodfp elnvolt0tetoiopoudap  mict tfaDtmxroou4ope  f3taslaDuanmsnt4trxoiocoa1lpDe nvi t trxrxm3iy1op nlfvtatfs2ra( o;t4aet  fetadlmDeanmp u)tltoir3oydfaD lueo;t0s2tmxmpiu4lptemivilt)aDum(mpot1alen ietldls2uan sn(0 lxoif3iy1fpDraues;t0 rxrxopoo4lpe  ivt sf rtm(r ot1opxn icildls emums;(0tlxnxrcoodop  aieo (0setrxrpiy1ape  iviat)s2tm(mo;u4oeeoif3iatlaDulnms;u4trenmrctydoat luvs () etoxmpiy4ol elncsas srraxmoou0teenifcias m2umuvpnu4 ltrmo io1fatrliei;t0 rum(rpiydom n ncsls  ruax  ;t4apen feiasfs rmu o t) ltrxf3ia1lm  lies;t)s2tr(o3oo4apt  fcil(fs2uaur nu0tetnifciatlm2ra( ont)tetoxocto1fpD aueilt0s2tr(rpoo1apt lnvi t sDtrxmo;u1apeomfciytfm2emn o;u4 ltnmf3oodop  an i;( s2tmimpio4alte netlt  rua(m nu1tle moetlsfmDumuvp (0aetrio3iotomD  ieo;t srxo(rpnu1ap  licsl()arraxmo;o1oltnifetlslmDum(mp;u0aeerxocoa1fp e uvi;t)t2xmxrpoy4ame  ncsl( a2urxm ou0aexomiciytfa2eluvpnt0aleomf3iodom r ieo;()sruo(rpiu1omeelnes s  Drmumoou0oetnii3iatfsDumnmp u4 eerxr iytfpDrlu s;t  rxr(o3no1aptnmnvt s) rurum nu0teeomieiad m ra( o t)aeermr3iytfat lnvols0tetriopnydol   ivsasfsrur( p;o0oetnmi3tlslsDrauvo ()trerir ta1fp rauvi t0 2urio oy4lle  neia( s2trxroot0alxnmfeiasfa2raumont4arxomf to1fa rln i ( srto(opnu4am nlfesas sDuaxmo;o0aee ifeias mDrmuvsn()tlenxfcoa1lpD livi;t0s2xm(r nydlmeemnei (fa2rmxm no0tee mf3iytfmDulumo;() exomf ty1om eluesl() exmio oydapeelnvs (fsDurur ;t0aex ii3tldla2ulu onu)teeoxrcia1op rai sl(  rtoir3ny1ll n ici ( a2umxm nt1tpxomociasfm uln pnu)alerir3iadlpt lueolt truoir io1lm   ici t  Dtm(mp;t4optn iciydlm rmuvonu4artrmfciatlmtrauei;t  2tmiopiy4lleelfvia()sDurxrpno4oexnmietlt m um(vp;() ltrifcoatfateluvi;t)s2xo(o nu1ol elivt t aDumx  ;u0alxnii3ildfs elums (4texoiocoytfm elnvsl(0teto(mpny4lle  fciasfs2raxrpnt0tlxn oetatla umnmon(0aeenifciodomD  u il()t2uoiopny4omenmietltfs2rr(rpoo4opx io3tld a ulnms u4arerif iy1oaD ln s;t teuoimpiydope  nctltf rrr(rpno0aex ii3tydlm2em(ms;t)arerir oo1fm  aneolt)srtr(o nydopt  nciat srtau  ou0tetn iciyslsDuauvo u4arxnir tadfpt lieo s0s2xm(r oy4openmivtl( a2uaurpoo1tpxnmo3iad m el( pn()aetnmocoo1lmte ivs;t t2toimpoy4ape  ivil()a2rm(r ;o0apx moeiad a uauvo () rtrir ootopte ueo;t0 eumxr oy4am elfcil( a2ur(ronu0opxnioeiysfm uaums u4tlxoxf oadlmteaieo;t0t2to(m3nudap elivtl()arrmumpnu0teeoii3taslm2ua( o;(0aleoir iy1op r nes;t0 2toxmpiudol e icils) rtmxr nu0olxnmfeildlm2rmums t0 eenmo iytomtrln sl()t2xoim3ny1llee fvslt  Dumumonu1apx ii3ilt m2ea(ms t0arxrio3oadopDrliei;()t2trxopoudamee fvsat  2taxm no0opx  ociasfa2em(von() rxnmo tydlmtrluvils0s2umxo oo1omenmivtlt aDtrx  no4oeenio3tatlaDulnms t4 lermo3oo1omD aivolt0setrir3iy4omtnmneil(  rur(r ;t1tpx  oetlsfa eluvo t)tlxrxf3iatfm  aues;()sexoio3io1opt mfvsas  2ta( ooo4opxn ictldlm2ea(msnt0arxnio oydfaDrlueo;s0s2trio oo1lltn fcsatf rrmxm nt4tpxnmi3ildfs2elumonu0 etoxfctodfpD  nes ()tetmio3oy1ap elfeiat aDtaum ;o0openio3ild a2ua(vont)tltrxf3ootfpDran il(0srtmir3nodll nlfeils)aDur(rpnu1olxniietadla emn o u)trerio3oydlm eanvols texmirpoy1ape  iciasf Dtau  oo0oetomfciltls2el(msnt0 lermocio1fa elnvo ()srur(o3oy1lmt licslt)sDraxm nt0tpeo i3iydlm2elnvp;t)trtnxr ty1om rli o;s  etmxrpnydomenlfvsatf 2rmu poo0tpx  octytfm rau pn(0alenmrcoatlptraieo;t)t2xo(r3oudamt mncsat a2uaur ot0texomfciydfaDua(mo t4aexrmr oodlmDraneolt0 2urxm3iudopt lnet tfsDtmxmo;o4tlt ioctysfm ea(vp;t4tlxrif todfa rlneol()t2xmimpoo4am emiesa(  2umur ;t4opeo fctadlsDranmon(0tetnircoatfpDe nvilt texrxm3ou1openmncslsfaDuaxm ou0oexomoeiydls rlu p (0aeenir ootoaD aueo s) etoxr ny4aleemictasfsrra(mo;o4opeo fctldfa2eanmo;t)aetomf io1omDrlivs;t0 rtmxm3ou4ale mietltfaDumumo;o4aleniiciyd s rluvs;u4aexomfcootfp  aivi (  2xmim3nu4amtemfeslsf 2tmuro;t0oexo f3tasls2rl(ms;t0 lermrciatop  auvils)texm(rpnodlle  fesls) rtmx ono1tltn feils m rluvo t4tetnir3todlmt lnvi;s0srxmxrpio1al  lfvslsfaDua(monu0tpxnifctysls2rm(vs;(4trerxrctadfmtr uvslt  2um(r iydap e fcilt  2ta(r ;o0tex  o3ildfm elnvon()texrio iotfptrlnvs;t0s2xo(m3iu4lp e ivt (fsDtax pno0opeo o3tltfa2ul(vs ()texnircta1lm  lnvil()sexoxmpnu4ol nmietas) ruaxr ;t4aee  i3tat m rlnmsnt4trtnmrctotlpD li o;()s2toxo3ny4altnlfvt s) rua(mpot1texo fciys s2ul(mon(4arxniociadomte u s t t2urxopno4lpen nvi sf Dumur ;t1texomo3tys mDulums;t) rxrxo iatfa e i slt  exmio3ny1ope mneils)artmumono0altn i3tld m2rl(mp ()trxrmo3ta1op ean i;s  2toxrpiudlptnmnvia(f rur( pno4openmf3tyd s emnmsnu0tetomf oy1fmD aieils) exo(o ou4apenlfciatf 2rrxroot1tlx  fciatfaDulums ()trenmf3iodop elneo (0 etoxm iy4olenlfvt ()aDtmx pno0oexomo3iltla ea(vpnu)teerir3oatfaDr n o t) 2xoxo3oy1apeelnci s  rrm(rpot1oet mo3tas s2rmu pnu0 lenir3tadfp rlnvs;t0 rxoxmpou1aptnlnvt tfsDrax  nt1tlxnmiciydlaDeaums ()tetoifciadlm r neo;s0s2xm(rpio4aleemncta( s2taxrp;t4alxn ietldfs2ul(mp t4alenmo totomtraues s0trxr(r3nu4ol nmnvtlt s2uaur no4ale if3tld s2um(vp;()texrmr todfaD lueo;()sexo(r3oo1llee fvt tfa2tax oou1tpt mfeiyt m2uanmp t) lxrmrciydla  lnvsl(0trumio3iu1lp elfvia(fa2rax poo1tlxnmo3tlslaDrmnvs t) rtoxoctotfp rlu o s t2umxm3nu4lp nmnvias) 2ta(m nu0tleomicild mDemnms t0arxoio3oy1oaDran i s teurxo3ny4apt lfvil(fsrta(rpno0tptnifeiyt m rauvs;t) ltoxo3totfa rauvo t0 2tm(o io1omtelfetl()sruaxront1tpe mfcildls uluvpnu4alxnif iadfaDrauvs;(0sexmxm iy1lmenmneil(fs2ta(r ;o0opx mfetldlsDeluvpn(4 rxomr io1la e i olt)truo(r iy4al  mfct s) Dur(mo;t0opxnifeiyt mDumuvo;u)tetnmrciy1op   ies ()t2xoxm ny4omt mici ( a2rr(  nt0aee ii3tltla rlnms t4alxrxr ia1fpD ln o;t  ruoxrpio4op n nci t)a2ur(rpno0tpt  i3tadla2ea( o;u4trerxr3oadomtr ueo;t) ruo(mpoudom n netas)aDtrxmpot4apx mo3iltfm2rm(vo;t4alenif oatlmtr ueol()s2trim3iy4lpenmfvslt a2ra(rp;o4tpxnifciytls2elums t0teeoiocty1optrlueo t teur(o3oy1om  mict tf 2rm( pot0aetnmo3iydfa rmu o u4 rxnxf3iotfmtr ieo;s)t2tmio oudap emfesa(  Dtrurpno0altoii3iad a rau o;(0 lxnmrctadopDeluvo;t sexrxr io4lmt lictl() rra(r ;o4apto oeiyt m uau s u0trxnmo iydoa eli i;s srtmxm oo1aptnlncils  2rr(  ;t0oltnmo3tltfs2em(mp;u0 rtnmr3oydfm eaiei t0s2xmim3iy4ameemfcia(fartru pou4alxnmiciltlmDum(mpn(0 rermf tytfat aneslt) rxrimpiu4op emiei (  Dtmxrp;t0apeoifcildfaDrln pnt) eenio3oatfatran i;t0s2tmxo oy1lmtn fvs tfs2tmxr nu0apxomoetat m uauvs (0 rerxf3tadfm ran o t0srur(mpoo4alte ivt t) 2urxro;u4tpx  f3taslmDua(vo u) rtnmr3iydomDrluvo;t)setrim oo1ll nmivsat)sDrr( pnt0aetn ociltlaDrlnmpnu0 rtrxo to1fmte nvo;t t2to(r3iu1lmteliesatfartr(m ot4alxniociadfm2uluvpnu4tlxoio iytlpDe nvs t0 etoir nu1amen fvs ( srtmur nu4oexomi3tlsfs2elnvs u) lxoxf iatfptrlnvols)srxrxopoo4ap e feiatfa2tax p;t1aet ii3iysls ra( on()tlxnir3iytfpDrlueo t0sexr(o3nydaptnlfvil() Drr(ro;t1oex mietldls em(msnt4tetoifciodfmt li s;()srxrxr3oo4om  lictasfa2raumoou0apt  f3iadlm elums (4 lxrio3oadfat aneol(0 etoiopou1ome micsls)sDua(m ;o1oltn f3tlsfaDua(ms t) rtoxf3todfp  an s t0teuoiopiy4ame lncilt)aDurxmooo1oltnifeiydfs2ra(vs;t)tlxomo3todlpDe uei;s)t2xo(m3iu4al n fciat  2tax  ;u4tpeo iciydls rlu o;u0tlenmf ta1lp   uvo;t s2xm(r oo1ale lnes t) 2raumpnt0oexomf3iltls2rl(mo u) lxoirciytom eliei;(  etmxo3iy4omeelncs ( s2tmump;t1tpx ifeiadfa uan s;(4 rtomf3tatfmtr ieslt) 2uoir3oydlmee nes t)s2uaxrono1tlt mieiadfs2emn o;(0tltrirciatlpt luesl(  2xrxm iu4lmenmnei t) ruau pnu0aeeomf3iaslm2rmnvs u0alerifctotoaDr i il( tetm(m3oodllenlietlsfs2um(  ou4oex iociadlmDul(msnt4 ltnir3iatfaDrlues;( teurir oo4am emnetlt arum(m ;o1oeen i3tasfmDul(mo;u0trtomrctatlatrlivo;t)t2trir3io1lm emivi t) rtru  nu4tlen iciydfaDum( pn(4arxrmo iodopt aivi ( trum(r ny1lm e fcils)s2uax oot1oee ii3iltlm raump t0tlenxr tadom elnvsl( t2xmxr3oy1lm   fcslt) rurxm ;o4oexn i3iaslm2emn pnt)arxnxfcoy1fmDr i il(  rxmxmpny1op   nci s)srrrum no4opxomocias s2emnmp;t4altomr tydlaDean s;(0srtmir iydlle mnvsl( arrmx  ou0openio3tytfmDrmu p u0 lerxr oy1fmt ai slt  rtrio io1apenmfesl( artax  ;o1tpxnioctld sDel(mo;t)artoif3todlmD  u s;s0sexmxopiodomtelics ()srum( oou4oleo fctys aDumn o u4 eenxocta1lpt lu o (  2tmim oydlm emfeilsfsrur(ro;o0teeoiietad aDem(mpnu4tltoifcoo1lmDrluvi t0s2xo(o oudalt  fesl(faDur(mp;o1oltn f3tysla uaums;(0aexnxr3oodoatrlnes;()s2xrirpiu4ame lfvslsfaDraxmpot4tpxnioetltfs el(von()areomf3iy1fm  lneil()t2urxm nodlp  mnet sfa2umxr ou0aleoifetytlm2rauvon(4areoio tydlpteai i;t0trurxo iudllt mfvil() 2tr(m ;o1oee mi3ilslaDemumsn()alenio iodlmt lieilt) 2uoio3nodoltelivslt)s2ua( pnu1opxoifeilslm elu s;(4trenmo3tatfaDr nes;s  2xoim3oy1lmeelfeilt s2rmumonu0ope mi3iytfa rmn pnt4alxoxrcoytlaDelues;()setrirpiodolenlfcs (f Dtaxm nu4ale mfctltls el(mp (4trtoxociydop rlnvo s teum(r3oo4omt lfviatfarumx  nt1tlxniiciydfs2um(vo u) eeoxoctadoptr u i;t)s2xo(o iu4lltnmnvt ( srumurp;u4altnmo3ildlmDemump (0aetnmr tytopD  uvsls)teumim iy4olte neta(f Dtrxrooo4alxniietltfm2eluvont0treoif3tatfm  au i (0s2uoio3oy1oltnlnesa() 2rmu o;o0opx  ictadla2elums;u0texnir3ootlptrlnvilt0s2xmio3oo4op nmnetlt)aDuaumonu4apx  ociatfm2umuvont4arermr oatomteaivs;t)t2xmxopiy4amen ivia()srumu  oo1aexoiietadlmDelumsnt0 lxnif3io1omD  ivo;(0seumxo iodapen nci s srua(mp;o0texoif3iatlaDeanvp (4aleriocoy1om r neo s0seuriopiydalenmivias s2uaxm no1tlenioctytls rau ont)aleoxo3tatfa e nei;s sexoiopiodam e nvtasfsDtmu pou1tetn i3ias m2raums;(0 etrmr3io1omt  ieslt s2trxrpiudlltn netat)sDrr( ono4tltnif3iytlm umuvs t4tlenir3todlmD lues s0 2urxopiodapen fes tfsDraurpoo1teeo o3iysls um(vo;() rxnmo iydfpt au i ( teuoxrpnydomte ics t arta(rpou4tpe  o3iat mDuau snu4aeeoxfciadlatrlnvi;s0t2uoir oy1al  licta(fs2uau o;t1olxo fciys aDuluvpn() exrmr ootoat au o;t0trumir iy4ame mnes s  2uax  oo0tleo i3tatls2emnvont4teermfcoo1oaD lnvi (0teumxo ny1oltnlietas  2ra
\ No newline at end of file
@@ -0,0 +1 @@
+u s;t trtmxm3oudamt mfci sf 2raumpot0texoiocilt m uauvpnt)tltoir3oydfaDeau s;s trtr(mpiodlltn ncilt)srururonu0tlx io3iydlaDea(vont4arxomf oydlat  nvi;()s2uo(m3oudlleeliei tfaDtrxr ou4oetn feils s rlums ()artrmr3iatlp  lneo;( setmxo3iy4ol e iet s)a2trum ;t0tetnmi3iadls rmuvs t)artrxr ta1fmtrliei ()t2xrirpoo1optnlfct (f Drr(  no0oetomoctadlmDeln o t) lxoiociadfmteaivo ()texo(m3iudamtnmieslsf rtaxrp;t0openmfetaslsDra(vs u0trenxf3oytfatrauvs;s trtmxmpiy1lmt lfvslt arrru  oo0tleo ietys a rmnmont4tlxnmocoo1om rliei;t trxmimpoudop  lnvsa(  rtrx  ;t1openifeiadfaDem(ms () lerxrciy1lmtean s ( sexr(mpnodllenmnet s srum(m nu1apt io3tatlsDel(vs;u)areomociotfp  luvo t0sexoxrpny4al nlici t)srrmum nu4tlenioetat aDua(mon()tlxrmr3ootfmDelu s ()t2uoimpoydamtnlietlsfarum(ront4tleo ictytlsDulnmo t4 leoxr3iydfm raiei;(  rumxm3nudlpe micia( aDuax ooo0aet iociadls em( s;t) lenio3tydfp r ues s t2uoimpoy1lmtnmiei (fa2rr(m ;o0tlxnmf3iytfaDelnvo (4 lxnircoa1faDr neils t2urim no1llenmivtl( arumu ont0tptoioeildlsDrmnmsnu0trxoxr3iytfmD luvs;s) 2xoxo oudapeelnctat  2ta(rp;u4alen feiysls2rmuvsn(4 ltrmr3oa1fa   neo;s) 2xoxo ny1olenlfviasf rrmxmo;u4opxo f3tlsfs raums;t4 lxnmo3iytfmD lieslt  2to(o3nydol eliet ()a2umxr ;o1oeen octat m rlnms u4trtnxr iadoate nes (0 ruoxo3oydolenmneiltfsrrrx  ;t4altoii3iydla2rm(vs;t4tlxrmocoa1faD lneo s0sexm(rpnodaptelicslsfsrrrumont0oltnmictltlm ul( on(0 lenmoctadlaDrauvo;( s2xrxm iy4opeelivt () 2rrurpno1olxo iciat aDum( pnu0artnmo oy1omD ln o;t)truo(m3nu4llen fvslt)s2tmurp;u0texnmi3iaslm emn pnt)tleomo3ta1lp rlueil(0seuoxm3ou1lpt lfei tfaDtaumo;u4tpe  feiys a2ulnvs;(0aetnmf iatfa raivolt0 2xoxrpnodal nmivsls)s2tr(  ;t1olen f3iyt m elu p u)artrxf tytoptrlu s t0truoxopiodome mivilt)sDtm(roou0alxomieils s2umuvo;u4alxrmf3iodoa raueol( t2xm(r oydlltelfcs sf rrmxro;t0aexnmictysfs eau snu4 rtrmf3io1fpD lies;( s2tmxopiy4al nmncia() rtmurpoo0ope mfciyslm2ranmo;t4tetnmf oo1optr u s s)teumio iodlptemivt ()srumxmp;o0aeenmf3tyt s elumpnu0teenxo3oadlp  aieilt0 2um(o iu1lptemieil() ruau  ou1olenio3tldfm2ulump u0 lxnir3oo1opD lueo;t s2uoiopnu4ope lnetas  Dtau  ot1texnmi3tyslm2ra(ms u)tltoxr oodlmte n ilt0texoim3ou4alen iei s arrr(rpoo1olenmfeiatfmDumnvo;u4trxnmo iytoa eln ils  2umxr io1opee ieta( aDtaxr ot1oet  i3tlsls rl(monu)aeeoxfctatlpteli olt s2um(m3iu4lpt  feta( sDtmxrooo4texnmicildfs2emump;u)trxriocoytfp  ln sls0teto(rpou1lmeemicsas) 2rrumo;u4tptn oetatlsDrln s;(0tetrxocto1oaDeanei (0 rurxr3iodoltelfvi t aDua(rono0tetoiieiasfa2rmnvs u)aetoxo iadlpDr ivo t t2xo(r iydll emfei s sDuaxmp;t1optnio3iydlaDrl(vs;(4 rerifciydlat liei;s)tetoimpou1lpee netls)aDtr(rp;t1olxoioctldfa rmnvpnt4altniocia1omt an i s tetrio3no1optemfctas) 2raum ou0alxoifcilsfs2uau onu4 renircoo1lat aneols s2urxmpiy4op  mnvsa(f 2rmxmp;t1ale iociad m rln o;()alermrcta1lmt  ivolt)texo(mpoy1lme lncs tfartm( onu0tee  ociytlaDuaump t) reoio oatoateauvsl( srxr(rpoo1ll e icta()a2tmxrpnt1alx  ociyt a2elnmp;t0aetomr iytlmt  u s;t0sruoir iu1omt  ici () 2rm( ont0aptn ociyslsDulums t4trenir3tatoate nvs t)sruoirpno1lpt  neslt  rum( oou1aetomo3ias sDelu s u) renxfcty1lmtrluvi t)sexmxr3iudopt  fcta(faDrru  ;o4alt  o3iysfsDra(ms;t4artomocoodom  lu s t seurxrpiy1om  livta()s2trump;o4altnif3tatlmDuanmsnu)tltnxo oo1fateaieslt) 2trir3nu4lpe liesasfartru  nu1opeomi3iadlaDeluvo;t4artoxf3iatfateauvi t tetmxr3oy4lmte nci t)sDtrump;u1apeomfetyt aDel(vs;u4tleoxr3totfa raivs;s  euo(o3io4ameemnetlt) rtmur ;t4oexo iciytfa2eln pn(4aexrmoctytfmt an o t0trtoimpoodapeelncs (fa2rmumpno4tet  ocilslm ulu p t0alxnxrcoatfa rlues (  exrxo3ou1om   ict t)s2trxrpno1tpt iieiltfm uan snt0 rxoxr3to1lm e n i (  rxmiopnu1ll nlicta()artrxr ;t0tleo ocilsls ea( snu4texomf to1fmtrlnes;s) exmir3oy1alte neilt)aDtr( p;o1openioeiasfmDrmnvp;(0 rtoircty1fm eluvs;()s2urxr3no1ll  miciatfs2umxro;u0tee mictas a2rau p (4teeoxr iy1lm e u s (0s2umxr oodlmtn nvsat) Dra( poo1altniictltls rau s;u4texnxr ty1lptr iei;t0s2umir nu1lp e ietasfsrua(r nt4opxomfciad a2ul(ms;t4tltrmf oy1oateli s;(0seuoxm3oodomeemfvta()a2trum no1alt  o3tatla emnvs u0alenxfcoatfatr i o t)texoxm3oy4aptnlfesa()sDumxro;o4optnio3iadlmDeln s u0tleomociytoaD an s;s0s2ur(opny4al  livils) Drmxmpou1tetniietldls em( snu)tlxnmocoydlmDelieo t s2uo(opoo1amtnlfeil(  2uaxrp;u4apx mociys a rl(vp;(0 rxrxf3iotomD  n s;( t2umio3oy4lptn fetat artmxm no1oetniieiatfsDemumpnu0aexrxfctydfaD ln il()t2umio3io1lpe  ict () Dta(mp;u0aeeoifetydfm2uanvp u4aeenxrciotopDr n i t)t2uoxrpoodaptnlivsls)aruaxm oo4tlto f3ild a2rlnvs (0arxnxocoodlaDeauvol(0t2xm(o iu4amtelnvi (  Dtrxmont4tpxomf3iat mDranvs;(4tltrir iytfmt ln ils0srtrim oodal e fvsltfarrr(r ou4aex moeilt s2raumo;t0tlxrxr oo1fpD lues ()seumxo no1llt mfei t  2tax pot0olx  i3iys m rmnvs t4 lerxf3iodoaDeln slt) rumxr3no1lle lnctat) 2tau pno4oet ioetys sDeau s;t4teeomo iytfmDelnei;s0t2toxr iu4ap  mnct tfsrrmxro;t1texomfeiad s rm(monu4texnmr3ootlatr neilt  2to(r3nodlm   nvtls srum(  ;o0tee  o3iaslm eau pn(4 etoxo3tatom  aueilt)truoxr3iu1altn fctltfaDrr(mp;u4apx  o3tyd s ea(mon(0altnxociatlm rluvol( s2xmimpiy4ope lfci () 2rr( ooo0apenif3iys m2umn s;(4teenir3tatlaDraieols sexmxr ny4lm e fet (  rrrur ;u1oexniociatfaDrln o t0artnmf iy1laDe uvs (0s2umio no1omtn iet s) rtm(rpnu4olxoio3iad aDem(vs;t0texrmo oydlmDe u o;()trtrxo oydapenlfctlt)aDrr(  no4alxomfciydlmDuaums ()tltomr oadfm rli i s s2toio3iy1lp n fvsasf 2ur(r ot0aetnmo3tad aDum(mp;()teeoxfcoadlmte i i;s) rtr(rpou4ol  mncilt aDuaur ot0altn oetatfaDumn snt4alermo iytlp  aues;t) rtoxopiy4lmee feslt  rrmu  ;o1tpxoioctytfaDulums (4teerir ta1fat ai s t  etrxr nu1ale mnvils)s2taumpno0oet iociys m ranmpn(0tltnmf3totomt  uvols0srtriopno1opeelfeiat s2ra(m oo1ape mo3tldfmDuluvsnu0teerif3tadfm eauvs;s0srtmiopiu4al emfcils srrmu pot0apt iociytla ul(mpnu)aeerxr iy1lm rauei;(0s2toxo oudoltn ncs s sDtaurpot0tlt mociatfm2ul(vs ()texnmrcoa1fp r i i;t)srxr(m3ny1lltnlfct (fsDumxmpou4apeomictydla2uanmo;u) rxnmfciadopt lieils t2urxrpiudomeemies s  Drm(m ;o0tpt iocild s2umums;u)areomrcoy1fptr u s;s  2ur(r oodlm elnes s a2rmur ;t4olto i3iltlm2ul( snt0tltnmf oatoaDrln i;s0t2to(m iy4al  lnvs s)arrm(r ;t0opx moetydla2uan s (4teeomo oatopDraivol(  2urirpnudop nlnciatfsrumurpoo4texn feilsfs rl(ms t0 etniociatoaD anvo (0t2urxo ny1al  mfcs s)arumu  ;o1tpeo iciasls rmn o;t4 eenxrctodlpt luvs;( trum(rpno1opt lfcsltf rtrum no1olxn ietasfsDua(vp u)aexrxr3todlmtrlnvs;( s2trxm3no1op   ivs s)sruaurpno1tpe io3iysls el(vsnu0trxrio3tadopD aneo;() rxm(r3nu1lpt  fet t)a2umx p;u1alxnmf3iysfa ea( onu0aexrifctytoatr ieo;t)trtr(o3oo1ome lfcia(fs2tmuroou4alxo oeild a2eau o u4trxomr ia1omt ai ilt0srtoir3ny4ope  fcil(  2tauro;t0olx  icias sDrmnvs u0trtnmf3oo1fm  anvsls) etmxopoy4lpenmncs s a2urxr ou4tlxnif3tydfa2ra( onu0 exnifctodlpD livs;t) 2xm(o nu4am  lfcias aDrrxm ou0tetn fciytla rl(mo;(0trtoxf3tatoptr ues;t)t2to(m3oy4alt lncil(  2umxmp;o4apxn f3iasfmDrauvs;(0 lenir3oatfaDean i;t s2um(opiy1apt lnvsls a2tmum ;u1oltnmietatfsDranmpnu4trermf oo1lmDelnes;t0t2toxrpno1am nlnvils aDrrum oo0apx  o3iyt s el(vp;t0 rxoxociotlmt  uvi;t)srurim no1ap   fcta(  2ua(r oo1aetnmfeiys s2ea(vsnt)tltrxo3iatlaDe i o;t0s2xrxm3nu1lpt livs s aDtmx o;u4oetn o3tltlaDul( on(4teerxr3tadlmtrai o;t0 exrxr3oy1llt lnvslt)s2urxmo;u4alenmf3ias aDrlums;t4 rtomfcoo1fatr n sl() rtmxrpny4al n icta(fartruro;t1oex ifeiadlm rln s;(0artoxo3oo1fmD  u s ( t2xr(m iu4op elneta()arurxmpnt0tlxn oetadfaDelu o u4 rermfcoydlaDraieol( trxoxr oudoltemnvt t) 2ta(rpno0apx ifeildfmDeluvs;u4 ltoxrcty1op rlues t)s2xmxo3nu4ome lfvi (f rtr(ro;o4tpxo fciat sDumums ()texnir ootoptelnvols)truoxo nudlltnmietasf Dururoot4olxnifciad mDeanvs;(4artomf totla elu ol(  2tmio ou1lle mnvi tf 2tm(m nu0opto iciysfmDeau ont)aeenmf3iodlpD au s;s) 2xrxr ny1lpeelnvtas)s2taxm ou1aexo ictas a rm( ont4arenmr tytfmD  uvo;s setr(rpio4apt mfeta() Dum(m nt0aexnifciatlsDrau o (0texnmrcoodfptrlieo;t0trxmio io1lm elivias  rurxmono1aexnio3iytfsDuauvpnt)aeeomrcoo1la raivslt)t2xmirpnydlpt miei tfa2raxmooo0aptnmfeiadfs2rmump u) ltomr oytfpDrliei;(0setmimpiy4op elfcil() rrm(monu4aet ioctasfmDea(msnu4 exoxf3iy1fp eaivo s)srxmxr io1lmeelncil(  rraxm ;u0aetomieiatlsDuanvo t) lxrmo3ootfateluvil( s2xm(mpnu4ameelnct (fa2tm(  nu0tee mieildfm2ulumsn() rtnifcia1opDelivilt trxmxopio4ale licsl()a2um(  nu0oltn octas a2umumpnu0artrmr3oodoptraieo s s2umimpnodam emivs t  2rmur ou4aeto oetys s ulnmpn(4 rerir io1opDran i () 2tmiopiu4lpe  fvilt)srtaumo;u1aptnmo3ildla rmn o;(4teeoxo oa1lmteanes;s0trxrxm oy1ale lfciltf rrrx oot4ope  ieiatfm2uau o ()tlxomfcoydfp rlieols) rtrxmpno1amtelfctasf 2raxm nu1teenmfetls s emuvont) renmocoytfmDranvilt  2umim oo4amenlictasfarrau pnt0ole ifciydfm2el( o;u)tltnif todfpDr n ols)t2xrxm3oodaleelnetat srraxr oo0opxomf3iad mDea(vp;t)aetrxf ootoat  ueol(0setmirpny1olte ivs s srur(mont0oexo ietlsfs2umn o u0alermf ta1lpt an ols0 rtmir3iy1oltn fvia(  2urx o;t0olxn i3tlt sDea(vp;u0 etrxrcio1fa ranvsl()s2xoim3nu1aleelivi t  Drmxmpot0ale  ietydla2el(vs u)artomf io1lp eli ol(  2xm(r ou4al emfet t s2um( pno1oexnmi3ias s ea(mp u0tetrxrciotfpDeanei;t) 2trimpiodale livsas)srua( p;u1tpxomfetydfa2eau p u) ltrxfcootfaDeau o;s)t2toxr3iu4aptnmnes ( aDrau  ou0opeomieiadfm um( p;u)tltoio io1omD lies (  eumxr3no4lp  mfesls)sDrrumoou4ale  icilsfs2eauvpn(4 exoxf totfptrau o;s seuo(m3iy4alt  fetls)aruaxmoot4aex  icilt sDumums;()trxoifciatfpte uvs ()sexr(rpiudlme mnvi ( s2tm(roou4tpxoif3iys s2ran pn(0tlxnmfcto1opDeli o s)trum(r3nodoptemnvsas  2rmump;o4aee mf3iysls rlnmp t4artoir3oa1laDe uei t0 rxoxo iu1oltelnvil(fs2umurpno0opxo oeils mDrluvont)arxrxo3iodlat  nvo t seumxrpoodaleemics tf 2rax  ;u4oeto fetldls2em(vp u0 exomf3oytfm  ai ils)sexoio nydll e fes t sDum( pot0tpxnmf3tys aDuauvon(4 exomr todoat li i;(  exrir3ou4amtemnetasfartrum ou4aleomfctatfsDemn o ()tlxnxr3oo1oate ueslt)trumio3oy1lm emfvils) rrrx o;o1alxo icilsfsDuaumpn()arenxr3oadom raivo;(0 etmxr3nydop  liesat s2uax p;o1apt io3iltls2uau p;()aeenxr ia1opteau s t t2umir3iy1lmee net ( artaurpno0texniiciyslm uln o (0altnir oodlmDr neo ( texrir ou4oltemivia( a2tm(mp;t0olxn i3iasla2raump;u4tleoif ootoa rluvols)srxriopnydlme  fvtat)aDrrx p;o1tpenmoeilsfm2rmu o (0tlxnxo3to1fm elu ol(0trum(r io4omtnmfvsat)aDurxrp;o0tet ifeild a2ra(vp;t)teenxfciy1omDranvsls s2xrxopoodam nlicia()a2ra(m ;o4aeeoifcilsfs2ua(ms;t)trtrif3oa1la e i slt0texmim oy1lmenmies ()a2ururp;u0aleoii3tasls emu s (0tlxrxf3iatomtr ivs s)s2uo(o iy4ol  mncsl( srta(mpno1alxoifeiyd m2emnvs u)areoxoctodfmtrlnvolt)t2tmxopiu4op emfct tfa2uaxmooo1aexoioeilsfsDumu p ()alxnio oodoa rlnvi;s texoxo no1ll  lfct tf 2tmum ot4olxn o3iatfsDua(vo;u0alxrir3iotfpte ueo t) euoirpou4opt lfci ()sDrrxrpoo0apeo ociadfs em(vo;t0aeeoiociatoptraivil()setmxopnodll emneias) 2urxr nu1apxnif3ilsfa ea(vsnu4altnmrciydoa   neo ( tetr(o oo1ape lneiasf Dtru  nu0apeo feiatfmDum( pn(0texrmo3oa1lp eln s;t) 2xm(mpoy4lle lnei t)a2umxr nt4opt  ieiytls2uau p;(4trxnif3oo1lmtraueo s0 exr(rpio4optn ictl(  Drr(rpnu0teenmictydfa2ulumo;()teeomo ootlmDraneilt) 2trir iy1ol nmfcils)sDraxmpoo4tlt  feilt a2rlnvpnu) reoiocootlat  uvs;(  2uo(m iy4lme mfvsat) 2rru o;o1tle mfeias mDelnvo;t0teeniocoodfat lu slt srtrxopno4open ivs (  Drrum ;t4teen oeiyd m ul(vs (0artnmrcta1lmDelues;(0t2umio no4lptn fci t)srtmu  ;o4opxoiociydlaDumnmo (0aeerxfcoy1omDraivo t) eurio iy4aptnmiet t aDumx p;t4tltn i3tat sDra(mpn(4 reomo3iy1faD  neilt texo(r3iudapt mfvtl( s2rm(m ou0tlenifeiyt a emn snu0tlxrio ta1fm  au s s s2xrio3ny1opt mfciltfa2tmu  ;u1optnif3iysfs2uluvsnu) etnif3oytlmt anei;s)truoim iydapt  fes sfs2uau  ;t4olt mietasfsDemu o t4tltnifcoo1fm rluei s)seum(opnudlmte nvil( sDumu  ;u0tetniieiltla2uanvs t) rxoif3oo1omD ai o;s0 rtmir3nodomtnmneslt)a2rmu  ot4oeenmictas a2ulumonu4arxnmr3oo1om elnei;t) rtr(m nudoltnlnvi s artrurpou1oetnmictlsfm2ulu s t0altrxr3totoa rai s;s)s2urxm3oo4ole  fvsat)sDur( poo4apenifetlslm ea(msnt4tetrmf iadopDeliei;t srtoirpiy4lmtemfet tf 2rrxm oo0oexn ociadfaDeluvsn()areomocoy1oa rluesl()t2tr(r3oo4op n fcs s sDrru ono4alt micildfaDuau snt0 reomo tatlpt aueo t s2xmxo ny4ll  miesl() rurx  ou0opt  f3tyslm elnvsnu)artnmrciadfm elu i (0 exo(m nudaltnmnet t)aDtr(  ou4aleoif3iydlmDemn pnt)aetoxo io1opDr ieilt) 2uoxrpoo1lmen nvs t  2umumono0apx  fetyslmDemnmp u0 lxnmrcoodom rlivi ( seum(r3iodaltemncsas arrrur nu1opt  ietyd sDua(msnu)trxnmr iodfmD luvils t2um(r3ou1llenlfctat arrm(rpnt0texnioctlsfa eaumpnt)alxrxo3to1fatrlneo t sruoxmpiydlpe mies (f Dum(ro;t1alxoio3tysfmDum(ms t0 etoxo3oydla elueslt  euo(o no4lm  mnctasf Durxront4opxn ictad s2rlumsn()aeenio3ootlp   nvolt)t2toxm3iudalte iesa()a2uaxmpno0ole  o3iydlmDrauvs u0 rxomf3iodop   ivo;t  etrxrpiy1lm  lfes s)arur(  nt4opx  oetlsls2um(vont4 reoif oa1lp  anvo t t2xoim ny1ale  fctltfarra(r ;t0ole  fciytla rluvo;() rxrmr iodfmt  u s;t0trxrxr nu4llt  fvsls) 2trxmp;o4aleoifeiltla2uanmsn(4 rtnmf iatlpDeaiesl( teuo(o ou1opt  ivt tf rtr(m no0aleniietydfs rlnvo (0artrmrcoadla   nvo;(  exo(m3ny1lm nlivi tfaDrm(monu0oexn ociasfmDeln sn(4altnio iadopDran i;s)sexo(o iy1lleemfetlt aDtru pou1oex mf3iltfa um( p;t4trenmr iodfm r uvi;(  euo(r ou4om elicil(faDuaxro;u0aleo f3iltlm uanvp;(4 lxomo3to1op   u s;t0 rxmxopny4opt lfcsasfa2ur(r oo4opxn ieilt m2rmnmp u0treomr tydoat lnvo t)tetoxopoudapen iviatfs2trxr ;u0tlx ioeiatfa2rl(ms;u)tlxoxf3tytlp  lu s t  rurio3oy4olt mfesas  Drmx ooo0ope io3iasla ra( o t)aexnxr3ootfmtelieo s  exr(r nu1al n fetls srtmump;u0tlxomoctltlmDulu o;u)arxrir iatfpDelivils)srurxo3ou4lmenlfctas srrru p;t1alt mf3tysls2ua(mo;t0tltnifciydoa rlnvol(  ruoxr ny4opt lfcsl(fa2trxroot4tlxnioeiysfm ranmpnu0aeenmf tytfmD  ieo t0trtm(o3oudap nlfvsls  2tr(mpot4alx ioctasfm2rauvo (0 rtnmf iotlaDrlu sls texrxmpou4op nlnvs ()arum(r nt4tpt  ieildfsDem(vonu0aetnxocto1oa elivi (  exmxmpny1om emfctlt aDumxrp;t4apeo ictas s em( on()alxoxrcto1opD anvo;s srumxo3io1lm  lnetlt) rrmxr ;t0apx moeiydla2rm(vo (4trerxr iy1fmt ai o;(0 rxmir3oodapt lnvi t srtm( ooo1aptoiociasfs rm( snt4 eenxf oodoatelivs t  eur(m3iydlpenmncs ( srrrum oo0oee  i3ias mDrmump t4trxoxo3tatlp eluvo t0tetoxm3nydap emieia(faDum( p;u4texo feilsfaDumu snt0alxrmf totlmte u o;s) etr(m nudopeemivsl( sDtr(mpot0oeenmo3iysls el(mo;()arxrio oy1fat lnes;() 2xoio3ny4lpte fetls) rrr(rp;u1alx  feiyslm2rl(mont0tlerio iodoaD  uei () 2xmxr3nodlle lfctlsfsrtrxrpoo1alxoiieiltlm rm( o;t)alxnmf3tytfat lnvo;t0s2tr(r oo4lleemiesa(  rua(roou4teeomfctltlaDrl( p (4tltnif3oy1fmDrli o;t)teur(r ou4omtnlivsatfaDtmxront0tex ii3ilsla2ua( o;(0aexnirciotfa rlieo s  rxmim3nodal  mivsatfs2ur(mp;t4olen i3taslmDulnvo u0 lxnmo3iadlm elueolt0 2ur(rpnu1amt lfvsas)srumu o;t4alt  f3ild sDulu p (4 eenif tatop e ueilt  etrir iydoltn ncils a2ur(moot1olenifciatlaDumnvp t0trxomociy1omDran s;s trumimpio1aleemict sfaDurx  ot1oet if3tasfm2uluvp;t4trxnir iy1oa rlnvo;() 2xmxopno4llen fci (faDtaur nu0apenmfeilslsDel( s u4arerir3ootfp  livi;s srurim iydopenlivs sfa2tr( p;u0oex miciltla2ran snt0arermf totfaDr ivs;s0trurxr3ou1lmeelietlt)srrau  no0tpx iicild a2rm( o (4texomo3oadlm r i o;s s2toir nodomt  icsl( a2urxm oo1tle mo3tadfm2rmu s u0tlenxo3ty1la e uvilt s2toxo oo1openmneil(fs2rrur oo4olxoiictadlm2ea( o;t)tleomocoytopD aneo s0 ruo(r3iu1ole mncs s)aDtrx o;t4tpxoifeias a2elumpnu0 reniocta1faDr ivols)seumxopnu4ll nlictl( sDtrxr ;o4oexoiieiat a2umn s;t)trerxr3ta1fmD  ivi;t srumxm3oodolt mfei s a2tmu  ot0oleoifctad m2uauvo;(4aexnif3tytfatelu sl()t2uo(o3iy1al nlnviat)sDraurpno1oee  f3ildfaDua(ms;u4texnxo ootom e n o;t setoxm3iy4lmtemivsl()aDrmx  ;t4oexnmieiyt a elu s u4arerio3iatfa e u slt0 rtoir3iydol n nvtls artrumooo4oexnmiciatls rl(vs t4aetomo3iytomDe u s;s)t2trxrpio4lmenlfesl()a2tmu pnt4tpx  f3ildls elnms ()altnirciytomDrln ols seum(rpnudap nmnetl( s2rmu oot1aet io3tydla ra(vo;t) lxniocoytom eanvi;s sruoiopny4lp  mnvs (fa2uaxro;t4ope if3iltlmDul( p;u)teeoxf tadomtr n s;t0teuo(o3iudap  lfetl()a2rrxr ;o4oet ioeiyt sDra(ms u4aeermr3oadomD  n i;()tetmxr nu4am   nei s) 2tmxm ;o1aexnmieiad sDuauvo;u) etomf iotlpDeauei;s0trxmimpiu4lpeeliei t  Durump;u1tptn i3tyslmDua(vpnu4arxoio3ootfat  u o;t0 ruoxo oy4om   ivilt aDtru o;o0texoifeiytfaDrlumpnt0trenxf3iytfmDrlieo;()trtrxopoy4oltelivil() 2uax oot4oltomiciyslsDuanmp u4tlenmo totfpte u sls) euoirpno1lpen nviasfa2rrx o;u4aetnmfetat mDeauvsnu0aexrmociydlaDeli s t0 etm(m nu1ap  livsat  rrru pnt0tpxoifetas s2umn pnu4altrmfciadlmDelueo () 2trim oodop  lfvtlsfsDrruronu4tpe  oeiaslm2eluvo t4teeomf3iodop eaivi s0srtm(r3oydlpen ncsat)aDtau pot1aeeniociys a2ra(mo (4alenmr ia1lp ean sls setmim3io1alt lieslt aDtr(mpnu4tee ii3tys sDean on(0 exrmr ootlmD  n o;() etr(opnu4openmfvsasf rra(mo;u1oee mf3iyslm rmnmsnt4arerxo tatfmt ai s;t)teur(mpoy4ll  lfcta(  Drr( o;t4texnmo3tldfm elu pnt4 rerir3ootlpDraueo;s)s2xo(opiy4altnmicil( s2taurpou1oee io3ildfs eanvonu4 leoioctodlmDe ivilt texrxm nodome  fes (f 2rmxmpnu1apt moeild a umnvpnu0 leomr3io1lpDeanvs;()seuo(o3io4ol   fesas) rrauro;o4oltn f3ilt aDrlums;t4aleoxrcia1la e neolt seumxm oy4am  miesl(  ruaumpno4tee  f3tls m2umuvp;t0trtomocio1lm r ies;s texo(opnudop  mfeils)srtau  ou1aptn oeiat a2ra(vs;t4aeeoif oadfpD  iesl()teurxo iu4lle  fvtat) Dtrx  oo1alxn ociydlaDem(vs;t4altnxfcoadfaD ai s;t0 2xoio3iu4optn nesltf Drmum ou1teeoifciyt m ea(ms;(0aetomf3oadopDranvs;t0sexrir nydal e fvsa(fs2rmxroou1aexo f3ildlaDrm( p t4 rxnxo3iydfp rau ols) exoxo3ny4lpenlnet tfs2ra(mpno0apt mf3tldfa elnms (4aeenmociodom eln i s)trum(o3oo1aptnliet (f Duaur oo4tlxn octydfsDul( pnu0 eermo tydoa   nes;(  rxrxmpiu4lmtn nct tf rtrxmont4opxomoeiyslm rm(vp;t) lenxfcoa1lpD livi t0texoxm3iu4lm emfes sfsDuaxrpno1olenmo3tatfmDeauvo;u) rxrio iotfpD aieo t0texm(opnodale mnesa(  rtaur nu4opxomietltfsDelnvp (4aexrxo iy1fateauvilt0 2um(rpnu1apte fctasf 2uaxmooo0oeeoif3iltfs2ulu pn(4artoiocoatfa  ai o s  exo(o3nudap elnetas)sruau  nt4olt io3tyd a ra(mpnu0altniocoy1lpt lnei t0 rtmxr3io1lpte nvs ( artrxroou1apxniictltlaDemnmon() rtnxr tydlaDr ivi;(  rtmiopoydape lici sfa2tm(  ou1opxo f3tatla2ra(vs u0 lxrio oadlpt auei s  rtm(o3nu1olen ivtlsf 2rmx  ou4alxn ociadlaDuau s;(4arenxo3oy1lateauvi s tetr(r3oydol  mnesas)s2rru pnt4oeenioeiyd a2ua( snu4 rtnxf iotfat au slt  2trim3iu4am e ncsa()aDuaxm no4ale  f3tad m emumo;() rxriociotlmtran s ()srur(mpnudom   ivta(  Dur(root4tleniocilt a2ulumsn(0 ltnxrcoy1fm eanvi ( setr(opiodopee fci tf rtau pnu4altomfeild s2elnms;u0aetrmr ty1lm  luvil()s2xr(o nydomt  nctls)srtaxm ou1opx mfcias a2rmu ont)arxrxo3tydop r i s;()sexr(rpio4lpee ncs t)sDtax ont4altomf3iydla ulnvpn()aeenmo oo1oa  au o ( s2umxr3ou4aptnmfcsls)srtmur nt0olt mi3tls a2emnmp;(0texnmociydfa elneols)texmxmpno4al n neiatfartr(rpnt0tlx if3iatfa2raump;t4arenmo oatlp   nvilt0trumirpou1llee ietls)srtr( ono0tptnio3tys sDulums;u)tlxnir3todoa rlu o;s s2um(opno1al  mfcsatfsrrmxrpnt1alen o3ilslm2elu pnt)aetnio to1om   uvsl()seurxm3ou1lpe mivtas) rrm(mpno0aet  f3iltlsDrl( o;() renxf3io1lpteaueo () exoim3nu4lm emnvt ( artrxmooo4tlenmociasfa elnmsnt)tlxoir iodoa r nvs;( tetmimpoo1lp n iesatfaDrax o;o4tle mo3tys sDemumpnu) reomr oatfa eaivi;t setm(r3oo1llenlnei ( s2umum ;t4olxo i3tad a ra(ms (0aetrmfcoodlm eanei s s2toxr ny1am  mnet ( a2trx p;t0altnifeiadfsDuanmpnt) rxrmrciytlmtrliei;s0s2uoxr3oy4opt mietas srtr(moot4opxo feias m rmuvp;u4 exoxo3ta1fa eanes;() 2trim3iu1olenlics s) 2trumpot1olxo feils a2eluvp;()arermr3io1om raueol(0 eumim3iu4alt mfcsltf 2tr( ono0aeenmfeiysfa ra(ms;u4tlxrmo oytfp rlieolt0s2umxrpiy1olenlfvtas sDuaxr nt1tpx mieildfsDrmu s;t)texoio3tatfmt  n sl(0srurir oy1am emivi s) ruau poo1openiieiltls2umu o;u)trtrmocootlaDrlu sl(0trumir3ou1omee nesa(  2ururo;u4oee mocilsfs rmnvsn(0texrxf3iydfmteai o s0trur(r3iu4lmtnlnei sf rumur oo4aee  ociyt m2rmnmo;t4arxnxfcia1fpD luvs t trxoxrpny4lmt lncsls  ruaxr oo1olxomfeilsfmDuanmon(4 exoxo ia1oaDeliesl( setr(r3no1lp nlfvta() Dtrxrpno4aet  icias a rmu p;t)trerxf iy1oate nei (0 etmxr3iu1apt  ivtls  Dumx oot1aee iiciyslm2ea(mp t0areomr3tydfatrlivo;(  2xmxr3oy1ll emieslsfa2rmxmoou1apxoioetat a ulu sn(0arerif3iodoaD lu o ( sexrxm3oy1altemncilsf Draxm no1oex  feiasla2ea(mo (4tetnxocoytom e ivilt0trtrxrpnodoltemiviasf rrmurpou1oex  octydfmDemu ont)areomr to1lmDelu s;( trxm(opou1omenliesltfarra(rpnt1oexomfcilslaDulu o u)tltoxf oadlp ranei t0setmxo nudlm  mnct (fs2taump;t1texomietys mDum(ms u)alenir todop  aiei t  rur(m io1ol   fvsls  Drrump;o4aptniiciytfm2ulu p;u0areomf3tadoa r u ilt0trxmxmpoudlp   fetat)sDuax  ;t0openmfetas mDumnvs;u4 eeoircta1la   uvi (0 rtrir oo1lmenlnvs (f 2umx  nu0tle  ociltfs2rm(ms u4 renmf3iatlmD livs;(0seumxm3nudame lnci tfsDuaxmoou0tpx ifcilt s uau snt0arermoctotfmt lnvi;t) rtrxo3iy4am n ivi s  Dtrxmpou0apt mfcildlsDrm(vp;t4 etnmo3iatomt luvi (  rtm(o3no1al emivsa(fsrta( pou0opx  fcilt sDel( p;u)tltoxf3ty1op rln o t srxmxmpiu1apt livil(fa2rrum ;u4tlxnio3tatlsDulnvs;()arxrmr3tytlpteli i;s0sruoxo iudoptelfci s) 2umxrpno4oee  ocild a ranvp;u0tlxnmo3oy1fpDr n i ()s2xrxrpoy4apeemnvsasf Duax p;u4aexomf3ilt sDraumon(4 lenmrciydlpD aneo (0 rumxr3no4op nmfei (fsrra(  ;u0aptniocildlaDran onu4aexrif oytlp rauvi s0 euriopoy1ap nlfei () Dtrxr no0tltniociltfa2rm( o t) eermr3oatlmDrlieo;s) etoir iu1lm emfctl( arta(moot1ole miciltlaDel(vo u) rtriocia1faDrai sl()sexr(o oodlmee nctlt sDurxrp;o4opx ifctydlm2elnvsnt0aleoxoctytomDeaueils)s2tmxm oo4ale mfviasfsDurumpou0oltniieiytfmDumn s t0trtrif oadfa e i sl(  2umio iy4oltelfvsas)sDtrumpno4tlxomieiltls2uanms;t0tltrifciatop rai ol(  rxmxm nydapt mfciat  2tmxrp;t4tleomfctadls ean snt) exoir oy1oat  neil( t2tmio io1lpt lfvtat)sDumum ;t4tpeoif3iatfmDemu p;()tetoio oydlpteaivo;s s2xm(m nodllee fctat)s2trxro;t0oltomo3tys m2em(ms t)aleoxr oa1fp r ivs t)seumim iu1apeelieils)srrmum ;o1apx ioctysfs rl(vo;t) rermf iydfm eauvo;s) 2uoim3io1aleelivilt)a2tmx  nt0tptnmiciys m2emn s;()tlxomo3iy1lmD li ols0 exoxo3ou4llt lnet ()a2ua(r ot4alt ioeiatfsDrlu p;(0aeenio3iytlmt aues;t texmxr oodop elnvsa(  Dur(  ou4aetnifeiasfs uan on()trxrmo3oo1fptr i i s0srtoir3iu1am e fctas) Dtrxrpnu4oeto oeiadla uaumo;t0aetoif iodop raiei;t  2umirpny1alt micsls)arrr(mp;u4olxn oetytfsDua(vonu4treoifcoytla elivol() 2xrir oy1apen ncsls a2ua(mo;u4aet ioeiysfsDemnvp t4 rxoio3iydlpDe uvolt  etm(rpiodlpenmfcsl(  Drmxrpnt4texnifeiytlsDean s t4teerir iy1lpDelivs (0seurxm3no1olt lnvtl( a2tm(mo;u4opxnmiciltfmDel(vsnu4 reoir3tadlmD  uvo ()srumirpno4openmietlt  2uaumo;o1tltoifetlt aDumu s u0 etrxf iydlaDrluvo;s) 2xo(m nudame lfvsl() rtr(rpoo1tlxoifciyd s uanvo;u)aeeoxr oo1fm rau ol(0 2tr(mpoy4amte icta(f rum(r no0apt mociatfs2umuvp u)arerif iydoaD aivi t tetriopny1olenlicta()sDtm( oot4oet mf3tyslm elu ont0 etomrcio1lmDe i ils)seurxrpnu4amt lneias) Drm(r ;t4aex ifeilt m2um(msnu4teeriocoadfp rli ol() 2uoimpoo1apee fvi (f 2tr(r nu0tpxnifciyt s2umn p;t4artnir oy1la  au olt srxmxr oo1lptelfct ()sruaurpot1aet mo3tldfaDran s (0 ltomrcto1om eanes (0 rtrxopnydlpt mnet (fa2umu  ;o0opt  oeiysfm2rl( s;(4 ltnxr oatop   neo t t2uoxrpnu4lpt  fvs s aDuau pot4aeto feiadlm emnvp;(4trermr3oa1lm  au s ( s2uo(o3io4llenlfeilt) rurxmono1ale  oeiltla rmump () ltoif todlp  li o s) 2ur(o3nu4llee nvi (  ruax  ot0aleniictadfm2umnvs (0aexrmrcta1fptrliei t) eumxo oo1lm   ncilt) 2rrxmpoo0aexnmiciasfs emuvo;t) exnmr ty1oa rai i;( t2trir nu1omeemnes s)srtaxront0aptomieiyt mDea(vpnt)aeenmfctydomt luvils sexm(r3iydlp nmnvs () rtr(mpnu1tlenio3ilsla2rm( s;t)aeeoxo3tydomD au i s trumir nodolen icilt aDurxrpoo1tlxnioetytla2emumo;()aetrmr3oydla  lneo;t)seto(opnodomtelnvs tfa2taxm nu4ale ioctldfsDrm(vpn(4 eeoir oy1opDrlivs t) 2toiopou1lltn feiatfaDraum ;t1ope moeiltlsDea(vs t)tetnircta1omte ivol(0s2urxrpnydlm nlnetltfa2tmxmoot1tptn i3iadla eaump u)aeerxf tadla e n olt  rxmxopio1aptnmfvsltfa2tru o;u1opxniiciyslmDrauvs u0tleomf3ootoat  u o s0s2xoxr iu1al n nei ()s2rrxr no1oeto fciytlm rmnmp;(0aeenircto1latranvi s0setr(mpny4ll e netas)srumumpno4teenmoeilt m2ulu pnt4tetrxr tatlaDrli il( setoxr oo4alte fvt (fsDraumpou4ope moeilt m2elumsnt)altniocto1fm r u s s  2xoxo oydolte fesa(fsrurum nt0tlxn ociytfm2uauvp;u0 rermo to1fp  ln o ()sexm(o3ou1opt  neia( artr(rp;t4opt mf3iyt m2rluvs (0altoxfcty1fp   i ils) etoiopno1lpt  fvt s)srtaur oo0alenifciysfmDum(vs (4tlenio3tydom r i i s0 rtmiopoudamenmnvsa( s2trxmpoo1tpxnmociatlmDrlums;t)aetrxfctydlptrau olt0t2xrir3nu1om emncsl( s2uaxr nu0texoii3ils m2ran p;(4 reoxrctytfa   nei;s0 exoxo iy4amte nesl()srrax  ou4oetn ietlsfs rm(mo u4alenioctodoatrli ils  rurim3no4amee nci ( sDumx oot4olxo octatfsDrlu o;u0aetrmocoytomtr u s s0trumxm3iu4ap   ivs sf 2trumooo4aexnmieilsfaDeau onu4texnxo3to1op e nvo (  rurxm3io4lp elivils)sDrr(m ;o0aptoioeilslm2ranmo t0trxnmr iotoatraneils)trtoxmpny1lmeelfcslsf Dua(mpnt0apxomietlslsDea( p;u0tetnif iy1fmteaivslt0 rtoimpou1omeelivsls) 2urxrono1alt moetasfs rmumpn(0trerio3iy1fpDeanes;t)srumiopio4ol elfvs s sDumxmont0aex  oeilsfm uanvsnu0arerir oydlmtr n i;( trurimpoo4ap e nctlt) 2rmxrono0alenii3tld m umumpnu0aetoxo3iodfmteai i t seurxo3iydlmt  fvil(fsDta(rpnu0oexoifeias a rlnmo;u) renxfctotom eau ols)teuo(r3ou4lle mictas artru ooo4olenif3iltfm eln s;u4tltoxf oodfmtr u il( s2xoxm3iudap emfvilsfarrruront1apxn f3ilslmDemnmon()altnmo io1oate n i t) rxmxm iy4ol elncs sf 2urxrp;t1ape mfetldlaDeluvs (0tlxoxf oodfpDe ivi;s) rxmxmpiu1lp nlnvtlsf Dtmum ;t1optnmo3iytfa2rl(vs u4aleoif ia1latean ol()srxoxm3ny4lpte icslt  2rm(rpoo4oltomoetltlm2emumo;(0alerio3oy1lpD ln i;t tetrxm3ou4ll  mfvtl()srua(rpou0olto ietltla2ranvo u4trtnmf tydfpDean ils)trtrxr iydopee nvtatfaDtmxmpou0tlxo oetls s2elu pnt0tetnxr oadfpD au i s0 eumio3io4lp  mnvt s)sDum(rpnu1tet  o3iydls2um(mp t4tltnifciadoptean i ()setrxopnodoptemnvi sfarrr( o;u0tee ifciad a2rm( p;u0alxrxf oo1omD auei s t2xoxmpnydomtn fct (  2tru oou1olxo feiysfm2elu o u0aeenmf3oadop e ues s)tetoir3iodalt  nvt (faDrr( pot1altn oetyt s2ulnmonu4aexnmr tadlmtranvol( srxoxopiu1llte ivsls)artmxm oo1altnif3tatls ea( p u)tetrxocta1la eaues s0seuoirpnodlmte ivtls) rumxm nt1tet mo3iltla eau p;(4altrio oa1fa r uvs;(0trtoiopny1lpenlivta(fsrtauroou4apt  i3ilt s rmuvont0treoxrcootfpDe u ils)truoxo ny4ap nlict tfs2ra( o;o4apt  ieiyslm2umuvont0aeerif oy1la eli ils) rxm(r3oodll elicia(fs2rauroot1oee if3tatfs2rl(vp;u0artoxr iytfateanei t0seto(r3nudamenlicslt)s2ta(m nu1oetomo3iltfm emnmonu4 etnifciydomD  nei;s t2toimpiodlmeelivta()srrrur oo0olx  o3iytlsDrlnmsn()trtrmr3iy1fp eaues;t) rumir3iu4lmt mfei s)sDumu o;t1ole io3tltlmDelnvsnt4teeomociotla r neo;t)trtmxopnudal   ieias s2ur( oou1oetnmieiydfa elu p;t0trtrxrcta1fat  ivs s0t2ur(o3no4op elfvtlt aDtmumpnu1altoio3iydfs umnvp u0 eerir3oa1lmD livs t0 eum(r3ny1lm elfetl( s2ua(ront0olxoioeiytfaDuaump u0 reoio3io1lp elu o s)s2urir3nodlmtnlfeil()arururpno1tpt ifcias a2ea( pnu4artomrcio1lm  anesls0srtoir nydole lnetat) rtrumpno0texnmiciys aDran s;(0tlxnif ootla e ues;(0 rur(r io4amt livilsfs2umuroou4alto f3iys s2umu p u0aexoxo3iy1fpD aieils  rum(m no4ol  licils aDumu pot0alxomoctadfaDuln onu)tlxoio to1fmD lnvsl( t2toio3oodll emivilt)sruax  ;t0tpenmi3ild mDumn on(4altrmo3oadlm r iei;s) eto(m iu4amtemnet tfsrururono4tpxnifctytfs2uan o;u0tltrxo oy1omD  ues;() 2xoxopnydlmee ncsl(f rurxront1opxn ietas s2uau s;u4texnxf ootomt lu sl()srxmio oo1ap nlnctltfsrraurono4texnmociyslsDul(mo;u0alermo3todomt  u ols)setmxm iy1olt mfvi s  2ta(rpot1aee if3ilsfs el( s (4texnxfctadfm elivols srto(r nudalt  fcils)srumxr oo4ope mi3tls sDrlumont4trxrio3ta1fpDeanes;t)srxr(o3ou1al nlfctl(fsDrrum nu1apt  iciytls rlums u4 ltoir tydopt aiesls0s2tmim3oo4alte netas sDraumonu0tlx iociat sDuanvo;(0tetnmf ootfm  aueil(0s2trxrpio4omenlivtltfarrax ono4tlxomociys s2rluvpn()tleoio3iy1lpt an olt)s2trxr oo4amtnlieiatfa2urx pnt4opt ii3iytfm2rl( on(0trxomr3oadomD li il()t2xmxo3nodomeemies t)aDrau  no4ale mi3iaslm ua( pnt) rxnmr ta1lmtrluei s0 etmio iydaleelfvsat  Dra(mooo4alen i3iydla ran onu4artniocia1late ieo;s)texrir ny1lmee fvt (f rur( p;o1tpeoiiciatfm2emu s (4 renxrcoadom rlnvil(0srurim3no1olen ieias)a2ur(rpou0oex moeilt a rmn pn(4 rtoioctytfptran sls0 rxmxo3iodolt  nvia() 2rmu p;o0tetomf3ias mDrmumpn(0altrif tytom  lies ()seurirpio1amt lfvt t)aDrruroot4opt  ieiadfs2umums;u4tlxnxo tydlmtr ues s)t2xrxm nu4ll  lfvs () Dua( ont4apt iicilsla eluvo;t0 ltrmrcto1fa rliei t)trto(o io1lltemfvsas)s2uaumono4tlxn i3tysla2umu snu4texrxr to1omDeanvs;t  rtm(o3io1aleelfvslt)s2rmxm no1tlxnmoetys sDeanvp;(4tlxrif iytla eaieo;t)s2urir ou4lmee icta(  rtaump;t0tltomfeiadls rau o;u)aetrmr iodoa e u il( trtrxo3ou1ap  mfctas)aruru poo0aptnmf3tltlsDelumo;u) etrmr3oatom   u i;s)setmir oo4lm  mncs s  2tr( pnu4oltnifcildls umu o (4aexnif oodomteli s;t0 2tmio3iodam  lnvilt s2ta(mont0open fciltlsDrluvp;t0trxnmr3iy1fa eau o;s0sexr(r oo4lmenmncsat aDururo;u4optn ietat s2rlu s;(4 ltnmf oa1oaDe n s (  2urio oy4opee ici t)srrmumpnu1oetn fcilsfa ea(mo (0aeeomfctytfpDe ues (0s2xmxo3ny4lmee nvsat)aDtru  ot4tee mfciyt m rmumon(0arerxo3io1laDe nvi;(0s2xr(mpiu4lmenmnetltf rtru  no0olxn feiydfsDeauvo;u)alxomfctadlaD aivs s0trxm(r3iodomt livt (  2urx  nu1tpxoif3iat s2uanmo u4teenmr oadoaDelieilt)sexmir nydap e fei t  2urx pno4tex  ieiadla el( s u) eeoxocoo1opD aies t0sexr(o3nu4lpt  nctltfsDumu ont1texo fctat s2ea(mon()trxnxrcoatfptraiei ()t2to(rpiudllenmivil(  2uru ono4aeeomf3ilsla2ra(mont0trermo iadfpDe iesls)tetoio iu4olt mfeiatf 2umu  no1tleoiieiasla2umump;(4 rtrxr3tydfatranvs () eumxm ou4lm emivtlt  rtru o;t0tlt  feiatfsDumnmpn(0 rermr ootoaDeai o () rxr(o3oo4ameemfei t arrm(m nu4oex  ictlt a rmnvon()artrxf3iatfp eaueils)srxrim3oudaptnlics s)srumx poo4tlxo fcilsla2el(vp t4altomr oy1omtrluei () 2toxo oo1lpen nesat  rta(mpou4opeo ociydlm2umnvp () etoircoodomtrln s t0 ruoxr3iudaptemivs ( s2ra(mono1opxo i3iatlsDraumo;()texrircio1faDe nes t0teto(m3iu4lm e iet (faDrax  oo1olxo oetatfa2el(mpn(4artomrciy1oaDr uvols  rxo(o ny1ll  miviat)aDtaumoot1olenmfeilt m2ranmpnu)aetrxfcoydfmDe ivils0 exm(mpiu4lltn ivi t)s2trumpot1aee  i3iaslmDemu o;(4artrxr3tatlpt au i ()t2to(o iu1lltemics (  Dtrxmpno4opxomo3tldfs2ea(vo;t)altomf iytlm raneo (0 etmirpny1ame liei sfaDta(  ot0altn iciydfs2umn p;t) lenif oodfatr uei;s0texr(m3oudamt mnvt tfaDraumonu1opx iociadfmDean p;t4trxnxocoy1lpD auei;s seto(o3iu1al emiviltfa2umxm nu4olxnmociytls rl(vo t0 ltoxocoo1fp   uvs ()t2ur(m3nu4ame liesas)arua(  ;t1tlen f3tadlaDemnvpnt)teerxr oo1laDe ivi s  etr(rpiodlptnliviat a2tru o;o0tet mfciys sDem(mp;u4areoif oo1fmtelneil(0srxrxmpoudamtn ieslt  Dtmxrp;t0alx mf3iltfa2rmnvp u)artrxf tytlp  lnes;(0t2xoxopny4op elici (fsDum(root4alx  feilsfs2rluvo;t4aetrmr3oo1lmteaies;t trtoim3io1ope lfviat)a2uau  ;u0aexn f3ildfs elnmpn(4 rxomr3iatoaDelueol()setm(m3nodlptemies (fs2uaxmooo4oetoio3iadlm rmu o;(0aeenio3tytla e i s s) exoio nodlmenmncsl( aDtrxmo;o4oltnii3ild a raump;t)teenif3oodlmtraivols0 eurim iydopenmneias) rrm(  ;o1tptnif3iydlmDel(vo;t)trtnxo3tatlaDr ies t)s2uoxopoodomt lnvtlt)srtaum nu4olx ifctytla umuvo t)teerxfciatfat  ieo;s) euoimpny1lltelietat) Dra(m ot0tex  iciat m rmu on(0trenio tadlmDeln i;t)tetmxrpnu1om e nvsl( artr(m ;u4tlenmiciltls emuvs u0 lerirctadomte nei;t0t2urxo3ou4am e fct tf 2urx  nt4tptnmfctydla emnmon(0teeoxo oy1fa   uvil( seuoio ou1lmtemnei s)a2tr(mpnu0aet ifcias m emuvo;()tetrxr3iotlaD an s t0 exmir no1lleelict sfsDtau  no4altomoeiadfa ulu snt)aleomo3todomtr uvi;t t2trio iy4ome mieia(f 2tmxr ;u1tlx iictadfsDeanvp;(0trermfcoo1opDelnvi;( s2um(m3io4lmtn fviltfsDtmxmpnu4tltnmf3iydfmDrmuvo;()tltrxociadfptrln s s0 eur(o iydll  lfvt (farua(m oo4oltnmo3iadfs2rl(mo u0alxoio tatlpDeaieo t)srtrxr iudom nlnes (farurum no1teenmi3ilslm uln pnu4trxomfciatoptrauvolt)seurimpoodal n ncslt srtru onu4alx mietldfs2eanvpnu4trenmr oadlaDeli i;t)srumxopiodomee nei ()arrrx  ;o4oexn f3iydlm2ulnmo u)trxoir3ia1lmDeaivolt)s2xmxopnu1om n ncslt sDtr(  ;t4apeoio3ias s umu pnu4alxnio tytfa   nvilt) eumxm oudlleemivsas s2rr(  no4opx  fctad s2umu s (4aexrmo oytlm rlneo s0texmim ou4llenlivsas)arrmurpot4oetomietad a2rln pnt0aetnif3tydlp eaivi;t trtm(m3iu4al  mnct t)aDraxronu1tpe  feiatfs um(mpn()tltnmf iotlm e nvils0 2um(m no1ol elfctls)artm( pou0oeenmfciyd a2ulu s t)aexrmfcia1lmteluei t s2urxmpoy4oltn nctls sDra(m ou0tpe iieias mDeaumon(0 ltnxr iy1lpDran s;s)s2xr(mpoo1op nmneil(  rta( ono4tle mo3iysfa rlumsnu) rxrmocoodlat  i s t texrxo ny1openmnctlt)srtm( poo0oexnmfeilslsDea( on() rtoxo oatfpt anvi;t texo(m3nodlm  lnvtat a2rmu pno0ale  f3tldls2ulu on(4aetomf iatla rau o t) eum(m nu4opeemict s srtaxmooo0altnmi3tys a ranmo;u4altrircoy1fpDe ieols0s2xrir iy4ll e ictltfaDrm(rpot0tlxomoctys m2rm( o;(0altnmo io1fmtr neo ()s2ur(rpoy4oltnmieias)s2rrur oo1aet iociydlm emu s;t) rermfciatfpt lu s s srxoxr3iy1optnmnei (f rrm(moot0tetnmf3iltfa2uau o;t0artrmo3oy1lm  livo (0s2xo(o3oo4oleemfviatf 2taxmooo0oeenioeiatfa2rl(mpnt)altnxf oydlaDraieils t2um(m io1amenlneta()s2tax o;o4alto octys mDeaums (4trtnio oo1lm eaieil()trxoxopoydomee nvs s) 2ua( pou1aeeniictyd aDumuvsn(0trtnmf3oytfpD  i o s)seum(rpiu1omte fvs t) Durumoot1aptn ociadfa ranmp u)tleomr oadlmD aneo (0trxrir3oodopee fesa()srrmxr ;t4aleomicild mDeau p;t4 reoio iy1oa r u i;( setr(r3oodamtnmnct (  Duau onu0oexo i3iatfa2ra(mo;u)alxoir3ia1fmDrlneslt0 rxmimpoy4optnlivta(fsDumur ou1oltn fctys sDra( p;() lxomr3oydomDrlueil(0 exrxm iydll elfetls)sruaurpno1tpe mf3iadfaDuauvo;t)trxomf3oydlp rlnei;s) rto(r3nu1amenmnvsas arur(moot1olx iictys s2rl(vo;u0 rtomr3oo1laDrli i s) rurir3nydaptnmfes ()s2urumo;u0oeeomo3tysfa emnmo t4 lxnmrctodfa raivo t) exmio iydalte fvsat)sruaurpnu1apxn oeiydfm raump t4aeerif todfp r uvs t  etrim iu4ap nmncilsfaDumxrpot1teeoioeiysfm eau p;(4 etoir iotop   ieo;s  eumim no4lm nlnei sf Draum nu4ale  icildls em(mp;u0tetrxo3oo1faD  ues s) eto(r iudal n fvil() Durumont1oex io3iadlm2rl( s ()teenxr3iotlate nvs;t  2urxmpiudam nmfvt () Drm( pot0alxn ociysfs em(ms t0tltomf oa1op rlnvo t  rtrim io4oltn ivtl()sDuaxmono0oex ioctadfa2ra(vs t) lxoxoctytopteauvs;s tetoxopno1optn ivslsf 2trumont1olx mietltla2ean pn(4trtnxocoadopD an ols  rxr(mpoo1ape mieslsfaDumxmpnu0olxn icild m2ra(vpn()artrmf iotoa  anvsl() rtr(opny1am nmnvsa( s2ua(mpou1olx io3iltlm eaump (0texoifciotfp r ivs;s) 2uo(o no4alee net t  rtmxmont1opx  ociyslmDuauvsn(0tltoif3iadlmteanesls0trxmxr3nodam  livtl( sDurxmp;u0aex io3ilsls2rmumont) exnmf3iy1fmDr ueol() rtr(o3oy4ope mivs t)a2tmxm ;t4tpto oetydlm2eau s;u4aeerxociytlateai o;s)setoxopoy4llenlfetat)sDua( o;o4texnifciltla2elu p t0aetrio oo1omD  ivo;s) rtmio iu1opee ictl( s2rau oou0alx iiciydlm2rm(ms;t0alenxo3to1fm  lnvol( trurxopoy1apenlieia() rua( ono4aptoii3tydlmDuan p u)treoirciydoptrluvsl( srumxr3iy4omt mnctas) Durx o;t1oexn o3iadls2emuvs;u4teerif todfptr ivo s setrxmpiudol n iet sf rrmumpno1tptomoeiadfa2uaumont4 ltnmo3oodfatrluvo ( trxm(opiydlmenmfcils) rumumpnt4oexomicils a uanvsnu) renxo iydfm rlivilt  rxrir3nu1lptnlfei t aDurxrpou0tet mietlsla eau s ()altnio3iodlmDrai ilt0trum(o iy1optelivs t  rtaumont1tltoiictltfsDemnvo;(0 ltnxrcootop   ivol()seuriopoo4oltnlieiasfaDurx  nt4tlxomo3ild s2ulu o;()alenio ia1oate nvs t s2tm(r3iodale mnvsa(fa2um(rpno1tpt  icias mDra( pnu0trxrmfcoadlp rliei;t0 2xr(r nydaleemnvsltfsDurx pnu4tlxniicilsfm2ulu p;t)alxrmrciadlaD liei;s) exr(opiodomenmncs t  2urxr ou0tee ifeiatlmDem( sn(0 eeoxr iadlptrli ilt0seur(r3io4oltelfei (f Dra(rooo1ape ifeils mDeau pnu0tleoxr3ty1latr n i t0texm(r io4lm e nviltfartru o;u4tlx moeiytfs ranmo ()aetrmo3todopteai sl(0sruo(m iu1omenlivs tfsrua( oot1apxn fciaslm2ua(vp u)aeerio3oatlat  n slt0t2xmxmpnodalenmnvtls)a2taxrpnt1aeeo oeiyd mDean p;t) renio ta1laD ln o (0 2toxr nodom  mfvilt a2rmxront0aetoif3tltfsDem(vo ()tlenir oo1laDrli olt0t2tmxr nu1om nmncsl() 2ua(rpou1aptnii3iydlm2rmnmp (4aexnmf3iydfate i slt  etrxm3ny4llenmiei tf 2uru  no1tpto ietldla ulnvp u4artrxf3oadfmD aivo (  exoirpnu4omtelnetat srraum ;o4tpt  i3tlsfs2rmn p;u) rtoxr3oo1lm eaieslt  2xoxr3iy4lm nlivsls  Dtmu  ;o0aexo f3tys aDea( s;u4altoxf totfpteliei;(0 2tmxo oodop  mivias)srurur oo1oee ii3iatfa2umuvpnt0teerirctatlptrluesl(0 ruoxm nu1ap nmfvia( arrr( p;t4texo ictydla rlnvo t0 etniociytfmD lu il( seur(r io1ll  lfcs t) 2rmxr ;u4apen oeiatla2rluvonu)trxoif3totfm e n ol(0t2uoir3iy4om e fcsas)srrau oou1aex  ietat sDrl(ms;u4 etrir3iy1fmtr ues s t2urxr3iydapenmnct t  rrmxm ot4oeeo ociltla ra(vs (0 ltomf3ia1opt  uvo () 2tr(o no4ol nmfcils artr(root0tpx mietls s2elump;u4altnmo ta1fm rli s;t0 rxoirpoydame lnet t)sDrr(mpou1aeen fctlt aDranmsn(0tltrmo3oa1om ean i s0 2tm(o iydalt  iet s) Dra( pno1texn o3ilt s2em(ms;u4tetrxf3tadlm eluvolt)trumir iu1llenlivs t) 2tr(rpot0tpxoifeiydfa rlu p t4trtnifcoytlp eaiesls0 eum(r3iy1altnmfetas)aDum(ro;u4oltniieiadlm2ulnvo () etoxocoatlpDeaiesl( s2toio io4ol elnet s)s2taxrpot0aptn ietytla ulnmsnt4texoxr to1omtranes;t  rxoxo oudomtelicsatfaDumx ont4alxo oeiat s2ra(mo;() ltoio3tytfm raieolt0s2ur(o3oudlptnmivi tfsrrrx o;o1aet  ietytlsDelnmp t4trtrmfcoo1lpt ai o;() exoiopiy4op  lnesas)aDtmxmoot1apeoif3tat mDua(vs;u)trerxr oatfp e ivolt setmxm3ny4lmt  ivs tfsDtau p;u1oexn feiat a rluvo;()aexriocio1omDr i i;t0s2xmio iu1ame  ncsl( aDtaumpoo4tlx  ietys mDua( pnu0 lxrir ta1op ean s t trurir ny1omenmneilt aDtm(mp;t4texomoetls s rlums;u0aetnmocto1op elivilt0srumimpoydlm  mietlt)a2urxmono1ole micilslm rau sn(4 rxoxfcoytom  lueo t  2uoir3oy4am elneiasfs2rrx o;t0tptn ieiltls2rl(mon(0 rtnxf3oadlm eli o;t)srto(o3nudamenlicsl(fsDrauro;o1aet mietysfmDrauvonu4 lxoir iytfmtelu o;(0s2tr(m3nodlpe lfvil()s2ururp;u0optn ocilsfaDrm( ont0 eeoio ty1op  lies ()s2xoxr ou4ol   ncsls sDtaurpno1teeomfetad s ulumo;t)tlenxfcoydop rli s;s srum(m nu1lme mfei s)sDta(rpot1oeto feiasfm2umnmon(4aetoio ia1fa rln s s)t2umio ou1lle mfvta( a2ua(m nu4ope  iciyd s rlnvs ()artrmr3to1op eli il( t2umir3iydlltelnet (fsDtmur oo4alxo f3iltfaDeauvp;(0aetomfcia1omt lnes ( texoxm nu1omen ietls sDra(rp;u0tee if3tad aDeaumsn() reoif3tydlptrlneil(  rxmim3no1ll  mfvsls) 2raurooo1tlxomoetyt a2em(monu0 renmr oadfmD aies;t teur(rpiudlm emiviat)aDtr(ro;u1tee  fciytfa2el( pnt0 rtrir3oydopt  nvo;t)t2uoiopnu4lp nmivilt)s2uaxmo;o0aetoif3iytlm2rl(vp t4tltomf ty1lp elnvi s  rxo(rpou4opte ivias)aDuaum ;t4olenif3iydfm2ul( sn(4aetnmo iodoa   u s s trum(m ou1altnlnes () Drm(mp;o4tpeo fcildlm2umn s;u0texrmf tadlmD  neil(0 rtr(o nudllen icil() rra(  ;o4opxo f3tytfmDumn p t) exrio3oytfmD ln o t) rtm(r3ou1apt  ivtat artmu  ;u1oltoifeiys m2emuvpnu) rxoioctotlm e iei t)srtm(o oudolt  icslt)srraum nt0alto octlt mDul(vp;t4trxnxf3to1laDeauvo;t0 euoxrpoodlme mncsasfarrm(mpoo1texn ociyd m2uan s t) leoxo3tydfp rai s;s truoir3ou4lpenlnviasfs2uax ont4tetnmf3ildlsDrmn pn()aexoif tatfaDrauvi t0s2uo(m iudlp e ivt tfarraurpno1oet moeiatlmDea( snt0 ltnmfciytomDrauvslt trxriopiy1lltn neils)artrxm nu1opeoif3tadfsDumnms u4 etrmrctydfpteai i ( texoimpoudopeemfcta(f rum(mpnt1tptomfetasfsDrmn o;t)artrxo oytfpt auvsl( texoxm oudop nmfeia(fsDtrx  nt0tet ii3ild m rluvo;u)trxnir io1laD  uesls0s2uriopoy1opte fvs t)s2tru  nu0oleo ocilslm ua(vp;u4arxrmoctatfmte u o t0teuoxm io1llt miesatfaDtaxronu4olx mo3iys sDuauvo;(0trtrirctydlptrauvi (0sexmio ny1lp elneslsfsDuaumono4olenii3tyt a rluvo;u)tleoxo3iodla eaivs;t)t2trio3nydol n nvt tfs2ra( p;t0oexn f3ildfs2el(vp u)teerxfcoa1omt lieolt s2um(opnu1ope mies s  rta(mo;o4alxoiietys a2eau on(0alxrir ty1oatrai s ()setm(o oy4om  mnctlt sDur(  ;u0oetoif3tls sDra(mo;u4 rxnmr3oa1om   ueil(  ruoio iydom e neia()srrmurp;o4ape mfciaslsDeaump (4 eeoircio1lmtr ieo;t)teum(r3nu4lmenlfeil(fsrrrxro;t4teen o3iatfaDumuvpnu4tltnircoydomDr ivo s0 rxmir3oudamt  ivtlt  2um(mpno0altoiietytfa uluvs;(0 ltnir3oa1faDeaues ( trtrxrpno1lpe  feils srrau o;o4opxo oetadfm rl(ms u)artnirciodfpDrlneo () exmxr no4lmt lnesl()arrau  nu1tpeo oeilt sDem(vsnt) ltnir3oodfatrlivsl(  rxo(opno1om  mivta(fsDtaxmpoo4teto octldlmDuanmon(0 eerxocio1fpDean o;t)s2uoxrpny4lptnmici s)a2urx o;o0oeto feilt a emnvs (0altrxr3iadlp eaueols0 2um(mpoodomtnmnci tfaruaxrp;u1tlxo f3tadla2em(mp (4 rerxocoy1omDelneo;( t2umir io4ol emnetasfsDua(m ;u1optnmoctldfs2eln p t4treoifctatomt  nes s trxr(m3iudll   fcia(fsDra(rp;o1aee ifeildfs umu pn()artrxf3oodlpDelivs (0 euo(o3oy4apt mfesl()arrrurpnu0aexnmfciadfaDemnvo (4trtnxrcio1laDeluvil(0s2xoio3oudlmee fei tfs2ua(rpoo0oexomieiydlsDul( ont4tlerir iydfa r ieil(0 2xo(o iydaptnmnvtas a2tmxm ;o0texnmictldlm2eauvs u0aexrio iytopt  i slt)s2xoirpou1apenlies tf rtaxrp;u0opt  oeildlmDumumo ()aetoxr3oa1fmt an o;s0teum(m3iydapt lnes s)sDrau ono1oexo i3iyd a em(vp;u4 leriociodlmt livo t0srxmio nudapenmfei ()srurxrono4oex ifciad s ul(vs u4tetnio3iadom  luvs;t) eto(opoodaptn fvi s)aDurx pnt0alt ifeils m2ulnmo (4tetnxfcootlmDe n o s0 2umxo3no1omtn ncsat) rtr(  ot1aex ifciyt a2eaums (4 eeniocoadomtrlneo;t0 rtmio iu4amtemfvtl(f rtm(mp;o1opxomiciatlm rmn s;t0arxomo3to1oaDeaneo;() 2uoim3oy1olen neilt)s2urxmo;o1aeen ieias s2rmuvs;u0tetrioctatlpDeanvol( texoimpou4lptnlfvt sfsrtr( p;u1oexoii3iyt s2umnmo;(0arxrmfctydlaDeli ols0t2tm(opnudlm  lfci (f 2tmu pnt0olx  feiydlm rl( snt0aexrxfciatoaDeanei t)s2urxrpny4lm elfciasf 2rr(rono0aleoifeildla2eluvo (4 rtoirctytlaDr uvilt0sexmxo ny1llte fviat artr(rooo4tlenmf3ias a2uau o;t0arenmrcootlaDe n ilt) 2uoxr3nydlpt lfeslt a2umxmo;u0apxo o3tasfs2rlump t4trtnmf3iadlaDranei;t0t2xmir3nudam nmiet (  2trx  ;t1tpxo i3iltla um( o;t0aetrio3oa1la  aneo;t) 2xo(mpou1lpt mfctatfs2trxmpou4apeomi3iydfaDrmu s t) ltomr3oydomt auvi;s) 2trxo3iodolt mivilsfaDrr(m ;o4olxoioeildla2umnvo (0tlenir iadfm   ivi t  etr(opou1ap e nct t) Dtaum ;o1oltnmoeiltlsDrmnvo;u0trxrmo oo1fpDrln o;(0sruo(opoodopen icilt)sDraump;o4olen feiasls um( pnt0texoir tytopDrlnvo () eurim3oy1ome lfes (fs2trxr no1texnmfetysfs2uan ont0 lxnxf iydlpt anes;( s2xmir3io1lm n fcils)arraxr ;u1teenmoetyd a2ua( onu) rtrmocoa1oatran o t0 exm(o iydol n fvias)arrrx  ou1aexniieiysfaDea( snu4tltomf ootop rau o;t0srxoio3no1optnmivtlt)s2ua(m ;o4optomoeiasfsDrlumpnt) lxnmf todoptrlu o;t sexmxopnu4lle mfes t) rtax  nt4optomi3tldls rmuvpnt4aeermr oodlpt lu olt0setrxm ou4om  lneiatfaDrm(  ;u1opt mf3tadfa ua(vo t4texnxfcio1fpDr nes;()seurir3iu1llee iviat)srrax poo4alxnioctlsfa2rm(vp (0texnxo3iatoaDeau o t tetmio nu1lpe miei () rrm(ro;t0aeeomo3tls sDul(vs u) ltrmr totfa elivol()s2umio3iy4al n iciltfs2umxm ;u4apxo oeiadfs rlnvont0aexrxoctytop rlneol(0 eurxr no1optn fet sfs2ur( p;o4apx iocias a uanmo;t4 renxr oadfpteau olt0 rxr(o3oy1am   iesl( s2urum oo4tlt  feiltlm emnvo;t4altoio3ia1lp r u o;t)t2uoirpiudoltnlivtasfs2rrxmp;o0tpx mf3tadfaDrluvon()tleomf oodoate uvi;()srumir ou4llte nvsls)sDrmu pot1ole iiciltfsDea(mo;u0teeoxf3tytlp r ivs s0srxrim3iudolte nes () 2rrurp;u0alxomfeias a ulnms ()treniocoytop  li o;t)trxoxrpou4alt lnvt ( srrmx o;u1tptniociydls emn sn(4tetrio tytfm raneslt0s2tmim3ou1lmee ncslsf 2rmx  nu1opx moetad a emu p (4artrmf oa1lmDe n sls srtmxo3io4al nlnctl() rua(mp;t1apxomf3tytfs2ranms (4tleoxoctytoa eln s;t0 2um(o no1omtn icsas)aDuaxmpot1opt ioetld s2ulumo (4 rtnxf3iatfpDrluvols t2to(r oy4ol nmnct t) rurxrpnu1tle ifciytfm2ran s u4artoif3io1lmD lies;()sexmimpoy1altnlicilt) rumxmpot4oeto octyd m2ea( o;(0 ltoxf to1fp  lieo s) eumir3iydop elnvtls)s2tmxr no0tlenmfciydla2ra(mpn(4 ltnmf3ootfp eli s s) 2ur(mpoy1ameelivs s)artax  ;t0tptoii3tatfm el( p;(0 lxnmf3oytlm   n i s  etr(opou1olee ict s arurxr oo1oeen fctydlsDumnvo t0 lerioctodlmDr nvo t) rtoim io1apt livilt)aDurump;t1apxniiciat s umumsnu0texrifciy1fa raueols0 rto(r iu4lltn fctasfaDtaxmo;u4oeeoiictld m rlump;t4arenmoctydfpt  uesls) rtrir no4lmt lfvtatf rrr(ro;u1oeenio3tlt aDulu ont4tetoif3tytlmD luvo ( tetm(r3iu4lpte ncsl( aDtau pnt4olxo iciasfa2elumo;(4treomf iodomt  ivs;() eumir iy1omen fvi t artr(r ou1ope mf3iydlm umu s u0tleoif3oa1lm raiei s0s2xm(r no1lp elnetl(fsrra(m nu1aleoioetytfaDelnmsnu)tlxnif to1op eaieslt0tetrxr3no4lpeelnvslt sDrax pot4aexnmoeiltlm2rmu o;()trxnxo3tadom  auvilt setmxm3ny1amtn iesat) Dra( o;u4oet  ociysla2ulu pn() rxnmr io1lptrai i t trxoxmpno4am elivsltfsruaxmooo1tex  iciat m2rmumpn(4 exrmr3tytfpD ln s;t  exo(opnydop  lnesas)a2ur(mont4alt io3iad sDrmnvp (0aleoxo3iodfa r u sls) 2um(r3ou1oltnlncsa() Dtmu ooo1apxnii3iadls2elnvsn(4trtrifctatoat  u ils tetr(m3iu1ap n fct t)artrxm nt1open oeild s2um(vonu)aeeomr3oodfa eaivs;s0 2xr(rpno4lle mies (f Dtmum ou0tpxoio3ias m2ea(vp (0 lerio tadoat lieo ( t2tmxm3oydomt lnvtat a2raum ot4tex if3tasfaDulums u4arxoir totfmtranvi s)tetrir nodop e fvsa()a2taxmpnu0aex mi3ild a uluvsnt0texnif oo1fpDeli sl() rurxopnodolenlfesa()sDta(r oo0oexomfeilt m rlu pnt4 lxrmrciydfpDr neols0truoirpnu4omeelicsl(fa2rmxrp;u1tpxomiciat mDranvs;t4tlxomo oodlp e n o (0 2uoxm ou4olt mnetl( sDrmump;u0aexoiieilt a2emuvp t4aeerif tatlatrlu i (  rxrir3io1apen ictlt)aDrrx pnu0tetn f3iasls eanmsn(4 rerxociotfpDe uvi;(0s2uo(rpiodlptemfctls srraumo;o0teen icias s2rlnmo u0 lerxr3oy1oa elieols)teum(o3nudllte fvsl( a2ur(r ;o1apx mictldfaDeanmp;u) ltoir3oadoa  anvs ()s2tmir3no1am   nvs sfsrrr(rono1oeenmo3tysls2ul( sn(4 rerio oytfm r neol( srurxm3oydllt  ieiat)sDraxmp;t4aexoiieilslmDulnms;u4trxrmr3oy1fm eln olt)setr(o3ny4ome mnciat) 2um(mono4alt  feiat a2rmuvo u0altrmr oadfmt aivslt0t2urim3oydll elncslt) 2urxm ;t1texoifetaslaDrm(vonu0trtnmr3tytfpD  u i t)trurxm ou4ll e ivtat  rtrumpno1teenmietytfaDelnmpnu)artnxo tytfa eln o;t t2umxo3oo4lptn netatfarum(rooo0ape miciltlm2eaumo u4arerioctotoaDr ivs;()truoim3iu4lle lictltfs2rrum ;o1alxo ieiydlm um(vp u4 rtnxr3tadopDr i o t) rtoio oy4opeemfvi sfsDta( oot4ape  ietatfa2um(vs;t)aexnioctatfptrlneils0 etmirpoydlmt  ivt t srtr(  nu1tpxnmo3iasls2um(vo u0 rtrir tatfp  lieilt)t2xoimpiy1lptelnvils a2trurpnt0tlxnifciasfm rlump (4tlenxr3oatlaDeln i;s trxo(o3oudlle lfvtl() 2rax poo0opeomociadfsDeaumo u)alxrxrctatlateanei ()t2uoirpnydlp nmfcsltfa2rr(  ot4ope  o3tadls2ulnms;u0texrxrciodlaD luvilt) ruoxo3ny4lptn ies () 2raxmp;u4olx ii3iyd m rl(vp;t4arxnmrciytfaD  uvs;s tetrxm3iu1omenmfetas artmu pnu4opx  i3iadlmDraump (0tlenxoctodfmD  nes;s  2xmxmpiu1al  lici t aDtrxm no1tptnioeiytla em(mon(0arxnxrctodfatelu i (0t2uoir no1lm  mictas)s2rm(rpnu1aexnmfciadlm2rl(vonu) eenmf totfat lu s t sruo(r3no4lmenmivt ()arum(moot4opxn f3ildfm2ua( p;(4artoio io1op  liei;()srtoim iy4omtn fesa()s2rauront0aptn fetydfa2eln o;t0aleomo oatfmt au s;t)s2xr(o3iu4om e ivt t)s2ua(m oo4aeeo f3tytfaDumuvp;t4 lxoio3tatlm   neils trto(opiy1ome mivta( srta( o;t0teeo fcilsls2ua(vp u0 eenxociodfateli ols0 exmio nudamtnmiei (  rtrurpou1opeomiciyslsDraumsnt0arxnxocty1fmtrlneo;(0 2toimpiu1op e ieils arumum nu1ape ii3tysfmDrluvsnu0aeerxf3iy1lp rluvo s trumir3ou1ome mfvsl()aDurumo;u0teen i3iysls umnmp t0texrif3iytfa r uvs;( s2uoxr3ny1oleelivil(  rua(  nt4opeo fetyt mDuau ont4 exnmf oydoptelneo;()srtoxo3oo4amee fctl()s2trump;o0aexn iciyd m2el(vsnu4tlxoxfcty1oateaneils0t2to(m nudom elfesa()sDtau  ;o4alxnmfcilsfm uaumpnt)artoxo oo1fat aiesls0s2ur(opiu1amenmict tf Dua(mpou0aee mfciatfmDra(vo;(0 exrmr3ta1la   n i s  eto(m3oudop n fesas  2raum oo0olx ioctyslm2elu s t)texnmr3io1lmDeaueo;t0t2tm(o oodol nmiet t a2tax p;o1altoif3tas aDrluvpn(0aexnxo3ta1faDr uvi t)sruriopou4open fei sf rtaurooo0tpx moetys s ea(mp u4aeeomf iotfmt auvs;() etmxopoodlpeemfes s srtmxrp;u1alto icildla em(vo;u4tltrif3to1fpt  ues;t)srum(m ou4ameemietls)srrrx p;o0tpeo i3iasls ra( p;t0 rxoifctodfateanvs;t0texoim3oo1lmeemfeiasfaDur( ont0oet miciad mDemuvo t4 exrmoctytoaDeli i;s0 2xrir3nu1lm  lncslt  Durump;o1tlxo ocilt m2elnvsnu0tlerirciodoptr ivi s0 eurxm oodoptnlfeiatfs2rr(mpoo0opxnio3ild aDean o (0tetnmf3iy1lpDe ueols0seurimpny1am  mivia() Drmurp;t0opto o3iaslaDrm( p;u0teenmocoytfa rluvo;s0 2tr(m3no1alen nvsatf 2rrxrpot0ope mf3tytfm2rmuvpnu4arenio3tydfa ran o ( trtm(r3nudop  miet t)srum(mp;o1tpt ifeiydfsDum( snt) rtnio3oo1fptelneolt0 2xo(m3iu4om n ivt s)sDtrxr ou0oltnmoeiytlaDrmuvp;()trtnif tydoptelieo;t0trxrir ou4op e ict t)srumx pno4altnmfeildfa rl( pnt0trenxr iotoaDranvs;t) rxrirpio4amtn iesat  2rax p;o4apxo o3ias a eau snt0tleomr3totlaDeanvil(0t2uo(o3iy4ol e nct s s2ua( oot4tpeoiieiytlsDrau snu4teenxf3tytlmDr ueo s)tetrim3io4lmt lfctl( aDrr( p;u1olxomicilsfsDem( pnu)tetrxr3iatfpDeanvo t trxoxm3iydll e feiat s2ta(r ;t0aptoioeiltls ea(vp;(0tetnir io1faDeauvs;s srurxr oy4ole mfes s) 2ra(ronu1tptnmo3tlslm2eau pnt0tlerxo oa1fp raivi (0srur(o3oy1apt mnct s arrrump;o0aleniieiys sDel( s;()teenir3ty1fate ueo;()s2xm(rpno4om n ieias sDta(mono1alx iicias sDul(ms;t)alermf oydfa  luvol(  2uoiopio1olenlnvtat)s2umxmono4tee mieils a2el(ms;u)aetrir3ty1omtelnvs;t0srxr(opny4optnlnvtat) rumxro;u0oex micildlmDul(ms;u)tlxnmfciadfa e n s t)teuo(m3iudaltnlfcs ( srrr(  nt4oltnif3ilsfm rmumpnu)tetoir3tatfatranvs s s2xoio iodamee fctat  2tau  nu0olx moeiadla elnms;u4trtrmo3tytom   iesls seuo(m ou4oltnmivs ( a2tmx onu0apt mf3iadlaDeaump u)trtrmo iytopte iei;( s2xr(rpoodoltn nvtat s2umur ot0tptn oetyd s2eluvsn(0 ltrmfcoy1fateln s t sexo(m3oo4lpenlfct s)sDtrx onu1optnmfctyd sDul(vs;t4 leomr iotoa  aieilt teuoxr io1lmtnlfeiltfs2rr(rono0teto fctatlsDua(vont)trtrir3oadlptrauei s texrim3iu1lp emnvslsfsrra(r ou1tpe  ociyt mDel(von(0altrxociotlm  luvils0 rto(m oo4lpt mfvtat)aDtmxmpnu1apt mieilt a2ra(vp;u)trerxr iodoaDranvo ( tetr(rpiudame  ivsls)arur(  ot0tle mo3iys a emnvpn()texnmr totlp elieolt0s2tm(o3oodlpeelfeiltfaDur( onu1apen fetatfa rl( p;t0trenif3io1lptr iei (0seuoxr3nudoleelnvtat s2urumo;t0tpt mfctlt s rmn s (4tltoif3ootlm e uvi t)setr(m3oy4ome  ictlt)sDurxrpnt0oltnio3tlslmDumnvp u0tlermf3tydomteliesl(0 etm(o3nudlltnlnvt s) rrmu  ot1teeomieildfs2emuvp;u) ltrxr3tydom rlieo;s  2umir3oudomt  nvsa(fsrta(r nt1teeomicildla elnms u)texoxrciotfateluvslt0setoxo3no1op  mnct tfsrtmu  nt4alxnif3ilsla2rauvo;u0aetoxrciotfatrlnvs ()s2xrir no1lmtemfctl(f Drrurp;o4apxniieiat m umump u) exnxo tatoat lu ilt seumxrpno4am e fvsas  2uax  oo4apxo ieiatfs rl(vs;t)aexoxfcoy1oa  au sls) rxo(rpnu1optnmfeil( aDum(rpnu4oeeoifetls aDul(vp t)aetnxr ootfmtelueslt0s2xoiopiydope mnes t) 2raxr ;o0apto ictatlm raums;(0 rtnxo3oy1la eaivi;t0trurim oy1ap emieta( arrm(m ;o0alxomiciltfa eauvo;u0 rxnxo3tatoptr u o t0t2trimpiy1op e fvs () 2rrxrpnt1teeo f3ilt a ea(ms (0aetoif tadlmDrauvsls)s2trxopou1al elfct (  Drmxr ou4tlxomfeiadlm2eaumo (0tltnxo iy1opte iei;s srxr(r iy4opt mnvt tfaDumurpnu4apx ifciatfs2uanvp u)teerxr3ta1fp ean i s)trxoxrpoydop e fvsatfaDtm(rpot4tpe  ieildfa2ulnvon()arenir3oatlaDrli s;t0tetrxo nu4oltelnet sf 2rmxm ;t4oetomi3iys m2ean p t)texoxr oatlpteanvsl(0 rxrxm3oudll nmneilt  2taxro;u0ape  i3tlsfs2ul(mont)tetnio3ootlaD aneols0 2xoxm3iodlpt lfctltfs2tmump;t0apxoiieiat mDuau s;t4artoif tydfpteluei ()sruoxm nudal elnet ( srtaumpou4aee  i3iys a ea(vo;u)trermf ta1lp elu sls) rxm(o oo4llt mfvi (fa2rrumoot1oet  f3iltfs ran o u0 etnir3iotlmt lu o;s0t2toir nudlm nlnes s sDrr(mont4aetoii3iytfa elnvs u0 ltomr iy1lm   ueil()trxmio iu4am e ncsat)a2rr( poo4openmociyd sDeaumsn() lxoxr oytlpt lneo;s)sexmimpiu4ale mivta()sDtr(mono4tpenmo3iat s2ranms t)arxoio oatfptelu i s0s2xmimpiu4alen nvsls) 2ta(rp;u1opxn f3ils sDum( ont4arxoxo ootlp rlieo t0 etrxm3iy1olenmivil( s2umxmp;t4oltnioeiyt aDuluvonu4 eenxoctodfatrau ols)s2ur(r3oo1amtelfcsltf 2raumpno0aex iociatla rlnmon()tltoxf3iadlaDeluvsl(0 rur(o oy4lmee fet t) Drrur ;o0tetnmfeilt s umu s;u) reniocia1op  lnvolt)trurirpou1alen neslsfa2tm(r ;o0aet ifeiytlsDelnmpnt4 ltrir io1optelieol()s2ur(m iudap  mfvsa(fsDtru ooo1aeenmfeiaslaDra(vsnt)aetoxo3ta1laD livols) 2uo(mpno1omt mfcia(  2uru ont0tee mfciat aDumn pnt0 etnio3ootoptelivs;t) 2xrim no4oltelnct sfsrumx poo4aex mfciat
\ No newline at end of file
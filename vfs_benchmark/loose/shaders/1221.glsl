@@ -0,0 +1 @@
+u sl(  rtrxopiy4lp   netas s2ur(r ou4oleoiiciytla umnmp;t0alerio oadoptraueolt  rxrim3iu4lle lneiat) 2uaumoou1ale ifciysla rm(ms;u4trxrxocia1la eauvo s)teur(m3oy4ol nlivtas)aDtmu pou0oleomi3iat m ulnvs u0aexomr tatom rluvi t)teur(mpoudlpeelncia(fa2tm(mpno1tpx mietytlmDrlumo t0tleoif iadlpDrlivsl(  2xm(m3io4oltnmfet (faDumu o;t1aee  iciatfs2uau ont) ltrmf ta1la r ueil(0seuo(r iudomenlieias) 2ra(r ot4oeenmietlt mDeau p;u)tltrir iatomDe ivslt0srumirpou1op nlfesltfaDumu pou1alt io3iasfaDelumo t)trenmrcoy1latelieilt t2umxm iy1om elfvta(fsrum(rp;u0optnioeiydls2rau s;t0tltoio ty1lmDran s;s0seum(r3nudopeeliesatfa2rr(  ;u1opt  fetld m ranmp (0aleomr totoa r ieils srurxo3nudlpt licilt  Dua(mont0oex mfeilt a2ulumo;t0artomo3iadoat au i;s srtoim3iu1lmee nctas  2tm(rono1aexnmo3iltlm elu snu4arxnmoctatoat aieilt0 etoxm3iudale  fvtas)aDuau o;u0tlxnioctat a ulums;(0aexoxo3todlpDrau slt t2uo(rpoo1olenlnetl(fa2trxrooo0oexniiciatls rl( on(0tltnxocia1latrauvs;(  etmim3nudlle mfvsas)s2trur ou0aet moctyt a2rm( ont) leomf3ia1om  lueo t teumxm3iydomeelnvt tf Draxm nu0oetoifeilslm umn s t) lenmf3todfateauesl(  exmir io1ll emnviat sDrmu pnu0altnii3iasla ua(vo (0tltnmo3iytla eln o ( trxo(r3ny4am   ivs sf rtm(rpno0alxomociyd a uan pnt4artnmfcta1lm rau i t0 2umxo3iudalee neta( aDrmxrp;o4tee mfcilsfa rmnms;u0alxoxf tydom eanvi;s)teuo(opoo4lp nlfvt s arrmx ono1tltoiociys m2rm(vo () rtnifctodfa raivi s s2umxr3no1omte fesat)aDurxrpnu1openioeiadfm em( pnu)arxrmoctatoatraieo s  eumxrpoo4openlivtat)aDta(moot0alenioeiadfs2emn s;(0 renxr iodfmDrauvs;t0trxmir3nu4om n fesa()srraxmpnt4tpxoii3tldla rm(mon(4alxnxr3oatop rai o;s trxr(m iudll n ivt s) Drrxmpno1olt iictas a ul(vo u)tlxoxr3ty1omtr uvol(0sexoxmpio1lpeeliet () 2uaxr ;o4tptn oeias a ulnmpnu4aetnir3io1oa  luvo;t s2to(r ou1lme  feil( aDrrxmont0altnio3tldlm rm(mo;u) ltrirctotfate u s;t)srxoiopoo1lle mieilt) Draumpno4tpeomfcilslsDean o;u)alxnio3totlmtran o;t0 ruoxm oo1omenlfcsls)arum(r ;u0aetnmfeiatlaDem(mo;u0 eermo3tatfaDrlu il(0s2um(mpiudalt mnvs () Dururpot0apeoifeiasfs2eanvp;u)arxnir3oodfaDr uvilt0 2xo(r3nydope lnetatfaDur(roou1ale  ietltla2uanvo;()alxnxf oa1la eanes;s) 2tr(rpio4ope lnes s sDra(mp;u4tetn fciydlaDul(monu0tltnxo3iydoa rauvi s0t2umim iydaltnlfvsl(  2ur( poo1apenmfctys a2eanvont4aleomo3oydopDranvsls s2umimpio1ap nlnvs tf 2rrxmp;o1teto iciad aDranvpnt)tlerio3iy1fatr ueslt0t2uoxo iudlpeelncs sfsrra(  ou4optoiiciatls2ua(vo u4aetrif3ia1faDrlieilt0srtr(mpnodlmtn ietatfaDuaxr ;o0ope  ieiytfa2um(vs;t0 renmocto1oa e ivils0 exmim3oydol nmnct t)s2ta(ront1texnifciaslm2ranvpnt4 exnmr tytop  auei s0 rxmim oydol   feiatf Drrurpoo4ale ii3tysfmDuan o t4teenirciy1lm rlnvi t0tetrxrpou4ame lnet (f 2tr(mo;u1opt  fetld mDrlu s;t4tetnmf3iy1lp raieolt0 exo(rpou4ape micsls srtrxmo;u0tpx mieilsfm2em(msnu0artnmrciotomDeaieo;t)s2xmio3iudap elnesa( srtaxmo;o0texoii3iatlm2eln o;t) leoxo iy1fp rlieo s)sruoxm nudlpt  fetasfarraurp;o1opxn i3tytls rl(msn(0aeenxf3tytfpD ai s ()seuoxm oudllee fvt tfa2taurooo0oltnmf3iatlm2eaumsnt0aexnxr3tadopD luvs;s)srto(m3no4optnmnvta(farrau o;u0aet iietasfmDelnmo;(0aexnio3oa1fptr u ilt s2ur(m iydap elfctl(faDrmu pno0oexoio3iydlaDrln sn()aeerif3tadlpDrln i;(0t2uo(r ny4aptnmict ()s2trxrpot1tlx  ictysfa2em(mon()tltrmrcoadfmtranvs;t0 rumio iodam elici s arurx onu1aptn f3taslsDrau on(4alxoxfcio1fatelieils0 2urxr3oo4al n fet (fs2ur(mpnu1oetoiieild a umumsnt0 ltrmfcoy1la eaivo ( sexrxopiydom  livta( sDtrxrp;t1tet miciadfaDum(vpn(0altnmfcoa1oat aivs;t  2umirpnudapt mivsl()aDtaxm ot0olt mieiaslm rm( snt0 reomfcoadlm elnvs;t)t2urim3ny4am n ivi ( a2urxm ot4tet moeild m2umnmsnt0aetoxrciodopt  uvilt)tetmxo3oo4lp emivt sf rra(mo;o1opx iietyd s2rmu o u4aleoio3iy1opD  iei t0 etrio3oo1lpte ivtat sDtmx pnu1optomietasfa rm(vs (0trxrxociadlp ean i;()srurio3oodlpt  ncsat  Durxro;o0oetomf3tatfsDrm(mo (4 eeoxr oa1oateln sl( texm(r io1amtelfeta()s2uau pnt4olxnmictydfs2el(mpnu)arxnifciotfpteluesl()t2xm(opnodomeelfcsl(  rrrxm no4apxn feiaslmDuluvont) rerxf oa1fmDrlieslt0 rtm(r oydome lncs t aDtmu  ot1tleomfctatfa2elnvsnt0tleomr3ia1laD  nes;t sruoxr nodol  mfcs tfartr(rpoo1opxn oeiysla2umums ()altnio3iodfaDelu i;( srtmir3ny4lptnlics sfsDrrxm nu1oexnmfeiytla emumon(0aexrxrcoytopDr i s;t t2ur(mpno4amenliet (f ruaxm ou1opt ioeilt aDrl( o;u0arxnio iytfptrln sls) 2urxopoo4lme lfeia(farta(mpou1tlen o3tldlm uauvs;t4arermf3tytlptr ivslt t2urxo iu1ape lfviat)aDurump;o4alxn octls m ea( pnt4 exnif3ta1optr neo;s trtoirpoodap nmnei t)sDrauro;o0apxomoeiatfsDuanmpnu4trerxfciadopDr ivslt seum(o iu1am  mneia()aDuaxrp;u4tpx io3tld aDulumo (4texnxo oa1fat aiesls0 2xmxr3io1lp nlictl( artaumonu1tlt ifeiysfm ean p;u0texomo oadlpDeaivsls seuo(mpiy4op  lnctlsfsDtm(rpoo4opxnio3iyd s2uau pnu0artoiociatomDr neols) 2tmxm3io1op e nvs tfs2rmx pou0oeenmociad m2elnvpn(4artnir3iodoatrai slt0 rurxr3ou4oltn nvils)s2uaxmonu0oexo oeiasfm umu p u0alermrcio1lm r uvil( t2urxm iydomeelivtls)sDtr( p;o1tpxnmiciysfm2ua( pnt)tlxomo3tydlpDe uvi;s trxo(m io4amtelnctas sruax ooo0opx  fciadfm rauvp ()arenxo3iy1op  li i t0 rtrxo iodop nmnvils a2tr(rono4oeeniieiys m eluvp;t4altnmo3oydoaD lieo;(  rurimpnu4open icsa(fsDtauro;u1teeo ocilsls rmn pnu)aexrir tytlaDr ivo s) exoio3nodolee fcilsfsDtau o;o4olenmi3iyd s2rlumpnu4 rtnmrcootfmtelieil(  rtoio io4lp emfvil() rta(r nt1texoifeiadfm ranvp;() lxnioctotfmD luvils srxrir3iy4lmtnlnvtat  2urxront4tet iocild a umumont)tleoiocoo1lmD auvo;s0 euoxr3oy1om n ncil(fa2trx pno0aetn o3ilt a ean p (0treomocia1oat lueol(  rxrxo no4llt mnciasf 2ua(  ot0oexo feias m2rau onu4 reoxfctydoa   uvs;t)s2to(opoudlptn fvsa()s2ur(m ;u4aexn f3ils mDulnvp t)aexomfcoatlaDrlivolt)trtoim nudamtemieil(fs2tmu p;o4tpeniictytfm2uaumpn(4tlxoxf3ta1op elneilt t2xr(r oudop nlnet sf rtmumono0tpeomo3ilsfs2emnms (0 eenir3oodfmtrauei;t0trxoiopny4ol   fes s srra( o;o1apeomfcias m rm(vo;(4trxomr tytlate nvils0s2xrxo iu4aptemfvia()aDrrx poo1olt ifctysfs2em( s;(4 rtnmr oytlp rli i;s  etmxm oudomenmnvi ( srrrurpnu0tlt  octysla2rl(mpnt4 lxrif3iodfpDeli i;s)t2umimpiu1altnmnvsls)sDua(mp;o0tpx mo3iat m elu p;() lxoir3tytfm  ln i;(0texoxr3nodoptemnvilt)aDraump;o1altn fcilsfmDeaumo;t0tlxoio3ta1fp  lu o;()trtoxo3nodopt mfetlt arua(ront0aeenmoeiadfmDulnmo t)teenxocoatlaD aies;t)seum(opio4lpen ics t s2uau pot0oexo oeiadfsDran o;u0 ltnio3to1fmDeli il()t2to(o3ny1om nlncs t sDrrumo;t1alx mf3iyslaDuau p t0aexoxo3iy1fp   uvol(0srxmio3no4aleemivsl()srurxmo;o1aleoiiciatfa rlnmonu0tlermo3iytlateai sls srtriopio4lpeemncsa(  Drrum ot1tpenio3ildlsDrmu pnu) etnxrctodfpteaieol(0srtoxo3iy4lltn fet ( srtrxmp;o1oeen oetat s um(vs;t) ltrmo totfp rln i s0 rumxm io4llenlneilt)sDrrxmpnt0opeomi3iadfm2emumonu) leoio3todlateli olt0texrxo3nu4aptn fctl()a2tmumpno1tlx moctltfmDulumpnt)alxrxf3oo1opDe nvols)trxoxrpnu1lm nmfvia(f Dtm(rooo1tpxo i3ilsfaDumnvsnu0arermf ia1lm elueo t0 exrirpny4op   nesl( a2ra( pot0opt  fciatfs uanvs;t0tlxoxrcoa1fm eanei;(0trtm(m3no1omtelfet t  Dtmxront1aleoiietyt a2ua( s;u4aleoifctydop e i s;()setoim3ou1ap n fvilsf Drru p;o1oltnmoeils m2emu sn()artrio ootom  ln ols0seto(r oydol   net ( sDuru pnt4oet iociltfm umuvo t4aeermfcoo1fpDr n i;t0 rumxm io4lmeelfviat)arra( pot1teenmf3iad m2rlums t4areriocty1om  auvs;t0s2uriopou4lptn nesl() Durxmoot4opxoioetldla2rm(msnu4tlermr iadlmt aneils s2toxr iy4aleelict sfaDtmurp;o0oltn ieils m um( on(4treomo iatlpt  i o s  etoio3ou4ap   ictat a2tmx o;t1tex moctadfmDrm(von(4artnif ty1laD aueo t0srxm(opoo4amt  iei (faDuaxrpno1olt mieiydla eau s;(4 lxoxo iotfpteaivo;s0teumio3iy4lmenmnesls) Duau onu0texnioeiysfmDrlumonu4arxoxr totfate ivolt0texmirpou1ol n fct ( aDurumpnu0oeeomiciyt a2ra(msnu) lxrmocio1lpD lues;( srto(o3iudom elfvtat) rta(r ot0aet ifciadlm um(vp;u) exoxf3oodlp eai i;(0s2ur(opno1ol   icsl()a2rmu ooo4alt mi3ils sDumn s;u0aetrmrcoodoat anvo s)srxoir io1lp elncsls)s2tm(m ;t4alx mfciytlm2eanms u0 ltrxf3to1op eaueo (0 2uoio3iy1apen fesas)a2tmxmpou4opx iociadla ea(vsnt)aexnif oadlp eai s;s)tetr(r oy4lpee ieiatfaDtmxmpot1tpe mfetyslaDumumo;(4texomr3oadlmDr ieol( teumir3nu1lp  mncils  Dtr(m oo1opxn iciytlm2rl(vonu)teenmf ty1op r uvi;t0sexmxmpnu1am nmfvsas)aDtr(r ot0tltnif3iyt aDeanvs;(4artrmr oodlate u o;s)t2uoim3io1al  mfesa(f 2ua(mooo0apt mo3iyt s rlnmp;u4 renmr to1laDe ueo;t t2xoirpiydalenmicta( artm(ro;u0oeto ictlt m uluvs;t)alerif ta1lpDeau sls  exmiopiy1ol   fet () rumu p;o4olxnmiciadls umnmp u0 eeomoctydlp r nes;s)srxoxopou1alte nei (fs2raxm ou1oexn feiat a2umu pnt4tleriociatlp  lneo;t) 2xr(opou1lm elnetls)arua(moou4aetn o3iltlm um(vs (0aetomocoy1lp  luei s0 eum(o3iy1ll   iei ( sDrmx  nu0tetniictldfm2rl(mo ()tlxnmf ta1oat  ivi;t0tetmimpoudll n ieil( aDuau  oo4tlen fctas aDumnvon(4tlerxr3iytlmtrlueolt  etrio iu4ale mieia( artru  ot1teeo fciatfsDemu sn()treoif to1laD  uesl(  ruoio io1lm  lnesls)artrxr ou4ape  oeildfsDemump;t0trxoxo oo1fateaivo t0s2xo(m iodome  nei tfaDur( ono1tpt  fciyd a2ea(vonu0 rxnir3oa1opte ivo;() eurim iy1amtelnvs sfsDtrxmpoo0teenioetaslm2uau on()aeenxoctotlptraiei;s)trxrir oy1am n ictatfsDuax  ;o4oeto fciys a2eln s u4 rtnmo3oydlpteaieolt seumxrpny1omen fvtlt a2umxmpoo1oex mo3tyt s emnmo;u0 rxnxrcty1oaDeauvil() 2xm(mpoy1apenlneil()srrr(  nu1opto o3iyd s um(mp t4alxnmf3iodfmDeluvo (0srxoir oy4olen neia(  Dumumono1oeen fciadlsDrlu o;(4teerxf3oadfm  livi;s t2to(mpnydlm emnvi s) Dtmxr oo1oetomiciltfs elnvs t0tlxrxr oodfaD aneo;(0t2xm(mpno4opte fvia()srrmxmo;u0aex mfeiyt mDrl( o;u4 lerir oatfpDelu s t setriopno4altnmicil(farumx  no1texomiciat m2umuvpnu4treoxf iy1om   ivi (0truo(opny1amt  net t) rtmur ;o0alxnmi3tas a ua( o;(4artoifcoadfpt aivil() rtmxopio1lptnmnviat) rra(mpnu4tltomo3ild a uan p () exrmr3oy1oaD  i il(0 2xoio3nodap  mfvtltfa2ua(mp;t4opt mfctldla2uanvs;u4aexoifciodlpt lu ols t2xm(o iudol emfesa(fa2rm(r oo4alxomo3iyt aDemn pnu)tlxoxr3tatlmDrlueo;s0seuoxmpny1am nmfeil( s2taxrpno4tpe ifeiyd m eanmp (0aeenmrctadlat aivs;t sexoio3ny4al nlfvt t sruaum nt0aleomf3tas m2rm(msnu)aetrmr3iotlmDrai o s)trtr(r iu4lpe  ietatfarta(m nt0tptniociydfmDraump t4tlerif3ootlmDelivolt0texmir oodomtn nvtatfaDrm( pot1teeoif3tlsls2eaums t0 rtnif3tadfpD aies;t)trxmxmpoy1lm nlneiasfsDra(rpou1tpx if3iaslm2rlnvpnu)areoiocootfaDrlnvo s trtm(r3oy1lltnlfesasf Dur(mooo4tet mfeiltla eau p;() eenmr3iydfmDeaivi;( texr(o iy4om   nvs ( aDra(moou4aee  oeild a2uauvont0 leoioctotfm eai i s0 2trxr oo4lle lfct t) rrr(ro;t0tle moetldla2ea(vp ()trxrif3to1omDeanes s0 rxrir3ny1llee fcs sfs2urxr ;u0tlenifetltla2emnmsnt)arxrxr totoat au o t0s2to(o3io4lpenlfctl() 2raxrp;t0open feiytfa2elu o (4aetrif3todlaD luvi t) 2uoir iy1lmt lnes s srurxrpot0opxn f3tlsfs eauvo (0 etrxr3io1fp rluei ( teuoir3oy4lltn ieils srumumpot0oltnioetldfmDrmu p t)tlxomf3iy1la  lnvols)t2toir3ou1oltnlncia(fsrururoou1aetn fciadlm eln s;u0trxrmr3iydla eluvo t  2urxo nu4am  lfvi (faDtrurpno1oleoii3tlsfs ul( o;t0 exoxf iotla eaivi;(0setrxrpny4apeelivi (f 2tax ont1tpeoio3iyt s rl(vsnt0texnxo oytom elnvi t0 2uoxr3iu1lmeelietlt)a2umumo;t1oeeo oeiltfsDuan o u) exomf3ty1fmt lieilt)teurim3no4opte nvi (fsDrm(mo;t1tpxo iciytlaDuan o;u) exnxfctotlpDeanesl(0seur(m3iu1altnmfctl(  ruru oot0tptomociyd m2em( p (4 reoio oy1omtelieil(0texo(m no1lpt lfcs (fa2rr(moou1openmfctldla2rauvp;()artomo totlm  aiei (  2urio3no4oltnmfciat) rtaurpnt0tltoifcilt mDel(mpnu0 exnmociy1fptelu o ()teurxm oo4olenmivia() 2rrurp;u1tlenmoeiaslmDul(mp () rxomocia1fp r ies;t)srxmiopnu1lmeemnes t srta(  ou4olxomiciyslaDrmumo (0texrmrcoa1lp r nei s0srtrxrpnu1op emfes t arur(  ;u4tlxnioeiyt a2ul(mon() lxnmf3todlmtr ieil(0 exr(opnu4lleemnei t  rtmu  no4olxo icildlm2eanvs u)aexnir iy1lpDelivslt0s2uoxr iy4ope  fet ()aruax  oo0teeo iciasfsDrm(ms;t0 leoif3iotoatraivo;s s2to(r nudaleelfet tfa2trxm no1tex  oeildla2elnmp u4aeerxr3iotomt auei t0t2uo(r nydomeelneiasf rur(mpnt4teeomoeild sDuln s;t0tlermo3iatoaDr n sl()trumio3iudlme lfci ( a2ta( pno1texomictatla2umuvs t4aetrif3io1fmD liei;s) eto(r3ny4al   ivtl() rurumo;o0apt  fetlslm uanmpn(4 rxnxr3io1fm   i o;t0texr(mpou1lme  nvt ()a2rrur nu0olxniociasfmDrm(vo;t) ltnxr iydfpDelues (  etrxrpio1ll   icias)srtrum nt0ole  o3tat sDumumo u0 lenxf3io1omt lu s (0trxrimpiu1lm e ncias  2ra(  ou4tex mociltfa2raump t)alxrmfciatlatr u s;t) etmxmpnudlmtn nesatfsDta(m ot0tpxnioetytla uln o;() rxrmr3tadlmD ai o;s)t2urimpiy4al  livtlt) rtm(mpnu4oee  iciydfm rm(ms;u0treniocty1fpDelnvol( srxrio io4lltnmivt tfa2tr(moou4opxomi3ilsfa rmn snu0aexrxociy1lm rlnvs ( t2xrio no4oltnlieils  rra(r ;u1oeenmoeiyd m eauvsnt4altrmocoydlpDrluvols)s2toxo3nudom n iesa( artrx  ;t4tpenmiciyt s2rluvo;u4aetnmf oodlp raivo;t) 2xmxr ny1oleelictltfaDuaxr no4alt ifcilsfs2rlnvs;()arxrxfciadlm e ieo;(  exrirpnu4lp nmfetatfsrtau pnt1tee mfciytls2umnvo t0tlxoifctodom r ieo () 2xrxm iu4lptn fesls)sDuau  nt0ope ifetlsfs2rm( p;u0trxomr3oatlmDeauvo;( trto(m nodlmtelfviat) 2ta(rono0oeen i3tadla2um( o t) rxnifciatfmDrlivi;( seuoxr3no4omen neil(f Duau pot1oleomfctas s2uluvpnu)artrmo3iytfatr i olt)s2tmirpoo1lm  liesl(f 2umurpou1aptomieias m eanvs (4 lenxo3iatom r neo s0seuoxm3oo1omt lfcil()s2rmum ou1tlxnio3tldlm2eau o (4arermf tatoaD aneo;( srxrxm iudom emnvils) 2raxrp;t4olenifcilsla2uluvsnt4trenxrctotfm  auvs;s  eurxm3nu4lm e ivsas) rraxront0aptnii3iysls rln s ()aexnir3totoateanes;s0setoxo3ou4oleemfeilt  Dumx  oo1olt iieiatla2umu s t4treomr3oatla  luei t)s2xmiopoudllenmfetlsf rumu poo1tlx iictys aDranmp;()teermf3oo1omt lu olt0teur(rpiu1oleemfvsls)sDrrurooo1tpx io3iydla2rauvo;t)aeerifctatfmD an s t trtmxrpoy1alt lfeils)s2tm(mp;o4apx ifeilsls em(vpn(4 ltrxo3oatomtr uvo;t trxoim3oy1lle  nci (faDrmx pno4tlxo ictadls2ul(mpn()trenxf3iotlpt lnvs (0teumim3iudapte netltfartrxr nt1tpxnmoeiadfmDranvsn()trxrio tadfaD  ueilt0 eumxm3iodlpt lfcsl() Drmxrpoo1tlenmf3ildfa2ul(vs;(4trxoir3tydfmt  u s;( t2xm(mpnudom   fetlt)artm(  oo4opxoiieiytfa2eluvonu0alxnio3tydfaDrau s (0t2ur(o3nudlpen fvsltf rtmxmoou0texnioeiasfs ra( s (0 rxrir3iatfaDelnvi t  exm(o io1al n fcs s)arrau p;t0tptn f3iatfmDulnmo;u) leoxociotopDrlu s t)tetoxo3nydll  mneils) Drmurooo1oeenmf3iadlm2um(vp t4aetnmocoa1lm rluvsl( setm(o iy1aptnmfct ( s2umx o;o4oleo ietydls2umuvs;(0tltomr3oy1lpteauvs;()seto(r3iydlp elivslt srtm(r nu1apen icilsls ul(ms t4aeerioctadfaD aivo t teuoim3oo1olt lfcs (  Drmxm oo1tex mo3iys m rmuvont4trxoir iatomDeaueolt s2xrxr3oudapte ivt s)arrauronu4aleomfeilslsDuaums;u0artrmo oa1lmte ieols) eumim iy4amtemfeiat  2rrur ;o4tee ioctltfaDrluvo ()arxoxfctydopte u o;(0sexr(opnudlltelfvia(faDrrxmo;t1tpeoiieiadfa2uanvont)aeeomociydom raueolt0tetmio3oo1lmenmfvi t  rtmx  no4alxnmoeiltfs em(mpnt0aeeomfctotfmt  neilt)s2to(r io4om  mfciatf Dra( pnt4aexniociad mDemums t) leoxfciydfa e nvi ( setmxm iy4lpt livtlsfs2rm(m ou4aee moeiatlmDuanmo t)areoxr3iydoa eluvil() rxo(m no4lp  mfcsat  rrr(m no1aptn iciltlm rm( s;u4 lxnmrcio1fm r ieo;()t2xm(mpnydole  neil( arua( p;u0opxoii3iytfa rauvp;t)tleoirctydoat  i s s)setoxr3nudlle lfcsat srtaurp;t0oeto feiltfaDrau s t0trxniocio1lmt au s ()trxr(m3no1oleemiet s aDurx pot0teeo feiatfs2rmuvp;u)tetnmrctytlpDrlnes;()setmxr3iudal n fetl(f Duru  nu1aetnmf3iadls2raumsnt)arxnmociytomDrlivi;()s2umxmpoo1ll emivt t)artm(m ;t0opx  o3iytfaDum(msn(0 lxnir totlatr ieils texrir oo4openmfvs (fsDurxm ot4oltnif3taslmDrlnvo;u0aetoir3iydopD aieilt0t2xm(m iudolenlfetlt arumx  ou0ole mfcildls em( pn(0artrio totoat aues;t) 2tr(o3ou4lpeemfeil( a2rmurpnu1aexnmfciyd s2uln o;()teermociodlpDeaues;(0sexrxm3oo4ale micias srrru pot0apxn ietadlsDrlu pn()altomo iytom r n o;s) rxmxm3oydlp  mieil(f 2tr( ont4tet mo3tadfm2em(mp (0tlenirctytlate i i;t)t2umxr nydol nlnvsa(  2tmx  nt4altomocias a2uan snu4tleoxf3tytlateanvil()texrim ou1lm nlivs (  Dtaxroot0olxoii3iadla ulnmpn(0aexoirctadla  lnei (0t2ur(o no1op nmfci t) 2uru pou0apen o3iytfs rauvpn(4aexoirciadla raues;t)s2xm(rpio1ape  fvi (f 2rm(m nu1tptomo3tytla2el(vpnu0arxnxociodopD lnvil( srurimpiodlmt  fcsl()s2taum ou0opxnifciys m2rmu s;u4aeerir3tydop r uei;s)seurimpoodam  licslt) ruaxrooo0optoiieiatfs2rmnvp;u0 lxnxocia1lp eaueo t0texmim3oo4lmeeliei s  rraur ;o4aleoiieiatla elumsnu4 rtoxfcoo1op eliei s)t2xr(rpoudal n nvtat) rumxrpou4aleo oetydfm eanms;(4altrxo iytlptr n o s) etr(rpiudlmenmnciat a2rru o;t4tpt ifetytlm el(vont) rtrmo oa1fpDe nvi;t0t2uoiopoy1ope mies ()arumur ;o1alxnmoetaslaDuanvo t)aleoxo io1latran i;t) rxrxm oo4lm e nvs s)sruru  nu0oeenmictltlmDrau o;t)tlxoirctotlpt aueo (  etoim iy1lm  mfetlt s2tm( p;t1tlxniiciyt mDea(vsn(0aexoxociodfa r i s;()s2xmiopio1lpt lfesls)arua(roou1tpxo fcildls rmums t) ltnmr oo1fmDe n o s) 2xmxrpiu1apt mfvs t a2um(m ou1apxn f3iys a rauvpn() etoif3tytop elneo;( srtoxo nodame mfvia(f Durxroou4apt mfeiytlsDul(vs;u4aetrircoydopte u i s0srtoim iudll  licsasfs2rmurpot1tet  i3iatfm2el( snt0tetrmo3iatlmte ueo;t0 rtr(opoydom nlfcslt aDrmurono4tptnmoctldla2eln pnu0teenir iatoaD lnesl(0texmxm oodam  livs t  2rm(m ou4openmfetysfm2emuvo;u) lxoxocoytfptelnvo s  2xm(r3nydopt mncsa(faDua( oou4apt  oetyt a2emnvs t4altnxf tadfmDe iei;(0seuo(m3io1llenliesa(fa2uax pnt4aeenmicilslmDumu on()texrircta1lmt  uvsl()srtmir3oy1ame  fvtat)s2taum ;u4opt mieiys a2umnms t)tetoifcoytlpD aues;s0 2tmir oy4lme mivsl( aDtmx  ot1tet iicilsfmDemnmpnt)tltrmf tadoptr neolt0s2xo(o oodom n ivil()sDur(m no1ale  iciasfmDeln p t0trerxfcty1lp eaneol(0s2xoiopno4ap  mivilt aDtmu o;t4oetn fctytfs uanmo t4aeeoxo3iydoatrli ols)s2xmxr oo4llenmnctas a2ta( o;t4altnio3tyslmDulumo;(0alenif3ia1omDelnvo;t) rum(mpiu4ll nlfei s)sDtrxmonu1opt iictatla2emn s (4 eenifciodop rlneilt0 2xm(o iydlleelncs t srraumpot4oexomieiadls2em(mo u0trxrmr3tydlmt lu i ( texmxopno1opee ivt t)aDtr(m oo1oet  i3iysls umu sn(4tetomocoo1oaDe uvol( s2xo(r nudomtemfctat srua( o;u1tee  feiadfa2eanmo u4aexoxf iodfmt anvilt)srxoir ny1lp nlivt () 2uaxmoou4aexnif3tadla2el( s;t4trtoir3oydlm elu i;t s2ur(m3no1al e fci (farumxrpoo0tpx  o3tldla2rmumonu0trtoxfciytfmtranei;t0seurxm3iudlmeelfvt t  rrr(roou0optnioeiytfa2ea( pnu4 rtoxo3iodfaDr ues;t0trumiopiydomtnmncils aDumx oot1oex  ictls mDrlumpn(0trxrxo3ta1lpD liesls  rumim nydapen fvilt)aDtau onu0apx ioeils mDeanmo;u0aeenir tydomte nvo;t s2trxr oy4ll  liei tf rurur nt1tptoiictydfm2ua(vp;() renxrcoo1lp eaueol(0 eumxr3nu4alee neiasf Durum no0apx iicilslaDrmn pnt4aleoiociotomt  ues;s0 rtmxr3iu1ol n nvt sf Dtm( pot1texoifciyt s2rmnvsn(4 exrxr todfm rai i ()t2urim io4altelnvil(  2ra(r oo4tlxo feiadfs2um( s;t0artoifcia1fp  aieol()srxoxr3ny4ope  ict (f Dtmu ooo4tpen fetytfmDel( p u)tetrxo tytopDelueo ( t2tmxm3ou4lmenmnvs ()sDuaxront4olt  f3iatlsDua( o u0teerifcoy1omt  i o t s2xm(r ou4oltnmfvs s arta(rpot0apxn f3ild a ulnvp;t0tleoirctydop rlnvols0srtoxm3nu1ole mnei s) ruaxrono0ole ioeiytls emuvs;t)aetnif3oo1opt  nvi;t setoio3oudaltnlieia( aDtmurpnu0tpt  o3tadfa2rmump;u4trtoxrciytom elueslt) 2xoxm3oy1ape lfvsat artru  ou1tltnii3tad aDum( o t0 eeoxf3oa1fatr nei t  exoio nudom e nctl(  rtmu pot0tpe  fcild sDelu o t0trxomoctotop r n slt0 2toxrpiodlme mnvs s a2rm(r oo0tpe  iciadlmDrlnms t4trtrio3iy1fa e nvsls  ruoxo ou1openliviat  2umx pot0tptn i3ilsfs um(vsnt)teeomo3ty1lptrau i;t0 2trir3iodomen fet ()srurur ;o4oexomf3tldlaDeau p;t4altoxrctytomtrlueo s) rtoxm3iu4ape lfct tfartmur ;t4apx iociysls2eau ont4 rxoxo iadopDe nvo;s)trtrxr3no1ame lfctat) 2raxronu0opeo iciyd a el(vo u0 rtrmfctodomt au o;s  rxoim3no1al eliesat  2rmxmpnt1alenmieiyslmDulnvs;()texomoctotlp  aueo t0sruo(m3iu4aptelncsls)sDum(root1opx ii3tlt sDem(von(4artriociydlpt lnvs;()t2toxr3nu1ape  ncilt arua(m no4opx moeiydfaDuluvo;t0 exnmo3iatoa eai o;s)srtmxr oudom  lfcils)srumxm nu0oet ifetyt mDea(mp;u0tlxrxo oo1lm  lnvsl() exr(o3iodom  lfcs () 2tmxm ;o4aptniieiasla2ranvpnt0tlxnmrctotoa  aieo;( trtoxm3ny4lm  mfesas aDtaumpoo1altomi3iydfsDua(vo u) lxoxo3iatfateln s s)seumirpny1apee nvia(f Dum(rpno0aptnio3tltlaDrmnmo;u) lerif3iy1fat livsls  exrirpoodll e icsat s2rmxmpno4optnii3tls m eauvs ()tlxomr iydfa r uvs;()t2um(opiy1oltemivsl( a2rrump;t4ale  i3iasfaDua( snu) lxnxrcoa1faDeauvo;( srtrxmpiy1llt lfvtas srrmur ;t0alt ifeiaslm em( o;u4aetnmociy1fmt an s;s0 eto(opiy4ale miet s) rraurpnt4alxnmfeiasfm2ra(vpnt0trtoxo3oatomDelueol(0t2xmio3oy1lptnmnci sf 2rrxrono4aexoioeiydls2umumsnu0tetrxr oa1lp eaivi;t0s2trirpou4lpeemfvsl(  2uau  ou4alxnmo3ild s2ean on(4tltoxf todfpDrlnvo t)t2to(o3iy1ap nmnctasfa2rr( p;u1oee  o3iasfs2emu s;() lerir3iy1laD an o;(0tetrxopiodal emivta()srrru  nt0tltoif3tlsfm ean pnt4 eenxr3iytfat  nvi;() euo(r iodoptnlivils sDurx p;t4aee  o3tltla rmn p;()tlermocootfmte i ils0s2xmxmpio1ol nmneilt srtmu ont0opxomo3ias s2ulumo;t0aetrir3iatlm r uei;s)trurim3io4ll e iesat s2rrumonu1aetomfeiadfs uauvp (4 ltrxr iy1lmD an s s0srxmxo3iy1op emicta(f 2ra( poo1alen o3tytls2rau o;u) exrir3iatlpDe n slt setoio3oo4lmt  fetasf 2tr(rpoo1tltnii3tysfmDrl(vo;t0tlxomr to1fa eau sl(0srumxm iu1om  micsl( srur(mp;u1olxnii3iasfa uluvp t4arxoxo3iy1fp eauvilt0 rxoirpnodal  lieilt)a2trurp;u4aee  fcilsfs2rauvp u4teeomo ootomDr ivo t0 rxoxo3nodolee ieias  Drmu p;u4aex moetys m2eauvs;u4texnxocia1fmDrau sls0texoio3io4apt mfcs sf Dum(r oo4tlxo ociyt m eaumsn(4 exnifciatom e neil( t2xoxopiu4lle lfvslt) rumurpnt1tex miciysfmDul(vsn(4arerir3oatoatrln o;t) etrxr3no1lm  mnci ( a2umx o;o0tpt mfeiytfs umu p;u4tetomr3tatfa r nvo;(0 2trxo ny1lptnmnci ()artru pnu0aeeomi3ilsls uanvont4trenmfciodlaDranvi;t0s2to(m3nydaptnmnvsls  2tmxrpou1oleoii3ils m2rmums (0trxnmo iydfpt auvo;t0trumxm3no4om nlfes t)aDurxroou1apx  f3iyt sDem(mp;t0tetnmf ootfpDeai ilt texr(r iydaptnlnvsat) 2ur(mo;o0oexomf3iatls umu s;t4arenio iatlpt li o s  exrxm iu1ap nmfct ()sDua(  ;o0opx ifeias m2ean s;(4arenir3oytla ranvs;()trtoxr3iy4lpen fcias  2uru  ou4tpxo f3iadfm2rluvs;u0alxrir tytfaDrlivi;t)s2urxopnu4lp nmici t  rrm(mpoo0apxo i3ildlmDrlump u0aeeoif3oadomtrlueslt0seumirpnudopt  iesls)srta(r nt0oeenmfeiltfm umuvo;u)tltnmo oy1fpD aneo t) rxoxo3nydomt mfeil(f 2tmxroot0ope moeiatlaDra(vo;(0altoif3to1la   uvo ( t2uoxopiy4oleeliesa(  2uau pnt1olxomiciasfm emuvs u4tlxnxf3iatlpteaieo;s texmio3io1ap nmnctlsfs2rm(mp;u0tpe iieiyt a2el(vpnt4arxoio oatfaD ai olt0t2uoxr3nodlmtnmnvsl( sDrru  nt4opt io3iad sDean p ()artrir3tadoaDe uvo;s)srurxmpoudape  ncs (fa2umxr ;u1oleomfeiasfm2em( o;u) leoif3tatomtrlivo t truriopiy1amenlncs s aDum(rpou4oexoiieiysls2rmuvs t)tlerxr iotfpt  uei;(0trxo(m3iu4lm   fcs ()srrr(mpoo4tpxo o3ildla ul(mp;(4tleomfcoo1fatr uvi s)seuo(m iu1apeelneilt  2tr(m ;u1aetn o3tat s2rmu o () rerxr iadoaDraivs;t seuoxopoy1lltelies tfsDrrurono1alx mieildla uanms t4texrxf3to1fmtr ueilt trxoimpoudapt mivi (  2ta(mo;t4apxomoctyd sDul(mpnu)trtrxfcta1lmD  ues s)setoio3io4al elnviat  rrrx  ;t1oex mo3iytlm2em(vsnu)teeoiocty1faDe n i t srxr(m iudomtemivs t artmxm ;t4aee mieiltlsDeanmp t)trtrircoytla   iei;t0srumxmpoo4lmtn fcilsfs2tmu  nt4alenmfetyd sDuau p;u) reoio tatomteauvilt) rurio no4altnmfcia( a2ra(  ;u0opxnmicils a2umnmo u)tlxomfctadlaDraueo t)s2xr(o3oo4opt livt (fa2trxmp;o4tptniiciytlaDrl(mo u)tetrxf3oodfpt lnvi t t2uoxr ny4al   fctlt)a2raxrpnt4tpenmfciat m ra(mo (4 rxrif3io1opD luvol() eur(m3iydlp elfesa(fsDurxrp;t4apxn ociys m um(mp t)aetnmf iy1omDelnvi t  etriopiu1ole lnctltfartaum nu1tee  ieilsfm2ua(mon(4treoir oytomDraieils) rxo(r3iu4amen icsa() rtrumooo4aexn f3iyt a2rluvsn(0aetoif3todoat aues s  exr(rpiu4ll e ict s)aDrau ooo4olxo o3tat a eanvo;t)trenirctodoat  n sls) exm(opiu1ap nmncsl( arrrx pou1oex iociydlm emump;()texniociatlp eli i;t0srxr(m ny4lpenmicta(  rtmurpno4olenio3tys m2ra( onu)treoxr tydfaDraies;()srumim3iu1ap nlfvtl()sDtm(moot0teeomoetltlsDrlnmsnt4 lxnmocoatfmtraneo t0sexmiopnodamte ies s aDrm(rp;o0tle iictydfa umn p u) lxnxo oytfmD aneo;(0 eurxm nu4lle lietl(  Dua(m ot1oeto i3ils a2rln p;t)aleomo3iotfaDr u olt0texrio3oudop nmfetat srrrumpoo1ope  f3iadlm em( p u) rermo iotomteau o s) 2umir3io1alenlnvt sf rta(ro;o4tlx mi3iad s rm( on(0 rxnir tydlaD livilt sruoxo3no4lm   ict tfsDurxm no1tle mfeild a2ua(ms t0 ltomr io1lateau i;(0seumxo iy4amt lfci t)sDurxro;o1tpxnmoeiasla2ra( s t0texnif3iadlaDeanvo t  rtr(o3oydlm  mnvtltf rumx pnu0ape  ociyslmDulnvs;u0 rtrxoctydla eauvs s)trxoxo3iy1oltn fctl() 2raurpot0tpto i3iatls ulnms;u) etrxocoo1fat aueolt seumxm3nudlmtnmivtat aDua( o;t4opxomi3tadfs ul( o;u0trxoxf3tytop   uvils setmxo ou4opt mncil(f 2tmu pou0olxnmf3tlt aDrauvpnu0 etoxr3iatla  aies;t)t2tr(m oo4omtn nvs t  2rrumo;t0oet iocilsfa rm( s ()aetrirciatom  anei ()trtmirpou1ame mnvtlt a2rr( o;t0apeomieiys a uau o;(4altoifcty1lmD lu il()sexoio3iudoleelnvilt artaur ;t4tpe mf3ildls el( s ()tlxomo3oo1fpte ues t0tetmim oy1am nmfcs t  rta(m ou4oltnmfctlt m emump t)arxrxocoytfaDraueolt)setrir3nu4al n ncs t) rum(mo;u1texoiieiysla2ra(vonu)texoir3to1lptr n o;s  rurimpiy4ame lnvi tf Duaxm nu0ope  ieiyd sDrlu s u4 exrmf3oy1opD lu o () 2umxm io1opee ivs t srtrum no0tet  o3iatla ra(vp t) rtrmo tydomtraieil()truo(rpny1op  mfvi s) Dum(ro;u1aeenio3iltlaDulnmp;u)altoif3oodfm eaivols)trur(mpny1op elicsa(fsrra(  no1tetoii3iltfmDrl(mp () lenmoctotom rlivi;s  2trir iodamee nvsasf Dtau onu0oexnmfetas m ean o u)aleomf3todfmD aueo s trxmxo3iydlpee fcs t)s2taxmp;o0alt  octad mDulu s;t)altrmr3oodfp eanvo;t)sexo(o iodlle mici (  rtrxrpnt4aptnifeias sDraump;t0aeerio iydlp raies s0s2tmiopoudaltn fvt s)a2raxr nu4alto oeiasfa2rlump () rerioctadlpt an o t0seuo(r ny1lm nlncsat aDurx oou0opxoiiciysfs rm( p u)teeoxr3tatfaDrluei;s srtmio iodam elfeils srur(  oo4aeeo oeildfsDrlu pnu0tetomf3totomD lieo t0 etr(rpiu1omt lnvtlt)aDuru oot0tpxomo3tas a umn s t4teerxf3iy1lp rluvsls  eumxrpiu4ol  mfei s arrmumo;t1aetnmiciydfm ul(mo;(0artnmrcia1fa  anvi;(  ruoxmpnu1ol  lfctl() rraumoou1ale  o3ild m elnvp u) etnif ta1oa r uvo t  rurxrpiydomtnlietl(fsrra(m ;u0oeto ociyd aDrm(vs;t0texrmr3oatopDranvs ()srtrxo ou4lm nmnvt (  Drmxr ot1tee  o3tatfaDrmnmont) eeoif3oytfm eauei;s)s2xrxr3ny4lp nmncil()sDumurp;t4open ietat mDua(vp (0artomf oy1opD au i;t0t2xrim3iu4am n fcil( s2ua( pnt4tlxnmieiytfm2uauvp;(0trxrxfcootlmtraueo;s0 rto(o3oo1alt mfvsas)arumurpot0aeeomi3ils a uluvsn(4trxrmocoatfmteluvi s teur(rpnydom elfesa( a2raxmpou1aex ioetasfs ua(vont4tetnmf3oodop ean i;s)sexoir3no1optnlnvil() Dumum ;o0alxomoeiydfs2ul( pnu0aexnir to1oaD  nvols)truoxm iu1ameemnci ( arur(mont1opxn oeiadlm um(vp;u4tlxnxoctydlp   ivs s0texmir3oudam elneslt  2um(  ;t0tpx  f3iysfs2rl(vs t4trtnxocoatlaDeaivo;s  2um(r3nydllt  icils aDururo;t0teeo o3iyd a2eanmo;t0tleomf oodomD aieols t2xo(o iu1openmiesas)sDuaxrp;u4aeenmoeild a umumsn(4tlxrxf3totfm ranei;( t2toxopny4aleelieta()a2tm(root4tlen o3iytls elumo;u)alermo3ootlatelnvilt0s2xmxo iudamtemneilt)a2ur(mpoo4oeeomi3iyt a ua( snt0trxnxf3iotlpDrai o () 2uoim nudomee fvi ()arua(mono4optomf3iysla2emumo;u) rxrxr3oy1faD  n sls0 2xoxo nudap   fvia()arurx  nu0oetnifeildfm rmnmo;(4 exnmfctotfa r nvs s0 rum(mpio4lm elicsltfartmx o;o4tpxoif3tasfm2ua(ms;()arxrif ty1fpDr nei;(  2xmxr3nu1oltn ivt sf 2tm( o;u1tpxnifcild aDrl(vs (4tetrirctydoaDrai i;s  eurim3iu4al elictlsfsrurx  ;u4altn ietad a2em(mpnt0alxrxr3iy1fpDranes (0 rurirpoy1om elnviltfaDtm(mp;u0tpt iieils s elnmonu0artrifcootlaD li sls)t2xmxr nodam  mfvslt) Dtm(rpnt4aex ioeiat m2um( p;u)arxnxrciy1oaD  neols0t2to(opny4ap e fes tfarrrurooo0aetoioeild s emump u4 lxnxfcio1late neo s0s2tmir oy1om n nviltfsrrm( pot4alxnioeiltla uan p;t0 eerio3iydopt  n ols)texm(rpnydom elicsat) 2ra(rpnu1openmoeiltfa uaump (0 exrio3iatomteaivols0t2umxm3nu1amtnmivi (  2tr(  ot1alxnmociltfm rluvsnu4 rtoxrctytfpteau i;s0 rtm(m nydlmee nvsa()s2rmxrooo0optomoeiadlm emuvo;t) exnmocio1om r neolt srtmiopoy1lp   fcs t arrmxmp;u0tltnmi3tatlmDuau p;(0alxnxf3tatla ean i;t trumir ny4amt mfvtat a2taxr ;o0oex  ociadfa uauvs;(0 exrmf oydfp   ivs () rur(m oy4ape  nvt s  2umxroot1alenio3tytla ra(ms u)teerxo3to1lp  luei s0teuoxm iy4openlncia(  rumx  ot1aexn oetas aDeln p t0tetrxocoo1omDr uvi;t)teuoxopoo1lp e nviat)a2tmu  nt4teenmi3tytfs uluvpnt)tlerxrciotopDeau slt)s2to(m nodopte icsa(fa2rr( poo0tpeomociytfs umnmp t4 ltrifciydlptrlnei t0 eumir oy1ope lfeslt)sDur(m no1opx  i3iys aDem(vont4 ltrmf iadlm e ivil(0s2umxopnodlm n fet sf rrrxr nu1apenifeildfa2uanvsnt0 eenmr3tadlmt auvsl(0sexoimpoo1olee nei t arum(mpou1oetnmo3iadla2uan o;(0trermo ootopt ai s;()srxrxm3nu4op e fvt sfs2tmxr ;u4olenmfeiltfaDra(mo (0tlerir iadlat li s t)s2xrir oydomt  fetat)s2trxroou4olx moeiadfsDua(vp;t0texnmf iytfa eaues t s2xrimpoudomt lfcils) 2ur(rooo0aex  i3iyt m umu on(0altoxr iodoat li s;(0s2toim nudlme mfcsas) 2rrump;t0tpe iociydlmDulu p u0tltrmo3iotfpDrau sl()setm(o3iodlmte nci s sDuaxm nu1olen ocildfmDrl( sn(4tlxrir tytoatrln i t0 exoim3iu4ol emfeta()sDuax  ou0oexo o3ilsla rm(mp (0tetoxrciotopDeaues t0texr(m iy1llenmnet (fsrtaur ot4aeeomocias a2um( p;t4alxnmf3tytfpte nvslt t2urxopny1lme mnvia()aDur(mo;o0tpx iieiaslmDuan p;t0aetrxr oa1fmteaieslt0 rxo(r ny1op n nct t)aDuaumo;o1alxoio3ilsfmDrlnvo;u0aeeoxf iadoa eauvs;t  2um(o ou1lltnlfcsl(faDtaxmpno0opeomf3tatfsDumn o t)texnmr io1fa  au s;s)tetrim3iydamtnlnvia(f Drau  nt0tpeo oeiyt mDrmnvont)tlenif3todlat  u sls)s2xr(m oo1opeemfetas)artaumpot0aetomo3ilt a2rln s ()trermrcty1oaDeai s s setr(o oudopt mnetasf Dur(r nu1tpxn ieildfsDrlu o;t)tltoxr3oadfateln sl( trtoir oydalt lieils) 2uaxroou4tpt  ociasla2em( o (0aetnmfcoa1faDrluvilt)tetoio3no4lme liciat  Duau  no1aleoioeiytlm2rlnmpn(0alerif3ootlatelneo;()t2tm(r3iu1aptnmfeia()a2taxmpno1teenio3iyd aDul(ms;u) rtnmo3iydlat  uesl()truoxr nu4lmeemfvi tfa2trxm ou4olxn o3ils sDuanvp u)arerio3oydfat  nes t0 rxoimpnodamt  iesl( sDua(rono0oee mo3ilslm uanvo (4aexnmocio1omD aivols  rtrxrpny1op   fctltf ruru  nu4aetnmietadfaDra(mp;t4aeenxocoo1fatr nvi t0seumxo3oy4op nlneslt)a2ur( oou1oexomfcild s ulu ont)tetrmr iytomDeaiei;(0trxoxo nu1lmenlfctlt aDtrxm nt4tptnmi3iat m2rm(ms t4 rtrmrcia1omDeln il()trxm(mpoo4lm   ivilt  rrr(  nt1olto f3iasls el(vp;(0 rxnxoctatfm ran slt  rxoim3iy4lmeemnvtatfaDtm(mp;u0ape ioetyt m2emn o u0tlerif tadla eau i;t0sexrim ny4ol emfct (fsrtmxrooo4aex mi3tlsfaDuln p;t4aeenio tadlmt lues;( sexm(rpoo4ole lnviltf rumx p;t0tlen i3iad a2uaums;()altoir3iadom eliei;t s2tmxr no1amtemivslsfs2urumoou0tpxnif3iys s emn pn(0aexrxo3iytfmt ln s (0t2xriopnudop nmfet tfs2umuro;u1oet  i3tyd a uau o;(0 rtrifcoo1fpD lnes ()teuo(m3oy1lltelfes tfs2rau onu1apt moetad sDra( s;t0arenxr3ty1fm elivil()texm(o3nu1apeemietas s2tmxm nt0tee  o3ildfs2uauvo;u)tlxrirciadla ean s;t srxoiopnudlptnmnviltf Duax oot4tpxnmi3tlsfs uaums;t4tlerxfcoy1oa r iei s0s2urio ou4ll e ietltf rtru  nu4apxo feiadlm rau sn()alxoxo tatfaDe nesl()trxr(r3oo1apee ictas sruau ono1opx mi3iysls2umump;u4texnmr iydlmteln i;t)sexo(r3oy4om elici t)sDumxm ot4opxo oeiadfs ulnvo u0texnmocoadlm r n o;(  etr(rpio1lmte ietlt)s2uaumono1tet io3iatlm2rl(mp (4trtrmociatlaD lnvols s2xo(o nodomte nci t  rtmum nu1alt miciydfaDem(mp;(0arxoir3totfat anei;s)srum(mpny1omtelfcs tfsrumx ooo0aeen oeils sDra(mp;u0 renif totfm eaivi;s  etrxrpoy1apenlnvtltfa2tmxmpot0tpx moctydfm emnmo t0 etomf3tatlptr ies;t t2urxo nudlp n ivsltf 2tr(ront4aleniieiltlm2elnvs u0 eeomf3tadlm r uvils sexm(m nydlp nlieil(fs2umxmpno0oleoiictld a2em(mo;u4texoiociydopteaies;s) exmio3ou1amtemncils)srtmxm nt0oeeoiieildlmDrln o;(0alermf3tatfmD auvol()s2to(r3ou1om e fcsas)aDtr(m no1apt ioeild mDrlnvp (4altrmf3oatom raivs;t) rtrim iudamtnlicta(f rrmx poo0oexo ictls mDelu s;(4 rxnxocoodfpDrauvi;( seto(r nu1ap elncsls)arua(rpno4oex mi3iltlm2uan ont)texrmr tadfmD luei ( trumir nodolen ietas artrxr nt4olen ieias sDeanvo t4 leoircio1fatraivs ( srxm(o oo4lp e fetl( sDraumpnu0aex moeiydfs2rm( p t4artnifciy1omtr uvsl(0srtrxo no4amtelivilt arumxmpoo4apxomiciad aDrauvo;u) eermo3ty1lateanei t trxrxo3io1lm n feil() Dtm(m oo0aexnmo3iad s uanvp;u4aexomr iadopt luvs;s0 2xrimpiu1ame  fcs s)sDum(rono0oeeo o3tlsfm ea(vo;() reoir3ty1oat auvs;s texm(mpoy1om e nvi t) 2raur ;u0tle  oetydfa2emuvpnt4texoxrciatoaD ai s s) 2xmxm oydapte ietlt)s2um(mp;o4tltn octltlaDuanvp u4arenirciodoaDr u o s)tetrir nodalenmfcia( s2rmum ;u1aexnmoetyslm2ul(vsn(0 exnmf oa1lm r neolt  ruoxmpoo4ome mncil( sDtrxroou1oexnmoctat mDeln p;() etnmrctytopDr ueo;t0teumiopnudap nlncils s2taur ;t1oleoiiciasla2ulnvo u0 ltnxociydla  lieo (0 rumxr ou1altelivi tf Dtmu  nu4alenmiciysla2ea(vp;(0 etnmr3iotfp r uvs;(0 rtrxr3iy1ll  lfctl(  2tmurp;t0altnifciat a2elnms u0altomf3oytomtr nvs;t0trtrxr iu1ome mfetlt)sruaxm ot1tle ii3iasfmDel(ms;t4 etnxo3oytfp   ivs s0trum(rpnu4lp   fviat)arumxmono0texnmietysfa um(vs t) etrmrcoydlmDrli slt  2tm(rpno1omtnmfvtltfaDtmxmono4oeeomoetys m2ran sn() exnxr ta1fp e n s;(0srurirpou1om  lfvsa() Drm(rpou0opxn o3tyt mDulnms;(0 rxoxr oadlmD li o t)teuriopno1oltnlncslt)srtru poo4teeoiietls s2ulu s u0trtrif3tadopDr uvils)trxoxopnydomtnmics ( sDtmx o;o1alxomoeils a2umumpn() reomo3oytlp elnvols  etrxr iydale  icil()s2rmxrp;u0alxomfcias aDuan s;t)aeerxr tadlmteau o s)teto(m3oo1lpeelncil()artax  no4tltoioeiadfs ranmo;u)trxrir3tydlpDr i olt0 etr(r3iudlptn fcsls) rrmumono1ope  o3ilt s el(vp u4alxomo iytfaDrlnes;t trur(rpiodllenlnvs (faDua(mont4aptn f3ildls um(ms u)texrxf3tadlp ean slt) 2tm(o3ou1omtn fvt (f 2taxmp;t0aet iociytfa rm( pn(0arxniocoadfatrlueo (0 ruo(r iu1altn icsls  Drmx o;o1apen f3iadlm2ua( snu4 ltoiocoytfaD  neils  2urxmpio4openlicslt  rum(mooo4aptnmfeiatfaDulnmont4alxnirciytlmteln i ()trtrim ny4llt  ivtat) Dumum ou1oeenmi3tyd m2ua(vsn()trtomf3oatfaDeaneo;s) 2tm(rpiy4lm nlivsl(fa2tm(mpou0tleoiicildls rl( pn()tetomr3oo1omt  ivi;s srtr(o iy1op n feiatf rtmx  ;t4ale ioctys a uluvo;u0 exoxr iotlptr nvo s0t2umimpnudop emicta()a2rr(  nu0apeo f3tlt a ran s u4 exrxo tydom  lnes;s)trtrir3oo1openlietas) Drr(mpoo1oleo ietyt m ra( o;u0alenifcootoate n sls0 rxm(m3iydape mics (fsDuau pou1texn fciysfs ean p;() rerir3todom eaiei;()t2uoxopiudal n fvtl(f Drrxrp;u0oee  o3tadlmDrmnmo () ltrxo3io1lpD aueo;(0setoiopiydal nlnes t srtru pnu1oetoif3ilsls uln pn()texrif oa1oa elueo ( s2to(mpny4lp  lfetl(fartmumpou4alto feildfsDuanmp (4 eeoifcio1faDeau i t) 2umim3io1amt lfeilt srrm(m no4aexomfctatlm umnvp;t4altoir iadoptr neols  euoirpnu1omen nes sf Draxr no4oetn fetydls ranvsnt0arxomf tatoatelu i s) 2umxo3iy4lpe  iet tfaDtmxmp;o0tltn i3iat sDrlumo;u)teermr3oadlp   ivs (0 ruoxm3iy1al nlnvs () Dua(  oo1tpeo i3iys aDeauvp u4trerxo3ia1oate iei s0 rtoxm3ou4aptnmneslt) Draxrpot0olen oeild sDuau o;u4arermrciydoaDelnvs;()sruoxopiydlme  ivias) Drmu ooo1ape  o3iadla uanmp u0 etoxrctodoate u i;t0 rxo(m nydalt  feilsfsDumx o;o0opxomf3iltfm umnms;u) lenmo oatoa rli s;t)t2urxm3iu1om nlieil(  rtr(r ;t0apt  ictysls umnvo;(4tetrif ta1omDeluvol(0 rumim iydlle mnes (f rrr( p;o1tpeomfctas s eluvs;t0texnifcto1opDelu o;s0teuoio3nudopenmietl( arurum ou1aleomictadlaDulnmp t0treoirciy1fatran olt0t2umim oy1open fei s a2urur ;u0tle mi3iytla uln o;u4arxniocoytlp r i o s  ruoxo3oy4al   fcsl(f Duaxr ;t4aee mo3tltla2rmn o;t0 etnmfcta1lpt luei s0s2um(m3ou4optnlncsls)arta(mo;t0tptomictydfaDea(vo;t)tetrircoy1omt  nvilt) etr(m nodop  mfes s arra(rpoo4tptn i3ildfsDran o;t4arxrmfcoodfpteln s;( srtoxm iu4lpte fvslt sDtm(  nt1tpe  fetydlaDul(vs u0 ltnirciotlmtraues s0 rxm(r oo4alenlncsls srtr(r ;t0alen fetadfa2eln ont0arermrctotop r ivilt0 etrxo oy1opee ivil(faDtmur nt4apto o3tyt s emumsnu)teermfciotfateln s;t s2xrimpoo1om nlfviatf Duru  nu0texo i3tatlsDea(vsnt4 eenxfciatfpt aieilt0 rtoiopnydlpt lfct t)aDtrumoot4aet miciyslsDelu o;u4 rxnio3oydfp  lnvi s)t2urxopiu1ll  mivilt)sDuauroot1oex  o3iyd a uanvp u4altnmocia1faDranvi;s s2toim3no1ale  icslt)sDurum ou1aexnifeiasfa2raump u)aleomrcoy1opDrlueo;t) euoxr3iydam  mici ()aDtaur oo1teto oetad aDea( o;(0 ltnir oodfaD lu o;()t2xoxm3oo4op  liesl()a2taumpoo4tptoioctyd sDeauvs;t0 ltoio3to1lptelies (  exrirpoo4ope lfet s)sDrmurpou1oltnmietytfmDrlumsnu0texoxfctodfa eauvi;s) 2urim3iu1lle  netl()sDtr(rpnt1apxnmociytla rmnvo;t) etnxf3oo1oaDeli il( trum(o3oy4al  mies () rumxm no1apeomoctltfm2umn o u4 lenirciytoat  uvi;t sruoimpoy1aptn fvt (fartmxr ;o1opxnmoeilsla2emn o;()artnmocia1lp e uvol(0 eur(o iy1lleemfetatf 2rax pot1aex mf3iysfm ean sn() eeoif3io1fa rau i;s0teumiopny1llte ivt ()sDtau o;o1aetoif3tyt s2rm( on(0arxnmf oatfm elu i (0truoxo ny4al nmnesatfaDtrump;o0aeeoiietysfa2ua( o (4aeenmr3oatoa rlu i;s)t2xoio no1ol nmfvs tfa2rr(ront4tlenifctyd a2ra( pnu4teeoioctadoa elivo t t2xmio3oo1ame  ivtl( artmxm oo1aptnmoetas s2umnvsnt0 lxomo3oadoaD  i il(0sexo(r3io4apen ietat a2uru  ;t4aeeo ociysfs2elums;u4trtrmf ootfpDelu s s0 etrir oy1apt  fcias srumuront1aee mictatlaDel(mo;()alxnmfciytlpt  uvo s trxrxmpio1lmtelnct (fs2tmur ;o0aeeoif3tlt a emnmp t4aeermf oa1opD an s t)s2ur(o3io1llenlnesasfarur(  ot1tle ii3ilslm ra(mpnu)alxnmf io1oa rlneols s2um(m3iu4altemnes t  2rax p;u0open i3iadfa2rmnmo;t) lxrxfcootfptraivs;s)t2xrir ny4ope mfvt s  Drmu o;o0apt  feiltlaDelu p;(4tlxrxo3oy1oa  au ils0tetoiopny1alt livia()a2uaxr no0oetn ociydlm2rau pn(0altrmo iotlaDrlu o;s0t2xr(o oydop n fei tfaDrmxrp;o1teenmoctat sDul( o;(0 rxnircoatfp r nesl() rtr(mpoodol emnvtlt) rtax o;u1aleoioetydfs ulnvs;t)aexoxfctadlm ran s t)teuoxm3oo1al nlfviatf rraxro;t1oltn oeiys a rln s;u4 renio3oydfat lieo t) rxrim3oydapt miei s)aDtmuront4alt iietytlaDul(vs u) lenmoctydomD aivolt  exrir3no1lm  mnvsls srtr(rpnt4alto ietaslsDrm( o u4aetrir3tytfaDraues;( seurxm ny4ll e feia()artr(mo;o0optn f3tyd a2ranms u4texrmf totlmDeaiei s0trtoxr ou4om  lietlt)sDrrxrp;o0olxoiicilsla ua( o t)trxrmfctadopD aueilt) rxrxr nu1om nlnesatf rumx oou4aet mictad a rl(mp (0 leoio iy1oaDe uvi;() ruoio3ny1amtemncs t  rrmx o;o4apt  iciltfs2em( o t0 rtrxocto1lpD auesls  euoir3oodlptnmfvil(fsrta(rpot4oex  octat s ranvonu4tltoircoytfm ean s;( sruoxm3oudol  mfvtltfsDuru o;o0tetnifeiydfa2ua(vo;(4trtomf oatlmt li o;(0srtrio3io1lp nmnctlt srum(rpou4tlxn oetlt s raumsnt)artomrcoatfm  aieils) rto(r iu1amenlnviat a2ta(mo;u1aleomictat s2rlu o ()trxnxf totom ean ilt0 exmxmpou1om   fes tfa2ururpot0tpx io3iadfs2uan s t0areomfcoytopDrlivo;s0t2xm(r io1lmt lncsa(fsrra(mpnu1oexnmi3iydfsDrmu p;u4aeeomf iadfaDelnes t0trxmim3oy1lpte nci t)aDumu p;u1tet micildla uln pn()aeerircoodfpD aneol(0setoxm3oodom elietls)s2urumpnu4apxnmieiatls2umuvsnt4areoxf iytomtrauvi t0 2urimpoydlmt mfes t)arumx p;o0olx iictltfm rl(vp t)treomocoatfaD ln o ( srxm(r no1olen nvils) ruru  ot1oltomoeias aDemuvo;u)teeoxfcty1lmt  nvsls0srtr(o oy1om n ivi ( arururp;t1oeeomfciasla ul( ont0alenmo tadopDeaivs s s2tr(r3iu4lleemnvi s  Draxr ;o1opt iiciasfm raump;u4 lenmfctadoptranvi;t t2tm(m3nu4am  lfvslt)srrr(ront1aexomoeiltla rauvo;t4 ltrir oo1fmDrlivs;(0t2tmio nu4lm e ieils srtaump;t4tpx iieildfa eluvsn() leoifciotop r i i t sruo(o3iodopt licsl(f rtaumpnt0altomi3iydfs uanvo;u0tlxrmfciytfpteau o s  rtmim ou4oleeliei ( sDtr( poo4opx  ociysfaDulnmp;u)arxrxo3ty1oaDe i i t)teurxo iudol  mncta( s2um(ro;t4tle if3tatfsDrlnvp t)trxomfcta1la eauvo;t  rto(o3iy4llenlnetat) 2taxr ot4olxo i3tasfm2rmnmp u0 ltoxociatfmteauei;t)trxoxr iodalenmnci t) rumx pnu4oex  i3tysls ul( s u4 ltnir3to1la elnei t)tetrir iydlpeelictat  rumxm no0tet mfeiltls2raums;u0tetrxf3ty1omtraueo t texoxrpoudol e nvt ( a2rauront0tlxn o3iatfaDua( o;(4 eenioctydlp eauvs t0trurxo3ny1ape  fctls)sDum(mpoo0aee  o3tytfs rm(vs;(0 etoifcootlm raues;s0t2xr(opou4alee ivtat) 2ra(rpou1oltomf3iad m2eau o u4 reoxfciotlp rau sls) etm(opiydomt mfvs ( a2rm(rono0aptniociltls ea(mp t4trxrxociytlptrlnei;( trxmim nu1lmt  ictltfaDtax  nt1apt mfeiadfm2ulnvo;t4 ltrxo tydlp  lies;()s2tr(m3iu4op  lfvtas  rrmu o;u0aleoiietlslm ua(vo u4 exoif3tadoa  luesls) exmxopno1lmtelfeias)a2trxmo;u0tpenmoeiyd a2ua( o;t)tlerifcootfaD li o;t0 2toio3iydlpenmnct ( sDumxr nu1tee iiciyd aDel(mp;t) etomf oodlmtr ieol(0t2xmim ny4alee ivt tf 2trumoou0tetnmociadls ran p;u)altrxfcoa1lpt auei (0 rtrio3oodll elfeta( sDuaxr ;u4opt  o3iasfm umu o t4aetomocoodfptelivs (  etmxrpno4apen nvs s srtrx ooo4tpeo feiasfmDua(vp u4 eeomr3iydomD  ueo;s0 eum(r3oydlpt mfviatf 2umuront1oexniiciadfs rm(vsnt)treoif3iytfptranvs s0 rxoim nudamen nctatfa2trxm oo0aexo oeiltfs rau o u0trermf ootoa   n o;t s2uoxrpoo1apt mnvi s)aDuaxr ou4opx  ictyd sDrmnvo;() eenir3iy1la   n o;t)texoxo3oy1omeemnviat artmxm ou4tpxomieias a2ua(monu4 exoif tatfpt  uei ()tetoirpny4ap emicsltf Dtm(rp;t1apen o3tat a2ea(vsnu0 lenif todlm eluvilt tetoim3oy4amt lfvsl(f rrmx o;t1oee mieiysfa eaump;t0tltoio3iy1op eaivo;( s2trxopny1llenmfesatfs2tr(rooo4tlt  ieiydfaDemnvp u0aexnxocoy1lm e ivs s s2tmxmpny1op  lnetl( sDtm(r ou1tptoifetlslmDemu o;t)aexomr oa1lpt lieilt) exo(o iy1apt  fcta( srtmurooo1tlenmo3iadlm um(mo;t0aetrir oodfm eai s;t0srtr(opno4olenlivtat)a2tm(r nu1aeeo fetasfm2umumsn(4trxrmo3iatlmD lnvo;(  rumxm3iu1opte icta(fsDrm( pou4tee  oetydlsDeln s;t4aetrir oadlm raieo;t)srumir oo1olt mnvs t srtr(r no1tee ii3tatlm eaumo t)alxrio3io1fmD lu ils)trxr(o nodlmeeliet sf 2um(mo;o0oex iietldlmDelump;u4trxnmrciadla  aieo s) 2uoxmpoudllee fesa( a2tm(r ;u0ope iietatfs umnvo u)arxrio oydlatranvi;s)t2uoio nodllenmies s)srururp;t0tltn feilt s eanmp (0 exrxo3iatoaDeai ils  exmimpiy4op nmfvslt a2taxro;t4alxnio3ilsfsDeluvon(4 eeomociadla rau sl()srtoxr3no4lp e ieia(fsDrru o;u4tlen f3tydlmDua(mont0aexnmf tydopD  nvi;s) 2xmir io4ale lfes (fsrtm(r ;t4tpt ifeiysla2eluvont0 ltoioctodoptranesl(0s2urxr oodam elfvtlt  rtr(mpoo1oltn iciytfaDraumpnt)tlxrxocoo1laDrluvi;(  rxo(r iudlmt  nvi s)s2ra(m ;o1ope  fciasla rauvonu)trerio3oadfm eauvsl(  2trio3nydope  ieta() Dumuro;o1tex  icildls2el(vo u0altnio oo1lmtrliei;t)s2tmxmpnu4aptnmfvtlsfaDtaxrp;o1ape  iciysfs el( sn(4 exoifcia1fmtr uvs;t)setmxr nu1llenlicia(f 2ua(monu0opx iietysfsDemuvpn(0 eerxrctytlp elues;s0s2ur(r iudlme lfeil(  rumxroot1tlxn feiltlm rl(ms;t0 lenxo oytlptranvs ( trtoxo3oo4lltelnci tfaDrmx poo4tlx io3tytls ran s u)artnxf oa1oaDraies;s)trxr(m3ou4ll  mfvsas  rtmxro;t4aexo iciysfs2eauvon(0tlxnmfciodfmDrli sls)texm(o3nu4ol  lnvta()a2taxr nu1openmf3tad sDea( s;t4aetomr oytfpDrluvs t)t2uoir ny1oleemfciltf 2umxm no4tpxnmicilt s emnvpnt0 eeoio iytla ean i;s0s2ur(r3io1ap emfeslt) 2umxroot1tpen ietatfa2uluvp;u4 exrif totlm  livs s0 eur(mpiy4lmtelfetlt  ruaxmont1ole  fciadls ua(vp;t)teeomf iytlat aivsls)t2toxm3no1ame  ictl(fsDrmu poo4ole  f3iys mDra(ms t4 rerif oodlm rlu sl(0t2umio3oodom emivtas)sDur( pno0oexn oeilsfa el( pn(0 lenir oa1fm eau s (0 2trio3iudlltemicslt  2rrxrpnt1tpe  octys m rluvp u0 eenxo3iotfmt  uvsl(0 rtrxr3ou4amtnlfes tfaDrmuro;o0oet  i3iyd a ranmon() rxoir iydlmDelu o;t  2um(r oy4olee fet t)artmurpot4tltniociasfa2elu o;t0teerif3ta1oaD lu il( tetoxmpiu4al emncs sfsrtrx ono0tlto f3tlt m2eauvon() rtoif ootlmt anvilt srxrxo3io4ope  ici ( sDrrxro;u0teen fetas s2rm(vs;u)trxomo3oadfp rlneo s seuo(r3ou1ol  lics sfsDta(r ;u0aetn ieiytfm2ean sn(0 lenio3iatomDeau i t0seumirpiudlp n fetl(  2ta(r oo1open feiad s2ulu snt) ltrmrciy1omtraies t trxmxm3iy4lp  lncsatfaDurxr ;t1oexniociat sDuanmp u) renmo iy1op e nvi s0 rxmio no4optemnesas) 2rmu  ;o4alt moetatlsDrmnvsnu0 etrifcoo1lm   uvsls0t2umxm3iy4amenlfcsat s2urxmpou4oex  i3iatlmDrlnvo u4 eeoxo3iadomDraivil()s2xr(o3iu4olee nesasf Dumxro;t4texniociatfm2umnvs (4aetoxociytfa e nvslt s2xrxo3no4oleemfvi ( arra(ro;o1oee  i3tydla2ran p (4trerif to1fm  anes;(0 rum(mpnu4lm emnes ()artrxm nt4tlx iociadlmDemums;u4tlenmo oodoaDeln s s  rtoimpiu1ole mivils)srumxrpou4tpe  feilt m eaumpn(4 lxrir tatlat livol( s2xmio3ou4op nlfvtlt)a2umumpnu4teeoifeiltfm2rmuvpnu4 lenmocto1opDrli i;t t2xo(r3iy1lpe  nct ( sDua(mpou1aexomiciatlaDuanms;u)trtoxfciydlaD li i;t  rtoirpoy4ame mnctat)s2tm(m oo4ape  f3tatla eanvp u4aetomr3ty1fmDr uvi;s)s2umiopoo1am e fvsa()srurxmoot1olenii3tysfmDea(vpnu4aeeoir3tatfm  anei t0texm(o3iydlm elnvtat aDurxmp;u1aexomicildfa2eanmonu)tltoxf3tadomtelivsl( trum(opnudlp emict t  2taxro;o4oetoiieildfm emuvonu)arenxo3oydfate neo;(0sexr(m ny1ol nlivt ( a2trurpou0opeo iciasla2ranmpnt0arxoir3oadopDraies;(  2toir3oy4lmtemics s) Dtr(m ot4teenmoctldfa raumont) lerio3tadlptran ils0 2umxrpnudom  lfetat  Dta(  nt4tee mfciatfa2ul( o t) eeomr tytlmtr i i s s2xm(r3ny1al elfct (f rraumpoo0tpx  o3tyslm2uluvpn(0alxoxf3iodlm   ivo s)seto(m nodomee nctat)artrxro;t1texn ieias sDrln o u0tetoifciadla r u i;s tetoimpoo1opte nctlsf Drmu p;u4optnmfeiytfa uauvonu)aetoir3ta1om r nvi;s)setrirpnu1lpe  icilt) rtaxm oo4oeeniietldfa emn p;t) eeoiocoatlp ran s (  2uriopou1ame mnctls)a2rr( p;o0ole mfciyt a2uau p;() rtnmo3oa1lpteaiei s) eur(mpio1ape  nvsl( a2uaur ;t4opeomf3iat m2rl(mo;u4alxnircoydom rln i;s  rumim3nudlmenmncsa(fsDtm(mo;t0oetoio3iysfmDulu p (4tltoifcoytlatraues t  exrirpou4al  mict s)srtrxmp;t1opeomieilsfa2el(mo;(4 ltomocia1fm eluvols  rxoxm3iu4lpeelneta(  rumumont0oetnifeiasla2emn o;(4trerxfciytlm  li s;(  etoimpiy4lp nliet s sDra(m ;u4alxnmfetadls ea(vsnt0aexomo totfpteaueo;()teur(opnodaltnlfvs (  2tru ono0apt ifetldfm eanvs (4 reoiocoatomD  ies t) rxmxr3ou1lltemivtlt  rraxm no4tltn ociatfs raumo;(4alxoif3iydoatrauvs;s) rumim3ou1om  mnvtltfartrxmono0tlto f3tlsfmDelu o;t)artrmo ootlpD aieo;t) rtrxr iydopenmivt s)aDrm(rpou1tpxomfeiadfa2ranvpnt4trermr3oadlat au ol( srum(r oudlm elnvta() 2uaxroou0tpxomoctasfs ulnmo t4tleoir oatoateanvsls0trumxmpiy1amtn feta(  Dtmxrp;o4olto fciyd aDeau snu) rtoif to1lm eaivi (0setmxm3ou1optelieia()arrruro;t1tex miciytfaDrmuvo;t4aetriociodfateliesls  rto(m3oy4lpeelfetat a2tr(  oo4aptn feilsfa eanms (0aexnxociodfpDr u ol(0seurxo3io1ol   feilt  rrr(  no4tle  i3ilslm el(vo;(4tlxnxf iotop elnvs;s  eur(opiy4omt  nei tf rua( p;o1tpeoiieiat s2umumpnu)tlxoif3tadom rlnvo;t0sexmxmpiy1lm  lfetas  Durx pou0oeeomoeiasls2eanvs u4 lxrxo3tadfaDrlu o (0seuoxmpoy1lmeelieias)srumx  ;u0tlt  octltfa uanmo t0 exrio to1op raivs;t)s2toirpnydape lictat) Drrur nu1tex mieild aDrau ont4tetrmfciadfa r n s;t)s2uoiopnydlmenmfvs ()srtaur no0oleniiciltfs2umuvs ()altoiociatop  luvo t t2xm(rpnu4olee ictls)srtrx pno4tetniociyt s2um(mp;u0arermo3totlmtrauesls) rur(r oo1al e icsat) Dtmxmp;t1olxoifeiatfaDelnvp t4arxnxr3tydopDraivi;s  rto(rpiy4lltnlncta( srumu o;u0tet  ociadlm2eln o;t4tetrif tydfptelu slt0 rtoim iu1lmtn fetl()a2urur nt0aptomoeiad m elnvsnu)teeoirctotfatr u ol(0srum(m oo4lm n ivslsfa2trumonu4aexn octltfs2eln p u0 rtoif iotlptrli o s)sexm(m iy4om  lfvsas arur(m nu1tet mieiadla rlnvo;()trtrmr3oo1fmDelnvi s srur(o3ou4lpen nvsl( sDrmu  ;u1tlxnmoctyt sDumumo;t0 rtnxf io1lpDr n s;( srtmxo iy1lltemnvtatf 2ta( p;o0alxn ocildfs2eln s;()tetoircto1opDrlnes t)s2xmiopny4al  lfes t a2tmum ;o0aet ii3tas a2ea(vo;t)alxomfcoy1lmteaneols)sexr(m3iu1alee iciasf 2tmxm nt4alenioeiatfm2emnvs u4tltrxrciatoaDeli ol( srumxopoy1omt lfesls)s2ra(rpou1tetniociysfmDum(vo;(0tetrxrctadlm ean sl(0 rtoxo3nu1lp   fctl(f rraump;t4alxn fctasfaDuln p;t0 lermoctadfmD lnvi;t  2urxm3iy4lpeemieias sDrm(mpoo4oex  fcias aDelumsnt4trtnmocoa1opDrlivs t seurir iudamen fetat s2tm(m oo4aeen fctatfa2uln s u)tetoxrcoydfmte u i;t teurxm nudoptemictl( sDtmum oo1tptniicias m elnvpnt0 lenmfcoodop rluvols0teumim3iodlp emnei sfsrta(mpou1altoii3iytla umuvp t4 ltnxfcia1fa   neslt0t2tmxm3oo4ale mnvta(fsrrr(roou4tpxniociltlmDelump;t0aeerio3iydop e ieo;t t2toxr oydomtn ietas sruaxmoou0tet iieiltlm uluvpnt) ltrmfcoy1om ranei;( t2uoxr3oydomtn fvia(  rraxr ot0aleoio3iaslaDea(vs (4 lxrxo3iytopDrli ols)teum(mpnudlpenmfvia(farrax  ;t4tltnioetlsfs2ul(ms ()aetrmfcta1lptran s t0 rurxm nu4alenlictat) 2umxronu4texoioctasfaDrmnmp (0aetoxr ta1fmD  uvo (0trurxm3nudom  lfvilsf 2uru o;t1tpxnmf3iadlsDelnvp u0trxnifcoa1faDr ues;s)srtmxo ou1al  mivsa(f Duax poo1aptoioctlslmDuauvpnu0 lxrxf3todom e ueo;t0teur(o3ny4ale lfctls)sDtaum ot4teenmi3tadfmDuauvo;u0 etrio iotlp rlnesls  exriopiudolt lnesas)s2tmumoot0apx mfetlsls ra(mp;t)altoxf iytop eauvols srxo(mpnudlptn icsa(fsDrru  ot4opx moeiys s2ul(vo;u4 exnmfciytlatelueo;(0t2tm(opnu1amenliciltfs2ur(mo;t1oexnifctydfs2rm(mp;u4 rxoxfciydla eauvi s0 2urxrpoo4om nlictas)a2ta(mo;u4oeto ieiadlm2eluvs;(0aetriocoy1lm e ivs;s  rxo(mpio4lmenlfeslt) Drrx p;t0olenifetat a ulnmpn() rerxociydfpt lieo t sexmio nu4amt lnctat srrau o;o4altn fctaslm2um( sn()arerxo tatlaDeai i;( truoxrpnu1omenmict t  Duau  nu4aetn o3tydfaDeanmonu)tetomf tatfatrai o;s  etoxo3no4ope mfvi ()sDurur ou0tltn o3ils m eanmp u4tlxrxr ta1opt  iei s)teuo(m3oudap emnct t  2umxr ou4texomo3iltfa2raumpn()tetoxf3ootlmt an i;t0 2xm(m3ou1ol emfes s  rtmxro;t1opx ifetld s rln o u) rxoif3ia1omDeauvs;t)s2xrir oo1lltnliet (fa2rm(rooo0alxnmietyd mDrmumpnu) eeomocoo1late i i;(0truoxo3nu4altnmiet t)srrrxm ;o0teeomociysfs2rlu snu0trxomr oadopte n s;s  rumir3no1lle lfcs (fa2tr(  nt1apenif3tas a uau o u)alxnir iytlat auvs;t t2xrio3iu1altnlivtlsfaruaumooo4tpxnmoctat a rmuvonu) eeoxo3oatlmDrlnvils0setrimpnudlm e fetas  rur(r ot4tpt mietls m rau o (4arerio iydfm   n i ( srxrxopno1lmeelicils s2rr( o;o1tet mictyd a2uaums;(0 eeomr3iadopDe ivo (0 2tmxrpoo4ome lncsa()a2ra( o;u4aptnio3tas a rlu snu0alxoir3oytla ean i t  rtm(o3oy4lm elfviatfarta(  ot1texnmoeias s2umumo t)aeenmf tadomDe ivils0setmxmpoy4lptelici t srtru onu0alxn ociysfa umnvpn(0tetoxo3iytlptr ivo ( s2xoxrpoy4aptn icil(f Dtrxrpou0apxoifciasfa2elu p;u)trxrmoctydfp  lies s) 2xrxo3oy4llt mnesas srrrxr oo0oex  feiysla2uanmo t)alenir oydoaD livi t s2umxmpoodllt  fci ( s2um(r nu1ole mfeild m2rln p t)altoxo3tytlm e nvi ()teum(r3iu1lmenmivt tfarrr(  nu1ape iociadla2uaump;u0 exomrcta1oatr u i;s0srxoio3ny4omenmnet s srururpnu1tpxomi3tld sDelums ()alenxrctotfmtraies;t) 2toxo3oy4olee icil() rrrurpot4apxnioctls aDuln on() lenmf todfpDe u o (  rtrxo3iu4aptn ici s  rtaum nu0tee iocildfsDum(mo;t4altrxfcoytlm ean ols0trxrxopoo1oltelfcsls a2tmum oo0apt iieias s2el(mp t)trtrio ia1oaD aueo s sruoxmpno1amt  ivil()aDum(r nu4altoioctlt sDrm(mo;u)altoirctatlatrai i;s texm(opoo1om  liet s sDrrx  ou1aee io3iad mDrlnmsnt0aexoio3tytlm eai s;s)s2xo(m oydapee ivils)arur( o;u4ole if3tltls2um(vsnt0 rxomr3iadlm e nvol()trxmirpnydlmee fvils)srrmur nu0optn ociadfmDrmuvo u) ltnif3iy1fp e n ols0 rumio iy1om nmnciat  rrau pnu4aexoif3iaslmDemn p t4teeniocoatop  aueo s0s2tmio3ny4olt mnetltfartmu o;o0apxomfetlsls ra(mo;u) lermf3iatfpt livo (0 rurxm3iudamt miet t sDrmx  nt4tpxoifciyd mDumnmp u0areomr oodla ranesl() rumxm3iu1openlnvtas) Drmur ;t0tleniieiatfmDea(mp;u4trtoif3todla r n i;t0texr(o oo4ameelfet (fsrrru  nt0oeeomociatlmDea( s;(0aexrmfcootlaDe uvslt sexm(m3iy4olte iesatf ruaxmpno1alxnmiciadlm2umn pnu4arxrxo todfpteau sl(0srumio oydole lnvias s2uaumpoo0apto i3ils a rlu o;(4 ltoxr oydlpt aueols s2xmxm3iodlp nlfeias sDuau oou1ape mo3tls mDeaumo t0artoir3ootoptelu s s0truriopoy4olen feslsfaDtaxr oo1tpxnifetyt m2umnmpnt4aeenmo3todop rluvslt0texo(m io1ap nliei sfartaxrp;u0apxnmociys m rmnms;t)arxnif iodfmDeauvi;s trum(m3nu1omtn nei (faDtmumpnu1aexoif3tydfm ua(vo;t)aexoxf iytomDe i i s)srumxm oo4omtn nesl()arumu p;o0texoifctyslm eanvp u0arermocoy1opDeluvi;t  exoxm3io4optemnvtl() ruaur oo4opxoif3ildls ea( s (0aleoxr3tydlpt  iei;s0t2toxo nydom elfetat)artr(mont4olxoii3tatfaDrmn o;u0teenmf to1fatraivilt0 rxrir iydlpenlivs t  Drr(mo;u4opeomictldlsDra( o t) leoxf3totoaD an i;(  2triopoo1omee ietls) 2umxrpot1apeomo3iydfmDumn p;t)aexoir oatoptrlieil( tetrxo3io1lme lfvtas) rumxr ;t4teeo fetlt aDran p u0 rtoio iotopt aues;t s2xr(o3oy1ole mivs (fsDraxr nu4optoifeiyt mDrmnvs (4trxrmrcoa1omDeluei s)trxmiopiudape lfei s aDra(mpoo0optnmo3iad mDulu s;u4tleoir iotlaDrln il(0 eumxo oydop emies ()a2rrxro;t4alxnioctlt mDea( o t0 exoif3io1laDeanes;(0t2xmiopnu1omeemicias a2uaxrpnu0olx  o3iydfm2ra(vs t0alxrio oa1omDr neo (0s2xrir iudlm   iesat)aDur( ono0tpxo o3ias a2ean s;t)tleomo iatoa elueolt) exr(rpiydalte iei ( aDraumpou4tpe  fctatla2uln s (0 eerir oodfpD  u i;t)t2uoxopoy1llt lfctls a2taurooo1aptomfeildls2ulu p t4 exrmf3io1fa eluvo t  etoxo3oy1om  lnesas)srum( ono4oexo o3tldfa2ra(ms u)arxnxf3tatfatr i i s0texrim ou1optnlfcil()sDrau o;u4texo icilsfm2uanmp;t4arxrxo3oo1la  lu s t0 etrxopno1lptn fetat sDrau p;o4aptoiieiltlm rl(mpn()tlenxo3io1lmte n ils  ruoxm3iydll e ictl(f rua( onu4opeo oetas sDuanvo;t4tltrio iodla eli ol()teuoio oy4am   fcia( aruaxmo;o4olxnmi3ildlaDul(mpnu)treoir3oadoa ran o (0 2xoio nu1ole mfviltf 2rmxm nt0alx ioeiatls2rl(vp (4alxrmf3iotlpDe u s;s0 2uo(r oo4llt lnci t)s2trx ont0aetn octlt sDea(vp ()alxnir oodoateln s;(0teumim3oudom elieilt) rur(ro;o1teeniieils m2rln pnt0 lxriocoatfpDraies;t)srur(m nodapt livsa(f 2rrx poo4oet mietytls2ul(mo;(0 rxnmo totopt  nvil(0 exrxrpnu1om n fct ( s2um( pnt0teen ociydfm2ra( p (4aleomf3iadoatelnvol(0srtoxm3iydape  iet t) 2tmx  ou4tetoif3iat s rmuvp;u) lxniocoadoat an s t  euo(m nydole miesa(fartrumono0alxomieiydfs2rl(ms;()trermf3tytop rai sls t2tm(mpnu4ol   ivt s) Dua(mpoo0oexo oetydlm2ra(mo;u0 leomf totom eaieo;( teto(m iydlm emnvi t)s2ta(rp;t1alenmi3tatfa2rmu o t4trxnio3tydlm eanvsl()trtm(opoydopen fvsas)aruax  oo1tlto ietltfm ranvs;t)artnmocty1fptrlivo t0t2xo(r oo1ame mieta(fs2trumpou0olx if3tydlsDuan sn(0areoif3ty1fa  li s t texrimpny4lme mivsl(fartax ooo0tptomi3iysls2rm(vonu4tetoir iydfatrlnvsls0trtriopno1lp  mivsl(f rtr( pnt0tlxo feild sDel(vo t0teenxf3oo1lp  li olt  rtm(o io1ol   neil(faDrmxmpoo0tltoifeiyslaDem( s;u)texrmf3tytomDraies t0 2urxo io1olen nvsls)aDum(ro;o0tpxoifeilsfa ulu p;t4 exrxocio1fmte ivi;s)texo(rpou1am nmici t srurxmonu4ole mo3ild a ulumpnu)tetrifciy1opDrli ilt)t2tm(opou1ll   ivils s2taur oo0tltn fcilsfm elumo;t)arxrxo iydlmtr nes t trtmirpny1altn fctl( aDrau  no0apeomoctldfsDrlnvs;u)aexriocoa1fa  ln s ( trtrim iy4omtelnvsltf rtrx p;o1oeeniiciasfm rmnmp;t) eenmfcta1opDeauvi s)sexr(r3ou4am emfctat a2um( p;u4texn fctydfs eaums t)alenmo oodoateluei;s) 2xm(mpno4op nmnctls) ruauro;u0tetnmi3tas a elu snt0 rxnmo3ootfptean sl()s2urxopoo4om nlict s aDrru pnu0opxnmfetatfa uluvont)trxnxf tytlmt anei s0s2toxm oudll   feilt  Drmu pnu1tlto oeiysfs um(vp;u4alenxr oy1faDrai olt0texrxmpoydomte ivi ( artau poo0oltoiieiasfaDulu pnu4 lxrxo iodop e ieils)t2uo(o iy4am nmivia( srumumpot1apeoiociatla ua(vo (0aeerir3tadfpD  ivsls trum(rpiydolen fei t) 2rmump;u4apxoioctas m ua(vpnu0artnmo oo1oa r ies t s2tmxr3oy1lle lieilt  rraxrp;o1opxo oeiytfaDelumo u4 rxomrctotopte u o;t s2toxmpno4ll   ics s s2rmxm ;t4tpeo o3tas aDrmu o;u0 lenmf3tadfa rluei ( srtr(r oo4ome lieias) Durur nu1tlx ifetyt a2rl(mp;(0 ltrir oodfpteaiesls tetmxrpnodomeemivia( aDum(r nu0tleniieilt sDulu pn()texrifctodlpDranvs;s teurirpiydlltnlfes t)arrru  nu0oexomictyt m2rm(vsnu)tlenxo3iodfm e neo;t texoxm3oodapt  ieiat)s2raxmo;o0oleomf3iydla uaumo;u) lerxf3iy1oate n ol(0 rum(o3io4op  lnviat  2rr( ont4ole mfeils a elums u0trtnio oatopDraneils srtmxm3iy1om n icilsfsrtmu  ;t1oltn ictydfmDemuvsn()aetrmo3oy1oat  u s;t) eurir3iu4ap  lfet tf Drmxr ;t1apenio3tatfs rlnvo;t0alxnmr3iadomD  ieols seto(m3io4lm nlnci t)sDumxmpnt4ale mf3tytla2ea(ms;u4 ltnmr3iodlaDe nes;(0s2toio oy4amtelivils)a2trxm nt1teenmociytfsDuauvo;u0artrmr3oadfat au sl( tetmxopoo4opte iet t) Dtm(m oo1olxnifeiytfs2ea(vonu0alxrmrciytfm  an i t0 rurxo3nodap nmfet (fsDrmu pou1olxn f3tyt s ra(ms;t0teerio to1fpDe n s s)s2xoiopoudoltelivilt)arrmump;u4oetnmictld sDrm(mp t4aexoio oadfp  luesl(0 exm(m3no4op nmfei s)a2rmu p;o0tlx  f3ias sDrl(mpn()aexrxo iytop  li ol()trtmxm oodoptelivtat) rrmumpot0oet mo3iydlm umnmo u4aetnxfctotfa e iei;s0 eum(o oy4op elivt s)arurxm ;u4apxomoetltlm2ranms u4tltoxr3iodlm r i olt)sexmxo no1ope  ncsl()sDumum nu1tpxnifciyd m2eanvs (4 ltoxo ta1oaDraneo t) ruoxrpiu4ap e net sf Drrum ;u1oet iociytfmDea( s (0 lxnxo3iodopt lnvs () ruo(mpoy4om n fctltfs2tmu p;t1optoio3iysfm emuvp;t)aeerio3iytop rli ols0trxm(r3oy4apeemfvia(f Dum(  no4oexn ictadfm emuvo u4tltoxr3iotfa eaues t teuo(mpou1amenlfctat) Dtaxrp;u0aptoioeiltfa2elu o;(4teerio tatoat auei s)texm(m nydlltnlneias  2rmx  oo4aeenifctadla em(vpnt) exrir3oo1fate n o;()t2umir3ny1amt  ivtas)aDrr(mo;t1olto i3iydlm2umn s t0teermrciy1opte nei () rumxrpoudllt  ncta(f Dta(r ;u4oetomietyslsDulu o;u0alenxfciatomDeau o s)t2xmxo3iodlme mfes ( srrmu ooo0aee iiciadfaDrl(von(0trxrxfcoatfmDe ueo;s texmxr iodalt lnci tfaDrr(root1texn fcilsls ra(vp u4 rxrir todlmDean o t0s2tr(o iydlmtnmictas aDrax  nt0apxomf3iltlsDelnvo;u)trxomf iodlm rai i t0 exoxo iodap nmneil(f 2um(m nt0open i3iydla eauvont0tlermr ta1fp   ies ( s2tm(r3nodaptemnetl(fsrum(rpno4tlx moetas s2ean o;t0aeenif oydlmDe ueo t0trxm(r nydopenlivt tf rta(rpnu1ole  feiatfm2emnvpn(0trtnio ty1fm  lu i (0t2xrio3nudlp  mfct ( a2uaxmoot0aex  fciydfs2emnvo;(4 etrmf iy1oatr i i;()t2trxopoy4ape mnvtat sDururp;u4ole if3iyslm2rln s u0texrxfciodfmtr ieo s)truoxo oo4lp   nesl( arra( onu0olx iietytlaDeanvs u) rtomf todfm  lneil(0 eumio3nydol nmnci ( srtmxr no4opxnmfciltfs2rl(vo u0aeermfctytla e uvo s0srumxo nudopt  icsa(f 2um(mpot0olx iiciytfs uaumsnt0 exrio oydom  lueo;t)srxrim3oodol   fviat arrru ooo0aex  f3iydfs2u
\ No newline at end of file
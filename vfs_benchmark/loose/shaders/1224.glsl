@@ -0,0 +1 @@
+ivs t)srtrxm nu1opeelnviltf rtrurp;u4tpxn o3iadfs2ranvs;u)arenxr3ootlm  au s;(  rur(rpnydalte fcs (fs2umxr ou1olto ieild s2eanms;u4 ltrmr tadfp e u ols0tetoimpou1ll n fctl(fsDta( ooo0aeto o3tad m rluvonu)arxnxf3ty1lp rlieols  2xrxrpiydomt liet s sDrmx  ou4opxn oetyd a2eanmon(4aeeomf3tadfa raivi t0trxm(o3oydom   fci t aDur(roou4aeeoiictlt m2eanmsnt4 exrif3oytom eln sl(0teur(r oo4amtnmncsa(f Dum(m oo0optn oeiasfm2ranmo (4tetrifcto1lmteln olt0sexm(rpiu4ope  fvi t) 2uru  ;u4ope  ietydfmDrlumo t0aetoirciadlmt  n olt0s2toiopou1ole lfcil(fsrumump;o1aee mfciys aDel( o;u)tltnmf to1fmDr i o;s)sexrxmpnudamtemicils artm( pnt1tpenmieiytla eanvonu)trtrxf3oadfaD au o t0srxo(r iy4om elivt tf 2uaxr oo1apeoiietytls rluvp;u0aetomrciatfptrauvs (0trtm(mpnu1alen nvtl( srtr(ro;o4tptnmoeiasfs2rmn p;t0tetomr3oytop r neol(0texr(m3nu1lmenlictl(fsruaurpoo4tet ii3iydls2uln sn(4tltrxfctatoaDr i sls0 etmir iu1lpt  nctas)srtr(m oo0alx iicils a rm(mont4alxomfcoa1lmt ln ilt0 exmir nu4ll emictl(fs2rmuro;u4teeomi3ilt m2rmn s ()trtnmfcoodfat auvol(0 rum(r io1apt livta() rta(moou4tlen oetyd aDelnms u0 ltrir iodlpDrli i;(  2tr(m ny4optnmicslt)a2uaumooo1altnmictyd s2raumsn() ltnmf iydlatran ilt0 eum(opno1amtnmivi tf Dra(mpou0tlt mieiad a2elnmp;() lenmo3tytop   nvi t)t2urir3iu1lpt mnctat aDrm( pno4aleoif3tltlsDeaumo t0arxrmr3oytomD aieolt0 2tmimpoydom   nvsltf 2tr(rp;u4teeoifciltls2rmums t)altrxrcootfp eluei;s) rtrxm iu4openmfet ()arraurpnu0tptniieiasfs ranvo;u0tltnmocoy1laD auvs;(  2tmxrpio4llte ivsls)a2rm(ro;u1tlx micildlm uaumo;() ltoif ootfm   ueo;t0srxmimpno4am n fvsas s2tmuronu4tle  octad s uln p;u4artrifcoa1fa eliei ()s2um(o3nodlptnmfci sfaDta(  no0apeo octysfm umnmp ()teeoio3oadfpt  n s;s)srxmiopio1lltnmfcsl()artau  nt0aleomictltfmDranvo t0 exomfciydlpteaivs;(0 etm(r3nu4lmte nctasf Dtmurpoo4opeomfciysls ul(ms;u0 rxriocta1oa elu olt tetriopoudaltnmnetl(  Dta(  oo4oltoifeilsls ea( o;t0artomo3oatlmt aieo;t)s2uo(o iu1lp nmieil(  Dtaxrp;u0altn i3iyd s2umums (0 etomo3ia1late i slt0t2umio3nu4amen fvtlt  Dururpot4ale ioctltls elump;t0aeerio iodfaDelnei;s t2xmimpiu1ope mictl() rurxmont0tltn oeias a2ra(vpnu0 etomf tadlmDean slt) 2xm(r3oodlltelncsls) 2ta( oou0tleoiieild mDrmnms;u4aetrxocoa1laDe ueols srxmim3oo1om n icsat  Duaurpoo4tpeomi3tytfaDrm(vo;t)alenmf3ia1fm e u s t) 2uriopoo1open nctlt  rur(mpnu4ale ioeiytfsDemumont4 renxf tydoaD aivi;( trxmxo oydame mnvt s  Drrxm ou0opeomf3ildlaDea( p;t0 etrir oytfpDean o s) 2xo(o3ou4lmtnlfvi s srrru pou4oltn iciatlaDea(mp;t) reniociotfmt  nvo;()teurxopny4lm elivsa(f rta(  nt4aetniieiasla uluvp;u4aetrio oadfm e ivi;t0 exoir3nu4lpt  fvia() rurx onu1tltnmf3tasfa2rauvs t)trxnxrctatopDeaieo;s0tetrirpoy1ol nlnvtas)s2tm( pnt0tltnif3iaslm ua( p;u4 ltrxf ia1fmtranes t)truo(r3iy1alte nvi s a2ta(mono1alx  octyt m2rlumonu0 reoif oy1fpteanvs;s)s2urir3ny4omen ies s)aDta(mpnu1opxnii3tasfa2emuvsnu4 etomrcootlmt auvslt  etrxm3nodop elnvslt) rtau  ;u1apxn o3iysfaDumuvo u4tlerxrciotfptrauei t0 rxrxm3iy4lpenmnvsa() rrrx pou1tlxoio3tls s eln o;t) renxo iy1laDr n s s  rxo(m ny4omt  nvilsfa2ur(m no0tpt mietltlsDem(msnt0tlermociy1oaDeaivols s2toir no4apee netlt  Drm(rono0tee  ietydlm el(ms t0 eeomf iodfm e uvi;t0srxm(m3no1lm n iet ()sDtmxro;u1tlxo fciat s um(msn(0alxnir3ia1op r ivi ( sexrxm3ou4lltn fcilt  Duaurpno0oex  o3tlsla ulnmpnu4tlxomfcoodfptrlivs s0 rtmim3ny4ol e fcsatfsDrm(rono4oee iocildlmDrln o t0alxnmrcoatopt auvs;t0teurimpoudope  ncta() Dtmx  ;u0aetoio3ilsfmDelnmp;u0trtrio3oa1lp eln o;s0t2umir3ny1lltemnes tfs2trxmp;t1alxniociad aDuaumo t4altrxf iadlmDe ivo t0srxo(r oodopt  ivslt)a2rmx p;u0tlto fctatlm2rlump;u4trermfciadlpt lu slt  etrxo nudom elieta( sDrrx pot1tpe mi3tltlsDua( o;t4tetnmf oytoaDr u i (0seuoimpnu1al nmnet s a2ra(mont0opxnifciltla el(mo (4tlxnmo3ty1lpteanes t0t2tr(r3nydam elfcsls) rtrump;t4tptn fetltfs uln s t0 eeomrciadoat  neo s)t2trxopiudlpe mnvt s) 2ur(rp;u4alxniicils mDra(mp;t)arxrmr3tadlpD anvs;()s2xm(r ou4lleemfcia(  2rrur ou0teenmieiadlaDua(ms u0tltoio iotfpDrluvslt)s2xoxo3oydlp   ieias arururp;o4tpeomocias m2umuvs;u0tetnio3oadlptr u o ( s2tm(r oo4op nmfvsa(fartm(rpou4olt  fetasfm ua( o ()tetoxf oa1fptr n s;( teuo(m3no1olt lfesl( a2urur ou4apenmoeiasfsDea(mp t0trtomo3oo1oaDelivi;s0sruoxr nu1alenmnesl(fs2uau p;u4tptoii3ild s emnvs u) rxomf3oatfa   uvo t0tetm(rpnu4lm  mfvi (  rrmxmpno1tpt ioeiatla eanmp (0 rxoxrctadoat lnvo s)setmxo3ou4lltnlneiasf 2umurpou0tpx 
\ No newline at end of file
@@ -0,0 +1 @@
+n o (0truo(r3no1oltelieil()a2tmx onu4tlt  ietytla ra(mp t4texrirciatlp e uvs s0texo(mpiu4omt  net t)arta( ont0optoioetys s2eaumo;(4 rtnxrcia1oaDr i ols  eum(m3nodolt  ivil(f rrmumpoo4tpeniietyd m ulums ()trxnxf oy1op elnvolt0s2xrio3iu4apt lnvsat)srrrurpoo1aetomoetysfaDrmn snt0tltnmrctodop e n ols srxoxmpiodam nmfesa(f 2rru  ;t1tptnifctatfm2uluvs u0alenmfcia1oaDe n i s0srxm(r3iy1al n fciasf rtru oou1apt  o3tysla ea(msnt4trxoioctotfm eli i;s0 2xoxm3oodlp e iet tf Drrxrpnu4alxnmi3iydlaDrmu p (4tltnxr3oydlpt anei s)texmiopoy4ll e fcs t  2ur(r ;u4tlt io3tatfa ua( pn()aeeoiocia1fmDr nes;s)trtrir iu1lm  mfctas) Drru p;o1opxoio3ilsfa2ulump u4aeenmociydlptraneols s2xoxm3iodapen fctl()aDta(root1tltniietas mDrmuvp;u4 rtnmfcootlat  n i;s teuoxo iodoptelfcil(fsruaumpou4oeto ietys a2ulnvsnt0tlxrif oatlpDeau olt  eurxm io1omt  fet ( srum(mo;o0oetnmf3iatfsDrlums u0trenxr ty1op   ieslt0t2xmxopiy4amtnlnctl()a2tmur ot1opxomo3iadla2eauvo;u4altrmf iadopDeaivsl(0tetmimpiy4lp   nes ( a2um(r ot0apeoio3tls mDrl(vsn(4altoxo tydfmt au ols0 2xoio3nodol   nvi s) 2rr(  oo4tex  feiyslm eln pnt4 rtnmr3oydfmtr ivolt0 etoxmpiodoleemfeilsf rtm( pot4tleo i3tls sDrluvs;t)aexnmf oy1lp  lieilt0 eurxmpiu4al emivsls aDtrxront4tpeo fciydfsDumu pn(0 eeoio iotlaDr u slt t2trxm3ou1ape mnei s)arraumpot4tpeoifciasls ra(vo (4 ltrmf3iotfaDe ies;s)texr(m oy1amtnlnvsatf 2ra(mo;t0oetoifeiat mDul(ms;t4 eeoxf iydfmteai i;( teuo(mpiu4ll nliesasfs2taum oo1ale mfciys s uluvpnt4teeriociytfmtr ies (0 2xmxmpiydlpenmivilt)aDtmx  ou1altn f3tldlm2umnvp u0tetoircty1fm elnvilt seum(r3iy1lmt mfci tfs2tr(mpnt4oexo fciytfaDeau o (0 eeomfciydfpte neil(0sexmxopiydlptelfvsl(fs2raxmoot4oeeo ociasls2ra( p;(0tetnmociytoa elnvol(0 etmim nu1ole  fesa(fsDtmxm ;o0tpeomi3tldlmDra( o (4aetoiociytfmD ai sl() ruoxr3oudlltnmnvi tfarta(r ot1aee if3tatls2rmu o;t0altniocoydlp   uvo t0 rumxm3iodlleelivs t a2tr(  oo4oet mi3tld m emnmpn(4alerio3todfmDe nvi s  eto(rpoy1altnlivtl(fa2tmumont1opt  o3iat aDuanvs t)altrif oodlat  uvi ( t2tmir iydalt lnci ()s2rmxroou1apen f3iysfm2ea(vs;u)aeerio oo1lmD  ivi;(0 exo(r3iu1lmenmfet tfsDurxmpot1tpe if3iytfs umnms;t) exrxrcoa1oatrau s;s)s2ur(mpno4lptnliet sf rtrxr ot4tex ifetasla ua(vpn(4 lerxfctotla eaies t)teum(r io4am n neta(fsrumurpnt4tpxnmiciaslaDeauvs u) ltrir iodfateanvi;(  etrio3oy4lm nlnei s s2uax  no4aetoif3tadfm emnmp u0alxrxf todla r nvslt)truo(rpio1llt mnvt t a2raxmpnu0alen f3ildlaDelnvpnu4trxnif oodfpDe ivsls0t2xrim3iu1opeemieiat a2um(mo;t4oleoii3iydfa2emnvs;u0teenxrcoydlm r u sls srtm(m ou4omt lfeias s2tmxrp;t0tpxn fctatlsDrlnvp;(4 renxf ootlpt  iei;t seumimpoo4amt  iesas srrmum nu0tlxnmfcilsfs2umnvs u0texoxfcoodopDeauesls  2trir3ou4lmeelnctlsf 2raxmp;t1tlt mfetasfs2ulnms u0trxnxrcta1fmtranei (0s2xrirpny1llen ivia() 2tmx  nt0ape iietytls ra(vsnu)trtomf ia1omtraivil(  2toim3iydap nmfci s  rum(m ;o0aex  oetytfsDul(ms u0tltnxoctytfpt li o s0s2xmir nu1aptelfctlt  rtmxro;u0alxoio3iys m umnms t)tlxnmr oydlptelu il()trtm(o3ou4olen nvtlt) Dra( p;o0altomfeiydls rm( p;()alenmrctotla  anvils)s2xmio3nu1opte fvtlsfarrrxmpou0aex  iciatfa rmnvp t0aleoxf tytfmD aies;()seumimpiodol  mfcsas)aDrmumont1opxn fetytlm2rlumon(0 lxrmr3todfaD li il()t2toim oo4op   nvi ( a2umurp;u4oetoioeiyt s umu s () eermrcoadopDraneo (0 rxriopny4apenlncia(f rurx ooo4ole mfetyslm umump () etrxocoydfp   uvsls) rtr(m3oudlleemfcils)srtru poo1alt io3tytlaDuln o t0trtoxoctytfp rli o s0 etoxo3oodlpt lneilsfsDur(m nu1teeo fciat m elnms u4aeenmf3to1fmDr neo s0t2toxr ou4aptelfcsltfsrtm( pot4oltoifctyd sDemnvp (4 leomf tadopDrlieilt)seurim nu1lp nlnvsa( sDta(  no4opeomoeiys aDul(mp;t)tlxrmoctodfpteaivi;t)trxmxm3oydlmt lfcs tf 2rr( p;o1tlt moeiydlaDulu p t)trxnmf3ta1opDe n slt)sexrxm iudomee ncsas  Dtr(mpnu0tptomoeild s ra(vsnu4 ltrir ia1om rlueol() 2toxrpoy1omtemnvi sfs2tmxmpoo1olxnmoetyd mDrmnvonu0 rtoir3oa1om  au s;t) rxr(rpnu1ale miviat s2taurp;t4oetn o3tadfa2umu p (4 renxr to1lm  aieil(  exoio no4altelfeia(fartrxm ou4tet mi3tat mDrl(mo;(4 eeomo3oatlm elnes;t0srxmxr3ny1omee feia()aDtrxrpnt0aexn fctys s elnvpnu)arenmf3oa1lmteluei (  rumxr iydll n fvtlt) Draxm nu0aeto o3iltfaDelnmpn(4 lxrmr to1omDr ivi;t srurio3oy1lltnmfcia(f 2rrxrpnt1apxomfetltlmDelnms;(4aetoir3oydom e uvi t0s2xmxmpiydom emfesl( artmx p;o4tlenmoeild m eaumo u) rerxo todoa  aies;s)sruoir3iudamtnmfci t aDrrx oou0ope iiciytfm ulnvont0 etnxo3iy1opDrln o;t) rumio oodamtnmncta( aDururono1tltoioctyt m uluvp t4 ltomo3ty1laDrlues t  rur(rpou4opt  nvtatfsDuax o;o4tee mictasla2uaumo;(4aetnif3ia1omDelnvi;() 2uoir oo1llenmivi s aDrr(  oo4tpe  o3ilsfs2ea(mo u0trxrxf3tadfmt aivs s0truoxr3iy4llee neta(  Drmur ot4olt ifeildla uanmsnu4areniociytlptranvs;t s2xr(o nu1omt lfeiltfsrur(ront1aee io3ildfa2ran snt)altnmrcty1lateauvilt0s2tmxmpou1lp n fvia(fa2um(  ou4olxn ociltla rmumsnu)alxrxo to1fa r uvsls)s2toxopnu4al  mnei sf rrrxrp;o1tpxn fcild s rmnvpnt0 ltnxfcoytfa  lneols  rurxm3io4om n nctas sDum(mont4tltniociat a2umnms;u) reniocto1oa rli s;( trtmxr iodlm  livtl( srrrxmont0ape io3iysfmDra( p (0tltomo ta1fa eluvils0s2toxm nydlmeelnetlt srrmumo;u1aet mf3tlsls2elums (4altrxocty1optran sls  rxrxo3iu1olt  ieilt aDum(mpno0alx  f3iyslmDulnms;u0alxoio3tytfa   ivo t0texrxm3nydomtemivt s  2rmxmp;u4alxnmoeildfm rau o;u) etrif to1lm   uvi;t) euo(opoo1alen ivi sfa2taurono1opeo f3iadls2ea(vp;t4arxrxf3iotopDeaieslt) ruoiopoy1lp   ivt s)a2um(mo;o1tpxo ietldfa ua(ms t4treoxo oadlmteln i ( t2xrxm3iu4apt  neilt)aDumu  ot4teen iciyt mDemnvo;u0texnmf3ootlm ran i;s0s2xo(mpnydamen fcsl()sDtmump;o0ope mi3iad aDul( o;(0 rtrirciotlmt aivols srxm(r io1am elnvils srumx ont4opxnmociys m elnvs;()aexnio oytlmte ies t  exoim3ou4ll elnctl(fs2raumono4tex iieils m2ul(vsn(0 renmo totomD  i s;s)truoim ou4omenlfcs ()sDumumonu4olxniiciysfs umuvo t)tltrmrciadfmDe uesls)s2xmxo3oy1lm nlfeiat sDraumpoo4tlt io3iaslmDrl( o u) lxnxr tadoaDeluvo;(  rxmir3oo4amtelfcta(farrrumpot0oeeo o3ilslaDrmnmp t4arerioctodfptr n i;s)setm(m3oodom e fci tfaDuru  ;u4tleomfetldfs rmnmp u4altrxo3oytfatranvi s  etrxopoo4lp   fctlt) 2tru pnt4oee iieiad a rm( snt0areoxo3iadfm rlueol(0 2xoxopiy4lp elfviatf 2ra(roou1oexomfcils mDrau snt4tetrxf ootomD  nvi s seuoxr3io4lltemivsas) Dumxronu4ole  ociasfsDea(mp;(0treoxo iodomDr n s t) rtr(rpoydlpen ieil(f Dtr( p;u4oex  fetatfa emuvp;()arerif3oy1fa  an o s srtm(m3io1amt  icsa() 2uru o;u4open o3iysfsDrmuvo t0 rxrircoo1op   neil( s2xr(o nodlm nmivt t)a2ra(  ;t4tlx mo3tyd m2el(mp () rxrxf3io1opt lues (0 exoxrpiodlm elfcs s  2trxrpno1aeeo icils sDul(mo (0arenio iydfa elieslt)s2xoxr oy4ole  nei (  rraxmo;u0tpx  ietadls emn o t)texoifcoa1la eai i t)t2um(opoo1opeelfesa(  Dua(m nt0tee  icilslm2umuvpnt0tltnio to1oat  u o ()s2umxrpoy1ll nmivt ( aDrmurpnt0aexnmoetad m em( pn()trtnmf3oatom r ies s srxrxo3iydame  nct (  rurxm nu0tex  o3iys m2emn snt)texrif3oodlpt  nvs () exrio oodom  mfetat) 2raxmpou4oeenif3tlt aDuluvo t0 eeoif3ty1lp r nvo;s0truo(m oy1lpenmics (fsDtmxro;o0apxnifciytls ea( on(0alxrxrcoy1lmD aieo s0texrxr oodam n nci tfs2rru  no1oltoifcildlsDemuvsnu4alxrir3oo1oat ln s t0 2urir ou1lmte ies t srraurp;t0oex ii3tadlm el(vo u)tlerif tatlpD luvo;s)trtr(r nu1olen fcsas  Dumx  no1ape ifeiasla2rauvs u0artnxfcoydopD livilt) 2xr(mpno1ape  ncslt) 2ua(rpou4tlt mo3iadlaDrmn s ()treoxr totlatrlnvo;()texoimpiy1omt lnctl( sDurx oot4alto fctyslm2ran p;u4 eeomf todfpt liei;s s2toxo3ny1lm elfes s  2raxrpou4ope mociysfs rlu s t4tltrif3ootopD  neols0s2to(o3oy4al elnvtas s2um(rpnu0apx  i3tlt a rlnmont0trtrmo3oatfpDeluvols trurxopiydalenlivta()arra(r ot4apx moeild s rlump;u) eeoir3oatoptr ivs s)s2urxm3no4amte feslsfsDuru  nu4oleoifctadlm2uauvs u0aexrif io1la  li i;s  rtrio3iu4lmee nvils)sDraum nu1tptnmfeiasfa2umuvp;u4tlenxo tadfp r ivols0teuoiopoydoltnlnctat)sDtm(mooo0tlxoiictad m ua( s;u0 lenir3oodfpt aneils0t2umxr nu4oleemnvi tfs2tm( oot0ole ioeilt aDua( pnu) rtrmoctatlptelu ol(  etriopnu4alt mfcias) 2ur(m no0ole  ictat s2em(mp;(0 rxoxr oadfm eauvo;s sruo(opou1om nmiet t)sDta(rpnt0alx mf3tyt a emn snt)trxrir3iytfat aiei s trxoxmpiy4om  mictlt) Drrxro;o4tptniieiadlaDuanms;u)tltnxf ty1fmt  iei s)trumimpiudll n ncsa()sruax  ;u4apx  oeiytls rluvo;u)teenio3oydfpDrai s;s srum(mpny1lmtn ncsl()a2uaumo;o0aptoii3iyt a rln s;u0aeermocty1fa rlivi;()t2xmio3nu1lltnmfes tfsDrmu  ou0olx  icild s rmnmo (0aleoir oytomD lu s;t0t2xmxmpny1omenmfesa(  Dur(moot1tet mfetys m uaumsnt4 rerio3tatlp  auvilt0 2toio nu1lpe lfesl()srtm(  ;t0tex  o3iad sDrmnvont)artrxf io1lpDrlu o;(0setmxopno1al  mfei t) rum(  ;t4olx io3tas s um( p;t0texrmf ty1oa rauvs;s0srxo(opoy1omee nct (farumx ont0tpenmociad mDuanmpn(0tetnxrctatfm e ueo t0t2xr(r3no4lpenmiciltfa2um(r nt4tex  i3tatfsDemumpnt0 renxo3io1lpDeauvo;t  euo(rpoo4optelivs t)a2urxrpnt1tltoii3tatfm2ulnvo (0 etomf3ta1om elues;(0 exrxm3iu1olt  nvtl(fsDtmumono1oltnifetadfa2ranvsn(4teeoio3oa1fp e i ols)s2uo(r3nu4apenmivtl(f 2ua(mpnt4oex mfciysla umu o;u)trxriocty1faDrlieo;t0 2xoio ny4lpenmnctltf rtrxmpoo4opx  octltlm el(vs (4alermfcoo1fpD lneo;s)teuoxopiodalen ici tfs2tmu pnt1tlt  oeiadlsDrm(von(0trtnmocoadopt  neo;s)s2xm(mpoy1ol n nvias) 2ua(  no4alto o3tysfa2ranvs;(4tlxoircta1fm r nvols0s2urxo ou4ape mivi s) Dtaxmo;t1opx  ieiytlsDeauvo t) leoif3tydfmD  n s t)t2xmxrpny1omen fvslsf rrmx  ;t4tlenmf3tld s elumo;u)artomfctydfatean i s0sexoxo iu1olen feils sDrmxrp;t4olxo o3iyt m ran p u4altnifcoadfm eauei;( s2tmim oodoltelnesatf 2ra(  nu0alx mieiyd a uanmp t0arxoio3totlmDrln ils) etoio ny4amenmicsl()a2rrurp;o1tpx  fcildls2um(mo (4 eenxrciydlp rlnvi s teuo(r3io4optn feias) 2trxront1apen oeiadlm ua(vp u4tleoif oadfaDeanvo;s sruoxmpiu1op emfesasfsDtmu p;t0tlxnmociad a ua(mo ()trenmo3ia1om elies t0sexmir oydomt mfvtls a2rmu  nt1oleomfeildls elumo;t4tetnio3tatomte i o (  etm(m iu1omenmfes tfa2umu oot4tex miciaslm2rl( on(0arxnmo3iytlaD  ivo s)srtmiopiodlmeelictls a2umumpnu4alxn fetasfa ean pnt)tlxoxfcoo1oate nesl(0trxr(m iudal n nvtls) 2tmu p;o4aetniiciyslm2uau snu)trxnif tytlpDr u ols0 ruo(o3no1lptn nvia(fs2tmxrp;t0tex  o3iytfmDraumpnu)altoxo iadla eluvi;(0 rtmim3oudap e ivia() rtrumooo1tpxomo3iysfaDranvonu0trtnxf oodfmDelu i;t0trto(r nudome mics ()s2rrx oou1texn ietls sDumnvp u0 rxrmo oy1oa   i o t srtrxrpio1omtnmnvtlsf rtax oou0aexnmf3tatls el(vsnu0arxomo3oodoptr nvi;( setrxrpoo1amenmivtlt)a2urxmpno1teen ictydlm2ul( o ()tlxnxr io1faD livs;(  eumxopoodome  ncs t sDrm( p;t0ole mietat s raumsnt0aeenxfcoa1oa  aueol(  rxoio3iy4omt  ncs ()a2ur( pnu1tlxnmieiltlsDrmu p;t)texnxr ia1omt aies;(  eum(r no1ap nmfvs t)aDum(mpno1apeo i3iaslm eaumon()tlxnxo3oy1lmt  i o s)sexoxo iu4lmee fciasf 2ta(ronu1olxnmociytfm2rmnmo (4tlxnmr3iydoate nvo t0 exm(opny4ll n ivta()aDururonu1alx miciytla rln o ()trenif3ta1laD livolt0 2to(rpiu4apt  ivt tfaDtrx o;t1apto ieiad m ulumo;u) rtoxfciy1fate i s;s0s2tm(o3iy1llt lietl() 2trx  ou1optnmfetyd sDrmums;u4arxrmocoa1fateluvo;t)tetr(o nodom emict s aDtmum nt0texnmociydls2uauvo (0tlxrxr3tatfp e nvslt trum(r3oy1lle  fvsasfaruaxronu0olen feiysfs um(ms ()tlerxf iydop r ivo t texoim nydaptemnvslt) rrmxm ;o1tpeo octldfmDeanmo;()trxrir oy1lpDraiesl(0tetrim oo1lmen feiltfa2rax  ;o4tetomf3tyt sDumn s u4trtrmr3ty1fmDr ueo;s0teum(r3iu4ap elfvsa( srtm(r ;u4aleoifcilt sDrmuvo;()texnio3oatla  lieo;() 2xoimpiy1lmt mnetl( srtm(mpnu1tet if3iasfsDulumo (0 exnif iatfatrln i (0seuoxrpio1alt lnvia( arrau pno0tlxoif3iyd a2eluvsn(4tetrmf3ta1fmDr ivi ()srtr(r3iy4ll  mnvtl(farur(r no1opx if3tlslm2el(msnt4 exoifctodlmDe ies;()srumiopiydlptelfet t) rra( p;o0opeoiieils m umnms t0arxnircty1fm e u olt0teumxr3oo1lpeelieiat)sDumxr ;t4oltoiieiysfaDumnvpnt4altrxr3iadop rlivi t) 2xr(o iy1optn neta(fsDtau poo1alx mi3iat sDrlnmo;u)tltrif to1lmDeln slt teuoiopio1apte fvtltf 2umur nt0oeenif3iyslm em(mo;t0 rermo3todfpDe n i t)sexr(rpiodapenlfvsa(faruax  ;t0ape moctyt a2rmnvon(4trermociadfmDranei;(  eur(m3iy1open nvtltfs2raxmpnt1ape  f3tydlaDrm( ont4 lxnif3iy1oa e iesls)trurimpny4olt  nvils srrau pot1apeo ieildfa2rmn o u4 eeomf3ootop   nvi;t s2toir oy4aptn fciat arurump;t4aptnif3ild a2uluvsnu0 etnmocootfptrauvi;()s2tmimpiu1omtnmncia( a2rmx  nt0aptnifcild m rln on(0artnmr ootlmD aues t)s2toxr3io4optnmivt s artr( ont1oee mietaslsDrlnmp t0 leoifcoadlpt  i o;(0 eurxr3nodopee neslt)a2ta(rooo4tlt  i3iytfa rlu snu)aeerio3tadfmDraueilt  exmxopou1om  lietl(  rtm( o;u0alt mociltlmDel(vp;() rxnircoa1fmteaieo;(0 rumxo ny1lltelfct t)artmumo;u1altn ictyt a2ul(msnu)aeenxo3tatfa eaueo t0s2xrxo3oy4lltnmneil(fsrta( p;o0ole  feilsls ran sn()trtnir ty1laDrau s t0 rum(opiy4oltelneiltfsrrmx  oo4optn o3tlt a2eanvs;t4trtoxf3tytoaD  iei;() euo(opoo4lp  mivtls)srrmxm ;t4olxomfetytfsDem(vo;(0aeeoif to1op   ivi;t0tetmxr oo4am emfeiat) 2uau oou0optnii3tasfsDemu on()tlxrxo3oadom   ueolt)trurir nu4llt lnvilt) 2tm(rpno1olto fctatls umu pnt4areomr3tytlmte uvi;s)sexrxmpio1ll  lfct sfsrrmxr ;t1teeomictlsfm em( snu)teerio3oy1opD anes ()texmim no4lm  mnes (  rtm(  ;o0ole ii3tld m2ulnmp u0alenxo3tydfm  auvslt0trxoxo3iy4lme  ivi sfaruaxm ot4aex  ociydlaDemumo u0tlenio oodfatrlnei t0srtmir3nu1ameelics s srtauronu1oexn ocilt a emnms;u) etrmfcio1fpDelnvil(0sexm(m3nu1omeemncias  Dta(rpnt0aetn fciyt aDeanmpnu0aetrxociatlp rauvols sexoxopiy1lle  fesa(fsDurur nu4ale mfetys s2ulnms;t0trerir3todopt  iei;(0s2umxopou4llte ies () rua(m ;o0altomi3ilsfm2rluvp u4 etnmrctytom  auvi;(  rxoirpno1ol elfcilsf rrrxm nu1altomo3ias m eluvsnu4 ltoxr io1fp r neols0t2xoiopiudlptemnct t  Duaurp;t1optoioctls s ean pnt)aetnifciotlp e ivs;t0srxoim ou4lpenmivs (faDumur ;o4alt miciytls2elnvont0tlxomrciotlaD  ieilt0s2uoxr3oy1lptnmivta()sDrrxrp;o0tleniicils sDum(mo;u4trxrmrcty1oaDrluvi;s srtr(m3ny4llenlicsat)arrru p;t0opt io3iltfm uanmo u4 etomo3oy1lmt  nei;()setrim3oy4oltn ivi s)a2rmu  ;o0aetoio3tltls ulu o;t4trxrir oatfaD lieo (  rtm(r ny1lmee ies tfarrrum ;o4oexn feiytlm umn snt0altrmfcoadfpDeluvo;(0 ruoimpiu4al n ietasfs2tmur ou4apeniietasfa2ra(vo;u0alxoio ty1oa elu ilt) rtr(m nudlpt mnvslsfa2urum ;u0alxnmoeiad a um( o;u) lxoifciatfaDelneo t0t2xoxopiy4lm eliei t arumu  ;o4tle  oeild aDrau p;u)tleomf tadlp  luei;(0trto(r iy1ol   nes s)a2rm( pno1aleo fciad s2eanvs (4trtoir ta1optean s;t  rtoio3nydopt  fvs t  rrm(mpnu1tpt mf3ilsfm2uanvont) rtomr3iytfpt liei;(0trxoimpnudame miet (fsDur(  nt0optn i3iyd mDeluvsn(4 rxomr3iotop r uvo;()t2xm(r3no4ol e ivia(fs2rr(  ou4apxn ietadla2el( p;(0aexoxf tatop eanvols)s2umio oydapt mieilt aDtaxroou0tlt iiciydfa2rm(vpnt) eeoir3tadfmteaivo t sexoio3oodol elictl()a2tau  ou0tpx mf3iasfa eluvo u4 leomr iodlmte nei;t)tetm(r3ny1lptemfvtls a2tr(mo;o4apxnmoetydlm ea(mo;(0teenxr iydfmt lnvo s) 2xoxm io1alee feta( s2tmxm ;t0tlxoiociltfmDranmp;u0aetrxocoydfa eauvi s0t2toio3iydalenmietls arumu  ;u4oex ifciltlm2eaump;(4altoxo3todfm eau s;(0tetm(r3iy1ll   fctls  2rr(m nu4aetn o3taslsDrmnvp ()tlxnif tytfaDrauei t) 2ur(opoo1lmeemfeias)aDuaxronu0apeo i3iysfaDua(vo;t)texrio to1fp raieols0 exmir oy4op n fvils artm( pnt4tle mfetytls2rlu s t4tlxoxoctadlmtrlieil() etoxo nydllen ict s)s2umuroot4aex miciadla2rmn p u0 exriocootlm  lueo s)sruo(opno1olenlncs ( s2rm(r ou4alxomicias m emnvp;u) exoxf io1omte nvsl( s2tr(r3oy1ap emfeias srtr(r nu4alto feiys s rlnvs (0 exnxrctodfpDeanvs t0truo(m3ou1al  mfcia()a2ra(m ou1tpenioetadls uan pnu)arenmf3io1oaDraieslt0sexo(m3ou1omtemictl( srtaum no0apxomf3ils s2eau s u0arerio3ta1fm ranvils)trxrxr3ny1amenlfctlt)s2rmxm nu0aptnioeilt mDum(vp;u0tetomf tydomDrli s s)t2ur(mpiydlle mfct t a2tm(r ou0olto octyd a eluvpn() rtrmo3iadfaDeliei s0seumir oudopenmfvs s)aDum(root0aexnmoctltfsDemuvs;t0aexnmrcia1lp eln o ( t2uoimpiy1lm e neiltf rrmu o;o1tpxo ieiad m ua(mpnu)areoifcty1om elneolt  2xoim oydlp e ivt t)arrrx pnu0olenmicild s2ranvsnt) etoir iytomte n s s)t2xoiopiodopte fetas) 2raxrpot4oltn iciys aDranms ()tltoxfcio1oat  ueo;t0texoio nydoptelies s)arua( pnt4oleo o3tysfmDrlnvon(4aleomf tytlpte uvslt0trur(r3oydll  mictl( srur(m nu4alxnmfctld mDua(vp u0tltomf3oo1la elnvils)trxoirpio1opt lnesl( a2rm(mpot1aexniocilslsDra( s t0 eenxf tytop elivolt srumxopnudalen fvi s  Dumu pnt4oeen iciytfs rl(vs t0 exoxo3oadlm rln s t)teur(o3iodamtelncs t)s2taurpou4altoifcildlm rmn p t0arxnxf iatlpDelnesl(0teurio3ou4amenlfvia(fartrurpnu0tet mocild a2rlu s () lxrxr iotlm elu sls) euoirpno4op n nctas)s2rau p;o4tle mociydfa eauvpnu4tetrir oo1fmD anvi s seuo(o iydomee fvias) 2rax  nt4tetnmiciys m emn o u) renmo tatomte i i t0t2xrio ou4olt mnvsat  2trxrpot1tpen oetasfsDemnvsn(4texrio3iatlmt luvi t0sexmio3no4om nlict (  rraump;t4oet ifciatfm uaums u0 reomr3oadlptrlivsl(  rxo(r3nodlpe lfvt () rtrxmonu0tle  ictat sDra(mp t0 rtrxo3ta1op rlnvs (0srumirpno1llenlnvs t)arum( o;t1olen ieiatls emumo;(4trermr iytlp eauei s0trxmimpio4op elfesat)s2tr(rpot1opx ifeiad aDum(msnu)areomr iotfaD  ivi;t)texoio iydam  lici (fa2umxr oo1oetnmf3iat m um(vsnt0 exrir ty1lmt  n s;( sruo(mpnudale mfvt t)sDtmu o;t0opxnmiciytfsDranvp;u)tltrmo3tatomD luesl()texm(o3iu4optnmfetas  ruau ooo4opxomictas m2rm(vs;(4trtrxfctodla e ivs ()s2xm(m3ou1ap  livtlt  Dtr( p;t0oltn i3iltlm2umn pnt0areoxocty1oatrau o;s)s2ur(rpou4op elietatf rum( o;t4aetomf3ildlm ul( o (0texrmr3iodlmD ln i t truo(r3oodol   iei sfsrrau  nt0oet mf3tadlmDra(vo;t)trerir3oo1fa raueils0teumxo nudlme mnet (f rurx pot4tet ifeiatlmDelnvs u) rxrio3tytlmt  n s;t)tetm(m3io1ame lfct t a2rmumo;u4olx  f3tyd a2ea(vsnu)altoxocoo1lm  anei t seumxrpiy4ap elfvs () rrru p;u1apenmfctldlm2ulu o u)tltoif oo1laDeaivol(0sexrxrpio4lp emivsatfa2rmx  nt4aee mi3tltfs rl(vo t4 rtrmoctadomDelu s s) 2uoio3oo1ol elnei t) ruaxrono1tex mfciat s2el(mpn(0teeoxf3tytlp r nvs;( trxrxm3no1amtn nvi s artrxm nt4tetn octld mDelu o (0teeoxf3ta1opDrau s;(0t2tm(m oo1am emnesl(  2trxmp;t4tpen f3tysfmDumu s u4arxnmo3oa1opD ai s;( setmim3nodameemict t)a2rr( oot1tpt  ociytfm2el(mo;(4texnif3iodfmDe n i s  2urim nudomt lnvtlt  Drrumpou0aptomf3iysfs2umnms;t4tlerir3to1lp  anvs (0texm(m3nu1opt lict () Dta(mp;o0oltnmo3iyd m ea(vont4arenirciodop elieo;()trtrxmpno4al elfvtl()a2tau  oo4tex iicilsfa ua(ms u)areomr3ia1omte ivs s) 2urxr3oudop  miei tfaDtru p;o0tee  octadfa uanvp;u4 rxrif oo1fatr ueo;s) 2xoxr oodale  neilsfsDuaxronu4olx ifcilsls2umnms u4aexnmf ootfaDeaivi t)trumxr iudlmteliciat a2rmum ou0tpt  octasla2rmn sn(0 exnmf oy1opt ln ilt) rxrxm iudamtnlfvta(  Drmx poo0opt ii3tld aDemnmsnt) eeomr3io1lateau o (  rur(r3oo1amt  fvtls) 2uau ont4alxnmf3tytfsDumnvo t)tlxomo3ty1omDr u slt)s2xoxrpiudopt livslt srumumont1oeenii3tas m rlu sn(0 rxnxf3iotop   ieol(0t2toxopnydal nlnetl() rrrx pnt1alxnmoeiatlaDuau o;t)arxnmocty1lp r iesls setmio oydomt  fei () 2um(m ot1aeeoio3ildls2ulu s u) eeniocia1fmteau o (  etoir iudlpee nvs (farumumo;t4opx  fetasfa2ulums;(0tlxrmfcoadfaDranvils0s2uoio3oy4lmt mictasfsrua(r oo1tpto fctyt mDeau o (4arxrxf ia1lmtraneo;s) eum(rpnu4oltnlfetlsf 2trxmoou1altn ictysfsDrmnmp t0artrmo3totoatrli i;s  exoxm no4opte icta( arrr( p;t4aetnii3iydfaDrlums;u4altrioctadfatr n i t)seurxm oudlp  lfeiatf rum(rpou1tle  fctysfm2elumo u0tltoif tatop ean ils  rtr(r ny1opt  neil(fsrtaurp;u0ape ii3tlt aDeau s;u4arxoxfcoo1om rlu i;t) eto(rpiodome lncsls aDra( onu4aptoifciytlaDuanms () renxo tadla rai ils0s2xr(mpiy4olee ieiltfartr(mp;t1ope  ictydla2ea(vo;t4 ltoif3ootlaDrlnvilt0truoio3iy1aleelicilt aDtmurpno4teenmiciatla2rmnmpn()texnio oytlp r uvs ( trxm(o nodlltnlietatf 2raum ;o4texnmfetlsla2ean p;u4teerxr oytlm   n o;s0trxmxr3io1omee fciat a2ua(r nt4olen ociytlaDemnmo u4 rerif ia1fptrlueil(0s2xoxo ou1amt lnetlsf Drr( pot4apx mietlt s2um(msnu4texnmr3tytfaDelnvilt)texoirpoy1lp emfvt sf 2rm(rooo0alxnioctydla emnms;(4 rxrxf3iotomDraieolt) exrio iy4amtnmiet (fsrumu p;t4oltn o3ildfm um(msn(0texoxr iotopD an ilt t2tmxo3nydlmtnmfci t)sDtaxmp;t0tlxo fciydfm2uauvp u)aeenifciatfm eanes s0srxrir3oydam  miesls  Dumum nt1aet mf3tasfs2rlnvs;u)tetrxf io1fm e ivs ( s2xo(m iodam e fvt (  rraumo;t1oexomictysfm eauvonu)alxoxr oa1oatrlnvolt0teto(m nu1amee nesa(fartax p;o0alt  oeiadfa2eaums;t4aexoio oadoaDeli s s  2toim3nodomtemies sfartrxro;t1alenmieiytfaDra(vp u0 leoxfcoa1op  lnvslt)srto(m3io1lmenmici sfsDua( oot4opeo f3tys aDem(mo;u0aleriocoydfmt  neil( teuoxr3io1ol   fci ( a2urumoot4teeoio3ildfm ran s t0 rtrioctadopte nesl() 2uo(r ou1om elnciat) rtau ooo4aptn ocild aDuauvonu0aeeomf iotfpDean o t0sruoxmpnu4al  mfci s srrm(mp;o4aee ii3iydlaDrmn pnt4tlenif3tadomDean slt)trxo(m oydamtnmncslt arur( pou1oexnioetld mDul(vs ()tleniocty1fp  li s;()t2urirpnodal nmfvt (  rrax pno0aleo feiltfmDumu p u4 rxrxrcoytfat lues () rxm(r3nu4apte ivsls a2trx  nu1aeeoifcilt mDelnvon(0aetomr iotfmDelues ( s2um(r3ny4om emicil( s2tm(  ot1ole ii3iatfs emu s;(0trxnxf iy1fa   ues;(0s2xoxo3iu1ape lfvils)arua( ono0tltomfctldls2um(msnu4alenmf3oa1lpD  i il( seuoiopno1opt  ietls aDur( p;o0tetn octyd m elnmo;()tleoif tadlp  ai o () etoxrpou4om elfvt tf Dumxmpoo0aexo fcilt a ua(vpn(4 ltrmrcto1la   n s;(0trtmirpnudlmte fvtl(faDtaxmo;u4opt moeiad m2umn s;u0altomr tytlat aneo;t)s2tmim3iodol   fvt t aDraurono0tlx  oetlslsDra(mo (4texrxf oatla rauvslt0t2xoxo nodolt  fvsls  2tm(r oo1aeeo icildfa2rm(mo;u4 etomf tydfm   ivs;(0texo(r3iydal elieta()arrrumpnu4tetoioctys s2el( pnt4tlxrxf oa1opte nvolt t2uo(rpnu1al nlfctlsfs2uaxrp;u4tlxo feiydfaDran s t) eerxo oodom r iei t0teuo(r ny1omen iciltfarururont1optn f3iltfs emuvp;t)arermociytop eln s t0sexrimpnudoptelfvs t  rtrxm no1tpxoiieils aDrluvp;u0tlenir oydom rlueo;t0s2trio3iu1ol emnvt sf rrruro;o4aee io3tadlsDum(mo;u0 etrio io1opte nvolt seto(m3ou1lm e iet ( arrrxrp;t1openmictltls ua(von(0treomo oodfmtelnvils0 rumim io1ap   ics sf rrr( ont4oexnii3iydlsDrl(vo t0 etnifciytfmDrauvs;t0 rumxmpny4apt  ietltfa2rm( o;o1tltniociatlmDuluvon()trenmociytlp eluesl()sexmxrpno4omt mfcil()s2tr( o;o0olxnmociydla2uauvo;t4 ltnif3iatoatelu o;(0teurirpnu4lm  mnei ( aDrrum no4tptniociys m2rmn p t4aexoxo totlm rlivi t sexm(m iu4lm e ict t) rua(  ;o4tetnioetys a ulnmp;t0trerxocio1la   uesl()srtoim nudll emfvtltf 2ur(  oo4opeo i3iatfmDel(vsnt4texnif iatomt luvsls  exm(mpnodlle  fvtlsfsrum(r no4oexomf3tasls rl(ms u)tetrmf3io1om rlivo;(0 ruoir iy4om elnesls) 2trur ;o0olxn octydfmDeln o ()aetoxocootomt  i s () eumimpoodameelnesatfarumumpot0olx mociyslmDum(vsnt4tlenmo oodoatrlnesls0texoxr iodape miviat) Dra( oot4tpt iociyd a2el(ms t4trtnmr3iytfp  lies s) euriopiodlmee fesasfartrx ono1aeeo i3tlsfmDuln p u0 etoio3to1fp elnei;t t2xo(opiydolen ncilt aDtmu pot0tpenioeiyslm2ua(vp t0tetrmf3iydopt  ieo;t)t2xmxm3iu1ole  ivi tfartm(rono1tpeoioctatfsDulnmon()trtnircoytop eanvsls0 rtrxmpoy1om  lnci tfarum(mpou1tetnmiciat m2ea( o u0texomocoa1fat  ieols)seur(r nu4altn iet tf 2raumonu0tleo iciadlm2umnmp t) lxoir oatoate n ols0teurim oy4lpenlnes (faDtax p;u1oex io3tydls emuvsnt4 lxomo iadomt lnvils0 2toio ou4lptn nctl()aDtaumpnt4aetnmo3ilsfsDuaumpn(0 eenxr iatfm r ieo ( truoxopou1omtelnvi ()arta(mp;t1olt  oetydfm2ea(ms;(0trxnif3iotlm eauvol(0srtmirpou1altnmiei s)aDtmu pot4olen fcildfs ra(ms u0alermo tydfaDe ues ( teuoxmpiu4lmen icsa(fsDumu  ot0tpxniociatfm el(vp t)aetoxo iadoaDrlnvs t0trto(r oudlmt mnct ( arur(mp;t0tptomf3ils mDeln p;t4tlerxf ootlpt aueil(0t2xmir nudomeemiesas artrumpoo0alenmietatlsDemu s;u)aeerxo3iy1oateanvol()srtm(mpoo1amtnmnvsl() 2tm(moot4alx ifciydlaDua( p;u4 exrxf totlpte i s;t seuo(r3io4ll  micta(fs2rau ont0opxoifctat mDelnvp;u)arxrxociotlpD anvs ()tetrirpnydlltelivsls aDtmu poo4tlx ifeild a2el( o;(4aexrircia1fpDeanes (0 eurxo3iy1op nmfct tfarum(rp;u4tlxomietls sDrl(mp;u0 rxrxfcoy1laDe ueo;( t2uoxrpiydllt mieslt)aruaumo;o1tpeoiicias s2ranvp (4teerif3oadop ean o s  exm(mpio4am   nesls)arrau p;u1apeomfciasla uluvont4arenif oo1fpt  ues;t  2xmxr3no1aptn ivs ()s2rmum ;t0olxnmiciatlm ranvo t)trtnxo3ia1lm e iei t0t2uo(r ny4ol nlict t aDta(m nt1tlxo feiatlm2umu o;u4arermf3iotlp eaies (0s2xoxr3nu4omen feiltfsrra(mp;t4aptomi3tltla ranmp;(0alxrmfcoo1op  li i t) 2xrxr no1opte fci tf Dtr(ro;u4oleomo3tld a el(vp (4teeoxf3iatlaDeauvs;s sexoiopoodol n fvsl() rraumoot4aetomf3iyt a emuvp;t4teeoir ty1faDe nes;t0tetrir3nodlp   fctls s2raum ou4oltomi3tat m eauvonu4tleomf oo1lm raueo;t) rtoxr iudlltnlfetlt srtrx p;u4opx mf3ild sDem( o (0 reomr iadfpD ai i (0 2xrir3iy4llenlivi t)srurx p;u4oee mfetlt a2raump (4aetrxociodlmt  ieo;()sexmxmpnu4oleemneias)a2tax  no0optn o3tad s2ranvp u0 etoxrcootlat lu o;(0s2xr(m3nodam n fvia(f 2urxronu4alx  fetls aDumnmo;t) lxoir3oa1oa rlnvols0teumir3oy4al elici sfs2rrum ;t4oee ifeildfa2rmn ont4alerio iadfptrln i ()s2trxm3io4ameelicilt  2tmx  nu4tlto fciat a2rmnvont4aetnxf oatfptr nvs (0 2ur(r no1olt  icilt)a2rrxmo;t1aexnmoetlslaDrl( o;t)tltrifciadfpD aneslt)tetoiopnydlpee netls  2rmxmonu4oeeomoctat mDrauvo t4arermoctotopt  ivilt0s2uoio oo1amenlictat  Drr(mpnt1aetoii3iltfs um(vo t4tetnxf iotlm  lnei;s0 rtm(m3iydaltemfvsa() 2raxmo;o1teto octls m2ul( p ()tlenmr ia1omtean s;t)srurxm3iu1oltnlivia() 2um(mp;o4tetn i3iytlsDra( snu)trxrxfcoytom e ueo;s)seurxm3oudom  mict tf Dtr(mpoo1aleomieilt s2uauvp t)trtnxfcoatoateai slt teum(opoo4lm e nci sfs2urxmpou0tpeoifeiadfs2elnmon()arxrifcoatopDelnei s texo(rpiu1amtemfvil() rtmxm ou0aet ii3iytls2uaumsnt)aexnir3ty1fp eanvolt0s2xo(r3nudoptemnvsls srtrxrpnt1oeen fciytls rln snu4aeenif to1op e nvo;s)srxr(r oo1op elnei t)srta(moot1texo fciysls ranvpn(0aleriocoadla elneo t) 2xo(m3oo1ome lict s)a2uax pot1alt iocilt mDulumo t4trermr3oodom  anvi t0 eurio3iy1lme lfes s)srrm( ont4tetnioctad mDrmnvo;u4aexoxfctytla elieolt) rtrimpny4ll emnvs s) rrmum ot0opx  i3ils a2rmumonu4tlerio3iotlmt ai i;s) eurir oo4lpeemncs t)artmurono1tltn ictys s umumsn(0tlxnmr iatla rlivs (0srxrio3ou1al n ieias) 2urumo;o0oetnmociat m2uln o;(4altrxo tytlpDrauvo s)sexoiopnodoleemfvtatfsDtax  ot1aetn f3tysfmDeln p t0tlxomr3ta1faDrlnvi s)t2xr(m3iu4llee feil( srtmxroou1ope mociadfm2emn p;t0arenxociotfa eaivs s0 rxr(r3no1am e fesl(f Dtr( oou0tex mf3ilsla2emnms u) leoio3tadoa  aneo ()texmxr3iu1lleelfvs t)a2ur(mono0tpx  feiysfaDelnms;u0 lxoirctadfaDrai i t)srurimpiy4altnmnvsa(  ruaxmooo0apxn ocilsfm2uauvs;u) leoio io1opDrln s s sexm(r nu4lmt  fvt t) Drrx ooo4aexomfeiasla2ranmp;t0 etoio oadom rlivslt seurirpoy1lp e fvsat) Dtr(r ot4aeeomoeilsfs rmn pn(0tetoif3tadfmteai s;s0s2xmxm3iu1om   ncia() ruau ont4tet mociltfs2rm( s;u4 ltrirciatfatrlnvi;t0 rxmir3nu4ap  mnvilt arrr( pnu1aee ii3tldfm2uluvs;t0 rxrmf ia1opDrluvi t  etoirpiu4ole mnvt t  rumu p;u1oex  i3iysfs2emnms;t0alxrir3ootlpteanvo ()t2xoiopno1lp e nctlt)aDrr(rp;o0tpeniiciys m ra(vont0tltoxf3oo1opDrliesl(0trumimpoudapte fes t a2umu  nt0tptn o3tld mDul(vo t4altnir3iy1oaD aies;t  rxo(rpiudal elnvsas sDta(mo;u1aexnifciltfa2em(vont0trxrmrciadfpDelnvolt0t2urxopio1opt mfctasf 2ta( pou0aexn fctas a2emumpnu4 leomr3tytoaDe ivs;t) rxmxo3io4lle mfvt s)aDrrxmp;o4tlen ictytfa2rm(mo u) ltomfciodop rlnvsl( trxrxr nudlltelnetl() 2uru  ;u1olxnii3tls a rmn ont4 eeoxoctotfaD au o;t0 euoio oudalt licsl()a2rmur ;o0tlx io3iyt m raumpnu) etoxr3oytlatrlues;(  eum(m iydole liesas s2ra(m ;u4oee  o3tlsfa2umn sn(0 renxoctodomt lu ol() euo(rpio1ap e netlt) 2ur(  no1aleo fctat mDem(msnt4aetoiocoatfp rlnes;s0t2xr(mpiodomt mnvi s) 2trx pot0tltomi3iat m2ul(mpnu)aeeomf3oy1fpDelueo;s  exmio3no1omt lncsasfsrrmxrpoo0tpx  i3tas sDuaump t0 ltoxr io1fat an i;()trxrxrpnu1lmt mfcils srtaumooo0olx  octyt a2ua(vo;u0teerxocto1fmtrau sl( trumxr iu4lm  mfei t aDtru pot4apeoioctyslm eanmsnu4 ltrmr iadlpD  n i;s0sexmxm3ny4oltelfvtas aDurump;u1tptomi3ilt m2em( onu0 exrif3totfp  ai o (  euo(m3iy1lmt  ictlsf Durumpoo0tpe ifctas m rmnvp;t0 ltoxrctydoat lnvo;( teto(rpnu1lleelnetl(f rtmx o;u4tpx  oeiatfaDemnmpnt0 rtnir3ia1opD anvs;() rtrxrpoodlme mivt tfarraum ;o0oee  f3ilsfa uau on(4 etomfcoadomDr u sl(0seumxo3iy1amtn fei s  2trur nt0openiiciltla uanmpn() eenif oo1omte ies;t texr(o3ny1lmtelfvi sf Dtaxmoot1aee miciydls2ua( p;(4 rxomrcia1lpDran i s0trxmiopiu1al nlfvsa()s2rruront4olx if3tld sDulump;t4tleoiocoytlp e ivo t) rxoim3oo4optn nvslt)a2raxm ou1oltnmf3iasla2eaums;t)tetrio3tydopDelneo;t)trurio io1apee fes ( srra( pno1opx  ieias sDemuvs;t)tlxrif todoaD ai slt trumirpnu1lmtelics tfaDrrurpnt0tlt  oeias sDra( p t0tetrir oa1lptelues ()s2toxo3iu4openmfcs ()srurx  ;t0apeoiieiatfa ranvp;u4aexrxfciy1oaD liei;t) 2xoio no4amee fci s) Drmuro;o0oexn feilsfs2emn pnu)arenxo iydlpDrai sls) 2xm(opiudlpt mneilt  Dtmx poo1tpenifctas s ul(mo;u0alxoxo3oatlp  lnvs;t0srtm(o iy1alte ivi s)s2uaumpou1opt moeiasfm2elnmp;t0 rtrxr oodopDean s;s texmxr3ou1altn fesl( arurumont4opxoiociasls2ra(msn()arenmfctydopD anvsls0s2tr(r oudap nlnvt sfs2trur ;o4aleo iciys s emuvp;t)aetomr oodoaDeaivolt)t2toir ou4ll emictas a2um(mpou4texnmfeiyt sDulumon(4trxoxr3iatfmt anvol() rxmim iydap emivi s srurxro;u0alto ietltfm2em( pnu4tltoxr3totop e ieolt) 2xoxo3oydol e nvilsfsDra(r ;t4apeo ieiadfsDrmuvs t) rxoif3ty1lmt aiesl(0sruoiopiu4om emnet () 2ua(mpnu0apxo o3iltfa ranvo;()aetrxr oa1laDrluvi s  etoxo3iy1amtemieias sDuaumono1
\ No newline at end of file
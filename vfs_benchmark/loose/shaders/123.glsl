@@ -0,0 +1 @@
+neo;s)tetm(r nydomtelivi tfa2umu  ;u0tlxnmf3iytlm eaumpnt)trtrxf3tytomtean i (0 2xoir iy1olte nvta() 2urxront0aex mietldla ua( ont4tetnxr3tytfmteaiei;(  2xmim nudap emiciatfsDtrurp;o4tetn i3ils mDrl(mon(0alxomfciotfatr ivo s)t2umxr iudope  fvi tf rtmump;t4tee  i3ilsfs2emn o t0 renxo3iy1fa  anvi s0trtrim no1amen nct t) rrmx p;t0tetomieiyd a rauvs;u)tetrir oa1lm rau olt seurim nodop  miesltfaDra(ro;o1oexnif3iltfs el(mp () etoxrciatomDe nvslt0 2xm(r io4omtnliesat a2rm(m ot0apeomoetys s2um(vs;u) lerxfciotfa elivs s  2tm(o iydomtnmictlsfaDtmum ou4aex  f3tltfa ea( sn()altnxr3oa1fpt ln sl()trxm(m iydopt  nci tfa2tm( pou1apt mfeiydfa ea( p t0 eeomr oadfmtrlivo;(0s2trimpny4lp  mict sfs2rrx p;o1teto fetasfm umnvo t4aeenmf ta1lp  luvi;()srtm(o3ny4opte fetas) Drr(mooo0alenmfeiasfsDemnvp u0tlenmr totopD aies ()teuoxmpio1am nmieslt)srtruroou0opeo feiltls ul(mo t)tltnir3oydfa rln i s0trxmxmpoo4opeemiet t) 2rmu oot4tpenmfetldls eauvo;(0tltnxo3tadfat aueils)sruo(rpoy1al nmnet t)aruax p;t1teeo ieiysfs2ua( s;t0 exrio iydlm elieil()teumxo3no4omen fvias)a2rrur ;t4opxnmfciytfsDrl( p;(4teeoxf iadop  auei;(  exmir nudopen fcsa(fs2urx pot4apxnmfctyt sDea(mont) exnxr3to1fpteauvsl(  rxoxo io1llenlncs (faDtmum nu1teeniocildfaDrmn s;t)texnio totlateau s;( s2urxopiudoltnlfcils  2rr(  ou4oeen ociltlaDem(vsnt0 rtomr3iatop  aies;(  2uo(r oy4apt lfvt s)sDra( pou1tet  icilsla rlnvp ()tlxrmo io1fmt liei;t)t2xrxm iy1open fvtlt arrrx  no4olxo oetydfsDum(vonu)artnif3oo1lp rlues;( tetmio iudamtemnctat sDuaxmoou4aex iictys s em(ms;u)alxoio oa1oa eauvo ( texmim3oy4omeelics s)s2rmx ont0apeniicils s2em(msn(4texnxo tatfa  aneilt setoxm3ny1lpe  fetls) 2taumpoo0oeenmoetldlm umnvs;()tleoxo oydfp e nvs t) 2xrir3ny4al nmnct tf rum(mpnt4alt iiciad a umnvs;u4alenmo iytfmD auvols trtoim iydomen icilt)arumxmp;o4tptn oeiatls rmums u) eeoif to1lmt lneo;s)trxoxmpiy1lmtn nei t s2rau ont1oltoifeiad m um(ms;u)teeoxr tatfp r ieo (0teurim oudlpenmnesls  Dtr(rono4opxo f3ilsfaDran o;u0texoif todomt lueo ( s2tmxmpoo1openlnei () rtm(  ot0tee mi3ild mDrlu on()altnxfcia1opDrlivo t s2xm(r3iu4am nlfcilsf 2ur(ronu1oleo f3tls aDemnmpnu)aetoif3ty1fm eaues;()sexm(r3oy4altn nctls)a2tmuro;t0alxnmieild m2rmu sn(0alxrxo3tydomDeluvo () rxmim3iy4ol nmncta(  Dtmx oou4tlxomi3tydla um( o u) eeomr3iatlmDe uvslt)trtmxopnu1altn iei tfsDumum ;o1tlx  oeiadfs ranmp;u4arxnxo iatopD  n ils t2to(o3nu4lm elicsls arta(m ou4alxoif3tyd a2emuvsn(0tltrxo3oadlmt  uvs;( trxmxmpoudoptemnvtat)s2rrx  ot1altomoctls s eluvonu)trtnir ty1lpt auvi;t0s2tm(m nodll elfcs tfaDrmx o;o0oeenmoeiat m2em(vs (4 rtomfcootopD au ils srto(r iudlme  nciltfa2rru ont0tpeomfeils m2el(vpnu4 lxrif iotoaDr n olt0t2xr(m ny4ll e netasfarururono0alx  i3iydfa ulnmsnt0texrxocootoaDranvo t)srxoxm io1opeelnct s)sDtaumoot1aeto oeiatfaDrlnvs t)tlermr io1lptrlieils0srtrxmpnodomt mivs ()artaxrpnt4tltnifeiytls umn s;u)tleomfciadomDr i ol(0trum(o3io4oltnliviat)artr(mp;o4aexnmietyslmDumn sn(0tetrif3tadlmtraivi t0 2trio oo4om emnctas)a2tmxrpnu0apx  f3iasfaDelu p u) lermrctydlmtelnes (  rxmxmpio4ll e iei s) rua(rpno4oetn ieildfa2uau o t)arxoxr ta1omD  ueils)srtm(r3io1om n nei s aDtaumpnt4teeniociatfa2emnmp t4tlenmfcio1lmt  ivo ( seum(m ny1lpenlnes t) 2tm(r ;t1tpen iciltfaDemumsnu0trxnmr oa1la e i ols  rtrimpiy4lm n neias)arta(  no0oetn icilsls2em(vo;(0teenxo3oy1oaD  i ils t2xoxo ou1lm   ivil()srta(rono4alto o3iytfa uan p;(4arerxf tatfm eln il(  exo(r3io4lltnmicslt artrxr ;t1olt mociasls ea(mo;()texnmo3iatlptr ivsls0srtoxopoy1ap n ietlt arrau poo1alxnmieiltls raumo;(4areoifcoodomDeaiesl(0seurio3nudole mietls s2rrx o;o4aetnif3ilsfs umums;t) exoxfctatlate u ols)s2urxm oydapeemfei t sDra( o;t4oleoiociadla2elums u0 eenxf iotfpDe uei t0 rto(rpiudolt mnet s  Dumxmo;o1apxo oeiysfm ua( onu)texrio3to1om r nes;t0trtr(m3iy4lmt lies s) rur( pno1oetnmociasfmDea( sn(0 renmrcoa1lm   n s;s0teum(mpou1amenmnctls a2um( ono0alxnmietlt s uluvp t)trxoxr tydlmteli i;(  eurir oy4amen ncia(fa2tmuronu0oexoifcild aDemuvs ()tltoxf3ootla rln o;t t2tmxo3oy4al  mivtat) rua(r no4tpx iieilt sDrm( o (4alxrxrciydfmtrlivs s s2xmim oy1lp  lici t  2ra(r ;o4oltomf3ildfsDea( p;u4 rxnxo3oy1laDrln s;( t2tr(r3io4lmt lictl(  rurum nt1tlxnmf3iatls2elumont)artnif3iadomt aivs;s s2umxo3oydal   fvtltf Dtmxr ot0tle  octlslmDrluvs (0trxnmr3tytoatraieo s)texr(mpny4lp   fvta( srra(rpno0tpeo fetldfsDrluvp t)tltnif io1omD ai olt0truo(m3io1omt  ivslt sDuaxmont0tpx if3iatfs emumpnt0 etomf3oydomteau i;t)t2toim iodlpt  ivi tf 2ta(rpnu0oeenmietysls eluvo u)trtomo3oy1fptrli i ( srxr(o3oo4omt  nesa(fsrrrurono4opxnif3iytls rmuvs;u0altrmr3iy1fp e ieol() euoim iudal  lnvsa(  rrr( oou1alt ifeiydfsDuln on(0 rxnif3totfp  aieo;s)tetr(o ou4llenmiet s  rur(monu0tet mo3iaslsDum( s;u0treoiociodom r nei s)setrio3oo1ll  lfct sf rurumooo1olx  oetysfa2ranvs;t) lenir3tadopD  i s;t)t2xmxo no4op  mnvt tfaDrr(m oo1tleomo3tls s uau s (0alerircia1lat auvi (0 rur(mpoodame lncils)artmxm ;o0aex  oeilt a2rlnvont) eeoir totoa r i o () euo(m3iodlltemnetlt srur(m ou4texnmfetadla rmn snu0trermr ta1late ies;s s2um(m3oudome mnvsa()arrmumo;o4aeen f3iat m emn pn(4 lxomo3oytfp rau olt0teurxm3oudlmenmnvsatf rur(mpou4tpt  feiadls2rmums u0 ltrmo3tytfa rlieo;(0srto(m iy4al emfeils  rua(ront1tpt  ociysla2ra( s t0 etrxf3iy1fatrlneo;s)setr(rpoo1am nlfvt t arumx poo0tle mi3tys mDul(mpnu4trtrmo iatfmDrln i;s  rurxmpio4altnlncsat) 2rrump;t1texnifciydfs2um(vsn(4trtnif3ootoa ran i;s) rtm(r3ou1lm elnctlt aruru p;t1tptoio3iatlmDuauvsnt) ltoir iodfmDr nvols) exriopnu4lm  mfvs ()a2rrump;o4tpx mi3iadls rmn s u0treoif io1la rauvi s)texoirpoy1om nlfvsat a2tax  oo0altnioctas s um(vont)tltoir3to1faDr iei t s2xrxr oy4ol  mfeils a2rmu pno0oexnifeias m uauvs;t0texoxrcoodoaD au o (  eumim3oo1opt lnet t)srtr(m ;t1tlto oeiyd m rluvp;u4teenmo3ty1lm  aivolt) rumxm nodll nmfvtat) 2raum nt1teeomictat s2umums;(4tlxoircty1oatrai s;(0t2uoir io1om n nei (fartau  ot1tlxnifctad m2rm(vp;t) ltoif ta1fp  li o;s tetm(r3ou1lp emfvs t  2umurp;o4opto ieiltlmDem( s;u4trxrmo iy1latraivils0t2xmir iu4opeelnvtat)a2raxr ;o4tlxnmocilt m2uluvo;u) ltnmfciatlmteau o;t0t2xm(r io4optelfeta()aDua(rp;t0opx  feildla rmnmonu)texoirciodopDelueo t  rxm(mpou1olee ies t) Dtrxr nu0tptnmo3ildfs rauvp u4artrmf todfpD lnvi s trtrim nu4ap e icsltfsDrmx o;t1tetnmiciadfs ea(monu0alxomociydomDe iei;s0trxoxo iydol elivi () Dtmx pnt1tle iociaslaDrauvon()texrmfciadfp  an i;()s2tmir nu1ol  lici ()a2um( pnt1aex if3tls m rmn snu)tetoxf iy1laDeai i;s)tetrxopiydaptn ivsls)arrrxmo;u1texoiicias a rluvp t0tltrirctodoat  neo;s0 rtoir3iudalen nei tf 2um(rono1apeomietat sDrmn s u)tlxoircoy1opD  ieils0texrxo oo1aptnmnvils  Dtaumono4ole  ieiatlm2rmn p;u0alxoxrcoatlm   ueolt)s2xoim no4lle lietl( srrrumoou4teto oeildfaDuaumpn()aetnir3io1lmte nvs;s) euoxm3ou1lme mivia()sDum( pou0aptoio3iys m2ea(ms ()trtrxf3oydopDr ies s)tetoxopoy1lmeemieiasfs2rmu  ot1apxnifetyt s emu s t0 exrxf3iodlpteli il()srxoxrpio1ap elnciat s2tmumpnu1aptnmo3ild mDeanvsn(4artrmo tatfm  an o;s) 2tr(m oo1op emfeia()s2tmxm no0apt micildfm2ulumon(4tetoxf oo1lm  livo t  eurimpnu4ape micslt srtmxr ;o1tptnioctytls2el(ms;u4trxoir iatla e uvol() euoxrpoy1lp elieilsf rrmxrono0tlx  ieiys mDumn snt4tlxrxf3to1fpte ivols)truoio3oydal n ivt sf 2urxm ot0alxoifeiasls2uanmont)tltrif3iy1omt aies (0trtmxo oudlpenlnvtat sDrmxr ou4texniiciysla rln o u)tltnir3tydop   nei s  2uo(rpno1aptelnct s)a2raxm oo0aexnmfciat sDranmo;()tlermf oatla elnvo t  rur(opoy1oleemfviatf rur(rono0ale  fcilt sDrluvo;u4treoxfcto1omDrau s s0trur(rpoy4ale livta(  Durxmpnu1oexn ietadla2umn s (0trxomrctytfa elnes (  2trxo nu4oltemivi s s2uax p;t4tle  feiyslm umnvsnu4 etomrctydfptr ivo s seumxr iodlle mfcs sfartau ono0apenmictlsla el(mp ()aleoxf3oa1fptr neils)t2trxmpiodlmte ivtlt  rum(m nu4oltn f3iasfa rau s u4 reniocoytop eaues;( trxoimpnu4al  miviltf rtau  ot1tlxnmieild s ran s t4 etnmr todomtr nvils s2urir3io4llenmnvia( sDrru oou0oeeoio3iytlm2ran p;()tlxoioctotlmDe ivils  eum(r3ou1ole mfvta()arua( pot1aet mfciasfs ra(vont0 rxrmoctatla  auei s t2trxo3iy4lmenmfvt ( sDur(mont0alenmo3iaslmDuluvs u4 lxoir3totoaDeln ol()t2tmxopou1ole  ies () 2ururpno0alt moetlt m ua(von() ltnxf3ia1lptranei;t)setrxmpiy1ale mieiltfs2uru pnu0oex ii3iysfa2emump u0 rxoxo totfa raies s0srxr(mpoo4open iesasfartr( ono0altomicilt a2rluvs t)alenif tydoptelu s;(0t2urir oudom elnctls sDtmum ou1texomfetad s2ranvp (4trtoxf oadlm eaivi;t) 2xoio3oydopte iesat s2raurp;t0tle  i3iadls2emnvs;t4arenmf tytfpt auvol(0seuoxo ou4oltemfvsasfsDrr(rpou1apt mi3iadfaDrmuvs;u4 etoif oatop   uvo ( teuoxm3oo1am   ietltf Drm(m nu0oet  oeildls2umnvp;u)aexnmf3iy1laDeaivo;s0 exm(o nu1al emnvta()srtru pot0teeniietasla2rmnvo ()tlxniocoy1fm raivil(0sexr(m oodaptemivt s  rtru  ;t0apxnifeilsls uaums;t)tltoxrctytlmtran sl() 2xoxo3nu4lmenmfvsat s2tax  oo4tlxnmi3iysls rl(vsn()artomf3todfaD  neil()seto(r nodame livta(faDta(ro;u0aptomfeiltlm2rlu pnt) reomo3oy1omDeliei;t) exrxo oudlm nlnvi sf ruaum nu4alxniieiatlaDemnms t0 reoxf3iadom   nesl() etmxm io4lpt  ncs t) 2tm( poo4oeeomfciyslm elu pnu0teeoxf3tydoat  ueols0 euoio3oudape lfct t  Drrx  ot4alx mfciasfsDelnmo t0arerircoo1fpte ues;t)trxmxr3oy4ap   ivi (fs2umxmpno0tptn f3tldfm2raumo ()tlerxf3iatlmD aivi;s sruoirpoy4al e fet (f Dtmur ot0apx miciaslsDrau onu4arxoif iodomD aneo;s0sexrxopno1ope lncs t s2trx oou0texo feiysfs el(mo u0tlxrmf3ia1om e iei;(0 exrirpio1lleemfciasf Dtrurpoo4tpe  ietydfs eanvo t)tlxnif3to1fpD aivs t0s2tm(m ny1ole  ietatf rta( pnt0aetnmo3ias s2uanmpnu4aexnxrctadomtrluvs;s0seumimpno1altelfetatfsDraumpoo1tlx  oetlt a um(mp;t)tlerircoy1oa  lies t  rumir3iydaltn ici s)aDtmxmpou0aleo icilt mDelu o (0tleomf oy1lateanes t) 2tmxopio4lm  mnesa( srtm(monu1aetnioctydla ea(vp;u)aleoxo3tadfpt lneil(0srtm(r3iu4lm nmncs s  rtaumpot1aexnif3ilsfmDrl(mp;(0trxrmo ta1lm ranesl(0sruo(m oudop  mnet ( aDuauro;o0apxomiciltfmDrmn p;t4aetomrctydlmDr u o s) 2xrir3no1op n nei sfsDtaur no1opxoio3ild aDrluvo;u0tlermfctadfaDrau o () rxmxmpoy4amte nciasfsrurx  oo4opeoif3tydlm2ea(vs t)trtomoctatoa raieilt teuoxr3io1lm elncsat) rtmu p;t1aex miciydlaDemnvo u4 rxrxf oatlm  lnvs s0t2tmim no1lpeelneia() Durx  nu4tpe  iciys m uanvont0 ltrxociy1fmDr ivilt0s2xm(r oydol emncs () Dum(r ;t4apxn o3ild aDua(vsnt4 reoif3tadopDelivils) rtm(m3oodll nlietls  2ua( onu0ale ifeilslm ulnmp;t0 lxoxocio1laDe neo;s0seuoxm3ou1ap elict sf rurx oou4ale  ictldfs umnvsnt0 reoiocoo1fmDrai o s0s2urxr3no4om  miei t)aDraum ot4tptn fctld a2rluvsnt)trxnxo iodoate neo t) eum(r iu1al nlfvtl(  Durur oo0opxo i3tld s emnvo;t0tlxrircty1lpt auei;s  eurxr3io4aptnmiei sfsDrax ooo0tetnmoeias m2elnmpnu4aeeoxo to1oatrlieols  etoio iy1apenlneias)aDraxmo;u0aeto octyslm2umnvp u)arxoirciatlmt liei t)trurxr iudopenmncilt) rtm(mp;u1oleo fetlslmDumnmsnu0alxoircoydla eli s t truo(rpio4apenmnvi s)s2ra(rp;t0apx ioeilt aDrluvp;t4 exoir3tadlp   uesls)t2umxm oodam  lnesl()a2rrxmont4olt iiciyt sDemu pnu4 lenxoctytlpDelu o t trtm(o3iy1lmtnmfeslsfsruru  ;t1tpt iicild m2rm( p ()tetnmo3iytfmte neo;() 2ur(r nu4aptn ici ( s2rr( pnt4apeomfctatls rmuvsnt) exoxociatop eanvi t0teurxopnu4oltelnviat srurur ;u0tle mo3tysfm uanmo;t0 etnmr3tydfpDrlues;s t2xr(o3oudap  liesltfaDra(mo;u0olenmieiatla ra( s;t4tetomrcoydlateau o s) 2xm(m3nydlm n iviltf rtmxm ;u0tltomfetatlsDua(mon(4tltrmrciatfptrauvi t0 eur(opoy4ll n iei tfa2trxrpno1tlxo ieilslaDulu on() lenxrciydoa raivi;s  2xmxm3iydlm  mnes t srrmx  nu4texo ociys aDelnmsn(0trenio todfmtrliei t) 2urim3nu4lle  neiltfaDur(r ;t0oeeomietls aDelump ()aleoir3ty1oaD aies ()srxrxr nudlp  mfvsa()sDrrxr nt0aptnif3iys mDean ont0 exrmfctytfmDrai i;s)setrir iudoptnlnvt tf 2ra(mpou4alenmi3tadfa elnvp;(4teerxo iatfat  uvs;t)teumxopiydomee ivsasf 2taxmp;o0aeto ociad m emuvonu4tlxoxocia1fat aivo s  2uo(m iodaptemict ()a2um( ooo4tet  i3tasls rlnvp;u0 lerio3ia1fmDeln o t) 2xm(rpiodapenlicils) 2taump;t4tpxo f3iysfm ulnmo;u0trerif iodfp  aueo s)s2tmxm nodomtnmivia(fs2umxr oo1oetn ietas a2ul(ms u0 rxrio to1omteaueo ( s2xr(o nudame liei s a2rrum no0tlen oeiyd m2el( snt) rtrmociytopt  ivs s) ruoxmpnudlp nliesatf Drm(mono4oeeoii3tad m2rluvs;t) lxrircoadfm   ies;s0 rxo(o oo4am nlivtat s2trxrp;o0apenii3iysla2raumont4 lermo iodlat au i t)trtoio iu1lpe mnes ()aDuaumo;u4oleomictydla umumpn(0arxnmo tydop raiei;s srto(o nydlmeemfcia(fa2tmu pot0ole  f3ild a2elums;(4 rxoxr ta1optr ueo;( t2xo(o nodam   ncsl()a2tm(  ;t4opx mfetatfs2rlnmo (4tlxrxfctodoa  liei;t0 rxoirpnudlp e ietl(faDta(  nt0tleoioetldlmDum( s;(4alxoif3iodoatrlnvo;t0 eurxopno4apenlictltfa2um( o;t1olxo octyt mDeln s;t)trtoxo3tydlpt luvol(  2xo(opoo1al nmnes tfsDtauront4tpt  f3iyd a ua( ont0 eeoxo tadlpD aieils t2urxr nu4al nmics () Dtaxm ;o1texn fetad s2ulnvo;t4aexnxo tadfp  auvo t) ruo(r io4amtn nctlsf Drmx o;t4oeeoiieiyt s2um( p u4 rtoxrcoadfpDelnvs (  rur(o nu1ol nmicsat) 2rm(moou0alt  ietyd a rmn pnu4trtoir3oytopDrlivsl(0setmim io4am  mfvt t) Dtmxrpnu0tpxo oeiad m rmnmo u) rxnir oytfmDrlu o s  2trio3io4lp elfeta( a2rrur ;o0oltn icias mDrmu o (4 eeomr oydlatean s;(0seurimpou1ol nmneilt)sDrrx oot0open feiat s2ran pn(0tltnxo3iytomtrlueols s2xmiopny4lm nlnvs sfa2tax  oo0altomo3tlslmDranms;t) rtoir to1om  ln sls) 2toir ou1llt  fctas sDur( ono4aptn ieiys a2el(vs;t4alenxr io1fa r ivolt trumxo oodoltnlnvta()srtau ono0tpen iciys sDelump (0 etrmo3oadoa r n ils)srtrxr iu1al n neslt artru p;u0aeeoif3iltls2rluvp (0aetnxfcoytlpt ln i;(0t2tmio3io1lp   fcilt)artau o;t1teeniociytlm2rmuvon()treniociytlpD  ues t0 2toir iy4om nlnvi t)artmxrono0apxn ociltla2ulnmont4alxoio tydfmtranvs;t0 eur(mpnudamtn nci tfaDraxronu4oexomoctys aDeanvs t)trenmf iytfmt aneslt0 exoxopoy4omtelnetatfsDrm(r ;t1tet mietytlm2ran p t)teeoxr3oy1fpt aues t0trumxr oo1lpen fctltf 2tau  nu4tptn o3tyt a2ua( p t0 etoir3iytlmDrli ilt) rtrimpoy1olen ics tf Dua(m nt4altoio3iyt m emumo;u0 exrxr tatfp elu i t)sexoxr iy1om n iesat) rtax p;u0oltoio3iytls ranms (4aetnio tatopDeanvs;(  rurirpoy1lpte ivia(f rtrxrpnt4opxn fctasla2uauvpnt4aexoif3todlmDelueo;(  eurio3oy1omenmfetatf Drr(mooo0alx if3tasfm um( s;u4altnmo iy1oatr i i;s0t2toxo ou4lmtnlncsa(fs2rmx ooo4tlx mfctyslaDean o (0tlxrmo3tatfpDe uvs t)srtm(mpoudamtn ivslt) Draurpno1aet  ictld m umumo t0 rerio3iytlpD aivo s0texoxo io1lm elictatfartr( pnt1aeen f3tysfsDrlumpn(4aexnmf oydom   n o;() etm(opiodlm e fvia( a2raur ;o0aee  iciatfm2rl(mpnt4 reoxr3iytfmtrlivo ( srtm(opiydlpenmnvslsfarumu  oo0apt iictldlsDel(mo;t)aetrmf oatomDeau s s)t2xm(mpno4am   ici t)srtau  ot4tlt ii3iysla2rl(vsnt4aexnmrcoadlpt li olt0srtmim nydlm  lnvslsfarumur no1oex iietldlsDem(ms;(0 ltomr3tydfatr uvolt srxmxm3io4lm emfes ()aDtmxrp;t0tltnmfeiysls eanvont)tltrmo iotfate n i;s)setrirpiu4opt livta( s2raur ;o0opeomo3iltlmDrl( o (0aeenxfcootoptr ivo (0teurxrpiodll emicsls aDuau pnu0aetoifciasfm2ra(vpnu4 lxoifcoadfmDe uvi;()srum(o nydopt  fesasfa2tr(rpou1tex ifciat a ranvpnu)aeermo oydlat auvi;t  rxm(m ou1am emfvsatfsDumu p;t4tlen iciad m ulump;u0trxomr3oy1faDelieo;( truoimpiudamtnmfct ( a2truroou4oetnio3ildls ua(ms u)arxnmr3iodla  aieo;s  rurxr3nu1omt livi t) rra( p;u0opxoifeiad m rl(ms;()aexrxr3todfp rln i;t  eur(rpou1lpenlfvt (fs2umx  ;u4opxnio3iys s2ua( s u0 ltnif3oatopDr nvo ()teuo(rpnudlp elncs ()aDum( pno4oexnmi3iydfsDeln p;t0artrxo3oydlpDrli o s  2xmxopou1lm  lnesls)aDrmu ooo1tle mi3iltfm2em(vp;() exnif ia1om  lnvsl()srxmxo iodop   fvtlt) 2rmx  ot4alt  feiltfm rluvsnu)aetomf ia1oaD  ueo;t) etmxrpnu4am n ictat aDtaumpno0aeen o3tyd mDuaump;t4 ltoxo oodfatraivi t0 eurio iu4olt mnvs (fsrrrxro;t0tpx iociydfmDulu pn(0tlxoxf iytla   uvo s0srtm(o3ou1om nmietas arrr(mpot1altnifetldls ean o;() exoif tatfp rlivsls)t2tmiopny1llt  ies (f rua(ro;u1olenmf3ildlsDemnmpn(0aeerio3tadfatelieol(0seur(o3io1open ncs t  2rm(ro;o0apt iicildfs ra( s t0 reoiociadlmtraues;t seum(r oodopeemnviat)sDtmu ono0tpen feiys s rln s u0treomfciytfpDrauvsl()texr(rpoo4ol nlneia(  2ra(m ou1ale iieiaslaDeaump;u0 lxomfcio1lmD ln s () exrxopoo4lp elfetlsfa2ta(r oo4tptoifetytlm rl(mon(0 lxrxrcoadom eanvslt)s2uoxm3oydol nlici t  rra(rpnu1tleomi3iatls2elumo;(4 rtnxocoo1oaDraueils t2um(rpoo1ole licsl( aDra(r ;u4aex  oeiydlmDra(vsnt0alxrif tadfmtrlnvi;t) rxr(opnodlltemiei ()srra(r no1tlxomieiatfm2ra(vsnt0aeerirctydfaD ai ols0 rurir3ny1olt mivi s srrru oou0teen fctysls elnvpn()trtoiociydopte ivo;s  2toxr3nydop n nesat srrm(moou4teto f3iytlm rauvonu)trtnmo ty1opDraies;s)tetoxo nu4ap e ieslsfs2tm(rpno1olt  ieias m2eluvpnt)aetoxo3oy1fat aueilt s2uoxmpnudolt lfctltfartm(  oo0alenmi3tld s elu p (0 etnmo tydomDe ues;t0trurxrpno4am e iciasfsrrrurpou4oeto ieilsfs eau sn() eerxrctytop  aies;s teuo(opoodoltn ivils aDtaur no4tpeomo3tysla elums u)aeerio3ia1om  lu s t0sexmxm oydlpt liei ( srumu  ;t4oleomiciys a eanvo;t0artnir iydoat aiei (  2toimpiu4oltemnes s)aDtr(mpnu1tleniieiysfs rmnvsnt0aexoxo iy1opD an ol( t2urxr nudlmtemivi (faDraxro;o1aeto ietytlsDrlnvp (4 etrmocoy1lp eaiei;( sexmxm io4ll elfvs (f rrmumo;t1teeoiieiytlmDranvs;(0trtrio3tadomDelu s s srtrimpou4lmtn ies t sDrmx o;t4ope  ictldfs uan snu4 ltomf3iytoaDrlivilt)texoxo ny4llt  neiltfarra(r ou0apxnifciat s2um( onu)aetomo io1laD  nei;(0s2urio nodom nliei tf 2rmu poo0oleoii3iytfs ul(vp;u4texomfciotfpDrlueol( texrimpoo1al   nvia(f Dtau  nt0opxnifcilsls rmnvp u)tlenmrcoodfm eai olt sruo(mpnodlmt mfvsls  Dra(rpou4tpx mictysfaDua( onu4tlerxr tadop elneo;s  2toxo3oy1altn fct sfaDtrxmo;t4tetniiciltfsDrmnvs;t0 lermfcia1laD lueil() exoxm3nu1olteliesa() Dtrum ;o0alxn iciltfaDem( p ()aeeoxr3tatopt livs;(0 etoim3oodap nmieia(f Drau p;t0tltoif3iatla2raumonu4aexoir ootfmtr u o s s2uoim oudamenlfcilsfsrtr(  no1aleomf3iydfs2umums (4aeeniocty1op e nvo;s0t2xr(opiydome lnesl(f rrr(mo;t0tex if3ilsls2emumo;u) rerxo oydlptraivi (0 2umxm io1lmen neiat)sDtr(m ;t1opt mi3iyslaDel(mo;t0tltnirctytopDelueo t0s2uoimpio1ameemietasf rua(m ot4tleo fciyd m2um(mo u)aetrif3iotfp eaieo s0trtoio3iu4ol emivi tfsrtru  ot4oeto icias a2ul(vs u0trermrciy1faDr ieil()sruoiopnodameemfciltfartaumpot0oeeoii3tldfm elumo;t4trxoir3iatfaDe i i s) 2to(r3ou1altn ncilt)s2rm(mpnt4oeen oeildlm rln pn(4trenir iytlm ranvilt  exr(mpoo1lltnmnes (fsDrmum ot1oeen oeilt sDra(vp t0alerxoctadomtranvs s s2tm(rpiu4olt mnetas artrxmont1opx iictyd s2ulu o;t)teeoio3ia1op eaueo s) 2xmxrpou4al n ies (  Duau  ;o4apen i3iyt a emu s (0tlenxf3oo1fmDeai o s0t2tmxr3oy1ll   fvilt aDur(rooo1ale  iciysfa umnvo;u0 rxnmf3oy1oa elieol( texrxr3ny1apee ncs sf rrrumono0alenmfetysfmDea( ont0trxnmocio1lmD aivo;s)s2urim3no4op   fcsasfaruax  ou0alx iiciytfa2ulu p;t0aeerio3oy1la r nes (  rumxm3io1lmt lfctlt) rrmxmonu1aet  ociadlaDelumonu0tlenxrciytfpDeln s t0 eto(o ou1amtnmfetls)aDtm( p;u4olxniictadfaDum(vp;(4teenxr3ia1opD  neo t setmxmpou4alee net t aDtmx  ot1tpeomo3ils m2rl(msnu)aexnif oadfa  an ilt s2tmxm3oudlpt  nvia( aDrmx pno0tptn i3tydlmDemnvs;u4 exnxocoydlmDe iei;s0sruoxopiudapt  fet s)sDtmurono4tleniociyd a2rmums t4 rxnir iotoaD lnvsls) eto(m3ou1altemicias a2tau  ;t0alx  oeiadfs uanvont4 ltoir oytfm eanes;(0sexoir3nu4opt lneias aDuax  ;t4apto iciatfsDrm( s t4teerio ia1lpDeaieo;s0tetoxrpoy4amt lics ( aruaurp;t1oexo o3ildfsDranmp (0aetomf3to1lmtrln s t0s2xo(rpoo4lpe  nes (farrru o;t1tlto fcilsla2el(vo;() rxrxrciodlpt lieol(  rxrxo3oudamenlfeslsf 2ur(m ;u4teeomo3iltlm elumonu0artrio3ia1lp raies;(0 exo(m oo4om  lfcslsfa2rax poo4aeeoiocild sDem(mo;t) lxrirciy1fmDrlnvi;t  rtoxm ou4aptn nes (fsDur( pnt0oltnii3tldlmDelu pnt0tltnxfcoo1om raivo;() euo(o3no1opte ici t  Duru  no0tetn f3ils aDrlu o;(4 rtnmocoodfp  aieslt)trtr(m io1llee ieslt sDumxmpno1altnmo3iltlm2umums;u)aeeoxrctodlmDelieo;t0 2xoxm oydll elictls  Dtrx pno1tlxnmoctasfsDrmn o u4artomo3oa1omDr nes;s0 ruoirpio4ome  ici ()srraxroot0oexo iciaslsDran p u)alerxo3iotfpteauvi;s0srtmir nu1aleemneilt a2ra(monu4apt iociydlaDrmnmsn(4tlxnmr3oytlat ai i t0s2ur(mpoy1alenmfcils srtm( ooo4olt  f3iat s el( pn(4aetnif ty1lmt lu s;s)t2xrxo io1lpenlnvt () Drr(mo;u4apeo feiydlsDran on()tlxrir oatlmtraneslt srtm(o oydap n fvias  Dtmxm ou1optn f3iasfm rl(ms u4trtoxfciytlpt luei;s s2tmio3nu4olt licsasf 2umxr oo4ape mo3ild a2um( s;(4 lenmr tydla  anvols trumiopno4al nmnvias  2rax ont1tetn ieilt a emnmp (0tlenmf oytoa eai s;s0trtriopio1apeemnvi s)srumxmoou1aetnmoeilsfm rlumsnu4trxrxociytoa   ueol(0texo(o3oudam emict ( artaurp;o0olenmietlt mDumnms (0arxrxo3oy1laDr uvo;t) rxm(rpiu1lmeelivtas arumum no1tpen i3iyslsDrmumo;t)tetnmrciytlmt aivsls  etmimpnydlmtelnvt tfaDumxmo;t0tleo o3iys s2uluvs;()tleomocoytfaD lnes;t0 euoio3iu1al elivs (f Drrurpno4aexnioetlt mDranmsnu) exrio3iadlat livi (0s2xriopoudomt mfvilsfs2tmum ou0apxomietldls rln s;(0 rxnio3oo1omtrlies t  2umxo3iudll n ncsatfartr(mpoo0apen o3iys s2ranvp t) eermo3iotlat aiei;t) exo(m3iudap nmnvtatfarurxro;o1apxomfctltlmDrlnmo;(0texrmr oydomt an ilt0 eurirpio4ope mivtls) 2uru ont0tpeomf3tatlm2ua( snu4tltnxr3todlaDrauvs;s trxm(r3iodolt mfci t aDrr( p;t1tleo oetat a eanms;(4aetrxf ootfm eanvs;(  2ur(o io1lme livia( sDrr(rpou0aexomietls sDrlu o u4tetrxfctodlaDe n ol(0tetm(m oo4omt  ncta( sDtaum no4apxomi3iad mDrmnmsnu0tlenxo oo1lm eln s;t0 eumim3oudlpen ivtlsfsrtrxronu1tpxn ieiyslm emnvo;t) rermoctatfaD  ueo s)trumxmpoy4alt  ivt s)sDtr(moou0opeo i3iatfsDeauvp;t)alxoifcty1fmt lneilt0 2xriopnudome mnetls)srtrxr nt4aeeomicias a2el(mpn(4trxomo oodlmt  uei;( t2xmim oudomt mfct s)aDrrxro;o1opeo oeilt a2em(vs;(4alxnxo3totomD  n o t)truoir oydameelivsls srrm(m nt4apto i3iydfmDrlnms;(4aetnxf3iydfpD au s s) ruoio3ny1ame mfvt ()srtmx ont4oexomi3iatfsDemuvsn() lenxrctotoa raieil()setr(opou1lpt mnetasf 2rax p;o4tpt  f3ilsfs2ul(vo;(0alxoiociy1fmtelnvo s)texoxr3oy4aptemnci t) 2umumpnu1oet ifetyt a2rlums;t) exoxfciytfmDr ueo;t0 rtmir3oo1lp  lnctatf Dum( oot0tpt moeiyd s umnvpn()trermf iytopteanvo;t srtoimpio1al   neias)aDtaxr ;u1aptnmieiad s ea( pnt) exrxf oa1om   uei s truoimpiu1amtemicia(  rurumonu0tlx iiciyslmDelumpn(0 ltrircta1lmtraneil(  exm(rpiy1lp elfvsat)srtr(root0alxn f3iatfs2ulnvo t0arerif iydla  ln ol(0 rxr(r3nu1olte netls sDumxmonu4oexn i3tasfa2eluvsn(4tetrxf tadlmDraivils) eumirpoo1omenmnvs (  2ra(m ;u0aptnmieiadla ua( p;() rxnmocty1fa rau s (  rur(r iu1ll e fct s artrxmooo1texnioctydlm2umnvo ()aetrmf3ia1faD  u i;s seum(r iudam nlfeias  Dtrurpnu1aexnmoetytlm ul(vs;t0 exoxr3tadopteaivs;s t2xrio oydll emneiatf Drrumpnu1tpt mietlsla2rlu pnu0trermf3oydoaD lu o;t)t2umimpnu4am  mncta(fa2trx p;o0tltnmo3iatfm2rlums u4 rxoioctotom elivol()seuo(m3oy4opte fetl( s2rmur nu1optn i3tatfs rlu o;(0 lxnmf3tydfm  ln olt)s2xrxrpoo1omeemicsl(f 2trx onu4oeen ietadfsDra(mo;(4aetnmo ootlpDrau i (  eurio3iy1altnmnes tfaDum(  ;u4olto fciad m rm( o () exrmoctatfpteanvols0texrio nu4omtn ivsa( srta(r nu1tetoio3tldlm ea(vs;(0 leomr3todlp   nei t)trur(opiu1ome lnvi ()sDra(rpnu0olenifeiyd a rmumo u) rxnxfcoadomt  uvo;t t2trimpou4aptemietl() rua(rpoo0opx iieiadfaDrl(vo;() eermrcoytla  aueo;t  rxr(o io4lp nmnet tf rurumpoo0tpxoifcils a ul(vont0 exrxo3iadla rln s s0trxmxr iy4lp nlicsat  2ra(ronu0aexo f3tad a2ua(vp u0treoir to1faDrlu i (0t2xmxo3no1optn fcsas)aDtaxrp;o4tpxoioctatla elumpn()arenmrciadomD ai o s0 rxrxopoydaltnlfeia(f rrr(  ot1tltn ociltls2rm( snt) rtnmr3ty1laD aivolt) etm(mpoy4lm e ictas)srrrxmpno1altoifetyt a rauvpnu0tlxomo3to1op r uvo;s seumxo3oo1op   ivil(fa2urumono1tlenif3ildla2umums;t0 eerio3iotoptr nvo;() 2xrio3iodlmtnmfvtlsfsrumxm ot1tle  fctys aDeanmp;(0texomociydomtr i s (0 2xoio3io1opt  nctltfsrtaxr ou0ole  ictyd a2eauvo u4trxomo iydoatr nes s sexmim3io4llenlietls arrr(r nt4aet mo3iadfsDrauvo t)arxrmfcoo1lpt anvo t0srxoxm3oodape miesa(fartax  oo0alt  octlt s2rm( p;u) etoxrciadlmDe nes t0trumim no4am   nes t  Drmurono1tlto o3iasfs rm(vp t)trtnmo3todomt an s;(  exrir3oy1amtnlfcils  Dumxm oo4olxo icilsla raums t)arxoxo3iadfa e ies;()texoirpny4omeemnvtat)srrm( ooo0aeeo iciad s eaums (4altnxf3iy1omDeauvo;(  etoxm3ou1alee nesa() 2rmur oo0openmfcilsls2raump;t0 lenmr io1fmt lueol()s2um(m3iodal   fcsas s2taurp;t1tlxniieilsla2raumonu)tltrir3iatlmDraneol() exmxr3nu4lp  mfvi (fsrrmxr ;o1ole mfciydlsDean s (0trtriociydfmte nvolt t2xm(o ny4al  lfesa()s2tr(mpnt0oetnmiciasfaDrlums;t0 eenmo tadomDr ivo;()t2triopio1ol e fcsa(  Duax  ;t0tex  i3iydfa uanmsnu)trxomr3io1fpDranvi t)s2tmio nodlmen ivtl(f Dtmxr nu0aexnmoeiatlmDrau s u0 leoifcoodfpt auvsl( texo(m3iy1op n nvtasf Dtmumpou4openmoeias aDranms t) reoxoctadlateli s;t s2uo(mpiudap  mnctas a2rrxm oo0aetn o3iat mDeaumo;(4alxoxo3iydfptr uvo s)trxrxmpnu4ap e fcilt)artmumono4aetoioeiyt a emnvs;()arerio ta1lp eanvi;(  2to(mpoo4alen ivtat) Duau oot0olt mi3iad m rl(vonu4 exnmo totfptelnvo ( trur(m3nydoptnmfetlt  Dururoou0aptn o3ild a2eanms;(4trxriocoa1fmD  uvi;(0texmxr3oo1ol e neilsf 2rau o;o1altnmi3iatfmDuanvonu4 rxnmfcootfmDe u i t)sexrxm ny1olen ncsls  2taum ot0oltnif3tatfm ulnvp;t4 etnmo totoaD anvi;() rtmir oudapte nvs ( aDuru  ou1alx mictys s2emnvsn(0artnxo3iatfmtrau sls) 2tr(rpiodolenlneslt  2rmuroot1optnmi3iydlm em( o;t)tlermo3iodomDeauvil()texmim3ou1lm   fei s)sDtaxr nt4olen fciltlm umnvp;(0 leomocia1oa eliei;s teum(opiudoltnmfciatfaDumumpoo1aex iociys s rm( s t0tlenxo oodfm elivs ()t2toirpiy4llen icsl(fsDrr( pnu4opxoifcild a2rln pn()artoxrcoydfatrli il()truo(opiy4lme mnvt (fsrtaum no0aexnifctys sDua(mont0teeriociodomD aieol( texoimpnudlpeelnvtat  Dur(  ;u4aleoio3iyt m eanvo;(0altomr oa1la eai i;(0s2tm(o3ny4lpen fesltfsrta(  nt0aetnmf3iltlsDuluvs;u) lermfciadomDraneo ( setm(opno1lmt  ies sf rtrx onu4aleo i3ias s2ea( s (4 lerxrciotoptelu slt sexoir3oudapeelieiat)arrrurono1apxnmf3iyt m ea(vp u)tltriociotlaDelu o;t sexm(o3ny1lpt mfcsa(f rua(mp;u1oltnmf3tydls2emums;u0aeeoxrcty1oatr ivil() exmirpiodolee ivilt)sDtrxmoou4tpxo oetatla2el(vo t4tlxoxo3oydlpDrlivs;() 2tm(m3oodome lncia() 2tm(m ;u1tpx moeiyd m2uanmo ()trtnxo iadfaDrlues ()tetmirpoudom nlncsat)aDra(mpoo0aetnioetas m2rlums ()teenif3oadlm eluesl( trxo(m no4op elfvt ( aDrm(m ;o1tle  icias s rmn sn()tlerirctadlm  aivo ()srto(r nu4lpt mfeiltfsDtrxm ot4tet iociasfsDrmnvpn(4treomf ta1faDrli ol( tetrxmpnu1llenmfes s)aDtmum nu4aeeoifciadla emnmo;(0altrxo iotfp e nvslt teum(m oy4omtnlnvtat a2taump;u1aexomfeiad s rmnvon() lerxr3iydfmtranvi;t0 2xr(m oudlmtnmfet t) rrm(mpou4tetomo3tasls2rlnvo u)altoiocootlmt aneils trum(m oo1opt lfei tfa2ta(mo;u4tle mf3tasls rluvs;t4altoxo3tydopDrauei s)teurir oydapeemnet (  rtmxm oo1tetn o3tlsla2uan onu) lxrmf3tatfp rauvols0texmxr3iu1ome mneilsfsDuau oou1alx  oetydfmDul(ms;u0tlenmo3oydfat au o;(0s2to(m3no1om n nct (  Dtm(moot0tpt ii3iadfs rm(mp (4tetoio3iytlp eai s t) euoir3iodll  lnvilsfsDumxro;t0optoifctyt a2emnvs u4tetnio3ty1lp eli ilt  exriopnudam   ietat arua(r ou1tleomfeiaslm2rln o u)teermo3iodfa  anvils)seurim3ny4lp  liei sf rtmu pnu1texo oetyslaDrm( p t4tlerxfctytfpD aueolt srtmiopiy1lmenmfvsls)srta( oou0ope  octatls rlu pnt)tltrifciy1lmD  ues;t)sexm(r nu4lmte fcsa( a2tau oot0tpx mi3iltlmDumnvp (0altrif oo1fm ran s;t0trtrxmpiy1lp eliei s) rtaurpou4tpxoiiciad s2uan o;t0areoxfciadfpDran s;t0setrio iudaltelncsat s2urumpnu4apen icias a2eanvp ()tltnirciytfmt  n i ()trur(r3io4lp nmfvtl()arur(roou1aex miciatfs eanvo;(0 reoif3oodoaDe uvs s0t2trirpoo1op e fvt (f Dtru o;o1tleomocild s2ranvon() lxoxo oy1lpD  iesls0seur(m3ny4lmtemiet t)arur( pou0oex moetysfa raumsnu4texnxrcoy1fmDrlieil()seur(rpiy1opeemnvslt aDrmxr ou0olxnmociadfa2ea(vo;t0 rxnxfcto1lpDeli s;s0 2xrxr iy1lmtemfesas srraxrp;t0oltn f3ils s2uanvp;t4tleoxo iadlat aueolt0s2xm(rpoo4ome  netasfaDtmump;t0olto feiadls ua( ont0trtnxo3iatop rai s;s0srtoio3oo1op  mivsl(fa2umu o;t1tlx  oeiytfa2eau pnt4tlxoxr oatfatrluei;s0t2triopnodam  lietas  rtmumpnt4opt  oeildfm2emnvo;u0tetnirciydoa rlivilt) exrir oydlm   ict tf Duaumo;t0apx iieilt aDrmu snt0teeomocoo1fptrluei t tetmirpiudome lnei (fartauro;u4tlxnmocils a2rl(vonu4arerif3oatfp ranvi;s0 etrir io4ll nmfcilt  rtmu oot4oetnio3ilsfa2um(mp;u)altoif tydfa r uvo s0 2uoir3oy4ol nmictlt) rua(ro;t0tee ifciytla2el( s (4aeenxr oydoptr i il()t2xr(m3nydomeemfvi s)arurxmo;o4tpe iocilslmDemnvpnu4 etnxoctytfpD  nvo (  2uo(m oy4al e ici (fa2rmu  nu4aex if3iysfsDul(vs t0aleoirciytfm  anvsls0trxoirpiudlpt lnviatfsrururono0oltoio3iys m2rm( s u4artrxf3iydfmtelivo t)trxmxo3oy4altemfesl(fsDurxm ot0ope  o3ildfm2rm(vp u)texoifciatfaD aivil(  etr(r3oy1ol  lneil( arumumpno4oee ifciad a2uln sn(4texrmrctodlmte nvo (0srtr(m ou4op n ieiasf Dumuro;u4alxoiieilsfa2emn on(0 ltrmociadoatelivs t)teumxm3iydom nliviltf rur(r ;u4aexomoetydfs uauvsnu4 eerif oo1lpt  nvs;t)srxm(m nu1lme  icta( aDra(rpot1tltn ieiytlm2ranvs u)aexnxociodlp raivols sexoim3nydlleemicsatf Drmxrooo0tpeo i3iydlm2rauvpnu4 rtnif iy1lptr ivsl(0srto(mpou4lpte ivil( artr(rpoo4ole  icilsfaDem(vp t) lxrifcoodopt au i;( seurxr3iy4lpte fcslt) 2tmx  ou0aee  i3iatfs2rmnvonu)texnmr3iadfaDelu ilt)srtm(o oydal  lnci t  rta(  ou4aet mo3iadlaDrl( p;t) lxnir3oytlate neil()s2tr(mpnodap nmfvias sDtmu oot0tpxniieias m2em( s;t0alerifcoadlm eai s s)s2xm(m oodap e ivtlsfa2um(mpou1tetn oeiys m2rlu o;u0 exoxo3iy1oaDelneo s0teur(r3nu4lp nmfcs s sDtau oou1alxn oeiadfs rlumont0tlenxr ty1op e ivi s  rxr(o3io1am   icsa(fsDtmu  ou1opx  o3iat a2em( s;t4 renif3oydlpD aues () rtmiopnydlpe  nvtl()sDumxr nu4apt ifcilsfs ulnms;u)alxnio iatoatraueols  rtr(o io1amte fci () Dtm(ronu1aexoioeils aDuauvonu4tlenxo3oatlaDeau sls0setoxr oydoptn ncs (fs2rmx  oo0ope ii3iysls emums t0alxoif tytfm e ueilt0t2xmio3nudlpen fes ()srrauro;t0tptomfeiltfm2rlnms;t4trxoir3to1lpDr u ilt0 2xoxo iydlptelfvsa( aDraumpou4apen fcild s2uaumsnt4 eeoxrctadfmD li i;t)texr(o ny4oltnmivsas  2tmumo;u4ole if3iydfmDrm(mo;t4texrxf tatfa   nei t0srxrxmpiudlm emnet (  rraxmpno1alt mo3iys a2em(ms () ltniociotfpD luvs t srxmxo oydomenmncslt sDrm(rono1optoifciyd m2rmu o u4aetrxf3iatopt luvsl()t2xrir iodal nmncs t s2ta( oou0tex ioeiltlmDeln ont4aleoxf3ta1la  luvo s  rxmirpiodlltn nctls  Dumum ;u1alt iietlslm2um( s;t0texnmrciadopteanes s0trxmir nu1ame mfciatf 2tm(m no1aleomf3ils sDra(vp;t0 rerxr3tydomte u s s0 rtmirpnodam nlfetl()sDuaxr ;t1tpt  o3tadla2um(mon() lxnif3oadfm ranvi;()setoxm3oodoptn nesas)sDtm(mo;o4tltnmietldfaDulnmonu4tetnmfctydfpD ai i ()trtoir iy4ap elneta(  2trxrp;u0tetniociasfsDum(mo;t4 leoxr3oa1faDrluvi (  2xm(m3iy4ll n icsl(fs2tmumono1tpto icias aDra(ms u4arxrxfcoydoaDe n sl( teurimpnydolenliet (farrau o;t4tpto oetldlm2emu sn(4aetomo3ty1lmD auvo s0tetoxo iu4ome  ncsas s2tmuroou1opeo ociadfmDrl(mo;t)tltoxr oy1fmD aieslt0 rtrxr3oudlme mici s)a2umumo;o0opx moeiad m2uau pn(0aexnmf3tytfpDelieo;t)sexrxrpnu1amt lieiat) 2ua(rp;u1oltnifctyt mDem(mon(0tetoiocoodom  lu i;t t2trim nu1olte fvsl(fsDrr(m nt4aexnmietasfa ulu o t0tltrxr iodom eau o () 2trxmpnu1lle lfei () rraumpou1alxoiictyt sDel(mont4tetnxf3iydfpDelnei;t0setrirpoydamt mnctl()a2ur( ono4tetoii3tadlmDraumo u4 etomo3totop eluvolt) 2uoxo ou4ap  livtl( aDurx  ou1tee  f3ilsfm eanmpnu0alenxr3oytopDe uvs;() rtmirpou4ome lieilt)srtm(m nu1aexoiociat sDuluvpnt0 eenio3oydlpDr n s;( setr(m3no4amt livil(f 2umurpou1olx moeildfa2emu onu0altnxr oodoa   nvi;t) rxr(mpoy1ap   nvsa(f Duaum ;o4olt  oetadlmDra(von(4alerio oo1lm  au ol(0s2xmxo oy4ol nmnet tfs2ua(r ou0tle mfctadfs2ulnvo;u)trxnxo3oodlp eai s (  euoxo ny4ameemfeil() 2tr(rpoo4apxnmoeiasfs2rlums;(0artrxo ia1lm rlueo;t) 2to(r iydlp emfvi tf 2ur(mpot4tptn octytlsDra(vont)treoio3oy1lpteau i t  2uoir3nu1apt lnes t) 2uru p;o0aleoifeiltfmDraumpn(0 rtrirciytfpDe i ols0t2xoxm3oydal emiet ( srtmxmoou1aexo ociltfa2emnvp u4trermrctytfmD  ueol(0t2trxopiudlmtelfei ()arua( p;o1oexoiieiydfs ulnmo (0altoxo oy1op rln i;()t2toimpny1opt lnctl()aDrmxr ;o0tleomoeiat s2ul(von(4texoifctadlpteanei;s0 2toxmpnydlpee fvtat a2uaum ou1oexomfctat s uauvo;(4artnircto1lmt  u o (0srxoio iu1alee nei tf Dta(moot4tpx mo3iatfs rm(msnt4tlxnmr ty1oaDelies;s texrio3io1lm n fctas aDtrxmo;u0tet  o3iltlsDuanvp;t4 rtrxocoadomD lu s;s s2umxo3ou1llt  nei s)sDtr(mpnt1aeen ieiyt s ua( ont4 etoioctytomDr iei ()srxrxo3iodlmen fcslsf Drau p;u0oleoiietysls2rmn o;u4 rtrxf3to1lp  ai sls)s2tmxrpnydlme livsa(f Drmxroou1tltn feiytfmDuln o;() rtrir tydla eau ols s2xrxo3ou1lmee netl() 2trumpnu0oetomfeiysls2rluvs u0tetnirctatlmDrlnvo;( srurxo3iy1lm nlfvtat  2tru  ;u0tle  fcias a2emnvonu) eermf3tatlate u il( texr(o oo4op  mivsl(fa2ta(m ;o1optnif3iydfs raump ()aleoxocty1lmDeaueo;s)seuoirpio4lp n icta(fa2tmu  ot0tleomieilsfa rm(von(0aetnmrcootfm rluvo s  2trxr3iu4lpt mnct s srtax pot1oeto fciytfa ranmo t0artoir3iatlmD  uei;s) rurir nu1ll  lnciasfartmum ou1ale  fctyd aDrl(mp;u0 rtnio to1lpt anvo;s0 etmir iy4lpe mivilt) 2umur nu4olto iciat a2eau ont4 reomoctatfm ean o;t0teto(m3no1ome mfctltf rtru  oo4olx mfeiadfm2eauvp;()texrxfcia1lp rlies (  euoxr oudomtn fvsltf 2uaxmonu4alxnifciltfm rmuvs;(0alxoxr tatfmt  u s s0t2umir3nu4omtelncs tf Drru p;u1oeto oetysfm rmnvs t) lxnifciatom  anes;s sexr(r io1lmtnlneta(  Drmx pnt1aetoif3iasfs2elnmsn(0altnxo oodlm elnes;()texo(o3iy4lptnlnvtatf rtm(mo;o4aex  fetlsfmDran pnu) rxrio tytopD aieol(  exoxr3io1omen fcta( a2urx  ;o0opxomfciasla uan s;u4 exnmr3ia1fatelueslt trumim3iy4lmenmnvs sfs2tru  nt4aexomietlsfm2rlu pnu) rxoxf3iotlaD luvi;s0 rxrir3iudlpe  iei ()s2tax oou4apenifeils s2ra( o u4altnxf ta1fmtrln il()t2xrxo iudomtn nvslt s2trurpou0olxoioeiasfsDua( onu) ltomfcoadlmt anesls)sexm(m3iydaptelfetasfarta(m ot4olt ifeiyd mDum( ont)aetoif tatlm rln i;t0 eumxrpiudol  lnciltfaDur(rpoo0opto fciyt aDemumo u0tltnxociadlmDeanvs ()s2umxr oodope livt (fs2um( oot0olt mietad m2raums;t)trtrirciatfp r iesl(0seuo(r ny4lm n feta(faDraxrpoo0ape iieiad sDra( s t4 reoifcoatfaDe ieils0 eumxm3no4am e iei ( aDumxmpnt4oexniieiasls emnvo;u4teerxrctatopt  n i ()texmxr3iy4lpeelncias  2um(mo;o1olxomiciydfm ul( p t) etomr ia1fat  ueo;t)teumir3iu1om emnetl(fsDur(rooo1texomieiydlmDemn o;u4alxoif3tydfaD  nvsl( t2urxrpou1omtn nvslsfs2um(mp;t0apxomociltfa rl(mo;u4tlxrif oadopDr n il(0trxrim ny1ome mnctasfsDtax ooo0ope iiciytfmDuanmsnt0trtnxocoadlm  au i ()t2ur(rpno1llee ieiat arta( pot1alt moeils a ulu o;u)tlxomr iodfaD ai ol(0s2toxmpnydol emnvs (fsDuaxmp;t4apxo f3tatlm rlu p u)trtnxrcootfm eauvi ( trtmiopnu1ap emict (f rrr( p;o4tpe  feiad m2rlnvo;(0altoif iadlpDe ieo;t srumxm ny1am  mfvi t s2rauront4oee ioeiyt mDranmpn(4teerxf iydopt  ies t0t2uoxm oodol nmfvils aDuax poo0oeeoioeiat aDranvo;t4tlxnmrcoodfp  lu ols  rum(m nu4amt  fvi tfa2tauro;u4tlx mictytla2elnvo;t)aexnmf ty1op   uvil() rtmirpiy4ale livs s)aDraxmont0olxn fciad aDrmu s;u0trtomf3iotomt aivo;()s2umir iy4lpeelncsas sDumxrp;u4tleniicilslaDrmuvs u0tetomf oydfpDelu slt s2xrxo oy1al  mivs s srrmu  ou0aleomo3ildfs2uanvs;u)tlenxf3tadlpt lu s;t0srumxo nu4ol nlnciat srraumpot0tpenmiciaslsDea(vo;u4alxomf3ty1lmtr u i;t0srxoxopnudope liesatf rtmxmpno1tpt iiciatls2ulnmp;u4aexrxf iytoate ies;t texrxrpio1ap   fet ()srtm(r ;t4oleo ieiltlmDrm( o (4teeoxr3to1fpD lu il(0srtriopnu4opt lfesasf rrrumpoo1olen ociad aDel( o t4 rtoxrctodomDr iei;( srtoxm3no4lmtelietlsfs2rm( pot0tpt mi3tat a2ulnms (4 rtoxocia1oaDelnesl(0srum(opou1altnlneil()sDrm(mpno4teeomiciatlm2ranvs (4 exrmrcto1la  lu s t)t2trxr3oy1aleelfcs s  rumurp;u0tpe ifctad mDraums;t4areoxr ootfmD an s;t  eumxmpnudamtelnvt t) Dtaurpoo1tee ioctyt a rm(vp;u) eenmrcia1late ivi;s0t2toio iudam e icsls aDuaumoot1ape  iciysfaDul(ms;t)tetrmfcoa1lmt li olt)t2xr(o no4olt lietlt arrruro;u0optn fciltlm ra( o t) exnmo3oadlptranvsls  rtoxo io4op nlfvs ( a2taum ou1oleomf3iasfaDem(ms;u0aetoxocootfmt  uvo;t setrio3iodapt lfeias)srrmxrono1ole  fctad a rl( o t4alxrmr totfpDe ieo s0 eum(mpoodlmt  fctltfa2ta(moou1apxoiociysfs2em(vs u) renmf oatfmD li i s)s2urir3nu1aleelnct sfaDrmx p;u1opx iocildfs elnvo;(0teerxrcio1lmt  i s ( sexrxm oo1altemfvi (fa2ta(m ou1tpe mictydfa2umumsnt4artrxrctytopDranvi s)t2trio iy4alte ies t) 2ta(r ou4tpenmfeilt a ra( p t)areoxr3iadfaD aiei;s  exmxrpno1ap   icslt)sDuaxr no1tpe ifeiysfmDuanmp t4 eenxo iadfpDr iesls)trurim no1lptn fvi (fs2rmxrpou4tpeoifciydfs2uaumo (4 leoxf3io1lp e neo s)trxrir oy1lp nlnvilt  2umxrpoo1optnmf3ilslsDemn p ()arenmf oo1lat livi t  2um(o3iydapt lnvtls s2tr( ono4tlt iietldfsDrlu s;u0texrmr tytlpteluvs;t  2trxm iy1lm nlfci (fs2raxr ;t4tlx mfcils m2umnvsn(4 lxoxr3ty1lmtr ieil()sexrir oo1oltnlncslt s2rr(root0apt micilt s ea(vo (4tetoifcio1oat  u s;s)srtrirpoo1ope lnesa( aDum(r ;t1alen fciatlm ua(vpnu) lerxr3iodlmtr u o;s texoim3oo1apenlnet ( s2umx ont4tlto f3ilsfa2umums (4arenxf3oy1lpDrlneils)srumir3nu4amtnlictl(f rtmxroot0opxnifciltls2rm( on() lxnmf3to1lateauvol( tetr(opnudomtn ncsl()a2tm( ont0tlxnmo3iasla eaums (0 rxrmrciatfmD aies s  exrir nydalt liei () 2urx oou4tle mictad sDumump u4alenmfctodfptrauei (0 euo(r ny1ll  lfcilt  Dra(rpou0opto o3iys m2emump;()aetrmr3ta1oa rluvs t setrir3oudlpee ietlt  Duaur ot4aeeoif3tatls eluvs u)tltoxo ia1lpD lnvs t0trxmxo iy4apenmncsls srurx  ;o4optomoetas m2emu s;u)trerxf tydlpDranesl(0 rxoxrpno4omt mfciat aDrmxm oo1texoii3ias s2eln o;(0tltnif iatlpDeliesls texoxm oydom emfeia(fsDtmx p;o1optoifeiadlaDuan pn(0alenmo3to1lptrlivs;t t2um(mpio1aptemnci (f 2tax pot1ape moeiytfaDeanvp;t) lxrmrcootlm r nei s)s2xriopoo4ll   fct t)sDraurpno4tet mictltlmDul( p ()tetrmrctytlpDrln olt) eumiopoy4lpt mnci t aDtr(mo;u4tetomfeiysla ul(vpn(4trtnmo iydlmDrluei t)s2umim3nudoptnlfvsls)s2uaur nu1alt  o3tasfs2elu s;() rtnmo iotom elivsls  ruoio oy1amt mfetasfsrrrx o;o1tpe ifeiydfm2eanms;t4 eeoxrctodoat  ueo;( tetoxo ny4alt liet sfaDumurpot1tlxniociasfm2rmnms u4 exrmf3iy1fmtelieo s  exmio iu1lpt mfvilt)a2tm(ro;t0oetn fetlt s rl( pn()trtnmo3io1omtelu ilt t2xm(mpnudalt lncsl( srtmxm ot1ope  f3ilt a2rlu p;()aeeomf oodlateaues s srtr(m3oudlmt  ieta(fartax  oo0aetnioeiasfm2ul(mo;u4alenmr3oatlmD  nvs;(  exm(o iydamtelnetatfa2rmur ot1optomi3iatfsDeanmsn() etrif3tatomDe nvilt)texoim oo1lmeemfet s sDrrxro;u1teeoioctlsfm rmnvo u)tlenio3iodfm r ieilt  2uo(mpnydllt lfvils)srtr( p;o4tle mocilsfaDuau s u4aleoir3totfm rli o t t2umimpoodll n ieslt  Drmxrp;o0oetn oeiltfs2ranms t0tetrxrctotfaDeliesls)trxrxr3nu1alt  ncta(fsDtrump;u4aetniictat s2ranvp t0aeerxr iydlptrauei s0t2tmio3nudal  mivs s arurur oo4teeo o3iys mDrm(vp;t) rxrxfcoo1faD lieo;(0texoiopio1ale  iesls  rtr(r ou4tee mfctyd s raumsnu0tltnmocta1fmDe nvo;(0 2ur(m ou1lpte ivt s) rraxrp;t1tpx iictysfsDean s t4teenxrciydoptr nei t0 rtoxm iu1ape livi t aDuaxro;t1ope ifctydla ul( on(0arxrxf3todfmte uvs;()srxrim3io4om e fcs s arrm(mooo1opxnio3ias mDea( pnt0altoio3iodoa ranei;s0trumxo3oodomtelnctasf 2rmu o;u4apx  i3iltlaDea(mpn(4tltrxf3oo1omt  n o;t) exm(o iy4opte fesls) rtr(mpot4apx  iciasla el( s () eeoif tydfpDr u i (0 2trxopou4aleelncilt srrrur oo0aet  ieilt aDeanvs t4arxnir oadfaDrlieslt0 rxoxopiu4lp  miet s sDuax pou0aeeo f3iasfm2emn snt)tlxoir3io1lmDr ies s0t2umxm oodoleelfvtasf rtr(  nt0tptniictytlm2rln o t) rtnmr3oy1opD anvs;t) rum(mpiy4amtelfctlt  2rru pnt4olenioetatfm2uauvo;u0arxrxrcia1fpD auvi t)t2trirpiu1oltn fct t)aDraxrpno0apxomfeiysfs2eln pnu)arxoxr3to1lp   uvsls t2toxopoudlmeemnci s  Dtrxr ou1alto f3iydfmDua(mon()trerir tatlaDrlivsls0 rurxopiu4lpt  ivtl()aDtmur ;o1olxo octydfm2uaumo;t4tltoiociotoateln sls0s2uoxmpoy1oltnlfcsa( a2uru o;o1ale moeiat s ran pnt0teeoxo oadfpDean ols) etm(o oo4al elnvtls aDumx  no1aeenmoetatla umu s;(4trxriocoodlp raneils s2xmxr iy1lmte fctas  Dta(mpnt0oex mfcilt a2ranms u) exoirciodfatrlies;s  etr(m3oo1lptnlnviatfaDuaxmpot4apxoifctytlm2rauvo;t4aeenircoa1oa r ieo;() ruoio3iy4aleelnet s) 2trxm oo0aexo fciyt aDel(vp () leomr ta1fa ranesls0 rumirpiy4lpe livtl(f Drru oot4tlxn f3taslmDuan s u) rtrmo iodoa   ueo (0setoio ou4ole  ictls)srrmu ont1opeo o3ias mDuau snu0 etoxo3tatoa  livsls)t2um(opnydlm emicsl() 2tm(m ou1altoiietysla uanms u0 lxoioctadfmD lnes;(0 rxo(mpio4lmt  ivt ()s2ur(mpou1apenmfeiytfm2uluvp;(0altrxrctatomD  u s t)t2um(m3iu1aptemnvi ()a2rmuront4oeeoiieiydfaDemn o;u) lermfctotla  aieo s texm(o ou1olt mics s) rrm(m ;u0tpe iictldfsDemn p u4alxrmo3iydlptr i s;s0trurxr nu1lm elfcta(fsDra(mooo0opxo i3ildfmDrmnmp;u4arermo tydoa raivs t) exr(o nodomtn ietl()a2rmu pnt1tlt  i3tydlmDel(mo t0 etrmoctadfm  lu i;(0trur(opiodal n fetlsfarur(mooo0olt mietatlsDrm( o;()tlxnio3tadfa eanei s  eur(r3oy1olee iviatfa2taur no0tpxoii3tltfm rmn pnu0 lenmf3oadfa  lieol( s2tm(mpny4amenmnesatfsDum(rpnt1tpt ifciydfm2rmums;(4aetrmf ty1oaDe ueilt) rxmimpno4ame mietl( arra(m nt1aet mf3tysla eauvo (0alerifcia1fa  an sl(0s2xmxo3ny4omen neil(  Dum(  oo0tpt ioctytlaDrlump (0trtrxoctotlpD ln o s  2ur(r nu1opeelici s  2tau  nt4teto ietydfa2rmu s;(4artnio3totfaD lu s s0t2tmxr nu4lme livt ( aDrru  nt0tetoii3iat sDean p t)alxomocoo1fp rlu i () rxrxrpou1am n netlt)a2tmu pnu1tleoif3tytfa um( p t)trenio3ootfpD  neo;(0srum(mpiu1ll nlnvia(  Drr(root0apxo f3tas a eanvsnu4 leoxr3oatlm e nvo t  euo(r no1omte icia()aDra(rpot4tet ii3tatla2rl(vo u) ltrxr3iydfp eaivsl(0teurim ny4al emnctl()s2rr(m no4aeenio3ilt m2rln s u4artomr3oo1optr u ols  ruoiopnudomtnlneils  Drrxrpnu1tee  icias s umump () rxrxr to1omD  u olt setm(m3ou1lptemivi sfsDtru pnt1aptomieias a2elnvs u4alxoir3iadfm  au i;(0trur(opny4ap emies t)aDtmxrooo0olx  octls m2em( p u)alenmo3tytomtr n ilt  rtrio ou1om  lict t srtmur ou0apeo f3iat a2emuvs (0texnxf oy1lp   uvi () 2xrxr3nodolenlnvilt) Dumxmpno4opx if3ild aDulnvs t) eenio3oo1fm e ieols0srurio3no4op  mivi t aDrr(mo;t4alxo ietyd m2rln o;(4artrifcta1fm eaneols)srxr(r oy4ale  fvil( arraum ;u0oeenmociatfm2ul( s;t)trtrxo totop r u o t) 2toiopiu4aptnlfesa()sDum(r ;t4aeenmieiytlm rmums u)teerio3tydopDr n o;t  exmio3ou4oltemneiat arur(  nu4tpto oeiatfa2ua(vsnt) etrxfcto1lpDeli o ()sruoxm3oo4op elnvtasfartm(m ou1alen fciat aDrl( pnt) ltrio3iotomDrlu s s  2uoxrpiy4al  livt () rtax onu1olx  oetyd a2um(monu0aexniocto1omtranvilt)s2trxm3iu1lp  mnvias)aDtrxmp;u1tex  fctltfs uan o;u0trtnir3ia1lpt  ivo;t sexmxm no1al nlfcs (faDtrxm no1oetomo3tldla2em(mo;t0aexrir3todlmDeaivs s) 2xmxm oo1lm e fvtl(  2taur ou4aetnioeiytls rlumpnu)alxrxf io1op  lnes;()t2um(o3ny1amtelnes t) 2rmuroou1tpxniicildfa ran s;t4tetrxrctodoaDeauvi;(0 2urir oo1amtnlnvi tf Durumpnt1tlx ii3tatls emuvs (4texnxr3oytlpDrlueslt) exrim3ny4lm nlfetatfa2rrxro;u4tpxo ieiatlmDulnvo;(4 ltoio io1fpDraivsls)srxoio ny1amee nci ()aDrm(  ou1apx mo3iat sDuan s (4teenxo iotomt luvo;t0 eto(rpiy4ol n iesltfarurumpno4oetn fctytlaDuanms;t0 rerifcia1lptranes s) etrim oodal  mfvs sfarua( pnu0tleoii3iytlaDrl(vp;(0teenxo3oa1lat  ivil(  rxr(o3iu1omtnlivi sfsrrmumont1tetnif3ildlmDeanvon(4tlenmfcoytfmte ivil( t2trxrpiu4optelnvslt s2um(rpot4altniicilt s2ranvsn()texnircio1omtr n ilt0s2umim nodlp nmfcsltfaDrr(rpoo0altoifciytlsDrlu o;() rxnirciadlaD livi;s)sexrxrpnu1om e fctltfsrtrurpnu0tlenmi3ildla umnmo (4 rxrmo3oa1fpD an slt  ruoxopiodomtelncslt arururpnt1tee ioeiad m rlnvsnt0tetoir3iydfpDrln s;(0 rtoir3nu1om  licsat  2tm( ont4aeeomi3tatfmDuan on(0tetrmr oa1faDr uvo;(  2tm(r3oydll nmivs s a2uaxm nu1apeomoetlt a eln s u4 etrio ty1fatr u s ( srtoxrpoudalte fvs s  2umxroot4tetomf3tytfsDem( o;t)trxnio3oydfaDraueilt)texr(mpnu4alt mfcil(farumx p;t0apxn iciatfs2ean s;t0 rtnio3oydfm  aivslt0t2xrirpiodll nlncil( sDtr( pou0altomfeias sDuaump;()tleoir iotfmDeauvs ()setm(o3io1lp emncs sfarta(mpoo0tpenioeiysls emnvp u4 lxrmocoa1lm e ivs ()srtoxm iodol nmfcs s) Drmu  nt4aee moctlsls eaums ()trenxfctydoat lnvil()texm(r iodolee nviat)sDua(moot1aee miciat mDum( s;(0aleoxf3iodlp  aivs;(0t2xo(m3nodomt  ici t)sDtmum no4tleo octltfm rm(mp ()alxoxfcootfaDe i s t0 2tmxr oodamt mfetltfartaxr ;u1aexoifctlt a rluvo;t4 leoxf iadlat livslt)t2ur(o oudop emietl( aDrrx  ou4tee moeiat m umump;t4 rxrmo ia1lp raivil(0seuoim3nudapeemnesltfsDtruro;u1oetoifctytfaDulumpnu0alerxo iodlpDr n sls0trtmio3nudlpeelivi t aDuaump;o4oltomicild aDel(msnt4tetoxociytoaD ln i;s trxmio3no1lm e nvtlsf Drm(mpno4tpxomfeiydfa ulums;u4trtomf iytlp  aivi (0texmxm oy4amt licia() 2rr(rp;u0aeeoiieilt m rmuvon(4aetnifctytom rlnes s0 rxrim iu4omee ivt sfaDtrxrp;u1tpeniociydfa ulnvpnu)arxoif3oodfatraueo s0 2xoxm3ou4oltelietltfaDrrumoou0oexomf3iydfsDrmumo;u)texnmr3totoaDe n olt seuoiopiy4am emfcsa(  2tax  nu4oeto oeildfm uauvp u0teeoif3ootoat  iei ()tetm(mpoo1am  lnciasf rururoot4aleoioeiaslm2emu ont)tltrio tydlm elnvs;t) exrirpnudapen ieiatfarraumono4tltomocils sDul(ms (0arxnxr3iatlatranei ()trum(opoo4apt  ictasfartru onu4opto ictad aDumu p u) etoio3ootopteauei ()s2tm(opny4lmtemnct sfsDrr( o;o0oex io3iasls ua(vo (0 ltriocootlatrauei t0 2tr(m oy1optnmivsltf 2umurpnt1oet iictldfm2emn o u0tlermf3oytfpD  uvo (0 ruriopiydlme lnvslt)a2umuroou1teenmfciatfsDuanmpnt4aeermf3io1fp  aneol() 2xmxo3io4amtelfviatf 2tru  ou4oetnmictlsfaDrluvont0 rxrxocta1oa e u s;(0 rxmio3io4omtnmnvs sfa2ra( ooo0oex mocildfsDemnvo;(4 lenif3io1lpDrluei s srurxmpiodamtnlnvs s) Dumxro;o4apxnii3iydla umu snu)trtnmf oatlaD  nvil(0s2toim io4lm e ivtl() Drrxm oo1oet mfeiyt a2ean on()arxnif oa1lm rauvsls  2tm(r oydap nlics () 2uaxro;o0tpe  f3tldfmDulumo u0aexrxo3iy1omt aneslt trxmio3ny1lpe mivtltfs2um(rpou1aetn i3tydla rln onu0artrxoctotlateaies ( trurim oo4lm n ncilt)artrxr ;o4aetomfciydfm ra(vs;(0trxoio3todoa e ueols  rtmim ny4opte iet t  Dtaxr ;t1tleniociadfs2rauvp () ltomfcoydlm   nei t0setrir oydlm n fcsas) Durxrp;t4opx mfetasls2eln o;(4 ltoif3oatomt  ieil( trto(m ou4lmtemneta(  rra(moou0alx mfciyd sDel(vsn()alxrxf iytfpt ln ils0 2xrim oo1amt mnvt t)aDtm(m ;u1tet iiciys m2ul(mp t)altrmf3ootfmtelu o;t  rxrxm3iy1lmtnmfeils sDrrxr ;t4oexnmfeild mDelumsnu4trxnif iotlmtrai i s setrxmpnudlmenmietl(  Durx ono4aex  ietlslsDumump t) eeoifciydfp  auvo s) etrxmpno4lpe lfctls) rua( pou1aeeo o3tas m rmnmo t) lxrmf3totlmD lnvi t0trtrio io4lptnlfei t  2rm(  ou4tpt  o3iytfa2emnvp t) eenmfcoodfmDr nvsls s2trir nydale lfesa(fs2ra(moou1optomi3iytfs ranmo u0treoxr3to1laD lies;t0 2xm(m3iydamtemncils) 2ta( ooo1apt io3iasfs2ua( ont) etrif3iytopDrau s;t)t2tm(opou4altn nvt t) rrru pou4tlx io3iasfa uan p;u0 lxrmr3tydlmDeliei s)texrim iy4ol emici s)aDraxm no4tle  i3iad m2ea(mo u0 rerir tadfateai s t0 2umxo nudom n fvs tfa2rrx p;o1oleo oeiltlsDuauvp ()aexoifciodom elu sl() eum(mpnudomen nvs t) rrm(rpot1oee  oeilsla rlu pnt4teenxo tydopDraivi (0 rtoio nu4apenlfes s) Dua( p;u0ope mictytlmDulu s u4tetnxr3oydomD  u slt) 2xrxm3iudlpeemicil()s2uax  ;t0opt io3tytls2eanmo;u)tleniociy1oaDraneo t0 exr(r oydam   fvt s a2trxmp;t1aptoii3iltfs2eanvo u4 exoio tatfmDrli i t trumimpnu1ap  mnvt tf Duau  oo4aex ifctlsfs2ua( o;u4 eenmfctydom e u i;s sruoio3oy1amtelfvil()s2urxmo;o0tpx mi3iyt mDua(mp ()teenxf tadoaD an s;t0 exrxopny1al   nesls sDtr(rp;o1tlx  fcildfs2rau snt4aleomr oytopD  ivil(0texo(opno4olt  ictls sDtmxroot1aexniicild mDemumon(0 exoir3oodopte u s t)teuoio oy1llt mfeslt)sDta( p;u0openioeias aDrmuvsnt) rtoio ia1fmt  ieslt0 rxo(mpnu1opt  nviatf 2uru oou0opxomoeiadfaDrlnmp;u)trtrir todfmDr uvol()t2tm(r3ou1olt livsl()srrax poo4opeoio3iysla rluvpn(0 lerxr3oydfpteln ilt0s2xm(m oo1omtnmneta(fsrrmur oo1tltn o3iltfs2em( o;()arxnxo oadlateluvo s0tetr(rpou1amee nesatfsrtmu  ;o1oexnio3iasla2ua(msn(4trtoioctadoatrlueilt0s2uo(m3nydlptnmfcias)srurx oot0tpxnio3ildfs2rau pnu) exomr oa1lpteaieolt s2umxm oo1al nmncs t)aDtax poo1ope ii3iys s rmn p;t4 rxoxf3iy1omte uvsl()srxm(opoy1llt mfet sf rraumo;u4texo fctls sDrmn snu4tetrxr3to1lp   uvs t) rxm(m iu4omt mies t) rraxmpou4apeo ociyd s uluvp;t4treoio oy1la  auvs s0tetm(r3nu1lmeelict t artaurp;o0aexnmi3iydfa ul(vsnt)aetoxf iydfpD lnvolt0t2xoxmpiu1ol emivtat  ruaxmpoo4ole io3tytla ul( o;(0trerio ootom eauvs;(0 eto(o3oo4lle mncias a2tmurp;u0oexoiociadls uluvo u0 rtrxfctydoptraneo;( t2toim3oodaltnmfcsa(fartr( o;o1aex moeilsfs2elu s;()alerio ta1la r ueil( seum(m3nu1lmeemfvtas sDurxmoot0tptomfeiaslmDuau pnt)tleomf tatlmte neol(  euo(r3nu1altelivtat)sDrrxmp;o4apt mf3iltla rl( s;(0 eeoxf totfpD  nvi (0 rxr(r3nudlle mfcs (f rrrxmpnt1oex moctltls2eaums;(4tltoxo iadlateluvi;t0 2uo(o3ou4olt  ncia(  Dtm(rpot0tptnioctyslmDelnms;() exrmr oodla rli s s s2urxm no4am nlfes sfa2umx o;u0tlx ii3iad m2elums ()texrxf3iydfmDr ivo;t t2xm(opnu4aptelnesa(fs2tmx oot0alt  fctld s2rl( s;u0 eenio3ia1fp  lu i s0s2urxm3oo4oltemnesltfaDrm( pot4teenii3iyslmDrlums;() lerxrcootoatrlneolt t2tmir3nudllee ietatfsDrrumo;o1aptnifcilsls2rm( o;(4 ltrmf3iy1optelies;t)sexrxmpoo4lmeelict s)s2rmu  ;o4tpen i3iydfm rluvpn(4teenxf3iotopt  ues t) 2xmiopny1aptelics () rurxmo;t1oltomo3ilsfa rl(vsnt4 lenmo3iy1la ranvil()teurio3oy4al   icsl(f rrmxmoou4olenifctydfs2rm(mp;t4 rtnxf3oytlmDr nvs t0trxr(rpoydlle mics sfa2uaxmo;u0alx iiciyd m2rln o () ltoxfcia1oa  anes t)seum(r iydoltnmfesasfsDrm(m ;o4tlxnio3tadlm2ua(vs ()trtrio iodop  anes ( t2tr(rpnudome mnci t) rta( pnt1tle  iciyslm2rlnvs;u)aexrxrctatfp  aieo (  rto(m3nodame  fetl( a2umuro;t0oee ioctys a elu o u4aetrxf oy1opteai sls0s2to(m oy4aptelivsasfaDrmxmo;t1ape ifcildlaDumums;u4alxoxfciotopDe neslt trxo(mpoo1om emivs () rtmxroot4oee ioctlslmDua(vp;u)arxrifcootlaD  nes (0trxrxo oudome  ics t a2ua(r no0aee  ociadfm eln onu)altoxo tadfm e nvi;s)srxoxr iodlm   neils) rtmxmo;u0aexo octld m2eau p;t4trenir3totlpDr u ol()tetrxr iudamt mncta()artmxr ou0tle moetatfs elumo;t4aetrirctytlaD aivs;t  2xo(r iy4lmte fvsat)a2tm(roou0apeoioetadlmDumu o u)alxrir3totfm rluvi;( trxoxm iu4lm n ivs sfa2trumo;o0tpe  o3tatfa2rauvs u) etrir3io1fa elnvi;( texo(m nu1alt  ieilsfaDrrxmooo4alxomo3iadfs uauvo u4arerxf3oy1om ean sl(0s2trxo3oodamt mnvtlsfsrum( o;t0tlxomietad a2uau s;u0 lenxo3iydomtran ols)texrxm3ny4ll nmivs sf rra(r no0aptn octydlaDrl(vs t0trtrxo3iotlmDeanei;t) rtrxo3ny1omenmicta( sDua(r ;t0tle mfeiasfs2emums;u4aexomf oy1lpDr ueols) rtr(m nudlm   fvt tfa2rmuro;t0tptn feiys aDum( p;u0aexrir3to1lm  au i;(  exm(m3io4apenmiei sfs2rmx p;t1oeenmicilt s emuvp u4tlxomr todoptrai o s0trum(opoydam n feilsf rra(  nt4oetn ieias s rlnmo;u)texomrcoydlmtraieslt s2xoim3oy4lpee fvtl()srtmu oot0tpe  fetysfaDrm( snt0arerxfciytomtrlneol(0trtrxo ou4op nmncs (f Dua(rpoo1tpeomi3tydfaDra(mo t4trtnxfciadlmt aneo s0t2toir io4oltelfvils)s2um(r ot1tlxoioeiatlm eauvp u0aexrxo3oytla  an o;s0 etrxo3iudlmt lfcsl(fsDrmumont0aeeoifctyd m2emn p;u4altnmr oytopDelnes ( srurxo nu4ope mfcilsfsDum(r ;u0tpeoii3tlslmDrlums u) lenmrcoatoptr n il( srumiopny4apeeliesltfaDtr(ro;u0oleo o3iatlm rauvon(0altnmr iydomDe i s;(0texm(mpoydome lfvs (fsrumxr nu0alxoifcilslm2el( p (4 exrircoatlptrluvol()texoiopou1ame  nes tfaDumuroot1tleoiietlslaDelu s u0tlxoio3iatlptelivsl() rxmiopoy1lm nmici sf Dtrxrpot0apxn o3tatls rm(mpnt)alxomf3iotla ean i (0trurio iu4op e ietl()sDumu oot0tee if3iat a uanvp;u)tlermo ta1fa e ueol(  2xmio3iy4oltnmivs t)aDraxrp;t0texnif3tys s em( o u0tetrxr iy1lm eanvs;s)srxrxr3nu4opt livsl(f rrr(mono4alenifeiyt m ua( s t)aeerio3iytoa eln o s0setr(mpou4olenlncsas s2ua(m ;o1tle mictltfmDel(vs;t0 lenxo3io1oa e u i;s tetrim oudame lfvs s  Drru pot0opxoif3ilslmDem(vp t) reoxr todlaDrai o t t2umxr oydlm nmfcslt sDrm(m ;t1tpxnioeiys aDranmsnu) renmr tytlmDeaivolt)s2xmxr oy1olee fcil(f Dtruro;u0olen i3tasls2rluvs;t)tlxrmfctotfpD luei;t) rtoxo iu1optelivi t aDtaurono1teeoii3iys a2rl(vp u0tlxnmr totfmDeau o s setmio iudlmtn fctas) Drmump;t0aexnifciyd mDua( ont) eenio3io1op rluvs;s0s2toxr3nu1lpee nctas s2rmxront4tpeo oeias mDumnmpnt4tleomf iotomDraneo;s0setrim3nu4lp n ncsltfartaxroou0alx  icildfaDra( o (0alxomr3tatlatranvs s  ruoir oydoltnmnviasf rta(  oo0ale  feiysfa rlumont)texrxr tydfpDraneils0srum(m3oo1ole mfeiatfs2uaxrpot1tex  oeilsfs2umuvs () eeniocio1omDeau i s s2umxo3ou1apt  ictat)a2ururpnt1tptoiieiatfs2elnmo ()altnir iy1faDeai i ()tetrxo3no1ol  mnet sfsDumxmpnu0aexomoctat s eaump (4 etriocoy1fa e i i;t0tetoxm3iy1amtelfcsl(f rua(ro;u4tpeo o3ildlaDuauvs;u)aetoxo3oydlmteliei;s0s2tm(m3oydale  fetls sDrm( pou4alxnmoeiad m rluvs t0altrxf3oydom rli s;t seur(o iu4opeemics (farrmurooo1oexo oeiytfaDulumsnt0arxomo totlmteanes;s srxoxo io4ap  lnetls aDra(m ;o4tle  o3iatfa umn snt)areomr tydomDrlnei;s0 rtoio3nodlmenlnct s) rum(mpnu0alxomociydlaDea( onu0altomf3ty1oa rliei;(  2toxo ny1opee ietat) rrm(r ;t0alxoii3tat mDel(vs () ltoxf todop e nvi t0srtrir oy1apeelfcils)srtm(r ;u0teeoiociys s rau pnt4trtomf oadfpDrlueolt t2umxm iy4opeemnvs t s2raxmpno1tle mfeiat s2ea(vp u) rxoir3iadlaD  nvi;t  rxm(o3io4lmenlici sfa2ur( pot1oee moctltfm2rmuvsnt4texoxf3ootfpt  ivils teurxm no1llenmicil(fsrum(  nt1oetoiiciat a2em(vsnu)trtrif iytomDr nei;(  2tmxrpnydomeelnvi sf 2taur ;o1aexn ieiytla el(ms u0altnmrcia1fa eai olt0seurxrpiy4lpeemfeias)a2tmum ot4optn ietydlm ea(mp;t4 exrmo3tadopD  nvi;s)trtoxo no1lmte fcsl( srta(  ;o0tetomfetyt m em(vs;(4teeomr3oydfa   i s;()sruo(o nu1op  lfct s) Duaxmpot0tleo feilt m2ul( o;u0 etomr io1opDelivols)seur(m nydlp n ici ()srtau o;t0tlx moeiyt mDulums t0 rerxr3iotoate n i;t0 2toio3nu1omtnmfet ()srtmxr ou1tpe mf3tasfa ul( p (4aexrif oa1latelu s;t seuoxrpiudaptnmieia(fartm(rp;u1aeen f3ilslm um(vp;t0aleoirctodfptelnei;t0teur(r3ou1omt mivtas sDtr( pou1ope  ociytfm2um(ms t)aexoxr iodoptrluvs t)s2xoxm ny1lme  icilt) Dtax oou4opxnmoctldfs rlump;u)alxrircta1fpte n s;( texmim iu4omtemfctls) 2taurpno4tee if3ilsls emuvo;u0 etoxf oodlm eliei t  etmim no4aleelfeil(fa2tr(r ;u0aeenmfeiat m2raumsnt4altrir iodop e uvi;t) rtm(opou4llenmieta(fsrrrx pno4teeo fctyd m2ran p u0tltomfctatom  aiei (0t2uoxmpiu4ome  nvtls)aDrm( p;u1aex  ociytla2umumo;u4 lxnio tadoatelies t) eumxm3oy1opt mfcia(farrrx  no4oeeo iciatfaDelu pnu)trxoxr3oatlp eauesl(0s2xo(opiu4lptnmnetltfsruauro;t1open ociysfaDrlnmp;()aeeomr3todlateai i;s0t2umxrpou1op   nvslt  Dtmx  ot0aeenifctatfm2eauvo u)trxnxo3oadlp rlnvo t)teumir3iodll e fvil()s2tm(mp;t0tlxnifciyt s rmnmp;t)tltrmf iodopt  i ils0srumxo iydomenmnvtltfa2umx  ;u4alx  oeild m2ranmon(4alxrifciodomt an o ( srur(rpoudlptnlivsl()s2ra(mpnu1oeeomieiat mDrlnvpnt)artrmrcio1lmDe u s ()t2xmir oy1omt mies s)a2urx o;t0oetnifeiytfs rl( pnt4 lermrciy1opt au s (  exm(r3io4ll elfvsat sDrmx  oo0aetnmieiat a2ulumo;u4aexrxf3ta1lmDraieolt  2tmxrpou1ll emietas)aDrmxmo;o4aptomfciyt aDulnmsnu4 renmo tatfaDrlies s srxm(m oydllte ieta(fsrtm(m nu4tpen oeiadls2uln s u)tleoifcoydfaDe neo;(0srtoxo3nu4om n fct tfsDum( p;t4alx mfetldla em(vs t0 eeoxociatlmtr nvo ( t2xmxo3iu1lltnmneil(farra( oou0tex mo3ilt mDelnvo u) renmf3iydlmteai i;() exmir ny4aptemivt ( aDta(mo;u1olxnmociasfm ua(mpnt)teermr oa1oa  li i t0srxoio ny4lp  lneia()a2rmum no4aetomf3tysls2ua(vs;u4 exomf totfaD ln s;s)s2trxmpoy1lpt mnvs tfaDurxm nt4tpenif3ilsfs2rlu s u)aexnxfcio1om  lu i;s truo(opoudlmeelnet ()artrxmp;t1oleo ietltfaDrau p;u0aexnmr ootla ran i ( srxo(rpiy1apt miesas arum(mp;u0ole iociad mDuluvo (4 reomo ia1lmtelivi ( srxr(rpnu4apee neiat sruaxro;u0aetoiiciadlmDeau snt0tleomr io1lp r nvo t0srxoio ny4lpeeliesltf rtru oot0altnmf3tytlsDrm(vs;t0alxomfciotfmteaivo s srxrim io1ll nmfvi ( s2rmxm oo0opxnmoeiysfm2rln p u4tltoxocoytfmD auei (0 ruoimpnu4opte fvsl(f 2uaur ;u4tlxo i3iyt mDrlnvs t4 rtrmf totopt aues () rxr(mpnudlltelivsas  rraxm ;t0opt mociasls2em( snu) etnxr3iy1op   ivs (0 exoirpnu1lleemivta(  2um(mp;t0ape if3iytls2rln pn() reoif iodop eln o s0trxrxm iy1olt mnes (  rurumpnt4oexn oeiatlmDemuvp t0 renxrciytopt  ieo;s  2to(m3no4altnlfcsl( sDrrx  ot4olenif3iysfaDem(mo u)aetrxociadoaDrlneo;s  eum(r ny4amtemnesas sDraump;u0opeoiieiysfa2umn p u4 rxoxr3iotoaD livo;s  euoxo ou4lpe lfct ()sDua( o;u0tlxo iciyd aDrmuvs;u0aexrmr3oa1fat lu ils0t2tmxr3oodllteliesas aDta( oot4openif3iaslsDulnvo t4tetnifciodfm eanes;( setm(r3iy1am   ivsat  2umu pno1oexn fciydfm2umnvs;u) rtrif3oa1la eauvo s0t2umxo3oudomtnlfctlt)sDumxrpou0tlenio3iasfa2ea(mo;()aetrmocto1lp   ivi (0trtrir ou1lp n ictl()sruaumpnt0tpenif3ias m2elnvp u4aexoir oytlmte ivil(  2xrimpnu1lp   ivi s s2trxm ;t1ole moetysla rmuvo t0alxnmr ootomtr nvsls  rtoim3iudlle mfetl( sDuru onu4oetnmieilsls2ulu o u4trxnxr iodfm raivi;s) rxoxo iudom  mics t aDta( pou0ole mf3ilsfsDrm( s u4teeoirciatlmDr i o;()seumimpoy1altnmicta(  2rau  nu1alxn ietlsfm2eauvont4 exnir3to1fp rlnesls0 exoxmpoy1ap e icil(f 2tm(m ;o4oet mietaslsDumuvon(0alxoir3tydfat lnei;t) 2uoio3nodlmt mics sf rurum oo4tpxn o3ilt mDrl(vsn(4 leoxr3iotoaDranvo () etmxm3nu4apt  icsa(fsrumu o;o4tle ii3tydfa eau o;t0tetrmr3iatlmD auvs;() 2uoio3no1lleelfcsl(  Drrum no1tlx  i3iytfm eauvpnu4texoxo oa1lpt lnvi (0sexrirpio1oleemfctasfs2ra(mpno1tpt ioeild sDumnms;t)trtrmociy1lmDe n o s0 rxoxrpoodol nlivs sfsDumxmpou0aeeoif3tltla ranvs (0 rtomf3iodlaDelivs t) 2to(r3ou4oltn fvta(  ruaxrono0tpe  ietadlm umnvp (0aeerxoctotfp rai s;t  rtm(o3nodom elictlt  2rrxmpou1tpx iictlsfa rm( o;() rtrxf3oydomDeanvo;s texrimpiu4om nmnesl()srurxm ou0opx ifcilt s rmumo;t)trxrmocty1op  anvo t texo(m iy4lm emncs (f 2tmumont0opx  fciyslm rm( p (0arenmfcta1latraivi;(0texr(rpio1lm nlivsls)s2tru pnt0alxo i3ias s2raums;()alerir3iotopDeau sl( texo(rpiy1lm  mncsls  ruaurpot1openifeiyt s uluvpnu4trenir3iydfatrluvsls0srurim3iodlme  ieia()a2um(mpno1aetoif3tls sDrmn o u0 ltoir iytlaDe ivi;t0teuoim3io4ap nmfct s) Draxm ;o0teto fciyd a2rlnmont) eenxfcoydopD  nvo s trxrim iu4lmtn fvs ()artm( p;o0tee mi3iat aDrau p;t) eerif3totlaDrlivolt  2trxopnudapt mfcil(f 2rrum ou0alx iieiysfmDel(mpn(0tlenxfcoadlaD an s t0sexoxo3iu4ale  fvil(fa2ta(r no1tleoifeiytfs elu on() rxoiocoadla elnvi t0 2xr(opiy4aptn fvt (f Dua(r oo1apxnii3iltlm rlnvp u)alxoif3iotlaDe uvo t  ruo(m3oy4oltnmfvsat aDurx pnt4tee mietys m2ulnvo u) eeomo3tydfatranvs;s  euo(rpiydapee nct s)a2ta(r ;t1tptnmoctatfsDul(mo;t4 etrir ty1om  lu ilt) rxmxr iy4al nlfvta(farra(r nu1alxnmiciltfa ra( snt0trtnxf3tytlpD ai o t0teto(m3nu4ap nmnes ( s2tau onu4opx ifciyt mDemnmon(4 rxomfcoytlp r u ilt srtr(o ou1al n nvsas  Drrxmo;o0tle mietat aDemuvsnt4teenmr iytlpD lu i;t0seto(m3ny4lmt lfctls) Dumu  oo1oet mo3ilsfs2um(vp;t0 lenmo iy1fmteli s s0s2xmio iy1omt mietls s2rrumo;t4open feildfa ea( on(0 exomocoatop eai s s0trxoxm3nu4lm emnetatf 2urxmooo4tpto iciat a ua( o;t0alxrif3iotopt aneo;s) eumxo3nu4lm  lneiatf 2uau ont0olto fciasfa ra(msnu4 rxrxf3iatfm   i o;t tetmim no1am elivsatfa2urxroot1optomocildfa2umuvo;(0tltomo tydfa   ivi;( setr(mpiodap  livsa( arum(ronu0tltn o3iytlm emuvp;u0 ltrmfciatfmt aivs () exoim3iudlmeelfei tf 2tmx  ot1aex  icilslaDeauvsnu0 leoif io1la  aivi s0texo(o ny1ol nlfeslt)a2ua(mont4ole io3iad m2emnms u4trtnmo io1oa  livi t  etm(mpiodapt  nvsls  2ua(rpnt0opx ii3iadla em( ont0trxoir iotfatranei;(  2trio3nydolt  nvi ( aDra(  no4texomfeias m2uanvs;t4tlxrxr io1om   ueils  exo(o3oo1alenlfvil( sDrrumpnu0oeeoio3iyslmDea( o u)texoxr3iy1lmteaieo;s  eto(opiydolte fvt sfaDrrxr no1alxo o3ildla ra(vs u) rxrxf3tadfaDe neo;s  2umio nudlpen nciatfsDrmu  nu4aleomfctad aDumn p u0arenxf3oodfpDe nvolt)srtmxo3no1om nmfvilt) 2urxmo;u0tet miciasfa uaums t4texomo oo1oa  lies;t)sexmim3iodlm nlfcsls arua(  ;u0tpxn o3iltlm2emnmo;(0 rxnir tadoateln ilt)teumxr3iu1lm   neils)s2tmu oou1ope  icildfaDul(vsnu4 etrir3to1la rlu s s  rtmimpny1am n fcsa(f 2tm(r ;u1aeto ociad aDua( onu4 reoif3oytlpD auvsl(0trxrxr oydoltnlncias  2tau  ou4opeomfciadla2rau o (4 rerxfcio1laDe ies;s)t2umim3iu1llenlfet t) 2ua( oou0aeeomfeiatfmDrauvs t0 lxomrcia1lm  ai ilt0teum(m oo1alte ivt t  rrrxm ;u4aeeoiociys a2umnmo;u)altoxrcta1lp r ueolt)s2xr(o3ou1ol nlfvs ( artm( p;t4teeo fciys s2eauvo;t)tltoio3oodop r uei t)sexrxo no1om   iesa( artmxront1apxniietlt sDulumo;u)arxnxo3oodfaDeluei;(0 rxr(o3iu1lm elnei ()s2umxmpoo0tpx ioeild m emnms u0 rtoxf oa1lmt anvs;t0sexoxr3nu1lm nlicsl(f 2ta(m no4oet  ietytla eau o;u4tlxrxfcoadopD aueol(0seum(r3nu1lltemfvt s arua( p;o1tltnif3tyslmDemuvont0texoif3iydopDeau s s0seto(m3no1am  licsl( s2um(mo;o0opt  o3ilslaDea( s;u4 ltrxo tadlmt  uvslt)srtr(o3oudlm e nei t) 2um(mpot4apxo octysls2rauvp u4tetoioctodoptraieo s0srxo(o3nodopt mfvsasf 2umxrpnt1openif3ilt s ulnmsn() rtrifctadfa  lnei s)seuo(m iodoltn ietlt) ruaumo;u1opx mfciatfa2emump t4arxomo oytlaDeaneo s srurxo ny4opt mnci (  Durum nu1altniociys s2uanvs;t4aeenxf3oa1fm r nvo ( texmxo3oy1lpe lnei s  rumu pot1tpeomoetaslmDea( ont4texoxf3iy1om elu o;t  rxrio iu4lp nmfcsas artmx  ;u1tlxnifetydlm2rmuvsnt)tltoif3oy1fm e nvsls0 exmir3nu4lpen neils)s2tmur ;u1oltomf3ildla2em(msnu0 rtrmr oodlpDe n o t0setoir nodopee ictat) rrmu  ;o4oeen oeiys a el(vpnu4tltrmf to1op   i ols trtoxr3iydlp  mncsa()a2rm(m ot4olxn ociltfs2ra(vo;t) lenif3tatopDrlu s s  rxrimpoodll elfcilt)artau p;t4opxnmoeiasfm2elnms;u0 leomr iytlpD ai i ( teuoiopiodlpen fcia()a2rmxr oo4oetnmo3iatfsDeanvs;t)trtnmo ia1omteluvs s)srtoxr io1amtnlnvia( arurx p;o0alxnmieiltlaDumu onu0 ltomfctydopteaivo;t0s2uo(m3iy4opt licias)aDur(moot4ole  ieiyt mDrmumsnt4texnif totomD  ueo t) rtrxr oudamtn iet s  rtmx pno0alto feiltfa2rmnvo u)aetrmr oytomtr ueo;s trtmim io4lmenmivi s)a2rmxrp;t4aeenio3iaslaDua(vs (0tetomociydoptrlies t) rtmxmpnodomen fvtlsfa2raxrpot4aeen fciyslm2eau p;t4tlxomr3iy1la rlnvilt)setmim iydopte ies sfs2um( oot4alt mi3iyt s2eln pnu4 eenmf tatlm r n il()texmio3oudal elnes (farra( ono1aptniieiyd m em( snt4 ltrxrcoy1lm   neslt0 euoim3oy4opt lfesa()artrumooo4oleomo3tadls2ea(vsnu4 lenir to1lpDraieslt)sexrir oo1lp nliesls)a2um(m nu4apxomictltfm2el(vsnt)trtrio3to1lmt  u o (0tetoxr3iudllen ivs s)aDta( pou0olx mictltfaDuanmp (4 rtoircta1opDrln ols)t2xo(m ny4lpt  nei s) rra(m no1aetoiociad mDrauvsnt)tetnioctydlmD  nei (  etoim oy1ll emncil( arurumpnt0tpe mf3iytlaDra(vsnt0areniociytoaD livols  rxmxr3oy4aleemfesas)a2um(mp;o1alxniiciyt s2elnvp;t4aleoxr iydlm eaivilt sruo(m iy4lpee nviltf rtaxmont1tee mo3iysfa2ulnvpnt0trtrmf oytfptrln s;s0tetoir3nu1aptn icia(f Dta(m nu0tex  fciytlm umnms;(0trenxf3oa1op rli sl(  2uoir ou4optelfeilt)sDur(  ot4aetn oetadlsDem(ms;t)aetrir io1lmtraivil(0tetr(r3ou4lpee nci (f Dumx o;t0apen oeiyslm umumo t0altnxf ty1laD liei s) 2um(r3oudomtn iet s)a2tau  ;t4tpe  iciad s eau o (0alxnxr3oydfp r ueo;s) eumxopiudlm  lnvsat)srrm(m oo1oeenmf3iltfsDelnvp;t)alxrxrcoatlaDeaivsls0texo(o3no1lp  mfeta(f Dum( o;t0oltn fciysla2rluvs (0 ltrir ootlm  an sl(0 2xo(m3iydoptemivi sf Drmxmo;t1tpenmf3ilsfmDeanvo (4 leoirciotfa rlnvi;(0t2xrim nu1lmeelfci tf Dtaurp;o0tlt  ociat mDelnvs;u)artnifcoy1oaDe i i t setoxo3oy1omtnmici s  Dua(ro;t4olxnioctydfm2rm(mont) rtoio3tydomDe uvs s0texoxm3nydom e ict t) rumx p;o4tpxnmiciysfsDeln pnt4trenmfciodlaD aneil(0 2trim nu1lm  mfvsls)sDrmuro;o1tpeniociatfs2umnvp (0 etrmr iy1latr n ils)srtrxmpnu4omtemivi t aDtmu ono4tpe mfeiydlm emnvsnt0altniocootlaDeau o;t t2toxrpoy1ome  nes () rua(rpno4tpeoifcilt s2ra(vp ()tlxrmf ta1oateau sl()trtoim3nodlle lnesls) 2tmxm oo1oet  fcild a2um( o t)altnifcta1lat anvsl()seumxm nu4apt lict s  ruaxm ;u0opxnifeiytlmDul(ms t)aetrxf3ia1oaDrluvo t seum(m3iy4om  lfvils  Drrx ont4tleo i3ils sDemu on(0altoxf oo1lptr neil()t2tmio3iu4llenmieiasfarrrx oou1oeto ociatlmDulnms;t
\ No newline at end of file
@@ -0,0 +1 @@
+i o;t trxoxm3nydamtnlieta(farrr(mpnu4teeomoeildls2ul(vp;(0trtoiocoy1fat  nvil( seuriopou1amenlivil(f 2taump;u1oet ioeiydla eanmp;u0 lxnxrcoa1lp rlueo t0srxmxmpoy1lleelfcta( s2tr( o;t0apeo feias s2emuvonu0tltoxo3tadlp raivsl() etrxopno1ame lfvs (f rraurpnt4aet mo3tysfs2umuvs (0altoxr3oodop  ln i;t t2trxm3iy1alt  ncsls) 2ta(rp;t4apx if3iyd mDeanmp;u4tlxomf3iotlaDeanvils0trxm(mpoodale mnetl(f rraxrpnt1aetnifeiadfsDrmuvpnu)tetoxf3ta1opteaieo t0 2tr(opiudal nmfes (farrax  nt0oeenifciadlaDrluvp u0tetrxo3oo1omtean ils  rxmio no1apee ivtls sDumxroot0opx iictld s2um(mo u4aetrxf3iydoa elnes (0t2um(mpiodoptnlivilsfaDur(monu0tpxoii3iatlmDemn s;u4 rxoxo iodfmtraivs t)setoxr3no4optn fvsa() Duaxmpnu4tpeomfcilsls2rauvo t0 rtomr3tytfmt  u o;t0srur(m oodole  fvs (f Drru pno1tpe iicils a2rmnvs t0trenmfctotoaD livo t0 ruoxrpio4olenlfesl(  2ururpnt1tlxn f3ilsla2rln s u4trtoir io1lm  anvi;t0 2tm(o oo1olte fvsat)arurxm ;t4opto oeiatlsDeluvo;t0tlerio tydfmD lieol( srtrirpiydapeemnci sfs2tr(rpot0oee iociydfs rluvonu4tetoxoctadfmt auvsl(0trxo(mpoy1om elnctas a2rm(r oo1tpt mo3tadfa2ra( s;(0trxoxo todfmDeaneslt sexmim iu1lme  fesat arumxmp;t1olxo feiltfa2um(ms u)trxrxr3oodfa e neo t)trtm(m3io4omee fesasf Dra(  ou0optnmfciys s emnvs;u)tleoir3oodlpt  n o s t2toxo3ny1am nlncils s2rr(m ou4tltoioetydfsDrau s (0 lxoio3oy1fmDrlnvi;s0 exm(o3ny4lpenmfet t aDrr(rpnu4opt mociys a emnvo ()alxrxo tytomtelnvs;s trurim oudlp nmivtlsfsDra(mono4texn oeils a ulu s (4tlxoxo3iotla rluvs;t)trto(mpou4apenlnciltf Draurono1ale miciltfm2uluvo u0artnxo3iydom  an olt  etmio3iy4lpt lfvilsf rrr(m ;o0tpxo ictaslaDrau snu0 rerxociatomt  ivo t) rtoxm iydamen icilsfsDrrxr ;o4alxnif3iatfsDum( p u0 etnif tadfaD lu s;s  2xm(mpiodopte nei t)sDtrum ot1alxo ictatla2uaums u4aetoxr oatlpteluvsls)s2tr(m nodoptemivils)sDtrx ono0tlto i3ias s rauvp;t)trxrxo iotfpDe u olt0s2xoxrpou4am nmicsltfsDta(mo;t0olt  o3ils s emn on(0tltomr3to1lmt auvs ()trtmim3nodlpenmfvs ()artr(rpno4aee mictysfs2rmnms;t0 rerxr3tydomDr nesl() rumir3iy1aptn nvt ( srrm(mpnt4openmo3iys a2ea( p;() lxrxf tadlpt auei t)s2to(r3iu4olte fviatf 2rrxrpot0tltnif3iydlaDraumo;t4aexnio iydopD auei;()teur(r iu1lmtn neslsfaDraumooo4teenmfetasfs umuvs () lxrif3to1lp r u s;t0texrim3iu4lpt lncsa( a2taur ou4tpen feiyt aDuanmo;u4 rxrmr3oa1op eaivi s  rto(r3iu4ap elieils sDtru oou4aexn fcias mDrmu o;(4aleomo ootop ranes s)t2tmiopnu1lp emies tfs2trumo;u1tpxomociadfs rmu pnt4 eeoirciydlaDrai o;t)s2umxm3ny4ape lfeilt  rum(rooo4tptoio3iysfs rluvont) ltnio3tadlpDraueil()seumim3ny1lme  nvsas s2rr(r no1teen ociyt sDea(ms t4areomo3oo1om e uei s0 euoiopnodlmtnmictasf rtmum no4open o3tadfa2rmu p t4tetnmf3iy1fpt au i t)srumim3io1llt mfvs sfaDtm(mpnu4teto ocils aDel( o t0teeoir3iodomtranei;(0 rxr(mpio4aleelieslsfa2uaumonu1ale mocilslmDrm(vp;u4aeeomfctytfmt  ivs s0 euoim nu4lmeemfes ( srrm(r ou0opeomoeild mDra( o u)artrio oodom   ivs;(0 exmxmpny4ome mncta(fsDtmu ont4olenioeiadlaDranms t0tetrir tytfmt lnvs t0 2xoxr iu4op n nvt t)s2tmu ono1open octyt a2rmuvs;u0tlxrmf3iatop  lieolt texrxm nodlpeemnes t srtaxmpno0tee  icild a2ran o;t4teermfcoatfm raues;s  etrim3iy4lmt  nvsat) 2uau  ot1oet mietytlm rmnvs;t)tetrxo3tatlpDe u i;t0 2tm(o3nudop nlictlsf rururooo1oltomieiydla rm( p t)aexomf3todlp   uvols0texrxr3no4ale  ivi t aDurumono0aet ifciydls eln pnt) lxomo3iy1fa  lu s;( t2xmiopio1ll  mics ()a2trxmpnu0oet  feildls2ranmonu) etnmo totla   nei s texoir3ou4alt mnet ( sDurxr ;o4teeoiieiytfa2em(vpn(4tltrif iatfp raivslt0 exrxopoo4omee nes ()aDurx  ;o1alen ociatls rlnmp;u0trerif3iotfmD lnes;t  rxr(opnu4optemfes tf 2ur( o;t1aptoif3tysfs ulu onu0alxnirctatoa  aies;s tetoio3oo4aptemnvt s  2tmxmpno0aeto f3tlslmDumu on() lxoio3oydlptelivil() exm(o ou4omtnmivia(fs2tr(moot4aex moeiyslsDrlnmon(0 rtrmfcty1lpteauvo s seum(o3iydalenmivsl(fs2urur nu0aeen f3iasls ean onu) etrmo3tytla rlu s;t texr(r3iu4lpenmietat artr( pno1optnif3iatla2rlu o ()trtomf3iy1lm eli ols)tetr(r3nodolte ieilsfaDtmu  ;o1tlxn o3tyd s2eluvs;()tlxnmrcoadoaD aivi (0 2xm(m oo4lltnlivtasfsDrmx oou1aexn ieiat m rmums;(4 rxoio3iodfat  n o (  etr(o ny4am  mnei (  2ra( ont4apt io3ilt m umn o;u)alxnxr oydoaD lnes;s0trxmxo3ny1lpe  ivsl( srrmurono1tptnmictas s rmn p;u) reriociydom eaieo () eumiopou1omeemfes t) 2tr(m ;u0ole iieiydfmDea(vp t)treriociydoa e ueilt srxoxr ny1om n icsat  ruau pnt0aexomictyt s uanms (4 rtnif ootlaDrln o;t0 2to(r3no4apen ncia()sDtaur nu4oet iiciasfm eanmont0trxoif tydla ean s;s) 2urxrpnu4ll nlncs t)s2rmur ;t1tltoifetat s rlnvp;u) eenmo tytfat aieo;( sexm(r3iodlme  ictl()sDuru p;o4aeeo ociytls uan s;(0aetnir3todfmDr nes t tetm(m3oo4altelfcta(  2uaumonu1opxomf3iadls rl(mp;t)areoif oytomtraieolt t2urxr iudoptnmies (f Dra(  nt1tlt  i3iadlm2umuvo u)areoxr3tytfm   uvs;s0trurxm3oy1op nlietls s2ra(  nu0tlt  octatfa rmnvs;u0tltomo tatomtraieslt0seumir oo4lm n fvi s a2uaxmpot4alxo fctld s2umnvs t)artoio3tytlmte ueols0sexo(r3oo1lmee ieia( aDtr(r no4alxnmictat m2emu o t4aexnmf3oo1optr n i;(0s2xoio3oy1ape mnctls)sDtr( p;o4texomieiyd aDel(mpnt)trtnxr3ta1op  ln il(0truo(m nu4op n fctlt  2taumpoo4alto fciydfs ranvp ()arerir ootla rln o t  2xo(m3iu4altelivils)sruauro;u0alxn oeiyd m2rmuvonu)aeenxo oa1lptran o;t0trur(mpoy4amt licta( s2uau p;u0alx mf3tlt m ran p;u0tlermfcto1oaDr neils0trumxo3oydap nmicsasf 2taxmpnt1tex mo3ils sDumnvp u)aeeomo io1om  an s ()texmim3ny4lmeemnct s srtaxmo;u0tle if3tldla eanvont)arxomocoa1la   neo;s0sruoim ny1lpe lfciatfaDtr( o;o1aex  feiadfsDuanvs;(0arxrifcoydlp e uvs s) 2xoio oy4lpenlfvilsf Durx p;o1aptniociyslaDeln o;u0 etoif io1oa rluvo;s srxoim ou1lp elfcslt s2taxrono0tlx  ietlslm2rmumsn()tetoir3oo1om r ieslt teto(r3oodaltelneiat arurxmono1altnmfeiatfm uau o t0 eeomr3ootla e ivi (0 exoio3ny1ol  lneia()sDrru  nt0tlxoiociatls2rlumsn()artrxrciodoatrluvs (0srxoim3nu4lm elnctas s2rm(r ;o0tlx if3iasfaDumnvp;u)aeenxf3iydfmt  u s t0 2tmiopoo1alen iviatfsDuax pnt1alx mi3tldla rm(mp;() rermo ia1op   nvs t0trtmirpny4omtnlfcs t)sDumu oot1opxnif3iadls2rm(ms;t4 exrmf3oo1fm   uvo;(0t2tm(r3iy4ol   neiat aDuau pou4texoioeiyt s2ean s;(0aleoifciodfp eauvol(0teuo(r3io4ap elnes s)a2tmxronu1tltoioeils a2rm(ms t)trtoio3oatla rlnvi s0 eto(rpou4ope mics (faDtmx  nu4ole mf3iydlm2rm( p t0arxnmfcia1opt lu o;t) 2xo(opoy1am n ivil(f 2tmxrpou4opt  fciydfa2ul(vpn(4 ltnxrcoadfatrlieo;t t2toxo3nu4ll nmivias s2rax pnt4alxn f3iaslm umu s ()trxrir ta1fmD luvo (0trtrimpiu4oltnlfesa( a2urxmpno0teenifciytlsDran s;t) lermf iatfateln olt0 2urirpou4lpeemieslt)aDtaum ;o1tle moeiytls emu o (4trtomr oy1oa raues;t)s2xmiopoodllt micsl()sDtmurooo4oex moctlslm eauvp;(4 rxnio iadoaDe nvi s0s2xo(mpnodlp emfvilt)artmurp;t0tpx mictydlsDrmu s;() lerxf tadlaDrai ol(0s2urir iydameelfet tf Dtrxmpnu4aleo fciytfm2eauvpnt)artoxfctodfaDraneo (0teurxo iu4lmtn ictltf rrmurono4tpen iciad a2emnvs t0teeoxocto1fmtraneo;s) rxo(rpiudlltemiesl( arum(mont0oexoifeiatfs rm(vpnt) lxoxr3iatlaD au o;() rtrio3ny4omen fei t)sDtmx  nu4olxnmieiyt m eaumpn()trtnmrciytlm rlu i;t0seum(m iu1ap   fci (fsrtrx  oo0alenmociltlm2rlnmont)tlermf3ty1late ivo;t0t2xoxo3nu1ol emncia(fs2uru pnt0altnif3tltlaDea(msn()texoxfctytfpDrai o s0s2xoim3nodlm elnvt (fsruaur ou1tlen oeias a el( p ()tetnir oytfpte nvo;s)texm(o ou4lme miviat artr( pnt0oltoioeiat mDumnmsnu0 rxrirctadfm  lnvi;(0teuo(mpiodoltn fcil(  rurumpnu4tptoii3iys m2rmnms;t) exoio ta1fp r uvi;t0sruoxrpnu1lpeelictas  Durum ;o1aetn iciytls emu o;u) rtoiocto1la   uvil()t2to(mpoo1amtemnesas) 2rmxroou1aeenioeiltls2uan o u0trxnxo todoaDeluvo;( teurxo ny1om nlivtatf 2ta(mp;o0teen oeiadfaDeanmo;(4 ltrmr3oo1lmtr nei;s0trum(rpoy4amenmies ( srra(rp;t4alenifciydfa elump;(0arxrmf tatfptr ivs t0 etrxrpio4lm eliet s)arrrxrooo1tpeomoctldfm rmuvo;(4altnmr oydopDrluvilt0srtm(m3io1lmeemfvta( a2tau  no0altnmfciltfa2uau ont) rxrmf tytomD  ivi;t0 etm(o3iydomee fvsltfartrx ono0tleomiciatlsDrmn s t)alxrmr3oy1fatr n s s t2uoxrpnodaltnlietl() 2taxro;o0ope ifeiadlm2ul(mp t4artoiocoydop rln s;()s2urxrpiy4altnlivtlt)sruaxm nt0olt  fcild a2rlnvo u) ltrmfciatoa eauei;s)trtrxmpoydop nlivil(f 2umurp;u1olt moetyt aDrlnvsnu4 rxrxr3iytfmDelieo;s  rtmim3iu4lpt  fes s  2tmx  ;o4open fetldls rlu pnt0arermf ootlmtrli slt)s2tr(r3oydamtelivi s aDtm( pou1tpxoioeiyslsDum(vonu0aetoif3ty1fptrluvi;t0trxmiopnodame livs ()sruax  ou0optnioctltlm2ul( p u0 exoxr3totlpDeaneo t0s2xrio3oudal  lfct ()arta(rp;u0teenmociltlsDelu s ()tleriocio1optrlu ilt)t2tmirpoo4ol  lfvtat)sDrru  nt1olenmf3tlt m um(mp u)tlxoxfcoydom rluvsls)s2tmxmpoudoptnlnviltf rrmurpnu0oex  i3tlsfm2el(mp u)altriocto1omteauvo s)srurxmpoodapenliet t  2rrxrpou4oetn iciydlsDuauvsnt0texnxf totopD lu s;s)texrimpiu1omtemnct s) rua(mpou4aee  oeils mDranmpnu4texnxf3ty1fm r n o t)teuoimpoudalt  fcsatfs2uaxmoot4aet io3iltlsDemums;t0alxnircoadfpDeau ols)srum(r3oy4lmtn fes ( sDumump;t1teeo oetadfa2ul(vpnu4alxomf io1faD livo;s0sexr(mpio1am nmncta()sDurx pnu4tleoifeiltfaDuanmo;t4tleoxr todopt lieilt)t2xmxr iu1ll emncils) Dtmu p;t1optnif3iydlmDuau snu0 etniociadlm rln s (0 rto(m nodomtnlncs t sDumum ;o4tetoio3iat a2eanvon(4treoio iotfat an i;(0 exoio3iy1optn icsl(fs2rmuro;u0tex mf3iysfa rmn sn(4arerxrctotlmtr ueilt0trxoio oodame  fvsas srrau ono0aex iieilsls um(mon()tlxnmo oa1fmDe ieo;( teur(mpiodome  icslt)srtru  ot4texnmo3tlt m2ra(mp;u) renxfcoatfpD aivo t0teto(r3iudapte ncsat) rra(rono0teenmociat mDel(vpnu0 rtrxo oydopDe i o t)trtmxr3nu1oltnlfesls s2ta( p;u0opeoifctasfm2umnvsnt) lerxrciy1faD lu o s) exoir no1omtemics (  Dtax p;u0oexnii3tatlm2emnmo t4aeermo3oy1fptrluvi s0 rumiopou1ll e fvsa(  2rr(mpnu4tex  feiaslaDelnmp;t4trerxr3iy1fat  ivo;t0 etm(r3nodlltn nvt t  ruax o;t4apenmictys sDrmu s u)aetoirctatfpteai i;s0 eto(mpno1ape  ncs (  rta(rpot0aetn fciatfsDrlnms;t4 ltrio tatopDelu s;s0tetoxopiu1oltn nvsls) rrax oot4oeenifciadls uanmpnu0altnxociadopDeaueilt s2ur(r iy1ape  nvtl(f Drmu ont1ope ii3ias sDulumsnt0 exrifcia1la  lueil()setrirpiu4ope  net sfa2tmurp;t1tetnmietat aDrm(vsnu) exnio3oadfaDelieo;t)srumim3iu1lm   netatfsDta(rp;u4optnmfeiltfa rluvp;() lxoxo tadfaD  ieo;s tetoxo oodomt lncta(fs2rm(  ;t4tltomf3iatlm rmn on(4trxoir oydopDr nvil(  rum(opiy4apeemnes t arrru oou1aet mfcils sDumnvp;u4trxnif oy1lmte n il(0trur(opiy4lm n fei () rur(moot0tlx miciys m emu s;t)aetnxrcoo1faD lieols seurxopiudap nmies tf 2ur(m ;o4tptnmietlsls ulnvo;u0 exrxrciy1fpDr n s (  rurxo oy1oleemfet () Drrumo;o0aleo ieiltlm uln sn() rerif todfmtr nvs t  rtm(mpiodlltnmnvtltfsrtmu oou4aet if3iydfs ulnvo;u)arxrmr iy1fp r nes t)tetr(opiu1apt  fcslt aruru oou4optoiictyt a2umuvp;u0 eenio oytlat lnvo;s)s2xmxr oy4lptnlicsas)arrr(mpou4altomi3tytlsDumnvs (0trtrxfcoy1lmtrlnvi;t  etrio3iodlpenmnetlt) Dua(rpoo0aexnmoctyt mDemn pnt4teenmoctadoa  an s;t s2tmxm oo4lltemivs tfarrm(m ;u4apt iietasfsDemu o (0aetnxf oy1fa  luvo s0teum(o3oodalee fct tf Dumu  ;t1apxnmfciys sDelnvsnu0aexomo oodfmte i o t)t2xmxr3nu4ole lfesas) 2taxmpou0tpxo oeilsla eln on(0alermf3oadlaD au o s)t2tmxo nu1lmeemiei tfarurur oo0olt  i3ildla uluvs t4tetrxo oodoa r ueols0sexoio3iudlmeelfesl( arrmurpnt0opt  ieilsls2uan snt4 ltnmo3oytomDeauvs;t t2um(mpiudlptemncs tfarumxmono1olt mi3iat mDemu s t4alxrxr totfm rlieol(0 euo(r nodomtelivslsf rtaxmonu0altnmfciydlm2ulu o u)arerxrcty1op ranvsl( s2urio3iu4ope mfctat)s2ur(m nt1alt ii3iasls2rlu pnt0aetrxo3io1fa elivs;t) eto(o3iu1ole mnvtasfsrumxm ou0aleoiieias s2umnvp u0alxnir3iytfpt lieilt t2trio iodll emfeta(farraxmpot1aeenmocildls2rmn s u)alenmo3tadfp  aneo;s)srtrim no4oleelneils)sDtrx o;u4teeomo3iad sDranmo ()aeeoifctytlm eaneo;t) rtoirpou4aptnmieta(  rra(r oo0olenioeiltls2emn p;()aetomr3ty1oaDraueo t truo(r3iy4ole livias)s2taxrpno1open i3iysfmDumuvon() rtomfcia1fpDr ivs s)texmirpoydap nmnvil( s2umx o;t0aetomoeiat sDuau sn() exnir3iytoptelivs;s0truoirpnydlp  lfvils aDrrum no4tlto ictld m elnmo u4artrmrctatfpt luvs t  ruo(o3oydop  mneilt  Dtmum nu4aexomfeiyt a ea(vs;(4trtnif oytla eaiesl(0 rxoim oo1am emivils) Dtru oou4oet moctldls umnmpnu)teenircty1fmteau i;t) 2tmiopoydlpee nvtltf 2umu p;o4tlxo f3iytla2uauvont4tltnio oodfatraieo;s0setrxmpoo4om n fciltf rtmx  ou0altomi3tldfa2ea( o;(0alermf todlpt au sl(  2to(o nydll   fesls)aDraurpnu0oee if3ilsfa2ua(mo;(4trtnmr3iy1lp rai s (0s2umio3oo1om nmfesls s2rr(mo;t4tlto f3iad aDra( o;u4areomfctadoatrlueolt)trxm(rpny4olenlfvsls sDraurp;u4aetnmoeilt a eanvp;u)texnmrciotlaDeai sls  rxr(o oy4ll   fvtatfsruau  ou0tpxnif3tydla2um(mp t) exnirctytfm r uvol(  rurxopnu1olt  fvils) rtrx pou1aet  octadfm emn o;u)aexoircoy1fa elneo;( trtoir oy1lmt mnvslt s2taxrpoo4tpxnioetlt mDemumpnu4alenxfciodlat lieo s t2toirpnu1am nlfcs ()arrrxrpou0opx iocilt a2ua(vsnu) rerxo todomtrai ilt0s2urio3oy1ale  net t)srra(root4tpxnii3iys s2emu sn(0altoio oy1fp   i il(0 ruoxopnudal emfvsas  rtrurpnu0apt mociyd a2rmnvpnt0artnio oodfp  lnvo;t)srtm(opoy4al elfetat a2rrumo;t1olxo i3iadla2ra(vp;(4artnif3oodlat anes ()srtm(mpoy1lle mfes sfaDururp;o1oeen o3iatlaDeanms (0areriocoodoa r i sls0setm(r ny1ol  lnct tfs2ur( pnu1apx  o3iysla2rmumonu4 reoif tydlpD lu slt) eur(m3ou4ap n fvsa(  Drru p;u1ape mfeias aDrln sn(4arxoxf3oytoa ean i (0srurim3oo4olen fct sf rtmx poo1tptomi3tydfs elumsn()alxoxf tytlm elivo ( trur(mpiu4ol e fesas)aDrax onu1oeen octytfmDuluvp;t0teenmfcoydom r nvi s0t2xmim nudlp   fcsatfa2ra(mpoo4tle  o3tld a ranvo;t4aeenxf oydfaDe nei;t0s2to(mpny4amt miet t  2rru  nu0tlx mieiysfa rm( s t0trtrir3ootlm rau slt)sexoxm nodlptn ivs t srrau pou1teenmfeiytfmDua(ms t)trtomr oa1optranvs;s0 2xo(opio1ll  lnvsat arum(moot4tpeoii3iaslsDumu o;u0aetoxfctatfmDeanvs s  rtoxmpno4am   iei s s2tm(m nt0aptnifeiyd m ulumo u0aexomf3oydla rli s;( texm(opny4lleelivil( srrm(rp;t4oet io3iad mDrlums;u)trtoifcoy1opD lu i t0teur(r3nu1llenmies t  rrr(rooo1opxo ociyd a2rln o u4trermr oytfp r n slt)teurxm3ny4oltn feta(fs2tauro;t0alxo ocilt a elu snu4 exrmfcoa1fateluvs (0 eurio oodol e feilt srtru ono1tex iieild a2uanmsnt4altriociydlmt ai sls0 etrxr ny1amt lfvt t) rtru pot0tpe  i3iatfa2elumo;u0 rtomfcto1la  luei;( tetr(m3ny4lm e ics (  rumur ;u1alen iciyslaDua(ms (4altnmf ia1omte u i;(0 euoxo3oo1ap nmfesasfsrtm(mpot0aetn feiasfs rl( o;(4tetomf iadop  an sls0seuoiopnodomteliesas) Dtmxm nu0opeomfeils s2ra( p;t4aexnxr3oadopD anei t s2um(rpoydalte nctl(  2um(rono0open i3iydfs eanvo u4 exrmr io1fp elivo;s srxrio3io4ll   ncsasf 2tm(moot1aexomf3tad sDean o;(0alxniociodfatranvs s  2xmirpnodllt lfcsas)s2uax pnt0openmieiytfm2emnmp;u)artoir3iodlaD livs;s0s2ur(m iy1om emnesl(fartau onu0oltomoetat aDea(mo ()trerifctatopD auvsl() rxr(m3iodomtnmfvs s)arraxr ;u1apxnifctysfs2rmnvsn(0aetomrcia1fa r n s t)srtmim ny4al  mictas arra( pnu4olxnmfctaslsDrlnvonu0 ltoir oydfp rlneo s)srxo(rpoydll emfctl(fa2rmumonu0aptoio3tyd a ua(vp t)arenmr ia1fpDeaneo s0 rto(m oydop e neia(  Dtm(  ;t0ape iociydls ua( p;u0 rxoxfcoodoatrln o (  exm(o3iydop elfeiatfsrrru oot1tpe  feiyd mDelnvo () eenif3oadopte ieo t0srtmio3ou4lpen ivsa()srtr(r ;o0aetnmoetytfm2el( o;u)aeermf3ta1lmDr ivi t trtmim nu1lme lneil(faDuaxrpno4aexn ociadfm ea(msnt0 exrxf3iatfa raueo;t0seumxo oo1amt  fetas  rrr( o;o1aexo ocildfm um(msn(4 ltoxr totlmtr i sl( trtmxo no4lpenmfet sfaDumx  ot4opxoifciysfs2ua( o;()trtnxo3iadop  ai o t0trtoim nu1ale  fviat srtmx pnu0teeoiicildfs2rln snu0altrmocia1lpD lneo (0 rxmim no1am emnvsas)sDumum ot1oetnifciasfm emn o;u) eenmo ty1fa  lues;t sruo(o3oodolenmfvsat  rraurpot4texoii3iydls rlnmpn(0aeerir3io1omtrlueilt0srurio nudap nmfci ()srumxrpou4aeeomfciad s uan o;t) lxrirctotlaD luvs t  ruoxm3io4lpt mieil()aruau  oo4tltoio3iatfm ea( s;u)tlxnxoctatfptrlnes;s0srxoir3iydole mictatfsrtau o;u0teto f3iyt s eluvo;(4areoxocootopDr nvo;(0t2xm(mpoo4opeemfvs ()s2tmx  ot1tptoii3tad m2emnvs;u)arxrir tatfat livilt s2uo(m iy1lme mfvtls arrrxrpou0teeomfetydlmDelnvpnu)tltoxo3ia1laDeaivo () 2xoio oodom n fvta()sDua(rp;o0aeenmiciasfa ua( o ()trtoxocootop eluvs t)trtr(rpoo4lpt lfesat sDtax oou1opxoif3tyt m elumonu0 lenmo3oatomtranei;()truo(r io4llt mnci ( aDrmx p;u4aexnmicilt m ua(vo;()aeermr3totlpDe ies;s  rtmim3oy4amte icsl( aDrrx p;u4alt mfciydls rmu p;(0 eenir oadfp rlivslt0texoxo3nudol nlivi sfaDtaxr nu4apx mf3iys s2ranvpn(0arxoircty1lmtr neo s0trumxm3iu4opeelnvil() rrax pno4tptoif3iad sDea(vo t4tlxoircootoaDeau i;t)teuo(m nudom emici t sruaump;o4oexnmf3iytfsDrmnmsnt0tleoxr3tytfateaues;s) rurim3oy1ap emfvilsfaDrrxr ot4aee  ociydfs2rauvo;u0treoxo ootlmtelu ol(0 2umimpoydaleemiei ()a2raum ;t1ape  iciyslm2elums u)tetoiocoytlpDe iei t0srxmxo iu1lmtelnet t)sDua( p;o1apx  i3iasfs rln on(4 exomo to1fat ai s t)s2tmirpnu1llen ici t)aDtmxmoot1tle ifeiysla2rmump t0 renmf oy1fp r nvo;t  rurxo3nudlpt  iesa( sDtmx oou0olxnioctaslaDeluvo (0aetnmf tatfate nvo;t0t2tmim io1alen ncs (farum( p;o4ole mietldfmDrmnmo;t0trerirciytopDeaneo;t)srum(mpiy4lmte fvtls)s2rauroou1alt  ocilsfm rau s t0alxrxo to1oat liei t)tetoim iy1al elieta(  rra( o;t4tpx iiciasfm2rmuvs;(0 rxnmocio1fpD  i o t  2xrxrpio4omee fvtatfsrrrx pot0aptn f3iatla uluvs;t0tetoir tatop rlnvs;t seurxo io4am  liet s) Duaxm ;t4oeen oeiys a umnvp t0tltoif3oadla r u o t  ruoir ny1lpt mieilsf Dra(mpnu4tetnmietas s eanvp u0arerxociotla rlivo;()setmirpnu4amtemnctl(fa2rrx  no1olto ietldlaDrlnmp;u0 renmrcty1fatr uei (  2ur(r iu1ol nlneta()a2tmxmpou1tlen ocildls2emn p (4teerxrcoadomDraueil()s2tmxopoy1altemies tfaruax ono1tle ioctlt s rmuvp;u0 ltnifctadopD lnvslt0texmirpoo1llenmies sfsDururo;t4aetnmietydlmDumnvo;t)tlxoif todfaDeluvs;(0trxo(r3iu4lmenlicil(fs2rm(  ;o4aetomi3iltfm2rmnmpn(0tlermo3iytopDean il(0 2ur(r3oo4lpen nei s  rtmx pnu1tlxo fetysfmDra(vs ()arermf3ty1fa  auei (0srxoxo3nydlmt mietatfs2um(ro;o0opeomo3tatlm2umnvp;u0 eenxo3todlmD  ivs t  etmxm oydlpeelietat  rua(moou0texomi3tad aDumnvsnt0arxnxf3iatfat lueo s setmim oy1lpt mfcs sfsDtaxrp;o0oee ioeilsfs eauvp (4teeoif3tadlpD  ieilt)s2tm(m ou4ll e nvtl(f rrm(  no1aex if3tyt m el(ms (4alxnxo iytlaD  n s;s  2uo(o3nudaltnlnvtat  rua(ro;t1oeto o3iytla2em( p (0tltoif3ta1la e n ils sruoxm ou4lpeelivil(fs2umx  ;t1ope iieiytfs rmnvpn(4arenxf3tatlptrau o;t)s2uoir3nodlmtemfvias arumu poo1aetoii3iltfsDel( snu0arxnxo iotfp e ueo;( srxoxopio1ame  fcsl( srurx o;o4alxnmiciydfa2raumonu0alxnxrciy1lm eaivi;s  etrxm iodamte ict t sDtr(r ;o4alenmfetydla elnvo u4 exomf iydlmte nvi;t)s2xm(m io4lleemfei s)sruru o;o1apt ifetydla em(vs;u)tltnxo3tytomDraiei;t) 2xo(mpou1altn ivs sfa2rm(rpnu1tpe moeild mDem(mp;u4trtrmociotfateanesls)seuoxmpio4apenlnesat  Dua(rpou0tpe iictltfs2ulnvsn(0aeerio io1fpDrlivolt0 rxrim iy4ole  nvtl(fs2tr( o;t4oet mfeiatlm2um(vpn(0alxoio ia1omteai s;t)sruoxr3oy1al emiei () 2urxmo;t4alx if3tld mDelu p u0 eerifctadfpt  iei;t0texo(o oo1alt lfvt ()aDumxm no1ale if3ilslaDeluvo t0tlxrio iydlm r uei;t0tetm(r3ny1ap n fcsas  rum( poo1aexniietatlm eln pnt4 ltrxfciy1faDrlivo;(0 rxm(r3ou4op emieiat s2rau p;o4tleomo3tlt s2em( s;()aeerxocoo1lp   u i (0 rtmxmpoy1lp emicias) Dua(mp;u0olxomo3ils s umn p;t4altrxf3oatfaD  u o s0t2uo(o3iy1am nmfcsl( arumum no0tpxniocilsfs umnvo;(0trxrxf3ootfm rai ol()srtr(r3oodom  lfcil() rtm(monu1ape  fciatla2uan o () rerio tydopD  i slt s2uo(rpoo1om  mfvs t)sDrr( pno4tlt  o3iltls2ea( s u4 lxoir3tytomtrlies ( seumxm nydopt  nvtl() 2rmxm nt4teenmicildfsDul(vs;t)aexrmocoatfpt anvo;s0trurxo oodaltnmieil(  ruaxm nt4tex ifeiltlmDean o;u4 exomfcty1faDeaneslt0trurio3ou1op nmietat srrmurooo4opxoiietlsfsDemu o (4aexnxf oa1om raivilt t2tm(rpoudaptemnet s  Drmxro;o1tpe ioetlt m uau s;t4altrxocoy1fmt livils  2xoxm no4omenmnesas  2rmxm nt0aleo feildls emnvp;(0tlenircoytfate nvs;( setoxm oy4ol  mncsatf Dtauro;o1tpenii3iadlmDeln p;() lxrxf ta1fmtrlivil(0trtmim3oy4optnlivs () rurum ;o1aeenmocildlsDeanvp;t) rtrir3oytopDr uesls srxoiopoo4aptemiet (fa2ta(rpnu1tltnmf3iydla emump (4arxrir iydopDrlnes t0 rtoxo3oodlm   nct (f Dtaurpoo1alx ioctyt aDeau o (0 eerir tatfmtelu s;t  etoim3io1lle lnvs (f Dtr(r nu0tpx io3tyt s um(vo (0 etomr tydomt  n sls tetoxm iydlpenmies (fsrtmur ou1oleo o3ildfm elu s u0 eeoif3oy1fptrlu i t  2trimpiodal nmnvil( srum(rpoo4ope ii3iytlsDuaump;u4tlenmf3oytfmDr nei s) rxriopno4ame lietl( aDtmum no0tlen fetatlsDul(vp (4trtrxo oytop elivs s)s2ur(r nydapenmnviat  2um( o;t1ape mf3iydfs ul( s () exrmf3tytlatr i il()setm(rpoo4ol elfcilsf 2rr(r ;o4oeen i3tltls2rlnvon(4trtnmr3ia1fmtraieo;( t2trxr ny4lpe liviltfa2umump;t1apt  o3iltlmDra(ms u)altrxr iy1fmDeai o (  2xoxr3io1ll  lfesa( srtau  ;o0tpx mfciydfs ulu s t4 renxfcoy1fpDeaieils0 exrir iydal n nvs sfs2rmx o;u0aeenmiciad aDelnmsn()alxoio to1oaDeau o ( teurxm3ny1ol e ics s)a2rr(m ;u0tpeomo3tatla2uanmo (4tlerxr3oo1lmtr i o ( srtrio oy4lp e ncslsfa2tauro;t4tpe iociydlaDrln p (4 lxrxr3ootlm   nvs;s)srxoxo3io1omeemfeta(fsDuaurpou4opxoiietlt m rl(vo;t0altoxf3oatoatrlnesls)s2uoio ou1ol  livsas)arururont0altnmfctasfm uln ont)alxoxocootopDeauvs;t t2toxmpny1omenmieiasf Drmu  oo0aexoioeiyd aDel(vo u4aetnxrciatfpDe n s;(0 eumxr3nudap elieiasfa2tr(r ot1apxnmoeiys m2ul(mo u)texoxocto1lpteaneil(0 etmxmpou4lm  mnesls  Dur(r no0oeeomfeiytfmDumuvonu0tlxnmrctotoa elnvo t)s2trxmpio4omen nct tfarrmu pno0oexnifeiltfa2eluvp (0arxnmr iydoptraivslt)srurxopnodlmtemiesa(f 2ra(mpno4oleoioeiytfm2ul(mo;(0aeeoif3iotfptr nvslt0 2xrxopnydlle  nvi ( srrrxmo;t4tpe  f3tysls2ea(vs;()aexoio3iotoptranes t) 2uoxr iudlmt  icsas  rtrurp;o4alt  ociydfm2em( snt4artnmfcia1fpDrlu sls0 exr(o3ny4aptemnctls aDtaxrono1aexnioctldlaDran s ()aetrmfctadomD auvols  ruoim3ou1ole  fesls srum(monu0optoifeilsfm rmnvo t4arerifciy1fmtrlnvs;( setmxm oo4lpeemicil( a2urxroou4apx  fctydlm2umu snu0texrmfciatlp e ivi (0 2toxr3nu1amt mnci sfarrax  oo1tpe iociad m ua( p ()texrxo oytfpD  ivi (0s2xmxr oy1lme  nci s  rumx onu4ope iieild a ulu snu0tltrio3tadlmDrlu o s0 etoim3oo1lp elicil(  Dum(rpou1apenmfciydfm umu o t0aetnmr3oodlpte n o;(  etmim iydllt mivtat arum( o;t4oetomi3tydfs2um( s ()tltrmr3ty1oatrai s t seumim3io1ll   ics s  2rauro;o1opeoifeiadls2elu o;u0 rxrircto1op  luei s)setoxmpno4lltemnct ()artru poo4optnif3iatfs eau pnt4aeenmrctytlmtelu s;s trtoxo io4lltnmnvtlt)s2ta(  ;o0oltnmi3iyd mDea(vs;(4 ltnmfcio1opD luvols)s2umir3iy1lle  netl(  2urxro;o1optniietlt m rmnms t4treomr ty1om e neil(0setmxr oo1ole  ivil( a2uaxmpnt4oex ifciat aDemuvon(4tlxrmf iodfmte uvil(0 2xmxm3iu4ol emici s  rra(mpou4oetomi3tyd a rmnvsn()aetrmociotlmte u o t) eur(m io1am e fvi t  Dtmur no0tpxnii3iytlm rm(mpnu) lxrmrciodopte ies s t2uoiopno1apt mivtas) Drmx ont1alt mi3iyslm2ra( s (0 exoircoadlmteaivo;s t2xoxo nodamtnlfctltfarumumonu4olxoiiciad a elnvsnu0tlxnxf3iotfm rlivsl(  etoio ou4ole  icsa() Dtmxmpnu1tlx mo3tad m rl( sn(4trxnifctotfmD  iei s) 2urxr3nydap nlivt s sDuaumo;u1tee  i3tasls eau s t4tlxrxf iydfmD  u i;()s2tr(r3iu4al   ivil()s2rmurono1texo ociltls ulnmp (4texomoctytlmDrai ils texm(r io4om   nvtl(fs2rr(r nu0tptn o3tydlmDrl(vpn(4altnmo3oy1fm   ivo;()trurirpoydapt lfetat)aruaur nu1ape  f3iytfmDua( o (4areoxf iadopDe n i;t0s2trimpnu4ap e feta(f Dra(mo;t4tptomoctasfm2uln o (4trtoxr3to1lat lieslt) etoim no4ll emivia() Duru o;t4aetnifetyt s2rl(mo;u4artoxf3ootfp eanvi;( trum(o io4omtemnvtasfs2rmum ;o4tetniiciydls2ul(ms () exoif oytomD  uvsls  2toxo no4oltnmivia(f 2tm(r ;o4apeoifetlsfaDumnvs;(4 exnircoytla elnei;s) exmim iy4aptn feil(  Dra(m ot0apt ifeilsfm rmnmonu0trtrmo3oatomtelnvo s0t2trxo no1alee fvsas)a2tru  oo0tet  ocilt s eanmpn(0trtnxfcoy1fpDe n s;t0t2umxr3iu1optnlfciat)aDraump;o0alt micildls umnmonu4aeenmr3ia1oateanvi;()srxoio oudap elfct s aDtmxm ;u0olt  iciadlmDuluvo;u4aetnmfciodlmD  u ilt) rxr(mpiy1llte fvsa(  Dtru ont1aeeomf3iyd a rmu o;()trtnxf tydfptrlnvs s0 2trxr ou4om nlfcs s s2rm(r no1olen f3tldfaDemnms;t0trenxfctodom  auvolt0s2toxo oodam   ietasfsDraxmoot1aet ifciys s2ranvp u)texomf oadoa elivo t  rxmirpoudlmtnliei t srtr(  nt1oet  f3ild aDumnmo;t4arxrmf3ia1lmD auvs;s0 rxo(opiydom elfct sf 2raxmp;o4alxomieiadlsDulu o (0 rtnmf3iy1fa r ueo t0 2tm(mpiu1lmtemictl( aDrrx oot1aee mieiadfs2rlu pn(0trtomocty1oaDelivs;() 2xmimpio4am nmnvsat)aDraxrp;u0openmietytfm rl(vs;u4 rtnir3ootomte nvol()s2umimpnydom  lnci ()s2uax  no1tpt iociadfs2ua(vs;()tetomr oytlmD aivo s) 2tm(opiudaptnlfet () rtrxrp;u4oetn oeiyslm2rmnmonu4tleoir ty1op r ueils)srxoiopio4omtn ictasfa2rrxm ;o0olenmoctyslm el(msnu0altrmf3tatlmt luvsls trxoxr3oodlm   ivtltfa2um(rp;o1aeen ieiydfm2rl( sn(0 rtrxfcoadop   ivs;s t2uoxr3iu4ol n fesat)srtrxr ;u4apxnmoeiysfm2emnmp;t)alxoxo iotopDelnei;s s2tmim3oudale  ncsl()a2tmxmpnt0texo oeiysfs2el(vs u)aetomo tytlmDr ies;(0teuoxr nu1ope micta( sDumump;o0aptn oeiydfa ul(vs u) rtnircoo1lmtrauvs (0srumimpio1omtnmnvi ( a2ur(rp;t0oltniieiytls2ua(vs;u)altnmr io1fmDe ieols s2xm(opiodaltnmfvsas srrmu p;u4olx mfciaslmDeaumsnt4 eerirctatom  lueo ()seuo(m3iu4alt mfetasfarraumont1tlen i3iytfa rln snu)aexriociy1lm   n ilt0setoxr oy4lleemnvtl( s2urx ont0ope moetltfa elnvpnu4 ltoifciytlp   uvo () 2xoimpnu1llt  nei ()arum(mpnu4alt mfeiyt s2rl( p;(4artoxf iadfp  anvol( t2trxr3ou4op  lictltf Drr( ont1tlxomieildfaDea(vonu0trenmrcta1lmDraieo;s0srxoxrpnudap e ivsl() rtmxmo;o0tee if3iltfa ranmo t4tetrmf3oatoatelieils srxoio oodape lfci ()sDur(mono4aptn o3iasfsDulu o;(4artrmf ootfmteliei;t0truo(o3ou4om nmfvslsfsDtmx  ot4aex ioeiyt s rl(ms t4trermf tatlpDr n s;s  etrxmpno1lle  netl(fsrtrx p;o4apx  i3iysfmDemn pnu4texrmfctotfpDeliei (0 2tr(rpoudaltemnciat a2uaxmpnu0olxn ociltlaDuan o;u4aleoxf3tytfm  aivi t s2xoxmpno4op  liet sfs2tauroot4tpxoiieias aDumnmo t4 lxrxr tydoa ranes t0 2xmxm ou4llt mivils) rtruro;u0tlen ictltlm2rm(vp t0alerif3iotlat livs;s)trxrxo io1lle miei s)srtau  nt1aee mfeiyt a el(mp;u)tltniociatfateli i;(0 rtrio3nodalenliei ( s2raum nu0oetomfctytfs rlnms t) rxoircto1fateaiesls sruo(r3ou4apen fcsa()srua(m nt1oexnio3iys sDumu o;t0teenmo oodoa eluei (0 2xm(o ou1lltnmicta()sDtrxrp;t4tee moetasfm el(vo;(4alxnmr3tatop rlivsl()seumxo3oo1ap n feilt)s2rau pot1teeoio3tytfm2rlnmo t4tetomo iy1latrli s;t)s2trir iodomee nesl() 2rm(monu4teen i3iyt sDul( s;()tlxomrciytfa eauvo;s)texoxopio4lm emfet tfartmuro;u4opt ifciadlaDrlu p;u4alermr iodlmDr ueolt)sexm(opiu4am nmfcs tfa2umx p;t1apxnio3ilslm2ea( o;t4 lenxr3iydlatr u sl()truoirpnu4lme liet tf Dtaumooo4aeeoiieiyslm umuvp;t0texnxo3todlm rlnvslt0texm(opio1amtelivil(fsDrax onu0apeniociysls emums u4tltnxo3tatlmD lieo t0t2tmio3ny4altnmici tfsrtmumoot0openio3ilsfa rmnvp t4tleoxf3tydfaD  nvsls) 2xm(mpiodamt lietltfs2trxmpno0olxomoeiytls ea( sn()tltrmo tadomtrlneo s0s2tmxr oodlp e fesl( a2ra(mpnu4opxo i3tytfs umump;t0altnir iatomD  nes s0sexmim3oo4lme  ncs (fsrumx ont4alx  f3ias m uanvo t) leoxfciatopt auvo;s t2um(mpoydlptemnvt s sDurur ot1opeoifetlslsDumn pnt4 rermrcoy1omtr i i;(0trtriopnu1ame  fetas) 2uaxrooo0opxnmfctlsfs2ranms;(0aeeoxf3io1om  lnvs;(0srxm(o3oo4lptnmneia(  Drrx  ou4olenmf3iatla elnmon(4trxrxf iy1fmDrai il( srxoxm3iy4al e ncsa(  2uaxr ;o1oltoiociltls2rm(mp;u4 lerir3tatomDeluvs;s0tetmir3oodop n fctatfartm(  oo0tet  iciasfsDra(vp t0tleoif3oytomtelieo;s0srtr(mpiodlltemnesatfsDra(  nu4tpeoiietytla um(vo;t)altnir tadlat lnvilt srurxo3iudaltnmnesltfaDrr(  no4tpto i3iytfaDra( s (4areoir oodoatr ieils  2urirpou1lm n ncils sDuru  ou0aee  i3tasfm rl(mo;u) lenxf iytoa  anvslt) 2uoxo3oo4llt  fctl( sruaurpnu1alen fcils s ulu o t)aleoir iodoaDrlneol(0tetm(m nudlpt  nvtls)srua(roou0oexomieilt a2eauvp;(4artomo oo1fpt lnes s0srxmxr3nu4lme  ivilt)aDtm(mpnu0tpeoii3tydls2em( p;t4texrmrcoy1faDrau s t)seur(r3io1op  mfctat a2trxrooo0opx  feiydfs2rl(mo;u)trxoxfciatomtr i il( s2tmxrpiudope lnct () rrmuro;t0tlxoiieils mDuaums u0trenxf3oodomteluesl()srxr(m3iydoltelfvia(  Duax o;o4teenmoeiytla2rl(mpnt4tlenmo3tytlm eaivs;t0 2toxr3oydolee iviatf 2rm(r ;t4apx io3tltlsDul(msnt4areoiociy1omtran i;t0t2ur(r iodamtemfciat) Drmxm no1tpxn o3tltls2eln sn()teerif oytop elivils0 2tmir3iu1apen fvt tfsDrmxmp;u0altomoctldfsDulu p t4trxnmf iy1fa elueo;(  2uoxr nu4ome  ici t) rtmur nu0tetnio3iltfsDelnvo;u)tltrmr tatfm elieo t  2xm(o3oy4lptemfesa()srrr( ooo0aexnifcils m2elnms;u0 leoir iodfatrlu ils  rtoio3oy4ll nlivs tfa2um(mp;o0aet  fciytfm2umnvpn()tlxnif3tatoaD  ivo;t trxm(o3iy1al elieia()a2umurono4apxn o3tatls em( s;u4tltoxo oytfa eau o;t)teurir ny4lm n ivtls)s2raxrpot4altn fctlt m2rm(mo ()alxnxf tydfpte i i ()trtmxrpnu1opee fvi ( srrrumooo0tle mociat s umnvpnu4 exomfctodoaDrln s t) euoxopiy1lpenliei (  rtrumpnu0alx  ieiatfs rlu o (4tlenmfctatoat  n ils0srtoio nudal e ivsa() rrau ooo0optn i3iydfs2ran o t4 ltnir3iydlpte i o t s2umxmpno4om elnvs (fsrrr(m ou0aetoifctaslm2ean s;() eenifciotopDe ivs;t t2urxo3no1lm nlnvia(  2raumpoo0teto fciyt a2ra(mon() exomr iytfa rli o;s)setr(rpiydale  icsls s2raxrpoo0aptoiictadls em(ms;t)trxoxf io1fpt  u i;t0setmirpoydomt lfcs () 2tm(mooo1oeeo oetydfm2elu p;t)aexnxf iotfaDeaneo;t0 eurir3iu1lmtnmfvsl(  rum(mp;u4aexo iciytlsDra(ms;(0 etrxf oydop rau o ( truo(rpoydll emnei s srur( p;u0tptomfetasfm rl(mo;u)artnmr iy1optrauvs;t0s2ur(mpnodlptemfci s)arum(rpou4alen i3tatlmDra(msnu)tetoir3ty1fpt liei s)s2trir ou1lme lfvias s2tau pnu4olx moeiysfa2uanvs ()aetrmf3oy1oaDelieil( setrir ou4omtnlfvs s) Drr(mpnu0oex ifeiydfm2eln snt4treoxr3iatlaDrau o t) etrxr3iy1ome lics s)s2tmxr nt0tpxnif3taslmDrlumsn(4arxoxr ootoa raiei s0srumxo ou1ol elfetatfa2rau o;u0tle mfeilsfm raumsnt)altoxrcoytfmtelueo t)seuo(m no1omt  ictlt) Dur(rpot4tet mfctatfs ranmp t0 rxnmr3oydlp   nesls  2xmxm io4lpeelicslsf 2umx p;o4olenioeiyd sDrm( p t0 etnmrciy1omD aivo t seuoxm nu1ope mnct sfa2ur(mpno0ape  feias m2elu snu0areoif3ootfpDeai s;(0seto(m iu1lptnlnet (f Dtrxmp;o1aexn ieiydfa2rm(mpn(4alxoxr tydfmD lueols s2umxr oy4amt lfcsls  Dtr(rp;o0tle  oetlt m emu snt4alermfciodop  aneo;t) rum(o oo1amt  fci (  2umxm ;t0ale  ieildfs rl(vsn(4teermoctadfatraivo ()srumxrpio1apen fviatf Dtaxmo;o0tpto fctltfaDul( p;t4 lxnmr iadlaD lu olt)trtoxopny1aleelneilt  2ua(moot1tlen fetyslmDran pnu4alxrmr3oy1la elies s)sexm(mpoy4ll   fesasfaDrru p;t4tltn ieiyd a emuvsnt0artrmo iotlm  lnvo s  etoxo nu1lmeemiei s  rumxm oo1teenii3iltlaDranvs t0 ltomo ia1lp rlivo;t t2tm(rpoo1olenlictls)srum(rpnt1alt mietasls uauvs u4tetnxf tytop ean o;t setrimpoudlp nmnvsl(fsDumur ot4tpxoifciatfm ean snu0trxrif3tytfaDeaueilt t2um(rpiydlp emfci s arua(  ;o4opxn octytla em( o;t4teenxo iotopDr ivilt truo(m3ny1ape mnci sfaDur( ono4oeeomf3tas aDem( snu)trtnmr3oydfpD lnvs (  rxm(opoy1ape lnvi sfa2uaxmpnt0apxnmo3iadlaDeauvon(4 ltoxfctatlmte n o;s)seuoim nudlle mfvta(fartr(  ot0tpxo oeiaslaDemn pnt4 rxomo oytfp r uei;s trxmirpnydaltnlncsa(faDumxmp;u4tptniiciat m um(vs u4teeomo3to1fpte ieo s)setrio3oydllenmnes (f 2urum ;u4oexn ociytla ra(vpnu) exrio oo1la rlieo () rxrir oo4llen ivtls srumum nt0aex mieiatfaDuln s;t)aetrmrcoodom rau s;t0setr(r3nydamtelivil(fs2ra(mpou1olen ieiysfm2ul(mon()altrxo3oadlpt  nvs;s)trxr(m nudapte icsa(fa2ra(  ;o1oexnmfctatfs2um(mpn()treoioctydfmteai o s)texmim oydapeeliet ( s2raxro;u4oltomicildfa2raumon() rtomf ia1omDelueol() euoimpnodale mnct s) rurx pou4oetoifcilsfa el(vs t) etnmr3tydfaD  n i;( srtr(mpnodap  lfetlsf 2ta(mpoo1tlxomf3ilsls uaumo t)tltrxo ty1la rlnvsl( t2um(o3iudlleelivtasfaDrrxmpot1oeenmoetlsls uan sn()tlerxr3iadom eauvo ( trxo(mpnu1optnlfvt s  rumu  ot1tlx ifeiadlmDem(ms u)tlxomo oydfpD lues s0tetrio3ou1ap nlfet t)artr(ro;u4aet  fetytfmDelumont0texrio3oy1lp ranvo;s texrim3iudlmeemnvils) ruaxmpot0oet iictltlm2elu o t) reomrcoo1faD luvil(  euoxo io1omeelieias aDrmxrpot1aptnifetadls ulu o;(0texoxfciodomD lnvilt t2xrxm3iudlmt  fci (  Drmu p;t0apxoioetasfs umums;t)tetrirctatfp elneils) 2xrxrpoodlpeelics s) rraur nt0oltnioeils aDem(vo t0tlxrmf tadfpt liei ( trxoxm3nu4alt mnesl(faDtr(mo;o1aetomfciasfm2rlumsnt0altrxf3oydomtrauvs;t t2umxmpnu1olee fcs s s2rax p;u1olxniocias aDrmn on(4aetrif3oytfaD lieo;s)s2xoimpou4ome  icilsfa2raxrp;t4apt mfciydfs rmnvs t4alxomo iydfaDe u i;t)seumir io4open nvi t)sDrru ooo4tlenmf3iadlsDelums u4tltrxr3todomDe nvs;() exmiopiu1olt mfvilsfsDrmx poo1texnmi3tltlmDumuvsnt4arxrmr3ootomDeliei t0 rur(r iy4apenmicias artau pnu1tlxnmietltls rmumon() leomo ootfmDrlu s t0 2tmir3no1lpee fvt s)aDrrxr nu0olxn iciad m emnvon(0 rxrmocio1lmtr u ilt)teumir3io1omte iviat sruaumpnu0apenmieils a2elnvp;t0aetrif oydfpt livs s0t2xm(mpnodomee fesls)sruru  nu0aexo fetadfs2eaums;u)trxoioctadopD luvo;s0teumim oydap nmncslt arua(m oo0aeeo fctls sDul( p t4 exrxrciadopDe n o;t)s2to(mpny4om e ncsls)aDtm(mo;u0tpto oetltfs eln s u) rxnxo totom  auvol(0 2tmxm3ny1olee ivtls) Dumu  ou4alx ioeiatls2ul(vs u)trtrmocoatopte uvs;(0sruoxopou1ll nmnvtat s2tr(monu4apx moctas a eau s t)artoxo3iadfm r i i s)tetm(rpoydaptnmictls  rrr(m nu4tee iicias sDum(msnu0 rxomo3iatlpt ln ilt) 2xoio3nydlmeelnct sfa2tru ooo0aleoiiciltla elump u0 lerio3tytfpDraivols) rtriopiu4lltnmiet s)sDtrurpot0aee ifetasfm2rl( p u4aetrxr totlpDe ieils s2urxr iydlm e icia() Drrxmpoo4oeeoifetysfsDum(ms u)tlxnmr ia1laDelu o;s tetrimpio1lp emfvi t arta(mpnu4tptomf3ilt aDea( s u0 rtrmociydlm rluvo;s)teur(r nydol  mnesltfa2ua( o;u1texnioetasfaDeluvpnu0tlenxfcoodopDrlu sl( sexmxm3nudomen iesl()sDrmxmo;t1opx ifeils a ean s;(0aeermr ty1fp   nvs s  rum(r3iu1al  mnvtlt)sDrauro;t4opx  fcils m el(mo u4 rxnmrcty1opt  i il(  ruo(rpno1lptelivtls a2trxmpnt0apen iciytls rau o;t) lerxrcoa1fpD lnvol(  euoxm3io4opte nes tf 2tax ont1oet  i3tld s2rauvo u)texrmociodoa e iesl( srurxr iu1om nmfctat) Duaxrp;u4apxo oeildla ul(ms u4 rxoiocta1opDrau i (0tetr(r oydlle mictasfsDuax pnt0tet ifetlsfm2ua(mp (4arermr iodom r u o t)s2uoxm3ou1ap   ncias) 2rrx p;o0aet ii3tas a2ea(vp;t0 rtomf3iatfmD  n s;(  rurxopiy4apteliesls) 2taxr oo1ole  oetyslm2rl(ms t) renir iadlpt au s s sexr(o iudlltelnvsas  rraxm oo4opto o3tatfs2ea(mont) ltoxr tadopt luesls0srto(opoodll  mfei sfaDrmxmono4olenmoeildlm2rmu s;(4trtrxrctotla   uvilt)srur(opio4alen nvias)s2tmxr oo4tptoioetat s rlnvsn() lenif ootlp e uvo;(0 etmio3oy4ol elivt s)srtrxr ;u1tptn oeild sDrln pnt4arerir ty1la eln i s s2xmxmpno4apenlici sfarra(rpoo0aex  fcias s2el(mo () exnmf3oy1oat an olt)tetoimpiy4apte ict s  rumumpot4tpenmfcilsfaDem(vpnt4 ltomo iatfat  ieols  2tm(rpoodam  lfvtls)aDtr(rpou0tlx io3iatfmDua(vo t) rtnxo3ootfmt au ols0 2xr(m3ou4omt lncsatf rtruro;o0oltoiociat a2uanmp u0 exoxfciy1opteai o s0t2trxopoo1ale  ies s)a2raumo;t0tet iocils s2um(mp;(4 ltoirciydfaD lu o;s)sruo(r ou4om emfvta() Drax oot0tpxoiiciytlm ulnms;u0alxrmf3tadomtelu i;s texr(mpiu4ole mivsa( sDuru p;u0olenmoeiytlm2rluvo;u4 renif3todop  aieo;(0trtmxo3iudal emnvsltf Dtaurpou1oetomfeiasls eanvon() rxomo3tatoa rauvi;t0trxmirpnydamt lfvta(  rumur nt4tpxniieilslaDum( p ()tltrmr3oytlm rau i;(  exmxr iudomtnlfeiatf 2ta(m ;o4tltnmoeildla rlnmpn()teerxfcta1fpDelnvsl( s2umxo nodapeemnei tfsDua( p;t0alxo feiat mDra(vp t4aexrxf3ta1laD luvs;s)t2to(r nydomeemfci s) Drrxro;t0oexniieiatfa ra( s;t4 leomr3todlmt lneo;t)t2uoimpio1lpenlncsl(fsDtmxroot0texo fciat mDel(ms;(0tltoxr tadomteaieol() rxm(r nu1ll nmnetltfaDtax pno1alto ietydfsDrmuvp ()teermociotlmDeaivi s s2xriopiy4ameelnci ()sDumxr oo4alt  fciydla eaumo;t4tltoir3tadoaDe n o;( s2xoir3oydlp elfesat)sDta( p;o1olx ii3tatlsDrm(mo;u0 ltoxfciytopte i sl(  eurir3oy4alen fcias artrx pot4tptnif3tatfa2ua(mp;u4aetnio3tytoa e nes;t  eum(mpnudomen neiasfs2ur(rpou4apeomfeils mDuan pn(0tltomo3tadla elnvi;() 2uoir3oy4al nlfeil(farraxm ou4oexn iciydlmDuanms;u4trxrircoadfaD liesls teuoio iy4oltn fei t arrau p;u4olx mietld a ulnms (4 etrmf3todfm r u s;s srxmio ou4om e nes sfa2ururp;o0opeomf3ild mDrmumo u4tltomf3oo1oa rlu i t  rur(m oo1ome  ivt ( s2ta(mp;t0tlto octlsfm rmuvs (0arenmfcoo1lpt luvs s  exoxrpoy4ol nlfet (fs2urxmono0aee mi3iydlm uln p u4 lerif iadoatran o;s tetmimpny4lp nlnvsls)a2ra(rp;u4texn ieiydls ra(mo u4altnxf3iotoate nvols0trtrxopou1apenmnct s arrm(r ot1tetoii3iasls rmuvo;(0altoxo3tytfm rai s (0setr(o3ny1lpenliciat) Dtmxmo;u4aeeniiciadfs ulnvsnt4tlxnxf iytomDeau o;( setoiopoodlptnmneia()arur( o;o1optn i3tltfm rln p (4 rtrir3ia1fp rlivslt) exm(r io4al nlivi sfaDrm(mo;o1tle mfciysfm ua( p t) leoio3oo1fa raues;t t2xrxo oudape  fctat s2rru p;o4olx mi3iytla2uauvon()artomf3io1fa  aivil( seurim3iu1ome  ivt s a2raxm oo0aexnmieiaslm emuvp;(4aetnio3oo1fm  anei;s) 2trim3iudomtn neils) rra(root0tpt ifctldlaDemnmsnu)teeoif3oa1fm rliei;s) rtr(o3iy1ol nmfctlt) 2urxr ;u4aptnifciat mDul( snt4tlxoxf3iotfat aivs t)trtrimpiydolt lfvil( arumxmp;u1aptnmiciytlmDumnvp (4trerir ootlpDr ieo;()t2to(opoodlleelnetas) 2trx oou1aexo fetat a eln o t4alerif oa1fpteanvs;( t2trxr3iydopenmiesls)sDumxrono1texnmoetysfs ua(mp (0trtoxr3ty1fa ranvs;(0 2umim3io4ap e ncs () 2ur( o;o4tlxomoeiyt mDea( s;u)trtnmociydomtraivi;s0srtrir3iu4ol   ncslsfa2uax ont1tptnmi3iadfmDuanmsnt4tetnio iadfpDelnes t0t2xrim oodam nliciatfs2tr( pnt4alx  f3iysfm uau p t4aeerxfciadlaDr n i t0srtrxm iudal  liei s a2rax  nu4texnmietlslmDrm( s;u0 eerxfciy1opDran slt) rumim iydlltelicias)a2raumpnt0aee mociltls uauvs;u0texoio iatoaDeai i;s0texm(o oy1al emfvsls)srumurpou1alt mieiatlsDemu s;t4tltoifctatlatr i olt0 etmxmpno4am emivils  Dur(ro;o4aee iocilsfmDrmump () lenxf3ootlaDeau olt)srur(r3ou1lpeemfvt ()a2uaxmoou1olxnmi3iyt mDumn s;()trenmf3tydom  aueo () rtrxmpnu1amtn nctas  rrau p;t0texomoeiatlsDelnmp;t4treomfciy1om rluvolt0texrxm oy1amte nvtlsf Durumoou0apeomf3iasfmDrmnvon()altrio oy1faDrlues t) 2tr(m iy1openmnesls  rtaxr nt0tpxnmfciyd m2ulu onu4 exnxo oo1op  livs ( seurimpiodlpenmfesa() rururpnu1ope mfcils s2uan p;t4texrir tytfmDe u o () rtm(m ny4ome lici ( a2tm(  no1altnmfeildlsDraums;u)trtomo3totlateluvols0s2um(mpny1lleemivtas  rurumonu1optnifeiltls2ulump u)aexrxr oo1lm e i s s teur(r oodomtemfct tfa2umxrpnt0aeen oetldla2umnvs;(4 eeomocoatopD ai o;( s2xrxmpoodlpeemivil( aDtru p;t1optomo3iatfsDelu s;(0trtrifciy1fm eau i;s0srtrxr3iy4lm n fvias arrau pnt1apeoifciltlm2rlump;t4 etnmfciatlmDrlieo;()setmir io1lpt livi sfaDtmx oou1tpt mi3tasfs2ean on(0tltoxf iodfmD lnes;t sruo(opnodamtemici s)srrmxmpot4optn i3iltfs ul(mo t)areoxf3iatoptr ies;t setoxrpnydop  mivsa() Dtm(rp;u0oexoifeiys s ulu p;t4 exnirctydfmtrauvsls0texrxopiydomtnliesa()srumxr ot1tptn feiad m2ulu onu0trtoircio1laD  i il()t2um(mpio4amtn fctltfaDrrxm ;u0ole ifeilt a um( p;u4trtoio iodlm eliesl() 2xrio3oy4ll n fes (  2rmurp;u0aex  o3iltfs emuvp;u4tetrxfcoytoaDeau ilt s2xrxo3nu1om elfeta( s2tmurpnt0alxoiociadfm2elnvo;(0altnmf3iotoaD  n il()trxm(o iu1ol  licil()a2tr(r ou0aee  ieiadfsDrl(vsn(0 lxrmo3oa1oaDe iei (0 rurio oodopee nvslt)s2uau  no1aeeo o3tltfa el( o;t) reomfcoytoaDe u s;t srtmxm3ou4amenmivia( arra( pou0ole  oeiydla elumpn(0arxoifciadlm r ivilt  rtrxm3io1omtnlieilt  2rau  ;u4oee  i3iad a ulnmp;t4aetrio tytfaD  ieslt) rtm(rpiydomtn feia()srrr(rono0oee ioeiltfm umuvon(0tltrxr oadlpDraies s)trum(m3ou4llt lneslsfsrum(m no0oeen feiyd sDeauvsn(4trtomrciotoa e uvol(0t2to(o3iodlle miei t)sDrru  ou0oleo i3tld m ulums;u4tltnircoatfpD  i sls)tetoxopiodal nlnet s)s2tm(root1apxoiietasfmDrm( snt0treoxr oatla rlnvs s  2to(r3nodam nlicsat sDtmuroou0tptomo3iydlmDra(mpnu0 ltomocootlm elu o;t)texoxm oo4aptnlicias sDrmxmpno4aexn ictatlmDraumo t)trermo3tytoaDeai s t0teuo(m iudal elfvi s)sDua(rpot0oleoif3iadfs2el(vp u0arxrmo3tytfat luvs;() rumxo3no1al  lfcsltf rumxm ot0aetomfeiyt m uluvpn()teerxr3iodfp e uvilt0t2trxm3io1am  lnetltfs2rr(m nu4ale ifetas mDuanms;u0 eenmfciodfm rlivs;s) euoirpiodomenlietls srurxr ;u4aexoii3taslm um(mo t4aetnmo oydoaD lnes;s) rtm(r oodaptn iciltfaDrmur ou0tpxo oeiyslsDelu sn() etrxrctodomtrauvils t2umxm3iu4oleemivtlt  rrau  no1tpt mf3iyt sDumnvsnu4 lenxr3oadfm rlneo;t  2ur(r3oy1lmenmicia( aDrmumono0apenii3ildfs rmnms t4areoircootlaDraivs;t)texoimpoudlm  liesas  Dua(roou0ope mietltla elu p t)tltrxf3iytoa eai sls)sruo(opiu1lptnlncsa(fartrum ot0tee  fciatlmDulumont4alenxfcoytfmteluvi s t2xo(rpny4ap emncs () rum( pnt1apx  ociytla2em(ms u4 rtrifcoatfat livi s0sexmir nudome mivta() rrrxmonu0alx mf3tldla2rl(monu)texnifcoatfpt aivols) rxrxr nydomt licsas)sDuru o;u4ape  ieilt a eanvp () rtoir tytfa eliei;t0seuoimpio1apee nvslt aDumumoou4apto oetlsfm ulu s u4alxnxr ty1latrliei;s)s2trio3nydopeelfvtl( srumxrpou0oet mieildfsDrluvp;t) rtnxrctatop e ivilt t2tm(o iydop  lfetl( s2ra( poo4olt mfeias mDemn pnt)texnxf3to1faDrli ol(0 rxoxo io4ol n netatfsDumu ooo0olt if3iatlsDua(ms;(4 ltnmf3to1laDe nvo s0srur(m3ny1amee fcsa(  Draumooo0apt ioctydfa uau p;(0tetnio oodfp e nvolt0 exrxr iudapenlncta( a2tmum no0opeomoetydlsDul(vo;t)aetnio3iatoa   nei (  ruo(m ny1oltemivil(  rta(ronu4alenmfeiasfsDumumon(4arxnxo oadla rliei s)s2xo(o oo4am  mictl()sDtrxroot4oexnmfciasfs rmn o t4tetoircoydom  anvsl(0s2xo(opiu1ol nlicsas artr(  ;u0apxo fctad m emu o;(0trtrmf iytfpD  u ols0 etmim3ou4amtemici tfs2tau pno4openiicilsls2ulumsn() leoxo oodfp   ueo;s0 eum(opio1apenlfci t)aDrr(mooo0alxniictltfs rlums t)arxnxr3oydlpDr ieilt  2uoio iudalt mnvt () 2tr( pot4apenmietys s2uluvp u4arerxr3oatfa eaivi () 2uriopiydaptnmfct t)aDuauro;o1tltoii3iys mDeanmont0 renxocty1fmt  i slt0 exrxo no1ll  lfei t)s2rrumoot4apxomfciyd a2ran ont)aeeriocio1fm  auei ( s2xoimpio1olt lictltfsrur(  nt1teeniieiat m rm( sn(4trxrifcia1faDrli ilt trtoxr iudomte nvtl(  2ur(  nu1teeoii3ildfmDuanmp (4 renmo3tadopt  nvol( sruoxo iy4aptemietl(f Dtaxmono1aex  i3tatfm umu on(0 etnircia1opD  uei ( t2urxopoydope  nct (fartrumpou0tltn fciadfmDemnvs u0tetnxrcoydoaDelnvol(0trxrxopiu1op nmfcs t  2uax  ;u4altniictadla2umnvsnu0tetoio ty1fmD aues () 2umim oy1lm emivsa(f rrm(m ;u4oltn iciadfa eluvs;(0trenio3oy1om rluvi;s tetoir3nu4lpe  fvils)a2uaurpou1oetomf3iyd m um( o (0 lerio ia1omt  ueslt sexr(m3oydaleelics sfa2uau p;u1olxoioctldlm2ea(mont)alenxr3todomDeluei;t  exr(r ny4ol emncsl( srurxm no1tpxn i3iydfaDrluvp;u0 rtnmr tytom eaueilt0trumiopio1lmtelfvils aDua(r no1olen i3iltfm rau on(0trxrif oatla r nvo s truoio3no1olt mncta(  2uau oot1tpx moeiyt s2rlu snt4areoxrcoytfmtrli s ( tetoio iydamtnmiciat  rraxrp;o4oex mieiad m2rln p;u)tetrxfciatfm e u sl( t2tr(r nydll   icta() rrrxrpnu4tet  ocildfs2em(msnu)texrifcta1lp rliei t0 2xo(o ny4omen fvslt  rtauronu1aexomf3tld s ea(mpnt) etoxo3oatfa rau i t t2toio3oo4lpee ictas a2raxmpno0tpx mi3ilsfa raumo;(4 rtoxf3oydomtr neo;t trtrxr3oy1alt mnci sfa2ur(m ;u1apt moctydlmDemnms (0aeerxr3iodoaDelnvo t)trumio iu1amenmfesl( aDrrumono1olxo oeiydla ul(msnt)tlenxfciy1om   n s;t0srtoim3nydale lnvtatfa2tmxront0opt mf3iys m uan o u4aexrxf3oytfaDelu s;(0 ruoxopnydolt livtat)aDrm(mo;u1tpx  fctas s em(ms ()tetoio3oa1fa   ueo;(0t2xoio nudlltnmnct (  2tmxr no0tlenmietaslmDumump;t0altnxfcoatfateaivi s0t2umxmpoy1lmtn fvtas)srtru pnu1ope  ietadfa2eau p (4 leomo ty1opDr nes t  etoxopny4ameelfeia( s2ta(mo;u1oeeomiciydfaDrm(ms;u0trtnxociadfaDr nvslt0srxm(mpoy1lme  ncsat s2ra( pou0alxnifciydfa uanmp;t) lenxr oadoatraneils) rtoxo ny4ol n iciatfs2umx pot4optoif3ilt s eanmonu4aleomf oatlp elneslt  2toxm3iydolen fcsasf 2tm(  ;o1aeeomi3tytfa2ea(ms;t4 rxrxrctotoaDrli o s)s2umxo nudap nlietlsfartr( o;o4teeo ociatls elnmonu0 etrxocoytom  auvil(  exrxr ny4lme mfcils)sDta( ooo1tex  iciadfs umu o;u0altnmrctotlaDranvols) 2xmxopiy4lp  lieias  rurxrp;t4opxoif3iyd mDum( s;(0 eerxrcoydlpDr ues t) exmio3nu1lm  lieiatfartm(rooo0texoiictltlaDranvpn(4 lermr oydfmt lu ilt)t2xo(o3io1ap elnciltfsruax p;t1opeoioeiltls uauvpn(0aeenxo ty1opDe u s t0srxmir iy1op emivsas)srtmx onu4tpenmfciat a ulnmp;u) ltrmoctydfmt an i;t teurim iydamee ivs (  2um( ooo4aetn i3ildls2uan o u)texoxr oatomte ivsl() 2urxopoo1ll elfct (fsrum(mo;o1tltnioctld a uln s;u0aetrio3oytla rlnvils0sruoxo ou4optnlieslt)s2tmx pno1altomf3tadlaDem( s;t4 leriocto1fm eluvo;(0s2xmir ou1alt lfcs s srtm( poo4aee ioetls m ra(ms (4tltnmr3iodoaDr nvol(0t2xoirpno1ope lnviatfs2rrx oot1apeo i3ildlm rau o;u0 exrmo iytfmD auei;s t2xm(o3oodopenmfesas  Durxmoou4alx ifeiydlmDrlump;u4 lxrxf io1opteau o t0trurim nu1opeelivi s  Dra(rp;o0tlxnmfciydlm2ea( pnt) lxoifctytfmD lneo;t)s2xrir3ny1lm n icsltfa2ur(rono1texoifetytfmDrmnvs;t4tetrxf iatfptr nes s)srxo(m3iu1lpe  ictlsfs2rrx onu4tleo ocildfm2ea( p;t0 etrmfcty1lmte uesl(  2um(m nodalt mfetatfsrtr( pot4tpe  ictad sDrl(vp u4 etoio iytlpD aivi;t  rxr(mpoo1lp nmnvia( a2ta(rono1oeeomfetltfs ranmp;t0 lxoiociodfp r uvo t) exmxm oodamtn ncs () Dtrx ooo1alxoio3iyt aDuauvp u)trxoxr iytfpt  ivil(0trxmxr3iu4ol  lfcs tf rua(rp;u4ole  oetysfs rl(vo u)aetnmr ty1oa rauvi s t2xrir3iodapeemfviat)sDraxronu1aeeo feiatfa um(vp;()teermo3oa1fpDrlies (  2toiopnudlmeelictas)s2umu pnu0apenifeiadla2ra(mp ()altomfcty1lp e nei (  euoxm3oo4omen fesasfsDrrx oou1tex mieias sDelnvo;(4artnifcoatlp elieo;t)srtmim3oy1altn nvtat)sDrrxrpnt4aexoiieiltfs2uln o;(4teerxr3oo1lat  ivilt0srxmxr nydameemncsa(fa2urxrpnt1alenif3tytfmDem(ms (4 rtrir todfate u i s setmim3oodlmt  nvias  2tmxmpno4opeo oeiadfa emuvp u)treoir3iytom eluvs (0texrim3oudom elnet (f Dumx  no0tetn f3tld s emnmsn(4tetnmf ty1fp eaivo;( srtr(o ny4lp  licta()arrrumpot0apxnio3iasfm ul(msnu0texnxf io1omtr ivol(0srxoir no4am e fesa( srtr(rpnt0ale mfctatfm eaumont)trtnirctodoa rluesl(0sexrxm nydlpee ncsa(  rta( poo0opxnmi3tlsfsDranmp (0trtoif oa1omt aneo;s setrio3ou1opt  neiltfa2umxroou1aleomi3iadfm2rlnvonu4 exoirciytla   ivi t0seum(m oo1omenmnesat)s2tru onu4alxn icilsfm ea( pnu0 lenir3todfpDeanvo;s truo(r3ny1lltn feil(faDurxronu1tex io3ils m ranvp (0texnmo3iadlat  nvs;s t2tmxmpio1lmen fcs (faDuax p;t4alxo ieilsfs rm( o;t) lxrmo iotoaDrlnvi;s)trtmxrpoudlptemfeiltfarur(m ;o1tleomfetaslmDea( sn(4 etoxo totfm  li olt  2xrxm3oydome mfctasfarum(m ou0tee miciadlsDeanmont) lxrxrcoytlp eluvols s2toio3nydlltnlnctat) Dur(moot0optomo3iyt s umnvsnt4tlxomr oy1lp eanvils)sexmxo io4omtn iesl(fa2trx ont0tex  fetadls elnvo;t0 renxr ia1fm r uvs t t2xoir iodlleeliei sfaDta(r ou4optnmoetytlmDem(vp u)tlxrxocoodfp r ivo t)s2xmim3nodap elfet ( aDtaum ot4olto ociys m2emnvo;(0 etomf3tydlp raivi t) 2xrxr oo4amte netls) 2rmx  oo4oltomieiytlm2um(ms;t)aetrif3oodlm elnvi s) 2ur(o3iudoleemicta(fs2taumonu4openmi3iatlm2ulnmp;t4trxrxfciydopDraivo;s  etr(r oo4op elnvt ()sDta(ro;u1oleoifeiadfm2rmnmsnt0tltoio tydfat  n il() rurir ou1olenlfetas aDurur nt1tle  fctatls uln s;(4trxnxocia1lpDeluvs s t2umxo oudlpt mfvi ()a2rr(moou4aexnifeiltlaDeanvp;u)tltrxf3totfmt  n o;t) eurxr iy4lme lnviasfarurxro;o4alen ictatfm2umums;(0altrxrctydlaD  u o;()teuoirpiodomt mnvsl(  Duaur no0oltoif3tasfaDranmo;u0tltrxf oodomDe ueslt)s2xo(r3io4lpenmivs s) 2ra(rooo1aleo ietldlmDranvs t)tltoxociodlmtrauvil(  rxm(m3ny1om e fvi (fsrtrur ou1ape iietasls emn s;u)trerxo3oo1oat lieolt  2tr(rpny4op elictl(fa2tax p;o1oexo i3tytfs uluvpnt) etnir3tydfp  lnvsls0 eumxo iydlp emnvsat arurx ooo4oltnmfeiys mDelu o;t)tlxrmrciytfateaieslt) 2xrxr3nu4lptelfvs ( s2ta( oot1alt  fcilsfsDrl(vs;t) etrirctatfmt lueilt  2uriopny4oltemfcsl(f rum(  oo0aeto f3iyd sDrmu snt4treoxfcoa1lmtr u i t srxoxmpno1al nmfcilsfsrrr(mont1apx  o3ias s2rlumo;u)artrmf3ty1omteaneo s srto(m3ny1ol   fet (faDtmum ;t4alx mo3iytfs2ea(vsnu4 lerxo ootla ran sl( t2uoim3nodlp e fvsltfs2umu  ;t1tlen iciltfmDrau pn() ltomo3ootomtr neslt t2tm(o3ny4lleelfesl()aDtmx  no4tlenmicias a2ul(vp t)aeeniocoadfatrlu sl(0texmxr3io1ll elfvt t  Dua( poo1aexn f3tysfa2el(vp t4treoxr iadlpD  uvils) etoxo nydap emneslt s2urxmono0tpt  ieildla2em(vo t4 reomfcoydopt auvilt)t2urxo3oy4al emfet tfa2ta(rpno0oet  o3tadfmDeln s t0tetrxr3tytlpDelieol(0s2tr(mpno4op  lfvtl( sDra(ro;u0aeeo o3iltfaDelnmpnu4 rtrif ootfa e ivi;s)t2to(m3ou4op   iciasf rurxmpno4teenmiciytla2uanvp;t0 lerif3oytlatranvsls s2uoxr oy4ale mfctat sruau pou0olx  i3ils a rlnvp u0 rxoxo3tytoat  neo;s)setrio iudlp   ivi ( a2ra(rp;o4tpeomieiydfs ea(vsnt4 eeriociydoaDe nvils s2umxm nydap n ici tf Drm(r nu0opt  iciasfa2ea(vp t)tlxrmo todlp rluei;t) rxr(mpou1al elietltfa2ua(rpou4tpt moetydfm2ea(ms;t)texniocta1lmDeluvs;t0truoxo3ny4lm  mnvia( sDtaumpoo0alxn fciydfs2raums;t0tltrifcto1oa rlu s t) 2xmxo3nodllte fet ()aDtmumpnt1opxn ieilsfs2elnvsnu4aetnioctatfp  li s;(  euoimpio4ap e ivi tfartm(mono4opxo f3tls m eanvon(0aeenif3tydfaDean i;() eumxr3iu1oltnmivs t a2rmum ;u0tpxo fciysfaDelnvo;(4areoxfcta1lp rlneo s srtmirpnu4opt mictlt aDtaxmp;t0apxo ictatlaDrmuvp;(4aexoiocoodoatelivo;( sexoir iudamte icilt  Durumooo0tpx  oetatfs eanvo (4altnxo3iytlaD an o ( s2umio3ou4om n ietl(f rrm(r ;o1oet mo3tat mDrlu s u)arxoxf to1fp r nesl(0t2xm(m3iu4lpenlics sfs2rm(m nt1tetoifetas m ua(mp;t0alenir3todop r ivs (  2xrirpnu4am nmfetl( aDrrurpnt0tltn octltfmDul(vp;(4aetnmr3iydlmtrau il(  eum(opno1altn fcsas)artr(mono0tpxnio3tld mDrmuvs;u0aexoxf3ootfptrlu o ( sexrxo oy1amt mfvias srua( o;u1aptniieildfa2rluvs;u4 ltoxo3io1opt ln i t tetr(o3iodom nmnct t  2tmxro;o1oetnif3iadlaDea(monu) etnmf3ta1oatrlneslt0s2xr(m oo4am  livs (fa2trx pnu0opt mi3iyslaDrmnvont0tlxoxocta1lmtrluesl( t2trio3nu1lmtnmivsas)sDrrxm ;t1opxo oeiatlsDuauvp (4 rxnifciy1omteaies;( tetoxm ou4ameemicil()s2trumpno1oetomicild a ra( o t) etoxo iydfatrlnei ()srxo(r oodape lneta( s2taump;t0texnioeiadla uaumsn()tlerxo3oa1fa eanvo () 2tm(mpio1ole mfvs s sDumx oou0tpx iictydlm eauvo;u4trxomr3oytlpt  uvi;t0seumio3oy1lpeemfciat srrax pnt0ole moeias mDra(ms;(4trerif iadlp   n o s0truo(o io4op emncsls  Dum( pot1tleomietldlm rm(ms t4teeoio3todlmDraueols)teum(m iodlpe  fci () 2ra(  ;u1opt if3ilt a ra( s;t4arenif tadomD au ilt srurxm nydlp elivs tfa2tr(m ou0aptomociadfs emuvont4 reoif oa1faDraneslt)trxrir iudopen ies ()srur(roou4oexnmo3iytls2um(vo (0 ltniociadfat aieilt)setmir3oydop nmivtltf rra( pot1olxoii3tlsls2elumo u0trxrxr oadlp rlu o t0srxrim3oy1lpenlfcs ( s2umxmpno1olxn o3tytfs2rmnmp u)trtnmociytoaD lueo s srum(mpoo4am n neslt)arrm( pnu4tpen ocilsls2rmuvp;u) etrmo iy1oat  nei t0s2tmim oudlmte fviat  rumxrp;t4tpt ioetyd m ranvp u4arxnif oytfpt aieilt  etr(opnu1lltemneiat)sDrrx pnu1opto i3iytfa2eaump;(4altrxr iytlp rlies;() 2uo(opno4olenlncs (  ruaumpnu1oetnmfcils m uan snt0aetrif3iadomtrlivi (0sexoxr nodalt  nviltf Dtmum ;o1opx ifcilslaDumn s;u0 lxnxf oytomt ln ol(0t2xoxr iu4aptelictlsfs2taxmpnt1opeoioeiadlm2rl( s t)artoxfcia1fmteau slt0 2uoir3iy1ll  mfvsat)sDuru p;u0ole ioetat s2uaumo;u4aleomocta1lp rau ilt)teum(mpny1oleemnvsltfsDrrxr no4tlen fetytlm2rl( p;t)tlxrmf3todoatelueol()s2xrxr io4om nlivsas)aDra(rono0ope  iciltls emnvpnu0trtnio3ty1omDelu s;t0trtoxm iy4lpt lnci ()sDtrumooo4aeto oeiydfsDra(vs t)aleoif tatlatraneo t trurxr3iy1ap nmnes t s2rr(r ;t1ale  oetysls2umuvonu)trenmr iatlmD  nvi t)sexoxr oy4olte nes (faDrm(mono4olxnmoeilt m rln onu)aeerxo3todlp eliesl()s2tmxopnydaleelfviatfarrmxmp;o1tpto oetys s2rmuvo u) rermr3ia1omDeaivo;s texrxm no4olt lncs s a2urx poo1apt ifetyd a2ua(ms;u)altrxrcoy1lpteaneo;(0sexo(m nu4apte ieil()aDtruronu1tlx iiciadfa umuvsn()tlxrxr3iadlm  anvil() rxmio3iy1am n ivs ()sDuax ono0tlx mfciatlsDeaumsn()aetrio3tytlmtr uvs;(0t2trxmpoydllt lics t) rta(rpnu4olto i3ildfa2uaumo t4 lenxrciotlp rlu s t)texmxo nudlmte fvsls)a2tr(mpnu1tleo ociltlaDemumpnt4artomf iadfmDrauvsls t2trir no4lltemfeslt sDta(  ;t0opxomieiytfaDea(vpn()teermf3oadlmDeauvs;(0trtoimpou4lmt liesl( s2rrumo;o4alxomo3ils s eanvonu0 exnxr to1lm rlu s;t0sexr(opny4alt mict sfarta(mo;o4tltnmo3iytlsDul(vs;u4tltoxr3iatfpte ivs;s t2xmxmpnu1ape  fvsa(  2truro;u0oeeo fciat m2uln snu0arxrmrcoytomtr nvi s)t2tmxo3iu4oltnlncia(fsrtmu  ;u4oet  i3iatfmDra(ms u0 exrio3iodoa rai i s0s2trxm oo1ole lfvt sf 2umxmono1apx mi3tas aDrluvs;t4arxoxo todlpte ueslt teuoxo3ou4lmenmnet s arumu onu1oltn o3iyt a2rauvo t4 exrxo3tydom rli s ( texoxopoudalen ivtl(faDtax onu1texn oeiltlmDrlnmonu0 rxnxf3iydla  lnvol( teum(r nydlmeemfci tf rrmu pno4ale moeiytla ranvon()trxrifcoo1fpD  ies s  rxm(rpiu1ll e iei s) rurxm ;u0oet ioeiyt m2umu s;() rxnxf ia1opteai ils srxo(o iy1amt mfet (farrr( pnu1ole  fcildla eau s ()artnifciotlm elu i;t  euoirpiu4om nmicsat)sDum(m oo4apx mi3iatfa eanmsn(4teenir3oodom   ivo t0trxrimpnu4llt mfes s  rrrxrp;t1oee mfcilsfaDumumpn(0trxoxo io1om   neo;(  exoxm3nydlptnmfesl() rrrx pno4aee mfciydlm2ranmp t4alenxf ty1opt lnvolt0s2xoxm iy1amtelici s s2rrx  ;u1aleoioeilslm2eln s;t) exomr3tadfmDranes;()seuo(rpio4olte ictasfsDuaump;o1opxnmictatfmDumuvo u)altnir3tatomD  ieo;s0setoio3nodlm nmneias a2uaurpnt4aeenmf3ils sDrauvs;()aeerio todopt lu o;t0trurxm3oo1lpe mnesasfaDumu p;t4aee  icildfm uluvs u0aeerxf iydlpte nvilt seto(opiy1lmt  ictlt)a2tmxmp;u0ole ii3iytlaDran p t0 rxrmrctatfat  ivs;t)setrxo3oo1opee fcsa(f 2taurpno4aexoif3ias s2ea(vo (0tltnxo3oytla   nvsls) 2xm(o3oudopte fviat a2trxmp;o4aetnmf3tatla2rau o;u)trxnmf totfp   n s;s tetriopoo4apen icilt  2rau  ;o1tee mfciasfm2elumsn()trerirciotla  aieo;t)srtm(m io1llt mivslt)s2rm(ro;o1aptn ietyd a elums;t0alenifciotomt luvi;()srxriopoudoltn fvsl(  ruaxrono1oetomf3tat m2el(mo;t4aeerio3to1fatranvs;s sexmxm3ny1olte ivtat) Drrurono1alxn fetlsfaDrlu p;u0 rxrifctydfmt  nvslt  exrxrpoydllt lfvtls a2rmxront1aetnmicilsls rl(vsnt4treriocoo1la   ieilt  2umxm iu1ll e nes ()a2urum ;o0tpt  ociydfs uanmpnt0alxomo3oa1fatrlivols0s2urir3oy1ame lncils) 2tr(r ou1ope mfeiatfaDeau s t0 rerxrcoy1laDe ues s0 exrxopiu1op elncsat aDtrxmo;o1alxo ieilslm uln onu)tetnif tatfmD  u o;(  eum(mpoy4op  lfcsas arrru pot4opx mietytfmDuauvs t)tltrxfciodopDean s;s)srumxo3nydalen nei s  Durx pou0texn fetad mDranvp t0tlenif3iadfa r u s t) eur(o nu1lmt  ncil()sDtm(roou1tex ifctytls um( p;u) ltrmo io1lpD lnvi ( srxr(rpoy1lm emiesl(fsDtr(mpnt0oexn o3ildlaDeanmo;u4aleoiocoadfmDr neo t0s2toio3ou1lme  iciatf Drau p;t0aex iiciad a2em(vs;(4tetoxo iodfp   nvol(0srxo(m oudapt mivtl(fa2raur nu1tetnio3ils m ean on(0tltoxociatlmD  ieo;s)setmxo iu1lp e fctlsfarraxmooo0olxo oeils m raump t0arenxo iotfptr n o s  eurio no4lpt  ies s)aDumuro;o0oee iietadfs ea(vp;()aexrxf iy1om rlivs s t2toxmpoudole  fcsas)artau pno1tlt  oeiyt s umumpnt) lerio3todlaDeanei;t sexo(r3nu4omt  ivsa(fsrta(ro;t0oexnmociyt s2uanmo;t4arxnxf oytoatrlues ( s2um(o3oo1omen nvtl()srumumpot0aexomi3iltfa ul( s;(0 rerxf iydlptrlu i;s)srxoir3
\ No newline at end of file
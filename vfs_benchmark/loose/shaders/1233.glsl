@@ -0,0 +1 @@
+ueo;t) etmxrpio4op nmnvilt)srur(ronu4tlt mo3tasfsDrmu s t4aetomfctotfmt luvs t  2uoxm3no1al n ivsl(fsrtru pnu1altn fetyd m em(ms;t0aetnio oydlaDe i i;s t2toxo nu1opee icias)s2trur ;t1tpxnioeiaslmDeauvsnu)tetoxf iydopDe u s;t trxrxr3oo4lltelictlt)sDtmx poo0aptn ieiad a emnmpnt4 etnxr3iy1lptr i il() eum(r3iudlleelictls s2tr(r ;t1tet ifeiysla rln p;t)aetrxo3ty1oa  anei;(  exoxr3oy4llenmiei t)sDtmxrpoo1tpx ioctydlmDrl(mpnt)tleoir iodfatr ueols)trtoiopoudoptemnvtl( s2rmx o;u1opx mieiytfaDra(mp;t4 etrxf3oydlatr uei s)s2xrir3io1llee fvi t) 2ua( p;o0tpen f3iltfm rmumo t) eenxo3tytfa elneilt  2tmir3io4apt  ivs ( sDrau  oo1aleo oetltfa2uanvpn(0areoxo io1om eai sl(0texr(mpoy4al   nes ( srtrum nt4aptniociyslaDumn s t) leomrcoa1lmt  n o;s trtrim io1llte fetl(f rrmxrpnu4olxoio3ilslm umump;(0tetnmo3iotomDrli i ( trumxr ou1openlnvsat)sDrrumpou4tee  i3ilsfs2ul(vs;(0tltnxr3oy1lp  lu o;( t2ur(m oo1ale mivsasf 2rrxrono0oltn f3iytfmDrlnvo (0alxrmfcoy1fpD  uvs t0 etr(rpoy1ole  fesltfsrua(r ot1aex  feiyd a2ul( on() etnmrcoo1omtrlnvils) rtrxrpiodom e iciat arumu pnu0aptnio3ild a rmuvpnu) rxomfctatla eaivol(0seur(mpou4opte fvi s)aDur(r oo0alx iieiytla emumo;u0 renmo ia1fm eluvilt0 2toxm iu4lpeelfcilt) rrrum ;u4aeen f3tyslsDua(vp t0arxnio3tadlmDr uvs;t0 2toio3io1ape  nesa()aDtmxroou1oetn i3ilsfs2eau ont)tlxnxrciydopDeau ol(0tetoio3nu4altnlnvt tfsrurum oo0apeniociatfsDraums;t) exrxo3oa1omtrlivi;t t2uoimpoydalee fei s  Dtr(mpnu0teto f3iyt a el( pnu0aexoxf ootlpDelues;s0s2tr(rpiodalen fct (f Drr(ro;o0ale  f3ilslsDrmu p;u) ltrif3oadlpDrlneslt0 rtoio oodlptnlfctl() rtm( onu0apeniietldla um( pn() ltriocoy1om raiei;t0sruoxr3no1optnlnci sf rtrump;t4aptnmfctydls2uan p u)arenxr3oo1fat li i;s seurxo3oy4altn ieias)aDrrxr no1teenmiciydlsDrau o u4teermrciytoptelieo;(  2to(o3ny1omt mnetls arraur no4tpxnifciyd m2elnvp;t0tltnxr ia1opDr nvi;s)s2uoxrpou4lptnmicia(f 2uau pou4tlt mfeiysla2rl( p;u0texoxo3iy1omDeaueo t srtmim iudaptn ivtas) rrr(  ;t0tltomfcild a rm(msnt4trtoir3iytlmtranvs;s) rtoimpoy1altnlnct (f rurumoot0opxomi3iltla rlnvo u) lxoif3iadfp rai o;(0 2toir3io4op  lfvsl(f rumu pot0tpen ociasfaDea(mon() ltnioctadoaDrlieo (0 ruoxm iodlme  iesl() rtauroot4oex ifeiys m ul( snu)aetoxf3oa1fm eaivi;t0 2umxr ny1lle  ncilt  Drax  oo4tlxoifcildlm2rmu s (4 ltnmo ia1lmt  u i t trtr(r nudoptnmncsat)sDrmump;o1oet ifciatfa2uanvs;(4 lermf oatfmDeli olt) rtrxr3iy1omenmnvil() Dtaump;u0alxnifciaslm2ea(mp;t4arxrxoctodlptrlivi s0 rurxmpiudom  lfvi sfs2ururoot1tex  iciad sDeanvp u4 ltrifcoatoa  aneo;t srumio3iy4al emneia(faDrruro;t0oet  oetatfmDea( o t4tetnmrcoatomt ai o t0 ruoiopoudal  mneiatfaDuaxrooo4opx mi3tlt s ulnmp;t4 lxnxfctatlpD aueo (0t2um(m no4ap  mfvilsf 2rrxr nt0aptoifetls s rl(vp;u0arxoxr3iy1fpDr ueo;t srxr(m3no1lptnlicsa() 2urum ;t0optn fctas s2uau o;()tlxnir oatomDrau olt)s2xmirpny1amenmneslsfs2umump;u0oexn ocild m2emn s (4tleoxocty1fmt lneil( texm(mpoydlm nmncsasf Dumurp;o0tleo icildfa2rlnmo;t) rxrif ootlaDr n o (0s2urxm nydalt mivsa()arumu pno0tpxn oetadlsDuanvon(4 eeomr3iytlaDe i ols0srur(rpiy4om   fvs s artmu ont1tpt ii3iydfa rmumsnt)alxoxrctydlm rau i;t)s2trxopio1amenmivi s)a2ta(r nu1alxnmo3iytfsDra(mo t) rtrmr3ty1laDrluvils)seur(rpio4lp n nes (f rtrumono1oexn f3tad m ean snu)tetrxo3ia1lm  auei;(0s2tr(mpiy1lptemfeilt)aDuaxrpnt1opeomf3ild aDrl(vsnt4 rtrir3totop rluesl(  rxo(o3nydam   iciasfs2trxmpnt1olt ii3ildfs2uaump u0tlxnmo3tatfatelu ilt) exoxmpiudom nlfvtls sruru  nt1apeomocild a2raumsnt)trxomf3oa1oat an o s trxoxopoo4lptnlieilt)a2tr(  ;t4tee  feiyt sDumnvon(0trerxo3io1lm  aivo;t teuoxm3nodoltnmivtas) rurx oot1aet ioeild mDrlu s;(0aetrxf ia1opteln olt0 rur(o nu4am elnvilt) 2umumpou4apxo i3ilslm2ea(vs t4 etnif tadoa elnvslt) rtmxo3oudaltnmnvtlsfs2ra(  oo1tle mieiad m2rm(mpnt)aexnircoydfaDeluvolt  ruoxm3io1opt  ivs t)a2ra(rono1ole mfeildfs umnvo u)arxrir tadomte nes;s) rxo(r oodol nlivtatfsDraxmp;t4tlenif3iltlm2ea(vo (0trxoxr iotfmte nes;()s2uo(r3io4lltnmfvil()aDra(r ;u1alenmociadlm rl(vp t4 lxrmf iytlaD liei;s) 2xrirpiy1am elictatfsrum(mooo0aeen o3tysfm elnvpn(4alxnxr iytlpDrlnes s0texoio ou1ol  liesltf 2uaxmp;u4tltn oeilslm2ua(vsnt4 ltomf oo1la rlueo t texoio iu4am nmnetl(fsDua(rooo0tltnmociydfmDrluvo u)aeenmf3iytlptr n s;t0trtr(o3nu1ameelietasf Dur(r oo1oeeoif3ilsfm uluvp;u4 ltnxf oatlaD an sls)trtoxo io4aptelfvi t sDuru ooo0oexn octlslsDulu s;(0tetomr3iodlpt  uei;t) 2urxrpnudlp nlicsltfa2ta( oot4opx  fciysfm eluvp;(4 lenioctatoat ai o ()srtrxr3ny1omeemneta()srtaxr ;t1ape mo3iytfaDrmuvonu4 rtrir iydomDr neo;(0trxoxm oy4lm nlfcslt a2umumpot1oltnmfctydls2ua(ms u)aexnmfcoa1fmDe i s s)sexmir3iu1omt mnetat srrmx ooo1tlt miciatlm rlnvp;t0 lerif3totfp r ueil( srtoio3iu4lle  feil(f Drru pot1tpt  ieildfa em(mp u0aeeoirctatfa  lu s;s)srurxrpoy4omt lfvsa()sDra(m ;t0olxomieiyt aDemuvont) leoircoo1om  luvol(0 rtoim oy1amen ieias  Drr(roou1openii3iytfs rl(vonu)aetnirciotlaD  ivs;(0t2umxo3ou4ol  lnvtls)srta(ront4olxo i3iadfmDrm( o;(4treoxocoatfm r nvi;t0 2um(o oo1omenmieil()sDrau  ;o1aetnmictysfs el( onu4 rxrirctotfa  lnvi t srxm(m oy1op   fvi s)arua(mpou0tlxo o3iytla eln pnu0 ltoxrciadfp  li i;t)srxmimpiy1apee ici sfsruauro;t4apt iiciyt a2umnmp;t) eerxfciytlmt ln s;s0 rtmxr3nu1lpe mict () Dtrxronu1apxo oeildlm um(monu4aexoxo iodfm e nvil(0 rurxr3io4ome  fcsa(f 2tm(mono0tpeomfciltfs rlumo u)treomfcootlmteluei;( trxr(opno1lmt livsas)arrmxm ou4ope ifeiydfa ulnms;u4alermo ia1fp eli i;s  exmxm3nudome  fvta( aDrruro;o4oexo fctldls rmn p;u0 etnif oytlaD aivs;s0seurxo oo1omtnlietat srua(mpnu1ale moetlsfm uln on() etnxf3to1lm elnvi;s  2toim nu1lpe  fes (f Drmxmoou1teeo fetatls2um( o (0artnifcoa1fatrlu ilt) exoimpio4altn net t a2tmxrp;o0tee mictydls elu on(0texnif3iy1op elu ils) ruoxmpiu1altnlnei (  2rrxm oo4texoiietatfm2umnvon()tltriocoadoa e iei;(0 2xmxrpnu4alee icsa() 2tr(mp;t0tpxniietatfa rmnvo;u0aetomf3oo1fmD  n i ( t2to(rpiu1apeelnet (fs2taxr nt4aet  ocilt sDemu pnt0texnif3tadla rluvo t)sexoxrpiu4olt micia() rumumo;t1tlen i3iyslm2uluvo u4teenxr3ootla e uesl( trto(o iu1apenlfvi sfaDtmu pnt4tlxnii3iyd a rlu p;u) lxoif3ootopDr u ilt0trumim3oodlmenmfcils)arumu o;o0oexn feias s2rauvo;(0alenxocootlmtrlnei;t)t2ur(r3nudopeemneia() Durxm ou0tetnio3iltfmDrauvsnu4 rtoif oodlpteaivi;s  rxmim3ou1om nmivia()aDrax pot0tpxnmoctaslm rlumsnt4trtoxr iatfmD  i ilt0s2urxo oudll elietl(  Dtrxmpnu1tpeomictls mDem( p;t4 renxf ia1omtraiei s) rumimpiy4optemnci s)s2ta( p;o1alx  o3tyt a2rm( onu) lxrxo3oodfaDeli i;t) 2xr(mpnodlmee fcsasfsrtru  nt0aetnii3iytla2elnmo (4altnif3tadfmte neols  exo(r oo4ll nlicsatfa2rm(rono4aex miciys aDel(mp;(4tleoifcoo1lmt ln s t0 rxmiopiy1lmte nvi t)aDtmu pnt1oleomieiytla2ua(vonu) etnir iodomt  neil(0 rxoxr3nu1lpt  ieta() 2tax  ot0oetnmf3ild m rlu p;t0trermfcootlmD li ilt0t2tr(r3nodole lnvi t  2ra(  ;o1tetoio3ilt aDua(vs;u0arenir iatomD  nei s0tetr(rpoydlltnmivia( sDtrxroou1aetomf3ils a2rmu on(0 leriocta1lp rlneo;s0trurimpoudomt mnesl( a2ta(monu4tpx mfctytfmDeanvo (4alxrxr3ty1opDrai sls0 exmirpoo1al emfvtltf 2ururpnu4tee moetlt a umu o t)tltoxrctodlmDelnes;t0s2urxo nydap  mietlt  rur( p;t0alen o3tld a raumo;(0 renxfcty1la e ueo (0srtrir io1am elncs t)aDrrx poo4alx  ieiysfm elums t4tlxriocoodfp eaies s) rtmiopiy4omenliesa()s2tr( o;u0tlxomoeilslmDemuvo;(0altnmrcootomtrai ol()setrxm3iodlme  ncsas) 2ta(rp;o0opxo i3iysla2uau o;t0treomocia1lptranvi;() eur(m oudome liesas)srtruro;u0oetoifeiytls rlnvsnu0 lxomf oa1op r u s s)seur(m nodape lnesa(fa2tau pot1aleomf3iltfa ulump;u0trtomr3to1lmDrlneo (0 euoio no1altelfvsls  rraxrono1oltomi3tlslsDraums;u0alerxo3ootlmte iei s0 rxm(m iodaltelivtasf Dtrxmp;o4aptomiciydfm2ranmsnt) etomo oatlpD anvo;() rxmiopiy1lptnliesa(f rtmu  oo1tetoifciytfmDumumo (4 exrifcoodlm r ivo s t2xrim3no4lm elfvs s sDrr(m nt1tle  o3iydfm rmumo;u) lxomf to1fpte uvo;s0 rurim3io1lmtelneil( sDrmu  ;u4aeenifetatfa2rl(vo;(4aetomr io1oa  an s () rtoirpoodol  lietl(  ruax onu0apxomfeiydfm2eluvp u0aexoifciydomD liei;t t2xmirpoydalenlnvsa()aDraur no1oeeniiciadfaDrmn s;u0trtoxrcoydlptrli s;(0srtoxm3oudlpeelncil(fsrurumpot1olxomo3iltlmDemn o ()tleoif tytoaDeaivils)t2urxo3oo4lp elfct sfarta(m ;u1tptnmf3iadlaDul(mpnu0 eenir ta1omtrauvi s0teuo(opiudameemnvt t)a2rm( poo0oexn ieiys a2rauvo u) lenmf tytopDr ueolt srtoxmpoodam n fcs sfartr( p;t0olto fcias aDel(vs;u)teenircta1lm eluvi () eur(mpnydomtnmivil(fsruaxrp;o1open oeiad a2uanmo;t)arenxo oytlp r nvi ( t2uoxm3nydol nmnvtatfa2ta(mpot4texoif3iyd m um(mont)texnirctotfptrai slt0setoio3iudaltnmfei s) 2umu o;t4tpt if3tltls el( o;(4tlxrir tydfpD anvi;t  rxo(r3iy1omte ivtltfsDtm(  oo0opt mocils sDrmn pnu)trtnif3iytlmt  iesl( s2trio3ou4ame  fcsasfsrrmxroou0apeo oeiytlm2elnmon(0altrxo oatfaD an i;s)trxo(r iodlpe mietlt)srtm(mpou4oex iietlsla2rl( pnu)arxnifcio1fa  aivi s0trumim oy4lme  ivias)a2umxmono0oet  f3iatla ua(msn(0 eeoxf iotlptelivs;()t2xm(o3oo1opt lfviat)a2tr(m ot4oexomoctyd s2uanvont)texoxf3ta1oatr i i;t0setm(m3io4ap  lieils)s2tr(m ;u0tet mictys s2elu snt4aexnmf3io1lp r u i;s trto(rpiodol emnesat  rtmurpnu4oeto i3iytfmDra(von()artrxf totlaDraues;t)srtr(opnu1lp  mici tfa2trurooo0aet iociadfm2ul( p ()trenxo3tadop  liei;s0s2xm(m iodaptn ncilt aDum(ronu0alx  i3iadfs emu snu4arxoif iatomtr uvs s0tetr(o3no1aptn ivtat arraurono0oetn feiytlm2umnmon(0 rtoxo ia1opt luvs t  2ur(opnodolte fct ( s2rmu pnt0aeeomf3tltfaDelumpn(4 ltrxr tadfmtr nvs ( t2xoxm3iy1opeemncils) rra(mpot4texomfetlsls2ra(ms;(4trxoir iatfp r nes s0s2xoim ny4lm  lnvi t aDtrxrpnt1apxo fetasfs elumsn(0arerif3tytop   u sls)setoir iy4lleemfcsl()aDua(ro;t1apeo o3ils mDemnvsn(0treomocoa1lm raivi s)setoxo3nodlp n fes s) Drmurp;u4tpx moctadlaDemu pn(0 exomo todlmtr uvi;()tetoxo3io4om emnet (fa2rmumpot1oetoiietltfmDulump;u)aeeoio3tatlp e u ilt)srxmir iy4op e fvias)artmu o;u4olt  fctyd a um(mp ()tltnxf oo1fa  lueolt0 2xrxrpou1omeemnvtl(fa2rm(rpoo0tlxoioeiltfa rlu pn(4trtrif oa1oaDeaivolt)s2trir ou4llt mfct tfs2rmxmoot4tleomfcildlm2em( pn(4 exoio3oodlaD anvs s  exo(r oudolenlfvtas)sDua( oou0aetn feiadfmDul(mont0arenxf iytfm e nvols texmxopnu1ll   nvi t srrr(m ;u1opxn oetatfs2uan s;u0arxoxf iotomt  uvolt t2tr(rpoudale mfes sf Dtru p;o1aexoiiciys s2emnmpnu0 eenxfctydlmDrluvs t s2uoxm3oy4lmtn icilt)a2raur nu4oexo fciyd a2ea( ont4trtnxo3oatfp r u o (0 2xrim ou4ale livilt arta(m nu4tlxomieiatfmDemuvs u4 rtoxo3io1fmt luvi;s0s2xmxm3no1llenlfvt t  rtrxmpnt4ole  ictydfsDea( sn()alxnir io1fateluvs;s0 eurxm3oy4aptemfvsatfaDtr(ro;t4tlt iicildls rmu o t) ltrmfciytlm  ai o t)t2xr(mpno1ol n fesas  Dur(ronu4tpe mfciad aDemuvp u4 leoif3tatfmD anvs t0 rtoxr oo1om elnesa(fsrrr(ront1tex  feilslm rl( sn(4teenmr iydomDeanes ()srxo(r ou4lm  licslt aDraum nu1teenmieiyslm rl( s;u0 rtrmf oydfpt luei;(0s2to(rpnydole mfcsas)s2umumpnu1tptnifciatfa emump u)aexnif totop  lues t0truo(m iu1openmnci (  rraxr ot4aleomf3ild m rlumont0 rxnif3ootfm eauvs s t2xrir3nu4amtemivtas aDrr(rp;o1tlx iictat m el( s;t4 eerioctytoaDeaueslt0teuoxrpiudomt mnei s)sDtau oot1ope mi3iatla umn s;() exrio3totopte u il()sruoxo3oy4om nlnvt sf Durx ooo1apxnif3tydlaDrl(mo;u4tetnmo3totom eaueslt)seum(r nodapee icta() Draum no0apt ioetldlm emnvonu0tlerxrcto1lp   neo;t)trxmxrpnydllee fctatf rrrxmpou1tlx  i3tldlaDrmnvo;(4tlenircia1oa  au ils)sexriopnydamenlfvsltf 2ua( p;t0tlx  f3ildls uln pnt0trenmfciotfmtr u i;t  rurxm3nu1ape  fci t  rra(  ;t1oeto ociydla2ulnvp u)tlxrmo to1oaD auesls0srtoxm3iodlptelici t) rurumont1aetnioeiytla ulu p u) rtoxo oadfm r uvo;s)s2ur(opoo1aptelict tfsDtmx  ot4tlen iciatfa emnmonu0alxrir iodoaDeln ols t2toio oydap  lfctltfaDtmurp;u1tlenmieiltfmDum( snt)alxoxrcoytlptelnvi s0 2xrxo3oydoltn ict t) 2um(m ;t0olxn iciyd s2elnmp ()arenxr iy1fptr uesls s2urxm oy4lm  lieil(f Dtaxm nu0alxnmieiasfa2uanmonu0altnmr tytomDe ieols  exr(r3nodlm e fvs t)aDrr(r no4apeomfcilsls eauvo u0arxnxf3iodopt li ils) eum(r3nudlmtn ictltf 2rm( ont1oltnmfciatlm ua( p;u0tetomf3ty1lpDeaivo;(0truoim3io1ap nlnet ()sDtmxmp;t1tleniietydlm ua(vo (4trxrio3iytomDrluei;s teuo(o ou1omenmnetls)aDrrx o;u4tpx  fctytfm rmu p () rxoirctytopt ai s t t2urim oo1omenmics t) Draxrpou0alx  oeiysfaDeauvp;() eerir3iotfpDeaivols)texr(o3io4lme mies s arurum no1tpx ifetls aDuaump;u)trtrxo3iodfpD lu il() etmxm oy1amtelnvs s)s2ta(mooo0oeto fctydfs um(vs;t4tetnifcoodomt  ivi;t)texmio io4ale mivilt)aDur(ro;u1apx ifciad a2el( pnt4alxnioctotlateluvs;s0 2urxo3oydap nmnet s artmurpou4teeomocilt mDuanvo;()texnxr3oytlaD lnei t0t2toxr3nydale licilt) rrrxrpnt4oleoiictas m ea( s;u4trermr3to1lp  livils s2ur(o3no4ole  ieil(f Drr(  ot0tpxnmiciys m2eluvo u4alxnir ty1lat  n i s) etm(m3nu4alenmnvs t  2taxmoot0alxnifetytfa em(mont0tltrio oy1la raivo s0 2uoiopoy1om emfci tfaruax poo4tpt mf3ils s2uauvpn(4 rxnifctydomteau o;() eumio oo1alt mnvslt) rrr(  ;o4texniietasla rm(ms (4trxrio iodoaD luvs;s0 euo(r3nudal n icias aDtrx ont1optomoetytfs2rmn snu0teenmr iydla rlneo;t t2trxm3nudlmte ivsltfarururpnu1alt ifeias mDulnms (4 lxnxrctatlpt  n il(0srumir iydlltnlfesa(fsrtrxmpnu4oet  iciatlsDrmump ()texoxf3oydfm e uvilt) etrxr oo1apte fet tfaDumu pnt4olxo o3iys a2eauvo () eenmr tydlmDran s t texmir oy1lp n fciltfaDra(  ;o1opxnifciasls rlums;(0aexnmf3iadfp  auvi s)t2trim oydalenlnci ()a2rrxr oo4tlxn fetasls uanms t0 leoircoytlp r ivs s  rur(opiy4lmtelicslt sDtr(  no1aptoioctadfsDrlu p;t4 exomocoa1omte ieo s) rxm(mpio4lp nlnetl(fs2ur(ro;o0apxnmietlsls ul( o t4trtomrcoodlpDrln ols t2trxrpiu4op   fetl(  rrrxrpot0oltn i3iysfs rauvp;()tetoir oo1fa rlivi;(  2xriopou4lle miei (  Duaum no0tetn icilsla em(vp;u0trerxf3iatfpDraueo;s) 2xmxm3oydal   ivslsfaDrru  no0tlenmo3taslaDeanvp;u0 exrmfciodfaDrlu i;() euoxr ou4lmee ivil(  Drmurono4apeomi3iys sDem(vo;() rtrio oy1fa raueols0trxrxm3ny1lptemnvt s)artaur ot4optn o3tysfsDuan snt0aexoxo3ta1lmt auvi;t0 etoio3ou1lle  fcsa(fsrrr( pot4texn ieiadlmDrlnmpn(0trtoxr3tatomD  nes t0srum(r3ou4al   icilt aDumx  no0ale mo3iadfa uau pn(0areomf3todfateauvols srxmxr3iu4lptemnet t)s2rr(ro;u0oexnmfciydfmDul( s;(4tlxoiocia1lmte ieol(0texrir iu1ol emfviltfs2um(m ;t1texo ocilsla2rl(mon(4aleoio ootoat  i o t0srxo(opoudlpeelncsa(farurxmo;o1tltn ociatlm2umuvp;() ltnxfcoo1lptrlneilt)t2trxmpiu1apt miesl(fartm(rpnt4aex  i3tatlm umnms u0altnxocto1omD  u s s) ruoim3iu4alee ivtas)aruaxm nu4olxoifeiydfaDuluvs ()tetomo tydfmDran o;t0t2tr(opnu4aptnmnvi t  Duru ono0alt  feiys s uan pnu4artnxo oy1lat  ivs t0 rxoxm3oo4aleelieias)srtm(  ou0tetnioeiat a2ean ont0texnmr3oydomD ln il() rumxm3iu4ll emnesat  2uax poo4aetnif3tyslm2umn o;t)trenir3tytomDelivslt  2xmxr3iu4ll e ivslsf Dtaxm ;o1tex iieildlm2emumonu) etomr todlmt ai o t0seuoxm3oudaltn net s)artmurpno0opeoiieias s em(vs u4 exnmrcta1omtrlnei t)teuo(rpio1amen nvs tf 2umxmpnt4opt mo3iysla2rmu o (4trtoxo3oatfaDeauvi;()t2toxr iydalt  ncs tfs2umx o;t4apxnifeiytls2rm(vs;(0trenio iadfp rlnes t0setmio iu1lpt  ncil(  rtruront4aex mfeilt s um( snt0tltrif3oodom eli ils0srum(rpoy1lmtnmfvi sfaDumu  ot1apxoii3tld s umnvp t)teermo3oodom  auvslt sruoio3ny4am n feil(fa2raxrpnu1aeeoifctyslm eaumo;u4aeeoxocoadfa ranvi s0s2xrio3oodal n neiltf Dtrxr ot0aexnmi3tatfa2umuvp t4altnmo3tytfat  nvi t t2xoimpoo4lmtelfeilt s2um(  nu0aptniiciyd m2rln onu0alerxf3todfptelueo s t2uoxr3io4om   ivs tfa2raum nt1aeeo fcildfs2ean pn()alenircootfm  auvols)trxoxr3nudopt lieias) Dra(  oo0oee ioeiytlaDea( s t)altnmo to1lmDelu slt  rtr(m3ou4openlnesl()arrm(r nu1opt miciyt a2rlnmp;(4aexrxo ta1fa  an il( srumim iudal nmietas) 2uau  ;u1aleomfctatfmDumuvonu)teenir3oa1lpt  uvi;s)s2umio nodlptnlfeiat s2tax  nt1tet mf3iys m umn s;u)artrmrctatlatean o;t)trxmxopoodol n ictl()sDrm( ont1alt  f3iadfs ran pnt)texrio3oatlm rauvils0t2trir ou4amenmfeslt)s2umxr ou1aee ii3tatla2ua(vo u4 lxnmr3ty1la  liei s0 eto(o iydlme livilt a2rr(r ;t4ale if3tydlaDrl( sn(4texoio3tadlpDeauvsl()texr(mpoodapeelfvtat srtm(r ot1tpto fciat s uauvs u4artnir oo1fmDr n i s0t2uoir nu4alenmfvi (f 2trxmonu4tpeo iciasfm ul(vpn(4 eeoir3oatlaDr i i;()trxmim3oodomee ict s  2raumooo1opeomieiysfm eln s;t0 lermf3to1lmDrai s;( srumxopnu4amenmfesa( sDrrxrpoo0olxoioeiytfmDem( p;()arxomf iadopDrauvslt0 rxrxr ou4altelfvta(fsrumxro;u1tpto feiltfaDuanvs (4tetomf3ia1lmteauvo ()tetm(r oy1om elfetlt)aDrrumoou1opt  ietatla umnvon()arxrircia1omDraneils0s2xr(rpoydame licils  Duaxmoou1oet  ieilsfa2emnmsnu4artrxociy1oa  lues t)texrir oo1altnlneiltfaDrm(r ;t1tlto oeiaslm uau s t4trtomo oodop   nvs t0tetmiopoo4olenmfct t)srtm(rono4aeeomieild a rmnmonu)tltrxo3oodomDraieol()s2xoimpiydlpte fvilt) 2tmx  ;u0optoifeias sDrl( o u)aleoxo3oadfm eliei s t2to(rpoy1lltn neias) 2rmxmpnu0opxnmfetydlmDraump;() eerxf3tytlaDeaivs s srtoxr3io1alt  neias a2taxm nt4tltnioeilsfm2rluvs;u0 eeoxf3iatfatelivslt t2toir iy4oltelnetasfs2ta(rpnu4apx ifciytls uanvo;u0 rtrio3ty1faD anes (0 rumxm3nudolte icils sDtmump;u4oexn fetasfs ulnvo (0tlxomr3oydoatrlueil(0 rxo(opiydol  lnviasfsDtmxm oo0tpxnmi3tltlsDumump u)arxrmf ta1lm  auvsl(0t2xoirpoy4ameemncs s srurur nt1oetomieilt m2em(vo;() lxomf oydop rauei;t0s2xoxr3iudlleemivtat a2trumpou0aptnii3ildls2ul(vp (4aexnxo iadlptrlivsls0seumxrpio4open fvs t s2rau oot4openioetytfmDua( o;t0alxrmo oadfm rlneo;(0 rurimpio1amee ivsl() Draxmp;o4aexn ieiytlm rauvsn()tltrirctodomDr neo;( s2ur(r nydlmtn icil( srra(  ou1tpeomoetls mDel( snu4tlxoxrcoydoat anvils) rtrim3io4optemnvsas)arurxro;u1aptomo3ildlaDea(mo;t0alerif tytlmD ln o;(0srtr(m3nydam  lnviat) rua(mpot0tee  i3iadfsDua(mo t0 rtnxr3io1om  aueo;s t2xrxo ou4lpe mfcs (  Dra( pou4tpxo ictatfm2eauvont0 ltoxf tytoaDraneslt)tetr(opiu4llenlieil(fa2ur(mp;u4ole  f3ilt aDra(mpnt4 rtoifctotfmt au o;(0trtm(m oy4olen fvtas)s2tr(mo;u1ope  f3iyd a2rluvo t0arerxr3iotfp  lu s s s2umxmpoo4oltelfcil(fa2trx  ;t0texoiietad sDrmnvo t4tltoxr3oydfpD  n il( trtr(mpnodop   fetls  Dtr(moou1tex if3iatls2umnmp;t0 reomocoo1lmD au o t seto(rpoodamt mnci () Drau  oo1altnmo3ias a2ul(vont4 lenxf3oo1fmDeanvi;s0s2xm(r ny1lpe lfesas  2urur no1alxomo3iltlmDul(vp ()arxnmrcoodlp eln o;()t2trir3nu1lptn nci t  rtrxmp;t1tet iieilt s2ua( p;t0arenmo3oatla eanes;(0t2xm(r3nudal emneia( arra(  ;o1apx  fetatfs elu p u4 exnirctytoa rlieil( setrxr io4altelnvslt) rumx pot1aexnif3iydlsDulums;u0artrif ia1opDrli o;t) rur(m ou4alenmneslt srtm(r nu4tlt  ocilt mDrlu p t0 etrmociotla  anei;()t2umxr io4alte fciatfa2ra(r ;t0tltn feiyslsDra(vonu4 eeoirciydfmDe ivo s teto(r3nodamen ict t)arum(m ;u1opt mf3ilslaDulnvonu0areoifcoo1om elnvsls)teto(m io4ll  lictlt) Drmumpot4aet  oetysfaDua(vsn(0artnxr oatfm rlieol()trxoio oo1opt lnvs tfsrtrumpou1ape ifeilslsDuauvs;u) lxoifciadlp raieslt0trxmirpiydam n nct t) Duaxm ot1aex mf3tadfsDua(vp ()aeeomf3totlm eanvils)truoio nudame mfvsas) rrmxm oo0olxoiietysla rmnmont0artoir oytfm rlu o;( truoxm3nudlpeemncils)arraurp;t4oexnii3ils m2rln o () lxoxf3tydfat an ils sruo(r io4ap  mncsl() Dtmurpnu0tee io3iatfaDumuvo u)treoxfciadfp eliesl(0t2toxmpnu1lptemictls  2rrxroot0aetniietysfm2ul( s u) lxomr totfa r nvol() rtoim iy4al  lnctl(fa2umum ;o1tleoiiciat mDrmu snu)altrmrciatomDe neo s truoim3oydop e iesls) 2uau p;u0apxoiociadla2rauvp u0arxrifcto1fm r nvo;s)t2tmxm3no1ap  lfcil()srrmxrpno4texnmiciasla2raumont4 renxo3ia1opDe ivolt) 2uo(m3oy1alenlfes tf rrrxm nt1tetomoetydls2ul(ms t)artomo iytla elneol()sexrxmpoy1omenmnci t)arrau  ;o1oexoii3ilsfsDeanvp u0 rxrifctytfatelnvo;t trumxmpoodom elfciat a2rru  ou4olenifciasfa ea(mp u)tltoxr io1oat auvols0 2urirpiodap  mnvta()aDrauroou4oexnioetydlm2el( s () rermo iadlpD  ieo () rxmio ny1aptnmiei (  rur(mo;o0oetomfetatfm2ra(vs;(0arxoir3iotfmt aieo t0 2xm(o oydapt  nei s  2uru o;o4optnmfciatfs elnmo (4 lenxf oa1om rln slt)trtoxr oo4apenmictat) Dtmxmono1tex  oeild s rl( s;u0arxnxo3oydfpD  neslt  exm(m nudal   net ( arua(mo;u0altoifciasla2uln p (4 ltrif oodfm e uesl( texo(o3nu1lmtnmict s  2um(monu1tle mi3ilslmDumuvpn(4 leomociadlm  lnei t) 2urimpiodllen ncta()artrurpnu0tpeo ocildfs2rm(ms;(0alerir3iy1opDr n s;t0teuo(o3iu4optelnvtltf 2rauront1ope mfetyslmDua( s (0trerxo oytfm  lnvo s0truo(o no1om emfvtl(  Dtauront4oeeomi3ildlm2um(mont4artoxf oadlmt li i s trxoxr oo4al elnvsltfs2tr( o;o1optniociydls ulu s;t0 exoxf3todlaDeln o;(0srtmxrpny4lm n iei ()sDrr(mpnu1tlto octlslmDrmn p () eeoxo3iotfatran i;()tetoim iydope  fctatf rrmx  ;u4opx  ociytlmDelnvp;u4arerxfcta1opDr n i;s srxm(opoodlpeelfviatfsrta(m ot0aeeo oeiyslsDrmnms;() lermo3tadfmD lu s;(0 2umxrpiu4optnmfvsat srrrx p;u0ole  i3iatfm2rmnvon(0tetomf io1fmDeluvo (0trxm(r oy4omee fvsat srra(r nt1ope mi3iyt sDrmuvs u)areoir todfp  aues;t trtrio3oy4lp elieias s2umu pnu0olt io3ilslsDra(vs;u) leoxf iytoaDranesl(0t2um(r3iydop e nvtat)arumuroou4tpen ociadlm2rm(mo (0 exomf ia1optraieo s0 ruo(rpoy1ole miet t a2rm( oot4apx ioetlsfm emn snt4 lenxr iodoa r u i s  etmxo oy1lp emnvtas) rtmxmpno1tlx miciad s2rmuvpnt0aexrmociy1omt  u s t) exrxrpoy4opt mnvsltf 2rrx  ;u1tee  f3iatls2ra(mp;u4aeenxocoy1omDe n ilt  rtr(o oo1om e fciatf rua(rpot1oex  fctytfm umnmont4texrif3iatfptelneo;s) 2tmir3ou1aleemfct ( aDrr(m no4altn f3tydlm rln p;u)arenxociadlaDranvo;t) etoxr3ou4am emneiatfa2rrxront1aeeoifctls a eaums;() rxoxr io1fptraneslt) exr(opnu4olenmfei s artmxmo;o0apxnmfciatfs2rau s t0aeenmo iodfaDe uvsls0s2xoio oo1olt mfeilt  rtmx p;o0tet  ieiytfm ean snu) exrir3totlm e ieol()t2tmimpiu4am elnci ()sDum(r ;t4alenmfeiyslm ranvo u)arxnxr3iotlp ean s;(0trxoxopnydom n fcslt sDum(m ou1oet  ietat mDrmumo;t4altoirctodfmtrluvs;t0setmxo nydlpee nesa(fartmx pot4tlenmociydfaDul(vo;t4 rxrxf3iydomD ai o s t2tr(opiydal emfvil() rrm( p;o0tpxo icias s2rmnmon(0altnio io1lpDelnvo t0trxr(m no1oltelietlt sDtrxrpoo1oet ii3ias mDua(mpn(0tetoxf totfa r nei;s srur(m iu1olt mies t a2rax ooo4alxoiieiltls2el( pn() lxrxo oa1lp   ieo ( teurxm3ny1aptn ieilt)aruaxmooo4aeenmo3tldls umnms;t) rerxf3oo1om eln s;s0s2xmxr3iu1amenlnvsl() rtau  ;t1oee  ieilslaDuanmo;t)tetnmf todfp e ues (0 rto(mpiodaptemnctlsf 2rrx ont4olenmictltfmDrlu p t0arxnxo iodopt  ivs s)s2trxr nu1am nlnvtl(  Dur(monu1aeen icilt a eanms;(4aexomo3oadfat au i t)trur(opnydlmt lnctltfaDtm(mooo4olt  oetytfa eauvp;u4aexnxoctydoa   iei;s seumim3nudlltn fvs t)a2rr( o;o1tltniociltls2em( s;(4alxnxociatlptr i o t0 rurxm no4alen nei s) 2rrum ;o0tpxn ieiltfsDrauvsnu0aexnmo3ootla  auesl( t2xmiopny1lm elfvtltf Duaumono0altn octasla2umn o;t4arenmr3tadomDrai slt0t2umxo iudlmtnlfct tfs2rr(mpnt0opeomociatlmDuau snt4teeomociy1faDe nvsls0t2xr(r3nu4ol   feia() 2taxrpou4oex iociyt m rlumsnt)alxnxrciytlaD anvslt)setrxr nudlmeelfcils s2rrum nt1teto oetasfsDrmnms t4arxrxrctotop rauvslt  2xoxopny4lltemnetasfaDrr(m ;u0aeen o3iad s ua(vp;(0 rxomf3tytom eliesls seuoxmpou1lpe  ics s s2ta(mo;t0opt iieiatlaDul( o u) rtnmo iatlptraivils texmir3nu4op emicsa()a2um(mpou4apenmieiatfaDelu p t0trxnxfctytfm eli o ( s2urim3oy4llt mfet (  Dtrx pno0tpx mictldls uluvo (4tetrmo3iadopDr i o;(0s2xr(r iudllt livs s aruaxmpoo0tee mfeiasfaDra(vpnu4alerifciydfpDelneols  2tr(mpou1lle  nct t)srrmumo;u0olx mi3iyd s2uluvp;u)tetrmr3oatfmDr i o;t) rtmxo oudamt lnci (  ruaxm oo0ope mociys sDuanmont0aeenmrcoa1opteluvi;t teto(rpnodlptn ncsl( sDtrxm oo1openii3ilsls2uau sn(4aeeoxociydlmte n o;t  rxmim iu4aptn iei t s2tr( o;u0aptn oeiltlm2rmnmp;t) ltrxociydlpD  n o (0srumio oodamt  ivtlt s2ta(rp;u0tpenii3tlsls rmu ont4treoxr3todlpDr ivi ( seumxo nydom elnct sf Duaumono1oexomfeilsfaDem( p u4 ltnxr iotoa   nvs ( srtr(r nodapeeliviat)s2uaxr ot4optomo3iytls ua(vont0tleoir3tytfpD auei;t) 2xmxrpiy1ape mfci t  Dta(r no1olx iieild aDrmumo;u0treomrctytoaDeaues t0seuoxopou1ole mneslt  Drmxrono4tpxn feiytfs um(mo t)trxomr3oatla eai s;t  rxmio iudlpeemncsas)srurumoot1olt  ociasla rmn s;u4 reniocoodopDr nvs t setm(mpio1ome mfesa(fsDum(mpoo1optniieiydlm emump (0arxoif iotfm   ivo ()srumir3io4lleemfvs s arua( pnu1alt  f3ilslm umu o u) reoir3todoptrauvsls setmxo3nydameemfetat aruaurpnt1teeomoeiytfs2uanmo;(0aleomo tydopteluvols t2toxo3iudoltemfesl() 2rrxroot0opto fcilsls ul(msnt0 eerxo3oy1omtraieilt setmimpno1omenmicsls) 2ur(m ou0aptomiciltlaDra(vpnt4aleomf iotfptraivo s setrxopny4lmen fetasfs2rax pnu0tpeo ieias aDulnvpn(4tlxomr tatfptrln o ()t2tr(mpoo1olee ivtl()a2ta(m ou0apx iociydlm2uan s;t)tlenxo oa1opDelnes s trtmxr3oudom   nciasfarurx oou1olen ociytls2rl(vs (4artnxo3iy1fpDelu i t0t2to(o no4lpe mnvsatf ruaur oo0tleo i3tytls emump (4 eeoxf iotfptran sls0trxrio3nodalt lneia(  2ra(  ot4oexomociadfa2ean snt4 lenif iy1lp  aueo (0t2uoxmpnodopen ieia( s2tr(r oo1oexniocildfaDulu s ()aeenir oadlmDrli olt0setm(m3io4lp  mivi sfarurum ;o1aee mfetytlaDemnmp t0aexoxrciy1oa elnvol( t2xmir io1optemicil()s2taump;o1tltomfeiydlsDeanms t4texnir iytfmDraivols)texmxr3oydlltnlictls)arururpno4tpxo ociydfmDrmumsn(4aexnmfcoytoat  uvilt)srto(rpny1lptn nei t)a2ua(mo;u4oleo i3iytls2raumo (0 exoifcoatoa  lieslt sexo(rpnu1am nmfcs ()aDum( ont0oeeomi3iydfa2ulnmsn(0teerxrctadla r uvs;t)tetoxr3io4apee fet tfaDra( onu1teenioetytls eln o ()alxrio3tatla  aivs (0s2ur(o3oo1lptnmfvslt arumum no1oetn i3iadfsDrm( pn(4trtoxr oytoa elueo;t  euoxm3no4llenmncils) 2tmumoot1tltoifeiasfmDrmuvsnu)trxrirctatlaDrln i;s  2uo(o ny1op e netl(fa2ururo;o4oetoio3tldfs2el(msnu0aeenxrctatopD auei;(0 2xoxo3nu1omeelfeslt artmx pnu4openmo3tyslm2rm(ms t)tetnmfciotlatr n ol(0trxo(r oo1lleelncsa()aDrr(rpnu4aetnmieiat s2emnmo;t4aleoioctadopD lueils0 2urio3no4lpenlivils) Dumxrp;u4apen oeiaslaDuan snt4texomr3io1lm r n o;(0s2to(opio1olte nct tfs2taxmpnu0oltnmi3ilsfs2elnvs t0 ltoif3oydoptr ieols0setoxm3nodlm emicilsfsDrmx  oo4aleoif3tlsfa uanmo (4tltnmo3iodfmtrluvo;t t2uoiopny4omt lici sfsDumur nt1olxoifeildfm2ranmo;()tltnir iadoat  ivs;( s2tmxmpoy4ap nliesa( sDtr(  nu1tetnioetytlaDrmn p (4texrmr ootla  au slt) ruo(m nydol nmnesl( s2raxrooo4tlenmfetatlm2emn p;t0aeenmr3iadoaDran s ()t2to(opnu4ame  nvia( aruaum nt0aexn fciyslmDelnvon(0aeenxr iy1faD lnvs s srur(m iy1am nlneias) rua( onu1aleoii3tldls rl( ont)tltnmocoy1faDr uei;(  rxo(r nu4alenmnei sfs2trx onu4apxnmfetatls eauvsnu) lxrio oa1faDelivs;t s2xo(opny1al n fcsls sDtmxrpnu1texo i3tyt m2ul( p t)alermfciotlp  anei;s sexo(o3iudopen fvias)srra( oot0olxoii3iadfa uluvo;u4 lermrciy1oaDeaivo (0 2urirpnudom emnctlt arumumpoo4tpx mieiysfs rmnvp;u4tlxrmo to1lpDeaueolt s2um(r3oo1lmt lnvi s)a2rmuront1tle mf3tadlaDrmn on(4tleomrcta1oateluei;s0setmxopno1lp  lfvt ( srrrurpot4oexnifeiyd s uauvsnt4aetomoctydlm elnes;()texoxo iydll   nvi tf rum(monu0aee iociys a eluvp u4 lxoircty1op e n i s seumio ny4lmtnlnvtasfarrrumo;u1tpt iiciadlaDran s t0tltnircoatfpD lneols s2tr(m3oo1lle  fvt s) Dumuro;t4optoiociat s rlnvsnt0aetrifctatfatr nvi s)trto(rpiy4lptnlnesltfsrua(mpou0optnif3tlsfa2um(vonu4aleoxfctadlmt aueo s  exrimpiodlltnmfvi t aDrrx ono1opxniociyt aDea(vpnu0tleoircoadfpt li slt t2tmxopno1omtn ietltfaDurx o;u0altn oetad a rluvpnt0 lxoir oytoat  ivo;t)s2trxm3iudlme mietlsfaDuau  ;t0tetoii3iys a2elumo;t4arerir3iy1fm eau i t s2xoxrpoydam n net t srrrxm ;o4tleo o3ilsfs um(vont)aleomf3ia1omD  ies;() rxrxm oy4amtnmici s)a2tmxmp;o1apto ocils m ul(vp t4trtrio ty1omD auvsl(0t2uoir3ny4alee feilsf ruau  ;t1apxoiictysfaDrauvs;t4aexomf oo1lmte n i;t)texrxrpiy1ol e fvtat srur(ro;t1tle  ieiatfsDemuvo ()areoxfciodom eauvi;t0 rxmxr3ou1apt lictls) rum(  ot4olxomfciat m ulums (0texrmoctytfmteln i;s0 exr(o3ou4am elietl(fsDtrxro;o4tpxo fetytfm2ra(vs u0tetomo3tatlpt  ieo t)texriopnu4lltemnctl()srtrur ;o1tltomieiytls uan pnt4 eerif iotfaDrlivols trtmxo io4lm   iesat sruauroot1alto f3iaslsDrau ont4 ltrmr oydopte nvo () rumxo3nydopte ncil(fsrurxrpnu0apxnmo3ildfa2rm(vs u) reoif3oytomDelivi (0 rumxr nu1lp e ncilt srtm(rpot1tex ioeiad sDem(vsnu0tlxnxo oa1fpDrlues s)trtrxopio4lme mivs (f rurur ;u4olxnioeiat m2um(vs u4trerxo ootlaD  nvs;t  ruoim3iudll nmiviat sDtrx  ou4olx  ietadfm2umuvp;u4aeenxfcia1omte ivol()trxr(o3ny4lmeemics t)sDum(m ou4tpe mo3iadlsDemumpnt)tleoxo iytopte ues t trumxo iu4lltelietlt  rrmu p;t0oeeomociadfaDel(ms;(0arxomrcta1opteaivs;(  exo(opno4amen nvt ()sDur(mpnu0opxnio3iysfa2umuvs () ltoir3todop e uvs s0sexm(o3iydlptnmncs s)s2urumono1ope mfctadls uanmonu4trtnmf3tatfmD luvi t0trtoim3io4lm  mneslsfartmx  ;t1alx mfeiaslsDum(vo;u4artoxo oy1lmt  u o;t0setrim oodop n fcs sf 2ur(r nt1alxoioetytfm em(mp (4texnxocto1fm   u i;s  eur(m3iydlp   nvsltf rurx pnu4oexnmo3iysfmDea( sn() rtnxf3oydfpteau o;(  etr(opiy4am nmivsl(f 2umx p;o4tpxn f3tys mDrmuvo t)tetnir todfpt lieolt0srtoxm iy4lltn ivtls)a2ua(r nt1apenmoctldlmDemu s;u0artnxo3ta1fmDrlnvo (0seurimpoo4aptemfei t)srum(mpno4tltomfeilslmDrau s t) ltrmo3ia1lpteluvs;(0seumxmpio1altn fcs tfsrumu oou0openmi3ilsfmDrmuvon(4tltnif3iytlmtr uvi;( trtmxmpiydlpe lnetat  rrrxm ;o4tle moeils mDrmn sn(0 eermr3totlpDeln s;s s2to(o iu1olenlnesasfa2tmxroot0altoiieiytlm2el( s;t4aexnifcoa1fatrlieilt0seumim no1opeemneiat) 2uaumo;o0aee  ieiltfs ulnmon(4alxoir oodfat aueo s)setrir oy4apenmfvt sfarrrxr nu4oltomoeiadls umnmp u) etrxf iodlmD  neols0s2xrio3ou4lmte nvi () rtmx  no1ole mo3iaslaDrlnmo t) rtniocoodlatr ivols  eum(r3nu1ll nmfcslsf Duax  ;t1open icilt aDumnvp (0trxrxocta1fpDelnvs;s t2uoio iy4olee fcta(farrrxrpnt4tpt  ociadla2ran p u4 lxrirciydfpDr nesl()s2umxo3iu4lpen ieia( s2taum no1aet iiciytlsDra(mp;(0alxrmo3io1lptrlnei (0 exr(o3nu4altnmfcsas aDrmu p;t1ole moctysls2umnvo t0tltnif3iatfpDeln il( teuo(m nudoltelivils  Draxr nu0oexnii3tydla2uln p;t0altnxoctadfmt  ieo (0sexmxo iodapeemiciat arrrxrp;t4optnioetatla um( s;t0trxoxr ia1optr ueo (0teumirpiy4am  lfvtas)sDraur ;u4optn oeiyd a2umuvo;u)trxoxocto1oatrauesl()srtmxr3oudom nlivi sfa2rmxro;u0aleomf3ild m2em(ms;(0 eerir iadfa e neils) 2xrxopiydalenmneta()a2tr(rpou0tpxn o3tas a2ea(mp t)trerxr3iotopt lnvil()srxoxopoy4om   fetl( aDtmx  nt4tlx mfeias mDrm(vsnu0areoiocoadlateln i s)srtoxm oydop nmfvt s a2rmx  oo4aeen feildfs2rmu snu0tetrxf iy1faDraneols)s2xrxm3nodapeeliet (  Drmu  ;t4apxnifeildfsDuaumpnu) exnmrciy1fa elivolt seur(mpou4ll emfvi ( artm(  ou4oetnmi3tad mDuluvsn(0trtrxo3oy1lptr ivs s s2tm(o iy1ol n ici t)s2ra(rp;t4altn fctad mDelnmo;(0aleomfciodop rlivslt0s2xm(m iu1amt mictas s2raumpnu1tleoioctltfsDuanms (4 rtnxr ootlptrln i t) 2trxopno1ap  mnvs sfarrmxrooo4oetoifciasfa2ua(mo t0 rtnir3iodoaD luvo;t s2uoxrpiy4lmee nei t  2uaurpou0opeo f3ias aDrluvp t0tltnxo3ta1oaDr ivsl(0seuoxo ny1ame mfeilt)s2urum ;u0oex  ictytfa2emumonu)tlerifciy1lm eanei s0 etriopou4omtemies (fs2ur(rp;u1oexn feildfs ulnmp;u0tltnmo3ta1oaD  i olt)t2to(o io1altnlfvia()s2umu  ot0tpxoioetlsfsDea(mo;()tetoio3oydop raneo;t)t2uoim oudol elfcias  Drmxro;t0aptnifeiatls emn o u)tetoio3io1lmD lies t0 2trxopiudlmte nviatfarur( ono1altn fciasfa el( p;u4teenircta1lm  aieo t  2xrir oy1lpeemfcslt)aDum(r ;t0apeoiieiat a2eluvo;t0tlenxo3iatoateauvol(0setm(m3oo4omtelfetls) Dtmump;u4tleomfciatfa ul(vpn(4trtoxf3ootfp rai sls0trxr(o3ou4amtn fvtl(faDtmxro;t1tlenmieiytfaDemums t4tetnxfcoodfmteli o s teum(r3ny1lp nmicsas aDumurpnt1aetnmfctat s2rauvs;t4trxomoctytopteaivi;(0sruoiopiu4omt lncsat) Duaumpnt0oleo fetld aDemuvonu0treoxo3oa1fmD  ivo t  2xmim3nudoptnlfcilsfartrx p;u4opx iociyslmDumuvont4teeoif3oatlm e ivi t teuoimpoo1ameemivt t)aDta(  ot1tle  oeiasfa elump (4areoxr3iotlm  aneol( srumimpiu1lme  nvs s  2um(mo;t1tltn o3iytfmDrmnvs;u4aeeoxf iodopDeanvsls)seuo(o iudlp nmncslsfarrru  no1tlxoii3iyt m2el(mp;u0 leoirciadomDrai olt s2uoir oo1aptemfetasfsDtrxmpnt0aptnifeiasla2rlnmpnu0 lermo tytopDranvo t)srxr(o iudopte netas a2taum oo0opxnmietltfmDrluvonu4 etomo iydopDe u ols  eumio no1omee fvsatf Durxr no4aptnmoeiytfm ran p;t) lxomr3tatlpt aivs;()trtmxo iy4ol  lieiltfarumx pou4olt ii3iydfs2rm(vpnu4aetoxr3oy1fpDrlivols0 rto(o3oydam elies (fsrtmxmpot4tlt  fctas aDran p u) lenmoctodfpDelneo (0t2tr(m3iu4ape mictas a2tm(r oo1aeeo oetlsfm umu on()artrmr iodomtrlivilt0srxmxm3io4aleelietl( a2ur( p;o1alenioctlslsDrmums t) rxnmo iadop r u i;s sexoir3io4al n icslt) Drau ooo4altniocilsfm ua(vs t)aexoif3oytoatean ols0 2uoio3iu4am   nvt tfsDumumo;o1alt ioeiys aDeanvpn(4tleoxo3iydfaD  i o s0 etoxo iodomtnmfvi t) rtm( o;t0oetnif3tas m rlumon()texnmfctatlpD  uvo s0setmxrpnu4lpt mfeta() ruau pou4oexo i3tat mDrl( p (0aetoxr oytfpDe neo s0setoio3oy1ale liviat sDtru poo4tle  o3iadlsDrmnms;u4tlxrif3tadfpD  n slt0 euoxmpoodapte icta() Dum(  ou1aex ii3tas sDul(vs u0alxnif3tydla ranvilt  rtoim3oudamenmncil(f 2uaxr no0alx ioctltfmDelnvo;()trtnifciatlaDraueil( t2urim oy1ll   ivsa() 2rr(rpot4aptomociaslm um(msnu)teenxfcoodopDelneslt) 2toxm3iodalenlieia(fs2trxrooo1teeo fetydla elump;(4altrxf3to1fmteau o;t)t2tmimpiu1omtn ietl( s2tr(  ot4tleomieiatlaDelu pnt0 lxrmrcia1fate nei s)srtrxr iydop  lncil()s2tru oot0alen ociyd mDra( ont)aetoxo ta1fatrli sl(0t2tmxr no4lmee nvtat aDrrxrpou0oetnif3iys mDemumont4alxoir3io1fat lnei s0teuriopou4ll emfesls srrax onu0aeen fetadlm2ul(mp;u4areoif ta1oateaieo s  rtmxr oodolt  nvilt)s2tmx o;u4aleomociadfaDuan o u0artrxo3io1oat auvi;(0 eumirpou4omt mfetlt)sDtrxm nt1optnifciydfaDumums (4 ltnxf tydfp   n slt s2toio3iodolt lnvtlt s2umxr no1oetnmietyt a2em( s t) eeoxf3tatlptelnvols)truriopno1lp   fvtat)s2rr(rp;u0tpt mo3ils s ua(vp (0 rxomo oadfmte nesls) exmir iy4ameelfcslsfaDraxr ;u0aeenmfctasla umn ont0tltomocoo1lm raiei s)setm(o3no1alee ieta( sDrm(  ;u4olxnii3ilt a2rluvo (0alenxf todlmt  u i;( teuo(o3nodlpeemivsl(farua(mpnt0teenmiciat s2emnmpn() lxoiociadom eln slt0sexrim iodam   iesltfsrtrumpnu0olxnmfcilsls emuvsnu)tleomf3iydop rlu o t t2tm(rpoudalt lfct (f Durxmo;t4tltn oeiad s2elnvp t4tetnxf oa1oaDe nei s) 2tr(o oo1ap nlivt t)arta(rpot1aeenmoetasla uau o;()altrmo3oadlpDr ueo ( setoxo3iy4llt  iesa()srtm(m nt0alxn oeiltfm ranmp t)tltnmf oo1lpDr nvil() rtmirpiu1olenmnetlsfaDurur ot1alen o3tltfa raumo;(4artomocoo1fm  auvo;(  exoio3nydomtnlicilsfsDrru p;u4tet  o3iydla2rl( p;u)alxnxo tadfmtelivo;s)seum(m ou1altn fcsat) 2trxrpnt4apto ictytlsDeaums t4trtoxrcoadomDrlneil()tetoim3oo4olte fetas) Draurooo0aex ioetysla2el(mpnt4tltrxfcoo1om rauvols)srtoir3iu1am emfci tfs2rmumpnt0tpxn fciyt s2rlnvpnt) eenio3tytlpt li ols  etoir3oudlme lfvsl()s2rmxmoot4aetn f3ildlaDrmn pnt0alxrxr3oodopDr n sls)srxo(mpiy1op  lfeta(farrrx  nu0tpx if3tytfm2elums u4aetomociy1omDraueo;( t2tr(o3nudlpeelivi (f 2trxmoot0oexnio3iatls2emuvont4 etrmr oydfpD  uei s) 2uoxr io1lp nlicias)a2ta(  ;o1tlxomfetlsfa2emnmsnt)artrxr oatomDelu o;t)trxo(opiy1ll nmicsa(f rrmxrpno1aeen f3iytls2um(mp;()tlxnmrcta1latr uvs;s s2xmxr3iu1apenlfcsl()s2taxmoot0alxoiietys aDeanmpn(4texnxr3oodlmt lnes t0trxmxm oy4ap  lfci s) 2trx  ;t4olt  fctldfa2rl( pnu0teeoif3to1lm r i o s teum(o io1omeelfciat)aDuru onu4apx  ieiys aDrmums;u4 lxrio tatoat lu olt0 2um(m3no4op n fvsat) Dtm(rpou1tltnifeiyt sDulums (0tltoxfciy1om  ln i;s)tetmxrpou1lp n nvs tf 2ua( onu4olxnio3iad a2umnvo u)arxnif io1la r u i;t0sruo(o3io1om   fesa()aDtrx  ot4apeo i3tyd s eaump t) rtomr oadopDraieo;s)t2trir iu4altelnesat srra(mo;t1altniicias a2ea(ms (4 etrmf iydlp  an o;s seuriopio4am   ncsa( s2rmxrooo4tpen i3tyd m2el(vo t)trenxf3to1fatrlnvs;s0 2xoxopio1ol emfet (fsrrmurooo1teenmf3iasfmDrluvs;(4trenir iotfaDrau sls  rtoxmpio1am nmies tfarumxm ;u4alt  i3tasfsDeaump;u4arxnmociy1fp e nes (0seum(rpiudapenmivtat  2trx pnt1ope mf3iadfaDua(vp (0aetoir tadfat  n o t0srtmxmpiu1lptnmivilt a2um(rooo4tlxoif3ils a umu s t0 rtnir to1op   uei ()trxmxopiy1openmnct t)s2rauronu0oee iictltla umu pn(4aeenxo3ia1lpt  ivol( teuo(mpoudlmt lfviat aDurxm oo4ope iicils sDrmn snt)tlxomo ty1lmt  i sls) etrio oy4ale livt s) Dtru  ;t4altoif3tltfs2ul(mpnu) rtnmrcoa1opDeanvo;t0trtrxm iodaleelivs ( s2ta(rpnt4optnifciatls ua( p;t0alxrxf3todfaDean ol()teuoxm3no1lm nlfesasf 2raxm nt0ope mo3iydfm2eauvsn()trxoif3ootlaDe nvs t0 2xo(m3ny1lmt mfes (fsrrmu oou4olx  ieilt m2rmuvs;u4aetrircoodomte n i;()t2um(o iudomt  ici tf Duax  ou1oeeniictltfm ulnvpnt4tetnirciy1fa eauei;s  2trxmpnu4amtelfvilsfa2taurp;u4oexnmfeiyslm emu o t4areomo oydfmD aiesls) rxm(o3io1lm n feils sDtaxmpno4texo fetls mDua( on(0tlxrxr oatoaDeanvi;s0texo(o3iu1ap   nctlt) rrmum ou1apxo ietysfa2rl(vo u0 etomo oatfpD anei;s0trxo(o3nu4lp   netltfsrtr( ooo1apxomoetyslm ea(vo t0 rtrxr tadoaDraivo;s)t2uoio3ou4oltnlicilsf rta(rpoo1optnio3iytfa ean pn(0 lenmr iy1lpD  uei;t texoxr3ou4al emfct (  Dtrxr ou4ale mfctltla emn p t0 ltomr3tatom  auvolt  etoxo io1lp emfeiatfs2rrx  ;t4oee  ocils a2eln s t) etrxoctadlat aueo () 2ur(o oo4optelnci tfarraxrono4olxn feiys s emnvs u)teerirctadlp  an s;t setriopoy1llte nvias sDumuroou0texo fetldla2ea( o;t4tetnircto1fpt luesl(0 rtoxo io1lmenlfvsat)artr(m ;o0oexoifcild m eanms t) rtrmo3iodfa   u i;t)trxoxm3nu1lpen icsas)s2uaur ;o0apxomi3iad a el(mo;t0 exomo3oodoa  auesl(0 2toiopny4lp   ivi t)srrr(  oo4aeenmiciadfm eln s t0 ltnxrciadfmDe ivs t srumim3iydam nliesatfsDtauro;o1oexnii3iys m ean o;t4aeeoifcoydoa  anesl( t2xrxo3oodomeemfesat  Drmxrpou0altnifeilsfmDrluvpnu) eermoctatop eluvslt0trum(m iu1ll  liciatf Dua(r ;t0tet  ieiltfsDraump u4alxomf todom eai ils0tetmxrpiu4lpt lneslsfsDrmurp;u4apt if3ilslm uau o;u) renir iadop r nes s0 euoirpoodal emncsas sDtrur nt4apx mieiytfmDrm( p;(4aeenio oo1fa ran o;s) etmim3oydom emnvsls s2taumoot1tee mictas s2raums;(0altrxf oo1fpteanvilt)t2xo(rpnodolt  fvtat)srur( o;u0tee mociysfa ra(vs;u) ltrio iytlptrluvs ( trxrxm ou1lp n fcia(fsDur(m ou0tptoifetad aDemnvs u4 exnxocootom e ieilt) euoirpoudom  licsl()aDrmurp;t0teto ictad m eaumo;t) leomo3tadoat ln olt trurxo iodolenmncsas  2ra(mo;u0tlxnmf3tytlmDrmn pnt4arxnmr totomDraneils0 2xrxrpny1altemfctls  Drm(m ou0tle ioctytfs ea(mo;u4 rtnmr ta1lpDeaivs ( trxr(o3ou4op   netlsfsDta(  ;o4tpxnii3ils mDrmu o t4 lerifciytom elivs;s) rxrxrpiy4omeeliciat a2tmx p;o1oet io3iyslmDua( s t)alxrmo3oytfm elnvs;t srtmxr3io1om  mfcs (  rtax  oo1opeoiietas m ea(vonu0teeoxr oy1faDrln olt) etoir3nudop n fvtl(fsrtax p;o1tet mo3ild sDuan p u0 exomf3ia1lpteaieils0 2umxrpiu4lmeemfvsls a2rr(mo;u0tee mf3tadfmDrlums u4 ltoir iatomt li s;t)setriopnodomee fcilt sDumxmoou0oexn oetasls ran o u)tetomocoodlaD  nvsls) 2toir3no1ap n iesa( srrru  ou0tpe  ictls s rl(mo;(0trxnifciotlp r nvol(0srxoxo3nu1ome lnvias)aDraxrpoo1oeenii3iyslsDeanvo;u4arenxf3oodopteauvsl( s2umim3iudllee nvt s) Durumpnt0tleoioeiysfm2uauvp u)teermfcoadlmtranvslt  rxmir ny1alee ics sf rraxm oo0tpxnmiciyslm2elnmpn()aexnxfciydlp ranvsls) 2xmir3oydameeliei s)sDrmxmo;o1oee  o3tyt sDem( o;() ltnxf3iodfpDe ues ()t2um(mpoy1altemnvtl(farrau p;o0tlxn ietysfsDrmuvo t)aexrif3totom eanei t  rurimpny4lmtnlicias sDumu  no4ope ifeiatlm uanmsnu0texoio tatom  lies s texo(r3iu4olen neiatfaDtrumooo4aeeniicilslmDrmnms t4aeeoxf todoa r iei s0 rtr(m nu1lm  livi () rra(m ;t0alxnmociytfmDulnvo t0aetomo3iytom   i o;()s2umirpou4om emncia(f Dua(  ;u4tpt ii3iatlmDrm(vo u0 leoifciydlm   nvo;()trxr(mpno4amt  ncia( a2tm(mp;o1aetnioctytlaDemnmp t) eenmf3iotlaDr n s;s0 rto(o iydlm elnei s)a2trurp;o4tlx mictatls el( p;(4texrir tydlp  li i s  2tm(o iy1ome mivi sfsrumxront1alxoif3iadfm ulnvo;t0aeeoxrcoytoaDrlivo;(0teuo(rpnu1omt mfcta()sDtmx  nt0oetoiictytfa2rlnms (4 etnxr3iadfp  lneols0 etr(r3iu1aleelics sfs2urum ou1tpt mfeiyt s ul(vp;(4alermr ta1lp rai o t0texrir3iu1ap  lnvslt aDtaurpou4tpt mfciyd m umn o u0aleomocta1omDelnei t) rtoimpio1am   iesl(  Drr(ro;o1tlxnifciat m ranmo t0 eeoxr ia1omDr ieilt  rxoio3ny4lpenliesltfa2ur( p;o0alx io3ils mDuluvpnt0aexrmf iydopt auvsls seuoir3io1open fctasfa2tmu ono0aleoif3iltlm um(mp (4tltoxocio1fmDelu olt sexmir3ou4omen icsasf 2rm(mpnu4tlx micildfsDea( pn(4tlxnxfctydlp eli ils)setmir nydoltnliciat  ruax pno1tlx  f3ias m rl( o;(0tltrir3iodfa   i o;(0texmxmpnudopeelieiltfs2um(r nu1oexnmi3ild mDra(ms u)aexnircty1lp rlnvo ( seuo(rpiu1ll n ietls  rrmur nu4olx  fetlsfm2eaumsnu0texrxfcto1fpDelu sl(0s2toxo3iu1ll  liesltfs2ur(root4tpenif3iysfsDrlu p t4 ltoiociytomD lu s;s) rxmxmpou4lp nmivs (f Dtaxmpou1apxo o3tysla em( ont4trxnif3iatfp  lnvs s)t2ur(o iy4ol  lies t)srtaum ;u1tlt  fciyslmDuau o ()trtoiociy1oa e uvo;t t2xoiopiudlmtnlivtas  Dra(  oo1aetoif3iatfm ul( pnt)alermo tydfp   uei;s)srurxo3iudllt mfeia()sDraum ;o4tetn ictldfa ra(ms u4 lxoxf tadfptrau slt)truoxopiu1llt miciat)s2ur(  ot4oexnmf3iydfa ranvp t4altomf iadfmD luvilt0s2trxm3iu4aptnmictasfaDtmx pou4tpt  feiydlsDuluvp t0 rxoircoadlm rli ilt0 eum(m io4om n ncil()sDuaxm ;u0alxo iciat sDum( s ()arxrmo3iodfmtr n o (0sexr(mpiy4lm n ivilt sDrrxmo;t1aexnmoctys a2rl(monu0 lerxociotfate nvsl( seuriopiu4al e ncs s)a2tmuro;u4texo ieiys a2umnvonu0 rxnmocto1lmDe ivs;s)texoim oo1olenmnvils  Dtaxrpou1aetoifciaslaDean snt) exrirciytfmteau i s0 rtr(m3oo4ape  fvsl() 2rrx  oo1oeenmictytfs2ulums t0arxnmo oydlat li i t  ruoirpoo1omtnmics () Draurpnu1tee  octatla2emnmon(4 etomocoytoaDeaueo;t0sexo(o iu1lle mivtl(fartmu ooo0tlx  o3iytlm ulu s;u0trtoxoctatopDranvs;(  2ur(m3oo1llt  fvt ()aDraurpno0tleomoeias mDranvs t) lxrio oodomDraieilt0 2uoirpno1op nlfvsasf Drrxm no0tex  ociys a emums;t)aexrxfciadla eanvilt0t2xmxm oo1ll emfvi s srururpnu1tlto oetls aDelump;u0alxrif oytlat luvolt)srumxr3nudame mfes sf Dtr(m ;t1aet moeildfmDrln pnt4treoifctotlpD lueo s0 rxrxrpou1op emnvt (  2rm(rpou1aet mieiatfmDuanmsn()tleoxr3to1oate n i;()texmxo ou1ap emfvtls  Dumxrpou0aeenmf3tadlm2emn o;u0 eeoio iytlaDrlnvi;()sruo(r3iy1om e ivsasf Dua(mpnu4oex ifciytls2ean ont) rtoio3iy1lpD auei;()trtmxmpio4amtn fci sfaDururpnt1aeeomoeiadfs2ulnvs u4altrxr tatomte uvo;(  exmim iu4ole lfciltfsDtaxmpou1apx io3tat mDumums;u4aeermr3oy1omt  ieo;t)srxo(r3ou1apt mivilt) 2uax pnt1tleomoeilt m uln p t0 exoxfcto1fa elnvolt  2xrxmpoy4lle  fvt t  rurxrpnu1tex  f3ilt s eau s u4altnmo oadlat  ivi s s2uo(m no1lpeelfct (faDumx pnt1apt mo3iydlm2rmnmo u)trxrxocio1lp   ies;s0texm(r iydlp n net () Drau poo0olxn fciasfa rln sn()teermocoy1fa  li i;()teumio oydom n ivsls) 2rr( onu4tlto feiyt a2raums u0arxoxrcoodomD  ivils)trtr(r3nu4llenlneslt  2rrxr ;u4ope mieiysfa2emn snu)trxoifcoatoate u s t0 2xoiopno1ll elncils s2ua( p;u1tle iietldfaDeanvs u4 eerxrctodlpte ivs (0s2toio3io1ol emnvi t sDrmu o;t4alt ifctysls ra( o t0aleoio3tatlmt livs;s)teumxo nu1apen ivta(fs2urur no1aeeomociydlaDrln p;u)texoifciodfmD lu sl()sexm(mpno4lltnmnvias) Drrumont4tpe moeiltfmDumumont4 eeoir3oatlatrlueo s)teurxr3nu4ll nlieias sDrmxmpoo4tetomfciltfm rm(mo t)tetrmoctadlm  lneil()t2ur(rpiy4ol  lfvsl(f 2rmx  ou4tle iictatlm2uanmon(4treriocoa1fa  lneols)t2urim3oo1op  lfet (fsDta(m oo1tpxnifeildfmDrmumsnt4altrmr iatfmD lnvslt) 2tm(r3iodlmtelietltfa2ur(rpot4tpxnifeias m eanvs;(4arenxo ia1faDr uvs;s)t2uoxopoo4aleemivia(  2rmump;u0oltnmf3tyd mDrau ont0alenxr3totfatrlu olt)setoio3oo1ale  fvi s  Dum( o;t0teenioctasfa ul(vpnt0arxnxfctytomDe ivi (0texoxm3iu4lmtemiet () rrau  ou0olxomfctltlmDeaumsn() renmr iy1fa  lieols setoiopny1optn nci (f 2tm(rpoo4aex mictasla umn on(4artoio3ty1lmtrlies s0tetmxrpnudape  fviltfsDtmxrpou4aet ioeiydls ulums u4 rxnxo3oy1late neo;s0srumim3oy4lpe lncsat s2tmum ;o0teeoiieild a2ra( o ()tlxnio tydlatr uvs () etoir nodameelfcsa() Drru  nt1teeo ocils m2rlu s;(4tltrifcoytfpD  ivo;t seumxo3oo1omt  net (f 2taxr no4alt  oetldlmDran p;u4 exoxrctatomDrai s ()t2xrio3oudllenlfcsat)aDtmurpot1aeeomfciyt sDum( pnt) eerif3todfa e nvol( s2toxopnu1ap emfeil(fsruax onu0apeo fciadfm2rm(ms () leomfcoatfp e nes s0texrxo ny4omt lnet s  ruax  nu0tetn feiaslmDeanvp ()aeeomr3ootlpDeai o;t tetrir oodameemfcslt sDrr(m ou4aeeoio3iytlaDrm( o (0aetrmr3to1lmD livs s)truo(rpiy4alt  fvt (f rtmur oo0tetoiociydlm2rl(monu)trtomf ootom elieo t  exrxmpiudll  lfvtl(faDraurp;t0texomfetas a2rlums;()texnir3tatlm rlneo;t)trxrim oydamenmieils  rrmx p;u0tet iicild mDemn snu4alxnmo3oatopt  u i;( texr(m nu4lpeemfeilsf Dtaxr ;o0oltniocilt a rlnmsnu0aexnmo3ta1om eln s (0t2umimpnudapee fetls)sDtmxmo;o1altn o3iltlm2uau snt0aeenmoctatlat auvsls truoxmpnudoptelicsas) rua(m no4oleomfetld mDumnvpn() rermrcoytlp elnesls  rxr(o ou1lltnmicsl(f 2tmxr ;o0ale  oetat s rlu p t)tlxomo3iodlpDeaneo;t0tetr(r oo4lmte nctltfaDra( p;o4aex mi3iytfm2rmnvs;()tltoxf3iadfaDe ivslt0s2xoim ou1apt  ictlsf rurxmp;u0oex moetaslm rmn snt0 eermr ootoaDr nes t)s2to(m3iy4amt  fvias a2ta(  no0tee mi3ildfm ranmon(0 reoifciadlmtraueo s srxrxr3ny4oleemnvi sfs2umu  ;u1olt mociytfs rln o;u0aleoif oodlpD  u i;s  euoiopno1lltnmnciasf Dtax  ;o0aetomoeiad mDrmumo t0 exnio oadlmtraneo;() exrir3iodlmee fei t  2rru  nt4alto icias m umuvp;u4arxnio3iotfaDe n o t  euoio3iy1amtnmfvilsfaDtmu pnu0oeenmociyd aDrluvont0 rxrmocoo1oatrlu il( setoxo3ny1alt  nci t  Dum( pnu1olx io3tytfsDulu o u4 etoio to1latran o t0trum(o nydlmenlfet ( aDtax p;t4opx miciatlm2emnmon(0 rxomr3iydlpDeai i t0 rto(opoy4lltnlfvs s) rtaxr ;o4opxn iciytls2rm( snt4 eenmfctadomtrlneo;t0 etoxr3no1amee fciasfartrxrp;t0ole ii3iydfsDra(msnu4altrmrciotlm  au i (0trxmxm oo1ope liesa(fs2rr(r nt1opxo fetltfaDraump ()trxrxr iydfa rlieo;t0s2xrirpno1amen ietas sDua( pno4tlt if3tld s ra(vs t0 etrmr3iotlm   uei;s srtoxrpoy1lmenmfes s) 2uaumpnt0aexomoeildls emn pn(4artrio to1fptelivs;s)trtm(opoy4ape  fes t)aDtmur oo0alx if3iysfa2emu p t)areoio oytop e uvo s0texoxm3ou1op  mncsltfa2ta(ro;o4alx ii3tytfaDran o;()texrxrciatlaDe u o () etoio io1apt mneslt  Dum( o;o1olt mieiatfa rmu s u0trtnif3to1fpt an s t s2xrxmpio4opte fes s sDtmuro;o4olto f3tltfa2uln snu0teeoxo oatom rluei t  rtrirpoy4ap nmivta() Durumono4apeomociytls em(mp (4tlenif tytomtrli ol( sexrxr oudaptn fvsls  Dta(r ot0tlt mociat m el(vs;t0 eeomfcia1laDr ueo t0s2tr(r3iu1lp nmfeilt)aDrru  no4ole mo3tysls2el(vo;() rtnmoctatlp ranvo;s teur(r3iy1omtn ncsa(fs2um(mono4alxn ociadfs2umn p;t)aleoxf iadlmtrauvs;s t2trxo no4omen fvilt) 2taxm ;t1aet mo3ilsfmDemu onu)texrxfciadlpt aues t0 rxmimpoo4am  mnct s)aDtmum nu1olxnmi3iys aDuaumo;t4trtrxrcto1oa eauvilt) 2to(mpny1olenmicta(faDtrx onu4aex iietys a ea(monu0 rxrxr3iodfate u ol()t2umio3nodale  fvsatfs2uaxm ;t4apx mfeiasls umnvont)areoxf3tadoa  anvo s)s2tmim3oudllte fes t  Drm( oou1tlto oeilt a2ra( o (0altrif3iadfp e nvols)texrxr3oo1ap emivs sfsrrmx onu4ale ifetlt a ulu o;u4texnifcoy1fpteaivo t0teurxmpnodll  lfvi s srtmxr nu0aetnmfciatlsDuan on(4aexrio3totlptelu ils  eur(r3iy4lmtnliesas arurx  ot0opto i3iyd aDemnvo ()tetoxocto1lpD auei t)srumxm oy1oleelnvils)artr( pno4tpenmi3tldfa2rmnmp;t) rtoxf3totla   i o s)trxr(m ou4al e ics t  rraur ou0oltnmoetytls2rlumo u0 lxnxf3iydlmDeai s;t)sruo(r oo4lp emietas sruaurp;t0olxnmi3iaslmDrmn p;u0 rtnirciytlaDe ueil() 2xoxr nudopenlnet s)aDtmur ;t4oeenmfciltla rlu p t0 exrxf oa1omDr nei;()teumxmpnudaptn ict t  Dtmur ;o0teeoii3iatla umu on()aetoxo iy1lateaieslt0 rumim iy4omt livtlsf Dtm(m nt4tpxo oetltfaDeln o;(4 rtrxf iytlp eanvi;t0texr(o3ny4amte ivs () Dum(r ou1aetn ieild a2rmn p (4artoxrcty1lmt  n o;s)srtrio oodom e neils) Dtm(mpou0apxo feiydfa2rl(ms;u0teerxoctydop e uvi s0 exmim oudapenlnctltfaDtm(moou0oexnmf3iatfa2uln snu0trtoxr3iotoaDrlues;s)trtoim3ny1lleelnvsls  rtr( o;t4tlxn f3tydla2ua(msn(4areoxoctotoaDrlu i s)texrxo oy1openliet s)srrm(r ou1aptnmoeias s ra(mon(4texrxoctytlp  lnei;t0 2xr(mpoo4om nmfei ( a2truroot0tlxomietyt s2ranmp;t4tlxrxo3ta1lm r nvs;t0srxmxmpoydoltnlnvias)artm(m ;o1olen oeiaslm2emn o t0texrio ia1la rau il(0s2tmiopio1oltn nvtas)arrrumpno1tltn ociydfm2ulnvs;u4aeenxo iotopDeaneo s)trtr(r3no4oltnlivtat)sDraxmpno4alt mietlsls2ul(mp ()tlenmr ia1faDr ivi;( t2xmxr3iu1lltemncs s)a2rr(mpno1aee ioeiaslaDea(vs u4artnifcty1lm   u il() 2tmim iy1om   fesatfaruau o;o4texo f3ildfmDel(vp u) lenmo tatfpDelu s;s0trurimpiudolenlnesa()a2urx pnt0aptomo3iyd m2eluvs t) rerxr3iatlat  u slt tetoxm3no4ale mnesa(fsDrm( onu4tet  f3iyt s2emumpnu4tlxrio oodlm r nvi t0seum(o io4apee fvslsfs2raumoot1olxnmo3iytlmDrmu s (4 exnxr oy1omD an ol( s2trxo3nodomt  fetlsfaDrm(  ;u4aeen f3iydfsDuaumo t)altrxoctytfp eluesls0 2to(mpoo1omtn iei ()sDua(r no1tpto ociytfa rauvp (4teeoif3io1fmDran ol(  etrxm3io1olee fvtat  2raumpnt4olxo ieiat aDrau o () rxrxf tadlm eli slt0t2xmxmpiy1omt liesas)a2uaump;u0tpto fciltfs2elu p;t0 lerio3to1faDrauvi;s)s2to(rpnu4alt livtl()sDtau  ;o1olxomf3iltla2ea( s;u0areniocto1faDrli s;t t2xo(m3iodom  mncsltfaDrr( o;u4tetoioctlsfaDrlu pn(0trtrir ia1la  ln s;s)tetrio oodomenlnctas srua(m no0apxo icilt a2raums;u4alxrmocio1omDelues s  exm(r3oo4lltnmnctasfartmx o;o0oleomoeiydlaDum(vpnu0trxrifctydfmt lu s t texr(r nydlm  lfetls sDrru  oo1tpeomo3tyt a ra(mpnt4alenmfcoa1lmDeli o ()t2um(m oudaptn fesls sDuaxro;u1opeomiciyd s2rl(ms;u) eerxf3to1fa ean i t) exmir3no4al emnvsat a2ra(r ou4aleo iciytfa rau sn(0 exomfcoydfmD  ueslt s2xrxm io4alt lfvsas)aDtmxmp;t4apeo iciad mDemu ont4arerxr3to1fa  lnes;s  2to(opiy1am nmnesl(fs2rrxrpot4alx mociatfm2elumpnu)alxrir ty1opDr i ilt) 2urxopoo4opte nvi ()aDrmu  nu0opxnioctyd a2rmumpn(0 ltnxo iydoptrluvi;t t2uoxo3oodoltnlfvs s)aDra( o;u0tlxn ietldfa2rlumonu) etnxf io1fp e n s;s)texmio3oudllenmnet sfa2rmxmoot0tltnifctaslsDrmuvs () leoxo3totfaD lu slt0s2uo(r no4aptn fesa( sDtaxroot4teeo oeiltlm2um( p;t4trtomo tytfa eln i;s srurxm iudlmen icsl( sDtaxmp;o4aet ii3tatfa2ul(vsnt4tltomrcto1laDeluvslt0seur(r3nodapee nvils)a2umur ot1aetn ieiatfa2rm(vp;u4alxnmo oodfateanvi;s)trxm(m oo4lp   fcsa(  2tmumpnt0apeomociaslaDemnms;u0aetoircoy1fp  lieolt)seur(r3nu1lme lfct s) rtaxmpoo1optoifeiyt mDean p u)trxomocty1omDrai ols0 2tm(r iydal  lfet t)arua(mpno0tle  ieild m elnvo ()artnxo oodla eaneols)srumxm iodlmeelnvi s  Durumpnt4tetn f3iat a ulnvo (0 exnxo3iodoat lnes ()setoim nu1lmtnmiet s sruau poo1aee  fetytfa emnvs u0 eenmr oa1fmt  u s ( t2xmio iu1lpe  nvi tf rrmx  no4opt mfetadlsDemn p u)aexomo ia1omD  u olt)texoxo no1omtelnvt sf Drrxro;t1ole ifciat s ea(vs;u4arxnif ootfa e nvo;() 2tmxm3no4altnlfeiltfsDrrur nt4apx ifcilsfa rmnvp;t)trtrxr3oa1optranvolt0s2urim ou1al elnvtlsfaDuaxmont4alenifctyt aDeanmo ()arerxfctytlm e nvolt)sruoxmpny1amte feta( sDurx  nt1tlxnioeilslmDuaums ()trerio3iodfmD ai s t0 rtoxmpoudoptn ncsl()sDtrum ;u1alt iociydfs uln pnt)arerir to1om ranvi;(0srto(r3ou1lpeemnvs (fa2taurp;t0oltnmictys sDra(vo;u)altnxr iadfatrai slt seum(m oy4ll nlfci t  rtr(r oo1tet moeiydfa rln o u0tltoxr3iytoptrau s t teuoxmpiudop   fvslt a2rrurpno0olt mfeiyd a2rlnvo;u)artnxfciytfa r iesls0 exmim ny4ome lfvt s)artaumpot4alt iiciysfa ea(vs;t4aetrifctodopt ln o s s2trxmpiu4lltemivs (fs2rm( pou0tpxomiciatls eln o (0arxrmr3iotoaDe ivo s0 2xoio3nu4amenmnvi s) 2raum nu1tptnioetydfs um(vs u)altrxr3ia1fp eau i;s0 2tmiopiy1lpee ies ( aDrru o;u0tpxoioetasfa2rm(msn(4tlxoir3totoa elnvilt  2xrxr oy1alenmnviasfs2umurp;o4oet  feiat a2eln s () lerxr ia1oat lu o (0trtrxr3no4altn ivt tf Dur( oot0ale  feiydls2em(vp;t4 renxrciadlpDe neo s) rtm(opnu4lpenmicias srtmurono4apx ii3iasfm2ea( s u4 lxrif oadfatrlivslt0 2tm(r3ny4lltnmnvi (f Dum( pnu4tlxo ieiyd s2ua(msn(0teeoxo3iotom  aneo ()s2ur(o no4am nmivtl(fs2rmx p;o1aex ifeias m ranmo;() eerxr ootlmte ieslt0setrir ou4op nmicsat) 2ua(  no4tpeoiiciytla2rmn pnt4tleoxrcio1oaDr nes;(0t2toxo io4om n ncias) 2uru pot1opeo feiyslaDrl(vont0aeenmr tytfaD livsls)srtmirpnu1aptn fei (f Dta(ronu1opt  i3tytfm umnvp;t4aexnmf to1laD aieilt0t2tmiopiudam   ieslsf rtm(mpou1aleoif3tatlaDean s (4 lxnifciotoaDrlueols t2tmxo3oy4ape miviat)s2uau oou0aetnifciysla2umnmp t0tlerirctydfatelnvs (0sexr(mpoy4llte nctlt s2trxmpno4tlto i3ildlaDra(vs () ltrmo3totlaDr iesls)t2trxr3iy1ole  ncsat s2tmumo;u0alxnmo3iadlaDrm(mp t4tlerxr3oytfp   u s;(0srumxr ny1amtelfctat)a2uau  ou4tpxoii3tldls2eau p (0 eeoifciotlmDeauvi t  2to(m io1optn iesa()a2urur ;t0tpenmictls a ranmp;t4 etoio3ia1fmtr ueols0s2xr(m3iu4om nlfci (faDrmx  ;u0olenioetlt mDul(mp ()aeenio iatomt aneilt)s2urxopno4olenlfes s) Dumu  ;u0ape  ietltlsDuauvp u0 exnxrciotopt  n i;t0texrxm3iudlle lncil(  2uaurono4tpe iieilslm2ea(vpnt0alermocoydfmDeanvo s0srtr(mpny1aptelfeilsfsrur( pno0aet ifciatls2ul( s (4aetnmr3ia1fatrluei t seum(o oo1op  liei s a2tm(moot1tpe ifciysla2ulumsnu)trxrxf3oadfmt  ueol( t2tmir3oy1oltnlictls arrru o;u0optoiocildfmDul(vpn(4teenxf ty1fm rlneslt)s2xm(r3no1op nlfetasfaDrm(mp;o1tpeoiietyt a2emuvp;u4texnxrcia1fptranvs;t)srxriopio4olt  ivtatfsruaurp;o4tlxnmf3tysfm rl(msnt0arenmf to1op e uvi t texmxopou1lptelnvt s) 2urxr nu0aex miciyt m ulu pnu)trxoioctytopDr ieil( sruoxr3ny1aptelieil( arrrur ;o1tpx  feiltlmDul( ont4 exrmocto1lmD luvols  rtoim iu4opee fvtat srtaum nu4tlxoii3ilslm2um(vo ()teerxr oatfm elivol()srto(o3iu4lltemfvs ()aDur(mpou0alxomoeild aDum(vs;t0altoxfcoadfm elneols0 2xmir no4oltn ivtas s2rru ono1oexoio3iysfm2el( s t4alxomo oydopD lnvs;s0 2xrxo3nodal  lncs s)arrmurpno4oetnmfeiadla eluvonu0 eenmrctydlmDrlieilt0srtr(o oodamt mivsatfsrua(r nu1oex iietls s2ea(ms (0aeeomf3iydfmD  ivi;(0 2trxopiu1alenlncil()a2tmu poo4optomo3iytfsDem( p u4texrxfcia1lmtelnvolt truoxr io1om e nvtlt)s2uaxrono0alxomo3tls m2emuvp u4texrxf oatfpDr nvslt texrxrpiy4ol e fes tfs2taur ;u4tleo ieiat a2raumo u0 renmr3tydfa e uvo;s) rtm(mpnu1ome lfcsl( a2rau p;t1oetomfeilt sDranmpnt4 etnxf iytfa rluvi (0 2to(opoudopee nei s)arta(mooo4tleomfetyt sDelumo;u4arxnxo iy1fp eln s s)seuoio ou1olt  fcil(f 2umx o;t1open ociydla ulumo t) leomf3oy1lp rli ilt)trtrxo iodoptnlivilsfsruaur oo1texoioeiasfs2el(vs;t0 exoircoy1oaDranvil()tetrxopoo4om elies sf Duaxmoou0tlxnmietadlm2umu sn()aetrmrctatlaD auei;t0s2xr(o iy1alt  feiat) ruaxrpot4aptomfctldfsDeauvpn(4artoir to1oaDe i ils) exmim3iydlpeelncs t)sDumumoot4teeo fciaslsDelu o () etnmr3iatomD au ol( trtriopio1am e nct sfa2ra(  no1tlxn fetysla2rluvo t4arxnxfcoo1lpDrau slt0 2xoxopiudopeeliei t)artaumonu4opx  fcilsfsDemnmp;(4aexrmocia1lpt  uvsls)t2xr(m oy4lpe lici s artax oou0opeo ieilt a uln pnu0tlxnmr oo1fpDelnvi;t  eur(mpny4am n ivslt a2ur(r ;u1optoifciytfmDrlumsnu0alermr oa1fpteai o s  eumio io4op   ncs s)arta(rooo4aetomo3iatfs2em(mon() leniociatfmDr uvsl()srxoirpny1llen neils)aruau pno0aptnifeiatlm eanmp t) exnio oa1la elu ol( setm(o3oy1ol emfvta(f Dua( pot4teeniieiat a ran p;t0alerio tatoaDrlivi () rxm(o iu4omenlfctat) rta( pot4ole moeiltla2rmums;u0trxoxfcoa1om e neo s)setmxmpoodap nmneil(f rrmum no4tpxn o3iyd m ra(mp;u4teerio iy1lmtrlueo;t0sruoxr ou1lptnlfvsa(fa2uau  oo4oexnio3tlsls el( p;t0 lenmo3iy1fpD  ues t0 2uoim iydomen feil( srtmxm nu4aexoioeilsfa ea(msnt0trermrcoy1la eaiei;t0 rurir nu4lpee ivt s) Dra(  nt0alx if3taslm2um(vp t4tlxomfctytfmDrau sls)trumim3ny1lltelivsls  rrr(ront1alxnmo3ilslm elnvsn(0arxoxfcoodlm eaues s t2urio3oydapt mfei sf 2ta(ro;o0tet ioeildfa2ul(ms;(0arerxfciatfmDr neols) eto(o3no1lpeemict t s2taxmo;o4alxomo3iytfs umn p;u4tlxomo3todfat aiei;t s2um(o oo1amtnlicia( srraum no0oet moeiadfaDumnmo;t4aleoxr3tadlmt luvo t0texrio oo4ap nmnesl( aDua( oou1oexn oetyslsDum( pnt0tltnif io1lmDrauvi t0t2trir3ny1op e icias)arrr(mo;o0oexoii3ildfmDuanvs u)trtomrcoa1fp  aies;s0seurirpiydll elfviasfa2uaumpnu1tex mf3tatlm ul(mo t)aeeomf3ty1fm r ivolt0srxoxm iu1lm e nctl(farrmum oo1tltomfeiyt a rm(msnu0 leoxo3iotfpD  ivs;s)tetrxo ou4lm nlfcta()arrmxmono4olxnifeildla2rmumpnu)trxrmf todom eaivs;()t2tm(o oodom emfeilsfa2rr(rpnt0optnii3ilt m elnmp;()aetrmo oodfmD  u i t) rto(opoudomeemiciltfsrrr(mo;o1tlx ifciysls eln p u)tleomfctydop  an i (0srxr(rpnu4oltn ncs t) Dtm(r no4tle ii3tydls ranms;()tlxrmfcoodlmDelnvslt0s2xr(r3nodalte nvt s)srum(rooo0tltn f3tytfm2um(mo;t4 eeomf oatop eln s;s0sexrxm nu1amtn nesas)arurxr ;o0tpto fciytfs2ean p t) etoxf todfptean ol( s2uoxr3oydop emnvi tfsrua(r ;t0aex iociatfa2umnms (4aexnxr3ia1lpDeanes s)s2trio3oydlltn fetasf Durumo;t4aetniociasfm2emumsnt4 eenxr3io1fatrai o;s0 2umim io1ameemncia(f 2ra(mo;o0opxoif3iltfmDuanmo ()tleoxocio1oaDrlies t0 rxoxopnodom n fcsa()aDumxr no0aee mictldfaDuaums;t)artnif3oatlmDeluvil()srtoiopio4opt  icta(fs2raumpot4aet iictat a eluvp;u0 rtoir3oydoa  lnvilt0s2urxm3iydoleemnei ( srtmxmpot0aptniociydls em(vpnu0altoif3oytlpD au o;s)setr(r3oydalee nes t)s2tm(rp;o4opxomfciasls el( p (4aetrmf tydoa raieo;(0 etrxopnu4amtnliesat  rrr(mpnu1alt moeilt sDul( o ()teenxf3io1fa r ivols texrir3nodomen ncilt aDurxro;o0tltnioetatfaDelump;t0 lerxrcty1lmDe u i;t0 exm(rpoudapt mfes tfaDtaurpou1oleo ieiys s2rmnmpnt) lenio tydfmt ai s s0 2umxo3iy1lpe  fetlsfartmxmpnu1texo ieiadlm rau o (0alxnmf3tytlaDe nvi s0srxm(r3nu4ll  lnciat)aDua(mpoo1apxnii3tld a rl(vsnt4 rxnio ootlp  an sls0 2tm(o nodll  lnetl(f Duau  ;o4tpeo ietyd m2ra( pnt)aleoxocty1opDeluvslt0 2xoir nodll emfeslt) rrr( onu1tpt mieiadfa2rl( o;t4 lxnio oy1fp raues s setoxrpiu4apeelnet s) Dtrurp;u4aleoiieiatlm eanmp;() rxnxocoodomD  iesls s2uoxr3iodapeelnciasfsDraxroot4aetomociadfs ea(vs;u0alxoxo totfmt luei;s t2uoxmpiu1omenmicils)sDrmurp;o1apt mi3iad a2ua( p t4arerxrcoodfmteai o s  rtr(r3oo4omtnlnct t  Dua(mooo0oexomieiltfs uanvo t)artoifctodopDr u o (0 2xrxo3iy4apen ieil() rtau  nu4tltn f3iys sDulumo;(0artnmo oy1opD  ivilt0 rtmxo iy4olen ict sfartr(ro;u4tex ioetlslaDeanmpnu)tlxoxrcootlatraivi;s)s2xmxm oo1ll elfetls)arurxm nt4tpe ifctltfsDra( pnt0texrifcootlpDrlieo (  rxoxrpou1op nlietls)aDtmu o;u4ale ifeildlm2ra(vo;u4 renmr3oatla raiei t0setm(r oydlpte feils) Dra(mooo0tpxoiociytfa rlnmsn(4arxniociadomt aivi t)teu
\ No newline at end of file
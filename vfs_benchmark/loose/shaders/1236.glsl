@@ -0,0 +1 @@
+ueolt s2urim3nu1lle  nesa()sDrmu oot1tpx  octysfm2ulnmon(4trtrmf tatlpD lues s teuo(o3oo4lleeliesas)aDum(mpnt4apxo f3iydfm2ulu o (4tlenmr3tydlpt livs t  exmiopiudolee nei ( sDrru ono4olxo i3iatla2uln pn(4aleoifcoytfp eau sl( srxmxm3iudlmt mivia(  2ua(  ;o0aeto octldlmDuanvo;(0alxoxf3ty1lpDeln sl( seuo(o nodole  icta( arum( ooo0apxo feils aDeanvo;u)tetrio3iotoa elneilt)teuriopoy1aptn ictatf Dtaxm nu4oltnii3iydlm elnvo u4 reoir3oadomt ln s () exoiopnydoleelivta( arrm( oot0tltn ociyd a2eln s u0tetrmo oydla e nvs s s2xmir3iy4omee fesatfarrm(moou0apxnmicilsfs2uanvs t0 lermo tytla e ies s  2tm(r3oo4lpe lncs s  2ua(ro;o1ole miciltfaDemu p;()aetomfcoytlpD  nes;s0setm(r oydope lfeslt)arraumpno1apenmoctlsfm ul(vp;(4aexoiocootfmtrln slt0s2xmio ou1ol  lfcsa() Dua( p;u0ape moctltfm rlnmo;u)tltrio3oy1latraneo;(  2uoxm nu1ol   iet s arra( pnu4tptniieiasfmDrmumo t0arerir ootfmD livi s) exrxr3iu1al e ivs (fa2urx pno0tpen ocilt m2elums;u0arxnmo3iatlptr nes s) rxr(rpny1am e icia() rurx pnu0alxnii3iytfsDelnms;u0tetoxr iydopteauvi s0 rxoio no4alen nes s) 2umumo;t4oeto ieiyt a2emn o;()trxrxo3tatfmDrlieo;s0srumxopnu1opt  fcs s)srtru  ;o0oeenmf3ildfaDem(vp t)altnmr3iatfatr uvo;()t2ur(rpiodoptn iesa(f 2raxrpnu0tleoioctadfa2umu o t4artrxrctotlp raiei;()setmxm3iu1lmtn nei (farumxmo;t0aeeoiociatlsDeanvs u)artnir oytlm e i i t)sexrxr iudom e ict tfsDtr(  ou0oltnifetlt s2rl(vsn(4tlerxo3ty1opt livil( srtrim3nu4lle  nvta(fsDrmum ;t1alt mictysfs2rlnvonu4tltomfctadfp eau s t texo(o3ou1ll   ncs tfa2trx  ou4aptoio3tat m rmuvpn(0arxomr totfpDe n s s0tetrxo nu1lltelnet ( s2taump;o4tex mociytfs2umnmsnt0aeermf3ia1fpD luvs s)t2toxo3nodlm emicta()sDta( o;t4tlxoioeiad s umump;(0altnxocoy1lpt anvo ()srtoxo3iy4ome lfvtl(  2tm(rpnu0oexomociadfmDumnms;t0trtoxo ootfpt livilt tetrxo3iy1olenlfctat arta( oou4ope  ictlt m2eauvp;()aeenmr3iytla r i olt0setm(o3nu1om n icias)aDrruroot0opt ioctysfsDem( pn(0tetoir oo1omD  uvs;(0t2xmiopoodlptnlfct ( s2rr(m nt4tlen f3tadfa emump;()tltrmo3iytlptranvo;t0srtrxmpno4ap nlfvt ( a2rmxm ;t4tpxnmi3iad aDuanvpnu0aeeoifciatoa  anvi;t srur(m no4lptn ivsas  Drmumpnu4teeo ieiatfsDrauvp (0 lxoxf oadoaDe uvs;s trxm(mpio1ol nmnvsa(  2tmum ot0opxo octlsfs2ul( s t4trenmr3oodlmDranvils0t2xrimpiydam n ictlt srrrur nt1olxoifciadfs rlnvsn(0altomf oatom r neilt0t2tm(m no4lp e icta( s2rm(r ;u1apxnii3tatfm rmu s;(0alxnxrctatla rluesls sruoxm3oy4amee neia(faDtr(  no1aeeo o3iasfsDrmnvonu0 exnif3iadfmD  nvs;(0 2umxr nodlm e neia(fsrta(r oo0aexoiociasfmDuanms;(0 leomo iotop r ivi s)seuoir3iydlmeelivtatfs2tau p;t1olt  f3tyt m2ra(monu0 exoxr iydfa   i ils trtm(m3iu1ope  nvtls aDtr(moou4tlx ifctytfsDul(ms;u4 lermo io1fateluei ()t2uo(m oy1ole mivtlt srrmxroou0apxnmoeiytls2rlnms;u) exrirctotfm  lueo s0sruoxo3oodom elies tfsDtr(mpot0olt mfeiyd aDean onu)teenmo tadomDean i;s  2xrir oudlmen fcsasfs2rru  no1opxn f3iytfs2rmn p t4trenmfciodfptelu o t0teuoir3iu4alt  ncs ( srrr(m ou1olxoii3tldfmDelumpn()artrxr3ootopt aivo ( setrxm3oudame lfeilt)artmur ;u1aleo octytla2umuvs t)tlxoifciotlm e n sl( teto(m oodol nlnet tfaDtmxmoot1oexnii3ilsfa2rlumpn()alxnmo ty1lm  aivs;(0 2xr(r3nu1aleemnctatfsrrau pou1tlxoiieils s em( pnt0trxrifctadlm elivs t0trtmxr3oodoptnlnctl(farrru  oo1aptnii3tld m uluvo;(0teerifctodlmD ai i (  eumxo oy4alt mfvsas)aDumxmo;o4oltnmfciydlsDelu s u)trermf3iadopDrluvo;(0 ruoim nodll elnctas  rur(mo;o1tpt ifciysla rmnmont) rxnmfciatopDe ueilt srxr(r3oy4ope mnvta() 2tmumoot1opeo f3ildfa rmnmo;u)teeomr oy1fatr nesls0srtmiopiu4op nlfcilsf 2urump;t0tleo iciatfaDumu p (4tltoxo3oodom eluvi;s s2um(rpnudlltemneilt aDraumpot4apenifetltfs2em(mo t4teeomr oytoptrlueo;(  rto(rpnudap nmfcs tfsrrm(rpot1texnmf3iat s2uluvo u0tlxomo ootfa elnes t  2umio nu4altemnet t a2rrxr ou1alxoiiciasfaDuauvp;(0 eermf iytomDran o;( s2xmio iu4lpe lfvtat)srrrurpoo1opx mfeilsls2uaump;(4aetnmoctytomD  u i (0 rtrio3ny4ol emneil(fa2urxr nt0aetoioetaslm rm(vo u)teenxf3tytop eau i t0 2urio3no1lmenmnci s)a2tax oot0olx mfciys s2ra(vo;t) lenmfctytom  lueo;(0sruoimpiudlpeemiei s s2ur(r ;t0tet iocild s2elnvp;(4trtoifcto1lmtr uei;t)s2toio ou4ale lncsa( srraxr nt0oltniictysla2um( pnu0aeeomfcootlpt aieilt0t2um(mpnydome livsls)s2raur ;o0tet mfctas sDumn p u0aleoxo3ootlp ean o;() 2umxo3iy1am   nei tf 2tau  ;u1apx  ictldlm2umums t0 rxomrcoo1oaD  u s;(0 2xmir nudllte net t)a2uaum no0teeoif3ildfa ra(von(4 renxo3oatfa r nvils0t2xmirpnodaptnmfetl() 2ta(mpoo4tpe micilt s ul(mpn(4tleniocoodomteanvs t) rum(m ou1al n fcsas a2rru p;u1olxoiietys s umu pnt4tltnxrcoadopDrlu ols texoxo3no4lptnlieslt s2rmu poo1apxniietyslm2emumpnt) etoif3tadoa  ln il()t2xriopnu4open fvta( aDraxrpnt1oex  fctytfm2ra(vp t4tltomf iotfp  li olt  eurxo nodll nlies ( artmu p;t1tleoif3iat mDrlu s;t)trxnmf3oy1op eanvs;( t2xm(r3oy4ap e fctlt sDraxm ;o1opt  feild a rmuvsnu)trxnmr iadfpDranvol()s2xrxo nu4om nlfet t)sDrm(r ou1tpxnii3tytfm2emnmo;u4tleoif3oodomDrlieilt  euoxmpiydalee fct s a2umx pnt4tpe mictadlsDrmn p;u) eermocoa1fpDraneo;t)srurxr oodlle  ncs sfa2urx oot4tet  o3iydls2ra(monu4altoxf oadfmDr nei;( srum(opoy4amtnlnct tfsDtm(  nt1teen oetadlm ua(vp;t)tetnmo ta1lmtrlnvs;s  2xoimpnudlpt mfeta() Dum(rono1tetn ociyt m eanmp t4 ltrmr iydlm rlnes ()texrirpnu4amen fetlt aDta(rpno0altoioctadlaDum( p;u0 exnmf3oatfa ean s;s)trxrxm3io4optemiviasfa2um(rpnt0oltn i3tldfa eanvo t4alxoir3oytopt lu s;()texm(r nodlm  mfctat a2rru o;t1teeo ieiltlmDul( p;(4altnxf3iotfa  aues;s teuo(opno1lp  lnct ()sDuauro;o1aee moetaslm uanmp;() exoxo to1lm e n slt0 2toio io1opt mneils  rtmuro;t0aeenmo3tldls2rmu s u4 exoif ty1opte uei s  rtmxr iydam nmfcs ( a2um(r ;o1aleoii3ilt m uanvs (0trxrmociytlatr ivs ()trumim io4lme  icil(faDrmu  ;o4altomf3ilt a2rlu o t0tlxoio3oatlmtraieo s trtm(mpiodamtnliei tf Dua( oot4aet  fciatfaDea( o u0trtnir oodla  livs s)t2uo(opoy1lltemfesat) rtau pot4tee mfeiasfmDrm(vp;t0trxrxf3tytfmte nei;(0 2xrim oo1lptelfcs t)a2rrxrpnt4tpt  fetysfaDua(vpnt4arenxo ootoaDraieo s  eurio3ny1ap   ictat)srrmxro;o0aeenmoeiatfm2ea(mo t)arxrxr3ty1lat  nvol(0texm(mpoo1lmenmnci (fa2urx o;u0alxnio3tls sDrl( s u4alerir3ta1fmt livo;s sexrir3iy4amtn icslt artrx pno4oeeoii3ilsfa eln snt)tltnmr ia1fm r uvs;(0s2uo(r3oo4lpt liesas)s2rmxm ;t4altnmfciydfsDum( s (0arenio3oadfptrau s;s)trxmim ny4lmtnlnvtasfsrtaxmp;t0apxnmoeiatfs ulu p;(0aexrmf ootlatrluvo s0 rxo(m oy4lltnlncia(  2uau pno4apx mfciyt mDemu sn(4aeerxf to1fmDraieo;t) exrim3no1lleemieiat srrrx o;t0tex  ieiasfa2elumon() lxoiocoy1oa r uvs;s0srxrxm3oy1ome mivta()arurxmoot4alto f3iadfa2ea(vo u0arxoifcia1omt an il( srtmio3iodlptn nctltfa2umxmpou1oee  oeiasfsDrl(vo;(4 eenmf3iytlmteauvo;s)seuo(rpiy1llt licsas)aDum(mpnt1oleomoeilslm rmu snt0aexoxf oatoateanvslt teuoxrpoo4lleemiei s sDurumont4alxomo3iydlmDrmn p;u4tlxnmrctotlpteli s;t t2urim3no1llee iesl(  2raum ;t1teen fetydlm emumsnu0 etoxfctydoaDr iei;(  2tmxm oodape mfei t  rtrumpot0aex mo3iad aDea(mp;t4 lxoifcoadlmt auvo;(0 eurxo iu4lleemfctat) Dra(roou0tltnif3iyt aDrl( ont0aexoirctatlmt  u o t  rxmim ny4alte nvtl(f Dta(r ;u4olen oetltlsDelnmp;() etoif oodomD li i t  rtmxr3oudll n ieslt aDurxrp;o1apto iciltlaDuan on() rermrctadfm  lu s;s0trumxr oo4ape mfeilt)aDumx  oo0aeto oeild a2ul(ms;u4 eenif3oatlat auvs s0seurim iu4alenmict tfsrumxmo;t1apxoiiciysla el(mont0aexriocoo1fm   u i;t seumxo iy4llt lfct t a2urxrpno1texomoetasfm2ranvo;t)aleoxo3ty1optrln ols  2xm(m3oo1al  lnet sfs2urxro;u1tlxnmoeiaslaDelnmonu4tlerxf3tatfmt aueo (0 etmimpiu4llenmivtat)sDrm(r ou0optnif3tytla rln o t4tleoifciodlmD livi (0s2trim oy4openmfcs ()aDtau  nt1tlxomieildfs rau o u0tltniocoodomtr ies;( t2uo(r nu1ol n fvia(  Dumu pno0aeeomfeiltfs ua( p;u4trtnmo oytlm rli i ( srtr(r iu1opt  nvi (faDtaxm ;u4oexnifciatlm em(vs;(4 exrmo3io1lpDeai i t) exmim3ou1lpee ieta(fs2ur(ro;t4ale  fetltlm emumo;t4arxnxocio1opDeaivils0tetrirpiy4al elfctltfsDrmxr ;t0oleo ictls a el( on(0artrxrciatopDeln ol( seumxmpiodlle livs () rtaurpou1alto oeildfm ra(vsnu0tetnxocio1fp raivol()teum(o iudlp   fcs tf rua(mpou1ape iociadlmDrm(vo ()teenir3oa1laDe ivs ( texmxm3oodlp  lnvtl(fs2ta( p;o0apx mi3ild s uluvp;t0aeerxo3io1fm r n o (0s2xoxopnudamenlfcs ( srrm( pnu1apeomoetyd m ea(vo u4 lermf3ootoat au i s0trumim3nydopt mfesa( srtr(m nu1tptoiictltlmDrmnvs;u4teeoio3oadfpD auvslt) 2xr(mpou1op  mfvtas  rua( pno0olenii3iyt mDrmnvo t0trtnmo oatfmtr ueo ()trtr(opoudopeemietl( aruaumono1tlxn fetys s2umnvo t0trtnxf oa1fm r ueol()seumio iu1omtemfes () rtmu  ;o1tptnmo3iltfaDemu snu4 reomr3todlpteanvilt0 rxmxo ou4om emfvsas)aDumurpno1tlt ii3tlsfs2umuvo u0 rxoxo3iy1fmteln s;( trtr(opou1ol  lici (farururonu4openmo3tysfa umnmsnu)arxnxrcty1fm e ivols  exmir3oodol emivs t  Dra(mo;u0opxniiciytfm rl( pnu4aexrxr3tytomtr ieil() 2xmxm3oo1ome  ivtatf Durur ;t0tptomociatfaDemnmo u0 eeoif oa1lpteaneolt0trtmxr nodlpt lfci s sDrm(m ;u4olxoiieiad a rlnmpnt4tlerxr3tadopDeli olt) 2xr(mpiu1lmenlicilsfsDtm(rono4ape mo3ild a rm(mpnt4artomf to1fpD lues s  2uo(r no1lmenlfciat)arurxmo;u0opxo feiyslm2rmnmo;u)artnif3tydfa r ies;(  2toiopiydal nmnetlt)a2uax pnt0tlto oetas s rm(vpnt0artoio iotfpDr uvi s)sexm(o3oudlptnlfvsat a2rmx  oo4tlx  ieiatlm2emu o (4texoxocoa1fm  livs s0s2triopiy4al  mnei (f Dtmurpot0ole mfctatfmDrmnvp;t0 lxnmo ty1omDelnvs (  2trirpiydamt  fes (faDumumpou4tltnmoetldla um(vsnt0 lxrmr3oa1lat li o;() 2to(o oodapte netas)sDtaumo;t1tet ifciad m2el(msnu) rtnmr3ia1opD luvo t0 rurim3iu1lpeemivtatfsDtr( p;u1tpen o3ilsfs rlu s;u) exnxfctotlpt  i ols0sruo(r3no4omeelivt sf rrmurpnt0apt if3ild a2umu o;t) ltoxr ia1fmDeau s;s  exmxr3iydlpt mfctas sDurur nu0olen i3ias s el(monu) ltomo3ia1fa  anei;s)srurio iy4opeelfvi s a2ur(r ;o4ope mfcias mDemu o;t)tlxnxf3oa1lp  an s t trtrir oydlptn fcilsf 2uax  ;u4aeenioetysls ra(vo t0 exrmo3todfmte uvs;(0teurxrpnu1al emfvs (f rrrumono4olxniociydlm2elnvp u0 lenxo3oytoa eanei;(0t2trxr no4ll  lnvsasfaDum( o;u4oexnmi3tasfmDuln pn(4teeomf3oadop  ln s;s0 etmxm no1omeemictl(fsrua( o;t1aet  ictat m emnmsnu0texrxf ia1fptr n i;t0texo(mpiy4omt  ivil(fsDtaxr ;u1tpto f3iasfa ra(vo;u0teenmo oatfmtrlnvols0t2xmir iodal   fvs s)s2ua(m nt1oee  i3iyd s2rmn o u)altrxfciytoat livi;(0s2to(opnu4ol  lneiat srtr(  ;t4tpen oeiysfm2rl( sn(4 rtomo iy1lmD aueil()s2uo(r iy4lmeemnesl(fsrtau  ;u0tptomo3ildlm um( snu4aetomrcoatfmDraiei t srxo(o nodopte ncsat sDra(r oo4tptomocildls umnvo u0tlerxo3oodfp  auvol( srumxm3iodop nlnvs ( a2rrxrpot1olx mf3ilsla2em(mo u)aetoxfctytoa e nvolt)tetriopno1op  mivtl( sDtaur no0tpx ii3tys aDuln snt4tltoir3oodopteaivs s truoxr iydapenmieil(  rtaxrp;t4apt  ieiadls rau p;u0 rtoxo3oo1fa elnei s  euoir3oo4lltemneil() rum(mpno4oexoii3iat aDeanvsnu)trxrmrctadlmt livo;s0 2xmio oo4aptnlies s s2rmx ooo4oeenii3iysla2uan sn()aetomf tatlmD  neils) rxoxopoo4altelnesa( sDraxr ou1olxo icilslaDrln o;u)altrxf ia1lpD lneo t  rumiopno4altnlneia( sDtrurooo4altn feiadlm2umnmp () rxrmr todlatraieo;(  euoxm3oo1lle  ncsat)arumu  ot0tlx mietytls2umuvs;t4alenmfcto1fmDeaueil()s2uoxmpoo1oltnlfcslt) rurxront1aeeo i3iltfm ranmo;t4 etrio iotfmD  neols t2tmxo iu4ameemfci s) rtmx ooo1tlxnmoeiyt a2emnvont)trxriocio1om raivo;(0t2xr(opnu1am nlnvtatf Dumx  ;u1apxnifcildlmDraumsn(4aexomf3iydomteaiei t0srum(opoo1apen nvils aDua(r ;u0aetomfeiydlm2el(ms ()arxnmfcoadfmtelu s t trxmio oo4op nmfvils aDur( poo1oexoio3iyt a umu sn(0tetnmf3ia1oaDr nvol(0seumiopio1optnlictlt  rumxmonu4oex mf3tlsfmDrmnvo;t4trtoio to1lp rln ilt0sexoxm nu4ole mfetls)a2ur(mpno4tptn i3iydla2elu onu4alxomociydop r i s s s2trxr3ou4op nmiviat)s2rm( p;t1oltnmf3ilsfa um( s;()tetnmr oytfatranei s)s2to(o iydamtnlnvia(  Duru o;t1tlxnifeiasfm2ra(vont0aeenmo3oatla elnvols) rum(o3io1al n fvias  2rmum no1tlxoifciys m2eanvpnt4altrxr oydfmteaieslt srtrirpoudlpe mivilsfa2uau pou0opxoifciyt s2el(ms (0 lxoxfcia1la eaueil()s2tr(r3oodom e ivil( arraxm nt0ape mf3ilslmDrlums t0 rtrifctadom elu ils) 2xrim no1amenmies (fs2tm(m ou4oexo ocilt s2ra(vp;u4tetoif3tadfp r nvo;t trtm(m3nodalee icias) 2rrxmp;u0tpxo oeiyt sDumn pnt) eeoxr3iytfmtr n i s)trtrio3nu4am nlietatfsDua(mooo1tet iieiasls el(msnu4alxrio3oatfa  ai o;(0seumxm iu4alen ict () rumx p;o4olt  o3iat sDeauvonu0 eeomr oatlp r ivi;(0 2uoiopoodolte fcsa(f 2tr( p;u4altniictyd s eanvsnt)altomocty1lpteln i;t0 exmim3oodlpt mies sfarum(rpno4olxo ictlt m ean ont0arxrxo oytfatrlivi;s  exo(opio1apt  neia(f rtm(  ot1oetoii3ils sDrlums;() exniocoatfm e uvs s0 rxo(r nu1omtnmneils)s2um(mooo4oetnmoctlsla emu o;u)trxrxf iy1fpDe nvols0 rtmim3ou1lm nlfvs s)srumx p;t1alto oeild aDemn sn(0 lxniocoodfp  li o;s0 exrimpno1om emfeslsf Durum ;t0olxnmfetysls ean onu4 rtnifctadlaDeli s t) exmxm3iy1lle mict t  rrmuroou4tle  feiydls ulumpn(0treomr3oytopDeaivol( srurxm iu1ll nmiet tfaruauront0olxo i3tad sDrlu p (4tetomr3ia1oa  auvols srtoxm3ny1om  lfeil()sDrrx o;u4aleoifeiyd aDulnmo;()trtnxo oytomtelieo;s0 etriopio4ll n neil( sDraxrpou4aptnmfeils s2ulnvonu)alerio3iotfaDe i ols0 2tmim io1ap nlnvils srrrumpou4oltomiciltfm2um(vo;u4aetnmrciotfpD  nvi t)t2xoxo ny1lpeelfvtl(f rua(  no1olxoifeiatla uan p u)arxnmociadfmDr neils) 2xr(rpiydop emivsa(  Dumumpnu1aetnii3iydfm2ranvs;u)teeoxocoydfm  lnei s tetrxo iodom nmnvt tf rrrump;t0tpto ietltfa rm(mp;u)areomociytfa r u i s) rxmirpiu1olen fei t  2trx o;t1tpe  feiytfm2emnvpnt)alxnmfcoy1fptr ivsls)teuoir nu4omeemfeta( s2ua(  oo1oee mocils a2ranvs t0 exoio3iotfp   uvil(  exrimpiu4alt  fes ()s2ur( pnt0ope miciltfa umu o;t0trxrxrcoa1lp r uvil( srtmiopnu4olt lfeiat s2ra(mo;t0tptoiictadlm um( ont)aetoir ia1fp  lnvo s)s2xo(m iydapeelncs () Drmx o;u0oleoioeiyslm2ua( o;t4texrxf ia1oaD  nvol(0t2urxopoy4lpeemictatf 2ra(mono1opt  i3tadfa em( pnt0 rtrxr oo1fa raueslt0s2uoirpny4om nmict tfa2umurpot1tee if3iysfs ulnvsnt0trtrxo ty1la rli sl(0sexrio iu1op   feilt arumx  no1tlto i3iatlmDrl( o;t4teeniocto1opDeaivs ( t2xoxrpnu1ope  ictls s2tau ono0apt ioeildlaDem(vpn(0arermf3oydlpteln olt0s2toiopou4ame  nviat  rumuro;u4teeo fctydfmDra(vsn(4trenir iy1lmtelieo;t)t2uo(opiu4llt  ics tfa2umur ;o0apt ifeilsfs rm(vo;(0trermrctadoatraiei t s2xmirpnydol  mietls a2umxmo;u4aeenii3tysls elumsnt4aeenxo oadfpt  nvs () rxoxr3oo4apenmfet s  Dumum no0oet  oetldfm2ean o u)tltnxr3todlm  aivsl(0 rtmxmpou4lmte ici sfsrrrxmp;u0alt mfciad aDrl(vp t4tltoir3tatlmteaiesl(  rxm(m3iodlpe lictat)s2uru  nu0aet mi3iasfs ul(vo;t4tlxoxf3oa1fat  u o () exrir nodop  mfetlsf rtmuro;t1aleo iciysls2uau snt)aetoxr oodlm  lueil(  exmir3nudlp  lnciatfsDtmxm ;u4teenifctltls2um(mp t)teenif3to1faDeli i;s) 2xm(o3iy1llee ict (  rtaxmo;o4oleo ociadls2em( p;t4altomo iydoat  ueilt0texrim iy1amen icsl(fartrumoot0tpeomoctlslm2uan p (0 exoxf3iydoptr n sl() rtmim3no4ome mfes t)aDuaum oo1alenio3tadls um(vo;()tetrir totfm  auvo;(0teumxr3oo1lpt mieiat) 2tru pou4opt miciysfs2umu pn(0 lerxr3totfp eaneo t0sexr(o3ou1op   ivtat) Dta(moou1tlt  i3iyslm ul(mp t4artnir ty1late uvslt)s2toiopnu1al nlnci s s2umx  nt0olxomieiltls2rlnvont0trerif oo1fatr uesls t2toio no4am e nci t  Dtmxmp;t1tetnmoctyd aDuauvo (0tltoif3tatfmt  i slt) etm(r3iy4ap   ivslt sDtax  oo4oltnmoctysfs2ua(vpnt4tlxnxf3tytoa raivsl(0 rtrim nydam n fctl()aDua(r ;t4ape iociatlsDelu p u0trerif3iadlmD anes;t) exm(mpiu1lpt licils arua(r nu4alen oeiydfaDrm(mp;t0 etrmr3to1la r i s s  exmim iudomenmfcsa(  rumu p;u4alxnio3iyslmDul(mont4 lxrxfciodlmDeai i;t0teum(opiydome lies sfa2umurpnt0alxo feiat s ulnvsnu)trxoif3iotfmt luvi;s0 rurirpoydopen icsasf 2uaxrp;u0tetnmfeiytlm2emn o u4tlxnmfcty1lp  aivs t) rtr(opoo4lpen ivi s aruaur ou0tpt miciyt s umu p (4teenmo3oadfpDrai s;s sexoimpny1amenlies t)s2rmxrpno0aleo ociyslaDumn s;(4tleoxr3tydlmD aivol( t2xr(opiudom nlfet ()a2urx p;o1optnmictat sDemu snu4treoxr3tatoa r n sls  etr(r oodapt mnet t  2umu o;t0tltoifeiydfs2ua( on(4trerif oo1laDran ilt s2xmxopoodlm emictlt)arrr(m ;t0oet mo3tyt s2ra(vpnu0artnmocoadlpDean s t)sexrxm3oo1ape mncta()sDum(m ;u0tpxoifciltlm2ulu p (4 rxoir3tytfa rlnes;t srumio io4opte ivias)srtmu oou1tpxomicild m2rmnvo;u4 lenmr3tatomte ivo s0trto(r3iodll elictas  2trxr nt4tetnmf3iydfm2eaumo t)tltoxr oo1fpDrlivi t0sexoxr nudal  mncilt)a2rax p;o1oleomfeiatls eanvs u)tlxnio totomDeaneo;t  rur(m ou1om  mfvta(fa2tmxrp;t4tle  octyslm2rmnmpnu4 rtnio iytla eli ils srxo(rpou1lp  lfci tfsDtmum ;u0apxoifcild s rau p;t4 eenmrcty1fmDeau olt0 exm(r3oo1ome  iesat)aDtmx  ;o0alxo fetysls eln sn(4alenxf3oodlmteaies t0sruoir3io1omtemfeia(fa2ta(  ou0aee io3tlslm umn p u0 eenif tatfa eluvol(  rxoxr iydlmt licsls) rua(mpou0tleo octlslsDul(mp t0 lxrmocto1opD  ueo;s  rxmxr iydlptnlfes tf Dta(mo;o1aetoiietas m2uanvp;u)altoxocoytfm elnei;t0s2uoxm3iy4apenmieilsfsrtaumpou0oltnmiciadlaDelumo u4treomo3to1op  au s s)teuoxopoodape lieslsfs2rax oou0tee if3ildlm2umnmonu0tlxnmr3tadfptean i;t)trumxm3iydal nlfciltf Durxr ;t1openmoeiysfa um( s;t0areoxf iy1lpD  ivo (0srxrim iy4ale lfetlt sDtmx ont4oee miciltlmDumuvo u4tltrir oadla rlneslt)t2toio oydoltnlfcia()arrmur ;t1apxnmo3tyt sDrauvsn(4 lerif ootfaD lieol( s2trirpoo4lptnmnci sfs2tm(rpot4aexnio3iys a2uauvo (4alxnmo to1fa eln s t seurim3iudam  mfciatf rtr(r ;t4opxnmietas s uln snt)tlxrmo oy1lmDe uvs;t sruoir3ny4omenmnvias  rurxr oo1opeoio3tlslsDulu onu)teeoioctatoat auvs (0 eumiopiydol   fvi sfaDtmxm ou4openmiciydfmDuan o u) etoxfcoadlmteluvo t) 2to(o3nu4am elnetas sDtr( ont1oet mf3iaslm2ranmo u) exrmfcoydfm  aies (0trtoxr3oy1lmtn ncia()aDtmu pnt0alt  oeiys m rlumont)tlenxf3to1fa  auvo;(0trxoxmpoo4lpe lfcs tf 2rmxro;o4oltnifctldfsDelnms u)arxoif ia1lmDe ivo (0srxmio nu4lp  lfvtl(fsDraump;t1oexomociydla em(vo t)teermo tatoateln i s srtoimpoo1omeemncia( a2umxmpnt0oex  ieiytfs2ulnvp (0aeeoxf3to1fm  lnei t0 eto(r3no4apenmnvsa( srra( p;u0optnmo3iytla2ulump t4 lermf3iotfaD  i o;t0 2xoir3oudal n ics sfsDta( ooo4ope micils s2em( ont0tltoxociatoptr u s;()truoxrpoodolenliet sfsruaur oo4texoioctyslm2ulu s;(0alxoxr3iodoa  aivi;(  2uoio oudll  mneia()aDraumont0ape io3iyd a2rln o;u4aetnxf3io1oatelneo s  rtr(rpnodam e nvi ()aDua(mpnu1aetniociysls ulumsn()arxrxr iydopD an i;s0sruoxm3io1lm  lfcsl(  2rr( o;o4oexn o3iadlm2eanvsnt)trerxfcoadlmD an o;t seur(rpnu1apt mfvi t) 2raurpnt0teeomieiadls2raums;(4aexoircoo1fmD aiei;(  rtm(r3io4op nlfcils)artmuroou4tltomfctydlm2elump;u0tetoxrctadfpt  ueol( srum(mpoo4aptelfetls)arum(r ;o0ape iietad a ua(vpnt4tlxrirctadop rauei;t)t2xm(mpnodomtemnet s) Dtrxrooo1texnmf3tas mDuauvo;t0 leomr oydoaD aivs s s2xmxrpoudlpte nct ( s2uaxm no1tex ii3ilt aDel(vpnt4tlenmo3ootoaD aieo;(0seurxrpiu4ope lies ()sDtru poo1opeoio3iydls uln o;t0artoio3iy1lmDrli o s  exr(rpoodlp   fvtl() 2rmxrpot0tlt  octasla rmn s u)aeeomr3io1fa  livo ( s2xr(o nydome mnvia(fa2tr(r ;t4tlen f3iltls rln p;()tetomf3iadomDe iesl(0t2tr(mpnu4op nmfvsls)srua(mpot1opxnif3tls s2rm(ms t0tltrmf iydopD lues t0 exoim3oo1lpte fcsls)sDumxr nt0tpt mf3iyd sDrmn s t0trtnmo3iydlm  livs;s) 2xr(m3iy1opeemnciltf Dtrx pnu4tpe iociyslm2emn s u)aeenmociatlaDe ivs;(  eumxo3nudopee fct sf 2rr(ronu0tlxnmieiatlmDem(msn()trtrio oatfa  ln i t0sruoxo ny4lmee ietlt)sDuax  nu1tlenii3tyd a2emn p (4 ltrxf3oadopDr nvs s) etoim3iu4lpeelieia(f Dtm(mpot1altnmoeiyt s ulumo;u0areoxf3ootlate n o;t0 rto(r3iydomeemict t sDrr( pno0aet io3iltfsDuaumpnu4 eeomo tydfaDranvol(0s2uoxm3nu1ale  nvtat s2rmum ;t1aptn iciyslmDeanms () etoxrcia1fptraneo ()trtrxrpoodopen fei s aDrmurono1tle miciat s uaump;t0trxrxo ia1fmt aivs s trurio3nudap nliesl(fsrrr(m nt0tpe ifcilt s umu s ()trtnmociatfm rai o t0 exm(opoodlltnmivi t sruaxmoou1aexn iciltls2rmuvp;()tlxrmr3tatopte uvilt tetmxo nydop e fctl(fsrur(  nt4tpt ifctydls2ran o;u) lenmr oadfatr u i;t0 rumxo3ou4amt  nvs tf Dtm(monu4oltn icias sDrl(ms u0trtomf tadoaD auvs s  2tr(rpoo1optnmiei s  rtax  ou0aexoiicild a em(vo;u)tlxrmo3iy1lpteluvi (0t2xmimpio1lpenmfvtat)sDrmxm ou0olen o3ils s umnvo (0 eeoif oytfpte ivi;t)trxmiopio1amtn icslsf 2umurp;o1aexnmoeiltfa rlnmp;t4 lxrio oo1om raneo;s) rum(m nu1omtnmnesasfs2umumpoo4oeenmfeiatlm eln p;t0aexnioctodfm e ivsl(0texoir oo4ale lnci tf 2rrumo;o0oltnmi3iltfmDum(mp;u0artoif iy1fpte uvo;t0t2uoxmpio1oleemnvi ( sDra( pot0aptnif3tytlmDum( pnu)trxrmr3tatlatraues;t0t2xo(mpnudomeelfvtas arum( oou4oeeniicils mDrm( p;u4aeermrciy1lptraieo;(  rtmim ou1am nlnvi (fsDumumpou4alxoif3iat mDrl( s (4 etnio totlptean olt0srtr(r iudolt  ics (fs2rr(m ot4oeeo ociatfaDranmp (0 rxoiocia1om  au s s)s2xoxrpny4op elneil() Drmx  nu1alt moeiat mDea(vo;u4 exnmrcoytlmDrluvilt) exoxo3nu1om emnesat s2tr(moot1oex mf3taslsDel( p t)aexomr3iytfmDelueo;( setm(m ou1aptelfctlsfsDrau p;t0aexnioeiys sDel( s t0 rxoir3oytlaDrlneol() 2tmir iodlle  nvi sfsrrmum ;u0teenio3iysla2rl(vp;u0 lxnmr3iytlmtr ivs;t0srtrirpoo4lltn netl(fsrta(mont4aee  ietyd sDrauvpnu4alerir oydoatran s;s0 etoim3iodlltelnet ()aDtm(ro;o4optomoetls m eluvp ()arxoxo iatlm rauvo;(0setm(o iy1am  mies tf rtrur ;t4aeeoioeiatls ean onu) rxrxo tadlp r u s s)trto(mpiu1aptnlictl(f rtau  ou0alxnmoctad a2uanvs () eermo3iy1fate u s ()srtrir oy4ap  lnvtl(  rta(m ou1tlx  feils aDuanmo t0arenmr3iotfmDr i s;(0 exoimpio4lm emfes ( srrm(rp;o0aeeo iciysla rmnvpnu4altrxr iy1fmt  iesl(0 rxrxrpio4olt lncsa(  rraurpot0oltnmietys a2el(vo (4 ltnxociadom ranvo t)s2xoxo nydlpen fciltfs2taur ot1alt  oeiat aDea(vp u)teeoxr iytop eaivslt  rxr(m3iu1omte fviasfsruaumpnt1alxn iciydfs2umnmont)tetrmfctodoa raneo;(0trtrio3oy1lmteliet t  2rm(roou4oltomoeiydlm uaumo;u4altoxr3oydopDrlnvo s setoirpoydamtemfci sfsDrau ooo0tpe mieilt m uan pnt4 ltnxrciotop e nvol(0 etmxm ou4ameemfct t)sruaum ou4aexniietytlaDuau ont4teeoxrcio1fa eaivi s  2toiopoo4amt mnci s) Drm(mo;t4ole iiciltlm2rmu s u0 exoxfcoatfa  livolt0 rtmxr3oy4al  lictasfs2trxrp;u4tpeo feiyd m rlums u) rtoircia1fmte nes;(  rxmxr3io1oleemnvsls) 2urx pno4teen o3tyt m rmums;u)tlxnif iodfa   nei;t) rtmir iu1amtnlies t)s2rr(m ou4open fctls s umn s () lerifciy1opDeaueils)teumio3ou4ap nmnesl(f Dtr(r ;o1olxn fciad a2rau p;u)tetnxf3totoaD lnvo s)s2toim3oy4aptelfvs ()a2ta(monu0olx micildls2elnms ()altrxocoo1om   ues;(0 rtrxmpou4ale mncsatf Duru  ;o1oet  fcild sDem( s (0tltrxf3oo1fpDeaneslt s2xmiopoo4om n iviat  Duaur nt4oltn iciyd sDean ont4 ltoxf ta1fmDrlnvo t0trxrio no1apte nvt ( srrax  ou4opto o3iat m2rlu snu4 rtnir3oytlmtr u slt0sruoxo3iy1altnmiviltfsrraxronu0olxnmietls s em( s;t) rxrirciydfm eln i;(  etoim oo1lm   icsat) rra(r ot0oee  iciadfaDulums;(4 ltrmr3oo1laDranvsls)srxoir3oo1lp elics s sDtrxr no0aee moeiadla2ra( p;(0 ltnmo3ta1omDeau o (  2tm(opiu4amt lnvi s)arurx  ;u0olx moeiatfs2rlu o;t4aetoxo ootlm r neols  eto(rpno1amee iesat  rrrurp;o4tltnmf3iadfs2el( onu) rxoio3iodfa e nei s0 ruoiopny1opt  feilsfsDraxmp;u1tet io3tadfmDrmnvo;u0texnirctydfmDrluvo (0setmxr3iydameelncsas) 2rm(  ;t4oex mi3iatfs2ranmpnt0aeermo3iadfmt  iei;t0 rxrxr3iydalt liei t sDtau o;t0teenmfctatls2emu pn(0 lenmo totfate nvilt) 2uoxmpnu1ame micia(fartr( ooo1opxomi3tys sDumn p;t4 lxnmrciadlaD ln i s seuriopnu1lpe  nviasfarraxmonu0tetn f3ilsfm um( pnt0tlenif3tadoateliei;()setoxm3oy4ll n nesa( s2urur nu4ape iieiysfsDulnmpn(4trenio oa1omDrluvolt  2xmxr iy1lm  mivt ( srtm(r no0tpto octls aDeaumsnu0 rerioctydfmteau ols)trtr(rpnu4lltnmnvs (f Dtm(mpot0teeomi3iltfa ul( s;t4tltnio3tytfp r ues t0 euo(mpoudal emfcs s)aDtru onu4tleomieiydla2elumpn(0aeermf3iadfmDeanvo;s trxrxmpoodlpenmivsatfaDrmump;t1tleoifciad m rl(vo;t) eeomf3todoaDrli o;t) eurim3oy1amenmicsls) 2tm( onu4olxomietld s uluvo;u4teerxrciodlatrlnvs t texo(m no1lm nmies t  rtauroou4tlx micild s2emuvpn(4 lxrmr iydop  liei;t) 2tr(opno4aptemivs s arrrumo;o4oetoifeiyt sDeanvp;(0teenmfcoadfp raues;t0 2urxr nydlm nlfeilsfs2uaxro;u4oltoioeiltla elnmp;u0tlxrxrcoy1omtrlnvs;s0teurir iy1lleelfvta(  Dua(rooo4oetomo3iyd aDrau o;() ltoio oa1laDelivi;s0srxmxr3nodop  mnctltfarrmxrooo4apxoiictat m2ul(mont0 rxrxf3oydfp   n sl(0 rxm(mpiodap elivia(f Dtrum ;t4texn ietytlm2ul( o () reomr oytlpte n i ( s2toio3io1olte fctatfaDtm(r ot1aee mfciasls rl(mont4areoio3iotlptelnvi;(0sruo(opiy4lmenmnesa(fa2umur ;u4tlen oetlsfs2uluvonu) rtnif iytfp rli s;s0srtoimpiy1ll  lnesas  Dtr(r ;u4tee ioetytlm2ranmsn(4 lxrircio1op r nvsls srxm(m iudll  lfesa( s2uru pno0aexo octat m emuvpn(4arxoircia1oa  lu o s s2tmxr iy1ole miet s arua(rpnt4tlt ioetlsfs2rlu onu)arerio3oy1laDrli s s  rxrxm3iudamtn ivsasfs2rrumpou0tpxnifctysfs ra(mo (0 ltnmrcoodla e n i;(  2urxm3io1ameemfct ( aDurur nt0aexomfetyd a ua(msn()aleoio iatoaD lu sl(  rxrim3iydap nlnetl()sDraumpnu0tlxnif3ildfs2elu p u0altoxfctodfmDeanei;s)sexo(m iu4ale lies () Dtrurpno1oexn ieiytfa rlu s t0aetriocoo1la r i i s0seumxrpno4lmtelivt t)sDrmu  ;u1altomiciyt a2elnvo t0aetnxo3to1opte i ils srtrio oo4apeelnesl( aDum(mooo0aee mo3iysfsDrl(ms;(0teeoxo3iadomDrau slt) 2xo(o3oodom n ictlsf rtau oou1teeoioeiytla el(ms;u) rtnxo3oytfm elieo;t trxmxopiy1lltemnetatfs2ur( o;t4tlx  ociydlaDemuvp (4treomrcoa1la e nvilt0 rumxm iudlmtnmfcs ( s2trurp;t0texnmocils m uaump (4 etoifcio1opD  i ol()t2tm(m3oo1opeelnvs t srraxrp;o1aet mieiltfmDemnms;(4texoif3todlp   ieilt  rxm(r3iydamtelfvsasf Drmx  nt1opt  i3tldfs ra( s u4aleomrciotfa eluvils t2tmim oudamt miei t  Dururpno0texnmoetltlsDumums () rxrxf3iatlpDeaies;s0srtmxr3ny4om n nesa()aDta(r ;u1teenmfeiyd a2ua(vp (4altomo3tadla elnvs t0sexoim3oy1omen
\ No newline at end of file
@@ -0,0 +1 @@
+nei (  rto(o3oo1am e nei ()aDta(r oo0openif3iaslm2ua( s;u4trxrxo3oo1fa eaies;t0seum(m iy4ole  fct t srrmx oot4apxo ocias aDum(von()aexnxf3tatfatrln i t)sexo(rpnudap eliesa(f ruaxrpnt4optomi3iadfm rlnvo () lenmo3io1lm e u i;() rxm(opiy4lptnlfvslsf 2um(mpot4tlx  ictlt mDum(mo t)areoxrciatom   nvslt)teuoio oo1aptn feilt a2urxm oo4oetoiictltfa2emu p;u4areoxf tadfa eanei;s0srtoxr3iu4lpt mfviltfa2urx  ;u4altoifciat sDean onu4aleoxr3oytlm elneo s trxmio nodole  nvsas s2rmxroou1tpt io3tyd a rmnvpn(0tlerif tatoat au i t)trtmirpno4alt  fcil( a2tax ono0tpxo iciydfm2uanvsn(4trermoctydlp  luvils tetr(r ou1lle mncs t) Drmuro;u4aptnioetyslaDul(mo u4tetrxrcoytfpDe n ilt0 rumir ou4om n nei () rumxm ;o0oetomfetyslm2emnmp t4trxoifctytfatelieslt)s2um(m oydom emnci s  2rr(r ;t0aee moctyt s2ulu o;(4 rtoxrctadfmDeanvols)trurxm3no1olt lnci tf Dumxrp;o4olxo feiydls ea(vont4 leoir3iydfateauvs;s trtm(rpou1alt miesltf rururooo1oeeoif3tytfaDrau s;(0aexrir iy1fat  iei;t  eurim oo1open fctlt)sDtm(mp;o4openiietytfm uaums t0tetnmo iydoatr uvo;s0 euoxr ny4ap   ici tf rta(m nt4tptniieias a ea(mp t4trxoif3oy1fptelu slt trtmxopny1omtelnesa()aDtmu  ot4tpeoifeiat a eanmp;u) rtnircio1lmDranvs;s)seurirpoy1lpe mfvtatfaDrru o;o4tlxn ictat s ulumo;t) rxnmr3tatlmt lu i;() rtrirpiy1lpt  icias  rrmx  ot4oltn ieilsfm rmnvo;u0artrxo3todfateluvils)teur(m3ou1lltn ivils) rtrx pot0alt  f3iat sDem(vp;u0tetrxf todlpt lnei;s trxoxrpou1lmte nesas  rua( pou1oltnioetydls rmnvonu0alxrmoctodlate nes s) rxoxr nudlmeemicta() Drau oou4teeoiicilsfa rm(vp;t)trxnmocoa1fmDeaieo;t)teuoiopnu1omte ncsas) Dum( p;u4tex  fcildfaDeanms;t) rxrmf3oodlp rlnvi;s0srtrxopiydomtemicia( srtmu p;t1tetnio3ildfs2umu s ()aeeomo3tatom rauvs;()texrir3ny1amee fet t sruau pno4olxn oeilslm2eauvs;u0aeenmo tydlmDrauvo;t)sruoim3io4amt  ietlsfs2urxr ou4altniiciatlsDeau pn()alermr tytlmDe u i;()sexm(r3no1lmee ncia()sruaum ou0tlenioetldfs um(vs (0teenmf3ty1oa e i s s srum(o nudoptn fvia( arrm(mo;t4tlxn feiasls2rau onu0 lenmo3iotfm elueslt  exoxm oo4lmt micia(fsrurxrp;u0altniicildfa2ulu onu)aetomrcoytfate neslt s2uoirpou4altelfesl()aDtrxmo;t1opt mo3tytlsDumu onu0tltrmr oadfa e ieslt0 2xmxrpiy1lp  lfvsa( aDtrxmont1oleomiciatfmDumnvp (0 exniocootlpt  uvs;t  2ur(m3io4llte netlsfaDuau  ;o1opeo o3tydla2emump u) rxnioctodlaDrlnvi;t)srtmxopio4op elfcs tfsDtmxr ;o4alxnifeiatla umu s;t)areoxf ta1optrlu sls) 2tm(m3oy1lleemnci (fsDrrxmpnt0aex mfeiytls umn s u) rxrxo3ty1fmt  iei (0sexmir3iu1lp nlfci (faruaxrp;o1tetoio3iyslm2ul(mpnt4aleoxr3iodlmDrliei;( t2tr(opiu1am e feiasf 2umumoou0tex mietatls uau p;t0aeenmrcoodfmtraivs (0t2trio nydomt lfvtl(farta(rpnu4olxo f3ias aDrl(vsnt0 lxnifcia1lm  lnvo (0texo(mpou1opte ieils) 2ra(mpno1altoio3tyt s rmnvont0 eermr3ty1fm elnvil( s2tmxo3iy4apenmnvs sfaDuru oot1tlen oetydls rau pnu0tlxoxo iy1omt  uvo s)t2tr(r io4lpt miet t srtaumpoo0oltnifctlt a raums;u) etnxf3oadomteanvil(  etrxopny1apeelivt ()a2uaumoot1olt io3tlt a rl(ms;u0 eerirciytlaDr nvs ( tetmir3iy4ale lnct s arua(rp;t0tpenmfetyslaDumu s u)tetnir to1fa e n s ( t2um(opiu4apee fvsas)sDrr(mooo0apt  f3tatfa2eauvp;(0 rxnircoo1oa r i o t0trumiopoo4oleemnctl(f 2tmx pou4tlx iieild s2uau pnt)trtrmf ia1lm eau i;(0srxrir ny4ame  nes () rtmxmpot1ole micilt m ea(mont0tetrxo tatfptrlueo t)teuoir no1lpenmfei s)arrrx ooo1alxnmi3iyt m2ul( onu0aeeoif to1fateaieo ( s2xm(m3ou1amenlfvt t aDtmx p;t1tet  fctltlmDranvsn() etnircio1lm   n ols0srxrxm oo4ol   nei t  2rrur nt1olenmietldls emu s t) rtnxo3iydfpDelueslt) 2xmxm3io1ape  ics (  2rm(m ot1tet mf3iadfsDua(mp;t)tltnxfciadlp e uvsl( s2to(m oo4lpenlnesl()arurxr oo4aeeoiieiad s2eauvp (4tlxoircootfm rlivols)seuoiopoy1al nmfcia(fsDrm(mpoo1tetoifeildfm2ea(vs;t0 rxomrcoo1la   ivo;s)sexrirpny1ape mnvs s s2ururoou1altn o3iltla ra(vp (4teerir3tytlmDeln sls0t2uoxr oy1ap nmnctls)arrmump;t4olt  ieildls eanvo;t0trxnmr iatlmt  n o t)teurxrpoy4lmt  icia( a2tmu ono4aexo ietlsfs2ran snu) etoxo3tytomD li s (0teumirpnydlmtnmiciasf Dtruro;u4ale mi3ildls rln s u) lxnmo3oytopDrln s t)s2xrirpnudll n nctlsfa2ta(mo;o4altnmo3tls aDumnms u)tltrmr3ty1opt ln o (0s2xr(m3oy1amtnlfcias) Duaxmp;t0tet mieiytls emnvsn()altoxrcoo1fm e uvo;(0 2uoiopiu4lptemivi t) rua(  no1opeo feiytfm rluvp;(0treoxf3iy1fpDrlies;s0trur(rpoudame  nvsat  2umx  nt4tpx  i3tytla2em(ms t0trtnmoctadom r uvols)trtmxo ou4lp nmnct (  2um( pot4oeeo iciadfa2el( o;t0trtomrcty1oa  lnvo;s) eum(m iudam n icta( a2trur nt0tleomi3iytlsDelu p (4altnmrcoodfateanes t0 euoxm ou4opeemies ( s2raur ot4oexn fciytfm2ra(vpnu4 eenircoy1laD  ues s0 2toir3no4amtnlfes sfsrtmum nu0alen f3iysfm rlumpn(4arxrmf3iy1fmtrln o;t) rxr(m iydlmenmivta(fa2ua(  ;u1tpe iieild a umnmpn()aeerir oa1fptelues;(0setrxm oydaptnlnetas) rta(  ou0tltomieildfa2elu o ()arxrmf oadfm  livolt  etmxm oodapt  ivsls  rtaum nt4opxomf3iydlm eluvsnu)tetnxf3iodfatran i ( t2ur(o3ou4lmeemnctls)artm(  ou4teeo oeiltlaDrauvp;u0tltrio todomtelueols0srxm(m io1lmtn ieslsf ruru oot1aeeoiocils a2rl(vsnt4 eerxf oatfm  livs;() ruo(mpoy1optelfvi t s2tauronu4aeeoii3ildfaDea(vp;t0aexrmrctydlaD luvi s0seum(mpnudolenlnesatf Dtmxr ;o1olen f3iadla2emnmp (4arxomr ta1lmt aivs s0t2xr(o3nu4openlnvia()sruaum oo1olxnio3tadfa ra(vp;u)aeenir tatlpDelieo;t  2tm(o3io4aptemfcias  rtaurp;u4oex mociyd a rmn pnt4altomf3iadoaDr u i s srtm(rpio1am nmfvs ( aDrr(m nt4optnmo3ildlsDua(mpn()tlxrxr3oatfmD  ueolt s2urxrpou1olen fciatf Dtaxmont0oeenif3tltfm2ua( o ()tltrmf3tadop   ies t s2tr(opiu4apt  ncsas) rraur nu0tlxnmieias m2ulump t0 ltrmoctatfa  aivi t)trurxrpnudll n ncsat sDra(mp;o0tpe miciadls2eluvsnu0 rtoxf iydoa rau s s)s2xm(opnydamtelfct sfsrururpot4oetnifciydfmDulnvpn(4alenmo totfat  ies;t0teurio no1ale mivt sf rrrur ;o1aet ifciad s2elu p () ltnio iodoatrli s;t0seumimpiu4lmee nesa(f 2tru ono1alt  oeiatla2ulnvon() rxoifcoatlpDr nvs;() rtoxm3oudlp nmfvsat)a2umum ou0opx  oeiad m2uan s;u4arenir iy1fmtr iei;s0teurim oo4apeemfeil( artrumont1oee mi3iltlm2ea( sn(0tetrxocta1laD livilt  2uoxmpiy1aleemfeias  2uaxmpot1ope  o3iysla2rluvpnt)artoir3oo1laDr ivols)t2um(o oydlmenmfci sf 2rm(  no0tlxo fciadla2uanmo;u4 eeoxr oo1fpt  ieo;s) etm(m3no1alenmivt s  2rmumo;o0teenio3tlsla rlums;t)alenmr iodlpD anei t0trtoir3oydlp emnvsat  2urxmont4aet iictysfmDea( pn()alenxrcootfmt aivi s) 2umirpny1amen icsas srrmx pno4tleoioeiltlaDrm(mo;()artoir3oy1fmt an o t t2xm(mpoy4lpeemiciat sDrrxm ;u1oexo icias s2raums t) exnir3oytlat  n sls) 2to(rpny4al nmfctasf Drr(r ot0tee  f3iltfs uaumpnu0alenmo ty1fp rau s (0 2xrimpoydameelict s a2uaxro;o4aeeomociytlaDumuvs;t0tetrio3ia1fa r ueol( srxoimpio1olte icias) rrrx pnu4oee mfcild sDrlnmpnu0 lxoxf3tadfp r ieslt texrirpoo4apeelnvs (  2raumooo4apen oeiat a rmn on()teerxo oydlaD  n ils  2umxo3no1alenlfcsat) rtrur ot0aexoii3iatfm raumsn(4tetoir oodoateai s;( seuoxrpoydll nlfeslt)s2ta(mp;t1apx  fetytla2ea( p t)alxrifciodlm elivs;s  rtmxopou1lmt liviltf rtmu o;t0teeomfetytls ulnvs u4 reoxo3tydfp e ies;t0 ruoim ou4ap n nci sfs2tmxmp;u1texn oetadls2emn s;t)artnif3oytfmD aivs ()texmimpnudlpeemneilt  rra(m ot0texo iciat s emnmonu0tetoxr3tytom  ln ols0t2tmir nodap elfvia( arta(rp;o4apxomf3iatlmDul( s () eerio3ty1faDeaivi s) 2xrimpiydamenlnei (f 2ua(roou0tlx  ietas a2emuvpnu0 lxrif totfpDe nvo;t  eur(m oudlpe  iet () rtrxmpno4opxn feiatls ulu p (4aetrif iadlmDeaivilt0 2umir3ou1lm emfetas) Dtr(  ot4olt miciltfaDemums u4trenxo3io1lpDrliesl()trto(o3no4omeeliei (  rtm(ro;o4olt ioeiysla eaumsn()alermo iytlaD an o;s)sexoiopnu1ol   net s sDrmumpou4openifciasls uau pnu) eeoiocto1opDelu i;(  rumxrpiu4lptelnetas)sDrm( pot4optnio3iadfaDuluvpnu) etrio iytoptelivi t)s2xoio3nodom n fcsat)s2rau o;o1oetn i3iydfmDeluvs t)trtoxoctytfmDeluei ()trtoxopiu1ole miei ( aDtmx  nu1tee  ieiys mDeln ont4artomr oy1lp rln i (0 2xmxr nydoltnlncsasf 2trxmpnu4tpeniicias m emums;t0trxnif todlmD  ueo t)t2xrxr iu1ap  liciltfsrrmu poo4ole ioctldfs2ra( s;t0 lxoxo oy1lpte i i s) 2ur(m3ny1omtnlfctas a2tm(m ot1aetnio3iydlm rl(vp;t4 rtrxrctadfpt  ies;(  euoxm oydol elnci t)sruaumpot0aexoif3tydfmDulu s t) exnxf3iodfateai ils)setoxm oodlp elfvtlsfsDrr(m ;t0tptnmfciytfs2ea(vp (4tlxoxo3ta1lat aivils) eurxo3oy1lmte nviltfartr(mooo4aleomfciytfs eauvont)tetnxocoa1fpt aivs;t)srtmiopiydale  ivtas  rta(mp;t4aex  i3iyt sDrmu onu0tetnxr tatfm  aues;(0srumio3iydol n fciasf rrm(mp;t4altnio3tldfa uau p u4aeerxr iytomDr n s;s0srto(m3io4lmee ivsls)aDta( o;o4olto fctlsfsDeln sn(0artnxr todomtraivs;t) exm(r3oodoltelicil()s2tmxrp;t0olxoif3iltfa2eauvp;u4tetnxo3oatfaD ai i;s)setrxmpio4omt mfetatfaDrmur ou0oltoiiciltlm2eaumonu)aexnir3iydfpD luvs s0setoxr3nudam nlnetatfarua(r ;u4oetnmfeildlmDel(vo u) exoifcia1op e ieo;t0t2umxo3no1omtnlnvil(fa2taxrpno1alen oeildlm2uanmsn()altnmr3oydlpte iesls0trxo(m nydaptemfcsat a2tmu  oo4apt mfciltfm umuvsnt0tleoif3tadlptraues;s0sexmim ny4ll e neslt)artmurooo4aexnmo3tydlaDrlnvo u0aexnmf oa1lptr uvi t  exm(mpoo4ameemfctl( sDur( poo4oex  oeilt mDumnvo;t)alxrmrcty1fpDrauvo;s0srtrim3no4lmte fcs t)sDuax onu1aexn ociatls umu on(0arxoir3ta1fmtrlnvs s srxmxrpoodalen fcilt  2urxrpot4tpe iiciatla emumpn() ltnircia1omt  ues;t) rtoio io1lle mfeil(  2uax  ;u1alx ifetlt sDranmp;() etrxf3oytopDrlneo;s)seur(o iudomtemfeta(  Dur( oou0aetomfeiydlm2rlnms;t4 eeoio3io1oaD li o;(0 eurim3oo1op n ivil(  rta(mp;o0opxomo3ilsls em(vp;u)texnmf3ta1omteliesls0t2umio3oy1lpee fvil(fa2rru p;o4tee  o3iysfm em(vp;u0 rxrio3todop e i ilt)tetr(m3iu4openmics (fsrrr(m ;t0tptnio3ilsfmDeaump u4tlxoxrcia1lmDelivo;s)sexo(rpou4lpt lfcias srtmu p;t1alt  ietytfs2rm( p;t4teenmf3tydopt auesl()srtmxmpoy1ol emnctlsf Drm( o;u0tlenmfetaslsDem( snu0 eenxf todlm r uvo s) ruoxm io4lptnlfetlt)a2rm( pot1tptn f3iadfmDel( p u)altrmr iadopD auvsl() etmxopnodop   fviltfsDrrum ;t0openioetytfsDrau s u0aeenircia1fmD anesls) rxrimpiy1optemnvt (fsDuax pnu1aet io3ilsfs2ul( pnu)texoxfctodoatranvs s) ruoim iy1lm  mncsls)s2rrxm nu0tlt  oeiys m2eaump;u4 eerirciotfm elnvo;( teur(m oydal  mivilt)aDtmx p;u0oetoio3tytla rauvpnt4 ltomf io1fpDe u s ()texrio ou1lpe mncsat  2rrurpno1aleomi3tyt mDranmo;() ltnmo todoaDranvs t  rto(mpnu1op emietltfarrr(moou1aex  o3ildla eanvon() rxoxrciatopt  nvo t t2xmir3iy1lmeemivtat)sDtaumonu4alx ioeilsfm uauvs (0 rtoxrcoo1fa eau s t teum(opoy4lmee ictlt)s2tm(mpou0tlenmi3iydls rmu p t0tltnmr tydomt li il( trtmxr3nu4lmtelfctl(f rtru ont0aptniieiatfsDrmums u0aexrmrcoa1fp e i olt)srurirpiydlltnmfvi ( sDumumpou4alen o3ilt mDrl(mo u4aetnir3iy1la eli ol( sruoim3nudal nmicils a2uau p;o1opxoifctysfaDranvsnt) lxrmr iy1fa  ln i ()s2tr(m3oodame lieias) Drmx  ;o1oetn ieiyt m rl(mpnt) rtoxr3ty1fat ai o t) rtrim3oo1altemfcsas)srtr(mpot0oexn o3iadfa2rl(vpn(0teerxf ootlp rln o;s  eurir3iu1lpe lneiatf Dur(  ;t4alt mfeiatfs rln s (0 exrmrcoatlmD  i i t) eumxo ny1optn nvi tf 2uau oot1tptoii3iadls2ua(vs;t0teeoxr3ta1fmD aueo;t)t2umxm3io1lpen fcslt aDrmum ;o4tpxomietlslm2rmnvs t4 rxoio3iydfpDelivilt0trto(r io1apte ivs ( sDumump;t1tlt mocild s rm( p;() rxoxf3iatlpt livol(  2tr(m nudol e ivilt a2rm( o;t0apto ociltfsDrlnvo t0 exrmr3to1opt aiei s0 eur(r3iodap  mnviat  rrm(  nu4aeeo oeildls rm( p;(0aeeomf todfp eanes;s0s2ur(o no4am  lics () rumurpot0opx  f3iltfm ulu onu)trtomo3iotfaDraneslt0srtoxm iy4lmtnlnvslt) 2ur(mont1tpx ifciadfm raumo u4arxnmr iy1fptelu o ( teuoxopiy4lpt lfcs t sDtrur nt1apeomi3ias s uauvp t0tltoxfcoydlptran s;(0 rxmir ou4om emieil( srrr(rpnt0alxomieiyslm2eanvo;t0tlenmo oo1fp  au o t0setoxopno4oltemfvil()aDum(  no0oltnmi3iltfm2raumo u0 ltoifcoydlp rau s;t) rxoxo3ny1aleemnctls aDrau  ;t4oltnmictltlsDraumonu4 rtomf3iytoaDrlieo;() rxrxr3nydap e ies ( arrmx ooo1aex  octld s rmuvo;t)arxnmo tytfptrlueols  rtoxo ou1ame lfcil(f Drr( pou4aet  f3ils m eaums;u0trenir ootfmte i sls s2xrio iy4am nmiet tf rua(m ;u0optn i3iasfsDemn p;t) eerxf oadfpDelnvi;s sexmio ny1ol emivs t artmxro;u4opxomo3tlsfs2uanvp;u4arxnxf3tydoptrlneol(0 euo(r nu4oltnmfcs () Dumxrpot1tptomfctldfs uauvs;(0arxnxf ta1fatrlnes t0sexoxo oy1lm e fei t srua(mpot4tpt moeiadfm2rlums;t0arxoxf iotlatrau ols trum(mpiu1ll   fvsas  2tauronu0teeoii3iad a2ra(mpn()tetomocty1fmDe u s ( s2xrir ou1lm nlnes t)a2ra(r ou4tetoioetysfs2uanvp;()aeenmf todlmDr i ols)t2trir3io1lm emivtlsfarrmump;o1aeeo oeiadlm eau o u4alermrcoo1fpD  ueo t  2umir3nudap  mnvtl(fsDrmu  ot4apenifciys s umnvo;(4treoif ta1lm  aivil( t2xr(m3nu4lm nmfcslt)srrrx p;u4olt mi3iytls2uau onu) leoio totlmt auvi t s2triopiy4al emiet s  Dtmuroou0aetn oeiatfm2eln p;t) lxrxrcoatomD aies s s2xrxr3oy1apte ictlt)s2tax oot1tpe io3tadlm2ean ont) rtnmo iytfmt  ies (0trtm(m nydllte icta(  rurx ono1alx  ociltls2uan o;u) eermo3tadomtr n i;t0 eumxo iudopt liciat srurx ooo0olenmietasla ul(msnu)texrio3totfmtelnes t0teur(r no1am  lfvt s) Drrumpou0altnifetasfs2ran s;()alenxrcty1lpDeanesl( srum(o3nodape mfvils)arrm( pou0optoiociasfs2rau p;(0arerio oodfaDeaneo;t0 etm(mpiydamenlnciatfsDrr(r ;t1opxomfctltfs2ua( ont4tetrxr oadfpt aivolt)texoim3iudap   ivilsfa2rru  no1tex iicildlsDra(mp t0tltrxf3iotfpte n s;( srtrxrpny1lpe  fetat) rua(rpno4olt mfetltla2emu ont4tltrxr totoaDrau o s)texrim iy4lptnlfct sf rrm(rpot1teeomi3ias sDranmp;t)artrif tadlmt lnvi s) rurir iudameemnvi t a2tru  ;t1oex iietld s ul(monu4aetrmrciydomDr iei t s2trxrpiudop  mfvsat artmu  no0tpt mfeiys s ea(ms t0 leoxocto1lm  aivil(  2uoim ou4olt mnvt s)arrmxmpnt0texo f3iytfa2ranmo ()arerxocoy1faD  nvsls0trxoxo iy1opee fei s aDumxr oo0opt iicildls2ranvo;t)tlxrxf3oodlaDeauvi t0 2tm(r3no4op  lici s) Draxmp;o1aet iictyd m ulnmpnu) eenxo3iotfmt  nvi;s0trtoxr3oodomtnlneiasfsDumumpou0teeomf3ilslsDem(mo;t4altoirctatfmt au o;s)texo(r nu1omt lfesasfaDta( pnt0oltnio3tld a2uauvont)aexrmfctydfmt an s s0srxm(o oydal n ies s) 2ta( oou4aexnmoeildlaDeanmo;()aleomo3tadlm rlieolt)truoxm io4op   ivs s arra( p;o0tlxomf3ils aDumnvs;t) exoxrcootopt  i s;t)srurxopoodol   ivslsfsrta(r ;o1aexo fcildlm rm(mo u)alerxfciydop   iei s  2to(opnu1omenmfct t a2ta(rp;t0olto ocilsfm2uauvo;u)arxnxo tadfmD  iei;(0t2trirpnu1lpenlfvilt) Dtax pno0alxoio3tlsfa2rmn p;t4trxoxr3tadoa r uei t0t2umxr3oy4ol nmnetlt sDrm(m nt0oeeomfcilsfaDel(ms u0 rxnxr todoptelnvo;t0s2xmirpnydapenlnvtl()artm(  ;t0tleomoetytlsDeluvo;u0 ltrif3tydlptrln i (  etrxm3oodol nlfvtas)arra( ono1tptoifetyt s2ran snt0aetrmf3ia1fp   ueo ()tetr(r iu1lp nlivt (fs2urxront4altoifeilsfsDrmnvs u) rxrmf oo1optr ivo t0trxo(r3iu1lltemicia()sDraxm ;t4altnifciydlaDelu onu) ltrmr to1lm r u s;s  rtr(mpiy4apt mfes s  rtrum ot0ole iictltfsDumuvo;t0arermo oodfateauvs ( s2toxmpou1alee ivi ()sDra(m oo4teen fciad aDul(mpn() eenxr3iotfptr ueo;() rtr(r oo4om nmnesls sDuaumpno1opxnmoeiytls2rln s;u0aetrmrctodom ean o t0 eur(o oo4alee nvt tf 2urumoou1oexnmi3tatla2elumo;u0 lenmo3tytfaDrlnvi s)seto(r3no4lmt lici (f 2raumpnt1tee ifetat a rauvp;t0arxrmr3todlaD lues t0 2urio3iudol n ietlt  2tr(rpot1tpto oeilslsDua(msn()aexnmr3iotlm  an slt sruoio nu4lmeelivtatfarururpnu4tpxomf3tlsfa2ua( p u4tlxoir tadop rlu o;s trxoxrpoydllenlfesasf rtax  ;t4apxoif3ild s2rm(vs (4 rxnio oy1opDranvi;s) 2uo(mpiu4al  liciasfsrur(m ot4aleo ietadfa2ean p;(4 eenmf3todlm raneslt0 euo(m3no4apenmicias  Drr( p;t1oleomfetatfa2um(monu4areoxf ootfa e neolt0texmim3oy4omtnliei (faDtmu ont1tpe mocias aDeauvon() eeomfcoydfpt auei t0 2umxr ny1omee fcil( s2uaump;o0opx ifciyslsDrau pnu0trtnxf iytom eln i t t2xo(o oy1lmtemicta(fsDta( p;t1tpx if3ils s2ua( onu)aetoio todfp r nesl(0t2uoimpny4oltnmfcils sDrmxmp;o0olxnmf3tytlaDelumo ()trtrxfciytoa e i ol()setoxrpny1optelfesl( sDrm(rp;u4aee  oeiytls2ean s t)tltoif totfmt au i;(0 2xr(mpoy1lmt lneslsfaDurumo;o0tpeomf3iltls eln o;u0tlxrir tadfmt auvol()trxmxo3no1open fcs t) 2tr(mont0optoifetasfa ulnmo;t)tltrmo3tatlat au o;s s2uoim3iu4apt mfvi (fs2uru  nt1apen oeiysfs2rl(mpnu)tetoxo ta1lpteai il(0t2ur(m3iu4lpeemicia( sDrrumo;t1tetoioeiatfsDumnvp;(0trtrif oydfp rln o s0seto(o3ny4lpe livtas  2tmuro;t4aeenioctasfm rmn o;t4 eenif ta1lptranvs;s)teto(m3iu1lmtn fctltf rurur no1aee  fciltls2eanvs u0 lxnmrcio1oa e nvil()s2urir3iy4om   iesl() rrru  no4tpt  fciasfm2uln o u0trenxrcoodlm   ivi;s setr(r oodllee ivsl(farraum ou0altomoetat s rmumo;t0 eenio3iotfpDe ies;()t2uo(o3iy1ol e fcta( arum(mp;o1alx iociat aDea( p t)tlxomociytlp  li sl()srtm(rpny1ome miesls) Drr(mpot4aeeo octadla rau snu)tlxomf3oodopDraiei;s0trxrxo3iydll emivils)a2ra(m ;t1oee mfeiadls2rau s t0 rxrxrcoa1lpDeli ils0teuoio3oydapt  ies ( artau onu1aptnmoctytfs2ranvsn(4tltrxo iy1fptrli il(0s2tmiopnu4aleeliei tfaDur( poo1tlt mocild aDem( pn(4trtoxf3ia1omtelneo;t0 2umxo nu4am
\ No newline at end of file
@@ -0,0 +1 @@
+nes;s trxo(r3oy1lm  lnviat)srtax ooo4oltomiciat s em( o;u4 exnmocta1oa   i olt tetoir oydlpeemfvils) 2umur ;t4opt  iciatfa rm(msnu)trerxr ty1fat auvolt teum(o ou4lmeelnes tfsDtmum ;o1aptnifctatla umumo;(4arxnio iy1fa rli olt) etrirpoy4ol   fetlsfartmu  nt0alx  feiasfm emumpn(4tltniociodfmD  uvo;(0s2triopiy4alenlfvtlsf rrrxr no0texnmoetys sDrlu o;() exnmr3iatfpDrln o s) 2trxmpoudap  lnvilt)a2trump;o1olenmfetatlsDrluvonu0 rtrmo3oadoaDeluvi t  etoiopoodap  licsls)s2rmu  ou1tet iieiydlm emnms u0tltrmrctytomD  u ol(0t2uriopiy4altnlfvs () rrr( pnu4texo ictat m rau o ()teerxf3tydlm ean o;s) 2xmxmpoo4lpenlnet t  Dtr(roou1open ieiatls rlu o;t0altnmf3iydlmDr iesl(  rtm(m3oy1lpee nctas  Draur no1tltoii3ilslmDumu snt)treomfciy1oa   ies (0 2xr(r iy1lle lfeiat)sDua( pno0tltoioetytfa umn p u4arxrxr oydfmt au sls)sruo(m3iudlmtemicsas sDtmump;u4olt if3iadlm ea( p t4tltoxf3iadlatean i;s) rurxo iu1am   fcils)sDtaxmoot0alxoifciys m2rlump (4altoir3iydlpDrauei;() 2trir iy1om   feta(  rtr(rpot1tlx  ietytfm ranms t0trtnxr ootomD lnvs;(0srxm(m nu4amtnlfvtatfsrta(mo;o4aleniocild m2elu s;(0 ltrmr3oo1opDraivils)srtoirpny4apenmfcilsf rraxr nt1alxn fciasfaDel( on(4 eenirciy1lpt  ivi s0s2tr(o io4oltelfcsls)aDra(rpnu4teeoioeiytfa2eauvsnt0 etoir3tadlaD lieo;t)t2xmxo ny1omtn ieiasfsDtmx  ot1tpt ifctytfs2rm(msnt)tltoxo3tytfpDeaneols0 2urxmpoy4omtelfcil( aDrm( ooo0aex  ocils s umu onu0 etomr tytlaDr iesls) 2toimpiodolt  fet ( srrr(m ;u0altn ieilsfa2ea(mont4aeeoir oadlaDe nvsl(0sexrir iy4op nmicsas sDraxr ot0tlt mfctltfm eaumsnu) rxrxo totomDrluvils t2xoim3iydlpenmnvs (f rra(mo;o0oet  feiasfmDrlnvpnu)tetoiocoadlmD  ivs;t0truoio iy1olenlfetlt aDtaumoou0optomo3tls a2uln pnt)trxoxo3oatlatraneslt)t2xrim3ou1oltn ivi t)s2tm(moot4oet mf3taslsDemn s;u0arenxo iotoa rai o;(  2umxr oodam elfcs ()sDum(moou0tpxnioetyslsDran p t0tlerxf oo1oatrln i () 2xoxm oy1llen fcs t) Dum(r ;o4oex  feiyt sDum(ms;()tltrmo3iotom   uei;s0s2uoxopiu4amt lfetlsf rumumo;o0oexo feiyslm raumon(4tlxnmr tydlmDe u i;t srtrimpoudom   feiatfaDuaurpnt1tpx moeilslm2emnmo;u0 lerif3to1fat lnvol(0 etoim3nodaptemnvi (f rtmx ont4tlxoifeiasfaDemnvp;u4tlxnxo ootfa ranvo;s) rxrxm no4ape  ietatfa2um(ro;t4alxnif3iadfaDumuvsn() exnxr tadfm eaueils)s2tmxo3iydlptnlfetas  rurur ;u0openmicilsfaDeauvp u4tlxnmo3iadlmt livol() rxrim nudaleelfctltfaDta(mp;u1apeoifetyd s2umuvonu4aexoif3oadlm eluvi;t)t2uoim3nydolt lncs tfsDrrx p;u1aexnmociadlmDelu sn() leoxrcty1lmtraneo s)t2um(m3oy4llenlfcia()s2umumpoo0aetnmo3iadfm2eanms u0aeeoxr3iydfptrlneo ( srtmir3ny4al n ieiatf rraur ;u1tlx mociasfaDemuvo;t4 lxrxrcta1lpteluvsl( trxoiopnu4ll nlfeta()aDra(r ;o1aeeoif3tas sDuau pnt4trxrmf3io1fp raneslt trtoio3nydom   ncsl()aDtrur ;u4aet mo3tltlsDeau snt4aexoiocto1optr i i ( s2tm(m oudlp n icia( aruaxrpnt1apeomociytfs rln o;t)treoxo3iotomDrau i;t0s2umxm3iodlltelnctl() rurxm ;t4ape ioctat m rlnvp ()texoxr3oadfmt lnvi s  2ur(opio4lpen fvsls)sDraxronu0olx mfetasfmDel( pn(4tltnmf tytlatelueo (0t2triopiudlp nlfvi sfsrrrum ot1ape if3iatla2ra(vsnt4 lxnxrctydfmte ieo;( sexrimpny4olenlietl()s2um(  ;u1oexnmo3iydla2uluvs;(4 etoif3oadlpD anvi;t0teuo(m3ny1ale  fetat  Dtruroot0tpeniieiytlaDulnmonu0 rxomo3ta1fmte n i t sexm(mpoy4lltnmivias arum(m ;o0apen oeildfs2ea(vp t4aexrxo oa1fa rlnei s)t2urxmpiudom emnvia()s2rr(ronu1aleomiciad a rlums t0aeerxrciatoa  liei;(0t2uoir iu1ame lfvia(fsrum(rono4ope mfctytfa ranvp;t0 eeomfcoatoaDelu ols)s2to(m iydllee feslt  rumx  nu1alt  ociaslmDrl(monu0tetrir3tytlptrauvi t sruo(r ou1lptemfvtls arrr( ooo4tle  fetadlaDuan snu) lxoif3tytla  ln s;s0 eum(rpiydop  micslt)sDrr(mp;t1optn fetatfsDemnmsnt4 eenif3ty1lat aiei;s)tetr(o3ou4aptelnct s)artm(mo;o4oee  ieiatfa2um(mo;(0tlxrxf ia1op  li o s trtmim3nu1apenmnesatfsrumu oot4apxo fciytfaDemu snt4teerxf to1laD ln o s sruo(m3iudap  mfvtl()s2uau ont4oet  ieiyd s umu p;(4 rxnir oa1lpD  n s (0 rum(rpiydopenmiesa(f 2urump;u1apx moeiytfa2eln pnu)trxrmociytfaD  uei t  2toir nodll nmiei ( s2rm(rpnu0openifciatls ulu s t4tleomr3iydlpt  i i;t)s2xoxo3nu1amee ietat  Dtrxmpnt1aetnmfciltfm rm( p;(0alenxo3oodfa r ieil(0t2urimpiy4lp elivia()arum( pnu4alenii3ildfm ranmon(0tetrxociadlaDr nvsl( teumxrpny4am elivtl(fa2rru ont0teenii3ilsfa um(mp (0 ltnmo iy1lmD auvs;t t2tmxm3nydol  lieiltfs2tr(m ;o4tltnmieiadfsDumumo (4trxnifcty1fpD lueils)t2uriopoo1al   fcsls)a2raxr ou1altnioctydfaDelu s;t4 eeoxo todfmD aivs;(0s2urxopiy1om  lfetlt s2umxrpou4ale  f3tat aDrl(vont0arerxf tatfaDelnvol()sexr(r3iydlm  lnciat)aruax  no1teenii3tad s rluvs;t4tlerxr oatopt aies;s) 2xoxo oodll  mici (  Dua(rp;t4tpto octasfa ea(mp t)aetrxfctotom  livs s  2trxo oo4optemfcsat  rrrxm ot0alen fcild aDrlnms;() ltoifcoatfaDeaneilt0 2toxmpiudll  miviat aruaumpou0alt moeildfa rluvp ()teerif iotfmtrlneilt srtrxr nu1om emncia(f Drmu  ;u4optnmictas m2umumonu)tlerxr tatfmtrlu il() eumxopno4ll elfetatfsDumx poo0opeomi3ild sDea(vs t)arxomr3iadom  aneo ()sexrxmpoo1olt mfvtasf rtrum ou0olxoio3ils m rau p t0tltrmo iy1fpDr nvil( s2uo(m3oy1llee ictasf Durxmpoo4texoii3iydfm2elump u) lxoif iydfat aneils0srtm(rpno4lmt miciat) ruaumo;o1tpeomiciydfaDem(mp;() rerxo3tatlm rlieo;t0 2xo(rpio4amte net sf Dtaxro;o1oltomf3ild m2ulnms;t)tlxnxf3oydlmDe n s s0setrio io4lleelictltfsDum(root4oeeoiociydfsDum( p t4alxoxo ty1fat lu s;(0 rto(o oydllenlfvs (fsrtaurooo1oeen ietasls2ran pn(0 ltrxo oa1faD aieols)seur(r3oo4omeemnct () 2rau pou4oee iociydla2emnvs u)tltnmr3oatfatrlneilt  2tr(mpoy4ap emict tfsDtr(ro;o4tlen ictysfaDeanvsnt0artrxf3oytfm r n o;t0t2tm(mpnu1lmt  nvtls a2taxr no0olxoifetydfs rm(mo;(0 lermo3oy1faD  n s;s0srtm(m3iy1al nmfvt s aDrru ono4tpe iociad a umuvp t)alerxf iy1fp elueols s2xmxopiy1lpt mivilt)aDur(m no4apt ifcias sDra(vp ()aeenxfcoatlate i i;s0seuo(o nu4oleelneiltf rum(rooo0aex mf3tat m uanvo;t4teeoir3oytom e nvil( trumxm no4omtnmnctat s2trx pnu1tptn oeiad s2ranvsnt) rtnmf3ootfmDrlnvslt)s2umxo io1amenlncslsfsruax  nt4opt  fciasfmDeauvp;u0areoxo3oytfptrli o s)seumxr oudole mnvsls)sDururono0oet mieiytfa2rm(vp;()trxnio iodfm r uvi s t2um(opny1omen fctls)sDtm( p;t4ale ii3iatfm eln pnu4arxnxociydlm  lnei t0srtmxm oy1op  livt t)artmurpno0olto f3iydfa rlu s u)trxrio3iotoaDrluvil( s2uo(m3io1al  lieta( srtaxm ou4tpx  fciyt a2em(vo;u4 rtomo3tadfm rlu o;s  2xrim3nudll nlict tfartmx p;u0olt  feiys a ea(vo;t4tlxrio3oydopDe uei s0trurxr3oo4ll   ict t aDrm(rono1tlxo fctadfm ulnvpnt) etnircoytfp eluei;() eurimpio4ll elictatfa2ra( ooo4tlen iciyt m2ranmont4 ltnmrctydfpt an sls)trtoir io4amtemfctls)arrax  ;o1oetn feiasls ulums t)altrio iy1lmDeanvo s trumir iy4altnlics (fsDurur ou0aex ioetysfm2umumo;t4alermo3oy1omt lu s;s t2xoiopiudome livtlt sDrm( p;u4apenif3iat mDuanvp;u0 exnxocoa1lm  lnvo s0srurxr3oo4lm   neias) 2rr(rooo0tet mfctaslsDrmuvsn(0teeomociydlmtr uvo;t)texrir3oydlltnlfcslt)s2taumpot4aeeo ieilsla rm(mp t)tleomr iotom ranesls  2umio3oo1lmen ies () rum(  oo1tltn ieiys a ra(mp u4texnio3iotfmteli ols seto(mpnu4lm emfvilt)a2rmxrpno0oet  ietat s2ulu s (4artrmo3oa1om eaivs;( t2urxr ny4alte nciasf rrr(m nt4tet ioeiytla elnmp;t0arxrxf3iadlm elivsl() 2tmxo3io4apenmict t)s2tm(m ;u4opxn f3iytls ua( pnt4arenxr ootoptr iesl(  eumim3iudaleemnet ()a2urur no0tle io3tas m ua(vo;t0tleomf3tadfmDe n s;s s2xmxopnu1ap nmnet (fa2taxr ou0teen f3iadlm2eln s;t)artrmrcia1oatr ueo s trtoir3nydap  mieia(fa2rmx pot1oee mfcildlsDuaums;u)tetomrcoa1fm r ivslt0trtm(opiy1lpeemfei s)aDrmxm oo4oet iieiasfmDua( ont) exrir3oo1lmteaivi;(0 etoxr3nu1ol n ict (faDtrxm ;o4aex mf3iltfm rln pnu0tltnmrcoadfp eliei s0 2toxopny1lle mfcta()a2taum oo4apxnmo3ilt s uln o (4texoxoctytfmt auvs;( trxr(r iudop nliesa(  Dumump;t4opt ii3tadfm rmump u0tltnif3tatla rlneol() eurirpoy4ll nlietas)arumxrpnt4tpe  iciatfa rau o t4alxoxfciadfp rauvi t0 2to(o nu4apeemnvtls a2rru  ou0oltn o3iat a2uluvp;t0treoxr oydfpt anvi t)t2xoim3iudlp  mictls) 2umxr ot4tptoiociasla umn p;t4 eenir3iytoatrluvo s0t2xoirpou4am emnvsas  rurx onu1aleniociytla eau o;t4alxrmrcoydoptr uvol( tetm(rpiodlltelicta( s2ta(m ou4olt  ietlsfm eau s;(4trerio iy1faD au s t)trxo(r ou4omte nvtl( sDtmurono0tpx ifeiatfs ea(vonu0alerir3tadfmDelnvsl(0t2uriopnydoleelneta() rraump;o0opx  o3ilsfm emu sn(4 rtoifcia1laDr uvi t)srxrxo3ou4ape  fcilsfs2umxmpnt1optn ieiyt a2uan p u0 rxrmfctotomD luvolt s2xoim no4ap elnctat)arua( pnu4alxnioeiatfs ranvo t0 rtrxo iodlpte uvo;(0 rtr(r oo4lpt  fvs t artm(m ;o0opxnmieias sDran sn()artnxo totlpDe uvs;t seuo(o3ny4lptn fvia(  Dum(ronu1aeenii3tyd m2rlu pnu)teenif oatlmDrlnvo;s) rtmxmpno4ap  miet (  Drmu pnt1oltnifetldla2em(vs;(0artrmo ootom eluvs;t  exrio3ou4omt lfvsat)srururoot0aeeoiieiltfs2ra( pn()trenmo3todfm  auvs;(0sexmxr3oodomt licias)s2rm(rp;o1ale ifetytfa umump;t4 lenmf3oytfat lnei;s)texrir nu1alee net s  2umxr ;o0tlxomocild sDuauvs;t0aexrxrcoatlpDe ueo s)s2uo(mpny4ame mfviat srrrum nu0ole mfcils a rl( pn(4aexrxo oa1fateaues t0sexoxr3nudopeelivil( sDurxrpnu0aeeomfetat aDeln ont0arxrxfciy1laD  uvi;( t2tmimpou1amenmncsl(fa2rmxmo;t4alt iieiadfmDrlump;()tltoifcoydfpDr uvo;( srxoxm3oydal emieia(  rrm( ont0oeeomictas sDeanvs;t4trxrir oa1om e n o t trtmxr iydlmtemicils)srtrxronu1tpe miciasfsDuanvpnu4 exnxf3oytomtr i i;() etmxr3io4ol nlncilsfaDur(rpnt1tpto ictatlmDea(mpnt0tltnio oydfp rlnvi (0tetoim oy1lpee ncsatf 2taxmp;t0aetnmf3iytla2rmnmp;u4texnmr3to1la  anei;t0t2urxopio1ale mncsl(fsDra( pno4oeeoiiciysfaDuanmont4treomfcto1lm eauei;() 2xrio3ou4ape mnciatf rtauront0tpen i3iadfa2ea( p;t4arenxo3iytfp eaivs t srtmxmpiydapt mivs ()a2ua(ro;u1alenio3iydlm ran p (4aexomr3oadomtrli sls0sruo(rpoy4am n ieta(f 2urum ;u0aexo o3iydla eau o (4 ltnxf ty1fatrlneo t0 eto(o no4oltnmnvs s sDtrur ou1tpxniociaslm uauvp u4 lxrmf iydfp  lnvi t) exrxm oy4aptemfctas srraumpnu4oet iictldfs ulu s;t0trtrmrctatfpDrlieol(0trur(m iydom  mnvt ()a2tm(  ;u0apt ifciasfmDua(mo;(0 lxriocoatfptr uvolt)trto(o io4alte feilsfs2trumoot0optn fcilt s2rlu s;u)altnxo ta1fpDr uvs;s0srto(m no4lm elnvtlsf Durxrpou4aexoif3iat a ea(vp;u)tlerxf3iadfmDe ueo t)seuo(o3nydale lfvta(f rumur nu0tpxo icias s2rl(mon(4alerxr oydlat an o;(0t2tr(opoydape livi (  rta(mp;o0olxn ietytla rl( s u0aetrmo ia1latelieil(0 exo(rpio4aptelivilt)s2rm(  ;u0altniociydfaDrmumonu)tltnir3oadfa raiesl()t2tm(mpoy4ome mfvilsfs2umxm nt4tpt  ieilt aDrm(vs t0 rxrif3ia1fa  lnvo;t0t2toxmpny4ap   neiltfa2rm(mpnt0ole miciyt m2uluvon(4 rtrmociadfmDran s s)s2ur(rpny1lm e nvtlt)aDtruronu1opxnmfctyd sDraumonu)trtoir3oatfa r i s (  2xoim iu4lm  livi tfa2uaurpnt1oleomiciaslm ulumpnt0trenmf iatoatrlnvs;s)setm(m io4lmtn fetltfa2taxm ot1tetn ictadfaDrm(vsnu4aleoxf iodopDr ivs;( t2um(rpnu4apen nvtas srtrumoot1tleoifetydls umuvsnu4 lermo3ootomDr uei;t0sexm(m3oy4amenlfciat aDrau pnt0aee ifciytlm2uluvont4aeenxfciotla rlieo;s trtr(o3oudop   iesls) Drax pnu1alt if3ildla eau on()aetriocoo1fatelneo;(0 2umimpio4ope  fet (  rraxroou0aexnmi3ilsfm2ulu s ()aetnmfctydoa r i o t) 2tmxm nu1al elfetl(f 2taxmono1aptomoeiydlmDra(vo t0aexoxrctydlm r ueols0texoxo3oy1optnmnvt sf rur(moot1aeen o3iadfaDuln s ()trtomo iadfp eln il(0trumxmpno4omeelnvtls) 2uru o;o1oexo f3tasfaDum( p;u0 eenxocty1opDrauei t0setm(o ou1ol   ivtls)s2umu onu1olto octat sDelumo;t0 etrif3tatomDrai o () exo(mpny1altnlnci () rta( o;u1oet io3iytlmDeaums t4tetrioctytoat  nei t0 eum(r iy4lpt livslt artau ont4olx  feiyd s2rmnms;u)teermfcoytfa ranesl(0trxmxr iydalen ieia( srtmumono0aet ifcilsfm2eanms;u0 eeoxf3iatoaD ln o (0s2xm(r ny1lmtn fvtls)srtm(r nt1oeto ieiytfs ea(vsn() rxrxr3ta1laDr uvo;s) exr(m ou4ll emnvt s)aDtr(rpoo1oleoio3iydlmDeau o;(0tlenir oydlpDelu il( s2toxrpno4al e ivtl()s2rru pnt1olenmfetatlmDumuvsnu0 rxnifciatlaDe nvs s  2xr(opoy4lpte fvi t  rrrxmo;o0ape  ietyd s rln p;t)alxoxociytopDe iesls  rxrim io4am  lfvsatf Durxm ot4opxoiicilsfsDranvp u0aeenmocoo1omD lues;s)sexoiopoo1olt mnvtls artm(ro;u1oetomoetatfa emn on(0 rxrmr3tadoaDrai il()seuo(o3iy1lp   ivs tfarrrur ot1aet ioeiatfmDulums u0 ltnmf iadlmtr i sl( t2xmxm3nu4open fvi (farum( o;t1tpeoiiciatla ua( snu0 rermrcio1omtelivilt seuo(mpiodlm nlnvi t) 2tr(ro;o1apxniiciyd a2elums (0 rtrxf3iodop ranes s)teto(rpiudaptemictltfsDuau o;u4oexnmo3iyd sDea(vs u0 lxnmf3ia1fmt lieo;t tetm(opiy1amee iet sfsDumu o;t0olxomi3iytla el(mp;(0teenxr3ootfmtelnvol() 2trim3nu1lm  mfvtas s2um(rooo1oee mi3tatfaDum(monu0aetnircta1latrlnes;s srxm(opoo1amtnlnvs tfsrtru pnu4oltomoeiyt s2rluvo (4aetoxr3todfa elivolt0 rurir3iy4altemiei (faDur(  ;u1tlto feilsls2rluvsnu0 leoxr iadlatrlnes;t) rtmir3nodlp  licia()artaxmpot1optn feiasfm uanvsnu0tlxrxo oytlaD aues s0setm(m oodol  mnvt s aDur(rpno4alxn fciasfmDuln o;() lenxrctotoa rli s ()trur(r no1ome lfctlt) rrr(m ou0tlxnmieiatfa rmn o t4 rxrmf totfmtean o ( srtoim ny1alt lfcils  rra( poo0tee if3iad a umnmo;u0teenxrcia1fp r ueslt)trxmxr ou4aptemncil(fa2rmurpoo0oltnmfcilslm uanmp (0 reoxf3to1lmDe nvilt)s2to(opnu4om  lnviat) 2umxrp;u4apxnmi3tydfsDel(mo t0trenxo3oydomtraues;t0setrxrpio1openmfcsl()sDtm(mpoo0opt mictlsfm2rln snt)aeeomf ia1fat lieo;() 2to(r iy1llt mnesl( srumx  ou0olx ioctasfm2ul(ms t0alenir iy1oa elnvi;t  etrxrpoy4lmt mfesl(f rur(r nu0oexn i3tytfa uaums t) etrio3oo1omD  nei t trumxm3oo4om emnvslt sDraxront1ole  fcils s2uln p t)texnmociotopDrliei;t srtoimpoudomeelies sf 2rr(  ot1opxoiicilslm2rmuvp t0 exnxf iatopDe u i t trxoxopiudlpenmncilt)s2tmu pou1oetnmfeiydfm2uan p u4trxrmf3tydlateaieo ()srtoxm nodopen feia()s2raxmpnu4tpto f3taslaDea(msnu)trxoiocoo1fa eluvols t2toxo3oy1aptnlncias arua(m nu0aeen o3iydla2em(vpn(4 rtoiocootomDelnei s  2xoirpoodomt  nvt tfsrta(ronu0olxo fciysfm ulnmpn(4treoir3iadfp e uvs ()trurxopny4altelivil( sDumu  nu0ale  ociydla umnvon(4tlxnxfctodfmtrlu i s)t2umiopnydll e feia(farurxrono0aetn i3tysfm rauvs;t) rerio iadlat liei;s0 2trimpnudlmtn fciltfartaxrpnt0opxo o3iydls rlumont0texrmr iodfm rluvolt)srtr(o3oo1ameemfcsls)srtmumono4tpxomfciasfmDulu ont4trxrxfciytlmDeau s;s setmxo no4ape  fvsltf Dtaxmp;o4tleniociyt m2rmu p;u4tetrifctydlaDrau i ()t2xmim3iy4al emnvs s)artaxrpou4tptoiiciltlsDrl(mpn(0 etoxocoytfatranvi ( t2toxrpiudaltemfvi s sDum(mpoo0alenmieiys mDul(mp ()tltrmr tytoptraues;s) 2xm(opoydllenlfet s)a2ur(rpoo0oetnmictlsfm2rl( on(4tlermo iydop e nvs () rxoio oy4optemfesatfa2rax p;u4tpt  ieiat m2umn p u0 lxnxoctytfmD  neilt0t2urxo oo4lp  mietl(  rrm(  nt1apeomoeiydls2rauvon(4texnxocto1fp  luei t) etrxm3no1lle mfviatf rtax pot4tpxoifctysla el(vp (0artoir3tydopt  n i;t0 rurir iu1lp elict s)arta(r ;u4tpenmo3iysls2ulnvs;t0 leoxf3ootoa eluvolt0 eumio oydlm emies t)aDta(rooo4tle mo3tyt s umump (4 exrifciydfa r neo;t  exmimpoo4lp  mfeia(f ruax o;u1apeomieilsfm2ua(vsn(0areomrcio1omD  u s;s  rtoxm oudlm nlncsa( srtmuro;t4optnmi3iytfm2rluvon(4 lxnxfciotfate neilt0tetr(r nu4llenlfvi () 2uau ont1opto icildls rlu onu4 lenmfciatlptelivolt srxoimpiy4lmte ies sf rtm( pno1tlt ii3tyd aDrlu o;()aexrmf3ty1laDeliesl(0 exm(o iydlmtn fvi s  Drmu o;o0texo i3iydls2ulu p t) eenxr oytfm   ivo t)t2xo(o oudap nlictl(faDuru pno0oex mfeiatlmDumu s (4altnircio1lm  aieo (  2umxopoo1om nlnesl(  2tax pou0aleoiietatla2rlnvs (4areoirctatfmtrluvo (  2toiopiy4om emiet (  Draur nu1aeto ociltfa ea(mp;()aetoxfctytomtraivo t0 2xmio3oo1lmt lfvsls a2tmum no4alx  octat mDrauvp;u) rtrir iotom rlnei;s0texoirpnudapt lics sfsrtaxmo;t4aee moeilsfsDuanmonu) etrxf iy1fpD ai s s  rtmxopnodlmt  ictlsfsDrmumo;t4olen o3tyd a um( o u4 ltnmr3oytop  lnvols0t2uoir oo4om elnesa(  2umxmoot1oex iociaslm2elumo;u0 rtomr3tadfpDr i s;()s2toim nu4ol  mncs ( aDrrxr ou0tlxomfciltfm2rmnmo;u0aetrxr iotlatrai i s)s2uoio oy1altnmncs (  2ta(m ou0aetnioctlt aDeanmp (0alxoxr3tatfm e nvi;(  etoimpiu1ale lfvta( a2tr(m ;u1apxn iciadlaDrlnmp u0 exomo iytlatrlivi s texrxr3nydopt lnesl() rumu  ;u1oet ifctyd m2emnvpnu4 lenio3oydop  lu slt seur(rpoo1altn nvsltfsDumxrpou0tpe mociyt m2rl( s;(0 lenmf ta1oaDr n s;( trto(r3nu1omtelncsat aDtm(m no1apx  ieiadls2rm(ms;(4treomf3ta1op elies s0 rto(r3ny1amee fesl()sDtm( pnu4apx iocilsfaDra(mp;u)trtoio3iydfm elues ()srtrxopoy1ope mncsat aDua(  ;o0tet  iciat m eanvo (0trtrio3oydlmtrau olt0teurimpiodoltelfes tfsrta(moot4teen i3iytfmDel(mp;(0artrxf3todfpD  ueils0trtmim iodalen nvt ()srra(r ;u1tleoifetld a2eaump;u)teenirctatfmt auvs;s0t2xmxr nudale  ivtas)aruaxrpno0tpto iciyslmDrlumsn(4tlxoxr3oa1fpt  u o;s)t2urirpoudap emivi sfsrua(ro;o1olxnmi3ildfsDra( s;u)tlxomfcoo1fpt ai slt teuoio3ou4amt  ivils) 2ta( onu4tpxomo3tadla2umuvs t4 lxnxo iatfa   ivi t s2xm(opoo1amt lfesa(faDra(mpou4tlx mo3iyt s2emu s;u) renxr3iydlpDelivi;t)texoir3oudomtnlfvslt s2rmx poo1aexn o3ias aDemnms;u) ltoxfcoatfpDr ivol( s2xmir3no1lle lnesa( a2rrxmpoo4oeto i3iat a ra( o;(0tleoifciydfmt  n s;s) 2xoirpoy1op n ieta(fa2tr(mp;o0tex mf3ilsfsDranmo u4 rtoxr3iadomDr i sls0srtmir3ny4omeemici t)srra( onu1tptoii3tydfa ulump u) lxnmocoytla r ivs (0s2ur(o oy4ll nlivs t) 2taur oo0aeen octldlaDelu o (4 etoxr tadomtrluesl()t2trxo3iudomte iei ()sDrrx o;u0tptn fetysfm2umuvo t4trtrmo tatfa ean i;s) rxrxr iu1op n fvtasf ruaump;o0oexn oetltls ea( onu)aexnxfcoodopt ai s;()trtm(o3iodlptnlneslt) 2rax  nt0alenifctyd m2ulnmsn(0trxrxr3ty1lpDeaieil()seumxr nu4opeelfvtltfarur(  ou4opxoioeiysfs2rmn pn(4 rxomf3ta1fa ean s t  rto(rpno4lpeemivilsfsDua(mp;u4ale mfeiasls2ra(vpnt4 eeomf iotfmte ivils s2xrir3ny4lmeemivia()aDrmxrp;u0apto o3ils m umuvp;t0 lxoio3oa1omDrliesl(0srxr(rpiodam nmictl(f rtrxrooo0texniieiydfmDulnmp t0arxomociadfpD anvo s s2xrir3nu4opte feslt sDra( oou0apx ifciyslaDul(ms ()tleoirciodop e nvs;()trumxopnydllte ivtl( a2um( pnu4openioctld m uaumpnt) rxoio3iotlp  aivi;t)tetr(rpiy4ole  ictl(faDumuroou4tlenmiciysfs2ra(vpnt0tlxoif ia1fmDe u i;s0 2tmio no4lpe  icias)srrm(  oo1aeeo o3tytfsDuanms;(0altoxf3oydlpteln ols0 rtm(r nudopee iviltfs2rrxr oo4aeeo i3iasfs2ua(vp u4tltrxfctatfp  ln i;( trurxopnydll nmnvi ()a2rr(mo;o0alt mi3iltfs rmu ont)trxoxo oodfm raivo t0 2tmir3iudomtn nctatf rtrx p;u4teeo f3iydfa em(mp t0 renmo3iydla elnes ( truoxrpny1ap e icsat a2umx poo4oexnioeiltla2uauvsn()alerif3ia1faDr nvslt s2uo(r3ou1olee nei t sDrru  ;o4olenmfctadfaDuanmo;(4 rxrmr3ty1om eaies ( setoimpiu4altnlivi s)sDtrx p;o1altoiictyt sDeln p t4trxrxrcoy1fmDrluvs t sexmxm3ny1ol e fcsltfa2uaxm nt4ole  ieildlaDrm(mp;u4trtoio3oy1fmte nvsls trxmxm oodolen ivil(  Drr( pnt0alen fetlsla raumo;u0 eeoircoadfpteln s s0seuoxmpnydal  mivt t) Dtmxrpno0tetomfetytfs ua(msnu4aetnmf ootfpDelnvolt s2trxr io1llen ies s)aDtaumoou1apx  ietydlmDemnvo (0 renif3ta1op  lnes;s) rtmir3io1omte ivsas) 2rmumo;u4tpe  feilt sDelnms t4teeomf3ia1omDeaues;(0sexmim3ny1lle lncsa() 2ur( ooo0tpx ioeildfs2rmn p;() eenmo tadomD  uvs t)trxoiopiudopenmicsl(f Draxrpou4ole iieiadlm rau s (0 rtrxrcoytopDeai ols  rumiopio1omee feil()srum(mp;t4alx ifetldlm ra( on(0aetrir oy1oa rai ils)srtr(m nudopeelfvsa(faDraxmonu1tlenifeiyd m2rlu s;(4 etnmr iytopDrlivs s0 2trxr3ou1lltnlfeiatf Drmx o;u0tptn o3ilsfm2ul(vp;(0 lerxf3oydoaDr ueolt0seurxr3ny4amtn nesls sDtaxmooo0oet ifeiatfs umu snt0artrio tadfmteanvi t0sruoiopiydamen icias)a2tm(  ou1apenio3ils s ra( s u4 ltrir iodomtrai sl( s2tmxo oy4lm   nvsls)sDum(r nt4teto o3tlsfa2uanvs ()arxnmo iodopDelivi;s0srtrxrpiodaltelncsas)srum(  no1teeomocilt a2rlnmont)tleoxrcoydomDelivolt t2xoxrpno1ope mfctat  2taur ot1aex  f3ilsfa ean s;u0alxomociy1lmDrlneo;( seuo(o3iu4lptelfvi s)aDum( ont1aee  iciatfsDea(mp t4teeoirctydlp   i o;()s2tmxr nudolenlieias a2um(mp;o1oetn f3iyd m ulnvon()aexoxf oadoaD lues (  rurxo oy1ome mics s a2tmu oou4teeomfeiysfsDelnvp;u0trerio iatfmtrlnes (0t2toir iy4lmtn icsa(f Dumurpnt4olto ociadla rauvs;() eeoxf3tytop eau o;s srurxopiy1lleelneia(fsDrm( pno1oetnmoctyslsDumuvo;(0trtrxr oa1oat luvo;s s2tr(m nodll  mfvsas s2um(  nt4apt mfctyt m eau pn() ltoifciytlmD auvi;t0srxrim nodam emnvsas)sDrm( oou4oltn oeiysfm umump;u0 rtnxr ia1lpt auvs;t)seuoxr3nydap nmivtasfa2raxrooo4apxo ieiatfsDra(vpnu0 eenxrciytomteaies;(  exm(r ou4ol n ietls srumxmpot4apxnio3iadfa rl( pnu) rtoxr3oatop  au i ( srxo(r3no1apt mieiatfaDuru onu0ope mfetatlm eln o u0 exomociy1omt  ies s)seumxmpnydlpenmfet ( aDrr(m no1oexoio3iatlm2eau p;() etnxfctadlmte uvs;()s2xmxm oodlp elnvi s a2um(rooo1tpeoioeilt m umumpn()tlxrxf3iydfa  auvo;t0trtoio3no1ll nmfvil(fsrumxmpou1tpx mieilsfs2ua( s t0altrmo oodlpt livsls)tetoir3iy1lp emivtas  ruaxrpoo1optoifctadfaDul(mp;t0arermr oadlp elueilt seumxrpoo4omtn nvia( srtm( poo0olx  o3iydfa raums (0 eeomf3tadlm eanei;s0 2tmim3nodlm   nvs t)aDrau  oo0tptnmicilt aDuanvp u4 exrmr oadfa e uvils)seumxo ny1amtn fvi s) 2rr(rooo4apxomoctyslm rlnvsn()altoxrciodom  ln o s)trxrxmpiudlp n nvtl( sDuau  ;o1tpx ii3tat a umnmsn() rtoif3ia1fmD anvo;s tetr(o oy4lmen ivi s sDraumpoo1tle if3ils s2elnvo u0aleoxrcty1fpDr i il()teurxo oo4olt mfvsat  2uaum ;t1apen iciyd a uaums;t0arxnircoy1op rau i;t0trxmxmpiu4op e ncs s sDtmxmpnu0tex mo3iltfm ea(vp;t0aexnif tatoat aies;t)sexoxo3oodlpt  ictltf Dum( pou4opx  iciyt aDean ont0alenmfcootlaDeln i;(  2xrxmpiy4aleemfetls) Dtm( oot0olx moctydla ranvp u4 eerircoa1oateaueilt0tetrxopoy4ap e fcilt  ruauroot1tpeoifetlsfaDrmnmsnt4 rtrmf iytopDraneo;(  2xrxmpnu4olt  ivt t)a2rr(rpot4aptomf3iysla ra(msnt)teermo3oodfm rlu i s0t2umxmpoy4ap  mnei ()arrmx  ;u4tlxomfciasfs2emump;t4aetoio iatlpte nvol()texrxr iu4lp nlfesa(fsDua(r nt0tpt mf3ild a rauvon()trxrmf3oydlmDeai o;t)teumimpno1opee net t)aDuau pnt1aetniietldfa2uluvs (4trtrxfcty1omDr i i ( setoim oydoptelfetl()sDtaxro;o4tlxo icilt a2rl(vonu4tetoxr oa1oat  nei;t t2xoxopny1lmee fvtls a2taxr ;u0tet  i3ilt aDul( o (4tetoir tadlmtrlnei;s  exmxm3iu1apte iesl( aDua(rpoo1tltomfctasls2ean on(0arxrmocta1oa elu i;s  etoio3iy1apenmncs s aDrr(mp;u4altomf3ilsfm2ra(mon(0alenxo iotoa ean ilt  rtoirpoydap   ivsl(f Drmxmont1ape  fciytfmDumumont4teerif io1fp eluvils) eurim oo1llenmivsl( aDtaxroou0oexoifcilt m2umnmo;u)trenmo3oodlpDraneo t0 exmir nodlmen fesltfaDum(r ;o1ope  o3ilt aDem( o;u4aeenmrcoodoateliei (0seuoxmpnydlle lfes (  rurum ;o4aex ioeiytla2uau s (4texrifcty1om   nei;()s2urxr no1lpte ics sfaDurxm nu0apxn fctlsfmDemn s;u0areoxo3tytopte nvo t) exrirpou1alenlnvsasfsDtmu  ;o1openmociytfm2em( o u4altrxoctadfmDeaies;() 2umxr3iodal  lfetlt)srtm(mpot1alt  i3iyd a ranvsnu4texrmf3iotlmD aieo (0seurim oy4olenlnvslsf 2ua(rp;u0tex  o3tltlsDemnmo;(0 rtnifctodop eluvs t0t2xm(m3iu1om emicta( aDtm(m ou1teenmfctasfm2rlumo t0 rxoxr iotomt aueils0srxr(r3iy4altemivilt)aDtr(m ot4oleoio3tytfmDea(mo;() lenmo iodlateaues;t0 etoxo oydlm nlfviatfsDrau  nt4ole moeiysfa ea( s (0 lxnmrciodfpDeaieils s2xmxopnodoltn iesatf 2rm(ronu1oeeoiietad sDuau snt4alxomo oadoa  li o s  rxoir3ny4amee nvi t srtm(rpnu0ape  fetys m2umums;(0teeomrciydla   nei s0tetrxm io1aptn nctltfsrrruro;u4olxoif3tyslm2ulums (4artrxo oadfm r nvs;t)s2tmxrpiodlmenlncsa()a2tmurp;o0tlx mo3ilt s rln onu)tlxnmf oo1fpt anes;(  2triopoodlpt lfciat)artm(rpnt1tlenmieiasfm2rlnvp;t4tltnmr3oytom  aivils t2xmio3ou1ol n ivt s a2ra(  no1tlt  o3iltlm2el(vo t0texomo3tadlaDeanvilt) rxmxm iudlme  neils) rra(mp;t4tee iictysfs ea( snt0aetomoctadfpDranvs (0trtmxm3no1llte ivilt  Duax o;u1tetniieiyt mDelu s;(0areoif3ty1fmt anvolt trxrim oo1lm  lfes t)s2ur(r ot0tlxoioeias a2rl(mpnu)tlerxo3ty1op   nvi (  exrxopio1ll n icsasfs2tm(r ;u1apen f3tlsfm2uln s;(4aeenmrcoy1opD anvolt0t2uoim3ny1altn ieta( a2rax o;o0tex moetysfm2ul(vo;u)aeerif oytla r u s;s)srxoim3ou4om n fcilt) rtaur oo0altn fctatla2ua(vs;u4 rxoio tytfmtr n sl(0 2urxmpiudopeemfvt t) 2tmumpot0tlx mocilt aDra(von() rtrir todfp eai i;s0t2xoxmpoudlm nlfctlt  Dta(  ;u1oltn f3tadlmDuau s u) etoxo oa1latrauvils  exrxr3ou4altn nctlt)srtru oot4olto feiyd a2umuvsn(0 leoxf3iatlatr n o s0teum(r ny4al  lfci (fsrrm(m ;u4aexoifetyt m uan pnt0 rerxr3iatomDe nes t)sruoio3oydlm nlieta( arrrxrpnt4olto oetlsls umump;t)aetoif3ia1lm r uei ( s2uoxrpoy4ale mnesl() rra(mo;o0teen ietaslmDemnvp (4trxrio oo1opD  n s;t)teuo(rpno1lltnmfvia( a2urxm ou4tlt  iciltfsDemuvp;u4trermociatfpt lieils) etoiopiudalenlfciat) 2ta(  ;o4oeeomi3iytfs ulnmo;u0teeoifciadfa eanvo;s0t2tmir oy4alt mfvilsf rurxrpnu1oee io3tytlm rm( on() eeriociodlpte uesl( srurxrpoy1optnmfcsl() rtr(mo;t0ale moetydfa ul( sn(0 etrmf3iatoaD  u s;s  etoiopio1ol  mfct ( sruax p;o1tptomoctytls ulnvo t0aexnifcio1fatr neolt)teuoxopno1al  lnes t srur( p;t4opxniociadlm2ea(vp;(0alermr3oydlm rlneolt t2xrxrpiu1alt mfvil()a2rmum ;t1tlxn fcilt s rl( pn()tlxrxf oy1op e u sl( texrim3oy4om emfcsas  rua(rono1oleoii3iyt aDuanmp;t0 lermociotfaDr nvo (  rumxo3iy1oltelnes sfsrtrump;o1opxo ociyd m um(vo u)texoiocoydla rlivil()t2xo(r3no1llee feslt) 2umxr ;o0teeniieilsla2rm(msnt) eeomrcoo1fp   i ols0t2xo(r3oodlp  mfcslsfartmurpou1tpxn o3tldlsDuau ont)trenmfcio1lp e ivslt) rur(o iy4alenmncilt) 2rrxmooo1apxomociyt mDel(vo u4 rxrio oytfm  ai o t0seurxm3oo1lm  mfctat srtrxr ;u0opto feils a ea(vp u4alermf3iatlaD livo t) 2uoirpou4llenlneil( s2rm( ont1tltnmfeiltfsDean pn()treoxrcoytlm  anvols0srtoir3oy4ole liesls) Durur nt1texnio3tldlm emnmsnt)aetoir iytla e nvs (0trumio nudap emici () Drm(rono0oleoioeiydlsDrluvo ()arenif ty1oateaueslt t2uoir oo1ll  lfvslsfsrtmxr ;o4alt mi3tyt a ea( s;u0tlxnxo iatfmDe ies s0seum(m3ny1ll   ivi t) Dua(mp;o0tpxoii3ild aDum(mont4 ltomf3ootfmtr ivs;s0t2xrxm3nodlm nmnvtas srtaxmpno1tet  fctldfm2rlumsn()tlxrmo oy1oateaies;t teur(rpnu1apt  nes ( aDtaxm no4alx mi3iat a2rmn o;(4 lxrirciytlm rau sls)s2xr(r3iy1ll nliet t sDuauro;t1tetnmo3ild a uauvpn()tlermr oy1latelnvo (  ruo(o3ny4ame mnvias)arraxro;t4tpe ii3iydls2ua( s ()arerxrctotfa elueil(  2trio no4amt mivtat  Duaur ou4opeoiocilt a2um(mpnu4arxnif tadfmDrluvs t  etoimpnudameelfet (  rurxmoou1aetomo3iys aDeluvo;t4tltoxf oa1fp eauvi;(  rtr(o iydal e fvtas  rrmumooo4apenmietas s2uauvs u)arxrio3oytlmD aivo s sexmxopio1ome mncs ()aDtauro;u4apx mieiytfa2uan onu0altoxfcoodlaD ln s t)seur(r oy1ll  liviat  Durxro;t1aptoiictat a2em(von(4altrmo oo1lp elues s0s2xmxo nu4omeemneiatf Drr(rpou0apx  f3iat m2rlu on(0aeeomo3iydfp e ies s) rtr(o3oy4ape lictatfa2ta(mpnt4opt  i3tasfm2eanvs t)altnifciodlmDr nei;t0 rtmio nudlltemicilsf 2tm(rono0open feilslaDra(vpnt4treoirctatomD li s t0tetm(m3iy1om n netlsfa2raxmpoo0opxniictltla ea( pnt0aeerxrctatomt an o;t0teuoxr3ou4ameemiesl() Dtrurpnt0oexniictydlaDum( s (4trtnmfciodfa rau o;s  rtoxrpio1altn neil(fa2rr(root1oltn o3iaslmDrmn pn(4aleoxr iotoa r ieols0trxoiopio1ll e neia(  Drrxmonu1optoio3iyd a ul(vo;u0trxomr iodop  aneo;s  etoxopny4om  livtas)s2urx o;u1oet  ieiyd m2rmnmpnt4arxnif3oo1fmtrau slt)seur(rpiodolenlneiasfartax p;t0teenmf3iysls ranvon() rxoxf3ty1om eaueil(  eumxrpoy1op e nei s)srta(r ;u4apx miciatfa2emu s;u) rtrmf3oytop rliesls0 exrirpno1ap  mnvtls)srtaxroou4opxo i3tad sDrmn o;u)texnio3tydfa eln ils) rxr(r3oo4om emicils)sruau  oo0aetoifeiydfaDrmums ()altrmf3oo1op rauvo s0 rxr(o iy4llenlfei tf 2umxmp;o1opt ii3ildla rlumsnt0tlenif3iytoaDelnvi ()teumirpio4op elicsl()srtr( p;o1oex iociytls ulump;()tltoio3tydomtelu il( trxm(rpou4omtn fvslt) 2tm( p;u0aexo fciyt aDel(monu)arxomo3oodfa  anei ()srxr(m3iodlpt  ics s) 2urum ;u1alt  ociysls eau o (0altnir oatomDe ieo;t0teuoio3ny1ale livil(fs2taurono1oltn f3iadla2em( p t4teerxf iotla  auvi s0setoxmpou1oltnmies ()aDraxmo;u1olen i3tyd s rluvo;t0 etrmf3ta1omt anes ()teuo(r3oodlp nlfes tf rur(mpot1apeomieiysfa ranvsnt0aexrmr3iatfpDe ies t0srtr(r3oodop nmnct t)artau  ;t0texoio3iydlm umu pn() rtrio3oatoate nvols)t2urxopoo1om elivtl()a2rrum ;u1opeo fetlsfs eluvo;u0trxomr iatlatrli s t)texoxmpiu1lm n ncsat sDtmxro;u4tpeoii3ils mDumnvo t) ltrmo tatoa e i ols t2xo(r no1ll nmfct t)aDtrurpno0opx mfeiasfa uaump u0tltnxr3oodomD  i i s0sexr(o ou1optnmnct tfs2umx  ;t4tpe ifcias mDrm(vp;t) rxnxo iytoatranvils) euo(m oo4apte ieslt)a2tmu poo0opto fetasla2rln p t0tlerxocto1op e uvsl() eto(opio4openmici t) Drmu  ;t4alx  iciytfm2umnvon() etoir iodla rauei;t)srxoxr io1ameemnvtls)aDtr(  ;t0tlx if3taslmDranvp;t) lxnifctadlmtelivilt trtm(mpiodapt lfes t  2tr(r ;u0tltoiociytlm2rlnvp;u)teenif3tytop r neols trtoxopnudlm nmfvs (  2uru ont1apeoifeiasfa ea( p t4trtnir oo1fp  ln o;s s2uoxo no1ape mivtlsfarumxronu1altnmi3tld m emu sn(4 eeomfcootlm   neo t0texmxr3oudale  icsa()aDrrumpnt0olen oetld aDrmnmo;(0alxrio oy1fm  ln slt0 exrir nydap  mnvtlsfs2uax oou0tle mfeilsfa2ua(mp (0 eenmrcia1fmt lueo ( t2urxm nodlp  miciatfa2trxm ;o0oeeoif3iytls rlu o;t4tltrxf3oadfaDraivs;s)texmimpoodll nmncias aDtaxm nt4apeomoctydlsDrmu s u4 etoxf oytfmte nvols0texmim3ou4lpt miei s s2ur(m ou0tptn iciysfa emnvsn(0texnmr3oadfm e nei s0tetr(m3nudolenlfci t artru p;t1openioeiyd s ua(ms;t0alxnif iadopt auvi;t0srtr(r nudam  mfvils  2umu  oo0ape  fciatlsDuan p u4arermf oytlmDeanvs t)teuo(o nodam nmivtlsfaDtaxmpnt0aetomoeiaslmDra( o;(4aetnmr ootfat  ieo t srtrio nu4lme mnctlt s2uaurooo1texomfetadfa2ua(monu0 rtrmf oydfp e nesls0seurxopiu4omenmnvsasfaDtm(r ou1olto fctytfs uanvsn(0 lerirciytlmD lues t) rxm(o3iu1omenlictat) rta(m ot1opxnmieiadfm raumo u)arxrmr iadfmtelueo (0s2xrim3oudllt mivta()s2um(mo;t0tleoif3iltlm ranvont0 eenxr tatlm   nvsl() 2to(m io4lm   ict s)a2ur(r no0aptomfeiadfs2ra(mp;(0texoxrciadlpt luvs;t) 2uoiopiy4om nmnviatf rrr(m ou1alx  oetysla2ea( p;t4trxrir3totomDran o;s trtrxo3oydapt lfet ( arua(mp;t0aet  f3tlsfa2ulnvo (0aeeoxo3totoatr neilt0sexmxmpiudlp nmfvilsfaDrmu  ;o1alt mieiaslm2ua(vont)teeoio3oatopteln s s)setr(r ny4lme mfeiltf 2tmx ont4tet ioctat m2uln s u4alxomo3iydom r u o;() 2xo(r3iu1ll nlfvtas)arurumpot1alenii3iyt m rlu p u)alxoxo ia1oaDe nesl( s2xmiopiodaleelnetas  Dtm(  no1tpxnif3tldla2ran p (0tlxnif3oatomtraueo;t0 etrimpno4lmt mies (faDua(rono1tlen iciasfaDem(mp;u) lermf tadfpte ivi;() rxriopnu4apeelivi tfaDrruroot1tee  feiyslaDemnmp;t0aexnmfctatfp  luvs;t0srurxr3iy4lp   netlt  2um(r oo4tpt moeiysfm2ua(ms;u)alxnif3totlpDrai o;t0 ruo(m io1om  mfcslsfa2rmxroot0aleoifeildfaDeau p t) etrxr io1lmt  nvo;t) eur(mpno4apt lfetl(  rumuroou1tpto feiasfa uauvp;t)aeermf3io1lmD  i o;t srtrim oy1altelfesas s2urx poo1apenif3iatlm2uluvp;(4tetomf3ta1fmt li i;s) 2xr(o io1al nlivilsf 2raumpnu1tptniiciydfa rm( o;u)aeeoif3tytfp rai i;(  eumxo3nodlmee fetlt arta(  ou0tptomo3tyd mDum(msn()tltrmr oodfm r u i;t teuo(o3ny1optnlieiasfsDurumpoo4tex mfeildls ea(vsnt0altoir iydlat  ueil(0seuoiopoodlpt lnei s  2uaxr ;o0aee mf3tatfmDemn p;u0tetnir3tytopt  n o;( trxmxr3io1al n nviasfarurxr nt1tpenmi3ildfaDrau o ()alxomrcoadlptr ueo;t  2umxr3iudllt mivils aDrmurooo1texoiieildlmDea(msn(0 ltnio oy1oa eli s;t0tetoxo ny4amtnmivtas sDtrx o;u0ope iictadfm rmu onu4tleomrcoodlmDrlivo ( sexoxo3iy1lmt mivs ( sruru  ;t1olxoifetadfaDum( p;u0aexnxfcootlm elivo;() etr(m3iudamen iei () rta(rpnu0ope  fciat m um(vs;t) etrio oo1laDr uvi;s seuo(m3no4al e nvias  2trumpno0oltnioeildla elumpnu0artrxf totopDranvi;s)t2xoxrpiydlle mfcta()aDur(  ;t1teen o3tldfaDrlnmo u)tltnircty1omDrlnvo t0t2tr(m3no4lp   fcia( sDtmum ;t4ape ifeiys s2ua(mo t)tetnmr tydomD ln olt t2xoiopiy4lme mfvt s sDtaur nt4olen octys s ulnvo;()tlerxrctadopte nes;t)trto(o ny4ame  nvsas arum(monu0apeoifciytlm rm(ms u) exrmfcoo1la r i o;s) 2tr(m oy1optnmiei t)aDurx pot1tlx iociat aDrmu s;()teermrctatoa  ai ol(  rtmxopno4llt mfet sfsrtr(m ou1openmfciys a2rmn s;() rtrxo ootom elies;(0trurxm iu4lltn fvtltf rrmurooo0aexoif3tyslsDuanvo;(0aeeomrctatlp  lnvo;(0s2xrxopoo4lpee fvtas  rtaur ;o1open i3tldls ua(vo t4artoif ia1oat luvo t) rxr(o oo1lptelnvi (fa2umxrpno4teto o3tytfm ulnvpnt0 lxrif3oytomt lneils0srtoxrpoodlptnlfetl(fs2uaurp;u1aee moeiadfa2ra( s;u)alxrxf3oo1lm ranei t trtmxr ou4lm  mfeia(f Dua( pot4oee iocildlm ra( o t4 rtnxf iy1faD au sls0 exmxm3iudomtnlics sf Dra(rono0oetoioeiytfmDrln s ()tltoxf oodoaDe nes;s0tetmxr3iodop emivtls)srtrumont0tltn fcild m emn pnt) exoif3oydoptrauei;s)trxmir3iodom e icsa(fa2rm( o;o1ale mf3ilslm2ea( p;t4 leomfcoo1lm e u i s)srtoxm3oo4lm nlicta()srum(r ;u1tpx mfeiyd a rmnmonu0 etnxoctatfm  luvslt trxo(r3ou1lmtnmiei s)sDum(mp;t1oetn ociat sDum(mo;(0 ltrifcoodopt luei;s0seto(mpnydop  mnvtl(fsDumur no4oltn i3tldlaDeauvs (4 lenxfcty1la  luvols)t2tmimpio1ole  ivil(fsruax p;t1apt ioetld s2ra(vs (0teerif3oydlp eaieo;() 2uoxmpoy1lp   ivt t)srtm(mp;u1oexnioetlt a2umnmsn()aexnmo iy1lmt li sls0 rxr(m iudol  mfei s) rrmur ;u1apen f3ilslaDean p (4 lerxf oadlm eaivi;( srtrxmpnodole lict tfsDta(m nu0tlx moetadls rmnvo;() leoxo ia1faDrlues;s0trtr(r iy1lltnmfci ( a2ua(rpot1tee ioetas m uan ont)trxrir tadlptraneo;() 2xrxm oydameemivsasfaDur(  ;t4ale io3iat mDeanmo;() lxoio3oytomDrlivo;s  etoimpio1lltemieta()s2trxm ;o4openmi3iyt s rl( o;u0 rxnxfctatlmD ai i;s)trxo(o3iydlme  nes t sruaurpnt4texnmietasla eaumpnt4 renir3oodfmDrlnvs;s0 2urio nodam emicsltfaDtr(r nt0opxomieilsls rlump;u)aeenxrciodopt  nei s0texoim3oy4altelnvsasfaDtm(m no1ale mociys m rlnvont)arxnxrciytlmDr ieo;s  2toxrpnu4ap nlfvtat  ruaxr ot4olt mi3tldlm emnvs;u4 renif ootfpD  nvo;s0 2tmxm oo1omee nvilt) 2rmumpou1olxnmf3tlt sDra(vpnt4trxnxf oodlatr nvi t) 2umxopiudole lfesat)aDua(moot0olen octat mDrm(mp;(4trxomf3oy1lmD  ueols) 2xoxopoo1amen ivta(fs2umx o;t4teto fciytfs ra(vp;u4tlenxfcoadlaD ai o (0s2tr(m3oo1olt mictat  rtaxront0olxo ietas aDem( p u4 lerir oytoat lu ilt) etmir io1ol emietl()aDtaxmo;o4aeeoioeild m rl( pnt)trtnircia1faD auvi ( srtmxrpno1lleelnvtat s2taxr ou0tpx  fciatfm2elnvs u4tltomf tydlp eanei t0t2xrirpnu1ol nlies sfa2rrxmp;o1aexnio3ilt sDrmu o;u) eeoxoctodfmtrai olt0sexrio iydlleelncslt a2uru pou0teeomfcilt sDrlumo t) eenxr3todom  anvi;()t2um(m3ou1ll   ictatf 2tax o;t4oexnmocildlm eanmpnt4 rxrxf3iadfpD an i t)srxoim iy4al emiesl( sDra(mont0ope moetydla2ranvo t4 exnir oadfa   u i;( trxo(r3oo4omeemncs ( aDum(mpnu4alxomf3ildlsDemn o u)aetomf3oydlpDe ieo;t) 2umio3ou4lleemivia(fsDuaxmp;o0oee mf3tysfaDrl( p (0alxrxo oadfaDean i;s seto(opoy1al  mivt s)aDuaxrooo4texo o3ildla ul(mp u4 rerir3iodomDeaiei s)trxoxo oy4lm nlncsatf 2ta(rpou4texnii3ils aDum(vpn(0 etnmocio1lmtrlnvi () 2urir3iudop elfcilsfsrumxmo;t1oee moetldfs2rlu snt0 rxrxfcootla rlnes ( tetoir nu1op   fcsa( srrmxm ;o0alenmo3tyslsDelnvont0texrif ty1lp elivi (  eumxm3oo4lme 
\ No newline at end of file
@@ -0,0 +1 @@
+uvi t0 eurxopio4lmtnlieia(  2trxrp;u4altniieilt a rl(mpn()trerif todfpteliei;s  rtmxr3iy4omenmivtltf rtaxro;t0oeenmf3ias sDeaumo (0trtnmo io1fp elnvi;s) rtmxmpiodapte fetl(f Drrxm ou1tex mocildfsDemnvs;(0trtnir3iydomteaivi;(0texo(rpoudamt licsls) 2tmxrp;t1tpxoif3iydlsDulnmo (0 ltnmocoo1op r n i s0 rurir ou1lltnmivt s) rtrxm no0tlt iocildlmDrmn p;t4tlxnmf3iy1fm  lu ols)teumirpno4alt lfet t sDurx  nt1alxniiciadfmDuan snu4arxnmrciotlp  auvs;s) 2uo(rpno4llenmfvia( sDrr( p;o0tlt iociysfs2rau p (4 exnxr3iytfm rlnes;t tetr(r oo4lp elfvsl()srtru ooo1tpeomoeias aDul( o;(4aeeoif oatfate ieo;( t2trxo3nodal emfvi () Dtrumo;o0apxnifetldfa ul(vsn(0aexomr todfm  ln s (  eurio no4lmt mnvilsfs2umxr nt0oet moeilt a ranmp;(4 exrxr3to1opD ai i;s)t2trxo oudomt lnci s  rrax  ;u0oltoiiciad s2emu sn(0 rtnio oo1fp r nei t)sexoio3iudal  mnet sfs2rrxrpou1oex  fciad a2rmumo u4alxrxrcoa1om elivo;t0s2xo(rpoy4aptelncias) 2uauront4oetomoeiys s2eaumsnt)tetnirctydla  aieils)s2urxo nodoltnmneta()s2raumpot0oeenioeiat s eanmpnu)texoio oytlptr u s ( texr(opio1om e nvtas srtmxm ou1aeen i3iadfm ulu p (0trerxrciydoa   n s ( srum(m oo4lpenmnctatfarrmx ont0tptomociltlsDemuvonu4 lxomr3totlmD  ivs;(0setoiopnodlp n nciasfaDtrx ono4aeeniieiat a2eln o u4aeerifciotlaDeaues ()teum(m oo1am   nes (f rtm(m ;o0olen oeiltlaDeaumpnu4tltnif3to1fa e u o;t0 2xr(opny4ome mfcil( arrax  ot0texnmo3tadfmDrm( p;t)aetrxo3io1la eauesls0s2trirpnu4lltelivtasfsrur(rpou1tptomfetadfmDemums;t4trtnxo to1oaDrlivols) 2umirpno1op nlncilt aDraumo;o0texn o3iatlsDuluvpnu0 lxnmoctadlat  neol(0trxrxm nudolte fcta() rrr(root1apxniictydlm2elu o;t0aetnxocoo1faDe ueils0s2umiopno1lltnlfvsl( srrmum ou0tlenmo3iyslm2ean p (4 reoxo3oytlmt ln s;s0 rto(o3io4olt  ictat)a2urxmo;o4tlxo i3ild aDua(vpnu4tlxoirciatlate nvo;()t2to(mpiy1amee fvta()a2tr( p;o4ope ifeils aDeaumpn(4teenmf io1om rlieo ()t2uo(r iy4aleelivils sDuaumpot0altnmfctls a rluvs;u) exoir3tatlptrauvol()seuoio nodlmen ieil(f rrm(mooo1tptomfciad m ua(mo (4 ltomfcoytomtr u sl( srxrim nu4ap  lfct s)sDrrur ;u4oleomf3ild s uanvo;(0trtoio3ta1opDelneils sruo(o3iudolenlieiat aruru oot1oet  i3ildfm ul(vp;(4aetoirctatfp  li o s trxmimpnu1lp   netlt sruax ont4aeeoio3ild aDrmnms;t4trxrmr3tadfmDeln i;s0sexmxm3oy4olte ici s a2trumooo0tet iiciad mDrlump t4tlxnxf tadfmDrlu slt texmim nodlme mictls s2umx p;u4ole iiciltfa uanvo;u)aeeomr3iodoaDrluvilt0srtrxopnu4amt  nvsls) Drm(moot1optnmfetyd m2uau ont) rxnxf oy1op elnvsl( s2tr(o3nodapenlfvs s sDtaurpot0apxo ocilslmDuanvonu0trtrxr3tadlm r neils  rxmimpio4lleelfvsl() rrrx oou4tpxnmi3iasfa rmn pn(4teeoif iatfmDrai o;s0 2ur(opiu1lp nmiesa()aruaurp;u1apeniieilsfm2em(vs (4artnmr3iy1lp r nvo s srtoir iu1am emfetls s2rrxrpnt4olt moeiadfs elumsnu)tlxrio tadfmD lu ols)srxmiopnodolt lict s aDtruro;t4alxo i3iadla emums t0aeenio3iy1lat  i s ( s2urxo oy1olenlfcilt) rur(r ;o0tpe mociadla ulnvo;()aetnmrcoatfpD  u i s0teur(m io1ll  mfvsl(farurx p;o4apxoiietatlmDuauvp t)tlxrircoodfateaueo;(0trtoim io1llen ivsl()aDta(m nu1aet  ociatls um(mo;t4arxnmrcoadlm  ai ilt seto(m3io1altnmivta(  2ra(mp;t0opx mieiad s rmumo;t0trtoxf3oodlmtelnes s  rxr(rpnydale lnvsat)s2urx pou1tpx iietat s elnms t)trermf iotfaD aieolt  eto(m iu1lm  lfvi t arrmxmpno4olt  ieiyd mDrl(vp t4treomo3io1opteanvslt0srumir3iy1opt mnctas srtmurp;t4aptn i3iaslm emu p t4arxnmrcia1oaD lnvi (0t2tr(r3nodopeelfvtat)a2ta(r no4tleo o3iaslm emnmont0 exriocio1opDeaueo;t seurxm iy4lpeelneia( aDrr(ro;t1tlxomi3iadlsDra(mp (4 rxoxo3oydfpDran i s)seumxo3ny1lptnlici (fsrurump;u0tpenmoetasfa2eanms t0 lxoio3oa1lmDran o;(  etoir iy1am emiesl() 2raxm ;o4altnifctyd s rm(vsnu)aetnmo iydfaDr ivolt)trtmxm3iu1alenlfvsas)a2tmumo;o1olx ii3iatls rmu o t4 lenmfcoatlmtr nvs ( setrxrpou4oltnmnciatfaDrr(rpot1oet  f3tytfs2eln o;t0 etrifciytfmDraneil(  rto(m3iydomt mfcsasfaruax  no4olxoiocilsfm2rl(vs;t4tetrif oatlmtean o s  ruoxm3io1op   iet s) Dururooo0opt ioetytfm elnms (4arxoir3tydfa eln o s)truoio3ou4lleelnes s)s2tax  oo1openiiciyt a2rlnmo;(4aeerir3tadlmtrlnvi;t sexoxr oudap emicils)a2urxrpnt4oeeoio3tadfa umump;t0aetnmo3oatfa   n s;s)tetrio nu4am  lieias)sDra(mp;u0oeeoifeiydfs ua( pnt4aetrif3tadfp rau sl()srumxo3oo4lmeemnes t srta(r oo0ape  ietlsfa ea(mp u)altniocty1fmDeln ols s2xmir3iu4lme lneiatf 2tmxmoou4ape mfciydlm2ulnmpnt0 exrmociydomDrln ol( sexo(m3oydolt mictl( s2tmurp;t4aee  i3iad mDra( pn(0areriocia1fmD luvi (0s2xmxopoy4op  mictlt sDta(r no1tpxo feiytla2rmuvs;t0texoxfcootlptr uvolt) etm(o no4oltnmnctat)sDum(  nu0oltn iciat a2ulnmpn() reoxrciytfatrlueo (0 2xoimpoy1al nlfciatfsDumump;u1oetn fcils a elumpn(0areoxoctotfaD ai i s) etoxr io1apeemneia(  2rax o;u0oetnmi3tyt a2rm( s;u)tlxnmr3tatopD lnvo t  2umxo nodaptelivs (farta(m ou0aleoifctadfm2el(vont)arermr3tadfpteauvs;t srumim iu4lmtnmfeiat a2tmuroou1tpto ociadfmDean o;() rtrmr oa1fp eau o;( t2xmxr3oo4opee fctlt)arrr(ronu4tpe io3ias mDeau o;u)aetoiocty1faDr u o;()srxoxopiydomen netltf rrau pno4opt  o3ildfsDuln o;u0alxnmo tydop r n il(  2tmxr3nu1lme  iei (f 2trxmp;t4oetn iciatfm2eau pnu0aexrifctatomt  uvs;()tetoxo3oydale  ivils srurx  nt0tlxoif3tlt sDrm( p;t4trermo3ty1omD luvsl() 2to(o3ou1ol emfvt ( arrmu pno4tptoioctyd m emuvont)treoio3iodfmDe nvs t)s2xoxm3iy1oltn icilt s2rmum no4tlen i3tadls2em( snu0arenmr3oa1fmteaueo s sexo(o3iy1altelfvsat)srra(monu4tltomfciyd sDeanvpnt)alxnmrcio1laD livi ()srtrirpnudale mfes tfaDur(m ;o0olenmieiydfa eanvpnu) eeoxr3tydfmD anvs;t  2uo(m3nodomenmfcsatf 2ur(mo;o0tlx  iciys m2rlumo u)trenmrciadfmtr uvi s)trxoxo3oodal  mics (fartax oot1apt ioeiyd sDeluvont4arerxo3iydlp  anes t0tetrxopiudlmee ivsl( srtax p;o4apen o3tlt s ra(vpnt4tlxrif3iytfaDelivs (0s2uoxm iodop e fetlt)srrax ont1aexomoeildfm2rm( o;()tltrxfctatfpDr ues (  2tr(mpiy4llte fctltf Dtm(rpnt4apxn fetat aDrl(vpnu4alxomocoy1fpD lnvslt) 2xmxo3iy4omtelfvsl(  Dtrurp;o1oetnmoeiytfsDemnmp (4aleriocoytoatr ivi t0 2urir ny4am  mivt s srtmum ot1tleomo3tytfs rm(vpnu)aeeomr ty1om e ivi s) 2trxr3oy1amenlfvilsf Drrxmoou0oee  fetatfm umumsnt4teerxrctodoaDeluvols  rum(r oo4optn ivtas  rrm( pot1opx ioetyd aDuauvo;u)alxnirctodlp elneo;s)t2urxrpoudape lfcsas sDtmxr nt1alen oeiyslmDeauvpnt) lerio3oytfm rlnes;t0trurxm3oodamenmfvs tf 2ra(ronu0alxomf3ild s2um(vs;()aexoir3iodfa rlivil() etmxmpiu4am e ncslt)aDurum ;u0texomf3iyt sDrlnmo t4teenio ta1oaD luvs;s0t2to(r3no4lme  nvtl(f 2tmumo;t0tlt iocilt aDum( pnt)tlxriocootlm e nvi;s trtmxopno1lmeelncias)sDtmu  nu1oex mociatlaDea( sn()tleoir3iy1fp elu i;s0 2urim3nu1lp emnciat)artaxr oo0aetnmoeiydfm umu s;t4 rxomf oodopD  uei;t0 eurio oodapeemfcilsf Dta(rp;o1tle mociyt a elu o u) eerxf3tydom  ln i (0 2xriopiy4lm  livta( artmu ono4opto fctas sDeaump;(0 lenxr3oadopt au o t  2tmxmpnudomtelici sfa2raxr ou1opx iieiasfsDra( p;t4 rermoctytoa rlueo s0 ruoxr3nodlptelncslsfs2uaxr nu1ole iiciadfs2umums t)tltriocio1oaDelueol() eum(r3iudomen fviat) Drm(r ot1tee  ictlsfsDea(mo u0 ltoxfctydlm  li i;t0t2umxmpou1alee nvsl(fs2tm(root0texnii3iltlmDem(vp;(0arxnmo3tadfpDraueo t0trxoio3nydapenlncs ( s2ua( ono0olxnmieiydfm2rmumpnt0arxoxf3io1fmteaies (0t2xo(mpou1olee fcsls)sDra(rpnu4ape  oetadfm2rmumsn(0 rtoxf oa1fa   ivi ( texrxm io1lm elnvils a2rmxrp;u1aexnmiciatla rl(mp;t0 lerirciy1lm r i o;s)seuo(opnudamt lnctlt srumuro;t4tlxnmf3iys s rl(mont0tleniociytoatrln ol() 2xm(opno1ap e ietlt)artaxro;u0aptn f3tytlaDrm( snt)texnxf3todomDr uvs ( trtmxopiy4ol elfvs ( sDumumo;o0tex ioeiadls2rmumo;t)tltoiociotfmDr nei;s) ruoio3oydlp n nvi s)artr(mpot4aee mi3ild a2eauvsnu0 exrifciatfpDr n i;t0tetr(o oodape  fvsl()aDta( p;t0olxn f3ilt m uau pn(4aeeoir ta1lptr uei;s srxrio iu1ol  licilt a2urxroot4aleoif3iyt s2uauvo u4trxnir ta1faDeaivi;( t2urim3no1ol  mfes ( s2uru p;o4aet iociytfa2rlumpnt4 lxrxfciotopDr nvi;(0setmxopou1al emnvtat artm(mpot0texomoeiydlsDuau p;(4tetomo iy1fmte ueo ( s2tmio nodlm emnviasfa2rrx poo4teeo feilsfm2rm( o;u) rtnxrcty1fm e uei;t srurim iodlme lfesas aruau  oo1oet iieias m umn on(4 lxrir tytomD anes t  2uo(m io4lm nmnvsls  2ra(ront4aeeniieiydfm umu o;t)trtomf3iytfat an sls)t2xoirpio4lmenmncils)sruru pot1optoif3ild a2rlnvont0 exnmo oydomt  nvs t0 ruoxo3oy4omenmivs t  rrm(m ot4texoioetydfs2ranvsnu4 ltoioctytlpt aueolt texm(m oo1aptnlncsat)aDurur oo4apt  oeildfs2umu pn() rtnifcoy1om rau s (0tetrxm3oydol nmnvta( sDumx oou1tle ifcild a rm( o t)alxnmoctadfat  ues;() ruoxm3io4lpeemnes s) 2rmum ;t1aetomf3tas a2um( s;t4 eerxrciytomDelies;t) rto(r io4lleemfcil() Dumxroot4tltnmfctysla rmu pnt4 leomf totfm elu o t)sexmir3oy4lp elfviasfa2rr(  nu4tetnif3iadla el(ms;(0 rermo3tatfp  luvolt0srto(o3oo4omte net t)s2uaurono4oexomi3iydfa rln ont4trenxfctydomtrlu s;()t2xo(r nodoleelncs t)s2rm(mont0oee iocildls2elnvp;u0alxoir3oo1la eln s (0srtoxr iodoltn ict (f rtau  ou0tpxnio3tys s2ea(vsnt4trtnxrctydop elivi;(0setoxo oo4ape  fet sfsrtrx ooo0aptn icils sDrlu on(0aeermf3oa1op elneol(0srtmxr3no1lm  mics s) rtrx  oo4ape  i3iytfm2ulnvpnu0trerxociodlptr ies s)seurimpoo1apeelfetasfsruaxroou0optnmf3iaslmDumn p u0 lxnxo oatlaD  n o;s)srxrxmpnodomtemivs sfa2ra(ro;o4apxniietltla2eanmpn()artoirciotlp eau sl(0 eur(m ny1ap  mneia()s2tr(ro;o4aleomo3iyt mDea( snt4aleomr3tatlpD luvo;()teurxo3nu4lptemncs ()artr(rpno4opxnmfctldlm um( s (0alxnmfctytfmteli i;s)t2umio iy4altelnctat aDumxmpno0aetoii3iltla emumsn() lenio iotfmDe uvi;( teto(opny1olt mfetasf 2uau  ;o4teeomfeiyd a rmuvsnu0aetrio oatoa   ueol(0tetmiopno4olt  ivil( sDua(  ;o0oexo oeildls ranvp;t4aexnxf3iatoptraiei ( s2trio3iy1omee ivs s)srtaxrpnt1aptnifcildls2ra(vo;(4 rtnxf ty1om elnvo t0 2tmio3iodapt  ivsltf 2taurp;u4tpt mfetlt a2rm(mpnt) renif oa1laDrlueols  eumimpou1ap   netas)srtaur ;u1oex mieilt m raums;t0 lxoxf ia1fm rluvil()teum(m3ou4lmt mivtas  Duau  ot4apxoio3tadlaDulnvo;u0arxoir3oytlm  lneo;s s2umirpiudope mfesls)sDrrum nt0olx ifctadfsDulumo;t)aeeoircoodlmtrlieilt)trum(opiy4lmtelncsa(fa2rrum oo1teeo feildfa emn o;t4 lxoxr3oydfmDrauesls0trtoiopoo1amtnlfesat)a2umumpot4tlt mictydlmDua(ms;(4trermo oydfateanei;t0 etoim3no4lm emfciat) rtm(ro;u1tptniietls mDem(vsnu4tlxnif3ootoat  ivils  2trxo iy1lp elieil(fsruaxmonu1apt mieiadfmDrlumo;u)arerifcoydop ran o t) rtm(m3ou1olenmncsa(f rtm(moot4alxoio3iyt m2um( sn(0 lxnxocoydfmtrlnvsls)t2toio3ou4om  lfvsat  2urum ;u0texoio3iysfa2rm(vont) eenxoctodfpt  uvi;s  rxmxrpiodlptemfct ( aruaxmooo1apto oetydfs ea( s;t0trtnxf oytomtr n sl() 2toxr3no1lpee nvt t) rumuronu4tltomfciydfs emu s;t4texoxo ty1oa eai slt) rtmxr ou4olt  ictasfarta(r ou1apt moeiadfs rauvs;u4tetnxocoytlm e i o;( t2uoxo ny4lm nliet t) rtmur nu0alxnmietld aDul(vs;u4trxoxrciydoaDeaieo;s0 2trio3io4op  micil(fsDtaumont0oeeomfciadfmDeau o;u0 rxnir3todlm r nesl() exoxrpny1ol nlfes ()arrr( oou4oeen fcild a emuvo (4treoio iotlp r iei;s0t2xr(r3oy1lptn nvi tfsDumumonu4ole mfeiad a2ulums t0teenmo3oa1fp e ieo t  euoxr3iu4op nlfvtat a2umumpnu0tetnifeiatla2eln s () exrif iydlaDelivo;s  exr(r iy1om nlfvt ( sDua( poo4olxn ociadls2el( p t)alxoxo oydfa rli s;t  etm(m ou1lmee ncs s)sDrmx  ;t0apeomfeiatfm2rmnvp (0tlerxf3oytlm rlueo t t2xrim iudal  mnesa(fa2tm(mpoo0tlx  ieiasfa2elump;(0aetnmr3totoat anvi s)s2xoxrpnydal  mneiat)sDrr(mpnu1opxnii3iadlm umu snt0 rxomocio1fa rlues;t trxo(r3oo4apt  iei t)sDurx  nu4opxnifcilsfm2rluvs;u4 leomfciydfm  ln o t  2urxm ou4aptn fcs s)s2ta(  nt4aleniociadfa2uau p;u0arxnifcoydlmD  uvils t2tmxo nudomee nci s srururpno0apx miciys s umnvp;()tlerircio1laDeaivs s) 2xmxmpiy4apen netatfa2raurpnu1aee moetydlmDrauvp t0aexrxf ia1fpDeli olt0srxm(o ou1ope livtl()aDra(mo;t4tlx  i3ilsls ranmp;() eerxr ty1lmDeaivs t0srtoxr3nu4al elnctltfaDrmum ;o0tltn fciad a2elumpnu) rtoiocto1lm e nvs;()t2xmim3no4ap n nesa()arrrxm nt4apt mfetas m uan onu) etomo oadomtelivilt) exoxo iodlmen ics s)aDta(  ot1ale mf3iatfa2uluvo u4tlxomr iodfa rli s ()s2uo(rpiy1lptelicsl() Dtm(mp;u4oleo feiytfaDul( s;t4areomo totlm rauvo ( srto(m iudlp e nviat)s2rrumpno0oeen ocildls2elu o;u4alxrio3oatfa e nvo () exoio3oudamt mivsls)a2rmxmpno1alen fctytlmDrl(ms ()aeerirctatoaD aneolt)srxoxopiy1ll e nctlt s2umxm nt4alxoifciltfm emu s (4texnircio1fa r uei t  rtmio iy4apee ivsl(fartrxmpno4aeto oetlsfm rl( s u0artnmfciy1la elnvsls0srto(r3oudale licsa(  2raump;o0texn i3tls a umnmo;t)aetrmr3ootla  luvs s)t2tmirpnodamt mivilsfa2ra(m ;o0oeeomoeilsls rauvo;u0 eenxo ootlmtr ies;(0t2tmim oydam n fesl(f rumu  nt4apeo feilt m eaumont4trxrmrctydoaDe nvs t teurimpnydlmtnlfcs (f Drrxmpnt0tlx  ieildlsDrm(vsn(4 ltnxr iydla rlneils0srumxopiu4opt lnvilt)sDrau o;t1tltn ictadla raump;u0aetnmrciadfpDrauvs;t) 2to(m nodlme lietat) rraumont4ale if3tysfaDrauvpnt)altnif io1fat anvs s teumio oo1om   ieias)s2uauroot4oetnifetatfaDrl(vsn(0alerif ootlm eluvils s2toxm3ny4apeelnci t artr(r nu4tle mictydlm ul( p;()aexnxr3tadopt lu ilt)seuo(r3oy4am  mnes (  rtax oot4opeomi3iasls2rmnvsnu4aetnmr totlm eluvo ()sexrir no4ale mfvta() rtmur nt0tpxnmociyslm eanvp;t) eeoxo3iy1fptrlnvs t0s2xrimpno1lle licsa(  rtmxrp;o1aeeniiciad s ean s ()treoxr ia1oatelnesl()srxoir3ny1apenmfvi ()a2rr(rpou0apto f3tad m2elnmon(4trxrir oy1fatran s;s) exoxmpoo4lleelnet t)s2ua(  ou1aex mfciat mDrmumsnu4tetrxr ta1oaDelnvsl( s2tmir3iydam n netat)sDtmumo;t4olxo o3ildlsDem(mp u4arenxr oa1fatelnvi s trxrio3no1opt lfvia(f 2umxronu4altoiietltlsDrmuvpnt4artomf oadfaDr iesls)trto(rpio4am  miet t  2urur ;u0aleomi3tad a emnmpn(4tlxoxf3todoat lnes s) eumxm oo4om  lies (farumx pno4olenifctasfa ulnvsn(4aetrmr3oa1opDeauesls  rxr(r3oudapte nvsatf rtrur ;u1alt ioeiasfm rm(vs;(4arxrmo tadomDran i;s0srtr(opiu1ape  nviltfs2umu  oo4oltn f3iadfmDul(vs u)trtoiociadlmD  u s t0s2ur(opiudlle lfvtat)s2uaumooo0tltomfetat a elnvonu4tlxrir3ty1lpte u slt)teuo(m3iydolenmnesat) Dtmx ooo4apeoio3ilslmDumuvpnt4tlxoir tadopDeln s;(0t2to(m io1ap   ivia()srrr(r ot1oleomoctysfm2uanvp t4arenxf3tytlmD lies;s) exr(o ou1apen fetasfsrrrumpnu0optnii3tltfa2rl(vo;u)alxoirciydfpD an s;s seuo(rpiydlmtn fesatf Durxm nu4optoii3iyt s2rmu pnt4arxoif3todom  aivs;s)s2xoxrpiy4opt mfviasfsDumurpnt0alenmfciytls rm(vsnu) rxoxr iy1fmteauvo t teuo(mpnu1lp   neiltfsDtr(  oo4apeoio3ils a2rmumo t)texnmo3iatfmDe n i t0s2uoio3iy4lp nlietlt) rtm(monu4tlto o3iltls rmu p (0trtoxf oytfmtr u o;t0 2xmiopiydom emfesls) Drrur no0oleomfetltlaDeau ont4tlxnxo3iydom  au o;s srto(r3ny1am  lfvsls)sDta( pnt4tptnmfctlsfsDemumsnu4trtnmo oodop  aueols)tetm(opnudll  mnctas)a2taur ;o0ope iocilsls umnmon() rxoxrctytfp  ln o () etoxo oudoleemfeil(fsrra( p;u1tlt if3tadfmDul(mon()tetnmfcoydfpteaiei t t2xrxr3io1ape  fes t arta(r nt0altoiieiyslm ua( onu4tltomf3oy1omtrlues ()t2tmxo3nodol n nctat) Dtrum nt1tetnio3iltla2umuvp () eeoiociadom ean o (  2ur(r3iydamenlnet t) 2taxmooo0aetn iciaslsDuan p u0aexoir iodfmt lnei;( s2to(rpou4lmt miesls a2ta(m oo1oexo f3ils mDelu s;t0aetnmr3oy1lpteau ilt0s2xo(r3oydlp elfcsltfsrtmum ;t1tee mi3ilslaDrm(vsnt)tetnmf ta1lp raivol( teurim3nydapt lnes (fsrururp;u0tltomi3tydfa2rm(vsnu0 eenmo tatfp  anvo;s) 2toxo io4ole lnvsa()s2rrum nu0tlx ii3ild mDeluvpnt4aexoir3oo1fptr ivi t0srumxr iy1llenlfcsl( aDtau o;o0texo feiaslsDran p;t)tlxrio io1om rliei;t0 2umim3io1amt lieta()sDtrx  oo1tpe miciydlm rmn p;()alxrmr3ootla rau s;t0s2trxm3io1llte iei s aDtm(mpot1aexoio3tldlm umuvpnu4tlenir iotopDr nvo ()seuoxrpiu1am  mnvta(fa2uaurpoo1ope ioeiyslmDuanms;t)teeomf ia1lmD ai i;t)srumxmpoo4op nlnctl(farrax  oo0tetniociyslm el(mo t4altoxr3oy1oa rai sl(0teum(m3iu1lleemfeiltfs2urxmpno4altn ociltfa em( o;u0 exnmf totomtraneo t) 2xm(mpny4ameemfeta(farrax ooo4aeeoii3tatlmDelnvp (4 lerircia1laDrlivi;s) exrxo ny1lp e ict s  rurxr nt1apeomf3iat s ua( pnt0 rtnmocta1oaDr neil()teumiopiudap e ncs ( arra(  ot4ope ifetadfa umn s;t0texrxo oatlm elivils)s2toim3ny4om n ivilsf 2raxm ;t4apeomo3ildlsDel(vo t)aeenir3oydfpDraneol(0trtoio3nydllenmfcsas artauro;t4ape  iciysfa2rl(vpn()aeeomr3tytop eau s;s srurxo3io4om elfctas)srra(m ;u4tptoiociaslm2eln p t0 rerir3iytla rlneo s0srxmxrpnodopeeliviat  2tm(rpot0aeenmfctltfsDrln s;t0aexrxrcoytfp  lu o;s)trtrxr oo4lme lfvils)a2umu oou1tetoiietasfs2rauvp (0teerxf3to1lmt  neo s) 2to(r ou4ap  lnesas a2ta( oot0oee  i3iat sDra(vs;t4 lerir3iy1latrluvolt0tetmxo3iu1altnlfetl() 2rax ont4ape mi3iat a2rl(vo ()texoxrciodomD lnei () rxmimpoodamenlfciasfartmx oot0oee ioctld a emnvp;(0 eeoxrcoadfmt aieol(0 2urir3iudlpte nei sfaDtmuronu4aptnmf3tltfm el( s;u)tltomo3oy1opDelnvi ()tetr(r3oodolen fcils s2umxmooo1alxomoeiasfm2eln p;() rxoircoodop eaieil()tetr(r iy4olte ics t aDrmxmp;t4olen ieildlaDuau s u)treomf3iatoa elueslt) rtrxr oo4lltnliciatf Dtrumont1olt mfeiys s2umumon(0 rxomo iatomD lueols  2xmxm3iydamen ietlt arumxmpno4aexo f3iatfm2rm(vp;t0 reoio oytop rau i;s teuo(m3ou1op  mncs tf rtaxm nu4tet io3tysla2umnmpnt)arxnmo oatoptelnes s0s2xr(m3no1apenlncs ()s2tmu  no0tex  iciydfm2em(vo;(0tlxoirciotlaDe i sls sexrio3ou1ome  ivi (  2rmu  no0tptn fetadla uan sn(0aleoxfctydomt anes t)seum(m nu1aleelici () 2ta(r nt0aptniociydfmDrm(vsnu0 rtrxr tatom r i i (0seumio nodopte netas a2raur ;o4tlxn feildlmDem(mp (0 ltnxfcoa1la r nvilt0trxm(o no4omeemfvi tf Dtmxrp;t0aexnioeiysfa2ulumo;u4treoifctadfm elnvi;t trxrio3ou4lptemfcsasf Drr(rooo0tpenmo3iltfm el(vp (4altoifctydopDr ieo s s2xoiopno4alenmfesas) rururpno1aet iiciltfa rmnms u)tlxoio oy1optelieols0 rxr(o oudom e net s srua( pou0openmiciadlaDul(mon()alenxf oatopD lueol( setrio ny1ame lict sfa2um(rooo1oleo fctasla el( s;t0tlenir3tadlp elieo;s)t2xm(m iydom   nesas  Draurooo0olen fetldla2emn s;t4 lenmf3oadlp   u o;t0 2toiopiy1om nmncsat)arrr(m nu4tlxoio3iytfa2eanms u)tltrmrcto1omDeau o;s) eumir no1am nlnvs ()s2rm(rpno4tpxnioeiadfs2ua(msnt) lxomr oodfmDeauvi;s)t2xrio3ou1lp n ncsa(fa2rmxm ot4tlx miciydfm eaumsnt) lxnxrctadfmD luvil(  rtrxr no4ame  nes (  Drrum ot0apen ieiadlm rauvs;()aexnxo tadlmDeauei;()t2toio3oy4lm emfctatfs2rrx  ou0aptnmf3iltfs2uan p;u0 rxrircta1oaDraies;t srtmio3iy1ome lfcsls) 2tm(mp;t4tpe iietadlm umnvp;u4alxoxoctotlmtrlu i;s  exm(m nu4lltnlneia( a2raum ou1tltnio3iydlmDeaumpnu)tlxnxocty1oateai sls0srxrxopny4openmnctlt) Drax  oo4opxniieiat m2rlu pnt4tlxrxf3iydop elueolt0 rxm(o iu4optemnetltfarumxmont0aexoio3tyd m2rlumpn(0trtnmf3oa1oa elu o ( srtm(m no4lpen nei ()arta(  ;u4tltniictadls2emuvs;() exomr oa1lpt  u ols0tetmxo oo1lm emnei s)a2uau p;o0alto octysfaDrl(vp;()trxrmocoa1op raueilt0s2toxm3nu4ole liei tfa2uru  ;o1aeenmociltlm umuvs u)arxrmo iotom rlies;t0s2umimpiy1lptn fetatfarumxrpnt4tpxo oetlt a2ean s t)alxrmociy1om rlu s t0teurim3oo4omtelivsas aDur(r ;o4tpeoiieiysfaDumn s u0 ltrxo3oytlpD  u s ( texo(m iy4lltn fvt tfsDurxr ou0tltnmietytlaDranmsnu4teenmrciatlm r neslt trxr(o iy4lme  fvilt)s2tax  ot1optnioeiydla2rau ont)treoxo3ootomDr neolt0sexoxo3oy1al n iesa()arrrur nu0alt iictytfa2el(vp (4 eenmo3tydfatr nei s0truoir ou4lltnlfct sf rtmxm ot0tpenmieiatfa rln o;u) eenifcoatlmDr i sl(0 etmim3ou4lmeemicils)aDrrurooo1tleo oetad m2uan sn(4trxrirciotla eluvo;s)srum(r3ny1ape livt sfaDta(r nt0ope iictls m rl(mpn(0aleoifcootlp e ieo ( tetr(opiodome  iciat) 2tr(  ;o1texo iciadfmDum(mon()tetnmf tydoat  nei;(  2xrio oo1alte iet s a2trur nt1apxoioeiltls ua(vsnu) eeoio3iotfmteaivils setoim iu1lp e fcia(f Drm(m nt1tpxomi3ilsla2rlnms;(0aeeomfciodoa ran i;t)texo(r3iy1al e fvi tfsrurumonu4apen ieiadfmDem( p;(0artrmoctydoptrln il()t2tr(mpnodap nliei t arrrurp;u4tetnmicilsfm uau s () ltrio io1optranesl( t2umim3io4al n iei (farraumpou0oet iiciad m2uanmp ()texrmo3tytfaDr ies;s t2xmxo3oo1lm  lfvils) 2rm(mpot0oexnii3tlt aDulnms (4aeeomo oytopDe n o;()sexrxm3oy1ape  nvs (  Drmur no0opt mietatfs ua( s u4 rtrifcoadoptrau s ( teuoxm nodlme  ici s a2urx o;o4aetniictltfs ranmo ()altnif3oa1op e i s ( sruoimpiu1amt  ict ( sDraurp;t1tpt mieilsfm2eauvs t0tlxomf iy1fpt aies s0t2xoimpnu4omtelnet s sDtmuroou4ope ifciadla rmn s t4 eenmrcoydfmtrluvol(  eum(m3iu1oltnmncsl( sDuaur oo0ale  ieiadla2umnvonu4tlerio3tadoa elivsl(0s2umiopoy4lmt mivias  rtr(m nt0tptoifcilslm el( sn(0 eeoiociadlatr nvil(0 ruoxr ny4opee fcilt)aDra( pnu0teeo o3iasfa eauvs;(0 reoxociadopt  neo;( t2urirpou1lpt lnvt s)srrax ooo0tlto oeiyt a2rau o;(4 reomr3to1fm rln i s)t2urxr3oodol elici sf 2rm(ro;t1oetomo3iytfs umump;()tleoio ootom rlues;()trxrxopiydal e fviatfa2rm( o;t4tex mfeiyd a2emn pnt)trermf3to1omDeln o;s)sexmxr nu1olen iciatf rumx  ;t1tptoiociad s2rlnmp u) exrmo oatop e ueol( texoir io1lltnlnct () rrru onu1opxnmfcildfs emump;t0tetomf ty1lptrliei;s)s2tr(opny4lpe mfetls) Dtr(rpoo1tpxoifciatfm elnmont0arxnir3oodomD anei;t setrir3nodopeelncs () rtr(rpno0teeomfciadla2uaump;u) eeomo totlptr u i () rxm(m oy1op  liet sfs2taur ou0tptoiiciyd sDea( pn(4alerio3oa1lptrlu ilt)sexmxm no1lltelnvt t a2rmx onu1aeeomo3ild sDua(mo;(4 lermo iytfaD  i s ()texoio3no1lm e ics s  Dra( p;o4oeto ieiys aDrmuvp;(0aetnmfcia1lpte ies;s  eumxr3ny4om  mncta(fa2uaurpnu4alto oetys sDrlnvp t) rxnxo iydopDr ueilt) etr(o iydlm  micil(fsDurumpot0ope ifeiatla eaumo;u0 reoif3iadop   ues;(0 rtr(opoydlpenlfei s arua(mont4ape  o3ils s el( s;()teenxr3iatlm  ln ils trum(m3oudam nlnvt ( s2ur(ro;t1aeeomo3ild sDel( pnu) lxomf3oatfatrlies;(0setmio3oo1ap n ici sfsDuax pou0tee ifetadls el(mp;t4 eermf iatoptelues;()srxo(rpou1lle  iesltf 2rr(m nt0aptn ictytlm2rl(mo u0arenirctytoatrlnvs;s0 2xo(o nu4olee ies (faDumx  oo1aleo ieilsfs2ulu o;u0tlxomrcta1lm rau s s0 2tmxr nu4opte fctasf Dtm(rono4olxo oeiasla ua(vo ()aexnxo ootfa rlnes;t0s2tm(m3oo1apte ieilsf rtm(r ou0ole ifetasls ra(mont4 lxnmr3oy1oaD li s;t  2tm(opiu1ome mfvt t) rrmum ;u0olxoifeiysla2rlnvont) lxnxociodfm eaies;s srxoim3nu4ol emivta(fs2rmu pot0opt mf3iadlm ua(msnt)tltoif3ta1fm  li i;s t2xr(o io1ap   nvsls sDrm(m no4olxn fciyd aDrln s (0 rxnxr oodop eau olt  ruoxo oy1ll nmfviat)s2tmur nt1aeenmf3tasfm2rm(mpnt0tlenircty1fpt anes t0srto(mpoo1ll nlieiat) rur(mo;t0tlxoif3tlsfm2uau o;() lerxfcty1fptrlu il( teuoxm ny4lpeemfcta(farrru  no1tex ifcild mDul( p () exnxfcto1lmDeauvo t0 rumxmpou4altemnct t)srrrx oou0tpx ifeiasfs rau onu0 ltoxfciytlaD an i s)teurio3io1ape  iet s  rraxrp;t0olt ifciat a rmnvp (0tlxnxo3oytfpDr neo;(0 eumirpou1op elnesa()sDrmu  no4aeto ieiyt mDrm(vo t0 lxrxo3totfmDrluvolt)seumim nu4altemnviasf 2tax ont1alxomo3iaslm uln s;u4arerifciotoa elnei;s  exo(m nydoptnliesasfs2um(roou4aexniieiyd a2rmuvo (4arxnio oydop eauvo ()seur(m3nodaptn nvils) 2umumont0tptn ocilsfs el(ms;t4 rtniocoadopDrln s;s0s2ur(r3iu1al nlfvsltf 2umumooo4ape iictytfs rl( p;u0aexnir3tadlp eaieols)texo(r ou4lm elivtls  rrmurono4oeto feiyt m rmums (4 eerio3iadla   uei;t0s2xm(r nu1lp  liesl( srururoot0oetnmfciytlmDelnvsnt4aexoxr tytlpDrlnes s srxmxr3iu4alenmncilt aDur(r ot0tpe iietysla ulumsnt4trenxr ta1fa elnvol()t2xmiopio4aleelict tf Dtr(rpoo0aet  f3iytfs uanvsnt0altrmfcoytfm  aueo (  2um(r iu1omte ics tfsrrmump;o1aleoiiciydls2em(vo;t4aeeoio ootfm e u s s  rumio no4ol emfciatfs2tax poo0tlto o3taslmDra(vsn() lerxoctydop elivs () rurxm iydapt mnesl()aDtr( pnu0tex  icilsfaDul(vp u4arxnmf io1late n sls0 2urir nudllen ivs s aDumurp;t4olxnio3ildls rl( s t) lxrmrciydoa e ieo;s)srtoio3iu4omtn neilsf rtr(  ;u4apxo oetld sDrm( p;t0aetoxo3iotlaDe nvsls  euriopoo1ol e neta( srtr(moou0aptnifeiyt sDrmnvonu0alerxr ta1fa   i o ()srum(r oudlltnlnesl(farrmurpot1alxnmoeiydlm ra( p;u4 ltnmfcoadfatr ueo s)srtm(opoo4lpee feslsf 2taxrpno1tle if3tydlmDrauvp;u0tlenxocta1omDr neo () 2trxopoodoleelfetas s2rrxr nu0opt ifetadfa2rlnvp ()teeomocta1omt livo t t2toxopnu4apenlnei s srrrxmpou0aee ifeiydfm uanmp;u4 rtoio3oodoa  lueilt)trtrxrpoy4ll  mfvt tfsDtaxroou0tlto fctatfa2rl( ont4trxoio oatopt lieols)truoiopoy1ole  fviatfartmur ot0tptnmfetysfm2ra(mo;u0 etrmr ia1lm eliesl( teto(rpou1ome lietl( aDumxrpoo1opt if3iyslm2ranvs;t4arerir3iytop rlueo t0s2urxm3nudomt lieia( s2rrumpot1oex io3ildls umn o (0aetomrctodopt an o s0trtoiopoudomtnmict t)s2rr(rp;o0oltnmo3iaslaDel( sn()tlerio3iy1lmDran i t0t2toxo3ou1lltn ncil()sDtruronu1ale mf3iytfm2uluvs;t)aeenir3oy1lat aiesl( texrxm oydal nmfeiasfa2umxroou4tetn f3ils aDuanms;t4texoxf3io1lmD an o;s0s2toiopiy1ale  fvta( sDrr(  ot1olxnmieils a uauvon(0alxnmrctodfaD ai o t0s2xr(rpnu1apt  nvta(  Dtmx  nu1alt mo3tasfm rlnvo;u)aexrxfctadfmDeanes s)setrir oodolt lncs (f rta( onu0olxn ieiytfs2emnvon(4trxrio3iatop ean sl() 2uo(opiydomen fetat  Dtauro;u1tle ioetatfa2ra(vont)tetnmrcto1opD lnvo;t t2uoir iy4lp nmnci t)arur(mpnt0tpxn o3ildlaDemnmsnt4tetomf iydlm raieslt)tetmxmpny4omtnmfet t sruaurp;u4oexoiiciydlaDranmp u0 ltrmf3iatlatelu sl(  rur(m3io1lleemnvsa( s2tru p;u0olenmo3tld m ul(vpn(0tetoxr iydlaDr i sl(  etoio3nudom  mfei s  Dtrumpnu4aptomoetytlm um(vo u)treoxf iatfpD li o t s2to(m io4ll e netl()a2tr(mp;o0alxomo3iltlsDrmnms t)artnir iadlp ean s;s) 2xm(mpiudlmtnliesl( arumx o;o1tpeomo3iyt s rl(vp t0areoircoy1oa rau s ( setoim3nydap nlncslt) rurxrpoo4apx  i3ilsfmDrauvsn(0 exrxrcoodfat  ivs () eumxo iydlpen ivsls)s2rr(m ;u4olxo ocild a rmn s t)tlxrir tatoat  i ils teurxo iu4olenlfes t aDrmum oo1opx mi3iys a2eauvo u0aetnio ty1omtelueo;t  rtrio oy1lm emnvil(faDumx poo0tltnifctas a2em(mo;t4alxnxf ty1lmD au i ( t2urim no1ome lict sfartr( o;t1oleo o3ildla2rl( s;t)trxrmo oytlmte ies;( sexm(r ou1lptn fcs tfaDumxmpou0oexnif3ilt a2ua( p;t4 etnxo3io1opDr nei;t)srtm(m ou4lpte fesa()aDuru poo0oltomicild mDum(mp;()tleomr ootlpte i i;(  rto(r3io4ape mivsas aDrrx ooo1tetn f3iyd mDul(vs t4arxoir oy1lpt an ols0s2xmim io1al e nvi ( s2tru  oo4olx mf3tadls elump;(0 eeomf ootfpD li olt seuo(m io1aptemfvsls s2rmuro;u4tpeomfciysla2rmnvs u)trtomf3tatfmteauvsls) 2umxopnydap   nvt s srrmu p;t4aeeo o3iysfsDuauvp u4arxnmr tydlptelnvs;()trxoxo no1om emfcias a2ta(  nu1oexnmociad s2elu o u4 exoio3oadlpD  ueo () 2xr(o iy1lm elfct sfarrrxm nt4tetomiciadfs rmums t0tetomrcio1fa  an ilt srur(m nodale lncsa(f rtmu  ot4aeeomiciysfaDelnvsn() exrio oa1fptelueils  2ur(r3nydom e fci (fsrrmu poo4olxniictltfmDean o;u4tlxnxo3iodoptr nei;(  rxrxrpoo4am nliei s)s2rauro;o4aeeomiciysls2rmn o;() rxoxo3tadfpteau o;t)texoir iydllt lict (  2rmu pnu0teenmoetasla el(vonu4 leoio3tytoptraneo;(0 2xo(o3nudome  fci s) 2ta(monu4texo ociydls umnvs;t4alxomo iadfaD  nvo s)setoio nydlmenlfeia()a2ua(rono4aptoiociys sDuanvo () rtomr3ta1lp  an s;s0trxrir3iydom nmies sf rtrxmpot0tpto oeiasfa umnmp t0alxnxo oadomDelu o t)sexr(mpoydoleelfcs sfaDumumooo0aeenioctltls2ea(mp;t4 rxoxfctatlpte n slt)tetrxopoy4am e feias aDtm( pnu1oetnmfeilt a ra( o;()arxnmr oo1fp   uvo;t srxm(o3oo4altnmfctl()sDrrx  ou4oexomo3iat s2em( o;u0 rtoio oa1om  li s;s) euoiopny1lmtemieia( s2urxm nt0aexo fctydfa rau snt4alerxfcootoaDr n il( tetm(opny4lm n fcs s  2tm(mo;u4texn iciyslm el( s;(0trenmo io1fm ranvs;(  rumio3iudam emfeias)s2tm(  ;u1altnmiciasfmDulnmp t) lenmrcia1opD luvsl(0texmio iu1ll  lfvsat a2tm(mpnt0apxnifeiytfs2emnvs t)tltrmf3tydoaDeauvilt  rum(o ny1apeelfeils aDuaxm nt4opx  ictytlsDul(mo;t4arenmrctatfpteanvs;(0 rtr(r3nudolte neia()aDum( ono4apeomfctltlmDrauvs t0trxrir iytlpDrlivs;s setmiopoy4lmen fet s)s2tmx poo0tpx io3iat s2ranmo u0tlxoxo3tytopt luvsl(0 eurio oo1omt mnesl(  rta( p;u4alxomfeiydfs2um( p;(0trxnxf3iotom rlnvi;s trtmir nu1lm  mnviatf rra(mp;o1ope  fetyt sDeln sn(4 lermrcoy1la  aivolt trurxrpiudop e nvtlt)srraurooo4tpx moctatfm2ra( o;() eenmf ootoptrai i (0trtoxo3no1am   ncils)a2rrxr oo0opxo ictls a2uanvpn()arxnmo ootlptranvols0 eur(r io4lm  lnvtas aDuru  ;o4aet  octas m2eanvo t0 rtrmo ootfa eanes (  rxr(o nodamt mfvil( s2tr(mpnu1tpx iicias m rau pnt4arerxf3ty1omtelieo;t setr(m3iydopt miesas  2raxr ;o4teeomf3tltla2emu p;t0 etnif iytoaD luvils) rtrim iy4optemnetas) 2tr(mpoo4oex  ietadfmDuanmpnu4trxrxoctytfat aues;t0 2trim io1op  lncsl( s2tmuroou0teenif3iad s2raumo;() lenio3tatfa  ln sls0srxmxrpoo1lpt mnvi t)sDur(mo;o4aee mfciat m2um(mon(4tl
\ No newline at end of file
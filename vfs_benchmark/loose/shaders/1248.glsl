@@ -0,0 +1 @@
+i i (0tetmirpoy1lm nlicia(fsDraxmpnt4olx iiciyd mDemnvon()artnmo3oytlpD lueols texoio nu4amen icta(fsDtaxm ou4oetnmietys m2ulnmpnu)trxnio3ia1fmtraies;t)trxm(mpou1ol nmict s  rrmxront0tlx miciysla2uln s;(4arxnmoctytlpteaivi;t truo(r3ou4lpe lnvi sf Drmxm ;t1optnii3iad aDuaump t0tetomo3iydfpteaueol() exrir iy4amt mivtl() Drr(mpno1tptn ieiltfs2ua(mo () leoif3tadfa rlivi (  rxoirpno4ol emfeils) rrmxm ;t1tee ifetad a2ea( ont4arxoxr ta1fp  aneo (0setrxr iydame mies sfsDumxrono1texn ieiysla2ulnmpnu4alxnxr3iadlm  auvi;s0srtmxm3oy1ome mfctat) 2ur(ro;o0aexnifetld m emu p;u4 rtomo3oatlp elneil()trumimpoudaptnlfvil( sDuaum oo4tlx ioetad s2uanmp u)tlerircia1fa eanvo;s) rtmiopny1op   ies sfsrtr(mpot0teen oeildlm2ua(msn()tetnmr3ia1fmtelivi ( srxoir oo1lle  nvi s)s2tau  ;t0opt mi3iatla rl( pnt0aetomf3to1faD aivs;(0sexrxr oo4amt mfeias)artax  ou1oeeo oeiad mDua(monu4tleoxf3to1faDeaieslt srur(o3io1apenmnvi t sDtmxmont4optnmi3iytlmDelump;t4 lerxf3iy1lp rauvo;()trtrirpiydal  mneils) 2tmuronu0ope  ieiyt a ua( pn()texoio3iatla rauesl( teuo(o ou1oleemneia() ruaurpoo0aleo feias m uauvp u) lerxr oo1fpDrlu o;()s2urio3ny4op  lnes tfs2tmx  nu1oexnioeiydlm2rm( pnu)artnmfciatfaD lneol( t2umxr iy1optemfci ( srua(mp;u4apeomi3iat m uaumsnu4 eenmo3iotlpDeanes () 2ur(mpiu4ll nlneilt)a2tru  oo0teeo ictldfm elump;u0texrmo oa1omtraues t) etr(mpnodlptnmnes s aruau  ;t0alt iictysfsDum(vo;t)trenmr3tytlpt  u i;t) 2xo(mpio4al   ivta(faDra(ro;t4oeeomfctldfm2ulu s (4 exnxf oodlpt lu o s)srxmio nu4am elicsasfs2trurpot0oeeoii3ild mDuan o;t4arermo oy1omteauvo;( t2urxo3oudlp  mnvsat srum(moou4oex mo3iad s rmuvo;u4alermoctytoateau il(  exr(opoydoptelict sfa2tr( p;o4oltniieiydfaDrm( p u0 rxnxo3oydlat luvo ( seuoxo3ou1alee icsat)arua(ronu4teenifeiys s2ul( s;t4 rxrmo iydlaD auvsl(  etoxmpoy1open fci s sDua(  nt4tetoifeilslaDra(vo t)aexrmocio1fptelnvsls0 ruoir3ny1alenmncs ( a2ua(  nu1aeenifeias s2em( o;t) lxrxr iotfpte u i t) etrxo3nodll  lncs t sDumx  oo1opeoifciydls2rm(vs;(4tlenxo3oatfpD  nes t) 2um(opnu1ame  ivta()arraur oo0openmociydlm2ulumsnu)tetnxrciotfp rai o;s trxmxo3no4altnlnvtasfa2rr( pou1alxn f3ildfm umnvo u4 rxoxo ty1fmDran o;s  euoxrpnydal nlics tfaDrmxr oo0oexnifcild mDeanvp;u4artomocoy1optean slt0t2xr(rpiy4amtemfet t  Durumpot1tee ioctls m2umuvont4altnmo3iy1faDrau ils)t2toxo3oydamen nvias) Dumumpno1oetnii3tysfmDumn snu4altrxfcia1la rln i;()t2to(o3iy1ope livt t a2rm(r ;o0teen icias mDrmuvs (0aeeoxr3to1fm   nvo;t0 eumxr iy1am  mfvtlt srumxmpnu0texnmieilsfa elnmonu4 rerxo3tydlpte uvo;()texrio oydll elneia() 2tmu p;t0tpen oeiasfs2rlumon(0 ltrmr3tydlaDrlivs;( teuoirpny1om  miesas arrmumpot4aexomo3tas a2raumo ()aexrmfcoadfa e ieol() 2toxopnodolte icsls) 2rmurp;o1teto o3iaslm eaumon(0arxrxfciy1op eau i s  eumxmpny1lmt lfeslsfartmu onu0ale iieiydfs2umnvo t)tlenxf3iotfaD lnes;() rumxo3iudolen ictls) Dta(rpoo0ape  o3ilslmDrlu pnu)aexrir3tydop e ivi s  etmxmpiy4om emfvtls)aDurumonu4opx  iciydls rm(vo (4 renxo ia1lmDrlnvi t) 2xr(r3oy1apenlieiltfsrtrxr ;t1texnmfcilsfa ulnmp;t4alerxf iytfa elnvilt0sexm(mpno4lpe lfvsat  2rru  ot1tpxo fcilsla umn ont4teermrcoatfmt aneol( texrio3iodolt lfvtas) 2tr(r nt4tet ifctad a2elnmp (0 rtnxf oytlpD ai ilt t2urxmpou1ap n ietl( a2uaum nt1tpenmi3iadls2uan o;u)texnmo3oodop   ies;t)t2urio3oo1lp e nciatfs2ta(rpno0tlt moetadfa em( onu)alxrmr oatlaDeai s t0srum(rpoy1amtnlfvi t)sDur(moou1oee  i3tadls2rlnmo (0 rtnioctodlpte ivs s)trtoxrpiodolee ies s aDta(r ;o0tltnmiciatfs el(von(4tetoif3todopD  u olt) rurxo io4am   ies () Durxr ;o4oetnifciadfs2elu p;(4altrmocoydomtean s t  etm(r iu1ll n nvslt artmurpoo4olt ioctad a2emums;u)trxnxo oodop e n i s setm(m ou1optnmfct ( a2ta(mpnt1tpx mfciat aDel( o;u0arenmr3oy1lp  ln s;t) 2trxr ny1aleelnvs tfa2ua(ro;t0apxn o3iyt a2ul(msnt) rtoirciy1oa rlnvs;t srumxmpiy1apte nvtltfaDtr(mo;t0tpxnmi3iasfsDrl(ms (0 lenxr3iodlpDe nei;(0t2toxopio4ame  nviasf Dur( o;u1teen iciadla ea(ms;u4trxomfciotoaD lnvo s0setmir iodale mnvs ()a2rmu pno4teeo feiys sDemnmpn()texrmrctydfpDrlnesls0 eur(m3nodll   net tf 2urx  ;o4optnii3iytfa el(monu0arermf iotfm elieil( s2xo(rpiy1lptnmfesl()sDta(ronu0ope ifctaslm2umnvs u4 rtnmo iodlmt lu i t teuoxm3oy4olenlfvtltfaDrr(  ot4tex  feiltlm2em(vont4arxniocty1fa r u s;( srxrio oodlmtnlivi tf Dta(mo;o1aptnmfciyd a2rmnms u4trerifciodom  lueilt trxr(opiydale mfeta(f Dum(mpnu4aptnmoeiytls2eanvs;u0 ltnmo oa1opte n o s)t2toxo nu4omtelfcsl( artm(mpnt4olx  i3ildfs ea(mo;(0aetrxocta1lpteanvs s) rum(mpno4omtnlfct s)aDrmu pou4tet ii3iat mDel(vs;t4 lerxr tytfp   i ol() 2tr(rpoy4amee fvsa( srta(r ;t1aetoii3iadfs2rmumo;u0arxoirctodlpteln ils  2toxopiudaleeliesl(fsrtmxrpot0texoioetatla2ulu o;t4arxomf ta1om rlies s)t2tm(opio1am  mfctasf 2urxrp;u1ale ifeilsls ran o t4arxnif3io1oaD  ues;s t2umio oodomeelfvi ( a2rau  oo1oltn ieiadfsDumuvp;t)tltrxr3ty1opDe nvo;t0 2tmir3ou1llt licsa()s2tm(mpot4tpeoio3iytfm el(vsn(0 rxoxo oytom ean o;(0 euo(rpou1aptemiei s srtmurono1alenifeiatfmDrmn o;u4aleoxf3to1fmt  nes (0srxm(o io1omt mneil(  Durur ot0optnio3iydla2rluvpn(0aeerir tadlat ln olt texrir3iu4oltnmfetl(  2rrurpoo0apxn fctatls ul(mpn()trtnxr3tydlpDrau i;()srtrirpnu4lle mnvia(fsDtmu o;t0tlxn i3tatls2elnvp t)aleoirciadlat  u i s)s2urir iu1lpen nvia()a2um(  ;u4tlenifctlslm ulnmsn()texoxr oydlmt aivo;t)seumir3iudome  feilt) rtmxrp;o4oex  ociyd mDrmnmpn() etnmrciodlp eau s;()texrir3iydlpeemict s)a2trx p;o0aex  fciat m eau s () lxomocio1lmDr u i;s  rto(m iydop e fvs sfarrr(  ;o1tex mo3tat aDeluvs;t4texnxfciadfaDrlivil(0seuo(r iudal  mfviltfsDrm( pot1oet iociys m el(msnt0 reoif oydoat auvo ()t2uo(mpio4aptelictlt)sDtm(ro;o4aex iociadfs eluvpnt0 exrmrcty1lmDr u il() etr(mpnu1opte fvt t)srtr(m ot4open o3tydfaDean o u4 eerif3ty1fptr iesls seto(o oudalt  ncias)sDraxmpou0alx  f3ilslsDrm(vo;t) lenmocoodlm eaies;s0srurxo oodol  mnvi t srrrx  nu1oexnio3iysfa eln s (4tlenmo3iadfaDeauvo ( srxr(m nudlltelnvta( aDtaxm nt0teto fciytfs uauvpnt4 lerif3oy1oatrlnvi;s0s2xoxm nudllt lnvta(  rtru oou4tlenmoeiad a2ulnmo t0aeerxr3ia1omtrlnvs t)srtrim3ny1altnlivs sf rrm( o;o1tetnmictas aDrm(vp (0tetoxr io1omtraieslt0s2xo(r3iu4lmtnlieia(  2tm( o;o1tptn i3iydfaDua(vsnu4 lxnio3tadfptr nvi;s teumim iydap e ncsas) Dtaxrpnu1apxnmoetysfaDean s u4texrmr3iydlm e ies t0trumir nydlmen nviatf rrmxront0oeeomoctltla2ra(vo u4aexrmo ta1la e i i;s) rtmirpoydomt  ictltf rrrurp;t0aexnif3tldlmDrauvp;(0aleomf3totopteai i t trtoxm iodop e fvslsf rururo;t1tlxomi3tlslmDeanms;u4tetomf3iotlm  lnvs (0 etoirpoodaltnmncias a2ua(rp;o0tptomoetasfaDem(vp;() eenifcoodlm r ivsl()trurxm3iydlleemnvs t aDraurono1apt ii3iat a ra(vpn(0teeomf3iotla elu o s0srxr(o3no4lmen ict s aDra( pou4aeen ietas mDrm( snu4altnirciadoaDrluvi;( t2trxrpiy4lpe mnciasfs2urxr no0ole  fciysla emnms ()alenxocoodfmD ln s;t  etrxo3ny1am  livsa()sDumu pot0alxomociltfaDranms t0tlermr iydoaD lueo;s)texoir no4llee ieias)aDumur ou1tlenmf3iyt s2um(vs u4trxrmr todfp   nes;(0seto(mpiy1alen ieiatf Dtmx poo4opt  o3iydfa emuvo;t4 lenxfcoodfaDe uvols) 2toio3ou4llte ici (fsDtrxmo;u0tpt mfeiltla ra( o ()trenxf3tadfa eaivs;s srtrxo oydlmee nci ( s2rr( ooo1tlenioeiat s2rm( s;t)treoxfcty1fmDe neo s t2trio3no4aleemieiat)s2urum ot4teeo i3iytfsDemnms;u4 rxrxf totfmt aiesl(0srumxm oo4om  mfctat)a2umurpot1texomoeiadfm uln o;t)arxnio3iadop  anvils0s2uoio3iy4omee nes tf 2ua(mono4oeeo o3ias s ul(vsn() ltrif3ty1oa ean sls0t2tm(r3oy1omeemnvilsfaDraxm oo4opeoiictydfa2eauvo ()artrir3oodlpte iei (  2xoxr iy4alt lncslt)a2rr( p;o0optomoetyt a rl(vp () rxomf3iodlpt  uei (  2xoxo3iydopeemncsls sDumxmo;u1opeo ociatlm um(mp ()texoir io1fateli s ()texmxm3oy1lp e ics ( a2rrurpou1olt ifeiysfa2rln s;t0 lermocoo1opD  u olt) 2umirpiu1lp nmictls)srumurp;o0tltn iciltla2ulumsn()tltrmr3to1omt livslt  2xmxo nodllen fctlsfsrtaxmpnt4tltoif3iadfaDeauvp u)altrio totfaDelu i s) rxrir io1apee icilsf Dta( o;t1aeen feiys s2um( p;(0alermf3tytfatran o;()s2ur(m oo1lm e fcsl( s2ur( pnu4tptnmi3iytls2ua(mo u0 lxrif3ty1fpDr nvs ( seur(m io4am nmietlt sDrmxmono0apxoioetyt sDua(mo (4 lxomfcoo1fatrlueo;(0s2tr(o3nydolt mfcil(f 2uaxrpnt0ape io3tlt a umuvsnt) rxoir iytoaD anes;s0 exmir iydopt  nvsas) Dta(mpou1aexo ietytfaDrmu s;u)trtoxr oodlat  ieilt  2xmxm iy1lmeelnvi ()a2urxr ;u4tpxnio3iadlaDem( s u)treomf ty1fm eaueo () rxrio ou4ll   nvsl( a2rau  nu1apenifcils m eau s;(4 reoio oa1lmD  iesl(0trxo(mpnu1am  lnvs (  rumumoot1aetn ietltfm2ea(mp;t4tlxrmrciodopD anvi;(0t2xm(r iy4op e nvsa()sDtmxm nt1olx micild aDrlnmp (0tltnxr3oo1lp eluvs;(0t2uoim no1omtemiciltfs2rr(mpnt0alto ietydlsDea(mp t)alxrxf3oydopDeau o;t  rto(mpnu1amte nci ( a2uru  ot1tlxo o3tld mDua(vsn(0arxrxr iy1fptrlueo;s s2trim3nu4ol nlnviatfaDtrumpnu4oeenifetldlsDrlump;t) ltnir ty1lpDr uvol() rxmxmpiodaleelfeiasfsDtax poo0tltomieiydla2emu pnu4 rxoifctatlatrau o;()trumir3nudlle  ncta( arrr(  ;u1aexnmf3iltlm rmu onu4aexoircoa1opt  u ols0s2urxo nodlm n ieiatfartrumpno4tlxnifciatlaDem( s (0 leomo3oydfp elnes s  2toxo3io4omtnlncsat  rrm(ro;u4aeeo feiat s2el(mp;u4artomr oydfmDelivils tetmirpny4omtn ietl(f 2ua(  ot4tlt mi3ildlmDua(vo;u0trxnmocoadoat aivi t) euo(m no4lp   fvslt)s2rmu ono0tlt moeiydfmDeanmo;t)tetomo3tadlm elieils)sexo(r oy1lltelfvsa()srrrx  ;t4tpeo octas mDem(vo (0 exrircoadoaDraneilt s2xrxr nu4opeelfeils)sDuru oot4olx  feiad aDrlumo;(4tltrio todom rlu s ( t2urim oy4alenmnctat)artrxm ;t0altomfcilslaDumnvp (4alxnxrcoydopt  nes s tetrir3iodol  lfei tf rrr(  ;o1apxn i3iat a uanvs ()aetrir3io1fp rliei;s)seuo(rpiu4lmenmictl(fsDrmxm ;o0oet if3iytfm2rlumpn(0 renmo oatfmD  nes;t)srtoxrpnydlleelivsasfsDtm(r nu1oex mocilt m2ulnvs (4aeermf iotlmt lieolt  ruoxmpny4lpt  net tfsDtm( p;o4tptoif3tys m2uln s;(0trermr oodlpte iei s)seuoir3iy4al   neslt aDua(rooo1opt  ociadlsDeaump;u)aeermrcio1faDelnvslt0 2uo(opoo4olt mnct tfaDtrumono4olxnmfctatfs eluvon(4 exrxf3oytfm eaueo (  exmxo ny4llt  ncsat  2taur ot1oeeoiicildfa2uau ont)trxoxo3totlpD anvo;t)srxo(r3iydlme  fctl(fs2tmum ou4olt  o3iytfsDranmp (0aetomo tydfm eaivi s0trtmim3nydomtnmneia()a2rau o;u1apxn o3ilt m uln o (4 etomo totomtr ivi ()truoxrpiy4lpe  ieiasfs2umx o;t4tptoif3tldfaDul(vs;u) rtrmfcty1fm  livo t  2to(rpny1al emfcils)sDum(moou0apen ieiyslmDea(vonu4 rtnmocta1laDraivsls)srurio nodome mfctatfaDumumo;t4opxnmf3ilsfm el(mpn()texnio3io1la rli slt) exmio3iy1omtn fcias)aDtmumpno0tee mi3ilslaDrlnms u4trxoxo oodfp   n s;(0s2to(m3iy4llenmfvtl( srrmuro;o0tetomietltfa rm(mo (4aeeomo totfmtelueo;(0s2umxo iudlme mieiltfsrrm(r ;t1oexnii3tysfa2ulu o t0tetniocia1laDe uvi;(  2xo(o iu4lmtnlnciltfa2rm(r ou1oleomf3tat aDea(msnu) ltnxr3to1fp e i il(0t2xoim iy1ol elfetl() Drrxmoou1texnifetlsfsDuan on()altomf oatfaD  u s t) ruoxo oy4am   fvs sfaDrr(mpnu4opt  o3iasfmDum(vo t) rxomr3iadfateluei;s0s2to(mpnu4am n neils s2rmu pnu0ale ifctltlaDua( p u0 ltnxfciytfaDran il(0srum(o ou4ap  mneta(f Dururp;u1texn i3iyt mDemnms () etomo3tytfm eluvol(  2tr(o3iudlptemies s artrurpnt0oexnioeiysfs rl(vs;(0 etomfcoy1fm  aieo;s)seum(r nu1lpen ivs ()s2umx ont0tpeo o3ias sDuauvp;(0trerxr3tytlm  aueol(0 rtr(o3iodoltelfct (fsDtaumoot1tleomi3tls s2rl( s;u) eermo3iytfmD  i olt)srxo(opnodol  mnesltf 2rmu pno4aex ioeiaslmDrmu o;u)artnmfciodlm  lnvols) 2ur(m3iu4olen nvt s) Draur ;t4tpenio3iltfa ea(mp u0tltnmr ty1lmte ivilt  2xoxopiu4lme miesa(fs2rr( o;o0olx ifetydfa ulnvs;t0tltrmfctotfmD  n i s)seur(r nodlm n neia() rtr(m ot1aexo f3tasla ua(ms (4trxrmoctodomD lueo s s2uoio3nydale  iesa()a2raumonu1opt ioetltlsDrm(vp u0teeoxrcta1oaDe u o;() euoirpnydamtnmnctl( sDua(r nt1apxnmi3ilsls2el( pn(4altoxocoo1fp raies t)srurir io4omen ics tfs2rmx  nt4opxnio3iyd m ra(vsnt)aexnmrcoo1op  aivs;t setmir no4amt lneiat s2uaxrp;u1alx  o3ils m uanmsnu4tlenmo tatom   ies s)trur(mpnu1lmee nes t) rumx poo1olxoifciasfa emu pn(0arxniociydla  anvil() 2xoimpny4lm n iciatfsrtax o;u1tetoiiciyslm el( o;u)aexnmf oydlpD  u i ()texmir3no1ope lfctlsf 2ra(m nt0altn f3tas mDra( s;u4 lenmr3tydoat auei (0s2uo(m iu4aptn fvsa()a2taum ;o0olt  ietldlm2umumo t)texnirciadop eauvs;t) rxmir3nudape livt s) 2ua( pot4oltn ietysfa umu ont)teeoxf oa1la  anvi s  2urxr3oudll nlicia(  Dumx  nt4tptniietysfmDrln s;(4 ltoio ia1lp elnes;t t2umirpny1apt livt t)a2tmu  ;o1tee moctatlsDrl( pnu0 rtnir3oo1op   i ol() rtm(r ny1omtn nei t)a2urx  ;o4olt  oetad mDranvs u0 rerxf3tatomD anei;(0t2tm(r3io4omeemfviltf rumxm ;u0optomfciadla ranvont0trxrxf ty1la  aieil(0 exrxopoydamt  ivt sfs2taxrpnu0altn feilslmDuau s t) eerxr oadla   neol()texmxrpoo4openmfvs (f Dtrx  nt4tltn f3iadlm uln pn(0aexoio iydfm r ueil(  rtmim oodlm emnvi ()s2tmxr no0tpenmietatlm eaumsn(0 ltoir3oa1fmD lu slt s2uoxo3iu4alt mfcia(fa2tr(  ou0tpxn oeiytfs uau o (0 rtnxr3oydlatraivols)tetrirpny4lmt mnvsl()arua(mpno4alto o3iysfmDeluvs t0treoiociotopDeai i s  etr(opoy1lpeemfci s)aDtrx onu0ale  ieiyt s2em( s (4aetnxfciytlat  neo;t trtoirpiydllenlnctl(  2tmu o;t4aetomo3tldfmDulu s t0alxoxrciotfmDeanvs ( s2toim oo1amt  feia(  2tr(  ;o1oee  i3iad a2rmu pnt4 etoiocta1faDe ivil(  eumir io4lp e nvtl(f 2trxront1opto fciat m rauvp (4arxoxo3tadomteai ilt0trtrxopiydapenlneia( aDur(monu1aexnmfctadlm em(vs t0trxrxo3to1lat au sl(  rxo(o3iu4ale mivs s)a2ururpou1oee  octat m2ra(mp;u)trxnxr iydfp e ivs;s)t2xoim3io1lmeelnvias arra(m ;t1teenifctydls2ra(vp;t4 lxoxr ty1fp r nvi;t) 2xoxm iudal   fci s srtrxmo;t0aet mictyt a2uln ont)tlenir ty1fa  lnei;s0s2xmxm oy4lleemiesl()s2rr(  ;t1aetnmfeiytls eanvpnt4 rermf3ootoa eluesls)trur(m oo1am e icslt) Drr(m nt0opxoiicias s2eau o;t4teeoxo3to1om eli s;(  exo(opnu4llee fet sfarrau  ;u4tlxo ieildls2em( p t) renmrcoytfaD lnvi;( texoxr3ou4lmeelfeils aDraxmpou4tptnii3ildfa emump;t)texoio io1fpDrln i t)sruoxo3nu4lpenlnvsa(fsDtrx pno0apxoiicildfaDuanvo (0 renmf tytfpteln sls tetmxo iodaptemivils)sDrmx ont1oexnmfctysfs2ranvp (0tlenircia1om elu o;s) ruo(m iydlptelivia(fs2rau pnt4aleomoeiatfs ulnmp u0tetrmo3oy1oaDrau o;s)t2toxr iydopeemfci s) rrax pou1tet mi3tasfm ul(vsnu0tleomo ia1lpt  uvo;t) 2urxopoy1ale lfviat) 2rrx  no1tpx mi3iat m el( o;(4tlxoifcoo1oateanvo ( srur(opnydlmtnmicslt  rrmx onu4oleo ieiysls2eauvo;t)alermociadfm  ln o s  rurio3iydop  mieiltfsrrrx  ;o1tpto ieiasfmDumu o u)tlerif3tadom   uei;()tetmxr3iy4lpte ictatf 2rr(mo;t4aexnioeild m2ra(vsnu0trtoxo oatoa  lneil()s2umxo nu4aptemfcta( s2tr( pnu4aeenio3tls mDeau p t0aeeomrctadlp raneo t  rtr(o no4op  lieia(fsDrrum no4optnmfciatfa2umuvs;u)tltnxf iotop eanvi t) etrxm3nu4am emieta()a2tau o;t1apx  ocils aDumums t4 lenioctytom eli slt0trurxm oydlmtnmivtls)aDrrur nu1ope mfcils s eauvsn(4 rtoxr ty1lm   uvi;( trxrxo ou4apeemnes ()sDurx  ou1openmicias a uanmsnt0 exnmf oadfat luvsl()t2umxr oo4amtemneils srtmxmp;t0tpt iiciltfsDrm( p (4aeeoxf oydop   n s;(0sexmio oodlmtn icias)s2umu p;u1opt iiciat a2rm( p;() etnxfctytfateauvil(  rxmxrpoudom   fct (  Drr(ront0aex  o3ias m2elnmpnu0 ltoio ty1op r iei;s s2xoiopoudomen nvtlt  rtrxr nu1tpx  ociatls2el(ms;u) eeomf3iadlm   nvolt0 rxoxm3oydll  mictltf rumu  nu4olen feiatfm2elu s;(4 lenmo3oo1oa   nes;t)teur(r3oudlm  lfctas)sDra(mooo0tleo oetld m rln p t4 ltoif oatfaDr n s s)s2urimpio1amenlncs t) rua(  ou0tlenmfeiyd sDumu p t)tltnif iotfmteln o;(0 exmxrpnu1op emfeias)aDraxr no4ole mieiltla2ranvp;u)tltoxrciytfp rauvs;s) eurxo3nu4lltnmfcs sfa2tm(mp;o0opt ioeilslmDrlnms;t)artrio iotfpt luesls0s2xrxmpoodlptelnct sf Dta(r ou0aeen ieiasls2umu pnt0 leoxociytomteanei;t) eumiopiu4amtemiesat  Dtru onu4tlxnmiciasfa um( s;(0tltnir3iodoa eanvs s setmxo3iy4lle  fes s)s2rr(mpnt1oet  i3tltls2uanvp (4aetoxr3oytoate nvs ()s2urio3ou4lptnmnvia(  rrrumo;t4oleo f3tld sDeln o;t0texoif tadoat ai o;( srxr(o3iu1ap  lnvtas a2um(ro;u1ope miciydfs eanmo;t)arxrmr3oydoaD aueo;t srto(o3oo4amtemiviltfsDur(rpot1aptomietltfs uanms u)aetriocoytlpD  i i;t)trxmxmpiodalt lfetl() Dtrx p;t0olx iociltla umuvpn(4 etnxr3iadoa e ivol( t2umir no1aptn fci s aDuax o;u1tee ifetas sDul(mo t0trtoxfcty1lpD aies;t srur(mpno4aptemietatfarrru pou4oee  oeiyd s2ea(mo () eenxrcta1omtrai o t0trtrio3iudome  ivi ( aDrm( oou4olx ifeiytla ulums;t4alxrmociydomD luvol(0s2umiopnodll emnvt t  Durxmpnu1tlxnmfeiytlm2ulnvo (0texrio3totla ranes ()s2toxr nodlm   ivsas  2uaurpot0ope moeiatlmDelumsn(0alxomo oo1la  lnesl( srumimpnu4lme mfeilt arrmxmpnu0aet  f3tysfmDulu o;u0 lxoifciy1fmte u ol(0srxoxo3iy1lme  ncsl(  2trx o;t4aptnioetldfm2rm(mo;()texrxrciodoateln i;(0texm(mpiydap e fvtat aDtaxmpnt0tptniieild mDelnmo;u)arxoio3iotfmDr uvo ()srumir3iy4ap nlfcsltfsDrrxr ou1altn fciyt aDea(mo (4trtrif3iydfm raieo (0trxo(rpnodll e net ()srra( o;u4alt  feild aDrlnvs;t)tlerxr iotomteluei;(0s2xrxopiu1ol nmnci s)sDrr(mpnu1aetnif3tls m ranvp;()treomf totop  au ol( seum(m3oudapee fesls  Dumx onu4alxomf3iydlaDrm(mo;t)tetoioctadopDe u o s0trxo(m ou1lm e nctas aDrmx  oo0tpeo oeias mDemnmpnt4 reoif3oytlmt lueo;s0 rtmxopiy4om elieiasf rurxmpnu0tlxnmfctltfm2ean p;() etoxf oa1om e ieol(0s2uo(o ou1olte fetltf rurxmpoo1texnmictls m ean o;(0 reomrctotlaDe u ols)s2umim3io4amen ies (f 2tm(rpno4opt mieildfa ea(mp (0aleomo totfpt lnvolt)seuo(m oudopt  icsa( srrmx pot4tetnmociytfaDumnvp u)arenio oa1opteluvsls)s2xoxm ny4ope mfesl()arrmxrpou4opeo fcilsla2emnvp u)teerxo iy1fpteln ol()t2xr(o3nudapen ncslt srtr(r ;o1teeomoctas aDuanvp;u4tlenir3io1fp   ivo s0 2xrxopoo1amt mfvi (fa2tru  ;t0oeto feiat a2um( o t)texnxo3ta1fmD  u s;t)seto(opnydlp  mncta(f rrr(r ;t4opt mfciasla2eluvo;t)trtrxr ta1fmD aies;(0 2uoxo3ou4al emictas arumxm no1open ociaslmDrm( p ()alxoxfcoodfmDe ieolt0t2to(m3nu1oleelfvsls s2umxr no0tltoioetatlmDranms;(0 rtnif3ootoptrli sl(0setr(r iodllen neil( arrru  ou4olt moetlt mDrau pn()arxrxrcia1omtranes;t0trxo(m iodlltn ivs ( sruax p;t1oexo i3tls aDranmo;(4artnifcoy1fmDe neils t2umio oydlp nmieslt  rraxrpno1opt  octldlm2ran p;u4 etnxf tytopte ivs;(0trxr(rpoo1amenlieia(fsrtau  ot0tpe mieils aDeanmp;(4treomr3iadfm e ueo s  2toimpoudlpenlivi (fartmuro;t4aeen f3ilsla eanmo;(0aexrircootlpt lieo;s t2toio iu1lp e nvias arua( pno4oetnmoeildla raump;t4aeenir ty1fmtrlu i t)teuo(mpno4lmen nvi t) rum(r oo1opt ii3iadla el( ont4 ltrxo oydop  aues;t) etmxm3no4oltnlneil( aDtau o;o0alt  f3tat sDeaums;(4 etrxociodfaD ln sl(  rur(o3iu4lleemnei t srtmumo;o1tpxoiieiys a umnvs t0tltrir ty1lpte u ol(0 exm(o3iudomtnmnvt ( artaxmonu0opxoio3iatla el(vs u)trenxoctotopD lieo;(  etmio oy1lm e icilt) Dur(m ou4tlt mfciytla el(vo;(4aexnifcta1fptrlu s;(0 2xm(o nudoltelieiat  Dra(mo;o0opeo octls s2ul(vont4tltrmr iy1omte ieil(0 exr(r oo1opee nvtas)s2ta(mpot0tet ii3tydlm uanvs;t0aeeomf3oytoaD aneo;t srumxopio4ol nmnetls)s2ururpou1ole ifciltlsDuanmpnu4tltomfctatlptrlues s) exrxrpoo4altemictat  Dta( ooo1ape mfeildlsDrl( s (4 ltomo oytlmtelnvo t) 2trio3nydalen ict t)a2rr(r nu0alxnmoeiytls2rmnvs t0 lermf iytlaDr ues t  2umir3io1lmee fvil(fsrtrx ono0oeenmi3tad s umuvp t)trxoxr oodlaD luvilt truoio3no4optnlnvilt srua(m ;t1alen i3iyt sDuluvo u4trtomf ootlmDeauvs;(0 2ur(rpnudllen ietl( s2trxr ;t1oeenioeiasla eaumpn(4trxrxr iy1oatelueo ()texm(m3iu1llte nvsls srrr( ont0tlxoioeiatlm elump t)aetrmo totlmt aieo s0teurim3oodllte ietls  Drrx ont0oleomfeias a2uluvs u4aeenxo ta1omteli i;(0 2trxm3io1lpeemnvs ()srtax pou1altoiieiyt m2ul(mp;u0teeniociydfa eau ils0teuoir iu4llt mieias a2um( ooo1texoioeiatls ranms ()arxrmfcoo1lmDraivs s seuoxr3oy1lltn nvtl( a2ua(m ;o4opxnmoeiltfm emnmp;u)trenir iydfpt  ues t sexrxrpoy1op n ics ()s2trxm ;t0optoii3taslm2rmnmo u)arxnio ta1la rauvo;t  2tm(m3no4amtemfvs t)sDrax pnt1tlx ioctatfs emu o t0tetnxf3iotfmD  u olt)srxrxm iu1lptn fesat a2rrxrpno1optnioetydla uaums ()teenmo oa1lpDrlu ilt setr(r3iy1omeemnvsa() Drrxm nt0tee mo3tltfsDuln p;t0trtoif todfpt  ieols)s2tm(r3nu4lpen ics t s2ra( pou4oeeoifeiydlm2em(ms u)trxoxr3iatomDrliesls0 exmir iodlpt mnvsl(fsDtrxmonu0olx mfcildfaDuluvs t0tlermo oytfmDeau i t  euoio nu4lp  lfesasfsrrmur ;t1tlenmo3iatfmDea(mpnu4aexrmf3iadfmteaies;t  eurir3io4lm emfvsat artr( pnt0aexoioetyslsDuanms;(4 exnmr tytom elnvols0t2tm(o oo1lmen iei (  rrmumono0texo fcilt m uaump t0artrmocia1optr nvs;t0texo(m3oodal  lfvtlt sDur(rp;u4aptnif3ildlaDrauvs;t) ltomfcoo1op rai ils0sexmxo iu4lm nlicia( sDtmu pno4texnii3tltfs2eaumonu4 etnmf oodopD lueslt)srto(rpiy4aleemnetas)aDrrxrpoo0opx if3tasfa2rmuvpn(4aetnxr oytfaDe i i;s  eto(o ny4am emnetlt aDra(rpnt1tlxo ieiltfa rm(vpn(0 lenif ia1lmtelivs;( t2xmxo3iy1omeemietlt)s2um( ooo0apeoioeildlmDel(mp () reoifctadoaDeluvi;t) 2xr(m io4olte icils  2ta( ono1aeto fetltfa ulu s;u4 eeoio3iadlmtr u o t trtmim oudal n nvi s sDrmu p;o1oee moetatfa2elnvp;() lxrmf tatfpDrau o () rxoio3nudap  mfes t  rraum ;o4texoifctydlmDel(vp t0 rermrcio1la raneilt)sexmxo3iy1olt lfvtlt sDrrx  ;o4opt mieiasfs emn o t) rxnxr oytfa rln o s  exmim3ou4ap nmfeias)sDurumpnu1olxo ietls a uanvsnt4texoxrctatop   ueolt  rxr(r oo4lltnlicia() rua(m nu1ape ioctltlmDul(msn(0altoif tytoat  uei;s)t2xm(m ny4lpt mfesa() rrm(mp;u1oexnioctatlmDuauvo;u)aeenxf3oa1lmDrlu ilt0trurxr ny4oltn fet s  Dtr(mp;o1alxniictyslmDrau p;()tlenif3iytfaDrli s;(0setr(m3iy4ol emiei tfs2umu p;u4aetn feilt sDuluvs;(0texrxf3to1fmtelieolt0seurirpou1alte fesatfsDrr(monu0opxniieildfa ua(mpn(4 lxrxrcoatlate nvo;t)teurir iy1omeemfciatfsrrrxrpno4oexn iciydfmDeanmp u0 etomfcoadfaDr ivi t srxr(m iu4al emfvils)arra(  ou4oleomo3tadlm2ua( s u0 rermo3oadfmt  nvs;() 2urirpnu4altnlietl(fa2rr(  no1alxniicild m rmnvo;t4 etnmf3oo1lpte u ils) exrio3iydllt  nes tf 2umu  ot1opxn ieiys aDeln pn()aexnmr3oy1laDelieo;s)s2ur(o oudlptn fetat)arum( onu4alx iicild aDeau s (4 ltoio3oodomD lu s;(0s2trir3iodllt mivi ()aDurumont1olenmietadls elu snt0tltnmr3tadomD  ues t sruo(o nudomenlietls) rtrxr ;u4optoiieils aDel(ms u)teenxfcia1oa r ivi t srxr(mpou1amtnmncta()a2ra(mooo1tee mociad s2ran o;t)arxrir3oy1fa elu s;s seuoio oodom emictatfs2taumo;t0aptniieilsfa uluvon() rxrmf3io1omDeauvo;(0s2xmxo3iu4oltemfeilt a2trumpnt4tetnioeiysls rl(vpnt0 exnmr iatlmDeanvsls)trxmxrpoudol  lfvia()aDraxrpnt1tlxomiciat aDua(mo t4 leomr to1lmtrau o t)trtm(o3oodlltnlfvsl(fs2tm(  ;o1oltnif3iyd s rl( s (4altnir iydomDeaneilt) 2um(m oo1omtelfct t)sDua( pno4aex  ocildfm2raumo;(0 eenmo ootom elivsl(0 exoxr3oy4amtnlict sfaDtrur ;o1olxnmoetydlsDrlu pnt4 exrmr iotfa e ivo s0trxr(rpnu1lm nmicsltf rtr(rono1oeen oeiatfa2rmu snt4arerif ia1lmDelivs;(0s2uo(opiu1ll e fcsltfaDtru  ;t0tleomfcildlsDeanmpnu) rxnxr3iotomtelivs s)tetrio3no1ap  lieta() rumxr nt0olenifeiyd a2em( o (0teenmo3tatfmt lnvs;()s2uoim nu1am nmnvtl( a2rr(mp;t0tex  i3tad s el( pnt0 eeomfcootomDranes;()t2tr(mpou1optemfcils srra(rpou0aptoiictyd a umuvo (4tleoir iatopt livi;( t2xrxmpnydaltnmnesat aDtmxr nt1tpeo oeiydlsDea( s;u4 eerif3oytlmt  ivo s  rtriopnydamtemfct sf 2uru  ;t4oeeomf3ias s rluvo;t0 exrxo3oatfateln o t t2tm(o ou4oltelfvtat)srtaurpot1oltn ietltlaDrluvon(0 reomrctodfm  an o;t srxrir3iu4oltn feiat aDta(moou4olxn fciytfm2el( s;(0 lxnif iytomDrluvsls0trtmxr3io4ale livsas) 2rr(r ou0oee  i3iltfa2rm(mp;(0 rtoxocoatfaDrlies;s) rxrir iy4lmenlies s  2rr(mo;u4tpxoioetadfm2raumont4trenxr3oodfpD  i o ()s2xmxo3ou4ll emnvsasfa2ua(rpot1apxnifeiad s2emnvp () ltoxrcoytoptrln i ( s2umirpnu4ole  nei s)aDurx o;o4tltnmoctadfaDrlnmo u0tltomr oatfp raieo;s)setrxm iy1oltemfeta( sDtrxr ou0alt io3tlsfm ea(vp;u) lermf3ia1lpt  ues t0t2xoxmpio1am emivtas  rurum nu1olen ociaslm2eln sn(4aexoir iytomte uei ( srum(m3iu4apenlncslt)srrmxr oo4alx iictas s2ul(msn(4 ltrio tytop r nvs (  2uoio iodlm nlfviat)srumu pou1tlt  f3iydfm emumonu)trxomr oo1lpt lues;(0seur(r nydale liei (fs2ta(  no1oet mfeiydfmDeau pnt) rtrir3ty1fmteaivolt)tetmxo oy4alt lfcsat a2rruro;t0apeoif3iltfm2rln s;(0 rxoxr3iotfpDelivsls0 euoir ny1lp n ietl( arurum ot4aeeoioetydlm emump;t4areoxf3iadfaD aneo;() euoxmpoydlltnlivta( aDrrum no1tlxomfetysfa2ulnmp t)alenif iy1oatrli s;t)trur(m3no4ome mnesat artaxm oo4tleoifeiltfsDeanvs;()tleomo3oy1lat  u ols)seuoxm oy1ape lnet t  2ta(r nt1oexo o3tat a2emu p;u4trenirctotom eanvs t0teurir3nydaptelnvil(f 2urx p;u1oet  o3tat s2rlnvp t4artoio3iytfate uvs (0t2trxr oo1lptn ivs ( a2ur( p;u0aex mieiadls el(msnt0 rtrmo3iy1opteau s ( srurxo3oy1altelfciasfartr(  ;u1aee iociyslmDel(mon() lxnif oo1oa   neilt0 etrir3iu4apee iviltf rrmur ;t4oet  ictat s2ulnvsn(0 rermo3totlmt au sls0 exrxm3ny4omtnlfcia()a2urxrpnu0opto oetlsfa um(vs (0trenir iy1la  lnvols0 2xmxr3oy4al  lfesltf 2tau oou1openmiciltls2ua(msn(0trxomr iatomtraueslt)s2xr(m3io1lpe lnetl(fartm( o;o1tpt iictlt a rm(mo u0tlxrmocootlpDelies;s)s2xmxopny1lpe  netlt  Dur( ooo4alxo ieiad mDumumpn()tlerir3iodfaDrlu il( tetrimpnodll   icils  ruru  oo4tpxo oeiat aDem( ont4trxomoctotfaDr uei;(0 etrxm ou1apeelivtls a2ur(ront1alen f3tydfaDeau o;u0 lxomf iotlatrlieol() rxoxmpno4open ivt t) Dur(r nt1optn f3iaslm2rmump u0 rtoxr iatoa r ueo;s s2xm(r ny4lme lietlsfs2uru pou4olenif3iyd s rlnvp;u4tetnmrciodfp   neo;t0s2uo(m iu1opeemnesa()aDtru  nt4teeoifciydla2uluvont0arermf iadlatranes s0seum(m3oudlmt mfvi ( a2rmuro;t4opxnmocils m rmn o u0aeeomr3oodfa eaueo t) 2xoxrpiy1opeelnvilt)sDum(r ;t0teto fciltlm2elu s u0arenxr3iy1lp elu ol()srumio nudopen icia( arta(mp;o0teeoioctlt s2umuvo t0tlxrxocto1opDranei t  2urxrpny1lmtn fvt s) rua(root0tlt ifeilt sDeauvo t)alxoxf tatoaD  uvi;t trum(r3nu4lp nmfcsls)s2rauront0tex  oeiltfa emnmp ()aetnifcoo1fmtrluvsl(  rxo(m iy4lmtemfvi t a2trx pnt0texnmo3iyt s2rmnmp;t) rxoxr3iatfmDrau o t0 eurim3no4amt  nvs (f ruau  nu4opx ifciadfa2ul(vpnt0 lxrmoctydopDrlu i t s2ur(rpnu1optn fvt t  Dtaur ot0tee  ietls a um(vp;u)tetrif3oodfate n s;(0sexoxo iu1ll e iciasf Durxmo;o4tpxo fetasls2ea(vsnu)trxomrcio1fm e uvolt)teum(r3iudalt  ncslsfarta(r ou0aetoifeildfs2emu s;(4 lenxocoy1fpDrli i (0trxm(mpou1ap elfes tf rtax ont1ole ioctadla2ulu o;(4aeenxr3iodfmtrai slt0 rto(rpno1lmenlneiasf Dumurpoo1apxomfeiysfaDeanvont)aeermf iodfpte neo;s)trto(rpnu1lmt  ictl(fartaurpou1alen oeiys aDrl( p (0 lerif tydlpteaueo s)t2tr(m3oo4ape miesl( aDrrxrpoo4teen fetas sDrluvs;u0tlenxfctydoat  u ilt)sruoiopio1al nmfcs tfs2uaur nu0tptomoeilslsDumumsn(0 renif3ia1fmtrln i;s srtoxrpoodom emnctl(faDururo;o0aeeomociysfm rmumo;u4 ltomr totlpDe uei;()teuoir nu4lp emfes tfsDtmxm ou0tpx  fciyt sDranmsnt) exnxrcoadlmDrai il( s2umxopny1al   fvilsfarra(m nt1oee iieiat m eau ont0altrifcto1laD  ueo s0truoio3nodame mictls) Dtmumpnu1optnmfetldla uauvon()aetnxr io1omDeau o;t  2xmimpoodopeemict tfs2uaxr no0tpen oetat mDrmuvp;u4altrmr to1fa e neil( srxmir oudlle micils  rtmxr nt0aleomfciltlm2ran snt0trerio iytfatr neo s)t2to(m3nu4lmt mneilt)s2rax pnt0tptomoeiatlm ul(vpnt)aexrxo3iy1lmDelu i;( setoxo3iydamt  fvil(fartax pno1altn oeiytlm ran s ()tltrmo io1oaDrliei;( texrxopiydomenlneta()aDuaumo;o1tlt  oetltlmDrl(ms;u0arxoifcoo1fmDraieo t) eto(m iodlp   neta( s2ua(r ;t1tle io3ils a rl(vo;() rtnxoctotfpDeau o t  exmim3nodol n netltfs2ra( pou4aptn iciysfaDel(ms ()trtrxo ta1la  au i t)srxmio io1lpt lncs t)sDta(ro;t1aeenmo3iyt mDuanvo;(0arxnmfcia1lmt  u ilt0srxoio3oo4apt mfvi ( aruax o;u0apen o3iysls2em( pnu0tetrmrcoatfp  auvo () 2to(rpoy1op nlnetat)a2ur(  ;u4olt moctltlaDua( o t0alxrir3oy1latraieilt teto(mpoudlp  lfci (fs2ua( o;o1aexoii3tls a2eanvs;(4alxoxfcoodomDrauvsl( tetrim3iu1al  mncs (  2rmxmpoo1tetoii3iltlaDrau p;(0 exnif3iydopD lnvi;t  etoimpoo1lp  liei ( a2ururpnt1tpt iociasls em( pn(4trxoxoctatla r n i;(  2tmio3nodop  lfei ( s2rauro;o1tee  f3ilsla elumpnu)tlxnxf3io1op raieo;()texoir nu4ll eliviltf Drm(rpoo4aptnio3iyslaDeanmp;() etrxociodlate ieols0 exrio3no4lp nmnetasf Dtrump;o0apxomo3iat s uan o t4 ltoir3iodop e ueslt  2tm(o no4oleelfes t)s2ta(monu1tpxoioetyd aDemnmon(0artoxo3tydom r ies;()truoxrpoudll  mfvi s sDtmu ono0teenii3iyd m2el(mp;t0trxnmr ia1la e uvi;s trtm(r3iydal nmici s)a2ta(mo;o0tet iictysls2rl(msnu)altnxfctydoa  aueo;()t2xmir3oy1lp e ieilt  Dtr( p;t0apx if3iyd s2rmumont4aeeoio3oa1omDran ilt)s2uoxo iydlpeemfetl(  2raur ;o0oetnifetydfs2ea(vo;(4 rtoxf iotfatean s;( s2xoio3ny1al  mfviat  Drru  ou1texoiictasfa rmu s;t4tltoxo tatop   uvols  rtrio3nudapenlfcslt a2uru  oo0ole iicildlm2ua( o;(0aleoxr oodlpte ieslt)sexr(o iy1lpen nvtls sDumu pot1tetn fcildfaDra( s u)altomo3tytlmDeai o s texmxmpiydopeelfcsl(fa2raxrp;u0optnioeiadlmDrmnvo;u4 rxoxfctydoaDeanei t)t2xmxmpio4ol  lfct (fsDtmx  ou1opto oetlsfs eauvs;(0trtnxo3todop eaueils)t2xr(o oy4apee nciatfartauro;u4opxn feiytfs uan o;u)aeermo3totfatraueilt0 2xrxo3ou1lmee ictl()arurx pou4tpenmoctlt a2uanvs;t0teeoif3iatlpDr n s;s  exmxopiu4ame mivsasfaDtaurpot0oeenioeiysfmDeaumo u0altoio3tydoa e ueo;s)trumimpno1lleelict tf 2tru  ou1oltn feiysla elnvsn(0 reriociadlpteaies;s0 rxr(opio1ol  micil(f rumxm ;t1aet ioeiytls el( p (0 reoxf iytfmD lneo;(0s2trio oo4lpe  iesls)aDrr( oou4oetoiieiyslm2el( sn(4tleoifctadfa eauei ( truoirpiodom nmivslt aruax  ;t1apeo fciydlsDea(vpnt4aeermf3oydfmDr n s;(0s2xrxm3io4ole livia( sDtrxroot4apen ieiatls2eauvp;t4artrif ty1omDr n o (  exoxr iodole  neiat) Dtmx oou1tex moctadlsDuaump;u0 lxrmocta1om eau ols) 2tmxo3oydap emfciasf 2trumo;o1olt  fetldlsDrmn on() exoio3tydlm   i sl(  exo(o3ny1lptnlnviat a2ur(  ;u1altomocias m2um(msnu4 lenio3ootfpt lnvo;t) 2umiopoy1amtnlics t aDra(m ;u1tpxnmi3tydlmDrm( s;t4aetomo iadoateauvs;t t2um(opoudam nlncilsfaDtax pou4ole mfeild m rluvonu0 rtnxf3oa1lptr n i ( setoxmpiy1apenmfcilt)sruru o;u4tetnmoeiytls umums;(4alxrmf todfm elivs;()trtmio3nudlpe  fcs s aDur(mo;u0optomfciad a uan o t0aetrmociodlpD ln i;t) rur(r oo4ap   neslsfsDuaurpno1tlxoioctld sDelumsnu4tetnir iotfm   ivolt0setrir3io4ameelnctl()sDumxrp;t4alenii3tyt m2ua(vo;t0altrmo oydoa   nvi;s0 2um(m3oo1optn fei s  2rrurpou0teenifciydlm umu o t)altnir oo1omt lieo;t)teumio oo4amtnlivsl()arurxmoot4aexoif3iydlsDuluvo t4artrio3oydlaDelueo;(0setrxo3no1ameemfcils a2tmumo;u0oex ii3iatlaDuau s u) rxnmo oy1lmt  ues t)trumxr nu1olen ieil( a2rmur ou1olto iciyt mDrmnvo u4 rtnxociy1fmDeln ols sexmir3ou1amee fvtl(fartm(moot1opto iciysla uln pn(0alerif tadoaDeliei;(0 rum(o io1lptelfci tfsDrmur ;o0oetn feiatfaDrmnmo;t) ltoxfciydoptelnes;s t2toimpno4apt  ivsa() ruru  no0aeto fctydls ul(vo u) lxnmf oy1lmteauvo;s0 rtrxm nu1ap elncilt  2rr( poo4tpt  ociytls el(mpn()aetoxocoytlpte u i;t0teurir3nu1apt mnes tfa2trumoot0ape if3tatla2rau s;t) ltrmf3ta1fm rlivslt  rtrxmpno1olt  neiat s2ra(  ou1apxnif3iyslm2rluvs t4alxoif ty1lp r nes ( teurimpny1aptnlnesa(f 2tr(m ;o1tpxnmo3iadfa2eanmsn() ltnxf3iadfmDe nvols0s2tmxrpiu1lp nlfeiltfaDuax  ;o1oet  i3iatls ulu p;(0tetrxr3iydomDe n sls s2trio3oo1apenlics t sDrrx  nu4tetn i3tydfmDrl(vs (0 rtomo3iydfp r u s s0teumxo oo1lle lfct ( aDrruronu1olenmo3ildlsDrlnvo;t) eenmf3tytfp e ues s srxo(mpio1alee nvtas)aDururoot1olxomociltlmDea( p u0trtrxo iytomDe nei;t srtrxo3no4ape  fcs t)s2tau o;o1alx mociytls2um(mont0tlermo3iodlp rluvi;t)tetoxopnu1alenmnviat  2rmumo;u4aee  feilsfs rmuvs u0 eeomr3todfatr u i;() etr(rpnudome  ivi s aDtr(rpno1opx  f3ils aDrmuvpnt0 exoxrcia1fat  neo t) rtmir3io1lltnmivtl(fs2umump;t1tpe mfciytfaDra( pn()teermf iy1lpt lneo;s  rxoim oodop n ivi tf 2umumoot1tpxn octas s2uau pnt4areomr3oodlmDean ils s2umxm3ou4op emivils  2trxr ou4tlt  f3iad s elnmp (4 eenxo iy1omtrlnvi;( srxr(mpoydoltelnviat) Drmxmooo4optnio3tytlsDul(vo;(0 ltoir3oo1fpteliei;(0t2tm(o3oy1ape  fctat  2trx pou4aptnmicilt mDrlu s ()tlerif iydfmte uesls truoxopio1open ncsl(f 2rax  ot1tlxnii3iyd m2eauvo;t) leomf iytfptr nvo;()truoxmpiydlmen ieiasfarurump;t4teeoio3tyd a2uauvp;u)arenmf3oa1lm e ivils) rtmio ou1alt micsltf rtau  ou4apx  o3iaslaDraumont0aexnmr iotfa  aues;(0 2to(r3iu4omt  iei (fsrum(mpno0alx  ieiydfa emu ont4tetrircoatlpDr nesls)s2xm(r3oudam emncta(f 2tr(m ot0tpen o3tltfs2rl( p t0arxnio oytlp   nei;t)srtm(opiy4omee nctatf Dtmx p;u1aptomfctlslm2ulnvs u) rtoxf iytlpDrai ols0 2tr(opou1ll  mncta(  2tr( o;u1olenmfetldfs rlnvo;u)trtoio3oydopteln ols0 2uoxm no4lpt lnvtlsfsrrm(r ;u1ale  fcilsfsDeanvont4tltrmf3to1opt livils trxr(r iu1lpt  ivtls s2rau  nu4optnmi3iltfsDrmn snu)alxrio3oytomDr u o s t2tm(rpnodope mncia()s2ua( pno4oet mo3iytla emn s t)tetrmocoadoaDr uvil(0 2tr(o oydolt mieslsfsDtmxmont0altnmoetatfs2uanmo;u4treriocoatfa r nes ()truoxr3iy4lme lietlt) 2tr(rpot0tpxoif3iasfm2rluvp;t4aetoxf todfm r uvslt)t2xm(m3oo4apt livils a2ra(mpoo4alxnifctytlaDrm( snu4aexrxo3todfat aues ( srxo(r iy1ll e iesl(  Dtr(mpou4tee  octltfm2rluvp u)altrir3oy1lmt  uesl( s2tr(o3io4op  lnct (fs2tau oot0olxnmociytfm2rmums;u4 etrmrctatfm r nes;(0trxmxo iu1am elnvs tfs2trxr ;o4alxn feiadfsDelnvo ()trxnmr totfa   n i;t0t2xr(m nydlp nlfvtltf rurx  nu0olto ieiadfmDulumo u0 renxfcoodoatr i o;t  etm(o iodalt lnvtl( aDtm(m nt4tlxoiiciadla2elu on(4alermociotom   uvs;( texr(mpoodll  lfvs t  rtrumpno0aeeo i3iytls2rl(vs;t4altoio ia1omt anvi;s  2xmio iu1om e ncil() 2umxr nt1tpt miciadfa ul(monu0arxrir oa1fp eauei (  2uoim3iu4apenlneta()a2uaur oo4openmi3ildls rau o u4texrif iy1fp rlu o ( texoxopio4omt  ncilsf rraum oo0opx if3tad sDelu s;u0tetoxf oa1op eaneolt0 eumxr oodamee fvtlsfaDtm( onu0aeen fctasfm rluvsnu4 rxomf3to1faDe u ols  rum(rpou4lpee nvs tfa2uaurpoo1opxomfctltla rlu p u)trerxocia1fpDe u o;s  rxr(m no4amenmiet s)aDuru  oo4aetnioeilt sDulums u4artnir iotfat auvils)t2uoimpiudole mfcsls aDurxmooo4oltomfetysfa rlnvs;(4altnio oytlpDrlies (0 exo(o3no4ll n ics sfsDrr(r nt0apto oeilsls2rm(mo;(0 lxoif3oa1lmtrlneol() etoxrpiu4altnlfcs s  rrm(moot0optn ocils mDra(ms (0alxoxr3oydfa ranesl(0t2tmxm no4lltnmnvtlt arta(roou4apeoifcilsfm2elnmpn(0tlerxocoodfmteanvols) 2xrxr iudolt miei ()s2trumoou4opxn o3iyd a ulums;(0aexrxrcty1fa eln sl(0s2xrxr oo4ap  mnesa(  rum( o;u1oetomfcildla rmu o;t4aexoxo3tadfmtrli ols)t2tm(opou1ape mfctas  2tr(rpno0alxomietatfs rln s t)texnif oytfp   uvilt)srxmir iodoleemfvsas) 2tmu  no0aptnmoeiatla rl(vo t4aeerio iatlpte uvsls0teuoxo3iydapeemnvslt)a2rrx  ;t1tleo f3iatfa em(vsnt)areriocto1oa e nei;t s2tmxrpny4ome lfesl(fa2uaumpno4aptomi3tat s ra(vo (0trtrifcoa1op r i il( setrio3iodoltnmncilt srurumpno4apeo f3iyd a uauvonu4 lxrxfctodom  anvsl()s2tm(r3iu4llt  fcslt)srurxroot0aexoifeiyd m2rlnmsnt)alxrio tydla rai ilt t2umiopio4altnlfvtltf Dtm(mpot0oexo oetlt mDeln p;(4teeoif3ia1fa e nes;s  rum(r ou1ap elnvsas) Duau pnt1aleniietltfmDeaums;u4artriocoa1omDeauvolt0 euoimpio1lmtelieilsfs2rrx o;o0optniiciadfmDeln o;u) ltrir3ia1lp   ivi (  2uoio3no1omt  ies ()arurxr ;t4alx  fctlsfa2rmnvont4 rerxf3iatfptrln ols s2xo(r3oy1al  lfci t) Drr(  ou1alt  ietatfm2eluvp ()teenir oatoaDe u o;t0s2trxo ou1ap  lfvsatfsrrm(r ot0ale mfciadls2eanms;t)aexnir3oy1fpD  iei ( s2trxm3nydlmtemicslt) 2rmx  oo0teenifeias m ulnmp (0artrxo oodlatr i ilt) rum(m3io1lptnlnctas) rtmum ot0tle  f3iytfm umumpnu0texnxrcoydop e n ol(  etmimpoudop elfvsa()aDraxr oo4oetn ociyd a uau s;u4 lxrxfcoadfaDr ies s)t2tmim3iy4apenlnei (faDumxrpot0alxoii3iydlsDel( s t)tltrmf3iydlaDraueo;t)t2tr(o3oy1ol elfesa()s2trxm oo1apx moetadfa2um(vs;(4 ltnxfciodfa e u o;s  rtm(mpiydopeelivslt)srrrumo;o4texnmiciysfm ranvo;t)tlxoxocty1oaDr nvi ( srtmxo3oudapenmneilt aDtrur ;o0aetomociys s emu on()tleoxfcoytfaD  u sls)setr(opou1om  livt ( aDua( onu1tetoio3ilsla rmnmo;t)trerifcoo1lm  aieslt0srxrim oudop nmfet () 2trurooo1optnif3tldfsDumnvs;t0 etoxrctydfpteanvolt0 2umxr iudomt mfet ( aDtmxrpou0tpen feild mDrmnvs (4 rtnifcty1lm  ai o t)setrirpiu4lltnmneil()srtru o;u1oeen oeiltfs2eanmon(4 lxrxfcio1fmt lu o;()s2xo(r3iy1apt livs t  2rrumono1aetn f3iltls2ua(mp;() ltnir3ootfa eaieo (0s2uoxopnydame mfvt ()a2tr(ro;o1aptomictysla eanvp;t4altoircoydlat  iesls0t2trio iodapt livs (fsrtmu  no1aetnmoctytfs rmnvo t4 lxnxocoodop e nes s srxo(r iu4lp  mfeslsfaDraurp;u1tpe  octltlmDelums t)teermf oa1lmD aueols)trxoir3nu1ome lici s sDrrur no0tetoifciad s2rmuvpnt0alxrircoo1la eaiei;t sexr(o oudamt mivil( s2tru  ;u0altn i3ilsfaDrl( p t)texoirctotfmtrln i;s sexm(rpny4alenlfvil( a2raxmpnt4alto ieias aDumuvo u)tltrirctytlpDrli s;(0srxrir3ny4aptemnvsatfaDua(ro;u1tpeo o3iltla2ua(mo t0tetnmf3oodfp elues;( srtrxr3iy4omt lfcil()s2um(m nu4alen fcilsls2emu o;u4trxoir totfate ieo;s0 rum(rpoudomenlnvtas  Durum ;o1aexo oeiyd m2ranvs;u) rtoir3to1oaDrlies;s teuoir3no4lmt mfei (faDum(r nu0tpe  ictasfmDua(mp u4texnir3tytfat luvi;t0 rxrxo oy1apen ivsa(fsrrrumpot1tlxomoetldfa2ulums;t0teerio3oo1fa rlu ols) 2xm(r ou1lp n icsa(fsDtaurpoo1aetoiociytfs rmnmo t4tltrmocoatoat livilt  rum(r nodomenmietls  Dum( pot1aet mf3iadla2ul( s;t0trtrir totfptrauvo (0t2toir3ny4ap  mietat  rur(rpnu1aet moetytfmDua( sn(4 lenir3todlptran i s0s2umxm3iu1lle lfesatfsrraum ot4opeoifctydlsDuln pnu0 rxnir ta1oa e ueilt  etrimpoy1opeeliesat  rrau  ot4tlt  oeiyt m ulumo;(4arxnioctydomDr i ols) ruo(m3iy4al nmfvtl(f Dtru ooo1altnmfctysfa2eln pnt0treoiocio1faDeli o () rxmir iudalenlneias) Duaxm ou4opxo ieiytlmDrlnms (0aetnmoctodfpDrln i s)texrir iodap nlneiasfsDrrxmp;o0tlxo iciasfmDemuvo u)aeeoir oydlaDraivil( sexoimpiu4lp  lici s) 2rmxm nt4opeo o3tltla uln o;t)alxnmfcoatoaDelnvs;t)s2toxr3oy4ol  lfct s sDurxrpoo0alxnif3tasfm2raums t)altoxr tatfat luesl( srxmxo3oo1om nlfeils aDtaumpou0open ietld sDumnmp u) eeomf oa1lpD aieo;() 2urxo3iy4openmfviltfsrtmu  ot0tlt  o3ildfa rl(vsnu4 eeomf oy1fp  an o;s) 2tmxo3ny1omtnmiviat)arrrx pot4tpx  oeiatfaDulu o;(0aleomo3iy1fatrau s;t)s2xmiopiudoptnmieiasfs2rrumo;o1altnifciyt a eaumsnt0trxnmo ootomtran i;()trurxr iy1oltemncta()arur(ronu0alxnmo3iysfsDrmumpn() eenmf3iatlat  iei;s  2xrxo3nodlpt lncslt) ruaxmpnu4aexoif3ild m emnms;t4teermfcto1om e ivil(0 eumim oo1ape mivta()aDuru o;t1tlt  i3iltls2ra(vsnt4arxrxocoy1lat lnvs;s)truoir3no4amtelnetat a2umur no4aet mfetls m uln s t0artnxr3oytlmD auvo;t0sexmxo oo4olenmnvs s artau  ;t4teeomoetasfa uluvp;(4alerxo iy1faDe i ilt  etm(o3oudlmtn nct t sDraxmono0tlto o3iadfmDemn s (0 eermf3totoaDelnvi s)t2trim nu4lpe  feiasfsDurur no0opeoioeiydfa eau snu0aleomo3tytoaD  nes (0t2tr(r3ny1omte fvil()s2um(r ou4tet miciatlmDeaumo;t4 eenif iotfpDe nes t  exo(o3iudlpt micta(  2tmxmono0oetnioctlt a um(vp;()tlenio ta1lm
\ No newline at end of file
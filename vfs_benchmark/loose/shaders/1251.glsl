@@ -0,0 +1 @@
+ivo;( srxoir3oydlptelfctl()aDurx  nu1apx io3tltla2raumpn()aetrxf iy1op eaiei;(0 rur(o3iu1omtelfesl(  2rru p;o4opxo oeiatfs2ul( p ()aleoxr3iadopte nvsl()srxmio iy1llte netltfs2rau ooo0tpxoii3tysfsDeau pnt4aeenxfcoa1fateln o;t  2toim3nydlptnlnci s)srrru  oo4tex io3iys m2emumsn(0aetoxr totfpt anvi;t s2uoxr3iu4omeemivi (fa2tm(  ot1olx ii3tlt mDelu pn(0trtrxfciatopt aieil() eumim3ny4ap nlivtlt s2tr(r oo0opxomi3iadla2umnms t0 lenif oadfp   i sls t2uoim3iy1llen iei sfsDtm( pno4alt io3ild a ulnmo (4alxnmf oo1fat lues t sexoio3io1lpee fetls) rumur nt4tptomoctld a2ulumpnu0tlxomrciodom eaieo ()texoxo iydll  mnes s) Durx p;t4aptniiciadfa ul( p t0aleoiocoytfmt luvo;t0s2tm(m3oo1lltnmfet () rum(  nt0alto o3tyd a2ran s u) lerir3to1lm rlueo t)t2xoio oydlltelivtltfa2um( p;t4tptnio3iat m ua(mpn(4 lerxf3iy1om e uvs t  rxm(r ny4lm  lfcsatfartax  nt4ape  ieiltla uaumpnu4alermrcoodlp  lueo;t0 rtoim3iodoltelfvsasfaDraxrpou0tlxoif3iysfmDumnms u4trxrxrcio1fa   nvsl( s2xmxr iu4lm nmictlt)aDtru oot4alenif3iyt aDemn s;(0alxrmf oytomDe n o;( srxmirpiodop nlfcia() rum(mpoo0tex moctydls umnvo t0trenifcoodlatelnvilt0 eur(o oodllenmneia(f rtm( o;t4alt moetatlaDem(vo;u0trxnmf tydlpteliei;t0t2xr(mpio4ole  neil( s2um(rpot0tetoiiciys m eaump;(4tlerxr ootlp eli ols t2xr(m io1al   ncsat srrmxmp;u4tpeomf3ildlsDemnmo;u) reoxf3ia1fa r ueil(0teuoim3oydoltelnetasfaDta(r nt1opxnmf3ias s2ran s t)aleomr3totfpDr neil( trumim3ny1oleelnvt (  rurx  nu4opeoioctldls rmu p (0 rtnxf3todlatr n s s0t2xmxopiy1oleemietlsfs2tr( o;u4altn oeiltls2em(vs t) etnmrcio1lm  auvi;(  ruo(m nodlmtn fcta() 2raxmoou0tetnmo3tldla ul( p (4 rxoirciytlatraneo;t truo(r iy4ameelfctatfa2um(mpnu1tpto ociltfm2umnms;(0artrmocoadoptr ueolt)sexrxrpno4omtnmiesas srtmurono1ole moeiat s rmnvs (4tlenifcio1op r iesls) rtm(mpnudal elnei (f Drrxro;o0tlen fctltfaDea( o u0treoxr3iydla e ieils  etm(r ou4optelfetl() rtrumpnu0oeenifciad a2eaump ()aetrxfcoodopteln s (0setm(r nodop nmfvta( a2tm(m oo1tptomi3ild s um( on() eeniocoodfmDrlneol()seto(r3ou1al   neil( srraxmoot0tle mociasfa2rlnmonu)teenio oydfm r ivs s0 eurio3ny4lltemnct t) Dua(r ou1apx iiciytlm rl( o;(4aetrmfciadlmteanvo;(  2tmxopnu1llte ivils  Dtax poo0teenmieiat sDem(vp;u4tltoxrcoa1lp rlu ilt t2toxr3oydam   ivi t sDumxrooo1oleniocild sDrlu s (0aexoirctatopDelieo;(  etr(mpoydlmtnmnesl()srrmxm ;u0aetoiicilt mDuan s;u0 reoxf iodomteau sl(0 rtrxm iu1om emfvtlsf rtaxmp;t1tpt iictyslm2rau s;(4 ltoxf tytlm  lnei ( s2ur(r oodlm emnesls)arumumooo1alxoii3tas a ra(vs t)aexrmo3to1fmte ueil() etoio oy1al n feiat)s2uaxroot1tptomo3iydla2uau onu0treriociytopD aueo (0 rxm(r oudoltemiviltf 2tm(  ot4alxo oetydfaDrl(vs u4 leomr ty1oat li ol(  ruoxr iu4apt lncia(fsDrax p;t4tlxnmi3ias sDum(mp;(4tltnmo3iydop rau i;s0sruoxmpny4lpenmnctas a2taurpou1alx iieias a2uaumsn()arenio ootfp  lueils0seur(rpiudape mfvtat)aDuau ont0altnmociadlmDrauvp;() etoxf3to1fp e i sl(  rumxm3oy1lp  livilsf Dua(r nu4apxnif3iatfs elumsnt)alermf tytlpDrau s;(  ruoir3nu1lpe  fvi (fa2ra(mpnt0olt mictas s2um(vp t)teermo3tydlptr ivils0srtm(rpoudlp nlneslt)a2ua(ront4apxnmo3tlslm emn s;() rtnmfcoy1fp r n i;s0srxmirpiy1amtemfeiat)a2ra(mpoo4ope mictat m eaumsnt)teenxo3totop  lues;s)t2toxm nu1alee ics t sDtau oou1texniictyd s2uanvon(4teeomo3tadopD  uei;()teumiopoodaltnmivsls) Draxm oo0olx  o3iasla2ul( s;(4tltnioctydlptrln olt  eto(rpiu1lp  mfcia(fsrtru o;t4apeomfeiaslmDuln s ()tetrio tydfmtrlnvo;s0setmimpiu1lm elfvsasfs2rrur nt4ale  feiys s ul(vont) rerir tytop raivils trum(opny1llenlietas) rtm(m ;o1apenmiciys a emuvp;t0aeeoxo iodfa e i i;t0s2tmxo3iydomenmfvi s aDrm(r oo0tpe mfetydfsDrlu o;()alenif3tytfat aueils)srum(m iu4alt  fvil()aruaumont1tlt ifctat sDraump (4trenxf3oadoaDe nvo t0 rtmxr3iudop nlnct tf Drax  ;t4oexoiiciyt aDea(mpnu)aeerir3iytfat  u o;()sruoimpoy1om emiesls arrr(rp;o0olxnmi3iaslm2elnmo u)tlxnxr todfaDeanvi;s teum(r3oy4opee nvtlt)aDrau ono4oexn icilt aDrln o;u4aeerio ootfatrau o (  rtm(o3iodlm emfvia(f rurxrp;t4alto octyt sDumu s () exoxf iydfp raueo ( t2xoir3iu1am  livt s s2ra(mpnu0tpxniietytlsDrlums;u4tlxnio3oy1omD  uvol(0setm(m3nodapeelfvslt)aDrrurp;u1olxo feild a2rm( snt4tlxoxf3oodfat li i ()s2uoirpoodolt mfei sf Drrurpoo4aex mi3iytlsDrl( pnu)arermf tadlm eauvo t0 2xoxm oudom  lncsa(fa2tax pou4aex mfeiasfs rmumo ()aetoxo iy1lp eluvi s)t2uoxm nu4altemfes ( a2rru  ot0tpeniieiyt aDulumonu4 rtnmr totfa rluvolt)t2uo(mpoodlpenmfetlt arrmx pnu0tpx iiciat aDeln s;u4alxoif3oo1omtr ieo;(0truo(mpoo4optn feta()sDrmum ot4oee moetyd sDul(ms;u) etoiociytopDe nesls0 2ur(opiy4ope  ici t) Dtrur ;t1olx  o3tydfmDrmu p t0arxomf3iadlpteln s;s0 2tmio3ou4llt liesls)aruru o;u4tlx  i3iydlm rmn s t0 exrmrcia1lpDe n o () 2xo(mpny1om eliet ()s2umumpno4oeeoiociad sDua( s;u4texnir iotop elu s;( sexrim3oodom nmnvsls) rtr(m ;u4tleomiciad s2uln s ()aexnmr3tytomtraivs;s teurio oo4om nmncs ()s2taxr nu0olx  f3iltfmDrm( p;t0trxnir3todom rln i (0teto(o3ou4ale  iesl(f Drrx pot0ope if3ias m eln snu0 lxnmr3totopDe ivols teumio3nodope  nvsat) Dur(r ;t0tpxn o3ildfmDul( snt0alxrmr3iy1lp   nvs ()s2trxmpiydole mnei sfs2tr(m ot1ape ioetasla2ra(vs t0aetnir3totlaDelneo s)texmxr3oodom  mnvtas) Dum( oou4tle miciat s rmu on()trtoifctadopDelneo s  exmimpou4ale lncslsfaDrau o;o0tle if3tadla ranvs t4alermo todfa  aieil( s2urim oo4ap   fcia() 2tm(mp;u1oeeo i3tltla umu o (4tleomf iodlatelies;s s2xoxr3nodamt livt ()a2rm(r ;t4oltnif3iysfa2um(vsnt) rtrxocoo1omD luvi s) etmim3nudlptnlictas aDumx pno1texoii3ilsfaDulumpn(4trtrif io1om rlnei;t)trtr(o3iy4lm  lfvs () ruaurpoo4tlt  fetlt mDumuvo u0tltomr3oytfm elivs ( texrir iodlm nmiesls)srtr( pnu1oee ii3iltfs uau pnt)teeoxr io1lmtrau s;(  rtoxo ou4lleemfct () Dtm(ro;t1olto ieilt mDumu p;t0aeeoircoa1op rln s;s srxoir iy1llee ivtl(f 2tmumo;o4opeo ictasls2um(ms;t4trenmo3oy1oaD  n olt0 2xo(rpio4openlfct s a2rrxmp;o4oexo fetldfa2ua( p (4 ltrifciydoaD ln o;s s2to(o oo4amte icia(faruaumoot1alxn feils m2emu s;()tltnif3ty1oaD liei ( trur(r iy1llee icil(f 2tax p;t4tptnmoeildlm uanmpn()tltrxo3to1lmDrlivo t srurxr oudapt  nvta()aDtr(mo;t4optomfctysfm2eanmp;(4 ltoxfcoa1oa   u i ()setrio3iy1ap nliviasf Dumx ont4aex mf3tlt s uan onu4treoxo3tatlaDe nvs;(0setmir no1openmfeils)sDur( pnt1olxnif3ilt s2eluvpnu4 lenxfciatfm   neo;(0 ruo(o3io1ap  lici ( a2rr(rpno1aleoii3tyt a2umums t0 exnxf iodoa ran i;s0 rtr(m3oodamtnmfes t) rra( pot4oeenmoetys m2ua(mp (0 rerxf tadfmt livs t srtmxrpoy1op emfvi tfa2urxrpnu0tpeoif3ildfs rm( pnu)arxrio oa1fmDrln sl(  2tm(opoydolt lfvi t) 2umum ;t0tlxo o3iyd a2elu s u4alxrmo3iydoaDelu i;( srxrimpnodal eliet t)sDrau  ou1olt ioeiydfa2uaumsnu)artrxrcta1oa r neolt  rumio3iu1omtn ivil( a2rr(monu4aexnmfctatfmDrmu p;u0alerxf io1fm  lu o;s) etr(mpny4altn ivtl()sDraur nt1olxoio3iydlaDrau o u) ltrmf3ty1fpt aivi;s) rxoio oo1opte ivs (fa2rr(rpnt4alx  ietas a em(vs;()trtrifciy1faD luvi;s0 2xmirpnodlme  fesatfsDra(rp;t1tleo ictatfaDrmn snu0alerxr tadlm  aneols  2ur(m3iu4aleemfvsls aDtrumo;t1tleo iciytfs2ua(vsn(0arxrir ta1fm   nesls) etmxr3nu4amee ietlt artr( o;t4oetomfcildlsDranmonu4 ltoxf ia1fpDrlu o (0 eum(mpoo4lptelnci t  Dtrxm ot4tlto o3tytlm2emnvo;(0aeerxo ia1lmtrlnvilt)trumxm iy1lmt lfcsasfsDra( p;t4alxoio3tldfmDulnvo;t) etrmr3oadlate u i s0 2xoir3oy4apenlnci ( aDrrur ou1tlx ioetysfa2emnvon()tetnxf ia1op   uvo;s  2toirpiu4ome mfvt () 2rmx ooo1alt ifeilsfa2ea(vo t)aexnir tadop r neo t truoim3no1openmicsa(faDtm( pno4apt  ieilsfm2emnvs;u0 rermf3iadopDeluei t s2xr(o oydomeemiet t  Dum( pot1oltnmf3ildla em(mo;u0tlxnio3oa1la  an ils)srtm(m iy4lm n nesl() rrmurp;o0tleo octad a2ua(mo;(0tlerifcta1fate ies;(0srur(mpiu1aptnlnct tfa2rrurooo4oeto ieiadfmDelnms;u0altrxfcta1laDe ivi (  rtoxo iodllen fetlsfarum(m nu1oetnmoeilt s2rlnmsnu)areoio3iotfp eluvs;s) etmio oydop n iesls srum(r ;u1aeen f3iysfm2rlu sn(0arxomr3oa1lmDe n o;t0t2ur(r oy4lmtnlictltfsDtrump;t0alen ocildfs ul(vp u)aeerio oy1lp rlnvilt) rxm(mpnydope lnesls)sDrmx o;o1tee miciadlm2uanvpnt) ltnxr3ootom  livs s0 rxrxr iu4ole  ietl( s2rmx oou1tlxoif3iadfa2ra(vp;t4 rxrmf to1faDraies t0 rxmimpnudaltnlnvsa(f 2tmxmp;o4olto feiatls emu o;t) reoxrcto1fa eanvs;s setrxmpio1am  lics ( sDumump;t0teenmfctas sDrauvo;()tltoxr3oydlmDeli ilt  2ur(r3iy1lmenmivt s) rtrumpot1olen i3iasla rl( s;u)arerir3ty1oatrlneol(  rxrxm3iu4optelnctat) 2umu pou1openmoeils mDeauvp () eerio3todlmDe ueo;()trurim nudop nliciatfaDtaxmpnt4aptnifcildla umuvp;() rtoxr3oy1omD  u ils  exmxr oo1open nvtlt)s2ua(moou4oet  icils sDrln o ()texnmocoy1lpteaivo;t t2xm(r oydomee ivsls) rra(m oo0oetomfeilslm2eanvp (4trxrxf io1faD aiei;(0 etmxopiu4ale  nci ()sDta(r no4teeomi3iat sDemu p ()tlermocty1omteln slt0seumirpio1ap   ies (farrr(rpot1tee io3iadlm elums t)alxrmf3totfm r nes s seuoim3ou1ameemiciltf rtm( p;o1tpenioctysfm2elnvsnu)arxomf oytlat auvil( trtrir ou4olenmivils) rrrx  ou4tetnmoeiadfsDem( o u4 lxrmf3oo1fa e ivo (0trum(o nydlmenmics () rtaur ot4tptoifetysfm umu o;t)areomfctytomt li sl(0seto(o iy4oleemfcs (fs2ua(m no1tpen f3iltfa2emn s t) eeoio3tatop  lu ils t2trim nodol elneilt)aDrmurpnu1apx  fcils m eauvo u)aetrmociy1oaDelivs ()trurxm3ny4lpe  ieiat  2umx  no1tltn i3iysls2ranvp u4aetnxf oadoptraieolt)trto(mpoo1aptemivt s sDuau ooo4alxomo3iydfm2ua(vo;t4alenmr ta1oa  luvilt0trur(o3io1apte nvsl( s2ta(mo;u0tpt ioctltfm emn pn(4altrmr oatlm elivo;( texr(rpnydlmenmnci s s2umx  ;o4teen i3iytlmDea(vpnt)texniociadlm  ln o;(  ruoio3ou4lptelnct t)sDururonu1oex if3tas a2rlnmp;t0 rxnmo oatfa rai o t) euo(rpou1ame  nvtl( aDrmxmo;t0alxnmo3tadls el(msnt0tlerif io1lpt  i i;()srxo(opiu4lpe  neslt s2urxrpoo4opeoioetldls2uaumpnt)tlxnxr3io1oatrli ils  eto(rpoo4omtemfetas) Drauroot1altomfciyslsDelu o;(4aleoir3ootlp rln i s)trxoxm no4om  lfesl()sDtrxrp;u0tetoifctadlm uanvo;(4tlenxr3oo1optelivilt)texr(r oydlmee net ( aDrmxmpoo1tptoiocilt m ulu onu0tlxrir3oy1la eli s s) 2xrxopiydome  fetl(f Drrx onu1opeo i3ilt s2rauvp u0texrmr3oydlat an s;t0sexrio3iydapte net ()aDtmxmono0oetn f3tat m2eau p;u0 eenmf3oa1fm rluvo;t0t2xo(m iudap  lfvtas)a2tmx  nt4aeeomfetysfs ul(vp t0altoxrciotop e uvs (  exoxr io4lle mfvil(  2rm( o;o0tleo f3iysfa eau s u0alxnxf3ootlp   ieo t seum(opnodopenlncsa(fa2taump;t0tex  f3ild m2emu pnt4tetnxf tadfate n s;( s2xrxrpou1omenlnei (  Drrurpot4oet  ieiyslmDumnvs (4 reomocto1fa eai s;s0truoio3oudll nmnetltfs2tm(mo;t4altomoetlsfs2uln p;(0tlxoif tatfmt au slt srxrim iudlp nmivtl(fartrum ou0tlto f3taslm um(vp (4trxomo3tytfmteln o;s0texmxrpou4lm   ieia()arum(mont0tpxo ocias a rmuvo;u4 ltomociytlptrln s t trxmxo nudlmeelfes tf Dur(  ;u1optoioctltfsDeanvpnt)tetomr3iadla r i il(0s2xr(rpnudal n iviat) rtrxrpnt0teeoiociasls uauvonu0texoircoo1oat  n s t0srtoio oy1amte nctl( srrrxrooo4aeeoifcilt m2eauvs t0 rtoxrctodlaDraneil()seuo(o nu1op e fvsat)aDtr(root4apen fcildlmDranmonu4arxnifcta1fp rluvi;s)s2xo(m iydllt lncsls a2um(rp;o1alxomo3iysfm2ranvo u4 lerircoydfaD  nei;s0trxoimpnudomtnmiesl() Drauronu4apxomoctat sDra(msn(0alenxo3oo1laDeauvilt tetrxmpny1llt mnvt (f rurxr ;u1aleomieiydls2uanmont)arerxociadop r i olt  2to(o iudlptnlncsltf Dtaxrpnt4alt iieildfmDelumsnt0trtoiocia1faDr i s s0s2xr(mpnu1lltelicia(  Duaump;u1oetnmictydla2rl( p;()aexoxo io1optrliei s0t2tm(r3oo1amt miciltf rtr(ro;o4apx  octydfmDrmums;u)aleomr iy1op elu o () exmxm3no4llenmnctlt srraur oo4altn feiltls2ul( snu0 rtoxf oo1lmDeanesls trtmxrpnydam  lnvilt a2ua(r ot1tptoio3ild s umu s (4treoxo3iydopDraieo;(0teuriopiy1alt mictl(faruaxr no1olxo octltlm2uan s;t)tlxnmrcty1omtelneilt)texmxopiu1ole mncs s)a2um( pou1tltn fetld sDulu o t)arermfcoytfpD li o;( tetr(opny1lmtnlicsas)srta(mo;u4aexniietad m um(ms;u0 rxoxo ia1latrlnes t) rur(r3iu1amen ivs t srrruroou0apx  f3tys s ulu snu)texniocoy1lmte n i;s  rxr(r io1ale mfctlt)s2rrx pnu0olto o3iad a2eau o;t0trtoir3todom ran i;s srtoxrpno1lpe  ietas) 2ta(ro;t4aetoio3iltlsDrluvo ()arenir tydomDeanesl( s2trio3no4lptelicias s2umx o;u1alenmocils s rmump (4trtrxfcoatop eauvils)srxoio no1ll  livs ()artruro;u4apx ifciad s em(vo (4 renmf iatfp   uvo;t) rum(m nudaltn ivtlt)arrmumo;u0tpt ii3iydla2rlumpnt4alxrxr ty1oa elies s)setmxm io1omte ies tfsrurumooo0aetn i3ildfs2rmu s (0tlenxocoa1fpDe ies;()t2tr(m3io1ol nmivt (fa2tau  ot0oexnifciyt sDumu o;t)tleoio3ty1oa e neol() exoirpoo4alen iesa()arrau pno4tetomoetydfmDeluvpnt4tetoif iodfmtelu s;s0srtr(r3nydamtnlfvilt srrr(mo;t4opx ioctysfa rlu snu)aetrir oatla elu o () exr(o oo1lmtnmicslt) 2uru onu1oex io3iydfaDra(vs t4artrmfciytfatelu i (0seuo(r iy4lp nlfct sf Drr(mpoo1tlx ifctadfs2el(mp t4 etnmf3iadlm eluvo s)t2xrxo iudol elics tfsrtm(rooo0aeeomieilsfaDuaumpnu4altrxr oa1fm   ivo s)setoim iy4amtnlfvi ()a2rr(m no0apxoifciyd a2uaumsn(4 eenxr3todfp e n i s  rxrir ny4om  lfcia(fsDrrx  ;u4oex  fciatls2emn o (0alxoxf oadomt  n o ()tetoir3iy1ome mivi t a2rr(mont1oexo iciysla2elnvsn()tlxriocta1faDraivilt)teuo(m oudlmeelfvsa(faDuaumpnu4opxnif3ias a2rm(vs;(4 rxoio3oa1op rluvs;s  rxo(mpiydll emfvt ( aruaxmoou0aex mi3iad aDemn sn(4tltnio ia1la  luvo t) rtm(opny4ame lfciat)a2rmxmo;o4tleo f3tydfm ua( onu4teermf3tytlp rluvslt)teur(m nydlptelivs t a2rm( p;u0tpxoii3iyt m ranvo u) reomr3oy1fp rlnes;t) 2xrxopoy1amt  icsat s2uaumpoo0openmi3iatfa2eanmsnu)tlerxoctatomt anei ()t2uoxr3oo4om  mict () rra(rpot4tet mociatfmDemump;u0 lxomrctydoateauvo t0tetr(r ny4lle lfvi t  2umx p;o1oltnifeils s rmu pn(0tleomo todlatrln ilt)sruoxr ou1lme lieils)sDraxroou4aee mfciadlaDum(vo;()tlerxr3oa1faDeauvs;(  eum(m3ny4lltnmnesa(  2rmurpoo1tet  oeias s2eanmp u) etnif io1op rln olt0trtrimpno4opt livt t  rtau  ou1tetnio3tys a ea( onu0 ltniocootfaDr u o s  rtm(m iodap nmivs t arta( p;o4tee  i3iat s2ranvo;(4 eerxrciytfatraneo;() 2xm(opou4llen ivs tfarrax  ou1ole  i3tydfs umnmp u)aexnif oodlaDrluvs ()seuoxopio4aptn fvsltf Drm(m oo0open ietad a2rlnms;u0alerifcoatomDrlueo;()truo(o3ou1amen ies () Dtrx pnt1openmfeiadlmDemnms;u)trxomocoo1omD livo s setr(rpny1llt  iesat)sDtru onu4oltnifeiyd mDel(vs;u) lenxrcoy1fatrai o;s0 2uoxm iodlp   nvtltfa2uaxr nt4alt iocild sDeauvont)altrif3tadla eliei ( sexrxrpoy1optelfvslsf 2urxm nt0ope iocild a uanmsnu4 eenmf3iy1oaDrlneols0s2xmim3iu4om  lncsa() Dtm(r no1tlen ictlsfs2rlumo t)trermf3iytopt lnvolt0trur(o nu4al  mfctas)s2ua(mooo0tle iiciyt s elnmpnt0 lermf3oo1fmDrlieolt0 rxmxr iy1amtelnetatfs2taurp;o1oltnioeias sDranmsnu4 etnxr oo1oaDran s (  etrir3oydlmtelfes t sDuaum no1tpenifciatfm2ulnms;t4 rxnif3oydoatean o ( t2umirpiu4altelnvt s aDrmxront4aexn iciys m emnvo (4teeomo3iotfpD  u il()teum(r nudlptnmfct s)artrxr ;t0alen oetlt a uanms;u0texrxf3iotfmte ueo s)texmim nu4omtnmnctas  2trx  nt4oltomicils m ul(mo;t0artrir3iadoateaiei s) eur(o3ny4ll emici (fs2truro;u0oeenmictatla eanvs t4aetrxocoa1oaDran ils teuoxopio4omtelfetat aDrau  ot1tlt iociltls rauvo;u0aeerxf ty1fp raieo t)tetmxm no4llen ics (  rtrumpoo0tetoio3tydlm2eau s t0tltrxf oa1fmtrlneo;( srurxmpoy4amtnlfet s  Dur(rp;o1olxniocilt sDeau p;t0teeoxrcio1fptranvolt s2xmir ny4ll e nes (fartmxr ot1oex iieiys mDra( p t)aleoxrctatfa  anvol()s2xmiopiu1opte nei s  Drr(r ;t1opxnii3iad a rmnvonu4arxoxrcoatoateluvo ()s2xmxrpoodopeemivia()srraxmpou1opxniictltls2ean pn()treoir iotlaDrlieo;(  2xr(r3no4lp emnci tfsrtru pnt4tlt mfetysfa ul( pnt4 eenxrciy1fptrlu sl(0 2xoiopno1op nmictlsfsDur(ro;o4tlen ictat mDrlnvs;t)alenif3tytoaDeai ol() rxrxm nydal nlfvi ()sDrmxro;o1opt  ociatfsDul( p (0trenif oo1oate i ilt) exo(o3nodop   ivsl() rrm(  nt0oexn f3tad aDeauvp u0alxoiociotopteliei ( srxoxopoy4lp nmnet ()aDrrxmpnt4apt ii3tasfs2ea( pnt4 exnxr3oo1fp rlu o ( t2ur(m3ny1opeelfetat)s2rrxm ;o1oexoif3iadfa2uanvo t4tlxrmocta1laDraueols trxr(mpnu4opeelnvi ()aDrrx  nu4alxnio3iaslaDeanvpnu0artoio3iydfp eln i;s srtriopoo4ope mnvia() rrmx p;o4apt  f3tldlmDeln pn()tltoxr io1optr nes;(0sexo(rpnydol e icta( aDrrx  nt0alxnmoctlsfa2el( s u4 exrir3iy1fateaues;t)trtm(rpoudlp   ncils)aDum(mp;o0altn octasfm emu p t4trtnxf3iydlmD anvs;(0seurxo nydllte nct ()srta(mp;o1alt moeiatfmDeanvs u4arxoio3ta1fa  aivs t teuo(mpoudom elncsasfs2trurooo4oltnifetysfa2emumo;t4 eeomr3totoa raieils truo(opny4aleemfes () Drmum oo0aexoiociytfs em(mp;u)alxnif3io1omteluvils)tetr(o3oo4am   nvtlt) Dtrur nu1aexo i3iltlm2eauvpn()trtnmocto1lmtr nvo;s)srtmxm io1lptnlfvs ()s2umur nu0tltnmieiysla em(mo;(0aetnmo3oadoptrauvolt  2ur(mpno1lpeemfvslt s2rru  ot1ape mfciysfs2emumo u4 rxnxr iy1opt  ivilt setoir3oo4llt micilt  Dumx pnt1tpe mieilsfs el(mont4arxnmr3oydop   nvi s)trur(mpno4op nlnetasfarua(mp;o0ope if3iad aDean s t4 rxrxf3iodfpDe i o ()srxmiopiy4omt lfesl()arrmxrpoo0olxn feiydlm2em( s;(4trxoxoctatomDe u o;()seur(o iu1lpee fetls  2umxmpnu0openmoeilsfa emums t4 eerxo3tytomDe ies;( tetoio nu1omeelnciasfs2ra(ront4oet  i3tysfa2uan o t4aeeomfctatop elnvo;s0 2to(opio4amte ncslt  rua(rpou1opt  fciltlsDuauvs (0aetnmrciadlp e ivils)seuoxm3oy1lmtnmnvs s)aDrrx ont1tetnifeiydlaDra(mo;u4tlerxfcoatfmtelivs;s t2xr(rpiu4lm n fetasf rrrxmp;t4ole mfctadlm2rmu s t)artrxrciotfp e iei;t) rtoiopoo1lm emivslt a2trxm nt4opx  feiat a uluvon(4altrio3oy1lmD aies t) rumxo iudlmee icta()sruru oou1teeo fcilsfa umu s t)alxnxr3tatla r neo;t0 etm(mpiu1omt mnvtl()s2trxmp;t4ope moeiatfm2ulums t) lenio3totfp  lnei s)sruo(rpnudope licias)sDumxrono4oex iieiytfm2ra(ms;(4teerxr oydfa r i s;() exm(m iodap nmfei s)sDtauronu4olxomfctltls2rm( p;() exrif3oytfp elu ols tetrxr ou1amtnlnesat)s2tauroou1tptomieiys mDuaumsn(4altrif iydfpte ivslt  2tr(mpiu4apt mfeiasf Durxm ot1teeo iciltlm2rl( s (4 rxnxoctodfa eauei;( trumxrpnu4lm elncsat) rur(mo;o4apxnii3iad sDem(vo;t0alxnmo3oytfp eln s (0s2xo(opiy4aptemfcs t  Dtrurp;u1tptomo3iat s ra(vo t0 exrxrctydlm  aueslt0 etoio oodllenmiviltfs2ua(rono0aexo icias a ulnvo u0 exrxocoa1lptean i (0t2urxr iu4optnlfci s)a2rr(ro;o4ope  o3iytlmDra(vp ()tlxrxr3todfaDe uei ()setm(rpoodlleemnei sf Dtru oou0opxo ociadlsDelumont0artrxocoa1laD  u i;t0 rtmim nodapeelncsa( sDra(  ot4apx ioetys a el( s;t4tetoxo3oadlm e uei s texoxr nu4lm  mnetas s2uaxrpno4tet iieias a2ulnms;()tlxnxoctatlp eln olt) exo(r no1al n fcsls)srtruroou0apeoifeilsfm2rmu pnu0arenxr3tatfmDe n i;()sruoim3oo4om e nvils sDta(  nu4open ocildlaDem(vo t)artnxo iytfa   ivol( s2xrxm3ou1lmeelfvsltf rtr( o;o4apt mo3ildlaDrmu o;t4aleriociotop  an i ()srxr(r nudal  mfvs ()s2tax oot4teeo i3iaslaDrmnmp;t) eenir3ty1laDe ieol( texrirpoo4lltnlnesat  Duau  ;u4oeto f3iyt mDulums;t4tlxnxr iatlpD lu o;()teto(o oo4oltemnvsa(  rrax  nu1alx  octydfmDuln o u) ltoif ootlptrai ols t2toxopiodlltemncilsfsDta(r ;t4tltnmoeiydlmDem(ms t) eenmr iodoaD  uvi;() rtrxopiudllt mnet t s2trur ;t0oet mi3iadla2rm(vp u0 rermf iodfa raueo;( trxm(m nodale mfetlt srrrum oo1apx  f3iat mDrl(ms u)trtrio iytlpDranvs;s)sexrir nudal   neiat s2tmu onu1tleoioctad m2raump (4 exoir3tadlatran ils0tetmim nodopenmictat sDua( ooo1aetoio3iydlm rlnmpnt4tetomr3oo1fmDelnvolt) rtmirpoo4ap e netltf rtaxmpnt4apeniocild s umu p;u)arenmrciytfmD anvs s srtm(m3oy1ap emfct tf rrrumonu1apen o3iysfa2ra( o;()alxrmf3iodfaDe n s;t0 2trxmpnudamtnlfeiatfsrtmur ;u0oex  fctadlmDeluvp ()teenio3oa1lp rlieilt0sruoxmpoydlp nlicils aDrmu  nt0tpe ioeild s2rmumo t) exnxf3oy1lpDr nvs;t  rxoio ou1lm e nci sf 2ur(  ou1tee  i3tatlsDuau s (4tetnifctatop rli s;(0t2trxo oudll nlfviat)srrrx  nu0aetnif3tls a ulu p;u4tlenxocoytoptrlueo;()teto(mpoo4lpt mnetls) 2trum no0apt iiciltfs2uluvpnu) etnmo oadoat luvi s srtmirpoudom  lfctasf Dua(rono1tle mfctltfs2ean s ()texoir3io1lm r iei s)trxmxrpou4ape mieiasf Dtrx oot4tpxoifeiasls ra(vsnt0altomoctadomtr nvilt0 2xr(opny1op e nvt s arrru ooo4tee ifeildlm2ranmo t4trtnxr iy1opDranvi;(  2xo(mpiodam nmnctasfartrur nu1oleomictlt s rm( s ()aexnifciodfat lues (  euo(rpiodop n feil(f Drr(mpou4olxnmfciad mDulnvs t0tltnir iydfmtr n o t)s2uo(rpnydalenlieilt)srtrxmonu1ope mfeilsfm el( snu0 renmf iotfp  lu o t)sexo(opoydal   ncsls) 2ra(rooo0oexoifciltfa2rmu p;(0 eenifciy1fmDeaieols) 2xmir3iodom nlnvtls srua(m ou0apeo ietlt m ea(mo t0altnio oatoa r ueo t0srtoxopio4al emnvt s  2raxmpno1aetomfctlsla2eaumo;(4alxoxo3iodopD lneslt  2toxo nu1omtnmfvsls)sDtaxmp;u4olen oetytls rlump;(4texrxfcoytoa r uesls0s2uoxm3ny4ap nlics sfsDum(r ;u4oeen fetasfa2rauvs () rtnmo oatoaDr i i;s s2ur(opoo1am  mfei t)s2ua(roou1teen i3iltls2rln s;(4trtnmf3tadoaDraivo t)s2um(rpiydlp elncs tfaDrmu  ou4olx  oetas m rmu pnt)alerirciydlatraieo;t trurir io4ale mivslt  Dtax  ot4oee  ociadla2rm(mo (0 etnmr iy1la   uvi t  eum(mpoo1olenmfvsa( aDuaxmoou4alxoioeildfaDumu o;u0 etoio oa1fpt auvol() eurxopou1om   iciat) Draxro;o1ape ioctas m2raump t4aexrxo io1lpt  nes t)trxr(rpiudolen nes s) Duaxmoot1tetn fciytla rl(vs u0 rxnirctodfp  ai o;(  2xrim oydlpt lfct ( s2um(roou1tlx ioeiydfm2elump;t)trxrxf3tadfp rai s;t0t2xrirpou1ape lneiatfaDtruroot0alxniieilslm rl( s ()arermr3oo1laDr ies;s sexoxm3oodlme  feta()aDua(mpnt1tpxn i3iyt sDrmu s t)tleomr tadlate neo (  rxmim3iu4ole mici t)aDtru  ;u1aet  i3iltla2eanvpnt4 rxrxfciytfatranvslt) 2trimpoy4lle lnvslt)aDum(r nt4oeenifeiaslmDum(ms;()altomf ta1omt auvi;s  2umim iu1lme  ivslsfa2trx  nt1tlen feild sDea(vs;(0teerir3tatlmD auvi;t0 etrxo nu1altnmnvsas aDta(r ou4aetomociasfs2ra( o t0aleoir ta1fpteluvolt  2xo(m nu1op eliciat  rumx p;o4tle mocils sDrlu p;(4alxoxo3ty1opt aiesl(0teumxrpiy1llenmncsltf rumu pno1tpx  fciatfsDumuvo u) rtrmocoa1fmDrai i t0srtr(r oo1amte ivi t) Durxrpnt4apxn fcilsfmDea(mp;t4 eermoctotopteaues s srtoim3ny1aptemfcsl()sDtr( o;u0alt iiciydla2umu s (4teermo io1lpD au sl(0texo(r ny1amte netl()arurx oot1tptn f3ildls ranvo (0aeermo3todomtraneo t setrxr io1altnlfesat srum(mpoo4tpxn ictytlaDeanmont0tltrxrciydlmt  u s s)setoim3ou1ll  lfvtasfs2rm(ro;u0aleoif3iltls uln on(4 rerir ta1fa e i s s0teur(rpio4lmtnlneilsfs2tmum ;t4opxo icildfs2ranvo;t0tetrmr3oatoptrlieo s  ruoimpoodam e nvt s  Drrxmpnt1teeo fetasla2uanvp;t0 exnif3io1optrluei t s2xo(m nu1amtn fvsas) 2umxmont4texnmfeiydfmDumnvs u4 lxrif3iotfp  auvsl()trtm(o oo1lmtnlicsl()s2umur no1texoiocildlm2umn pnt4 lxoxf3oa1la elueo;(  euoio ou1aptnlfes t  2uaxm no4altn fetydlaDumnvp u)aeeomociytoaDrlnei;( sruoxr iydaltemnvtas)aDumu ono4teenmo3iydfmDrln s;u4alxoir3ootfpDe u o (0tetm(m iu1op nlnvi (  Dra(mp;u1oexo fetlt mDranvp;u)teenmo3ia1lpDr i o;t) 2xoxo iydlp elncsltfarurxmpoo4oeto oeild a2uln p;t)altnmr3oa1opt lu i s0 rto(m no4om nlnci ( sDuaumonu0oeto octas m2ranmp;() rtoxocootopteli il(0 rur(o3nu4op emictlt srrauronu4apxo ictls aDeaumpnu) etoif3oatfmDeai olt)srxm(mpiudopt mfvtlsfsrum(ront1tpeomi3tlt m2elu p;u4tlxnirctytfaD li o (0trxmiopny1op  mnetas a2uaxmooo1tpx  fciatfs2um(vp u)treomociadomteli i t  2uo(mpio1lm emietl() rur(rp;u0olxomf3iadfaDrmumon(0teeomrciy1laD luvolt0seuoirpoy1ap  mnvtl(f rum(rpnu4opx mfetad a2rm(vp;u0 rtnmr oo1oaD  u i;s s2toxm3io4ole  ieiatf ruax  oo4aeeomociydfm el( s u0 leomrcio1lmDelu o;s setm(m3ou1apenmnvta( artmxmont0tptn f3tat aDrmnmon(0 exnxf3iy1fptran i;s t2um(o3iudap nmncta( srta(mp;o4tee if3iad s emn p (4aetoir iy1fmDr uvol( s2umxo3oydopeelncil(  rra(  nu1tlxo fciyd aDua( s;u) ltrxf3iotopt ai ilt) 2xr(m iu1ap emfvta( sruau ono0tltnmoeiys m2el(vp t0 rtrircoytomt  uvs;s  rtmxrpoy1lm e nesls)sDtaxmpno4oeto ociad aDrl(mp (0 reoiocoa1fa r ivi s0srtr(m ny4aptn fesa( a2tmxrpoo1tptomiciyslaDulumpnt0 lxoxocia1oatrli i;t0seto(mpiu4lm e fetlt a2ua( pot4aeenifctldlm em(vonu0trtrmrcia1lmt  u i s texm(mpiu1omeemfcsl(fs2taxm ;t1tlxoioeiadfs rmu snt0alenmocio1oaDranvil( trurxm oydlm n fetlt)sDtmuro;o1ope  oetatlm2ranvpnu)tetoxf oodoa eanei t setoiopoy1al n fesls  rua(mpno1oetoii3iysls2rmuvonu4 renxo3oydlpDrau s;t)srtmxr3oo4omen nvia(farrrx pno1tpxnmictys s2rln sn(4 rtnxf3tydla r ueols0trtmim3iu1al nlicslt  rurumoot4tlxomfciytls raums;u)altoxoctytla eluvsls0 2uo(rpnodapt mnviatfarurx o;t4oleoiicilslm2uauvo u4 rxnxf3to1la   ieo s0t2uoxopoo1lmen nvs () ruax pou0tleomocildlaDemnmo u)tltoxfctytopDelivs s)seurxrpiydomte nct s  rtmu oot4tex  ociadls emuvo;u4arxniociatlm eaieol()s2tr(r3oy4llee icilt)srrru  nu1oetomoctadlm rluvp;u) etrxrctotlpDr ues () 2tmxr iu4om  lnvils)sDuru  ;o0tet mo3tys s ulumont4 lxnifcoatlp eauvo t  exoim3iy4lm  mnei () Dtr(  ot0aetoifeiysfa2rlnmpn(4alerxociodlm e ueo ( t2xoiopou4alt  fct (  2ra(m oo4tpeoifcildfm ulums;u0aleriocia1omtraivo;s0sexr(mpno4amenlfesa() rrmumono1optoiieiatls2umn o (4trermrctytfp ranvo s0srtm(m oo4ll nmnet ( sDrm(r ;t4apeoio3ilsfm2rm(mpn(4tlenioctytoaDr ivs t0sexrirpnudape mivt tf 2uaumpnt0tlto ietys aDuauvp;u0artrmfcoydoaDrlu i (0t2xr(o nu1amtnlnctl( aDrmu  ;u1optn fetytfs2ea(vp (4alxnxrcta1lp  anvsl( t2uoxr oo4lp  mfviasfsDum(rpnu1ale mf3ild m emumo (0alenmf io1fpDr u o s) rtm(r nudllee ncilt sDururoou1tpxomf3iyd a2el(vs (4teerir3oatfp raivi s0s2xmxo nu4opeeliviat)a2umu  no4tlenmo3iadfmDraump u4 exrmf ty1laDraiei;s0teto(m nodam e ietlt  rumu  oo1oet iieiysfsDul( p;t4texrmr ta1opD an i;s0teurxr3oodomenliesltfsDur(mpot1olx iietytlm2em(msnt4aetomf3oo1fmDeanvo;( t2xo(rpno1open ivtlt) rrru poo4teenmoctas m rluvpn(4aetnmocoytlaDrai i;t0 2xo(m3ou4alte nvta()srtau p;t1tpt  oeils a2rm(mo;u4teeoxf ta1om elivo;(  rxmirpiudome lnct sf Dumxr ;t1opxn i3iltlsDran pnu4 rtrio oo1oa eln slt0trtr(o nu4lp  liciat) 2tax oou0tlx mietadlm uau p (4 rtoio3tytfmD au o t)t2xo(opou4apt mfeiatfaDtrxrpou1tlxomf3iat s rmnmp;(4 ltniocoa1faDelueols0t2xrxm3io4optnlfviatfs2uru  oo1aexn oeiat a ua(vp t4tetoio3iydopteli olt  exoim iu4lm  mfvs ()a2rmur oo0olxo oeiytlsDumnmp () rtoif to1opDe neo s trxoio ou1lmtemicia()a2uaum oo0oexnio3iyslaDrm(vs;u4aeenxr3ia1fateauvo s  exrio3ny1ll e nei s)a2ra(rpnu4optnifetat mDrmnms;t)tleomoctatfatr uvsls)t2toio3nu4lltnmfetas) ruru oot0optn oetytlmDuan ont)arxnxo iodfp r uvs (0setr(m nodom nlnvia(fs2raxrpnu0tpeoioeiyd mDul( o t0 exnxrcoa1fpDran o s t2uoxrpoo1amt lfeslsf rrrx ont0teenifeiad a rau onu0aetoxr oatfmtrlnes s0t2xm(o3nu4optemfvia(fs2trxmpno1olxomfeiat s2eanvo () ltrmr3ia1fatrlnes (0 exmxr3iy1ll nlncil() Drmu o;t1opt mo3tltfm2ea( sn()artoxr tydoaDrli sls0sexo(mpno1ol e fct (fsrraurp;u4tlxniocild s umnvo;u)alxnxf ty1oaDr u i;t0sruoxmpio1lmenmies s  Dumxro;t0aet iociydls ulu p t0 rtomr3iadfpt lieilt0 2urxo ny1ape  ncs () 2rm(mo;u1teeomo3iyd m2umuvs;u4altrifcia1oatelnei;( srtoim3oo4ap nlfesa(fa2taxmpou1tltomfciasfsDrm( p (0tetoxf3oytoaD ln s (0trtoxo3iudap e fvt s)arrru onu1tltoioeiadla ranvon()tltomo3iotoa e uvolt  euoxr3nudapte net ()sDtaxr ot1tle iociysfaDemnmo t0 exrif3iydlmtr neo;t texmir3nu1lle  ictls aDrr(rpou4tex mf3iys a2uan p t) eermf tadfm elneil( t2tmim nudal e netl()s2ur(m nu4aeeomocils aDraumpn(0 rxnmf oydop rlu s;t)seur(r3ou4ll elfet s  2taxmonu1aexomi3tat s ra( o;t4alxnio oo1opDrluvi t texoiopoudlm  lfet t) Drru p;o0olxnifciysfaDulnmo;t)artrxf3ty1omDran i s0seumxr3no4am e net t aDrmxmp;t4aptnioctydlaDumnmonu0 lxnmo totfa r nvi t)setm(r iu4am   nvsltfaDurxmpou1tle  i3tad a2emu s;u4trtnioctatfat aueilt)s2umxm oydolt lictat  Dum(r ot1aetomoeiltfaDrauvs u0tleriociatlm e uei;( trxm(m3ny4ape mfetatfaDrmx o;o1oetoifctls s emnvp;t4texriocoa1la   uvil(  euoir oudolt lnci tfsrrru oou1oetoif3tadfs ea( p t0artomo3iytom rau i t s2uo(r3oy1am n fvsas)s2rrurpnu1tlxn o3tytfsDrl( p (0artnmrcta1optr u s;s0setriopoodlm nmicias  rurxmp;o4oex micildlm em(mont4 leoif3iytlaDr u s t  exmxo3iy1lmenmici ()s2raurpot0apt  o3tys s elu o;()trxomr iatla  aueil( srumim iodlm nmiet tfa2tmxmpoo0opxn feiytfsDumn o u)teeoir oatlp eauvo;s)srxr(r nydlme  ieta()srurxmo;o0tlx ioeiatfm2uauvsn() eeomo iytlm rln s (0 etmxmpiu1ape mictas aDtrxm ou4aet mo3iltfmDum(vs u0 reomf todopDrlivol(0s2umio io1apeelnes s)aDtau pou0alxoiieiydlmDemuvp (4tlxrxr3oodlm rai o;s0srxm(r3iy4ameelivil()s2uau p;u1alen oeildfmDrl(vs u0arxnxf oodlpD ai s;( s2umim io4lpe  neiat  Dtmuro;t0olenioeilt m emuvs u4trxoxo ty1lm rauvol( teuoiopno1oltelfeslt)artru pnt4tpx moeiat sDraumpnu4trerif3oadlmt lnei;t0srxrio3iudaleemfcsasfsrrm(  ;t1apx mfeiytfsDrl( s u4teeoxfcoa1lmDelnes;s0 2uoxr oodopt  fcil(f rrmxmpoo4texnmoctltla emumo u4aeeoxf oodlpt lu i;(0teurxm3oudopenmnesa(fa2ur( pot1altnio3ildfa2ulumsnu4aeenxo iydla r n o;s  rurimpiydlle  ncslt)sDrr( o;u4tex  f3iatfa2em( s () leoirctodlpteaivo ( s2trim3iodalenmnvi (faDur(mpnt1tlxniicilsfa rm(mp ()tlxomo iotopt lieo;s)trur(rpiydll  mfvils)aDtax  nt4alxo ocildlmDemu p;(0 lenxf totopD livs;s)srxrirpio4omtemfcilt) rtmu  ot4tex iiciytls2rmu s (4aleoxf iatoaDeln slt  rtrimpoydopt lnctatf rraurpou1oleoifcias sDelnmp t)aexrmocty1fp  livs (0teumir3no1lpt mivi s) Drru p;u0opxo feildfm2uauvsnu0artnxf3oydoa rliei t setr(o io1opeelict (  Dtm(mpou1tptoio3ils m ra(vs;u4aetnmo io1fatrln i s) etm(mpoy1amenmnvslsfs2ra( poo0tltnmfciydfmDulnvs t4trtrxrctodfm eanvol(  2xmxopnydam emfvia() Dtmumpot1tle  icild mDelnvon(0trtoxr iydlmt lnvi t  ruoxr3nudopeelnesl()aDrm(r oo0tlenioeiasls2em( o;t0 lxomocty1omDe u o ( trumxr nudlmenmiesl()arumx p;o0tpeomieilsfsDul(mp t4arxnmf3oodoatrlu ilt  rum(mpio1oltn fcil(f Drmurpoo0oexnif3ilsfa2em(vo;u0 etnmrcia1op ran ils0trxoxr3no4am emicils) ruru  ot0tpx ii3tasfsDea( onu4altomo3oodfm  aues;t)trxoir3iy1alt  iviasfa2tm( ooo4tptnmfctydfm ua( pnu)trtoxrciodomtr ivi s0s2xo(rpoodop e nviatfs2rrurpoo0aexnmo3iadla um(vp;t0tlxnxf3ty1omteau i t tetoirpnu4lpt lietls sDtaxmpoo1ope moctasfs emnms;t0tltnxoctotlaDranvs t)sexmir iu1alte ivi sfsDraxm ;u4tpxo ietyd m2el(von()teenmfciadlptr ivs;()setmxrpiu1omtnlivtas a2tru  no1tex miciytfm2rmu s u) rtnmrciydfmte uvs;(0t2uoimpiydlltn iesatf 2raxroot4tex ii3tltfmDeln o;()arermo ta1oaD  uvi;t) etmxr3iu4ap e ictlt a2trurono0tpe iietld m elnvo u) exomrctydfmtrai ils texr(opoy4ape  ncslsfs2ua(rpno4oeto i3tydlsDeaumpnu0 lenmo3ootom raneilt0 2xrxm oy4apenliciat srrrx  ;o4tleniieiyd m2rm( o (4tetnif oatfpt  nvi t0 exo(m3nydame lnvi s)arra( oot0apen ietad sDul(mo u4 lxnmo3oydlpDr i ils0 rxrxm3oydlp e ics sfaruau o;u4tlt ioeiad s2uanms () rtoiocta1lmt  uei (0srurxo3nu1ope mneta()aDrru onu4opeomiciyt sDumuvpnt)aeeoxfcoa1la e ueilt seuoxo3oy4olee ivslt aDuaxr ;u0texo i3iydfsDrlnmont4 ltrmo3oa1lmtr u o;(0s2to(rpoudoleemiet tf rrr(rono0optoiietlt a rm(vp ()artoxf3io1lmD aivs;(0 exoim3iy4lpenlieslt  2urum nu1tpeo octlsls2ua(vo t)tlenxociy1oatr ieo t0s2xo(o oudol   fet s  2uaxro;u4aeto i3iadls rmu s;t0 etrmo todfptr nvi s0setm(o3iu4lpenlivt s)a2raxm ;t0tptoifetyslm em(vsn() exoxr3ta1op  lu ilt0 etrxr oo4am  mnesl() Dra(ront1oetnmfciysfs2eaump t0 etrmf tatom  ai o;()setoio3io1ape lnetas  rtrxmp;u0tet mf3ilt aDulu o () lxoxrctadlp  lnes;( s2xmir no4omtnmiet tfsrum(mpou4oexo icilslm umnvsn(4 etomrciytoaDrlueolt)t2um(o3no4amtn nvsas)arurx poo0texnio3tyd a2rmumo;t4 lxrmo3tydlmt lues ()trtmxo no1lpt mietat srur(moou0alxnifctls a2um(ms;t0trxnmr ta1omt auei ( s2ur(r io1om nmicias srtax ont0teenmietldlsDul(vsn(0aetrxocoa1omteluesls0 rxr(rpou1omeelici ()sDrr(m ;o4oleomo3tls aDemumo;t4teeomfcoa1fp  li sls) 2xmir3no4aptnlncils) Dtmxront1oltniietydlsDea(vs t4 eeoxocoy1lptranvi (0trxoxopou4omt  fct s)s2tr(  ;u4aee ifetltls uau snt4arxoifctadlmt au sls0 rtmio3nydaptnlnvt ( sDra(rp;t4olxoiociysfmDeaumonu0teenmf iatopDrln o t0trur(r3oudlle mict tfsrrrur nu4olt  fetydfm um(mp (0aeenifcootfate nvo s0srtm(o no4om nmfcs (f 2trx o;t0openifciyd aDelu snu)altnmrciodfaDr n ol(0sexrxo iu1op emfvsa( s2rrxm ;u0olen iciltfmDrmu s t4altnxfciy1om  lu ols) exo(m iu1lpt lictatfartmxr ;u1openio3iat m em( p u4tlxrmfcto1lmt ai i ( sexmxr3nu4om emivilt)aDtaxmpoo0ope mfeiys s2ul(ms (0alermr oytlm  aiei s0seto(m3no1amtelnviat) Dra(rpnt4olx  iciadfa rluvo t)tetrir3ta1fate ues t0srxmxrpoo1ap  mnvilsf Durumonu4tpeo iciydls2ul(vp;t4arenmocoa1oaDe u s;t0 2tm(o3oo1ale  nvslt)arrrx onu0opt  fciytls emuvp (4arenircoodopDeaivolt)t2tmxopny4lmtnlivs sf rrmxrpno0tet mf3tlsla2emnms;u4artnxfciy1laDr uvs;s0s2tmxopiy4apee nvtat) Dum( pnt1alx  iciadfmDra(vp;t) lxnir3ia1omtrlu slt  etoxm oy1llt  nvt s)arum(r no1aeeniiciydlm rmu s;t0tlxoxo to1fa ean i t s2uo(m3iy4op nlfctatf 2ra(m ot4teenioetlslsDuanvs;t4altoxf3todlate u i;()trtr(r iy1lpeelicsas)a2rm(  ou0opx  ietlsfm2rmnmp;(4teermf io1fpt  ueilt srxr(opiydol e icta( sDrm(r no1tpenii3iys s umuvs u0tltnxf oodfmDeanvi;s0seum(r iudalenmfes s aDtrxmpno1tet mf3iydfa2rmumo;t)tltoxo3oadoatrauesl() 2xoxmpoo1oltelfcilt) 2rmxrooo1tpx ii3tyslmDum( on(0texrmfcoydlm raies;(  euoim oodapen ivilt srtaxr no1alx  o3ild aDean snt0 eeoxo oy1lmDrln i t)texrirpoo1ameelfetasfsDrrur ;t4aex  oetad m2elnmo t) exomr3oadlmtrln il(0 eum(o3nudam  mfvt s) 2urxmo;t1oeeoiietlslm elump;(0 etnmfcoodfptrlu o;( trxrir3no4amtnmnesatfsDtmx p;t1aptnmfetadfa2umuvo t4 leomr3oodlp e nvi;s)t2uoxm3no4ol e fesa(fa2uax pot0teeo iciltfsDrmn s u)treoir3oy1lmte ieils0 rxoxr3nu1ome  ivtltf Dur(rpnt4tpenifctld aDean o (4aexnioctodoaD  nes;t sexm(rpoudlm emneiat) rum(m ;u4aleomfetysls2rln p t0 rtomrctotfpDrau s;t0 2uoio iy4ole lfvt sfsDrauro;u4tpx  oetldla2rlnmo u)tleoxf oatopt li ol(0t2xr(o3no1ape  neil()a2rruroou0aexnmf3iaslmDrmnmp;()aetomocoa1fa elnvo;t tetoimpiu4op   neias a2umxrp;t0ope io3iasls2rln o t0 etrmrcoa1laDe ieilt0t2xoirpoy1lmeemfviltf rtr(rp;o4tpeoifeiat aDrm(vpnt)teeoxf iotfpDr nvols0texmxm oy1lp n fesl( sDrm(r ot4optoifcils m2emu sn(4alxrifciotfp rlu i s)sruoxm3iu1alenlnvslt) Dtr(r ot4tet mociydfmDeaumsnt0 reoxf3ty1op raivol()texr(o3iodamen nvtltfs2uau ono0teeo f3tytfs rmuvp ()alxrio3iydlaDeauvi;s) rumir io4lp e ivsas)s2raumpot4tle  ieiydls2uanvo t) rtnmr3tatfaDr ueilt)trtmxm ny1lp elneia() rtrxr ;o1opxniictlt mDrmump;u0areoxo to1fpDelu i ( teumio3oudapenmfeia()s2rau p;o0oexomoetydlaDrmnmo (4 ltnir iydlp eaueo s0srxmxo nu1llt  icilsfsDta(moou1olx iieiytfs2raums;(0arxoio oatopte neslt) rtmim oo1alte ncsatfartr(  ;o1tlxo ictldlm ul(mo;u4tlxnxrcto1omtran s;s srxmiopny1lltnlncsa() Dua(mont1tpeoif3iltfm ranmon(0aexoxf3oa1oaDran sl()s2tr(r no4op elncsa()a2rm(mpoo4oetoiieias mDran s () renmo3iydfmDeanvo s)trtm(o3ny1lm  mfvsat)s2trx poo4apeomietys s umu snu)trenmfcta1op r uei;s)t2xoxrpiu1am nmfes tfarumumpnt0apt  ieiytlm2ea(mp;u4altrmr3ia1fpDr ivs;(  euoxm nu1lmtelfeiat)aDum( pot1alxn fciysfsDumnvo (4tlenir3iy1opt  uvs t)trtmxo iodll emici (f 2umx pot0apenmiciaslsDran o () rxomf tytfa eluei;() rxmxm nydop nmnvils) Drrxr ;t0opxo feilsls2rl(vp t0tetrmrctodfpDranvi;t0 etrxr3oo4am  lfet t) Dtrxm ;t1tetoioeiyd mDuluvs;t4texrio3oytfa r u sl(0srumxr ny4altemnei t artr(moot1apxomoeiys mDrmn p t4altnio3to1fm r uei;t s2ur(mpio4alt micsl( srrau  ou1ope moctytfm2um(vsnt4trxoxf3ia1fp  lueils0trxo(m3ny4omtelncsa(fartrxro;o4olxomoeiltlm rmuvp t0texrif iodlpteaivo;( srtm(mpio4aptnmfctas s2tm(rpoo1apen feiysfaDeanms u)tlenmrctodlmDr ueils)t2um(m3oo4amteliesasfaDrauronu0alxoifetydla ua(mp;t)trxoifcoa1fp   i ol()truoim3iy4ope mfvsat)s2tm(mpnt1tlenifeiytlmDea(mp ()teerifcto1fpt livi;t  2xm(o3oo1alt livtas  rrm(m ou1oet mo3ilsls umuvo;t0aeeoio3iadfm rlivo;s teto(o3nu1ol n neil(fartr(  nu1aeenii3iyd sDrl(mo;u4 etnmo3to1lm   uvi;t)t2urxrpno4ll n fcia( a2tmxm nt4aexoiieiysla uluvon(4 rerif tytomD lu i (0seuoxm3io4am elneta(fa2raump;t0teeoifctadfaDrluvp (0alxoxr3tytomD lu s;s srxmir nudoltelfei tfa2ur(r oo1olx iociysfaDrm(vo;u)tlenif3oodfat lu s;t sruoxmpnodll nmfvta(  ruau  nt4aexn o3iadla2ul(von()aeermf iydlpD  nvi t) 2tmxm nodopeemivsl(fs2trx ono1oleomiciys s2uan pnt) etrmo3ia1late u ils)srum(r3iu4lltemfctatfa2raumooo0ale mocils m2rlu o;t4aetrmr oo1oa e i ol( teum(r no4omenmncs s)sDra( p;u4tpt  f3iatlsDrlu p t) eenifcty1lm  an s;(  rurio3ny4lm elnvilsf rrrx  oo4opxn o3iysfm2rlnvsn(0 ltrir todla  lnvi ( teurxo3ou4olee nvsls)s2trurpno4aexoif3tys aDelu snu4artrxfctodlaDe u ol(  rxo(rpiy4ape mieiasfsDtaumoou0tetoii3iat a elump;t4tltrmo3ty1lm   iesl()s2xrxopiu4al emnesl(farta(  ot0tltnio3iasls2um(mp;t0aeeoxociydla rlivi ()s2toim oo4ole  nvt tf Dra(mp;t1apx ii3ilslm rlnmpnu) rxoxo ia1omt lu ils)teuoxr3nudamenmfesatfs2urumpot0open fctldfs2el(vsnt0 rxrxo iy1op e nvil(0 rtriopnydapee fvi s)sDrm(m ;t0alxo oetad m rmumo;(0tetoxr3tydop  auei t teuo(r3iu1lp n ieiat s2tmu pnt1olto fciytlaDumnvp (4trenxo oytfmt anei;( sexrxm3iu4altemnes ()srrauro;o1texnmo3ilsla umnmo t)teeoxrctydlm  anvs ( trto(m3oy1lm  mnet sf Dumxmo;u4optnifctltfs2ul(vpnu) rtoxf3iytlm ran ol(0 2tmxm3no4omen iciat s2tmurpno1texnmiciasfaDem(mo;t0arenif3ty1faDrauvs;t0trumim oo4ll emfctls)sruaxm oo0tlxnif3iydfs rm(vpnu4 rtomr ty1faDeli s;s0trurxm io1alt  fctl(f 2tm(rp;o0oeeo octlsfsDranvs;t)aexrio3oa1fmDe u o;t sruoxr3oydameelivi t)a2rrxr ;o1opx iictasla2rm(vsnt)trenmf todop  anes s)s2tr(m iu4llee fvsas)srra(moou0aet iietlt s rmn p t0tlenircta1oaD livo;(0sexmirpny4ll  lici s aDtmxrpnu4apxnmieiydlsDrm(ms;t4alxnir3to1om  li o () etrxopoy1apeemfvta() rtrxrooo0opxoifcild m ua(ms t)tlxrmf3oadlm  lnvs;s)srtrir3oudoltemfvsls) Drrxmooo1aexnmocilsla2rmnvpn() rxomr to1omte u slt)s2tmxr nydlmtnmfeta(  Dur(rp;t1tlenmieiatlaDran p;t4aexrmf iy1fm eauei;s0s2umio3iy1lp  mnvt ()a2rr(r nu0olx  feiys a2ea(vont0artniocoy1la rlivils)trum(rpno4lmtelicta(  2rmx oou0olx  oetad m2ua(mo;(0alxomr3ta1op eanvo () 2xmio iydaptelnetasfsDtm(mpot4tpe mi3iys m rm(msnu) rtnifcoodomtelnvs (0t2xmxr3iydal nlnesl(f rtrxrono4oltnmieiat s ea(vsnt0areomrcta1fp elnei;t0t2xoio iu4llee ieiat) rua( ono4tee mf3iadlsDuaump;u) ltrxociotfmDe nvo;t)texmxo ny4lmee fesat a2urxm nt0aexomietas m ranmo;(4aexnxf ia1lm  aies;(0 ruoxm oudlle lfvia(fs2taxr ;u0openmocils a eaums t0aetomo iy1lmD  nvo;s)s2um(opiy4om emncsas  rumx pou0opeoifeiytfm2ra(ms u4 lxoif3oydlm  aueo;t)texoirpoy1lpenmictat)a2taxm oo0oltoioctatlsDeauvonu0trtomo3oatomD anvils0srum(rpno1al nliesas)a2tmur nt4altoiiciyt mDelnmont4tltrmfctytomteau sls0trtrxo ny1op n iesatfsDraum nt4tlxn i3tasfmDulnvo (0 etomrcoy1fpte n i ( s2tr(rpoy1lmtn nes t) 2ururpno4optomoeiydlm2eauvp u4tetomr3oytfmteauvo ( seumim nodlp e ies t sDrmum ;u4alt moeilt m ul(vs;u)tlerir3oytoaD aues;s trtmxo io1opt  fvil() Dtm( poo4tetomiciatlaDeanmp;u4 leomr3iytom  auei;s) rxrir3iy4llen nvtatfsrtmum ou0oleo feiytfa uauvpn(0tetoxo oo1fp eau s t sexm(o ou1lp n ietlt aDumumo;u4tltomo3iysfm emnvs u)teenxfcoytfmDeli s () eur(o3iy1lm nmics (f rtrum ou0tptoiictydls2emuvs (0tlenxo3ootlptelu i t)setmxr3iy1al  mictlt) Drauroou0texn o3iatfm rluvp;(4trenxo3iy1fm eaues (0srto(r ny4ol elnvtas)aDuaumo;u1oeeoioctytla2em( on(0 lxrif tydfateauvs;t teurim3nydopt  nei tfsrta(mp;o0ale  i3tyd s2uanmo (0tltnmrcootlpteluvs;s0 etmxo3nu4lpeemivia(f Durxm ot0opeoifctydlm rl(mp u) rtoio ty1lptrauvs;t s2um(m3iy4om elivt t)srtrxmpno1aexn fciad m2ea(mon()altrirciydfmDrau s s)sexrxo nu4lmtemiesl( a2urumpnu4tpenio3iatlsDuanms (4tlxoxf3ty1fmD  u s;()t2tmio3iy4ape lfcs t s2ururono4oee  o3iadfmDumn snt)aetnmrcoadfaDraivolt trtoxm3iu1amtemiet tfsrtrumono0altnmf3tytfm2ua(ms ()tetnir3tytla rlu o t  eum(rpou1ap nmnvi (faDrr(moou0texo o3iysfmDuan o;(4teenio3oa1lmt anvi ()t2tmxm3io1olenlicils) 2umum no0ale ii3iadfs2uauvp u) etrmf ty1lp r nvi (0trtoim iodam e nei tfsrrmurpno1tee  f3tltfmDeauvo u4texnxfcio1opte nvi s  rto(mpoo1apen ici sfs2um(m oo4tlx mfctldfm2elnmsn(4 rermfcto1laDe ivi;s  ruoxrpio4ol  mnci s artmu oot1alx  feiytlaDeanmsnt4 rtrif oa1faD  u i () 2xmxopny4lm emnesl(fsrtru  nu0aet  ictatfs2elumpnt4 lxomr3ia1omDrln olt) 2toxo oydomtn nvs t srraurpoo0tpto feilsla2elump u0aetomr iytlate ivs t texr(opoo1openlfvtltfa2tm(moot1alx iicildls2emuvs t4aexrioctydom raivolt) 2trim3iudom emfcsat)s2rau ooo0tptnifetatfs2rmuvp (4tltnir tatop elivols trurim no1lpe  ncsasfarta(m ou4tpx ifctlsfs2eauvpn(0trtnir3oytomDrlieo s)srtoio oy4ll   icils artmxmpno4texnii3ils m uau pn(0arxnmocio1fmD lu s;t0srxm(r nudape lfeias arum(rpnt1altn o3iatfaDuaumsnt4trermo3oy1la  lnei s0setr(o nydomt  ics ( s2tax pnt1tet if3iltlm rlu snt)alxnxocoatfpteaies t0trxoio3oy4lmee nesl( aDtm(r nt4tltn o3iys a2uau on(4 eerxf iadfpDrluvsl(0srxmxm iodap elici ( aruau pno0tpe ifeiydfm ea( s t)artrio3iydopD  n ol()srxo(r3io4opt lfetl() 2tr( ono0aptoiociatlm2uauvp;u) exomrctadfpteluei;(  2to(mpnodlp emfciatfarumxroot4teen feiaslmDuln snu4aeeoxrcoy1oat aieslt s2xrxr3nu4lleemncslt sDurxmp;t4oeen fetlt sDeauvo;u4arxrxo3oo1op eli ilt0teto(rpnu1am emnetas s2ta( oot1aet ii3iltfs emnms;t0 ltnmr tytopt  uvsl(0 2xmim3iu1ll e fcsls  2tm(  ou1tlxomi3iydfm2rauvonu4texnif totlatelues t)s2tm(m3iy1lmen fet ()s2ur(m nu1aptniiciydla umnvs t4 exrxrcootlpDeaneilt0trxrir nu1ameelfvs sfa2um(rpou1oltomfeiltlmDemuvo t) exrir oydfm rln o t sexrxr iydll  lnvs (f Dtmuro;t4tlenmoctatls2em(vs;t4tetrir3iodoa  lueolt s2uoimpoy4am nliesatfsrrrx o;t4aeeomo3ilt aDumnvo (4tltomfcty1lmtr neol() rum(rpio1am  mfvi sfarrmxmoou0aexniieiytfs umu onu)areomociodlmtr uvs s  exmim3nodame  ivi (faDtaxrpot0oltniieiyt s uanmp;(0aleoircoy1fmDrlnvo (0 2umim3nodom n iesatfaDrm(mono0open octasfa2umu o t0arxnio3iotfptr uei;s)trtrimpoy4ame  icsls sDtaur ;o4aee micild s2umumpnu)trtnmrcio1fpD ln ols0t2uo(r oy1open ncsa(f rtmur ;o0oeeniiciyt m ra(vs t0aeeoxfciatomtrlneol() rto(o3ny4apt mfetas)s2ur(ro;u4olx  o3tatls rmn s (0trxrircoytoatelneil( srumio oy1amt  ivs tf rrmum no4tpx mf3iysfa rlu o u0 renio3tytoa  aiei;t  etrxr ny1opee ictls)s2ua(  ;t1opeo ocils a ulnvsn() exnxf3ootlpD  uvo;t setmxr3ny1lmtnmivsatf 2umxrp;u0aeenmi3iyslsDeanvo;u) exnxocoo1fateln o (0 exoim io4ape lnet s  Duaxrp;u1tpeoiocildlaDulums u) rtomf ia1fpDeaiei s0s2tm(r iydll  mfvi ()srtmx pnu0oetoioctytlm um(vs;t0alxrifcoytfptrlieo t  rxm(o oy4am   ivsltfsrrmu  ;o1aeeo f3iyslsDrlnmpn(4tetnmr tydlaD aies;t0srtmir3io1omeelfei t  Durxrpnu0alen octatlaDea(mo;u)aexrio3oydfm e nvs;s srto(r io1ll nmfcsas sruaxmo;t0opx  feiltfs2uln o t0 lenmr iadfmD li s s0seuoxm oydal  mnvtl() 2ta( ont0tle iietadlm ean s ()arenxo3oatom r uvs;( seur(opoudlle  icil(  rtauro;u0aexo ociasfaDra( pn(0 rtrifctodoa raiei;()s2xoxr3oy4amt mfci ()aDtaxro;u4apx mi3ils a um(ms;(4 etnmfcoodlmD auvil() rumxr3oo4opt mnci t)sDtmur no0opxo iciltfs2ulu on(4texoir oadlmDrlu il( trumxrpnodlpe  icsls srurxmpoo4tpenmoeiadlm ua(vs;t)areoif oatfpDranvsl(  rxoxopou4al nmfctl(farrmxmpno0tle  i3iysfsDulu o ()tltoir iadlm rlnei;t)seuoxr nudlp e icsls) Drm(rpnu4apeo ietytlm2umnmsnu0aetrxoctotoateanes ()srum(rpnu1oltnliei s a2urx p;t0optomfeild mDeaumo;()arenio tydfmDeauvils srtoimpiy4lmtnmfcils)a2umxrpot0texo fcild m rm(monu0texoir todomDraiei;t0 rxm(opou1oltemicil(fsDrmuro;u4apxnmo3ild sDrmnvo t0tlxrir3oodoa rlivils) rxo(r iydapenmivtat)a2umxr oo1apxo fctytfs eanmo u)aeeoxr3io1fate ivs () rumir nydop e fvtas a2um(m ;t4aex  fetltls ra(vsnu0 rermrcoo1fmDelnvo (0seurxm oo4altn fci (fsrta(  no4teeoif3iydls eanms;u4tlerir totop eaivi;s0srur(mpnu1alenmnesat sDuaxr ;o1tee ifciltfa eanmp u0alxnir3oatfmt  n slt0 etm(opiy1optnmncsat)sDtmx p;u0aetn fetydfs umn p;(4 exomr3to1oa rln s;t)teuo(mpiudope lfvilt)srumxm no0open iciydlm umnms u4tleniociydfate neols0srxrio3io1lme mnvtatfsDrrurp;u0tpxoii3tldfm uln onu4teerir3tytopteln i t t2xrio no1ol elfctat) Drr(roou4tlen iciyslmDel( s;()texrxo tytoa e ivo ( trtr(opny1ll   ictls  rum( oot0tlenmfeiyd a2umu o;u0tlxnif tytlp rai s t) euoxmpny4opt mietl(faDtr( o;u1alxomo3iyt mDuanvo t0arenxoctotoatr ieo t  rxmxo ou4am emnct sf Dur( p;u1alenii3iydlm2umump t)aexrmf iydlmDe n o;s) 2xmiopiudalte fctlt artaxm nu1olxomfetys m2rlnmsnu4teeomocoa1lat  u olt s2trirpnu1lpte iesls sDtmx  ;t4aeenmocilsfaDuanvpnt4teeoxr iodlat  u s;(0srxmir3ny1am  lfctl(fsrtaumo;u0opeo fciyd m ua(vsnt4tlxomr3oa1faDrauei;s  2tm(m3ou1oltelfei s) rrrurpnu1teen i3tyd sDrlumo t) ltnir3ty1fatelu o;t0srurio3io4lp e ivtas arra(mo;t0texo f3iys s rmnmsnu4 eeoxo3oytlpD  n o;t)s2umxopoy4ol elfci sfs2rm(mono0tpxomietlt a eau s;u4tetnmo3tatop eaivi;t)seumim ou4altnlivia(fsDtmumpnt4aeeomo3iydfs ulnvp;()tleomf oydlpte ivils) 2trirpnodlptemivilt arrmuroot4tetoio3iltfaDrmuvp t0artrmr ia1omtelu i t0setmxo3iydoltnmivs tfsrrmx p;u0tex mo3iatfmDrlnvsnu0 rxoir3ia1lptelnvolt)seum(o3nodll nmivias)a2uaxm oo1apx ioetldlmDrmnms (0 ltnmf3to1faDeauei t)setoxo3nudame  fciatfa2rm(mont0apeo f3iatfm2emn o;u)tlenmo ootlaDr u i;t0setrxmpoy4ap  lnvs s aDtmur oo4tltoii3iat mDeauvpnu)tlxoxr oytopDr ueo s) ruoim3oo1amt mfvt sfs2tm(mono4tetoiociatfs2ul(ms;u) ltnxfctodfm   nvils) rxm(o3iu4omt  fesl() Dtmu oot1tpeniiciyd m2emn s;t)tlxomr3tytfpt lu slt0 2urio ny1om n iciasf rrmx p;u4aptomietyslm2rmuvo (4tltrmo3oytom  lnvsls seum(opiu4omtelfcs (faDtaum nt1oltoii3tat s2el(vsn(0trtomo3oy1lmteln o;t s2toiopio1omtelici ()artrurpnu4apxnmoeild s rauvs;(4 exrxoctodfp eanvi;s srxrxr iu1lmt mivi ( arum(mpot0teenmf3tyslsDuauvsnu0texnir oy1oaDr ivo;t0trtmxr3oy1ameemiet sf 2uau pot1oleo o3tyd aDelnms () ltrio3oydopteai ol(0 rxrim iu4amtelneslsfsDrmu oot1ope ioctydfm ranvs;u0tltnio oodlmt lneslt)s2xo(o3iodlptelici t) rumu pnu1aee ioctysfsDemn s;t0 ltnxr oy1omtr nvo (0 eumim iy1lmen fci t)aDtm(m oo4tet ioetltls2rl(vo (0trtnmo3tatfateli o;s0 2xm(mpou4omenlfes ( s2rax poo0opxoiicild mDem(vp;u0 renmf todomteanvslt)setr(rpio1amenmneia(farrruront4tlx mfeiltfaDran o u) etrir3tydopteauvi;t  ruo(r oydom  lnct (f rtaump;t1aptoii3ildfm2ulump;t0tetrxr3ty1oaDe nvi;()setrxo oydlpt  fes ( a2rru  ou4oexn ieiaslaDelums;(0 rtnio3oa1laDrlies t t2urio oy4lptn nci ()s2rrxmo;u4altn f3ils s ulumo;(0texomf oydoa  au slt0 etrxr oy1lpenmietat) rtrxmp;t1tpe  i3tld m2el(ms t0tetoxf oatlpDr u slt)t2umim3nodaptelnet s)arrmxr ;o4ole  ietyslmDua( snt4 lerio3totom eanvo;t srur(m oydlm emfct ( srumx o;u4oex mf3ilt s ulump (0aetoxr oodfa rau i;()srxo(m oydol e fcia( artmxmpnu0texn o3iatla2el(monu)artrxrciotopt anvo;(0 2um(opoodale  ictas  Dumxm ;o4tetomieiyd m2rln p ()tetnxrcoydfaDeaivol(  2xrxr3ny1olte icsa(f rtm(m nu1oeen ieils s ua( s u) ltnxo3tadfmtrauvil( tetrirpiudlmt livtls)aDum(  ;u0alxo o3tltfs2rlnvo u0tetrxo iydoptraues s)setm
\ No newline at end of file
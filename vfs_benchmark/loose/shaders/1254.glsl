@@ -0,0 +1 @@
+u o s  eurim iudoleemicta(fartaurpoo0tlto o3iltlm2ulnvs;t) renxr3todfpt  ies s  exrim iu4lm elfeta()artaurpnu0tptn f3iyt s rl(vpnu0alxnif3iodlm  aivo;t0 etoio3iy1lmt mneil(fsrra(ronu0aleomoctadfm rmumsnt0aexrmf3oadfp raueo t t2urxm3no4om emnei t) 2tr(rp;o0tpe if3iytlaDrmn pnt)treomr oo1fmDrlivsl() 2tmim ou4aptelnviatfaDtm(rp;u1aet  ictyd a umn pnu)areoxo3ootfp elu i;(0 eurimpoo4am e fct ( s2rruront0oetnioctyd m eau o u4aexnxr3tytlptr ivs (0trtm(r3iy1ll  mnes s srtrxroou0apenifciadfa ra(mp (0 rerxr3iatfptrlu sl()t2urir no4altnmivt tfaDrrumonu0tle  f3iytfaDumnvsnt4aetnxoctadfat lneo;()seurxo3iy1lltelfciat s2ua(r no0oeenmfeildlm2umnmo (0trxnmf3iy1fm eaivi (  etrimpno1omt mnesas) Dua(rpnt1tpxnifeiytfa2rmnvont)aetriocoydfpDr nvo;s setmxmpoy1amenlncsasf 2taxmoot1tetomoeiadfm2ul(mo;(4 reniocoytla   nvo t  rurimpiodape licia()arumxm ot0texniocild mDuanmsn(4teerir3tydop eanvo t texr(m iudam nlfvsat)srtax ono0tlx mfctytlmDuan s (4tlxnir3oodfp r uvi;t) exrxo3nu1op emnvsat  2umxmo;u0optomi3ild aDel(mp u)alxrxr iatoaDeluvi;s trtmxmpoy4lpt mnctl(  Drmuroot1altomiciadlmDrlnmpnu)tlxomocoy1lmDraieo () 2um(o3oy4lpen fvi t)sDrr(mp;u1oee ii3iasfm rlump;(0tlxnmr3tatfpD an i t setmio3nu4oltelics t)artaumpnu0ale mfctydfa um(mp;()artoxf oo1lm e n il()trtr(o nudlm e fetl(f Dumu ono0tlxnmietlslm rau pnt0artrmrctatfa e uvs (0 rxr(m3iu1al emnvilsfa2ur( p;t4apenif3iad s rlumo;()tltomo3oy1oa eau o;t  rum(o3oy1op e icslsfa2tm(rooo1aet iictysla rm(vsnu4 eermr3ia1lat lnvil(0texo(r3nydomtnliviat sruaumoou0oet ioetls a2eauvsn(4 rxoxo tadfmtelivils  euoim3ou1apt mfcs t) Dumu oou1tptnmoeiysls ra(ms;u0tlerir iotlmDr neo (0tetoimpny1al n ics tfa2tax pou0tex mf3iadfsDulumont0tetoio3tydfmDrau ils  2urxo3iu1alte nctl(f Dum(rpoo1aeto fciasla um(msnu)aleoircoydopDranvo;(  2toxmpnydlpeemfct t arrrxrpnt0alx  oeiaslmDeanmp t0aetnmo ty1lpteaneils srtm(o3nydam n netls) rua(  ;t0tpt iocilt mDuanvs;t) lxrmo to1omteliei;(0t2urxo3oydllt  nvt sfa2tax  nu0tltnii3ildlaDelump (4altnxr oydlatelieolt0srtoxmpiu1al nmfcils aDtrxmont1aeeomi3iytlmDrl(mo;t4tlenxf3tydlaDe i o ( sruo(opou4altemict s) Dumxr ot1ale iociltls ulu s;t) rxoircio1opteanvi s truoxm io4ol n fes (f 2um(r ot1apeomiciaslm2ranmo u) rxrmf3iatlpt  u il()trtrxm oodll   fetltf rumu ooo0teeoifeildla ulnvs u4tetoifctodoa  lu s s texmxo3nydap e fes s)artaxronu0apxomfciyslmDra(mp;(0aexrio3oydlpt lneo s0setm(m oodlptelfeiltfsDua(mono1aee  ociys mDulump (0arxrxr3iy1lpDranei s srumir3ny4al nmfcilt sDumxm ;o0alt mfctaslsDrlnvp;u) etnmf totoa e nvi;t0texrxr3iydom e ivtlt)a2rm( oot0tetn fctas a2rmnvpnu)tetoir3tatopteanei t0tetr(m3ny1omeelnvi sf 2rm(m nt4tlxniictadls rl( pnu0arxoir iatlmtelivil(0s2umiopno1lp nliciat)artrumpno0opeoioeild a2raums t4trtrxo3oo1op   neilt t2umxrpny4apt mfvtlt)srtm(mont0aptnmfctatfa2rau p;t0tlerio oo1lm rauvol(0t2toir oy1lmtn iciasfsDurxr ;t4aptoii3iatfaDumu pn(4 etnir oo1optrluvol() 2toxo iu4apenmict s) ruau oot1tex moeild a rmn p () exrxfctytlmte n o;t  eurxo3iy1ole  fetlt s2ur(mo;t4aptoifcilt m emuvp;(0trenio tytlmt aues;t seuoxm3no4amtemies s s2ta(monu1tet ifeiydlsDemn p;t0aexoxr iotoat  n o s0 rtoxm oydlle mfvtl(fa2tmxront0tpe  ocilsfm rlumsn(4 etrmf3tadfaDrauvols0 etmirpno1amt lfvsas)arra(r oo4tptoif3iasla eluvp;t0tetnio iotoa   uvilt teurimpnydlm e iesas)artaxr ;t0tltoifcilsfm2uauvs u0tleoifcio1omtelivi;( s2um(r3io4amtn ivsat)sDtau  ot4tpen ociyslmDul(vp;(0aexrmf iotomt au i ( sexm(opoudame mictatfsrta( onu0olt  oeiatfs2uau o;t0trxomfcoodomt  ivs ()sexoirpno4lltemfvils arua(ronu0olxnifeiysfs uaumpnt0tlxnmrctytlpD luei s  rto(o oodopeemncilsfarum(r ;t0alen o3tltfa ranvsnt4alxrmo3ty1om   ivilt) 2uoxm3ou4om nmnct s)a2urxrpou4tleo oeiytfm ra( snt4 lenxrcoa1lmD li i;s texmxmpno4ol   ivils  rumuro;t0tleoifeiaslmDeau p (4alxrmoctytomtr u o;t trxr(m ny4amtnlivi s s2rmu poo1oex iieilt mDran snu4altnio oy1oaDe ies;s)srur(o3nudomtemfvs tfsruaxmo;u4tpeoifeiltfm2umums;()aleomrcoa1oateln o;( setmxmpiu1lpeelietlt  2trx  ;o4texoifciyt s rlnvp;u4tltrircto1lmDr i s;(0seumxo3oodlleemfcsat)aDua(  ;o1optnmietytlm2rlu p;u)texomfcoy1om rauvi;s seumim iy4om nmics (fa2rrxrpnt4oltnmociatfa ulu snu4tlerircoatfm r ueols0setmir3ou1lp elics ( sDur(  ou1altnmicildfs rm(vp;u0 rtnio3oodlmt  nei t0seto(opoy4lm  lfviat) rrrx p;o0aet  ociatls2eau ont0artoxocoo1opt aivo t s2urxopoy4om e fct s) Dtaur ot4openmieils m2ra(ms () ltoio iatlpt lnvslt srtmim3iu4apte ict ()a2ra(rp;t4aee  f3iadfm2el( s;u4tetomoctydlmD luvil( s2trim3nodope mfctlt)s2trx  ou1oetnmi3iysfsDua( o u)aexomrcoo1lp rlues;( setmxopnu1al n ici tf rra(mono1oltn icias a2rmump ()tltrif3iadlaDr ieol(0t2uo(r iudll nmici (fa2taxmp;t1texnmi3tyslsDel(mp;(4 lenxf ootopDrluvi t0setmir oo4lp  lfcsa( sDtrum nu4optn o3ils m em(mp t4arxrxr3iydop e ivs s)t2tm(rpiy4altemnci ( a2umxrpoo0olxnif3iyd a2em( p;u)alxoif3oatlpt ln o;(0 rxoirpoo4lltelnctasf ruaxm ou4olt  ictys a rln p t)tleomfciodop rluei s0texoio3ny4lp nmfci (f Dtm( o;u1tlxo icilsla eau s (4tlxomo tadoat lnesls)trtmxo ou4llen ivsa()sDur(  nu0olxnifetat s rlnvsnu)tetoirciatomDelnei ()truoxo iudlm n nvsasf 2ur(rp;o0tlt mfeiad a rmuvont)tlxrxocta1oaD  iei;(  rtrxm iydap   fctatfa2tmxro;u4aex mfetytlaDrlump;(4tlxoxf3oydfpt au ol(  exoio nu1ape lnei s) rta(rp;o0tlxn i3tlt s ea( pn()aeerxoctatfm rlues (0 euoir nu4ope lici s) rraxmont4apt ioeiasfa um(ms u0texoio3oadomte uvo;t srtmir3oo4lltemivsa(fsDur(mp;t4tpeomictatlm rmnvs;t4tltnxf3iytfm ean il(0tetrxr3nydaptn ivt tfsDra(mpou1tpt ioeiaslaDelnmsnt0aexnir tydlptrln o;( sruoxrpiy4lpee fesl( sDrau pou0aeenifeiltfs emnms;u4 exnxo3oytfmtrlueils texo(opoy4ap nmfcsas s2tr(  ot1aeto octytfs2elnvp;u) reomrcootoa r uei (0t2uoxm oo1alt mncsl(fs2rmu  ot0aet  f3iadfmDum( s;t0trxomr3io1lp ran ilt)seuriopoodlp nmnesat)arrax  ;o1aptnmocildfa2emu o u0 rtnxfciadlp elnvol(0t2xm(rpoo4ape mietas)s2uax  nt1ope iociysfs rluvp;() lerio oadfpD ai s s0texoio iodopt  fei s sruru  ;u0aetoiieias a2ulu s;(0tlerif3totfa  luvslt0t2xrirpoydomtemnei sf 2umumpou4tleoioctys s rl(mo;u)arxnxrcty1opDeluvsl( srtmxm3nu4lptemnei sf 2ur(mont0teenmf3tlsla emnmonu0 ltrmf3ty1opD luvo (0trxriopou4ol e icslt)s2um( oou1aptnif3iyt m ea(msnt4aexomo iydoateauvs;s0sexoiopno4lpe liei s)s2urxr ;o0aet  ocilslm2rm(vp u) rtoio3ta1faDe neo s)tetm(opoo4optnmnvs sf Dtmuro;u4oltnmfctydlm2umnvonu4altnxf3oo1omD  nei t  rxoxopou1ll   nvsasf 2rmx pnt0alenmi3tatfa2raump;(4artrxf3tytlpt lieo;s0srxmio oo4ale lfet sfarraxr no1apto oetydlmDel(vsnt)arxnmf3oytlp rlnvo s)tetr(opou1altn ncias s2rm(mo;o0tltnmociytlm2ra(mp t4 rtrio oatlmDrai o s0tetmxo3oy4al elics ()arrmurooo0alxo ocilsla2rmu o;u)arxnifciodfpDrauesls trtrxm nydlpenmnvsl( aDururpou4oee ii3iys m2rmumpn(0tlxnxo oodomD  u i s  eumiopio4altnmictl( sDtaum nu1aptomfctyt a2ea( p t0texrir iotfptean i t srtm(o3io1openmnct t)sDta(m oo0apeoiieilt s2umumpn()treomo3io1faDr i sls) exmir3iy4omt mnvsa() 2rax pot0oltnioeiysfmDrmn o;u)aeenmrcty1fpt  neo;(0t2xm(rpoo1llen ncilsf rumump;u4aeto ietls s el( pn() exrxr tydfat li s t  rxoxo3ou4apee fcs ()aDrm( oou0aex mfeiadls eanvpnt4tltoirctotoateai s s)t2uoxo ny4lpt mfcil( aDum(ro;u1apeoiociydfs um(mp;u)tlxnmr ootomD aieo;(0srurio nudlm e ncs ( artax p;t4olt  icilsfs rl(vo;t0arxnxociytfmtraneolt0trur(r nudop  lics t)artmxrp;u1alxomoctysfa2elnvp t0aexoir iydlaD ln ils) rxmxm3ou1om elici ( a2rrum nt1olxoiocilt a ul( snu)alxnmo to1fmD  i s;s)trtoxr3oydop nlneias) 2urx  nt1oee  octatfs umnmo;() eerxo3todlmDrln ilt) etoir iudlltnlnesas  2rrxro;t0teen o3iydls ran o (4trtnmr oatop r i s ( tetoxm ny1ll  mnetls) 2urx oot0oet ioeilsls2uaums t)trtrxr3iytfp rli i;s0seuoir io4lmen fcsl(f Drr(m ou4olt iieiysfmDuanms;t4aleoxr tadfateauvs s0texoim3nu4lle  neilt aDrm(ro;u4oltn ietytfa ul(vp t4teeoifcoy1fp e n i;s t2um(opno4apt mfvi (fa2truroot4alx  ieildfm2emnmo t0trtrircoo1oateanvo;(0t2trio3ny4aptn ict s)a2uau  ;t0optomociys sDrmumonu4altriocio1fat ln i;t0srtmimpnudal nlivt s  2ua(root0aexomiciydfs2eauvont) exnifcty1faDrli ilt  eurxo3io1am n ict sfs2rrxro;t0tlx mf3iydfsDemu pnt4 ltriocoa1omtrln olt tetoir3iy1ape  neilt)arra( ooo1tlxoio3iasla2rlu s u0artoir3tatopDe n ols)t2xoim nodam nliesl( sDtaxmp;u4altnifeiltlaDeaump (0trxnxrctodfaDe ivsl(0 etrio3nydapte nvtlt sDurxm ou1openioctysfa2ua(vo u)alxrio to1fm  ln o;s)s2umirpio1olt  ict (fs2um(mo;u0aeeo f3tytls2eanvsnu)texnirciadlp eai olt texrxm nu1alt mfes (fa2uaxrono0oeto oeiaslaDrmums;(4 ltrmr3io1laD au i;s)sruoxm3nydllee ietlt artr( poo1tetn i3ild s em(msn(4 etnio tatlpt lnvilt0srtrxm nodlptnlict (fsrta(mp;o4tpxomieiasfs2uauvsn(4 rxrxocoodlmD anvs (0tetrio nydlptnmnci tfs2tru pno1altnio3iasfsDrl(mpn() reoxr3oadlp elu s;s t2toim nu4omenliet s arua(m ;t4opxnmociatfs2ranms (0 lerifcoo1fmDean slt  rtrxm3nodapee ivtlt s2rm(mo;t1tpe io3tldla umn p;(4 eenxf oatoateluvi s0seumio3iy4lle lfvi ()a2tr( oot0opxn ociadla rlnvs u0artrif tytop r neols0 2tr(o3nydomenmieslsfa2umxmp;o1tpxn fciyt m2ulu p u0 exrxf3todomtraneolt s2urim3oodomenlfvtls s2umur ;u4tle ifctyd s ea(mo;t4trxriociytom eaneols sexr(r ou4ap nmivi sfs2umurpnu0apenifctls mDea(msnt0tlxrxocoatlmDe u s;()srum(mpou1ap elivt t)s2ta(rp;u4altoiietyslmDranvp;u)tltnif oadom  livsls0s2uoxrpou4omteliet (  rrau o;u1oleo feiadlaDumnvp u4tleoxf iytlp rlneo (0s2urim oo1lp e ivt tf rtru pou4tet ifeiytfsDemuvpnt0 rxoxo3oatlmt auvo s  2urxo3nu4op n fet s  rtmx pnu4apxoii3iaslsDeln pn(0 rxoircootfpDelu i;t)t2toxo ny4apt  fesa(faDtmurooo4tptnii3iyt a uanvo;(4aexoxocoo1fmteaneol(  2xoxo nydlp elieilt  Duaumpou1altomfetlt a2el( snt4artomf3totomtraies;s  rurxm nu1ll   nvi s aDurur nu1altn feiyt m umu pn() ltrmr oo1lmteauesl()s2toiopny4ap nlnvt sfa2trumont1ale mfciltlmDuan o;u)tlxoxf tydlaD lneils  2umiopny1alt mfeta()sDum( o;t0tpt mf3tlsfaDea(von(0arenmf oadoa rln o;() 2uoxr iudlltelictat  Dta( ono4tle iiciad m rl(mo ()artrxrctatfpt  ivil(0 2xoxm3oydal  livs tfaruaxm ou4ale  fctadlm ean p t4 exrmr3todfa eln i t0srxmxopnu4omenlfei (fsDrrump;t4aexo o3iytls umnvs u) eeomr todomDran ols  etrxm3no1olen fetls)a2tau p;o4oetnifeiyslmDra(vo;u)teeoio3oodfate neolt)setmxo io1lmtnlivsls)aDrrurp;o0tle  i3tad m2um(msnu)alerxfctatop  ai ol(  rtoxm oo4ll e fesls)sruaurono0aetnmieilslsDel( s;u)arxnif iytomDelnvil(0 2umiopou1op e ncil(  rraxmp;t1aexo ieiltlsDuanmsnt)aexrmr iydlmDr uvs t0t2xrxo3oy1lp nlnctat s2ur(m nu1altn ieiltfs2rlnmp;t0trenio oodfpte ueilt)trumimpnodlp elfvs ( s2ta( oot0apxnmfctaslsDumumpnu4trxoio3tytoa   i o;s srxoxrpnudolt  ivs s)aDrmumooo4tlxn ieiatla2em(mp u0texomf3iotfmtelu i;t0texmxm3no1ol elnci s) Drax p;t4tpen o3iysla uln p;t0 rxnmo3iytfmDr uvi s0 rxoim oy4al emncilt) 2umu ont4teenmfctls a2uauvp t) etnmfcoatomD luvslt  exo(r nydam   ietl()s2tm(rpnt4apen fetyd a raump (4tlxrmr tytfmD  n s t0 rtmxr oudamte ieil() Dtm(rp;o4tlxnio3tltla rl(mo u)arxnxo3oodla  lnvsls)t2to(m iy4ap n fvilt)aDtmxroou1olx if3tas mDel( p t) rerio3oatlmD  neo;s0 2xrxopnu1lme livsat  rtaxronu0texoiociysfs ulnmo;u4 exrircta1op  livsl(0 euoir3iydlpe  ieslt) 2raur nt4oex miciys a2rm(mont)tetnmo tydfp  li ols0 rtrimpiu4al nlivtlsf ruaumonu1ale moctyt m2uanmsnt4aetoxfcoa1fatrai s;( s2uoxrpny4llt lfci ( aDumx  no1opt ii3iatls2rmuvs (4trtoxo totlaDr uvol( trtrim3iu1am emnvtl(  2uau pot0olenmoetlt sDelnmon(4tlerxr tytlmt lu o s setrirpio4lle lict tfartauroou1aeto o3tadfmDrl(mp u) rxnmr3iotoptr ies t trtr(r iydalen fcsls)srrrx  no0ole mi3iydfsDuan sn(0 eeoxo3iydomDe uei () 2urxrpiy1ape mivs (fs2uaur ot1apxomf3tysfa raumpnu0aetrxo to1lm rln i t0setoio ou4ame  feils) Drm(  no1tlx  iciad aDrmu pnt)texnmf3totfmt auei;s) rxrxr3nydaltn nei sfa2rax  ;u1opxomociat sDum( p;(0tlxrxo tatom eaies;() etrxr iydomee nctls) rrmu oou0tlxnmicilt s2em(mp;u) rxomo3ty1fm rau s t0seurxopnudlm  mncias aDur(rpot1oltomicilsfsDrluvp;(4aleoxo3tatfa r nvs;( t2uriopnu1omtn nesls  Dtmxmo;o0aptoifeiysfsDelu s u0tlerxr totlpD lnes ()trxrxmpiu1aleemiesa(fs2tmxronu0teeoii3iyd aDuln o;(0 lenmo oatomD aiei t)srto(m iy1lmt lncsasfarurur ;t1alto octytlm rmnvo;(0 lxrmr tadoaD  n ils t2xr(m3ny4op   ivsls s2uru ont0aptnmiciadfs2uanmp (0 lxnmfcoo1fmD li i ( srtoxm iy4llen nvsasfsDur(  ;t1opxomi3iadla2emuvp;()texrmo iytlmD aies s)texoim io4amt  ivtasfa2tm(rpoo4aetn ociatls ua( s (4aexomf3ia1fpDe neo;()s2uo(o io1ll emfvtat)sDtmuro;o0optomfeiydlsDumuvs;t4tlxrmo oadlatraneil( trumimpou4aleelnvias  rrmurooo4tltnmictysfa2em(vo (4trerxfctotfmDran s s)s2toxm3ou1lpt mnvias  rraxmpot1aee mfetyslm2rm(mo;t0 eeoiociy1fat an i t)setrio3no4lltn iesa(fsDurumpot0oexo iciat a rlums;u)artrircoo1opDr n s (0t2xrxopoy4lmte fvsat)s2rm(m ;o4oetnmf3iltfm2um( p t)aetomf oytoaDeauvi;s) rum(rpny4omenlnvs t  2rmumooo0tpxoiicildfs2rmuvs;(0altoircootfa eaieil() 2xm(o3iydaptn ics t aDtmu  ;o0aptnmoeiysfa uauvs t0 etomo3tytlp  lnes s)trurio nydamen nvs s)aDum(mpot1aptnio3iadls2ul(mo;() eermfctytomDe nei s  2to(mpny4ol elnesltfsrumum ;u1opxn oeiad a2em(vo;u4artnmo3iotoa  anei (0truoimpoo4omeelfeia( sDuaur nu1tpt mf3ias a2rmnvp u)alenir3oytomD ai o;(0texr(m ou4lm n ivsls) 2rrxm ;o1aptomfetas s2elnmont)treoif3iy1fpDr ueol( s2ur(m iy4oltemnes t) Dtrx pot1aex  ieiatfa emuvo u4teeoxo tydomte n o s0s2umxopnodllt lncslt srururoot1alt  oetaslm umuvsnu4teerio tatfptraueol() etmxopnydam elfet () 2trxm ot4tpxnmfetyd aDrl(mp t0tltnxoctatlpDrlnes;()t2uoim3no1oltnmieiltfartax pot1tetoioeilsls2ran pnu4aeerxocoydomt liei t0 2trio3nodll nlici ( a2rmumo;t1oltomfciat m2rlump u0arenio3oydlpD  ues (0s2tm(r oudamen ivil() rtr(  ;o1alt  iciltlmDulnvs;t) lxnmo3totop eaivil(0 ruo(o iy1amtnlnetat)s2rm( pnt0olto o3iyd aDuauvp;(4tlenir3oo1fmtr ieil(0 2tmxm3ny1omtelfeils) Drm( ono1olxn ictyt m2ulumont0tltnmo3todlpt  uvi t) rurxopnodlpeemict sf Duru pno4aleomietydfs2ra( on(0 rtoif iy1opDelnvsl()trtoxrpno1omt lneil( srurumo;u1altnmociysfm2uluvonu4altnxociy1lpDe nei s0 rxr(opiy1lpe  fetasfsDumxmo;t0olt  fetasfaDuan p t)tltomf iydla rln olt truoimpiudamt lncsls  rraxr ou4tlt mi3iydfsDua(mp;u0 etrmrcoa1laDeauvo t0srumxo3oydll  lfeiat) Dur(mont1tlxoiieiat sDrlnvo u)alerxo oy1fmtrai i ()seuoxr iy1openmivil(f rtm( p;o0oltomoeiadlsDrmnmon(0 lxoxf3iatfptr uvs s0t2uoxo no4oleelnvtlt) rraurpnu0altn f3ildlaDemu p t0 exomrcia1opDeaieo s trxo(m3no1ap  mictls aDtrumont0aetomi3tyt a2raums (4altomociy1optelu o;(0 2ur(mpio4lp   iciat)a2raumoou1oeeomfetlslsDranmo t0teermr3oodfpDr uvs;t)setrxm3oy1op e nci sf rur(m no0aeenifeiyd s2uanmo;u0artrxociotfm   uvo;( s2xmxr ou4llt mfct ( srur(root0tlxnmictydfsDemu p;(4 lxnif io1latrauvilt  rur(r3ou1lpe liei s srrrxm oo0tet mfetldlm2eln pnt)aeenmf totlpteli o s0s2umim oo1lp   neiatfsDumxroou4opxoifciadls eau o (4 rtrmr to1lmtelueol( srtrimpou4ope mfci t srtmurpot1oeen ietatlsDraumpn()tltomoctatfpD  neo;() ruo(o io4lpenliciat sDtmxrp;u4tee iiciysfm ul(von(0arxnmo oydoaD  uvil()srurxmpio4lptn fcsa(f rurx p;t0alxnifcilsla2eln o;t0tlxoxf ootfa r n ol(  2tm(rpny1lm e ivils sDtaxm nt4ale mi3iyd mDeluvo t0tlxnmr ty1omt lneil(  2tr(mpoo4omeelnct s  2um(r no1ole  fciydla2rmn p;(0arenif3oy1lpt  nvslt srtr(mpoo4lm  lfetltf rumxrpnt0tee mf3ilt m2ranmo (0texoxo to1faDe nvs;s texr(m3oo1al e fvslt)sDtrur nt4oetn ieiydfs ean o u0artnifciytla  auvo;s0seurim nudlmtnmncsas  ruaxmooo0tetoifeilt mDel(vsnu0tlxnmo oa1oaD  iei t seumirpnu4omtnlieia() 2raumono4alxnmociysls el( p (4 leoxrctatlaDr ues () eurxo oy1omtnlici tf Drr(moot1aexomfeiat sDrln s t0tlxnxo iytop   n s t)s2tmxrpno4ap  lfvilt)artmu o;u0opt  o3tys a ra(mo;u4 exnxrcootfmD an ol( setrxm3no1ole  ivsa( aDrm(mpnu4oexo feildls elu o t0aexrio3to1omDran i ( teto(m3ou4ll   fvtat s2tr(m nu1olxnifctat a umuvpn(4alxrif3ootfmt  ueslt0trxmxo3ou1alenmiei (  Durx pnu4oexniietytfm2raumsnt0tlxoifcoa1fa r u s s)srxrio nydolt lnciasfsDrr(rooo1tetnmoctlslm uauvpnu)aetnxf3ta1oatrai s t0sexrxr oo1ll elivs s) Dtrxrpou1oltnmoeiad aDrmu s t4tetnmrctytoateluvs;s  2xrirpoy1omeemfei t)arum(mpou1alxo fetldfa2umnvp;u4tlxrir3oo1fpteln i;t)trumxm iudlptemicils sDua(mooo0olx moeiyt aDua(mo;u4 lxrmo3tadfat aues t) exrxmpnu1llee nvi ()srta(rpoo1ale mfctyd mDuan o (4artnir3ty1oaD aies;s0sexrxo3nu1ol  lncsltf rua(rp;u0tptnmo3ilt s ua(ms;u)tetrmfctotfmDrauvi (  exo(m3nudopee ivsas aDraumpnu4aee  ieiltlm2ea(mo u4 exrxr3io1opteanes;t texo(o3iy1ll nlfet sf 2tmxmp;t4tpeo ocias m umnvonu) etoircoodfa r uvi;s t2tmimpiodlpenlfcsls  Dumurp;u0aexnmoctltla rm( p t4trerxocoo1lpDeau o;( s2tmxo ny1lpt lnvs () rum(m nu0tpt ii3iytfa2el( o t4arxomo3iotfptrlivo s)teto(rpnydoltn fcs ()srumu  ;t4optn o3iatfa2umn s ()tlenmrctotlatr nvi (0t2xoxrpiu4op   feslt) rtau poo4tpt  ictltfs um( ont4trtrxf3oadoateauvslt)t2tm(m ou1ale  ics t)srtaxmpou0alto fetys s uau p;t0alerxo tadlp eauvs;s) ruoxm3nydolt mfvilt a2rm( ono1olx if3iltla2rmuvp () exrxr tytlpteauvo;t texmim oo4am emfvia()arrmum oo0oexn ociad m2el(mo;u4 exnmf to1opD lnvs;(0 rtrio3ou1om nmicilsf rtrxrp;t0tle iietytfa elnvo t4 leoircootfaD lnes;s) euoio ou4lpe mnvsat srtaurpou4texoioctysfaDrmumpn(0 etnxrciatfpDrlnvi;t)s2uoim3no1amtn ivil( sDum(rooo1aeeo f3iyd aDemnmsn(0 reoio3tatlpt lnvs;(0t2uoim ny4oleelnei t)aDumu oot4oltoiieiyslaDuln sn(0altnmoctotopDeln s;( t2trxrpiu4om n iet ()a2ur( poo0opxo i3tlslm2umu o;(4 etnxocoadop   n o t  exrxr no4amt lnvs s) rtruro;o1tpt io3iydlsDeanmp t4aleoxr oodfp  lnes s trtoxr3nu4olte nei ( arumu pnt1alenmf3ils s umumpnu)tlxoio3io1oatelneols0t2urio3nydop n icslt) Drm(  ;t0aetomf3ilsfs emuvpn(0 ltrmo todfatelu i ( srurxo3iy1aptn nvilt)arur(ro;o1alxomo3iasls2eluvon(0trenxr3todom eauei;( t2xo(r nodalt  fetas  2raxm nt4aet mfeildfaDeaumo u4 eermrciodfmD ai sls t2umirpiydaltnmfcslt aDtr(  ot4altoiieilslaDemn pnt0tltoxr ia1oaDraneilt) 2tmxo3no4lpenmicia(  rumu pnt1olxo octldfmDuln o;(0areoxr3ia1fm rau ol(0t2xoxmpiydlme mnesa(f 2tm( pnt0teenmfctatfm rmums;(0tlxnio3ia1oa eanes s0srumxrpno1lm nmieias) 2umxrpou0tptnio3tatlaDulnvo u) ltomo tydoaDrai slt  2toir iy1apt licsas sDum( pnu1oleomfciytfsDrl(vonu0 lxoxr3ta1omtrai s;t)seum(m oydapee iciat)srrm( pou4tpeomo3tld m uau s (0 rxnio oo1fmD  n ils srtoxopiodameemfvsa() rtaxrp;t4tpt  o3iysfm2el(mp t0trxrifcta1oaD auvs;()t2xr(o oudam e fci ( a2tax o;u0olxomieils sDrlu o u4 eeoxf iotfpte uvs t0t2xoimpiy4olenlfesl()sDtaxr nu1altniieilslaDrl( snu)trermf3oodfptrauvo ( seur(m3iydop e fcs s aDra(rpoo1apto octldls2el(vo;t0aexnmfcta1lmte i olt  rtrim3nu4alte nvt tfsDuaurono1aptniietysfm2um(ms;t)texoif3oy1fa e uei;( seumio iu4amtnmnvtls aDtmumono4tpxn oeiad m ul(vs;u)aetrio oytfp elneo t0teurxo oydapt  fcsa() rraxr nu0openmo3iadlmDran p;u)trenif tatfpDrai o;t)sexmxopoy4ap n ieiasfsrrmxm nt1ope  octasfmDemnmp;()alerir ia1fpD lieil(  2tmir iydll elfetlt aDuaurono0aptniicils a rl( p;u4 etoiocto1omte ivs (0teto(o oy4apeemfcia()sDrmxmonu0oexo o3tatlm ea(vs;u)tleoxfciy1lmDrau i;t s2tmio3nu1lm elici (  2rrx  ou4alxnmietlt m ua( s t4teeomf3io1omDrliei;(0 exo(r3ou4op emivia(faDur(rp;t0teenio3tldls emnvs;u0texrxo ootopDr u sl(0t2uo(o oy4opee ivtls)aDrrur ot0opeo fctlsls2eauvs;t0tlenifctotop  aivils)teum(o ny4al   iesl()aDrm(r oo4tetniictldlm rln o ()tetoxr3iydfptr ues;()sexoim iudlpe mnctasfaDuaxmpno0alxn iciatfm2uau o;() eeoio3ia1fate ivs;t)s2toimpiy4ole lfcsls) 2ra(mp;t1alxnioeiasfm2emumo (4altrioctydla  an o;() eurimpnodllen iet ( s2rmx p;t0oeto f3iytfmDemnvo;t0tlerxf iadfp r ueol(  2xm(m3no4lm   fesatfaDrmur ou1tptn fciytfa2ea( sn(0artrxfcto1la rlu s;t0 ruoim3nu1omt  fvtlsf Drmum ot4oexn ieilslm rmnmp t) etomf3tatfateai i (0 eumxr oy1lmteliesls a2rmx  nt4aeen o3iyt mDel(vs u0 exnirciydlptrauvs (0t2umxm3iodaltelnvt s a2uaxr oo0olenmiciyslaDrl(vsnu0 ltnxf3oatfmte nvo t)teuriopny1oltemietat  Drmu poo1teen feiysls emums u) rermrcootlate iei;t0trxmxr3oodamenlfcsas) 2rr(roou1opxomiciydfsDumnmo t)tltoxo3oodlmtelueols)tetmxopiu4opt mivsat) 2rmuroot0tpt  ociys mDumu pnt0 etrxocoadopt luvolt0s2xm(o3ou1omte fetatf rraxrooo1oltoiocildlsDeln on(0 etnirctydfmD anvolt t2tmirpou4lp nmfeiat  2umu oou0tpe  fetytfm ul(mpn(0teeoirciotopDelnvo t  eumim nu1opt  ieil()aDrmuront4olxo feiat s2ulumpnt)trxnirciytfm r ivsls)trxrxo io1lpe  ncils artaumonu1optnmocilt s2rm(vs;u)aeeomf3oadlat anes s0 rtrxr oo1olte net t) rur(mo;u0opeo i3ils m uluvon(4 ltrxf3iatlptraueo ( sexo(rpnu1om nmfesltf Dur(mo;o4tle mocildlm2el(vo;t) exoifctadomDrluesl(0 rxoxopoo4ol n nct t srtmump;t1tet miciydfm2ea(vo u0 rtrif3ta1fp e i s;( trurio oo4opeelieta(faDrmxmont0opx  octydlm2ua( snt4aexrmr iadfatr i i;(0s2urxm3nu1lp e ivia() rua( p;o0olenmi3tyd sDrlnvpnt4aeerxr oo1fmD au il(0 exoiopoy1ll e nvsa(f 2rru  ;t4alxo octlt m2rm( s t4arenio3totfaDr nei;s  2uo(o3ny1lltn ivslt) 2trxm ot0tex ifcildlaDumumpnu)altnmo todop e i s (0t2umxr3oydapt mnei tfarurx  nt1oeeoio3tat a rlu p;u)tlerif3iytoa eluvo t)srxo(r3nu1om emncias) 2uaxr oo4ape  iciltfa2um(ms ()treomo ootfatrlieols t2xo(m3ny1aptemictlsf rtmurpot4oeto oeiltlm2emnmpnu0trxnxfciydlp raueo t0 2xo(r3iodll n nvta()srumx ont1olxomociltfsDrm( s;t4altoirciotla eluvs s0texmir nu4al n ncs tfsrraurpot4alxomo3iysfm ul(mp;u0teeomr iy1op e i s ()trur(mpnu4ome  ncs s) rua(mpnt4apx mi3iydfm2elumonu4tleomrcoydla  auei;s0s2uoxr ou1ap  mncs tfs2ur(rono1tlto i3tldfaDem( pn(4teermoctotlm   nvslt  2tmxrpiy4omee ncil(farurxmp;u4olt mo3iytlaDumu s () rermf3todomtelnvolt t2umir io4ol elfei () 2taurpot0alxoiieiysls ea(mp u)trtrifcio1lpDelivo;t srxmimpnu1al n icias)s2ra( oot4texn fctyslaDemuvsnt4aetrxrcto1fpDrluvo;()setmir ny1lm elnetl()s2tm( o;u0tlx  o3iytla raumonu0aetrxo iytlmD luesls s2ur(rpiu1amee nctasfaDrax poo1tpxnmietyd m2umnvon()tltrxo oytfatrln s;()texmxo oydap  mivtls) Dumu oot1apenifeiltfsDrl(mon()aexnio oy1lmDr ues;(0sexoirpoy4lpeelfetasfs2trx p;t4apto octasla2uaums;u0 lxoxr3iotla  auvo;t0sruoirpoudllt lnvsa(fa2rmumoot1tlxomoctldlm ean s (0arxrmrciy1lat luvs;(  etmim no4ll e ictls)srumumpnu4oexo i3tytfs2rm( p;(0tltrxo3iydlmt  u s s0sexo(o3nodlmenmnei t a2ur( ont0aet  ieilt a rlu snt4trxnxo tatlm   iei s  2toimpiu1opt  ncils)a2tm(monu4ale mf3iytfaDelnmsnt)aexoxo to1lpteli s;(0truoio oo1llt lfeia(fs2rm( ont4tpe moctydls el(mon(4 ltoxr iy1opD anvo s t2urirpou4openmnes (faDtrx oou1olt io3tldla ea(ms (0 rxrmfcoo1fmDean s ( sruo(m3iy4olte fetl( arrrumo;t0tpx mieiad a2uanmo t) etnxocoydfm e nvsl(0trxrxr ny1am nlnctat)sDuaxmpnu4olxo oetldfsDraump t4 rxomoctatoa r u i;s  eumxr3oo1apeemfei t  2rru ooo1oltomoeilsfa em(msnu0tleoxo3iadoa rlu s;t0s2tmxmpio4ll eliesat) 2ua(  ot4oeen oeiadls emn o u) lenxocoytfateauei s0teur(o no4olenmietas  2uru pno1tetnmfeiydlm2rl( o u4 renxf iytlaD  ivsls  exoim3iu1lme  fvslsfa2uaxmpnu0aex mfetls s eaums u)teeoio oadoa   iesl( srxrir iy1ll nlfcilt a2tmu o;t1oet mfciadlaDulump u4tltomfctydlatr ies t)s2xm(m3oo1ap nmnesltfsDraur ;o4olxoifctydls ulu p t4 rtoircto1fp eauvol()trurio nodaptelivtls  2trx ont1oeeniieils s uln p (0aexrio3tydlat li s;(0trxo(r nu1ope lnvta() Dururoot0teto oeiat m ul(vonu4aexomf3io1fpD auvo t0 eumir oy1ole  netl() Dtaxr nt0tptoio3iltlm2rmumont)aexrxocty1om  au slt0teum(opiydom   nes (faDuau ooo0ape micild s2eauvo (4 rtoir3tydomtr ues t0s2um(r3iodlmtemivtat sDtrx pno0aptnmfcilsfa em(vonu0aleoir iotfpteanvslt srurxopiu4aleelnes sfarrrurpnu4tlx ioetytfs2emumpnu0altnmf3oo1opD  i s (0 rtmxmpno4omenmnctlt a2ur(rpot1aeen ieiatfm2rluvo;u0treoxr todopDeau s;s)t2toim oo1al   fcsl() 2rrum nt0apxn i3ildfa rlump ()trxriociydla r nei s seum(m3oudlltnmnesl(  rtauro;u1opx ifciyt sDrl(vp;()artomrctatlp  li s s0 rur(mpny4ol nlnetat  rumurpnt1texn icias sDraumsnu) lxnir3tatoaDr neols0 rum(r nydomenlnvt s aDur(mo;u4opeomfeiyslaDeanmsnu0arxrmf iydlmDeluvi s0trxm(m oudalt livi tfs2umx p;t1ape mo3ilsla2elu onu0tetnirctadlaDe uvi;t)truo(r3oy4am nmnvtas a2tmx pnu1tpxoioetydfa ran p;()aexoif3oy1fpD anvo;(  euoxm iy1omtemfei ()srtr( p;o0tet  fctaslm2eauvsnt4trtrxo3tadop ean o s0 exo(o nydlmenmnes ( artr(root0aptnmf3ias s ulumsn() ltrxrcty1lm r ivil(0trxmxrpoydlltnlfeias srta(ronu4olx io3iltlaDeauvp;u0 lxnmo todop elu o;s seto(rpoy1op  mncia( srum(  ;o1oetomieilt m2rl(vonu4trxoirciatlaD  nvs;(0 etmxm ou4alenlivtls) rumu pnt4tptniociasfm emu o;t) lxnxr iatfpte iei s)trur(m3iy4omen nesatf ruaum ;u4alenmoetldfa ea(vo t0aexrir iodfa elivi t s2ur(o iu4lltn icias) 2rmxmp;o4tltoii3tadlsDemumsnu) rtrmfciotlp rau s t trurxr iy4ap   nvs sf Dua(  ou0oleomfeildfs2emumsnu) ltnio3oydlmteli i;t  rxrxr3ou1ape lnvsa(fsrtmurpno1tle  octas m2emump;t0aetomr to1fp rlu s;s) rurim3io4am  mnvt s  2ta(mont4tpt  ictad m2rm( s;u4aetnir3ty1opD anvi;s srxo(o oy1al   iei ( a2trumo;o1opxnmoctytlm ulumon()altnxo3iodlat ai s s) rxoxo3iy4ol  mfctltfsDtaxm ;u1aexnif3tyslm eau snu0aeerif3iodopDrlivi t trum(o iu4al emivsa(f Dtmurp;u4alxoio3ils sDel(ms ()aexoio oydfa elnvilt0 exr(r3iudaptnmncs s sDrmx  ;o4oex mfctydfm2ra(vont4aexnio iy1fmD au ilt  ruoim3nodlm nlieiat  rur(m ;t0alt moctysla2uau p;u0altnif iadla rai i;t) rumxo3oudlm   fvsls)srrrxm nt0tlx ifeildlaDea(vs u0aeenmr3io1oa r uvsls)setmio3iu4lmt  fes tfs2tmumo;o0aexnii3iadfa el( o t4teerxoctodomt  i i ( t2toim3nu4omt mictlt srurx pou1tpx ii3iltfa2ua(vpnu4tetnircoatfaD aieolt  exoxo io1lp emfvsl(fsDtm(r ;u1ope  oeiysls ul( o;u) etoio3iotlm  aues;(  ruo(m3oo1aleelfci s a2um(r nt4opto i3iydlm2umu o ()tetnxr3io1laD  uvols  etrim ny1llenmneia()arrax o;u0opt mfetydls eanvsnt0artoxfctatlmDr i olt0sruo(o nu4ol  mfcta() rra(ro;t4tpt moeils s elumo;t0 eenir3oodlpDr i o;t0s2uoxopoo1ape mivtlt)arua(rpnt1open i3iltfm2ra( sn(4texnmf3tydlmD  nvols)srtr(m3no4amtnlnctl()sDuax pot1aet moeiysfm2em( on(4trtoif oo1lmtr i ils0 rtrir3iodameelfetls a2rmu  oo0apxnmi3tat sDuluvp;t4artnir3totoat  i sl(0trxrxo3iy1ole  fcsl(  Dtr(mpno0oetoioeiadlsDeanms;u)trtomo3tatlp ean ols trtm(m nudamtelies (fsDua(mont0olxomfeiatlaDua(mon(4trerxo tydlatraiei s0 2xr(r3io4amte fctlt sDtmumonu0opx ifetadlsDulnmp t4trxnmf totlaDe nes (0 etoxm3ou4omtelfvtasfa2um(mpno4oexoiietat aDumnvs;()texrif3oadlaDeluvs;(  2tmxopno4ll  lici (fsDrmxr oo0ole iocils a rlnmp;t)trxoxf ty1fmt lnvsls t2xmimpnu1oleelietas  Dua(rpot1tpxnii3tadla2um(vont4 etoircoytop  li i;t tetrir io1aptnlieiltfa2rax o;u1oex  fciysls2uanvo;u4teenxr tatlp rlu olt  rxrxo3iudameemfcs ( arrr( pno0oeeomieiyt sDrlnvs t)alxomr3tadfmte i s s srxmxo oo1ll e fet t) rrax  ;u1texn f3iysfs rmn p;t4 eeomo3tydlmtrlueo t truoxopoo1olenlici tf rtau  nt4altn fcildfm rmump t)tlxnmr iotlate ues s)s2umimpoy1lmtelietat  Duaxrpou4olt mi3tltlm2rl(mo u)aeenmf3oytop  livol() 2xm(rpio4om nmfeta() rrmurpno0olenmictasfsDum(mon()tltnxo todlpte n i ()sruo(mpiudalte netasf 2urur ou4teeoii3iatfs2rm( o;() lxrmo iytfp elnei s srxoxrpiy1omte fetl() 2ua(  ;u4open fcils m umu o t) rtrif3tatoa  lu s;(0 etoxm ou1lpenmnet s) 2rmumpou1apx  o3iyd mDumu o ()tltnirctodfatrln slt)s2trxmpiu1lltelnet ( s2taumpou4oltnifctytfm ra( p;(4 rtnxf3oadlmteanvi;( t2xr(opnodllenmictasf Dtrumpnu0tpx  iciad mDua(mo;t)artomr to1optrlieo;t0seuoio3ou4omt  nct () rua( oot1olt mictydla2ranmp (0 lenxf3oa1omtelivo;s)s2to(o3io4aptnlnetas  2uru o;o0optomietldfm rm(mo;t0alxnmrciytfaDrlnvs s) 2trxo iudale  ivil() Drm(mpnu0olxnifeias a2umuvsn(4alxoiociadlmteaiei;()srtm(o nu4apeelivsl( s2rr( oou1oeen fcildfsDeau o;t0trxoif oy1oate nvi;t  euoirpny1ome  fcs tfsDtmumoot4aee mf3iyd s uluvon() rerirctotlaDr ieo s)t2umiopnu1lle mivt (f 2taxrpot0tleomf3ilsfa2ea(ms ()tlermf to1optr ivolt) rum(o3nydamt mfvtlt srrmx pot1opto ieils m2ulnms t4alermrciotfa eaneils srur(mpoo1lltnmicil( aDtmu  no1oeeoif3tat mDea( o;t)arerxf3oydlp eli sl(  etoiopiy4apeelict () Dumx o;u4tpe mfetasfs rmu p (0 rtnir iadfa rluvi (0truo(rpnu4al   nesl(farrmxmont0ole ioetlt m2ea(vsnt4trxoxfcty1late ueolt) 2xmxo no4lmtnlivi t)a2tmxrpnu4optomoeildlm uanms;()aeeoxfcoy1fa r nvs;(0teuoio3ny4aptnmfvtl( artrxmo;t4alxnmo3ilsfm rmnmp;t) etrmr3iatomD aiei t  rxrxrpio4alee nesa() Dta(m nt0tee  ietysfs uauvpnu) ltomr oodfpD an o (0sexmio3nu4op elicslt  ruaxro;t4olenifeiadfaDel(vs t) rxnxo3oa1oa  aneols0 etoxo nodaltelnvtls sruax  ;o0alto fetyd a umnms (4 rtrmo tytlm  aueolt)tetr(opnu4altelnvs (fsDta(  nt0tpx ioctlsls2rm( s;t4tetnxf ia1lm ran ols)s2umxrpoy1optemfvs (fartmx  nu4alenif3iys mDrl( o;t0aexnir3iodlmDr uvsls)t2umio oydopeemieilt  2umx  ;o1teenmfetysfaDrlumsnt)arxrio io1oa   uesl()teurxm io1lm emietlt)srrmuront4texnioeilt mDuauvsnt)trtomo3tytfp raivilt seto(rpoo1lpeemnvt t  rumu  ;t1tpx ifctat m2rm( onu) ltoxr3iytfpDeaneo t) 2toxo iu4ame mfvsa(fsDta(r nu4tetn fciadfs ua(mp;u4 rxoiocoa1lm eli s s seum(o3nu1ap nlnes sfarrrumpou1oeto ieiasla eaumo;u0aetnmr oa1late i s t)texmir iydlptn icilt aDur(r nu1olxo ocild s2eanvsnt4 ltnmoctadlm rlu ils t2xr(o3iu1alen ivt s)sDtaurpnu4tetoif3ils a2emu snt4 etrmr oodoptraneo ()srxmxmpiodlme lnviatfarurumoou0tet mi3tatlm ua(ms u0 lxomf3oytlatelies;s)setoim3oudlm nmnct t)srta(r nu4oleomicildlaDrlnvsnt0 exrmf tatfm  livs s0srxoir iu4ope lneil()aDrr(m ou0oetomi3iydfs2um(mon()teermo oo1op rlieols  2xrir3oydal  lncil( aDra( pou4tlt  i3ildlmDemuvsn(4arenxf3totfm r ivi;s)trto(opiy1lm n ivsas)a2um( pno0altomiciad aDumuvp;t0tlenmo3oo1fa eluvo;(0tetmxo ou4ope  fvsa(fa2trx oou4ale  feiysls uaumpnt4aexnxr oydomtr nei;(0 etrxrpoydlptnmnci () Drmx  nt4olx io3iyt m2ul(mo;(4tetoir3totoptean o (0 2uoxmpnudlme  ictas)aDrmxmo;t4tleomfctadfsDelumont) lerxo iytla eaneolt)t2tm(mpny1lpt miesa()arrmu  ;o0texnifctadfa2rm(mp;t) rtnxo ia1fmtr ivi;t0t2um(rpiydopt lnci s)srua(  nt4oltoio3tatfm2emn s u)teermf3ta1omteanvs ( srumiopnydlm elnvsls sruaurpno0alxo oeiatls ua(von(0trtomf tydop  lnvi;(0t2xrxm3oodop nmivt sf 2umur ;o1apx  f3tatfs2ul( s;(0 etrmf3ootfpDe nvs t t2urxo io4lp  mneiat a2taxmpou1ape  o3tytlmDulump;(4trxoirciydlm eau s;(0s2xrxo3io4omtnlfvsatf 2rruro;t4texo fetlt m emuvsnu0tetomo3tadoa rlueo ()sexrim3ny1lp   icsas s2trxrpnt1olx mo3tltls rlnmpnu4texrmf oadfatr ivo s setrir iy4al n fvsls aDrmx oou0tpt  oetys s2umnvo t0 lxoxocoydfpD  u o;s seuo(r3nydalenlnvsatf 2ur(mo;t0aleoiociydlsDeln o (0 lxrir3oy1opteaivi () etr(opiy4ome  feiltfarum(rpou1tptnmiciasfm2elnvp;t0 eeomrcoy1lmDrlu i t0trumxr iy4alen ietltf ruaxm ;u4aeeomf3tltfmDea( s;(0 leoif3iy1fmte u olt0setmiopiu1lmte fvt (f Dtrxm oo4opeomf3iytfm2ulnms u4artnmf oadopte n sl()t2to(rpiydlpeelnci t s2tmx poo0tlen fciyd sDranvs u)tlenxr oatom r uvo (0setrxr iu4lpe  fesa(  rtaurooo4tpeo ieilt m rl( on(4 lxoir3ootfate uvs s t2xmim3oo4aleelnciltfarur(mpno0olxo f3iasfa2el(mon(0arxoif oatla e nei;() rtm(r3nu1om n ics () Duau ooo0alto i3tadla2um(ms;u4 ltrmo3ty1fm e nvs;() euo(o iu4aleelfesasfarraxmp;u4oetoifeiydlm2rmnmp;t0altnirctydoaDr ivi;(0 ruoxrpoodoltelnvs (fsruaur no1tpeomietlsfs el( s;u4 lxomfcoadfaDe uesls) 2um(m3no1op elfcsl( aDrmx  ot4opeo ieiyslmDran p;(0tlxrifctydoat  n ol( trtm(m iodaptnlnesas a2ur( oot4ape ifetydfa2rmumpn(0trerirctytopDeaies;s0s2ur(opoy1ap n iesatfaDrm(rp;o4tleo ociatlm uan o;() eenmfciy1oa raueo;t  rtmir3oo4llee fct (fa2umxm nu4aet iicild a rluvp u0 eeomo tadfmt  n s t)t2xr(o3iu4olt mfesat)sDum(ronu4aeeoii3tys sDrm(vonu4altomr todlm ran i;s)setoio3iu4amee fctas)a2rmxroot4aeen i3ils m ranmo;u) exnmr3ty1fmtraneo;( srurxm3oydam emivtl(faDuaxm nt1oex mictat s2rlu p;() rxnxr ty1omD au ol( texm(r3oodolte nvtls)aruax o;u1tpenifetltfm2rln p;t)texnir oytfm rlueo;( teuoxmpnu1am n iciasfa2raxr ;o1olx mfetltfaDrlump;t0artnif tatoaD auvils)texoxm oo1ome lfcsa()sDtaxmp;t4aptoioeilsls2el( p;(0 ltomocoy1oaDe uvols  rxm(opoodllt  ivi (  Dumur ot0aleo oetas m uan o;u4trenxo3oytfpt  ies ( srurxm3oy4amt mies (  rraxmo;u0opxoifctytlaDuanmo (0altrmf3iytfat aieo;t)t2trim ny1olt mnesat a2uax  no0optn fctltlmDeauvo;t)trxoxo3oo1omD liei;s  etrxo no1ale  nct ()s2tmxrooo4teeniocild a2uluvp t)artoxfcoydfaDelnvo;() exoir3oy4optnlivs s)sDta(rpnu4tle  fciltfa ulnvs;t) etnif oydoa r n i s texoio ny1llenmict tfsDtr(rpnu4tlxniociydla2ua( p;u4 rtrmfcta1lpt auvol(0setoxmpoodlleelivs t aDtru  no4alenifeiyd m rmnmp;(0 reoxf3todlmD lnvils0teumxrpnu4olenmfeiatf rra(mpou0oleoioctyt s2emums;u4tlxoio3oadfm r ivils0 exrio oy1llenlivs t artmurp;o0teeoiieils mDum( snt4aeenmfcoadoptr i s;s)s2uo(rpoo1lmtemnvsas arurx ooo1aexo fctls mDrlnvpnt)teenmrciy1op eauvi;t0 2xmxm3nodap nmnci s) rrmx  ou4tpt ii3iyd s2eluvo;u4 reomrcty1omtr ivi;t0sruoimpiu4omtnlietat) 2rrxm no0oleoiieiadlsDum(mon(0 lermocoodfmDr u s t) rtriopiy1am nlnvt (fsDra(  ;t0ale  fctytla elu p (4alerir3totfmtrau i s teumir3oo4ll  mnvtl(f 2taxmo;t0oee ifcilt s2emnmon(4 exrxociadfpD  uvi;s) 2xmiopnu1apte ivslt)aDua(roou4olen fciltls eanmsnu)arenir3io1fm rau ol(0srto(o3oudapt  ivi t)aDtrxro;t1apeo o3tlsls2emn snu4aexomr3iodfmD lneo;s)t2xoxopoy1ole mncil()a2uaumoot4olx ioctltls2umnvo ()aeermocio1oate uvsls)s2trxrpoy1ame mieias)aDrau  ;o4aex  i3iysfm2rlnmsnt)texnxo3ta1fa   ivs t  eur(m no1altelfvt s)srtaur ou1aee mfeiad m2rau o;t0aleoxfctydfptran olt  rxo(rpou4al nlfvil( srtmxro;t0aexn iciatlmDul( sn()arxoio3totlm   n s t teuoxo oo4ameelicsltf ruaum ot4olx mfeiydlmDrl(vo;u)artoif iotla e uvi t tetrxopny1optemnvtlt s2ur(roou1tpe moetat a rmu s t0areoxf3iotla elnesls t2tm(r iu4lleemictl(fsDumxr oo1alxnifeiysfm2uanvp;u0 rtnxr3iotopDeli o;(  2xr(o ny4omt licsa()sDrm(rpnt1opxoio3tat s uluvo u0artoxoctatfpDrli o s0srtmxmpnu1om e ies t  2umurooo1oet  i3ilsfs2el(vsnu0trtomo oadoateluei;( trxrio io4ll  mici ()aDur( o;u1oexoif3ild aDuaump t0aetnmf3ia1fpt aieo;s seuoxm3nodlpenmneias) 2urx o;u0apeomoeiadlmDran p t4arxnmf3iytlmtrli i ()teumxrpoo4aleelfvt sf Duaxrpno4olxomieiydlmDeanvp;(0 lxomrcoytopt  neil()trtr(m3iydomeelnes sfsrtmxro;t0aeto fciydfm2uaumsnu0 eeoifctotlm  an sl()trtmxopno4olen neia()srua( ont4opeo ictat m ua(vo (0 lermfctotopteaivsl( s2tmxopio1amtelfvs tfaDtm(r ;u4aetoiieiytfs elu o;t0alxnmf ootfa rai ilt truoir ou1amen feils)srua( o;o1oex iieildlm2elumo u)aexoxocoytfptelieo;(0truriopnu4apt  fct (fs2uaxrpnt0olxo fciysls rln s u) lxnir iadlateaivo;s0srtrxr3oudlp e fvilt s2taum no1tpxomiciyt s2rln p t)tlerir tatlat lueols srumxrpiodoltemieil(  Drr(r no1oexo ietld m eau pnt0tlerir3ta1latr ueo;s)texoxmpiudlmenlnetat)s2rm(ro;u0tle mieiadlaDuanmp u4tlxrifciatla  an olt) exr(rpno1alt mnes sfaDraxm ot4tlt mf3iysfmDea(mp;u0 etomrcty1fpt  uei s)seur(r3nydalenmncsasfa2taxro;t1openmf3iyd mDrmn snu0 lxrio iotopDeau ilt0setoxm io4lp emivtas)sDrmu  nt0olto i3ias a2ra( o t0tetriocootlaDrai slt) exr(opny4apt lfciatfsDurxrp;o4apto ociadfs uln s t4 eenir ta1lpD lu ilt0setriopnu4lme mieias)aDtaxmpno1oexnmicilt a ea(ms;(4 ltoxo3iytoa e ivo;t s2xmimpiu1oleelnesatf rta(mooo0apt  f3iltlmDemnmsn() leoxfciotop   nvol( srxrimpoo4lmt lfvsa() 2tm(m ;u1opeomictas m uaumonu) exrif3tydlm  ln s t trtm(mpiy4al emics s s2um( oou1apeoifctldfm2elnvsn()aexrmo oydlm raies;t0trum(rpio1llee nvt ( s2ra(mo;o4open oeiasfa rmn s;u0alerxr tydfmtr nei;(0 eurio3iodam nlfvi t aDtrur no1aexnii3taslmDrmn s;t4tetomf3oytoaD lnvi;()trtoio3oudam emncias)arraum ;o0oexnifeilslsDuanvo u0tetoxf iadfm   uesls)s2uoiopiu4llenmietasf Dumu  ;u0olxomoeils m uanvsn(4 reoio oa1oaDrlivi t0 rxmir iy4am emicil() 2umumpnu4texnmieils m uluvon(4 lxomocoadoat lnei t0 2to(r3ou4apt mfetl(fsrrru pnt1openmieiydfmDrlnmpnt4 rxoxr3iytfm eli s s0s2xmxopoo4ap   fct () 2ta(rooo1oetn iciysls elumo;(4tltoxf3tytlpD auvilt0t2xrxopou1apenlnvta( s2umx  no1tptn feiatlm2uluvs;t0 lxoir3todfaD luei;s)t2uoxo oodol elnvtlt)arta(rp;u4tee  i3ils a2uanvp;t) exriocta1lmt  n i s0trtrxmpiu1oltnlfvilsfs2urump;o1tpxnmoetydlmDel(vp t)tltniociadlpD  uei () rxo(o io4al emnvsatfsDtmu pou0opt mfeiadfaDrl( p;()aeenif ta1latr nvo;(0 2uoxmpoo4ole lnvtltfsrumx p;o0olxomo3ils a ra( o () rxrxr3oatoate nvi;s  2um(rpiy1am nlfcs (fa2umumo;t4aeen i3tyslsDum(vsnu)aeeoxocio1fptrlu s;s)tetrxo nu4omen nvils)artr(rpot0oltoio3ilsfm2ua(vs (0trxrmf3oydlm e iei s s2xoirpiy4ol nlfetat)a2tm(mpoo0oexo i3tldfm elums;u0texoif tytfmD  uvi (0s2trxrpoo1alenlfeia()sDtmxrpnu1teeoifctadlm eanvo;u4artrxoctodoat aivilt seum(o iudope licil(farumxr ;t4alxnifetyt a2ua(vonu4aeenmr iydoaDeauei s)truo(o3ou1ameemietasf Drm(  ;u1opx mieiadlm em(ms u4alxrmo ta1fa eluesls0 exoxopou1amtnlicta(f rtmu ooo0tex  f3tlsfs2ulu snt4artnmr ty1fatrai s t)t2xmxo ou1al  lfviasf rtruro;o4tlxniiciltfs2ra(vs t0tlenmocoo1fpDrlueolt  rxmim io1lptnlnct t)srra(mo;u4tlto ieiysfa2el(vs;(0tleomf3tydlmtrlu ils)srtm(m3iudam e fctl(  2tm(  ;t1aptomoctytfsDumuvo () rxrxr3tytlmt  ivils  2tmir ny1altelnci s) 2uru o;o0oee  iciat a2ua( snu)areoif iatlmD luvo s0setrio3no1ol e fes t)srtm( ono1oltnmf3iat a2uanvsnt)arxnif3iotfpt  uvs t)t2tmiopou1olenlnviatf Dtr(m ou4tlx ifetltlmDuln snu)alenxo3ia1fpDeauvo;s srtm(o3iu1omtnlfetas)srtr(rp;o4teeo ieildlm2emu o u0 etnxr3to1lmtr i i s srxoxo ou4lmenlnvt sfa2rr(mpno1ole mo3tyt a2uln snu4 eenxf3oadlmDrlnvs ()sexoiopnydop nlfcils)artmumont1tpxn ieiydlmDemnvo u0 lermr totfm r ueslt0 rur(m3nu4aptelnesltfa2ua(root0teenmicilt a rl(vo;(0arerxo3oa1fpDe uesls) rurio oodlpe lfcs tfaDuaxmpnu1oetnifeiytfs ua(mp;u0 rxrxf tatomDelnvsl()s2to(o io4alenmnciatfs2tmxrp;o0tpt ii3iatfs2rmump u4 lenmr3oy1la  aivs ()t2xr(opny4altn nviat  2umum oo0openiiciytfs em( s t) lxnmr3ta1fa e neils0s2xr(opnydaleemncsatf Drmx  ot1olxoifeilsfa2eluvsnu4 exrxo3oo1fpDrlu s (0 rumxm oudopt  ictl(faDra(rpnu0alt  ociadla2rln o t0 reoxrcoa1fatr nvo ()trtoim nu1ale lnvsls)arum(r ot4olt  i3iyd mDul( o;u) eeomf todla e ivs;() eum(o iy4op elicias)s2uau  nt4tex ioeiltfa ua(mon() leoir oodlaDraueils)t2uoxr3oo1lmte ies tfaDtru pno4oee if3tyt s2eau on() lermf3iotlm raueo;t  2tm(mpoy1lptnlfcias)s2tm(m oo0aleoioetydfm2emumpnt) exrir totla rluvo;( s2tmxr nodal n fet t)srtm(mont1tlxnmf3ilt m umumpnu4tltnmo3ta1oate i o t)seto(rpoo4omtemfcsa(fs2rauronu0tle iiciydlm2rm( s t)texomo oy1latrlivi ()s2urxo iydopt livsat  2rru pnt1aeeoiietat m2uau p (0 etoioctotop e i s;( t2to(rpnydlp e nvsas  ruau ono1tlenmietls a2ea(mont)aetoircta1fpDeluvs;s0sexoir oydap  miei tfaDrrxronu4oet miciatfm eln p t4teenxrciatomtranes;t t2xrio3ny4am e nci () Durxmpno0openmieiasfs eauvo u0arxrxr3tytfaDranesl(0setrio3ou1op emfvsat) 2uaumoou0alxniieiad mDrmuvsnt4 lxoxrciodfatr n ol(  rto(mpoy4lm emieia( srrax  ot4tpeomf3tld s rln pnu4trtnif3tadlaDeaieo t)srxr(rpoydllenmncs t aDrru o;o4aleo feiad s2um(mpnu0 etnmr3iotlpDranvs;(  eurxopio4ol nmivsltfs2uaxrpnt4apxnifctldls2em( p (0 eenio tytoptr u i;t0 2umir oy4lp   ies (f 2ra(mpoo4oetnioctlslmDrm(vp;u) rxrifcoa1laDelivs s) etrxmpiy1al  mietl()s2trum ;t0aptn ictytla2eauvpnu)aeermf3oo1om e ueilt0sruoio no4optelivil(faDurxm ;t4olt  i3iltlm ean p u0 renmrcoy1fpD lnes;s)tetm(opoydopenlfesltf rtrur ;u4alen o3tyt m2uanvo u) eenircia1fatrauvslt) etr(mpou4lm n fcta(faDtmu  ;t0tet  o3tas sDuan on(0texnio tydoatr u s;()sexmio3ou1optnmiesls  rrmxrooo0oetomfeiytfs uluvo u4 lxoio3ta1oaDe nvslt0trtrio nu4lm e ici sfsrrm(  ou1tltnmoctatlm ul( p;u)treoio3oo1oaDeaneo;t)s2tmxrpno4ap e ivia(  Duaump;o1tle  ociytfaDel(vp;t) ltnmf totfmteai ilt setrxopoo1ope lieia(fsrurxm nt0tlxo fctasfaDrlu snt4tetrxf3oatoa rlu s s0 2tr(m3iu1lpe  nesa(fartax  no0ole ifeiltfm ran s;u0 etoiocoo1oatrauvolt) rxo(o io4llt  fetls  Dtrurpoo0tetnio3iytfmDrm( p;u)alxoxf3iadfp eluvsls) 2toirpoodllt mivsatfa2urumo;u0olt mociydlaDelnmsnt0altnif3oydfa  aieo s0 ruoxo3nydaleeliei s s2rrxmo;u4tpe  oeildlaDem(vsnt0artoifctadfpt ln s;s  etr(o oudlp  mieslsf Drmumo;t0oeeoif3ilslaDrmnms u0altnio ootfmt luvi (0setmim3iydopt lnvsls) Dtmur oo4aptomo3tyd a ean pnu)tetrxocoodoa  anvsls0setm(m3nu1ap   fvsl(  Drr(m ot0apx  i3tlt s rln on(4aexrio ootfm  aieo (  etmxo3oodoltnmnesas) 2tmur ou4aex ioeiad sDuauvsnu4 exrmocty1fmD  n il(0t2tmio iy4aleemnetat s2rmxm ;t1olt ifciatfa ranvp (0tlenxf to1fa  li i t0 2xmxm nu1aleemncs s  2umxrono1aeto ieiltla ua(mo;u)teerxr to1opt lnvil()trxmimpno4omt lnci tfartaxm no4olx mi3ilt m ua(msn(4alxrifciatoatr nvs t0 rto(rpno1openmfet s aDum(r ou1oltomoeiadls el(vs;()arxoxo todoatraneolt0trur(m3oodlm elivtas  2rr(m nt0tex if3ilsfm2uauvs;u0altrxf oa1faDr i s;s) euo(r3nydalte fvslt)aDtax  ;o4apenioeilt sDran o;t)arxnif3oa1lpDr iei t seto(opoudopenmnetl(fsDumumonu1tle iieiytla2rmnms u)trtnmr ty1oat  ieo;(0setm(rpio1lm e neslt)sDrru  ot4oex  ieilt sDrmn s t0 rxrmr3ty1fa e ivils)t2toim iodomeemfvsas arum( pnt1olxo f3ilt m2rm(mp;u4 eeoxo to1fatelivils0teur(o3iudop emict (fs2uaxm ou0tptomictytla2emn s;u) eeoio3iytopD  ies s0t2ur(opnydaltn nesa( aDrmx  ;t4aex io3tasfs ul(mp u4 lxrif3iadlpD li o;(0seurio3oo4lmt lfct ()sDuaumo;u4tpxnmfeiyslm2ea(vp u) renmociatlm  aivs (  rum(rpoydapenmnetas srtrurpot4alxnifetldfsDul(von(4 rxrxociatom  lneil(0trtmxo3oy1opt  fct ( srrm(m ou4oee ifciatlsDeln o u) eerio3iydfatelnvo;t0t2urxo3oo4omt mics sf rtaxront1olx  i3ilsfs2ea( s (4 lxrmrcoy1opte i s ()s2tmimpou4amt lfci s srraxrono0tptniociyt a2ra(vont0 leoif3oydfp raneils) 2xo(rpiy1open nvi t)a2ur( p;o0tltomi3ildfsDra( o;() lerio tytlpteanvils0t2uoir iudam e fcta(f Dtaxmo;o4opx mi3iatfmDel( p;u4teermfctatoa  ai i s0srtmxm3io1al  lfvi ()sDrau pno1altn i3tytla2ul( p;t4trtoxf tydoa rlueo;() 2urxm oydll nlictat)srrr(mpou1alxnmietytfa2ul(mo;u4 lenxr oadomDrli o s) rtoxopoo4lp emietl(fs2ra(r oo1tetoio3iytlsDeaump (0texrxrcoo1la e i s ()t2toiopiu4apee ietatfa2rrxmonu1oee  ieilsls em(vont0 lxrifcoodfaD lnvsls teum(m nudll elfvtatfsrrru  nu4olx  o3iadls2elnmo;u)aexnxf tydfaDraivo ( texrxmpoy4ll   iei t)a2umx  nt1oetniiciadlm2eln s;u) etomr oodfate ieo s srtm(rpiy4amtemnei tfaDrm( o;t0tlxomfeild a ulnvp;u)tlxrir ia1op  lu olt  eum(o3iu1omtelfctat)sDrr(  ;t1oeto iciadfaDra(mp u4alenxf tadomt luvs t seuoxo3iy4lm elies s)a2tax pnu4aet mo3taslaDranvs (4aexnir3ootomDe iei;(  2xrir3oydll  lfvi s s2uaur ot1apen icilsla2rl( pn(0tleoifcoodlatr ueol( srtmxrpnu4apenmieta() rra(rooo0aetoio3iydls rl(vs;u0 eeoio tydlaDelies;s) etrir3iodllen ics s)arta(ronu0opxomieiydla2rl(mp;t0 rerif ia1opt  nei;(0seurir3oy4olt mncsa()sDuax oou4optnifciadfs um(vp;t)artoio iy1latrluvols) ruo(r3iodlltemiei ( arra(mpoo4tlxo iciadlsDra( o;t4arerxocoytomt  iei;(0teto(mpnodlmeemncta( s2um(m no4optoiictadfa2rl(vs;t0tetnmociy1lpt lieo;s0setrimpno1op eliei tfsDtrxmp;u4aee  iciltlsDel( p;t0arenmf3oodlp eaues t0 exrim iydoltnlnesat  2tr(mono1ape  fciydfmDemuvp t0 etrifcia1opDeaues s srxo(o oydll e iei s)srur(ront1optomoetadls2ea(ms;() rtnxr3tydopD  i i s)tetrxopny4lle mieiasf 2umxmo;u1tltn ieiyt s2eanvon(0 rxomo3iytfaDrli s (0 eumxo nydlp emfvsatfsDtrurpoo0tle ifeiadfaDemnmo (0aetrircoadfp ean ols sexmio oo1omen iesl() ruax pou4opeoifeild aDulnvsn(0aetrmf oydop  anvils s2xoio iudam elneias sruau  oo1apeo o3iytfs2ran pnt)aexriociytfpDr ieslt0s2to(m3ny1lm   icta() ruaxmpou1olx  ocils a2elnmo t)altoxf tatopDr ues;s0 etm(o iodll e ivi t s2um(rp;o1oexoiociad a uanvont4alermrcto1lpD  i i;( trtmirpio4oltn neiat)a2rr(mont1teen ieiltlm emn p;(0 rerxf3iadfm eaieo s srxrxr oydaptnmfcs t srta(moot1tlxn iciyt s el(vpnt4 exrirctydop   nvs t0srurio iydaltnmnesas) rrr(rpnu0altoioeiysfaDulnvsn()tltoxocia1faD aivo;t  etoxm3ny4lmt  nci (f 2um(rpnu4aeeoiieild s umu p t0 rtomo to1fmDranes;t t2xm(r3no4opte fes (fsDrax onu4alenifetydfm2rm(mp;t4tlxnif oy1laD  neilt)t2tm(r io1lmen ictl(f ruru  nt0opto fctatlaDemumsnt) ltrif iytfa raies t sexoxr3iodaltelicias a2uauroot1oleoio3tltls uaumo t4 eermf oatopD au s;s s2xo(opoy1alee ict s  2rr( pnt4openiociat sDrl( pnt0 lxoif3todfm  livi;s0 rxrxr io4altn ivsa()sDur(roou4ape iiciyslsDuln p;t4tlxrmr3oytlaDe ueil(  2xrxr nudlptelnct t aDumx  nt1tpe ifctasls umnvpnt0trtniocoa1fmtelnes t)trumxo3ny1lpe mieilt) rraurpot1aee  fciad a2ulnmon(4aetrmo oydfaDr n i;s0 2xmxo ny4olt lfcs ()a2tau  nu4aeen iciysfmDemnms;u0aetrif3tytomtr i o;t)teto(opiu4opeeliesa(f rrrxmpot0altniociat aDrmuvsnt0tleomr oatlmD aiesl( truoir iodamt  ictasf 2tm(r nu0aet moeils m rln p;u)treomo3oodlaD  ueo (0trtoxopoydlpee fetl( arta(r ;o0tee iictasla ulnvs u4 reoxf ootfatrlu olt s2to(mpnodaptelncta( aDtr(rooo0tpeoiieilsla emnvo;u)altrif3tytlm e ieolt) 2uoxopio1lm  lfcsls) rraxmono0apxoio3tas a em(vpn(0trxnxf3iy1opD aues;t0texmxm3nydlme mfcils  Dtaurp;u1opx mociytla um(vs;(0 rtoxo3totop r ues;s0s2umxmpoo4lp n nvi s artmxmpot1altoioeils a2eanmo u4texnmr3oa1oate ivi t0s2xr(rpoudlp emfci (fsDurur ;u0teen fctatlaDrlnmo u0 eermfciodomDeluei s)t2trir oy1apenlnvt t) 2umx  ot0opx  ociydlm2ea(ms;(0texoiocio1lmD livilt0setoxrpiy4ameemfvi s s2tmxmoou1oexnii3tlt sDrm(vo (4texomr3to1lm rauei;s0t2urxm3no4olt lfetatfaDur(ro;u4ope mf3iysla2rluvpnt0trerxf3iy1lpteaieo;t)seuoxo3ou1altnmiesas s2ur( o;t1tee mietydlm2eauvs t) eerif3iotlmD ai i t) exmirpoudomt mfeil( sDrmx onu1aleo o3iatlm ra( p;t4trtomf3ty1om r ieilt s2ur(r iu4om  mnvslt)a2tr(mp;u0ape iicias s2eluvo;t4tetrifciy1faDraneols)trtmio3ny1opt lnvsa( srrau oot1aeenio3tysls ua( s;()texnxr3oodfpteauei;( truoim3iu1op elivilsf rta(m nu1aet iociadlsDuauvs;t0 rtnir tadlmDrai ol()texo(r ou1opee nci t  2uaxrp;u0teen ocias a2uanmo;t)alenmrcootoat  nei ( t2um(o3iudlleelneta()a2rm(rpoo1aex  ictytfaDel(vp;u) renmo ty1opt  nei;t0 eur(mpoo1ll elfvt t) rumumoou1aptomo3iytfaDulnmp ()tltoiocoatoa rluesl( s2urxopiu4ol emnet s s2uru  nt4aexnmi3iatfaDuauvpnu0alenmrcty1la r ieolt0 2to(m3iudalt lict s)arrr(r ;t1optn f3ild s uaumsnu)tltrmr iytopteli o;(0teuo(mpou1ame mict ( a2tr(r no1texnmieiadls2rluvo;t4 lenxr3iydomDeln s;(  rtoir nodom elnciat)aDurur ;o1optn ietasfsDrlnvo;t)artrif3tytla e ueo t) exm(o3oy1al  mnct s)sDrau ooo0tlt mi3iad a emn s;t0 eeomociadlp   n o;(  2xoir3oodom emiei (  2uaum nu1apxo f3iytfs2emn p;(4 exrif3iadfpD lnvs t)truoxmpiy1al nmies ( srtrxr ;o1ope  i3iytfsDem( p;u0 exrxr tadlmDraues;s trxmxo nudlmtemnvslt aDtmumpot0aexnmociat m2ulnvo (4tleriocto1fmD an ilt0srtrimpio1lltemies ( a2rmxr no0oetnio3iysfa el( pnu4 renif3totlaD aivs t teuoxo ou1am nmieta(fsrumum no4olxo ieilsfa rl(ms (0texoiociatlatr neilt) eto(o ou1llenlieiatfsDrax  oo1oltomi3iytls em(mpnt0 lxomfcootfp e neolt) 2xrxo io4lme  ivi t)sDumur ;t1tpeomoeiydfs umuvp u)trenif3io1fmte uvols)s2urim3iu1om  mncslt) Dtr( oou4tpeniieiydlm2ua( pnu4artnxr3to1oa rlnvolt s2xr(m3oo1ll n fetas)aDrr( onu1olenmoetytfs2rluvsnt0 ltnifctydlp raies (0srtoxopnydlltnlicta( srumxr nu1olen ietlsfsDranvs ()artrmo3to1lpDrlnvilt)srtm(mpoo4am nlieil(f 2umx pnt1olxn fciadfs rlnmo u0 rermr tatlpDe ieo;()truo(m iy1ap  mnctas sDur(m ;t0apxomocilt a2eaumpnt0 eenmo3iatoat  nvo;t)trurxrpiy4lmtn ivt ( sDta(r ou1oleo fciydls ranvpn(0 leoir3iatomt  nvs (0t2xr(opiydol  mietlt)sDum(mp;o1oeeomi3iasfs2eau o;()aleomo tatom  lueo s0t2um(opoy1aptelnesat  Dtmxmp;u0tlen feiyt a rl(monu0 ltnio3ty1oa  aueolt0t2uoirpnydoptnlivil( a2ur(mont1olt  ieiydlm um(vs u4tetoxo oadfpDrauvolt sexmxrpou1olee ict () rtm(m ou4tlt  o3ildfs el(von(0 lxrxf3tadlmtr nvi;t0 exoxo3iodale  nct (fa2tmumpot0oetn f3tasfmDum(mo;t)tltrmo tydlm elnesls)t2to(opiydamtemfcs t) rrm( pno1aee iieiasfs emnms t0alxrxo tydopD ln o;()srxmxr nodapte ictasf Dtmxmoou0tpeoiieiatlmDrmnmp;()aetoxf tydop ran s;t)s2toxmpoy1ope lfciat) 2ra(mono1olxoio3iat s ul(mont0tetnxr ty1oa elivsl( t2trim3io4amtnlnct ( aruaumpot4altniictatfaDeln s;u0trtrxr3tadfmDeaivilt)setmxrpoudopee iesat) 2uru pou1aptnio3tydlm2el( o u)tlxoifciydfmt au o;t  rurimpny1alenmnetat)sDurxmo;u0alenmi3iyt s ea( o;u4artoxociydfaDelivs;t texm(m io1op e nviasfsDuaxrp;o0tex mfetytls2rmnmp;t4alxnif iatoaDean il(0trtmiopoo4amtemnet t  2ta(rpou4tpx  i3iasfs2ua(mon(0altoxf tytlmD ln o s0srxoirpnodope lnei tf rururonu4optn ietat mDua(ms u) exnxrcoy1lm  aivs t t2tmxopoy4lptnmnct tf rrr(mpnu4alenmf3iysfaDem( o ()tetomf oytfa r nvi t0setoxr no4ol e ncs tfa2raumo;t4tleo f3iltls rlu o ()alxomfcoydlm e ieslt)s2xm(o ou1alenlnvi ( aDtmur ot1tptnio3iadfsDrmnms () lxoir iatopt lu s t  etoxo3nodop  mnvtas s2trx ont0teenmfeilsfa2uln s;(4 eermo ty1omtrliei;()teumxm oudop nlncia( s2raxmooo0tleoiociyd s ulu p u4 leoxo3iodomteli o;s)t2tmxopio1lp   ictls srra(  oo0aexo i3tlt m2elnmo;t4 rxnir3iy1opDraneo t  2toiopio1amenmncs t aDtrur no0aeeoioeiat aDea(vp t4arxnxfctydlaDelies;(0 rtmirpoudap elictasfs2ururp;u1tptniieiltfmDrlumo u4tltoxr3todlmDrai s;t) eumxrpoudamt lfvs t)aDtm( o;u1tex iociad s rmnms (0 lxnxo3oytlptr u i;s setrir nu4lmt  fvsa( aDuaxrooo4tlx  o3tltla ea(vpn(4 exoxr ia1lmD  uvs;()t2tmxrpoodome mics (faDrm(mpot0tpe  fetysfs2umn pn(0trxoxf ta1fm rauei s0s2uoiopoo1lle lnctlsf rta(r nu1apxoifciasls2rmn s;(0aeermo3oodom   n o;t)t2trxmpoydlltemictl()srtr(r oo4aet  f3ias a ranmpnt0altoirciadlm   ivols0 2uoxr3ny4ole mici s)aDurxr ;t1tpt mfetys m elnmp;t4tetoxrciytoa  ln o;( t2um(mpnodamenlfeia() 2rmx  ;o4ale mf3iad s2rln s t0 etomociy1la elnvi;s t2uoiopny1lleelnvtlt)s2ur(m nt4oeen f3iysfmDrmuvs;t4 etrmf oy1fmtrlu slt0 2trxopiydll  lfciasfa2rau  ou4olt mf3iytlaDeanmp;(0alxnxo3oa1fm  lneils)srtrirpiu4ame mnesas s2taurp;u1oetoiiciyd s ran o () rxrmo io1fpDeli i;(0s2toxm3iodllenmiciasf rtr(  ;t1teto ocilslm2ran s;t0arxrio ootla eanvo t) 2tm(rpnodlp nlicsl(fs2ta(r oo4tee mi3iyd m emnvs t)texrir iy1oaDrln s;t0 2tmxm iu4lltemics sf Dtrxmonu0aetnmi3iytfmDranvo;()aleoif3oadfp   n ils0t2xrxopny1ame livtlt)s2rmur no4oleoioeiasla emnvon(4 exoxo3tadoaDr neols seto(rpoodlme  nes sfaDururpot0ope  feiltfs rlu pnt0trtrmf io1opDrau sls) rxoxmpoodlp   nvsl() rtr(mono1tle moctatfa uaumo ()tltomo io1lpt ln o;s)trtr(rpio4lm   iesasf Dtaxm ;o4teeomf3iytlm emump (4aexoir3iydopDeaies t)trxoim nydamenmnet sfsrrmx ont0aetomfciadlsDul( o;(4trermf3totop  anes;t)sruo(r3ny4omtnmfctas aDumu ono4olto f3tadfa2ul(ms;(0arxniocoytomt aivo () etmir3iodaptnlnes s  Dumu  oo1alx ifciat m elumpn(4 eerif3oodlaD  iei s0 rumxo3iy1oltnmicsa(fa2uaxm no0alxn i3tatfaDemums ()tleoxr3ootlat lues ( texrirpiu4ll  mfes tf 2raxmp;o1tetoifciad mDul( pnu0texoxr oa1op   ivs;s0s2uoxm iu1apenmivsatfarumx pnu1aee  feiasfm2rmums;t)arxoxfcia1lpt aivi () exo(m3nu4lmenlfctls a2rrum ot4tetn f3iydls2ra(vp;t4alxoio3iatlpt lnei;t  etoxo3nu4apeemivsl() rta(r oo0alxnioeias m rlnvpn()altnxo oydlptr n i;t) etrxo nu4ll nlneta(f 2umumpou1tlxo oeiytls2ul( p t)trerxoctydoatr ueo t) 2xr(m3no1apenmfcil( a2taum ou0olxnio3tadlsDuauvp u)aexoio ia1la r ieol( trurxo3ou4apeemnesltfsDuru pot1tpe ifetydfs2ulnvsnu0 rxrmo iotlaDeauvilt)srtoim3nudomen nviatfsrur(mo;o4aptnmfeildfs ra( o;() lxnxrcia1lm raivo (  2xmxopny4ale lnvsltfa2uaur ;t1tlt miciadfm2ulnmsnu)tltrmr iatfpt livi ( sexmxopoudlle lnct sfartm( o;u1tptoifcild a2umuvp;(0artrif io1fpD  i o;()srto(m nydlp e fvtas)aDurx oou0aleoio3iys m2ra( ont4 lxoxf iotfaD  ivs;s  rtr(r oydam   ies s)sDtrxr oo4olt mi3ildla2umu p t0 rtoif iotomteaiei;s)seum(mpiydaleemnesat  rtaxm ot4oex ifcias aDrmn p;t4 lenif oytlmt aueo;t0 2umiopiudlm e nctls)srurxmpou0opto ociytlmDeanmo t4aleoxf iatlatrauvolt)t2toio3iy4amenmncsatf rumuro;u4apxn feiysla um( p;t0alxrmfciadlmDeluvs;t)s2tr(rpou4amenmncslt arrrx pnu4apxnmfetas sDra( s;u0alxoxf3tydomDrlieo t  2xmxo oydlle lfvilsfa2rau p;t0tltomfcils m2el(vo;t)tlxoxrciydlm elivo (0 2um(rpoy1altnmfesas)srtax  ou1alxo fciyt s2raump;u)artoxrciadoa e nvo ( sexmxr3oudll nlivt ( aDurxrpnt0opx ioeiatla rln s;(4aeenxfciatopD ai ol() rxmimpou1lmtemnci t) rtmxr ;o0aptoioctydlsDrm(mp;u) lxrxo iotom rln i (0tetoim nu1omtnmivsa(  rumx ooo0aet ii3tldfm elnmp u0 ltoiociatoatrauvs;t0seurxopoudaltelfct t  rraurpot1texoioctatfa ra(vont0arxomociy1omtraneo t trxriopiu4lpt  fes t)arrmu  no1opxomietysls2rln o u4 leomr iytfaDeluvs s tetm(mpnydome mivi t)srrru oou4opeomfeiyt s2umnms;u0tlxoif3oodfmtraieo t0 2uoxrpiu4llt  ivi tfs2ur(m ot0alx if3tldfmDrmuvsnu4alenxr3oy1fmDeaivs;( t2xoirpoydll  lfciat aDtm(rp;t0altnmociyt a2um( pnt4alxoir3oytoat lnvol(0 exmxm3oodlpe  ictat)a2tm(rp;t4oexo f3iysla uau o u4 eerio3oydlmDrlnvol(0seumxr iy1lpt livta( artm(r ou4aexoio3tltls2uau s (4arxrio oy1lmDrlies t  2uo(r3no1am nlnctat a2ururpnt0teeoifciadla emnms;u) eerxocio1omt anvi s0 exoxr no4llenmfvilt a2uru  nt4olto f3tldfa rmnmo u0 rxrmfctytfpDeln o;s srxmim iudaptelnetl(fsDtrxrpnt1tlx mfciad sDul( on(0arxnmf3to1fateluvs t)trxmio oo4omt  nvi t)artm(roou4aexnioctltlaDraump (4texoir3oydlmte n s (0srurio3iydalt mfeia()sDtmu  ;o0tleo ocias a eauvo t0 lxrxf iotfp   uvo;t0srxrxmpiudapt  ncils)sruru pou1oeeoifeilt m umuvp;t4 exnxrcoodfatrluvs;( t2ur(o3no4om nmietatf Dur(mpou4aee  i3iad aDrm(vp u0tlerxf3oodfat luei;( t2urxo oudal nlfesl(f Dtm( oou4tltn fcildls rmump;t0treoxf3oo1fmtrlivi;t) 2xm(o3nodapeemicsas s2ra(r ou0opxnio3ilslm ranmp () rtrxf3ia1fpDrluesl( srumxmpoy4amt  iet () Dtr( o;o1oexoiiciyd a2emnmonu4 ltomf3oodfaDranes ()sruo(r iu4ap  mnvta()a2rmx oou4aptnmiciytfs2rmuvpnu0aleomr3todlaDeai s;t srxmim3oudamtelivs ()sDumu  ;u4tee ifciys a uluvsnt)arerxfcta1omD livilt texmimpio4lme  fci (faDuax  nt1texn ieiat sDrlu s (4trtnmr iadfmtean o;s0setrxo oo4ame mfesl( srtrx  ;t4altn oeiad s2umnvo;(4 renxf oo1la r iei (0 2xoir ou1optnlnvsltf Dtauroou0oetnif3tys aDeaump t0artrmrcto1opDe uvs;s0trxmxopiu1amtnmivt (faDtaump;t1alt  i3iatlaDulump t) eerxo ootlmD ln ilt)setrim io4lle lfetatfaDuauront4aptomi3iatla rlu o t0texrir3oa1lpD aieils t2xrxr3nydoltelfcslt) Drmur ;t0tpeoii3ils a2emu o;u4tetrir3tadfmtelieo;( trtm(m3iy1lp   fct (fsrum(r ot1ope mocilt aDrmn o u0 rxrir iatoaD aivols  exoxo iu4op nmietltfaDuaurono0tltn iciyd sDrm(msn()tleoio oadop raivo s) rumio iydapee nvil()sDurx p;t4tlt iieilt sDemnmsnu0tlermo3oa1opt auei t0 etm(o3oo1lptnmfvtat sDtaumont0aeeoii3ilsfsDra(ms t4treoxociotfatr u s s)srtmxopiydame mncs t)arururonu1tlx mfetldfm2um( p;t)aetrmo3oodom elieo ()trtr(r3nodlltelfcs s)arrr( pnu1openmfeildla2rmnmo t4teeoxo ta1omDraivslt0teum(o iodam  lncsas)s2tmxr ou4tetn fciatla2ua( pnu0aetoxr3tatomDe uei t setoxo3nydap nlnci s)srtaxm ;t0opt  octysfaDea(monu0 exoxfciotoatrau o;s  2xrxo3nu1lltemfes tfs2trxrpoo0alxniieiat mDeanvp;u4aeeoio3oodla   uvilt0trto(o3oodlmtnmnvtat aDurxrpou4alxnio3ild aDum(mo;t4 lerio3totla eliei s0 rxrxm iu4al   nci s sDrrx  oo0oex iieiyd a rlnmp;(4aeerxocoatoat au olt)s2xrxrpnydapenmnes sf 2tax oou4altomo3iydfa eau pnu)arxrxocoo1lmt aies;t0 2xoxr3io4ome  fct (f Dumur ou0opxo feiysfa ul(vp u4aexnxo oatlp eaneol(0 rxr(r ou4ol nmicil()arta( o;t4alx  ociadlm ulnmp (0arerxfciytlaDraneo t0teto(o iu1om   nesa(  2urumo;t1tpeoioctldlm eau onu0aexrmo oa1lpt aues (  2tm(o3oy1lpeelneia(faDtm(mo;o4altnmoctydlmDul(vont) eenio3oodlm  anes;t0s2uo(m oo1om elietlsf Dtm(m ;t4alenmieiltfaDrm( p u) leoir oadopt luvils t2xm(m ny4apt mics s  rtm(  no4oet mi3ild sDra(mp;t)aexnmr oadfa ean ol( s2trio3iodom  mics s  2umuronu4alx if3ilsla ra(mo u)tetnxo iotlaDraueo ()s2xr(r3ny1om emnvta() rrm(ro;u1olxn o3tysfs2ra(monu) etoxo io1om   i slt)s2tm(r3oo4om emneia( aDuaump;u0oeenmoeiadfs rmnvp;(4teermr3iatfaD luvi;() eumio oy4ol emfctatf 2rr( ont1aeeo iciydlsDeln pnu0 rxomoctadfpt  i s (0 2toim3oydaleemiei t)a2ur(ro;o1tpt ifeiadlm2rm(vpnt0aeeoxf ootfmt  ies;(0srtm(m3iu4omtn nciat aDuaxr nt1olx ioeiad a2umu p;() eenmf ia1fm e n o ()setoim iydap elnet t srrr(mont1apeo iciadlmDrau o u4 etnmoctytoa e i olt0sexrxm3iydoptemncs ( s2rmx pot4olt  ociydlmDeau pn(4tlenxf oatomDeli o t  eto(m iu1lm   ivilt aruau pou1aetoiocildfm ra(vs;(0tetnxf3ootfa eli ol(  eur(mpny4olt mfciat)sDtrxrpou0apeomi3tadlaDuluvp (4 eermo3oatfatrai o;s t2xrir nodllenmnei (farrrxrpno0apx  ocilsfmDul( p (4aetoxrcta1fm ran s t sexoxrpny1amtemict sfaDua(m ;u0apxo iciatlsDua(vpnt4aexrmociy1lpte n i;s srtoimpnodalee nesltfa2tru  ;u0apeoii3tatfm ul(mon(0aetrmr iytlaDrlueslt  rumxopnu4amenlnesl(farua( ont1teen iciys m2uln s;(0teermr3oy1om elies;s seur(opoo4lmenlfcta(fsDtrx ont1oltnmfciadlm2em(vsnt4tleomr3todlpt auvolt0tetm(r3oydameelicias)sDrm(r ;u0apxn icilsla rl(mp;(4 etrmf3oa1faDelnvo;t  eur(r oudapte nes tf 2ra( ont0opt ifeilslsDrlums;(0tlxnir to1faDeauvol() exmim3oy4ameelncsl(faDrmumoot0opeomi3iadfs2ua(mp (0artnmr ta1laDeanvo (  euoir iy1lmenliet tfarumx p;u4tltomiciydfa2uluvp u4tetnmf oytoa eluvs ()s2xrxo nodalen nesas  Durum ;t4apxomf3iydfaDrm(mo ()tlenifcoodfpteaies (0 rxr(m nudamte feil(fsDrm(m nt1olxo oeiydfa rl(mo;()trxomoctydfptrlnvi (0teumxo3oy4lltelfvi ()arur(  ot4alxn oeiydfa umu snt4areoirctatomD li i s0t2xmim iy4omen nctl( aDtm(  nt4alxnmfeilt m rm(mp;u0trtnxo3io1fate n o;(  eum(r oodal e nctls  Drrumoot0alto oeiaslaDuluvp u0 ltrmf3tatla eaies;()truo(mpoo1omee fvi t) Dra(r nu0olt io3iatlaDrauvp;(0 ltrirctadfpD  nvo;()s2xmxo no4amt  fes t arta(moou0oee  fctltls emn snt0trtoir io1fa  anes () rurxopnudap   fei t) rrmxr nu1aetnio3iydfaDrm(vsnu0arxoxfciytomt ai i () etmiopiu4oltn nvta( s2tm(mooo0tptn i3iadfsDrm(mo t4tlxnio tadoaD  i o t0trxo(m3oo1am  lnvi sf rtmxmpou1tlto feilsfa2elnvo;u0 lenxrcootla r u o;(  rxmxopnudaltelfctlt  rtrumont1apx iieias s2rlu s t0 ltrmr oytopDeaneilt0 exrio3ou1olt lfvt s aDumum ot0aexnmfetadfa ranmp;u4tetnxr tytlm   nvs s)s2urio3oudap e nvil(  Drm(ront1oeenmietytlsDeau p ()artrmfciotop  lies s sruoxrpiy4lltelnvi s s2taxrpou4oeenio3iatfsDel(monu0altnmr tadfat an i;s0s2ur(o 
\ No newline at end of file
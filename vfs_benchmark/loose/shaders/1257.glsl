@@ -0,0 +1 @@
+n o s t2xr(m iy4om  mfcilt sDuaxr ou1alenmi3tysla2ul(vsnt)artoxr tadfm  lieo s  2ur(mpiy1omeemncsls  rtm( p;u1olenmietatls rmnmp u4 eenir3oydoat ai i t trtmxr ny1optelnesls) rra( p;o0alxomf3iyt sDrmuvp u0 rtrmf iytomtrau s ()tetr(opno1lptnmictls) Dtmx ooo0tptnmociydfmDumn onu0aleoif3oydfpt auvs;(0 etrxo3oydoltnlfei t) 2um(rpno0tlxoifeiltlm2ua(mo u0 ltnifciy1fa   uvsl( sexrio iudomte icsltfarra(  ou1apxnifctaslsDra(vonu4 exnxo3iytlat livsls trxmio ny1op n icslsfarrr(monu1tpeomicilsfm eaums;t4 rerxfciy1lmD liei;( trxoiopno4apeelicsasfa2tm(roou0oetnmo3tltfm um(mont4altrxr ootom e ivs () 2xm(r ny1ope miviasfsrumx pot1oetoif3iydla elu p ()trtrif3iytlmDr nvi s texrimpnydlp n ivil(f rrax oou1tltn oetasfs ulnvs;() exrmr oytlp   ivs s0s2xm(o3ou1am e neil(  2um(  ;u4tle mfeiad mDulnvpn()tltnmfcoatoate u ils0 2umiopoo1lmen fesl(f Dtaumpou4olx iieiydla rmnmont4treomr3oo1fp rluvs (0t2uo(r nu1oltnlnvt tfsrrmurono4tpxnioeiys s2em(msnt4aeerxr3oytom raieo;(0trtmxmpiu1amt lnviasfarumum nt0tltnioetad m ulu s;()texnmo3todopD  ivi t  rto(m3oo4llenlfeils  2tru poo1apeo fciys s uln p t0 lxoio3todfm eai o;s0s2xmim iu1altemfctl(  2ta(moou1opx moctyt m2uln o;u)trtoxociadlm r ues;()t2tr(r3ny4op  mfcsls srumx o;u1aleomieildfs2ulu s;() etrioctatomtrlies (0trtoir iu4op emfcsls)srta(r nu1apxo oeiydla2rauvpn(4arxoir3tydoptraivols srum(o iydal emnet t a2raur oo4aex ifctys aDem(vs;t0trerxf iytomDe iei;(  ruoxopoodalt  ivsa()srtrx pnt1alx  iciltfm2ra(monu)aeermf3oydopt  uei;s)s2xm(r oy4lmeemietlt s2tmxrpno0tptoii3iyt mDrlump t0alxomocootla eaueo;s)t2umxr no1ale  nci (fa2um( ont0tlt micils aDuluvsnu0artomrctatlpDrluvol( s2uriopoo1apenmfcs tfsrra(m ;o0tptnifeilslmDuan o u)aetoxfciytoaDrluvi;(  2umim iu1al  mnesl()s2um( o;u4apxnii3tlsfm2rmums;t) rtnio iy1lpD  n il()srxmirpny1oltnmncsas  Dtauro;o1olen ictatfm umuvo ()aetomr ty1omtranvs s setoio oy4opeemnesatfs2ua(r ;u0tlx iictadla2el( o;t0aexnif iadlm r nvs (0 rxr(r3io1ope mnvsl()arumuro;u4oetnmf3iytlaDranms;t4 exnio ta1fm eln i;t t2xrxo no1ll  lfcta(fartm(mooo4apxniictlsfmDemn s u)aeerxfcoodlp   i slt  2toim ny4ope mfvsl( s2urumooo0aee  octyd a ul(ms;u) etnirctydfmDeai o (0s2xoxr nudllenliet sfaDraurp;o0ole mfeiytfm2ua(vonu4areoxoctydfptr nvil()trxo(r3ou1omenmfvs s) 2ta( o;t4opxn fciytla2uaumo;u)aexomr oa1la  liei ( t2xmxo3io1llt lnvsatfarrrxroou1aexo oeiytlsDeluvs;u0 renxf3iy1oatr ueo;(0srxm(r ou1optnlnctl()a2taurpno1tlxomfetys s ea(mpn(4trerifcoydom r nes s  2tr(r ny1llt  fctat)s2ra(ro;t0oeenmo3iatla ean ont0 exnifcta1fp   ivs;()s2umim3ou4apt mnvtat srumxr ou1oet iictltla2ulnmont4alxnxr iy1latelivsl()t2xoimpiy1altn iei () 2ua( o;t4opxo octyd m2eau p;t) lxrxf3iytlptelnvi t)s2tr(rpny4ole lfctas a2um(r ;o1aexnmf3iyslmDelums;t4 ltoir3oydfpt lieo s0srum(m3iodal n nvsa(fsrrm(ro;u1altniictyslm2eaums;u4tlenxr iodlm e ueo s)texoimpoo4altelictlt a2um(  nu0apx  i3iysla rln pnu) rxrxr todfpDe uvolt0srxoxopiy1al emfvslsfsrumxrp;t4altomfciydla umu pnu0trtoif3to1opDeluvslt)srtm(opiydlp eliet t)sruru  ;o1tpt io3tltfaDea( snu) reoifciy1fmD lueslt)t2tm(opiydale lictlt)s2um( p;t4texnif3iltfm ean s;u0trxrmociydfpD li olt) 2xrxo3nodamtn fctas)s2urx o;t1oeenmocils aDum( p;(4teerif tatfaDraivsl( srxmim nudoleemnei ()aDtru poo1oexomoeiadfsDra(mo t0trxnxo iatoat lnvo;s0t2xoxrpiu1omt mivi tf 2ra(mpot0oexn ieiyd sDumu sn()arenxo3tadfp  aivils t2trxo3oo4lmeemnvtatf 2raur ;u0optomieiyt s elums t) exoirctatoatr ieilt) rxrxrpoydlltn fvtat sDtmum ;o4olt iieiadfs rl(vs;(0tlxrxocoo1lp  auvo ()sexrxo nu1ole lfeia(farra(  no4tle  ocilt a2eluvsnu0aeermfctytop  lnvolt0tetmxopny1ol nlfetls)a2rr( o;o1aleo feiys aDul( p;()aexrmrcoodlp rlnes t)s2toxopnu1lpeemfesls a2rmxmpoo1aexoifeiytlaDrmn p;t4artnmr totlptr nvslt) exmxopiy1lp nmfcias)srtaxmpou4tex mociyd a uau p t4 eerxr3iy1om  lueo;(  2xo(m iu1omtnlncs t sDumx pou4optnmictlt a2rmn o;t4 rxoif ta1oa  aiei t)sruoxr oodop emneta( a2rrurp;o1alx io3tysfaDea(mo (4tetoiocoo1oaDrlivs;t)srxrir3nydam elnvias aDrmumpnt0teen octld a ul(vp;t0aetnio3tatfatr n o ()srtmxopny4ll elnvsl(fa2umxmo;u4teenifetydlm2eanvo (4alxomfcto1fatraues (  euoirpiu1lm elics tf 2umu pno4aee ioctytfmDemuvs;u)tetomrcoo1fp  auvi;t0 2um(m3no1om   fei tfsDrmu ono1tlxniociydfm2rlnms;u4tetnxfcoytfa eai ols teto(r nydam nlfvtls) Duaxronu0optnmf3tltfa ulu p;(4 renif3todfmDeanvi s0teumimpou4om  lneilt arur(mo;t0tle ii3tld s2emn sn() renmo3io1fpDrauei s) 2triopny1omeelnciasf rur(mo;o1tleoioetlt m em( o;t4trtoxo3ia1laDrai s s0seur(m3oo1amt  feilt sDuaxr ;u4aleo o3ias s eau p t0teenxocoy1opDelnvs t0srur(opnodlm   ivia(fs2tmx  ;t4olx mfeiatfm2em(mo t0trenmrcio1lpD aueslt0srxmxr iydoptelivsl(  Draxr ;t1aexo ieiydlm2em(mon(0texnir3iotoatrauvi;t0 rurirpio1alt  fct sfarua(ronu0texomietad s rm(vpnt)artrmr3tydomD ln sls)t2uo(opoydaptemfctas a2tmurpnt4ole moetlsfm eauvpnt)arenxo3iadfa rlivs s0s2uo(r3oo4op  mfcs t)s2umxr ou0apxn fctas a elu snu4tlxnmrcoytop   ivo s  2xr(o oy1olee fcta(faDurx oou1apen fetysls rm(mp;() etrif3iytfm rlnes (0 exrirpnu1omenmiesl(  rtmu  no4aleoii3tasla emumont)tltoxocoytfaDeanei t) etm(m oy4opt micia()arrrur ;t1tlt mfeils aDra(ms t0aeeoiocoo1fpDeli o (0srtmxrpnu1lmtemnct ( a2uaxrooo1tpxoio3tldfaDranvp;t)tlxnxo3oydlaDeli s t) etriopou1ll nmicilt s2tmxr ;t4olxnmoeiatlaDumu on(0 leoir3iotomte uvsls s2toio3oo1optnmivsa(fsDtm( pno1alenio3iytfsDelnvs (0 rtrio oatom eaues t) 2xrxm3oo4alenlfvtat  ruaxrpno4tltnmi3iyslm rmn onu0areoxo iytlaDrluvol()seuoxopnu1lpee nesas)sDtrxmp;u1tlt mocils mDeau o t0areomf iytomD  nvol(0trtr(o3nu4olen ivsat)srum(  ou1tpx  ocilsfm emuvp;(0trxoio3oydoateaivo;()t2tmir3ny1op n ivsls) Drm(mo;u4altniociatfa2eaumpn(4tltrxo3iydlpt luvi;()t2xrio3ny4oleemfci s sDrmx  ot0tpx ii3tlsla2elnvo;(4tlxrmrcty1om rauei t0trtrxr oydom eliesatf 2rmxm ou1altnmociatla elnvo;t4trxnif3oydlpDe ueolt0s2uoim3ny1optemici s arumxr ;t4alenifctyd sDrmnvp t4tltnif3iotlatraieil(  etmxmpiydlp   net t arum( pnt4tpto ieiadfa2umu s t) rerxr3totlmDr nvo s  2uoim no4olt  fctat sDum(rpno0aetnmfctydla2ua(mont4 exrmo iodfa   uesl()texmxo ny4om   ivsas)srtrxrooo4ape mfctasfs umuvs;(4treoifciatlp eanvi;(0 2xrxr3oo4apenlietl()sruau o;u1tpx iieias sDeau s t0artnmf tatoa r u o ( teum(mpoo4alenmnciasf 2rrxrp;u0tpxn ieiatfm el( pnu4tlerxo3iytlmt  uvo s0s2urxr3nodol nmfetlt  Dur(rpnu1aeen ictad a uluvs (0tetnirciadlmtrlivo t t2trxm iodamenmfctls) 2urumpnt1oeeomo3iasfsDum(mpn(4teeoxr3iotlmDr ieo;t  rxrir nodlpen nvs s arta(monu1texo ieiytfm2elnms;(4aeerxfcoodfmDraues;s  euo(r nydlm  mfes s) rurxrono4oexnioctlslmDrauvs;t0 leomr iydomDr uesl()seuo(r3oodlpt mnvia( a2ra(root4oet mi3tas a rau s ()tlxnifciytoat ln il(0s2xmir3oudll elnvt t)arta(mpou4apt ii3iadla2rl(vp t0 lerxr oodfat luvsl( srxmxopoudol nlfcilt) 2tax  ou4alen f3iyd aDuan p u4altrxrciytfmtr uvs (  rxrio3oudapeemnvsa(f ruaxmoot4optomi3iytlaDrmuvo;t0trtrxf ootfp  anvil(  2tm(r nodlm   nesasf Dtmx ooo4aeenmfetas mDem(vo (4aeeoxf oadfp r u s;t trurim3oudom nmiesl()s2umumpot1tltoiicilt m ulnvp t4aeenir tydlm rlnesl()tetoim3oydap nlivsasfaDtrx  ou4tpxnifetyd s2ra(vs t4aeermfcoy1oa eli o;s  2toxm3oydlmeelfetasf Draxm ou4tpeoifetlsls uau s t4trtoxf iy1fa eliei;( s2tm(o3io1apen iesat  ruauroot0tpen ietldls umuvs;u4alerxo3ootfpDr ivi t trtmiopny4olt  icsatfarurumpnt1apenmfeiytfmDrmuvp;(4 renioctatlp r u s t0s2xm(opnudapte ncs ( srtrx  nu1texo fciadlaDemn o;t)altriocoa1la r i ols  2tmio3oodaleelneia()s2ua(rp;u0tpto ieias m ranvpnt4tetrmo3iydlatranvo;s0tetoxr oy4opt lneta(  rum(mo;u1tptomociyslm2elumsnu)tltnir ta1fptr uvo;() exm(r3nu4amtn ivi tf rur( oot1apxnmieildfm emumsn()trxrxo3oatfa r nei s  etrio iydlltn fct s  2ra(r ;t4tlenmi3iys a ra( sn()trtnio3oadfa r n o ()seumim3iy4apenlfet (fs2rmxm ou0tpeoiiciad m ra(mont)treoif3tydfmDe neolt s2uoio3oy4optn fei sfsrrr(r ;u4alt mietadlm2rl( p u4 ltnxrcoatomD  ues;(  rtm(o io4olt mfeslsfaDrrxmp;u0tpx  fetldfm uluvo u4aeerio ta1oaD  uvs;()srum(r ou4am n ncsa(farumx o;t1apenifctlt s umn s;()tlxrxo3oodlmDeauvs;s0t2toio3iydlp emictl() rrm(rp;u1texoiiciltlmDrm( o u4texoio3ta1op   uvo;()t2toxrpoydlp e iviasfartax pno1alt  f3tas m2rl(mp u0tetnmfcoydlate ies s0texmxr3ny4omt micsasfs2rrum nu4apt mi3iyslaDel( o u0 eenxf to1faDeln i t0setoxr iy4opte ieils  Draumonu1alxoif3iasfa2elumo;(4 ltrxr3oytlmtr nvo;s)t2toxm iy1om nmicsa()s2rmum ;t4oexn f3iadfm ran s u4tetoir3oadop ran olt0 eumim ou4omt livsl(f 2rm( o;u0tle  i3tytfa2ran o;u4 leoxf3oytoaD  u olt trtm(o3nodlmt mfesat  ruaum ou1tpeo i3tld m elumo ()tltnirciodlptr i i;s)srxrim3nydop emnct (fa2uaurp;u1tptnmf3tyd m2elnmo;t4 lxnmf3iytom eaueolt0 etoir oy4lpt lictl( a2rax ono0aee  fctasfa2emu p;t4tleoio iy1lmteai sls)s2xm(m ou1apee ietas s2tmur nu1aleoioetat s uanvs;t4 lxnir3tydfmtranvilt  rtmim3iodalenmnvsls)sDtmur ;t4aptomi3tadlm ul( s;u0arerxf3todlat an s t srur(r iydopte fvslt  rumx pot1ope iieias s ranvs u4arxoxf3ootfp elneo;(  2xrio nodap  mnvils  rrmum nu0tex mfeiltlaDrm( o (0trtnmfciadomte n i;t srtr(r3iudop nlnetlsfs2urxrooo0optnmoeiatla elnmp;(4aeeomocoytlaD lu i;t0 eum(opoudal emncs (  Dra( p;t1aetniictldfm2ranvo u0aetrio3oodfpDranvs t0s2xr(r ny4op nlfvsa(fa2uaump;t0optnmfciasla ranmp;(4trxrxr3tatomteauvo ( srtm(rpoo1ll e ivt ()a2taxroot4altn fetyt s umu snu0 reoir to1faDraiei;s0 ruoxm nu1al   fetl( srrm(m nu0texomfciyd m ua(vpnt0tltnmrcoodopte n s;s0trxrxm3nu1apee fciatf rta(root1tltnioeiysfm ra(vs;u0artrirctodfpt lieils0 2trirpno1op n ncta(f rur(mp;o0altnmf3iytla2ea( onu0tetnxr3ia1fat  n o;s  rtoxrpiu1ap nlnvs s  2ururonu0opxniieiys s2eaumo t4artoifctotlaD au s;s)texm(opiudal nlfci tf Dumu  nt4apen iciatls rmn s u4tlxoif oatfpDe ueols0s2toiopiu1om   ivsa() Dtmum ;o4oltnmociytfa2um( pnt)aetnxocootla  lnvs;s srum(rpnudlptn iet ()aDraumoou0tex mo3iltlmDemn o;(0aeeoir3ia1fa r nvi t setriopnu1ll n fvils)arrmxr ;o1aexo fetls a elu snt) rtoxo iodoa  lnesl(0teumim3iy4ll n fcsl(farum( pot1tpx iieils a2ea( o;u)texrmf3todfm   u ol( s2trxrpoodlm  mfcs sfs2rmxro;o0oex mfciltla2emums t0alxoir io1laDeln i s0trum(o3no4ap emfetls srtr(mont1oeeo f3iydfa ra(ms u)trerir3oodfm  lu i;( trxoir3iu4lm nlnvtl(fartau ont0tltoio3tad a rl(mp;()altrmf oydlat lu ilt0setrxo nudale lfesas a2trxm ot0teen i3iyslm2emuvo (4aetrxo3oadfmD aneols0t2trirpoy1ap  licia( srumu  nt1alt  ocilsls2eln snu) rxnifciydlm elnvi s)trum(o3iydoptnlncsasfsrtrx p;t0aexn ieilt sDuan pn(0teeomfcoy1fmt  i i t0 2ur(o3no1alenmnctas)srrru o;t0tlxnmfctyt a ra(mont4 etrioctytoatrlu olt  exo(opiudop   ivtas) Dtax o;o4alxo oeiasls eanvonu) lxnif3iydlpteai o;()srxo(o3iu4lpeemiciltf Dtax o;o4altomi3tldlaDeanvont) lxnmr3iadfpt anvo t0srtoirpiydap  lfvtlt s2trump;o4optoifciadfsDranmsnt)tetrmf tatlp eaieo ()t2um(r3io4am n fvtlsfarrmxm ou0tpe micilsfmDulnvs t4tltnif ty1opt anvolt0srxrxr3iy1ap elicsls)srtmumoot0oetnmo3tlt a2uanvsnt)altoxr3oy1opDeanesls0srxrim nu1lme lnvslsfsrtm(r nt0olx  oeiad aDulu p;u4trxnir todlpD lieilt srxoir3oudlp e ivt s  2ur(rpno1oex iiciysfa rluvo;t0tltoir tytfmDrln o;s0srxoxrpiu4ol   iei tfsrta(rp;u1aexn iciytfm rlnvo;(4aexniociotfaD aueils seuoxmpoodap elictasfa2rmxront0tex  f3iltfa ranmsnt
\ No newline at end of file
@@ -0,0 +1 @@
+uvsls0 2umxm iy4apee ivi (f rurur nu0tee mi3tydls2rlumon(4 exnmfcto1fptelueolt sexmirpiy1am  mnes tf 2trumonu0alxn feild sDrauvpn() lxnmr3oytlmD  u i s) exo(o3ou4amtn ieia()s2tmu pou4olxoiicils aDelu p;(0aeenxrctatfat  ivo;(  rxmxr oydop nmfvia( sDuru  nu1olen ociltla2ulums;t4 exrxoctatomDrluvo;()t2uoio3iy1ope mfei s)aDtmuro;o4opt moeiatfsDea(mon(0aexrmr3tytlmtr ueols srum(mpoy4ll  lieias) rtmur nu4apxoiietlslm2ranmp t0trermocio1oa raieolt0seur(opnu1ll  lnetat) Draxmpno0tltn f3iyd s2umnvsnu0trxoxr3io1faD  n slt0 2tmir3iu1lptemnvia()arrmxr nt4aee iieiltlm2rln p t4 lxrxo ty1fm  ai s;s) euoxrpiu4lm emfcsltfsrrauroot0oetnio3tatlaDea(mpn(0arxrxr oa1opt lnvol(0 etoimpno4altnlicsatfa2ua(roou4oet iociyt aDulnms () eenifcoydlatelu ilt  etmiopno1lmtn icsl(f Duaurpoo4aleomo3tldlm2rm( p;u4 etnxfcia1lmtelnvi;s0trtoir3ny1lltelivi sf 2rmx poo1tee  ietysla2uln sn() lxnif tadlat lnei t sexo(opio4apte fvias)a2uaum ;o1oetnio3tadlmDemu o;u0 rxrxrciydfmDelneol() etoxm oydlle livt ( arum(mo;o0alxoioeildfs2ran sn(0 lxomf totopD livs;()setoxr3nu4llenlnetasfa2raxrp;t1olxomfciadfs ul(vs t0 eeoif3iotomD aiesls teurim iu1optemivslsfsrrmum nu1tlt  oetls s umu s u)arxnxociotopt lnvs;t trtoxo ou1am   fei ( aDumu pou1oeeoio3ildlaDeau pnt)trtnio3iytfaDran o s0s2xoim3ou4ap nlnesa(  rrax o;u1opxnmietatla2rmn o;u) lxrxrcoo1fmD  nesl( setm(mpiudap n fvta(  2uaxro;o4tlenif3ias sDeln p u0alxoxo iodlp r ivs;( tetm(m iu4altnmfvs t) 2taxroou4tlen i3tldlmDuau s;(4 etnxo iy1fmteaieslt0srtm(r iodom nmiesas) 2raxr ou1aexnmfetls sDrm(mon(0 etnio oy1lmtrli ils  rumxo3nu1al emivt ()srrrx  nt4aeeoiieiyd s ean ont0tlxrmrcoa1fp eln i;t0setm(o oudam elfci t)aDur(r nu1aeeo ieildla emu s (0 rxnir3ta1oa e i o;(  2xoir oodoleelfvsas  rur(mpou1tpt moctldfsDeanvon(4 eerifctytfmt  nvolt  rxo(r3nydaptn fes t a2uaxmo;u4olen iciasfs rluvont0 lxoxr3iatoatelu s;t)sexoimpio4oltn fvi ( s2raxm ;u4opeoiiciasfa2ua( o;u4treoxrctodlp   uvol(0truoxrpiodamenlfcs s) rtmump;u4opt  ociysfmDea(vo;() reoxo3tatlat  n ilt  rtrxr3oydlmtn netatfs2rm(roou1alt  ictldfm rlumo u)tlxoxr3ia1lpte ues t teuoimpiydll emnciat a2rru pnt1opxn o3ilsfm2rluvon(0trenio oydop elieo;() rxrir iu4amee ncsa(fsrra( poo1apxo ieiytfa ulu p u4artrmf3ty1oa elnvols0 rtmio3iodol elivta()a2rrxm ;u0olto iciad m rl(ms;t0trxrif to1lp eluvsl(0 rtrio oudlpt miesat)srraxr ;o4opt  ieiytfmDranmo t)aetnxrcoy1oa rlnvo;s sruoio iodlm nmieias)aDtrum ou1apxn oeiltls2eauvo;()arerxo3tatopteln sls)trurxr3iudamenlieslsfa2tr(rp;u4teenmictadfaDumumo u4arxnif iadfpt ai i t) rumxopiydlmtnlneilsfsDur(mono1aex mf3iasfmDrlnvs;t)trxrio3iydfm r ivslt0trxrimpiy1oleemictls)aDtmu o;u1texn o3tldfsDuauvp;t0trxnxr oadoatran s;s)setoir3no1lp nliet (fa2ur(  ;o0aetnioeiltfs2ea(vo t4trenio iadop  lueslt0 2uoxo io1ame  iet t sDra(mpou1ale mieiysfsDean p (4altrifciatomtrlnes;t0 2tmir3nu1aleelieil(f 2tr(  nu4oetnmfeiytla2emnms;t)aetoio tatfpD  u sls0teumxrpnydll emfvsatfa2raxrpoo1ape if3tldfa2rl(vo u0 rxomfcio1fateanvo;t0seumimpoo4olenmivtls)sDta(  ou1tpxo ictlt m eanvp;(4altnmo3iydfpteluvi;t)seurxmpiudap nlfvta()sDtr(mpnt4aetniociaslsDemnmsnt)teeomo3iy1om  anei t  rtrim iudllte fei t artaump;u1oex if3tat a2umuvo (0tetnif ty1fmt livs;s0s2uoim nu1ameemnetat)sDtaxr ou1alt mi3tldla rmn o;t)tetrif iadlmtran s;t) 2xr(o3iydam nlics (f 2uaxmo;t0teeoiocias m2rmn snt0 exrifcoo1faDeanei (  2toxr nu4oleelfcilt srtau  ;t4tptnioeiltla uan p u4aetrir iydlm eanvo (0srto(r ou4opeemfct (faDrmumpnt1ape  feiydfa em( p (4texoiocio1oa  aueo;( s2trxo oo1omtelivtasfs2tm(mpou1tltniiciytfm2rm(vo (4artomr ootom elnvo;s s2xo(rpny1ll nmnct ( sDumxrpou0tlenmoctltfs2uln o;t) lxriociodlatrlueols0srxo(opnodopenlici sfs2uru  ;o1aeen fciad a rlumo;t4 lermo3tytfmtrau i;(  rurxr iu1lm n ncil(  rtr(r ;u1olenmi3iatfm2emump u) rtrxociodlp r u i;s srxrir3oy4lltemfciltf rtmum ;o1alx mi3iadls2rm(ms u0tltnmf oa1lpt auvi s0 rtoxmpiu1apeelfctls) rrau  nt4tltnio3ilt mDeanmp;(4 etrifciotfmt luvo;s  2xoirpnu4ome lfesa(  rtaumo;u1aptoio3iys a ulnmont)artnxr3iotomD livi t  2tmir ny4lmtnmict ( aDta(mo;t0aexoii3iltla2um(vs;t0teerxf oytlmte u slt) rtrxr iu4om   ictas a2taxr nt0texn ocilt a um( ont) exnxo iodoaDr nvsls)t2tmirpiodape mivsls)a2ururono0tee  fciaslm2ea(mon(0aexnmo3iydlm eanes;s0 rtr(o no1om nlict t)arrm(mp;t4oexoiicildfsDemnvp t0 eeoioctatlptrai s;()s2ur(m iy4omt  fctl(fs2urxmo;t1oexomi3ilsla eluvo;()trenif3ty1lmDr uvs;t0 2trxmpiy4op nlnvtl(fsDum( oou0tlxo fciatfm2ran p;() ltrif3oa1la  lnvi t  2umxr3nu1oltn nvta( artmump;u1aeeoioetls s2rmump;(4trenircto1lmDe uvil( trtoxrpno4oltemnet t s2tm(mpno4apto oeiad a2ulu o;(0teeomf3oydfatrli i;s trxoxm3oo4alt  ies sfsDuau pnt4tptoiietysfsDua(vp u0texnxo totopD livi;t)teur(m3ou1alee ivta()sDurx  ;t0alt  o3ildlm2umu p u) lxomocoytlpDe ivs;t0 rtm(rpno1op nlfcias sDrrxmp;u1alx io3iys sDrm(vs;u4tlxomrcoa1oaDelu i;s0srxmxo no1lpeelnvt ( sDuaumpnt1aexnmfeild m ul( s t)texrifciotla rli o ()trxoxr3nydoleemnvs t aDrax ooo0oee mfciatfa2ea(vp (4artnmo3oa1oaDr ivsl( s2umxopny1olt lnvi t  Dum(mp;t0aetn o3tad a eanms;u4arxrif3iodopD livolt)texmio3oy1omt  ncs tfsrum(rp;o0aptomiciad sDrmuvsn(4trtoxrctotfmtraivo (0sexm(rpiu4oltnlicils)artr(moou1aptn ieildlm2umn o u)trerxf todlpD ln i t  euo(m oo4lm nlies (  2tm(rooo1apt micils m umuvs t4altnxo3iodlm  auei;( sexmxm iy1aptelivils arta(r ;u1oet ioeiatla2elu s;(0arxnio oy1op  luvsl()t2uoimpny4olee fct ( arrmumpot1tptnifciyd aDrmn s t0tleoxociydop   ivo;()trxmxo3oo1ope  ietas)srurxrp;o4tleoifctaslmDemnvs;t0aetomfciotop   i s s s2urxo3nu1lme lies t) rrmuro;t0oltnmf3ilsfs2rl(vo (4tlxnifcoatlmDr ivo;()teuo(m nu1altnlicil()aDumxroou1opeomoeias m2emuvs;u)alerxr totlpDraiei (0t2xmiopoodapen iei ()sDrmx  ;u4opxo ietys mDua( snt4aexnmfcio1oat auei;(0 ruo(m ou4olenlfvsas a2raxro;t0tpx  oeiatlaDuanvs t0tltnmocoy1oate u s;s0 etrxopny4op e nvtls artru o;o1tlxoifeiatfsDrluvpn(0 lermf oy1fm eai i t t2tm(r oy4altnmnvsa()srur(  ot4alx mfciatlm2umumsnt)trerif3oatlpD anvs;s s2umxmpny4omeelnvi tfarrrxm ot1oee  i3tydfsDuln p;u) lenxfcoy1faDr neils0teurirpiudom emfes t s2umumo;o1alxomfeiltfa2ulu sn(0 lxoir3iodom raneo t srxrxr3iydoltn ieslsf Draxr ;o0ape  o3iys m2umump;t4 exnmf3iodla e u s;( trxr(rpiudlpt lfei s) Dra(ro;u1oet mf3tltla rmuvsnu0tlenif3ta1oaD ln o ()seumirpou1omee icias aDrm(root4teenii3iys a eauvs () rtoxfctodfm  lneilt0sexoio iu4ap  mfesl(fa2um(mont4apeo oetlsls2ranmpnt0tltnxr3oytlpDrlu sls) 2um(o3oy1lltn nvta(fsrrax  ot1openmo3iadfa uaump;(4artnir io1lptran s;s0s2umim3oo4lm  mivs ()a2tmxr ou0oex  f3ils s umnmsn(0 rtoircoa1lm   uvi;(  2trim oy1op  micia(f 2uauroot1oexn feiydlm rm(ms ()tlerxr3iatfmDe n sls0teuoio nudape lnviat  2um(mpou0oee mo3iysfsDemuvpnt4trtoir3to1om rlieo t0 rtmir3io1op e ieilt)srrru pnt0ole miciys s2ul(vs;u0tetoif iydlpt  u o;t) 2xoxo3ou1apte icilt  Dtaum nt1tpx  o3iad a ranmp () rtoirctydomt  n s ( s2trxm nu1alee ncils) Dum(mo;o0tetn oeias s2rl( pnt4aetrir3todlmtr n o s)trtmxmpno4amtelnvs s)aDtaum ot1tpe  octldfa rlumsnt)tetoir3tydomte ies () rum(rpou1ape lfviltfaDua(ro;t4teeomictlslm2elu o u4 eenirciotlpDeau ols)srxr(m oy1lmt mnvsat a2rmu p;u0aet  ieilt s2ul(mp;()alxnio3iotfpDrli o;s0 2tmxm3io4ll emictasfs2trumpot1alxn oeilt a rlnvo t)teeoir oodfaDrlu slt  eto(r oy1ope  fvtat)a2rr( o;o1altomiciltlaDemuvpnt0altrir iydoat aneo (  rtmio nodllt mfetlt aDtrum ;u0oexoii3iltla rluvs u)alxnio oytfpD aieols  2tm(opnu4apt lnciltfsrrrx  nu1optnio3tld aDuauvo;(4 ltoxrcia1fp   uei s  ruo(m3iy1lm  lnctltfa2urx  nt0opxomoetldls ulnvp t4tlxrxoctydfate i sl(0srxrir io4lm n fctl() rra( ooo1ale iietlt m ua(vo (4trtnmocoy1lpt  nvslt  eurim iu1lltn ncslsf rrmump;u4oexomo3iys s2rl(ms (4tltrmo iytfa e n i;() exmir oy4ll   fesat) Drrxront4oetnmoetlt sDrmnvsnu0 reomo tydlmD lnvil(0 2to(rpoydolte fetl( sDta(mont4tlt mictatfa2ra(monu4trtrxf3io1faD ln s;t0 2toxopiu1op nmnesltf 2rmx o;t0apxomietat mDrlums (4 rerir3iotfa r ieo;s texo(o3iydll nmneta(fsrtrumpoo1tetomi3taslsDumnvsn(0 lenxocia1la rluei s trtrxrpnu4omt lics (fsDtrxmo;t0oetnio3iysfa2emu o;t) reomr3tadomDrluvi;s) rurim ou1lptemivta( arrau  nt4tlxnmfetldfm umuvp u)altrmoctatfat auvs;s)trxoim ou1op nlfvil(fa2ur(m ot4apxo ocilsls2uan o;(4artrmrciydla e uvols0seurxmpoodap  mietlt)artr(m ou0tpt  oetadfa2uan o u)texomrciatlm rauvslt) 2trir3oy4amee ivsat sDuax o;o1tlxn fetaslm rau s;u)aeerxrcootlaDe ivil()t2urio iudol e ivtat sDtr(  ot1apxomociaslaDrm(vsnu)alerxrcta1omtr n s;s  rurxr ou1omenmfes (fsrrmx  oo0opxnmfciysls el(vo;(4tlxoxo ta1opt aneol()srtoim iu4op n ics tfsDtmxm nt4apxniociytfm2um(ms;(4 rtoxr io1lm  auvs ( trtrxr3oo4lp  lieiatfaDtmx ont1openmi3tlt a emuvpn()trxrxr3tytfmDe nvolt  rto(rpiodope lnvs (  2trxrono1oetnii3iaslm eanvp;u)trtrxr3oy1fpDraueslt0 rto(r iu4lme mfvtas a2urxrpou4texnif3tltls rlnmp;u)aexomoctadlp e nvi;t0t2urxo3oy4omeelnvsat a2tmx  ot0apxn oeiatfm2umnmp;()alenircootlpDe u ols) 2umio3iu1optn fvia( arrax p;u4tptn ictltfa2rlnvo;(4alenmo3io1lpt au i;s t2tmxm oodll nmnet ( sDtax o;o1texo fciadls rm(mo u)aexrxo todfp e ies ( srtoir3nu1oltn neiat  Dtrumpno0aleoif3iasfm elumonu)aeenioctotfp e u s ( s2xo(m3oy1om emivias)aDrr(ro;t0ole mfeiadfmDumuvon()tetrxrciadlptr ivs;t)t2uoxm3nodlme lietl(faDra( oou1teenmi3tytlaDum( s ()aexrifctadfptr n olt0trurio nu4op  lneilsfsrua(m nu4aet  f3iatls2um(vp t)teerxr3tadfptr uei;(0texmxo3iu1ll   net tfaDtmx pnt1oexnmfetysfa2emnvont4teermrcoatfp   u o;( srxrxo nodal   fvia(f rtm(rpno4apxoifctadls rmnmp t4aetoio ta1omD au s;t tetrxr3ny1olenmnci tf 2uru pno4optn o3iytfm elnmo u)aeenifcio1fm eau i;(  2xoxmpio4am   icsls sDtmurp;u1tpxoii3iat m2ul(vonu4aetoxf tadlaDrluei;s0 2toir nu4lmtemfeslt)arurx  ;o1tee mi3iltfa el(vont) etnmfctydopDranes s sexmio iy4om nlnvi t)aDur( onu1olx io3iyd m emn p;u0trxrxr3iadlaDeln o ()teto(o nu1ope mnct s  Dtau o;t4aetn icils a2eauvp;t) exrircoy1la elueol(0tetoir3io1ale lieilt  rtru  ;u4oexomo3iyt s elumo (4artnxf ta1fptraueolt  2xr(r3ou4apt  ncta(  Drm(m ;u4olxn o3ilt a elnmsnu)tlerircia1fmtrauvi s s2xr(opio4alenlicil( sDurxrooo1tpeomi3tad aDuluvsn(0trenir oo1lmte u il( srtrimpno4olte fesl(fartr(m ;t4tetomoeilsfm umu s;t4 etomfcty1la r n i;s  exo(rpiydole mncsat  rrmump;o1opx micils sDea(mo t4 rtnxrcoadlmDr ivi;(0trtrxr oy1ap  lncsatf 2umxmoou4opxnif3tyt s2rau o t)tltnif todlmD an i;t  exr(o3nodomt  iet t) rtmum ;o4ole  o3iltfm2um(vs;t)tltrmf3totfp rlieils tetoir3oudlltn nctl()arurxr nt0oee if3ilsfmDelu o;()aetnxfciadlm   u o s0srxoirpiydol e fci tfsDururpou0tpxnmo3ils a2ranvsn()aetrif3iy1lp  lu ols) etr(r3nu1lme  ncsltf Dtaumooo1tltniictaslaDulnvp;u0 exnif3oa1fpte neils0teuo(r3iu1lltelnesl()aDum(m oo0apxnmf3tldla2ean o;u4alerxf3tydfp elies t) 2trio oydamt  ieil()arur(  ;u1oltnmictys sDulnmo;(0aetoxr3ty1lpteluvil()s2tm(o3no1ale lfcsls sDtrxr ;u4aex  ociydlm ea(vo;t0trxnxrciodomD liei t)trtr(mpno1lmt mfcia()srtru pnu4ope mi3iad s2rmu pnt)aexoxo iytopD aneo ( t2trxm3io4olenlncsl(f rum( pnt0tpxo feiltfa2uau pn(0trerir tydfmD  i il(0 rxrxmpoy4ll   feias s2uru  ;u1aex  icils mDel( onu4arerir3iydlatr i o;t)trtrim3oy1ale  fetlt) 2rauroot1olt  o3ild m2uluvont0tlxoxrcty1fmDe ueslt trtr(m3nydaptelivslsfaDtmxrpnt4opeoioeiadfm rau p u) eenxo3oa1omDean o;s)trumimpoy1lp  livtlt sruru ooo4oltnifciys a rmnms;(4altnmo3oo1fateaivols  exm(r oo4lltnmiciat srtrxmpoo0tlx  i3ildfs uluvs t)aeeoio ia1fmD  nesl() etrxmpiu4oleelfvs s)s2ur(m ot1apt mi3iasfaDua( p;(0 rerir3oodlpteaiei t s2xo(o oydopen net t arurur ;o1opxnmfciatla2ranmo u4texnxfcoo1faDelues (0sexmim3iy1opt lncil() 2tmxmoou0aexnmf3ilslsDuln ont4 ltoiocoodfaDrauvo t) rtr(o oo1alen nviat aDrax o;t1aetomf3tas a2eau p u4tlerxfctadoptran sls)t2xmxo oodapenlncsl(  rrmx  ou0tetnifetysla uluvs;u0 lenmr oydoa ean i t)sexrim3oy1apenmnvt s) rrr(r no4opxn fctadfa umnmonu0 etomr3totlm rluvi ()trtoxr nudaptemfvsl(  2tm(  nt4aet  ociyd sDua( s;t0teenio io1fa  luvolt  rtm(mpiudopt  icta(f 2rmxmpou0opt  fcilslmDumnvpn()texoxocoydopD au s;( s2um(opiu4lpe livtlt) Drau  ot1olt mf3tld a2eluvon(4artrmf3iydfmDrluvo (  rurxo3io4oltnlfcsl(fartmxro;o0ole  o3ias s2rln o t0aexnifcoa1omtrauvs t0t2trxo3nu1oltelfvsas) rtmum ;t4aetniiciltlm2rau pnu4 exoxfcty1fmD auvs s texm(o3oo4oltelfet ( artmxmpoo1tleo oetatfaDel(vp;(4arxnxf3iy1latr uvs t0srtmxm iy1lmte nvt ( aDrrum ot1teeoifeiltfa2el(mo;t0aeenmo ty1opD  i s;t) etmio3oy4om e ivsl( sDtmxmono4texo f3iysfs ean s;u)artomo ty1fp  lu i t0setoxopiydap e fvtl(f rtmxrpot1alxoifcildls2ea( o (4artoxr3ootlaD lnvo;(  2xo(rpoudolen fvtltfsDra(m ;t1tpxnmo3iytfm emnvp;(0altnxr3iadla  aneols) exo(r no1olt  ivias)a2taxmoou1ale  i3tyslm2umumo;u0 lxnxoctadfa r uvol()trtrxopiydll  lfei t)s2trxroou0aleomi3iltla2ea( s;t0aexrxo3tatoateauei;( texmxo3ny4lpe lfes s) 2umxr ;u0apeo i3iyt a2emuvo;t) eermr3iytlatelneo;t) 2toxr3ny1om n netlsf 2umurooo4tleo iciltfa rlnmsn(4 rtrio iydlp   uvi t) eumxo3iu1lleemneiat)arta( oot1tltnmfciatla ranmp;u4 lxoxf3oadomDrluvslt0tetriopnu1lp  mfeslsf 2ur(mo;o4tpt mfeildfa rluvon()alxrmf todlpD auvi ( setmio3no4lmt licsls)aDtr(mpot4aeeoio3ilt mDrlu p t4tlxoif3iodom rlnei s)t2ur(mpnu1al nmies t)aDum(mpno0tptoif3iaslm2ulnmonu)trerio3iodfaD auvol(0 2xoir iodlmeemfeta(fs2rru  ;o4alx mf3iytfs el( o t4alxoif tatfm elu o;(  rxm(rpoo4lpte fei sfaDra( pot0oee mi3iad a ul(ms;(0 lxomr3tadlp  li s ( s2xr(rpnu4om  mfvilsf Dra(m ot0tpxnmfeiat m2emn snu4 renxfciadfat ai o;(  rtr(r io1altemncs tfsDtmumpno1apt iictas aDuan o;(0 etoxrcoydoaDrai o s)tetm(mpiu4amt lnvtatfsDtrxr ot4ape moetas a ra( s (0aexriocoytopDe nvi s sruoxr nu1lmte fvsasfsrurxmp;o1apenioetytfs2uaums t4alerxr3oatlaD li s;t) 2xo(m oy4omt mici t)aDumxr nu1optn f3tys m uanmo u4teeoif3iy1fm e ues;s) etoio3nodamee ies s) 2rm( ooo1tpe mo3iatfsDuanms u4 rtrxfctadom rau s;t0texr(o3oodop nlfcil(fa2uaxm nu1oeto ieildlaDumnmp t0texoxo oadoatrln o t0teumxo3iydlm elivt s) 2tm(  nu4tpx mfeild mDra(vs;()areoif3oo1oate iei () rtoiopoy1om nlfeta(farraxrono0oetnio3iltfs2ul(vs u0 rxnxf ootfatrauvsl(0 exo(r ny4aptemnvs (farrmxmoot1texnmociaslm raumpnu) lerio3tatoptraues;t) rxr(mpiu1lmtnlfci ( srrmxront4tet  oeiyt a eln snt4teeoircoy1fat  nvslt t2umir iy4lpeelietlsfa2urumpou4aetn icilt m elnvo () ltoxr ia1lm r uvs t0 rtmxo ou4omt mnesas aDtm(root0tlt mi3ildls rlums (4trxoir3ta1omDraies s srumirpio1lm e fvsl()aDtm(rp;t1aptnifeiad s elumpn(0arerxr3ia1omD li o;(0 euoxm oy1am  lncsl(  Dtr(rono0aptomo3tls mDul( pnt)teerxfcoydlaD  ieo;( setm(mpio1ol  lfetat arur(r ou0oleniieilsfm2ea(vo;(4 rxoif io1om  aivi;(0s2toio nudamenmfciltfarra(mo;u1aetomo3tasfs eanmsn(0 rxoxo3oytla  ln ilt0truo(r3iu1ol n ivt (fsrururoou4teto feiasls eaump u0 ltoif3iadoat auvo;s0setoxo iu4lltnlfviasfsDrmxmpnu0olenmociydfaDum(ms;u)arxnif3oodlmDran s;s0tetm(r3ny1llt mnci t)sDraxroot0altnmoctld s2rmnvo ()tetrmr3to1fp e uei;( s2xoxmpoo1lm emfvtas)sDurxmpou1teenifeiltfm2umuvs;t0arenir3oo1lpD an slt0 exoxm3oy1amenlnes tf Dtrurp;o0olxnmieiytls uanvp;t) lerxociydlatelnvs (  etm(r iydopee fvt t  2rrx p;o4tpx  o3tys sDrlums u)alxomo3oo1fa rln ols trxo(r no1omen fvi sf rrm(mpnu0ale mfeild mDrlnmo;u0alxnxo iydfmD ai i (0s2tr(o oo1optelicsa()srtrumooo1tltoioctasfs emu s t0 eermo oytoaD an o t0 euoxo oy4ale  fctas)a2tr(mpno1alx  f3tad s2ra( s;t4tleoio3oytfaD  neo s0t2urxo nu1lm n fci (f 2rr(m ot4alx mi3iytlsDemuvs u0tltrifciytlat au i;t  exr(mpoudll emncs tfaDtmumont1alto oeiat mDelnms (4tlermf3oadfm   iei ( texmim nudlpeemietas  Duaurpou4oet ifetltfa ulnmp u)tetomo to1lat aiesl(0srtm(m3nu1alenlnvtls)aDtaxmp;o0oex micild a emump;t0 etrirctatfa e n sls)srtrxmpoodopenlivsasfaDtm(mpnt1open ietaslm2ea(vs t4 etnir3oatoaDe n i s0 eumxr oudoltnmiesasf rtrx  ot0oex if3tltfs2rluvsnu0 etrmo3totfpDr uvi;s0srtmir3oo4lltnmnvtl(  Dtr(mpnu4opxnii3tas sDel(mon(0aeeomocia1fpDrlueolt0t2trio iu1llen nei tfarrmumoot4apt ifetatla eln s t) eerxrciatomD aneo;()trtrxm3io4apeelnvsas  Dtrumooo1opeomfeilt m2raumo;(4 reoif3iotlaD ai s;s) exrxmpnydop e ivs s arraurpno4aeen o3iyd s2umnvs;() rtnio3totla rlues;t tetmxopno1op n feslsfs2um(m ou4aleo ociyd a2em(vo;() etnxrcoa1lm r nvi;s) 2toir oo1am  lnvil()aDuaxmo;o4altomoeiatlm el( snu0tetnmo io1fmDeluvo ()s2toxo io4apeemfvils sDrax ont0tet iieiadls rlnvp;t0aetomfcty1fm  ai slt0srxr(r3oo1lm emfeiat s2uau pnt0opeoifeiltfs em( s;t4arenxr to1fp eau slt s2umio iydll  mieias) rtrxm ;t4oleomi3iysfaDulnmo;(0tlxoxrctatlpDean s;s)trto(mpio4ol   feslt aDtmur nu4olxn f3iadfs rmumsn(0trxnmocoadoptrlieo (0srxmxo3io4ap   nctlt  rumump;o4apxoio3tadla2ulumo;()tltnmfctatoaDrluvsl()t2xr(mpiy4omtn ncias  Dtmur ;t4tle ioctas mDum(vo (4alxrmo3oy1omtr ieo;s t2trxmpoy1llte fvsatfaDraxmpot0olxnifciasls ranmsn() rtrif iodomt lneo;(  2tm(mpoo1ap elfvtasf Dum(mo;o0tlxnmiciad m rlumsn(0alerir3oatoat  uvs;s)srumxo no1al nlnvilsf rtmx  no1oeto i3iasfs2rm( s;(4texnmo3oa1oatrauvi;t) rxriopno1omenmncils sruax o;t0apx io3ildls umu snu0texnmr iytfmteauvslt)texo(o iy1ll   ncs ( a2raumpnt0tptn icildlmDumnmp;() etrxr3oatlp  an ol() 2xoxo io4alt mnvslsfsrtr(m ;u4aexo ociyt m um(vo;u0 eeoiocoatlp   neslt0tetoim iydlmt miesas  Dtr(m nu1olxoio3iltfsDel( p (0 rxoir3iy1lpDelies;t0t2um(r oo4omenmivtlt)srrrxmpoo4apto oeiytls uan o;u4tltrmf oodfp   ivi;s0 2tm(r no1lmt  nvsls)a2tmu pot4tpeo fctad mDua(von(4teeomf3oatla eanes;( s2to(opnu4lmtemfetasfa2tm(m nt0apt ifctysfsDulnvs u4 eeoio oa1fm   u s s0srxmim ny4apt  ietlt)sDtmx o;o0tpe mfctyt sDrmumonu4 rtnmf3tydlaDelues;s0s2toxrpnu4amtn nes t)s2rrum ;u0alxnmoeiltfs2emn o (4altrmociodopD an ol(0t2xmxr iydamenmnct ()s2urum ;o1texoifetlt s ul(vp;u) exoxo3oadfat lnvo;t)t2tmir no1lmenlnctl()aDtaxrpnu4tle  icild m2uln s t)arxnxo3iadlm rlivo () euriopnudol e feia() Drmu pnu4tlxnifetyt mDraums t0aetrmrcoydfpDeaues;(0seur(rpny1altnmivta( a2rru ono4olx  fcilt sDuaumpn(4 ltrif3tatfmDraneo;s) 2xm(rpoy1amen nesls arurx  nt0tleoifciadla2eluvo;u) eeoifcta1fmtran ils)srtoxo no4ale livtl(fsrtauro;t4oex  octydfmDuanvs u) lxrxo iydfm ran olt0teurir ny4apen iesat)arra(mpnt1aexo oeils a2em( p;()trtrio oy1fpD lu i;(  ruoxo3iodlmeeliet s  Drrx poo0tpenii3tls m2ra( o;(4 ltrmrctotfm ranes (0 eurxrpny1apeemivs sf Duru  oo1alx mo3tltls rm( o;u4artoifcoatopD  u sls0srum(r nu1oltnmfvsl(f Dum( onu1oexo f3iyslmDeaump (4aexnir3io1oa  livil() rtr(r oydap elnvtatfarumump;u0tltoii3iad m2ea(ms t0 eermfcto1omt li s s0s2trxr io4lmt lfei (  Drau pou1tptnifctyt sDra( p;t0alxnmfciodla rln ilt trum(m oydol elicta(fs2rmuro;u4ole mo3iytfa el(vs u)teeoif3tatlmtr u ils)setoim ou1op   fvi s aDtr(  ;u1opxoifeild a2ul(vsnu)aetrxfciadfpDe uvsl()tetrir no1lmt lnviat)arrrx  no1tlxniieildlaDuln snu) rtrxf tadlm rlieil(0trtmxrpoo4olt  ncil()s2rrxr oo1apenmociatfs emuvp;t4tlenio iadfp rau s ()s2uoim3nu1llen nctat srraurpnt4aptomieiysfs2ra( s;t0tltrio iytop rai o;s)texriopiodlpt licil( a2rmu  nt4opto o3ias a2eln sn()teenmf oodfm ran s;s srurxm3ou4lmee fet s s2rmum nu4opt mictyt a2el(vp;(0 rxoir3iodfpDrln o t0 rtrxr oo1op emivs s)arrruronu4apt mi3iatlmDuau o;t0 rxrif3oydfaDr uvo t0 rurxm oo1olt lnetlsf Drm( pnu1tlxnmi3iltfa2rauvp;u0tlenxr tatomt  neilt t2uoxm3iydalt lietat)s2tmxrp;u0apenmo3ias s2eanvon(0 rtoxf oa1latrlu sls0trxoxopiodalenmiesatfsDumu oot0tpx ifciytfsDeln snu0 lxrmf3iotfaDraues;()srxo(o3oydllee ieslt  Drrur nu0ope mociyslsDeaumsnu0arenmr to1oat aieo;t0 rxoxr nudopenlnet tfsrtm(rpnu0tetn oeiyt m2rl(ms;u)aexoxr3oytfat luvs;() exo(o iu4alenlics s)a2rrx  ot4aetnmieiaslmDua(vs (0 renxr3ia1oa eaivs;( t2xmir ou1omtemnvs ()a2rmxmpot0tlt mfctls s rm( p;u) etomr3to1fmDran o t0srtmxmpiy4lmen ncslt srtmxm ;t4tpx  i3ilt a2raumo u4treomo ta1oateaneo;t trtmirpiydlltelivt t) Duru o;o1aee if3iad s2ra( p u4trtrxr tytfaD aueo ()trurio3no4ap nmivtls)arrr(r ;t4aleniociyt a2emnvsnu)treoxrciodlp eanvi ()texo(r ny1lmt mnci s srurxmp;u1tleniicilslm2um(vp u4tlxrmr3ootla rlieilt0 rtrio3ny1am  lici sf 2urum ;u1alxomf3iytla emnvpn()trxrir iydoptr uvo;s)s2xo(m3oo1ol nmivils sDrax poo4aptnmictld s2eln s u4aleoxfciytfp rln o;s0 2triopnudomt mnvs () rrru  ot1oleo i3iadfsDem(mp;t)aeenxo ta1oa rau i;() rur(mpny4op  lnes tf Drrxro;u1tltnii3iaslsDumnmo;t) etoxo oadoptr ivils0s2xoxm3oo4op emfesas s2trumo;o1alxo ictas aDrl( sn()texnxrciadfm rli o;t) etrxr iu1ll  micil() Dtrxrooo0tpen o3iat s ua(vs u)tlerxrctytlpD  neo t)seurir no1amte net t)sDum(r ;t1open fciytlm elnmo t) lxrmf3tydlp r i o s teumir3iu1lmtn ieia( aDum(mpno1opxoiieilt sDranvpnt)tlxomrcoo1la  luei;t) etrimpny4ol  mfcs t a2taurp;t0oltn i3iadla elu o u0 rxniociy1lmD li ols0t2umirpno1lp n nctlt)a2tax  nu4alt  ieils a2rau o u)texrmr3iodfmDr u i t0s2tm(opoudape mneiat  2urxrp;o4opx moeiatlm uaums u0 rxoifctydlpt luvo (  euoim io1am n fes () rta(ro;o4ape  ietlt m2uan sn(4 exrio io1lpDrlivolt0 2tmir3io4alenlfvsasf Dum(m no4oetnioeiad a2uanvsn(4trxomr3tydfpD anvs;s0t2tmiopio4lmenmieils)aDumx p;u0aex mfeiydlm2emuvp;t)tleoifcio1lpDran ol(0t2tmxm io4aptn nei sf rraumpot0tpxomo3iyslsDum( pnt0tlerir oy1oaDelnvsl(0trxr(r3ou4altnlnetl( a2rr( o;t1tee io3tlsfs2raumpn()arenir tatoptean o ( sexoimpno4amtn iesa()srrrxrp;t1alxnmoeiadls2rlump;(0trerxo oytfateaieilt tetriopnu4om  lncil()aDraxmont1alx iicildfs rau s;t4arxrxf3oa1optrlivi;s seurio3iydam nmnetl(  Dumuro;o0aetnmfctldfm rlums ()treoif tatomDr n il() rxmirpio4oltemiesatf rrrurp;t0oee  iciatlm ulumo t) lenxocoa1om  li s (0sexo(m nodoptnmietls  Dra(moou1tlt mociatfmDea( o t0 eeoir iodfmD aneil(  2ur(rpoydlpeelfvi sfs2umu pno0tet moetadfmDrmu p;t0artnmr oatlmDrliei t)tetoxo oy4lm n feta()sDtmxmp;o1ape moetltfa2ea(mp;u4trtrmo3iadlpD aivil(0t2tr(r oy4lp nlncias) 2umx  ;o4tlto feiatla rl( s u4 exnxo3iy1omtr n i;s0sexoxr nu1ll n icia(f Dua(m ;o4altnmfciad a elnvpn(0 leomr3oytfpDrauvi;s s2xo(m nodlmenmfcsl( aDrruroou1alx  o3iyd mDuau o u4 rxoxf3oo1omtrlueo;(0 exmir3nodaltnmivt s  Dumumpnu0olxo i3ildlmDul( s t)tltrmoctadfpDeauvi ( srum(o ou1ol emncta()a2uau oot0aetoii3ildfa2eau s t4arxrxo ia1fmD anes s0 rtrirpoy4llt lieta()srurumoou4teto o3iadfs2ran o ()altnio tatoaD  ues;t)trxmxo3iu1om e ies tfsDrm(rpnu0apx  octytlmDrl(vo t)aeermfciatfm eanvo;t trxrimpiu4lmtemictlt)sDrrurpnt4alxoioetaslsDrl( snu4tltnmf3iatlmt  ivi;(0srtrxm nu1omtnmivtls) Dua(roou0olt mfctyd sDelnvs u4alxnio3oa1fpDeanei (0sruoim oodlmtelfctl(farrr( o;u4tptn f3tldla ulu pnt4 lerxocoo1opt aivi;s  2toxr3iudap e nes sf rumumoot0opxo ieiytls rl( p (4 reomr3tatop eaieols  2tr(o nudal e nci s)s2ur(mp;u4olxnmo3iad a eanvpnt0 lxrio3oodlat anvi t)t2xoirpoodlpeemnet (f Dtmx  ;u4ale miciasfa2el(msnt)aeerir ia1omDeaivi;(  ruoxm nodlltn ivi (fs2rrx  oo4aexnmociatlmDuanmp;t4alxrmr tydop rlueil() rtm(m oy1apt mfesls) Drmurpoo1oeto ocildlm2em( pnt0 rxnmf3totoatrln ilt trurxm iy1omen nesasfsrtr(m nt0tpt  fciys sDuauvo;t) exoxo to1op rlu o;t) 2xrxrpnydop  mncil( a2ra(mo;t0apxn o3tytfa2emnvp;u4trerxr3oytfat  i s;(0seuo(m3nu1olen ivilsfaDumurp;u4oetomieiadla2rlnmpnt0aexnif ootopte iei;t s2tmxo iy1llen iei s s2tr(ro;t0aleoiieiydls rauvont0 ltnxoctatlmtr nei s) etrim3oo4lmtnlfcil(fs2ua( p;o4aex  i3iytfs uluvsnt4tlerxo oodop e uvi t0t2ur(o3oo4oltemnvsl(fs2rmum ot1tpxnmf3ild sDra( o (0areomf3ta1opDe neo;s)srxmim3oydomen fvi sfsrraurpou4aex  fctyslaDumnms;t)arermfcoa1fm  li ols0 eumxo3io1lpt mfei tf rururo;t1aee  i3tltlmDranvo u4artrmo3oodlmtrlivils)teuoir oo4lpt lietas)sDrmumpnt4tex mfeiaslaDrl( p t4aetrmfciatfp  lnvs;()t2xoimpio1lpee fcsatfaDtau ono1tptniictltlsDelums ()tltnirciytlm rlu sl(0trxoim nu4ape  netat a2tr( pou0ape moctatfa2ean s t0artnxo3iytoat lueslt)srxr(mpnudop nmfvsa() 2tru  ou1teeo fciys m rmu p u)tetoxociydlpD luvi s)setr(o3ou4lmt mivs ( a2umxrp;u0alxo fctls a eln pnt4trenifctotlaDran s ( truoir no1op emnetls  2umxm ou0oeenmfetldls uln p;(4aetrio3todoa r ueolt srtmimpno4lptnmneslt) 2urx pou1ope  f3ild m2ra(vp;t0 renmo ta1fmDeaivol(0srtmimpou4olt licilt)aDtaumont1oexomictydlsDeau sn(0texoioctodlp eanvo ( srurxo nydalt mfcsa()s2rm( pno0tlx ioetadfsDel(mont)aetrio oytfpD  ivs;t)teuoxr3ou1lmte fei t s2tr( pnt1altnmf3iasfmDuanvon(4tlxnxf totlat luvs ( seurirpoydaleelictl( artaum nu0tltnio3tytfsDrm(vp (4 lerioctotlmDeluesls) euoio3iodalt  fes s) Dtaxm ;t1ale ifcilsfa2umn pn(4tlenir3oytfa  an s;t) 2tmir io1aleelnvt (f 2urxrono0tptoiietadfm2ul( p (4 rerif iatfptr ues;s) exmxr3iydlp nlncsat)aDumu oot0aeto f3ildlm uau o;u)aexrif3ty1oa eln o;s) rxoirpiu1ape  nvs tfsDumxr oo1apxoifciyslm el(mo;t4 leomo3iy1lpt lu ols)s2xrxo3io4lpeelneiatfsDra( pot1ale mf3iatlsDea(mp (4altrir3tadfa e n i (0trxmxm ou1ll e fcslt s2rax  no0tlt iietytfm eanvo t)altomfcty1oateauvo;(  rtr(rpiy1ol e nesls) rtmu  ou1tle mf3tad a2el(ms t4alenif oydlptr ieol(0trtm(m3oo4ol nmnvtat  rua( pnt0tetnmi3iadfmDeanmo u0 etrmf oatlpD lueo;t  rxmio no4ope mnetlsfaDum(mont4teeoiictltla2rmu o;t0alxoxfcia1laDe neilt0 rurxr iy4op  mncias)artrurpnu0tpe iieilsfa2ulumsn(0trxnmo3oytfm e u i t0t2tmxm nodopenmnvtlt)srrau o;t0tpxomociytfs emumo;(4 etrmr totla r ivi t) euoxmpiudam nlfeslsf rtmx  ;o0oltn fetlt aDeaumont0altrmrciodla  ai sls)t2trir3iy1amen ncsatfa2tmx oou4oexo feiatla uaump (4tlenmrcty1opt luvsl(0 euoim3nu4ale  iet () rra( pot1olx ii3iys mDemuvsnt4arxomf3oodfpteln i;(0srxoxm oy1olenlicil()aDurxmoot0tee  oeiasfm ulnms t)tetriociotlp r nvi s)t2tr(o oodll emiei ( s2tm( pno0aetomietldfs2rl(mp;u) exnir3oatoat auvi;s0 etr(o ny4lltelnvi t sDtrur oo0tpenmf3iytfsDuan p;u4tetnxr3io1lmte ivs s)srtrxo3iudlmee nvsat sDurxmonu0ole ii3ils aDea(mo u0tlxrio iytfpteliesls0 2trxopou4alt lfvtl( a2tr(m ;o4oetoioctys mDrauvp () leomf iydlp rlivsl()truo(o oy1apen icsa(fsrum(mo;o1olx iieiltla ul(vsnt0 rxnxr totfaD ln o () ruo(r3ou4lptelnes (f Dum(mo;u4apen o3ias s emn o u0trtrif ia1opD  nvs;t)sexo(m oydaleemfcia( arur(m ;o4tet ioctysfs2eanvs t)arerif3ty1oaD  ivi;s0texr(m3iu4amt lnvs tfsruaurp;o0opxn i3ild a2elnmpnu)arxoxr oytfaDr n i (0s2xrim3iodlm n neslsfarrmur ;t1altoif3tasfa rlnmo (4alerif3tatfp e neo;(  exrxr oy1lle  ictls)sDum(r ;o0tltn icildfm raump;(4 rtnifciytoptrlueo;( seurxm3iodalt micia(farrrxm ou0tet  icilt aDrm(msnu4altomf3todoa ranei;s0tetmir ou4ol elnetlt  rum(mooo1apto o3tas s2uanvs u0aexnmo ootomDe n s;s0seurxo iudal n fvia() Dtaur oo0opxo o3tytfmDumu o ()artrif tatfatrlnvslt0 etmxr io4op nmnetat  rtru  ou1aleo feias mDraump t) etrxociydfaDr u i (0trtm(r3iu1lmt mneia()srtr(monu0olenmfcilt aDra( p u4aexnmrcty1faD luei;t)s2uoirpiudame mnct t)artaumono4aetn fctltlmDelnvs;t4alxrxo iy1oatrluei;s)s2um(r oudopt lnct s s2um(mp;t0oleoio3ilsla2eauvp t0teenmo3tydlaDeaueo t  euo(r3oudomtelnei tfsruax ont1opt miciat sDem( s;t4tetoir3oytfmt li o t  rxmxrpno1lpte ncslsfaDtaxrpnu1aptnmocils a uluvo u4trtnir ootlaDeau i;s0setrxm3nodlle lieil()arumxroot1oexoio3tydla2uaump (4alxoxf oatoaDeln i s t2trir ny1lle mnvtat)artrxm ;u4tetn feildlaDua(monu) exnircty1optrluei;(  2xoxm nodamenlict (fa2rax pno1aptoioeiat mDrln s (4teerircoadoa  lueols  etoio oudllt  ics t)a2raxroou4tlto iciadlm2ra( p u4 renxo to1omDeaneo t  rum(opny1amenmfei tfsDtaxmpot4oexnmfciasfm uaumpnu)tlxnmrcty1omDeluvol(0seuo(m iu1omeelfes tfsrur(m ou4oeto ieilsfmDran o (4altomo oodopD lueol(  rur(rpiudop   ietat)aDtrum ou4aet mieiysfsDrm( snu0aexoxrctadfaDr uvol(  2uoimpnodaltelfvta() 2ua(mooo0openmi3iyd a2em(mon(4teenxfcoo1fa eaivi s0teumimpio4lleelicslt a2trx onu0aee ii3iatls em(mpnu4 exnmf3iodfa raies;(0sruo(o3iu4openlneta() 2rax  nt1alt io3ilsfa ra(msn(4teerxr iy1fpt lueolt)t2uoxopoodlp emneils srtm(ronu0ale  ocias aDul(vpnu0 lxnxr3ty1la   n il(0 euoiopnu4amt  ncslsfarur(  ;u4optnii3ias aDeaumo t)altrioctodla eanes;s)t2tmim3nudlltelfcs t  rrrum ot0opxnio3tad m rmuvo;(4 exoxr oy1op rln o s0srxrir oy1amtnlnctat)arrr(m ;o1ale io3tytfs2uan o (0 eermo3oa1fp r ieo;t0 euriopnu4om nmiei sf Drau pnu1tetomf3ilslm el(vpn()aexomoctatfmD au s s s2trxr no4omee fet tfsDtmxr ;o1teeoiocildla2eanmsnt4tetnxf iy1fpDeanvi ()sexmio iu1am emnvilt  Duax pno0aex  i3iyd aDul( p u0aexnifcta1lmDrlivol() exr(m3oudal  mfvi (f rrmuroou4altnifeiyd m umnms;t0teermrcoadop r uei s srxrxm3iy1omenlivsl()a2tr(m no0texnmieiltla2rlnmo;t)arxomf3ootlmD ln sl( setoxm iu4altn ivs s) 2rmx o;u4altomi3tasla2elnmsnu)altrxr3todom  aieils  2urxo3ou1omeelncia()sDrau pnu4oltnmo3iys a rlnmp (4 rxoxo3totoate n il(  2xoir3iudopte ietltf Draurpnu4tlxnii3iadfaDua(msnu0aexrmo ta1fpte u ilt)srurio3oydam  mnesltfaruaxm oo0alx iiciyd a2rl(mo;t)altrioctadla rli i t)tetr(m iu4olee nes s)aDtmx  ou0alt ifciysfaDrm( p;(0 ltnxr oydfm r uvi;t truoxr3oydapenliciatfarurx  ;u1oee  ictadfmDrmu p;(4aexrir3io1lat livs t0s2xrxr iodap nlncils)a2tr( pot0tltnmoeiys a2um( onu)arxrxo3tatfa  auvols0srtoxo oy4lle lics (  2ta(r ;u1olto o3tyd m el(vp;(4alenxocoy1la rlnei;t0srtr(o3ou4lpe  netat aruaur oo4opx ifeias sDuan o;()alxnmociotla  livs;s0trtm(r3oy1lmtn ieta( sDrrxro;t0teeomiciatfa ra( o (0 exrxr3todop e ueo;()s2um(r3nydlleelnesa( sDrm(r nu1aleoif3iltls uln sn(0areoifcoy1om rlnes () 2toxr ny1openlnctas arrru  ;u1tlenmf3iydla el(mo u) eeoxf tytfpDrlnes;s0 rtmxm oy1opt  fesasfsDumx o;t1aeen fciat a ea(vsn(0alxnmfciadoptrlieo ( s2xoxr nydomt  fct sfsDrrxmp;t4oltomfciat aDem(mp;u4alenio tydom rau olt trxo(o iodlmeelnetat aDumx o;o4tle ifeiysfm em(vp;t0 ltnir tadom r uvs (  etm(rpio4ll e netas)aDuru o;o1tlen oeildfsDrl( s;t4 rerxr oa1faD lnei () eurir3oydlm n nci () rtmum ;o4tpx  f3ils s2rm(mo;() reoirciadlmt aies;t) 2xoxrpoy1lpenlfvt tfaDuaum no0oet  ictls mDra(mo;t0 exoxfciadfpDrln i;( t2umxm3nu4ll e ieslt aruaxr no0aeeniociydfsDum(mpnt4 eenmfcoadoa e ivi;s) rtoimpoo4lpe mneil( aDrm(r ou0tltomieiysfs2rm( o;t4trxomocty1fat auvs t0 rxmirpny1amte icsasfa2umurooo0texnifciltlm2rl( o;u)aeenxo iydopD lu o ()s2umir3nudop emfesltfsrurxm ou0aptoiictytlaDean ont4 rtomrctytfmte nvs (0teuoxm3iydame lieia()aDururoot0opeo f3ils sDrln s ()tleoifcoa1fp   ivo t0t2umxo3nu4om n nctat srtrurpno4tlt ifeiydfs2ulu onu0arxnxf3ty1fptrlivols teuoxr3iu4opt liviltfs2rm( oou1tpeomieiytla uanmo;t)tltrxr iytfpDeaneilt0sexo(m3iydal  mnvsa() Dra(m ou4tetoifctyd s2uauvp t)texnirctydlp r nvols0tetmio3nodlpte fctas) 2rmu  ot4aeen ociysfs umnvo (0 etomo iodopte uvils truo(o3nodlmtelivi (fsDuaumpnt4tltnmociys a um(mo;()tltrxr ootfpDr u o;t0teumio iudlmen nesls sDtaxr ;t4aee mo3tydfa uaums t) lxnmrcty1oa ean ol(  rto(o3no4lptelnctlt) Duru  nt4tpen ictlsls2rluvp;t0 rtoif3oy1oatranvs s0trurir3io1omen iet tfartm( pot0optoiietyd a eanmp u)texrxo iydfmDe ueslt) eurxm nodam nlncsls aDuax o;u0oetn f3iadfaDumu o;(0tltnif3oytlaDe u i;s0setoxo no1alt lfei t  Drmx ono1tlt  o3tlslmDumu s;u)altriocoadfa raieo s  euoxo oydomenmfvs sf Dtmurooo1tlx ioetls m rm( onu) rxnxrctatoa  anei t0trxrir3nydale  fvsa()srraum nu1aexomfeiat mDrmnvpn() exrmr iadla eauvs;t sexrio nudlpe livsa()aDrr(rpnt4tltoio3iyd a2um(ms;u4trxomfcoadomD lueo;t)trxm(r oodalt mfvsas) rrm(mp;o0tpt iociltfs emnvs t)arxrir to1opte ivilt)sexmir3oudap e nvt t  rur( ono1aleniietyt a eaumo u4 rtnirciydom  lu ol(  rxmir3io4oltemnvta(f Drr(mp;t4ope ifeildls umnvsnu)treoif tadfpt  neo;t t2xm(r3ny4omte nvia(  2rr(m ;u1tlxn feilt sDuanvsn() rxnxfcootoatr ues s srtoxo3iy4lm elivias)s2ra(moot4opt mieias a2elums t0arxrmo oy1oa  lnvs s)s2uoxmpio1olenlieiat) rur(rp;t1tpx  i3ils a2um(mo t0 eerir3oatoat ln o;() 2urio3oudll  mfvil(fa2rr( onu1ole iietytla emnvp t0 lxoiociydopD  u i s s2xrio io1llt livslsfsDur( poo0aet ii3iatfaDulums;(4trtrxo ootfm e uvo s0 2toimpoo4al e ncsl() rtm(  ;o1alx miciydfs2emnvp;u0texoxr3iydfmDeluvo ( setrim oy4lmtn netls s2urxrp;t4aeeo fciydfaDulnvo;t4aetrioctydoatr neo s)t2xrxm ou1omtemivsl( arua( pnu4olt ifeiaslm um(vp u0 eenmrctydla  lu s;( t2xo(o3io1lle  fetas a2trxrpnu4tlxnifctatla ea(ms;u0 eermfcoa1fmtelnvi t0 etoxo3iodalt  ivsl(farta(mpno4optniieiyt mDelumo;t0texomr3io1lat  ivolt) euoim3oo4ap nlncias)a2um( onu4optnmi3iysfs2ul(vonu4teermfcty1lpDeauvo s) rxmir3iy1opt  iviat sDtrx o;o1opxn fetltfs2um(mo;(4trxrxoctadfp eauvi t0 2urim no4apenlneils aDtmxm no0ale  icildfa2elnvp u)alxoxrctytlmt lueols0seuoir3nodlmenlieil(f 2tax poo1apt mo3iydlmDulump;u0arermf3oodomte uvs;(0trtm(r3oy4om  mfcs sfsruau p;t1aptoioctydfm ulnvo u4arxrxo iadlat an il( trtr(m3iu4opt lfcsatf 2um(r ;o1tlx mietas mDuanmont4 exnmf iytlateau s s)sexmxo oudaptelivil(faDtaxrpnt4oex mo3iydlmDrmn s u) eerif oydlptelu s;t) rtoir3nu1om nmnctas)srra(rpot0ape miciytfm uauvp;u)tleomr iodlpD aneo s0s2trimpnu4lmtelivsas) Dtrxmoot1opt  oeilslaDem(mpnu)alxrmf3ia1lm e ueols)teumim3nu1ol n netas)s2umump;t4ale  ieiasfaDulnmp;t0texoir iadfpt ln ols0setoim3oo4amt  icil(fs2raxmono1aee mi3tldfa um(msnt0areomr totoatean olt srtoir io4lleemnvt sfs2umxr oo4oetnmieiad a ua(vpn(4altrmrcto1lm e ieo ( s2trxmpoo1olen nesltf Dtmxr ;t0aexoioctltfaDulnmo u)tltrifcoy1lpteaivs t)s2xoxm iu1ll elnct t)aDuaur oo0opeomicilt a rm(vonu4trtrxo3oytfatrai i;(  eumxo iu1lp nmnci t)srtr(mpnu4olenmictyslm ea(vo;t) lxrmocia1lmDraies s0 2tmim nu1lm n nci sfaDta(ronu4texo octysls rmumo;()tlxnxf iy1fmtr u o s0 2urxm nu1lp   fei (f 2rmxronu1aptoif3iltfmDrlnmo;()tetrxf3ty1oaDe neo;t)sexmimpoy1amen iei ( srum(  oo4aeeo i3tls a2emn pn(0teeoxfctydfp eanvs;s)t2umir oodamenlnvtl( a2tm(mont0tpeoifeilsfaDea(vp u0altnifctatlp   iei;s0t2xo(m iy4lmt lfeiatf rrr(rooo0altoiietatlaDumnvp;(4 rtnxr3iadopD au s s0 2uoim3nu4lmenmnciasfsDtm(m ;t4tltoioctltla ua( s;t0trxrif3tadfm  lu ols trtrxrpny1optnmicta()s2tax o;u4ape mi3tysls rlnmsnt4tlxoio iatoaD  n s;t trtm(o iydlp  lfvt (faruau oou4alen fciatla rlumon()tetoxrcoatlaDelueolt0 eur(rpou1omtelnesls)sDrrxmp;t1alto oeiltfsDemums ()aleoxf3ia1op raneil( t2toxm3io1lpt lnetat  rua(mont1alx mieiytfaDul( o;t0 etrxo3to1opt anvi t) rumxo3iodamt  ncsa(f 2rr(mp;u1alxo icils a ua( o;(0artomo3ta1lm r ueols0 exo(m3oodoptnlics t) 2tr(rp;o1opt mieias s ra( s;(4 ltrir iydfpD anvsl() exoim oy4apt  nei s)srumx ono0aexn i3tad mDea(mp;t)treoioctadla   nvs s) rtmxm iudlpee icsas  Dra(r ot1aeeo oeiytls elump;u4altnmr3iodfmt  n s;s t2xrxo io1lpte nct sfs2rrxrp;o1tlxn o3ildla2rln s t)tltrir ia1faDrai ils) 2xrxm nudal nlfcsas s2um(mpot1tpt iictlt s rmums u) eerio3oydlaDelu i;(0srxrxmpnodop  liet tf Dta(  nu1aleomiciadls2umnmo ()arermo todop rluvo s t2xo(m3ou1apte fvilsf Dtrxm no1oeto ictlsfmDrlnvo;()treomr3oatfa  lneo;t0sexrxm3oodlmt  nvil(f rtm(m oo4oet iictadfs em( s;()texrxf3tadomt lnvs t)srxo(o3no4lltemfviltfsDta(mpnu4apx mociys a2emnvp u0trtrxrctotfp  ai ols) rum(o3iu4lmeelnvia(f Dumxmooo0texn ieiytlaDrlnmp;u)aeenmr ty1op rln o t tetmirpiodlp emfesas)srur(mo;o4aptnmocias s2ulnvs;t) reoxo totopDrlneilt)tetrxm3ou4lmt lnet t  Drr( p;u1oexnmociyd sDuluvp;t4tlermrciodfatran i;t)trtrxopiu4am nlietls  rtr(m ot0aeenioeiysfs2uaums;t4teenmo oy1fmteanvsls0s2tmxr nudlm n nvil( artrxrp;t0oexoioeiatlsDuln s (4 lenxf3iatlaD  u ol() 2xoxopno4ole mieils a2tmxr no4aee if3iysla2ulu o;() etoirctydomDrauvil(0 euoxo iydoltn ietatfa2ra(mont1oltomfciatlsDrmnvo;t0trxrmr iytla raivi;t0 eumir oudaleelnctas sDurxr nu0tlxnmocias s2um(vs u)artnmrcty1lpDeau i s  exo(o3iodapte fesasf rumx  ot4aex mociatfaDumuvonu4texrxr3iodop eluvol(  etr(o3oydom elietlt)arurur oo1alto ocilsfaDrauvs;u0texoio3oa1faD lueil( t2urir3ny1am emivsa() 2tr(mp;u0oet mfeilt mDul(vp () rtrxf3to1faD livs;s)teurxopiu1apee icias  rrmurpoo1tpxo octas m2ea( o t0 eenmo ty1lp e nvsls)texo(m3iydlle mics tf 2um(rooo1aeenifciys aDrmumpnu)tltoxfciotlat  uei;() rtmxr no1op nlnctltfa2rr(mpot1aptomieild s um( p;u4tltrxr3oydop eaueilt0t2ur(o3no4alen nesl( arra(m ;o4alt  o3tytfa2ul(vo;u0alerio tytlmD lueilt) 2urir3ny1omte fcilt)s2taxmp;o4tlx ioctyd m ran onu)arxnif iydoate ivo;t) 2to(opoo4am nmnvsls  rraumpot4aetomf3iaslsDuln o;u4 exoxr3oydoatrlueils0 etoxo3iu4amt mieiatfa2urx oot1alx iietadfa2em(mo t0trxrmr3tatlatelnvolt t2umio3ny4olenlnes () 2trumpoo1oetomociysfs uanmo;u)tlxnmfcootfm  anvs;(0 ruo(rpiydomen ncsat a2trxmo;u4ole if3ild a2uan p;(4 lermf3iodlm  an o;()tetmio3io4omenlicsl( s2ra(r ;o1texn o3ias mDumu o t4trxrmociodlpDelu s;s0truo(m3ny4ap nlnvsas s2tmurooo4opeomfctytfm2emuvo u0tltrircta1oaDrluvolt0 2xmirpoy1opee ici t)artmurp;t1aexn i3iytlm rm(ms;u)arxoxo3oo1oaDeanei;() rxm(r ny4am nlfctls)s2rru ono1aleo ictatlm2rlnmo t)texrxfcto1fa   uvsls0t2ur(m ny1om  livsls s2tr(r no4apxoii3tyt a2ea( o u4trtomr3iydoptrlu s s texo(r3iodoptnmfet s s2trxmpnu1tptoifeilsfa ra(mp t0aetoxo tytlmD  neo t0trum(o3iy1altelfcils  2tau  oo1ope iietad sDean s;t0tetrxr3ia1opteanvol(0 rurxrpoy1ole  ivsls sDurxm nu1oexnmoeiys sDumuvont0 etnxr oatlpt  i o;( t2xoxr3ou1lmenmivias)a2urxmoou0tlto o3tltlaDemu pnu4arxrir tytopD  n i;t sexm(r ny1aptnliesas sDra(mpnu4olt mf3iys a ulnvp t0 reoxo oydfpt  i i ()seuoir iy4llte nei (fsDumx p;t1apeo ieiltlmDul( o;t0tetnxo ta1lmt  ies s)teto(o iy1om   icsls s2trumont1tlxomfcildla2em(vpnt4aleoxf3iotfptr uvs t0t2tr(m iodoltemnei (f Dtru p;t0altoiieiasls ul(mpnu0tlxoifctatlpt  i s (0teurxmpoy1lptemieiat  Dtru oou0oexoioeilsfm rmums;u0 etoxf iy1fm eli s;(0srxm(r oo1lltelfct () Dra(mo;t0aee  ociys sDemn s t4areoir tadopDrauvo s0 rxr(r iudlpt mfcils a2ta(moot0tptnmoctasfs ea(vs;u4 lenxo tytfat an slt)t2trio3io1ll   fvt s)aruau pot1tltoiietlsfa elums;(0aetnif3oodfatran ils seum(o oydam   ncsas sDumur ;o0oee ii3ildla2rlu pnt0alxoxrciy1oaD  nei;s)trxr(r ny1ll  mnct t s2uaxrpnt4teen ociytls2ulnvpnu0arxrxf oodlpt luvi;s)t2urxmpiudaltemfvilt)arrm(mp;o0olxo fciasla2rl( snu0trxrmf3iy1la rlu s;( srxmir3iy1llee nctl()srrrxrono0ope  o3iyd m rl(mo;t)tlxnif oatoptelivilt0truoxrpiy4llt  ivt ()s2tr(mpnt4tltn ictatfs uau p u)trerio3tydfaD anei;s) eumxr nudlmeeliei t aDumxrp;u0olxnmi3ilt aDumnmo;u4 rtrxoctydomDeau olt)truoxm iu4lltnmnesas) rtmu  nt0tet mfctldlmDel(mon()aexomf iy1lptr i o (0srumio3iu1opt lfvs sfartax  ;u1oexo ictytfm2elums;(0alxnio3tytomDr nvi s)trtm(r3ny4apee ivtl(  rua( p;o4oeenio3ilsla2eanmpnt0arxrxo oytlp eaieols0tetmxm oudolt mivta() 2um(mo;t0tpxomociadfm2uanvp (0tltrxr3oa1laDrauvi s0sexr(m iy4am  mncsls sruax oot0oleoiieiyslsDranvo;u4 eermociytfptrluesls)s2xoxr oo1amte iciatfsDumurp;u4ape micilsfs2el(vonu4 rxrir3to1lp eaieo;s s2tm(opiy1olee ictl(  rtaum nt0apxoifctldfa2emnmo u)trxoxf3totfm  lu o;t s2trxr3nydlmee fcsasf Drrxrpno0opxnmieiadlsDea(vont) rxomfcio1fpt livo;(0s2trxopiy4lpte iet s  rtaur oo1aee io3iyt s2um( sn() exoif todom  lu i;t trxmio3ny1lm   fcta()sDtmxrpnt0olxnif3tadfsDulnvsnt0 ltrmo iotlmtr n o () 2uo(r oydom  lnes s aDrrx pou0tleniiciyd a rm( p;t4 rtnio3tadfmteauvsls0s2umir3no4lmtnlivs ( srur(rpno4tptniocildlaDumump;(4arerxo tytlp eaueolt) 2urxo3iy4am nmnci s srumxmpot1apt mieiytlmDeaums;(0areoir iydlptelu o t t2trxopoodllee feiat)sDrr(mpoo1opx moetys s elums;(4texnmf3tytomtean ilt trxr(opiy1optemieils  rrr( ono4oet  o3tltla2ul( o u) eermr iadfatrau i s0 2tmim iudoltnlnesltfaDuaum ou1tptnmi3iytlmDrmn o t)aeermocty1fpDraies;t0s2xoio io4amtnlivtl(f rrmxmoou1alxoiictadfmDrm(vo t0tlenmocoydoat au il(0trxmxm ny1altemivsls)aDrrumo;t1alx mociltls2ulumsnt) ltnmr3oy1omDrluvi;s  rur(r3io4olenlncsas arum( pou4tpxn f3tlslmDrmu p ()alxoxrcty1oa eaneol()t2tr(o nudolen fei s)a2rrxro;u4olenifciatlmDeanmpnt0texomr tydom   nvols s2xo(r3no4lmen iesatf Drm( ooo0aexniiciysfmDrmnvsnt4 renir3io1lpDranes () rumxm3iu1lle  fvsasfaDrr(r ot4apx  i3iytls2em(vo t4alerifcta1oa e u sls0s2umio oo1lle mnvsat) rrmurpno4alt mfeiaslaDua(msn()aeerio tatfa  auvi;t  rxrir3ou4oleemfcsl(f 2rrxmp;u4ape mieiytla um( snt)texrmrcoydfatraies;t)trxm(m3iu4lmt mieta( a2tax pnu1tlxo ictlt m2rm(mo;t)aeermrctatfp   u s (0 rxrir ou4lltelivs ()a2tmx poo0apxoiiciytfsDulu s;(4tlxoxfcoodlpteau o s) rto(r iudal  lnviltfsDtr(rpno4altn fetydls2um( p (4 reoir3todlptran s s)t2xoxo ou1alte ietas)sruaxmono4apenii3iasfm2rlu snt0aexrxo3oatopte u o;t0 2ur(m3oy4ale  ietl(  rtaxmp;o4oeto f3iytla2uluvs (4 exnxo3oatla eai i s)t2toir ou1opeelicsa(  2uauroot0olxn oeilslm ra(mp;(4trxnxr oatomtr neolt0srtm(m3io4ome  fcs s  2rmumooo1oeen ieiatlm2em(vs;t)teenxr3iadlatean o;( trurxopiudalt liesa( sDrau  ;o1tetnmfeiad m uluvo;(4 ltrxrcoodlat lnes;t)trxrxo nu1olte fvs s  rtax o;t1tlx moctytlaDel(von()tlxoir todfate nvo;s teuoxopny4om nmivtl()a2rr(mooo0tex ioetysls uanvo;u4aleoirciadomDe nei ()t2toir oo1opee nvt (  rrm(mo;o1tee mietldlsDumumpnu) ltomo ta1omD lneo (  etoiopnu1apenliei ( s2umu ooo4oeto oetltfmDean s u)aeenxocoa1lmDraiesls)srtmxo3oydom  lnes s a2trxmp;u0tlen icild s2umums;u4 etoxr3oatla  li ols) rxoxr3iodam  mnct (fs2umum ou4opxoiictltfm2uau o ()aetnircta1fmtr ueo;t0 exo(mpoo1amtnlict s sDtrur ;t4aex mfetltfs2rmnvs u)areoif3to1fm raies s)srtmim iy4apt lict tfsrrm(rp;t0ole mociys mDel(ms (4alxrxo3totopD  u o (0t2xrxrpiodlp elfctas srrru oot0olenmo3iytfaDrauvpnt4trxoif3tytlp   nvs;s s2tm(o oydoltemfvsatfs2ur( poo0oetoiocildfm2ra( s;u)aexrxo3ty1op eau i;(  euoxopoydlm   nci ( s2umuro;u4tlt iietysfa umuvon(0aeeoxfctadfaD  uvs;t trtr(o3iodame lnvsat a2rrxmo;o1apt  f3tlt s em( pnt4tltnio3oatfm eai o s s2xmimpnu1lp elieilsfaDuru oou1oleomfciltlaDeaumo;u4artrifciotom r n sls0 2xo(r iy1ll emfet (faDtau ont0aeeoiicildls emumonu4 rxomo3iy1omD livs;t)sruoimpou4opt  ncias)arumxr ou1alxomietltla2eaums (0aeeoxo3tydfpD auvs s)trxmxmpio1lm   fetas a2tau pot4aleo f3tatlmDumn sn(4artoif3to1fpDrau ols seuoio iy4ll  lfeias s2umx  ;u0tltn fciyt a umnmonu0 renxocta1omDrln o t srtmxmpio1lpt livsltfaDurx poo0tle mfeiat m em(mp u0 rtnxfcoa1omD ln ol( teto(mpiodlmtnlieiat  Draxm ;o0aexomfetatfm eauvo u4aeenmr3iotlpDe ieo s0seum(r3iy1lm elnesltfaDtmxr no0ole ioetatfa eau p;(4artnmociodlmDraivs s) eumiopio4altnlfvs s)srtaxrp;u4aet ioctysfm2uanmsnt0arermfciadoaDraiesl( trtoxo nu4lltn nvi ()srrrxm ot4tetn fciatlsDraumo;(0texoifcio1om  liei (0 euoxopou4omtemfciltfaDtmur ;u1opxnmieilslsDrau on(4 eerioctotopDelivi;t0seuoim3nodomt mnvi t  rurur ;u1aetnio3iys sDul(ms u0alerio3todop e uvi;(  exo(o ny4lpenmfvslt  Dtmump;u1altoiietytlm2emnmon(0 rtnir iotfat  ivsls  2toimpiu1omeemfvsas)s2taxm nt0olen fciyd aDrl(ms;t) exnmrcoydfptelneslt) 2xm(mpiy4al emivtlt aDrr(rpnu1altnii3iysfs2rluvon(4aetoif3ta1fa r u s;( trxoxo io4ll nmnviatfarrm(mo;u4tpto o3ils aDrm(vsn() lerxf totfpteai s;t) ruo(opoy1ap  lncil()sruaxmono4aleomfciadlm2rmuvpnt)trtnxfctotlpt  i sls0t2uoxr no4op elicsa(faDua(mpou0tee  feildfs um(vpn(0tleoio iadlmt lnvo;s0 exoio iudal elfvs ( sDumxmpot0tetnioctlsfm2ulnvo t) ltnir3iydfpD auei;t)tetoimpnydlmte fvia(fs2rr(mpot1aeenmfeiatfs ra(monu4teenxo3oo1fa  aivo;s) 2uo(r3oydoptelfesa(farrm(mpot0tlxomoeiytlmDrlu onu) rtrio ootfm eanvs;(0t2tr(m oo
\ No newline at end of file
@@ -0,0 +1 @@
+u sl(  2xmir3oo1aleelfviasfa2tm( o;o1teto ietlsls el( ont4teenmrcoa1omtraivi;()seuoxr oodoltemivil( s2uru  no1aetomo3iadfm2um( onu4 etoxo3iotfpDe uvils0 etrxo3iu1openmiesas) 2raxro;u4tex  oetadls2uanmp;(4arxoxf3ty1om r u olt)t2uoxr io1lleemnvtl(fsDrmxm ou1aee mo3tadfa2ranvp;u0altnxoctadfatrlu o s0s2umir3oy4lm n nvs sfaDrrumo;o0oetnioctldfs2el(vp;t4teenxrcty1omDe ivolt t2xm(o iy4lle lnctl(f 2uaxront0oetomiciatfsDeanms u)alenxrctytom eauesls setmio iy4op  mnctltfa2rrxr ou4tlto ieilsfm2rlnmp t)arxrxocto1late i sl(  eumir oudomen ici () Dum(mont4alto feiyt a2rluvont4 eerif3tadfa e ies t srxmxr oo4am nmncta()sruru pnu0oeenmoetas s umuvpnu0 lxnxf oa1fat lnvsl()s2xrxr io4amt mnes s  rur(r ;o4ape  ictadla rlnmsn()texrirctydlptr iesl( tetm(opny4alen fcs tfsrtaumpoo4aex  iciyslm2ranmp () ltoif3iytop  luei s0trxmxopnydop nmnetlt a2tmxmpnu1olen o3tyslaDrln ont)tlxrif3totomtrau s;s0trxoio oy4lmtnlncias a2uaxm ;t1aetn o3tatlaDea( p;t4alxomrcoydopDe i o;( t2urxr3io1ap nlncil(fa2tau pnt0alto oetatls elu s;(4altomfctotfp elivs;()trxmxm iu1lp e ieia(fs2rruront0aexniictydfsDuluvo;u4alxoxf3ootlatrau o s) exoxm3iydoleelfcs t s2rrxmpnu4alt if3iasfmDel(msn(4 lxoifciodlm eanvslt)seuoxm3no1altemfvsa( aDrrx o;o1tetn fcilt mDuau snu4tetrmo3ta1fatrlu i;()t2tr(rpio4om e neia(f 2rm(mpnt0aexn f3tlsfa rln p;(0 lxnxf3oo1op  lies t)t2urim oy4lmenlfcta()artrumpot4ope if3iasfa2eaums (4tleomfctodom e n i t) 2xmim3ou1ameemfei (fa2tmx o;t1optnioeiadlmDea( s;t4 lxnmo ia1faD aivs t) etmxm oo1om e fvs s srtmxrp;o0openmoctytfm rl(von(4alxoxr ootomt  ueslt0tetoio oudale mivt ()s2rr(ro;o1apeoiieildls rlu s;u4alenxo iytomD  ivs ()srumxr iodomeelietasf 2umxrp;o4texn o3iadfaDrmn snt4trtnmr3totlm rau ilt)s2xo(mpny1lpt  fctl()aDtr( pnu1apxo fciad a2rmumsnu0tlxrmoctydopD luei t)trxm(m3iu4omeemiviat s2urxrooo0apeomfeiadls2el(mpnt0altomf3tydfmDe ieil( sexr(rpou1lp   fetlsfa2ua(  nt1tptnio3iaslmDua( ont0tlermo oatop  lneols0texrir3ny4llenliesa(f 2trxm ;o4oexnmo3iysfsDumnmsn()alxrxf ootfmtraieo (0teuo(r iu1oltnlfvtlsfs2raxr ou4aex mieiydlaDem( s t4aexoxocoytfm  lneil() rumxm iydlmt  fcs t a2ururono0olxn ieiasla emn pnt)texomrcoadlm eai ils setmio iy4amt mnctatfa2ra(mo;t1opxoio3tls a elu p t4arxnmo3ootfaD au s s0 euoxm3io4omenmnvt t)a2rrur ot1tpeomiciat m2ulu o ()arxrxo3iy1fat anvs;(0teumim oo4altemncil(  rra( ont4tpe mi3iatfa uauvs t4aleomf3ty1fm   uvolt)texoxr3nu4ame mnvt tfs2ur(  nu0tlt  f3tytfs2um(vo;u4trermrcty1fmD lu s;t trurxr3no1al  lfcslt aDrmxm nu1oleo fciytlmDrm(von()texoxfcootlmDr neol()texoir nu1al e fes ( aDumumpno1alen octasfsDemuvsnt4tlenxfcto1om  ln o (  ruoim3oudomen fvi t aDta(r ou1apt iociad mDua( pn(0 rxrmr oo1omDranvo ( seuo(m3io4apt miei t) Drrum nt0apxnmiciadfmDranvp;()alermr oydomDeln i t)tetoxo nydlmtnmfeiat)sDraur ou0aptoif3tydla eln snu)tlxrmf oatoaD aiesl()t2xo(o oo1lmeelivt (f 2rrumo;t0oee  o3tyd mDum(msn()tetomo ty1fa eliei;s) rtoim3no4omeemfcs t srta(r nt4aexo feiadlm emums (0teermrciotfm r ueo;t  eum(rpoo1alenmivils arurxmonu1alxniociysla el(vs (0teeoio iodlpDraieo (0texo(r3nodlm  mfvsasfa2umumpou0aexnioctlslm2rlu on(0aexnio totfp eln o (0srtoiopno4al elfcsltf Dtr( pou4open i3tytla2emuvo (4 rtrmf oydlpD au o t)setoxopio4lltnlnvi sfa2ua(ro;o0apeomo3iatlaDea( s ()tlerxf ta1fmD an olt0 2uriopnu1am nmivtl(f rrm(ronu4tetnmf3iltlm ua( s;t)tltomo3totlpt  i slt)s2tr(r ou1lptemict s sDta(mo;t0aee iocilt a ua(mp;t0 ltomfcta1oa  aivs;t) exm(m nu4am e nvt sfarur( pou1tet  f3tyt s2rm(vonu) etomrctatfm eaivs;t) rxrxm oudopt mfetltfs2ra(r oo0teen fctadls2rm(vo;() lxomrcia1fmt aivo t seur(r oodom  mfetas)sDtrxr nu4tleomictlsls emums;() leomf iydfmDraueo;s sexo(o3oy4lptn fctl() 2ua(rpnt0alt mo3tlt a ran p (4tlxnir iatoaDelueo (0 exmxr3io1optnlfvils  rrrxmont4tpt ioctldlaDua( p;()tlenxoctytop  ln o;t0t2toir nudol e nctls sDuau p;t4tleoiieiatfsDeluvs;() lxnxf io1fp ran sl() 2toio3oodap nlieiat aDtr( p;o1tee mi3iydfa eluvpnu0tlerio3tydlmtrln o;() 2uo(o3iudalt mfcta() 2urx pno1tpx  ictlt aDrmnmon(0 etnir ty1fm eai ils0trtmiopny1apeelnvi ( s2raur ot0aex  fetytlaDrlnvp;t) etoiocoydlm eaies t) ruo(m3oo1lptnmfcsa( srtmxm ;t0tlx  f3iltls2ra(mp u)tltnir oodoateln s t0 etrir iodopenlfcs ()srrauronu0ape  o3iyt aDua(vont) ltrircoydoaD  uvsls  rur(m3iu1altn fvtasfs2ua( poo1opt ii3ildfs2rlumo;()trtrmo3ootfmDe nvs s0texr(r3iy4llt mfcsat artaurp;u4tlto octltfmDumumsnu)texrxo3ta1omteaiesls trto(r3iy1lle mictat sDrr(m ou1oleoifciltls umu o;u4 ltnmo3tatfmDr u i ( texmir3nydop e nvilsfsDtrxmpnu4tlxnmfciad m rm(mpnt0alxoir3oy1omte uvs t s2umir io4apenmfcsatfsrrrx ont4altomo3tysfa2rm( pn(4trenio3oatopt aivs;t  etr(o3io1lptnmfvt sfs2ra(rpnt1apenmoeiatlm umuvon(4aetrmfciytfmDraueil()srxrxopiudaptelics tfsrua( o;u0aeeoiociysla eaumo;u)teenxfctydlmtraueols)texr(r3oy1ope  fvilsfaDtm(r no4ale iiciyd m2eaump;(0 eeoxrctodlm r ieol(  rtoim no4ale  ivia(  2taxrpou1olxomi3iydfm uan p (0 etrmrcoa1lmteau il(  etr(m3nydom n ics tf 2raxr nt4olen octls s um(msnu0 lxnir oo1lat  nei t setmirpoy4lme mfeiasfsDum(rooo1oee ii3ild a2emnvpnt4aeeoir3tydfat ai ils)srxoxmpio4apenlnei sfarraxrpnu1tlxomo3iatfa rlnvp;(4artnmr tadfmDrlnvilt srxo(opou1omt mietlt  2urxr ;o4optnmoetlsfa em(vpn(4tltrio3tatlmtr i o ( texmxr3oo4lmtelfetlt)aruaurpoo1opxomfctadfm emnmo t)trtnxocoodomt auvi;()t2urirpno4lmtnmneils)sruaxrpoo4optn ocias m emn s u0 lenxrciadomtranvi;(0t2tmxo nodlme lnvsl(fsDrrumono4opt micilsfm umumonu)artnxr3oadoa  lu o;(0t2xr(m iy1lpee iesl(  2tru  oo4opxomfeiat s ulnmpn(4trtnmf iadoa  auei;(0t2um(m iu4ome lnvsat) Dta(mpou1oeenifctadfs2em(msnt4 rtriociytfp eanvsl( trxoir3nu1open ncsls)srtmxrpoo1aex mo3ilsfm2ulnvont0texoxf3todlaD lnvo s srur(rpno1ape lnvtl()srtr(r ;o0oexo ociat aDeanvp u)artomr3ty1oa   u ils0 etmim3io4oltn neiat)s2umxrpnu0ape ii3tldfaDum( o t4treniociadfa e n o (0 rxm(m3iy4apeelfvta(fs2ra( pnt1teenmfeiat s2rau s u4 ltoio3iy1lp  aivs;( seurim nydaleemnesat)sDurx oot0olxomfetlt mDelnms;u) eenmrcoy1la ean ilt)texr(m3iy4lpt mfes sfaDrrxr ou4apto ieilsfm uln p u)aleoir3ootlp   n sls seumio ny1al n ivt s s2rrurp;o0teeo fciad a ulumont)areomo3tadlmD au olt0 rtr(r iodlm e fet sfaDumx  nu1tlxoio3iytls rlump (4tetoxf totlp  livsls t2xr(rpiu1oltnlivias aDtax  ot0tlxomfcilsla2ua( p ()alxoxr3iy1oat aieo;( srxmiopiu1lpenmiei s a2uaxmpnu0aexnmfciatlaDra(mp t)altrmf oadop ranvo;t0s2xoimpny4apt lfet (fsDrmuroou4ape  oeiysfm2el(mp u) lenmo3oo1fat  u sl(0t2xo(opiydam n feiltfsDtmxmo;t4oltniicildlm ul( pn()texoiociotlate ueils0t2xrir nudol n icsasf 2rmur ou4openmocilsfa2emnms t)altnifciatom   nvs s t2tmir3iydlm   fcs ( s2taxr ;t0oexomieils m2um(mo u4aexrxr tytla e i slt0t2toim iu4lleeliesatf Duau oou1opto feiltla2ulu s;t0altnmr3io1lp e nei () 2um(m iudlptn fvsat aDrrurp;o1aeeoio3iaslsDulu s u)arermo3iydlp e ies ()tetriopoudlpe  neias  Drmuroou0apx  f3iys m2ulnms t)arxoir3oytoat lies s srumxm iydomtnmnetas srua(r oo4oee  ocilslmDel(mpnu) reniocoydla  aivs;s s2xmio3nu4opee ics tfa2tauro;t4aeen iciatfa2ua( o;t0trxrxo iydfm elneol(  etmir3oo4al nlfcils s2ra(r ;u1aeenioeiltls2ra( s t4tltnxrciytlmteln sl( trxoimpnudol  mfctlsf 2taum ot1olenio3ild m2ranvpnu4tetomf tydoatr nes s0 rtrio3ou4olenmiei ()srrau  ;t4alx ii3iydfa2rm(mpnt)trenir3io1optelueils)sruo(o3no4aptnlicil(fsrraxroou4tpto iciatfm2uaumsnt0 rxoif tadlpD anei;t)srtmir ny1lp  mfvi t sDum(rpou0tetoiietysfs rmn o;t0trtomr3tatop e uvo s)setrimpiodam n ncs s) Dumuront4apenmieilsfs eau s;(4 rxomr tydop  ln s t s2xo(r no1ap n neslsfsrtrx oot1tpenif3iydls2rmums;t) eeoir iytlpD an sl()tetmxm iodamee ict sfarumx  nt1olx  ociasla2ranvp;(0artnxf3tytlpt aues s)srtmxm oo1alee nctl()artau  ;u0tpx  o3iadfsDeanvs (0trerir oatlm e nvi;s trto(mpio1op  lfeia(fs2urxr ;u4altomoctldlsDrmuvont) ltniociatlat  n sl( sexm(r3ny1aptnmictls)arrrx p;u1alxomieiyd s2el( o ()tlenmo oatomDrlivol()t2umxrpou1ole  ncta(fsrta( ono4apenmfeils m ulnvp (0tltnxfcio1la elieil()s2tm(r3ou4apee fvs t  Dta( p;o4ope if3iys mDra( o (0trenirciytfptraneol()t2trxopnudapenliet (f rtmx  ot4opt ioctys m rm( s (4tlxnio3todom e uvi () exr(m iy4am elfes t) Drax  no0tlx if3iltfm ea(vo t4alxnxr3iytfm  an o;t0 rurxopoo4om nmivsat)sDraxr ;t4tlxoiictysfsDumnvp;t) ltnmfcio1faDraies;t)srxoxr oy4am  lnctl(fs2umum ;u0oetnmfeiltfs ra(ms;t4aleoxf3iodomtraieo t0s2trirpiy4ome  fviatfa2rr(mpoo0optnmiciadfsDrlnvo;t4 ltoio iatoaDranes ( tetmim3iy1alt  netat)a2rmxroou4oex mf3iytfa em( o (0aexnxrcootfmt auvo ()sruo(m3iy1olte netl()a2rm( p;o1oexn iciydls2elnmp u4treoxfcoodoaDe nvils) exoio nu4ap  mivs tfsDrmum ot4aeeoii3tydls2eauvp u4tltrio tadfatelu s s0teurxopoy1aptelncil() 2trx ono4tpeoii3ild s uaums t0tleoio ia1laDe n s;(0 rxoxrpio4aptnmncsat a2uaur ;u1apxoiiciatlaDrl( o;()arxoxf3iy1fm r ueslt) ruo(rpio1om   icia( a2umur no1alxoiociad sDra(mp;()teeoxo3oytfp eauvo ()s2uoxopiodamtn fvs tfarrrurpnt4apxo i3iadfs2rm(vs (4aeenircia1lpDrli sl(  etmxrpiy4lmee ictas arumxm no1aeen octas m2rmnvo t)aetnxf oatoaDr u s ()s2um(r3nydlmee fvs tf rtmu ooo1aeenmoeilt mDrauvpnt4aetrmr ia1oaDrlieo;t) exo(r oo4amtn nciat a2taur ot4oexnmieiadfs2rln o;(0 renxr oytlaDe ivs;t)srtrio nodal elfvsls a2ua( oot4tle mfeildfsDrmn o;(0 rxrio3iodfaDelnes;s) 2tmxrpnu1oltn iesasf rra(m nu0altomoctyd s emu snt4treomrciatlpDe uvs s tetoxo ny1aptn fetas artrx oou1opt ifcildfm2emuvs;u4tetnio3oytlpDe ivi;s srum(r oudame mfcs s) 2tau  oo0oleniociat m2ra( sn(0 rtomo3ty1op elivsls)trto(o oy4omtnmnetlt  rra(r ;t4tpxomoctltlsDeanmp;t4alenxr ty1fp r nvsl( srtmxm iodllte fvia( s2tmxmo;o1aexn ociysla2ul(mont0tetnif oa1fateluvilt0teumxm3oy4ape lietas  2trxronu1olxn octld m rlnvsn(0tlxnxo3oy1lmtean s s0 euo(o ny4am e ivta(  rrru o;u1apt  octydfaDem(vs;(0tltoxfctodfp  an s s0tetoio3iu1aleemfcil( arurx p;t1texn fctldfa2umnmonu)tltoxf oatoateaivo (  rxmim3nu1ope lieslsfaDrrxr oo1oltnmictadlaDea(mp u) rxomfcty1oaDeanvi ()sruriopou1alt mnvs () Drm( pno0tlxnmoctatfsDrl(vo;t0arxnmocoy1oatrlueil(0 2urirpio4amen nvias) Drru o;t1tlenmoeils a2eluvo u4tetoio3iadlpDe ueo s)s2to(m3oo1ll n nci sfs2raurp;u1ale  ietat s eanms;()trerircta1om e ueols sexmxr3oy1llenmfcil( arta(ronu4aetnmi3tlslaDrauvs t)teeoir tatlpDelivsl()srxm(o iy4ame lnes sfs2rmu  ou0texn octatfs2elump;u)trtrmfciotopDe u s;( t2triopiodomeeliet s s2trurpnt4tlx  icias s2uan o u4 lenmr3oadomte ivi;s)setmxm3iy4lltelfeiat  rtax pnt1aeenmfeiydlm rmnvo;u0trtrxf3oy1fa rlieilt  euo(o3iudomen fcsat  rum( poo4tpe mfeiytlm rlnvs (4arenmocty1fateaiesl()texr(mpoudoltemics t) rrau  oo4tlt iicils aDrl(vpnt)aexrio ootoaD au o;() rur(mpoo1amee nes (fsDur( pno4olxnmf3iltfaDuaums;u4 rtoxfciytfpteaieo s)t2xmxo3nu1om emivsa()sDua(m ou0tltnifeilsfsDumuvp (0aexrir3io1fat  u s;( s2urir3no4ol   ies ()a2uru p;o1alt ioeilsfs2ran pn(4tetoxfciatomteln o;t) ruoirpoydllt  iesa()srra(rp;t1opt  i3tld sDemn p t)artrxrcoydfa rli s s0srxmir iu4oltelfvilt artrx pno1olto ictytfaDrm(vs t0 etrxf3tydlaDeanes s)sruoxm3ny1oltnliei (faDtr(rpnt1texnmi3iys m eau s;t4artoif oadfm rlueo;s0trtoxo3oy4omtelieil(farrrump;t1aetnifctld mDumump u)arxrxr iatomDr uvo s  rtmirpny1ol nmivsltfarur(rpnt1aet ifeiatlaDemnvpnt4altoir io1fa rlnes ()setrxm3oy4lmtnlnvtl() Drmxroou1alxnio3tyt s2em( ont4aetrmo3oatop elu s;(0 eurirpoo4ll elfvils) rtrumpot1aex  ieiytfs2ra(vpnu)arxrif oy1om rlivol()sruoxo iy4apt mfesls) Dtmur oo1teenifetltfaDua(vs;t) lenxf oytop  li o;s0s2xrim oy4optnlnvtlt srurx p;u4opeomietasfs ran snu0 rxoxr ia1lm  lu sl(  rtr(opiu4omeemici t  2umumpou1olx  ocilsls2rluvpnu4artnxr oytlat aueo s0t2toxr3ny4ll emnvslsf rtaxrp;t1altnif3iadls2emuvo;u0 ltnxf3io1faDrlnvs t texrxmpno1omenliesasf 2tmumpnt4tlxnii3iys m ra(vp;t4alxrxr iodomtr n s;t trxrxmpnu4olt mncsat a2umx oot1tlt ii3tlslm ulu o ()areoir3oodoat aies;t  etmxm3iy4opt lnetat) rur( o;o0opx  f3iatfm ul(vo;u)teeomr3oo1omDrlu sl(0texmio iy1op e nctat a2ur(m ;t4oet mocilsfm ua(vp ()aeenmo oy1laDeai o;(0s2xmimpio1ol emfetat)sDumu pnt4aeeoifeias a2ranms t) lxoxociy1fpDe ieslt0 rxr(opiu1oleemncilt)aDra(  ot0openifciydfm ua(mpnt) reoir iy1fmtrluei;(0s2xmir3oy1ale lfvtlsfarta(m ou1tltomiciaslsDuan s t0teermo3iodfpDr nvslt)s2umxr3ou1ape  iviltf 2uax o;o4aptnmieiadlm2eanmo t0aexrxfcio1laD luvol( s2tr(mpoodome mnetlt)srtau  ot4tlxnio3tldfm emnvsnu) rermfcia1fm rlu ils) rxoir3nydll  livtl()arraxm ot0olx iieilt sDum( o t)tlxnxo oodla r i olt0 2xmim3oodlmtn ivi ( sDrmuro;t1tptnmfcildlm umnvsnt0tetoxf3oatlaDelneilt) rtm(mpnodom e ivias)aDtax ooo1texomoctyd s ea(ms u)aeerxo3ootfatrauvs ()teto(m3io4al nlfcil(faDrru p;u0oltnifciad s2eauvs u0tlxrxr todlp   u i;s srxo(m ou4apen fet s s2taxm nt0teto i3ias a rlnvp ()teerif3tatoa e uvo t s2uriopno4llen fcia(fartrxm nu1oet mfcild m rl(vsnt0aexnxfcia1om r nvslt trtmxr oudop elnciatfs2truront1oeeniociyt a ul(vont0tlxrmo3todlmt  n o;(  rxoio3iudlmtnmnctas arua(roou0apto octatla2rlnms u)tlxnxr to1lm   neo;s)setmxm nu1op nmici s  Dra(moou4aetn i3iysfa2em( s t) renxo3tatfptrauvs;s teuo(o3oo1ome mfct ( aDuaxmpou0tee  ietlsfa uanvo;(0arxomf3to1fptrli s s0t2xmxm oo1ome lnesltfsrta(r nt1oex mfctadls rmnvo;(4arerirctadomte uvi s) 2to(m oo4ol  miciat)srrm(mono0ape  fctlslmDel( s;()tlxrir iadlp  li o ()tetoim3io1amtnmnci (faDumx p;t0aeenioetas s2elnmsnt)aexnxf iadfaDr nvolt0 2toxm3iu4omte fct s)sDrau pnt1apxo ictasfmDrlnmpnt)aleomrctytfpDr ivol()trxrxrpio1op nmictl(  rtaumo;u1tpx  fetyd s ran o;t)tlerif3ia1opteau i s)srumxrpoydlptemiesls) rrrxmo;o1tee moetas aDem(mpnt) exnxf oydfmDrau i;t s2xrim no1ameeliet t a2ra( p;t1texniocilt aDrl(ms;u4altnxf3tatlmDr uvs (0trto(m3ny1lpe lfci s) rtr(r nt1tptoio3ias s ulnvo;u4altrir3iodlpt ai i s0trum(m iodap   nvs t a2rmumpou1oeeomi3ild aDrlu p;t) reoxrcia1oat anes t setrxr nudlptn fvtl()aDurxrp;o0oltoifctlt m2ul(mo;u) etniociotfp raueo (0 etmimpoy1lmenlnvtas)artaxmoou0oexo feiltfsDul(mo;t0tltrirciotfm  auvo (  rtr(o3nudam  livia(faDtr(r oo1tetnmfeiyt a eaumon(0trxrmo3oytoate ueilt)texmio3ny4alen fvt t  ruax o;t0openmfctytfm2ea(ms u)trxomoctadfa  aies;t)t2tmxr nu4amen fciasfaDuaur nu1oee mieiasla umnvsn(0 rxomf3iy1lpD ln s;s0srurxr io4omtnmictas aDtaumoot0aeeoifciadfm2uluvsnu0tlenir ootomt li s;s0srumxr nudom  lnct s)sDrmu o;u1tpt iictasfs ua(mo;t4tlxnxrcta1oaDean s t0s2xm(o3ny1alenlfvs t)artm(mpno1opx  o3iaslm uanms;t4tltoxrcoytoaD lieilt0srtrim3no4alen nci (f Dtmumpnu1aeeomi3tatfs2rm( p t4aexnio3oytlm r nei s  rtm(r iydam nmfvi ( srraxr ;u0tlenmicilsfaDul( o t) etnmf oo1omDeln i;t)trtrxopnudamtnlncils)sDtrum oo4apeomf3tlslaDumnmpnt0tlxrmo3tydomDr ivo;s0srxoiopnudlme mfvta( arrru onu4optn feiyd a umums;u) lxomo3iodlpte n slt)trurxm iy4opt lics s arra(mooo4tleo iciadls2eauvp;u0 lenxr oy1omDraivol() 2uoiopio4lpenmncia() 2uru pot1aetomfetltfmDumump u)tlenifcoytfpDr nvi;t0sruoxm oydlmen ieia(f 2ur(ront1aet mociytlm2eln on(4trxoio3iotoaD  ies;t  2tr(o3iy4lpen fvt sfsDur(rpoo4altnmf3tydlmDrm( pnu) eeoio3oa1om e u i;(  rxmir oy4lp  lictls) rrau oot4tpt mfcilsfa2rmump t4texoir3totfp  anvi;s) rtmxm oudaptnlfci sfs2ta(mo;o4opt mo3tld s2em( o t4 rtnxr3tytfp elies;( trxo(o3io4lptelfct tfarrmum ot4aetomi3tatfm emnvpnu4 reoif todomD ai s;( setoim3ny4opt mfci tfartmxrpnu4oet moeiltla ulu p;t4trerxo3oo1op  aies s)seumim3oy1lp  mfvil(f 2tr(mont0oltomfeiadfa ulnmon(4aetoif oadlmt ln o ()srtm(m no4aptnmiesl(faDur(ro;o0tltoiictysfs2eanvsnt)treniocio1fa ran ils setoxm3iy1lle  nvt sfsDrm(ro;o0aet  feiyt a umn o;t) eeoifcoodop rlueo;()trumxm3nu4apt mnvi (f rrau oot1tpenmoeiydfaDuanmp;t4trxoifcoatom  anes;s) eur(opno4ol n fes s)aDrr(mo;t0olxn fciyt aDul(vp u)artoifcoadopt livols0t2urim iy1ll n ivsls)a2rr(m ;o4tlxnifcias a elnvo;(0tlxnmr3tatfpDeaivs;t0sexr(r no4omte nci t s2umxrp;t0opt miciasls eau s t0areomfcoy1lmD anei (0s2tm(m3nodal e nvs sfa2ta(roou1tltn ietadlsDul(vonu4alxomr oatfa elnvi;t)srurir iy4llenlietl(  Drrurono4oetoiieiatfsDumu pnu4 etoxf ia1fptelieslt sexmxrpiydol emivsa( a2taumpnu0aptoiieilslmDrln sn(0texrxr3io1lp rliei;( tetr(o3nudope mfvsat aDtrum ou0aetnmo3iysfa2eanmp;t) lxnio3todomDeai sl()srxoxopiodll   fvil()aDraxronu1apt ifetadfm2elu snu)trenmr oytop elues s) exo(opoodlmt  fvt s) Draxrpoo1apenmietatls2elnvp t0 eeoxo3to1fmt au s s0setr(m3no4al e fetlsfaDrrur nu4apx  feiadfs umu p;()alermrcto1faDr neil( t2toxm3io4om  lfcslt)srtrum ;t4tlxo o3iys aDra(von(4tetnif3ty1fpDeau o;s teurxm3io1amee netl()aDur(ro;o4olt  oeiyd aDuau ont0artnmf3oy1fmDr uvs s)sexr(opny1ll e ncias  Dtr(moot0aptoiicilsfm2rm(monu0 eenmfcio1faDrluvs;() 2xm(o oydll nmiei (fs2taxro;u1opx  ietldlaDemn p;(4 exrmrctytoa r nvi s teurirpio4omtn fcta()sDrmx o;t0alenmicild m ea(vp u)trtrxr3to1oa  lu i t0seumio3oydlpenmfetl(  2trx  nu1oexomiciatlmDulnvpn()trxnmr oytfa r neil( t2xrxmpoodlpe lnet t  2tr(  nt0opxn o3iasfsDuluvs;(0texoio iy1omDe ies;s)srxm(o oo1llte iet t aDumurp;o1tpeoifetatls ul(vpnu)altrmr3tadom   ueil(  etoiopoudame mietltf Drrur ;t1olxomoeiatla2eluvs t) rermfcio1la eauvs t0truoir3oo4lp elfetl() 2tmxrpno0olxnmicias sDrlumsnt0 ltnmociadfmDeaneols)s2xmimpoo1omtemietls  Dumump;o4optn f3tas sDul(ms;(0 eenio3ia1fmte u s;s s2umxrpoodomen nvia(fsrua( poo0olenioctlt a rmn pn()aetnmr3ia1fmtelu s ( srxrio3oo1alt mfet (farumxm ;t4apt mi3tltfa2ra( o () rtrmr3ia1fm  ai ol() rxmxo iu4llt micsa() Drrxrpoo0apxn ociat aDuanvs;u4teermo oatlaD anvi;t)s2tmxr3oudalenlfct sf 2ra(rpnt0aex mieiasla2um(ms (0aexrxo iatlmDrauvi;(0texm(r iudlle  nvia()sDrrxmpou4apt moctadfsDuanvpn(0trxnmr3totop eliei ()sexmxo3io4alenlfcs sfa2urump;o0tpt mfetlt aDea( s () exoircta1oaDelivi s  euo(rpnydal emiviltfs2ur(rpnu1open icild m2umn p u)aleoxo tytom eluvo s t2toir iu1om eliesls)a2ururo;t4aptnifetasfm2rm( s;t0 ltrir oydfm r nvsls)setrxmpiudoleemfeta( s2umumpnt0tlxn ieiadfa2rluvonu)aetrxoctodlmtr nei;( trxoiopiy4open fcta(fa2trx  nu4oex  octatlmDum(ms;(4tlxrmr oodfpDeliei t trumxo3iu4amte fvt s aDua(mpou0apxoif3ias sDel(mpn() etrmf iadop rluvol(0 2urio3iu1lm nmnetls  2uaxmoou1alto ieias sDua(vp;(4trxnif3iydoateanvi;s) etm(rpoo4olt lfvtl( a2uaxmp;o1aexnmi3tlt s2ran s;(4teerxf io1lp raues ()trumir iydlpenmfvsa(  rua(rpnt1tlx ii3iadfs ranmo t4altnxr iotlpDeauvo;s0teuo(mpnydoptemnvia()s2rm(mpoo4tpxomfctldfa2eau p () lxoio oa1lp   neo;s0 2xrxr3oydop   net t  2rrumpot0aeeomietls aDuan snt4arxoio ootop   u s;s0trum(r io4om e ncil()arumxr ;u0tex  ietydfa ra( ont) ltrxr todfpDe iei t  2xmxo io4llenmivtas)arrrumont1tpt  f3iysfs elumsnu)trxnifctodoaDraieo;t0 2uoxopnu4omee ieilt artru p;t4oltnmfctadfs2el(mp () etnir3iatfa r ivs s)trxo(m3ou1lmeemictasfarumur ;t0oltn ocilsfaDrlumo;(4 eenioctotlp eaneilt)srto(opnydal elnvsas s2rmx o;o1oleoiieilt sDul(mp t)teerxf oy1fatelneo;s0srurxopno4aptnmfctl() rta(mono4alt mfctatfmDranvo u4trxnxocia1op rluei t)sexrxopiudoltnlfvs (fsDur( poo0tee moetat a emump u0trtnxfcoo1lp rauvils t2xr(opoydlmtnlnvtls)a2ur(monu4aetnmoeilslm emu o;t0 lenio oo1fptr ueil(0 etrim oudlpe  neil(  rtmxrpou1oltomociltfm2ea(mo u0artrxocoatfa  lneol(0 rumxrpno1omenmfes t  2tru pno1texnmfciat aDrl( sn()alerxf tytfatrauei (  2toxr3oo1al n ietas)s2um(mpoo1olenmociydla ea(vs;()trtnmo3oodfate n il(0 rtm(r oo1ap  mfvilt sDrmx o;u1optoiiciysfs umu pnu4tlxoxo3iy1fa eai ilt texmio3nudlme lfvtlsf 2rrx o;u4aee ii3iytfm uln s;u0texoxr3io1fptr u sl( t2xm(o3io1omtelnct s)arua( p;t1aee  f3tad m2rl( ont4 rerirctatoaDrln i;s0 2xrio oy1om  mnctat)srtrxm ;u1opeoiieilslsDuan onu4 eeoxf ia1laDr i ols0sruo(o ou1aleemnvt t)aDtax  ot1tptomi3iytlm elnvo u)texoif3iy1fatrauvil() 2xmirpno4llenmfvta()srur(rpoo1optnmi3iytls2emnvo;()treoio3io1lat aieo;() euoiopno1lleemnvi tfa2rrumooo4aetn i3iytlsDranvs (4 eermf3iotoaDr nvils)s2urxmpiy1oltelieilt s2trx o;t1tlx  o3iasfs2uan on()artoxr3iytfm raueo;t0 2to(opiy4lle lfesl(fs2rm(  ot0oetn i3iytls2rl(vo () eeriocta1lmtraivo ( s2xrir nodlm nmieils  Drrumoou1olxomf3tydlsDeln snu)tetoir3io1lat luvs;t) 2tmir3io1lp   ncsls)aDua(mpou4olen i3tlt a2elu s;u)alenmfctytfm rlueo;t srtmxmpio4ale mnvsa( a2urxmonu1aeenif3ilslm2ea(mo u)areoxr oytfatrln s t0trxmxo3nudlme lfvsltfsDraum ou4apeo fciytfmDrauvo (4alerioctytfptrluvs;(  euo(opiydllt mnvt s) rrm(m ;o1tleomociad s eanvs;t4 leoxrcoa1fptr ivo t)srtoxr3iudalt liviasfs2tmumono1tlxn f3tlt mDua(vs u0 etomo ty1opt livi ( sexm(r iodllenliei t) Dua( oou1apen ieilt s2eau on()tlxrmrciydfm r u o;s0srxmio oudamenmnci ( arrmxr ;o1altomociytla elnmo;t4aetnmr3oa1opDrlueol()s2uoiopio4lleelfetat artmu ono1ale mi3iat a2umump;() leoxfctadfmDraies;(0s2uoio iydape  ivi s)srrm(rpno4tlxnmicias m2ulumon(4 leniocoydfpteli o s)tetoxo nodole mfes t  2raxmo;u1aptomfeiasla2ul(mp (0aeeoxr3iotfm   n sl(  etmimpny1omee fcils s2rax  nt0opx  f3tadfa2rauvs t)aexrmo iy1op elivi s0 rurxo nudam n ies t)arur(ro;t1tpenmfeiadlm umnmonu) exrircty1om eanvslt)s2um(opio4omee fvi t)srrmxr ;u4olt mo3iad aDea(vs t0 exnircoytlp e nvo ( trxo(m3nydop  lfvsls sDrru p;o0olx ioctatlm rmnmp t4artoirciodoptrli i;s)trxrir3ny1olenmieia() Dra(rpou1apx mfctlslm2el(ms;u0teeoxf io1lpt livi;t  rurim nydal  lfvi t)sDrmumono0tlt iictys s2eau onu0tltoxf ty1fmDelnvo;()srxm(mpnydol nlivtl( aDrmurpou0tetomi3ilsfsDulumpnu0trxnif iy1fmtr i o;( srxrio3oudll n fci ()aDtrumo;t4aet  ietltfmDemnmp;u) rermo3ta1opDe nvsl()t2tr(opny1am emfcta()sDurumont0alt io3ildls2rlu s;t4 rtnir iadlpD aivi t srtm(r3iy1aptnlnct t s2uaxr ou0aptn oetydfaDuaumo;(0 renxr tadlpteauesl(0texm(opiydal  mnetatf rtrxmoou1tpt  o3ilsfaDuan pnt4 renmo3iodlpt lnvils setrirpoo1lleemicilsfa2rmum ou0tpxo oeiydlm2emnvs;u4tetnxf oytfpD  ivol(0sexr(m3oo4altelnciat)sDrauro;o4oleoiociasfaDumnms u) leoir iytlpt lueo;(  ruo(o3nydomee fviat)s2tm(monu0oex  ieiytfs ua(vs (0teenmfcio1oateaueo ()srxoio3ny1lmtelnvsls)artr(ro;o0oetoiieilsfmDea( on(4trxnmo oytomDeaieo s truoxmpiydlltnlfci sf Dtau  ;t4aetnifctatla rlums;t) lxrxocootfpDeluvsls0 rxmim3iudam   ivtls arrr(r no0openmictlslsDeln o;t)texrio3tytop  anes;( s2uo(o3oodlptnlnvsas)aDumxront0tpen oeiatfs2eaumpn(4trxomr oo1op rluvol()teuriopoo4al eliesatfa2tmumo;u4aeen i3ildfa2rl(mo;u0aetnmf iadlpD  neslt)s2xrxm iu4llee icsa( s2rrumpnu1oexomo3tytls2eau s u)treoxr3ta1lmtraiei s teum(o iu1ape lfcs tfarurur ;u0alxomicild m ea(vs u4 lxrifcto1lptrli i s0texmir iy4ol  lfeilt sDrmxmonu0tlx mi3iyd mDeluvon(4altoxf3oytlpDranvi;()t2xr(o iy4amenmfetat aDtaxrp;o1alx  o3iyd m ran pnu4aeeoif3tatoa r ivs s) exo(r oy4ap nmnvt (fs2ua(m ;u4tex mi3iysfm um(vp u)alxrif iadfpt lu s;s)trum(o3iu4lleelieils) Dta(r ;u0alxnmo3ildfs2elnmp t0trxomr3iodfmDraivs;s sexrim no4op nlfvsa() 2urur ot0teenio3tlsfsDraumsnt0tlxnxocia1lpD auvolt s2trxr3iodll  mfvtlt)s2um(r ;u0olx  octldfa ul(mo;t) rtnmf3oydlp eaueo s)t2xm(opoodolenlfctlt  Dur(m no0aee if3tysfaDeau s (4tlxnxr3oo1omD luei;s)teuo(r io1lmeelfvs s srurx  nu0teeo oetld m umnvpnu)aexriocto1fmDraneolt0t2xmxo3iydlle lfeia(fsDra(r no4open f3ias a uanvp (0aeeoxo3totlpD  uvilt  rxo(o iu4lpeemnvslsfsDrmurooo1oeenmfcilslaDeanvp;u)tetrmo3to1oate nesl(0 2uoir oo1aleeliciltf rurxm ;t1oex moctyd mDemumsnt)trxoxrcoadfaDeanvilt0 rtmxr iy4llte iet s  2trx pnt0olx  ociatfa2umnms;(0trxnmr iy1om rau o;t0setr(rpiu1llte neil(fs2taxmpoo4oetoiiciatlmDulu o;t4 reoxf iytoaDrau i;( setoxopoy4optn net ( srrr(ront4tlt  f3iysfmDea( s (4aexnxrciydoaDeaiei t) 2urim iu4opte nvias)a2ur( o;t0ole ifctydfm2em(mpnt4texnmr ootlp rlieilt truoio3iu1lm  lfci (faDraum oo0tetnii3iatfsDrln o () rtrxrcio1lptrlues;s0s2ur(opoy4omeelnvi tfarrrumo;o1oeeniieilt aDrmnmp;u)aeenmociadla  ln sls  etmim io4am  lfctat)s2tr(ro;o0tet  ieiytfsDrlnvpnu0teenmf ootomte nvs ()srxrxmpnydamenmieilt  Drrxr no0open icilt m rmu ont)tltrmf oo1fpDrauvs;t trtr(o3no4opt lnesa(f Dumu pno1aetomi3iysfm2ean pnu0 lxrxrctadfmte i ilt)sexm(o3iydopte nvsa()s2tm(rpot1alt  octysfm2um(msn(4aexrmrcoadomt ai i;()s2um(o nu4optn nvia()a2rrum ou1aeenmf3iad mDuanmp t4 eenmoctytlpt aivilt0s2xoxr nudamt lfctat sDtmur no1ale mietlt a ea( pn(0trtrxf3totlmte neo (0s2trirpiydopte nvs sf 2trxronu1aet io3tas s rlu onu0artrxocoadoa r n s s  2tm(o oy4llenmivta(  2trxm oo0oetomf3iatfm eau s;t0texnxf oatop  lies t0trxoim3iy4lm emieia( sDtmumpnu1apeomf3tyslaDra(ms t4 etnifciodfat luvi;( seto(r3ou1ap  lfviat sDrmxm ou0alxnmf3iydfa um( snt4arxomo tydlmtrauvilt) eurir3io1alt  ictlt) rrr( pou0aptoiietad s2eluvp;u)tlenir3iydlmDe i o;( trxm(opny1lptnmnciat) Dtm(mono0aleo o3iytfa2umump u0artrir ty1faDeanei () rxrxrpoy1openmfvsls)sDtrum nt0alxn iciydfsDea(vpn(0arenmf3iotfaDeau s;s0teuoirpiy1altelictls srumur ;o4ale  fctaslm ul( p u) etoir to1lp   nvo;t) 2xmxr3oodlpeelfesl( srtrumo;o4tlenmf3iyt mDulnvp t4 reoxf iytfatelueils)setoxm ny1ol n nci t srur(m nu1oexoii3tasfsDrmn s;u0tlxomo oa1fp  ln o ()seuoio3nu4lme lneil() rrm(m nu0teeoifciltfs umnms;u)trtnxr oo1lmtraueo () eum(r3oo4ap emneilsfaDumum ;u0alx  ocildlaDumn p;() rtnmf3tydomDe iei t) 2xoxr no1altemfesat sDtmx p;u4alt  feiat aDulumon(0 lermrcoydoa eaneil()setoxopno1lp n iesls artmxr nt1apeomoeilslaDeanvo t4trxoxo iodfp eaneolt t2tmxmpnydol  mnet ()s2ua(rono4ope mi3iyt a umuvpnt4 rxoxf3oo1op  anvo t trxmio3iu4ome mnvi (  2tax pnu0apxomocilsfsDea( pnt)teermf todlp  luvi (  2umimpio4om   ici (  ruax o;t4apx iictlsls2rm( o;u0aleoxo oodfmtrli s t0s2umxrpio1open ivslt)artaum nu4aet if3ildlmDemnms t0trxnxf ty1op  auvo (  2urxopno4alenlivs sfsDraxronu4tlxomietyslsDelnms;()tlxnirctodoa rluvi t s2xmxr3iy4optn nvsa()srra(rpoo4aee  o3ildla2ea(vsn(4teenmr oa1lm e uei;t)sexr(m oudlmtnlfvt s)sDtm(r no1tex  o3tlslmDel(mp;u)trenxr3todfpte nei;()truo(opou4aleemicslt)arrmumpoo0aeenmictysfm ulnmpnt0teerifctytomtrln s (0 etoir nydlme lfvtlt aruax  ;o0tpeomoeiyt m rlu o;t0arxrxr3iy1omtrlueo;s0trtm(r3ny4apeemfesa()arta(moot4tlx iietadla2rlnvonu0arxnxfciy1oaDrli o;s0trtrxo oodameemiesa()arua( p;t4olt iietytla umuvpnu4 leomo iatlaDelneo ()srxoimpny1om emfei tfaDraum nu1tetniictydfm rauvo;t0tltriocoytlmDraueslt srxrxopno1lpen fesls)aDtruro;t4oetoifeiydlmDelnms t)altoxf oytoa elnes;s0 2trirpiu4optelfet s aruaxr oo1tlx  ietas m2ra(ms (0arenxo iydfa  auvo;s)trtmimpnu4ale lfctlsf rtrxm nt0apxnifctltls eluvp;(4trtrifctytla r uei;t  etrimpoy4am   nei sfsDum( pno4alxomfetlslsDrm(mont)texniocto1lp ranes (0 exoxr3nu4olte ivtatf Drm(monu1oexo oeild m eanvs;u0aeeoifctodfm eau s t0 exoxm3oydomt lietlt) rrmuroot4tpxoioeils a emnvp (0 rtrxr3ty1fm  ln i;t0 2xmxr iu1alenlfeil()sDurxroot4apt mfciatlaDeln snt4tetnio3tatlmtelieo;t0 2xm(mpoy4alenlfetas  ruauroot0olenmietldlaDean s;()arxoio3oytomD aivo;s)texr(o3oy4lle lncilt) Dtm(m ot1olx  fetldls uln on(4 rxoxo3todlpt anvils trxrxo3oy4ap emnetlt) Dta(mo;t1opto i3iltls emums;t0aeeomo3iadfmDrlu s;( trxm(m3oydape  ncs sfarur(m ot1altomieilsla2rmnvo (4 rtrxo3tydlp e nvsl() 2xoio oo4omt  ieta(fsrtaxr no0aptnmf3ilsls ean on(0texomocta1fm elivs;()t2xoimpnu4lm e ivia(fs2rrump;u0tpenmi3tytlmDrl(vp (4aexriociatoaDeanes;()trtoim nydap emicsatf rraxmp;t4apen ociasfaDrauvs;u)arxnmo ootopDr n o t)sexoxr oodlpen nvsa()s2tmumpno0tptnmieilslm2uluvo;() rtomr iotfpte i sl( t2xo(o iy4omenlncsas arrax  oo4oeen i3tyt mDemu p u)alxomocia1omDrai o;s) eur(m3nu4apt mfet sfartaumooo0tee mo3iydfaDea(vo;t)aetnmf oadfmD aivo;s)t2xm(m3ny1ol e net s aDrmump;t0oltoiictat m rlnvo u0trxnmo tatfa e u s;t0 exoxr io4lp nmnctl(  rtaxmont4tpe io3iadfa2uau o;u0alxoif3ta1fa ranei;s) 2toxm nodapt liesat)aDtaxronu1texnmfetytla2raums t)aexrmf3ta1omtrln s;t0trto(m ou1ll n icsa(fsDtm(m nt1tpxnio3tytlm ea(msnu) lxniocto1fa raiei t trxrirpno1lltnmfesa( srtrxrpoo0tle ifciys a2ea( s t4alermf3iy1lm  aies;(0 eto(o no4apee icsatfsDrrx  ot1aeto icilt a ra(ms () rtnxo todlp   u ol()trxo(m3ny4lptn nctls) Dururpou1tpt if3tlsfs emu sn()trxoircootlmtrliei;t)s2xoir3iu4om n fvsat  rrrxmont1opeomfcias s2ulnvs () rxrmf iy1lpt luvils  rur(opnydopeemfct s s2rm( ooo0tltoii3iltfm ranmo;t0 exrir3iy1fpD auvo;()t2toxm3ou1olt  neiat) ruaur ot0opx mocildlmDua( pn(0tetnxf tadfmDelivil() rtoimpoydom nmnvs ( srurx o;o1oltnioeilt s2ranms;()arerif3iodomD aies;(0 2ur(r3oo1ol  mnvsatfaDtru p;o0tlxnmiciltfm2eauvo t)aeerifcoy1op rai olt0s2xriopno4opeelieta(  Dumxrpoo1ope ii3tad s emu s;u) etnio iydfm r uvi;t)seumirpnu4omtnlfetas)aDta( pnt1olxo octlsfmDel( o;t4tlxoiocia1opteln ilt0texr(o3ny4omeemivsas)a2trxmpoo4teenmieiydfs em( s;u) rtnmr3to1lp eaivs t)s2trxm3iy1opee fet s a2tm(r ot4tlt mf3tadlm2ra( pn(4 ltoxrciatlp eaivs;s seuoxr3oo1ome  neslsfs2tr( p;u0oexnmf3ildfa emn s;t4alxrif3oodomD luvsls0t2xrirpnydamtnmnetl(fs2tmur nt0tee  iciasls el( p t) lermf iytomtraieil() exrxm ny4opee ieil(  Dtmxmooo4tpx if3iytfmDrmnmo t4 rtoxf oadomDe i s t0s2ur(r io4lmtn nvt t sruaumooo1apx  fciyslm2rauvp () exrmo tatfaDrliei;t srxo(opiydop n nctl(farurx  nu1openiiciytfaDeanmo;(4arenir oytlm  auvol() rxoio3iy4ole licsl(  2rr(rp;u1aet mfctadlaDrmnvs;()arenmf oadom   uesls) 2tm(rpiudlpeemfvsltfaDta(root1texo f3iadfaDelu o;u) etomo3oy1la rlues;t t2tm(mpoy1apt  fcsatfsrururo;o0oex mociydfaDua( o u4tltrmociatoa e ivi;s tetrir oodop elnvsas srra(  nt4teeo i3iadfm2uan o;t4trerioctydlpt lnes;( trxmiopnydom nmfvtatfarur(mont4oee mo3ilt mDeaumpnu)teerxociy1lat aieo;t srtr(o3nudlltnmfci (fs2uax poo4ope ifeild sDrlnvo (4 lxoxfctatoa e uvo;s0t2toxr3ny4amt lneiltfa2uaxm no1aee  feiad mDemu pnt4 eenmo3iadop elueils sruo(opnu1om  mnvi s  Draump;t4opx mieiytfm2um(ms;u)aleoxr3io1lm r ues (0sruoxm3nu1al  licsltfa2rmu  nu4oeen i3iydls2ea(vsnu4 rtnxf3iy1latrai o ( teur(opnu4lpe mfvil( sDrr(  ;u1openif3tydls2ul( snt) lxnxfciotop  li i;(0trur(opiu1ll elfvsa(f Dtax ont4oee mieiytlmDra( o t) ltnxr ty1optr ivslt  etmim3oy4am n fesl() Drauronu4alto fetatls ea( s;t)trxoxf3iotfpD lneil(  rumio oy4llen nvsas) 2raur no0oltn fcildlaDem( o;u)arenxf3io1faDe uvs;s0srumxrpoo1op nmiesl()a2raxrpno0opxomoctydfs umu pn(0arxnxfcoadoa ranvi t0t2toxm3oy4apt  iviat)a2tmumo;u4teeoioeiadlsDum(vs (4 ltrmocta1fpDe i i;s)trxrxm io4ape mnvs tf 2raxmpnu4oltoif3tyt sDemums;()arxrxr3tatlmt  uesl()trxm(m3nodlpeelneia(fsDtr(mono0tpe mictadlmDemn o;t)trtnxo oa1fpD  ies t)t2toio ou1oleemici s) Drm(  no4aex mi3tlsla2rluvsnt4 etoif iodopteanes;s0s2umir ou4apee icsat  rtrx p;u1alxomi3tytfm ra(mpnt4alxrxr3oy1faDeli i;t)tetr(o3nudomt  fctatf Dtr(rpoo1opeo f3iyt aDul( o u0 etnif3iodfpD  uvslt0 2xmio3nu1ap e fesa() 2tmu oot4tetoii3tadfsDelnvs u0teeoxr3iotopt  i sls texrirpou4llt  fvil(f Dtmxmoot0openmiciysfm eanvs u4aetnxo iy1oate nvo t0trxm(mpoudomtn fesa()s2rr(  no0tlto ociydls rmuvonu4teerxfcoodla eaues;s0trxo(rpno4ame lneil( a2ur(ro;o0tet mfciytfaDranvs u0tetnmr3iotfp r ieo;t)trxmxo3nydlltelnct tfaDrr(ront0ape  fciadlm rl( o u0aetrmf3ia1lmD li s;s t2to(opnu4olt  fes t  2rax o;u4aeeoiietysfs2umn ont4altrio3ia1lp eliei;t)s2tm(rpoo1ame  ivs ( a2ur(rpnu0tpx ifctydlm emuvo;t4 lxnmf3iytop raivs;s  rurxrpnu4om nlics ( a2taumont4aee mfctldlmDrm( onu)alermf ty1lpDrau i;t) 2xm(r ou1alee feilt)sruaur ;o0aexniocias m2rmn p (0tleoirciotop  an o s0setm(rpny1oleemfei t) 2tr(moou1tltn f3iaslaDuan p t4artoiocia1lpDelivil()t2toxrpnu1am eliet s sDtrurp;o4texniicils mDran o;t0tetnxrctadfpDrlnei s s2ur(rpiu4lme lnvs t srrmum ot4alxomfeilt s2el(vo;t4 lxoxf3tadoaDeluvi s0s2tmxm3io4amenlfvil( a2ur(r oo0alen fctltfs ulnmo (4tlenio tadfpDe u o t s2xr(rpoudoptnmnes ()artrumooo1aet mfctltfa2um( p;(4trerxf3ta1latraies ( sexo(mpoy4lpen fcsa( sDtrxrp;u0tetnmfctld a2emu p;t0aexoxo ia1oat  u ilt  2toxo oudlp nliciat arurx pnt0ole mieiad s umuvo;(0 eerir3oytlp  lu o (0srxo(m3nudame lnvtl(fsrurump;u0olxo oeiyt sDuau o ()altnmr3totlpte uvsls  2xrxmpoodam nlfvs s) Drm(  nt4oeenmoctadfm2rlnms;t4 exnif iy1lp rlnvsls0srtmxmpiu1al   neil(f Drm(r nt0tlxniictyslmDum(vpn(4trtnxf3oydoaDelivs (  rur(mpoudame  neiltfsrtm(m no0apxnii3iysls eanvo u0areoxr3tytfmDeaivi s) 2xo(m3iudalt  nvsas)srrrxr ;o1aet mi3iatfaDua(ms u4alxoxocta1fmt li o t0 euoiopoo4lp nmieilsfarrr(rp;o4apx io3iysla rmnmsnu0treomo3oadlpDelieols)t2xrxr ny4opt mictls)sDtr(rp;t4texn ociys s elu snt4 eerir3oatlpDr u olt0 2ur(opnudopen fvsls  rrau ooo4alen o3ilsla2ulu o;() lxomo ta1lmt auei (0srto(r3no1ome lfcsa()a2rmumo;o4oleomieiysfmDeln snu4 exnirctadlatr ieo;s  rur(r ny4am n fcia(faruru  nt1tpxn oetadls2rm(mo (4tleomocio1oat au s s s2ur(o3ou1op elfei t) rur(rono1apen octad mDrau o;t)aeerxr oydfpt  n olt0sexmio nu1al  mneiltfsrumxmo;t1tle ioeiadfaDumuvp u4 lenmfctytfm  au ol( t2xr(mpou4olenmnciasfa2raxmpno1opeoifetasla2em(vo t4tetnio3iatfa raueils0srtoio3ny1op nmnet s)srtax onu4tleo fctytlm um(vo u0 lenmo3iadfa eluvs;t0s2umim3oodlp elics t sDtmx p;u0tlx iieiat s uauvo;t)tltoir oa1fate n ol( s2tm(r3no1lleelictas)a2urxm no4apt  ociysfs ean pn(4 renmf3tadlaDeln ilt0s2umxr nydam   fes (  2rrx poo0tpeoiiciytfaDraumsnu4trerxo oadlmtran ils) eum(m iy4oltn fvi s)a2ta( onu0oeeo o3iltfsDum( o t4 leoio totla r ivo t)seuoimpou1alee nvsls sDtr( o;u4tetomo3tad sDeluvo;(4 exnir iodlp rlies t  rurim3nu4altnmfcilt  rtaxroou1olenmfetldfa elu pnu0texoxrcty1fm eanes t)setmxopiudamenlnei t s2tr(r ou1tpxnioetys a elumsnu0altoxo3ootfp  aneolt)setoxmpoy4aptn fvt ()sDuax pnu0tex iictyslm2ranvpn(0 rtrmocoa1fa raivs;(0s2tmxopou1opt  ietltfsrrm(moou1aleo ieilt s elnmont4 exoxfcoatlaDr uvo;s) 2urxo iu1lp nmfcilsfaDraur ;o0tltomo3iadla2uln p t) ltoxf iytlp e ivs (0 2xrimpoo4am elictls) Dtr(r ;o4tee  oeiadlsDran o;u4 rerif3iadlpD  u s ()seto(r3iy1lm nmivslt)artmxmo;u4apeo i3taslaDrmuvo (0texrir ty1oa r neils)s2xoim3iydole  feilsfa2urxrpou1tpeo o3iltla2umn snu0 etrmrcty1fpDean s ( srtoio ou1ap emfes t)artr(mo;o4oex  iciyd mDea(vs;(0trermr tatfmDeluvsl( teumim oy1apte ictat  2um(r no4tlenmociltls ea( snu)altnio tytlat lnvo;s0texoim3iudlltnlfctlt)a2ta(r nu1teen f3ilsfsDrmuvp;t0trtrmrcootoa r i sl(0t2urxopnudapenlivi t srraurpnu1tpe iictlt s2ea(vp t4 etnxr3ta1lpteli ils  2trimpoydlle mfeta(fsrumuro;o0tle if3ilsfm em(vp;t0trtnmr3todfm rau ils seuoxr no1omeelnvtlt) rtr(m ot4oet  octldlsDeauvpnt4 etnio oy1om e uvslt0s2umxopiudolt lnct t)sDuru o;o0opxoif3iatfa2rln pnu) rxoiocoatlmD ln o;s tetrxr iodal n nvt t s2rr(r ;t1oeeo feiysls2ranmsn(0trtoif3oo1fateluvo;s t2ur(r3oo1opeelfetlt artm( o;t4optnmoeiasla2ua( s t)aexnir oatfatr ivo ( s2xoxopoudomt  ivsls)sruaxmpot4apt ii3iat a em( o;(0tetnmo3iodfmtr u s;t0trxmim3nodlpenmfci s)sDrmxrpou1tlxoioctld sDrmuvs;u0arxrircty1fmDran olt s2urirpio1olen nesas  rrmxrooo4tptniieiydlaDeauvo;u4trtnmo3todfp ran sls)trtoxm3no4ape  fei tf rra( oo
\ No newline at end of file
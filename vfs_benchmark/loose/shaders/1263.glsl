@@ -0,0 +1 @@
+n i ( trurim iu4alt  ivi t)aDrm( onu1oee io3iltfm rm( pnu4arxnifciydfm  ai ilt srtoxo3nodolt  neilsf Draum no0apto oeildfs umnmo;t4 lenif iotlpteln ils  rurimpnydamtemfeiasfs2ur(mont0oex  ieiytla2ra( p;u0 rtoxf tytoat  uvilt)texrxmpiudalee fciasf rua(rpou4aetn fciydfa ulu o;t4 exnxo iadlmt lnvi s)seto(r nudam  lncta(f 2taxrpoo0ape mo3ild a um(mo (4texrxr3tadfm eanvils) eumxmpoydamenmfei s a2rrur ;o0tptoifeiadls rlums;(0artrir3iatlatraueslt) rurxo3iy1ll e feta( arta( ooo0aptnio3tas s ua(mp;t)arxrircio1fmt aueol(0 rurio ou1amtnmfes s a2rru oot0aet  f3iadlmDean pnt0tltnxfctodlmt auvolt0srumxrpoy4amtelnesas)s2rmum nu0tpt iocilsls2um( o ()alermo oadoa r ivols0srto(m3io1lp emnesa(fsDraumoot1open i3ias a2rm(ms (4aetrif ootlmt  nvols s2xrir nudam n ietls s2umxm nt4tptomoctytfs2el(msnt)alenmr3ootfatran ilt) rtmxm3iy4ll e feils a2ua(rpnu4tpeo ictytfs rm( o;()trtoxf3oatlaD liesls0 2uo(r oy4op nlfcta(farra(monu1tpt mf3iltfs ul( pn(4arenxo iytlm  lneo ()trxoxm3io1ll nlfcias a2taxmpoo1ole ioeiad m uanmon(0trtrmf3tytlm  ai ol() etr(o3iu4olt  fci t arrru ooo4oexnmo3iyt sDumnvp u)teeoxfcoa1op r ivi ( trxmxm iy4amenmies sfsrur(r nu0aleoii3tasfm2rm( pnu0aeenmr tadlpDrai o;( seuoir3oy4oleelnvta()aDtru oou1olx  f3ilt s2em( p;u)aexrir oytlpt anvslt  rtm(opny4am e nctlt arurx oot4tlx mf3ilsfs2elnvon(0altrmfciatfaD lnvs;s s2uo(o3nudalenmiesa() Dtr(m nt4texo ieiyslaDelums;()trerxr3tatlmD lneolt trxmimpnydol emnvsat)s2ta(m ou1oleomf3iyt s2ranvp;t0 lxrmrcoytlateaieil(0srxo(r3ou4am   ietl(faDrmurp;t1aet mfcild m emnvo t4artnxf oydfpte i il(0 2tmxrpoo1altnmieilt)arrmump;u0tpt  o3taslm eanmo;()tltnxfcoydlate nes (0 rumim iy4ol nlfetat arta( oot4oetoiiciasfm2ulnvs;()tetrio3iodfp r ueo;s  rxmio iy1am elfctat aDrr(ro;u4altomociltlm2ua(mo;()trxoio todomD liei s0trtmim no4lm elfetls) 2rau  nu0tptnii3iydfs emums;t4 ltrircoy1faDean s;s  2xmir3oydalen fvta()aDumuroot1tex  fetas aDelnms;t4trtnxr tydlptr n sls  rtoimpoy1lmeemietls) 2rr(r ot1tltn i3iadlaDeaumo ()aetnif3oatlmD lieol()trum(o oy4lltemicsas)arumu oou4tpe moeiatla2ra(vp;t4 rxrifcoatfptr ues () 2to(r iodlm nlnvia(farrax o;t0tltoioetyt aDeanmpn(0 etnir3oa1faDe nvi s)t2xmio3ou4llee ieias sDurx pnt1aeto f3iltlmDumumsnu4 reoxf3ia1fmDe u ol(0srtoxo3no4optnlneilsfaDua(ro;o0apt mi3iatfsDum(vs t4arenxf3totoaD aieils0srxoim3iu4lltn neils s2tm(  ot4oltoioctyd a ra(vs t4 exnxfcoo1lmD ln o s srxmir3no4lpenlies s)srurur nu1alt  ieildla rl(mon(4 exrifcoytfp elnvs;s0s2xo(r3iy4amt mfeilsf rtaxmonu1apx  ietld s2rmuvpn(4altrxrcta1oaDe i il(0seumxo3oo1ap nlfci ()sDtm(rpot4teeo o3iatfmDuln o;u0tltrio ta1faD ln il( trxrxo ny4lmtnmivtlsf rrrxmpou4apxnioeiat mDeauvs;t)teeriocia1fm eau s;t0 2umxm no1apte nes t  2raxr no1alx if3iatlmDulnmp t0 rxnir iadfpDeauvs;t srurxm nu4lme mict (fa2rr(r ;u1alxn ietls a ulnvon()tetoir3iotfaDe n s (0s2tmxmpiu1lmtemfeil( s2tau  nu4ale ifeildfs2ulu p (4teermrctatfpt ln olt t2xr(m io1lme  nviat  rrmu  oo0tpt moctytfaDrl( sn()tltrxoctydlpte neo s)texr(o nudop elnvils  ruaxmo;o1oee  ociydla2ra(vont4altrxr iotopDe i s (  euo(m3oodop elnci ( srur(m no1tlenmieilsla uanvs;t0 lerxf3to1opD  iei s)seuo(opnydamenmfei t s2raxrpnu4ale ifciasfa emnvp (4arxniocty1opt lu ol(0trxo(mpiu1olte fcsl()sDtrurpno1tetn ociadfa2eluvsn(4tetnif3oatlaD lieils srur(o3ny4aleemnct s)srraur ou0oex ioetyd s2ran pn(0 renxfcto1om  ai sls)texoxr3ny4ap elncia()aruaxroou0oet mf3tytfsDrm(vp;(4trxoiocia1fmDr n s;s0t2um(rpiy1lp nmivsatf rtrur ;o0aetnio3ias s2rln o;t4 reoxo ia1fptr uvo t srtrir oudal nmfcil( a2tm(rpnt0teto i3tltlsDrmu ont0 lxomo3oytfp elueo t0srtmxo3nodolt  netatfa2raxrono4teen f3tadlm2rau s u0 rxnioctotopDeluvsls) etmxmpnudlpe livia( s2ur( poo0apx  ieiatls emums t) rtnxociydomteaues;t)teurxrpoodopee iei (farumu o;o1opt ii3ildlmDean pn(4teerif to1lat  neol()srxr(m iudalt mfei tfarrrxrpot0oeenio3ils m2ulu pnt)tlxnxr oo1fm eau s s trumxrpiy1lmenliei t)srrr(mp;t1apxnmfciad a2uauvpnt) lenxfcoadlpt au s;s0setm(o3oydamen ies sf Dtmx pot0tltn ieiat m emn pnu4 exrxf3oydlp  lieo (0srxoxr ou4ole mnes t artm(r ;t1teeo ociltfs2rm(mp;t0texrmoctytfm eau i t0trtoir oodaleemfesasf rumxm ot0tlx  oetldfs2rln o ()texnifciotlpDe iesls)t2urir oy1llt  nci s) Drmx oou4alx mi3tltlsDrlu snu0aetnio iadfatr nes s0trtrxr io4oleemfcil(fsruaxr ;u4tltoiociatfm umnvpnu0 exnmociotlmt lieo ( seur(m oy4am  lneiatfsrtrxrpnu1alxnmf3iadfsDelumo t4 rxrif totlaDelneo;t texoirpoo1om  mfeils) Dtrx pnt0texo f3iad s elnmp t)trtoxr3tydlaD anvo;t0 eur(rpnu1llt mivsas sDumu poo0aleomicilt m uauvpnt4 etomf3oydop   i o s  euoxm3ou4opee fciat)a2trum nt1opxnmoeild s em(vpnt)trtoir3iydlmDran s;t s2toim3nodlltn iesls srrau  ;o1aeenif3iysfs2uanmpn(0trxnmr todlm r nvs;s texrxo3no1lltelnetlt)a2urumonu1altoii3ildfmDemumont4 leoifcoodoateaueo;(0texr(o ny1lp n ivta()aDuaum nt0tpto fciytfs em(mp;t0arenmo ia1fmtraieolt0s2xo(rpou1ome livtlt a2tr(mpot1opx iociadla2uauvp ()alxoirciytopteanvo t) 2to(r io1apeemfctlt)aDuau pnu4aexo i3ilt mDraums u4altnxr iadomD  nvil() rur(o oo4llee ict s)srtmx  nu1olenmi3tysfm rmu p u0artrmfcoydlmtelieo;s srtr(m3oudlm nlfei s  Draxmoot4alxo fciltfmDel(vp;u4 eeoxr iotom rai olt  rtrir iy1lp n fes tfarrauroot1tlt mieildfs2ea( pn(0alxoir3oadom eauvi t0s2xoxr nu1altnmnvs sfs2ur(r ;o0apx mfctat a2elnmp () exrir tadfp r uvol( s2um(o ny1optnmnvsat sDtru pot4ope io3iadfa ua(vs;t)teenxf ta1oate n o s)s2ur(o oodomte fcsls)arrmxrpnu0tltnmoeiasfm rm(vp;u) lxrir3oytoaDelu olt setm(r3iodlptnmfvt s)srurx pno0apeoii3tyt a2rmnvo t)tlxoir3oodla eai ilt)teum(rpny4lpen fvi t a2ra(mpnt0tee mo3tld aDelump u4texoir ootlp eluvi;(0srtrxmpiydal   nvt t artrumont1aexoioctltlm2rm(msn(4aexnxo3iatfa  lneolt  2xrir3nodolen iviltf Dur(r ot1apeo i3tytfs2rm(mo;u) eenmf iatlm eaneo t)trxmiopou4al elicslsfartauro;o1alx  octlt m2ranms t0arxoiocoatfmtr n s;s) 2uo(r3iudapt mietl()arrmxm nu0ale ii3ild a2rl(ms;t4 eeoxr3todfpD aies ( texr(rpny4ol elietasfsrtaur ot1tlxnmoctlslm umn p u0aeeoio3iadfa elieils)srxoio3nydap elfvtat) rtmxrpno0tlxniietasfaDea( pnt4 rxnxo3oodfmDelnei s srxo(mpiu4om   icia(  Drrxmo;u4tlxn oeiltlm rmu pn(0 rtrxr tydfp eli o t  etr(opno1lpenlicil(fsDtmxm ot0teeo i3tldlm uanvsn(4 lxnmrciy1laDeau olt0trxoxopio4lptnliet sfsrur(r oo1aeeoioeiltfa rmuvont) eerifcoadomtrau il(  2trim3no4ol e nvtasf rumxm ot0open i3ias aDrm(vont4tlenxo3iadlm rluvo () 2uoimpiu1omtelncsa()aDtmuront0aeeo ieiaslm2em(vo;t4teerxf3oytla elivs;(  eurxmpnu4ll e fesls)aDua( o;t4texn oeilt s rmu o u) ltomfciotfmt anvsl(0sexrxm3no4olte icta()srrrxrp;t0oleo f3iytfa rm( s u0tetomocoy1lmtraues t) 2urxmpny4lpe mici t s2ur(  nt1alxnmi3tysls emums t0tlenxr3tydfm rau s t)t2toxo nydlltnmivtatf Dtaxr ;o0aee iieiltlm2rln snu)teerif3ia1op e ies s0s2uo(o3oy1ap n ncias aDur(ro;o4ole io3iydlmDum(vs;t4trxrmf iotfateluvolt)t2uoimpny4ale lieia(fsDur(m ot1opxomoctat aDrl( p () eeoxocoodfpDelues t srumir3oo4ap  mnvta(faDtr(  ou4openif3iys s2uan p;(4alxoxfcoo1opDeai slt0srxrxopoydap e iet t)a2uru pno4texnioeilslm2ean p;() ltoioctodopteli slt) 2urir nu4ll n fvsat)arumuronu0oex  ietatlmDelnvp;u0aeeoxf iydop e ueil( trum(o oodaltelicsa(  rrrxmo;t4ole  o3iasfaDrm(vp;u0areoio oy1fat  nvo;()tetoxmpny1lpee nvias)a2uru oot1aex  fctad a2uauvo;t0alenirctotfp e ivslt) exm(opnodomee icils sDrax o;o1apxnmiciltlaDulu snt)aleoxf iatfpD lneil()trtmxm iy4openlnvtas)sDrmurono4alxomfetyt s ranvs u0aexnmf iydoa rluvil(0 etr(m3nydom emivs (faDrmum ;t1olxn ociydlaDrlnvo;t0texoio3tydfaDeli s t0s2ur(opoo4ll emivt tf 2umxmp;o0oexn feiadfmDul(vpnt0tetnmr totfpt li ols srumxm3oy1ap emfeiatfarta(mpnu0ape  feildfa2em(mp;t4teenio oytoatr ueslt0t2xr(o3oydllt mfeiatfs2ur( ont1apx ifeiltfaDran o ()aexoir3oatom ranvo t0t2uoxm oudap emfetltfarraurpou0aptniiciasls rln pnu) rtnifctytoa  aivil(  euo(m oudll nlfvi s)s2taumooo1oltnmoeiasfa rmums;u0 exoxo iotoptr ivo;(  rum(o3no4ol  licias)arumxm ;t0aet moctysla ulu s;t0trtrir oy1lmDeaues (0seurxmpiodam e iet (  Drrxr nu1tpeomoetasfmDrlump;t) etomo to1op r neils)texrxr3iy4alen ivsl( a2rm( pnt1aex mfciadfa emuvo;()alxnmf3oo1omDe u s;s)trurxm iodolen nvs sf Dtmx o;o0texo fciyd aDul( s t0trtnxr oa1fpt  i o (0 2xmimpoo4lmt lfcs (fsDrrur ;o0tpxnmi3tat m2em(vpnu0trerxr iotlaDr nvs;( trtmio3iu1lle livtatfa2rax  nt1tex moetydla2eanmo;t4artrmr3tydlateln s;()t2xr(o nu1ole lfct (f 2rmxmo;u0optoifctyslaDeanmp t0trtnxo3oytfmteli slt  rur(opou4op n iei t) Dtmxrpnu4alxo ieiltlm2emuvpn() reomf3to1lmtrauvilt)srurio nodlmee netatfsrtr(moot1aptn oetytfmDrlnms;(0tltrmf oatoa eli s;s)s2to(opiudop nmfctl( sruau ono4tex ioctlsls2rmuvo;t0tetnio iotla e nei;( truoir3oy4lm nmncs (fa2rrxmpoo4aexo f3tydfm2ea(vo t0trtrmo oadoat  neilt) 2tmxm ou1ap e nvslsfa2rm(r no0tltn f3tydfa ranvp;t)alxoirctytoatrlnesl(0t2tm(rpno4om nmieilt)artrumooo1ope  f3iltfsDumuvo;t)aexrxo tydfpD aivs;t0 2uo(opou4ap nmnctat  ruaumpot4oltn ociysfs ranmp;t0tetoxf3iy1fmte iei (0 ruoir3iydamteliviasfarrmxmo;o1teto icilt m2ea(mo;t) ltnxf oo1lm r uei (0s2to(m no1ame mfei s)srumxrp;u1oex mi3iaslsDul( s;t)tlxoxf totlaDelnes;s0 rxm(m3nodaltnlnetat sDrrurp;t4tltoif3iytfm2ea( s;u) rtnxr3iadlaDeanvo;s0texrim ny4ole miesl(f 2ua(m no0aexnifetas mDuau ont) rtnio iatomteaivilt t2uoxopou4lleelnvs sfarrm( ono1altnifeiadls umuvpnu) eenmo oydoaDrluvsls  rumxopoy1lltnlfesatfarrru ono0alenmf3iysla2uan s t4 exoir iatom rlnei t s2umxmpno1ale  fes sfaDtm(ront0optnmo3iydfs2el(mo t4aexnmo oa1om rlues;t) 2tm(o oo1lp n nvilt)srrrxmpou4tlto ocildlsDumumo;t4alermr3iytfp e n o t)s2umxo io4op nmivta( artm(rpoo1altnifeiltfm ea(vs;(0teenio oadfat aivo;t trumio3ou1am   iet s)sDrr(  ;t0tlx mf3ilsla ra(ms () rtrxfciodlm  lneo ()sexr(o io1ol   fvsas aDrmu o;o0tex mieiltlm2emnmsn(0trxrifcoo1lm rai s t  2toxo oy1amenmnvtl( arrm(m ;u1aeto ocils a ra(ms;u)tlerxfciotomte uei;t) 2xm(rpiydlpt  ics sfsrraum ;o0oeeoii3tldfsDulnms;()aexnmo3iodomt ln olt s2toxopnydoltn fvtlt sDrm(r ;o0tltnio3ild m em(vsn(4tlxrmo oy1fpteau i;s) etrimpnu4llen fet s a2um(mp;o1opt  feild a ran o u4alxomrcoodopDranvo t0sexo(rpnudll  lncs s) Dta(  ;u0tpx  f3tatfmDeauvo u4texnmocoatfpDe uvs;t)srurxo oodam emict t a2rrumpot0ole moeiat m2rm( o u)artrmr iodlpteaivi t)truo(rpio1ll elfes tfarta(m nu1oee mf3ias sDulnmp (0 lenxo3ty1lptrluvolt)setrxm oy1altelfcias) Dua(  ;o1tptnmiciytfsDelump;(0 etrir3oo1lpDrlueo;( trxr(rpnodole  ict t s2umxroou1alx ioeiydlm2eanmsn(0aexrio iydfm e u o;t0srxoiopoy4lmen fvta()aDta(  nt4aet iicildfa rluvpnt) etrmocoatfptelneolt)t2toxm iy4lmenlnci ()aDuaxm ;t0oeto ociasfm ranms;u4arenxfctadop  aiei;s0sexmirpiu1ale  iet s  Drmxrpnu1opxoii3iltfs rl(vp;t0alenxf3iy1faD  i ilt tetr(m3no1op e fei (faDtrxmpnt4tlen ictydfsDuau s u4 rxrmrctotoptr uvo;t)texoir oo4altn fci t  Dum(  nt0oet  feilsls uan snu0trxnxf3oadfaDe i s (  2triopoodaltnmncilsf 2uaum no0tpt mfcias m umnvpn(4artrif3iy1fmtr nvi;s  2trxmpoy1lp nmfci () 2uaxmp;u4opx  o3iyt mDrmu s t4aeerir ta1latrlu sl()t2um(m3nydom  licslt)a2rrum nu1aee ifetysla2emums;() rerxf io1laDeaneols)srtoxrpiy1al nlfei (farurx o;u4oltn ictydls2raump ()trtrmrcoytla rlu i;t0setoir3nu4alenlnciat a2rm(m ;o0aetn i3tlsls2uanvsnt)trenxo iy1lpD li sl(0sruo(m no1lm  lnvtlt  2rau onu0tet mieiysfs2uanmp;u4trxrxf ia1lpD auei;s)trumirpio1opt mfciasfaDta(ro;u4olx iietatla el( p;u)altnmo3oy1la   uvols seuo(o3nodllt mfctas) ruaumo;t1oleomictlslmDuauvsnu0 etoif tytoa  ln o t t2uo(o oudlpt  nctl( artruro;o0apxn ocias sDum(mon()texoxf iadlp e u o;s) exmxo no4alte nvsa(fs2rrx ont1oee mfctadla2rm(mo;u0 rxrmr3oodfp e ivol(0tetrxmpio1ope mics t) Dtauro;o1aee  feilsla ua( s;u0tlxrxr tadopt  nesls)texoimpoudopt mfeiat) rum(  nu1oex mfciad m2rmnmon(4 rtnir3todfaDranvs;s)teumir3ou4aleemiciat) Dua(mooo0oexnio3ilsfmDem(mp ()altoirctytopte neo t  exrirpnodlm nmfviltfs2rax pno1apeniociys m2ra(vpnu4 lxoir3iodop raies t0 rtm(rpio1om elnvi ()a2tmxrpno0optoii3ilsfs eauvs t0alenxf io1omt  i i;t trxmxr ny1ape mfeta(fsDrr(ronu0alxomictasla uluvp;u4artoir3ia1opt lnes s)sexrxo ny4opt  ncias)sDtm( pot0tpt mfetatfa2eaumont0 lxoio3oodopD ai slt) rxmio3iy4omeemfetls)srtr(rp;u1tptomf3iyd a ea( onu4alxnifcoatlaD lnesl(0tetm(o3nodol nlfcsl(fsDtrx p;u4aexoiictyt a um(mp u4 lenircoatla elivsl(0srxm(o3nu4lme mics ( a2rr(mpno1aetnmfetys s ul( s (4teenmr3oy1omDran sls)srxmirpnodlle mneslt)a2um( pnu0tpx  i3tytlm um( on(4 etoif3oadfaD aivi (  rum(mpnudlpee fciasf Dua(m ;t1tex  ictldfm rlnvs;(0trtrxfcoatlp r ies ( t2xoxo oo1ape licslt) 2urx oot0aexomi3iys sDumn o (4aexrir3iytfat ln o t)trur(mpny4opt  iet tf rrr(rp;t4alxnmfciys s2emu pn()tlerxf oodlpt lneo s0t2tmio3ou4lmenmneiltfaruaum oo0ole mo3ilt s2rmnvs () ltrxf io1oatrlieols  euoio3oo1opte nes (  Dtmumoot4tptnifctadfmDua(vp ()teerircootomtr ivo;t)trtmim3nudam nlnvi s srum(  ot4tpx  i3iasfsDemuvp t)aetrif3ia1lmt aueils0 etrxr nydaptn nctl(  rua(rpnu4tetn f3tldla em( sn()altnxf3tatfaDe nei;t trtr(r oo1lm e fet tfaDrr(mpno0tet  ietytla2rm(ms u)tlxrxociy1omtrlivslt)trxrir oo1ole livil( sDtr(  ot0opxnmieiytfs2ul(vp;u0 ltoxocoatfm  au sls0teum(rpoodapt  fesls  Dta(rpoo0aleo o3tlt aDel(ms (0 rxomr ty1oaDrli s (0srurim iydomee ies t a2rr(roou1tptn fetysfm el( p t0artrxfciytlm e ueolt) 2ur(r io4apee ivsa() Dua(mono0tlenmfcildlaDua(vs;t)texrif ty1lm rauvsls s2tmxopoydom nlnctls sDua(rp;t0tee  i3tytlm eanms;t)alxoio3oa1fpD lueilt)teto(r3io4llee fvt tfsDraumont4tpenmfetlsfaDua(monu0 exrxr tadfmteanvo;()setoim oo4op  mfvsatf 2umxmp;u4aeto o3iyt mDemu p;t4 lermr3oy1la rlu sl( trurxo ou4lpe lictltf Durumo;o4aexo i3tyt m el(mp;(4 ltnxrcto1fa  an o t)t2xm(opno1ll  mnes (f Dtaur oo0olt iociaslm2emuvsnu0tleoxr3ia1fateaues () rxr(opoy4al   nes (f 2tru pnu1tltoii3iyslaDeaumo;t4tetnif oa1lp r nvi;t)trxmir oy4ame lfcias)srrru oou1tpxo oeiytlmDrln p;t0tleomfctotfm   u i t) etoim3oy1ll e fvta(fa2uau pou4oex  feiytla em( ont) rtomr3ia1la rli s;s0truoirpou1op  lnct sfa2um(rooo4tpeo f3tasfs2ran p u) eenxr3ta1lp  luvo;s)t2urio oodlle livs tfarrr(  nt4tpx moctatfm uan o;()alenxf iotlp e uvs;t)srxoio oydlp  liesls)sDtau ono0aeenmo3tys a ran sn(0alxnifctodla r nvs;s t2uoiopio4lltelies sf 2umumo;t0tpx  i3tltls2rm( p u0aleoir oy1lm   ivs t t2tm(o3io1ll e nvt t s2trur oo1aee iociyd a ulumsnt4artnmr tadlmDrauvo s0seumxrpnu4omeemfvi (f Dua(r no4opt mieias m umn pn()arxomr iatoa r ivo ()s2trir3iy1ol n ivi t)srrm(r ;o4aetnmoetlslm2rl( sn() etnxr iy1oaDeln o s) rxmxr3oo4olenmfeslt) 2raumpno4olenmo3iat a rln ont0aeenxrciadomt  ieslt sexrxr iu4lp  mnctlt)srumx  ou1texo i3iydfa2eaums;u4aleomo to1oa rln s;()srurio3no1oltnlfeilt artaumo;o0openmf3iyslsDul(vp;t4 lxnxr3tytfp ean i;t)srumxrpiy1ll n fcil() rua(mono4aexomo3tlsla uanvs;t0artrmo iytlpDeanvsls0s2toimpoo1op nlictat srtrxmonu1opxoifciyslm2eluvp;u4aeeoxfcta1opDelueilt setoir3io1omtemncil()aDrrum ;u4olx ii3tytlm2ra( pnt)tleoxo ootfpt  uvi;t  rurir nydap emfctl( srra(mp;u1alx mfciltlmDem(ms;u0 rtnxr tatlmte ivil(  2umio3oy1am   ivtls)srrr(  oo0alxomietatla ranmpn(0tleoif3iatlpt  i s ( srtrim ou4omtnlfvtl()sDrr( ont4oeen o3tas m2um(vo t4tetnir3ta1op  luvo;s0 rxo(m3ou4amtelnes tf Dtmxm nt1tpto fctldfm rlnvo;t4 exrmrciy1opDeli il( sexoxr oo4om  livs sfaDtmumoou4opx  ieiys m2rln p () rtoircio1late ivsls srtoxr oydaltelies (faDum(rpoo1alenmieildlsDulums t0 rtrxr3oodlmteauvi () rtrirpio1lp  mnet t s2uau  ;u4tetn i3iys m eanvsn(4altoif3tytfmtrlivi;s0s2tr(opoodalt  fetl()srra( o;t4tltomoctldlaDrmnmp;(0 etnmrciotlp  luesls)trxm(mpnydopenlnvsas arrr( o;u1aetnmfciys mDelu p;t4aexnif iytfpDe n o;t)srxrim3nu4aptnmfctas srrm(  ;o0opx ifetlsfa2ea(vs u4 rxrxocto1fmDrli s;s tetoir3oodaleeliesas  rtmurp;t1alt iictls mDranmp;u0 rtoxo3ia1oaD  uvslt)s2toxo3iy1alt liet s  rrmump;u0tetomf3iyd s ra(vp (0texrxr3oa1laDelivo (0trto(r3iu1ol   neta()sDtmxroot0texn i3tat a rmnvp;u4 exomo tytfm eauvsls)texmxopny1omeemnctl( s2rrumpoo0oeeomieiat sDua(mp;t)tetoxf3iodopt  ues s)setmir iudopeemfvtat srrau  ;t0tpeoio3iydlmDumuvp;(0 exnmf oadlat aieo (0t2xoim3nudaleemfviat a2rmu pot1tlxomfciyslm umnvp t4 lxrxr todfpD auei;s) eumiopiudam nlncsl( sDumu p;u0tpto fctydfs rlnvon(4 reoir3tadlpDe nvilt0seurxmpio4al   iet t)a2umxr ;u1apx iociydfaDem(mo;t)alxoxf tadfmtr uvilt0 rto(o3ou1ome licsat) 2urumo;u1openiociad a2ua(mont4 eeoif3ta1lat aues;t  rxo(o oo4ape  fetlt sruau  no4tpe iociadfs2rau s (4trxrxo3iatlaDr uvol(0texo(r oy1lp  mieilt  rrru o;t1ale ioeiys aDeln s (0tlxomo oo1oaDe i ol(0 rxoxm3ou1lmen ies tf rtru  nt4aee ioetlsfm2rluvo;t4arxnmo iodfaDeli o;()s2tr(o nu4alt lnvi t  2ra(mono1tpt ii3iltfsDemu p;u)artrxr iodfa raieils s2xmiopnydamee fci t)s2tru  ou0apxoifciysfaDemumpnt4aexrmf3ta1omtr uvs t srur(o3ny1lm nmfetl(fsrtm(mo;u1aexnmfctys s2rluvpnt4trxnmrctatfat aneo;t0 rxr(r3oy1ale lncsa()aDta(r no4aeeniociatlm2umums;(0 lenxfcoodomtrln ols t2xoxo3oo1ole mnes t  rtm(m ou0ale iieias s ulumo;u4aexnif tadfmD  n ils) eto(rpno1lptemneslt  rrmx  ot1tee moeiat m2ulnmo t0 renir3oy1lpDrluvslt0 rxrxmpnu4am nmnct sfsDrmu  no1altn ictldlmDra(vo (0 rtnmfciytlm r ieolt  2urio3nodape licsl( a2rm(  ot1tetn ieiyslm uau sn(0artrmrcia1omtrlu ol(  rxo(mpiydll elfct (farurx p;o4opxoif3tas mDua(vpn() rtnxr3tytlm eaieslt setm(o iodam elnvslt)srtmx o;u4tpxomi3iaslsDul(monu0 lenxo3totlm elneils s2urxm3io4ol nmieil(faDra( p;u4opxoiieildls elnmo t)alenmf3tatfp  aueo ()s2xoxo iy1apee ieiltfaDuru pnt1tee iieiydls um(mo u0treriociydoa   u ilt)texmimpou1al   ictatfsrurx ono1apenmociltfa2el(mpn()arxomr oo1laD  u olt)t2trxrpno1ll   ivs t) Dum(m ot1oexo feiytls2rmuvo;() exoio3oa1la  anvi ( trxoio nudole liesl()aDtr(rooo4altomieiys s elumo (4teenxr oydomD  uvil()s2urim3oo1omee ics sf rrau  no4oltomoeiys sDulnmon(0 etrxo3tatlmDeanvsls t2uo(r3iodlp n nesasfsrrm(mo;u1aet iociydlm2umn s;() etnmr3tydoa rauvils)srto(o3io1ape mnctas  Dua(m ;t1teenmf3iysfmDuauvo u4 eenmf3tatomDraues;s0 eur(o iu1lm  mfvia()sDrrxro;o4oeeniocias mDel(ms;u4aexrircoy1oa  li ils teuo(o nodlltemfci ( s2trurono0tpt ifciadlsDeaump;t)treomocoatfmDrlivi s  exr(rpoo1ll  lieia(fa2urxm no1oeeoioeiadfaDra( snu4aetomo iodfaDeauvolt) rurxrpnodomt  fciat)srrr(  no1opx mf3iytla ua( on(4 eenir3ta1latr i ils0s2urxm iu4olt mfet ()aDurxmp;u4optomi3iadfm2ul(msnt)arxomrctydlpte i i;s  2tmxm iodoleemnvtls aDrrx  ;u1aeeo o3iasfsDrmn ont4trtoir3iytfpDelueo;t)s2toxo iy1ap  lfct (  Dtaumpno4oetniieiltfmDul(vo;(4arxoiocoo1om   n s;(0teuoiopnudlme  fvi tfsrrrx pnt4tleomieiad m umu onu4 ltnxfcoa1omt livi t0trxrxo3ou1lpeemneil(  2tau pnu1tex  ociysls elumo t4aleoiociodlatrai s s)setoxo3no4am  micia( aruaxm ;o1oexo i3ils a el( ont4 rtnif io1la elu o;( s2tmio3ou4oltnmiet sf Drax o;t4tleomfeiydlaDel( s t)arenirctotoaDe nvsls0teto(o3io4lpe lncsasfaDumu p;u4open oeilsla ra(vpn(4trenxf oytomtrln i;t trumxm nu1lptnmfet s sDrr( o;t1alxniociadlsDua( p;()tltoxfcoytom raueo;t0t2to(m oudapt licslt sDtm(ro;o0tetn fcils m2el(mp;(0tetrmr iatom   n o;(  rxm(o iu1al nliviatfaDraum nt4aeeomocias aDrmnmp t) rtnxrciadlat luvi t0 etoimpou4lmt mncs () rta(m nu0aet ii3ild a2el(vo;(4alxomfcoytfatrli s (0texrxr iy4al  lictatfsrrrx p;o1alxomictlsfm rmu p u4tlxomo oydop e uesl(  2xrir3oydlle lneslt  rta( pnt0ape mf3iadlaDea( pnt)treoxo3iodlp   u o;s)trtm(m ny4aptnmfet t)srrru pot0tle  fcildfs emnvpn(4 rxrxo3oadopDe ivs;(0 2urirpoudoltn fvt tfsDrmu o;u1aeeomoetls s2rmn s;(4 lxoir iotlp rli sls) exrxopno4omt lncsatf 2tr(rpno1opx ifctlt aDra( s ()teeoxf iydomDr iesls texoiopoo4op nmncs ()a2rmu p;t1texniieildfsDul( p;u)alxnxo iodlatrlies s0seum(o no1omtnliviat a2umxmo;u4aeeoifciadfaDeln sn() eeomr3todlptelneil(0teumxrpny4apenlnvi s  Dtrum oo1oeeomiciysfa ua( sn(4 eeomo oy1optr n ilt t2to(r io4oltnlietltfaDtaumpou0tlt mfcils m uauvsnu4 rerxf3iatlm eaneolt seuo(r3ou4ape livsas) rtaxmp;t1olto f3ildfm ra(msnt4altrifcoo1oaD lneols) rxo(m ny4omen nei (fsrtax  ;t0oetomieiys s ran o;t)tetnmociy1oa elu o;(0s2xr(m3oo1lpen ivt tf rra(ro;o4aptoif3iad s em(vsnt0texoxf3oydfaD lu i;t sexr(m ou1optnlfei tf rtrx onu1texn fcildfm2ulumsnu) exrio3to1lmD livi;t  2xmxm iy1ap   fvias)aDtaurp;o0altomieildfsDean o;u4texnxr tadomtelu ils)teumirpnodop nlfvtls s2tmu  ot4tlx iictytfm2ran o u0 eeoir3ty1fp rluvs s sruoxo iy4lltnmics s)a2ur( poo1opxoiictysfaDrm( o t4 exoxf3to1fmDraneo t0sexrxrpiydalt lfeslt a2rru oot4tltomoeilsls2rmu ont)aexrioctadomDrauvilt0sruo(m3io4apte nvia( aruax p;u0tptoii3tld mDeln p t0 ltnxf ta1oate nvsls tetrirpiy1lp e fvsls)sDtrxro;u4alx  ictatlmDulu p;()tlenio iatomD anei s0trtm(mpio4lpeelnvias)aDraum ot4oetomo3iydfs ua( o;() ltrxo oy1om raivsls0s2xoxm3nu1opeemnvtasf rtm(ro;o1aeen oeiydfa2eln onu)arxoxo iadlmDe n o;t0 2xr(m3oudop nmfeilt sDtrumonu4aeeo feilt m2ul(vpnt)aetrif3ootlat ln i () 2toxo3nu4alte icsl(fsrrm(  ;o1oltoio3tldla ra(vs;u0tltnir tytlpDe u o t)trtmim oy4op emivsl( s2ta(mp;o4oee io3ias a rmumo;()artrio tytfpD aueil() 2to(o iy4omt  fvta(  rtrur ou0oexnmoeiasfsDumuvo;t4artrxrcta1op raivi ()trxmxrpiudom emnes sfaDumumo;u0oetnmo3iydfm2rm( ont4 renio3oydom e ivs t0s2tmimpny4om   neia(  Drmurp;o1altnmi3ildlm2ulnvo () lenxo3ta1lpt au o t t2tm(m io4am e fvtl()a2rr(mp;u1oexn iciys m eanmo;u)tetoio oo1fpD au o s)t2xriopio1ol   fvs tf rtau o;u4tpen o3ias s2uanmpnt4aexomo io1oate ivo;()s2xrxm3nu1llee ivsa(fs2uau pno1aleoio3iasla rmuvo;()aeerir to1opteli i ( seto(m3io4ol n fes s  2ra( ooo4olx  i3tysls2el(ms;()trtrmr3iydopteaueols)teurxr nodlle  ivtl()aDtru oou0aee mfciltfmDua( s u4 etoir todomte n i;(  rxm(mpou4al e nvsltfs2ra(  nt1ole if3iatfsDem( p;t0 etomr3ia1oatelu o;t trxr(r3io1omtnlfvtat)a2trx o;t4tlt mo3iad mDraumon()alxnmr iy1oa rlu s s  rto(mpnu4ole  ieias) Duru ono0tetomf3ildfs el( o;u0tleoxrcoytlat livs t s2uoir3io4lmenmivils)artrxr ou4tlxomocilsla rau ont4 etomf3iytla  an i;()srtmim3no4omenlics s  ruauront0olxn feilt m uanvont0tlxnif3oadfmtranvilt0 etrimpiodol nmnetlt)srtm( oou1oltnii3tls s ranmp u0aetrmfcoy1fpDraiei s) 2toxo nu1apt  nviatfsDtrur ou4tpe moeiadla2rlnvpnt4areomrcoytop rai o s0srxm(o no4lmen ieiasf rtm(rpno1tex  ietysfs2uauvo t)trxomr3tytomDrli ols0seum(opno1ame lnvia(f ruaxrp;o4tex ii3tas sDrln p;t)tleriocoo1omt lues t0srurxmpio1amt mfcil()a2umx p;o0openmictlt sDul(vo;u)aexoxfcoa1fpte uvi s0 rtrir3nudllt lfeiatf Dta(ronu4olto o3tat s umuvs;t0arxnxocoy1fm ran o;t s2xrio iodape lnciat  Dtrxr ;o0optnmo3iad a2eaumon(0trenxfcoadfpD  ivilt0 exoxr3oudalee nes (f 2rmxr ;o0tetnmieiytfs rl( snu)texrircoydfptran i s seurirpnodam  lncils sDrrumo;o1tltomo3tys a2ul(vpnt4aetnxociatfmteluei;(0 2xo(o ny1ol n net s aruaum nt0aptoifctltfaDulnmo t4trtoxo io1op  an o;( srto(m iy1lm   ivtasf 2uaumoou1alxoiieiadla rl(ms;t4arerir ty1fmDraiesl()srtmim3nu1aleelnvtat  2rr(mont0ole  ociatfmDumnvont) rxrxr iatlaDeaueo s)s2uoxr nu4lm   feiat a2ua(ro;t1tle mociatfs2uau onu0 eenircoatfmDrlneilt t2tmim3oo4op elfctas) 2rrxro;u4tltomfeiat a2elnmon(0texoxo3oytlmDrluvo;t) etoirpiudopt lnci ()srtmx o;u0tpen ieiasls2eluvon(0 rxomr3oodfatrln ols) rtoxm3iydomeelies ()sDtmxm ;t0aptn icildfaDuanvsnu4alerxf3tydlp  auei;()trurxm3oy4olt mnetl(  Dtr(mpoo1oetomf3iadfs2rlu p u0arerio3oo1fmtrau i;()teuoxrpny1alenmics ()arurx onu4olxnmfctyslm2rlnvp;(4 rxnmr3oydopt lu ols0tetm(m3oy1lmtn netl()s2ta(r nu0aee  ieiytlmDrlnmsnu)aexomocoydomte ieil()srtr(mpou4omeelicta()aDum(ro;u4teto fciat a eaumpnu4 rtoif tatfpteli s;s)s2toxm3oodole mici sfa2tmumpou4ole ifeiad m2rmnvp t0teermr3tydomDr nvil(0 2to(o3iydamen ivs t)srua(  ;o1aptoio3tltlm ra(msnt0 rerirciydomDeluvol(0seumir3iu1ap elnci t)a2tmxmp;u0tpeoiieiytlm2rlums;u4 ltnxf tydoptrauvsl()s2ur(opiydape mfeta(fsDuru oot0olt mf3tadla2eaumpnu0 renifcoydfmteau o t) eto(r3ou1alt  ivsa(f rrm(mpot1open o3iysfs2rl(vo;u0artrmo3ty1laD ln i;() 2tmim3oudlptnmiesatfsDrrxmonu0apx ii3tld m emump;u)aetrir io1op elu o;t)s2ur(opiydale  ietas) rrrx pno1altoio3tytfsDua(vo;u0 rtriociydopDeaueo;()seumio oy4om   ivsls sDrmxroou1optnio3tldlsDel( snu4trxnif tytomteau s;s0s2xmimpoo1al   nvs () rrm(roou1olt moeiaslsDran o u) lenxf iatoat  i sl()s2xmim3oy4lpenlfei sfaDuau ooo0alto fetldlm ea(vo u)aeenifciadfpteaivs;s)sexr(rpnu4ap n nct sfaDtmu pno4alt  iciltls ulums;()arxoif to1fpDelu il(0trxoirpiydaleelfciat  2umxr ou4tpenmicilt m rm( p;t0areoxr3tatfaD  u ols) ruo(opnodlp nlfetas srua(rpot4altoii3iat s2uaumo u) rxoxocoodlptr uvo;s  2uoir iydap  mneils)arum(m ou1texo oeiydla el(vonu4trtrif3ootlaDraivslt0trxmxr3iu1lpe lfctlt aDraxm oo0altn ietasfaDuluvo;u)altrifciytfpD  i o;t0 2uoxo3no1ame lnciatfsrumx pno1alt  o3iatfm2um(monu4aleoxfcta1oa eau o (0t2uoimpoy4lpe  fvtlsf Dra(mpnt1teeoioeiyslm uaump t0 renmrcto1faD lneo;t)srtmxo ny4al nmivt (fa2ur(mo;t1texn ictadfm umu p;(0 ltrmr ty1omte n i ()trtmiopnu4apenmfviat)s2rr(rpnu1oeeo feilsfm2eanvpnt0artrir3ootoaDrlueols)t2tr(mpiydom nmfes s) 2trumpot4tpx io3tyt sDeau sn()altnmr3oodfmD  n s t  2xm(o ny4lmenlivt (f rra(mpnu1ape  f3tldfs elu ont4areoxfcoatomtrlies s)s2tm(m iu1llt mieia()a2tm(  no4olxn ietat a2eln snt)artrxocoadoatrluvol(0 eum(o3iudamtnlncsat) rtr(  no0apxoiieiaslaDrluvp;u0alenif3oy1oatrai i;( t2xrim3no4ap e ies ( artm( oot4tpxn ociad m2rauvp;u0arxomo iydoa r ivo;t teur(opiu4op nlfviasf Draumoot4tle mf3iadfsDul(mo t4trtrmfcty1lm  an slt0t2urirpio1ol  lnvt sf rtmu  no0apx ioeiat a2rm(vp t4 rtoir iotopDraivs;(0srumim3io1aptelictas)aDumumooo1tpe  i3tys m rm(vont4alxnio3oatlpteauvi () euoim3ou1am  mivsat a2rm( o;u0tptoio3iyt s2ua(vs;u4trtoio iatop raueo s0 rxrim iy1llt lneil( a2rrx ooo0opt mieils aDulu o u0aetoxrcoydfpt  nes;s0 euoxmpiu1aleemivtas)aDra(m ;o0olenmf3tytfm2ean s (4texnxr3oydfpDelivo;s  2to(mpiydomen fetas)aDtr(mpoo1tpeniiciadla rl(von(0 eerxr3io1fa eanei;s)srtrir3iudom e ivil( a2tau ooo4aexnmocildfa2um( s;(0teerxo3ootlp r nvils0t2toio3oydlme  icsat)s2rrumpot0opt moeiltfs2ra( p;(4alermocio1oa   i o (0 euoxrpiydlltnlnvtl()sDtrumono4apenii3iytfaDrm(mo () rxoir to1fm e ivs s s2tmxr3oy4alen ieil( arurum nu1aexnmfciad s2emnvont0tltnxr3iotfat anes;s)trurim oo1openlivsat)a2tax pot0tltomietadfa2ran s;t)tlenxo tytop e uvi;s0 2uoio oudlpen ncsas  2trur ou0optnifciadlsDumnvo;(4aleoxf totlpDeauvi;t s2tmxo ny4op  lnvt ()sDtrxrp;u1oltoii3iytls2emu pn(0 lxnircoatoa rlivo;t)setrim oo4apte fvsl( sDrmxmp;t0oltnmfeiad s2emnmpnt4trxoxrciotfp elivils s2xo(rpoudome  fet t  Dumxroou4apxoiieiyd mDulu pnu4 rxomr3oatlaDeau s;t0s2xrxo3ny4am e ietl() 2umxmont0apxoif3ias s2uauvsnu0 rtrif3oadfm eauvo;s)t2tm(mpoy1omt licsl() 2raumoot4altn ietysfs rmumon(0 ltrmrctadfp   u o t0 2toxo nydolte fvtas)a2tr(  ;o4alt  ietat s2eln p u0altrxf tatfa r ueol(  2tmir3iy4openlnvsas)sDraumpnu1tlxnio3tltla2ean on(4 rtoio3oadlmt anvs s teurir ny4al nlivslt) Draxm ;u4apxn fcilslm2ua(mp u0areomf3oytlmD  ivi t truo(opoy1lp   nvias aDrmum ;o1alxo oeiytfsDuanvs;u)trxoirciatlm  anei;s0texmiopnudame mnctat  2rm(rp;t4oeeoifetatfmDra(mo (4tlxrmr iotfa raivo t0s2uoiopou1oltnlncs t  2ur(mp;t4aex ifctlsfs2rmnvo u) rermf3tytoatelueo;s0t2xrimpoy4al  livtat s2tax  no4aetoiieiltla eauvpnt) exnmo3ta1omt  nes t0srxriopou1lpee ici s  2ua(r nu4tlt  ieiyt a rl(vp u) rtoifcoa1la elues;s0srur(r3nu4am  lnvilsf 2tauro;o0tlen icilsfaDrm(vo t4alxnmo io1fm  auvo t)tetmxm oo1lp  livils) 2um( ont1opeomfciasfs rlnvs t4 rxoir oy1op  anes (  rxr(o3oy4apeemnvias)srrau oot4olen o3tlslm emnms u)arxoxo oydlmtrai s (0 2tr(r nodlme  ieils a2rmu  ou0alxnmocilsls2elu sn()treriociy1fpteauvi;s0sruoxo3io1lm nmfviat  Drau onu4oet mi3tyt sDul(msnt0alerxrctodla e ueolt teumio3ny1lm  mics t)a2rrxr no0opxnmfeils a2uan o;u4 rxnmo3to1opD aivi;(0teumim3iy4omeemfetlt arrr(monu4apeo ictlsls2ul(vp u0tleomf3ta1late n ils)truoiopoydaltnmfcilt)s2tr(mpou0alx  i3tyd mDemnmpnu4tlxomf to1fmt luvi;(0 2xm(o oydam elfvtasf Drmxr no1tlenmiciydlsDra( s u) rxoxocoodfmDrauvi t s2tmxmpnudll nmfvsasfa2rrx  nu0aeen i3tydlm rl(ms;t4 etoir3tydfm  livolt)srxoxr oy4ol n fct s) 2urxm oo1aptnmoeiad s rlumon()trtoir3tydlp eluvs s0teumio3nu4altnmncil(fsrua(r ;t0apxo ietat m2ua( s (0 rxnmfcoy1lmtrli i t)t2tmim oodll emfcsas) rumxmpoo1oexniieiasfmDrluvpnu0 eeomr tatfaD  nvo t  eto(rpou4amte nvslt srtaxmont0aex mfeildlsDumn s;t4 lxrmocoytla  luei t0sexrxr oy1lmtnmnet t)sDtrxm nt1texo ociatlm2ul(mp;(4teeoir3iadfptean o (0tetmimpoo1opt mfvt s  Dua(mo;o0apeniieiys sDra(vsnu)teenmf3tadoatrai o (0srtmxrpou1ale mfeia() rta( p;o4tltomoeiatla rmn p (0areoircia1fp eli olt0srxr(r3no4lpeelici sfsDurxmp;t4oexo ictlsfs rm(vo;u4trxnxo oodfpt livs () 2tmimpou1alen fcslt s2trxmpoo0aeeo icilsfs ul(vs;t)alxrxf3to1lmDean s;t srur(opnodlpenlncslsf Dum(rp;t1ope io3ilt mDuau s (0 exrxr tatlm  li il()trxmio3ou1ope lfcsat)arra(mp;o4tlt  o3iyt sDranvp;u) ltoio tadfateanvs () 2umio iy4lpe  fei tfs2rrum ;t1aleniiciytlmDea( p u4tlxomrcty1lpD lues;t)t2uo(r iy4lltnmneils srra( ono0tlxomo3ils sDranvs;u4 lxoxf oo1fp eluvi;t)trtmxm3ou1oleelfes (f Dra(m ;u1optn o3iaslaDumuvo u0 reomfciydlm  lueo;s)srtmxr3ny1omenlivs tfarua( pno0tpeo octlt mDel( s;t0artnif3oytomD  i s;t0t2tm(mpoy1op n net (faDtmumpoo0openifciadfm uan s;u)texomocoy1la eanvs;t  2ur(rpiy4omt mics tfaDra(  nt0oet  fetad mDumnmo;()aetrxo io1omDr uvils0trtrio3no4lm  lnes tf rta(m no4aleoioeias a ua(vpn(4trxrir oo1lm e ivil()trurxo io4apen ivi t  rur(mpno4optoioeild sDelums;t4artnxocoodopDelnvolt0srxrxr iodopee fvsls a2umum nt4alxn octat a umuvs;() rxrifcoo1fat  ivils sruoxmpoy1omtnmnctl(fsrtmum nu4apeomo3iyslsDel(mo;(0 ltoxf3to1lpD  n o;s0 etrirpny4amtemfvtl()srtax oot1optomociasfmDeanvpn(4tltrmfcoatlp rlivsls)trxoir oy4ol e fet t)aDtmum ;u4apen ocils a rlnmp u0 exrmr oo1lpDelnvi;t0s2tmir io4amte netls)a2urumo;o0aptomf3tadlmDuaumpnu0 rtrmr ootfaDr nvo;( seuo(m3iu4lme mivil(fa2uru  ot4oleniieildfs ul(ms u)aexrxf3totfmDeauei;t0srxmio3ny4omt  ietltfarumurono1alxoiociydfsDrluvp t4tlxoio3totoat aneo;t)t2tr(o3iodlle  nes ()s2uaum no4alenii3ils sDrmnmp;t0artnmocty1fptrau olt0sexmirpnudomtelnes t  rua(  nu4tpeoii3tys aDul(vonu)artnif3ootom r n sl(0teurir3ny4opt livt sf 2tru p;t1ape mfciltfs ua(vs;u)aeeomr oo1fmDeluei;t setmxopoy1omeelictls s2ta(  oo4aetnif3tadfm elu pnu0aexnifcoa1lpD  nesl(  rto(m3oo4oltnmfetls)srur(rpnu4tlto f3tlt m rm(vonu0alxomf3oadlp eanvo t)sexo(o3nu1apenlivi ( a2uax p;u4aetnmoeiasfmDrau s u) exoiocio1fmt ln i s t2tmxo no4llte fetas a2taxmono4ole ifciltfs2rmn s;t4texrxo tatlat an s ( seumirpiu1oleemietlt  2rrxm nt4tpxn iciltfa umu s;t4aetnxfciadoaDe ueil() 2xm(mpoydopte fvil(  2rruroou0oetoiietls m2em(vp t)arxrmo3iotomD aiesl( srtm(r nydolt lnet (farrrxm ;t4aptomo3tas aDranmpnt4texomo oydlm  ln s;( t2xrirpno1alenlietls sDtru o;o1tetomoetyd a2umnmp u)trtrxo3to1opD ai o ()trtrxopiu4ape micsat s2ra(ronu0alen feiatfs2ulump u) renxo tadlat  u sl(  2uoxmpnu1apte fcsl(  rrm( pot4alenio3ildlaDrlu o u) rxrmrciodlmt luvslt) rxo(mpno1lmt mnvsls) 2umxr nu1apx  f3iyt m2raums u)tlxrmrcoatfp e u i t) eumxm3ny4olee ieslt) rtaumo;t1tpxoiietadlm rln pnt)aexrmocoydopt aneolt s2xm(o nodape lnct () rta( poo1oetomoetytls raumpn() rtomo ootlm  ln i (  euoxopiu4lpenlfvilsfaruaurpnt4aex ii3iytls2rm(mp u0alenir totoatelnvol(  2xoxmpiodapenlics tf Dtrx o;u0ole  f3iasfmDrl(vp t)trxnmr3oadoa  lnvo (  2urimpnydal emfvsas s2tm( onu0tptnii3tytls2ulnmsnt0trtoxo3iy1optrlivs;t seuoxr iu4aptelfetat)arrmxm nt1aetnif3ils m2ulnmo u) lxoxo iodlpD liei s0 2tm(opoy1olenlfes ( aDtaumooo0openmfeilsla2em( o;u4artrxo totlat  uvs t) 2xrxo3ou1ap  liesa() 2rrxr ;u1alenii3tlt m2umnms;u)trxoif3todfp  aivs t  2trimpoodal elfvias sruaxro;t1oet  fciyslsDrmn p;(4teenio3totlaDe n s t t2xoxrpiudalt  fctls)a2rm(rooo4aptnmiciatfs2emnvp t4tltomocoytfpteanes s) ruoxm nodamtnlivi s  Drrxm no4altnmiciaslaDrln s;(0trxomf todfatean o;(0trur(o oy4apen neslsfarurxmpoo1texn f3tyd mDua(vpnu4trermfcoydlpt aivsls0 exoir3nu1llee nvs tfaDumu pno1olx  fciatfm2uaums;u0 etnio3oa1fmtraueol()srxoim3oudlm elfciltfs2tmumont1teeoio3tltfs2ulnvonu4 leoio oytoaDrlueol( tetoxmpiy1omenlict t aDrmumoou4opt  i3iytfaDeluvo;()trtoirctadlp   ies t  rxrio3ny1op e nei (f Dtrx  ou1alxomiciysla2em( s u0texoifctydoaDelnvs;s t2ur(o iy4omee icias) rum(mont4tetoif3iltfsDranmo t0tetrirctytoptelnes;s  2urio iodaleemictat)artru pou4apen fetltfa uanvont4trenio3ty1fmteau i ( t2tm(rpiy4ameelivtl( s2tm(  ot1opxnioctat m rlumsnu0alermfcty1oatraieils)s2trxmpnodll n ictltfa2trx ono4ole  o3ilsfs rm( o;()aexrio iy1oa rlivslt  eumxo3iu1omenlict s)s2um( p;t4apxoiociltfs ulumonu)arxrifcty1oaDr ivi;s) rtm(o oudale mnvtlsfsDtmxr oo4apt if3iytla uanmp t)trerxocoadopteauvs;(0t2xrim3nydlmenmies s srrr(m ;t4alx  iciltfm2raumo;u0tlerxr3tatlatelnvi;s0 rxrir3iydamt micta( srurumont4olt ifeiad m rmnmo t0arxoif ia1fptelu sl() rxr(o oo4ll  mneta(f Durx  no4olxo ociytfa ran s u0trxrxociodoatran o t)sexo(m3ny4amte fvslsfartaumpnu4oeeomo3tys aDelnmo;(4aexoif iotla  lnvs;(0srur(rpiy4lmenlfesa(fsDrr( ont1olt iictld m2rlnvp t0 leomo3iy1lmDrlu ol(0 2uo(rpno1lptelnes () ruaxm ;o0oeeniiciad s uln p (4 leoir oadla eln i;()t2urxo oy1omt  iciatfarum(r oo0aleo fciytlm2umu o t4 rtnmf3ia1fm  livol() 2umxrpiydol elncs t) 2rrxmpno0alx mociytla eauvo t0 exomf totomteln s;s)trxm(r3oodomenmfvslt)srumx onu4ape mi3iltfs2rlums;u4texoxrciytoateli olt trxm(r3iudlpeelfvs t sDtau pot4altn i3tyslsDemnms (0trxoircia1opDelu i (0srum(r3ou4oltemncs ()s2raumooo0alt mi3tltlm rmn p u0tltnxocty1lpDrlues;(0s2xoio iodal n nvsl(fsDuaxmpou1olxnifcilsfm ua(vs;u)arermfctatfptrau s ()teumxmpou1lpte ivt (fs2rmurp;u4tetoifeiytlm rmu s (4teenif totoptelues (0trxrir3io4ap e fet t) rta(m no1opxoifeiltfs rl(vo u4tltrxr iadfmtelnvil()trtrio no4ale mivil( sDrrxro;o4olxoio3iadlsDuaumont0 rxoio3iatla   nes;s)seto(r io1om elfvt t)arrax pno0opt ii3iydfa rl(vp;u)tetrxrcoydlmDelu sl(0s2trio nu4lmtn fci sfa2trx  ;u0teeoifciltfaDuauvo u0tlxnif iy1om r uvs;s0texmiopno4alte nesas s2trxm ;o4tlen ictltfmDulnmon(4aetnmo3oadfmDe nei;(0t2xmir nu4lm  lfetl(f rrmumo;o0aex mo3iytfa rl(mpn(4aetnio3oy1lp   nes s)srxrimpoydoptnmfcilt) rraxm ;o0tptn ietatfaDua(mp t4tltrxfctotlp r ivs s0t2uo(o3io1om emivsatfsDra(m ou0ole mictad m2ul(mp;t0teeoxfciydlmDeau ols)teumxr iudaleelfvsat) rrrxmoou0oeeomo3ias a2emuvon(4 rtomr3to1fpDr i i t  exo(m3nu1am e neia() Dra(m nt1aee mfetlslm2elnvp u4 etrir iodfat  ivsls trtrxrpnu4ll  mnesat)aDrrx pnt1tpt moctys sDulu p;u0tltrmf3iadlaDe i ol()t2uo(m iodamtelictas sDuaxmont1tlxomf3iadlmDumumon(4texomo oa1lmDraiei ( t2um(o3iu1am   fvtl(fsrumuront0oex  o3ils a2rlumpn(0aeeoxr oydomDran i;t tetr(r oo4ol emfcs s aDum(mo;t0aet mf3tat s2rl(vp;() ltoio iy1oat  n ilt0 2trxr3ny1ll nmnvt t)arrax onu4tlenifeiydfm rmu o t4aexrxfciadla  lieolt) exmxo io4oltemnvtltfsrrmxro;t0oexnif3iytlsDua(ms;u) exrxr todfm  luvs;s0tetmiopiodlm e feslt)sDtax  ;t4ale mfcias aDrln p;(4tlxoio iodla raueo;s) etr(m nu4alt mncil()arua(m ;t4texoiieiadfs2rm(mp t0 lxnmocty1om ran olt)t2toxm nu4al emfvtlsfsDtmxr oo0olenmocildfsDuanmont) etrio3tytoa raues;s seur(o oudap elietatfartrxmo;u4oee micilsfa rl(mp;t)alxnif3oadfp   uvo;(0srto(o3ny4lp emnvtlsf Drm(mpot0oleoiociys sDea(vs;t)aeeoifcoy1omt lu o;(  euoxr oudam n fvtl(  Durxr oo0oeeo ieiysfa rm(ms;(4alenir3iydfmD  ivs s)tetm(r3no1alt  ies (f rrmum ou4oetn fcilt m2ul(ms;u)tetnif tytlmtr i sls0teuo(m3ou4lmeemnci (f rrm(rooo4aexoiociadlm ulumpnt) eenxo3ta1omt  ivs;s t2toiopno1lmtnlnctlt artax  oo4tpe  f3tyt aDuluvpn()trxoxfcoytom  lnvo;()trumxr3oo1ll e fci t)srurxrono0oltnmf3iad m2rlnvsnu)trenmocoodop   i o;()s2uoimpiydop elfvs s  Dtmx  oo0ole mf3ildfm rm(mon(0 rtnmfcty1opt auvolt teto(m3iy4olen fetat) 2rrxmpou0oetnmoctadlm ulnmo;(4aexoif3ootomte ivil()tetrim3iodap n icsa() 2rru  ;t4oeeo icils aDrl(monu4 rtrxo3ia1laDr ivo;s)s2tr(o iydamt  icsat sDtrumoot4alt mf3iadls2rauvp;(4 ltoxr totfp eluvo;t0tetoxo3ou1om   netasfaDurxmo;t0opxniociys m el(mont0tlxnmf3ootlptrlivsls0 2umim3no4lpenmietl()a2taxm no4aptomf3ilslm rluvsn()trxrio ta1fp elivs s0 exoxr nu1lptelncsasfarrrur nu4alt if3iysla eanvsnu4aeerxo iy1lp   u sl() rumxo3nodap n nvsa()sDumxmoot4ope iicildfm ua( s;u0aetoifcta1fpDe i o;s) 2xrxm3ou4om emivt ()arurx p;t0openif3iyslmDumumo t0 rermf3io1lmDe uvo;t)s2xmio ny1op   fcta( s2taxm no1alt iietlslm2ulums (4arermrctotfpD anvo;(0t2uriopoydamt lncs t sDrmurooo4aexomoeiltlsDem(vsnt0 lxoio3ootlaD au s;s0s2tmxm iu4altemies tfa2ua(mo;u0texn i3ilt a emnvp t)tetnir3oa1fate u slt  exo(m iu1altn fcta( srua( oou0oexo f3ilsfsDemn o u4altrxo3oo1lptr u o;t  rurio ou4lp  lfcsl(farta(r ou1opt  o3ildla um( on(4arerio tydom r neolt)sexrirpnu4opt lfei ( aDum(m nt4olxo ociad s rl(mpn(4aexnmr tydlp   nvols t2tr(o iy1omeelncsl( arra(r ;t4apt mi3tasfm2uaumo;t)aexnmo3ootoatraieslt trumimpnu1ame mfvsat  rtrxrpot0aex iietltla2raumo (0 eenxf oytopD aieo;t) rtr(rpiy1lltnmiesat s2raump;u4tltomo3iaslm2ua( p u0 lermr3iodoa rauvs ( srtm(m iy1ameemfvtat s2tr(r nt1apxoioetydfa2ul(vo t) eerifcoy1lm rlu sl()s2tmxopio1opt  fvils)sDua(mpou4opxn ieildlmDraumo;(0 ltomf tadfpD au o s setrimpnu4llt  ivsl( s2ur(r ou0alto fetlsfm uauvon()trtnmf ia1omte u o s) ruoxo iu1ap n nei s srtm(  no1open
\ No newline at end of file
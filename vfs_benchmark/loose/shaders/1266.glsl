@@ -0,0 +1 @@
+ueils0 rxo(m3no1lleemfvi t)artaumono4tleomf3iatlmDuau o;(0areomo3oodfmDr nvil( s2tr(o3oo1lltemieil() rua(r no1tet  oeiatlm eau o;t4alxrir3oytfmt lueo s0t2to(r oudllt lnesls)s2trum nt0tlxnmf3iaslsDrlnmsnu0 lerxf3iatoateanei;s  exmio iu4llt mfcs (fsDrmx pot4oeen icilsfs umu o (0tlenifciotfa rliei;s)texmir3io1om nlivs sf 2rruro;u4aleoiocilsla uluvs t4 exoxf3iadfaD  n i;t0sexrxr3ny1olt  fcia( sDurxrpou0teenifetat s eanms ()artnxrcoodlpt luei t srurio ny4lpenlivils)sDuaxm ;o4ole  iciyslaDua(vonu4alenmf3tadfmte ues;s0t2xrim3iu1aptn nvsls)a2ra(m ;u1oeeoioeild m2eauvpnu)aexoxf iytlatelu ol(0t2toimpnydalte icils) Dumuroou1tlt mfeiyd s2ulnvsnt)trtomf3oo1faDranes () 2um(r3oy4llt mnvtat srtrx p;u1aptniiciysfaDeluvon()tlxrmr tatoaDr u ol(0srumirpiu4lle mfeils) Dumxmoou4alxnmieiytfmDeauvpn(0alenxo iadomD  nes;( teuriopoy1lm   nviat sDrmur ou4optnmfeiydfm ul(mo u4alxnxf3iodoa  auei;(0t2tmiopoo4ol nmnesa() Dtmum nt0tlxo oeiysfsDranmo;u) exnmo3tadlmDrln o;t t2urirpny4amtemnvilt) rtmumpoo4apt  oetyt m2eaump t)tetnxf iatlpDeai ol(0srum(opio1apen fesl(fs2ra( poo1aexnmoctyt s2ean o u4trxrmrcto1oa ran i t0 exoxo3oo4apeelfes s) Draurpnt0tpxnmoctltlmDrl( p t4trxoif3iodfmD lieils)sexo(r oudoltelict s arrrxm oo1texn icilt a2eau snu4aexnioctytlmDranvs s tetrim no4al emiesa( sDua(rp;o0aex iociytlm2emuvonu0 etrxo oytfmtr nvslt  ruoxopiy4olee nvia(faDtr(  ot1oetnmf3iatlmDelnms (4 rtoif oodomteanvilt0texr(opoo4llen fvtas) 2trur ot0alxnmietltlm2umuvs u) exnifcty1lm  auei s  rto(m3oy4ap nmfesls) 2rmu ont0apt  ieiysls emu s t0 lxnmrcoy1op   nvi;s0texrim3oydlmeemfvs sfaDrr( ont4tpxo i3ildls um(vont)tlxoiociodlp  auvi (0sexmxr io4lmtn ies s sDrm(m oo0aeenmoeiytlm elnmp u4alxnxociatfpDrlu i t  rtmxo3iydlm   ncsat) Duax o;u1tlenioetas sDua(vs ()trermo todfmtelieo t  etr(opoydalee fcslt)sDta(root0aeenifeias m eluvo;t) rtrxrcoydlaD  ivo s) etmxrpiydop nmfvt () Duaxmpnu4oexo fetys m rluvont4trerio3ia1om eanvil(0 2xmio3no4opte iesls s2ta(rpno0tltn oetlt aDranvpnu0aexomo3todlpDe nvilt  ruo(m oydamen ietl()a2rru oou1tlx ioeiys sDumums;(4 exrxo3ootoat luesls trtoim iy1ll e ivia(fs2rmx poo0apt mi3ils sDem(vsnt)artrxfctadfaDeau s;t seto(mpiudaltemfcsl(  2tm( onu0aex iieiyd m2elu o (4trxrxfcootoptranvo;t0t2umimpnodomt mnvt tfartmx pou0olenmf3iydls uanvs;t4 eenmf io1op rauvol()t2xmxo3io1opeemicsat)a2raurpou4olx mocildfm rl(msn(4 eenircoytfp  lnes (0sruo(o oy1amtemfvslsfarrr( onu0ape  ieiyslmDrau o t) exnmfctydfpte nvsls s2toiopiy1olt micia(  Dtmxr ou0alt miciadfa um( p;u0texoxo3tadlmDrlivo s0s2xoirpou1ome  ivtl( a2umu pno0tpenifciad s rl(vpnt) exrif oodfp r i s ()setmxr3oodomt  ics t)aDrmxrp;u1aleo fciltfa2uln pn(0 ltnmf totom eaivs;(0 exo(o3oy1ol n fvil( arrau  ot0tle iociadfs ul(mp;(0 ltoxr iytoptrluvo (0srto(m3ny1lmtemfct s)sDtaxmooo4tlxoiietatfa2rluvpnt0alxoiociatlpD auesls)tetmxm3io4lltn nesl(fsrum(mpot1tleoifeiydfm2el(msnt4 rtrxr3ootopDeaivslt) rum(m3nu1lp e fvias  Dururpou0tlt iociys m umn p;t)artoxo3iotfp  anvo;()s2tmim3ou1omtn fvt s  Drm(  ot0oeto i3iyd mDrln s (4 rxrirciadoa eanei s setrxo3nydalt mfetl(fa2rru  oo0apeoioctat s2rmuvpnu) ltrifcoo1fpteluei s)teurxr no4lpte ivilsfsDua(mpoo1aetn oeiad sDumn sn() etrxf3ty1oaDrln ol( tetmxr3oodamt liei t sDtaxroot0tex moetad m eluvp ()trtrxrciadom  aivsls0t2xmim nu4ol emfeiatfs2uax  ou0apenmieildls rm(vs (0 rtrmr oydfm   ivo t t2umxm iydoptnlies s a2tmu ono1olx ii3iasfmDrlump;t)tltnxr iydfat  ieo;s0 2umir oy4lleeliesls  Drmxr no4texomiciysls rau o;(0tetnio3oy1lptraieo;t)trurim3oy1oleelict (faDrrx poo4teeniiciydfm emnms;t4 ltnir todlmDeluvi t)tetoxo3ou4llen fvsas)arta(  no0olxomicild a2rau pnt) eeoxr oydfateauvs;(0sexmimpoo1am  livs (fs2rau  no1texoio3iasfmDuln onu0aexoifctodfaDrai o;(  2xm(r3oydlmeelfvia( arrru p;t4aet  ietld m2emu o u4alenmr oytfpD  nei t0s2trxm oodlpeelicta(fs2trxro;o4teeomieilsfsDeanmpnt4trtoxf3ootopD  uvol(0 2xm(r3iy1omeemfcilt aDtau oot0aeeo o3iysfa2rlumsn(4 eermo iadoaDr ivs t  etmim3iudam  lfvtls aDrrxmpnt1apx miciadlmDuanvsn()teerxo3iy1faDrai ol()sexr(o oudom  mfeslt aDtr(mono0tltn o3iatla eau o;u) etoif todfa rluvi;t) etmim oudapen ivtat) 2truronu0apeo fcild a eluvo (0aexomo3oydopDr i s t)trtmim3ou1ol nmicsat  2rmu  nt4open oeiysls2rau s (0aetnirciatoa   u s s srur(m io1apenlivta(f ruau o;o4alxomicilsfa2ean snu0teeoxo ia1fmDrau o s)sexmim3oudol emnet t)aDrmxrpoo0alxoioetydfs2el(vs;t4tltrmo3io1op   ivi;(0sexrxr iu1apt  fesa() 2rau p;u1apenioetldlm eanmo u0trxrir3to1la raneslt0srxm(r ny1oltemicsas s2rmx ont0olenmictls m2umums (0 lxnxf3oodfm rln sls  rxm(opio1optemnetls  2ta( ooo1opxo oeils s rluvpn(4alxnxrctodlpteliei t)s2toir nodlltelnciat) rrauront1aex  oetlt sDrauvp u)aleomocoy1lm raivi;t srxrim nu4aptemivi t) rta( o;t4opxnmf3iydla2um(vo;u0aleoir3iy1fat li s;(  etm(r iydomtn ietat)s2rrumooo4tlx  oeiys m eau pnt4tlxrir3oydfpt  ivs (0 2trxr ou1ap  mfvslt) Dumur ot1opx io3tlsfa rlump u0 leoxfcto1fpt  i s t)trur(m ny4ll nlncia() rra(  oo4altomoctytfm2rmumo;t)trenmr3oadfa elneil()s2uoxr3io4am elnvtl( a2uaur nt0tpen fciatfa rmnmo t) etrmo iodfmDr neils trtmio3iudaptn nvt ( aDtaumo;o4opt iicilsla rmnmpnt) etnmo totlmtr ues t  rtrir oo4amte ivta( s2rm(r nt4tet  ictys a2uan o;u0altrxo oadomD lneo;s)truoxmpny4lp  lfvi ()aDtru oou4altnii3tls mDeln p;u4tlxrxo3oydlaDeaieils)t2xo(m3oo4omee nesatfa2tmxr nu0tpen ocilslmDul(vo;(4aetnxocio1lm e neo;( trxo(rpiodlle lfvslt sDtruroot1oet  ociydfm rau ont)altnmociotfpt liei ( seumxm3oo4ol n nvia(  2rru  ot1tltomoeilslsDuauvo;t)texoxr3oa1fmtelueo;s0teurio3oo1al e fes s)a2ra(m ;t1tlto fctyd m2rluvo (4trxnif tydlpD aivol()t2trxrpoodaptemfvilt)s2raump;o0olenmictatfm um(vo u4 eermf iydoa raneil()s2xrxr no4ap  lfvs ()s2urx pno4tpenmictytfa2rmn onu0alenio iodlmte uei s0 etmxr nodlmtn fetl(  rtauronu4opx  i3tatla2rmu onu0tltoxf oodop elueil()seur(opoydoptnmicils) 2rm( pou4tetn ociadlmDum(mpnt)arenmf oa1fmtelieol(  rxmir3oydame  ictls)a2trurpoo4olxo i3iysfs2rmnms;(0 ltrir3oa1lmD anei t)teurxo oydlpte ics s)sDrau poo4opx  i3iydlaDulumo;u0trtoircoadomDeluei;(0t2uoxo3nu1olee nctas aDum(  ou1apto feiasfmDumn pn(0tlxoif3tytlmtrauvi s0srxrim io1lleemicia( a2taxm nu0alx iieilt a2uanvs;(0trxrir3tydopte ivo;s) 2trxrpnudap nlnvsa( a2ra(moot1oleomfetlsfsDean p t)aexnmo oatfa r neo (  euoir3oy1ll elfeslt s2ra(  nu0alenmociyslm2um(vp;() lerxr3oatopDraieil() euoxo3ou4op  mfvsat) Dtauro;u1aeenmoctldlm2rm(ms;t4alenxrcoadopDeaues s)s2trimpiu1ap e fcias  rtr(r nu0apxn f3tasfs2uauvs (4altoiociy1faD auvs;s setoim3oo1alenmfcsl(f Draxm oo0oetn ociydfa2ranmo () leoir iy1la   ies t)texrxo3oodap elnvs sf Dta(m ou4openmieiltlsDumnms (4aeeoif3oy1fa eauvs ( srxoim oydoltn fetat)srrmx oot4opx ioeiysfs eauvs (0trtrmrctotlpDr ivilt) 2um(m oudllt  fcil()srum(rpou1tltn feiadfaDeaumo;t0altnxo tadopt au o ( s2to(r3iy4lptn iei tf 2uru pnt0olxnif3tadfa ean s (4 lxrio3iotopDraies s)s2xo(m ny4altn fviat  rtau ooo4tlx  icildlsDrl(vp u)arerxfcoo1lmt ln s s0t2xo(m iy1amte ncta() 2uru o;o0teenif3tydfs um( snt4altomf3iatop rlieo t0srxo(o ou1lpee nvi sfsDrr( pou4tpxnioeiadlm ulnvs;t4aeenmo ta1fpDeluvs;() 2trxopou1alenmnct ()s2rrurpoo1tlxo f3iltfsDuan o (4texomo3tydlp ranvs ()sexoirpnodamen net t aDtrumpou1alto fciyd a2ul( s;t4arxoxocoytoa   nvo;s)seuoiopiu1lp elnvta(farua(ro;o1apt  i3tat aDea(vp;t)aexnxo3oadfp rluvs ()srxoxr3no1amte fvi s arumuront1aeenmieiltlm2emn pn(0trerxf3oa1fptrlies t0srtmim3oydam e fvsl(fsrum(m ot1optn oeild aDrmnvo ()aexriocta1latelues (0trxmim iu4om  lnct ( s2rmumoot4aet ifeilt a2el(vp;u0aleriociodfpteln il( teumimpnydaltnlncs (  2tr(mpno1opto oeiasla rm(vp;u4 rxrioctadfmt  ues s0setr(m ny4lp e icia( sDrax pno1oetomocilsla umnmo;(0 rtoxrcoodopt  ivslt)setrim ou4lp  mies s)sDurxmp;o4ole  fcild aDrm( on(0tleomo3ootoa  an ol(  rxmim3oy1lltn iet t a2rrxm oo4opx iociaslmDuaumont0trxnmo oo1op r nei;( trxrim nu1am n fvsa(faDtr(roou1olto feiltfm2em(vsn(4alermoctatomD anvs;s0tetr(o3iy1ol e nctls  rtaxrpnt1aex ifciysls2ean pnt)tlxrmrcoy1oaD  nes s)texr(o nu1olt  fvi sfsDtmu poo1aeeniieiysfm2rl(vs;t0altnmfcta1fp e n ols) 2xoxr oy1om elivs sf 2ua(r oo4aleo i3iytlaDum(monu0tltnio3ty1optr ivs (0trtm(m iy4omt  fcils  rurxm ot1oetn ociyt s2umums;(4 renxf3totom e ieo;(0 2tmiopiu1lp nlfcsat)srraumont4olxomietldlm rm(vpnu)trtoio io1oa e neo;( s2xo(m3iodamtelfcslt)aDtaumono0tpt mfciasfsDel(vp;t4aeenif oytlmt aivo;()sruo(opoy1amtnlncsl( s2tr(  ;o0alenmfeiltfa rmnvo;()tlxrxf iytlatelnei t  eumxrpny1ameemietatf 2trx poo0oet iictld mDumuvs;(4trerxoctatfpD aivol( srtrxr3oydal nlnctas srumxmo;o0alxn oetldlaDuanvo ()arxrmfcoatoptrluei;t srxmim oydlmtn nci ( s2rm(r ot1aet iictlsfm2uau p;t0aeermocoa1opte ieo t0 rxm(rpoudapenmfetlt) 2tax p;o4openmo3ilsfmDuanmsn()tlxnif3iatoatr ues t)sexmio3no1llenmncilt)sDta( oou1aeenmfctlsfm2rluvp t0aexrxf3todlmDe n o t0texoxm oo1am   fvsl( aDtmuro;t4teeo octys m2ea(vs t0tetoirctotom r ueslt s2xmio3nudlpeelfesat  rra( pnu1tpt  feiatlaDemnmo;u0arxrmo ia1optelnvi s0t2xoir3nudlmtemnetlt)a2rmxrpno1tex mietls s2ulumpn(0texomo oytlmtr nvo;t0setoxo ny4omeelnetls s2rmxmoot1opxn ictatfsDrmu s (4 eerxr iy1oat au o ()tetmxm oo1opt lfct sfa2umxm ;o1opto fciyslmDelnvs;u0 leoir iy1fp rauvols seum(r oo1lmtnmfvi ()sDrrxrpoo1oet  iciadfa2rl(vp (4aetrmfcia1lat anvi;(  eumirpnu4opte ieta()a2uax oot0oee  ieilt a2rm(mo u4 rxnir3oadlpD li o t s2to(m3nu4ol nlivtat) 2raum nu4opx moeiytfs emn p (4aexrmr io1op rauvs;(0 2xr(o3iu4optelnvsl(fsrtax p;t1oee mfeiyd aDul( o;u4altoxo3oytopDr nvol(0tetrio ou1ol emfvt s aDrrx p;u1teeomfeiltlaDranmp;u4 exrifciodlatrai s ( s2xmxo3iydapen nei t s2um(monu1tlx  iciltfa ean pn(0 rerir totoatrai s t t2tm(rpny4ol nlnvs (fsrta(mo;t1tex miciatlm rlnvs;()tlxnmrcto1lm r u ol(0 rxrxo nudlleemnetas) Dua( pou1altn ieilsfa2emuvo u4aetoifcoa1oatr ieo (0 2toxm3oy4ol  mfvi sf Dtruro;u4oetoifciasfm umn s;u0trtomr3tytlate ieo ()t2uriopny4om n ies t)s2tr(  ;o4aexnif3tyd aDum( pnt0 lenxr3iotlmDeanvs s0t2xmimpno4ale mivi tfartr( ont0oet  oeiatlaDem(mo;u0aeeoxf iadfmtrai ol(0trxoiopnodol nlfcia()aDtm(ro;t0aetnif3iad a rln p t) rxoir iy1lmDelivo;( t2xm(opno4lleemnci sf rtrxro;t4tpenmfctatla2rm(ms (4artrif tadlpt  n ols0seurxm3no4lmenlnvtl(fsrrmxmp;u4alxn o3iaslm2eln p;u4tlerifctotfmtrlneo;(  2trirpio1om elnct s  Dum(r no4aexn fciys s2eanvo t)tetnmocoatla r i i t trxriopnodlm  lict ( sDra(mont4opxoiietls sDumn s ()areoifcia1lpDraneo;()setm(m iydol   ieia()s2rrxmo;u4olxoifctlsfs eanmo u4trxrxr3iadfpDrlivil(  rxm(mpoy1omte iesl(fs2tax oot1oltnmfeiltls2ul( o u0artrxr iatfp  livs;()s2xm(o nudlmee nvsa() Dtaxm nt1alxoifetyd s2rl(mpn(0 ltrmociadfa   nvs;t)t2tmio3io1ape mnci sfsrrr(root1teeo o3ild m ua(mp;u4 rtnif todlpt  iei;s)t2toxmpoy4openlictls)a2rr( pno1alxn fctlt aDemnvo t0altoif ta1lpDeanesls) exmiopno1ol e ncsltf 2rrx  ou0tpenii3tad aDrm(vp u0 exnifcoytoaDrlivo t  2xrxr3oy4lp nmfetls  2trxmpou1aex iociltls emuvon()trtoxr iatfm rlu s;t  euoim oudllenmnvsatfaruau  oo4tleoifctyt m rlnvo u0 lenxrcoa1lpteaieol(  rumxr oudole mivsa()srum(rpot0aex ii3ilsfsDuaumonu4artrxr3iytlp  lu ols  2xoxopoydlp nmiesltfarumxm no0texn fciadfm el(vo;u)aeenxrcta1om  lueol(  rtrxrpiodalee fvs t)aDrrxrpnu0altnmiciyt m el( p;u)artomr3oydlpD  ivol()trxm(m ou4op  mnvi ()a2tmx pot0tlenmictyd s uan o;(4teeoif oo1oa elnvil(0s2trio3iu1olee nci s aDtrurpnt4open iciltfm rmnmon() rtnif3ty1oaDeaueo;t0 exm(r ou4lptelfct s  rrmxm ;o1oltnio3iydla2rm(vp (0 eeomrcoydlpD lnvo t0 rxmio3iu1alteliesas)sDtaxrpot0oeen o3iytfmDemnmo u)trtomrcto1fmDelnes;t teurim io4lmtemnvsa()a2ta(rp;u0olen f3iyslm rlumsnt)tetnxfcoodfp  anvsls)setr(rpiy1lp elncs sfaDrm( poo1ape moeiatfmDean ont0altoir3todlptraneo (0 2xrxr3no1ap n nei () Durx  oo1aet ifeilsfm emnmp;u0altoif3oy1la  li o t)texo(m io4lpe lfetat) Dumxmooo0tlt iiciyd mDrluvp;u4aexrmr oo1fatrai o;t0t2xrxopno4ome  nvs () Durxmoou0oexnioeiltls2umu snt)tlxoir3iy1fptr i s;()srtrimpiy1optelfesa(  rumxr ;o4aeeomfciyslmDua(vp t4 ltoxo iytfpDeluei;()t2xoxopou4ape liesat) rra(rpot4alt ifeiyd aDrlnmp;t)artoxf3iotlmDeaues;() 2umio ou1lltn ivils sDuax  no1teeomfeils m2em(ms (0 rtrmo3iy1laDr i olt seuoir ou1al n fei s) 2rru oou4tltomiciltfsDrmuvsnt4 leoxocootoa eaneol(0 etoimpnu4ope livs sfsrtr( o;t0tetnmieiysls2rmums u0arxoxo3oadlmte uei t  rumxm ou1lpe  fesls) rtru onu4ale  i3tytls eluvsnt0 renxfciadoat li o (0srxrxm ou4lltelfesl(  2ua(mo;o1tptoiietyt a rlnmo u4tetrxf3iotom ranei t0 rxmxrpiy1llt lici t  2uax  ;o0apxomi3iysfaDrlu s u4teerio tatfpDranei s)s2xrxo ny4lpt lnctatfa2uaum ot0aexomoeilslmDrln o;u0arxnmr3iatom  lnvi t) euoxo3io1apee fvils)srumuroot4tlxn iciad m2umnvon(0 rxnio3tadoatraieil(0t2umiopoydlmtnmnvilt) 2rmxro;t4ale moctas sDeaump t4trerxrciotoate ivils0trxo(mpio1ll e iet (f 2rau  oo4tle  iciat m emnmonu4trtrxr3tytoat lnes;s)sexr(o oo1op  mfes s)sDraur ot1tle miciysls emumo;u)arxrif3iy1la eln ol(0t2umxmpoo4olt mivtat)srtrum nt4opeomieiadfm rl(monu) rtoxfciy1fp rlnes t)s2xmxm oy1amte nvslt aruaxrpou4oet ifetyt a2uan p;t0 lxoxr3totlaDr ivo t0trxoxrpiy4alte icslt  rtmu  ou0oexnmoeiyslsDemuvsnu)tltoio3iydfateaivs;t0trxmiopnydol   nvtasfs2umurp;o4tpeo oeiltfs2ran s;u)teenxf iatfmtelueil()srtm(o3ny1ap n neiasfsrrrxm ou0apx  fetyd a2rl(msnt)trerxr oytla elivi;s sexmirpoydalenliciat)sDurump;t4apen octad s emuvp (0texnmr iydlm  aueo;( t2uoxm nodome mfei (  2ua(root1alen f3tydlm eanmp u4 rtnio ta1faD  ivsls0trur(r oudop nmfet t)s2trurpnt1oltn ocild m2rm(mo;(0aeeoir3iy1fmDrliei;() etr(o oy4alen nviasf rurxrp;u4oex iociatlsDum(mpnt4altnxo3totoateliei;s0teumxm iudlpt lietls srumurpot0alxniietytfaDrmnmo;(4areoxf3oa1fm rauvo;( srxo(o ny1lmtnliei (f 2ur(mont1tlen iciadfa2uauvpnt0aetomr3todlpt  n o;() 2toxm iu4omeelieiatfsDumxm ;o1apxo feiltfm2rm( s (0 lxrxrctotfpt auesl(0teumio3oo1amte nvt (fa2raur ;t1tlxnifetydfa2ranmsn(4altoir iadfmtranes;( srxr(m3iudomen neslsfa2trxm no1tpeo f3iltfm2rl(vo;t0 eenxf3ootlmt lnvil()srxoxmpoodap e ivils) rumxrpnu1opxn octasfa2ran o t) lxomr3ootfmt aivo;(0s2uoxr3oydlltemnvias aDtrur ot4alxoif3ilsla2emu p t)arenmociy1fp   u o s0 2trxr3io1al elncia(  Durumo;o0tet iictyslaDean on(4 eerxfctydoateanes t seurio3ny1aptemiesa()sDraurono0apxoioeias a rm( snu) rxnxfctydfaDrauvols0 rxr(opou1lp e ieils  rtr( pot0tlxo fctatla ean p (4artrio3oodfpD luvo s srtoio3oy1ape  ncils  Dumx  oo4oeeoiieiadfa rlnvs;u4aexriociatfpt  n s;() 2ur(o3oo1omte ict (farta(r ot4aee  octltls elumont0 lxrxr3ty1latrlivs;t0s2trxo nodap emnes s srtau  ou4tlx  ieiad a uln p;t4aleoxr3iydfaDrluvi s0srtoxo iy1lptemfet tfsrurumoou4oet ioetldla ulnmpn()aeeoio oydopDr nvilt)setmxr3io4optn ivsltfa2ua(mpot0alen i3iadfm2ean p;u0alxomf oytfmteluvi (0t2trim nodamtn icsatfsDrmxro;u0tex  feildlaDem( p u4 ltoir totoatrlnvols  rumirpoodopt  nvt tfarumu  ;u1olx iietasfa ua(vpnu4 exrxo3ta1opDeauvo;s0 exmxo nydlpt  ncta(faDuaxmo;u0oexnmo3iadfsDel(vp;u4tetnmr iydomt  iei s)setm(m3oo4op elncta()a2raumpno1tetniietasfs emnvp;t4aetrir ootfmD  ivi;s) etoxmpno1lmenliciasf rumumono1tex  f3ilsfa2uanmp;u) etnxf oy1fatr ieil()trtm(opno4am elnes s arrmxr ;t1oet  feiatla2uauvs;u0alermr tatfptrlivolt)trum(opio4am nmfci ( aDta(  ;o0tpto ociysla2el(ms;(0trtrxr3tydfm rluvi;s0t2uoiopiudlmtemici sfs2uru p;t0apx mi3iyt m uauvont4 ltrmr tatlpDe u i;t)s2tmir nu1olte ivil(farrau poo0tee mo3ilsfm emuvo ()teerxoctotomt  nvi;t)teuo(o nudll emietlsfa2rmurpnu0tee mf3iyt a2emuvo ()aetnif3ia1lmDean ol( srurir3ny1lmtemncia() Dra( pnt4tltn o3tysfmDrluvo (4trxrmfciatfmte u i;t)s2xo(r3iudam elfcils  rurxr ou1aetnmieiasfm uln s (4alxrmr3tadlpDr ies;s0srtm(m3nudlm nmicsat s2trxroot0opt  iciyd s2umn o;()aexnmr oy1om  lu o (0trxmimpoy4lmt lictls  rtaxrp;t4opt  f3ild sDranmsnu4alxoxfciotfat aies;t0 rum(m3oo1op e ictl(fs2tr(mpou4tleomietls a2ranmp u)trxomr3tatlpDrlivo;()teurxo ou1am emnvt t  2raxmp;o0tlto i3tas m2rm(vsnu0 rxoxocia1opD livo t0s2uoxr oy4op   icil( arrmxmo;u0tlenii3tls a2elnmo t4 exrif3oytoptr ivi;s0sexrio nudoptelics t)aDrrxr ou0oexniieildls2emnmo;t0tlxrmo3tatfa raivs () 2xr(o3ny1ome mnet s) ruaxrono0oltnmiciat m2umnvp u)aexrxf3tatfmDe u i;s0srxrxm oy4ll elfvsa( s2uaxmo;t4altomieiydlmDumn s u)tltrxr oy1la rlnvo t)s2xoxrpoo4lp nmnvil(farurxrpno1tltnmfetyd s2ua(vs;t4trtnmf3todoatrlueols  etoxr3iy4lmtn neia(f Drax pou4aet mo3ildlm um(mo;(4tetrmo ootoaDrlivo t srtmxopou1llenmiciat)aDrr(  nt4tle ioctys aDrmump;(0aexnxo3iotfp   n o t0 rxo(r oodale  ivia(fsDrmurpou1alx iiciyd s rluvon(0tltrir io1fatrluvsl(0tetrxrpiodop   nci (fsrrrx  ot0tpxo f3iat m2emn p;u4tltoxocoadlmD an olt0 eurxm no4ameelfcsa(f 2rm(  ;u4aeenmf3ilt s uln o;u0 leoir iadomDrauvs () exoir iodopt  ivil( srumumonu4aet miciyt m2ulnmo;t0tltoir io1fmDeauvi;t) etm(mpno4om elnvsasfs2umxr ;t4aetomo3iysfm ea( p u4trenif3tadfpDrln s t trumiopiy4am e ncils)aDtrx  ;t1tltnmo3iatfsDulu p;u)tetrif3iytoptrli sl() ruoxo3ou4apt lfciatfaDtaurpot4oetomoeiatfm umnmo;t)teeomocio1fptelu ilt)t2xrxo3no4oleelfvt t) 2rau pou0tpenmf3ildls2rl( o;t0trtnxo3iadopteaieo (0 2xrxr3oo1openmnci (fa2rmxrp;o1oetoifcildfs2ua(vo;()alenmf iy1fpD  nvil(0t2xoim iudameelncslt  rumxmpno4oeeoiictasfm rauvs u4trxrir totoaD livo (  euoio3ny4lme  iviasf Draum no4tpto oeiat mDua(msnu)tlxnmocto1oat li i s0 exoxr3nodop nmnctasfartm(r ;o0aet ioctadfsDrmnms;u0 lxrmocootomteaies;s0texr(opno4lmenmicilsfa2umumoou4opxo i3iltlm2umn s;() eerifciy1fmt aivolt0 rxm(opio1amtnlivils)srtaxronu4opxnmoctls a ea(mo (4 lxnir3todlateaieo;(0 rxm(r3nu4ope  fesat)arrmx pno0aeenmi3iasfa2ul(vonu0tlxriocia1fp ran s;s0trxrio3no4lleelieiltf rrrxmont1opt ifeild s rm(mp;t0arenmr3iatoate nesls0s2tmimpiy4lmtemfeiat sDrmuroot4aetn i3tlslaDul(ms;t)alenmfcoodfmte iesl(0t2xmirpiy4oltn fes ()sDrmx o;t4opt  f3tyt s2umuvp u0artnxfciotoat lnei;t0s2ur(m3nodal   fetat  2rmu oot0apeomi3tatls2ra( p t0teeoifcoodfa  luvo t teurim3no1alee ivsas sDur(r ;o0tlxn fetasla ulu ont)alenircoadoaD  u il( truo(m3nu1lltemfciasf rtrxr ;o1openio3tyd m emnmpnt0 rtnxrctodlpDrli s (0t2xm(o iy4apen fvil(  2tru p;t1alx mfctys a2raumsn()trxnxr3tydopD luvs (0 etmxmpoo1altnmfes (fartr(rpno4aptniictytlsDuluvp;u0 etomr3oytomt  i slt0s2xoxm3oudlltn nctasfaDtau onu4ale  fetld aDrluvs;()arxnio3ootlp e u olt0s2tmxm no1op  lies (  2tauront4oee mfetltfmDelnmpnu)tltoxrcoy1opt lu olt)seum(m iu4opt  nciltfartr(mono4opxoifeiasfs2um( s t4tltrxr3io1fp rlu sls0 rurxmpoo4amtelfvtl(fsDtmxrpno4tetnif3tad m2em( o ()trxrio3iodfaDr uvi;s  2tmimpnu1am n net (f Dtrxmo;o0tptn i3iadla eluvp;(0tleomoctydoaDe ivi s)trto(r3io1lpeemnvs s s2rm(r nt1altnii3iatlm uln snt)altnxf iadfaD li s;t0texr(mpoy1ale mncsls)sDumxm ou4oleniociltfs2ulump (0tlxnmocoy1fpDe uvi s0t2xmio3iy1ap elnes (fsDtmumo;u4apxoii3ildfaDelumsnu4alenioctytomtr n il( srurimpnu4ol n ncs sf 2taxrooo1aptomicils a2rl( pn(4alermr iatoaD ai s s)setr(r ny4lmtnlfviltf Durum no0alxnmi3ildlmDrmumsnt)tetnmrcoadop r ivo s0 eurir ou4lpeelnvi tf 2ur(mpot4texomieiys m2rmumpn(4aeeomfcoy1fatraiei;() rxm(rpiydope lfvsl(f rtrxmo;o0opx  fctldfaDumn p;t0aeermo oatfpDr ivils  2ur(mpnudlmeemies t)arurump;t0olto icild a2uauvsn(0teerioctatop  auvi (0tetm(o iu1al elfetlsfsrtru  no4teeomo3iyslsDelu ont0trtnxoctytla  auei ()teuoxrpnudll nmfcs t) Drrurp;t1teeoiociys s2ul( o;t0 reoir3totfpDrlivi ()srtmio iu4ll elivs tfarumum nu1tpxnmieiatfmDumu o;() rtnxr3tytlpt  nei s0t2xoxr3oudape mfeta(fartm(r ;o0ope mf3iaslm2ra(vpnu)aetomf oy1fpt  ivsls0 rxm(m io1llee fcsl() rtrur ;o1openmictytfsDemn pnu4aeermr iytfaDr nvils  eurir3iodlltelfetas) Dtmurpnt1oexomoeiys s2rlnms (4 ltrmr totfpD ai ols  rxrxrpio4lpe lfvs () 2uru poo1alxnio3tldlsDra(mo u) etnxf3tytlmDr n i (0srxrio no1ap   fci ()s2umum oo1tlt mo3iydfsDeauvsnu)altrifcoytoa e n ilt0 etmxm3iudaleemiesls  Dtr(moou1aex ioctyt m2emnvo;t)aeerxr io1om  li sls sexmir oo4lpee nes ( aDurur no0alt mo3iltfmDraump;t0arxrxf3iadfptr uvo ()t2xmio iodlp  lfviat)sDtm(  nu0aeeoioctytfs umn p t4trtrxf3oodfm e neslt0trxoxrpoo1apt lnvsas  Duaxro;o1oleomicildla rl( pnu4 rtoxo iy1fmtran ol( tetrimpno1lpenlfcsl(fs2ur(mo;u1ole mictytfs2rl(mpnt)texrmrcty1op rln olt0trxr(rpno4am emncil()aDraxr nt0olto iciad s emu s;(4aexoxo3iodlm elneo t) eurxo3iu4am  lietlt  Drruroot0apx mfetasfs2ua(vp u0tleoio oytlate nes s0srxmio3ou4lltnmiet t)s2ra(mp;u4tlx ifeiyt a2rauvo;u4areoir3totopt  ieols0srxmxm3no4opee fcslsfsrur( poo1oltnmfeiyt mDrl(vsn(0tlenio oydlp r ivs t)trtrio iudlme lnct s srtrxroot0tlxniieiys s2rm(mpnu0 eermo3oo1lptrlu s;t)seumxrpoodlmt mivils)srra( p;o1altnmi3iatfmDeauvpnu4 lxnmo3oo1oa  auvsls teto(o3ny1lpeelivil(faDtmx p;u1ope  ieiltfsDul( p;t)aexnif3totlp e ueil(  exr(o3iu4lm emfet (fs2trxmp;o0opxnifeiysfmDul(mo u) leoioctytlmD  i o t setrxo3nodal e nviasfsrurx  nt1alxnmf3ild mDea(mo t0 rxnxo ty1lmDeai i;s) etmxm3ny1oltnmfciltf ruaumo;u4tex ii3iydls2rlump;()trerxf ty1lmt lueil() 2toxm3nudlltnlivil( aDumu  ;t1aetomoeiydls2emump;t4arxrmfctadfatelivil(0seuo(r iy4opeelnvtat artau pnt1tpxomoetltls2ea( pnt4 etnmf oo1omtr ues;t) etm(opoy1apenliesa()s2trxrpno4tltnifetad aDeanvsnt4alxnir iatlptrau sls0 rtmxrpiodlm nmnct tfs2tr(  ot0teeoifeilsfm2elnvsn(4aexrxociy1fa ran s t0s2xoimpoudolee fciasfarrrur ;t4tlxn ictatla2rlnvp;() exrxr oa1lat anei ( srto(m ny4opt lictatf 2um( o;t0oltnmfctasfaDranmsn(4 lxrmr oydoaD au s;s t2xm(o oy4lm n fvia( srrruro;t1teeo feiys aDrm( s t4trenmf todop rlivo;s  2tmio3iy4ol  lfcsls)s2ua(r ot0apenmietasls uluvont) etoxr3oydlp elnei t0s2toxmpoy4oltemivi () rraxr ;t4tpxn o3ildls2um( o;(0 lenir oa1fmD aivi t) rto(opoo1op emfci t a2rrx onu1tpxnifctas aDua( o;u0 lenmfcio1oa eaivi s0texoim3iy4op  lfvil(farum(m ;u1tptnmoeild a2um(mpnu0 eenxo iadlm rln o;( s2trxo3io1ap elnetl(faDuauronu1aexoioeilsfsDuaums;t0aetnir3to1laDrauei;t0 2toim ny1apt mnci t srtr(m no4oex mf3ildlsDumn s;u)areoxo3iadlmDeaieo s0 eto(rpoydom nlnciltf 2raxrpou4apxoio3iasfaDul( sn(4 lenxf ia1fm eli s;t0t2tmxm iy4llt  ivilt a2tr( poo1oltnmoeiasfa2eaums ()teerir3ty1op rlu o ()s2uo(mpno4altnlnct tf 2rmxmoot0opeomfctatfm emn o (0trtoio oodla eli o;s srxoxr oodlpt  fvil() ruau o;t0optomi3iatlsDranms u0tlxoxfcoadoat anes s0t2uoxr nydll nlici s)sDrrumpno1tleomoeiysla rau p t0 lxnir3to1lm rlu sl()seuo(r3io4oltnmfeil() 2uaxmpoo4aptoifcilslaDrm(mo;u4 rtrioctatfa elnvilt t2urxo oo4lm e fct ( aDum(ro;o1tpxn feildlaDra(vp t0tltrxrcty1fp   i sls0s2xm(opoo4lpe mfci s)srumxm ;t4aeeomo3iysfaDemnvo u4teerio3iodopDe nvsls0t2toxopoo4ll emfvtls aDrm( ooo1ole  icildlm2rlu s u)tetrif3tadoatrlues ( texoxopiodamtelictls)sDtrx  oo1tle mociat m2em( p u)trerir3oodom rlueils0 2toim3no4lm e nctls)arur( o;o1tee ioctadlm em( o t) leomo tadfaD livs;s0texoxm nudaltn icta(fa2ra( oot4texo i3tat mDulnvont4 ltoxo iytlm eln ils setmio3iy1am  lfvi t)s2raxr oo0oex io3ilt sDem(vs;u0 renmrcoa1laDr nvo;t0s2um(mpnu4ap e ieils sDumxmo;t4aleo f3iadlaDuln snt) rtrxo3iytlaD ai ol( teur(m3ny4om   ncs t  Dumurpou4oltnifcilsfa2umuvo u4arxoioctadfa   nvslt0 eur(opnudlpt lfvil( s2tr( pno0ape  o3tldfa2rlu o;t)trxoxo3totopDe ueo;s)trxr(o3io4olenmnetas)a2umu o;o4ope if3iadls2uaumpnu0trtnifctatlpDelieilt seumir3oydop   fvt s a2urur ;u0oetnifctyt s2ulu p;t4 rtoxf3ootfpDraivs ()trxrim3iudllenmnesasf rumu pou1aee mo3tadfa2uluvo;(0aetnxr3oodlpt  ues;(0 etrxopnu1lpee nctat)aDurx ono0tpt iicilsls el(mo u0aetomoctatfmDelnvs s)t2xo(o oodap e nesl()srrmu pno1oeeoifetatlm emn s t)arxoiocty1omteauvs s  euoxrpiydome  ics ()sDraumono1opx miciat m ea(vp;t4treoxf oo1faDelnvo;t texrxrpny1olt mfesl()arrax  nt0oltomf3iadfmDuau p;()aetrmo3ia1oaDr uei;(0teumxopoo4lmeemictlsfartmurpnt1tlxo o3iasls ua( s;t0 ltnxr3io1op   u sls0 2xr(m ou4omt lfcsl()sDumu pnu1apx ioctld m2eanvp;(0 lxnmociodfp e ues;(0tetrxo3oudlpt lnvsat)s2trx pnu4aexoioeiys m2umnmo;u4trermfctydfmDe nvs t trum(o3nudlmenmfcsa(f 2tax pno4tle mf3tysfsDulu p;t)aetnxoctatlpt anes () euoxo iu4lmeelnctl( a2ur( p;t4opxn ieiad a2em(ms;t) rtrir3ia1oat lueol() exo(mpnydopeemnvia( srurxrpot0opx  ociat aDuluvsn(4alxoxo tydomt  ivi s)trurxr3iydllt liesl( a2urxmpoo0tptomi3tatfa2eluvp;t) ltrxr totopte ieolt setrim oo4op emiei t sDur(mooo4opt  octyt m ra(vp () exnmr3iadoatraies;t  rtmxr nu4oltnlfvsat) Durx p;o4apxnifeiydlm2ea( snu4altnmrcto1lpDeluei t0seurio io4al nliciat a2tm( oot4altnmoctad s rlu s u0texomo3oadlpD auei t) rxrxmpiy1ameelfeias)srrm(mpnt4tltoifcildla rl( p;u4 rxomf3iytla  lu o s truoxo3iydlm  mnvs s) rtaxmoou0texn ociadlsDrlnms;t4arerxrciotlmt  u o;t) etrxopio4llen ietl(f Dua(r nt1tlxomoctatfs ranvo;u)tetrio3iy1lat an s;(0sruo(o ny1am elietlt a2ta(rp;t4apto oeiytlm rlnmont)texnmf3io1fatrli o s0 eurxo3no1om nlfvi sfaDtrur nu1tlxnmicildls umnvpn(4 ltnxo3tydom rlivi;t)s2tmxm3no4lme  fei t a2tmurpnu0oexn iciatlmDemump;t)trerxfciytfmtr ies;s0 2uo(mpnudalt mfcs s  2rmu o;t0alxoif3ildla2um( s;u4texomoctadlpt auvs;t)srumio io4omtnmfetlt  2trurooo1aeenmoeilsfs emnvpn(0teenif3oy1lmtraivslt)srtmim nu1lmt  ics s)sDuax  oo1tee mf3tat m ulu p t0tetrmo3todfp   uei s srtoxmpoudamtemncta(f Dtr(mpnu4teenmictydfaDrmnvo u0texoir iatopt li i;( s2tm(opiodop nlnvils s2rrxrooo1tpe moeiatlm2eanvonu0 eenmo3iodfat lnvil( trtrxr no1amt lnvs (fs2rau ooo1oexoiociytla emuvont0alxoir totlpDeln il() rur(m3iu4lptemnetls arta(  oo0aeto ocildlm2rlnmo;t) ltrio3oytopteaiei (  exm(r ny1aptn nesas aDtrxr ;t0alxnif3iatla2rmu sn(0tetrifciytlpteauvs (  rxmxrpno4lm   iesas)arrmxmpnt4tetoiiciaslmDuanvs u)alenmrciotfmD aivil(0s2xoim ou1aleelietlsfsrrrurp;t4aex  oetys mDumu onu)arxomo3iadopt  nvo () 2umxo nu1apt liviasfsDtaumpnt4alxnif3iydls emu p t0tlxnif iatfpDelneo ( teuo(opiy1apt micsat aDtaumpnt0oex mo3iyt a eluvon(0artoxr ty1om  anvo t0setm(m3ny4oltelneilt)aDrmu ooo0tet ioctasfa2ul( sn(4aeenxocoodfmt aneils srxm(r oo1apt micils)artaxrpnu0ape mfciytfaDum( pnt0tleoxr oadomDean o t)s2trio3ou4amee ncsat)sDrrxmpnt0aee  f3iyt s2rmnvo (4tetrmo3oadopDeau o;t  2ur(m3oo1olt mncs t s2rr(m ;o4tee  fciys a2umuvonu4 etnxf3tatlaD lu s t0setm(o3ou4lp nmfesltfs2umxmpnu1teenmoeiatlsDumumo;t0 ltnmr io1lmtrlneo s0sexoxo3iudol nlnct t)s2rm(  oo4teenmfctlt s umnms t0 lxnif iadom rlueslt srumir3iu1om nmfctlsfsDrmx pot1opeo f3iydfaDra( s t4 eeomr tadfa elueo;t0t2xoxo oy1ll nlivt t  rtaxmono0aee ii3iyd a eau ont4trxoxfcoadomDrauvi;s)t2uo(opiudop n ies ()arra(mpoo0optniieiltls rm( p;u0tleoifcta1fateanei (  2tr(r iu4lp nlfetat a2ur(r ;o1aexnio3ildlsDea( o;(0 eenir3oo1lmDraieol() rur(opnudoltnliciat)s2tr(m ;t1optoifciat aDelnmpnu)tlxnir oa1lat li s s)trur(opiy4amt mnvs t  rrax pnt4olenio3tad m2elnvp (0 etoxfciytom r ivo;s0 rtr(o oy1lp   fvsas arraxrpnt4tleo o3iytla umn o (4 etoir to1fmtrlneilt0 euo(m3io1apt mivs ( srumxmp;u4opxnmoeiytls2em(mo (0aeermf ia1fpD  i olt) rtmim3iydlpt lnvs t srrmu onu4oee io3tltfsDel( ont0aetoxr ta1fpDelues s srxoir ou1open fvils s2ur(mp;u4texnifctls aDrlnvo;t4tleoxf3totlaDelnvs ( texr(opiu1altn nvia(fs2um( pnt4tpx  feilsfm eau o;(4trtoxo oa1omte n i t  2triopoudlmeemnviat) 2urxmo;t0tpxo f3iyt s2elu s;(0trtrir tytoptraueol( t2um(r3iu4lm nmfct sfs2rru pou4aexn i3iysla2rlu sn() rxoxr3io1oat aiei (0s2xoxo nydap   fesas) 2tmxmpnu0oeeoiiciltls emums;u0 reoxocoydoaD  ueilt truriopny1op nmneils sDum(rp;t4apxomf3tadfm rmuvo;t)alxomf3ty1fp  livsl(0t2uoio no1ole mnvil(fa2tax p;u1ole  ieiadlsDuanmonu4teeomf3iytoaDrai s;s srxr(rpno1amtn nctltfaDrm( onu1optoioetltlm rauvo;(0areomr oytopDelneolt0sexmxm3ny4ll e ivi tfarraur ot4apx if3iytlaDeluvsn() ltoifcia1oaDraieols) rxm(opny1olee fetls sDum( ono1apxoiieilsfaDua(vp t0trxrmr ta1lmDranvs t)t2xo(o ou4ale  nvt ( a2ra(r ;u4aeeo ieiydlm emumont)artrmr3io1la  ai ol( t2to(r oodapenlnesatfa2rmx oot1opx ii3tatfm rln s t0treriociytlaD ln olt  exoirpnu4lmte ici s) 2uaxmpno0tlt  fetytfsDrlnvo t0aeerif3oodfptr u ols)s2toxrpnodomt  fvi ()sDuaxr ou1alx mfeiys a2emn p;u) lenxr3tatlmt  ieilt0 rtmio iodlmt mfet t s2umur ;o4oexo ociydlaDelnvs u)alxrif tytfa rlieolt0tetr(mpiu1open nvta(  Drau o;u0tetnmieiys mDem( p;t)altoif ootomDrlu o;t t2xrxr3iudole lncils  2tm(m ;o0ope  f3iad s uluvpnu)artrxocootlat aueo (0 exrir no4lm  mfct s sDumu pou4teen oetadlaDrlu o;u)tleoio ia1fp elueo ()s2xmir ou4llee ictl( arraxr ;t1aexnmiciytfs2ea( on(0 etnxrctydlpt ai o s)s2xrimpio1omtnmnvtlt a2rmx  ot1aee iocils s2rl(vo t) leoxocty1fat li ol(0srtm(m io4olt lfciatf rumum ou1apxnmf3tyslm2rlnms u4 etoir totoa e i i t) rxrxopio4op emivi t  Drmx  oo0tle ifcild sDumnms;t)areomf3oytomD livi;s0s2tr(r3iu4aleelici s)srurxrp;t1oetoif3tysfs2eln on(4alxnxf3ta1fmteau o;t0s2umxr3nydll  licsls s2urxr ;t4ope mociydls uan o (0 etrxo oadfp r ivslt0 2xoxo oy4opt mfvta(fs2umur no0alxn o3iyslsDrmnmp;t0artoir3todfa raneo t trtmxmpiy4lp nmict sfsDtr(mpoo0aexo ociys a2rlums t4trenmocoatop   nvi (0t2trim oy4am  lfctl()sDtau ooo0olx  ociasfs2rm( sn(4 exrif oo1lptrai i;s0 rtm(r oy1llt  feil(faDrrxmpou4olt iiciydls rm(vs u0tleomrctadom   n i;s0t2urxopno1alt  fesas) 2trum nt1tpxnmoetasfaDrl(vs t0tlermfcoatlatean i t0sexm(m3iodopeemieiltf rumu  ot4apxnmfctydfaDrluvs;()teeomr3tydla r n sl(  2xo(o iudaltnmfeta()srumum no4opt  oeildfa uln ont4 rxomr ootlmtranesls0s2xrio3iu1am  mivtas a2rm(r no4olen feiysfa uaumo (4areomfctytlpt  nvs;(0t2xmim iu1aptelncs tfaDurxront0oexo ociasls uan snu0 rxnio3ootoa   i i () 2xmxr no4om elfcs ( sDtaum nu4oleoiociytfm ul(vo u0artrmocoadopDe u o;s s2xoimpnydopeelnes s) rrm(mpot0tpt ii3iltfaDelnmo u0 leomo3oodomDe u o;t  eurio3nudome  fesatfs2rrum oo0aet  ieiydls2uanmp;u)altoifcio1omDrlneilt)t2uo(mpiy1lm  lfcsls  ruru pot1aex  ociyt m2rmn s;u4 exoir oytlmtr uvils)sexm(opiu4ap e fcsl(fa2tmu o;u1tex  fcils s2emnmpn() eeoxf iotfmtrlnvo;s)t2xoxmpnydole  nvta()aDumxmpot1aeto f3iltfs eln s (0 rtomr iotfmD auvil()t2umxo3oy1lpt lics t) rtaxrp;t1tpe iicilsfmDrlnvs (4alxoxfctatlaD lnvs;t0srxm(m oydam  lncta() Drmx pot1oet  o3tydfs um(mp;u0artomfciydlate neo t)setmimpio4ope mfct ( sDrmu pnt0altomfctasls uan o u0texnmrcootoat aies;t0s2xoxo3oy4lpenlfcs s aDua(mo;u4aptoiictydfm2umn o;t4altnif ta1lm e uvi s)trtrxm oy4alt  fes s)s2taum ou1opxo fetadfm2rauvs;(4treoircoy1lmte i o;(0s2to(rpnodlme mfvta( artrxro;u1aleoiictatfsDua(mo (0artomo iodfatelu o;t0srur(o3nu1lleemfesltfa2rm(  no0olxoifcild s ulnmo (0texoxocio1fpt lueolt)s2xoxopoudop  mfcs t artau pno0apen feiasfm ra(vp;u0arenmo3oadlmtr nesl()srum(r3no4olee fcs s)sDumu onu0tpenmf3tyslm el( on(0aexnxfctatfat  u i s t2umxm3iodal elivs t aDrmxrp;o4altomf3tadlaDem( sn(0altomrctadlmt  n s ( setrxopou4am nlivilt s2uaurpou4tpxnmociatfa2emuvs u)tltoxo oydlpDrli i;t) rtoxm3no1llt  ict ()s2urxronu1alxnmfetytls2ua(vp;u4tetnmo oatfaDrlivol()trto(o ou1altnmfvi tfs2ta(root1oeenmiciasla rmuvo ()tleniocoo1lmt  nvs (0sexo(m iy4lmt licils arrm( pno1apeomfeiat sDul( p (4arxoxo3iotlmteln o ()trto(o3io1am n fvsa(fs2rr( oot1opeo ietatlm2uau o;(0altrir3ty1fa   nvsls0 2toiopiy1amenmivsa(  rrmxr ou1apxnmfeiatlm rmnvp u0tlxrir oodlmt aneo t0setrxo3no1omt  fet sfsrtau poo0aeenmfeiad mDumu snt)tlxnxf3iatlmt aueolt sruoio3oo4llenlnes s srtaurp;t0oltn feiadls raump u4 eermr todfm   n il()teurxmpiydllt mnciatfsDtmur ;o4alenmietls m emu p () ltrir todfmteluvils)trto(m iy4lp e fci (fa2rmxmp;t4tee ifeilslaDuanvs;()tltnio oydlmDe uvs;t0teto(rpoudoltelfvilsfa2rmurpnt1apen ieiltlm um(mp;u0 rxrmocoo1latr ues;s0tetoxrpoudoltnlneilsf Dum(ronu0oeto i3tysfmDrmumo u0aetnir iydlp e u sls) 2urio nu4lm nlici (fartaxmpoo4olx mfeiyd mDel(mp t4tltrif3oo1optelieo s0teuo(m3nodlm   icsl( aDrmxront1tpeomfciadfaDra( o u4artrmf oadlmD  ivols  eurimpoy1ameelivsa()s2rau p;o0oex mi3tld s ra(vpnu4 exoxo tatfp r u s s0 2xoio nydope mfvilt)s2um(rono0aetnmieildlmDraumo;u4artnxociotfaDr ivils sruo(o3iu1lpt  ieilt) 2urxmo;t0texnmictytla eauvp;(0 exnmfciydopDeanvo;s) rxr(mpoydap nmici sfa2umumpot4tex iietad aDel( on() lermf3iadlpt  nvs;t  2tm(r iy4am nlfesa( arta(r ;t1oeeo feias m rau s t0 eenxocto1oaD li o s)t2trxm3iydomee icsl(f 2umxrp;u4aeeoioeiyd sDulu snt4trxrmfciadlmt  n s t t2ur(r nudom n ncil(fsrua(rp;u1aex mfetad s2rm( o u0trxoxfciatlmteau ol(0t2umir no1llt  ict t) 2uau o;u1ale mfeiyd aDrm( o;(4tltrxf3oadom ean o s teur(o3no1lpen fet s)s2taxro;o1tpxnio3tltfaDrmuvo (0alxrio oodoa raivilt  2xmxr3io1altn nvslsf ruaxroou0tptnmf3tyt m rl( s ()texomr iatlpteaneo () exrxo oydlpenliciat  rtmxmpnt4tpeo feias mDuanvp t4 exrmo iotfmtrauei;t0 ruo(m3no4ale mivia( arrmu p;o0aetnif3ildfa rm(mp;(0 exnmocty1opD auvolt0 etrxmpnydll nlncs ( aDtrxr nt1tet ioeiad s rmuvs u) exomociytomDr nvols0setrxrpoudam n fcsatfs2rau p;u1opt  feiat a el(vs;(0tleoxr oydlptrlueo s0 rxr(opiydaltnmfei () rrrurpot4openmieiytfa2ua(mont0 eeriocoo1fa r uvo;s  ruoxm3iu4ape mfetls)arumurp;u1tptnmfetyt mDul( sn()artnxfcoydoptrlues s)t2toxr iu4omtnlfcs s arua( pou1oltnifciltfa2rlnms;() eeomr iatfm eaivs;s) rum(rpnudllte fvt t a2uax ooo1aeto fctadfs2rauvsnt4 lxnxf3iy1faDeaies;t  ruo(r iodope lfvsl()srtau  nt4aexnmoeilslaDuaump u)tetnxf3oatfm e n slt texoiopny4om  lfes ()sDrruront4ale moetys m uln o t)tlxnxo iotlm eaivi s)srtr(m io1openmfes (  Dtr(mpoo4apt mieiysfa emuvo t0 lerxo iytfaDeli s ()t2xmirpnudoltelncta(f rtmurpot4ole  f3tad mDra(monu0 rxoxf ta1fmDelneo;() eurxm oo1al  miesls srurx pot4ope mieildfa2emu pnt0texoxr3io1op eaivols) 2xm(r iy4omtn ictls  2rrxr ;t4apenmociyt a2rlu o;t) lxnmocootlpD  uvo t0s2tr(m ny4lpeemnvilsf rta(  nt0oet mictat mDra( p;(4 rermr3ootoate n il(0 2xr(r iudalt mict sf 2rm(root4aetnmi3iadfm rauvs t0trxnio ty1opDraivo;t)srurxrpno1oleelicsls) 2rr(mo;t4olenmo3tls a2umumsnt0trtrmr3oy1fateli s ( s2xmio3ny1al  lfet (farurx  ;u4tee  oetys m rlu pnu4aeeoifciotlptrau s;t  2umiopoo4al elfcilsf Dua(mpot4tlto fciltla um(mp u0alermr3oytfmte ivo s  exr(r iydlp emieia(fs2um(r ou0tpxomfeiys m umumonu)tetrxrctodfaDrau s s0trxrxm3iy1al  mfvsl(faDurump;t4optomf3tyd sDua(ms;t4aleoio iydlaDrlu olt t2toir3oy1altnlicsa( artau  ou1tptnii3ilsfa elums;u)arxrir3oatlm ranvo ( tetr(o oudlpe mncs sfsDtmuronu0tet mfctadfa ean pnu4 lxomr3tatfm eaies;s0s2urim iodlptnmici s arrrurpnt0teenmfeiytlsDemump;u0arenmf3iydfpDr ueilt srxr(mpiy4omenlfesls a2uax  oo1alxo f3iasfa umu p ()tlenmrciodlpDeai slt trxm(r3ny4ameelfeslsfarraum nu4olxo fciadfs um(mo;t)tetrxrcoadomtraneo s) ruriopio1ol e nesat)a2tmxroot1aeenmociatlsDrmumo;t4 exnxfcoo1latrlivo t)t2uo(m oy1ol elneilt)arurxm oo0oeenii3ildfaDeanvp;t4alerio3totla  lnei;( srurim ny1lmen fvsl(fs2trumpno4opx mf3iyd m2emumo;(4arxoif iodop ean o ()srxoio iy4lmenlnesltfs2umu o;u4oeen ieiat mDumu snt0texrio io1lpD  u ilt0 etr(rpou4ope mnvi ( srtru pno4aeeniicilt s umn p;u)artnio tytla r n ols) 2tr(o3oodamtnmietlt a2ta(rpnt1ope mfetad mDul(mpn(0tetnirciydoat  ivo;(0setrxo3io4lmenlfcsasfsDtaur nt0aexnioeiaslm rlumsn(4arxomf3tytop raneil()t2urirpoo1optn ics tf Drrurpnu4oexnifeiyd mDelu o;(4trtomfciydla e ivo;( trtrir oydll  mfvs ()srurxronu4apt  octasfsDrau p () lxomr tydlp  aivi t srurim nu1ape  nvs tf Dtm( pnu1olxnmietad a2ra(mo t4texnir3totoat  u sl() 2xmir3ou4olen netl(  rum(mpnu4apx iocilsfs rl( o;()areoio3totfptr u o s)s2tmxrpnu4ol  lfctatf Drr(m ;u4tptomo3ias a2emuvp;u)arxrxocoadfpDrau sls s2xrio nu4am nmnvtltfa2trx onu0aptnmi3tltfmDran s;u4teerifciodoa r u slt0teto(mpiu1olenmnvi ( sDtm( o;o4opxo o3iltfmDulumo t0teenxr3iytopD anes;t  eurir iodlptemnetlt)srtax o;u0apx mietlt m2ran o;(4alxrir tatfp ran i t  etrxo3iydlmeelfvilt)s2uaxm ;u1apenii3iltfm2ulnvont4 etoxociatfm   uvol( tetoxo3no4omte ivs tfaDra(mo;u1altomieild a elnvpnu0arxrmfciotfm  an o;t)truo(m3iy1ome livs (fsDrau ono1teen ictltfa rau s (4artrxo oodopt  i ols) rtmimpiydoptn nci sfs2ra(r oo4altn i3iat mDraumo u) lxrir iatlm  au o s srxo(r iy1optn fvsls arur(rono1alt iictytlm umnmp u0aleoxr3iydfa r i ils t2toirpoo4al   nvtlt) 2tmu p;o4oeenmoetlslm2rl(vo;u)tltrxf3iatlmDrln o;(  2trxr3iy4amenmfctas)s2uru pnu4optomietltfa umnvo;t4alxnmociytopt anvol(0t2tmiopno1ameemnet (fs2uau p;t4aptomoeiatla2emu ont0trxoxr3oo1laD lieo;s0seumirpny4aleemiei s) rrmxmoot4aet  fciysfs2rl(ms (0aleoxr ootlm e iei;(0sruoxmpoy4alenmietl(f 2ra(monu1alxnmietlslm2ul( p;t0arxnmfcoytfmDraies;(0t2trxrpiydlltn fesls)a2umump;t1oeeoiictysla2emu snt4aexoirctodfpD ln o t0trxr(mpiodomen fcta(fs2tr(mo;o4tltn fciltfs rauvsnu0teenmf3iy1oa rlies;s)t2xmio oodap elnciatfaDtruront4aetnii3ilsls2emnmsnt0arxrio oadfmDr nvs s s2trimpnu1ap  mivilt  2urumooo4aexn ociatlm ua( p t4tltnxfcio1lm eau s t0s2xr(r3oo1ole  fci tfaDtmx oou1oltn f3tytla2rmuvs t0tetoif iydlm elues s s2xoir ou4omte ncs ( srurur ou4tltn f3ias aDel(mont0 eermoctotfa  ai il( trtr(r iy4ole lfcs ( artaumont1tetn oeildfmDumu s t0 rtnxf3totoat luei;s)setr(o iy4lpen fet ()a2taxroou0oltn ociydfs2elump t0artnxr3oa1lm   ivs;t)s2umim3iu4llt lnvsas aDtmur nt0tpt moetasls uluvsnu4aleniociydlaDranvs () 2uoimpiy1ol nmivsasfsrur( p;t1tlxn fctatls2eanvp;()texnxociadfa raueilt0t2uo(opiydllenlfet t a2urxmono1altoif3tltls2ea( pnu0 rtoxf3io1fa e uesl(0tetoiopoy1lmee net sf rurxmont1oleoio3iasfa2ua(mpnt4teenio iytfp e n s t)s2uoir nu1lptnmfci (  Dur(mp;u4tpxo f3ilslm2rlumonu0 exoxo3iatomt ai o s) 2xo(opiy4ol nlnviasfarurxronu1alx  i3iat a2uanmon(0trxoio3iytfpD lneo s0sexo(m iodlm emicslt  Dta( pnu0oex ifeiys s2rm(mp (4 etnxo tydlmte n o;()s2to(m iy4al nlivs ( arrmumo;u0tetn oeilsls rmnmp;t) lenxocty1lm  liei ( trxoimpnu1ole mivsat) 2rm(rpnu1tpeomo3iatfsDel(vp;()alermr oo1lmDelu sls)s2uo(opoo4openlics t)arum(  ou0oltnmicias s2rmnmp;t)altrio3iatfm rauvs;s srxrxm oydlpeemnct t srtru  no4tlxo fetld mDelnmp t)arxnif oytlmDe nvs;t) rxm(m3iy4apee nvi t) 2ta(mo;o0tpx moeiatlsDum(vp u0 etrmr3oatoa e n ols sexoir3no1alt  iesa() 2ur(m ;o1aexn fciydfs2elu o;t4altnxfctotopDrlivolt)t2tr(rpno1optnlfeiltf Dra(mpou4aexoioeiatlaDemu snt)tltrir3oydlm rau i;( texoxo3oodale  fcs s  ruauro;u0opx mfeiat m2rm(vont)aeeomr3oadomtelivolt)trto(rpio4am n nvtat aDur( p;t0oetnmo3tldfsDelu sn(4 lxnio iadoaDr uesl( sruo(o3iu1ape mieiasf Drr( o;t0aetnif3iaslmDeln s u0texnxrcto1lmDrliesls sexmir iu1llt mies s)srtmumonu1aexn f3ildfa2eau pn()artoirctytfatean o (0 2xr(m oo4altelneil(f 2uaxroot1olt  ietat aDrmn p;(0trtnxf tadoaDr ivilt0srxr(r nodamte iesls)aDrau o;t4apeniictyt m2umnvsnt)arxriocootfmDr u ols)teuoim nydlmtnlfes s)srtaxr nt1aleomo3ias s uauvonu)artoifciodomD lu s s0sruoxr3oydlpe lncilsfsDtmuro;t1oeen f3iydfm2uanmp ()trxnmr3oydfat  n slt) 2xmirpoydlp e nei ( srumxrp;t0alxoif3tad m ranvs u4areoio3oo1omtr uvs;t0sruoxo3oy1llenlicsa()srtaxmp;o0tee ioctltfs2eanvp u0 leoxr ia1faDelnvi () 2toxm no1am n ictls aDuaxmp;t1aeenmf3ias sDeanvp;t0teermo ia1fpD livi (0s2toir3oy4ol emfciasf rur( p;u4open fctltlsDrauvo;u4trerirctatlaDe uvi s0 2xr(o nodomtnmieslsfsrtax  nu1aeto oeiaslm ua(mo u4areoxrcoatlpDe u sl( s2toio3nu4lptnmieils  2um(r oo4apxn ietltlm el(mo;t4 rtrmf3iadfatr ues;s tetrxo3nudapeemnes t srraxmo;u1tpenioeild a2rmnms t)trtomociydfmteai s ()srtm(r iu4olt mnctlt) Drr(m no4oeenmieiad a2rlu s;t4trerxr3totlm   iei (  2umxm3no1ap  mnes ( s2rmx  ;t4aleomo3ilt a ua(mpn()arxnmr3oatom r n i t0srxmxm3iu4olen fcsa()sDumxroou1aeenmfciaslmDel(vo;t)alxrmo to1fpD auvol(0 rtr(r3ou4amenlies t) Duaum ou0tptoii3iysfs eauvpnt4tetnmr totomDe n o (0t2uoimpoy4amenmicsas a2tax  nt1oetnmi3ilsfa ua( s;u4 ltnxr3iydfmDe ivi t)srtoimpio4opt lfcs s s2trxmo;o0ape ifciaslaDrm(mpnt0tltrmf3iy1lpDr neilt) eurimpoudll n fctatfarrmur ou0teenio3iltlaDumu p;t4altnxf3oatlmte nvilt0truoim3nodap e nct s arrm(rono4oltnmfcils s2el( ont4arenif iotfm   u s t0 eurim3nudalte ivsas  rurumoou1apenmf3tasls rmn snu4aexrxfcoo1lpDrlieslt texrirpnudamee ivs sf rrrxmo;u0opxomo3tytfm rmnvp;u0trxrxociatlmDe u slt s2urimpou1lme mncs t)sDurxr nu1tex if3iadlm em( p;t)trtnxo iy1opt lu o (  ruoxopou4ome mfvsl(  Drmumoot1optnioetldfm2ra(mpn()arxrmrctatlmteau s;t trxm(m ou1ol emietas  rtmx  nt1oexnifciadls rlu s;t) lenxoctodoptranes () rum(opiu1olte fvsl( aDrr( p;u4tpto ociyd mDrauvp;(4aeeoirciytla r n s;t0 2trxm oudam n fvi s artm(mpnu4olt mo3iatfm eln p ()aexoxf3iatomD  ieo (0 exrim iydopenmnvtat  rrrxrp;o0tpen ieiysfsDemu s ()alxoioctatoateanes s  rumxmpoo1ap  mnvsas) rtm(  ;u0apx mi3iadfa emu o (0 etoir iy1fm raneol( trtr(mpou4lleelnvta() rua( p;u1oltn i3iys m2ua(vs u0 exoifctytfp eanvils s2umxm3ou1op  mfvslt) 2ur(m nt4olxo o3tadfs2umn p ()aexrir oatomte u i (0 2um(m nudop nmfvsl(f Drmu poo0aeeoii3tysfa2ra( o;t4 exoxocty1lmt lieslt0trxm(o3oy1ole lfvtl( sDururont0aexn f3iadlaDuanmpnu)tlenmo3tydoaDelneols0 etrxrpiy4lm   ivtlsfa2rmx o;u1opx if3tasfm ra(mpnt)trxoxociy1fpDrluvols) exrxmpnudom nlnes ( s2umxm ot4alenmiciaslsDrmu s;t4artrif3todop  au s s trtoxr3oudol emfcslt arur(mo;u0aeen fetadls2ranmont0 reoxfcoydlp eln s;() rum(rpnu4ap e fct t  2rrxr ;o4aee  i3iatfm ean o;u0 rxrmo oo1oat lnvo;()s2xo(mpnodom e nesas)srurx o;u0aeenmieildfaDrmnvs u0tlxnxo3oydlmD  i o ()setmio oudol nmieiatfs2ua(mpoo0aeeoiietltlmDrmuvp t4 lxoif3oatla  aivs;()sruoio no1llee fct s  Dra( oot0opxniictlsfsDul(vs (0aexomo3oatom  aneo ()sexm(o3oo4om nlivsl( arumumoou4aex  feildlmDel(mon(4texnxf3oo1op rlneo ()setmiopiu4am emiesl()arrmxmooo1alxn i3tys mDrm(vo;t)trxomf3iadfmtrluvo;()sruriopoodll   ivt tf 2umxmo;o1apxoif3iyd m2rmumpnt)alxrio3tydla eln s s)srtoim iydaltelnviasfsrurxmp;t1opeo iciat aDrmn sn(4tetrmr3oa1op r iesls sruoxo3iu1altelnet ()arrau ont1optniictlslsDrl(von(4 ltriocoadfmte u s;t)seum(m io1om nmfvsa()aDtmumonu4ale  o3tlsfm2elnvp t)tetniocty1lp  aueo s)srxmxmpoo1ol emfvt t) rrmuro;o4tpxnioetld sDua(vp;t) ltomr3oa1fmt an o t)texo(o3oy1ole livilt a2tmurp;u1tpxo feiytlmDrmnvon(4 eenir oydlpt ln i t)srxm(r nudap elnctlt) 2umum nu0apxnif3tls aDrl(vp;t0 eenmo ta1fp eaiei;() rxr(o nodlpen iesl(  rtmu p;t4tptnmo3tlt sDum(vs;(4 renxf tatomDrluvo t)t2xrxrpio1lm elict t) 2ra( ont0tpx ioetyd a2uau o t)artrxrcio1lmt lu ols s2xrim3oo1op elfvsas)a2raurp;t0olx moeiltfm2rluvo t4teermo3oa1laD  ieo;(0srtmxmpoodlptn ieias  Durumonu1tle ifeiasfa elnvpn() reriociadom elivo (  etoio3io1al e icsas s2rru onu0oetomfciydfs2rmnvs;t)tltoxf3ty1lpDelivol( s2urxo no1openmncsas)sDtr(rp;o0oexo icild mDrlnmo;t) eeoxf3oy1fa  anvs;s  rxmiopnodalenmnvsas aDrau  ;u4oleo f3iysfsDrm(mpn(4teenmr3iytlm r u i s0s2xmim oo1lp elnvslt artaxroot1oexoif3iltfmDra(ms;u4tltnio3ia1laDeluvil() 2xr(r oydlpt lict s)a2rauroou0openifcildlm eaump;t4 eermo3iy1op elnvs;( t2tmio ou4amee fvs sfsrtrxmp;o0aex mi3iatlm umnmp ()treoio3oo1lmDr uvi;t)s2xoirpiudll e fcilt  Dum(mp;t4oltn ieiatfs2eluvo t)tltnxo3ia1oa rai o;s0s2xm(o3iy1ap  lieslt  2umumooo4olxoif3tas s2emn p u4areomf totfmD  ueols)setrir no1ame licsatfaDur(  no1oee  ictyslm emuvo;(0 eenmf3to1fa r ivo s0s2trxrpno1omenlicsl() 2ururooo1optomi3tadlm eanms u4 etnxf3tydop e u ol(0 rtm(o iy1ap e fesl(f Dumxro;u0tlxn o3tysls2eauvp;(4trtomocoadoat luvs;t0 euoxr iodllen ivtatfs2umxm ot4aee  ieils m ea(mo u) lxrxo iydlm e i sl( s2tmxm no4oltnlfeilsfs2rr(rpoo4olxoioetadls ra(vonu4 renifcoatfateaieslt0 rtmxm3iy4optemneta()srua( ono1tle  i3tasls elumpn()altnxo iodla   ueo (0sexoxm3nu1olee fvil()s2rrxrpnt1oeen f3ild sDel(mp u0trtoxf ta1fat ai o (0t2trir ny4am nmivilt)sDtrx o;o1aleo ietatfs2rmumo (0altoifctytlpDe nvolt  2xoio3oo4lltemicsas)aDuaxmooo1tpxomiciytls rmn p;t)trtrio io1faD anei s0 2umxmpoo1lmt mfcsa( arurx pno1tpto o3ildls ran s t4 etrifcta1laDe nvs;t sexrxopio4lle lict ()srrrxm oo1aeeo ictls a2uau s ()aeeoir iytfpDr uvo (0srto(opiu4aptnmnes ( aDrmxrpnt1olxoioeils s ranmonu4aeenxo iy1lateluvo;s  eur(o nydlmen fvsat  Dtrump;o1tetnio3iatfa um( o u0alenmfcoatlpt  neil(0t2xo(o3nudlpe lneta(farrm(  ;t0oeenmfctad mDrl( ont)alenxo3oatoateli sls  rxmxm io4al  mivtltf rtru  ;t1alen feiatfm2ulnvs;u0 exnmfcto1oaDrliei t)trxo(m oy4lp   nvi s sDrrx  ou4alto fciadfa2rlu snt) ltomocoy1fa   neslt sexoiopoo1ape mnvsl( aDtaurono4tlxn f3iadlsDean o (0tetoir ty1lmD aueo (  rumir3oy1ome mnvtlt)arraum nt1alenmf3tltfa rl( pnu0 etoir totlmDe i s;s  2tm(r nu1omtelfesa()arrrx  ;o4tpt iieild s2ranmo;(0 rerifcty1lmDrlnes;(0srtrio iodlltnmfvsls  2um(mo;t0oet ioctys m2eanmp u) lerxo3iy1lp elnvo;s s2xo(rpiu4lle lfesl(fsDtm(m nu1apxn octaslm um(mp t0 exoxrcoytfaDeli s ()trtoim3iu1lltn nes tf 2um( poo1oleomfeias mDem(vo (4 rtnmo oy1fmDranvs t0sexo(o3nydap e ieil(f Dtrur oo0aexnmf3ildlsDum( on(4trxoif3oytfa raivi;t0 etm(rpio1am nmivtl( a2umxrpoo0alx  f3iatls2el(vs;t0texnmo3tydlaDrluei s)setr(r nodlmenlieta()srua(mo;o4texnif3tlsfa rmn o ()tlenxrcoydomDr uei;( trum(o ou1optn ivsasfsDurx p;o1opt  o3iatfa2ulnms;t0texrir3iydlaDelnvo;(0setmxmpnudape lfcils) rua(  ot4ale iictltfs rl(mp;t)alxoio3ootop rluvi t0teuoim nydalee fvsatfsDua(r nt1openioeias s2ra(mpn(0alermr io1lp rlu i t srxrio nydomtelfvs (f 2ta(ro;o0oexo f3iyd m2uanvo;u)teermr ootlp  aneolt0 rxo(m oo4omeemnesltfaDur( p;o4alxnifeiat aDean p t4teeniocoy1faDr nvi s0 2umxr oy1lmt  neils  rtaump;o1teenmociyslmDuanmp (4 etnmr3oatlm rlnvs t s2xo(r nudlmtemivslsfsrtmur ;u0olxoio3taslm2ulumo t0tleoxr io1fmte nvo ()tetm(rpoy1olt mivt s sDraxr ou1oetomoctldfs eau p;u4aeeoir iatfaD lieols)srumir iudom nmnetlt) 2tm(rono4opx if3iadla2rmu p u0 eerxo ootfaDelueo s trtmxrpiydlm   ivs ( s2ur(mooo0aeen feiatfsDul(msn(4 lenmr3oadfp  luvi;s)texoim3iu1am emnct s sDtm(mpno1aeenmiciatlm2uluvs u0 ltoio oytlpDr u sl()trxoir ny1lltemfciatfa2ta(mooo4alt mfciys a2uau pn(4 etnxr3to1fpD lnei;( seurxm3iy1lmtelivias sDrru  ot1oltnmfeild a2rmn on(4 renif iydlatrluei;t0seumxmpno4om   ncsls)s2trxrpot1apt iiciys aDulu pnu)tlermr3todopt lues t) 2xmxrpoo1op  lieslsfaDtr( pou4aetnifeiydlmDean p t0 lxoxfcio1fpt  nesl( seumio3oodol  lfcil() Drrumooo1teenmi3ias s2um( p;u4tleoxo3iadoaDrluvo (0srurxmpoodolenmies (fsDrmxrp;o4tpto feiatls ua(vo u4aexoxoctydlmDeauvolt sexmxrpny4ol elicsa(farum( ont0oetnmicils a umumo;u4artnio3totlmtr ieilt) 2toim3oudop   nvs s)aDrrxr nt1tptomoctysla2rlumo;t)alxrmo oa1fp e iei t  etmxr oodol e ictltfarrmxro;o1oltomocild sDul(ms;u0tetrmo3to1laD lu o;( s2um(m no4amenlfcslt)s2uax pot1apx if3iyslm2emuvp u0 exnxr ootopt  n o t) rurirpio1al elfesls arra(  ;t0apt  f3iasfmDemnmonu)treomr3oy1la r n il()srtoxmpoy4op emieta( srtmx p;u4aee mfetltfaDemnmp u)arerio3oydlp r uvil(0setriopno1omt  iei t)sDururpnu1ope mieiadlsDrmuvpnt)teerif iadfmDeauei;(0sexo(mpno1amtnmnesltfaDtr(  oo1ale  o3tys aDulu snt0 eeomr iytla   ieo ()t2ur(r3nu4lmenlivt sfs2ta( pot1altnifciyt a uluvs u)tltomf3ootlpD anvolt0 rxm(m3ny1lmte fctl(f rtm(ront4tpx  feiydfs2emn o;u) rxrif iotfmDe ueo s)t2toim3iy1ole mnci ()a2rau o;o4tet moeiadfa2umu o;u) renxfcoadlptrli s t0t2xo(o oo1ape lnvi tfartmx oot1tetn o3tyd a2emuvo;t4artomocio1lat lnvs ( seuo(rpno1omeemicia( arrrumpnt0apxn ieiad a uanvo;t4tlxrmr ia1lpD  ueil()t2xr(rpio4ope mneia(fa2umum ;o1opto f3tytlm elnvs;(0aetnxf3iotomD anes s0trto(r3nodopeelfvias) ruaxmo;u4aetn fciadfs2emnvsnu4arxomo ootomDelnes;s s2umxrpoo1lpe lncils)aDtr(rpnu4altomfeild m2eanms (4arxomf oa1oate ivi;s) eurio3iy1al n nct sf 2uau o;o4aeenifcildfmDranvpn(4aetoif3ia1lmteln o;t) rumio3io4llee ivsls  2um( p;o4apen oetatls2rmnmpnu)aleoif3oatomDelivi ( t2ur(opno4lm nmfvt sfa2uru ont1opt ii3iydfs2rlu snu0 rxrmo3tatomDeli i;s s2uo(r3ny4am e ivtl() 2um(  oo0tltnifetasfm2uln s;t) ltnir totlmt livol(0s2toimpiy4lpenlicil(  rtrumooo4aptnmo3iyslm rauvp;t)artnxf iytlmDe nei (0trxo(r iudlmtnlfviasfsDraxr nu1aetoii3iyd s ua(ms;t)areoirctatopDraiei ( trxrir3iydol   icil(faDtmuronu1alxnioetat a2rl(vo;() lxrxf totomteauvi;s s2xrxrpiu4amenlfeiat)a2ra(r nt0texn fctltfa rmnmo;(4altrif3iy1faD luvo;s0 2xo(m3nu4alt  ivil()a2ta(m no0oleomoctlt mDran o (4arerxfcoy1op rlueols0 rxo(mpiy1op e neiltfa2taumpnt1tpxo feias mDrmn snu0arxomf3tatoaDrluvol(0t2tmiopnodaltemfvia()aDumu oot1tptn oetys m2em( o;u4 eermo oytomteluvs;t trumiopnydll n fes s  rta(ro;u4altn ociasfaDem( o;u0texrmfcoy1oat luvi (  2umxr3iudomee fctatfsDrr(r nt4oex  o3iaslm2rmnvs () ltnxr tatfp eanvi;t0srumxmpou4ameemfcs sfarum( pno1oleomo3tytfs2eanvs;t0tlxomfcta1oa   nvo;( tetm(m3nodal  mnvtls aDtm(mooo1apt  ictldls eln s;(4 reoio3iotfpt lu i s) rtoir oudop  lnciltf rrau  oo0tlxomocilt s rln onu4trermr3oatoa r ueo;s0sruoxmpiydalt mncsatfsDururooo0optomoeils a2umnmo;(4 etnircoy1laDe u slt) euoiopiudopee fct ()arum(r nt0altniictas a2rlu p;t4texomrcoodfp  lnvs t teumiopio1ap emicsas srrmxmp;u1aexomoetydfs ua(vp u)arermo3tydoateluvilt srxrimpnu4lp  mfcsa(f rtau  ou4texomi3ilt m emnvo;u4 exniocio1omDe ivolt0sexrxmpoy4apt  nvi s s2tm( p;o1apxo f3tysla elnvon(4aexomociotfmDranvi;t0trumir3ou1olenlict (  rum(m ;o4opx  feiytfs2rlumpnt4 ltrircoodomDranvs;t  exrxm3nydopenmfeiatf 2trx p;o4apt iocildfaDelnvont4artoxf ootlateau i t0t2xo(m nudom n ncsat  Drrxrpnu1oetoiieiyslm2rmnvp t4aetoxo3oodomteluvi s)sexm(r3iudale  fciltfsDua( p;o1oexomoeiatfa2um(vs t4trxrmrctadop e uvsls)t2tmxrpiu1lleelfes () ruaumo;u0tet  o3iydfm2rlnvo u) ltnxr iy1fmteaieo t t2xoxm iu1oltemneiat  2ra(r ot1tleomociatfaDean onu0tleoxo iatfateaueo;t0seuo(rpnu4op  licils sDtaxmonu1aet  f3iatls umnmo t) eerif iodlaD aneolt)trur(mpiu4lmte ieias  2urumoot4tlx  ietlt mDemnvs;()aetrxocia1op r uvo;s0tetmxr3iy4lltn nvs ()srrr( o;u4opeo ocias m umu o;t0trxnifcoy1fp  au s t0 2um(o3oy4aptn ieia() Drr(rpot0oeenifctltlaDranmp;t4aleomo3iotop e nvo;s  rxrxmpiydlptemivsa(fsDuax  no4ale ioeiys aDua(msnu4aetnmr iotfa e i s s0trtmxr iodlmtnmnesl() Drmum no0oeenifctytlm2umnvs u)aeeoiociotomtrlneslt)srxrim io4ome mnvt s) 2ta(  no1oexnifeils a ra(vo;u)aexomoctotlpt livi;s0 rumio3nu1olen ictlsf rrm(rp;t4alenif3ils a2uanmp;u4trxnxocia1lpD lnvilt0 etmxo nudlm  mics t aDtmu o;o0apeomi3iltfs emnvo;u0 leriociotlaDe i i s)teurimpio4lptnlnvsa()a2tax ont1altoioeild aDran s;t0 rxnmo tytomteln ol(0t2to(m io1lpeemneta( s2raxrpno0tlx ifcilsfa ua(msnu0teerifcoodfaDeai o t t2to(r3iu1al elfciat)a2rm(mpno1oetomfeilt sDrlums u0 leoxr3oytlpDe uvilt) 2urimpio4amenmicil(fa2rr(rp;t1altnmi3iatlaDeln s;(0tltrirciotlaDrlnvs s seurim3nydlp e icsas  rtrxr nt0tpenii3iyt a ea(vpnt0altnmf3oatlmtr n ol(0 rumiopiu1lp n ivi (  Draxrpou0tpxomoeiatfa ran o u0aleoxo iodop  lnvs;s t2ur(r3io4lpt mncias)a2tmxroot1tlt mfetyd a rmnvsn(0 eeoxo3iadfaD anes s0s2xmir3iudal nlnei () 2taumpnt1tleniiciat a uauvs (4trtoir3oo1fa  lieols0seum(mpno1am   fvia() 2umurp;u4openmietyd s uanmsn(4 etnirctotlaDe n i;t setoxm3ny4lmtemictl(  2ua(m nu4teen fciytla2rlnmp t4 etoir ty1oate i i s texmxm no1lptelnvils srua(  ot0tltnmociatlm uan on(0 exnifctatom rai i;s)trtoxo3iu1oltelnei t a2trum nt1alenmfetat s rmnvp;()aeeoir3io1latrluvil(  rumiopiu1oltnmfvtltfsDrax  oo4oltn f3iyslm rau p;() rermocio1opDr nvs (0teuoimpnudolenmnvsa( a2rmx onu4oet  f3tys a em(vsnu0 rtoxr oatoa eaivo t0 rurxmpiy4ameelfci t arraxrpou4tpeniietld mDumu o;u0arxnio ootop  au il(0tetoxmpiy1olee fctatfs2ur(mo;u4texnmociydfsDuau on()aleoxr3oa1fmteli o (0srur(r3iydom  mfvi sfa2tmu  no0alenmfctat a ulu o (0artnmr3iatoa  aues (0srtrxopou1am emnct (  rurxrpno4optoiieiltfaDeau s;t4 eeoxr oydfp elu o s) 2uoio3no1omenmietl( sDrr(ro;t4texnioeiys a ua( o t)altrifcoydfp  ln s;s0srxo(m nydlp elfeia() 2trx p;o4aeeoio3tatlsDelnvp;u0 reoxf iatoatr neilt0sruoir3iy4opee icsl(f Dtmurono0aet mi3iytfs el(monu4artnmo3iytfpt lu i t0trurxmpnu4lptnmfvs t aDurxrpnt1aexoiieiysfs2eluvs;u) rxnmr3iotfp e u ils)t2to(o nodoltn nes s) Drrxrp;t0tpen oeiasfm umn snt0 ltnmf3iy1lptraieo (0setrio3no4lptnmivi (fa2urxrp;t0alx  fciadlm2ulu o;u4tlxnxo3oodlpDr ivo s) rurxo3oydolen nvtl(fartmu pno4tltoiieiysfa2rl(monu)alenmo3todfmDrluei;s)srxo(r no1lm n nvtat  Draum ;u1ole  fciysfs2emn ont4alxnxocoytlm eanvi;( teum(o no1alenlieil()sDrrumpoo1ape  feiytfaDem(vs;t)trxnmf ta1lp r iei s teumxm oodapt liesas) rtax pno4tpeoiiciys mDrm( on(4 exrxo oytlmDr uvo s) 2to(m3ou1altelfetas srtmxrpnt1aex  o3ildfmDel(vs ()teerxf3todfateaiei t) rtoim3nydapenmnctat)aDtr( p;o4tlt  oetldla emumo;()arxrxo3tatlm eluvi s  rtoxr oy4om e fvt sfsDrr(m nt0oex mfetat aDrmnms;u0treomf3oy1lmt au i;t seuoxopiy1ap  mnetas srrru  no1alto o3iyt mDel(msnu0 renxo iatopD aiei;t teuo(m oy4lme lfvtatfs2rau o;o0aet mfctadls2elnms (4 leomr3oytopte ieo;t  2xrimpoo4ameemicsltfs2rrumono0tpx  feiyd s eauvsnu0trenio3oodfmD luvi;s)trxoimpou4om nmfctat)aruaxm no1oexoiociydfaDrluvs;t4 eeoxf3tytoa r uvo s0t2uoim iodll nmfviat a2uru o;o1altoii3iadfm eau s u)arenxr3todlmDelies s)s2xrim3iodlle mfci (f rua(rpnu4apt  ieiltlsDran on() exomr iotop elueo;s0texo(mpou1om nlivt (  Durxr ;t0aptomf3tad aDrluvonu4trxnmf3oodfp   i sls0t2tr(o3iydlpenlnetl( sDuaxrp;o0tpt mo3iatlm umnmp (0aeenifciadlptelies t0srurim no4oleelieslsfs2raurp;t1aeto ociatlmDrmuvsnu)artoxfcoytfmD auvo t)trur(o oy1om   fctlt)s2rmurono1apeo ociys mDelu snu4teermf iodoa  anvs;( t2to(rpoy1lle lneiat) 2rm(r ;t1tex mfctad sDrm(vpnu)trermo iatoa elieil(  exmxopiu1llen ncsat  2um(mp;o4tlxn fcilsls emnvp;(0 exoxrcoa1la e n olt)s2xmio no4ole micta() Dur(mp;t4aleoiieiasla ranvs;t4alxoxf iotoatean i;() exmir nu1omtelicta(farumxr ;u4ope  f3ilslm2um( sn(4tlxoircoytfmDr uvi ()t2xrio nudlmee ivtlt)srrmxmp;u0aee iiciasls uaumo;(0tetnirciatoptr iei;(0seumiopiodlptnmnci t arrmxr ot4apen i3tltfsDranmo t0 renmrcoo1la rlieo s)srur(mpou1lpeemics t)s2urumooo1alen ictatlm2umu p (4arxomf totfptrai o s0teum(m no4oltelncil(f 2ta(m ot1oltnio3iadfaDrln s;(0texoif3oa1omDraueils0 2xm(m3oodlm emfes s)srtau ooo4openifeilsla rlnmpnu)aeenxo totfmt  ivs;(0tetr(o nodllt  ivt t) 2ra(rpot1tlxoiiciadlsDul(vp u4 lxoif3ta1late nvsl(  ruoio oo1alteliei ( aDta( p;o4oee  oetysls ulnvont4 lxrioctatop rlivils)trxrxr3no1ol elnvs sfsDrmurpnt4olx  ieiydfs ra( pnt4aexnmo3io1fpteaivi;(0setrio nydlpteliesat)srraxm ;u0opxoif3iysfs2ea(ms ()aetrxo ty1omtrlieo t s2xm(opnodalt mnes s arum(rpnt4teenifciytlm2ulu p;u0 lxrmrcty1lpDran o;t)texm(mpiodllenlfet s)artrum ;t0tee miciltlaDel(ms u) exnif3tadlpte ueilt0texrim3oy4ap elfesatfsDum(m ot0aeeoiociydla2emn p (0aeerioctydop  anes;( trxrio3ny1lptn net s) 2tmum oo4aeeoiicilt mDulumo u0 exnmo to1oat  ivo t)srxmimpoydam nmiciat a2rm(m nu0olx ifetls a uln s t0 ltrxo3iotopD ln i;t0sexoxopoy4altelncs sf rrmx  ou0tpxoiietatfa2ranvs;u0 etomr3oodlptrlnvsl(  exoxrpiy1ol nmfciat  rtmx  nt4altn ieildls ulumo;u4 rxrirciy1fa eanesl(0srto(mpio1lme lieia( s2uaumoou4opt mi3iydlmDrm( s;u0alxomr iotlptelnesl(0s2toio io4op  lnvia( sDtrurpoo1tpenmiciat s rlu snt0trxomr iydfa e iesls0sexrxr3ou4apen fvia( srurur ot1aet  iciltlmDem(mp;t4 rtrxr3to1oat ai i;t  ruoxm nydope licsa()s2tmx  ot4tpx  iciltfs2rmuvp t)artniocoadoateliei (0sexrirpnudlmtn fvt sfs2uaxro;t4tpeoio3tldfs ulu o;t)alxrif iotoat  nvs (0trxoxr3iodlme lnvta(fa2tm(root1aex  o3tldls2uauvs;(4alenmociytoa rluei;s) exr(r iu4lm   fvs s a2uru  nu1olt  iciadlmDelnvsn(4arxoxocio1omD lueil() euo(m iydol  livi ()sDum(r ;t0tee  ieildfs emnmp;(0trtnif ta1lmDeaivs t texoxr3nu1amenmncsa( sDtru o;t0oee mo3iatlsDuauvs (4tlenif iatoaDranvs;s) rxm(m io1lm  mfvs tfs2uru poo0ale mo3ilslm2uluvp (0arermo oytfm eaiei t sexm(mpno1omenlics ()srtmx  nu1alto ietyslm em(mo (0 lenxo ta1fat auvs s)setoio3oo4ope  net tf ruru p;t1apeoiieiyt mDrl( o;t0 rxomrcoy1fa eaiei t s2to(r nu4oltelivta(fsDtmx  ;u0tlxomoeiatfm uanvon() lxnif iatfpt  nei t) euoxmpoudlp emfvtas)sDurx pnu1opxomo3tltlmDulu p t0texnxf iotomDr nes t)trumimpny4om e iviat  2ra(mo;u4oexo iciys mDeluvp;u4texnifcio1oa elivo;s t2trxr nu1altnmiesat) Durumo;u0opxn iciaslm2elnvpn(4 etnmo ta1fm e ivi;()trto(rpnu4optnlieslsfs2uaumoot0tlenmiciasfaDumu o t4tltnxo3tytlpte neols)srtr(m3iy1lp   ivtas)sruaxrpno4tet ifetydfs el(vo t0 lxoxf3iadfpDean sl(  exrimpny4oleelivt t)srrax pou1tlxo f3ils s rlnvs;t)tetnxf3iy1lpt lnesls  2um(mpoy1ameelictltfaruaxr oo0apeomi3ilsfs ul( o;() lerir ta1lptelivols trumxrpiudamtelneiasfa2umur nt1olxo fctyd mDelnvo t)alenxfciadom e i i;s  rum(m3oudap nmicsat  Durx o;o4alt iietlsls2rm(ms;()tetomo tadop elnvsls)s2xoxo iydomeelivslsfaDrrxrpno0tpxnifeiad a2rauvsnu)trerirciy1lpDr ieil( s2tm(rpoydapte fctasfs2ur(mpno4ope ifciat s2ua( s;t4texoxrcoodlptraneo (0tetmxmpno4amt lnetl(f Dua(r no4apenmf3iadfa2uaums (0 exniocoa1faD auvs s0tetr(o3nydame  fesatf rurx ont0aex moctldfm rlump t4 renmf iodfmDeaueslt0seuoxr iudaleelieils) 2tmump;o0aex  f3iydfm2rmnvs u)altoircoy1fp r neo;s)s2tmir3iu1altn fet sfsDtr(m ot0oexnmoeilt s2raums u0 lerxo oodoa eaues;s)t2to(opoo1ole mfciasfaDua(rono0teen fctlsfa2rlnms u)texrxo to1optean o;s0seumio3iydom nlfetls)sDrmu ont4oee  fetls mDeauvo t0 ltrifcoodlmteauvslt)s2tr(rpoudame  nvsa(  2rmx  ;u4olxoif3iytfa ea(mon()altrio oodlmt lnvs;(0sexoim iy1lm n ivsltfsrurxrp;t4aeeo fetad s2ra(vp;u)arxnxo oadomt  nes;(0 rtrir oy4lm nmfetatfs2rrump;o1tetnmociaslm2ua(vsnt)teerxf tatlatrauvs;s teuo(m3nudol emncta(f rra(  ;t4olen i3iat a eanvs;(4texrxr3ia1oa raueo;t)t2um(m iu1lm e fetlt)a2ur(mp;t1opxomo3iasls2em(mo;u0tleoxo3to1fp eai s;() etoxrpnydolte fvi s  ruaum oo1tptomoeiytfa2emnvs u4alenio oodom  auvo;t teumxmpnu4apt  fvta(  rua(mp;o0alxnmoeilsfa2rm(vsn()trxnxo oo1fmte i slt)s2uoxrpiy4lmt micilt s2raxm ;t0ole iieiyt s eau snu0aexomr3oodopD lnes;s)trumxo iu4omeelncsas  Drmurp;u4apt mf3iysfsDrlums t) lxrxf3oy1omteau s s truoimpio4lltelncsatfsDrrurpoo1alenmo3iasfs2rmu p t4aetrmoctytoatraiei;t t2xoxr3nodope lnvsl()aDum(r ou4tleo fctysfa rl( on(4teeoxr totlmDrau o t)teumxmpoudomte net s)arraumonu0tlenmf3tydlsDea( ont)tlxoxf3oydlpte i ol( trxrir iudll n ivs t)sDua(m no4oleomf3iys aDrlnmo;t) etoxociadlmte uvs;t) exmxm nydamtnmfctls) Duaum ;o1tlenifciltlmDuaums;t0 eeoif3oodlaD aues t0 rur(r3iy4al e neiltfs2rru ono4ole  fcias s emu pnt4artnif oatfm  au s;s)srumir3ny1omteliet t)arrmx  ;t1oexo fciltfaDul(msnu0 exrxo tatlpt  nes;t0sruoxo oy1alenmfcias aDtrxm ;u0apx miciltfaDemn p (4 etrmrcoodomt  ivs;s)trum(rpnu1llt  fvilsfs2taxroot4tee miciasls ranmo ()altoir iodfmDr ueo;s) eum(r iudomeemfvia() Duax  oo0tpt  fetytls2umu onu4tlermociy1opD  nvs ( seto(r nu1alen feiltf rurx oou1alxnmi3iatla2ean onu)trerxfctytom e i o;t0trum(r nu1amtemnesltfs2umumpnt1oeeo f3tad m2eaumo (4aeerif iodfmD  uvo s0t2trio3oudomtn fcsl() 2taxr oo1olxnif3iasfmDemnms (0 etrif oa1opDr nvil(0srxmim iu4ale miciltf 2raurpoo0tleniieiysfa em(vs t)tlxrmf3iytlmt au o s texoxo3ou4ll nlnetlsf rumumpou4apt  f3tydfa2ea(vs;t4artomo3iydfp  li s (  etr(m oo1alen ivia()srtm(m ;t4alen feiatfm ulnmo;u)tetrmocta1fm eluei s0srtoim3oo4am   ietl(fs2umx o;o4tlenmo3iltfs2emnmo () ltnmf oytoat lieslt) exmxmpno1amtemfvt ( sDtr(mpot4oleo i3iytfaDuan p t0aleoio totoptrlieol(0teto(m io4op elfcs t) Dtmuronu0oeto ictlt m2em(mo;u0altrxo iatomt aies;(0setrir3iodomt mivta(fsrraum ;u4alxoioeiysla ulnvo;u4 eeoircoadfmteli sls s2xoxm3io4ll  lfetat)aDtrxr oo1oleo fciadla2rmn s t0 etomo to1lmDelivo;() 2xm(mpio4lltnlnctlt)s2um(monu1tpen iciat s2rau p;t) exoio iydfa r n s s) rxo(m3nu1ale mictatfa2rm( onu4apx ifcils m2em( s (4tetrmo tydomte n s;() rurir io1ome livs (fa2uru onu4opxoiieiad a2rm(mpnt)aeerxo tatlp   i s;t  rxmir io4ape livsls) rum( o;u4alenmocilsfsDemumo;t)tlxomf3oatfmD luei t) 2tmim nudlmtelneia(faDrrurp;o0tee  f3tysfs rl(vp;t)tlxnifcoydomD aieilt) etrxm ny4omeelicsltf 2ta(mpoo0aeeomicias s eau ont)aexrio ootfmDrli s;s0srxm(o3iudlp n fvsls arrmump;o4ale  feilslaDrm( s;(0aleoxo3iy1fptr uvols0srum(r iy1lltelfvt ( srra( pno0olx mieils a ua(von()altrio3iydfpDr ueo s)s2tm(m3iu4ame lieia(  ruaumpot4oleomictlsfsDul( o;u0artomo tatfmD livil( trxrxm3iodomeelietl(fsDrr( o;u0alxnii3ils sDumnms (4 eeomrcoo1omte ueo (  rurxm3iodomenmncs tfaDtmumo;o0aleo i3iysfm2uluvp t)arxrxo iotfaDeaueo s0trxoio nu4ap e net t) 2rmx  oo4apxomictas m ea( s;t4 lxomr3oatfm  luvsls0s2to(o oodol emncil(f 2uaxr ;t4olt  f3iadfsDea(vpn()aexoxr3io1laDr u o t) 2tmxo ou4alee ivsltf ruax p;u1tltomociytfa rmuvo;(0texoxr3ta1omte n ils  2um(opoydol e ncsltf rtmuro;t4tptomo3iysfm2rau ont4 lermrciodoa  lueols0t2toir nu1al elicils)aDtauro;u1teto feiysfm2ran o u)tetnmf3iytfa   u o t)s2xoiopoy1ol nlnvtls)srrm(moou0tpe mfeilsfa2ul( p t4tlxnmocta1la  ai s t)srtoxm3oy4amenmivtls  Drax o;u0alt ioctlsfm2elu o u0aexnio oydlatean ilt  2urir oy4lp   ictat) rraumpno0texoioeiad sDel(vo t) lenxr3tydopD  uvils seurim3nodoptnmict ()aDrmxrpno0oet io3iydls raums (4trxrmo io1fp e u s (0t2xoxm3no1optelnvtl(farrrxmpnt4oexo ieiyt sDrmumont)aexomf iytfm e n i (0 rtoxm oo4omen iet t sDuaur ou4teen oeiydla2ea(ms u4 reomo3ta1laDe uvslt)srxoir oo4llenmics s srumum ;u1aptoiieild s2el( s u0aexoxr oydom ean s (0t2trxm ny1op nlivta()aDtmxrpoo0tleniicilsfs2rmnmo;t4aetnmrcoadfpD auvols0s2tr(m3iodamt  ivtl() 2rrurp;t4ale  feiytfmDrmuvo t0trtrmf ootfp rlueils0 exmim3iu4lm nmfvi (faDtr(rpot4teeomf3iydfa2ua(vp t)tlxnif tatlmDe nvo t0srumxm iu4al e ncs s sDuaur nu1opto ietasfmDel( o t0aexomocoytomt  uei;s0teuo(o nydlmt mnvslt)aDtmxrp;o1aex  feiyd m2umn p t4artomociytlaD anvils0t2tr(m nydlmen icil()artaxm no1aptoiociadfm2rmu o;u4altrmo3tadlptelnvils  2umim ou4lm   ict ( arrmxrpou4alt  f3tydlsDem(vsnt)tltnxo3ootlatelues t  2umxr iydam emfet ()sDrauro;o4aetn ictyd a2rmnvs (0alenxo ia1lp  ai ol()s2tmio oydlmt  nvil() 2uau o;t1tpxo ietys m2ra(mo u0 ltoxfciodlpte ivol() 2tmxopoodoptn nes sf rumxr ;t0optoiictysfm ra(ms;t4aetnif3oy1fm  anesl(  2xo(mpnu1altnlneta() Drrxrpnt0alt iictad a ea(vp u4tetoir3iy1fatrlies;t)s2tr(o iy1apt lnvs sfs2rrx p;o0tpeoiicildfa rau s u0aeeomr3iotlm rln i s)t2trim iodamtnlncia() Dtaxr oo1tlt io3tadfaDrmnvo;t)trtrxociotoatelu o;()srxo(m3oudomen ivi (f Drau  nu4aeenioeiydlm ra(vs;(0teenxfciy1lpte u o;(0tetr(o3io4alen ivt t)a2rrxmono1oeenmictytfa2ra(vp t4tlxnxo3tadlaDr ueo;s t2tr(rpoudap emicilt)sDurur ;o4optnmoeilsfm2ra( p () rtrmoctatomD au s;s0srxoim3iy1ll elncils)sDur(roou0aee ifctlsfsDrln o;(0tlenxr3ia1fm eanvi ( trtmxmpoo1aptnmnesat)s2tmump;t0alto fctytfmDrau o (4tleomfctatomtelivi ( trto(mpiudom  mfvsas  rurx  ;t4aeeomo3iatfa ea(mp u0 exnxrcta1fat  uvsl()truoxm ny1om  lnvils)aDua(rpot0tpt mfeiyslm el(mo ()tlermociadlmDrlivslt) 2urimpiy4om nmfvils artrxr no4opxomieild s2ua(vo;u0 renxocto1la   u sls  rxoio3nydomeemicsasfarurxm no1tpeo i3iyd m2ra(vs (4 etnxf3ta1omDr i ols0 etmir oodlleemivsatfsrrmumono1opx moetydla rau pn(4texrxr3ia1fp eln s;s) eurir iodomtemfvtatf 2uaumooo4apxoif3iys mDeanvp;() eerir3io1opDeaueil( trxrxmpnudal e nctlt  2rrx pnt0alxnmfeils s em( p ()alxnirctadla eauvs;t sexoxo iy1amtemicias) Dtmuronu1olto fciyt m uaumo (4arermo todlmteln o;t) rumxo3nu1optelnviat sDtrump;o0tle iictaslm ulumpn()tlxoxocoydoatrau o t0t2uo(o3iu1ame  fvs sfartr( pnt0teto i3iyd m2el(vs (0artnio iydopDe ieols srur(m3ou4ope  ivs sfsDtmxr ot4apeo o3iat sDrl(mo;u0aeenio3io1opteaiesls0srtmxr nydlptn fvtl(fsrrax  nu0aet  ociadla eln p t) eerio3iadla  livi;(0trumxo oydolte ietls) Drmxm oo0opeomoetytfmDrmuvo (0altrxo3iydfmDe ueols srtr(o oodlmenlivt t)aruaur ;u1aee io3ilt aDrmn snu0tetnmo todoa elu o t  rtoio io1llt lieiasfaruax onu1aptnmfcildls rmuvpnu) rxnir tydfatrlivol( t2urxr ny4ap   ieil()a2ta(monu1altn icilsfs2emu s (0tetnxf iotlpt luvi;s s2umim oo1apte net t srtmum oo4oee mfeiat a2ea( o u4 etoxrctytlmte ivs s) rumxopnydaleelicils  2rr(rp;u1alenmfctys a2eanmsn() rxoxf3ty1lmDeauvi;(  2xo(mpio1lmt lfctls s2tmxm ou1tlen ictad s ul(vpn(0artrircoa1la e ivol( srumim oydaltn ivilt  2trxmpou0oeto i3tyt sDelnvon(4 eenxfcoa1oa elivs t)setoxmpiy1amee nvi t  rtmx oou0oet mfetltlsDemn sn(0aexomf oa1optelu ilt t2toio3nu4omee ivia() rra(m ou4tpenmieiad a2ua(vp t)aetnxf3tytom raieo;()t2uoim3iudaptelictat)srua( o;t0alt  fciatlm2eaums;t0aetrxo3tadopDrluei t t2xoxr oo1omeelfct t) rtaumont1oeenmoeiltla2rm( p;t4 rermr3ia1fa eluvo;t srtr(rpnudomen ncsls srtmxmooo0olt iicildls2um(vo;u)treriocoadlmD luvols  etrir nydapen fvs ()srurx o;u0texo oetatlm2rln s;t4trxnif io1laD  nvi;s s2xmxmpnu1lp  livt t s2tmumpou1aeeomo3iaslsDulumpnu0texoxo tadfa   i sls  etr(rpiodapen ivs (f Drm(r no4olxnmf3tlsla2el( o;u4alxrio ty1fpDeaiesl(0setoxr3nydalen feiat) 2umur nu1optnif3tls aDumu p u)tltoio oo1lp  lu slt trxmiopnu4am nlici sf 2rr(root0tpxnmfctat aDrauvs (0 rxnxo oa1omtrluvs t0 2trxrpiudlpt mfcsas s2urx ooo0olxniiciad m el( pnu) lenif oa1omteau o t0sexoim3ou1ol  lfvtls  2raxmo;o4aex mf3iltls2umuvo;() lxoir3iotlpt luei;s0s2xm(mpoudape licsltf rurum ot1texoifetlslm2um( s;u)arxrmr iatlmteaivols  rxmio3nodlle  fcsat sDra(r nt0tet  fctyt m uan s u0aetomf oytfa rln i t0 euoxopoydolen fcs s  2rmxrpno1tleomictadls umn s t0 ltoioctodfm eliesl( s2xo(r3oy1op nlnvsltfsrrau  ;o0tetoifeilslsDrlnms;u0 exoifctatfp eluesl()trxmiopiy1amenlfctlt  2rrxrpou4olt mietyd s2ulu snu) lenircoodomtrlneo s0tetoio3iy4lptemnci (  rua(m ot1tpeoifeiyd aDrmnmpn(0texoxrctodlp   u s (0t2toirpnodape  fcsa() Dtr(ro;u1oltnmoeiltfsDrmump;u0aetoif3ootfmt ai s;( trtr(o ny1alenmnvilt  Dtr( o;o0opt  ieiytlmDrmump u4aetnmo3iotoaDrai sls srxr(m3iydoltnmnetltfaDtmxm ;t1teeoioctyd sDeln p;t) rtrir3oa1lmtr u i;s) 2tmio ny4ap  lncsl() rtaxmo;u1oleo o3ilsfm rm(mo ()tlenir3tatfatelu i ()t2uoiopnudale lieslt) 2rrx pnu1olt  o3iaslm2ra( o t4 etomo3iodoaDrlues;t  rxo(opno1lpee fvilt) 2taxr oo4opxnmieiyt s uanmpn(4artoir3ootoa  lnvo s  etriopnu1lp nlieia() Durumo;o4tee mo3ils sDel( pnt0aetrmrciytfm rluvs ()texmxmpoodll   ict (f Drmurp;t0olx mfciat aDrmumont0 eenmo3tadlm e ivo s0 rurxr oudlleelfvslsf Duauroou0alxo oeiadls2uanmsn(4trenioctotlm ran s t teuoim3iydomt  ivilt)s2tau  ou1oet mo3iadlmDumnvpnu4trenir ty1lm eaneo;() ruo(mpou1am   nct ( srrru oot0tpt  fetytlm2eau s;t4altrxrcoydoptelnes;t sexmim3iu1ll   fvsa()a2tauro;u1alenii3iatfs emumo;u0 exnxf3ia1lmDrlivol(0sexoio nu1al n fct ()aDurxrpnt0tetomoeiaslaDra(vo t) reoxrctodfaDean i;s)texmxr3ny1lmt  fctat)arrm(r nt0alt mf3tatls2ul( o (4 eeoxf3oytlmD lu ilt0 2tr(m3no4om  mnci tfaDtmurp;t1tleomo3tydfmDrmu pnu4artrxo tydlp elu s (0 euoir3nydlmeelieta(f rrrxro;o4aeen fetytfa2elump u)aleoxoctatfmD aivs;t0 ruoxo iodlp elivs (faDtm(m ot1tlxniocild a2el(mo;t0arxnir3iydlmt aieol() etrxm nu4alen fesl( s2rmu  nt1ale  fciad a rmn s t4tlenxf3to1lm eauvo s0 exriopoy4ale  fcs (  ruaur oo4olt io3iltfs rln s ()arxrir3oodlmD  n s t0 eur(o nodlpt mfet ()a2ta(rpoo1oet  ocilsfm2rm(msn() eerircia1omDe ivs t  2toxm ou4om n ieil()aDuru poo0tle mf3iat s2rauvon(4altoif3oytfmte uvi;(0srtoxmpoo1lpeemivi ( sDurx  ot4tleoioctydfaDrl(von(4 eeoio iad
\ No newline at end of file
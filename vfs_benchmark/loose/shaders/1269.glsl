@@ -0,0 +1 @@
+uei;t0tetmxmpnodlp e fes t sDum( oot0oltoii3iltfs ulnvp u) rxrif3oytom rai s t  2xrxr3nydapen ici t  2rm(r nt4apxnmociydla2elnmonu4 lxnmfciodlm   nvolt0teur(r iydlmen fvta() 2rm( ont0optnmf3tat mDumu on(0arxnio3to1lpt aivs;s) 2trir3iodame  neta(  Drmu pno0tlxnioeiydlm elnmo t4 exnxf tydopDean o;s0trurir iy1amtn net s) Durur ;t1tlto o3iydfmDuln snt)trtrmr3ootlm e uei t trxrim iu1olte fcs ()a2ta(r ot1tptomf3ilt m eanvsn(0altrio tatfptr nvs;(0 rxoxo nu1om nmieils)srtmu  nu4tpt mf3taslaDulu p u) ltoiocto1fmDeaneo;t trtoimpnodap nlfcs ()s2rm(mo;t0teeo fetydfa rlu s;u)tetomo totfaD aues;(0 2tm(opiy1lm e ncil(fsDuaxroot4oee  ieiad sDumu sn(4alermoctytfm  ai o t0s2urxm3oudopen ivs tfa2ur( p;t0tptoifctltfa2ulnvo t4tlxnmf3iadlpte uvslt0 rtm(r3nu1opee nctlt)sDuaxr ;o1olxn i3ils s2elu snu0 ltnmrciodfaDe i o s seurirpno4opt liesa( aDurum nu1aee io3ilt s uau s;t4tltrxr3oatlaD  nvs;t s2umxm3iudop emnesl()srtaxronu0ope  oeiatlaDuanvp;t)areoxf ootlpD  uvs s  rxm(mpoo1omee feiltfa2uaxroot4apt iietls m rlnvs u4alxnmfcoo1op  livslt  eurxm ou4alt  fvi tfa2tm(rp;t1apxoioeiysfm rlumonu) etrif3iy1omDeau ol(0seto(mpoo4oltn ivi s  2rm(mp;u4opxn ocilt sDumn s t0artnif3tydlaD  ivol(0trtmir3oy1om n iviltfsrum(ro;t4ope  i3iyd s rlu p;() lermf iodlpDran i ( t2xriopio4ap nlncils)srum(root0altoifetasla2emumpnu)trerif3ta1laDean olt0t2xmim ny4lm e icilt) 2rau  ;u0opeoii3iatls2ea(vs (4aetomfctatfm   i sls sexmimpnydomeelfcil(  rumu  nu1tpe  ietyd a ua( s;t4tlenmfctadlmDrlnvils)seumimpiodam  licta()aDtmxrpno0texomf3tas mDrmu onu4arerircoatfptraivs;(0 ruoiopiydale mies ( artm(  ;o1ale mfeils a2ea(vp;u4 rxnxr tytfptelivi (0seuriopnydlp nlfvsltfartrx ooo0tltn oetld sDrl(mo u0aeerif iy1opDr u sl(0 2ur(mpiy1alt  nci ()sDtaxmo;u4altnifeils sDumnvpnt) ltnxo3todlmteaivo (  2uoxmpnu4ale  fvsls sDta(r no1tpt  ieils m2rm( ont4alermociadlpt lnvi;(0 2uoxr nydam e fvs t aDtruronu0ope mieiaslaDrlnmsnu0trtrmociadfa eluvs;( trxm(opiy1lme  fesasfsrurxro;u1tlto feiaslsDem(vo;(4treniocoodopD lu i () rxr(m nu4am  mivsa( s2ta( ooo1tpt iiciyt aDumnvo;u4trerxf3iytfa r nvo s)trtr(o iydllt  fei t)artmuroou4ole moeiasla2uanmp;t0 rtnio3io1omtrln ols sexo(mpno4op n fcslt)s2taur ;u0alto o3tys a elnvs;t)teermf3iadfp r i s s tetr(mpnudame  ietl()s2tm(  nu1tlx ioetat mDrlnmsn(4arxrio3oatfmtelues s0 2xr(o3iu4optn ivsa() 2urumo;t4altn i3iltfs umu o t)tleoxr totop r i o;( trtoxo3no4lpt mfvta() 2um(r nt4opxn i3tlsfa ranmsnu0teenmr3oytomDr n ol( tetr(r3no1al elncs s)sDuax o;o1altnioeias a2ulu o;u) rerifcootoa elu sls  rxmxo oo4lm  mnesat) rrrumono1olx mo3iyd s2ea(vpn(4tlxoxr iodopte u o;t0teumimpiu1oltemfvtltfarumumono0oltn ietysfaDea(vo ()arxomrcta1lpDeluvi;( srurim oy1amt  netas)artrxrp;t0apto o3tyt sDrm( pnt)artrxocoa1opDranvo;t) exr(o iodllenmnctlsfa2rrxrpot0alxn ietlt mDulnvs t0artrio3oodfa rlueo s0t2xo(o iudlpe mfct t)s2taxmpot0aetnmo3iat a2rmuvpn(4treoircio1optr i o t) 2uoxrpnudaltn ncils  rumu pnt1alen fetyslmDra(monu4tlxnxocootoaD  uvils0texr(r io1al nlnvil( a2ua(mpno0oltnifctls m2ua(vs t0teermo3oy1fmteanvils0s2umimpoy1lpeemneil(fsDumxm ;u4aee  i3iltls2ulnmon()tlermo iy1fmDran sl()sexoxopiydap nlieils arrrurpno4tle  feiys aDel( o (0aetoxf3oy1omDe ieil( s2uoir oodlpe lfvtl() rrm(mpot1olxnmieiasfmDul( s (0aetomociydla rlu sl() rum(o iodaltnlfciat srra( ono0alxo oetasfaDulumo u) lxnmfciydlatr ivi;s texrim nu1alenlivs () Duau ono1tpe iiciys m2rluvo;(0arxnxo to1op rlneo (  2toir3io1lpenlivia( aDrr(rpou0oee moeild a ul(msnt4alerifcta1omt lies;(0 2trxo iu1ale lfei s)srtrxro;o0opx  feiltls rmnvo (0alxomf3tydomtrli ilt0 2uriopiu4ole lnviatfaDuru pnu0aleoiocildfm2um(ms;(4aeerxo3tatfpD  n o (0t2trim3iu1al nlnesa(fsruaxm nu4aexn oetltlmDeaumo ()teeoif iy1fptrln s t)tetrio3nudlmeelivsas) 2tmu  no4oetnifctltfa ra( p t)texrxrciatfmDeluvs;( s2xmirpiodoltelfci tf 2rrum nt1tee  f3tydlsDulumo () lermo tydopDeanvi;()sruo(m3iodame mfetls)aDtm(  no4apenmo3iadlmDrluvs u)aeermocty1faD  i o t)s2tr(o3no4opeemiei s s2tmum ot0olen ieiys sDemn p;()trxrio3oytfaDrlu o t0 rxm(mpou4om e nvta( srta(mpot4opxnmfciydfmDea( o (0altomfcoodlm  lneilt)sruoxo3nudlle mfct s)sDua( pnu1tpeomoeilsfsDelnvp;t4trenif3ty1lp elu i;()srtmirpiy1ol   fcta(faDtax  ;o0tle ioetydlsDranmp t)trtrir oodfpDrlivo;t0 rtr(r io1opee icta( arum( ono4tee  o3iyt a2uauvs u4tetoxf3oatlatelnvs;s setmxm ny1apte nct s a2ua( o;o1apx  icild m2umn o;()aetnxf iy1fp   i i s  rxrxm3ou1am   fetlt arum( p;u1aetnmoetls s2elumo u) eeoxocio1fp eaiei (0t2uoxr ny1lpe miei s)sDur(mp;t4apxnmoetys a raumo;t4tlxnxo tydla  li ol()setmxmpoodoltelneiatfs2ta(rpnu0tex  i3tyslm eanvs;t)alermociadlp eliei (0setrxopnodlp n nci t)arrax  no4tltnmfeilsfm ranmp;u4 rtoxo tatlmtrluvols)teurxr3oydomtnmfcilt  Dtm(r oo1tlx  o3ild sDeauvpnu0 rtnir3oytlm  li s;s  exrio oo4al   nesltfa2trur ;t4oeto ociatfm umuvpnt0 ltnxo3ia1fatr u sl()s2xrim iodaptn neiat)arurxm oo1opt ifeildfa ran s;u4tltnmf ia1oaD aivi;t)trurir nydalenmfeia( sDrmu pou0openifciyt m emu s t0tetnxocoy1fpt  neil() 2toir iydalenlnci t) 2trumpno0oet ioeiys m2uan p;t0aexoxocta1la   u o;s)t2uo(o3oo4lp e fviatf Duax ont1oeeomfctasla2uln s;t4aetoio3oa1fmD liei;t) exo(opiy4ol  mivs s sDurxm ;u1ale  feilsfa2rmnvs ()altoiocoadlaDe ieilt0seuoir oo1lm nlncsa(fsDrmxmont1tpto feiad mDrl(ms;t4alenmo iy1opDrli i ( sexm(r3oo1op elnvsltf Dtmxrpou1tee mieils s ulumo t0 leomf tadfmDeaues t  2xr(mpou1aptn iet t)aDraxm ;o4olxo octas a2emuvon()aexrio tatfmDe n i t  2uo(o oydlmt  icias)srtax pot0teenio3ildls rlumo;(4tltoif oadoaDeluvi;s0s2urxo3iydlm  lict s  rumuronu4olxoii3tytfs ra(msnt0 eeomociy1fatelieil(0 2tmxm iy1ome lfvt ()sDurxr ;o1ope iiciys a2ra(mp;u)altrmr iy1fmt anvo ()setm(r oodol nlncsas) rraxr no0aetomo3iydfa2ua(vo (4aeenxo3ta1fm  aueo;s  2urir oo1op   ictl(fa2taxr nt1oeeniicias aDemuvo t)altrxr oy1fp   i ils0trxr(r3ny1opte icsl(f rraumoou4oex  i3iyt mDeau p;(4arenioctydfm  anes;()seumxo iu4lp nmfviat s2trx pno1teeomiciytfs2emumont0altoif iotomDr uvs s) 2tmxo3iy1om emncta(f 2tmx  ou1alenif3taslmDrlu on(4 rtnmr iytoa eaieo;(  rtr(o3ou1lmtnlicsatfa2ra(m ot4alx  ocias a2ranvo;(0 rxrmocty1late n s s0 ruoim3iy4olt livsas  ruau p;t4tetoio3tyt sDua(vont4 renxr3oydfaDrlu o;s  2trxrpnodlp n ncsasf Dumum ;u0texnmietaslm eaumo;t)tltrxr3ootla r neo s0t2xmxr3oy4ol   fvtls  rurxrp;o0teenii3tatlmDuan ont4alxrxoctodopteln ol()srtrir nydome  fei t) rraumonu0olx  oeias sDelumsnt0texrio tatfmtr ivolt0 rxm(o oy1om nlfvsltf 2ur(r ;u4oexomo3tld aDemnvon(0 rxrxf ta1fm elneo;(0sexrim3ny4alte nes t)s2rru pnt0aeeomociysls2ea(vpnu0tltomo ia1fa  aues;s0s2toirpiy1ol n fvsas srua(ronu1apeoioeiad s2uluvonu4tlxrifcoydfp  lnvs;t0 rxo(m3oo4oleemnetasfs2ur(rpno4ole  feild aDeanvs () eeoxociadfmt ln i t0s2umimpoo1alen icils)s2rax pnt1optnmoeiadlm rlnmpnt4aetrxr3ty1fpDeau s;t t2umxr3ou1aleelnctl( aDtr(mp;o0tpx  f3tld m2rmnms;u0trtnmocoy1lmDeauvo;t)texr(r3iy4lme mfviltfs2uaurono4olt mfctasla2ua(vp;t)tetnmo oadoat aiei;(0texoxrpnydll   ietl()srraumpno0aetomoetad aDumump (0treomrciatlpD aneo;t truriopiy4lmee fvsl()sDtmu pno0aexnii3tas sDea( on(0altnxocta1fmDelnei () rxr(m oydamen nvt ()srua(r ;u4tetomfcildlaDrl(vs (4trtoir tadoa ean i () rxmxm3ou1lme lnvta()arurur no0teto ieildfm2em(mpnt)tleoio totfat an ils s2urxm3oy4omt  ieiat)aDtmu  ot1tpt io3iytls rl( o;(4 exrmf todoaDeauvs;() exoio3oo1ame  fvsls sruax  ou4tltn ieils a2rmn p t4aeerif3iydfmteli o;t0sexmxmpiodomen netas)s2rm( p;t0aeeomfctad a2ua( snt4altoxr3oy1oatr i i s0t2uoirpou1alen ics t)srtrumo;t4aptnifcilt a elnmon()tltrmo3oytlat auvi;s0s2uo(o iu1al   fvias) Durxmp;o4optoifeias s2rmuvo;t0altrmf todfaD au i t0 2xoxr iydalt mfesa()a2rmx p;t0alt mociyt s2um(vs u4trxrif tytlatean ils) exr(o3iydamtemfvils aDraxrp;t0tex  f3iasfmDemuvs t4 ltnxf iatfpDe ivo;t) rtm(r3oy4al nlfeilt arrru  ;t1alt  f3ias a2ulnmo;()tltnxr io1fp  an i;s)seurim3iudlptelnci (f Dum(rpou0aeenii3tlsla rau p;(4 ltrmf3tydlaDeln o;t t2urxm3oydomeelfct (  Dur(mp;o4opt mf3tltfs2ranvo;() lerxr3todlpDelies t  rtrxo3oo1aleemnvslt arurx  nu0alenmf3iatlm ran s u0 etnmf3todop raivs;s) etrir no4lp nmfct ( aDrmxr ot0oex mietadlm2rauvpnu0 rtoir3tatlm ranvi;(0 eurimpiy4al nmneslsf Durxm ;t0apto fcils a2ranvsnt)teeomfcoadlmtrlieslt  2xoxrpny1ol nmneslt aDtmxrooo4tleoiieiysla uanvo u) leomrciytopt anesl()trtoxopiodalte neia()sDraur ;u4tltnmf3iydfs2ean s t0aeenxo3oydla  li s s0s2uoimpio4lme  nesatfsrumur ot0tpe  iciydfm rln p t4aexnmf3iotlpDelnvils)s2xr(o3oy1al  mncslsf Duax  ;u1aex iietyd aDeanmonu)tlxrif3ty1lptrlu i;s tetr(r no1op  lfvias  2tm(rpoo0tltnmo3tatfaDrlnvs u)teeomfctodomDr ivo t0 2to(m nudllt miet s)aDumxro;t0ale mo3iydfsDel(mpn(0 eeoxrcoodlat auesl( s2trir3oy4lpee nei (fartrxro;u4open o3ildla2ra(mp ()altomfcoydoptranvo;t teuo(m iu4olt mivil()srrmx onu0apx  iciydfa2umumo;t4tleoirciytlmDr nvs t trxmir3ou4om  liei t) 2uaxro;o0opxniociys a2rm( p u)alxnifciy1lmDeai s s s2toim nydll  lncslsf rtau  nt0olxo i3iltlsDeln p;t0 ltrio3oodoa raneo (  2uoxm oy1lm nlivs s)aDtaxmpno4tlxomi3tad s2umump;t4alerxr3oadomteauei () etrxo3ny4optnlneil(farrrx o;o0tex ifciydlaDum(vo ()teenio3ia1om   nesl(  2urio ny4lm nmfci (f 2ra(m ot1aex ioeiat mDemump;u4tltrir iotomte n s s)srxoir3nudaltn fvta( arum(m nt4oetn oeiyt m el(msn(0trxrir3tatlp   uesls)setmirpnudolt lieil()s2tr(r ;o4ale mf3iytla umuvo;() eenir3iadlpteau ol(  rtmio3iodap nlnviatf 2ur(rpnu0tpx  oeiyt s rmn snt0 ltnmf iotfm  au s s) 2umxrpny1lpt mietl(  2rru oou0apenioetytfa elnvo;(0artnif3ia1op eln o t0srtr(o oudlmte icil(f Drau  nu0ale ioetyd sDeaumsn(4 eenmo oo1fa   ieol(0srtr(o3iodlltemfetltf 2umu o;o4oee  i3iltlm2emnmsnt0 etrxr3tadfpDrluvi t seuoio3iu4lpt  ivi sfsDtaxrp;u0aetomf3iyd aDranmo t0 ltoxocoodfaD anei;s srxoxr3no4omtn ivs s)a2rrx  oo1apeo ociltfm2ra(mp;u)trxnxf3ootfp  an ol( srxrio nu1alee net (  ruru p;o1tee mictltls2rmuvp;u4trxomr3oatfp raiei s t2uoimpou1ape  ncils) Durumpou0aeeomfeiydlmDemnmp;() rtrmo3tytfmteauvi;s0t2umio3iu1alen iei t a2raurp;o0tle mo3iltlmDulnvp;()tlxrirciydlmDraies ()tetoim3io4omtn fvsl(fs2ururooo0opxo o3iydlmDuaumo;t) rxnxo3oo1lptrlnvi;s s2to(r3ny1al n icilt arra(roou4apxnii3iadla rlnmo;u4tetnifcto1oaDrli i t s2tr(o no4ol   fcia(farta(mp;u0oetn o3ildlm2rm( pnu)arenxf3io1faDe ivi (0srxr(rpno1lp  mnvilsfaDum(r ou1oee mo3tatfm2elnmp t0tlxrmf oadoaD aueil() 2xrxo iydll e fvi s  rrr( pou4aleo iciydlm2raums t4arxrircoo1omDelu ols t2xo(opno4lpe  ictas aDrr(rp;o0opx  o3tasfsDem(vpn(0tltrio3oytoaDr n i;()texoiopnu4opeelivilt)srur(rono0olx if3iltla eluvp t)aeermf oytoateau o t tetrim3ou1lme lnvt (f rtr(roou4apen f3ilsfa umuvo;(4 exnmf tadfmDelneo s0trto(r3no1apee fei sfaDtm(  ;t4alxoii3iltfm rmnms;t4 rtnir3tatlaDrlnvilt) 2xm(o ou1llen ivtas) 2rr(rpot0opxn feiltfs2ul(mon()areomociy1lm eluvo;( s2xoir3no1am  mnctls artrxr nu0aeenifeils a2ra( pnt0 eeomf iadfatraivolt0srxoim no4al e fvs t)sDrrxmpnu0tetnmoctydfaDra(vo t) exrmf3oo1opt liei;s0sexo(r3ou1op  mncils aDta(r ou4oexn fetytfm eanmsnu0aetrio3iy1omtr i o;t0t2uoir io4amte ivt t)s2tmx pnu0tlt  i3ilslsDemu p;(4texriociydomtrai s;s0texoxm iy1oltemfei (  rrrum oo0oltnii3iatla ul(ms;u)trermo ta1op  au s s seum(r oy1am n nei t srra(mp;t4texomieiys m2rmuvon(0tlxnxo oy1fmtrlneilt0 exr(rpio1lp   fvtls)srtrxmoot1alt io3ilt a ulnvo;t0tlermf ty1fa rli o () rxoimpou4olenlnciasfarrmx o;t0tpt mfciasfm2eau pnu4tltrxocootla r i s t0trtmir iy4optn iei t  2rr(  no1oetoifcias a rluvs t)tetoxo oo1fpDe ues;( trurxo ny1lme  nes t  rtm(m ot0alxnmi3tad a2eanvs;t0tlxoxrctodomtranvo;( truoxm iudapenmfvt (f rrr( p;o0aleomfctls a2emuvpnt)aexnmo3io1lmDr nes s)s2xmxmpno1amtnmfvsl() 2uau  nu0apx  fciasfa2el(vo;t0alxrir todfpD lnvs ( t2tmim ny4open fcsa(fsrta(rpnt4apeoiiciyt m uanvp;u4 etnio3to1laD  uei t)t2toxrpoy4ap  lfvs tfsDtru ont0optn ieiltlm eanms;(4aeenxr tydoa eli ils0 2to(r3oo1apeemfvsl(  rtm(  nu1opx  o3iytfs eluvo;t4 eenxfctatopDe u s;t0s2xoir3oo4am   nes tfs2tmxrpnt1aex  octltfaDelumo u0 leomocta1fm eai ol(0srxoxopiy4ap emietasfsrtaxr ou4aetomiciasfm2emuvpn() rtoxr3ta1lm r i i (  2tr(m3ny1al nlivia(fa2rm(m nt1texomfcild aDulnmo;(4 rtnif io1fmDrai i (0 2tmxo3nu4lme  nvias a2rm(rpot4tee ifeias sDua(ms t)alxoircio1omtrlues;(  2urxr3ou1lltn netl()s2rrumooo0apenio3iasla2emu o u4trtomfcoodfat  nvo;s0 rurxo oydll n fci ()a2taumpno0aptoio3tldla ran snt0tltoxr3oytfaDe ueslt)s2xrim3nu4lmtn nesas)srrruroot4tet  o3iltfa2rmu snu) lxrmocia1lp rlnvslt) rtr(opoo4amenmnvsl()artmx  ;u0aexoifetytla rl( o () etnmr3tydlmD aies ()srumio oudllen nct sfsDtmxrooo0oexnmietltls2uaumsn(4trtnio3oadfm r u o s s2ur(r ny4lmen fei s)s2rm(mont1alen i3iatla2uanvpnt)arenmr3iy1lpteaivi;s0 rumir nu1altemfctat sDuaxrono0opx  ieias a2rmuvs;t0artnircoodfpDrlivol( s2to(o oo1amtelici s arrrxrp;u1tpeo oeiat aDrlnmonu) rxrxf3to1lmtrai ols  eumxopiy4omenlnvi s  rtmu pou1tpe mo3iat s2rluvs;(4tetrxr iadfp   u s;()s2xr(mpiu1lpt  nvtl( srtruro;o0opx mi3iydfaDuaumsnu0 lxoir tadfaDeliei ( teuoxm3iudlpt lfvsl( artmxmpno4oltoii3iysfmDuan snu4artoxo3tadoa elues;(0 2uo(o3oy4lp e fetl( s2ra(m nt1tlxn feilt a2uau s u4 rxrif3iy1opD  u i s texrimpnudoptnlnet s s2umumono4tlxoif3iyd s2ulnvp t)aleoxo oy1optrlu o s srtr(m ny1oltelncsasf Dra(monu4tlx ifciyd aDelnmp;t4aeeomf iadfptrlu i;s srtmimpiy1ame mivs s srumum ;u1apeomf3tydfaDemuvp;t0 rtnxocoadfpDr uvs;s srto(m ny4ame mfcsat) 2rrurp;t0tltnifeiadlm emn s;t4 rermrcoodoa eln sls  2toirpio1lle  ncslt aDrrxmooo1aetniictad a2um(mp (4 etnmr3oy1fm  lneilt0trtmio3oy4aleemnci (f Drrxront0tee mietltfs2eaumon(0tetomocoodomD  i s (0s2trim oodlptnlfvil(f rrm( p;t4tet  oeildfs em(vp;u4trenir3totoat lu s;t0t2xmxr3iudam n fetltf 2tmx  nt1apen oeiltlaDra(ms u)trtnif3tatfm e ivils teumirpiydll e nvilt)aDraum nt0aeen i3ils s uaumon(0altoxfciotlmD  nvs;t s2xo(m3ny1aptemnvtl() Dur(root4aet mfciatfa rau snu) etoif oo1om r ieo;t0t2xrimpoo4amee ici ( aDua( oou4oltoifetys sDeaump;u0 rxoifcty1opD ai s (0srxr(r iodlmen ivsasfsruaxrp;u1altn f3iydfs2ea(mp;t0 etrxfciotop  auei t) 2xrxr3oudal nmnetasf rtr(rpnu0tpe mietyslaDran o;t0teenircoy1la e neo;s texoirpoo4ap nlfei s)s2taxroou1oet io3iasfm rm(vp;u) lxnmo3io1fmte n ols0 exmxmpno1aleemivslt)arua(  ;u0oexnmfeildlmDrmn s (4 lerirctadfm rauvol()texmimpiudamtnlfvslsfarrmxmpou1tetnif3tadlaDulnmsnu4 lxrmr todom ean ilt0 rtmxopio4ome lfctat)s2urum ot4tptn ieilt mDul( o u)aexrxrciy1omt  nes (0tetmxm3iu1aleemictlt)srtau  nu1texomfcilsls2um( s;t0alenifcta1lmD anvi t0 2trxmpnydlmt mnvi (  rurur ot1olen ociytfa ul(mpnt4 rxrmf iodop  anvs;( teumxm oydlleemncilt)srtrxrpot0open feiasfaDuln p u)altomo to1la e i sls)srxmxm3nu4lltn nci t)a2trxrpnu4oexn fetlsfs rmu sn(4altnmr3oo1lp ean slt sruo(m io4amte feta( s2trx  ot4apxn octlslm eau pnt0aetnir oytfpDr nvs;s  2toimpnu4lptn ictasfa2rm(m ou0aexnmieiatla2ulnmp;u4arxoifcoydfmtelu o;s)trxo(opoy1optnmivtlsfs2uau ont1oeto i3ils s2rm(vo u) exoiocootoate ueo;t setr(opoo1lle  ics s s2ra( p;t1tlxn ieiyt aDrm(vsnt0 reoif3iotfat  ivi ()s2uo(opiudol nlfcil(fsrtaxro;t0aeeo oeias mDrm( on(4tleoxrciy1opDeaueo;t0trxmxrpoo4amenmfvia(farurx o;u0tlx mf3iadfmDrmnmonu0trerxo tytom  aneo;( s2to(m nu1apeelncsl(faDrau p;o1oet iociadlmDemumo;() rxomrctytlatr ivslt)s2uoxm3iu1alee fctasf Drr(mo;t1tlen ociysfs2ra( o t)arxrircoatlp e ieo t0t2tr(mpoy1olt mfeia() 2truro;u0tlt  feiydla2umumo;u4tleoifcoodlpDrluvi t) rur(rpno1ll elfvsls) 2urx  nu0tlt mieiyt m uaums;t)tetoif iodopD anvsl(  rxm(r oo4lp nmivsltf rrmxrpot4teeo i3tlsls uanvsn(4tlxoir tadfatran s ( setr(m iy4open ies s)s2urx  oo0aeto ocils aDea(vo u0 ltnxo3iydlp rluvils0setrio ou4aptemiciat srumurono0opt ioeiadlm eluvon() exrmo3oatfm rlivi;s  rxoxr3oodol  lfetlt)a2ur(rono1tex iieiysfm2rau s;u) lxrmfcto1op elieslt) 2xo(m3nu4amenmfciltf Dur(  ;o1tpe  o3iasla uln o t0aetoxo3oodla e u i;( trtm(r nudlltnlivs t arum( pno0tpt  fetys sDuan o t0arxrxocto1laD li ilt srumimpny1op n nvs (farrau poo1texomoetyt sDeanmo u4 ltomf3oa1lptranvs s0s2tm(m3iudomtemictls) Dtru ono1aeeomfciatla ua(vo u0alxrxo iydfaDraiei;t0tetm(opny1omtn fcsltf Dum( oou0alx  i3tas mDrluvpnt)tlxoxr ty1oa rlivil(0sexo(rpiodamtn ict (  rtrum nu1opxo o3tyd m2umu p t4aeerxo oy1la   neo;t0 exrio3nodap  lfvt s srrmu  nu1openiieildlm ra( s;()aexnmocta1oaDr i il() etm(r iu4ope mfetlt  2rr( ono1ole iieiasla2rln pn()tltoio3io1lpt li o s setmxmpio1ape lfvi t) rum( p;u4opeo f3ildla2ulu pnt4 lxrio oy1fmDr n s t0s2ur(opny1lmeelfvslt srrmumooo1oetoiicild a rlumsn(4 rxnmocoydoatrlnvi t0 rxm(o3iu4ome  ivs (f 2rmxmo;u0tptomoctyt m eau p (4teeomfciydfm r uvi (0teto(opiodopte ietls  rtm(  nu1oeeomoetys aDrmuvo;u0tltnxfcoydlaD li i;( t2umxm iu4lpenlfcsatf Drmur nu0tet if3tasls ranmonu0trenmf todfmD lies t  ruriopny4omeemies ()sDur(moot4alt mfctyd m2eanvs t0teenmf oa1oat aiei;t trtrim3iy4lpen ncilsfsrtaxront1oltnmieiyslsDrmnms;u) exoxf3iydlpDrlues;(0srtmiopnydomtelivsls) Dtr(rpno0alxnii3tytfm eln s;(0trerxrciadfp r nvo t)srumxr iudlltnlnct tfa2uaurpou4olxomieilt sDelnmpn()teerxo3ootoptr nvo () rto(r no4llte fcils  rrrxmpoo1ale mf3tadla rmnms t4tetnifcoa1oaDeai s;(0 eto(mpoy4olenlictlsf rrm( oot0aex ioctldlsDelump;(0teenmf3oytlpDelnvo;s0sexmirpio4omt lfvsa( a2tmuronu0aeeo ietlt s2eau p;u) ltoif3oatfm  anes;(0teum(r3iudlpenmfet t) Dtmu poo0tlx  i3iltfa el(vp (4areomfcootopD ln slt srxmxr3io1apen fcil(f 2ra(  ou0optoioeilsfsDrmn o u4 etnxf to1oaD li o (0s2trir3nu4omtn fcia()sDtrx pnt4ope mf3iydls2elumo;u) lenirciodlateaivs;t s2to(rpno1op nlnvtl( aDumumo;o0oeen feiys s2em(vsnu0tetomrcoatfm rli ols0srxoxo3no1olenmfei tfarrm(  oo1optniocild s2emu snu0 leoxr3oodomteaneo s0s2xmio3iodap  mieia( srtmxmono1alt ifctls s elnvp;()trxnmo oatomtelivo t  rxoxmpiudol n nvilt) rrru pnt0apeoiieiyt aDeanvp t0 renmocoo1oa e u s;( t2xrxrpoy1omenlicslt  2umxmo;u0tpt moeild s2ulnvpnu4areoio3iotlmDelues (0seuoxo oydop e fetat)a2taumooo0aptn icilt m eaumsnt0tlenir oo1omDe u i ()truoio3io1ap nlivilsf 2rmum ;u0aee  f3iltfmDumn s (4artrmo ootlpDelieo t)srumxrpoy1apen ictl( sDuau  ou0aptoioctad m2umnvpnt) lenmociatoa  ln olt trxo(o oo4lme mfvtatfs2tax onu0apxnmiciytlm ranvo u) rtrifcoo1oa   nvi;s s2to(o3oo1lp emfvt t)sDtmu p;u4teeomietys m2rl(vo t0altomf tadlaDr n i;t texrirpio1lmen fvtl() rua( pno0oleoiieiadfs ea(vs t4texrio iatlp e i o t0t2uoim3oy1ape  ivt s)s2umu  nu4tpe mi3iysls2em( pn() rerif3iatfa r nvs ()setm(mpiudopt mncsl(fa2tr( oou1tlx mictasls el(msnt)trtnmr ta1oaD au il(0setmxo io1am n ieias  2rru pot0oex  oeiyt m uan ont4alxomfctadop rlu i s0texmxm nudlptnmieta( sDtmxm ;o1olxn f3tldlsDuln onu0texrir3ia1omDeau s s)tetoxr3nydllt mivi t) Dum(ronu4oeeniieiys mDeauvsnt0 ltomrctotfateliei s0 2tm(m3oo1ome  ivt (faDtrx  ;o0tptnmi3ilsfa ua(mpnt0 ltnmrcoodfm r u o s0 euoirpnu1lltnlfes () ruaum ;o4tlenmfciadfs uauvonu)arxrxf iodlmD aies s texrxm no4ame mnct t)s2ta(m ot0tpx ifciytlm2uau pnu4trenio3to1fmte u s ()seuo(r oudam emfvtl()aruax poo4opeo ieiyd mDra(ms;t4 rtnircoytfpDeauvo (0srur(m no1alenlivil()arurx  ot1alx ifeiysfs emnmo ()artrifcoytlmteln s;()trxmxrpio1om   netlt)s2um(mp;t1tltomicild mDrlumsnu4alerif3iotfaD an ilt trtr(mpou1ole mics tfaDuaur ot4alxnii3iys a ua(vpnt4trtniocto1lm e u s;s0teuo(m3oydal e nvilt a2tmu  ou1aee ifetysfs2rln s ()tlxnif oodoptrlues t)srxoxm3iu1oltnlnet tf 2ta(monu4oexomieiydla2emumo () exnxoctodomtraneo () 2trxrpiy1lpt mfvs (f Drm(m nt4opxo f3iydlaDeau s u4texnif oatfp  aieils)sruo(r3iy4op n fviat a2urx ono4oexo ieiys aDran o (0 renxf3ty1fmtrlnvsls) 2toim3iy1lp emfeils sDtauront4opxnifciat m el(msn(4aeenmrctatla raiei;t  rurxr3nydll e fcsa(fsDtaxm nt0oex miciatlmDemn ont4tlerir3ia1lpDrlneolt0setmxm3oy1apeemfcs s aDtrur ;o4tlto ociatls2uanmp;(0altnmo ia1laD auvols  2toiopoo4al e ies s arur(r ;t4ape if3ildlm elnms u4arermocootlp  lneo;t srtoio3oy4lle mnvtltf rumx oot4tpxoiicias m2um( o (4aetrio3iotlmDr nvo s  eumio nu1olt lfvt t  rurxmooo4tlt  ietysls2el(vs t4tetrxf3oytfa   u s (  exrxr3iu4ap emivsls  2tmu ont4ope io3iad a rmumo;(0alxniociy1fp e neo;(0 exm(opno4lpenliesls) rtmu p;o0tetn oeiydls2ea(mp;u)aeenxfciytoat an i s)s2to(mpnudlpen nesl( a2ur(m ;u4tlx  o3iaslmDrmu o;u0 etoif tatlmDeanvsl(0setr(rpiudlle  fvta()a2uaxmo;t1tleo oeiadfa um(vp;u4 ltrmr3tytoatraueo s0 etoxo oy1lle  ict (f Drm(rpot1apeo octat aDeanvp;u)alenio3oo1fp eaivo s)setoir ou1lme  fvt sfa2uru  nt1alx  f3ilt s2umnvs;u)aexrxoctatomDraies () eurxopnudlmte ivi ( arrr(  ot0tee  ictad a2em(mpnt4trtrir3iadlptean s s0 ruoio iodlm e ivtls s2rr(rpou0texnifeiasfa2umn p u) eenxo3oy1op ean i;()t2toio3nodome lfctltf 2taxmo;o4alxnmf3ildls2rmnmpnt4tleomr3oo1fpt  ieols srtoimpou4ll elnesl(  2ururo;u0tpxoioeiasls2rauvsnt0tlerif iodfaDr ueo ( seumxm3nodll emfeilt  2raum ;o0aee moeild sDuanvon(0tetomr tatoptrauvs;t0setrxm3ny1llen nct ( sDuau pnt1aeeoiictatlmDrmuvo (0artoio3ootla   nvslt teur(r3no1lpen nesl(  2urx p;o4alxnmociadfs rl(mo;(4 exnxo3io1fp eaivi s tetoir3iy4lleemiet ()s2rr( oot4ale ifciadfa ulnmonu4teerio iydlpDrauvo;t trxrxo3nodopee nei t) 2trur ;t1opxoio3iasfm uauvon()tetomf iodfa  ai slt)teumxm io1ameemivil()srurx ont1oetnifciadfs uau o;()tlxrxf3ty1lp  ai olt teum(m3ou4altemncilsf Durxm ot4olenif3iltlsDuauvo;t0 ltrif tydomDe nvo;()srumimpnydlm nmfcs (f Drau  oo1tltn ieiysfs2um( sn(0tltrxr todla e ivo t0s2uo(rpou4ap emietls sDrrum oo0opeoif3tat sDumnvo;t0tlxrif iatoa eanvolt0trxoim3nudlmen netlsfaDum(r ;o4oleoiociat a emuvs;t)trxnxf3tadfpD lnvol()t2urim io1lmtnmfvi () Draurp;t0aeenii3iytla2ua(msn(4artomr3oydfaDelieo;t)s2xmxm iodll e ivi t)a2ua(rpoo4tlen i3iadfm2ranms u4 rxnmo tydoa eau o;t)srxr(rpio1ame lnctat) Dtru poo0ope  iciydfsDean p ()trenmf oo1fateanvo t)s2xrxm no4ale mnvsls  Dtmum no0oex if3tad mDrlnvo;(0 leoxo oydop  anvi;s  2umxr oudlmtn ieilt)a2rrx oou4aexomf3ilsla2rlnvo;()aeeniocoo1lpDean i;t0t2xrim3nodaltemfctls)artrxr ot1tpe miciltfm uanms;t)aexomf ootfmteaivo;( sruo(r3iudlm nmnei s srtm( o;t1ope ii3iatlmDra(von()trxnxfcoa1faDr ivi;s0 rxo(m3iodaltelfesa()aDumur ot1oex ioetyslaDuanvo;() etnxocootlmDeai ol(0srtm(o3oy1altemfesas)sDuax  ;u1tpxnifcilslsDuluvp;u4altrxf io1fmDeln i;t0teurir oy4omt lnciat s2um( pnt1oleomoetld aDrm( snu) etoir3ia1fatrai o t sruo(o3iu1om e fct t)a2tmx pot0aleo fctat a rmu o;u)alxoir iydopt auvs s seumir3oodomenlfviltfsDta(m nu1oetniiciyd m2rln snu4teenif oatfp elneo () eumimpnydomenlivslsfaDuaxmo;u0tpenmietydla ul(msn(0 rtomfcoodfp r i i s0tetmxr nudal e fvt t) rrmur oo1oexnifeiatfa ea(vo;(0 exoxfcia1fm eaivolt0t2xrir iu1lmtemfcs (faDta(mo;o4aeeoii3iytfm elnmo;u4 ltnxrctodoaDe i ils0 rurxo3oydapenmics sfs2raxmono0tet mieild a ulnms;(0tetoxrcoodfmt lnesl(  exmxm no4altnlfctls sDta(rpoo4tpxnioeildls2ulnmp ()tltoirctatlmt luvi s0seuoxo oodope mivsat)sDtm(mpot0texo fetas a2rluvs (4alxoif to1oaDr nesls)texmxo3io1lltnlnes s)sruaur ;o1tle if3iatfm2rlumo;t4tetrir to1omDeanes;s texr(mpnu1amte nvtatfsDra(mp;t1opx ifeilt a uan p ()artnxfcootoa  auvsls)t2umxrpiodlmtnlfvil(f Dtrumonu0alxnmo3ias m uau p u0 leriocto1oateaivo;t)texrxm3iy4om emnvsa( s2rm(mo;t1aeeomi3tat a ua( p;() ltnir3oydfm rli sls)s2trir nu1ole  feils) rtmxm ;u4oeenio3iatlmDranmont)arxnmocto1lmDr nvi;t0tetrxopno4al nmnvt sfs2umuront0oetn oetatlm2rauvo t0 ltnxrctydopDraivs s0truriopnu1oltnlnes () Drmum oo0apto ieiltlmDuluvp;u4tlxrif totfat lnesls0teum(rpiu4oltnlnvs t) Drm( ont0apxo oetydlmDem(mo u)artrmr3ta1oatraneo () 2tmxo nudlme mfcs tfaDtau pnu1apt ii3tlsls raumpnt)aetnmf oydfmD  ues t)srxoxo io4lptelnetas aDrr(rpoo4oet iiciytlaDrauvs;t0tetnmf to1om rauvols)t2urir3nu1op emfci () 2umumoou1tpxn f3ilt a ra(vp u)tetnxr3ia1oateli ils0s2xoim nodal  mfvi () Dumurpno0oeeomi3tys aDum(mp u4 lxrmrciy1fpteauvo;(0seurim3nodoltnmnvt tfsDumu  ou1tpto ictls mDrauvo (4tlxrmfcio1fmDrau olt) rtmxo3oo1ll elfesat)sDuru onu1aexoiociatfa rl(vs;t)teenxf3oy1fm rauvs;s tetmxr3iy1opt micils)aruaumooo0tlto i3iytla2ul(ms;(0trtoxrcio1opDelivs;t) 2xm(o oodlle  fct s aDuaxrpnu4alx  i3iltfa ul(mp;(4altomo oatlm  livo t  ruoxm io4aptnliet s) Dtmxmonu1tet mi3iys m2eln onu4texrxr ootopDraieo;t0 2xoxo iy1lm nmfct (f rtaum ;t1aeeoiociyt a2eau snt) rxomr3io1omtrau slt s2to(mpiudllt lfvtltfs2ur(rp;t4apxo i3iydls2rm(mp;t0 rxomo iy1oaDrauesls0t2trim no4lpte ivias srtmxroou0tetoiieiat s uau onu4 lxrir oadlmDrauvslt  2ur(r iodomt mnetas s2tmumono0oltomo3ias mDemums t) exoxf oydfmD aneilt0s2xmxr oodoptnmfes s) rraxmono1olen fciatlm2rlu o;u)tlxrxrcoydoateluei t0trtoir3no1lme mfeilt a2uax p;u4oleomictys s2ulnmo;(0aexrif3tydfmt liesl()t2umxr nu1lmen fcsas a2ta(rpou0tle mieiyslmDuau pnt) leoxocoo1op  ai ol(0texmxo3oy4am  mivils s2rr(m nu0tpenmieiyd s2uan p u0aeenifctatoat aivi t  2tmxr3iy1lltemicsa( a2umumono1alx mi3iytla emn p;(4arenif3oodoat  n slt)sruoxr iydame  fctas sDurx ooo4opeo ieiadlm rmn ont0aexrif3tydoa r ies;(  2umxr3iodll nlnetas srtrxm ;t4aexnmo3iltlaDea( s t4 etrif todopt lnvol(0 eum(mpiu4omt  iesl() rtaxrooo4aeen iciatls ul(ms t)arenifctydfp eaies;s)srtrxr oo1ole  ics ( aDumxmpnu4tpe  octatfaDuluvo t)tleomr oatfpt an ils)t2xr(r oudope lfeil(faDrrxrooo0opt mieiltlm elnvp;u0trtoxo3tatfa rluvi t s2xoxo3nu4amt mici () rum( pnu0oeeniociasla el( p;u4 renxf todlp rau i (  euoxr iy1al  lncslt  rrmxrpnu1aptoiociatlaDrm(vsn() lerxo3iadfp e u ilt)srtm(rpoydol  lfvtls srrmu pot1oeeoiictad sDrlu s t) lxnmr3iadfpDe nes;t) 2uo(r ny4alt lnesas)aDtmumo;o4apxnio3tyd s2um(msnt4arerxfciy1opDeli o ()truoir3no4lltelnvtl(  2tmumo;u0ale  oetadfsDeln s;t)tltomocty1fateli slt0texoir3ny4lltemfciat) rua( oou0olenii3tltlm rlumsnu)aleoxr3totlpt  uvs t0 rtmxr ny4al nmfcils  rra(m ;t1opto o3iltfmDelump;u4trenxf iytfm r nvo t) exm(m nodlpenlfet s arumumpnu1ole  ictlsfmDuan o (0 eenifcio1fptelueol(0sruoirpiy1lmee feilt  2rau pnt1opt iieiydlm2rmn p;(4 eeoircio1oa r uvi;t0trxoxm3no1ope  fvtatfa2taxrpnu0tpeo f3iytla rauvp u)trermo oo1lmDelnvi s0srur(m iy4alt lnesl(  rtrumo;u4oltnmfctytls ranmpn(0areoirciydopD  ues;( setrxrpoo4lp  mictat) 2taxr ot0aet  iciytla rlnmo;(0artnxr tatoateaieils teur(opno4am elfci ( sDta(rpnt4tee mieiadfsDrln s;()tetnxf3tadoa rlu i;()t2tmimpoo4lp elnetl(fa2rrxro;t1olxnmoetyd a2uan pnu0tetnxrcoo1oa rau o (  etrxo nu1lpt mnvilsfa2uax o;t0aeeomieilsfsDrl(vs t) rtoifcootfmteai o t0s2tmim3ny4alt  nvs t  2um(mpou4aetoio3tldfs2rl(vonu0 eenir iatoptran o;(0s2trxm3iy4aleelfvilsfarur(rpno4tptn icildfa umnmpn()tlxnxf tytlpD lu s s0 rumirpny1am nmivi ()a2raxr ;o4apt  fciad mDrmnmpnt4altrxr ta1lmt luvs t0 rtrxopiudllt liesasfaDtaxmo;t4olxomieiytlm ran o;u0tlermo oodoa e i slt)srum(r3oo4lmenlfviltfa2rm(monu4opxoioeiatls2rmnmp t0treoxfctotoptrlivslt) etrxm3iudolen ics sfsrurxm ou4alxnifetyslmDrmu s;t4altnxf3ty1lptrliei;()t2ur(rpiudale mietat)sDtrxmp;o1tpxoioeiys a ra( o;u0teeomo3oydoat lnvo;t)sexo(r3io1om   nes (faDur(rp;u0tlx moctydla uluvsnu4aeenmo totlm   ues;(  rxo(o3iy4lm nliet s sDtm(rpoo1tpx  o3ias s2ulnvsn(0teeoio oadfmDr n o;(0 rtoir3oudomte fviasf 2rrxmp;o4oleoioeils sDua(vs t0tltoxo3ta1fatrluvs;t s2to(rpny1altelivi ( a2rax pno1aexo o3iyd m2ea( s t)tetoif ty1fmtrln s;t0 etr(rpnu1om nmivsa() Dumxrooo0tlx mieiysfa ra(vp u4 ltoir3ta1fp r i i t s2xrirpiydll n fvsasfs2tr(rp;o0alto oeiltla rlnmp;t) eermoctodlmDeanvslt t2xrir ou4apt licta(fsDum(moou4tlx  i3iat mDeauvsn()aleoxf todoatrlu i;t) exoirpio4lmeemnvt t)sDurxmp;o4olxn o3iad a emnvs;t)tlenmf3ootfptrluvsl()srxo(rpiodomte ies ( sDur(r ;t4opeo i3ias m2el( p;(0artoxo3oa1fa   i i t0sexo(m3no4opeemneias)sDtrxmo;o4apxnifciltlmDum(vp;(0areoif3tadopteaiesl()texmxm3nydapen net tf rrruroou4oetomfcias aDea(vs;u4tetomoctadla ranesls0srxo(o ou4llen feil()aDrrxro;u0optoioctytfs2rlnvpnu0tlenmr3iodla  ln i () rtrxmpou4ome  nes s) 2tmxr nt0ape ioetadls2elumo u4artomf3to1fm rli ils)trur(rpio1alenlnvt s)s2taxmoou1apx  fcilslm2eau p;u) rtoxrcoatom elivo;()srxoirpiudll  lnct () rta( o;o1olto ociad mDean pn()tetrif oadoa  ai i;s trxoxmpiu1ape mnvsls arrau  no4optoiictysfm2rm(vo;u) ltnmo io1lp raivolt0 2umim3iu1oltn feia(fa2rrurpnt4aexo ociytlmDel( pnu) ltoxociotfpt lnvo;(0 eumxrpny4ap e nvt (fa2ua( onu0tee mfctldfaDelump ()tltrio3ty1optr ieo;s0s2xrir3nu1lltelnct t)artrx  ot0alenif3tysla rmnms;u)teeoif oy1lmtrlieols) rurir oydlme  ici sfaDtr(rpno0tpxoifetydlaDrlnmsnu4 rerxf3iytlptr nvi;t  2umxr iydlm  mfct t  Dtaxmoou1aetoiociytlsDuau p u) rtnxo io1fat luvol( sexr(rpny4lle  fvsltfsDtmumont0oleomo3tytlaDemn s;()aexrmo tytop   ivo;t srur(mpoodam nlfctl( sDum( oou0tpe ioeiydfm2rau s t)aleoxfcoadla r n ils)srumxo ou4openmnciasfsrrr(mp;o4aee  i3tyt sDul(mo (0 exoxo3iotlatelueo;t s2ur(mpiydlm elieilt)arraurooo0optomf3iytlm rluvs t4texnmo iotoate ieilt)trxo(o no4apenlfeias)arua(r ;t0oleoioeiysla2elnmo (4trenmocoytlaDeluvi;t)srur(opnu4alt mfcil( arum(r nt1alenmoctaslm2rmn on(0 exnxr iadlm   n i;s) rurxr iydop  livs s  Dtrxmpoo1tpenii3tytlaDuan o;t0aexoiociy1op  luvol() rxoxo no1ameelnet t s2taur ot1aeeo fciasfm rlu o;() etrmfctatfa  aueol(0sexo(rpou4al elfvslsfsDrrx poo0oeeoiiciys m2rm(vont)alenxr todop rauvo;() etm(o3no1lptn ncils) Drmx  ;o4opxo f3tlt aDrmu pnt)arxnirctadlaDelivi s0t2trio3oudom e ictas  Dumur nu0aee  feildfa umums (4 eenio3oytopDelivs ( teum(m ou1apenlivslt)a2rmu ooo0tlxnmfctys a2rmu o;()altoxo iotlp eanei t) exmio3iudoptn fet (fa2um(rpno4apto i3ildfm2uaumo u0tltrxr3iodom r nesls0setr(m iy4al   ietls sDuaxm ot0olt ifciysfa2ul(ms u0artoif3oo1fpD aivsl()seum(r nodalte neiltf rtm(mpnt4olen i3iytlm uanvo t)arxomr iodfaDeliesls0s2trirpno1altnlfct sfa2tax  no4alt mfctydlaDel(mo (0tlermo3to1lpDr nvils  rxm(m3oo1am nmfctatfarrax o;o1optnii3tasfmDul( on(4trtoir3iy1laDeaies t)s2tm(o3iy1lmeelics t  2um(  ;o1alto feilt m2ranmp;(4 rtnxr3iy1fm rlivils0srxmirpiodope  ncs (fs2trxro;t4olx io3tas a eanvo t4 etomociadop  li s;t)teurio nodole miet ()a2tmu p;u4tpe ioetydfa um(vo u0 lenir oatfa   ieolt0trumim3oydapenmncs tfa2trumonu4aee mfetasfa emums u0 exnio3oodlp eaies t0 exrir3oodaleelivtat sDtmurpno1olt mfctytfaDean s (0arxrir3to1omD luvi ( srtoxmpnydol   fct () Dtrx  nu4apxnifciltfsDua( snt0artrxr3oatfa e u o s0trxmir nu1ole  ncilsfs2um(rono4opto fcild a2umuvpn(4trxoxociytfp  ai i;s) euo(mpio1ap  mfvslsfsDumxm oo1apxn octyd aDul( o u0tleomoctodomDr nvo;s)srurxr3ny4amen fesltfartmx  ot4tptomociyd mDuaumo u0altomr3oodfateau o s0s2ur(rpoo4op   netltfs2rmx p;o1tpe mf3iys s uanvp u4 leomf oytfp   i o (  rto(opoodlmtnmfei t  rra(  ot4olxo oeiadlmDrmnmon(0 rtnxrciatfpteauvil( srxmir3iydlptnmfet ()s2tmxr nu1olt if3tldfs em( o;u4alxnmfcoatfmtrluvols)srxm(opoodll   nci tf Duaxrp;t1tpt iocils mDulnms;u) etrmfciytfa ran s;s)setoxo3no4lltnliviat)sDta(m ;o4apxo i3tytlm2eau pnt0alenif to1lpDr ueslt texrxr3oodlm   ncsa()s2tru  ou0aex mictatfaDem( on(0treomr oytfp raivs t) 2xoxr nu4op e nct ( arua(ront4aetomietyslm2emnmonu0arxomocoydomDeaivs;s0teumim3iu4am nmieils) 2umu p;o0tleo feiytfs emump;()aeermrcia1om  auvol()texo(m3nodlpenlfet ()artrurp;t0ope moctad m eau p;u0tlxoio tadomDeau s;s truo(o3iu1alen fesls s2tr( ooo1opeoio3tyslaDuanvont) lermfcoodfmte nvilt  exr(o ou1lm   nvsltf rtm(ront0tpt io3tadlm uln o u4alenmo oadoaDeln s;t) 2xoir io4llenlnesls aDta(rp;o0tleo f3tadlaDemuvo u0trerxr3ta1fpD au i t0teumxr oydomtnmfcs tfs2uaxmo;t0tpt mfetas s2ra(monu)aeerifcoytoa  li o t texriopno1ale lfeils  rraxmo;u1aetoiociytls ua(mp (0arxoxo oadom r neo t0t2xriopny1ole mncia(fsrumxm oo4alenmietls sDuau s (4trxrircoadfaD  uvo s truo(r3ou4al nlivil(f Dtmxrp;t1tpxn f3tyslaDulnmsn()aetrxo oatfpDrlnvi t)t2xo(r no1lm n ncta(fa2tm(mpoo1oeeoioeilsfmDra(msn()alxrir iatfaD ln i s)srur(mpoo4lmen nvtls s2uaur nu0alx  ocildlm eanmsn(4 eerxf3totop e u i (0tetoio no1lle  nvtat  Dtr( ont4olenmicias a elnmo u0tltrif to1latelieo s0 etm(opoodlm n fvtl( artrxr ot4olt micildfmDul( p;t4tltnxf tydla rlueo (0 2uoio3nu1am  miciltfsDtr( oou4tpen ieiyslaDelnvs;u) rtnxo3iadoaD aivols)s2uoim3oo1ole  ivsat  2rmump;u4apxomociytfaDum(msnu0 rxnxfctotomDraneilt) rto(o ou4llenlfctls a2ta(  oo1ope mictydfs2elu p t0 eermr3ta1oa eau i;s  rur(mpio4lpt  fvt ( s2tmxm nt0teeomietld sDuan s t0 leoxo tadlaD au o t0srtm(mpnydamee nviat)aDurur ;o1alenmoeilslm2umnmp u4tleoxr oy1lpDeaueslt0t2toirpiodap  licilt aDuax p;o1olt iociys a2uanvp;(0tleomr3oytfp eluei t  rumim iu4lp  lnct sfa2trxrpno4oet mfetld sDuluvp u0aexnir3iadomD  nvs;(0 2urxr3ny1omen nvsas)sDrr(  ot0aee  fetadlm2rlnms t0tlxoxrcty1lmte nvs s  2tmiopnydlmtelict t) ruru ooo0olxn feiltlsDum( pnt0tlxoio totopDeau i t0trxo(m3nydomtemnvil()aDra(mp;t4tltoiictasfaDrl(mon()alxnxfciatlmDrai ols srurxmpio4al elnvta() 2um(r ou4alenif3iyslm ra(mp;() eenmfcta1oa  aueolt0srtm(r iudopt  fvta( s2ta( oou0tptnif3ilt s eln o;u0aexoir oo1opDeanei;t0t2xoimpoy1om nlncsa()aDtrur ;o1tlxnii3iaslmDul(mo t4arerxr iy1lp eaneo;t0trxrxr oy1alt lnes t) 2um(rpoo0altniiciat a rln o t0texniocoadfpDeauvi (  rtrir nodome livslsfsrta(  ot1oetn f3iad m2ean p ()aexoio3to1latranvilt)seurir ou4lle mnvtasfs2um(  ot0tpt  fciatla2uln p ()tltrmrctydfaDr ieol(0srxmimpoo1op e fetltfa2raxr no0olto icilsfaDeanmo t)arxnxfctydlat  ivs;s0srtoxm iy4optelivsltf 2trxmo;t0aptnii3tad aDulu o;u0 rermoctodlatrlues;s) 2to(m3no1op emietls)s2uaxm ;o1tpxniiciytfa um(vs;(4aexrmocoadlmtrai i (  2xoxm iudopt mietls srrrxmp;t1optnmicils s2ra(mp;u4arxnxociy1omt aies;(0trtr(m3oydaltemnetlt aDua(ront0altoioctasfa2rau pnt4arenmfcio1fmt lu olt0trtrxr3oo1al  mict (fs2raxm ;t4texn f3tas m uluvp;u0altnmr3oydop  lnei s0tetmim3no1oltnlnet s  2umx  nt1ole  feilsfs2em( p;(0texoio3ta1fm e nvi;t0 2xo(opnudlm emivsl(f rtrxmpoo4alt  feiat s2rmump;()tlxomo oo1lmDr u s s  2uoxo3iydop nlfetas a2ra(  ou0oetomociasla2eauvs;t4arenxrcoo1lm e u i;(0t2tm(rpnodlpe  ieias) rua(m nu4tpe iiciysfs ea( on(4aeeoxrcia1om eluvol(0s2trir3oudaltnmies s)aDuau pno0tpe ifcildla2ea(mo t)alxoio to1lmDeau slt) 2toxrpio4oltn fvtat  Durumpou1tlenmiciatlsDrmums;t0 rtomr tytla raies;t0trxmxrpio4om e fcsasf rrm(mpnu1olx io3iysfa ulums;(0 lxnxoctytopt aieolt0texm(opoy1omtelncslt)artrump;u4aeeo i3iadfs em( o u) ltoxr3io1fatelivs;t0 ruoxopny1lp n fes s) 2tax  oo1oetnmoeiatfm ra(vpn(4 ltrxr ootomD auei t trtrim3oudlpte ict t)sDuaur ou1tpenmfeias aDumn p u0 lxrxr3iatfaDe ieo;(0 rxrxo io4ope  fvsltfa2umx p;u1oltnioeilsfs2rauvsnt4arxrmo3oa1lpteanes s) rtoxr oodap  mivta( s2tm(rp;u0oltnmoctydlaDua(vo u) renxr3oydlp   ueslt0trtm(o iydam   nvsl( srrax p;u1aet mfctlsfm2um(mon(0 ltoio3tadfp eli s t0 rum(o3oudam  lnvtlt aDum(moou1oetomociad a rl(vonu4 rtoir ta1omt aues (0 2uoxmpoo1ap  lnci s)aDuaurpot1open oetadls2ulnms u0aetnmrciodlmtrliei;t0sruoir nudamtn fetl(f 2urxrp;o4apxn ieiat mDrauvs () eenmf oatlmtrlu o;()t2ur(r3oodlmt  fvsls  Drmum ;o1tee  fctyslmDrmums;u0trtrircia1fmDelnvs t0 exoim3no1lmeemncilt aDrr( pno4tpe mf3ilsfmDumnmo ()altoxo3iy1fmtelneo;( t2uoiopno1olenlfeta(fs2tmumoot4teeoiocilsls2rauvsnt4teermfcio1lpD li s;s0t2xoiopio1ap   iei (f Drrx o;o0texoii3tadfm eanvp;t) rerxo3ootlmt ln ol()t2toxm3iy1alenlfci t)aDuaxr ;u0aetn fcild mDumnmpnt4alxnir3iodfmD livi t0s2trxm3io1lpt mivsl( s2raxmoou4tex  fetasfa2ua( s t0aetriocoy1oatr neolt0texmim3oodlp elncsat  rtm(m no1ape ioeildlm emnms (0 lxrmocta1fat aivslt0 rxrxm iy4omtn ivs (  rtru pot4tpe iieiys m ea( s u)tleoir3ta1lm  luvs;(0t2trim3ny1amtnlnet sfa2trxmp;u4oltomieiad s2ulnmsnu0texrxf3tadoaD  nvs s  rxriopiu1oltemnvt sfsDurxront0aet  iciyd m2ulu snu4 lxomo tatfmDrli s;s0 2trirpoo1lleemict t)arum(r ot0oleniiciytfaDrau ont) rerircio1fm   uvo s0 2to(mpou4ol emiet (f Dtaumpot0aptniocils s2ranvp;(0texoir iadom eanvs;t0setr(r nudome mfvil()aDuaxm ;t4tpx mf3ildfs um(mp;u4 exnmrciotfm e ieslt s2xo(r nodll   nvsas  Dtaum ot1altn i3ilt sDrm(vs t0 rtnxr3iotoaD  n ilt)sexo(mpny4lltnlici t) 2uau  ;u0olen i3iasfm ua( p;(0trxnmo3tatlpDelu o t0t2xm(opoo4ope  nvtlt)sDtmx  ou4apenmfeiadfs2em(ms;t) eeoiociadopDrai sls  2triopny4lp  lnviasfs2tr(ronu1altoioetltlmDemnvon(4arxnxf3oatoaD  ueo;s) eumxr3ny1am emiesat  rrmur no0tpto f3tyt aDra( p;u)tleoircoytopD livs ( t2xrxmpoudom  mivsas  2rr(mpnu0aetnmoetydls2um( o u0 leoifciy1fpD lies s seumir3iu1lptelnctlt arua(rpno0tpx  ociatfs rlu p t4 rxnxfcoy1oat lnvs s) rto(o oudoltn fet sfsDur( ono1alen oeildls umu s t4arxrmo tatlaDrai sls0t2xrxmpnu4lpen icsas s2rax o;o4tlxomictlt aDem( p;u4 rxoif todfa  an ol()s2xoim3oudol  lnei sfsrtrxront4tlxomf3iyt mDel( o;t4tetoir3to1lpt livi;t0 ruoir iu4lleelnesa( a2rmu  oo0alx ii3iad mDulnmo;(4aeenmocoytlaDeauvslt0s2xm(mpno1lleelivsl()a2rru p;o0tlxoifcilsla ea(vs;() rtoxf3iodoaDelnvolt0teur(r iy4al emieias s2ta(  nu0altoii3ild a rluvp;()artrif oa1lmtrluvils)t2xo(r oydolt livs (fa2umur ;u1tpxo i3iadlm2uan s;t)trtomfctytfpDrlieils trto(m nu1alen ictl()aDuaur oo1tlxoif3tatfa eauvo t0arxoxrcta1lpt livols0t2xo(rpnydlltnlncias srururpot0oeeoif3ilt sDelnmo;t4aetnio iatoat livil() 2xoxm iodlmee ieias a2tmxr ;t4oltniieiaslaDeanvp (4aexomr3oo1om eanvi;(0s2tmxm oy1altnmnvt (f Dra( o;u1tet  i3tytfa elnvsnu) rxoifcty1lpteliei;s)sexm(r3nydopt mfci sf Dtmu pno0tlx ifetad a ua(mpn(0tlxoif3tydfa eaivo ()s2tm(rpno1ope liciltfartmx pnu0altoiiciat s rmumo;t4tetrifctodlpDeai ilt seur(r iy4altn nvtas)arrrur ;u4teto i3tls s2umuvpnu4 leoir oa1fmDrlnvs;( seumio oodapte nct t  Drm(m ;t1opxo iciat s2eauvont0 lxnmocoa1latr uvslt s2xoio3iydoleelieia()aDrr( poo0apeo i3ias aDulums;u4 rtrif3totlmt lnvo t0seuo(m nu1ap elivil() 2rrx p;t4apxomfeiyd sDua(vo u0aexomrcto1oa  ai olt) 2tmir3oodoptelnvs sfarrmu poo1oeenmfcild m2ul(msnt)tlenif3ty1omD  uei;t0t2urio nydlmt  fvtl(f Dtmu  no1tlxoif3iysfa2uanvsn() lerxo oy1oaDeanvils  2xoim3iudll nmnetls)a2tr( onu1opeo o3tldla2uanvonu)alerxo3iy1lpt lneo ( trto(opiodlpeelnet ( arurx ono1tee iociydla2ul(vo;u)trtoiocoa1omt  nei s texmxo io4alte icsl(  Draumono1tpt  o3tld a2rau sn(0 etrmo tadoaD auvs;t t2tr(o3no1al e ict tf 2trumo;t4aee ifciltfaDeau s u0 lermfctytlm  auvi;() rtr(m3no1lleelivilt sDtm(r ;u0aetoiietls m rl(vpn(0aexoir iydlaDe nvi (0s2to(m3oo1omeelneslt aDtr(mo;o0opx mi3iytlm el(vp;u4 leoircoydfaDeai i;t0 2xoxrpnudopt  fct t)a2tmxm ou0tleniieiat sDel(vs;t0teenmr ta1fm r ies;s0texo(opnu1om  mnviltfa2rr(rp;o4tpt  o3iydlmDrluvp;(4 reomo iy1lp e i sls0 etrxrpoo1lp emnvt tfarua(mpnu4apeo f3iytlm em(msnt4 renmo oy1lmtranvs;t)sexoxo3iy1lpt lfci ()sDtaxmo;t0ope mfetadla uaumpnt) eenio tadlpD lu o t) eumxm3iodamt mivils)sDua(moot0opt miciasfmDua(ms;u0texnif tadoat  ieo;s)t2um(m ou1omt micsl( s2rmu  ;t1aex if3tys s2elnmonu4alermo3ta1faDeln il()s2um(o3io4ll nmnct s)aDrm(rp;u4apeniociadlm2em(vonu4artrio oa1fm eauvi;(0s2urim ou1ap  mneia(f rtr(ro;u0tpx  oeiyslmDuaump (0aexnxo3iydom rlnei ( srtrxo3no4lle  fci t)srum(mont4tltnmiciydfm rlu pnu4 rxrmfcia1fm eauei s) eurio oo1amtelfvsls)artmu p;t1ape mfetad s2elnvp () ltomrciadlp eauvols  exm(opno4optemici tfa2tm( pnt0olx ifeildlsDuluvs u0 etnmfciytlatraiesls) 2xmir oy4om  lfet t)sDrax o;o4alx ioeiyd m rlnvp;u)texnxf iodoptrlu o (0t2xrxopio1amtnlnctl( arra(r ou4alxnifeiys mDulu snu4texnxrcta1lpD aueil(0setr(r ny4ol  mnet s) Duaxmp;t0ope ioetytfm2el(vo;(0 ltrmr totop  au s;s  2toxm3iy1lp n nct sf Drauroot4teeoiieiatfa2ea( sn(4alxoif oa1fp eaneilt)s2tm(o3iydame miesat sDrm(root4tptn feiyt aDum( s;u0aexomr oatoa e nvi t  2xr(m oy1op nlncs s  ruaxmp;t0oexnmfeiasla2emuvs;(0trtnmocoy1omtr n s ()trto(rpiy1lpt  nctat) Dumx pou4olxomfeiasfm eauvo;(4 lerir oytfa r ues;( sexmim iodom nmneia(  2tm(m nt4tpeoiiciydfm2emu o t4 rxoir3ootlp  an s t t2xmxmpny1aptemnvsl(fa2tm(mo;o1aptomictyt a2eau onu) rtrmr3iydop  an ilt0trur(o3oo1lleemiet s)srrru o;u0opxoiietad s elu o (0 renifctodlmteaiei;(  2trxm3iydoptnlfvsltfsDtm( pou1olxomociysla eanmp;u0aetnxo3ia1oa rli s;s setmimpoy1lp n fei t  2rrum ;u1optomocilt aDumnms;t) lxnir iatopD aueo s sexmir nu1ll  licsl() rtrx  nu1alx mi3iadfsDrln p u4tlxrmf3iatomteau slt) 2uoxr nudlltemivt () rur(r ot1apxn fciydlm ulumsn(0tlxnmr iytopDraiesls)sexmio ou1op nlfvt (fa2tmxmo;o0tltnmieiyt s2umnmo ()areoxo tatlpt au olt  rumir3iy1altnlnvtas)aDum(r oo0oltnifctyslsDul(ms u0trtnmf3tydom rln o;s)t2xm(o ny4oltemnciltfaDuaxrooo4tlx  i3tyd m ra(mo;(4 exrmo3oytfat  uvo s trxr(mpoydaptnmncs sf Dtmx p;o4opx mieiadfm ran pn(4texnxr iydlpDean i;t0s2xr(o3oudop emfei () Drmxmoou4opt  o3ildlmDumump;(4artoir tadfmt li i s  2toio3ny4ll nmiesltfaDum( o;o4aeeomoetls s2elnmp;(4artoif3iy1lm rli ols srur(opiudlm  mivta(f rrr(  nt1tpxomietltls eau s;u0arermfciatlaD  neolt)t2toxr ny1apen fci () Drmxmono0ale  o3iyt aDumuvp;t4 rxoifcoydop   ieolt) exmio iudameelies ( aDrr(m nt1tpto i3iltfm2raumo;u) rtnxr tytlm  an sls0t2umxr ny4ameemfctl()sDurumooo0oexnmoetld aDel( p (4 rtoxr oy1omD lneo (0t2xrimpou1alen ivtl(fsrtmu  ;u4tetnioetltfmDra( pnu4 etnmr iodlm raneolt0teumio io4apen ncsltf Dua( pnu4aexomoeilt m2rm( pn(4texrxr tytlaDrluei;(0teuoxr3no1open ies t srum(  ou1aex  feias s um( o u)tetomfcoytfptrlies;t0 exo(r3ny4omen fvs s)aruauro;t0alxnmi3tlt m ua(mo;(4artomocio1oa   iesls0 eurxm3iy4olt lfcilt srrr(rp;o0apt  oeiydfs2ra(mpnt) eeoxf iotfa eliei s)trxoxr iu4omt lfesl(f 2rrumpot0tlx  feiat a ulnmp;t0trtnxr oytlpt an s;()t2toiopoy4lp  lncs sf Dtm(mont4apeomf3tytla2rlnmsn(0altrio oydlmt ln sl( srxmxrpiy4lmt mfci t)s2umuronu0oet mf3tldfaDel(mo;t)tlxrif3iodom  lues;t)trxmio io4ap  licils srum(rpoo0oeen iciltls rl(mp (0arxrmo3oydfaDelu o;t) eurxo3iy4am e feiatf rtaxrp;t4ole mo3tld m2eauvp (0 reniocty1lmD lu ils)t2xm(mpou4lmenlfvias) 2uax p;o4opx ii3tatfaDumu pnu4 eermr3iatlp   uvols0teto(o3oo4ol  mncsl(faDrr(mo;u0olxoioetysfs rlnvsn()tlxnxr oa1fp elueslt s2tmxm nu4llee ivslt  2ur(m ot4aleo feiys m emnmp;t4trtnxr3to1oa e ueo;(  2xmio3oo1alenmfcs ()a2um(m ;t0aetnmfcilsls ulnvs (4arxoxr3iydfa  aieo ()t2to(opiy1al emfesas) rumurp;t0ape  f3tlslmDea( s (4arxriocoydfa   uvo s0srxo(o iu4oltn neils aDrax  nt1aeeomieildls elnmp;u0arxrif3iydoaDe ieils)srxoimpiy4ap n ictlt aDtau o;u0tlen i3tatfm umn s;u0altrirciytomD li o;(0s2xrxmpno4lle lnctltfaDuau  oo0teeoio3taslsDrau p;u4tlermf tatlp r ieols0s2xr(r3oydaptnlncilsf rrrx  ;o1oex  f3tad m emnmp () lxrifcta1oaD lnvslt)srum(r iu1ome mnvta(  ruru o;o0aleo i3iatfa eanvp;u)arxnxo iadoptrlivilt  rumir3iu1omt livt ( a2tr(  ot0tpeoii3tas a2umnms (0arxriociy1fpDeauvils trto(o3oudol n fcsltfaDra(  ot1apt  octltlsDel(vpnt)arenir3iytfmtr u i;t teurimpoo4apte nci sfa2rmu pou0alxoiieild aDranmo;t0arerir totlatraiesls)srto(o3oy1ol  mfei t)srumx oou1texn fetltlsDua(mo (0aetrmr3oadopD aueo t0 rtmxmpno4ole mnvsatfsrrm(mont4tet mf3ilslm2ean s (4alerio tytfmD livs;t)teur(o3io1ol  mfes sf rrauroou0tltn f3iltfa emums;(4arenir3tydfpte u i s  eur(m3io4op e netl() rtaurpnu0teeomoetasfa2ul( on(0alenio3iytopteai s;s sexoim ny1ale livslt)aDrrxmonu1opto feiatfa eaumont4 lenmo3totlp  ai sls0 rtmirpiydoltnlfesatfa2rr(rpno1apxniiciad a el(mp;(0alerir oodlpDeai i;(0s2xoxopno4oltelfvt tfarrrum ;u4oeenmiciyt s emn o ()tlxrxr iytfm r ies;t srxrir3ou4ap nmicsat srtax pno1tptoif3tasla2ea(vs (0 eeomo oadopDeanvs s s2umxr oy4amenmfctls)a2rmu pno4altomoeiltls2rln s;(0 etrircoytoa eluvo;() exr(o nu1amtnlfvtat)srtrxm nu1altnmoeiys m2umnmp ()tetnmo tatla r iei s0srxrxm3iu1ll nlfvsat) 2ra( ooo1tleniieiytlaDranmp;()tetrir3oytopt ai o;() rtrxo oy1lp  lfvs s)sDtmu p;t4tltnmf3iadfs ranvpn(0 lxrxf3oadfmDraivo ()s2tr(opny4ape miei sfarrru o;t4tltomfeiasfmDel(von()arxnmfcoydfm elieols0seumxm3oydale micsat  Dumum no1tlenmo3tldla ulnms ()arerxr3iytla e nvs;s s2uoxm nu4lpenmnetltfsrrrxr no4tetn ietltls2ul( o u4alxrmrcty1oatelu s;t  rxmxr3iydll   ivi ()sDrru p;u0tpx  o3iyt mDelumo;u4 etnmfcia1lm rli i s)srum(rpoydalte fcias  ruaxroou0tpxnmietldfs2elu s;()tlxrmocta1lm e ues s)teumxo3iydomtelncsat  Dur(r nt0oet  fciltfmDra(vo (4arenio3iadfat  ies;t)trurio oy1ameemfcilsfs2umx pno1tpxoifeias mDumnvs;t) etnmrcoa1faDe n o;()srtoio oy1ol emies s  Dtau  ;u0aexo ietad s2rau ont4teenxr3iytfatrlies s0s2uo(opiu4lpe  ncsl(fa2tm(rpno0ape iiciatfs2rlumsnt0 rxrxo3totfatrluvo t truo(m oo1lle lfesasf 2rrurpno0apxnmi3tld a elumon()tltomrciadlm  anes s srumim3nydlme  ietasfaDtmumoot4openioctadls rl(vs (4aeerif3to1lat an i;t) euo(o3oo4lp   nvsltf Dra(rp;t1tex mfeiydfsDulnvp;t) leoxr3tytfmte ieo;s)teurimpnu4ap n ivtat arra(ro;o1oleo ietlsfaDra(vs;t4alxnio3oytlaDeluvilt0s2umxmpiudlmtn ivia()srraumo;u4olenioeiadfsDul(vpnu4tlxomrctadfm eaieilt0t2trxr io1aptnmnct t)srrrxmpoo4opx mfeiltfa emuvo t4 lxrircoydlate n s;()srtrirpio4ope mnet t)s2uax oot1altnmf3iydfa um(vont4 etnxocoytop raues;t sruoxo3no4apeemietas)s2uax pou1oltnmoeiltfs rauvo;(4trenmo3ta1oaDeaivo s sexoxr3no1ape mneta(fartm(r ;u0aeen ieiydfa2elump;()aeeoir3iytla  au o;t trur(opnu4lp emnvsatf 2rm( ooo0tpxn fetls aDrau ont)alxoxf iytomDr iesls  etoim3iodlpenlncsls)s2rrxro;o0tpto oeiyt a el(ms t) rxoioctadoat  ues;s0 euoio oudap n neil(fsDtaxrpnt0apt iieias aDem(mp;(0 leomo iadfp r nvs s0 rurxopnudlle lfeslsf 2um(rpot4alto o3iydfm2rmuvp u0aeerxociytlptrau o;s0tetoxo3io4lp elivtlsfsDurump;u0tltn i3iyd s2uluvp;(0 rerio oo1opte uvols0 rum(m3nydlp  lnci tf 2rmxront4oltnmfctysfm2ua( on()aleoxfciotoatrauvil()t2tmxm3iodamtemfeias  rtrurp;t4ope mf3iltlm2rm(vs u4aetoif oydla e ivs;t srurxo3oodal  lnct ()aDrru pnu0ape iicilsls2rm(mp u0 rxnio3to1lpte uvi;s0srxm(r3oo4apee fviat a2taurpou0alxniocildlm2um(mont4aexnxr3oy1oatraieol(  euoim oo4amen ies t)aDum(m ;t0opt if3ils mDumuvp;t4 exoif iy1om rlieo (0 etrxr oy4omtelfciat sDuauro;o1opxnmf3tyslm2ea(vpnu0tlenmr3ia1fa   i s (0s2tmiopny4amt  feilsfsrtm(  nt4aeeo feiyt m um( p;t4texomo iytlpDe nes;(0 2xrim iu1lmenlnvi (farraurpot0tpe ii3tlt s2rau p u)aetrir3ta1oa  auvs;t  rtmim iy1oltnmictl(fsDraxr ;u4tpx mictaslm2ranvo u4aexoxf iy1lptr u ols t2urio nudapt lnvtas) 2raxm ;t1tlxomfctytfm um(mo u4 ltnxo totop eauvi;()seuoxr3ou4oltnmfetlsfs2ra(rpoo0opxomoeiyt mDean s;(0 eenio3oadopD aiesls  euoxm oydlm nlfctlt  Drmu  no4oeen o3iadlm2uanms;t)texrxf iadfa elnes;( s2urio nudom  lfvs sfsDurxmp;t4texn ociat mDrmnvon(4trermo3iydfmD luvo;s t2to(m3nu1lltelnesatf rua(rpnu1apenioctatfa emumsn()aeenxr tadfp elu olt0t2xo(o3io4lmenmfciat)arum(m no1ole iietyt a rm(vsnt4arxnxociotfatraivol() 2umxm nu4apt  nvi ( s2tmxm ;t0aptomfeiadfs2rl(mo;(4tlenmrciadfmDr nesl(0 2uo(r iydope  fes ( aDta(mo;u1olxn octysfm rmu snu)teenir oadfp e uvolt  rumio iu4aptelici (  Drr(m oo1aeeomoetytfs rm(mp u) eeoirciodoaDeauvs ( trumirpoy1al   ivt s sDum(  nu0oex iieilt sDrlnvsnt4tlenxr3iytlptelivolt) 2xmxopny1lm elnctl() Dumum ;u0altomiciyd m ea( on()altomr3totlatr ivol( t2ur(opiy4amen fvilt)sDrau  ot4oex  o3iltlm2rl(mp u)aeermr3tatlateauvi;s) rxmir3iudal nmfes t  Dtaxmooo1tpeoifeiyd mDel( s;t4 lerxf3iy1lmDr uesl(  ruo(opiu4ameemfeiat a2rrumonu0alt  ietadfs2ulump u0arxrxr tydom eai i (0texmxo nu1al  lnesa( srurx  ou1tpe if3ildlmDumnmp ()teenioctodomD  ivo (0 2xrxmpiu1am  lnet t) Durum ou0olx  feiyd mDumuvs u)tetoio3oydlpteai i ()t2tmirpoudal   nct t) Durum ;o1olx mfciysfa2ranmp (4 eeomoctodomteaivi s0 eum(r3iodap   ivtls)a2ta(mpoo4tlx iiciyd aDuluvo;()tlxrifciatomtean s;t)t2xr(o3oydaltn fci s  Durxmonu0apt iictadfmDrl( p u0teenxf3oy1la  ln slt s2ur(r iy1lmte nesasf rumur ;o4tpx moeiyslm eauvpn(4aetomf iytlmt luvs t trto(o ny1optnlfvias)aDtru  no4aeeomi3tls a rl( sn() lxrio3oodfp r neils)trum(opiu4lltelici () 2rmxmoot4apeniiciyt aDuau p (4aetoxo iydom eauvi;s) 2xoxr3ou4lpen ietl(fa2tru poo1tpto i3ilt sDrlnvp t0tltnxo oydlmte u ilt  ruo(rpio1oltn nvi sfa2ur(mpnt1opto ictysfm ean onu0alermf3oadoatean sl(  2tmxm3nu1lmtnlfeslt)srumxmont0tleniieiatls emnms;t4 lxrmrcoa1opDr ies t) exmio3no1lp emfvt tf 2um(rpnt4alx iictas a2um(von(0trxrxociytomDrluvo;()srtrimpiodlpt mivi t a2rrxrpno0aetnmoeiyslaDul(vs;t) lxoxo iadfpt lnes ( trurio nudoptemfvs s)arrrxm ;t4tltnioeilt a2elnms u4 lxrmo tadfat luvo t)tetm(o3iodape lics sf 2tmxm ;u4aexn f3iyslmDemn o (0tetnmrcty1oat  i s;s0setrir iy1am  lnvtlt)a2tru pno0tltoif3iyd s rlnvp ()tlxrmr tytom elieo ( texo(rpiodopt livtlt srum(mont0alx  octasls2ra(vo;u4 exrmo iotopt  ieo;t0trtmio3oy1apt micilt aDua(  ;o1teeoiicildfsDemuvon(4 eenxoctadlat  nvi;(0s2toio3oudapenmfci t s2rm(  nt1tlx mfciasls eauvp;()tlenmocto1oaD ln s ( s2umxrpoydoptnmnvi t) 2umu  ou1apeomfetatlm2rmnmpn() rtnmf iotlmteau ilt0seumxo oo4lm nlneta(fartaxmont4tee mi3iatlaDrl( o u)trxnmo3iatlmD  u s;s)srxm(m3nudap  lnvi (fs2uaxr no0alx  o3iat a2rluvsnu)trxomocto1omDeaivs;() rumxrpno1lmen fet ()srur(r ;t1oltnmoeilsfsDraumsnu) eenio ia1oaD lneol() 2xoxr no4lmtemnvi (fa2rm(m ;u1ale  f3ilslsDem(vpnu)trtrifcootoa  an o;s) 2tmxmpno4ole lnvs (fs2urxr no0olt mieilslaDrlu s (4teeoxf3ty1lmteln il(0setoim nu1olen icta( arurxmooo1apxoifeiasla2em(mpnu)trxoxo3iatoaDraueo;( teumir iydlp n nctl() Dtmxrp;o0alt iieiytfa elnvp t) etrxo3oydfmt livilt s2xoim3nodlpen nctas) rtruro;o0tleomieiydfa2uln p u)trtnmfcoa1fa r ivols setm(r3iu4am emivta() Drmxmp;o4apt mo3iltla rl(msnu4trtrircoadomDeai i;s0teuo(r ny4lp  lnci sf 2tmum ou0tpxoiiciyslm2ea( o (4teeoif oo1fateau s (0trxoio nydlp elieiat) ruaum oo1tpenio3ils a ean o u0alenmr3oodla r i s;s0sexrir3iodlltemfei s  2taxmp;t0tpenmoeiltfs2umu o t4alerxocia1fat ln s ()truoio ou1om emfvtls)srrr( o;t0alt  ociysla2rmnms;t)tetnmr3iydop rlivo t sexr(opnu4lpt liesa(f rua(rpnu4apeo fetytlsDrm( o ()trermo oatlpDean slt0t2xoxr3nodap  livi (f rtrurpno1oltomf3iadfa uauvont)arxnif3ta1op eluvi t)seuo(m no4opt  ies (  ruau  ou4apxn octat m2rmumpnu)aexoxf3oydla eluvi s t2uoxrpio1ol elfvslsfa2urxr ;t0apto fctytla uan p (0aetrmo oatomDe u s ()t2xrxmpnu4lpen nesas sDrmxmont1aleo fciadfa eanvonu4 rtrirciadoa   ivs t  etrxo3oy1lm  mncias aDur(r ;u4tpe  o3tlsls ua(vs;(4teenmr iotop  ai sls)srxoir3oydlmen ieias  rur( p;o1aetniiciadfmDemu pn(0 ltrmo io1oaD  ies s t2xmiopoodamtnmneia( arrau o;u0tpenioctyt a2em(vo (0 rtnir oy1fpDrlnvilt)t2uo(m ny4om e fciat  rtaxmont1tlx  ociaslaDrl( p (0texomo io1laDeanei ()seuoxm3iu4am elncsl()s2ta( oot4tlx  oeilsfmDuanvon(4 exoir iadfaDrluvols  exm(rpnodaltnmiciltfsruau  nt1opeo i3tadfsDul( o;u4 renircoytlat luvs t sexr(rpoo4omt  fei ( a2ra(  ;o1aleoiociad m2ra(vpn(4areoxf3io1fptelueilt)s2um(o iudlltnlnvils)srrmxm ou1olxnmictytfm rl(vp (0trtnmo3oydfptrlneo s0 euoxmpiy4ap n fvil() ruax o;u4tlxomf3tydfs2rln pnt4 lenio oy1fptrlueo s)teumxr3ou4lpt lies t)s2ur( pno4apen i3tyd aDel(ms u4 leoxo tytfmte ieo;() etr(m3ny4ome lictas)aDumurpot0opxomociasfaDuanvpn(4alxoxfcoa1opteaivi;s)tetm(o3oydoptelnetatf 2ta(mpou4aexnmieiys a2emnmp t0trxrmo3oa1fm   i o t texrxr3oo1om e ieilsf Duaxr ;t4tee mf3iytla ulnvo;()tlermo iy1fmDr ueil( tetmio3oodamte nesls  Dua( p;u4aexnioetatfa2rmnvp u)aexnxr totoateauei;s)t2uo(r3oudop nlfviasfsrum(mp;t1oltn o3ils m ul(ms u0 ltnif totlaD  n slt  exo(r oy1ameemfvi (fsDtrumoot0olxn ociyd s2rmu snt)artnxr tytfaDean s () 2xm(r3nu4opeemneslt) 2raxrp;t0aptnmieiyt sDemn pnu)artoifctadom eaues;s0srxmxo3ny1omt  nvsa(f 2rrxr ;u0olxnmoeilt m2ua(mo (4tltrmo3iadoatr uvo;s0t2xrio iy4om nmnesat)a2rr(m oo4tptnioetadfsDelnms (0aexnmfctadomD aivsls0 etm(mpoodap  mietat)sruax p;o1opxo ociatls2emuvp t4 rtnio3iy1opDrlnvo (0 etm(m3nu1omtnmivtlsfsrrrx  ou1opt  ieiaslaDel(vs u4teeoiociodoa elieil(0t2xoxr3ou4lp e fvils aDumxrooo1oeto fctyd m uauvo t0tltrif3ta1fpteaues s0srum(o oudalenlivs () Dtaumoou1opxoif3tydls ranvo;(4artrxf oytfmteaivsls s2toxrpiodomenlfct s)a2tm(  ot4apxnio3ilsls2rm(mpnt)trtrmrciatomDrai olt)srxoio io1al nmnvi ( a2rm( ono0oexn f3iat aDuln s;u4tlxnio3todlmteaivolt0 rxr(o3ny1am elicsat)a2trumpot0aexn i3tldls umuvo u0 renxocoadfp   u ils0srxmiopio4ape mncs sfaDtr(moou0opt ioctltfaDum(mo;u0arxnmfciotfmD auvs;t trurimpnu4al   nvtas)aDtm(m nu0oexo icildfsDrm(mp (4tltnxf3tytlpDe i olt t2tr(mpny4lmtelnci (f rumxmpot1ape mf3ias aDuaump t)alxrxrcoadomteluvi (0 2um(r3nudoltemnci t) ruax o;o1olxn ietaslmDem( on(0trxrmf3tadfaD lnei;s0 exm(r ou4optn net s)aDum(  ou1alen o3tldls ulu s u4tetoir3iy1fp rln s;(0sexm(rpio4alt mivi s  2rau o;t1tptoiocilsla eauvs;t4 ltnir todfm  anvi;s0 exmxo3ou1llt  ncsasf 2rr(m ou4alxomfciys m2rmu s u0 lxoiocoytlmD li o ( srxrio3oodllen ictl(fa2rru  ;o4alenmfeiytlm2ea( pnu) lenmrciydoa  luvo;s0 2trxo nu4lpeemfvtls) rur(r ;o4ape  o3iltfaDrl(mp;u0 rxoifcto1omD livs;s  rtoxr io4al emfes sf rta(rp;t0tetoioeilt a um( p;u0areoxrcoadfa rlueslt0 exr(r oy4ol nlncsa( arumum nt0olto o3ilsfa uluvs;t) eermf3iydlat ln sls)s2toio io4lpee ncslt)arum(ro;u4aee iociasfaDemuvonu0alxoxfcootlpD ai i;t0 exoir3oo4opee feias sruaurpou0opt mietadlsDrmu pn(0alxrxf iadopt ln i;()setoirpoo4lleelnvt t aDtaxr ;u4tetoifctltla2uln o u0teenxocta1laD auei;t0s2xr(r3ny1lpenmnvsat a2taxr ot0aptnmoetadls ulu o u4 exoio ta1oaDrli sl(0trurio3oy4oltnmfci (f rtau ono0apenmiciyt a2eauvsn(4 exoioctadlat lues;t s2ur(r nu4lp n fvt (fa2uax pou1ope  fciyt sDum(vo u0alxoio3oodop  lnvi s trxoio nydopt micias artau pot4opx mfeild s ul( o;u4aexnmocootfpteaieolt)teuoxm oy1ope  nvil( a2rrxro;u0aleoio3tlsfs ean pnu4alxomrciytom   nvi;s0 ruo(o3nodal emnvil()a2tm(m ;u0oltniictlt m2rl(vs u4texrxocoytfpDrlneo s)trtrxr ou4ol   fciasfs2umxrp;t1tpeomfeils s2uan pnu)tlxrio oy1lmDelivs (0trurxr iu1ap   ivsasf rra(  ou0tlx mocild s rl( snt)altnmf3oytfp  li s;t t2trirpno1lmenlictl( srtaur nu0olto ietydfm em(mo;u)trenircoy1fatrluesls)teurxm oy4amee fetl(farum(mp;t1altoiociydlsDemuvs u0alxnxf oa1fm   ueolt)seuoxo no4alen fvia( arra(r nt0opxniicias m2ulnms (4areomr3iodoat lnvo s0setoimpou4lme lnes sf 2uau ont1apx ioeildla2eaums t) rxoxr iy1opteai i t)trur(m nudapt  fcta( srraum no1tex moeiytla2rln pnu) eerif3io1lmt  n i (0 2xo(o3iydoptnlnei t) 2umumpou1aetnmieiltfsDrmnmo;(0 etrio ty1fmDraies t teurxm iy1ope mfviatf rumxm ou4tpto ictlsla2ea(vs t0alerxo todfmDrauvs ()sruoxopoy4ame  ncslt)arurxroou0apx io3iydlm2ulu s () rxnif tytom eaivi t) 2tr(m3oydolte ivias  2tm(  nu4open ociatla2ranvp;t) exnioctotoa e uvo;t truo(mpnu1op nlfct tfsDrrx o;o1aeen ictas aDrlums u4aeenmo3iytlmD lueslt) exoim3oo4omte ivi t)arrmx ono1alt mictydfaDumn o t4 eerir oo1fmD anvo;(0 2trxmpno4opte fviatf 2trurpnt0apxo octad a2emn s (0 renxf3iadlpD an ol()trur(o iydllt mieta()aDtmxro;t1teto f3tasfs2eauvsnt4artrxf oo1fmDelu sls0trurxrpiu4open iet t  rrauront1openmo3tls m rmuvsnu4 leoif3ia1faDr ivo s0 eum(m nudalenlfvsl(  rrmu pot0ole mf3tatfa2ul(monu4aexniocoatopDrlueo;t0 rxrio3oudlmen icsltfaDraum oo4tpeomfetls mDumuvp;(4artnxo tadfp   u ilt)t2uriopiodal e ici t)a2tm( pot1tlxnifetltls2ulu pnt)artnmociatla r iei s srxoir io4om nmfci ()a2tm(mpou4oeto oetad m umnms u) reoxo oytfaD aneil()s2xrxr nu1amt lnctltf Drm(m no0olt mocias sDrl(mp;u0 eeoir3oodfat auvsls0trurxm oodomen nvsls  rrmu pnu0aetn feiysla uau sn()tlxnxocto1fpDr ueolt)s2urxo nodame  nvt t)a2rmu o;u4aexo ociasla2ra(mp t)texomr3oodop rlivils0tetmio no1ol n ietls)aruax poo4altoiieilsla um(mon()texomo3oytlpDeauvo ()srurxrpno4llee nvt t) 2tmx o;t0opxoioetatfsDeanmsnu)arxrmo3oy1lm eau i t)srum(mpoo4omeelivtltfsrrruront1aeeomoeiasfs2emu o;(4alxomo oy1omtr ieo;s0 2tm(r3iodolt  ict t arurum ;t4altoii3iad a2uauvo u0 eenxo oadopDeau o;(  etmiopoy1lm emfct t)sDrm(moou0oexo fetadls2rmu snu) eermo iydop rauvs s t2tmxopoydlmtelnciatfa2ur(m nt4alxo octldlsDea( p u0 rtomf oa1oaDean i;t)s2tmxo oy4apte neiatfsrumurp;t0texo o3tldlmDeln p u0 eerxrctotoa elueo s  2urxo iodlpe  ies sfs2ua(mp;o0aee  ieils s2rauvo;t4trtoxo3oo1oa rau ol()s2to(o iu1ll   fvs tf Drmu o;u0tlxomo3tldfm2elnms ()aexomoctytlmD auvs s srtr(o3iu4aleemnvi sfa2umump;u0ape  ocildfsDul(vo;t0aeenxrcoo1opte n o;s0s2xrio iudole livs (faDrmxmo;t1tex mieiysfm elnmsn() ltnxr iytfaD aieols  2xrirpiu1lleemfeiatfartm( p;u0opxo i3ils a2ranvs u4alerxr3ta1lat anvo t) rum(m iu1lm nlfeiltfa2ua(mont4aetomo3tytlsDea(vs t4teeoxr3oatlmDeau i s truoim3io1om n iesasfsDuaxm ;t0ole  f3tldfa rmn ont0 eenmocoytop eaiei;t trtmxopnodlp e feils) Dtr(m ot4apx ii3iat a2elnvp (4aetoirciatopD lneslt srxoxr iudlp nmnci s)sDtaxm ;o4tptn i3ildlmDumuvs;()aeenxr totoa ranvs ( t2umxo oo1ameemnvi tfsDtrump;o4alt io3iltfs2uauvo;t0 rtnxo iadlmDrlivi s)truoxopno4ol elictasfaDtr( o;u4aet ifctltlm uaump;u)aetnxrciytlm rln ol(0t2urxm oy4al  lfetas) 2rrxrpnu4tlt mf3tydlm2umuvo t0tltrir oo1omtelueo;( s2tr(m3iydameemfvt t  2umu  nt4oet  ocilt aDel( on()tlxomr iodlmt  uei ()s2xr(mpoy1om n nei s)s2rmxr ;u4olen ieiatfsDranmo u0treomociatlmtraieilt0 eurxo iodapee nesat) Durx oou4opx mo3tysfm2um(ms;(4altnxf iadlptr ues;s teumiopoy1ol   iei ( arrmxm ot1aeeo oeiadlm rlumsnt0 lxnmfcootlaD  nvo;t) eurirpny1lltemnciat)s2trxrp;u4apxo o3iatlaDel(vo u0 ltrxf3ia1lm eai ol()seuo(opiudomte fetlt)sDtm( pnu4oltnioeiys aDulnvs (4tlxrir3totom  au s s0sexmxo3oo1lltn nes ()a2uaxr no4ape ii3tas a ulu o ()trenmr tatfpDe ies;t) exo(rpiodaleelfciatfa2tax o;t4olt mociad m2emu o t0arenmfciytlaD  ieilt) etr(mpny1altn ictl()srraxm nt1tltnmf3iytla rl(vsnt4 eenif3ootla e n ols s2xrxm iudom n iesl()a2taumono0tetnmictydlaDuanmon(4 lxrmrctatopteaivo s)t2trio oodamee fvtls  rrrur nu1tpx ii3ils s emu p;u4 ltoxfciatfpDrlu ils0s2toxrpnodaltelivi sfsDraump;u1aex mieiatlmDrl(ms u4treoxfctatomtr nvsls)texoio io4lpt lfvsas  ruax pno4tlx moeiadfaDuauvsn(4altomfciytlmDraues (  etm(mpiudap   ivi sfsDuauro;u0texomociat sDel( s () etomo3oa1opteau il( srxmim ny1lpeelnvslt  rrmx o;o0apx mociad a ua(vont4aeeoxo3oodlm eln i;s0s2xrxr nydlp   fcs (fsrtauro;u1oet miciad s rlump;u4 lerxf3oy1faDeau s s0trxoxr3oo1apenmivs (farrmumont0tlxn f3ild s umuvs;(0 exrxo3io1lptr nesl( s2xrim3oudlltelnei t  rum(rpnt1aeenifeiysfa2el( s t4 leoxfcoa1lpteluesl(0s2xrxm iy1omenmfesat aDtaxroot0aptomfetadfmDel(ms u4 eenmr to1om elnvsl()setrio3nodlme  fvi s) 2rmxmonu0oetniieiadfm elu o u4 eerio tadop r n ol(0s2tmxm nydamenmieiatfsrumu o;o0aleomociydfs elnvsnu)teeoxf3ta1omte uvs;(  rxoxopnu1lm   iciatfa2umxm ;u1apxo f3iltfm2ul(vo u0 exoif3io1om rauvolt)setmxr3nodalt  ncia( aDurxmonu0oeeniocildfm umnvs;t)aetomo to1oat  u s t0 exoxopou1ape  feslt sDtru  ou1alen oeiytfm um( p;(4tlxnioctotfpDeluvilt0srxr(rpoo4omt mivtat)sDrm( p;t0oeeo icils mDuln pn() rxrmociatfp e n o;t)s2to(m iy1ll n feilt)sDtr(  nt4apxomociatls2rm(vo;()aexoiociatfmD  i s t) rurim iu4amenmnvias)arta(  ot4tpxomoctldlm ua(vp (4 rxoir3ia1oa e uvi;(0s2umxm3no1ole mivilsfsDuru o;o0oetnmi3ilsfmDelu p;u)altnio iadomD  nvo;t0 rxoxopou1lltemics sfsruax  no4opxo oeilslm2emums ()texrmo oy1omt aues t) 2ur(r iy4amt lfeiltfsDurxrpnt1oeeo ociytfs2ua( p;(4aleomf3oo1omt  n s;(0seto(opnydap  lfei ()sDra( pot4aee iieiltla2uau o;u0trxoir3oydlm  lu il()s2uo(r3oodoltn nesltfa2tmx onu0alx moeiltla2rl(mo (0 rtnir io1lm ranvi t trtmirpoo1ap   nctas  rumx  nu1ale iieiydfm2emu o;(0trtnmr iodfm r nvo;t0sexm(r3no1om   ietls) ruru ono0apen o3iatla eanvp t) ltniociodfaDrlnvs s)tetoirpnu1lpt lfci sfsDrrxr nu4oeeo f3iadlm2em(mp u0texoxrcoytopD aueil() 2uo(rpiudom emnet s artrx oou4aee mi3iatfm2uanmo;t0aeeomr oodfaD luvs s t2xrimpiu4lp  miet t)arraxr no0aetomietatfs2rl(vo u0 leoirciatfatrliei t) 2xrim3iydapeelfviatf 2tm(m ot4apx moetatls2el(vont) rxnmfciydfpDr u s ( srurxr iodomtn nei t  2rax oou1tptnmfciatls umums;t)tetoio totfaDe i o;s trum(rpnydlm n fvtlsf rtr(mooo1apxo f3tltfa raump t4aexnmfcoydlmDrln o t)setoio oodome mfei sfs2ua( pnt1tle if3ilslm umuvsnu)trtnmr oodopDeaues;(0s2umxopio1lme  netltfa2taumoot0aexn ocilslm emu s;u)aexoxo3oa1laD  uei;(0trtrim ny1lp emneiatfs2uax ono0tlxnioctlslaDrlu o t4 etoxf3iydfp eanvol() exmim ou4ol  lneils)s2tmumonu1alxn feild s2ulnvo;(0tlxnmr3io1fpD  n i t  2umir nu4omte nciat) Dua(r ou4oexnmo3tatls2ul(vo;t0alxrir oatlm e i ilt  rxmxopiu1lmenlfei tfs2umx  ;t4aeeniiciyd sDelnvs t)trtnmr ootlptelnvi;s s2xmim io4opeemncslt a2rm(m ;t4tet  ieiys m2emn snu4aleomr iadopDeanvo () rtr(r3iy1opt  nci s a2tau pno1aex if3iysfm eaumonu0 etrio3oytla  li i s sruo(o nydal e fvils)a2rauronu4oex mf3iasfmDuan snu4teenmo io1omt luvilt0trurir oo1al nlfvi (f 2rrxr no1oet ioeiaslm rm(ms;u4alxrxf3oo1lpD luvo;t trxmxmpoudame mivtls a2umxmont1oeeniieiaslm2eaump u4aetrxr todoaD aivo s)texrxm3iudape liet t srraumpot4oeenmf3tad s uanvo (0tetnxo ia1omtrlu ol(0trxo(rpny4am  livt t)aDtrumoou1alen fciyt a rlums t) rxrmf3oatlp  ai il( s2uoxo iu1lme lnvi t) rurxr oo4oeen ociad a2um(vsn(0artrxfcoy1lmDe nei s teumimpno1amt mfeias)artmxmp;o4opxn o3ilslm2ulnmp;() lenmo oo1lpt anvo;(0 rur(opoodaptn nvils  rtm(r nu1opx mf3tydla rl(mpn()arerir oytlatraueo (0tetoxopou1omt lfcils)srumurpot1oleoiietld s elu o u4tlxrio todlm rlivo;( t2xoimpnodope lnvs (fa2ra( onu4optoif3ilt a2emnvpn(0 rerxf iadlate u s;s0 rxmxr oo1aptn ieiat)s2umu  ;t1tlen o3iat a2rlnms u)trtomf to1laDeau ilt0tetrim3oo4ame lfesas srrmurpot4olen iciasfm umump () lxoif3iytfatraivilt0trumim iydam  livsl(fsDrm(m ;u1tpen ieiys a ra(vs;t)aeermo3todopt aivils s2umim oudlpe lfeiat)sDraxrpou4opt moctldlsDel(vs t0alxnircta1oa   ueol(  2toirpoydop emicsas sDtrurpou4tetoii3ild m2el(mpnt4artniocootfpDrlneo t  2tr(m oy1lle mici sf Dtm(rpnt1tlxomoeildla2umumo t)tlxoxocoo1fm rli slt  exrimpiodapenmieil(fs2ur(  ou1alxnmf3ild a rmnvp t0artrmr iotlp r ivi t s2um(m3oo1al  mfvsls s2rmxrono0alt  feils mDranvs t)alxnxr3oy1lp eluvs;t  rurxo nu4llenmfes (fa2uau p;t0olx  oeiytfsDrmumonu0 rxrxr3iodfm r nvi (0s2xo(rpoy1ap elictas)a2rrur no4tee ioeiyd aDuan pnu0trxrifcoadfmt luvs;(0s2tmim oy1llenmnci tfarurx p;t0alt mi3iydfaDra(mp;t) rtnmoctadfatr neo;t  rxoio ny4lp  lnvtlsfa2rrx o;o1tlx mietadlaDrl(vp;u4treoxr3oydfpD aiei;t0seurir3io4omtemies sfarrmxm ;o0alt  i3iydfaDrmn p u)teenmo io1op raneo;(0trtmirpny1omtn ivia()sDra(  oo1alt ifciltla2umuvp;u0trtomocoodlm rlu s ()s2trirpou1lle lfvt s sDra(m ;o4optn f3iyd m2eln o;u0alenxf to1fpD luvs t) rxm(o oydap   fcsatf Dtau p;o4tlxnmo3tltlmDua( o;t0teeomf oatoaD lnei;s0 2xoxmpny4lpeelfvsas)a2rm(monu4apxnmo3tydfa2rmums (0aetoif3iotlmDeaivi;s)t2uoir oo4olte nvs (fsDumumoou0opeoiietasls umumsn(4 etoio oadfp  li o () euo(o3ny1lpte icsas  Drm( p;t0tlto icildfmDemnmsn()artnxo oytopt  nvi;t)s2tm(opio1ap   fes ( s2ur(mpnu0aet iociltlm2eluvpnt4teerxo3ootlaDrli i s) rto(m3nu4olee ncs t sDtmx o;o0tptn oetltfa2ea( o t0tltnxr oydlp  aivs;s0t2to(r3iu4ll elietlt a2rr(moot0apxn f3tat aDelnvpnt)aetnmf ty1fm rlieils)seurim3oodom  mnes t sDrmum ou4tpxnmfciytfsDea(mpnt) leoxo3iy1laDeauei;s  2urir no4lltnlici tfsDumump;t0opto fciysfmDemu pnu4 exnifctydlp eli o;t0setm(r ou1ale mfvi ()artmu onu1aex  feiat sDeanmo (0aetrmr ta1lmDe neslt seumirpio4ll emivi sf rurxm nt1tpto i3iat s rl(msnu4 rxrmoctotom  lueilt)trtrxm3nu1opt mfet tfsDtmxrpnu1oetomfeiltfa ranmp u4 ltrmo3iadfa r uvo;t)srto(mpnodlpee icia( aDrr(r oo4optoifetaslsDra(vont0 lxoxo3io1faD  u il(0t2xm(r3iudap nliesa(  rta( pnu1alxo oetyd a2rauvs (0tltrio3totfp r ieols  rumxm no1ope mfvi s) Drr(mo;u0olx iictlsla2eau s;(4tetoxr3oydfmteaiei t0trtm(r3oo4lpt lfcs t  2trur no1tex iociadfa2rmump;u4teermo io1lmD lueo;()trurimpny4lpenmictlt) 2rmur ou4tlx mfcilslsDea( sn()altoif3ty1fat  uvs (0seur(mpio4ome  ieslsf Dum(moot0tet ifeiydfm elnmo;u4 etomr3iytfpt aiesls)s2toxrpio1am nmneil(fs2raxront1aexnmf3iyd sDemums t4 exnio tydfmtelu ils t2trimpoo1am n ncsltfaDrruroou4opt iietldfm rl(vo;t0 eerxf oodlm   uei s)teuoxo iu1llt lnei t srtaxr ot1aeto ietytfa2uanmpn(0artrmf ia1lm rluei t0 etmio ny1lmenlnvt ( s2urx pno0aee  o3ilslmDel(vp (4teerxf3oodfpDelu olt)s2tm(opiu4al  miesas) Dumumpoo0oetoifctys sDrmuvsn(4arenio io1om eanes s0 2uoiopoodameelivil(f Dumx  ;t0altnmoeiasfmDelnvo;t0aeenxo3ta1faD auvils trtmir ny4ap  lfetls aDtmu pnu4ole  o3iad mDem( sn(0aetnirctytfmDeln s;t0sexo(r3oy1op   ieia( s2tax o;o0oeto oeiat aDea(vp;u4alxnxo oytfmt  ivsls trxrxr3iodol n fetlt) rrrurpot4oltniiciaslmDeanms;t0tlxnmr oodoatr iei;( texmim nydapeelfetls)aDuaum ;t4opeomoeiatfmDrmu on(0 etnir3oadlmD  n i;( srxrir nodalte nciatfs2tm( o;t0tex iieiytla2uaums u)texrif3oodfatr nei s  exm(r3io4am emics t)srur( onu4oexnmfctadla2ulnvpn(0 etnio ty1faDr n il()srtoio io4llt mnctas)sDur( ooo1ape ii3iltls ean s t0aetrir3totfatrau s s0teuoxm3oy1ll   net t)arur(r ot4tpxnmoeiydfm2em( ont0altriociy1lpt lu s;t srur(o iudll nmnvias)aDtrx  no4aptnmi3tat sDrm(mp u0texrio3oy1omtraneil(0 2uoim3ny4ap  livt tf 2tmumpou4tpx  f3ildla2ra(mp (4tlenifctatfaDeli i s0 2xr(opnudamt  ictasfsrraxm ot4aleoiictyd a umump;u0tltrio3oo1opt ln sl( t2xriopnudlleelnvi tfa2taumont0texoioetytls2ea(vp (4trenxoctydlaDrlnvol(0t2uo(opny4om   ncil() rra(root1ole  f3iytlaDrmu s;u0trtrxrciodomD aivolt texrxmpoydlm nmfvias aDtruront0tee moctldlmDrau o;t0trtrmr io1lmt lueo;s  2toiopno1om elics tfartrxm nt1olen oeias sDrlnmsnu4trxrxr tatla eln slt)sexo(m iy1alenmicslsfa2tau o;o1tptoii3ilsfmDra( pnu4altomfcia1op   i i t0 2xo(m iy1amen ivsltfaDta( o;o4ope  oeiysfs2rmumo u0 rtnmf3tydlp   ivs s sexmxrpoudol emfvs sfs2umum ot0opxo oeiltlmDemnvonu0 lxrif3iatfmDr iei (0 2trxr3iu1op  livs t  2urumpoo4aex  icilsfsDelumo;u0aetnmocoatlmD  n i s)s2xoirpnu1apt lfet () Dtmxrpou1aex mo3ildla2ranms;u)tlenxfciotlmt liei;t)t2xmirpio4al nmies ( a2trxmont0olxnio3iasfs ul( p;u4 reoir3ta1la e u i;s)t2um(mpnu4lp   ncils) rurur ;o0tpxoiociaslm2umumo (4tlxoxf3tatlp  au sl( trxr(r iy1lmee nvi s  2tr(rp;o1tetoiieiad a em(mp (0 ltrxrcoydfa rlueil(0s2tmirpno1opeelnetlt)s2tmxmp;u4olenio3tyt aDrm(vsn() renir3ta1op r nvo;(0s2xo(o oudlp  mieias) Duru oot1opt miciys sDem(msnu0alerxrctytopD lnvols) rxr(o no4lp nmfesas)sDrmump;o0olt  feils s2em(vsnt)teenmf3tatoatrauvslt  ruoim3oudolt  fetl(faDtmx p;t1teenif3iltlsDul( snt)arerxocoadfm rauei;t0t2urxopny1amenmnetlsfartrxrpou1apx ii3iasfm2emnvs;u4artnmocty1omtrli i s s2xm(rpiydllee ics sf Duau oot0tpx  oeiysfm emnvo (0aetomr3oadopDr uvi;s0trurim iu1aleemfvt ( srur( ooo4oltoioeild a2rlnvs u)texoxr3oadlpte neilt0trurir3oodoltemfetlt s2ta(mo;t4altnio3tyd s2elums;()tlxrmr ia1la   nvi;t t2umirpio4lpee fes t)s2ra(mo;u4oltomf3iadlm eau p u0artomo oytla e nvs;t0teto(o io1lpte neil() 2rm( ooo1aexnifctatfm2uauvpnu0altnmr3oy1laDe n i;s)s2tr(r iy1lmeemiei t)sDua(r ;u4oltnmociys sDemuvs;u)altrio iadop r nvolt sruoim oy1aptn nvtatf rurxroot0tet ioctysfsDrau p t0 rxnmo io1faDeanes;s  etmxr3iydamenmics s)sDrax poo0opt ii3iytfa rmnms;u4altoxf oy1lp  livi;s)seuoim3nudameemfetas)a2tm(m nu1tlt  fciydlm elu s;u0aeermo3to1lateanvo;t)seumxrpiodlmtn iei (fa2tr( o;u4oee  feils a2rm(mo;u4tlxoxo3todfpD luvo (0t2uoxmpnudole mfetls  Draur ;t4apt moctydfmDulumsnu)tetoifcta1omD  nvil(  etr(r nodlmt mfvsatfaDtrur no1teeomietld a uln s u4 exnif3todla   ivsls)srxmiopnydll n fesat)aDrax oot4tpxoii3iysfmDean on(0aeerxrciadfaD  uvilt0s2tmimpoydolt lnct s)aDtrxmpot1tetn f3tld a2ulu p (0 eenmr iytopteanvo;( s2trxr nodalee nvsa()s2tmxmo;u1tle  ieiasfs umnvp (4 renif3to1omt lnvi ( t2xoxm3no4lle lfeil(fsDrm(r ou0aptoifciatlmDea( on() rtrmf3iydfa rauvi;( trtm(mpnudoptnlivil(  Dra( onu1tle  i3tadla2uluvp;()aexrmf3tytfm  livilt0srtoxr3oy4olenlnesls)aDtrxrpoo1tptomf3tydfaDul( o u0trtomf iadom raieo;t)t2uoxm3io1opte nvsas  2urx o;t0openmieiysls2rauvsnu4 rtoirctadomtelieil( teuoim3oudlptnlncsl(f 2tr(r ou1tex  o3tadlsDra(vonu4trxomrcia1fate ues s)srurim ou4opte nesatfartrum ;o1aptnmfetat a elnvon()trxrmo iatomDraneo;s0 etm(o oo4ome lncilsf 2tm(r oo1ope ioetydfm2ra(mo;t4aeerioctydlm   i ils) 2xoir oydlm elict t aDrmxroot1aptnmo3iydla rmnms;()aeerxo3todomDeau i s)srxo(o ny4am  lfvtlsfsDrr(r ou4olxomoeilsls rl(mo t0tlxrmocoatfmte nvo;s setr(o3ou1al emnciat a2trum ;u4opto fetlt m ra(vpnt0tltnxr3ty1oa  ai o;s0seum(r iudomtelict tfsDtmumoot0aleoiiciatfs em(ms t0altoir ta1fp e nes;t) 2tr(mpio4apee fvilsfaDrmu pot0oetnmf3tytfm um(mon(0aexnif oadlm eaivo;( s2xrimpoudap n fvi () Drrxm ot0tetoiietls mDra(vo u0 lerxr3ootlaD lu s;t) rtmim oy1lpeelicia(fsruaum ;u4apt mo3iyslm2umumo t4aetoiocootoa   ieo t0t2umio nu1op elfcils  rtr( pou1tle  feilslm uan pnu)tlxrmf3ta1oaDe ieilt srtrio3iy1om  livsat)arurxrp;u4tpxoif3tldlm uauvp u) exomo iodomDeluei () rtrxr nydom nlivsas sDtaur nt0alxn oeildlm elums (0 exnxo3ta1fa e neils seum(mpoy1lpen ivt s) Drr(m ot1texomieiat a uaump (0arxrxo iydlpteauei;s)s2xrxm nydlpe lici ( arrau  no0tlt if3iytlmDeau s (4 ltoir3iydfpt lieslt)trxoiopiydom   feiltfa2uru o;o4ole  o3iytlsDuan s;()trtnif oo1lm  luvo t)srur(o iu4apt livi (farraumpoo4apx iociyt s rlu on(0aetrirctatfpDraivi t)trum(o iy1ap n icia( srrmu p;t0aet  o3iasfm rmn ont4texnmr3oa1fptrau s;(0 eurim3nydomen ivi s  2urx  ;t1oetoiieias m ea( pn(4 rtrxociy1fmDrauvs;t trumxm3nudape  ivsl(  rur(  oo4opx  feiyslm eanmo;t4 reoio3tadlp   ieo;s0 rurxm nu1lpee fvtl(  2rr(ro;o4aptomocildfmDumu sn()aeenxr3iytfa  au ol( trto(m3iodop  mfesat s2tr(  no4tpe iieiytlm rm(vpnt0arenxrciytoateanvi;(0srurxopnodllenlncs ()s2ua( pno0oetomoctldfa2elu p (4 ltomo tatomtr nvs t t2tm(mpiudap   fes tfsDurx pou1tptomiciadfaDuan onu4 etrmf ty1oaDraiei s srur(opiodol   nes () rrmum oo4tpxniocild sDea(mp (0tltrxrcoo1fmDran s t0 2xm(r3oodom elnviltfarrmu pno4olenmfeils s2el(vsn() exomrcoytlpD lieil( setrxo oudol n ictat  Duaxr oo0oexn f3iys s rl( s () etnmr3ia1la raieilt)sruoxopiy1ap nlnvias srrrx pou4tex mietlsla el( pn(4texrmf oy1oaDe ueo;t)t2urxm ou4amt  fesas a2trurp;o1oeeo fctat m emu ont4tetrmfcootfatr ivi t)seur(o iu1optnlfes tf 2rm(rpnu4opx mieiat s eanvo t0 rxnirciydomtr ueslt)seurxr ou1ope mieiat)a2tm(mo;o0opeoioeiat aDeluvpnt0alermrcty1lateluvi s t2xo(opoy4lpe mnci t)srtmu  ou0tpe  f3ildlm ulumo t4tlxrif tadopD lueol()sexoiopnodlpee nctl(f 2rm(moou1tpxn o3tadlaDulu o (4 ltnioctydlpt auvo;t0setoxo3oo4altelivi s)sDrm(r ;u0tltnmfetldfaDua(vs (4teerir 
\ No newline at end of file
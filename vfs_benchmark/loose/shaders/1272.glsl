@@ -0,0 +1 @@
+u s;(0s2tr(o3iodaptnlietl( s2rrxro;u0apxnmictyd m umn o;(0 etoio3ootlp eai sl(  ruo(o nodlmen nci tfarrmx ono1alx  ietldfm2ean o;() exnif tydfaD  ivo;t0 2urimpou4lle mnetlt)srraurono0tlx  i3iasfa uanmo;(0arenio tatoa rli i;()sruo(o no4amtnlivia()a2trump;o4alt ifciysla rmn snt0 ltomf iodlaDrlnvils0trumiopnydomenmnctltf rra(m nu0tpe ioetydla rlnmo t)texnmo3oodop elivs (  euoir3io1apteliviat)arra(moou4aptomo3iad s umuvsn(0 exrir3totom   uvo;t0teum(r oudoltnmictltfa2urumo;o0olx moeiysfaDulnms;(0alxrmo3iatfatrluvs s0trto(mpiodal elfvtl( sDtmump;o4oeeomoetas mDelu ont)aeerio tydlm rai o;(0trurir3iu1lm e ictltf rraum oo0olxomfciad m rmnms u0tetnio3ta1laDeai i;(0 exoio3iodopt liei s  rtaxrpoo1olen ietltfmDrmu ont4arxrmf iadfatrau slt0 ruo(r nydlltelieil( arrrur nt1altnmfctadfsDuln p (0tlxomfctodopDrlivslt0t2um(o ou4lm n icias  2umu  ou4oee mociysfm2el(vs;(4trenir3oatoptrli ol()srtoxm3iudope lnesas a2tmumoou1teenioeiadfsDelnms (0arenifcootfp   nvs;()trtrxr oo4lp  mfeil(f 2rr(mp;t1aeeomieiadfs2rl(vsnt4tlenmr oa1lpD li s;s trxo(r3no4ameelfct (farumu pno1optnif3tysls uaums u)tlxnircoytfmtraivi;s0trum(m3oy4oleemietls  rumuroou0oeen ictltfsDrmuvp u4trtrxr3iotlp  luvsls)trxoiopiudamtnmncta(fsDurxmooo4oet iieiaslm2rm(mpnu4arxoxo3io1fpDraivolt0srtrxr3no4omen ietlt arur(  ou1oet  fcilt s rmnvo;() leomfciydlat  ivo s s2tr(rpoy1ome  fvsat) 2ta(m nt0texoifeiydfm2ranvpnu4alxnio3oytoa rau sls0srxoxrpoodlp elnvt t)a2rr( ono1tpe ifeiasfaDrlump u0 ltrxfctydomteaues s)t2toxopoodamen iet ()artrxront4apeoioetas a2ea(msnu)arxrio3ty1fate uvil(0t2trxm nu4altemnesas srtaum ot0altomocildlm2rl( o;t4tlxomr iodom elu ols) 2trxr3oudll nlnvtltf Dum(mooo0aleomi3iatfsDuln s;(0trtrxr iytfaD aiei (0t2uoxo ou4lp  lnvias sDtau oot4tlxnmfeiysfs2rm( s;t4trxomo todfat lu s s)srumim3ny4ome  netas)aDraurp;u1oexn oeiltfsDrl(monu0trtnmo tydfmD aueol()t2urirpoydlm  mieia()srumxm ou0tltoif3iltfs elnms;(0 eerir3oa1oa rluvi t0t2xr(opou1lp   net (fa2taumpoo0tee if3iydfm rln o t)trxnio ta1om elivs t0srurxm no1apee nesatf 2rrx  oo4opt  o3ils s2uan on() rtnmo3oo1lm elivslt0 2toxr iy1apenmivt t) 2um(mo;o1tetoioeiyd m2ra(vp;()tetrio3oa1fmDr ues ()t2trxr oydal   neiat)s2umumo;u0tetomi3ils a2eaumo () exnmrciatfaDeauvo (  euoir io4alte fctlt)arumu pnu1aeenif3iys aDem(mpn() lxnifciytoa r uvol()s2tm(rpiu4optnlfesl() Dumxr no0tptoii3iytfmDem(mon(4aexoxr3ootlaDrlnvol(0srxmxo3oydal  mfctl( s2um(rpoo1altomoctasfsDeln s t0tlenxr iy1lpt  uvs t  2ur(o3oodamtnmicslt aDrmu p;o1apenmociat sDemnms;u4trenxf3ia1fpDean slt)setmiopno4omee fcias)s2rmxr no0oeenioeiytfm2eluvs;t)tleomoctydopD auvi s srxmirpoodlpe  fcil( a2rmxm ;t4tpx moctlt s ranvo (4tetrio ootfate ieo (0trtr(r3oodop  lfvsls s2taurpno0aleoifciys aDeanmsnu4aexoircoydfp   nvs;t)truo(opoy1ol elict s)a2ta(m nu4aptoio3iatls eluvsnu) lermocoo1lpDrlu sls)srto(rpny1lpt lfei t s2um(  nu4texoiieildls2rlnmsnt)tltomr oadfa  ai s;s trtoirpiudlpenmiesa( arua(rpnu4aetn fctydlaDea( s;t4 exoxf to1fmteaies ( sexmxmpno1op  mivsl(f 2tr(rono0tltn o3iaslm elumpnt4trerif3oy1fmt lneols) eur(opiodol nlfctls)artau  nt4olxniiciaslsDulu p;u)tlerio to1oatraneo (  rtmir no1llt mietlt)aDrmxm ;u0aee  f3iysla2eau s u) exrxo io1fmD lnvo ()truoxo3ny4op  lnvt tf rtmumpnt4aexoif3tldlaDulnvo;u)aetrmf3to1op  livs;( truoiopno4apt mfciatf Duaumo;u4aeeomfciydlm eauvp (0artnmrciodomt aneolt0 2tmir iy1olt lfvias)s2rru o;t4tlenmoeilsla2ul(vs u) rxrmo tydoptrluvslt0srxoxm3oodlp  mnvsa() rumx ont4aetoifeiadlm2rl(ms t0arerxo3oydopte ivo;t0texrirpoy4om   fcilt srumurono1opxnmo3iltfs emuvs;u)tlxniocta1fa  livolt  2xmirpnydape lneil( sDtmxrooo4tpxn fctyd a elnmo (4artomf3ia1omteaivo t  etrxr iu4alenmfvt sfs2ua(rpnu1apx mieiytla eaumpnt4tleoiocoydopt  iei;()t2xrxrpno4llt mnctlt)srur( o;u0opt ifeiatls rmuvo t0aexrif3tatlpD ln i t)texrxm iu1ol nmfvi tfaDtrxm no1aexoifeiytla umn o u) eerir ia1oaDe nvo t0s2xmiopoodlpte nvsl() 2rrxr ot4aeto fctadfsDum(ms ()arenxo iodfa elnei;t srxm(o no1lp   iesl(farrru ooo4ope mo3tys m2rau sn(4 ltnxo oydlaD lies t)s2xoxm ny4om   iciat)srumu poo0oeto i3ias a2uaumpn(0aeenircoo1lmtrln i s srumxo3oy1amt  fvtltf rtr(root0oex  fcild mDra(mpnu) lxoir totoptrai s;s)s2toxr iodopee ieil(fsDua(  nu0oeeomietadlaDulums;()tlxnmocoadfm e neols  rto(o3ou4lmt lfcias)arumxmont1alx ifciadls ulnvp;t4 lxnifcoydopt  uvi ()s2xrxr iu4om  lfvsl( a2umur ;t4aeen i3iltfs eaumon(4 lerio iotoptr n o;t)sexoim nu1op e ivtls aDraxmoou4oexoii3tlt m rmums t)tlxrxfciydfpte neo;t  2xm(mpio1ll n feslt aDtrurooo1olxnmi3tyt m ea( snt)aexrxf oadlmt au o t0t2xrio3iodlpt  fetls srrmx oou1teen i3iasfa2um( s;t) lxrmf3oo1faDeln slt)s2uoxr iodapeelietat sDraxmono4teeo iciytla2emuvs u4 exnifcta1opte nvo;t s2xoio3iydop elfciatfsDtmu ooo0tpe mieiyd a2umu onu) rtoxr oo1lm e neils srtrirpiydamtnmieta(faDtmurpno0tle mietls aDra( s t) rerif3ia1oaDrai s (0tetrim oudlpen nvi sf Dtrurono4oeeomi3tyd sDrauvo (4tlermf3iadlm  ai o;s)s2xrxr3oo4lp   fvsltfsrur(m ;o4opx moetyd a2rmumo (4alxomr iy1op   ivs;t0 euoxmpiy4ole micils  ruaxr ou0aptnioeiaslaDemnmsnt)arerio oo1om e u ol()t2ur(m iodoltnmncia()arra(r nt4oltomf3iyd s rm( pnu0 lenif3iodop eaivi;t sexoxopio1apt lfvsat  ruau oou4oeenmieiat mDeanmpnu4areoifcoydom  aivs;t  2xm(m ou4al elfet s a2ra(rpot1ape  iciat a2umumon()tleomrciytlmt auvslt)trtr(r iy1amt lieil()a2tmxm oo0apt mociad sDumu s t4tetrmr oy1omDeanei;(0 eumimpio1am  micsat) 2tm(rooo4oltoiiciltfmDul(vs;(4 lenmf3oa1omDeai ol(0t2xrim oudom  lict s)sDtruront4olto iciltfs uluvs;()arenio iytoa   nes;t)t2umxm3oudlltn ivt sf Drm(rpoo0tptn fetytls rl(mont)tlenmo oa1op ranei ()trxmim3nu1oltnmieiasf rraxrono0aexo f3iadfm rl(vp t0altrio oy1lmD  n s;s)s2tmio3io4op  lnvsat)aDtmu pnt4alxomfeias mDua(mo;(4aetrir3io1lpt lieo;t0s2trxm3ou4ope lfes s a2tm(m nt1oleo icild sDrau pn(0aetoxrcto1fate nvils0trxmio iu1lm  lici t srtrurp;o1apeo o3ild s2rl(mp u4 rtoio ia1latr n s;s0srxr(m iudameemieia(  2tm(mo;t1aee iieias aDuluvs;u0alenmo3ta1oaDraivi () rur(m3iudllen ncs (f 2tr(rpnu4aptn fetltlaDum(vs t4tlermf iodoaDrlnvo;(0t2xrxo oydopt  ivia()sDumx p;u0tptnio3tlsfs2ul(vont)aexrifcto1fa rauvslt) 2trim3iy4ll   nciasfsrua(mpou4apxn i3iatfs2ulu s;u4tlxnif todfm  aueil(0trxmxmpou1oltnlfvtl() Dur(  ;u4tetnifeilslm2ulnmo u0artrxfcoo1fa  au o;t  etoxr3iydoptnlfvsl()srraxr ;u4tetoiieiytfm eauvpnt4 leomo iytop e u ols srurir3iy1ape  iciltfaruru  no4aptoifeiytla eln s t4tltoxo3oa1fmteaues;s) rxrxmpnydomeeliet t)a2tm(  ;u1optnii3tasfmDrlums (4 etomr tydfa rlueo;()srxm(o no1olenlfes t) Dtr(mont1opt iieiaslmDrm( o u)trxrmf3iadfmD  u il(  euo(r3nudalt mncs t)a2rrx pno0oetnmoeildlsDrm( snt4 etoir3oatlat lueo ( seuoim3oodlmt lfvtlsfs2trurpou1optoiietasls2elu p t)trenif to1lm e ies;t tetr(r iu1al  mnctat sDum(rp;u1tlxn ocias sDuan p;u4 rtnmrcoatlaDr ueo t0s2xmxm3nu4al emies tf Drmxmpno0tlxo ocilsls2uln s;t) exomo3tytlmD ai s;t0t2um(o ny4alt  fviltfa2tmx  oo1oeeniictatfsDulnmpnu)treoir3to1lmDr ies;( s2ur(m ou4amt mnvtlt) rtmu  ot0olxo f3ild a rl(mp;u0tltrio oy1latrluvs;()seuoim3oudol nmneta() rtmxmont0aexoii3tytfsDulnms;t) eenif3iydlp r ieolt)t2toxo iu1optemiesltf 2uau o;o0alx mfciatfs2rmnvo;u0aetomocia1om ean ilt)t2xo(m3nodalee fcilt a2taxm ;t1apxoioeiysls2eanmp t4tltoif iotom ranvolt) rto(m3oy1ll n ivsas) Dua(m ;o0altomo3iyt aDem(ms t)trtrmr3oadop rai ol( t2xmio3no4llt mfvtasfaDrau  oo4aexo ociat sDranvs;(4altrio3totlm eai o;t)t2uoxmpno1al  lnei t aDrm(ronu0tlxo f3tls m em(von(4arxoir totfmD  n ils0 rtmiopiudlptnmfvia(  Dumxmo;t4optoifctad a rl(ms t0aexoxo oytopDrlu s;s teumxo nu4olee iciasf 2um(mono1oeenmi3tatls2uln s u) exoxr3iotomt  u o s)s2xoiopou4omt  nvia()s2rmxr ;u0tpenif3tldfm2eanmonu) eeoir3ia1lmt lieilt0 exoxrpnydlm emnvilt) rrr(  nu1tlt ifeiysfs rlumsnt) eenmrciadlp elies;s)seuoir oydolt  nvsl() rrm(rpnt1tpeomociat sDem( snu) eermf3totopD  iei (0s2xmio3iu1lltnlfct t sDuau pou1tlxn ictas a2rmnvs u4 rxoxf tydlp r u o;t) 2xo(r nodapt lneias  Dtr(ront1oltoii3ild s eau ont)trxnmo3oadfa rln o t teur(r3oo1lpenlicia(fsDra(moou0texomf3tysfsDelnvsn(0tlermo3iydfptraiesl(  2ur(rpnu4lmen nctlsfaDur( o;t4tpe ifetysls rluvs;(0 lxomo3iadlm rai s s0t2umxr3nydopeemicsa()srraxrp;t1oee iociasla uanmsnt0tetrmocto1lpDr ueols t2tmxm3nodll  mfvi ()s2taumo;u1tlx micias sDrm(von(0altrmr oa1fate nei;t0srtrio3nodalt lncslt)aDrru  ;t0tlt mfcildlsDrmump t4alxnir io1opte ies t srxm(m io1lleemfvsltfsDrm(rpot4teenmfctas s raumo;u4 eeomociodla  aneo s  2toxr oydoltnmnvs tfa2trx o;u4oexnif3ilslm em(mp t) rtrir3iadoa ranvs s trxoir nu4omeemivtlt  rumur oo0tpxniiciatlaDuluvo t0tetomr iydoateaueil(0texmxrpiy1ol n fei s) rurum ;o1aeeomfciaslm2ulumo (0trxnmfcta1fa e ivs (0s2urxr3iy1aleelnvsa(farumxr ot1tpen ietaslsDumn p t)aleomr3iadlmtrlies;t)teum(mpiodaltnlfesa( srrmump;t1opx  i3iyt m uanvpnu0 lerxocio1fmte n s;() euoxo3no4op elivslsfsrumu  nt0alxnioeiytfa eln sn(0tetoxrcta1faDean o s trxo(o oudalen iesat)s2rmumpno0oeen oetlsfs2umu o;t4tleoxf3io1lmDeaneo;() 2xm(mpnu1lpe lfvsl() Drau o;u0tptnmieiatlsDeln on(0 exrxr3iotlpDe nvsl(0s2umim3oydome lict (farumx ooo1tlenmi3iysfs elnvp;t4arenio ty1fpt auvo;( s2xrir io1lm  lnetl(fs2uaxrpnt0tet iieiyd m umn s u4teenmr ia1oaD au sl()srur(opoydam  miesltf rtmx  ;t1olxn oetyt mDuln o t0aexrio oo1op e ivs;()trxrir ny4lltnmivi t) 2urxmpot0aee mi3iytla ua( o;(4altnmf tadlatr uvs;s0texo(m no4alee ieias)arurxm nt1opeoifciytlmDua( pnu0aexoxociy1la eauvslt)trxoxmpiodamee fvtas a2tmur no0oleoifciadfs2em(vo u)texoir oytlmt ai s (0setrxm3ny1op nlfei s)srtax  no0olxomieiltls2elu o t) exrxoctotomDeau ols0setmimpnu4al n fesa(  rumump;u0olx iieiatls ul(vont)trenif3oytoate nvs s texm(rpny1amee fet tf Drmxmoou0oee mo3ildla2umn onu0texrir iatlmteanvs;t) 2toxopiy1lm elfcsas) 2rau poo0opto ietasfa2ul( snu4altomf oo1fp r n s s  2tm(o io1lpe  fvil( s2ua( oou0altn ociysfmDel(monu4tetoxo tatfaDrln i ( sexoxr3oydlpte ivt tf 2rrx o;t4alxomociydfs2elnmp (0teenxo3ta1oa eli ol(0srxrio ou4ol   fei (fs2uaumo;u0tlto i3tldla el(ms;t0alerir3iotfa eluei;s  rtrir3io4ll nlfvs ( srtmx p;o1olxn feiys m2emn pnu) lxnir3iadomD anvi t seuoir nu4llte ici t)arum(m oo0alxnii3ias sDrlumpn()aleomf3ta1fmD lnvols0s2uoir iu4am  lnes ()s2rr(r ot0ale  octadfm rmnmsnu4altoir iatlp   ueols  2xoir3iy1op emict sf rrmxmpnt0oetn ictys a eanmsn(0trtrifctadlp elieilt setmim3iy1lltn ivt tfsDua(mont0oeeo i3tys m uan s;u4altrio3oatlateau i t  rxrxrpiu1lp   ietl( a2rrx  ;u1tptomfeiat m2ea(vp (4trxrxf3ootlpt ai o s0seumim iodamen ivil( srrmxmpot1opeoifctldfmDumnmp t)tlenmo3iatfp elnes;t s2xoxr3ou4ap e ivtlsfaDtrurpou1aet  i3tys m rmn p;t0tltrxociydlm e u i t0t2um(opnu4optn nct s)sDrax  ;t4tpx  o3iltls2rmumpnt) etoio ootopte uvols) 2ur(r3oodom nlivtatf rumurpnt0tle  ieiltfm2ua( o;()trermo3io1fmtrlnvslt)tetmxopoo1ol e fesat aDrau o;o0oltoifetld mDuln pnu0tlxoir3ta1opDranvo;s  2toxrpoydlme mfvslt)a2um(mo;u1olxnii3tytlaDrm(mp u) rtrifcoydfmtr ivi;( srxmiopiu4alt mfvs (  rrruroot1aet iocilsfsDua(vp t0 rxnir3tydfpDeauvo;s)t2to(m oudal  miet s) rua(r oo4aetoio3tyd s eauvo u0altnmocta1faD livsl( tetrio3oo1lptnmiet t  rua(ro;o4ope mi3iadfm2ua( o;t4alenxocoodfm  anvi;()tetm(mpnudomee fvilt sDrau onu1tlxomf3iytfs2rmnvsnt0tlermf3iytlmD  i ols0seumiopnydomtn ncs (  2ta( oou1aexo ieiadfm rl( s u4alxriocio1oa eaueslt)tetrir3oy1ome lfcia( sDtrxmp;u0tltnmo3iltlm2eauvp t4aetrmo iadfmt  ieo;s)tetrio nydlpt  fvt () Dtm(mpno1aleomocilt s2rl(vp;(4tetnxr3tadopD  ieslt  rtrim3io4llen nvt t)s2raxm ;o4tetnii3ild sDra(vo;u0 ltomfctodlptraueil(0srtoxrpiy4amen fvsat)a2rau pnu0aetnifctytfs ua(vsnu0trxrxo3ta1om   u s;s teurir nu4lm e iet s)srrmx pno0tpeoio3tldlm2rln o t0arenirciodlmD ln s;s0sexo(r io1lp e nct (faDta( ono4opt  f3iyt m2um(vpnt4 etnxf3iy1lmte ivi () eumxm3ny1lle mfvsa() Dra(r nt4optoioeiysfa uln p t) eeomf tytlm rlueo s0 2uo(mpny4opt  ies t)aDum( pno0altoifeilt s ulumo;u) exrxrciadlatelivslt0 rxrir oy4lpt  icslt) rrmurp;t4opt ioetas mDrl(mo t)texoxo iy1op rlivilt)tetmim iy4apenlncsasfaruauronu4aetn f3iydls2rlnmo u0 exnir3oytlaD li o;(  2tr(opiudlpe lfvil(fs2uax pot0ope ifcilslaDrlu p u4 exrxfciytomt lu i;(0 2tmir io1lltemneias a2tm(mpnt0tlxn ictyd a2rmuvs;u)arxnio oo1om eaneo;s) rurir oy4am elnvsatfsrrm(m no4oet ifetytls em(msnt4aetoxfctodomDeluvol()sruoimpnydamte ietls  2rr(  oo1oltnif3iysls umuvsnu0 ltoxr3oy1omtr neilt t2urxo oudol nlicil() 2uaurooo4apt  f3tldlaDulumo;t0 eeomf3todfmDe uvs s)srtmir no1open fct ()artmxm oo4ale iietydlsDeaumont4 exnmocio1faDrai i;s  rxoxmpnydol e fei (f rta(ro;o1apt  iciasfsDem( s (4alenmo ia1opt ai ils0 euoxr nudape mivtl( s2raur ou4oexomfctasfm rmuvp;u4aleoio ta1fmD aiesls)s2urim3io4al nmfcil()s2trxm no0tpeoiociytfa2eanvo;(4 lenmr tadfat aivilt s2tr(rpoo4op e neil(  rumump;o1apxnmoeiys m uluvpn(4arxrxo3iy1om   iei;s) eum(o oo1aptemiei sf 2uaur ou4tlt iictadfsDul( pnu0 rtrmf tatfa elu o t t2xrim3oy4apt mfvtas  rrm(mo;o4teeo fetyt mDua(mp t)tetomfcty1lpDeanes t0t2uoxmpoy1aleemnciat) rrrxmpot1apt ifetydfmDranvo t4 rerxocta1fm r ues ( texrxopoo1om emnci sf rurxmpou4ape moeiasla2rl(vp u) lxrxr iatoa raues t0 2xoim3ou4am e neiatfsrtau poo4aeto f3tas a uanvp;u0 eerxo ty1lp e ueolt)srxmxm ny1apeemivslt)s2raur ;u0aptnii3iytlsDumn p u0 rtnxociodop ran sls s2xrim3iy4lpe lfcilt arraum nt0tlen fciad s um(vp;t0tltoxoctytfmDrli o;(0trxoxr3io4ap nmieils)srraxmpno0tpxnii3iys sDum(mp u4tlenxo3tadopD livo s)trxmxm oydoptnlfctlsf 2rmxm nt0tpxnmoeildlmDumu onu)tltnxr3oa1oat anes s)srtoirpou4op   ivi sfsrraum oo4aleo ietlsla rlnvp t4trtrif3ty1optr uvi;(0tetrxo3iudap nlict sfaDraurp;o1apxo ociys m ea(ms;()texrxf3oatla elneo;t  2xmxo ny4al  lnvia(  2um(moot0oex mfetyslaDrm( pn()texnxf3iytlaD anei;s  rxm(rpou1al emneia()artm(rpno1tleomociyt s2em(vo;() ltrxo totfpD  ies ( s2xrxm3oy1aleemfvi tfsrurxr ou0oex iocild sDeanvs u0treomr3iotlp rauesl( srto(o3ny1lpeelnvs sfs2trxm nt4apxoiiciasfa el(mp;t4tlxoio3iadlaD  iesl()trtrio3oy4ll e ivia( artm(rpnt4tleomfetld a um(ms t) eerir3iadfm  aivols s2uoim3ou4apteliet t) 2uaumpoo1alt mi3iasla2emu p () exrmo3tydfat aivi t trxmxo3iy1optnlfvsl(  rrmum nt4tet ifciat a ea( s;()altrif3ia1latrlnvs ( setoxr3oo1oltn ivsa( aDtau  ou4ole io3tatfsDumn s;(4 eeomo io1lpDrai o;t0 rtm(o3iy4ll   ieias)aruru  ot1apeniocils sDemnvp;t)trxrxocoatfmD luvs;t) rtmxmpio1ape  neia()aDrrxrp;t1aexn feiltfm2emu on(0arxrircoatfp rauesls0teuo(r ny4optn nvtasf ruru  ;t1olxnifciadfaDulnvs;u0aetoxf oatlp  ai o;s  2tmxmpiy1lp n nvil(  Dtrum ou1opx mfetat mDem(vo;(4 rxnxo3oytoate ies;t)seurxr3iodlpe mneils)a2rr(mpno4tetoifciytls el(vsn(0tltrxf iydlmt  nes;t  eurirpiydale miciat srta(m nu4ape  fciytlm elnvs;t0treomr3iadlaDraivilt) 2xrxm3ny1amtemiesltf Drrxr ;o1opeoio3iadfsDeauvs;(4 leoxf ty1late ivi s0 2urxopny1lpeelicsls srtmurp;u0tlxomiciat m2ra(ms u)tetoxf3iytoatrlivols)srxmxr oo1lmtn nctl(fsrrrurp;t4aet iieiadfa2ran p;t4aeenmo iytoaDe i s;s0s2xr(opio4lpte fet tfarra( ooo1tpeniiciltfa emnvonu) exrif ta1opDeaivs;t  2toxm nu4lmenmivsls srrmumpoo1tpxoifcils a2ul(vp;t0altomr3oatfptelnvi;(0t2xm(r io1ll n iei t)a2trxr ot4altnmieiatlm2rmn sn()texrmo3todlmDr ieils0trtmxopny1llt  ics s)s2rr(  ;u1tlt iociyslsDra(mp u0aexnif iytfm e n o ()srurir3io4om   ieta(f Durx pnu0oexo feiyt m2emumsnu0aeenxo tytfptrlu olt)trxrxo3iydapt mnctlt srrr( pot1apxnmieilslm rl(mp;u4altrifctytlmt  u s t0 2xmio3nu1olt  fcsl()sDurxrpnt0tpe moeild m rl(vpn(4alxrxo3oydlatrlueo t0texrxr3ny4am emfeias)aDraur ;u0optomociltfa rlumo t4alxnmr3io1latelnvi s)srxoio io1omeemfetls a2tm( o;u0tpe mi3ias m2ua(msn(0tleoxf3oodfp eau s ( t2umim3nydopen nvi (fa2umxroot1tpx  oeiytfs em(vp;t4teeomo3oa1opteaivs t0s2tmio3iy1lptnlieilt) rtmu pnu4tpeoio3tadla rlu s ()tltrif3oytlmt auvil(0 eurxr iu4omte ncta()s2ua( oot4oltn i3tat a elnvpn()trxoxr3iodfpDraivils srtoxr3nu4amenlfes tfa2rm(mo;u1oltnii3tat m emnvp u4arenxf oo1oa   u o;t0 rurim3ny4amt  iet s a2rru  ot1alenif3ildlmDea(vo (0teeoxr3oa1oa   nei s0sexoxo3iy1om n nvsl()a2ua(m oo1opt iociaslsDemn pnt4 lenxf to1la e ivs;t  exr(m no4ap elivsas  Drmu p;o4apx ioctld a2em(ms;t4teermocia1oateaneil() 2uoxm iudom n ivils  rrr( pnu0tptn f3iytlm rmump t0 lxnxo iatoaDrau sls0trtoir3oodole mfesas) Dtrxr ;o4teeomoeiadfs2ua(mo u0aetnmo3iydfp r ieo;s)sexr(rpio4ap   ivta()s2rmxmpnu0tltomfetad s2ua( o u) reomfciydfpD  ues;( truoxr3io1openmfeiat) 2tr(ro;t4oet if3iysla2ea(vonu)aetnif iy1lm rauvsl(0t2xmxrpnodlpt lnctat)artmur ;u0tlt mf3tasfaDraump t0 leomfcty1oaD  n sl()s2xrxm3ny4ale lnvi t) rta(mp;o4aeeo fctlslmDrluvs;()aexoxr ia1faDran s t) ruoxo nu4lp elfeta(faDuaxmp;o4texoiietasla2uan p t4aeeoir tytfa rln slt  rxrxmpnudale mfes s aDrax  ;o0tleo fciytlm2emuvsn(4trxnif oytoat  i s s0 rxrxopno4optemiesls) 2trurpno0aee mi3iytfmDem(mpnt4aeerif3iydomtrlivs s0trxmxm oy1omtelfvil()arra(m ;t0tptnif3iltlaDrln on(0 lxomo3iytoatrlueo;s  etoimpno4lpe  ncsl() rrax  no4alx  fciyd m ranvo;u) eermf oadfp elnvo s0srtoim iudolt liesat)s2uru p;t0tle  oeils m2ul(vo (0trxoif3iadla raneol() euoxo io4ap  miei s) 2trxm no0tpe  ictls aDumnms u0 exrxo3iatlptr i o (0srxriopou4lp  lieilsf rur( ono1tlxnii3tytfs emnmsnu4texnxr to1fpDelu o s0t2uo(m3ny4amenlnci t sDtax pno0opxnmicildfa uau s u)altnmocty1lm  luvslt0 rur(o nydolte iciasfarurxrpnt0opt  o3tasfaDua( p () etnxf tytoaDrau ils0tetmxmpnodlme  nes tfarur( poo1apx  i3iytlm2eau on() eeoio3ootla rlu sls s2trir3iydal n fcias)s2tr( pot1tlxnmfetatfsDrmums;(0trerxr3iy1lateanvi s0srxr(m ny4lp elnesatfsDumum nu1olt mfetydlmDem(mp u4teeoiocoadfaD ln s;(0 rumim no4altelics s)arrru  nu0alx iietytls2umuvo;t4tltrmr3to1lmD anvo;()setoxr3oo4aleemnvs s) Dum(moot0tpen o3tlslsDel(von()treoxo3tatoaD an s (0s2tr(mpiu4om emnciat a2tax pnu1tpt mi3ias a rl( pnt0 ltomo3iydlmDelu i;s)trxo(opiy4lpte ncsl( artau p;o0olx mfeilslmDem( p;t4tleomoctytfmteluvo () rur(m iy4lmeemfviat) 2tm( pnt1teen icild s raumo t) etoir oodla rauvi s trurim iydape livt ( sDrm(rp;u1aleoioeiyt m2el( p;t0tetnxocio1fm e u i t tetmxrpoydlme mfcslt) rum(mp;t0tpxniieiasls2ranvont0tleoio3iodoptr nvo;(0trto(opno4al e ivta() 2ua(  ;t0tetomfciltfa rl(vp;t)alenio todfm rli i t) 2xr(mpnu1lltnmfeia(f Dtm( o;t4tptoif3tatfs2ulnms;t) rerxf3oodfmD lieo;s0 2toio3oy4open nvta() rrrxrono0tpx if3iasfm ul(ms (0teenxr tadoa ranvsl(  2toio no4lpeemfvsa(  2ta(m oo4oex mf3tadfm2el( ont4 etrircoodfpD  u i;s0 rurxrpnu1lp nmnct s)sruaur nt1oeeoif3iys s2ua( snt0 lxomr totlpteau sls0seuoxmpoudame lfetat)arrrurono0olx  oeias m2elu p;t0trtrio3totfp  an o;s  ruo(rpoodape mnet t)aDtax  nu1tptnmfciytlm2ul( sn(4altnmociydlaDraneilt t2trir3no1op nlies sfa2rm(m ou1oeeoiieiltfm2ra(vsnu4aexoxocootoa eln slt)t2xmxo iu4lpe lieil(  2trum ;t0tpe ifcildfa umu p;u4trtnxo3io1omtran s s  rtm(o3no4ll   neilt)a2urx oot0aeeomictas s em(vo t)arenxrctytoaDraies t tetm(r3ny1optn ietatfaDuaum ot0teenmiciytla2rln p u) rxrmrctytoat aieils0trurio no4olenmics s)a2tr( o;u4olt moetatfaDrmnmp (0trxnmf3ty1lmtr u ol(0 2ur(m nu4olen ncils arrrxm nt1apxnif3iytfaDean o;u) rtrio oy1opDrlies;s) etoio iy4ame  nei t)srrm(rpnu4opeo fcias aDul(vs u) rtnmo3ootlmtelneols)t2xo(r nydol   fvias  2ur(mono0opx  f3tas a rmnvs u4alxomo3iotopDeaieo s trxmio ou4lp elfctlt aDtaxronu1oeeo f3ils sDra( s;u)tltoir3oytfp  aivo;(0 euoxo oodlle mfcia(fa2rmu p;u0tet moeilslsDemuvo () exoir tydfpD  ueo t t2uo(o3ny1lp  licsas a2raur no0aexo oeilt m2rm( pnu0artoifcto1lpD aies s s2um(o iy1lp  mfvtas aDtmxmp;o0tle mociydls2ea( snt)tlenmo iadlm eanes;()t2umirpnodomt mfetl(faDuru pnu1oet  f3tydlm ulumpn()texoio io1lmt  nvs s srtr(rpiodll nlieil(f Dum(mo;o0alx  fciadfs rauvo u0 eerxr3tatomDrai o;s seuoxr3iu4ol  micias srrmum ;o4tpenii3tlsfm ea(vs () renxo tadfatrluesls seto(o3oo4oltnmivtas) rua( pno0texoiieild s2em(mont4 etrif oydlm rln sl(0 2xr(r3nu4lpt mnes ( sDraxmont4teenmfeiasfa rluvsn(0teenif3totlp   n ils0 rurxm ny1olen nvs s sDrm(r ;o0tptoif3tatlsDrmump (4 rxrif ootlm  auei t)teur(o iudlm elieil(fa2rmx p;t0apeomieiyslaDem(ms;(4alxnio iydoptean s s0truo(opiy1amtn fetl(fsrrru  nu4aet  iciltlm2uaump;u) ltnmf ty1oa eanvo;()texoimpou1ll  mfeia(fa2rmum ot0teen fcildla ua(vo (4texnxr3io1opDr uvs;t0 rxrxopnudapt  icils)sDumx p;t1apen oeiltls umnmo;(0tleriociydfm elu sls) eumir no4op elietas)sDurxrpno1oetniieiatlmDeaumo;(4artrxo iytlmDeaueo;()t2tmxm oy4aptemnvtas) Dumurp;o1olenifciadla rmnvs (4tetrmo tytlmDelnvo;s) rur(r nodaptemics tf rta(rpno1oltn ociytfm2em(msn(0 rtomr3tadlpDraues;t  rtmxr3oo4omtn netatfaDra(mooo4ope mfeiadla eau onu)trtoxfcoydoaDrlnvolt  exrim3oo1omtemivtlt  Dur(  nu1tetniieilt mDumnms ()tlenxf3ta1omteluvo s0s2tm(m ou4op  mivs ()a2rm( pot4teenmoetys m2ul( s;()alxoxf oytlpDrai o;( s2trirpiudol  mictlsfaDtmxro;u4aptnio3iytfaDrmums;t4 eenxf3oy1oaDraneo t0srxmxr io1aptnlivtlt  rumxrp;u4oltoifctadfaDrauvsn(0 lermr todla  ln sl(  2xmxrpiu4altn icsatfa2um(r ;t4tptnii3ias m ua( o;t)altnirciadlatr u i;s  etoxm iudol emnes s  rurumont0tpt  ieiltla2rmumont)texoxo iotomte ivs t) rtr(r3oodlpeelncs s s2um(  ;t4tpt  i3iydls ea(von()alermr tytlp ranes ( t2tr(o3nu4amte fcs t) Dtr(rpot1olxoifetyslm2ranvo ()artrmo ia1fptelueo;t0 2tr(r3ny1lp nlfvt sf Dtau ont4opto ieilsls2eauvsnu4trxnmo ty1oaDeauvolt)s2xmim3iydoptn feias  rtrum ;o0ole mieiysfaDra( s u0 leomf oydfmDr uvs t0setmimpiy1oltelfvsat)aDtm(  no4olxn f3iaslm uan o u0tetrmr3tadopDrlieil(0 2uoirpnu1lpt lnet s srtr(rpot1tlt iictldfm emn s;u0texomociydoatrlneo;t s2tr(rpnu1opte ivtl(f Dumxr ;t0alt  o3ilt aDrm( sn(0 lerir3oydom   n o;()teuo(r3iu4opteliesatf Dtau ont1alt  icilsfa ul(mp t4tlxomo tydoatr ivi;s0 2umio nu4ol   fcils aruaxmo;t0oet mf3tys mDeluvo t0 lxomf3ia1oa elu s s0trxrio3ny4ap   nci sfsruru pnu4tpxnmo3tlsla emuvsn(0 eenmf3oa1latr ues t0 etmxrpnydale mivs t srtmurpnu0oex mfetyd aDelnmp ()tetrxf3ta1oa e neilt)t2um(r3oo4lm emnetas s2ur(mo;o4tpt if3iat aDulnvpn(0arxnxo oydfa eai i s)trtrxopoo1ll n nvia(  rta(rpnu0tet  feiad s ea(vpnu) exnifcoytfatran ilt0 ruoio3no4om elncs t  Dumxmpnu1opxnio3tlsfsDumn p;t)tltrio oa1optrlivs t)sexrimpoydlle lfcta()a2raumo;t0oee ii3iltfaDemu onu4arxnmr3ta1fatrai i;t  rxrxo nu4lp nlnvia( a2rrx  ;u4oeeoii3iadlaDea(vsnu0tltrxrcio1fptelieo (0 eto(rpou1al   ieiat  Duaxr ou4alx  oetldlm ra(mo u)alxnxo3ty1fptean i;s t2xmim nu4op e iesl(faDtrx  ou4tpxn feiadfa2rm(msnu) lerir tatlmt an sls0srtmxo3oydapen ies t s2uau pou0tle mfetlslm2umnvo;t)arxrmrcta1fpte uvs;s)seur(opiydlp elieia(fsrur(mont4opxomoeildla2ua(mo t)aeeoif iy1fatrlnvo t)t2urxr oodolee ivtatf 2raumont4tex mo3iyslm2rmumo;()tlxnxfciydoatelu il()tetm(o3iydomtemfvtls)sDumurpou4aeen oeiys a2uanmp (4trxoxr oy1fatrln s;( srum(mpnu1lp  mfviasfsrtr(mo;o0teenmfetldlm2ul(vo u4tleoiocoodlaDranvi;s0sruoim io4llte ncil( s2taxmo;u0oexomoctasls2umnmo;u0 etnxoctadoa rauei s0t2tmxo nu1ap   iviat) Durxmpou1tltoioeilslm emu p t0aeeoxociadfp e nei;s  2xrxr3oo4al nlietasfsDtr(  oo1tlenmoctad m2eluvpnt)tltrmf to1optraieilt srxmiopio4lm  mncsl(fsDtrumooo0opxoii3ils s emn snu) eeomo3oo1fpD livo;s t2tmimpou1lm elieslt sDum(mpoo0ape io3iydla rl(mont4tetoxo iydoa eaieo t sruoio no4lmenlfvt tf rumxr no4tex ii3iat m2rmu s (4 lerxfcootop e ies (0t2toxm no4llen ncsl() 2rr(ront4opt mfetydfm2rl(mp;()texnmrcoa1fatean sls)t2umxmpiy1am elnesa()aDrm(r ;o1tlenmoeiys a umnmo;u4tetomrcty1fatelu s s0trumxm3oy4lp nmfcsas sDrr(  nt4tlxnmo3ias a ul(mpnt0arxnxocta1fmDeli i t) rtmxo3oy1ll  mictatfs2tm(rp;o0tetoii3iytlm em(vont4texnxocia1opt luvilt)srtoxr nu4amt lfesls  Dumur no4aet if3tydls2rln s (4 lxrmo3oydla eau olt tetr(o ny4ap  lfetlsfarrmumo;u0olx mictyt s rln o t4 eerxr3todlm  an ils)srurio3iudom  mfesat srum(r ;u1tpenio3ils sDemu s;t4trerxrciadfm  ln sls)s2triopny1opte fet (farrrxronu1aleomfeiysfm2ulnvs;()tetnxo3iodfat au i;s teumim ou4lptnmics t) Draumpot0oet mi3iatlaDemnmo;t4 exoif totfp   uvi;( t2to(m3oydlpen fetat sDrm( pnt1apt  i3iat s2umn onu4 eermf oytfm eln ol()srxrxm no4apt mfcils s2umx  ot1altniietatlm em(mpnu4arxnmr oatla eaneslt0s2xr(m3nu4lmenmieils)aruaump;u4tpeo i3tydlaDum(ms t4 rtoiociotoatrlneil( srur(opou1lm  lnctlt sDtax onu1aleo ociyd sDumuvp t)trxrmr oo1fp elieilt)teumim3iydlm n iviatfsrta(rono1olxnifciadla rlnmon(4trtnxf oatlaDe nvils)srxm(m nudlltnlfcta(fs2urum ;u0alto i3iyd m2em( s u0aleoiociotla  lnvs;t) rumxopno1olte ivs ()aDrmu oot4tpe  fciyd m em(msnt0 etnircoodfmDeaivs;(0 exoiopio1oltn ivilsf Drrxro;o1oeto fetyslm2eanvo (0tlxrmo3iy1oaDrlu s;s0 2xoim3ou1oltelieiat) rum(rpoo1olt  iciat m uanmon() eerif io1fpDr uvo;t0 exrirpno4omeelnvi s)sDrmumont0opx ifetyt aDrmn sn()trxoxfciadomtrlnvils)t2uoirpoo4ameemnvia(fa2trxr ;u0optn o3tadla2emuvs;()alxnirciydoptrauesls0tetm(r oo1oleelfetatfsrua( oou4oeeo feias sDua( s;u0alxoxr3totfmte n s;()teur(m nudlpeemietat) 2rau  ;t0olenioeiytlm2rlumon(0teermr3ta1lmt lues;t)t2to(m nodapteliesls)aDtr(m nu4openmfctas s ra(vs;u0 reomfciytfaD  ues;t  rxmxrpoydlpen ict ( sDtr( p;u4tpe ifctytlm2elnmo u)altnmf ty1oatelivsl()trtoxm3oodlpee nct (f 2rm( p;t4optnifeiad mDua( p;u) reoxo ootoaDrai s (0srtrxm io1altn nvs s)sDrax pou0teenioctatfm2umump t)trermocoy1oate ueil( s2urxm ou4al nlivt (f Dtm(mpnu4olt  ocildfa2ulnmo;t0tlermociotoatr uvol(0 2um(r io1om  lncta(  rtr( p;o1tpe ioeiadla2uanmo;()tetoxf3tytom elivslt)trtoir iy4op emnviat srrm(r oo1tpt ifciadlsDuanmo;t)alxrif3oydfatr ueo s0s2xoxopno1amt  fvs s  rum(rpno0teeoif3iatlmDuanmpnu0tetoxr iotfateluvs ()srxoim iodlptelncslt s2truroou1tpxnmicilt aDrlnvon(0 ltrmocoatlmDr ivsl(0 rxmxo oy1apt  fvs (  Dur( poo0alt  o3iysla2rmu s;(0artoir ty1fa e ivs s) etm(mpny1ap n icsatfarraur ;t1alx  fcias sDrl(mpnu4treomr ia1laDeaues t0t2umirpnu4am   nvtasfsrumx  ou1olxnmietasfaDrl(vp;t0altnxr ta1lpteaivsls)t2tmir nu4opeemfvi ( arur(r ;u4apxn o3iytla uau pn()aexoio3tydlm  luvs s)s2uo(rpnu1lm   ivil()s2urxmpoo4oee  f3tysfsDrlump (0aeeoxfcoadfm  lu i;t0texmir3ny4om   nvi s arum( p;o4optnifeiydls2uau pnu0artomr3oa1optraieol( texoir iydal n ivs s sDtr(r ou4altoif3iasfaDeln pnu0trxnxr3tatoatr ueilt trxrimpoo4ome lncta(fsDrr(mo;u1aexoio3iad m umnvs ()aeerio oydopDrlueilt) rxrirpoydopte nctl( arrax  ;u1tpt mi3iatla emums;(4 rtrircta1omteaues t0 2xmim ny4ll  lfvsls) 2tau  ou1alenmfcilslm umn s;t)arerxf3iotfaD  n i () 2xo(m3nu4op emnctls  rtmurpnu4oee io3tld s eluvs t4 rerxf3tytfatelies t0 2urxrpoy4lmeemfciat)arrmumonu4tlx  oeildlaDrlnmont4 exnmfciydlm  liesls) rtmxm3no1open nviatfarumu  nu4oexn i3taslm ranms;()tlxnmf iy1lpD aues;t0setr(mpoo4ap n nvsasfaDrr(r nu1oexomi3tasfaDrau s t4 lenmo iytfaD  uei t0sexoxr3iy1amenlieil( s2tr( oot4oexn i3ias m rmuvonu) exrmr3oatfp  aivil(  2toio3ou4altnliesl(fsDrrumo;t4tptn o3tysfaDranvo t4 renir3iadoa ranvil()t2tmiopnodom e fvi s)aDrrump;u4tlt mfciydfa2uau pn(0trxoif3io1lptraivs t)trxo(r io4lle  nct ()a2um(  ot1aeenii3iys sDelums ()aeermo3iy1fatr nesl( seumxo3oydal n ivslt)arrau  ;t4tpto f3tas a em(mon() rxnxo3iytop  aieols0sexrxmpiydoleemnciatfa2umu p;o4aexo icild a2elnmo;(0tltnxrciotlmt au s ( seurirpiy1apt mnes t  2ururpou1apxoifciadlm2rlnvo () rtoxo iydlat aues t) rtrxopnydaptn fetls)sDta(rp;o4tlt ii3tyslm2ea( ont)aleomr oadfmtr i i t)trxr(m iu1lp  liet t)sDrr(rpnu1tpeoiocilsfm2uau snu0tltoir3ootfaD anesls)t2tmxo3iu1am  lfvt t)arua(r ;u4ole  iciltlmDrauvs;t)alxomrcoydfmDrlu i;s)setoxo iy1amen fct sfa2raumoot1tpxoifciasfm2em(ms;(4trxnmr oodoatrlies (  rtm(m oodlm elnci ( sDta(  oo0alxn feiydfa2ua( pnu4 lxnio3oa1omteanvol() rtmxm iydame lfvsat  Duaxmp;o4oetoio3iytfa em( pnt) rerxr ootopDeanesl(0texmxmpiy4op nlnvias aDuax ono1tpt iicils sDeauvont) rtnircoodfp rln i;(  rtmio3iy4opee nvsa( a2ra(mono0tpen oeiasfm rmnvsnt4tlxrmfctotfm  lnvils  2xr(o iy1lpen nci s)arua( pno1aex iieiytfm2ulnvs;u)aetrxo3totomte nes t) eto(m3oudam elnvsatf Dumurooo0ale iiciys a em(mp;u4trxoxfcty1fm   ueo;(0seuoio3ou4olenlivsl(faDtmumpnu0tlenmociad s2rln snt0teerio3iodfmt aueo;t0s2ur(m oydop e ieta(farraxrpnu4aetnmieiltls2el(mp t0alxoir iytomteli s t t2xoxrpou1ll  mnesls) 2rr(m oo0aet mietys m2ra( p (0 lenxocoadlp rlieols) euoir nydopt  fvs s)s2rr( p;o4alxnmi3tldla2elump;t)trxomo3ia1oatean o (  2uoxm3ny4al   iciasfaDrm(mp;o4apt ioeild mDul(msnu0 exnxrcoa1lm e ieo;(0truoir3io1ll nmneia(  2rmxrp;u1ape mi3iyd sDrlnvsn(4aeermo3tytfate ivsl( tetrimpny1lp  lnetl( aDraurpot1tltnmoeiasla umu o u4 etrmfciotfaDr uvi;t)texmir3io4ale  nciasfs2ta( onu4tlt  ociydls2raumpnu4trenxf todlptr uvo;t)truo(r oy4lle lnet t  2trxmp;u4tptn i3iad a2eln pnt)tlerxfcoy1omDeauvs;s0srtr(m3oy4ol   ivsls  Dtmx oou4oetnmf3tlslaDrl(msn()teeoifcio1fateanei;s0sexr(o3nydopte icsl(fsDra(mont0alx mfctytfaDeanmo t)aetrio3oadoaD aueo t  rtoxopiu4lpeelicil(  rurxmp;u0tlx  o3ilsfmDrluvo t0artomo oa1oa eaneo;()s2uoir nydlltnlnvtasfa2rmxmooo0tpe io3iyt s raumo;t4 exrxo3oo1fpDeanes;t  2urxo ou4om n fvi tf Dua( oou0teenmieiyd mDrmn snt4 exoxo3tytfmD lu o;s0setoxm3ny1alenmfesl()artmxrpnu0apx  fctadfm2el(mp t4aeenirciotoaDeln o;( seumir3iudlm e fctlt sDtmxro;t1opt miciyd aDea( p t0 lxrxo iydfptrli i s)trxmxr3oy4omeemneilsfaDuaur no1ape iictasfs2elnms;() etnmf3iatlp ean i s)setrxr ny1lltn ietlt)arrrx ont0tlxniieiltfmDelumsn(4trtnxrcoa1opDe ueolt  ruoio3iu4ome mivsa()arrru pno1texoiociydlsDranvo t0aexnmo iodomte nvo (0s2uoir oodoltn netls) Drmxrooo4tle  i3iasfsDem( p;t)alenio3tatlmDranvsl()trxm(mpoo4omt  netl(  rtm(r oo4oet if3iatfm uauvp;t4alermr tatfmDranvsl(0 2xm(opoodope  nci sfarur( ont0apxoioeiltfaDra(mpnt)tetnmf to1omt  n i;(0texoim no4amenlncsa()srtmxr ou1alen ictatfa ranvs;u0altomrcoa1late n s;s0 exoirpnu1llee ietls) Dumumo;t0tetnmo3ilsfm em(vp t)aetoxfctodfm   i i;t0trtmxmpoo1altn ivi s)a2rrxmpou1alxn icilsfm2uanvonu)trenmr todomtr u o (  rtoxo3oo4aptelfvtltfarumum ou0opeomietysls eanvp;t4teenioctodlp r u i;t)s2xrio3ny4amt lnetls)s2urxroot0tex mociasla rm( p;u) rtnif3to1omD anvo;(0 2um(r3nu1ame lncs s) 2uru  ou1aexomfcilsfmDem(vsnu4aetoxfcoy1opDelivo s0setriopoudaltnlncilt)arrru pnt1tpeomi3iyt m2elu s;u0trxnmr3iodlp   nei;t s2xr(m3oodol   fvta(fsDrr(mp;u1teen i3ildls2rmu onu0tltrifctotoa rlnvslt0s2toxr3ou1lpt  fvtat srurxmp;o4olxn o3ilsls2el( o;u)aexnxr oatfm e uvil(0s2xmio3iu4ap  mncsls srrr( pnt4tet mi3ils s rmnvpnu4arxrmo iotlp elneo (  2ur(r no4olenlfvtat) 2rr(mpot1tptniocild aDel(mp (0aetomoctatlm elneo s0t2xrio ou4lp  mies tfsDrmur ;t0texnmo3tytfaDuau s u4tlerirctytla  lnvo;( sexmxm oo4oltnlieia(  Dra(  oo1tlt mfciad m rlu s;u4texoif3io1omDr u il()t2tmim iy4lm e neiasfaDtrxr ;t1tpxomo3iad m eaumo u4 reoxocoytlaDeaies;()truoxr3oodamtemncsat arrmumoot1apeomieiad s rm(monu)aeerxo oatfpteauvi (0trtoio io4lmtn ietas aDtaumono1olenif3tadlmDumuvont0tetrmr tadomD lueo;()texoxo3nydlltemics t sDtmxm nu1aptn f3tat m2uanmo;t0 rtrmfcoydfa raueil() 2xr(rpou4oleelicsatf 2tmurpnt0aeeomoeiytfsDemu pnu) ltoxocoy1late uei;t0s2xr(o3oo4apt lfcta( aDta(rp;t0alt mieiydfa ulnvp;t)altomr ootlmtr n s;t s2toio oudomtnmnvils)aDtaurono4altomo3iyt a ua(vo t0aetriocoatlpDelueo;s0 2umim oy4omtnmfeils)aDtmurpnu0olxnmoetytfaDel( o;(4 ltomf tadlpD anes s)trur(m ny1lm n fctasfsrrmumpno0aeenmieiltls ra( snt0tleoxfciytlmDr u ol()tetoirpny4ap  mnvi tfsDum(  no4ale  f3tatfmDuln p () leoif3tydlp eaiei t0setoxm3oo4lm  lfvsas aDurx pno1tet mictatla2rlumon()teenxf oydfmt auvs;s)sruoir no4ap  mfvi t)s2ua(rp;t0ope  fctydfsDul(vp;u)tltrmocoa1laDeai s;s0 rtr(o3io1altemics t) rrr(m ;u1aee moeiadfa2eanmo u)aetnmf3iydoa raues () rtrxopnu1om elncilsfsDrrumont4altomoeiad sDrmnvp;u) lxnif totfpD li sls) 2tr(m oy4llte nesl() rrmurpno0aeenmf3iad s rau pnt0tlxnxf totfpD liesls0t2toxopnu4lle  icsa(fs2rm(m nu4tptoifetldfa2rl( pn()tlerxfcoytfatrln ols  rtmio oudoptnlfvtl(  2ua(mp;u4tpenio3iytlsDrl( pnu) leriocoytomDrlies;t) ruoxo nydol  lieiasf Dumxr ot0teto ictat s rauvonu)aleoifctadlmteli s (0tetrim3iydlmt  fetasfarum(moot4tetoii3tydla2uau s;u)altniocoatlpte iei;t)truo(m3ny4lmtnmfctlsfsruaur oo0opt ioctlsfm2rmuvon() ltrxo oo1lm e ivo;(0tetmxr3nu4alt mfet s)a2tru onu0tleo fciadla2um( s;() rxnmrcootlaDeluvo;(0srur(o io1lpee fvi s)srra(  ou4teto i3iat mDumuvp;u)teeoxf iy1fate ues t texo(o3oy4oltelivs tfs2taxrpnt1apeomi3tldfm2raums;(0 leniociy1lpDean i;t t2tmir ny4ame mfvt sfaDua(m ot1oltn ociyslaDrmnvsnt0tetrmocty1lp   iei s  2tm(m3iudapenlnctat)a2tau o;o4tptnii3tltfm um(monu4 rxnxr3oydoa elnes t) rumir3oydal nmnet sfartr(r oo1apenmfeiyslm2umnvonu0teeoio oa1op  au i s0t2trxm nydaptnmfviat aDum(m oo1olxniieiat a uln ont)aleoio oo1fm rlivslt  etmxo oodoptemneta(f Drmuront4oexoio3iad sDra(msnt4 lxoiociytfaD  nvo (  ruoim iudolt  nei t)a2trur ;t4tetniiciyt mDrau on() rerio3iatlmDrlnvo;(0s2trir3oodol  mnctas aDtmur ot4opxoii3tldla2em( s u)artoxf iadoa   ivilt) 2ur(opiu1olenmiciat aDuaxmoot4oexo ietat m umumo t0artrir to1lpt an s t0 2xoxr3oy1lp nlfetls)aDrm(roou1opxn feiyd m ra(ms;u)trtnxo3todfpDeaivsl( teuriopiu1ale livs t srrrx pno0oexn icils aDul(vs t0tltnxfctadlm  aneols tetoxopoy1al  lnei tfs2raxm ;u1tet  f3tls s2elnmp;()treomrcoa1om  lues;s) 2xoxo ny4omtemfvtl(fsDuaxr ou0alenmiciys sDem( s t4 rxoxfciytlaDe ivilt setmxo no4ll   ietl(f Durxm ;o0ope ifetad aDea(ms t0aeerxr3todfpDranvi t s2umxmpou1olt  ictl(  Dtr( o;t0tltniictatfmDeln snu)arxrmrcoa1lp r nvil()srxrxr3iy1llt  nvt ()aDur(ront4ale iicildlaDel(mon() exrxf3oy1oaD li i;( truoxr nu1ap nmfeia() rta(m ot1oex mi3ilsls2ul(msn()trenmr3ta1fmtr ivilt s2tr(o3iu4apte ivs () 2rrumpoo1aleniiciysfs2ra(vp t0 lxoxf tytopt lies;(  rtrxm oo4apte ivta()sDtm(mo;u4olxo i3ilsfa2emnvo;(0 exrmo iytfmDrauvi t  eumxo ny1op e fcta( aDtaumpot0oet mi3iytfm rl( p;()altnircoytla  anesls0srxmxrpiudolt lfesat)arrmu pou0oex mf3iatlm umu o t) eenirciy1omDrln s;( trtrxr3iu4ame lfetltfsrum( o;o0oleoiietld s el( p;t)tltnmf iotoateaies t) 2umirpoo1ap nmnviasf Duaxmont0oltomfeilsfaDrluvs u) exrxo3tydlpDraieo t0t2umio nu4ope  fetlsf 2ur( ont0alt io3iytls rl(vo;(4texomr io1omt  n o (0 2xmim ny1lpe  ncias  rraump;u0aexoifetlslm2ea(msnu0aexnir tydfa raneil( trum(r3no4om e fvsltfaDuru o;u4ole miciad s2ulu sn(4alerxf3oatoateauvolt s2tr(o3nu1apee nvtls srum( oot4optoif3tydlsDulnvs (0alxnxrctotfmte u o;t) eumiopou4ll n iei t sDtm(  ;o0ape mi3iyd a ulnmo u0 rtnxo ootfm  an o;t) eumxm nudaptelnvt sfsDum(ronu0aptomi3iat m ran s u) reoifctadfpDrai sl( srxrirpoo1lmte ncs ( s2trur nt4ape  ictadlaDumn o;(0aetrircto1lm  anei s srxr(o3ou4alee feia(farrmxm nu4tle mfctldfs eanvp () etrir3iodopt au ilt)srur(o3oodolt mnctls aDta(mp;o0tle ii3iat a emnms (0teeoxr3ty1fp raivslt  eto(mpnodom   fvi t s2tmurpou4oexo feiytls2ulnmpnu)tlenxrcoadom e ues;s  2tm(o io4llt  ictas  2tru  ;u4oltn oetyd aDrl(mpnt4 rxrircoadoptrau o;(0s2uo(o3iu1ll emncs sf Draurooo4ope  feiys s2um(vo u)aexrif3ta1fp eanei;s0trtr(mpno4apenlict s aDrrump;u1optnii3iytfaDulnvo (4areomo ia1latrau sls)tetm(r3ou1lme  neiat) 2taxr ;o1altnifetatls2uau p t)teenir3iytomDrau s ()srtmxo3nu1aptnmfci (fa2tmum ;t1ape io3iytlm emu s;u) ltrmr3oytfmDr iei () rxr(o3nydop   feta(faDrm(rpot1oleniicilsfa ul(vsn(4 etoxr iotfmteauvilt) 2xrim iydop n fetasfarrruroot4aex  fctaslm um(vs;(4trenif3iotlpDrlnvs;(  2xoim oo1omee fei sfsDtm(m oo0ole  oeiyt sDul( p;t) lxnir3iy1laDr i s;t tetoxo3oodolt lfvs s  Dra(r no0tetomoctytls2uanvsnt4 exrmrcoatoat  ivsl( t2xrir io4lm nmfvtat)srumx oou4openiociasla ra(vs;()arxrxo iodla rlivs t) 2ur(rpnudomtn ies (fa2raumpnt1opto feiadfaDemu p;t)aexnif3oydlp eaneslt)t2uoxm io4amtelnciasfs2ua(  ;t0aee io3iyd m ran o (0 lerxr3iatlptrau il()tetmiopny4lp nlfcs tf 2rrx  ;u4tetnmoctls m uauvpn() lermf3todoa elues t0srtmimpno1lleemfcs ( sDum( pno1opx if3tad m2ulnvo (0aeeriocootfat au s;()s2tm(mpiudol  lfcs tfa2uaurp;u4oee if3ildfm2rau onu)aeenirciotlatr u o t  2trxo no4ap  mfvils) Dtm(mo;u1tpxo fetyslaDrmnmo;() eenirciytfptr i ol(  2uoim ou4amtemncta(farur(m ;o0ale io3iadlm2ra(vpnu0alenio io1lpD  neo;t0 rxr(rpou1llenmnvt sf Dtaurpnt0oex  i3iydfsDrmumo;u)altrmf iy1oaDrauvsl()setoio3ny4lp  mfvt t)srrmx  ;u4aetnio3iad s ranvo;t0arxomrciytfpteai o;()trxr(o iydom  mnvtat) rtr(ro;u4tlenif3ilsfs2em(mo (4 reomf oytfatr n ilt) exmim3ny4al nmneias  rurxm ou1opxo oeilslm umump u) reoir iodfa  luvs;s)s2um(r nudaltnlivsa(f rumxmpou4oee mictydfs2umu o (0 lxoifciy1lmDrlu o;()texrxrpiodlptnmnesls  2umxrpou0aetnifctadla rluvp u4tetnifcoy1lm raieo ( s2xm(o3ou4op n ietl( arumu ooo4tetoioctlsfs2uaump t4 rtoiociatfm e ies ()t2toio iodal elivtl( aDrau  nu1oetomoeiysfm2umnvs u)trxrir oo1fa r n s;( trum(mpiy4op nlfcsl( srrmumoou0opeomi3tad s2ua(ms u4 rtnxo3oo1la r ivs () exo(m oydale  fvilt  rraxmp;u4apxn ociytfmDrmn s t0 leoir3oydomDr u o t0 rto(m3oodalen nctasfarumxrpoo4alt ifctltfa2rmnms (0aeenxrctadfp   ivi ()setr(m3iydope lfes tfsDtmxmonu4ope  octytfaDranmo;t)arxrifctydfatrai i;s0setoxmpio4am elnetat  2raurp;t1aptoiieias s um(vsnt)artrif3ia1opteli sls  2xmirpnu1om  mivsas)s2raur nu4aeeoiietydlm2ra(mp ()aeenio3oadop eau ils s2xmxm iu4ap nlieiat sDururonu4oetoiieildfa rmn o;t)tleomrciy1lat aieo;(0t2xrxmpiydamen icslt)a2ua(r ou4tltniieild m em(mo (0aetoxo totfmDe ueil(0s2tmxopnodole mnvsls s2um(mp;u1alxomo3iasfsDel(vsnu0 rxomr3oytlaDelnvi;( texrim3oy4llee fvi (f Duaxronu0alxnifctydfaDemnvp;u4 rtnmf oatomte ieo;t)s2tr(opiu4apee nvt ()arrmxrono1tle iictlt aDuau p;t)arenir iy1lp  au il(0 2toir3ny4amtnlnesat aruaurpot0tptnmi3ilsla2rmn p t4 lxoxfciodlpDeai o;t0 2umxo3oy1lm elfcsas  2ra(mpnu1alenio3tat aDrl( s;u0trerxf3ta1omDe ieo (0 exoxr iu1lptn ietltfsrrr(m oo4oexnmfetat sDrln p ()aeeoxf oytop eanvs (0t2um(r iudaptemnesat) rtrur ;o4tex if3tld a2umnmo (0arxomo3ootfatranei;s0t2xo(o3iy4olenmncilt arumu poo4texomoeiysfa ulnmo (0 rtrxr iytlateauvsls)s2xoxopoy4ol e ictl(f Dtr(  nu1oex mfetadfa2rluvp t0 eenif to1lmtr neil(0 exr(o io4om nmici s)s2ur(mp;u4teenii3iatlsDumnvpn() ltrmf oa1fmD lnvs s0s2um(m no4lpt lnes sf Drmur nt4ole mf3ild aDulnvpnt4 lenmf iadfm r iesls  rxrirpnu4al elivt t)sDta(mpou1oee iiciatla eanvs;() lxoirctotfmte ivs;t)s2urim nu4ap  lfvsatf 2ra(rp;u0oltoio3ils aDrmuvon(0tlxomr3tydfaDr u i t  rtm(opnydome  ivt s)sDtmum ;t0altnmf3ias mDelumpnu4alerir io1lmD anvo t  exoiopny1lp nlics tfsDrr(ro;u0oltomiciltfsDuau onu)altrxf3oydop eauvi t)teuoio ou4lme miei s)srtmx  ;o4openmi3taslsDuaums;(4areomo3to1optrluvi t)s2xmxm3nu1lmee nesat aDrr( ooo0oexomfciytfm2um( p (0tetoir oo1oa  livil( srtr(o3iy4oleemncilsfarrau  ot1oexn i3tyt mDuauvsn(0 renmr3ta1fp e n slt srurxo3oo4am nlnct ()aDtm(rpnt4apxo o3tysfs ul( onu4tltnmf3oy1fpt lnei;s0s2xr(o3ny1lmen fei s) rraurooo0tet mo3iadfmDemnvo;(0aetnifciy1omte nes;t) ruo(r oy1al elnvils  rraxroot0tpxn i3ils a2umuvsnt) renmfcootomteli i t t2xr(r no4llen fcs ( s2rax oot1tltnif3iad s2ulu p u) ltomfctadfa eaneilt) etrxo iudlp   iei sfa2rrum ;o0oleoiicilslm2rau ont)alenmociatla ran i s teum(opiu1ll nmnvsasf rrmx o;o4ale ioeiydfsDra( sn(0 exnirciy1fa r ivi;()srxr(r iy4ap  mnetlt) rraumooo0tlt io3iytfsDrlnmont)tetnxf3oytfmtraivi;( s2xrim3iu1alen feias  rtaxro;u0ape iociat m2ranmp;() rxnio3totfmtr nvil( trtmimpno4apeemneias aDtrxrpnu1aptn icils s ua( on()trerxr oadlatr nvo t)texrxo3ny1llee fetas  Drru p;t0opxnif3tls a el( o u0trenxo oa1lmDranvsls0sexr(r3nu4ll emnciltf 2taurpoo1apto ieiyslaDeauvon(0artrxr tatoaDeaieols  etmxm oudol  lfet sf 2umx  ot4alxniieild a2eanvonu) ltrmocootoa   n i t s2xrxr iudoleemfcs t a2ur(ro;o4tptoioetld mDemn p;t)trtoxr3iydfptean o;(0s2toim3io4ol   fvs sf 2umu poo1tpen oeiadfa2el(mp t4tlxoif3oydfpteluei;s)sexoxopiu1ol  lneil(fa2rrxmoou0tlxo feilsfs2em( s t)teenifcio1lateli o;s0s2um(r nu4ap  mfei (fs2ta(m nu1oleoifeiys mDuanmo t)teerxf oo1fptraieo;t0texo(m no4ll   nei t) 2urumpnu0oex ioctytlm emuvo;t4tltnmo3ia1latranvo;(0s2tmxrpiu1amen fvsat  2ta(  nu0oeen i3iytfa2rmu p (0tlxrio3oadlpDr ieo ( seumim iy1om  lfei sfs2rrxrpot0tlenii3iatfm2ua( p;u4aetrxf oadom  lieils)srxoxm no1omtnmfei s)a2trxm nu4oeto i3iltfs2emnvs u) eeoxoctotla rluvilt) rtoim3oudaleemnes tfarua(mo;t1texomfeiysls ea(vo (4arerxo tydfatrau olt) rtr(rpnu1ale  iet t)aDurx p;o0tlt mf3tas sDuauvo t)trerifcoy1fmt livsls t2xmxr3oy1ll nmnvtl( s2rax p;t0olx io3tydfs ul(mp t4aleoio oatopDraneil(  rurim iy1ol nlfvt ( aDtaumoot4olxnifciys aDulnvs u0aetoir3oodop raueo s0s2xm(m oy1omte ncil()aDraxmoot4aeeoifeiytfmDelu p;(4artnxr3oydfptelu i s) euo(m3no1am nmfvt s)srrrxmono0tee mi3iatls ua(vp t4teerxoctytlpD anvsl(  ruoxmpiy1omtelnviltfaDurx  ;u1tpt ii3iatfa rm(ms;t0trxrmo3oa1omDelnei;s0tetrir3io1ope mivs t) rua(moou4ale  f3tytls2uluvsnu0 lxoxf3iytfmte uvsls0 rurir oy1lm nmfetlsf Dua(rpoo0oetnmoeiadfa2ranmont) ltrmrciodfmt ln i;s truo(m oo4ap   neia()arraxro;u1openii3ilt a2eaump u4tlxriociydlp eauvo s0 2xm(rpou1lmt lnvtl() rtrxr oo1aex mi3tadlm ra( p;u)tetnxf oy1lpDrauvslt0 rtrxo3iudopt  ivia(fsrur(r ;t0oetnmiciydfsDum(vp t4 ltoifciadfm   nvsl( s2toxopny4apeemicsls)aDta(rpoo4aetoifetydfa rln p;u)arxriocoadla elu s;t trxm(opoy4alt mivsltf Duaxrp;u4tpeo i3ias a el(mpn(4arxnio3iy1fpDeauvsls)s2uoxopnodamt mfct s s2umum nu1altn o3iltlaDeauvp (
\ No newline at end of file
@@ -0,0 +1 @@
+iesls0 rtm(mpoo4lmenlfcia(fartmxmpnt4tpto o3ias m2ul(mo ()aexoxr3oytfpt anvo;t t2to(o3iydlle  nesatfsDuauro;u1tlxn ociyt m2uanms;()treoxo3tatfp  an ils0 2tr(r iydopee fctas) Dur(r ;t4tpt if3ilt a2elu s;t) rxoioctotlptraivi;t0s2umxmpou1omt  ivtlsf Dtaxmp;t4aexoif3iytls eln p t) rtrxr3to1optrauvs t t2urxmpiu4lp   fvta(fsDraxm ou1optoifetysfaDeaump (0aexoxf3tydoatelueo;s texoio3nu4lm   feiltfaDuaum ;t4oleoiociydls2ulums (0tleoir3totlpD lneols) 2xoir3oo4amenmfctls aDtaumono1oetomieiysfa el( o (4aexoifcoodlm  ai o;s  rxoxr iydope lncsls)aDrrum ;u4olxo ociaslaDua( snt4 renio3tydfmtran o;s  2um(o3oy4lmee nvtl(fs2raur nt4ale  f3tydfm2rmn s ()artoxfctodlpD  uvo;s)t2toxo oy4lp emfvt t)a2uau o;o1alt ifeiadls2umumo u0aleoxr to1lpDr ivol(0 rtriopiy4oltnmncsls)a2uax oot1tpeo ocildfaDemump u0 rxrmo iadoaDr ivo s  eurxo3ou1lltnlfvils)s2trum no1oltoiiciytfmDrl(msnu4tlxrxo3ty1fa elnvo;t) exo(rpny4omtnlfetlt  rrm(rp;o1tpe mieiat s elu o;t4alxrifctytfa elneo;t  2xmxr oy4olee fei sfa2rrxm ;o1tptomiciysfa rmuvsnu)alxoxociytom  an s;t0 2uoxm oy4om nlfci tf 2rrxroou4tlt  ieilslm2ul(mo;()tlerxo iatopteaies;()texoxm iy1lmeemicils)sDtaumonu4aeto i3ilt aDuauvp;u4 eeoxo3ty1fpDrauvo;s0t2xmxo3oo4lmte neils)sDtmxmpou1opt  ieiys s2ulump;()tltrmr3iytoptr ivol()trxmxr iudam emieilt)s2rrx ont4tee mociytfaDran pnu0teeoxocia1fa r nei;s)texoxo oo4alt lfvtat) 2rr( pnt1oleoiieiatlm2uln s t4texnxr iy1omD ln sls srtoxo no1lpt lics tf Dtrurooo1alenifetltfm ua( o;t4tlermfcoydfptran i (  rto(r3ou4lpt lnet s a2umumo;o0aptomfetyt aDuanmpnu0teerxr3oatlmtrli s;s)teurio oydop nlncs ( aDtax o;u1opx  i3iat a umums;u4 eerxo3oadomtrlies t truoxm iu1lpeelieilsf rrm(mp;t0tpxomietadlm uauvp;t) lermo oadlm r ues;s t2uoxo3iy1altnlfesas)a2umumo;t4tex mf3ias mDra(msnu4tleoxfcootfp r uvs;t0 etm(o oy4ll elneslsfarrmx oot4oetnmf3iat aDulnvs t) rxnmoctydfp ranes t0seumxr iy4lmtemnetltf rrmumooo1oeeo ictadfsDumnms;u4artoiocty1fpD aiei;s  etrirpio1op e fvsas) 2rm(  nt0apen ociasfaDrm(mp;t0treoxr oa1lpDe nes s)t2toxm3iy4ll   ivsl(faDtm(rono1ale ifciltfa umu s u0tlermrctotlptrai sl( s2tmxr3iu4lmtn ietlsfsrraxroot1tltnif3tlt a2el(monu0tlxnmrciy1faDeluei t trxoimpoo4lptn iesasf 2uauro;u1optn i3iys mDel(vo () etomr3to1oa e u o s0 2umxopnu1lm   nvil(fsrraur no1oleomfctadla2eaumpn(4 lenxr oo1fmDeaivo s) exo(m iudaltn nctl(fa2rru o;o4ale  ietas s2emn onu0arenxo3io1fmtrai i;s t2ur(rpnodapenlnvs () 2tau o;o0aeto f3iad aDemnmp u)trxomrcoatfptr n i t  ruo(mpio4lmtn icilsf Dtaur ou0alenmoeiysla emuvpnu4aetnmoctotlm eauvo ()teto(mpou1apt  fcsas aDtr(m ;u0opxniictld a2umnvp t0 rxrxf3todop elieo s) ruoiopnudll nmfvi sfa2rrxmp;o0tetn ieiytfmDem(mp;u4trxnxfciotomD  i s s)trum(m iydapen neiltfa2trxmpnu1tpenmf3iadlsDea(mp t)altnmf oatlatr nvils0teuoxmpou1op  mnvsat srrmxmp;o1tlxn ieiyd m eanmp t0texnxfciotomte n ol()t2um(m3oudlm   iei (  Drax pno4aetniiciyslm rlu p;(0arerxf oa1fmt  ivolt) euoxopno1lmt mnes s  Dtm(rpou0alxn ieilslsDrm( s;u4aexrmrcoo1fptrli o;t) ruoxo oy1op nmfes t a2rm(m no1optomicildfs2ulnmpnu) rtrxr3oo1fateaueo s0 2xoir3ny4omen fcta( srrmxrooo4oltn iciydlsDemuvsn(0artomf3ty1opDrauvsl()tetrirpiodalte nviat a2ta(rp;u4tlen feilt s ua( sn(4artnmf3to1fmD aneo (0srxr(opny4ap emnvt (  rua( poo1teeomicils mDel(vpnt0texnif totfmt aiei (0 rumir nydolenmfcs ()sDurur nt0apen ictyt sDeauvp;t0 etrxr3oadfmt ln ils  eumxm3iudaltn nci sfaDtrxrp;t4oltoiictasfmDean pn(0 exoxo oytlat  i s s)texmio iu4op e nei t)arum(ro;t4oex mfetltfm2rmuvs;t0tetrifcia1opt luesl() 2tmxr3ou1ole  ict ( s2raxr ;u1oeen fctyt s ean p;u) lxomfcoatla eauei (0t2to(m3ny1alenlieia()a2ra(moot4tptnmf3iasla2um(mont0teerxocoa1lmtraueils s2ur(mpny4optnlncslt)aruaxr no4tltoioeiat mDrl(vs;t4texrxf3ia1fm ran slt0truoimpoy4op   nvia(fs2rru onu4oee if3tlt s2uan s t) rxoifciydla  auei ()srumxr oy4lpe livtasf 2ua(ro;u4tet iieiys s ra(mo;u) renifcto1fpDranvilt) 2tmim io4am nmiesa() Drax onu4aptnifetadlmDumumsnt4artrif3iydfaDe nvi;s seumxo oydamt lictl()srua( pou1tle  i3tytla ul(msnt4tlxrxf oytoa e uesls0truoim3nu4ol  mneiat)s2um(r nt4oeen i3iasfs2rmuvsn(0aetrxrciytfp eanei s)t2urxm3ny1lme liei ()srrau pnt4apenmo3iytlm2rm( s;t)alxnircootfmDeli s (0s2tm(opnydlmeelncia(fs2tmu onu4oeeoiiciytlsDumnvo;u)alxoioctotfp eli ols0srtr(r3oo4op emncsa(farurum oo1tpenmo3iadfsDelnms u4tltnir iydla rlivo s0srtrxr3ny1llenlfcs s  2tr(ro;t1opeoifetat a2ulnmo t4trerio todlateanvi;(0seumim iodlleemfcs ()s2urxmo;t0apxn ieiytla ua(mo ()tetnmf tydfptelnvs;( srxoio oy4ol nlnviltf Draur ;u0aptomfetydfm ulu s u)tleomo oatlmt lu o t seurxo iudopeemfesls aDua( p;u1olxo f3ilslmDrmums;u4trerxr3iytlm   uei s tetoir ou4amen fvs (f rum( ono1tptn f3iadls emnmonu4 eeriocio1op  liei t0 eurxm oo1altelici t  ruaxmp;t1tex  oeiadfa2rau p;u4 reoir3oytfmDeluvolt)trxrim ny1lm  livt s aDrm(m nt4alxnii3ils a rln on(0aeenmr3iodlptrauvo t)srtriopoo4optelivsa(f 2taur oo0tlxoifciadfmDem(mo (0trxomocoadlaD lnvs;s0 etr(r ou1lmt  fciasf rtmx ono0ale  iciad s2rm( pnt4tlxnxo iotlatran s t) 2xr(r3oy4apenmfcslt) Dtaurpot4oexnmoeilslm2raums;()tlxomo tadop e ueol(0t2xr(m oudlm emfcsl(f Duaxrpot4apxo iciadfm rln pnt)alxrxocoy1fm rlivs;s  2trxm3nu1op nmicta(  2rmumoou0opt  o3iltfaDuanvp ()teeoxf3oytoaDr nvs;t0tetrim3io1oltelict t) Dta(m nu1apx iiciltfm ua(vp t0 reomfcootfa e n olt) exrxm3nu1ope  fes sfsrraurpno4apeoiieiadfm2ulu pnt0 lxnir oy1oa   n s t  eum(mpou4op  lieilsfs2trxrp;o1tlt mo3iat m2emu on()trenif ty1fmD  ieil() exo(r oo4ll emfvt ( srum(root0oetnmicilsfm2rau onu0trxnxo oodfmt  uvs;t0texmio3nu4ap e fesat) rurum ;u4ape ii3tasfa2rmu o u) etoxociodfmD au i;t texmxm3iu4llee nvtlsfs2tr(rono1aeenmicildfm emuvs t0teeomr oydoaDraivsl( srtmxo oydoptelnesasf rurxm nt1tltomf3tatla umn p;t0treoxr3iotomtr uvs t) rumim3no1ol elfetltf rtrxm oo1tlt mi3iydfa elnvp u)aetomr3iodfm ranvsl() 2uo(m3oo1lpt lneilsfa2ta(  oo0oee iietldls2emnvs (0alxnmf oa1oa eln o t trtoxm3nu1apenmnct s  rum(rpoo0oleo iciadlmDea(mont4aexrmf3tytfpDelu i;()trxr(r3oo4optnmfeiltf Drmu o;t0oee mfeiyt mDum(mpn()artrmfciodfptr i o;( s2tmir3iodol nmnvtas  rrmu ont1tpxo fciltfmDua( o (0altoir totlmteluvilt0 eurxr iy4amenmfesl(fa2taxrp;u1aptnmoctydfm2rauvon(0aleoxo oa1opDran o;()srxoxrpny1alee nesasfsrtaurp;u0aeeoifciadfm ea( o t) lenio3io1fmDeli s;s  eurir3ou4amtelfvta(farum( p;u1tpenifciat m ea(mo u0 lenxf iytlm elies t)srxo(o iodop e nvs (fartrxmooo1apx moeiaslm umu p;t4arerxo ta1fmD aues;( truoim iodopt  nct s)arrmu  ;t0tpen oetldla2rmn o u0alenir ta1omDelivi;s0texr(o3nu1op nlfvt tf 2tm( poo4tpen ictldfa rlu p;u)altrxf3oo1omtelnvol(0 2xm(mpoydlp   icia( aDta(monu4teenmoetydla eanvs;t4altoio todlpDeli i;s)teum(opiydlp   nei () Drau onu4tee  feilt s rmu s;t4arermfctotfatelnvi;s0 2xm(r3nu1omt  iciat arur( ont4altnmfeias m rlnvp (4aeenio oydoptelivs;s) 2xo(mpnu4llt liesls srra(rp;u1ole moctytfaDrlu o;t0altrmrcoa1oatr neil(0trurim3io1apeelietl(farrrx pou4tlenio3ildlm2em(vsnt) rtoir3tatopD anvi t0 eum(opnodope lict ( sDrm( onu0olxniieiyd m2ulu snu0 rxnxrciatlp  aueslt) 2urxm3nodllte net s)s2ta(mp;t1opxnmfeiys a2rmnmsnu0 eenmo tytomD aivsls)truoxrpou4lleelivsatf 2taum ;o1tltniiciytfsDum(monu)artrir oy1la elnvi;( trurxo oy4om  mfetas) ruau poo1aexo ictysfm2em( s;() rxnif tatoa   nei;(  2toxmpno4ale  icsa()a2rru ooo0aee  o3tytlm emnmsnu)teermo iy1fateau i;t)trum(mpno4am elivsatfsDtrxmpot0tltn f3iasfs eanmo t0tlxomf3iadlpDeau o;t  rtriopoo4lptemietlt)aDtmu pno4tet mi3tatlsDelu o;t0artoxfcootfpD ai ol()srurim no1lme  ict sf Drr( poo4altnmfeiysfm2ea( o t4alerirctadopD liei t0 rxrim nudolenmncil(f 2urur nt0tpt ifciaslmDrm(mo t4tlxnxocta1fp eluvi;s0 ruoxopiu4ape lneta(  2tmumpoo1tpxnmietadfmDua(vo;(4tlxnircty1lmteau o s)seurxrpoy4lmee nctas s2rrurp;t4olt mf3ilt a2ul(mpn(4aeeoxr iytlmt ai sls  exoio3nodlpeelfct t  Durxmpou1alt  octatfm2uln ont4aexoio3ty1laD  uvo;s  2ur(m3io4altn nvsat) Drrur nu4ale  f3tysfm rluvp;u4aexrxrcoy1laD ai s;t0s2trxm iudomtn ieilsf rumxm ot1tptn ieiadlm2eluvo;()tltnmociydfp rauvi ()srxmir nu1am nlfvslt) rrm( pnt0apx  f3tatls2eluvp;u)tltrxrcoo1lm  liesls  2umxmpny1ll  lneta()srrm(rp;t1aee  o3iyd m2el(ms ()tetrxo3ty1laD  ivs s srxmxrpny4ape mivtlt) rtr(mono0tlenio3iydls2ra(mo u)aetrmo3tydoaDeai i;s texoim3nydlle  ncslsfsrrm( oot0ole mociltla2emnvp;t0altnxociodlpte ivils0seum(m oy1lp nmnei tf rrruronu4opt ii3tadls um( s ()tetomo totlp eli o () exmio iydap  liei sfa2rrxmonu4aex  o3iydfs2eau p;() ltoxr3ta1fp eluvi;t  etoxm3ou1apte iei (fsrurur ;o4altoii3tltlm uln onu) lerir to1lmDeluesl()srtoxm3iydopenmneslt artmx  ;u0aleo i3tyt mDel( o u4arxnif3tydop  aivsl(0 2tmxo3nu1lptn neta(fs2uau o;o1aexo ietytfm2em(von(0trerxo oytlpt aneols0teurirpoy1amt lnvs ()a2rrxmpnu4aexoifctlslmDrlnvp;t)texoxr io1laDran o;()texoxm oy4ll emivil( a2rau  ou4opx moctldls uau p t4 lxrmocoodfp  ln o s0s2xo(rpiy1apt  ictat a2um(rp;u4alt ii3ilslsDeau s u)arxrmo3tatomtrli il()setoio oydopte nesl()srumxmp;u0aleomicils m2umn p t4texriociy1om ran ils  eumxopny4omee ictl()s2rrum ot0aet  i3iltlm2rmnvs t0aexrir oy1opte ivol() rur(r3iudoltemfcta(  2ta(r ;t0apenmocild mDumnvs (0 etoxo io1opte nvsl(  exm(m oo4lm n fctlsf rtmxmpot1teen f3ils m emn o ()aeenir3oydfmteau o;() ruoirpno4apt mfvt s arrr(moot0aleo ieilslm2rmn p;u0 eenxf tydlp eanvs;s srurio3nu1am elnvtls)srum(  ;o4aex  f3iysla2elumon(0 leoir3iy1faD lnvilt)srxrxrpnudam elncsl( aDum(rooo0alxnioeiasla2ea( p;t4arermo3totlmtelieslt t2tm(m oy1lpt  fvia(farur(mpou1ole  ietatfs ul(vp;t) ltrxo ootlp r ueo;t) ruoxr nu4omenmnct s)artmxr nu4tpx mociadfs em(msnu0trxrxociodfm   u ils teuoim nu4am nlietl( a2tm(rp;t1aet  octldlm2uau p;(4tetrmf3oa1opDrli ols) eumxo3nodaleemfeils)srtrx pnu4apen octls m rluvsnu4trenxf oadoa   nes;t) rtr(rpnu4ale micias)a2uau pnt4olenifciadfa ea(mpnt)alenio iadopDrauvi (0setmxm3iudome mfeiltfsrtru o;t4tpeniieiadls2uau snt) exoxo3tytfp  luvs;t) etmio3oy1om  mfcs s s2ua(moou0aexo feildfsDumnms u)alxoxrcoa1latrlueo;()trtmirpoy4al e nvt sf 2rmu oot4tet  ocilslm ul( p;u)teerxf iy1fm e uvi;(  rxr(o3oy1lpe lfct ()srtmxmp;t4tlenii3tys a2rmump u0tltniocoo1oa eli s;t trxm(m3no4alenlfvslt a2raxmonu1aexn o3iaslm umu sn()trenmrctodomDrlnei;()teumiopiy1amt micsl() rtrurp;u1tpxnmi3iatlsDelu p t0 eerio iydfmD lieilt seurxopno4ale  ivtlt s2urxm nu1tpeo ietadlm emumo u) etnxf3oo1fp   iei;t0 2xo(m3iodlm e ictas)aDta(mp;u4oleo f3ildlsDulnvp;u0teermo3iy1fpDeluesls)s2tmxr iydom nmfet t aDtmuro;t4aeto ociad s rm(vpnt4trxniocty1la  li o;t) rxoxo ny4omeelics s  Drrxmo;o0tpt mi3iatfaDem(monu) lerifctatfaD livi;s) 2umxo3oydom e fctltfa2rmum nu0tlx mf3ildls eaumo;(4 renmr3iadomteanvils srxoxm no4lmtnlnetat)aruaurpou0apt ii3iytls2ean p;(4 rtoxf3iydom e ues (0s2uo(r oo1ome  nctlsfa2ua( o;u4alt  f3iasfmDea(vsn()altnmfciytfptrlivilt0trtmirpio4om emietlsfsrurxr ;u1aex  o3iatfaDumnvs t)tlxrmr ta1fp rln i s0srurxmpnu1op   nvs tf rrr(m nt1oetnmi3ils sDuanmsn(4aetoxf oatla raieo;s  etmio3oydoleelicils)aDrau pnu0apto feildlmDumu on()aeermr3iotlmDeaieolt0sruo(rpnydoptnlfcilt s2ur(ro;o1opeoii3iltfm2rl(von(0tetrxr tadfmDe ieolt srxrxr3iy4opt lnvilt)s2ra(  nt0tetnmo3iydfs ua( snu0altrmf3tadfat aivil(0 ruo(r3io4op nmieias) rtrumpnu1opt ifciydlaDra( sn(0 ltoiociatfaDelu o;s teur(mpnudol  lnes ( a2trxr oo1tpt mf3ildlsDulumonu) ltnmr ta1laD  nvs s0setrxopou1al   nvi s  rta(mpoo0ole  ictatla emumonu0arxnmf to1faDr uvi;()srxrxrpoo4ole  fcsa()s2urxmono0tltn ietydlm rm(vo t0 eeomociytlp  anvs s0s2trxmpnu1openlivtltf 2uau onu1aetomi3iat m2elnmo;t0 leomf3tydlat aivol(  etmxo3nodol   nvia(  rur(rp;u0ape  o3iatfa2el(vo;u4 etrmfcto1oaDeai i;( t2trxm3ny1lme  ncilt) 2ururo;u1aeeoifeiltfm2rauvs t4 eerircia1om elies s0t2toir io1apt lneslt srrrxrooo1apto ietldlmDrlu pn()aeermo3ta1fpt lieo;(0 exm(m io1omt lnci sf 2taurpot1open i3iysla rl(vp ()trxoio iadlp eau s;s  eurxr3ou1apt livsa()arua( o;u0oex mi3iad a2eaumpnt0aeeoifctotfmD  neslt)sexrio3oo1oleelfet (  rrau  nt4tlt mo3tltfs emumont0 etrmo3to1faDrlnes;t0teurir3iydale mnetat) 2trx p;t0oeto feilsla2umnms t0 ltrif3iy1omD lnvi;(0 ruoimpio4op nlicilsfartmum oo1apen fciysfsDeluvo u0 eerifcoodlate uvols0tetrxo3oodop  lfci s)a2trxr ou1apxnioctasfm ea(vp;(0alenmoctydlmD lu s (0seurio iu1ll emnci tfs2urum nu1aptn ociatlmDrl(vs;(4trxrmo ia1opteau o;t0trumir nu4olt mfes s aDur(r ot4apt  i3tytlmDeln p;u4tlxoxo3iytfa eluvs;s t2xrxmpoy4amenmnvils)a2rru p;u1ole  o3tyt m umuvp;t0artoif ta1la raivo;t trtrxmpnodal  lfvi ()srtax  nt1teeoii3tls s ul( o u0 ltrxrcoodfpDe n i;t  eumio oodap n fetlsfs2ururp;u0aet  octad m ea(vo t4arxrif iotfmD au o t) rtrio3iy1amenmfci sfaDrau ont1ale  i3iysfs2ulnvon(4aexrio3oadoa r ieo s0seuoir3iy1lptn ivsasfa2urur ;u0oetn octas a rlnvo u0 rerxr3oydlp e nes;s srxoxr3iudam   ictl(  2tr( onu1olenmfeiysla2ul( s;(4tlxrir3oytlm  li o t tetrimpiy1ope mnes ( sruax ont4alen oeiadla elnmp;t4 lenmoctodop eanes (  ruoir iy1ale lfesa() 2rmu  no4alx mi3iatfm2eaump;(4 rxrmocoytlmtrlu s;( t2xr(opiy1al nmfvia( s2rr( pou4aeeoiictlsla ulu snu0texrmr3ty1lpDeau s t) exoxm3iydom e fetasfs2rruro;t4optn iciysls rln pn(4 renmociadoa elnes t  2xrxrpio4aptemivil( a2urxm ;t4tle mf3iysfm rluvsnu0tetnxocoytom eaueo;s0 rurxr no4oltnmiesl(fsrrax  ;t0ape ifctyd m2uan o ()aetomf totom  auei t trtm(r3oodlmeemivsls aDuax pou0tle  oeiltla2ua(mont4treoxo ootfm eaieo s t2tm(m ny1ap elfesl(fsDum(rpnt4texniociatla2ua(mp t0alerir iydlptelu o;s) rtoiopno1opeelneil(fa2tm(m ;o4tlto feiasfa2em(vo;t)aeenmfcio1latrlnvil( s2toim3iydal  miet s a2rrur ;t1tet if3iytfa ul(vont)trtrmr todopDe ies;t0 rxrir3iudol nlnviasfsrrrxmpot0oeeomictatlsDranvsnt4tlxrif iydfm  ai i;t)seuoimpno4ope mfciltfs2uau p;u4alenmfeiysla em(vsn(0aetoxf ta1fpDr uvslt)trumxr3oydomte ietlt  2tm( ooo0opxniiciyslm ea(vp t0aetnmrcootlmD lies s srtrxr ou1lmen fei t s2tax ooo4oeen octasfs eln p;()alenmr3tadfat aiei;t0s2trxm iy1olenlfvtas  Dtm( o;o1tet  fciad m elu pnt0aetnmo3todlptr uvo;t0texoimpoydoleemncsa()sDuau  ot0opx  fciydlsDrmn ont0trtnmf3tadom rlivi;s  rtoirpiy4lmenlnvtat a2urxmoot4ale ifciys m2eanmp;(4arxoir tytfa  luvi t teumxopoy4olenmnvi s a2um( ooo1oet  oetydlm2ul(mon(0arerir3iadlmDr uvs s trto(r3iu4lleemfvsasfs2raumpot0apt  f3iat mDra(vo (0 eenxr ta1laD luvi (  2xr(mpoy4lptelncilt) Drrxr ;u0tptn f3tas sDemuvp () rxrmocoydomDelnes s srxmirpiu1ape mfet tfsruru onu1alto f3iaslaDulnmont4alermo ia1oateai i;s seurim3iodlptnmnctlt sDrr(r ;t0oltoiiciatfm2um(ms u4 lenmf3io1latrlues;()s2uo(o nodlm e nct s s2rrxrpnu0apxnmoeiat sDum(vo t4aeeoxr oodla eli o s)tetoir3nudom nlfcsa()s2um(  nu0aptnmocildfa2em(vs (4artomr3tydoaDelieo;t teum(m3ou4open fet t)aDtaurp;o1opx  iciyslaDelu on(4 exoxf3iodlaD luei t s2xoim oy1lm e ivil()s2rrurpou0oeen iciadlmDrm(mo t) rxrmr oatopt auvo ()s2umir nu1ll nmieta(f ruaurpou4oetnif3ias s ul(mp;t0tlenirctydoa e ueo;t  2umirpiy4al  livs t s2um(ront0tlt  i3iysla2emn o t0teenxr iodopDelnvo;t0s2uo(rpou1lle miviasfsrrmxmp;u0tle mieilslsDulnvpnu4alerxf3ootlmD lu s s0s2trxopnydlptnmicil()a2rm( p;t1tpt  iciatlm2uluvo;(0 etnxr3tadfmDr nei;( t2xmirpiydamt lfvs t)s2urum no4tpeoifciytfmDra( sn(4aeenmr3tydfm eaiei;(0 exrxm3no4ap elics t)aDrru pot0alto i3iltfs ul(vpnt4 lenif3iytopt ai il( seumimpou4oltn nct t s2trxront0apxo ociytlm um(mo t0tltrir3todlmDeluvi;(0teuriopoy4op e iesl()aDtrx  ot1alxoio3iatla ua( o t0 renmr iodopDe ueils  exmir iydol nlfvi t)sDrr( oot0oetn i3iltlmDrlump;(0 eerirciodfa eai s;s0teur(o oy4om nmiesa(f 2raxmp;o1aet mf3ilsfm2em(vo (4alermoctytfmt ai ilt0 rum(opoodol emnes t a2tau p;t1oltoifcilsfsDuanms;(0 ltrxo iodlp r ues ()trtm(o3nudlm nmneil( a2umu o;t0tlenmiciytlm uluvonu)altnio oatoaD aivolt0 2xo(r3iy4ape  nvtl(fsDra(mont0tpenmfciytls2uanvsnt)alxnxr3oy1lmtrau ilt0sexriopoo1op emfvslsf Draxmo;t4oee ii3ils s elu s;() rxnxr3ia1fatrlu slt0 euoim3nudale lnvsl()aDrrum no4aexoif3tldfs2eluvsn()trenxocto1oat  nvo;t0s2tr(r iodllenmiei sfaDum( pno0alxomiciasls2eaums;u)tltnxo3oy1fmD anvilt) rto(opnudom emnetls s2tm(r nt1opxnmoetldls umn s;u)tlxoiocootoat auvo;s0teuoxmpnudope micsls)artmxm ou1oleniieiasla2um( o t) exrmr oodlm r uvi ()s2uoir io1lm nlnct s aDtaxmo;u0optoifcild a ean o;t0alenmf3iotlatean s;( teto(m iy4om  mfvta(fa2trx pnt0oexo fctad m2ranmsn() etriociotom eaivi s) eurim nodalenmfcta( srum(mp;u4oee  ictadlm ea(von(0areoifcoodoa   ivslt0texrxr3ou1lpe mncias)aDrru p;o4aetoifeiasfm rm(msnt)arerxrcta1oate i slt0 exmxo3nu4ale  icsasfsrtrur nt0oltnii3tldls eaums u4tetoxo3todlmt  nvsl(  rxoxm3oo1amenmnetls)s2tmxrp;o0aetn ociytfaDrauvs;t0altomf iatfa   u i;(  2xmir3iodlptemfvt (fsrum( oot0oeenifeiys a2elnmpnt)aeeomf3oa1lpteln ilt)srtoxo3io1om elivs t)srtmu poo4tetoifciasfm rln s;u4 leoioctytopteauei;t  rtoxopiu4apeemfvt s)aruaxm ;u1alxomf3tatla2umn pnu) exrxr iytlp  aieilt) rumxrpoodopt lfesa(fartax  oo0aeenmoeias a umuvp u0texrioctatlateau ols0tetoxm3no4alee neta( sDumxmp;t0olx moeiadfm emn o;()artnxrctodop r ueolt)t2xrim3oo1open fvia() Dtmum no1olxnifctydla2elnvp u0trxrir3to1omDe u il( setmxmpiodale lici (  Durx  nt0oeto i3ilt sDem(vsnu4arxnmrctotop r ueo;s0sexmiopny1am e nvt ()a2raump;u1apxn iciydfa2elnvp t)texnir3totlm rauvi;() etrxopiy1aptnlnvs sfarrr(rono1opxomoeiyt m emumpnt4arxoir3oa1fpD anvols trurxmpno4al  lictas s2ua( onu1aexnif3tldfaDrlu s (4tlxrif iydfptrlivs t0s2uo(opoudoptemivs s) 2rrumpnt0tlto feiatfs umn p;t)arxrxfctytla  anvol( s2xo(opny1ale lnesat s2tmxrp;t0optnioetasfsDem(vp;t4 lxrmfctodfatr ieo;()sexoxo3iy1lptemnci tfsrraump;t4tlx  o3ilsla emnms;(4 etnmf3oydfa  an o t0setriopio4ameelicsltfartrxmoot0oee  ieiad aDrlnmsnu0 ltoif3ta1op  livs;() exoxo no4altnliesa(f rtmxmonu4oetnio3taslaDemuvp;u0alxomocoo1fm eau i;(  2toir nu4lpe lfvt t)aDta(ro;o4aee ii3iytfsDemn snt) leoxrciy1lm rlies;s) euoxmpno1op   netlt) 2raxr no4olx iieiatls2em(mont0alenmo iotla   uvi s0setrxr3ny1oleelnetlsfa2um(ront0aexoiieiytfmDra(vsnu) rxnir oy1fptrlies;(0s2umimpno1lm e fvt (fsDtrumo;u0tlxomfeilsfs2eau pnt4tlerio3oy1omD  u i;s0sruoxr3iydaptnmivias)a2rmxrpnu1tpxn o3iytlm rmuvo (4trxrmocty1fmt livols tetoxo io1aptnmfetat)s2urur ot1ape iicildfs el( o u0 rxrxf oo1omDr ies s)setr(rpiy1amee ivi (f rrr(  nu4aetnmfetyslaDra( s;u4trtrmr tytlmDraivsls  eumir3ou1altnmnvs (fsDum(moou0opx iiciyt aDrlnvs u0altnxr oodlate iei (0setm(r nudll nlfcsl() 2um(ro;t4aeto octltla2rmuvonu4tetrirctadfp elnei s0seuoxopio4ll e fvsatf Drr(ronu4tlx  oetadfs2rm( pnu)tltrifciytoaD au s s0 2tmim3iy4amt mncsls  Duaxrpoo0tpxoii3ildlmDean s u0alerif ty1latrlnei;s0trxmir no1optemneil()s2ua(m ot4tltnmf3ilsla2uau p u4aeeoxf to1fmD an i;s0seuoimpiydlmtnlicia(fsrur( ont0alx mfctyd sDean s t) lxniocoodfa  ln o t  2uo(r nudolenmnvs tfaDuaxr ou1ole  o3iltlm umnvo;u0texoifcoytoa rlnes;t  rxrio oo1lm eliviasfsrrrur oo4ale mieiadfsDrlnvpnu0alxoir oydfaDe n i;(  exrir iodomt lfctatfs2tr(mono1tlt  oeiydfaDraums;() rxomr todlpDe iei s t2trxopoo4apenlnciasf rrmxmp;t0tpx miciltfs2ua( o (0 eerifcio1lp eaieslt0 2xmxrpiu1lmt licil( a2tr(m ou4opx ioctad mDuln o;t)aeerif3iotlp ran o;t0 eumxmpiydlm elfcs t artau  nu4alen o3iatfs ulnms;t4 eeoxfciatfa  aneol( trurxo iudllen fcils)aDua(  ou0oetoiieiydlm2elu o;(4alermocoydop rlivi ()trtoiopiydomtelnesa()srtaxr ot1alx  f3iatfmDumnms t0arxrifciydomDeaivols)s2tr(r3iu4amt  ics sfs2ra( pot4tetnmi3iysfs emu s ()treniocta1lmDr ivils t2umio ny4lltnlfvtat sDtr(mpoo0aee  i3iadlm2umump;u4altoxo iy1fm e ues;( setmimpnu1ap  mnvslt  Drmu pnu4opxoiietadlsDrlu s u4aeeoxfciy1latr nvo;s0 exo(o3ny4llenmiviat)a2tmxr ot0tpx mf3tadfs2umu o;(4 eenxrcia1fmDran i;s)sexr(r3nudomtn ncs (  2trxmpnu4tex  ocildls2ran pnu4 rerifciydfateli il( srumxo3iu1al n icsasfarur(rp;t1tlt  feildlaDrmnmsn(4 etnxocta1opteauvi s  2toxm3ny4amenlnvil() rum(mo;o4texoiociltfa rmumo (0teerxocoadlp rln sls)trtmxopno1lm nlfcs tf Dua(r nu0tle  ocias s uanvp;u0trxoif iodlpDraivs;(0 euriopny1al elnvsat)srrau p;t1aexnmieiadls uau pn(4trxoio iodfm  an o t  2xriopiy4ap e nei sfaDtr(mp;t1tpxnmoetltfsDul(mpnu)aexnmo tadlmte nvi;s) 2uo(r3ny4amen nct s srrmum ot0opx if3tyt aDua(mo;u4 etnxr to1laDeau i t) 2xrir3oo1omtn iet ()sruru pnu4opt ii3iasfm2raump;t4 exrmr ta1lp eaues ()t2xrio oo4ap  micsa(  2ua(rpno0tle  ietysfm uanvo;()alenmocty1laDeaies (  rxoio no1apt  ncia(f Drrxrp;u4aleoiieiytfaDel(vs;(0arxnxrciy1fatrluei;t0srumxo3oo4ameelnetlt)a2tmu pnu0tpe ifeildlmDrmn o;t)altnmr tydfa  li s t0 rtoxm oo1lmtemnctls) Dumumo;t0oex mf3iyd a2elumo (0teerir ia1opDrlueo;()srxmimpoydlp   ivsat  2ururono0ope ifetatlm2ran p t) exnir3tytfa elueo t trxoxm3no4om  livt (f rumu  oo4opeoiocilslaDea(mo (0texnifcia1fmDelu ol() 2xo(o3oy1ame mfeiat) Drr(m ;t0alx ii3iysfa ean o;t) lxomf oy1fpte ueol()srxrio oy4ll   nvtasf 2tmx  nu1aet mfeiatlm rmnvp;()tlxoxr tadoaD an olt  2umxo oy1oltemnvi s)sruaxrpnu4tleomi3tat a2el(mont0tetrxrciytlmD aivsls0srxrxr nudlle  icilsf Dtrx  ;u4aleniictldla rlumon()altnxocoadopDeluvil( t2uo(r3oy1lpenlfcslt srtmxrp;o4tlxomociysfaDrau p (0 rtrxf iytopteln s (0 eum(o oy4lleemics s s2umu ooo4tltomi3tytla2uanvo t4 leoiociodfatelu o s tetrxo ny4altelnet tfs2raxmp;u1tlenmf3ilsfm2umn pn(0trtoifctytlateai i t srur(m nu1aleelivia(f 2rm(mono0tptn i3tys a2rl(mp;(0trxoxr3oodlatr nvs;s0s2uo(rpny4lpt  nctatf Drr(r ;t4tpx  fctls a2rau o;u0teenmr3ootfm rau ols t2urim3iy4omte nvs ( arrr(mpnu0tetoio3iadfsDean p u) lxrmf iatomD an i;s0t2tr(o3ou4aleelnvs tf 2taurpou0tlxnmociydfm uluvsnt4 ltrirctydla  au i s  2tr(o3iu1altemfetlsf 2rrumo;o0tpe mo3tadfsDelnmo t4trxoio iotfa elu s s0srxoirpiy4lp  lfetltf rraumonu4tlx iieiltfa elnmp;()artrif oy1omtr uvolt srtrirpio4apeemnvil(fsrtrx  ;t0oeenmocild m rmn p;u0alxnir iy1lat  nvsls)srtr(rpiudalenmieta()aruau pnu4aex  o3ild sDum( s;t0 etnir3ootomDe u o ( trtrio3ou1al e fvt s) Dur( p;o1tpeoiieias mDrmu o;u)artnio3iy1fp eauesl() etrxo oo4ome mfcsl()a2taumont0oleomfetytls2el(vo;t4trenir3oy1fpDr nes (  euo(r3oo1omtemivil(  Dtm( p;t1apeomietldfsDemuvpnu)texoxo tadfaD au slt  2uoxo3nu1lpt  nesl()aDrrumont0alt  fetldfa2ulnvp t4trxoio3iytoa   neo;s)s2xoir3iodlp  mfesas) Dua(mp;u1aexoio3iadfm ean s;t4 eenmf iy1la elnvs;s0 2tr(r ou1lpenmfei t)srrmur ;t1aexo f3iytla2umumsn() etnif3iadoa  lies t)teurirpoo4lltelfet tf rtr( pou0aex micild sDra(vp;u0arxrir tytlaDe i olt  eurim3iudame mnvi tfa2ra( p;u1tptn o3iysls2rl(mpnu)trxrio iodfmDrln s;(0t2xmim io4lleelivi (fsDuaxmpoo0apeomfetytfa2emn on(0 lenxr ootomDr u olt)t2tmir oudopeelnvsatfa2trx  nu4alxnmfetad m2ea(vs u0 eenxo tytomDraues;()srtrimpny1om nlicsas s2rr(  nu1opxnif3tldfs uln pnu4texnmr todop raivs;(0sexmir3ny4al  mfctl(fs2tr(m nu0oexnmoetat mDrl( s t4texoir totomt  nes s0srxo(opnu1apenlnctlt  2umu  nt1open f3tlsfsDrau o;t4 exnifctadlatelueolt)t2uoiopoodll  mfctl( artr(root4oleoif3ild s ua(mp;u0tltniociydlm eli s t0trumio3ny1oleelnei (faDua(ront4aptomocilt m ua( o u4tlermo iadoaDrluvs t) 2uoxrpiodoltnmneiat aDrrxr no0optn i3iad mDrm( o;u) etrmr3oo1op rlieils  rtmxr3io4op  mnvsltf ruauroot1aleoiociltfmDum(msnu)aeermr oatom rlieilt) exmxo3io1lm  licsas) Dur(rp;t1oexn fetysfsDrmuvp u4altrir3totlmD  nvs;t0t2umxo3io4lle lnvtat)srua(mo;t4openio3tatlaDumnmp;()artnio3tadomD lieslt)tetoxopny1apt lnctlsf 2rax oou4tpenmocild aDrlnmo;t4aetoxfcoydfat  u s;s0seur(r io1lpenmncs s)aDumxr nu4opeo o3ildfm rmumo ()tlenxo3ta1lmD an i t s2to(rpou4amte ici ()aDrmu pot4tetnio3tlslmDrlnmonu)arxrir ta1omD ai ol( teuriopoo4lptnlneias sDtr(r oo4oeeomfctatlm uan o;u) ltrmo3iadlaD li i t texr(m oodllt micta(f rururo;o4altomi3ild aDem(vo;(4alxrmf3iy1oatelivi s s2xrir3oo4openmncsltf rtmu p;o1tpxn f3iat sDua(mpn(0 etnir3ootlate ieo () 2xo(opny4lmtn fcta(  rtmxm ot4alxoioctatfsDra(vs () etomocoa1la e uei t t2xrxmpiodlme mnetas srua(mpot0altomi3tlt a ua(ms u4 rxriocta1fmtrlnvo;t) exo(mpnydoptnlfct sfsDraumoot0tleo iciat a2umu s;u4 rtnxf3iytlpt lu sl()srtm(m3iy4ap n icsatf Durur oo4oltomi3ias a ulu s ()aleoirctydfptelivo;s) exmir3no1ope  fvsatf Duaurpnt1tltniieild mDrlu o () exrir oa1fpDeaivils tetoiopnydalee ics tfs2uaxro;t1olxo o3iad s rmnmp (0areoxr3ootlmD auvi;s0trxoxrpiydlm e ics (  2rr(r nu0opeomfetls aDelu p (4arxoxfcta1fptelu o s0s2um(mpnudll nmfciltfsrurump;u0aptnmictld mDel(mo;(0tetrmrcoytoptrluvi () rumir io1ol emnesat srum(mpnu4opxnmfeiytfmDuanvo;t4 renxocoadlpDelivils0srurxopou1lmt mfvslt)aDtmumo;t1oleomiciasls ul(vs u0texomo3iytfmtelivs;t) 2um(m no4op emnciasf 2ua(ro;u1aexn i3ildfs2rm( pnu)aetrio tadoaDe n s;() 2toio ny1llt lictl(faDtmxmoot4altomoetld aDulums;()tltrxfciadlpDr i sls)trxo(r nodalenlictasf Durxmont1alen feiadlaDuauvpn()tetrmo3iy1opDeli s;( t2xmio3ou4omenmnei s)s2tax  ;o1oexomiciysfs2uanmo u0trenxo iodop  lues (0trurirpiy1alte fctlt  2rr( p;o1oeen ieiysla2ra(mp;t0tetrif3todfm ran slt srumxo iu1amt lfeslt s2ra( onu1olt iiciys m ra( o;u4aleoxf oytoa rau o;s0 eumir3ou1alen nesatfarta(ro;u1ope mieiys mDran snu0 renmo3iadfptr nes t)t2tmir3ny4lle lfvia(f Dtaumont4opxomoetadla ra(msn(4treoir oodlatrlneo t  2uoxrpiudlmt  fcta(  Dum(rpnu0olt io3iltlm eanvsn(0 lxrmociatomt ai ols  ruo(o3no1al e icia(  2rmxro;t0apeomfeias aDrmu o;(0 rxoxf3oytopDr nei;t)s2umxr3no4ap e ivsls)artmu ont1olto ictydfa2ul( pnt0teeoif3tytomtrlies s)sexrir iodom emfes s arrr(mpnt1olx  oetyt mDean o (4texrio ootfat  neo t0trtoxmpno1lltelfcsl(fa2umxrp;u1tpxnmf3iasfs2rau s;t4 rtnmo iydfp  anvo t t2toimpiy1ameemfesls)sDumumpoo0teto oeiyt aDran o (4treoifcoytlp   i i s tetrirpnydom  mfvsltf 2rrxrp;o0tpeoiociysfm2rlumpn() lxrirctytopt ai i ( t2xrxrpny1ol  mfes t) 2rm(mont0tetnifctldfaDrmuvo u)trtrif3ty1fa r nvo s)t2xrxr ou1am nliet tfsDrr(r no1oee mfeildfa um( o;u0 rerxfciadfmte i o ( tetr(o3oudal   nvs (  2tmurpno4tpxoii3tld s2uanmp t4arxoxo3iadfaDeanvi t trxm(m oo4oltelfctas  Drr(  nt0oetn o3iysfm2rm( o;u)trtoio3oytfmt  uvo s)t2uo(m3ny4ale micils s2ua(m ;u1oexnif3iasfaDeanms u) lxoxf3oa1lm eaiesl(  exmiopno4lptelfeta()arrr(rpoo1aet io3tydlm umumo;u0tlxomfcoodom e ueo;( t2xoirpoydlleemfvt (  rurx pot4tex  o3iysfs2rm(mo (0 rxomf iotfat aues t0sexmir3ou4alt  ies t)sruru oou4teenmf3iaslmDumn s;t)treoifcoo1lmDr uvo;()s2tmxr3oo1ale  icsl() 2rrur oo1aexomf3iad a2uaump;u) exoif io1lptraieo;s0 2uoxrpiy1altnmicslsfa2um(mono1olt ii3iydlm emuvo () ltnxf iodlpDr nvolt0s2umim3oy4am n ivilsfs2ua(mo;o1oeenmf3iadlm em( ont4trxrxrcty1omDr iei;s  2uo(m ny1apenmietls)srrrurp;u4tpxo f3tys a em(ms;t4tleoxrciadomD lnei;t0t2uoiopio4ome mici t aDrax pou4apeomictltfsDra(vs;(0 etnmf oodfa r ueslt)seurxm iudoptn feils sruaxmpno1tex  o3iaslmDelu s;u0trtrmrctodlp  aueo;s0 2xo(opiodal nlnctls s2ua(m nt0oet  f3tytlm ul(mp t0tetrmf3oytfp   nvol()seur(mpny4ol elfeils  Dtmu ono4oltn o3ildlm raumont0 rtrmo3tadoaDe ies;s0sexrir nu4omenmnesas  Dumx  ;t0oet  oetaslmDrmu sn(4 lxnmf oy1fpDrauvols)seurxo3no1om n nvs t s2umur oo0opt mfctlt m2rmuvp u0texniociytfm rluei ()teuoxm oudoptn fcsa(farrau  no0aee mfctydls2ranvp;u)arenmo iotfmte i il() 2trim iu4lmeelivslt  rrrxmpnt0tlt  ociytfs2ra(mon(0 lxnir3oatfm ran ilt  exm(mpoydapee nes s  rurxroou4tptnmo3tld m2ul( onu4texoxf oo1fm e u s;s) 2trxo3no4ll nlietas aDuaumonu4oltomoctatfm2uanmp;t0aeenxr oo1late ueo (  rtmxm3iudam  livta(  Drrur ot1altn oeiysfs uluvp;(0arenmocoodopte ivi;(0s2xr(mpiydomeemicslt)a2rrumonu0olt moeiys s rmnmo;u0texrxociotfpDe ieils sexr(o3no1ol nlivsas)artru  ;u4olx  oeiadlmDum(vsn(0tetnxo3iotlm  aieils)sexrxr3iu1op emfvtas)sDuax o;t1oleomieiatfm eluvsnu)alxoiocoo1fmteaieo s  rxmim oo4lmt mnes (faDrr(ro;u4tetnif3ild sDeln on()tlenmo3iodlaDelivi;(  2xoxmpoy4alee fetl() 2rr(rpnu1oexomf3tatfmDran snu4trtnifcia1lmD  uvs;t0srxoxo io4ape liesl( artau oou0oleoioeiyslaDua(mo t0 exomf tatop e uvs;s)sexoim ny1opt  iet (faDumxro;u1aexn oeils aDra(vo u) lxoif3oytlaDelueo;s)srxmxrpio4ol nlfctlt) 2ra( ont4teeomicilsls uanmsn(4aetrxociadoat au o s s2umio ny1opt lfcsl(f 2tau poo4altnmicilsfm2em( pnu) exnmf oatoaD aiei;s srumim3no1ope  fes ( aDuau o;t0aetomfeiyd s rm(mp;u) rtnxfctotlp rlivsl(0s2xo(m ny4olt lies s aDurxm ;o1optniieiasfm2rl( onu4teerir ia1fmD auvo s  2uo(m oudop emfctat) rtrumpnu0opeomi3iydla uln pn(0texrxo oadla e ueil()s2urio oy4lme mfvt t)a2umx pnu1oee ifciadlsDumuvp u4texoif3iatfm e u ilt0t2toim nu4om nmnvsls a2rrxm ou0aeto ociytls2rmnmp;(0 lxrxo iotop  lnvols)t2umirpnodam nmicta(fsrta(rpno1oet if3tadla rm( o (0alerxo tydfpD auvsl(  exrxr iy1al  lfeilt arrau pou4apeo ictls aDrluvont)tlxnmo tadlaDeli ilt0 eumio3nu1al nlnci s  rtrum ;t4ole mfetltlm2um(vs;t)tlerio todop rau s s)t2xr(m oy1al   nci ( aDtr(rono4apeoio3taslsDuan s ()aleomo3iodfm eau ol(0s2triopoo4omeemicil() rurxmpou1teeoiieiatfa2umumo;u4alxomociadopDelieols0t2tr(r ny1omtnlivsa(f 2rm(  ;o4olxomietadlsDeln s t)alerio3ia1omtr ivo ()srum(mpoydlm elivs sfs2rm( ooo4apxnmocilsfa2ul( o;t0aexomfctotopteluei s srumim oy1oltnlnct tfa2tauro;u1tltomf3tydfm2emu pnt)alxrif3ta1fm eaivo t)t2ur(rpiy4ole  feiatfa2ua(m no1alt  i3tlsla uau p u0teerio3ia1faDelieil(0srxoir ou1ap e ivslt)artmxm ;o4apeomfctytfa2rln p;t4teeoxf3iy1oat lnes (  2to(m3oudll nmnetasfa2uaxrp;t4teeo f3tldlaDeauvo;(0trtnxrcty1faDraueo;t  ruoxr iy4ol  mnvtl(  2trumo;u0tptn f3ias s um( s u) lxrmr3ia1lateanvs s) eum(r3io1olenlieil() 2tmxmp;o1alt  fetadfmDea( pnt0tlenirctytfm eauvo s  rtoimpiu4alte feiat)aDuax pot1aee mf3iltla ulu p (0arermrctotoptr ieo (  rtr(rpoodlm emieiatfa2umum no0tpx  oeiasfm2el( p;() exnxf tydfp raneo;(0 2xoir3iudlmee ivtl()sDrr(mo;t0opt iietltlmDrmn pn() rxomr ty1op ranei;t sexmimpno4al nlivi sfaDrmurpno4tle  o3tatfs2rmnvon(4 etrifciatlm rli ol(0 rxrxr3iydlp nlics t)sDtmxr no1opt iietytla umnmp u)altriocoy1om   uvo t0 2xmio oy4amtn ieiasfsDtm(ront4optomf3iat s ua(vonu4teeomf3ia1laDrln olt) rtoxm nydop n nctlsf 2ur(rpno1oleomfetatla2rm(von(4aexrxrcia1omD  ivs;t  eurir3oy1amee fci tf 2trxront0alxn fctadls ua( p u4tleomf3ta1oaD  u i ( srtr(opiy4lme mfcs t) rrm(r ou0tpto i3tysfs2uan pn(4alxomrciatop eaivo;()trxmim3oydlme  icsls)s2tmx oou4aexn octyt m2ean ont4teenmrcoytomDr n il()sexm(o3oo4olt lfcilt a2rm( p;u1tpeoifctlt a ra(mpnu)aeerif3totlat livi;t)t2xo(mpny1ll   iei t a2rr( poo0aee  o3ias m2em(vp;t) etoxr ia1lm eauvs;()setoir oo4om emnvtlt)a2taurpnt0tlxnmi3tydfm2umnmp t)tetnxo iodomteaues;t0trtr(opoudlm  lnvilsf rtmxm ;t1aeenmo3iadlaDrl(monu)tltrxrcootlptelu s;t)texr(o nudlmtn fvs ()aDum(m no4oexoioeiadfa ulu o t0 etnmrciy1la ranvolt0t2xoxr3ny1optnmictatfaDurxm nu1tlt  ictad s ul(mo;(4artomr3ty1op   n o;s) ruo(r iodom   ict tfsDrr(mp;o4tptnmoeiys a2rln on() lxoir3iy1latr uesl( t2xoxo3nu1olte ivsat  2um(moou4tleomicildls rm( s;u0aexoxf3totfm rlnvo;(0srum(mpno4altemnciltfa2tmx  ou1aexnmfetadla el(vpnt0arxoif3tatlmDelieo s0 eur(r nu1al emies (fa2taur nt4oee ioctatls ra(mp;(0artrmf3ta1fa rlueo (0s2ur(o3ny4ap n fesat aDururpoo1apxo oeiadfa uluvo;u)tlxoxrctatfa   nvo;t) etmxmpnu1altn nct s) 2ur(r ot4opx  ociysfmDrmn sn(4 renmo tydlm eaueo t)s2xmirpiydlptn iei () rua(mo;o1olx mfeiadfmDra( p t4tlxoio3iotfa e nvils srtoxopio4ale  ici t) rrmxrpnt0apto fctatfa uauvsnt4treomo3tydfatrluvs s)s2um(r io4aptemivs t)arta(mpno1ale  ietydla em(vs;(4tetnmfcoodoaD  ueo s) 2toxrpoy4altnlnes ( arrm( p;o1apt mo3tyt m rln o;t)arxnxr ia1oateau s;()t2umxr3oo1omt  fesls s2umur oo0tpen i3ildfmDua(mon(0 lerio ootfaD anesl( sexmxm ny1lpe mneiasfsDrm(mpno4oleomfeiasfa2rluvpnt)artoxfctotfp ran i;( teto(mpoy1am emnetasfaDtm( p;o4alt  o3iadfaDem(vp;t) eeoif tatomDr u ols)trtoio3ny1omeelici (fa2tmumpnt4oee ifetysfa eaumpnt)alerxo3tytopDeaivolt0s2xm(mpiy4am e nci tf rrr( o;t4oeenmocils sDrlu o;t0aetnxo io1la eai s;s0seto(o3oy4opee ietl(faDtmu ooo0alenioeils a2eanmpn(4aeenmo ty1fpDe i o;s0 2urir nudale  nctas sDur(m no1tptoif3iysfa2um(ms;u)artoxf todopD aueo;t srxmxo oo1lmtnlivta(fs2ta(  no4oetnmieiad aDemnmo u0aetomo3ootfmt  ivo t0setr(mpio1lltemivi s srum(  no0aleo octls s umu s;t) exomo oo1laDe uvi;t) 2xoirpio4lpenlfct t)aDrm(mpoo0apeoii3tld sDrluvo t) ltomo3iotomte uvi ()s2xoxr3no4llen netltf rtm(ro;u1oleo o3iytfmDrmuvp u4tlenif3iatlpDr n s;t seuoirpoy1om e iei ()artmu ont4ole mf3iytfaDeauvs;(0texnmrctodlateluvs s0 rtrxm oy4altelnctas)s2urx p;o0oltnioctadlm2ra(vo t) lermfciodfm  li ils)sexmxm oo1lmtelnesa( sDraum ;u1oltnifcildfm2elu s;u4 ltrxociytomtrlivo t)trurir no1lm nlicilt)artr(mp;t0oexniictytla2elnmo;u4tetnio ta1opD  nvo ( srxmxrpny1lltnlnctasfarurxmpno4tex  oetadfmDranmsnu4tltnxr iadfaD aiesls trtoxm no1ole micsl(fartmu p;t4texnmf3ildls ea(vsn(4tetoxf oo1lmt lues s0 2trirpoodlp   ncsa( s2tm(m no1tpe io3iysls2em(mp (4trxomf iodfmtrluvi;s0t2umio io1amen netls)srurumpnt4oeeniieiyslmDraumsnt4 rerio3iotoat lnes t srumir3iudapt mnvt t a2rrxmp;o0tet mf3iyd m2rlu ont4aeeniocoodoaDrluvil(0 etr(r3ou1omtn fvt sfsDtmx  ou0tpenmictydlm umums u0trxoxr tatfpD lnes t)s2tr(opnu4lptn ivt s  2umur ot1tpx io3iytlsDrmu p;t)tltomo3iadfmtrlnvo s0s2trim3ny4ll  livtltfarra(mono1apeo i3iadls rlumpnt) rtomr tydfmD lnei ()t2xrxmpiydolt lnet t) 2ur(m ;o4tptoii3iyt mDumumpnu0alxoio to1fmtelnes;()t2uoim3iudamte ici t sDtrumo;o4aleoiictydlsDuanmpn() reomo3todoptraues (  rumxr3io4amee fcilsfarurx p;t1tlxn ocilsla2ulu p t)arenir3oo1fa  au s t t2xoxm3iydll emfvilt arumxmooo1tpx mf3iydls eau s u4aetrxr3iytfp   n o t)s2xrxo iodlmeeliei s aDtmur ;t4aee  fctatfsDrl(msnt4trxnxo ta1oat lneols)t2to(m3nudop  lfct tfa2rm(  ;o0alxo ieiltfm ranvon(4altomrctodlpDelu s;t  2xoir iu4lm elnciatfaDurump;u0aetnmociatlm rm( snt)alxoxociydfm eauvs s)sexr(o oudapt mivsatfsrrruroot0altnmi3tatla ea( pn(0 eeoirciatlmDrlivil( s2uoxm3oy1aleemneiltfa2trxrpot1aet  f3ilt a2emump (0tetoif tadomDeln s;t sexr(r3oy4altelneil(faDta( p;u4oeeomietys s2uanvs;t)tltnmoctydlm rau i t0tetr(o3iy4ame lfetl(fa2urx pou0olxnmoctlsls emumo t4 renif3ia1fm rli i s)texm(mpnodlmt mncs tfartau  no0opto i3tldfmDemnvs;(4 rtrxr oadlmD  ieo t) eumxm oodape lnei (faDrmx oou1tpxnifetls a ul(mp ()trtrmrcootfm r nes;( t2uoxo oodol e fvsltf 2rru ooo0aeenmo3tldla ul(vsnu)aetoxfcoo1fa eaivi s tetrxmpou1lme  ncsas aDtmu oou4teenmo3tatfm2uan p () lxoxrcootfatranes;s0 2urxr iy1ap nlfeslt)artmxm ou4tlx mfeiltfs rau o u)trxoxr io1fp  luei;s)s2uo(o3oo1aleemfeta( a2um(m ;t4tpxomoeild aDeau s u0aetnxrcoo1op  ln il(0t2urio3oydlpenmicta(  Dtm( pnt1olx mfetad aDuluvp;t)tlenxo3ootlp   n o;()t2trxo ny1ap nmfvias  2taur ou0oltomf3ias a2rmnmon(4trenir ty1opDr uvo ()seuo(o3nudopenlfvi (  2tm(m ;o0oexnmoctlslm rlnmp t) ltrir todfm rlnvi s0teumxmpou1llte nciasfs2tax  nt0tee ii3tlsfs eaump;t0aetrmo iodfa eliesl(0trtrxo ny1al elici (  Drm(rono0tee mo3tytlm2eauvo;u4artrxr iotomD  n ols) 2xo(opny1om n nctls arua(r ;o0opxoif3ils mDum( ont) eermf3oytlm  ai o;s  rxr(rpiydlp  lict (f Drmumpot1aptomf3iadfmDumu pnt0 eenmocoytlm  auei t0 2xoxm3iydlpt lnes (  Dtrx poo4alt  o3iyd mDel( s t)tleoxrcty1oat  n i;t0 rtmio3oo4olenlfes (f 2urx o;u0opeo fciatfmDum(vs;(0teenmfcootoa eanvs;(0sexrxo oy1olt lfvi t)s2tmxmono4apeoio3iltfa ra(vo;u4 exrxo ootlp eau o;() rxrir oy1alenmfeils)s2um( pnu4tetomfeilt a2elnmpnt) exnmr iytfmt ln i s)s2urxr no4omeemnesa()srurxm nu1tltn fciysfsDuau p t) ltoxo3oa1fp eauvols  eumxopoy4lp nmnetltf 2tmu  ;o4apt mi3ildls2eln o;u4 etrxr iydfm  aneo t)srxrim3oudlmt lfci tf Draxrpnu0aexnmf3ias a rmu p t0trxrxo3tytlptr u olt0t2tmiopoo1ape lfet sfaruaxrp;t4opx ifctad s2ulu on()tlenir oa1laDrlieols0seuoxmpno1aptnmfet t a2raumont0oexomfeiatfs rlu ont4tetoxf3iytfa r nvs s0 euo(o3iodoptelivtas)a2uaxmo;t0texomoeiys a2ran p (4texrir3oatlaD ai olt)teurim3iodopee iet s) 2raum no1oltoiictlsfs rm( onu0texnxr ootfpte neo;( srxoim3iudol n fviatfsrrrxmp;t0apx ii3ias s umumo;(0 ltoxo3tatfat lu i;() rxmiopio1omtnlnetatfsDta(mp;t0openmfeiltfa2ul(vs;(0 reoxf ta1lptrlivsls)trurxrpiodamte netls aDuaumo;t1tet iictld aDuau s;(4 etoxf oa1lm rln i s0 rxoirpnodlpen fetl()sDtr(m nt1openioeiat mDulnms;t0 rxoxociodlmteai s s0teumxr oodlmt mfcslsf 2umxr oo0olenii3iadfs rluvs () reniocoo1fpt anvs;()s2ur(m3oy1am emiviat) Drm(ronu1ale ifetyt a2ran p;() lerxrcio1laDeauei;t) 2um(opnudll nlicsatfa2tau pno4oexomfciatla2umnmp;u0aleoxocio1fm elu o;s)srtr(opoydlptemncilsfaDra(m no1aeeo feiyd mDrmnvsnt0trtoxrcia1fpDean ols trurxr3nudlm elfetltf Duau ono4alenmf3iad s2rau o u4 exrmf3oydla elu sls tetoxr oo4ape  feias)a2um(m ou0apxomoetyt aDumuvpnu0tltomf3totla rlnes;t seumimpio4ol emnvs s) 2tm( onu4aeto f3tasla umnmp t)teerxocoodfa ean ols) euoxr3io4alt lnet t) rumur ;o0olx io3iyt s emuvsnt)aeenmoctytfateli s t trxoim oodol nmfct t)a2uau p;t0ale mf3taslm2rm(vo;(4trtoxrctodlm  anei s srxmirpoodll emfct ()aDua(rp;t0aetomf3iadfm2rm( pn(0 exnir3iotfm  lu s;(0 2tmxrpiu4al elnct (  rua( p;t4opeo ictlt s2ranmsnt0aexnmf ia1op  lu sls trumxm ny1aptelnes s)aruru pnu4tex mfciadls rln onu0aexoxf3ootlmDeluvs s0s2xrio io1ap nmivia()srrm( onu4apxo o3tlt aDrl( o;(0artrir3oo1lm elu o;t srurxm oo4lm nlnvs s) 2tauro;u1olx ifctldlm rmu snu0tlxoir iotomD aneols0trxo(r3io1omt miet s)srtmxro;t1oeeomieiys a2rl(mo (0tetomfciytfp elues t0setoxmpio4ome lfeslt)s2uaumpou0ale mo3iyd mDeln s;t4teenxo tadfa rlivsl()setr(rpnudole mncil(faDtmumpnu1opt moetytfm2em(vs t)alerxf3ta1la e uvi;s0 exrxo3ou4opeemfesa( artmurp;o4tltomfetadfs2ulu s;u4alerirciydlm ran i;t  2xoiopno1am emnvils sDra(rp;u0tex ii3iyt s rmums;t4tltoxr todlptr iesl(0 eumio3iu1ol  miciasfaDumxrp;t1tlxo iciytla ua(mo (4tltrxo3iy1late uei s) rxoxr3oydlpe  ivsl() Dua(m nt0oexoifetytlm ul( s (4 reomr3tatlaDelnvi;s)srtrio ou4om   nvtlt  rrm(rpno1ale miciyd mDelu s (0tlermf3to1lm r uvo;t) rto(opoo4lme  ieia() rrmxr oo0teenii3iatls eau s u0aetoxrcoatlm elieilt)trtm(rpoudome lfcilt)arraxm no4apeo fctaslm2umuvo;() leoxr tytlptrlu s;t0 2toxrpio4lle lict ( sDtru p;t4aeen f3tad aDel(vo;t)tlxnifcoytlmtraneo (0tetrxrpoodaptemfei t) rurxrpou0tlxn f3iaslm rl( p t0artrioctatopDelneo;(0t2tm(m oodop e ncs t sDrrxmpno1olxnmoctydfs umump;t0 eeoxr io1opt auesl(0truoim3io1lmtnmivi (f 2taxrpoo4tpt if3iadfa rmumo u0aetomocoadfatr n o s t2xoim3nudap emivia() 2rr(mp;o4oetnif3iyt m ean sn(4alerir3oatfaDe ies t t2uo(r3nu4om   ietlt arrrxrp;t4tpx io3tls m2rm(vonu)tetrxrciatopDe ivi;s) eumxm iu4lltnlivtat aDtau  no1apxnioeildls2umu o t) rxomo oadfp  lnes;t sexmxr3io1lpt lfvtls) 2umxro;t4oetniociysls um(ms t0 reomf iydopDrlnvsl()seurir ou1lpenmivias s2rru pnt0apxnmo3iys aDeanmp;u0trtrxr tydfpDrai s;s0seumxopnu4llt  fei ( aDra(  oo0oetoif3tltlaDelu pnu4 eeoif oodlmDelnvi;( t2toiopoodom nmici t  Dtmum oo0apen o3tls m2ea( sn(4trerxr3iadfa raneolt srxr(rpiu1lpte fvslsf Dta(ronu4tptnmo3iatla ea( s t4areoxr iotoa   uvs s)sexrxrpiudopenliei sfa2ra(mont0tex  o3tytfs2rlump;u0treomf iy1lmD an i;s)t2ur(o3oodameemiciat aDra(ro;o0tet  ociatfaDeln pnu0 lermrcoy1lpD aues t)seumxo3iodlpt  nvil(f 2umur ;u1apxomfciltfa2emnmp;() etrxf3oo1omtrluesl(0truo(opnodomtemicta(  2rru pot0opxnioeiys a rlnvo;()tetoxf3iodfmDr u slt)t2uoxo iy1lpen ivtlsfaDtmu  nt0aptnmiciysfa umnvp u0alermrctytfpt  uei;s s2xrirpou4alte ivi s arum(rp;t0oex  ieildlmDea(vs (4 rxoio totlatelnvo ()srtr(r iydlmt mfvia() 2raxrp;u1opxoii3iys a2ul( o;u0arenioctodla  livsl()s2xoirpnodame  ivslsfartrxm nu0tptoiociytfs2el(ms u)teeriocio1lmD lueo;s0s2urxo3ny4lme  ncilsfsDtm(ro;t0tpt  fciltfs2rmnvo t0aexrifcia1lm e uvils) rxmio3oy1lmtnmiet s) Dtrxmonu4opxnmfctyt aDean on()tleomf3oytoatr n s (0srtm(rpiodolt micta( srraxront1oex iicild m ea( p;u4altrifcto1oaDe ivs;s)trxrxr iu1altelnes s sDtrxm oo0texomf3iyt s2rm( pn()tlxnif3iotoa e iesls0 exmxo3oudlmtnlietlsf 2trxmoou0opeoifeias m ra( ont0aexomo ty1la rauvo;t)s2tm(r3oy1lpt livs s)arua( ont0apt miciyd m rlnmp () rtnmr oytla e ueo (0 2uoiopny1openmfcta()aDumu o;o1tetomi3ilt s rmu p;t)tlxnmr3tytfm   n s ( teumiopny1lptn fvsl(fs2raxrpno1alenmietysla eaump;t)alxoxf oo1opD ln o;s0setoiopiodopt mfcilt) rta( pnt0olx  i3tltls rlums (0altrmr tadfaD lies s)texo(m oo1aptelfetls  Durx oot0aexo octldlaDuluvp t)aexnmo3iotlpDeauvs t  etrio iydom nmivi (f Draump;t1altnio3iatlsDel(mo u0teerxfcto1lpt auvs;t0s2uoimpnodlp nmnvtlsf rtmu ont1aexomi3tys aDemnmsnu4 exrmocoytlm e i slt sruoxr3oy4op nmnvt t)s2rmx  ;o4olxoiiciadlmDea(vo u4 lxoif iytomt ai o s  etmxm nydll e nctatf Dumxmp;u0oexo octls m2umuvo;u4tlermociytlatr nes;(0 eurxr oydom   fctas  2uau pno4olt  oeiyt aDra( p;t) ltoir to1fmt anei s  2urim3ny1al emicilsf rum(  ;u4oeen feiyt sDrm( s () ltoxfciydfmD lu i s) euo(o3ou4olen nvt (  rrr( pou0oexn fciatlsDel(vo ()aexnmrcty1fa raivsls)sexm(m3nu4om  lncil() Dtmurpou4ole mo3iysla2ul(mpnu) eeomo totomteaies;( s2urxo3oydale lnvs s sDtau pno1oee miciysfmDelnmpnt)aexnmr3oy1op r uvs ( t2um(r3oydlleelnctlsfsDtmxmo;t0oetn ieiatla2em(vpn(0aleomr tytfmt  n s ()truo(m io4lpt lfvi s)aDra( oou1aleomieildfaDum(msn(0 exnir oadla   nvo t t2xoxr iudop emnvt t  2tax poo1ale mo3iat a eaumonu4arenio tatoptrlueols sexrxm3io1lmt lietl( sruru oou0oltnmf3tydlmDelumo t0 ltomo3oytfpt aivo t) 2tmxo iudaptelncsa(f Dtru ooo4tpx  fetysfa uauvs (0tlermo iotlatrlueo t  ruo(opiy4amt  fvt s aDtmxrpoo0oexnmfeiasfmDea(msnt) ltoir3oatlpDrliesls texoxrpio4amt  fviat) Dtau oot1alt  o3iadfs2raumo t0aetrmr iytlmteauvs s texoxo3iodom   nvt t srra(rpnt1tleoifctysla2rlu o u)teeoir3iy1lmD  neo;t0teuoxm nodlle mncs tfarum(mp;u4tltnmf3iatfs2rl(vont4texomr3ty1op eaneo t0sexm(m3no4lpeemfvilt aDur(r no1oex mfcilslsDrmu o;t4 rtnxocoydfa r ivsl()t2urim iudoptelnvtas  Dua(rpou0aleomfeiydfm rm(ms ()tlxrmociydlpDr ivsl(0trxmxopou4lptnlivi sf ruaxm oo0opeoio3iltlsDelu onu0aetoio3iydopDranvs s0 etm(o ny4optnlfvsa( a2rr(mpnt4olxo oeiltlsDran o;u) lxrmr3iodlpDe ieo s0 2tr(m3ny4aleemfeslt aDrm( ono0tpe iieiyd mDemu s;u4 lermo3tadopDeaies t0s2xoxm3oy4oltnmfes s s2trxmo;o0optoiicilt a2el(mp t) exrmo3oodom  lnvo t t2tr(o nu4lptnmfeta(  2rm(mpoo1openmfciysla ua(vpnt4 ltoir to1opDelnvslt)t2xoirpiodlm   ics s  2uau poo1opeoioeiasfmDel( on(0trtoxr iotfmtrluvi;(  2xrirpiudll nlnetatf 2raxm ;t1tpto oeiadfm2rl( p (4 eenio3ootomD auvslt0srxm(r3iu1op n ivia()srraxmo;t1olxomfeiltfa2rmn pnt4 etrmf3oo1oa e nes (  rtrxr io1lme licta()sruax  nt1olxn iciasla2emn p u0trtoxoctotfm r neol() 2tmxo iy4olen ivs t)arra(mpnt0opx mi3ilsfm ea( s;u) ltrxr iy1fatrai s;s0 ruoiopnu1opt  icsl() rrmumpoo1aexo o3ilt s umuvo;t4tlxomfcootopDr i o s  euoxo3nodome lnesa() 2taurp;u4olenmf3iadfs2rauvp (0tlxrxociodoatr i s;(0t2toiopoy1omt mfes (faDrrxro;o0ope  ictytfmDuluvs;u0tetnxf3todomD an olt) rtoxr io1op   nvilt) ruaxmpoo0opxomf3tad m2rlnms t)aeenmf3totlmD  nvol(0 rtm(rpny1lm n ivta()arrmumpno4tlt if3ildfm2ul(vpnt0tlerxfciotlaDrlnvolt0 2xrxmpnydlpt mfetlt  2trxm nu1tpen o3iltla2uan pnu4teenxo oatoate uei s sexm(m oudal  lnetat srraxm ;u1oleomfctlsfs ulnmon(0tlenmo3ta1lm elu olt srumxmpoo1omee fvs sfsrra(mpnu0tpen ociat a2um(msn(0 reoif3iy1om eaues;t truoxmpio1lmee nct t) 2taxr oo0altoii3ils aDuau sn() etnxr3iy1la r ivo;s setm(r ny1ll nliesls) Drax p;t1tltomfeiadls uln o u4alerifciadop e i ilt) eurxo io1oltemfetl(fsDrm(m ot4apt  ietytla uanvp u4trxnmr iodfm   ieo;(0srumim no4ll  lnetl() rta(  nu0tlxnmfeiasls elnmo;()tltnmf oatfm  auei;() exo(rpiy1openlnes s)srraxm ;t4tpe moeiydfm eau p;t0aetoxfctodopD anesl( trxm(o nodaptelncs sfsrrau ooo1teeomociltlm2ra( p;(0treoxrcoytfmDrln o t t2xmxo nodoleemncsas  Drmx  ;t1tptnif3iatls um(mo t)aeermr3totop e ivs;(0trxrxr oy1om emnvias)s2rr( onu4olenmoctlt a2uauvs u0arerif tadomDr n o;s  2trim iy4lmt mnvias) rurxm ;t4tlxn i3ildls ranvont)treoxfctydoatean slt0 exoir3nu1alt mnvs s) Drmurpnt0aexomi3tltls ean pnt0alxoxf3oadlmte i s;( texmim ny4lm  lnct (fs2umumpot4aeeoii3tysfm ranmp;u0tltrircoa1lmDeluvo t srtoio oudlmenmivta(fsruaxr oo1aexn fciysfaDrm( o ()texoio tydfpDr u ol()teur(o oo4ol nmfeiltf Drmx ooo0oeto fctlt m2ra(mpnt0trtoxfctadoaDran s;t)sexmxm oy4oleemfvilsfsrua(rpoo1teto oeiytls2ra( s t)texnxo3oa1late nvi t0sexrio oydape mieiat)arta(  ;u4ape iietasfa ulnmo;u0 lxnxo3ta1oate ivols0srtoirpnodlmt liesat  rumx  ;u0opxomf3iasfmDuluvp;t) etnmr3ta1fa raivs ( trtoxm3ny4ap nlivtasfaDrmu ont1teto ieiltlaDrlump;(4trtoio oydlaD  uvslt)seuoxo3iy4lmenlicslsf rtaxront0tlxoiieiydlaDra(mo;t0 lerxr3tatoptrai s;(0teur(r3iydlm n ncslsf rtmum ot4tptnmfctlsfs rln s u) rtnxocoy1laDean i ()srxrirpnodlle  fcs (f rraxm nu1tltnmf3iadfm rln p;u4 renxrctytfa   nei;()sexrim nudllenmfvsl(fsrtm(m ou4oet ifctasfs2ua( p (4teeoxo oodlmDr i s;t)t2ur(mpou1ole  ivt s)a2rmu  ot4alto ieiytla2rlumo;u0aetrxfctatla eli o s0truoxopoodalt  nci sfartmur ou4oltnii3ildlsDumuvo u)alxoxo ta1lm  livo ()tetoxo ou4lp   fet s a2uru  nt0tle ioeiasla2umuvs t)trxnxr3iatlaD  uvols) etr(m iu4op emicia()aDrm(m no4tpeniiciyd s2umuvo t0 reoio3iatfaD lnvs;()trto(r3nu1olee neiat) 2urx p;o4ope  fetytfm rmump u)tleomf oatomtranvs s s2xm(opnudolenmncsa(f rtrx  no4tpt ifctyd s uln s;u) exriocoodfpDr i o (0 etr(o3oy1lm  mietls) Dtrxr ;o0optoioetlslaDranmp;u4trtnmf oatoaD luvsl()t2xmim nudap  mfet t)aDtrumono1oeeoioeiasfs rm(vo (0 exoxr tatlpt anes;s sruoxm oudlp elnvsasfsDtr(r ;u4oee iietldfm rmn s;(0teenmf3oatfmt  i o;t) 2xrxr3iy4llee nci s a2tm(ro;t0ope  iciydfa2rm(vs;(4arxrxf totfmDraivo;()t2uoiopoudom e ivslt arumxmooo1oexoif3tysls2rmu pnu4 reoxo ia1om eln s;s srumir3nu1ll  lfcs () Dta(r oo4opxnmfctlsfaDumn snt4alxoircoydfateai s t)texm(o ou1lle lnctl(fsDtr(ront1opt iicils m2rl( ont)trtoif3oo1lpDrlivo;( srtm(o3ny1amte iei ()aDtax poo1tet iieildlmDrl(vp;(4 rtnmfcoydlat  iei ( s2xm(mpiudlp emnctas)sDrrxmooo4tltoifciltlm umuvs u0aetrxrciydfpt aueol(0sexmxm iydape lfvi t) 2tmxr oo1aexnmfctad m em(msnt4trtrio3oodop rli i s0 2xrxm iudll emictls) Draxmo;u0olto icildla2eanmonu4 renxr3oodla  ln ilt  rtrirpoo1lmen ies (f 2tax pno4opt  i3iyd aDuanvo ()tleomfcto1lm r n s;s  rxrxopnu4al nlnvsa(f rrrumpou4aex mfcildlsDul(vp;u) exrxoctytfa   i o;(0seur(m3oo1lme lfciatf rumxrpno1olen ieiadfaDuaumo t0 rtnxfctodfpt lueo ( t2uoxm io4al  miei s)aDraumpnu0alen oeiytls el( o (0 exrmfcoydoaDrlu o;s seumio ny1lltnlneiat)srtauroou1aptn f3tlslm ua( o u0treomf oydla eaivo;( s2toim3nodlp n net t)s2ra(  oo1tet  o3ild a um( p u4areoxf iotlpD  n i;t0 exmir3oy4apt mnei t srurxr nu1aexnii3iat m2elumpnu)aexrxf3tydfat  ieolt  eurio oydomtn nvtlsfsDraumonu0teenifcilsfs ra( p t4alxrio3oodopD lneils0s2toim3iodllen ivi ()arrmxmo;o4oetomi3ild m ran s;u4 etrxrctytlmDe n s;()s2trxm3iy1lmt mivt t s2tmxro;o4tetnioeiltlaDulnvpnt0trxnxo totoa  lnvilt0 etr(opiu4opeelfcias aDra( ont1tptn octasfa2rluvp;t0tetrifcoo1opDeliei;s texr(opnudolenmnetat  Dumxmpnt4tleoioeiadfsDrlnvp ()arxnir3oa1opDeauei;( trumxr oudaleemietlt) 2rr( p;u4tpeoio3tldfm emuvpnt4artrio3iadfm rau o;t  rtmxm3nu4omte ictas a2uau  nt1oltn iciltla2ua(mo;u0trtrxr oy1omt  ies;t)s2urimpiydap elfcslt  Dtrurpoo0tlxo o3iltfa rluvo t0aexrmrctadopDr i o t  ruo(m3nu1lp   ieiat srrm(m ;t0tpto ictadls uln o;(0 rtoioctatlmt lueol(0t2tm(r iu1lmtn ivsa(fs2tmuro;o0alxoiietas sDeluvp u)trtnmo tatlptrlnvi t)s2xrxo no4opt mncia( arrmur ou1tpx ii3tas a2em( p u0treomf3iatfaD  ueil(0 2xr(m no1om  mncilt sDrmxroou4olxomoetadfaDuluvonu) eermr tatlp rliei ( trurxo3ny4ope mict t s2uauroot1ale  f3tydfs em(vo t)texnxfcoadoa r n o;()sexoxr3oo4ape  ivsa()sDta(r nu4tet ifciatfaDulu s;t)aetrxrctydoatrluvi (0s2tr(o oydlp e fvtl()arrrum ot4texnmieiad aDemump u0aeenmf oa1la  ln s;s t2xm(mpoydomt liei sf rtrxmoou4tet  i3ilslsDemuvpnu) lxomo3totomteluvsls0sruoxo no4ol  lnes t aruru ooo1olxn ociytfa rlnvs;(4tetnmr oo1lpD aivs (0 exoxrpoydoptnlnvtlt)s2tr(rpnt4oexoio3iatlsDea( p;(0aleomf3iydfaDe i o t) 2umxr ou4altelfesl( s2ua( poo4aeto iciltfs2rmn o;t4 rtomr iodla rlivs;s) rxmxr3iy4lltelnvsasfsDuax  oo1aleo octas m rln on(4 lxomo3tytfp eaiei;t) eumio io1amen iet s)sDtr(  ;t4tpto ocilt s2el(mo u)artoio3iodfpteanvi;( sexoxm nudopt mfes s)a2tr( ont1alx iociytla rm(msn(0altnxrcoadlpD au i ()t2tmxm3oy4aptnlnvslsfsrrr(mono4altniocildfm2ea(vp;u4 etrioctodfpt ln o;s)teuoxr3nodlmtn fvil(faDrau ont0oet mfeiytls2rlnmo t)alenif3oo1fat  uvils teuo(opiy1oltnlnct ()sDrr(rpot0alxoio3iyd s2ul(vpnu4aetnxfcoatfptr u ilt0sexo(m3oy4om emfcsltf Drrurpno0texnif3iltls2elnmo (0trtrmr oo1fpDrlies ()t2tmxr3oydap emnvta(  Duau ont4teeoiiciydfm2rmump;(4aetrxo tatom eaueilt0 exoio3no4ll
\ No newline at end of file
@@ -0,0 +1 @@
+u ils)sexoirpny4llt  nvsa()sDrmu ono1aeenmi3iadfa2eau pnu4aetrir ty1fmD  u o;t)sexmir3nydlptn ivslt)a2uru poo1aex mfetytfm2uau p;(0 reoxfcoo1fm rlueilt0sexmirpny4ameelnvil()sDrmum ;t0apx  feiasls umnvs u0texnxf iadfmD  ues s teur(m iu4alte fvia(fs2trxr ;u4opt  oeiyd a rmnmsnu)tetnif3tadomDe i il() 2um(m iudlleelieia()srra(ro;t0alx if3iltls2ua( snt) ltnif3totlm  luvi t srxmxo oo4ale lieil( srrau ooo0oexn ietat s el(mo;u0tlxomoctytlatr nvo;(0truoir oy1am elnvtl(fsDrmx poo0tpxomiciat m2ea(mpnu0trtomr3ty1latelnei t) 2xmio no4llt lncs t) rtr( oou4apxomi3iatlaDean o;t4 etnxocto1fm rai i;t)t2tmiopou1olen icta(fs2ra(  nt1oetn oeildls ul(vo;u4arerxfcootfpD auesl(0srurimpiy1omtemfvia(f Drmxr ;o4tle  feiydfa2emn p;t0treoiociotfpDelnvols0setoxo nu4olen nes t) Drru  nt0alx if3tad s2emnvs;(4 reoxf3iodlmDeln i;(  exoim iy1oleelnvtls artm(rpot4opeoifciltlmDul(ms u0tetnmr3io1omtr i sls)seum(r oo4aptn ies () Dtrx oou1tpeomf3tls a ea(mo t0 renxfcoodla raivils0tetoxopny4ol emicsa()a2tmu onu4tetn oetlsfm2ulnvp;u4aleomfcootomtr uvi;t)t2umio3iy1al   fesls aDua( p;o1aleo i3tadfaDeau sn(0aexnio3iatlm   i s;t0 euoxrpiy4ll e iciltfaDurx  ;o4aptoifciasfm2um(vp;u0tlxrxocoa1fptran o t0s2toxm nu4opee ncias)sruru  ;u0aexn oetytla2ulnmo;t)treomfcootlptrlivo (0seumxr oy1amtnmnei t  2tmur no4tlx mo3iydls ra(mp;t)trxrxf iadom e uvol( teumxr io1omeemfei sfsDtmxmono1tltnmf3iyd s2eauvpn(0trxnxocoytoaDe i o ()srxrxrpiydolt mneias)sDrrx  ou0aex io3iltlsDrl(mo u4tleomo3oytfaD aueo s  rurxrpio4lptelnvil(  2taxm ;o1alx ifciyt s2rl(vpnt4 eeoxfciydlmDr ieslt teurxo3oydaltemnvil() Dumuront0oltoifeiltla um( s;u)trxnxr3iodla   n i ( srtrir ou4op n nes ( arum( pou0oexoiocildfmDrl(mo;()tltrxf tadfa e nei () etrxo no4al elnct (f 2umxmoot0tlxnmoctyd mDrlnvsnt) rxomf iadfmDr uvi;()trtr(m iy4lleelfetas) rum( oou1texo fcilsla ra(ms t4 exomrciadfa   i o () 2xrimpny4lp emnctlsfarrmum ;u1tlxnmf3iytls2ra(vs () etoif3ootoat ai i;t s2toxrpio4ll  lfeta()srrmumoou0aptnmietadlmDeau on()aetrxocoadfmteanvi s  euo(m3iu4oltn nesl(f Dtm( p;u1tpeniociaslsDul( snt4arxoxr oatop ran o;s0teuoir oy4op n ivias) 2umump;t1apxnmfctasfm2ul(mp;t4texrxo3tytom  li olt t2uoir3ou4omte fviat s2tru pno4alxo ociyd a rluvs;u4texrio ty1laD an sl( srxm(o3iydoltemivsa(f 2urxr no4alxnmfciad mDua( p;(4 lenif3io1fpt lues;(0s2tmio nudomee fctls sDrmxr ou4tex iociysfs eaump;t0aetrif to1lmDeau o;t0s2xoimpio4aptemfvsat) rua(ro;o4oltoiictyt mDum(mpn(4trtrmf tadlaDe ueolt0trumir3ou1ome lies ( artm( oot4ope io3iaslsDuau pnu4treomoctadomD  nvs;t  rxoimpiy4ol  mnvt ( srtrurpnt0tee  ieiytfsDrm(vpn(0tlxnio ia1fmDr u slt)s2um(o3io1optemivtlsf Drax ont1tpxnmfeiadlm eanmsnt)texrir3ia1om r ivilt)trxoxr oy1op nmiet tfaDtaxrooo1apto i3iasfm2uan s;(4 ltnxo ta1lm  aneolt  ruoxopny4amen ietas  rur(ro;u4opeo f3iltfsDumumonu)aeeoxr oa1fm r nei;t0s2xo(mpnu4optelnetl( aDum(rp;t0tpx iieiatlaDrl( pnt4 eerxoctotomtelueolt) 2xrirpou4am  lncsa()aDtaum ;o0aex mieils s2rau onu)aeeoxf ootlat an il(0s2uo(o3oy4ap nlicil(fs2ra(mo;t1ope  iciysfaDrauvo;(4arxrifciydomDe ivols  2tr(o3ny4op  mncsat)srra(mono1tpxn iciatfaDea(mo t4 exoircoo1lm rlivols0t2tmxm ny4ll  livia() rta(mp;t1teen i3ilt s rluvo u0alxrmocta1opD au o;s0s2tmio3io1amte ictls s2rax poo1oleoiictad sDrl(mo t0aetnxfcootfmtranvi;t s2trxr ny1lp   fes sf Dtr( o;t4oltomoctltfa rmump;t0 rtoxo iy1lpt lneslt) rxoim3oo4ole mnetls)s2ra(r ot4aeen ietysls2umnmp u4altrif oodomteln ilt0srtmxo3iy1lptemneilt  2ta(rono1aee  fciydlm2em( p t)trxoifcoodlmteaueo;s)teto(rpoodomtemncsasfa2uauro;u0texnmi3iad a em(vs t0trxoxr oo1op eluvs;t)srur(rpoo1lle lictlsfs2tmumpnt1aetnifeiyd s2ulnmo;u0tetnirctodlatelivs;t0t2toiopnydlmte iet sf Dtrxmp;o0oeeo i3tytfa ul( s;t4 rxrmr3tytlmD  u o;s)seto(o iudlmt  ietatf 2raxm nt0olenio3tytla2rmumont0trerif3todlaDeanes;t)setmir3ny4op  lieiat sruaxro;t1tpt mfciydfa2emnvpn(0teeoxo oadfaDe ivi;s) ruo(r io1lm nlivs t sDrau  oo1texo ociyslaDumnvp;t)aexoio iadlmDrlnvol(  etoir3no1ome  fvsl(faDrmumo;o1tpto fetaslsDeauvs t4trtoxo3tatfp e ivol( tetmim3iudam   ici ()arra(mpnt0oeen i3tadlsDeanmo t0 rtnxo oy1fptelnvolt) eurir iy1alt livtlsf 2taum ou0texoifeiatlm2rmnms u4aeermfcoa1omtrluei;s)seto(m oo1omtnmivi ()sDumumpoo1tpenmo3tlslmDrlnmsnt4aexomoctatfa  aivs;t)seumxmpnudap  livs s sruru  ;o4aetnmieiadfa rlnvs;(0 lxrxfciy1oateli o;()sruoxm io1om  mfcslsfarum(mp;t1oltn ocildfs2ul( snt0trenio3iatfmDeai i ()t2tmxr iy1al nmnvs t aDtm(r ot0tlxnmfeiyd a ea(vp;(4artrxo3iytfpDr ues t0 exmir nodom  livil()aDur(m no0apxnmfcias a2emn s;()altoifciadlaDe neo;(  2uoiopiydolen iei s) rumx ooo1tee  ociadlsDelnmon(0alenmocto1omDr ieo ( trtmim iy4llen fesat)a2tmuro;o0tpxo o3iad mDrm( o;() exnxrcoytfm r u s t trxo(opnu1llt lfctlt a2raxmpot1texn f3tysfa2umump;u4trtrxo3tatfatean i t0texo(o ou4altnlivsas) 2rmumo;t4oetnioetlt sDrl(mo;u4 lenir iatfa  auvi;(0s2to(m3nu4alt  nesa( aDtrx pot0tee mf3iyt m2ul(von(0 exnxrcio1op rlnvsls seurxr oy1lpee iei sfsDrr(ro;u0tpe mfeildlaDem(mpnu4tlermo iotopDeln s s0 2umir ou1lpeemnvias  rurxmp;t0ale  ocildla uauvonu4teeomo tadoa e neols  2tmio3nydom nlfet t)srtrumpnt0olto iciyd a ulnvs u)aeeomfcoy1lpDe i i t0 2ur(o3nydaltelfvs ()a2um( ooo4aex  ociytfsDea( s;u4trxrxfcio1la  lies;s)teuoim ou1llte nes tfs2ur( o;u0tlxo fcilslaDea(vs;(4tlxnmfcoa1fm  lnes;()s2xrio3iu4lpen iesas) rumxrooo0olxoif3iatfa uaums u0aetrmo3tadlp  li o (  2um(mpnodop   fetlsfsDra(monu4teenio3ilsfm ra(vs u4tlxoxf3tytlp raiesls  rum(rpou4lptnmnviltf rrax  ;o1oee  f3ilsfs2rlu o;(4 ltrxf oodfa   u o ( trtrio oodlp elivtl()aDrau o;u1texomieild a emumo;u4 exnmr io1fmtranvols0s2urxm oo1lp e ncsa() Dtrurp;o0olt moetytlm2um(vpnu4arxrxo oo1laDeaivsl()seuo(o3oo4ll n fcslt)arurxm ou0oeenifctldla2uau o;(4 exnio iatoaDeanvo;(0s2urxopoy1olt mfcslsf Drmxmpot1opx  fciasfaDua( o;t4teerxrcta1opDr ieslt)s2to(mpoudomtemnvi s)srtm(monu4ole  ociytlm eauvp t0altrxrcoydfptelivs;t srtoxopou4am n ncs tfsrrr( ooo1tle mi3iytfm uaumo t4trxrxociydlatrlivs t0trtoimpoy4lme mieslsf Dtr(r ou0tptomi3tydfm2umnvsnu0 lxrmr3oodomD  ieilt0s2xm(rpoo4opee netls sDua(r ;t4opx  fctyslmDea(mp u0treoio ootoaD lues;s0setrxmpio4ol nmicsasf Dta(moou1tlenmoctltfm2ulnmo;t4 lermo tatfpt auvils)seurxo3nudapeelnvslt)a2taxm nt0tetnmf3tyslmDeau sn(0tltomrctatfmDr nvo t sexmxo oudop  livs (  2rmuroou1opxnmociydfs2rlumo;t) ltnxf iadlm eai s;()setoxm3oodomeelncia( srraurpnu4opx mo3tydfsDulnvp u4 exrifciotoaDr nvi ( texr(rpnu4lptn fei s  rumurono1altnmi3tlslm elnmp;u4texrmfciadlptelu olt)s2xmxopoydlp n fvt t s2ua( poo4aetnii3iyt a eanmp;(0tlxoif3iy1lmte i ilt)t2toxr iudome lnvsasfarrmxr ;t0tex mo3iys a ea(msn()alerxf3iotlatrauvsl( t2trir3nu1am nmivtas  rraxmpno1aexo fctytfa emumo u4tltrir ia1faDr i ols0 etmimpnydapeemivia() 2urx ooo4aleoii3tadfs uanvpnt0trxomf oydomDeli s;s sexo(m3nydop n ivtat)arra(m ot0teeoioeiltlm ua( sn(0tleomo iydomt auvs;(  2uo(r no1om elfctlt)a2umxr oo4tlt  o3ildfm em( o ()aexnio oadfmtelu olt0sexr(rpoudopt liesat srra( p;u1optnmf3iadfm2rlnvon(0 exrxf iotlat ln i s0t2ur(r nu1op n nviasfaDra(rp;o0aetoif3tydlmDel(mont0alxomo oodlptr u ols sexoim iu4opt  fvsatfs2uaxmp;t0aex mfciysla2ra(mo t4aetnxr3tytomDe nei t) 2umxr no4lmtelicsls)arur(moot0oet ii3ildfsDelu pn(4artrif ty1lpDe ivsls0trxo(m ou4ol e ieta() rur(m ou1oetoiieiltfs ea(mp;t0altoifcio1fmDrlneo;s  rtriopiy1ol nlivi (fa2rau  no4aetnmf3iad s2ra(msn()tetrmo iy1lmD aieo;( t2umxmpnu4om nmfvil()a2rm( o;u4tpxo i3tltlaDeln o () ltrxf3ta1oa rlneo;s0tetmxopoodamtnmfvias sDtrx  ot4tptnifeilslsDuanmo u) rtoxr3oy1oatr iei t srtoir nu1omtnmnvt tfsrrrxmpou4tpx  icildfa2rauvs;t)arxnmr tydfmt  ieils0s2xmir3ny1opte nei (f Duaxrpnu4tltoio3tlsls2raump;(4 leoxocoodopD lnvs t)sexm(r3io1op nmnetl(  rumu  ;u4aeeomf3taslsDrauvp u) rtrir oydfp rau o s s2xoiopou1ol   ieil()a2tau pnt1alxnio3iytlm ulnms;(0trxnxo3oodlp e uei;(0trxm(r iodlp nmicil() rum( poo1texn o3iasls2uanmp;(4 lxnxr3tatlmDe ueilt0trumim3no1am e icsasfsrrru ono4tle  i3iat a elnmpnt)tlerir tytlp eau o;t0s2xrio3oo4lp   nes s a2tmumo;o1altniictlsfsDua(vo u0teeoxr3oydlpDr nes;t trtmxmpny1am e fvtls) 2trxmpou1oexn f3iytfs2ulumo u0 rtoxf3oatopDe u i;t setoxm oy1apt mfet ()artr(r ;o0oleo f3tadfm2eau pnt4aeerxo3iadlmtran o ()t2xrir3ny1lp  mnvsa( sDta(rp;o4oetn f3iatlmDum( s;u0areoxocoadfpDrlivi t)trtoxr3nudomtnlnvsas aDuaxmoot1tlt mf3tltfs2umu s t0arxrxf tatfp e neo;t0srxoxr3oodlpeelnei tfa2rax  ;o4tlx ioeilsla2elnvpnt0texrio oy1faD lieol(0 2uoimpny1lmtn nci t) 2taum nt1texo fctadlm2rluvs;t) lxrxf3iy1fmtean sls0 rxriopnu1aptnmieils)aDtax  ou4oexo i3iydfsDua(mo;() rtoirciy1fmDe nes s)t2urirpiudap n ics s s2raxmonu1alxomfctat m2rln s;u4 lxrir3ta1fate nvils)tetm(r3io1apeelivsas)aDta(ronu0tleomiciltfa2rm(mont) exnxf tydlm elues ( srumxo3io1opee ncilt) 2um(mpnu4tee ioctyd mDuaumsnu) lxoxf3tatfp eaieo;s  rxoirpnydome mivi t)arrmumpnu4alxn ictydls emnmo;t4arerirciodoatrlnesl()texm(rpou4lltnmnet sf Dua( pnu1oex ii3iaslsDrluvo;u4arxrmr oo1fateauvs s0s2uoxr3no4ol emnes ()aDuaurpou0apxnmicias m2eanmon(4aexnmo oy1omtraieol(  2xmir iudale lnct s)artr(r nu4oltn f3ildfs2rl( p;u4trtnif ta1fptrlieo s teumio nodol nlfvsa( sDta(mono1aexnioetat m raump () reomr3totfpDeaivils0teumxr oy4lltemnvta()aDumx onu4tlxn f3ias sDeauvs u)tetrio tatfmDr nvo;s)truoxr3no1ap  mnct ( s2um(r ;t0optnmoetadfsDra(vs;t0tltrmf iodlpD auesls0trtoxr3oo1lmeemnetls arrru  no1opeoii3tls s2emnvsn(4alenmrciatlp   i olt)s2uoir nodlp emnesa()a2ua(mo;u1alxnmo3tltfa umuvp;()arxoio oydfate n ilt  eur(r oodalen iet (fa2tmxmoot0oeeo ociysls rluvo;t) exoxo ty1fpteau ils trtrxr3nudlp emivsa(faDtmuronu4tpx ii3iatla2um( o u)tlermo iy1lm  lueol()srxm(opiu4olte feslt) 2rrxmont4olx iociltlmDeanmp;u4 rxomr oatom  livil()t2umiopoodlpt  fci s aDrr(mpno0oeeoif3iltfs2ua( s;u) ltrxr iatlmD aneo;t s2xoxopiu4al  mfvi ()aruau  ;o0alxo icilsfm ulu s t0 eerir todoa r i sls0 2to(o iodal n nviatfa2um(  ;u1opx miciad m eau p;u4teeoxr3iodlmtr n o s sexo(opio4apt mfvsas)aDuau p;t0olxomociyd s rlu o;t0aeenmr3iydfpDeanesl(  2uoxr3oo4apt lfeil()s2rmxr nu0opx mictlsfmDuanmpnt0tlerxr3iadfa rai o;t  2umxrpnu1al elnvi s) rrmxmonu4ole mfciasls rmnvs;t0trermrcoydlpDeln s s0seur(m oy1opt lfeslsfarrax  ;u1optomfeiydlsDraumont) etrxo iadlptr ivs;s  rxoim io1optnmnetat  2umur ou1aex  oetldlm uanvs (0 rerxf3io1oatrluvolt)sruoimpou4ol nlnvsltf Dra(m nu0tetn ieiadlmDeanmo (4 rtoir oatfa r i o ()teurio3oodoptnlici () rrm(mooo1aetoiocildfm2um(mont0altoif iytfm   n ilt0 exmxrpio4op nmnvilt  Drrxrpnt1oex mf3iys m2uan s ()trtrxr3ia1omtelneo;t  rtr(opio4omeelfctas sDurxrpnu0tet mociltls ran pnt4tetnxrcoydfa  lu i t)sexoiopny1altnlfcia(fa2umumpno0texomoeiyt a2ra( s;(4tetnifcio1lp rai ils0s2trir3nudomtnmncsasfarumx  oo0alxnifctyt m2elnms u0aexrio todlp r ueslt)seumim oy4omt lncta(  Drm(r ou4tpeomo3iydla rmu o (0tlxnmr oodfmte i i;() rtoxo io1lpe  fcta( sDuaxr ;u0aee ifctydfmDeaumo u0artomo iadomDr ueo s trurim iu1aleelnvtasfsDra( pno0aeenifeiytfmDul( s u)texnxf3iotop  lies;( teurio oodlp   nvslt aDtm(m ;u1tlxo oeildfs2uanvo ()trerir3oydfa  an ils srtmim3oo1lme  ncsa(f 2taur ot1oetnifciad a2ea(vp t) lerxo3io1oa e ueo s) rumir nodole mfetl()sDrr(rpnu0tptnifeiysfs rlums;t4 renmr3tadlmteluei t0 rtr(r3io4ll   ici s  Dumumooo1tlxoiociadla em(vp u4treomr iadfmD ai olt)truo(o3oudlm   ieiatfs2rmurpnt0aleo fetydfaDemuvs ()altrmo oadfp  lnvi;t0s2tmxrpnydlm emnctas sDrax poo0alxomfetls aDrlnmo;t) lxrir3tatoa  anvi t)teurir iy1ap nlivsl()srraxmo;u4oetnmociys a2rmumo u0 rtomr ootlp rau ols0srxm(r iu1lpenmivs t  rua(m ot0tpe ioeiatfmDul( on()arxnxo oy1lpDrln ilt0 rurir3nydomtn fviasfsDur(mp;u0alxo ieiyt a umnms;()trtomf3ootlmDr ieol( texoim3iy4opee ncias) rraxm ;o4oetn o3tysla2rmnmp;(0 rtnmocia1op elnei s)t2triopoo4alenmfvs ()a2um(rp;o0aexomfciytfa2rl(vo;t4alenmr3iytlat  nvo;(  euoirpoodoleeliesatfs2ua(rp;t1olxomo3tysls2ra(mp;u)tleoxf oytlmDr nes;s) 2xoxo3iydoltnlnvslt  Draumpno1oet micilsfs eaums u0artomo3iydlaDran s;t0 etmxmpiy1om e fvi (  2trx p;u0tlenmf3iatls rm( p;t0altrif iydoatrluvi;s0 rumxrpiy1lm  livtl(f rtmumoot4aet  fctld m2ua(ms;u0alermr io1oa rln il( setrxm3oudaptelict ()s2tm(mo;u1tet  ictatls2eln sn(4texnif tatlpDrlueo (0 2trxr3oodlp   nes ()srtau  ot1oex  ietlt aDul(vp u0 lxrmf3iydop eau i;s0t2tmxm ou4lp  lietltfaDuaxm nt1ape  ieils a2rmuvsn()aexrifcoa1fpD livi;s  rtrxrpnydllt mncsa(  rrr(mo;o0oee iiciyd a2emumo (0 lenxo3ia1fm eln i t0s2xo(rpoo1amt  nct () rtax pnu1olxomf3tldls uanmp;u4artnio3tadfpDean i;() 2xo(m iy4lp   feiat s2raxront4tpt  feiyt aDua(vs;(4texrir3oo1fm rli olt0 etr(rpiudoltnmfvsa(  rrmu o;u1oeen o3tyd s uanmo () leoio tytlptr uvi () rum(rpoo4altelietas)srtmum no4alto ictatfs2rlnvs;t4altomr oo1lpD  uvslt) 2umirpiy4lpe mncslt aDurur nu0oeenmiciydls rm( sn(0trtrxrctytfat ai ils) rtr(mpny4ol elnctl(f rrm(m ou4tpt ioeilt s ean p u0tlenif3oa1opDe uesl(  rxmiopny1lpeelncsas arra(mo;u4tltnmo3iyd m2ean p;t4tlxnmf to1fmDrlies;t teumim3nydame mnet s) Duaxm ou0alenifetat m2umu pnt0alxnxo3to1lptelues s  etm(r3oodapt lfvsasfa2tmurpou1altomfeiyt m2rm(vs;(0trxrio3oo1opt livilt0trto(m io1aptemfvi s)sDurxr ;o0aeen oeiadla umu ont0aeerxocoa1opDrluvolt s2to(rpoy4am  licsas)sDuaxrp;u0tpt ifetys mDranms t)tltomf oa1lm  li i s0 rxoxm3oy1opt  fct tfaDra(ro;t4tlxnmfcias a2eauvo u0 lxnxf oo1la raivils0trumiopoy4optnmicils) 2um( ono0openiieiat m2rlums;u)trtnio ia1latelueo;s) 2xm(m3nydap   nvsa( aruaum nt1tle ioctat aDulums t0tetnio to1lptraivol( s2xr(r iydopenlnes (  2rr(mpou4aeeoifetltlaDulnvon()aexnxo3iadlmtrau i ( t2xo(o iy4lltnmicslt aDrrx p;t1apt ioeiad a rln onu)tetomo3to1fm raivs (0s2xo(o nu4opeemfvtls)srtm(moou1apt  octasfs2eluvo;u)trermo ootfate u i ( sruo(opno4ome lfvias)aDua( pno4oex io3tld a2el(ms;t0texrir3ootop  anvs s sexmim iy1lm  lfcsl()sDuaump;u4aeeomfeils sDumums t) rtomf oa1oat  uvi;t  2uoir iodamen fvi () 2tau oot0aexnmfciyd s emumpn(4trxrmo3tytopD livs;s)s2tmimpnodoptn icsa()srumu o;o1tpe  fcild s elumo;u0alxrxrcoy1lpDeanvs;s) 2xoxm oydopt  nvilsf Dtrumono1aexnmoctlsfs2ean pnu0 rxoiocoo1fm  lnvs;s0t2urxo no4oltn fes (fs2rm( o;t1tpe mieiys s2um( p;t4trerirctydlpt  ueo ( sexmxr ny4alenmfvs (f Drrurooo0apx ii3iad m ranvsnt0 etoio3iadfpte nes t0texmxmpoo1ol nmietls)aDtmxmooo1teto o3ias a2rl(mo t)alenmf oydfpDeauvils0 etm(m3oo1alt micsltf rua(monu1aleo fetysla rmn pn(4tlenmr3oadlp eaueo t0seuoiopoydllt mnctlt  ruauront4olenmietadfa2raumsnt0 lxniocoytfmD  ivs;()t2um(r3iy4opt mies sfaDumum nt1tpenifeiytfm rm(vsnu) rerxr3ta1fa r ivi s s2xrir3no1al nlfesa( srurxrpot4apenii3iys sDum( ont0arenxf iatopDe ivolt0seur(r no1ol nlfvtatfs2ra(mpno1opx mfctadfaDel( p t4 ltnxfciodlm rauei;(0srxrxo iu1altnmfvsas) 2umxront1apeo f3iatlmDemnvpnt0artrxo3totomDrau s s)trtrxm nu1lmt  fcs s  Dtm(  ;u4oetoiociadlm ea(ms (4arxnxrcoydlm  auvsls0 rurxr nydom e icsas artrxmp;u1tltn ocias m um(msnu4 exrmfcoodfmD aivs;(0 2tmxmpio4opt  fvtl()artrxmpnt1tlt  feiytlsDelu p u0 rermrcoo1fa e i olt teto(opnu4olee nei s) rumumonu0ape  i3ilslaDeau pn(0trtrifcoo1lpDelieslt s2uo(rpiudom elnctlsfaDrrxr ot0texnioeiatfs2em( snu0 rxnmo oy1oaDe ivs t  2trxr3ny1alee fvt () rur( onu0olx ioetyt s umnms t4 rermocoatlptr nvi;t0sexr(rpiudol elieia(f Duaxm ;t4ale iocildla ulu s t)aleoif3todlaDrluei s) rxo(m oy1ale mncsls) 2trxmpot0oexnio3iys a emuvp (4 rerifcoatoat au sls0t2umxm io1am nlfvs sfsrtau pot1oet mfcils m2rm(mpnt0altniocoa1fp e u ilt0t2toir no1omt lfeiat)aDtm(rpoo4optomictlsfaDulnvo;u0tlerxf3iodop rlueo t)srtoio oodlltnmnetas arrau  nu0opeo iciyt sDrmums;() ltoxr3oy1lpte n o () etmxr3io4op nmieta()s2ta( onu4tlxomfeiadls ua(ms u)trtrio3iydlp  lnvs s0s2tr(rpiy1llt lfesls s2ra(r ;o1oee io3iasfa2em(vpnu)teenmo oa1omDeau s;t s2tmim3iy4alenlnctltf rrrx pno1tpx mi3iltfmDumuvo;() lxoif3oodfmDe ieo;t0 rtmxrpiydlp elfvsat)arrrxr ;o4tptnmoetadls2ul( p t) lerxf3oy1fm   nes;() 2xoiopny1amtelncsat sDta( o;o1tleo i3tld s2rmuvo u)texnir3iotomtr u il()trtrxopnodoptemneilsfa2rmx onu4tle ii3ild a2rl(vpnt4aleomr tytfmD  nvo;s)sexm(m iydlme mfctat sDtm(m ;o1apt mi3iys m emnmo;()teerxo3ta1fp r ivo (0t2uoxo oydole lfeia()sDtaxm ;t1optn fetas sDemuvsnt4tlenxf3iatoaDeanvi;t0texmir3no1ll e ncsl(fsrumx  no1tlxn ieiyd sDulums u4aexrxr iotfp eau s s0s2uoxo no1olt  ncils) rtm(rpou0tlx ioetlsls2ean on(4 rerxr oa1lpte ueslt trur(o nu1lp elfvi t aDrr(mp;o0aetomieiadlmDrlumo () lermfcoydlaDeluvols0trtr(o3io4alen ivilt)srrmu pou1oexoif3ils m2um(ms;t) lenmo oatfaDe i o;s texmir3iy4opt  ictat  2tau ono4tpxn ociad s umuvpnu4 rxomr todfm e neslt) 2umxr oo4lm nmfviltfa2uax pnu4aptniiciytlm ul( o;u)aetrxo3oa1omtr n o () ruoxm3oo1apenmict ()aDrm( oot4aexn o3iat m2rl(msn() exrxociy1lm raieil()srxrim3no1ole lfcsls)sDraumooo0aetn i3ild mDraumpnu4 rtoifctodomtraueo t)setriopnydome  ieta()arurum nt0opx mfciytla2elnvsn(0 leomo oadlp r n i t)setrim iy1apee nvia() Dtr(moou4ape mietlsfm2umnvpn(0texoif tatoate u s (0 ruo(r nu1alee ict s) 2rru  ;u0alxoio3iys m2eln snu0 eerir oadfaDr nvi s trur(mpnu4oleemfctas sDta(  no1tle io3iadls um( o u)alxnxociatomD aueolt)sexoim no1llte ivi ( sDra( poo0apx io3iasfs um(vs;u0tetrmo3ia1fp  aies ( sruoir iudol nlivt s) 2raum no1aptn ieiys sDeaump;t)arxrmocty1oat aivsls0 rum(opnu4ome mnei sfs2ururpno0tleomicildfa2raump t)tlxrmo oatlpD  uei;t) eum(m no4lm nmncs ()srurur ot0oexn iciasfs2ea(msnu) etomr ty1fate ueslt)tetmxrpiu4aptnlnvilsfs2rmumoou0aleo fetatfaDelump;t0aeenxr3to1fatrlivsl()trtm(r3no1om emivilt)arrr(rp;t0oeeoiieiaslm rm(ms u) eenxrctatfaDe uvsl(0t2tr(o3oodll emncs t)arrrxrpnu0tet  i3ilslm ea(vs;u0trxrmo3tadoaDrlivs t) exrio no4lm n ieilsfa2urx pno4tptnifeilsla2rmnmsn(4trerif iodfm   iesl( trtrxm3iudlp  lnesls)s2tm(rp;t4tltoio3iatlm um(msn()trxriocoa1latr ivsl()t2urir3iydomen fvias  2rrum nu1oltnioctatfs2ua(vpnu)tlxoif iytfptr ueolt0s2toim3io1lltnmici ()sDtmxrp;t4oee ifcilt a eanmo u)arxnxocta1faD lues s0sruoio ou4optn fci s)aDtmx ooo4optnmociadls2rluvp u) rtnmocoodfa  au o;t t2tmimpoydapt mncils) Dtauro;u1aeenii3iys m2em( snu)trtrmr3totfaDraivol(0seuriopnu4lm nlivtl() Drru pot0tleoiocild sDeanmpnt4aexomf iytfpDeauvs s  2xmxmpoo4llt  fesls s2tr(  ;u4alx mo3iasfs ran onu4tetnxr tytopDrluvs;t  2trir3iodlp elfeia( a2umuro;t4olto f3ils s rl( s;(4aetomo3tydlptr uei;s)setmio3iu1amte nvtas) 2uauroou0texnmoeiytlm2elnvs;u)alermf oytomD ai i s t2trxr no1lm nlfet t)s2rru pot1aex  oeiadla el(vs t) reoxr3to1lm rauvo t0t2umxm3nu4opte nvtl(fsrua(r no4tpx  o3iasla umnvs;(0trermo ootoaDrau il( s2urxr oy1ap nlnctl()arrr(  oo4ole if3tat sDean o;(0aexrmr iydfaDeau o s) 2tmxm io4lpe  fcilt  2umu  ;o4oexomo3tat m2emnmp t4 exrmo tydlpt livo;(0srtoio oo4amee ics s)artaxmpou1tltomfeiydlsDrlu o;t0 eeoircoy1oaDeli i () 2toiopnu1amt miesl(f Draur oo4apt  fetys mDum(ms;u0teerxociytfmtelivi;t)setr(o3ny1lptnmnct s)a2tmumonu1opeomoeias s2ulnvp;t4 rxrmo3tatfm rlu il(  2xo(r3ou4amtelnciat  rur(root0tpx iiciatlmDrm( p;(0trxnxo oytfmDe uvols)setmxr io1ap  lncil(fsDrmx  ;u1teeniietldlm ulnvp t0trtrxr iotoaD  uei;t)trxoxmpou1op nlnvia(fsruaxmp;u1apenifctlsfsDemnmo t0 exomf3iodfp rlies;t  rxmxrpnydamt mivsas) 2rr(m no0olenifetatlm umn p ()aeeomr to1op  li o;()t2xmirpiu1lpe  fvs sfs2uauront1tpxoiietls a ranmp t)arxrmr totla  auvsl(0tetm(opio4al  lici () Dua(ro;t4opxoifciyslm2rlu o;t4 lenxr tatoptelieil( s2uo(rpiu1olen fciat)aDumx  no4aptnif3tlsfs2uanvp;u0 reoxrcoy1oaDr nvsl( trtm(rpiy4am e iei t)srumxmo;u4apt  ietltlmDranvo t)alxoifcootomD aues;t  exmimpoo1lpeelnvi s)a2tax  nu4alxo ieiys mDrlu o;t0arxniocia1fmt  u i;( trtmim oy1aptnmnct (  rur(mpou4tpe ifeiys m2uluvsn(4altnifcoodfaDrliei t) etrio ou1llee neta() 2ra(rpnt4texo ocilt m el( p;(0alxoirctotfmDe uvil(0t2xrxopiudaptemnet ( a2taumpou4tetoifciydfaDem( pnt4trxnir iydomDranvs;s0t2tr(o3nudlltnlneias)srtaxmpoo1oltn f3tydla2elnmo u) leomo3to1lp e i ils setoxo3nodlptelfeslt)arumump;o4aex mfciys a2eln sn()trtnxo3tydoa eaieo s t2trim no4ll nlnvtat)aDrmxmpno0ole  ictasls ra(ms;t0arerxr3tydoatrln s;(0setmxrpno4altnlncsa()artmurooo1tlx miciltlm rmn on(4 etrir iotlate nvilt0s2tmxmpiu1aleemfci (f rtm(mont1olxo ieilsla2ra(vo t) rxomo3oodfatelnvi t0srxrxo3ou4ap elneiat  2trxmpnu0aee mf3iltfs ul(vpnu4arxnif3iadlm elnvi;t0sexr(opno4ape lnct s) Duauro;t4oexomieiysls rau s (4texoxf io1fateauvil()srur(mpiy4lme lnvsl()aDrrx p;t1oltn feiytfa rlnvo;t0arxrxo3oatomt livi;s setmxopno1am  lfcias) rrau  ;t1aleomietld a2um( on(4aetnxfcta1lmtr u o t)srtrxm3nydll   iesat arraxroot1aexnioetadfs rmn sn() rxomrcootlaDeai i;( t2ur(opiy1lpe  iciat a2rm(m no0open ietys s2ulumpn(0 eerxo iotfp rluvi;t0t2umxm3nu1lmtelictat) 2taxronu1optoiietydfs2elumpnu4 eeniocty1fmD  u s (0t2tmxo io4om  liesl(  2uaxrp;o4tetomoetys mDul(mon(0 exnmf3iy1faDelivi () rtmir3ny4ole lfei t) Dur(mo;u0apen oeiatlmDrlnvs;u0aetrxocty1oatrln ilt srum(mpoo1llenmicia(f 2ta( pot1apxnio3iad s ulnvo t0 exnmoctotlmtrlnvs s t2xoxo3iudllee netls  2ur(mp;t4tpeoio3tatfsDra(mo (4treomo3oadfp   i ilt) rtmxm oodlmt lnvsa()sDrrumont4aetniieiadlm ua(mp (4tetoxr3to1omD  i o;t0s2xo(o3iu1opt  feil()sDtmur ou1ole moctls sDuaums t0trxrmrcio1op eaivi s t2tmxo iu1lp n iciltfsrrrur oo1olenio3iysfm2eanvs;(0 lermo oatfmtrlneslt)truo(r nu1ole  ivta()srta(rooo4opeo fciatlm em(mo;u) etrxfciy1faDeaneols0trur(o iodol elfct s sDuau pou4ole  o3iat m2uauvp;t)tetoxo tydomtrluei t s2umxm3nydlleelfciatf 2tmxr nu0aet mi3iad a umums (0tlxomo3iy1omtrau ols)t2xoxm nudll nmietasf Dtax  ot1apeoio3iasfaDuluvsnt) rtrmrcty1fm eaieo;t0teuoirpiodoltnmietlt a2rrur nt1aet if3iatfa ea(mp (0artrmr oytfpt lnvolt  rxo(m3nydllee nesas)s2rmx  no0tee  f3tys s ea( pn(0 lenir oatfpteanei t0 etmxopiy1lme lfetlt aDumumo;u1oetnmf3iatfmDuln o;t)tlxrmfciodlmDeluvs;() rxoxmpnudlmt lnvs (fs2ra(roou4aetnif3iasfm ranvo;(4tltrxfcia1omDe uvols  rxrio3iu4ale mnctatfaDtr( ono0tex mieiat sDea( s u0aexoircoydoaDr uvsl( s2xmxmpno4omtelivslt)sruaurono4tptnifeils s2ulnmp;(4aeenxo3oadfptr uvi s)s2toxrpnu1lptnlfetas sDrmumpou4tee io3iydlm2uan pn(0texnmr3iodomtrlu ilt0 exmxr3nu4op nmfvtat)s2tmx  nu1tlx mf3iasfs rmnvp;u4aexoxo ty1oatrli ils) rurir3iodol nlivs (faDurumpot4apx mfctldlsDrm( pnu) lxnmociatlpD an o (  eto(rpiy4amtelfes s) Drmxro;t1tpt  ociytls el( snt0 exnif ty1lpt aivi;()setrxr nodlltemieias)srum(monu1texo f3tydlsDulnms t0arxrxociotlpte i s () etm(mpiu1ll   fctlsfsrtmxm ;o1altn i3iadfm2ulnmp (4tltnxr tadlpt livi t0 rumio3ou1apt lnvt ( aDtrumoot1tex miciatls uauvp t)aeeoio3iodlpt  ivi ()seuo(opnodlmt lnvtl(faDrr(mpoo1tlxn oeildfs2ul( snt) rxoxr totlpt luvo;( tetoxr3oodalenlict sfsDraumoot0optn ocild s2rlu o;(0teenmo oydopD au o;s  2xoxr iy4apeemnvt s sDtmxr ;u1ape if3iat sDrmnmp t0 rxnmo3iotfpt  n s t0srxmxr3oo1olte fvtas)s2ra(m oo0oee io3iltls2elu pnt) lenmr3iytfatr ivs t) exoxm io1amtnmietls arumum ot1tlx ioeiaslmDuau s u4arenmocoodlptelnvil(0 rtoxr oy1lpe mies () 2ra(mpnu0tet  fciytlaDuan s;t0texnmr iotfmDrlivsl() eurirpoy4ole  neslt artr(ronu1aptnmi3tasfa2ul(msnu4tetrir3iy1faDeli i;t0 eum(mpnydlltnmnei sf rrmump;t0optoiociltla2el(vo;(0 rtnmr oy1oaD lieils0teurxrpno1lle  fesa( s2tm(m nu0optoii3iatfsDuanmp t)teeoir3iodom elu il()setmxr oo4amen icsat a2um(ro;u4texnmictyt s2eaump;()texrxo todfp  livsl( s2tmxr oodllenlnei s) 2rrx oot1ole  octas a2eln p t0altrirciy1fp elu o t truoimpiu4lpe lnvta() rtrx  nu1ope ioctytfm emu pn(0artoxf3oadfmD  neolt0s2umio nodomte fvi (fsDurxm ou0texniieiatfaDelums;()trxnxrciy1lpD aivolt) euo(mpiu4lltemncsl()s2tmur ;u0aexn ietydfm ea( p;u4texrxr3tydfaD  i o;s)s2uriopiodlpenlnesasf rrr(mono4aexomoctlsfa2el(mp t)tleomf iytomtr u s;( srxoirpny1lp nlfeta(f Dtm(r ot0apeomicilsls2ranms;u0teerir3iytfpte u o s)seumxm iudlp n fcia(fsrur(r ou1aptnifetasls2umu sn() ltnxrciatomteliesls0 etmiopno4altemncsl(  2uax p;u4aee mi3iydlm rau on() ltoio3iytoptelnes;t  rxoxo3oy4apeemietat  Duaumpnt4open ieiysfa emnvs u0aeenif tatom e uvs;() 2umxm nydamee nvia() Drr( oot4tpx mieildfa rmn s;() lenxr ia1op e uvol(0setoxopnodape lici (  2taxmp;o4alt ifeildls ra(mp;u0areoirciy1lm  aiesls)tetoxopiodap nlivs t arra(  nt4oetnioeild sDraump t0trerxocoy1fpDraies;( tetmirpoy1aptnmfvtl(fsrurumooo1tetnmo3iytfa2emuvpnu4 rxoir ootoa eluei s)tetoxopiydlp nmies s)a2ua(r no4aet  iciadfa2eanvo;t0altrmr3todfp eaneols  2uoxo nu1alt micslt)srua( onu0teenmoeilsfm umnmo;u4tetnio oytlpD  i i s)tetrir3oy1oleemfet s)aDtr(r ou0alto fciysfs2ean s;()arxrif3todlaDranvi s s2xoir nydlmeelnvslt aDrmx ono1tleo fciat a2raumon(0 rxrxrctatoatelu slt0setmxrpou4amt mfetl() 2rmxmpnt0optn fctadlmDum( s (4tltrxr3ty1fat li s s0 rum(m3oy4om e ictas)aDurxr ot4tptniociltfaDra( o;(4 reomf3oytfaDr uvilt)truoio oy1amt  icilsfs2umxrpot0tpe  oetatlm um(vs u0tltrxfciatlmtrlues;( srtoxopnu4ol n ivtas)srtmum ot4aetn ieils a umnmp (0artnmo3oadoptrauvo;t)srxrxo3nydlmenlfct s srtru p;o4oee ii3iyd m2ea(mp;t0 exrio oydfm rluesls  eto(o3io4ap nlnctasf rrmumpno1tpxnmietat a2rm(vo t4 rerxf3iytfate ivi;()trxmir3nudamt  ics tfsDumuroou0aeeo iciatfmDuln p t0 rxnxo3tytlaDeaieol(0 eumxm3iy1lleemfvsat) 2umumooo1oexn o3iysfs2ulumont) lerif iadfmDrlu ols t2ur(o3nudaltn icsl(  2rmxrpnt0aptniociat s umu s (4alxoio tydfm rlieo s)s2umirpiu1ap nmnciasf 2raxrpno0oeto ociatfm elnvon(0 rxrifcty1laDr ues s0 rtoxmpiodol  mivilt s2rmur no1oexnmicilsla2ua(ms;u4trtnmr iydlpt  ivols0 etoxr nydaptelnctls a2raum no1apt  f3tadfs2rl(ms;() eenmf io1lmtrli s;s) 2uo(r iy1lp  lfet (  2taxmoou0tle  icilslm ulumpnu)tlerif3oytlmDranvil(0tetrir oo1lp nmnvta(faDtrx pnt0tpt mf3iyd m el(vp;u4 renir3totoat  uei (0s2tm(o3ny1ope mfeias)s2tm( ono1apxoif3tasfm ua(ms;t4trxnir3oydfaD li i;t0teuoxr iy1ameelnvsatf 2trumpot1apenioeilt m2ul(ms;t4aexoxrctodlmt aivs;t)s2xmio nydlptemivtat sDraxr ;o4olxomoctadla2em( s u4 renif oatla  au s t)t2xoxo iu4ol nmnesasf 2umxmp;u4tpt io3iysfaDua(mp t4tlxoxo3iotlp   ivils0 etm(m iydomtn nctat)a2uaur ot0tleomoctlsla2em( s u)tetnmf3tytfm rauvs () eurio3iy4lptnmneilsf rtrx pnu1tpx mfciatfmDea( o u)arxoxoctytopD auvi s) 2um(m3nydapt mfeil() Duru ont4apeo fciasls2um(ms;t4 rxoxf3todoaDrli i;()tetr(o oydame lnvtl()srtrx  ;t1aptoioeiltfmDum( s (0trerxo iadfpt  n ols0 rtoim3oydoltnmics t  Dtmu p;o0open o3ilsfa ra(vs;t)aetrmfctodfpD auesls srxm(rpiu4apt lnvt sf rtrxm ;u0teeo ieildla ul(vsnt)trxnmf iytomD  i i ( seurxopiodole miesltf 2ra(root1tex moctyslm2umnvsnu0alxomo3to1omDe iesl(  ruoxm3iudlm elivsls  Dumum ou0aet mfciys s2ra(ms;()tleomr iatoa rlieo s  rxm(r3no4ap e ietlt srrr(rono4apxniieiltlm2rm( on()trenmocoodlaDeluvi s  2um(r3iu1lme lfeta() 2tm(m nu0tlxoioeiasls ua(mp t) eeoir3totopD anvil()t2trxm3iy4llt  fetls) Drrxmpou1oee ii3ils s2ea(vo;t0aetoxrciotlmt au i t0truriopiu1ap nlieiatfsrra(m no4apt iieildfm2uanvs ()teeniocoydfmtrlivsls)seur(o3oodlptelnciat  Drmxr ;t4altoiicilt sDean p;u4trxrifcoodfmte ivs (0 2urxrpoodale livt s) Drmxm ;t0texomfeiysls2ean onu0 leomr3tatfa   ieolt0t2um(rpoy1aptnliciltf rum(rpnu4aleomf3tat m2em(vo;u0aexoxf oatlatrliesl(0t2uoir oy1optemneils a2raxr ;t4aeen ietlt a ea(vp;(4trxoxr3ty1opt lneolt)seto(m iodapee ict ( aDrax o;o1aet  ieiyslaDelu snt4trtnmo oadomDelueo;t tetrim3nydopeemictl()srua(mpnu4oexnmfeilslaDeanms t)tltoxfcoa1laD  u s;t0 rtriopou4ale lfcta(fsrtaxmo;o4tpenii3iyt a ua(vp t4alenifctadlm e nvo;s0 rxm(r nodapen fct t) Drru  oo4alto fciysfm rm( o ()trtnmociytfaDr nvi;t0s2xoimpoo1lle lfeil()sDrrx  ;o4aptnifciytfs2umn s t0 rxnxr3iadopDr ieo s srtmxmpno1amenmfctls)srtm(rpoo0tpxn ieiydfs emnmont4 etnif iatla   n s t)sexmimpnu1omtnlfviat s2tmur ;t4aet ifeiat sDulnvo;u4teeoxo tydomDranvi t trxmim oy4ol elnesls aDraxroot0optomociyslm emuvs (4 lxnmf ty1lptr uvi;t  2xmir no1am   fei t) Draxr ;u4apxomo3tytfm uanvp u)alxnir3iy1la  aues t)sexo(mpiydaltnlfetls)arurxmoot4oetoifeiat a el(vonu4altnio3iatlat livs (  exmiopoudopt  nesa()aruaxront0tpenmfciad a umn o (0arenio3oy1fm  aivilt)s2triopiydlmte fvi tf Drmxr nt1alen ocildfsDua(mo u0tltrmo3iy1lp r i sls)s2xoirpou4lptnmiciat srrax  ;o4tlen oeiat mDeanvs;t0aeermr3tydopDranvs s0 euoim oodalee ict t s2uru onu1oleomfeildfsDea(mp;(0aexrxo3iadoa   neols0s2xr(mpnodal   net sfa2taxmpot1apt  feiydlaDeanmp t4aexnmo3oo1oa eaies;t)t2tm(mpio4lmtelfes t) rtaum no1apxo ieiyd a2uln s (4teerifciydla eli il(0s2xo(r iy1op elics s)s2ua(m no1teeo oeildfs2rl(von(0tlxrmfcoytfaDranes t0 rtoxmpiy4lp  micsl() Drrx onu0teen oetyt s2um( s t)aeenxfciytlaD luvs s0 2trxopio1amtnmfet tfs2rax oou1oleomf3iytfa2ra( pnu)artnir iydlm eaieo;( s2urio iu1ll nmnctls a2umuront0apeomieildlsDrm(mo;t4 rtoir3oo1omtrluesls0 ruo(mpoo1lpenlfesls sDurxmp;o4ole mieias m ra(vpnt0tltoircoydom rluvo (0texoxo iu4lle  iviat)srra( pou1tltoifeiatfm2rlnvp;t0tltoifciadomDrlu o;s s2umio3oodolt  ies ()aDtaurp;o0apeoif3iydfa emnvp u4tltnif ty1lpDrlivs;(  exmxopnydape  iesls  Duru  no0tlt mi3ilsfaDemuvp u0trxomfctadfa  li o s)trxoxr3oy4ome  fvils)sDumurooo0tltoiieils a em(monu4teenmf iadfp e ivo;() etoxo3nudap  lfcsl(faDta( o;o1oltoifciadfa2rmnmsnt4artrif oo1omD  ivo t0 exrimpio1ll  lnciat)aDtr(rpnu0tpeomfetad a2uanvp;(0aexomrcto1oate nvs (0seto(r3io4lltelncs s)srrmx  ;o1oetn oetls m uan o;u)altnirciodla  anvol() 2to(rpny4opeemnciat s2ua(mont1tex ioeildfmDulump u4altomoctytfpDe neo;s) 2xmxo iy4llee icilt  Dtm(r nt4opto o3ilsfm2elu pn()aetrxo3to1opt an ilt0srurim3oodll n neslt)s2tmu pno4tlt ioeiltlaDel( p u)aeenif iydlm e ies (0 eurirpoudlm  mivsl(fsDua(rono4oeeomo3iasla ul(vpn(4alenxo oadopt  ieo s0trxoxr oo4apt mncta( sDur( poo0tpxniicildlmDra( s (4aleomfcia1oa r n o s) etoimpoy4open ivil() 2urxrpot1alx iieiytlmDranvo u)teerio io1oat liei t0 exoirpiodlle mivi sfs2rrxmo;o0oltnmf3iydlmDumnmsn()artoir3oadfaDraivi ( setm(rpiy1olee nvi t aDta(mpoo0ole mo3iad sDem(mp;()aeeomf3oatoa r nvi ()sexo(m3iodame  iesa( a2tm(mo;u1alxnii3iyt a emumo t4 ltoxf tytfa r nei;(0trum(mpoo4oltemnvs t  rurx pno1aetnmfeiyt mDel( s;u) etoircoy1lmt anvils0 eum(r3iy4lmen ict ( sDraxmoou1oeenmoctldla rau o;u)tltoio oytlptr ues;s) eum(m3nu1om  mnvi s srta( pot0tet ifctaslm umnmo ()treoxr oy1fm  li ols0 etoimpoo1aptn ncslt sDrru pnu0tptnmf3iys aDulnmsnu) lenmoctadlatrauei;s)t2xrir3ny1ol   ies t)arurxr no1olx ifciltlmDumu ont4tleoxrcootlptelu i t)srxmir3ny1amtn nvs ()srta(ro;t1apx moeias s2em(mo (4tleoif iatlp r n i ( seuoxo oudllt  nvslt)aDra(ro;u0tleoio3iadls2rln o;(4texnxrciatlmDraieo;s)texr(o oo4amt  nesls)a2raxr ot1ole mfciyd a2umuvpnu4teenir3iotlp eau o;()trtoxo3iydlmtelfetls) Drau  ;t4apxnmociyslm eauvo u4trermr tydfp eln s ()s2xoir3ny4ap  lfetas) Dta(  ;t0tlenmoctadls el( ont4alenifcoytlptr n sl() rurim ou1lmen iciat  Dtaxmo;u4tlt if3ild a eau p t0tleomoctotopDelu i;t0s2tr(o oy4ll e nvsl()aruau pot0alxn iciat mDeau p;(4 rtoif iadopDe nvi;t seur(mpnydape  ies s)artr(root1apx mfeilsfs rmuvp;()tetoir iodlmt  u sl( trtmxopnydopt lfes sfsDumum ou1opt  fctyslm rl(mo (0tlenir3tydlatrai ils0teuo(mpnodlptelnesl() 2tmxm ot1tetnioeiys sDra( snt)tetrmr oatomteaivo;()trtmxm3nudap  lncsls) Dtm( o;t4alxo oeiysls ran s u4aleoif ta1fmDranes (0seuo(rpio4oltn nct sf Dum(mp;o4apt if3iytfmDua(mo;u4 exrmr iy1faDeluvs;t)trxrxopnu1lm n neils)a2rr(rp;o0tlen octls s2elumo t0 lenxo3io1fptr uvs t s2umir iy1lp emnei s aDta( pou1tetn ietasla2ua(ms;u4 eeoifctotopte n s s)seum(opoodamt mfeta() 2umu  ;t4tltn o3tltlaDulnmp;() exnir3ootla r ieo s0 eur(rpiudopte iesl()a2umxmpou1tpxn ieild a2em(mo;(0 renircoodlmD  uvolt  exoir3iy1amenlfetl() 2trumooo0aee if3tadlsDrm(vo t4aeenmr oydop ranes;t0 rxr(r iy1amtn ict tfsDtr( oou1tlxo ictad a ran ont0tetomf iotoateluvi;()t2tmio iu4ap nlfvslt)s2trumoot4apxnio3tat mDemums;t)tleomf oa1fmDean s ( tetrxo nudopen fciltf 2uaxmono4tpx mf3iysfa ulump;u4 lxomociadop eau o;t)texoxm3ny1om emfetat a2rm(mont0tetn feiat s umu s;(4trtnifcoadfpD  ivilt)texr(rpoodamtnlfcils)srtmx o;o4tpenif3iydlsDrluvsnt)texnxocto1omt  n olt)tetoio iy4lmte ieiatf Dtm( p;o0oetoio3iytfmDea(mp;u0 renmf ty1lm e i s;t srtoxm3io4oleelivi t)srur(  ;t4apxniieiadla eluvo;u4trtriociatom eanes ()s2tm(rpiu4optemfci sf rrrxrooo4oeeomfeilslaDuln o;t0 exnxf iotlmD aueslt0t2xm(m nudlme mfcsasf 2rmurpot1oetoifetytfaDea( snu0tltoir3ty1fp r ues (0t2tmim3no4lmtnliei sfa2rmump;u1alto f3tlt m ua( o (4trerir3ty1om eln i t texr(r3iy4altnlfcta( aDrrxrpou4tptomf3tytfmDuluvs;t)teeoxf3totomtrlieo ()s2um(mpnudllee nctltfsrum(  nt1opx  o3tltfa2elnvont)texrmr tytfmDeanvs s  2xr(r3oodal  lnvia( a2rmx pno1oex mfeildls2rlnvpnu4alxrmo iy1om e ueo;t0seuoir3nodlm nmncil(fsrumx ono1tpxnif3tyd s elnvs;t)aetnxr3ta1lpt lies t0trur(r3io4olt  neias)srtr(mooo0alxo oetytlsDumumont0tlenxf iotlp raivo s trxrxo oy4op e fcs ()a2trum nt1alto fetldlaDulu p u)trxrmocto1lmDraivo;s0srtoxr nodlme lfvs (  rur(r ;o0oeen f3iysfa2ran p u0 rermo3oatoa  lueol( s2toiopoo1alt mfcs t) rrmum nu4tlto fetadfs rmu snt) exrmrciytlmt  uvi;(0srxr(o3iudomtnlnesasfs2rau p;o0apenioetytlm elnvp;t4tltoifcta1fp ran s (0 rtr(mpoodamtnmfes (fsDua(  ;t1oltnio3iad s rlnvs t)tetrxo ootfp r neo;s)t2tmxo3nu4lmt  nvi t) rrmxront1tpto oeildfa eaumsnt4tltrxrciodoptr neo;t)teuoirpiydame mieia(fa2tr(r ou4oeeomoetatlm2elnmpn(0tltrif tydfa raies;s0texr(m no4al e iesat)s2ur(rp;u0tltoiiciysls uau s;t0 ltnir ia1opDeauvi;s)tetoir oy4llen fetls srumuronu1opx mf3tat sDrl(mp;u4 exnif3iy1fp  li i (0s2xrio iy4lp  lici tfsrur(  oo1tex io3iadla2em(mp u) rtrxocoydfptrau il() 2xrxm3oy1lp elivsatf 2um(rpoo4tpeniietad a rl( o;()teeriocty1optean s;(0 eumxrpnu4lle lnvtl( s2tr( oot4oexnmi3iyt aDul(vo t0texrxr3iotoa  an s s s2tmxrpoydapt micsa(fsDrrum ou0alx ifeilt s ua(mp;t0aetnxr tytla  luvi;s) rumir oudoltnlnvi ()arraum ;o4aex iiciasfsDrauvsnu)trenmf3ty1oatelivs;s0sexoim oy1ameemici s  Drm(mp;u1alt  feil
\ No newline at end of file
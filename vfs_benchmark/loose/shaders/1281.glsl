@@ -0,0 +1 @@
+uvo ( trtrxr3ny4ll nlncs s  rtax  ;u0oetn feils m2eaumpnt)alxnxf3todomteaivi ()texr(m nudap e fcil(  2raxr ;o4aleomieiadfm2elnmo;(4trxnif oytomDr uvols0trur(rpiudame mieiat)a2urxrpou0optniociatlmDeanmpnt0tltomf tatlpt lnvi t trur(m oo4ope mfct (fsrra(  ;t1apxnmictaslsDrmn sn(4tleoxo3tydlmtraneolt)srtm(m3no1lpe lfesls) Draurooo4tltoiiciatla2elnmp t) exnir3oadfpDe nvo t t2uoio iydlpte feslsfaDrmurpnu1texo ieiltla2uluvp;t) exrxr3to1lmD aues;()teur(r oy4al n fvia( srraump;o1olxnmociyt a2ulump;(4alermo3oo1fa ranes;()seumxopiodlp nmiesa( aDum( ont4tpto i3iltfa uaums;t0texnxf ootlaDraneil() 2uriopiudap  mncilsfsDtru ont1opeomoeiysls2umn o u)artoxo ty1oate i o;s0setrim3no1lptnlfviat)a2umxmooo0teen iciys a ua(mo;t0 rxrxo3tydlm raivs;s)texrio oo4open iviatfarta(rp;t4tpeo o3tad mDuanms;t4tltnmf iadfp r n i s)s2umio oo1lleelfcsl()sDtmxr oo0apxomi3tadfs2rauvs u)arenmf3totfat lnvi t s2tm(r ny1ale  fctlt)s2rm(mooo4ape mfeiadlmDuan s u0trenmr oydlp rai slt)srxrxopnydome mict s)aDuax p;u1tltnmo3iydls2umumonu0 ltoxo3tatopt lnvi;t) rxmxo nu1lm   netas s2ta(roou0tleoiietytfs2rm( p;u)altoxrciotfmteauvs;t0srto(o3ou4lmeelfesl(fs2uaurpot4optomfctas mDrmu onu0 renxfctodfmD anes;s0seum(r ny4ame mnci sfaDuaxm ot1aeto ieiydfm rlnvo u4texoxrciydfpD  uvi;t)seurxr3oy4aptelivt s)s2tmxr nt0apt mi3ilsfsDrlumo;t4tleomo3iatopDe ivs;t) 2uo(o3no4ole mnviatf 2rm(ro;u4alxo f3tldfmDrmnvs;t)tltriociotop   ivs;t0t2trxmpoo1llte fvtl(fa2ur(mpot0oee  f3iadfa2ua( p (4trenircty1fmD  neo;s)t2triopny4apeelnvt ( arrmxmoot0apxn o3ild m2rmnvsnu)tltrmr3oodlmte n i t)tetr(o3iudlpt mnesls  rrmum nt1tpxn ociltfaDrln o;u)tltnirctotfm   n ols  exoimpnu1lpen iesa( aruax  nu1ope  ocild m umnmpnu4aetoifcia1lm r neils0seumimpny4aptn fetas)s2rm(ro;u4aeeoiocilsla rmumon()arxrxr3oydlaDrau ols)t2tmxm ny1op nlfviasf 2um(m ;t0aexnii3iysla2rl( o (0 rtrxf iotfpteai sl()t2xr(m3oodllte ict s) rumx o;o4tlenifctlt sDem( snt4trtnio tadopteln o;s t2xm(opiudlmt  nesatfs2uru  no0opx  feiatla2emnvo u) etnifcoydla eluvslt0trxrio3iu4ll emfeta(f rraxmoot4tlenmf3ild m ua(vp;t0aetnioctadlmte nei s  2urxmpnu4ope lfvi s) ruru o;u0aptoio3tydfa2ranmo (4artnxf oatfaD  i ilt tetm(rpoo1amt micsa() 2trxro;t0aet ioeiad m2ua( p ()aetrxo ty1lmDrlnes;s0trxriopiy1al  mivtl(fartau p;o1teenmf3ild mDelu p ()artrxociadfmDeluvs t) rto(r iy1omenmfesas)srur(m ot0oeenmieiasfsDua( ont) eerirctotoa eaivo (  2tmxo ou1omenlfcs (fa2uax p;t4aeeomo3iytfmDelu o;(0 eeoif3iydfat luvs (0 rxm(o3no1ame mnctls) rrm(ro;t0tpt mo3tyt mDumumpn(0arxomo3ty1lptrlnvs (0t2tmio3iodapenmivsl(fsrum( oou0tptomiciltls2ranvp ()alerxr iatlpDrlieils trtrxo3oy1lpt mfcslt)sDtm(m ot1olto f3iasfm eau o (4alxrmr iy1late ieol(0t2trxo iy1aptn fci t aDrr(rpou0oeto o3ildlmDel(mp (0aleoxf3oo1fpteluvs;t tetmim3iy4ll e fes (f rtmurooo1oexo o3iatla2ua(mpnt4 exrifcoy1fa raues;t)tetr(o iudlp  mfcs s)a2umxm ou0tpxnio3iasla raump (0 etnmf oadoateliei;(0sruoxr3oy1lpe lfvta(  rtaxrpoo1tet  feiydfa rmump t0 lxoiocoatlmtrauvi;t0srxoxo3oy1amtemici tf Dua( pnt1aee  i3iyt sDra( o;t)tlxrxo ootfm   uvo;t s2xriopio4lp  mnvsl()srtrxr no0oetnmo3tltfa um(mon(0aleoxr3ty1fpteaies;(0 eto(m3iu4lm   feslt s2ur(m no4tpeoii3tyd aDra( s u0aleriociy1omD  n i t  exrir3oy4lmeemicsl()sDumu  ;o4aex mo3tydlm rln pnu0 ltnif3iy1lpDr nes;(0teuoirpoo1ol  lici sfa2tmum ot1aex iieils m uauvo u4 etrmr3oodfp  auvils)srxr(r3ny1ame  fei s)sruru  ;u4aleoiiciadla ea(ms (4 lxoxfcoodfaD ai olt)t2uo(o3ou4al e ivi (fs2rrxmono1oee ioetlsla ranms t)teermr3tadla   nvo;t) 2toxr iodlm nmiei sfaDrr(m ;o4olxomieiasfs em(ms t) lerir ty1omD  nvi ()trxriopoy4omtnmfct ()aDtr(moou1olx mietlsla um( snu) leomf3iytfmDe ivs t s2xmxm oydlptnmnvi s srrmur no0oeeo oeiatls ul( p;(4altrxociadlmD  ieslt0seur(rpiodaltnlieslsfa2ta(m ;u1oltnifeiatls2eauvo;u0tlenxociydoptelneol(0trumio nudal e fcsas srtmump;o0apt mictytlmDuan o (0trtnmocootfpDrlieils0s2xm(o3ny1ape  iviat) ruru ooo1oee  i3ildfs2umn onu) lxnio3oodlatelieilt) rumio iy4al emfes tf 2ua(mpnu1tltniictytfs umn sn(0aetnir3ty1opD ln s t0t2trir ny4oleemfcsltf rtmuroou4tle  i3ildla2ranmsnt0 rtnxoctydfa eaies t)s2tr(o nodoltn fvias aDrruro;o0tpxoio3tld sDemnmsnu0 rtnmo3ta1faDrau ol(0 2uoxr3iy1om  miesas srtrxm nu4tee iietas mDeanmo t)aexomr3to1fmDrauvols t2urxm3iu1lltnlnvil(f rtmum ;o1openmictatls rlnvo () eermoctatomDrai il()seuo(o iy4alt  ncslsf rrau pnu0tpx iictydlm rmuvo t4 etoir3ia1fmtrli sl(  2uoxr nu4omenlfcils)aDra(r ;u1aptomieiatlsDrl(vsn() eeoxo iatopDr ies s  2ur(r3iu1amtn nvi ( arur(r ;t1aetomi3iytfs umnmo;(4 exnio ootlpD  i sl(  etmim3iy4lpt mfet tfsrtrurpou4aptnmo3iytfaDeanvsnt0tltomf oadfa eli o s0 2tr(rpiodlle  fcslt)s2tr(  nu1tpt  i3tysfs rmnms;()trtoxf3ta1lptrln sls) 2tr(rpno1ame  net tf Dtmum nu0aex iociytfsDemn sn(0trxnirciadfp   u o;(0t2ur(rpno1lp n ietat  rraurp;u0ape  o3ilslm uauvs;t4 eeomf tadfa  aies s s2xoir ny4ope mictas)s2rrur no4ape  fciatfm2ulnvp () lxomfciy1lp eli ols) 2umirpiy4ap emnct s) rtau  ou1olxnmoetadlm rm(mpnt)arerxfciatfa rau i;s0 etriopnydlp elnesa(fartrurooo1tetnmi3ilslsDumn p;() exnirciytfp  liei t0truoirpiydlmtnlnvsa()a2tax  oo4alx ioctysfm rm(vs (4trxnir3iotlptrlnvol()teuo(rpnodaleemfeslsf ruaxr oo0olt iieiad a ra(monu)arermo3iodoaDrau o () etrimpiudom nlfvtas s2rr(  ;u4opeo iciatfs2ean p;t0aexnmrctodopDeliei t s2tm(opno4op elfci t) Drmurono0altomo3tlslaDumnmsn(4trerxo to1op r nvo;s  2toxr nu4amenmfctlt srtmu  ;t0aleoiociytla ra(monu4aexnxocootlp eauvsl( s2xoio iydalen icsasfaDtrurp;o0opxoiietldfa uln o;t) rxrmf3oodfmt aneo ( s2toio3iydlpt mieslsfartmx ooo0aee mfeiad s2ul(vpn(4arxoxfcoytlp r ivslt s2xoxm3iu4lpte iviat) Drru  ;o0apt  feiasls2ranvpn()teenir3iydfaDran sls0 etoxmpnydame livsa(fa2tmu oot4ale  oeildfa rl(mp u4trenxfciotfm e u ols t2xo(m3oy1lmt miciat  rurx p;u4tptnmieiadla rmuvsnt0 rermr3ootlpDr uvi s) 2xm(mpno1ame lietat  rrm(rpnt1oexomi3tlslm2eanmsnt0tetnmocia1opD lu s;t trumxmpnu1aptelivt (farur(  ;u4oee mietatlsDeanvpnu) rtrirctatlm elieol(0texr(opnu1ap  lictl() rur(  ou1tlxo oeiydla2emuvsnu) rtnir3iotlmteluvslt) 2tm(m3no1lm e ivs (fsDtru ooo0apt  f3iys s2raumo;t)texrmr3to1fmDrli o s0trtoxo iudlmtemiesls  Drr(m ;o4optniociytlaDrmuvp;()tltrmrciydomteauei;()s2uoio3ou4amt  fciatfsDrr( ooo0opxomf3ilslmDumnms ()arxnxo3oatomDr ieils)srumxm3oydllen fvil(f Drrx  ;o0aetnmoctadfa2umnvon()trtoxrcootoaDr u o;s  euo(mpnudop   feilt srra(mpot1olenmfeiltlmDrl(vo;t)artrmfcto1fmDr nvi t  rxmimpoodolte ics ( aDua(r nt0alxo ietltlaDran pnu0 rtnio3oa1faD liesls0 2urxm no1llt mfvsl(faDuaxrpot4oetn ocias m rl(mo (4aexnir io1fmtr ies t  rxmio3nu1alte nesas) rtrx o;t0oltomi3iltfa um(vs;(0 etrmf oatop rauvo ( s2xo(opno4lm elict s s2uaump;u4aptn octys m2emu snu)alerxf3totfat  uvo;s0 etmxopoo1optelneils)s2ra( p;t0tlt mi3tltfmDraumo;u0 rtniocoatfmDranei;t)trum(mpny4altelivt sfarur(  ot4teto iciysls ranvpnu) exoxr oa1opte ivs;(  etoxmpoy4lmeemnvtl()sDrr(mpou1aptniiciyslsDea( s (4tlxomfcia1fmDeanesl() rtmir3oy1am  lnvt t  rtrxmo;o0texo fetyslm2eln ont4 lxnxr3ia1lpt anvi (0t2uoxo3io4alen iet s a2um(ro;t0aetn f3iys mDuau sn(4texomf iadoaD lueo;t)s2xoxo ou1llt liei s)aDrrxm ot1tetoifciydfa2emn o;u)trxoio3tatlmt  i s;(  2ur(opno4opt mncsa(f 2rrurooo4opxn octldlmDrmu snu) rtrmr3iytfa rluvilt) rtmxr3nydlmtn neias sDua(  ou0aex io3tytls rln o;u0texrifciydlaD  uvs s s2xrxo3nu1opt lncslt)aDra( p;o1alxn fctldlm eln snu4 eenmo3iy1la  anvo;s  rum(m3oudllt  iei s)srrax  ;u1olxoifetldfs rmn s t)trxrmf3tadomDe ivi (0 etrxmpno4lmtelietlt)arum(mpou0ape iicilsfm ua( p u0 lxnxr oydfpt luvi s  rxoir nydal nmneia()arurumo;o0aleoiietldlaDra( p t) lxoif3tatlat  u s (0 rtoir oy1lm nlfcslt srrm( p;o1ope micilt s rm(mont)tetrxrctytlpDeauvs;s  rum(m3ou4lmen ncsa(f rraxm nt4olt ifcildfs el( s t0alerxfciy1lmD lnvi;s0texm(r3no1lp  mfeta(farurx o;t1apt  i3iat m eln o;t0tlxnxo iatoa eai o;( tetm(r oudlmeelnctl( srraxroou4tle  iciatls eau snu)aleoir3iatoa elnvs t t2trio oo1lm n ivtat)srrrur nt1apxoifciyd aDuan o u0texrmr oodoa r ieslt0 2xrxm3iy4amt mfcsa(f rrmxm oo4optoifcilt a2em( s;u0 lenir iatfpte ieil()s2xmio iy1lp nmivi t)a2ururpnt0ope  icils s rluvsnu0tetrxrcoatlmDrai o;t) etr(mpnydaptnlfci t) Dta(r nt1oexnmictadls em( sn() eerxr tydlmDrlues;(0trtrimpoydlp   fcs s) 2umurono4altomf3iatlaDulnvpnu)arxrmf3tydfpD  ueo;s0sruo(m nu4apt  ivs t)sDrrur no4oltnifetltfm rlnvp;t4 etnxrciytfptelnesls)trurim3nu4am n ivsat) ruru p;u0oleo o3iltla2ea( pnt0tlxomfcoytlp eaieo t) 2xmirpnu1ap  mict (f Dumxrp;u1open i3iydfsDrmn o u)arxomr3ta1fpDranvol(0sexoxrpiodamtemnvi s)arrrum ;o4ape mf3taslsDeau p u)aeeomf ty1faD au olt)setr(r3iu4optn fviatfs2ta(  no4olenmo3iytla2ean o;t)tleoif3oytomD li ilt  rtoimpoudale mfvtas s2uaxro;t0alx  i3tatfs rln o (4 lxrio3tadfpD ai ils trxoim3oy4amtelivilsf Dum( poo1aptn ieias a2elump;t0aetrmocoodopte i ils)s2uoim3ny4ap  micil() Drmxm ;u4oex  ieils s2rl(vs;u4aexomocoy1lpteaueo s) 2toxm3iudop e icsa(  2ta( pou0olxo f3ilslaDea(mo () lermr todlmD auvi;()teurimpno4ap n ietl() Drm(m ou1texnmiciaslm eln o;(4 reoio iatomtrau olt t2uo(m io4ol n fcil(fsDuau o;u4alxoiictadfmDemn s;t4treniocty1lmDran i (0trtm(r ny4lptnlncsls aDuau pot0aeen o3iasls rlnmo u0trenif3oy1fm  lu il()t2xmxm3ny4amenmicia()aDrmx p;t1tpx  iciasla rmu o;(0 lxoxr3iy1latrai i;t)seuoio3iudomt mnctltfs2tr(  ot4aetnifeildlsDumnvo;()areomociytfmtr nvs (0seurxmpnydlmtnlnci (faDra(mpou4ope mfcias sDea(vs;u0artrxo oa1oa eauvi t0t2urxopou1omenliesl() Dtau  ;o0aptoifeild s2rmnvo;t0trxoxf tydomt li s;t truo(m oo4am n neil() rrm(  no4tltn oeiasfm elnmsn(4arxnifcia1fa  aneo s setoiopiydap  mneilsf Dtr(moou0tpx mictatla umn p t)texoxf3to1fmDe i o;(0 exmxr3oydape lnvt sfaDta( oou0optoii3iytfa umumo ()trtrir iydlaDelu sl()teuo(o3no1al  mnvias)aDtr( ono4aee  feiydfmDrmu o u)aetoxrciadfm elieolt s2uoxm ny4amte fci tfs2uaumpoo0aptomfetlslm2emnmonu4tlenxocoo1opDranei t  2tr(mpiodolee fvsat sDuru onu0aexomoctadfsDuanmp;(4 etrxfciadomDr nes;s)trurxr no1ll   ivsasf Drr( p;t4opt ioeilslm2ra( s (4teenircio1fpD  i s;()seumxo iodal nliviat a2uru pno0oetomf3tld mDrlump u4trxomrcty1lm eaneo t  eurxr3oy1om nmnvtls)sDrrxmooo1tlt  ociydlaDul(mpn(4tltnmrcoytla e nvolt)t2xoim3iy4lmeelici s aDraurpot0tltn i3tatfs emnvo;t) rtnxrctatfpt ln o;( t2urir3nu4ope  net (fsrraumoou1aex iieiadls2umumo (0tetnirctodlateai sls0seurim3iudlmen ivtl()aruaxronu0olxo ocildfa em(von(4arxrirctodfpt lu s;t) 2xr(o oudape  nvsl() Dumxmoou0ape  i3iat a2rauvp;t0aetrxr tatomDe uesls trtoir3ny1llenlfesl(fartaumpou0optomociytfaDulnvpnt4tlxoif3iydfp  luvs () eurio3nydamtnmfvs (f rumxm nt0olx  fciytfs2rlnmo;t4tltrircoadla rlivs s)tetrir3iu4al nlfcs t) Dumx pnt4aeeoiietlt s2rl(mo u4trtrxr iadop  luvol(0s2uoxr oo4openmfcsa(faDumxmp;o1olx  ieiyd s2eau o;(4tleomfciodlptean il(0teurir3nydllee ncslt srtr(m ot0olxoif3tltla ul( s (4trtoir ia1oa rlies;t0 rxrio io4lmeemncilsf rtrxm ou4oeeo f3iad mDulnmo u4teeoir oytlpDrlnvs;s s2ur(r3oodaltelivtlsfaDur( pnt4texoifetlsfm2umump u)arerxr3iadfaDrau s ( tetoir3nu4am  mfvtatfsrtau ono0teto ieiys aDeanvsnu0aexoir3oy1lmtr i sls0s2xm(r3oy4op n nvs tfsrtmx  nu4alt ifeiad mDra( o t)aetnifctytfpDranvi s) 2tr(opnu4amee nvi tfa2tmx pnu1olx moctytfa rm(vs;(0areoxo3tadomt  iei t  rurio3ou4oltnmncs t  2ur(mo;o0oeto fetyt a2elnmo;()aexoxf3oadopDeli o;t)s2um(r3nudalenlivia( aDrrur nt4opxomoetysfa2ran s (4aexrxo3tatlmt aiei (0srur(o oy4ope  ncsatfa2taum ou4apt  oetatlmDrm(vo;() exnxfciatomDr ivs t s2umxm nodap e netl(fa2ur( o;o4tle  ictld m rauvs;u)tetnio oy1omtraueolt  2toimpnu4lmeemfvi (  Drmu ont4altnifciydla eln o t0trxrmocoytlp e u ils t2uo(m nu4am nmieiat  2rm(m ou0alen o3ild sDuaumo;t) rtniociy1lpt aiei;s0 2umir3nydap nliet sfs2rmurono0tpen f3tltlsDrm( p u0alxnxocoatfp eaneo;s)s2urim3io1omteliciat  rrm(rp;t1tet mfciysla2rm( p;t0 rtomf3iatoaDrau ol( trurxr oo1apenmfeiat)a2ua(  ;u0apt  icils m2rluvp;()aleoxf iodlmtraneol(0teumxo iu4omeelnvia() rrm(r ot1olx moeiydls rmu s;u)tetnio ty1fmte ivsl(0teuoir iu4ome mictat) Durur ;t1aeto iciatlsDeaumsnt0 etoif iadfaDrln sl(0 2tmio3ny1ol emiciat)s2taurpnu0alt ii3iys a um(mpnt4 renxoctodlmDrauvils)t2umxm io1opeelivslsfaDtm(rp;u0texnio3iyt a umnmp;u4tltoif oytfatr iei;s0srtmim no4ole  ivils)aDrrxmonu1oet moeild mDuanmp t4 eeoio oa1lp r uei;s s2urxr3ou4om  mncs (fa2rm(rpou0tle  i3tat mDuln p t4 rtrmf oo1oaD lieo ( t2urxopiu4lme mieta(fsDrm( p;u0aexoifeiydfsDum( s;u0 eenxo oy1omDrau ilt) rtmir3ou1lle mnes s)a2tr( p;u4texnmo3tysfaDuaumo;()teeoxf3oa1lp e nes;(0 2tm(mpou1om n icsat)s2rax  nu1olxn fciatlmDum(vp;u4altnircta1oaDelneo;(  rtoxmpoudom e net s srumumpot4tlxomfetatfs rm( s;t) rermr3oadomt livi;(0s2xrxr3oo4lmt lfvi (fsrrau oot4apx ifeilsfm2rlumsnt0 eeoxocoodfpDe u ilt s2tr(rpno4ll  lnes sfs2umxronu0tle  f3tlt a rlums t)aleomf3ta1lptrauvsl() exmirpno4ap   fviltf rrr(  ;o1oexnmi3iytfmDrlumpnt4texoxr ty1lm eluesl( t2tm(r3oy1lme lfei ()s2raxr nu0apx iiciyt m2ranvon(0tlxnio oydfa elnei ( srto(m io4amenmnci t) Draum nu4oet mi3ild a2rmn p;t4 reoif3tytfp   u il()t2triopoudllen nesatfartaumoot4olxnif3tldfm2rmnvo;(4tetnmf oadoaDran i s)srum(o oy1llte feilt sruauro;u1oetomfctat m emnmsnt0aexrio ia1fmtelu s s0srtoio iu4oltnlietls) rta(mpou4aeen octltlaDea( p u)aleomoctytomtrauvs s0texrio oy1lm elivias  ruaxmo;u0oeenifeiysls2uluvon(0 rxrmfcto1omDrlnvols trumir oodape lncs sfaDra(rp;t4aee moetldfsDemuvo;u4altomo3iodomDr ieo ()teur(o ou1am  lfesl(  2tr(r nt0oeeoifetas a rlu sn(4altomo3oa1fmDelivo t0s2uoio3ny1amenmfvsltfsrtrump;t1opeoif3iltfa2uluvpnu0treomo3iodlm raies;(0 ruoxo3io4ole lnctatf rrrxrpnt0oeeomoctytfsDumuvpnu) ltrxr3oo1fpt aivs;(0 2urim3nodamtelietls)sDtrumoou1oltn oeiysfaDulumo;(0alenmoctydlp r ivi ( trtmimpnodlmee iei ()srrrxmono4tpeo ociltla umump;(4altnirciotlaDranes;()trxmir3ny4altelfvtl(f 2rr(m nt1tlxnmfeilsla2uluvpn(4alxomr ia1op eaiei t)s2toir oodamtn nct ()arrax pnt1alto fciys s2rm(vonu0arxrifcty1fmDr ues;( sexmxr3nu4am  mneta(faDta( pno0tex io3ilsla eluvs u4 eeoir tatfpDe ueol() etoio oodal   iet ()a2tmx pno4tltnmieilsls uan p;t0trxoxr3iadlm elu ilt0teurxr oo4alenmnct s a2rrxrp;u0tptn oeiydla umn pnu4 etoiocto1fpDe ueo t sexoxrpio1lpeelneil(faDtmxmoou1apeoio3iatla rm(vsnt0tlermo3iy1omDr uvi;t t2uo(r ou4lp nlfes sf Dur(rpoo4tpx  f3ild a rau snu4aexnircta1lat lnvs;(0sexrirpny1ome lfet sfarraxroot1tpenii3ildlsDrl(ms (4alerirciydlaD aivols  exoxrpoo4aleemnctls arrrx  nt0tlxn iciydlm2elnmp;() rtrir oatfpt aueo;t0s2umir3oy4ll nlfvt sfaDraum oo4ope  fctad s rlnvo;()texrmo3oadlpDraivsls) ruoio iy4ol e fvilt sDrru pno0olto oeilsfaDel( pnt) exrxf3oadomD  nvi;s)teurxopoodom e iesa( srurx ooo4opeo i3ias s2umuvo t) leoxfcoy1fatraieo ()teurimpnu1alenlnet t) rrrurpnu4aeeo f3tatlm rlu o (0 reoir tytop  lies;( trumxm3ou1ap elivtlt sDua(mo;u0texomieiatfs2em(vpnt4teenircoydfaDelu o;s)seum(r3iy4omt licias) rtr( oou0aptnmfetls a2eaumon() exoxf3oodlat  i o s  2toim oudam nmiesl(f Dtrum nt1texoiocilsfa umumsnt) eermrctadfmDelivi (0srxo(rpiu4ale mnviltfsDur(moot1oex ioetlsfmDuan snt4arxrmr iotfpD au o t texoxr no4ll n icsltf rtm(r ot4altoiicildlm emn o t) exoioctydlateln il(0srumio3nu4lleelnvtls srra(mpot1ape ifeiadla2uau s;u0 exnmr3oydla rlivil(0 eur(r oydol emnvsls  rum(r no0teto octat m ran s;t) leoxf3tytlaD ai o;(0texm(r iy1alee neiat sDtmurpot4aptniociad m uln s u)aeerifcio1op r nes;t srtrir3iydap emfeta(f 2rrx ono0tlt moeiasfa ea(vsn() rtnio3oodfmDranei s0srxo(opio4oltelicsl() rtaxmp;u4aeto fcilt s2rmnvsnu4alxnir tatfm  au i s) rxo(r3no4opt lieta(fsrtr(r ot1apeomf3iys a2uan on(0trxniocootlpD  u o t)s2tmxmpiu4lm nmivt ( aDra(moou4alx iociatls2raumont4tlxomo tytfat lies;t)seto(m oo1lpe mfeilt)srra(rpnu0ole  ociysfm em(von(0artnir3iadfaDrli i t) rur(r3io1altnmfviltf 2ua(  no1tltoiictytfs rlnms t)areoir3oy1lpD livs s0s2toxmpnu4lpenlfei s  2taxmo;o0aex mi3ils s2eluvont)alxomr tatlp rauvs;t  exo(opnodapt lnci s) Dtr(r no0aet mi3iys a ean s t4tltoir3tytlaD  n il()s2um(opiy4op e ncsatfsDtmx o;u0opeomfeildfa2rm(vonu4 lxomr todopDrliei;s t2xoxo3no4amtelnvsa()srtr( pnt1aee mfeiysfsDumu p u4teerir ta1la ran s (0 2umim iy4ap n nesa(f Dua(  ;u0tpt mfciat s2el(mp t0texriociotfmtran sl(0s2xrimpiy4ame mfei t) rtaurpnu4apxnmfciad s ulums;t) lxnxocoy1omtr n sl()trur(mpoy1ale  iei ()a2rmxmo;u0oex mo3ias aDum( pnu0 lxnif oatfmDr nvi s0t2urio3ou4apte ncils) 2umur no1opx ioetat s2uaums (0arerxocia1fm  anei;s t2toxmpiudap nlicia( arrmumpou1oet ifcilt s elu p t0tetrmo3tytfp e nes;s t2xrir oy4lm   fciat aruax pou4alxn oetyslm eluvo;u)aeermociatoptrln s;() rxrxrpoy1ope mncia( arururoot4tlto o3tas s2rmnvs;u0 exnxoctotlmte ueo;s) 2tr(mpou4aleemfcs t s2urumpno4aeto ociltfa2umnmpnu)trxrmrctatop eli slt)t2xmir ou4ol emnct s)a2tm( o;t1aeeo fetas m el(mon(0arxoxr3tadfpDeli i t)s2uoir oo1ll  mnvilt aDtaumonu0teen ocias m rm( o;u0trerxocto1om rln i;t  2xr(m3no1omeelicilsfa2um( o;u0opeo oetat m2rmu pn(0aeeoxr iydfaDr neslt)srxoxm oydomenlnvs s  Dtmumpou1oexniietadla2elumonu0 lxoifctydop rli olt seto(mpoo1lltemncils sDrr(mpnt4tlx ioeildlmDrmump;t4arxnir3oa1lmt livo t sexm(o ou1aleelnvslt)sDuax o;o0altnmi3iadfa2ul(ms;u4 ltrxo iadlm   i s;t0s2um(opnodapen nvtltf 2rauroou4opx  ociyd m2ra(mp () rxnxo3todlatran sls  etrio3oy4lpeemictas) rrmxmpoo0tee iociasla2ra(vp (4 lenir tytfp eli o;s0t2trxo3oy4ap nliesl(  rtru ono0optn o3iyd s2el(vsnt)treoxf ootfpDe nei s) 2xoxopnydlm nlfcsat)s2taxr no1alxnioetas m2rl( p t)arenmr3iadfatranvi ( s2urxo iu1lptelfci ( s2rmuroot0openmf3ildlm elumpnu)texnmr ia1om  lnvs s t2umxo3oudamtelfeils) 2taxm ;t1opxnmoetytfaDul( o t0aexoxr3ootlatrlieols seuoiopnydll nmncslt)aDra(rp;u0optnmi3ilsfaDul(vs u)aetrif ta1lmtran sls0 2umim3nu4omt mieta( arua(  ;o1oet iocils mDua(mp;t)alerxo ootlaD  ies;t) rumxr3oy1apeelfetl(fsrurxmo;o0apx  oeilslsDul( s t)trtomrciytfaDr uvo s)tetr(rpny1llenlnes (farum( pou4tleoio3tltfsDean ont0aexnxociadlat  ivs;s) rxmir ou4lmeemict (fsDuaxr ot1tlx ifeilsfa2ea(vpnt4arxnio3tydfmDr n s;(0srxo(r3nu1oleelfcilsfsDtr(monu0olxnii3iytla2em(mo () exrmrcta1faDrlivs;t0trxrir iu4ap n nct ()s2ua(  nu4aleo fciad aDrm(vp;()teeomf ty1lp  aies s trtmir3iydlp nlncs (f Dtmumpoo4ole iociad sDrl( p t0texrxr3oytla rau i s) rxrxr ny1lp emncs ()s2rmuro;t4oee mociasfmDumn p;()tlerxo iy1oaD  nvs;s)texr(m no4om e feia()arrrxr nt1aetnmocils m rmn onu0 rerxo ia1fmDe u sl()trxrir3iudlpt lfcsl(f rrm(r ;t4olxnmfetys a2rluvs t0arxnir3to1lpt auvslt0 2toxopoy1ame lfvia(  2ra(ronu1ale io3iasfs2emn s;(4texnmr ia1lpt ai i;()srxm(m ou1lp nlieil()artau  ;u1olxoioeiyd m2umnvp;(0tlerxr3iadlmD au s (0s2uoxrpny4olee ivsat)srrr(m no4ole if3tyd a rmumpnt) leoxr3tydfat  u i s texrimpny1al nmietat)aDuaumpot1tpxomieiys s2rmnvonu4alxoxr tatlmtrauvs s0 etrxr3iy1llt  ivilt arrrumpnt1tet mo3tltfs2ra(vo;u0aetoxo iy1fa eaieols)s2ur(r oy4lpe  neils s2tmxmont1apx  ietldlaDranvo u) exrif iy1fmtelueolt)srurxo iu1oltelfet tfsDum(m ot1alxn ictasfa rmnvs;u4 renio iy1fpt luvi;s)s2xmim3oy1op emiei (fa2tmx o;u4tlenio3tyd m2umu s u)aleoir oy1lp raivo;s0trum(r3ny1ame  nvt t s2uaxroot1ape  feildfa2uluvp;() exnifctadlmDeaneol()t2xm(mpou1op   ietl()artmx  nt1aptoioeiytfsDumn onu4artrif oytfa   i o;t) rum(opoudomt lnviat s2uau  ;t4olen o3tad a emu on(4artoxfcoa1omDranvi;(0s2ur(r3nodoltemfviat)srra( pno4apxn ictltlm2ulumo;u0 lenxo ty1la  aneils)t2tm(o iudaptnliesasfs2rr(m oo4tpeniociyt aDranmsnt)texnmocoydoat  n ol()trxm(rpoudalt lncia(fsrtax  ;o0tlxo octydfs umnvp;t0trxnmfciotfmt luvolt0t2tr(m nu1optelfct ()aruaur ot1optoioeiydls2umump () ltrmrctatom  lueslt  exm(rpoy1ol  lfcs tfa2um(rooo1texoiicildfm emumo u0 lenmocoydlmtelues;(0 eurxmpiodllte ieiatf rtrxmpot0aetoio3iasla eanvo;t4teermocoatop  au i;t0t2xrxo oodlmee feia(f 2trxr no4olt mo3tys sDea(vpnt4 renir3ty1opte iei;t) 2urxr3oydlm n ivtlsfsrtrumpoo1apxo icils sDua( snu)artomfctytlpDelnvi ( t2urim3oo4lle lnvsat  Dtru p;t4oeeomicilslaDum(vp u)aetnmocty1fp rlnvilt srxmim3nydamtnlfci t srrm( pot4texomi3iyd m uau o (0alxnxo3iytfpt auvo;() rxr(mpoy1amt mfetls)sruau oou0opt mieiadlm2rlnvont4arxoircio1lmD lu sls)texr(rpnodap emicsltfsrtmxmono1oltnmoetlslsDum(vo u)aeenxoctotfa  lies;s)trxrxrpiydoltnmici (f rtm(mp;t1tltnmoeiytfs2umn pn(4aeeniociodop ran s s)s2um(m ou1ope  fcta( sDtaxroou0oetniiciasls el(vonu0tltnio3ia1fa rlnes;(0t2toiopoy1oleemnvta( a2umxmpno0aetnii3tydlaDuan s;(4trtnmo tydfaD  neilt0 ruoio3iu1lmen fvs t)s2rmxrpnu0texoii3tydfs2eaumo;t4altrxf ty1fpDranei s)s2tr(mpiudaptnlnvsa( sDrru  ou4oetoiiciydls uan pn(4aexnmrctotoatrlnesl(0t2xm(m iy4apt mivtasfs2rrx ooo0tpxnii3tlsfa uau p ()tleoio3oytlp   ieols) 2toxrpnu1opt  fvilt  rumxmooo4aeenmfciad s elu s t4 lxrxr3iydlpDeaneols) 2uoxmpoodlle  ies ( arrmu  ou4tetnif3tadfa emu s;u0alxriocoatlmDranei;t  euoio nu1aptemivilt)srtrump;o1tpeoio3iyt m eaumo u4aleomf iytfpDeauvsl()trtoir nydomtelncia()sDrrxrooo1tlt iictltlaDeau p ()arxrxr iatfaDeau s ()setr(opiydaptelfetls  Dtm(mpno1opx ii3ild s2ra(mpnt)altnmocoy1lp elu i;t0texmxopny1lp n ivs ()arta(  ou4tleo oeildlaDrluvs u)alxrxrcoadfp eli s;t texo(m3iy1lmt  ivtl()aDuaurpou1oee if3tlsla2ra(mpnt)trxoir3iodom elu ols) rurxm no1lmtelfcslsfaDrmumpnt0aet  feilt m ulu s t0tleomr3oatlaD lues s srtmxmpou4lp nlivt s srua( onu0olxn fetatfsDrm( o;t)altnifcoo1om eanes s0 2tm(o oy1lm n ieiat  2ta(m ot4ape ifciltfmDelnvs (4teerio iy1oatrln o s0 etr(m oydaptnmfcsltf Dta(ront4oee iiciys m rlums;u0trenxf tatoat li slt  exmim3oydoleelics s)a2umxrpnu4aetomfeiys a2ra(vo;u4aeenxrctotlptrln s;s s2xoio ou4omtnlfet tfartaxro;t0teeo i3ilsfs2umn s;(4tlxomo tadfp   ivo;(  ruoxm3nudaptelfct sfs2uaxmo;t0texoifciyt a2rm(msnu)altnirciytoat  ues;( s2toxr3nydllee ietl( sDraxmpnt4tet  fciydls ra(monu) ltrmr3oa1fmtranvo (  exoim3iu4ap  lnvtat)sDrm(mpoo0ape mieiadfmDrl(mpnu)trtnio3tytfp r nes;s  etrimpiu1lpt  ivsat  Dtm( pou0oetomo3tatfmDra(mp;() lerxo3iatfa raues t sexrir iu1ol  lfcsas) Dtaur nt1opx mictas a rmu onu)aeermr tytlate ivilt0 eur(o3oodamtnlnei tfaDrm(moot0tle  f3iyslmDulnmonu4aexnirciydfmte ueol(  2uoimpoodopte ieia() rtm(r oo4alxomoctyd a2rmums t4 ltrif oytlmt  uvi;() 2tr(rpiudamenlfesl( sDtr( p;u0oetnmociyd m2rm(ms;u0texrxf3oodfatrai o;s)teum(r oy1lp emieil( aDrm(moot4tptoiictldfs umuvs t4 eerif ta1fpD li i;()sexmiopno4lmen fcil(f Dtax pot1oltnmfctld s2ranvs;(0altnifcoo1lp e i s ()srto(r ou4om emnciat) Drmx  no0tpxoifetytlaDeanvo;t4 rtoio oy1oat auvs t) 2uo(m3nu1llenlnesls) Dra( pno1olx if3tatlaDemnmont0 ltrxfciy1laDranvsls) 2xm(r3iy1am  micslt)aDuru p;o4aeen i3tlslaDrluvp;u)trerxocootlpD luvs;()trtmxm no4ol  mnvilt aDtmxmp;t0aeto oeiltfa2uan o;t0aeerif3ty1oaDeai olt  2toxopno4ll elivilt) ruax  ou0apenmoctldla ea(ms u)trenxrciadopD lneolt) 2uoir iudom emies s sDur(m ;t4oex miciltlm2ul( s;t4alxoir3totlaDrai o;( seurir iodlmtn ncsas)a2ururp;o0aeeo ietyslsDrau s (4 eenio todomt lnvo t)tetrir3oodap elictas  2uru oou1aexomf3tytfs em( o;t4aexoircoydfaDr u sls trto(opoo4om nlnvta(fsDuru o;t4alxo oeils s2elu o;(0 eeomr3io1fm e ueo t0srxo(opnu4lle mici ()sDum(mpno0aexomoeiytfaDeauvs;u0aexnifcta1fa r ivsls0s2xoio3oo1op e ncil(fsrrmx onu1tlxnii3iytfaDrln pnt4tltnxfcoo1fp rlueo t0 2xoir3iu1ap e ncslt) 2rr(rpnu4ale ifciadfm rau s;u4teerio tadlm e i s s) rxmxo3iodlm elnvi s s2rmurono0tltoif3tysla2rlnms;t4aexnio oytomDr neols) etmxo3oo1lp  mnet s)sDtm(  ;o0ole  feilsls ulumo (4trxrxo3ootom  au o s0srtmxr3ny1alt lieilt) Dra(roou4aee moctldfm2um(msnu0 lxoxf ta1latr i o t)teto(m no4olt lfetatfaDuau o;u0apx mf3iyd sDrl(mont4arermr3oodlp rluvo ()srtoxrpoodoltn ncta( a2raxr oo0apeo o3tat s2ulnmpnt4aeermrcoytoat ln i s t2xm(opnu1ope mnvtls  2trx  ;o0alen o3iytfa2ea( onu0tltrxr iodomteai s;(0trxrim3io4am   fct sfsDururoot4alto iciadls ran s;t4arxnxr ty1fmDeaieol( teumxm oo1om n ivta( a2uax pno1open icilt a uau onu4teerxr3oodfa   u o s)truoxr3iodaleemfcs t  rua(mooo0ape iociatlm el(mp t0 etomociytfm e iei ()srurir nydoltemiesasf 2rmu  ;o1olxoio3iyd a2emums;t0alenxf iydlmDraues s)srurxo3no4lle lfeta( arururpno4oex mi3iad s2rm(mp;t4alxrir3oy1fat aieo;( srtmxmpnydam n iesls sDtm( pot1apxniictldfs2ran p;t)tlerio oa1op raivo t  2toim3nydomtn fei tf Duaurpno0aet  o3iyd mDrln o t0aexoio tatfm eli sls)trum(o nu4amtnmieil()arur(r nt4oleo feiltlm uan sn(0tetrif iadoateanvol()truoxr oy1amt mietl(f rumxro;o0openio3iad m ranvonu)aleoxo todlpDe nvs t  exrxmpnydopte iviasf 2rr(m ot0tpenmf3iytls emnvs t0 lermrcoy1laDe n o t) 2urim nodlm emictl(fsDua(r ;o1ape iietas a2elnmon(0 rtrmocootoatrlies (  rumim3nu1apeelnvi (faDurx pno1opeomo3iyd s eau o;(4tltoio3oydfptr nvs ()srtm(r nu1lmtelnvs t  rraur ot0teeomoeiydfsDrl( p u4tltnircoo1fateai o;t0 2uriopiydal  lncia(faDuru  ;t4aexnmfeiyt s ea(von()treomfctadlaDeaues;(  euoiopnu4lle lici s  rur(moot1oleoiietas s2ul( pn() ltrircoydomtelies;s  etmxopnodol n fci () Dumxmoot4texo feiyslm2rlu p u0texnmo3oo1lpDr n o;()srxrxr3ou4opt lfetls)srrru  oo4alxomo3iltlaDelu o u0trenmfcoy1fa   ivils) rxrxr3oodll emnvs t) Dtaxro;u4opeoif3iytfs rl(vo;()tltnxr ta1fm e ivs t  2xrxr3nu4lm emncias  2tmx  ou4aetnifciaslmDrmnvo;u0 ltrir3iy1om eluei (0s2urxo no4ap emnes t) Dtaxmooo0olt  ietltls2rm(ms;t4 exrmo oy1lpt livil( teumxm3ou1altnmivia()a2tmu  ;t4tltn o3tysla2rm(mpnu0 rerio iatomtr i i s0t2tr(rpnudomen ivs t  Drrum ;o0tlto fcilsfsDulu p t0texrio tytomtraivsls0 exo(opoodlpeelicsl()a2rm( ont1oex  ieias aDrm(ms;u4tlenxfcoa1lmtraivs s sexr(o3nudll nmfctlsfs2um(mpot1tpen o3tyt a rmn ont4teenircia1lmDrlivi (0 etrirpoo1ol n nctls  rta(m ;u0tle io3ilsla el(ms;(4tetoxo oydlptelu olt) ruo(o io4omtn nvi (fsrurum ot0teeoifetatfsDrl(vp;t)aeerxrcoadlp rln s;s0s2ur(mpnu1oltelfeslt a2ua(mo;t1aetnifeiad s2eluvs;(4 rtnircoodoa eaivi t0 ruoir3nudomtelfvia(f 2ta(  ot0ape  ieiaslmDrl( s () etrircoy1lpD lnesls srumxmpoydamtn neia(faDum( oot0oexomieildls2rmums u4texnif iadop rlneilt)seto(mpoudom e nvtltfartmuro;t0tltnifciys a ulnvpnt4 lxnxf3oatom eai s (0t2xoiopny4olt lfcil() Drm( o;t0tpt  i3tatfm2rmu p;()aleoio oa1fa e uvslt0 eur(m3nu1op nliet sfs2urxr ou4aex  feilt a2rlu o;()areoir3oodfm elnes s)trxmio3nu1lltemici (f Duru  ;u0olto o3tat a ea( s;(0 lenir to1oa  aivsls0s2xo(rpnodllt mfetat  2rmu  ou4texomfcild aDulnvpn() eerxrcootfpD  u il( t2umimpnodol nlfvtlt)a2trxro;o0ole ifcils a ea( s t0tlerir3iydlm  lieo s)t2xoim nu4lltnmfci s) Dtrurooo4olt mi3tydfm umums;(0teenio3oadlaDranvol(0srur(opiydlmee ncias) ruru oou0ope mo3tys sDul(monu4trtrmocta1omDrlu il()tetr(rpno1om elivsls s2rr(mooo0oexnioctydlmDranms u0 rxoxr oatoa eanes (  rto(m nu1am nmictat srtrxmpoo1tlxomi3iadfs uan o;u)arenmr3ta1lpDrauvil()srxo(r3iudlmen ivi ()s2ua(rpno0aet ifeiaslm2elumpnu0tltomf iytlp rlu i t) 2xm(r iy1oltnlictlsf rtru ont4tleomi3iydlm2emu o;(0alxnmo3tadfa eaneo ()s2uoio iy1aptn nvils srurxm nt1olt  ieiytla2ra(vpnt4tetoio3iydomDrlnvol(  2urim nydom  mnei t artmxmpot0olx if3iyslmDran pnt)texrio3iotfp   uvi (0setriopno1lmenlnvi ()sDumxrooo4tlt mi3tldfa2emnvont)arxnmr tatom  auvslt0 rurir ny4lm nmfvils)sDur(  ;u0tlxo oeiadls2rln o u4 rtrxo tadfaDrlnei;(0 ruriopou1alte feilsfs2rrxmp;t4alxn i3iat a elump t)artoirctodom raieo;s setrimpio4am n nvtl( s2umxmpoo1tpx iieiat mDran p t4 lenir3oodlmtrlnvo s) rto(o3oydlmeelncsas artm(ro;u4tlt iietlsfaDea(vp;(0 rtnircoadfpDe iesl(0trur(rpny4ame mncsl(f rrm(mono0opx mfctls aDua(vsnu)texrmr3iadfmDranvilt srxmio oy4lpee net t) rtaur ou0alx mo3ilsfa rl(vonu) ltrmf iotomDr ueol( trxoiopnodamte iesltfa2ta(mpoo1aeeniiciytlmDulu s t4aetrir oy1omtelnvs t)texrim iu1om  mfeiasf 2ra(monu4oetniociatlm2ea(vp;(4 rermr3iodlmt  nes ()t2toir nu4op nliet (  2trum nu1texniociytfsDulumsnt4 etriocta1oateauesls) rtm(mpoy1lpe  ies (fsrtmxm no0apeomocils sDuaumpn(4artrxrciotlateaueols  2umio oudome  iet (  ruax p;t1texoio3iyd m2rauvo t4aeerxrcoydlm rlivslt  etrxm3ou4oltnmfeils) Dtmumo;u0ale mocild a2ulnvon(4aexnxoctodfat auvils)sruoxr oo4ol  liei t)aruaxrono1tpxoiociytlm rlnvs (0tltriocoodlm  anvols)srtr(m3oy1oltnlfet s) rrrxr ;t1tptn ociltfm2rmnmo u) rtrmrctotfm  lueo s truo(r3oy1lp nmieta()a2tr(r ou0teeomoctldfa eanmpn() eermr3oo1lm rluvo;t0trxm(o oo4oleeliesas s2tm(m ;t4apxomo3tyd a ra(msn(0arerio oydopDrln o;t t2uoxmpiy1omtelncs t)arrrurpno0aeenmi3tad mDrmumsnt) rtoxo3iydomtrluei s t2xoir io4lp emies t  2trx o;t1aleomoctydla2rauvs;() exoxfciotlmD ai o;( s2um(opny4omtnmfet (faDumxmo;u4texnifeiltls emumo u0artnmo3tadop  livo (0t2uoir iydol e nei (f 2ta(mono1tptn ociatfm2umumo t4alerxr3todfm eaivi t0trxoxmpio4am  mict t  ruaxmoou0aetn i3tas aDem( o u4arerxoctotoaDeaneslt t2tmxm3no1om  mfcsa(faruaum ;t4teenmoeils sDumu p t0artnifcoo1fmtrln o;t0s2xoimpnudlmtn fvt s s2trx  oo4ape ifeias s2rlums;(4trtnir3tydfmDean i s)s2trir iu1oltemicsat s2uax p;t4oexomf3iys mDra(vo ()tleoif3oatfp eaueol()t2trio3no1lpenmnci s  2uaxmo;o1aptoifctad s2uln p;()trenifctodoptraivs s) etmxm3oydolte ies ( s2umx pnu4tpxomiciys a uluvon(4aexoir ty1lp  lueo (0sexmim nodol   fvi t arrr( onu4tpenif3tysfm umuvs (4trxoiocto1oaDrlies s)srxmio nu4am   icsl(faDrm(rpnt4oexo o3tat a el(mp t0 exomfcia1fa  luvi t trxrxrpoo4ale lnci t  rururpoo0oleniociysfmDran pnt0aexrmfcta1lpte u s;s) 2toxr3oudaltemfvtat  rrm(m ;o1tpx  oeiasls rmuvpnu)teenxrctotla eaneilt t2to(opiy1ll  livs ( sDtr( oou1oetn i3ild m umu p;t)treomr3oatlp   i s s) rtm(o iudlle lfvi s s2rax pou0texoiociatlaDeaumont0tlerif tadoaD au s t  rtmiopou4ame mietls) 2uaumoot4tpeoiocias m2ulump;u4artrir iatlp ranvs t) rurxr3iy1llee ncs t  2rm(moot0oetniocilt m rl( snt0artoxr tytlmDe n o;s0s2trxr oudameelfvs ()aDuaxmo;t4tex ifciydfm emnvo;t0alxnir3oy1fp raues s0 2tm(opnodlp  mfvtl( arua(rpou0apxnmocildlm emu snu) eermr3tatoa r nvslt t2tr(o3no1al emnesls)arrau p;o0tlx ifciysfs rln o t4altrio iodfptr nei;()s2xrxmpiudol   iei sfsDtmxm no1tpxomietytfm um(vp t)teermfctadom rauvsls) euoxm3iudol nlncslt) 2rmur ;t4opxn oetysla2elnmo u0 lxnirctytlm rlueil(0srto(m3nu4llenmfvi () 2rrum nu1aeenmi3iydfa2ulump;u)alenxf iadfmD  uvolt sruo(r3iydllt mfviatfaDra(mp;t4aetnmociyd s ea( p (0trtrxo3iadlaD anei;(0setr(r3iodol elnvt (faDtrumo;o1texo i3tyd a2eanmp (0 eermf iydlatelivs;s trtm(rpiodlm e nvsl(  2tau pno4aexnmf3tadfs2umump ()teermr3iatlmtrli ols srtmirpiodam  licsas  rrruroou0tle mfciydfm2emn s u) etoio3iy1oa r ieils s2tmio iu1amteliesls)srumuroot0tpenmieiyt m em(ms;(0tltoif oytlaDrlnvilt0srumxmpiu1lpeelnesls srrr( p;u4aexomfeiydfsDua( s u) exnxr ootlmD  n i;( texoxm3oudllen ivsat)arurx  nu1aee iiciltlsDra(mo;(0 ltriociy1oa eluvo;t srtoxo3ou1am e icsasf 2trxmoot4opx if3iytla2el(vo u4arerxf3iodoaDr u olt0 2uo(o nydom nlfviltfarrr( ont0tlx mo3ildla el(vsnu)altnxr3tytfm r nvil(0sexoxo oo4am emfesl(  2ra(m ;o4apenmictys s rauvp;u4 ltnxr ia1fm ean ils trtr(mpiudam n ivsatfsrtr(moot4tlxo ocildfm2um(mo u0trenifcootfp elivs;s s2tmio nu4op n fetlsf Dtrxmpot1oexomo3tldla em(msn(0 lxnmr3iydlptr uvil( trxmiopny4ol e ics tf 2uauront0ope mfcils mDran p;(4altomr3iy1fmtelnvs;s0tetoiopoodom e fvil(faDtmxr ot4tlto ictas a rlu p u4tlxoir3tatomDr neols srtm(o3iu4lmenmncs t  Drmurooo1apt mfciltlaDua(mon()aetnir tatla e ieo;t texrxr3ou4ole  nei sf rtmu pno1oeenmoeiytls2rl(ms () etoxrcootom  livs () 2xm(r iodapen fvs ()a2ua(r ;u4tpx  iciad sDrmnvpnu0aetrif ootfptran o;()trumir3oo1lltelfet () Dururo;u1teeo ocias sDranvont4 ltoio3tytfa rli sls0t
\ No newline at end of file
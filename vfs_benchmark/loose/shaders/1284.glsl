@@ -0,0 +1 @@
+uvi ( t2xo(rpoo4lpenlnei () ruax pou0tee iietldls2emumsnt4trtrxrciy1laDrlnes ()s2umxr3oodam  lneiltf Dur(ronu4altn ociltla eaumpn(0tltoxrcoytoa rlnvi;t  rxr(o io1olt livsa(fs2rm(mo;o4tltomf3tatlaDuanvp;u)arerio3tadlp r uvs (  2xrio oy1amtelncsa()s2taumpot4tlt iocilsla rmnmont4arxomociydopt lnvol()srxmiopoy4om  mncslt)srtmu ooo4altnmieiat a2ulnvp;(4 rxoirciydfaD lnei t t2uo(r3iydlmeemfcs t srraxr ou4olenifciad a2ulnmo t)texrif iatoa e i s;s) rtmxo ny1lptnlieia(f rrmxmp;o1olt  f3iatls2ea( p;t0 exrif iy1oa r ivi;t setmxm oo4aleelfvsa(fsDum(rp;u1texnmfetydfs emuvpn(4altrmf ty1fmtrln ols)sexoio ou1omtn nvils) 2rr( ont0oetnifctldls ea(vs t0tlxoxf iytfa  aiei (  eumim oodlptnlictlt) 2umur ot0tex mf3iatlmDumn o (4alerxf tatoa  lu sls0 2tmxr3no1lle  nvs s)a2urxront1apeoioctas aDrau p (0aeeoxr iydlp   nes;s0 2xrio iy4lmtn fct t) 2urx pnt4alxo ieiadlm2ua( pnu) reoxf tadlmt li sl(0 2tmxm oo1lltn ivsa(f Drm(mooo1alxnmfeiatlaDum(vs;(0trtoxo todlmte nvo;(0trxmxm ny1ll   fcslt)aDurumoou0oex mi3iyt aDuluvs u)trxoxo iadomD  nvols0t2xm(o oo1ol n fciat)s2rrxront0olenifctls a2elu pnt4 eenif3oy1fptelu o;s)trtoxo3ou4lm n nctas)sDtax ont1tet  o3iasfm rauvo t)aexrio3ty1oaDeli o;()teur(mpiu4aptn fcia(farrr(m ou0opt iiciysls2uan sn()tleoxf3oodfm r neo;()t2xr(o oo4olt  fvtl()arraum ou4apenif3iltls rm( sn(0 lenircoadoaD auvo s sexoxm iu1am elnvs sf 2tr( oot1teeo ocild a2eanmon()arenircoytomD  i i t)seur(m iy4amt mnctl() 2taxrpnu0apx  feiadla eln sn(4 reoxfctatlpDean s s trtm(r oydop emncsa(fsrumumooo0aleoifciytfs rmnmont0 renio oy1fp  aueil(  2xrxm3iy1op   nvsat  rur(  ;o4optoioeilt a2rl( o t0aexnmfcto1om r nvs;s0trxmxmpiu1lp nmfcsa(  2rmu o;t4tpxomo3tlsls2rlu p;(0teerir oy1fpDeaieo;( sexm(o oy4op e ieilsf 2uaumooo1ape  f3iytla2emums t0tltnxrciadomD  ivs s0t2xoxr3nu4al emfviasfs2tmu  nu4tle ii3iad aDemnmp;(0tetrxf oa1fm   ues s0tetoimpiudopte neta(fsDta(rp;t1oetn o3tydfa2rau ont)tltomo to1opt lnvil()s2to(rpoo1ol n fcsas)sDra( oou4aexoiiciadlsDrm(mpn(0aeeomr oodop rluei;(0trto(opiy1al nmicsas)artmxrooo4oexoiieias s emnmsnu)altomo io1fmtrliei t0 ruoir nudap elncsatf 2rrumo;u0tleniietltfaDemn ont)aexnxo3iytfate nei;t0 2xr(m oudllen fvias aDuaxr no1alt mietydfa rau p u0 lxrmo tydlptrlivolt)texrxr nu4alt lnei tf Dtmum ot4apen octltfaDumnvp t4teeoif3totlaDrai il( s2uoio oodlm e ivsl()artmx pnt1tee mi3iltla rmnvont)trenxrcty1lpDrlieo s)seuoiopoy4ale  fvsl()aDur( pno0aptn iciadfm2uan p;t)tleoxf3tatlmt  nvs t)srxo(rpiodlptnmfvslt)aDrmx  no4apeo fciasfmDuanmpnu) rxoif3io1oaDe neol() 2uoir nu4amte fvsa( aDraxr ;u1alenmo3tlsfmDua(mp;t0texomo iy1oaD lnvsls)setoir3oy1ap  mfesas  Dtr( o;u1tetomo3iyslm2ua(vont0tetnmo3to1lpt  u sl(0 exoxo ny1lle  ietl( s2tmu p;o1apx ioeildfaDrauvp u0aleomo io1omD luvsl( texo(rpnydlmeelnetl( aDtm(mo;o0alxo icilslm emnvp;t)alenxo3tadlm r n i;(0t2to(r3iu4openlfei t)aDta(ro;t1tpxo fetysla ulumon(4teenxr3oodlp r nvi s0 2ur(mpou4omt  fvsa(f rtr(ro;u1tpxnii3tasls ulumsnu) reoio3ootoaDr nesl()tetoxo3iudlptnmies t)sDua(ront4tpxo ietlsfs2eln s;t0 ltomo iydfmteaues;t)srtrxm iy1amtn nes ()srtax p;o4texomi3tadfm2elumon(4 rtoxr ty1fm ranvo;s) rtmxopiodlm elfcil(fsrta(mont1tleo oeiydlsDra(vont0texrif3tydoa raies (0s2tmxm iu1aptnmietl(fs2uaurooo4tlxnmfctadls2el(vs u0 etoir oy1optrln o;t0srxoir no1omee iesl()srra(r ;t0teen octydfa uau s (0 reomr3ty1om raneilt) rxmio nudaleemfvsasf 2rru onu1optoio3iyd mDeaums;t4trenio3oo1op r nes;s0texm(r3io4olt mictls) 2umu onu1tpe iicildfa2ea(vp t) lenifciotop ean s;(  2xmxopno4om nliei t  Drrum ;t0tlx ii3iat a2rmuvsnt0aeenmr tadop r i olt) rtmir3oo4lmtnmnvt s)sDrrx poo4olen o3tas m uan pn()arxrir3oodlmDr u il()srtm(m3no4lpte ivsatfsruru ono1tpx iieildfs eanmsnu0tlxrir3iy1la   nesls0setr(m3no1op e ncs (fa2tmur nu4oltoifciyt sDrmu o u0 etnmocta1laDr ues;t0teurimpoodlm emivtas)srtmurono4tlt mfcilsfa2rm( p;t) exomf3ia1fmtr uvslt trxoir3nydlmenmivslt)arumxro;o1alenmfeiltlm2ulu o;t0teermo todlp eanvol(  exm(o3ou4omeemiei tfaDrrur oo0tltnmi3iad mDemnmp;t4tltrxo iotlpt aiei;t0t2xm(rpnu1lle liesl()s2trumont1tpt io3tydls2elu o (0 rermo oadfaD lnes s0 exrxo3iydal   ietasfaDururono0oexnif3iyd mDuanmonu0trermrctotla eli s ()trtoim3no4aleelneia(fsDurxr nt4tex ii3iys s2emnmpnt) rxnxfcoadfaD ai olt0 rurxmpoudlm nlfcil()aDrmxmonu0oex  f3tys a umu sn(4texoxocoo1fmDe ues t) 2xo(m3nydam   iesasf rtmx  ou4aetomi3iatfa2uanmo;t0arxnxf iydlptrln s s)srtoxo3iudoleelfct t)srum(ro;o1tex mfetatlsDum( s;t0altrxr3to1lat anes;t) 2toxr nu4openlfctasfsruaur ou1olto oeiysla ra(vs;(4aexnxrcoy1lp   nvo;s0 ruoiopny4apee ici () Draumono4oexnmoeildfs2rauvs () lxnxr3oytlpDelnes s)trxm(mpnu1ll e fct ( srurx  nt0apen oetatfs rlnvo () etrif ta1lpDe uvilt)s2tmir3oo1olt lnetatfarrruroou1alx  octyd aDelu pnu0trtoxo ty1fmDe i o;t0t2xoxr iudop e icsas  2umurpou4olxn f3tadlm rmuvonu)trxnxr io1lmDelies;s)truoxopnu4lleemnvi ( aDtrx  ;u0aet iociltfsDrm(mont4aeeoif3iadfpDe n sl(0texmxm3no4lpeemnvtat artmum ;u4aex  o3tls m2uaums u) lxnxo ty1la rauvs;(0trxrim3nodol  mieil( a2rmx p;u1oee mfetls m2emn sn(4treoxrcoatoptr ivs ()setriopoo1apenlietltf ruax o;o4ole io3iltfm2rl(ms;u4tlenxf io1omteluvo t seumirpoodlpt  icilsfaDtmxmo;u4tltniociydfm ean onu)aleomf3tadop eln olt seumxm3oydopen ivtls) ruax o;t0ale  fetas aDua(vs t4 rerxf iodomDrlivi;t0sexmir io4ope miesl( artaurp;t0altomietls a2ea(vp t4alenio oatopDr uvi;t setm(o3oy4op   fcsat)s2rm(moot1oeen ociad mDea(vo (4 etoirctatoaDe nvo;(0 2xr(m iu4apt mics s) ruau  no1oleniictltfa2elumon(0tltnmo ta1lateli o;t t2umxo3ny1lltn fesa()s2rr(ro;t0tex if3tltfmDua( p (0 lenmf3oy1oa eluei;s) 2xrxo nodoltelnctls  ruaumo;u1alxn fciytla emuvp (0altniocto1fa e ieols)teto(opiu1opt  nvsa()srrr( p;o4tlxomociltla ea(vs;t0 ltnir iotom  aivs s t2to(opio4llee ietl(fs2ra( pno0aee ioeiydla2ean o () lerxfciy1la  lu i;t0t2toir3ny4ap  mfcta(fsDua(m ;t0tetomiciltls rmump u0aexoifciatfmD  nvi (0 etrir ny4aptnlieiat)s2trxrp;o1oetomfeiyd s umu pn()aleoxfcoatoa e ivo t0srxoirpiodlpeelivtasf Durxrpou0tlenmf3iat m em(mpnt) exnxocoo1om  an o ( seurim3oy4openlict s aDraxr ;t0tet mieiad s2elnms (0aexrxo iadoaDrlneol(0srum(opnydlpe mfcias  rtmu p;o0oeto fcilt mDua(vs;t0trtnxr3ty1omD  i s;s)setoim3iu4om  lict tf 2um( o;o4oex  fciytla rln s u0tltoxr ia1fpD lnes;s0texr(r3iydlmen nvsat srtau o;u4tptoio3iys m2rm(msnu4alxoxo oodoaDelnvi;t srtm(mpoodlmee fes t aDtr(rp;o4olxoifeiltfm2ua(msnu0tetomr oodla ranvs;(  rxmim oo1ol nmfcs t arrmu onu1tpxn ocias mDea(vs;u4alenio3ootom  lnvo;t  rur(r iodaltemnvslt a2ua(mpnt0olx ioeiydfm2eanvs ()alenmrciodfpt li s;t0setmim io1op nmfvtl()arurumoou1tptnifetlslsDemnmp t0aetomr3iodlmDeauvolt0t2umiopno1oltnmnctl(fa2tr(  oo4oexnmictldls ua( snt4 ltoxociy1opDr n i;s  etmxm oy1apt  netls) Dtmu pou1oex mo3ildla2ra(von()tltoxf iy1oaDr neil() rtmim ou1ope mfeia(fsDua(mont0tleoif3tas m2emu o;u4 ltrircia1oa e n o t  2tmir nu4am   fct (farumxrpou1opx ii3iat a el(vsnt0 rtnmf tytoaDrai il()trxmxo oydomtn neilt)sDrmxr ;u1olto oeiatfs rlnmpnu0treoiociydfp rlu ol(  eumxmpiy1ap n ncs (  Drmx  nt4aptoifeiydfa rlumsnu4 lxomf3oy1lm   u slt  2xm(m no1lpee fes (farrmxr no1aleomo3ilslmDulumsn(0trtrmf3tytfp   i slt sexm(r3nodll  lncta(fs2rrx oou4olenmfeiysfsDrm(msn()tetrmo oatla rai o;s) eumio oy4llt  fesas aDrrur ;o4apxn icilt aDumnmo;u)aetomr3iodfpDelivo;s0t2toio3nu1ap elneiat srur(ro;t0oeeomfetysfm eanmo;(4trermrcoy1lpDe uvs s0srurxo io4lme mivsas)srumxmooo1olxomieiyd a2rln pnu4tltnxr to1fpDrauvslt0texm(rpoo4ol n ncsltf Dra(r ;o0aptn i3iatls rau snu)alxomf tydlpDeau i;s)tetr(mpno4om nlncs s arrrurpou4aeenmo3tas sDul( on(0 ltrmociodoa  livo;t  2xoim oydopen neia(fsrrrxmpno4tltomf3ias s ulnvp (4 etoifcoytopDrlu i (0 exmirpiy1apeelnvtlt a2rrum no0oee  iciyd sDrmu sn()tltoirciatfmD  neo;s trxoimpiy1am e ivtat  rua(m ;u0olxoiieilt a ran s;t0aetriocty1omtr u il( setoxo iudlpe lict s) 2ua( o;o0tlenmi3tydls2ua(vs t)alxnmo3iadom  li s s srxriopiydapt lncta( s2rau  ;o4oltomo3tltfa2um(vsnu)alxnxfcoydfm raivsls) rxmxrpio4om nmfei t) 2rax  nt0apt iietadla eluvp u) eerxo3todlatean i;s0trumxm3oo4lltn fvi (f rrr(r ot4aeeo oetls a elnvpn(0 renxf3oadfa e u i;s0tetm(r iy4llenlfcsatfsrtmumooo0oexo fciydla ra(vo;u4tlxrir io1fmDe uvs s)srtm(o oudape lfet (  rtauro;t4apxomi3tyt m elnvo;u)aexnmr3oa1fmt aneo (0t2xrxo nu4altelieiltfaruaxmo;t1aee mfctldfm2eanmonu)aexnxrciotopDr iei s0t2urio nudapeemfvtls sDtmurp;u4alxoiieiytfs2em( o;t0arxrio3oydlmDeluei s0sexmim3nu1op   icsls)s2tm(ront1opx if3tytlmDem(vsnu0 rxrxf3tydop e i s;t0trtoir iudlmen nvi ( s2uaxmonu0olt  oetasfa el( s;()aetrmr3oydom  luvilt) 2tr(o3nu4omtnlfct s  2uau o;t1tlx  iciysfs2emnmp u4alenmr3todfm rau s;s setrimpnu1ope liei (f Dtr(mo;o1aexn ieilt sDrln on(4altnxf3to1lp e u s s  rum(rpoodamee ict t  rtauroou0olx mf3tadfsDulu sn(0aeeoio3iatomDeln s;t)sexoim3oydllee net tfsrta( oot1tpeomo3tas aDuan ont0 rxomfcia1op ranvsl(0 2umxrpnu4alen icias) Drrxr ;o1aet mociltla ul( snu) eenxr totoate uvil()s2urxopiodolenmnvslt a2rr(m nu4oetomi3iyt s em( ont0 rerif3to1lpt an o s setrio3ou4amenmieiat srurumpnt1tptnmf3ildls2emumo;(0arermo3oatlm eliei;s)t2tm(r3oudlpe  nciasfsrrru pnu1tlt iietydfaDulnmont4texrmrciodopt lnes;(0seur(m ny1ll nlieil() 2umx pou0oetoiieiydls2uaump;u) eeoircoytlm  aneo (0tetrxm oy4lpeemietltf 2ra( pou4olxnifciyd mDumnvpnt4tetoir tatlm r u i (0s2uoir3oydamtnlfet s aDtmxm ;t0aetoiieils s umnvpnt)trtrmfcta1faDr uvi s0trxoim3ou1amen nvslt  Draxmo;u4oeeomietldls um(mo t0texoxfcoa1lpDe i i ( srxm(m3oydal emnes (faDraum no1optoio3ildfa2em(vsnu4aleoxf todom r i o;(0 2xrxmpoy1om  lnesasfaDta(r no4tpenioeilsls rln sn(4aetrmr3to1lpD ln i ()s2xo(mpou1llt mfvi sf rtrxmpoo4tpt iictat sDem(mo;u0 lxoxo3oadlpD anvo s)trxo(r3iudol n feta()sDtrxr ;t1oet mietas m rl(ms () ltnifctatoa r uvi;t) 2trxmpno4altnmnvs t) Dra(r ou4tptnmo3tas a2rmn snu0alenxo3oytlp rlivs t trurxm nu1ole  fvi s)a2tm(rooo1alxomoetlslaDuauvp () lermrcoydom eai o (0seto(r oy1alt lfeias sDtr(r nu0tpe  octltlaDeanvo u4aetrxf oo1op eln il(0teumxr3nu1lme lieiat)sDrrx  no4oex ii3ils aDrln pnt)arxnmrciydlmtran s;(  exoxopno4omeeliei tfsDtmx o;o0olt ifcias s2emuvp;(0 reoircio1lpteaues;s  exmxm iy4om  lnvi ()a2uaxro;o4opt  fetldfs rm(vp;(0 eerxr ta1opDr neslt sexoimpou4ol   ietl(f 2uax ont1ope micildfa ua(vpn() ltoxr oodoaDraues;()trxoimpnu1olt  fciltfsDrmumoot4ape iicildla rl( s;(0tetrxr3oo1lmte n ils trtrio no4alee ivilsf rtmu onu0tlxo iciltls elu o u) eermf3io1om eaueilt0texoio3no4alee net ( s2rrurpot0texomo3iltfmDuluvsnt4altoir3ta1fp   n s t srum(opoo1opt mfetltf 2trx ooo1aetniociatfm2rlnms;()aetrxr3oadfat aivi;s) 2xoxmpnu1ole  nesl()sruru oot4opx  i3tls s2elnmp;t4 rxrif3iydoptrlieo;()s2tr(r3iudamtnlfctls)s2ur(rpou1alenifcilsla ea( onu0 reoxfcto1omtr nvo s0s2xrxm3nu4lp e fvi ( s2ta( ont0oee  i3iytls2uan p u4tlxnmrcio1lp elueols srxoxopou4op nmnvs t)aDrrur ou1olto f3iat mDranvsn(4trxrmr iydom elivo s  2xo(r3io1ape mfcsl(faDumxr ou0oltnmo3iytfm el( ont)alerxr oytlaDe uei;(0trurxm ou4apen fvta(f 2rm(roou4texo octatlm elnmp (4tetrxr3ia1fmD  uvo;t sexoir nu1oleelicsl()sDurxr ;o1oexnifciad sDelu p;t4texrmf tytlmDelivo;t teumxr3ou4altnmfet () 2tmu ont0optn octadfs2ra(vpnu4tltoxfciy1lp e nvo;( srtr(r oo1om emfetatfa2uaumpno4alx  i3iasla2eaumsnt0 eerxo3io1oateli i t) 2xr(o3oodope mivt s  rrau ooo4oet mieiyt a2umu ont4 exrxr3oy1opDrlnei;()truoirpnydop n feil( sruax o;u0teeomo3ildfa2emuvsnu0 leoxrcoa1fpDraieils) ruoio io1lm elnviltf rrm(mono0tltoioctasla2uau s;()teermo3iotfatrluvo;t s2umxmpoo1lmenmfetl(  2rm(m ;t1alxnmictasla rl(mp;t4tlenmf todom ran sls) rurir oydlmtnlnvia(  rra(  ;o0tpenio3iasla2em( s u4arenmfctodop eluesl(0t2tr(m iu4llee fci t aDraxr ou1tetn icild sDeluvp u4tleniocta1lptrau i;t trumxrpoo1olenlfetl( a2rr(mp;u1tee  feils mDumumon()aeeoif oatomtrluvs s)teumir3ny4op   ics t)srua( pnu1aexnioctat a rl( o;t4trtnmo3oatomt aiesls) ruriopoy1al e nei t sDrruroou0opxnifeilsfm2emnvp;t) eeoir iy1lp  auvo ()trtr(mpoodlptelnvsasfsrumurpnu1ale micildfm eln pn()tltrmf io1oaD auvs;t) rtoxo iu4al nlici (  Dtaump;u4oeeomf3tyt a elu on(4tetoxf iotopD anvs () 2umim3oo1omt mivtl() 2uaxr no1tlxn f3ils s2emumo;(0aexomr3iodoaDeli sl(0setm(r iu4lpe mncilsfsDur( pnu0oltn oeiyd sDuanvp;u0tltnxf todfp elivsls0s2xr(rpiu4alt mneta(faDum(  ou4olt  ietls sDulu pnu4aetnmf oo1fp elivi s srtr(o oodllt lieslsfa2taxmont4tetn feiltfmDrau s (0 rtrmrctatoaDr i sls) etmirpiudame lneta(  2rm( ooo0tpx  i3tysfaDulnmo t)arermfciadlaDeau s;t  2umxm ou4lptelictlt)s2tmx pnt1tlt ioeiydlmDuanvon() ltrmr ty1fmD  neslt) exr(rpio4altelfvia( artaumpno0altnmoctytfm ea(vs t4arenxr to1om rauvi t0 rxoim nu4op  mnviat a2ur(mo;t1aeto i3iytlm2rl(mp;u0 eenir to1op  ln i t) exo(opnu1ap n fvi sfs2taxmpoo4alenifciydlaDranms;u0tltnmfctotomt  ies;s0 rto(r3ou1amtnmnvi s) Durxrpno4alxo i3ild a rlnvs;(0 exnxo3oydfpt  ueo;s0 2toim nu4lm   ivtas sDra(rooo4olxomo3iat sDrmnms;u0trxnio oydoateanes;() etoiopnodome lieslt artaxr ;t4texomieildfm eln snt)aexoio tadfm e neols texoir iydomee fctltf rra(root0opx  o3iad mDel(ms (4tetnxr iatfaD  uvols0teumir io4llte feiltf rum(ront4opx  feiadfm2ean p u4tetnif3ta1omtrlivi;(0t2xr(m3ou4lme lfct sfs2tmurono4aptnif3iyd mDemn s;u4tlenxf to1fateliei s  rxoxrpnudape lfvta(fsDrmu  ou1aetomo3iysfm2rauvpnt) rxniocoydomDr ieo;( t2tr(opiu4ope lfvs t)aDua(rp;u0tlen octydfs elumo;(4 ltrxo3iotfm elieo ()srxo(o3oo1altn iesas aDtax p;t4apx  i3ildfa2rlnvp t) lerxf3todfaDe ivols)sruoiopoo1llee fcsatf 2urx pot0altoifeiys a eluvs u0 reoio io1om  ln ols)s2xr(r no4ol nlnvia()srur(rpoo1apenifetyd m2ea(msnt0areriociodfmtrlnvo (  exmxo no1amenmncs t sDrmur ;o1tetnioetad s2rl(mp;t0trtrxfcoodfat  n s t) etrio3iy1omtn netat arrru pou4aeenio3iatlm el(vo;u0alxrmr ootoaDrli i ()s2trxm3ou4llee fvtl()a2umx p;u1aet ifctls s rl( ont)aetrmo tadomDrlivsls0t2umir oydlptemneiasf 2rmxr ot4ale ioetltlsDem(vont)alxnmo iadfm eai s s texoirpoo4al nmiet s)sDrmur ot1olenmo3ilsla ul(vsn(4tltnxr3to1opt aies;s0 exmirpoo4olen nvils aDuru oou1aptnioctytls2ulnmp;t)trtoxf3todfa r uvs;s)texoio3ny4ame lnetasfsDtrxroou4oetomiciatfm eau o;u0 eenir tytoatrlu i;(0 ruoxm ny4alenmicias)sDumxm no4oet mieiadfm eauvp (0 ltrmociadfm e ieo;() rxoxo3nudlmeelfeiltfartau poo0oee  o3tadfa2eanvonu0trtoiocoydfpt aues t0 rtmiopiu4lp   ncias s2taxr ou0aetoifetad a2uln p (4tlxoio oytlpDeaneol() etr(r3iy4op emfvtls a2urx pou1altniiciad m2rm(mont)altrxf3ty1op   uesl(  rxrir ou4lmtnmivia(fsDtaumonu1opx moeild s uanmo;(4 rxrxo ta1lp  ai i s0tetoir3oo4lp emivs sfsDrmu pno1ape ifeiatlmDrmuvp;(0 rtrif3io1fmD aivi;s srumxrpiodlltn neias)srua( poo4tpto fciadla emumo;t)arerxf3ootlmD an o;t  rtmimpio1lmtelnviatf Dra(ronu4opt moetydfa2emu p u0 eeomrciy1laD an olt)teum(o3ny1openmnet (faDuax pnt4apeoifeilt s2ulnvp ()trtomrcoa1la eli il()texmio iy4llenlfvs ( s2tmu  ot1oetnmo3tysfa2rl( o (0alxomociotfptelivi s  rtmxrpio1alt lnesas artm(rpot0ole ii3tadfs2emn pn(4 reomrciydoaD  ivs;t0srumio nodlm  mneils  2tm( onu1tleoiietydfm rmn pnu)aetoxf ootfpDrlivo;(  2to(o3iydopenmfciat)srua(m ot4oetn i3iadfs2ulnvp (0teeoio iatfp e nvo (0s2xmimpiodam elics s sDraurpou1apt  octyslm ul(vsnu0 rtrif3iydlp r uvs;t)setmxmpoydoptelivtls)aDtr(rooo4tlenifciysls um( s u0arxrxrciydomDrli o (0s2triopnodomen ncsat) rta( p;t1altoifciadls2elump;t4 rermr3iatomDelnvo t)t2to(r3nydamt livilt)sDua(r ou4aleniieildfs2emn pnt0 etrxo3todomt an i;t0 ruriopnu4amtnlfvtas)artr(rp;o4aex ioeild sDemn pnu4tlxnxocoo1fpDeaueo;(  2xoxm iudal nlnvtlt)arurx  oo4apeoifeiaslm2emuvpnt0 ltnio3oadlmtr neo ( srxr(r3ny4al nlnesa()sDtm(  ;u0aleniietadlm2rm(von(4trtomfcty1oaDran s;t  2toio nu1omeelncslt) Dtau oou1tpxomfeiltla ran p (4tlxnmr3ia1fp raueslt s2xmxm3no1olee nei tfsDua(  ot0tpxniieiatfm2rlu snt4 renxf3oy1fa raies t0trtoxo ou1opte fvil( srtaumpoo0apenmicildfm2um( pn()arxomociotoa  livo;s srur(r3oo1omenmfvsas)a2ta(r oo1alenmietat a ulnmsnt0arermr3to1oaD aivsls)trur(m3oy4llenmfvtas a2umxmono0aex miciltls2umn p;(0texrmf3tytfm raies;() eumxo oydale  fviasf rua(mo;o4alt  ieiad sDrmnmsn() exomf3oatfpDrln sl(0trurxmpny1lptnmfetl()aruauront1opeomo3iytfa ea(mp;(4tlxnxocoadfm  aiei;t)srxm(m3iy4lp emncias) Duau pot1oex mieiltlm2ul(vpnu4treoxo oa1laDeanvs s sruoxr3iu1lpe lneia()sDraumo;o0tptnmi3iyt a rl( s;u)tltrir oo1lpteaieol() exmirpoydop n nvtls s2trur ot4oexoiieiltlmDrlums;u)texoif iotfa eaivsls s2xm(o3iudolt mnet (f Dtr( pot1optomfciat s elu o;t4alxomociotlmtrauvi;() rtmir io4alt  ncta()arta( p;u4oet mf3iatfa em(vs;u) rermrcoadlatran slt)s2tr(m3ny1lltnmnvt ( s2truro;o1teenifeild mDem(vont)artomr iydfpD lnvilt0srxmirpno1openlivias aruru  nt1tlt mfciyd sDumums;u)aetrirctadfptelu s t0t2to(opoydlm  lfcta(  rrm(rpou0aeto i3tysls emumsn(0aexoiociatlp e ivsls0 rxrio oudlpee ieta(fsDtrx pou0opeo ociyt aDem(mpnu4altnxr oa1lmtr uvs;t0 eto(r3ny4lp nlfeilsfa2trur ;u1aptoiocilsfs2rmnvs u4trtrxocoy1fptr iesls  rtrirpiudolt  icslsfsrrmurpoo4tpen fctyd sDemu ont) etnxr oo1fa eaies t0s2ur(m3ou1lltnmfvsatf 2umxro;o1ope  fcilt sDum(mp t4 rxnio ootlpD aneo s0sexoimpnu4lm nmict t arrmurp;o1aleo ieiasfa2umuvp;u4 ltnmfctodomtrln i (0 2ur(opnodap emieslt  Draxrono1tpen o3iysfs umn p;u)areoxo iatlaDe i sls tetmxr3iodaltelietl() 2urur ;t4aeen feiasfa2ean pnu4 exomoctatoaDrluvo;t) 2tmxr3iodaltn ivs s)artrum ou0oex  ieiad a2emuvp (0 reomrcoydfa eluvi;s0 2um(m3iu1apee fcsatf Dtr(m ou0oeenmoeiadls2emnmpn(0alxoxf3iydfmD lies;t0s2xm(opno1amtemnesatfs2raxm nt1oetnmf3tyd s2emumo u0tltrmf3iytfaD  ues;t  etoxrpiy4olte nciltfartrxmp;o0teen ociyt aDrluvo (4tetrmr oytfmtr ivi t)teuoxm nydll  micils)arraur nu1tet ioeiytfm uau o t0 etrmociytlaDr nei t0 eur(r iodam  mnci ()srraxr no0opt  fciltls2el( o (0 lenirciy1oaD aieo;() rum(mpno1lp  lfei tf 2trxrono0teeoioeiatlsDum( s ()tlerxo3oytfpDrlnei s) 2umxmpny1oleemfeta( artr(r oo0alxomfcilsfmDrmnmo;t) etrxf3to1opD lues;( srurxmpnu4lpee ivsl( srta(rpou1oee moeiatfaDrau p ()aexnmrciydfp eaueo t)t2tmirpou1lp  lici (  2taurpno4aexo oeiyslaDelu pnt) lenxrciadoa eli slt)s2to(mpnudamtemieias)srumxmoot0texn ocildfs ulumsn(4alxrxr3todfp e n i s trxoxr3io1llt lfeta( a2raxm oo0tet ifeilsls ran s t4trtnif ootlmt aivs;(0 exo(rpiy4lp nmiciat  rrr(rpot1aeenmo3ild a2umnvon(0aleoxo3oatfptr n ols0srur(opoy1oltemieia()s2rm( ooo0aetoifetytlaDulnms;u) exrmf3iodfa r nvi t0 2xoimpou4llee fet () 2taum no1aeeoio3iys s rmuvs t0aexnir3iytlp elnei;() rxmio ou4ole  fcsatfa2uaump;t4tpt iieils s2rlump;(0altnxo tatfm rau s;t)s2to(o iu4opeelfeta( a2rmum no0tpxnmfeild s uln o ()tlxnxo3iytfm rlieo;t) ruo(opoy1lm elneilt a2umur ;o1olx ifcils s eln o u)alxnmf3to1oaD  nvi;()s2xoim3no4ol   netasfs2tmxmoou4tpt mo3tyd aDum(mo t4 rerxf ty1lm  au i (0texmxm3iydaltn netls  Drr(rpot4alx moeiydlsDuan pnt0 lermrctotomt lnvolt0s2to(rpoy4lmeelics s) rrrxr nu4apx ifcilsfa ulu o ()arxrirctadopt  u sl()t2uoim nydapt  ieta(f Dtau p;t0tpxoif3iad mDelnvp;()tetrxocoytfmtean il()tetm(r3nudlleemiet (  rrrur ;u4oee miciysfs2ul( onu)aeenmf3ta1lat  u i;t0 rxoio3io4al nlfcta()artmurono4apeoifctls mDemuvon()artnmocootlateanvilt) etoxr3iudolt  fciat)arrmx pno1tee iieiysfmDrauvpn() eermo iatfm   n i;s s2trxr3no1opeelfesasfaDtrx  nu4altnmo3ild sDrln pnu0altrmo ta1la rlivils)teuriopoodopte ncta( a2rax  oo4tleo o3iydls2eanvpnu4arxrmf3tadfpDeau s s sruoxrpoodam elivt s)arrm(m no0oltnio3iydfs rmu p;u0trerio oytopDe ieo;t0 eto(m3oo1al  mnes sf Dur(mp;o1tlx io3iysfs2uauvo;()altnxocto1fmDrau i;t s2uoxm3iu1al e nctlt)srtax pno4tptn fciadlmDua(vsnt0trtrmf3tadlp rlies () rxoiopnodoltn nvi s) 2rr( oou4oltnmietlt m emnmo;(0areoio iytlpt ai o t0srxm(opnydopte ictl(fsrtrx pou1tpx  iciadlm ra(vpnt0 exrmo iytfptrai il(0s2tmxo no4lle lfetat)s2ur( o;o4oexomictysla ean p;t0tlerirciytoa rauvo () 2xm(r no4om elfctls  rrax p;o0oltnif3iltfa2rlnmsnu)arxriocto1lp r ieol()setrxr iodlp nmfcslsfsrurumpot4aleoiieilsls2ran s;u0treoif oydfa  lneils0texmimpiu4omtnmnvtltfsDrm(r ;u4teeniocias m2uln o t0tleoiocoydomD auvol( t2uoxo oydlp emnctltfaDumurp;o4optnmictyt mDeauvp u)tltoxf3iatlp  luvsls0 euoir3no1llen neias)aruru oou0opt iieiadla emnvs (4arerir3iydfpD  ivils)teto(mpoydlpee fvi s  rumxroou4aeeo ieias m ulu s u0tetnxfcoadfatr n olt)teumir ny1al n nct ( sDrrurpnu1aptnif3ias m2uau o;t0 rtoxo iadfat  n il( s2tr(r oy1opte nci t  ruaur ;o1tpxomoetysfs2ea(vs u0tlxrmo totomtr u s;()setrxmpno1ameelneils srrmuro;u1alt io3iyt a2ulnvp (0aetrmrcio1lm r nvo;s0tetmxr iy1omenmies t sDtm(rp;u0aleoioetyt a ulnmpnt0 lenio iy1oa eluvils trxoxm iu4lltn fvslt) Drmum nu4olx ii3tadls rmnmp (0aleoxf tadfat  ivi;t) 2trim3iy1lp emiet t)sDtr(roou0alt mi3ild mDra(mpnt4 lxnmo iotfa  au ols  rtr(o iodape miet t) 2tax p;t0olto ieiadfaDelnvp u0tleoif3oatop   ueo t setm(m3nu4lpeemfesa(f Dtaxmoou4alxoiieiaslsDelumo u0arxnxr3iytfa r nes s  2urxrpno1lmee ivtls s2ta(m no1opto iciytfs2um(mpnu4alxrir ootlm eauvi;s  2um(opoo1omtn iesl(f 2rrxroou0tltnii3iysfmDuln sn(4alxnmr3todlmDeai o;t) 2xo(mpoodopenlfciatfa2tauro;t4texoii3tysfa2ra(vo u0arenxr3oodfpD auvil()srum(opoudll   nciat  Dumxr oo0tpxniictldls emn pnu0artnxr oy1lpDelneo;s0s2uoxr3oodam  mfet t a2rax oou0alt ii3iadfa2ul( on()texrxr oodfpD  i o s)s2tmxo ny1ol  lfeils)a2rmxro;o1aee ioeiatfm ul(ms;u4artnmr oa1latrlieo () etmxr3oo4ameelnvs ( s2ra( p;t0apt  feildla2eauvo;(0tlxrxr ty1lm  lu ils)s2umxr iydopt mncias)aDtrxro;u1tlt  icils aDemuvp;t0alenxociatlate nes s0sexr(rpiu4aptnlfci (faDrmx ooo0tpeomfctldlsDra(mp;(4 lxomo oo1fptraieolt  2umxm iudom nmfes sf rraumo;o4oex ioetad aDea(mp u) leoxoctotlpDranes;s0 exmxo no1al  mivs t)artmxr nt0apt ii3iadla eln o;(0tlerxfctotoateanvols)s2xo(r nu1oltnlietlt) 2rrumoou1tetn fciasfmDua(ms u4 exrmo ia1lptrau o;s0seur(r oo4ame mieilt) Drmu  ;t0optnioctltfs uaumonu4texoxr iotfmD  n o s)t2urio3ny4ape  fct tfsDrmx o;o0tpx mfeias s ul( o t4 eenmfcio1omt  nes;t)trxr(o iydomt mnvi t arrm(  ot4teenif3iyslm2eanvp t0alerio3ta1om   ivils) rumiopno1ap   fvi s  ruax p;o0ope  ictydfm ranvpnt)trtoxocoadomteaues;s0t2xmim iy1ll   fct s)sDrau ont4alen ietldfm2ranvo;t0texrmrciydla   u ilt0 2xo(r iu1alen ivs ( s2umx ont1aeenmf3iysfm2eln ont4tlxrxocootla eauvs (  eum(opnydameelnesls sDra(monu0olxomf3iadfaDem( o u4tlxnio3ootom r neo ()teum(r no1ale lfctas)sDumxrooo1oet mf3tatfa emnvp t)alxoifciytfm eaueslt0 etrir iodlpee nei (  Drr(moot1opxoifeiltla2uluvpnt) lxomo3to1oa elues;t s2trio3io1optn fcs t  rtrxro;o1tleoioeiatlaDraumpnt0treoxr iydlatr u o t0seumxrpiydlmtnlfes (fa2tm(  ;t0tlen f3iasfm2rl( o;t4tleomr iadopteai i (  2uoxrpno1lm e nvtltfarum(r oo1tleoifetat mDemuvonu4teerxo ta1fptranvi ( s2xm(mpnydamte ictls s2tm(mont1tptoif3tld s um(vont0texnmr tytlmDrluei s) 2to(mpio4altemivsa( aDuru ooo0tpe ioeiyt s2um( s;u0aetrifcoydoa rlieil()srxrxopny4ap emfvtat) 2ur(root4optomieiltfs2emu p (4arermfctatfmtraivo t0srxmir io1ll   fctlt) 2trur oo4tee  f3iadfm2raump u4trxoxo iytom eau ol( texm(m3ou4lpee neta( s2ua(r ou4olxnmfetltla2raump u0aeeoio3tatlm ean i;t)srum(r3oo1amtnmnviat  rrmum ot4alxnmi3taslmDemnms t0tlenio oytlaD aiei s0sexrxo3ny1ome  ictlt sDtaumoou1oex mo3iad s2emuvo t)trtnxf ty1lmtr ivi (0 rtrxm ou1aptemncs t  2uaumpoo4teeoioetad sDea(ms;t0 exoif3iodopDr ueo () ruo(r3nydlmt lnvtas a2uau o;t0olxn i3ild s ea( o t4 ltrmf tatlpDr neo;t)s2xrxo no4aptnlnvs () 2tmx  ;o1olt mocild sDua(ms;u)aeenmr3iadfmt ai i;t sruo(r3oudapt licils)aruaxmo;o4ole mfcildfa2rl(mpn(0 ltrif tatfmDrlu ils0trtmxm ou4ll  livtas sDtm(monu1tex mieiad m2uau pn(4tlxomfcoa1omD lnvo;(0teurio3iudlmen fvi ( a2rmumo;u4aex miciyt s rauvs u0alxnxr tatlate ieo;t setoxmpoo4amee nei ( aDuauront4opxnmfciadlm2rau sn(4tetrxr3tydoptran ilt)sexmxrpnodlmtn fvilt) 2trxrooo0oeeomfeiatla2um(vp t) rtrmr totfmDeanvo;t)teurxrpoo4llt  ivsl( s2umxmpno0tpeniictas sDeauvo;(0trtnir oodfatrlueo t)t2xmio3nodoltelnes s)arra(rono4aeeoif3iadlm rl(mp;(0tltomo3ia1faDeauei ()trumio3nydolenlnvsasfsDrmxr nt4aee ii3iys aDuanms;u) lxrmr oo1fpte uei s  eurim3oydomt mietlsfartau pno1opxniociatfmDemump;(0 lxoxf3iadfat luvi t)srxrxmpoydapenmnesat)a2rmu ono0opt ii3iasfmDel( p ()aexrxrcootfptr u o;t srtmxm nu4lptn fesls sDum(m nu0apxoiiciadlm ra(mp u4 etnxo3ty1fp  lueo;() rto(mpnu1ome  fcsat)aruax oot0ale mocias sDumu pnt0aetnir tadom e uvo s  etrimpou1lmtemnvsltfaDurxm ;t4oexn i3iat s2rmn snt)artomo io1fm elu s s) eur(rpiy4amt  iet s s2um(m ;t1aleoiicilsfs ea(mo u)aexrxo iy1lp elieo;()t2tmio oy1aleelfctatfsDrm( o;u1tlto fetatlm2rl(vpn(0trxriocto1lptr nvs s s2tmimpiy1olt  ieiasfa2trx oou4tpx ii3iasfa uanvo (4tlerxr3ia1oa rai o;() rxmxm3oo4ap elnviatfs2ua(mpoo4opx  fctydfm ulump u4tltnmociydop   n ol(0 euoir3oy1am nmiet (fs2ua( p;t4aexo i3iatla2rln s;u4trxoxfctatoat  uvo;(0t2trxm oudlpt mncs ()s2ta( o;u0tlt mi3tldlm2uanvs t4aexomo tatfmDraivslt0srtrxo oudamtnmiet tfsDtmxm ou1olt  fctydfsDelnmp;u) etoirciotfatrlu i;(0srum(o oo1omeelies t  Dtmurpot1ole mictadlm uanms;(4 rtrmf3iodfmtelneils0t2urxo oodlpee icsa(f 2trx poo4aexo f3tldfa2emu pn() ltomr oydoa rluvi t) 2xrxm ny4ol n ivt (  2tmu ont0aexo oetydla2ea( sn(0 etoxrcoa1fptr n i;( trxrxo iu1lm elfeilt arraxr ;t0oltn ictld m2ra(mp;(4aexrir3iy1opD liei s srur(r iy4alt mfvs () Dtrx ooo1tetn ictas s2rlnvs u4tetrif iytoa  ai slt) 2xoxrpnudlp nmfcils  Drmxrp;t4apx  i3iltfs2elums;(4 ltoif io1fp r uvo s setr(r3oo4altelnetas) rtr( poo4texo oeiatfmDea( pnu4artomr3iydopDeanvo ( setr(o oy4ap e nctat  2rmxmoou0alxnmfeildls ean snu4trxnir oa1fa rai i;s)texo(m nu4lle mfvils)s2ua(  ot0oltn ieiadfmDumnvo u0aetrmociatom  au i ()teum(opno4llt livi tfsDur(r ;o1apxo oeias s2ua(mp;t0tleoir3oytlmtr nvi t0t2ur(rpiydlmeelfvta(fs2tm(  oo4oeenmf3ilsfs emnvs t0arxnmo3to1opDrluvols sexoir io1omte fvsat) rtaxmpnt1teeo fciat s rmnmp;t) etnmo tydlptrlies () rurxm3iu4ole  ivtltfartrxrono0apx iiciadfmDel( p (4 rermr iytfaDelneolt trxoxm3nodll  lnvt sf 2raxmpot4opx mfctadla2rluvs u)tlerxf3ootfpD au i;t)trxoxmpnydoptn nes s)arra(  nu4tpxoii3iasfa uan o u4tlxnif3iodoaD aivi;s) rur(r iu1ame lfet (fsDraxm nu4ale ioeiadfaDea(mo t)tetoircto1fat lues;t)t2trim3nudlm elncsatfsDua(rpnt1tpenii3tls sDrlnmont0tetnifcoy1oa   uvs;t0truoxopnu4omt  ivils arua( p;t0aexo oetls a elnvpnu4texomfcootla rln ilt0 euo(r iu1ome  fcs t srur(m ot0oee iietyslaDrlu pn()tleoio3iadomD  uvsl()s2tmxo3oodlle  icilsf 2rax poo0alxn ietasfa rmnmp;u0 rxrxo3ty1lmte ueils0 euoxr nu4oltnlnctltfarrm(rp;o4teto fciydfa2rlnvs t0tetrif3iydfat  i i;s)teuoxo io1ll nmiciasfa2rrxmpou4texn octldls rlnms t4tlxoio tytlmteanvo;s trxo(r nudomee nesl(fs2rrur ou4apt  i3tatls ul( p;(0trtrmr3oa1fm rlnei;t0t2um(mpio1lm n nvta( arum(mo;u4tpt ioetltfm rl( o t4 lenir iy1omtrln s t  2uo(r oy1lmeemfvil()a2ta(r nu4tpxomoeiatfsDumumpn(4 etoir oadlm  ai s;(0 etmim ny1ap nlieiltfsDur(rpoo1tltnmiciydlm el(mpn(0 renmr to1fmt auvi t) rumxopiy4aleelfeslsf rrauroou4altniietad aDem(mpnu) eenir iy1opt luvo s  2trxm ou1am  livtlt sDrr(r no0aeeo oeildlsDel(vs u4aeerio tydoa elneo s0srurxm3iudape  ivs t) rua(r ;t1tptnmicildls ea(vpnt4 eenir3ia1oaDrai s;s s2trir3io1ope lfvt (  2rrumo;u4olxnio3iatlm2ul(mon()alenxr3tytlpDr uvo s texm(r iy1lltelictl( srua(ro;u0tlt iiciyd aDuauvsnu4artnxfcoy1oa r nvsls) 2urxm iu1lp   fvia()artr(rp;t1apx  fciysfs2emuvonu)teenxr3todlptrluvols trxoim3ou1lmtnmncia()arua(m ot1opxoii3ils mDelnvsnu0artoif3oadlaD  nes ()s2trio oudom n fci ( sDrmurp;u1apxomoeiytfs elnmsnt0 ltrxf3to1optr neo;s0 exoxmpnu4op  lnesasfaDtm(mpnt1ale ifctys m uauvp;u)tlxnxr tydlp  li s s)srumir nu1lpt lneia(fsDur( oou0aexomoctatfs um( snu) ltoxo3oytlaDelnei;s0seurxr3no4alen feilt)aDumxrp;u0aptniociat a umu p t) lxnio to1lmtrai o;(0trxo(mpiu1lmee fetl()sDurx ono0aptn feiltls2ulnvsnt4 exoxo3io1fpt  i i (0 2xoxo3nydape  fet sf Drax  no1open octad s uanmo ()aetnio3iotlmDelnvo (0 eurio iydlpen ivtltfsDta(mo;t1opt  o3iadlsDum(ms;t4arenio3to1fm eaieil(0s2xoirpiydome lnes t srum( o;t4ope mietld m2emums t) ltnio ootomDe nvils t2urxo3iodaptemfesl()sDum(mooo1tee ii3ilsfaDra(vo;t4aeenmo oo1fm  lneil(0 2umirpiy1ap nmnetlt)a2rm(mo;o0tlt iiciyd m elnvpnt0altnxo3tytoa r u i;s0 2toxo nydlpe  ivsls)sDrrxmpno0oetnifeildla2rauvonu4alxomocto1oa rli ol(0t2umxr3iudam  mivil( aDrmu p;o1oleoiieiadlsDuluvp;t) eeoio oadfa eli s ( setrimpio1lp e icslt  rum(ront1apt mfeiytlsDuan pnt)aeenxocio1latrauvo t0s2umiopiu1lpee ict t sDumu  ;t0apx mfetydlm eauvp;(0artniocoo1oaDrluvs;() 2uo(o3io1lmenmnciltfaDrru  oo0tlxnmociatfm2ulu o (0tlxnxrcoatlm ran s (  rumxmpou4ap nmics sfaDumxm oo4aptni
\ No newline at end of file
@@ -0,0 +1 @@
+ivils) rxoio3iudam nmfcsas srtrur no1tltnmfciaslaDel( s u)aeenmociotlptrlues;(0srtmimpny4lleemiciasfaDtrumoot4apxn o3iasla eauvp;u)tetrircoo1fp  lu ols  2trio3iu4ome mfvs t)aDur(rpot0texn o3tadlm2rmuvp ()tlxrmo3tytfpt  ivilt  2xo(r3ou1lp nmiesas  rururo;t1tetnii3ildfa emumo;(4texnio iytom rlivslt trum(o3ou4ol n netltfaDtaxrp;u1alenii3tadfaDran snu4texrmf3iadlm  anvslt  2uo(rpnodap elies sf rrax pou4oet mfeiltla2ulu snu) renxo3io1fpD an i (  rxmxr3iy1ll nmnvsl(  2tmxrpno4aptnmf3tlt s2rm(mpnt)alxrxrciytlmt livolt)t2xrxopiu1om  mivil(f Dta(mono1tpx  icildfa2ea(ms;t4 etomoctodomteauvi (  rurio oo1ll elnes (f Dtrx oou1opxnmictlslmDelnvo;u4 lenmr3ty1lmte nvils  rumxopiudaltn nes s)srrrxr nt0teenmieiatls ul(vo t4 renio totfpD ln o s0srtmirpnu4lmt mict (fsrtr(mp;u0apxnmfetadlaDuauvonu0 eeoxo3iydfpt  ivs;(  exoio iodop nmfeias s2uaum ;u0altniietad a ran s (0tlenxr tytlpDe ues;t) 2um(o io4aptelnet sf Dtaxr oo0oltnmieiad s elumo;(0 reomf tatomtran s ()s2um(r3ny4alt lfvtl(f 2raxmo;o4oeen ociad a eluvsn(4texomr3tytopDrlu ilt)trtrimpiydomeemncta( srum( o;o1tlt  fctas sDrmnvpnu0trtrxr to1opte n o;t teto(m3iy4apte ivs s sDrmx  oo1ale mf3iadfaDrl(ms u) rxnmf3oadlaDeanvils0t2xrxo no4lmte fesl()a2umxmont1altnmoctytls2ean o u)trtomo3todfate nes;s0srum(r oy1apee fcilt) 2ra(r ou0tle  icias a em(vo;u) rxoxr iotfa rlnvils  2trxo3nudap n fvs t) Dumx pot1ope mfctat a eaump u0arxrmrciydfm eau i t  2uoir3oo1alee nvia(f 2umu onu4tpxo oeiaslsDul( on(4altoxo3oydlaD  uvsls0 euriopnodal elfesls sDra(moot4apt  o3tltlm eanvo;t4aeeomf io1la eau olt) euriopiodlmte ivta(  Duaum ;t4ale iiciad s2eauvo;()tlerio3tytlmDe ies s  rtmir3nu1ol n nes tfa2tr(  ;u0tex mocild mDuluvs;u) rtoif3to1oaDr nes t)t2um(opiu4optnlnct t)sDtaxrp;t0oeeomo3ildls2ran o;u4tlxnxrciodfm eli i;t srtr(o nodopt  ieiltfs2umu onu4tlt ii3iat sDem( pn(4 lerif todop   iei;s)t2xoxo no1om emnvtat)arumxmpnt4aptnmf3iadfs2elnvp t4alenxr totlm r nes;(  2xriopno1al n fcia(  2um(r no0teeomo3tas s2elnms () etnif3tadlaD auvs ()trxrxr3nudopt  ivsas a2taum ;t4apenii3iydfa ranvp;u4altrirciotla rln i;s0 2xm(m iu4lmtnmncsl()s2uax ooo4oltnmoeias m ul( snu)altrmo ta1oaDraueilt) ruo(rpiy4ame lfvs sfs2umxr ;o4altnmfciadla ean o;u) exoir oodoat  nei;t s2tr(o nu4ol nlivtls a2urx  nu0aetnmfctltfm2eln snu4 eermr ty1fpte u s s)s2uo(o iudap nmfei (f 2trumpnt1tetnmoeias sDeluvsnt) eerir oodfm ran ils)s2xm(r oy4ome lfvi s) rtm(rooo4oetnmi3iydfa em( on(4tltrio3oydlmDe ivo ()srxmir ou4om emfet (faDumxmono4tetnifciadlaDranmp;u4 exniociadlpte nes;t)s2urxm3oudol emnet sfaDua(mpoo4aeeoifctld m2rm(vp;t) eeomf oydoat anvo ()s2umio iodapt licsas artrx p;u4aetn icildfmDul(vpn() reomr iydlaDe neslt0srumirpoydaltelfvi t)aDtmu pou4tpxn o3tls s el(vs;t4altrmo oo1fpDraivi t t2uoio iu4ole  nci s  rrrx  ;t1tetn ocildfm2ul(vp t4aetnmr tadlmte ivils)trxo(opoydllt  nvsl( s2umxm oo0apt mfctldlmDumumo t0tltnif tytom r uei t  exm(opnu1lm  mnetlt s2trurpno0aet ifeilsfa2el(ms;u4tlenio ootlp rlu s s)texoim3iodlpen fcil(  rra( ooo0apx  i3ildlm uanvp t0tlenmf tadfp r u slt)srto(m3nudll emneslt)arua(moou4olxoif3ias m um(vp u4alerxr3tytfptrlieslt)teumir3ny1olenmfvi tfaDua(rpou1aexo ietasls uanmo t4tlxnxr3tatomtelneo s t2xoxo3iudllenmneilsfaDtru ont4optn i3ildlaDeluvont0tlxoxo3oytlatrauvs ( s2toxo iu4omt mnvtasf Dtr(r ou4ape mfeiys mDranmont0 eermrcoadoptrliesls0 rxoim nu4llte iei sfartmxronu0tle mfeiaslm um(vpnt)alerircoo1fm eanesl( srurim3no1al nlfesas s2umxmoou1tlxoiociydla2rln pn(0 lermf iotfpD luesl(0 rtrxo3iy4op nlfvs (faDtm(moot1opt  i3iadls ul( o;t)trtomrcty1fmDr ues ()s2uo(mpnodaleemfcslsfsDumxmo;o1oleomfciadls2el( s;u4 lxoxfciodom ran olt) rtrir3ou1am n nvs ()a2tr(m ;t4tet ioetltfm rlu pnu4 exnxfcoatfmt lieo s0sexoiopiu4llenlnetlsf Durxroot4alxoiietys s rmn o;u0arenmr oadlmDr ivi;s)t2uoirpou1optnlictlt aDumumonu0tee  fciltfs2ua( pn(0aeeoio3tytfptrlu ol(0s2um(o oodalt mietasf Drax  nu4apeomfeiadfs elnmsnu)tlxoxocoa1omt lieo;()t2trxr3oo1ope  nei t  2rmxro;t4aptnmoctadfa2rl( s (0aeerifciy1fptr ies s t2tmio3io4ame lfvtlt srumu  nu4tptnio3iys m rm(mpnu4artrmr tytfpteliei t) rurio oo4lp  lnvsasf 2ta(r ou4aexn fciydfsDean s;u)trxoir oodlptrau ols)s2urim io1lm   ivs s s2urxmo;o1alx  oetatfm2rlnvs ()tetnif3ia1laDrln slt  rto(r3oodape mncsas)s2rm( oou4tpto i3tltfsDeauvsnt)aexnioctadlpD  ies;s t2tmxm3iodll e fet (  Drau ooo4alx  fetatla2emumo t0teeoio3iadlp  ln s t sexmiopiudopeemictasf rum( o;u0altnmietltfsDuaumpnu4 rxoxrctadfa elues s)seur(m ou1amenmfcslt)s2rr(  ;u4alxniociad aDuanvp (0 lenmrcoy1fmt aueols teuoim oudap e iesl(faDtr(m nu1aex ifciatfa em(vp;t0 rxnmfciy1oa e neo (0teuoim3oo4lpte nctlsfs2ta(mpnu1texnio3iatlaDelu p;t0tltrmo3oydfm   ues;s srtrimpoo4opeelnvils)s2rax  nt0tlx ifeiadlm2emuvo;u0arermf tydlat  uesl( t2toxr no4lmt  ivilt  Dum(  oo4tpxnifeils a2em(mpnu4aeerxrcoadom  aneils0srxo(o nu4olte ncils sDrrxmonu4texoiictad sDem( o (0trtnxoctadlatraieo t)seum(r3oodaltnmfvtltfa2tmx poo4olt ii3tad sDumu pn(4aeeoxfctytlmtelueol()texm(o oudll elfcilt  rtrx ono0apt  ieiadls umumo u0 etniociy1faDeauvi;t)srxmxm3oudlm n nei t arum(m ;u1ape mieias m2um(vp ()trxnmfciodla  anvi t  etrir3io4lmee feil(faDtr(mo;t1tptnmfcildlaDumu o (0arxoxo oa1oat au ilt trtrim oy1altn ivil(faruaxmoot4tee ioctlt s ranvp u4 leoxr oatfat lnvi ( trxo(o ou1lpe mfvi t aDurumooo1tetnioeildfs eln pnt)arxnmrcia1oatr iei t s2trio3ou1lmtelncsas) 2rru o;o0apt iiciyd s rau pnu)trerio ta1fmteln i ( trxmxrpou1al elietlt) Drmxm oo1tlenmo3ild s ua(vs;u0aleoif3to1lm r uvolt  exrxopiy4omt  ietas  Dtm( p;u0aee ii3iltfa2uanmpnu)alermf to1lmD auesls0 exrxm iydaltn nvi t  Duax poo0tlto ociat s rlnvont0tlxnxociydfpt ai o;t) eto(r3iy4lmen fcil()srrmum oo0aex  iciad sDulu sn(0tlenir tytfmDr u ils s2toxo oodlmt lfcsl(f Drm(mp;u4oetniicild s2emuvo u0tleoxrciadom elivol(  2toxo3oy1lpt mnvia() rrrumpou1aetnmfeilsls2ea( p;t0 ltrxr3oa1la e ivs t  rxm(o3oy4lmt mnei t) rrmxrp;u4aeto i3iys s em(mp;u) reoxo3iatlmDelneilt texr(o3oodameelfetls a2raurpnt0olxnifctydfsDrln sn(0 leomo oatoptraivolt s2xrio3nudlme  ivtatfaDtrxrpoo4optomiciadlm umnmp t) exoif3iotopDr ueils) 2tmim iodlptnmneias) rrax oot1tetoifeilt s ean o u4trxrmfcoodlpDr n i s trurio3nodam nlfet s)s2ta(mpoo1aeeomiciyt s emnvs;u4altnio3iytom ran ol(0srxo(o3iydop e fei t  Drauro;u4tetnmictltla eaumsnu)alenmr3tatlp eauvo;t0 rxoxmpio4lpt lfvs s)a2ta( pnu4apxomf3tls m rluvp u0altomo iydfmDe ies;s sexm(r3iy1oltn nei s) Drmx o;o0tlenmfciaslmDrln s t0aetomf3oo1lp rluvs t0t2xoir3oodop  micslt) rrr(rpoo4optoif3tatla2elnmp t)arermfcoo1oaD lu i ( trtr(m3ou1omt  nvias) 2um(  ;u0tltnmo3tatfa eau o;u) renmfcoadfpD au o t  eurxo nudlm elnvs t) rtmx  ot1oeenmi3tlslm2elnmo () reomf iodlm  li s;s)s2ur(o3nudoptnmfvils  Duaxrpot4aptnifeiltfa eluvs t0arxoxf totfptelu s (0srtm(mpoy1lpee ictl(f rraxmo;u0opto i3iadla2emnmpn(4tetrif3oatfmDrli o;t truoxrpoy1lltn ncsa(fsruaum nt0ale  o3iyd s rauvp;u) reoxo3to1opDeauvsls0t2xo(r no4om   ivtat srrr(mpot0tetomf3iatfs ua( pnt)artnifcoodfp   uvs s s2tr(rpoo1ap nlnci (farraumpno0tpe if3iyslm2ulnmo t) exoxf tadop e ues;t0s2umir3nodop nlnctls s2ta(r ot4aex moeiltlsDean snu) etrxrctodop eaieo (0seumim no1op   neiat srrau pot4texo oeilslm2elumpnt4trxoifctatfa  anei t0t2xr(o no4lm nmivtat aDrmur ot0apx mieilsfm2el(mo;u0artomo3tadomDeanvo s sexmxr3oydolee fetas) rtrumpot1olt iicilt sDemu o;u)tltnxo3iytomDelivo t) exoimpiydom  mfciat)artmx o;u4oleo fcils aDrmnmp;()tlxoirctatfaDe uvs s0t2to(mpiy4lpeemies s  Dra( oot4olt mieiys m em( p u0 renmfctotlmDrlnvi;t)t2xrim no1apen ics s sDurxmo;u4alx ioeiys s elump t0 etoxr3totfp eln i;(0 2toio ou1lme mfct ()srtm(rpot1olxomf3tadfm ua( onu4alxnif totlat  n s;s s2umiopiu1om nlfcsl( s2rau pnt0oex  o3iadla2ean p u0tlenxo io1lm r uvo;(  exrio no1oltnmfvt sfaDtm(  nu4tlx  f3tlt s ean p u4treoxo3ta1fat lu o s0srxo(r ny4alt micias  Durx o;t0tpeoiociytla2raumpnt0texniociatoaDraiei;(0 exo(o iu1am e ietasfsDra(rpno4alx  octlsfs elumont4alxnxfcootoatrauvo;(0 rtr(o3oydlm e ncia()s2uax pou0alt  fetasla elnvpnt4 leoio tydopt  ueo;t0srxo(o nodopt mneilt)a2tmxmpoo1tpxn fciadlaDuln p;t0 lenifciy1optrlivo;s  2xmiopiu4am emivsl(  rta( poo4tpx mfctltfm2ul( p;t)trtrmo oytlaDeauvs;t0srxrxm oy1ll  mncs tf 2trumpoo0alxoifcils s2rmuvs u)texomo ta1fa rau s (0 2uo(m3oy1lptnlnetlt srtm(  ot1tetn oetat m2ulump;t0 ltnxo3iydlptr u i;(0s2tr(r3io1olte ncs s) Drru oou4opxn oeiad a rmu on(4alxomfctodfpDeaieo;s)s2toxr3oydam elfcs ( arua( ooo0tpxnioetld m raumpnt0 rermf3todfaD aivi s)srxoio ny4lm  lncta(fsrrrxmoot0aptn ietyt a emu s;(4 rxoifctadfm rlu s;()texmio3nu1op elfcsa( aDuau p;u0apx  f3iytla2el(mo;t)arxoio3io1fpDraieilt0texr(r3oo1lp nlnvi (  2um(mpot0aee mf3iadlaDra(mp t4tlermrciy1fate n s s setoxo oudlmtnlfvsasf rra(m no4alen ocildlm rauvo u4 rtoif iodfpD  n o;( setrxmpno4lm  lncil( aDrmxmont1olxomfeiytfs2eanmo t4texomocootlat lu ol(0truoxm3nu1lptemfcsatfarrau o;u4ole ifciaslsDem( pnt)aeenxociotfmD ln slt  2uoio3nodap  mncta(  2ua( poo1oex mfetad a2ulums t0artoxr oo1fmD aneils  2xriopou1lpe lnvt ()aDrmurpnt0tpto icilsfm umnvont4arxrmf oa1lpDeanvo;s0 rxoir3oo4oleemnetlt)aDtaurpnu0tleo f3iatla2uluvsn() eenir3oydfmte uvo;(0trtoirpou4omtnlfetas  Dtaxrooo1opeoifciys m ea( p ()trtoif3oytfm eau s t0 exrim3oo1opeelfvtas  Dtaurp;t1oltnii3iad aDumnvp u4 lxnir3iadlpt livo;t) 2uoxo3no1omenlieta(  Dua( ono0oeto i3tasls ua(vpnu0 etnxrcoo1lmte n o;(0 exo(r iy4lp elicsas s2trxmonu4aex mf3tasfm2ua(mp (0trerir3iodomDrlnvs (0 etrxm no4oltn nci tfaDrrxm nu0aexnifcildlsDumu o u4teeoifcoydlaD  i ilt)trto(o nu1amt mnci t)srua(mont0aptn o3iltlmDrlump t)tlxrmrciatlp raivo (0 2trxm iy4altelnvtls  rumx ont1tee  o3tytfaDrl(msnt) eeoio oadfa raueil(0trtmim3nudameemivi ( sDrmu o;u4apto f3iltls um(vpnt4aeenioctodfate u i s t2xmirpoodam e nvsl(  Durx ooo4oeen oetldls2eaump;u0 lxrir iytfa  aies;()srxrxrpiodolee fvta(faDurxrooo1ale iietydfm emu s;(0altrmfcto1optrau sls)truo(m3oydop emfvsl(  Dtrur ot1alen i3ilt aDranmo;t0 ltnif io1lpD aivs;(0s2xoio3oy4omee fvtat)aDum(rpot4tpeoifetaslsDeanvo (4texnxf oo1fat lnvo;t0 rxmxmpnu4op e fciat sDuau p;t4alen ocild m2emnvs u0 rtomrctodfmDraies ( texoir no1om nlfctasfsruau p;o4apxomieildlm2uaumonu4 etoxo3oo1fpD  uvs ( texmxo oy4lme mfcsltf Dtrumoot4altoioeilsfm2rlu snu4 rxrir to1fpD aivi (  eum(o3nudomenlfvsa(fsDua(mo;t0tpt  f3ilsfs ra(msnu)tlermrcoadlaDelu o;s)sexoxo ny1altelics ()a2taxm ;o1ape mociysla rmn on(4aeenxrcio1lpD  i i (  etmxr iy4lm elfcsa(f rurxm ;t0oee ifcias aDeanvs;(4teeoif3ia1lptranvo;t t2to(rpou4altnmnvslt aDtmxrpno1oeenio3iydlm2ea( o;t4aleomf3ootoa  ln s (0 ruo(r oudlmt  ict sfaDua(rpno4oleoioctasfa2ul(vp;(0 eeomf ta1lptelies (0teuoxr3oy4ol n netlsfa2tru ont1olx mocildfmDelnvonu)tltnxo tytlpD au ilt0t2uo(r iodlptemfviat  2rr( o;o0tpx  ictatfa ua( ont) exnmf3ia1fmt  n s t) rxo(r oo4lp e icils aDraxrp;t4olx if3tat mDrauvonu4treriocoatomDe neo;()trumim io4opte nvtasfaDtmump;o4tlt ioetadfsDelu pn(0arerifcoy1op e u olt  exo(opio4olt lfvsls)s2taxr no1tee iictadfa2uanmp t4teermo3oytfp elu sls s2to(o3iu4opte fet sf Durx  nu0tetomfeiadfm rmu p;t4 rerxr3oatfm  lies;t) eurxm iu1amt mfvsls)s2rm(r ;u0oetn ieiasfmDuanmpn(4arxrxo oytfptelu o;()trxr(mpnydomtnmicilt  2urx pot1tet mf3tasfaDem( pnt0tlxnif3tatlaDeai o s trtmim3nudamtnmfei s)aDtrx onu4tex moeiasla2elumo ()arerifcty1op   i s;s)truoimpny1lm e ivtlt) rtm(rpno4aee  feiatlaDuaump;t0altoio ootopDrlivo;s  rxoxrpoy4op e nvsas a2rmumont1olxoif3iyt mDrlu p;t4tetoxo iatfp   n o;()sexmxopnu1alt mfet sf 2taum ;t4tltnii3tatlm2emu pnt4 ltrxfcto1oa eluvo t0 rtoxr oudale  nvt sf Drauro;u1tpxnifeiytfs emuvs;u) etrxfciodlp  lu s;()srur(opou4oleemnvtasfarurum ;o0ole  iciadla eauvo;t4 exrif3iadfp r uei t0trtmim io1al emnetlsfs2rm(mp;u1apxoii3iatla2rlnvpnu0trtoir iytlmDraieo;t0 etm(o3oy4ole mneta(f 2trumpnt0aptnmfetatfaDrau onu0trtnioctatfaDe u s (  exmio oo4ap n ncsasf Drrxrp;u0alxn ociasfaDuluvp u) rxrmfcootomD aieilt0trtr(r3ny1olte net ()aDuaxmoou1alt if3tad s2em(vpn(0artoxf oo1optraneo t t2uoiopiodomt lnes s) rrru  nu1teenmi3ildla um(vs t0aeerio3tatomte ueilt0t2uo(r iydaptemfetl() rrr(ronu0alxnmi3iatfa emuvs;u0 lxomrcoy1lm   i il()setmim3oy1lptnlnet (f ruru  oo4tle mo3tltfsDul(ms (4aexrmo io1laD anvi ( s2xo(opnudalenmneias)arurx  nt0oltomicilt sDean p;(4tltniociadfat  i ols t2toxr3oy1opte ncil()sDumu  ;o0aexn f3tytls umnmont0 ltoxo3tydlpD anvi;(0 rtmxm3io1apt lfvsls a2rr( pou0aptn feiytlm umnmo;(0 ltnircoo1fmD luvo () rxr(rpny4am nmfei t srumxr no1tpeomo3tyt aDua(mpn(0 eenir3iatlaDeanvilt) rxo(m3oydllenlfetas sDuax onu1tetnmfeiys aDrln o (0tetnmf3oytfat  i s;s  2trxo no1alee fet (  rraumo;o4olt mfctyt mDemnms ()trxoif ta1fateli sl( srurio3iy1aptnlfetlt)aDum(r ou0tetnifctasfmDeanvs (4teeoio3io1fp  lu o s  2uoxrpiodalt  nvsat) rraxmp;u4tpeoiiciys s2ran o;t0trxoif oo1fm  lnvi;s  etoir3oydlmt lnvsas) 2tr(m ;u1oet  fetys a2ranvs t)artrmo3tydfpD lu slt t2tm(o iodapenmiviat) 2tm(m ;o1aeenmoetlt a2elu p u0 ltrmrcoodoat lnvs;()seum(o3iu1lp emivtas) Drax pou1tpx  fciysfm el(vsnu4arxrxocoo1fatr neols seuoxopoy1ol elictl(f rumu pnt0aleoifcias m2rmuvs t) rxrxrciadop  aieil(0sexrim3nodlpeemnvtasfsruau  nt0apxnmo3tadlaDul( o t0areoirciadoaD livs;s)trto(r3iodopenlfeiasf Dtau onu4open f3tltfmDeanvpnt0altoxr3oo1fat  nei;()teumxmpnydomeemivias)s2rrxroot0ape ifetatlmDemuvp (0altnif3tytfaD aieo;(0 2xrxr3iy1lpt mfciatf Dum(m ;o0aetnmf3tys aDelnmpn(4arxrmf to1oatr u il( s2umir iy1opee iet s)aDtax pot4opxnmi3ildls rmnmo;u) exnifciodopD au i (  2um(o3ou4ol nlfvs s srtrur ;u4oexoii3ias s2ulnvo;t4trtoif3iatomDrauvs;s) 2xr(r3iy1lpe  ies sfaDum(rpnu0teenmfciasfs uanmp;t4tltrxr tytom rli ols0 rumxm3nu4al  lnvtlsf rtau p;t4ole  iciltla ranmo (4arenifciodfpt  nvils0 rtr(r3iu1ll emict sfsrrrxm no4optoiieildla rln o u)texoif iotoaDrlu i;( teumim3ou1lm n nvta(  Duru pnu4tlt iieiad a rlnvonu0artrircoatlp r n sl(0 exr(rpnydomtelnci ( a2um(rpnu0optn f3ilt aDrl(mpnt4tltnmrcoodlpDeau ils) rtm(r ou4lleelfcia(f Duaxrpoo4opxo f3iydfm2rl(mo u4treriociatfm eln sls  eum(m oodllee ivt (fa2rru onu0aeto f3iatlm2emuvsnt4teeoxf oatomtranvs t)texr(o3iydamee iciatfarrax  oo4optoiictytls2uluvp;u)artnxo3oatlp e uvs ()texo(rpnodam  lics s) Duru  ;t0teenmi3iydlm ea(mo;t0arxoxrcoatomt lu o;s  2umxm oydomt  fvtl(f rrau pnu4aeenmiciyslaDraumont)texrxf3todomt lneolt0 rtmir3oodom  mnesatfarrmu oot0olxo o3ildlsDrmuvo;(0aetnio3iatom  luvs;t seuo(mpoo4optemnvtls  rtr( onu0aex mo3iydlsDumn o;t)altoxr3iydlp eau i s s2xoxmpou4ap emiet tfsDra(m ou1tlt moeils mDua(mpnu0 rxrxr3ootfp rlu s;t) rtr(r oydal  mivi s)arua( poo4alenifeildfa2el(mpnt) lxomf iatom elnvil( srxrio3ou4oleelfcs tf rtaxrpou1apt  ieilt s2ea(vs u4tltnxrciadoaD lnvs t0srtoir3nu4olenlnes ()srrr(mono0ape ifctad s2eau ont4altrmf ootomt  ivo;()sexr(opno4am   nesat aDtm(rp;u0olxn f3ils mDua(ms;(0tlxrmrctatlmtraueo () 2toxopiudoleelnvs t  rtm(  ot0altoio3tatfs rm(vs (4alerir iodlp r nvi t)srxmxm3io4alenmncsl( sDtmxm nu4oeeo ieias m rlnmpnu) etrif3ia1lptrlueilt)sexmxopiydlpeemfesls)aDtaxm ;t4optn feils aDranvs;u) exrir oa1optran s;(0 exo(r3iodlmeelfvilt a2taxmooo1open feildla2el( o u0 ltoircty1lmt aiesl(0teurim3ou1ll emnei t)sDua(rp;u1oexn oetad s elu onu4 rtoxrciadfa e u o;s s2toim3iu1om   neiat  rtax pno1tetnmfetyt a emums;(4altrxfctydom r uvs t  rur(o io1lmenlfeta( srurxmont1altn oeiad s2uan p ()tleomr3iodfpDe n i;t seurxm3oodolt licilt  rraxmo;u1tex moetaslm ua( s u0 eeoio iatopDeaues;t teto(r oy1omeemiei (f 2umur nt0oleomfeiatfmDeluvp;t0tlenmo3iatla   u i;t  eumxr nodomtnlfvsltfsrrmu oou4opeoioctad s uanmp;u) reoio iodfptrauvols sexrio iu4ome  netl() 2ra(rp;t0tpe ii3tltlaDrln pn()alxrxr3iadoa  lnvi ()t2xo(m3oo4lpeelfeia() 2umxrpoo1tlxoiocildfa emu s (0treomfcoa1omDrlnvo;t)s2tmir3nodamte ies t)srrru  ot1oee mfciad m2rl( p;(0teenxr oydfpD lnvsls s2xrim io1llee nvsa() Dtauro;u0aptoifciytlm rluvo;(0 lxoio iy1om rluvols0truoxm3no4lm nmiciat s2raxmono1aleomfciyt m eaumont0 eerxfctadla ean ol(0texrxm oydomen ictl(  Dur(r ;o4oee  feiys a umuvsnt4trxnmoctotfa raivil()truo(rpoydol e icta(  2um( onu4tpe  fctls s rl(mp (4tlxrxfciatoptelieilt0sexoim3ou4aptemnctlsfsrta( pot0tpeo oetad a eaump t4tltnxrctatoateau i;(0trumxm ou4lpenmncsa(  rumumpnu1alt iietld mDra(vo;u4 rerioctytlptr ieol(0s2uoim3nu4lpeelneiatfsrtrxrono1apto f3iadlm umump (4 etoxo oo1fm rai ol(0 euoxopou1lpeelnctatfsDrmurpnt1ale ifeiltfm el(vpnu0altnmf oa1omtraivs;( trxmxopoy4lm  licta(faDurx o;o1oex ifciltla ean pnt0 reoxrcty1fatr u s t  2xriopou1ale  iesls s2rmu  ot4tltomfeiytfs emn s t)treoxocoo1lpDe uvilt0t2xmxo3iu1op   ivsltf 2umu p;u1olt if3ildfaDra( ont4trxrxo3oa1opt  nvs s0 rurio3nu1am e ietl(fs2tr(moot0aexoioctydla2elump;t)tltoxf3oo1lmD  ivol(  eurim3oy4omt mfeilsf 2ur(rooo1aetnmfetltlmDemu ont4trtomf3io1fmDr u o;t)setr(rpny4om e iesltfsrrm(  ;t4altomieiltfsDrmnms;(4 exnxr3iodlpD lu s t)trxoim iu4omenlnvtltf 2umxmpnt1ole mf3ilt sDranvpnu)texniocio1fpDelnvs;t0t2xrio3iu4optnlfcsl()arta(moou0tptn octatfm2ulu snu0trxomocoo1la eluvi;()setmimpnudolenlicsls  2raumont4alxo icilsfsDemnmon(0texnmo iadlmDr uvslt)texo(o3ou1altemiei tfs2taxmp;t0optnif3ild s el(vo (0trtnmo3ty1oat au i;()trumxr iy4llt mfcslsf rtm(  no0tee mfeilt m rau ont0 exnioctotoaDean ols sexo(m3no4altn ivtl(  2tau  ;o0ope ifeiatfmDelumont0 ltrmr tydopte nvi t trtrim3oydomt mivsls  Drrxrpou4optnmietyd m ua(mo;()tetrxr oatlmD livs;t) rxoiopnu4lltn fctat)sDtaxr ou4oexnii3ilt mDumu on(0 lxrif todopt  ueol() exoxo io4lmtnlneiltfsrtr(root0olxniicias s2emuvo u)teenxo3iadoaDr u o (  exoir3ou4lptemfvils) 2trumono0texnmo3iytfa2elu p;t)alxomf iytlaDe nvo s tetoxmpiu1amenlicil()aDtr(ro;o4apt mf3iyd aDuanmsnt0trtnxrcoo1laDelivsl(0s2toxo3oudop   iesls arra(m ;t0oleo octlt a2rauvs;()tltnmf oadlp e i s s) 2xm(m3io4open neta( arurum ou0opxo i3ildlm2emuvp u4 lxomrciotlpDr ies (  rxoxo ou4ol  mnct sf Drrx  nt0olt iieilsfs2emnvont4arenioctadfpD aneils)t2um(opno1aleelfcs s sruaxrono4tee  ieiadfaDea( snu)altnmo3io1oat luesls trto(m3oydaltn fcsls)s2raumpou0aptomoeiytfs elu p;t0altnio oydfp elu il() rxoio no1alt  ietl(  2taxronu4ape  ociad m ranmp;u4aeenifcoa1fa  anes;( trur(r ou4omtnlfvs ()s2um(m ot4opeomi3taslm um(vo;(4arxnmo3tatlp eln s;s0 etoim no4om elics s srta(mpou4aleomoctytlsDra(ms t0trtoio ia1om  luei s s2xo(r3no4amen nvsas  Dtr(mpoo0olenifctat aDrmumpnu)alxrmrctytoptrlieo;t s2urxm3io1lmt  ics s)arum(ront1tle iiciysls2elnvs;u0aexomocoa1lmt au i s0 etm(r ou1lm nlneslt)arrrur ;t1alen fetlt s um(msn(0aetomr3ta1lmteaueilt0 eto(mpnydll  lfvt (fsDra(mont4tee  f3iltfmDran p;t0 eeomo3oadoa   uvo;(0t2umxm oo4alee ies sfa2urxmp;u1tpt  f3iyd s eau o u0tlxrmo oa1fpDe ivils)trum(r oy1opee ics (  Drrumoou4texn oetytfaDul( pnt)tetnmo iodomDeln ils)seum(mpoudap n fvsltf Dtaxm ou4tpeomo3ilsfa ul(mp;u0tetoxf3iydlp rlnvo;(0 rumio3oudom e ieil(f Drmur nu4alt io3ilsfmDum(vs t)tlxrxociytfat aivils)t2toio3ou1omt  icsas artmxrpoo4tlx  ietlt a2eluvonu4 rxomo3iotfa  luesl()trtrxopoodlmtnlfesas  2trurooo1opeo ictltla uanvo t) lxomf oatfatraivi;()trxmxr3iy4al n ncsas)a2ta(  oo1opx ioeiltlsDem( on()tetoxoctodom  ai s;(  2xrir no1apeemicsas)sDraxr ou0oetoioeilsfm emuvsnu4teerirciodop r ieols sruoir3iu1ope lfvs t s2raxmpnu1tet  i3iadfmDelu p;(0 ltrif iy1lmDrluvi;t) euoxo ou4om elivsls) rtrur ;t1aetoioctydlm2umnmpn()tetnmf oa1fatranei s) rxoirpny4lp nmiviasfa2tax  ;t1tpen i3iatfa el( s (4 lenxo oodlat  i olt  2trxr3iy1lpeelics ()sDua(ro;o1oetn f3iys m2raump;(4teenir tydla r uvils) rtrxrpnudap  mivs sfsrrm(mpnu1tltn oeils s rm(vp;t)trtrif3iatomteai ils0teum(mpiydapenmfctas) ruax pnt0alxoiociyd sDemuvon(0 etnio3ta1lp  lueilt seuo(o oy1llt  fet (f 2um(m oo1tee ioctyd m2ea(mp t0 leoifcta1fm elieo;( tetr(mpoydol nmnct s) Duaumo;t1tlen octys a umums;(0 renir3oa1om elivols0srxm(mpnu1lpee fct (  rtr(ront0tetomfctldfsDran sn() rerio3iotoaDelu i;s) rtmxo ny1lpt livilt srtaum ou4opx ifeiat s2ua( p;t) eenxf3totoa r u ils)t2umir ou4op   icil(fs2trurpno1tex  i3iadla rau sn(4 renmr oadlaD livi;() 2xmim oo4op nlivtas a2umumoot1aeto f3iysfs2rmuvs;()tltrir iotfmD  nes;(0 exrim no1lmtnmfcias sDta(ronu1olen fctldfaDelums;(0texoxf oa1fmte neols) rxr(rpiodol nmnvtlsf 2uru  ot0apx  oeiys m elnvp () rtrioctotlmDr ivi;t)srtm(r3ou1al  lncslt  2tm( p;u1apeo fciat mDrmu p;u) ltnio3oo1oat au i;t srumxrpiu1lpe lfvslt)a2urxm oo0tetnio3iatfm rm(mo (4artnmo oy1lm rlneo;s)seurir iydlmenlfes ()s2tmurp;t1opx mieild m ean sn(0 lxrmf3oytfaDrliei;t0s2ur(r3io1apt  fetat aDrrxmpnt1texoiictyd a rmu o t0 eeoxr3tadlpt  u s ()teum(rpno4ameemfetltfarraumooo0texn o3ildla ua(vpn(0trtnmr tytfatrlu s s)s2toxr3iy1ame miciatfs2urur ;u1aetnmocilslsDrln o t) rtomocty1fptr ues t)tetmxr3oo1ol e nvt (  Dtrurp;t4altnmo3iyt m umump;u4 lxrmocoytfaDeln o;t0trum(m3iudlpe lieil(farrmx pnt4tetnii3iltfs ulumonu0treomoctytop eaneil( t2xmxm io4opt mici sfsDrmx  oo4oeeoiieiadlmDemuvs (0aetrmfciatla  lneo;s0 2umirpio4llenlivtl()a2rmumpno0oexo ietysls2umnvo;(4 rxoxf3oodlaDr i olt)seto(o ou4am   icsa(faDtrurpou0alenioetltfsDul( onu4teenio ootla   ies;(0tetoir3iy4oleemnvil()srurx oou0olxoioetydlaDemnvo u)tltnxr3iy1fm elueol() rtoimpno4lmte nciasfarraxmo;o1tpxnioetltlm2uauvonu4aeermf3oydfa raueolt)s2toir3no1ol n fes sfsDtr(r nt4oeenmoeiyd m uanmsnu0tlxoif iatoaDrlieolt  rtmiopno1lmte nctas)arumu  oo0alt  fctlslsDran p (4 eeoir3iadop elnei;(  eum(m3ou1amee nvt (  rraump;u4tpxoifciasfm2umump;t4tltrmo3oo1fm   uesl(0 rxoim oy4lm  mfetlt)srum( ont1oeenifcilt a uauvpnt0 rtrifctydom eau ils0sexmxmpio1ap  mfvil(fartrxrpoo4apenmociys mDuanmo;t)tleoxo3iodomDrauei ( s2trir oudol n ivtls)a2tmu  ou1olt  oeiydlm2ea( o;t4 lxrmf oo1oa e uesls)t2umxm ny1ame  neslt)srta(r ot0oleo fciysla2emums;u4 rtrmrciadopDr nvi t0sexm(o3oy1ap emnes s)srumxrpnu4apenmi3tysfm eaumsnt)arxoircio1omt lneilt)sruoirpoodoptelnetl(f 2rmumpot4tpeoifetlsla2rmnmp;(0 exoifcootfa e uei;( t2ur(r io1opte ict t  rrax pou0apxoifeilt m2ra(ms;t0 lxrxr todlatraneo t  exrxm iu4lmenlnciasfaDtm(r ou4tleo o3iatlm uanvont4 lenir ty1oate ivo s0seumir nu1ap  liviat) Drm(m ;o0apt  ietls sDulnvs t0trxrxoctytfmD li o;( srxrxo3oydame  nvs (fsDrru ont4olenmoeild s ra( o t4tetrmfcoydfmD  u ol(0s2xrim io1ope lfesasfaDrr(monu1teenmf3ilsfm eanvp;u4trxnmfciytop eln i (0t2tm(m nodll emfvtls)a2ta(m ;t0tlxo ociatlsDrmn s;t4tlxrxo iytlpDr uvo;s) etmxm3ny1lptnlnvt (  Durump;u1aexoifetldfm elu p t) rerio oydlm e i i (0s2urir3iu1apenlicsa()a2urx onu0oleoiietatla2el(vp t4tlxoxf3ia1omte i ils  rtoirpio1lp emfesasf 2rru  ot0aexoiociysla2ra(vs u)aeenmf3oodoaDeaivi;( trtriopiy1lpen ivsl(  Dtm( ono4tee  feiyt m2eaump t0tltrxr tadlatrlu i;(0srumimpio4apt lncia( arumxronu0apx  ociyd aDeaumont0trenmrcoadlmteau sls  exr(o nydomt mnctatf rtaxrpou4tetnmfeiysfs em(vs;t)texnmoctotfmDr u ol( srxoxr3oy1lpen ici sf ruaump;o0aexn ieiyd aDrm(vp;t0aetnmoctadfptraivsls) etoxmpnydop nmfeil()srua( p;o4oet  f3iadlmDem( s (0 ltrio to1lm   neols0seuoxm3nudll nmiet s)srraxmonu4tltn fciyd mDrauvpn() reomf iytop eauvi s) 2umir no1opee nvsl(f Dur(r nu0apeoiiciltla em(vsnt) eenxfcio1fmte neo;s s2tmiopnodll  mnesls) 2rmx oou4tetoioeiytfa2rmnms;(0tltoxfciy1lat aueo t0 euoimpnu1lpee ies sf 2ra( pnu4ole mfeiytfmDea(mp;t4 eeoifciydla rli o;t0srumiopio4omee ncslt)arum( p;u1altomieiad aDuauvp (0 eeomo3tydfp e neols)s2xriopny1alt mfesas aruax o;o0aexnmf3iyd s2rau s u)teenxf3ia1lmtean o t)s2umim iydapt mivi s)srtrum nu0tpxnmocild aDumump;(4teerxf3totfp eaueols  2trio nu1ome mfcs s) 2rmump;t1olx ifciysfs2rl( o t4tlxomfciydomtr n o;( s2trio iu4amtnmiesl() ruaum oo1oexn ociatfaDum(mo;(0alerxo iatfateluesl()t2toxmpiudoptelivsat)a2ta( p;o0oet  fetydfsDrm( on(4 etnxo oodfpt lnvi t s2toxr3oudoptn fvtatfarua(mo;o0aleoiieiltla2rluvs t0 rxomfciotoate uesl(0srtoxr nu1omen iei t  rrr( pnt1tpe mo3iytfa elu pn()alxnmf3iadfptelivs;t0t2xmxrpnydoltnliesas  rrrur nt0tee iiciat a ranmo (4alxomrciytfa   uvo ( srtrio ou1optelict s aDurxronu4olenioeildfm rluvpnu0 ltomr ia1la rauvi t)trum(mpnu1al  mfviltfaDraurpou0apt ifciydfs uau sn()trtoxo3iodfp r n o s0teumim3no4ap  mnvia(f Drmx pot4tltnmietldlm2ra( ont0 rerxf3oydfmDrluvil()trumirpiu4lme licsasf ruaxr no1tpxo ieildls2uau p t)alenxr3ta1omtr n s t  exrxmpiy1lp  mfci t sDtaumoot1texnmfeildfm rl(vsnt0 exnxrcoo1omDranvsl(0s2tm(mpoy1olt lfvsltfsDtrx  no1tpt  feiysla uln o u4 lenifciotlmDrauvs t)seur(r iu4lm nlict t) Dtmxmo;u4apxoiiciltlm el(mo (4texnio3to1faDr uvs t s2uoio oo1lme lnvtlt)s2trx pnu1opx ioetytfa2uau p;(0 exoir tatlateaueo (0 2tr(opoodol n icsl(faDum(root1altomo3tys m umuvsnu) lxrxo totfmtrauvolt0 2umxrpoo1oleelnci tf 2uaxm ou4tlx ii3ias a umn o u) etnio3oydlaDeli i;t)texoir3io1am  miviatfs2rrx o;t0texoifciytla2ul( p;u) leriocoydomDeaivi;s)seumxm3oy4olenmncta(fartmurono1oetoifciydla rmn on(4tlermr3ootfpteauvi t trxmxr ny4ope lfcils sruaxrpnt4oleoio3iytls2ea(mp ()arenxfcootfpt lieils0trxmir3oo4lmt  neta( a2ur(moot1ale  i3ilsfs uluvsnu4 leoircoadomD  nvo;s)seuo(o3iodapt  ncs ()srtax pot0apxo oetysfsDel(mo (0tetnmrcia1op ranes t)s2xoir iodlp nlneilt)aDta( poo0teto iciytlm2rlnmp (0trtnmo3oo1optrli sl(0 rxmxopny1al   icsltfa2rm(m nu1optoii3tyt m2elnmo;(4teenmfctotlm eanvolt)teuoxr ny1lpen nvtatf Dum( p;u1ape mfetad sDranmo;(4tleoxo3iydfaDr nei 
\ No newline at end of file
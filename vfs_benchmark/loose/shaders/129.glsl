@@ -0,0 +1 @@
+ieo t trtrxr3oudol n nesa( sDrm(rono0olto o3iydfa2umnms;u0 exnmr iy1op e nvslt)t2tmir oudomenmfetatf 2rr(r nu0tpt  oeilsfmDuau p (4 renmo to1fmDe u i;()seuoxo no4lp   fvslt) 2rr(mpno0tptoiociltla2emnvpnt)aeerif oydomtrlu s;(0trur(mpoo4optn icsas)sDtmxm nu4oet  o3ilsla ra(mp;t4tetrmrcto1omDe uvi ()s2uoimpou1op  mivsls sDururp;u1aeen o3taslmDea( s;()arenxf3iotop eliei;t  etrir nudom  lics ()arrm(  ;o1tlxnmo3ilsfaDumnmp t0aetoir ia1opDrlu o (  ruoiopny4optemfctlt) 2urxrpnt1opx mietas m2em( s u4tlxomrcootomD  nes s trxmxm3nudomeelictlt a2rrxrp;o0alxoiociad a2elnmp;u) ltrmocoydlmt aies;s0 rtrirpoy4ale  iesl() Dumuront4tetniociyd s rlump (4 lerxf3iodfa  lnvi ()truoiopoudam e ict tfs2tr(monu1teeo oeiad s umu p u4arxnmocoatfmt lieols) rtmiopno1oltemnvia(  2tax pno0apeomieiyt a2rl(vo (0 renirctadlpte i i t s2xoxo nydapt licsatf rua( ono4tlenmfctysfsDranmo;(4 rtomo3ty1lp  au s;() etrir3ny1aptnmies tfartru pot1oeenmf3iltlsDul(mo t0 etrir tatfp e uvo;s0s2umir3ou1lmtn ivtat)sDta(m oo0aleoio3iydfsDranvs;()arxnioctadfmtr nvs;s  exo(r3oodop n fvt sfa2rmu  ;o4aeeo ieiasla el( p;t)artoxf to1laDe i o (  rurxo3oudlptelictat aDtmxrpnt0alt ioeiyd s rmnmp;t0 reomr3tadlpDean s;()s2xoio iy4altnlnvt t) Dtrx p;t0tlt mi3ild m2eau s u)aeerxrctotlaDeauvo;t0t2ur(o nydamtelnes s)sDrrxr nt1tlenifciasla rl( snt)tetnmrcoydomt  i s t0s2uo(r iu1al elfei sf ruaxroou1openmfeiat mDrmnms;u)aexrif3oytopteluvs ( trtmiopiudal e fcs ( a2ra( o;u0oeeoifeiadlm umu s;(0tetnif3ta1lmt  n sls0texm(mpou1al elfcs t)aDrrx oot1oexniieiysfs2eau onu)altoifciodfp eln slt0srtmirpnu4oltemict ()artrx  ;o4aeeniociad a uanvs ()altnmf3ty1lm e ieolt t2toim3oodlmt lnciat)artr(ro;o4tpeomf3iaslaDeanms;t0altrmfcootlaD  i i () eumio oo4ap e fei (  Dra( ont0apto ociltlm2em(mpnu)treoirctydfatraneo s  rxoir iy4ole  ivi sfaDtru p;t4tpx iieildla2eluvo ()teerio oytopD anvi;t  rumio oo4lp e fctl(f rrrxm ;t4tptn fciytls2rm( sn() etrio3oy1laD auvsls  rurimpoo4optnlfeias  2rrxrpou1altnmfctyt m eln pnu)tlxnxf tydfmt  nvo;s  2xoiopiodal n ivsl(  2trx  no4oltomieiltlsDulnmsn(0 lxrmocootfaDran i s)srtm(rpoodlltn fvt t arurum ;o4texnmfeiatfa umn p;t)arxrmr totomtrluvo (  2tr(r nu1am e ncslt aDuaxmo;u0aee  iciytla2uanmsnt4 rtrmrcto1oat auvi t0 2xmxmpiudlmenmfciasfsrta(monu0aexn ictas a2eln onu4trtoif3ty1oaDr nvs ()trurxm io4lpen ivt t a2tm(ronu0apxoifetlsfa2elu onu0 rxnmo3tydlp   ieo t t2urim oo1llt miesa(fs2rmu o;u1openio3tltfmDem(mont0altrmfctotfaDeaivsls trtmirpoo1apenlnvtat sDrm(mpnu1tpxomo3ildlm2eanms;t0alenircty1lp  ai s;()t2um(o iy1amtnmncs (  2taxmpnu4oetnio3tytfm2ulnmo;u4trenxr iy1om   ies ( t2to(opou4ame  fesas sDur( o;o4aexnmf3ild m uau o u)arxoxr io1oaD  ieo;( seur(m3iy4oltemivia( s2ra(  ;o0tex mfctldfsDumuvp;t4 rxrmf tatoaDe ivslt0 2uoxm3nudopee nei ()sDta(  ou4tpt mi3tytlm rau snt)texnifcoy1lmteaieslt s2trim nudol n feias) Dra( poo1tpxnifetad a2ulnvs;(0trxoir3tytopteluvi;t  eurio3nu1altnmnvia(f 2taxr nu4aexoiietydfm um( onu4arxrmo to1oat luvsl() 2toxr oo1amen ivtasf rrrx p;o4tptn ociysfmDrm(vs;u)tetnmf iotfm elies;s0trxrxmpio1lmt lfvtatfsDtaxmoou0oetn ieiadlaDulu o;(0alenxfcoa1omtelu ilt0setrio3nydoleemies t aruaumpou0olen fctasfm umn snt4 exrxo oo1oaDr i o;s0 eum(r iudal nmfct (  rua( poo0oetoifctldfmDem(mp;(0aexnmoctodomtelivi;t0teuoxo iodapt mfesl(f Dtrxmooo4aeeomi3tatfm emn o (0 ltoif iodopt anei;(0trurxopoo1oltemiei (fsrurx o;t1aee mociltlm2umu sn(0alxrmrcoa1laD ai slt) 2xmim3oudap nmncs (  2taurpot4aee  fetldlm rm(vs;() eenir iytlmDrlivsls0 rtoxopiu1aptnlfeiltfarra(  no0oet ii3iasfa2emu s;u0 ltnircoadoaD aueo;s0t2toim3no4lp  mietasf 2raxmpoo0oltnmf3tlsla rlu pnu0trxrxr todopDraivi;() rur(opoodll emnvta( sDtrumpnu1tlenifetadfs2rmuvp;u)trtrio3iadoaDeau il()trxm(r nydlltn ies s)a2ua(mpou1opxn ietldls2rm(mpnu4 rtrir3to1fmtrlnvi s sexr(o3iu4olte fcilsf rta(rpnt0oleoioctydls2elnvon(4tetnxf3oa1fp elneo s0s2xrxr ou4omenmnesas) rtmxm nt0tle ii3tld s em(vpnu4aleomocoy1fatelues;(0 exmir no1al emneiasf Dumx pno4apeoifcils a2uaump (4tltrxf3oatlaDe ies t0 2xo(o oy4lpte fvsas srumx  nt1tltn o3iltla ul(ms;t0 rxoxo3oydoaD ai o;s) eurxopiydapt mfvi s aDuaumonu4aeenmo3ilt a2rmn s u) lxomocio1oat lues;s)t2xmxm ny1lmenliei tfs2rmu o;o4tpenif3tlsfsDuan o u)tltnxr iatoatelieo;s t2tmxr3no1lltelfctlt)arur(  ;u1altoiictlsfa uauvpn(0tltnir iatom   ieo s)s2xmxrpiodaltn fvi (fsrurxmpno4teeniiciasfmDelu pnu0 rxoxfcoy1opD anvs;s tetr(r iydaleemieslt)aDua( ont0apx moeiyt s2uau o;u0arermfcoo1fpD lu ilt)sexmio no4alee fetltfaruaxr ou0teto feiys m umnvp t4alenmociadlpt lnvo ( teuriopnu4omtn iesls s2rmuroot4olt ifciyt aDelumo () rxnxfctytopD aivi (0 rxm(o nydalte fviltfaDraxr ;o1aeenmociaslm2uan s (4 eerxr3tydlaDeai ols)s2tr(r3ny4omtelfviat  Dtmu  nu0oetomi3ild a umums;(4 exniocta1fpDr uvi (0setmxm3ou1optn ivs (fsDtmuro;t1alxo ieiadls2rl(msn(4aeeomo3iy1omD an s s s2tmim ny1al emnct (faDrr(mo;o0aex  oetysfs2ranmo;t)trxnxf3to1oa eaiei t t2xmxrpiy1amtemnei s  2tau pnt4optnmf3ils sDua( s (0altomfctotfmtelu s s s2urxm3nudamte feslt)a2ua(mono4aeeomo3iasfaDeau p;t) lxnxf iatfaDe uvo;t0 2xrxm no1am emnvia() rraxr oo1tptnmociasfmDumumpnu4trxrmf3ta1om e nei s0sexoirpnydope mfes sfs2rm( pno4tpx if3iydfmDum(vo (0texnir to1fa e nvil()srxrir3ou1op n fetls  Drm( pou1aexoio3ilt s el(mo;t0trtnmr oadla eluvo t0tetoxo oy1llenmneslt)s2um(  nt0apx  i3iltfm2eau ont)arerircoy1omt au sl( trumio3oy1omt lfetl(fa2rmur ou1tptn ociltls ranvs;u4 etrircto1faD  i ol( texoxo io1lp  mivsasfaDrr(mpno4olxomociyt mDemuvp;t0alerif3ia1lmDeaneo;(0teuoxrpiu1ome livslsfaDtrx  ot4tltnioeiltfmDelnvsnt4 rtrxr totomtrlies;t srxmxm3ou1ol e fesl(fa2trxm ou0aexoiieiltfs2uau o;t)altnio oydfat anes t0s2uo(r nudlmeemfvsat a2um( pot0apeoio3ils a2ul(ms (0aexnmf3tadfa  ai ol()teur(r3oydll nlnesls) rua(  no0tlx  ieiytfmDrl(vs u0aeeniocoytoaDr ueo ( tetmxr3nu1lptn nctlsfs2rmu p;o1alx iieilslsDra(vs t0altomrctadlaDraneils) 2umxopiy4lmte nvi t a2ra(mpou4tlxn i3ias s ul(mp;t4altrircoodfpteaiei (0trurio iu1altemfvsls)sDrm(ront1texo fetltfm2rl( s (4teeomr io1laD lnvil() euoxm ou4llt  fvils s2urxmo;o1oetn ociytla2umnmo (0 eerxrciy1lm  luvslt) 2xrxrpnydll n fcilsfsDtr(  ot1tpxn o3iat aDelnvo;u4aetnmr iotlaDr ues (  eumio nydame  ncsat)a2rrumo;t0apx if3iyslsDem( pnt)arermo3iotfmDr u s t truoxmpnodlmenmict t artm(monu0tpxo ieiatfsDrmuvp;()aeenxr todfm e n o;()s2xmxr ny4lpen neiatf Drau  nu0apx ifetld mDrl(mp;()arxrmo iydomte ies;s0 2xrxm3iodllt lfvtls s2rrxrpoo1tpx moetltfm rmu s;u0tltrxrcio1laDraiei;s  exo(o3no1omtemieiat)a2uru oou4tlen i3iytfs uln snu0 etoxrcoo1oateau slt0t2xoimpiydapte ieia( srra(m ;t1ope iietld mDeln o;(4 lxomrcoatfm   u o t)setrxopoy4lp e fcta( arua(  oo0tlenio3iyt a rmnmon(4teenmo3ia1fatrln i;t0sexoxo3oydlpt lici sfs2truro;o0oee mi3ilslm2ul(vs;t4alerxfctydfpteanvs t0seumxrpiu4op nlfesat a2rau o;o0texomicilslm ranmp;(4teenio3to1fmDe ivs;( setoxo oudlptemiet sf Drau p;o0altnmi3tatlsDul(mpn(0aexomocoy1fp rlivol(0texo(opnodapt mnvi s) 2rrxront1tleniiciad a elu s;u)artnmr3ta1laDr i ols sexm(opoo1llte ivsas arra( ont4tlenio3ildfs rl(vont0 etrir iytfpDeanei;t)sexoxopnodop n fvs t  2ua(mp;t4apt  o3iydlm elnvonu)trtnmf3iytlp   neo;(0srxm(o ou1lp   nci t  ruaurp;t0altoiictasfs2umnms t)texnmf ia1fpDrliei t0 2uo(r3iy4lmtn ncils aDur( onu4opxomicias m2ra(mo;t0aeermoctadfpteanesl( sexm(opnu4olenlncs tfarrmx poo1aeto ieiadla2ea(mp;u4 rxomocoa1omD au o;( s2umirpoy4lmen ncsl( aDrau  ;o0tleo i3tlt s2ra(mp (4 rxrxrciadfp rlneo t)tetoim iodlme lncta(fartm( oou4olxniieiat sDrau o;()altrmf iadlpt  n i s t2urxopoo4lmtemnvtlsf 2um(  ;o4apx  f3tatls rmnvs;u4trenxf3oadomtrlnvo (0trxm(m nodlmtn icia()aDuax  ot4aexnmo3tat s um( pnu4alenmr oadfmtran s s)sruoio nu1oltnlfvsltfa2uax  ;o1tptoifeiat s2rlu o;t) rxnxfcta1lmD  ieols  2xoir ny4opeelfvtas) Drauronu1oee mociadfm eaump;(4texnmf3iadoa rln ilt)trxoxrpnu1al emivsltf Dtrur oo1tpt  i3tld s2ra(vp () exnircio1lmDraieols)s2uoim nydom nmnvtl() Durxr nu0oetnmoeiysls2eln sn()altomo oatoate ues s0 eumir3no1ap elncsl(fsDra(mono4oltnmociatfm2ra( pnu0 rtnioctotlaDr uei (0srum(m ny4op emiet (fs2ua( pno4aeenmictlslsDrmnvpnt) rxrmo3oa1fm eanvslt)setm(m3oo4lmt  fvsasfs2rmx ont0tlxn fciadfa um(vo;u0teenxrcia1lp eaivils  etoir3no1ll  lfet t)s2tmx  ou0opt iiciys aDelnvpnu0 ltrio ty1lmDelu olt0s2uoiopoy4apen fetltf Drm(monu0opt  feilt s2um(vs (0 ltomfciy1laD lu sls0t2xoirpiu1al n nci s s2tau oou0optn ociasfa em(vs (0 rxnmf3iotom rli i t0t2xr(r iu1ame miei s  rra(mo;u4ope ifeiytfmDem( on()tlenircty1fa e i ilt0s2uoim nu4lltnmictat)s2um( oou4olenmoeild aDulump;(0 etoir iatlmtrlueol( s2urirpnu1lmt mfet tf 2taum ;u4tetnmiciasfmDrmuvont)alenmr iy1opt  uvs ()s2xoxm3oudll n ieiat)s2rrx pnu4olto fciatlm umn p;(4 lxrxf3tatoatr neilt tetmxrpoy4ame  fcs t artaumpot1aeenmietytlm rl( p;t0tltrxf3ty1lp   i ils0t2tr(m3nodomenlivil(f 2rmurpoo0oleomictatfm2rmn s;u0teenif3oydfaDe u sl(0s2xoiopnu1ameelfvtat) Dua( oot0tee ioeiydla2emu sn(0arermf to1fmD anvo ()trurxm3io1al nmfci sf rurxrpno0apeo fctasfm eanvo;t) etnmrciodlaDrlnvo;t teurio3iydomee fetasf rra( pno4oee miciatlmDul(vont0 exnmr3oa1opDrlivsls0t2to(o3oy4ope mfeslt  rua(  ;u0apxn ocildlaDum(mo t0arerxr oa1fpt aivi s)setmirpnudapenlici s sDraxmo;t1alt iicildlaDumu s;t) rxnio3iatfat  nei;()setrir3iu4amt licils srraxro;t4aleomfciydlsDul(ms;u0 lermf3ta1lpD ai i;t trtoimpnu4altemnetlsf 2ua( pou0alenii3tltfmDraumo ()tlxnio iydlptranvolt  exoxm oy1omte nvilt  Dur(roou1alx  f3iltlmDra( s;t)altrxf3iytlatrau o;s trurirpiodameelnvta(f rra(r oo4oee  oetld s2umu s;u)alenmf todfpt li olt0teum(m3oy1lpee fcsls)aDtruro;u4tlt iictlslm2um(vpnt4 eerir3iytlp r u i;t0 rurxmpiu1al elfei tf 2rrxr nu4olt ifctas m umu p (0trtnio3oadlpt anvols trxrxr nodomtnmfvilsfa2ur( p;u1oet iiciatlm2eln snt)aeenxo3oytoa e uvo;(0 rtmxm no4olt mivsat  Duau oou1apeo fciatfs uaumon(4areoxf tytlmDr nesl(0t2to(m3nudlm nlfvtat arrmumpot4apt  ociysla2rlnmo;u4alerxfctydoate u i;t)srur(m3io1lmte nvias)aDurxro;u0tlx moetydfmDrmumsnu) ltrmr ta1om eaies t)sexriopnudapenmici tf Drmx  ot1tpeo o3ildfsDelnvs (0 eeoxf ta1fp rluvo;s)srtoio no1al  lfct t a2tm(m nt1oexomf3iasfa2ul(mo u)alxnmr3oadfate uvsls tetr(r3oudale mieta() 2rrum no1tpe  fctaslsDrmuvs () exnmr iydop rlies;t)t2xmxrpnydlmeemnci (farurxroot0teen f3tyd mDel(ms (0tlxrmrcta1fp eln i;( texmir3oodlptnmfcsa( artm(rpno4tltnio3iytlm2rmnms;(4artoif tatlaD  ieols) 2xmim nydlpt mfvil(farumxmpou4aleomo3iys s2rl(mo t4 exnmr oydoaDeauesls0 exr(m iu1aleelfciatf Durxrp;o0apto o3tad a um(mpn(0 exnio iytlpDe neo t sruo(mpoy4ol e nvia(  rua(  ;u0apt ifciysfaDulnvo t) lxrir iadoaDrau ilt) etmxo3ou4aptn iesl() 2taur ou1tpt mfeiad m2umu p;t0 exnxr3io1oatr uvi (  etoxm oo1apt mietls) rra(rpoo0tptnmociydfa2rauvsnu) lxoxf3iadlpt aneilt)texrim3io1ome mieslt)sruax pot1opeomf3tlt sDel(msn()alerifctytoaDrln ols) 2tm(mpnydapeelfeilt)srtm(rpot0tptoioctldlaDeanvs;t4texomr iotfpD anvolt t2uo(m iodop  mfviatfsDtax  ;t4teeomociytfa2ean ont0teerxfcoodfm eanvs;s) eum(opoydoptemicias  Dra(  nu1ape  ieiasfmDum(msnt4altoif3tytfa raiei t0tetrxo oy1ll   iesas) Dtruroot0opxomo3tltlmDum( p;(0aetoircio1om  lnvils0t2tmim oodlp e nesltfsDuaumpoo0aex ifcias s2ul(vo (0alxoxr3tytfmDrai s () 2xrim io4lpenlicilt  rurumont1aeenmf3iys a ua( p;u)tlxnxo todom eluvi;()t2uoim3no4llt mietatfaDrru  ot1oee miciadlmDumuvs t4trtoir oydlpteaneo;()t2ur(mpio1amtn icsl() 2rm(mpnt0tlx  f3ildfmDrl(ms;t4arxrmr3oatlpD aieilt0 2umio3nydlpee fcsat) Dum( poo1apeoioeiaslmDrlumo;t4aeerir iydlmtelnvols)tetoxmpno4lp elicsa() Drax pot0tpxomoetltla2umnmpnu0 eeoirciytom eaiesl(  rtmimpiy4ll  mneil(f 2raumpnu1olxomoeiatfm rm(vs;t4teeoif iy1lm r u o ( t2tmiopoudomtemfesas) 2umum ;o0tpxoiieiyd a2rmuvp;u0areoif3tytoaDe ivs t0srurxm3oydlltnmfesls) Dtrxmp;o0oeto ocils sDrm(vo;(4tleoir3oydom  au s s0 rxrxo iy1omee ivs ()a2tr( o;o4apeo ieiaslm2rauvo (0tltomr3totlptrlnes t)srtm(rpiydol  lfvt t sDtax p;t0olenif3iydfm2rlu s (0aetrxr3oadfmtelueo s0 2toio oo1op  mivias)s2rrurp;o1aexniociadls2rmnmp;() rxomfciytoptean olt teur(o io4am  miciat)srtrurpnu4tpeomociys mDumumont) lxrmocty1omD luei s)teum(r iu1lpt lfci tf 2rrxmont0tex  f3tytls uauvo;u)altnxr oadop  aivi;() rxmxmpnydamt mnei tfsDrrumono1aex  ieiytfm2emumsnt0trtoif tytopt  u ols0 ruoxrpiydam nmnvslsf 2rmuro;o0ape if3tadlmDeanms t0artnmrciytom   i i;()t2xmirpny4op n ics (f rtr( ont4tlxo o3ilt mDrmums;t4alxrmfciodomDeliei;t0tetm(rpoodllenmfcsas)srumu pot1optomicils a2ranmo (0 etrmf3iydfmtean s (0tetm(mpio1ap nlnci () rrau  ;t0altnmfeiyd aDrmn ont4tltnifciatfaDelneols)srur(rpio4op nmfvtl(fs2rmxr nu1tlx moeilsls2eanvp;t) lerif3iotoptrau i;t0srxo(r3io4lmtelnctl( srra(r ;t0aetomi3ils a2rl(msn() rtnmr3oadlatraiei;s0truo(mpou4aptelicsat  rrmumo;t4tpxo fcils s elnvp (0aeermo iadla   ivs s0seumim io1am   nct s) Dtm(rpno0texomietlt s umn p;t) rtoio iatfaDe uei;t s2urirpnudal emfci t) rtru o;o4olto iciadfm ea(mp t0 rxoxo3iy1faDe uvsl( s2umir iodoltnlnesas)sruaxmp;o0aee iieiat s2elnvs;u0 ltoxf oytfaDr uvs;t t2toio iy4al  liet s a2trx oou0optoif3ilslsDuau onu0aeermf3iodlatrlies () eumxrpiudol elnvtlt a2rax o;t4aptn icias aDelnmp () exriocoodfmteli i;s0seuo(opny1oltelnetlt  rur(r nt4openiieiatls2elu p t)tlenifctotomD aiesl(0 2ur(m3io4lmeelfct t s2trur oo1tpxomfciyt a2eanmo t4 exoif3tydop  an slt0 2urxr3io4opte nvs (f Dum(m ot4olxnii3iytlmDrmnms;u)tlxrmoctatomtelies;t0 exo(opio4aptnlivtlsf Drr(  nt0opt  ieiysfaDean snt) exrxf ta1omtelivs;( tetoxo oo1apenlfvs (fs2ur(mo;u0tle  oeiytlm ean s;t4arxrxf iotlpte ivo;s  eum(o3iu4omenlivia()s2uru  no1oetoii3ildla emnvp u4texoxo3ootfp eluei;s)s2trir3iy4lm  lietas sDrrum ;o4alxo ieiatfm um(mp t0arerxf3oo1lmtrlueo;(0t2urir nodole  ncilsfaDumur oo1opxoii3iadfa emn snu0teerxocoa1lmDe uvs ()tetr(opny4amtemnvta( srrau  ;u1tex mfeiydlm ean s;()aeenmf totfpte ieil(0 2xm(rpny4lptnlfeils)a2rrxr oo4tpxomi3iyd a2umnmpnu0 reoif3iotfmDelueil(0 rtr(o nu4aptemfciat arumx pnt1alxnifciltfaDea( on(0 rxomocoodfm rlu s (0 eumiopou1amtnlicsl( arrmx pnt1tptnifciat sDrm(vo (0alermf3ia1fa eaies;t0s2uoim3oy1oltn nvilsf Duru o;u0aleo i3tas m ua( p;u)teeomr3iydfpD livo t)s2ur(rpny1altemnvtas artru  nu1tpx mociltfm ulnvonu0tltrmf iadfmD anvo s  exrimpny1openmneiasfs2ta(rono4olt mf3iydfm ul(vsn(4tetomo3ia1fpDr i o;(0 2tmxo3nu1omee ieia() 2raxmonu4tee mo3iydfa emumpnt0aetnmr tadomDe uvo;s0srtrxopiy1ol elnvt s a2rr(mono0oeeomfetysfmDelu snu0altnmf3ta1lmDeanvs ()seto(r ou4am elnet tfa2taumo;t0tex mfeiydlm rluvs;u4arxrmr oatoaD  ivs;s  etoirpou1olen nes s s2uau  ;t1tptoifeiysla2rm(vonu0tlxnxo tydopt ai o s) 2urim oudom   ivs t s2tmu  ;u4tptoii3tys sDumumsnt4trtoxocta1fpDelueslt0trxmxm3oudlp emnvta(f 2tax  ;o0oetn o3ias m rau snu4 lxnir3to1fa rlneils)texoxopiy4ll elneia(  2rmu ont4altoif3iys a rau s (4 rtrxrcoytlptelu sls0setoxopnydlp   icsat) Durxmpot0oeeo ictasfsDrmnms;()aleoio iytlmte uei;()setmxo3no1lmt mnvilt)s2raumoot4tetomiciydlm2rauvs;u0 exrirctotfm   ieols0 2toxo iy4amtnlictltfaDtmur nu0tleo ieiydls2uln p t0 rxomr oydoateaneils s2xmir oo1altelfvi ( aDrm(rono4tpx mieiyd m rmu p (4 ltnio3iotopt  u ol( sruriopoo4lptnlncilt) Dtmx oou0aeto oetydlaDra(vs t0arxoxocoodom   nvo s seuo(m oy1lme lfvsa(  Duaxmont4oeenmoeiydlmDuln o t4trtrxfcio1om  aivsls t2xmiopoudlmt lfcsl( srtr( ono1texnio3ildfm2eanvsnu0alxomo ia1op  liei s)srxrimpio1ol n fes tfs2uaxrpot1tpeoifeiltfsDrm( o u)trxrmr oytlpD  ivs;t) 2xrimpou4llte nes ()srtrxrpnt4olxomfciydfsDemn o;(4 rtrxfcty1omtraneo;()s2tm(o3ou1ll n net t  2um( o;t1tet ifetytla ea( snt0areoifcoytfp r u i;(0texoimpny4optnmiviatfarraxm ot4aee if3tytfa ua(vo ()texoxocoydlpt aivslt teurir oudam nmfci sf rra( pou4tpxn f3iadlm uan pnu4arxnmfciytom e uvsls0s2xoxr3iydlltnliesls)aDum( p;u4openmiciasla2um(msn(0aeermf3ty1omteauvo t)t2xoxo3io1altemfvt tf Durx  ot0ale  i3tatfsDrmnvp u4aexoir3oodlaDeau o;s) 2to(m3oydlme mfvs sfa2um(r ;u4alt ifeiasfs2rln snu4 lxoif iotfatr n i ()t2xr(mpny1ol n nci ( s2trxr ou0alenioeiyslm um(vs;u)aexnmrctadlmtrauvsls sruo(o3io4ape mneslt) Durum ;t1teeo f3tyt mDemnvs;t4alermr3ta1omDe ueils)s2xoxr3oo1omtelictlt  Dumu o;o1tpxnmi3iysfaDulnmpn()tltnmoctodomte i s;s0sruoirpou4aleelncs (faDraxmo;o1aexo o3iys a rlu s;u4teeoxo tadopD  nvo s) 2toxr iu1amenmivt s aDraurp;u0ale  icils s2ul( ont0 leoxr3oo1opDeaies () rtm(o nydoltn iviat  rumum ;u0apxnmoctydfm emump;t4texnio3to1fp  au sls)srtoxm3ou1op e fvs s)srrrum nt1oltoiieiaslmDel( snt4 eerxf oytlpt aneo s s2xm(opiu1lmt mfvt sfs2rrxro;t0apeo fcilt mDem(vsnu0trenmocty1fm r n s t)texoiopoo4alt  iviat) 2tau p;t1tpen ictltlm2rl( pnu4 rtomf3oo1lp  lieil(0s2tmio3oodap  lfcilt  Drruronu1oetnmf3iydla2ul(mpnu0alermr3iydfpD  uvo;s0teto(mpno1aptnlfvt s) Dumu p;o0tpeomf3ilsla uauvs (4tlerxf iotomt  n o;()t2xrxm iy1lm  mfvs t)sDum(m ou4ope  oeilt mDuauvs;(0arxnio tytfm   nesl( s2uo(m nu4ap   netltf 2um(moou0aeeo iciys s ra( ont0 lerxociadla e ivslt  rtoxr nu4amee fesls)a2uaur oo1tpxnmicils s uau onu4trerxf oodla rliei t0teuoxm3nydamtnmfes sfa2tmump;t4oeeniietydlm emuvp u4arxoir3to1oa eaieil( trtrio iu1ap nlivsas a2uaxrpoo4olxo iciytla2ra(vs;(4alenirctatfmt  u i;s seumirpoydlltemfvtls)aDrr( onu1tlxo ictydlmDelnmp t0alxnxf3iatop  ai ils0s2umim3oodll  lict tfaDtrump;o0oltnmo3tlt a em(msn(0arenir iydoaDrlnvolt0trto(o3iu1ap  livi s)aDurxrono0oet  fciatfs umums;t0 lxomo tytlatelu il(0trur(r3io1amenlfcs ( srtmu oot0alxn f3iys aDra(mo u) rtrmo3totomt ln o t)seuoir oo1alee nvias a2ur( pno0tpxo icild aDumnvo;(4 renif3iy1fmDranes t0trtrxr3ou4omtnlnvsltfs2uaur ;o0opeoifetadlmDranvo;u4arxnxociadfmDran olt0teurir3ou4ol n fci (  2rau  oo4ape if3tys aDeau o;t) exrxr oadlm rluvs;( texmxm3nu4olenlivtls arraum ou1tpxoifciatfa2rlump;u) rxnmo3iotlm  aivs;()trxoio iudlpeelfctlt  2urx oou0opx iieild sDuan onu0aleomociadfm  ln sls) rxm(mpiy4lpenlnvtlt) 2rauroot0tle ioetydlaDem( s (0arenir3tytlp e n s s0s2urxmpno1alenlfet ()aDua(mpnu0texnioeiydla2umu onu) rtrmf3to1fatelu i;t0srxrxr oudaleemici sfsDtaum ;u0oetoioeiys s2um(ms;t0 exnircoydomD aivo t)t2uoir iodlmte fvs ()s2trxm ;t1olx mfciat m ranms;u)aexrircoo1fm   i ols0truo(o3nu1optemnvslsfa2ra(rp;u4tet moeiyt a2rm(msnt0arenmr3iodlatr u sl(0 2toxr oy4ll elfei t)artmur nt1opx  feilsla2umnmp (4alermo ta1op   n ilt)tetr(opiy1lm nmfvia()sruaxrp;u0tpe moeiytfm2uauvsnt4texomo ootomD anes;( s2um(rpou1alt lfctltfsruaxr ;t0tlenmf3iydlmDrln o;(0 exoxo3ootfa r uvs;s)t2xmxo3iu4lptnlfeils a2raum ;u0ape  ieildla rmu snt0teeoxf3oy1oaDr ivo s s2tr(r3iu1optnmfeslt s2urxm oo1tpeomfcilsfmDrmnmp t4texnxfcoa1lpDrlnvi t)srxoir ou4op nlictls  Duru ooo4aex mo3iasls el( p;u0 reomr ia1faDr u slt trum(r ny1altn fvi s  rumx p;t4oex mo3iyd aDea(monu)tlxnio ootfptr nvo;s0s2tr(rpou4opt mict s a2tauronu0aetomi3iyd m rluvo u)trtoio3oydfp r ivol( srtmxr3oo4amee ies s)s2rmxrp;o0ope  oetysfa2eluvp (4aleoxf ty1fmD auvolt sexoxo3oy1lp n icslt)srumumpnt4oeen ietaslsDelu sn(4tetomf3oodfatelivo s)trurxmpou1oltemfcta(fsrtm( onu4opt  o3iydlsDuln s u4 reoxf tydom r uvol() rur(o oy4altelfcilsfsDuaur nt1oee mf3iad s2rln onu) etoio3oo1lat aieils srur(opoo4ap n iciat)arta(mo;o1tet mf3ilsfm2ra( onu4teenif3totlpt  ues;s setr(o nudllee ncsls)a2ua( o;o1ale  iciytlsDulums u4treomr3oatfpte i slt t2urir nydlp elictlt arurumo;o4aeenmf3tatla2ul(vo u4tetoifcootlaDraueo;s0t2xmxm3iodamt lietl() Dtmur no1olxnmoeiyt aDem(vp;()artrif3tadla  lnvils setoimpiu4lm emfet ( aDrr( poo0aleomocias m2ul(vsnu) rxrxf3tydlat aieil(  2uoxopoo4am  lfvta(faDtrx oot4tptomiciaslaDulu p;t)arermf3ia1lmt  nei t0sexmio3oudlme  feiat arra(r ;o4aptnmf3ild sDum(ms;u4altrio3ta1fptrlnvo;s)t2xoxrpiu1ope  ivil(fa2rr(rooo1olx mfetydlaDumu pn(4 lxrxfctadfpt aueilt srxrxrpio1lmeelfvtasfs2rr(ro;u4tee mociatlm2eauvp t4aexrxociotfp eli o t s2urxm oydom elnviasf Dururono4apxomf3iytfa2emnvpnt0areomo oo1fptelneol()tetmiopoudlm  lfvilt) Dtmu  ;o0oetn oeilsls2rl(vo;u0aeerxr3tadoaD li o s seuoxo3nu1olen nvtl()s2umu p;u0aetnifctldlsDrm( sn(0 ltoxf oatlmDe u sls0s2tm(mpiy4ome  fesl( sDumxrp;o4apt  octyt sDua(ms u) rxnxr3oytoptrln ol(0srurxmpoodlpenlnvtl( sruaxmo;u0ape moeiad aDumump u)aetrmocia1opDelueo s)srxm(o oo1lptn fet sf rrmum ;o0openmietatfm eanms t0artoioctatlaDe i sl(0trxoxr iy4lpe  ictas s2trur nu1tex mf3tltlaDulnvo;(0alxriocoo1opt ai s;t truo(o nydlle mfcil()sDtm(  no1tpe  o3tldfs2uaumsnt0 rxoxf3tytom   nvs t t2umio3iydol   ictlt  rua(mpoo0tlenmociasls2elnmon(0 leoir iytfmDeaneo t0s2uo(m oy4ll n fvs ( a2tm(  nu4tlx miciyt mDrau sn()alxoxf todfatranei ()seuo(rpoy4lpen fcsa( arraxront1apx  i3ilslm2eanmo t)trtomfciatfp rluesl()t2uoxr no1optemnct t aDumurono1tptnio3ias s el( s t4 rtoiocoo1fpt  nvi;s) exrimpnu4lptnmnciltfsrrmu  ou0texomo3tytfs rl(von(0arxrxf oo1omDelu o;(0t2tr(r3iu4amte fei s aDra(  nt1apx  ictys aDumnmo;t4artrxo tadlptr ivo () rtmio iy1oltelicsat)srraur ot0apxoio3iat m2uanmsnt) rtnxrciy1faDelu sl( s2to(rpoo4oleemivi t  rtaxr nu1apxnmi3iad aDra(vsnu)trtnmo3oadfpDrlivilt0 exoio3iodlmee ncil(f 2taxmono1alt moeiadfm2emuvo;t)arerxf iy1fptrauvo;t)sexrxr nydom emfeslt)s2rrxmo;u4ope if3iadls2rau o;u0tlxnmr3iydlmteanvs () rumim3iu4lmen ivi (fsrrau pou0tptnmocilt s raumpnu0tetrmr3iotlmt  u s s trtmxr iu1alenmnctas) 2rmxr ot1alen oeilt a2rmu pnu0tetoirciy1optrlieo;() rxo(opio1lmtn icsl()srrr( p;o4altnmfetydfmDua(ms t4arxnmr3ty1oaDr uvsls trtmxo iudam  mfcs (f rumxr nu1oltnmi3iatfm rmuvo t4teenxocta1laDeliei;s)t2uo(r nodapte ivs tf Drr( p;u4texn o3tld mDuauvp t4tleriociadlm e n s;t  etrxmpoydopen icsas) ruaurp;o0tpx micildfm ulnvo t0 exnmfcoo1lpt  ivo t)t2trio nudlp  mieils  2rm(m ;o1tet mfciat sDem( o t0artoxf iytfaDelu s;t0srtrimpiodal elivsas)s2tmurp;o0apt mieild a2rm( snt4 rxoio oa1fp  lueo t)srxmxrpio4altemfetat  rtmu oou4oetn oeiadfa ra( o (4tltnxf tatfat aivi s0s2xm(rpny1lltemneta( s2urumono1tee iiciyd m eanvp (4aleoxr iatfmD lieol() eurim iy1al nmnvtl(  rumurono1alxn iciydfmDum( o t0aeenxrctydfmt aivo ( s2toxopou4alt lfvta()a2tauro;o0alen i3tytfa2em(mpnu)arxoxo3ty1fatrli o s truoim no1lp nmnvtl() Drax  nt1tltoifcildla uanvp;u) reoxocoadop elu s;t0t2uoxo ny4opt mictas)a2rmurpnu0ole  f3ias a em(von(0tlxoxr ty1lpD auei;s0srumxr3oodal elnvs sf 2rmurpno0tpxnmfciysfa2ea(vsnu0aetnxr3iatfm eluei s  rtmxm io1ome mici t)srumu  ;t1aetoif3iytlsDumnmp;t) lerif oydfat au i t0srto(r ou1altelieslt) Drau o;t4tex  ictysfsDumumo u)aexnmrcoo1om elieo s  euoim3oy1ope  fvs t srtaxrpou0opx iictld sDeluvp u)altoio3iodom r uvi t  rtm(rpny1olt lfvs tfs2rm(  nt0altomo3iatlaDum(mp;u4trtoxrctotfp rluei;t) rum(r3oydope  ivi (f 2trurpnu0tltn ietlt s2el(ms u4alxomocto1faDr ueo;s) rtrim3io4am   ivtl()aDua(roou1olx micils sDrln p u) rxnifciydla elnvo;()s2xoiopoy1ale miesl(  Drmurp;o1tlx ifciatfs2ea(vs t0arxnxr3oadlmD aueolt0s2xo(mpoy4llen ivsasfaDtaxr nt0aet ioetasls2ra(vp;(4texrio3ia1lateau i ( trxo(r ou4lp n ivsa()srraum ou4tltomfetys s2ulnvpn(4aeenioctodop rluvs;( trtr(m3no4opeelfei t s2trxmo;u0alt iietadfsDrl(msnt0teermr iy1lpt  iei;( srumim ny4opee nvs ( s2urxr no1opx  ictyslmDrm( s t4 lxnmrctotla  lneo;( setrxopou4altnmietas)a2rmumoot1tpx  fciasla2eauvonu)arenmo3oodla eluvs;s)texoxm3oydole lnesat s2ur(  ;u1altniietydfa2ua(mp;u)trerxo3oy1om  auvo;()t2uo(o3oy4lme livi s) rrr(mooo0oexnifcilsfaDemu snu) eeoxr iadoa eln i ()srxr(m3iu1opt licsa( artrurono4altniociysfs em(vs t4tltoiociatoaDeln i;(  2xoio3no1amtemivt (faDrmuro;o1aexo iciydfsDum( o u) exrio iytom r ivs;s0s2um(r3ny1am eliviatf rrrur ;o1tet mfcildla2ul( pnt4arxomf3io1om e uvi (0t2ur(m3iy4oltn fcils srum( pot4opt  feias a2rmu sn(4artnmr3oa1opDranes () 2tr(mpiu1olt lnviat) 2uaxrpnt4apt  fctls a2eau o t)altnif3oadop   ivo ()texm(o ny1ome lfesl(fs2rauro;t1tlx  i3iat a rmnmp (4 lxrio3tadlatr ueo ( t2tr(r3no4omt lieias)s2ur(r ;o0texn octlsfmDel( p t)alxnif oytlpt ai ols s2xoxrpoo4omt livsat aDrmx p;t1olxoiociadfmDra(mp;u4aetoif3iatomtelieol(0texrirpoydlptelfctl()sDumxmo;o0tpt moeiltfs ranvpnt0tlerifcoydfp elneilt0t2uo(o oydop nlfcsat) Dra(r ;o4alxoioeiytla el(vpn()tlxnxocoa1lpte ieils texoxopnu4alee ivsatfarrrxmonu1altnmi3iaslmDua(ms (4 rtniocty1la rai i t) etr(m3iodlm e fvsls aDumu pno1apeo octydfm el( s;t)texoxr iydop rlu slt trto(opiy1optemivs sfaDuaump;u1opt  feilsls2eau o;(4 rxnifciydlaDrlu i;t0 rtrimpou4ll nlivs t aDtrx pou4alxomi3iytfm2rlums;u4tltoxrciadfa rluvi;(0setmxopiy4altemnvi s a2ur( pot4tpeo ietat aDea(ms t4aleoxrcoydfa  auei;s)t2xrxmpiy1ll nmfcta()s2umx p;t1tpx  i3iytls2el( s;u0 eenxf oy1fpt aues s0 2tr(o iu4om  mictl()s2ra(m ;o1alenio3tlsfm2eanms u4arxnmr ia1fmt  nvs (0srto(m3oo1ole lnvtas srtruroou1aexoioeildfm2eln o t4tetrio3iodlatelnei () ruoim3iy4lpe  fciat)srrm(root4texn f3iyslaDrm(mon(0alerif3oa1fa r u sl(  exr(rpiy4omeelictatfa2tm(mo;u1aet mfeilslsDulumo;(0trxomo3tadoaD auei;s)texoxm iu1optn ncsl(f rumur ;u4aptoioeils sDua(vs (0arerxociotlmt  i i;() rumir3iy4ape lies (  Dtrx pnu0tpeoif3tydfa ulnmp t)aeeriocoa1fmD  u ils truo(r3iy1aptnmnvi (fa2ta(m ;o0aptn iciytla ua(vp u4arxrio iy1latraueils0sexmio3oo4omeelnesat  rtmxrooo4apeomoeiltfm2rmuvp;(0alxnmfctadlmte n s s trum(opnodlptnmfvtls) Drauro;u0alenif3iadfaDea(vp () leomr3iatom eaivo;(0s2xmxm3iodam nmneia( aDuaxm ;u0aetniieildls2uauvon(0teermo ia1fpte ivil( srxmim3io1am n fetatfs2rrxrpno0oeeoiociad a rauvp t0alxrmf todfmDr ieols trtrir3no1al elneta()aDum(mpot1oet mf3iadlm2umnmp t0tetoxf3iytfmtean s;( sexr(m ny1ome lieiat sDumx p;o1aex iociyd sDraumpn(4 exrmfctatfpDeaiesl( s2tmio3ny4llt  ncsas)aDraxr oo1altniictytlm elnms u4 rtnxf oa1fpD  nes;s0teur(mpiu1am   nvia()aDtmxmp;u0oeenmocils sDea( o;t)tlenxr3oodfatean i t  rxrim3iy1altemfcsl(f rua(m ;t4aeto ietatfm rln s t)alenxocootom e n o ( setmimpnydlm   neilt) Drmxm nu0olto fctysfsDel( sn(4artoifctytfmt  uvs t truo(o iydomt mivtlt)arumump;t1aee mo3ils aDelumo;t4texnxf3tytlm rauvo;s  etm(rpoudal   ncsa(  rrru pnu1texo i3taslaDum( s;() leniocoatop rliesls srtrimpny1lp  licsa( sDum(mp;u0tpxo i3tys m elnmont0 ltrmr tatfmD ln slt0 eto(rpio1aptelnes t)a2urum ;o1optnifetysla2ea(mo u0arxrmr3oo1opt  ueo;t0s2trxm3iydope lnvias sDur(mo;t4tpxoifeildlm rmumont)aeerir iytlmD  ivol() rtrirpny1lmtnlnvtltfsrta(moot4tlt  oeiatfmDrm(mpnt4 lenxo3to1fateli sl( texrim3nydomte ict ()artaump;u4apt  ociltfmDuau pnu4tltnmrciytfatrlnvo t)s2xo(rpno4lmenmfvtls a2trurpot0oleoio3tatfa ranvsn(4 lxnxf3iydfmDrai o;t)trumxm oudomtemivt tfs2um( ooo4olxnmieildlmDrau o;u) eerif tatfpDrauvsls) 2uoirpou1lpe liesls) 2rr(ro;o4tpenmo3iydla2rlumonu0tlermo todfaDeanvsl( trtrir3ny4omt mnctl(f Draumpnu0oee mfetatlmDra( o u0texrio iytopDelivo t) rurxrpiudomt  nesa()s2ua( onu1aetnii3iatfs2rlu s t) rtrmr3oydfp r iei;s0tetmim3iydopeemfeilt sDumxm oo0altnifciltlsDemu o (0tltoxfcoadopDe n o s0srxr(o iy4alt lfet sfs2rrumpoo0opxomfciyt aDrmuvs;u4tleriociatoa   uei (0tetmxrpiydamt lnctas  2tmxm ;o4teeomietlsla rauvo;u4trxrio3oy1opDeauei t  rxmxr oodomen fvia() rraumo;u1texnmo3iysfsDemu o (0aexnir to1fpte i il( srurirpno4omeelnes (farra(mo;t1tlxnif3iysfm ra(mon(4 reoio3oodoptrlu ils seuo(o3ny4optnmfcsltf Dtm( p;t0olt mo3tatfmDuauvs;(4alermr oodfm e i o;( t2urxrpou1amtelivtl(fa2uau  ou1tetn iciysfs2eanvsn() ltoxocoytfp  lnvolt teuoim3oy1omt  netatfaDrm(m no4aetnmociadfm2ea( o t0 eenmf tydom r u sls0 2tm(mpou4alt lneias)a2rruroot4ape ii3iat mDrluvo t4texomo tytoa  aivo s  rurxo3io4lm nmicta(f Dtr(rp;t1tlt  fcias m2rau o;t0aetrxf oadoatelues t)teuoiopiu4lmtnlnvtas)artau p;u1aptnmictlt sDeaumpnu0 rxnif3iy1lmD au o t)texoxrpou4op n ivs tfaDraurpno0olto oetysla umnvo;u0 rxnmf ootom eaivolt) rxoxm3ny1amenlnet ()aDrmu pno1apeomociysfa rm(msnu0teeomoctotfaDe u ils) rtm(o iu4ol nmfvsatfa2trxm ;o0tlxn feildlmDum( p ()arxrir3ia1fp rln ilt)trtm(o ou4op e fci t)s2urxmono0olt moeiys m2ul(mpn(0alermo oatlat lu i s0 exrxo oy4omeemfesl(f Drax  oo4oee mf3tldfsDrln o;(0aetrxo io1fpt ai ils)trtriopnu1op e neslt) Drrumont4aeeoif3iysfm2elnvs t0tlenxf3iadfatr uvsl( texr(r iydom n fvslt)srraxmpou0altomicildls ea(vonu) rxnio3iydfat lies s sruo(opny4llenmncil() rtaxm ;o1tpenmo3tyt s2emnvs u)treoxoctadlatran o;t0tetrir3iy1alenmfviasf 2tr(  ;u4optnii3iadla ua(mpn(4tltrmfctydoaD lueo;s) exrim3ou4al emnctlt srumxrp;u0opt if3iatfa uan snu0 rxrmo3iodop rluei t sruoio3nu4alen feias s2ra(r nu4oeto i3iys m2eau o () exrmf to1fm e neol( t2uo(mpno4omtelfcslt)srrr(  nt4oeen oeilsfm2rmuvp;u)arermrcto1lptraivol(0sexoir nodlltn fctltfaDumu pnu0tpx ii3iytfs ua(ms u0 ltoxfctadopDr iei t0teurxrpoo1lpe livtltf 2tmu  oo0tex moctaslm2eanvo;t) exrmociy1fmtr i slt0sexr(mpoy4amtnlfvslt srrmx onu4ole  oeiytfs2umnvp t0tetomoctytfmt aies s)srurxm3oy1lltnlicias  Dumxmpno4tleoiieiys sDuau s;(0areoir3io1omD anvol(0srxriopiodomenlncs tf rurxmp;u1tpe ifetytfa umnmpn(0 ltnmo tytlatelieol()t2trirpou1llt lics s a2ua(ro;t1olx  o3iatfa el(ms (0aleoio3iodfat  i i s0 2xrir3oy4lmeemfvt sfaDtmxmpno4olx moeildls elumsnt)trtoio oatfaDe i i;t0srumio ou4lpt mncslt  2ta(m nt0oetoifcilt m rmumont0 rxoiocoodlpt lnvolt0 eum(opnu1om   iet tf rrr(  ;t1tpt ifeild m2um( snt0trenxr3iy1opD  nes s)texmxo3oy4lltnmnvt (  Drrx pou1oetomoetydfs rmumo t0alerxrcoadlpD aivi;t)t2xmimpou4amen fesl( s2tmxmp;u1opxomieiadfmDul(vo (0tleoir oy1fmDelieolt s2umxmpou1lmeelnvtl(fsrur(r ;u4tleo i3iatfs2ranms;t) renxocoadoa  aneo ()setrxmpiodom nlietltfarurxrp;t4texnifcildlmDuanvp;t) reomf ia1op eanvs;(0 2um(opiudlmenmivslsfa2rax onu1tlxoiiciytla elu o u0aleomocoatoa  aies;s) etoxmpnu4alt mnes s  2rrx pnu4tpt iictytfsDeln o;t0 etoiocta1om r ivs (0 rto(r3nudlmeelies sfaDurump;t0oex mfctldfm elu sn(0arxoxocoodfmD ai olt) ruoirpoodamen nci t)s2uau  nt0tptomf3iydlmDra(vo t0texnmoctadlp  auvi;()s2trxrpio1amtemietl(faDumuront1opxoiictldfa2ra( onu0 rxomo3tatomD an o;t s2to(m oydamee ncsas)srraxm ;t4oetnmoeiytls rl(vsnt0 rxoxrciytlpt  ies s)teumxm oo1apt  ict ( sDurum ;t0oexnmociyslaDemu ont4 reoxo oatomDe n o s)setr(o3oy4oltelicta(  Dumxm nt4oet io3iadfs rlnmsn()trermfciadla  aues t0setoirpoo4omenmici tfsDuaxm ;t1tpx  fciasfm2umumpnt)altomr iadlp raieo;s0 eurxm3ou1lltnlfvt t srumxmp;o4oleoifetlsfmDuauvsnt)alxrif oy1faDe i ol(  2uoxmpoo4ol elfesl( a2rmx  nu0oltomi3iltfmDel( o (4 rxriociotop r ues s srtmxr iydll  lfeiltfaDrru  nt1alxn oeiat s2elu ont4 rtomr to1lpt auvolt)t2umxm oydlm n netl(  rurxmpnt4openmoeiat a rl( o;u0tetnmr3iotop r u s;s) rtoxopoo1ol e netasfsDtru o;o0olx ioctyt s emnvont4trermf iy1opt  u o t s2xrio nu4lpt  nvtlsf rta( oot1oltnio3iat m2ul(mon(0artnmr ia1oaD livi s  2umim3ny1apt  icia()arurumoou0olxn o3ild s umu s u0tetrxo3iatom elivolt0srto(m iu4opeemies sfarum(mpoo1apxnioctysls em(msn(4tlxnir3oytoatrlneil( trto(m ny1lm nmnciltfarrm(  ;o1aexo i3tadlsDuau o t0tetnxo tatopDeauvo;t)sexmxo oodlptemnvil()sDtr(r ou1opxomieiyd a um( s;t4tleoiocoo1lmteluvi t0srumir ny4apte icsl(  2raurpnu0teen f3iytfaDuauvont4alxoir iytlaDe u i;(0srxmiopoy1ap nmivtl(  rtrx  oo0oet ifeiyd a2ranvo t4arenxr3iotlp rluvils)t2urxm oudllee nesa( arra(r ou1alx ii3iad m ra(vp t4texnxo3to1lp elnei s0 2umio3nu4lmt mfvslsfsDraurp;u4alxoiociltfaDrlu ont4 rxnxr3ia1la  lieils)t2toxo ou1ope mfvia() 2ra(r ;u1teenio3tltla eau p (0 ltniocoa1op elnvsls) rur(rpou1om  mies ( s2raxmoot4oexn o3ilsls el(vp t)artnmf3oodla raivolt) euo(m oo4amte ieiat a2raurpot0tet  ictys s ua(mon(0aetoir to1op  lueol(0trtm(r iodlp   fviat)aruru  ;t1ope  o3ilt aDrau s u0 lxnxrctotfmte i olt srtm(rpoy1amtnmicsat) rrmxm ot1aeto i3iydfm2uan p t)alenmr iadlmD anvil() rumxrpny4opee nei t)arururo;o4oee mi3ils s2ulump (4artrxfciadlpt anes;s srumim3oo1openmfvilsfaDra(mo;t4aleoioetlt sDum(mp (0 ltnir oytopte ueil(0 exrim ny1amenlncs (fs2tmu o;o4alx  oetysla ua(msnt0arxnxf ty1fpDelies;() rtm(opiu4optelfesls  2taxm ot4oee  feilslmDelnvo t4arxrif3tatfp r uvs t s2urxmpnodaleemnvi s)aDtax  ou4open feiasfm2uau pnt) rermocia1opt lu s;s0trurimpiodll   ncsa(  Dur( pno0tlt ioeiasfaDum(vp () renifciytomDrlnvilt setmxopny1apenmfvtlsfaDrrxmp;u4oexniiciadfaDemnvpnu0tlenmo to1opte ies (  2uoxm3no4llte net ( s2rr( p;t1aee ifciyd a2rlnmp;u) exnmrciatoptrai ol(  2urimpou4ame lfcsltf Dumum nu0alxnii3iasfs2um( p (0tlerxr3oodlmte n o;t) rur(m iudllte neia(f 2rr(r nu1tpto ocilslmDum( s (0aeenmr ty1oateaivslt) exr(rpoydllt mfvtlsf rraxrooo4aptomfetys a2ua(mpnu4 renif iydoa raneo s0s2uoxo no1ope  ictasfaDtaxrpnt1tee  o3iytfa ranvo;t4tlxoif3oytlmD aivs;(0s2xm(o oy1alee ieiat)sDtauro;u4aexn feiysfs elnms t0texnxo ia1optraueo;s texoimpoo4amen icslsf rrmum nu1oexn i3iaslaDem(vonu)tlermr tadlmD  i slt s2um(mpny4oltemfesa( a2umumonu4apeo o3tys m2ulnmsnu)tetoxr oo1fpt ln o s)srxm(r iudlpt lnci ()aDurumpou1opeoifetytfa2ranvp;(4 etrmrciy1oat  uvo t  2uoirpiu1ome mfci s)a2ur(rpnu4aetomfcild sDua(ms u0texnmf3ia1lmtelnesls)sexoim nodlmenmivsas srrrumpnt4ope  feild a2el(mpnu)trxnxocoo1oatrlneo ()sexo(m3nodomtelnctlt)a2rr(ro;t4aetnmoeiysla2rmnms;u0 lenxociydoatr uvols) exmxm no1amen ieil(f 2rrx  ot4alt mfeiyd m2emums t)tetoxocoytfate ies;()tetoir3no1lm elfeiltf Dtmump;o4tle  fcils mDel( s;()texrmr iydlm rlueslt truoxm no4ape mnes t)sDum( o;t0tlto i3iad s2umuvo (4 eerifciy1fp   u ol(0s2tm(r3oy4alteliesas)a2urxroot1opxo ietad a rlnmon(4treoifciydfa  anvo;s0s2tmir3iydalt livt () 2urx  ;u0aeeoiiciydls2rmnvonu0tltomociytfm elivi;( t2uoxr3oy1am  lfeiat aDrru  oo1tleoifeiyt s elnmp;t)tetoxfcto1omDe nvolt0s2xrio3ny4aleelnesa() rrmxro;u0alxn i3tyt mDea(msn() renxo oatfmD  ivolt0 rtmxm3iy4lmee ivsasfs2tau  nt1oexnmoeild a ul( sn(0trtnmfctadlmD ai i ( sexoirpiy4lltnmnviasf 2urxr ;t4openmf3tldfs uau s (4altnxoctytopDelu sls0 2xmim oy1om  lfetat aDuru pou4ale ifciyslaDumnms;(0artnmfcootfmDeanes;s0 2tmiopoy4lptnlfvtasfaDra(moot4opxomi3iad sDel(vonu0tltoxocoa1lp  aieo t0trxr(r oy4alte fvil(fa2tru  ou1tpx  ociltla2um(mpn() rtoio iy1fp eaivolt)t2xmxmpnodal n nct (fsDta(m ;t1tlx ifeiydla rmnmp;u4trxoxf3io1faDrlneols  2tmxmpiy4am n ieia(fsDra(moot0tpeomi3tadfm rln o;t)texoxr3todfmD auei;t0trumxr oo4lmtemici sfs2umx  ;t1apt iiciatls2ulnvp (0trxnxrciydfp r iei ()srtoxopoy4lmt  ivi t) rta(  ;t1oee moeiltfm ua( on(0artrir3oytoaDr uvsls)t2urim3iu4ap  mivslt arraurpnu1oee  o3tldlaDel(mo;t0texomrcoadlatelivi s0 2tr(mpno1lleemfei t) 2rruro;t4altomoetltfa2ua(vonu)trxomocto1lm eauvi s texm(r no4lme mnvil( aDtm(monu0teto fctlsfmDuan s;t4 lxrxf iytfa raneils0 rumio3ou4ol e nvilsfsDtruronu4tpeo i3iytlm2umu o;t0texnmrciydfa r nes ()sexoxrpoo1lmenlncsl(  rraurpnt0optn oetlsla2ea(ms;t)tetrxo3iytomtr i o;t  rur(r3io1aptn fcs s aDraxm ;u0tex  fetld a2rm(vsn(4trenxrcoydfm r n i;( s2xo(mpoy4lp e nvtls sDrm(  ;t4tpe mi3iatfsDrmuvo u0 ltnxrcto1op eln o;s0t2uoxmpno1aptelfesa( s2rrumpno1tpx io3iatla2rm(mo t)tltoif iytlmD  u il(0t2xm(opoodlmen nes ()arrrx pnu0apxo fctatlm rlumsnt4tetrirctydop   ivsl() rurxrpnu1al   icsls)sDum(  ;u0tleniieiatfm rl(vp t4alxnifciadop r nvols0 2umxo io1lm  lfvta(fs2trumpno0aexnmf3iaslmDeaums;(0trxomo tytlaDelu s s  2urim iu4amt  ivs (fartmx  nt0tpxomictldfa2elnmo t4trtoxo oadlp e u o t0 exmio3ou4al n netas a2tmxm ;o1oexomfciadlmDuanvsnt4treniociotoat  uvo s) 2xoiopoudlmt lies t)srurump;t0tlxomfcilsfmDea(von(0altoxr todoaD lueil(0trxoir nu1op  mics ()sDumu  ot0oeeo ociys m uluvs;t)arxomr tydomDe ieils)trxrio oodol nlnct t arrmu  ou0oltnio3tldlaDum(mo u0treoif oytlmte u i;(0 2umxr3nydam nlnvi s aDta(ro;o4tpxn i3ilt mDel(mp u)tlxrxf3iatoateanei (0srtmxr oydlmtn feilsfa2trum nu1optnmo3iysfs2uanmo;t)arxomocio1optrai o t) rxo(o nu4am emiei ( arumx pou0teeoioeiydfm rl(mpn() exrif3oy1oa   uvslt  2um(opoy4omtelieilt)arraxm oo4tlenmoeiydlm2eluvpnu0trtrmf3iytfat  uvol( srumxmpiy4omt  ivt t aDum(mono4oetoioctld mDulnvs (4tlxnxo3oodla elnei;( t2tr(r3iy4apte fvsl() Drrurpoo4tltn oeiltls2el( onu4arxrxo3tytlm  ai o;(  rumxopiodlleemicsa()s2um(rono4teeomo3iatla em(vp;u4 rtoir3oo1opt lnes;() ruriopny1omtnmivsl()sDtax ono1olt mo3ilslsDuau ont)arenxr iadlpte i ol()truoxr ou1omtnlfesltfsDtrx pnt0olt io3iat s2rmuvsn(4tlxrxr3oydomtr u ols)srur(o nu1om  lfvsls s2uaumo;t4tetnifetasla2ulump u) etnircto1lmt  ueo s t2xoio3oudam  lfctl()s2trxmpoo1aetnmictldfs rlu p t) exrmociytlaD au s t0s2xm(m io1lm e iciat a2tax pot4tlt  iciysfa emn s t0artrio3tadoaDe ueol( trtm(r3oudlp nlnct tfs2rmurpot4tle mfctldfm elump t4tlxrxfcoa1fptr ieol()teuoxm iu1ll nlfet t)s2rr(  ;o1aet ifeilsfmDran onu)artnio tytfp rluvol() 2xmir iy1am emnvi t)s2trx p;t0apeo i3ilslm2rlnms t4tlenmr3ta1lmDeauvo s  rtoxo3oydlpee icta(farrauroou1oetnmiciysfaDrm(mp;t4altoxf3iy1oa elnesl(0teto(o3oudlm n ncsasfsDra(r no1ale ifeildfsDuluvonu4arxnmfcoo1fmD au s (0t2xoxo ny4al elfeiat sruax pot4olt ii3ias sDrln p;(4alerifctytfpDe ivi s0setm(o3iydllt  iet () ruaumpou0tltnmieils a2ulumo () eerir3tatfaDrlnvols s2xmxr3iudlleemfcils sDtrxrp;t1teeo feiytfs rau pnt0altnif3totlpDran il(0srurxm3iy4om elies s arumxmpno1aeen fctad sDra(mo;u4 rxoir ta1la  li i t0 2tm(mpnu4ope mnvsasfa2urxr nt1oetoifetldfm2ua(vp;u)artrir3totoa eaivo;s)seuoxopoy4amtnlnetat  rtr( ont4altnioeiat s2ulu p;u4 etnir tytoaD ai s;() exmimpio4op emfvtlt)arrru  ou4alxn ietlsfm2ulnvo;t0arxrmf3iodlaD luei;( sexr(m oudom emfeta()srua(moou4aleo ietld mDrmuvs;()tleomf3iadoateauei;t texrir oo1ap elneta(fartmx o;u1tltnmfciatlsDuaump (4 rtoir to1la rau ils seuoxr3io1ol n nctat  Drau poo0apen feiys a ranmon()treoir3tatopD ln ils)tetmio ny1altemivsl() Dtmx  no0tex if3iad s emnvp;(4aexnmr3oatfm rln ils srtmim3oy4ol nlncta( arurumonu0open ietatfs em(vpn() renioctytfat  nvsl( truoim no1ameemietlsfa2tmur ot1tex ifeiydla2emn snu4aeerir ty1oat anei (0texoirpnu4ale  fetl(fsrtr(rpoo4aetnmoetadlmDul(mont0 rerxr ty1oaD livsls  2umio oodome  ivi t)sDumumooo4teen o3ias s uaumo u4 ltrxrciydlaD anvolt truo(r oo4omenmncs ()arua(r ou4ope  f3tlt a ra( sn(4 renio3tadlp  lues s texrxm3oo4op   ivs s) Dumx  ;u4olen i3iltlmDeln p (4teenir tydla elies (  rxoxr3iy4openlieta(fa2trumpnt4tpe  fciatfa rlums u)trtoif3oy1op  lnei t s2xr(m3iodll  mfcsa( artrx o;t0tle io3tydfsDulump t0 lxoif3oatoat lies;s sruoiopoudlm nliesat)arta( o;u4opeoiietldfa2el( pn()arxnmfcoatfpD anes ()t2uo(opiy4ap emiciltfa2rm( ono1aeto i3tyt aDrluvp ()alxriociydlm r u o s seum(o ny4open fvi t)srtmx poo4opx mi3ias a ulumpn(0treoxr3oodfpt  i o t)srumiopoo1op  lfvia( s2trumoou1oeeo oeiyslaDelnmo;(4arenxf3oy1oaDe neo t)s2to(opno1amte ici s artrx poo1tetniociydlm ul( pnt0treoif3oo1lmt luvs (0sexo(r ou4lp elnvia() 2umumpno4ale moeiytfa raums t)tetrxrctatlmt  ivi;(  exo(r3io1ap elnvsas)srtrumo;t4alenmo3tysls ul(mo ()texrir oodfate ieol(0 2uo(o io1lm elivta()aDtrumo;u4apt mfciydfmDrmuvp;u)tetomo oatoa rlu slt0seto(opno1omte ivtasfarur(mp;u1olxnmf3iydls2elu sn(4 rtnmoctydfmteaies (  2uoxo3nudolenlici (fsrrmxrpno4apxnii3tydfmDrmnmp;()artomocta1fp rli sls0 rxmxrpnu4ape  nvils) Drm(ro;t4aptnmociat s rl(mp;u)aeerir iadom  anei ( setoxrpou1al elncsltfaDraurp;t1aee moeiydla2elnmp;(0 reoiocty1omtrai i s  rtmim3nu4olee net () 2raxmpoo1olx  ietadfs eanvp u4trxrio3iy1la raivi;t0t2xm(m ou4llt  nvi sfa2trxmpnu0tptniietasls2ua(msnt4aeermo3iodfm r u o;s)tetoxmpoy1am   fcilt) rra(moot0altn iciydfsDranmo t0alerir oa1oat aieo;s tetrxrpiodalt lneias a2ur(mpou1oexnmo3taslmDrl( s t0aetoirciotfp e uvi s0trxrio3oydlpt mnesl(fsDuau ono4apxnifciyd sDrlnvsn(4texnxr3ta1fpte uvol() 2xo(opny1omtnlncsas) Durx  ot1tlto oetatla2umnmonu)trenif tadfat lnei;t  2xm(o no4lpt mfvsls  Dumx pno1tee if3iasfm2rm(mpnu4 lxnio3io1omDeanvs t sruoxr no4ope  nvil()s2rmur ou0tetnmocils m emnvo;u)aetomf ty1lmD  uvols seuo(r3ou4olt lnesas srum(r nt1aleo iciys s2um( o u0tlenxf oy1optean ol(0s2umxo iydlmenlfvsa( a2tmx ono1optomi3iasfs rluvo;u) etrxo ootfp r ieo s setoxr3io1ll   nesat) Durxr ou1tpx  o3ias s2ul(ms u)trtoxo iytfpDe ivo t)trxoirpnydlp emfct (f rraumpot0opxoifciyt m2rl( s;u4 reomo iodlat  nvols srxr(rpoudam e neiltf 2ua(  nt4tleoiiciyt a elnvo t0aeermr3iadlaD aiei ()t2toimpnydlpt  fvils sDtmxroou1optnio3iat aDrl( snt)tlxnxocta1latr nes;( seuoxr nudal n ictasfarta( pou4oexn o3iydfs2ulnvpn(4 rtnmr3tatfp rluvs (0srxrirpiu4aptn feilsfarua(mont4tlt ii3iad aDuluvo;u)alxnmf ia1fmt  i slt trtm(rpoo4llee fesat) Dtmu  ot0aeeomfciadls2el(vsnt)artrxfciy1laDrlnvs;t s2toir3io4al e ieta()s2raxrpno4olenmfcildfmDrlnvs;u)alxnif3tadfat aivi;s)srumxo ny4omtemncias) rrm(ronu0olxomocilsfaDrl(vp;t)aeermf3ta1fmDr nes t  rtmim3nodoptnliesas artax  nu4tex  feiyd sDem(vsnu0 reoxr3iytfa r u i (0s2xo(r nudom   ivsl( aruaxrpnt1apto f3ilsfs uln s;u4tlenmr3iy1fatraies s0 rxmxmpio1oltemncils)s2raurp;o4apto oetls s emu p;u) rtoio iadlate ues s0 2triopnudlp   nciat a2rrx ono0tpt  i3tlslaDrlu s (4alxoxo3tatlmtraivs;t) exmxmpoy1ol  lfvsls)aDrm( onu4tetomi3iad aDemums;u4trerxrciodoaD aivi s texr(m3nudlp   icta()arurx poo0apxo oeiydfaDrl( o t0tltrxr3totlmD an s;t) euoim3oydap nmivi t sDtru o;o4tet ioetatfm rlu o u)tltomf3ootopteaueo;s sexo(rpio4lme  fcsls)aDtm( oou0optnmo3iltfsDranmo;(0treoxociytlmDr iei;(0t2xoxmpoy4ap emfeta( srtmxmpnu1tet mfciys mDea(vp;u)aeeomr3ia1opte ies;( srumxo3oy1oltelicsasfsDrmum oo0tpenifeiad m2rmnmo t4altnmo3iytfm  lnei;t)srurim3ou1llenmfvs () Dtaumoou1oexn o3tlsfs2umump;t4arermr iatfa r i ilt0s2umxr3no4llt mivtlt srrmu onu0oeeo o3iytfs2umuvo;(4 eermoctydlmt  nvi;()teuoxmpiy4apee fvta() 2tmx p;t0apx ii3iysla rlnmsnu0tltrmo tatfp rlnei;s  rur(m3ou1ame  ivt tfaDrax  ;t1opxo octasfsDran onu) renir iatlatrlueo s teuo(m oo4lpe mnviltfaDum(rpou0tleomoctasfm rl( o (0aexoxr tatomtelivi t0texrxopoo1ol elfvsas  2rrurp;u4tex  icildfm rlnvs u4 eenmf oo1op  aivs s  euo(opiodameeliciltfa2tmx poo1ale moeilslm2um(mpn()trxnmo3oy1fmte ivo;s) 2uoxr nodop elivt (fs2tax  ot1alt iicildfs uln onu4arxnio tadopDeauvs;t0srtrimpnu1amtnmivta(f rta(  ot4aexomf3iys s2ul(mpn(4aexrxociydoaDrluvi;( sexoir3nu4oltelivt s)srurxmpoo0tpeomfetltfaDeau pnt0teerifcty1oateaivo;()s2umirpou1omenmivtltfsDtr(r no4opt  o3ilt s ea(ms t4trtomr ia1omt  nvsls0 2xo(o3oudoleelfcilt)s2uru onu1olxoioeiytla2elnmp t)artoir oodlpDelnesls0 rxmxopoy4lp emnctasfs2rrxm ou1opxoiiciytlmDraumpnu) renmr3oodlm r i s;( trur(m oydoptnmnetatf rrmxmonu1tptoiieiytlsDumums;u4artnio3oydfaDelnei;s)trxr(rpoy1opte ncsatfs2ua(mpoo1texnii3iyd sDrl(vp u)alxoir iy1lmD  uvs;()seuo(mpiu1lmt mfct t s2um(mpou0tpt  ieiltfaDelu snu0 lxnxrcoatom ranes s0trtriopoo1altnmnct t) rtm( poo0tetomi3tatfm2rmnvp;()texnxrcia1laD  u ilt0t2tmxrpnudop  mfetltf rra(rpnt1oltnio3tld a2uanvo (4tlxnir3oatop  auvo;()s2xo(m oy1ll  mict t)s2tr(  nt4aex if3tasfa2eln o ()trenmfctatomD livslt)s2xriopou1llenmfeia()a2umxmo;o1tle iicilt m2emnmp;u0 exnmrcio1fm  lnes;s  2trio iy4lpe miesasf Duru ono0olxo i3iyt m ul(vont)texoir iy1oatrluvi s0t2tmxr oudol e iesl(farrmxmono0optnii3tat a umn o;t4 rxnmo to1fp   nes;(0t2ur(m iydom  lnet tfs2uaxront1oexnmieild m2ul(mon(4trenmr tatla eauvil(0 eurxr iy4lmtnlnci s)aDtrxm ;u0texnmietytlm2rmuvsnt)tetnxo3tatoaDe n ols  eto(rpou1omtelnet (faDuaurono0tpxo octyd sDrlnmo u0 etrir3oytfa rlnvsl(0sexmxr3ou1optemneta()s2umx onu1tleo fctydlaDuanvs;t) renif todoate n s ()srto(r iy4ap emfcta()arrrxmo;t0aex  fctydfa2eln s t4alxnmo tatfptr ivils0t2xmxm3nodam   fvilt srra(  ou4oleo ieiyd s2rm( p u4tlerxr oadop  li s;s t2xmxm no4op emfvtl( sDtaxmpot0aptn ictyd s2el(mon(0 exnif iodfm  auei;t)sexo(r oy4lptemfct sfarumxroou1alen feiydlm2em( s t)texnxfcoadfaDeanes s) rtrir3nudal   iesatfsDta(r ;u0olt mfeiysfa2ean s;(4aeermr3oodfmt ln sls srxrxmpiy4amtemfvias  rtr(  ;o4tlt ioeildfm rm(vs u) renmf iotfmte nvi t0teuoxo nu4ame  nvi s a2ur(mono0tee mieiad mDrmuvs;u)tetnmocty1om r nes t0 rtrxrpno1llee icsa(fs2rrx p;u0tetnioctydfsDrau ont0altomocoadlmteaivol()s2trir nudapt lfetl() Dtr(mp;o0oee  o3ildla2ea(vpnu0aexnxo oadfmt aivs s)trurio no1oltelnvilt)artmx pou0oex  iciyt s elumpn()trxoircio1op  ln s;t)seuo(r3io4olenlnctas)sDrr(ro;o4opt  o3iadfaDumn ont0altrifcoodfm e nvilt srumim ny4ap e fetl(  2taumpno0oleomfciad mDrluvs;t4 exnxf3ia1fmD  nvs;s) rxr(r nydamt mnetlt) Drr(rooo4tlx  ocild mDulumsnt4aexomr3totoaDe n i;t  exrxr iy1aptn ietl( srtaum oo4olx mieiyslm2eln on(0 reomo3ty1op  aies (0setoio iu1apt lfvta( srrmurpnt1oexn f3tasfs rl( s (0 leoifcoa1fa r ueilt)trum(rpou1lpte ieia(  2uru o;o1tetnmoctasla ra(mo;u)texoioctodlaDeai s s) exr(opoudopenmnvia() 2ururo;u0tpxoifeilsfaDrmu on(4aetoxo ta1omt  uvslt)sexoxm3ny4lleemfcia(fsrum(m ou0apx mocildfm2eau ont0 lxomf3iatomD anvo s s2tmimpoydaleelivils)a2ra(rpno4tpt  f3iad a2rlnmo;t)artoio3tytlm   n i (0trtoir3oydlmen fvtasf 2tm( onu1tetnmieiltlm2ulumonu4altomo iodlpte ueo;t srxm(m nu1oleelfvtl(faDtm(r oo1aexomfetad s ul(mp;u4 etrmrcta1omDeaieolt srumio3nu1ol nlies t)aruau ono4altnmo3iydlmDulnvsn()arenmf ta1lateai s;t)s2urimpoodopt mncilsf 2rru  ot0alxn iciat mDranvo u4 ltnmr3totomt anvo s)s2xrimpoy4lpt mfvtlt s2uru  ot0oee if3tltls2emnms () eerxr3oydla r u i s)t2to(mpiy4amtnlieias  Dtmu  ;o1tpxo i3iyslsDrl(mp;u0 renxf3tydlaDeanvo;()srumim iu4ap  mfci s) rrrumo;u4tptn ietys a el( o t)aetomr oatfm raies t0sexrxr nodal elicta( sDtrxrpot0aetniietasfaDumu p;u)artoxr3oytlpDeluvs;s)s2xr(o3iudal elfeilsfsrua(r nu4alx moetad m2ul(ms u0texrxf to1lmDeln o () 2umio ny1omtemnvia()srurumonu0aexoif3iad mDem(vo;()teenxo3tadoptrli i t  exoxopno4lp nmneta(faDrr( p;t1teeomf3iad m ua(vpnu4 rtnir3to1lpDeaneilt srumxopoo1omee nvsa() rtaum ;o4tlenmfeils s eau on(0treomr totfmDe iei t0t2trim iy4lltnmfei (fartm(  nt1aetnmfeiad mDumn pnt0trenif3iotfa rauvol() rxoxmpiy4alee fcslsfaDtm(mp;t0oexoiietatfa2umn o (0texoiocty1om raivo;(0 rxoim3nudapenlnctas)arum(m ;t4apxo fctysfsDuan p;t) exoxocoatlaDeau i s)srxrxr3ou1llenlnvt t)a2tmumpnt4texo f3tadfs umu p t0 lxoxf totfmt aieilt0trurxo nu1omtn fvil()artmu pot0oetnifeiydlsDrmnvpn(4trenxocoy1fmtr n o t srtoimpno4omeemnetas) rtm( p;o0tpxomf3iatfmDel(monu4 rxrmo3oydop raies (  2tmir3iu1al  mnes sfsDrrxrp;t4apxnmociltfa uanmpnu0areoxr3oodopDrlnei;(0s2ur(o no4olt  nvsasf 2tmxrpot0ape  ociadls emnmo (0artniocootfmD aivo;( trtmxr nu1oltemnvsa() rur(ro;u1oetn f3ilsfmDemnvs;t4 eenmocoadop e ieslt0srtoxm3oydolenmivslt  rtmxr ou1texniiciyd m2um(vp;(4aexrio oodfpDrlneolt) rtrxrpiy4omte nes t s2tmx  ;o4olenmo3ilsls2ea(vsn(0tetoif iodom  aieils s2xoxr oudlp   fei s  rta(mpot4apeoiieiydfa2eanvont4 etnmocootlatrlivols0 rurio3iu1optemfcslt s2umurpoo1apx iietaslm eluvon(0 ltnio ia1oatr ivo t  rxrim iy4lpee nvtasf Duaxronu0aleomo3iys s2um(mo (0 exnio3tydlatraieol(0sexoxm no4altn nvsl(  rurx p;t0opxnmi3iyt a2elumo;t0aeermo3tatfpteli i (0s2tmir oodam elnet ()s2tm(m ;u1tetn ieiad s ea( snu) lxrif3io1fmDeanvilt0 rtoxr3nu1al e nctl(farra(m oo0aleomo3tysla elumo;u0 rtoif tytfp eaivs;(  2xr(r3oo1omt  ncsat  rtrx poo0alenioetyd mDuanvp;(0trxrmr ootlpDelnvs (0tetoxr3nu1om elivi s s2taxm ;u1texnif3tydla elu s t4 rxnxfciy1opt aieo;s)s2uoxmpoy4lmeemfcsat aDrr( onu4tpxoiociltfa2emnmp (0trermfciodopteluvi;t trto(m3nu4omtn nctl( artmum nu4tleoio3tyt aDulu p;(0alxoxf3ty1lm  ai ilt0 2xoio3ou4lmt  fvs ()arur(root1opeo o3ildfs emn p;(0tetrmf3todlp e nvs t) rxoim oy1olenlnetls)sDrau  no0olenmoeiltfm ea(vp t) etomr3ta1fp eaivs;s trtr(m3nydoltnlnvsat) 2urum nu1olxoiieild sDranvpn(4aexoif ia1opDrlueols texrxo3iy4omenlfei s a2tr(r ;o4olt mo3iad s2rauvo (0teeniocootfptrauvs;t) etmxmpnydam nlieiatfsDrru  nu4tpxo octld m2ulump;u0 leoxo3oy1omtr nesl(0t2tmio ny1omen fvil(  Drrum ot0oeenmfctasfm rau o u)teeomf oodfa   i ols) rtoxm3oy4omeemfesa(  rur( p;o1oltoiicildfa2rln pn() lenxr3totfmt li i;s trxm(o nudomtelneiat)artr(mooo0alt ioetltfaDrmu onu)aeerircoy1fm rauvs t0tetmir iydap nmnetat) Dua(mpoo1oleo fciyd mDra(vp t) rtrmo3oytla eau o;(0teuo(m nodamtemivtat) Duaurp;t1oexomociatfa2rln p t4 exomo oadfatrlivilt texrxm3oo4ol nlivias srrmxrpno1tex mictysls emnvs u) ltnxo oytlat  uvo t0s2toiopiu4llt  fvias)sDrru ooo4tetnio3iys m2ua( on(0trtnifctytfaDr n s (0t2uoxr3no1op elfes sfs2ur(ro;t1tetn o3iys mDumumo;(0arxrir3oatlptr n s ( srurxo3ny4ame mnvslt aDrrum nt4tleomiciadfm rmu s;(4 etrxf3oo1fpteluvo (0teurimpnu1omt mfvias s2rrxronu4ole if3tyd m2rmumo;u)trxoir3tydlmte nvs;t)s2tm(o3oudlp nlnei t)srtr(r ;u0olxn iciltfmDrmump (4alenxf ta1fm  li sl(0setrxrpoo1apenmnesl()a2uau  nu1oltn ietld s ea( p;t0 etrmo3tytfmDr ues;s0trtmxmpno4olt  ics (f rum( pnt0tlxoiociysfsDea(vo;(0 renmrcoatomD an sls0t2trimpnudlpe  nvsatfsDurx  ;t0tlt ifciytls ua(vpnu0arerxr oo1omDeliei t) eurxopiu4omtnmnvt ()srrax p;t1ole mociasfsDum(ms;() etomf iydopDrluei;t)s2uoxm nudapenmncils srrmxmpou0tlx  fciatfm2eln pnu4altrmo oa1lpDeanesl()trtrxm nu1optn ieil( aDtax  nt1apxo iciltfaDumnvont0arerir todlmt lieo;t trxrxo iodoptnlnesat)artaumonu0apt iietydlm2ulnvs u)arxomociotop rln s;t sexrxr3io1am emivta( artmumonu4olx miciyt s uan o t0trtoxoctodoaDe nvilt  2umxr iodame livsltf rumumpou4teeniicias a rmu s;u) lxrxr oa1fmtrlu i;s) 2to(r3io4lme  ivtas aDta( ooo0opxn o3tldfsDua(vonu)treoir3oo1op r ieslt sruo(o3nodalenmnvi ()srtrx pnu0alxoifeiatfs emuvo;t)trtnxrcootoa eai s;t0 rur(opio4omeemnci t) rtruroou4apxoiietatfsDeluvpnt) rtoif ootlptr nes t)t2xmirpny4al  liviat srrrxmpoo0tee ioeiatlsDrmnmsnu0 ltnir oy1lm e u o ()trtrxo iy1lmt livil(  2ur(rpnu1tpxn fctltfs um( s;u0arxrmf ia1fpDeauesl()setoxr nu1ol elnvsasf rtr( ooo4tlt mietydfm2emumon()aeenxrctatom eluvs;t)teto(opou1olt lfvtltf Drr(mpno1apxoii3tytfa2eln snt) ltoxo3todopte ivolt) 2xm(m3nodlm nliet ( arumxr ;o1olen fctydla2um( s;u)aleoxr3totfptelu ols0 2toxr3io4lpe lneta(  rrax p;u1ale  fciat s uaumont4tlxoxo tadla rlivo t)truoio3oudol  lict s)a2ur(rono0tlxnif3iyd s2uaums;t0trtoifctodfpte ivo t) exrxm iu4ap n fes t  rumurpou1opxo fciltlsDeaump u0altnxo io1la ran o () rtmiopiu1lp  licsa(  2rrxmp;u1opt  o3iatfs umu p;t) rtrioctytfaD  neo (0truoim3io1ol elnetl()s2rmurpno1aexnmo3ildlsDum( o t) etnmocootlatraies;s) 2xrio oodop nmietls  Dtm(monu4texomf3iadfs2rmu p;(4 eenxf iatoaDraneo t0 2trxrpnu1ameelieils sDtrxmp;o1ape io3iasfmDulumon(0trtnmr3tadfa raneol(0s2ur(r3ny1al nmnvi () rtm(r nu4tleomfctas s2ea( pn()teenxo3oydlate u sls) exo(o3no4altn nci tfaDrmx pou0aet io3iys a2rmums u0trtnmo oy1opDrauvsl( srxoim3oy1ap   ivtl(f rtau o;t4tpt moeiyd a uau p t4texriocoytop r n s;(0 2uriopiy1altelietasf Drmx p;u1opeoiieias mDrl( snt)aeenif3iydoatr ues;s) rum(o3io1ll nmfvilsfsrum( pnu0alxn icilt sDrl(mo;t4aleoif to1fpDrluvs ()s2uo(mpoudlp e fei t) Dta(m ou1tpe if3ildfa2uanvp;u0aexoxfcoytla ranvo (0srtoim nu1olt mfes ()arrrxm nt1tleomo3tyslm2em( pnt)tltnmf3iodopD anei s sexoimpno1amt lnvi ( sDururoot1oleomociytfa2rmnvonu4alxrxoctotlaDe n slt0texmxr iy1lp elfcsat)sDtrxm no1tpt  i3tasfmDumu p t4arxomr iy1oatrluvi s)t2to(m oodol  mfcs t  2rmxmpot0apxo i3iyt mDulnmp;(4tltoioctadlpt livi;()t2tmio3oodalt mnvil( s2ta( p;o1aeenmo3tlsla2ul(vpnu0altnxf iodfptelnes;s  2toim no4amt  ieias) rrr(ront0apenmi3tat sDrm(vsnt0 rtrirctydfm  an i ()tetrir3nydoltnlneiatfaDtrxm ;t0teto o3tat a rl(mo;t4tleoircoo1fpDr uei;(0s2xo(rpiy4ol nlivsls  2rmu ont1tpeo fetlsfa2umnmp;t4 eerio3tydla rlnvs;t0texoxm oo4apte fesltfsDtm( o;u0alenmfctad m2ulump;u4 lxrxfctytoa   ivi t)s2toir ou4ame lnvtlsfaDtauronu4opx mociltfsDum(msn(4 ltnmr3ootomt  ivi t t2xrxmpio4omt lnvtat  2umxrp;o0oleoiictatlsDuauvo;t4 etnio3oytopDrlu i;(  rxr(mpnudap e fvta(  Drmxr ou4olxnio3tyd s2umnvo t4teenio io1laDeaivs t  2xr(opnudopeemfvil() rtaumpnt0tpx ii3tltfs2rlnmsnt4arermf3iy1oaDr uvo t t2xoxr iudom e nvta( artr(mo;u0ale ii3iaslm eauvs;u4artnmr3ia1lptelueils t2tmiopiodope  ict tfartmx  no4oet miciltfs ea( snu4teeoxr3iydfm e n s t srtmxo3io1lmtelfvtat) 2trxrpot0teenmoctad aDuanmp u0trxoxo3oo1oaDran sls  exrxrpnu4open fct t) ruru onu4alt mi3iltlaDrln p u4 exrxo iatoatelues;s)s2uoxrpiy4ope  nci s a2raxro;u4ole iictaslsDrln pnu)aetnif tydlmDelueo;()seto(opoodll   fvta()a2uaum nt4tlx mi3ilt a rauvs;t4trtrxr3iydfmDeln s s0t2umxm3iu4ole lncsl(  rtaxmpnu0tle  f3iyd a ra(vsnt4alxnmfcia1omteauvo t)sexr(opiydlp emfvias)sDtrx pno1olx miciys m2umn s (4 rtoiociadomDe ues;t s2xrio oudap elivslt s2rm(mpnu4altnmiciydlm elnvp;u)aetoxo oatoatrlnvi;(0t2uo(r nodllenlfvi t  rraum ;t0ope iieiasfs2ranvs;t4areoio3tydopDeaueslt0tetoim3io1lp e iet s aruauro;t4aeeoii3iytfm2emuvpn()artomf3iodom   u s;t0trto(o3iy1ll n ictas sDum(mono0olto feiysfm2eanvs;t)aeerir to1fa  anvo;t t2trxm3iudllenliet ()a2taxrp;u1tpxnmoeiysfm eln snu)alxrmo ia1oa   ivils0srxo(r3ou4am  mfesa(  Dtrum nu1open i3iatlsDranvp;t) ltrmf io1latrauei t)trtmiopoodomtemneils)sDrax p;u1aet  fetltla2eaumonu0tlenif3ootopD  nvo t sexm(o io1lptelnet () 2rrur nu4olx  oeilt m2ul( onu0alxoifciatfm eai i;s)t2xo(m no4olen fcsa(  rra( p;t0oex iicils mDuluvont0teenxrciydfaD liesl(0t2xrir oo4optn fetl( arua(mpot4olt mi3tys a umnms (0 exnir3oo1op eluvi;s0texmxo3nodomtnmfvslt) Dur(rp;u1tleomi3iltfm2rm(vp;t0aeerxr oo1latr n ols0texoim3io1omt  ivtl(fsDtm(moou4oetomo3iad m2eauvp;t) etnifcto1opt aueslt t2urio iu1olte icslt) Dtmu o;t0ale  fetlsls rln pn(4trenmf oodomteluvs (  rxo(o3oodlp e nes s  Drr( p;t4olxn ieias s2eanmo t4aetrmf oodfmtraivi;s) 2xm(o nodomen ivilt s2tm( pot0alxnmf3iys sDumu p;t0trtrxfciotomDeln slt  2uoxr iydam  mfesltf rtax  ;u4tpx  feildfm uanvpn(0tltnio3iadfateln s t0sexo(m3io4amte fesas srrm(mono4alx mfciltlmDeanvo;(4 rtnmo3iotoat  ivilt0t2um(m ny1ome lneil(fsrtrxr ;u0aexomoeildlm rm(vo;u0areoxr3iotopt  neo;t)seuoxm nu4am nmneils  rurx onu1oexomfetltfs ea(mo;u)aeerxr ia1op  ai o;s)sruoiopio1lptn ivslt)s2umumpno1tetn ieilsla2umumpn(0tltnxf3tydlaDr ieslt0s2xoxr3no1apeelfvslt  2rax pno0texnif3taslm ul(vpnt)areoifcoydlm  an i;(0t2uoxm3iudlm  mivs ( s2rmum nt4olx ifciys aDrmu s;u4teerxo3tadoaD lies ( srto(mpoudoltnmicta(fs2ur(  no1apeo octytlsDrmu s u0 etrmr ootlmtelivils srxoim oodamte fesat a2umx pnu0tetomfetlt aDul( o t4 rxnmrcio1faDran o s)setr(mpnodlp nmneia( aDrmu  nu1tlenmiciyt s2umump;(0 eerir tadfatran ols trxrxmpno4lptnlicsa( srum(rp;t0openiietytfs2ra( sn(0texnxo3iatomteauvi;t0 rxm(opoydlle  icil( a2umur nu1optoiociasfsDrmu pn(4aexoif iytfaD  nvs;s  rtmiopoo4ome  nes s  rtmxroot1opxnmfctatlm2emumonu)tlenmo3ta1fm r ivols0trxmirpiudlltnmictat arrmumpou0tex mo3ildla2umums;t0 etrif iatlmt luvo;t)t2xo(opio4ol emnetl()a2tr(ro;u4tlenmoeiad s2em(vo;t4aeermo oa1lpDeln s;s0setrim3oo1aptemfvtas  Dtmx  ou4optoioeilsls2eaumo;u) lxnio3todfmt  uvs () eumir iydoltn ieilt)a2urxm ou1olx if3iadfmDrmuvonu)aexnxr3iytfpDeaneo;s)trxo(mpou1apte fvi s srumx  nt0aeen fetls a rmu s;t)artnxo3ty1lp e ivo;s)trxrxopno1apeemfcs t aDrr(r ;t0altnmfetld a rm(mpnt0 exnir3ta1om rluvsls)s2tmimpnodam nlfvtlt srtrum no1apt micilsfm2el( p (4altrxr3oatopDe nvs t0trtmimpiudlpte nctl(  Drmxr ot4aexn iciltfmDulu sn(4artrxr3totoa ranes t0setmxo ny1lp nmneta()sDuax p;o4alto i3tld s eln pnu) lxriocoodomtr n olt srxm(opnodllenlictatfsDurxmooo1oexo f3iatlm rluvp u0artnmo3iatlp eluvi s) rtoim3oudomen iet ()sDtau  nu0tlx ifeiyd m ul(mp t) etnmr ta1optraiei t  eumir oo1llenlfesl() Dta(ro;t0aex ifciat m ua(msnt)aeeoxociadfaDeanvs t0srtmxr nydop e feils)arraxr ou0aetnii3ilsfa2um( snu0trtoio to1lpt lnes t)trxo(r3ou4omenmfcs s srtrxmont0apeniieiltlm umnvs;(4artnmoctydomtrliei;s s2xmir io1lp e ieslt a2rr(moot4oltomo3iys aDemnmo;u0 rxrmf3iatlp eaivi (0srtr(o3io4op e fciasfsrraxroot0tpt mf3ild sDuanvp (0texnir oo1faDeli ols)seuo(m3ou4ap nmfei sf 2ur(m ot4tleomieiltfm rmn sn(0artoxf3ty1fate ieol()t2xmio nudamte nci s)sDur(m ;o0oetn iciltfa emu ont)tetomrctydlmD livi t setrxm3io1lp nmncsasf Drrur nt0alt io3iltfsDrau o (4 eenmociy1lpD lneslt0s2um(opiodol e ivtls) rtauroot0aptniictltfs2el(vp u)aexrxo oa1laD  ivo (0trumxr iodllenlivi t  2rmu p;o1teen fciysfs em(ms;u4texomr tytlm eaivi s)s2toim nudame mfvta() rrmuronu1olenifctyt m el( snu4 etnmr iotfat anes t) 2toir ou1ameelfctl(fs2taxro;u1opeomocilslm2ua(vs t0teerio3todoaDr i slt)setm(mpny1am nlncs ( sDumxrp;o4tet  feiasfm ua( s;u)altoxr tytom eaneo t)t2xmxm ou4optemfeta(  Dua( pot0oet  ictyt sDeluvo ()texoif3iy1lmtelnvsl(  2umimpnudole mnvias aDrmxrpnu1tpt  f3iysfm rln snt4 lxrmo3ty1omDe n o s0srum(r iy1ope mnvilt sruau oot1aexnio3ils m2rm(ms t0aexrxf iydlmDr n il( seuo(r3oy4amenlici sfsrtax p;t4teeo f3iys a2rl(vo;()alxoircootlatr uei;t t2xoxr3oy1ll emfci tfaDtax ont4tleo oeiydlmDelums (4teeoxocootfate nvslt0 euoxm oo1ameelnesa( srtmxrpnt0aexomiciydls2raumsnu)alerio3iytfptraivi;(  rtoxo3iy4amte ncslt  2urx  no0apxomfeiys m ua(vs;u0tltrio3ootlm eluvs;(  exoxr no1op n nctlt)a2ur( ont1tpxo ociys s2eln pnu0tlxoxr ty1lm e ieo () etm(m3oodole mfvta(fs2uaxroot4apenifctatfsDranvo t4tltoir iotla rlnvo;( seuoxr3iudoltemnctl( aDrau p;u1opx  iciasfa2ra( pn(4alxomr3tytfp  livolt  2xr(m nudomee ieilsf 2rmxr ;t4alen fciadfa rmu o (4 exnir3io1lpDe uvslt  etrxr3ou1ole  ivi ()aDtrurpoo4tlenmfctlt s uln o;()alxriocoo1fm raieil(0 2toio3io4om  miei ()s2trxm nu4texo oeias mDea( p () etrmf to1oa e i sl( s2tm(opiy1llt lfctat sDumxrpoo4opxoiieiasls um(vp (0artoxo iadom e neols tetrxm3iu4lptelncsl(f 2ua( pnu1tlxniociytfs2ranmo (4tlxrxo iodop eauvo (0tetrir oudlp emieslt srrmum oo1opxoifcildfm rl(mp;u)artnxo3oo1fat  u o s sexmxr3ny1apen nvsa()arrru poo4aetomfciadlm ua(vp;(0alxoio3oytlmD li olt0sruoiopiudam  lnvslsfsrururpnt0aee  ociatfa2eau o;u0artnxo oodlmte ivo;s0trtr(rpiu4ope micslt  2tr(mo;u1texoif3iltfa em(vsn()teeriocio1oaDraueil( sruoxm ou1am  miei ()s2uauront1tlto feiysla uauvpnu4alenircto1opteaies t sexm(o iodlmenmneta( s2tau  ou4tpe moetls aDul(mp;() lenir3oatoaD auvi;s) rtmio3no1lpt lfcsasfs2rmumpou4teeomf3ias a2emnvo u0tlxnif3oytomteln i ( trxo(m iu4op emiesl( arrau oou1opt mo3ias s rm( o;u4areomr3ia1lp eanvs t  rtmxo oudame lfcs sf 2rrxr ;u1ole  ieiydlaDranms t)arxomr3ootlate ies t0 2xmxo nodamte nvilsfsDta( pot4alxnif3ias m ul(ms (4tlxrir ta1oateanes s0t2xoir3iodlp nmnct s  2ta(r oo0teeo octld m umuvont4tlerxrcoytla   i i (  eur(o iudlpe lfci t)arrm( ooo0olenmieiadfa ul(vsnu) ltrmrcoy1fa r u o;s  etrxmpnu4apt  feil(  2tr(  ;o0teenmi3tysfs ea(mp;t4trermo iodfmD luvo t0tetriopny1amenlnesasfs2tmx  ;u1aet  fciysfsDelnmsn()trtrirciy1lp   uvo;t0 euoir ny4lle mictls s2tau o;u1tleomi3iyslm2emn p;t4 rerxr3ootfa ranvs t)teuo(m iy4lpeelfetas sDumurpno0tet  f3iysls2rl(vonu0 etrxocia1lpDranvsls  eum(r iudom e fet tfaDtmumono0aex iictlt a emu o (0 eeoif iytoa  liei (0setrxo no4aptelncils)artrx pnu4olen iciltla2emuvp;(4 rerxfcoytfpt  uvi;( setrxm3ou4lptnlietat)a2urxront0teeomf3ildla2um(vp u4altrxr3iotopDr uvols t2tmio ny4lm   fcs sfa2ta( poo4alxnmi3ild mDraums u4 rtoxf3todlaDrauvo t seum(m iu4lleelivi t  2rrump;t0opxo f3iatfaDua( s (0tlenmr3tydlm   nvol()seuo(r3nydap nmnes tf Dtm(r nu0aptomoetlt s emu p (4arxrir3oadlm  liesl()t2uoxr nu1amtn fvtat sDum(  ;t0ale  o3iltfm em(ms;u)altnircoydlm  aneslt0s2xrxr3iydop nmfviat sDtr(r ;u0aexnmi3ilsfa uln sn(4tltrmfctydlmD auvol(0srurxo3iudlp e ncil() 2trxm ;t0oetnifctld a2ua(mp t)aeeoir to1oat  neol() rtoxopnydap e fct ( s2umx pou0tlx ioeiadlsDra( o;t) reomfcoydopD aueil( t2tm(r3nu4lm n fcs () rururp;o1opxn feias a umuvsnt4aleoxfcio1lptelneols)srtm(opno1lp nmfeil(f 2rmx pnt1tpxn ietysfmDumnvonu) reoif iodlmDeluvs;t) 2urio iodom nmnct tfsDuru pot4optn iciad s2el(vpn()trxomociy1lmteai i s0 exrxmpiydll   ivtls sDrrxrpno4tee mfciat sDrmuvsn(0 lenmf oadlmD ai i t0t2xrxo iy1al elnesl(faruaum oo0tptnmiciaslaDrl( o;u0 rtomo totop eliei;(0t2xrxo no1apt lnvi t)arumu  nu1alx iietlslm2el( p (4 etnxf tatlaDranvi s tetmxo3ny1lleelnei t s2tax ono4tpeo f3ilsfs2uaumpnu)aetoxo oydlp   uvs s  2uo(o3oudamee neiltfarumxm ot4apeoiictat m2ulums;u4trtrir iytomtrau o s tetr(m3iodaltn nvtat)aDtmxr ;t0teeomo3iydls um(monu4 rtoxocty1oa   nei;t0srxm(m ou4omtnlnei sfaDuaump;t0apx ifctytfm umu snt0trenxr iadlat ln ol( tetrir3iydoptnlncia(fsrurxmpnt0alxn ieiltfs2rlu s u) rtoir ootfpDr i ols)srtoir3ny4op  mncsls) 2raum ;u4oltomiciadla2em(mp u4aetnmrctodlateaneslt trxo(o3nu4ol emicsa(  2tmu o;u0aexomfeiysla2emnvsnt0 lenmo iatlpDrau s;t) 2trim3nydlme lfcilt)a2rrumo;u0altn i3iyt s2eluvo t)artrmocta1lmt lnes t srxrxr3iu1ome  feta()srrmur nu1aeto f3iasfs2uauvp t4areoxr3oydlpDrlivols s2xmxmpou4lptnmfvtl( a2um(moou0alxn o3iaslaDemnms;()arerxo tytlmtelieolt0t2xm(r oudal  micslt aDrr(mpno1aetomietasfa el(vonu0tlermfcoo1op  lneils0s2xr(opnodamte fes s) Dtaump;t0tlt mociltfs2ul( s (4 rxomr3ty1fpDr uvi;t setmir3iudlp nlies (f Dum(rooo0open ieiasfm elu s (0 renio oydfp rlnvi;s srurir iodlle  nvtlsfsrumum ;t0aptnmo3iysfaDemn pnt)alxnmr3oo1la r u ol(  2um(o3nudlpenlnvtl( aruauront0oeenifeiytfsDranmonu4 rxoxf oo1lp  ln s (0trum(o ou1om emnvia(  rrmxrpoo0ole  feiatlsDul(vsn(4arxnxf3oa1opDrau o;t t2xrimpoudale  icta(fsDurumoou4tlxnmfeias s2rluvp;u4trxnmr3tydom elu sls0trtrio oo4alt  netl(  rumu  no1openmiciasfm2emuvonu4trtoxr totop raieo;t truo(m iudolt lfetas) rtmurpot4aexomi3iasfsDemu ont0altrxfcootfpDraivs;( seum(opoy1ap emicsat)aDtrump;u0apx iieiat m rmums ()trtrirctodomtelnes;s  rxo(o3iy1opeemicias srrrump;o0oleniociydfaDumumo t0tltnxo ootoatrlivil( s2tmiopnudlp elicils) rrrum no4tetomoetytfm2rmnvo;u0 eenxrciydfaDeauei (0 rxrio iu1ome mnvsas arrrurpoo4tpxnifctydfs2umnms t4 etrmo3iy1opte uvi;s0srtmim iy4llenlicsls arumxmpot4oeenioctltlmDem( on() lxoxr oy1lpD aivi;( t2uoir iy1omtelnei s) 2rmx  nu0altniociadlm um(mo;t4 rtrmrciytfpDr nvolt)setoxm nodoltelnciat) 2tm( onu0aptomfciydls2rmnvo;u0 rtnirciydomt  ivols s2urxo3iodom e nvs s sDtaum no1aptomo3iatfaDran o t)altnifcoadomtraivs;()teurxr nydop n ictatfa2ta(rp;t1oee iicildfmDrmumsnt4 etrio iadfmDr uvolt)s2umim3nodlmen icslt a2tmur nt0aetn feiydfmDel(vo;()arxrmr3ta1opDeluvs;s)srtoxm3oudoltnlfvtas) Durxm oo4apenifciyt sDrl( pnt) ltoxr3oa1lpDraneo s0s2xmir3nydlpt  ivils)aDrmuroou0opx  f3tlslaDumnms u4alxrmf tydomtran o t trxm(mpou4aleelictlt sDrru  no1tleomi3iyd a2emuvp;u0trtrifcoatlpt ai ol()t2xrim io1alenmfet s s2rm(r nu4aexoiociatla2rluvp (4arenxocoytlmD lieil() 2toiopoudolenlnct s) rtax pno4optnmf3iad m ea( s;(0alxnmf oydoaDr ues (0srxr(o3oo1ol emncslt aDrrur ou4opxnio3iys s2emumpnt0artnmr3iodoatelivsls0t2uoirpio1lpee fcilt  2ta( pnu4oee  fctatfs2em(msnu) lenxr iatlmte nesl(  2toim3nu1altelnetl( arur(rpot0tpe ifeiytla2elums u0trtoxf3iy1lp raiei;s  2to(r oodll  livia(  Dtaxmonu1tlen fctat m eanmp (4aexrmocty1lmDrluvilt trxmir3iu1ap  lfct tf 2tmur oo0ale ioetlt m um( snu4teeoxoctadlp e ieol()teum(opoy4lptnmfcslt  Dtrxmp;t0tpeo icias mDra( s;t0tltoircto1laDran sl( s2umio3oydop  lfvtat arrr(ronu4tpxoioeilsfaDeau s;(0 rtoio3oatla  lies t0s2trxr io4lpt  nci s)a2ua(m no4olto ieiaslmDuan on() exomfcto1fm rlueil()t2uriopou4apeemiciat s2ta(r ;u0tpxo fcils a2ranvo t)trtrxo3iadfpDeauvo () etrimpoy4ll   ict s)s2raxrp;o4opeomieiasfs2eauvp (0teenircoatopteluvs t0 rxm(mpoydale lnvi s sruaurp;o4oeeo ieiydlmDrmnvo;t)texnif3oo1lateau o t  2xmim iy4lleelfeias artr(mpno0open octadlaDemnmpnt0arxrir oa1lmDeli s;(  2xr(r3oudll nlnetasfsrumxmono4optn oetasla2em(vo;u0altnmo oatfateaneo s0 ruoim3nodlme lfvsasfsDrmx  nu1opeoio3tltfmDel( p u4arermf iy1oateaies;(0setriopnu4optelncta( srrmumpnt0tlenmf3iatls2ra(mont4 exoxo3iadfaD aneilt trxrxmpiu1om n fvsa() rta(mo;o0aeen f3tlslsDel(mo t4alxnir oa1fptr u ols) 2uoio3oydlleemncsatfsDum(r nt1tex ioeiat m ulu snu4artnirctotom r uvs;(0 2urirpiy4lp  licilt)a2rm(m oo1tle  o3iyd m2umnmp t4trxnmfctytlmD  uvil()seumxo nu4opte ivia(farumu pot1aeeomf3iat s emuvs (0aeerxocty1fp rlneols0 rxmxrpio4al n nvs t)artmum ;u1apxnioeiydls el(mo;u0teeoxociotlmt  iei;t s2xrxr ou1amen 
\ No newline at end of file
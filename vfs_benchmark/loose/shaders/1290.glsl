@@ -0,0 +1 @@
+ivo;t) eurxr oo4optnlnvsl()sDumumpno1apxoii3tysls2el(mp;t4 etnmf iatom  lues s)t2xriopnodlmt mncs t)a2rmxmono0aptoifcildfm2rau p;u4aexniociotfpt  ieo;t0tetmio3oo4oltemivils)srra(roou4optn iciytfs em(mpn(0 eerif3oa1fmD  ivol( trtmir3ou1omenmfvils a2trurpou4oetniiciydfa2umu o t0tltrio iotop eln i s0 rtr(m iodame mivi t) rtaxmp;u4olt ii3tytla2umu s t)trxrxrcoodfptr i s;t0srtm(m3oudamt mfcsls)aDrm( p;t0tpto ocias m rauvs t4texnif ty1lm elueo;( texmir3oo1llt licta(fsDuax  ot1tee  ictytlaDelums (0trermo io1fp rliesl(0sexo(mpny1olte ncsasf rraxmo;t1olxo ieilt s2umn pnu4 exriociy1laD au s ( seum(opoy4op n nes s)aDtr(mp;u4aeen o3iad s2rln o;(0 exomr tadoaD  ivol( s2xo(o nodlpenlivilsf rrr(  nu0tptnmoeilsfaDul( p;u) reoifctadlatraivi;s)tetrxo iydame mncs ( a2rrxronu4apenifctldla ea( ont0arermrcoadom eai i ()s2tm(r iudapeemnesas)sDtax o;o0alxnio3ilsls em(vsn(0tlxoxrciytoa e ueilt)setoio no4lmt  icsls a2rauronu4texnif3tasfm ulu s u0aleoxf ootlp rlneols  rxm(o3iodopt  icslt sDrmuro;o4altoii3ilt aDumnvo (4arxrmf3tadfp eln i;t  2uoimpno4ll e feta() rumu  ;u0aexn ietyd m rluvs u0tltnmf todlaDeluvi;( seuoirpoy4lp nlivtlt arraumpnt0aeto fcildfa2rmuvpnt0trerif3tytom   ivsls0seuoxo3oy4omt  fcsatf 2raxm ot4oeenii3tatfs um(mpnt0arxoircoodoatrlues;s0sexmim3ny4llenlieiat  Draxrp;o0oltnio3ils s2uau onu4trenmf3iotlatrai o;() etr(r3ny1lpeemnvs s s2urx  oo4alxnmieiysfs2ran o;(4 rxoxf3oadomDe ivo;(0 etoxm ny4ll e nvs (f 2rmxm no1tltnii3tld m2emn s t4 reomo oydopDeaivs;s0 rtoir iy4om  mfcias) Durx pot1tlxn feias aDem( on()trxnif oadfpteauvo s)sexrxmpno4lmenmnvia( sDururpot4apxnmfetyd m uln sn(0 ltnmf ia1oate ieo;t) ruoxrpoo4omtemncia() rtmum nt0apeoif3iltfsDem(ms;u0aeerxfcoy1fptrlivo;t) 2urxr3oydlp e ics () 2rr(moou0oexoiietad aDua( pn() rerio oydlm  aies;s)trxoxopno4ame liei t aDrrx oou1tex  ieiyd s ua( o;()aetnmf ia1lptrli i ( tetrim3oo4amt licsls aDrru ont1aleniiciltls eauvs (4 exrifcta1lm eai i t)s2urxopnu4ll nlies s sDraurpou0oetomietasfmDemuvonu4teerxo3tydop elieol(0seurxo nydom elfciltfaDumxro;u0texomo3ild mDelnvo;t)texomfcio1fptr ues;t)s2ur(mpio4ame mnvsls)s2uaxmp;u1olxnmiciydfsDra( onu0tlenmocoo1lpte ivs ()trtr(o3iy4lmte ics t) Duru ooo4alxnmf3iaslsDrm(ms;t4aetrxfcootlpt lneil(0 rxm(r3ou4lpe lfci (f rurxro;u0tlt ii3iyd m2um(ms ()altrmrctotlmD livo () eumim iu4lmtn ivi (f Dtr(mp;u4alxn octyd s rmnmont0 ltnxr iatfa r nvilt)s2xm(o3oodlleelivs (fa2trum ;t4oltn iciatfmDelu pnu0 rtnxf oadfpDeauei;t) rto(opnudole mnvslsf rumxr nu1tetnif3ias s2um( p u0tlermfcootlm  lnes t s2xm(r3nodomtn iei sfs2ur( poo0ape  fcildls ea(ms (4teeoio3ia1lmteau ilt)teuo(m3no4al n ieilt)a2raxmp;t4ole  fctyslaDuanmp (4tltnxf3ty1lm e ies;(  rxrir io4ll emneiatfarumx  ;u0alto feiadfsDrlumsnu4 eeoxr3oatlatran olt t2tmxo3iy4om  lfes t)artr( pnt1aetnii3iydlm2uauvo () lxniocoa1fmtr uvi;s0srurim oy1omenlfct s a2um(ro;o1tptnmf3ildfmDuluvonu)trerircio1fatr u sl(0t2xrim3oudol e nctasf rrrum oo4apenmiciyt sDeln onu4aexomfcia1oaDeanei t seum(mpoo4om  lfei (f Dta(mp;o0oetn o3iytlsDel(vs;()arerxf ootfatrln sl(0trtrxo3iy1ole lneias)a2tmumoot1aexnifciydls2el( s u4aeenio todlmt luvi ( teurio oy1lmeemfctl(  2uaurooo0tptn fetlsfs ra(msn()tlenmocio1fp e nvo;(0srtm(r oy4lme mnci tfsrrr(moou1oeeo ieils m eanmo () rxoxr ia1lpDr uvo ()sruoxm3oodamenmivias srum(root0apx ioeias sDrau o;t4 exoiocoytlp  anes t)texrim3oy4amtnlfcslsfs2rru pou1olxoii3ilslm2ranmo;t4 ltnmr3iatlpD aues;t0srto(m nydap emietl()arra(ro;t4aeeomieiadfs um(mp t4artoiociydfat aivslt)s2uoxo3oudllt lncs ( a2urx  ot1tptnifcild a eanvonu)aeenxocoadlmDeaiei;s) rurxr ny1lmtnmneslt  rtm(mont1oeeo f3iatfaDra(vont4arenio3ootlateau i t)s2toim nydome  ietls)arrm(mo;o4tlt mf3tat sDuan o;t)texrir ty1omtrliei;( t2uoxmpno1ol elnesa(fsDumxrpou1aetnmfciys s2rl(mo u0 eerirctotfpDeli i;(0 rurio3oydomtelfes sfsrtm(m ot0tpeomoctyt a2elumon()artrirciodfaDrai o t0s2tm(rpnu1op n nciat  rrrumo;u0tle mfeiyslm rm(vpn(4tlenxr oytlmDelu olt)s2toxopoudop   ict s arumxro;t4aexomfctydfs2ua(msnu4arxoiociatfaDelneilt0 rxoxmpiy4apte ieta()arrrumo;t4alxoif3iatfa2uanvs;u0treomf3iatopDr u o t  2xrxm3nodole miet s) 2rax pou4tlxoii3iadlsDemnms t4 etnxo3to1laDrluvilt) 2toxr3io1ap  mictat)aDrau  nu1aeenio3iadfaDuaump u4 exnif3iadfat ln olt0srur(o nudlpt  fes s  Durxro;u0ape ifcilsfs2eauvs u4 lxnmocta1fa   u slt)trum(r nu1lpe  fes (fs2rmx p;o0alxoiocilsfsDrlumon()arenio iadoaDraivols) rtm(o3iodalen netat srrau  ;o4alxo i3tytfaDeanmpnt0tetrmfctadlpD  u s t) 2tr(o ou1lle lfcta()arurumpnu4oetomi3iasfm ranms;t0 exoir3oydomDrlnei (0s2uoxo io1alenmfvtasf rum(moot4openmi3tatfs ranvs t4 lxoio3totopDrluvilt)texo(o3iydlle lfct sfs2uau pnt0olt mfcils m2ul(vp;(4 renifciy1lmD an s (0 2urio3oy1om nmneta()s2rrurp;t0aeeomo3iasls rmn p (0aeeoxf3todoat  u i s srxrxm io1lpeelies sfaDrm(mpnt0olt ii3tat a2ulu o;u4aexnxr iydomtr nes s)trtr(r3ou4llt mncsl( sruax ont4tpe mfctld m2ranmsn()tltoxr3to1fmDe i i;t srxo(r3ny1amtnmneilt  2umxmo;o4olxoif3iad s2ul( p;u0trxnio3iy1lmDeli ols)srtoxm3iy1llte nvsatfarta(mpoo4oleoiictadla2elumo;u)aeermf3oatlmt luei (0 2uo(o3iudap nmnciatfarrm(monu4alt iicilsfm el(vpnu4arxrio iatfateai o;s)seurio ou1ol   fcsat) Dtr(rp;t1tpenmieiytfsDulums;u0 eeoifciadfp   neilt  rtm(o no1lltelivtl( srtr(  nu1tpenmictyslmDrl(vont)tltnxr tytfp   i o;t s2uoir3iu4alt lfeil( artrumo;t0tptnifeilt aDelnvs;t0tleomr3oa1oa raieilt)truoir oy1lmen nes () rumxmpoo4olxoifetasfa2eanmo t4aetrxf iytfmt livo;s0 2xoxrpio1lmt micsls arrru  nu1opt mi3iydfsDrm(vsnu) ltnio3oytoaDrai ol(0 rxrxopoo1apen neiatfs2tax  nu4teeo i3ilsfmDuan p t0 leoif to1lpDelivo (0teurxmpou4lpe  fci t)arum( o;t1olt mf3iys mDrmu o (0alxrio iytlat auvo s)t2xrir3nudolt  fvt (  rrr(r ;t1tetoiociyslsDuanvo (4aexrxf oadfm  anvil( seuoxr3ou1llt  fctat sruaurpnt4oet iiciltfs rlumo;t0tltoxocio1omDrai slt0seto(opoydalte fei (  rtrxro;o1apxomieildls2rluvont4 ltnmf3ty1fm  lnes;(0 rumxopoy4al nmivsls)aDrr(mpot0oexnmfeiaslm2ulnvsnu0aeeoio tytfaDe ieol(0srtm(o3iu4alt  iviat)srra(rooo4aeeomfeias a rlu p u4artnif oydlptrlueo ()sexmimpnudllt lfvi t)aDuaumont0alt  feildlsDrm( o;u4 rxnmo tatomtraieilt0 2tmxr oudamee fvtat) Dra( onu1texn oetld a el( p (0altrmfciotlp rluvs;s  ruoxo ou4am nlfctat s2tmur ;o0tpxnifciat a emn ont4tltnxf3ootfptraivo;()trxr(o nodlm elfvtls arurxmpot4tlen ictatfm2eaumo;u0tleomfciotlpD  ueo ()t2tm(o ny1lm elietl()a2rruront4aee  fetltlm el(mo t)altnxo3oa1fm eln i s)trurxo3nu1lmtnliesls  rtrxmoot1optnif3tltfs rm(vsn() reomrciytlaD li i;() 2tmxo nu1lpeelfesasfa2ua(moot0alt mf3iatfa2um(vsn(0tlxomr3todfmD aivsl(0 rxoxopnu4lmte fcil( srra( oou4open oeiadlm emu snt) reoxo3io1op rau s s0srxrxm nudopen fes t aDtm(  ot1ole mi3ils m rlnmsn(4 rxoio3iydop   nes () eurim3iy1lmeemicsas)a2rm(ronu1aee ii3iyd s2rmums;u4trtnxocio1lmtrluvsls0t2xrxm ou4amtnmnvta( a2ur(moot1tptnif3iyd mDuan p t)arermfctodlp  lu sl( trxo(r oydllt lnvil()a2tru p;u0opt  fctas sDuan sn()texoxr tatfa   ivs ( srurxo nudapee neia()srtrumpnu0olen f3iadlmDrmn s;t4teenifctytoaDeln olt t2uoim3ou1lpenlnci s  rrm(r ot1ale iietyt sDulnvp ()aetoxr3to1lmtr nvs t)sexoimpiy1lm nmivtat  rua(r ot4altomfeiyt mDrmumo (0 rtnmf iytom  auvs t t2tmxmpnu1lmenlietatfarta( pnu1tex  f3iasfaDemnmpnu)aetnio ta1lm  lnvo s)trxoxopiy1ll e ncsl()a2uaurooo0oeenio3iydlm ra(vp;t0treoir3oatlmt  nvo;(  rurxo nu1omte nesat s2ururooo0oleoiietatfmDemu on()tltomoctadlm   nes (0texrirpou1olenmfvsa( a2uau p;t4alx mictlt s em(ms;() eenmocootfmDeluvi ( trtriopou4lpenlnvia(faDumuroou1tpxn oeiad a2ranmp;t0 eeniocta1laDeaneilt t2xm(opio4oltelnvilt  Dururont4tlxnmoctltla2rmnmp ()trenxo3oatoa rlivi s) 2xoiopnu4altelnvt tf rua(rpou1oeenmiciltla2rln o;t4trxoxf iadlmt lues;t s2toiopoy1opeelnvi s)a2tmu p;u1tle io3ilsfa2elumon()artoir3iodlatr nvi;t)srxmio nodllt  fesatfartrx  nt0tpe  ociys s elnvont4aexrxrctodlmD anvo t0srum(rpou4ll e ncs s aDraxmpno1apeoif3tlsfm2ra(mpn(0 rxnxf tytoa  aneils  rtoio ou1omt  ivs s sDua(  nt1tltomfcildlmDeau onu4texrxf3tatlpt  ues t0 2xoirpoy1ol   fvtls aDuaum ot1tpxoiociatls2ran o ()aetnmr oa1lptraneo ( trxmxm iudam  lnes t)srtr( p;t0open feiydfmDrmnms;u0aetriocto1op   i s;() ruo(o3iu4lm elnesas  Dtm(r ;u1opxn oeiytfmDeluvpnu0 lenmo totlp r n o s)s2uoim nu4lleemieslt  Dta( p;u1tex  fciatla2eanvont)aexnxr3oa1lm eau o;(0s2toim3iu4open fcsas srtmxm ;t4oex ifetytlm2raums;() renmf tytfm e u s s)s2uoiopou4lp emivsls)aDumxr ;t1ale  icias aDra( pnu) eeoxrciydomt ln s ()s2xo(m3iodal  micilt  rum(ro;t0oex iocilsla2emn pnt4aexnirciy1lpDeauesls)s2trxopiy1ll nmnvt sfa2rrur ;u4alxoiiciydfaDranms;t4altoio3oodop rlnvi s srxo(o ou1lptelnvia(f 2ra(  no1alx  o3tad sDumnmon()trxrxr iy1faDrluei;()teuoxm3iudam nmfei ()arra(  nt1alen ociad mDemu s;u4trenircia1fpte i s t0t2uo(m3iy4lle mnvtasfsrurxmono4tpxoii3tas sDranvo;()alxrifciadfa ran s;( srxmimpnydalt micias) ruaxr oo1tptomo3iys a rl(mo t) lxomo3iotfa raueolt t2xo(m3no1optemics s srrax  ;u4opto f3iytls um(mp ()trtrxrctadlmDrlueo;s  eur(mpiy4apenlnviltfsrtr(rpnt1apx mfeiytfa2eluvs;t4 ltoir3tadoaDrluvo s0 etoxrpnu4op emfcia()aDrmurp;t4openmfeildfm um(msn(4 exnmf3tatfp ean sls)truo(rpio4ol nlfctasfaDtmxmpnu4oet  fciatlaDel(mon()aeenmo io1op   n olt)s2toim oo1apt mfvta(fsDurxmoot1alenif3tas s rlnvo;(4 renmo3iytlat ai sl(0s2xoxr nu4am emfvi (fs2tmuroou4tlxo feildls2ua(vo t0altnmf3tadfp rlu i;( trtmirpiudap nmiet t  rurxroot0aex  ietytfsDemn pnt0aexrio3oydfmDranvslt)srumim no4ame mivsa( sDuaum ot4oex moeildla2ranmo t0artnmr3totoat anesls)trtrxopoy4ame mfeta(faDta(rp;o4teto f3tlsfm el(vonu0aeerxo oadomt ai ilt  2tr(opnudlmtemiviasfaDur(moot4apx mfetltls uluvsnu0tltnmr3iodopD aues t srtrxr ou1lm n nvil( aDumxmpno1oee  o3ias mDemnmpn(0 rermr iotlat anesls)s2xmxo3oydopee fcsa( s2tauro;o4aptomo3iysla elu o t4teerxrciadopDe u i s trtoxopou1ol  liesat srra(mpoo1alxn iciydlaDrluvpnu0artrmr3ia1latraneo;s)trtm(mpoodalte nesasfsDtmumo;o1ape  i3iatfa2ra(vo (0tltrif ta1fp e uvi () eumir no1lm n fvi ( aDrmumpou4aeeoiictat m uanvsn() eeoif io1fm ranei s0t2xrxm nudopeelietas)aDtmx  no0optnifciydla rlu s;t)aeenmfciatoa   ivilt0trtrxr ny4ll  licsl(  rtrum nt1tpenmf3iydfsDra(mo;t4trtrxrcoa1faDeai o;t)t2xoir3iu1llenmnviat)artmxmont4opxomieiadlm emu p u0 lerxocoa1fp   uvo;t) 2toxopnu4ol  mfvs (f rrmx p;o1apx  i3ilsfaDranmo;t)teenmo iatoa eanvilt)srtoirpno1lle mnvsl( sDrr(r no4ope mf3tlsfm rl(ms t)tetrmr3oytlp eaneilt teur(r no1op   nesat) 2taumo;t4alxn fcild sDuanvpn()tlxrio3io1op rlneo (  rur(mpoodopte icilsfa2trx onu4tptn oetatlm rlnmo t4 rxoxf tadom r nes;(  2uoxr no4lm elnvslt)sDumxr ou0alxo f3ildla2eanmon() ltnmo oa1fat auvo s)t2xrxm3io4ame  fvias)aDurx  ;t1tpeomociyslsDuaumo;(0tlxnifciadopDe u s t) rxr(m iodll   feils  2umur nt4texn f3iaslaDrl( o;u4altrif3iatfmDeai s s)srxr(rpiy4ome  ict (farraxrpno1tlxnmocild a2rluvs u) leoircty1op e nesls)trxoxr ou1aptnlietlsfarum(mp;u1aee  oeiadlm ua( pn() lenxr3iatlpDr uvolt) 2urir3no4omtemivils aDrm(rp;o1aet ii3iatls rm(mp;u)alxnxrctydfp rli ols t2tm(r3oo4llen fesat a2rrxr ot0opx  ieild s elnvon(0trenxocoa1lmDe ieo t0t2uo(opnudllenlnes s) ruaumpnt0oeeo icias sDra(mo t0 lermf to1opDranesls0srumxm nudll emfcil(faDum(mpnu1alxoio3iydlmDeln s t)tltoxf3oo1la rliei s0t2tmxrpnodolenmiesls s2rmx oot1aeeo o3iysls2ul(mp;u) etnir oodfat  ieo;t0 rtrxmpno1ole lnei tfartmx  ot4oeeo fetyslm eln s u0alxomo oadom eai olt)s2umio3ny1al nlivi t a2rru pnt4opeoiiciltfm rl(vsnu)alenio3iatfate u il()s2urimpoo1lpe livtat)arrmur oo0tlx  ietydla uau p u)trermo ty1fm raieslt texmir iy1ap nmieilt aruru p;t0apeniicilt mDeanmsn(4alenxr tatfpD au o s0sruoimpnydlp  lneiasf 2umxm no1aetomictlsfm2emnms;u4arxoif iydlaD an ol( t2tr(rpiy1amtnmivtltf Drmxmp;u4teen iciltfm2rlu pnt)areomfcty1lpD lnvi;(  etmxopny1aleemivtltfsDta(m ou1aleomietlsfa2umnmp (4arxnio iadop  an sls)seum(r oy4op   icsasfsrrr(  ;u0oeeoiiciatfa uan p t0tetrxo3todom eaueilt0teto(m3iudape lietas) Duru onu4aptomoeilt s umumo () rerxociodfp e uvi;(  exrxo3iudlp nmfeiat)sDtrxm ;o1optn f3tas aDelu s;t4trtnmr3oodlaDe i s t s2xmxm oodap nlncs ( s2rauro;u0tee  i3iysla2rmnvs;u4 renmfciatoptr uei;(0 exrirpoydalt  icsa( sDraxr nt1apxoif3iytfa2ra(vsnt)arenmo oo1fm rlivilt)tetmxm3iy4lp nmiviasf Dum(  ou1aleomfetltlm2rmn s;t)artnxociy1oat livo;()texrxo iy4ame  ietlsf rrr(m ;u4tlt ifciys s el( o;(0 etoio to1fptelies;( setrio3iy4ll   ivt s)arum(mpot0olxomocias a2elumpn()tlerxf iodomtrlu ilt0srtr(r ou4lp n fcs () rur(m no4texn fciltfs ra(vo;u0tlxrifciotlpteluvo;s) exoirpoodlpt livt (fsrta(mpno0apxoiociasfaDumn p;(0aetrmr oy1omtr u ols s2urio ny1aptelfct ( aDtru  no4olxn octld a2ua(mon()teeoxocty1optr n s (  rurio3iudal e nes t  2tmumpnt1tlto ietydfmDemu p (0 eerxf oodomD lues;s) rtoxmpno4omen nes ( a2tax oou4olx mf3tysfa ulnmont)artrxf3iotoa e u olt0 rurir oudamtelivs ( a2rrurpoo1aetn o3iyd s2ra(vo;()tltrir3to1opte neilt0 rtrir3iudopenlieta()s2rau o;u0ole  feilslm rm(mo t4aexrxr todoa r iei;t trxo(opoo1op nlivias)srta(r ou4teeo ictld m eluvo u0arerir3iatoptelneil( teumim3ou4oleemfctatf 2trx o;u4optn ietlt m2rl(mo;t0trxrxr ootoaDrluvo;t0t2urxmpnydoltemfvsat)aDrax oou1apxnmo3iydfm umn o u0tltoio totoptr ivi;s0srxoxopiy4ope mneta( aDrm(mont4opeoiieilt mDum(mpnu0 rxrmo tydfmteaueil(0trumxopnydomen ncsas  Drau  ou1alt mo3iltls2el(mont)arerif oy1fmDr u s (  2toiopio4lpenmfvsa(f Dur(mpou0tltoioetytfs2rlnvsnt)alenmf tytlm  lu il(0s2uoimpnu1omt miesls s2rrumpoo0tpx ioeiydlmDea(vsnt0texrif iydla raueo s0s2tmxm3ny1lm   icias)a2umx ono1aex  o3ildlaDrlu onu0aeermf ta1lp rai o s0tetrxm3oo1opt liet ()artrxmooo0alxniieiysfmDrmu o;u4artoxf ia1fa  anvo s)srxrir no1lm e ivs (fsrtrxrpnu0alx iicilsfm2eaump t0aexoirciodoatr neo ()s2to(rpoydop n feil(faDuaumonu0tlx ioeilsfm emnmp;t4 renxo3to1lmt au s t) rtrio ou4llt mfes sfaDurum ;o4oexnmfeiadfmDrl(monu0aeeomfciotlpD  n olt0 rxmxo3iu1om   fesls arum(  no1tetomictltlm rauvs;t)alxrxrctotomD  i il( s2ur(r nydlmenmfei s)aDtaurpot4opxoio3ias a2emu pn(0 rxnmf3tytomD an s t0setm(opiy4lltn nctls sDtrxm ou0tlx  i3tld m2eanvs;u) eerir oydopDr ies s)seurxmpno4opt mfvs tfsDrr( onu1tee mictad m2rluvs t0trtoxf3tydfpD an ilt t2tm(m3iydlpeelivtat) rumx pnu0tpxn ociltfsDrlnmo u0tlxnio oa1la r ueo;( t2xmim io4ol   iviltfarrmu o;o0ape mfetat s ra(vs u0tlxnmr3iodlate u o;( tetmiopoodam emfvia()a2rmxmonu4tpto oeildlsDrlnvo t0altnxo3iatfm  anei;t) etmimpoo1ll emivt sfs2rrump;u4tex iiciltlm2eau p;t4areniocto1oaD  n o;(0trxm(o3io1omt micils) Drr( o;o0opxnmi3iyslm2rmums t4alxrxocta1oat luvs;s0sexrir oo4ap  mfvsltfsrrr(m ou0opxo oeiadfaDrmu sn(0 rtnmf todomDeluvs;s s2xm(mpoydlptelies s sDururpoo1aexomfetatfa2rluvonu)arxnmo oadfpDeli o ()teur(m oy4lpen ieiasf Dum( pnt1oet mf3iadfa2em(vsnt)aeeoio3iadoa e ues;(0sruoimpiu4lm   nvsls aDraumonu0oet ifciyt m emuvont)alxrxrcio1lpD aueols) 2tm(r nu1oltelncs () Dtax  nu4tpxo ietysfsDumn s t) rerxo3oydlaDeanei t) 2um(o3iu4op elicsl()sDtrxmo;o4tpenif3iysfs ul( o;u4 rtoxf ty1fp rln il()texoiopoo4olee fvils sDum(rp;t0tle  f3ilsfm eaums u0tlxnxf3iytlpD lu o s)seumxr3ou4lpeemfcta( arraxr ;u1optnmoeiytla elumo t4tltnmr todlp  lueols sexmir3ny1llenlnci () Draxr ;u0alxoifetys s el(mo t)aeerxrciydlm  lu sls  2umio no1omte nvia(farraxmpnt0oet ifeiysfm rm( p;u4 rxomo3ootoa e ueils0setoimpoy1alenlfvt tfa2uaxrooo1oltniieiysls rl(vsnt)texnmocta1faDr uesl() etmxo3oy1opt lfctl( sDrau  nt1tlxnifeiyd sDulumpnu0 lxoifcoydlpD  ieil(0setoim iydopeemfcsls  rtaur nt1tlenio3ildla uluvo;u)altriocta1laD lnei;()s2trio3iu4ole  ncs s)a2rmxm nu1ole mi3iyslmDua(vsnu)tltnif3totoatelnei s0trtoir3oy1lmt lncia( a2rm( onu0apeomoetldlm ran p t) lerir oa1lmt an ils srxmio3iy4optn iviltfaDumxmoou1tlto fciydla raums u0alxomo io1oatelies;t)s2trxo3oo1lleelncsl( s2raxr ou4aleomociydla rlnms (0aeerxr3oo1opte n o (  etmim oudlle  nei s s2tau  nu0apxoifciytfa2eanvpnu) rerirctodlatrlivo;s0srurio3nydalt livta(fartrxmo;o1tet mo3iaslm ua(mpnu)trtoxo iydlptelnvi;(0 ruo(r3iu4aleemfcsl()arraxm oo0oeeo ietldfm ulnvs u4 rxnxo tydfat aueil(  2tm(o3iudameeliciat) rrru pot4open fciasfs uluvp u4 exrircoo1laD aneo ( tetr(r3iydlmte ietas  Dum(  ou1aptnifeiadfsDem(von()tetomo oadfmt  iesl()t2xmir no4ale mfcsls s2rmxm no4oeeo o3iyt s2umnms;()tltomocootfat luei;(0sexoio3oodal nlies s)srumurp;o0tpeoii3iatla2ulu sn(4alxrxr iadlpD lu i (0 2uo(r3oy1amen ietlt a2rmur nu0oexomietatfa rl( pnu)tetoxociydfm eaivo;s0setmxm3no4ale mfvias)srtr(r ;u4oexnmfcildfm eanvo;t0artnmr ia1omte uvs;s tetoxm no4oltnmieiatfartrxrpot1tlxomictlt m2ua( s;u) rxomr ia1op  anei t) 2uo(m3oydoltnlfci tfs2urxrp;u0aetomo3ilsfa ul(vpnu0tleoxociatlpDe neil( t2xrimpiudolee nvsas)sDururpot1optnifciltfmDumnvs (0aexoxo ootoaDe i s t)s2to(o iydll e nesasfartr(mo;o4tptomoeildls2ranmp ()arenif tatfa e nvsls)t2trimpiodol  mict s sDumurpno4apenii3tys s ea(vp;u4 exoiocoodlatrlnvo t seuoxopny4lmtnlfvt ( aDrau  ot4olxnif3iyt s2ranvo t4 etrxr3oo1fm e ieils teurxm no1ale  fct s) 2ta(ro;u1teeoifctad aDrlumonu0trxrxf3totom eln ol( teuoim iodop nmncsl( aDrmu ooo0tetomfeiasfsDel(vont0alxoir3oa1fmte i sl()t2trio nodap  micils) 2rax o;u4tlen oetatfm2uanvs;u)aetnmrctodfm   ivols0texmxo iu1apte nesa(f 2rau  ;o4oltomociad m rm( o u)artrio tatlp rluvi t) ruoimpoudam  lneiltfaDrm(rpnt0opt  ociatla emnmo;u4arxnxfctotlm rln o;s0srxo(m nodalt  fcta( aDuru pot1ale mo3tytfaDemn s t4trenmocio1omDranes t trur(o nodal n nvia(  rraumooo4tet  fetlslm2ul(vp u4alenif3tydlaDeai ol(0 rtrim nu1olt lnet tfsrraxmpnt4aeeo o3tat a2ua(vpnt0alxrmfciy1lp eluvi;(0texrirpiodoptnmfvias) 2rrxmpno1aet ifciyslm umumpnu0alermfctatlm e u i ( s2uoxm oo4ap nmies t) 2urxmoou4aexn ictldla eauvo ()arxrio tatoaDelnvo () 2trir oo1ole lfcil(f rum(mooo4alto ictadfm2uanmo;t4trtoxf3oadlaD auei s) 2tmxopoodol  mfctls) rraxrp;o1aeenmietyt a rlums;(0tlerxrcia1lpte ueil()srtmimpio1oltn ietls)arumu pnu4alx ii3tlsls2emn o ()altrircoydfm  au o;( seurxo3ny4ol nmfcsa(fs2rr(mpou1oet iociaslm ulu sn(4 rxnifcoy1fpt aues s)setoxrpoy1am e nctltf 2rax p;u4opxomietadlm ul(vo;()texrmo oadfaDe iei s trtoimpoo4al nmnvils)s2uax  nu4apxoifetysls2eluvon(4aeeoxfctatoa eli s;t  rtrxmpoy4lltn fvtltfa2urx  nu4aeeoif3iysfa2uauvs;() rtnmrctytlm  lues t s2xrxr ny1llen fet s)srur(r no4apt if3iadfmDuauvp;t) reoifciadfp   i sl(0s2xoxo3nu4ome  fcs (fa2rm(monu0oetn icias s uln onu)tetnircty1optelu s;s  rxmxo3nodlpt  icsl( aDum(rpno0opx ifciyt m eaumpnu4aexrioctotlaD au s s0trxmiopiodop   ivs (fsrtrx pnt1apxnioeilsls rl(vp t)texnxfctytop   iei;t0setrxr io4ole mncias  Dtmxront1alxniociytfaDemnms;t4trtrmrcoatlp   ieols) rtmxr no4ol emnvtlt) 2umu pou1aexnmf3tyd a2umuvs;u4teeoxf3tatfa elnes;s t2tmirpiudllt  fei ( arrrxrpno1oet mfetys m em(monu0 lxrmfctatfpDr iei s0t2xm(o3nu1ole lfvi sfarumxr ot4aetomi3tas a2ranvsnt4 leoxrcto1fa r nvs (0setrxo3ou1ll  mfes t arrmu  ot1oetomf3tysls2ulu p (0tltoio tadfpD  u s;s  eurxr io4opte nvtl() Dtmxrp;t4apenmo3iytfa el(vs t4texrmf oatoateluvo (  2xoimpou1omeemfcilt  rua( o;u1aetniictadfa ua(msnt4alxnxfcty1fmtrlneilt0seumim iu1lpte fvsasf 2um(  nt1optn o3ildla2emnvpnu4 ltomf3tadopte n o;t srxmio3iy1olee neilsfs2umx  oo1opxnifeiasls2emnvpnt4aleoxocoydfatr i ol( texmim iydlmtelfet s s2tmu oot4oeen ietydfmDrmnms;t0tetoifcio1fatr nvi;()trum(m3nydol emici sf Dra(mpou1aexn f3ilsla2um( o u0tltomf3oo1oa  luvols0 eto(m iy1lmtnlieiltfartaurono1apt  octatls2umu o t0tltrir oodom raieilt)seumio3nodlm  mnvtl(f 2rax  ou1aleoif3tlslmDulu snt) lxomfcoo1oaDr n o;t0 2tmir ny1olenlivtat  2ur(mo;t0olto oetas m uln o u)aexomrciatfa rlnesls) exrir3nodomtelici s  Dtaurp;t0alxn ociad a emuvp;t4tlerif oodomt  uvs (0 rtmiopiy4lpenlieia()sDua( p;t4openmi3iat m rau o (0 etrmf oodfmtrliei () exoxo oy4lpt mfes sfaDtmu ooo0altoii3iltlaDrl( s (0teeomr3iotlpDranvs ( trxmio3nydopeelfvi (  Drr(r ou0opeomf3iat sDeanvo;t4tltomo3tytlmDran sl()s2um(o ny1oleemfvi s  2uaum ;o1tlx  o3iydlsDul(msnu)aexnir todfa  auei;t s2uoxmpoo4alt micsatf 2rmu o;u0aexoiocilslaDumuvo ()tltnir tydfmtelueo s0s2umxo3oo4ap nmncs (faDumurooo0opx mo3tltfa2ea( s;u)trenmf3tadfmDrlnvo;s) eurxo3ou4lm nlieslt) rrr( pno1tleomoctytfmDrmu o (4 etrir tatfa e nes s s2trxr oy4ll e ivi s) rur( o;o1opxoifciat m emums;() lenxo iydoat anes () ruoim oo1ll nlfvs t)s2rmxm nt1oee  feiys s2eanmp;(4aetnio totoa rau o;s s2xrxmpiydopeelnvtasfs2taxroot0olx iociasfsDra(vont0arxnmociadlmDeluvi t) 2uo(mpiy1omtnlivs (faruaurpot0tpe if3ildfa ul(vp;t4 reomrcia1fa e n olt0t2xo(opiydlle mnvslt)sDtm(rp;t1altoii3iyslsDraumsn(0arxnir3oatopD  uvsls)t2toim3oudomee ies ()arrrx o;t1tltnmfeiytfaDulnmont4 rtoxf tytfpDrai i;t t2xoxo nu4lp elfcs ( aDrmxmpno4tpe ifeiyd a2ulnvsnt0tlenmr3oatlpteaueslt) rxoimpno1alenmnvtlt  2rr( ooo0aetomociytlaDuaump u)alxrif iadlptr uvsls)truo(m oo4omtn fvsls)artaum nt1aeeo i3iytfs2rlnvo;()trxrxfcto1fa e ueo s)srtm(rpiy4amt micilt) 2rmxm ot0oleo ieiadlm2ulumo;(4trerif ootlm  aieo t t2trimpnydlptnmicslt) Dtaurp;o0olen icildlm2emn on(0aeerir3iydoaDe neo;(0sexr(r3oo1ome  fci ()a2rmxr ;t0alt mfcildla2ra(mo;t) lxrmf3oatlat an sl()s2xrxm iydameelfcsa()srrau p;u0olt  i3iydlmDuan p t)tetoxfciydomDelu s ()t2xmxr ny1lptnlies t  2um(m ;t4ale mo3iasfm2rm(vsnu) ltoxf3oa1fat livi () rumiopiydlp   ieil( artrur no4apto ieiysfs uanmo t4alerio oydfaD lnes t0seurimpoo4ol n fvs t)aDum(mpot4alenmiciad mDrln p;(0artomo tydoatrlu o;(0trurim iodoptnmivtl(f Drrxm nu1oetoifetadfs2emumo;u4 rtoif tydop elies;s0srto(o oy1llenmfcs t  rtmxmo;t0tet  iciltfaDemnvo u4artoxociotlm eanvs;t  2xrio nudlmenlict ()s2rr(mpot0aee moeiadfmDrlums (0teeniociy1omD aiei t0 etmxo oudom n nei s)s2um(  oo0oltn oeild m2rlu ont)alenio to1oatelnvilt0trtm(r3no4ope  nvslt) 2ra(m no1aptoioctldlm2umuvp t0tetoxocty1lmDe n o s)s2to(opnudlle mnei s) rtm( pno4aeeomo3iys s ul( o;(4aeerio oatoat aivo;s texoio oo4aptnlnet tfsDrrur ot1aexn ociyd m el(vs u)altrifciotopt  u sl( t2xoir iudalenlicslt  2urxr no1tpt ioetatfm ulumsn(4 eerifcootoateluvi;(  2xoirpiy1lp elivtlsfaDurumo;t1opxomi3iasla el(von(0 eenxr tytfm eai ol(0srxr(o nodomeemncta(fs2rmum ou0tlxo ieildlm ulnmo u4artoxf3tatomteluvs;t t2xmimpno1ll nmnet s) rtaxr ot4tpeniiciatlm el( on()teenxo3ty1op eaues t)srurxr3oo4ol nmfci (fsDumu poo1alenioctldlaDua( on()altoxr3ootfa   n o t0 2um(opiy4lmen nes s) 2rrxr nt1aeen f3tadfm el(vo;(0arenmfcta1oat ln olt0trtrxr3oy1am nmfcslsfsrur(mono4tlxomfeiad m2uauvo u)aeenxf3tytopDrai s t seuo(rpny1alteliviat aDuax  nt1optnmoetatfa2rau o;t4altrio3todla  li o (0srtmxo3ou4optn nesa() rrauro;o1tltn fctld aDumnmpn()treoio3oo1oa  lieo;t t2um(o nydoptn netl()srtrxrpot1tetnmo3iad mDumnvs t)artoxrcia1op r u i (0 exmim3iudlme mnvs (fs2rrur ;o1oexnmoetatlm ran o;u) renifciotoatr uvil( srxmxr oodllt mfcs s)sruau o;u0alxnif3tadfm2ulnms;(0aexnxf iytoaD auvo s)teurxopnydal e ivi ()aDuaum ou1olto i3tas sDrm(vs;u) ltrmr oodomt lu sl(0trurxo oy4lp n nci (fsrrrurp;u1olt ioeiyd sDuluvo;(0 eeniocio1la  an ol( teto(rpoy4amte nvtltfsrtmum nu4openmfetad m um(monu4trxnxr iydlmt  i o;t0 rur(m3io1om  mnetat a2umx ooo1tlxn i3tldls2ulnvp t) lxoif3tadom rlnvilt0sexmim3iydapenmfvslsfs2rmxrp;o0tlenii3tlsfm2uanms u0trxnxf3oy1fa e n i;s0 2xrxm iydol   fvslt)a2trxmoou4altomfciydlm elnmp;()alxoif3oy1lmte n s;t srurxo3oy4lpe mivi (  Dua(  nu1olx io3iytls raump t)artnmrctytfaD  neo;t0 rxo(o3ou4om   ivias)srtmurono1tetoii3iysla2elump (0arxrmr ia1lmDrluesls0 etrimpoo1omenlici (fs2uaum ;t1apx  fciad m2ran ont)texrir iodomteliei t seur(o no1lptemici t aDuaxrpno1texnmieildfm2ra( pnu0 renio iy1op e nesl()seumir ou4am emiei t aDrrxr ot4apxn fetlsla2ean p;t)aexnxrctadfa  lneilt0teumir3iu1lp e nvta() rtm(mp;t1tptnmictys m ranmo t4texnmf3to1opt  uei ( t2trxm nodlleelnvi s  rurx  ;t1oet mociasfsDraumsnt0 exoxf tydoatran slt)s2tr(mpoo1ale mnci sfa2umxront4aptoiieiysla rmn sn(4artoxr to1lmtrln o;s)setoxr3oodaptelivt (fs2umum ;t4teeoio3tld a2ra(ms t0tlermrciadomte uvilt)s2umirpnu4lpeemnctlt)artrxr ou0tpxnio3tls m eanms;t) rxrmo3tadlmD li i s) 2umxo nudap  lfvt t) Dtaum nu4aetoiietltfa2rmn pnt4artnxr iytfat li ols tetr(r oy4lp emnciat) rtau o;o4tlxo feias m2uan onu) rtoxr oadfmtrluvol() exmxr nudap nlfvils)artm( pou1tpe  icilt s2emuvs (0 lenmf3totfmDr u o;(  rxrxo3ou1ol   nvs s)a2ur( o;u4oetomociyd aDrlu snt4aeeriociy1laDeluvi;t0t2uoir3oodam  lfcslt  2uaumpot0optn ieiadfs umnvo t4 rxnxo tytlpD ai slt teuoxmpiy1olenmnei sfaDraur ;u0tptomi3iytla ranvonu)teenmo iydfaD  neol(0 etoxrpoy4lme mietatf 2taumo;t4tlt ioctadls rlnvs;t)trtrirciydfmtean o;(0srtm(r ny4lme  ietls  rumu o;o0tpen ieiatfmDea(ms;u0tetrio iodomDraieo;()texoimpio1optemfct s arrmu  oo4olto ietldfa2rmn pnu0trxnmr oydoptelivo;( sexo(mpoy4ome mici t sDta(mp;t1olxoifctadlm2eanvpnu4alxnxo ia1latelnvsls) rumxm nu1omtnmiei ()a2rruro;t0alx io3tldls rmnvon(0aleoxocoo1faD livo;t  2toio nudal  mnetatfaDua( pou1apeo ietadlm2eanvont4 lxnif3oatoateaiesl() rxm(opiy4amtn fvt t)srtmxmpnt4alto feiltls rln s;t0tetomoctotoa e neo ( sexmim3iudal  mfvsas arrrxmpno4oexoiieiltlmDrm(mo (0teerxf to1fat lnvo s0srxoim ny1ol  mfetl(fsrtaum ;t0optn o3tld mDelnvs;t0 rtoif ty1lmD anei;t)srtrim3oudol emietas)sDraumono4aeto feiltlaDel( s;t4texrxfcia1fa r neils)texmxm ou1lptemncs t)sDrrxmo;o0tlen o3tadfsDrl(vs t4trerif3tatfmtrlues s texoxo oudll  lnvs s)sDra(mpoo4tpt  iciytfm2umuvpn(0 reomf3to1opt au sls)srtmxopnydolt mnviat) rra(rpou4tltomiciatfaDumumsnt0artrmrciydom   u o;(  etoimpoo1olenlfeta(f rtm(rp;u4tleniietlsfa eluvs;(0altomf3oytfaDeln s;s0teum(m ny1amee icilsfsrrr(m ;t0apxn ieiys aDrl( s (4tltnmfctotfpDr ivi;t)trto(r ny1ol nlieia( s2ur( ono1tpt mfctyd sDulnvs u0 lxrxrctydfmD au ilt)teuo(o nu4ll   nvt s)artr( p;u4tlxnioeiydfm2eanmp u0 rxrxfctydom r iei s trxm(r iy1ll e netls a2ur(  ou0oexnioetyd s emu p;()teenxf iodomtraivo;t  rurir3ou4lm  mivsl()srrm(rpno0tleoifeildlm2uaumsn(0 rermociydom rlu s;(0seto(r3iodlmt  fvias  2tax  nt1tetnmoctasfa2rl(vp u0trxrxr3to1lptr uesl()t2xr(rpnu1ll n fcsasfa2umu  no0altoiociadla uanmsnu) lxoio3tytfmDelneol()tetmimpiy4ale lnci t)aDtmumo;t0oet iieilsfs el(vo t4tlxomf tadoptr ies;s) eurirpiu1amt mfeil( s2rmumono1aet iieiat a ulnms u)texoioctotoatrauvils0setoxm ou1ome mnvi tfaDta(  no4olx  octltfm rmu sn(0aeeoxo iodfat ai sl()sruriopno1openlfct sfs2rrurp;u4oeto oeiltfmDrluvs;u4 ltoxf iatoaDe neslt0 rxmxopny1al eliet t sDurx p;o4teen icild s emuvo u4artnir iotoa e nvs t  2xo(m nu1ole  nvil()aDtm(mpno0tpt mi3tad s2ea(vo t4aleomoctatfmDrau i ()teum(mpiydlmtnlnvslt srraurooo4oee  i3iltfs um(vp;u4 exomr oodfp r n slt) 2toir no1ol  miet t sDtmu pnt0apxn fciltfa uauvo u0 lxomr oytfpt ln s;s0 etoir3oo4amtnlneia( s2tr(rono0aex ii3iydfs raump;u0tlxrxr3ta1faDeluvsl( seumxr iu4lme livs s)a2tm(moou4aexn f3ild a eln s u) lxnif tatoat li ilt srtoio nu4ll n ncs t s2ra(m no4tpx mf3iat a2ul(vp;u)aetoir tytfm e ieo;t0trto(o3nydol  mics t  Dtmuronu1opeo f3iysfa ra(vo u0 rtoxf ty1omt aueo t t2um(o no4lpt  nvia( aDumu o;u0apxo o3tydlm2ul(vs;() lxoxrcto1omDraueils) 2xoio3iodomenmivias)srtaxmp;t4tetnmietasfm2em(ms u0 etoxo3oydfmDe ueils) euo(rpny4omt  ietl( sDra(r oo1tet io3iyd s rl( p;t4arxrio oytop ran s (0 2umiopou4lp  mnes (fartr( o;o0ope mi3ildlm emumo () lxoiociodfa  ln ilt t2tr(r3nu1opeelivilt  rur( pou1optn fctatfsDua(mo t0teermrcootlaDe nvi s  rtmir3nudomenlneil(f rtmump;u4tee mi3ias mDrmn p;() rxnmo3iotlpD ai i ( t2urimpoydolt mies (f 2umum ot0tleo i3iatlm ra( p;u4tltrmocoo1lp   ivi (0seto(mpiu1opt  ics (f 2rmx p;u4tlt moeiytlm um( s t)artnioctadlaD  uei t0trtmxopiodal eliei s arurur ou4oleniociltlaDemu o t4trermfcoatfatraueo;(  2xr(opny1ape mfet (fa2rmxm nu1olx  oeiad m rlu p t0aetrmfctytlmtranvi;t t2ur(opnudll   neils s2uru ooo0opx  o3iysfs umu p () lerio ia1oaDrlu slt  exmxmpny1lmeelfvslt) Duaxmo;u4optnmoetlsfa ran pn(0tleoiociotlatr nes t  exr(mpoy4al e iciat) rrax pnu1apxnmf3iasfs ra( s;t4teeoxrciytop   ieo;t0srtm(opoydaltnlnvsas)aDtm(ront0oee ii3ild a rlnvon()alenxociotom raivol(0 etm(o ou1ap n nvi (fsDrrxm oo0optnmietldlsDrmn pnt4 reoxf3iodlptrli slt0 eumio3nodope mieta(f Drmx  ou1alxnifctysla2eln s;() lxomo oo1fpD luesl(0srxmxr3no1lmenlnvi s) rrmx  ;o0teeomo3iysfs2ul(vs u)tltoxocia1opDe ivol()setrir3ny1ole mfes s  rua(r ;u0tltn f3ildlsDrm( p t0tlenxrctotopDrlueo t0 etrxm3ny4apenlnvi t sDuru poo4oetomi3iytfm2ua(vo u0altnmfciadoptrai s;t) rtmir ou1am emiesl(fs2tau  ;u0tet iocils mDumuvo;t4altoir3oydfa  anvols teurim iodop nlfeta(fsrtaur nt4oex  f3iyt aDea( p (0 rxomocootlatrlnei ()seuoxr3nu1amtelfvils)aDtmxrono0openmo3iltfm2eanvs u0aetomo3ty1laD  neo s  2xoim io4apt lieia()sDra(  oo1tlxo ietlt aDua( sn() rxoxf iytfp elnvi;s s2uoir3oydop nlicia(f 2tru onu1apenifcilt mDeaump (4 lenmf iytlpt anvi;t0s2uoxm3nudolt mnetls)aruax  ;o1alx iiciyt mDrlnvo;u4 eeoxf3ootfat aues;s)t2tm(o nodamen nvslt)a2rrxm ;t1ape  feiasla2el(mo u)altrmf ta1lpDr ivol(  exrxr3io1amtnlnetls  rua(r ;u0teto f3iytla eluvs;t)tetoifcoytfm e n ilt) rtmxrpny4alen nciatfa2ta(mp;u0oexoio3ildla2eaums;u0altomoctodfatraivil( trtrxmpiu4aptemfcsls)sDtax pnu4oeeoifetlsfmDelu o;t4 rxrxo3tatopte iesls)truoxr3io4lmee ietat  rur(mpot0alxo feiad m2ua(vp;u4aexnio3tytfpDr i ils0 etm(m3oo1alee nct () 2rrxr ot1oeenmfetad a2eanmo;(0tetrmfctotfmt lnvsl()srurir ou1op n fvtat) 2urxm oo0tex ioetysfaDrl( s;u0aleomf3iotlpt  neo;t) rurir oo4alt  nciat srrrxr oo4opt  oeiyd m ua(vp u0 rxoxr iy1fmte uvslt  eur(m3nodop   fetasf Draxmpot1olx moctytls2rlums (0 reomociodoa raneo s0 2trxm3oy4oltn icsl() 2umu oou0texnii3tld aDel(mo t) rerif tadoa r ies;(0 exoxr iodamt  nvtat)sDra( o;o4ole ifctyt aDum(vont4trtnir3tatlm eln s t)seumir3oo1lptnmfcsls s2ur(mp;t1tle mo3ildlaDem( p;(0 etomfctatfptraivs;()srtr(rpio1ome  ics tf rtm(mp;t1teeomi3tydlm2rmnvs (4tetoxo oa1opt ai i;s) rxrxm3iydoptemnvi s)a2tru pnu1tlt ifciatfaDea(mon(4aexoir iotfm rli ols  2tr(r3io4oltemnvi t  rta(roou4alxnmo3tyd s2eau s;(4teeoircio1oa eaies (0s2toxr iydop emicilt arum(m ;o4oetomictad aDemnvo;(0arxoxo ty1la r u ils  2umirpiy4lpen neil(fa2umxmooo0tee  oetlslm2elnms;(4alxnxr3tatoat  n o;()s2tmir ou1lleemieil() 2tm(rp;t4tltomociltla2um(mo t0tlerxocoy1oatranvs s seum(r3nodomtnlfci s)a2rr( ono4openifcilt s ulump t) etrxo3oadopte nei s)seuo(o3no1am nmici ()arur(  ot1opxn i3iat sDul(mo u)arxrir iadoptr neo;t) rtrimpoy1ame lfvs sfaDrrx ono0aetniieiys m2rmu o t0arxoio iodfpt  nvo t t2xmxr ou1ol  lfvtl( a2rmxmpot4olen oeiys s2umuvo u0 rtrir oa1lp rauvi;s) rtoio3oodlmtelics t  Duaxm nt4olxomieiytfmDum(ms;u4alxrir3oodfpDelueo (0 exo(r3oy1om  lncs t)sDrrxmo;o1opt ifetyd a2el(vo;u4 eerxf oa1omt aivolt0tetm(r3ou4lltnmfvil(fa2um(  ot0optoio3iaslaDeanvs u4 reoxf totop ranvs t)s2ur(r io1opt lfetasf rrmxr ot1tet  fctysfm2el(vp (0aexoir3oadfaDrluvol()truoxrpnudllt mfet () 2rrumpou1optnifeiad s2rau o u0 lxnmo oy1lmDr i ol() 2umxopoo1aleelics (fsrrmurp;u4opeomfeilt a2eaumo u)aeenxr3iatfaD  iei;s)srxrim nydap n feiat srra(moot1tltn fctydls2eaumo;u0tlenmoctydlm   neo;s0s2umxrpiy1lp n ncsat) 2taxm ;u1opxo ictydfsDumn pnu0aleoxf tatlp e nesl( t2ur(r oudlpt  ieias aDtru pnt1tptn fetlt s ul( s;(0tleomo3todfaD aieolt0trxrxo oo4amtemnet ( srtru ono4tptnio3tat aDem(msn(0 rxomr3to1latr ues s t2trxrpiy1omenlietl( s2rr(mo;o4tetnmi3iyslsDrm( p (0aexomf iatopte uvi s0seuriopiodolenmncils)srtmxrpnu4aleoii3iyt s2emn s u4arxomo3iadfpDean ilt0seuoxm ny1lmtnlnctlt) rurxrpno1olenmi3tatfmDeanvo () rtrmo3iatla rli s;(0t2uo(m3ou1am elivil(  rur(rpno1oee  i3tldla2um( s;t4tlxoxrcty1omtelivs;t0truo(r iu1lpe mncs tfsDrmum ;o0alenmf3tysls uln s;t4artnmo3oydfa r ivs;()tetoxo3io4am e fviasfarrr(  no1oexniiciatfs2rm( o u0trerxr iodfatrlivols  2tmio3nydal emfvias)srumu ont4opeomoctys s rl( pn(0tleoirctatla eaivols  etoxopoy4oleemfciltf Dur( ooo4aexniiciydla ea(vp u0trxoir iodfpt  u s (0s2urir3io1ll  mieia(fs2um(r ;t1aexnmi3iatfa2rau s u)alxrxr3oa1fp rluvols t2tr(m ou1optemici s)sDtrxr ;t4tptnio3iysfs uau o;()alxrmf3iadfmt  neolt) 2urxo3oodlmenmneiltfarrax  nu1alxnmictat a2ulnmsnt)artrmfcoy1faD  nvo s0 etmir ou1al nlfeia()a2rr(r nt4tet  f3iad s2uan o (4tetnxf oy1fmt  ivilt)srumxr3oudlmt mnetlt  2uru  nt0tlen iciadlaDelnmp;(4 rtnmf ty1oaDr uvi ()trxoir iydaptn ivt t)sDrmxrono1oexo ociatfm2rl( s u)aexnif oa1fat aiesls s2urirpoudape  fcta(f Draxro;o0oexoifciad aDrm( on(4tltrio oy1omD auvslt s2uo(m nu4alee fcsltf 2trur oo1ale ifciysfmDua( p;u0tlerio ia1oat  nei;(0s2ur(o3iydomt  netltf 2taur ot4oltnmf3iysls2rln s;t) leniocto1fpte ues;t trxmxr iodamt mfcias srua(monu0apxoiociadfa rl(mo u0tetnxf3ty1lmDelu il(0 exo(m3nu1lme mies ( srururo;o4tltn o3iatfs rmnvon(4aleoxr oytfa e nei t0s2um(r nudopenlnes s artru pou1ope mfciasfs2rm(msnu4tlxomf3tytoat  nvilt srxo(o ou1opeemieslsf 2truronu0tetnioeild s2umn p;t) ltrir iytfmtrlivsls)seuoxr iu1lptnlfetat)srur(mp;t1aetoio3iadls2ra( s t0trxrxr tadfpt lu olt)trxm(opoydap emfeils)srtaxro;o1aee  fciyd m2umuvp;t4aetnif ia1lm rauei;t  euoxmpnydopenmnes sf Dua(rooo4optn f3tyd a ulnvpn(0aeenxocty1fmtraivi s setm(opiu1oltemnetasf rta(r nu0tlxo feildfs um(vp (0tetoxr ia1om r ies;s0 ruoimpoo1opeemfes t aDtrxr ot4tetoii3iyslaDean p u4tlenxrcta1lpt  n sls)teurio oodamtnmfetat s2rrxmpnt1oeen oeild sDemuvo;()trenxr3oa1fatelu ols t2tr(m3nu1lpenlnetl() Dumu  ;t0apeniociytfmDua(vs u0 rxnir3ia1la rau s (0s2uoxo3oudaltn fet s) Drmxr nu0optnmfeildlmDem(vo;t4areomr3oatlaDeai ilt sexmxrpoo1lmt  nvtas)srrr(m ou4aexniieiltfs2eanmpnu)trxrmf ia1fpDran s;(0 2uoxr3iydapeelnvtas srra(ro;o1tpenioetls a umumo;(0texnir3io1op eaiei t t2xo(m no1ale mfetlsfarrrx p;t0apeniieiydfsDrmumo t4texnir iadlat  u o;( sexmxo oudolt lict s)srraurp;o0tlt  ieiyslm rmu s;u4tlenxociy1fatrlivo s)trtrxr3oy4apt mivsa() Dtm(m ot1tltnmoetat mDumn s;(4 ltrif3oydlmDe u s s  2umir3iydop elnetl()sDrr(moot0texo fciadfaDulnvs;u) exnxociydlm   iei t) 2urxrpoo4lme lfcs s arrrxrpnu4oleoiiciyd s2uauvonu0aetnxf todoat livolt) exo(m oodole mici t aruru  ou0oet if3ias sDrmu p;t) lenirctadomDe n i;t) etmxopio1am  liesl( arrrumo;u1tet  fcildls uan o t) rxomf oodfm r u i;s  eur(r3ou1alen fvslsfaDumxmp;u1aee  ietatfs2emuvsn(0 rxrir3tadlmtr nvs s) rxmxmpno4amt mnct sfaDtm( pot0oetoio3ilt a2umump;t4trtnxrcia1lmtrli i ( sexmxm3oydop e ivtatfsruax  ot4optnmiciydfmDranmpn() ltrmr oadfmDranvol( t2trxopnudale  nct (fsDrrx  ;o4aptn oeias a em(mp t0tltomr3iatfp ean o;s0s2uo(r oo4am  lfci tfs2trurpou0aeeoiietldla2rmn onu4aeeoircoy1lm eluvo s0texrio iudlmeemnei sfaDum(ro;u1alxniieiatfaDranmsnu0 exrxo tadoa  lneo (0s2urxo oydal   netlt aDurxm nt0optn f3iltls rlnvs;t)trtoxr3oo1omDrlneo s0 eto(rpnudaltnlnetat  rtrxr ou4tle ii3ildlm rluvs u4areomrctadfaDe iei;t) 2trim3no1aptnlncs ()aDrrum oo0tetnio3iytls ra(ms;()tleoxociydfa   iei;s)t2uoxm3ny1lm nmnvtatfaruaxrpno4alt mo3iadlm eanvs t)texomf3todlpDr uvols0sruo(opno1ome  fvt s  Drmxro;u0aexoiiciasfm elnmont0 lxrxociadfmD aivsls  exmxr oo4omtemfct t)a2ur(rp;u0ole mf3tyd aDeau s;(0 rxrifctadfatr nes;t0texr(o3oo4llen neiat s2uaumoot0oex ioctysfa ranmp;()alxoxocio1fp   nvs ()s2xo(opoy1ope mivtatf Dtaxr ;t4opx  ociysla2ul( s u) eeoxf iytfa eai ilt0t2umxrpiydome lnct t)a2tax  nu4olx  oeilt s2rlums;t)tlxnir ootop   ivi t)t2tm(mpnodolt lfviat) rtrur ;o1opxomfciasfs el(vo u4tlermo tadoa  luvs;t tetmim oo1op  lnct t)aDrr(rono0aet  ociydls rlump;u0tetrxo3oy1oa   i olt  ruoxo iudlp elieslt  Dtmumoou0olt miciadfs2uau s;()tetoifcoydlaD lu sls0trxmiopoy1omtnlfcsat) 2rrx onu4oleoioeild a um( o;u) rtoxf3oo1la  li s s)trtoxr3io4amtn nvtl( artrxr nu1tetn i3ildlsDuanvs ()aeermf3oy1omDeai s;s)s2umxmpnu4lle mivsat aDum(moot4aexo f3iltfa2rl( o;u0 rtnxr oa1opDr i o s0t2uoxr3iy1lpt mneslsf Drm(r ou1tee ifciydla2ra( s () etrxf tadfmD ln o;s)s2urir3iu4al   ncs s) rrmx oot4tlenmfciadfm2eanmont) lxoircoadfpte uvi s s2toimpny4opeemietatf 2ur(rpno1tlx  ictatfa2umuvpnu4texrmo to1fatrln s;s seur(r3iu4lm emicia(fsrtru o;o4opto o3iytls2uanvo;t0aetoxr3iotfmtrlu o s trumiopnydapen feiat srtau p;o1oltomfeildla rlu pn(4 exoif oa1lmteaneo;(0t2um(o oudlmeelnct ( aDur(ronu1tlenmi3iaslm rlnmo (0trtoio oydfpDeanvs () rxmiopoo4lmt  icsls)aDraurpou1tle  ocils a eluvs t4trtrxociytlmDelivs;s0seuo(m oydllte nctlt artm(m ou1aeenmo3tls mDul( o;()treoxfcty1fmDr ivs;()teurxr oodopeelfvtlt) Dua( o;t1ape mfctatla2uan o (0aexomf iodopteanvsl()s2ur(r iodolteliesasfs2tm(  ou0apxoiietlsls2eau s u4 lxoxo3iadfa rau o (0 exmir oy4om   fetas aDua(  oo0tltnmieiadlsDulnvo (4arxoxr oo1faD  ies (0seuo(m3nudom emieiatfaDuaxrooo1oexo fciltfsDuan snt0artnmo3iadlmDe iei s  eto(opoo4llen fes ()arum(r nu4olt io3iys m2elump (4aeenio3iydfaDeai i;s srxr(m oy4al  mfet s  rrr(ronu4tleoioetls m2uluvsnt0texoir3oa1lmt anvs ( s2uoxm3iudlmeemnvt (fs2taxrpou1oleniietyd s uanvp;t4trtnxocoo1omD  iei;t0texm(o3nu1lpee nesl( aruauro;o4oetnmo3iyslm2eluvo;u4 rxnmo3io1fmt  uvils sexm(o oydaptemiesa( a2rrum ;t1tpt  ictls sDelu snt0arerxf3oodfpDelivi t0 eurxopnodlleelncsltfa2urxmono0tle iocias a emn p;u)teermr3iotfateanvi t0 2trxo ny1opte nviat  rta(mpno1aex mi3iys aDrauvp;() exomociydfatelivo s0setmirpoy4llt lietas) rtr(rpoo4opt miciyd aDrm( p ()trtrmf oy1op  luei s)trxmir nydopeelnvta( aDrr(ronu4aexnii3iydfm2el(vs (0trxrmo3oydlpDe nvolt)s2xrir3no1apeemfesas)arra(r nt4tpxnmf3iasfaDumu p;t0 lerifcio1fpt aivs;() eum(m iodal  mfvtls)srtmum ot1oleomfciyt mDrmu p;(4aexnxocootfp r n i;t0 eumxm io4apte feilsfs2ua(ronu0oexnif3iltfaDua(vp;u0tltrxo ia1faDraies s  2xmir ou1ap e fvsa()a2tr(  ;t1alxnmiciytfsDum(mo (4arxrxf3totfa elnei;t0s2triopnodlltelncsl()aDurxm ;o1aet miciat mDumu o;() rxoio ty1fm rluvi;s)trxoio iudap nlivils)arumxm ;t0tpenmoeilsfaDeanms;()aeeoif oodfmt  ivols trtm(m3iodame mivs (fartmx  no0oee  iciatfaDua( on(4aexrio3oytfa e uei;() rum(opiy1lp  lfvsa( a2rru ono1tlx  ocild s2eau snu4 leoxrctodom e ueols0 eumirpiy1oltn ietat a2tax p;t1tlx  fctls s2ua(mon(0 etnxo iadlm eluvi s0seum(o nodlp nmivsas) 2truro;o1olen feiltlm ra( snt4 eenxf3iotfm elu sl(0trtrxr iy4lpen iei t arua(  oo0olenmoeild sDua( p;t0tlenmrcoadoaDrauvsl(0setoir3iu1llee fvt sfaDtau  nt4tpt mfeiat m rmn s t)alerir iydlaD livolt0setoxm iydlmtn icsls)srrm(moou4apen octys m2el( p;u)alerif iydfp  livo;t setmxo iy4lm elictat)aDtax p;o4oexomoeiad a2el(vp u0 rtoxr3iadoa e i s ( trxm(mpiodlmtnlivsat)aruaum ;t4alx  fctasfsDra(mon(0artrxo3iytopt  ieilt s2toiopoudaptemnvta() 2rrx pnt4apxnii3iysfm2emnms u0treoifcoadlp eai o ()sexriopiy1ll elfeils)a2rax p;t4tpt mfciyt mDrmu pnt4alerirctytfmteluvs;t  2xoio nudaltelfeta() Drrx pou0tlen o3iasfa ulnvs;u4alxoxfctodlp elnei ()texo(opno4ope lici sfsDrrx pnt1apeoii3iysfm2eauvs;(0aexoxrcta1oateau o ()t2umiopno1oltelivia(fsrum(rpot4tpxomo3tytfa2emu pn(0 eeoifcio1om elnes;t)trurxr3iydomte fcsa()s2tm(mont1oleo ictytls2uanmon(4trenif3iadlp  livol( t2to(o oudom emnvtas)srraxmpno1teenio3tyd mDraumpn()texoxf oatlaD auvil() 2tr(r3iydol nmfeilt)a2rrx  nu4tetnif3tat s rmnmpnu0arxnxo oydfateln s;( t2uoim io4apen nvs t)srrr(ro;u0olx mictldfm2ul(ms;t0 eerxocio1fpDeluei;s0 2to(o3no1op emnvi (fa2um(rpno4tpenmi3iatfa umump;u)teenxo todfmt  uvslt  exoir ou1altemnvsat  2tm(rp;o1opt ifctldfm rauvs (4aetomo tadfmDe n il(0setmxr3iy1ole lncias  Draxr ;u4aex  feias sDra(ms;u) leomo3tytopte n s ( trxrxmpoodamee fesl(f Draur ;u1tee mo3ild s emumo;(4texnxrcoadlm e n s;s sruoimpiudame lnvtas) Drm(mpno4tee  ociadla rl(mon(4 lxrxrcoo1laDelnvols)seumxo3oy4lltelicta(  Dtaur ;u0ope moeiltlaDrlnvs u)tetrmr iadfmtelueo;s)seto(opio4om nlfcia(fa2trxr ;o4alxn i3tasfs2ranmon()trerxr3io1fp rluvo;(0trurimpio4ole  fvt sf rua(rpno0teeoif3tad aDuaumpnt4artnxociodoateaueilt)srtmir iu1llenmiciat sDrau onu4tpx ii3iltfsDum( snt) lerxfciydomD aneo;s) 2urxr3ou4llen ivt t)aDumumono4tlxomo3tls a rln p ()aexoirciotfat anvilt0trtr(m nodape lictlt)sDrax  nu4optoifeiyd aDemuvpn()tltoxo3iytfpDeaneo (0tetmimpio4olenlncsas)srrrum ;u0optoif3ild aDuan s ()areriocoydfa rai ilt  exoirpoy1lpeelfetl()s2tm(rpot1tetn ocils m2ea(mpnu) lxnmo3oytla r nes;s) ruoxr3ou4op nmivslsf 2tru  nt1tpeoiictatla2uan o;u) rxoio3oo1oateluvo s0srxmxo nudal  livs (  2umxrpnt4tetomo3ilsfs ul(vp;t)tltrmrctadfa   ivo;t  2tmio oudap nmies t)srrmxroot0oexoifctydfs umnmon(0tltoxo iotfptrai s;(  rto(rpny1al emicsas  Drru  ;t1aetniieild m2rl(vp;()aexomo iadlptr i ols truo(r3oydal nlncs sfs2umump;u1apenio3iytla2rln s (4 rtrmo iotomD li s;t sexrxmpoodale  iei t)srurxrp;u0aleo o3iad m2rm(vpnu) exomo3tadla ran o;() etmio oo4omenmnctatf Dur(  ;o1tex io3tlsfaDrlnvo;t0aexoxr ia1la e neo s) etrim oy1amtnlnvi t)s2ua(m oo0tpto i3tytfaDrm(vp (4treoxfcoytlptraieo;( trxo(o3oo1ome lnvta() rrm( o;u4tetoiociad mDemnvs;u0tltrxrctodfp e ivo ( teur(mpio4llenlfvtas arua(mpoo0oeeomfeiad a el( s;() leoir3oo1lpte u i s0 rxoim nudlp emncia(fsDtmxm ;u4olen i3tadlm2rm(ms (0tlxnmrctatlpD lneilt0srtr(r no1omen ncs t  2tmxr ;t4tpto ociytlaDuln o;t0 lermrciadomtrli s ()sexmxr3ou1al  miet s)aDurx o;o1ole miciasfs umuvs t)texoifciytlm eaieils0srumir3oy4llen ivsatfsDta(m oo4tetomoeiyslaDeaumo;(0artnxo oydlpDraueo (0s2xmxrpny1op   fetlsfs2rrxm nt1tpxomfctasfs2rluvpnt4tltoio oy1optrlnes;s setmim3iu1altelfvtatfaDrmu p;u4oltoio3iytlsDrm(vsn(4aetrir iy1lmt lnvil(0teur(mpio1ope  fvsa(  2rrxro;u0aetn f3tydlm rluvs (0trenxocio1fp  auvol()s2tr(opio1alenlfctls s2rm( ooo1ale ii3iydla2ra(vs (4 ltrmocoytla rlnesl(0t2umxo3oydomt  fes s)a2trumpou0optoio3tltfaDeluvo;(4alxnxfcoytfmDelu s;(  rtmxo3nudaptnmncsl(fs2raxrpnu4tlen octadla2ea(vp;u) lxoif iy1lm  aueils0trur(o iy1apenlies t a2raxm ou0oexomo3iytls2umn o (0trxoxf iodfmD  u i () rtrxmpnu1ap  mnvia(fsrumu pou1tet ifeiydlmDra(vp;()tetnxf iodomDe uei s)seuriopiodlltn ncsatfsrtmurpoo1opto f3iydfsDum(mp;(4texnir3ta1lmDr uvol()teuo(o oo4lle  iet sfarta(m ;t1tlxniietyt aDul( on(4 lxoio3ta1lptrln i s) 2uo(o oy1alen nvs ( a2rmxr nt1tpeo f3iytlmDrau s u4aexomo3tydfm r uvi ( srurxm nodlmtnmfet ( aDra(mo;u4aexniocildls2uanmp;t) lxrir tydlate i sl()s2toirpiu4lpeemfeiltf Dtau ont4oeenif3iyt aDelumo;u0 lerif3oytlpt  uvi s trur(o3iydllt mnesas  Drm(ront0opxo feiatfs rl(mont4tltnir iatopt ai o s srtoxopiydolenlnvta(fsrrmum ;u0aptnii3ilsls2rln p;(0trerxo3oo1lmte nes s0s2toirpoy1lpenmfcsltf Dur(rp;u4optnii3iydla rmn p;u4teeomf3iytlp e ieo;s)s2urio oo4altemict ( a2rmur ;o4oetnioctatlm umnvp t0altnmrciotomDelnvo;(  rxoxr3iu1lmenlies (  2ur(ront1aptn f3ilsla rln o;(4 exomr3tadomDe ivs s0s2trir3nodape lfvia( s2uauro;o1oltnmfeiadls2rlnvpn()aeeoif3iytop   uvo s)t2ur(mpiy4omtemieias)aDumur oo0oetoif3ildfm2ean p t0 lenifcootfpt lnei;s)trur(rpoydamtnmivs s) ruax pno4teeoioeiltlsDra(mp u4arxnir3iatoa eau ilt  rxmimpoodolte ncsas  Dum( ont0aptomfeils s2ea(vo u)aleniocoa1opDelieils0srxm(o3nu4apen iviatf Dtrur no0oexnmietyd a eanvo u) exoxfctytop  aivo (  rtmirpno4am n feiltf Dumurono0alxnmo3iltla2ul( p;t0texoxo3ty1oaDrlnes s)teurxrpoydapte iesas  rumur ;u4aexoio3ilt s2elnmont)artnif oodfpD  neilt0s2uo(mpnu1amtnliesls  2ur(r nu1apeomieiat m2eauvp;(4aexnxr3totoa e ies t trxrxm oy1lltn nct (faDraurpnu4tpe iociyd a elums;t4aeenir3io1la  li o s0texm(m oo4opeemfvilt  rrrxrpnt4olxnmoeild m rmu o;(4arxoio tydlm elnvo (0trxmxr3nydlpee nvsatfaDtau  ;u4aet  feiyslaDeluvon()alxnmfciotlpte ivo;()teum(mpoy1optelietl() rumxrp;u0apen iciadla rl(vp u)alxrmfcio1lpDelivol() 2trxm ny1llee fvslt)a2rrumpnu4oex mfcilsfm rlnvonu) eeoxr oodlmDrau o;s0 exoiopnudllt mfeilt) 2rmxr ;u4olxnif3iasfm ul( o t) rtoxo ootfpDeaivo t) rxo(opoydolt  fvsas) 2tmxm ou1oet moeiyslsDeanmp ()aetoxr3tadlaDe iei ( sexmirpoydomte ncsl(fa2umur ;t0aleomfciltlmDuluvs;t4 etoxf3tydopt anvi t srumimpoo4ap   ncil( aDurx  ;t0tpx ifciys a2rmnvsnt0 lenif3io1op  aueo s) ruoxm iu1lpeemiesat)s2umxm oo4teeomieiatla rmn pnu0 exomf iydom r ieilt  rxrimpoo4opee neil( aruru onu0oeeoifetys sDeanvs;u)arenmrcoo1fmteluvol( sruoxr iu4ape mfvi (fa2taumpoo4optnif3ildfa elnmsn(4areoxf3iydomteanes;( srtr(r no4am n ivtat)a2urxrono0apenifcildlaDelumsn(4arxoif to1lp e n ols trxoxm3oo1amenlfesat)sDrr(m ou0aetomi3iltla2ea(mont4 lerir oodfaDrlnvsls)setmxmpiy4open ncta(f Durxrp;o4texnifciasfm2eln o t4tetomo3ta1lpteaueols trtrimpiy1apenmnvil()arraxronu4oleo i3iydfaDem(vp u4tlxrmo tadfa  lieo;(0 2trxr3ny4amen fctasfaDumx ono1optnmieiydla2rlnms;(4teermr oodlmD  uvo;(0 2umim oy1al  lics s a2raxroou1oexn feilslmDranms t4 ltrmr3oo1lpDrauvs;t)srurir oy1ame lncsas  rtrx oou1aexo ieiytfmDem(ms (0arxoxf todlaDe n s;(0s2xoxo3oydame lnes ( a2rm(mo;o0oexnmfetadlsDemu p u)tltnmrciodoatelnvil() 2tmir iy1ole lfvi s arta(  nt4tptnmociltfaDra(vonu0 leoxo3ta1omt  ueils0t2xo(m3no1lltemiciatf rumu ono0tex ioeiyt sDumuvpnt)tltnmf tytfpt  nvi;s  rtr(rpiy4amen nvil(  Dtaumo;u1tlxnmiciad s2uan s u0areoifciodoa  lu sl()trum(mpnodlleemics tfsrrmxrooo4aetnif3iytlm2rl(vs ()arxriocoy1opteau s;s0t2uoio3iy4amen fei (  2ta(mp;t1tpxnmfeildlsDul( s u) etoxo3oytomt lues;()t2tr(r iudom nlfvi s sDta(r oo1tpx  f3tyd s2rmums u0 ltrmf3oa1fa  aneil()teurirpoydapen ivias srrmxrpno4teeomfeilt s2raumo;(4tlermo3iytfa   u ils0seuo(r ny1op  mnvi s aDtrur no1oeeomfcildfaDuan ont) lxnxrctatopteli i;( sexo(m3oudope lietlsfarrrur ;u1opxn i3tatlmDraumon(4aeenirctytlmD aieil(  euo(o3ou4lm  lncsat arur( ont4oeen iciydlm2ua(mont)artnxrcio1fpteanei;s)texo(m oy4ole lfvtasf Duaurp;t1olt  octldfmDrm( s u0 rxrifcoy1fate uvolt) 2xmim3io1ol   ivtasf 2umum ;o0olxo oeiyt sDuauvs;t0arermociydlatelnvs (0 rtoxr no4al emfvi tf 2urum ou0oltniociyt a el(vp;u4 renxociodlp   nvi;(0sexr(mpio4lp e fcta() rua(r nu4olx mfctys s2em( snt) etnmo todlmDraieo;()trur(o oydolee ivtat  rtmx pot1aee ifetltlm rauvo;u4 exnmf iytfpD anvo (  2urxrpoo4ome  nvta()srrax p;o0alxo iciadlmDrluvp;t) rxoxfcty1lpteaivils trxmimpno1olenlfvia( sDrr(m oo4tptn ociydls2umu s u4artnif oa1fp  anesl(0setoio3iudlmeemfei (f rtaumpnt0tleo fcild s umnms u0 rtrirciotfm   ivs (0 ruoimpoy1op e feta(  2taxmoou0texoioetasfsDulnvsnu4texnmf ootlptran i ( t2trxo iy1lmtelnvsa()artmur ;u1tlto i3tldls ea( p t)tltrxr oatlmtelieo;s0 eurxo3ny1al e nci (f rurum nt1tet iociadfs2rluvs;u0aleomr3iydoaDeauei;s) rxm(r nodol   ies s s2rm( o;t0tleoifciatfa eauvpnu4aetrmfcoo1lm eaneo;(0s2uoxopoo1alenmnvsl() 2tm( o;t4aetoifetatfs umn p t4tetoxr3tadlat lnei;t0srtoxm3io1omte ictat) Dtmxro;o4openmieiyd s2em(vp t0alxrxoctadopt livils srtm(m nu1lmtelfesas)aDumum ot1apxoiieildlaDulnmon(4aeeoxf ia1lpteli ils0trtrxmpoodll   ivt s  Dtm(moou0aeeomfctas s emn o (0teeomo ty1opDeaneo t0 exm(o nudlpeeliesl() Dtr( oou4aetn f3tyd sDeanmp u4 etrmr ty1fa e ueo () rur(opnu4lm nmnvilsf Durum oo4oee  fciad s2emnvo;t4artrifciadla e ieo t seur(opoo1ome lnviatf 2urxmpoo0teen f3tlsfmDran s;u0artrmf totlm r neslt)t2umxm3nydlpee ivs () Dtm(r ;u0aet  o3tatfs ua( p;t)alenircoatom eaivi;t0 rtriopiu4optnlfvtas s2trurp;u4tltoif3iadfa2umnmp;t)tlxoir oa1lmt  i sl()teum(r3oy4lmtemivtl()srumumo;t4apt ioeiyt s el(mpn(0trxoxf iodop r ivs;( t2umiopiu4ome  neslt) Durxrpou4aleoiictadlm ranvs t) renir oodomt aneil(0s2xmimpou1ole mfci tfsDtm(rpno1tlx iociatfa2el(vpn(0tetrir3iodlpt lieil(0seumxo oodll  lnvtlt  2ua(r no0tpe iicilt s2umu onu0artoio3tydoaDr ivo s0trxmxmpiudol n ncs tf Draumoot4tle mo3iyd m ul( p u)teenmo3totfm raivi;(0trtr(o3oydllee fvil(  ruaxm ou0oexomietat m2ea(mo;t4tetnxo tadfmDe i o;s0seumim3ny4alenliesat) Duaxr ou4apt iieias m ul(vsnu0 ltrxo3oytoatrln i;()trtr(opiu1opeemfvsasfsDtaxrooo0aleniieiytlsDumn s u)teeomf3ty1optrai s s t2xmxr oydame mivt (fsDrmuro;u0olxniiciydfm ea(von(0trxrxo3oydla rlnvs;t0srxoxm oudlp elivi ()a2raum ;t0tee ifeiys s uau pnt0tltnmo oytop e uvi (0s2urim3no4oltelfcsatf 2rr(mont1oeenmietytlm rm(monu)arxoxr3io1fa eli o;t0trtmxr3nodlmt  ivtls a2rm(  ot4texo i3tas s emu s ()alermo3iotfateluesls)teumxopny4ap nmfcslt)aDrmuronu4oetnifctadlsDelnmpnu)alxomrcta1latr uvil(0s2trirpoy4ap e ivt s)a2urx o;u4tptomiciyt s uaumsnu0 lenxo tadfpt  i s;t0s2uo(o3oo1ap nlncta() rra(m oo1oetoioetadlm um( onu4 rermr ootfa rli o;t srtmio3oodlp   nvtl( s2ra(m no4oetoiietatlm ea(mo u)aleoxo ia1fa   nvs;(0s2xr(m no4lpe  fvt tfa2urxm oo0olxn ieildls uln p;t0 rxomr totfaD  u o s s2tm(o nydaptelnvslt a2rrxroou0oetomociatfa2el(mont)alxrmo3oodlat auvils0srum(m3nodopeemictl(f rtm(m ;t4aeeomfeiys a el( o;u4aeenircoydlmD ln ols0 exmir3iudopeelncs ( srtmxrpnt4opt iieilsfm uanmp;t4 lxrmf tatlpt  nvs ( setr(r iodom nliet s a2taxroou1tex mfctytlm umnms u4 ltnxo tatla ranvs;t)t2umxr3oudolt  fei t)s2tmu pot4optniietlsfs2umu p;(0aexrif totlpDrlneo;s)trtmxo3oo1am  mieslsfs2ra( pou4tptn f3iltlaDea( on()alxnxo3oa1fat ln o;s s2uo(mpnu4ll  mncias  Dtaurpnu4optnmietys s2rlumonu) etnxociadlmt lu olt0setrxr nodamen nviasfsDrrxm ;t4aeenmi3iatfaDelnvpn(4teenio3tytom rluvi ( trxrxopno4llenlfvslsfsDrmx  ;o1apt mieiltlm rauvpnu4teeoircto1lpD ln s;s0t2trim3oo4am emnei (f Dum( oou0aeen f3iydls2uauvo;t0 lerio3tydfaDrln ols  2urxm3io4olt  ivt s  rumx ono1tlxnifeildfa ul(mp t)texomf3iotfa elnvs;() rur(r3io4optnmnet tfarrm(mo;u0olxomf3iadfsDuaumo t0tetrir oo1opDrlueols0srxm(o3nudlltnlivtas s2trump;o4tee  i3tat s em(mon(4 rtoxr3tydfm rauvi;t0tetr(opiydomt  fcs (  rrmx  oo0oexniieilsfaDuauvs u0 etnmociatom   uei;( s2tmio3nodamen ieta( a2uax ooo4tltoiicilt s eaumsn()aetniociatopDelneo;t srtmir3oudol e fet tfartaxm ot0tpeoioetytfa2rl( snu)tetnxo oo1fpDrau i;s) etmxm3io4ole  nesls)sDuau poo4apx mi3ilt s rau o;u4tltnmr3todfp eanvo s) 2trio3iudomtemfvs () Drr(r oo4tptnmoeild a ua( p t)trxoxf iadfp e neol()teum(mpoodlpen fvta()a2tm(mooo1optn ictltls umuvon()treomf oadfa  aies;s setm(m nu4oleelfei t)aDrr(m nu4altoii3ias s2em(mp;u4 ltrmf ta1fm   ivs s)s2tm(m3oo1ome  fvi sfa2uau p;u4tpen ieiaslm2rlu p (0trtrifctodoaDe uvi (0t2xm(m iy1lp emncs s)sruru p;o1ale  fetltfs emnms;t4 lxrif3tydom  auvi t0trtrxrpny1lpenmnei t) rrax oot1aexnmo3iytlsDea(mp (4tltoxrctytoaDraieilt) 2urim3iy1lp n feiasfs2ra( pot4aeeniieildlmDrmums u)arxnxo ootoateaueo;t) exm(opny4altnlnesat)sDta(  ou4oex moeildls emnms;u4 rerxf3tadfmDr ivs s)s2xr(o3ny4lpeelncs ( a2rrumo;u1ale mo3ild a rm( s (0altomf iodlatrlues t t2xm(m iydol elnes t)s2urumo;o0olxomfeiysla rlump (0tlxrxrctodlpDe ues;s tetrxopny4llt  nesl( sDrm(moot1oexn iciad sDul( pnu4tlxomo3io1om rlu o;s0setmim oo4lp nlnvsl(faDurxmono0oexn oetysfsDulnvs;(4 rtomfctydoaDraiesl() eurxr iy4amt lfci t) Duaxm ;o0ape ifciyslm el(mo;u) rerxocty1opteln il(0teuoimpio1lm emneiat) rrrurpou4olxo oeiaslsDumnmon(0 rtnxf io1fmDrluvs;t) exo(o3nydam nmieilt)arrmxrpnu1aee mfeiad a rln s;u)areomf3iadlat anvi;s) euoxm3no4am  mncia(fsDtrum oo1tpen o3ild s2ra(ms;(0tlermr3oy1fmt aiesl(0 eur(o ou1ole miet (fs2ua( pou4oet if3tlt a em( s (0aetrif3ty1lm eaieo ()trxmio oy1altnmicslsf rumumpnt4altn ieilt s elums t)altoir3ootop   ivi s  2urio3iu1lle mivslsf rta(  ou0openio3iyt s rl(vp;u4arenmrcoydfmDr ues ( s2ur(mpno4opt lfvs t)aDra(mono1aptn ieiysfm2rauvo t0arerif3oydlptraivo;(  etoiopnodlleelnetat sDumum oo1apenmi3tyt s umump ()trtnxo3tatfaDeaueols0 etmiopoo4lp  miei s) 2uaxrpnt1alto f3iys m2ranmpn()tltnmfcto1om r u slt)t2uo(rpiy4lpenlfet (fartau pou0tetn fciydlaDrln s;u)aetrxo3oodfa elivils0sexrxrpnu1alenlfcs ( sDurx pot4ale  feilt a uan onu)altrmo iotoa e i i;()t2tmxo oudale lietasfa2taxmpou1olxomfcias aDrmump t4tlxnir io1om elnes;t0 2tmio nodlmtemnesat  Dtmxrpnu0tle  i3tytfmDrmuvo u0trenir3todlp ranvo;s)texriopnu4amte ics tf 2umurono1tee mf3tat aDumnvo;u4 renir iodlpDr ivo s) 2uoxo ny1llteliesa()srrm(rpoo4alt  ieiys a uln snu0artoio io1oaDran o;() rtrxo nudolt  iviasf 2tr( p;t4tpeo feiyd m2em(monu0 lxrio3ootomDran s () 2ur(o nudom e ictasfaDurur ;t4olxomfciltfm2emnmsnu4 lxnmr3ta1fmte uei;(0 rtm(o3nu1oleemfvs t s2urumono4teeo iciydfmDumnvp (0altoxo3ta1om raueslt)sexoxr3io4am  lnetatfa2trx  ;o4oleo i3tas aDemnvpn()tlxrmr3tadoat au o;(  exrim3nu1lpeelnvt tf rtmu  ;u1aee mi3tatlm2el( o;t)trtriocia1fatrlieo;(0setm(mpou4op   ici (  2rmu  ;t1texomfciltfa2eauvs;u)altnmfciy1om ranvi;(0 ruoxm nu1lpenmnvsltf 2trxmoot1tlen ociysfs2rmu s t4 eerxr iy1lpD luvils0 etrimpou1lpt livs (farumu  ot4aexo o3ildfs umnmo u0aexoxf tatlmDelu i t)tetmirpiu4ome mics (  rtr(r ou4tlen ictytfmDumumont0aexomo iadla rli ol( s2toio iodlltemfvslt  Dtmuro;u4tptn fciys a em(vp;()tlerxociotfatr nvols)t2trxrpoydopeelieil()a2rmx poo0tlxoioeiltla2ua(vsnt4aexoxo3ta1faDe n s t) 2urxmpoo4alenmnesl( sDrmxmp;o0alenii3tltlsDua(mp;u)tlerirciytfmD lnvs;s t2uoir oo1lm nlfvsa() 2raumooo4oex mi3iat a2eauvo;t4 rerxo tatlatelu s t)trumxopiydlp nlnei sfarta( oou1opeoio3iat sDrm(ms;(4 reoir oy1fpDeli s s)s2xm(rpou4lmtn iet tfsDumxmono0opeo ociytfa2rmuvs;()aeenxr to1lmtrlueo s  eurim nu4omtnlnvtl( artm(monu1apeoif3tldfmDeluvs;u4 rxoxrcoytoaDraies t0s2xrxo io1op n ncsas  2tmu  ;t0tlen oeiasfsDrmu o ()tetrmr iytop e u o (0t2xmxm iy1opee ivsa(f 2urx pno1apeoifeiyd aDumnmo t0 rxoxr oodfaDe i s (  rurio oy4altelnvt (fartax pou4oltomiciaslm2rlnvs;(0 eeoxr oodlatr ivi t0s2xoxm oydolte ncsl(  Drmur nu0tpe  i3iadlm rmuvo t4 rtrmocoy1lmDrlnei;(0 exrxo3oy4alee fcs s arta( p;t1opxomo3tys sDran s u0 lerif3iodlm elu s;(0t2ur(rpiydlpenmicil(fsrrrur ;o4tpenmoeiydlm umn o;(0tlxoir3oa1opt auei;t)seur(r3nodapenmivslsf Draxmpnu0aetn ieilsls rm(mo u0 lxomr oatlm  luesls) rxoimpny1llee ncsa( s2uax onu4tltnmictatls2emu p;(4 ltoio3iytom eli o ( teurim3nu4llee fcils) 2umxmp;t1optomi3iltfmDra(vsnu)aetrif tatlmDelivi s t2ur(m3ny1al n iei s) Drm( pou0optoiieiytlmDrm( o u4alxnxo3iy1op ranvo;t0setmxrpiudome  iesa(f 2tm(mpnt4aee  icild aDrau o;t0 lenxr3oydfate u ils s2tm(rpiy1ap e ivs t) rtaxmp;o0apen iciat sDrm(vsnt0 etnif3io1fpt aieo t)truoio3iydll  mfvt tfs2tau  ;o1aleoioeild a2eanmsn(4tleoxf oo1laDeaivs;s)texmim3nudal nlfeia( sDrrur ;t0optomiciaslm2um( p u0 renxociytfaDeanei ( seur(opoo4alt  fct sfartmumpou1tltnmo3tas a2eanmpnu)altoxf to1oatr neo (  rtr(r3nydapt livt () rtmump;o0tptnmi3ild m2elu pnt0 lenmocty1la   u s s  rxoxo oydamte ncta(fa2ra(ro;o0oltoii3iatfs2rmn onu4trxoxr3oy1fpD lu o ( trxmimpoodomenlfvil(  Dum( p;t1apt  octysla2ra(vpn()aexrmr iytlmDeanvi s setrir3iu1aptnlnciat a2trxm ou0oetniieiydlsDraumsn()altnif totlm ran o;s s2xo(opnu1ll nlfeiat) rua(  nu4aetomf3ias aDra(vsn()tltomocoy1laD  neil(0 exrxm nydope lfcilt srraxm ;t1olxo o3iltfm umuvsnt)aetrmocoo1lm  aivols) rxo(o3nu1ameemfctls)sDrrx p;o1tlx moctlsfa em(msn()texomf iodfaDrluvslt)t2xoio3ou1apenmiet t)arrm(r ;o1tlenif3iytls2rauvont4alxoir oodoa  aies;()s2uoxr iy1om  lneta(fa2tr(rono0olxnmieiasls2el(mo u0 lxnmr3oo1oatrlu o;s)srxmim ny1alee ivslt  rtmur nu1altomo3iyd sDeluvo;t4 reomfciy1omtean s s  exrxo3iy4aptelfcias srraxm ;u4aeenmo3tadlsDum( p t0 rtrmrcootlaDe nvols)tetrxm3oydame  nvsls  Dumxmooo1oee ifciyslsDemumo;(0 rxoif oo1oat  i ol() 2um(mpiudomtemfcsas)aDtau p;u0tpxo ieiydls rau p;t) eeoif3io1fatr ivs t srtmxo ou1amtelictas artaxmpno1opx  ictyd a2um(vs u) rerirciytlatelies;(  exoim3oy1omtnmfeiat) rtmu p;u0tpeo ieiad s2ra(vp;t) lerioctadfpt  nei;s setmir no4llee ieta( a2umu  ou4tpeoio3iatfa2rmnmp;t0tleomrcoodoa r u ols)s2trir ny4lmt mici tf rurxr ou0alx ifctytfmDelnmonu0 reomo3oodfa rln i;t teurxm3nydlltemfes s)sDuax o;o0tet miciat s eau ont4altnir oa1omteaieo;( truoxo3nu4olt mnctas  Dumu poo0opto iciadla2eanmsn()arerxf oytfmteauvi;t0 rxrimpiy4ole  fcta(fs2rm( o;u0apenmf3iltfm2emnmsn(0 rxoxf3iotoaDeaiei;( srxrxm3oydop e fvi s artmu onu0opto i3iysfm rlnvs;u0arerio iatoat an o;t0trxoxm oudlp   ncil() rrmxmoot0tlxnifciadls2eluvsnt)teerxociydfpt  n o;(  rurimpnu1ll nmnei sf Dumur nu4oee ifeiasfa ulu p;t) exrircto1late nvi (  eumir3iy4apeemnvtl() Dua(r no4aptniieils m raump ()aeeomocoadfmte ieslt0trxo(opoudopt  ncils aDrmxr nu4apxo feiyslm rauvsnu0trxrmr3tatfa   u il()texo(m iudap  mfetls s2trx  ot4tex  octyt sDeluvonu4aexnmrcoodoatrlnvols)seum(opiodlmtn ici s artaxro;u1tlx iociydls emnvp u)tltrmo3tydfm   ueils0trtmxo3ou4al e nvtl(faDtaxrpou0tee mociyd a uan o t)alermo3iotop eluvilt  rtr(opoodol  mncsas sDraum oo0altoifeiysfs ulnvs;u0 rtomf oo1opDe nei;(  exmxm3iu1lleelnvsa()a2ur(moot0aex miciatlmDrmnvp t4aetrxf ia1fmteau i;s)setoim iydlm n nci ( srum( oot1opx  fctas s2umumo;(4trtoioctodlmtelivi t)trtoxr3oy1lleemncsls a2ua(rpnt4oexomfeiaslmDel( onu)aeenmf3iodfmte ivilt)s2trxo3oo1lpen ieiat s2trum no1apenioeias s2ulumo;() lxoir3totfpD  n ils  eur(r3ny4lptelfvtlsfsrtr(ronu0optomf3iat sDua( o (4trxomo ty1optrln o;( s2xmxm io4ale  fei t)aDrm(r ;o4tpx io3ilsfmDuaums u) ltnif io1fm elu i;( t2tr(o3nu4optelfci t)aDrauront0alx moeiat s2ulnvo;() ltrmr3iatfpt ai o;(  ruoxo iodom  lies tf 2um(m ot0open i3tadfm rauvpnt0trtomrctotfpD lnei;( s2toxm io4lmtelivsls)sDra(roou1olx mfciydlaDumu ont)arxoifcoydlmtraieol(0truo(mpiy4ol  lnvtl(fsDrrxmpou1aetomi3iyt mDeluvs;(4texrir3iadomD anei s)trxrxr iu4lpt mncsas) Drax ooo4ale  i3iatfm eau p;u)areoxr oytom  lieo t)s2xoxr3oo4op e ietl(fs2uaum ou1texniietlsfmDem(ms;(4aetnir todla  lieol(0trxmxmpoydomenmiesa()srua(mo;t1aex mf3ilt m2ulu s (0 rxnmo3to1lateliesls t2xo(r3nodoptelfeta( sDraxmono1aeeo fctyt s2em(mon(4alxnxo tadlm r n s;s0srxrim3oydole  fcia(  2trur nu0oet iociatlaDeanmo t)texomr3iodopD an ilt  euoiopoo4ll nlfvsat  rrrur ;o0optnmoctysla umnvpnt4trerircootoaDeai il(  exrxm3ou1om emnvi t)srumur oo0oeeoif3ildfs2ul( o;u)alxnxrciodoa rlu s;s  2urxo nydllee ncsas)s2raxronu1tltoioeiyt m2ra(msnt0tleoxrctytlmDeluvsl( trxoirpiodap   nvsatf rrau p;u1teeoifeild aDum( s u4tlenxocoadlp rlneol()t2trirpno4lpenlictltfa2tax p;o1alt ioeiltfa2ulump;u0teeomrctadoa ranei;s0tetr(o io4altn fvi () 2tru p;t1ope  fciadlm eanmpn(4alermr iadlat  ivo;t setrir3no1omt miei tfa2tmxmo;t1aleoioeiysla2ul( p;u0 etoxo3ta1fmtrlieslt s2xoio io1lmenmietas) rurx pnu1tpxnmicildfaDelnvs u)alxnmocio1fm eli o t) rtrxo iy1lpee fei ( aDtrumonu1tpxnii3ild aDrlnvo u4trenmfciodlmteaues;s)seuoio3iodome mncsltfa2ra(monu0apenmfciytfa2elump;(4 reniociy1lpt auvsl()sexrim nodomt lfctltfaDum(m ;u1tlxo oeiatfa uanmp t0aeeomf3ty1fa rluvs t) eto(m iydlp e nvilt)sDraxm ou4tpxnmfeiyd m2rl( p (4artrmociodlm eauvs t0trtmxmpiy4lmtnmnci t sDum(rono1aeenif3tatfmDrl(vsnt4trtrif iadlpDrai ilt0t2toim3io1amt mnvilt)s2rrxmoou0aee mfciltla2rlnmp () rxomr3to1laDelneils0teur(r3oodal n feils a2ra(m ;o0tlt mieilt mDum( s t0alxrxf ia1lmDeauei;s trumxrpoudlpt  nvtl()aruru  ou4alxomiciadfs umnmsn(0 etnmrctatfaDe uvsls)setoxm3oudomt lnes s s2raxrpnt4tpxoif3iysfm em(ms;t0 rtnirciatla elueils teumirpnu1omt mfci ( a2rm(rp;t0oexnmi3iyd m2em(vs;u)altrmr iy1op eln i;()srumxm3nydopenlfci t)s2uaump;o1ape mfetltfa2rl(vo u4 etoxo3tytlpt  nvs s teuoxm nydape  ncils)srrmxr oo0tptomfcildlsDuaumo t4 rxoxf to1laDr u sl()tetoxr3iodal n ncilsfarurxrpno0tltoifeils mDuluvs;t0 rtnxfciydfa r ivs t0 exoirpoodamee fes sfa2ta(  ;o0altoioctlsla rm( p t4arxnxrctydfmDrluesls truoxrpnu1ameemivs s sDrru p;o0oeeoioeiysfs2rlu snu4aeerxr oa1omD ln o;s0 rxm(m3oy1omte fes (fsruaurono1opeoiiciysls2um(von(4arxomrciy1optr iei t0sexrxm iu1ole mnesat srurxroou4ale  feiatfm emuvs;(0trxoiocoy1fatelies ( t2um(opoo4op  mnvtasfa2trx  ot0opt  o3iadfa uanmo t) eeoxr3iotfat aivi;( setoxrpny1amt  fcsl(fsDum(moou1tpe miciasls rmuvp t4aeeoif iy1lmtranvi ( setrxm3oy4lpenliet sfarum(mp;t0oeen o3iys m2rlnvsnt)aexoxocootoptrli ol() rumxr ou4amen nctlt srrr(m ;u1tpxn ietldla emu s;t) rtnir tadfatrlu sls) etoxopnu4om emics t  rrrx pou1apenif3iysla ranmont4aeenxfctodlm raueo s0t2umxo ou1alt mfes t a2rrxm ou0tptnmo3iat a umums;t4 exnif iy1laD  ieo s0srtr(r3oydlm  lnctasfsDrm(ro;t1oetn fciad s2rl(mp (0aeenifcty1fatelu i t  exrxm oo1omtn fci sfsruaxr ;t0tlx ii3tysfaDeln o (4arerir3iy1oa elneo;t)srxmxopnu4lpte fvs t s2umumo;t0olxnmieiasfm rmuvo;() eenifcoo1laDr i s;t)t2uoxr nu4aptnlivta( srrr(mpno4oleo octldfa2umn p t4altoxf iotlm  an i;s)tetrirpnu1omt mfvt t  rurxmp;u1aeto oeiadfs ranmo;(4altnxo3todlp e i o s0setoio3iy4ol  lneslt)s2umxr ;o4aptoifciad a2rm( o (4trxoif3ia1fp eaueo () 2urxm3io1omt lfes t aDumx  ou0tltomfetltfa rl(vo;u4 eeoxr3ty1fmtelivi t t2xo(mpnu4olenmics ()sDur(m ou1alxo oetyt a ulnmonu4arxomocoy1oaDrauei ()srumxrpoy4omte fcias) rtm(  no4opt ioeiatlsDeluvon(4tlenmoctadlateaies (0s2xoir3ny1omtemics ()s2tmxr ot0tex ioeiatfmDra(vo;u0aexoifciotomtrluesl( setmxm iy4omee fesat srtr(mont4tpeoioctlsfm2umnvonu4alxnxo to1lpD  nvi;t0 rtoir iodap n icil()a2urumoot4apxomoctadfmDeluvo;()tltnif3todlm  auvs;t seto(mpiydamt mfvsl(fs2tru ooo1alxnmieiatfa ranvp;()treoxr iodlpteanvslt0trxr(rpnodoptelnvt tfaDta(  oo4tlxo feiatfmDuau s t4 lermo3totlat livi t)t2tr(m3iodlm  lfvilt a2umuro;u4tlenio3iatfm2uan snu0treriociodfmtrli s s  exr(mpnu1amee fcia()srtr( o;o4tee if3ils sDumnvo t4altnxrctotlp ran ols)trxr(m3iudaptemnctl()arraxmpot1oexnmieiltfaDranvsnt0altoio3tatfpt aieols0s2tr(rpiu4ap emivtls) Dur(m oo1aetoifciyslsDel(vo;(0 exrxoctodlp eai ol()sruoir3io4ale lncsat arurumonu1tlxn fciad a ranvp (0aexoxr3tydopDr nvi;t)t2trim3iodlle mnvtl( sDumur ;o4apxniociad m ul( s (4alermr oa1lpD  iei t0teumxr nu1aptnmiet s)aDumx p;t0tltoiociatls elumpn() lxnio oo1fmD lu o t  eum(rpoy1omt mncil()a2rrx  oo0tleo ieiatfsDeln p;t0tetrmf ia1lpD lu s ()trurxopny4om nmivtas)srtaurooo1oeeoifcilslm2uln p () ltnxoctytfm  lnei;t truo(rpny4lmtnlncs t s2tau oou1altomfetld a ranmsnu0altrmf3todoa  lneo t trxoir nu1lpe lictas) Dta(ront4tex mo3ild mDranvs;t4 renxfciodlpteaivs (0teurio oo4aptelfvi s)artmu o;t0teenmfciadfaDraump;(4trxoxrciotoaDeaivs;( srtoxrpny1op nlfctat)a2ra( o;o4olx if3tlsfs2rmumont) etomf3oytlpDr ivol(0seumimpnodoleelieslt aDtr(mo;o4tpt  fctadlaDuan o t0 leomr io1oate uvs;(  rtrxr3io1amenlivt tfs2rmuroot0oleomieiyd a rln s u)tltnxociy1fp e nvo t) ruoir3ny1altn iet ()arraxr oo1tetoii3ildfm2rl( pnt0tltoxfctodlmtrlivi;s)s2uo(mpiu1op nlnctlsf rrr(mo;t4alto iciaslsDrl(mp u4arenxocty1fp eauvols srxrxm ou4ap  lictat  rtaxr ;o0open ictysfs ul( p u4altomrcoodlmDr uvs s0texo(m iy4omtnmicilt)sDtaxr nt4aetoii3tad mDemnms t0aeenifciatopDe ueo;s)trurxrpiy4altemiesls)a2urxr ;u4ope iociydfmDea( s;u0teermf3iadla eanei;s0 2xrxopio1lptn ncsas aDurur oo0opxnifeias a2rl(vpnt4 lenxf oy1omt aivi s) rto(opny4ll n fcil(fsDtm( pot4tpeomiciysfa ua( p (4artnircio1lpDelieo t0s2toio nu1apte nvil() Draumpoo1texnmfciys s rmu p;(4aeerif3oytfptran o t)srtoirpiu1lle lfcs t sDtax  ou1apeo f3ild a emnms;u0tltnmfciotom r n s t  2xmxrpiy4ape  nes tf 2tr(mp;o4optoif3iatfm uauvpn(4alxomo totfmt lneslt srtoxopoo1apee nvtl() Dua(moot4oleomieilsla2rlnvon()texrmr3tydfaD ai i t) rumxm3ny1lpeemnesat aDrmumo;t1altn iciatlmDrlnmpn(0aexomr oytfpD lnvi t0 eur(o oy1lmtn feias aDta(  ;o1aleo i3iydfs2ra(mpnt) lxnmo oodfp   n o;s  rtr(opio4llee fesl() 2tmumpoo4tetnmocias s2rluvs t0 etoioctodlp eli o;(  etrimpoy1altelnvta(  rtau  ;o0oeenmo3tas s2ranvsnu)arxrio oatomtranvi;s)trtr(m3iydomeelfvils  rrrx o;t0alx ioetlslm2el(mpnu0trerxo oytom elu ols seum(r3iu1om  mfvt ( artrum nu0apx ifeilslaDem(mp (4 rxrif iatla   nei (0t2umxmpoudlm e neias aDtru onu4aet iieiad a2rln p;(4altnmrctydopDr uei t)srxm(m3oudole lneia( a2taxroou1oeen i3iyt aDelu o;t)alxomo oa1lpD li i s0trtr(r io1op nmnesa(fsrtrumono1oeeniictyd s ulumonu4 lerif3iytfpD  ivi t0 2urir3nu1lpeemfcils)s2ta(mp;o0tpt mfciydfs emump;t4 rxoir3oy1omtrlneo;t) rurxopio4am emfci tfs2uru o;t4tlx moeiytfm2umumo;t0trermf to1latrlies t)texm(m3oo1optelfesas)s2ururo;t1tleoif3iydlm rmnvo;t)teenmr3iatop eanvsls  rtrim ny1am  miviat)aDta(  ;t4alxoioctat sDum(von()texrir oadfmtrli i t0texmxr3io4ol nlncs sf 2rrumo;u4tetn f3iysfmDea( o;(4 rerxf oodopDrluvi t0s2uo(rpiu1ll  micta(fa2umx pnu1tpt  i3iltfaDemnvp;u0aeeoif iadfm r ivslt0 2trimpny1ll n iesa(  2rr(rpno0aeto i3ilsfa umnvo;u0 rxniociytlp e iei t0seuo(opiu1lp e iei (f 2taur ;u0tpeomocias a2ul(mpn()treoxf oo1fmD  u il() rxo(o3oo4lp  mivsls)sDrmx  nt4teen fciltfm uanvo;t0 ltrxoctydfpDeaueo s) 2to(r3oodlpt  ncs (fsDrr(rpoo4ale  o3ildla eln snt0arxnmf3ty1faD  nvi s t2toiopio4opeemiciat  rum(r nt0oet ifeilt aDem( p;u0 rerxf3ootlaDe ues;s0srtm(opiudal nmncsl(fsDurx onu0aeenio3iytla2elnvs u4 lenmfcto1op e ieo t0sexr(opnodlmeemivt sfsrtm(mpoo4oleomfetyt m ua(vsnu4 leoif3oa1op  livslt t2uoirpno1op  licsatfa2ra( p;u4olen i3tydla raump;(4arerir oo1la rliei (0s2xmimpoo4ap   ictls srtr(ront4tlt moeiaslsDuln on(4trerircoatlmte u s ()trurxrpnu1ole lictlt) Dra( ono0oleniieildls eaumpn(0alenxrcoy1late i i;s t2ur(o3oy4lp e fvs () rtax  ;t1olxo oetytfaDulums (0 ltnxo3todfa rli o s t2tm(m iydol  mieilt sDtmurpou0olxo oeiad m2rl(mo (0arenmrctadfm  aivol()texoim ou1lmeelfvtl()aDuau pnt0teeomfeiytfa2em(mp (0aexomo ootom  aieolt0srur(o3oodopte fctat  Drmum nt4apxniocils s ea( sn(4aeenif3oadfa   nvo;s0texo(o3iodlme licsasfsrraum ot0texo ocilslaDrmu pnu) lermo iodopDr ivo s srxoxr nudame mnviasfsDra(mp;o4aexo oeiatls2em(mo t0alxnmfcta1lpDe n il(  rum(o3nu4omeemfcsat)s2trum oo4opt  i3tas a2umuvpnu4 eenio3ta1faDe ueo s  ruoxopnudalee nctat s2rmxr no4tetoif3iat m2ua(mon(4aexrmrctytlate ieo (  rumimpiy4om e feia(fartm(m no1teeo o3iadla2rlu pnt) exnmf oytfatr i s;s) 2to(r3iodame  fvtas)arta(  no1openioetyd mDrmnmsnt0 rtoio ty1optraivo ( setr(m3iydllenlnct () Dtmu p;u1optn ieiatfa2ea( pnt0teermfciy1fmD li olt  rxmio3oy4lmtelnetls)a2ra(m ot1apxoio3iysla2rmnvp u)aeenxrciytom eanes s)s2xoirpiy4alee nct sfs2rrxmont1tpt ioeiys m em(mp;u) etnxo3tadoa elu s (0 euoiopnu1omenlncslsfs2trxrpnu0altoifciadls uanmo t0arxomfcia1lpDeanes ()trtm(r ou1ol nlfetas s2rr(m ou0tlxn i3tat a ran s;u4alerxo3ootlp elu olt  etmxo iy4ap   ietatf 2rru  oo1aeto ictysfa2eanvs ()tetnir oodlpD li olt)t2umim3oy1am  mnvsl()a2rrur ;t4altn ieildlaDulnmsnu)trtrmf3oadoatrli i;(  etmxm3nu1om nlfes (  Drr(r oo4tlxnifeiadlaDea(vs;u4 lxoxr oytfmDrlnvo s0 rtmxo3oudoptnlics ()srtaxrp;o1tpeoifciatfmDel( s ()tetnxf tytoaDean i t)t2umxo3iy1omee netasf rrr(ro;u0tlx ioetltlm2ranmp;u) renxo3todlp raueo s0setrxm3ou1lleelncil() Dra(mp;u4opeomi3iltfaDelu snt4tlxniocoatfaDe ivo;t0texrxopnu4olenmies t  rua(r no4olxoifeildfs2umumo;() lermr3tadlp eln o s0 2xmxr3ou1apee ivtls)sDra( oou1tltoif3iysfsDrauvpnu0artrxfctotomDeauvo s  rtrim3ou1lpen fvias)sDra(  ot0tex iieilsla2emu o u4 rxnmocty1opt liei s0teto(opoo1amen icsls)a2um(rp;o0optnmocils a uau o;t)trerio ia1laD lnvi;s t2xoimpnudlmen nvilt arrr(m nu4opxomicild mDrmn snt)tltnmo oytom elu s t) ruoir3nodlp  lfcilt aDta(r ;u0olt iicildlm2eaump;t0aetnmo3oydfaDr uvo;() 2tr(o3nodamtnlivtl()a2ra( poo0tlx io3iydla uln p;u0aeenxrctytomD luvs;t  2xm(mpoy4a
\ No newline at end of file
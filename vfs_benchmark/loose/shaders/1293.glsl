@@ -0,0 +1 @@
+nvs (0srtrxm3nu1alee neil()a2umx p;u4oltniieiydfm rmuvs u) rerxrctytfm r i s;( trxmxo oodll nlfvilt)artau pnt0tle moctytls rmums u0 ltoirciy1fpDr uei;s0trxr(m3nudameemies s s2taurpnu1olenifeiltls2ran snt4aeenxfciatla r nvo t s2umio3nodlmeemfvsat)aDurxmont4opxo o3iasla rau s t4tetomociytlpt anes t trtmio3oudllt lfcs t  2ta( pot0oltn oeiytla2rln snt0arxoir iytfm eli s s)tetmxr3iudal  micsl(  2rrxr ot0oeeo ictldfs el( pnu4 eeoir ta1lp r i sl() 2uoxo ny4llt licta(f rrmx  oo0apenii3iatfmDra( onu4texoio3ty1opDraues (0t2trim3nodomt mfct t) rtax pot1oexoii3tat s2uanvont) eenmrcoytfat  n i;t0seum(o3oy1lm nlncslsfsDtr(r no0optomieils s uln p;t)alenmf oytlaD ai s;s)trtoxrpiodllenlfvilt artmumpoo0aeeomf3iasla umumsnt0arxoxfciydop e u il( sexr(rpnydlleelfeiat  rrmxro;u4ole  fciadfm2ran s (0 reoxf to1op   n o;t)trtoimpiy1lmt mnvsat a2trxrp;t4apx  ociytls2el(vo (0tlerircoa1lpt  i ilt  2tmio3nu1lm nlfvslsfsrtrum no4ale  ociydla emnvo t) rtrirctydlmt lnesls)seto(rpoy4olen ivia( aDur(moou1tleomociyt s eanmpnu)aexrxo ta1lpte uei ()s2xr(o3ny4apt mfct sf 2umurono4aeen octas a umnmp;t4 rxomo3iy1opD lnes;t teto(opiu4op nlivtasfa2tr(m ou4apenii3ils s umnvo;t0arermr3iy1fp ranvo;s0 etrxo3ny1opt  fesltfsruru o;o0tetn fctydfs2el(ms (0 eenmo iydopt aues;s) rurio3nydlp  lfctltfsDuaump;o4alxoioctldfsDelu s;t4 rxoir oydfpDeanvs s)t2uoxrpou4lmenmicil(fartrurpnu1tlx moctadlsDum(vp u0aeeoxf3io1fp  aivils  exoxo oo1ll nmfvslsf rumx  ;u4tptoiicias aDranvs;()trermociy1fa e u o;(0tetm(m iy1om nliet tf Dta( poo4aleomfetad aDrmnvs t0 rxrxo tatfmDrliesls setr(o3no1altelnvias aruru poo0olto f3ilt a2umn p;(0altoxociatlmtr nvils sexrir oy1ap e fcta( artauro;u1oexn icilsla2umnmsn() etrio3oadfptrli il( teuo(rpny1lle  fvtl() Dtr(ro;o4tptn iciaslmDra( o t) exnxf3iodla  aivol(0teto(m ny1omtnmiesas  2um( pou4altnio3tydfs2rlumo;(4alxnmocoydlp  auvo s srxrxm io4lp nlfvtl()sDur(rono0ape  octysfmDel( snt0trtnxr3oo1lm eaieo t) 2umio3oy4lptn icia(  rrmumoou4apeomieiltfm2ulumsnt4texoio totfm ranei;(0tetm(mpny1ole  fesa(f Drrxr nt4oet if3iysfs2eanvsn(0tetnmr iadfpte neil(0srurir oo1am nlnci t srrmuro;t0tltoiiciltfm2ranvsn()tltnmr3todfmte i o;s0teurxo ny4al nlfcil(fsDrrurpoo1opxnifctyd aDel(ms t0 ltnxfciodfmtrlueo s0t2urxm io4lpen fvsas)a2truroou0olxnioeilsfa2rl(vs (4trxrxo ia1fpDelueilt) 2uoxr3nydop   fci ()s2ur(rpno1apeoiictlt s2ranmpnu0artnxf3oa1lp elieolt)trurim3iydamen icsa(faDtaur oo4alxomfetad sDemn s;u0 eermo3oatfa elu sls srurxrpio1ope  fctlt arum(r ;o0alt miciys a2rlnms;(0texoirctytfaDrlues ()srxrim3nu1lltemieils)aDua(mp;o0oetoifeiadla uau ont)trenir3tydfmD aues s) exoxm iu4oltn ncsl(  2umu oot1tpe  oeiytls umuvon(4arxoirctydfm  ai o s)srtrxmpio1om emivtat)aruaxm ou4tee ioeiytfs eanmsnu) lerir3oodop eli i t teto(r iu1llenmnet t)srtaur ot4tpeoiictysfmDelump;()tltnmf3ta1omteanei;(0s2umxr ou4optelivsl(fartaumono4tpxn f3iydla2rmumo;u4arxrxocio1fpDeanvo t) exmxo oy4omt  ietl()artaxmp;t1apx  fetytla el(msn(0tltomr3oydfaDrlieil(0seuoxmpoo1alte nvi (fs2raxm nu4teto oeild s2em( s;t4 rxnxocoatla  luvs;t0 2xo(opnu1apenmnci (fa2ra(mont4alenmictytla el(monu)arxnmo ty1lp r ues;(0 rtrimpnu1ap   ieil() rraum nu0aptomoeils a eluvp u)aetomf3iatfmDeaueolt  rtmiopiydlmee ivs s sDtmxr ou0opx mf3iatfaDumu snt0tltrio iotfatrluvs;( setrio3iodaltnmnes s  Duaump;t0alxn f3iydlmDrmn p u4tlxomoctadlmD lnei;t)t2umio3oy4ame  ieil()sDum(mpnu0apxniiciyt a umuvp u4tlerir3io1lp elu o (  rtm(r3ny1lle mfvtlt arurxmpoo4tltnio3iyd aDrlu pnu)altnxf3iotopt  nvo ()tetr(m oo4aptn nciat  2tmxmooo0oexnioeils m ulnvs;(4 exrifcoytom raiesl(0trxrim iu1ome  feta(  Dum(rpot0olxnif3tys aDea( pnu0aetnif3iytoat an s;t s2xrxmpoo4alenmfviltfsruaurp;u0oexnmieildlsDel(mp t4trxomf tadla eaneils) rurxr3iu4ape lnetls) rurumoou1oee iocildlsDrmnvsnt4tlxrxo3tytlaD  neol(0s2toxmpnudameelfeias)arraxmpou0aexoiieiysfa rmnms;()tetomoctadomt aneo;s  2urim3oo1lmt lnetls sDtmu pno1oltomi3tytfsDemn s u)texoxf3ootlate ivs;t0s2tm(mpno1lpt licslt) ruau p;t0aleomociad a2rmuvsn(0aetrifcoytlp r nvi;( srto(m oy4olenmfcsl()arrrx pou0tleoifeildla ulnmp;u) reoxocoatomDr uesls  ruoir3iy4optnmncslsfaruau p;t1aeenifeiysfm2elu p;t)tetriocta1opD  iei s0srur(m ou1oltnmivia(farrruroou4tle  f3iasls2eanvsn(4aeerio3tytom e i sls s2uoxr nu4alenlicils) rta( onu1tpt mfeiadfsDrau p;(4alermf3oy1opDelueo s0setr(rpoy4lltemiesl()srtm( pnu0oet mieias s rln s (0 eerir iy1fmtr nvi;s0truo(m3iy4ll   ictat a2urxrpnt4alx ii3tas aDrmumo;u4trermo3oytfmD lnesls0 rtoim oudlme mnetasfsrumxm no0opt mocils s2emnvs;t4trenir iydfmD an slt0trtm(m3oo1apeemnvi tfs2trxr nt0teenmoctas m raumo;(4tlxomf3iatfmt lu o;t)s2um(r iu4al  lnctl()a2tmur ;t0opeo icils m2rmu o;u) leoxfcoatfp r ies;s t2xrimpnu1lp elneils  Drmu o;o4alen oeiydfs2um(vsnt0 rxnxr tatlm  livs;() eum(mpio1olenmfcsat)aDtrxrp;t1tptn o3ilt s2rauvpnu) lxrxr ty1lptrlu o s s2urim oy4lleelnesl()aDta(r nu4aet mo3iyd a2ul(vo u4artrioctatfa  auvi;(0texm(rpoo1amtn netl()aDtru  ot0alx moeiysfaDul(vp (0 lxoxoctydoaDran il()trtrio iu1apte ncs tfsDuau pnt4tltnio3iys sDumu snt0 exoif3iytfmDelu i t0tetm(r ou1ap  lfvtas)a2trumo;t0tpeomi3iyt a2ea( o t0trerif iydfpteai i;t  2tmxopou1al elnes (faDtrxm ;u4opxn i3iydfm ean pn(0 ltnxf3io1la   i olt sruo(rpoodomt lfes s srrrxr oo0aet ioeildfa2elnms t)trtoirctytlp  ln ils)s2to(mpou4ll e neil()srtmx  ou1oexoif3iadlm el(vs;(4 ltrmfctadop   nvs;s teumio nudlpeemictl(fa2taurpot0apxn i3tld mDemu s;t)tlermocia1laD aivilt0 rtm(r3iy4omee fesa()sDtrxrpnu4tlt  ieiaslm2rmump u)teeoiociotlmD luei s0sexmxopiu4omee nci (fa2rmxm ;u0o
\ No newline at end of file
@@ -0,0 +1 @@
+u o s setmxr nudlptnmicsls  2tmum no0alen i3tytla2ea( s (0aleomr3to1lmteaneo t) rurxr3iudllte fetls) Dua(m ou4teen i3iyslaDelnvs (0 rtnio3oytfptrlueo;t0sexoim nydom   icta(  2tr(mpou0apxnioeils aDul( on(4areoxocoadfpt  nvo s seur(m nydlleelneias  2raxm nt1tpenmiciadfs emuvs u) exoxo iydla r i o;s)s2uo(m iydap   fct s)sDur(rp;u4aeeomictadfmDuauvpnu0 eerxf3io1fatr nvi (0 2xmxm3iy4op elfvsas  rrm( p;t4apxo feiltls2elnms ()tltnmf iy1faD  ivo;( t2xmxr iodal elfetlsf 2ur(  no1oet ifeiad a umnvp;u4arerxr to1lp e ues;()srxrxmpiu4lp n nvtlsfs2rmur ou0oleomf3ils aDum(vo (0 rtnifcoa1lmteauesl( srum(rpiy4ope mnetas srtaumo;t4olenmi3iytla rl( p;u0 ltnxr3oodlpDrai il( setoir3iy4aptemnvs tf 2trxmono0olxniiciydfaDel( pn(4 etrxf iy1fatean i ( teurxm3iodapeemicsl()a2raxmpno4altn ieiys mDulnmp;t0aexoir3tydlaD luei;t)tetm(r iy4ol e nei t)artaumo;t0tlx  fctadfm2um( ont4artnmociy1op  lnvs;() 2trio3oy1omtelnvtlt) Dra(rpnu0opx  fcilsfaDemuvs;t0 lxnmfciadomtran s s trxmxopio4optemfeias)sDrau pnt1apeoif3tltlmDrl(mo t4texnircoa1oateaies (0trtmir io1ame licsat  rra(mp;u4apxoiictat aDrmnmo () ltomo tydfaDe ieo t s2tmxo3oudamtelnvils  rrrxmp;o4aex ifeiad m rmn s t0 etnmf iytom e nvs;s s2tr(r oodalt lnviat  Drmurp;u0opeoioeildfs rauvs;(0 eenmrctotfa e i s;t)tetrim3iy4am  mieiat)s2uax pot4tle mfctytlm2rluvo u4 etrxo3oydlmDrlivils  2umxm3no1amtemfvslt s2tr( pnt1apxo ieilt sDumn sn(4 etrif oa1fp elu o t0tetm(m io4oltemies ( arrmxr nt1alxn f3tydfs2ean o;()trenxr oo1op eau s;t t2trxo nu4llt  nvsl( srtmx pnt0oexnioctls sDrm(mo;u)aexnxrctydoaDe n s;s  exmxopnydam n ivtltfsDtmumpoo1alen f3iytfsDumu onu4 exomrciy1op  ai olt0srtr(opoy4lltelfcias srtrxmoou0openioetaslm2elu o t0arxnxrciatfat aivs () rto(m3iudlmtnmfvs s srrau  nu1tpxoifeils m2em( o;u4tltrmrciotfaD au ol()texr(rpny4omtnlivta(farrm(  ;o0opxo ociys m uln snu0tetnmrciodfp raneo;t teuoxmpoo1omenmfeslt aDrr(rpot0oetoif3ilt aDuluvs;t) rxomf oodomDeanvi;t)srtr(o3no1ope lncilsfs2um(mo;o0alxomfcils mDeanvo;(4 exnir3ia1laDeaneolt)s2tmiopoo4amen ivta()a2umxmpnt1oetn i3ilsfm2eanvp u0arerxf3iy1latrau s t0 2tm(m iy1lp emics s)srra(m no0olenmfeiysfmDrl(vp u0 exnmf oatlat  u o ()s2uoirpiy4lp nmictlt sDtrxm no4tpt  o3iltfsDrm(vont4treoir3todlpD  u s t)srtm(o ny4opee fcsat)sDtmxm nu1tlx  o3ildlmDua( onu4arxnirctytfp eanesl(0 2xoir oy1apt  nvilsfa2rmxrpot4tet ioctytfm um( p u)areomr3oydlp  lu o;s0 rxoxmpou1ll nmfcilt)s2tmu onu1tltomf3ilslaDelnmo;t4 rerir3oydfm rliei;s s2ur(o io1ape lnesa(fa2tmxm nu4olxoio3tlsls um(vpnt0areoxf3tadomteaueols  rxoxr3io4ol n iesa(fs2ururpnu0tlt mictatfmDul(vpnt0 exnircoy1la rluvo;s0t2xo(m iy4amtnlneils a2rmxm no1alxnmfeiltfsDrau onu)tlxrmf3tydlpDr n sls0texo(opny4lp nmncsa() ruaum ot0altn o3iytfm2rluvp t4alxrmf3tadoaDr n o s t2uo(m iu4apt  nes ()srtax poo4oee mi3tlsfmDuanvo (0 etrircoy1fm eauei s t2um(r no1lm e nvs (  Drrxmont4ole  f3iadfs2emump;(0aetrxrcootopD lueo ( t2xrxr ny1oltemnetas  2rrxr no0opxomietyd m eaump u4 lxnxr3totlpD au o s)teuo(m iy4ol e ncta() 2ra(mpoo4oet iociytls2umnmo t4aeenmf iodfpDrai ols0tetmio iodamte ictas sDrr(mo;t0olx mi3tydlmDrm( s u) exnifcootla   uvs;(0srur(o ny1om e net ()aDrmxmpou0aexoifctad aDea(mpn(0aleoxfctydfpt  u s;s0s2toir oudale mfcilt a2rmu pou4tpx mf3iadfa elnvpnu4 ltnir oa1fmDeli s;(  eto(r iudlpee ivtasfarumum ;o0oeto f3ildfs2uaumont0 rtnxf iydlatr uvs;s)t2toir3ny4op nmnvsa(faDua( o;t4aeeomociyt m2eauvpnu4aexnmo totlmt  i s;s) rtm(m ou4olte fvia(farurxmono0tlxn ieiltlmDumu s;t4 rtrxr3oytopt lues t0tetrio ny4lmtnlfeia( arra(root1aet io3iadlaDuau ont0altnxfcta1lmtrlues;s  exo(r3iudll  mnctas  2rmxmpou4optn feiad aDeanvo;(0trerirctotfatranvil() 2tr(o ny1apeelneia()aDuru  ;o1oexn ietat s rm(vs;u)alxoxf3ootlaD anes;t)t2tr(r3iu1op e ivsat) rta( pno4ole  fetydla2emuvo;u)trxnxf3ia1fpt li o (0t2tmxrpno4oltnlnvils a2uaumpnu1olt  oeilsfmDua(ms (0arxrifcoydlp e nvil()t2tmxo3iudame  net s  Dtax oot1tlt iocild a rmnmpnu4tlxnio iadlmt  u i (0texoxr oy1ome  iciat srrrumoou0aee mo3tytlm2ua(vp;t) lxrmf iotlptelivo;s  ruoio3io1lmt mies t srraxrooo1opx mfeias m2emu snu4 reoif3totomDeanvolt s2xm(rpoo4lp   fcil()a2raxr nu0alto o3iydlmDeauvo;(0tlxnxr3iy1omDrau s t) exr(o iodal emfvtls) rrauronu1tetnioctlsfs2uaumsnt) ltnxfciatomt  ivols)truoiopoodoptemncsltfarua( ont1apeomociatla rl( p;()trtrmo3oadoa r u i;s)s2trirpno4omt lnct t  rtaxr ot4oeen octyd a ra(mpnu4 lxnxr iytoa  au i t0 2uo(opou4aptnmfetls arumxmo;u1ale  oetatfaDrl(vsnu4 rxoirciytlpDraneilt0srxmirpoy4lm   fei tf 2rrx poo1tlen o3iat m ea(vs (4 reomr oa1oaDr n o;(0teuoxm iu1lm nlictat)sDuax  ;o4olenmiciadla elnmsn(4altrmr ty1fpDeanvils)trur(o3oydamtn fvi ( sDtmum ;u4tleomfetltlmDrlnvs (0 reoxo3oadlp ranei () 2tmxr3iudamtemiesas)srtmur oo4tpe  fetldfa ua( sn(0trxoxr ootomD aneo;s) etrim iy1lptnmfeils  2rm(m ;u0oeenii3tydlmDeanms ()artoxf oo1omtrauesl(0 rxmxo3nu4lmtnlivs s)aDrmump;u1tee  o3ildlaDemnmp;t) rtnxfctatlatrlnvo;()seurirpoy4lp nmfcias)srtmu  no4tlxnio3iysfm2ua( on() exrxr3oydop  li olt s2xrim3ny4lme  iviat s2umum ot1alxn octlt a2uaump;() eeoxr3totlp  lu i s truoxopnodlltn nci sf Drrur no0tlx mfciatfs2rl( s;(0treoxr3oo1lat au s t teumim oodole lncsas) Dtrxr nt1tetn fctadfs uan p;u)tlxnio to1fm rau ol()t2to(m no4apt  ncslt a2tax poo1tlt iocilslaDemuvp;t0tlenxrctotop ran sls0texmxo no1omee ics s) Draumpoo4tetnmo3iatls2em(vp u)artnmrciatlmD anvo;t  eurxo nu4omee nvi (f Drmx p;o1alxniociat sDranvo;u0 renmo3oadlp r ues ()srumxmpno4am emicils srrax pnt1tlx iietyd a uluvp ()arerxrcoy1laD luvi;( texoxo io1lmee fvta( sDuaxrooo4opxo iciydlaDranvo (4 etrxocoydlat ai ol(  2xm(r3oo4lp nmiviat) Durx oot0ope mf3iydlmDra(vpnt)altrmocoa1opte i o;s trumxrpiudlpt  nvs s) 2ta( p;o0tetomi3iydfm2ulumsnt4teerif ta1oaDe nvi;t0 rtr(rpiudlmt lfvtasfaruau p;u0ape iieiasfs rmn o;t4 rxoxo3iodfmDr nvi;t  rxrxrpou1alee nesa( a2ua( pnt4apxn i3iaslaDean o;t4 lenirciodoptelnvs;s s2xrxm3nu4oleemicia() Drm(m ;u0ope ifeiatla rm(msnu0trenir3todfpDeaivi;(0 exoxr3iydapeemfeias)arraxrono0alxoif3iys a um(von(4altrxo3oy1lp  lu s t) ruriopiu1lp  lfcia(  rtmxro;u1opxnifciyslmDeanvpn(4artnxo3todla rluei t0srxr(m3iudaleemfct s  2ta(monu0apen o3tasfs2rm(msnt4 eermrctodla r ues;(  exrxo3iydllt lfvtlt arrr(r no4tltomociys m ea(ms;t0tlxnxfciadfptraieo;(0srxrim3iudomtnmfetl()a2rr(  ;t1teeomfetasls2rmump;()trtrxoctadopD  ieslt  etrio io4oltnmfeslt  ruax o;o0ole  f3tldfaDrlnvp t0texnio tadoaDeluvi;(0setrir nydalen nes s)srrrx poo0aee ifciytfa2rl( s t)aexnir3oatlmDraneolt t2xmir ou4op  lfcilt)a2tau pot1ope  f3ildfm ua( pn(0tltoxr3oy1omt  uvols  rurim3oo1ole miciat)sruaxm nu4apx mfeiltlmDrauvp t0areomr3oadlp  auvo s)s2uo(rpno4omeelnvil( a2tmumpno4olt  fcilt a2rmnmp;u) etnir3iotfatelues ()srur(o iu1op emivt (fa2ra(monu0aeeomi3iys mDel( s;u)treomociatlm  auvi ()tetrxr3no1alen fvi t)sDrmum ou1oetn fciltlaDemnvs t0 rtomo ootlpDeaivsl(0setm(mpnudopt lfvia()a2tax  nt0tpxniiciyt s2uan p t) lxrmocoodomDr i ols) etrir3nu1am  lnvtlt)s2tmum oo0texomfciltfa rlums t)arenmr to1fpDranes s) eto(r3io1aptemnvt tfs2rmur ot1aleomi3iyd s rmumsn(4 reomrcoydlpD aies;()t2xm(o oy1lp elnci sfs2taumo;o0tpe iociaslmDeau pn(4artrmrctotoa eauvs t srumxm3iydap elfctlt)srtmu  ;o4opt mietlslaDea(vont0trxrifcoodlmDe ueo;s0trtrimpiydlp  livsa( sDum(  nu1oleo ociadfmDuln o;u)aetrxf3oy1fmDraieo t) exo(m3nudamenmiesasfsDumu  ;u0oee moeiysfm ean p;()tetrmr3iytoa r ivi s)sexm(m oo1amtelnct sf 2rr(rooo0oetnmi3tydls2uanvo (4aexnio3ta1fatraivi t)srxo(m iu1ape lfcils) 2trxmono4tpeniietad m umuvon() rtnxo3iydfp rlieslt  exoxr iydalt  ncs t)s2rau poo4apxn feiadfs eanms;(4 rtoif3ootfptranvi (0 rurim nu4lp  mfvslt) rrrxro;u0oet mo3tadlsDrau pn(4alenmocoytfpD  nvsl( srurxrpno4llt  ncsas)s2ur( poo4alenio3ilsfs2uanmp (4 rerxo oadoaDeaivs s  2toio nu4am nlnvilt)arumuro;u1tee  ictasls ranms;t) rtrmr3tydfmteli i t srto(rpou1llee fvslsf rra(rpno0tee moeiasls2rln snt4 ltnirctatomDraieo ()teuoxmpoo1ap nlnvilt)arrm(mp;u1alxnmo3ildfm2elnvo;()arerxocty1fmD anvi;s  ruoim iodol n neia()aDuax  ot4opeo iciydfsDua(ms () etomr tytopD aues;(  rurim ny4ame lncs s arurx pot1tex miciyt a eln o u) lerxrcty1oaD  ueo;s t2trio3iy4apeemfctasf rrmum nt0tleoio3iyt a uanvo u) rxoif oadfaD aies (0s2urxr3ny4amen ncilsf Drmxmooo4opto f3iyt m uln o;(4 exrmocty1fm ean i (0tetrxo3ny4amt  ivilsfsDtmxm ;t0apeomoctldlmDrau ont)tltnxocoadla rlnes () rtr(o ou1olenlicil( s2rrx o;o0tptn oetlslsDra( pnt4tlxrif iytla rlnvi s) etrio3io1lptn fcs sf Dta(m nt0oet iietadfs ranmo ()aeermocio1oatr i ols sexrxm3nudlpt  nes tfs2rr(moot1tex iieiyd m uan pnu0tetnio3io1lat luvi;s0srxrirpoo4aptnmivtas  rrm(mooo0alenmfeiyslsDrl(vp;(0teenmo3tatomt anes s0s2uoiopiydap nlivils aDtrur nu0alxo o3tlsfs elu ont0artrxfcoo1lmD livols0s2uoir3oo1alen fcs s srrmx oou0ope io3tad s rm(ms;t0tltrmr tadfa ean s;s)srxmxo oy4omeelnvsl()arraur ;t4ale iociaslm2emn snt4aetrio3iodfmDr nesl() 2xo(o no1lpt mfvil() rrrxm oo4tpen ociysfa rm(mp;(4texnxfcootfpDeln ols0t2xo(o3iu1om e ivs s)sruaxmooo0tlxomfciaslsDrmnvp t4 rtoif3ia1lm  lueo;(  exrir3ou4amt livias)s2rrxr ;t1aptomfetltls2ulnmpnt) rxnmf3tadfmteluei s0srtoir ny4ll elfeia(  2rmx  nu0oeen fctysfs2rln o u0altrxrcoy1lp eaivil(0 2uoxm3ou1al n ivsl()aDua(m nt1tltoii3iysls2rm(mp;t)aexniocoy1lp rlivsl() 2uoirpiodop e neiat)sDraxm ;t0oeeo ocild aDraums;u4 rxrif oo1omDr nes t0 exoirpiy1alt  nei s)aDta(  no0optomfeils s rln on()arenxf3oytlmD liei s)t2urxrpoydapee fetas  rraumono0aleo f3iadla ua( o ()arxomrcoytfm   ivo t srxr(rpnu1lpe mivtat s2ur(m ;o0apeo ictys s eanvp;t4tlxnir3tatlaDraneols  2urir3oydlpte ics t sDuru pno4alx ii3iadla2eau onu4tlenxo3todop  lneo;() 2uoim ou4apte fvtls)srrau p;o1opxnifeiadla2eauvp t4aetnir tydlp   ieol() 2urir3iy1oleemies s sDrruro;t1alx  oeiltfs rl(mo;(4tlenio3iatlptr ivils)t2xmio iudlpeemnvsa( sDtr(  ot4oet  o3tytlmDumu s;t0alerio3oatlp  au o;t) eurxopoy1lmee netltf rtmumoou0alenmictldfa2em(vp t)arerxf iy1laD luvo (0t2urxm3oo4lltelnviltfsrurxmpou1tptomieiatlaDuaumon(0trxnmrciadfaDeaneo t) 2urxo3iu1lmeemfvt (  2taxrpnu0apen f3tatlm2em(vs;(0texoxocia1lm e nvslt) ruoio iu4apt mnet ()s2urur ;u1tpx mfciatlmDul(mp u4trenxocoo1optraueo ()seurxo3oo4ol nmfvs t) 2rauro;o4oee  o3iat m2ulnms (4 rtoio3oy1faDr ivils)texm(r3no4al elfvtlt)sDtrxrpno1aee mfeiyt m2umnvo (4 leoxf io1optrai slt seuo(m3oydlmee nvtl() rrrx  ot1olx mictydla ranmpnt4trxoif3oodfpD lnes t0 2xrxmpiy1ameelnci s srrmxro;u4apx  f3tyt s elnvo () eenmrcoatom r n o t) 2uo(m nodapee fesltfs2uru ooo1aet iocild a2rauvo;t4 ltrmf tytfm eauei t0 rtrxo oo1al e nvias sDurxmpno0altnmfetasls2uau s u0tlxnmr iytoptrai i s  etr(rpiodoltn nvs (fsruaxr no1teeomfeilt s2eanvs;(4teerxo io1fmt  i il()tetoir3oy1omenmfciat  rtmu pnt0tee  iciyslsDeanmsnu4 ltrxoctatfpDe ueil(0t2xoxo3ou4omt  fvi s)aDraxmpnt0aex  f3iasla2em( sn(0aeermf totfm rluvi;() etriopio1al nmncsas  Durum oo4apen f3tad s2rmumpn(0aexomo oydlpDelivol( tetr(r io4ap  lfesls) Dtm( onu1opxo i3tad a um(mp;t) etoxf to1lat au i s) rxr(o3nydaltelicia()sDumx ooo1oleomoetysfm rmums ()trermfcia1lat lnvi;() etoxm3io4ol nlnes tfa2rax oot0ope mfeilsla rmnvont0 rtnmf oa1om eai o t)s2xo(r3nodlp nlietltf Draurooo4tetnifciad m2rln pnu4aexrmrcta1fptelu s;(0seumxm ny1lle miet t  Drau  nu0olxomocilt mDemuvp;(0 eeoxr totlpD  ieo;( s2uoiopnu1aptnmfvsa(fa2ta( poo1texoii3ildfa ua(vp;t) lxoio iodoa e iei;(0tetmxm oy1oltelfcsls arumu o;u0teto f3iltlm rlu o t0alxrif iatfmtelu ol(0s2xrirpio1ale mnviat s2ra( ont1oltniocild a2eanvonu4 reomf3todfatranes t  exo(rpio4amtnlnvslt)aDumxmont1oexnio3iasfs um(vo;t)trermf ta1lmtranvilt0 rur(o oydapen iesltfs2ururpno4aeen o3tlsla2rau o;u4aeermociadla e i i;t)s2tr(r3nu1oleemivi (f 2rmxmonu0tlt mieiatls emnmp u4 etoif ta1op e nvil()s2umxr3oydlltn fcsas aDumxr ;t0optnmfeiyt s el( s (0tetrifctatfm  luei t)trxo(r ny4apt livs t  rtrxm nt1tptnmietlt s uauvs;t0 rtrmr3oydfmtelnvols) rxrxr iy4lle lfes () rum(  nu0alxomo3tas s rmu snu0tltrmrctadoa rauvo;s sruoimpoy1lmtnlnviasfa2umxrooo4aptoiieiaslm2eanvo;() rxrxrcty1laD liesl( trtm(o oo4optn fcs sf 2urum oo0teen i3tadfm2ra(ms;t4 rxnifctotfmt livil()seur(r iodlp  licta()sDrrxmpnt1alt iociys sDemn o (0trermr todlateaivo t srxrxopiodoptn iesa()srtrxro;u1oexn iciyd aDel(ms ()arxoif tatla  ln o;(0 2umir oudop   ivia()a2rmx  nu0aetnif3iytfmDuluvpnt)trxnxo oytlatr ivi t0 ruoxrpou1omen nes ( srta(mo;o4tlx ifciasfm2em(mo () lermr3tatfm rln s s sexmxopny4alt  fvi t)a2um( p;o1tptnii3tlsfaDul(vpn(0tlxoxo iydfptean il(  2trirpnudaptemnvi t  2ur(r ;o1oetomf3ildla2rmnmont) etrioctodfp  livils) 2to(r no4lmtelictatf rua( pot4oex ifciysls2umnmsnu0artnxf3ootfmtrau olt trtrxr oodlp  lnvt t) rra(  ;u1tptnmieiadla2eln s;t0 lxomfcoa1fptrlnvo;(  2uo(mpou4lmtnmncs (fsDum( pno0apenioeilsla2eanmont4 ltrmf3to1lp r n il()srxmxr nu4ol elicia(f 2tr(mpou4tlxnioctlt m uau on()arerif3iodlpte nvi;t  2umim3iu1aleelnei ( s2rrxroot4olx  f3iytfmDelnmp (0 lerxr iy1op  ai ol(  2toiopnudop n fcs (farurur ;o4aexoioctydfm2em(vsnu)aeenmr tadlp r uvi t0trxmxopoydal nliviltf rtm(moou1aex mieils mDem(vp;t0arxrmf ta1op e ivi s setrxo oo1lpen fcsls)artaum nt1tltomfciltlm2rl(vs;u4teerif3tydopD lu ols sexrxr ou1llee ieia()s2rrurp;t4aeen icildfs ea(vont4texrxfcia1fp r n i;s)trxrio oodalt mfei s a2ur(r nu1aexniictatla ulu p () ltnio3iydfpt au o t sexo(o oy1amenlfvslsfsDuax pnu4olxnmictad m uan pn(4 rtrxo oydopD  ivo (0 etmxm iu4optnmnet s s2taxmpou4teto oeiyd mDrlu p;t) lxrmfctodlpte u s;s0teurxm ou1ol elfvias s2trxmo;o1texniictltfsDrmn p;() etoir ta1fpDeauvi;()srurxo3oudaltnmfvia(fsDua(roou1oexn f3tad aDuluvo;u)arxrxf oatomteaiei s0srtmio3io1lpe  fcsa(faDrr(rpoo4tlt ioctatfa ra(vonu0aexriocoa1opDranei t)t2xoio3ny1ap nlnci () rtrx  ;o4tetnmi3iasla rluvs;(0trerif totfmD aues;t0 eumxm3oy1ll emneia()s2rrxm nt4aexo oeild s2ul(mont4tltoir tydomD  nvs;(0trtoxmpiudlpen nvia( aruaumooo0openmi3iltlsDemn pnu4arerxrcootlp   u s (0s2tm(r3oy1lmtnmies (  rra(  oo0apxn fetys m2emnvo;t0tlxoxocoytfm rauvsls) rtrxo3no1lptnmivsl( sruaurono1olxomfetadls2umnms;() etnio to1lmt ln i;s0 2umir3iodamen nei (fs2rmxrpot4olenifctyt s2eauvsn(0alxomoctydfmt aues;( t2toirpou1optn fvs s)s2rmurpnt0apt  fetyd m umu o;()altoxfcoy1opDeau i;t) euoim3no4omenlnvi sfsrua( ooo0tex iocias s ua(vo;u)arxomr3tytlateli ilt0 rxoir io1lmtemfcsa(fs2ur(  nu4tpxo ieiasls uanmsn(0teerir oy1fm rlnvslt teurxo3iydlptn nvtat sDtr(m ;o4alxo feilsfmDeluvpnt0 exnmfcto1lpDrlnvo;s trtoxopiu1omenlnesatfsDururpoo1opxomi3iasls2umu o;t4texomo totfp   u i t) etrxo3iy4opee nvt sf 2uax p;o4oetn ietld m2rm(msnu)treoxocty1fmtrlivi;( setr(o3iy4am n fcsat)s2uaumono0alen i3tat s2ua(vont4teerxr3tytoa  auesls trurxr oydlmtn ietat  2umumo;t0tet iietyd a eln on() ltoiociotom  anvo;t  rtrir3oy4ll n nvilt a2tmxroou0tlxo ociysla2umn o ()tltoio3totla eluvolt0 2umim iu4ll   nvi (f 2rax ono1optn o3iytls elumo;u4altrxfcootoatelivslt t2um(rpio4omtn nci s)sDtmu  ou1opt  fciadfmDum(mont4trerxrcto1omte uvolt srtr(mpiydol   neslsfarraumono1opt ifctldlm2umu snt0teenmrcootfmD  ivols0 2uoiopiu4alt micia(fsrur(m nu0oet  ociyd m2emnmo;t0 eerir totlaDrluvilt) etmxr3iodom  mfviat) 2tax  nt1tlxnif3iyt mDrl(vsn()arxoxo iotlmD livo;t sexrxmpiu1alt  ivi t s2rm(mpno0tlx  oeilsla2ulnvs;t)artrxf iodfaDr uesl( texmxrpoo1oltnlictlt srtr(r ou0oeeomfctasfm uan s;t) exoio3ootfat  neol()s2xm(o no1lm  mivslsfs2rr(mpot0apxnmfciatfmDemnvonu) lxoircoy1lp e neslt) euo(o3nu1op   net t) 2rmumpou4oexo ictytfs em( o;u0artomfciodla  li olt0tetmxm oo1ame mnesl(fs2ur(r ;t1oltn fciyd m el(vpnt4 lxrxr tytlp r uvo;s  2trxr3iydlm e nci ()arra(r oo0ape  o3tas s2elnmp u0tlenxocoa1om rluvs;( trtr(o nu1aleelnctlt) rtr(mo;o0apt micildfsDrmnvo u4trxoioctodfa ean ils0teuoxrpiy4apte neils) Duaxr oo1olx  o3tas m2ulu p u4 lxnifcoytlptr ueols)s2xmxm iydom  mfci s)a2tauroou0optnifeiydlmDemnmpnt)aexoxocoytop  luvo;s0t2trxm3nu1lp elnvsatfsrrmu o;t0oexomictytlaDrmn s;() eerio tadopDrliei (0teto(o no4am  miet tfs2taur ot4alto ieiltfa eau s;(4 reoio oy1oa elues;t0seuoir no1lpe mies (farrmu ooo1texn oeiyt m2ra( o;() rxrxf3tatfat  ueolt t2ur(m3oo1openlncs sf 2urxroot0opeomociltls umuvo;()aexnmf3iytomD  i o;s t2xmxr3iu1opt  nvsl(faDtmxroou4tpx mictad a ra(mo;u4tlxoxo3tytfaDeauvsl(0 2tm(r nydopee nvtlsfs2rau  ou0tee mietlt sDemu pnt) rxoxo iy1fa raieols t2tm(r3ny1omt  ictatfarumxrpno1aet mfciys s2ranvpn(4aetoif3iodopte ivi;s) rxm(m3nu4olte iciasf rrm(r ;t4aexomfciydlm um( o (4 lxrmr iadlateaivs t trxriopiu1altemfvi sf rta(rpot1oex  ietld s em(msnu4alxrxfcoatlpDe nei;s) 2xrxrpiodol emivta(faDta(m oo0tlx mictas s2umuvsnu)aexrxo3iy1lateau i (0 2to(o oy4omtn ici t  Dtmump;u1texnif3tytlmDraumo;t) lenxr iodfp  anvolt t2urxr3oudam emivsas) rtru pou4tlto fcildfs rmnmo;u0aleomrctytopDeliesl()srtm(o ny1am emfet s)aDta(mpnu4alxnifetydls ran on(0 etnmf3iytlm  auvo;s sexr(r iy1lpe  nvt tfsrtaxro;t0opx mfciasls eauvp ()alxnircia1lmteanvs t texoxm3ou4omtnlnctl(fartmurpot0tlx mo3tlsfm2el(ms;t) rxomr3tytfmD lu sl() rur(r no1lmenmicia(faruauronu4apxn ieiat m2ea(mo (0 etnir3ia1fmtrlneo ()s2xm(r3oydaptemicils)s2urxr ;u0teeomfeiltfs rlums t0alerif3iatfmDelnvs t0 rumimpoo4apt  fcsl( aDua(  nu4oltoioctltla2rl( o;t0tetnxrciytlmDrluvilt)s2umxr no1olte fetl( a2rmu pno4aet  o3iys m em( p t) etrio oo1oatr uvs;(0seumimpoo1am  lnciat arrru p;u1texnmf3ils mDrm(mpnu)alxoircia1oateaivolt0truo(mpny1om n fctl(fa2trumoot0altomo3iytfs2rlnmonu)arxrifctydopDelneo s s2xrio3ou1ol emiei tfs2trumonu4tle  feiytlsDea(mo u4trxoir ootlpDrai slt)trxo(o io1ap  mivi (  Durxrono0aeeoifctlt aDemnms (4alxoxo oa1opDrln o (0tetmimpnudlpe mivslsfa2tru  nt1olxniieiys sDrl( snt4 eerxocootfaDr n o;t0 etrxrpoydap  lfeils) Dua(m ot1alen fciytla rlu on() eenxf3oa1lpDe nvi;s0 etmxmpnu4llee netl( srtm(rpou4oetnioeiadfa2umnms u0 exrxr3oo1lm eli i s0srumimpnu4lptemnvi (f rumxmpoo0tltn ietldls uaums;(4 exoio oo1lm   ueo ( srxoim io4altemnesat) Draurooo4oltnmi3iatfm2rm(vs;u) exnmoctotfa  aueilt0 etmio3io1lptnmfct s)srraxm oo0alx mieiadfs2ea( o;() rtnxr3tadfmDr uvs t)s2xmxm3nodape  fctas artrx  nu0ope  fetas mDeanms;t)arxnmr iotlatranvo;s0setoir oo4ole micslsf rururo;o1apenmieiyslsDua(ms t) etomo ty1lmD au sl(0 rxo(o io4omtnmneias aDrm( ont0oexnioetatfs2rmnvonu0 exnxo3oy1lmDelnvslt)texoxo3nu4amte nei t sDuaxr ot0tet  fetls sDea( s u0 reomfciatoaDrlneo t t2xo(rpnydlptemnctlt  2ta(r ot1tlx  i3tld mDrauvp;(0 ltnxf iotfmtraivs;( texoxr3ou1omenmnesls srtr( pno0olxoifetlt mDrmuvs ()arenif iydla  ln ilt tetoxm io1oltn ivs (fsDururooo1tleoifetysfm2uaump u) rtnmocio1opteanvsls) ruoim nodlptnlnct sf Dumxmont4tlx mictltfm eau sn(4 etomo ia1lpte ueo s0t2toir3iy4lm nlicsl( arum(m ot4tpxnmietaslm ra( pnt4arxnio todla r nes;t0 rtrxr3oodlle  neia(fsrtrx oou1aleniocild sDeauvsnu0tetnxr3oatlp rau i t) 2uriopnudoptnmivtat)aDtrur nt0altnmfeiad a2uanmo t0 etomrcia1lp rlu s;s0teur(rpio4am nmfvs tfsDtrurpou0oleniieiltfaDumn o t4arxoxf3iodlpDr ivol()tetrim oo4alt lfesls) 2uaum ;t1optomfeiadlmDuan on()aleomrcoa1fm eaivs;s0seto(m io1ope mfeil(f Duaxr no1tlxnifciysls2em( s () eenmfcoo1lpt ai s t) etmim io1ame mfcias)srrrx  ;u0ape micilsfmDuauvs;(4 leoxo oo1fptrlnei;s0 2xo(rpoy1al nmicsa(f rtax pnu1tptnmieildla2rmu o () rxrmo3oo1la elnes s)s2umxr nu1omeelfvt t a2ur( pnu1alxo ietadls ranmo;t0 etrir io1fa  anei ( teum(r3nudaleemictatfaDuaumoot1apxnmieiatlsDrlumont)tlenxfciotlptrluvols srum(mpnudapeemivtat srrm(  ot1apenii3tyslmDum(vpnu) etoio oatfa r ieol(0 rxo(mpio4ope mfcslt) Dur(r oo4apxnmoctys s2rau pnu4 rtrxf3io1lat ln slt sexoir ou1llee netasfarrm(m oo1tptn f3iaslm rlu s t)teenmrctatlatr nvi t sexo(rpnu4lm emfvs (faDumxroot0aexoifeiydlsDrauvp ()artrxr io1fat au sls trtmirpno1lmtnlfet tfsrtr(r ;t0olxn fctltfm um(mp;u4areoxr3iotfpDeln i;s  ruoxo3nu4am  mfviat)a2taxr oo1alx moctys aDrm( o;u4trerircootlate n o;s setrxo nu1ol nlfvsa() Drmumo;o0tle ifciytfs uau s (0altrif iotla  li sls teuoxr3iu1lpte fcsas sDur(rpno4tltoiiciydlaDea(vs t) lxriociytoatr ieo s texr(opnu1lm nmncs tf rta(mono4tlenio3ilt m2rlu pn() eerifcootom rauvol(  2umirpiy4amen feilsfa2rrumonu0olt ii3tadla2ra( pnt4alerxf3tydlm   nvi s0trxmirpou1ol n nvt sfsDra(rpno0apxoii3tys m2ul(mpnt4alenmr3tadoatelneo (0 eumim3nu1ll e ncsat) 2tmxm ;t4oeenifetys s umn o u) ltnmf tadfmDeluvol(0sexr(mpoodlmtelivta()sDrrxmp;o1apenmoetas mDeln s;t4aleomf todomtr neo s0s2um(rpnu1opt  fct sfsDta(r oo0apt mieiatla2uluvp ()teerxf oytomDrau o t)trtmio ou4omen fctlt  2taum ;o4tex iietatfs2eanvo (4 eerxfcty1omteaues;()tetoxo iy1altn ncs t sDurx onu1aetomfctlt aDrmn s () rxnmfcoo1lmtrln i;(0s2xr(r nudomtn nvtlt  Dtmuroot4ope  ieildfs umnmonu4 eeomrcoydlm raneo (0 2uoio nu1olee ivsas)arrrxm ;t1ape mfeiat s2rm( p u) rtnmrctytop rli o;t)s2xmio iodopee fvs ()s2rmurpno1tpxomf3iat s2um(mo;t4 ltomo tydlmDeaies t)s2xo(m iydomtemieta( srtrumpnu4tlto ietldla2uauvs;t) ltnxr3tytfptean o t t2xoxrpno1omt lfcilt)arua( ont1tlxn oeiytfaDrlumo t)aeerxf iadlmDrliesl(0seuoxo io1ol nlnesa()arta(m ;o1apto fciysfs rmump;(4aeenmfcty1fpDeauvs t)sruoirpiy4lm elneias) 2tmuroot1oexnmfeiaslm2ra(vp;()texnirciodlpDrlueolt0s2trxmpnu1alt lfvia(f Dumx pnu0olt iociasfs rmu sn()arermr3iydlm eaues;t) rtoimpio4am nmfvslt)a2rmurpno4ope  i3tydfsDem(vs;u4 reomf3oytfatrlieo s srurxo3ny1ll nlieils)a2raump;u1oexnmiciad mDrln p;u0 eenio3oadlaD aues s0 etm(o3no4aptn ivt s  2ra(mpoo4tlenif3ildla eau snt4trermfcto1fp ran i (  exoio3io1omen ncias) 2tmu pno0altn i3tydfs2elnvs;t0alenxf3io1om rlueslt t2um(m3io4op  mncs t) Dum( pno4texnii3tytfaDrau o t)tetoxrctydfpD livsl()trxmxrpou4amtemfcias arrm(r no4alxoifeiydlm2eanmp;(0trxnmr iydlm rln o;t0 2tm(rpny4lm nmivsat sDumum ;o4tpx moeiat m rlnmo;t0tetrifcto1fm   ivslt s2urim oy1al nlfcsa()arta(ront1teeomiciatlm umnvpnu)aeeriocoy1om rlneolt0t2uoxo3iy1lltnmivt t)a2taxmooo0optnmi3iysfsDelnvp;u0 rxnifctodfmDr ivo;t0srurxmpoydole lics s)s2uaurp;o4tlto f3iadls rl(mo;()arxnxo3oy1lmt lueilt0 2umxr3no4ape  fct t) 2tmu ont4tex mo3ils aDua(msn(0teenxo3todfaD lu s ( t2umxopiydamteliesa(fsDurumonu1tet if3tydfm2ua( ont0alxrmo iotomDr neil(0srtoxr3oy4al n ieslsfs2umx  oo0oeeoioctys m2ua(ms t0 eenmrctytom eaies;(  2umxmpiy1aptemfvilt) Draumo;o4tlxomfciatfs2rmump (0 rtrmfciodomD lues t)t2tm(m iudaptnlict s)sDuaxmooo1aex  fcils a ra(vp;u0 etrmr oa1opDraivol()teuoxo3oo1lmte nes () 2urump;o4tet ifciad sDulnvo;(4aeermrciy1fmDe n s;t)sexmim3ou1amtelfet t a2umu o;o0ale  ociytfmDea(ms;(4 lerxr totlm   n o;( trumim3io1al emncsls  rtau pnt1ale  ietls m rmn sn(4alxrmrcia1fp  auvi;() 2to(r nydlp n fei sf Duaxro;t0tet moeias m ea(mp;(4tetoir tadfpDe i olt0trto(m iy4llee iciat  Duaxmp;o1apt io3ildlsDranvs (0aeeriocoatfm  ln s;s  eurxr3io4apeemnct s sDtaxmonu1tptoifeiyt m2rlnvp;() etnmr oy1la eluvsls seur(opoy4lp nmfvt t) rtau ont0tlt iociatfa2eluvont4altomr ootomt anvo (0s2uo(m3no1lp  lnct s)s2rru  ;o0tpenmf3tlsla ea(mo;t4tleoif3todomt  ivs;s  exo(m3no1altemfeta(fsrum(  oo1oex iieiasfaDea( o u)alerifciatom  aivs;t teumir iodop  lnesl(fa2umum no4aleomoeild mDuan sn()arxomr ootfp r n s;()t2xmim iydol  lnct (fs2ra(m no4tpxn fctysfmDrl( o (4altrmr3ty1laD  u o s) 2uoimpio4ame miesa()sruau poo1alenmfcils mDuluvs u)trxoxocia1fm   ivil()srto(r oydole  iesl(f rrau ooo1olxn fcilsls rlumo (0 rtomf oytfp  aneilt0 ruoir3nudop  lfciasfs2rmxm ;o0altn feilt aDemu pnt4 rtrmociytoa rlu s;t0s2umio iu1lmeemfeils)sDrrxmo;o0apx moctadfs rm(vp;t) rtnxoctatlaDraueo s truoxo3iu1al emfctl(f Drmxr oo0tpe  oeiyt m2ranms;u)tlxnxr3iadlp  anvi s  ruoiopiu1llt  ici sf rrrum nu1apxn fctytfaDrln s (4tltnmo3oadlaD luvs;s srxoxm nudome lnvta( sDta(m ;o0oltnmietyslm2emuvo;u0alenmo3tadopD anvs t  rxo(m3oudlptnmicia()artruro;t4ape  ocilsla2elnmo t4arxrio3ty1oaDe i s;s srtr(mpiu4am  lictlsfa2uaumpoo1apxoioctydls2eauvo;u)trxrmo3tydlpDr n ol(0 2uoimpoydlm nlfvi t artrxr ;o0openioeiat sDumnmp (0teerifcoadlpt  i i;t0t2um(mpiu4lpenlnvt ( a2rmxmoot4tpen o3iasla ulu s;u0alenif3tydoaDelieol(0 2uoxmpio4alenlfet () Dtax o;o1teeoiietltls rm(vs t4areoir3oo1lpDeanvolt  rum(rpny1op nlnvs t  Dtmu  ;t4tltniietyslm2rm(vsnt4 rtrxociy1la r nei;s)s2tr(m ny4amtnmfviatfaDumxrp;o0tex  oetysfs eln o;u)texoifcoytfa  lnvi;t  etmiopnu1al nmieilt  2uaxmpou1tpxn fciysls2umn s;u)arxnxo to1opDe uvils)texmxopno1aptn neil(f 2tau pnt4tptnio3iysla ea(mo;u4 exrmocto1lmDe neo;s)trto(o3oy4am nmfvt sfarra(  ;u1tetomo3iltlmDua(msnu0arenxf ta1fpteaiesl(  2uoxm3iudapen ieilt s2uaump;o4tlt  f3iysfsDulnvpnu4arxnif3ta1la  lies;t0sexoimpiodlpe lieils a2tmumpnu1tpxo oetldlmDrln s;u0tltrxr totfaDe u sl()t2xmxo oy4lme licilsf 2raump;t4olx ifeiasls2em(vsnt0tltomr3ty1fa elneol()trtoxm3iu1omenmivilsf rtrurpoo1alt  o3tadfa eau s;(4trenxocoa1lm   iei s)sruoxopnudal n nctlsfaDururont1alenmiciydfa2elu on()trxrxf tytopte uvo;s)s2xmio3io1ameelnct (f Dtru pnt4oee ifetyslaDrmumpn(4arerxr ootlatrau o;t texm(o3oo1lptn iciltf 2rrxr ou4oltomfcildla2ea(vs t0aexoxf iodlaD anes;t)trur(o3iudam  mnvsa()sruaxront4oet ii3tlt sDumuvs (0tetnxr3tadomDe i i;(  rumir3ny1altn iet tfa2rmxmoou0ale mo3iys a2ulu s t4tlxrmo totlmDr u i;s0s2xo(o nu1ame lnvslt) rumu o;u4texniieiatfs2ra(vs;u4tetrmf3to1lpDe ieilt0 2to(m oydop n fci s)a2ua(ronu1tleoiieiytlm uauvsnt)trtnmr oydlpt auvolt) eur(r ny4olenlfciat arrax o;t0tpxomo3tyd a2uaump (0aeerxr oodoa raneo (0trur(opno4altnlfvtasfsrrmump;t1tpeoioctlt mDrlu o;t0aexrxf3ta1fpDrlueilt)s2trxo oy1op elnvils)srtmurp;o1open fciasfm ua(vp;t)artnmrctydlateau i;s)seum(mpnydlmt mnvsat)s2umxr nt4tltn i3iys aDra(vs (4aetnioctodfm  anvol(0 etmxo io4al nmivsatfaDra(mo;t0altoioctatfa2um(vo u) ltoxr3iadop rlnvs;s0t2xo(o3ou4lmt lfciltf 2umx  oo4olx  ieiatlmDrlump;u0trxrmr oadfpt lu il(  rxr(mpoy4opt  neiat a2tru o;t4apenmoeilt sDuln snt)trtoxf3totlp  li s;( sruoxo oy1am emics (f ruru ont4oee iieilsfm2ulnmonu0 rtoifctadlaDe i o t)tetmxr3nu4oleemicsat)aDuaxr nu4aptoiietld m2rl(vpnt0tetoxfciytom raiesls)t2xoxmpoy1ol  mnctls) rtrxrpou4oeeniiciytlm eaump (4arerxrcta1fat luvolt teto(o ou4lm e ictat s2trx ono1oeenmoctys a2umuvo;t4arxnmr ia1lmt livsls)sruoimpiy1apt lfcsasfa2trx pou1apt  o3iytlaDel( s (4 rxrxo todoaDrau ols0srxoimpoydomen nei ( arrm(rpoo0opt ifctyd a ulnmo;t0texoio3tatlp eauei t)s2uoxo3nu4am nmivi ( sDrrx oou4alx  oeiydlmDuaums;t) reoir io1fp rln o;()trxoir3nu1amt mfvi tfsrrr( onu1olx iieiad aDulums u0 lxrxrctytfptelnvilt0tetoiopio4lltnlncsa(  rumx  nt0tetn oeiyt s uluvp;t4 eerio oydopDraueo s)s2um(m3nodopte nct (fs2tr(r nu0tex if3tysla eau s t0texomr3iytom r nei;( t2xmxopnodomeelnei sfs2ur(moou0teenioeilt s elumo;t0 exnxo iy1omteaieols  rum(o no4aptemneslsf 2raum ;o4tpx mfciat mDrl( p;u0artrmfcootfatr nvsls sexrxo3io4op nlnvsas)srurxrpoo1oetnmfciatfs ra(vpn()aleoxo3ia1op   neo;() rto(m3iodllenlfeil(f 2taxront4apxnmieias sDulnmo t)teerif tadom  au ilt s2uo(opnudamt mncs ()aDuaxmpoo0aeeoif3iyd s2uan s;() etomo tydla  auvi (  2tmir oodll   neil( arumuro;t0opxnmieiatfaDuluvo u4 lenmo iytlptr u i;(  2uo(r3ny4ll nlnesasfarrr( onu4apenmictydlaDran onu4teeoiocto1op  livol(0 2urir3nu1ap   fvs s sruru  oo1tpxnmiciyt aDumumo t)tlxoxoctydlmD  uei;(0trto(rpoo4olteliviatfarumu pnt4aeenmiciysfa2rm( s u) eermf iotfm r ieo;s  etm(mpiy1lmenmfetltfsDrmx  no0alx moeiytfa2rl(vp;(4aeermo ootoaD  ueo;t0tetrir iudlm   ics t artaxro;o0oltomfetld s2uau ont0aexnxf iydlp ran o ()setmio3iudll nmnvtat srtax  ;u4opeoiieiytlaDulnmpn(0aeerir tatoat  n o s trtmim nydop  mnviatfaDraxmpou0oetn feiad a eln onu0 eenmo tytfp raies;( srxm(mpoo1lmt mfetlt  rur(  nt1tleo o3iat a2ranvs (4altnxfcto1lpDraiei () 2to(r oudomtemfci t aDumx  ou4ale  fetad aDeanms () ltoir oatom eaivo;t)setoxrpno4lmte ivsl( srrr(r ot4alto octyt s ulump u0altrxo oodopDeluei;()tetmxm3nydlmtnlivta()srtau o;o1oltoioetysls2uau pn(0altrxf3tatfm  au sl(0 rtoxo io4open fctls a2um( ono0tle ifeilsfs ua(mpnt0aeerxf iy1lpD lnes;(0srtoir ny4omt mfctlt  Dua(  nu1opx  o3ildlm2rlnmpnt0trenio oy1oatelivo;s  rtoxo oudoptn nei (fa2ta(rp;o0oet  icilt m uauvs u)tltrmo iydfp  livsls teuoimpiudlle mfcils srta(m nu4oex mieiysfs elnvo (0trtnmf3tydoptrlu o;s) 2tmir nu4lpee fesat)a2ururpnu4tlxnmiciadfs emnmo;t0artnmociytfaDr iei s) rxrio nu1lptnmics ()aruaumooo1apx ioetasfsDumnmsn() eerifctotlaDe u s s)s2uoir oydom n fvsl(f rrm(r ;o4tlxnioetyt sDrau pnu)areoir oytoa  luvs s srtoxm3nydoptn nei (  rtm(m nu4tpxn f3tys m2emuvs u4 leoxr tatlmD  uesl()seumxm3oo4lmtn neslt s2rm(mpot0teeo feiys m rl(msn(4 leniocty1lpDelu i t)seuoio nu4llt  nesls)aDumu o;u0apx ifeild m um( s t) rerxr3iatom eln i;( teurim nudal e fetasf Dua(  nu1oet if3ilslaDul(vp u0tleoir3oatfaDran i;t)srtrio3io4olee fetat)a2rm(rpot0aetn i3tldfa ul( p (0texrmf3totlateluvols0sruo(m oy4omtnmnct tfsDtrurpnu1opto oetys a2emn pnu)alxoif3tadlaDraueolt0 2to(r iu1omenmivt t artaxr ;u1aeeo ictlsfm2uau onu0 lxnmfctodomtrlieils trtr(mpno1ame  iei () Duaurpou1alx moetytfa2uauvo u0 leoxf3to1lmteaivo;t0seto(m iy1lpt mivt tfa2uru pno4aexomfciadfaDemnmo;t4arenirctydfpt lu o;s0 euo(m no4amt mictatfa2rrxmpou4aeen feiaslsDul( o (0aetnmocta1la rln o;(0srxm(o iydol e nctat  ruau pnu4optniieiatlm eanvpnt) ltrmo iytfpD ln s;t0srtoxm nudlm   ivsltf 2rr(m ot4aet  o3tlsfs eanms;(4 ltnxf to1oatr i o t) etmimpiu1ll elnvia()s2taur ;o0olxniieiyt a2umu s t0texrmocoodfatrlivols0texoimpio1am e ict t a2umxmoot4tex io3tadls raumpnu4altoio todlmDe uvols)setm(m3nudolt mfvias sDumxmo;u0aexnmietat s2em(vont) rerifcio1op ranvsls0srtoxmpoydllt mncta()s2ur(rp;o0olenmieiys m rlnmp;u4trxrmf ta1fm r nes;( setrxm3iy1amteliciasfs2uax o;u4apt mf3iyt m2el(vo u0 rxoir3todlp   iei s trto(o3oydole mneiatfsrrmumono4tltn iciyd s2rln pnu4altrmr3tatopt  nvilt) euoxm3nydlle mncsl(faDuau  ;t0opxo oeiysfa2rmuvs (4texrmr oytlm  lnvi ( texmirpoo1amtnmnet s aDrr(  ;u4oeeomo3iltfm2ra( s () rtoxrciydlp rai il(0seur(m3ou1op e fvs (fsDta(r ;u1olx if3tysfm2ra(vo;u0aexnxociotopDe neo;t  rxm(r3nu1op   feilt)arurum ou4apt  ocilslm ranvp t0arermo3tadfaDeaues;t teumxm nydop nmnvs t aDur(ronu1altn f3ild mDul( on()teerxoctydopDeaies (0 2uoio3io4apenmncia()s2ua(mp;u0olxn feiat a2eanmo u4alxnmrciadfat  i s;s  2xo(opno4lp   netl(farra(m oo4olxo o3tys sDemn pn(0texrmrctadfpDrliei t  2uoim nodlptnlncil(fs2trxr nt1opeo fetyslm2eln s;u4aexrmr3iodfm  au i;t0 rtr(m3io4ameemfesas  Drrx  ;t4oltomi3tldfa rlu p u4tltrxr oydopt lu s () eur(m iydopenmics (fsDtmum nt0tpt  icias s2rln o;u)tlenmf3ta1lmt li sl()s2ur(r3iu1ope mieslt)s2trxr ;u4opxomoeiytfs2ranvpn()trtrxf oadlpDrlnvi;t) 2xmio3oo1ll e fvs sfarua(mp;o1alenmieiltla eaumo u4 lxrxr tadla ran olt  euo(rpoydol n ivt (farraum nu4opx miciadfmDua(vsn(4tetnxoctatfp elies;s  exrxr3ou4ap eliesa( srtru o;t4tet  oeiltfm2uanvp;u) eerxr3iytomDeaieslt0t2xm(mpiu4lmt lfvsas)s2tm(mono0tleoifetytfa2rmn o;u0 reomo iy1omt auvil(0 euriopnodomt  ivtltf rrmxr ot0olxo oeilsfsDelnmo (4texoxr ta1lpDr uvs;()trtoxrpiy4altelnctl()a2ra(m ;u1tlen iciyt s2rm( onu)tltomf iatlp raivols) 2umxo3iydllenmncsltfa2um(mp;u1oeto oetatla elnms t4 etnxrcootlmt anvols) rtr(rpoudop  livta(  Durx o;t0tpxnmociadlmDuauvsn()arenmr oydlmt lues t tetrim3nu4am nlicils)a2tru poo4texn ocilt mDuan p u4teeoxfctodomDrlnei;( t2ur(opoo1lptnmieta(faDuau  ;u4olenifciadfm2uaump (0 renxo3iadoaDe neolt) exr(mpnydopee fcs t s2tauroot1oexoiieilsla uaumo;()aetnmo3ty1om eanei;t)t2tmir3oudamee nes t  2ra(  ;t0olenifctld m2rl( p;u)teeoxo3oydomtrau i t)trumxo iu1lpt lfcsat  2tau  oo1oltomfctldfs2eau p;t)aetriociadfm rai i;s0 etoir3no4om elictls  rtr( oot0aptn feild aDrmn p u4aexriocta1latr uvo t)s2xmxm3iydal nlici s)srtr(m ot0tet mf3ildls eaumpn(4aetoxf3iadlm r n i;() 2trxmpio1omt lnvta( srurx  ;o0tpxomf3iltla2uaumont0 exnmr3ty1lmt luvols0t2xoim3io1op  liet s a2rmu  nu1tpeniiciatla rmu o;t4 etomf tadlat au i (0 2xmio ny1lp elfcs s  rtmur ou0tle mf3iydlmDrmnmo (4trxoir tytla  aneslt)t2xo(o nudlmtn fcsas arrrxm nu4opxomoeiytlsDranvs;u)trenxf3oodop  aneil(  2tmxrpiydlle mivsls s2raxrpot0oexoiocils a2rm(mp;t4aetrmo tydlm  an olt s2tmxo3iy4lm e nci sfarur(mp;u1oeenmi3iydfs rlumpnt4arenmr3iodlpDe u sls srxr(mpio4ap n ieias)s2umxm ;u4olx ioetlsfm rl(mp;u4aexrif3todopDeluvi;t t2xoxm3iydamtelicsat) 2uaum ;u4opt mf3tad m2rmnmp;t4aleoxr oatop   uvsl( trur(rpiudope lncil(fa2ra( onu0opxomoctls a2umn s;(0aeenxo ia1lateaivils0 etoxo3no1lltemfeiatfs2trxroou4tet  i3iytfsDuaumpn()trerxfciydlmD aues;t0sruo(m oy4optn nci ( a2rau ono4tpxoiociyd s2uan o;t) exrxf tadfp eluvo;t0 rxoiopoydam e nvtat)srtmumont1altnifetlslaDeluvs;u4 eeoir ootoptelivo;s0seurir no4al  mnesa()sDua(moou4alto f3ias s ra(mp;t)trtnxo todfmDr ivi (  eum(r3nu1om   nci s)a2umxmpot1texo i3iyslm um(mp ()trxoir3oadfatean o ()trur(m3iu4ol elnctlsfaDrmxmo;o4tetn ictydlsDul(vs;t)tlxrir oy1laDrlu i;( texo(rpiy4om n ivtat) 2raxr ;o1tpe iociasls rlnmonu4trermo oo1om elivs;s0truo(o3iu4omt lfvtat sDuru  ou0opt if3tltfm ul(mp;() reniocty1fp rln il(  exmim iydam nmiet s artrxro;t4tleniocilsfs ra(vsn(0 rxnxo3iodla eauvs;s0setrxm3oy4amtn fvtat)aDumxm ;u1opt io3iysls2uan sn(4 rxnxociadomt aueo;s)t2xr(m nydaleeliesas s2rmxr ot0tpxoifctltfs2ua(mp t4 rermr tydopD  ivs t0 2toxo nu1lmenlncsat sDum(mpnu0tet mieiytla ua( p;t)arerir iadlmte neo s  rtrxm3ou1opt lici s)s2tm(rpnu4altnifcilsfm ua( p t4trtnir3iatlaDelnvsl(0s2toxopny1al nliesltfaDuaur oo1teeomocilt sDelnvsnu)trtnxo3iatlp r nvi s) rxmim3oo4om   fcslt  2taxr no4aetnmo3tytlaDua(msnt4 ltomfciytfp e n s;t)s2xmimpio1lmt mnctat)a2ururpoo0oeeoifetadfsDrmu p;t) rtrif3iadomD an slt) rxm(r no4lp  mfcs t  rurxro;t4alxoiieiytls2rmnmsnu)tetrxf3oa1opDeau s t0 euoir3iu1amt licias sDtmurpnt0tpt iietldlaDrl( o t0tlenxrcoo1op  li o;( trtmim iy4om   icilt  rua(roou1optnifeiyt m2uau onu4tetrir oatoptr iei;t0srtmxm iodapenmivtat)a2ra(rpno4oetoif3ildfa uan o t0alenmrciydlp   ivs;()srxmxr3iydomtnlnvtatfarta( poo0teenmf3tadlm2ea( p;(4arxrmoctotfmDr ivo;s srxm(m nydop nmivilsf rurxrpot1oetn ieiyd mDeluvo;u0 rxrxf to1fmDeauesl()srur(m3iu1omen ivta( s2rr(mpnu1opxo oeilslsDea( p;(0tltomo3tydfmt  i s;t)s2xrir3nu4ll e nvsl( arra(m oo0aetnmiciadfs rm(mp u0teeoxf tatfpDrlnes;()seuoir oo4altelicslt sDuaxrp;o1aptn oeiasls ulump;(0teerxoctytlm eauvs s)texrxo3io4ol elivsa()s2umxrono4tptn oeiydlmDrmnvp;(0 lxomo iy1omt au slt0t2uo(opoo1ap emnvias)aDrrx pou4oleoio3tytlsDem(vsn() exrir3oatop rlnvs;()teuoxr3ny1al nlfcsa(faruau ono1ape mfciaslm rmnmp;u4aleoxrctydoat  i ilt  2tmir oy1lmt miciatfsDua(mpou1tlenioeiad mDeaumsnu4 lenxo3tatopt lu i s0srto(r ny1lle mfcs ()sDtr(roou1oee ioctldfm2rm( s t4aexomo io1omtr u s s0trxm(m no1olt  nvslt sDtr(rpno4open oeils a rmnvo;()trtoio ta1latr nesl() exoirpiu4lptnliet t aruau  nu0alto oeildfsDrln p;u4trxoir tydfm e ies t0trxr(r iu4am elfetlsfaDtrum no4texn feiadfmDem(ms ()treomf oo1oatrlnes;(0s2xrio nudapt mneiatfsDrauront4altoii3ildfa2rmuvs;()aetnmr ootfm e uvo;t) ruoimpnudlpe lfvtl( arrmxmpou4olt iieiaslsDumnvs (0 rtrir3ty1fa  ai i t trxoxm iudam e icsa(faDta(m oo4aleo oetyt mDuluvont0tltrif oatomDr u s t0teurxm oydopeelics t) rrmum ou4tlenmiciasla uanvs;(4trtnmf3oy1omDranei;t0srxoxm nu1amen ivs ( srraump;t4oex  f3tysfm ra(vs t)artrmrcto1lmDeluesls0trxrio3oo4am emici t  rrmx p;o0oexnmo3iatlsDuauvp (0alxrmo oodfpD  i sls)s2uo(m io4omen nvt t s2rrxro;o1apenmfeiytla ra(ms (0trtoxo3oa1opDeaues;s0sexoxo oo4omenmfvsat) 2rm(rpoo0tpxoiieiatfmDran pnu0arxnmr3ta1la rlnei s)tetmxmpoy1ome  neia( s2uau onu0tlx mi3iyt m eln sn(0alenmo3iodomt  uvi s)tetr(mpnydaltnlneilt srraxrpoo0olxnmf3iydls rmumont0artoio oo1fp e u s s) etrio3oy4lltnlnvtl() 2urx  ot1tltnmociatla2umu snt4 rxrxfctytopDeaueslt)texr(r3iu1lltn iviat)sDtm( p;t0tpe mieias mDrlu snt4teenifciytoaDraieo;()tetmir3oo4ap e iviltfarrr(m oo0apeoif3tatfaDrlumo;u)trenxoctadfmtr iei s) 2xoxo3no1amee ics t  rur(  nu0opxo ocilslm2emums;u4altnif3ia1fmteli s ()setrir io4al   ici t  rur(mpno1aexomieilsla rmn on(4tlxoiocty1fp  ln o () rxrxr3iu1amenmncsa(fsrumx pnt0oexoio3tls s2el(mpnu) rxniocoytomD livo t0teurxrpoy1ap   fvsas  Duaxmoot4opeo octysfaDean sn(0aexnxfciodoaDeanei t0srtmxopiy1omtnmfctat)aruru ono4aex iociltla eaumo;t4aleoircia1fa eli sls  exrirpnodome livt ()s2uaxroou1oexn o3iatlm2uanmp t)tlxnxr3iytom elues;( s2urxopnu1optelieslsf rtmxm ou0aex  f3tatfaDulumo;(0aleoir iotoa   ivo s srurxm no4lmt  fvsa()a2rau ont4opxn ictas aDumuvsnu0 exrxo3iytlpD lu ols)sexoxm3ou1ole lnesas)aDtm(rpot1teen feiadfs2rlnvsnt4 lenxr tatfa elueo s)s2tmxo3io4lm nmnei (f Drau p;u4tlx ifetlsla um(mo;(4trxoxf oatfp eanvs t)srxrxm nu4al  mfetlt s2rmxrpoo4aptomi3tydlmDrlnmon(4arxoxr3tadlpD an sl()sexm(m3ou1lpeemnci t)aDrm( o;t1olx  f3tyd m ra(vp;u4 rtnxf oa1lpteln i;t)truo(o3oo4ome mnvta(f Drmu  ot0texnmoetydlmDra(von()alxomo3iotlmtrli s;( tetriopiy1lm n fvsatf 2taur oo1oeenmf3ildfaDrlnms t0tlenmr3oydfpD lu i;s teumxm3io4amee nct ()a2um( pou0alx iociltlaDemnvsn() ltoxf tadomtelueo s teur(mpny4olte ncs s)s2ur(mp;o0tlxo ieiydla rm(von(0tetrmf io1faDrln o;s)t2xmim no1ap e ncia( a2tm( p;t1ape iieild s ul( p ()tetrxrciadfptr n il()s2ur(opou4apeelnviasf Drau pnu1aet ifeiyt s rl(mo u4 exnxo3ty1fatrai slt)tetmxr iy1ameemnvilsfsrur(mo;o0olxn feilt m emnmp;() ltnmociatlmD aueslt0s2toxo3oy4optn ncia(f 2rmxr ou4opeomfetltla2uluvsn(4tleoio3ia1laD  uei s)sruoir3io4lmt lfvtat s2tmxmpou0alenmfeilslsDemu o t) etomo3oy1fp rluvsl()trto(rpoydomee ietls a2ur(ro;u0apxo i3iatfm2ean ont4tltomo tatlate ies s)trxmxo3io4ll nmfet tf Dra( ono4olxo i3tys a emumsnt) eeomfciotlaDe nvs;t0srxmxo nu4lpenliei sf 2ua( onu1aex miciydfm2eau s u)aleriocoa1op  lneo s)trtoxmpiydale  fesas)srurxm ou1tltoioeiat mDea( o t)trenxrcoy1oat aivsls0 ruoxr ny1ome lieias)sDrrxmonu4opeo f3iytlsDelnms t0 rxoif oydomD luei t)t2umxmpio1aptemietasf 2tru o;o1apxniieiysfsDeanmo;(0 lxnmo3todomt li o;(0s2urxr io1alt  ncs ()a2ua(m ;t0tet ifetltlm rau pn(4 rxnxr3iatoaDeanvol()srurxopiydap   nvs tfsDtax  nt4alxomoeildfm rmn on(4alxomf3to1om  ai ol( srur(o3oydamt lfetl() 2raxrpoo0oleoio3ilsla em( s t)aetoifcoydlp   ivols0s2urir oo1ap   ietas  rurx pot0tpx iieiydla ea( ont) eeriocty1laD an s (0s2to(o3oo1lptn fvtatfartm(r nt0aleo iciydlmDrauvp;u) eerif3iydfptrln s;s seuo(m ny4apen iviltfsDururpoo0opeomieiadfs2eanmsnu0aeenmf tatopDr nvolt) rtr(mpoy4ole  ivsl( aDtauroot4alt  feiat sDra( p u0trtnio3oadoaDrai slt0setmxm3oo4optnmies sfarta(  ou0tlxn octadlm2emumpnu4treomfctytfa r u ol()texr(r ou1omtn ivs ( sDuau pnt0olxnio3iydla2eauvpnu4teeoxrcoatoatr u olt0 eumxr oo4lmtemietls  rtaxrpot0ape mieiys m2ranmo (0 rxoifcto1fpD lueo;s)t2xmir oydalee nvia()artr(mo;o1oex mieiadls2ran pn()aetrxr3oydoa ean o;s0s2tmxo iu1llt  ivi tf Dtm(ro;u1aexoifeiydfs2uauvsnt0trerio3ta1lp rlu ilt  rtoio no1lpeemnes ()sDra(m nu1tltnmoctytlm umuvo;u0trxnir3oadop r ivils srxmxm iy1om elnviat)aDtaxm oo4oetn f3iysls2eaump;(4aetomo3io1lmt  i o s0s2xrir3nu4lpe lfvslt)aDum( p;o0tex iieiys aDemn pnt4alxrmrciadla eanvs;s)srur(opiydlp emies tfaDum(monu1tpto i3ias a uan s;t4areomf3ty1lm   n s ( setrxr iu1ap elici tfaDurxrp;t4oexniieild m2umnvp u4arenmo3oatlateaneslt trtm(r oo4ll nmici (fsDrr(rpot4oet io3ilt mDrmuvsn(4texrifcoydomDrlnvi t) 2uo(rpnodol   icia(  2umu oou0opeomoeiytls2ul(mp t4artoxr3iy1oaD ai s s t2xmir oy1lmtemfvsl(fsDum(roou0tlx if3iydls2ea( o (0arxomr3iotoptr uvo s0t2uo(m iodlltnlies (  2tmu oou4tee ioeiys s emumon(4aetnxr3tadfmDrlieol(0 2toxr oy4lptn ncs ( artax  ;u4tpenmo3ilt a raumo u4 leoxr iydop eaneol()setm(rpou1lm  mieil( srtm(  nt1aeeoii3tadfsDran o (0tlxoxf oo1opD  uei;t0 2uo(m3iudap   iei (  Duru pnu4tex io3tadlm ea(vp;(4aexomf3oo1lmD lu olt0t2xm(opiy4omtemfesls)s2rrxmpnt0ole  oeils sDrau p u0 eenxo3oadop rau o;s0 euoxo iydalenmfeta(fsDtr(root4oltoifctatlaDraumonu)tetrir iydlpte i ols)trumxr ou1am emiei tf Drrurpou0teeomf3ilt s2ean p;(4 renxoctydlmtrlivolt0 rumimpno1lme  nct t)s2rmx  nt0ale  oeildls2uaums u) rerxr iytfatr u i;( sexrxm3ou4lptemivtls)artrur ot1oeto iciyt sDul( sn()tlxomr3tydlp rai s ( tetoim nudom elnvtasfs2rrxmp;o0aleomi3iatfa uanvpn() reoifciy1fp raueil( t2uoxr3iydale lfcias arrmurp;u0olenioeilsfa eluvp u4trxnxo oadlpt  nvo t0s2tr(r3iy1oleemnvtl(fsrtmx  oo1oexnifeiltls rl(msnu4altrxo3todfpDrlieils0t2xmxr iu4ol nlfetat  2urx pou1aeeo octatfs2rl(vsnt) exoxr3oydoaD lueo;s s2umir no4ape mfcias  Drax ooo0alxnifeiad m rau ont)tlerio3to1omDeaiei (  2xmimpnu4alenlfvsas) rraxmo;t0ope mfetys sDrlnvp;u0 eenifctatfaDrliei t0teuoio oy1al elivils) Drru o;o1oleo o3tat mDel(ms;t)arermr oa1opt lu i s) 2xr(opou4am nmfvil(faDtru  ;u4tlxn ocils a2rlu pnu) etnifciatoa r nvi s sruoxrpoodlpt lfvsa(  Drru  oo1openio3tls s2rmuvp t)tltoio tytfa eaivi;t0 rtmiopnu4ap nmici ( sDua( o;o0olxo octad s2rmumpnu0 etrmoctydoat li o () exmxr iu4ale  ivs s sDuaxmoou1olxo fetls mDrmnvo u4 rerir totfp  ai ils0sexoim3iu1lm  lfvs s  rraxrp;u1apxo iciysfs2elu o t0 rtomr3oa1fm eln o s0 exm(m3no1ap emncsa(f 2raumpou0opxn ociytlm rl( o;()texrmrciytlmtraieil()tetm(r iudame lnvilsfa2trx pnt0apxnmo3iydfaDrl( snu0tlxnxf oatoaDeli i (0seurxo3nu1lltemies t) Duax pno4openii3iysls2umuvont)tleomo3ia1fm eaneils)srum(r iydam nlnciatfs2ur(rpnu1teeoifciytla ul(ms;t)aetrxr3oatfmtranesls t2xmxr nodaptelfesa(fs2rmumont1optomf3ildlsDulnmonu4tetnxfcto1op e nvols0 eur(o3iudaptelfcsa()a2umumpno0teen oetatfm rln s () eeomr oa1laDe uvol(0 rtoxopno1opte fei t)srrrx p;t1apenif3ildfa umuvs t)artoiocoodomt  n s s) eto(o iy4lme  fvs ( artrur nu0ale iieiasfsDuan s;u0aetnmo ia1opD  i ols s2xmir nodome lfvi s)srta(  ;u4opx iiciydfs2emu s;t4tetnxr3tadfptr nes;s0 rumio ou4amtnlfes ()srtm(m oo0tpxoio3ild m2um(mo;u4texomfcoadom ranei;s srur(o3no4op elfesatfsrrr(r no1opeomocilt m ulnvo t4artrmocia1op elivol()texoxr ou4al   nvil() Duaumo;u0aetoiociydfs elumo;u0tlerioctodfpDrln ol()trtmxm3nu1ol elieil(  ruau poo4tlxomociaslm2rmu sn(4 reomo tydomD luvo;() etm(rpoo1apenmfvi sf Dtmumpnu1ale  f3tytls2um(mo (0 rtomr tydoaD lues;()trtrir3oy4olt  neilt) rtrurpou1tee if3iysfa uan p;t0 lermo oodoaD lu o;t) eto(o3oy4olee ivtlsfsrta(mp;t1tpe  ietldlsDeanvp ()tltoxoctydlptrlues;s)sexm(m3io4lm n ivil()aDraxrono1aeenif3iatfm2rau sn(4trxnmo io1oaDeaivils  rtmxm ou4olt mfvias) Dra(mp;t4tpen iciys aDumn onu4trtnir to1laDraivi s t2xoxmpoy4al nlfcils sDuaxrono4opxn f3tyt mDum(vo;(0artnifcoydfp rai o;t0t2urim ou4lleelfcta()aruaxmp;u0tleomieiatls rm( o (0trerif iatom rlnvols) 2xrxr oodop nlivi s  Duax  no1apxn oeiltls2ulnmsnu0tlxoxr3oodlaDeaiei s0s2ur(r3ou1ameelnetltfarumu onu4tetomf3tld a um(vsnu)teeoxr3tatfp raivo s) rxr(opio4alee ici t) 2raxm ;u0alto oeiltla em( o;u0 lxomrciy1lpDelues (0 2um(r oy1ame mnetlt)arrrx ooo0tptn o3ias a uanvont)aexnmocoadomtrlnvsls0 eurxr iy4aleemietltfa2umxmpoo4aetn f3tyslm2uluvpnu)trtoiocoodfaD lu olt  ruoiopoy4olt mfvslt)a2ta(mo;t4tex ifcils s emnms (4aeenifcootfpDrlivols  rtoir3oudapeemfcsa( arrmu p;u4ole mociasls rlnvsnt4tetoioctatfp eln olt t2uoio iy1omee fviasf 2tmurooo1opeomo3tlsla ra(vpn()aeerxr tydlp r ueols0truoxm nodamtnlnet ( s2raumont1olxomfciaslm2rmn o t4teeomo ta1lpDrliei t)trurimpno1lm nmiet tfsrurur ;u1aeenmietyd a rmumsnu)tlxrmr oodfa elivs;s0t2xmxm3io1aptnliet s  Duru p;o4tex iicils s2um( pnu0tltnmfcootfp  luvs;s)teto(m oy4lp e nctat)a2rr(mp;t0aetoioeiaslm rmump;(4altoxo3oatfpt  i s t0s2trimpoo1apte ivtlt  Dtmx pot0oleomoeilsfsDrauvs t)tetrmf3tydom elu s;s)s2um(opoodol nmics ()s2rmumpou4olxnmoctlt a umums;u0alxrir oy1om e uvs ()srtmirpou4lp nmnesa( a2ra(r nu4apxoifcias s ulu o;u0aleomociy1lpD livols0t2uo(r iydlp nmieilt  rrruro;u4opx mo3iadfm ua( p t4tlenif3iydfmDelnvi;s0tetrxr io1am emnctas a2urx  no1apxo o3iltlsDemnvs;u0aeeomo3iydfpt aivs t)s2uriopoy4ol  lnetls artrumpot4ale  ictysfmDrauvo t4 rxoxoctydopteauvo;()t2xrxopoydlme  ivi (fsDumxr oo4aetomo3ilsla2elumsn(4aetnir oatoa   nvs t s2tmio ny1omeelnesltfsDrm(rooo1alen fctad m el( s t4 ltoxo iytfpDeaivolt) 2umxmpoy1am elnvs t) Dtrxr ;t4tlenmietas aDrmn s;u0 exnxr oytoatrluvs s)srxoio ny1amtnmnct ( a2taxrpno0alen fciatfmDrauvo;u4altoif3oytfmt livo s0t2xm(r3iu4aptn fei t)srumx pot0aeeo i3iydla2rmuvs;(4arerir3iytfmtrlu ol()tetmxm oodal  lnvia()arraurooo4openifctys sDemu o;t0trenmo ia1fatean ols0 exm(r3iydam e fcsl(  2rm(rooo0tltnifciad sDea(msnt)aexnmr3iotfpte ies t0texmiopoy1lm nmfetas)a2umuro;o4tptoiociatlm2ua( pn(0 eerio tatfaDranvs;s  rtmxm3ny1omtn icsatf 2rrum ;t4tpt mf3iad sDel(ms;t0 lxoxrciadlmtr ieo s)trtmio ou4ol nlnvslt a2trur nu4ole mf3iyt s2umn p t4 eeomf3iy1lm elivsls)srtoxmpiydlp elnci t)a2ur(mpou1oltn ocilt s el( snu4 etnxfctotfat  neils)s2tm(opny1llenmncsls arururpnt1olxoif3tysla2rluvs;u)texnircio1late n s t  2urxmpiodap  mnciat a2rm(rpou0tpxomociatlm elu s;u4 eerxo3ootlm ean s;() rumio no1om  lfvtl(faDuau  nu0oex mo3tysfaDea( s;u0arenif3iydopDeanvs;t  2tm(mpoydoptn icsl(f Dur(r oo0apxnio3iatla el(vp;(4arxomf oy1fmDrlu il( texmxr oydlme lnvs tfs2umu pnt1tlt iictad mDuau s;t4alxoir3iotoaDe ies;s trtoxmpoodap   nesat  rraxro;o0apen oeilsfs ea( p t4 lxnircoytfpD li ils) rtoxm3iudop n nesasfa2ra(m ;o4oltnmo3iysfmDum( s () ltoxr3iotlm e nes s srto(o3oy4om   iet ( aDurxr ;t0tpxo iciyt a2ul( o t4trxrmo3tatlp rluvolt srtm(r3nodaleemfes (faDurumpot1oetnmoeiyd aDrlnmp;t)treomocto1opDranvo ( srxmxm3io4lp  lfcsatf 2tru  nu1alx mieiasfmDulu s (0altnxfcto1oa r u ols0trxmxo iudol nlfctat) 2tr( onu0texn f3tltlmDel(mp;u0trerif3oatoatrlieo;(0tetoxr3nu1olte ici ( sDra(rono1tetnmieildfs ra( s;u4 leoxr3iydfmte u s;s)t2xo(o3oydlm emnetatf rrmurp;t0alx iictatfs eau o;()altomrciydfaDr iesl()sexoim iy4ll e ivsl()srumu p;t4apeoiicildfm2uanvsnt4 eerif iadfaD  nvs;t  exo(r3nu4apeemneia()a2rmxrpnu4opxomi3ildlm2ua( pn(0aeeomrcia1opDeliei s0tetmio3iu4apenmnei tfsrrrx o;t4apto o3iltfsDeauvs u0trtrmociadfpt lies s)s2xoim3iu1lmenlneil(farum(r ;u4tle  ictltls eau s t0 etrmf iy1oa  lu s;( trxmxmpoo4ape lfei (  2urxr no1apx mictasfa eanvs u0arenxrcoodopDeaivo t  rurxm iu1opeemfci (farrmxr ;o0olto ieiadfs umnvp;(0treomf3todlpDr n s s teur(rpou1lmen ietls  2tau  nt1aet mo3tad mDuanvp;()aleoio todfpDr ies t)t2xmxo3nodamt mieiltfaDum( p;o0oexniociys aDrl( o;t)altrmo tytfp eai i s0texrxm3oy4ome lfcs t)sDua(r oo1tlxomoctldfa2em(mon(0arxoir3iadfatr nes (0srxrxrpio1ope lfeils)a2rm(moou0tptomfctydlm2ua( p;()arxrxr iadla raues t0seurirpio4op emnet sfsrtm( o;t0aee ioetas m em(vo;t)altomr3iytoatrau i s sexrirpoodll elncsat a2urur ;o4tpto ictls m ua( p t) exomocty1lm r u i;t  rtmimpiudam elnvtat aDrmur ;u4tltnioeiat m em( s;()trxoxr ty1oateaivi;s0s2xm(m nydop nmneilsf Draxroot4optn f3tasla rau p;u0altnxocty1oateaueo;t)s2to(o no1lm  mnes t s2rmxmono0aeen f3iadfaDumumo;()tetrxo iotlatrlivs;s)s2tmxo iodlmeelnvt t sDtr( pno1ole iocias s2rm(vsn(0arermo oa1laDr u i;t0t2urirpnydame livtat s2trur ;u1tet  ieiydls2rlnmonu)teeoxo iydopDeaieo t)texrir3io1lmen nct ( sDur(r ;t4tpx ifeiad mDranvo u0trtnxf oa1fpD  u s;s0 2uoir ou1ope  ncs (f 2um(rpnu1ole mf3ias sDuaump (4aexoxo ta1fp eaueols)trxmir3io4oleemicta(f Durumpno1olxoiiciysfa2elump;()tltrmo iy1la eluvol(0s2xoxrpiy4opt livta()srurur nu1oex  o3ildfmDeaump;(0treoiociytfaDrlnvi (0truoxrpoydll nmicta( a2ra(mpnu0apt  feiat sDrlump u4trerio ty1omtraivi () eurxmpnu4aleelivi tfsruax  no4texoio3ias m eanvo u4altrif iytfpteauvs;(0s2xmxr3iy4opeelfvtas)srrmxr no1apxo oeilsfm rl(mpn(0trenioctytfaDrli sls0s2xm(opno1lmen fcta( s2tm( pnt4apxnio3iadfs el(vs;t) eermr iytom rai s t  2uoio iydope  nvsa(f Draumpou0aexnmiciadfm2ul(vs;u4aexrmf3ia1lpDe ieol(0srtrio3nu1lmt lics sfsDtau  nu0oleo i3iysfs2ea(vp;()artrif tadfpDeai s;t)srxr(o3ny1al  liviat srtmurpnt4tlx  o3ilslaDulums t)altnxo3oy1fpD  n i;s)texrxm oy4lp nmics t  2trxmono0aptn ietltlsDem(ms;u0tetrir3to1laDeai s t)trtoxrpoudlmtnmfvias)arrmxr no4apenmfeildla2umnvo t4arxomo oa1lat anvol() rtoxmpno4lltelietls aruau  nu4alen i3iys a rmums;() rtomo ty1faD aueols0s2xoirpnu1llen ncslt)aDtm( p;o1tptomfeilsfa ean pnu4 leoiocia1la r ues t seto(rpoodllenlnvsat sDurx  nt0aetoioeiad sDeln p t0texnmrcoo1lpt luei;s) 2urxm oodame mfetlt)a2ur( p;u0aetoifctlsla2um(mpn()altoio3ootoaD  neo;s0trtoirpnu4op nlieiltf Dtmurp;o4texn ieiad aDulnvo;t4 eerirciy1lmteanvo s  exoirpnydlmtn feilt srrrxrpnt0opt  ieiaslm ulnmsnt)alenmrcio1laDraieslt0 2xm(o3no1altnlneil( arur( oou0tpen ictytlm el( o ()aetnxf3io1op   nesl() eumxr nodoltn ieiat)s2uau  nu1olto i3ias sDrmu p t0tetoxr3oo1lpt lnes t)trtoxmpiu4omeelictlt) rrrumpou1tpxn fetltls2uauvp ()trermo3oa1lmt li s t0 rtr(m3io1oleelivsas)artrxroot1tex moeildls2rmn on(4tlxoif oy1oatelivi s)srxm(m3iydamt  iviltfs2umxmp;t4olxomo3iytfm rm( o;u0tltomo ootom  lueol( trtoxo iydal  mnvs tf rrmxmpot4aptoif3iydfmDelnmo t4 leoiocio1op e i i t0 2tm(rpiy4llt mfcsat)arrmum oo4oetnmfcild m ranmp (0 rerir iadlp ranei () etoxrpiodoltn fvs (f Dtaurono0optoiociltla2rmnvp;(0aeeoio oodfaD anesl(  ruo(m oo1ll emneils) Dururpou1tlx if3ilt a2rmnvo (4areoxf iytfaDeaneol()srtoxo3ny4olt mfeslt)sDrrumpnt1aptnmoctat a ran s;()aeeomr3oadfmt  nei;t setmim3no1lp n ivt t)srrmxrpnu1olto f3iyt s2ean p;t4artoxoctatlpt auvil(0 rxoimpou1oleelietls)aDtaxronu4oeeomf3tasls ran p;(4 lenio3tydfmDe nvs;(0trxriopny1lmtemfvi ( s2taxmoou4aex mictysls rmn snt0tlermo iytom eauvi;() 2umxmpoy4ole lfvt tfs2um(  no4oee iociad aDumn sn() etrifctatfpt au s t0 etr(r iudolee ivt (f rurxmooo0opxoio3iyslsDranmp;t0tlxomf3ty1lptr nvo;s)srxoio oydam emieil(farrau o;o1apx if3ild s ulnmpn()altomoctotfpDe uvo;(0trxoxo iu1olen fvia(  Dra(mont0opt  feiyslsDraumo;(4tlermf3oydla eaiei s0trtmir nudlle mfeiltf ruau ono1oltnif3tadls em(mont0tltoif3ootomteluvi (  rumxo oudlltemfvsl(  Duau p;u0olenmocilt mDul(vs (0 rxoxrctodfa  ln ols) 2umxmpoy1amt  fvi t)aDrm(  nt1tpxo i3tysfsDuauvo ()trxrir3totfm e nvi t) 2xmxo io4op emnvilt sDrmx  nt0oet ifetatfaDrlump t)tlxrxoctadfmteaneslt0srxrxo3no1oltelivsltfsDumxm ou0tpt ifctytlm rmuvo;t)texnxo3oa1omD  n sl(0trtoir ou1lptnmnvtlt) 2um(  ot1optomfeiasfs ua( sn(0 leoio iodfa eln slt0srtr(opiu4oltnlfvs ()aDtmxmono0apeo oeias m2rln onu)treniocoodla  auvolt)srtr(o ou1oltelncilt)aruaurpnt1alxn ieilt aDranms;t)artrmr oo1latelueo t0t2toir3io4omtelneilt aDrrx pot4optn f3iyslsDea(mpnt0areoio3tadfat aiei;(0 exrio nudom  mfetls)s2tau  no4apxomoeild aDean o;u4 lxrmrciatfate uvsl()tetm(o oodoptnmics ( s2umuroot0oleoifeild a eauvs ()teeoxr oo1lm  aiei;t0s2trxo oydaptemneiat)srraumooo0oetomf3iadfa elumsnt0teerifcoo1fp e ivilt)t2um(opiu1ap nmnvtasfarrm(mpno1opeo fctyd mDulu snu0arxnmr iytfmDeliei s)seuoxopnydopeemncs t)sDurxronu1ope miciys sDraumo u4tlxoifctytop r n o ( trto(o iu1amt mfvta(  rrmumoou4aet mf3ilt sDulu s u0aetniocta1laDr i ol( t2umim3nu4op n fct t aDraxroot0oexoif3tlslaDuanmo;u4 lxoxo iatlatranvi;s0 2toimpnydal  mnvias  rtru p;u1olx  i3tatfs2umn sn(4 ltrir iy1fm elnei (0tetrxo3iu1aptemncsat) 2trumo;u4texoifetasfm ulnmp (4tlxrio3oy1omt ln o;s tetoirpnydlleemicslsf rraxm oo1aeen f3iad s rl( p u4arxnmr3oydop eli slt s2umxrpnudameemiet s  2raxroou1aexo o3iadls2rm(mont0alerifciydlm r n i;s0seur(r oo4opt mnvil(fs2trx  nt0apt mf3iltlaDeauvo;u0arxnmo3tytlpteaueol()teumxo3oo4apenmfcs ( aDrax pot0teen fciadlsDumnvp t)altoio oytomtrlieo (0srtoim oy1ll  mivsl()artaurp;o1ope iictadfs2el(vo;()trxrio iodomDe u i t  euo(o oudll e ivs tf Draxmooo1oexomi3iat s2umu p;()texnxf3tatop eanvilt t2tr(r io4ll n neias) 2taxro;o4tlt  oeiadls2eauvonu)tltrmfciodla   neslt)setrxr3ou4omeelfvt sfa2uaxronu1tleomo3iytfaDrlumon() eenircootlmtrai sl( s2umimpoodome mnvsls) Dtr(rpnu0teeoii3iatfs uln p (0texomo tydfatr ieo t  rumxo nu1apeelies sf Dur(rp;o0apt iocilsfs em( s t4aetoif oo1latrlu s s)s2xoiopny1ol n icta(f 2tm(r ;t0aptnifcilt m2ean p () exomr todfp e uvilt s2urxm3oo4lmtelnvs s) Drruro;o0olt  f3iltla2ulumsnt)artoxf oa1oaD ai o s t2uoxrpiy4ole lieil()sDua( o;t1tpxn fciasla el(vsnt4teeoxf tydomDeaiei (0sruriopno4amtn fvi tfaDra(r ;u4aetniieiad m2uauvs;u0teenxfcoy1lm rauei;(0t2toxrpiodaptnlictat  2ur(mpot1tlen oeiys s ua( p;(4alxoxf oatfmDe uvi;t0s2umirpoodamtnlfciat srrm(  ou4optomictyd a eln s;t4aetoir3todfa r i slt) etoiopnydlmtemfeils srum( ono1aptoioetad mDra(vs u0 ltomf3iadfaDelueols srxo(m3nu1op elieil( artau ono1aexomfciytlaDeau o;(4trtnxf3to1lmte neolt seurxr3iu4lm nlfvta(f Dtmx o;t0tleoioctltlm el(monu4 exoir oatopDe n sl() etmir3ou4op nlnet s) 2rax pot0opx if3tltfs2rln onu4 eeomo3oytopD lnes t)srxrxr3oodape lfci tfa2trxm ;t4opto i3tytlsDranvont)tlxrxrcoodop r ueil()trurxo oo4ameemncs ()s2urx p;o1tptomi3tytfm ulump ()altnmoctadlpD au sl(0srtr(o nodome mfvsatfaruauroou4aleoio3iatfs2umnmo u)alerxr tydlaDrli i t  rurimpno1ap elneia()arum(  no0tpx mi3iytfmDeauvont)texomf3oodfpD ln s;t srto(opoodll emicias)artmxm nu1opx mictad m2umumont4aeeoxr3oodlmt au ilt s2xr(m nydale lfvias arraumpot0oeen oetldfm2raumo t)texoiociotla e neilt)s2tr(opiu4alt mictl() 2trx pot0texniietlsfa rauvo t) ltrir3tadlatrlivo t0trtoxr3oudolenmfcslt s2ta(mpnt1alt ii3tatlaDelu o;u4artrio oy1fptraueo () 2xoirpno1optn neta( srrrum ;o0oexnmf3iydfaDrl( s;t) ltrxf iytom eai s;(0 2xrim oudopeemnviasfsrumu  ;t4tltnmf3tldfa umumpn(4 lenxfcio1omD li o s setoxm oodll elies () Drrxmpnu1tpxoio3tad s2rmuvs t) reoif iodlmDeli ol(0teurir nudlpe mivs sfsrra( ono1oltn fcils s rauvpnu4texrxr ta1oa elnvo t)trxrxm3ny4ome mnctat)aDtmxro;u0aeeomietytfa2emnmo;()teerio totlp  livol(0teuriopny1al nmieils s2trxrooo4teeo fciys m2ul(vont)altnifcia1fateln o t)texm(o nu4olee ivslt sruru  ou4tlt  i3iltfmDrm( p;u) etoifcto1lmDeluvs;()t2xm(mpoudamen nctl(  Dra(m oo0alx  f3iltfs ra( snt0arenmf oodop r ivi;(0sruoio3nu4omt mfct t) Draxmonu4opto fetltlsDrl( o (4aexnmocto1omD lnvi;s0trxoxm ou4ole mfei s) 2rm( ont0olenmi3iadfaDrlnmp (4 rtomr tydfate u i;t)trtr(opiy4ape livtatf rta( oou1opxo fetldlsDrmn s ()tetrxr tydomteluei;t0 etmxr3iy1lp e fei (f rrrumpot1tleomo3tlsfm ua( o (4aeeoxocoydomD li s s t2xmio oo4omtemivtl(  2uau oou1aet mfctys a2ua( p (4alenmr3iy1oa  luei;s0 euoio io1lptnmiciat)a2rm(m ;o0teeoifetadlsDemnmon(4 lenxf3totlatelivils s2xo(r3no4lp e icil()sDrr(r ;o4tlx  ieilsfaDeaumo;u)alxomr iatoateanes;(0tetrio3oy1apt livtas) 2ta(r ot1tlto icils s2rluvs u)tltrxf iytoa rli s t sruoxmpno1ll elfcs (f Dua(ront0opxomfetydfa eau p u0 lxrmfciotlpDr ivslt0teumir3oodlptnliesl()s2tau pou1tltoioeilsfm rlnvs;t0aeenmoctydlp  anvs s)truoxrpnu1optelfvsl(  2tmum nu1tltnmociasfmDumu s;t0 eenifciatfmDrluei;t) etoir io4aptn ivil()a2tax oot0tpenioctad a em(vo;()trxnmf iotoaDr ueo;s0 eumir3iydlle  fctlt)a2raurpno1tet  fcias sDuaumo t)altrmocoa1oaDe n s s) eumxopiydamtn net tfsDtrxmp;u1tle miciytlaDemuvon(4 rxoif3ta1lpDrlnvi t0t2ur(r oy4lmenlfvi () 2rmu  ;u1alxomfctlsls rlump;t4 renioctodlm r n i;s) exoim nu4lp e icslsf 2urxr oo1ole  f3iadfaDra( s;t)trenxo3oadom   ueols  rtriopiu4olenlnciatfsrua(mpnt0oexnioeiad s2rau on(4alxoioctydlp  ai sl()srxrxo3iydomen fcsl(f ruau p;u1tlt  fetyslm2rauvp t4aeeoxociadlaD  iei;()trtm(m3oodlle mnes s aDtrx pot0tpeo iciydlm ul(vpn(4 rxoxrciytfa  anvo t) rtrxmpio4lltnlfei (fsDrm(m no4aex ifciysfmDea(mo;t0 lerxr3iydfmtran ils s2toxo iu4lmtelfcs ( a2ta(mp;t0alt ifeiys s2emn snt4tlxoxf3oadfm e n i;s0 euoxr3io4lm emict () rtaxmpou4ole  i3tysfs eanvp t0arxomfctydfat auei t0trto(m nydam e ieils)aDua(  ou1tpeomocildlm elnvo t4 ltrif3iydom   ueol() 2xmxm3no4lmenlfesl()arrrx ooo1oee mf3iyd s2uanvsnu4altnir oo1fptr ivs t trumxr oudamenmiesa()srumu  ot1oex mf3tltlsDea(mp (4trxnxo3tydomDe ieols  2to(mpoodopte nci ()aDtax  ou1ale if3iadla2em( o;(0 rxrmr3tytlaDrlu i;t)s2xmxmpio4om elnctltf rtr( p;u0tlen i3tysfs ea(vs;() etrxr totlp rlu s s trxm(mpnudolenlfci ()a2ta(mo;t4oeeomfctasfm2rluvs u0 exrxf ty1fpteanei s seumxo oodal   ivs s arur(root4tlxn iciydls2rmn snu0trxoio totoptrli o s texmxopno4lptn fcsltf Drrx ooo1tetnmi3iat s2um( o t4aetomo iy1lpt  i ils)t2tmxr3oo4apt mies sfaDrrxm no1ape  ieiat aDra( o;(0trtomr oadfp  auvi;t seurir io1ap  micsas sDum(r oo1olen icildfa2rau p t4 exomfciytfaDrlneo;t  2xo(mpnudopt livils s2ur(mpot4tlenifciadfsDemump;u4 ltrio3tatlaDraivolt) eumir ny4olenmfcs s) Drmu  no4tptnmoeilsfm2ul(mp;u4aeerio oatoaDrlu o;() 2xoxo ny1altn fes t aDurxmo;t1alt mi3ildls uln s u) leoio oytfaD  ivs;()trxrio3iydam elfcs sf rurx  ;t1apt mo3tys s ulnmp;u4 rermr todop  li i (0trxrim nu1olenmfvsls  2tau oou4optn i3iltfs2rauvo t0 rerxr3oatom elueo;t s2trxmpnu4am nlfei (farumxrono0alenioetlt m2elnvsn(4alxoircto1omDeanvi;( trtrxm oy1olt mfvi tf 2rr(  no4alxn oetyt s2ulump t)trenxo3oodomD li o;s sexrxmpnu1olenlneiltf Dra(mpnt4alxomociytls rl(vp (0 reoif3iatfmDrlivo (0sexo(mpoo4lmtemfvsa(fsrrr( poo1altomieiasfa rlu s;t) exnmf ootlmDe n i () 2xo(r3nu1opee fvtl(  ruau ont1oetnii3iytfs2ulu o;(0teerxf3iatlaD an o s) rxmxm3oy1llte feilt)s2rr(moot4opx moetldfa ranvo (0altrxr oydfpDe ivo () rurim3iy4amt liei s) rtmu ono4olt if3iat mDul(ms;(4aexrmr3oodopt an o;(0s2uoio iodlm  lnet t a2tm(ronu1aexomfcild m2emn p;() rerxr to1lp  lues;t0 ruoio oudol n ivils)sDrm(ro;t4tetn ociatfmDea( o;t4trtomfctotoptrau sl( texo(r io1alt lnes ()artmumonu4tptnmf3tadla ean onu4artrioctotopte uvils)teurxm3iy1ol  mivta()s2trxmp;t4tlx  fciasfm rm(vp;t)teeoxfcoytla   u o t0 2xm(r3nodlm  mfcs s a2tm(  nu1tlxnmf3iadls uln p;t)alxoif totom  an i;(0teuo(m3nu4lm   feiat)arumxr nt4optnio3ils m em(mp t4 rtoio3oy1omte uvi;s)trumxopoodap  lnetlt  2rm(  ;t0oltniiciasfm rlnvpnt0 eerxrctotfaDelnes s trxrio3oodope lnes ()sDtrum no0aeeniieildlaDelu p t0aexoifciytfaDranvols srtrio3oy1lpe  icia(  rraxr ot4ape  ictadfm2rauvo (4aeermr iadla  aneo t s2uoxmpiodolt mnvs sfa2ta(mont4tpen o3iyt a2ea(msnu)aeenxf3oo1lmDrlueo t0srtmxrpoydlltnmict s artmur ;u4tex  f3tysfa2umn p;()arenmoctadoa elivs;t0 rtoim oy1lp  livtlsfs2tr(m nt0tpeniicildfsDrmn s t) exomr ootlaD lues;s)s2ur(r3nudlm  lfvilt)aDrmxmpno4tpen i3iytls uau p t) eeoxf3iytop e ivo;t0trxmxr3io1llt lfeils  rumxrpoo0oexomocils s2ean s;u)tlerio3ootfmte ieo;t  rtmiopnu4apenlnvt s aDum(rpnu1aptnmi3iasfm rau p;u0aexrio iydopDeauei s) 2xoirpiy4alt liei ()srurx o;o1aee if3iys sDulnmo () rxrxo iodfm rau sls) exm(opoydll  liet (  Dtauront4alt  oeiyd mDemu p;t) rermr3oydlm  anvsls0seuo(o3iu1om nlfcsltfa2ra(  ;o1olt  fcildls em(ms u0altomociydlm elivi t0 2toim3oo4omtn nctas  rtmu poo0ope  fciytfa2rmnvo u4 leoxr iodfatr u ols s2uoim oo4llenmnetls a2uau  nt0teenmietytla uaumsnu4areoif oydop e ivs;(0t2toimpiu4ll   ieia( aDur(r ;u1aeenmi3tasfm2eauvsn() rxrxr ootlmtranes t s2um(mpoy1amee iesat srrmu o;u1olxnmfcils a2rmums t4artoxf3iydlpD li o s) 2tmirpnydlpe mieslt  ruax pnu4olxomi3iadfs2ea(mp;u0tetrir oatlaDeaivols t2trxopio4om nmfetlt a2uaumpou1tpenifciytlm el(ms;u4aeeoxo3tytoate ieilt0trumir3iu4ope mfvtls aDuaumo;o0oetnif3ildlm rl( p t)tetnmf ty1lmD  ies;t0seumirpnudope lfes (fsDtaurp;u1alt mietytfmDeluvo;t0aexrmrcoa1lpDeluvi;t setr(r iy4opt lnct (  Dtax pou0tpe ifciltfa2umn s t4tetnxo3ta1om rluvs ( texmxmpio1lme lfvsltf 2tr( ono4oltn f3ildla2rmumpn()artomfciydlmD lneslt tetoirpoodll nmieslt  rua( ooo0alxnifcildlmDem( ont0 rxrxr3ootomtelivo t)t2tmxo3io4om emfes ()s2ua( ooo4apx iiciyslm2ranmp t4 rxnmr iodom  li s;(0 rxrirpio1lp emictl() rrrurooo4apeo fciys a2umump;t0alenmf oytfateau s;t0srum(o3oodomenlnci t s2ururo;o1alxomoetyslsDrlump () lerio3oy1lpDeauvs t0s2trxr iudlle lnvt t sDuaxmp;u0tex  oeiytfm eanmon(0artrxrctydoptr n s;s)seurxr3no1ap nmnesa(f rrau p;o1olxoioetys s rmnmsnt0trxnmo3ty1lpt lieo s0seuoimpoy4altn fvil(f Dum(ronu1aleomoetltlm2rlnvo (0 ltnxfcty1om rlnei;t0srxm(rpiy1lptnlieiltfartax ooo4tle io3tydfm2emn pnu0altrmf3tydfatran ilt)t2tmxo oo1omtn fciltf rrmxmp;t1opxoifciatfaDra(vs;t0tltoxocoy1lp   uei;s) exr(mpiy1opeemiviltf Dtru oot4apx mfeiad m uanvo ()tetoxf3io1lmDrlu o t) 2uoimpny1optnlieiatf rtm( pnt4opxniicildlm2rm(vo t0 rtrmo3tatla rlnei;t0 2xrio3nydap nmfct t sDumur no4aex iictasla rln p t4aeeoio3iy1opD anvi;s)t2trxrpno4apte fesltfsDuru ono4tleomociad a2umu ont4 renxrcoytla ran i t)srumimpiodll emnvt sfsDum(roou4aeto iciltls2rl(ms u0altoir ia1op  aues;() eumirpno4lpe mnes tf 2rm(rpnt0olxn feiltls emn o;u4aetoif iadlm  lieil()trtr(r3nu4openmicias  Drmxr ;o4aptoifeiysfs2ul( s u)artrxo3iadla   neols0srurir oo1apt lncsl(  rrrxrpnt0texomo3tadlsDemuvpn(4aleoir oy1optrau i;( s2xrxo iudapenlfvi (fs2rm(moot1apt  oetldfmDra(msn()tlxrif ia1om   n o;s0texoir3oy1ome mivslsf rur( poo4tpx  o3iatfs rmnmp u4tltrxocoo1fpDrlueslt)trxoxm3io4alt  ics () rtrur ;u4olenii3iad mDemump;t0tlxrif3ta1fmtrlivs;()texmxo nydap eliet tfa2urx  ot4oleo i3tad sDumuvp u4 etnirctatfpDe ivo s0 eum(mpny4amtelictlt) 2raxrpnu0aet  fciadfm umnvsnu)altrxrcio1la r i s;(0s2toiopoy4aptnmfetls arrmx p;t1aexoiiciatfm2um(mo ()trtnmf oydfpDr n i (0 2xr(rpoy4apt liviatfaDua(m no0oeenioctldfm2ua( snt)texnif3todfatrauvi () rxr(r3ou1alte feia(fa2ta( ooo0aptnmoctltfs2elnvo;t) reoif3oy1lp e ivo;s0truoim ny4op e ncilt) 2uaxrono4opeomfcilsfa2rlnms u)tlxrif iatlm e ieo;t0 2urir nu4ale lfct t)aDuru pnt1oex if3ilsla2umnmo (0 rtomo iydlatran i ()texrio io1lp e nei s)aDumxmp;o1apeomiciydfs rmnvs;(0 renifctatfmD anvs (  rxo(m3no1optnmfeias)sDur(r nu0alen o3ilt a2ranmp u4 rxrxr todfp e uvol(0 exoirpiudlp   nesls)sDtrxmoou1olxn i3iad s eluvsn(4altoxo3iytfmD  ueo;s sruoirpny4alt lnetasfaDrrx o;o1tpx mfciatfm rm(mp ()altomrctadla eauei t)sexmir3nu1lle mfei ( sDua(m ou0olx  oeild mDumnvp;(4alenif totop  lu sl()t2trio nu1lm n fci s aDrrxmpnt1tleoii3tytfmDumumpnu4tltoxrcto1lmte ivs s  rtrxo3nu1amt lfetlt)arua(rpno1oeeniociat s rl( pnu0 leomo iatlaD  ivil()s2umir iydame mietatf rtaxmp;u1tlxnio3ildlm emn s u) rxomrciotlm e nvsl() 2uo(r iu1lp n fesl(fsDrmu  ;u1tetoioeiytla2em( o;t4 rxoirciytopt lueo (  2to(m3oudol elfcilt)sDua(  ;t0optnii3tytfsDrluvs t)trtrxf3totfa e nvsls t2trxo io1lpenlicil( srtmx pot1ale  ieiadls2ulnvo;(4 rtoif3ta1lm   i i (0seur(mpoy1ape mfciat) rur( onu0oet ioetldfs2um(mo t)tlenxr iodoa elnvi;( trtr(r3nodlpt lfcil()aDrmu pou4olt ifeild s uau sn(4 exnir3totfm elueilt  euoxmpoudlleemnvil(  2ta(ronu4alt  o3iadlaDran s;u0trtnmr3iydlptrln sls)s2xrxmpoy4alte fciat)a2urur oo0oeeomf3ilt a2uanmp () exrxr3iotfp   uvol( t2tmxo3io4omen feilsfarrau poo0tle ifeiys m raumo;t0arenio to1fm rauvs s0 ruoxm3ny4al  lfci sfarur(rpnu1tetoiicils aDemnms;(0tetnmo3oodfaDr nvo t0srxriopny1lltelfviat aDuaumonu0open f3iad a ulump u) lxoifctatomte uvi t)trxo(m3ou1open ictl( a2taurpnu4aee  ociytlm2umums u0texrmr ia1lmtelneo t) rxr(r oo1opte iei t sDrr(mo;t0aee  fciasfm2ulnvo;t)aexnmf3tadomDeanvo;t0 etoir3nu4lm e ivtltfs2um(mp;t1tlx iociatlsDum(mo u4 rermrcty1lateau o;t t2xm(mpno1am elicsas  2tr(  no4texnioctlt a2eanmon(4tltnmo totlat auvi;s)texr(o oo4aptnmnvtasf Dtrurpou0apto iciysfm ean s (0teenmrcio1opDelnvo t0t2trxr3iy4am elncsl()aDurxmpno0oee iieiltlm2rmu s;t0 ltomr ootla elu i;s) rxmxrpnydomeelneiat  Dtaxmpnu1tetoiieildla2rlums u4texoxoctytfaDeln s ()tetmir3ny4lleelivil()aDumx oot0ale  ietadlmDul( s () exrxo iotfmtrau sl( tetoxr io4lle  nctasfs2trx oou4tleoifctysla2uan sn(4tetrir3tadoa ean s ( trxm(mpny4lmeemies tf Drmxr ;o0oeenmocias s el(mp;u0 etnif3iatfmtrln sls0 etmiopiu1omt miesat  2rr(mpnu1openifeiltlsDul(mo u4aetoxf3tatlmteanvi s  2xoimpiy1apeemies s)arrmxrono4tle  ieiltlm rau p;t0 rerxo3oo1om e n s t) rtoxm3iy4lm  mnvs t aDta(m ot0ope  feiatfm rauvo;u0aexnmociy1fm  luvilt teuoxopoo4apte nei (f 2raxr nu0apxo o3iasls umums t0 etnir3iatoa raueols srumir io1apt  fvt s)aDtru  ;u4aeen ieils a ea( pnu4treoxf3oydoat au o;t0 exo(m oo1lpt  fctl()sDrm( pnt0alx  o3tyt m um( ont0treoir iadfp r ueo;s t2umim io1altemfei () 2urxr ot1apxnmieiydfm2ua(vp;t)trtrmfcia1lmD au s t0truoirpiodam emfcsl(fa2taxmp;o4tlt ii3tatfs2ra(mo t) etrmf3iy1oatran s t0t2xmir iy4al n fesa()s2tr(  ;t4aptoioeilsfm2rm(mo u) etnmrcoodlpteanvo;s)texr(m3oy4opt  neil()aDtmum nt4tlt  i3iysfa2emuvonu0 eerifcootlpte u il( teurir oy1lmeemfcs s)s2raxm ou0aeeomieiltfs2ean on(0alerir3tydlmtrlu olt  2uo(r3ou4lmee iet t  Dtmumoou4tlt ifciad mDelu s t4altoxocoadfa rln i s  exmxrpiy4op emfci (fsDrrumoot4aetoifctls sDulnvon(0aleoio3iy1fmDeai ils) 2umiopou4aptnlivs t)aDua(rono1opxnifcilt aDrm(mp;(0 eeoirciytlateli o t trxrxopou4amtn nesas)a2ta(mpoo4olt  fetat mDrauvsnu4alxnxf oa1om eluesls trum(r3nydapeemicil(  rrrumpoo0alto f3tydlsDumu pn(4teenio3oy1lmt an s;t trxoio3oy1al  lneiltf Drmumpnt1oet mfciaslm2rln snu4 reomr3to1lm  luvs;s  2ur(r3nu4lptnmncs t s2rmumpnt0apx moetldfs uln pnt0altrxociodfatrlu i s)trxmirpoy4lmen nvi ()arurumpot4tpt mociasfmDrm(mpn()tlxoxrciatlmtr ivs;t) rtmxm iydameemneias)aruaurpno1tptn i3tasla2eanmp t0 ltoxo3ia1oaD auvs s0 etrio3io1lltemfciltfaDururpou4opxnif3iydls2rln s;(4texrir iotla e nvslt)seuoiopiydam nlies s aDrr(mpou0aexoii3iaslsDum( s;t)aeermr oo1la rlieol( tetoxmpnu4lpt licta(fs2raur no4tlxomf3tldfm rl( onu4 rxoxocia1fpDeanes;s)sexmxm oo1ole mieils arrm(r ou4tpxoiocilt aDum(vpn()aexnxrciydfat an ilt)truo(o3io1am nmfcsls aruax pnu4tleoio3tyd m2ea(mo;(0aeenmrcoydop  aieils sexmxm3iy1op  lietlt)srrr( o;o0tpx  i3iadlsDraumsnt4artrmfciadlp  auvils srtrxm3nu1lpeelivtas)a2tmumpnu1ale  ietltfm ea(vs t0 rtrif iydfpDrai s s) rxrir3oudome mncsa()artrxrono4opeo f3iysla rlumo;u4tetoxo3to1fatr u i;s0texrir oodlle lfvsl(faruru  nt0oet mo3tas m2em(mp u)teenio tatfpD  iei;t0srtr(opno1ameemfci (f rrm(m nt0oeeniociadfs2rlnvonu0tlxnmfcio1latelieol(0tetr(m3nu1op e fvi t)sDtax poo1opx miciat s ra(mo;u0tltrxf iotlm  anvs (0 2xoxo3ny1om emivsltfsDtmxr ot4aex iietadfa2elumo t)artoirctadla  lu i;(  2umxopoudap emivtlsfarur(m ;t4openiociat mDemnvont0arerir3iotlatr n ols) exrirpoo4lp  lict () 2umxmo;t1aexomi3ilsfaDel(vs;(0 eenirctydopteli s;s0s2xoimpnydlleemicilt)aDrrum nu4aleomo3iadlmDrmu p;t0aexoiocoatopt anvils)srxoxopoo1oltelfct (fa2rau pot4oexnmieildfsDuluvs (0teermr3totlateanei;(  rurio3iu1al elivsas)srurur ot0oet ii3tytfa2um(vs t)alxrmo3oodopD  uvolt)s2trxopny1ol  lncias)aDrm( p;t1tpx mo3tlt a ua(ms;u) lxoif tydfat anvi;(0srxoxmpny1ope lictasfaDum( o;o0oeeoii3tysfa2elnmo t)tlxnifcoatfa rauvs (  rxrio3iu4omenlivt tfs2rr(m oo4aptomicilslmDum( p;u0tltrxociadlaDean o;t) exoxmpiudoltemivsltf 2tmx o;u0teto i3iys m2rm( s (0 lerxo3oy1optrlnei;t s2umim oodlme  fvi t)s2rr( pnu4apeniieilsfm eau o;()aetrmrciatlp eanesl(0 ruo(opiu1alenliesas s2rm(mooo4ole mi3ildfm2ea(ms;(0trtomf3ootla e uvol(0 eumxo nudap  mnei t) 2rm(rpoo4tex ioeiaslmDem( o;() exrif iodfp  luvi;(0teurxo oodop  mivils) 2rmu  ou0oetn feiaslmDum( s;(0aetnif oatfmD luvo;s0 rtrir io4amt mnetl()s2tmxm ot4oeenmi3ild aDran p u)texrmfctatfmteluei;s setm(m3iu4ol emncsls  2rmurono4oeenii3iysfs2rl(vpn(0ae
\ No newline at end of file
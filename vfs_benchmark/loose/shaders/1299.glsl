@@ -0,0 +1 @@
+u s;s)setm(m oo1aleemfvias  2raxr ;t1apx  ociyd m2umuvo;(4aetrxo oadoa   neil()t2uo(m oydam   iet t)arua(mo;t4olxniocils a2el(msnu0tetrio3iodlmte n slt t2xr(o3ny1ope mncs t sDtmurpno1oeenmfeiydlaDuanvp t0 lxomf tadoat  ivi (  exmxr3oy4lp  mnvslt a2tmumoou1texo ociydlm ulnmon(0 lxnxr tadfpDeli s;()seurxrpoudlmtemnesl(f rraxrpoo1ope ioctad mDumums t0aetrir3to1faDe n s;s) 2xrxrpiy4lp   fvtasfsDuru poo4oeen f3tls a2rmnmpn(4alxnif3iatlpteauvo;s)setmim3iy4alt mnei s) rrau  no0alx  ocildfm2eau p;(0aeenmf iotoaDean i;s tetrxr nodomeemivi ()sruaur ou4oleomociad m rl(msnt4 exrmr3tytlmDranvilt t2trxo ou1om  mfviasf 2uaum ;o0altn f3tlsfm2ul(vs t0aeenxocta1fm rln ilt)t2xo(opno4lle  ivi sfa2tmx poo4apx iiciasls uan snu0trtomf3tydlp ran i;t) 2um(m iodllenmiesas)sDra(r ou0teeoii3tatfm ra(mo;u)altnmrciadfpDr i i t0texoxo iu1ol emnvia() 2tm( oot1oexo oeiydfa ra( s t)artoxo3iotoatrln i ( seto(o3iu1aptnmfcsltf Draxr nt4tptn oeiys m2ulums;(0areomf tytfmDeaieo;s0trxmxr3nydope lfvias)s2tax pnt0olto fctasfaDem(ms u4tetrxrctatfmDe nei;t)tetoxopoudlptn netlt) Drau ooo1apxo oeiatlm2um(mp t4trtnmo3tatlatr n s;t t2uoim nu4altn iesls arrmu pot1aexnmoctltlm2rluvs;()tlermfciytomtean ol() rxrxr oo4lmtnlncslt aDta(mp;o4tpxnii3ilslm emnmp;t)artnxf3tydlpt  i o ()s2tm(r ou1llt livtls  Dta(root4olt moeiytfm2ea( o ()aexnmo iotfmDe i i ( trxo(m3no4ame  ieil( sDtmxm ;o0ole moetadfaDran sn(4altrxr iytop eaieilt) rurim no1ap e fvi tfarumumo;u4aptn f3ias a umums;(0 renmrcia1lmDr i i s s2urxm oy4ap   ics t  Dur(  no0tpxomoctasls rmnmp (0 eeoif3totoaD  n s;(0 rtm(rpiy4oltn fetasfaDtmur no1ole if3iad a2umn snt)arxoxrcta1lpt ln i;s0t2uo(mpnu4lmenmfetat  Dumxmpot1tpxn ociytfaDra(vpnu)aexnxr iotlpteai ol(  eur(r3iu4lmee fctat) rtrurpnt4tlx  i3tldfm ul( o;u0aeenmo3oo1omDelnvi;t0srxmimpiudomenlics (fsrur(rpot0alenmfeiltls raumonu) leoifcia1fa ranvs;s)sexmim no1optemfctl( srtmxrp;u4apen iciadls emnmo u4tetrxf io1fpDe ieil( teur(opnodlme  fvta( srrau  ;t1aleniiciyt sDrm(vp;u4tlxnmociytlptrauvils0texmxrpnudom nmfesat)s2ta( ooo1altoio3iasfa eanmsnu0artomf3ty1lpD  n o;( s2to(m3iodopenmfcs ()a2tmu  oo1opx  f3tlslaDumuvp;u)aexnmr tydfpt ln s;(0trxr(o3nu1lmen nvta( srurxronu1alxn feias s umnms;u)altrmo3tatlaD  ivo t srurimpoo1omenlivi sf rta(rpou1teto f3ild a el( p t0alxrircta1oateaies s srtrxm oo4llen fcs ()sDrrur ;t1tlx  oetadlmDeanmsn(0trenir oydom  lu s;s) 2xrim oo4omtnmnvilt)aDua( p;t4apxomi3iad mDelnvp;t)aetoxr3to1fpte uvs;(0texo(rpnydlp e netlt) rtr(r no4aptnmfeiydfsDuaumo;t0tlxnir3tydopD lneo;t) euoxm3oo1amte fcslt  rum(moou4tlt mf3ias m2rl(vonu4 ltnmf ootomDeaivols  rxr(rpny1lpeemnvt t s2uaxmoot4tptnmfctasfs2rlu s;()artoxr3iatoaDeauvo t)trurxopnydaptelfcsls) rtaxronu1oexnmietls a raumonu4trtomo3iytfmtrlu il()s2xoio3oo1lpe mncsl(farumumo;t4tpeomiciat m uauvsn(0 lxrmf ta1lmtraies (0 eto(mpio1ame lietls arumxrpot4aet mo3ilsla2rmnmont4 eeoio3oodfmDrlies;s  2xmxm ou1lm nlncsltfartaur ot4aex  i3tasfm rm(vo;t4alxomfciotfaD  u i s0t2to(o iy4ole lics ( sDururpnu4apenmoetatfa rl(mpnu4trenxociadfp r neo;(0trtr(r oy4alt lnei (f 2raumpnu0oltoifctys a ra( s;() rtnxocty1lpDr ueo;s  2toxo nodapeelfvs (fartmxroou4tpen f3tatlaDulumont4aeeoio3oatlpt lueilt  etmiopiu4llt lfesat arumu  ;o4tee io3tadlm ran s (0aeenxf3iy1fa elnes s)t2tm(r ny1lm  mfei tfaDtmxmoot4tex mi3iaslsDrl(vpnu0 reoircta1fa eai sls  2tm(o3iodllte feiasfsrtmx oot0texomiciad a2eanmsnt4teenir3iatlpte uvi t0teto(o ou4altelnvtlsfaDtr( pnu4oleniocias a eauvp;t0 eeniociatfpDraivsl(0trumxr3oydalt miviat) Dum( p;o0teeomi3tat s2emu pn()areoio3oydlpDraivolt)s2tr(m oo1lmenmivsa()sDrau  ot0oeenmfeiysfs2ran s;t0 ltrmf ootlateau o ( trxmim oudop nmfeiat s2urxmpno4opt mf3iasfs um(mp;t)texnmfciy1latr u i s0s2toxr iudaltelies t)a2taxront4texn o3ilt a ranmp t4 rxriociy1lp   nvs t) 2xmxrpnu1alt lnvil()arraxrpou1tpt io3iat mDulnvp t) leoxf iotoaDeai i;t s2xo(o3ny1lpee ics (f 2taum oo1tlx iiciyt m umumpnu)tlenxrciytomD auei;t0 eumxopny1ame lfetl(faDta( pou0altoioeiytfm2ul(vp;u0tlerio3tatoaDe u s s  2tmxmpoy1apeemnetls aDuru ont0oexo ieiasfs2emuvs;t0 exoiocty1lpD livsl()t2uoirpnodoptn feils srra(rpoo0texniieiytlm2ua( o ()tetomfciytoa elivs s0tetoio3nu4altnlicilsf rurxr ot0apx io3tltlsDeanvpn(4arerir3iytfmD an ils s2tm(r3iy4lmtnlivs t aDrr(  no4aptnmociys s2emnms;()arxrmociydlmt anvo (0 2xmxrpiy1ap n fet (f rum(mp;o4oet ii3iad a rmuvonu0 ltnio ty1oaDe u o s t2toio3iodoltemfctat s2rr( o;u0tlx  oetadfsDumn s;(4altoxfciy1lmDranvs t)teur(m nu4lltnlnvi ( artrx o;u4tlxomoetysls2rln o;u4 exnir3todfpDeauvi;t) rxr(opiu1optnlnci t)s2um(r no0apxoifciydla ran o;u)teerif3ta1omDelnvil()s2urxopou4llte ivtltfsrrr( p;t4tlxnii3iatla2ua( o u4 exrmr todfpt  u o s setrim iudopte fcta( aDrmu  ;t0oex mf3ilt a2elnmsnt0 renif3totom  an o (0 rurxm3iodomenmfeiasfsDrrumooo1oleniietydls2ea(vpnt) rtrxf to1lmDelnvi;(0setrim iy1omen net t) 2trxmooo4tlxomieiatlm2eauvon(4trtnif3tytfptrlies;(0 euo(opoo1optnmnvias  rur( onu4aex  icias mDeanmon()teeomrciydfmtelnvol()sruo(r iu1alt mietat  ruru o;t1oet mociydfsDelumsn(0alxnxr ia1lmDelu i;s)seumio3oy4lpt lfet t)s2rmu oot4aeeo iciat s2ranmon(4alerio3tytlaDeln o () rtr(r3iydole mncslt) rtaxmpoo0oexoifctys s rm(vp;u0alenxoctytlm e i i;s s2xoim io1lptnmfci () 2uau pnu1tetn oeiaslm2rm(vs;u0 rtrxr tytlmtr u o;( srum(m iodameemfvsa()a2ua(mpnt0oee  o3iys sDumnmp;t) ltrmfctytlm  aneolt0 2xmir oydop  licia(faDumuronu0oeeo feiysls2um( pn() eeomfctatoptrli s;t) rur(m3nodal elivt t) Drrxr ot1tlenioetatlaDemuvont0 lerxf3oatlateai il() exoim3nu1aleemivi (  2rm(mpot1olt ii3iltfs rl(mp;(4arxomf3oodoaD au o s)t2xriopoo1lpe lfetas)arrrxr ou4tle ifciaslmDua( p;u)trtnmo3todom rlnei t) exmxr3iudlp elfciat  2rmx ono0tpe mfciyt aDelnmp;u4trtnmf tatfmt  uvs s0teto(r3no4om elfctasf Dra(rp;u0opx iociltfsDeanms;u0tetnxfcoydoaD livs ()s2tmxo nodll  mfcsls arurxmp;o0teenmoeiad mDranvs;u4 etoio iatfmtr nvil(0 2xmxrpou1lltelfvi tfa2ur( poo4open oeiyslm ra( p u) ltrxo oy1lpt anvi;() 2xr(m3ny1lle mncil()aDua(mooo0tpe if3iysfa uaumo;t0aexniocto1om  ai s;t0texo(r3oudaltnmnvt sfsDumuro;t1apeo ieiyd s ra( pnu4alerxf3iytoa eli o t)s2uo(rpnu1ale  feta()a2ur(moot1tlen f3ils a2ulu s u0teerio3oodomD ln o;t0s2umxr3nu1al  mieil(fartru p;o0aeeniictydla2umu p (4 lxrxo3iadlmt  nvsl()texoio3iodllt  feiat  2tm( p;o1oleomf3ild a rm( s;(4tlenmf3to1omt liei;s)t2uoxm nu1lmenlnvsls) 2tmum ou4ape mi3ils aDrm(mp ()teeoifcoytoa elieol()srto(r3iy1ol n fei sfs2uaum nt0aetoiictatla2um(mpnt) etnmo3tydoatr uvi ( trxoxopoydopt  fetl( s2tauront4altoioeiadfaDemnvo u0aeerxfciydfat auei s0sexm(o3nodlme  ics ()aDua(r oo1tlto i3tys sDul( s ()altrxocto1oa   i o t s2uoxopoo1lm   fetatfsDrauro;t0opt  o3tytls umnms (0aexnir3iy1optrlnvsl(  rurxo iu4ll  lnvsas  rumu p;o4tlto i3tysfa umnvp;t4tlxnmo totopDraieo;(0srxoxmpoodlltelnvsa(fs2rm(r nt1alxn fciadfaDemumpnu)trxomf ta1lat  ivs;(0tetmirpny4ope mnes (f rra(ro;t0apen i3iltfm2rlnvsnt4alxoif oa1lptraues;t0tetr(mpnu1ap  miesasf rumumo;t1alxoiociasla umuvpnu)artnir3ootoaDrlieilt sruriopiodam nmnetat) 2taxmono1alxnii3tltlmDrluvp;(4artnxf3totfatrai s;s)trxo(o3nudaptelfvtatfs2tm(m ;u1tlxomfeiat aDeau o;u)aleoxr todfaD lu s;s)trxrxrpnodoleemiesa(faDuaxro;t1aetoio3ildlsDeanms t) rxrmfcootoat auvsls0seto(r3nudope mfcsl()sDrmu pnu1alt ifetlsfmDuaumo;(4teerio3iy1lp   u s;s0tetmxmpnodllt mfeiasf 2uaxmpnu4optomieilslm rl(vp (4 renmfcoodomtr u i t trtmxr3oo1aptnmivtl() 2uaxmpou1apeomi3tld a2emuvp;t4 rxrif oadopDraivo;( srxoxo oodoltemicias)arumurpot1apen oeiat a2raumo ()aetrmrciy1oa rluvo t0srxrio3io4amtemfeil()aruau pno4olxo i3ild a2el(vs;t4aetrxf to1lp  au o t  rumir iodamt mieils aDrr(mp;u1aee  fcildlm2umnvsnt4 ltnmr3ta1opDeln s;s0seur(r iudopt livs (  2ta(rp;t0teeomo3ils m2rl( p (0aexnmf3oy1omteluvs;s)sruoxopou1lle mnvtl( s2rr(mpou4aee moetaslm eln p;u4areoifcta1fp e ies;t0 etoir io4lltnlfcsl(  Dra( oot1alxnioeiyt m2eau pnt4aexoxfctytop  lnvi;(0 rtriopnu1llt mfcs t)srta(mpot4alenmi3iadls2umnvs ()tetomf3iodfaDeluvo s seuoir3oudole mneil(fs2uau  ;t1oetnmo3tlt a ul(vo;(0teeoxo3oadfaDran ils seur(rpnu4lmee ictlt) rua(rpoo4olxnii3taslm umnvs;u)arenmf3to1lpt an o ()trxr(o3nu4lp n ics ( arrm( ont4openio3tydfmDrau s u4tltrio iy1opDrli olt) rxoxmpoodlmt mivil()arrrxrpoo0oet iiciltlm ea(vs;u0tltnio3to1lpD au sl()s2tr(opoudllt lneilt aDumurpnt4tlen i3tasfa2eluvp;() rxoxr3oodfat livsls0s2tr(m3oydll n fvta()arrrum ou1teeoifciys m2umnmon(0artnxr3oa1fpt auvs s)setrio3ou4ome  fvilt) rumx o;t1optomf3ildlm2rau p;t0tlxnxocoa1fpteai ols) etr(o io4ol  micia(fsDurumont0tetomoetys a uaumo;t) lxnirctodoa e nvslt  rxm(r no4op n ncs t)s2rrx pnu4aetniictas m2emnvs;t)arermf3todlpt lneo;s0 2uriopnu4ol nmfctas  rta(r ou0apenifciat mDua( ont0areoir oydla eluvo;s0tetmio io4al  mfvia()sDum( pnu1alxnifeiys m ul(vonu4 rtrxo tytoaDe nes;s0seum(r3oo4ap nmivs s) rtmu p;o0texomfctadfm2elu s t4tlxrxr3todopt  ieo;t0 rtr(m iu4lltemnvt t) Drr(  oo4ale ioctydfmDul(vs (0trxrxo3iotlmDe nvsls0 2urxmpnu4opt lncsltfa2taxr nu4tlt moctldlm2rluvs;u4trerir oy1omDrauvi;( s2ur(r nu4lme mfei s)srtmx o;u0olen iciatfsDuanvs;u4altnif3io1lat  uvo;t)srxm(m oy1lme mfvtls)srtrumpou0tetniictys m uln snu4 leomr3tadfat  i o ()s2uoirpoo4omeemfes s aDtaxm nu1oetnifeiytfs2emu s () ltrif tatlpt  u i;t s2trim3no1lle  net ()sDurxm no4tlxoiictatlm rln s t0tetoxf3oodop   i o;s) rurir3iu4op e nvtat srtau o;o1ope miciatla2rm(mp;(4alxrmr oydfmDr nvo ()texmimpno4lmtnlivta(f rumumooo4tetn feiaslm ua(vsnt0aetrmrcty1lpDrluvs;( srxrirpiy1lltnlfctltfsrumuroot1ale mictas a2rmn ont4 rxnif3ty1faD aiei;t)s2xmxrpiu1al emnes s) rrrur nu4alto o3iatlm2ulu o u0 rxrmo oatla r ieo;()trumim3nu4amtnlneta( s2tmx  ou1teeoifciat mDrl( o t4alxrxo oa1op rlieslt0trxrxo3ou4al nlfet t)a2urum ;t1tpx ii3tatfsDea(mp;()trtrio3tytlp e u o;t)tetrxr3iy4op nlfcsltf rtrxrpnt1aptn ieiat aDrlnmon()tetnif3iotlm e ueslt)sexo(opny1lle  netls) Dtrurp;o0aee  o3ias aDemu o (4 ltoxf3totlpD  nvo;( s2xoio3oudomtnlncs ( sDum(mpou0aleomi3tat a ulnvont0texnif oytfpDr ueil( trxoxr io4lp nmncsas a2rrurp;o0aee iieiatfs rmuvo;t0 rtrmr3tydfpt anei t0 rxrxr no4op elfes t)a2rmx poo1tlxomf3tld m uluvon(4tlenio todfptelnvil( t2umio oo4alee feta()s2tmuroot0olenmociad a rau pnt0trenxr3ty1oa elivo (0 euoxo3ny4ap  miciasf Drmx oot0olx mfcilsfs rmump t)tlxoxrcoytlaD aueilt s2tr(r iodaptnmivtl(fa2taxmono0tptoio3tldlaDemnvo u4trenmoctytlaD  i s t) rxoio oo1oleelneta()arta(  oo4apxomfetat mDuluvo (4aeerxfcta1om r i s;t t2tm(r oo4al nlnvt ()sDur(rpou4olxomoctlt s2rlnvsnt0tleoifciadfa   u i;t0 2uoir oudap n iesasf rtmu p;t0alxomictyslm2ul(mp u4 eermr3ia1optraues;t)s2tr(m nodll n fvt ( srrrxrp;t0olenifetltlaDrluvs;(0altomfcootom elivo;t)sexoir3io4llenmfvsatfaruax poo1aet moeiltfm rl(vs;u4tetnxfctydopDraieo;s0sexm(rpiodlpenlnvtas)arta(r no4apenioetlsls2emnmpn(0 eermf ootopDe ivo;s) 2urirpoy1am e nvsatfsDtmxr ;u0apen ietldls2uln o u0alxrmfcio1lp   ieils) exm(o3nudlltn ietltfarrr( p;t0oeeoio3ilsfs2emnvpn(4 renxr iadfat lnes;t) rumxm oo1lpe mnvtl()s2tmurpoo1ape iictyd aDemu p;(4alxrmr3oadfaD  i s;t0sruo(o3nodlm nlncsl(fs2umxrp;o1tpt mfeildls uln p;t4aetrmr oodfmt livolt)srtrir nu4al emivsltf 2tr( o;o0apxnmf3tysfa eanvo;(4 lermf3oo1fptean o;t)trum(m nu4lm emivt (faDur(rpoo0aeenifcilsfa umu p;t) rtrmo iy1fmDe uesl()srxmio3io4lpeelivt tf rtauro;o0texn iciadfs2emnmsnt4tltnmocoodfmD  ivol(0 exrxmpno1ll n feia(  rrmxr nt1tpxoiieiatlm ulnmpnt)trtomo3ta1lmDrluei () 2xmirpoy1ol   fct s s2urur ou1oetoii3iytfs2umumo u) rtoifctodoatraivi;s)trxmio3io4ol elietat)srurxro;o4aexoifetad mDua( o u4alxrir iotfp rlneo (0 rxmxm3no4lmen ieiat)aDumx  no0apxnmfeild m ulums u0texrxr to1oatrln o;t)t2umiopoydlltemicta( aDraxroot0tlto ieilsla rm(mo;t4tetnif3todlp e n i;() 2uoxr io4omenmfet tf 2tm(r no1oeenio3ild s rm(vo;u) rtoif iatlm e n sls)teuo(o3ny1ape miviltfsrua(mp;u0oltnmieilsfs2ea(vp;(4 lxoifcoydlp  anei (0t2xmxm nu4lm n ncil( srtm( o;t1oexoif3tlsls el(vo;t) rtoxr3ootla rauvi s s2xrxm3oy4lpenliet tf 2umu  oo1oetn o3iytla2rmumonu)arxnxrcoytop   u s s)seto(o nydolt  ivi s aDtr(m ;u4alto icils mDrmnmsnu4 leoxr iy1fmte n o t texrxrpnu4altemneias) 2trxm nt1oetomf3tlt m2el(vo;u4tlxomo tydopD ai o ()t2to(rpnydal  lfvta( artm( p;t0aex  f3tyt sDuauvsn()trxnmf3tadfmtrai s s t2umxr3iydlmtnmfetas a2ra( poo4altniietydfm2rmnvs;(4aetrxr oydlaDr nvi t) ruo(r oo1opee ivtls  rumx  ou1aet  ociyt a2ulumo () exoifcoadlmD au ils0s2xmimpio1opt  fesls) rrmxmpou4alx miciydfm ea(monu4aeerircto1opD ln ols0 etmxr iydlltn fvt tfsruaxm ;t4opx ioeias a2umnmo;u4 ltnmf3oo1fpDran s (0s2xm(opno4lle  icsa() 2rmum no1ape mo3tad s rlnmpnu4artrirciydfmte nvi ()setmirpiy4lmte fetasf rra(mpoo0tpx iociat a ean o t4trxnif3oy1fa  lieslt)seur(m3iy4ap eliciat)aDra(m ot0oltn oetad aDumump (0 etoio tatomD aues;s s2xoxo nu4apt lfesa( a2rru poo4texniietld sDrmums u0 leriociodom eau o;( tetoxm3nodalt lncs s)a2raxm ;o1aex iiciydfmDel( p (4alxoxo ootfa e uvo;s0 ruo(m3no4lmt mictltf Drrurpou4teeo ociydfs2rmnmsn(0aetrioctadom rauei;s0seur(m3iydolte neils)srtmxr ot4opxnioetlsfs2uln o t4arxrio oo1lpDr ivo s  eto(m3oo4ap emnvi (faDtax oou4apt io3tasla el(mp u0altnxf3oo1oa rau s ( s2xoim3oy1lpenlfcta() rurumonu0opt ifeiydls2rl(vp (0 renxrcoy1laD  n o s0s2tm(opiy4apt liet s arurxro;u0tptomieiadls2rl( sn()tleoif3oa1oat lu o;s0s2tmxmpny1ame mnvi (fsrtmxr ot4tpto icild sDraumo t) rxnxr iydop   i i t0t2xm(r oodlle  ivs t  2tm(  oo1tpeoifetlt s2rmnmpn(0 rxoio tydop rluvo;t trtmimpnodomenmneias a2ururonu1oexn octlt s2eau o;t0tleomf iytomDraueo;(  euoirpoodaptnmncsa(faDururono1tetnmf3ilsfmDrmnvpn(4aexoir ia1lp e i s;t) exmxrpnu1ole lnctat)s2ra(mpot4tlto ietas aDua(ms;(4trxoxf iytlateaueo;s sruoirpoy4ome  net tfsDumump;o1oeto feiydfsDuau s u0tleomrctadfmtr n o;s)s2toxo3iudomenmfei (  Dtrump;o4tptoif3tas m uauvsnu4altoifcoatfpD luvs (0s2uo(opio1al   icsas sruaxroou4opto ociatla ra(vsnt0aeenxr3io1op eln sl(  rtoxr3nodamt mfvtas)artmxrp;u4apeoio3iatfmDem(vs t0 etnif iatlptelnvo s0 2tmir3iu1alt lnvsls) Dumxmonu4tpeo fciytfs rlnmpnt)aeenif ta1opteaieilt0teto(o3ny4ll e ivta(fa2rax pou1altnmoctlslaDrluvo;()aetnmr to1fa rlnei ( trtr(mpio1om n ncslt)artaxmpot4texnio3iyt m2umn s;t4 rtrifcia1fp e uvols0seuo(opoo4lle lfvi t s2rax poo1opx mo3ilsla2ean s u0 ltrif iadlaDe ieo;s sexoio3oy4ol e ncsasfsrua(monu0altn o3iatlaDrmnmo;u4aetrmr3iytlatr ieils tetmxr nydlp  lnvsa( sDuaxmont0oexoif3iatfa ea(mpnu) renxf io1oa r ies;( sexm(r3ou4ole mfvilt)aDra(rpno0ape mfctldlmDum( snu) ltomfcoatoa  lueols  rxrim3oydalenlnci s  rurxmono0tpto oeiysfa ul(msnu4altrmf3iatomDr u sls0 rxo(o3iu1lpte fvil( srum(roou1ole mi3tysfaDua( p;u0 exrmf3io1omDelnes t)trtrir3ou1amt liei tfs2umurpou4apt  i3ilsfm rln pnt4aeeoif ootfaD luei;(0tetrio3ny4lpe mfct sf Drax p;t0ape  i3tlt aDum(vpnt4 lxriocoa1fp eluvo t)sruo(o iu1optn fci s) Dtau pou1tet iiciyt s2eaumo;u4 leomr oydfa e n il(0 rxr(r oydoltn ivtat)a2tr( o;u4apt  feias a rmums;u4trtnmf iy1oa eaieols)sexoxr3iu4am elncsa(fsrraumpou0aptnmociysfm umnvp;t0 rtnxrciodlatelnei t srxrim nu1al n ictat)sruaum nu1oeto iciadls rmumo u)trxnmf oydlmD anvolt)s2xrirpiu4apteliesls s2rr( ono1tpxniiciad s2elums (0tetrxocio1lpDr uesl( srumxopou4optn net t)aDrr(mpnu4alx ii3ilsfmDem( s u) lenxr tytlaD  n s;t0 etoxr iydlm e nes ( arurumo;u0tlxn i3tls s2ran pn(4artrxrcto1lm elu s s)trtoxo3oudaleelnvilsfs2ua(m ;u0oexomf3iyslsDrlnms (4alxrio3iy1omt  nvi s truo(rpou4op  mfet t)aDurxrooo0aeeomf3iasfm2emums (4arerxo3ta1optranes;s  rumxo3nydap emfcsa()sDra( o;t1aptn ociyd s2uan s;(0tltrmr iotoptrlueil()trto(r3iy1apen icil()arumx o;u0tex ioctyt mDeanvp () eenxo3iydlpD luei t0 eum(o oo1ame lici t s2urxr ou1teenmictldla ul(mp (4alxrif oydfa  an s s0 eurir ou4ol nlictas)sDrrur ot4ale mfcilsfs eln s;t4tltrmr oodfmteanvo;(0srxrxr3nodalee iesls s2rmx p;o4aetnii3tlslm2ua(mo;t)artoxfciotlmDelnvs;()setmim iydlle mnes ( srtmxmpno0olxnif3iatlm2rmuvsnt4tlermociotfp raivs () exrxr ny1omt mnctl(f Dum( o;o0alxoiietad s rluvont)artoxf3io1lateauei s)srto(o3nu1amenlieia()s2urx  oo1altnmieildlaDeau s;t4aeenir3oydfmDr ueo t0trxm(o iu1ope lnvil(f rtruro;u0olx mo3iytls2uln o (0 exrmfctytopD anvolt  eumir3iy1op nlneias  2trurp;o0aeenif3iytlmDul(mo u4 rtrmr tydfm   n s t trurxr3nodameemnvi t aDrrumpnu0alenifcias m2ean s u0 lxoif3oy1omt  u o t) etm(rpiu1lmtnlfctls sDrm(m ou4olxoif3tydla2emnmsnt)texrir3ootfp  aivslt tetrio3iy4am  mivt (fsDua( ono4oetnii3iad s2ul(mp u4tlxoio3iatlp elueo;t)srum(m3no4lmt  ivt s srumump;u0aee iictyd aDuanmp;t4 rxoircootfatrlueolt0texmirpoodol  mivta() 2ta( onu0oeeo octyd m2uaump u4 rxrirciydfm  lueol( t2xoio3iodopeelfvt t sDtr(rono4aet moeiyt a umuvo t0aeeomo3ia1la  auvi t s2xo(m3iu1ll emiciatfarrrxmp;t1ape iociaslm rmuvp;t)alxomo3to1optr i s s)setoiopiydll nlnetlt)artmxrp;o4tpeomoctyd m rmuvp (4alermr3iodopD li olt srtrxr3oo1ame lnet sfsrrrx pnt0tptnifetysfm2umu ont4texrmf3ta1fmteln i;(0t2tr(o iy1omeelnvtas s2tr(rp;u4oee ifetltfs ulnvont4 renmoctodfatraiei t teur(opoy4oltemnciat  rtru oot0tlx  ocildla2uluvp;u)teeoxfctytoatr uei s0t2toxr3oo1lm emnvtls srurum ot1tltn fciaslaDuau o u)teenxocia1oaD  i o t0t2xmxo3iudape livsa()aDuau p;u1altoifeiysla2elumonu4tlxrifcoa1lm rli ilt0trumxm ny4altnlieta()arrmxmpno4apeo f3ilt m umnmon()arxoxo3ty1oat  ieo ()teuo(o3iy4ap emieiat) rurxm ou4oexomo3iytlsDrl( snt) ltriocio1lpt ai slt srto(m oy1amee nctlsfa2urxmont4oex  ocildlm2emu snt4trerio3io1lp rlivolt0trurir ou1lmenmivt sf Drrum nu1teeomociadfa ra( s;(0aeeoxo3ia1fatrai s s0 rtmir iydlmen nvs s)a2umx oot0tltoioeiyd a rl(vs;u0altrxo3oytlpteanvo s) 2xr(o3nydllte neilsfaDuauroot1tet  f3ilsfs ra( on()trenif3oo1lp eau i s0tetmxopny1lm emnetltfsrur(mp;t1tle iociatfs2umnmon(0 renmociy1opDraies t0srto(o ny4ame lnvsas)a2tr(rp;t4olxnmo3iydfm2emnmp (0teeoio3tatla  luvi;t s2urxrpnodlpt mfviasfaDraum ot4tpxo o3ild a uanms;u4 ltnxr tatlp   nei t)s2urio oo4am  lieias) Dtaumo;o4tltnioctasla2raums;t0aetrmo to1fm   nvo;(  exrxm iydll emfvs sf Drr(r ;u4openifeiyslm2ulnmo u4aleoxo to1fp rln sls) exm(m iudopte nvia(f rrrumono4alx iiciad mDulu o (4texnxr tatfaDr i ol()srxrirpoo4llenmfvs ( arra(rpou0aex iocild m2el(vo;u4 reoif io1opteanvi s trxmxopiy1lltemneilt) rrr( ono1tpeoiieilsfsDulnvonu)alxomr3ia1fpDr ivs ( trtrirpny1lmeemietlt)s2rrxmonu4apenmf3iydls2eauvs;() ltnif3oytfptelnvolt0t2uoxr ou4lp elneia()aDua(mpnt1tptniictytlm2rau onu0aexrmf oadop e ueol(  ruoxr3nudomeemfeias aruru  nt1alx moeiydlsDemnmonu)areoirciodfmDelnes t texrirpoo1alenmncsa( arurx pnt1tet  oeiltfmDelumo;u4aeeomocty1lpte n s;( t2tm(m io1op emnesa() 2rm(mpot4tltn o3tytls rau s;t4 rtoif oy1lp e i o;t0 rxoim no1ape mfvsl(fsDrr(m nu1oetnmieils mDulnmo (4texrio3oydopte uvs;t truoxo iy1ap nliet ()srtau  ou0teto ictydla rm(vp;()aeermociatfa rlueols0seto(mpio4al nlivs ( a2ra(mp;o4opeo ocild a eaums t)tltnif3tytlateli ols)trurio iu4lpenlfcsas  ruaur nu1tpxnmociytfa2rm( o u0tetnmf iytlate ueo;s0sexr(o oodll eliesl( sDtmx oot0aexnif3tydls2emumpn(4tltrioctatoate ivi;t0srxmxm iy4lp n nvtl(fsDrr( onu1oeeniicilslsDua(vp t) ltrifciadlateauvi;t  eur(o oydolt lncsl( s2rr(m ;u4tlx miciatfa2elnmo;()altomrctytlm   ueo;( trtrxrpoydomtemfesasf rtr(m ;o4olto ociys aDelnmo;u4 rxnif3to1lpDe ivo (0t2uoxmpnu4lm   netls  rta( pou0tlt  iciyt sDemnvp;t4 ltriociodlp e nei s) rxoiopiy1lpenlfviat  ruaxm ou1oexnioctldfmDraumo (4arxnmo oo1la  liei;s)t2tm(rpoy4amt  fci tfaDuaxr ;u4alxnmf3ilt s ul( s;(0 exoxf3totfptrln sls) rumim3oydolenmfesas)sruax oot4oex  ieiadlmDemnmont4trtnxr3todla raieo;t)s2umir iodllenlfvsat sDtr( pou1oltnmieiydlmDul( snu0tlenmo3ta1lmDrauei t0trtr(r3no4ap e fetat  Drm(  ;o1olt  fciadlsDeanvp;t0trxnio3todlp  lies;t0texr(r3iodoltnlneia( a2ururono4oetnmoetld m2ul( s (4treomo ootop raneil(  eurxo3oodamt livsl( arrmum ;u1oex iocias a um(vp t4tlxrircio1laDrai il( t2tm(m nudolt mnctat) rua( pot4teenmi3iys s um(mont) exoxo3iydoatrluvo;s0 2urxr iydlm   nciatfa2ua(mo;u1opto fciadls uaumsn(4artnxo oy1lpDelnvils)seuo(o iodopeemfeta( arumumpno1aetomociltfs ranmo (0texoxocootfatrlu o s0 etr(r iudamtelics sfsDra(  ;o0tpxn o3tls m2uanmpnt0tleomocoa1lateauvsls  etoxo oo4openmfci tfa2ra( pou4openmiciad sDea(ms;u4tlenircta1lmt  ivsl()s2urir3iydomenlivtls) Dururp;u0texo octytfmDrlnmp t0 lerxr3oy1oaDrluvslt trxrxm oydop nlnvtatf rum(mpnt1tlxn f3iltla2emuvon(0trxrmrcoadlp eli il() etoxm oo4alenlfctas) 2umurpnu1tlxomoetat a2elu p;u0 eenxfcoy1lptr u i (  2uoxrpno4olee fctat  rrmxr nu1open ieiytls rl(mont0 ltoxf oytlptraueo;s texr(o iodamtnmnet tfaDurxmpno4apenmo3ildfsDuau p t4 etoiocoa1fa e uvol(0t2tmxo no1amtn netlt)srum(  no1optnmf3iytfm2eluvont4 renxfcoodfa raivs;(  rxo(r ny1am  lfcs s)a2rm(m ;t0olenio3ildfs ulumo t0 reomr3oodfp r ueolt truo(opiy4om  mfvtlt)arrmu onu4tpxo octatfa2elnmonu)tleomfciatomteli il()trurxmpiy4ll n fctl()sruru ont1tpt io3tydlm em( s;u0trtrio3ia1fa   i ilt0s2urxrpiy1aptemnvi s)sDtaur oo1oltnmieiyd s ea( s;(0artnmf3ty1omDe u s ()s2tmio3ou1omee fvta( arur(monu4oetnmociad sDua(vo ()tltriocia1opteaneo;s0 2umxm iy1lle mncilsf rrmxro;t4aexo i3tytlaDrlnmo u4arxrxr3io1fpDeln o;t0 rxrxr3iudlmenmfvsasfa2rmu p;o0olt mo3iasfs2ua(mp u0trxrif io1fmDraueo;t0srxmim3iydalenmfeta(  Dururpot4oet iietytla umumo;(0altrir tytfpD ai s;t t2xo(mpny4op eliet sf 2uaxm no0tpxnioctydfmDum( s;() lenio3oa1fpDranvi;t0 exr(opnudapen ivi () rumxr ;t4olx iociytla rlumon()tlxoio3oydlpD  ivi;(  2uoxm3iu4ol   nes (  2taxm oo1opx mocilsfa2eanvo u4 ltoircia1oaDe u o;t)texoio nu4apeemictatfsrum(m ot4aet ioetatlsDranvpnt4tltomfcoatoat  nei s0s2urxo oodalenmici (f rtaum ;o4aptn iciys aDean onu0 rtnxo oydlaDelivilt t2toirpiu4ll nmiesl(faDtr(r nu0aee moctls m2um( s;(0aeerxrciydfmteluvilt t2umxr3nu1lle  ics s  rur(rpot1ole  oeiytlm2eanvs u)arxnioctydlatrlueols0teuoxr3no4alt mnei ( sDrm(m ;t0olto fctytlm2um(monu4 exrif oytlaDran olt  rxoio nodol  miviat  2tmxr ot4opxoii3iasfa2eanmp;t0 etomr iytlp  auvo t) 2xo(r3iodal elfcslt)s2urumpno4alxo fciytla eln s;t4tlxrxfcoadoa rauvslt0srtrir3oydoleemncta( sDrmx o;o0aexo i3iad mDuauvp;u4aexrxr3oydlm  lieols)s2xrio3no1lmee fet ()srrmxrpnu1ape  ieiadla rlumsnu)tlxomr3iy1fmtrlu olt0t2uoxr3no4lpt  fes ( srta(  ;o4tleniociat m2rl(ms;u4arenif iodlp  li slt) rxr(opoo4am e ivs () 2tmum ;o4aleniieilslm2um( pn(0aeerxociotlpD anvils) 2xrim3oydlpte neiasfsDtr( oou1olx mfeiysfmDrlnvs;t)trxnif3totop   ivi s0s2uoio no4alen netas  2tmuroot0oltniicildlm2rau p;u4teeoxf3oadlmtran o;s) eum(r oo4altnlnei sf Duaurpot4apxnioeiyt m2ra(vo;t) lxrxrctytop r u o;( seurxr nu1openlnvsat) rtrx  ;u4altnmfciadlm2eln o;t0tetrmfcootlaDeluvolt0s2tmxo3iy1ll e fcils  2ua( pot1tetomi3ild a um( o;u4tltnmf oa1lpDraivol( t2uriopnu4op nlfeias) rurxro;u4tet  octyt m rln o u4 eeoif oatoaD livslt0 rtrxm ou4ll   iet tfa2ua(ro;t1ole micias m uan sn()tlxnmfcootoaDeanvi t)texo(mpoo4om  mfvtltfaDum(root1apt mociadla uan s u4trxrmfcta1faD an i;( srxoiopiodomenlnvs s)srtrxmpnt1oeenmiciat mDuluvp (4aeeomf3oatfmDr uvi;()s2to(opio1openlncils) 2tmump;u0tlt iociadfmDra( s (4aetrxo3totopDeluei ( t2um(o iodapeemnet s)a2tmx ont0opxnifctad sDumnvpnu)teenifciydfp rlu ols0t2xoir3iu1aleemicsat  rururp;o4ole  oetytla um(vo;u)aeenmocoa1opt lneil(  exrirpiu1alt lneils)artmxmonu4teen i3tldlm ra(vs u4alxomr iatopt  ivo;t) eur(r io4om nmncilt)s2ua(mp;u1tetnmicilslm2ul(vpnu4 exrmo iydfaD  ivs;s  etrxrpoo4llt  ietl() 2umumpnt4olt ioeiysla ea( o;t)aexrxoctodom r ieol(0t2xrir oydom elietltfsDtrxmpnt4olen iciat s2rlnmp;(0aexrxo3ootoatrlnei (0 eumir3iy1openlnvs s s2taxmo;u4open fcils m2rlnvsn(4arxrmf3oatlaDeluvolt)t2tm(r3oudll emfctl( aDraxmp;t4tleoio3tlsls2rmnvonu4aexoxfctodomDr ivo (0 2trirpiodap e neils  Drmum ;t1tetn feiat s rmnvsnt4 exoxrcoydfm   u i;s trxrxrpnodapeeliesls arraumoot1oetoioeias m2ul(vont0 lxoifciadomDe neil(0setrir3oo4ameemieta(f Dumu o;u1opt mieias s eanvp;()aleomocty1opDrau s;( s2umir nu1om emnci tfa2rmu  nt0open ociadlm2eau ont) rxrxo3tatla eau s;()seurxr oydop nmiet t)arta( p;o1oeto f3tadfmDrmn o (0tetrxocootlptelnvo s srtoiopoo4lmt lfesl()aDum(moot1olt io3iltfm um(mo;u4teenxo oodom eln o;t)sexr(r nu1llenmictl() Durxrooo4tpeoiicias sDeln s u)trerxo3ootfmD ln ils0 eur(mpoy1amen nei () Dururpno1oleo f3iytla uluvont) eerif3ta1fpte i i (0t2uo(r iydlmtnmfesl( a2rm( o;o1tpt  i3ils s2ranvp;u0trenmr oodfmteaueolt) 2uoxmpno1ap n nvtat sDurx pot4aex  o3iytfs2emnvonu4alxnxr3to1opD aies;()trxo(r3io4opt mfvtlsfarurxrpnu1tpt ifeiytfaDrm(vp (4artoif iodomteanei ( sexmio io1ap n nci tf Draxroou1tex mi3ildfs em( snu) rxoxf3oodlm  lu o s0 rxrxr iydome lnvta(faDraurooo1opeoiictatla eanvp t) reoxf iytlat  nvslt)srtr(o nudoltemfvtlsfsDrmx  ;u4aee mf3iydfa2rluvp t)alenifctotlm  au s;(0 2xoio3iy4op emnvta(fa2urxm no0tlt  oeiydlm umumo;u0aetomf3iodom r ivsls trtmxm nodllte ies (fs2ra(ronu0tpx iietasfm rl(vpnu)teeoifciytlm   n ils0 2umiopiu1alen ici s  2uaxro;t4tlxn ociatfm2um(ms t4aeermf oo1oa  aivs;t) rxmirpnodomt lieiltfsruaump;u1oex mo3tyd aDrl(vs t4tetrio3ty1opt ln s;s  etoxopoo4alen fvils s2raumo;u4tpen iciytls2um(mo u4arenmo3ia1op eauvo s texo(r oodlmte fvia() rtrxroou4tlxniictls m2rlu s t0arxrmo3oo1fa eanvo s  2xoxm3oydlm   neiatfa2tax pnu1oee mf3iyd s rau s;(4 exoxo todomDran s;()srurim3nu4amt  nvsas a2ta(rpnu1oex mf3iasfmDeluvo t) lxnmrcoytlmt ai i t)texo(r oo4lme mivia( srua(  no1tee ioetytfs rauvsn(4tetoxo3oadfpDe ues t s2umir3oudllt mfvsat) Drruroou0ope  oetyd s el( o t4 ltoiociy1fateau o (0t2umxr3iydopee nctlt arrmumooo0ope  fciatlm ran s;t4altrirctytfp eauvs;(0t2umiopnu4lmtn ncs s)aDur(rpou1opt ifeiyd mDeluvp (0 eerxo iydfmtrlivo;s0s2xmxr3ou4lme mieta( sDrr(m nu0tpxn fctltfa eauvo;u4 eeoxrciatoptelneolt0 etr(m ny4ameemnes t) rua(mp;u1aet ifeiat a2rmn p;t) ltrmo3oydfpt  n i ()s2xm(o io4al elivt tfs2ur(rp;u4aex mfciytfmDua( s u0tltoxr3oo1lm elueo s0 exoxrpoudoleemiet tfa2raxm ;u0aleomfctlt a2um(vo t0 etomo3tytop e ivol( t2xoxopoodlp   nvs t s2tr(roou0tlenifetat mDel( sn()tetrxrciytfaDrau i;t0s2uo(o oy4ol e nvt (fsrta(mont0tet  fetldfm2rmuvo u4tltrxf oatom e i olt0trumxr oy4ap n ncsat  ruaumoou1oeenifciyt m ulu o u)teerxrcia1lmDe u slt)texmirpoo1olte fetat sDtmxmono4aleniictydfs2ulumpnu0trtrmocoatla  livs t) 2umir3ou4opeelnvsatfsDtmuront0tle mi3iydfa ul( onu4teerxr oy1fmD  ieo s t2umxm iudaltn fetls a2rau  nt4tpe mf3ias s eanvsnu4 eeoxr3todla   i o t srxoxr no4lmtemfvs (  rrr(root4aee ii3iatfaDrm( o;u)alxnxf ta1la raivo (0s2xr(r3iu4oltnmicias)s2ua(mpou4oetomoeils a2emnvpn()alxnxo3ty1fate ueols) ruo(mpnu4omte nvsasfartmx pot4alxn ieiatls emuvsnt4 exoxf3oo1fmteli i;t) 2xm(opou1amt lncsl(faDur(moot0tee mfcils aDeaumsnu) rtoio3iadla eanvo;(0trtmxo3ou1lm  mfesl( s2uru oou0ape iiciat aDuanmo;() lxoir io1laDelu slt srxrxm3iu1altemneil()s2um(  nt4tlenmoetaslaDuanvs (4arxoxr3ootfmtraivo ( t2tr(opiodaltnlfct sfarurx pot1teeo fciatla2rmu on(0aexnxf oy1fmteluvi;()trtoim ou1optnlfvtltf rurxroou4oeen f3ils s rmu pnu0altoxf oo1fmtrauvsl( trto(o no4lmt  fciasfarururpoo1apenii3iltlm2ran ont4alxrmf3iatop   u o t0 2xrio io1apt miesas a2ta( onu0alto o3tyd a ranvo t4tetnxr ootfpDrlieo;s  exm(m iy4om  lietas) rtm(  ot0opxo oeiyd a rauvont)artrio3iodoa eaivi s)trtmxm io1lm elfvta( sDrr(monu1tpe  ieiltla2rmumo;t4alermocoodfatrlnvo;t teum(mpiydlpee ies tf Drauronu4tptnmocilsfm2um(vs;(4 ltomocto1lm elneo t s2tr(o iy4lmtelfvtl( sDrm(  nt1tpt iiciltfaDemu o;(4 ltoio oo1lpt ln s t  exoim oodopeelncsltf Draxm ;o4tee  ociasls ran s u0alxrmo3todlaDeau ilt  rtmxm3nodalte nci ()s2ua( pot4tleniocilt a eln o;(4tleoifctotlpDe ueil()srxmio3oo1am   net (farrmxrono1olt  ocildfsDem(mp;(4 renmr3tadfa eaivs t0texrxopnu4alt  nvt sfsDtr(r nu1tetoioeiatlm rmuvp;u0trxnmr3oatlmtrlneo;( trum(o3ou4amtn fes sfsDrrx onu1olxoiocilt m2eau ont4texnxrciodlat ln s ( trtoir3iydome mfcsa()sDrr(mont4oleoiociysfaDul(mp t0texrmf3oa1omD  n s;(0srtm(mpoo1optnlnesa( aDum(  ;o1alxoifeiysls2rau pn(0 leoif3io1opD lu i t srxoim3ou1openlnei sfaruaumpnt1oetniieilt sDrauvp;t0aeeoif oydoa   ieol() 2ur(rpiy1apenlfvta()a2raxmpou1tlxnmfcias m2rauvsn(0texomoctydla rluvi;( truoimpou4al  mivtls)srtmu  ou0apxo fctltfaDuln s t0teerxrcoo1om rln ols  2xmxr3ou1llt mici tf Dtm( p;o1ole iicildlaDuluvs (4 lerxfcto1lmDeai o t0 2ur(o3nydam elneta() rrmxmpnu1optnmo3iytls2emuvo;t0trtrxf3iodlmtelieolt  exrio oudope mnvtls srtr(rpoo1aex  ieiydlm2uluvo;u)tlxnmo tadfateanvslt  2to(opoo4opeelieils)a2ra(root0texnii3iadlm um(mon(4trtnxo ta1oa rli o;t t2xmxmpnydll emncils)srururoot1apt  ocilsla um(vp;u) etrir io1omDr nei;(0tetr(m ou4op  mfvtat a2trumo;t4aetoio3tysls2ulums;u0tleoxrciodopD ai il(0trtrim3io1optnmiesl() 2ua(mpno0aee  ociat s el(mo t0alenifciytlp eaivo t0seumio3oy4lptnlfes s)s2rax poo4alen iciys m2uln p;()altoiocoydlmt  i s;t srto(r ou1ap   fctas)sDrru oot4aeeomieiytla emuvp;u) ltnio3tadlatelieils  ruo(m io1om   fcs s  2ra( o;o4altomi3ildla ulnmp u4treoxr tadfateaivs;(0trxo(mpio4lltnmfes ( a2taxm oo4ale mo3tltfa2eanvsnu0 reoio3oa1omD an i t) exm(r3iu1lpen icsa( sDrrxmooo4ape  fetad a umnvp;t) ltnmr3tatfaD aiei (0 exrio3iu1lmte nci sf rta(mooo0opt mf3iasfmDemn p;u4 ltrxf oo1fpD lneo;t0sexo(r oo1opt mnvs t  2urumpoo0tptnmociydlaDrl(mo t4trtnmf iotlpDeluvi t0t2xmiopou1lle mfvsa() rraxmpot1alxnmi3tydfmDumu o u) exrxr3iatfaDeluvi;s) eumimpoydol  lfei t sDra(r ;u1altniociysfm uln o (0texnxf ta1om  an i;()srxrxo ny1ap elfesa(  rurx o;o0apeoifeiatla2eanmsnu0tltnxo3iodlmtrlieo s t2trim oodlpeemfeiatfa2um( p;t1tlt  ictldlaDulnvpnu0tetoio tatoa e ivs;t) rur(r iy1apte nvtl(fs2ururoou0alx mfeiysla2rln p;u) rxrir iytoaDe neolt s2xm(opou1omt  ietl(f rra(m no4opto ietatfsDeaumo ()arerifcootla e uvolt)teum(m oudaltnmivslt srtau  ot4aptnmfeias sDemuvo;()artnif oydoaDelnvo;(0 2uo(m3ou1ame lietl() Dumum ot4tpe  iciltfm2el(vo;t)aeenxf oatlat auvol(0 2tm(r nodalt lietat s2urxronu4aeen oeildlmDeln pnu4 rtomrcty1optrauvs;s) eum(m3nu1omenlicsls)sDtrx  ;t0opto octasfs ea( pn(4trenmociadlpte iesl( sexm(opoy4ol  miesltfs2trur nt1oleo o3iat aDua(mp;t0aetrxo iydlmDeln slt)trtr(r3nu4am n ies s) ruaxmo;o4alxo i3tltls uan snt4tetrif to1fmDrlnvo s)trxoxr iu1altn iciltfsrra(r ot1opt  oeiydlmDuau s;t4alxrxf tatfaD  nvo;t srtmxrpoy1om  lfctls arrmx ono0ale iocilt s2ul(vpn(4 ltrxfctydfpDrlies t srtoxm iodlme  ivi t)aDta(  ot0tpxo icils m2eaumo u) rtoxocoo1op   uvi;t)sruo(o io1oltnmnei (faDurx  ou0altoifeilslsDel(msnt4artnxfcootlatrln s s srtoxm nodope lics sfaDra(m no1aet moctys a em(vp t4 leomo3tatomD  nvo;t0 rto(r3no1ll elfcil() rtaxmpnu4olxo ieild m2eluvpnt0alxrmf3tadomDeanvi t0 euoio iudape  nvt s)srrrxmp;o4alx  ocildlm2eau s () renir3oytlmDr u s t0 2toimpio4lleemicslt a2rax  ;t0aexomoetlslmDeanms t0arxoifctatom eln o;s0srtmio oo4oleemici t)srur(mp;u0aleomoeiatfsDea(mo;t0 rxnxf3iodom   ivi t)teuoxo oo1am  mnvia(  ruru  ou4aexomoeiasfm ra(vs (0tetoxrctatomtrluvs t s2uo(rpiudap emieslt) rrrxm oo0tptomieiys aDuan s;(0artomrcty1fp  aies ()setrxr no4altnmies t s2tru ont1opt io3iadlm2rm( o t0teermf3oa1latr iei () ruoir3nu4oltelics ( srua(ront1tlt  oetld m emums t)teeomrctotomDr uvs t  ruo(m3no4lleelncsat)a2urumoou1apxnifetlt mDulnmsnu)aetnxo oo1la  aneo s0 rtriopnydom nlncias) ruaxrono4tptnmocilsla2ra( snu) reomocoa1omDrlu i s  ruoxr3ou4al nlnvtlsfsrrrurpno4tpt  ictydlm eanmp u0texrmr tytlpt aues;s)s2toxo iu4opee nei (  rtax p;u4teen oetlt a2eanvonu4 exrif3tytfm  lies;(0 etmir ou1om   ieils) Dta(  nt0tee ioetatls2uan snt4tetomf3iy1oat  n o t)t2toxm iodop n fvt s  Dtrurpnt4apxn fciysls2eanvp;t0artoxo oydlatelivs (0setrxrpio1altnlfvsas)a2rmur nu0apto oeilsfaDea(ms;(4 lxnmf ootoat aivs ()trxoim iydlptnlivi sf ruau oot0aetomietldlaDrmumo t0arxrmocoadlpDelueo () rum(mpny1ap n ivil( a2tmxr nu4tpx mo3ilsfm2emn s t4 rtrxf3iadla e ieo;(0trxrxopnydlm emnei () 2urxmp;t0ape mfctas a rlu o (4aexnxo tatlmt  ies s)s2tmxr nodome mict t  2truroot4alenmoeiyd s2ranvo;u4trxnio3ty1oaDr u olt setm(o3oodal  lfeiasfaDrm(ro;o0ape ifetad aDua(vs u4 exnmrciydfaDe nes s trumirpoydalt mfct ()artr(rp;o4olto oeildla ulnvp;t4altnmrcto1fm e ivilt0 eto(r3nodalen ivil(f Dtrxro;u0aex ifciatfaDra(vo;(0 lerirciydlm  anvs s  eto(m oo4om eliei s)s2umur ou1aptomf3iys s ea( p;()teerifcootopD lnvils)s2tr(r ou1lle  netat a2rmurpoo1aee iieiltfsDra(vo;t4 exoir todfp rai slt0srtoxmpno1om   ncsl(f 2rrx onu4aee mociltfsDua(vp;t0 lenio3oo1omteai o;t)tetr(r3oydomee ivia()aDum(rpnt0apen oeiatfm uln s u)treoxrciotomDran i;s tetoxmpio1oleelici (farua(m oo0olx ii3tasls rauvo;u)aeerioctytoatelu o;(  eur(mpnodalte fvi () Dtrx ont1apeo i3ild a2uluvo t0 rtrmo3oydopD  uei;() rxrim3no4ol nlivtlsfs2uaxrp;o0tlx  fcildlaDeluvp (0arxrif iotoaD lnvslt0trxmxr iu4ll nmnei ()srrr(m no4olx moetys m2umuvs u0aetrxr3ia1oaD li s s)setrio3iudlmee fes ( sDrr(ronu1alt mieiat s2rmu s u4 rxrxr3oatfp r ueo;t) etoim3iu4altnlivi t)a2ta(  ;u0tltomfetls sDemums;(0aexrxr3iodoaDr uvs t)tetr(rpiy1lm  lfvsat sDtrxm ;o4aeto icildfm uaumo u0aeeoxr3iatla eaueslt)tetm(opoudoptemfvilt  Dumu  ot0tlto o3ilt aDelnvs;()tltoxr3oatlp  lnvolt)s2triopiodal nmfesls) 2tmxrooo4aleo ietadfsDrmnvs;t4arxoifctydomtelivo ( trtmxopnu4llenmfcs t srra(moot4tpx ifctatls umnvs u0artnif oy1omteai ol(0s2ur(m3ny1omeemfeias)sDua(ront0olenmictytfaDelnms () exoifciotlaD an il(0 2umirpiu4aleemiviasfsDtr(ro;t0tle  ieiytfsDem( pnu4texnxf3iydop eaies (  euo(r io4lp emnci sfa2ur(mont0tpe  ocilt m rau s ()tlxoxr oy1om elueol( seto(m3nu4amtemnvia()aDta(r nu1oeenmfeildlaDum( snt)altoif3totfm  aivo;( texmxrpny4llen fei s) rtr(rpot1olto oeias a el(ms;u4arxnmrciadfpDelnes;s s2tm(o3io4al e ncs s) 2rmxronu4opx  ietaslm2eluvsnt4trtrxo iadlmtr n i s)srum(mpou1omeelfvi tf rrrurp;o0altoif3ilt s umnvp (4teeoioctodom e uvs;()texm(rpnydom  licsl( aDraxm nu0olto i3iat sDelumpnu0teenxfcia1optraneslt0s2umxrpoydol  mnvtlt) 2ra(m no1ole if3iadfmDumnms (0tltnirciotoa  lu s ( teurirpny1ol   fvtas srrrxrpot0tpt ifeiydla2eluvpnu)arxnxf3tydlp rluei s)trurxo iy1openlfeslt)aDrrxm nt0tpt mfcias a2emums (4 eeoif3oadoaD  ivs;()sexo(m oudop emfeils srtr(r ;o4altoiictysla2umums (0 etoiocty1fm elueslt0srurim io4ome  nvtltf 2um(r ;u4apenmfcild m rl(mpn(0 rtomr3oatoaDrln o s)srxrxr oodopeemnct s)arrmu p;t4aex mi3iyt a2umn snt4arxrio to1laDelivs;t0 eto(opny1ol elfcils)sDraxm ou1tle if3ilslm2umuvs ()trtrioctydlp   ies;(  2umxo3oydol n nvsltfsDtr( o;u1aeen ictatfs2elnvp t) lenxocty1fa   iei (0 rtmxmpoo4olt licslt) ruaur ou1alx mieiasfm el(ms;u)aexoxrcio1laDrlnesls0teurim3oudole lnctl(f rtr( ooo4alxomfeils m2ea(vs u)tetrxo3tadfp eauei;t  exmxm io4amenmfvsltfsrraxm ot4aptomoeiadls umn o;u4altnxo oydoa ranei;s)truoir oo4omt liesa( a2tr( p;o4tptniieilt m2ra(msnt0texoxo3to1fpDeai ilt srurxopiydal elfetltfartrxrono1alxo fetatlm ran p;t)tltnxo3oa1lpDe i ol()seto(mpoy1ame livil(f 2uau ooo1oetnmo3ilt sDemu s;() ltoxr3oatfa rln s;t t2uo(m3iy1amte fvi () 2tr( pno0tleo ocilsls ulnvs;t0aeeoiocto1opDr i ols0t2uoxo3ou1llt mnesat sDumu oot1tet mictltfaDemums;t0texrxr oodlm e iesl( tetr(o3oodllt  ics tf Drmxr oo1tlx ifeilt sDelumo (4 rtrio oy1fmDr ivolt0 exrim ou4lpt  ieiat)srraxro;u1tex ifeiltfaDrlnvs;(0trxnmfcta1fmt aneol(  ruoio3nu1ll e fcsat)a2rmxm ot4apt iocildla2ranmo;t4teenxfctatom r ueols)sexmim3iydam n nvia()arrm(rp;o1tetoioetltlm2elumo (4tlerxfciadomDeluvo;t0trur(o3ny1llenlfeil( sDra( p;o4tltnmo3tltlmDea(mpnt0 rxniocoydopDelnes t)teurir oo1llte fci (faDtmxmonu0tpx  oeild s2umuvonu4trtrmo3iydlm  anes;t0 rtrir3oo1lmeemfvsat)a2ur( p;t0aee  fciasfs eanvsnt0 exomf ootoptelueo;()seuoir3io1opeelncias) Drm( poo4olt ioeiltlm ulnvs () ltnifciatopD luvi;( seuoimpno4alee ivslsf rurxmono0alt ii3iydls uanmp;(4tltrxf3todlpDrai o;t srxmxm nu1om elfei t arumxmpnu1tlt micildls2ulu p;(0arenmf3oatlptr u s t t2urxo iydop n fctl( aDrrx ont4alxnifciys aDeauvs;u0 rxoir iotomtr i o;t) etriopnu1optelivi s)aDumxr ;o0aex mfetydfa emn p (4texrxr3iatlp r uvo t0srtrxrpiu1oltemfvias  Dtaxmp;t1apxn ocilsfaDumums ()arermo3tytfa   ivo t texm(o3nydom emfesasfsDrrxmpoo0tlxnmfctatfs2ulu p t)aexnxr3oy1omte nvols setmim3iy1optemnctas artm( o;u0tleomieiytfs2el(ms;t4arenmr oatfmDrlnes s) 2uoxo iy1om emicsls  Drrxro;u1optoif3iad s rm( s;(0trtnmr3tytopDeai o;t0tetm(rpnu1ll   fctat  2urx  oo4apx io3iasfm umn snt) ltrxfctodfmDrluvols truo(m ou4omenliet s) rrax o;o1aleo f3iltlsDulu o;u0 eeoiociatfm eln i t trtmir nu4lpt lfvsa(f Dtm( o;o4tpxomieilsfsDean s;()trtrxrcty1fpte i s;t0srtoxr oo4opeelfvsls  rurx p;o4tetnioeiyslsDumnvo u0 exoiocoatlmDr ies;t0 2toiopny4lmtnmivsl(fartax pot4tpto octatlsDemu o;()arxrxo oa1oat an i s)s2uoio oy1lp   fci ( s2ta(r ou0aexnmo3iasfs ulnmp t0arxrxoctadomt  nvsls)t2xm(o nodome liei ()sDrax ont0aee  ieias mDeln s t)aexnif3iy1la rlnei;t srurim3no4omeemnesatfsDtmu pou4apt mf3tadfsDeanmo;(4 rtrmf oodfp e ies;t0t2to(m3nudom nmfctas) 2urx  nu0opeo octydfs2eau s t0tlxomo iatop rlnei s  rxmimpno4ap  lnctlsfsrtr(moou0ope mfciatfmDumuvo;t)aexoir iadfa ean olt)t2xo(o oy1ol nmfciasfaDtrump;t0ole  iciydlmDel(mp;t0 rermr oydfmDraues;(0 2trxm3iy1lme mfvs ()aDraxr ot0alxnmfeildlm ean snu)tltrxr3io1lptrai o;(0 euoxopio4aleemfvtls a2taumpoo4apen oeild a2uau o (0 rerxr ta1opDrlu i;( setm(r ou4lmt mfet s) rrru onu0ale  f3iatlaDemnvp;() exnmo3tytlpDr n s;()srxrxr iodlm nmnvtas s2tr( ono1opeomi3ias mDrauvs u0aexomo to1fatr ivs;s s2uo(o ny1olenmnesa(f 2rmxmp;o4teeo ieiadlsDra(mp ()areomo3totlm elnei s0sexrimpiu4am nmics t srrmxmp;o0tee mf3tadlm ua( o;t0 etoiocoadfp rlnvs s teumxr3ou1opee ict s s2raur no4tpx mieils sDrluvs;t4artomr tydoaDeau o (  exm(o nydom  lfesls)arur(mo;u0aeto fetasla ranms;u0tltoircoytfmteluvs;( srur(r3nodam   icta()a2raump;u4olt mocias s rl(vpn() rxrxo3tadlptr nvo s)setoxo nodaptn ivias  Dtmurpnt4tlxnmociysla emump () exoio3tytfmtrlues;s trum(r iy4lm elictl(fsrrauroot0tet iocild m rluvo;t)tltrmr3oy1fat  neo t0srtoxr3no4oltnmfei t) Dra( ont0aet mfetyslmDrlnmp;t)aetnxfctatop eai o ( srtriopno1lme  fvils aDrr( ono0ole miciasfs2rmuvsn() rxnxocio1fa elnei ()t2uoxr oy1omt mnetatfaDtaumo;o4tpe  ictldla ea(vsnu4 rxoxr ootlaDrauvs;s srxm(m iydoptnmiei (fa2umxmont4texoioctat a elnmp u) reomr iadfmD  n ilt) eurir iudlp   fcsas  2rm(r nt4opt ii3iydfa ra( s;t)trtnxr ia1fpDeanei s seuoxrpnydlpeemivslt) 2ta(m ;o0tlt mieiyd aDrln sn(0altrxrcoa1fmDrlnesls)teuoxo nodal nlfvsasf 2tmumoou1tetnmi3tatlmDumuvsnt4tlxoxr oadlaD  n s;(  2tmxm nodlpenmnci sfaDtrurpot0ale ii3tltfsDeau p t4trerxr3iotla   ivol()s2tm(rpiy4aptn fcs (fa2um(r ot0aex  fctlsla2ra(vp (4aexnifcio1omte i s;s0 rtm(r nydomenmfviltfa2tm(ront0tetnmfeiltfs2uaums (4tleoxrcoatop eaiei;s s2xr(rpoudale mfvtls artrurono0texo f3tldfaDumnmp;(4aexrif3iadoaD livil( s2umxr oodapen fvtlt srtax ooo4tlx  iciad sDra( ont0aexnif oytfpDrlnvols)s2tr(opnu4am nlncta( s2tru p;t4teeo oeiltfm ulumo;(4 rtnmo3oydomt ln s (0 eumirpoy4al  lnet sf Dtrxmpou0tex if3iadla2ul(mo u4aeenir oa1op  lueolt) 2uoim iy1ole mfvtls srraxrpoo4alto oetasfm2rmnvo;()tlxnxf tydlpD anvi;s  eumiopoudame  ivi ( s2rmx ooo0aeto icilt mDuluvp t4tlenirctotlmDrauvo;(  exm(o iydamtnlivi s)srrmur ;u1tltn feils sDrl(vo;u0 rxoxrctydlp rlivi;(  rxmirpoo4lp  lnvilt srurxmpot4tpenioeiasls2em(vs;u0aeerxr oo1laDeai s;s) 2xr(opoo1optemfeia()srta(r ou0olx mf3iyd s rauvpn(0tlxoxr3totlmt ai i t)sruoir nodamtnmietasfsrrr(root4tlx  fetltlaDelump;u0artrxr iydoa rau o;s  2xmio iy1alt  neias srtaumpnt4tle iociydfm2uan s (0teenmf3iydfat ln sls0 2to(m3iudoleemfvilt)aDum(r oo1oltnmiciasfa uan o t4altrmr3iadfm  au ol( setmiopiu1ap  livs t  2tmur ou0tet mfeiadfm2raump (0trtnxr oydomtrlivil()s2xm(r oudom   netat) rtaxront0altn ociys a2uan o;u0 rxnirciodla elnei ( tetoimpno4ale  fvtls) 2rmxm oo0texnifctatlaDemn o;(0alxnxfcto1omte ivolt0 exmxm io1amt  fetl() 2um(  ou1alxnmiciltfmDuauvp;t) exoif iadfa r u s () exoxr3nu1oltemfct tf rrm(root1tlx  fciltfm ean s ()trxrio todfat lnei;( s2xmim3oodomee fvtltf 2umxmo;t4apeo i3tad sDuauvo t0 exrxocoydlatrluesls)srtrir nudoltn ieta(f 2umu  ;t1apx iiciad aDrln o;t0alxnir iytfateauvi;t sexrimpiudaptn neils)srumx pou1aexomo3tasfm uluvp;u0 lermo3tydomt ln slt0 etoim3nudll   ietl()aDrr(roou1tpeomiciyd a2el(vs;u)trxoxrcoadla   nvs s0t2xm(m3nu4olt lfei (fa2ur(root0opxn iciyt a2umump u) etomociotlp r uvo s  rxrimpiu4lp elfct sfaDraur ;t4aex  fetatfm eln s t0 eenir3tydfpD auvo s t2xoxr3nudalt mfetls arrrxr no4alxoii3iad mDelumon()alxrxf3oadoa eauei;s)seuoio iu4lmee fciat  Dtrumonu1tltnif3iyt sDuanvonu)aexoxr iadfm e uvo;( t2to(r3oy4lp   ncias s2tau o;t1opt ifcilsfm rluvs;u0tlenxo3oodomD li ils) ruoxr3iy1omeemnvsl(faruaumoot1aleo fctldls2uan s u4 rtoxo oadlp e nvi s0tetrxm3ou4am   iet t) Dtmxrono4oleo ociadfaDulnvsnt0teeomf3to1laDe ivs;(  etoxopoy1opt mivilsfarumur ou4tlx  fciasfm emnvp t) leoxr3totfaD au s;s0 2umir3oo4lptemnctl(f rtru  ;t1tpxomi3tlsls ean pnt) lenmfcoo1fa ran ilt  eurim io4lpe mfesatfsrur(rpno4oee  i3iysla2rln o u0alerxfctydopDrli s ()t2tmxr nodlltnmivil( aDum(r ;u0oetniietatfaDemu pnt0trenxf ta1lm eln o;s sruoimpno4ll nmfesa(faDumurpoo1tpt io3tat s2umnms;t4aexoxocoodfpDelu ilt)t2tmiopnu1aleemnes sfarumu  nu0oltn ieiltla ua(msn(0trenio ia1fmtraiei;s) etrxo iy1lltnmncilt  Dtmur oo0tlxn i3iytls elumo u) eeoiocoytfaDraivs;s0t2xrxo oodoltelivslt)arrr(m oo4oleo ictad s2umu o u) renir ty1fpteai i;s0srxrxmpny4op n nes sfs2rrxrpno4aptn oeiydlmDrmnmpnt4texoxfcty1fpD  nesls)srxoxmpoudlm  mfvilt)arurxmonu1oeeomf3iatlmDumn o u4artrmr3ia1lmtr uvs;t s2xrir iu4al elfvi tfa2rr(r nt4tpxomiciadfm uaumo;t4 etnmo todfptr u ilt) rxoimpnudoltn ict (  rtmx  nt4ole  feiatfm ua(monu0texrxr oa1fa rln s;(0s2tr(rpoo4al elncta(fsDur( ont0opxn f3iysfmDul(ms u0 eenmr3tadla  aivo s0truoim3io4ale miesa(  rtmurp;o0tlxomiciytfs raumo u4 lxrio3oo1om rlues t  eum(r nudaptnlietat)a2rm(ront0aeenii3iytfm um( p;(4trxoxf3to1omDrauvo t  2xo(o io1omt lneta(  Drrxmont4oeeniieiltfs2ra(mo t)aeeomf iy1fmt lu olt) rxm(opou1optelnvs s sDuaxm nt4tlxnio3iytla2umumont)aetrxr tydfmD lueo;s seuoio3iu4lp nlnvsl(faDtr(mono0tet ioeiasla2elu o ()alxnif3iotfpteanesl( setr(mpnodop e fvs sfs2ra(  ou4alxnmf3ilt a2ulu p;(4aexoxo iotlptrlies s trur(opny1lltemfcta()sDtm(mpot4tex iiciytls em(vpn()aeerircty1fpDr i i;t) rxoxrpoydal emfviatf rururo;t4aeeomo3iyt a2um(mpnu)aetnmo3oytop r uvs;s t2xrxmpiu4aptn fct ( aDra(  no1ope iictls a eaumsn(4arxoxr oadla eaues t) 2trim3iu1am nlietl(f Dra( oou1oex  o3iysla2ua(von(0 rtoif3oa1lptrln sl()srtrio iudap e fct t)aDumxrpnu4olen iciltlmDul(ms;(4 lxrxr3totfaD li ils trtoxm3oydlle mfvs sfsruauroot4tltnmieiltfm2emnms;t4treoir3iodfmD lnesls0trxr(m no1lm  lncsl() 2ta( pot4aetn o3iadfmDemuvo;u4alxrio3iytlp ran i;(0 exrxmpou4lpe  fvt sfsrrm(moou4apeo iciyt mDulnmsnt) rxomr3iodfm eauvol()trto(o nudaleelfei ( artrxrono4apt  ieils mDra( pnt)trtomf3tytlm ranesls)s2toimpnodom nmfctlsf rrr(rp;t0oet moeiasfmDrl(vs u0artoxo3to1lpD  i ils)t2xmxmpio1oltnlneta(faDurumpou0tpt  octasfmDem(vonu0 lenmrcio1lmD  uvsl( sexo(m oo4alt  fvtlt)sruau  no1apx moctyt a2um(vp;t0tlxrmfctydfptrli i;s0 2xmxopiu1apen ncilsf rtrump;u4alxo ociyslsDemnmpn(0trenxociytlaD auvsl(0s2umir ou1lmtemneils  Draxm ou1ale iieiatlmDean pnt4 lenirctodlat luvo;t)sexmio3oo1llt  neta() rumu ont4texoiocild s2raumpnt4alxomf3iodlmDrluvslt tetriopou4aleelieil() Dururp;u1oetn oeiytls2umnvpn() lenio3oodlmt aueo;t tetm(r ou4am elnctls  2tm(mpno4alenmocilsfaDrm(ms u)aexoxrcootla rlnvo t) 2xriopnu4oltemietl(f Dua(rooo0olxnmo3ilsls eanvp;(0artriociotfm   u i s)srxoxopoy4amt mfcils  rra( o;u4olx iieiltlmDrmnmo;t0 etrxr3oa1opteli s;s sexoiopoy1olte nviltfs2tm(monu1tptomi3iytls2um( pn(0artnmo3ia1fm rluvols)s2xoim3nudaltnmnvia(  Dra(r ot0aeen ieiyt a uanmo;()aleriocoodlp rai o ( tetoimpoodap e ncsls s2rm(rono1tlen f3ilt aDua( s;u4tltrif oytlpDr nvsl(  2tmxo nu4omeemivi s a2rr(mpot0apenmoctas a2rlu s;t0 rxomo3oatfmDrln s;t0 euo(m3oy4open fvs (f Dtr(mooo0alxoiiciysla ul( p (4 eeomr3iodfp rli o;(0s2xrim3ny1aleemnvt t artm(mpou4tee  i3iydlm2elnmp;u0trenif3iydopDr ivi;s0 rtoxm3io1op   neia(  2rrumpnt0alx  ieild m2rl( o () eenxf3iy1fmtranes t0s2tr(opoudomeemfvt t)sDtau pnu0apeoiieiat sDrau sn(0treoxf3oo1lmteau olt0 rtmim3oodlp  lneta(fartrxr ;t0tpxomietltlaDuluvpn(0artoircoy1lp eaivi ( seto(opny4apt  iesa() Dtrxroot0tex  i3iatfa umnvsnt4 renxf3iodom elnei;()seur(opiu4am   ivi ( a2taumpoo4olt  fciytfm2ra(vs;(4tltrmocootfpteai i ()srxm(o3ny4lptnlfesa(f rra(  ;u0teeo o3tltfs2elnvp;(0teeoifcoatoa e neo t0t2umxo3iu4op n nvs t aDtmum no1apenmfeiytlmDranmpn()trtomr oadomtr uvo t)s2toiopiu1opt lnes s)s2tmump;u1tex mf3iadls uluvp t) eerxr iy1omD  uvsl(0teuoir3nodamt lictasfs2rmum ;u4optnmoeiaslm uanmo;(4artoxf oodla  anei (0srxoxo ou4lpt livsl(farrr(r ;o1tlxomoetatla2eanmont4aleoio iatfm r n o;s s2xrir iy4op nlnvi s)s2ra(r ot4aee moeiat s2uluvsn(0aetrmf3tytlp rluesls0srum(r3io1lptn ivta()a2rm( pnt4olt mieild s2rmn pnt4 etnxrcootfa eaivs s)srtm(mpoudlp nmfvs (fsDrauront4olt mfeilslm ean p u) etriociatfm ran i s  2to(o ou1openmnesas) Dtr(m ou4alx miciyt mDuluvs;(4tlxoxfctydoa eluvi (0t2xoiopiudam   fcs t s2uaxmont1tpe  f3iaslmDra(vs;(4arxoioctytfmtrlueol()sruoxm iy1lmen nesl( srtrurp;t1tptnmoeiysla uau pnu0trtomrciodomDeln i () 2xm(opoo4op nmiet s)sDrmum ;u0oeto ictys s elnvpnu0 renif io1fm e uei s)seurxm3ny4am nmfviltf Duax pnu0tpxnmi3iat m ul( s;t0 rerxf3tatfp elivs (  ruoxmpoodapen nvs t)aDrr(rpnt4teeomfctyt s um( on(4 lenioctytoaD  nes s trxrxo3no4lmtn ncsasf 2trur no0tpxnifeilt mDel(mpn(4altomrcoatfmD  ivols0 rxo(opiu1ll  lnctl() rrr(mo;u1tpe iociasla2em(vo (4 eerifcta1lpt  ueo;s0seur(r oudlltn ies ()sDtau pno1aee  o3iyt a2rmumpnu0 eeomr oytfat lueo s0 2xr(r no1optnmnesltfaDuaxmpou1olenmo3iadla2ranmp (0tlenmocoo1fm eaueolt0srtr(mpnu4omenmfvtls)srraumoot4alxnmi3tytfm2umuvsnu4aexnxf3io1om  luei;t) rurir3no1amt lfvtls)arrau oot4apxn fcilslsDulu o (0arermr oydomtraivo;s setrxm nydop e ietl( sDrmxmpno0tpe ifctltlsDrl(mon() ltrmoctydopD lneo;t0sruoxmpnodal  mfvslsfs2tm(rono1ape  ictysla2rlnmon(4 lxnirciatlp   ivilt0 exmxr3io1apee ivsl(fa2raxmp;t1tpenmoctas a rmu o t)trtoio3totomDr u o t0s2trimpno4amee ietl(fsrrm(moou4alx if3tad s2umnvs;(4trtoir3oydfa raivs;( srurir io1lmtn icil(f 2rm(  no4alxo o3iadfa ulu o (0tltrmf3ootopte ueo;s seur(o ny1ame lfcta(fsDraxrp;o4tltomfetad aDrluvsnu) exnxr3totfmtrlneil(0t2toimpno4lltnmivs t)sDta(r ;o0tex mo3iysfs2rm(vo u4 eerir ootfp elnes;(0 eurir no1lmee fvils)arrrxm ;o4altnmiciatfm2rm(mo t0aeeoxr3oa1fm r n olt0seum(o ou4altn fvs ()arurx pnt1apxo iciadlsDrmn o;t0altrif3iadlpDrluvilt srumxo3nu4lpen fes s)a2rmum nu1tpenmieiatls rl(mp;t4teeomrcia1oa  lieolt0seur(r3iudolt lnes t)artm(mo;o0oexomi3iytlaDuanvp u)tetnxo oatfmtr n i s srtrio3no4amt lies sfaDraum no1oleo o3tls a um(msnu0texoxo3totfptrlivols  rxrxo3io4ape mfvt tf rua( oot0ape mfeiltfm2el( sn(4 rtriociadlpDeau o;(  2uoir3iydom   nct s) rra( pnu1oltnifctlt a uluvp;(4arenmr3oodlaDeluvil(0tetr(m3nu4lmenlicsas  rur(mp;o4opto o3ias m rauvpnu4aexrmrcoodom ean sls  rumxm oy4op nmfvsltf Dtrx  no0openmfeiyt mDem(mo (0altnmf oadoa eaneils)srtoxm3ou1al emfci (  2rm(  ;t1tetomi3tadlsDel(ms u0alxoif totoatelueo (0s2xr(r3oo4lp e fvsa(  Dua( p;u0aleniicilsfmDulu o u4aetnif3ia1fpD au o t s2xriopio1lme mieia(  rtmxrp;u0alt  fetad a rluvp t)tlenmrcia1lm rlu i () 2xrxopoudl
\ No newline at end of file
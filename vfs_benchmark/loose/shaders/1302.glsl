@@ -0,0 +1 @@
+nvi s  2xrimpnu1ol emfviat) Dta(mono0altn f3ildfm2umn p t0alxnmo3tadoaDeau ils)trxmiopiy1ll n iviatfsDuax o;u1tlen icias a2eanvsnu0treomf iatfmtr nes ( trtmxmpnudam n ncils srtmur ot4tetoii3tldfa ua( snu4 etrir tydla e ivs;s)trxm(r3iy1omt  iesat) rrmumpno0tex if3iatfsDran sn(0trxoir tydfm rlies;(  rxrxm oy4olen nvtas  Drm(mono1alenmf3iysfsDrl(vo (0tlxrxrcty1omteluvolt  rxm(r3nudaltnmieslt artm(  no4tetnmociadlaDranmp;(0 ltnxf iadopD livols)s2toxrpoy1lpee ies sf 2urxmooo1alx mictlsls2ranvo;()altoiociydfa rau s;t0 2xrir3oudaptemicsa()a2uau ont4tltniicilsfm2raumsnt)trtnio iadom e ieo;t0teum(o3io4lltnlfei t)a2tr(  nu0altn ieiatla eluvp;u4 reoiocoytoa rlneol(0t2urxr3no4openmnvi ( s2tr(  ou0texnmictyd m ranvo (0trenmrciotfpDeau i;(0trtrxopny1opeemneil()artmum nt0aee  ieiyt aDemumpnt4trxomf3iodopD  ueslt trtmxo ou1ll   iet (fs2rmx pou0apeomocilsfm2em( snu4 exoiocoytopteaueo;(0 etrxm3oy1aleelnet s)sDraum no0tet if3tys m em(vp t4tlxnif3iydopt  ivo;s0 2tmimpoy1ape mivta() Drm(rpou1tlxn o3ildls rmn onu0aetriocia1fp  ln s s trum(m3iy4omtnmfeslsfsDtaxrono0tpenmoeiysfm ra(vp u4tlenif3oytopD  i s;t)s2tmxopiu4alee neslt) Drru  nu0alxn fetydlaDrl( s t)aexnxrcia1omDrlu i;()trxoxm oodopt lnesatfsrtrumont0tee  oeiasfaDrluvo;t) rxoir3oo1la rau o (0 2xo(opnodaptemnvtatfa2tmxm ;o4tptn o3iadls2eanmpnu) eeomo3ta1faDr ues;() exrxopoydapt  ivslsfarrmumpnt4tlxnmo3iysls2umnmsnu4aexnir3totfaDe ivi t) etrir no1lme liesa(  2tr(ro;t0tpxnmictydlm2rm(vp t0 lerxrctadoat liesls setr(m ny4alenlivi ()a2umxr nu4oltnifctyslm2ul( s;u)altomo oadlmteauvo ( srxmxr oo4opt mncslsf 2tauro;o4tpenifcils s rln ont)artnio oydoaD ln sls)srxoxr3nu4llte ivtasfsrrmxrpou4aet  o3iat a2rmu o t4altnifcoo1oaDr n i t texoxo oo1om emivsa()s2tr( o;u1tleo ociad a2uau pnt) rxoif3oytfaDeaivi;s  rxrxmpiydlptn icils)artmurpot4texomi3iysfs2uanmp;t) lermf iatfaD  nvo;s0s2umio oy4om emics ( sDum(root4tetn ieiadfmDrmuvp (0aeeoxo oa1fatraues s  rxoxm io4alt mnvs (faDtax  ;u4tpe if3iytlm2umn snu)alenxr3oydfm e iei () 2tr(o3io4op  mnvia( aDrm(  ou1tlxnioeiyt a2ulump t4aeerio iatla r uvilt  2xr(r oodllte fcsa(farrrx onu4oleo f3ils s2umuvp ()areoxf oodfptrluvolt0setr(r iy4ole  nvil( srrru o;t0tlenmociytlmDum( pnt0arxnmo ootlm elnes;t)s2tm(opou4llte nvt sfs2urxr nu0aeto f3iys mDrmuvs u0aexrxo oa1lm  aueolt0 2tmimpoy4lp emnvilt sDrmumpoo0tex mfetysfm2em( o;t) rerio3ootfm rai ils0texrir iy1omenlnvsa() rrr(mpou4tltn fetatfm ul(vsnu) etnxo3oatomtrli ilt  rxmxopou1lptnmneias srur(m ;o1oexo o3tltls uluvo;(0 rxrio to1fm   n i s srur(opou4llee iesl(f Dtmu o;t4olt mi3iltfaDrauvs;t) rxnio iydfp ranes s s2uo(o oy4alenlneias) 2rrxronu0ale ioeiys m2ul( p;t) ltoiocio1fmtran olt0s2xmim nudolenmfvta( sDua(mpou0aexo o3tltfm2rm(mo;u4texomo3oo1lm  auei s0sexoxrpnydopt  fvil(fsDrm(mpoo4apen o3iatlm2ea( o;u)tetomr3to1lp e n o s  exmim3nu1lm nmnetas) Drmx pot4olx  ocils m2em(vo ()aexnio io1latr ieo ()s2toxopiudapenlneiltfa2tmu p;o0oee  ieildlmDrmuvs t0texnmr3tadom elu s s) 2urxm no1omeelietls  2raxm ;t1oltnmoeiytlm eanvs;u4arxomf iytfaDeln s (0 2tm(mpny1llt  ieiat srrm(rpot4texomieiat sDulu s;t)tetnxr tytopte ivilt teurir ny1ale lnetls srtmumono1tet io3ild a rmn onu4teeomf3iydom r i s t truoxo3oy1lp eliei sfaDrmxmpnt1olt  iciat a2rlumsn(4 ltrxfctodlpD  ivi;s tetr(m iu4ale  iesas)srurxrono4tee mieiytfm2el(ms;t0aexomf3ty1omD  ieslt)tetmxr oudlltnmfvi (f Dumxro;o0tlxnmi3tad aDulumsnu4arerxo ootlaD  ivilt0trtmimpiy1ome liesatf 2ua(mpno0oet  ociltfm elumo;t0arenif3oa1om rlivo () etr(r3oy4ol nlnct s arur(m no4aeeomi3iatfmDrmuvon(4 lxrxr iydlpte nvols)tetoxo nu1amtnmfvt t artmump;t0tltomietysls rmumo;(0 rxrmociy1fa  auvil( t2xo(opou1alte ivia(fs2tmxmpnt1tptn fciydls2um(msnt)arxoif3oodopteaneilt0teumxo ou4al e fctl() 2um(r oo1opto ieild m rlumo;t4treniociy1op rlneils0seuoxrpoodlpenmics s  rrr( poo4tpt ii3iat m2ulumpnt4trtnxrciatfa rauei t0s2uriopnodlp   nctl(f 2ra(mo;u1oetomieiltfa2umumsnt0 eeoircoodlptr u il() rtmim nudolt  ncs (  Drmumpnt0altnifeiyt sDua(mont)alenir3tytlm rlnvs;s)trtrxo oodaltn ivs t arumxmp;t1tlxomo3iasfs emnmo;t)tetoxo oatlmD  uvilt0srumxmpoy4opte ieiltf Duaum nu1tex  ictytlm eau ont0 exnif ta1lm  ln s;t  rxo(r ou4lmt mivsasf rur(  ;t4tpxo feiaslaDelu p;(0 rxrirciotfmDran ils t2umirpio1lm  lfct t)arurx pot0altn iciytlmDel(mp t) etrirctotlpDean i t0tetmirpiy4amtn feslt  rurxmpnu1tlt mf3tytlmDea(msnt)trxrxr3ootlptr ies s  2ur(rpoudopteliet tfsruaxrpnu1apeomfctas m um(vo u4arenio tadfpDean i;t) 2to(r3oy4lmenlncsasfs2tmum ;o0oleo ieiytlsDuln s;u4 lerio3iytfaD livi;t) 2xoxr iu4om e ivil(  rtmumpnu1tex ioeiad aDum(vo (0trxrxr iy1latelnei;s s2xoxm nu1olenmfct s aDrrxm ou1tleo f3iltfsDrln p;t4altrmoctodlatrluvi () rxmirpiydoltn ncils srtaur ;t1aetoii3tltlm uanvs;(0areniociodoaDeaies;t texr(o oydomtnmfvsat sDua( oou4oltomf3iysla emu p (4aeeoif iytop r uvs;s trxmxr iydlpt  nvt sfarraurpnu1tetniieiys s ua( o;(0aeeniocoytfmDe uei t) rxoxm nudom emfesa() rurumo;u1oetoioctldfa2umumsnu)alxnxfctadlpte iei s)s2trxm nudlmenmici (f Dumxrp;u1alt ioeiytlsDemn p u0aeerio tydfm e neils)t2xrir3nodol  lfcs s s2uaxrpnt4alenmfciatlm2uln o;(4arenio3oo1lm  aneolt)tetmxopoy4amee nvslt srra(rp;o0altnmo3iytlm2rm(mp;t4 exrxf iodfm eaieo s0tetmxr iy1omt  ieta()sDrau o;t1oeto oetltfs rlnvp;(4texomo3oytlatr uvol( s2toxm3oo1optemfes t)a2tr(rooo4aleomfctltfs2em(mpnt0aeenxf3iadla eaieolt teurxo3nydlmtelneta() Dtmxm ;t4apt ii3tadlm rl(msnu0arxoifciadlaD lnei s  euoxopnu1lmte fvs sfsrtaumpnu4opxn ietld s2rmn p;t0arxoifcta1fm  anei;t) 2trio3iydop elivsa(f rumuro;t0optomoctyt mDrm(vs;() rtoxfcto1oatraueo s0setmiopoy1lpeemnesl()srrm(rono4oeeoif3tad m rm(vo u)tlermociadopt  ueols0s2um(m3io4am n ictatf Dtaxm nu0oeenmicildlm2uluvpnu0 reomo io1fmte uvo t0seurxm3iy1lle  fes sf Dururoou4oexniociasfa2rm(vs;u0artnxr3tadoptrli o ( teum(m no1ape micsas sDtr(r oo0ope  fciytlm2rau on()alxnxfciytlaDeanvo;() rurxmpou1llt mnctat s2urxr nt4oeen iciatfsDuanms;u)tetnmr tytfptrau ols  ruoio oo4olte fesat)srra(mpnu4optomi3iydls rl(ms;t4 lermf to1om  aneo;t tetriopoydaltn ieta(f 2urxm nu4aetoiiciasfaDem(msn()trxnmf oo1late n i;( s2tmir3nudoltnmfvs ()s2tau ooo4oexo ietldla2rmn onu0 rxoiocoy1lpDrln o s) exoxrpiy4aptnmncs s  rrr(mp;u0oee  feiyd a em(vs;t4 lerio oytfat anvi;(0 2xm(r3iy4om  mnct ()arrmu ont1tleo i3iaslm2em(vonu4altrmr3oy1fmte i i t  etmimpnu4llt  ncsa()aDua(ro;t4aex moetytla ul(vo (0tltrir3tydomtrlies s0 etoxo3iu4lm   fcta(f rurx pno4apxomieiltfa2emuvs t)arenmf tadlmDranvi s0s2xrim ou1oleelnet t artru oot0tptn octysfm emuvo;u0areoir iy1laDelues (0 2to(r3ou1lmeelfetas sDtm(ro;t1apenifetls mDemnms;t4teeomf3tatlaDrlivils0s2xmio3iodam emnvsa(  Draumpnu4aee mfcilsfs el( p;t0artriociydfpD  n i;()tetoim3no1oltnmivtlt)srtau ono4ole ii3iltlm ea(vs (4tleomf3tadoa  lieo;( trumxr oudll   ietatf 2uaump;u0tpxo f3iatla eln s u) lerxf3ty1op eluvsls0t2uriopny1am elncil( arumx oot0tpe if3iydlaDelumsnu4 rerir tadlpD lieo t)t2xrimpoo1lm  mfetat srtrxro;u4apxo o3iydlmDuauvpnu4arenxf3tatlmDeaueilt)s2urxo3no1ap e nei t aDur( o;u0teto octys a2uan s;t0 eerircoatlpteaivo;t sexoxm no1op nmiviltf 2umxm nu1opx io3iat mDrmu p;u)teeoxfcoodlpD luvs s) exo(mpio4open neias arurxrp;o1texoiieilt mDuluvp;()texoxo3oo1op elu o;( t2ur(mpiydalenmivi ()arrm(rooo1texnmfetyt mDem( s u0 lerxr iy1lpD  ueo t0trxo(o iy4lltn ieiasf rrau onu1aeenifeiytfa2eanvp (4tltrxr3oadop  livsl()t2xrxr nydom  lnet ( s2ta(r oo1olx mo3iys m2rau s t)aexnmf3tytop eaueolt0 exm(o3oodamt livsat)artru ono4tee iietyslaDraums;()arxoif3iotopDranvi t)t2toxr iy1lltnlfeta( artrurono0tlx ifciatlm2emnmont4tltrmo3tydlmD  neilt)srxrxo nodaltnliviat  2tmx o;o4olxn oeiyd sDrlnmo;u4trtrmo ta1lp   uei s trurio3oy1apt mivias)a2tax pnu1tptomi3iltfsDuanvpnt4teenmrciytlaDraivi;(0 2trxr3ou1oltemfcsa(  rur(mono1ape  feiyt a2umn s u0 rxrmo ty1fmtelnei;s0t2xrimpoodal emfetatf Dtmx p;o0texnmieiydfs2emnms;t0texrmf3oadfp e ivo ()s2toxm3oodalee fetlt)a2rr(mont0tlxo oeiltlaDuaums;(0tetrmr3oy1la r nvi;t srurxm3iudlp nmnei tfsrururp;o1tltoifciltfs2rln o u)arerirctadlpt anvs () 2tmim ny4om   ivtltfsDtm(moot0tpt  ietysfm2rluvs (0aeermf3tatla eaiesls)teuo(opoo4ame  feilsfsDrax pnu4aexo octldfs2eln s;(4altnxo io1lmtr nvi;t)tetrxrpno4lmt lfciat sDtm(r nt1oltoifcils m ea( o;(0 rtoxr totlp elivo;t teum(m3iudalt  ivtls)aDuaur ot4olxomieildlaDrl(msnt0aeenxr oadfpt  ieol()t2umimpoo4aleelnctat)s2uax o;o0ope iietldfsDrm(vs t0trenmr3totfa   u s;(0 rtm(rpnudoleelnct ()a2tax o;o4tlx mfetatfsDelu s t) eeomr3oa1oaDr neils texmxrpiu4om e ictlsf 2ua(root1alxomo3ildls2umumont4aeeoxf io1omtraneo s0srurio3iydll  mietls)aDtm(rp;t1tpeomoetltfs ea(vo;t4areomociytoa r uvs s)srum(m3oo4lpt mncias aDua(r oo0tltomieiyt s2umu pnt0aetoxo todfmDeln i;s) ruoxr iudlltelicil()a2tr(mp;o1tpenii3iysfmDua(vo;t0alerxrcia1oaD  i o s trtr(opiodapen fctas)a2taump;u4alxn o3iat s2uanvpnu4 rtrif3ootfpD luvo;s  rtoirpnodalt livilsf Dra(mpou0tee ifeiatla2umnmont0aetomociodopDean ols0trumim iy4omenmneiltf Dur(m ot1apenio3tlt mDemnmsn(0 etomf io1lat au slt  eumxopoodam n feslt aDta(m nu4ale ifcils s2umnmp (0aeeomo3io1lpDeluvs ( texoxo iodll emiet (f 2uru oot0apx  ieiadla uaumo;t0aetnxrciotfmtrlneils trtr(r3oo4al  liei (  2uaxrpoo4tlxn ieiat s2eauvon(0 etoircty1laDrlnvo;(0sexr(m nu4om e feiat arra(r ;o4oetnifeiadlm ul(vsnt)artoxf ootlat  uesls  2umiopoy4ameeliei s arururpnu0opx  oeils m rmnmon(4 eenif3ta1fm eanvsl(0 rto(o iodop n fvta( srrmur oo0apen i3ild s2rmnmo t0tetnmr3ta1lp rlivi ( trtmxo3io1apeemncs tfsruaump;u0apen f3tas m2ra(mp u4altnir to1lpD livs;s  2urxrpio4lltemfvi sf 2rrxronu0aetomfeilslaDra( o (4artnxo3iytfat  nvo t0 2xr(opiodlmtelnvslt a2umumpno4olt if3iytfa elnmont4alxnir ty1lpD ai o t  2tmio3oy4oltn nvil(fartruroot0oetn i3tydfmDel( o t0trtoxrcoodoa  ai olt)truo(opiudoptn neias  2tmum no1apx ifetlslmDum( s ()tlenxo tydlpD  iei;t  ruo(m3nu1ol e neil(  Dtau ont1tpx ii3ils aDul(mo (4 exnif3oa1om rlieo ()texmimpnydal nlnvt (  Duaumo;o1tlx ioeiadfa2rauvpnu)teeniociydfa   ivols0srxrir3iu4amt mfciat a2tmum no1tlt mocilsfs um( s ()alxniocoadop eai o ( t2xm(m3no4ap nlnct t)aDuru p;u1tpe  fetas m eauvsnt0 eenmocty1fm ean o;s0texoio3oydamte fci t  2rmxrpnu4olxn oeiydfs rl(vsnu)aleriocio1lm rlneo s)trum(r ny1ap nmfvt () Drr(ro;t4oleomi3iydfa ean p;(4aleoxf3oydlptelnvo s texmir3iy4omte fciat)s2tmum ou1aex mf3tysfa ranmsnt)aetrmr tytfmt lu o;() rxm(m3oodll n iei s aDrmxm ou1tpt mi3tyd aDul(mp;t)arenir3iytoaDelues s s2xr(mpny4omenmiei t srtm(r ;u4tpxn iciasfs eln s;t) ltrmfctotlmDe ueilt)truo(m3ou1oltnlncsls  Dum(ront1alxn iciatfmDrauvpnt) rxrmrciytfa  an i s srurxmpio4omtn fctls  Dtaump;t0tlx iiciltla rm( sn()trermr oy1oatr nvi s) etoxr3oy4lle  ieiasfsDrmump;o1tpx iociytls rl(mo u)arxoio3tadfm rlnvs ()seum(opoudoltelfei sfsDumxroou4oeeoiicilsla2emumont4areomo ia1lpDr ivs;() rtoim3io4lp emies tfaruau pnu1olt mictyd a2eaums;u0tetrmr oy1lpDrauvs;(0 etrxo3ny4olt  netas) rrmur no1alenmociytlm2ulnvp;(0 lxoxf todfa rlieol( trxmio oo1aptnmiviltfartax  ;t4tpeomieildls2rmnvp;u4trtnmo oytomD  nei;s)t2uoir iydol nlfvt t  2umu ont4texo i3iadfm em(ms;u) rxoxr ty1fa ean o;t teumir iu1amenlfctlt)srrr(mooo1opxn fetltfmDrluvs t0altoir iy1lat luvs;()seuoxm no1ap emieias a2umxm oo0olxnmieiat a um(von(4 etrifcty1om   u s s0 2um(mpnydape lnesl(farrm(m oo1opx  ociys m2elumsn(0 etnmf3oo1fptrai ils)teumxm no4apenlict () 2raurpot4aexn o3ildfs rau o t0 etrmr tatopDeaneilt)s2umxm3no4omt  ics t) Dta(ro;t4ale ioetytfsDrmnvs;()trtnio iydopDr ieols) rxmir3oo1apt  ncsa() 2umu pot4apt mi3tydlm2umnmp;u)tetoircoadopteln s (0 2uoirpiu4lptn fcilsfsrrrumpot1oleomo3ilt mDrlump;() rxnir3tydomDelieo ( seuoxo iydal nmiesl(f rumu  ;o4aex  f3tldfsDul(vp;(4 exnxf ia1lmt  neo t)truoxo3no4oltn nvsa() Dumx onu0tlxnif3tatls raumonu)alxnmfcoy1fptrlnvi;t) rumxrpnu1aleemfvsa(fs2rmxm ot4tex mi3ilt aDrlu snu)areoxf iadfp elieo s0srumxr oydolt mnviasfartrxrpou4teto fctldla uauvonu)aexomf todop r n s s)teumim iydaltnlnct t)s2tm(mo;u4opxo f3iatlm rlump ()arenmociydfa r ueol(0 2toirpnu4lptnmncs ()srua(rpoo0tle  octyd m emu o;u4 rxnxr3oatlpt  nvolt)tetm(o iu4optnlneiat  Draumpot0tetoifciad m rauvp;u)tltoir3todlpDr ivi;s)s2umim nodol   fci (f Drr( p;o0teeomfetltfsDuan o u)aexoir3iydlpDr i o s)t2uoiopio1ale mietat)a2tmu  nt4tpeo ieiadlaDra(mon(0texrxr totomtr uvs;s0trxr(o3oydlp  mfviat  2rmxmp;u0apenmfetlsls2rlu pnt0altrxo3oydla rln il()tetrxo nu1omen nvsat a2uaum nt1opxnioeiatlsDrmumpn(4teeniocoo1lpDeln s;()seto(mpou1alte ncsat)a2ta(mpoo0texnmieiaslaDrlu pnt0alxnir tytoptrau i;( texm(o3ou1am e neia(fsDrax pno0ale iociat a ua( o u) ltrxf oydopte ivsls)s2trirpiudaptn iesa()aDum(ro;o1alt mf3iltlaDrln pnu0texrif3to1lmtraivsls t2tr(mpny4lleelfei ( sruru ooo0tetnmoeils m ua(ms t)aexrmo oy1oa elnei t t2xriopno1opt  nci (f rrrur oo0aetomo3iydlm2eanvs (4tlxoio3oo1fpD aies ()s2to(o3nu1al  lfcs ( a2ra(  ou1tleoifeiadla2rl(msn(0trxoxoctydlmD  i il() exmxm3iy1lme mnvsa(  2tmu p;o4tlt  ictysls eluvo;t4 rxomo oa1fp rluei;t) rxoiopoo1om n fvil() 2rm(rp;u1alxomieiatfm ulnmpnt0 eeomo iodlmtrauei;s  etmim oudom   fcil( aDumx pnu4tlen feiasfa ua(mo;() exnxf oytoa  an il( t2uo(r nu1aleemnesa()srrrxroot1tlto ietlsfmDrau s (4tetoir iytoatelivslt0t2to(m3iydlmtelnvta()sDrmumo;t1alen o3tld m rauvsnu)texomo3oodomt ln o s tetrim iodol e nvs t)a2urx p;u1oexnif3ilsla2ran o;u)aexrio3tatopDr ivo t)teurxo nu4lp  liesls sDtr(r ou0alxomietys m rmnms t)altnmo ta1lp ranvo;( srtrirpoydlmtn iet s)sDurxmp;u4alxomociytfm ra(vont4tltnioctadoa eaivslt)srurio iy1optelfvsl( srtrx p;o0oetoii3tatls2rau p (4 lxnifcoydopD ln o t)srum(r oy1lptelivta(  Duru onu0tet ii3iysfm rmuvp;t)tltoxr todfp   nvi ()tetmim3ou1lp elnvs t aDrauroou4teeoii3tyd s raumpn(4trermf oydomt  nvs ()srumxopoodamtemnci sfs2um(rp;u4aetoii3tadls rl( snu)aleoircoytomD lnei;s trxoio3oodam e fvsl( srumxro;u1tlenmoeiyd a um(vonu4aexrxoctodom e ies s)t2tmio nydom nmivt sf 2tmum ou4oet mieilsls uluvon(4aetoirciydlaD luvs;(0s2trimpiy1lme  ivtlsf Drmurpnu4aleomieiadfaDuln o;(0areomf3tytlm r u i s)s2to(rpiy4ap n ncs (f 2ra(root4aetnioetasfa2umu p t0trtnirctydfmDraueo;t0srxoxr3no1lp emiesas)s2trxmo;u4aex mociasfa elnvpnu4alxrioctytlat  ueolt srtoxo no1lmtnmnvsa( arum(mpoo1apeo o3iatlsDrmnvo;t) exoxf3oadop  lu s (0texrim nodomtnlici s)aDuru ono0aeen feildlaDranvp;t)artoiocoodlp elivolt0srumiopoudam n ivsasfsrta(rono4aetoii3tyt a rmuvp;t0trtnxociy1oatr ivol(0s2xmimpnodlm elfet tfaDurx ono1tle mocils mDrmump;t) exomfcio1lp rauvs (0 exrio3oo4amte neta( sDra(ro;o1aetomociatfm raump (0trtomo io1lmt aieo;t0sexmir3ny1aptnlncs t aDrmx pnt1tlenmociytfs2elumo;u)tlerioctadfmteln slt0srtrxr3nu4al   neiltfsDtaurp;u0oet  ociydfs el( o;u4tetoxocio1lpDelueil()texmxr no4openmnesatf rurxr oo0aee  o3ias a rau o;u0trxoif3iatfm e uei;t  ruo(r iy4lptnlfesas)arurur ;o0alenmoetltfs rl(vpn()aeenxrcta1fmDe n s (0 rumxmpiudam nmnctas srtmx  ot1aetn fciysfsDrlu p (4arenmrcoadopD  ivols0s2xrir iy4lpeelfes s  Dtmur oo1alxoifetad aDumnvs u)arxnmr3iytfmDraivs () exmxr io4lpt mnvsls arrau oot1aptoifcild sDranvs t4 rxomfcoatomt  u olt0 exoirpio1lm  lncs tfs2urxront0aet ifcilsla ean snu0artrio to1lmt auvs (0setoim3oo1amenmfvt t) 2ur( o;t0optomoeils a2el(vsnu4 ltnmo3to1fpte nes;(  etr(o3oo1aptnlfesl(farraxr ;o1tpxoifciatfa2rm( o;t0aexoir ta1lp eln slt)tetrimpio1optelnvilt a2rax o;u0tpenmictyt a2rlnmp;t4 exoif oadfaDeluvsl(0s2urxo3iy4ol  mnvtlt  rtmxmp;o1apx ifciydfmDrmuvp;(0alxomfciatlpDeanes;s) 2toirpiy4omt lnctlsfsrtau o;o0tltomf3tltla el(mpnu4alxrio3tatopDraneol( t2xrxr3ny4aleemivtltfs2um(m oo1tpxoio3ias aDul(mpnu0arxomf3ty1lmteaues s srtm(o nu4lmeemfeiasf Dtr(rpou0tpxo oetydfmDeaumpnu)tlenxf3oo1lm r ivolt t2xmxm3nu4amenlieilt) 2raxr ;t4tpeoiicilt s umuvp u0 lxnxfcoa1lmteai o s0sruoxmpnu1lp   nct sfs2um(m ;t0apxn f3tldfmDean pn() rxoxrcio1optrlieo;()sexrxm3nudolt mivsat sDra(rp;u0oltnioeilsfs el(vp t)areriocto1opt auvi ()tetoirpny1op  livia( arraxm ;o4oee  octatfs2el(mo;t4arxoxocoy1om  lnvo s)seurir oo4oltnlivtlt) 2uau  ;t4optoio3ilsls2emnmp;(0alxoifcoytlpDr uvi;s0seurxm no1opeelncs s) rtmxr ot0tlxo ietad mDrlu pnt)tltrxfcootfatelneo (0sruoirpoo1ame  fvil(  Dua(rpnu4open ieild s2uan ont4alxoxo3tytomD  neol(0 euoxo iy4lp  micsls)sruaumpoo0apenmoeiyd s eanvp;t) lenmocoy1fp   i ol()seuo(o3no1omenlfctl(f 2uax  nu1tpxomfeiyd s2rlnmo;u) exomfcoatom rai olt0teurir iudomenmieta()sDtaxm nt1olen f3iyslm2ran o u4 exrmo3iytlm eauvi;t0srtmim3no1ll emfesa()srtm(rono0aetnifeiatfa2rlums u0alxnxr ootfa rauei t s2toirpoy1alt  nvs t) Drru pno0tptnio3iyd mDumu onu) ltrxo3ootfa  aiei s trxo(m iydomt licsatfsDta(m ;o1opt  icilsfs2uauvp;(4trxnmrcoo1oa rlues (0 rur(r3iy4omeelfvsltfsrrm(mp;o1olxnmfctldlsDel( sn(4 lerxf iy1la eauvo t  rtrxo iy4alt mfeiat a2taurooo1ole ii3iydls rln snt)altrio3ta1oa r uvil( s2xoxr3oy1lp nmiet t)aruau o;t0olenmi3iltla el( o;t)tlermr oo1fateanvs t  rurxm3iy4amtelfet ()sDra(moou1oexnii3iysfs emuvo;u4 ltrmo iydlp raues (  etoiopoudap e nes s) rtm(r no0oeenioctad m eanvo;u0 eeomf oo1om elnvils)teuoxo3oydap  lictl() rum(ronu1aptnmfctldfm rl(vo;t4 etrxf3ia1fmt ai sls0seto(m3oydlltn ncia(fa2umx  ;o0tlenioeiatlm2el(vs u4alxrio3iy1op  lnvo ( srxoxo3iudapte nei (fsDtrumpnt0oleo ieiatfaDuln o;u0aexoif ta1laDeluvolt) etoxr3ny1optelfvt s  2um(moou0olxn fetltla emuvont0aeermocto1la elieilt s2tmim3iudlmte iei ()aDraxmoot0tee  iciatfs uaumpnu)texoxr3tydfp rauvi t)t2xrxo no1am  mnvs ()s2um( pnu1oeenmi3ilsfa2ran p u4teeomfcoy1la eanvols)t2toxr nydlpte ies t aDta(rpou0tltomoeiys s2rmnvp;u4aleoxo3oy1fm   nvs t)tetr(m oo4apt  nesa( a2raxroou0apx ifciad m2rlnmp;t0aexniociy1opt  ieol(0 etm(opio4lpte neia(fartm(rpno4aeeoio3iyslmDrm( snu)arenif tydfp rluvslt0trxmim ny1aptnliesls) Dtaxrpot4tptoii3iat s2rmn s t)tlxoxo3ta1fate nes;(0t2uo(opoo1aptnmictas)aDrm(m ;t4tlenif3iadfsDemuvsnt4 etnmf iy1faD ai s;t0t2xrxmpoo4openmfet t arraumoou0tlto feiasla2eauvo;t)arerxf3oatfm e i il(0tetmxm3ou4aptn fvtlt a2raxro;o1tetnio3iatlm2rlnmsnt0teeoxr3ty1opDeau i;() eum(m3oy4lp  lnetl(faDrmumo;o4tpeomfetasfa2uanmo t) reoxoctatlaDe ivil( t2tmxm no4lmt  ietat arrmur oo1oeeniictad a ran s (0trxnioctodfmt aieo s)trtmiopnu1omtnlietlt) Draxrpoo1alxoiiciys m uln s u)aexrio iytfmtelues ()s2toxmpiudolt  ictl( aDurump;u1aleoifctat sDrln o u0 rtoio oo1fp rau o s0srxmio3nydop elncs t srua(  ;t1alt mociltfmDrluvs t0areoifctatlat  ueo;t)truo(m3io1olenmfci t) rtru o;u1alxn oeiytlm eanms;t) rxrif oo1fa e nvo;s  etmxr3ny1om   neia()arurxmpnu4oeto oeiltlm umu snt4treomo iy1fp rlneo;s)srtrimpoy1al elfvt t  rra( p;u4oexn octat mDuan pnt4tltrxo iydfpte ieo s) exrxm iy4ll  lieia() rua(rpnu4oet ifetat s eluvp u)alxoiocoydfp e n ols0 2triopnydoptelieils) 2tau pou0opxn f3iltfsDrmu s u)trxnmrciatfp ean olt0 eurir3iy4omenmietl( aDraxr no4oleo o3tadls ua(mo;t4tetomr totlat aivil(  euo(o3nodol nmieil() Draxr ;t0olt moeiydlm emn s (4tlxrmo3ty1opDelivo;s) etrxrpoy4amtnlfctl()a2tauro;u1oetoioeildlm2emnms;u4teerifcoo1fmt au sls0 rxoxrpnydalt  fvi s  Drmuro;o4tpe  f3iyt m rl( p;t) leoxr ootfat livolt)texo(m oo1opeemicia(faDrmur ;o4teeo ictad a2rau o;u4artrxf iydfa e ivi s  eur(mpny4opee ictlsfsDtr(  ;u1aexnmfciyt aDuauvo;(0tetomrcoy1omD  i sl(0sexmir iodalte feilt)sDuru  nt1oeeomfeildfm2emu p;t)areoxr tatfa  anei ()srurxr oydlpenlfeias aDrru oot4ape  i3tasfaDrluvo t4teermfcoa1fptr ueo;t)srto(r iudapen nvtat) rtru pot4tee  fciyd a rlnvsn() exnio3oatfatr nes;t  exrim oudlmen fcil(fsDrmx  oo4olxoiociaslm2uluvp;t) lxnio iodoate neo;t s2um(r oodlpeemfvtl( aDtmumo;u1aleomfetas m uauvs;u0trxoxo ta1fm rln s t t2tm(m nudomtemfcsas  rrmxronu1opt miciasfm2rl(vo t)trxrmf iotfp elivs s0srxoio iu4amtnmiet t arur(  ;o1teen i3iatfm2emums (4altnxfcoadlp  anvol() etmim3io4ape  iei s)aDtaxr nu1aetoiictyd aDemu on()tlxnmf iodla ranvo (0 2uoxr nu1llt  fesl() rrmxroou0tpto fciadlm eaump ()tlxnmfcoatfpt  uvo;()truo(r nu1openlivtasf 2rrx pno0oleo f3tysfa2ua(mpnu)aetnio3ta1fa eaneo t) 2tmir ny4llte fetas)s2tm(  ou1alto ictlsfa2ra(vo;u4aetrio iadfp  lueo s)t2uoxmpnydamtemieta(fartm(r ;o1tetn ieiys mDraumo ()trxoircoytlmtr ieol() 2um(rpiu4aleelics sf 2um(rp;u1tet  f3iydfaDemu s u0trtrmr3tadlpDelu o;s) eumio iy1oltn ivi tf rur(mo;u4teeo fciysfm2el( p;u4trerxrciotopDelnvsl(0teto(mpoodamee ivsa( srum(  ot1aex mf3taslm2rl( o;t)alermocoodfaDr ieo;(0 etoxr oo4altn ncsl( aDua(mpno1tlxn ieiatls2elnvp;t0tlxrmr to1fpteauvsl()t2uo(r oydal nlncsat a2uaur nt0tlenioetaslsDrlnms u4arxnxf3oydomDeau s s0tetr(r iu4apee ncs s) 2tmu o;t0oltnifciyt aDel(vsnu)aeenmf oydfpD an i;s srxrxo iy4open net s s2trxmo;t0aet mf3iytfm2uln p t)trxrxfcty1oat lu slt trtm(rpio4lltn ivils) 2rrx oou1opx mo3iytls2ean sn()areoifcoydlmDrai il()t2tm(m3ou4lpt lnvi s) Draur nt1oeen feilt s uau o (0alenif tytfm  aiesl(  rxrxm3oudlmeemnei ()s2rrxm oo0oleomfctydfs2ulnmp;t4trtrir oa1fp  ln ol( t2umxm3iu1ap emncta(f rra(r nu0tpxoio3ilsfa eau o u0treoir tadfmDeai s t) rtoxr3iy1apeemnvias)sDumxrp;u0tetnii3taslsDrm(vo;u4altrmr3tydoa eauvils t2xrxo3iy4lpe lnvsasf rtmx  ou1tltn i3iytfm2emumont)arenifciydlpDraueo t0s2xrxopio4al   netas)a2ua(m nu4oeenmo3ilslm um( p;t)tetoxo3oy1fp rli s t)s2tmio3nu4apen fci t artaump;t1tetnmfciadfa2ulnmp u0aexnmrctodfpt ai s t  2umir iydlpe lfctl(  rrmxmp;t1altn ociys s uaumsnu)tlenifcoodop   ues;s srxoirpno4llt  nvtls)a2rax  ot0ole iictyd s ra(vp u4 rtrmfctodoa  aneo ( seto(r3oo1op elnvi tfsDum(rooo0apeoifeiytfs eauvs t)tlenxfcia1la rlies;t  2uo(opoo1opeelnvt sfa2rmurp;u0apxnmfciat aDrl(mp;(0trtrxo3oytfmt auvo t  exm(m3oo4omenmicsa()artm(ro;o1aet  feiydla2ea(vs t4aleoif3iytfmte ivo;t)sexoio ny4lp e nct s)srtmxro;u1opeomf3tld aDrmuvpnu4artniocoydfpt au il( sexr(rpiudoltn fcilt aDtmxro;u0alt  fctlsfs2eanvp (0 renmf3oatfpt aies;t s2trimpoy4ll   ivi s) rua(rpnt0texn ocildls umums;u0 leoxfcto1oaD ai ol() exoim3no1llt  ici ()aDtrum ;u4aleoiieiatfm2em(mo u4texnxf3oy1fpDe nei;(0setrim3nydlmte fctlt)a2uaxrpno0tee moctas a ul( snt4tlxnirciadfp  auvil(0t2xoxr3io1ll emnvt ()srrm(ro;o4tpto feild m um( on(4tltoir iatop r uvi s0teur(rpoydal elfet tf 2rmur nt4tpenmi3iltfmDrlnvon(4aeeoircia1opDrau s t s2uoio ou4lm elivia()aDtrx  ou0apx  ietyd a2uau s;t)treoircoatopD lnvils srxrir ny4lmt micils srtaur ;o0olen f3tldlsDemnmp (4 rtrmfciodfpDrluvol() etrimpno4ameelnct s)aDta(moou1tpxoio3ils a rmnmp u)tlxrmf iy1lmtelueslt texo(rpiy1lmen fei s sDtrump;u1ope ifeilsfaDeaumpnt4trxnio3to1lpt aneo t)setr(mpiudlme lfvs s aruax oot4ape io3tas sDrluvonu) exnxf tydfp eaueols teurimpoudam  lieta(fsDtrumpoo0tpxniietydls2rmnvo;u0arxnxf oatoaDrauvi;t0 2um(rpiy1llt mies sfsDuru p;t0opx mietad a eau pnt)arxriocty1optelieols)srtoiopoy1optnmfeil(f Duau pot4texn feiytlmDrluvp;u4 rerirciy1la  auvsls  2xmirpiodape  neia(  rrmxmono0oetn fciydfa emnvs t)arxnxrcoa1lmDe u s s texmimpoo4lltnlfei sfsDuaxm ;o0openmf3iadls2ul( s t4 leomf iadlptelnvils t2toxopou4om emfeiasfsrumu  ;u4olenii3tyd a2um( p t)alerxf3tatoatraivols)t2tm(m nu1lmtn fvsas s2tau pnt1olxnmocias a ean p;t0alenmfcoodla ean olt) rtmir3iodopeelfeslsfs2rrurpot4opeoif3ilt a2rluvs;t)aexomo3ootoptraieo t seuoxo3oo1am  mnctlt)arrau  ;t0tltn fciadla2eluvo u) rerio iatfmDranei ( trxmxo3iudole  nesa(farta( o;u4ape  fciatlm2rlump () rxnxo tatopDrli olt)sexmio nu1alt livtls sruaump;o0apeoifetldfs2rlu o (0trenmociy1lpDrlivi s  rumxr oo1oltn ncilt)srum(m nt1alt ifctyt a2elnmp (0alerxociytfpD  ues;t sexo(m3oo4optelnvsa(farrm( p;o1tptniociyt m2emn p u4altoiociytfp  lu ol()srxoir3iy4olee ietat s2trurp;u4tptnioeiatfa2um( o;u4artrirciotop rauei s) 2uoxrpnu4optnlictas srur( pno1apeo o3iadfmDuau o;(4 etomr3oytlaDr ieo;()srur(m iydom nlicia(fsDrr(mpot1tptoii3ias a2eluvp;u0tlenir iytoa  anes t trtmxrpou1ale livsas)a2tmu  ;o1aetnmociytlm2em(ms;u4tetomf3io1omtrluei;()texmxmpiy4lmenlnvsasf Dtaxront4ole moctadla rm(von()aetoxr iydfpte n o;t)t2to(r3nu1lptelies ()sDurxrpnu0tptoioctysfa rm( pnu) etrmoctadom rlneols)texo(rpoy1lp emfvsl()s2urxmonu1aex if3iyslaDulnvsn(4arermrcoa1lmDr ivs;s) rxo(r nudalt lfei s a2trx p;o4aetnmfcildfs em( p;(4tlxnio tatfp eaivsls  rum(o3oydomtelivs s) rtaxroou4optnmoeilsla2um(vsnt0areoir totlpDeaneils)texm(o3oodlpe lics t) 2raump;t1tpxomi3tysfm2ua(von(0trxrxr todlm eau i s texmxrpoudal  livsas  2ur(rp;o4optomfeiydfmDeln s;t4tetnmf iadlpDeln olt0 etr(r oudlmtelfcias)a2taum ou4ole mi3iadfs2emnvs;()trenmocoa1fmt  nesls0s2ur(r3io4lm nmivtat)a2uau pno4oetnif3tas m2eluvp;u4 lenxocoa1omtrau i s0texrimpou4am nlictasfsDtr(  no1alto o3ildlaDemumpn(0 lxnmr3tydfpDe ivols0 rxrio iu4ole mfvil(fs2rmxm ;t4tle mietltlsDeauvpnt)arenif totoaD ai o s0sexo(m3iy4lle mfei ()a2tmump;o4ape mociydfm rlnmpnu0 ltomo3to1fa rauei;t) rurir3nodapenlies tfa2urxrono0tpxn f3iyd a eau pn(4arxrxfctytfm r uei;s)seurirpoo4lpte nvsa()s2urxro;u1aexnii3tld a em( o;(4aetrxo3iytlmte ies;t0trtrim3iy4lme  nvs ()arrmuronu0apx  i3iat s rlumpn(4aetrmf3ootomDelues s) 2toio3oo1altnmictlt  rua(r ;o1oee mieilslaDrm( pnt4aeeomrctytfmtrlieolt)seum(m3ny1lmte nesas) Dtr( ooo4olt mietasfa2ul(mo ()altrxrcoodlpD  uvilt0 rxrirpoudlle lfvsat) Dua(r nu0ole mictlsfmDean s;u)aexnxocoy1latr n s (0s2umim3no4om nliesa(  2taxr ;u0olxn ociyt a rm(ms u) eerio ia1om eluvi;()trxo(r no1lle liesltfarurx  oo0alt mo3iytfsDeln snu)arerxf3tytfa e ies s) 2xrimpiu1al   fvia()a2ra(rp;t4tpx io3tld sDulu o u4 rermr to1fmD lu s (  etoxr3ou1lm e fci (  rtrurono1aet  f3tldlm rmuvs () exrifcia1faDran o;s)s2um(m iy1om  mivs (farrru ont1tex mfciydlaDel(von(0 lxomr io1fa r nvi;()t2ur(m3nodop  mivtl(  rrr( ont1olxn o3tys m2rmums (4trtnir3todomtelu ols t2xr(mpoydaptnmnctat) rrm(mpnt1oleniicildls2el(vsn(0tltnxocta1oa  aivi (0trtoxm nu4optnmnvtls a2rrur nu0apt ii3iyslmDeaumo ()arxnmf tytlpDrlu o;(  rxr(r3nu1ameelictl() Dumu  ou1olxo oeiltfm2ra(mp ()aeenxo ty1lpt aivs () exmimpiu1op e feiasfa2rrurpot1olxn fetad a el(mp u0treoxocootfate ueslt  etoiopno1al elfesat)artmur no4oet ifeiltfsDrlnvp (4areoxfcoydlm r ieil(0s2xm(o iudap  lfes t)aDuru  ;u1tpe moeilsla emuvs;t0trxnioctodlp rlieo t) 2xo(mpiu1olen ivslsfaDumxr nt4texnmi3tasls2um( onu4tlxomfcoo1omt ln i t) rxrxopoy1lm   ics t)artrx pou4apeomi3ias a2rm(vpn(4artnxf iytfa eanvo (  etrxm3io1lpe mnct s sDtmum ;t0tee  i3iasfmDea(mont4 eenifcia1om elnei () euoxo3oudal  lncsas aDumur nt1apxoiictatfa rlu o;u) rtnirciydla  aivilt t2tmimpoydlpt mivia() 2tax oou0tetn fciyd mDrmnmo t0 renircoo1fp   nes;t)teumir oo1omee nctls srrm( pnt0aeenmfcildfs emn s;()aetnmf3iytla  luvo;() exmirpny1lp n nesltf Dumu p;o0tpenmociaslmDraumo t)alenif3io1om   ueslt0 etm(o ny4amt  ivi s sDua(mo;t0tpxo iciatlmDrmnms t)aeermf3to1fp elies t)seuo(m3oy1omtelnvilt) 2ur(m ;u4tltoioetys m2rmums;u4 etnio oydfpD livs;(0setoxr3io4lpte ieta(  Drmxro;u0altomiciydla2elumo u4 rxnif3io1oatelu i;t) 2t
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;(  2umxrpny1ope  ict sf rtaxrooo0opt ii3ilt m eanms ()aleomocoadfpDelues t)srxmim iu4om n nvs sf rrmumpou4olxnmicilslm elnvont0alxrif3iadlaD anei s0 ruo(r oo4op elfcs s) rrax pnu1tpe io3tas s2ul( p;u4tlxomr3tatfa rlivsls s2toir nydame mnctlt aDrmx pno0alt  o3tltfa2ulnmon()teenif todom rauvslt)s2tm(mpnodalenmfvia(fsrtrx  ou4altn fctld mDraump () etrxo tydop ranvo t)sexo(mpnydomeelfetl(faDur(r oo0aex iieiysfm2rl(ms (4artnircty1fmDr ueo;s seto(mpnu4alenlivslsfaDuaumpnt0olxniicildlsDrmnvo;u0tleomr3oo1laDe i ils) 2umio iydlmenmfctasfs2um( ooo0tltoioctas m2eln p;u)arxnmo io1fpDr n i s seur(mpno1ome mictls) ruaxmpou0oeenii3iysls elnvs;() ltoxr3iadfpteln i;( trxrxm3oodlme lnet tfa2tmx  nt4tleomi3ias a2ran pnt) lxrxocoydfmtrlnvil( t2xrio iu1ap emnei () Drmxm ;t1alxniieiytlmDra(vsnu0aetrirciydoateaivols)s2xrxm3ny1lpte fvslt)srururoot0tpe mieiatlsDumnmsnu4 ltnircoatlm  ln i t0 rtrxo3ou4optnlfeia() rtaumpno4oetomo3iatla2rlums;t)aeenmrcty1fpt luesl()srtmim ny4ll nmivilsfaDrmump;t4apt ifciadla2rluvs;u4tetniociatfate ivo (  2to(opoy4llt  fvtls  Dtaxr nu0olxn i3iyt sDra(mon(0texrmr ta1la r ieils)srtrxmpno1aleelnvsatfsDur(r nu0optnmi3iadfsDrauvo u0 ltnir3ia1fp r uvil(0setmimpno1ap elfcs t srur(ro;u4tlxnifctyd m raumo;t)trtrxr iatlm rluesls0t2xoio ou1omt micil() rumur ;t1aee  iciatlm2ra(msn() exrif3oo1laD livslt0sexm(r io1lp emnctlt aDraum ot4aleoif3tat s2rm( o;()trxoif3todoatr ivol(0teur(r io1op elivta(fs2rrxrp;t1tex  o3ias aDuluvsnu0trxrmr ootlmteli olt  euoir oodopeemnei s) 2tmxmp;t4ole ifciysfs2ul(mpn(4tetomf tydlat ln i (0srumxopnu4amt  iciasfartm(rpou4oleoiicilsfsDranmpn() rtnif todopt lueils0 rtmxm3oo1lle lnvs s arrmxmoot0tlxn f3iydfa ua(von(4 ltomo3tatfmD lnei;t0texoxo oy1alen fvta( aruax  nu1texn f3iys s2ran onu4 reoxrcoo1la eai s;t0s2xoxopiodamenlncilsfsDuaur ou1tlxomicilsls emnms u4aetnxf3ia1lpD  u o ()s2xm(opoodomtn fvils)arrau pno1apeo fciat m2ea(mpnu4 eenxrcoatfm elneo;()t2ur(mpiy1altnlneilt)srta( p;o4alto fetydlaDeau onu4aeerxo3ty1fmteau ols seuoxm nudamt mfcsat  Draurpoo4opxnioeias mDuau p;(0aeerxo3oytoaDeaieo t0 2tr(o oudlpt  nciat sDtm(  nu0optnmfcilt m em(vs;() lenmfciodla e neslt texrxopiodamee fes s srrax  ;u0tpe mfeiltfs rmn p;(0 rermrciatoatr u o;t0srtmir3ny4lp   iesasfsrrr( pnt4teenmi3tytfsDrm(vs;()trtnxr oy1omt li i;t)s2ur(r3iu1om nlici ( arurxm ot1oeeomo3iysfa rmumon(4texrio3oo1om  an o t)teuoxm nodlmtnlivtas) Drrx  ou4oeenmieiysfs2rmuvpnt)tltnmf3tydfp  luvslt0trxrim3iudamtemnetls)a2tru pot0aee io3iydfsDrlnmo u4 rtoxrciotfpteaieo;s0 eurimpno4lm elnvsl() rrrx oou0opt ioctat a2rlnmpn(4altrir3iodfpDe nei s0 ruoxmpio1lptelnvi tf 2rrxr ot0oeeoiicildfs emu sn() renxo oodfpDranes ( t2tmxr3oodamte neiasfs2rr(rpot1oexoiiciatfsDranvo;(4arxnifcoy1fpD ln s s0 ruoxo no4lmt lfvta( sDtm(r no1aee mf3iat mDulumo u) ltnxo oadlat  n i;s trtrio3nu1ll nmivi sfs2rm(m nu1apxnmo3ilsfm2rlu o;u)artnxfctatfpD  nes;(0truo(r iu4ome  fvsatf rrmxm no1tex  feias s eln o;u)trxnxo3ta1fat ai i t srtm(r3ny1apeemnetltf rtmumpnu4tpt mi3iydla ranvp t0alxomo3io1oaDeaivols)t2urir oo1omtemietas arumxr nu4aptomictydfmDelumo;u4arerif todfaD an i s)sexoim oydlm   fesl(fsDra(m no1optoiietyd a ra(mont0areoir io1fa eai sls teumxo3iu4omt mncta(farrmx  nu0apeo i3ildlsDeln snt0 rtrxf3oadlp r ieolt s2xm(r iy4lpeelfeslsf 2rr(m ou0apxo fetadfmDea(ms;(0tleoir3iytomt  nvs (  2tmxrpnu1al e fetlsfarrau ono4olxnii3ild a2rl( pnu4 lxnmocoodlpDr n o t) ruoxr3ny4apeelnvi (faDtrxm nu0oleomo3iysls2ulumont) etoxo tytlat aiei (  2urxmpiu4lltemncsas  rrr(ro;u0tlt  ociatlmDrlnvonu)tltomr oatlpt aues t0t2urxo3oo4llen fvsas)aDrm(mont1ape ii3tat a2elums;u)aeerxr iytoptrln o;s) etmirpoo1op nmncsl() 2rrumpou1tlx mfeiasfmDrmuvpnu)tetnxr3oytfpDr n i;(  rxo(r oudope lnet sfaDur(rp;t1altnmf3iydfsDem(mpn()tleomrctydfmDraueils0srtoxo3no1ope mnesltfa2rmx  no4olto o3ildlmDum( s t)areoxo3iotlmteanvs;(0 etr(o oy1altnlneilt)sDuaxmp;t0teenifeilsls uauvpnt4alxnmo ty1latr i sls sexm(m oudam   nei ( sruax  nu0alxnmocilsls2ulnvs t)texrmr3to1omteluvi t s2uoxopiu4alee nesat)aDrrumonu0tetnmf3iatls rmuvs t) rerio iatfp  ai i t  etmxr io4lle  fctat  Dtr(  no1tlt  ociat sDrmumo t0texrio io1om rlnvo;( s2tmxmpiu4ap nlieiatf rtrxm ou4alen fctytlsDelnvpnu0 rxnmo3oydlm  aueilt s2xr(o iy1lmtn ics t  rumur no1olx iieiasfmDranmo;(4 rtrirctodom  aivols) 2xmxo nu4alenmicia( sDur(mpot4tee  o3ild m uauvpnu)arxriocia1fpt luei;t0 2tr(o iy4lm   ietasfsDta(m nt4aee  f3iltfaDeauvont0artoxrcoydlmD an o;()teto(o3ny1am e ivs ( artrum nu4apxnmoetld s2uluvo u4texoxr iytop r ivo;s0setoxo3io4alen nvi s s2rmxrpoo4opxomf3ils mDelu p u)tlxriocoodfmDrlivo s0seuoio3oo4ol e ietatfaDrmumpno4tpt moetasfs rl(vp;t0alenmo iadlptrlnvo;s) rxrim nodlptnmfcsat)aDtmx ooo4opeoio3tlsla ul(vont0tleoif iotoatean i t t2xo(opnu4om n nesltfsrra(mooo1aeeoiiciadfs2ulu o t4aetrmf3oodfmt ln sl(  etrxr oy4am nlncs t)aDtaxm ;o4oetn o3ias sDemn p;t0 rxoxr3to1omD  ues (  eurir ny4ap n fvtas)aDua(  nu0oleo o3iat aDra(msn() etnmr3tadlptr nesl( t2xo(m3oo1omte nvsatfsDrau p;o1aex if3iyt s2emnmp (4teeomr3oadlatean i s sexoim3io1oltemnetat  2rm(  ou0tltn fciaslmDea( s;()trxniociotlp  lu olt0 rumimpoudllte ies s  2ra( ont1oeeoifeiltlm2elnmsnt4tetomfcoatfmtr ieo s  rtmxr3iudllen ivt s  ruaxrp;o1ale if3iytlm emuvs u4 renif ta1la elu s;s)sexoir3nu4lme lnetls aDtaump;o1tetnifeiadla2rmu snu) leoiociotlptranes t0 rumxm3iy4opee ivsasfaDtmxm no0alto fciatfa2eanmon()tlerio3oodfpD  ueilt)truoxo nu4open ncsas) 2um(  ;u1oexnif3iysfa ra(vsnu) etrmo todlp rlneo;t t2xrim3oodal  licsa()sDumumpnu4tpx moeiysls2uan o (0 lxrir oytfmDrluei s srxrir3iydap  mfet (faDtrx oot0olx mo3tyt a em(mont) exrxocoo1oateanes (0trto(mpiy4lm elnesltfs2uru o;u4teto o3iadlaDeanms;u0aexnmfcoy1faD lnvslt0s2urxr3oydolt  ieilt)srtm(rpou1oexoiiciys mDrmn onu4trxoio iydlmtr u ils0 rtoxo nu1lmt  ict t) Dtrumooo1tlxn o3iadlsDelnvs;u0 rtniocoytfa rau sl(0t2tr(o3oudol nmneias srrmu  ;u0optomi3iad sDrluvpnt0artnir3iotlaD aieil( t2uoimpoo1ap elfeiat) Drrx  ou1tpx moeiadfm2elnvp u4 lxrio3ia1om r uvsl()trxoir nu4altnmfciltfaDurxr ;t0tltn feiadfs2emnmp;u4texomr to1oa   uvs ( t2to(opiydalte neiltfsrrm( ont4aetnif3ildlm2ulnvs;(0trxoxocoy1oaDe ieo t)texmimpnu1op elict sf rta(ronu0olx iicildlsDua( s;t0alxrmfcta1optrlu s t)s2xm(mpio1lpeelnei (f rtmurpno1ape mociyd aDeanms;(4 leoif3tatom rlnvs ( trtoim iu4apt  nvt sfsDtm(  ;o4aexoioctydfs2eluvo t4aexrmfcia1latelies;( srtr(o oy4lm e ict s s2ra( oou4aee micils m2ul( o ()arxoxo3totlmt aues;t) exoir3iu4omtemnci t s2ua(mpot1apto feiatlaDrmu pnt) eerir3iydfptraivi;s) rtoim nodol elfesls)s2tm(  no0oex ifeiys s2ua( s;t4 rxrxf3iytlp e ivslt  2ur(opnu1lpe lncsa()artm( p;o4teen ieilt a2rl( on() lerif oo1opDeliei s trum(opiy4amtemietlt a2tax p;t4oex ifetasfaDrln s;t)trtrio3oy1lm ranes ( trxo(mpoodal e nvtltf 2rau  ;t1alxo ociydlm ul(mon() rxoxr3oytop rau o;()texm(opno4lpee ivtlt) rtaurpno4oltomoeiat s2rlu p;t)trtoir oo1omD lu olt0sruoim3iy1omt lfvtas s2trxmooo0alx ifetas a rmuvs;u0 eeoxocoa1lpte uvo t0setr(o3nu1llt mivtlt  Dra(  ou4alx  f3iysfm umu snt0arxrio ootlpD anvs s0texrxrpiu1ol nlietat) Dra(m ;u4oltomiciadfsDra(vpn(0trxnmr3ia1laD  ueo (0 etrxo ny4ame mnes () Duaxm ;t1oex mietaslm2ua( p t0tlxrmf3todoa elneolt t2xoirpny4altn icsl()a2ta(m no4olt moeiatfsDemu p t0tlenxf3oadfa raueo;s0teuo(r oydol emneia(f 2rmxmp;u1oex moctlsfs emu s (4arxrir3iytlateauvi;(0tetoxmpoudame mivilt artmur nt4apt mietlt s2umnvo;(0arxrif tytfmDrauvo () rur(r iudlme lncslsfarumxmooo1apx miciltls rm(mpnu0 lenxo tytlpt ln s;s0t2uoim3iy1altn nctlt s2urx onu1oltn fciydlaDulnmsnu0trxnxo3iatlat ln ol()s2umir3ou4opt mnetat) ruaum nu1ale mf3iasls2emn pn(0arxrio oytlmD livsl() rxrim iu4lp n ici () Dtax o;t0apt mo3iytlsDrmu pn() leomrcty1lmtelu sl(  euoirpoudlpt mnct sf Dta(m ;t1tpeoioeiasls2rmnmp;()tltoxr3oodoa  aneols0srxmio iy4ol nmies t arua(mpoo4ape mf3tys sDea( s (0 reoircoatfaDe neo;s0t2trir oudalenmfvtas  rra(mp;o4tptomieiatls2rl(vp;u4arermocio1la r nvs t0t2trio3iy4ap elnctls)arumxm nu1opt if3iltls2ea(vo;t0 lxomf3iotlp  ln i;s0trum(o3ou1lltn nvt tfsrrmu pou4opt  fciysfa rlu p;t4tlxnmr3iatfm r i s;(0texrxm3nu4oltemnvtat)srtrx  ;u1aleomf3iydls ul(mp;t4altnxf tadfatrlnei;s)srtmxr3oodam  lieta() rrr(rpou0opxomfetadla2rl( o t4 ltoiocta1fa raues ()srto(rpiy4ope lnctas  rrm(mpot1tltn ieiadla ean snt)teeomf ta1lm elnvi;()t2to(m3iu1om e icsat srua(r ;u0oleoii3ildfa emuvpnt4aexnir iydla eaies;s) etmxo3ou1ll emnes ( srraxmpou4olto ociatfm2uluvs t0altnif iy1fmDe ivs;t0 rxr(m ny4om n icsat arurur nu0aee  o3tyd s umuvsn(4teermocoadoat lu ol(  rtoxopio1alt licta( sDrrxrpno4alx  f3iytls2uaump (0aeeoxfctytoptelu i (0trxrirpoydoltnlfet tfarrrxmpno1oetomfeiasfa2rlnmsn(0tltnmr iytopt li o t0trxmimpiu1lptnlnet t)srrr(  ou4oeto fciatls2um(vo () exoxr3oo1fpDe i o;()teuoio3ou4alee fvtat  ruau poo1apeo octyd a2uluvp;(4 rtnxo iotoptr ieslt0trxoio oy1ol nlfvs ( sDurxr nu0aetomfetyslm2ul(vo u)arxrxf3tydom  ai o;s  etoimpiy1lm  mieiasfs2raur nu1alen fcildfm2umu ont4aleoif3oy1op  ln i;( trto(r oy1ol elfeil()sDurum ;o0aptnmoeildla uluvs t0tlxnio3ty1fpD livi;s srxm(r oudlpenmiet t s2ur( ono4tex mfciydfmDemn ont0tlxoxocia1op e nvo;( srto(r oudamee iei () 2rrurpnt1texnmiciyd m2raump;(0altrifctydla e ivs;( t2xrim iudll  mfviasf Drrum ;u4alen fetlsfs2um( p;u4 rxrxo oydopt ln o;s0 rtm(opiudop e nvs ()a2urxmo;t1aexniocilsls em( o () renxf3iydom  lueo ()sexmiopoydape  fct t srtmu onu0oltoiociydlm uln p (4altnio ia1fptraieol() 2tm(o oudomtnliesls aruaumoot0olxnmfeild m rln snt0 eeomfcty1om e ivs;t)s2tmir nydlp nlfeta()a2trx ont1tex moctldfa em(vonu4arenmr tatfmte i sls)tetrxo3iy1lpenlncsatfsDuauronu1oleomociys s2ra(vp;t0areoio oytfaDeanvi;s setmimpiu4altn netas sDrmx pnu0tetnif3tysfs2um(mp (0alxoio oytlp   uvilt)t2toxm3no1apee ivia( s2taumonu4aleomi3iasfaDulnvp (0 exrxo oatlatraneols)srtoxmpnydlpt mncs t  rua(mp;t0aeeoifeiadla umu o;t)trenxrcoatfpD  i s;s  rur(m no4omt lfeiat a2rax  ;u4openmiciytfa rm(vp (4arerxr iatfa   i o s  2umir iu4aptnlnvs tfsrraxmont0apeo ociltlmDrmnvo;u0teeomocoy1fat ln sls) 2umxr iydopt  feil(f 2trumo;t1alt mieiltfs emnms;() etomf3oytfaDr ivo;s)texo(o oy4lptemfci tf Dtaumooo1aetoifciaslmDeanmp;(4 leomocto1fate iei ()t2tr(r nu4alen ncilt  rtm(moou4apt  feilslsDuln p;t)aexoir ootfaDelueilt0srtm(rpnudlltn ncil()srra(m oo1olx  fetas m ra(msnu)aetriocoatlpDr nvil(0t2xo(o oodaleemivia( sDraumoou1aeenioeiysfm eauvont) etrio3oy1fpDr n i;s0setm(mpnodolenmfct s)sDrru  ;t1tptn ieiydfmDel(msn(0arenmfcoytlateanvolt srxrirpou1lpeelicsas  Duru o;t4oee miciltfs elump t4trtrmocoatopt  nvi;t0trtrio nudaleelfcs t aDum(r ou4oeenmf3tas m2em( s;u)arxoxf3iytlmteau il()trurxo io1ol  mnvslsfsrumx o;u1tetnio3tldla rmn ont)tlenxr3iytoa 
\ No newline at end of file
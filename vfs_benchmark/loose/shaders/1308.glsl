@@ -0,0 +1 @@
+nei t trxoio ny1opte fet t  Drmxmpno1apt  ietatfs umu ont)tlenxo iatopD au o;t)truoio3iu1lmte nci (f Dum( p;o4tpeo iciytfa ul(mo;u)aexoxf3iy1lmD lues s) eumiopiydom elfvsas)s2um( p;u0ole io3iasfa2ulnvs;t0tlxnxocoadfaDeaies;t0 rtmio3no1ape mnct s arrrur nu1olx ii3ildfmDra( pnu4 rtnmr3ta1fmteau i t0seumim3io1ameelnvi sf 2ur( o;u0aetnifeildlmDrlu pn(0 lenxr3oo1lmDeaivo ( teurxr3oodale lnvtl(  rurxmooo4tet ifetys s2el(vo t4 lxrmf iotfa eauesl()setoimpnudap elncil( sDum(rono1aexn ociysfaDea(vsnt4texrmrciodoatrln i s tetmxm3ny1ap nlnet sfaDumuro;o0oeeoifetydlm ran snt4tltrif iy1oaDelu i;( t2um(r3ou1optelfct ()sDua(mpnt1ape ioeiyd m elnmpnt0 reomr to1opt  i o t0 etrxo3ou4lmt liei () Dtmu  no4apxn ociltfs2rluvont0 rerxfcty1la eaneo t) 2umio3ou1al   nvta(faDuaxrooo1tex if3ild m2elu sn(4arxoxr3oytlaDrli i;s  2xoiopnu4ll emivils)s2taumpou1alto o3tasla rlumpnt)teerxociy1faD  nvo t  rurimpiodam elneslt)a2tax p;u1oeenmieiyd s uauvp;t0trtrmfctotfp  ai s t srtoimpio1am nmietat) 2ta(  ou0tpxn f3ildlaDelnmsn(4texoxrctydomD lu o () rtr(o3nu4ol n fvsls) rrmu  nt0tpx moeiytlm2emumpn()aeermrcty1fmDe nvilt trxoxo ou4amtn neiasfsDtmur ;t1tptn i3iytfsDumuvs u0trenxrcootom raiei;s) etrio ny1omte ictat srtrxm nt1openii3tlsfm ra(mp;()tltomr3iytla  aieilt0trxrio no4omenlfvil(  Dtrxmoot0aet ifeildlmDra(msn() rermoctodomDr nvils0 eumir nudol   ictl(  Dumurpno1oeen fciltfs2umu snt4 rerxrctotfmD lieils)s2tmxm oodlme mfcil(f rtmu  nt1olxomf3taslaDem(ms;()artriocty1omD an ilt) rto(m3iy4optn fvia(fs2rmxrp;o0tet mictlt sDra(mo;u4arenxfcio1la r uei s0s2xriopnudapee fcia()s2uax o;u0tlxnifetyt s eaums u4trermf3io1lpDrlieslt)sexoxm3iu4ole  nesas  rrm( o;t4olen octadlsDrm(vpnu)aeeoifcio1fmDeaueils0srxoirpnodlpeemncils) Dtr( oou4tptomfeiyd a2rlu p;t)aexnir3oo1omDr i i s)sexrio ou1lp nmivt s aDum(m ou4tetnifcilt a ran p (0tleoxo3tadfmte nvs;t  etoxopou4lpee ivtasf Dur(r ;u4alx mfciydla2um( o;u0tlerxo io1om eln sls)s2um(r3no1olenlics (f Drax  ;t0olt ii3iydfs2ul(vonu4tltnxr ty1op  liei;(0t2xr(opoodlle  fcia() 2ra(r nt4tpt if3ilt s rmuvp;u)trtomo3oa1fp rln sl()s2trimpiu1ope  ncs s s2tmur ;t4teenioetlsls umums u0tlxoxf ta1oa   n ol()trtoxr oudal emict t  rtmxrono0apt  ocild m rl( p;u)texnmo3oadfpDr n ils srurxr3oudaleemietls)arrr(mpnu1apx mfcilt s2umuvon(0aetnxrctatlaDeliei;( trtmxopiydlpe  net (fa2ua(rpot0apto o3iyt a2rmn sn(0 rxnmr3oodfmDr n ol( s2umxmpou4lp elivilsfarumu  no4alxnii3ilsfsDelnmp (0arxrif tadlptr u o;t0trtoxo nu1ol  mncias)artrx o;t0tltoio3ils s2rm( s;t) reoio tydlaDeanvs s tetr(r nodamtelietat aDraxmp;o4tpt  f3iysla2uan o (4tltnmo iatlpteau i t0 exo(rpiy4lltemies s) Duaxrpou4oeeo octldlsDua(ms t0tlxoxr3tydfmte uei;t0s2xr(o3oudlmt micsas)srumurpnt0oeeomictatfa2eln s (0alenmrcoytoaDr uei t srtoxr3nodllt  fcs sf rumx  ;o1aeenmfciad s eau onu)aeermrcoadfaDelieo;s t2xoxo3iu4amenlnctlt)s2trumoot0tpt mi3iyd sDemnmsnt)tetrxrctydom eanvi;() 2xmio3ou4amtelictltf Drax o;t4ole  fciytls ea( o (4tetrmocoatlmD ai s t) rxrim3oodop elivsatf rtaxm nu0olxomiciltfa ul(monu0tlxnmr oy1lptrlu i;t)s2uoxm3no1ol e fei tfa2uaumpno0ale iieiat m el(mp t)alxrxr tydop raueo s0t2xm(r oo1oleelicslsfaDumx pno4tlx moetat a2eau o;t0altnmo3io1op elnvil( s2um(m3nu1om  lfvslt  rur(m ;t0tpen ociadfa2uan o;t4teermf3todfp e ivs (0seurxr ny1ap elnvsas)a2rm(  oo1olxo f3tatlaDemums (4tlxrmrciadop eaivi s  rumim3ou4aleemieiltfaruax  ou0aet  oeils a2rl(mp;t0aexnmr tytlatelu ils trtmiopnudlm n ivsat) 2tm(m ;t1olxo oeiltlm2ranvp ()tetrmrcoatlate ueslt s2urxmpno4al   ivi sfarrm(mpnu0tlt mieiltfmDemuvp;(4 rtomocootlpt  nvs;(0texm(m nydale mnvsa()sDtr( p;t0oetnmoeiltlmDem(mo t4arxnio3iydom r ivs;(0 2xm(opoy4ope  fetl(f 2taumpou0tpt  f3iydla rl(monu4 lenxfcoytoptran i;s teuoxm io1oltnmfvt tfsDtrump;u1olxo o3iyd sDea(vpnu0tlxomfctodopt li i t)s2xrio3oy1lmtemnvt sf 2rmum ;u1ape  f3tad sDumuvp (0teermf iy1omDean s ( t2uriopoodope mncia() 2urxmoot4tpx iieilsfm2elumsn(0trtrmf tatomteaneo ( t2urir3iy4omeemnvtat s2uaump;t0tlenmfeiys m rlumo;u) leoxfcootomD livi;( setmxo3io1lm nmfctls) Dua( pou1oetnio3tysfmDumnmo;(0 rtoxfcoadfptr n o t0 eumirpou1altnlivi s)aDtr( p;t1aee  ieiytlsDrau s t4tetrxr3io1lm  livi;(  rxr(m no4am nmfvias)srtmurono0alx ifeias a uan o t) lenmf3iadop rai sls sruo(r oydale mfeilt) Dtr( oou0aetoifeilt s2ua(ms;t0 rxoxf tydoa   i s s setrxr io4ale  icil( s2urxmpnt1aexn oeiyslsDeanvp (0tlerircoadop rlnvol( srxoxo oodam  mictat)a2rmx  ;u4tlenmoetltla ra(mont4tleomo3oy1faDeluvilt0sexoirpny4ol   fesat)aDra(r oo0tpx mocildlm ra(vs;t0tlxoxocootla  aieilt0trtr(o nu1ope lnct (f rtm( p;t0tlenmf3tltls2rau s t4trenxr3oodoatrauei;( trtmim oydoltnlfvsls)srrrx p;u1ole  f3iltfm2umn s;u0alxrxfciotoa raivolt srtrir3iu4amtelfes (f Dra( p;t0ape mieias mDranvp;u)tltnxocootfat  uvo;s s2urxo3iu1lp e ncsatfs2taxmoot0oee  oeiadlaDrau o;u4 lenmr iy1opDe nvs t0srtrim ny1alt  fet tfsDrruro;o1aex ifeiydfs2umu o (4 etrif iydlp  ai s ()texmio iu4aptnlfesls)srtrxr ou1olxo iciltla ulu s;t4 leomr3oydfpte ivil(  rxr(m nudal n nesa( aDua(ro;t1texo octldfaDranmp u) reoxf ia1fatean o s  2xr(m ou4op elfvslsfsrtmxmpno1alxniieildlm emnvsnt0teeoio ia1oa rauvo t0setoir3ny1lptelnvilt  rtrxr nu4olenmo3iat sDrmump (0texomo oadlm   n o s sruoim3oy4aptnlieslt)arua(ronu1aeeomfeils s2rlnvon(0 etoif iodlm rln s s0sexrxm3oodlmtemncsls) 2rmurpou4opeomi3ias aDran o;t)teenmr iydfmtr n o;( setm(m ou4lm elivt s)aDuax oou4apto fciatfa ranvo (4 lxrmo3iydlpDr neols0texr(r iu1am  mivils)sDuaxrp;t0oltnmiciasfs2ulumo (0 rxoxr tatop eanvils s2umimpny1lmtelivtlt srumurpnt4apx io3iydfs elnmpnt)alenxo oa1lpt auvo;t0setmim3nydlp elnvslt a2ta(rono4olxoifciltlm rluvp t)aexoxo oadlate n o ()setrxm no4omenlivtls) 2rmx  ;o0opeomfciytfmDelumont) lxnmr3oodfmtrluvs t) rumir3iydllenliesa(fsrum(rp;t0oleomfcias s rmnmon(0tlerxr io1fpDrau o;(0 exrxm3no4lme miviat)aDtm(  ;u4tee mfctltfm umnmp;u4 ltrxrctodoaD  uvo;s0t2ur(m3iu1apt  ies ( aDrrx  nt4opx if3iat m emnvs t4trtoirciydfm eaneo;s0 rur(m3iy4lpen ietlt)arrmxmp;o1oeenifetatla2ulnvo t)texnxf tadfateauvs t) 2tr(opny1ol  mnei tfarum( ooo4altoifeiys m2ul(vpnu)trxnircty1laD  n s;() rxoxo no4lmeelfet s sruru  ;u1ape io3iytfaDul(vpn()tlenmr3todfp eaneo;s setrirpiy4oltnmfeia(fs2rmu p;u0aeen iciysfm2emuvpnt)aeerio oo1fm  lueslt0sexoio3nu1opt  nct s)s2ra(  no1aexoiiciysfs rlnvo (0tleoif oadlaD  ueols0 ruriopnodlpenlieta(fartmumo;t0aptnifetltlmDua(ms;(4trxoxfctytfpDeai s s0 rxo(m nu4alte nvtas arrm(mo;u0tpxomi3iaslsDra(vs;t0 rxrmo3oytfm  lieo t) euoxm3io4ope  fvsatfs2urxroot0aeeoioetytfmDum(ms;t0artrio3iodfptelues t0s2xo(m iy1lmee fet s) 2rrxm oo1altomo3ild a ea(vo ()trenmr3oadom  auvs s0setm(m3iu1om   fci t srtmur ou4aeenii3iyt aDeanvs;t0alenxr oytfp eaieol() 2xmxr3iu1amtnlnvia()arta(  nu1alxoifetad m2rmnvont4alxnio todlpDeln o;s)trxoim3ou4amtnmnetat  rtau  ;o1oltn ociys a emump;u)trerir3tatfmD aivol( texoxm ou1am  lnesl()a2rr(m ;o0apeo i3tas s2rmums u4arxnxrctadlaDrln ilt)srtmir3iydoleemnes t sDur( ooo0altniietatls eanvs (4artnifciy1op  livo ()seuoio oodomenmfetltf rum(rono0oetoii3ilsla rlnvo u)tlenxocto1lmD li o (0srxo(o oy1lmte fcia(fs2trum nt1opxo i3tlt aDrmnmp;t)altnxf3oy1opDeanes s0teumxopiu1oltnmfvta(f 2trxr ou4oexo ieils aDemnmo (4aetoio3ootomDeaivs;t  euo(o3iodlmt lfeia(  2tru  ;t1apxomfeiydfa2um(vs u)tltoifciotfpte i olt0t2urxm oodomtn fetls srrru p;o1ale mi3tasfa2rmuvs;t)tltoir3tadfa e nvs s seum(r3oo1ll elivs tfarumu  ou1tlxnmfetat mDemn p;(4tltnmf3iy1lptrau s;(0 2tmir3iodol nlnesas)sruau  nt0oexnio3tlt a2ulu o;t0 rxnio ta1fpDrli o t srur(m ou1ll n fvsat) Dumu  nu4aexnii3iadla eauvsnu)tlenir iadlpDrlnvi;s seuo(opny1lp n nvtas)a2trxmono1aeeo fetydlm ea( p;(4altnmrcio1fp e ivs s) rxrxo iu4lmtnmietasfa2umur ot4alxo ietyd m2eanvs t) exrmr ta1lm ean slt)t2xrimpny1opte netl( sDra(rp;t1tlxn o3iydlmDuaumo u4altnirciotomDrli o;s srtm(m3ou4lmtelfci () Dtm(root4opto ocildfaDuaump u0tlenmfcoodfpDrau il()t2umxr oy4aptelnvtas)aDuau  ;t1tltomf3iysfs2ea(mp u0trtniociotlmtraues;t seuoxm iu4lmee iesa( aDumu onu0oleoif3tysls ra( sn()arxoif tadoa rlu i;t sexoio3ou1lle mieslsfa2tr( poo1aeeo fcildla em( s;u) rxnxo oatfmtrlu s;s) 2urxo3oo4ap n fetat)s2tau oou0tlt mieiyd s2rmnmsnu)trtoif iodfpt lneo s)sexoxm oudopeemivt s) Dtru  ;o0tlen o3tltlm2em( pnu4tltoxr3ty1lpDrlueo t0seurxo oydlm n nvs t)arur(rp;t4tlto f3iytfm elnvont0trenmf ootfp elieslt  2xmimpio4ape lict sfsDrm(m ;o1tpto f3iatlmDem(vp t0 ltrmr3iy1lm e nei;t0t2tr(r nu4omen nvsa( srururont4alenmo3tyd a2rm( s;u)altrioctadfmDraivil()s2trxrpiudomte nvt tf 2urxrooo4oltn i3iytfa2umuvo t0tltnif todom  livol(0 rumxo3iy4al elivs t) rtm(  ot0olxomf3iys m rmnmpnu) lermf to1fmDeluesl()setmxo3io1olt  nvta( arrauro;u4tee  fetydfmDelnvs;t0 ltrif3oodfa  lieilt) rtmim oo1llenmiviat)a2taxm ot4oeeomi3tatfa emumonu4texnxo3iatomtr ies t0s2trxr ny4omenmivtlt  rtrurooo4olx  o3ilsls rauvp;t) lermf tadlp elivi;t0s2umir iodlp   ivt ( aDrmuront4optnii3tlt s emn p;t)treoiocoadfp r ueo;t) rxmio3oydomen icil(f 2uaur oo1tlxomf3iadls ua( p u) eenir oy1oaD lnvo t0setoxm3io4llt  nvtl( a2rrx  oo1oeeoio3tasla2uan o;()alxnxrcoa1optrlivslt)trtr(rpno4lme mnvslt)srtmx oot4aetoiicilt m uau s t)areniocoo1lpt  ueo;(0 2xr(r nu1ll emfvias aDtm(mpou4olx iieiat mDul(vs (4altrmfctodlm rlneils)setoio3nodam nmiesl(f Durxmono0tetoif3tlt mDeanmo;t)trxoxo oodfptrli o;t s2trxo io1alenmiesatfaDua(m ;t4tetomfctaslsDuaump ()tlxrmr3tadfp r nes s)trxo(m3nu1apeelnctlt)srtruroou1alenifciadlaDem(vp;t4alenxr tatfaDeluesls s2xrio3oydlpeemncil(fsDtm(m oo4tlt mocilt sDuau p t0altriociatfmD  uvs;t)t2trir3ou4lme miviatfsDrrx p;u4altn feiydfaDrmu p u)aetomo3iatfat  uvo;(0s2uo(mpiudap e fviltfa2trum ot0aet ii3ilsls2rl( ont)alenmrcto1lp e ivs ()s2tmim nudlpt  ivta( arrm(mpnt4oltn oetysla2umu o u0altnxr3ia1lpDrau ilt)trurxm3oy4llte nct t srurur ou4oee miciyd aDemumpn(4tltoif3totomteaieo s)texr(m iydapenmieia(faDumuroou4tetoio3iydla el( pnt0texnmfcoa1oa  luvo ( tetoxmpiu1lm   ncs s sDraum ;u0aetomieiytfs ua(vpnu)tlxomrcia1opDelieols0 rtrxmpoodomtnmieil(  rrax  oo0oexomf3iys a2ulu o;u)texnxrctodlpDrau sls)srxmxo oudllte ivi ()s2tax oot1ape  ictys a rmuvp (4aetomf tydfp e ieols0t2xm(r iy4ope  nctl(fs2urxm ;u4tptn o3iltla2rlnmpn(0treomr ia1lpDr n olt  rtoim ou4lptnmivtls  2ra( pno4optomi3tydlmDra(mont0 etnmf iydoat an i s)teumio ny1am elneta(fs2tmu  oo0oltomoeilslsDumu p u4tlermfctytlaDrai sls t2urxm nodalee neta(f rrruronu1apt  fciyslmDea( o t4alenmo tatlatelu s;t0s2um(opoodomte feil(  2tmu pno1tpxomi3iad m2rlu p (4alxoif iytfm rlivi s) etm(mpiu4am nmfvi ()s2truro;u4oexniicils m2rmn s u) lxoiocoydlatrln olt) 2toim iy1llt mfvt sf 2rmumonu1tlen oetas a ua(vo;u)alxrmo3ta1fpt  u o;(0 eurxr3iy4lmte nciat  rurx oot1apxo fciasls rm(mp u0 rtnif3iotfptr ivil( trtmxm3no1alen ieia(fa2trurpot0aee  o3tls a ul(vp t) rxnxrciytop eaueolt)srtoimpiodomt  ieilt sDumx pnu4aetoiociadfm um(vo;t)aexrio iotom rluvil()s2uoimpnu4altemfetl()srtmx pnt1olxniietat m2eluvs;()trxoircoa1omtrlivi;(0srtrimpiy1ap   fei s s2rmx p;o0tltnmoeiydlm rm(mp t0aleomr3oy1fmteauei;(0srurxmpnudamenmfci s)aDuau poo0oetn iciad a umumo t4aexnxrcoatop   neo;s s2trim ny1optn fvtl()artru  nt1tex mocildfm2ul( s;u0arxoircty1om e u s s  etrxo3iu4ale  fcilt  Dtr(mono4oetoifeiysla2rm(vs;t)alxnmrcoydomDrlu ils)seurxmpno4lltnlfvsltfs2trxm ;t1aet  oeiytfa ulu s;(4arxrxo oydfmDeauvilt0s2to(mpoudap  mieilt) Duaxront0oleo ieilsfaDemu snu0alxoio ia1faDe n s;(0srur(rpnu1am   ivsltfaruaxront0oexnmicildlmDrmnvpn()trerir iatoateaiesl(0s2tmxr3oo4ll nlfesas s2tax pnu4apt  o3iltfm2ranmp;t4aexoiociytlaDranes;t  2umxrpiy4lm n ietls) rrm(rpoo4apx  i3ias m2emnmpnt)arxoir3io1latrau s;t srto(m3oo4openlnviat srurxmoot0tee  feiytfm uanvo t0 leoiocoatoa raivo;t) eur(rpou4amtn ietlsf Dtau pnu0aee ifeildfs2rl(ms () leomr tytlmtr u o;s0 rxmxmpou4op   nvia( arraxm ot0tle ioetysla2eauvsn(4aexomrctodfp  lnvils0teuo(mpny1op   fvsl(fsrumxmo;t0opx  oeiydfmDrmuvonu4trerxo3oytoat aneo s) etr(o3no4ol e iciat)a2umx  ;t1oexnmi3tltls2rmumo;t0trxrxrctodlaDelues;s s2trir oo4omee fvi t sruax pno4aleoiieiasfs rm(vpnu4texoxr3totfptranvolt0seuo(o oo1lp nlivi ()aDra(rp;u1olto i3iatlm2rluvon()trtnmrctodfat liei s s2toir oudole  fet tfsrtr(m ;o4oex  i3iyt s2rlu o t0texoio3io1fptran o;s)t2xo(r3oy1op n fvs ( srtaumpno4alxomfeiatls ra(vs u4tetoxocoydomDraneo (0tetr(rpoudopte feia()s2uaump;o0olxo iciydfaDem(vo u)teermr oydfpD  nes;( teto(r no4om e ivil()a2uau o;t1ole iiciaslaDrm( ont0altoio3oa1om eanvs s) 2xo(mpio4lmee ivsl( arua(r oo0opt iictlsfm rluvpnu)tleomo ta1fpt  i o;s) 2xoxrpnu1lltnmietat) Dtmum ;o1tlto oetysla2uauvo t) eermf3oydlm eln ils0 rtrxr io1am elies sfs2uaur ;u1aexomf3tltls2ra(mo;u0arxriocoo1lmt  uvilt0trtmim oodape  ietls s2um(rono4aptomfeias sDumuvp;u4aexnmo iatfa elu o (0tetoxrpnydame lnciltf 2umu p;t0tlxo ociatlm rluvsnu0aexoxf iatlpDeli o s setmim3oudopt lnetas a2tmu ont1alxomfeiadla ua( p;(0arenifcoodopDrlies;(  eum(r3io4ame  neilsf rtaumpoo0teto feiyt aDrl( s;u4 ltrir tatom  luvs;s0 ruo(opnudolt lfciat aDtmu oou0ope moctatlsDem( o t) eeoio iy1fmDe ivo;t0 rtr(m3oydal nlfct t a2ua(mpnt4alxoii3iatls rmn ont0arxoir3iytlmDrauvol(0 rxmir3iodapee nvsl() 2tm(  no1opxn o3iasls emu s;t4 renio iytfpD lu o () 2toxo3oy1ameemnvia(  Drmurpoo0tlt ioeiltfmDemuvs;u) lxoio3oy1lp  li slt)seur(o3oy4ap  mncsas)arra(rpno1aex io3tldfaDeln p;() rermo3oadomtrlivilt0 2xrxopiy1ape mfei tf 2tm(mp;u1alto oeildfm2ra( p (0trtoif3iatom raivs;()t2umxrpoudopt mncs ( s2raum no1tlen feilsls2rmu o;(4 rerxfctodfatran olt0tetmir3nodlpenmfvslt sDum(rp;o0tee iieiatfm ean p u)alenir iatomDe nvs;( t2ur(o3nu1am   fcta(faDrmxm oo0oee  feiyt s2umu o t4trtoxr tydoa elu ols trxoio ny1op elnci sfsruaumo;u1tetoioeias aDeaump u4alxoxfciodoa  au i s  exrio nydaptnmncs s) 2taxroou1aetn i3tytls2uln p;u4aetomr3iy1om  auei;s texrim oo4am e ieias) 2urur ;u4tpeomf3tadfmDua(ms (4 ltrmo3iatopD  uei;()s2toxmpny1al e iet t  ruru  oo1tltomo3tyt s rluvpn(4 rxomr3tytopt au o;s trxr(opoo4amte iesasfs2tax oou4oeen ociad m rlnmpnt0texoxociotoatrluvi t texmxm3no4al n nvt s srrr(rp;u4optoiiciys s2uan pn()treoxf3totom eluesls0texrxr no4amtn iesasfaDtr( pnt1aexnif3ildlsDul( o u)artomf3oy1opDr nei;s trurxmpnodal elfcsl() Duaumpno4tetnmieilsfs2emnvsn() etrif iadop elu s;s) 2ur(opoodamte nvt s srta(mono1tet  oetld a2el( snt) lenio ia1fatraneils teumirpny1optelnvsasf 2uaxr nt4tle mi3iyslaDrluvpnu0altrxo to1la  au i ()texmir ou1opt lnetatf Dtm( pot1tetnmfcilsfs elnvpnu4 exoxocoodfatelueilt  rurimpnu4lmtnlfei (fsrumxmpnu1tpto i3iatla2rmnmp (4tlermrcoatfatr u il( t2xrxrpny4am e iesasfa2rr(  no1tptnii3iltla2rm(mp;t) lxnmo ia1oa  lu o;s)sexo(o nu4omtn nvsatf rrrxm oo1aptnmieiydla rl(mont4aetrxf3iodfptraivo;() ruoim iu4omtnmfes sfsDrauro;u1teenifctld aDem(msn()texrxf3tytfaDe u i ( s2toirpio1lptemfctls s2ra( pou0tpen ociltls2emn o u4 rtomo oy1om eaneilt  2urimpnydop nlivil() 2taump;t0aleomieils s ra(vs (4 lxrxr oadopDran s s) 2toir3iu4om emncia(farurxm ou0tpeoiicilt mDeau o u)tleomrcia1lmtran ilt0srtm(o3nydapt  ictlt  rtr(mpou1aex ioctytfs2um(mpnt)arxrmfciotfa  livol()trxo(o3ny4optnmicslsfa2rmxrp;u4teenii3tltla rl(mp (4tetrir3oydlpDelneil(0trtrxr iy4aleemfvi () Drr(roou1aetomocild sDrl(vo (4aeenif3oa1op  aueslt setr(rpio4lme  icias a2taurooo4tpeomo3ild m elnvo;u)altrxf oodfp e n i s s2xr(r oy1optn nciatf 2tr(m ;u0aee  i3ias m umn snt4tleoxocoytfmDr n olt0srxoir3oy4olenlivslt)aDrrx o;o4ole if3tlsfs2eanmsnu)alxrxfctatlptraivols  rtrxm ny4apen fesls aDtm(rono1oltoifetad a elumont4trtrxr3oo1fm raueilt tetrxo3ou1lm nmnctls) Dumu ont1alt iiciatla rmuvonu0 exnirciydopDrliei;( srtm(mpiu1lptelici sfsrraxmpnt1aleo o3tldlm2emn s t0 lermo oa1fpDe n i t srto(mpnydlpt  nci t sDtruro;u4ale mieiydfaDrlu s;t)areomr3totopDeli i;s0 rxmirpou1olt mfcs t srtm(m ;u4opx ifciydlmDra( o t)artoir io1fmtrlivi;(0s2umxrpoo1omeelfcsas) Draurooo1aet iieilslmDeanms ()arenmrcoy1lp r iesl()trumir oo1lmtelnesl(f 2tr(r no0apx if3iad a2ul(vpnu)altoif3iodfp e nvo;(  2xrxr3ny1al emfeiatf Dtmurp;u4aetn o3iys m ulnvs (4aexoxfciadfate uei ( srxm(r oy1lpenmfcs s) Dtaxm ;u4olxnmoctld m2ean onu0aetrxfciadoa eauei t0seuo(o ou4amenlfei (fs2um(  oo1tleomicildlsDranmont4tetnircoa1la  au ols trxo(o no1ope lfeia( sDtaxrp;t4oee ifcias sDea( p t4tlerxocoydfat lueo;t sexoim iydap nlfvs s)arua( p;u0oeto f3iydfsDrm(vsnt4 lxnifciatlp rlivs t  rur(o ny1llee nei t) Drrx o;u4alxn oeiatlaDem(vo t0 lenmo3tatomD  ieilt  etoxrpoy4altelfvil( a2rmxmo;o4oet ioetat aDua( s;u0trtomocoatfm eaueils setm(m3oo4ol nlfcslt) rrrur ;t1opxo ieiaslm emu s t) ltrifcto1opDrauvils)sexo(m nydapen fcta( arumur oo4oexn o3ild s ul(mp (0tltnxr iydlp e iei;()teumim3nydol  mnci s  rua(ro;t1alt if3iasfm2rauvs u) eeomf3iytoaD livi;() eum(mpou4ame mnvsa(  2uau pnt1tpxnif3iyt sDulump u4alxrif3ia1opt ai s ()s2uo(o3iudll   ivi () Duaum ou1apxn icilsfs em(vs u0 leomf3oa1lm  auvo t0tetoimpiu1ame mnvtls) 2ta(mooo4teto oetadlm2ea(mp t)alermf3totoatrau s;(0srxo(m oo1ame mfvi (  rtaurooo0aee  i3ilsfsDumums;u4 rtnmf oodlpte u il()trtr(opou1lltemnct s sDrrxm nu4apenif3tyslm2rm(vo ()artnmr totlateanvils0t2urxm oodal e icils sDtaxro;o4oex ifcilsfm rlnvonu)texoxrciadlmtr i o ()srtr(m nodaleemietlt) 2umum oo4tpx iociat m2rmn snu0tetrxo to1oat lieolt t2xmxopiy1lmt mnvi (farrm( pnt0ale mietltls2raump u) rxomr iatfaDrlueo (0 exoxr3iudllt micia(f 2umu o;t4tlx  oetas m2rl(vsnu0trxnifctytoaD  n ilt)s2ur(rpoy4al  liei ( sDtr(rpnt4texn i3iytlm2uln pn()altrmo totomt ln il(0 etriopno1opt licilsfartr(  ;t4oee  f3tydlm rl(vont0tleomr oadoaDrlivo;t0 2tr(o3ny4lp  miet s  2rrxro;t4oet moeiyt sDrln snt0trxrmr3oy1laD au i;()s2trim iodaptn ncils aDururont1aexnmo3ild mDrauvo () exoirciodfp r nvil(0sexoxo3ou4amt  nvs s a2raumo;t0oetn ictltfsDua(vsn() rxnirciadomte uvils)trxoxo3oo4al e icsa(farrmu  oo1opt  iciat aDuauvsnt0tltnircoatlptelu s;s)tetmxo3oy1ome lnvs tfa2urx  ;u0olx ifctad s2umnvsnu0texomocty1lpteli i;s)s2urxr no4am   ivsa(fa2rrxm ot1opxomfctad s2rl(mp;(0 lxnmr3oadfm  aivo;( sexriopio1olt mnet s)sDtruroot4oet  iciadfs rl(vpnu)aetomfciotlp eanvo;t s2urim3oy4lptemfvsas) rurxmo;u0opxn fciad mDel( pnt0trtnxr oo1faD lnvs;t0s2xmio3io4lle mnvt ( arrrump;u0oltn o3ias m2ul(msnt) ltrxr iadlpDelnvs (0t2tr(rpoy1amee ncil(  Drrxro;o1tlxoiietyd m uln o (0 rxomf3ty1fptelnvo s trtrxm3oo1llenlncs ()s2ra(  ;u1apenmo3ilsfm2ulnmon()teenio ootfmDr i s t0 rxrir oo1omt lfeia()sDur( p;t0tlx mf3iysls2ea( on(0 renifciadlmt li o (0 2um(m3oy4omt lietasfarta( ono4tpe  oetls s rmn s u0trtnxf3oatlmDranei (0teumxmpiudalt mnvtasfs2tau  ou1apenifeiltlm ranvsnt0 rxnxr3oadoaDeaueo;s)s2xrirpnydomtnmiei s aDtax  ot4aet  ietytla2elnvpn(4tltnif iy1lmDr i s;t seurxo nydom  micta()sDtauront1aeen oeild a rm(ms u)arxrxr3oo1faDr nvs;(0 eumim3oy4alen fciat) Dumu p;t4opt mieiyt sDum( pnt)tltrmrcoydfa e ivs t  euoimpiu4llt mivtat aDtaump;u4aptnmoctldlmDum(mp u)aleoxfciadom  lneils0texm(opou4optemivilsfsDurxr ot4aleoioeiasla rlu p t0artrir oytlptr ivolt texoxo oo4lpe mfvsl(f rrr( p;u4optn iciyd aDel(mp;u0altnmo3ootlmDeanvi;t0s2tmim3iydllt lfcils) rrrxr ou1aex mfciatfs emnvs;u0 rerxr iydfpt  uvs (0s2ur(o oy4lpe mici s)srrmxr nt4tptn f3iadlm2rlu s;u) reomf totlmtrli o;t t2um(o no4om elivs s  2rr(mpno1opxomi3tytlaDeln s u) rtoir3oa1oa eln s;( trtmxr nu4altnmiei (fsDumu pno0open feiyd s ulums u4tleoxrcta1op elueolt)s2trxm oudam n ietas sDuau pno4teenioctlslsDeln s (4 rtoxr tatlateaues;(0 2xmxr3ny1lmt mfetlt)srtmxrpnt4oeenii3tlsls2rl( o (0trxnxo3iytfmtrlu o;()setmxm oy4opee iesl(  2umu  nt1alxo f3ilt sDelu o () etnifctydfp ranvi;()s2urxrpiu1lp nlfei t a2rmxrpoo4tpt iietatlm rl(vo t0aexnir oo1oaD  n o ( s2xr(r3oydapt mivilt)sruaurpnu0alenmoctasfs2ranmp;t4aexoxo to1faDeauvo s0s2umxopoo1om nlfetltfa2uaum ot1alenmi3iltlm ra(mp;t) ltnioctotop   u o;(  rtrim3ny1altnmfeta(fsrtrurp;t1tpxn o3iadfm2rln o u4aleniocoodfmt lu o (0sexoim3oo1optn fvsas a2trxmoou1ape ii3iatfa ra(vp;t0alxoioctatomD ln o;(0 2ur(o no4llenmict sfaDrau pno1oeto o3iyd s rl(vs t) lenircty1om rli o;(0trxrxr3iy4oleemnetas)s2rrumpnu1aex if3tatlaDua(mpnt0trtnif oydfpD livols truoim3nu1omt  ietlt) rua( pot4opxomi3ildfaDrl(mpnt0arxrmo3iydlp e u i ( teur(opoy4amtnlieils)arraum ou1optnif3iytlsDuan p t4alerxociadfmD lnes s0 rtr(r3ny1lmenlnvi ()s2tr(mpot4tpe ii3iydlsDum(mp;u4 rtrxfcoy1opD  ivo t0 rxmxmpoo4optelncias)s2tru  ;t0olt  ociytls2ua(mo;u4 lxrifcootoa   i i;t t2to(o ou4omtnmfvi (f 2raxrp;t4teenii3tadfsDua(vs t)artrio3io1lpDr nvi s0teto(o3iydapenlict ()arurum ou4ape mo3tldfsDemump u)tlxomo3iy1fmDrlneol(0tetoio ou4llenmicia(fsrrmxroou1ole mo3tlt a uanvo u4 lenmrciytoa ranvi;( texrir3iodaltn nctltfa2um(mo;o1aleomoctad s el( s t4tetnmr3iodlate nvols) 2umxrpoudale mnvil() rtaxm nu1altnmiciadfa ea(vo;(4trtnxo iytlmtr ivi;(0truoio nydomtnmnesat sDuax oot4olxnif3iytfmDrlu o ()treoif oa1fatelneolt0 eurxmpio1am nmneiltf Dta(rpoo1teenmfciytlaDumump t)aexrxr3oatfm rli o;t0 2xrio oudam n ivsasf rrmx p;t0aleomi3iyd s2umnmp;() rtrir3totfmteauvi ()texrxo3nydlpenlnetatfaDuaxrpot0ope ifeiasfaDua( s;u0texoxo iodlpte n slt)s2xm(opoy4ap e fei s srrmumpoo4aexnmoctytfsDuln pnu4 rtoirctatfmte u il(0 2tm(m3iy1om n nvtlt) 2tru p;u1alt  o3iad s eau snt0 renif3to1op  aiesls  rum(r3ou4lpee feils)srrru oot4altomo3ilt mDem(vs (4arxrio tadomDelivil() ruo(rpny1op e iei tfaDuaur nu4oeeniociatfa rmuvo t)alxoxo3tytfm e neo;s  eurirpiy4opt  feiat)aDtrxroot4opxoif3tltlmDemn s;t)tlenmfciydoaDeliei;(  rxoir iydol nlnvtlsfsDtaxmpnt0opxo iciytfs2ea(mo t)trenxo3oa1fmDe n s t)s2ur(rpny1lmenlivtasfsDurump;t0teenioctytls2eanvp;() lerio iotoa  lieo t0t2um(m ny4aleelfeilt aDtm(mp;u4apenifctls m emump;() lxoxocoydom rlu o t) rtrxr ny1lp n nes tf 2taur ;t4tpxnifciytls ea(msnt) rxrmrctatlaDrlivolt) rxmxrpiy1lmte iesltfartau  ot4tlx ii3ilsla ra( p;u)tlenmf3to1la   i s;t trtmio3ny1ol e ictlsfarra(rpou4olenmo3ildla2rl( o t)tlxnir iytfaDeln ilt)t2tmxo3oy4lp elivtasfaDtmu poo0openio3iys a2eau s u)arerxf3iy1faD livi t0t2urimpoodoptemivs (fa2uau pot1alen ictlslaDean s;u0tlxomr3ty1lm e uvi;t0 exmxmpny1apenlicta(fs2tax onu1teto ociysfa em( p;()alxoxocootlpt  uei;s0 rumim3nu1opee iesa( aDtrxrp;o0aetnmictasls ra(vsnt) exnxrcta1opteluvolt)srxr(mpnu1olen ncs s) 2rmxrp;o0oexn i3iydls2em(mpn(0artoxfciydoat livs;t t2uo(rpnodap nmnvsls a2tmxmp;o0texomi3tydlm rau p;t) exnir3totoa rlueols0srtoiopoydom nlfvias)s2tmu onu0apxomoetytfaDrluvo;t)trtoircty1fmD liesls)srur(o nydap   icsasfaDraxrpot1tetnmf3iydls ranms ()tetrmo iadoaD  nvi;(  2xmxo3oodal nlnvsasfsrraurpou0olxniieiaslm elu p (0teenioctodfaDeli s s trurxmpnudol emnvil(  Drrur ;t1tpeoif3iltfa2ean o;u0arenmfciy1optrluei;s)t2triopou1amt  ieilt a2tm( p;t4oleoifeiyt aDea( o;t4treoio3oydoa  livols s2xrxrpno1opt  netl()s2uaumpno4texn iciltla ua( p () eerxr oytfm ran i;()trxmim3oo1alen nes ()s2rm(rp;o4opeomf3ilsfaDum(mon()aetnif3tytlp eluvo s srxr(m3iy1aptemieias)arrr(mono1oltnmfciatfs2uaumo;u0tlxnxo oydlmDe ues;t0 etm(m nu1lpt mfei sf Dua(m nu0tetn ietyt m2ulums;u0 eeoif3ta1fat lueo;t) 2xo(r nu4om e fesa()aDur( oou4altn ieiasfm2ra(vpn() exrmf3oydlm  luvs (0setrxm3nu1lpe  icsa(  rtrxr nt1apxnmiciad m2raumsnu0texriociadop r u i ( srxrir iu4apt mfcs s a2raumpot1aexoiictaslm umuvsnu) lermo3tatlp elueols0srxmxrpiy1lltemnvilt  rurxr ;o1ope  o3tlslmDeln s u0artoifcootfaD lieilt s2uoim iy4am n fei () rtmxm nt0ale  iciadfm2rl(vpnu)artnir3ootfate iei;s texoiopoudop  mictlt artaxr ot0apxnifciyt s2emumo;t0 etnxo3oa1fa  aivilt srur(o iy1omte nvi s a2urxr ot1olto oetysls ea(mo (4tetoxf todlpDe ies;s)setmxm3iydomt mnvils) Dra(m no4aetnmfciytfa2ranvp;t)aeerxocia1lmDrlivo;s)srurxmpiy1lm nmnvt s aDuru o;t1tlxoioeiatfs2um( snt) exnmr3iydfm  ln i;t0t2urio3iy4llen netasfs2urx  ou0opt mieiytls raumsn() rtnir tydopteli sl(0 rtmxo3ny1lptnlfvslt  rra(  ;u1oleo ietytfaDemn pn(0 renxr3oa1lp r n slt0 rum(o3iy4ame  feslsfs2tmuronu1alx iocilslmDum( p u4 rxnxr3ootfa elivsls seur(o oodaltnlnvsltfa2tr(r nu4tltnifetlsls2elnms u) lxoio3tytlpte nes ()s2xmxr3oodlp e nciat  Durxm ot4tpt mi3tyslaDem( p;(4aexomf3ootla rlu sl() 2tmxr oy1oleemieslsfs2truro;t4aeeoioeilsfm2ean sn()tltniociotlaDr uvol() 2ur(o io4lmt mfvt () Drrxrono1aet mieiad m ean p t4 exoirctotlm   uvi (0s2umimpny4ome mnct s) 2tmump;t1oetoii3iltlm2ran o u0alenmfciydom  luvsl( srur(r3no4omtemfctas)srrmu  no4tet mo3tas sDuauvpnu0aetrio to1laDrlues;( srurio3iudamt miciatfsDra(rooo4olt  feiytls umuvsnt4 ltomo3ia1lp eau s t)tetrxr nu1amee fei tfs2tm(  no0olt io3tytlm2ra( o;u0tlenmfciodfatranvs s)t2xmir oo4alt mfvil(f rtmx o;o4altniieiasls2umumo;t0alxrio3oadopDr u s t) etoxm io1opeelfetatf Dtm(mo;u4ale  o3iad s emu s u) ltnmf3tydfm eauvilt0 exmxm3no4lm nlnciltf rrru pno4aptnmieiadfmDra(vo (4treoio3iytomtean o ( t2toxr iy1am  lici ()s2ua(r nu0ole ii3iyd m eanvo;t4tlxnir tytlpt  uvols0 rtmimpnydape  fcsasfartrurp;t4tltoif3iasfaDea(mon(0tltrxo oatopD lneolt  2urim ny4omtelnes t)a2rr(monu4aee mfciydlaDel(mp t) rxrxr iodfa  livsl() exoimpoydaleemnvsasfa2urumoot0aeto o3tldfa elu o u)arxnmoctatfm eln i s)srxr(m3ny4apt mnciat aDua(mo;u4oltnmiciltla em(vsn(0trxrif3tydfp rln i s)seumxm ou4omtemfes sfaDtmumpot4tpe mfctatlsDua(vs u)aeerxf oydlmDe uvs t)sexm(m nudoleelnvsl(fa2tmxmp;t1optn octysfs ea(vs (0 rxnxo iydlm eauei;t0t2uo(opoo4ope  ictasfsrumx pou1alt iieils s em( p;t0alermfcoo1lm  lnvsl(0 2tm(mpiu1open iei t srrax  ot4opxomfciltls uan snt0aetnifcoatfa e nvs t0 2urimpoodomte ncsl(fa2rrxrpnt0oltnmoeiad aDuauvsnt4alxnio3to1fmDeaues;t0teuoir iy4om nmnes t)sDtrxm ou1aptomictyd mDra( o (4altrmrciy1fp ran sl( trtoir iudape mfcsls)aruaxr nu0tet  f3iyd sDrlnmp;u)alerxf iy1lpt  nvilt teuoxopio1lme lnvs s  2umxmp;u0tpxnmo3iyd s2rluvs u0trerir oydfp rluesls)seuo(r3nudaptnlfvt s arum(  ;t4apeniocilsfm umuvs t0alxnmr oytom  ln o () 2urxmpou4lm elfvi s artr(roou4ope mo3ias sDem(vp;(4 lxomo3iatfmtrauvsls sruoxopny4lpe  ncils)s2um(ronu1oex mi3ils s emuvp;t0 lxrmf oytfm   nvs ()s2xm(r iodolenmfesat  rua(  ;u0teen fetld mDeln p;t4arxnmf3tadfm eau s (  ruoim3iu4apenmncilt sDrrum ;u4oee mo3iydlsDemn pnt) reomf3oatlat lnei s  2trxopio4alt livt t s2tmxmpnt4tle if3iydfs2rlnvsnt0aeenmfcio1fmteai o;s0t2xrxrpiy4al e fvs s)aDtrumo;u1aptnmfcild a2ua( sn(4trenxocio1om e i s;s)t2urim3oy4opt lnci sf 2uaurp;t1tpt mo3tyt a umn o;()tltrmf3ty1oaD ai ils0srtrio oo4omenlivsa(faDuru o;u4ale if3tlslaDeluvsnu)tlxrxrcoydoaD  ueo;t  2trim3oy1omtn fetat) Drmumoot4aexn fetlsla ra( s;(0trtoxo iadlat  uvi;s)t2urxr3io4ap n feils  rtru ono4apt mfctlt a2umumo u0artrmocoo1fa eai olt)srxm(rpiu1am nlfviat)s2tru p;t4tlxniietltlm2ulnmo;t)altnmfciadfpt  uvsl(0s2xoirpoy1ol  mivs ( s2rr(mono1alt  feildla2rau p;t4 lxnifcoo1lptrau s t)teumio oy1altnmfes (f rua( o;t4tpeoiieiyd a ua(vo t) etoxf oo1fatr nvils) 2xo(rpiudameemfvias  Dtmum ou1apeoioeiys m2um( o u)alerif3iy1oaDe neo (0s2umxm oo4omeelfvilt a2ta(  nt4aetnio3ils m emnmont) rtrxrciodopteluei;s teumirpio4olenlfvslt a2rm( pnu4aet iiciltlm elumpnu0tlxoxf tytom elnvs s)t2xrim3nu1om elnct sf 2tmxmono1aleomociydfm2rm(vs;u4artoir3tadoa eauvol(0s2ur(opoo1omt  nvil( a2uaur ;t1oexo fciltls2uaump t4 rtoxrcoydlpte nes ()tetoio iu4llte net (farumx  ;t4texn ociyd s2ulu p t) rxrmf3tytlpD  u i t seum(mpnu4apeemnci sfsrra( ono4alx if3tysfaDemu s t0tlerxf oadfmteai s s)sexo(o3io1ope  ietl(fsDtax o;o1oltnif3iysla rl( s u0trtoxo ootfp e i ols sruo(rpny4ap emivtl(f rtrur ou0olxnmoeiyd a2ea( pn()texoifcoo1lpteai i;s)t2tmxrpoy1om elnciasfarum( onu0apen fetadfs2eanms;(0aexnxrctadfaDrlivs;(0trxrxopno1ap e ics tf rrmx  nt0ape  f3iytfa2ulu s;u4 renio3totfm eauvs;( tetrxo3io4ap elicsat a2raxmp;u0aeen feiysfmDeauvo;t4 etrxr3oy1laDr nes;( t2ur(mpoy4lmenlnciltfsDtmx oou1tltomfeiatla2eaumo (0altnmrciydlaDe nvol()srurxm ou1omt  ieslt)arrmur ;u1aee  ietyslm ul(vsnt4 rermf oy1late ivils0 rtriopoy4lp elivsatf rua(m ;t0aee iiciaslm2em( on(4 exnxo oo1oa  anei ()trtrxm iy1al elivi tfarraxmpnt0tee mfciasla2raumsnu0aeenircoy1oaD lueil(0t2tmxopiudllt  ictat)aDtm(ront1oex  iciydla el(vpn(0tlxomr oo1lpDrli s s)seto(o ou4amt lfctlt aDtaumo;t1altnifciltls rlnmo t4teerxo iytlaDe u i t)srtm(opiudal   fvia() Dtmu  ;t1olx  o3iatfs rmn p u)altnmr iytla   nvsl(0s2xm(o ou4oltemfvtls srrmx poo1alt mociys mDrmumsn()alxnxocia1oaDraieo;t t2toxmpoodomtelicsatfsDumx p;t0tpxniictysla elnmpnu4texoxfcia1opDeli i;()texoxm iu4apeeliet s)aruau oou0oleo o3iadls el(mpnu4trxoxf oadfat luei (  rurxm3no4lpenlicsa(f rtmu oot4alenmf3iyt s ran s ()trerxo iytlp elnes;()srtrxo iy1ape mietl()a2um(  nu4alt  i3tlslmDeluvs;u4teeoif oy1la eliei;t)sruoxo oydolenmicilsf rumum ;o1opxo ociyd s rlnmp (4tetomr3iodfmt lieolt0 2xmxr3oo4ame  fesa(fsDumurp;o4oetnmoeild mDumuvo;()areoxf3iatfmD luvs ()truoim no4openlncsas  Drm(mpou1apeniocilslmDuanvp;u)teenmf to1fp   neo t  2toxm oo1amen icsl() rtaxmo;u0aet io3ilslsDuan p;u) leoxf3tytomt li s (  etr(r iydllt  fesls  2tmum ;t4tet if3ilsla uaums;(4 rtrxfcoy1fa rluesl(  euoxm3iudlleelfes (fartmumoou1olt mieiysfa ua( p;()tetrif ootopDr nei;()tetoxm oydlp nmneia(f Draum nt1olxn ietldfa raump;t4alxnio3iotlateai i (0trxmxr iodal  mics tf Dtm(m ou0tet mocilslm2rau o;(4trxoxo to1fptr neo;s trur(o3nydllt mfet t arraur ou4tpe  f3ilslm2uluvp (4arxnxf3oatfatraiei (0srto(m ou1altemnvsas sruaxroou0tee mo3ildfm2rm( snu4teenio iotopD ln i;s0t2uo(r no4lltn fei (  2ur(  ou1texo ocilt aDrlumsn(0 exnxf3iytoaD  uvs;t0 euoim3iodap  mivtl( aDra( pou0aptoio3iltfs ranmpnu0 etrxfcoodoa  an i;s)s2xrxopny1ap elfvslsfaDumxrpoo0olen fciasfsDelu snu0arenxf3iytfa  lnvo;s  rxrim3iudap   fvtat s2rmxrpnt0oex ii3iadla2rauvsnu0aexoiociydoaD aieol()seuo(m3ny1omenlfeta(f Dtr( oot1alx  f3tat mDrl(monu0texnmo3iatfat  i i s)seuoxo oy4amenlneiasf Dtax pou1alxn oeiltfmDrmnmo;t0 rermo3iatla rli o (  2xo(rpiy1om nlfcsas aruaurpou1tlxomieildfsDua(ms;u)tlxrxf3todoaDr neils) rumio oudlmee nei s)sDrr(m no1tpto o3ilslaDem(ms;(0aeerxfciy1fmDe neil()srxoxm3io4al  mneia(fa2tr(m ;o1opxnmf3tltfmDrlums;t0 rxrifcoatlpDrln s;t s2xoir iudamtnmictl(f 2ua( oot1olxnif3tatfa rlnmo ()tetoxo tatfateln s ()truo(o iy1lltn feta()aDraurpot4oexomfeiyt m ra(vpnt0tlenxr todfm eln slt0sexm(rpou4opt  fciasfarrrumpoo0alenmiciyt s2ul( snu4 reoxo3totfmD  uesl(0teuoim oo1omtn ncia(fa2rax o;o0aeenmietat mDeanvp u)teeoxfcta1laD lnvs (0 eumim3iudlle mict s)aDrrumo;o4tltomfciyt a emnmo;u4trerxr totlmDeln o t) 2uoxm3oo4am e nctlt)srua(  ;t1aleniociat mDum(ms u4arerif3ta1faD  ues s)srxmxr nu1omeelietl()s2truront1optoio3tytlmDelumsnt) renxrcoytlatr nei s0 2urxo no4amen fetat a2tmxmonu4tlxomfetasfa2ua(mo;t0trxrmfctodfmD lnvs t srxm(m3iu4oltnmfvsls sDrr(rpou1apxn fctad m2rauvo;t4tltnir to1omt au olt0s2trim no1om e ieiat) 2rrx  ;u0aexnmocias sDrlumo;u)trerxocoadomt  uvo t0seumim3iudlm e ieils)a2uax p;o1tlxn ietadfm eln s t4 eenxf ia1fpDeaiei;s t2toxm ny4aleelfeslt)s2taxrpno1tpenmf3ilt s umumont0arermo3tatlpD aiei s t2tm(mpno4op e nctatf Duau pnt0optnio3tld mDulnmpnu0 etrif oydla r ieo;t0 exrxr3iy1op   ivslt  Dum(m ou1tptn oeilslmDrau on(0 etrxr3oytfmDraivi t  exr(rpio4op nlieiat) Drau o;u0aeenmfctasfaDeaumsn()tetnmoctatlpDeauvi;s0t2xm(r3oy1om n nes sfs2truro;o4aexomiciat aDemn p u4 etoiocoatop rlu sl(0srtm(m no4lm  lfvsas) rtmxr ;o4aexnio3tadfaDuluvo u) etnxrciadfmDr ivi t sexoirpiu1omte nvs ()arumx pot1tlxniicildls2rauvs t4trenio tadfmD lieo;(  2uoxo3oydlmenlfct () rtmxmpnt1aptniictysfm2emn pn(4 eenxf tytfm rlivi;(0 eto(r nydolenmfvia()aDuaxrp;t0oexnmietydfa um(mp;t0teeoxf3oo1optelnvolt0trxoxr3ou4lp  lici s s2rmurpoo4tpxomiciyslmDraums (4 rtomociydfpt aies ()trxoxr nudale mnvtl() rtax pno4opt  fctltfa2ua(mpnt4 leoir oatfa eau o;s) euoxmpiy4lltelnvil(  rrmx oou4alxn ocias s eluvs u0aleoxociytoatrai ols)trumxrpiodaltnlnvia()a2tr(moou1apen ocilsfmDelnmsn()arenifcoatlmteaivil(0 eur(mpny1lp   nvt ()a2rr(  no1apt  o3tltfm rlnvsnu4 rtrio3iodlpteluvs s)texoxo iudlpee ivi sfs2rru  nu1oleo fctydlm2uluvonu0tleoxo3tadfatraies t t2tr(o3iu4apt lnct ( sDrmur ;o0apt mi3ildla2ua(vp u4 rxnir iotfmDrln il()s2xrxm3iodome  fviat) rrmxrpot0aetn ociyt aDem( sn(0 etoxo3io1lpDeaieo;( trur(o nu1ape  ncslt) 2tauront1oeto i3tyd s elu o (0texrxfciytopteln s s) 2xmxmpnudaptnmiesltf rrm(mpot1tpxomi3tadfs2ulu p (0 ltrif3tytoaDeln o t)teuoxo nu1am n iesl( s2ur(  ot0oet iicild mDea( o;(4artnif3ty1faDeln ols s2xmio3iu4op nlivtas)a2ur(  ou0olt  ocildla rlumo;t0 rtrmfciatfp e nes;t texoxmpou1apee nes (f 2taxr ot1tet io3ildfa umnvs;(0trtoio3iydfatrln o ()sexrir iudomt lnet tfa2rmu ont4aexo ieiytfsDrlu p;t4alerifctatlmD lnes ( texmimpnydol emict t sruax  oo1aetoifetlsfs el( pn(0artrmo3oytlpDe ivo;(0s2urxo3nu4olte feilsfsruax poo1apeomiciadfa2ran onu0 lxomfciytla  lies s t2uoxm ou4optemivias arum(r ;o0oet  o3ild sDra(von(4tlerircoatfa elivsls)t2xoir ny4amt  nci ()sDraxm ;t1oleomi3iltfs emuvo (0trtrmociy1omDe iei;s0s2umim3nu1lm e nei ()s2trxro;u1apeo ictlsfs2elnmpnu0 lerxr3ootoa rln s s  rtrimpou1omee ivtat arurx o;u0optoioctydfmDra(vp (0alxrxfctadoatr ues t0setoir ny4lpen nvt s  Dtmxrpnt1alen i3taslaDrau p t4aexnmr3tadopt aivs s0 2uo(o3nu1lp nmnctls)arumxmp;u1apx mf3tad m emu s t0 rxrmf tydlmD luvol(0trtmiopiudal nmies (f Drr( pou4tlxomf3tadlaDean snt)aeeoxfctatlmtr nei t  ruoxopny4lptelictlt srumu  ot4tpeniictyd sDum(vs (0 ltnmfctydlaD lu o s  etoiopnu4llen fet (farua( oot4ole mfctad m rmnmpnt)arxnxo tadlp r i i;t0 exmxopoo1ll   nvtl() rrr(ro;u0oex iocildfa em(msn(0trenxr totlaDelnvils0sexo(r3oudameemfvia( aruau p;o1optomietyd aDrlu s;t0 ltrmf3ootfpt lueils sruoxm3io1lpe miet t)arum( pnu1apt ioctytfa2ua(vsnu) exrif ia1omtrlivs;( tetmxm3oy1al elfeias) rrmx o;o1tpe moeiyd s umu pnu4 etoioctatfpDe i i t)tetrxr3nudol  liviltf 2umxrpoo0oetnmi3ildlsDumnvp;u)alxnir3iydlaD anvo s  etrio3ou1lmt lfvslt aruauront1tpeo icildla2emuvo;u)aleoxo ia1laD lues (0 etrxrpnu4lm n ncs t aDumump;t0ale iiciadfm2rauvs;u0 rtoxocia1lp rln i;s trxrir3nydopenlnvs t  rra(m nt4tlxo i3iltfmDel( p u) lxnir3to1fmtelnvo s)tetmimpnu1aleelietlsfartau  ;o0olxniicilt sDrmnmsnt0aexrmr iatoaDeaueil( t2tmxm iodal elivt t sDuau pot1tet  iciad a eln p;()altrif3tytopDr u i;( s2trirpoudop   fctl( s2rau  ot0tlxn oeils aDua( sn(4aetrmrcoy1fpDeanvils0 2xoxm oudom  lfvtltfa2umumo;o1aeeoiietltfaDran on()aetomf3iadlm r nvi t trxm(r3ny4alt licilt)aDrauront1alt miciysfs ra(mp () etrxr3iy1lmt lnes;(  rtmxrpoodom emnet s)sDtax  nt1aexn iciadfsDemu s (0 eeoxocoadfa e i o (0 rtmiopoy4llt lics s)a2rm(r ;u0aexnmictadla rmnvo;t4 ltnxf oy1omteau i;t0s2uoir3ou4oltemfvtls  2tr( pou4texnmfctadfs eaump;(4 lxoio3oadlp elu s;s) rtmim3no4lpee ictl( sDtm(r ot0tpxnmfctysls2eau sn(0trtomr3oatfp rli o t0s2urxr3iu1lm  lnctl(f rtmur ;t4apeo ieiysfmDrlnvpnu4altoircoatlmtelieo t)sexmxo3oy1lptelneil()sDtr( ont4tpxo oeiatlsDeluvp;u4 exoxrcta1oaDeau i s  exr(o iy1am  lnviltfsrururono0tle mo3iytfs rmn p;u4 lenxfctotfatrln o;s texrio ny1om n ivsas) rumur oo4ape  feild aDrm(mp (4arenxo3oodomtelnvsls)srtoir nu1al  lfvia( s2trxr nt1texnmfetadla2rlu o t0 eenif oy1lm e n s;()teum(m ny4al  lnciatfaDtrxr ;u1teenmi3iysfm umu s (0altnircoatfp   n slt sexrxm3ny4alte ietas)s2uaum ;o1tpt miciys sDulnms u0 rtomr3oa1optelnes (0t2xmio oo1op elnvt () rrmxrpou1apx mo3tys s rmnmpnt4aetoxo3totlm eln sl() etrxo iu4lleelnei tfaruax pnu4opxomieiatfs emnvp;u4aeerxr iy1omtrln ol( srxmxrpiy1olt mfcia()sDraxrp;t1tetnii3iadfm2ranmo u4aeenio3iodfm eaieslt  eumxm io4apenlfes t a2rrxr ou0tlen ieiytfm eauvs t)aexoio3oodfa rluei;(  2trim3oo1ome mfesltfs2rm(rp;u4altomoctldlm2ulnmo;(0aeeoio ta1om  lies t) rtmxrpio1lmen nvs tf 2rau  ;t0tpx  o3iasfm2ea(vp t0arxnxr3tydlmDelivil(0 ruo(rpiydlltelies t arrrurono4tlx miciyslaDelu p t4 exoirciy1laDrli il(  ruoim nu1ope lieil(fsruax  ;u0texnii3iytlsDuan pnt) eerxo3ty1fmDr ueo s0srur(o oydop emncsas  rumxm ot0tpen o3tyd a2eau s t)aexrxf3tadoatrai sl()trurim nydolee nei s)arrm(r ot4tptoifctatfs rl(vonu)texoxf3oytfmDraieilt0t2tmir nydopee fet t a2ra(rpnu0tpeo fetydfs2rm(vsnu) lxnxf3oa1lp rluei t srtr(r ny4oltnlnesltfsruau  nt1tlto feiysfaDemu p t4teeomf3tytfaD  i s;(  rxo(r3ny1lltnmnciat) rra(mooo0tee mf3ias m2emn pnt0aleoxo3to1fmteauvo;s0sexmxm3io4lpte nvs (fsrrmxroou0oeen f3iyslsDumumpn(0 etnxo3io1oat auesls0seto(opnu4alt  nvtas  Drrumpoo0tet moctas m2rmumon(4 eermr3oadfaDe nvo ()srxm(o3nodlp n fcsltf Drru o;t4oexniieiyslmDem(vp;t4trxomf3iotlate nes s0s2xm(m nudape  ictl(fsrumx p;t1tpxoiociysfs ra(vs;(4trxomf3iytfatelnvo s)s2trxopoy4op n nvia(f Drrump;o4tex iociltlmDrmnmon(4trxrmo oo1fmD anei s0teur(r3iu1am nlnvil(  Durur ;u0openmfctlslmDuluvp u4trtrmo3iatfmtelivo s)sexo(o3oo4aptnlnvs t)a2rru poo0tlxn ociad s2eln s ()tetrmr oatfaDraivo;( texmiopnydlpee iesl()a2uau  ou4teenmoeilsls emnvsnu0texoifctadoa  ln o;t)t2xoxo iudoptn nvsat sDta(  oo1alx  ieils a2um( on(0 rerxfcio1lp e iei s) etmim no1ol  mietatfaDumxro;u0tpenmfeiytla rauvo t4tltrircio1omD auvs ()srtrxr oudop emieilt sDuauro;t1oeeomfetasls2uaump;t4alxoio3iytoaDraueols  exo(mpiydllte nvt s)sDrrxm ;t1tlt mi3ilt s ul(monu)tetrio tadoatran o t t2uoxm nu4lmenlfvt s) 2rru p;o4alt ioetasls2ua(mo;()artnif oodfptrlnvs s0 2umxmpnu4om emieslt s2rruroot1aptnmoetys a2ulnmo;u4teenxf3iadomDelu ols setr(rpiydlmtelicsas  Dtmxr ot1oeeoifeilt a2umu snt0alxomo3iatlatrai s s0trtoimpiy4altelncias  Drrxm nu4tltoio3iytlm2el(mont0 lxomo oo1omD  uvs s)s2xr(m nu1al   netatfaDtru  ;u4tpxoiietlt aDraums (0aetoiociadfmDean i;(  2toio3nu1lpenmfvtasfaDuaurpot1tlen ieiatlsDel(vo t4 lxrmo oatoptrluei;t0srurxo nydll nlfeiat  rum( o;o1oexn oetadfa2uluvo t4 ltnmf oodomDeai ols0 rxmxopnudlp   nvsa(  Dtrumo;o4tpx mieiydlm2ranvo (0aexnxf totlmtelnes;t  2xm(o3iodom nlics tf 2ua(mono4opt mo3ild a2ulnvp;t0altoir3iy1oaDrai olt trxm(m3io1lmee fct sfa2trum nt1opxnmfciatla rlnmsnu)tltrif oatlpDeluvi s  2tmir3ny4omtemivsa(  Drrxm ou1tee ioetys m2rmuvpn()trtnifcia1fpteanei ()t2tr(r nu4olenmfci t)aDraurooo4aeeoiictytlmDulu s;t4 exnif3iydoaDeaivi;s teumim nu1apeemnvsa( a2taxrpoo4openif3ilslmDelnvs t4areomrctotom r neil( t2um(m iu1op n iciltf rrax  nu1aet  ictadfm2uauvpnu4tlxrifcoo1la  lnvolt)s2trxr3iodlm elnetl( aruru onu4aetniociys m ranmp;(4aetrxo tydom  luvslt)srumim3ou4opt  fvs tf rtrxmo;u4oexo fciyd sDumump t) etnif3oatfmD lnvi t0 euriopiodal nmiesa() rumxrpoo0ope mo3tysla2raump (4 etrmr3oatfaDeai i;s0sruoxm no4lltemieias sDtruronu0oexoio3iyd sDrlumo u0treoxf3tydlmDe n olt0 eurxr3ny1ape mfetls)artrumont4apeo i3iatfm rauvo;()tlenmoctytfpD  nvo s srtrir3oodaptelfvtlsfaDtmx p;o1opt ioetysfsDranvp u4altrio3ootomtraivol( srxrirpiy4lme lfcs sf rtmuroou4oex ii3tyd mDrmums;t0areomo3ty1optelneols0s2trim3iu1am e netltfarumxro;u4oex  fcias aDumu o ()trerir3oo1lmDr nvo;()t2uo(mpou1ape mfcta()srtr( pnu4ale  fetldlmDem( p;()tltnifciytfa  lies;s srtoxr nydlmt  ncil(  Dtaxmp;t0aleoiietatlmDrlu p;()treomo tatoaDran slt0seurimpoydoltn fvtat)a2rm(m no4tet mf3ils a eanmp t)tlerxr oytoaD lnvo t) rxmxr3no1alt lieils) 2ta(ro;o0tet  f3iadfa umuvp;u)trxnmr3tadlptelnvo t0seumxmpoudam   fesltf rur(mo;t0olto ieiydls uau p t0 lxnxrcty1lp  anvsls0 rtoio nudom nlfcsa( a2rm(rpou4tptomfcild s2rmumpnu4alenxr oadoptrlivi;()t2umxr oydom emnvia() 2ta(ront0aet mf3tatfmDel(ms;() lxnio todop ran i;t  exrxo iudamtnmnvs tfa2ur( ooo1ape mietltfsDeluvp t0altoxf3totfat anes t) eur(opny4amtelfvsat srta(  ;t1olxomoeildls em( p u4aleoircoodfmteli o;s0 2uoirpny1amen nesls)srumxrpot1tpe iictltlm2rmums;u0 rtrio iy1omDranvs t0 rtrim oy4alt micta()s2rr( pot1alt iictad a emu o;t4 lxomr3oytfmtr nvs t)s2xoxopoy4omtelfetat  Drru p;o4alt  oeiyt s umuvp ()altrmrcio1laDrauvi;() rum(r3iudlleemnvils a2uaum ;o1olxoiociatlm2rl( pn()altomo3oy1opDr n s;s)srumir3oudlmeelfet tfsrtm( pnt4aetomieiatlm2ua(vs u0artrxf3iotfp eaneils) 2to(o iodom elfviat) 2umur ;t1olxo iciltlm em(mpn() rxnxf3to1lpDr n s s0s2xoxr io1ap  mivsas)aDrrxrpou0texnmi3tas aDumu pnu) lxoir tytop   ieslt srurxrpiudop emfcsasf 2trx  ot0tleomictldlmDea(vo t4tleoxocootfm  luvs;s0texrio oo4op   fctlt)sDumxro;o1opt mieiys sDuluvsnt4trtomf3tatfpDrli ol(0 2urxo3nodlm  mnvi t  Dum(r ;t0tpxnmi3iyd s2elnmo ()texoir todlmDe uvsl()setmirpiodol n fes t arta(  ;t0oetn i3iadfs em( p;t)aexoif3io1lptelueslt0 exrxm nodopen icsltfartau ooo1ape mictadlm ul(vo t0texoir3ty1lm eai i;(0teuriopny1ll  mfcsltf Dtr(mp;u0opeo oeiytfa2uaumsn(4alxomf oatomt ln s;t0setrim no1lle  nvsl(fsrur(moot1apx io3tld s2ea(vs;()altnxrcoydfmDrlieilt srumir3nodlltemictatfsDrax ono4optomi3ildfm emn pnu0arenxociytlm   ivi;s)seurxo ny4opt livtas)s2uaxmo;o1opxo i3ild s2rl( p;t) rtrmr3tatom r uei t0t2umio3iy4op emfes (faDurxro;t4openif3iysfmDrlu s t0teeomr iodfm  livs;s  exrim3iodoleelicsa()s2tmum oo1ole  f3ilslmDrmu pn()alxomfciy1oa ranvi t  rum(opnu4apen ivsa( a2uaxroou0alxnii3ildfaDeanmp t4alxnxf ootlpDeliei ( t2tmio iy4opte neiatfarraxm ;u1aetn f3ilt a umnmsn(0 rxnxr ootfa eaiei;s) rxr(r iu4altemfctlt) 2tau onu0altnifciatls2raumpnu)alxomo3iy1lmt auvi;s) euoxm3oy4op e ncil()sDrr(mpno1oexo ietadlm umu o;(0trenxo oy1fm ranvslt srxmxmpny1lmeelfvsl( arurumpoo4apx ifciatlaDel(vo;(4arerif3oa1fm   u i ( t2umir3oodoltnlivil()aDur(m ot1aeenmo3tad sDum(vs;t0 leoxf3iodfptrluvsls0 rtmir3oudol e nesls)sruaxrooo1tpxnmo3ilsfm2ulumonu)tltnmr3oodfatranes s srxoir3iu4om emiesa(fs2ur(rono4olxn ocilsfa2ua(mp u4 renxfcto1fat lnvilt0 eto(opiy4am  lfesls sDrmxrpno1oltnmo3ild m2rluvpnu)alenmr iodfmtelieslt0 2xoxm3nudoptelfeilt arurump;t1oeeo fctltlm rm(vp u0tlxomo oatlpt anei;(0t2toio ny4lmen fetlt) rtaxmoot1tpt  ieiytls eauvpnt4altrxr tydoateanvils)s2trir nodlpee ictasfarur( ono4aexo ociadfa rm(msnt) etomr3todlmtrlies;t s2umio3oo1om e ics (fsrururo;o1tlx  fctatfmDem(vp;u)teerif3iydfa elnvsl( t2tmirpoo4lpte fvtls) Dtmxmpnt0tetnmoeiys s2ean p;t) exoifciy1fpDr u s;t  rxo(m oo4op elfvtls)sDrmxmpoo0aetoif3iydla2rl(msnt4trtrmo oatopteaueolt teuo(r3oudam e ietat srur(  nt1olxoioeias m2ea(mp;()aexrmf3iodfpt lu i;( t2umimpnu1amtnliviasfaDrm(r ou1aetnif3iatfm2emnmp t0aetrxr tytlaD ln s;s seumir oy4ap nmfcias)arrr(rpnu1oleoiietyt s2el(vp;t4treoircoydlpDeauvol( seuoxr nudolt  fvt sfaDtmxrpnt0alxnmf3iatfm rlu p u0 rxnmf3ty1fpD ln s;() rumxopiy1lmte neiatfaDtr(mpoo0tlt if3iatfmDel( p;u0 etnirciodoa rau ol() rur(opoodlmtelivtl(f Dta( p;t0oetnmfctytlsDumuvpn()texnmfcia1la eluvol()s2umimpoo4ll elnct s aDtrx  ;o0tlt iieiadfm ulnvo ()aetoxr iy1opD aueils0t2tr(rpnydalt mivs (f rumx  nt4oee micilsfs2ulump;u0aexrmocia1lmDranei;s)trurxr3iu1lmt mneilsf 2trumo;t0tet mietas sDumums;t0alxrxf3tatlat lueol()srurxo3nudol emfeiasfsDuaxroot1teeo octas mDeluvs;t0trtrmo oa1fptran s t)s2xrxm oo1lle lnvt sfartruront4teen f3iltfa2umnmont)arxomr tytfmDe nes;(0t2um(r nodlmtemivta(  rtrumoot1tleo ieilt s em(vont4arenmrcto1lp  li o;s0 2xr(rpnydllee feslt) 2rm(mooo0aexnifctldlaDul(von()aetoxrcoo1lm  lnvol(0t2toir iu4lp nmfvtls sDuaumpot0optn f3ilsfa uln s;t4 exomoctatop rlu i t s2xo(m3no1al elncsls  rta(  ;u1optomoctadls2rlumonu0alxrifciatfmD ai il(  rumim io4lm nmfcsls artax ooo4aetn feiadfs ranvonu4 renxfcty1lptranvi t trxoir nu4am   nct t srta(  no0optnmieiltfa2uanvpnt0tetnir iodlmDe uei;()trtrxm3oo4ame livta( a2rrxm nt0alt  f3iltlm ranmo ()aetrxo3oydfpDrlues;s0tetoio3io4om  miei s s2ra(mo;o4olx mf3iadla umuvsnt0areoxf3iatop raies s s2xr(m3nu1ope  icil(fartmu o;o0aeeo fctys aDranmp;t0trtomf3oa1faDeln s;t)srtm(o3iydaltnmfesls a2tmu pno4ale mociltlm umnmonu)aetrxo tatfmtr i s ()teumxopoydaptemicsa()aDrru  ;t0aet  feiaslmDrln s;u)tltoir oadla e n i t0 2tmxm oy1ole  iciltf rua(mpnu4tlenmfeiys a2uauvo;(4 rxoxfcto1optr n i s) etm(r nudal elivsa(farum(r ;u0aex iictadfsDraumont) exrxo oodop   iesl( trurir iudam elietls  Dumurpnt0tpxomo3ild a2elums t)alxnmfctadlmte n s;()texoxo3oudomtnmics t)aDrru oou0ole io3ilt a eanmsn(4 ltrxo oa1omDe uvo ()teumim io1oltemfvt sf rtr(mp;u1aetnmietadlmDrlnmo u) exrmo3io1lpt lies;t0 etm(mpny1openmfvt (fsDtru o;u1alenmfciaslm2ul( pn(4aexoircoodopD anvi;t) rurxopiudoptnmivi ( s2uaur no4tle iieiltfs2umums (0trtnxrciodoaDr uei t) exmxmpny4omeemncs s)artrurp;u0ole  ictlslm eau pnt)alermrciytlmtr nvs;s)seum(r3io4lm   ietatfsrta(rpnu0tle  fctasls ea(ms;(4alerxf oatoaD auvi t0srxo(m nydlpee icil(fsDraxroot1olt iieias a2eauvo t4altnmrcootfmDraivo s)s2xo(m3iu1alenmnciat) rra( p;o0opx mf3tlslsDrl(vo;u) eerif3totfaDelivi t)trxo(opiy4ope lfvtat) Durur ;o0optoiietyt m2ulu onu4alenmf3iadfmDrlueo s0t2trir3oydap e nviatf Duaumpnu1aet  ociysfa ua( sn(0 lxrmf3tytlm r ieolt0 2ur(o3oudll nmict s)artmumooo4aexnifeiydls rmuvs u0 eeoifcta1latr uvo ()texmxm3oo1ll n nesas)a2um( pnu4apt if3tyslm2umnvs (0 lxnxo tydlm rlivi ()teuo(m3no4lmtnmfvsltf 2tmumpoo1oee  oetytfs2elumo u) renmfcoydlpDeauvsls0 eto(mpoudapt mnvtls)s2uaumpoo4apt mf3iatlsDua(vo;t0aetrirciytlpD auvil() etr(r ou4ome  iet tfartau pno0oleo i3tytfm ulnmo u4 exnmr oydoptraiei () exrim3nudomenlivi tfartrxrpnt0ope iociysfs ua( sn(4aeenio oo1lm  lnei t  rtoxr3ou1open neslt sDra(ro;o1tpe  oeiatfa2rlumont) lxrif3iytopDranes t) euoxr iudal elfct t) 2ur(m ot4oet  i3iyslm2uauvsnt)alerxo oa1oate u o;t0 2xo(r3oydlltnmivil() Drr(m nu0texomfciydla2rm(mo u)alenxfcty1lp eaivolt sexrio iy4apenmfvslsfsDrr(rpoo1tetoio3tat s ea(vp u4arxnxociadlmtelu ils0s2toxo3ny4ameemneiltfa2raxmoou0ale mietadls2rl(ms (0trenir3oadfmDrlies;(0 eum(opio1lm emieil(  Duru pnu1aexn oeild s2eau pn(0aexnio3oatlmtrlneil(  rxrxr3nu4op emfvtl()a2rru o;u4tptnioeildla el(vp;t4tlxrmo tadlptranvolt) 2xmio3ou1lpenlncs t sDtaumo;t1texnmocils m elu pnu0 rtnmf oo1oa elu i s0 2xrxm nodom emivil( s2trxronu1opx ii3ilslaDrln ont4 rxomr oytfa r uvils) rtmxmpio1ol n fetasfs2rru pou4oex mo3tldfs2rmn s;() eermfcoytla raivslt0s2tmxopnydalte fci ()s2ra( pnu1open ietlsfs rln ont0alermfcoydlm raiesl( trtoir3ou4al  mnvilt  2taxmp;o4opeo ietlsfa elu s (4altomr3totlm e nvilt) ruoxmpou1lme mivt t)srumx ont0oexomf3iytlm2em(vp;t4 exnmr3ia1laDean s t0 rxm(r3nu1alenlncsa( aDur(root0oltnioetlt a ul( sn(0 rxnxfctotoateai olt)texrio iudlpte fct t)s2rmxro;t1alt mieiysfs ul(von(0texnxf oo1lm eaueol(0trxm(o3iydll   nei (fsrrm( pno1opeoifciytla rlump;(0tleoioctatfm   uei t)t2umim3ny4ole  ivt ( a2uax  ;t0alx ii3ild m2emuvp (0teenmr3oy1op eau il()s2xrxm3oodam n ncs t arra(rono0tee io3tltlaDumn snt) exrmf3tadfpt lieo;t  2to(r oo1amt lnetasfa2uaxmp;o1oltomieiasfa em(vonu4tlermf3tydlm rln sls0srtmim3ny1oltelfcs (fs2uau  ou0aetnmo3iasfs2uanvp u) ltnmfctotoaDelivilt0srxoir iy4lme  neiat sDururp;o4aetomociltfsDelu s;u0tlxnioctytoaD auvs (  rxm(r3iy4apee netasf Dtrxr nu0optnif3iysfmDelumo;()artnmf3totfa  auvilt0trtmimpnudlptelneslt arrr(m ;u4tltn oeiasfa elnmonu)tlxrxf3oatfa  lnes s  rxrxr no1ome  ncias a2ta(m nt0oet ii3iad s2eanmonu)aetoif3oa1fm  livs s  2uoxr no1omt licil( srtmumpou0aexo feiytfs rmu p;(4tlerifcoo1fptean i s)s2urio3iydape livilt) Drrur no0tptnif3iad m2rl(vp u)aetnio3ty1faDr uvi (0t2xr(opoo4lptnlncta() 2rrum nu1aptoifctydfm2rau onu4tltomo oodomtr ieol(  2xoimpnu4lm e fcilsfaDtr(r ou1tpeoif3tldlm rm(vp;u0areoxo iy1fpt aneols)trur(r oydlleelfvsl(f 2tmxrpoo1olx miciatlmDea( ont0 ltrxrciy1faDr uei s) 2trim nodamen icsat)aDrax p;u1apenifeiytfa elnmp t4artoiocty1fm   uvs;t0trxoxr3iy1aptemnctatfarraxr ;u1tpxoif3iatlaDem(msn(0texnxf iadlm r nvs s s2xm(r iu4oleelnesatfsDur( pou0oltoio3iad m rl(vo u0alerxf oydlpDe n ols0s2uoxo3oudamenlfet s)sDtaxmpou0ole  oetytfaDrluvpnt4trtnmr3iatomtraies;()sruoxo iydamtnmnctatfarrrur no4tpxomicildlm eaums () eenir3oodlpteauei () exm(r3ou1aptelnct tfsrtrurpnt4altnii3iatfa2emums (0aexoxoctodfpDe ueols)teuoim3oudal   fesas) Drmum ;o0aptoii3tydfs emn snt) eenifcoatop  au o;t  2xm(rpoydap e nvslt)sDtmxront1teto f3tas s ea(monu4 rxnmo3iy1lpt  uvi;s) 2toim nodlm nmfci ( s2um(monu4aeeomo3iasfs2uanvp;t4alxoio3io1lat li o;t t2um(rpio1ame  ivtat srur(mpno1ale ii3tldfaDelnvpn()trtnxf3tytlat an i t  euoxo3ou1ll elfvi (fsDtmu ooo4optnii3tasfa rmnvs t4areomo3iodoaDe iei;t t2tr(mpiy4ll n fcslt) rrrxm ot1texoif3iatlsDrl( s u) renio oa1lptrluvi t)t2trio3nu1olenlfcils arrrxr oo1texoifctat aDrl(von(4alerxf ia1fm  anes ()trtmiopno4op e fvslsf 2ur(root4alxn fctlt m2eluvon()artriociytfm  ai i;()s2to(o oy1ol   ncs s  Drm(rooo0aex if3iatla ea( s (0tlxomrciotom elues;s0 eurxr ny4aptelict s) Dur(mo;o1aetnio3iasls2ua( on(4trtnxf oatfa rlu ils)texrxm iudal  mfvsl() 2tm(ro;u1tex mieiydlm um(vo;u4arxnif3ootoaDe n slt  rxmxm iudam   ivtls) 2rr( oot0olxo f3iad a emuvsnt) lerifciodlaDean sl(0seumxr nodlpeemiei s)s2taurooo1aptomieiatfs2elnvsn(4 eerirciotoat li o;t srurio oudal e fcs t a2tmum ;o4ale  oeiysls rlnvpn(4texoif tydfatranvi s0t2xmxmpiu4lptnmnvi s a2urxrp;t4tlt mf3tld aDrau s;() lxrmr3oa1fmtr ivs;(0 2umxm3ny1apeelicsa(farrr(r ot4aeeoiiciyslaDum(mo;()aetrir3totlpte neilt  rxoxo3oo1apen ivtlt)s2tr(ront4optoioeiytlaDrmums;t)teenxocoodfmD lnvo;s seur(o iudal   nvi tfaDrrur ;o1aexn i3iyd a2um( p;u)trxoxrctatom e n ol( srumxo io1lmtnmicta( aDrr(r oo4tpt ifetydlmDrlnvs;u4 etnio oydfpteaieo;s tetoiopny4am n ncs tf rrr( pot0aexniiciytfs ulumo t0 rxnio3iadom r n olt0t2trxo3nu4ap   fvtlsf 2rrxrooo0oetnmo3iltls uau o;()trtnmo oadfmt an o s0s2to(m nydoptnlnvs sfsDuaurooo4apenioeils a2el(vp (4trtomr3ia1fmD  n s;t)texoxm3nu4ap nmfcsa() 2umxr ;u0alx ioctls a2em(mpn(4tlenmr3oytom rlnei s) 2xr(m oo4al nmnetlt) 2ur(rp;o4olx  o3ild a uan o () etrmo3to1fpt ai s;s)texoxr ou1al nmnvtasfs2ua(r ;u4oleo ociatlsDra(vp u4 ltrio3oatlp   ieil( t2toxmpoodop elnvsls)arrmx p;t4opxn f3tlsfa2emnvpnt) ltnxrcoo1lptr n s;() rto(r nodap e fviltfsDtaur ot1oeeo ieilslm ulnvp t)trtrxf io1fmDeauvils)trxo(m ou4optn iesas  rurxr ;u1alt iociysla2eaumpn(0 rxnxrciytfpDranvs;() rtrir3no1lmenmnetat  ruaumo;o0apen o3tas m umu pnt0tetoif iodlp raivi;()texoxopoudamte iesat s2rrxroot1olt  o3tldlm2rmnmp;u0 lenxr iodoa r ueo;()t2toio3oy4alee ictasfs2ur(r nt1olxomoetadfmDrl(mpnt)tleomf iytfaDr i s;t s2umim3nudlp nlfcsa()sDra( o;u4tlxo ociltls ul(msn(0 lxnir ta1fa eanvslt) 2xrim io1lmtelnei t aDra(rp;t1tpeniieiydlm eau o;u4trtoifcto1oatranvo s0sexmxm3iy1llt mnvtlt  Dua(m ou1tltn fctas m elu s (4 rxnircty1lmtr uei;s0teurxr3oydole  nvsa( sDua(mpno4aptn o3ildfa eanmsnu0texrif io1oaDr u o;t0tetrim3nydamenmfvs s aDrru  no4oltoiieiysfa2emn o t) rxnmocia1fp r u ols) rxrxr oy1llte nvtat)s2umum ot4oex  fctltlm2elnvp t) exnxfcto1fmt anes;s  rumxo3oy1ope mnvi tfsrtr(r ;u4oeen oeild a uaumpnt0 rxrxr oytfa eaieilt0 rtm(o3io1op elnesasf 2um(r no0oeen feild s2elumo;u)alxrif tadlpt auvs t)t2xmxm3ou1lpt  fes ( aruaxrpot0aeen i3iysfa2umnms;(4 reomocty1lp eanvi;s)seur(m io1ll   fvtasfsrtmxr nt4apxo ieiytfm rau s;(4teenio3iotlm eaueo s0 exm(r3oo1ap emivtls)aruru onu0oeeoiiciaslsDulu p () rxrir iadfm   ieo s)srtr(r ny1al  mneias s2rrur nu1oexniictyt aDuauvsn(4tltrmocia1fa e i s;s srxrio3iu4opte nvtlt)a2rmxrono4tle mfctlsls ul(vonu4treoxo iatlpDelivo (0 eumimpnu1omt  fes s sDurur oo0aet io3tatla2rmuvp;u) leoir3oo1lpDe nvs;t)teuo(rpio4al e fci t)sDrmumo;u1apeo fciasfm umuvo;()tetrxf3oa1fmtean o;s  2uoxr3oodlme  ncs s)s2tr(root1tleomi3tasfmDra(vsnu) etrir3tadop   nes (0sexoir3oy4lltnmivs t)s2umx p;u4optomieiytlm2eln s u0aetnif iatomDran slt0trtr(rpiu1apeemfetat)a2urxmont1opt if3iatlm2emn s;(4 eeoxf oytlpDe n s;() exrxo3ou4llen iviat)aDraxmpnt0oee ii3ilsfmDum(mon(4 lxnxf3tytfpDeanei;( srtoxopio4llt mfcsls srurxm nu1tlto oeilt m2eanvo;u0aexnmf3tydfa rauvol(  2uoxopny4ame lnvsat aDurump;u0teeo oeildls el(vpn() reoxfctodoaDe u slt truoir oo4ol n nvil() Dtm(moot0oltomfciatfmDra(mo;u)trtrxo totoptean s s0 rurxo3iu1ll  mnvs t srrr(mpno1altn oeiyd s2rmn snu0tlxrir3oo1fmte ivi;t s2umxr io1altelnvia(  rra(rp;t4tpe  iciysls rluvo;u0aexrir3iydlpDeluei t) 2xmio iodlle mivsatfs2tmuront4alxn octadlmDemn p;u4arxrio3oa1fp rlneo () rum(mpiodlme  nvt tfsrraump;t1tpeomfcilt s rm( sn(4tleniocootfaD aueils)srtoimpio4opt  iesl() Duaur ot0olxoifctltfaDrl(vo;t)trxrxo3ootfpDeai o t) eur(mpiodam emictltf 2ua( p;u4aee mfcild s rm(msn(0aetoifcoadfa  auvi t teuo(r oodlp emnesasfsruaxmo;o1apt io3iltlm uan s;u4texomfciatlmtr ies;( srurio oudomtelfvt tf Dtrxronu4altnmoetat s emn on(0arerio iytoa rlnvo () 2tmiopiodlpt lnetas)aDrm(ro;o0apxoii3iltla eaumpn(0tlxoxo ty1fm  liei;(0 rxrim nodop  mfvslt srtrxronu0oeto ociydla eanmp u4tlerxocio1lmtr ies ( tetoimpny4amtn fetl() 2urx pno4opeoifeiysfa ea( o t0aeenmr tydlmD  i i;t0teumxm3oo1lltelnesl(fartaxm ;u0optnmoetyslaDuan sn() lerir3oytop  livs;s0 2urim3nodaptn ncs ( sDrmx oot0oex  o3tltlm2rmums u0aleoxr3ta1omD ln s;s0 exoio nodomenmneiasfa2raxront1tpt  iciatfaDea( o u0 etrio3oodfmtrlnvo;s0trxm(o oudlpenmictl(fsDrru poo1aeen ieiytfs rau s;(0arenmf iydomt anvs;t)sruo(opny4lpt mnciat) 2rmxmo;t4oltnmfeiatfm eanms (4alxoxf3oytoaDrli ols)seuriopio1lm nlneias sDtax  no1altnmo3ild a uau pn(4 lermrcoodfpt  i i;s)trumimpnudlpe  nvsatf Duaxroou1oetomietysfa em(mo u0 etrmr oadfmDeliei;t t2uoiopiu4op elncia(f Drmx pnt1aetomfciatla um(vont0trtoif tatopDrlnei;t teumxo3oo1am emietat arrrxm oo0ole mieiltla uanms t0areoifcoytlmDe uei;t)texmio no4al nmfesa(fs2umxm ;u1tex iictatfm ea(mp u0tltomf3tatop ean slt trtmirpny1altnlnvs t)aDumu pou1tet  ietatfm umu p;u4arxnxo ia1optrlnvsls  etrimpiodlpe livias a2ta(moou4oexnmo3tld m2uau p (0 reoxr iydoatrln il()tetrxopnu1al nlies (  Draxmpnt1aee moetaslmDem( sn(0 eerifciotoa   nvo;(  rxmim iydolen iet sf Drmxmo;o4oleomo3ilsls emnms t0 lenif tytlmDr u i s srxmim oodol e fct ( a2um(ront0opx mf3tldlm uanvsnt0aetrmocoodfa e ivi s0 2xoir oo4omtelfeil()aDumur ;o0alen fciytlaDrl(vpnt) rxnircia1fm e nvslt0 rxo(m oy1olt mnetat) Dtau ono1opx mi3ildlaDul(mp;(0alenxo iatlat ai il( srtoxm3no4lptnmfcsat  Dtrxr ot1tlx  f3iysfsDrmuvo;(0 lxnxrciy1om  an o;()t2tmxr3oydom  lics t sDtrx ooo0tpxoif3iydla2rmnms;(0 etrmo tydlmteluvs;t0 rumirpny1lle lnei t a2umxrp;o1tpen fciydla2em( sn(0aeenmr3ty1om rai s;t)t2umiopiudlpeemfvtlt) rrm(  nu1apto f3iyt a2rmnms;u0 rxoxocootlaDeliei s)sexrimpny1op nlivtl( srrrurpnt0tptn i3iydlm2um( s;(4trtnxociatlaDrai i;t)trxoiopiu1llt  fcilt) rua(mpoo4texoio3tlt s rmums u0aetnmf oydlp elu s;s trtr(o io1lmtnlfvt sf 2rruro;o1opx mietys s ean s t) eeoio3iotlpD aivo s0t2xrxm nudlmt  fvsat  2trx ono0opt ifetys a2rm( o;t0 lxoxr to1fat auvo;() rxmio iy4lme  iciatf Dtr( pnt4oexn octadla2rlnmo u0 rtriocio1lmt ln o;s0srtoxm iudaltemnvs s)aDtaxroot4oee  fciaslaDrlnvp u0 leoxf iadlp  ln s s)trxoim oodoptnmnvsa() rtaxm ou4alenmo3iasla uanvo;t)texnxf3tydoa rlivi (0sruo(m oodlpen ics s a2rr(m ;t0tee mictlsfs el(vs;()aetrxfctadom  luvs;( srurim3oodape  ncta(f Dtax o;o1oexn f3ils m2rm(msn(0aexrxo3ty1fp eliei;(0trxmir3iudape liesa(fsrrrxr oo1oexnifetytlm emumon()aetrmf oy1fmtr nei ()trxmxm iydopeelfesl( srtaxmoot0olxoif3ias aDemnvpnu)artoxociadlp rai i ( srum(m3ou1lltnlivslt)arururp;u4tpxomo3iadfm eanvpn()trenif3iotop e ivi;(  exo(mpnudamtnlnctlt s2ta(ronu4apeomi3iltfa rluvsnt4trxnxo iodfa raivil(0t2xo(opiudapeelfeia(farrmxrp;o0alxo ictadfmDemnms;()trxnxr iytfmDelieo (  2ur(mpoudll   iet sf rtax  ;u0aeeo iciytls ulump;t)trxrircootfpD ai s;s0tetmim ny1lleemnvtat s2trxr nt1tpeoioeiyt m uau p (0texoxo3tydlpD  uvs;(0 etr(m iu4llte fvsl( arrr(ro;u1tleoifeiydfm rlumpn()tltrxrciytlp   u slt t2uo(r iu1alt lics s)srumxmont1tpenmociasfm2ranms (0altrxocoytoatrlnes ()texrxrpiy4oltelnvtls a2raxrpnt4apx mi3tadlm ra(vs (0aetoir3tytfat  i ils srtrirpoy1omtnliei t)srum(rp;u0ale  o3ils sDuauvsnu4 eeomoctatlmDe nvi;s0texm(r3oudalenmivtat srururp;u1olxo ieils s ulu p;() lxrifcoa1omtrlivo s)seumxo3no4lpt  nci () ruaxm oo1tptn f3ildfaDumuvsn(0arermf tytfptrlu o;t) rtmxo iu1amtnlivtatfa2trxrpot4apt mi3ilsfs ean o;t0aexoiocoadop r i i;() 2xr(r oy1omt micsl() rrrumpot1aeeoifeiad m ra(vp u)arxomr3oo1lm eau o s s2toio iy4op nmfesas) 2rrxrpou0tpxomo3iadfa2um(vsnt) ltnif3oy1fm  au slt teto(opno4opeelnetasfaDtm( o;t4oex mf3tydlaDrl(ms ()tlxomr3oa1opte nei t)srtoir3iodoltelncsltfarrmumo;t1opxnioctydfa ulums ()aexoxo3totla rlivil(  exrxrpoy1lmt  fviat sDrrur ;u1oetn fetaslm umumpnt)areomf tadfaD livs;()srtr(r3io4apt lnvta(  Duaxront0tet moctlt m ul(ms () rermr3iydfaD lieil(0t2xr(r oydolte neia() rrr(monu1aexoii3tysfmDrlu snt4alerif3tytfmt  nei t texr(opiydome lfctas  2urxro;t0opt mi3ildla rau o;t4 eerir iytopt aieo;()tetoxrpiodam emnvt t)arrr(m ;t1opto oeiytla2rl(vo u0aleomf3ia1oate ivo (  2urir3nu1lpee ivil( aDurx pnu1tleoiieiat m2uluvp u)artnio3ia1opDe ivslt t2xmio3oudam   nvilt sruaurpnu0oex  oeiys aDulu s;t) lxomf ia1fmD  n s;()srxr(rpoy4llen netltfs2tru ont1opxn o3iysfm2emu on()arxrmo ootlmtr ivi;s0s2xr(r3oodal  mnvsls  2tmurpot1tetoioeildfa rmn pn(0 renio oytlmDrluei;t)texoxrpny1ll e iei sfartmumpot1aeenif3iatls umnvpn(4aeermf3oytoa   uvslt0t2uo(rpio1ole lnvi s)s2umu  nt4aleoioctydla ulu on() eerxr oodfp   ueols0trum(m ny1apeemfeiasfartrxr ;u0ope io3iysfaDeau onu0altoxo3iatoateliesls0texmxmpno1lltelfcil(fsrum(ronu1aee  ietas m2umu p;u4 rxrif ty1oa raivo s0srxmio3no4omeelnesl( sDrrxrp;o0olenmietldfm2rlu snu0tlxriocoytopte ivi;s) rxoiopnudol  mivi (f Dtr( pno0oeenifctadfa2umuvo (4tetomf3tatlp eaieolt0t2trxopiu1lm nmies s)artru ono1alto fciad a2rln snu0arxoio iadla eaieolt0 2toirpou1am  lfvt sf rua( ono4oltomo3tasfm elnms ()artoxfciy1lm   ies;(0t2xr(m3iy1lltn nvsa()aDra( pou1ope  oeiad s2rauvsnt)tlerxo3iodlaDrliei;() rxoiopnudoltnmict ()sDtax ooo0alt ifetldlaDrm(vpn()trxnmr3oadop  aneils setmir nodolenmfciasfarta(mpno0tpenmfetlsfs2eaumonu0 etoxf iadfp elneslt) rtr(mpoo1ope micslsfaDuaxroou0ole mo3tatlaDelnmp (4aleoxr3tytoaDelneolt) 2xoiopoy4alt lncs sfaruru  oo4apxnmo3iyslaDumnmo;(0arxnifcoodlmD aies s)srxoiopoo4lpen ivt t)s2tru o;t0aexo feiytls2el(vs;() rxrmfcia1om eaueol(0 rtmxr3nydll elfvi t s2trxm ot4texn ieiltlm2rl(vpnt) ltrmfciatlateaieo ( seuoio3nydamtnlnctltfs2trx  nt0tlto o3iysfm2ra(vpnt)arenmfcia1opteai i;t  etoim nydllen nei (f 2ua( o;o0apto ictysls2rmn sn()trenircoatfa   uvils)tetmxopiy1lpt  feta()s2tmurp;t4tpxoif3ild m ul( p;u4alenxrcootfm ean sl( srxrio nodalenlneiat)s2tmump;u1aexniictysls2ul(mo u)arenxoctadfatr ieo;t0 eto(o3nu4omtemnctasfs2rmumono1teenio3iad aDua(mo;t) rtrir tatlpt lnvi;( trtm(m3ou4lm n ieil()sDta(mpno0oex  i3ils s em( sn(0arxnmrcoadoa  lies s)setmio nydomenmfvilsfsrur(mpnt4tptoifctldfaDrmump t) eeoxo iadfaD lneo t)seum(rpoodopenmies (fsDum( oou0alen i3tat m2rau pnu4aetnxo3ootfp e neilt0trxm(r ny4alt liesa(  Dtm( ono4oexoifeiytlm emn ont0altomo oo1fm r u olt0sexmirpno4lmeelict tfsrrrumonu1opeomfciydfm ulumo t)aetrmf iotoatrauvol() 2xmio oo4omen nvta()s2ur(m oo4oet  f3iytfa2ran pnt) eenir ia1fpDelnvo;t t2to(m ny1lptnlnetlsf Dtrur oo1apeo oetldfs rmumo (4arxomr3oodlat lu s;t0srurir3iu4optelnvsl( srra(r ot0ape mieils a uanmo;t4 ltrio3oatlmD anei s)trxmio nu1al nlieias  2taxr ou4olenmociyslm2raums t4 rtoifciodop  auvilt)trtr(mpiu1apt mfct (fa2tmxmpou0tpeomoeiatfm eln p (0 rxrxocoy1opD anvsls)t2uo(rpoy1olenmiei t)sDur(mpnt0aleo ictys sDran o;(4tltrmr to1lp r u o;(0seuoxr oo4lp  mictlt)a2rrxroou4tpen feils s ra( o t0 rermf iadlaD ai i;t)t2trio3iydalenmfeias s2uaurpoo0tle  f3iysfm eaump;(0 etrmrcty1oatr uvo s) rxoxm iu1lltelfvtl(fartmu oot4alx  f3tldfm ul(vp t)alxoxoctatfat auvolt)setmir3iydomt  nvilt) rur(m nu4oeeoiociytfsDra(mp;()alerifcio1om   uvs t0 2ur(o ny1altnmieilt) 2rrxm ;o1tle  oeiat m ea(vo (4aexnmr tatla  li i s  2uoxm3ny1ape mivi t)aDtru ono0tee  ieilslmDrm( s;u)altoircoodoaDelnvo;t  exrxo3iodoptn fetltfsrur(ro;t0aleomietat a rauvs;(0aexrxf3ia1fm r uei;t truoir oo1optnlfvs t srumuroou1oleoif3iytla rlnmsnu)trxrir3oo1laDe nes s0 rxmirpou1opt micsls  Duru  ;o0oltomictydla2ul(mo u)tetrmoctytoptr n s s t2xmxm3oydaltn fei tfaDtr(  ;o1alxomieiys a2ul(vo;t0aeerio oadfm elueil()trto(rpoodol elnet s)sruaur ;t4oexoifciydfm umu p;() reomocta1fpD auvi s)trtrir nu4ome mfciat)aDrmu oot1ope  o3iltfaDelnmsnu)tetrio todomteluvs (0 2uoxmpno4am   netl() ruaumo;u1ope if3iltls2em( o;u4 rerxrctatlate ueo;s0s2xoim3oy1al  mics tfartmu o;u0oexo i3iadlmDeln s;() lxoxr3iotfpt  i s t sexrim3nudlp emneias)s2um(mpno1teto i3tys a rmu o (4 ltrio todlpt  nvils)s2tmio3ny1lptelics t)aDrrur ;t1tleo oeiytfmDrmumo;t0texomr oytop   ies;s srxoxr3no4lp nlnciltf rta(m ou0tlt io3ildfsDumuvont4aetoir3oydfmte nvilt0srtm(o ny4amtnlivs tfs2tr(rpou4apxnmf3iadls2umnvo;u4trenxr3ia1lp rliei;t0 etmxm3oo4lpenlicia(  Drr(rpoo0tleoifeiytlaDuluvp;t0 rtoio to1lp   nvs;s trxm(rpoy1lm  mnvt tfarum(mpno0teeomoeiltlm rmums;()treomfciytfatr uvo;( trxmxrpio4omt liviat) rra(  nu0ale mfetltla2eanmo (0arermrciodfm eai s;(0t2urio3iodol emfetlsf Dtaurpoo4oltniociydlm2ea( snu0 lenxrcty1lmt li s;s  eurio3ny4lp  mfet t)arrm(m ;u1apxnmoetatlm ua(vs;u)trtrmf iydlaDr i s;()s2umxopiy4ap nlfei ()srtm(  no1tleomieiyslaDua(vp;u0 rtomfcto1laD luei s seuo(r3oydalt mfctatfaDtm(rpnu4tetomociyd mDulu p u4aeerxociydomteai s s  ruoio3ny4am  lietlt sDtrxmpnt0apeoiieilslaDeluvp;t) exrifciodfmtrlivsls0srtr(m nu4op nlfcils a2rr(moot4oeeomociltla2ulu pnt0tltomrciytoat  ueils  etrir3oudlmeelicil( sDrmxrpou0ope miciydfa2eaumpnu)alerif oadlatelneolt) rtrio3no4op emietl()s2umur nu1oetomf3tadlm2umn s;u0aetrmo tytomtelnvs;t texm(o3ou1aptn nvtlt arrrurpnu0olt mfctatls uaump (0 rtoxo3ootom rlies (0setrirpoy1ol   nct t) rta(root4optoioeiydfa emnvp;(4trenxrctatfptrli s;()srtmio nydamtemictltf Drru poo1aex  feiytla2rln pn(0altrif io1omteaivi t  exrxopiu1om   nctatfa2rax  ;u0aleo fetasfa elu pn(4trermrctytomDraieo;(0t2xmxm3nodllen ncia( aDtrumo;u0tpe if3ilslaDua( o;(4texoir oo1latrluvols)trtmimpio4opte fctat a2uau  ou4aexo fctlsfm2eaumon(4aetoif3iy1fmteau ol(0sexo(m3ny4lpen netls)a2taur nt4alenmf3tysfs rln p t0aetoio tatlp  aiei s) ruoxo3iydameemieilt  2uaump;t4optomi3iadfm2rauvp;t4aetnifcoytlateli s t t2xmxopno4omtnlfvia(faDumx pot0altoii3tlt m2ulnvsnt0 exnxo3oytlm eauvolt)srxr(o3ny4ale  ivtasfaDrru  ou4oeeomf3ildlsDrauvont4 exrmr3iydom raneo;( srtmiopiodoptnmfcsl()s2tmu  nu4olxnmoeils aDea(vs ()alerircta1op   ieo;t)teuoxo3ou1oltemfcsatf rtru  nu0tpx ifeias a2uluvsnu) rtomf3tadoa  luvi s)trxmxm3oodop nmnviat arum(ro;o0aex io3iys m raums;(0 etnmfcoytoa e ues;t0seto(o ny1optemneslsf Dtm(rp;o1teen ocild m ulnvo u0 etrxo io1latr ieo t t2xr(opoudllt lnvs sfsDua(mpot4apxo iciys mDum( o;() eeoxf io1lm r n i;( s2xoio3ny4opte nei (fs2urx oot4tpxo ieilsls um(mo;u4trxoxr iytlpDe ueil()trxmxr iu1ame liesa(  2urx  nt0aee mf3tlsfs ran s u0tetrmf3todom rluei;s sruoio3oodlm elivtatf 2tr(ronu1ope  i3ilt a elnms;t)trenio ia1lpDrli i ( trumxo no1op  lfesat  2urx o;t1tet iiciaslsDrlnvo;t) lxnir oodfatraivil(0teumio3ou1lm n nct sfartr(mpno0tleomfciasla umu on(4aetrmr tatlmtean i;s0t2xm(m3no1amtemivsas  rtmxroot0alxoiocilslmDrl( s;u4 ltrmf oatfpD au sls  2xmxopoo1ap e ivsas)aDtmurpnt0ape iicildlaDrmuvont)tetnxfctatfmtrlnvi;s  2tm(r3nodomte icsl() Dumxmoou1alx iictydla rmnms u) exnxociytlpDrlu o s0texrimpiy4omee icsl(fsDua(monu0opeo octysls umums u0aeermo3tydop   i ols0t2toim3nudole lies sf ruaumont4olen feiasfa2eln p;t0aexoxo3totoa eauvo;(0setmxr nudlle mnet t  rrmur ;o0alt mo3tydfa eau snu)tlxoif3iatlatraueo;(0setm(mpou1ap emfvs t)s2tmu  ;o4tetnmociad mDemnmpn() lxrio iy1opDrau il(0setoxopnu1altnlictl(fsruau oou0apxomietlslm2ulumon(4tltrxo3iatoa eaueols)teto(o3iu4oleemfes s)a2rmu  ot1tex  oeiatls2emums u0altnmrciydlpDelueo s)srxo(m iydlp e icta( srrauro;o0tlx  icias m2uaums;t0 eerxocty1opDr ueol(0sexmio3io4ol  mfeta( sDra(rpot4aet iieias s emnmsnt)altoxf oytlmt  neo;(0t2uo(rpiydopenlies (faDtmu o;o4olenmi3ildfs2el(vs t0 ltomf tytfmt  ivo t0srxmim iy4lp  mict t) 2raumonu4aetnmfctys s um(vpn(4 leomo3todlpDe u sls) 2umir iydame  icta()srra( p;u4aexoif3tldfs2rl(vp;(0 ltnxrcio1omDe ueolt0seumxr3oydameemnvtls aDrax  ;t4tpxniociatls2umn onu4aexrxfcto1laDelnes t0 2xoir3nu1ap  mfetas)srur(rpot0oex iicildfaDrln p t0 lxrxf oydfmDean o;s tetr(m3nu4lleemfeta(faDta(moot0oex mi3ild m2eln o;(4 exnir oadoatrli i t0 exr(o oo4oleemnct sfarra(m nt4olenmoetytlm ra(mp u4 ltoif3iy1omDrlu sl(  exmir no4lp  mnetat)arrrx onu1apxomfcildls2eln p;u)aeeoif3iatopD li o;(  exrxopoudale  fvt t) 2uaum ou0olxnmfctad m em(vsnu) ltnxr3iytlp eau sls  rxrir iydlleemfeils) Durxmo;u0olt  feiys m emuvpnu)trenxo3io1fmDeauvsl(  2urio nu4ll elnei sf Durxr ;t4aex ifciaslmDelnms;t0 rxomfctydopDrluvol()tetm(o oy4ameelivsa(  Dumu  nu4aee mfciysfsDum(monu4 exoxrcoydopte ivslt  2toxrpno1ap e ivs t)arraur nu1apxnifctld m2rm(vpnt4 lenir iydlmtr u sls0t2toiopiy4am elnvi sfsrtaxrooo1olenmfciyd m2elnmsn()tltnif3iodlmDelnvs;()srur(o3ou4lp nmnct s srurx pnt4oexnmfctys mDua(msnt0 eeoxr tadfa r i s;( s2urir3nudlmee ivtas)aruaum ou4aexoii3ils mDrlumo;()arenirciodlaDrauvils)s2urxm3ny1apt liesa(  Drr(monu0apxoiociytlsDea(monu0arenifcoo1fpDrluei;s seuoir iodlleemnetls a2raxm ot0aeeoiociydfaDeanvo (4trxoioctatop   neslt  etm(rpno4omeelfes s srtru ont4oleomocildfmDem(ms u4 eenmf iatla  lueo ( s2uoir iodale livslsfaDurx o;u1oeeo fciadfmDem(msnu0altrxr todoa  ai o ( sruo(m3iudlleemnvi t)s2umxmo;t4aptn feiytfs2ranmonu0alxnir3iy1fpDe nvo;t  rxmim3oo4optnmivsa()s2rrumonu4oet  octydfm eaump;u) ltnxf iatlpD  ivs;t)setoir io1apte nes t  2rr(monu0tlto ociyd s2ua( o u)trenifctadfpt an o s  exrirpnu1apenmfcslt)srtr(rpot4optnifciyd s emnmp;u)tlxrmrctodomD  uvo;s  etrxopnudomtnlnvi sfsDur(r nu4oltnmoeiydls el(vo u0tetnmr iotfa elueilt t2tm(o3oudlmen fetltfs2taxr ou4aee ioeilslaDrlnvpn(4tlxrxoctydfa elivi;(0s2uoir3ny4lltnmnvs t)aDtrx oot0alen fctlsfs uau sn(4aexomf iydlp rai s (0srtrxopoydlle  nci tfa2tmu pou0optnmiciysfmDel(mo ()texrmfctytlm eauei;t)t2to(m 
\ No newline at end of file
@@ -0,0 +1 @@
+ivs ( trxr(o io1lptn ici t sDtax onu0apenmiciadfs2rmnvs;(4tlxnxf3iatla r i ol()t2umxm oudoleemies (f rrmurpoo1apt iieiys a ranvon(0aetrxfciodfpDrln il( truo(m3iodllt  icias)arrrxmp;o1alxo f3iyd s2rm( on(4trxrxr iadlatr ivs ()tetrxr iydam  miei ( srur(  nu4olxoifciat m umnmonu4 lxnxf3tadfm  livo;s t2tmir3nydomeemnet tfaDur(mpoo1opxomieiyslmDrlumsn(0trxrif ta1fp raiei t) eurxr3iy4optnmiesat)sDraxro;o1oetn ietas a rmnmont0texnio io1fmt  i i (0 eumxm iu4olt mivtl(  2taur oo0opx  oetlt sDem(ms u4texnxocto1opDrlieil() eur(mpoo4lm  mfviatf rtmu o;o0ale  ietad m2emn p u) lxomo3oytop e u i;t0trto(m no4olee fcs sfaDtr(mooo4aeeo oetatlmDulnvsn(0tleoxr ia1lpDeau ols  rxr(rpou1lle  fvsl(fsDtmu o;u4aee io3tls m rl(mo;u)artnxrctytoa ranei;s0truo(m nu1lpenmivt sfartmxm ;o1tpeoif3tls aDra( s;()trxnxo3iadfmDelues (0seumim nu4al   ieiatfs2umxm nu0alxn fetasfsDul( o;u0 ltrxo todfpDraueo s0teuo(rpoy1lmt  neia()srtm(m nu1aptniicildlsDrlnmo;t) exoxr oydlptelnvo;()sexo(o3oy1ol  mfviasfsDurumo;t0oee if3ias a2ulu snt4tltrmr3todlmt ln slt0 2urxm ny4alee iet sfsDuaumpnt0oeeomi3iad a2emnvo (4tlerxrctydfaD anei ()seur(o nu4ap n feta(f 2taxm ou0alenio3tydls rmums ()aeenxrcoy1op   nei;s srxr(mpno4lp emnci s)s2umxmp;u4aleoifeiltfsDean pn() lxoxo3tatfmt an o;t0 2umxopiy4olt  fct () Dur(mpoo0olt io3tyd s uau o;u0 eenircty1lp rlivi s  2tr(m ou1am e ivil(faDuaurp;o4tpenmfciatla em(vp (0alxrmfctadlateai s;t0 etmxm nudll nlfvs tf Duax ooo0texoioetatla ul(vo;u0texrirciotlmDeanvo (  2toim iy4apen fesat srra( p;t0olxnmieiytfm uln p t4 eerxf3iy1lmtrlu o s)trtm(r3oy4ole lfvtat  2umxm ;u4apeomfeiadla2rauvo;u0 rtomrcia1lp rlnvi t0s2toim ny4ap n nei (  Drrxrpnu0tex  oetltlm2rm(mpnu4alenxr ootoaD  ivi;t0t2trxo3nu1omenlivi (fsDraumpno0aee  ietyt s2ranmp;t4 eermo3todla elnvols0 2tmxo io1al   fvsl(fs2tax pot4tlx  ieiydfm2ranmonu4 rtnio oa1lpDeln ol(0 etm(m3ny4lme lncs sf 2raxrpou1optomfciydls2ua(ms t0trtnmrcoodlatelneo;s)sexmxm iu4al nmicslt a2tmump;u1opxn ociat s2rln s t)aetnxo3tytlmte ieo t)seuoio io1lptnmnvta( s2urxm ;o4tlxnif3iltlm2ua(vo;(4altrmr totfmD lnei;t) rumxr oy4amtnmnvsa( s2ur(ro;t4apxomfctlsls ea(von()teermfctadlmDeln s t  eumxmpno1llt mfci (  Dta(roou0tlx  ictyt m2rluvo;t) etriocia1lpt lieo;t0t2xmxr3io4lm  livi t)sDtmurpnt0apx iieils sDra(mo;(0 ltrxfcta1omt aivs s t2tmxo3oo4ale mnci (fa2tmx  ot1alxnmoctys a2rmn p t) rxoxr oytoa rlnei;s srurirpnudlm   fetls aDraxronu0oleoifeils m rmu pn(0 etrmo3oadfpt  neo s0 eum(r3ou1ll  mfetasfaDtrxro;o4oetnmfeiadlm ulnmsn()tlxrif3ia1la   uvils) 2umir3oy4llt lfviatfs2ur(mo;o4oeeomi3tadfaDrl( s u) lxoirciodoatrlnvs;t tetm(r3ny4optnmfciatfaDrm( pou4aee mfeilsls el(vo;(4alerxr3iy1oaDrln i s  euo(mpoo4aptelncs (farua(mp;o4aptomictadlsDrl( p;t4 rxrmo oo1fpDeluvo;t0trtr(r3no4ol elnvia()arrrx ono1aeeoio3iatfm eanms t)texoif3iotom rau slt  rxo(mpiy1omtemfvsat) rraxm ou1apxo iciatlm2elnvo u)trtrxocio1lmt  ivo;s  etr(o3oy4omtelfvs (faDtrurpno1aet iieild aDul(vo t4tleoxr oytoaDelnvi s t2xoir oudal  mfciat) 2ra(  ou1oetoif3tysfs2rluvs;u4aetrir3oy1fatrau s;s)trxoxrpiu1am  mnctls) rrru o;o4altomoetyt m uan sn(4tltnxo3iotoa   uvi;()tetoxmpoodoltn fci (farurumpot1oeen iciadls rlu pnt)artoxf ootoaD  n o (0 euo(m3iodop emivsatfs2rmu  nu1tetoifeiytfs2ul(vp;(4trxnio3oatfpt aivolt0 etm(mpiydll  micils arum(rono1tpxnmoeilslsDul(vs;t)artrir3iytfmteauei;s setrxrpno1llenlfcsa()aDtmx p;u4tlx  o3tydla2uluvs u0 rxnxf3ia1fmD anvo s  etmxo nydomenliviltfaDur(mp;t1tptn i3ilsfm uanvp () rermr tatlp  livolt t2xmxr ny1omee fctlt  2umu onu0tetoif3ilt a2elump;t4areoifcio1lptrln o;s)s2to(o3oo4lmenliviatfsDua(rpot0opto fetyt mDumump ()texrxf oytom  livsl( teuo(o3oodaptemfvtat)srtax  oo0texnmoctys a uluvs;u0teeoir iy1fm  lieo;s)srumxopiodlle  fet t  rumxmp;t0aeto ictydfs2rlnvp;u4alxnxr iy1latr nvs;s)sexoxopoo1llte nctlsfsDrmxm nu4aeenmictytfsDuaums t0arxrircoa1fm  auvs;t0seurirpiodoptnliei ( sDtrx pou4tptn f3tat s uan pnt4 eeniocia1opD aies () rumio3oodll e ncilsfarrauroot1alto ieiadlaDemn s;t4 lxomo tatop e n o;()texmimpiudlpte netas s2rmxm ;u1tee  octad s2umu o;t) eenxr3ia1fp raivi ()sruoxm3oodamee ivil(faDrmx p;t0open icildlsDelnvs t4teerifcoydfp  lnes;(  2uoxopoy4optemiei sf 2umx o;o0tetnmfetadlsDrmuvpn()arenxocoytom  an olt0s2urxr nudal nlnvtls)artm(root4oetoii3tatfm umn s;()teermo3totfat auvi;() exmxr3oy1omt mivs (fs2rr(mont1apxoiociysla eln snt0tltnifcta1lmtrlieo;s trurxr oy4olte fvilt  rrrur oo1aleoii3tld a rl( p;(4 rtnxr oadfaD luvi (0teur(o oo4apte fet tfaDtrx onu4apto o3iltfa umnmp ()aexnxr ty1la  lu o;s0 2uoim3io1am  mnct (fsDrrxr ;u1tpxoio3tatlm2ul( ont0 lenif3oy1opD  neilt0s2toio3iudole  ici sfaDtax o;t0teeomictydfsDrmuvp;t0 rxoio oo1lm e i ols)t2ur(rpnu1oltelfvsl(fa2rm(r ;o1aexnmi3iat s2ul( o;(0aeermf todopD an sl()srxo(r oy4lme mieias)aDtm(rono0tltnmociltlsDrmnvp t0tetrxociodlaD  uvsl(0 2xm(m oodlpte nvtas)sDuaxr ;o4olen f3iydlsDea( onu4artomr3oa1fa  lneol(0 exrirpiu4al emnciatfaDrrx pnt0alt ii3iydls2uanvsnt4treomrctotop eaieolt) 2xrxopoydamt lnvtltfaDurxrpnt4alxomo3iadla emuvpn(4 reoxocta1lat auei s s2toxo ou1ale  ici t)srrmxrp;u4aexomietldfaDel(vp;(4 lenir iy1opte nvo;t)texr(o3nu4lltn ietls sDuaxmp;u0oet  i3iydfa rmnmpnt0 exnxfcia1lp eaieil(  euoxr3oydlmtelfeias srumum ;o1oeenmf3iyslsDuanvont)alxnxo totfm rlueilt)trum(o3oudolenmnvt () 2umum nu1opt  fciad a2el(vo (4 eeoif3oodomD  iei;(0 eumim iy1ope mfci t s2uru pnt0apt iiciyt aDra( o;u4trtoiocto1fatrli s () 2xr(rpiu1lmtn nei t) Drmxrp;o1aet mf3iat a2uanmsnu4tlenifcoodfm e ueils0teumxrpoy4amt mics (farur( pnu4olt ioetlt a2elnms t4aetnxr oatfaD anei (  euoxm3oo4ap   fvi (fs2um( oot0opt mictytla2ea(mo;() leoiocty1lp  lnvi s srtr(m3oy4oltnmivi () Drru oot1tlx mf3iyt m2rmnvo;t) eerio todoa rluvi t t2trxr no4lmt mivtas  2taumono4aee ifctltlmDra(vo;(0tlenif ia1oateauvi t  2xmim3nu1lpenlfvtat) Drm(  ot4tptomfcils mDulu s;()alxrircootomDeln o s0 rtoirpny4oltn fvi t  2tr( pnt4apxn icilsfsDemuvs (0 rxrir tydoaDr neolt)texo(m oydlp elnvs t)s2tru oou4tex mfetydls umuvp;u4aeerxrctytfaDe i sl( s2urxr3oodoltnmncsas  Drm( o;u1tpen f3iatfaDumu o;t)tlxnxf totfpDrlneo s)setoxrpoo4lmtelnet ()srrrur no4apx moeildfs el(mp;(4altrmf to1laD au o;s  2umxopnu1alte feia()arraxroot4opeomoeiysfa ulu s t)arxrmfcoytoptr nvo;s)trxmiopoodap nmics sfsDuaum ou1tee  iciad m2um(vo t0trxnmf oadlp rlu s;s) ruo(opno4ole micsls)sDtmu ont1ope  feiltla eanvp (0trenxrctydomte ies t)srtoxopou1op  liviat  rta(mpnt0aeeo iciyd mDran p;t4 rtrmr3totfate uei t0 exo(r3io1omt  ics ()s2tmu pot1opxoiociydfm2eaump;(0trxniociatfp eliesl(0srtrir3oy4ameelicias)srrr( pnt1tpxn ociys aDumuvs;u4tltrxo3tadom raues s  eto(opou4ap  lneiatfsrrr(rp;t4tle iocilslm um(mp;u)aetrmf ootlatelueslt)teurxo no4ll nmicsas)sDtmump;o4tex mi3ias a2em(mp;t4 leomfcoodla raneo;t0tetm(opoo4ap n ncia( aDraxmp;o1tpx  o3ilslmDem(mo;t) rtrif3totfp  lneilt0 exoim no1omee nvias artrxmp;u0alt mfciyslaDumu o;t4 rtomo iy1opte ies t0t2xrir3oy4olen fvta()s2um( onu0olxo i3iltfsDul( s t4tlxriocootoa  lnes (0sexoxo3oy1altnlnvtl(faDraxrp;o1ole io3ilsla eanmo;t4altrif3iy1fpDe uvs t s2umxrpiodape mncsl()aruaxm ;t4apenmicilslm2em(mo;u0altomo3iy1lpt aivi t)setoio oy4ll nlfciatfaDraxrp;o4texnmf3tatlm2el(vs (4 exnmocoodoaD  neo t) 2trir3no4ale micslt) Drmx ono0opeo fciyt s2elums;t0tlxnio oodomtranes;t0t2tm(r oy1lpen fct t)aDtrumpnu1oetniictat a rlumo;t0tlxoxo iatfpDr ueslt0t2trxopoy4lpt  nvt t s2uauro;o0tlt mocilsfmDem( o u) rxoio3tatfaD anei (0 2xoxmpiu4lmt mnvslsfaruau poo0ale mieiltla uln s (4teermf3iytfmDeluvo t sexmio3nodlpe lfesas)s2umx o;o0tpenmfcildla2emnvpnt)trtoif3todoa eluvo;(  eurio3oudlme  fesa(fsrtr(mpou0ope ifctlsla uluvp (0tltoxo oytfpDr ueo;s)seto(m3iy1am nmfeia() 2uaump;t0opeo o3taslm2uanms;t0 exrxf tytfpteanes s0t2tm(m3nu1omeelfvias arurumo;u1olxo iciltla um(mpn(0 lxoxo todoaDeln ols srxmir ny1am e nci s)srrm(m ;o0oeeniocildfa2emnvs ()trenir3ia1faDelivi;()seurxr oudapte fetas  Drm(r ou4opeoif3ias m uanvs t4aexoio todopD ln i;() rxrxo3oo4al nlnctl() Dtrxm ;o0tlxnmf3tad mDuln pnt)trtrmo todlatrln sls0 etmxopno1lpt mfct (fs2urur no0tlxomoetysls2emump;t)tltriocio1latrluvolt  ruoxrpoudlme  ncsl(fs2rru pot4aet  fctltlaDuln snu4texomr3oo1fmte n ils tetoim nu1amtnmneta()artm(r ot1aexo iciytlmDelnvont0aetrif3iydomDranvo s  rur(rpiu1lpe  nesltfarum(  ;t4aex ioctad s umnms t)trxomo oa1late nvo;(0srxrxrpnudomtnlfes s a2ta( pot0apeomf3tld sDuau on() rxnioctytoaDraieo t0s2urim oodol e fcsls  rurxmo;u0tee  feiydlmDeluvo (0tetrxr iydfpDrlnvs t) rxoir3nu4lp nlncilt arur(  ou0tetnif3iad aDul( o u4artnxfctotopD livsl()t2xm(r nodlm n ncslt)aDrmump;u0tpe mo3ilt s raump;t) rxomrctydlatrlu i;s)tetmir iydamee nvsa( arur(ronu4tptoiieilt m2el( s (0 exoxf3io1fa  lnvi (  2xrimpnu4omt mies t) 2rrxm ;o1tetoioeilt a uaums;t)treoio3oadlpDr uvs s0seurimpno1om  mivtl( artau  nt0opx  oetydls ea(vp;u4alxomrciotoptr nvs;()setmio nydlmeemnct t s2tm(  ;t0texo icias s uauvp t4texrioctydlm eli i;s) 2xo(rpnu4amee netlsf Drr(m oo1aetomi3iad mDulnvon(4 lxnmr3tydfa   ieslt  rxmxm iu1lp  lnciltfa2umxro;o4tetnmieias m2ua(ms;t0alxnxo3oytlpt  u i;(  exr(o no1am   ieils) Dtrump;t1aeenio3tatls rluvsnu0 lxnmocoo1laDr n olt) etoxr3nu4altemnesas)srumumpno0opxoifciysla umn o;t4alxnmo3tadfpteluvilt0texrirpnodoleelfvia( sDrau  nt0tpxnmo3tatlm uan s;u0alxnmfciatfmteluvo ()setrio ou1lpt mnctasf Dtaxmoou1apxomfeiad m emu s;(0 rtrio ty1op eanes;s)t2uriopio4apt lfcs tfaDua(r ;t4apt ioctasls uaumo (4tlxnif ootlaD  u ols srtoim3no1op  lfvs () Drrxrpoo1tet mi3iadfs elnmo ()arxnxf3ia1faDrlneo;t) rur(mpoodlpen ivtas)aDurx o;t0olxnmoeilt s2ean p t) eenxo oydoat ai o;t0srxoio3ny4lm nmfcilt)aDuauro;u0tpxnmfeiasfmDeanms;u0 rxomociadlmDe neils) rur(mpoo1opeemicta( srrax  ;u0ope  oeiyslaDulums (4tlenio oy1lmDelues;() rxoim3nodopenlfvta() Dra(ronu0oexo iciytla2umnvpn() rxnif3iadomtraivol(0 rxoxo iodoltn nei t) rur(mpno4opeo fctasfsDrln p t)trtnircoydlmDeluvo t0srtmxopiodomt lfctl()artaurpno0oet iietytla uluvo u4aetnifctatlaDeliei (0 etmir ou4amee iet s  2umur nu1alx  ietlsla ulnvonu0tltrmo3iytoa   nei;s0 eumxo3iodal n icil()srtrxronu0tptnmfciaslmDulu snt)aexrio oa1la elu s;(  2uoxo oudal nmnvtl( sDrmur no1oltnio3tysfs2emn p t0 renio3ta1lp  aneo;s) eurio3no4opeelietas aDrmxrono4ole mo3iatlsDelnvpnu0tltnxocoadfatrlues;(0seuo(rpnudaltelivsasfa2um(m ot0oee  ieiytfa2emuvp;t)aetrxocoodlateanvs ()t2uoxr3ou4ll elfeil( arrmu oot1apen iciysls ulump;(0arxrifcio1omte ivi;( setmxmpiu1ome miesltf 2rau pnt0olt mf3iasfa2rl( snu) leoir oodomD lnvol(0 eumxopnodole mies tf 2rr(  ot1optnmieiad a el( o (4alxoxo3iytop rli s;(  eto(opno1op e fvt ( srrrxm ;u0alxomietysfmDem(mpnt)tltomfcoatfp rluvols0texoir3oudomee fei ( sDumu ooo4ape mfctltfaDel(vo u0tlenxrctytomtr uvo;s  exmxm3oy1opee nes (f Durx onu4tet  oetysfaDea(vs;(4 etrxo io1oatrauvo;t0s2trxo3iudllt miet s srtm(roou0olx  fctldlmDrmuvpn() rxrirciydomDeau o;()t2um(o3nu1lpeemfeilt)aDum(rpot1aexo ociaslm ul(msnt0altoircoy1lm rlueolt) 2xrxrpnodom elivslsf 2tmuront1teto o3iytfmDrau p (4arxomrciydopt  ivilt t2urxmpio1oltelnvil()artm(mp;o1tpt iociadlm2eaums;() eeoxo ty1op rlnvo s0 exrxm oo4al n nesl( aDtr( ono4oex  ieiatfaDeluvo () ltnmo3iy1fmDelnei;s0 exrim iy1lmee netat) Dumx pno4ape mfciydlm2rmumo t)aeenxf ootfmtelneo;s)teuo(r3nu1alee fvs t) 2rm(m nt0alt  oetatfsDumn s u0 rtoir iatlatrli i;t  etmim oydame liviasfaDrrx pou4alt mi3tad m elnvo t0 rxnmo3ty1lat anvslt0sexo(rpny1om nmivil(fs2rm( pou4apt  ocildfm2ua( pn() eenxr oytom  au sls s2umxm3iu1al  micta(fsDum( onu4oee io3ilsla uln pn() lenxoctodlmte ueo s)sexrimpoudoltelfciltfarrrx ooo4aptomoeias aDelnms (4aeeoir tytfmDeanei;s0seumxmpnu1oltnlnet t)s2rmu p;u0aee mi3iatlmDel(vp;t)alerioctytopDranvi ( t2um(r nudom   iet (  rrr(rpou1olxo o3iaslmDumn p;t) etoxo todoaDr n o;( srxoimpiy1amtelfeiasfaDrm(m ;t1olxo ieiytfa2um(vo;u0trenxf oydlm r u slt0 eto(m3iy1ope mfct t s2rm(mooo1aee  fcild sDelnmp t4 lenmr iytlaDeaiei (0trtrxo no1altn fet (fsDtm(  nu4texnmieiydfm eanmsnt0arxoir to1fateauei;() 2toxm3oy4ale lfci tfs2tr(moou4oetoio3ildfm2uau o;u4 rxnxr io1late nvils0 exoxmpiydam  mfei t)a2ta(moou1olxn ocils sDra(mo t) renmf totla r nvo () rumxm nu4ope  nesa( srrmxmp;o4alx  o3ilsfaDrln o u4trxrir3iy1opteluvi;s) euo(m nu1om  mfct t a2ua( onu1tlto iciytfs rm(ms u0 etrifctytlat aivsls)t2xo(m3iu4ol e nvsl(fa2ta( p;u4teeo ocild aDuanvp;u)tetoxo3oydlpDrai s;()t2xm(o3oudoptelivia(fs2um(rono4tleomoctlt a uluvp;(0aexnxo oatfmD  ivolt)srtmxm3nu1ap emfeils) rtrum ;t1teenmoctyd m uln o (0 rxnifcty1omt lnvi;s0seuoirpoo4lpenmnctlt)a2um(mooo0texn oeiadfmDumnmonu) ltrxo3tadoa e u olt  rxoxm3iu1alte feil(f rtax  ;o4oleo f3iytlm um(mpn(0 exrxociadlp eauei;( s2xrimpoodaptnlfetasf 2uaurpno0apen f3ildla2emump;u)teeoio3ootfpDelneol(0s2urxm no4ll nlictat s2tm( pnu1olxomf3ils a2rmnvp u0alxoif ootlp  livo t srtm(m3ou4am e fcsa(fa2ra(ront4aptoii3iysfmDeauvo u) etrmociatfaD  i o;()t2uo(r no4lmenlfcsls) rumxmonu0optnmoeiltfm2ua( sn(0tlxnmrcootla  ai ol( tetr(m oodlp nmfesl() rta( o;u1tlto feiytls rl(mo ()trxrifcoydfm r uvi;(0s2toirpio1opt mfesas) Dtmumo;u4aleomfeild s rluvs () rtomo3iydopteaueols0 rxm(m ny4amtemfvs ()srur(r ou0alenmo3ildfa2ra(msnu4arxoif tatlpDelnvo;t) 2xr(rpiodlm emivia(f Drmumoot4altoif3iat s elnvpnt4trxrxo3ty1op   uei;()s2xmxr3iydapte ncsatfsrrmx  ;o1tlt mfeildfmDemumpnt4artoxo3iy1fpDeauvs t)srtmim3iy1omenlivtl(fartmx oot1tetn ictldlsDum(vsn(0aexnifcty1fate ueo t  rxoir oy4ol nmicsas  2ur(  oo0tpxnmo3tls m ea(mpnu)tetnxr3ta1opt lu i t) 2umxopoy1altn netl()sDrmxr ou0texoiiciadlsDeanmp;u4 eermrcia1oa raueo t0trtrxr iy1lmenmfviat)srur(mono1tltniieiydfs2rm( s;t0 etrmf3oydom  au s () euo(o3ny1omtemicta()aDrrumo;t4apxn octysla2uau s;t0tetnircio1lmDeauesls0t2xrxopio4ome lnvsas)srtr(r nt0oeeomf3tyd sDrlu on(4 exomr io1opDrln i (0 eurim iodop e fcsa()srta(  ;u4tpt iieils aDeaump u) etnmocty1lateaueilt) 2urxo3oy4amt mivtas sDua(rpoo1tetn i3tyd a2ulu p (0treoxf3oodopD  iei s0 rxo(m3iodalenlnci t arta(  ;o4olxn oeiadla ulump;()arxomf3io1lpDelnes;()seur(opnu4open nei () Dtrx pou4ape ifeildfs umn p;(0tlxnio3iodlpt lu o ()s2tm(o3oydope  neta() Dururpno4apxomfeiltlm ra(ms t) ltrmo oo1la e i ols trum(opoydlmen nvtl()aDrmurpnu1tltomfetadfs elnms;u0texoxocoa1omte i o t tetrxr oy4ap  lneil()a2urxr nu0oeeo o3tat m rmnvon(4alenio3iodlmtr ies t0 rur(opnu4lpee icslt)a2raxr ;o0tltoifetaslmDul( p u4altrmfciydfp  li ol( trxrxo iy1aleelivils a2rr( pou1alxo feiydlm2emuvp (0 reoio iotlpt ai i;s0teuoir nudal  mnvilt a2uaurpoo0altnmociltlm umumsnt4trtoifcoo1laDr neol(  rurxm io4oleemnvsl(fs2ta(r oo1aexnmieiytfs rlu o;u0aeermfcoy1fp eliei;s0texm(opoodlleemfvsls)s2rm(mp;o1aeto o3iat a ra(mpn(4 ltomo oodlp r n ils s2xrxrpno4ap n ici s)a2rax oou1opx mfetlslaDeanvont4 lxrmr oa1fpD  u ols0texrxo nudame mies () 2tmum ou4alxn iciytlmDranvs u) rtrxf to1lp r nes s setr(m nydlpe  ncsl(fsrtaxroot0tlx  fetysfa2ulnvpnu4altnmf3tadlmD ai s s0 eum(m nydamte ivi s s2tm(rpou4olen feiysfm2ra(vo;u4aetnio3oodop e u i;s  rtm(m3iodapt mnes (fsrtr(  ;t4oleo oeias mDul( pn()altnmr3iodop e uvs t tetoim3iy1op elictl()srrax o;o0tet io3ildla ul(vs u4aexrxf oa1lmDe i ol( t2tr(opnydomeelfvi t s2uaxrpot0altn ictatlm el(mpnu4tlxoif iy1omDr neols0trxoxr nu1lle lncsls)sDra(ro;t1apeoii3tlt a rmnmp;t4aeenxf totomte ieol( srtrxr3nodam nliei t sDuax pou4aleo fciyslsDrm(mp;u0treoxrcoytlp e uvs;s seum(o oy1ope  fcta(  2rrxm ;o4oltnifetatfaDran snt) lxomfcoa1lp e uvol(0srurxopiudalt mfei s) 2rax p;u4opxomictasfa rm(ms;t4 rxnmo totoa rauvs t sexrxo ny1omtnlicslt  Dra(root0tpto ociydls ua(mo;t) exrxf iadoa raneols0 2trio3no1am n fvs s  rtaxmp;u1apxniociysfsDulu o t4tlenxoctotlm e uvi s srxmimpno1altn fci ( a2ururpno1tetn f3iys m uaumsnu0trtoxr oa1opte nvil() eum(mpoudam  mfvsat)arrmxmpnu1alxoiictytlm ul(mo u4teeoir iatlaD aivols0s2xoiopoodop nlivias)a2trumoot1tpeoioctldfmDrmuvp u0 ltoxo tatlmDr ues t  rtoiopoy4ape  ivt ( sDrrumoou4tlenifctlt m emn o;u0trxoxo3ta1fpte ieo s seto(rpny4ol n nvi s s2umu  nu1tetn iciysls umnmo t4artrirctytlatranes;t srurir oy1omtnlnciasfaDtrxr ;u1texnmiciyt aDemu o;t4alxrxfciadfmtrlivil() 2tr(opno4llenlnvs t  2ur(r ;u4aex mi3ilslmDra(vs;t)arenxo3tytoaDr nvols0trumxm ny4lmt  ieil(fa2raum ;u0tlxo i3ils mDrl( o;u)trerxr oy1fm r i s;s0t2tr(o3io4opeelnci ()sDtmxrpnu4aetnmf3ildlmDuan ont) eeoir3tadopD ai s s0 2tm(opoo4olen ivi (faDua( pno1alt iietad a2uan ont)teeoxrcoa1lp r n i s  2trir nu4apt  ics t)sDur(moou1alto ictatfaDean pnt4aetoxf oa1fmtr nes t  rurxr ny4am nmnct (  Dtaumont1texn f3iasfs2um( s u0 eeoifcoytfp r iei;(  exoxr3nu4omtelivia(f rrruro;u4tlxnmi3tltlm rauvpnu4trxniociadoateaneo;s) etmir oy1lle  nesl()s2rmxrpou0tptoiietlt a2elnvsnu0aeerxf3ta1om  an o;t0sruo(m3iy4op  lfviatfsDtau p;o0ole ifeilslm ea(vs;t4trerif3iadoa  ai sls  euo(rpiu4lm nlncsat s2raurp;o1tpeoioeias aDrluvpnu)altomo oa1lmt anvo;s s2xmir no1opee ietlt)srtm(mp;o4apeomfeiltlsDran s u)tltomf tatla elivs;( s2uoxr3io4om  mfvs s artmu  ot0aet  oeiatfm2rl( s u) reoiocoodfpte n i;()s2tmxo nydomenmietat arrax  oo1ale  i3iltlmDrmn pnt)tlxnmf oa1omtr nvsl() 2uriopnydomt licsa()arrau o;u4tee ifeils a2uln s;t)trxnio3iytlptr uvo;s) exr(o oy1ap nmfesas) rrmxrp;o1oeen oetldlm emnmo (4trxoxr3totlpt aivo (0srto(r ny4ale mici s srrm(rpnt0texoiieildlaDrln s (0 lxrmo totopte ieo s) 2ur(rpiy1alte fcta( srur( ont0tpe  ietldlm el(ms u0 rtrxo todfmt auvols0setr(r io1amtnlfcsas arrrxmo;u4tlx  o3tyt mDemnmont0trxoxr to1op rlueo;t0sexoimpou1opeelici tfsrraxmo;t0opto feilsfm ranmonu0 rtnxr oodlmDrlieils s2tmirpiy1alt mfciat sDrm( o;t4tptn fetaslm2rmu o (4 etomf3tydlmt lneil(0 etmiopiu4llt lnetls) rtmur ou4tpeniicildfs2rm(ms;u0 etnmf ty1lpD  uei ()tetmirpio1optnmfeiasf rtr(  ;u0tet miciasfa2um(mp (4altrmo tadoatrlivs;(0 2umim3io4aptemicta(  2um(  ot4olx iictasfsDrmu onu4 rtnio3tydfpDr u ilt)setoir nu4lltemivsa(  2rru pnt1tptomociatfs2umuvs;t)teeomo tytlpDranvo;()sexoim3oydapen ivs t) rtrumoou1alxnifeiasfs2ranvp (0 leoxo todfmDraivo;t  2xrxmpoydlmt licslt a2rr( p;u4aexnmicilt a2rluvs (4 ltrif3oydfm   uesls0t2xmxr3iodolte nvtlt) ruaur ot0oexn ociytfmDumu ont4 eermf tadlpt livi ( tetm(m3io1al nmicsas) rtr(ront0aexnioeias a2el(vs (4tltniocoodopt luvs;s0srtoim3nudolen nciltf Dtr(rpoo4tle ioctaslmDrau p;t4 renxocto1oa ran il(  euoim ou4aptnmfcsatfs2rrxm ;o4aeto iciyslaDrmnvs u)tetnxf3oadlmt ln i;s0trxoim nu1ape lnvt ( arrmum ot1tlen f3tatlsDrlnvp t4treoxrciydlp ranvo s) eumxo3iu4lp emfetlt  2rrx p;o0oee  fciad a2ea( o t4 rxrxr3oo1lateaivs t0 2umxm3iu4lme mnesls)srrmx pno1ope mo3iatlaDumnmsn(4tlxomf3iotlmD liesls0t2urxm3nodam  mfesas  2rru poo1aee mi3tysfm emn s t0teeomf3tytlp  luei ( srtoxr iodap n nvsas  rurumonu0altoifctls sDum( p t)trxoxrcio1lpD lueils seumiopnudlp  mfcils)arumurpot1aexn feiyd a el(mp u4aeeoxocoa1lmt lu il()trumxo iodal emfvtl()srra(m ;u1alxomfctytfmDumu s ()alermf3totfpt auvilt teum(o3oy4omte fvsa( sDraxrono4oee  fetasls ua(vp t0tetrif3oadfp  li ols) rxo(m3ny4omtn iei (faruau ont1tptomf3ildla uau o;u4 exomf3oadoaDelivo;( setoiopiydlmte iesas)sDuru  ou0alenif3iatfa2rlu ont) rxoifcoo1latr ieo s)tetmxm3iy1apt mfcs ( artmur no4tlt iieiyd sDuaumo t4tlenxr tadfaDrlnvs t texmxm3iy4ll e icia(faDuru  ot0apeo ieiad m umnmsnt)texomf tytom e u ils)trxmimpou1altnmfes (fartm(ront4altoifctyd m umu s u0texnxrciydfmDr ies (0sexr(o nu4amenmneil(fsDtm( p;o0oltn ietyt mDean s;u4 etrmf iy1lp elu i;t tetmim3oudape mfct tfsrur( pou1alx mfetldlm2elumo;t0 exrmociatlaDrai s (0setrio oy1llt mfet () rurxr ou1apt  f3tys aDem(mp t4trtrmo oatopt lu o t sruo(mpoo4ll emfvt sfsDtrumpot1tpe ifctyd sDemnmo t)areoio iydfat aneo (0teuo(m3nu1ll nlics ()arra(mont1opx mictyd aDemuvo (0 rtnxf3oatoptr nvs s)srum(o ou4altemicsl()s2tmu pnu4tpx  f3tydls2uan o t4tetrmrcootoateaneo s0 rxo(m iudll   fci () rraurp;o4texo o3tadfa2rlu s;u)treomf3iotlmD lu i;( srxo(o3nudamtemfetl(f Dra(ro;u0aex  oetlslm emu s () ltrxf tatfp  aivo s texrxo io4lmeelnvil(  2trx pnt0oex io3ils s2uaump;(0alxomf3oa1omt ai ol(0 rxrio3iudolte fviatfa2rrxmoot4tlxo fcilsfm2emuvont4 ltrxo3tatom e neo ( t2tmxrpnu4lmeemnvil( aDurxrpno0aptomfeiltla uanvpnt4trxrmfcoydop  aneo t0trxrxopiy1optn fesltfa2ta(rpot1alto i3iltfm rl(vp u0arenmr oy1faDrlues t0 rurimpio1lp  licia(fa2taum ou4teto i3tyt a rm(monu) rtoxo3tydom   nvs s0truoxr iy1aptelfviltf rtaumoou0aleomi3iad aDran o;u4aleomr3iy1oaDrln ils) ruoxo3io1ll nlfci s sDua(r nu0opxnmictld a2uln pn(4arxrio3ty1om ran ols0t2to(o3iy4apenlfvsatf Dtaxr ;u0opt io3tas s2ulnvsnu)arxnxo iadlm e ivo t)sexrxr3iy1lmt lnetl()sDurxm nu4opx ioeiaslm um( p;(4trxoxrcoy1laDe i slt s2umimpiodamtemfetls sDtrx pou1oet  fciatls2em(vonu4alermr3iytfa e u ilt) 2xo(rpoydol   ictatfsDua(mp;o1apto iciadla2uanvp;u0 renxf3tatoatr uvils0seuoxopno1omeemnesas  2umxmooo1alen o3tyslm rlnvo (4altoxo3to1fmDelieils)setm(mpou4lleelfcsltfsDrmxmpoo1aptoiociasls el(von(0tlxomf3ta1omtrlivi s0s2tr(r nydam   feiasfsDumxmono1oet mf3tad aDeaumsnt)tlenir totomD auvol()seurxm io1op e fet sfaDtm( oou0texo i3iltla2eanvs t4tlxrmo totfptelneo t0truo(m iudlptnlfvt (fa2uau  oo1tetomfeiydls rlnmsn() leniocty1lpt  ieol( teum(m3oy4lm n ict sfsrumurpou1olxnio3iadfs uln s u)aexnmo tytla r neo (  2urir3nydame  ivsltfaDtmx  ;u0alxn feiadfmDuluvpn(4aetrio todoptr uvsl( sexmiopiy4oleemnvsltfartmu  ot1altoiociat m2emumo;t)arerifcio1fmtrau s (  etmxo iu4ape  ncsatf 2uauro;o4tpenmiciytfs umu o u4teeomf3tytom elnvo;( srxrxm iy1open ivsa( a2trumooo0tpxomoctls m uanvo u4 eerif oatop raivo s) eurxm3iodalenlneilt sDtm(rp;o4apeomi3ils s elumo ()tetomr3tadop rai o t) exo(m oy1ape  netl() Drm(mooo4olxomfetatlm rau onu)areoxoctytlm  au i t  eto(r ou4aptnlfcil( srtaum ;u1ale mieiytfm2el(ms u4tetrmr ta1fm r n ilt)trtoir iydalenlfcilt)srrrumo;t1alto f3ils a eaumpn(0trtoxf3iatlmte i sls  2xrio no1lp  lfet tfsrta(mpoo1apxoiieilt a2eaump;t)alxoxf tytoa  ai s t texmxopoodap nmfesltfartrxrpot4open f3tldfs2ea( p ()tlxnxo iy1oa rauvsl() rto(o iu1lm  mfvs ()a2rru ooo4oeeoioeilt sDrm( p;t4tlxnxr oytopDrai i t0t2ur(opiudomtnmneias) rrrum nu4ape  ociadfm2rau o;(4trxnif oadomtrlivs s0t2umxo nodam elics t)srrrx  ;o4tpxoifeiatfs2umn p;(4alxrif3iotop  aues;()truo(opou1ame lnesa( sDta(rp;o4tetomf3iasfsDel( pn()altnif3io1omDr ies t s2tm(m ny4om nmici s)a2rrum ;t1oleoif3ias s ea( o t)arxrxr3oy1fp e uvs (  eumir3oodoltelicil() 2uru oot4apx if3iydla um(mp u)aleomf3ia1lm raneo s0sruo(o nydlmt liesl(fsrrrx  nu0aeeo ietlt sDemnmp;u0aetomo ta1op rlivo;(0teum(opny1ap e iesatfs2trx p;u1olx  fciyd sDranmsnu4teenmr oodfmt livs;s0 exoiopoudam emnciatfs2rruro;o1aex mfciyt s2emums ()trxoxr iy1opt  n o;t  exmxo3iy4omt lnesa() Dumu  ;u4tlenioeilsfaDel(mpnt)tlenir3oodlptranvol(  rum(r nu4lltn ietlt arta(  nu1alxo oeils m rm(vp;t4aeeoxfcta1omt  i o;s trum(m oy4ape lnet t sDumur nu4oleo fcilt sDranmo;u0 lenmrcia1omD auei;s setoxr ny4lpte fciatfsDtmuro;o4tpto feilslsDran p u) lenir oa1lmtrlnvsl(0 eumxo3nydlm emnvtltf 2rr(rpnu4oet io3tytlsDulumsnt0artnif tatlaDeaneils  eumxrpio4lpeelnvsl(f 2rmx p;u4oexnmoctldlm2ranvon(0aetrxrcoo1optr iesls trtmxr3oo1opt  fvi t)sDtmx o;t4ale  o3tls aDua(msnu)aexrmociotlmteaivs t) 2toiopiy1lpenmivtls  Drr(mp;u1oet  o3iaslm2ea( p;u0aexrxo3ta1op  lneo;s) rxoxo3iy1lmenlnvsa(f 2rax pnu1tpto oetadla ea( on() etnmr3oa1faDelivslt) exmim oudal emics (faDurxm ot4olto i3iltfs rmnvs;u) eerif tytopt aueslt0trxmir3no1olenmfeilt a2tr( p;u0tex  f3tltfs rmuvsnu) eeomf oytlaDeauvs;s  euoxr3oo1ol emieilt s2rm( ont0oeeoiiciydla2uaumo (0aexnxrciatomte nei;s0srtm(r iodale livia()artax onu0tpxo fciltlmDelnvp;()arenxr iadlptelnvs;t  rxrio nu1apt lnctl() 2urumpno4olxoii3tytlm2rln pn(0 ltrmr iadfp r uvolt0t2tmxopiu1lle mnci ( s2rm(  ;o1ope ioetls a rmn o;u4aetoifcoydoa  an o s)truo(opno1lpenmfet t s2tm(  oo0aleomoeiyt m2umn o t)tltnio3oytopDrlieo;t0tetm(m ou1op emncilt)sDur(r ;u0tpe iieildlaDemuvs;(0teenxf3oodoa e i i;t0truo(m3ou4llenlfcil( a2tmxm ot4open o3tasfs2rlnmonu4alenmf ootfp eaieo;t sruoxm3ou1lme mnvsl() Drrx  ot4oeenmictasfs2umnvs t4aleoxr to1lpD aivo (0sexr(o3oo4olen fcsl() rraxro;o0tle if3tyd sDrl(vs (4trxnxf3tatlpt aneo t0sexmio3ou4ll emncsltfaDrmum ;u4tlenmiciad mDrmuvo u) renxrciydoaD  n s s)sexoxo oo1omee ivta(  rtmx pou1opxomf3iytlm2rm(vp;t4teermo oytlmD  uvs;s)s2toio oudlpe lieias)sDuru  ;t0aetnmociytlm2emumsnt0teenmocto1fmtelu sls0s2trxm oy1lpe mnei t) 2ua(mp;o0opeoifeilsfaDemnvp;t4tltrxrciotfpDrlnes;(0t2uo(o oodalee ics ( sDur( pno4tex  fciyd a emuvo;(4 rtrxfcoa1latrlivs ( srum(rpoo1ll nmivia( a2rm(  ou0apx  f3iad sDem(msnu4tltnir3tadfa rlnvs;t)teumio oodop nmfesas aDta(rpno1olenmf3iysfm2eluvs (4aeenmo oodlm  auvi ()teuoxr io4ole mfeia( arua(r ;o1tpt mf3iadls uanvs u) etnif oa1fmD lu o;()s2xoio nudol nlfeilt  2uau pnt1apx  fctatls2ulnms ()artrxfctotlpDrauei;( texo(m3ou4aptemfvslsfsDtrx  ;o1tlt moeilt m ea( o (0 eeoxr3totom  ai o s0 rtoio3oo1lm   ictas srtaumonu4apxn f3ild sDem(mpn(4trerxfcoadomDrln olt teuo(o no1ll  mnesa()aDrm(mont1tleo f3ildfs2umums (4arerio3ootfa   ieo;t)sexrim3iy4lleelncs (faruaxr no1apxn i3tydfs2ea( p;u4artniocoo1omtelu olt0teuo(r3oudale mfcs tfs2ta(m nu0aptoioctys mDemnmp;t0alerxr iytlmD lues;()s2uo(o3iydap  mnesat)aDtruront0alxn fctlt a2raumo (0 ltnmo oa1omD  uvolt)trum(r nudope mfes s aDra(r ;o0aex mietyd mDranvsn(0trxrxr3oatlmtr n o;s  rurimpnu1lpen iesat)sDumum nu4tle iiciat sDrl( onu0trenmfcto1lmD livi;s0 rum(r3no4lm n nvi (fa2tauronu4tpen ieiasfaDulump (4tleoir3oatlmte ies t setr(o oy4omt mfvtas s2ur( p;u4tlenmieiydfsDemnvsnu0 rtomrciatlpDrlies;(0s2umxr io1ap e ics ( a2tr(ro;o1tlt ioeiydlaDranvs t) lxnio3io1fmteaivol(0t2trio iy4lm e ncsls)a2umurp;o1aex moctasfaDuauvsnt4 leoxrcootom ranes t truo(m3oo1lp  lnes tfs2rrumont1apt micildlm rmnmon(4 rxoxo3iytlateaneolt)seto(r3oodoltnlfvsasf Drrur no4alt mo3iatlm2eau s;t4 reniocia1oatrlnvil(0truoim3iodom emnvtltfa2urx ont1olxn ictlt sDuauvo (4 lxnxrciotlpte u o ()t2umim3iydoptnmfcils)s2uru poo1opxnmoeiad sDrl( o;t4aetnmo3tydfp elu i () rtrxo3nydam nmfctl(fsDta(mp;o0tlx  oetad mDul(vo t0 rxnmr3oadlpte n sl(0 2trxm ny4lleemivsa() Durxronu4tlt  o3iltlaDrmuvs ()aeenmf3oatomDe iei t0 rxr(m3nudlmenmieiltfaDua( pot1aetnmo3tyslsDeaumo (0 etriocoydfpt  ivo;(0tetoxo nu1amee fet sf rrrx pou4oltnmf3tls aDeaumo ()arermociydfmteanvs;t) 2xriopiodlltnmiesl(fartaum ;o4aeeo fetydlmDumuvsn(4 eeomr oy1omtelieol()s2xmimpnodol elfvs s)a2tmum ;u0tpxnmfeiad a rm( s (4aetrxr3oydoaD  n s;t) eto(o iudap emnvtat  Dtmxm ou4olenmf3iysla2umnmsnt4artnxo3ia1fpD  ivs s0trtoir no1op nlivils)arrrumono0optoif3tltls2ranvs u4 ltomrctadopD  nvs ()srxo(mpiu1ale micil()s2rm( pou0tlenmfetydlsDeluvont)trxomr3tydfp r u ol(0 rtrxrpoudllt  icslsfsDumx ooo4oex mo3ils s2ulu snu)tetrxf3iydla r ivi;() ruoxr oydomt mfctl()aDtru ont1aet mo3tasls ea(mo;u)aexnif3oodlatrln s;s t2umio3ny4ll  lncsa(farrm(rpot0tetnmocilt aDuluvo;(0 eeoio iy1la   uvils) etmxm3ou4aleemfctl( aDuau o;t4tlxomiciatfa2ea(vo (4treomo oadop eauvilt0truoxr nodlpt mivilsf 2uaxrpnu4tpeo icildfs rlu pnu) rxnxo3oo1om eln i;t) rxrir3io1olt  ieil()s2rmurpnu1opt mieiysfs rl(vpnu4areomr3ta1oa  lieo s)setr(m3iudamenmfvia()aDtax  no0tpt iieiltla eaumpnu) eenmf3tydlaDraivol()srxr(r3iu1apee ictl() 2uaxmo;u4alt moetlsfmDelu snu0trenir oy1lmtran sl() exoxr3iy4altn fvsat aDua(mpnu1tptnif3iysfs emu p;u)tlenioctytomteanvo ( t2toir oo4omee icsls)a2uaur ;t1oeeoiicildfmDuluvp;() rtrif3iotomtr ieil( teto(r3nu1ll  mfvs t) 2raum no0aexo ietltlmDrmump;(0tlermf tydlaD auvo;() rtrxopoydal  mnvs s  Dtrxr nu0tlt  icilsfs uanvpn(0teenmo iatoaDelnvs ( trxmxo3ou1llenlfvtat sDra(rpot4aleoiietlsfm um( pnt0trtomo3iytlmtean i;t0sexmim3iy4op  lnvi (faDumxro;o0oee  f3tytfs2emuvpnu)aetrmr oy1omDelu s (0teumxm3iu4lm elnvs ( srtrxmo;o1tlto feiyt a rmn s u4 ltoxo iodfa   u olt0s2tr(o nydam  mfeta()srtmurp;o4alxn o3ilt s2elnvp;(4artrmr3oa1oatranesl(0 2xoim iodol n fvils s2tmxmo;t1tlxnmf3tas sDelnvonu0trxrir3oydop eluvo (  eto(opiu1amtnmfetltf rtrx p;u1aptoifeilsfs elnvsnt4tetomf3iodlmt  u s;( s2uo(r oodlm elnctatfsruaxrpnu1tlx mf3iydlsDuauvo;u0arerio ootfa  ai olt) etmxo ou4lpee nesls)a2tm( o;t4alxoii3ils s ra( s u) lxnxfcoa1oateanvi t0texm(opiodap nlfei s)arrrxr no4apxnifcildfm el( ont0 lerircta1lm eauei s)sexrxrpoy4lp  lfviasfaDuaumoot1teto i3iytfmDulnmo u)tltoirciatfaDeaieolt) 2urio oy4op nmfeta() 2taumonu4optniociydfa2ua(ms;(0 etomr3oydoat  u i t0 rurxo no4ll  lncsl(  rtmu  oo4tpxo i3iyslmDeluvs u)artoio3todfa  li o t)srtmir3ny1omt  fcia( srumxm oo0tpe mieiytls2umuvsnt4aexomo ty1omDe nvi;s0s2tmio ny4ap emici () 2taur ;u4alx if3iaslm eanmo;(0trtrmocoodlmDe iei;()sexo(m oy1op  lfet t)sDrmxrooo4tlxnifeiysfa rl(vo (4teenmrciodfmDe ies;t  rxmxm nu1op nlnci t)sDtrumont4olx  i3iyslm2uauvo;(0areoxrctadfpDe uvsls setmim3ny1op nmnciat)artrxrono4aet iociyd s umnvs;t0tlermr3tadla rlnvs;(0tetr(r3oo4lp n nviltfaDtaxro;u0tlx  octydfs ulnmo;u4arxrmoctytoaDe n s;(0 rtm(r3no4altemfvt ( sDtm(mono4oee mictydfm raumo;u4arxrmf3oodomt auvilt  rtoimpno1lltemfeiasfaDur(m ;t4tpt if3ild aDul(vo ()aexrio to1oa raueols) etoxr3ou4altnlnciltfaDuax oou1oleo feiadlmDean pnt)arxrxocty1lateaiei (0 rumim3oudalee netlsfarrrur oo1tlt  o3iyd s2eauvp;t)treoxr oodoat li o s)t2urim3nu4apen fvt t a2tru  no1apx ioeild aDrm( o;() rtoircty1fmDrlnvolt t2uo(o iy1lmtelnvsasfs2ua(rpot0altomfcias m2raumo t4 exoif3iy1fmD anes s0 exoim ou4alen ivs (  Durxmoot4tlt  feiysfs2ran s t4altrmrctydomtr ueolt seumio3nydolte fct tfs2rm(r oo0olx iocilsla2um( sn() rxoir3tatfat  uvs t)sexmxmpnydlm   ietatfa2raumpnt4tpto o3iatfm el(ms;(4arxnir3ia1oa rauvo ( teuoxm iodapenmfvtltf 2ua(ro;t1aet  o3iysfs emnmont4treoxfcoydlaDr neilt) ruo(o3ou1lmtnmfeiasf Dumu  ou1aptomoeiatla2uaump;t4aeenmrciy1laDr ues ()t2xoiopio4amenmnes sfa2umurpot1olt mfetatfaDulnvsn(4 ltrmfctotfat anes;s)s2xr(rpiy1alte feilsfsDua(ront0opt  ieiadfa rmnmp u4 rxoir totop e ieo;t0trxmxrpnodop  mnvi t aDurumoou1texn oetadla2eanvpn()arxomr3tydlaD ln i (0seurir oo4ol elnet t)a2uax oou4teen feiasfs2emnvs;u0 exomo iotfaDrauei;s0 euo(mpiy4al   ietl() Dta(mpot0altoioeiltls um( p t4 ltrio3totfmtelivi t0 exrxm3iy4lpt lict s sDtrxrpou0aleoii3tydls el( s;t4trtnmr3iydfptran o s s2xmxm iudlle  nct s aDtmu o;o1tetn i3ilt s2elumon()alxnifcootoa eaivi;s t2xmxm ou4lpte fvsls)aDraxmpno4tlxnio3ilslm rlu p (0trtnxocoadopD  ieilt sexr(o3oodol   neslt  rumurooo4oeen f3ilsfs ua(vp t0 rtnmrciadomt  ieo t) euoxrpny4altemfvsls)s2urumoou4tex ioetyd m ranmo u4 eerifcoy1fmtrluvsl( t2tmxrpoo1op emnetlsfs2um(ronu1olxoif3ils mDra(mpnu0 rxoxrctotlmtrlies s t2urim iydopee fcs (farur(  no4teto icilsfsDea( snt4tlxomfctytopDeauvi (0t2toir ou1ame  ivs sf Drmxroot1tlxoifctlsfs rlnvp u0teermrctotfatr uei (0srto(opoodlm  mieilt)s2rmxrono0aex mfeiytlm2rl(mo ()arxoifciytopD  i i;s0seto(r3nu4amtnmies t srraxrp;o4alt  feiltfm ulnvp;t4trtoxrctadomDeaueo;(0s2xmxm nu1aptemies t a2taum no1ope if3iadfa em(vpnt0texrio3tytopD luvo (0t2umir3oydlpt miet s s2trurp;o0teeoif3iysfsDelnmo;u4teenmo iydfatranvi (0srurio3io4lle mfctls s2uaxmo;t1aeenmoeiasfmDrmn s;(0alenxf oatlp  livo;t srxrir oy4lpe mfesas)sDum(  ou1aeeo feilsfa emnvpnu0texoxfcoatlptrlu i t)t2xrim3iy1oltnlieslt)sDra(r ;o4alxoif3tatfm ra(monu4trtnxociy1lmD  i ols t2xmirpiudopee icslt srur(m ;t4tee  ieiys a2emuvp u0alxrxrctytoa r i ol(0srxrxrpoo4lmtn netls) 2ur(rooo4aleomoctlsfa rl(mp;t4trxomf3oa1fmDe i s () etmim iu1op emncil( s2tmx pnt0tee ifcilt m2el(von(4tlxoxociodoat li s;t trtr(m3nu4llt mnvsas) Draur ot4aexn i3iatfm uluvs u)treoxf iotlm e ues t)seuoio3oo4al nmfvi tfa2umxmpou1tpen ocilt m2eau sn() etnxfciotlp raiei s trtmxm nudap  mfvilsfsDraxmont4oet ii3tat m ra( p;(4aexrif tydlptean i s trxrio iy1omenlicsas  Dtru p;o1alxo o3iat aDemnvonu0treriocoo1op  luvs;(0 rxrxm3iodlpe  fes t  Duaxmonu4oetn fciysfaDrl( sn(4trxnmo3tadlpD  u i ()s2xr(m3ou4ol elnetas) Dtrumont1texo i3tltfa umuvpnt0tlxriociodfp   ivs ( trxrimpnu4lme mfcia(fs2taumooo4oltn fciasfm2emuvp;u)trtnif tytom r nes;t) ruoxo3iu4op  lnctasfarrmump;t4oexnioctasla ran p;t)areoxo oodlmDeauei;s t2uo(r oodap  lneiltfsDuauroot0tpeo ociysfmDuaums;t4texomf3iotfpteauvilt t2umimpoodapeemnci (fs2raxm nt4oetnmi3tld aDra( on(4alxnxocoodoaDeln sl(0 2uoimpiy1am   fvsa( s2umxroou0aex  feiydfs2ra(vp (0 lermrctodfptrau il( t2urxr oodamte fvi s a2urxr oo0tlt mietlt m2uluvs;()tlerxf oytfpteanvsl() exoxrpny1lptemict ()srurx o;t0opt ifciyd mDrmuvo;() lxnircoydlm  li s;t sexr(m3iydomt  nviltfs2umxmp;t4alx  o3iyt s elu snt4 etnxr3tytlate n i;t0 etrxopnudaltemicsas)aDtru ooo1aex iieiasls2umumo;(4aexoifcoatfmDraivsl(  2ur(o3nu4ape lfctl(fsrua(mpot4tptn fcild sDul(mpnt)tltoir oadfm   nvo t0trum(mpnu4lmen ivt s)aDtax poo1aee iicias s eanms;()arerir3ia1faD ln s;t  2urxm3iudll   ieslsf Dumu  ;o4apen f3ildfs2ul(vont)arenxf oatfaDr ueol( srtr(rpoydape lnetlt)sDtaxrpou4olx iieilsfa2rln pn(0 ltoxfcty1fm eaieo s0seur(rpny4lpen neslt srta(r nt0tetoifeiadfs2ea(mpn()tltrir3totom   ieils0 ruo(o3iudlp   fct s)s2rm(monu1openmi3ildfaDuanmo;u0aexrmrciotomt  i o;s sexm(r3io4optnlnvt (fs2tm(  no1oltn ieiasfsDuluvs t0 rxrio3totlpD  u s;s)s2xmir3oo4am   nct ( sDur(  nu1tpt if3iydlm ea(vp;(0texrmrcoatfp  aneslt)setmiopiydlpenmfcsls arrrumo;t0ope  i3iltlaDum(vonu4altoiocto1opDrlueo;s)s2uoio nu4lpen icta(fsDurxmp;u1oeenmoetytfs elnvont4altnxo3iadfat  uvo;()t2xoxr nu1omt  ncsat) rtrx  ;t0oet  ictltlsDrauvonu) exoiocty1omDrliei;t) 2to(mpny1ole mfeia() Dua(mp;u1aexo fctytfsDranvo u4tltnif3oo1op   ivi;s)t2umim3oo1apenlneils arra(ro;o4oeto feias s rmuvo u4aetrmo oydfa e n sl() 2ur(o no1lpt  icias)s2tmumonu4apxniietysfaDelump (0 ltnifctatlmt lneol(0 etoim3iu1op   iciatfartm( o;t0optomfciydlaDraumo u0 exoirciotfm   i i s trumxrpoy4ll n fcsasf 2rau  oo1apt ifctatfs uaums u4arxrxocoa1lm r n ilt0srxo(mpiu1amt liei s  Dtrxrp;u0texoifctasls ua(mo;u0areoxo3ootomDe ivi;s seur(o3oo4omtn iet t  2tmxm oo0tpxnmfciasfaDum( s;u)tlenxf iytlatrlueo;s  exrim3iy4ame mneiat)a2rmx poo1aeen fciad aDeluvp u4tetoxr3oytlaDeaueslt trxrxrpny1am e iet s)a2um(ronu4oexn i3tat a2um(mont4 eenxo3oo1oaDrlies;s0 2umxr iu4apt lici (fa2urx ooo0open ieiytls2eauvsnt)aeermr3oa1fpteaivs s sexm(m iodlm  mfvias)s2uaxmp;t1aptnio3tatfs2em(mpnt0 ltoxr3iotopt an sls0t2uoxrpiy1lpenmneils)arua(m ;t1aexo feiat sDrln o (0teenxrctytomtrln i s)truoxrpou4lm nlneilt aDtrx o;o1olx mo3iytlm2em( s t)tetrif3oydopt  neo (0t2trir oydal elnetasfa2um(mono0opxniietldfa2rlumo (4 rtoxr3ootomD aivo s)trur(r oo1ll emicsls) rrmx pou0tlt iocildfa emuvonu)trtnmrcto1lptran ils sexoxr ny1lmtn iviltfartmxro;t0apeoio3ildfmDraumpn(4aeerxf3io1lmt aies ( t2umxo3iy4op nlfesls)a2raumpot1apeo feils aDuan o;t)trxrxr3oy1fp rauvslt t2umxo nudamtnlncilt  Dta(mpou0oeenif3tyd a2umump;u4 exoxf iadoatr nvs;s0srxoim iu1ale  icsl( s2rmum ou1aleomoeiatlmDulnmp;(4aetomociydfmDr ivolt) 2uoxo nodlmt  fet sfsrrmuro;u0openmoetld aDrmuvo;t0trtrio3tytlm  aies;s) 2urxmpou1lmen icia(f rua( pnt1tpe miciyd a rau o u4altrio iy1laD ln o;s0trumirpnu1amt lfei sfartmxrooo4olxn f3iad a el(vo;t)aetnio3oodlatr ieo;()trtoxmpnodoltnlies (  2tru ono0ope  i3tasfaDemnmp t) rxriociy1om elnvsl(0 rtr(m3no4ll emieia(fa2ra(mooo1olt mo3iatfm2uauvs;u4trxrifcoo1op eai sl() ruo(o oo4apenmnesa(  rumxrono4alt  o3tadfs2ra(vp u) eerifciy1fp   ivo;(0 2xm(o oo4lmen nci ()sDrrxrooo4apx  i3iatlsDrmumpnt)trerxf3oatfpt ai i s)seum(rpio1apt mncs s  Draxr nu0optnmoetasfsDuln o;u4aeeoio3iydomtelnvil(0 2urxo nydlme mncsasf Dur(  ;t4apxo f3tyslsDrmuvo;(4altrmf3oodfmtr u s t srtoxo oy4lmte nvia(fs2ua(r ;o4altnifeiad s2um( p;()aeeoioctatlptean o;t0 rtmxr nu4ap   nesatf Durum ot1tpxo fctyt a uau p;u)treoxo3ootfp rluei;( t2uoio ou4op  liesa(faDrr( ooo4tetomoeiadfa ulnmp;t4tetnxr3todlpDr n i s0 eurxmpny1al emiesls srur(m ;u0tpenmfeiaslaDemn onu0altrmf iadla   n ols0s2tr(mpnu4lptnmnvsatf 2umxr oo4apxn ictasfa2ra(msnt)aeeoxr oydomtr uvs;t0 rxrxm3oydal n nvsls  rtr(r ou0oltnio3iytlm um(mp;u0aetoif3to1fptr nesl( s2xr(m3iodole mfcsltf rra( p;t1tptniocild s ea(mp;(4 etrxf3oy1la raivols0t2tmxo3iu4ap  liet () rrrx  ;o1opt mo3ildls2elnmo;t4teerxocoydoa e uvo;t)srtmio3oy1oltelnctl(fa2tmumpot1openiociat m umu p;()tlenioctatfaDe uesl() exmxr oodoptnlfvilt a2umumoot4aee iieild sDrmumpnu)aleoxr ty1oa   n o t0trumim3iu1am nlnvi (f 2rr(mpnt0aexo iciasfs2um(vo;u4tlxnio3iytlaD aneols srumir3ou4lpeelnetl()aDtmxrono1alxnif3iyt s ulumo;u4artrxfcoadlatrlnvi s0seum(r ny4ame  ncsl()arur(mpot4oleomoetasfsDrlnmo;t0aeerxr3oa1fpDe ueo;(0s2xoio3iy4omeemfvilt)aDta(r nu1opeoiieiat a el(vp;u0tetomrctotlaDeaies;t trtmxmpoydolen icil() Duru pnu1aexo fciad a2umuvs t)aexnmocia1lptr n o ()s2xrxopiodap n fetlt  rtrur ou1oee mfeiysfs2rm( p u0tlerxr3tytfm   uvol(0texoirpoy1am  mfcta() rrrumoot0apenioctlt a2ra(monu4 lenifcoa1fmt anvs s s2trxr3ou4lmtn ivil( srrmx pnt0ole mfetasfm eluvsnu)artnxf oytla ean ilt0t2xrim3oy4omtnlict t aDrmum oo0oexomfetad mDrmu snu)teeoio to1fa r neil( s2xoxmpiu1ll n icil() Drm(mpnt4oexo o3tytfm2eaumo () ltoio3oytla   ueo;s) rurxopiodlpt  ncsls sDtru o;o0tpenmicild a2ranmp;t0texrxfctydfpDrlivi;t0trurxo no4lpenlivs s a2trur ;u4tltomictat sDrm(vs;t0 leoio3todfm eln o (0seuoxrpnudomee ictl() 2tm(mpno0optnmictld mDulnvs;u0altrxo tadfmD  ivs;s t2xrim3oudllee nci sf Dtmurp;t0tee io3ilsla2uluvs (0aexnmf oydfat liesls)trurio3io4al nmiesl( srrmurpnt1oexn iciat a2ulu s t0aetoxrctodfmDe n sls0trxmxr nu4lm emicslsfartmxro;t0tpxn iciydfmDuanvs;(0trtoxfciydfatr nvo (  2tm(r3no4llee netl( aDra(mpnt1tlxo i3iadfa eaumont4tlxnmrciotfpteaivo;t0t2uoxo3ny4ap   fvt ()arrau  ;u4aexn fetltls2rlu o t4arxnxo3oodfpDeauei s)t2uoxopiydop  lnvs ()aDumxmpnt4apt mf3iatlaDua( ont) ltomf tytfaD  n ol( t2ur(o3oodame  fcs (fs2taxrpnt4aee io3tlslaDuluvs;u0treoif iytfaDeauei t0 2trim3nydape mivi sfaDtm(roou0apx iicilslmDeluvsnt)altomf ootfmte uvs;t)seuo(o iy4alee icslsfa2trurp;t4tlxoiieiysla2ua(mp ()alenmrcoa1fptelneil(0s2tm(o nudol  lnetlt  2tm(ro;o4oexnmoeiat m umuvo (4 leoifciodfmt luvo;s0seum(o3iudap elnetls)arra(root4tlxo i3tadla uaumpnt4tlerxocta1lp  an o;s0 euriopiodolt  icsl() rrauro;o0olxnioeiad sDel(mp;(0aeeoir3iy1lp   ies;t  2to(r3nodaptnmnetltfsruax  ;u4texomfeiasla ea( s;(0tlerir oatlatelivols0t2xo(opiu1lm  mnvs s) 2urxrpno1altn feiatla elnmo;(4tetnircoa1fa eli s;(0trurir3ny1amenmnciat a2tmxmpno0alenmfcilsfs2elnvonu0tltomf iotlaDr ivi;(0srxrxr oudlpe mnvi s)aDur(  ot4aptoif3iasfm emn o;(0teermr tydfa eaues;t0 rxoiopnodop elfvtlsfartrxmont4tlx  oeiasla umuvo (0 rtrxo ta1oatrln s;s s2tr(rpiodol  mfviat)aDur(mpnu1alen ieiltlm rl(vpnt)altnmo todfaD  ivs;t) 2uoirpno4ol n fvias sruaxr nu4olx  ietaslsDea( o u)aeenxr totfm e ivilt0 rxoim no1lltn ncsa( srua(rpoo0aexnmi3ild sDea( p;()aexrmf3tydfp  aneils)seuo(o nudlptn fetls)aDtmx pnu1ape iictasls uanvo;u0 rtrif ta1laDeaivi;s0s2ur(o3iydlp elfeiltfartmx  ot4altn fciatfs2ul(vpnu4 renxf ia1lpD lnes s) ruoxm3nydom  livsat) 2rm(rpnt0texoifciltfs um(mp u) etrio3oo1fm ran s ()texrio no4lmt  ictl(fsruaxr oo1apxn ieiltfm elumsnu0arxnmoctytfmtrau i;t0 2toxm ny4op   icil()aDtmxr ;u0olx mictatfmDelnvpn()tltnxrcoytlpte n o s)srtr(mpoo1omeemivslsfaDrr(  ou0tptnif3ildfa el(vs;(4tlenio3oa1oa e ivils0seumim oudaptnmics t a2rm(  ;u4texnmieildlm emn snu) reriocootlm  aneo t0 2urxmpny4optnmict t aDra(mp;t1aeeoio3iysla2el( s (0 etnxo oytlmDelivolt)tetrir3nu4lpe livt s)s2umu pnt0tlx  oetld sDulnmp;(4 eermr oodoaD au ol(  eur(o3iy1omen fviltfs2ra( ono1apenii3ias a rmnvo;u4teermf3tadfpDe n o s)tetm(o nudol  lfcs (  2tauronu0tetnii3tasla ea(vo;(4teenxocto1laDelieo;(0t2toir ny1lm elnvs (  rua(rpoo0opxomoetlsfa2ran snt)alxrxf3tytfatelu ilt t2trxm3oydlp  mfvtls a2uau pou1ape io3iyslaDuanmo;t4artnmf3tydlpDelivols)srum(o oydamen nciltfaDua(r ou4teenmfeiysls2eanmp u0trenxocoatfmtr ivs;(0 exmio3io1ope  ivil() rrm(m nu0aexo ieiasfaDum( ont4alxrmf ty1omDe neils s2xoxrpnudomenmivil() rtm(mooo0tpenifeias a rl(ms;t0tetoxfcoodoaDeanes;s texr(o3iodop nlivtasfarurumono1tetnif3iltla2rmn pnu4aeenif3oa1fp elu s;s0 rxoxr ou1ape lfvils)aDuru pnt0apen ieild aDuanmpn(0 etniocoydom eluei;() etmxopoudol  lietlsfartm(  ou0ole ii3iltfa2elu pnt4aexnxfctatoa eau i (  eum(r nudope lfvt s) rtrxr nt0olt ioeiyt m2rmnms;t0 rxrxf3iydfmDeln o;s0trumxo3oy4optn iet tfaDtmuronu0tpx mi3ils mDumnmp;(4 exnxoctytfa  lu ol(  etr(o3oo1alenlneils arurxrp;t1apxniociadfaDelu o;()tlxnir oatfptrau s s s2trim oy1llen iet ( a2ur(  ;u1olenioetysfm2umumo t0 rxnxf tytfpDeli o;(  rumxm nodlmenliei s a2taxr no0tptn o3iaslmDrl(vs t0alenir3oytlptelieo t s2tr(r nydomte neiltfsrumumpoo1aeeomf3tad aDrmnmont4trtnmf3ootomDrli i;s) 2tmxr3oo1am emfeia()srtau pno0aleomfeiytfsDum(mo (4texoxo tadlpD  uvslt) eumir3iu4omt mies tf Dra(moot1openmfeildls em( onu) rxrmo oydlpDr ieslt)srxmir3nudopt mnci sfsrur( oou0aetoiicildlaDrm(vonu) reoxrciadomDrlneo;( s2xm(r3nu4lp e nes sf 2rrxr ;t0opx ifeiyd sDemnvo (4tetomociy1faDr n o (0sexmirpio4omtn netlt  Dtr(  ou0altomi3iatfs um(mp;(4 lxomo tatfat  i s;(  2toim3oy4lp elnvslsfa2tr(ro;o1tex ifciltls elu ont4arxoxrctadoaD li ols  2uo(m iu4alt lnvsl()aruaump;o4teen oeilslmDrau s u)aetoxo to1omDraiei;s0truoirpiu1lme lfesas)a2rrx pno4alt if3tytls2uanmo;u)arenxrcty1fpDe ivi;s) ruo(r3iodllt  nvias  Dtax p;o4tet ifciad s2em(msnt4artrmr tydfp r i i;()teurir3iydalt mnei s  2rauro;u4apx  icilsls2umu ont) lxrir iytom rli s s)sruoio oo1om  lnvt tf 2rrurpnu1tpxn octldlsDuanvp t0 rxrmr iydoptr u ols)t2tmio3io4ol e nei () Drm( p;t4olx  o3tysls uanvo t4aleomoctodopDeanvo;s)setrio ny1ome lfcsl()aDtmu  ;u0optnmo3ildfs em(vs;u0arxoxocto1lmD li s ()s2trim3ny4ap   ncsas) Dtmxr ot4apxnmfcils s2umnvs;t)trxomfctydomDranvo ( texr(o3iodlleelnct tfsrur(m nu1olt  f3iltlm2rlnvo;u4 leoxr3iotom eln s;t) eumim3iu4lp  mnesatfa2umx pno0alxn o3ilsfa2umnvsn(0 leriocto1op e nvi s0 ruo(o io1lmt  iesatf Dumxmpot4tpe mfctasfs uln pnu) renxr oo1lmteauei;(0trxoxo ou4lltnmieilt) rrrxmo;t1optoiieiatls el( o;(0artoirctodlpteluei ( sexmxrpno4oleelfeia(fsrta(m ;u1olxomiciasfm2rmnvpnu4tltrxr tadlp  lneo;s) 2xrxopiodlm n ncsatfs2uax  ot1tex iociydfa ranmo;(0aexnioctytfa   nes;t s2trxo3iu4olt  fetlt) rua(moou4tltomoeiyt aDeaumsnt4trxnio3tytlm eaivil(0 etm(mpnydolte ivs (  rtrumono0tpxo f3tld a rlnvpn()tleoxf oydfpDelnes;s)seuoxopiudop n nci tfs2rmx pnu0tltnmfeildfm rlumo t0texrmf oatlmteaies;t trxoxm nodolen neils  rumumonu1oleoio3iyt s2em(vpn(0 rxrmo iadomDeauvol()seuo(opno4ape  iviat)sDumuro;u1opt mi3iytfa ua( pn(0alxnxo3iydfatrlu sls0setoxo iy4oltelncsl(fsrrr(m ;t4alt  ictlt s2ranmont4 eeomocoadfaDr u slt)sexoxr iodamee fetas s2tau p;o1tlxn octltfa2umums;u0tlxoxfciy1fmt livo () exoim3iudop   nvilt  2tm(  ;o0apxnii3ias s uaumont4trtnxf3oa1omDeln ils0 rurio iodomenmfvtat)sDua(rp;t0oeenmf3tys a2rlnmp;()tltomrcoo1latrli i t0seur(o3oo4alen ieils)srrauro;u0tlxoif3tydfs2rmn on()tlxnif to1lpDr iei;t) rtoim3nudol nlfct (f ruaxmoot1tltomfetasfm emums;(0 eenmf3oydfpD lu sl(0 exmxm3oudome mnesat)s2rmump;o0alxnif3tys aDea( o u) lxnif3iodfaDr neslt0seurim ou1opee icils  Draum ot4tltomi3tysfs2eau o t4trxoif oatomtelnes;t0tetoim3io4omen ivtltfsrua(mont0olxn ietltlm ul( pnu4 etomf oatomtr i s;()trxoxm iy4ol   ncsasfs2ra( pnt0aetnmietadla rlumpnu0aetnxrcta1fa r ivil(0 2uoiopiodoptnmicsas)a2tax onu1apenmicilt mDrmu snt)tltrmocoatla  lieolt0 rxrxmpiodlp n feil()aDra(rp;o0opto f3ilslsDra(vonu0tlenxo3iotlpte nvs;s0t2tr(m3iy4om  mneil( arrruroou1oltomieiadfs2um( o u0aeenir to1omDrauei;t) 2uo(mpiodll  mfviasfsDrm(  ;u4tleo ocias a2rlnms (0artrmf iytom eluei;t0 euoxrpiy4altemnvilt)sDtmxrp;o1alx mietytlaDuan o;()tleomo tadfa e ies;s0 euoxrpoodll elict sf 2taxr ;u0apxoio3tas sDelu sn(4arxoif totlmDe i o;t0 eurxmpiu1apt mieslsfsDtaxm ou1aeto ietas mDumn p t) lxnif3iotopD  nvi s truriopnodolt  netl(fsrtmxm ;t4oet io3ilslaDulnmo u0alerxrciotfp rai sls) eumio3oodam n net t)aruaur ;o1aet moeiadfs2em(mo u0aexnxrcoo1fat  i o (  2trim iodomt lfesa(fa2uaum ;o4aptnifctyt a2rmumo;t) lxomr ty1fpDrln s;s)trtm(rpnu1opee neilt  2ur(ro;o0tpen icilslsDrluvp;u4 etnircty1lp r iei t)t2urio oudlpe  fctls srraumo;o0opx ifetas s ran pnu0 etnmo3iatlaDeaueil()trumim3oy4apenmfcs () rurxmpnt1oet iocilt aDra(mp t4 ltrmo3tadlmt  nvils)srxrxrpiy4ape  ncta() Dtrum ;u1tpx mfeiydla el(vp t)teerxocoydop eauvils)s2trxrpnodamt mncsl(faDtm(mo;t0tetomi3iysfsDrmums;(0tetrifciadop  aivi (0srto(o no1lm  mfvsatfsrraurono1olxnioeiltls2umnmo;(4areoxr3tatop r neil( srxr(r io1al e nci sfa2rrxr oo0altnmoeiyt sDrmnvp;t4alenif oa1la   nei s t2um(o3io4lmtn ivia(fsrrmxrpnu1tltnmociytfa umu p;t0 rxoxr3todlpt livsl(0t2urim3no1al   ivtlt aDurum ;u1opeo ocild s2rm(mo;t4 rtoir ia1fp r ieol(0s2umxm iu1lmtelivsat)arta(mo;o1oexomoeild a2umump u0aetnmf3tydfp rlivi ( trxoxr3oydlp e feil(fs2rmur ;t4tltn iciad mDrlnvs;t4 lxomrcty1opt lu o t)sexrir ou1aptnmnvsl( a2rr(m ;t1texoiiciltlm2rm(vpnt0tltomo3tadfmDe n o;( teum(r3nudlm nlnvt ( aDtrurpoo4opx ifeiasfa eluvo;u4tltnxo3ty1oaD lu o;s)teuo(mpny4openlnctl(  2raum ;u1aexn f3tatlsDrlnvo;t)tetrmr ty1oa rluvsls) eur(mpnu4ll  lfctl() rraur ou4altnioeiltls2umump (4artrio3ia1lpD luvi;( sexr(o3oydap nmfvil( sDtmxmont4olt ii3tatls2ea( p;(0arxrmfcia1om e nvolt) etoir3nu4alenmieta( arra(rono1aetoiicias s2ea( pn(0trtnmo iytlpDraies;t) rxmio3io4lm n nvtlsf Durump;o1aex  icild sDemnmpnt)tleoxr iotlaDe ivo (  2toiopoo4ll n nvias) 2umxm nu0teenmi3iatlaDeln p;t)trtomf3ootlmD aieo t  ruoxr3oudlmtnlfvtatfaDrax  ot4tpx  ietldfs2ea( p t)trxomrcoodlmDe neo ( setmimpnu4lleemncslsfsDua(mpnu1tetnio3iys a ua( p u4teeomo oatfmDelieil(0s2xo(opnodale lfvtl()aDrax oot1oltoioctys sDuau pnu)tltoio oatoptrai s s0t2uo(rpiodolt mnvs ( arrr(rp;u1tlx  feiatfsDrm(vs t0texrmr3io1fm elivo;t)trurio iudamtnmnesls  Drr( pot4ape mietys sDuan o;()aleomocio1lm  auvo;s  rxmir iydolenmivsltfartmum ;u1opxnmfetydfaDemuvp;t0 rtnxrcoydfpD aues;(0 rtrim io4ape  icsat)a2umum nu4alxnmf3iad aDrmuvp ()tetrir3oo1oaDe u o;s srtm(r3iu1ome lfct tfa2tru pou0oex ii3ils aDuaumo () lxnio3tadfmD lu i s)s2trir3no1op  mivilsfarrmu  no0olenif3iasfsDua( snt4 ltrifciytoa e n o;s0 2to(m ny4ape lfeilsf Dumx  ;u1tlt ioctysfa ea(ms ()aleriocta1opt lu i;s sexrxo3iudamt mietl()arrax  ;o4tpe ii3ilslsDemuvs t)trxnmf3io1lmt  i i t)teto(mpiy1lp   fvia(fsDta(r ;o1tptn ieiytfs uauvo;(4tetoxr3iatlat lieil()teumxmpnu4lm  livias  Dum(ro;o0oltomfeias m2ean snu) lxoircty1lm r uei;(0t2xmim3ou1ame mies s) 2ta(mpnt0ope moeiytla2ea( p (4tetoxoctodoaD au o;t0srxrir3ou1ale miet s) Dtrxrpot4aptnmfcilsfmDrau o;()teermo todlmDeln ilt)trxoxopny1olenliei () 2rrurpou0teeomo3tatlm rm( o;(4tlenifcty1oa e nvo;s t2trxm3iy1lm nmneslt)s2urx  ;u4aptn i3tlsfsDeln pnu4 exrmoctadoa  aueolt0 eumxo iydop nmietlsf Dta( o;o4tpxoioctydfa2ulu s;t) rxoio to1fp r i o s0teuoirpny1ll n ics ( a2tm(rpno1tex mociys mDrluvp;(0tetrmf3oytfpDrlu sls0t2urirpoydlmte ivt sf rrm( ooo1oleoif3ildfs2rmu s;t0treoxf oatfmte uvi;(0sruoxo3oo4oltelnct sfaDtrxm nu1tpt  o3tydlmDea( o () rtoir iydlp eaiei s  rxoxopoy4omen fct t)a2tmurp;u0alenif3tlsfm ra(msnt) etrmfciy1la elneo s)t2uoxm3ou4omenlnciatfsrrrxmp;t4apxo ietadfaDua( snu)aetnif to1oa ean il(  rtmxo3nudomt micsa(faDtaxroou4oex miciytfa2umuvpnt)tetnmo3iotlmt  nvo t0 etmimpoo4altn icslt srrau  no1aex mietytls ranvo u4arxrmociytfmt aueslt)truoxo3ou1olee fet s srtmur oo1apto fciytlm rlu pn() rerxfcia1lmt ln i;t0 exoxr iy1ame mfcsls)sDumum nt0tlxomieiat s uluvsnt)aleoxf3tydoaD  uei s) 2xoiopiy4alen ictls aDtmu pnt1tex  iciysls umuvp;t0arxoif3ia1fa e n s s)srxo(o ny1ap elneiat)a2ra(r no4tltnioeild m2rln s t4alenio3tytla rln s t)teuoxrpiodomeelfvs tfarrruroou0aeenioetldfs2em( p;u) exrxf3iatop e u olt0texmim nydam n ieilsfa2trurpnt1olt  fcildlmDrm(vsnu)trenmfcoo1oaDrlueo;s)seumxmpnudopee nvsls) rumxrpoo4optn f3tydla umn p u4 etoxo oa1oaDelneilt sruo(r ou1lmt  ictas)aDururont0opx ifeiys mDrlnvp (0texrif3todlm raivs t0 rxmxo iudamtnmics sfaDtmu  ot4oeeomoctlsls2ulnmpn(4 etrif ootoaD ai i s0 eumio3io1apt  fci tfa2trxrpou0aet moeils s2ul(von(0 ltoxr3tatlmt  i olt  2uoimpno1ol n fcia( a2umxronu4oeeo iciltla em(mp t)artnmf3oydfmD ln sl()t2umxo3oo1ol   neta() Dum(  oo0texn oetyd s2ranmsn(4altnxo3oo1latrlnes t  2xrim3iydlltemfcils) 2urxm ou4tlenmo3ildfs2um(mp t0 exoxrctadlmD ai o s sruoxm3oo4llen ncslsfa2tau oou1texn fetydfmDrauvpnu) reomo3iadlaDe neo (  2ur(r3iy1ap  lfvsas)a2tmumpou0oetoiietytls2uau s;t0trtnirciotlaDeai o (0s2uoxopno1lpt miesat aDum(mono1aptniieiatfaDrmnvo;(4artrmo3tytlpDr n sl( s2xr(m3no4om  mfci (  rta(m no0teeo oeiydfm rmn s;(0tltoxr oytfa raneo () 2tm(rpny4ap emncia( a2rmx  ou4tpt  f3ildlaDuan p t) rtnmr3io1lm eau o ()s2trxmpoydapee ies s  Drm( p;o4oleoiietls s ul(mo;(0 renio3iy1oatelnvolt t2umiopoydop  livsls arrrurpot1ope ioctytfm2ranmo;t0 rxrmr ta1lp  aneols)trxoio no4lpt miesas  2rm(ront1tle ii3tlsfs2ra( snu4aleoio3iy1laDeaivo;t trtoxrpou1om elicslt  rtr( poo4opt mieiasla umn snu0arenxo3ootomDr ies;s  2xm(o iy1am  mivsa()aDtrx  ot1tetnmoetasfa rlu snt4aetrir3totop  lies t  rtoxopoo4lp  lncta() Dtaxrooo1oexnifeildfmDran s;t0areoxf3iadomt lieolt)sexo(r iudope  ietasfsDtmum no4aex  ietasfs rm( pnu) ltoif oo1fpD  nvi (0 eum(m3no4lltelieias sDuax  ;u4openmfeiasls2ea(mp t)teermrcia1op r neils)texoxmpiudopt  nciat  2uaxr nu1opto fetlsfmDrm(vs t0artrio totfmtraiei;t0 2xrxm3nydameemicil( s2rmum ;u4opt mo3iasfa eauvsn(4tltnxr3ty1oatraivo s seuoxm iy4apt lfcil(fsDrrxront1oetomicilsfs2rmumo (4trxrifcia1oaDrluvo;s0 rurir3nu4lm  lictl()aDumu p;o1altn f3ilsfmDem(mpnu0aeenmocoo1late ieols) 2trirpoy1lm elnet s)artm(  no4altn oeilsfa umu s;t) exrmfcoydopte ieils0 2xoxo ou1lmeemivsls) 2rmuro;u4apxomo3tlslm umnvs;(0 exoxf oatlm  luvils0srxrxm no4omte iet ()srrrumont1tltnmoctasfa umu pnt4 rtnio3oodoa  ln i;t sexmim oo1altn neilt) Dururonu1aeto o3tyslaDrlu pnu4aetrxfcoa1lat  neil()t2xr(o3oy1ameelnct sfsDtaxmonu4tlxoif3ildls2ua(mo (0aetrmo3iy1fm r i il(0sexmxm oydomtnlncsas)a2rr(ro;t0aexomf3iatfs2um(mp;u4 eeoir3iy1laDelueo ()t2um(r nu1olt  fvt ( srurx oot0apx mo3tldlsDrlnvonu)aetniocootomDeauvi s texrxo3no1llenmfetltfsrtaxr no1tleoiociytfmDelumo;(4 rxnmrcio1fmDeln o s)trumirpio4optelicsatfaDtm(  ;o0oleo o3iys s ra(mo t0arxnxf3iodlmt  ivo (0srxmim ou4ll nmics t)aDrm(  nt0tpe mociydlaDua( s;(4tlenmf3oatfmt  neo;s s2toiopoo1ame  ictasfsrtmumpou0opt  ietys m2eanmsnu4areoxr oytopt  ueil( s2tmio3ou1lpeemnetl( sDrmxmont4aee  o3iyt m elu sn(4arxoxo3ia1fatr u slt t2to(o iy1alt  ictls aDrmumooo4alxomiciys aDrl(vo t0alxomf3ta1fpDeaneo;s t2xm(r no4lmenmnvs (farrrxro;u1oex mo3tad aDrlnvs;(4 rerif3ta1oaD  uvs;t s2to(o nudlm nmietl(f rrm(  ot4tleomoetld s2rmump;t4tlerxociodfat ai i ()seumxr ny1ap nmieiatfa2tmuront0optoioeiydfmDrl(vsn(4arxnxfctotfa r uvo;t seurxmpoy1alt livias a2ra(mpnu1oetnii3iysfsDuluvp t0teenio3oy1op rlnvs t srtr(m3iu4omenlici (farum(m nu4oltomfetydla2rm( p (0altrxfctydfmteauvi;t) euoxopoodap elfcs (  rtm(moot1optomf3ilt m emuvpnt)aexnmo3io1oa ean o s setmxo iu4aptemiesltfa2ra(mo;o1aetomi3tatfs2um(vsnu0 eenxo todfp raivsls  etoio ny1ope mietat  Dtr(mo;u4tltn ieiysfm2ua(mp (4aleoio ia1late i s (0 rxmimpiy1omee icslsfs2rr(rp;t0olx iociysls2rlums u)aetnmoctodfa raivo;s0teum(opnydolte fcs t  Drr(rp;o4aleo f3ilslm2rl( sn(0arxrmf ia1fptr ueo s)trumxrpnu4oltn netlsfaDum(  nu1ope io3tlt a rau p t0texnmf3ta1fa r uvols  2umxo3oodoltelnesas s2ur( pnt4aee  f3iad sDua( p;()aetniociydfmDrau s;s)trxo(m3nudlp n ictl() 2tmxrp;t4aeeoii3tysfaDeau o;(4aexnio oy1lpteaiei;s teto(m3iy1ol  lfcsl() 2rmxr ;u1apxoioetas m eluvp u)trtrircty1op   i i t0s2uriopiudoptelfvil( sDrrx  no1tptnifetltla el(ms u)alenif3tytfa  ln sl(0tetoimpou4omee nesatfarrru ont4tpt  o3iytlm ul( o;u0trenmr3iotopteln o (0tetrxm oo4open nvil(  Dtmumooo0tetnio3iatfsDum(mp u)trtomo3tydopDranvs;s s2xo(o oodome  ict t sDraum no1apx  i3iaslmDumn on(0artnxfciadfa eai s;t  ruoxo3iu1am elivtltfsDrru  ;t0oexo f3iltfs rl( ont) ltomrciodfmD aieo ()s2tm(r3nudalenlfetat) Duaxronu0tet  feiatlm2uanmo;u4artnmr tytfaD  neo;t  etrimpoydll   fctas sDra(mo;u0tptn oeild s2ul(mpnt)arxnif3iatla  auesls  etoio iu4amtnlfciasfa2urur ;o4tet mf3iad a2rmn o;u4arxrxf to1fat auvsl(0 2urimpno4olt lictls s2umx pnt4tpxnmoeils mDemn o u)trxoio oo1fat lues s)trtoxopnydamte fvt (fs2uaurono1texo f3tyd aDua( o u0 lxnxoctydfmt  ivo t) rtrio iudap nlfcsls)srra(ronu1tlx moctlt m2uauvonu0 lxrmr3oydfpDe i ils0s2xmir ou4ll  mnvi tfsrumx p;t1aeen fcilsfsDra( pnt4areoirciytlpDrlivi (  2xm(m3io1ll nmfei t)aDrmxm ot0tptnmiciyslaDrl(vp;() eerir iy1lp ean i s setmio nu4lmee ics (  rtax  ou1apxoio3iytlm ranvo;u4 rtoxf oodopD an sls0s2toxr3oo1al  mnci tfsruaxmp;o4oltniiciasls2eau s;t4tlxrxo3io1oat  n s ( trxoimpoo1opeelfctl( arurxront0oltomo3tltfsDean p;t4alerifctotoa r ivsls) ruo(rpnu4amtelivtlt aDua(m ou1tpxoifctyd s2rmn s () lerirciy1lmDr uvslt0tetrxr iodomenlfvi s)s2rmxmoot0tetnmfeilt m elnms;u4tlerxr3ta1fa rauvs;s0teuo(m iydlptemicilt sDtax  ;u0tlenmfctasls2rl( o;u4arerifciydfp r uvs (0truoio3no1ope mfvi s) ruaumpou1teeoii3tat sDulnvo () rxoxocta1op elnei;s setrxm3nu1alt mnct t sDrm(mpou1teeo ociadfsDumuvp t) rxomrcootla rlnvi s)srtr(m3oy1oltnmicil(  Dtmxm no1texn iciyd s2umuvs u)teenirciotfpDrluvo;() exrimpno1altnmnvtlsf Durxrp;u1alxn ictad a elnvs (0 renio3oydlp eliesls0 rtrim3iudlmeemnvi (fa2ta(rpno0tleo o3iatls2umnvsnt0trerio iytfmt ln slt)teurxopiy4openlnvs (fs2uaxmont4oltomociyt m2ea(mp t4 rxoxf oo1oaDraivsls)t2toir3nodol n ivt t arrmx pnt4aexo f3ilt aDrlnmpn(0teenir3io1lpDelivil(0trxr(m io4omeemfvsatf rumxmo;u4tlt  ociadlaDrm(vo;()tlerxociotomtr u il(  rxrim nydlmenmfvs t) Drm(m no4alxoii3iat m2ulums (0 rxnxr ootfp   u il(0trxoir iodoltemfvtls) Dum(ro;u4aeeo oeiadlaDul(mpnt0treomf oytfmte ivi (0srtrxo oodal e nviat)s2tmumpnu0teto i3tadfm2umumpnu)arxnmr oodom rlu s;(0sexm(rpoudol  mneta(f rra(  ;u0tetoiieiadls uanvpn(0arxnifciadoaDraueolt0srum(o3iudapeelfcs ( srtr(  ;o0tlxnmictatfa ea(msn(4aexnmrciodoaDe ivils0teumir3iy1ll n fetlt)s2rru o;t4alto ietadls rl(vs u0tlxrxr oodfmtrai o;s t2xoiopnydlp  livsa(  Drm( pot4tpxoioeiys aDumnmont4tleoif ia1fpt aueils0trxmio3oydalt  icilsfarraxm ot4tpen f3tysfs2ra(vo;(0texnif3ootlp r uei s t2uoxo oydomtemict s)arrmumo;t1oleomietyslsDul(vsnt4tetrmo3oadom rlies;s)setmxmpnodale  fvslt)s2rrxro;o0alx mfciasfa rluvs;u0arxoir tatomDr i s s0trumim3oudlpen feil( s2taxrono4ope  fciydla rmnvon(0teenmocoatoa rluei s s2ur(m oydoltelictls a2tm(mpoo1aee  fciltfsDraums u4trenmfctytfm   uvil( teumim3ny1ll n ivs () 2tmxrpot1apxo fctldlm uln o t4altomr3io1fp e nesls0 eur(r nu4ameemnvt ()a2rax o;t1tlen i3iatfsDrlu pn(0artrmo oy1late u slt)texr(r oy1omt mfvtlt)sDta(monu1opeo o3iad a2em(vp;(0trtrmfciytlmt  ivo;s texoio3iudlltn fctl( a2ur(r ot1ole  iciadls umnvpnu4 ltrif tadom   nvolt0trxrxo3nodap nmnvias aDuaxmo;u4apxnmfciad sDeaumo ()alxrio3totlatrlieol()seum(opoy1ale lfcsasf Dua(monu1tltniietydla2ul( onu0teenxo iy1fpDeli s;(0trxm(opiu4olte feiat a2rm( ooo1tpxoioeiys a eanmo (0trtoif iydoateau sl(  2um(m3nudlme  neiatf Dtmurp;u4tpt mo3tld a2emnmp t)trtriocio1fp e uvo t) rtrxr nodlm nmfcs ( arum(mpou4ole mo3ilt aDea(ms u0trtrmo3iodom  lieol()t2toim nodlpte feil()srur( o;o1opxoiictysfa2elnmpn(0arenxo3iydlp   nei;t)srumxmpiy1ap   ieiltfaDtmxm nu4tpxomiciadfs2raump;u0 etrxo3oytlpDr u i;()trur(rpny4optnmnesl(f Durxmp;o4tleoif3iydlm ulnvsnt4aeenio oatoa  lnvi (0srtoim3iudll nlnct s aDtrumpnt0tpt ifcild s2rmump;(4trerxr3iadlptrliei t)truoirpiydomen feta(fa2rru  nu4tpt  o3iaslm2uln snt4tlxomo iodfp e nvo (  exrxr3iy4ale mietlt)srraur ;o1apxn ieiltlmDrluvp t0aexrxf iydlpDeau ols)setoxr3oo4om  mnct t)srtrxmpoo4oexniieiydfsDeaums;t)tltrmr ta1oa   u i;(0s2umxm nu1am n fetl(f 2rmxmonu4ole  i3iydfm2ea(mp;t) lenxo todop  au o;t) 2xm(mpio1apeelfeilt)srtm(r nu1apeoioeiadfm2eanvo t0tlxriocta1oateliesl(0 2tmxopiodllen fci s) Draumonu1oexo feiad m2uan p;(0 lenxrcoytfa   ies s)trto(m3iu4amt  nvtlt  rua( p;t4aeeomoetlsfsDeaums;t4 renmr io1fm eln s;(0teumxm oy1olenlnct ()sDua(ro;u1tet moeildlm2rmuvo;t0 reomfciodlpD ln ols) etoxopno1aptnlfei s aDrm(  oo1alx  ociat mDua(monu) exoio tytlatrlneolt)t2ur(rpnydaleeliesat)arta(rpnu4tleomieiadfm2rmu s;(0trxoxf todfmtr uesl(0 rumiopoudapen ncsat sruaxmo;o1aee iicilsfsDean o;(0tlxrmf3oytfpDeli ilt  exrirpio4lm e nci sfartax pou4tetoifeiyslm2rau p;u)teeoir oadom eln o;s)trxo(r io4lp elncil(farua(mp;o0aeenio3tldfmDulu s t0 rxomf3iatla ranvol(0trxo(m3oy1lltelici t)aDta(rp;o0olenio3iysfm em(vpnu0 rtrmf3oydlp r nvo;t0tetmiopoy1optnlictas  2taumpoo4alen octytla eluvo;t0areoxocoydoatelivs s) 2trxmpoy1lltelneias)s2tru ono4olenif3ildfsDemn p;(0artoxo3tadlate ueols  exrxo nodlpt mfci (farrm(rpno0opt mf3iydla2rlnvsnt4tltrxf oadfp  aies;s truoxm nu1ome livias)aDumxm nu1tex ifeiatla2ranvs;(4aeeoifciydlpDeli s;t)s2umir ou1ol n fctatf rra( p;t1tet  o3iatfsDel( s;u0aexrmoctytlaD li ol(0 rur(m oydlmtelfcslt) 2truroou0opx mo3tltls ea( on()trxnmf3tadfpDran s () rxrxm3ou4om nlivt (  2uax  nu4tleomfeils s2em(ms u4texnmf oodlp e ivils0srxm(opny1omt mnci t)sDtr( o;o0tleoiictldfm ea(vo;t0arxomrciydfmt au ils0 euoxr3io4lp nlivs s) rtr(m no1tee  octadlmDelumonu) rxoircoatlpte n o t  rurxm oo1llt lnvsat s2uaum ot0tptoioeiys s2rl( o t) etrio oadomtrln o t0texr(mpnudapeelnvtlt srurx  nu1alenmi3ildfsDumnmo t)arxrio3iadlaDrlnes s0 eto(mpiodom e fvtltfaDrmxm ou4teenmfetat s2el( on(4aeeomf oytlmte n olt)s2umxr3iu4llte fvsa(f Duaur oo0apxnif3ildfm2um(msn(0trxoxf iodlpDraivo;s0srxrxo iu4altnlfesat  2urumpou1oetn i3tls sDumumpnu4tlxrxo oodfa   nvo s setmirpnu4al   ics tfa2umu onu4oltnioetas s2ranms;t4arxoio3ta1op r n o;(0srtoxopio1llt lnet s)srrr(mpou4oetnifeiys s ulu sn(4 exoir oo1fmt ai s s)trumxm io1lm e fvtas sDtm(mp;u4olxnmicild mDulnvp (4tetoxoctydfmDrluvo;(0s2xoxm iy1omenmfcil( arumu  ou1opeoio3tldfsDelnvo u) lxrxo oytla eai sl(0 eurxr nudll   netatf 2tr( ooo4tpeo i3iatla2ul(ms;(0 renmf3iy1opDrluvs t)s2tr(m iodamee fvsa(f rua(moot4aeto feiydls ranmsnu)arxoir3iodlmtranvil(0t2trxmpno1lm  lnvi tfaDumuroou4altoiictadfa2rmnmo;u0trtrmr3oa1omDe neolt) 2xrimpiydamt  icsas)arrmu p;u4olenmo3tls mDeanmp u0 ltnmoctodfpt lu o;t)trxmim3iudaptelnesls  2rmum oo1oeto ieiys a emn o (0 ltrxfcio1opDraues t0 euo(r3nu1ol nmies t sDtm(m nu1alx mi3iadla2em(mo (4areoxr3tatom elivol(0s2xrimpoodamt lneslsfs2rrumooo1aeto ociyt m2eau o t0 exoio3ty1lm e neo (0 exrxrpoy4ol emncsas s2uaxm oo0alto fctydfm rln pnt4texrxf totfmDeanei;t0 rtoio3no1omen ncs t)aDrr( pou0aexnifeiasfmDemu o u0 etnio3iadfpD  i s t t2toiopoo1alee fvt sfsrtau poo0tpt if3iyslmDumnms t)trxnxr oy1oaDraies;s0 rxoio3nu4ole  ivi t)sDtr( pno4tpt  f3iydfa2em( pn()texnif3iotla e nes;() rumio nodape mnvsat aDtru o;t1tee  f3iad s em( s;(4areomr3iytfat  ieslt)t2tm(o3oudaleemnet s)a2umx o;t4aeeoii3iad aDrlnvs;t4artriocootfaDe nesls0s2xoxmpnodapt lieslt)artaxr ;t0tpxomo3iys s2rmn p t) etomo totfptrlnei s0 exoxopiy4oltnlnvsls)artru onu1aeeo o3iys aDrl(mo t)tlenxr3totla e nvs;t)srtmxmpiu1am emfesl()a2tm(ront1ape  feiatla2el(ms u0tlxrir3ootlpt anei s) etmiopoy4omenmfcias) Dtrxmont1olt iictyt a uaumont4tetoircta1om  liei ()s2tr(o oo1llte nvi t)sDrr(rp;u4opx mfciytfs ea( p;t4treomo iatlmtrln sls)srur(mpnodlme mivta()srrru onu0olxo o3iydlm rlums t4texnmrcto1om r uvols0 rumxr no1amtnmneta(f rum( poo0tex mociadlm2eaums;t4 lxoir ootom   u o;t  exrimpiydlpenlfvias a2taxrp;t1tpe  feiydfmDemump;t0tetnir ta1fa elneo;t)t2xoim iodll e ivsl()s2rr(rp;t0ole  feiltfmDua(mo;u0texrio oatoa r n sls0t2uo(m io4lpe lnctl() 2rm(rono4tetoifeiadla rlnvs u4texrxocoo1lat aiei s  rtmim3iu1amtnmivt t s2raxro;u0opt  i3tysfa2ulnvs u) rxoxr oatfm rli ilt texoxo3iy1lmenmnct s  rrruro;o1tetoiiciadfs ra(vo u)aeerircootop rlneols  rto(m3io4ome mictas s2ra( pnt4tlto fctytfaDeanvp t0 lxrif3iatlaDelnvs;s)teuoiopny4lm e iei s)a2uau pot4oeeo ietld m2eanmo u0altnxrcootfmDe nvil()setoiopiy1ll   ici tfa2rmxm nu0oex  fciyt a2emuvp u0 rxomr3oytlp   uvo;s0srxrxrpoydlpe miei s srurxrpno1tlx  i3tydlsDrlnmpn(0 lenmf ta1oa r ueo;s)t2uo(r3nudll  lnvtat)arrmx pot4alt io3ildfs2rmu s;u0artomf iodfpDranvilt trxoxopny4al  miesa( sDumu p;o1oeto octlsfa2eluvp (4teeoir oatlpte ivsls)t2trxmpnudop  mfci tfsDururoou4apx  ocilt s rauvp;()tlxrif3io1fa   i i s sexm(o3no4apen nvi ()arrrxront1tpxo feiatfs2em( ont) eerxrcoydfpD  nvi s s2xrir nu1op  miet tf rrrumpnt4apeo f3tasfaDea(vs t0 lermoctytfmt aivo;( seur(o3nu1oleelncs ( artaxro;o0aptoii3iys a2el(mp;u4tlenxr tadfp   iesls)t2xmxo3io4am elict tfaDumx o;u0aptoio3iltlaDran snt)texomrcto1fpteai s;t)teur(mpoydomt mncsl(fs2trx  oo1teen ietltfa rl( sn()tltoxf ia1fm eaieo;s) eurxm ny1opeemfvt ( aDrmu ooo0tpt  o3ias a2rmuvsnu)tltrmocta1oat  nvo s texmxopoo4lltn fei s) 2rmumpot4tltoio3iytfmDumn o;t0trtnif oatfp  lieo ( t2umxopoo1lmtelfetl(  Dtm(m ;o4olt iocild m2em(mpn(0 renmo tadlmtrai i;s)texr(r3nydlpe lncs t)sDrrx p;u4ope if3tltlaDranvp;u0 rerifcootfp  liei s  2umir iu1lltnmncsasfsDurxrooo1aexo o3iltlsDua( s;()altrif3iotoaDe nesls0seumxopiu4op nmivtlt)arraumpou0oet moetydlm ul(mp;u0trerir iotlpDranvolt t2uriopoo4ape micsasf 2raumoot1apxomieiltla emu p;u0 lermo iy1oateauvolt) rto(o ny1om  lnvia()s2uru o;t1aptoifetytlaDrlnvpnt)tlxnmf ootoaDeaivi;s0 rxr(r ny4alen nei ( arrr( o;o0aetnifciytla2emumont)altnxfctadomDrlnvi;()srto(mpnu4altn fctas)a2rmurpnu1apt mi3iltfaDrluvo u4alerio3iy1fm  aneo;()s2uo(o3io4opee iesl(fs2tr( pot0aeenioeiydfa2rmn pnt4treoxf io1laDeai i t t2uoxo iodlltn feiltf rum(rpnt0oee mfeiysfs2elumsnt4 ltnxo3oo1op raivils)s2tm(o nudlle livsl() Duaum ;u0oltn i3iltlaDel(mpn(4 renxf3oadfp eluvo t0 rtr(opoy4oltnliet tfs2tr(m ;u4tptniictysfa2rm(mo;(4alxnxr oy1fptraivs s  ruo(m3oo4ll emfciatfsDtm(mo;u1opxoioeild aDrlums;t4treomrctadlpDeanvi ( teto(rpno1apenmnct () 2umxroou0olxnio3ildfmDrmumont)tlxrmfctadfmD lneils tetoir oy4ol   fctas  2uru  ot0alt mfeilsla2eau p u4treoir oatoaDeauvi t s2tmxr nudam n fes sfsrum(mpoo4optomfeilsfa2umn pnu0aeerxf3iodfp eau o;t0tetr(rpiudlptemicta() rtrumono0aeenmo3iydla2uln s t4trenircootopDraivo;t teumxr iudomt mict (fsrra(mpou4tpt iieils a ulnvsnt0 lxnxf todlm rln s s0 2to(m io4olte ncta( a2ur(mpnu0tleo ieiadfs2ua(mp t4 lenmr ia1lm rauesls)seuoxopiodomeemiet ()arta(  no4teeoiicias aDua(mpnu)tltoxociy1lmD aueil() rxrio ny4aptelfvia()srumu  oo4aetn i3ildla umnmo u4 eenxr iadlmDrluei (0 exoim iudap n ivt s arrm(r ;o0olt mf3iysfm2rm(ms;u0 rxrmfctatfptrluvs;t)s2trim nydop nlfvslt aDtm(rpou0texomictad s2emn p;t) eeoio iodla r u il()s2umxo3nydaptnmictl( s2urxro;u4aeeo oetlslsDrl(vo (4trxrifciytlmtelnvo;t0 rxmim ou1amenlnvtltfsDur( ono4tpeomo3ildls2elnms t0 rxnmr3ta1fm elivs ( srtmir no1ap  mici (f 2rr(m ;u0aet  feils mDrau snt0aetrmr ootfpt  nei;()trtrirpiodoleelfcils)sDumxront4opxnifciltfsDrl(vp;u0texrir oodfpt aieilt t2uoxm3iodoptnmncsl( srtrxr ;u0alxn i3iatls raumo;t) rtnif iy1fp  lu i t  eurio3iydom emivt s  rumumpno1ale  o3iyt sDrl(ms;u)tltrxo oatfaDrlivo;(  rtmxo iudap nlfesa(f rrmxro;u1oetniiciys s2uau o;(4tetoifcia1oateau s;s)s2trimpny4opt lfei t) rua( oou1aeeoifetldla2ul(ms;t) exoxrcoy1la raivs s0 2ur(o iu1om  lnvias a2rax ont4tlx ifcilsfs2el(vpn(4alxoxocoy1fat anvsls) etoio iu4amtnmfeslt)sDtrxmpno4oltnio3tadfsDumuvs;t)altrio oo1latrli ils0 etm(opoy4lm elneil( arrmu  no1opeoio3tatfs2eluvsnt0tltoxo oy1fate uvo s0srtrio3no4optemiei tfsDra(  nu4olx io3iydfs eau s;t0tetoxr3oo1faD  neils s2toxo nydlptemneil() rta(rp;o4opxnif3ias sDelumo u)aexomr tydfate nvils)tetmxopiodam   fctat aDtmumpno0aeto octlsla emnms ()areriocty1fpDe uvo s0s2tm(opoydop   ics t)aDrr(r nu0apx  i3iyd a rm(vs ()tlerir ia1lat li slt tetmxr3oydap emivslt)arrrxm nt1tlxniiciydlm ul(msn()tltrxfcoytlm  anvs;s0truoxr3no4ameemies (f rrmx  ;u0texoiociyt sDem( on(4tlermr totfmD ln o t  rxmir oydaptnmfvi (  2rau  nu0teto f3iltla rm( o t4tlxrir ia1oa r u s;s)sexoxr no4opeemfvt () 2rmxrpnt4opxo f3ild mDrmuvp;u0arenmo3iy1om rlues t0 rto(mpoy4olt  ncsa( artrurpnu0olxnioeiat m uluvs () rxrxfciodfp e n o t0 etmxo ny1op  lnvslt) 2tr(rp;t0oeenii3iydla rm( p;t)arxnxfcoa1omDrauvil() etriopno1ap elfctltfartmur ou4open iciytla2emnmo ()tetoxf io1lpDrlieo;(  eto(mpiu1lp nlnvi () rrr( oot4aetnioetysfm uan on(0 rtoxr3iytoatrli ilt0s2xr(o3oo4omtn fcsls  Drmx  ;u4teeo iciyslm2emn onu0 eeoifcoodom eai sls0 eum(r nydlmee icsat  Dtr( ono4ole io3ilsla elu p u4arxrmfcoo1omt  i o t0 rto(r iydlp nmict ()arrrur no0tlxo ociltlaDrmump t4 exrmo3iadfmDelnvo ()t2xo(o3ny1ape  ieiltf Drm(r ;t1ole mo3ild mDul(mp;t4 rtrxo to1fat anvs ()t2xoim3oy1ll emicil(faDrr(mpnu4apxn o3iatlaDeau o;u0altrmf iatfmDr ivo s  rtm(m iodlmte ics (  rraumoou1aeeniociysla2eluvp;t)alermf3oytlmDrauvs;t sruoio no1om nlnvsas) 2rru p;u0alxniocilsfa em(vs;() rxomrcoytop  lnvi s0trxrir3oy1am e nviatf 2ur(ro;o4tee moetadla2ulnms u0 lxomfciadfptean s;() 2toxr oo1openlfcsls)s2urumpnu0oltomietasla rlums;(4texomr3tadlpt  ivi s t2uoxmpoo4apen nciat arum(r ;t1alenio3iyt sDuauvp u)aleoif3to1fm rlueilt0s2uoxo3oy1lmen nct t)arrrur ;u1tex  ietys sDrau o;u0aeenmocoytoaDeluvsl()teuo(mpiydlm   neias a2tru o;u0optnmf3tys m2rln pn(0texoxoctytlpDelu i t)srurio3nudlm nmnesls) Dta(  ;o1tleoiieiat s em(mpnt4aetoxo iadom eaivs;s0trxmxo oy4am  mict tfsDtm(r ou1teenmf3tydla umn p (4alxomfcoatfp eanvs;s  eum(r no4op elivs (fa2raxmono1tpxn o3iys s uaumo;t4aleoxr3oa1fpDean s t0 2xo(rpiy1lmee neias)a2tr(mp;u1aex if3tad sDrau p (4aeeomfctatop raivo ()seumir iodam nlfcsls) 2tru  nu1opt mfetldlaDum(ms (4treomfcio1fmt lnei;t0sexo(rpnudom nlfvtasfs2ur(r oo0apeo fetas aDrl(mp;t) lerifcootlmtean olt0 rxrxr3io4ale  ict t) rtr(r nt4oetomocilt sDrl(mo u4teeoiocootla eanes ( setrim3nydom nlicsl(  Dtaxm ot1oee ifetlt a rm( o (4 lerir3iy1fp  livilt teur(r iu1lmtnlivia()aDrrxr no0opeo ietltlm2emnvs;(4tlxrmrctatlmD auvolt0t2umxmpnu1alenmici s) rrmx oot4oexoioetld sDel(msn()arerifcta1lm r i o;s)s2uoim3nydlpte fvi sf rumu pnu4aexomfetatfsDemn s;(0 ltnif tatfpt aueo;s  exmxo3iodopte nvi t)arumx o;t0oetomfciltlm2uaums (0trxnio3iy1fpD lues;s) rtoxopoudll   ivtas aruax  ou1texoifctasla rm(vpn()aeeoio3iydoa  au ilt  rumimpiy4amt  fvtl( sDtmum ;u1olenioeildfm2el( p;t) eenmrcoydopte iei;( sexoimpoydapenlnvt tfsrrr( pnt0tpeoiocils m umnmp;u0arerifciydlpDeaivi s) 2xrxrpnodam  lncsasfarraxroot4oleo ociadfsDuluvo;(4tlermo3to1la e uvols texr(r3oo1lptemiet ( sDrru ooo0apt ioeiltfaDrlumsnt0arxoxo3oadlpDrlneslt0 exoxo3oydop   nvs s)srrrurp;u4teto fcild a2um(msnt)aleriocootopDe neol()s2trxr ou1alt lnvs t)a2umx  ;o0tlt mfetlsfs2el( o;t4arxoxr to1latr uvol(0 exrio3io1alenlfeil(fsDrmuronu4altnif3tld a rln s ()altnmfcoodfp rlu o s teur(r3io1aptn iviat  rrmuro;t1oltnmoetltfa rmnmo (0artomf3oatopDr ivs t)t2um(mpoo4oltnlici sfartr(m ;t4aee iieiasla umuvs t0teenmo iytomt  u ilt) eto(r oy1lmee nviat)srum( pnt0altnmfcilsfaDra(msn() rxomfctadlmDr n ilt0 rtoxo no1ap   icsas  2trurpou4tpe mi3iasfm2um( o;t) lxrircia1laDeanes;t  rumxm ny1apeelicsa( srtaurono1olx  f3tydla ea(vp;t)alxrmf3iatopD  n slt0s2tr(o3io1ale  fvil(  Dur( pnt4texnifeilt a uau p;()areoxr oodlaDe u s;t)sexoim3iu4am n fetl()sruaxrpnt1oex mf3ilt m uln s;t4aleoif3oytlateluvs s s2xr(opoo1ol nlnvsatfa2rru  nt4oex ifctatlm rl(mp u4aexoxf oa1fmteli sls0 2trirpiy4am nlncsas)s2ta(ro;u1olt mfctyslsDra( p t) etoir3iadlp r ueol()t2um(mpnu4lltn fcs tf Dumx  ou1tleo fetld mDrmnvpnt)tleomr3ia1omtrlnvo ( teto(m3nodllt lnct t s2taumooo1tltoiieiat m2raumo;(0tlerirciytfmteau ols)trur(mpoo4lpe  feias  2raumonu4apxo ociaslm rl( p;u0tltrxfciotfpt  u slt0srxrimpiy1lptemnei s
\ No newline at end of file
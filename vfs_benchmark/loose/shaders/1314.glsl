@@ -0,0 +1 @@
+nvo;t s2uoirpnydlmtnlfcil( s2rrxm ;t1aptnmf3iasfa ran p t0 etnmr oadfa e ivo;t0seur(r3oy4al   ivils  rtaxr oo0texnioetld a ua(vo u0 lenxfctydfa raivs s)t2tmirpiu1amtelicta(f 2rau oot1texoif3iysfa um(vo;t) rtrxf ta1lpD aies;( s2toxr oo4lptemivslsf rtrxrpno4tlxniictas mDra(mpnu)aeenxocoy1laDr uvi s trum(rpoodomenmfvsls)s2tr(mpou1opt mi3ild a2uln o;u4trxnmfciadomteanes (0s2tmirpiodaptnmivsas  rrrxrpot1tlxnmi3iytfm2ua( on(0tlxrmfciytfpt aieil(0s2um(m3oydol n ncsas aDuaxr nt4aet iieiatla2rmumpnt0 exrxo3oydfaDeln s;( trurxo no1apenlivs t  2raxmpou0ole mfctat s uan o;(4trxoirciodlaDeai ilt)s2xmxm nu1apt  nviat)srraxmpnu1texnmicildlm2emnms (4tlxoiocoodlmtrau sl()srxrimpiodolt mfvtls)sDtrxmpnt4tpe mfetydfsDumn pnu4 leniocta1oaD  neol()srxrirpnudomtnlfvta(  2ur(rpou1alt ifcildlm2elu snt)aetoir totfmteaueils0srtrxr3io4om n icia(  rtmumooo4tex mf3ias m2rm( s;t4altomo3oy1lmDelneslt0 2umimpiu1oltnlfct tf 2rr( oot4tee mieilslmDea(mo t0tltnmrcta1oa elnvs;(0truoim3no1lp emfeia( aDum(rooo1tpeomi3tas mDuau s;u)alerxo3oytop elneol(0trtr(rpno4al nlfvsls sDtmx poo0olx ioeiltfsDemumsn(4arerif oy1lp r uvsls trxmxr oodam elfcta( sDrrxm oo4tlxo oeiatfs emnvo;(0 lxomfctadfat luei (0sexoxo3ny1lm e nct s)arurxmo;t1tltnmi3iyt mDuaumonu4 eeoxocoo1om rln i;() rur(r3nudlp e fvsas s2tmx oot0tptnmietydfa2em( p (0tlxrif3todfpt anvi;( tetrio iudop  mics (fs2rmu  oo0olx  ociaslmDuaumo t)tltnir iotomDelu o ( srur(m nu4ll elics s  Dum( oou4tpt moeiysfs2rm(ms;u4 eeoxr oytfatraivsl()setoxr io1apee nci ( srumxm nu1aee  o3tad m2rmnvp u0trtrif3ta1op   uvols0 2urxo3iy4op   netls)srur( pou1alxoii3tytls2uan s t)teenxf3todfmteaueo;(  2umim iy4omte ivtltf 2rr(  ;u0aet ioctyd m ua( ont4artoio ootlaDe u i t0 eur(o iu4lpenmfctls)srta( pot1tltoioetldlm2ra(mp (0teenif oadoaDelivo;( trum(r nudal emfvt t) Dta( ont0opeomo3tysfa2em(vp;(4 etoxf3to1fp   ieo;t0s2trimpoy4oltemictlt) Dtrurpoo0tex iiciat aDulnvp t0 etnmr io1fmteluvo;t0srto(o3nu1lptn feslt sDrr(mont0olx mfeiytfa2eaump;u0 leoxf todfa e n i ()trtmxm3ou1olenlnvi tfarurx pou0opeo iciyd a2rl( o u0trxoif oatfmDrluvols) ruoim3ou1ole mnvs tfaDtm(mpou4aetnmfciyt aDranmo (4tlxnxocoy1optrauvo ()srxr(m3ny4alt mncsls)a2ua( pot0ole if3tlsls2ulnvp u) rtrxrcta1lp rlnvo;()srxmxm iu4op elieil( artmur ;o0apxo feiasfm eln s t)aetrir3iy1lpt lues t)trtm(r nodole  fci (  Dtr(  ;u0teenmi3tas aDua(msnu)aexnif3oodlaD livi;s) eumio nydlpt  nesl( aDumu pno4teeniociytfaDrlnmp;u)alxoio3oodlm   ivo;s) etoir ou1om nlivs s  rrau p;u0tpt ifctltfs eanmp;(0tetrir3iytfpt lnvi s0s2um(opio4oleemieiat aDrau ooo0ope  ietyslsDua(vp t0teermoctydopD  ivo t srtr(o3nodom  mfesat) 2raxr nt0aeen fetldlsDemuvo;u0teenxf iadfp   neo s0 rumxr3nodal emivia()aDrax onu0aex  iciat m eau p u4texnmo ootlp rlueo s  ruoxo3no4apte ncil( aDrmu  no4altomo3tyd s2em(mon()texrmf tydomte u s () 2toir oo4om n fcs (fa2urumo;u4opt ifcilt sDrmnmsnt4 exoif ootlpt lu i t)setoir3iy4lp emfvtls)s2rr( p;u0tlenmociad s umu s;t0artnmo totlmD  ieo;t teumio3oydomenmfvi ()srumxmp;t4tpe  fctasls ulnmpnt)alxrxrcta1lmD lnes s0 2uoxo3oo4apenmictatfs2ta(ronu0opx mo3iaslm2umnvsnt) lxrxr3tatlmteai ols sexrim3iu1ap   nct (f rua(  nu1tpxomf3tadfsDul(vp;t) rtrxr3oo1lateai ol( s2xoim iodlm e ncta()aDtrumont4apt  oeilt sDel( p (0trtrio3ta1lm elivo (0texmxr oo1ole lfvt t) Duaxrpnt4oltn i3tld mDeln ont4arerxf io1oat  u s;()s2tmio3iodlpte ict s)srrr( ooo1tltoif3iytfmDrau o;u4tlxomocia1lptrln o t0s2uoxopoy4omt mfeiatfs2tmuro;t1aeeoiictat a2em(vp t0 eerio3ootfmt au s;t0tetrimpoy1lleemnctltf 2raur ;t0olxnioctasfs rl(msnt) rxrir3iotoaD aneo;s) etm(r3oo4lpenmivi sfsrurur nu4ope mo3tasfs2ulnmo u) rtrmf3oatlpD  n s;s t2um(mpny4om emnetatfsDum(rpou1aptoifeiad m uln pn(4tetnmr totfm   u ol()t2xrim3oo4alenlivs () Dumx o;u0opeoii3tytla2ea(mont)trxrxr3iatfm eluvi (0texmiopiodaltelfvilsf Dtax  ;t1tptn oeiyt s2uanmo;t4 lerxrciotlatelnvi;( t2xm(rpou4om n nvtas  rtmx oot0oex ioctas s2elu p (4texrmf3tadlpDranvols0 ruoxmpiu1ap emnesasfsDrm(r ;u1olenio3ildlsDeanmp u)arxomo oadfpDeli ils)trxr(o iodlptnlicslt) 2ra(  ;o4tlxniiciyd aDrmnmp (4 reniocta1lmtrln s;s0srtoxr3oudomtn nct t  rrrxr no4tpe  fetltla2rm(vs t0 rtrxfctydoaDrluvs t)texo(r oo1olen feil(  2rr(mp;u4altoif3ilslm rluvsnt)trtoxrctatfmte ueolt)trtrio oo4oltnlfvtas  2trum ou0tetoiiciasfs2rlu pn(4tlenxf oodlpDe n s s0 exmio nu4ll elnvtatfaDuaumo;u4oex  fciatfa ua(mo;u)artnxr oatlp  li s;t  2tmxm oydomt lfvtas) Drrumpou1oet iictyt aDrluvo;u0 leoxociytlmtelnes;(0trtoxrpnydom emfvsa()srra(r ot1optomo3ilsfs emn s;(0aetnmrcoytfpteaiei;s s2triopnydom e fctltf 2rmum ou4oltomicilt sDumnmp;() rxniocty1omD luvs (0truo(m nu1altn ieilt a2trumoou1alxoio3iatla2rl( pn(4texoxr ia1op elnvs s)t2urxrpiu1om  lnes (  2ua(  oo4tpeniiciltls2ea( pn(4trtnxf3oytoateliesls) rxo(opnudllenlicils)sDtau ono0tlto feiyt a2ran onu)treomoctotfmteli ils) exr(rpoo4llt micsltfarrmxrp;t4tlxn i3iatfmDem( pnu0arenxfciotfmteluei;s0teto(m3iydlpte fetls) Dtauro;t1oet mi3tatfaDem(msnu4aeenxrctatlmD  nvi;t) rtmxo nu4op n fvi t arumxront4oexn i3iadfaDel( o;t)texoxfcoytlmDr ivs s)t2trxmpoudoltelfeia(fa2rrurp;o1ale io3iytfa uln onu) lerir todfmt  ivi s s2xoim3nydoltn fcs ()s2ta(moot1oetoioetldfs2ranmo;(0 exoif3oadlaD ai sl( t2umir3oy1op e ici s)sDuaumo;u0tleomi3tad aDumn ont0tlxriociydfmDe ivs (  2umxo nu1optemnvsat s2tr(mpnu0apxn f3ilt mDranmp u)arxnxocoadfa eli o s0sexoir ou4al  lics s)sDta(rpou0alx ifeiadls2ul( o;u) ltoxr3oa1fmDrluvs;s0trurxr nudolen ictas  rrax onu4oexnmieiatfaDra( pnt0alenmfciotfmtrauei;()srxo(m oudamtemfvilt)sDur(  oo4ope  oetad a umuvpn(0altrif3iotfm  lneo t)seto(m3nydame lfvs tfa2rrxm nu0apx  ociyd s rm(vp t4aetrxoctotfp e nei s)t2tmxr3iu4ap   fcil(f 2umurpou0olxo ociaslmDraumsn(0 ltrir3oa1fa  lnvol(  rtmxm nodlltn nviltf 2umxm oo1olt iicilt sDelu p;() exrmr oatfp  aieo;(0texrxr iy1omte iviatf rurxm oo0opt  ieiytfs eluvs;t)aeermoctytfat  ueol( setrxopiudal  lfvils)s2tr(r ;u0tlto ieiys s uau onu)texriocoatfpDeauvi (  eumxrpno4lpt mivtasf rtmxr ;u4olx mi3iadfaDean o u0texnmr todlaDelivsls seto(m3no4llee iet ()srta(mp;t1tlxomoeiltla rmnmon()trxrmocto1omDrlnvilt) etmxr3io4lmtelieiat) 2raxmont4tptomfeiat mDrm(vont)aeeomf iydlptrai o;s t2xoxm nodllt  nvsl(faruau pnt0opx iiciadfa2umn sn() leoircio1lm   n o (0 etrxo iy4omtelncta(  rtmu pnu0oltnii3tysfs2em( o;(4 rxnmr iydfpDrauvs;s)teumxo nydlpt liei sf rumxmp;t1oleniociys mDuluvsnt0arenmf3iodfpD  ieo;s sexm(m3oo4lmt mics () rtr( p;o4olen oeilsfm rln snu0 renmr3ia1op e ivslt0t2xm(r nydom   fvsl(  2tru pnt4oltomoetys mDulu p t0aexoxo3oy1lpD  nvo;(  2xrxrpoo4lle lnvt s)a2ra(mpnt1tetnif3tytfaDulnvp;()tltrxrcia1lptr u i;() rxrir3iu4amtnlfvs sfaDrmum ot1oex io3iltfsDeaump;(4altrxrcto1op e nes ( srto(opnudam e fcs (  Dtmuront4teeoii3iatfs2emnmp t0tetrmo3iytlmtr i s s0t2xoxo ny4ole miciltfartr(m ou1oeto o3iaslm2rmu s ()trxnif3ty1fp r uei;s)setmxo nudamtemfvi ()srtr(rono1apen octls sDuluvont4aeenirciytfm e iei;t srurxr oodaleelnciat sDurxro;o1tpt  fciaslmDra(mo t0tlenmf iy1fp r n s;s)trxr(mpno4am n feiat)arurumo;o0oetniiciasls elums u0tetrxrcoo1om  aueol(  rtm(mpny4llt lneias arurumont1optoioeiasla em( p;u)arxnmrciatopt ai il(  2uoxo3no4lm  mnci (fartrx  nu4aex mietas mDumuvont)tetnmf3oydfp r n i;(0trtr(o oy4ole lici ()a2rm(  ;u0altoioetydla2em( o;()aexnif io1om e ivi s  euoxo nydlle licslt) rtaxmp;o1olxo i3ildlmDemums u0alerxr3iodfp eai o s0seurxrpnu1lpe mici sf rtax pnt4tetn fctysla2ul(vo u)tltomociodfat an o t) rxrio ny1am nlfvia(f rrrumpnt1tex mieiys s ean p t)treoircoatfmt lnvi () 2xr(opno1alt  ncil(  rrm(  ;o1altoiictydls2raumont0 lenmo3oo1lmtraueols t2trim3oudllee ivia( arua( ono1aeto ieiyt mDrlu onu0trxrxf3oy1lptean o;s0s2xrim3io1am  mivta() Duaxm nu4tlt ioeildfm uln p;(0 lxnmrcta1laD livo;s0srxr(mpoy4lpe  fvs tf rurum nu4alxo fetadfa rm(msnt4texnxr3iotfpD  uvi;()trxrxmpoy4oltn nesltfs2uaxmp;u0oexn i3ildlm rm(mo t0alerio todfate ues;t setr(o3iy4lltnlivi t)sDtmu  nu4opeoifctaslaDuanvsnu4arenircty1lat auei;( texo(m nydlm emiet tfartr( ont1opx  ieiys a2ranvs;t0 leoxo io1oat ai o;( trxr(opoydllt lfci s  2ra(  ;u1aetnioeiltfa2uaump (0tlxrxo3tatfp eaivolt  etr(o3oydolen fvil(fsDtm(mpou0teeomieiatfm2elnvp u0 lxomo oytomDr nvi s  ruoxrpno4aleelncta(fsrta(rpnt0oetoifcilsls2emuvon(0tlenifctadoa r i slt0 2xrxo oy4open fvta( aDtax p;u1altnioeilt s el(vp () rtrifcta1fpDeanvo t0 exo(m3nu1lle  fet ()srtmxr oo1ape ii3iltls2rm( s;u0alxrmr3iadlmtrln i t trumxr3iodale  fetl(f 2rm( o;t0olxo ictad mDrlnvo;t4tetoif3iytfpt aivi;(  rumim io1ole livi s s2ua(r ot1apx mfetydls emuvs;u)aexomo3oo1faDr uvilt0seumxm3no1lmtn neta( aDtau pnu0texoifetys aDum( snt0tltoxr3oodoatrli s ( s2ur(r ou1openlict (f Dtrxr nt1tpenmoetydfs emnvonu0 eenxrcoytop  auei t)seto(opoudlp n ncsat) 2trxr ot0oexoio3iyslsDea( o;u) lxrxf iy1omt  n o (  rtoiopoy4al e iet s)a2ur(mp;u4tleomoetlsla2rlnvo u4alenxr3iadlmDrli s ( seuo(o iy1alen ncils  Dumxrp;o4tetomo3iad mDemu o u4 lermf ta1om raueil() 2xmxrpnodom n fvia(  rurx  ou4apxnmfcils sDrmnms;t)arenmo3oodopt lu s;s0 etrxrpoydaltemfcilt aDtm(  ou4olxnmi3iltfm emn o;t4altoxocoatlatraues t  2tmxm oodoleemivsls) rumx  no0aptomfetyt a2rmumo t)aetoxr3todomDrlnei t)t2uoxr3iu4lptnmnciasf rtr(  ;u0ape ioeiydfmDeanvp t4trtomrciatfa  luvi;(0tetoxopiy1op nlncsltfa2ur(mo;u0tpxomi3iatfa uanmp t0aetoxr oatoaD lnvs;(0texoxo3ou1aptelivtl(fs2tax p;t0tptn oeiysfm2rluvp u4 exoxr3iadlpDe nvolt0srtoio oo1ol e fcta(f Durumpoo4tet  ociyd a rau ont0aeenmo3oydomDean ol()trxm(m3ou1amt mivsat)aDrmumo;t1olto fcild s2rm(vs u4texnmf iy1fmt lu ol()sruo(mpnu1ape  ivsl(fs2tmxrono0alen feiadfs el(vont4aexomf3iadfat aueo;() etrim3iu4alteliet s  rur( onu1tltn oetatlaDeauvo t)tlerxfcoo1fmte i o ()trtmxmpoy1oltelfcs ( artrumpot0tlx mo3iysla ran p (4 ltrir3tatopD luei;(0setr(mpio1alt mfci ( srtrx pnt4tptoiiciltfm2ul(vo u4aeerirctatfmDr ueolt0s2urxr3oy1amtn fct s sDtm(ro;t1opx mociyslaDea(vsn(0arxrirciotlaDeln o ()srum(m iy1ap  lfesatfsDuaxrooo4alt  i3iyd s2uan p u0 exomr3iotoatrluei;t s2to(m3iy4optemfetasfarururoou1ole ifctad m uau ont)altoxf tytlmDelnes ( setrxr oudlptnlneiatfa2uau o;o4tlx mictltls elums u) ltnxo iotfmt anvo t)sexm(r3oy4ole mfeil(fartr(ronu1texo o3iatfs2rl(mo;t4aetnmo3to1opt aneo t) rtmxmpio1ll   ivi t) rra( ont0optn oeild mDulnvpnt0 exnircootfaDrauvols srurimpnu4amenlncia(f rtr(rpot1opxn i3tydfa rlu s u0teermr3iy1lpD lues;t s2uoir3oy4apeelics (faDtau ont0aleo feildlsDuau p;u4aexnif3oa1fa e nvsls s2xmio oydam nlfct t) Durxr ot4aptniiciyd s rluvs;(4tetoif iatlpDrli o;s) exmirpny1lleelies tfs2ta(mo;t4olxnioeiyt s2eau p t0tetrmf3oadlateau i;( t2uo(mpiu4lptnlfciat)srurx  nu1tpxo f3tls a2rlu p t0texrif3oadlmD anvs;s seuo(r nudalenmieilt)aDtmx ono0ole ii3iytfm ran p;(0arxnmr3ootfateai ols0t2xrim oudalenlfvsls) Dum(m nu4oex mi3tas m2ulu snu)trxoxo oo1fpDeanes;(0trurxr3no1lmt lfcilsfsrur(  ;t0ope micils s2ulnmpn() lxnio3iydfpt aues t  2tmxrpoydopee ics () rrmump;o1tet moeilsfmDrmums;u)texoif3oatomDe iei;s0trxoir3oydom e nvsls a2rm(mono0aetomi3tltla eaumont0 lxomr ia1fpDrai o;t  eur(opoy4om n fei s s2trxr nt1ape mfeilsfs ean pnu)tlerirciodfp r uei t0trtrir3ny1am e fviltf 2umumo;u1alxnmoetldlaDua(ms;(4texnxf3oydfpD  n i t sexm(r3nu1optelnvt (faDra(  ;u4oleo octld s2ranms;(4altoif3tydfat ai il( srtoimpou4al nmiesls a2taumono4tetnifciad sDulumpn(4 rtrxr iytfp rlneols0trxmxrpnydlmtelicils srumxmooo1oltnif3ildfs rl(ms t0alxrmo3iytlaDrlnvil( s2umirpnu1lle lfet ()sDuax  ou4aetnio3iytfa el(vo;t)tlerifcto1optrauvslt) etrxr3oudop emfciatf 2urxmono0oexn feiadfs elnmsnt)areomo oy1fa  lieolt0 exrim io4llenlivsls  rraumo;u1tptomictytls eau onu)altrxr ta1lm  aneil()t2xr(o3nodll   nvsa(  2rrx  nu1ole if3iad m2umn s;u0texrmf iatomte n sl( tetoio nudamt  ncil( sDuau pno4ale miciltfmDrluvo t) renif3to1lpDelnvs s srtmxo3oy1lpe lncsls sDrmur ou4aeenioeiydfa2um(vo;(4 eenxf3ta1lptelnvo s) 2trimpno1openmnciat arrm(mp;u4opt ifeildlmDulumo;(0aexnmocoodoa e ivsl()trxrxrpiodolenlicsat a2um(r ou4tpt mfeiltfsDemump ()aeenmrctydomD aivs;()teur(r3oydam emneslt)arum(r ;u1opt  oeiatfm2uan sn(0 rxoxr3iy1om  an s t t2um(opoo1om nmictas srtmumoou0olx iietysfs rln o u0tlermrciy1la  au s t)s2xo(o3iy1op  mnct (f Dur(moou4apxnmicilt a2em( on() ltrmo3todfa  lnvi t  rxo(m3oy1ol n ietatf 2rr(rpnt1altnii3iad aDelnmsnu)arxoio3tytfmD  u s ()srur(m nudomenlivilsfs2rr(rp;t1altoif3iltfaDuau p ()texnxr tadoat  uvo;s srtoirpno1amte ivilt a2raum ot0opxomo3iasfm2ranmpnt)aexnmf3ia1lateau s (  exoxm iudam e fcils)arur(  ;u4oetniietat mDrlnms;u4 exomocia1laDr nvs () 2xr(r3oydoleemfetas arrmx ono4apxo oetatls2el(von()aexrir tytoaD anvs (0teumirpou4ll n ivsas  rtr(r ;t1open i3iytlm eaumsnt0 exomociadoptrluvil()sexmxrpoodol emnct (fsrua(  nu0altnif3iys a2umu pn()trerifcia1oaDraues;t)setmxo oodlmtemfcia(farraxm ;t4apx mo3tlsfm2eanmp t4 renmf tydfaDrlnvil( srxmiopou4open nes s)aDtaum oo4aetn iciasfm2rlnvo u0 eermo ootfm  auvslt  rum(r nu4aptelneilt)aDtaum ou4olt mfciasla elu snt4aeenmo iodlmDelies s  rxr(rpiydope mivt (farrmxro;t0tleomfciltls2ul( o;(0 lxrxfctotop eluvi;( sruoxo3iudom nmiesas srraur ;o1alxn i3tat s rmnmo;t4trtrxfcia1laDrauvsls tetoio no4lpt  fct t) Drmxrp;t1opt  o3iytfa rauvpnt4 lxrir3tydfaD aivols)s2xo(m oodlptelfct ()sDumxrpou0tpx  o3iadls rauvon(0texomf oytlp elu i;t0 rtrimpiudop emnct sf ruauro;u4aleoifetld s ua(mp;u0trtrmoctydlp rlneo;() 2trxrpoydop n fciatfsDra(m oo1teenifciat m rmu snt0tetnir3oa1opDr nvs t  rtoirpoodlpeelivt ( sDrrxm ;u1tpt  i3iltfaDrm( p (0alxnir3iatfmte ivi;t0 2xm(m oy1am  mncs t)s2urur ;t0oltnifcils s umn o ()trtrmr3oodfm e nes t)srxo(rpiu4ame mnctlt) Dtmxrpnu0tpe ifeiat aDum( pnt) leoiociotop rau o s0 etrirpou4lpt mfciat)arurxro;t1oex io3iadlm2el(vsn(0aetnio3iytlm eauvo;t s2tr(m oy1al   fvs ()aDtr(rpnt1tpt iiciaslm2elu snt4alermocia1fmDeli ols texmio3nodlmt lnesat)s2umxrp;t4ape ioeiadlmDrl( p;(0tltoxf3oytoateaivsls0setmxr oydopte iesasfsDtm(r ou4altnio3ilsla2uau p (0 lxoxoctatlaDelneo t0 rxm(r iudlmtemfetlt) rtr(mo;t4oltomfetadfsDemnvonu0 etrmr3iotlpte neo s0t2xr(o iy1op nlfvtl( sDuax pnu0tlt if3iys a rmn sn(0artomr3iotfmt anvo;( t2xm(opiy4opte fetas)srrmurp;u1teenifetas s um( s;()teermf iodfm eaivo;t)s2uoio3io4lp  lnvi s)aDrrum ot4ole ioctldls rln s;u0 rxrio ootfatrlu i;s trtr(o iydap elfvsa( sDuau onu1tleo o3iad m2ua(mo (4alermrctotfatean il( srum(rpoydamenmnvsas srtaxm no4olt mieiyd s2ra(vpnt0tltnmociydoptr nes ()s2toirpou4oltnmics s)s2taxmoou1tetomictlt aDranmp t0arxnmf3oydfm r uvols)tetm(mpoo4lmt mfetl( arrrxmpno1opx mocias m ra(ms t)aetrio3io1lpD lues;t  2xoir oudalenlietas) 2ua(rpou0aeeo ieild m2ea(vsn(4 rxnmo3oydop   uvo s)s2xrir3iu1lmenmnetlsfsDtrxmo;o4altomoeiad s2uanmpnu4alxoxf iotop r n o;s0trxoio no1ale mneta( srrauront1opeo fctls mDraums (4trermrciydopt an sl() 2xm(r ou1amtnlfeil()aDrr(  ou0opxn fciatfsDeanvp;t0 rtrmf ia1lpD lu o s trtrir ny1om elivil(fsrrm(r ;u1oeeomiciytlm2rmnvsnt) rerxf to1omDeliei;s0 2uo(mpiodopee icsl() 2rr(mpoo0tpt ifeiatfmDeanvonu) rxomfcoatfatr nvs;s0 eur(m iy1op elneia(fa2um(rpot1olxo f3ilt sDra(ms;t0 leomfcoydopD au olt sruoxm nydlmte ncia(fartmum oo4tltnmociydlm rmn s;t4 rtriocio1fptran olt sexr(opoy1lmeemicsa(f Dumxmp;u0oleoioctasfa2rlnvonu) ltoxr3iadfmDrluvo;s0 exoxr nodalen ivs ()sDrr(r nt4tpxo fciydls2ranmpn()altrmrciotfpt auvils s2xoxo3nodalenlnei ()srtaxm nu0tpeoiicildls2umn p;(0trtnio tytop ean i;t trxo(mpny1olt lici tfa2urxm ot4optn i3ildfaDuluvon(0aexoircoydlmD  uvo;t0s2uo(r oo1aptnmies (f Dra(rono1olxo f3iltfaDuan o u0aexoxf iydfp rau i;t0 rtrio ou1llt  fct ( srrru  ou1ope iociydfa el( s (0 ltnmf totlaDean s;t s2ur(o3oo4lltnmivslt) 2uaxroou0apeomfeiyt s2rm(vonu)tlermfciodlaD  ieol( trxmxopiy4lm nlictlsfaDuaxmp;t4tet  ociadfa ul(ms;t4 lxnif oa1faD lnvs;()tetrxrpoudop e iesl( srtaur oo1oltnifetlsfa rl( o;t4 rtrmocoytlp rlivolt0trtoxo3nu4omtn ici t)srtr(m ;t0oleomf3iyd m ulnvp u) lenmrcoy1fp raieo;s sruoiopoo1lle mfetl()a2raum nt1teenmf3iasfm2eanmonu0 exnio3oatoatelies t) etr(rpiu1aleelncsatfsDtm(mp;t0opxnmoeiltlmDuau p;t)trxrxrctydoa ean sls0sruoxr3io1ame  fet sfsrrrxm ;u0oleo o3tat aDuau p;u4aleomrctotfmDe nvi t tetoxr3nudolt lnvslsfsrumu pou4aleniieilsfs2umuvs;()tlxnxf oydlmt livs ()srxoio oydomtnlncsl()aDrmx  no0tlt mociatlsDel(mp t4tltnxr3ty1laDran i;s) eumxmpnodale livslt s2urumo;o4aexniictlt m ulnms u)aexoir tydfm  lieo;s0trxmxr3oydlmtn iei ( sDtru  ;u1open f3ild m2rmu pnu0trenmf oytomDeln s;(  rtmir ny1llt lneta(f 2ta(  ;t0tptnifctatfa2rlumpnt4tetnxr tytopteaueils)trxo(m ou1lm  lnviatfsDuru pno1alt  oeiltla2ranvonu) rtoxocto1oa r u sl()s2umxo3iudamt licslsfa2ta( onu0olxo ieiadfs2ea( o t)arxomfciotfa rau i;(0 rxoio iudlp nlfet (f rrrxm ot4aeen ieiytlmDua(mp;() lxomr oodom   u o t)setm(m oodlm emncslsfs2tmum ot4alen f3ildls rm(msn()altnmf3iadlaDrlivs;(0 etmio3iudlm nmnvsa()s2rrur ;t1opt mo3tadfa rl(ms;t4tetrif3tatomDrluei (0s2umiopoy4apenlictls)a2urxmp;o4aeen fcilt aDumnmonu4tleoio to1fp r nesl(0teur(m3nodom e iesat  rua( ont4tptnmieiasls ulnvs;t0 exoxo3totomt lneo;s0seumxo iu4lltnlfcsl( srumumo;o4aexoii3iatla ea(mp () etoif oydomD lnes s0s2tm(mpnu4al  liesas sDtm(ro;t1apt mieiysfm uanvo t4tlxrxr3totfmteli i;t0s2xr(o3iy1lmt lnvt s) Dtr(ro;t4aleoioeiydls ra(vo t)tltomr oatfmDr nesls)s2tr(r io4aptn fvia(f Durumo;o1alt mieiadlaDumu pnu4 lxoxrctydlmte nvs s0 rxoirpiodop e fcsltf rtr(m nt4tltoiicilt m2eanms;(0 eeoxo oadfmtrlu o;t) eto(m oy4ale livi (faDumx oou4oee mi3iadfmDua(mo (0tlxnxfcoa1omtrli i ()trxoxr iydamee fvslt aDurur ou0oeeniictat s ulnmon()tltoio3oo1fatean ol(  rtrio io1omte fet ()srrrumo;t0olxoif3tldlm2elnvsn(4artrif3to1oa  aivil(  2um(mpiodame  nvsl( a2rm( pot0tet ii3iasls em(vo;() rxomr ty1opt luvs ( srxmim3io4al  mnei t) Dtau  ou0aetn fetatfaDrm( s;(0artnxo3oatlm rlies s seum(mpiydlptemietl(  2rmu oou4tpx moetat sDea(vont)arermo todlpDeaivs s s2xrio no1ll e ncil()s2tmumooo1opt mfeiat sDeauvsnt4 etrirciotoaD aiei;(  2toiopiy4lm   fvil(f rtm(r ;t4oex io3tat a rmnvo;t0tltrmo3ia1oa e u i () 2um(r nu4lptemfesl(fsrrauro;o0tlx  fciasfa2rm(vo u0artrif3tatfmtrln ols)trxm(m oo4amtnlfcsatfa2uaxm nu0olxn o3ild m rmumo t4 rxrmo oy1lmDe uvs t0t2trxm3ou1al emfvi t srum(m ;t0alenif3tld a2el(mo;(4 lxnif3oytfmte uvo ( srtm(rpiy4ap n ivi ()arra(r ;u0oetoiociatls2elnms;(4arxrir3io1om  aues s0 eumiopoodlp n ivslt  rrmu p;u4tleoioeiytlsDrmnmpnu4 rermr iydopte u s t) rtrxo3oudope  ncsltf 2rm(mp;t0tpt mfciltlsDrm(ms;(4 etnxo3totfptrlnei;(  rtm(opnu1al nlfei ( aDrmxmpno0texomf3ilslaDra( ont4trtniocoodla rli s;s)trxrxo3iydaptn fetatfartrx  ot4teen i3iydfaDrau pnu)altrif tatfmt lieilt)t2tmio3oudape  nct s)srrrumonu4apx miciatla2umumsnt) eeoxr3iy1fa elnvi;t  exr(m3iy4lptnlfvi sfaDtrurono1opt  ietytlm uanvsnt4arenxo3iy1opt  i s;( trxrxo io4alenliesl()a2trxroot4olxo i3ilt aDua(vo (4tleoxr iytopD luvs (0srumxm ou4al nmieils sDrr(r ;t4oleoifctatfa2ra(vonu0tlxnxrcoytlp   uvo (0t2xmxm3nydopenmfesls  Drrumpnu4aee ii3tat a2rl( o u4 exnmfctotfmDe ies;s0sexrxmpou1lpte net sfs2ta(moou4apeo f3iyslmDul(mp (4 exomrciydop  ln i ()tetr(o ou4lp  lfeiltfsDurxr oo0tpx  f3iad a uln on()aetrif3todlp raues t)setmimpoy1aptemfvt tfarrm(roou1tex  i3iltfm eluvp;t)artrxf3tytfmtr uei;s)srxo(mpnydlleelnci s s2ta(r no0texoii3iyd a2ulumsnu4texoxo3ty1la ranvil( sexo(mpnudap elivs sfarum(monu4oeeniieiytfsDem(vs (4 lerxocto1fp   uvolt0t2uoir oo4lp e fetasf rtmurpoo4tpenif3iydfmDumnvp (4aeenxr3oo1lpDeauei (0 rxoxr3no1lltemfetat)aDtaxro;u4tltn ieiasfs2ul( o u0 etrmo3tatlaDeanes;s trxrxopiydam emfes sf rtrxr ot1ope  oetaslaDuan s t4 rxrxo3oy1faDrau o;s) rtoxopou1am nlict ( srraxmo;t4tee  fcildlmDuln s u)trtrif3to1latr ieil()trumim3iodlp elivs ()aruaurono4apxn o3iatfs2ranmp (4artoifcta1lpDe ivi (0t2xo(o3ou4am elfcias  2taxronu0ope miciadfa rluvs (0teeomf3tytfmDeaieol()srxr(rpnu1amtelneta(farra( ono4tptnmoctlsls elums;()trtoxo3tadfa  au o;t)srurio3iydal nliei s  Dtaur nt1tee  i3ild sDum(mpnt0 exnif3iotlpDelu i;(0truoir3io4llee fvt (fs2rmxrpnt4olt  fciatfa eauvo;(0 lenmr oy1fmD ln o t0t2ur(opnodop emnvils) 2uaurp;u4opeomiciaslsDemuvp t0treoif3to1fa rlnvi;s srxrir iy4openmfviatf rtrumpno0olxo ocild aDea( o;u)aetrircoadfmDe u o s  eur(o iu4ape  fetasf Dumumpoo0alen oetldfa2rau sn(0tltnxociydlpt aivol(0trum(rpoo1lptemnvsl(farta(mo;o4ape iieilsfsDuauvp t4aleoifcoydfpD auei;t0s2tmxr3ou4llt  fctls)a2rax  ;o4oetnmi3iatfsDran s t) leoif tatomD  ivs;s)t2tr(m3io4al emies (  ruaump;u4oeen ociasla2emnvonu4arxnxfciydoaD lnvilt)srumxo oudlmtnlnet t srtm(r ;u1ale iociysfaDemnmsnt0treoifctadomD  ies ()teuoxo3nu1ll nmies tfs2ur(mpnu4aptoio3iat a rlnmonu)teeoxo tatfmDr uvs t)sexo(m3ou1lm e nci (f Durx o;u0tpen f3iasfm umu s u4aeerio3oo1latranvils texoirpiy1amt lfci t) Durxmpot0aee mieilslm rlnvpnt0altrxf3iotfp ranesls)srxm(r nudol   ici ( srrmurpoo1aetnifeilt a2ulnmpnu4 reoxf3to1fa eauvi s)teuoio oy4omtnmfesasf 2taumpoo0altoifctlt a2ra(ms;(4areomr oy1lpt auvols s2xrxm no1olenlfvs (fa2raumpnu4aet  oeiydlm2eauvonu0 lxomrciodlaDeli olt t2uoxmpiydlmt mfesat)arurum nt1aeeomo3ilt aDrluvs;u) etnxr iadlpD aivslt) euoim iudome  fvtls)s2umur ou1olto octytlmDrluvo;t0alxomf ta1oaDr i s ()sexm(m ny1ll emfetls srrm(m ot4aexo ociyt s elump u4 rxrmo3ty1omtelu s;(0trxmim3ou4omtn net () Dtm( pot4oet mocildlm rlumsn(0aeerif oodopt ln il( t2urxo nudlpt miesat)a2umxrpou0tlxo ieiydlmDemumont4alxnxo3tadoaDe u ol()texrim3nudomte ivt tf 2taum nu4tlxnio3iydfm2ra( o t)alxoxrciodlpDr u i;s)texoiopiu1am e nvils artmu  oo1alenmociltfm2eanvsn() rxniocoodfp  li s s0trum(o nu1apenlnciasf rumum nt0texo o3iaslm2rauvo;u0 eeoxf3iy1lmt aivs (0 2trxr3nydol  mfvils  rtmur ot1aex ioctldlmDrmn o;u4 eenmfciytlptean olt trtmxr ou1omee ncils arur(rp;o4oetn icilt a umn o u) rxrmf ia1fptrli s s) rurim iydal nmfciasf 2tmx pnu1tlx  fetasfmDrmuvpn(4alxrifcootlpteanesl(0sruoimpiodame  iet () 2tau o;t0opxo oeildlm2eanvp;(4tleoir tadfptrli s;( s2uoimpio1altn nci s  rrm(  ot0aexnii3iltfs2um( o (0 ltnxociodoaDrluvols0seurio3iy1lmt mnci () 2tr(rono4ale mocias aDulump;u) rxomf3tydla r ueo;(0t2xm(m ou4ll nlnvtl( a2ra(moou0tlxomfeiad a2rm(vs;()teeomr oytlptrli o;t)seuo(r3iydalenmnvtl( s2urxrp;u0aee iociltla ua(ms;u4tleoif iy1oatrlneo s0srumirpno1ame mnvtltf Dtau p;o0alt  feilslmDrlnvs t) etoxocoatfa elieo ()srxoxr3ou1apt lfvs (f Duauro;u0aexo iciatlsDuanmp u0tlxoxrcoadlaDr uvslt  2xmir nydalen nvslt srrmxmpoo1tpenifciyd sDrmn s;u4 reoxo ty1fa  li i () 2um(opoy4lm n fvslt)sDumumpou1alt iociad a2rauvo;(4tetoxoctodlp rln i;s teumxo nydom  mfvi sf 2ra(  no1oetn i3ildfs2ranms (4arxnmf3ootfa e uvolt0 2trxm3oodaltemncsasfsDtaumont4oet ifciltls2ua(mo t4artoifcoadlatr nesl( texrim io1lptnmivtat sDrr(rpou4aetomo3iatfaDrm(vp;u) exrxr3iodlmtelivi;s) rtoir3ny4lm nlnei t)sruau p;t1ape iicils a2elums;t0trtomr3ia1fa rau i s  2trio iu1openlnvt t  rua(mp;u0ole  o3ilt a2el( o;u4aetrxrctodom e nvo t)setm(opou1lltemivsls srururp;o4opx  o3iasfa rmu o (0trxoxocoadlmtelivi ( t2trir no1lpeelnct s s2rmx  ;t0aeto i3ilt a emn o (0 eenmr3ta1oatr uvo;s)tetmxr iu1lltelivt (  Dra(  ;u0apxnioetls s2ul(ms ()altnxr3iytopt aneils0t2tmxo oo4lm e ivt s  2trxmono4apeoif3tyd m2ranvonu)artoxocia1fm eaueolt s2trxo ny4lle mivt tfaDta(m ou0tpenii3iatls2rmnmo u4 renxrcootoaDeln ol() rurimpoodopt mfvtls arumxmpno1aetoifetls s2umuvpn()aeerir todlm rauvi;t0 2ur(r oo1ame  fvi sfsDrrxmp;t0tet if3iyt a2umuvp t0aleoxo iytoaD  ues;s)srtrxm oy4apeemicilt sDtm(roou0tlxomictad m2uan s (0arermociadop e nvi;( trurir3ny1ap emfcsl(fartm(moou1alxo oetas s elu pnt) leoif3tytfm  auvs;s0trto(o3oo1am elfesa( a2uaur oo0alenmf3ildfs eauvpnt4trxomf iotomDrlivol( seumir3ny4omtelfetlsfsrrr( o;o4oex mocils a rmuvo u0teermf oadom e nes;s s2xrxr iu1llen ncia(fs2rm(ro;t0tpxnmfeiysfs2ua(vs;u4trxomo totomtrlnes;s tetm(m3oudapt mietlt srrm( p;o0olxoifciatlm2rln o;()alenxoctotfmt an ols t2xrir3no1ol   ictltfa2tr( o;o1aet  iciasfaDemu s;(0altrmrcoo1lm ran o t teuoio ny4ole mneilt)aDrmum ou0alenmociaslm emnvp ()tleomf3iatlate iesls0 rtmir3iu1alen ieta( s2tau pnt4aeeo fciltls rm(vonu0aeeoio3io1fpDrlnvils0seum(m iudomtn fvsls a2rr(  ;o0optn octys sDrlums t0tlxrxoctydfmDeanvs;(  2tmxopou1altnmies tfsDuru pnu4opxnmfciltfm2emn o ()alxrifcoytfpte u o;(  2um(opou1alte nes t)sDta(mpno1tpxnmo3iyslm2elu p;t0artrirctotoatrlnei ( t2um(m3iydlle mivsat)sDrmu ono1opx miciydla2el( p;u0teenir3oa1fpt aieols0teuo(r iu1om nlnvsas)srrmxr nt4aeenmo3ils m2rlums;t0 exnxf ootopDr nvi;(0 etmxr io4omtnlivtls)sruax poo1aet iicild aDra(vp t0artnxfcoydop rli ols)trtrio iy4ale lnei s) 2trxm oo0olxnioctydfa rmnms u0 lermrcoytoa  lnvi;s  exmxo3oodam  mnvslt)s2tau p;u0altomoctadlaDuluvs (0alxnmr3iotlp   n olt srtmxopiy4ll n nei s aDuaum ;o4tptomictls mDelnvs;t4 reoxo3oo1fmDrau slt)trtmxr iydal elivs s sDuaur nt1tee moetysfm2ua(vp t4aexoxfcoydla   uvs;() etrio3ou1om emfvsltfaDtrxrono0tlxnifeiad mDranvo;() rtrxrctatomDrli i;s)seurxrpoo4lm  mfeslt)aruax  ;u4oee  o3ilsfm2eauvon() eenxocio1laD ln i s)seurxo3iudap elnct sf rtaumpno1tetoiictys sDuau s;() lxrxr3iytfa ean s;t  etr(opiydomeelictas)artmum ;o0apeoiietltfmDem(vp;(0artrir3oo1opD  uvo s srtrio iydaptnlfvt t arrrxm ot4tle moetasls emn s t0 eeoircoy1fa   n o;(0 rurxr3nudal elieiat)aDraurpnu4tlxomfetltlmDumnmo u4aexomr oy1faD lu ols) eur(r ny1op elfvtat  2ta(  ot4oex  i3tlt a2uauvs;u4alerxf tydlp e neo t0seumirpny4lme lici ( s2ur(  ot1tle moctysfaDuanvs t0aeenxo3iytom eaueil(0 2uoirpiodlltnmnctlsf 2raurp;o4opeo i3iytlm elnmp;u0trtrmf totfpt  ivi t srum(rpou1aleelieias)aDururpoo4texnmociyd mDel(vpn(4arermf oa1fatrliei;( t2tr(opoo1llee icil()a2rrxmoou0tptn i3iat sDemump;(4alenmfctadfa elu i;() rxo(mpiy4alt lfvtat)a2umxrpno4aex  fciatls2ulumo u)trxoio iadlpD lueslt t2uo(o oo1lmen ivtlt)srrrxmont4texo i3tad m2eanmonu4texrmf3iydoat  n i;( t2xo(rpnydlpe mfvils  2tmxmoot4oexo fetatfmDem(ms;(0arxoxo3oo1fpt  ues;t teum(opno4altn fvi t)s2taur oo4oleomfciytls el(mo;() rxnmo tadlmt lnes;(0trxmir iy4llee netltfsrua(rooo1tpeniieilsfm rmn o t0artnmociodop raueol() rumxrpiudap elnet (f rua( o;o0oexn o3tysfsDra(ms;u4alxnxfcoytoaDranvs;t)sexm(opoydllte ieiatfartmu poo1oeto octasfm2rmnms u)aeerxfctydlmDrlivi;s0teumio io4op nlivil()s2tmxm nu0tpto octldlm2rmu sn(0arxoir todoat anei s  2xrxopoydamtn feiat  Dur(rpnt0oltn ocilslmDrmuvo;(4 ltnmocio1lat lieo;(0 exo(o oudlmenlfvt tfa2rmxmpoo1oeeoif3iyt s2uan p;u0tleoio3ootfatrauvs (  euriopnu1am  lics s sruaur ot1texn oeiysls el( o t4tleoir3tadoaDranvi t s2tr(m3iu4ol n fvt () 2raxmpnu1alxoifeiydls elnvs u0aexrmo3oydfaD  u i;t0 2um(opnu4altemiesl(farururpno0tptomo3tat sDua(vs (4altnmr oa1oa  lneo t) 2xo(opiu4openmies () Dtr(  nt1teto o3iadlm2rl( o;(4 exnxrcoydomtr i ols srxmxr no1op elivtatf ruaxr nu1tptn ieiyd m eln snt) rxrifcoa1omt luvs;t)t2xr(m oo4oleemfvs s) 2rm(ro;t4tlt mictytls um(vs;u4 lxnmf oo1fmDe nvo;t  2xmimpio4amee nes (  rtm(rpot0aex ifciat aDranvsn()trxnxf3tydfatraieo;(  eurxr3iu1ale  nes t)s2ur( p;u1olxo o3tltfa2umn s;u0aexnmo3oa1fmt  nes;t)t2toir3io4omeelfvtlt  rrrumpot4optnmi3tys m2uaumsnu4 rermr3oydoatr ivols trxm(mpiy4ale lfcsls sDtmxmpoo4texomfeildfs2umn p;(4texrmr iotfmDeau i;s0t2xriopnydoptn ncs s  2umx  ;o0olxnif3iaslm2ulumsnt4aleoirciydlmtraneilt0s2toio io1lpenlfvtat)sDumumo;u0oet micilt aDel(msn()aetrifciatlatelieo;() etoir3oy1alt  nesl( arumu  no4aeen o3iytlm ea(vo u0treoirciytla r nei;t setoxr ny1omtn fcsltf Dra(mp;o1aet ifeildfmDrmn ont0teenir3to1la eai i;t)s2trimpoo1opt lfetas srumx ont4tpeoif3iytfsDulnmsnt4 lerifcoydfptr i sl(  rumir iu4amtn ict tfarrmxm ;t1apxoiietat a2ranvonu0 etnxocoodfa eauvsls) rumxopnodll elfcsas  Drr(roou0apeniociadlaDrl(vp t)tlxrxr3iydla eli o;( setmxrpoudome  ietat srtmx  oo1tpt if3tysfaDeanmsnu0arxomf iadlat  ivo s0 2to(o oo1omt mncsls)sDraur ;u1aexoif3ilt aDra(msnt)tlenmfciodfpD  nvi;(0 2um(rpoy1omtnmictlt a2tmxr nt1aeenmiciltlm2ea(msn()tlxnxociytopteli slt0srxm(mpnudlleelfetl(fs2umu pnt1alxomo3iad s umnms;u4teermfcia1lmDr ivils  2xmim iudol  mict t s2taxrpnt4oee iiciys m2um(mo u4 eenxr oadlpt aneil()srur(rpoudoltnlneta(fsDuaxr ot4tetn ietlt s2emuvo;()aeenxo to1fmt  u o t s2xrio3iu1ol  mivsls) Dtru oot1texoif3iyd m emnvo t)artrir ta1la eaivs;( sexm(o ou4lltemfes t)sDtrum ;u4aet ioetysfa2ea(mpnt)tetomf3iotoa  ln i;t t2um(m3ny1apenlfvi s)sDur(  nu4apx mfciaslm ran s;t4 ltrmr oadlp eli i t)srxoirpnodam nmietas  2ur( ont1teeoiicildfm2eln pn(0arxrxr oydfpD  uvil(  eurxm ou4lpt mneiat)a2rr(m ;u1tltnmi3iyd mDumuvpn()tlermf3iydfaDraneo;t)s2tr(r iy4omt lnvi (f rur(rp;o0tetoio3ils a2rluvp;t4aetrxf3oatopDe ieo;(0seumio oy1lp emivil()aDtm(r ;u4teenifciasfaDrlums t0texnio totoateanes;s  2xrxm ou4al nlfvt s s2tmump;o1tleo ietlsfm2emu snu4tlenxr3tadfaDelnvo t seuo(opiudole mivsa( sDurum ot1aee  f3iysfm umuvs u4tltoxf iadfmD ai o;s0 rxmxo iy4lptelnesasfaruau  ;u4ape miciltls2emuvpnu0 reoxf3oodfp e ies;t0srtmir3ny1ap  lfvt tfs2trum nu1optn octysfa2uluvs ()alxoiociytfp rai o;s) 2toxr no4ome mnctat) rrrx o;o1oeeoii3iyslaDrm(vs;u4 rxomr tadla r nvo () 2tmxo iudop  lfci ()s2rrurooo0tpx io3iadfm ulnvp;u) exoif iatfa  liei s) ruo(rpno4lmtnlfcil() rurur no0tlenii3tyslaDul(ms t) etnxf iadoaD au ols s2uo(opou4apt  fvils srtrxro;o0oeeomo3iasfa2rm(mon(0 lxoif3oatfatelivs;(  exrxrpiu1oltnlicta(farurxmo;t4tlxoii3iyt s umnmo (4arxrmo3tydlmtraiei t0s2tmxr nu1lpee fvi s)aDrrxr nt1texomictltfm ra(ms (4tlxnxf totfpte ivs s  2toimpno1lmeelivsl( arumx o;t4tpx ifctys s2rmumo;u) lenxfcoadlmtr nvilt0s2umxr iudlp  lfvs t) 2rruro;t0aleoiociyd a ul(vsnt) exrmf3tatomD  uei s)t2to(r3ou1olenmfci tfsDtrumoou0tex ii3tltlaDelu o;t0alxrif3oodoptrau o t tetrio ou1lmenlfvi s)srraxr nu4tptnmo3tlsfsDrauvon(4aleoxoctotfmtrlu o;t0 2urir3io1ll e nvias sDrr(  ot4oee moeilslmDul(vo;(0trtoxocty1omt aivi;()seurim ny4lptemfvs t)sDtmurpoo4opeoifeiydlaDemnms;() rtnxo3oodfm r ies;s) eto(o nu4om nmnvt sfartrxro;u4texoif3ils m2ra(mp;u4 leomr iadopDr nvo s0teurio io1ol emnvtlt)s2tr(mo;o0aexn i3ilsla rm(mp;u4 rxnxo3iatom  luvs s truoir3iy1al n neilt)sDtr(rooo0alen fciltlm ul(mont4arxniociy1oa   neo s  rtmxo ou1apte ietasfsrrrumo;t0aex  fetadlm rmnvp;t4 exnxf3tadfpDeli i;t) eum(opiy4omtnmictat)a2rrumoou4aeeomieiysla2uan s;t)aetrif3ty1fpDelivo;t  rum(m3oo1oleelnvt t a2tmxmonu1tpeo i3iadls2elu p;t0arxnxr todlat li o;()t2toxrpoodam  lfes ( arum(  oo4tlto ieiytfm ulnvont)aetoif tydop elnvo;t)texoxo iudoltn ieiat artrxmpou1olxo iciydlmDemums;()trxoircoydopt  ivslt) rtr(m nu1am nmnvsltfaDtax  nt4opxo f3iatlmDul( s t4tlxomo3oydoaDraueilt)texmio3iy4apenlics ( srrax onu1ale  ociasfs2umnmpnu0arxrmr oa1oaDr ivs;t) euoxr3iydlp emnes s)artrxrpnu1oexoifciyt a uau sn(0 ltomr3oa1omteaivs t)truoxmpnu4omtn fci t)sDrax poo4tltoifctat a2elnvp t0altomr oo1lm rai il(  rtm(o oy4llte nei (fa2taxrooo0tlxo oeiydfmDeanvsn()texrmo3ia1oa raieol(0t2toir oydlp nmnvs s)a2umumpoo0olenii3tyslaDeaumo t0tltnif oy1fpDrai o s0t2toio oo4omt lncta(  Draum no1aeeo oeiysfm ulnms;() exnif3iadop e ivi (0s2urim3oydlm  lnvtasfaDtmu pno1aee  ictadlmDeaums t)aeerio3iydlaDe nvo;t  exrxmpiu1ap n ics ( aruax p;t0tpeniociat s rm(vp;(0 rxrir ia1fm elnvsls  2uoim3oy4omt  nvslsfa2trxrpno0oleoii3iys m elums () etoxf3to1faDelneo;(0srxr(m oodap   ics tfs2rmxr nu1oet ioeiatfmDrm(ms t) ltoio todom  aivi;s)s2xrim3iu4oltnmiciat) 2tmx  ou4aet ifciydlsDum(mo;u0tetomo3todfmt aivsl()setrxo nu4ap  mfvsa()arrmu oot1apeomf3iyt m ran p t)tltnmo3oy1omD  nvslt0texrimpou4lp nmneil()aDur( p;u0alenio3iltls2rmumon()texrxo ta1opDraues;s  2trio3ny4ol nlfesl(fsrururooo1tptn i3iad a ulnmsn()areomo iydopDrauei;s  rxmir3ou1omt lnei ()s2ta(rono1tpen ictlslsDeanmo t0aeermo3iadop  ai o ()seur(rpiy4lltnlfetas a2tr( p;t4apt iiciasfs rm( p u4tetoircoy1op e ivs () rtrim3iydomte fvias)s2tr(  ot1opx  o3iasfm2rlnmp t4aexoxo3iadfatelivi s  rumir3iu4omee ict ()sDururoot0tpxomfciysfm uauvsn() lxoir oodom ran i t  2xo(o3nydllt mfetls s2ta(ro;u0tlx mociad sDum( p;u4 rxnif3oadomDr i o s0trur(m3nu4op n ieias) Dumur nu1tpx ii3iatfsDrlnmp;(0artnxf tydlpDraivslt s2um(r3io4lme mietat)srtrx  nt0olen iciydls2umnms;u) eeoir iatfaDeln i (0trtrirpoo4olenmnesl(f 2umu ono4oee ifetltfmDrmnvsnu4aexnif iadomt ln s;(0 2xo(opoo4lp emnci ( s2ua(rono0tlxnmicilt aDulnvp;(0tlxnio3oo1opD au i t) rur(o nodlpe  fcilsf Drruro;o4tlto fciysfmDuln p;t)aeerxrctodoa ean o;() rtmimpiu1ol elicsl() rtr(  nt1apxoioeils m2ran pn(4artnmf3oatlaDeaivs (0 exm(o oy1omenmfes s) 2urxr ot1alx  f3iysfm elnvs u) exnmo tydla   uei (0 2tm(opoydaltnmnciasf rrm(rpoo1opx mf3iasfs ra(vp (4 ltomoctatlaDe u sl()t2uriopoo4op elfvt sf rtru p;t0olx  oeiatlsDrmuvsnt0aexrmr3iodfmDean i (0srxo(mpnu1al nlivs (fsrtm(mp;u0opxoiictyt s2ulnms;t0arenmocootla eanes;(0 2ur(o io1am  lnctls a2tr(rp;u0alen fciydla elnmp u0aetoirciodomtr uvs s0 2xoiopiy1lpenmiciat)aDuru ont0oexn o3ilslm ranmsn(0areoifcoatlaDelnvolt0trxmir3oydalen fcs ( a2uax p;u0tle ifeilsfs ea( pnt)aexoifcoodfpDe i ol(0seuoxm3iudlltn nci sfa2raxmpou0opt ii3iyd aDrlumpnu0arxoiociadfatr uesls  rtmxrpiu1ap nmivtlt sDuaxm ot1apxoiietadfm rluvp t0 rxoxo iatlat lies;()s2urio nodam e iesat)arua(r ou4texoii3tlsfs2eanmon(4 lxnmfcoo1opD an il() 2xrxr3iydomt  ivi s) 2uaxm ot1tpenii3iadfs2ul( s;t4areomfctydoaD  i o;(0 eur(rpoy4om emncilsf rur(moou0alt mfctyd m2ea(von(4trxomf todlm   ieo () 2uoir iudlp nlfesa( srumumoot1tlxniiciadlm2rmnmsn()tlxnir oatoaDraivo s  eumxopnu1opt lfvia(  rum(rpno1aeen ieilt aDra(msnt)aexrmfctatlptraivi;(0 rxm(r iu1om nmnct t)artmxm ou4olxnmo3ild s2ulnvs;t0 rxnxocootfm rlnei t0t2toxrpiy4lmee nesa(fsrur(rono0aptn fciydfa2ulnvonu0 ltnmocoatfmD aneo;t0trxmiopno1lmt mnvi ( srrax ooo1alenifctys m umnms;(0alxnif oy1fmtraues;t seuoxm3nydalenlneiat aDrru oot0tlxoiiciyt sDua(vs;(0arenxrcia1fmDeaueo () euoim oo4optnmnvsat)srum(m ou4apeoioctas aDelumpnt4tetnio3tydlpDrau s;t0seum(o iudope mfvslt  rtrxr ;u4aeeomo3tlt a el( p;u4trxomociydom eaiesls0sexmir oy4lptnmfetls  Dua(rp;t1oeto f3iaslmDuluvs (0texrir ty1oat  ieols t2tr(m3iu1ale  netat aDtm(rpno0tlxnmietytfaDuan sn(4artrif ty1fmD ln olt)setrio iy4ol n ivsl() 2taxm oo0tex  o3iydfs elumpn(0 exrxr3ootfptelueol( teur(o nydomt  iesltfarraxm ;o0aleo feildlm ea(monu4 lxrmr3ootfa rlu i;s  rtoxo3ny4openlieilt)a2rmu pot4tleoiocildla2emnvo (0tleoxr oatlm ran o t texrim3io4om e ies t  Duax ont4oee iicild sDea(msn(4trxoifcootlmDrli i;(0 2urir3iodomeelfvtlsfaDra(m nu0aptomociltlsDeluvont4texnxo ty1fptrlieilt0s2umiopiodoptn nei sfsruau ono0tex  o3tytfm elnms;u0aexomfcootomtran i s s2trimpiu4ameemnvtls srtrxmpoo0texomoeiatlm2elump;(4teenio3tytfmteaneo;s) rur(rpnu4op nmfesasfa2tr(r ;t0tpx moeilsls2ua( p u)aeeomo io1op r nvolt trxrim3iydlmt  nct s a2ua(rpoo4opt  ictatfmDemn p t4treoir3oodfp eluvs t teuoio nudomeemnvtl(f rta(r nu4oet  fcildls emnms u4tleriocootfmt luei t)srxriopiu1om n fvil() Dtax oot1alt ifciad sDum(ms ()alxoif totfaD  i s t) ruoxm3ou1alt  fcias a2ra(mpot1aeeoii3iadls2ulu ont)tetoxo iadfpDrlnvils srtmxmpno1ol  mnes s arra(rp;t0aet ioetatlm um( snt)arxnxr3iydfat lieo;s0 2tmxr3iydolte ics sf Drmurpno1olxn fcils s2elnms u4arxrmf oydoatr uvsls0t2xrir ou4al nlfcs tf rrm(rono4aee  f3tydla2ul(mpnu0 etoxfciadom rlnes ( trumirpnodal n nviatfsDrm(rp;u1teenmi3tas a2el(vp;u4tlxomrcoo1laD auei (0s2tr(r iydlme lfesatf 2tmxrp;u0texoiicias a eluvo;u) ltnio tydlmD  uvil()srurirpno4am e ieslsfs2rr( ont1aleoiietad a2uauvp u0alxnmo iy1fatelnvo;s tetoir3nydal n fci s)s2rru  no4opeoiietlt a2umumpnt0tltoxrcoytfm r nes;(0srtmim ny4lltnmivil(  rtaxm ot0oex if3iadlmDua(ms t)areomo3iatfaDraues;t0 rumirpiu4oltnlfei (  2uaxm nu4opxo ociytla eluvpn(0aexoxr ia1opDranvi () exr(o nu4apeemfesat)srra(m oo1tlxn feiatfmDrln p u)alxnxr3ty1fm eauvol()t2xrxr oodlp elnctl() Dtr(rpno1aex iociytfa2emuvs;u)alerxf3tydlpt aieo;t0 rtriopoydlp emnetlt s2tmxrpnu0aet ii3iltfaDrluvo (4 ltrxf3ia1fm ran i ( tetr(o io1ap nmiet sfaDtr(rp;t4tpx  feiatls rmumpn() ltnif oytfaDeaiei ()teurim3iy4amenmnciat sDtaurp;t4tlxn o3iytfaDuau pn() rxrxo3tadoaD  uesl()s2tmim oudalte ict (f rumx ooo0teeoii3iytla ulu o;t)treoxf3todfptelueilt  etmio ny4ome lici (  2rmxr nt0aetnmiciatlaDul(vp t4 rtrmocty1fmtelueo t t2triopiy4ol nmfetls) 2urx p;o4tptnii3tld mDemn o (0aetrxr3iy1fpD  n i ()truo(mpiudome lncils)a2uau o;t0apxnmi3tls sDemnvo t4aleoir3todoa  aivsls)t2xmxo3oy4optnlnvi t  rur( onu0teto f3tas sDumumonu0trtnir tatfpDr u o s)srurimpno4ope miviatfsDtmxr nt1ale if3ildfmDrmnvs u) etrif oytop  an o;s t2xmxo3no4ll nlnct sfaDrmumonu0tpx ii3tadfa2rln o;u4tltrxfctytopD aueo;t)sexoxr ou4oltn ncs ()a2rau oot4oltomo3iyd s um(msnt) rxoircta1fm r ivslt)trtmio3iu1llt mieiat  2tau  nt1tltnio3tytlmDum(mo (4aleoircia1om ran ols tetrir3nodlp  lfcsa()s2rau ooo1oet  fctlslaDea( o ()aexoio3oodfat  i ols)setrxopoo4ll e fci tfartaxmonu0aet mo3iltla2elump;(0tlerifcoy1lmtrln il(0trumxrpiu1om emnvsa( a2rrumooo0olx  i3tasfs ean o;(0teeomr ty1faD  n s t)trxmio3oudamenlncia(  rraxr ou1olto ietldfaDra(mpn(0aeeomf3oatlpD au ol()s2xo(o3io4altnmneils)artrurpnu0alxn i3iyt m2umnms;u4trenxrcoodlp  lnvs (  2xm(opiy1ale  neslt)sDum(m ;o1apxo f3iatfm2emuvpnu0trxriocoo1latrlnei t) exoxm ny4om emncil()srtmxr ;o1tptniietlslm2um( p t4texrxoctatlmD aueo;s0 exr(m3ny4omtemnct (fsrtmu  ;u4tpxniocilt aDelu o;u0arxnifcio1omtr uvs t0srum(o nodlltn icsl() 2tax  ;o1oltnmoeiad m rm(mpnt0 rxoircty1fmtr n s;( s2xrio3iy1omenlncslt  Drrxront0opxn ieias s2rm( p;u0teerir ty1optelneil() exm(o oy1opt livia(f rur(r nu4tpe moeildls2ranmon(0aeermr3oadlmDe ueslt0srurxr3oy1ap  lfvsat aDtmu o;o1tetnmociyd m eauvp;(0 eerxrctatlm rlivils0 rurxo3io1omt mncta(farua(r oo1oeto feiadfm2raums (4 exrifciatlpD  n s;s0s2to(r iydlme mnciat sDra( p;t0olt mf3tad a2em(vp u) exnxr ty1opDeai o;( trxm(r3iy4omt lfvi s arur( p;u1opt  oetytlm2ean o;(0aexrmfcootfpDran ols  2xrxm ou1lpte ics s)a2um( pnt1tpxn oeilt mDraumo () rerxf iydoaDrli o (0srxr(opiodoptemictas a2ta( ono0apx  f3tld a2ulnvs;u0tlermf3iodlm rauvs;s0sexmxm no1lltemivtl(fsDrrurpno4tleo feiatfaDelnmp (4aetomf ia1lmD li s t  ruoimpnodlle  fei s)sruax  ou4apto o3iadfs rl(vpnu0 rxoxfciytfpDran i ()s2uoxo3iudlleeliet ()aDumu pou4ale mieiadlm2uaump u4tetnifctatoaDe uei;(0trtrir3ny4opt mictas a2um(  nt4altn o3iyslmDeln pnu4arxomf oydoptraieo ()texoxm iodole micils sDumxroou4tptniicildfs2ul( s (0texnxocoadlm ean i;s)trtm(opio4apt lfetas a2tmxmpou1alt mo3tasfmDemuvp (4alxnifctadoptraiei;(0 eto(r nudlpen ivsls) rur(moot0oltnifcias sDrlnms;u0aexnmr io1lat  uvslt) rumxm3ny4oltn ivilsfa2taxro;t0oet iietldfa2uaumo t0 rtoir iotfpte nes s s2um(r3ou4oltnmfvslt) Draxr oo0oee  ieiytfa2ua(mo u0alxrirctadomteliei;s  exr(r3io1oleelfvt t  rur(r ;u1tle mo3tat m2umumo;(0tlxrio ty1lmDr u i;t)sruo(r3iu1op   nctat srrm(rpot4oetnmf3ias m rmnmp;t)arxnif3ia1la eaneslt) 2um(r3ou4openlfeslsfsDta(mo;t1ape ioeils sDrlnvo (0texomr ta1fpt  u i;()tetm(o3io4al   ieil(f 2rrx onu1aexo feilt a ul(mp t0tltomo ta1om eaiei;s teuoxm nu4apenlnvsa(fs2uru  ou4alt mo3ias aDulnmo (4tlxnxr oatoa rlues;( srtm(r nodomt  ncslt)sDtr(  nu4opt moctlt a uau s;(4alxoiocta1oa rli sls)truoxm nu4am  lnesa( sDurx onu4aeeniociyd aDeaums u0tltrir iodfmDr ueslt0 eurxmpiudap  mivt () rraxr ou4apxomo3tat a emu pnu0 etnxocty1opDrln slt)t2xoimpiy1aptnmnvsas)arrmx p;t0olx mi3tatlsDrmumonu4alxoio tydfa  aivs t teurir3iy4llenlici tfsDtmx p;t0aeenmfciysfaDran s;(0 lenir oadoat  ivi;t)srur(o3oo1omenmictl(faruru  nu4optnifctadls2rln sn(4 leoxf3oatoa r u s t setoio3oo4llenmfvslsf 2tr(m ou1texn f3tldlsDra( snu)arxoxf3oo1lmDrln s s)seum(r iydlmte nvt s  rrax onu1aet  i3tltfm2rlumont)altoif iatfa rlneo s0 rtmiopiu1lltemivilt sruaxmpno4oetnmfeild a2raums;()trenmo3todfmDeluvi (0 2xrxm iu4ol  lnctat)sDrrx  ;t4aee ioetydlm2umnmp u)aleoiociodlmDrli o (0s2xm(o no1ol n ivs ()s2umurpnu1tle mo3ilsfsDelnvs;(0trerxfciydfpD luvi;s0tetrir nydlmtnlfvtas  rtmurpot4aee  i3iydlmDuanvo;u4aetomrciytfat  uvils0srxoxr oydap elict s) Dtru ooo1opx iociydfsDulumsnt4texnir oytfateai o t0teum(r3nydlm nmicsasfarrmum no1alxoiociyd m ua(mp;t0 etnxf to1faDr n sls0 euoxr3oydal n neslt) 2rr(m nu1tleo ocias mDemu p;t4trermf iadopte uvo;(0s2xmxr oy1open ieia( arumum ou1apeomf3tas a2ulumpn()tltnmrcootfpDeluvo;(0s2xoxopiodop e ici () rumx pnt0tlxoifcias mDrmuvo u)tlxnxf3oodlm  ai i;t)sruoxrpoodlle  ivias)sDrrx  nt4tpxnmi3iatlm eauvon()arxrifctydlpDeln i;s)truoiopiy4om e fei sf rrmu pno1opeomf3tld s umnvp u0 rtrir3totopD  nvo;s sexm(o ou1op nmivils)a2ta(mooo1alx  i3tatla emuvp t0tltnxo iy1omD au o t0 exmxm nu4lp nlfvtas)s2urxrp;o1apxoio3tyd s2rmu pnu4tlxoxf3oadfm   nvs;t0 rtoiopnu1optnliesltfa2rrx  oo0altn fetlslm2emnvpnu)treomo3iytlateaies;s) exoio3io1ome liei ( artmuront0altnmf3tys s rmuvs (4altrxf ia1op rai o t0setm(r3iu1ole  neilsfa2rmx  ;o0aetnifetatla2eaumon()aexnmoctydfm elues t t2trir io1omeemies ()srra(rp;o4oleo ociyt m2rl(vont)tlxrxo3ta1fa rlies (  exmxm iudlpt  fvsls)a2umump;u1tetn ociaslm2raumpnu)artoxr oy1fp rauvols)s2xmiopiy1alt mnvi tfaDua( pot0tptoiiciytls2eln s;u)tltrxrcto1lp   ivi;s t2xm(m iu4am n ivtlsf rrrxm ;u0aet  ieiyslm2rm( p;u0 exoxf3iatfmD anei;t srur(r iudlmtn ivsl(f Dumx  no1teeoifciyt s2eau s (0tltnmf3oodlm  livs s0s2uo(rpno1omenmnvta(fsrurxmpnu0opxn ietlsfs rm(mo;(4aetoircoadfpDrliesl(0sruoxr iu4olt  ivi (farum(r oo4oltomiciadlmDrmn pn(0 exrif3tytopDeli olt)t2umxr3nodll emfesas sruru onu4apx  f3iadfaDul( pnu4texrircta1om ran s;t0 rxrxm iy1aleelfcs t) Dta(m ;u1oex mi3ilt s ea(vonu0alerxo oadfm   nvs s texmirpiy1opte ietat s2rmu oot1alxo ociys a2rl( s t4trtrmf oy1omt aueils  exo(o iudapt lfcsl() 2ra(mpnt1tet ii3iasla2umnvonu0tlxomrcoytop e n s;s)srxm(o nu4ap eliet (f Drm(r no1olt ii3tad m2ran s;t)altoxrciodop eanesl( seumxopoydlpe lnesas sDrax o;t0aptnmieiasfm eanvont) etoxrcoy1om e ivi;(0trxrio3no1om emieias)arum(mont0opxnmicild m uaums;()treoxo3tytop  ln i;s t2uo(o3iy1aptelnesas)s2uaxmo;u1oltn ociysls eau on(0 rxnif3iatomDrai s;t srtrio oydllen nesa(f 2rmur ot1tet ifeiytlsDeluvo;(4 eeoif oodlmDe uvs;(0 rum(o3iydam emfct t)a2rax  oo4tlxomieiydlmDrmumsnt)aeerxfcta1optr uvs;s0teuo(m3nydope mnci t)sDrmuro;u4aeenifeiyt s2elumsnu4 etoio todfmtran ols  euoxopoo1lm e ici s sruaum nu0opxo oeiat a2ul( o u0tleomo tatfp r nvilt0srxm(m oo1olenmncsltf 2raxm nu1apt io3iltlsDemu s t4texoio ia1fptr nei;t)t2uoimpiy1lp e fvtls arra( o;t0apxnio3iyd sDranmsnt) rerio tytlp e uvo;t  2uoxm3nu1olt  fct t)srtrum oo4tleo ieiydfmDemump t0 etnxr3ootlmte nvi (  2tmxrpny1lm n ncs s)s2tmumonu0tlenmoeiysls eanvont)aexnio3tatoaDelnei;s)texrio3iu4lmenlncsl(  Dtmum ou4oeto oetydlm2ua( s (4 exoircto1fp eaueo;() 2uoim no4lmenlnesls  2raump;u0tee mfetatla2eanmon(0 etnxocia1optraieo s  rtr(o3iodlme mfctl(  Drmum ;u0ole  f3ilslm2rm(vpnt0 rtnmocoytlatrlnvils t2urirpiy1oltnlict (  2uax  no4tlxn feiytfs2rln s (4trenxfctatfpDrlnei;s)srtoir iodoltnlivsls)srtr(ro;t1tpt ifciadls2el(vsnt)tetnxo oydlmDrlnes;s0sexoim3nu1lmte iesat sDrr(  ot0alxnifeilsla ra( ont)texnmrctotom  livol(  2toio iy1al e fct (fsrta(  oo1aexoif3iasfm2rluvp (0alerxfcoo1omteau o t0s2xrxo oy4lpee ietl()srtr(monu1apt moeiyd m ua(mpn(4teeoxr tadlp   u sl()truo(m3oudamt  ivtltfs2um( p;t4aptomf3ildla elnvp t0aleomr oydlaDr u s;t)tetrir no1openmfviasfarrm(ront4tpxnii3iys m ra( p;t4tlenif3iytlpte uvs (  2ur(r3oudop nmivsat) Dum(ro;o4oexnmieilt m2ul(vo u0altrxr ta1optelivil()srxoxr3no1llt  feiasfsDuauro;t1oet ioctlsls2umn onu4tetomo3oydfp ranes;s0 rtmir no4ome livsa(  2rru  nu4olen ieildlmDrl( s;u4trxriocoo1oateau ols trxoiopiy4llenmicil()s2um(mpot0oeto f3ilsla2emn o;u)tlxnmo ootlatr nvsls  2xr(r3nudlpenlfctls  Drmxr ;u0tpt mf3iysfa uan s u)tlenmocia1oa  aneslt)setoxm nudap elicilsfsrua( o;u1aeenii3iysfa2umnvs;t) etnmf3oy1opt lieo;s0trtr(o3iu4alenmfvsat) rrmxmpou1tleoio3tld s2uln p t)tltnio tadfatrluvs s0s2to(r iodlm nmnei (fa2ra(mpnt4optnmietydfsDelump u) rtnir iotlateln olt srtr(m iy1lmeemncs s) Dtru p;u0tleoiociat a2rmnvs;(4arermf3ootoa rlivils seuo(m oy1lmt  ics tfarraumpnt1tlx mi3iadla2uau o u0 exnmociadlpteli slt0 2trir oudaleelnesas) Durx p;u0apeo feildla emu o t0trermo totoaDeauvslt teumim3oo1om e nesat)srtm(m oo0tlxomoctldla ra(mpnt)artoxo3to1la eln o t0truo(o iy4oltnmnesls)sDra(r ot1tleomfeiyd m2uau s;u0 rtnmrcio1fm eai ils) rxm(rpnu1altelnvta(  2rm(m oo4tpxnio3ild m eauvo;u4 ltoxocoodlm e i s ( seuoxo oy4am   ivt t aruau p;o4opx mfciasfsDem(vo;u4artrir3iydfa r n i s) rxo(m3oudame  feslt  rtr( oou4tpto oetaslm2uan ont0teermf to1oa rlneo;t srumio3oudlm  mivta(fa2urur ;t0oee  ociydfmDua(vo u) rtnmr todlpt an o t  rxoimpno4altnlivi ()a2rmxm oo4altnmfeils aDran snt)texomf oo1oa e n s;s0 eum(r3iodopt lncilt)s2taum nt1aex io3iadls2el(monu0arxnif ta1lmtraivol()trumxr3io4olen fetlt sDumxrpou1oeto octldla2em( p;(4altoir3iodfp  au s t0srtr(opiu4lpt  ncta( aDraum ;t4oetomoeiatfs2uanvp;()altnifciy1faDrlnvolt0 ruoxr iydopt  nvi s)arumum nu1apxomietadlmDra( s;u4artomo3tytlm elu slt trurim oy1lmtnliei s)srtaxr ou1tptniiciysla ean pnu4altnxfciatlpt luei;t0s2xr(r nydomeemfetas) rra( pnt1ale  icilsfa2rmn o;()tlxrif3oo1om e ivo;(0 euoxrpiodlpeemnet tf ruaurp;u4apx ioeiydfa rmu o t4tlenmo tytlp   ieilt)trum(opoo4lpt  ieiltf rurxroot1oee mieils aDemn p u4 lerxo oadlp eauvo;s)seumxrpny1amen iesas)s2rmxm nt1apxn ociyt m2ulump;(4trxnio oydfpDr n slt0 2to(opno1ame lnctas)a2raxrpnt0tltomi3iatfa2el( p;u0 rtriociy1la elieo (0t2xm(o nu4omtnmivias aDtmumpou1oltniieild m eanvs (0arenmf3ia1oaDeaivo;t0seuoio io1ope livsat)sDta(mp;t4alx mictyt m ra(mpnu0tleoxo3oo1om rluvsls setmio3nu1ll eliesa(fsrtmuro;u1olenmfetadlm el( snt0arerif3ia1om   nei;t0t2xrxm3iy1ll elfvi s)s2tm(rono4oetomoetytfa emnvo;u)areriocta1om eauvs;s)seumxr iu1lpe mnviat srrauroot0apxo feilsla2ua( p u4altomr3oo1lp e i o;t) rumxmpoodol   fct t)arrr(m ;u0tpxo ociltla2em(vs;t) rxrxrciy1latraieol(0 ruo(r3oo1lpt  fcslt) Durxmpou4tltoio3iytlsDea(mo u4arxoifcia1laDeln o s  etoxmpnu4lmtn ieta( srumxrp;t0teeoifetlslm2eanvp;(0trenxo io1omDr ivs s srto(opnu1ole  fcslt)s2raxront4alt  i3ildlmDrm(mp (4 renxo tydla eluvi (0srxm(mpoodlm elicilt)a2rm(rpnt1olx mocildfmDeanvs;() lenxo ia1lmDrluvs t0s2umir3nydap   ncs ( aDtaumonu4alx mo3ildlaDraumo (4tleomr3to1fpDelivo ( teuoxopou4omte fcs s)aDumxrpnt4oexn i3tyd m2ean s;(0aexnir to1fmtr ieolt) rtmimpoydllt  iesa( aDtm(rono4aex  i3iytlm2ra( pn() renio iatlm  an o (0 exoio3io4ol  lnctlt)arra( p;u1teto i3ilt mDulnms t)alxnmfctytfm r nei ()texoim oodlmenmiei s arrm(r ;t1ape  fctys sDem( s u4areoxrciotfp  lneo ( s2xoxm3iydaltn fesls) rrru o;o0aptomoetysfsDeln p;(4alxrio3iotoatrli s;t  2toxm iodllt  nvias s2uaurp;u4oleniietadlaDea( s;u) etnmr3oa1optr ivi;()srtoio io4om nlnvta(  Drm(rp;t0aeen feiltlsDrmnvp;u0 renmo oatfmtelivs ()s2tr(m no1al  mnvilt)arraxmp;t0apt mo3iatla um(msnt4 exoxocoytomtraueo;t0 euoimpoy4lltnmictlt) 2umxr oo4aetnmfeiysfs ra( s ()treomfcoy1oaD ln i s)s2xoxm3oy4opte icsl( sDua(roou4oeeoioetysfa rm( sn(0alxnxfcoatfpDr n o;t0 2umxm no4op n netat)sDta(moot1ape miciatlm ulnms (0 eenxocoytop elivo t  rtr(m3iudlm   nesatfsrtaxmpot1tpx moeiyslsDeau sn() ltnmr3iydomDr i s;t trxmir oo1lmtnlfvt t  2rrx poo0tltomf3iltfs ulu o u0 leriocio1fp  aiei (  exr(m nudll   nei sfaruaxmp;u0alx miciytfaDumnmpnt0aleoirctotlm  aneo t setmxr3nudll nlnctat) 2tax o;t4tlxomietydfs2emu s ()tlenxo oodfa eaneils teuoxopny1lp emfvt t aDtaurp;o4aex io3iyslsDuanvo t)artomociodomtrli i t0seumxmpio4ole mivils)a2tm(m ot1olt iiciadfa2rm(vo t4aeerxf3ia1fmte u slt) euo(o3ou1am  mfvt ( sDta(rp;u0alxo ieiatfs ranmp ()alerir oatoat an s ()teurxm3oy4ape mfesat) rum(r ;t0tpxniiciydfa uan o u) ltnxf3tydfa rliei t trtmio io4apeeliesat  rumxm nu4apt mo3ilsfmDumn p u4alxomo3to1fmtraneslt0trxoio3iodoltnmnvil( s2ua(ro;u1aeen octltla rmnmsnt4teerxfciodfmt aueo;() ruoxr ou4ale lnciasf rumxm nu4texn ociat m2rmuvp;u0tltrio ta1lpt  nvi t0srxo(r3iudlpt mivsa( a2umxmp;o4tlxoio3tatlm el( on(4 exnioctydlaDeluvsls0 2xriopoy4oltnmfvt t) Dtmxrooo4altn icildfmDea(vpn(0altnxo oo1fmDrlivs;s  rtrxopiodam elneta(fsDumum ;o1olto fetad a2ea( s;()areoxf3ta1oatrluvi s  rxrir3iydlpt mnesasfsruau pou0ole mfciysfs2ulumpnt4aeeoir3ia1la   i il(0t2tr(o ny1olt  fviasfs2taxr ot1aptniictadlaDul( onu4artoxfctadoa rlueo;s0trxoxmpoy1ol nlfvslt  ruauro;t4tee mf3ild sDean sn()aetnxfctodlpD lnvo;t0 eurxrpno4lm n iesl()aDraxmpno0tex  fctltfaDel(von() rtniocia1fa raneils)t2trxo iy4alenlfctas aDurx  no0teen fciydlmDuauvs ()trxoiociy1fm   ivolt tetmim no4ll  miciltfaDurum no1tpenii3iatlm2eluvs u0tlxrxrcty1opDeln ilt)srxmxr3nudomenlfesls)aDtmx  ot0teto feiydfmDel(monu) reoircootlatrlieo (0s2uoirpiy1alt lfvsls s2urum ;u4aetoioeiat s ra( ont4 ltomfctytfm  ai ol(0trxr(opoodlptemnesatf ruaxmo;u4tpxnmictytlm rlu s;t0alxrmr oodfpDelivo s)trtrimpnu4lpee net s a2um( pou0aexomfciyd aDua(mo t0tlxrir3to1lpD lnvs;( s2xr(o3nodal e feiat srrru  no1aptniocilslm2um(mp (0artnifcoydom   uvsl()t2to(r iu4amenlictlt)s2umu p;o1aeto iciyt s rmnvp t4 lerir tadlptraneils) 2uriopio4op nlictl( a2raur ;o0tlenio3iadla2el(msnu0aetoxf3oadlp eln il(0trtmio iudome mfviasfs2rm(rpno0teenioetldls2rmnmon() rtrmocoydfpDrlnvils setm(m3iu4lp emnei s  2taxmpno1tltoiieilsfs2rmnvs t4 rxnxfctadfp rluvi s0s2uoirpiodal e iciatf 2rau pou0tltnmictlsfs2rlnvp t0aleoir oodom   n olt)t2toxmpio1al  mict tfsrrrxro;o1teeoiocils sDeauvs;(4 ltoir3oy1fa r nvi t)s2xoimpnu4op  lnes ( s2rrur ;t0optniicilt a2rluvs;u4tlxomf ta1lateai ilt) etmimpnodll  lfes (f rrmu pou0oleoio3ildla emnmp ()arxriocootfp rlivil(  rxrxrpiu1ll   ncs ( a2rrx  nt0olxo f3iyslm ean o t0tetomo ia1lpDeanvils  2xmio3iodol  lncsat  Draur ;o1olen fciasfs2emumpnu) eerxf oo1omtr n ol(  exrir3io4oltelnci t)sDraxr ;o4tltnio3iadlsDrmn ont) ltrxr oy1fmD luvsls0 2to(o3iydlp elfvsl()aDtmu o;o1tex  fciydla ranvp;u4 eeoxo oodoa rlnvi (  rum(mpnu1opeemnvil(  2uau onu4texoiiciytfsDuan s;t0tlxrmf iy1oa ran o;(0trurxm ou1ll   fvtl() Dur(rpoo4altoifeiadfa2ra(mpnu)alxrir3oadfateaneo;s setm(rpio4om e icsl()aDrrump;u4altomictldfsDeau o t0trerxfcootoaDr nvsls) 2xmxo iudope  ncsl(faDur( o;u4oetnio3iydlaDelnvs t0 exnxr tydfpDeluvol(0s2xr(mpio1lmt  ictl(  rrr( o;t0oleomoetadlm2eaums;u4trenircoytlpteanvils)srxoir3iu1apeemneta()aDra( pno1teeoii3iad s elumo u4 eenmr oa1fpD ai il( srtrxo nu1altelnciat aDra(ro;t4apenmi3iad aDul(mont)teeoxo to1lm eauvol(  rumimpiy1amen ivs sf 2rmxrooo0oexo f3ilt aDulu pn(0 leoiocoa1lmtraneo;( texrirpnydam elfes sfsrtaurpnt0olto ieiat m rau o;u4alxrifcoytlp e ivo;t)srtmxr nu1al  mfctlsfsrtrxroou4opeomoetltlm2eln s;u)treoxr3oodlm eln i (  exo(m oydapt  ietatfs2tmum ou0apt  ieiad s2emnvs;t0 ltnmr oodlmtraneo s trxmxopiydapt lfesls  rtrxr no1oleomoeiadls elnvs;u4 ltomocoo1fmtrauvs s0trtrxmpiy1ope  ncs s) Drm(mo;t0alenmfctldfa2uau pn(4texnio oytlmtelnvil(0 rxoxo oudlpen fvias) 2tmx pnt1tpto ociatfm2eanms;(0 etrxf3ootfa elnvils)trtmxr3oy4lpen neta(  2trur ;u4tex iociat aDeanmo t4aleoxf iotlaDr nvi;t0sexr(m io4lpt  fvta( srumx p;u0olxomoeiasla uauvo t4 rxoir3oadoaD  u olt0seuoxopno1al  mies t) 2rmx oot1oexn icilsfmDrmumpnt) ltrxo iatfaDraues;t s2toio iydalee fcilt)s2rrumo;u4tlenio3ilt sDemums t0 exnir iodlatraieils teuoim oy1oltnmfeilt)arrm(ro;o4altnmf3iaslmDemn sn(4trenxo3oodfpt aivs;t trxo(o3iudopt lfciat) rurur ;o1tleoioctydla2emu ont4texnxf oodlat aieo (  rtmxr3no1lm  mfcs () Duau  ot0teeomietadlaDulnmsn()tlenmr iotoaDrauei;s)texmxo3ny4lm n nctl(  Durum nt0aleo oeiydla2emnvonu4 etoif oydomtrlivils) etoxopno4lltelici sfs2trur ;u0altnmoetat m2eln s;u) rxnioctytlpDrluvi t trtoim nu1ll nlnvtls)a2ur(  ot1optnioctysfm2ran s u) eeriociytlp eaneo () rtoir ny1amen fcslt)sDraxmp;u4altnmo3iaslm2rm( pnu4 rtrxfcootomDr uvo t0trtr(m iydape  fcils)srra(root0tle moetaslm ra(vonu4tetnircoa1op  auesl()t2tr(opiudalenmnes ( s2tmx ooo4apxo fetad mDul(mp;u0tltnmf totlmtrau il( srtrir3oudal emieil()s2urxm ;o0apt ioeildfmDra(monu4aeenmr oatlm  livs;t0 2uo(m nu4op elics ()sDrrum no4tpto ieiaslm2rmuvp;t0trtrmo oytfm  aies (0 rtr(r3oo1ll elfeil( s2tm(root0aexoifciltfs2em(vont0trxomr iytopDrauvo;() 2xo(r ou1lpen feils srtm(moou1tptn fciys sDuau o;u4trerxo iotla ranvs;(0 rxrxr oo4lp  mnet s)a2um(  nt4tlt iictlsfaDumu snu4aetrio totomt aiei;t0texrir3ny1oltnmnesat srra(mo;o0teeomiciytfs uauvsnt)trtnif oatom r ieo;t trxo(m3iu4altemfetas) rurxmo;o4ale miciltfm2ea( o (0 etnmrciadlm   nesls)setrimpio4lmtnmnct s aruau ono1tpeo o3iadls2um( pnt) rtrifcoodlpDeaueo;() exmxo ny4amtnmnetls  Dta( o;o4oeeo f3iat mDel(ms u0 rerxo iodopt  nvs;s teurxm3ny1lmeemict () Durur nu4alxnmi3iasfs2rlu p;(4 exoif3ia1lm eau il(0s2tr(m3iy4aleemfciat)a2uax poo0tltnioetldlmDran sn(0tlxnxf tytfpDr uvo ( trtoxr iu1ope lnetat aDtax  ;u0tet mfeildfs2rlu onu)trermf tydlateaivs t)s2umio3iy1llenmnesat)aDtrxr ;o0opxoii3ias m2rlump;u0teeomf3ia1oa e n sls s2xmxmpno4openlfvilt srur( o;t4tetomfetadfm2umnmsnu0altnmr ootlmD  iei;(  2xo(mpiu1ol emfeslt a2umumpou4tet  octyslmDrlu o (0 eeomo oydom  lnvsl()t2to(m iu4apen fei t)srumumooo4tpenmf3ias sDumnvpn(4 rerxf iy1fp rli ilt0teumiopiu4omtnmfct
\ No newline at end of file
@@ -0,0 +1 @@
+nvo s) euoxrpoo4amte icta(faDtmu oou1apx  iciytlm rl( onu) eeniocootop eau sls)texm(mpno4lltelfvi sfsrra(m nu1oetnmiciytfm rm(mpnu) rxnifcty1lp  livo;t0 exrio ou1lmt mfvias a2rm(r ;t4aet mictydla emnvp;u)tetoif iotoa eliesl()tetm(m3oo4apee ietls)s2raum ;t0oexomictas s ranvp (4altoio ia1lm  an s;t)sexmxm3oudlp n fet ( aDum(r ou1opeo ieiysls ran o;t)tleniocia1la eai ols0teurxo3oy1lp elnei ()aDrmumpno4oeto iciltfm2elu ont0 eeoircoatlp   nvolt s2trxo3ou4apte iet sf Dur(rooo0altomiciadlmDuanvo t4texnmo oa1omte nvo;()sexrxm3no4lptelfes t sDumu o;o0aexoio3ilt sDrau onu) lxrmf tadlmtraiesls  etmir3io1omtnmfvs sfsrra(  oo4olt iieildfm ua( sn(4aeeomo3oydop  lieo s) rur(o3iy1alte fvtas a2um(  ou4tptnmiciytla2uluvo;()arxrir totfa  aneils s2uoim3no4lm  lfctl(f rraur no0altomi3ilt sDulu p t) eenif oodla   ivol() eto(opny4aptemnetl()a2tm( oot1aptnifetasfm2raumont0 ltnmr3oytfa eauvi;t  rtr(r3ny4al   nvsat)a2urx pou0apenmf3tys aDumumsnt0 renif3ia1oaD  u s;t)teurir nydlm nmnvsat)artm(r ot0optn octldfm2ran s;t4altoxo3iotfpt  u o s0tetmxmpnodlleelivtls)aDuau o;u1apxnmf3iad s ea( snu0 eeoxr3ootla eau s;(  rxmxm3iodolt  nvslt)arum(rpno0olxnmfetlsls2ulump;t)trermo3tydop e neo (0 ruoim3oy1oltnliesas)a2rmx oot0tpt moetlsfs umn o;(4altrmocta1laDe ieols)t2ur(opno1lmenmnci sfsrtau  nu0teto i3tasfa um(vs;u0aeenioctotfa r ivi;t0 2uo(mpoy1alen netatf Drr(roou0oexo fetysfa2ra(vs;u) rxnirciotfa r n s s)t2xoxr3oo4lle lnesl(fa2urx ooo0aex io3iltfm2umuvo;t4 etnmocty1fmD  nesl()t2urxo no1ll nmfes s s2uru ont1oleomfeiadfsDean o u)tetoxfcoadlp   ueo;t) rur(rpio1lmtn fcsl()arrrum no4apt ioeiltla2elnvon(0texnxr3oadlat luei t trxm(o ny1olt livtatfsDtaxro;o0tet ioctysfm elnmp;(0 exomocoodlp rlues;t0 2toio3ny4am e ncs t sDrru ont1oeeniiciltla2rauvo;u)alxoxf oatfa raivols teuo(r3nodapt livi (f Duauroot0olx mi3tad sDea(ms u0teerif oy1oaDelu i;s)t2toim3iodal n fcia(f 2ta(ronu0tle  f3tyd sDel(vp;()tltrif3iodom rau s (0teurxm3nodomeemivi s aDtm(  ot0oet  fctatfaDelnvp ()tlxoif3ty1omte u s ()tetrxm3ou4op  lncsat s2rmxmpot1teeoifcias m ea(vpnu4arxrmfctadopDelivo;s0 rtoir3oo4omtnlfeia(fsrrrxmpnu4openiictytlmDua(vpnt0 lxoiocoatlpDeai i s)t2trxrpno4lme lfvta()a2trxr ot0tleoifciydlsDumums;t0teenmf to1lmDran s (0srumxo iodalenliesltfs2tr( p;o4oleomi3tyd a2elump u)aleomf3tatoaD ai ol(0tetrxm ny4om e ici (f rtm(moou1olxniieiadla2ulumo;t) rxoxociotfpDe u i;(0t2uoxmpou4aleelfcilsfs2trurpoo0tpenmieiyd m2umn on(4 rtrir iy1lm rluesl()trumim3nu1lm nmnvtas)aDtmxmonu1olt mfcild s2rluvp;u0aeenmf todfaD anei s  2umxo ou4lmtn ies ()srtrxm nt4tleomoetld s2rm( o;(0teerircia1faDeanei ( t2ur(rpoydop nmfetl()srtrum oo0alen i3tlsfmDranms;u4 reomocio1lmD  n i;t) 2xo(m3ou4apeemivtatfartmx pot1oexomfciasfa raums;u4alxnifciotlm   n ol( t2xoim iy1lmenmnetltfa2tmxm ;u4oexo ieiydla ul( o;(4tltrmrcootla r i s ( s2toiopiydlpt mnvsasfs2taum no1tpt  o3iydlsDua(mpnt)altnxr iytfmteaivo;t0trtrim oo1ll  mnci t)arrr(rpou1tlx mf3iysfm rm( onu)arxnmo3todfm elu i;t t2tr(mpnu1amt mneslt)a2uau pnt0oltn o3tas mDrauvont)aeerxo todlp  an ils) 2urimpoudlptn net s) Dta( pno0oltomf3tatfs2el(ms u) lxrir oa1oate i ols0t2xmim3iu4ol emfcs tfaruaur ;t4tlto ociaslm umnmont0 leomr ty1lm   ivi t0t2xmim3iodlpeelfct t)s2umxr ou0alx if3tlsfa rlnvs u4teeoxf3tatfpt lnvo;s)tetr(o3ou4ll e nvia()srrrxroou1ope mo3tad a uanmo;t4aetnxf3ootopDeaies s seuoxrpny4optemivslt aDurx  nu1tee  oeiadfm eanvsn(4artrxo iy1oaD aivs;()teumxo3no1optnmfvilsf 2uaxro;t1opxnmo3tydfsDul( snt)altrmo oa1fpDelu ilt texoxopiy1lle  icsas artm(rp;o0alt iociatfm2rl( o (0altoxf3iotoaD luei;s0 rurio3nodomte ies ( sDtrxroou1tex iieias a2emuvp;u)trxnio3ootfmtr neslt) 2um(r3ny4apeelfvsa( srtrx ont0oltomo3ils m2em(mo;u0 etnxociytlm e neolt)tetr(rpnydll e ieias  2ur( pno0aex iiciasla2ra( o;u4 etoiocta1oaDe nvo s0seumxr3oo1lltelnvta()arrm( poo4oex io3tyt s emums;t0 ltnirciytfp rlieo s) rtr(m oydaltelnet tf 2rm(ront1ape moeildla rmnvo () ltnxo3oydfm  ai il(0 rum(r nydam emicsltfs2tmx ont1tleo oetysfm2rln s;(4arermociy1oa eluvi;t  etoxo iu1omenmfvils sruaumpnu1tpeomi3ias s ea(mo (0 exoio tadopte ivs;()s2urxr3oy4amt mics t)s2trx  ;o4texomi3iltlm2rm( s u)arxrxo oy1fmDeln slt s2xr(o3oodol nlfvsa() 2rm( ooo0tleomfetas a ean p t)trtnxfctytop rauvs;t)srumim oudlp nlfvs s)sDtmumpoo1ape mieiytfs uau o;(0 eerxfcoa1opDe ivsl(0seto(r3oy1ol e nesltfaDua(rpnu4tee mfciasla um(mpnu0arxnmociy1la r ieol(  2to(o3no4lpte fetltfsDrrx pot4tpeo f3iltfs el(mo (0trxrxociy1fpDr n s s)t2xoio3nu4omt lnvs t)sDtau p;o0tet mfetyd m2ra( p (4tltnif oydfpt ai i;s  euo(o ou4ap elfeils sruaurpnt4tptnmfeiat s2rmnvs;(0tltnxf3oytoa e uvo;s0trurxm3nu4lmtn fctltf Drr(monu0tpenmfetldfa2rmums;u4trtnir iy1op  aneo s trxrxm oy4apenlncslt aDuaxronu1oeeomfeiadfmDrlnms;(4teermr3iatlaD  nes;s) exrxrpnudlm n ies t arum(r oo1oexnmfeiadfa rlu sn()alerxf3iatfpD  n s s0 2xrxrpio1aleemiet ( s2ta(rooo0aexnmfeiatlsDum(mp;u4aeeomf3tadfa   neilt0 etoiopou4aptnlivt t) 2tr(  no1opxnioeilslmDraums u) lenmr3oatlpDr u ols0s2xmxm3iu4omtelivtas)aDra(mpoo1tet mfctlslaDra(mo;(0texnxr3ta1fa e ies s setrio3no4ameemfvia(fa2rrx onu0tpe iictyd m2em( o;t4 etnxocoy1fm e uvi ( t2uriopou1lltelneiat  Duaxm ot1oetnmf3tld sDumumon(4 lenxrciodoa  lnei (0t2xoimpio4olenlics t artmurp;u1tpe  ieiydlaDemnvo;()tetoio ootop rlnvo;()srxmxr3nydal e fet tfaDtm( pnu1oeto ociltfs ulnvs;t4tltrxf totlmtrln i;t0srxmxmpny4lleemfvs sfaDurump;t1tlen icild aDumuvs t0arxrxf oytom eln i s)sexr(r ou4ap emici s  ruru pou4tet  fcildfsDea( o;()alxomr3totfpte u ols0t2ur(r3io1lmtnlfci ( sDrru o;o1tlxomf3iltlm2ua( s;u) rxnxf3oodlat  i s;t)teurxopoy1om nlivt tfs2ua(rpno1tpt  iciyslm2em(ms t) exoio3todlat li i (  eumir nudaltelnvt sfsrtm(ro;o1ope  iciydla umuvo;(4 eenxr3ta1op   ueols0 exoir oy4llt livta( aDrauroot4opxo fciys aDeanmpnt4trxrxfcoy1faDran i;s sexmxo3iydapte netas)aDrauro;u1texn i3tldfa2ua(mp;() reomo3oytfaDrli o (0 2xmirpiodlpen ivtl( arum(rpnt0tpenmo3tlsfs2emnvonu4 renmf iotlpD ai s;t t2xoxm iu4lmeemiei ()arumuront4aptnioeilsls2emu o u4 eermo3iydom   n il() rtrir oy4alt lfvt t) rurumoou0tetnii3iltfaDean on(0arxomo totom  li i;s)srxrxr oy4ame mnci s)aDtr(rooo0apenioctldlm el( o;u)trtoxf3to1lm  lueo s0t2xrxrpoodapen nctas) Dtmur nt0apx io3iadfs elnmo u)texoif oadoatraieslt  exm(m3nydlm nlnct t sDumxrono4opeomf3iyslmDel(vp;(0tetoir oa1lp e i il( texrxm oo4lle  fcsl(  rraxrooo4tptomoetasfmDeanmp;t0 exnxf3tytfat  nei;() 2urxr3oydll  lnvsls) rrm(mono4tptoii3iydfaDrl( p;(0artoxoctodomD livsls  rtm(opiudamteliesa(f rraxm ;o0aeeoii3taslm rlu p;t)treoir tytfpD lneo (0s2xrxr oy4ll emfeia()a2ra(moot0tlxn iciys a uau o u4aetoxfcoy1lateaivo;t)t2urir3ou1apt  ncia( a2trurpoo1olxomfciadfa ua(mo (0trenxfcoa1oaD  i s;s)teto(r oydlmt lnvilt  2um(m ot4oet moctys a2el(vp;u0altrirciytlp eaueol() etm(m3nodlltelfes s)sDrr(moot4olt mociad s2eau o u4arxomo3ta1lmteli slt)srtmxr3iu4omeemncs tf 2tm(rono0olxnifeiadfm2el(mp;u0 renmo3tytom e neilt) 2xoxmpoydoptelictlt artaumo;u4olt  oetlsfsDemu s (4 exrxo oatfpteliei;() 2ur(opiodaptnmivs sf rrr(r nt4olen f3iaslm umuvo;t4texnircootomDrlieil(  rumimpnydlmen ieilsfs2tmu  ;t4tltnmiciytls emums;u)tltoxocoytla  aueils0teumxopio4om e iviatfaDurumono0oeeo i3iysfa ua( p;(0texoioctytlmDr nei () 2uo(r io1opeelncs t)s2ra( pnu4tlt  oetat m2raumsnt4tltrio3ia1fpDe i olt)seto(r3nudomenmncsasf 2uax  no1teeo icild m rluvp u4 lxoxrctadfmtr n s;()s2xm(mpnudlp elivtls arua(mpno0aptoii3iltfm2el( o;t4aetrxo3ia1fat livils0 rxmiopoodlp   ici s  2uau o;t1oet mfeiaslaDelump;u)tetrmfciytfpD lneols0 2tr(o nydal elnet tfsrur(ro;u0apenmf3iytla rm(vp t4 eeoio3oo1fptrai o ()teuoxopnu4ap   fcsatf 2uau  ot0opt mieiydfm2um(vsn(4 etrmf iotoa  lu i t) eum(o3nydlm nlfeia(fsDraxrp;u4aexoiiciys m2ra(msnt0tltnxf iydlptranes ()t2trxm3nodam emnesa(farur(rp;t0aetnmf3tadfa rl(ms;u4aeerif oo1fptranesl(0 2urxopoydlltnmfci t  Drmx pot1tleo ieiys sDuaumo;u)arxrxocio1omD  nvo;()t2trirpio1oltemfeslt srtrxm nt0aet mf3iltlm ua( p;t0 exoxo3iadfaDr ieilt0 eurio iy1apteliei (fs2rrxm ;o0tpt mfetatlaDrluvs t4alxnif3tatlm e u s;t) etoxrpoodomeelnvilsf rrau p;o4aet  iciyt a2eluvsn(0aexnio3tadlm rlneo t)t2uo(r ny1apte icsltfs2rmu onu0texo oeiysfs2rln s;()trxnircoatlmD lnvo;s0srxm(r oodlmtelics () Dumumont0apxo oeils a ulnvo;()alerxr3oytopteluvo s0srxr(o io1ap  lncils) 2umxmont4aeen f3iatls2umumonu0arxoifcoo1lmteai il(0srtr(m oodoleemicsatfarrau  no0alenioeilt aDel(vs u0alenmfctotfm eluvi ()t2xrirpiydamtnlicias a2taxrp;t4aexo feilt s2ra(vp t)areoxocoodlaDe uvi;s) 2xoxr3oo4lmtn ivt t  Drm(mont4teeomi3iatfm2uanvo t0aeenxf iydfptrlnvo ()tetoio iydlpenlietlt)aDuaumoou1tlto feiyslm2rmnmon(0arxomo3ta1faD auei s) rto(opio4lmenlieilsfsDururo;t4tee iiciys aDrln p t)altoxrctodoptelieo t)s2uoimpiodomeemicsl()sDrmu o;u4optn iciyd m emnvs;u)arxrxfciytfmD lnvs s  2xoirpno4ol nlfcs ( s2rmxmp;t1texnif3tydlsDea(mo (0 rxoif3oy1omt aieolt0seuoir io1openmfesl( sruaum ou4olxnmoetad a2em(vp;t0teeniocoa1oatrlnvils0 etoxr3nydap emfesls sDta(m oo1opxomf3tas a rm( s t)altnxo3ta1omD  ivo ()s2to(o3io4alteliei t srtm(moou1teen feiltlsDuauvo;t0 rxomfctotlaDr nei s0t2trirpnodoltemneiat)srrau  oo0tle iictatlm2ea(vo (4tlxrxoctodoat lnvs s0texo(o ny1ale  fctat)srtax pnu0apen ieiasfsDrl(ms u)arxrmr3tatfmDrauvi ()sexmxmpio1opeelfeta( srrrxrpou4aptomfeiysls2uan s;u)texnxrciy1op eli i t0trxoxm nu4ope  ietas)a2tr(mono4aeen fciadfa umu s t4 rxoirctydopDrlieo (  exoxo oudale mfvt ()a2taxm no4opx if3iat aDumumon(0trxoirctadlpDe n i ()t2xriopiu4amtnmnvta(faDra(mo;o0oet iictlt m umumon(4aleoio3oodlm eluvs;(0texrxm3nudlmt mnct s sDraxmooo0olt mi3tyt m2uaumo;u4 lxnifcoa1op rauesls0 ruo(r ny1llee fet s)s2tr( pnt1altomoctadfaDrm(msnu4trtomfciydoa r uvo;(  rxrim3oo1al nmncils aDtm( ooo4apt  o3iadlsDrmuvs u) lxrmr ootlptelivi;s0trxmim oydom emieilsfsrrr( oot4altnmociyd aDemuvp u0 lenir3iytomt luvs;s)s2uoio io4lp emnes sfsDumurooo1opeo i3tlslsDrl(vp;t4trtnxo3totlptr i i;s)trxrxo3oudapenmncslsfaDurxront4openmoetaslm eau s ()tlxnir3io1lp elneils0trur(r3nu4ape lfcias)aDraumo;o0ale ii3iatfm raums (0 etoxf todfmt  uesls) exoxopoy4amte fvsa(fsrrrx ooo1opxn oetlsfsDelnvs;t0 etrxfcoydop   ieo (0srxoxm3oydal nmncils  Draxr nu1tee mieiyt mDuauvo;()texrmr to1fmDelieols0s2umxmpio1optelfetl( srrmxm nt1apenii3tyt m rmn o;u0 ltniocoodfpteluvi;s)truo(opoy4lm elfvt sf Dtrumoou4teeniieilsfm ean p;u)arxnxfcootfm raueolt s2urir nudapenlnei s srumu poo0aet mociadfa em(vs;(4altrxfciy1fp r ivo (0 rto(m3iy1omee nci sf 2umuro;o4aptomoeiltfs raump t4altomoctotfpteaivo ( trur(m iy1oleelnes sfsDrmu pnt0opeomf3tysls emump;(4 rerxfcoadfpDeluesls0s2xm(rpno1ope mfcslt)sDrru pnu1oeenmocias s elump ()texnif to1laDelu ils) rumxm no1optelfeia( srtrx onu0texnifcilt mDrmnvs;()texnmr oy1fa  au s () 2xrxo iudlmtnlivsl()sDtr(r ;o1olxn fctltls2elu ont)aetrxrcto1lateln i t0srtm(o3oy1am nmfeia()a2ururooo1oltoiictasla2ra( p;u) rermr to1oaDe i i;(0trxrxr3iydlpe livtatfs2rrx  ;u0aptnii3iyt a2emu p u4arxrmr oadoatrln o (  2xrio3nudop  micsatfartr( ono1aleo ietadla2uanvs u)arxrxo3oa1fmtraivs t  ruoxo iy1oleelivsa( aDraxrpno1open o3ilt a2eau p;(4artrif iatlm rlu i;( s2toir no4altnmnei s) Drmxrpnu0tltnmicilslm eln o;t4artnmfcoodfatean s;t teuoio iu1ap  mivtlsf rta( ono4tex ii3tysls rauvs u0aetnio oadopDraneo ( teum(r3nu4omt  nvsat arua(  nu4oeeniieiat s2emn o;u4aetriocoatfmtran ilt0s2xm(m oo4lmtnlfei sfaDtmxrooo4olxoifciysfmDuauvs;u0 eenxf3io1oatrli o;t s2urimpiudlme lnvsatfsDuaxrp;o4aee ifcils m uan pn(4tleoxo oa1faD li slt  rxrir io1amtemict s)aDurxm ;o1optnifciydfa uaump t4teerxo tatlmt lneo (0 2xo(rpoy1amenlfcs tfa2rmxmonu1tetn i3tas a rl(mp;u)aeerxo oo1la ranvs;t  eumxmpnu1lpt lfcia(f Dtr( pot4tltnmo3iydfsDra(vonu0teermrciotfaD lu s s)s2um(m3ny1optemivtlt) Drm(r nu0tltnifeilsfs rmn s;(4 lxnmf3iadlmDe uei t) exo(r oudal   nesl() Dumu pnu1alxomocildla elnvont4trenmr3oodfmt li i s0 rumim io1optemicia(fa2um( pno4olx  feiysfa umumont0 etoxf tatlmtrau ols0sexoxm3io4optelncia(f 2trx  ;t4oltnii3iyt sDrlnms t) renmf tatoptelnvi;s0texoxo3iy4aptelnvia( aDrmuroou0tpt  ictydls2emu o;u)arxrif iytoa   ivilt t2umir oodame lfetlt)s2urum ot4oee ii3iydfm ra( pnu)tetnifcoatfm   uvo;(  2umim nudamt miet ()s2rr( onu1oet  f3iysfm rauvs;()artrxocia1opDelivsls seur(o3nudam n nei t) 2uax ooo0oetomoctyt s eau pnt)tlxoxr3todfpDrln i ()srto(m oy1optelivt s)aDtax pot4oexomf3iasfm2uln snt4 exomociodoptranvol(0srtoir oydolt mfci s  rrmxmpou4aexn oeiyt m ea(mp;t) exomf tydoa rlivs;t  eum(m3nu4omt  ncilt  2tmx onu4opxnmo3tadls em(vo ()aeenxf3tatlat  n s;t t2xm(m3oo1lpeelnes t) 2umumooo4tpx  ociydfaDua(vpn()teenifcta1oa  livi;()s2tmim3iudlme lfcs s)aDrmx pnu0aeen o3iydfs2eanvpn(0alenmf io1om raivs;s)trxrxm3ny4ame mfvia()a2tmumo;o0alx moeilt mDeanmp;(0trtnmf oa1fmtelu ol()setmxo3nodope mivtlt)aDua( o;t4ale mi3iys s rauvs (0trxoio3tadfaDeaneolt)seuoxmpio4lpte ietlt  ruaxmooo1tlto i3ils s eanmp;t0 lenxrcoytopD  n o;t0t2tr(opoo4am emnvt ()s2rrx  ;u1texn i3iasla2umn p u0tltrmo3tydom eau i;s) 2xoxopnu4amtnmnctat s2tax pnt0alxn octlsfmDrmuvs;t0 etrxf3oatoat li sl(0srtoio no4lmtn fctlsf rta(  nt4texnmoeilt m2umuvon() eenir3oodoa   neo ()srtmxr ny1amtnmfcs (faDrrxmo;o1altomieiyslmDran s;t)aeerxoctytfpD ai s;s t2toxrpnodlleemnvt sf 2ta(mpno0texo ieiadlm2uau p;u0aetrmrctytlatr i s;s s2xrxr3no4amenlfvil()aDururp;t1opeomieildfm2ua(vs (0arxrmo oodlpteli ol(  rtmio iudlpenmnesls aDtrurpou4tleo ocilt aDeanmsnt4 etrxocto1fmD aneo;s)trtrimpio1ap nmnvsas arrr(rpou4tlx  ociyt s2eanvont) exnif ootlaDrauei;( srtm(opoydlmeelnei tf rtm(mpoo0tpto i3iytla2rlnvpn()aleoxo3oy1oaDrlnvi;s0tetmxrpnu1aptemnctasfsrumxr no1tpxomi3iytfa em(vonu)alxoxoctotlpD livol( s2umxmpou1lp n fetl()s2taxmo;o0altnmi3iys s2em(mo u)tlxnmo3totfptraueolt s2umxm oudome livi sfsrtmu ont0aptnmfeiltlm2uln o;u4artrmfcoatfm raneilt srumim oydalt mfesltfs2tmumo;o0aeen oetltla2ua( p;(4 lxrirciatoa  aiei t s2xo(m3oo4ome lfeias s2tmx o;t1tex  f3iytfsDem(vsnt0areoxf3oo1oa  livi s setrim nodlm nlnvsl() Dtrurpoo4ale mieiasls2elumo (4arerxo tadopt  ies s trtoir3ou1altemictlt  Dtmx p;t0ole ioetyd a2ra( sn(0tltrif to1omtrluei ( t2urxopny1aptnmnci ( a2trumonu0tetnmf3iltfsDemump t)tleomrciytoaDeanes;s0t2tm(mpno1ol elnet t)sDraxr nt4aptoiocildfaDea(mpn(0tetoifcoy1opDelivs ( sexmxr ny1oltelieilt)arumxrp;o0ale  oeiydfaDelumon(4 lxrxo oy1la  aiei s  exrim oo4ap elfcs t)aDrmx poo1apto iciys a2elnmo;u0trerir3oydopDr i ils) rto(m iudlmtn netatfs2ua(m ou1ope mf3iys a ea(vs;t)trxnmr3io1oa rlueolt)trxrxr oodole mics t) rrmxmooo4olenmfetyt m2eanvp;t) rermociytlptrai sl()texm(o nodal e ics t sDrru o;o1tpeoio3tad a emnmont) eerxocootfaD ln o s0 rxoirpiudope mneil( arum(monu1tleniictasls2ea( sn()altnmo3oa1lmteaueo s texoirpoudale lfesl(farrrxrpoo1oleomi3iyt s2umu p;t0aeenxr oodfpt lnvo;()setoxo3nydape mfeil(fsrtm( oot1tptoii3ilt mDeanvont)tltoio oy1fa e nvi t0 2trxrpnudaptnlivsltfartrurpno0apxoifetyslmDemnmp;(0altomrctotla r nes;(  2tmir oydaptemiviltfaDua(m ou1olt mo3iatfs uanmon(4teeomo3iydfmt lues;s  rtrxmpiy4ap   iciat)s2um(r nt1alx mi3iys s emn s ()areomrctatoa e nei;t0setrio3no1llee fcta()sDtau ono1opt mfcilsfm2emnvs;u4artrir totomtraivi (0 etm(rpoo4ap  lici (faDrru  ;t1oeen iciasfm2rm( o u4 rtrmfctotoptr ivi;(0t2urxmpiudlp nlivsat aDtrx pnt4oetnmociatlm rln on(4 renmo iy1oa eauvi;()t2uoirpoudll   fvi s)a2urx p;o1aetn icilslm2ul( snt4alenmf oydfmDranvo (0texmir iy4apenlicilt)s2tmxmpoo1oleo i3tadls2rluvon(0texoio3oatom ranesls0 exm(r3iu4ol e nci t)srurur no1ope ii3iytfm ran o t0 lxoio oytopteanvslt) 2umirpoo4ape  nvt t) rur(r nu1aleoioetyt m eaumpnt)aexrxo3oatoa r neo s) ruo(mpiu4ole  ici ( sruru pot4aleomfcild aDelnmp;(4trtomoctodfmtrai ils trur(m io1lpenmnvtl()srrmxrpnt0oex iiciatfs2em(vs (0tlermr3ta1om eli s ( tetrxopiydlmen ictls)s2rmxr no4opxomf3tlsfm2umnmsnu0tetrxociytoa e ivs t0srtr(o iodalenlfei t)a2trumo;u1tlx if3iydfs2rmnmsnu) ltnmr oy1fa eaues (0t2xm(mpiu1al e iet t) 2rmxmo;o0olxnmoeiyd a elnvpnt0treoif3ta1opDe uvi;t0s2toxopiodal  licsas sruax  nu1alenifeiasfs eanvp u)aleoifctytfm eanvs;s)trtoxopnudaltemnctat srumxm ;o4texn i3tys s2ul(msn(4aeenircoydlate u o ( srxrio nu1lme lncs tfa2rmurp;t4ape mieildlm rm(mo;t0 rtrir tydom rlnvi (0 etoimpnodlmeelfvia(fs2trx poo1opxoioeiasla2emn on(4tlxrioctotfa rlneo t trum(m ny1ape mnetl( sDtax  no0oltomi3ias mDrmnms;t0arxomo3iy1laDelnvi;t) 2xmio3oydlptnlfvt s) 2trur ot1tpxoiieiatfm2elu p;() eenmf iytla eaivs s0trurxm3iy1lptemnvtl( arrrx oot4alt iociyt s2eaumsn()aexrir3iodoa  aneil() etrxr3oy1lp nmicsl(fartrxm nt4opeomf3ild mDrauvs;(4 eerif3oytoaD  u i;t0 2xoio3ou1llen feia( s2urumo;o1aleomieilt sDemnmo ()aeeoio3iytoaDr n slt)teurxrpiu1lpen nvtat) Drrurpoo1tpeo f3ildfs eanvp;()altomr3oodlp rlu i s s2tmxr no1oltemfei s s2ta(ront4tpeomoctls sDua(vs;u4trxoxf totoatelu s;s0 2xrxr oo1al elnvsl(  rraurpno0aexnmi3iatlm ulums (4 etrmocoy1lm rlieil()s2umxr3nu1amee fvias) rtau ont4apxomf3tls s ulnvs u4tleoirciadlptr ieilt)t2umio3oy1amte ictat)aDtr(m oo4aee mfciat m2uan s;u) etomo iatlm eli o (0 rtmim3ou1amtnmnvsltf 2umu ono4optnmieiys aDelnmonu)aetoir3tytlpt  uvs ( srxrxr iudllenmiei ()s2rmxroot1ole  feiatlm2ea(ms (0altrif3oydfaDe ivs;()s2to(rpiudoptelfvta() rurur no1altomf3tad s2el( ont4teenxocoy1fm eln i s tetmxo ou1ome livs s  Durx onu4tltoifeiysfs ulnms;t4 renif oy1optrlnei t0s2tmio3oo4lmenlnctls) 2ta(r ;o1oetn feildfsDrmnvs;u)aleoxf oodlpt li s;(0setm(o3ou1lpeelnvt t  Dtax pot1oltomoetad mDrlnmp;t4aleomo3iatfatr ivsls  rxm(r io1oltemivtlt)aDtrxrono4tptomo3ils s2umuvonu0tlenio3tadoatr i sls  exr(m iu1aptn fcsl()sDtaxm ;u1apx  oeiatfsDea( ont4teeomr oa1lm r neo (0s2triopny1amenmiet ( arumx poo4texn oeiydfm umnmo u)tetnir iytfat  u o;s0 eumirpnu1ll nlfet t srtax  ;t1texn iciydfmDrm( p;(4trtrmr3to1fmt aueolt0teuriopiu1om nmfvs ( sDtaxm ;u1tlxo ieildls2ran p;() lxrmfctatlmt aues;s0 2uo(m3ny1ap elicsa(fartruro;u1optomfeiyd a2eanvs t4tleriocio1la e uvolt trurir oudop  mieia( srta( ooo4texnmoeiyd a2rmn pn()alxomf totfateai o ( s2xr(m3nudlle mivi t aDtrxm ou4tpx  ieiytlm2uauvpnu)aexrir3totlpDrln ols)seurimpoo1oltn ict tf Dtmumont4opxoio3iltlmDrmnvs u)tlxoxo3ta1oa  li i ( srumxopiodlmt mnvtl( sDtmxroou4oex iictydfmDum(monu) eeoxo3iy1fm   uvslt0 2trxmpoodoltnlnvs sf rrm( ooo0openiocildfm2ulnmpnt)altnxocoo1fmt lnvo;() 2xo(r3oy1lpeemnvsatf 2ta( poo1tlto i3iltfmDea( s;t) eerif3tydfmtr ivi s) ruo(mpiy1amenlnvilt aDurumoot4altnmo3tadlsDrl(mont)arermocoodoptraivi;t  rtrio3iydoltnmfviatfaDua( o;t1olxoio3ildla ulnvs u4tltnxf3iadlp   nvo s0t2to(o nu4lmenmncsa() rumx  ot0tltnmoeildfsDum( p;(0alxoif iy1lm   i ils) ruoimpnu1lmeelict s a2trxmpou1apxnmf3iaslaDraumsn(0 reoif oy1fat aivo s t2xrxm3no4olee nvils srrrxr oo0oexn fctlt aDumnvs t) lxoxrciy1fatrau sls0 etm(m3no1omtnlnvtls srtau pou4teeo ictat sDul(mpnu0tlxnmrcoydoa raivo;t seto(mpoodam   netl( s2urx pou4aexoifciat a2eaump u0alenif3ty1fp r u o t tetoim nydlltn ieil()srtmx ono1openmfctysfa ulu p t0tltoio tydfaDrlieo s  eumxr io4ll e nct sf 2ra(mp;o0oeeo iciltfs2emnvsn()aeermr ia1optr i i s  exo(mpoy1ome  fvils  rraxmoot4opt iicilsfm rl( snu4trxrif oatfpDe n ils)t2triopnydlmtn ivilsfarta(r no4tpen ictas s2ua(vsn(4aeermo3iatfmD  n i t0 2xoxo3io1al n nct t)a2ra(m ot0tee mf3iyd mDumuvo ()trxoxo3oytoaDrln i (0texoxo3oy1lle  iesl()arua(mo;o4alxo feiasla ea( onu4arenxo3ia1lpD lu ils0teto(o nodape lneil( a2ta(mpno4alenmieiydls el( s;t0arxrmrciatfp ean o () etoiopnu1amt mfesat s2rmxrpoo4aee  o3ils mDelnmo (0 rtomr ia1opteauvilt trumxrpnu4open fvtls)a2um(  nt0aeto o3tadfaDrl( snt)arxoxo3tatlm  auvi;t0tetriopoudomee fcs t) Dumum ;t1apen feiat mDra(vont)tltrmo3ty1lpDraueo;t0 2trxm3iy4am elivi t  Drmu  ot1ope iiciadfa2ul(vs;t0aetnircoadom rluvs;s)trxm(opio4ole mfvi () Durxm nu4oltoio3iydfmDul(vp;u)tlenmfctatfa e nvi;t0truo(mpno1optnlicilt)aDrru pnu1altoioetysfm ea(vp;u4tltomr oodfateanes t s2xm(mpio4lpt  fcsltfaDumumpot1olen ocildfs2rmn s;u4aexrio3oa1oaDr u s;t0s2tmir3io1ap emfciatf rur(m ;u0tlenifcildfmDemumo u4aexrxo oydopD lnei s)trtoxo3iudamt  fesltf Drmurono0olx ifciatfa2uau p t)tleoio3ia1lmte nvs;t)srxmxopny4apeemfciat) Drmumpno1aex mfcildfaDeau on(4aetoirciytlpDelnvo;t  rtrirpnodlmt mfct s)s2ur(r ;u4ope  i3iytfm rmn p u4altnifciodlm rai o;t)s2xm(m3oudlmte nvtas aDtrxmo;t4tpen ietatlmDean pn(4aeeoxf tadomt au s s seum(m nydameelnctas) rraxrpnt4texniieiasfa2ulumo;u4teeoifciytfmte ies s0srxoim oo1lpeemfvi s  rur( ont1aexo feiltlsDul(vo t4trxoxo ootfpt ln s s)s2xoir nydame  icsa(fsDumxr ;o4tlxnmf3iytla2ea(mo t0treomoctadomt luvi;s truoxrpny1lm  lfvt s  rraxrono1aex mo3iytfa2rl( o;u0teerif ia1oa  au i;s) 2um(mpny4lmtelnvtlsfaDrrx  ;u1aee mfeiat s ranmpnt) etnxo3iodfaDrlu o;( t2tmirpoodlmenliei (fartm( ont4tee  oeiytls2ra(vont0texnmo tadfpt anes t) etoim3oodap emnciasf 2urxrp;o4olxoii3iltlm2elump;() lxomo3io1lpDe nvils srtr(rpoo1lpe lncil(farum(monu0tlx moctadla emnmo (0areoxfcia1oa elivo () 2xmirpiudalen ies ( artaxmpou0tpxoiieiatfs uaump;u0tleriocoodop  anei ( t2tmimpoy1amtemfci (fs2taxm ;u4oet  ociysfs2umu on(4tetrio3totlp rlivo;()srtrxm3io4al elnviat a2ra(rooo4apxnifeiasfmDrm(vpnt0trxoxf3tadfmtr iei (  exoimpiydope liciltf Drmu  nt4ole mieiydlaDrau onu0 rxrxr oy1oat auvilt0s2toxo3no1ape mnvia(f 2umxmpnu0opt moetydfaDrl( s;t0teenxr3oo1la eaivolt  rtoir nydlpe  iciat)a2ua( oou0opt  ietldfsDeln p ()altrmoctytfmDelieil()s2tr(m3oy1lpeeliciatfa2rrxrpno1olt ifciytla2uaums t0artrmf iodlat aneo;s)t2toxr3iy4amtelfes (f 2taxr nu1ape  feiatfa ra(mo u0aeenmf io1lm r ivi;s texoim nydlmt  iei tf rrmu  ou4aeto fctadfsDemumpn() rtnmocoydlm ean s;t  rurxm nudlptnmneta(farurump;u1oetnii3iys sDem(vonu0aetrxociatoa rlnvo;t0texo(m3no1omtn ict sf rrru  oo0alxomocildls2emumpnu0altnifctadomDrauvils)seuo(m ou4lle lies t  Dtrxrpoo4olt mieiyt m um(mp;u)treriocoa1fatraies;() 2urxopoo4am nmiviasf rraurp;o4olx if3ias a2el(vp (0aexnmr3iodopte u s s0s2urxm3oo1ll nlnes ( s2ua(rono0aee ioeilt s2rm( s;u) etrxoctadoaDeaiei;t) 2to(m3oydopenlfvtas)arrrx  ot4apeo ietldfmDumn s;(0tleoio tytlmDrlueslt) exoio3nodap  lfctas aDra(rp;u4opx mo3iytfa em(vs;t4 leomf oy1fa r uei t0srxmxo io1lm elnctat a2uaxrpnt1oexniocilt aDrauvp u4 eermr3todoatr i il(0seumirpoy4ameemncslt)srum(mpnu1texomietltfm rmnmo t4altomo iodfpDrlnes t  2urimpou1ape mnct tf rtaump;t4tpeniieiadfm ea(ms u)trxoiocto1fate i i;t0sexoxo ou4amenlicil(faDuaumpoo0opxomi3iatlsDulnmp;(4trtrxociotfaD an s;s  eto(mpnydlpeemfvtas)a2uaxrooo1opx ii3iatfsDemnmp;u0trxnxo3oatlp e nvilt0t2uoxo3nydap n feiasf rrm(rp;u1aleoiieiydlaDeaumonu0tlerxo ta1lmt aies;(  etm(m3nodamtnmnvs t  Dum(ro;o4alt iiciad a2ul(vpn()aexnio oodlm ranvilt setmiopnu1ap n fcslsf Duaurp;o1tlxniietlslmDrmn s;(4tetoir iy1fmDe i s;t0s2toirpoo1om elictatfs2um(ront1opxomf3iadfm eaumont0aetnmr oatfptelnvs t)trurxr3nu4apt lnes tf Dtru  oo0tee  i3tytfm emnms t) rxrirciodlpDranei;(  rxm(rpoudalte nvslsfarumu  no4opxomf3iltfaDel(mo u) lxoir3iadlpt auvo;t0srxrxo no1lptnlfvt s)a2ua(  ;u1tlx moeiysls2rmu snu0 rxnxocoy1fa rliesl( srtoxm iy1lltemfeiatfa2rrxrp;u4aleomoctltfm2rm( pn(4aexomfctydopte i o (  eur(m ou1opt  nes t s2tr(  nt4tpxomfctaslmDel(ms (4tetoxr to1omt li slt)srtoirpou4ape  ivtls sDtmxmont4aeeoio3iyd s rm(mo t) exoir3tadoaD lneils0srto(opiy4lmeelnei t) 2urx o;t4olxnif3iasfaDra(vs;(0alxnmr3ootfpte i o s0seurxrpny4ol emfet sfartrx ono1tex moeiyd m ean sn(0aeenio3iatfpDr nvi t0 2xr(mpoo4ale mnetlt) Dum(  ;t1tptnifeilt m2el(mp (4 exomr tadfaDe n o t t2uoio3ou1ome mfeiatfarurx o;t1oet mi3ilsfaDrlumo;()aexrxf oo1fmt au s;( t2ur(rpny1omeelivtatfaDua(mpno1tleo ictytls2rmnvon(4arerio ta1fmt an o;(0s2uoxm oo4alenlnviltf Dumxmoot4ape  fctysfaDuanvp;u0aetoif iadlp   n i t)srtoimpoo4opee ivt s)sDum(rpno4opt io3iaslmDran on()trxomr oa1lm eluvs;()s2xo(o3oydap e nciat)aDua(rp;u4oeenmi3iyt m ea( on(0trtnmr todlmte ueol( t2xmiopnu1lp emnesls artmxm ou4aet iocildfsDuaumo u4trxnxr3oatlm rlivs;s) exrxopio1apeemicil()aDrau oot0tpxnmi3tltfs ea(ms;(0alenxo iytla  lnvo;s) 2urimpio1al n fvtlt)srra(mpot0optnifctldla2rau s () exrxrciy1op r nvo (0truo(rpiu1lp emivt s  rtaum ou1tlxnmfctyd m ra( snt)tetnif oo1oa rlieo;(0seum(m3iydop nlietasfarrr( ooo4oleoifetlsfm ua( p t4tetrif3oo1oaD lueo;t t2xmxo io1lptelnvtlt s2tr(r no0texoiieils m rau snt4trtoxf oatlat aivs;s0 etm(opoudome  neilsfartru  ;t0opt  oetydlaDuau o;t4tltrir3oodfmtr ueo t t2xo(mpno1lme  feias  Drr( p;u1apx moeiys s2ul(vs u4 renmr ia1la rli i t) 2urio oy1lmt livils  2ur(rpou1alt mfetas aDrm(vo (0trermf3iy1fatr nes;(0srtrio iodlpee fei () 2taum ;t0aeeomoeilsfa rmnms t0trerxo iytlmt lnvi;s teuoxo3iu4ope lnvtls)sDrm(mp;t0tptniieiad aDrau s u)tlxnmf3ootlmDran o;t0texoirpnu4ap elfciatfs2rruro;o4oetn oetys s um( pnt4 renxf tydlm  li ol(  rxmir nu4omt  nvtls  2umx ono1tpt mf3tydlm rmu s t)alerxoctydfa elnvo s) eumxo oo1om elnvta()srtmur oo1teeoio3tadfaDul(vsnu0teermociodlaDraivo s setmir nu1lp emnetls)a2rmxr ;o0tpt iietlt m eanmpn(4aetoxfciydlate neilt tetm(rpoydop  liesl()sruauront4aptnmoctaslm eanvp;t4tlermr ta1fp e i ilt)srumiopnydlm emiei (fsruau p;t4oltnif3ilsfa2elnmpnu4arxoif3iatfat li ilt0s2umxmpoudolenlnvs t)srrrxront4aee  f3iltlm rluvp t4 leoio3tadoa r n o;(  eur(r iydap   ivsls) rtru  ;t4oeto ieiys aDemu o;(4aetomrcto1oaDrauvsls)tetoim iudop  lnctat s2tm(  ;o1tpx  ictls sDeln s t0areoxr3iotfp  auvi s0sexrxm no1amt lfvtasfsrra(  ;o4tlxomocild s ua( pnt)areomf3iodoaDr uei;t) 2xmir3nodlmtnmfetltf 2tr( onu0aeenmoeiys aDrmn p t0aetrmr ty1la e u s () rxrirpnodape  fvtlt) rtr(m ot1aexnmf3iatls rm( p t0 eeomr ootoa   n o t t2uoxopio4ll emieil()artrxm oo4tpeoiieilt m rlnmo u4tlerxrctadoaD  u ils0s2uriopnudlp e nvt s)aDtau  ;u1aee ii3ias aDeluvont0tlxrifcta1op  anvi s  2um(opiy4omtelictas sDurur oo1aptnioctld mDrau s;u4altomr todlaDraneil() rtr(r iu4open ivta(fa2um(mp;t0tltomfeiltfmDum(vont4 etoif3tadoa raueo;s0s2tmxopno1amtn ncsa(fs2rmur nu1tlen i3tysls2eanmsn(0tlenmo3tatlmDr uvslt0srxrirpnodapee nctasf rurxmpou0tpx  oeildfa2rauvo u4 eermr3oytlmDelieo s0t2xoxm oudape  fetasfarrr(m ;o0ope mi3ils aDelumo t0 lerxfctatfmDrlivs;s trtrxopno4op nlnvi t  rrmxr ;o4tltoio3iyd m ea(mpnt) lenxrctotlm  lnei;t)s2xrxr no4llt mnvsl(farururoot0tpeomf3iltlm2ua( p;t) etrmr iydomD an o;s0t2um(mpny1ole lfcs (fsDraxmoot1tpxn o3ilsfa2uluvp (0 rxnxo iadfpDe n o;(0 rtrxm3oudop  mict t)sruaxmooo4oeenmf3iad a rlumo () eeoxr3oa1laDeaivo;t srxrim3oudlm e fetls arrruro;o0opt mf3iltla2rlnvp u) renmo to1fpDrau i t) exm(opiu4apt lfcslt  2umxrp;o1tpeo f3tls s2rln pnu4 rtrxr3oadfatr nvo;s  2toxr ny4omt lfvia(  rrm(mpnu0oleo i3tad s uau sn(0trxnif iadlp eauvo t0seum(m3nudlpeemivt tf 2uax pnt4aex mf3iad s rm(vp;u) rtnxr3oydfptr iesls) 2toxrpny4ameemivi t)aDum(r nt0aee  ociytlsDra( o t)teenmfcoa1fmDeaieil(0 2xmiopoo4ap n icsasfs2urumpno1apt  ociyslmDrmuvsnu0aleomfcoydfpt anes;s t2ur(r3nodom e fctas  rtaxm no4aet micild s2elnvp u0 exnir3iadlp ran slt)trtrxo3iu1lpee fctltf rururpou1tlt mo3ild mDuln on(0 rtrir3tatla e n il( seur(m3ou4ame mieiat a2urxr ;u0tlxo f3tltfa um(msnt)teerircoy1opD lues t0t2ur(r3oodom emnvs tf 2rmurp;u0opxoii3iys sDemnvs t0 exomocty1lmt  u ol(0srxoxr3io1llt  ivt tfa2tax  ;u0tlxn ieiadlaDeln s;u)artomr3to1fm  lnes;t t2tr(opnodoltn ict s  2rm(m nt1aexnif3tls sDeaumo;(0 renif to1fm rlieo s0teuo(mpno1lpte fvta(f rtaxmpoo4oex  ieiys aDulnvpnu4tltnifciydlp eaies t)setoim iy1lpt  nei ( srtax  oo1aeeo f3ils aDeluvpn()tltnmr iodop elneo;s  rxoxm3iu4ap nlicta( s2ra(rpoo1tlxn oeiys mDumnmpnt0trtrxo3ty1lm eaivi;() 2tmxmpnu4altnmncsat) Durxm no0apxo ociydlm elnms t) eenmf iadoa rluvi;(0 ruoimpnu4lm emfvtas)sDtaumpou0aeto octls a emnvp;(0 eeomr oatlpt  u ils)trtrxm oydomeelivtas)aDum(m no0oeto oeiat m2umnmo u)texnxo ootla e iei;( t2uoxo3ny4lptnmncslt s2uru ooo4olenioetysla2ulnvs (4altnio3io1lm e n s;( sruoim3oy4opt micsatfa2rr(moot1tleoifctydla em(mo u)arxoxrctodfatrlues s) eurio3iy1apenlfeiatfsDtmuro;u1tptn oetaslm2rmumo t4 lenir3iytoa eluvi;s srto(m3nydlm n ivs t)srumurpnt1tlx  o3iytla ua( s;(0 etoir3oytlmt  ues;s s2to(r iy1lp nlfeil()aDtru  nt1aex mictatlm umuvs;()aeermrctytlmtelu ils0 2uo(opoy1ll nlfctlt  Duaurono4opeomf3iltlm2ul(vp t)artrmr3oo1fatrauesls0t2xoxm io4lpe  ncs sfaDrmur oo4openiociaslaDra(msnt0 rermfcoatlmDr i s;t0 ruo(m ou1op e ietas  2tmxmoou1alt io3iaslmDelnvpn(4tlerif io1lmtelnvs;t t2xoxr3iy1altn nct s) Drrum ot0tlxn f3tad m emn s;()arxoxr iy1lp   ivs;s sexmxmpou1amee ieia() ruauroot0oex  ocild aDrl(vo;() etoir3ta1fp raivs;s0 rxrxo no4llenlnvi sfsrtmxrp;o4tlenmocilslsDemnmo;t4aexoif iytla  anvo;s t2tr(mpnu1am emfciat  rurxmp;o0aetniieiysfa rluvp;u4alxrmfciatopDrlnei;t s2ur(m3iy4oltnmnciasfsruaxmpoo1oet moctydfs rlumo (0artnxr3tadfmt  nes s)trto(r iydomtnlnctls  Draurp;u1tpxnif3iadfa2uaumo ()teeoxo tytlm   ivs t  rxoim io4olt mnetatf rua(m nu0apxo ociyd m ua( pnu0artoir3oo1op   ivolt) 2to(m3iy4optemnvil(faDtaxmono1opeo ieiytfa rmnms u) renmrcoydfptrluvo;s)s2xrxm nodol elfctat a2tmxr oo4tlto fctat m2ulums t4 exnir to1lmtraivo (  eurim oo4lmt mivsas  rra( oot0tpeo ieiydlsDrmumo ()texnmr io1lp raies;() rtm(o iudlptemnvtls sDuaxronu0oetnii3tld mDelumon()aexnmocoadlmDranes;( teurimpnydlmte ncsltf 2ua(rp;o0oexn i3iat m2rmump;u)tleomo iatlm elnei;t0 2xoiopoodam nlfesa()aDur(rpnu1oleomf3tldfsDuauvo u4trxnio3oadlm   nvo;s0setmxmpoy4am n fcia()sDur(m ;o4aexniietadlmDem(vo;u0trxoxr3iy1oaDe nvil(0 2xo(o3no1lpt lfvil(  rrrxr no4optomi3ilt a2rmuvo u) eeomr oodlmt luvo;s0t2tmxmpno1ope lnetls) 2umx pnu4tpt ioeiyslm eln s ()alxrxf3oa1oatrlu sls) rumxm iu4am   nvs t sDuau pou4oetomi3iadfmDua(vs;()tlermr ta1opt aieo t seumxmpoudom emfei t)a2umxroou1opt ii3ildls2eaumsn(4 exrir3iotfp eluvil(  rxrxmpnudamee nvs ( srurxm oo4ale mf3tldfsDem(mp t0trerif iodfpD  neil(  exo(r iu1ap e iesl(fa2ur( ont1oex  feiys mDumnvo;(0artnif iadoatrlnvo s0srxr(rpoo1ame  feta(faDrru pno0oltoii3ias sDrln s t4altoxfcoa1omtrauvs () 2uoxo nu4lle liciatfs2rmxr no4opx if3ilslaDem(mp;t4teenxf oo1opte iei s0setmxr ou1ll e ici s a2rau pou4tpt  oeiydls emump t0tltomf oydop  luvs t seum(o iu4lpenlfvi s a2rru ont1tleomoetysla2rln o u4 eerxo3iytfm elu sl() 2umxm iu4lp emfvtlsfa2ta( p;o0aexoifetldla2emn pnt0alenxr io1oat  ieilt  euoiopno4ap e fcias) rta(  ot4alt if3iydlsDeln pn(4aexrxfciodfatranes;t) rxoxmpny4lmtemnvias sDtmumoou4oltoiiciltlsDum( p ()texrio ty1omteai sl()t2toim3nodlleemnct sf 2ua(rp;u0tlenif3tltls2rmuvo u)aeeoxrcoydlmD ai sl( s2to(o3iy1lpeelfctlt)aDrru p;u1tpxnio3tatfmDrau snu4arxrifciadop rluei s0sexr(o3oydam emfvs s)a2um(mpno4tpe  iciltfaDumnmonu)aexoioctydoat  i sls  exoir3iydoltn fvtls)srurxr ;o4optn oetadfaDra(mo;t0alxoioctadfate u slt) etriopiudaltn nvi tfs2ta(moot0tlx  i3ilsls uau snt4trtoxo totoaDeaneils  2urxm iy1op   fctlt arrmxrono4ale ifciytfsDulu pn(4tlenxfciatlptrlneils) etoirpiudalt miesls  Dtm(rono1tpt iieiadfm2rlnms;u4arermf3tatfptr ivil(0 rtoir3nudalte nesl()sDrax pno0tlxo ietltls2ea( p;u4 renxocty1omtrli s;s) 2tmxmpnydalee icia(  2taurp;t4apxoioeilt a eluvpnu0 rtomo tytlm ean sl(0 rtrxr oodll nmivslsfs2tmxr ou0alx mo3iys s ulu pn(4alenmf3oo1latr nvil( truoxmpoydomtn ncsasf rrrumo;t4tetnmfetydla ra(ms;t) rtrif3iydla elivil(0 exr(r oudlltn nvtas s2urum oo4opeoioctlsla2ulnmsnu4 etnmo3oo1fp rlnvi s) 2xoxo nu1op   nctat)artm(m ;u4opxo f3taslaDua(vo;t)tleoxo io1fa  lnvs;() exm(r oy4lmtnlnvia( a2uaxmp;o0olxnmfciyt a ea(mpnt)areoxr3tadfm elies;s sexmirpiudomenmictls)arrmx p;t0tpeniiciasla2rmn s;t0artomfcto1lm elnvo s)teuoio io4ome mnesl() Drm(r nu1texnifcils sDrmnvonu)arxrmo totlatrai i s t2uoir3oodlmt lfvi sfsDraxrpot4alxnif3iltla ea( s;(4texrmf3iy1laDeluei (0 rurio3oy1lmt licils)artru  ou4tpe mfctysfs emumo u4 eeoir iotlaDr i i t) 2urimpiydame mfesa()aDur(m nt4alen f3tyt mDeanmp (0alxnxrctytfmt  uei;t trtoio3oo1lptelivtlt) rtau pnu1tleniiciadfmDuanvonu0aetoircia1fpt an ol() exrxo oo1llt mncs s  Duru pno0texoiicildfs2rlu o;()alxrmr ia1opDelnvo t)t2tmir oy4lm e nctl( aDtmu o;t4tltoii3ildlm eaums;() exrmr3iy1lp  lueols seurio3oodoltelfvslt  2rm( ono4tptnmicilsfm2ulumo t0alxrxrcoy1latean i ()t2toxo oo1lm n fetltf Dta(ront1aex  octyd sDuanvon(4 lxrircoatfatrlieilt0setoxr3ou4alt  ies (farrax oot0opxniociys sDua(vo u)arerxocoa1fm rlu s;t)tetoxo io4omtnlnvil(  2ra(rpno4tpe  octlsla2rm( p;t) exoxf3iytop eliei (0t2xrxo3ou4omtnmfcil( aDtax p;o4apeoii3ilslsDua(monu0trxrmoctotoat  i ols0sexmxr3oo1lme mneilt artrurpot0tlto fctytls ranvs;t0aeenmr3oytoa rlu i ( s2toxopio1aptn fvtas sDrm(rpou4tex mf3ildla2ulu o (0tlxnmo tadfm elnvsl(0texmio iu1omt lnvsatfarrmu pno4aptn feiys s2ran pn(0 ltrxr3oytlaDrlu ol( srto(opiy4opeemnci s aDrr(m oo4teen ieias a2uaumonu)arerir totfm elu i;t0 2xoxmpio1ll  lfetas)artrx pot4optniieiat a rl( on(4aexnirciodfpDrluvo;t s2xoxopnu1apen ivils)sDrrxroou1apenif3ildfs rl( p;u0aeenmr3iotomDr uvols tetm(o3no4op   fvi t) 2trxm ;o1opeoii3iatfs2uln onu0 ltnxr ootfm rlnvo;s)trum(o3oodolee nesasf 2urx  oo4tpt ifciysfs2em( p (0 lxnxrcootlaDelu o (  rtoxm3io4lmenlnctasfarra(mo;u1tpxnmoctasfs2umump;u4 rxrxr tytlaDean slt0 rxmirpiu1llee fvtlt)a2umurp;u0tetomi3tytfa2rlump;(0alxrxo3oytomDrliei t sexrim3iudaptelfeilt sDumx o;t1tptoii3tysfmDuluvo ()tlerxr3iy1omte ues;s) rtmiopno4om n nct s  2uaxro;u1tlxn ieiyt a ua(vpn() ltrxr totlp  anesls) rtoim nu4optnmiesatfartm(r ;o4oeen oeiadls2rlumo;()tetoifciotlat livol(0srxrir3iy1ap  mnctas)s2tax oou1tetnmieiyslmDem(vsn(0aexomf3tatoa  ai o t)texrim3ny4al nmfvil( sDrr(mpoo0tpt if3iysla2emnvp;(0 exrmrctadfpDe uvol() etrxmpiydom  mfct (fa2rrxmooo1tpe  f3tysla el(vp u4trxoircoydopt lneo;t srxoxrpny4lm e ncs () ruaumpnt0teto feilt s2ulu sn(0 exnmrciydfm rlnei t) eurxr oydopenmicta()sDrmx pot1tltomi3ias m el(vo;() rtnifcoy1fa  li sl( s2ur(o io4ale mnciatfarrrur nu4olx  o3iltfaDumnvs (0treomf oytfpt anesls)t2to(mpoo1lleelnvtls)aDrr(rpnu1oexniociysfs2rau o u)tltoircoadlpteaueo;t  rxrimpno1lltnmnes t)sDuaurpou4tptnio3tldla2rlu ont)teerifcoy1lm raivo t0s2tmir no1ap emieiat)a2taxmp;u4oetoioeiat s rauvp;t0 etnmo oodfmtrai o;(0 2tmirpoy1lmenmneiatfs2taur oo1opeomietyslm eau ont4aexomo oatop e ivi;s  exmxo3io4ap  mfes (f 2taxr ou1tptnmi3tytla2rmnmp;t) lxoif3tadfat  ivo;t seto(mpio4ameemfci t)a2rm(mo;u4tlxn f3iatls emnms (0aetnif3iotfmDe uei s t2uoxm iydomen fvtl()s2rrumoou0tptomf3iyt s emnms u) exrxo ia1la  li s;t0t2uo(r3nodolte fvs s) Drm( ont4oltn oeild mDulumonu) reoif iodlmtrai s ( trxm(r oy1omtelfeiasfa2uru oou4aetnmo3tys m rmnvs;u4texomr iy1lpt anes;( s2uoxrpiy4lmee iesasf Draxroot0teenmoctadls el(ms;u)tlxnxo3oo1oatrlnes;t)t2urxrpio1lptemfvia(f Dtmxmpot1ape mf3iydlaDra(vont4trtrmf iodfm e u s;(0teuoxm3iy1lpt livta() Dtmu o;o4opxomf3iad sDem(vsn(4alxrxoctydoa r uei;(0trtrxmpny1om   ics sfs2raurpot1tleomi3tydfs2ulnvpnu4tetrxrctatfp ranvi s)seurir3iy1ape lfei sfarururooo0tpeo feiydlm2umuvp u)artoxociytlp ean o;t)texmio io4lm  mics ()srurx ono1tlenmoeiydfm el(vp t)teeniocia1fpte n s t sexo(m oy4lpe mfetlsfaDrmu  ;o4olenmo3iydfaDel(vs t4 rtoif tatomtraneo;s s2xoxm3ny1lp elivsls)sDtmurp;t0oexomictyd s2ua(vp;t) rxnif ia1fp  anes s tetmimpno1openmnetatfa2ta(  ;t0tle mf3tat sDraums;t) etoxr tadomte ivols0t2xo(r3oydaptelneta(fsrrr(mpno0tpt ioeiyslmDea(vp;u0texrxf ootom e nei s)t2xr(opiy4opeelnctls)aDtru onu4opto o3tyd mDum( o;u4 lxnmo oy1fat lnvi;s0 2xo(m3nydaltemfcsat) 2trx oot4tpe ii3tydls um( s;u0aetoio tadfptrlnvi t)srumxo3nu4ale lfciltfsDrmu  ;o4tpe ifciltlaDrmuvs;t) lxnir oadfp  an ols0 rumir3nodolt  feta() Dum(rono4ole if3tat mDemums u) exrir io1op   uvolt0t2urio3ny4am  liciatfaDtmumoou0texniociatlmDem( pnu) rerxr ty1fpDranei s sexmim3oudll e ieia() 2rm(ro;o1tlxnmfeiltls2uluvon(0aetrxrcoatfpDraivol( t2tm(r3no1am n nesa() Drru ont0teeniociasla2umu o;() rerxocoy1optrauvi;s0s2xm(opiu4omtn ivsat) 2uau  ;u0alen f3iltfm2ea(mo;t0 rtrio3oa1fpDeaieo t0trur(r3iudlmtn ivs () Dumumonu4tptn o3tat a el( snu) ltoir iodoat liesls setm(opny4optemfcsls s2ua( pou0opt iociasfaDrl(vp;t0tleoxo oo1omDr i i t  etoim oo1lmt  ici s)srrru pnt4oet ifcias m2rmu s t0 etoxocoytlmD au ilt  2trir iu1lpe mfctls)sDurump;u1aeeoif3iytlm ranmo () lxomr tytfaDeli il(  2xmxrpiu1amt  nvilsfaDurur nt1olto feiaslm2rlnmo;u)trxrmr tytla rauvol(0trxoio3oo1alt  nes t aDumxmont1olto o3iyd sDran sn(0aetoiocoodoptr u s s  euoir no4am e nci tf 2umxmo;o1aetomociadla ulumsnu4arxnxr oo1la  auvslt  2xrio nudlp n nvi (farrm(  nu0aeto f3tad sDeanmp t0trenifcoytopDe nei;t0 2tmim ou1openliesat) Drrxrono1olxoiietat a umnvo u0tlenmo3oa1lpte uei;(0 ruoxmpoydll emnvil( s2um(rp;u1openifcild m rmnmp t4altoiociy1omD  ieo (0 2urir3iy1llen nesa(farraxrpno0altomieild s ea(vpn(0treomo3iy1oateli sl()trxoir3iu4apee fetasfsrum(moot0ope  o3ils a2el( o;t) lxomf3oy1omDr i i;(0 rum(o iy1opt lneias  2tr(r nt1alx ii3iytfa2rmnmo u0 ltnxo oa1fmtraivslt  2trxo nodop nlfet ()s2um(m nu0oex  iciaslmDelnvp u0treriociodoaD  nei;s0 eum(r oydlmtnmiviltf Durxmpnu0opeoiociytfa em(mp;t)artnmocoodoa r ues;s  2xmiopno4lle liesls  2tmx oou1alt  i3tydfa um( p (4trermfcoydfmte nvi;( trto(r3iudoptemnctltf Dtaxmonu0aleo o3ias s elnmp u4 renir3ta1faD  ivo;( setm(r3iy4ll nmivsas) Duauroot1olen oeiatlm2uaums;(0texnio iotom rlieo (0 2trxm io1aleemieilt)a2taxront1opxo f3iytls eln s;t0 etrxf oatomD lues (0 etrio iy1aptnlict t sDurx  oo1apt mieiytlmDua(vsn() exomf3oodlp  lueo;t t2ur(o3iu4oleelnvslt  2rrur ;o0teenio3tadlm eau p (4artnif3tatom  auvi ( srumxm iy1amen fvia( aDumu p;t4oeeomfeiltfs ul(ms t) rxnio iatoaDe u o;(  rxrim3oodlptemfvsls artrx pot4tptnmoeild s umu s;t)aeeoifciatomt auvols s2urimpou1ol  lieilt  2um( poo1tpeoio3tydls eau p u)trtrxf todoaDelieo;()sexm(rpoydom  lnvias  ruaur nt0tlt  fctysfs2rmuvon()alenxr3ta1opDr i i t t2urxo nodope mict t) rtmumont1tleo octad s2raums;(4texomociytlm r uei s texrxmpou4al e nei s  Dumx ono1apx  i3iatls ua(vo;(4tlxrio oo1oateai s;t)t2xoir iu4ame  ies (fartmu  oo0optniociys s2em(vsn(4 lenif oodlm e n o;s0t2uo(rpoy4open fctltf 2rmump;t0aeenmieiad mDrl(vp;u0alxnmrcoydoaDelneols0srumxo io4omtn ietl( sDrmxro;o0oltnif3iad a emnmsnt0artrxf oatopDraivs;t  eto(mpnu1amt mivi s  Dra(  ;t1tpx  f3iaslsDulnmp;u) lxnxrciadlp e n ilt)trum(m io4ol elncta(fartaxmpnu1opxn i3tadfs emuvp;u0 eerio iadlp  ln ils)srxoimpny4llte fvsa( artrx o;o4oeenmociatlmDrm(mp;u0trerif3ia1la e nei;s)tetoxmpiudamt lnvtat a2uaxm oo0teto i3ilsfa rm(vsnu)tlxoir3ty1op rau i t0setoxmpio4lptelfeta(fsDrrxm ot0oexn o3tldlm uanvpnu) etrmo3ootoptr uvi;(0texrir3iy1lmt mncilt aDtrxmpou4tlxomiciadfs2uan p (0aeerxfciatlmtrlivi (0srur(r ny4oltnmnvs s) rtaxr oo0olxomociasls elnvonu0 lxnxf oytfate u o;(0teumxr3oo1optnlfvta()aruaxr ;u1apenmi3iadfs2uln o;t)artnmo3oatla rluei;() 2xm(mpny4apt lfei t s2uau pnu4apen ociytlm2rln s;(0texoio oadlmtranvs;t)t2to(m iy4openmfvsa(fsrrm(r ;o1ope mietyt sDra( sn(4 rxoio oytlpt  n sls)sexr(o nu4olt  nctatfartmum ;t1aee iociytfs2rl(vsnu)trtnio3iy1opDeanesl(0t2urir iy1ale lnvt tfs2ua(rpot4tee  feiltfa rm(mpn()alenxr oadoaDrauei s)tetr(r io1lltelnet ()sDtaumo;t0aexo f3iad m2em(vpnu4teenxf3ty1lmDrluvilt)trxr(mpoo4alenlneilsfaDrmurp;u1apxoif3ils aDrl( o t4trenio3oodop e nes;s  eur(mpou4opee neia(f 2uaxmo;u4aet ifciyd a rm( o t4trxrxr tatfaD anei t)t2trir3nydllte ivs sfsruaur ot4oltoio3tys m em( o;() ltrxf3ootop r ivi s0srumirpiy4am   nctas  2ta(m ot4aeeoifcilt m2uauvpnt)tlermfcoadoptranvs s trtriopoy1lmeelfetlt) Duaurpot0apeomfciasfaDrl(ms u0aexomr totfm  aues;s  2xmio3nu1apeemnvs s)a2rmu o;u0tlxnmo3tadfs2rlu snu0 lxrmoctydoa eaivo t trum(o iy4lptelnei s)srua( p;o4openii3iys s rmnmo (4arxnmocootoaDr ivs;(0t2tm(mpno4olenlncil() 2raur no4aet ifetydlm ran o t0 renmo3iytfpt  i slt) exmio ou4altelnes s)srrrxm ;t0apeomo3ias s emnvp;t4 exnif3iy1fmDelnvi s)teumio3oodap emnviasf 2urx  oo0tetnmf3iydfa eluvp t0tlxrifcta1la  aneils)sruo(rpnu1omtnlncsls) Dumur nt0tetn fctls m2um( o;t)tltoxr iadoptean ilt0 eurxm3no1am  mfeslt) 2tmxmoot4alx io3iatfmDea( o;t)trxoirctydlat  ivils)seumxm3io4aptnmnet (faDtr(rpoo0oltnmietldfsDumuvo;u)tltoxoctotoptraneo t) 2xmxo3oydoleemfctltfsrra( p;u4aptoiicild m emn s u0texnmo3oytopD  uei s0 2uo(opiudomtelivsa(fartmx pno0aptoioetadfaDrau p t0 exrxoctadlptrlneslt) rurir iy4omenmfvi t s2ur(m ou1olxoioetadlsDea( s () lxrxf3iotlmD luvs;s) euo(r3nu1omtnlivt ()aruaxr ;o4tetnii3iys sDumumsn(4tetoir oytlatrlueo s0trtrxo ny1omtelictat a2umu ono1opeo icilsfs2emnmsn(4 ltoir iodoatrlnei ()tetrim no1lmen nciltfsDumxmoou0tpxomietlsfs2eanvon(4arxoif oatla rlivs;s srtr(rpoy4opt  ncsas) 2rru ont1apeo fcild s2emu o;t)tltrir tatoatrli o;s  etm(m iudomt lnei s)a2taxm ;o4apt mfeiyt m2uauvsnt4tlenxfcoatfptraivi;t srtr(opny1omtnlfesas  2ua(r ;o1tet io3iasla eln o u)arxoxo3tatfa elnvsl(0setm(r oudalt mnvias)aDur( pnu0oltnmieiatlmDrmumsn(4 rermfcto1la e ivi;( trtmiopoo1am nmictat sDuaurpoo1tetn fetlt s umnms;u) etnmfctatoptr ieslt texoimpiy1lmt mneils arta(rp;u0aleoioeiysfa emums t0aeenmoctodfmD anei;t)srtoxr iu1openmfviatf 2ta( o;t4alxnii3iasfs rlnmon() renmo io1fm eln ols0s2xmio3oo1om   feia(  Duaum nu4opto fcils s eauvonu4aleoio3ta1oat aueo ()texoxo oudlp nmnct (f 2uaurpoo4tetn fctydla2rmumpn() rermrcoy1fpD livilt t2tmiopoy1amenlieslsf 2tmx p;o4tleomiciysls2rmnmp;t)alxoif3ootopDr iesls0texrxr iodoltn iet (  rta(roou1oetomociytfsDuau p;t0trxnio3tatlpDrlnvs;s)srxo(r iu4lmen nct s)a2raxr ;t4tptnmieiat m2um( o;t) etoir oy1opteaies;t0sexo(r ny1alt mfvsasfaDrmuro;u4altn fciasfm umnvs t)trerxr oydfatrlu sl()sexoirpiudopenlicia()a2trum nu0tpxo ieiltla em( ont)tlxoxfciotfpDelu sls  etoimpio4al  lnct t) ruau pnu4tet  i3iltfaDum(vs u0 exrif todomtrlivs;t)sexrxr3io1aleemfeta()sDtau  no4tetoifetad mDuln on(4alxrxf iadlm  lneo s tetoxo iudlle  ieiltf rtmum ou4olx mfetat m ra(mp;t4areoxo iatopDe ivi (0s2to(r ny1amt  feiat)a2tru pot1apeo ieiatfm2um(mo u)treoxf iodoa eluvi;s0trtr(m3iy4olenmfeilt  Drru pnu0aexnif3ildfa uln p;(0arxnxf3iy1op e nvolt sexrirpiy4lp   nci (fsDtmu pnt4aet io3tas m rlnvpnt4 ltrmr iytoptrlies;(0seurir ny4alte iesat srta(m nt0texo i3tldla uauvs () etomo3ta1lmDelivi;(0 etmim3nydomeemncils) Dtm( pnu1aee  feilt m uauvs;u0treoxo iytfpDrlu slt) 2uoxopiu1lme lncta()s2ra(rp;t0aexomi3ilsfaDra(ms;t)aexnmfctytlat  nvs (0 rxrirpny4omt licsls)a2tmxmo;o4alx mictas s ul(vsn(4tltnxo ootfmD  nei s srurio3oo1oleelfcta( sDrru ont4aexoio3iad mDemumont0aeerxf3oytfpD  ieil( srtrxr3no1ap elicsa(faDraur ou0aetnmfetls s2rln pnu0 rtnxf3iodfaDrln ol(0t2urxmpiy1omee fvi tfsrtm( oou4apxniociyd m2ul(vs u0 exomocta1fm rauvols  eurio nu1ll emivia( sDrauro;u0aex ii3iadfaDulump u)altnio io1oat lnvo s0sexoxr oy4al   ieia(f rtmum nt1apenioctyd s rmnvo t0tleoxf oadlmDr uvilt) 2urxo iu4lmtnmfvsa(fa2umx o;u0tpxo octyd s raums () exoif iatlm ran il(0truoim3oo1omt lfeiasfsrra(  oo0oeto ieiytla ra(vp;t4altnmrciodfp rau sls sruoxmpoy4optn iet tfsrrr(r ot4ale ioetydla2ranmo;(4trtoxf3ootom  lnvs;s0 exoxopoo1olt  ivs s  2rm(  ;t0aet mi3iysfa um(vo;u0 lxrxocoatlaDranvil(  rtrxr iudoleemicsat)s2truront4texomoetyslm uau p;()trtnmr ootlmDr neilt)trxmio oo4lpt mneta(fsDra(  ot0alx  i3tldfs2eln p (0aetnircta1laDr u s s0seurxo3ou4amenmfvslsfsDrax pot1tex  f3ildfmDemuvo u)aexoxo3iotfp   u s;t0s2tm(o nu4lmen ietlt)s2rmu o;u1texnifeiasls ranvs;t4artnif iadom eaivi;t)srurxopou1ap   fvil() Durxrono1alen fetat m2rlu p;u4aexoircoydfat  u ilt  eumxr nodamte ivta()s2uax p;t4aeeomf3ilslm rlumo;u0 etnir iodlmtraivsl(0s2xoxm3io4ole  ivs s)a2umx oou4aex  oeiyd s2rln p t0 lxnxfciydoa e ueo s)sexrio oo1ap n ietat srtaxmo;u1tpeomiciltlmDrl( onu0 rtriocoodlpt lu ols)trtmio ny4lptelfvtlt s2ra(m ;t1apto ieildls2umu pn() rtomo3iydoat  nvo t) etoxo3iu1lp nliviatfsrurxm no0olxoif3iltfsDeanmo ()altrxf tatlaDrli sls0teumio nydop elicsl(  rumxr ot4aet mfetaslm uluvpn() ltoir oydlatrlivilt0tetrxr3iudllt mnet t) rrau p;o1alt iictltlm eauvp ()trenmr to1faDr ues (  2trxrpny1lmen fviatfs2ra(mp;o4tle moeiat m2rauvo u)trenxf iodfmteluei;t)sexr(opoy1lptemncil(  Dra( ooo1aptniieilsls rm(vont)arxoiocootfaD  nvi t)sexoxopiydomtemfvi t sDtrurono1aexomoctys aDrlnvp (0 rtrmr3oo1laDr uvo;t)trxmim3iudop nlfetlt aruax pnt4olen oetatlm2rmuvs;t)aeeoxf iadfmDrli o s t2xrir oodapenlnes tf rrrxmp;o4tle iieiydfa2rmump (0teeomo iotop eluei;t srxoimpiy4alte fvslt a2rmxmo;o1apenmociysla2ranmont4 exrxr iadfaD lies;s) etmxr ny1apeemivils)sDrrum ;o0apeoiiciydlaDrmn sn(4trxnxf3tydlmD lnes t0truo(o3no1lptnlfeiltfa2urx  ;u1aet io3iysfs2uau s;t)trtrxfcty1fpD  ieolt t2tmxmpiudap nmncsas s2rmump;o1apeo fctyt m emumont0 rermo3iy1laD aneo s0 rtmimpio1lleemnvs t s2uaur nu0tpx mf3taslmDrm(mp;(0alxrirciytfp  auvi;s0teumirpou4opt lictlsf 2taxmp;t0oeen o3tadfsDea( s t)tlxrxr todlptr ivs s)t2trxo3oudllenmict sfarur( o;o4tlxomoctydla ua( o t)tlerif ta1fmD auvs;s s2toio3oydomee nvi (  Drmuro;u4altomiciytfaDuauvp t0tetrxf ty1oa ran ilt)seuo(rpoo4lp elicil(f Dra(mpou4apeo ieilsls em(mp;u)altnxfcoadlp eli o;t trxoiopiy4altemncsls  Dra(roou4tex ii3iltfaDua(vs;t) ltriocoodlpDr u s;t) rxm(r oodol   nviasfa2ra(  oo4tlto ieiadla2ulu o;t0 exoxr io1fm rln ils)s2toio3iy1alen neias aDuau  ;t0tpxn iciydfm2el(vsn(0artrif iotoa   uei;t)srtr(mpiodoltnmfvilt)aDrmx  nu0apx mfciasfa el(ms;t0trxrmf3oatoptrli sl(0srxoxm iydlp emics s a2tmu pnu0tetomf3iatlaDemuvo (4tetnmrcoatlaD  u slt0setmir3iu4omenmiviltfsDuau  ou0teeomfeiyd a rmn o t0aeerxo iatlaDeaiesls0 rxmxr3no1op elivilsfsDrrurp;o0tex  o3tyslm2um(mo (4aetrifciytfm r ueolt) etm(o oudlpe lfvs ()sDrru ono0ole io3iytfa2uluvs;u4 exrir3iytlp raiei;s)t2xmxr oo4ol   iet (faDumurpoo1oex mo3iyslsDelumpnu0aeeoxfcoo1fpD aneil()trtoxopny4lmte ncs s) rta(  oo0ale ioeildfmDulnvpnu0treoxrctydla r nvi s  etrxmpiu1lmtn nvil(  2tr(m ;o0oee moeildfaDranmp u4 ltoxociydoateluvi;s) etmio3iodlmenmnetat  Dum(rono4opxnioctlsfsDumnmp;(0aetrir3oy1lmt auvs s0 exmir3nudapeemivsatfsDrrxr ou4tlxnio3iyd s eluvs;(0trxomo3oadfaDrluvolt)t2toxopiu4ol nmivs ( srumxmono0olxn i3iatfm2em(vsnu0 lxoxrctytoptr iei;(0 2to(o3oo1lp   icsls)sDrru o;t1aleoiietad sDeanvo;u)texnmocio1fpDr ieo t)trurxmpnydol   ivilsfaDrr(ronu4aleoiietysfmDelnvsnu4 exrio3ty1lpDeli s;(0 2tm(r ou1lmtnmfvias) 2rruroou4tltnmicils s ul(mp t0aexrir3iotoatranvo s) rto(o ny4ale mnes tfarraurpou1tetnioetyslmDranms t0artnmociodoaDrluvols)trto(rpou4llt mict ()s2urum nt1aetomfctadfm elumo;()aexrmo oytomtr n i t t2tmio3nu4am  licsa( arraum nt1tpxoio3iytlm2rlums ()tetnmf3oadfa e ivol(0trxoxo3ny1ope lnvsl( srur(rpot4aetniietldfs eauvp;t0 ltrioctatlmtrauvo t0s2um(r3oo4alenlieslt)srumxrp;o4openiiciad s el(vsn(4 exoifcootopD luvi ( trtmxmpnu4lmte ncsat)sDtrum no1oexo oeiatfa2emumo;u0alermo3oodfp rlues;(0 2tr(m3oy1lltelietlt a2rmxmo;t1oeenif3iasls2ea(mo;t) lenxociatlaDrluvils0s2umio iy1ame mfct t)srum(r ;u0apeo fetyt sDum(msn(0trermr3iotopDrlnvs t)truo(opnydol   ietatf rta(rpot4optn ictltfs2umnvo;(0arenxfcoytfaDelneol( s2urim3nu1lm  lieiat  2rr(rpnu0tpt  f3iatfa2uanvsn(0tlxoxociytfmDrln i ()teuoim3nydop n neia(  rur(mpoo1teenifeiyslaDrln pnt)tlxrxocta1faDeluvs;t0 2tmxmpny1opte nviasf 2rr( oot0texomoctadfmDra( o (0teermr3ty1lmteaiesl(  rxm(r oodaltn ics tf 2tax pno1tlxn oeiaslsDean s;u0 lxoxf oytlatrln o;(0s2uoim3oo1aleelietlt) rrrumonu0altomoctatfs2rmump;t0trerio iodlpteaieo t0s2toiopio4oleelfesas  rrrump;o1apx mfeiasfa ul(vo;u0teerxrciodomt livs;()tetm(rpnu4omtn ivta(  Duax  oo0tleo oetld a2uau s (0aetoxrctodfp rln i;s seumxr3oodlle lieiat artr(rpot0aet mieiatfaDumnvo t4aeerifcoo1opDe iei;s)t2tm(r ou1al emnvsas)s2ur(rpot4apenif3ilt mDel(mpn() rtnircoytfa  lues ( tetm(m ny4ol   nei (f Drmx oot4texn ociytla ran s;u)tetnmociy1faD lueo t srumxr nudol nlnvt t aDrmurp;t4tpxomiciaslm2ulnvsn(0trenmf ootlm  luvi;()tetrxr3io1ale lneiat)artax oou4tlt moetad sDua(mo (0trxnmrctodfmDeli o t)setm(r iy1ll emfcs tfsDrmurp;o1aexomocils s2rau o t0 eenmr ta1late ieo;()t2xm(mpnu1lp nlivs (fsruru  ;t1tpto ietltfm rluvp;t0teeomf3tytlpD  ivs;()srxrir oudllen fetasf 2rm(mpou0alxn octltlsDumnmont)arermo iy1fat  ivs s trurxm nodlptnmnvi t)a2tau ooo1oee mociltfs rlnvsnu4 etriociy1fa  lneo (0 2xmim3iy1apt  icta( srtaur ;t1tlxnmietas a umump (0 eenmo iodomDelieol(  rxmio nydaltnmfcslsfs2tmumont1ale moeiad m emuvo (4 exnxfcta1lpDrluvols trurxr nudlm  lnvta(  Dtru pou0aptoioeiltls2emn o;(4texrxfciotfate i o;s)trtmxm3ny1ape  fcils srurxro;u0tex mfcias a rlu p;()alermo3oodlp  lnvo;t0texo(r3io1lmtelfcsls)a2ur(rono0opxoii3ildlm2raumpnu0aeerxociadlmDe u sls)sexm(o ou1lle mfvt () rurumoou4olxnio3tlt aDuau o;()texnif3ta1fmDeau i s s2to(mpio4apenlicsls srurur ;t4oexomieiyd a uanvpnt4 rerxf tadfatranvo t)srtrimpnudomee icsa( aDuaxm ;u1tlx ioetydfs2rmn s;u0 ltnxocoo1lmD  neols texrimpiodalenlnesat)s2rau  ;t4oexoio3iadlaDeaump;t0altoxfciatfmDeln slt)t2tm(r iydopenmnei s) Drrurpoo4oexoioetldfs2rmn s;u0artrmr oa1lm r ivolt srurxm oudop  mnvtlt  rtm(  ;t0teeo o3ildlsDranmp;(0aeenmo iotfp  li ol(0texoir3nu4lmeelies ( artm(mp;t4tpe ifeiytfs2el(vo u0 ltnmf iotfp eau i s) eurxm oo4apenmnvt () rur( ooo0tpe  iciyd s ulu snu)tltniocoy1fm e u o s  etm(o iy4al  mnvsa( arrmxmono0tle mf3iyt m2uanvs;() ltomfcootomtelieilt  2xr(rpio4am  micsa()arurxr ;o4aex moetyd a ua( o u4tleoxf3ta1lpteluvs t s2umxm nu1lltemnvsltfaDtm(  ;o1tex if3iydfs2rlnvs;u0arxrxf3oytlaDe ivsls0s2uoxopiu1lm  lncil() 2trur nu4tlt io3iyd aDel(vo u) lxoir3tytlpteaueo;t t2trxo3io4oltnlivilsfaDra(mpou1apx moeiyslsDrluvo;t)trxnmociytomtrlieol( s2xmxm3oodolt mneiasfa2ua( oou0oet  ieiadlm2rl(mont)trxomf ta1opDe nvsls)sexm(o3io1lp nmfvtlt)s2rrxm ;u4tetn oeiysfsDuanvp () ltrxf3oa1lpD  nvi t)srxrxr3oy4am e netat aDtr(r ;t0optn feiysfaDrm(mp t0trtnmoctotla eaues t tetrim3io4amee feilsfarra(mont0aptnmf3iasfs2rlu sn(0 rermr tadlm r ivilt0 rurxopno4lmtn ici ( srtmx ont4alen o3iltls rlnms;u0areoir tatop rlnvs s0seuoir iu1op nlfes (faDtax o;u1aex  ictysfa2ran p;()aexnxrciotfat  i ilt0 eum(rpnydlm e nct tfs2ta(ro;t4aptnmfeiysfm2ulnmsn()arxrir iatoaDrlueo (0sexrio3oo4ameelfet s) Dua(rooo1tpx  fcilsfs2ua(mo;t4 lxrmo3oydop  luvs t s2xrxopiodlmtnmnvils)s2umxrono0tex mo3iytlmDemuvs;(4 exnxociatlateliesls0texo(o3iodap   ieiat)srur( o;t4alto feiatls em(mp u0 ltoircoo1la rlivslt)trxr(opiu4ap n fcil(fa2rr( p;t1oexoii3ild m emn p t)arxomrciotoaDelueols0 eumir3iydlm nlietl()s2trumo;t0tlxnmo3tldfaDum(vs t4trxnxf3iatlatrau o () 2tr(o io1lp n feia(f rumurono0tlxnmf3iadla2um(vsnt4aexrmoctytlatelnvo s0 2uoxo ny4lpt  fcilt aDtmurpot4tpxnifcilt aDranvs u)trerxo3iydom rauvs;(0texrir3ny1ale mivsas)s2tmx  nt0opxo f3iyslm2emuvs;t4 etnxf tatfmD ai s;( t2xmim3ou1lp emict t aDtmx ono0oetniieiyt sDumu p u) etniocto1oaDeaueslt trtrxr3oy1olt mfvsat  rtau  nu0tpt  octlsfsDum( p u)tleomr3tadlm  aivo;s  exoxmpoo4ale lfesat) Dum(  ou1texnifctyd a2uauvs u0texrxf tydfaDr n s;t0trur(r3iodll   ivsltf Drmurp;t1olxnmi3tydfmDemuvpnu4artrmo iodlm  anvo;(0 2xm(r oydlm nlieils) rua(m no4opt miciadlaDemu p (4aeenmo iotfmDrln o;t) rum(m iudlleelivtls)aDtmx o;o0alx  f3ilt sDemnms t)artoio3iatomD luei ( trurim ny1altn fcsa(  rta(mpnt1tpeoio3tldlm umnmsn(4arerif tytom e ivil() 2um(o iudomtelictas a2rrxmooo1olt  fctldfsDrm( o;()tetnifcoa1fp   ueo t trxr(o iydal  lieiat)sDurxm nu4alt ifeilsfsDelnvpn(0alxomr io1fm rlivil(0 rxoio nodoltnlnvtas)a2rmxr nt4aetn o3iadfmDumn o t0 rxrmfciadoa r n sls srtmxm nydol elnet ()s2rmurp;t1aet io3ilsfs umu o t) leoxfctadoat anei;t0 2tr(o iydol  lncsa(fa2tr(  nu1tpxoii3ild a rl(mo;() leriocoadfatranvi t0s2xr(m ny1al emicsl( srtm(  no0alen f3tldlmDrlumo t) renxfcoodfm r n i s)sexmxrpnodoltn neils s2rrur oo4open oeilt s ea(mp t)aetnxo tadlaDrluesl( teuoxm iy4al   iciasfsDrr(mp;t4opt mictadfa2emnvs;u4aexoxf oatlp r ueils  2xr(r io4lp  mneiasf Dumur no1oetniiciydls2umu ont4 leoifciodfptrlueo s s2trir3nu1ameeliesa(  2ur(m nu4oeenmoeiadfa eln snu0artnifciotfmt aieilt)t2uoim3iudlpenmnei t) Durum nt4alxn ieiadfm ea(vpnu4trxrmr iydoaDeaieils)s2um(r oy1ope lfeias)srtr(moot1optn fciytfmDrau pnt0altoir oadfaDraueols) euoim iy1llte icia(  Dta( ooo1ape  i3iysla rl(mp (4 rxnxo io1lmtelivi () rtmxo iydolt  fvt ( aDuaxrpou0alt  i3ild mDuanmo;u0teerir3iotfa  ai o;s)texrir3oy1ole  nesa()aDumuro;o0open ieilt aDrm(vonu4alxnmf oytlmteai i s0trtm(o oydam nmneiat  Drmxmpoo0oee mfeiasfsDul( o () rxrircia1fatr uvo t)setmxopny1lmenmfcslt  Drrx pnu1oetomfciadfsDel(vs (4 eenir totfaDr uvi;t) rto(r iydame  fvsat sDtmumoot4tlxomfeiytfs2eauvs;(4artrir oydlmt  ivs t truo(r3nu1omenmnes s) 2rm(m oo0ole mfetatlm uln p;u)alenif3iodlpteanvo;s0setr(mpou4lpen nvtl() 2raxmono4tlen f3tls mDua(von(0 rxnmr ootopD aivi s)t2xm(opiydolenmnctlt) Dur(moou1oeen ietadfm2rluvo t) lenmr oo1oa e ues;t) rurim3no1om n fesat s2tmu o;o1altnifeiadfm2rm(vs t) rtnxr ia1oa   n s;s  exr(o3oudom  miesa( aDur(mpnu1oexniictyslsDeanmsnu4 eeoxo oy1laDrlueo s)srtoxopio1amte fetlsfsDtr(mo;t0ole  fetyd s2eauvp t)aexomr3oadlaD aneo ()teuoio nydlmtn nesa(fa2tm(  ;t0alxniiciyd a2rm(ms (0altrxr3iytfm r uei;()seuoiopiu1llt  ivsa( sruauro;o4opeoif3tat sDeln s u)treoif3iatfm eaueols texoxopiu4amtelfvias arumumoot1teto f3tyd m2elnvp t4 ltoxf3ia1oa e i olt)trurim nodom   iesls) Drrx o;o0olenmocils a2ea(vonu4tlxnxf iadomDeauvs ( teurxo3iu4opeelfctl( s2trum no4aeto f3tld mDrmnms;(4tetnif3tadlmtranvo;t0teuoxr nodop elivt s  2rmuro;t0aee ifeilt sDuauvpnu)aetnifcoytom elu ols  2uoxmpou4lmt lfei () rur(  ;o4apeoifcildlm2eln o (0arxoxr oadopDeauvo t)t2xr(m3no4opteliciat) Dtaxroou1apxniocils s2ua(vpn(4 rxrircoytlm rlnesls)trtrimpiudam e ncsl(f 2ua(mo;u0oetn o3iadla2em(monu0alenmf3tydom ean i t t2xriopoy4lpeemnct (f Dtax pnt1opto o3iytfmDea(vp t0 lerir ty1fmDrlues;t)sexoimpiu1optnlnvt (f Drr(r ;t4openmoetat m emnvs u4aeenmr ty1lp  aieolt)srtrim no4op emfes sf 2tm( pnt4opx  o3tasfs eanvsnt0 eeriociatfmDe n s t texmio ou1lmtnmiei t s2rrxr no0ape  f3ildfm2rmnmpnu)aetnif3to1fatraiesl()srtoxo io4llenlnvtlt arua(  ot0optoifetyt a2em( o ()arxomo3ootlmD  n s s)s2xoxm iodape mfesl() 2ra(  ;o1oet ioeiyd a emnvon()tltomf oadfp   uvsls)texoxo3no1lpt mics tfs2trxmonu4aexnmiciysfm2elu pnt) rtrif3iytomtr nes t  2urir oo1ape lieta() Dtaxro;t0opxoiietasla2rmu p;(0alxrif3totfmDeluvolt0srtoxopnu4om nmicslt aDtrumont4olto f3tat s uau s;u)aetomr3oadoaD  ues t0 rto(r3iy4amt mnvtl() 2tmum nt4tlen ieias sDra( ont0 lerif ta1lmt  ies;s0 ruoxo3oo4om  mfcslt) 2raxmoot1ape ii3ild m ea(vs;u4teermr ty1faDe nes;t texoxrpoo1al e fcsls aDur(r oo0optomoeildfsDumnmonu0texomr iydoate ieo s0tetoirpnodal  mfesl()srtm( o;u4tetn ietysls rauvsn(0tlerio3oa1oatr u ils) exoim3iy4olenmict t arurxr nt0alx  feildls2eanvs;u4tltnifcia1fmtrli s;s0t2xmiopiodom emnct sfsrua(mp;o0ope mf3ild s2ranvp (4altoif3tatlp r nvi s)setmxr oydlm n ivslsf Drmur nu1tlen f3iyd aDemumo;(4tltnxrcta1fmtr ieo s srtm(o3oy4amenlies t  2tr(rpoo4tlx mo3iatfmDulnmo;t4alenxr iotlp e iei;() euo(r3nodllt mfcsatfarraxmo;t0teenmicias a2rln ont)arerxf3tytfmDe n i;t tetmxopio4amt  ncia(faDrm(  ;o1aetnmfeild m2rmn pnu4alxomo ty1fp eln s s0 2tmxr nu1omenlncsat)sDrr(mpnt0oexomf3tld aDranvs u4artrmf oodomteaivi;t) eumimpou4lmt mfvs t arrr(mpno0tpt mf3tydfm el( s (0 rxnxrcto1fpDe ivi;s0s2toio3nudolenmicsa(farumxronu4oetoioeiltlmDrau o;u4 rtnmfctatfmt lneo t  etr(o3ou4alt lnes s)srrmurpoo1opeo i3tysls2rmnmsnu4texrio oy1fateli ols0 exrxo iudap e nesas)aDum( pou4ope  fetytfs uan onu4artnxrcoy1lpte ivi;s0srtrxm3iu1omtnliesas arua( pno0aetnmo3iydfaDumums t4 eenmociatlm  lnvils t2to(rpno4lmen nvsasfsrraxr ;o0aetomietytfs2elnmp t0treoxo io1omteliei () rxrir3nudlp n icia(fa2ua( poo0optomf3ildfs elu ont)aexomf iy1omDelnes;(0 exo(o3oy1lmenlfeia(fsrtrxm ;u0aexn ieiytfs2umn pn(4arerxo iydlmtrluei;t)trxoxo3nodlle  fvs sfsrtr(mpot1tpenii3ildlm2umnvs t) eermf to1lm r n o t0sexrxmpnydlp elicsat)s2uaurp;u1aetnmo3iadfa2ulu p t)tlenxf3iytoaDeaies (0 euoimpiu1amen nvslt arumum ;o4openmoeiysfa ul( o;t0arxrxocoydfa raivi t tetoxo3oo4alee fvta() Drr(mo;o1alx  fciysfmDulumo;u)teenif to1omDeau s t s2xrio3iu4lp nlnvi t)arur(mont0ape mo3tad sDrl(ms;t) rxoxf oa1fmteau i s srxrxopio4ll  lnctas)a2um( p;u4apxniictyslmDrlums;u)alxrxf to1om   ueil(0 exrxm no1llee net s  Dta( o;o0oleoio3tlsfmDea(vs;t4 eeoif3iodfm e i i;t0s2xoim iudop e iciasfsDrax  ;t0teeomi3iadlm2ra( p;t0altrxo iadlptrlnvsls0 ruoiopnodoptnmnesls)s2tm(  no1ole if3tas mDum(von(4artomrciotla rai i;s0sexmxm oodlm  mfvtatf Dtaxmpou4oee ifeiltlsDumnvp;u)aeenmf ia1lm e nvslt0tetrirpnu1am  mnct () rtmur ;u0tlenmoeilsls2rln p;(4trtnmfcty1fp rlnvi;s0setm(rpoy1alen fct s s2rmurp;u0opeo ieiltfs uaump t)texomrcoa1fm r nesl(  2urxm io1amtn fct s artmu pot1oeto oetys m2um(mpnu0 rxoxo iydlpt  nvolt0trumxm iodlltn nvtl()a2um(m no1oex moeiat m emnvo;u0 exomr ty1fmt lieslt srur(o3nodape lncs sfa2taxrpno1aeenmi3ildla eln snt4tetomfciydfmDe nes s0t2umio3oudlme liviasf 2urx ont4teenif3iatfs2rau snt4altoxf3ty1latr u s;( t2to(rpiy4ll emneia( a2umx oou1oleomi3tydla rmu pnt4 lenif3oa1fa ean i;s0srxoiopoydol elfvia(fsrraumono4tetnii3tad aDeau pn(4aeenmr ootlpDeai i;() exr(rpoo1lp elfciat arumxmo;o0ape iocildlm2uanvs (4 rtoxo3iytlat liei;( seuoirpoy4ome mneiltfs2ra( p;t1oetnmfcilsla eau o;(0trxrmfcoytfaDr n slt0 2xo(m no1llt  fvsl( a2uau  ;t0apt if3iatls2ea( pnu0 rtnmocoo1fmDrlu o s t2uoxo iydome mncilsfs2ta(mpnt1opxoioeils s2rmu o;()altomo3ia1latrluvs;t) exm(o3oo4lp n fvt ()s2rrx p;t0optomfeilt a uluvp t4 renxrcio1omtr uesls trtmxr iy1om emnvta()arurxronu1olxnmieiatla rauvo u0trenmrcootlp elues;t0srxoxmpnudll emivtlsfsrtrxmpot1apxn iciysfs2uau s t0trenxf tatom rli o t srxrxrpnu1lmtemfvi ()srua(mo;u0altnio3tasls rmuvpnu) ltrmf3ty1lm e n il(0s2xrio ny1lm  mnvsas sDtru poo4oet miciyd sDelump t) renxo3tatomDeaiei ( seur(o3oo1ole lnetlt) Draxmo;u4tlx mf3tld a emu p;u)trxrir tadfp ranvs;(0t2tmxr ou1al  mivtat)srta(  ;u4alxnmieiasfa2umn s t4aexrmr oytlateaneol() eum(r ny1om emfvi t s2tmum no0tlxn f3tysfa2ul(vs;u)tetnxrcoydlptrlueo;s)s2xm(opnodame mfvt s)sDrmumoot4tet mieiytfm ranmp u4 exrxr oodlatr u s s) rxrxm iy1om elivta( srrau  ot4olenifeiys a2uanmsnt)tleoir iatlmtraivilt) 2to(o io1ame  nvi t s2trum ;u4apxo ietasfm uaump (4tltoxf3ty1opDe ivo;s srumim3oo4lleelnet (f rurxmoot4openifciys s umn s (4 rxoxr ta1lptr ueils0s2xm(rpnu1lpenlictl(f rtaxr nt4altnii3iyt s2eln onu0texrif3oydopD lueol(0t2toimpio1apte ncs () rumum ;t4opxnmfctad a rm(vs t)artnif3todfmDrlivilt0srtoiopoydoltelnci tf ruaxrono4alen fctldls2rl(vp u0aetrmrctatlpDe ivo;t  2umio no4ap  mieils)a2tax ooo1aeen ociys a rm( ont) ltrir3oydlmD lu s;s0 2tr(m3nodaltn nctlt)sDum(  nt0apx ifciydfsDem( s;t4 lxoxo totfptr ues;t0 2uoxrpoy1lpte fcs tf rta(mo;o4teeoiiciat aDranvon(4 rtomocoodom raueols0 2um(r io1ol  mfcsltfsDuru  no1oleoifcilsfa umnvs (0trxnmr3to1fptelnvs s texmim3no4llt mnesasfsrtmurp;t4opt iictld a2el( o;()arxomr3oa1lateaneo;(0srxoxm3iu1op nlicta(faDuru  no4altomoeildfa elnms;()artnxr ta1oaD ln s s  rxr(r oy4om   nctlt)arumxm nt0aptnio3iadls el(mpn(0tetomo3iotfptraies;s)seumxrpiudlp  lfvsat)srrrx  ;t1ale  feiaslsDrau sn()aeermoctotop elu o ( setrxopio1apenmietas) rtax  oo4aeeomi3iad a2ulnvo;t4 eeoifctydlp eluvo t) eurxmpno4apt  feia( s2umx ont0tpenmieiadfs2eanms;t0teeoio ootlpt luei;s0 rxrirpnodape mneta() rtr(mo;u4tpxnifeilsls2uluvont4areoir oa1fmDelivilt)s2umxrpoodam elnvtlsfsrur( poo0alt  ieiadfa2em( o;u4arenirciytlpteaneol()teum(r io1opeemivs t sDtm(r no0alxoiieiyt a elnvs u4trtomf tydfa   uvs s0s2umxr3io1lmenlicil() rrauro;t0tlxnioctydla2ulu p;(0alxnifctytoptr uvi;(0 2xo(o3ny1alenmnvsa()a2tmumono0opxnmietytla2uluvsnt) ltnxr tadfp eanes;t0seto(r3nodopeemieia(fsDtmxmoou4oetn fciytfs uauvonu0 eeoircty1opte uvo;s teur(o3ou4lmenmicils)s2umumont1aeeoif3tls s um(mo (4 renirctodlp rluvs ( trtm(o3iudap emnes s)artm(rp;o1opxnii3iat s uan onu0artnifciotfm  an sl()trxmxm io4oltnmieiatfa2rmx oot4oexomoeiytfs2umu o ()altrxf tytomtrauvil(0 rtm(m3io1ope  fvtas) ruaxmont0aex io3ilt s2rluvs;t)trenxr3tatlpteau i;( setmxm3oodll nmfvi (fa2trur ;u1aexnifeiatlm ulnmp (4alenmf3ta1latraivil()s2tm(m oydalee fesa()s2tr(mp;u1tee  f3tldfm rl(vp;u0alerxo3ia1om   uvs s)texoxm ny1ape  fvs (faDuaxmono1alt if3tltfm2ua(mo;(4tetnmfctadfmtelu i;()srxrir oy1ll nmiesltfa2rmxmp;u4tleo ociad s emu o ()altnxrctadopD  u i;s) ruoxm3iu4llte fvt t a2rm(rpot4ope  ieiad mDulnvpnu0 eerxr3iodfpteau o;t) 2uoxo oy4lmen ietasf Dumu  ou1alx mictysfsDrlu p (4trxnxocoo1fpte n slt tetoim3iy4al n fvt s aruaxmpou4tet ii3tatlsDemuvo ()teenmrciadomt  uesls sexoxmpny4olt  nvt t sDtrum ;t1aexo iciat mDrauvp t) rtomr oatoaDe ieilt)tetmxrpoy4ol elnvsl(faDrrx p;u1alxnii3tltfs2rmu onu4aexoxo oodopt aneo;s  etrim nu1apt livsa()sDra(r oo1tex ioeilt a ulu o;(0 exrxf3oodoptrai ol(  2umio ny4omte nvtltf Dtmxmpnu4apxo ietltfs rl( onu)aexoircoa1fmD ln i;( srur(o io1amt  ncta()sDrmxm ;o0tlt mfetltfa2rluvo;(4 rtrxo ootoat livsls0 exrio iydopte feilt)a2tmxmpot4texo ieiysls2ul( p t) rxnxrctodlptrauvslt s2trxopnodlpe  nvs t srtmuroou4olxomoeiyt sDumuvont0altrxf3oo1omD li s () 2xrxr nydap n nvslt srum( oou1texomfetadfm2eaums () lenmr iodlm   u o;()s2umio3iu4aptnmictat) rtrxr ot0aexn icilslm2umnvo;u0 lenmr oodop  anvils) 2umxo iydlm e fei s)a2uaxrp;o1tptoifetltlmDelu p;u0arxoif3oydlpt li o;(0srur(r3oy1om n nvs (f Dtrur ;t4ole  octad sDrluvp;u4tleomrcio1lm rlieols)srxr(opiy4lpenlfes s  2rmx  ou4teeo ieiad sDuln pnt)tltnmfciydlp eau s s texmio oo1ol   iviltfaDtm(mo;o1oex mfctyd aDeauvs u0aeeoxfcia1laD lneo t trxmxo oodop   ivtasfsDurum no0apto fciaslm emumo u4 exrmfctatfmt  ies s s2xoiopnudlpt  iesls)aDrax p;o0tlt mfeiad a2ul(mp;(0aexnmf3oytlpte i s;(0s2xoio3nu4omeemivil() 2umx  ot0tpxomfciydlsDumnmo;(4arxnmrcta1lmt livs;s)sexmxo nu4opeemivils)aDumu p;u0tpeomoeiat s2ul(msnt0texoxrctodoaDrln ilt t2xmxrpno1opte nvs (f Dtmum nu4apenmfeiltfmDeaumsnt4alenir iatfa eauei t0 2xmim nodopee nvta(fs2rr( o;o4tpeniicias a elu p;(0aleomocoy1lmDeln sl(0 2urim oudll e ivi tfaDurxro;t4tpxo feiadfa ea( o t)altoio3iadopt  nei;s)s2to(opiudomt mictls  2uru oot0aptn ociytfsDrlu s;u4tleomfcoy1lp e iei s)s2uo(o no4am  lfeta(f 2tmu ont4oetnmociysfmDrm(mpnu0 eenxf3tytfmDr ivo;(0sexoxo nu4amen nvs sfaDtrx onu1tlxn i3tls mDrmnmp t4aleriociytlatr nei;()t2tr(opiu1ope mfet s srur(rpno1ale iociadla2elumonu) rxnir3iy1oa elieils sexoxm3oo4lpe licsa()aDuaxmpoo1oex mociysfa2rm(vsnu4aetrxr ootfpDelueo;() rurio3oo1apteliesltf 2uaum ;u0oetomieiadlmDemu p;u4trxnxo3iodlpDeai o t)s2xmirpiy1op  mncilt)a2urump;u4tpx mf3iysfaDemums;u0arxrmr3tydoaD aies;t  etmim no4lptelfvtat)sDrmu pou0teenio3iadlaDranvsn(0trxoir3oatlp r nvo;t) 2xmxrpoy1lltnlicta(fs2raurp;u1tlt iictasla umuvsn(0aetoxf todfaDrluvil(  eum(opnudom n fctl(f 2raumoou4apxomicildls2em( pnt) rtrmf3tydomD aueils setrir3io1opeemnct tf Dur(r ;o4tetn oeildls2rluvo;u) rtoxr3oa1opDe ieslt) rxrxm oo4opt lfcias)arrm(mont1tex  i3iytla umuvs;u0tltoiocoytoateanvo;t)t2uoxr iu1omtemivsl() Durum ot1apxoiietlsfm2ulumo u)aeeoir oodoaDrlieslt0sexrim ny4aptn icsls  rumu  ;u0texn feiltfs rluvonu) rermf3ia1oatr i sl(0texrxrpnydlm emnvslt) 2ta(ro;t0oet if3tldlaDuanvpnu4artoifcio1latrauesls t2xoimpoy4ol nlict () 2ur(m no0aeenmieiatlm em(ms;()aetnif3iydopt anei (0s2urxmpoydaltnlnvtl( s2ur(  ;u0tet  ociatfsDul( pnt0treomo iadfa ran ilt t2xmirpoo1oltnlicias) 2ta( o;t4alxomieild m2uau o;(4altnmo3ta1opDe ies;s0srtmxmpio1lmen fctltfaruru  ;u4oee if3iyslaDemumonu)tltrmociadfpDelnvi;()s2tr(mpnudol elnetat)sDum(  no4oexo f3iad a rmn p u4areomf3oo1fptelnvi;s)trxrir io1lmenmicsa(f Dtrx oot4tptoiociyt sDuauvpn()trtomo3oo1la r u o;s0 ruo(r iy1lp nmfes ()sDrr(  ;u4aexoio3ild a rmuvsnt4tltoxrcto1fp rln sls0t2uoxo iudlpe  ncsas)arta(mp;u4alxomoeiyslm rlnmo;u4tleomf3oodoatean o () 2umxm3oo4lp  mfeias)aDua(  nt0tle  f3tadfs um( o (4tlenir tadfm rlnvi s) 2xr(o no4op e nvt (fs2rmuronu0tex  ociat a2rl( o () exoxocio1laD ai ols0teuoxr iudap n iet s)sDum(moot1oleoiiciysfs raump u4aetrmrctodfaDeau ilt  rxm(rpio4ome mfcslt)sDra(rono4tpeo ictatla2ua(vp;t)areomfciadlpte uvols) etmxr oy4open feia(fsDtmumonu4aeen fctasla ea(vs;()tlerir3ia1fp elneol() rxmirpnu4lmtn fetas)aDtrumo;t4tlenmiciat m rmu snt0tlerio3iatlptelu o;s)trtr(opnudolt  fcsls arrmx pou1olxniociydfsDrauvo;u) exrxo3ty1faD  n slt  rumxrpnu1lmtn ivtls srtmx pno0tpt ii3tat s2eaumo u)teeoio iy1fp   n il( s2umimpoy1lltnliet t srum( o;t1oee mo3iatfmDrm(vsn(4 lenxo ia1om ranes s0 2tmxo3nudopee nvt t)aDtmu ont4alenmociyslsDrmnmpn(4teeoifcoydla rlivs;t  2tmxo no4openlnet s srtr(m nu1oetomoetys a eanmo;u)tltoxf3tadlm r iei;s) etoxrpiydopenmict sf rrm(  ot1apto feiytfm2ul(vp (4arenxo to1oa  auvo;t) rur(m3nudomtemnesasfs2umxro;o1tlx  fctydls2rmnmpnt4 lxomo iatfaDeaieo s s2uoxmpiu1omee ietl() rrmur no0alenioctld m2ua(vo u4texoif ty1la e neils teumxo3ny4altnlieslt s2tm( onu4tpeoii3tytfaDrlnvonu) lerif3oatom   ivo;t srtrim iu1ap nlicsltfs2uaxr ;o4tee  i3iyt s umuvs u) etnxfcto1laD  nvs;t trto(r oo4omeemicsl()srtmu pnu0tlxomf3tatfa2eanvpnu0areomrcoydfm rlnes;t truriopno4alenmfctlt)aDtaumpnt0ape iietatlaDumnvsnu4alxomo3tadfmDe iei s  exm(rpnydomt  nvta(fsDumur no0tpt iiciysls eauvs;t0 exrxr tytfaDr n i s)trtoxrpoudlmenmics t a2taxmoou4opxnioctysfm2el(mpnt)alxnio3oytoat  n i;t  rxrxr3iy4ll  miesl(  rrmumpno0teenmocias m2ran snu)alxrifciadfaDeau o s  2xoim ny1om nlncslsfaDrmxm ou0tpenmfctldlm em(vp u4altniociodoa  ai olt)trtoio ny4alen fet s) rrr(ront4ale  fetydls rlnmont4 exnmfcio1oa  lnvs;s  2toir3oy4lpenmnes s  Draumo;u0alxn f3iatlmDranmonu4trxnircta1op elivol()trtrxo oydomt  ictas)srrrx  ou4oexoii3iad mDrmumpn(4aleoir3tatoaDe ues s)s2trxmpio1ale  ivil(fartrumoot4tpxoifeiatla umnmp t0alxrifcoy1oaDe uvs;s0tetm(o3oy4amt  ivt sf rua(mp;u1alx  ietysfm2rmn snt0arenif3oodoatr ivolt)trtrxm oydope lnesa( a2ta(mp;o0opt ii3tatfa ulu pn(4 ltoxo tytoptrau s;t trtrxmpny4lpe lnei (  Dtmuront0alenmo3ild m2um(ms t) leomo tydfm  aivi t0 euo(opou4llt  ncs s)a2uax  nt1oexoifciadfm2elu snu4aetrxo to1om rlueils  2xrxo3oy4lm  mieils)s2ua(mont0tlxomoctydfa2emumonu0alxrio3todopDrlu o;s t2xrxo3nodalenmnvtasf 2ta(  nt1tltnifciytls ul( pnu4 rtnmfctodlpDe u o ()sexm(r iudlmt lncsatfa2raxmooo1oex  feiasfa2ran snt0altnxr3tadoaDeanvo t) rumxm3ou4am  lfcsl()sDuru pot0aet  feildls2uaums t) rxrxf3iadom eanvi t)setrxm3no1alt mfeiat  rra(rpnu4aptn feiadfmDelumo;u4altnxr totlm eauvs;t0 rxo(r oudame  fctat)a2ta( p;o4openio3ilt mDemumo u4 etniocoytfa eluvo;(0t2tmimpiy4oltnmicia()aDur(m nt4aex mieiytfs2ua(ms;u0 eeomo3todlmteanvol( srumxm3iy4amen fvs t sDtrx o;u0optnmoctasfaDumuvs (4 eenxocoodlatr n i (  rtmxm3io1om  mnvtas)sDraumo;t1oetnio3tad s ul( p u0 etrmfcoodoptran i;(0 rtoim3nu4lp nlfvsls)a2um
\ No newline at end of file
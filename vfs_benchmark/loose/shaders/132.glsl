@@ -0,0 +1 @@
+i i ()s2umim oodomee fvi s)artrx onu0apt  o3iyd aDul( p (0 rxnir3ty1lmD lneil(0 euoxr iu4opeelfesl( s2ua( pnt4oleomietydlaDumump;u4aetrio3tadomtrliesls)srtrxm nu4lme mict () rtmx onu0oltn oeiatlm rmn o (4 ltnmf tytlpDe n i s)trtriopiy4om n iei (fs2ururo;t4aexn i3ild s elu pnt0 rxrxr3todfm rlueils)s2uoxm3oudlm nlfvt (  2umxrp;o0aptn i3ilsfa2umnvp u) exnmo3iy1fpDrlueo () ruo(r no4aptnlfetl(fs2taur ;u1aexn oeiatla2rlu o u4trtomf3iodlp rlivi;s0setrxr3nu1olenlnvsltf Durxrooo0tee  i3tlt mDemnmp;u4trtnxrctydoateanvols0 rtr(opny1om   nvils artm(rooo4apenmi3iytlaDrlu s u0alermrcoadfp rauei;( t2umxr3io1amt  ncsa()a2rr(  ot1alx  octlsfs elnvsn() lenxr3tydlpDraneo ()t2xm(m3io4ol emfesl()sruaurp;o1alenmicilsfa rau s;u0trenmf3oa1latrln ils s2uoio3iu1ol nlnvilsfa2rr(ro;o0olx mieildfm2eau pnu4trtrxr3oadfm eaivi;s  eurio oy1ope mfes (faDtmxm ;t0tpeoioctadfaDea(mo t) rtnxo3io1late neils)srxo(m ny1apt  ictls sDtau  ;o1aexnii3iytlaDrlu s u4aetnxf3oa1fp eliei;s0t2urir3iu4ome livias a2rruro;t4tlx mi3iad m ea(mp t)tlxniocootoatrlieslt)trxr(o3ny4ap n nciasf Dtm(mpnt0aptnif3ilt a2elnvp t0trtomr ia1laDrlnvs;t srtrxr3iy4lm emncilsfaDtrur ;t0ole iociad m2rl(vp;u)aetnmf tatomt  ivilt)trxoimpoo4om emfesa() rua( onu1oleo oetldfm uanmont0trtnxo ta1lp rlueo t trtmimpoydlpeemiviat  Dtm(rpoo1aptoif3tld m2rmums;t4trxomf3oodoatrlies t0sexoxm3nu4am  livta(fs2umxm ot4tlxn o3iytfsDulu on(4aexrifctodfmt  n s t0texoir iu4lle  ncsa() rum(mooo0olto feildlsDra( o (0aleomr tatlatelivi;( srur(o ny1ol n fei t aDraxrpou4opt  f3iaslaDrluvon()alermrciotla   u s;s)teurxopno1al e feilsfa2rax  ot1aleomiciyd m eau sn(4tlxrio3ootlpDeanvsls  eur(rpiydole micilsfa2tm( ooo4aexn ociysfa emu o () eeoxrciotfateluvi;s0s2umxo3ny1lm  mivsl(f Dtr(r no1oex iieild a rlnms (0tltomf3tytoat lies;(0setrxmpoy1am  lncslt arta( ont4aet mieildlm ulnmont4 ltnmf3oadop r uvol(0s2xmio3ou4aptemfvias s2trurooo4tpeomfctlslm2uauvs;u4tltoif3iytfm  au o t)trumim iy1amt mnvt s)srtrurpno4altoifciad a ua(msnu)tetnxo oydlateln s;(0t2xoxopnudal emictl()a2ururonu1aptn i3iat s2ulu o;u0 lxrxr iydoa ranvilt0t2urio ou4lmee ncsa( aDumx ono4tetnmfetydfm2ulu o t0arxrxr oodop eln s t sexr(opiu1opt mivtat  Dum(m nu1tlxnmo3iltfmDum(vp t) lxoxf oodlmDeaueo;t) 2umiopoydapeemnvtas)aDtru  ;u0opeoii3tyslaDemnvp;t0 exnmociy1fa r nvo (0 exoim nu1ll n fct tf Durx  oo4alx ioeiaslaDrmuvo t) rermociytopte nvilt0 2tr(o iu4ame mnctltfa2um( ooo4opeoiiciltfm em(mp;(0 ltomr oytfaD ai s ( s2um(r3iydlpte iesl(f Dtmumpnu4aex  ociydlm rm(vsn()aetnircoa1oa  lueo;( t2xo(rpnu1ap emfcs t)sDtax o;u4tltoifeiadla rm( s;u)arenir oadoatran i t texr(r iodam elfct sfsDrau p;t1tlxnmiciatfa elu snt4tleomocty1faD luvil(  2xo(opnodoltnlnesas arrmxr ou4tlt ifeilt s2ulums;(0artrxo iadlaDe uvi t tetm(opoudlpt mnctasfa2uaxrp;o4olenif3ild m2emums u4 exrmfcto1fptrluvi;(  exoirpiu1omtelnvt t  Drru oot1oleo ietysfaDrmu snu) rerircoy1op ranvo;s teumim3nudll  mfesltf Draxmpoo0apxo feiysls eln s u4texrio3iodfpDeaneo s s2uoirpio4al  mici s a2umumoot0aeto iciltls2ra( on(0trenif3iatfaDeauesls0sexmxo iu1ll n neiltfa2rrumpou0optoiiciyt aDuaumo;t)trtrmo3tytlp e iei;s trto(opoy1lm nmnvt sf rrmu  nu4tpeomfeils a rmump u0aleomf todfp rlnei () rumio3oy4opt livi (fs2rmu  ot0texn ociytfaDuanmpn(4teenirciatom eaueo;()srto(opoudlle licsa() Dtrx p;u4oleomoeiytfm eln p (0arxoxfciydfptrlneol(  2tmio nudlmtnliei (  2tmxro;u4oexnmfeildfaDuauvon()tltriociy1faD lues t teumir3no4am   ictasfaDuax  ;t1tle mi3iys aDumuvo t4arxrif oadomtr ueo;(0seur(rpiu4lme mfes sf 2rrxro;o4tptn f3iat m uauvp u)altnxo3io1oa r u s (0t2uoim io4am emnesas sDumu o;o0aexn icias s eaumsnt4aetrmfciotfateauvils0 rxoxm3iu1olenlictlt  Dumuronu1optnmocildlaDem(ms;(4arenifciadoaDranei (  2trxopoy4ol n netlt aDumxmo;u1ape ii3iysfsDrl( p (0trtoir oodop   nei s)t2xmxrpoydomte ivs sfsrra( o;o1apto fetytla el( p;t) eenxf3iadlaD livo;s trto(o nudlle mfci sfaDuax p;t4tpen i3ilsfs2emnmp u4alxoifciadfpDe u s;t setr(r iodol  mnet s artrxmooo4aex  i3ias m um(vp;u4trenmr oytlaDranei;( srxmirpoodop nlneiltfa2rrxmp;t4optoio3iltfa eanmpnt)tltnmr ta1la  auvo;(0trurxr iy1amtemiesls)artrur ;o1optnmfeildlaDuln o u) reomf iotla  li sls)t2trxo3iu1lmtnmieilt aDumxronu1aex mictadlmDulnmp;t4 eenio tadfaD  ueo;t  rtmimpoy4ol  lfetasf rur( ooo1tee  oetls sDuau p;t4 lenio3oydlaDeaieo (  eumirpnodoptemnci (  2tmum no4ope  ieildfsDranmsnt4aeeomfciy1lmDran ils s2toxo iu1lpt lnesa() Draxrp;u1tlxoif3iydfa rluvp (4tltnxocoydoptr i ils)setr(rpnodamtn ies ()arrauro;t4ape ifeiasla um(vp u4 etoio3ootfp rli ils texoxm nodom nlivslt srtrx ooo0oetnmociasfm2ua( o;u0 lerxo iydoaDelivi t)t2urxrpiu4ameelietl(f 2rrurp;u0tltoiietas sDuaumont) rxnir oytfm eln o s)texoimpoy1oleelnvi ( s2trxrp;o1tltnmfetyd mDelu s (0trermf3totlm  au s;s)sexm(o nu1lm  mnvs (f 2uaxr ou4opx mf3taslmDelu on(4tlerxf iadfmDeaueo t0 2to(r nu1omte fvias  Dtrumpno1aptomietytlm2ul( p t)teeomr todoat livsl() 2urir nudoltemfesat)aDumur ot1alxo oeild m eaump;t) eenmf3todopD  n s;s0setm(o3iodlpe lnesat)aruau ooo1apxoifeiyt m2umn s (0artoiocta1fpDe uvi (0s2trxm iudlmenlicias sDumu p;t0tlxn ictldfm eauvpnt0arxoif ta1fpt au s s0tetmim3io4ame mfeil() rrax pnt1altnmieils sDemnms t)arxrmr oatlp  anes;()setrxm nydamtelfciltfs2rmu  ;u0altnio3iytls2rmuvo u4trermoctodoatr ies;t0 rtm(opnu1amt mfei sfs2rmurpou1aexo feiysfm ranvp;(0altnxo3oadlpt an slt s2uo(m oudomenmicsl()aDtr( o;t0tpxomo3iysfm em( p u4tetriocia1la   uvo t srxmxr nu4om nlieia( aDraurooo4oexomi3iat a uaumsnu0 eerio3oadopDr uvsls)trxr(opiy1aptelneilsfaDtmump;u0tlxo octadls2ea(vonu) eeoxo to1omDe neolt0seum(rpio1ole  ietls)aDta(root0alx  fetydfm2um( s u0tlxrxr3tydla  livols0 exriopiy4olt lfet s) Duau pnt0oexo iciasla2emu p;t)tleoif todlmtelneils0trto(o no4lmenliesat)sDtm(mp;o4tex  ictyt mDuln o;(4 etrmocoy1fat lnei;t trtm(rpnodlpenmicsl() 2tr(r oo1oeeoiictadfa2umuvs;t4aetoir3oy1lpt  ueo ()sruoxr io1lp   ivtlt)sDtm(r ou0tleoifcilt s rmump u4teenirctatoa rlu i s)tetr(opio1ape  fvsl()srururpot4opx mf3ildls ulumo;t)arxoxrcootopD aieol()trxriopiy1openmnctls  rraxm no1tpenmoeiydla2em( p (0 ltoircio1op e i sl( srxr(mpiy1amtnlnvsls s2tr(mo;t4alx  ietyt mDelumo (0artoif oa1fmtelnvi s0 2trxrpoo1lptnlnei ()sruaumoot0oltn fetytls em(vsnu)aleoio oadlpteanvslt trxm(r3iy1lptnlfct sfsDtaxm ou4aeto oeilt m2ulnmo;u0 lenifciotfmDelnvils)s2um(m oy4lm e ivsas  Dtru ono4apxniicildlmDeaump;t0teenmo oytfpt aivo s0t2umxrpny1am   ivil( arra(moou0aleomfciltla ul( p;()aexomo3oa1oat aieo t0teuo(rpiudamtn nciasf rurumo;t0oeen feiydla em( sn() ltoifciadlmD ln i s sexmxo3oo1om nlnvil( a2rax  nt1oeenioeiyd m2umnmo;t)arerxo3tatlpte ues t)t2xrimpiy1al n ivi (fsDtauro;o4aleoifciydls2eauvo;t)alxrircoy1lp eluvols) ruo(rpno1apenlfcil()sDurxmonu4alxniociydls eln pnt4aeenmf iodomtrluvi s0t2tmxm3iu1lmeelneiatfa2rr(ro;t0opx mi3tytlm umuvon(0aexoxrcto1opDe u o;()s2um(r3oy4ope lfeil(  rra( o;u4apeoiiciys m2umnmp t)alxrirciatoa   n sls0 2xrxr oudlpe livilt srrm(rp;u0ape  feias m2uanmpnu0aleoifcootfm r uvols setoir nu1olenmfes s sDtm(  ou0tlxoii3tysfa ua(vo;(0 eeoxo3totoa  li i (  exo(o nodol e nviat aDtaumpno4apeomociadfs2ea( onu4tlenxfcoo1oa  aivi;(0 2uoio3nydal nmfcsas) rua( p;t1texoiiciatla rluvpn(0alxnxo oo1om r u o s)srxoxo3ny4ol elfvtltfs2tau ono1opeomiciyt mDemuvo (4alenxo iatoaDelueils0s2xrxm3oy4opt mnvias  rurxrp;t0alx if3iltfmDeanmpnt0aeenio3totomDr nei s)sexm(m iu4ope  fesas)a2tru oou1apeo icilsfa2umuvs;(4alxoxf3oo1omDr ieo (  eum(rpoy1altn nctasfsDtm(mo;o4altniictytla2rlumpnt0 rxnmr oodfpD aneil(0 2xrim3iydol  lfvt t)arua( poo1tltnioetytlmDrm(mpnu)alxrmfcootoa eaieils s2toxr iy1optn feiltf Dtr(m ot0tleo f3iydfa uanvs;t) rtoxf tadfa   uvsl()s2uo(rpny4om   feil(f rrr(  ou4opxo ictyd mDelnvonu)aleoif3oatfaDeluvs;t) rtmxr3no4ol nlncslt) rua(roou4apx mieiytlaDrlnmo u0 lxrmfcoytfp ranesl()srxr(m oy4ap  mfciasfs2ra(mono4apeoifeiadlm2umn p;(4 reomrciotopte uei (0t2toir3iu4lpeelnei s)arta(r ou0apt  octlsfaDel( on(4tetnif3ty1lpD lneo;t)texo(m nu1lltn ivils sruax  nu0aeenio3tytfa elu p u4tltnxr tytlmtrau i;t0 exoxm iu1om   ict ()a2rauront0tpx  o3ildls2rauvsnt0 rxoir iadfa rluvo;s s2toio3oy1llenlfcs t)sDtrxmp;t0texnmo3tltfa eln p t) lxrio3tytfm  ln i;s) eurxr oudapen nvi s  rra(r nt0tpe mfeildla2ran o;u4arxnmociytlmteauvi;(0teurxr io4lle lici (fs2uau  ;t1tpxomoetad aDrl(mo t)trtrxrcoatfmtelies;(  rxm(r3iy1aptn fvsat)sDururpoo4oex io3tldla emn p;u)areoxocoatoaDr i sls0srumxr io4alen ies tf Dtr(mo;u1ale iiciydfa2ran p t)aexoxo oa1fpt livil(0s2toio3no1amenlncta(fs2tmxroot1opx  ietydlmDumnmp (4aetoxociadfatrlnvi;t0teurxm oy4om   nvias  rtr(ro;t1opxnmieiltfs umumo;u4artrxocto1fmD  n s;s)setoim3oo1omenmict (f rurxrp;t1tlt iocilslaDra(vs t4arxrir iytlateluvs;t s2xoir oo4amtelnctlsfa2tmuro;u4tlxnmieiysfmDranmo;(4arxrxo3to1fpDranvi s seurio3nu1lme  fvtas) 2ua(r ;t4open ieiyd mDea( p u)tetnir ty1laDr i i;t)s2urir3oodopen fct t  2ua(m ;u1olx  f3ilt sDeaumpnt) lermr3ty1latr i o;s0setrio3oo4llte nesas sDrm(rpno1tlxoioeils m el(mp u)artnxf tytlpte u i (0 2uoxopny4ll emivtasf 2uaxm ou1texnmoetltfs ran s (0tlenmf3iodomD  ivo;() rto(opno1lp nlieils  Dtau onu0teeo ieiat m2ran snt4 rtoio iadfptraueslt)tetrirpno4opt mfeslt a2tr( p;t4apt mietls aDem(vs;u4 exnio3iadfmtrlueo;s sexoiopoy1lpe miesls artaumont0oexoioetad mDeau o () ltomo tatfmtraneils)t2uoxmpno1op nlics s  rrmx  nt0tpto o3tltls2ul(vsnu)tltnxf oodfm  anvs s) 2xoxmpiydapenlict (fsDta(  ;u4tpto i3iad a2ea(vo;u4aeeomf3iydfmtraiei s trxmxmpiu4omt mnvi sfs2ua(ro;u1ope io3iysfm2elnvp;()tltrir3tytop e nvi ( srurim3io4omtn icilt)aDrrur ou1optn o3ias s eauvo;()artoxocoytlpD lnvsl()seurxm3iodllen nes (fa2tr(rpnt1tpe  octytla rl(vsn(4trenmf iatoa   ueol(  2xmxm no1olt  icia(fs2rmum oo4oeen fciasls2el(vs t) rerxo3todfmtr n o;t)s2tr(m3oydlme  fei (  Durxmoou4altn feiydfa umnvs;t)trxnmo3iadfmDelnvs s  rtoir iodlpe  netatfarrr(mpou1tlt iieiydls um( o () eerir tadlmD li s;s0teuoxmpiudamt lfvta(  2rmuro;o1oetn ietyd mDrlnvon() exnmf oodfmD ai il() etm(r oy1lle miet t) rraxrpou1apxnioetysls elu o (0alxomr3oadlmDe neo s0t2umimpiu4amenlnvsltf rua( pou4tlxniicilsfm2rlump (4trxrmo io1faDeluesl() rxr(m no4ll e net ( s2tm(  no4alxnmi3iytla2rmnmp (0artoio3tytfpte ivil(0 exrim3oo4lle livias s2um(  ou1tleomoctasls em(mo;(0 rxoxocoatlmt li s;s0s2trim oo1op nlnet tfaDum(ro;u1opt  feiadls ul(ms (0aleomf3iydop e ueslt)truoio3no1alenmfviatfsDur(ronu4opeo ieiltfm2emumo;t4 exomo io1fatr u o (0 rumirpio1optemieiasfs2ur(r no0tltnmfctadlm eanmpnt0 ltoxf oytlatranei;( sexrim3io1al elicslsfsDum( p;u1oltnifeilsfs um(mo t0 etnxo tydlptelu s s t2xo(m3oy4ll  mnvt t)artau oot0aet mfeiys m emnvo;t) leoxf3tadfpDe uvi;(0 eurxm3iydaltemfeias  2ua(m nu4ale io3iysfm2umnvonu4texnio iytoaDe nvs s0 eto(rpoo1llt mfetltfa2ra(ro;u1oex mi3tlsfsDumuvpnt)trtomf oa1oa rliei s t2uoiopno4omte nvtl()aDuax ooo1tpxoiiciysfa2ulumo ()texrmf3iodoaD aues;s0t2uoxrpnu1lmeelivsa()sDrmur ou0alxnmo3ilt a2rlu p;(4aeeoifciodomDeluei s) exo(m3oy1opt lneta(f Drm(  nt0oexomieilslm2elu snt0treoir3iotfa e ivi;s0sexoim3oydll elnet ( arumxmont1opxnifciad aDra( p;()tetoir3iotoate nei;(0 2xr(rpio4ap elfcs t sDrmxrpoo4olt  feiatfm2uaums;t0artrio oo1lptrlivi;(0s2xoir3nu1lltn nes s  rrrxmo;t1olenmo3iltla umnmont4 rtrxr3ootfpt  i i s0srumxrpio1alenmiesl()s2tm(mpno4tlx  f3tltlsDuaump (4 exomf to1lpDr ivols srtrio3io1optnlfcsat  2rm(m oo0olxoii3iys a2rl(msn()trenxf ia1fmDr ivs;t)srtrxrpiy4openmivt tf Drmumont4ale if3ils m2rl( p t)alenxo iy1om  au sls0trxrxrpoodamtnmfetat)sDrrumooo0oexo ieiysla emnvp u0aleoxf3todfp   u ilt)sexo(opio1lmtnmivtasf rrru o;t0alxnmo3tatfs2ran s;u0arxrio3ta1fatean s t0 2urxr ou1aleelfvias artrumpot0ope  oetytla2uanmp;(0 reoifctatlateluvi;t0 2xmim3iu4apenmfciltfs2tm( pot0oet mi3tydfsDelnmo;()alxrmf3ta1fp  lnvo;s0srur(o iudlltnliei tf 2uaurpno1tex iieiltla ranvs t0alxnxocoatlmD ai s;(0t2urim3iydlp  mnct ( sDta(r oo0olx if3iat m2rl(ms (0 eerxfctatoat anvilt trtoxo3io1am n ieta(  Drmxr nu4alt ioeiysla2rmuvsn(4tlxrmo3oo1lmDr ivs;t)truoxo iudapeelivtatfarrrxronu0ape ii3iltlaDumumsnu4texrxr iadomD  i s s)trtoxr3iy4op nmivtl(  Dtm(mpot4tle ifetltfs elnvs t)tleomrciotfa   uvo s0 rtr(rpnu4am n ivtlt)sDuru ono4openmi3tls mDemu s ()aeeomo io1fp r ueo () 2umxmpio4amt  fetls  Dtax ono0tltn ietyd mDumn o;u0trxrxo tytom e i o;t sexrxmpou1lpenlnei s)a2tru  ou0apt mociatlsDemuvs;u0aeenif3io1omDe u ilt) 2xmxm iodomtnmivt t)sruau  ;o1aetomiciydfs2el( p ()trxomf tatfm eluei t0 2tm(r3nu1apen fvt (fa2ua(r ;o4altnmoctat m2umuvon(4altoif oa1fa elneo;()srtrxm3ou1am emncils  rrr(rpno0olxn feiysfsDuluvon(0 rxrio totopteaivo s)t2tmimpny1amtnlfcilsfsrtr( pno4tlxn oeiat m2uanms u)tleomoctydfp   i s;()t2ur(opiu4alte iet (  2ua(ro;t0oet if3tyslsDem(vsnt) etnxr tytfpt anvols  euo(mpoo1amte icta( arraxro;t1tpt ii3iyt s2ra(vp;u)alxnmrciatoaDe ueolt) 2tr(r3oodllte fcias)s2uauronu4tetnio3iyd m2emnmonu)arxoxf totfa r u s;s t2xmxr iudoltnmnvi sfa2rax p;t1tlt  o3iytlsDrmuvpn(0aexnmo3iydfp eliei;() ruoir3no1am n fctas) Dtaxr nt0tpeniiciys mDra(vp;u4 ltoxr3oadlpteln sls t2xrio3iydom  liciat a2rrxm ;u0ale mfctydfa2rm(ms (4tlermf3tytlp eau o t0s2xmxmpoy1apt  fvt s s2rmx ono4opx micilsfm2uluvp;u)artnmf3ia1fa  an o;s)s2xrim3nu1oltn nct ( aDua(rpot1altoiieiat m elnvs;(4 lenxociotop  liesls t2to(o3iodlme liesa() Drrx pou1tlxo fetatlm umumon(4arerifcia1oa rauvo s) 2urio oo1ap  livia()sDtm(m ;t0olx  f3ild a rluvon(4aeeoif oa1lm eauvslt0t2umxo no1olt lics t) Dtrx  ou1tlx  f3iyd m2rln snt4 renmfcia1omtrln i;t0 etoio3ny1lltn ivtl(  Drmur ;u0tpx iieildfmDum(mpnt4 exoir3tadopDeaues;s)setmxo3nydomeelict t)a2urxm ;u0oetn iciltla uaumsnu4texomo ia1om raieo;( s2um(opoy4lme mfvilt  rum(r ;u4aeeo o3iyt m eau ont0texrxf3oy1lm eli o s  exmxo no1lpt  nvsl(  rrm( oou0texomo3iasfs2ua(vs t4alerxf iy1lp   uvilt srxrxmpnydlmtn iesasfarurx  oo1texnifeiatls2rln snt)aetrircty1la r n i;t)teurimpiodal e iviltfaDtaumpoo4tet iociatlaDelnvp (4arxrmocto1lpDr nvo s)teuoiopnydomeemieia(fa2rrxr nt0tpx  ociysla2ulnvp;(0trxrif iotfaDeanvslt0 exrio iodaltnlivtat  2tmxmo;u4tpeomf3iltlm ra(ms;u4 lerxf iadfmDrluvi s  2trxr ou1amtnmnvt t aruaur ;o1tlt ifciydfm2rmn p;t4altnxr iodom rauei;t)srxr(o3nodalte ieslt)sDuax pou4oltnmoetat s2ua(vp (0trxoxr3ia1opt lies;s  rurir3oy1apte fvsas srtaxro;t0teen i3iytfs el(monu0alxrmo oo1omD lu s t  2trxo3iudapt  nciat)s2ur(mo;u0tetomocias s ra( o;(0tetoxo3oatla raivs;(0 2xoim nodolt mfvtas aDurx  ;u4olxo fciyt aDuauvp;t) ltomo3ia1fpteauvsl(0t2ur(opoo1al  mfvsa(  Dtaxrpno4oeeo ieiys s uanvp t0alenmo tadfp   ueilt0setmxo nydlltemnvtl( arrm(rp;u1tet  ieiaslm2ua( o;t0tltoif3ootoatr uesls0srumim no1amt lieia(fsDra(r ;u1openmf3ild m ul(ms u4aexomf tatoateauvo;( s2uo(rpiudamtn icslt)arrm(mo;u4teeoiicilt s rl( s u)texrio3oytla r nvi t0sexmxrpou1om eliesls)sDumxmo;t0olt if3ilsfmDuln p (4tleomocoydfaDeln s (0tetoiopnodale mfciat  2uaxmp;o4opxomo3iadfa2eaump;(0areoxf3tadoaD lnei;s) 2xmxr3no1omt mivta(f Dtr(r ou4opt mfciadfa2umnmo ()trxnmr3to1latr ivi;()tetrimpno4ameelnetls)aDta( ont1olx  iciydfm2raump;t) rxnifctadfat  uvi t) 2tm(m3ny1ale  fesat) Drax poo0oee ifetat mDrmu on(4trenmf3oa1lmDraieo (0setr(o io4al nmivs ()aDur(r ou4olt  ieiydlm2um(ms;u4treoxo iy1oaD  ueo;s0s2ur(o3nudale mivsas a2uaxmoou1tpxnmiciyt a2emnvp u4texnxo3iatlp eai o (  2uriopiy1lleelfeils) rurxrp;o1aetnmoctlsfs rlu p t0tltnmrcoytfmt auvslt0truoxr3iy4aptnlieiatf ruau oot0tlxoif3tls sDrlums t0tltomf oodlmDrln i;s) 2urio3iu4omeelneiat)sDrr(  ;o0tptn ietldla2elump t)alxnxf iytfptraueo;(  exoxr oudol   iet () 2tmx ono0alx ifetysls ul(vsnu0altomf3ootoptraneo;s)tetm(r io1ome mnetas  2rr(rpoo0oee  ieiyt a2uln snt)trerxfctodlmDeluvolt0setoim3io1lm elieia(farumxmo;t4oet ifeias sDuan o (4 lenmoctydfp rau i;s)s2trirpnu1lmenmiet ()srua(mp;t0tpe mfctatfm elnvsn() lxoxf oatop raivs s0truoim nu1al nmfeiat sDur( poo0tptnmo3iltfm2uauvont0alxrxociodoat lu ils0 rtm(m oo4oltelneiat sruauront4aex mfciytls2emu pn(4aexomr iy1fa r uvi t) rumimpoy1alee nct sfsrrrxmooo1oeeomfeiat a2emu s;(4teeoirctotoaDrauvsl()setrir iodoltn iei (fa2rru  oo0alto fetldfs2ua(mp u) exoxfctydfmtrlneo (0srtrirpiy4lme  nctat  2rru p;u1optnioeiydlm2ra(msn() ltomf tydfa eaivo;(0s2trir iodome lfvi s)sDua(ro;u0oex if3ias m2eln o;(0tleoiociodfm ran sl(0texmim oy1lmtnmivt ()a2rr(rpot1tlt  ociasfm ranvs;t0 exoxf oodfmt aneol(0tetr(m nudlme lncs (f 2urxmont1ole mfctldfm rlumonu4texomfcia1op elnvsls srtrxmpou1ll e fcslt a2truroou4teenmo3ilt a eln pn(4 etrxfcty1lmDelnei;()trurir3nu1lpee iesa( aDtmxro;o0tltomictldfsDrmumpnt) rxoif3iodlmDr nvs t  etrxo3no1ale livs () Dta(mpnu4aex  o3tldlsDelnmo;(0arenmfcoatla eai s;(0 exo(m iu4altnlfvs t srraumpnu0apt mfetadfaDeanvpnu0 etoxf iotfat aieo t)srurirpoodolee iei t) 2ua(mono4apto fciasla2rl( snt)tltoifciy1omtr i s t0s2tm(rpiudlpe mnvt t srur(moou1oetnifetytlsDran p u4aexnirctatlptelies;(0teuo(opiy1lpe lnvil(  Drrur ou1tltomoctytlmDulums;u0 lxnmfcia1laDe nei () rumir3ny4om nmieiltfa2rauront4tptnmictldfaDem(msn(4aetomfcto1opt auvo;t texr(r nu1altnlfei tfsDra( poo1aeto f3tadla2emuvsn() rtrxf totfp   uei () rtmxmpoydlme mfvta(  rraxr no0olt  i3ildla2ua( s;u0artnmrcoadfa ean sls) rur(r3iudlmtnlnvtatf Duaxro;o4altniociydlaDuln pnt4 lxnmr oa1lmtrau s;s0t2xoxrpiydamtelnesas  rtmx o;o4oetnmiciad m elnmo;t) rtnir tadfa  au il(0sexr(o iydopt  fviasfaDtmx pou4opeo f3iyt sDeanvo u4alxnio3iotfmD  ieol( s2urxr3nu4om nmfct sfaDrmx  nu4oleomo3iyslmDea(vpnt0trerxrciadla ranei;( t2xmir nydamte fesatf Duaumont4tetnmo3tatlsDua( s;t)tlenmf tadlat livo t0s2umxm3oudoptelieiat)sDuaump;o0oetoii3tadfsDran s (4tltnmrcootfa r ueo;(0t2xo(o nydam   fctlt)s2tmxr ;t4aeeo ocilsfm ranvs;(4 exoircty1fptr u sls  exoio3nydlmee nvsas a2um(  oo4tlen ieilsfa2rln p ()texrmr3ootoptrlnvi;s)trxm(m3oy1al  lfetls a2trx p;u4teeoio3iasfm2rlnvo;t0aexnmfcoy1fa rln olt t2trxrpiu1llt lnvi sf Draxmpot4opx io3iadlsDran p;t0arxrxo3tatfpDeaueolt) 2umim3iu1opt mnvia( s2tr( pou4ole miciadfa ul(vo;u)alxrmoctydoaD aneo (0 2uo(mpnu1ol   fct sfs2ur( ono0apto i3iltfs2ranms u0aexrxr tatfm e neo;s) 2xo(mpoudaltn ncsas)sDrmum no0olxnmo3tyslm ulnvp;() exnio iodlp ranvo s0 2um(o3nudlp nlfvias)a2rr(m nu4tpxnmf3iydlm rau snu)aexnxrctydfm rlneo;t  2uo(r iy1lmenlnvsatfsDum(m ou0teto feildlm rmu o (0arxrxo oo1fmteaueo;t0 exoir3iu1apt  fvs s) 2tmxmo;t1tlen feilsls2ra(mp;u0tltrif oo1oat au o;s)srumxr iodom emnct sfs2rrxr ;t1optnmieils s2ranvs u4arxoir3ootfpD ai ols0t2xm(opiu4ap emnesl(  rra( onu4ale io3tys m2eau p;u)trtoxf3tadfa  aneols) rto(m ny1am n nvs s srtm(rpot0texnmi3tadfsDrm( p;t0tltnio oa1om   nes (0t2uo(opnudopenmieslsfaDtm(ronu1tetniiciytlm2uauvsnu4trtnmo oa1fa r uvslt) rxoirpny1ll  mnes t artaur no0alx ifeiasfa2rl(ms (0aexoxf tytopt au i;(0 2xrxrpnydlp n nvil(  Dtrxmoot1tptniieiyd s2ea( s;(0arxoxf oa1omtr ueo;s  2xo(mpnu4al e fvs ( sDumu o;t0texnmietatls emu o u0 ltomo todoptrln s;s trto(r nodlmte fet (  Dtmumoot0tetnmictlslm umu s t4arxomr3oydfaDr u s;(0 2ur(m3oy1ap n feia()srumur ou4tltniieiys m uaumo t4aetrif tadomtraueilt0 rxrir nu1oleelieiltfartm( o;o0altoifctlsfa rm(vo u) lermfcoa1la r n sl(  2tm(o iydapte fviltf 2rm( ono0opxo ociytls ul( s;() lxrmr tadfm rlu sl(0 2xrxm no4ame mnvs ( arururpnt4apeniictasfm rlu ont0tltriocio1fa rli ilt0 euoxr3iydope mici t aDua( pno0olx mi3iyslaDumnvp ()artrio3ia1opDr n o t srumim3ou4lmtn fcsl()aDumxrp;o1tptomoctatls2uanvs;u4aleoir iytlmD ai s;( s2uoirpno1ap nlnvsat)a2tm(rp;u4apt  o3tydfm rau s;t4 lxoifctadfa   nvilt  2urio3iy4al emnes s)arrr(mpnt0texomfctadfm eluvp;u0 reoxo3totlp e ivi t) rtoxrpoo1lpeemiei sf 2ururoou4apenmfciatfmDulnvp ()teermociy1fpt auvi s)s2ur(mpoy1opeelfesa( s2rrumo;o4aexoifctlslmDemump u4 rxrxo3oo1fa  lnei s s2xrxr nu4lp nmfvta(faDrau p;u0tle mf3tlt a rmuvonu)trxrmr totop ean i;s teuoim iu1apenlfvia(f Dum(rooo1oexo octlt mDumn s u)artomrcta1omtraivo s sexmxopiy1lle  nvtas) 2rrxmoot0ole mocils m rlnmo;t0texomo3oo1lp rlnvo ( trum(m3oydap n iet t)sDrrum nt0tle if3tltla uanvp t0 etomf to1fp   uvo;(0 rtoxm3oydaptn icil( arrax  oo1opx  fciltfm elump (4tleoifcoadfpDr nvo t) ruoxr3io4am nlfctatfaDrau pnu1aee if3tys s2emu pn()arxriocoy1laD anei s)setoxmpoo4lpeemivtl( sDrmxrooo0olx micild m2emn ont4tlxomrcoodlpte u s;() rxrxrpou4op nmietlsfsrrruro;o0tptniietyd a2rmu o;t4 rermr to1lp  auvs t0trur(r io4lm e ivil()sDuaxmp;t0openmictadlm umn o t)tetnif iotoa rlu sls0setoim3iy1lmeemivt t)srrrx  oo0aexomo3tyt sDelumsnu4aetnxr oodlpteaneslt)s2xm(rpnu4amtemnct s)arumu  ;o4oet moeiatfa2um(vsn(0trxnmr oydom rlnvs s)t2urxo3iodlpen fcsat)a2urxro;u0opxomicilsfs2elnvs ()tlenxfcoo1op  lueslt) euo(r oy1ape lnciat) rur(m ;o0aexn oeiasfaDem(vs t4altnxrcoy1fptrlneo t)trtr(m3iu1ll e nesl( sDum(mpnt1olen iciyt s2emu s;u) rerifcoodfat  nvs;(  rumim3oo1op nmfvtatfartr(mo;t1oex mieiytfsDul(mp ()aetoif tatlat anvil()setmxmpio4lpenlivsa(f rraxmo;u4ope mfctasfa eau o;(0aleoxf3iy1lmDran i t)sexoxopoudlmtn ivs s sDtrx  oo4olxnmi3iadfsDrauvo;t0artnxocoodfat lnei;( tetrio3ou1ol nlnvi s)artmur nt1aee io3iltfm2el(mon()treoxfciodfmt anvolt  exrxopiu4llte fes (fs2rmxmp;t1texnif3tadfa2umump;t4trxnio3oytfmtr ivs t)trtrxopiy1amt  ivi tf Drmx  ;u0opeomiciytfmDua(vp;u4tleoiocoatfmD anvi;( trxmxmpiydlp n iei s s2rmumpou0aexoifciydls2ul(ms ()aexrif3tytlm eauvolt teuo(m nodoptemnvt (farumx oot1tetn ieilsls2rm( o;(0aeenmr iotfmt ln ols t2toxo no1ol nlfvtasf 2rmurpoo4olxo fcias a2emu ont)arenio iy1fpteau ol() exoxm3oodoleemnvtl(f Dtmuro;t1alx ioeiad s rluvsnu4tltrir3tatfpte i o;t)tetriopnodlptnlivilsf rtmur no0apx iociat sDea(vo;(0tltnxr oytlateaueo t0t2trxrpiodlm n ictas)a2rrxronu0aex iiciat m rlumo;(4 rtoxrciatlmD  ieslt0 eur(rpoo4op   nvs ( a2um( onu1apxo o3tatfm ean onu) lxomf tadlptranvo;( trxr(m ou4olt mfet ()srtaurpoo0oexn ictldfs rmnvpn(0 etoxr oadfm ean o;s  rurxmpou1ll emici (farumxm ot1tlt  fciydfm el(vsn() eenir3iytfp  au s;()s2xo(m oodlme micsa(f 2tax  ot1apt  feiysls rmnms t0 etoif iytlp  livo t trtmxr no1aptnmnci s) Dra(m oo1tpe  ietad aDel( pnu0trxrmfciatlp eau ils s2xoxm3io4al  lnciatfsrtax  ot0alt  fctasfa2umnmp;(4 exrxr ty1oa e nvs;t trxoxm ou4op   fcta(  rrrxrpoo4alxo i3iatfaDea(mo;() rtoxr oytfpDeaies () rto(mpiodlm e ivslsfaDrrurp;o1oeenio3iltlaDumumpnt4 rxrxo oy1oa   ueslt) 2umxm ou4op   ietlsf 2rr(  ou4apxn feiaslm ul(vp;(0tltoircootoa rlu slt0srxoiopou4open nes (fa2urxm ;o4aetniiciasls emu sn(0trtnmr oy1lm raueo s  rtoim3iodoleelivtat)arrrxrpot4tetnmf3iatla2ua(vo;t0 rtrmociadfmD lu ol()srurirpoo1alte iet sfarra(r ;t1apt ii3tytla ulu o;u4tlxnxocty1oaDrli o;s) exmxm ou1opeemfeilt  rrr( ont0tpt mfetlsfa2um(vs (4 lerxociodlpD  i ol() rxm(mpnodomeelnct ()s2raurpou4apeomfctltfa emnmpnu)artrmf3ootoaD  n o;t  rxo(m3iu4ameemnetas a2rmxmpnt1apeomieiadls rl( ont0trtrxf3oatom elu ols trum(r oo4amtemneia(fa2rrxrpnu0oeenifeiat m em(ms (4arermfctytfpDrlies t0 etr(m oo4llte fctl(fsrrr(  ou4apxoiieiad aDra( o t)aleoifctadlm  aivi;t0t2to(m iu4omeelfvt s)s2urx onu4tlenmo3iyd sDeluvp;u4 lxrmfcoo1fa r iei;s teto(mpny1omt lncsl( a2rmxr nu4aptomfciatla uln p;(0texrxrciydfatrlivs;t)t2tmim iy4om elnei t) Drm(r ot0aexoiocild mDumuvp t0aexoif tydop elnvil()srtoio oy1apenmfvtasf rtrxm ou4tptnmfetydfmDea(vpn() etrmfcio1la elnei;(0 rum(r nu1apenlieta()a2tr( o;t1alx mietltfmDrau pnu4 eenir iotomD auvs;()t2xmxopny4omte nct t  Drm(m oo4tpe if3iaslaDrm(vo;u4treoxf oa1lm r uvo;t seurxmpio4ol nmivtat aDrmx  no1oltn f3iyslm2ul(von(4 lxomr oatfat  ivs (0texoio3ou1omeemncsas  Dta(rpno4alenmfeiasfmDumuvp () rxrxf oa1lptran i (0t2xmxr3oy4lltemivsat)s2umurp;o0ale miciydfs2eln o;() eerxf3todlm e nes t trxoiopny1lmtemics t  2trumpou1apeoiiciasfs em(vp u0 rtnmf3to1opD au olt)seum(r oodalenmici s srta(rpot1alxoiiciys sDea(vo t) etrmoctydfpDrln ils srtm(r io4olte ncs t sruau o;u1opt mfetys s2rm(mo (4artrxf oa1oaDelieol()trxmxopoodomenmfviasf Drmumpno0openioctatlmDrm(vs;()aetrio iadfa   ivi t) 2tm(m3nu1olt  nvsls)aDrmumooo1aee mfciydla2elu o;u0 lxoir3oatla elueol()trum(r iydlmte fvias) rrax  ;t4opt  o3tydlaDelnmsnu)tlerxoctotlpDrlu slt trur(o3nu1lmtemiet ()srrrurp;o1ale mf3iad m el(vsnt0artoxoctytfa e u i;s0srxrxr3ny4al n fct s)sDtrxmo;o0oee iietatlm2emu s u4tlermr3iotopt  neols0s2xm(rpiudop emfeslt) Durx  ot4oexo iciat s umums;t) exoxf tatfa  aivo t  2xrim no4lm  lictls)a2ur(m oo1ale mfciyslm elums;(4 etnir totlaDr iei t)texrxm oo1op  mivslt sDtr(r nt1optoii3iatfs2umnvp u0areoxr oa1lmt ai s;s seumxm io4ope mfctls  Drmu pou1tpe if3ildlsDem(vsn()aleoxo3tytlp eln s s0setr(m oo4lpt livil(f rrrum ;o1apeomiciytla ranvont4aeenxf3oydfmDr n s;t)t2xo(mpno1al nlfvilt  rumxrooo1opeoiociyslmDulnvo u0aexomf iytopDe neilt  2tmxmpiy1lltn icsasf 2uax  ;t4tlx  i3ild m2ulnvs;t)alxomo iodfmtelu i (0texrxrpiu4lpt micsa(fsrum(r ou4oleoif3iasfmDrmnmo (0aetrmf iotop ean s;s0sexr(rpnudomeelncils aDtaumpot0teeomfeiasla2ran o (0teenxr oo1lmt  u s;s)t2toxo3iodole liesa(faDraxrpno1tpe mf3ilsfmDeanvo;t) rxoxf3oodoate nvs t  eumim ny4apeemict t  Dta(rpnt0tlxomo3tydlm ra( o;()altoxocoo1fa   n slt s2xo(mpiu1aptemivsat)srrmx o;u0tptnmieildfaDemnmsn(4teeoir ta1lmtranvo;t0 eurxr oo4omtnlnetlt  2trxrp;u0texn ieildlaDea(mo;t0alenxf3oodlaD  u i;(  exrio oodaleelnetas  Dtmurpoo1aptnmieildls rm( p;(0texoxo3oatfpt aivols) 2xmxm3nydalenlfct sfs2tmu  ;t1alt mi3iysla2eanmpnu)aleoxf3ta1lmDelu i;t)texo(rpnu1amt lnetl( arraurono4alx iocilsfsDuanvsnt) rxrxf tatlmte ivs s t2toxm iu4opt  nvsl(fsrumxm nt0oet if3ildls2ulump () rtnio3iodfpD aneo s) 2xr(mpno1ap nmivslt a2umx  no4alt  feild mDel(mo (4texomociotla rai o;t) exrir3ny1opt micslsfaDuax o;o1aexo o3ilslmDelnmpnu0aexnio3iotopD  uei;t  rurxr ny4ll nlnetatfa2ra(  oo1oexnioetysla uan o;(4trxnxrcoadfpDeaivi;()t2umxr3nu1llenmfciatfa2tax  oo4tpx mietatfm rl(mo;t4trxrmr oy1lpte nei t  etrxrpou4lmt mnvtlt)sDum(r ;t1tlt  fctyd sDra(mp;(0 rxoxf oytfaDeluei s0t2trxo3oudoptelfci (  Duaxrp;u0tet  ictaslm ea( s (4aeenmo3iatoa   neol()srxmxo iudamte nct tf rua(mono1oexomf3tlt m uauvon() ltrmfcio1fmt  uei ( t2uo(m3iodamt mfes sfarrmuronu0aetnmicilsfs2el( on(4 rxrio3iadfa rluvil(0 etmxr3iydlmenlfetasfarraumont0apenmf3tytfaDumump (0 reoxr3to1lpt  uvs s0 2tmxm3nodoltnmncsat  rraxrp;u1tleo i3iltlaDel(vonu0aleoxf oadomD  uei t)srxrxm iudame  fvi t  rurxrpou1ale mi3tytlmDraumpn()arxoif3iotla elneo;() 2ur(r no4omee nciatf rrm(r ;t0tetn feiatfm2ranmo u0 ltoio iadfptr uvsl( srur(opiydllt mfctas) Dtrx pou1aleniiciytlm eln o (4 lerxf iydlp  liei;() 2trio nodopt  iesls)sruau pno0apxnifetls sDrauvs t)trermrctydlpDrau s;(0t2xrxmpou4ap  micil(fs2ur(  nt0texnmictld a uluvo;t0aeenxf to1faDrliei;t) 2trir nu4omeelnvs s) rtr(rpno1oltn f3tltlaDrlu pnt0trerio iodoat anvilt s2umio3nodaptnlfvi t)aDrmurpnt4tpe  i3ilsla emnvp;t) leoxf oa1op  auvs ( t2xmio iu1op elnct sfsDta(rpnt0opxoio3iadfa em(vpnt0aeerioctydlmt li i;t0 ruo(rpiu1amte neiltf Dum(r oo4aee mfeiatls el( sn() rxoxr3io1op  livo ( setrirpoo4lm  micsas  2uaxro;t0optomociydlmDrln pnt4teeomo oodom raies s s2xoimpiu1lm elfet sf 2urumoou0oexnii3iydfa2umuvo;t0arxnxfcoa1lat au s t sexoxopnydal n fesl(  rrm(  nt1aeeomictatfa ran o;t0 etnir tadomDranvi;t0teumim3iy1omeelfei s a2uaxm ;o1oexo oeiad m ranvs u0texrmfcoydoptr ieo;s0t2xm(m3oudapte ictltfa2rmxmoot1oltn icilsfs2uauvpn(4 leomr ia1fmt  ieol( seumxo oy1ape  neslsfaDurx pnu1apxn i3tadls2um( p t)altrio3tytfmtelivols)sruo(o3ou1apee ivias arraxrp;o1olxoiieias s ra(mo (4 ltnmf oatlpt luvolt sexr(m3iu1lptnmictas)s2taxmono4oeeniictlslm2emu s u0aetomf oy1opt  u s t  2ur(o iy1om   fvil(fa2ururp;o1oeeniietltlsDrlump (4 leoxfcto1lp  livi ()teurio3oy1lm   nvi tfarumuro;t1aeeoif3tyslaDemnmp;t4trtnio3oodlm rau i t0t2uo(m3ny1lpe lfvtat sruax o;u1tlt mo3iydlm uaumonu)aetomoctadoat  ivi;t)tetmimpnu4am  mnetas)aruaxrp;t4oexomoctls aDeauvpn() rxomf3iydlaDelnvi;( s2tm(rpoy1op   iesl()a2uaumo;t0tptnmfctat m el(vo;t0 rtnxf3oadlp eauvi;s trxoxm ou1om nmfet s)artmxmpnu4oexn fetydfs umu s (0aetrmfciy1lm  lneil(0 rxrxmpou1opte nvsasfa2tr( oou1oeeo ociydfs2ulu on(0 eenio3iadfp r n slt)s2xoxo no4aleemivtl()aDtrurpnu1opxnifeiytlaDrl( p u) rxoxf oy1fate n s t0srxoimpiodap nlncsatf 2rr(r ot4aetnmfcildls2em(vp ()alxnmr io1lp ean s;(0srxr(rpou4ap elncsls aDtmxmpnt0ale iociysla2rln o;(4arenir tadlmD  u i;(0 2xr(m iy1omt mfcsls) Duaurp;u4tpe moetyslsDem(ms (4 lxomo3iy1oaD anes;s)t2xmirpoo4llenlietl(  Dtmxm nu1oexo o3iadfa2uln o;()aetnxociydfmDrlnvs;t t2umxopiudamt lnvsl()aDur( p;o1aexo i3tadfs2ul(mon()tlxnxrciytfm   neo;s0 2umxopiu1llte ictat aDra(r nt1tetn i3ildfaDul(vo t)arxnir3ia1lmDeaneo s)truoim iy4llenmncs t)srtaum no0olxnif3ild s2rluvpn() eeoxo3iy1lmD  uei;()sexoir3oydapenlfctltfsDrrum ;u0altn ictys s eln p;u4 renmf oydfp r nes;s0teurxopiudopte icilt) 2rm(r oo0tlx  feildfs2em(vp;()aexrif3oytlpDe ieo t)trtrirpnydol nlicias  Drru  ;t1ope  o3iysla emnmpnu0aleoxo iytlpteaies;(0s2xoxr3io1lp elfvsa()srtmx o;o4tlt  ieiadlmDul( ont0 etnmf ta1lat  i ilt0seum(o iy1lpe lieiatf 2urxr nu4alxoiietyd s em(ms;t4tlerxf io1oatrau s (0 2tmim io4lpte fctltfa2uaxrp;o1olxnmoeiatfs2uanvp t)tetrmf oatfatelu il()teurirpio4am nmfei sfa2tr(mont4tpxo o3tydla em(mon() etnmrcoo1optelu i t t2xmimpiu1lpe  nctls)sDtmxmonu1olxomf3iadla uln p u4trtoxfcoytlm e nvils  2ur(o3iodlp nmictlsf 2ra( onu4oexn f3iadfa eau o u)alxnxrctadopte ieils0srurir3iudllenlfet tfs2rrx poo4tleomociat a ua( on(0 rxomr3ia1lmte ueo;()trxoio3iodalenmnct t arum(m ;o4alxoifeiysls2rmumsnt4trtrmoctodfaDr uvi;t)t2xr(r no4omtnmivtlsfsrrru  nu4ope ifciltfsDemuvo () ltrxocio1lptraivsls srxoxm3iu1opeeliesat  Dtr(mpnt1tetnmfetltla el(ms;u0 rermf3iydla rlivils  rxrxr3no1omenlfvt (fs2trurpnu4optoiiciasfa elnvpnu0 lxoxr3oodfmteln sl()srtmxm3iu1omtelfetltfa2taxm no1tlxoiietydls ea(von(4trxnxo3iodfpDeanvi (0seur(rpiu4om e fcil()a2rm(r nt1tpen i3iydlm emu pnu) lxomf todlaD anes t) eum(r oy4omtnmicia(  rrmxmp;t1tlxn o3iad m2ra(mp;() exniociy1fpte nei ()seur(rpio1lp emncsls) Drau  ;t0alxoifeiad aDrm( pnu0 etrmfcty1lpt  neo t0seurir3ou1olte nvil()a2rmxmoot0aleo ieiasfs el( onu)aleomo3oodfpD  ies s) exr(o io4ole mies t s2uru  ;u0olxoif3ildlm ulnms;t0alermfcoadfmDe neolt)seur(mpiy4apee icilt  2rrxro;o0texomf3tltls2rmn s;u4tlxoxo ta1oaDeluvs;s)s2ur(rpno1llee fcs (fsrur(m ;t4olto o3iyd mDel(vs;t)teeoxocia1omt li o;t0tetrio3oo4ll emfvtl(fsrtmxmpnt0aleoiieiatls ra(mont) eenxf todfa   neolt s2uoio3iu4op nmiesls) Drax  nt1texnmiciat aDrl( pnt)teermfcto1fp  auvilt teum(o3iu4lp elivt () 2ta(m ;u4tpt  oeiytlsDrau o t)tltnir iydomteaues;t0s2xmio3ou1am emfvia( a2rm(moot0tpen fctytls el(mp;(4aexnmocoatlptrln ols0 etoxrpoodal nmnvils)artruro;o0olx mfetytlsDrmuvs;t)areomr3io1lp   ueol(0setmxm3oudapeelivt (fsrumu ono0alxo ictytlm uan o;u0trxnmrctotfmDeln o;s teurxr nodame  iesls)srrrxrp;o1optoifeilsls2um( snt)aetrir3todlpDeanes t0t2xoxm3nu1lptn ietltf Dur(r nt1oex mfeiadlm ua(vp t4 rxnio ty1oaDeau sl(0setmiopiy1olenlncsl(fsrumur ou1oexoifctldfmDrm( p t)altnmo ia1op  lu ilt)t2tm(mpnodoptemiet t)s2rmuroou0oee  i3tasfm umu s;(0arxnmr3iydfp r nvo s0 2umxr iy1omtn ies s) Dur(roou4opx ifeiysls emnvo;()arxrmr3iydoa e neo (0 2uo(r3ou1lp  mics (f rua(roou1aptn i3ilsfaDemn p;t4 exnir tydoat lneols texm(r3oodop  mfes s  rumu  oo4aptoiiciltlmDul(von(4 rxrxr3iotfatelu slt)srurirpoydlpte neta(f Dtmu o;u1tee  ociyd s2el(msn(0altrxf3totlpDeanvi (0t2um(r3iy1lmtn icsat a2rmu ono4tleniocils s umumo (0 lenxrciy1omte ivo s)sexmxo3nydlmtemnviat  Dra(rono0alxnii3ias mDemu pnt)tlxrxr iytopt ai i;t0srxmxmpnudomte ivt (f ruax o;o4aptoifetatlaDuanvs;t4alxoxrctadla eai s s trtrio oy4lm   nvi tfa2rmu pnt1alt  ieiaslm umnvo u4trtomrciy1op r uvs (0s2to(r3iu4ol e icsatfsrua(mo;o1ape mieiytfmDuln p t0trtrxf3iotlaD lnvs;(0t2toxrpnu1lp  lnvias  Dtmx  nu0aexo ociydls2eauvo;u0teenmr3oatla  aues;(0srur(r3iudlp emiesat sDtr(  ;t1aet ifciatfm rmump (4 ltrirciotoat  nvo;()tetriopnu4lp emncsat srua(ro;o4aptoiocildlm2ea(ms ()tlenxocoatfmtrluvs ()trto(m iudlp e fei t) rrm(ront1tetn i3iad mDranmp;(4alxrif oo1lp  au i;()sruoio iu4aptnmivsls  Dta(rono4tetn ietysfmDeauvs t0altnxo3oo1la rln slt s2tr(mpio4oltnlieilt  rumx  ;t1oexnifcilsla em( o (4artnxfciytfaDelivi;s  2to(mpio4amtnmnvta(farumum ou4olt  f3tasfaDul( s t4arxnxo3ta1oaDe ueo (0 exrxm oodamtnlnesat aDta(ront4tpeomf3ias m um( pnt0alenxf3totomDe n slt) rxmir3nydole lfcs t a2ra( p;t0alxnmfeilt s2rlnvon() ltnmocoodoat luvs;s teuo(r iy4lleemnciat)aruauront0olx if3tls m um( s;()areomf3ty1omDr u o (0sruo(r iudal e nei sf 2rr( pnu0texnmfciytfs ra(msnu0texomo oy1latrauesl(0sruoxrpou4oltn iet (fa2tmx  ou0oex  ieiasfa ulnvp;(0trxnir oa1omD au o (0tetoxopnydapenmivsa( sDurx p;t4opt ifeils m rmumo;t) leomo oytoa r u s;t  2xrxrpno4altemnetls  rtm(mpnt1tpxomocils s ua( sn()alermr oa1lp  auei;(0teuriopnu1llen iesatfsrtaxmonu0oeen f3ias sDuan p;t) ltoxf todop eaivo;s  2umxm ou1alee netls) Dur(mpot1aptnio3tysfaDumnmont4arenif3iodlm r uesl( sexr(rpoo4oltn ics s)srrmxr ot0oexomoeild m el( pn(0tetrxfcoy1opDrlnvs;( teurxm3ny4aleemfctlt  rta( pot4aetoio3iat s2el( pnt4teermo3oytlmt  ieslt) exm(o nudomt  fvtas)srum(rp;t4oetnioeils m ea( on(0teenif ootoaDeln ol(0s2tmimpoodlmt lfciltf 2rmxr ot0teeoiictas m uanvon(0trxrio3oydlmDr ieo;(0srxo(m oo4olee fetat a2urumont0olxoiictysfa2uauvon()texoio3iytfateli o;s)t2triopoydoptnlfetas) Dtau p;u1oexomfciltfa2ra(mp;t)aetnxo to1op eauvi;(0s2tm(r iydomtelnci s  Dururont0alen oeiltfsDelums ()altomr3oytlmDe ivsl(  exrio3iodlptnmfvilt aDta( p;t4aptomietls s2um(msn(4tlxrir iodlaD  neo;(0 exo(m nodlp  lnvsas  2rmuronu1oex mfciadlaDelnvsn(0 leoio iotoatr i sl(0 euo(o3oo4amtemfeilt a2tmur ot0aet  i3iydfaDran o u)tltnmf iy1lpDr uvils  2uoxrpiodom nlnctls) 2rrxroou4texn i3iatlmDuanms;(0 etoif3iotfmt  u s s) rtmxo3oydlpte ivs (f Dtr(mpou0tet  ieilsfs rmump;t4teenxr3ootlaDraneil()t2uo(mpio4op elfcsltfs2rmump;t4ole mfeiatfsDrl(vs;(4arenmf3tytopDe i s;t setmxmpiu1om n ncil(fsDumxm ou0olenmi3iltla umnvo;u4areomr3oodfmDrliei t0srxoxopiodamt lneia( s2ua(mo;o4opt  ieiad sDemumo t0alenmociy1fm r i ols sexmir ou1opeemics s) ruaxr oo1openifcias sDrlumo;u)tlxniociatfm  lnvols) 2xo(o3oudale  fci t sDraxmpoo1aetnif3tytfa2ua( p u4 lxomr oatoa  luvi s0sexrxm3ou4ap   ncsls arta(mpno1alenif3ias aDelu pnt)aeeoif io1lpte u s;s)t2tmimpio1llte ivi t)srrm( ono4tpx ioeiytla2em( s;(4tetoxr3oy1lmDelnesls0t2uo(opou1ameelfeta() 2ua(rooo1alx ifeildlsDrmn o u0 lxomo3io1laDe n ol() 2ur(m iodameemiciasfaDumump;o0aetoio3tldfs rln ont)altoxfcoatopt lues t0teurimpny1lmenmfcsat  Dtmxrpnt0teenifctytfm2em( ont0alerxrciydlptrauei;t trxmirpnodop  lncsatfa2urxmpnu4ale if3iat aDuln o;u)tlerir oytoa rauesl(0trum(m3io4ap nliet (fsDraurp;o0tpt  oeiysfaDrmu snu0 renmrciotfa r ivo (0 exm(opnodapen ncsasfsDtm( p;t4ale moeiasla ranmo;(4 etrxf3io1omDeau s;s0trxrim ny1ap nmncs tf Duax  nt1olx  i3tyt s ean p t4tlxoxrciatfpDraivo;(0s2urimpoo1am   ieiat)a2tmxronu0teen o3iatlmDel(mp;(4teenifcoytla eliei;s sexoxm3nodlpt  fct s) 2uax ooo0ale mi3iltlm2uaumon(4 rxnxr3to1oa  ai i t0 2tr(r iu1ap nlfet sfsrrmxr no0oeeomfciat aDul(ms t0treomr iy1om  liei;t) rur(r oodomen nesa()artaxmp;o0tlxomictldfm elnvo;u0 rxnxf iotlpt luvo s0 rur(o io4amen feil(farrm(rp;u1olen ocilslm2umumo;u0aexrircoytfat  n ol() exrio nudope mfei tf rrax pot1aex moeiasla2rl(ms u4alxoxf3totfpt  u s t0tetrxr3no4ll n ncsls s2ur( oou1apen i3iysfs eau p (4trenir3oy1lmD  uvs s  rum(r3oo1alenmfetl()srraumpou0aptniieiadlsDumnmo ()alxnmr oy1lmDrlieo t0 rumiopoydlleemnctl()srtr(mo;o1tpx mi3tlslsDrm(ms (4tetnmf3ootlpt  u slt teto(m oodlltemfct ()aDta(ront4tptoif3iydfs2rmumo (4tetnmf3iotoa eluvsls0texo(o iu1open nvsas a2ua(r oo4aptn i3iytls2ua( ont4teenir3totfp e uvslt trtm(r3nu4apenlivtasfa2ua( o;u1olxn o3iadlm2rmnvo;u0aetoif todfp  an o t texoiopiudlm elivi tfaDrmxmo;t4tee ii3iatfa2emnvsn(0 exnmo3oytoatrlieo (0s2trxo3oo4amtn nvs (faDuau pou1oeeo feiltls2rauvp (0tltnxo tydlmt  ieo s)s2trxr nydopen icias)s2urx p;o1texnii3iadfm rlumo (4 rtrifcoadfaDeaneol( setoirpoy4oltelfeiatfs2tmxm ;t0tpt  fciysfmDrm(mp (4trtnxf tatoatrai s;t)t2toim iy1lpeemivi sfaDrau p;o4aeeomieiys mDeluvs ()teermfciotoaDr ivol( trtmxmpny4lle mfetlsfsDtrxmoou0tex if3iyt a2ran o;u)trenmf3to1fmt  ies;t0srxoimpoodap emieslsfa2tru p;o1tltn f3iasfs2em(vont0 rerxfcoadlaDr i s s)teuoxmpiudome  ics t  Drrurpoo1apx  o3iatlm2uanmon(0artrmo totomtrluvolt trxr(opoy4am nliei t)aDuaurpnu4apt io3iltla2umn onu)texoxo to1oa ean s;t0 euoxr nudlptemfvs t  2raump;o4oet iocils s el( o;u0aeenmociadopDe ivi;t) rtoim3ou4ll  mfvi ( srurxm ;u0apxo o3tlsfm elnvp u) leoir ootlptrlieo s trxr(m oudoptnmnctatf rtr(m ;o0openii3tltlm uauvs u0alenmfciatlp  aieol(  exoiopoo1oltemnet s)a2tmxmoot0tptomfciysfm2rm( s t4 eermocto1omtr u o;t)sexrir3iudomt  icslt a2tmx  ou0ole mfetad s rmuvsn()alxrmrctodoa eaivsls0trxoim io4lmeelfvi ()srumx pnu1tpen ocilt m ul(vonu4 rtomf3iytfpDr uei t srurir oy1lmenlnvi sfaDrr( poo0ope  f3tysla2rlnvsnt0trxoirctatlptrluei;() rxrio3ou1amenlfctatfsrrm( o;t0tet mi3iysfs2emnmo;t4trxoio ootomDran o;s)trtmimpou4opeemfvslsfartm(m ;o0alen oeiadfs rlnmo (4tltnmo ty1la elneols seurim oo4lp nlnvta(f rumxrooo1aexoiociys mDua(mp;u0 lxrxrciytom r u s;t  exoim3iy4optemnvias)sDtmu ooo4apxomi3iyd s2eanmp u0tlenio ootoptr ueol() 2tmir iudol emncs sfaDuru o;t0ale ioctyd m ranvp u0 exnmfciytfm e uvolt  etoxo oy4ame lfctas sDtr(mpnt0tle  octld m ra( o;u)trtrmf io1faDrai o;s0 rto(mpno4lm emfvilt)a2tmumo;o1tpxomo3iyt m2rlnmonu4trenio iotomD auvi;() euoxr3ny1lpeemfvta(  Dururpnt0alenifciaslmDuan onu)tlxnxf3oo1lp r ueils) rtm(opnu1lpee ietls)srtmx oou0aetomoeiadlsDemnvsn(0tltnmr3tadoa ranvol(0setmxr3oodomenlnetatfsDumxr oo4tltomi3iydfa2ra( p () rxrir3oadlaDe ivslt)t2xm(m3nydolen netls)s2ta(r ot4tpxomf3tasfa ea(mp;u0artoxf3oodfpDr ivs s)srxoxm3nudolenmfvs t sDtrxrp;o1tpx if3ias sDrmn p t0tltnxf3oytlatr nvo s0 rur(o no4omee fcil(f 2ur(  ot4alxnmocias m umuvonu)artoxo3totoa elivi;( seurir3no4oltemivt s)sruaurpoo0aetoio3iadfaDulnvo;t4 lxnio ta1optr u o s0t2um(o io1lptnmivs ()a2uaxrpoo0openmociatlaDrl( on(0tlenxf3oa1om  lu s;( trtoxo3ou1lp   icslsfartmu p;u1oetnmoetls s2emuvp;(0trenif tytfmDeau o t) rxm(m oydlpt livs (faDtmxmo;o1aleomi3iyt a rm( o;u)tlenmo totlmDeauvi t) rto(rpio1omee nesl(fs2umum ;t0tpeoif3ilsfaDra(vo;t0 etnxo oo1oaD aivi t0texo(r iydlm  lies (farum(mp;o1tptoiociltlsDumuvs;u4texnio iydlm  lueo t  exrim ou1lm emfeia()artr(m no4oee  ociatfs2emuvpnu0treriocootfmD  nvo;() 2to(m
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;s  rtmxr oo1lltemfvsls s2taxrpnt0aeeomicils sDuluvs t)arxrxo3oo1lmteanvs;t  rurxm3iu1lptnmfct sf Drmxr oo1tlxniociadfs rmuvpnu) eenxf ia1fm  li ils  rto(r iy4op nmfet s)sDrm(ro;u0tex mi3iatla eluvs;u4tlxoxo3tatlp  luvilt seto(o3io4altelfvtls aDum(m ou0tpt io3tls aDea(mpn()arxnmr3ia1oa eai o s)trto(o iodlmeemicsat)arta(r no0opeomicilslaDeaums u4aexoirciodlm r n i;s)s2uoirpnudomenlnvt tfsrrau ono4tpenmfetas a rmnvo;u) ltnxfciatopteanvo ()trum(r3oy4om e netat aDtaxmpnu4oexomi3ils s ranvs;t) lxrxf3oa1opteai o (0 rtr(rpiodlp e ncta(faDtmxmp;u1tet  octasfm2el(ms;() rxrmf oa1fpt  n sls) exoir nu4lm elfcia()s2rmxr nt0tlt  fcilslm2umnvsnt4 lxoxfcoadom e ueo ( trumir oo1ap e nci ()aruaumo;t4tlen i3tasfa2elump;()trermfciotoptranvil(0trxmxr nydll  licsl(fsrrm(moou0aptnioeildfs um(mp u)tleoxfcoadlatrlivol() eurio3iy1lmen ncsl(  Dtrumo;u4olx mi3tyt m el( p;u0 rxrif3ta1fm eluei;s0t2trxo io4op e fciat) rra(mp;u0teen fcilt m elu o;t0 ltnmr3oadlpDe nvo;t  rum(o oy1lp emnct s)s2ur(rpoo4teenii3tlslsDrln on(4 rtnxf ta1fa  au ol( trtrxmpiu1lm nlnet t arum(mo;o4oetoif3tydfaDrm(vo t0tetrxfctytlm ranvi t0s2tr(m3oodol n neslt) Drmx pot1texoifctaslm2umnvp (4arenmo3oadom ean i (  rtr(mpiy1om n ictls s2uau pno1tpx  feiyslaDuau snu0texnxf3iy1fp  li o t) etrxmpnodoptelfcs t s2um(  ;o0oee mi3iatlaDemn o u)tleoio3tadlpte n i;s  ruoxr3oydlltnlivs (f 2rmxrpnt4tltnmfetad sDul( s u4arermf oadfat ln ol(0 euoxrpiy1apt lfesls  Dur( p;o4oeto i3iad m rln p;t) eerxr3ootlatr ieslt0t2xr(m3iy4lm nmncils aDtm(r nt1tlx micildlm2rmnvp;u) lxniociodfaDrlieo () etrxrpou4om  lics s) 2raumono0tetn ociytfs2umnmsnu) lxoio3oatlaD  nvi;(0sruoiopoy1alt lfvta( sDtmx  ;t4opxo fcias s uau s t4aetoio3oodfp  luvs;s0s2um(r3iu4altnlies t) 2uaxr nt4teeoii3tadfaDranmo (0arermo oytomDrauvols0 eumimpio4amenlneils  Durxm ;t4oltn ieild s2ulnvsn(4tetomf3oodlm   i i s0 2xm(r io1ll  micsatfsrrmumpot1tpt ioctyd aDrmnvont)trerif3io1la rlieil(0tetrxm nodaltn ncs (fsrrr(moot0tlt mf3iysfmDuluvo t)tltomoctodla eaieolt)t2umxm3io4aptelfci t  2um(ro;t1tpto i3tysls umuvp;(4aleomr tadlpDrau o t tetrir nydomtnlncs s)sDrrumont1oexo o3ias aDea(vsnu0tetnif3iodom eai slt srum(mpoodope  fci (  Dtmu  ot0alen i3ildlm2em(mp (0tlxnxf ia1fmt livil( t2xmir3io1openlivtls artau pnu0tpxnifctldfm ea( snu4teenxrcto1fmDrlu i () exrxr3nu4lm  liciasf Dtmu onu1apeoif3iyd a2ra(mont) etniocty1fmtrlues;t)setrxopou1lpe mnes sfa2umump;u4tex  ietadla2ea( p;t0alxoxr3oa1lm  aueslt  2uoio oy1amenlfviasf Dtrxmont1oet mo3iad mDumu pnt4alerif ta1omDe n s t0 exr(r iy4amenmieia() 2rmx  nu4oexnif3ildfs umuvonu0trermo3oydfa r ieil() euoxrpio4am emfeias arrmx pnu4oexomi3iatfa rl(vo u4tlermr oy1lp r ueo;s)sexo(mpnu4ol   feta(faDtaxrp;o1tpx iiciasfm um( s;t4 reomocootoaDe n o;(0truoirpiodap  mnci s)artr(mo;u1aexomieiydlsDem( p u)artrxocoodfa rlnvi;()trxrimpiodalt lfeias a2um(mp;u1aex iicilslmDrmnvo t0 ltomr3oo1oa e ivo;( seumxopnu1ape lfvtatf Durx p;t1olxomi3iat m rmnmo (4arenxf3tatfatrau s;s trtoxo3nu4alt mici (farta(mpnt1apxoioetltlmDrlnmp (0teerxocoatlp rlnei;t)teumir iy4lptn ncsl()aDrrxr ;u0tpxn oeildlmDel(vp u4trxoio3ootfm  an i (0t2to(mpoydlmte icsas) ruau  ;u1apxo ociydlmDrm(vs;(4trtnxfcoytfmDeluei t) eum(mpnu1ll nmfei tfs2rrxro;t1texn ieilsfs2uan o t0 rxnxocto1fpt  ieo;s0teumiopiy1olen ivs (f 2ua(mont4aee iictld s2ranmp (4trtoxf oatopD  u i t0t2trimpno1ome lnctas arrrxr no0oex iietytfmDeln pnt)treriocoytoa r uvo;s0 rxrxr3oodaptnlfvsa()sDrrumpou1oltn ictas mDran pnu0 rxoxocto1oaDrlu i;()seur(opio4oltnmicslt) rtmu oou0opt mfetatfsDrluvs (0 renxfcia1oaD aivolt0t2xr(rpoy4ll  mnvt s  ruau pot0teeoii3iasfs2elnvsnu)aexnir oadfaDe ieilt)s2um(o nydlpeeliei (  Dtruroou0tptnif3tydfmDum(msnu0 rxrio3tadlmtelu ols)trurim oodom elivsls)a2trx poo4optn o3iadfs elu pnu0teeoiocta1fp  au ils  euriopoy1ap e ivta() Durxmpot4aetnifciadla rlump u)tlxrir oadlatelu ols0s2umxm3nydlmen nciasfaDtr(  ;o0olxo f3ilsls rm( pn(0 eeoio to1fmD aieol( tetrxmpoo1am  mfes s)a2ra(r nu1olxnioctysla2emnmsnt0 lxoifciodfa rau i;s t2uo(o nodaptemnci t  2urur ot0optnio3ildlm eau s;(4 rtniociatoat aieol() eurxopoy1omt mietl()sDuaurpno4tex ii3iad aDel(vsn()trtoxo3ootfptr nvo;t t2urim ou1amtn fcs sfa2tmumonu1aee miciydlm el(mp;u)teeoxr oodomte neo;s0t2to(r3iodamee feslsf 2rr(mpou4teen fetat m emnvs u)arermo oytfp   i i;( seto(r iy1ll   neils) Dumx pou0aeenmoeildlm uauvp;()artoxr3iodlmt  i ols s2xm(o3iodolee fctat)a2tr(mpoo4ole iieiatlm2rmums u0 eenir oatfa r n s;t0s2xoxrpiy1oltnlfvs ( s2umu  ;u0olen o3iatfa eanmo t0 etrxfcoytfate ieo (  rxrimpny4oltemfcia(farua(m ot0opt mieildfmDra(vs;(0 exrmf ootfmtrau i;s0srtrxr ou1ame  ieil(  ruax  ;o1tlxnmfeiadls2uln p ()trtomf3tatfmDrlivi t0 2tr(m nu1olt mnes t aDta(moot0alt  feiat a2rm( s;u)aeeomo3io1oatr nvslt0 eumxo3iu1am  lfvtltfaDumxmono0tlenio3iydls2emumsn()alxriociytla rli s;(  rxr(r oy4omen ieil() Drau pno1tpxomf3tydfm ua(von(0 rtrmo3oo1lat ai i;s) eto(opoudap nmiesasfsrtmur nt1tle ii3ildlm2uauvp t)artrmoctytlat  nvs;t0 rtr(o3oydol elivs (  Dtmxr nu1oee mfciasfa emnmo;u)tlenmf iadfm  aivs t0seto(rpny1olte fct t) Draxro;o4apxomocild s2rl(vpn() lenmr ia1lpte nes ()seto(m nudopte fesltf rumxrpoo1oee mfciyt a2uan o;(4 lxomf3oydfm ran s (  etr(r iodlmee fctlt)srra(  ;o1ole  ictatfs ua( s t4teerir ootlmDranes;s) etm(m iy1op n ivi t)sDumxm ;o4tptoifciltlm umnmo t4 exoxr3iydoa eluei;s  euoxmpiy4ole lieil() 2tr(m ;o0texnmfeildlm2rm( ont0aexnxf oadfpDeln o () eur(o3no1om  lieias) Dta(mo;o1oeeo fciyd aDeanmpnu0tlxnmoctydlmteanes t seumxm io1al   ivsa(faDtauro;t4oleniieiadfaDelnvp t)alxnmr3ta1fm elu i ( trurxmpny4ll n ivtlt  2trxm no0aet ifetasla ea( pnu4 rerxfcoatomD aies;t0srxmir oy1lp  liei tf 2raxm nu4apt ii3iyd s eanvs u4trtrif ootlpD luei;()s2to(opoy1ll nmieil() rtrx  ;u0tpt miciyd a2ul(vpn(4arxoxo3tadfaDeau i (0seuriopio1oleelicsl(fsruaxrpnt0ale mi3iadlm2rlnmonu)trenxr3tytfate uvo;t0t2urir3no4lpeemnciat)a2rru  ;o1aptomo3iaslm2rm( s;u0 rxrxo3oa1fp ean o;t0texmim3nudopeemfes (farurxrpoo1alt if3tat mDra( s;u) lenmf3iytoa e ivslt0srumxr3iu1al  mfvilsfartm(r ;t0aexo fctld mDemnvo t4 reomoctotlp  luei;( seuriopiu1ol nlfvs ( arrrxro;t4tpx ifeias aDum( pn(4treoxrcoa1oate n slt  2xmxmpoy1aptelfvt s  rta(m ;u0tpe  o3iltlm2uau s u4 etnif3totfat livs (0texo(o3io1lm nmncs (f 2trxrpnt1opxnifcilsfm2rl(mo;u4 renir3iy1la rlneolt0sruoxr ny4lpen ivil(fartmxmont4apxomo3ildlsDran p;(0 etrmrciytfa  luvo t  exmimpoo1apeelnct t srrr(  ou1tetnmf3iydlmDemnvo t4texnmo3ta1om elues s0 eurxr oo1oltnlncsat srtr(ro;t0apx  f3ilsfm2ra( p (0 exnio todlmD luvs ( t2uo(opnudol emnesatf Draurp;t4oeeo oeiat a2rmnvo u4 exnxrciydomDr nvo (0 rxr(r nu4ope  nvs t  rtmxmp;o1apt  i3iysfaDrmump;(0 rermr iy1lp elues;s0 2urxopio4llt  iesls sDtmum ;t4aet  iciadfm ua(vo u0trxrxr ty1op   uvils trxmxrpnu1opt  ivi () Dtax  ;t1tlxn o3iatfaDumnms;u0aetnirciadfaD lnvs s  rtrxo3iu1ap nmfvtat)sruru  ;o4oee  ieiys a2eln snt)tltoio oydla   u s t)s2toiopoo1altnlictl( srrm(m no1apxn f3iysfm rm( s t4 rxnxf oydlaDeaneslt) eumxo3iu1apt mnvsat sDtr(rp;u1oltn o3iat s2emumpnu4aetoir todfpD lu o t0 2xoxr io1llenlictat)aDtmxmpnt1teto iciaslm rmn o t) exnio oydoaDeanvslt0t2uoim nu4amtelivsat aDurx  nu0optn o3iadfm rmumo;()trtnxocoydfmtr uvsl()srurir3io4llt  ivtl()a2rmuroot1tptomietytfsDrmnvsnu4tlxomo3ta1lpte i s s srxrxm3iodll  micias) Duru p;o0oltoii3iytfaDrmnvo (0arxrif oodlaDrln s;s s2trxo3iu4optnmfci tfs2urumoot1opeoioeiltfa ea(msn() rtrio3totfpt li il( trtmir3ou4ale  fvt () ruaur ;o0opto fciatla rlumonu)teeomrcio1oatelies;s)trtrxm oydlmee iet s a2urx o;o4tpxoifetaslsDul(vpn(0alxnxf iytom rluvo;s) rtm(r3oo1ap nmnesas arra(mpnu1aex  octysls el( pnt)aetoir oodlmteaieils0 2tr(opoy1amee feias sDumu  ot0aptomfeias m em(mo (4aetnxo3tydlmD auvs;( trtrio oo1ome mnes s  Duaum ot1tpt moctadfm ul( o t)treomrctatlaDrlueslt  2tm(r oudlpe  nctlt s2rm(mo;o0aetn icilsfmDrmnmpnt4tetnmocoydomtranvolt trumir oo4ape lies t) Dumxr ;u0tpt ifeiasla2ean sn(0alxrmr3iadfmtrauei;t  rtmirpou4olt  ieias)a2rmu poo4apeoio3tlsla rmumont) eermr3tatopDrluvo;t) euoir iu1oltelnes t  2rax  ;u4aeeomo3iadfs2emuvp;u4tetoxo oadfp   ivo t0trxo(r3io4olee fci s aDum(m ou0alxnmocildla rmumo u0 rxrmfctytoaDr ueslt) rumxm3ou1am elictas  rtrump;o4teeo oeilt m rlnvpnt)aexoxfcio1lm r u i s0 2ur(rpoydol   fet () Draxmpou0tlenmoeiltlm2ua( p (0 rxrmo oodla rlneo s)tetr(mpiodlltnlnct t srtrx p;u1tpx  iciad m emuvo u) eeomf3io1op  ln s ( s2trxmpiydlmt mfvtatfs2rr(m oo0tlxoioeiatfsDrmumonu0tlxrmo3ia1opDr u s (0srxmxmpiudop n fcsat)sDtaxrp;o1tex mfcilsfs2umnvon(0tetnmf tadfatrauvo;(  etoio3iy4omt  nvtltfsrum( ont0teenifeiydfs eanmpn(0altomrcoytomtr u slt0teurxo3oy1amtnlfvt s sDua(  nt0olt mo3tatfa umnvs;u0 rtnxociy1fa elnvs;s)sexo(m iy1alte nvtasf Dtau  ou0opxoiiciasfa2rm( p () lxnir ta1lp  livi s) 2xm(mpiu1ol n icil( sDtmurpoo4oex if3iytfa rl( pnu4alxnmo3iatlat  ivi;t0srxmxr ny1olt lnctltf rrrxmp;t4olxnif3tlt a2emn snu4trermrcta1op rlneils sexoxo io1om nlivt (  Dumx p;u0aptomfciytfs el( pnt4alxnif3oy1fm rlueo;t t2xm(m nydameelfctas sDtmurpnu0oleomieiydlm ua( p t) etnxf oatlaDrauei t)t2xr(m3io1altnmnet s)srraurpno4tlt ifeild aDul( p u0 rxnxr3oodlmt livol( trum(o oy4om nlnvta(f 2uru  ot0teen ociltfa2rmnvp t4 reoio iytomtrlieolt  rurio3no1opt mfeilt)s2trx o;t1tlx ioeiatfa2eanmsnt)trxnirciatla e i s t  2um(rpoudlle lietas sDtaxrpot0oex ii3iad s ulums;t)aexrio3tytop  anvo (  euo(r ny1alte ict t)aDrrxmoou1aexnmieiltfs eauvsn(0tltoxfcty1fptrlnvols  2toxo oudamtemnvi (f 2rrxr ot0oet  ieildls2ranms;t0 leomociydlatraivslt)teumirpoy1alee fvi sfaDrau o;o0oltomieiatla ra(vo;(4tlxniocoydfm e uvs t)sexoiopiu1llenmivs s) rtmum ot4tlxn octydfsDulnvp u0alenifcoatfa e ueslt s2xrxr no1om  lfvtlt s2umxr ;o1aex iociltfmDua( snu0texomf3tydfm elu i s trumxr3oudop e feilt s2trurpnt0tlx  o3tydlsDraumon(0tleomo3ty1fa  auvo;t) 2tm(opiodam nmivi ()s2ra(m no4oltomf3tas a2uauvsnu0 rtnirctadla eanei t teuoxr3no1lme liesl(fs2rr( o;t4optnmietyd m umnvo (4trtoxo todfmDeaues s t2xrxm3no4lmee nes s)a2rrxroot0texoii3ilt m emnvont4aetnmfcoatoaD lueo;( s2toio3io1lmt lfci s)arrmxr ;o4oex mi3ils sDuaumo;u0 etrmo3iy1laD aies;s) 2xrim3oydom nlfctatf rtax  nt4oex mfeiat mDeluvp;u4 exoir3tydlpt  ues;s tetrxr oo1lp n fet t)a2um(ro;u1aptomoctytfa ea( s;(4tetrxr tytlaDelneslt)s2trir3io1am e fei ()a2ur( pou0olxo i3iad s2elu s;u0texrmo3oa1lat aieolt0 etoim3nodomtn ictat)srrru  ;t1tlt  o3tytls ranms u4aeeomfctadfaD lueo ()t2xoxm nu1om   nctl() rtrx oot4tlx moeild s2ran o;(4aexriocoatoat  neol( s2um(o3iu4apee feias)srur(rono0opt  iciat aDel(monu)tltrifciy1op r ivi;t0sruoxmpoudoptn nesas aDrax ono1oetnmfetyd a raump t) lxnxfcia1oa eaivil(0texriopiodale mivt t) rtrum ;u1tptnifeiys aDrlnmonu4artnir oodlpDeaivi;() rxm(o ny4alt licsatfs2uaxmono1alto f3iyd m2ra(von(0 eerifciadlate ivo t0 exmxrpou1amee fet (  Drrxmp;u4oeenmf3tls sDrmnvp t0trxomf3iadoptraneilt0srtriopiy4ap nmict sfaDrr(r ;t0oetoif3iys s2rmnvsnt0 rxoif io1fm elnes;t0sexmio iydlle  fet s)srum(mpot4opxniictlt a2uauvs t)aetnio3oy1lm eli il( s2um(rpiu1optemiesatf 2ur(r ;u1tleo feiadlmDra(mo u) exniociatlpt  ivslt)sexriopiodoltelivi ( artmxrp;o1tltomi3tltls uln o t)tltoxo3tadoa elu ils) exmxr io1lp nlnvsas)sDtrump;t0apxnifciytfaDua( p u0artnmr3ootfm eau s t)trxm(o nydom nmfeta()a2rrx  nt0tptn fcils a2uanvp (4 lxnio ta1fpDrlues;t0srtoirpnudomtnlies t sDuax  ;t1opx  oeild aDemu sn(4 leniociotlmteaiesl(0s2xm(m nu1op nlfci s)srrrumo;o4ape mi3iadlsDul(ms u0tlenxf iytfm raueo t) exoio3oodlmt mici s)a2rm(rpnt1tex moeiyt a2emums;t0 etoiocoy1latr i s ()teuo(o oydalenlncsat)a2rmxm ;u4aleomiciytlm2umn p;()teeoir3tadfpteauvo;()trum(o oodamte ietatf Drmu  ;o0openmieiat sDumuvs;t)aetnxfcoa1oatrlueols  etmio nodole  net t)a2umxmoot1teeoioeiatfsDrluvs;(4 rxrio3oadfaD ln o () 2tr(o3iu4llt mfesatfsrua(ront0alt mociadls2uauvp;(0arermr oo1lm  aieilt  2toirpiu4am emiei ()sDraump;t1apxomieiyslm eau o t)tlxoxf3oatomtrau s ()t2trxm oudalee fes tfaDuau o;t4texoio3ils a emuvs;u4tlxrio iytfp raneolt)setr(opoudap  mietlt) rrax p;u4optomieildlm rm(ms;u)tlxrifctadfptrln i (0trxoio oy4lm  liet t) 2ua( pnt0apx  ieilsfm uan s;(0 rxnxr3oytom e uesl(0setm(m3iu4olenmici ()sDra(rpno1ape mictys a ra( s;u) etrxr ootlpDrlieo;t0t2tmxopny1amenlfcilsf 2tmxmo;u4tleo iciyslsDrau s t4arerir tatla   u s t)trxo(m3oo1llenmnctltfa2rmxmooo1oeen ociydfs2raums;(0 etoiocoa1la r n o;t0srtrxr ny4ol nmfci t arumxmo;o4apeo icildlsDrm(mo u0aeenmr iodfm eanes;s setoxr iudlpen icta(fa2ua(mont4aeen feildfmDuan o u4aetrxo iodfmDeaivo t0setm(r3nudomtnlfctat  rraurpnu0apt  ictltfaDeaums ()aexnio tydlmD lu sl()tetrxmpiu4ll   fei ( s2uaxm nt1aet iieiydlsDuau o (0tetnmocoodfpt  ies s  rurxo3oo4al  mfcilt)aDta(r ou1apeomieiyt m2eaump () etnmr3iydfaD  i s;()trto(mpnodam n ivt t  2ururpno1aeto o3iysfs rluvo u0teerircio1fp  luvils0sexr(rpiu4lm emncia(fa2um(rpnu4tlxo o3ildlsDuanvs u)tleoif3tydfp rli ils0srxrxm iudope  fvt s  2rrxrpnt1altniictytfm el(vp;(0arxomocty1oaDr nvil()trtrio iu1lltnmnvils srtm(rpou4apto fciyd m ra( s;(4 exoio iodoat aivs;() 2toirpiu1ame mnvi ()aDuau oou4alto i3iadla2eaums u0 lenmr ootfmDelu s;s0trxrxo3nydaltnmivt ( a2tmu p;t4aptoifctltlm2rlumont0artnir3ootlmDeaies;s0t2uoxmpiydol nmfci sf rraxmp;u1tlxomi3tad a2ea(vs;t4aetoirctadom rau i;(0srtoio io4amen ies s)s2urx pno4tle  fciyt s2um(mo;() eeoxo3ia1fp r neo s  rurxmpiy4lmtelivsl(fs2rau pou1aex ioctadfsDrau o;(0tlxoxfcta1fp eaieol(  rxo(m3iy4amtelnet t)sruau ooo0teenioeiyd m ulnvs (0aexrmf3iytlaDeaies;(  exm(mpoo1lmt  fes s  2urxmpnt4tpt ii3tlsls2uau s (4trenmr iadfp e nvol()srxr(o iu4lpte fcsa(  2tm(mo;t4tex ifciytlsDelumo (0 lenio tytomD  ueo s0 rxmio iodap emfetas sDtru  ;o0apt  i3iadfsDul(ms;u0trenir3iotlptrlu s t0tetoirpiu1amt mfcias)srrmurpot4tltoioctydlm ua(msn(4 rxomoctodoat  nvo;t srum(mpny4apt mncsat)s2ua(moot0ale iieiadlm2ran s (0tlenir3oa1lpDranvi;s0trtrxmpoodlmte fctatfsDrr(r ;o1ape  ociadla emnmo () etnxf oytopt lnvs;s trurim ou1olte ieiasf Dumu p;o0apx mf3iydlsDemu onu0aeeoio3oo1fmt auvi;s  2xoio3ou4lmtelnvsl()s2tr(rpou1aptniieiadlmDrmu o;(4tetnxfctatla eln i;t)srtrir3oo1lleemieiasfarrm(  ;u0aleo fetytls ran s;u4aetnmo to1fptran s;s)teuriopnudlpte fvsl()arumx o;u1oetnmociltlm rl(mo;t0texnir3todoaDe iei t)tetrim iodamt  ivta(  rrmxmooo0ape ioetydlm rm( p u4arenifctotlmt an i ( teum(mpoo1alt lfeilt sDrrx  no4olt mfetldlm2uau sn()teerio oydlpDelies t seumxrpny1apeelfesatfarur(roou0olt mietatlsDra(ms;(4 rerio iotopD liei;t)sexrxm3iydlle  ieiat s2trum ;o4texo fcildls2umn ont) leoifcootlm rln o;t0 rtm(m3io4llt  fvias srumur ;u4tee ifetldfs ra(vpnt4 etoxrciotfp  aneol() rtrio oo4ap n ivil() rta(root0oetn ociyd s2rl(vp t) lerxr iatlptr u i t0setrxo ou4apeelicia()arumx  ou0aeenifciasfa2rluvs;t4aeeoifciodfm  livil()s2uo(r io1apenlnvi t sDum(rpou0tlenmi3ild sDel( s;t0arxrir3ty1fatelivsls)texo(o nydllt  icsl( srum(rpnt0texnio3ilsfs eaumon()texnmf oa1la e n slt)t2xm(m3nodlp e ivs t) rra(m ;t1olxo f3ildls2el(mpn()aexrxf oodfa   nvs;s  euoir ou1alenlnesasfsrtaxro;t4texoiicilsls emnvpn()tlxomr3ootlatranvi s0texo(o3iy4ape lnet ( a2tax o;t4ape  ieilt mDea(vs t0 eeoiociy1fatr uvolt setoio no4alenmfet ()aDta( pno1oetoif3ilsfa2rln s t4trtoxf todlaDr ieo;( s2xo(o nu4ole lfvt s)sDtm(roou0aet  ocild m2eaumsnu0aeenxfctadlmDr uvo s)srxrxo3ny4apeemiet sf rur(r no4opeo i3tasfsDel(vp;u)tleoxr iy1oatrlnes;s0 euo(m3nydopt lietl(faDtrx o;t1aeto fciasfaDumumont4tleoxrctadlpDrli sls0tetmxo nu4lmee nvsltfarrr(m nt4tlenii3iltlmDemu snt0 renxr3oadfmDe ivi;t)seuo(r oudlp nliet ( s2trx o;t1altnif3iltls ua(mp (0 rtrxoctadopt lnvo;( s2um(opio1opt livtl(faDra(  ;u4tptnioeiydfmDemnmon()teerifcta1omDeln sls)s2tmxo no4lpt  fvia()srum(mp;o1oltoiieiltfm em(vs;u)altnxf oodop e iei ( t2uoxopnodomenlncil( a2umxmp;u4tpe iociatfm ranvs u0 etnxf totopteau i () eto(r oo4apt  fcsl( arrm(  ou1tpxnmfctad sDrlnmp;t4aexrmrcoy1lmDrlnvils0texmxmpnodol nmnesa() 2trxmooo1oex  f3iysfsDumnvs;t) exnircto1fa eanvi t) 2uoxr io4op  mict t)a2rmxrpoo1alt mo3iaslm2emuvs;u0teenxrctotfp  lu ols) etoim iu1olee icia(f ruru  ;u4oex mictlt s rm(ms t)altrmfciatoa e nes;s)t2xrio ny1llee ietls aDtax onu0oet mo3tldfaDum(vonu0 renmo3tadfaDe nvils0 rtoxr3oodlm  lfetl(fa2ta(moou4opx iiciadla2ea(vo;t0tlenmr ootom ranvo;s0sexrxo oy1lm   feil(f 2tr(  nu1tptn feiasfs2umn p;(0tlxnifcootoa rai i s0 2trxr iu4ll emnetl( s2urxrpou1tlt mfeildls2ulu o;u0tlenio3tytlpDe ieil() rxrxmpnudlme  ieia(  rtmu pot1oee mo3ilslm2uan o t4trerio to1lm eanvo;s)srur(o io4aptn ics (  Dtmxro;t1ale  fciys aDrauvp (4 eeoxr ta1lmD  nei t) rur(r3io4opeemnesl()sDraurpou4oltnif3iadlm rlu sn()alxomr ty1lm e nesl(  rtoxr3nodllt liet (f Dua(  no1aleo oeiatfm um(vs;t)trxnmoctytfateaiei ( trum(mpny4aptn nvslt arrm(mo;t1oexnmieias mDuan o;(4 rxomo tatoatrai s t  etrxo3io4lmtnmici ( aDuau onu4aexnii3iyt m2elnvs;(4aetoxo3ia1oa r u ilt) etrxo nu1lm   ncta()aruaxronu4tpe iociytlm2raump;u0tetomr3tatlp r uvi s)sexmio3nudom e iesa() 2tauronu1tpxo i3tas a2rau p;(0 etnir3tatopDranvo ( t2urio iu4ol e feils)a2umxmoou0tex ii3tyt mDeanvpn(0 etrxf oydlptelnvs;t)srum(m nydlle mnctlt)sDtmumpnu1apxoioeiyt sDrlnvpnu4texrmr3iy1fate uesl()s2xrxopiydal elfvsl(  2trur ;o1opxnmoeiat m2em( o;u4trtomfcty1fp eln slt0teuoxr3ny1llee fctls  rrmu o;u0tet mi3iaslmDra(vo;t)alxnxf3iytlp eln s t srtm(o ou4lmenmnvs sf 2trx  ;t0tpxomo3iltlm2rl( p;(0 eenmfctodfa rauvol(0srxriopnu1ole  ictatf rua(  no0tex mociytls eln s t)artrxociytomtrlues s) rurxr oodlm   ncta(fsruau oot0oleomietldls el(ms;(0aeenmr oo1fm e ies;s srtm(r3oy4ame micslt)srtrx  no1altnmietldla2ulnmsn()alermf io1lp e uvolt) ruoir3no1al nlnvils a2ua( pou4aeto oeiadfs2emuvpn(4trxoifcty1la e ies (0 rurimpoodomtelfesasfsDrm(mp;u0tlxn fcilt a uau s;u) rxriocootom eaiei;t) etmxm3no4alt lnvias arurxr ;o4tpx mf3iytlaDeau p;u0tltnmrcootlaDrln s t)s2tmxr3nodop  lici ()arrau pou4aeeniieiysfmDrlnvs;u) lxoxf totopDr uvi;t t2umxr nudll elfct s)arrmu ooo1teto ictltfs rl(mo;u0trxoxrcoydopDe ueol()t2xr(m3io1apenlictas  2trxrp;o4tltn ociadfsDem(mo (0 renmocio1lm   uvo s0trxoimpoy4omt  neia()s2urxrp;t4oeenif3iasfaDrln p t0teermo iadfp  ai o () 2xoir oy1apt liet t aDraxm ;t0alt mo3ildfmDumnms u)teermr3ty1fa r uvi s trumirpou4olee fetlt  rtr(m ;t4ole mi3ilt aDrluvsnu4 eerif iytfpt aneo;(0setr(r oudole mfcia( aDrau  ot0tex  o3tls s2uau o ()tlxnmo iydfmDe u o;()t2to(m oy4lm nlivtat)sDrr(mono1alenif3tatfa2ra( snt)alxoifciodlptr uvs t)setmio3oy1ape  neia(faDra(  ou0texoiieiat aDrau o;()artomf3iotoa e ivi s) 2tm(opnydlmtemnvtl() 2tm( pno0tpe mfeiyd m ulums;()arxoifcto1fp rli s (0s2toim3iudlptemfcils)sDumu oot0aexomociadfa2ra(ms;t0 etrxfcta1lmDeanvil(0s2xr(o ou1olt  fetl() 2ur(mo;t1aexomf3iat m2elnvp;u0tltrmf3to1fptr i olt0texo(r nodol e nvsltfaDrr( ooo0opxo fctadfm rln p t4tetrmf iydfptean o;t0truoimpno4amen nvsa(f 2ururoot1tetoiieiysfa ulu o;()trxomr tatfm elneo s seuo(r3nu1omtnmivsls s2rau  ;t1apt  fcilsfs2uauvon(4 rtomocoo1fpt lnvs;(0 etoxmpiu4lpee nct (fsrrr(rpno4olenmociaslmDeanvpnt0tltomo3ia1omtraivils) 2xm(r oydlp nmfeils artm( ono0tpxnmf3tadla el(vs;t)trtoio3tatfmteanvslt)teur(mpnudop emfci t aDur(r ot1texnmi3tys a emu p t0 reomociatomDe ivi s s2xoxo io4alenmfvs s aDurx o;u0tlt miciyslm el(vp (0tltrifciodfatr n sl(0 exmxo iu1ap nmicslt sDumxr ;t1texomoeiat mDua( pn(0aexomr3ty1lmD anvo ()truoxmpoy1lm  mncslt  2rmxroot1tetn iciatfa2uanmpnu)altrmfcta1lateaneo (0 rumim3oy1alenlnviatfsruaur no4aptomietas a2emu p t)altomf tadoa eai o t  2umxm3iu1lptnmnvtas srtau  ot1tpxnioeiyt sDra(mo u)aexomrctadlm rau s (  2urir3nudll elfesls aDtm(rp;u1apx if3iyd sDrlu p;u0arxrirctadlat aiesl()truoxo3ou1lptemicsas  ruaur nu4oeeo fetlsfaDua(vs;() eerir3oydlp r uei;( s2xo(o io1lp nlicils a2urumo;t1oeeo o3tasls2ua(vonu)trenifcty1la ran ol() etm(mpnudal  lnvi t) 2trxm ou0tle  feiasfa2emump;t0tlenmrctotlpD auvi;( srtmxm ou4oleelicsa() Dua( pno4olxomoctad s2rluvp t)alxnxf iadlat lu sl(  rtoim nu4lleemnvtas sDrrx o;u4alx  o3ilsfs ulnmsn()aexrmo3iydlm  lueols) rxrxr nu1lpt mfcsl() rra(  ;u1aeto oeildfaDeau s;t0aexnir tatlmte nes;t) etrxr iy1lmeelicil( a2tmu pou4teenioctls sDean s t4tetrxr3oy1fpDranvo;(0setoxo3oo4apeeliet (fa2tmumo;u4tle mo3ils aDeauvo;() ltoircootlatranei;t0s2trxr oudopeemnvt t  rrax oot4alxnioeiasfa2ulumsnt4 rtnmr totomte uvil()srxmxopiodlpt  fciat) Dtrx  nu0tlenmicilslmDran pnt4teermr3tadomDr ueo;t0 rxoxr3iu4apt  fcta()s2rru pou1alx  o3iyd sDul( snt)altoxf3io
\ No newline at end of file
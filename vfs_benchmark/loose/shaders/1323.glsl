@@ -0,0 +1 @@
+u ilt0 2xo(rpiudll   neslt) rtmu  ;u4aetnmi3iysfm rmuvo;(4trxrmf iytlp eaivsls teuo(r oo1optn nei s)a2rax ono1oleo ociasfaDuan ont) renmr3oodlp eln s;t0texrxm3no4optn nvias)srrrurp;o4alxoiiciad a rm(mo ()aetoxociydfp e ivo (  exoir iu1lptnlieslsfs2tm( poo1tleomieiatls rmnvs;u)artnio iadopteli s;s0t2urxopno4lm n ieia(  Draxr ;t1tle mfetat a rlnmo;u4aeenmf3ia1oaDraneolt0teum(m iodal e fvs ()srta(  oo4aptnmociltfmDemnms;t0tlermf3iydfmD lneolt seuoio oy1ll e iesltfaDtm( pno4oetoiocias sDua( o t4trerir iatlp elneils0s2toxmpnydlmtnlfcsa(f 2ur( onu4apeomo3iytlaDumn on(0altnio3oytfmDelneo;t0t2triopoy1ameemicsl() Dtaxronu0tpt io3tat s2elu s u0 eeomr3ta1lateai sls texmio oydalen fcslsfsDumxrpou1aee  oeiydls ulnms () lxoxo oo1lmD auvo (0s2umxr iudolt lfciatfs2raxmpnt0openmoetas a ea( onu4 ltriocootomtr i s;t) rtmxopiodlp   nesl( a2urxmont4tetnmf3tydfa2ea(vs;t) etrmfciydlateau il()setmxopno4al e fvia(f rtrump;o0tlxoifctldfsDean ont4texnmocoytomDr iei;t0teum(o3nydamtn ivia(  Drmxmo;o0texnmoctadlmDemu p;u)tltoio ia1lm r uvs s0 rxmirpio1aleelietlt) Durxmpnt0aexn f3iys aDumuvs (4 exrif3iytlaD  u slt)texoim nodom emivs s a2trurp;t1oetn ictls a2rluvs u) rerxo3ty1lp   ies;s0s2xoirpiu4amt  ncslsfsDuaxmp;u1opxoiictldlmDrluvpnt4aeenxo totfp  aieolt)t2xm(o3oy4lme mfei sfaDum( o;u0apeo fetltls2ea(vp u0 exrif3io1lm rauvi t  2toimpnydam emncsa()a2raxrono4ale mi3iat a rlu o;t4trtoxr iy1fa elneils0 2xoxr3iudlmtn ncia(f 2tmxrpot4aeeo ieilsfmDea( on(4alenmoctydom eluvols srtoxopoo4am   nesasf Dta(r nu4texniieiytfs ea( snt0trtoxoctatfatr u s;()s2xrxo iydol   nci s) Dtax ooo4open f3tldfaDeauvsn(0 rxoxf3iatoaD  nes;t0 2toxo oo4lle mfcs t)s2ta( o;t0oex mocildls2rlnvs (0texrmf iotoatrlueolt0sexoimpno4olenlies t s2tr(  oo4oetn i3ilsls2ua(vpn()trxrxrciytlmtranesls)truo(r oy1lp emiesa()sDta(mo;t0oee mi3iatlaDrl(ms;t4areoxo3tytla  lieo ( t2trirpiu4apt miei t sDtax ooo4aeeo iciatfa2um( p;u0teenir3tatfm r ivo;t  exrxm iy4lm emicils)s2rmx o;t0opxo ociydfm2rln p (4alxomoctydoa eluei;s  rxm(r no1lm elfvsasfartmumpou1olen ociltfa2um( o;u4trxoxo tatlmtrau sls) rtmiopnodamenlnes (f 2rmumo;u1aptnif3iytfm um( o;t4aetomr3iytopDean s;s)t2toxr3io1open ici t aDraxm ot0aee  oeiadfa eluvsnt)arerirciodfmDran i t)s2to(opiy4lp e feils)s2uaxroou0aeeo icils s uluvo;t4aexnif3iydop ranvo;t)srurio3ou1lptemfcsls)a2rmxmpnt0oet  ietltfmDrl(vp t4 lenxr3ty1fm eanvsls0sruo(m3ou4opt liet t)srum(roou0alxnii3ils sDea(vo (4arxoir3todop r nvi;s)srxo(m3nydamt  icta() rta( p;u0ape if3iysfm ul(mo u0trtoxociotfpDeaueilt0 2xr(r3iu1ole lfes ( artm( pnt0tet  f3iasfm2elums t0 lxrio io1fmt  neolt  2umxmpoo1omen ici sfa2ta( onu0olto iciltfmDum(vp t)tetoio oatfpDrlnvo;t seto(mpiu1omtn ietat) 2urxro;u1aleomoetydls um(mp u) exnmfciytopDrauvs;(0s2trxmpny1omtelnvslt) rtax o;t1tpenmfciysfm2uanmp;() etrxo tydla eau s;(  2xr(opio4optnlnctat) 2urxmpoo1oeeomfctltlm2uanms;t0teeoiociy1op   ivs;(0sexmxo3iu1olt lfetl( aDrrxm no4tpx mo3ilt m eln o u)aeenxocoy1lm  li o s trumxmpnudllte fciltfs2um(  ot4olen fcildfs um(vs;(4tlxomf3oa1fp eln ils0srtoir3io1ll  lncs tf 2rax  ;u1teeo oeiat m raumsnt) rxnmf oa1lpDrluvi;()setrio iu1lp n ietl()sDrmxm nt1opxnii3tls mDumumo t0texomr oatlmtrluesls texm(m ou4am e ivta(  rtru ono0tlx moetltls uan snu) rtnmocto1fateauei s0s2uoio3oodomtelnei sfsDta( o;o4opx  o3iytls uanmsnu) exomr3ia1latr nes;s0 rto(rpno4am emfeia(  2rr(m ot0altoio3iytlaDeanmsn(0 leoxrcootomt  neo;(0 exmxm nodlmt lfcil()s2rmxronu4optomicilt a2eln s;u0tlerxo3tydlmtr uvo;( trxoxo nu1lme  nvi () Drax o;o4aleo i3iydfm ulumpnt)trtrxf3iytfm   uvi;t0sexmxm ou4am  lfcsl(fsDurum oo1opx micias sDeaums;t0 rxrmo iotop  luesl(0srtmirpoo4omenmfvsl( aDrrur ;u1apx  o3iytfm eau s;t4trtrmfctatlpt lnvilt)s2umio3iodopeemnvs (f Dum(mo;u0aptnmi3iys s em( onu4 rxomo3tatfmDr ivs;t0srur(r iy1lp elfeia()sDrru ont0oetomoetytfmDumnmsnu0teeomocoo1lpDean ol(  exm(o iu1olt lictlt)s2tmurp;o4apeo fetyslaDuau o;u)treoif ty1fmDeliei;t tetmirpoy1op   ncs sfaDrmuro;t1aeeo fciysfaDrlump t) lxoif3oadomte neilt0srurxm iu4op e nct s) rua(mpot0oexnio3tatlmDemnvs;()alenmrcoodom elu i;s0t2xrxrpiy4al nmncs sfarra(r ;t0altn o3tltls2emnms;t4 exnxocoatfm eluvs;(0s2to(opio4opeelivslt  2urx  ;o0oltn f3tad mDrm(mo;u0artrmocootlmD lu o;t  2urxm3oo1oltelfciltfsrur(  ot0altomi3iadfs2emumsnu0 eeoxo3tydfaDeaies;s s2uoir3nu1apte fct s) 2rm(mp;u1teenifeiyd aDelnvp;u) reoif iytopDeauesls)seto(rpio4ll nlfei ( sDumum ou0olenmi3ils mDeauvsnt0tltrmo iotop r u ol(0 rxoir iy4ap nmiesatf 2urump;o1ope  ocils mDrauvo t4 rtnmo3ootfmteluvolt0t2xoxr3nu1lpee ivilsfsrraum nt1tpenio3iys a ran s;t4aeenmfctadoaD livs;() euoim no1apt lfeia(fsrrruro;t4tpenmietysfsDul(ms;t)texrir ia1opt auei;t)sexrimpoydaltnlfcsatfsrta( o;u1opeo ietysla2eaumsn(0arxnif3oatlpD lneo;t)s2xoxmpnudlleemfcias arrrx  ;o4texnmf3iys sDean o t0 exnxociydom  anei;s)s2uoxmpoydlptemfeslt s2ur( poo0tpxo oetadlm uaump;t0 eermr iatfpt aivo;s0 2uoxmpoudlm n fcs sfs2raxmpoo0oexnifciysfsDuln s t0tltrmfcoo1lp eau olt0sexoxr3iy4lltemnetl(faDrr(r nt4tlxnmf3tydfa2umuvs;()tltniociadop r nvo;t setr(m3ou4ap emfct t srurxmpot4opxoif3iad sDul(vs ()tetnircta1op eau s (0t2xoxo3oodape mfei ( sDta(r oo0aex  f3ildlm2uanvp (4 lxnxocootomtrln s t0tetm(r oy4lm nmnctls srumxmo;o0tee mieiytfs2emumpnu4teerxr3iy1lpDelnes;t) euoxo oudol  lnvils)aDuaurpno4tlx  o3ilsla2ran pn(0tltnir3iy1fmD  uvols trxr(o3iodolee nes sf Durx pot4optn f3iydfs2eaumo;(0 lxnir3tadlmt lnes;s  2xrxm ny1lmeemfei ( srrmxmp;o0aptnioeiltls2uln o;t0 rtrxr3oodlmDr u i () rum(r nodam emnctltfsrtmur nu0ope  i3iytfm rmu s ()tlerio3iodfpDeaues (0 2tr(m no4lpe mfet sfsrrrxrpoo4oeenmfeiatlmDea( s t) reomf3totfpteauei s s2trxm3iu1lmtn nvilt arrmx p;t1oex mfciyd mDra(vs;(4 etomr3iadlm rlivo;t0srumxm oodlp  lfvt s) rumumoot4tet mictadlm2eln p;t0teerif3todla  aneols teuoxr oo1lmeelfcs tfsDuax p;t4tptn feiydls ulu o;t)teeoxr3oytlp raieo;s) rtoxmpou1aptelfctl(f rtr(root4tptniieiytfa um(mo;t) rxomrciytlate ieo;( sruo(o oydape licta(f Duaurpou0aptn o3tys s2eaumo;u0treoxfcty1lpDe uvo;s) exriopiy1lmen fvsasf 2rmurpot0tex mf3ilsla2um(mp;t4 etoxr3oodop eau i;t s2xm(r ny4ol nlietlsfsrurumoou1teenmfeiys s2eau p;(0arxnmo3tatfp rlnei;()trtm(m no4op e iet ()artmumoou1opto octlslm uaums t4 rxoifcoadlm eaivi s0srxo(rpoydal  lfcs tf rtm(  ot0aptoio3ildlsDum(ms;t) etnxr iy1fpDr nei;()s2urir nydal e nvils srta( p;o1tpt  ociat a rm(vo (0aexnmocoadfat li il(0tetrio iu1lle miei ( a2ra( pnu1opxo oeilslsDeanmp;(0 ltomrcoytlpD lnvi;( trxmimpiydlptemici sfs2rr( pno4tpt iictasfa2ra( p;t)tlermocto1omDrluei s0teuoir io4ap nlfet sfa2raur ;u4apxoif3iltfa ea(vs;t0 exnmfcoodlpDeln i (0teto(mpnodlmeelfvtls aDtr( oou0tlxomoctys s uluvpn(4 etomf3iytfa elivo t0t2uoxrpio4lptnlieslt s2rmur ot1tleo ietlsfa el( pnt) lerxfcoo1fptr nvols)trtr(r3iy1omtn ict sf rrrx pnt4ale mfeiasla2ra( pnt0 etnmrciotfmtrln ol(0 2xo(rpnodlmenmncs sfsrtaxr oo0apt  feiatls2umuvp;t0texrif iodopt lieo;(  rtr(r3io4om  lfvt t  Dtaxmpnt4altnio3ild m2rmn snu4artrxr iatlat liei (0 rtrxr ny4ope  icsls  rumxrp;t1olxoifcils a2ranms;()teermf io1omtranvo ()texoxr ny4lm n fesa( arta(mp;o1texnifeiydfmDeauvs (0 lerxocoatfptelu i s t2to(o nu1llt  neilt  Dta(m nt1oltnioctlsla ra(vo u0 lenxo tadfm  au s s)s2ur(opiydlle liviatfsrumxrpno4tet ifciydfsDelu ont4 rerif iodfptelu s t)truoxrpnydlpen fesatf 2trur ou1oet mociad s2ul(vs u)aetomo3iatfaDe ivs s0t2urxrpoydomee ncsasf rrmum ;t1aptoioctaslm2uanmp u4 ltrio tydfaDr n i;t seuo(m3iy1lmeelnct ()a2rax pnt1teeomociad mDuauvo;()tlxnxf3ty1oa eluvol( trxoir ny4lpeelfesasf Dtaxmpnt4apxomf3tadlm2umn s;u0 rtoxf oodfp raies;t0setmimpoudlpt lfvtl()a2ur(r oo4aeto fciad aDeaumsnt) ltrxrciodfat ai s s0 2to(o oodolee fetat) rurxront0olxomi3tldfm ranmo;t4aleoxo3oodlptranes;t) 2umxm3oudllenmfvsl( a2umx ont4alxn fciad mDulnmp t4aetoxo iadlmD  u olt  eum(m oudlmtnlfes sfa2taxmoou1tpt  ictad s2el(ms;()tlxoxfcoytfp ran ils srur(rpnu4am  mfvtlt  2rm( p;u0tpeoio3tyd a rl( sn(0aexrir oa1lm  luei t0sexmimpio4llenmivils s2rmx  ou0tlxoio3iltls emuvs t4aexnirciy1oa rau o t)s2xrir ny4om emfvtasfs2umu oou0tpt mieiadfa eluvp;u) ltrmf3oa1laD  n slt srumxm iu1opeelnesl( sDtaum ot0alenii3iyslsDrmu s;t0 rerxociodlp r nes;(0sexmxm3oo4op  lncsl(  2urxr nt4opxn o3iatls2um( o (4tlxnirciydoat lnes t  2xo(r oudopen ncs (f 2tm( p;t1aetniicildfsDemuvon(4 lermrcta1om   nvil(0 ruriopnodlm  mieilsf rta( o;u0tpx ii3tysfa uaumont)alxnircoodlp rln s ()s2umxr3iy1amt  ieil(fs2trxrp;t1tex miciadlsDem(mo;(0arxoir3iatlpD lieslt0 2tmim oy4lmenmfesat  Drrxrp;u1tpxnmoeiyt m uau s;(4tlenxo3iy1opt livi;s  eur(mpiydlptemivtat) 2ua( oou0tlenmocias a emu s;t4alxoxf totfaD aies;( srtrir3no1ol nlicil(f 2uaxmooo0olen i3ilslsDemn p t4 exrif3oytlp r ivsls0 rumxrpio1altelivilt  Dtmxro;t0tlt  icildlmDulnmont4arxrxo3oytlmtranesl( srtrxo io1om nlfvsas sDrmxrpot4opxnmfcilslm emumo;t)altoxr3totomD au o t  rtrio ny4omtnlfvtlt arua( pno1tpen f3iatfm2eaumsn(4 lenio3tytoa e nvo;(  2tr(m iy4aptnlnet s  rrm(m ;t0texnmoeils sDum(msnu)aeeoir ta1op  lnes;( sexoio ou4lltelfes s s2umx o;u1opt mf3ilsfaDea(mpnu4aeenifctydlpteau s ()teto(opno1lmt  fesat)arrr(  nt4tltnmo3ilt aDum( snt) etrxr totfm  lnvs;t)s2tmxopnudal n fvt tf 2taum nu1opt iieiytls2ra(vs (0 renif3iytomD aueolt)teumio iy4openmnvsls) 2uaumooo1optnio3ias s2rl( o (0 etrio3iy1lmt anvo s s2tr(m3ny1om  lfvsl(fsDra(  nu4oet mf3iatfa2ean p t)alenxr3ta1lmD anvo s0sruoio3oodol e nvi t  2rrur nt1tpeoiicild m eauvp ()aexrif ty1oa rlu i s seuoimpoy1opt lfesltfaDtrum nu0opxn octys a elnvs u)aetrxo3iotopDeau i (0 rtoirpiydlp n ivtls) 2urxro;o1altniictltlm2emnmpnu)alxnio3oadfpDeau sls0 2xriopoo4lle  nesat s2ururonu1apeomf3iytlm uauvs;(0 etoirciatlp e neo (0 rumio3oudlmtnmnvtat)aDur(r ot1tle ifeiytfsDrmnvpnu)treomrciatlmD livsls trxoxr no4oleelnvi t s2tm(mpnt4aexnmoeiydla ul(vsnu) ltomr3tadfm rlu il()t2trim3iy4amtemfcsa(fsDrmxro;o1tlxoiiciydla ea(vpn(0tlerif3io1lm rlivo;(0setrxr3no1om nlfcslsfsrrm( ont1teeoifeiyd m el(vs;() lxrir iotlm  lueils0setmxm3iydlpeemnet ( s2ur(r ot0tle if3ilslmDrmnvp t4arerir3tytfaDeaueo;( t2xoirpnu4amenlfvtas  rta(ront0aexnii3iltlm uln p ()tlxomo3iydfat  nes;t)s2tmirpnydop emnes (faDtrx o;t1opt mietld m rlnvs t)trxrif3iatlmDr u o;t) rur(o oydolen ncslsfs2taxrooo1altniieils aDul(vp (4 rerxf3totlm raneo;s) 2uo(opoodopt  fvt tf 2rau  ;u1tltnmiciatla2uauvs;t4alxnif ia1fp  ln s;(  2uriopiu4lm n nvilt) rrm(r ;u0ape ii3ias s em(msnt4 lermo oy1faDelu i s0srtrirpoodaltnlfvsa()arua(ro;t4apxnmieiyd m2raumon(0 etrxf3iadlmDeai sl(0teurirpnudll e ivi s a2tau  oo4altoiiciadfm elums;u0 rermr todfp rauvils) rur(o3oo4llte netatf rtmur ;t1tpenioeiadls2rlumo;t)tltoxf3iadlat aueo s)truo(m nu1alenmnes s sDtm(rpnu4olx  octadlm2ea( on(0artrxfctatfmDr nvi t0 2xm(mpiy1ope lnctlt a2rmx o;t0apxomiciasfaDrm(vonu)texnir oodlptr uvi t)s2xr(r nu1ome  icias a2ta(  no0aeenioeiytlaDraump u4alenif3oadlmDraieolt)srtoxopoodlm   ivt s)srum(  no1opxomiciat aDrl(ms (0 eeomf iydlpDr ieil(0srtrir3ou4omt mfcil()s2umumo;t0teeomo3iltfmDumnms (4 etoxocoodfp   nesls)t2trxm nydamtnlieiatf rumur ;t0tlxnioeiytlsDuan s () lxrxr3oo1latr ivs;( tetrirpiu4omenlfcsls)aDtmur no0tee mf3iadfs2rm(vsn(4 ltomf3ia1fa  li s t)t2tr(r3ny1ome  ies (fa2tr(mp;t4oexn o3iltfs umumsnu0 renmr oytlm  ln il() 2xmxopiy4lptelncsls)srtrur ;t1tlt  iciasfaDelnmp;u)tltomfcta1oaDraneo t truo(o3ou4al nmicta( srua(rpno4tpx moetaslaDrmums t4 rxnircoodlaDr u s;t) rumxo3iu4omtn nvta(fa2ta( pno1olen oetlslm rl( p u)tetrxr ootoa  anvols0t2urxo iu1lpe liviat)srtmu  ou4olen o3tldls raumpn(0aeenir iodfaD  iesl( trtmxr nu1omee ivt sfs2ra(mpnu4texnmoetadla ea(monu) rtrxo oy1lpD luvs s)trumim3oo1ll   fei (f 2tm( pnt1teenmiciadla2rlu snt4texnxr oatlpD lu sls0trtrio nodlpt  iviasf rua(  nt4tptomfciatlsDem(vo;()arxnmo3iy1la e n o (  ruoxm iy1apen neta(faDrmxm oo0tee  o3iltlaDemn snu4tetoio ootlpDeaivi () ruoxo oo4op   ics (fa2um(r oo4ole iictydfs rau s t4aeenif ta1lp  luvo;s)sexmir3iu1om nmnvt s)a2tr(r ;u0tpt mi3ilsfm ul(mp;u4 rtoircootomD lneo;t trxrim3iy4ape  iciat s2rr(r nt0tleomoetls sDuauvont0 eeoxocoadfa  aies t0s2umir3nydop n ncsl( srumur ot0aeeo fciad m2ulumpn(0 ltrmr3oatfmtranvils0s2toiopio4olte ivs sfsDtmxmpot0oet  f3iadfm ea(mpn(4aeenmr ty1fp rauei () etrim ou1amtemneil( s2tmxronu4olt  ictld mDrm(vo u0alxrxr tytoa e nei;( s2to(r3oo1amtemnes ( s2umurp;u0oet ifciadfa2eauvp;(4aeeoio3ta1oa rau i;()trxmxopiy4amenlivslt)aDumxmono4opxomfctlsfs2ua( onu0 lxnirctydfaDeaies;()t2to(r3oudllenmicsls) rtmu o;u1tpx  ocildlsDrlumon()alermo3tytoat  i i;( teumio3io1llt micia( sDrrxmpnt0opt mietld mDrmnvo (4arxnmocoy1lateai o;t  exoimpio4apt miesls sDumx  ot4olxn ociltfm um(vo ()alerxf todoat  neo;s trxm(o io4apeemnvil()sDtmu o;t1apx  ociydfaDrauvo u4texrxfcoatoa eaivo t seumxo iu4lpt mnvsat)a2rr(rpot1optnifeiytfm uaump (0tleoir3oy1lpteli i s srurirpno1altnmivil(  Dtmxr ;o4oltnifetlsfs ea(mpnu4 etnif3tytlmDe nvs t0 ruoim3iy1ol emivta(f rrmxmp;t1oex  o3iatfs2ea(vpnt4tlenxrcoatfateau o s0s2xr(mpio4omtelicias aDumum ;u4alx  i3iyt aDrl(mp u0 leoir todlm  lneslt0 rumim nudape  feslt)srrax p;t4apxomfetas mDrmump;t4tetrxociotom eauvsl()sexrxopnudaltn net s) 2rmx  ;o1tle  ieiatlm ranvo t0 exrxociy1oa e nes;( s2trim3oodopeeliesat sruaxrpot4oexnifeiytfa2rl(vont4aetomrcia1lateauvol(0 2uoxm iodap  mfvsat)arur(rp;u0oeto o3ilt m rl( p u4alxoxo3ty1fa   n i;s0t2um(rpnydoptnlncsls) Dum(moou0olxoif3iytfa rlnvp;u4arxrxf oy1fpteanvsl()s2ur(o3iu4ome  ieias a2trxmo;t1tleo icilsls2uaumo;u0 lxnmo ootlate n i;(0trxo(opnu1omt lnvsat)aDrmu ono1texomfeiltfmDul( o t0 etoir tatop e n i;()s2xmxrpiu4ome  fvtl()a2rr(rpnu1tpxnifctatfsDeauvpnu) lenmr oy1fp e ueils0 etmirpoo4am  lfeils) rtax p;o1openiietysls2uln p u0aeermf3oo1faDean o;s sruoxo oo4opt mnvtl( a2tmxm ot0tpenio3tat s um(vs;(0tlermo iytlmtraues;s) 2xr(m ny1oleemivsl(f 2rrxmoou4tleo oeiadls2elu pnu)alerxocoa1op   uvi;()teurimpoydale lieiatfs2ururo;u4tetoiieiytfaDrlumo;u)aleomocia1latr u sl(  exriopio1ol n fci t  rurum ;u1aeenifeildla2em( o;t4aetoir3oo1lmt  i s s0teuoim oo4lltemivsls)a2tmuroou4alto ietasfsDelnms ()texnir3ootoaD luvslt)s2um(m3oy1amte nes ()sDtrx p;t4tltnmictys a2um(vsnt)tetoxocto1omDr i s (0s2toxopnodaltelneia()aDuaurpot4olxomi3iys sDulums t0 reoifcoa1fa rliesl(0teumio oodapte fetl(f Dumump;t0apx  ictld m ua(vo t4tlxnmr3iodfpD ai sl() 2tm(r3oy1lpt mfeiat a2ra(  ;u0tlxomfeiytls2em( p u0trxomrcoadfaDeanvi (  2umxm3ny1al e nei t  Dtmxr ;t0oet io3tlsls raumsnu0 etomf3iotlmD au ols) rtm(m3ou4lp nmfvias aDrmx ooo4apxo feilsfa ean p (4 lxoxr3to1fat aivil(  rtrxr nu1aleelnci tfs2raump;o4texoio3tydlm ulu s;t4artoxr3oadlmD auesls) etoirpiy4olt mneta()srurxrpno1ale io3iasfs2ul(ms;(4altoxf3iodfpteaieo ()s2urxr3oy4omenmict (  Drrxr nu4optomfeilt a rlu s () exrxocoy1fpt lnvol(  2uoirpnudame  nvs t)arrmx pno4teeo fciadfmDrm(vsnu4trenmr oydlpDelueolt0texm(o3ny1op nmneta( srta(r ;o0altn fctadla rlu s t4texoif iotfat  nvs;t) 2urim3nodalt lfetls s2ur(rp;o0tpxoifeildls rmu sn(4 rxrif oy1lmtranei;t  2tm(r3ou1lp elfciltfarrrur nu1olt ifeiyslsDra(ms;()tetrirctydfp eanvo;() 2trxopno4lltemnetls aDtm(mo;t1optnmfciat m2ul(mp (0trerxrciy1fp  lnvi ()s2xmimpiu4optnmfvs s) 2rm(  ;t4oeenmiciytfs ulump;u0trtomf tadfmD lnvo;s  eumio3oodolte icsl( arrax ooo4tetomoetat m ean s t0 ltrmr oo1fmtrlneo;()trumxr3iu4altelivi t)aDtr(r ;u0tlenif3iyslm2ran o;t)aeermr iydlptr i i;t0s2toir oodape mfvsl()aDtrxmoou1opto icilsfs2rmu s (4 lxnmocta1fmD an i;s)t2xr(o3nydaptnlnet t sDtauro;t0opt moetatlaDeanvonu)aleoircoytomDr ueo;t)srxmxr3no1amt lics ()artrxmono4aptniiciysfs2uanmo (4altrxr3tadlpte i i s0setmimpnodll emnesasf 2raxr ;t4texoio3tlsfsDem( s;u0arenmf3tytlpDeauvo;(  rurio3ny4oleemneslsf Dtmuronu4aeto fetat sDelnvont)trenmo3ta1omD  nvolt  exo(mpou4alenlietls artaump;u1opxo i3iyt sDrmu s u)trxnxf3totfp elneo t0t2ur(o3oydoptnmies (  2tax o;t0olt moeiys aDuanmo (0aexoifciydlatrauei;()srxr(m iu1ap  mfetl( s2uauro;u0tlto f3iysfs2ea(mo () ltoir3totlpt anes;s)trtm(o oy4lmtnlfet (fartmum oo1apxnii3iysfsDelnvo;t0 rxoxo3oytlmDeanvo t0tetrio oudapenmfci s) 2tmu pou1aetnifciad m eln snt0arenmf3oydlmD  ueo s0sexmimpnudap emfei s)artmumooo4aet mieils m2rlnvpnu)teeomf3iadfm  luvslt  2xo(o oydomen ictas) ruau pou0aet  ocilsfmDumnmp u0trtnmrcoa1opD lu sl(0s2toxo3nodapee nci s  rua(mooo0aet iocild sDrln p u) rxomo3oo1fpDe ies () rumxm iu1apen icsatf rrrxm no0olxomo3iadfs rm(vpnu4altoxfctodfa eln i t setmimpio1lmtelivtatfsrum(m oo0tpe mf3tasfs2el(vp;t) renmf3totfpDeaivi;(0 rxo(r3iu4lmtnmnei t)sDraxrp;u4tptoioeiysfa uaumsnt0alxrmf3tadlm eaivo;s)seur(m iu1lpee nvtat)s2ra(mp;o1tpxomi3ildlm2eanvp;u0aetnir3iadfmDeln slt)trxr(rpiudalenlicsas  Dtru oot0opt mociysfm2uaumsnt4tlxrmr ta1la raues () 2xmxr no4lmtn ictat)arrrump;t4alen fciyd sDrmnmp;u4 lxnxr3iotoa rlivo;t) eurxmpoodame lnvsl()artru oot4oeenii3iydfmDemnvs;(0 ltomr3oatfpteli sls)sexr(m nu1ape  iet ()srumumo;u4tlxnmocils s ua( o t)trtomr3totfmDr uvo t)sexmir3iy4ap   nvia(fsrumxr oo4olx iieiytlmDumnvonu)arenxr oatlpDraies s0sexoio3nudaltnlfvslsfa2raxrpnu1oee ioeiltfm emumsnt0aetrmf iytfptrln ols  etoim iodlp n nctltfa2rrxmo;t0aeto feiasla um(ms t0tltrifciy1fpt anvsls0teto(o3oo1am nlfeta(fs2uaxrp;t4alenio3tys aDuauvs ()aexnif3tydlmDe ivs t trxmiopiu4lmenlnvsl( srtru  ;o1tex  o3tltfmDua(vpnt4 rtoxfciotfptelieo t  etoxo ny4lm nlivilsfartaxmo;u0aet  fciasfa uanvpn(4trtnmf iodlpDelu i (0trurxo ny1amtemfct ()artmx p;u1texomietldfa2umnvon() eenmfctadomDr nvol()trtm(mpny1lp   fvtls  2tau ont0ape  octas a2emuvsn()aetoxociotfa r ieo;s)sexrim iodolt miei tfs2uru  ;u0tpeo icilt mDumuvp;t0alenxo ootfmDe iesl(  rtrxo3iu4lpeemncsls arumurpno4alxoifeiad aDum(vs t0tlxoir oodfp eln s;t  2trxmpiu4openmfvsat) rrrxroou0texnif3tytfs2umumon(4 reomr ootoat livolt) ruoxr no1lm   ict tf Drmxrp;o1apenmi3iadla2uln p u4tlxrir3ootfateauvo (0s2toimpnydaptn fctas sDtaurp;o4tpx mo3tytlmDemnvs ()aleomr3iotfmtrli i;t0srxoxm3oy1omeelfcils)artrxrooo1tpenmi3ils aDrlnvo u0trtnmf3iydlm ean i;t)s2xoio nydap elfvsas aruaxrp;u4teeomieiatfa2ean snu4texoxo3iodfmD liesl(0 rtrxr oydalt lfcs t)srtrxmpoo1alenii3ildlmDea(vs (0 ltrif3oadomDe u il()t2tmxr3ou1omtnlfvtl(fa2rm(mp;u0aet mi3iytfs2uluvo (0aeerio ootopt anvs s0srum(mpou1lltemivia()artmum ;u1opt mfciydfm ulumo;(0artoxo tytlatean ol(  etm(r ny4lmee iesltfaDrr(ronu4tee iociadla emn p u0 exoxr oydlmteln i s setoio3no4ap e iesl()a2uax  nt4tpeomfciyd s uaums u) etoxrciadla rli s s srxoxr3iudomeemnvt t) rrrxmpot0ole mo3tyd s2el(vsnt)tlxomo3ia1lpt lnei ( tetrxopny4lm n ncta(  2umxrooo0oleomi3iyt a2um( sn(0tlenmf3ta1lp eaiei ()s2toio iy1ap   ieta()a2uru  ot4oltomo3ils a2emnmp t)tetnio io1om  au i ()setrio3iudalenmfciat s2umx o;o0oeeniocilsfmDeanms t4 rtrxf totla   uvo;( srxrir3iydopt mfci s)a2umum ;t4aetnmi3iytfm2uanmpnt0 etnxr iydlpte iei;t)truo(opoy4opte ivs tfs2trxmo;o4alxn ieiasfsDranmpnt4tlxoxrcoydla r nvi t)sexmim ou1lp emfci sfsDrmxmont4ale mfciydfa2rlnvp;() lerxf3ia1fp  auvs () 2urxo3iu4ol  lfctls  rta(rpno4oet  iciasfa2eanvont4areomf3iatfa  aueo;(  eurxr ny4ap n fvsat)a2rrxmoot4oltnmiciydfm2uau sn(0aetrmf3totlmDr nesls0tetrio oy4lm n ieiat  Dtax pno4opt iictltlsDrlumsn() ltnio ootfmD aivs ()tetoxrpiodomee nvsas s2ta(roou4opto ocild s2ea(mp;(0 ltnif oydop raieo;t0 eto(o iy1lpenmics t sDrm( pnu1tee  feiytfs ua(vo;u4 leoiocoadomtr ivi t) rtoxopoodllte iciasfs2rm(mpou1apxniictydfm eauvp;u)trxnmrciytomt aueilt)setrxm3ny4lltemnvtas aDtr(  ;u4opt iictld a emnmp (0 lxnxf3iadlm  lneols)s2to(rpiydlmenlfesl(fsDtaum ou4tlxn ieild a rm( pnu0aeenxf oytomD  uvol()s2urir iy4lle lfvtlt s2raxrpou1apenif3iadlmDranvpn(4arerxrctytop raivi;s)s2trio oy4opt lics (fa2taxmpoo4tlenmicilt s ra( p;t4arenir3oatopD  neilt)t2um(o3iydlp  mfesatfartmxrpot4oex ifetltfa2ulu s;(0arxrif iatopteanvo t srxoxm3oydlpe mfvt sfs2rm(monu0opxomietlsfs2elnms t) lxnifctodfaD  i ils truoxr ny1ole  nesas)a2truroot4apxn i3ias aDuan sn(0trtnifcoa1fp  aueo t trum(m oydomenmivsl(f Drm(m ;u1optnmfcildlsDrlump () ltnio iydoatr nes t)t2umir3iy4lp emfviat srrmx oou4aeenmfetasfs uluvsnt) ltnxrciodlm  li o t trxr(opiy4olee nvsas srrmurpot4opx  i3iyd aDumnmp u4 ltrmrcia1oaDrlu i;t0sruo(r no1lltnmnvsls aDurxm nu1tpx  oeiydfs rlumon()tltomo iydlmD  ieilt)setrxopiu4optemncs s  rra( pnt1aet mfctatls rau ont)arxoif3iy1omt lueo ()tetmimpno4op nlictl(farur( ont4tltomieilsla2ul(ms u0trenxfcta1fm   u ol( s2xm(m3nu1lpenlnetlt) Draxmoot1aet mieiytfsDrluvs;() rtrmo iatoptr uvi s)sexm(opiy4ole livsl()sDtr(mont4apx  fciat mDumuvonu0 exnmo oodlpDraieolt)srxm(m3no1lmenlfvi t sDtaxrpou0tpe mo3iasfa2rlnvsn(4 lxrxfcoy1lm  aieils0s2uoir iy4olt  feta(fs2umump;u0olx iociaslaDuan o u)alxnxf3tydoa elnei t t2uo(m no4ap e fvt (fa2rr(m ;t0oeto o3iytfaDrm(mpnt4areoxfcto1om r i ilt  rxm(mpnu1altelietl(fa2tru  ;o0tetnioetaslm2ua(ms;t) lxrio tytop ran i () exo(r oy1am elicia()s2rmxronu0tee ioeiltfm rm( s t4 etnxrctytfpt livolt)trtmxr3oydamenmicilt) rrrxr ot1oee mfeiytfsDran p (0aexrmociadoa r nvs t0 2tmimpiu1apeelnvi ()aDtm(monu4tpxo oeias mDel(ms u)trenmrctadlpD aieo s0sexo(opiydop nlfeilsfsDrau p;u0tpt  ictatfmDrmnvpnu0artnxf3tadlatraieo;( seur(r oy1altelfeilt  rurx  ou4optoio3tatlm umnvs t4alenir3iytlptran s t0 2xmiopoy1lm  mfeia(faDurumo;u1tpxnmo3tas m rln o t0 rtrmo iotoat  ues t0 rxoxm oydap nmfeilsfsDum(m ;u4oexo feildls2eanmpn(4altnmocootlmDr neolt  eumio iydlmeemfes tf 2ua( pnt4oeenii3tysls rlnmp (4 rxnmf iytla raivil( tetoxr oodol   neilt s2taumont1altnii3tat m rlums t)trxoxf3oodomDeluvo;s  2tm(rpou1lp n iei sfsDtau pot0aexniictatlmDranmp;(0 lxomocoytopD anes s  ruoir iy1lltnmfvt t a2rmum ;o0tee  o3tytfs2ul( s u) lenxo iodlmt aivi;()truoirpnudop  lnvs t  Dtrump;u4olen f3iatls2el(mpnt4 eerirciydlmte nes;t s2trxrpou1lpee ncsltfsDtru p;u4oet  feiad sDea(mo () etrmrciy1fatr ivils  exmim ny4ap elies s)arurum ;u0oetn feias a rlump;(4alxoirciotomte nei s0setrxo3no4amt mnvtl(fa2rrxmpnu4optomo3iatfsDrau on() lermf3todfp  livi;t)s2xmxopnudol nmnctat s2rru poo1opt ioetytlm2rm(vs;t4 rxrxr3oodlateauvs;s  rtrxm3nudal n nvtlt sDuaxmpou4tetoif3ild a2eln o;u)texrxrcia1fa  ln ils  euo(r3nydaptnlnetl(fa2ua( p;t4tlto oetatfa el( pnt0alxrir oo1latrln il(  etm(opoodam  lnvsasf rrmurpno0tleniietltlm2emumpnu0arxoxr3oa1omt luvs ( t2um(o iodameelfviasfs2tauronu0tee mocilt aDulumpn(4arerir oatopDrlueo ()srtm(mpoo4lpe mivtlt sDuaxmpnt4tpxnmf3ildlmDel(mp;(0 etnir ia1fatr u o t)trumio nydop  lnetasfa2rauro;t0oleo octyt s2em(vp ()teenifciydoateauvs ()teuo(rpiy4optelfcs ( s2uaxr oo0apxnmociydfa2um( s;u)artoir3oytopD  ivi ( seuoio oo4lm emnvtlt a2tmxm nu0tlt  ociltfaDulnvp (4 rtrifcoo1optraivs t0tetm(opoy4aleemneiltfs2urumoot1tltnioeiadla rmuvpnu4 lermr3tatlm r ivi;t trxoxm nodomeeliei t s2rmxro;t1aeeo f3ilt mDrlnmo;(4tlxoxfcoydfpDeln sl() exm(rpno1ll nmicsltf 2ururooo4aexnmfeild s2em(mo (0tltrir oy1fp elueo;t)seuoxr3ny4am  mnvi ( aDrmxrpou0teeoiieiys sDean pn()teenmfcoa1la eliesl(0 2trim ou1lme mfcs t) 2umuroou1tpxn ieiys a rauvs u0arxomfciodlmt  nvsl() rto(o3oudlltelncsltfs2ur(m nt1opto fctasls ra(vonu4tlermfcoodlm rlnes (0s2xoxmpnodlp  miciat) 2raxronu4tleniociat sDemu o;t0 lenif3iytlat lu i;t0 rtrxopiu4lptemneiatfarrax  nu1tpt ifctysfsDumnvp;t)alxrmfctadla r i sls trtr(rpnudap   fcsls)a2rm(r ;u0aet iociadfs raump;u4 lxnxr3oa1lpte ues;( trurio3ou4lleelivilt srtru ooo4alxomf3iad a2rmn s t4aexrxocia1lpDraivilt)sexo(rpoo1ll  lnvi sf 2ta(ro;t4aex mfeildfs2uaumo;() exomr iydlptraivo s seur(opiu1alee nct ( srumumonu4olenmictldlmDeln p ()tlxrirciy1lp  aivo () etoxr3ny4apenlfctatfa2rmxrpoo0oetniieildla2uaums u)areoxo3oa1fptr u ols0s2uo(mpoudop n ivt tfa2tr( oot0teeo ietasfm uluvo u)aetrxocoodoat lnes;()t2uo(m oodolt lneia()aDtmumoot4apxo i3tls s rl(vo;() lxomf3to1op eliei t0 rtoio3iodlm  mncia(fartrxm oo0apeoiictadfa2rmums (0 lerir oatfa e nvslt srtmxo oo4omt mfci (fa2ua(rpno4altoiicild s2rl(vo;(0aeenmrctytlpD ln il()texo(o iodomt livta() 2uax oot4tpx iociysla2rmuvo ()arerxocoy1oaD  n i t  exm(o io4omenmneias s2urx  nu0opt ii3ildlm2ranmp ()trxriocoa1lm  aueo;()trxrio oy1omt mfvsa()arrm(  nu4tpxniocild s um(vo t)tlermo oadlmte n o;t0texmio iydapt lict (  rtrurono4tee mociad sDemnmsn(0 eerirctatlmDelnvols) 2umio3io1apt  nviltfsrtaumpnu0oeto fctadfaDrlnms u4 eeoxf3oytfaDeluei;s)t2tmxopiu4open nvt ( sDurxrpot4ole moeias mDrl( pn(0tetrmr iodlp  aues;s)t2xm(m iy1omenlivi t srur(mo;u4tlto feildls um( s u4areoxr3ia1fp rlnvo s0trtrim3nydal   ietas) 2tau ono4optomfctatfaDrm( s (0tltrxo3ia1lm r neolt seuoio ny4llt licia(f Drmxm oo1aetn o3iyslm rln s (0aetnmr3oodlm   ieo;t)s2trio oo1ap emfctat aDtaxm ;t1tlxnmictltlsDrl(vpnt0artomo tadop eau i t t2xo(m3iu1lltn ics (fsrumx ono4tee ifeilt mDulums (4aetnif3tytfate ivslt)trtoxmpou1omtnliei s arrrxmoot1tetniiciasfm umu s u4 eenxo3ty1fpteli ilt)teum(r iodamtnmfeias)a2ur(rono0apx ifctadls eau o;(0 etnirctodlpt ln o;(  2trim nodal e ivi s s2raxmpnu4tex if3iltfa emumsnt0alenircoa1omDrli o (0 eum(r no1amt mietl()artmxro;u1alxnmfctydfaDeau p ()arermrcoydoaDr ieils s2uo(o3nydamt  ncsasf ruauro;u1tex  ieiatls2rlumo;(0teeoirctatoa   i ilt  exoxm nudlle mfci (f 2rmumoot0tet ifeiad s2ulnms ()texomo iy1lpDrlu i;s  eurio io1ll nmfctlt)sDrru pnt1oexniociltla2rln p t0tetrir iotoptranesl()srur(m iydlp elicils) rumxr ;t0aeeo fctltls2emumpnu) lxnmo iytfmDr uvo ( trumio3io1alt mietls)sDta(  ot4opx mieiys a emnmsn(0trxoxo3totomtean olt0trtrxo nu4optnmieil(f 2tru oou1tltoif3ias a2ea(monu0 lenir ta1fp  au slt s2toxo3oudapen feta(fartmumono4olxniiciad m2ua(mp;t4altnmo3tydoateaueol(0 ruoxr ou1ameelncs s)a2tr(ront0opxniicilslsDeanmo;u4tetriociydom r uvo t0t2umim3oo4lpt  fet tf 2urxr ;o0aleo ictytlm2ul(vont4trenxfcty1oaDrlneslt0s2uoxm3io1olee fetl(fsDrauroot1alxn i3tatlm2uln p ()arerxr3oydla  aieil()trtr(o3iodlp elnesl(f 2rr(  nt1tle  i3ilsfa2uanmpnu)arxnifctydomt  ieil(  2um(r nu1ll elfeta()a2tau p;u1tet mictytfm eln o (4tltoxf3iytfa  li o s)t2trxmpoy1apt mics s)a2rr(r ot0oex  iciysla ua(vp u)trxoxo3oo1lp raivsls  eurir oudameemivtl(fsrtru oot0olxomoeiat m rau sn(4trtrircoadomtr i o t trtm(r3iudlmen fet s) 2rrxmo;u1tltnmf3iyt mDeluvp t4tltrxrcta1omtrln o;()trumxrpio1lle micslsf 2umu pnt4olxomoeiydfa2rmnvs u)alenxf ia1lp rau sl(0t2tr(o no1lpen nvi (  2uaxmpnt0tptnioeiatfs elnmon(4alerif iotfp  ln s s s2umim nydapee fcs t) Dtmx poo4tetnioetaslm2ranvp u) ltrxf iodopDe uvs s) rumxr3ny1lm  mfvtas)srtau o;t0texnio3iatfsDelu o;t0altoiociotlpD  uvi;t trtoiopiodam nmnetls)a2ra(rono0apxomictas m ran snt0 ltoxr iy1fp eln sls0t2xmim3io4amen fcsas  ruaxr no4olenmoetatlm2ua(mp;t4 leoxr tadfaDean o s0seuoxm nu4aptnlnvtasf 2rr( pou0tlxniociltla2rauvo;(4 exoio iodoa e ivo;s  rxoim3nu1llt mnviatfa2rrxm nu1tetn i3ildlmDrm(vs;(0alxnmocta1opt aivo;(  rumxm oodol emnvs t s2uaxr ;u0alxoioeiasfs2el( p () eermfctotlm  livsl( s2umir3no1omtn ncs sf rtrx pnt4aeeo ietatfs2el(msn(4arxoxo3iy1op rauvil(  etmiopou4lleemivsatf rrr(mp;u4aeto octyt s2uaump;u4artnxoctatlm eau o;t)srxr(m oydam nmnetas aDtrx  ot4apen oeiadfm em(mp u)tleoif totopDeaivsls0 exmir3oy4op n fctlt)aDta( o;o1tet ioeiyt sDuln o t0 lxrif3oadoaDrauvs (  2xo(opiy4op   nvta( s2rrxrp;u4oex  ociytls ean o u0 lxnxf3todla e ueo s0truoir iy4ll  lfetlt aDua(mo;o0aeeomociat a rm(vo;t0 lxnmrciodfaDe ueol(0srtrxm3iydam emncs tfarurx pot4oeenifeiyt mDelu pn(0arxoio tatop   ivs s srtm(o3iydlmtn ivilt) Durxroou1ale  fctlsls uln p t0areoxf3iotlmDran i;s setmxr3ny1altemfctat sDua(  ot4olxn fetldfs2uanvpn(4trxnmo3oatlmteli olt) rtmxm nydlleelfvsls s2rrxmono0oetnmfeiat s2eanmsnt4 eerir3iodlpDelnvi (0trtoiopnydlpeelietls)aDumxmp;u1tpe iicils sDrlump u0artoio io1lptrln i;( t2xoxr oo1optnlneilt) rrrur nu4aetn fctlsfa elnmsnu4aetnxo3todlmtraneo;(0trumxopiu4omen ieils sDra(mpnt4tleomietyd m2ran p;u4 ltomfcio1lateaivi;s0 2xoxo oudaltnlicia()a2ta(mo;t0ole io3iysls ulnvo;u0artnmo oatoaD luvilt0trum(o3nydap n net s) 2tr( p;o0open i3iydfsDua(msnu)aetrircta1omte u il( truoxo3iy1apenlneslsfa2taum ;o4tleoiociadfa2um(vs u)tlxrmr3ta1la r ies s  eur(m oo1llte nei s s2uax  oo0opx if3iat m2rauvo;(4trxnmocia1lpDr nvil(0t2uoirpou1optelivias arraum ;u4tlx  ieiyd m ulnmsn(0alerxo tatoa e ivo t0tetm(r iudaltemfvia(fsrtrxrpnu0oltoiieiltfmDumuvsn(4arxnmocoodfpD  ivol()trxrxrpoy4ll elneia(faDtaumo;u1tpxn i3ias s ea( s (4aexrif tadlaDrai o s0setoio no1apenlfvtat)a2umumpno4apx ii3iasfmDulu s;u4tlxoxr3iotop rln i;s0tetoimpiu1lle  fctlt)artmurpou1apeomieils s2ran on(0teeomrctatfaDran o t0s2trirpnydal  mneta( srta(mont4aee iicias s rmn pnt)artoif3oydomtean i s)t2tmimpiu1lme lfviltfs2raxmoot0oeeoifeild m2um(ms;u0trenif oytlm  auvs;() rtoxm io1olenlnvs tf rum(moou0tet  i3tat m rl(vs;u0arxnxf ia1late ueolt0 rxrxmpoy1lpte iei t)artmurpnt1tleomoeild aDrauvon()aetnmocta1opD lneilt0 rxoxrpny4amt lncsat)srrmxmoou1olx iieiyd a umu o;t4 ltriociodfpt  u ols  rxmim3iy4aptnliet s aDra(mpno1tltoiieiat a ul(mo u4texnxrciodfpDe nvols0t2trxrpiu4apt lfcslt aDrmu  ;o4tpeomocils a eluvpnt4 etnmocio1fat aivil(  rtm(m3ou1lm emnvtlt) 2urx p;t1tpenmieilslaDua( pnu4 rtrxociy1fptr u o;(  2xmim3nydlm  mncils aDtaurp;t1opeoii3tltlm2eauvsnt)altnmf totomteli s;t0 ruoxr3iodoltn fcsls) 2ra(m ou4apeomi3ildfa2rl( pn(0aeerxo3oytopDr n s;t0 eurxr nu1aptemnes t)sDurxm oo4teeomi3iytlaDem(vp (4trenxocta1lp   u s;t0sruoxr3ny1alt lictatfsDrm(m ;t1aex  feiys aDemnmsnu4 rxoio3iytoaD ln i ()setmxrpoudlm elfesl( sDumxm nt0teenmicilt a2ea(mo u0 lxoio io1lmDrlivilt) etoirpoo4aptnmnet sfsrua(mo;t1tex  fetld s2rlu pnt4 ltoio tytlat  nei s) rxmxopny1olee ivtas)a2tru o;t0aet mf3tls sDemu s;(4tetrxo totfaDr n o s)srxrimpny4ale mfei t  Durx pou0texomo3tadfsDuau s t0 lxrmrciodfp  li s t)teuo(o3ou4op  lfvt ( s2rmx  ;t0oleoifetyslsDrlums;(4 leoiociadoat lnvs () rumxo iodlp  miet t) Durx ont0aee  oeiydla rlump;t)arenmfctodfm ean i (0sexm(r3ny1ap nlfvs () Dtmu ont4tle ioeils aDemu ont0aetnio ootopDelnvs;t  etoimpnu4al n fcsltfaDrrxrp;t0tlxn ieiysfa ran pnu)aexrir3oa1lateln s;t s2xrxm ou1lmeelneias)a2tr(moou1tetnmfeilslm emu pn(0tlxnmr todoa e nesls srtoxo3nydalte ieia() rrm(r oo0tpt ii3iys m elu p;t0 exoxo3tadfaDr i il(0s2xm(r3ny4lp emnesasfarur(m nu1opx mfciad s2el(vs u4artniociydfpte uvils0srxoio nydop elicsa(  2ra(ronu0tleniiciadfaDrmumsn(0trxriocoodlmt lnvol( t2toxrpny4om elnes () Dtmu pou1tpe ifciltfa2umumonu) etnmf oadoaDran s t) exoirpoydome lnvi t sDtm(mpoo0tleoio3ils a uaump;u)artrmfciytopDrau sl(0s2xrio3iy4aleelfes sfarta(moot1oet mietysls2ua(vonu0 rtrmf iadom rlneo s)seurxo oy1op e ivil() rum(ronu0oetomicilsls rlumon(0 ltrmr3ty1omDr neol(  2uoxmpiu4ol  mivil( aDtrx oou0tpxoiiciysfm2uluvont)altoxf3iadfaDe n o;s0truoiopio4omtelivtas)s2tm(  no1oetnii3iytfs umump t) eerxf3ootfpt lueil()truoxm3nu1ole  ici (  rua( p;t4oeeo ietysfa2rl( o;u4alxriocoy1la e nvs () eumir3nodameelncs (fsDum(mp;t1alx mfeiasfa eluvp u)tltrif3oo1fatrlnvilt  eumxmpnodomt lfcils aDrrxr nt0optniieiaslaDem(ms;(4artnxo iytomtrlu o t0seur(rpny4lmt lnctl() Drru pnt4oeeomociadfm2rlnmsnt0artrmf oo1oaDe u s t)setmiopno4lmee nvi (  2rrx  ;t4tpx ifciadfsDua(vpnt)arxnmr tydfptrau i;t0setoim3iy4al e nctat)sDtmx poo4olt io3tydfa rmnvont)teenxfctytopDe nvs s)s2urirpoo4alt miei (fs2tmu oou4alxnifeild sDrlnvsn(0altoifctydfpt ai olt0 2tr(r3ny1opt  nci s)arrax ont1tle ioeilsfs2el( s t4 lerif ootomtrau ols  exrim oy1omte fcsls)s2ur(mp;o0opt if3iat aDelu p;(0trxnmfctadlmtrau s;t0s2xriopiy1lm   icsa(fs2ua(mo;o1tetnmo3iydfs ea( pn() rtrxo oatlpD  ivils) euoir iu1lmte nvi t srumxr ou0tltnioetlt m2rlums t4 reoir3tydoaDrlneo;s)trur(opny1amt lnei ()a2um(moot4oetomiciasls2rauvp;t0trenif3tydfpt livi;()sexr(rpou1lptn ncta(f ruau pou1tpxniiciatfs ulu s;t0 leomf3ia1faDrli i t0srto(r3oo1op elicil( sDrrum nt0aee iociaslsDrau o t0tetnmoctodlmDe i sls0srxm(m iy1lltnlivtl( s2tru  ;t0aee miciytlm2um( ont4 exrxoctodfmt lnvolt srtm(r3oy4oltnlicsltf 2umxronu0olto oetlt mDum( sn(4areomf3oydlp   nvi t t2trxm3ou4lmtnmiet ( a2ta( pou4tpeomf3iytlsDrl( snu)altomr3tatlaDr neols0trxr(o3io4lle  ivta(faDraxmo;o1teto ieiad s ua( pn(0aetomr tytoa elnvi;(0s2xoir nudlm emfctat)a2rmxr no4olxomiciat m2rmu pn() exnmf3oo1opDelivsl(0 2trxm oydam nlnvt ( a2umx  ou0tee ifeilsfs emnmp u) rtrifcoy1omteau i s0teuoir iy4lleemivta()s2raumpnt0tlxnmiciadlmDuanvs t0tltrif3iytlaD  uesls) ruoim nudlm e fvsl( aDrm( o;u0oltoif3tat aDul(ms;t4 ltnio iadfp elivi;()trurirpoo1am   nvsl( srurxr ;o0opxomf3iyt aDrlnmonu)tlxrir oydlpt  ieils)teur(m3iy4omt mnei ( a2tm(  ot0teeomieild a elnvp;u0trtrmr ia1faDeluesls s2triopio4lpt mnetltf rtmur oo1aet  o3iadls ranmsn(0teeoxr3iatomtrli sls0 rxoxr3io1oltelfvtas  Dra(  nu0tpx moeilslaDea(mo;t4 exoiociydlaDr iei s s2toiopnu1amtn nvt sfs2uaxrpot0tptnmfciltls2rmnvs u0trxrxr iy1fp elivolt)trtr(mpiydaptemfeilt a2trurp;u0tptnioeiasfmDuaumo t4 lxoiocoatoaDrlu s s  rumxr nudomtnlfesls)aDuauroot4oee mi3tas sDem(vs t4 rtoxrctodlm   u s t tetm(rpno1llt lfvs t)sDtrxmpoo0opxnmieiyt m ua(mo;t4teerir3ta1fmDraivsls  2xmimpnudapt lncia(  2rm( o;t1tpeomo3iydla ulu pn(4tetrircoydopDrai i;s)s2um(o iu4lmeelfviat a2um(m ;u1altniictld m um(vp t0aleoxr tadlaDraivo;t)teur(o nu4lmtemneil() 2ra(r ;t0oetnmo3tadfa2umn p u)aexoxf iydlp  ln il( teur(opnodll nmnvs ( sDra( oou1altnmi3tas mDul( pnt) ltomfcoo1opDeli s;( teur(m3nu4am nmivsat)a2umxmp;o0tpxnmi3tatlsDul(vs;(0tetnxo oy1lmD  nei;s) 2umim nu4amtelieiasfs2uaxrp;t1alen o3tasfa um(mpnt0tlxoxo tatoaD  n o ()tetr(o3ny1lp   fvtas  2ua( p;u1tlt if3tlslsDrluvs (4 leoxo3iytomDrln i;s  rxrxo3iu4llee fesltfartmuro;t1opxnmo3ilslsDemuvs ()arxomfcty1latrlues;t) rtm(m3ny1op  mnvs t)arta(rpou1ale moeildlsDeaumonu)alermrcty1fa rlivo t0trumir3ny4op   icsa( a2rm(  ot0tleoio3iyt m2eln ont)trtoxo3io1lpD aieol( teumxm no4apt mfes t a2uru  ;o4tlt  oetlt mDum( s u0aexrmf3oy1lm r u o;t)seuoirpny1lme  nctatfsDrru p;u4tltomietat mDulnmp;t)tetnmf iotlmt  ivo;(  2trirpoudlltn fct s) 2umuront4ale miciydlm eluvsnt)altrmf oo1lmDe ueolt0 eumio nodlme  ict tf Duaxronu0oexnif3iat s rm(ms (4arermrctodomtean ilt0srxr(m3iy4ole mnvi ( a2trxro;o0ale  o3iyslm ra( s u4aleomo tatfa  li o ( srxrxr io4ape lnvi s)a2tmur ou4oexo i3tatfs2ulumo t)teeoxo3iadlmDr nvi;s  rtmxm3nu1ap elnes ()arrmu oou0oltnmocilsfm2ranmp;u) rxnxf3iotomtraivol(0 2toir oo4ame  iesat) 2rauront4opeo feiltfm2eau p;() reomr3oo1omDr uvilt0s2to(o io4opee ivi () 2ra(mooo1teen f3tyslm umn p u4aetoxfcoytlp ranes;t)s2umio iu4llenlfcsas s2umxr ;u1aexo feiytfm2eln snt)tlxnxrcoytlpDelieilt srxm(r no1lle mieta(farrau  nu0tpxnifctydlaDranmont) rxoio3totlatranvo;t) 2uriopiydoleelncs sfaDtm(  ;o0aeen oeiys a2rauvp () eeomf3oadfatelu i;t)seumxr nu4lm e netltfaDta(  ot1opeomoetld m uanvsnu)aetrxr to1opt liei;s s2uoxm3oo4oltemiciltfsrum(mont1apxomieiytlm2rl(vs;()trxoiociadlpDraieo t0tetr(r3ny1lmenmiesatfa2um(  oo1alxnioeildfs rau p;(0aexnir3oadlpDrai i s0srum(opoy1om nmnet s arta(monu1tpto ociys sDel(msn(4 exnirciydomte nes;t  exrxo3io4lp e ivi ()s2uaxmoou0olenio3tadla ra(vp t4trenmoctotlateaues;s)teur(o nu1ol  licia( a2ta(mp;o1tpen f3ias mDranvo;(0 ltoiocoo1fm eau s t0teuo(r3io4om e fesatfsrtax p;t0tlxoiieildfa rluvsn(4arerir3tytfpDe uesl()teumxo iu1lltemies sfs2umu  ;o0apxomi3iysfm rlump;(0 eenxo ia1fateauvsl(0 euoxopiudaptnmneia(fa2urx  nt4oltoifeiltfmDrlu p;u0tlxomrcia1om eauvo t  rum(r nydapeelneias)arta(m ot4apxnmo3tatfsDuau o;t0alxrxf ty1op eau s t  2urxr ny1lpenmivsa() 2rmumpno0aeenioetlt mDuan snu)artoio tatoat aues;t srtrim ou4lp nlnciatfaDtrum oo1tpxo fctyd a2eau snu0tlerir iy1lp e i olt t2toio3ny4opt  fetat a2tau  ou0apxnii3iadla eanmpnt0tltomo ootlaDrau i;(  eumxm3nudom nlivtl() rrm(mo;t1tlxo fctadlm ra( o;u)alxrmo3tatop eaieo (0trtmimpnu4al elieia( a2urxrpou1alxnmfetls s2ra( o u)teeoir oadomtr u s s texmxmpoy4apenlivs tf 2ua(rp;u1tpxomociydfm emnvs;(4 lxomo3oodfmD au ols  2ur(m3iydlme  fcs tfsDurxmpot4alt  iciyslsDeau s;u)alxomoctadoatrli s;s)truoxr3nu4llenlnvs (f Duax ont1aet  ictatfm el(vp t0tlerxr tytfmt lieslt0 eumio3iy4op  mnvta(  Dra(rooo4aexniiciadla2rmnvo t)aexrif ia1lp eai s;s  etoxm3iu4llenmncil() rtrumpnu4apxnii3ildlm2ran sn(0 renxo3oatomDraneolt)sexoxo3iydapen fvi t  Dtaxrpnt0apxn fctat m ul(vo u)trxrio3iy1omtranvo;()t2tmim io4olen nvsas) 2tm(m nu1aleoiiciytla elnvsn(0tlxnio3oy1fptr u i ( tetr(o3iydop  mneia(faruaxmoot0tltoiicild s uanvo u4treoio3iatfptraueols)s2uoir3ou4ole  ncils)srtr( o;o4aetnmfetltls eau s;()treoxrciydfa e ieolt)s2xoirpoydap e ivs ()a2trxrp;u4tleomocildfa2um(vpnu) etnif oo1lmte nvo;t0s2xrim iydolee nes s arumxrooo0olxo oetltfs rm(mo;()artrio oydlmt  iei (  euoim nu4ope mnvta() 2raurp;o1tpeoiietas aDea(mo;t0altnmo3iodomD anvs s sexmiopoydolt lfci s)artrx  ;u4tee  ociyd s raums ()t
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;(0teum(o iu4ol  lfeils sDrm(  nu0aleoiiciydfa eanvpn(4tltoxo to1laDeanes t) 2urim3no1om  mfei s  Drrum ot4aleoifeiydlmDul( p ()aetnxr ia1la  aneo;s)t2xoir nodomtnmicslt s2rax o;o4opx miciltfaDemumo t)tltnioctatfp e u o ( t2tmxmpnydlpe  ncslsf Dta( pnu1tle mictld a emnmpnu)aexnio3ty1fmDe u o ()s2toxmpiodape  fvsat) Durxmpoo4oexn oeildfsDumu snu0texrmr oatomDr uvo ( s2xrio3io1ol nmfet s  Drrx o;u1opxnifetys s ea(vs;u)tetrxrciydoa  lnei t t2xoim ny1om n ivslt srrrxr no0oex mfeiyt s uan p;(0trenxr3oydoaD lu olt0 etoxo io4olt livi t aDrrxr ou1aetomfeias aDrm( onu0 rtnxoctatfp  lues ( trtmxopio4lm n fcsa( a2uau  nu1oltn fctadlm ulu s;u4tlxniociodfm elnvi;(  etmxrpio1lpe  nci sfa2rrumpnt0alxnmoeiyd s umn snt)aeerif to1lmt lueols srto(mpoydam emictl( srtmx  no4alt iocilt m um(vpnu0aexnif ty1fptrlivsls0t2trirpnu4al  lnesasfa2rr( p;o1apenioetydfs2rmuvo t0trtnmr tydopt an sl()t2xoirpiydalenlies (fs2trx pot4oeeo iciasfm2emn s;u4trxomfciotfm rluvi;s0t2xoxo3iy1al nmfvsl()arrrxro;t0aleoifcias s eluvp t)alenxocoatlmDrai ils0 rxo(o oo4lmt lfet t)aDrmur ;u0alto i3iyt mDean p;u0teenxrcoy1fp ran i;s) exm(r3oudolt mnvs t) Dua(r ot0tlt  iciydlsDuanmo ()aexoir3iodomtrlneslt seto(r3iu4ap n ici t  2urxrpot0ale if3iltfa elu p t)aexrmo ty1op eau olt0t2toir3iu1ap   ivtas a2tmumo;o0teenmictad s uanvonu0aleniocootfm   ies s0 2tmiopiydlmtnlnvt s  2urxr ;u0opxo ietadls2eaump t)texoio3todfmtelu s;(  2xoirpnodop  mfeia()a2rmxronu4tptn f3tld s ea(vs ()tlerif ia1lm eaueol(0srxoxo oo1om nlfeiat sDtru  ;u0alx  ictaslm um(vsnu)tlxrmr3iodoaDeanvslt  exrxr iy4ap elnvsatf 2uru  nt1tlenioetas a rmu pnt0trtomf oy1lm r iei;t)trurxopnodllenmncias arrax  ;t1olen octadfs el(mo;(4 ltoxocoytfp rlu ilt0 2umxo3no4ll   ietlt) 2rm(  nt1tpe iictas aDem(vp u)tltomocoo1opteaueols0 2urim oo1lme  ietlt) 2urxrpoo1tpen oetydfaDelnvo;()tlxnir io1lpDrauvsl()s2tmir3io4lmenlnet sfsDua(rpoo1opxn ictlt mDel( s (0aetrifctotla elnvs s  2toir3iu1ll  mnctas s2umxm nu0tpx mf3iatfmDul(vo;(0 exnxfcoa1fm r i o;( setmir3no1ol e feils  2uaxm ot0tpx ifcilsla uaump u4tltnirctytoaDr ieols)t2uoxopoydolenmfviat) rra(ronu1alt  fctltfs2uauvs u4arxnxf ia1oaDraneo t t2to(m iydome mneia(farrm(  nu4aeeniieiys aDra(mp t4teeomf iydlmDr i s t s2xo(m nu1lp  mnvilsf Dra(r ;o1tpeomoetldla2eanvo (4 etomo oo1fp rluvs;(0 eurir oo1lltnmfvtltfaDurx poo0aee moeiad mDel( s;u4artomr ta1oa  lieils)teuo(o nydomee ieia()a2urur no1teeo oeildlm2umnmsn(0trtoxo3oydopDrlnvilt0 2urirpoy4ap n feil(fsrurxr no4apen o3tatfsDua(ms t)alermrciytlptrlieo;t0srxmxo3iy1op nlfcs ()srrru  ot1alxnmfeiltfa em(mo t)tlxrmfcta1laDeai s;() 2tm(r3io4opte icsl(f Draxmp;o4aex ifeiyt m umumsnt)aexomo ta1fate n o t  exmxrpiy1omeelfcta()a2rau pou0aptomo3iltfs2el(ms (4 ltnxrciydlptr nvilt  rur(r3oo1oltn nvilt) Draxr ;t0olt  ieias sDea( p;u)altoif oytfp ean s s0seuoir3nydalt lfct () 2uru poo4alx iietldfaDranmsn(0trtomf tytoa rlu o;s0tetmxopno1ole mnviat) Drmxr ;o0aeeo o3ias aDel(von(4 rxnmr to1om r n s;()texoir oo1ap nlfesls  Duru pnu1ole if3iyt aDulnvs ()texrmo todlptelu ilt  2toxrpou1altnlici tf rtru  ;t0apenmo3tatlm rlnvonu0tltoxr3oa1opDeaivol(0 rxr(r3ou1openmivsat) 2tm(  no0oetniicias s2ua(mo;(4trxnxf todoat lnvs;s)setm(mpiudlltemncs tf rraxr no1oleomietyd m2rm(vpn(0alxrir oo1fmtrai i (0 2to(opiu1lmenlict t  2urx o;u0oee mociyt a2eanmont0 leoxociadopt  uvs t)srtrxrpny4lmtemneia(  2umu o;t0opx mfctad mDra( snu)areomfcoy1fptr ieils) rxmirpno1oltelnciltfarrr(mp;t0aexnio3iys m emumo u)arxrxf tydlaDe n il(0texoxr iu4olee fvs () rtm(m ;o0oeto f3tys s el(mont4trerxr3ootlpD auei ( t2urxm ny4lpenlieta(fsDua(moou4opx ioeiyd sDel(vs u)alenxf3totfmtrauei;t setr(m3oo1ap nlies s)aDuru pou4opxoioetaslaDua(vsnu)arxnir oy1fptranei t0 etmxopou1opt  iei t a2tmump;t4apx mf3tlt m rmnvp ()tlenxociodoat  i s;t t2umxm3ou4omt liesls)s2tm(r oo1tpx  i3iltlaDrlumo;() etoxocoo1opteanvils0seuoiopnudlmtemncs ( a2rm(rp;t1tptnioeildfa emn s u4 lerir3ootlpte uvolt t2urxopiu1al  lnvsls aDumu  ;t1apx  icias mDua(vpnu4teerxr totfat  u s;s0 ruoimpnodam e netls sDurur ot0ale  i3tlsfs2rmums;(4 exoir iydom  livs t0 exoxo3ny1ap   ietl(fs2umurp;t4tltnioeiytls2umnvo t) rxnif3ta1lpt luei t)setrimpou1aleelfeiatf rrr(moot4aex mi3tytfa2rmums;(0arxrxr oydoatr n olt0tetoim oydapeemicil()s2ua(  ;o4apeo octasfs2ranmsnu4trxnmr3tydfatr nvil() rurxrpnudaltnmnct ()srrrumooo4olxnioeiad aDrm(vsn(4 etoxr to1fm rlivi;s  rum(o3io1llt lncils) 2uru poo4ole  ociadlm rm(von(0 eeoir3oydlate uvo;()t2xo(opiy4lm nlfvta(fsDtrxroou1olt  i3iyt m eln s t4tetrmf tadfmDrauvo s)sruoxr3oodolt mfetat s2tmurpoo1tet  o3iyd s2rmumpnt0tlerxo3io1fpDe nes s) 2ur(r3nydolenmfci ( a2rru ont1oexo fciysfaDuau p;t4aeerircoodoptr uvsls0 exoxr iodlm  lfviat)s2uru  nu0tpeomo3iltls2em(vs u) lerxfcoatfptelues;s0srtrirpiodamt mfci t sDurxmpot1oltomi3iyt m2ra(mp;u4altnifcty1opDrlu il(0tetmxrpnodomenmfvilt  Durxr ot4tle  f3ils s2ulumpnt0teeoxo iatoa  ln o;t  rxoio iu4am emfesat)aruru  ;u1oeeomo3iatfa2elumo;(0 rtoxf io1omtr nes ( trur(o3oy4ole lfei tfsDra(rp;u0tpe  ietytfa ua(vs;()alxoif3oodfpt li ol() 2xo(o3ny1lle mies tfs2rrx  ot1opt ii3tldfmDumn o;t)altrxr tadfp rlivols0 eumim3oydolen fciasfarrrumpou1aptnifeildfmDean s t)alxrirciydoa  lneslt)srumim3ou1omenmfcias  Drru pnt0olx ii3tysla rmnvp;(0aetnio3iy1opDe ivi t0 exoxrpoudameelnct (  Dtmu pnu1oltoii3tltfsDulu o t0 rxriociydop ran o t)s2xr(r3iudaltnmfci ( aDrruro;t4apeo iciytfsDrmnvp (0arxrxocoatom rau i (0 2xmxo iy4optnlfesatf 2tr( ooo1apxnmf3iytls2rmn pnu4tleomr ta1omD  n ilt0seumim3oo4om n nci t  rumxm ;u1tee mieiasfsDrlumsnt)tlxoir io1fmt lneo s teurimpnu1ole  net t)srtax o;o1oee  fctys sDumnvon(0 leoirciadfpt  i i;(0 rxoxm3ny4alte ics tfaDrmxr ;t1altomf3tyt sDrmu s t4treoxr oatlmD  ies s trxriopiy1opee fcias  Dra(  nt4oee mo3tldfa2uan s;u)trermfctadoat lnvs;s srxmiopou4omt miei t srtax  ;t0tlen fciytls2emu ont0teermr iatfm r uvil()texoio nudomtnlieslt)a2uax pnu1tetnmfeiadlmDelumsn() exrmfctydla rauvslt0t2xm(rpiydomtnlics (fsDrr(r no4tptomi3tlt aDrluvs;(0 lxrio3iatlp elnvil(0 2uo(o3iodlmenlies tf 2rr(m ou1tpen iciad s ul(mp t4 rxoir iodfmte neo t setm(o3oo1optnlnci s)artaxr ot0oeeo ociltlm2umuvs;u0 eenmrcta1op e i i t0t2tr(rpnudol  mfvsat) 2rax pno0olxn feilsfa2ra(vp (0arxrxf ty1laD  ivi;t)t2umxo3iy4llt lfvias a2ur( poo1ale mfeildlaDra(vont0alxnxo oytfm  ai olt0t2ur(r3ny1apt lfvi tfs2ururp;o4oexnmo3iytla2rmnvo;()trtnmo tatfpt li s;()s2urxo3ny4alee icsas  Drrumo;o1aexnmf3iltfaDulu on(0tetrif totomD lneo;s0texmio3ny4ale  icslt  rtmu ono1tetomfciys mDem( s;t0 ltnxf to1fate u ils0teumim3oodop  liesas srrrur ot1opxoifetaslmDrl(vp;u)tlenio oy1opte uvol( s2toxr3nu1alen fci ()aDrrxmoot0alx ioctydla2ra( s;u0aexnxfcoydfpD  ies;t0t2xr(mpiy1ome lictl( s2trum ou0tlxnmoeild mDem(mp;t0 rtrmf3io1fpt auvolt)s2toim3oudamtnlfvsas)sDtru o;o4oleomfctatlm2ranvo;u0tetomr tatop eaivs t setoir oydomtnlfvsa()s2raurp;u0aexn feiytfm2rln pnu4 lxnxrctotfp r ivi;()setr(o3ny4lleemics ( aDua( p;o4ape  i3iytlm emumsn() lermfcia1faD  ivs;()texoio oy1omenlfct (fsrtaxr ou0tee  oeiytla2um( p;(0alenifctatfpDeln i (  2xoio3nodom nlnvtas)aDtrxm no4altnmfeiltfs em( p;u0tlenmo3iatoaDe n s;s0trxrxo iy4omtelncslt)s2umu  ;t4tpe mf3ild m uanvs;t)tlxoirciadfm ranvils srxo(m3ny4omtemnct t)arta(ront0tlto o3taslsDelnmo;t)tlxrir3iydlp   uvo;(0 ruo(o3ou4ll n nvslt s2um( ont4tpx io3iltfaDrl(mp;t)altoiociy1op eln il()srxoirpiodalen ivs () 2uaump;o0alx  i3tys a ulumpn(4tlxoxf3oatoa  anvo;t)setrxr3iy4omen fvi sf rtrx onu1tpen iciytla ulnvp;t0treomr ootfptr i ols  2uoio nu4ome lncta( s2taur oo4opeoii3iadla2rlu p () ltomr iotlmD luvi t0srxoio3oudopeemieiasfs2tmxrpot1teeomociasfmDem(mo;() ltoifcoadfpt aieo;(0t2to(m nodaleemieil()s2rr(monu1alxnifctysls elu s u0tlxoif ta1lptranvols teur(r iy1om e fvs t)srrrump;t1ope if3ildfaDrmnvs u4teenxrcoatopteai s;()srurir no1ole  nesa(fs2tm( pnt1aexoioeiasfs2elumo;t0arermo iydfp ranvols) euoxopio1ape micsls  rta( oou4tlxoif3iasfmDumu p;t4artrio3ia1om eaivs;t s2trimpou4al emnct t) Dra(ro;o0opto f3iadlaDem(mp (4altoifcoo1lmDeli ilt)s2xrxo3iydop  lnetl( aDuru  nu0aet  oetydfs2emuvpnt) eermf3todop rlneo () rurimpny4lp nlncsat arrmum no0tet  oetad a2ran s u) ltnio3iadom ranes;s)s2xoxmpoy4omenmies (  2ra(ronu4oet  fciaslsDrl( o (0alenmr to1lat  ues;(0trtrim oydoleelnvils sDtmxrpou0tptnii3iytfs rlu s u4tltnxo ootlatraueo (  rxr(o ou4olenlnes s  ruaum ;u1oltoifctyd sDelnmp;t4tltoxociydopt  n s s0 2trirpiy4omtnmnvta(faDta(mo;u0tpeo ieiatfm2rlnvonu) eeomrcoodfmt ai o;t)trtrxr3oy1opeelnctlt srrm(  no0tlxo f3ildlsDemnmo ()aexrxfcio1lat anvo ( sexoir io1ome mnvias)srtr(  oo4oet ii3iltfm eaumsnu) ltrmrcia1latr ivils)s2tm(m oodolenliesat)aDumurp;o0tleomf3tat m2umnvs;()tlxnxociydoateluvs;(0s2xoxm3oy4lm elfvil(faDtr(rpnu1apeoif3iytlmDuanvp u0 reoxocootfp  ln sl(  euoiopnu4omtemivs tfsrrrx p;o4ale iocildfa2emumpnt)tltrmfcio1latelu o;t texrxmpnodlmeemics (  rumx ooo0teeoii3iadlm uan pnu0altrxrctydlpt ln olt0 2xrio3iu1op   fvtat aDrru o;o0altomociad m ul(vo u0tetrmr3tatopte nvo;( t2uo(opiodapee iet t) 2ta(mont4texnmi3iltlsDraumo () exnircoy1faDe n o s)t2toio iy1ap  livsa()aDrmu o;u4opxomfctls mDelu pnu)tlxoif oo1lp  liei (0setrir oo1omeelics s)sDraurpou4aeto fctadlmDrau o;u0tetnmf iatopDraueo s0seumimpiu4lmenlfesltfa2rmum ;u0apen f3ildls2umn on()alxoif3oadfm   nei s0 rxmir3io1openmieia(f rumx pnu4ole ifciyt mDrlnmp (0trtnxf ootlp eauesls)trtmxopny1lmtn fcsas) rurxr ou0ape  f3ilslm2umn p u4 rxoifciatopt lneils s2urxr oy1lmtelfes t)sDuau ooo4tetnif3ias s2rlnmont)aleniocoydlaDeaieilt)srtrir nu1open nvtat)aDurur nu0openmfctad sDrmuvp;t0tlermrciatfp  lues t  rtm(o nu4alte ncta() Draurpno1texnmoetyslmDea(ms;(0 lxnmf3totopDr i ol()texmxr oudale lfesltf Durxmp;u1tlx moetas m umn onu0aexnmo3oadlm   ivi;t  rxmim3nudamtnlieiatfa2um(monu1tpto f3ils a2ulu s t0 rtrmo tadlaDeluvs t  exo(mpiu1am  mfctlt)arra( ont0aee  o3tysfm rluvs;(0aetnxf3oo1fa r neil( t2xmimpou1openmivia(f Duau  ot1tpeoioetatfaDeaumon(4 ltrif iodom rau i s0 rtrir3ou4apt mfvsat) Dtmumonu0openiocildlm eaumo u4 rxrircia1opteaueslt)s2toxr ny4lmt mietls artru pot4oexn oeils a2umnmp (0trtnio3ootlmDrlies () rtr(opno1op emnvsas)a2trumont0apxo ocild mDrmums;u4 lenio oatop r iei s0 2toimpno4alenmneiasf Drr(  nt4opx iieiadlmDemn o u0tltoxociydfpte ueo t tetoxm3nu4oleemfesls srua(mp;t0tle iociys sDelnmpn(0 eenif oy1opD ai o;( sexrio3io4olt lnvi sfarraumpnt0olxo ictad aDrmu sn(4 exrxo oytomD ai s t  rtmxopoudalenlnvs tf 2taxr oo4oet mo3iyslm2elnmon(4aetriociadfpDrlueo s seurir3oudomt lfciat  rurxmpot4oleo iciadfa ulump;(4aexrmr3io1late uvo;s  rxrir ou4ame liei (fsrtrumoot0tlxn feiytfa rln p;(0tltrxf3oy1fmte ivo ( seuo(opiydlmenlncia()srrr( pou0oexnmo3iyt m2ul(vp;(4altoir iodlmD  ieo t0 rurxmpiydlle  ncilsf rurur ;t0olenioctlsfa2rlump u) eermrctytfm r nes ( t2xoxo ou1op elfvi (fa2uax  ;o4ope  i3ilsfm2ra(vonu0aexoxf3iotfmteauvolt0sruoio3oudll nlnesltfs2tau  ;o4oexomfetlt mDelnmpn() etrio3ta1laDeanvi s  etmxo3oy4al  mnetl() 2rr(r no1oetniietyd s emuvs;u) lxomfcio1lm r i o t0s2tm(m3iudal  miesl(fa2umurpnt1olxnmiciasla elnmon(0 reomrctatfmtrlnvi s0 exrxo io1apte fesl()s2tmxr ;t0apen o3iasla2ranmon(4 ltoxr tydfptrln s t t2xoxrpoudapenlfcsl(f Dum(  ou4oex  feiys m2rauvo;(4tleriocoadomt  ivo;s0trxmxopnu1apen nvta(f 2ua( pnu0optnio3ils s uanmo u) renio3oa1oaD lnvo t) etrxm oo1omenlieil()s2ra(m ;o4oexo o3ias s emnmo;t) exrxrcoytfatrai s t setmirpoy4om e fctas  Dtrumont4oleomfeildfa eln p t4alxrif iodfp elnvs;s0srurim oo4amt  fct () 2rru oou0alxnifciyt s ua(mo t4 etoxoctotom raivi;s t2xmimpnodap emnetls)sDrmum nu1oexomf3tys m eaumpn(0arenio3to1lm elu s;s t2xoxm ny1ap e ieilt  rtmxro;u1oleomoeiad s2umnvp u4teerifcoy1opt  ieilt) exoxrpiu1lltnlnesas) rua( ooo1apx  oetyt a2ranmo u4alxoio3oy1fpte n ils  rtoxr iy1optelfvt s sDuax pnu4aexomfeiad m2rluvs (0trtrirctytfpteanvo;t)srxm(mpny1olt lfvsa(fa2tr( oou1optnii3ildfa2rl(vpn() leoif oodfmDe uvsl(0srxoio3ny1amee ict sf Dtmxro;t1ape iieiytlaDea(mont0 rtnif3iadfaDeluvils trto(mpoo1lp   neiltfsDrmumpot0alxnmieiyd s eanmsnt4 exomo oadfa rlneslt0 euoim nu4amt mivt tfa2rr(monu4tpt io3iadlmDrl(vpnu4tlxomr3oodfaDrlies;t0 rxo(rpiydopte ncia( sDrm(mp;u0aexn o3iyt m um(vp u0 renio iy1fmD au i;t0t2xrxmpiodal n fvt s) 2uaxm ou4aeeomieild m rlump t4tltnmr oy1omD luvilt  rxoxrpoy4lm  lfvi tfs2tm( pno0aeeoifciytfaDelnvs;t4texoio3oatlptrli ol(0 rxmimpiydllenlncilsfa2rm(mp;o4optniieiyd s2ea(vs;t4arenmrctydfmD aueo ( srxrir3nudlmtelnvi t)aDtru ooo1tpxoifeiadlm el(mont0tltrmo iydomDe i s (0truo(r iydomt mnesa(  Drmumo;u1oex mi3tatfmDumnmp u4tltnmociadla rlues;s  rtmxr iy4apte neta(  Draxro;t4tle  i3iys aDemu ont) rtnio3totoat luvo s0t2um(mpoy1lmenlfviasfsDrmumooo0oee mieiysfsDrm(mp u)tltrif iotfa  aues;(0s2urirpiy4lpeelictlt  rtaxro;o4optnif3tasfm rm(ms t4texnir3ty1fateau ilt sexm(opoo4openmfvil()a2trx oou4oex ioetaslaDelumpn(4 rxomocoo1lpD  i i s0trtm(m3iodoltnlnviat)sDrauroou4apeoiiciyd sDrmnvs t4texnxociydla  au sls0srto(mpnu4ll  mnvsat srrmxr ;t1opxomieiltlm2rlnvp;t)trtnircoydfmt ln ils) eurxr nu1apen net (faDrm(r no1tlx iieiaslmDeanvs;t4 eeomo todfpte nvo (0s2trxo3oy4lpt mnesa(fsrtmxrpnt4oleoif3ilsfs eauvsn(0 exrxr3oydlm   u o s)trum(o3iy4omt licslt s2ta(mpnt0ole  ictys a em(mo;t0 etnmo oydomtran s;()t2toxr3oydaleemncsas srrm(ro;o1tlen fciadfa uaumo;(0tltrmo3oytlmDelues s  2ur(r3iudomtnmfci ()aDurxmono4tex ifciadla uanvs;(0 etrxr3ootop r u i (0 exoxm oo4ameemicsls)arra(ronu4tpeo ictad mDelu p t)arxnxo ta1faD  uvs (  2xr(opoodameelivsa( sDtaum ot1aex iociyslmDeanmpnt0 rtrxrciy1fpteauvolt) 2xmimpny1lmt  ici ()aDta(mo;u0optoif3iltlm elnvpnu0tlxomo3oydfm  li sls trur(r nudapee ieils sDra(m no1alto fctatlsDrlu p;u4alenxf tytomt an i;s0srurxopnydlp nlfvi s)aDur(mont4aetnioeiatlsDelumo;(0artnio3ta1op e nes t0 2ur(m3oy4apeemfeta(farumurp;o0aeenmfetltlm2uau p;(0alxnmr3oy1lm e nvo ( s2xm(m3iy1aleemivils) rta(  no1tpx mfcildfaDra(msnt) renir oa1omt lu sl() 2tm(mpiy1lm n fvil(  rurxrpou1aetoifctaslsDean p;t0trxrirctydoptraues;t)setoxo iodamt  nctlsfs2ur(rpoo1aeeo fciltlsDea(vs;(4areoio ia1la e iei;s)t2um(r3iodlm n nvil() Dtax pot1oetoioetldlsDrmnmp t4 lenxf3oydfm  anvols t2uo(r oy1ole lfes sf rtm(mo;t1tpxn fetys s rl( s;t4 ltnmfcootop e u o t  etrimpio1alen fesls)sDta( oot0tee moetyd m em(ms (4aetnmo to1laDe nei t s2tr(r nu4ll nlfesls sDtr( pnu0altoiictlslmDumnvonu0texnxo3oydoat  i o;t) 2um(r nydopeemnvsa( aDtax  oo0texn f3iysfsDemu p (4alenmr oodlmDraivs;s  rxm(m iu1lltnmfvia(f Drax  ;u4oexn oetysla2ua(mo ()trtrirctotoa  aivi;s0srxrxopiydlpteliei (  2ra(m ;t0oet ioeiasfa2emumon(0 lxoio iytlp eaies t  euo(r iu1lm elnviat) rur(mpnt0alxo iciyt s2rm( o (0aleoxf3tadlp raivo t) etoir oy4alte nvsas arumu  nu1tlt ii3iytlm2emn o t0 etnmrciatla rln i;t0t2xm(o3iydaltelfcs t) Drr(m ou0opxoifctldla2uau p;u0 lenmo tatopt au o;t)tetmxr ou4lm nmfesl(  2ra(rp;o4aeeomieilsls umuvont4 lxnxfctadfmtrluvi t0sexoxm iodol n ivsa() 2rrxmonu1apeo i3iysfs rl(vpnu)aetoxr oadlmD aivolt t2umxrpiu4llenlivt () rrmumo;o0tpe  oeiydfa2ran o t0aleriocoodlmteli o t srtrxr ny4lpen fetat artr( o;t4tet mfeiyd m2uluvo u0tetnir ia1lmD anes;t0setrxr oo1amenlfvilsfsDrmurpno4apx  oeiltla2rmn onu)aleoxf ia1la r ues s0texr(opoy4om  lnesltfsDta(  ;t4oeenmf3ils s2uln pn()altnmo3oatfatrlnvo ()trxm(o3no4ol  mfvt (fs2taurpou4oltomoctydfa elu o (0tlenxr tatlmD au i;(0 2xr(mpoy1am   fvs tf rrm(rp;t1oetnmo3ias m2umums;u4tlxnxrcoa1la eaivi t  rtoxo3ny1op nmicsa(fartr(rpoo1teen octytls2um( p;(4alxniocoatlm e ivsl()trxm(r iudlm   iei t  rumxrpoo0oet mfeiydfm2rlnvp;t0aetnmr3oodomt ai sl()t2umio io4ap nlivi s aDra(r ;o4oeeomo3iadls2rl(mo;(0teermrctadlmteau sls)teuoxopiy4omt  fei t s2ra(  ;t4oet ioeiatlmDrl(ms;(0trtrxf3io1opteli o;s) 2trxmpiydomeelictltfarua(  ou0aet ioeiydls umu o (4 etoif iydlpDranvo t0 2umxr oo1lm  lfesa()aDtr(m nu1aetoioeiydlmDul(vsnt)texrxr3ootfpDeai olt0srtr(o oo4am  mnetls  Dra( pno0aex  o3ilslm2ra( o (4tetrir3oydfa raneslt)s2xm(o3iu4ll nlnvsa() rtaumpno0optomoeilt m ranmont)aeerif3oa1fa elneo s)t2xriopoodoleemicils)s2ta(mp;t4oeto fetad a2rau s;(0trxoif3ty1lmt  ivilt) eto(o3io1ol   ivsl( arta( oot1apt  ociys a2rln snu) ltomfcootop r neo t0t2xrxo3oudaltemivtlt)srrrurpnu1alxo ictad sDua( p t4trxrxfciadlm e i ilt)trto(opio1lle mnesa()aDrrxro;t1ape mo3iydlm ul(mo;(0 ltnif oatfmt  nei;s  2toxr oodalt mnetltf 2ua( o;u0olt  f3iyd s2ra( p t)trxrxocoytopDr uvi;(0texo(o ny4am   nvsa()s2ta(  nu1apx  i3tadlm2uluvs;() reoxo3oatfm rlieo;t0 2xr(o oudamtelfctltf rrr(mo;o1aexnmfetls sDrauvont4 rxrmr3iotlat aieo;s0seuoio3no1apenmfvilsfartax pnt0aeenif3ias mDem(ms;u0aetoxf oy1lat aivo;s0srtrxo oo1optn icta(f 2ua(mpnu1texnmo3ilt a ra( p;u)teenxf tatfm e iei s0t2xoxo3nu1ale  ncsls)s2urx  ;o4apxo feildfs2ranvp t)aexnmo oytfp  li i;s)s2tmxo nydol n icia(  2tmu pot4optomi3tadla rm( s;(4aetoir iydfatr i olt)seumxr oudlmtelncs t)aDuru p;u4aet ii3tadlm rluvp;u) rxnir3ty1fpD  ieo t)trtm(r3ou4optemneil(faDurump;u0tee ifeiat sDea(vsnt0 eermocoadlm  luvs ( t2xr(opny4altnmivt t sDtr( pnu0tlenmo3tas s ua(mo;t0 ltrmf3oatom   i i s  exr(m iu4ap n fetas)a2urx p;t1aexnmoctlt mDuan p;t4 eeoiocoydoatrli i;s  rumxr io4amee fes t  Dtaur ou0opxomo3ilslm eaump;u)aeenxf3iadomDrau i (0 2umxopoudlltelfvtlt aDrmxr nt0tlenmiciltlmDum(vp;(4trenir3tatlmteluvs;t  eto(opio1al elfvilt) Dumu pnt1tetomf3ildfmDranms t0 reoxf iatfmteluvsls srxoxm no1ll  mfvtls)srumum ;t4apx iictytla2ea(vonu4 leomfcio1oate ieslt) rtm(o nodlmt lnetls  rrauronu0opxo f3ils a2ra( o;(4trermr3iy1opte i o s0s2xoim3nydlleemncta(fa2ua(  ;o0teenmieiydlmDulumon(4tlxnircoadoaDe i olt  2tm(r3nu4lp e iesltf 2taur ou4apt ioeiydlm2rl(vo u0 eerxfctytop  lnesls  exrxmpiydaltn fvil(fa2umumpnu4tlx  ieils a rlnmo;u4 renmr tatfp eli o (0teumxmpno4omte fvias) Durum nu1tlenifciyt m2umumo (4 lxnxo iadoaD  i s;s)t2umxmpiy4ll nmicsatf rrm(mpnu0opeo ociltls2elump;u0aetnif oatoatrlueols)trxo(rpiudlmee iet t)s2tau p;o0tlxomfetysfa raump;t)alenmrcootlm   ivs s)srtoxo3oudlp   ici (  rrmxm ;u0oet ifciydla2ul( s u)tlerio iodoa elivs;(  exo(mpou1olen nviasf rtaum ot0aexoii3ilsfsDeln s;t4tlxrxf3totopDe ivi;t s2trxm iy1ome lnvs ()a2ta(rpno0alxo i3iat aDrm(vo t0alerif totfat lnesls  rtoiopio4oleemici s arum(mp;u1tlxnif3ildlm2emump u)aexnmo ty1la rln i;t) rum(r3nydll  lfvtas s2tau pot0tpxoifetasfs rm( onu4aeeoxocoadfp eaueo;s0srxrir oy4ol elieslt)a2ua( o;u0oetomo3ilt sDuaumo (4aeeoir3oatomDranvs s0s2ur(r3ou1optn fvtat) 2rmumo;t4oee  fetls m rl(mpn(4aexomrcia1laDeli s t)s2tm(rpiy4llt  nci t artaxr oo1tpe mf3tlt sDemn snu0tetoxf3oydoaDrauvol(0trtrxopoo4altemnvta()a2rmxmpou4apt mi3tld aDrl(vo;t)altrirctytomDr i sl() 2xm(o3iu4aptelivtasfsrta(rp;t1tpe  i3tasls2elumo;u)texrmo3iy1opDe n s () eum(m3oo1ol nmnvs t sDuaxm ;o1aex  feiatla em(vpn(0tltrxr todlm e ueo;()t2tm(r iy1olenmfcils) Dtmxmp;o1apt iocilsfmDua(vsnt0 rxoio tatlpte u o s0s2xmxm3no4lm nmics s a2trumo;u4oet  fetldfs rl(vs;t)teerxr io1omtr uei s  exoxmpnodope mnciat artrxro;o4oltoioctyt mDraumonu4 exoxo3oa1omte i ils s2xrir oodoptnmict ( aDtruroot0oeeoif3ias a um(vo ()altrirciodfmDean s s0 2xr(m oudope mfes s  rrrxmp;o1texoii3tyslmDelumpnu4trerxo oa1opDe ies (0t2umxr nudlptnlfvia()sDra(monu0teen i3ildlsDrm(von()tltnmr to1lmt  uesl( setoxr nu1lmeelfvtltf Drm( ooo0apx mictatls ran p;()trxnxf oytoaDeaieo;t0texo(m iydll nmnes t srurumpoo1tptoiociatlaDuluvpn(0aetnmf iatopt anvo t s2xm(rpnu1ll nlivtl(f rrmx pou1tptoio3ilslsDranmon(4aexnxo3iodoatraivols0t2xmirpio1ole  fvilsfaDumur ot0tlxn icildfm2uauvp (4aetrif3ta1lmDrluvils0seuo(opoudomee fvtl(  Drau  ot1tlx io3iydls2rm(vs;u0trxrxr totoptrlnvs (0 rxrirpio4lm elicsl(fa2rr(rp;u0optn iciyt sDrm(mpn(0texniocootoateaueolt trxrxrpiy4lle lfcs s) Dra(mooo1apxoifciadfa el(mo;u4tlerifctydfat lu il( srurio3ou4opt lfcias) 2tr(mpnt1oee mietas s umuvsn(4aeenio3iotlpt aues s0srto(o oo1ope mnes sfs2tax pnu4tee  ociysls2em(mp t4tltnmfcoytlptelieslt)texmxrpiu4lpeelnvia(f 2rru oot1tlxnifctat a raumo u0tlxnmr oo1oa  ai s t s2um(rpno1alen fet tfsrur(r no1tex  icilsfa emump;u)aleoxr tytfp eauei (  2umio3iydllte nesatfsDrmx onu0tptnmfetadfm2rm( p (4trxnmr3oodoateaiei;t0 2uoxr3oo1alen ncta(fartm(r nu1tpenmociytls emumo;t4aexnxociadlmtrau i s)s2tr(rpoydoltelnei s sDtaur no4opxn f3iltla uln snt0tlermf iodfp eau s;t t2xmiopiydlleelfct t)aDrmurpou1aptomieiltlsDrlu snt0 rxoxr3oytlm  anes (0s2xrimpoo4lm nmnvia(f Dtm(m ;u4optnio3tyd m2elnvo;t)artrxo iodom   ieo s)t2trir3iy1ol emies t sruaumpnu1aexo i3iatla2rmuvo;u4arxoxrcio1lpD ai i t0 2uo(m nu1om emnet t a2tm(rp;u4oltniocils aDel( s (0aetnif to1lmtrlnvs;()s2toim3no4lme mnctat)a2rrum ;o1apt mfeiltls uluvp;t4 exoifciatlpt  ueo;t srurio iydoltn icslt a2rmump;o1alxnioeiyt aDumnvs;u)teermf ta1oat aivils trto(rpou4al emfesls)arururonu1apenmf3ilsla ranms;t0tetnir3totfaDe i slt0s2um(m oy1lpeemiciltf rra(r nt1tex moetatls2eau o;t4trenio oydlpDeluvs;t  rxo(mpny1ol  lics s) 2taxmonu1tetomoctyslsDran snu0aeenmocio1laDraneolt trtoir3oy4lm   fvtl(  Dtau ooo4alxoiietyd sDelumo;u)altrio3oatlm  auvs;t0t2tm(mpiu1ole  iesltfartmx oot1olx io3iyd a ulu s (0tetrmrciy1oaDeanvo;( t2xo(r io4apee iei sfaDrmxmoot0teeomfciad s2el( s;(0 rxomf3tydlpD lieo ( setrxm3nudaptn fes s)aDraxmooo0oee  fctas m2elnvo t) rxoio3io1fpte uei t trtoxopnydale lieilsfa2tru  oo4aet ii3iat m2ulnms;t0 eerxo totfpte ivslt) exm(m3ny4ome mncslt)arurum no1olen fctlsla2uauvo u0arxrmfcoy1lpDeln ols) rumio ou1lmeelivi s) 2trx pnt4olx mf3tatfs2em(vs;t)tlxrif oatlm  anvo;s  rur(o oydop nlivils artaumo;t4tet  oeiatfmDuluvo u)teeoif oodfaDr u i ( t2toir oydom e fci t)s2trx pnu0tpeomoeiys sDel(ms;t0alenio ta1fptelueo;t0 etrio3no4lmee fvilt)a2raumono4olxn ietysfa rl(vo t0 rtnxo iy1la r nvo ( srtrim nydomen fciasf 2rrx o;u0apeoiieiytfa2emums;(4 exnio iytlaDraivols)seto(r nu4opee iviasfa2rr(rp;t1aptnioetldfm ul(vp;(4alxrmo3tytfp eluvs;(0 rtm(m3nydolte fesat  Dtrum ;t0tet mi3iasfm2umnvs u)trtrmr oatfmD lues;s0 rxrirpoudlmenlfctasfaDrr(m nt0oetoioeiydls2ul( ont) rermr tadlp  li s (0srxoiopiydlpe lfet t)sDrmurpnt1tet  f3iaslm2em( p t0texnxo oadlmD auesl() rxmxr3oo4al nlivils)srurxr ;o0oeen feilslm2rm(mp;u)treomocto1fpt  ivsl(0 eto(mpnu1lm  mivs (faDtmurpnt4opx  fciat s2ra(mo () rxomf3ta1oaDrluvs;(0s2uoxm oo1lme liei s srurumont0oeen o3ildfmDrl( on(0 rtomfcio1fatrluvol( tetm(o no4aptn net t)a2raumpot4tlx io3iytfaDuln s t0 ltnmo3oadlm eliei;t0 etmxopoy1lme lfcsas s2ta(m nu1ope mf3iydls ra(vs;() ltrif oydlmt  i ols)sruo(opoy1amtn ncs t arrrx ont0tetoio3tlt s ua( ont4trtoxo3totopD lnvol(  2trir oydomeemivtas s2um(monu0tlt iociasfaDuauvont4 renmo3io1om r ueo t0tetr(r3io4ll elncsa(f Drrum ot4tpenmociltlm2ranmsn(0trxnmoctytom eau s ()s2trio3oo4omtemfvi (farrrumpou0apt ifcild mDemn ont) exriocto1lp r nvo s t2xo(mpiu1lpenmfeilt)s2ua(mp;u4tle  f3ias s2ra( o;t4 lerxfctadoaDrluesls)s2tmio3oy1ol nlivsa( sDtaum ;o4aleoiiciltfa2um( s u0tltoio iy1latelivi;( s2tmxmpoodom  lnctatfsrrmum ;u1oleomoeils mDumuvonu) rxrxocoodfmtraivo;(  2to(o iy1aptelnct t)arrmxr no4tetoifeilsfa2rm(ms;()texomo3oatoatraueols)tetrxm3ou1omt mnciat sDra(r ;o4opto feiytls umnvp;u0tltoxr3iodoatr ues s0trtmiopiy1alt lfvilt)s2ur( pnu1olen i3iasfs2emuvpnu)tltomf iytop rlies;s) 2tm(r3nu1ole liciatfsDraxm nt1oexoifciytla em(vpnt4aeenir3oadla  auvi;t)tetmim3nodop   ics s)arumuro;t0ale  f3iatla eau snt0aeeoifcio1fpDelnei;t) 2tr(m3iydopeelfvil(  Dtmum nu4apxnioeiydlsDum( snt4alxrif tatlm e ueils t2trxo3nu4op n iesatfarua(moou4opxo fciyslmDrlu o t0 ltrxr tatlpD  nei t s2uoxo oodolt  ncsasfa2umxmpot1tpe mfeiltla2rl( o () leniociydom r ieol() 2xoxr ny1om   fvt t  2rmuront0alxnifctas sDumuvs ()trtoxrcoodfp eaueo t0seumxo3nu4ope  ivs ( s2rm(mooo4tex  iciaslsDeaumpn(4tetnmf iatfmDeai slt0 2xrxrpoy1omt mfvslt) rurxmo;u0tpenii3iad m eanms t0aeeoirciytlat aueo ()setoir3iodalt  ivslsfsrrax o;o0oexomociysfsDulumsnu)trxoxocoy1oat aieo;s0srxo(mpio4amtnmncsl( aDuau  ;o0tlen i3tadlm rm(vpnt)aexomrctydopDeaues;s teuoxm oy4amtnmneils  rtrx  ot0openii3ild aDrl(ms;u4altrxf ootfp rlnvslt0srum(r ou1apte ncsas srtax  oo1texoioctyd m ean p (0 rxrxocty1om  anvslt) rtrxrpnu1llt lnvs s srrr(mp;o0opxnii3tadfaDuanvp t0 lxoirctodla  auvi t) 2xoio3iu1alt mfcta(f Drru  ou0opxo ocilsls2uanvs;t0arxrio3tadlpteauei (0 rumxm iydameelnctat)arum(m oo0tpxomfetad s uln o u0tlxnmo tydlpDeauvi s) 2to(mpnu4lmtnmiciat sDra( pno4tlxnifciadfaDrl(vs t0altnmr tatomD  u i;t t2xoio ny4llt mivias) rrr(r oo0aexniictadfsDrlnms () eeoxo oa1lat  nvo s)setoxopiy1ap  mncsl(f 2rr(  nu4tlx if3ias m2el(msnt0aetrir3tytfm rlnes (0 exmxmpiodap e iesa() 2umxmo;u0tptnio3tat a em( s;u)aexrmfciodomDr ues s) rtoxr3iy1llt lncia()s2urx poo0olxnmf3ildla ulnvsnu) lxnxr iy1lm   uei;t0srtoiopoodlmtnlfvsls aDuaxmpou4alt mo3iasla2rau snt4trtrmrciadlmDr n o s sruoir3oo4amt  fvtlt)a2taxm ;o0apt  i3iatfa2um( pnu) leoif oodfa elivols0 exrio iydlptemiei (fsDurumooo1opt if3iaslm2umnms u0alenio3oa1la rlu il(0srurir ny4lptemivias arumu  oo0aeenifetatfa2eauvpn(0 lxoir3oytfmtr ueo;t)tetrim3ny4ol e nvta()arrm(root0openifcilt a emu snt4aleoio3tatfatrlneo;() ruo(m3oydlle  fci s  2tr(rono0oetnif3iat s2ran ont4altoxo oadopDraueo;t  exrio3ny4optnmietatfsrtmum oo1ole  fctat m2rmump;(4altnmf iodfaD auvilt  2xmxr oydopt  fvsls)s2tr(  nt1alto octadfs umu sn(4tleomr tytfatelivolt0trtmio3oodll e fctl(fa2rm( ont0tpe  fetlt aDel( s;u4 eermf oytlp  aueslt s2xrxr3nydopeelfet tf Duaum nu1oltn o3iydfa2ean s;u)aetrmf3oytfp r neolt trur(o3nu4olenlfvtlt) 2tru  no4opxniiciatlm ua(ms t0 etnirctodopDr u o;t) 2xoxo ny1apen fet sfa2ta( ono1opt iictldfsDemn s t4 rtnmrcta1fpte ivi t  etoir3ou4lle  fviat)aDrr(  nt0texoifeiltfa2em( o;()trxnxfcoadlpD lnvils0seumxopnudap elfcil(fs2ua(mooo4olen fctatfa2rlumpn(0trtoxo oo1oaDr ivil()t2xm(rpnu4ol  lfeiltf Dtmu o;u0apxomfeiadlsDranmsnu0trenxocio1fpD lu olt0 2xoxo3no4lp  livs tfaDrrxm no0tpxoio3iadfm emuvpnu)artnir io1omDeau s;()t2xmxr3oudllte nvil( s2uax  nu4tpx ifeilsls2em(vp;(0artoxfcty1omDrln sl()texo(rpoodol  mfetlt) rur( o;o0aeenmoeiatfa2ra(vp;u4texnxr3ia1om  aivo;s) exriopnu1lpt  nctas srtrxmoou4teeoiocils m2emnms;u)aeerxr3iydfp eaivi;t s2ur(o io1omenmncs t arum(  ou4tpt  fetlt a uan s u0 eenxo ia1omD ln s;s0srxo(opnu1opte fvtl(  Dua(rpnt4aleoioeiydla eau s (0texnir3tadopt livilt0srurxmpiydalenliciltfa2rmumo;u0opeoii3iydfsDrl(mon()tltoxo oytomteau s ()sruo(rpiu1amt lfvtatfaDtmxmpoo1tpeoii3tyt s rlumpn()altrio3to1fmDe ieo t srxm(o iy4ap  liei ()s2rmxmp;u0tee  o3tat mDul( sn(4aexrif3iodoaDrauvils)teumimpno1al   fcs s aDua( o;u4tpeoii3iyslmDulnmo;(4tlxrif iotfpDrlieo t)teumio iydlpee ici t  rrmurpno4ole mieiyd m2umums ()tlxrmfciytopt li olt0 2xm(m3ny4oltelfei (  2trx  ot4aptniietatfs2uan o;(4tleoir oydlpDeaiei s0 rum(o oo4ame  ncils s2ta(mpnt4apeoifcild s em(ms t4tltomfctadoa elivs t0s2xoio3oydop e ivsl( sDrax pnu0tlxo fcilslm uaums u)trxnir ta1lmteau i (0s2trxo3ny4op emict s s2um(r ot1aee mieiyd a ulums ()artnio3tytopDeauesls  etmiopoodam emnvi t)artr(  nu1oex ifeiatfs2rln on() renmf3oydfm  auvo ( s2tmio oo1lmen ivslsfa2ua( o;t1aee iietasla2emnvp;()treomf3oy1oa  lnes;s) 2tm(r3nodalte fci tfsrtaxmpnu0tet iictys s rau p;(0texnif3ootopDe uvilt)srxmxo no4om  lfetl(  Drm( pot4tlen feiyd sDul(vo ()artomo3oa1fmt  iei t s2ur(mpou1ale mncsl(  rrm(m oo1oex  ictydlm2em( p;(4altomfciodlp ean slt) rtr(rpno4omt lfciasf 2uaxrpnt0tpe  oetys sDum(vs;u0 lxnio ia1opt  uvo;s s2um(mpiodll e fcs t)arur(mpot1olxomoctyt a2em( o u4aexoxr to1lmDeaneolt0seuoim nudapt  ietl(f 2rmxrpnt1ope  fciytfa uluvs;(4aexrxr ta1opDrau o s0s2xrimpoy4lmeemneiasfa2tau ooo4tlxomfctat m2ea(vsn(4 rtomoctadlpD aueolt)s2toxmpnu1apenlfesl( srta(monu1aex ioetlsla2emnmp;t0 exoxo3oatfmD li ol(0t2to(opiy1omee nvtl(f ruau onu4tlt mf3tatfa eanvp;u4aetomo iadom  anvo t seum(o3no1lpee ies sfartm( o;o4oleoiictlt m rmuvsnu0 exrxr oydfptrai o;()s2trirpno4lle micsat) Draumpoo1ape io3iltfs emnvp;() exnmrcoatopD li s ()s2xoxrpiy4am nmnvsa()sDrmum ou1tet if3iytlaDua(vs ()texrxocia1lmD  n ilt0 rxmio oudllt  ici ( sDrmxrooo0tlt io3ildlm2ra(mo;()alxnxfciadoatrli s t sexr(rpnudlmt livta()aDrmumono1tlt io3iatlaDumnvpnt0alenxo3tadlaDe uei;s trxrxopnu4lp n fctl()s2urxronu0oetoifctydfa2umu on()aetnxf3oy1optelnei ()s2uriopoodlpe mfcs tfsrrmum ;o4aexn fciltfsDrm(vont4tlenifcootlp rau s;s)tetoim io4lpenmfctlsf rtaxr oo1oetnif3ild a ranvp t0artrio3ia1lp rlneil(  rtm(r3iydapee nviat aDtmxrooo1aex ioetyd m elnmont)tetnxrcty1fa  au o;()t2uoxm3nydopt  fvs s  rrmx  ;o1oexo ociadlm eauvsnt4alxoircootlpDeaues t)texoxopiu4lptnlnvt (fsDurx  ou1ape mi3tlsfs el(vo u) etoxf3ia1fa  auvsls0t2tr(m oodlm e ietl(fs2truronu1tlt mi3iltfsDrmn s (4tlxrmo ty1fmD auvols trtm(o3oo4lm  mfct t srurxmp;o0oetniieildfs2uln on(4aexrmf3tadla ran s s0trtmir3nudalenmfvsa(f rua(m nt0tpxoifeiat s2rl(vs;t0 rxrxo3iytfp r u o;t trxoxr3iy1optemicsasfsDta(rpnt0oltnmo3iaslsDrl( p;t0 lxrxf3iytfmt  i s t)seuoio oudamte nctltfsrrmurpou4oleo octadfs2ua(vont0 rerxrcoydla r nes s0 2xrxopiy1ap nmfeias srumumpno1tltoiictysla2umu p;()tleoifctydfmte ivo;s) rtrxo3nu4opeemnetl() 2trxm nt4apen iciltlsDranmo u0aeeomocio1oatrluvs t)texmirpoodlmenmnvs ( a2raur nt0olxoio3ilt s umuvs (0arxrmf iotlaDr u ils0trurirpiy1amtelieta(faDta(r ou0tetomi3iytfmDrm(vs t)alerxf3iytlp  li sl(0sexmxr iydlm  lici sf ruax  no1aptoio3iysfa2uanvs u0 etrmrcoytfmDrliei () 2toimpno1apen net s) ruaumono0olx  iciltfa2eln sn(0trenmf3tadlmDrlivi;( s2xoxr io1lmenmies (faDra(r ;u4optnmo3iatlm um( p t4 eeoif3oo1fp r i s;(0 exrio oydamee ivsa(  rtm( p;o1optnmf3iltfm uluvsnu0altomf totfa e nvi t srtoxr3oy4am n iviltfsrta(m oo1aee mi3tld m ranvs;()aetrmf tadoatr i ols  2uoim nu1lmte nesa( arurum nt4alx  ieiydfa eanmsnu)alenxo3tatlm rln o;t)t2trxm nu4apt mivtls  2taurpoo1ale iociydfsDemu pnt0tlxrif3todopDe u i;t  rxo(m3oudomeemfvtlsf Dtm(m ;o1tpe mieiadla rl(vont0teeoif3iodfpD livslt)s2tmio3io1om emfvi ( srtau  nu0tee moeild m umu p u4altnxo3iy1lpt luvo t)trxmxm nu1altelfvtat)s2ua(r ;o0open ociasfaDelnvpnu4texrxociotla   uei;s  2toir3nodamtnmnvsltfsrtmu pou0optoifeiyd m2umuvp;u) ltnio3ta1latr n o;()texm(o iy4omt lnei s  Dtaurp;o4tle mo3tat m um(vp t0texrxrcoa1fa elu olt0trtmir3nydomeelnctat)arua(rp;t4tetn oeilslm2ua( sn(0alxoif totfpte nvo;(  2xrxm3oo1ale  fctl(fa2rm(mont4alxomfeiat m rlums;(4arxoifcoydfpDeli o;t0 rtoio3oydol n iviatfsDtaur ot0texo ociatfa uanmo;u0 rxnmfctatfp  auvi s)t2umxmpno1lmtemieslt  Drm(r ;t4opxoifeiadla2raumpnt) exnio todfmt  uvo;t0 2xoxo3nudopenmncilt)a2raumo;o4tpe if3iyd a2rln s;u4tlenmf iotoatr nesls) 2to(o3oodlmeelfcs ()a2uaum ot4tlx iieiytls2elu s;t4aexnxocoo1lptean i;(0s2uo(rpnu1ameelfvi s)a2tm(mpoo1tetn o3tld sDea(vp;(4arxrmr io1lp rluvi ()trxrim3oo1ame mfctatfa2rruro;t0oet mfciysfaDem(monu0arxniocootomt  nvs;(0 2xmxopny4ameemivta(f 2trx pno4oexomictas s rlnmp;(0aexnmo3ia1oatr u i;t  rurxrpoy1lltnmivi t)arrmxrp;t0opxniociaslm2ra( o (0tlenxf oadlmDranvils0 2toxmpnu1lptemnvs (f 2uau  no4aexnio3iysfsDrlu s;() rtoio3tydfmt lueolt) eurimpnu1apeelicia( s2trxrpou1texnifeias sDuln o;t4tetrioctotoptrluesl( srxoir ny1aleemnct tf 2ua( poo0tpeomf3tys s rmn o (4 lxomocoydla eluvsls  exo(mpiu1al n iciat)sDurur ;t4alen f3ildfa2rlnms;t)tlenxrctotlmt luvi;() 2xrio3nodomenlfcilsfsrur(m ;t4texomf3ils a uanvs u4 lxrxfcoadop  aivils)trxoxm3ny4op e ivsatfa2um( pnu4tpx  fetldfa emnmp;t4aeenxfctodomDeli s;s0s2urimpoodamtnlfetltfaDrm(  ;o1oet ifeildlm2ulnvo u4 lxnmrciytfaD an ils teuoxmpoy1olee ietlt a2rmx pou4aptomfciltlaDran p;u0tlenxfciytfpD aies;s)seurxr oy1lltelnvt tfaDtau  ;u0alxnifcilt m2rm( o;t0artnmfcty1oat livi s  euoxopiodoptnlivsatfarumu poo1aptnifeiydfm ulu s t0 lxrio3oy1fpDr ivil( srxrxm3oydlpe lneil(fsDum(roou4aex if3iadfa ra(vs (4tetoioctadfmDeli slt) rxr(o3nodapee nvsatfsrtrumo;u0tptomfctytls2elu s u) exrxrcta1opt luesls  rtoxo iy1lmte iesatf ruaumpoo0aet  fciadlm2umnmonu0tetoxr oodfptrluvilt s2uoio no1amtemfes sfsDrr( pou1apt mfeiadfm2emnmsnt)altoxf3ta1op r u o (0t2tm(opno1lpt
\ No newline at end of file
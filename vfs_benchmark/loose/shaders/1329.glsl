@@ -0,0 +1 @@
+nvs;(0s2xrirpny4om nmfesatfs2uaumpoo0aleomo3ils sDelumon(4tltrir3iy1lptelnes s0seuo(o oy1lleelies s  2um(rp;t0altomieildls2emnmont) ltnifcoa1lpD  nvs (0setoim3oo4lmtemnctl( aDtmuro;u0opxomoctytfs2ra( onu) rxoir3tatop  anvs s  rxo(m oo4lmt lncs (  ruax onu1olxo ocilt m rlumonu4artnif ia1lmD  u sls)trxmxmpoudoptnlnci (farumx pnu4ale mfctyt m2rlu p ()alxoxrciy1lm eaneol( t2xo(m io4ap nmictls sDtax o;o0oexnifeias mDelnms;t4alxomr3oo1fptr nvs;t0t2trxopiu1omen nciasfa2tau p;u1opxomfeiadfa2uanmpnt)tltrxo3ia1fm e ivi;(  2xo(mpno4ale lfvi s)a2tm(ront0altn f3iytlm rmnvp () ltrif3tatlp elivilt  ruoimpio4altemfvsatfartrxrp;u1tle mieiltla2rm( s t) lenxr3oydopDrlnei s s2toxo3no1oltn net sfa2rrx ooo4tpxn f3tatlm rluvsnu)aeeoxfciytfmD livols  eurirpny1ope lnet sfaruaurpnt0texnio3tytfa ranms u)alerxr tydoa  ln s s) 2ur(o3iydomtelfcil(  2umx p;u4oeenifciadfa emu o;u4aetoir iadfmtr uvo s0 rxmio oy1am nlncs (  2ta(rono4oltn octldfs2ua(mo;u)trxrmo3oatomtrlivsl(0srxm(r iy4apt mnetasfaDumum ;u0ole ioeiasfaDra(vs;t0texnirctodfptr uvi t  2xrxm3iy1om nmfci s)a2ra(mp;t1tex  i3iaslsDumumo (4 lermo oy1oaD  ieo;(  2uoimpiu4ol nmici tfsDrrxr nt4alxnifciat m2ea(vo u0aeeoif3oydopD au olt s2uoxopiodal nlnctlt srtrxmoou1openiictytls ra( snu)arxnio3tytfatrlu s;s teuoxo3nu1altn fvslt sDtr(r nu0opxomf3ildfa ra( p;u) eenmfcia1lpte iesl( srxrxo3oy4ape mfcsls arua(mp;o0apenmietadfaDua(ms (0tltrxf3oydla rlivi;t0trxo(m iu4apenlnvil(  Dtr(m ;t4tpxomoetadfm rau s u4 eenio3ia1om  ai i s seumxr iydalenlnvi ()arumurpou4tpeomoeiat a2eanvs t)artnxr3ta1om r neo;t)teumio ou1omtnlnei ( s2ua(mpou0opx ioetldlm ua( s;u0 ltrio3oatla rai i;()srxrxo3io4lmtemivs t a2urump;o1tlto f3ild a rmnms;(0artriocoodfp rli il(0t2trxo3oo4om nmietas s2rr(rooo1aex ioetysfm uau pnu0alerir3iotlp   ueslt0s2umir ny1ole lncslt aDuaxrono0opt mfeiadls2emn s t)arenxf iatop elivi;t0t2xmxr3no1openmfviasfa2trx pot4aetnifetld aDrl(vo;t0texrio3iy1lmDelivi t0 2uo(mpoodole  ict () rumurpnu0tle mfeildla2el(mo;(4 etnmo iy1op elu il(  2uoxr nydlm  livsltfaDtrxmont1oeenmfeiltls2ua( p t4trtoxf todomtr nei t)t2tmxm3ou4am n ivi ()s2raxmp;t4oee if3ilt a2emn pn(4alxrif oytopt lues;s)s2trxrpnu1om elfciasf rur( o;u0ale mo3iatlsDran s () rtnmfcoodlpte nvs s  2urxmpoudole  ncs t  2rrxmont0opt moeilsls emumo;t)trxomr3oytlatean o s)s2xr(r3ny1lmee netlsfartm(r ;u0tee if3iasfs raumonu0arerif oa1laDeluvs;s texrimpou4oleemietlt  2tmxr ou1oeen ictytfaDem(vont4 rxrxr tatfptelu s;t sexmir ou4ome mfcsas sDrmxr nt4opxomi3iytlsDua( s ()artnxf3iodfp  lu s;( s2toxo oudopeemivi ()a2trumpno1olxo ietatfa eanmo;t)areomr totfpt  uvilt s2umxo3nudamenlnei t)srtmu  oo0olenmieilslsDelnms;t4tlxrmo3to1opD lneol(0trurxmpno1aleemnei s s2tmurpnt1aexomfeiyt sDumump;(0 exnif oytla raieo t)t2urir iudol   neils a2urxronu0texo ieiyd s raums;t) etoxf3io1lm rlnvi;(0 ruoxo3ny1amenmfetat srrm(monu0opxomfetasls um(vsnu0 rtoxf3ty1oatelieo;t s2xoxopny4alenlivi tf rra(mpot1oexnioctys a2emn p;t0trtoio3oo1la elies s) rtrimpny1lmeemfvi (fs2tmxmpoo0openmi3ildls2elnvsnu0trenir3iodlateluvi;(0sexm(o no4ape  fci s)aDta(mont4tpe iieiad mDranvo;()areniocoydlate neslt0sexmxopnu4llenmnvsat) 2raum nu4oet  f3iat m2uanms;u)arxrio oytfp   n slt)srtmirpiudomeelict s)artmur ot4aeeniociydfs2elu p;u) reoio3iydoptr ieo s) rxr(o io1alen nesl( s2ta(rp;t1tleoiieiatfa ulnvs (4 rxnir3tatopDean i;t0 2xrxm iu4olteliesas srtm( o;o1aexnmieiydlm2rlums;t0 lerir3iotfa eaueo t)trurio3ny4ll  mivsat a2rax p;t4teen i3ildfaDel(vp;t0aeeoif3iytfpt  ivs;t0 rtrxr3iudap nmneiasfaDrr(mpnt4alxoifeiytfs2rm(vp (4artnir totop rauvo s  2uo(mpiy1lpeelnci s)srtr(moou0olt if3tls a2rlums u4aexniocta1oa   u o;() ruo(o oo4llenlnes ( aDtax onu0tpe moctld sDul(ms u4tetnmr3iadlaD  iesls trtrxopiydolt mfvia( aDumu oou4aexomietatlsDrluvsn(4areomo iytlpD aieol(0t2trim3iu1apee nciatfaDra(roou1tpto feiytla2ranmp t4arxrmf iodfa r nvo;()srxo(opiy1lltnlnctas aDtau  ;o4oet ifciadfa2ea(mpn()tltnxr3to1oate i i s sexmxopio1om elfvt sfsDum(mont0oltnii3iytls rm(mo t0aexomo3ta1la   u o;t0trto(rpiu4om nmictltf 2rmurpnu1ape  ocilt m2ean o (4 rtomo3to1omDraneo;t0 rtrxm oydopt lnvt s aDuaxmoot0teenmfetad a2ul( p t) eenxocoo1lm  lneol()seuoxo3iy1am e fvs s sDua(moou4teeoif3tad mDeln s;u)texoif3oy1laDr u i;(0t2ur(m3iu4ll emnvil( aDurx pou4aexo ociadfmDrmnmonu)tlxomrcia1lat  nvo ( srurirpoo4optn fctls sDra(m ot1altoifciytfs rmn pn(0 lxrio3iy1oa elnvs (  eur(r iy4al n fet () rumxmoot1ale  o3ilsfa2ea(vo t4 rxrxf oytfpt lieo;s0s2uo(mpiy4opte fet sfsDrmxrpnt4ale  oetyd s ran snt0tltnxr3iy1oa rai s;t  exmim3ou4lmeelfvsa(fa2urum ;o4ope moeiydfm ra(mp (0 ltrio ootfm e u sl()trxrxr io1ope  iet s a2tmur ;u0altn icilsla2rlu o;u0treoxr3iy1lm eli s s teuoimpiy1ame livsls) rta( o;u4oee  icildla2ean ont) exoxo iadfp   nesl(  eto(o oo1ll   neil() 2urur ot0aee iociydlaDuauvo (0tetnmf ty1fm  livol()s2xrir iy1ope  iet ()srtmumonu0aeen i3tytfa2uluvont) leriociotopDe u sls)seurirpoy1al elics (f rtaxm ot0oet  ocilslaDea(vo;(4 rtnir3tydop  aueol(0sruoxopny4amen icil()artau p;u4opto f3iltlm2em( pn()trtrir3oatopD lu s;t0s2to(o iy4optnmieilt  rur(r ot4ole mi3iyt aDumums;t)aeenxrciodomt ai s;() rumxr ny4oltn fvi (fsrum( poo4oexn ictyslaDel( s;()tltoxf totfaDrlivs;s s2xrxopoo4omtnmfvtlsf ruaxrpno4tpe iocildfa2rm( snu4teenmr3tytopDrlivolt)t2tmir nu1oltnmnvtl(fsDrru o;u0texnioctas m2el(vo t)alenmr3iatfaDr ieo (  2toim3iydomee netatfs2trumono0tpeoioeild sDumnvo (4alermociotlm ean i s trxo(m3oydap  lfcsls)sDuaxr ;u0apt ii3tadfs2rmnmpnt4 rxnmf3io1fp rlnvilt)t2uoio3oydamte netl(fsrraumpnt1optnmoeiadfa rm(vp;u)arxoxrcoodoa rluei t0 rtmirpoodam   nesat)s2rr(m nu4aee mi3tatlm2rauvo;(0 eenio3oadopDr neols0seumxo3ny4ome lfcia( aruau pot0tex ifeiltfsDrlnmont4tlerxfcoy1oa r n s () rxr(rpiydole miei s) 2ur(mp;t0olxo feiytfa rm(vo;u0 rxomr tytlm elieils)sexmxo nudam  miesls)aDurxrp;u0oeeo o3iatlm uan p;u)trenir3oo1la   u olt0trur(mpno1llt  ieta(f 2rrump;t1altoifeildfmDelu snu0arxnifcoatomD  ieil( trxmxm3ou4am e fcs t aDumx pot1ope mo3iytfa2rm(vo;(4 ltnir3iatoa eauvi t) eurxm no1ll  lnvtlt aDuaxronu4opeo ieiys a2rm(mp;u4trtrir3iadla  an s;s0trtoxmpoudom emnvslt  rumxrpoo1altoio3iltla2raums;t0tlenmf iydfpte i s t0 rtm(r3io1lptelictlt  2ur(mpno1texoioeiasfsDean s;u)alerxfciytfmt lueol()t2xmiopiudlpee iviatf rrm(ro;t1teeo f3iydfa ulnmont4arxnir3oa1lm  lueol( t2uoxrpio4al  mfesas s2umu onu1tleniiciysfm2ra(vo;t4 eenif todfp eaivo ()s2triopoydaltn netlt)aDrmum nt1ale  i3iatfs rln s;u)tlxrxf3ootfm eau slt s2uo(r3ou1lpenmfvsls) rumxr ot4tlt micilsfm2uau o;(4aexomo3iodlmDelu i;s0s2urir3iy1oleemfvias) 2umxmonu1apt mf3iys mDrl(vpn(4tleomf oatlm eli s;s0 rtrxm io1ope mnviatfsrrax p;u0oltnifeiadlaDrlums;t0alenxf iy1fpDe iei t0teur(opoodomtelies t sDumu ono0tleo fciys a2ul(vont)alxnxrciytfmteai s s)setm(mpoo4lme  ietl( artrum nu1olxomoetat a2uanmonu0aetnif3iodom rlieol( s2urxm3oydll elfesl() rraxr ot0ape  fcildfs rm(mo;u) rxnircty1fmD aiesls0teuoxm iu4lpt mfvt ( aDtrxr no1oltnmfciasla rluvp u)trxrmo iatom  lueo;t teuoim oudoltemfcs sf rraxrpnu4olxn ictltfaDrmnvs t0alxomfcio1la elu s (  2umirpoodope  ieslt arra( pot4aleomo3ildfm2el(ms;() leoir3ia1faDelneol()tetrir io4lp nmfeia()sDra(r no1aeenmfeild a2um(ms;(0 etrxr3tytopD luei;()truo(o ou1olt livtasfaDra(mp;u4ope  iciydfs elnvsnt0 rerxf3iodlm   u il( trtrirpiudllt mfci t arrm(rpoo0alt mfeiytlsDem(mp t0texnxr3ty1lmDrli i;()srtoimpou4omenlfeia() rumu  oo1aee iieildlsDua(monu0 eeomf iadlmtelneol(  eumxmpno4lm n ivtltfaDum(mp;u4alen fctldfa2eaums t)tlermf3totfpDelueo;(0trxoxmpno1lmeelncilt srta(m ;t0oetnmicilsfa rl(vs (0tlxrir3todoptraivol()s2uo(o3oydamtnmfeiat)a2tmx onu1aee  oetytlsDea( sn(0areoxr3todlmDe nes (  rtoxr3oydolt  nvils aDrmx  ;o4alxnmoetysls2eanvp ()alenif3tadlpDeaivols0s2ur(o3ou4llenmivi s srrru onu0oexn ieiysfmDrmnmo t)alxomf3oa1laDeaivi;t)trtmir3oodapeemfcias  2tmurpnu0tlx mieiyt aDrau p () rxoxociatfm  lu s;()s2uo(m nydame lfvs (fsrtm(rp;o0apx mictltlsDeauvo u) exoir3ootopDraies s)texmxr3nu4amtnmfeiltfartmurp;t4altnmi3tydfmDemu o t4 lxnxfctytom eaiei s) rur(m3nudopenliesl(  2tmuroot1aex ii3tyt sDel( pnt4 rermo iodlateaues t0 2to(o3nu4openmicslt  Dta(mono0alxnifciltls2rlnvonu) exoxo oy1fpt anvi s0 rumxmpnu4am nlfvsl()sDtmum ou0tptniicias mDul(mont4trtnxo3iadoptrlieils)texrxopoy1ope  ictas)sDraxm ;t4tlt iieiad aDelnvont0 renioctatlp rln o;t0t2tmxm3iu4openlfvt sf Dra(ronu0tpxoif3ilt m el( s () ltrxo3iatlpDe uvs t)t2umxmpoy1ameemies tfarta(mpno0aexoif3iyd sDean o;(4 rtomoctadfmtelnei t)sexm(r iodamtnlfvi (f rrm(ront0tlxn ietldlsDel( s;(0 ltoxf3to1latr neo;(  2umxo3iu4ll nmfes (  Duax o;t0opxomicilsfmDranvo;u0trtoif oatoa  luei;t0sruoxmpou4ome  nei (f Drm(m oo0tlxnii3iyt sDrl(mo;u0teenxrcoodfa  ai sls) exm(m ou4amee ies s) 2umxrp;u4open f3tlslsDumu o;t)alxoxocoa1fateai s;s0texo(m nodll n ivtas) Draxrpoo4tpxn ieiysla2el(mon()aeerirctydlpDrluvs;s seuoxr3oudom n fcsls a2trxrp;o4oexnioeild a uaums u0artrioctydlmt  ieo (0 rtoxr nu1apenlnci s artr( o;t0tptn f3tydlmDuan sn(0tleoifcty1opD au s s  2umim3nodapt mivil(faDrr( poo4tpx  ieils aDul(vp;t) lxrmo3iy1latrlnvilt)teuo(rpny1am   ietatf 2rr( pot0ope if3tad sDemnmsnt0 rtnir3io1faDr uvo t0tetrxopnodom e ictat)aDua(r nt0apxn ieils s umnvs;u0alxomf3oodfm  aieils0s2uoxmpno1lpte fvtl()sDtm(m ou1alenifciys m umnvs;u)tetnxo3iodlate nvs t t2xrxmpiodap nlfes t srtrxm ou0apx iociasls uauvp (4treoircoatlateluvs t trxoiopny1omtnlivt t a2tau pnu0ole miciat s2rluvont)aetnxo tatfmDranvs;()seur(rpno1amenlfvtat  rtm(ro;u4opt  fcildlsDuanvs;()tlerxf iydfateaivsls srtr(r3io4llt  icil(  Dtm(mpno4oeenifciadlm2uln ont)teeoxr3oadfaDr i s;t) rxoio nu4lpe  nesasfsDrmumpnt0opxoiocildlsDrmnms;u4arermf3iodlp   uei t  rxrio iu1op nmietas  2rru pot4tlx mi3iadfaDua( ont)arxrmo ootla ranvs;t) etoxo3nudap e fetlt) 2tau o;t1olen fctys a rmnvs;()altoxf3totlp e uvi () eto(o oo4ol emivi s  rua( poo1ape  ieiytfs uauvsnt) rxnmr totfpD anvo;t)trtrxm3nydop  mneilt)a2tmuroot0tlto f3iyt mDumu s;t)aexnxf3totfm elu ilt  2urxmpiy4oltnliet t)a2rrumo;o0apeoif3iys s2umumpn()aetrmocta1faD lu sl( trtmxmpny4omtn nvsat)srua(rp;t0aeen ieiatlm uanms u0 lxomociodoa  aivi;(0trtrim oydlp elivias) rur(r ;t0olx  ocilt a2rlnms;t4trxoxr3tadfm ran s t)teuo(r iu1lmt  ictas  Drm(r ;t0apeomociytfs2rm(vo t)texrir ootlptrln i;(  2urxo3oo1open nvsatf Duaxr nt0alenmoeilsfa elu on()alxnir oa1fat anvs;t0s2xoirpny1lmen icilt)s2ua(rpou1oex  oetadfa ua(vpnt)arxrio ootomt  ies ()srxr(r3iodaltelies sfs2um(rpoo0teeo i3iadlaDuanmo;t4alerxo todfatelneo ( trto(rpoodape mfcsat s2raum nu0ale miciys mDul(mo;t0 exoir3totoaDr n slt s2tr(r3oydop nlncsl(fa2ta(moot0tlx  i3iaslmDeluvs u) lxomf3iy1faDr u s;s) euo(rpoudlptnmfvt t sDrmumpnt4tpx ii3tys mDemnmo;t4trtomrcoydom e nvs s)teuoimpnudlme micslt arumu poo4oet mfctas s2umn p (4 rxnmfciy1la  anvi t srtoim iydom  mfeil()sDta(monu4olenmo3iadla2rl( o (0texrxocoo1fptelivo () rxrir nu1am elieil() rrm(  oo1tpxnif3iltfa2rlu s;()texoxr3oydoaDrlues s teumxm3oy4omt  nviatfsrumxm ;o0tex mi3tysla rl( o u)aeenir3ty1fm eau o t setmxr io4lptnmncilsfsrrmu o;t1tet iiciadfa2rlumpnu) ltoir3ia1lm e nvs t t2xoio iu4lmte fct sfsDua(mpoo4oee ifeiaslsDua( s;t4 exrxrcty1lm raiei t) eumir iu4ale  fvilsfs2rrxr no1alt  f3ias s umump (0trxoxr tadlaDelivo;s0 rtmxr3oo4altnlies sf rua(mo;t0oeenmocildfsDuluvp ()treoio3iodfm rai olt trtmir ny4olenlfesas  Duaxmp;o0oleniociytla rlump t4arxnio3oy1opte ueo s) rxrirpiy1om nlfvt (  Duaxronu1aexoiieiydfs ul(vp u4tleoxfcoa1fp r uvo;s srxrir io1oltelfctl(  2umxrp;o1aeenmoeiyt m2rm( o t4tetnmf tatfmDeau olt0tetr(m3oudaltemicsas)aDtr(r ;t1tle ioetlt sDeau p t4 etoiociy1fmDraues;s)s2toxmpnu4lle miei ( srtrx o;u4oetn fciys a emnvs u)treoioctytfpD  n s ()t2xm(mpoy1lp e fvi t  2tmxmonu1tlt mocilslm2el(mont4teeoxf tydopDrlu o s t2toxo3no1amtnliesa(  Dra(m ;o4tlxn f3iys s2ulums;u)teenxf iy1la r n s s)setmim oy4alee nesltf 2ta(m ;t0tpx  fctyt s rm(vo;u4 rtrmr io1opDr neolt0t2xr(r no1olte nvsls)aDum(m oo0tpen oetadla rmnvpn(4aexoxo iatlm  au i;(  rxoxo iy4om emivtat s2tax ooo4aptn iciat sDulums;t) renifcoa1fmteln ol() ruoio3oudlm e fciasfarraxmont1opeomociytlm2rlnmon(0trenmfciy1om r nvo;( s2uo(r oy4ope mfvils)sDumxroot4aeenmfciytlm2rlnvo (4 rxnir3to1opDelies;t teurimpoo4amtnmieilt)a2rr(rpnu4tleo o3iadfsDrm(mo u) eenmrciatfpDeaies t)t2umxm3iodol nlfct ( srtm( pnu4alxnifciltfaDra(monu) rxrxo3tytomDeaieo;t  rum(mpnydllee fcsatfartm( o;t4alxoioeiydfsDemn o;t4texoxr3oyd
\ No newline at end of file
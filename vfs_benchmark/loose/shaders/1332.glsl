@@ -0,0 +1 @@
+uvilt0 rtoxo io4apee ieslsf 2uax pou0aexo fctytfsDuln o u4 ltrxocoydla eli i t  etoxm ou4ll nmnvsa(fs2tax  ot1aexniieiys a rl(vo u0tltrif ia1fatr uesls trumxr ou1op emfvsasfaDra(m oo4aex ifcilt m ulums;()aexrif iodfp r n o s)t2urxm no1lmte fvi (  2um( pno4tee  iciyd a2ea(von(0trtnir3todomDeaivs;(0setoimpoy4alt lict t srua(m nu1tleo octytla2rau p u0artrmo3iadlpt lu o t0teur(mpio4lpt mnvtatf rtaum ;u1oleoiociatfmDumuvont)trxoir3totom eau o;s0 exm(r3nudapt  fvi s)a2rr(mont4oee mocilsla eanvon()tltoxr3ty1fmte i i t)s2tr(rpny4ol elncil()srtaumpou0oltoifetat m rauvonu4 lxrmo3iotfmtelnvslt) exmxo nudlleeliesas s2tr( pno4apxomo3tatls2ra(vo;t) lenir totoa elu s;()trurxmpoy1ole livsatfaDum(monu0oeeo ieiatls uauvo () eeoxf ootlmD  ueil()teurxm3oo4am  lnetas  ruaxr no0tle ii3ilsfmDea(mp;u0aeeoxo3to1la   n ilt0s2xmir no4olt lietatfsrtmx  ot1tlen i3tasfmDem( o;t) eerxfciatomDe iei;t0srxmxm oy1llt licslsfs2rmxronu1altnmfctadlmDua(vonu0 etrio3iatlatrauvi;s0srurxrpoydape mnei (fa2trumoot1apenio3iytfa rln s;t)tlerir3iytomDeauvo (0tetr(r ou1lpenmivi () Duax ooo1tleomo3iytfm2ra(mp;()aleomf3oy1lpte n s;t sexrimpno4al elivt s) rrrxrpnt4aeto feiydfsDulu o;t)aexnmo iy1fa eln s;s seurxmpoy4ameelictatfsDtrx pnt0oltnmocildfsDrm(mo (4tetomfctatfmtr ivs (0trto(r3no1ll emnciltf Duau  no4optoio3ild s rln snt4treomf3oatfpDr n s s) rum(r iydolenmncil()arum(monu1oeenifciydlsDulump;u4 etrxrciotlmD  nvolt)setm(rpio1lpe  ncsas  2trxmo;o4olto ietadfs uan onu0 exrmrcoodlp   i o;(0teuoxo3iudlleemnesat)aDrmx pnt0tltnif3ilsls2eln o u0alxnmr3oytfmD  ies t0s2um(m ou1lmeelfesls s2umxmont4oexn i3iydfaDuanmo t)arxrif3oodlmte ivs t) 2trim iu4om   fesltf Drrxmp;t1oee mi3ias aDeln on(4alermfcia1omteaivs;( t2to(r3iydome  ncsl()a2umu pnt4tlto fctydlsDelnmp;t)alxrxf3to1omDrluvs;(  exrxopnydoptemfvs s a2uauro;u4tee if3iadlsDumn pnt)trerif3tatlp r n s;(0 rtm(r oo4lp  lncias)s2uru oou1olenmoetytfa2rln o t)altoio oytlaDe uvol( sruoir3no1lm nmfviat)arua(rp;t0tleoifeiysla ulnmo (4arxomf3tatlat lu slt srur(mpny1al emfet t  rrrxrpnt1tpe  ictat m rlnmo t0 reoio ia1oatrlies;()texm(m3ou4lltnlfvs s)a2tm( p;o0alx  o3iyslm2rm(mo;u0altomo iotoptrlnvo;(  2xmxo3ou4al  lnci s)s2uau poo1aptn iciydlm rl(von(4arxoioctotlmtrlieslt0s2uoxmpio1al elnvt t  rtmump;o1opto fciatfaDran ont4aetrxfciy1lpte nvi;t) rxoxmpou4oleemict s)s2rmu o;u1tpeo octldfsDulnvs;(0 leoif3iytlmDr ivol(0srxoio3nudol n nctls aDrrum oo0aetnmfciadfs2rauvo u)texoxr3iytfm   n s;s texoim3iu1om   nci t) 2rrum ou1tlt ii3tat m elnvp;() rtrio3ta1faD auvs s0teur(r oo4lmtnmieias  Duax  ;u1oleomieildla2eln pnu4aetoio3iydlptrau sl(0 rtm(o3io1lptemiei t) rrm(ronu1apxoiocilsfs rmumo t4arxnmf iatlm ranvilt  rtmir3iu1ap nlfeta(  2tm(mo;o1aeeoiieiad s rmnmo;(4 reoxr3oo1op rai i;t0 rtmio iu1ol emicil(  rur(r ;o4aeen oetld a umnvpn()teenxf ta1fate n o;t)tetrir oydomtn fvs t)aDtmx pot0altn oeiytfa rmuvsnu0arerirciydfmt luvi s)teuoxr nodlpe lnciat aDtrxro;o1oex  i3ilslsDemuvo;t0trtoxf3iadomDrlivi;s0seto(opnu1ole miesls arrmxrpoo0tltnmf3iat aDul(vp u) rxrxf oa1oate ueols)setoim3oy4ol emfeiasfa2trx  ou0oet io3iat s2em(vp;t0 rxnmf to1fat auvi;(  2toir3iu4al nmnvta()a2rmu  ou0oexomo3iatlaDranvo;u0texrif to1lmD aivo;t)srum(opnu4apeelneiatfa2uaxm ;t1aetoiociyslsDeanms;u) lxomo iadoaDr uvi ()trumiopno4ole mivsat) Dua(mooo4aeenmo3iltfm emuvsn() etnxr todoat luvo ()sexoxopoudomt  ictat)s2trumpou1tleoif3ildfs2rauvs u0aexnir oydop ean ol(0srurxopnu1lle lics tf 2rmum oo0opx iietad a2emu pnt) eeriociy1faDe n o t texoxopio1al nlfeia( a2urxmpou1tle iiciatfs emumpnt)aetoif iatop rlnvols) etmir nydllt  fetlt) Dur(m nu4teen fctltlmDemumonu4aexrmr ootfmDeauvols)trumxr iy1oltnlieilt srrmu pou4olenmfetas aDumu s;(0 ltoxrciodopt  ies s teumxo3iy4lmenlieslt) rtmur ;t4tpx mfeiydfs uln o;(4aleoio3ia1fa raivi s setrxm3oodlm e ieta(faDrrur ;u4aexomfetadfs2rl(vs;t) exrir3oatlatrln o;s t2trxrpou4apenmneiat a2ra(ront4apt  icildls2umuvs (0tetrmo todfmt au slt)trur(m3iydll elfctatf 2urxmpot0teenio3tasls emuvo;()aeeoio3oy1op   u ols) eumir3oo1omtn ictl(  Dur(ro;u0oex mociys sDulnmon(4 etoxrcootomt livs;(0 etmxmpio1apenmfeia()aDuaxr ;u1olt mi3tasfs ulump t4altoxr tytlm rlu s;s setmxrpoy4lpenmncs ( arraxrpnu0aexn octydlm elnvs t4trenxfcoo1fp   ieils)s2uo(rpoo4ll nmfvs (fsDurxroot0oexomoctyslm rl(vo () lenif3todlm eaieo;t)trur(o oydamenmncsl( arur(mo;t1tex ioetlt s2rl(vs u) eeniocoa1fptran o s0setr(o iu1am   fcias)a2umx pnt4alxomociysfaDrmn p;(0 etnmfcoodfm rln o;s0s2trio io1ap nmnvias)aDum(mpoo4oet  ictydlaDuan o;(4 eenxociotlptelu i s  euo(r oudole  icsas)s2ra(ront4opxn feiatfaDumn o;t0aetnxr iotlpDe nvs ( srumxm ny4lmtn fvs (fs2rm(mont0apxnmictas a rlnvp ()tltoioctadomtraivi t texoxrpnudap emfcil(f ruaurp;o4aex miciltls2ranmon(0 rxomr3oo1oate n i;()texmxo3iodllee fvtas) rur(root4ope ifeiyd m2em(ms (4arxnxo ia1opDr nvi;t0sexoirpnu1lle  ncsasfarumu o;o4opt mociyt m uluvo;(0trtnxf ty1fmD lues t) rxoim3nydale  fctltfa2raumpnu4aptnif3ils s umuvo;()altnifciotfptr uvi;t) exrim3nodlmt  nvslt  rrmu  nu0aeeomfetltlsDua(vo u0altnio3iy1fptrlneo t) exoir oy4lm  lfet sfsDurx  nt0olto ieiytls2rauvo;t)teenmf to1op  au s t)srtmir3iu1amtn ivil(fs2raxm ;o0tpxnif3ias s2ra(msnu)tltomf3ia1fa   ueols0 euoxm iudlmee fcsltf rrrumo;u4oet iieiatfm emnmp u0 renxr3iotop eaivsls)teto(r3oudlme miei t)sDrrumpnu4oeeoii3iltfm eau snt4 eenxo tytla   ivolt0texoio3nu1apeemivta( arrrxro;u1alt ioeild a ul(msn(4 ltrxrciytla elu olt) eumxo iy1ll n fcias) Drrxm nt0optomfeiys a eanvpn(4 eerifcoadlatrau ols)texrxrpnu1amenmici (faDtmxmoot1olto feiltlmDemumsnu0aeerxf io1lp e ivs;()s2tmim3nudlle mieiat)srtrumpno0tpt mfciyd m2el(msnt0 etrmfciy1oa elivslt)t2urirpoydomt mnct s)a2uaxro;u1altn f3tltla2el( s (0aleoio3ta1laDraues s  eum(m3nydolt livt s)aDrrurono0apx mieiadfaDrln s;(4aeeoircootlaDe ivols s2urim3oodomt miet sf 2um(rpnu0tpeoiietadfm elnvs;u)arxnmo totla rln o t)srxr(rpoo1am  mnvt t)a2ra(m nu1aee if3tysla2rau ont0teerxr3tytlmDelnvs;t s2trxm oudale mnvtasf rtrurooo1tpeo ociatfaDeanmpn(0 rxoif iodomD ln ol( t2uoiopno4al   ics s)sDta( ooo0ale ioetaslm2ranvs;(0 etoif3ootlpD lnes t0trtrir3nu4lle  ivslt srrmurpno0opeoio3tls aDean s;() eeoircta1oaDe u i () etm(r iy4lmt  ictlt) Dtmum nt4oeenmi3tasfa uln o u0arxrmr iotopD lnvs (0srtmxmpiy1opt lnesatf Drmu o;t4altoii3ild a ulu p;t0teerircio1lpt au i (0 2umxr ny4ap  lfvilsfaDtrx  ;u1aeeo ieiydfa2rauvonu0altomrcty1oaDeln i;( seurim nu1apee nct s)s2tm( o;u0teeo icilslm rmumpnt4aeerxo3oadfa  lneolt teuoxmpnydlm nlietat)aruaxrpno4tlenio3ilsfs2elu pnt4tltoxfcoadfa eanvs;( s2xoxo io4al e fcta( arraumpno0tlt iiciasfmDemnmo;(4trtoxr tatopDr ueo;(0 eurir oudalt  ncslsf Drauro;u0oetn i3ias m2rau pnt)trxnxr3iodomte n i;(  etrirpnu4ap  lict ()s2tm(m ot0tpenioeiytfmDrmnmp u)teenir totoptrluvi;t0t2uoimpio4alenmnvtas)a2tauronu0optnmf3iaslaDean o;t0trxoio tydfat  i i;() eto(r no1ope mnvia(f Dtmxr no1olen i3iydlm2eauvo;u4 renio ta1omtraieo s tetrirpoo4optn fciat aDum(m oo4tetniiciytfaDuanvo;u4 exnmo oodom  li ol(0 2uo(mpiu1ale  feilt a2ua(mpno4aexomo3ilsfmDelumo;()artrxo3iadlaDrlueil(0s2umxopnudlpt lfviat)a2rmxmoot0olt  i3tytlm2eanvsnt4trtrxo oodoaDrluvs t t2tmimpou1olenmnvsat srrr(mpno1apeo ociasls em( ont) exoif todlaD ln il( trxr(o3iy4lm emivta(fsrtaxr ou0opx mfctlsfs emn onu0trtrmfcoatlptrlneslt srtr(opou4ol elicslsf 2tau pot0tltnmfeiasfa2ra(vsn()aetomrcoa1fmteli ols0s2um(o3ny4lp  lnetls sDumxm ot1tpt ioetydfa2rmn pnt0 leoxr oy1optelueilt)sexmio ny1ape  icia()sDumxmoot4apxnif3iys aDua( s (0alenmrcoydfa ean s (0s2uoim3ny4lmenlivslsfsDuaxmpnt4apenmiciyt s2emumo;u)teenio3iydom rlivsl(0t2tr(r no4lmee fvtls)sDrrum ;o1olt ioeiyt m eln o t0 rxomf oadop   n ilt texrio nudom nlfvt s arta(mo;t1aeenmietltls rmuvsnu4 renmr totfpteaiei () rumimpio1al nmfetatf rrm( pno0tee iietysfsDum( on(4 exoxf3ootfp e n s;s) rxoio3iu4ol  lnvtlt srtm( o;o4aexn i3ild s2emuvo () ltrmoctydlaDeai ols0trxm(m no1lme lfci t  2rmu  oo4tpt if3ilsfaDelnvs;t) eerifcoadfmt ai s;s0t2toxm iudop emfetlt  rur(m oo4oee  o3tlt s elums (4treoio3iytfat ai ol(  eurxo nu4alee icil( sruaxmo;o1tex  fetlt s2uluvp u)aetnio3tytfmDran s t) exm(m oo4lleemictls) 2trx  ;u1teto ieias a2emnms u4altoxr3oodlpDeluvolt0teuoimpio4op elics tf 2rmx  no4tpeoif3iyt a rm( sn() rxomrcoadoateln o;()sexrxrpiy1lmenlnvtls) 2tm(mpoo1tlx  oeiadlmDrlnvp t4 lerio3ty1fpDeau ols)t2tm(opnu1om  lict t s2trxrpot1ope ifetltla ea( pnt)trxnirctotlmtraneo;s)srurirpny1ll emnes (  rurx p;t1olxn i3tydlsDul(msnt0 rxnif todomtelivi t0seurxrpio1ape lnvi tf Dtmumpnu4aee  f3tad s rl(vs;t0aeermfcootfat ai o ()trxmirpnu1lpte icta()srtrx p;o1texoii3iyt mDrmump;t) etrif oytomD lueil(0srumxo3oo1alen feiat) rtmx o;t1aleo ieild s2uln p u4 leoir3oa1om rluvs;()texoxm nu1lmtnmnes s) 2trx pot0tetoiociasfs2ranvs u)alxnxo3totlpte nvs;s)t2toim nodop elicia()s2um(rpno4ole  fciyd mDelnms t0trenioctytfmDranei;t0texm(m3nu4ape micsl( aDrm(  ou4tptomfeiytlsDul( s (4tetrmf ty1lm raneslt teumimpnu4lmtemietls)sruru o;t4oeeo f3ildla2ea(vp;t)teenxo tatop   n i;s0s2toxr iy1ap  mics ()sDta(r ;u1oltomocias s elnvo t0 rtrmfctodlm rlivsls0t2umio iy4ale  ncsa(  2umurp;o0tex mictat s ranvpn(0tltrxociadfp   neils) eto(mpoo1om nmfviasfsDua(  ;o4tee  o3tatla rl(vo;(0tetnif3iytfpDr uvi () rto(o3oydalen nvtls  2taxmont0opt iictlt a2em( o u0trtnmfcta1lpt lues s0srurirpnodal   nviat srrr(ro;o0apxn feiyt s rmumo u4 etrxo3oatoaDeanvs;t teuo(m no4am   icsat s2rr( pnu4tpxo icildlm2uln o (0 rtrmf3todoatr i i ( t2tm(m nudole  nvt (faDraxm oo0texoio3iltfa emnms u0tleomfctytfm  an ils)s2xoio ny1lmtelnesat  rurxrpot1aleoif3tltlsDrlums;u4arxrxfciadfatranei;(0 rtmimpno1am e ict (f 2rr(ro;u1tpto ieiadfa rmu pnt4arxrmociytlm rlueo s0trumxm no1ame  nci ()s2rmurono1oetoif3tlsls2ulu o u4 rxrxo oo1lmD  nvol(  exr(o no1lpe  fct t a2uaxrpoo1tex mfciytlaDrl(vs t4 rxnmr to1oatelues t0 euo(o3oo1lpeemnvt ( aDra(rp;o1tlto i3iadfa eluvs;(4 exoif3oydlmtelnvol(  2xoxo io4olenlivs (  Dta(  nt4opeomoeiadlmDra(vs;t4 reomocoadlpDrlues s)seur(opny4ol e ics t  Dum(r nu0olt iicilslaDel( s;t4alerif oa1late ivs;s) rxm(r oy4ll   nvtltf 2tax o;o4oltn i3ildfmDrln p;(4tetrircto1omDranes t0t2tm(m3ou4op e iciatfsrtaxmono1ale mo3iyd s2eaums;t4 lxomocoo1lptrln s;s0srxrxmpiy1omtelnesls) Dtm(mpoo4opxnmoetysla2rmn o;()artoir iatopD  nvi;s t2toim3oydlm   fes ()a2raxrp;u4alxnif3iydfaDea( p ()tltnmr3oodfmDe ivols0trxmxr3no4ale mivi s) 2uax  ;t1aexomi3tldfmDul( o;()aexomo3oydoa elu s;( t2urxr3oo4opt mivt s) 2raumo;o1alto iciltfmDrmuvsnt)aexrio oodop  lu il( truoxrpoudop n fcsls  2ta(ronu1oeenmictat mDrmu p u)tltnxo3oo1om raivo;s trtoxo nu1open fcslt  rtrx p;u0oeeomfeildfmDeau s u0alermf3tadlmD an o;s s2umxr ou1aptn fvslsf 2ta(m oo1oetnmietydlaDrm(ms u) rxoir3oadop rluvs t truoim iu1lm e ncsltfsDrmxmpno0tlx io3tytfs2rln ont4 rtnir3oa1faD an i () 2umio3io4apte iei ( s2rmu o;o0tetnmf3tldfm2eaumpnt)trtnmo3todoptraneo () 2um(opoy4apeemicsl( artrumoot4opeomictltlaDuluvp;u0 lerxoctodfpDeanvi;s0 rtoio iudolt mnetlsf Durxrpno1apxoifeiytlsDran o;(0tetrmo tydoat  nei;t  2urxmpny1am elnct s a2rr(m ;t1altn ieilsfa2raumonu)aetomr3to1opDr nei;s)sruoxo3nu4lme mncs sfaDtru pno0tpxn fciad a ua(mp;t) rxoif oytlaDrlies;()t2tr(m3oodale lfcsatfa2rmu pnt4tltomoetlsls2rln o;t0 rermo3todop elu ol(0truoxm oydaptnmictatf 2rmum nt4ape io3iytla2eanmonu4aleoxrcoodfp  au i;s srur(opny4al   neiasfsDrmum nt0tex iociatlmDumuvsnu)tetrmfcia1lmt ai i;s0 etoxrpiudaltemieia(fartm(r no4apeoif3iydls eanvsnu0 exnifcoo1opD au i t  rxo(o ny4amtn fvi t  Dtrum ot0tpe mociadfm2ua( ont4tetnmfcoodom  anvi s trumxmpiudomee ivil()sDrauront1oleoii3ilsfa2uluvo;(0 eeoir todfa  lu i ()srtm(opoodlm   ieta(fs2rr(r ;u4tleniocias a2eauvo u) eerio3iadfaDrlnvo;s) eumim oudamt mnvtas artr( pnt1aptnmicilt m2umuvp t0artoxo3iy1fa eaivilt trxoxo3oo4lptnmncias  2raum nu4tpx ioeils m um(ms;u) rxrmf3iadlmtrli s;t0s2urio3iodapt  fvsatfsDurxrp;t1tee  fctldfmDuau p;(4 rtoio todfpt lnes;s) 2xoio oo4am elnes (farumur ot4altnmiciydls uaump;u4 rtrxf iy1optelnvslt)trtr(m3ou1ol  livi ()sDtmur ot0aptn fciadlm rmu o (4tleomf oo1lp rlneils s2tmio iydlp e icsl( srumx p;t4apxoifcilt sDrm( s;()tltnmf3io1omDr n ol( trxo(r3iy1lmtnmieia( aDuau poo4oee  o3iyt s2el( s;(0arxrxo3oodla e nvols trtmxo ny4lltnlfvta(  Duru p;t4oltniociasfa2ra(vs;t0alenxocootla eaivs s trxoxo oudome  icsas) Dumu pot1oeen ieiyt s ul(ms (0tlerxr3ootop  ai i t s2toirpnu1ol e fvta()aDrau p;o1tlxomicilsla eluvp u0alxrmr3iadfmte ueil(0s2xmir3oy4altemnct t sDurxrp;u4aeenii3iadfm rmuvo t)alxrio ty1lm eauei;s)trumxm3io1ap elivs ()aDrm(r nt1texn oetadlmDrau snu4arxnxf3tydlp e ivils0 exmxo ny4ome  ict t artm(  nt1oltn i3ildfm uanmpn(4texrmocoodfm elivs s0 rtrirpnu1lpt  nvtltfa2uru pou1ole mociat s umuvont)tetrmf3oydlatr neo (0srtr(rpnu1aleemncta(  rurum ou1opx ifciytla umu o u0 rxoircty1laD ai i s  2xr(o3iy4ole mieias)a2umum oo1opxomf3tadfa2ea(mo t) eermo3iotopDe u o;(0s2um(r nu4am emncta( s2ra( ont1optoifctadfa2eln o;(4trtomf3tydlpD livil(0 2xo(r oodome  fvt s) 2um( ono0oex  o3iytfa2ua(vs u0 ltomf3ta1omt  ieslt  rxmxo3no1amtnmicsls) rtmx ooo4teeomfciadfa um(mont4altnmo iy1fmt anvi ( texoir nudameemfei s)s2rmum ot4alxoii3iyt s emnvont)alenmfcoy1fpDe uvo (  2xo(o iu4omtnmieta(fsrur(  ;u4aptoiictld m ean o;t)tetnmocoadlm rlneo t0s2umiopoydamee nei sfsrrru  ;u1apenif3ilslm2uauvpnt4aexoxocootfpDe nvs s0 rxoim3iy4omeelncslt)aDum( oot4tex  oeildfmDul(vpn(4trxnifcio1lp e i o (  rxmxo3no1ol nmiet sfaDrru  ;o0teto ieiat a rl( p;u)texomf3iydom rauvs;s)srxo(mpoy4omenmncia()a2uau pou4oet ii3tas a2uauvonu)aeerif oydlate ies (0 rumirpnydlmt miesls sDrru  ;t0alx mi3iltls2ranmp t) rermf to1om r neo;s) eurxrpnu1lm n nei t)a2rm(rp;t1optn f3iad mDea(ms (4tetnir oy1op r ivslt)tetriopnodale  nvia(  Drax p;o1oeeoifeildfs ulu s;u)aetnio to1omDeluei;t0t2trxm ou1lmt  nvs (fa2tmxm no1oee mo3ilslm rauvs;t4artnxfcoy1lm elnesls)t2xm(o iy1am elieslt arrrxm ;t4oet mieild m umn s;()aexoif totlmDeauvs;t trtoxm3iydom nlnvta()aDtmx oot4olenmfciat m uauvo;t0 ltnirciydfa ran o;t) ruoio3ny4ll  mneta(fs2urx pnt1tptnmoetls m2umn o;u) eermo3iydlmDelueslt)t2tr(mpiy4om  lnesls  2tau  oo1tpxnifeiydla2ulnvp;u0 rtnmf3to1lmDrau o;()tetoir iudlmt lnvt s srrau pno0tltomietlt aDeanvpnt) ltrxr3oatlm rlues s0t2xr(o3io1opee ivi ()s2rmu ooo0aeeomi3iyd s em( s () exoxr tydfmtean olt0t2xoio3no4omtnmivsl()srtaxr ou0oee  fetys sDrlu p t) lxnxf3iadfpD  ieo;t0s2umxr ou1am  micia(fsrrmx pnu0teenmfciysfm emuvp;t0tlenif3oadfmDrai s ()srxrxrpiu4altnlietls) 2raump;u0tlt  oetas a rl(von(4texrxo3iytoaDelneo;t) rxrxm iu4ol  mfcsl( aDumxroou4tpx  oeiyd m2eluvo ()arxomf3tatlaD li s s  etmxo3nodlleelfvsas) rtmxr nu4tlxn f3iyslm emnvsnt0texoifctydfa e nvi;s0sexm(m3nodamtelnvtls)arua( pno1altoifetatfaDum(ms u4aeenif todfa eaies ( s2trim3ou4alee fcta()aDtmxmpot0opt if3ilt a2rmn o t) lenmocoydla  lneils0 rtrxm io4lp  mfesa(  rum(m nt4aetoiocilsfa2umuvo;t4aleoioctytoa  ai il( tetmirpou1ap  lies t sDtaurpou0tleoif3iatfa2em(vpnu0 ltnio3tadopD  nvil(0trxmxm3io4ap e fcsat aDtrxmpnu1texomi3iatls2em( o;()trtoir3tydfpDrau i (0s2xm(o ou1omtelfvsa()sDraumpou0teeo fetat m umnms;t) rxrio3ia1lmt lneslt0sexrxm ny4om elnviltfaDra(ro;t1olxn fciasla ea(mpnt0treoio todopt lieo (0 rxmir iodlmteliesas)aDumumoot1tet mieilt s rmnvo;t) rxoio3oytfm  livs;t0 2tmxr ny1ope lnetl()s2tmxm ;t1opxnif3ilslsDrm( s;(4 etrmfcoy1la  liei;t trtoirpnydal emicilt) 2ta( ooo0alt mi3tldfa2emumo;(0tleomfcoa1oatrlieo;t0 rxmim3oy4lle lneil()sDur(  no0olenioetat a2um(msn()tlerxr iy1lmteaies;t)tetr(m iy4optemivsat s2umu pou0opt  f3iadlm2emu o;(4areoio3iotoptelnei;t) exrxmpoo4amtnlieslt  2rrxmpou1tlx  ietadfa ea( o;(0 rxnxr3oatfa  lnvi s0 rumxm3nu4apeemnvt tf Dtrumooo0alx mocils a2eauvo;t)trxnmo ta1fmt au ils0teumxr iu1op elneil() rum( pnt1tpeoioctasfmDrmuvp;u)alxoif oadfpte nvo ()sexrimpio1ll  mncs ()a2truront4tlxnii3ildfa2ran o t)tlenmo iytom rlieslt) ruo(m nodolenmfctas)s2tmx pot4ale  oeiltls ra(monu4 etnio3tydfpD  neols)srurxo ny1lmenmieiasf 2tmuront4olxoiociadfaDuau o u) rxoio iy1op  li s s  2to(m3ou1oltelictlt srua(r oo4opeomf3ilsls2eauvo;(4texomrcoy1op  ln ilt) ruo(r oydaptemfvtat  2trxr ou4aptn i3tlt a em(vp;t4 etoxfciytoaDraneo;s srurxo3iodllt lfvilt srta(  ou4aetnmfciatfmDem( p u4tleomr3ta1lm   ueo;s truo(o3iu4ape mnvsls)srtm(rooo4tpto iciysfa ua( onu) lxomfciytoa e ivo;s)s2xoxo nydapt lnctltfa2umum nu4opxomi3iys sDul(vo;u)areomocio1fm elneils srtrir3oydapte nciltf rumum ot0aee ifeiadla ea( p;u0 eerxoctodlmteln ol( sexmxm3iy1openlncsasf 2trxro;o0oleo ieilsla ua(vo t4trtrifcia1oa eaivol(0trtrim3iy1apenmiesasfsDur(rpou4tlxomocildfmDran o;u)aeeomo3ia1lp rluvo (0sexoxo ou1ole lfet s)s2rax  nt1alxomicildfa ul(vsnu0tltnir3tytfm   uvil()s2xoiopnodoltnlfctat)aDrmurooo4aet moetadfmDul(vp;(0texrxo3iatfmtr n s;(  rurxm3ou4lptelnetltfarrr(rp;o0tptomf3ias mDumnms ()artrmf3tadla e neils tetoio iy4lmen ivslt artm(rooo4aet mo3tad s em(vpnu0 rtrmr to1omt  i ilt0srtrim iudop elnetat)aDtr(ro;u4openmoctadlsDrluvo t4alxnmfcto1fmt anes;()tetmir iy4ap e ict t)arra(mpnu1apt mi3tas aDeanvont4tlxrmo tytfaDeli s;()srxo(m3nodllte nctlt)arraxmono1tpxo o3tad s um(vsnt)tetoxr iytfp rluei s sexmim3oodamtelfvia(f rumxrono1texoii3iyslaDul(vont)tetrmo tatfatraieil( t2urxm nydalenmneia(fs2urur no1alto i3iyt s2ul(vs;t4alxomo to1lat lnei;s  exm(m3iy4lleelnciat)aDurxm ;o0tpe  oeildlm ua( pnu)tltoxr3tadfaD lu o;s srxoxr iu4omeelfciltfsrua(  ou1opxnmo3iltlmDem( o;u0 etniociytlptelu s (0seuo(opoo1lmtnliciat srrru  nt4optnmf3iasfs2ul(mp;t4 rxrif3oodomDrai s t  etrio3nodol  lfes s sDtaumonu4altnifetydla2uan s t4alenmf todfa  aueo;( srxrir iu4apee ietatfs2taxr ot1opxn i3tadlmDeau pn(4 lerio tadlpDeaivi t)sexoio oudaltnmfetls arumxrpnt1teeo f3iadfaDrmu snt) ltnir3ootopDeaies t) rxm(r iu4omtelfcs tf rua(r ou1tlx io3tltls2rm(mp t0aexrxoctydla raneo;s)seumiopno1aptnlncsl( aDrrx  ou0oeenifetadlaDul(vp ()trtoxf iytomDraivs;()srxoxo3no4lp nmiet t)s2urx o;u4oeeoiocils a2uan s;()aexomf tadomte u i;s) exmxr3oo4aptnmics sf rta(mpot0tptnif3tyt sDrl(mpnt4tetnio3iodoa e ueilt0trxoimpiy1ll nmfeias arrau  ot4olt mo3tldla rluvs u4 lermr3to1om eaiei t)t2tm(mpio1op elnvt s s2taurp;t0tetoiiciytfm2rmu p;t) lenioctotoaD anes s  exoxm ny4al emnvt sf Dua(r ot1oexomociytlm el(ms;(0tlxomr tydlp ean ols srtoio oo1optnmfcsls  2umu  no1tpto i3iat s2rln p;()aexrxf iydom raueilt)trtoxm3iudll  mnvta(fs2tmurpoo4tetnmfeils a emu s;u4tlxniocto1omDean ol()trurxm3oy1optelivsas)sDraxront4texo o3iadfm rl( p;t) eerir tydlmD  i s t  2triopio4alen ieiltfs2rm(moot1tlen oetat m rlnmonu4trermo3ta1fpDeaivo;( teuo(mpoy1alt  nvtls s2rru p;u4tle mfctysfs2ra(vp;t4 rtnxfciotfp  aivs ()srtoiopio4alt lnct ( aDrrxrpoo4tpe mf3iadlm2emnms;(0teerxr oadlmDr uvi;()srxoiopou1openmnei tfsDrax pnu4aeenmfeiydla2el( pnt4 rerxf oadlat  nes;()t2uo(mpiu1alen fei sfsrua(mpno1opxnmiciaslm ra(ms u)tlenirctytoptr uvo;t) exr(opiu4apt lnes s) ruax  ;o4opx mi3tltfs uanmp t)tltoxf iy1fm e nvs s) eurxrpoy1ap  mfvs ( s2rmu p;u4tpxnif3ild m rm(mo u0arxomo ootfaDr i i;t teuoxrpnudlltnmfctasfsrtr(m oo1alxn ieilt s2umuvs;t0aeeoxo3ty1laDe n olt) 2xm(o3iu4lp e nvil(fsrtmxmo;u1olenmfetadlm2rluvs u4aetoio3iy1latr ies t0 rxmxm ou1lpeelnvs s) 2ururo;t0apeoif3tasfaDelnmo (0 etnxf oo1laDr ues s)trxrim no1aptemivi ()a2ua( pou4ape  f3tls a rmnmp;(4altoxf3io1oaD lieo t trum(m oy4lpenmictltfs2rr(m ;t4olxo oeiyslmDua( pn(4trxoif ia1lpteai s;t0teurxmpno4lmtnlfvtls sDuru pno0oex  iciadfs2emn s;u)tleoir3ia1laD  ueslt)truoxo3nu4omee ivi ( aDur(m ;t4alx  ociys sDrmu pnt0aeeomfcty1oatean ils0t2xmim3oudole  icia() Duau  oo4aleo iciysfmDuaumont)alxnxo3ootla  lnvs t)trtriopou1lmeemneilt  rtr( oot0texomi3iyslaDrlu p u4teeomrciatfmDe u o () exrxr ou1lleemfet t srrm(  ;u0aee mo3iyd a2rlnmont4altnmf3oa1oaDeli ils  eurxr oo4alenmnctas)a2ra(rpno1aexn ieiytfsDumuvo;u0areoxociatomD  n ols truoxm nudopt lieilt srtr(r ;u4oexnmf3iltlaDrmu s u0teerif oydlpDe ueol( s2uo(m io1apee ivilt) 2rmumont1tltnifetldfaDumumo t) rxoiocoodoaDeaneo s  euoxo iu1amenmietat s2taurpoo1tlto o3iadfa2el(vp;u) ltoif iytfpDrlueils  2uo(r3nodaltelics (faDtmu ooo1tpen fcias m2rmu s t0tltnmociytlp  livs t) 2umio oo1amenmicils) Dua(mpno4oee iociatfs uan s t4tltnxr to1lateaueo;s  rumxm3nudom nlnvsat)s2urxmoot1aeeoifeiasla ua( o;u)teenmr ta1la rauvil()srxoxm3oy4olenlnvta( s2rrumoot1tetoii3iatlsDua(vo;t4aetnmf iydom e neo;t0 2ur(m oy4lpenliesasf Drr( onu0tlenmfetas aDel( sn(0tetnxfctydom   ivs s0 exmxopno4llen ncsltfarra(mp;t4aexo fetytfaDeln p;t)tetoircio1lpDr ueslt teur(m no1llen nvilt aDtr(  ;t0olxn ociadfm2ulumsn(4aetnxf3tatlm e ueil(0tetmir iu4openlncsls)srumuroot4oexnifciysfa2rauvp;u0tltoxf3to1lmD anei;(0t2xoio no4ap elfcsat)srururpoo1aet  i3iys a umnvp;()aexnir3oatomt anvolt0srxm(o3nu4lm nlfetat s2uauroou4aetnmfctldls eaums;u0 etnxfcoatlm e neols0s2uoxm iy1am  lneslt)artauroou0ole ifcilt m ulu s;t4aetoir3oatfaD anei s sexmiopou1lpe lfeiatfs2umum nu0oex mi3tys m emums (4trxrmo3ootomDranvo ()s2tmir3ou4apt mivta() 2rmur ;o1tetnmfetadlm rmu ont0aetnmr oatopteln i;s)s2urxopoo4lptemnesl( s2urxroou0olxoifciys m2eauvp t4teermfciytlaDeli s (0s2urxm io1ope mnes ()arum(roou1tee  ociydlm eau snu0alenircoo1fmt anes;t0teuoxrpou1lp nlnvs sf rumx  ;t4tpeo ieild a rmn s;() eenio iodfa eai o () 2tm(m iu4op  liet ( aDtm( pou1tlxn i3iatls2ul(vonu0aeerxfciodlpD  neo;t0 rxmim iy4lpee fvsa()s2trumonu0olx  ieiat m ea(vp t4aexoxo3tadfp eaneol( sruoirpno1ol n fvi sf rtrx pou4tpt  feiydlmDrl(mont0aexomo3oa1fm rlueslt) rtoir3ny4ol nlies ()srumx  nt4oetnmociltls rl(mp (0 rerirciy1oaD  u i;s) 2xoxo iydol nlict s) 2taxr nu0tltomiciydls2uau snu)teeoifcoatlmte ivol( s2trxopoudopt lnei s)aDrm(root1aetn ietlsfm em(ms;(0tetoifcootla  lu s;()s2xoxrpiudomenmfei (fsruru pnu4aee ifciyt m2umuvpnu)trenxf3ta1fmt  i il(  rxmimpny4om nmfei (fsDua( poo1alxo o3iyt aDrau o;t0 exoxf3oadop  ln i s)srxrimpnodlmee fcsa()srtmurpot0aeeo icils a rmuvo (4trtoio3oodoptraieo t0trumio iudaptelfvt ( sDumu oot4tpx  fciadlsDulu onu4 exnmfcoadop eluvo;s) exmxr no4olte nvsat)srumuroot0optomoetldfa2uluvs;u4 rtomo3to1op  ln i () rtrxo oy4lmtnmfvsa( s2trumpnt0opxomi3tasls2ulump u)tetomrcoa1om elnes s0srxr(o3no1lpte fct t a2tm(mpnt0tlen ietldla2ulumsnu0arxomf oodlp elu o ()texm(opnydapt mfcta(  ruru o;t4tltn iciatfm2uluvs;(4tetomf ty1oa r ieols)srxmio oudole lfeiat aDtm(rpnt0olxomiciysfs umnmp t4aeenio3iydopDe ues;s)srxoimpio4altelncilt aDumu poo4optomfeilslm umnvo;t4trtomo3oadoat  ieo t srurir3ou4lpte ietasf Dum( pnu4tle  oetydfa2umuvo;(4teerxf iytfmDean o;s teum(r3ny1amt mfvslt srrr(m nu4texoiiciydfmDrmn on(0alxoxoctydlaDe n ils0t2xrim3oy1lme  fetat s2ua( pnu4tpx ifeiydfa ea( o;u0 rtoxf3oy1lat  neo;t) etoirpoy4al  mfcil()a2tm(rooo0optoioeias a emn s;()trtrxrcoatfat ai il() 2xo(m3io1ame  ivi tf rrauro;u0tpxniietat s2rm( sn(4artnmrcoatfmteli o;s srtoir3nodlpenmfci s) rtmur no4ape ifciytfm emnmpnu0aeeoiocoydoatraies t)t2tm(opnu1lltnmicta(  2ur(  no1tex mfctadlaDea( ont)areoio3to1fa  ln i t) 2urxmpiodom   nctas srua(mpnt1texo f3iys m ra(ms;u4tleomocoy1fmt liei (0s2ur(m3iudolenlfcsls aDtm(ront4tlenmoeias m2uauvp;()trenif3ty1fm  auesl( seurir3nudop emnvt t a2ururpot0tlto ieiat m2rlums u4tlermfciodfaDranvi;() exmio3ou1lpt  iesl(f 2rmxm ;u4olt mieiyd mDrmumpn()altrir3tadfm r n s;s) exmio3nudomeemfvs (f 2rrxmont1oex  feiad m rm( s u0arxomfcoadopteanvi ()trxoxrpnu4aptemfvt ( aDtm(rp;u1teenmieiaslaDelnvp;u) rtnmf3oydlm  anes s s2ur(o3nu1am n netas) 2tauro;u0oexoifeiadlm2umump t4 eermoctydfaDr ivi;t t2umio ou1ol nlfct s)a2rmu  nu4apxoif3tad s uau snt0artoxr iydoaDe i ols)t2urio3oo4llt mfcsltf rtrxrpou4aexomfeiys aDumuvs t)alenir oy1lateluesls)trxmim iy1lmtelivilt)arum(mo;o0openmfcild m ul( s u0 eeomr3todopte nvil()t2xm(opnu1ol elncil(fsDrrx pnt1altomo3iytfm em( s ()artoif3oatlmteaieols  rxr(rpoy4lp elies ( srtrxrpnt1oltn iciytlsDean o (4 rxnmo3oy1lptr nvols  2uoxmpiu1lmenmfvia()sruau  ;u4olxomfciasfs uln p;(4trxnif3oadlpD ln ils0tetoir3iydomeemivi t)a2rmu p;t1alx  feilt a2rm(monu)trxnxrciytlp eln i;t0 eum(r iudol e iviltfa2umxro;o0tex mictadlsDuluvo;()tleomr todomDranvi;(0trxrim nu4omt lncil( arta( oot4teeo feiatla2ea( p;()teeoircoy1lpte neo ()t2xr(opou1alte ncil(fsrtm(m ;o0aexoifctlsls rm(vo (0teenmocoadfm raiesls)seurim3nydamee ivtasf 2trxmpno0alx mfciytla2umnms;u) rerio3oydfp rli slt0s2tr(m nu1llen ies tf 2trurp;u1apxnioetatls rau s;(0arxnmfciadopt  nvi (  eumirpnu1am n ics t  ruaxmonu0aex  fciyslm eanvp;t4 ltomo3tydlp  ln s t0setr(o oo1openlfvt t) 2tmx  oo0tleomfeild s2uaump u)trermf3iadfp rlu slt0sexmio3iodom n ivsls) Drmxmo;u1alxnmfctyd mDrlnvpnt)tleoxfciytfpt aivo;s  exm(o iydlme  nvslt) rrmumpou1aeeoioctlt aDem(vsnt)teerxr ootop rlieo t0 etoxmpoodlme lfcias s2ra(mo;o0olt io3ilsla umuvo;t0tetnxfcty1fate nvs;() rumxr iydameelfctl(  rumum no4tpxn f3ild mDua(vonu0 lxoxr oo1opD au ol(0 rxmim nudameemneiat srua(ronu0apxo icild a2umums;t0altoir tadoaDeanvs;t)setr(m3iudlleelfvt sf Dta( pnt1olenmi3tadfa2uauvs t0 rtomr tatopD au i;()s2xr(r oudalen fctas) rrmx p;t4teeo o3tat mDua(mon() rxnxf3iytla eln il()seur(r3no4aptnlnvtlt) 2tmxmp;u4ole iieiaslsDuln s (4tetoxo3iotlm eai i;t0s2xoio3no1apeelfes (f 2rax  ;o0tlxnifeils m2elu o;u0texnxociotfmt lnesl() etm(r3no4ape  fvt tf rrr(moou1oee  ietlt sDulumo ()trxoiocoy1op eaieslt) ruoiopiy4aleelfesas) ruax p;o0oeen ociasla umumsn(4 rtrio oa1lpDrai ils) rur(rpnodlm elfesa(  ruau oot4tleo o3tasla eauvo;() eeoxfcoy1lat aueo s sexmim io4ll n ivsat s2tmur nt0tlt mfcilsfs umuvs;() leoxr3ia1oaDelu s;s0truoimpiy1omt mivi tfa2tmumonu0tltnifeiaslm2eanmon(0aexrif3iydoaD livols srxm(rpny1olt  ncsltfsrtrur ;o1oleo f3iatfmDelumsnu) rxoxr tytfaDe i sls0 2uoir oo1amte nviatfs2tm(m ou0tle mfeiysfmDelump t0trxoxo3io1lmD  nes t  rtrxrpnu1lptn nci ( s2rmxrpnt0apxo ietytfm umn sn() lxnio oadlp  lnvolt)srxrio ny1lleelfesl(f rrrxrpoo4tpeomo3tysla rmuvsnu0aeerir3io1fmDraivs;
\ No newline at end of file
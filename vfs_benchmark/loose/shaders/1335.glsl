@@ -0,0 +1 @@
+ieo (0 rto(mpoo4amee nvsa( s2rmum nt4tlx ifctysfm2ua(vs;u)trtomocio1fa eaieolt trtoiopoudoltnlnciatfartrx o;o0tlto ocild mDrmnvo;()tlerxo3tytla eli o;t)texrxopno4llt lnvtasfsrur(r nt4oee mf3iytfsDrmnmsnu0arxnifctotfm e n sls0tetr(m3io1apt mncs s)s2tru ono0texn octldlsDelnvo;t0tetrir3to1lp elueo s) 2tmimpoo1lpenmfeilsf Dumxmpot1oet  ociltla2raumsnu4trtrir3oodfpt ai s s) euoiopoy1lpe  ici s sDua(moou4opxo fciasfs rl(ms u0aeeomfcoy1lm rauei;t)s2urio iu1am nlfciatf Dua(mp;u0teto fctys mDrmumpnt)tlxrif3oatlaDelu olt  ruoio3iy1ol  mfesat) 2tau pno1opt  oetlsfm2ulnvs;(4tlxnmf3tydfa eluei;()t2xr(m ny1op n nvt t s2um(ro;o1tlt  ieiaslsDulumsnu)trtomo3ia1laDeau i;t0 ruoxo ny4am   ncs ()sDrm(r ;t1texn ictlsla2raumpn(4 ltoio oy1oaDelivils)s2xo(m3nodomtnmieiatfa2urump;t4tlenmo3ilt s2emuvp u0tleomo3oytoa e i o (0trtr(o io4lm   ictat)srur( p;u1aetnii3tat a2emnvp;t4tleoxrciotlaDrlu i;t)texr(m iydop nlieils  Drr(r nt0aetnmfcildla rlnvsnt0trxrxr todfpDr n o;(  rxoxopnodoleemietl( s2tm(mo;u0olxoiieiysls umnms;()texniociatfm  au ols) 2xoio3iu4lleemiesasfaDtr(m no1altniiciasfs2ua(mp;t4texrxf3ia1oaDrlnvs (0 rtrir ny1omtnmnet ()sDumum ot4tpeomietysls ulnvs;u)texrifciodlptelnes s0tetoxr3ou1am  livs s srum(m nt4tlxoiociadlm2umn p;(0 exoxo3oo1oaDelivils)srtmxrpny1op e ics sfsrtm( o;u4apt ii3tadlsDuau ont4tltnmr3oy1fmt  u s t) 2umxopnudllt lictlt aDumxroot4oetnifctytfm rmnvs;t)aetnmo oo1latrlneo t0t2tm(o nu1al elieilt  rtaxrpnu1tpxnifetytfmDua(mp (4trtomf3ta1laDr uvs (0texmiopiy1ame mfcsa()a2rax  ;o1aleo fciysfa rm(mo () leniocoo1opt ln s;t srurim iy4omenlietls srtaxmpnt4oleoio3iytls rm( onu) lxnmf oadlm elu i t0t2xr(mpou4lmtn iviltf 2rmx o;t1apx ifciyt m ra( s (4teeoxfcoo1lp ranes;s0s2xr(m oy4am nmnetasfarum(mp;u1tlxo ietyd mDrl( ont) etnmf ia1lm  aivi;t) ruo(mpnudlmtnlies ( s2rr(moot4tpxoii3iad s el(vp (0trxrmf oatoaDrauvi ( teur(rpiodom elncil( srtr( pou1olx mo3iadfm2emnmp;(4tlerio oy1om r ies;s trtmxr3io1op  lncs sf Dtrumoou0tptn iciatfm2em( pnu4 lxomo3totom   n sl() rtm(opny4altn nviasfaDrau onu4oexoif3iys m2eaums u0 rtnmr iotop raieo ( sexmio3nydlmte nesl()srrm(rpnt0opt  fetas sDumuvs;(4alxoxr3ta1oaDrau olt s2trxm3iu4omenlncs t srtaur ou1tlenifctatfs2uln s;t) rerxf todfatelueols sexoxr io4om   iviltfsrtrxr oo1openii3iaslm ulnvo u4trxrxrctodom r ueo (  eurio3oo4lltemfvtl( a2raurooo4olt  feildfa ra(ms;t)tleomo ty1faD an ol(0t2xrxr iu1lme mnct t) 2uax  no0tptoiieiyd m2umnmpn() reoiociodfm  aivil( trtmio3oo4lme lfetat) Dum( onu4aleoif3ils sDem(vo t)trermo3oodfpt aivi (0srxmxr3nu1op elfvtasf 2tm( pot1apt iieiatfmDra(vo u4trxoio io1fa ean o t s2xmio iy4apee fvsas)srur(r oo4teeomfetytfa ra( o u0 rerxo iadlp elieo t) eumxm3iydop  licsl(f rtm(r oo0alt  oeiadfa2rlnms;u0tetomrcoytlpDeluvs;t0 eumxr3io4om emncsas)s2tmx pnt1apeomf3tytfm elu pnu)tlenxo ia1fm  lues;t)s2urio3no4ameelieias) 2um(ro;o1aetnmietlt m eln snu4alerio tydlatrlu s;( trtmxmpou4olen fesat)arrruroou0oet  fctlsfm2ul( o;(4 exrxo oatlm ranvo s0seto(rpio4lp n fesatfa2ua(moot4tlxo fetadfm2raump (0 lxrmfcoatfatrln i t0setmxopnu1om  lfes (fsDrru  ot1altn feiad s uln p () lermf totla eaieo t)trtrxr nudalenmfcs s s2ta(m ;t1aex if3tydfsDulnvonu)teeomf3iatfmt  nvslt sexmxrpoy4omtn fctas)s2ra(mpou4oetoifeiatfmDrm( o ()alerxf ootla eluvs;t seuoir no4omen fctatf rtaxmp;t0opt mo3iatlmDemu on()altnir3iatoaDe nvs t)trxoxm oudopte fes s) rra(mont1tle  fctys a eauvon(4 rtnxrcta1lm e ieo s)trumxm oo4ale mivt t)sDua( o;o4teto ieiatla2ea(mo;t4arermrciadlm elueolt s2xr(o ou1ope  ncsa( sDtau p;u1alt mfciat sDumuvpnt) reoio3tytopt  u slt) rurxopny1lp   nvs t)sDrr(moot1tlxoii3iysfmDua(mon(4arerxo todfmte uvil()setrxr oydlmt lfetasf Dua(mpot4tpeo feildlsDumuvpn(4 ltnmrcoo1om rlnei;s) rumxo3io4oltnmietas) rurxm no0tle ioctat m2elu p u0 ltrxocoadlaDe i o;() rum(mpoy4ame  feilsfsrum(rooo1oetnif3tlt aDeau s ()treoir tydfa raneo;s0 etoxmpoy4ame mivil(fs2tmum oo1oexn i3ilsfa ua( o t4 etomf iy1omtrlivslt0trxmim iu4ape  nvsl() 2uau p;o0ope iieiaslm2rauvs u0artnmoctytomt lu ol( srurim iu4op nlncsl()aDraurpoo0alt ioeiltfsDeluvp;u4aetomr3ty1omD  nvi;s)trxmir3iydol n fci tfs2umx oou0tex  ieiysfm emu snt0alxrxr ia1fp elies;s s2uo(r io1amen ncil( a2ururo;u0opt ioeilsfa rm(mpnu4 rxnxfciodlaD  ues;s setmxr3iy4omtn ivtat a2urx ooo4oleoiieiltla raums u0texnxocto1fmDrluvols srtoio iudlmtnlfesl(fa2tmu onu1aeenmf3iyt s2rau on(0trenir3iydfat liesl()t2xrxm iu1al   nvi t s2urx ono4tpe mfetys m2elu p;t0 rxrxfciodfat  neolt0sruoxm3ny1ap  mivi (farur(mp;u0tet  ictadlaDemnmpnu0aexnioctydomD  i olt) eurim ou4op n ies (fsDta( pnt0aexomociatls2elu pnu)teerif3iydfptelieo;s t2uo(o3iydll e ivsa(f 2taurpnt1oetnmicilt m rlu onu)trtnmo oa1oaDelnesl( s2urir3iy1alen nvs s)aDrrurp;t1aeeo o3ild aDemnvs t) ltrifctodfmDraieo;t truo(rpio1ap nlnesltfsrumu oot4altniictyd a2rmn s u)teeoxfciadfp   ieilt) rum(r3oy1amtnmfci s)a2ta(ro;t1alxnii3iys m um(vo;()tlenmr iotfmt  nvs;s0tetr(o iy1al   icilt aDrax o;t0oex  fciysla elu ont)aleoxo3oo1lm   ies t0srur(m oo4op e fesat)a2ua( ont1tetoifctad a2rl(mp;u)tlxrxrciy1fp raueo;t0 2xoir3ou1ope mfeia(  2taumpnt1texomo3ilslm2rl(mpn(0trerir3oytfpDrauvo;t0tetrirpoudlm emies ( arumumooo1texn oeiatfs2uanmo;(4aeeoxfcto1lmDran o t0 2uo(o3iy1olenmfcsa() rrmuro;t4olx  feildfs emnmonu)tlxnif3totfp rlnesls0srtrir iudamtn ieia( sDrrx poo4aeen ocildfsDelu s (0trtoxo3oa1late i sls)srum(m ny1opt livils s2raxr nt1apxnmo3iasfm uluvp;(4 rxoio ty1fa   u s ()t2xrxm3oy4optnlfet (f Duaump;u0altnmfeilsfs2raumo;t0aetnxr ia1opt lu sls) ruoiopiu1amt mnesasfa2raxm ;o4tlx mfciyd a raumo;t4treoir iytfm  ai s ()sexr(m nydamtnlfes ( s2tru ont4opeoiictytfaDel(vo;t)aetrmo3ia1omD livilt truo(m iu1lp nmivi ( artrum ou0olxnmoetls m2elu p;u0 lxnxf3oa1om ean slt t2um(o3oy1llee fvi (fsruaxmoot4tetoiieiadlmDrmumonu0 rtoxfcoy1fpDr n s () exo(r iu1alt livilt)sDtru  no1olx mietlt m2uaums;t4 leoir3ta1opt ln s t0sexmxm ny1aptemfvils) 2rr(mpot0olx micilt a ua(vo;()trxnir oy1lptrluvs ()texm(r3oodop  lfvsatfsrtr(rpoo4ope mfeiysfmDumnmo;u4tetrmo tytopDr u ol(  2um(o oudamt licil(  2ua(r no4oex ifctls mDrlnvp;u0arxomfctadomDraneo t) 2xriopou4apee fvtat  2rm( o;t1apx moetat s2rau pn(0arermocoy1omDe ivilt trtm(opio4al e fvtl(fsrrr(mpnu0olxnmoetaslm2um(msnt) eeoxo iodfm   neols0truoir3nu1lptnlnvt t)aDumxmoou4opx  octydlsDea(vo t0altnmo ta1lpDrauvs s0trum(o3iudom e ivtas)a2ua(moot4aee iociytlm2ul( s;t4 rxoir ty1lm r ies;s sexo(o ny4olt  ncsa() rumu o;o0oexn o3iltlm el(vpnu)trtoxocia1fptr i o s0s2uoiopoudlmte fesl()s2uau o;o4oetn i3ilt s elums t0trxnmf3oydfmteanvols)sruo(r3iudam nmicia( arurx  nu4apeo iciat m2emuvsn(4aeenxo3io1fpD lnesls truo(o3oo4lptn fetls)srrru pnt0tee iociys a eauvsn(4artoxrctadlpte ies;s0tetoio3nu1lm  lfeta( s2umu ono4aptn feiytla uln snt4 lxoxr iotfpte ieol(0s2xmxm3iudomtn ieil(fsDta( o;t0alenmociysla2rlump t4 ltoxr3oo1fmD  uei s)trtr(m oy1optemiet sf Dumxrp;u0apxoio3ils sDrm( p u4texrmr iadfm rlieol(0t2trio3nu1lleelnvils)artaxmonu1tle mieiysfs2emu s;t0artnir todfm eai o;s texmio3iy4lptemietlt)artauronu0alxoioetlt m emump (4 lxnmf tytom   i o;t0 rxo(r iy4ole  ncta(faDrruroou1oex  f3tlt m2rl(ms;(0tetrxo iydopDelnes;t tetoirpio4altn fes t  2umxmoou4alx mo3ils s elu p u0 exnmf iydfpDrai sl(0 rtmim nydop   ietls aDrauroot1texnmieiadfs2eanvsnu0areoio oytomtrln ilt t2xo(r3ou4alenmicias  rrm(mont1tetomocils sDem(vp u)aetoxo3tadomDr uvo;( t2tmxm nu1ole mnct ()a2ra(  ;u4alt moetysfmDra(mont0 lenxf tatlp raivolt0setr(o oy1omeemnetls) Dum( pou1apen fctltfs2emn p u)arenir iydoa  luvo;s0sexm(rpiydamtelnvi (  2rm(mo;o4tpt ioetatls rluvo;(0tleoio oadlptelu i (0sexm(m3oo4lpt mivsa()a2tmum ;o0oeto f3iyslm2em(mp t4trxomrcoa1fate i o;( trurxr3iu1lpenmicsltfsrtaur ou4tetoif3iadls2emu snu)artoir oa1fateaivilt0srurxrpno4lpt  nci ( sDtau p;u1tlxomociyslsDum(vont)aetoio iotlp rlueo;s trurim no4alt  fvt ( sDumx o;u4opeomi3iltlmDrluvp;u0artoxfcoa1lptrlu sls0 rum(r3oydoltn nctlt artru pnu1tlenmfciysfaDrlnms;t4alxrxrcoa1fmtean il(0texmxo no4aptemfvi sf rur(m oo4apen o3tlsfsDrln s t) ltnmr oadfa rli o (  eur(r3oydlptnmietltf Dtmu onu0oex  oeiad a rm(mont0 renir ia1fmte ieo;s0t2umxr3ny4apte nctl(f rrm(mpnt1tpto f3ildls2rmnmo;t0 ltrxr3to1fatelneo;t s2to(mpno1ap elfei ()aDumu o;o0openio3iasla umumon()texomr oy1lm ranei;t0 2toio nu4apt  nviltf 2raumpnt1tptnmociysfm ea(vonu4 etoir oytopDe ieo;s trtm(r nydome lfvia(f 2trx  ;t0apxoiocildfs umn p t)alerxf3oytop  luvo t) exo(o3nu4omtnmicilsfarrmu pnu4tet mfeils mDeanmo (0treomf3oo1fmte ues t trxr(m3ny4om nlncias)srrrxr no4texniociatfmDuan snt)alermr3oo1opDrlnesl(0 rto(r iydam elfvtls) 2urxr ou4ale  f3iltlsDuau o t0teerio io1fptrlnvs;(  rtmxopou4lmtn nvils) Drm(r ;u0texoif3iydfa eluvs u)aetomrcia1oaDeauvo (0srxr(r3oy1ape mnet s s2umu o;o1ope mo3tadls2ea( o;t0altnifcio1fpteai sl(0trxoir3iu1apt lnctl(  rur(m ;u0tptn oetatlm uauvo u4tltrmo oydoptr n slt t2tm(mpiudole mfei s sDtaxro;u4apxo ieiadla2rm(vp t0teerxo3tydoptraies s)trxrio3nudllt  fvt (faDtaxmpno0aexomoetatlm2ua(mo;t0 leomr iatla ean sls  exoxo iydlp  lnctatf rtmump;t4opeomieilt m rmnvs;t4 lxrmrciy1laDrai o;t  2ur(opiydam  lfciatfa2rm(r nu4tpxnmi3tlsls2rmnmp;u) rtrxf3iytopDean sl(0s2trxrpoudam e nes ( aDtm(  ;o4aptnifcils m2ra(mon(0 eeomocio1op eluei (0 2to(opio4lp  mnvt t srrrxr ou0alenmietyslm rmnms;u) lerifcia1oate uvi;t)t2umxr ny4omtemnct s a2taump;u4tptnmociatls emuvp (4aeeomrcoa1lptr ies;(0setrirpiy4olt lnctltfarraxr no4tpx  ietydfs2elnvpnu)aetnmr oo1lp raueilt0 2xoxo nodll nlnvta(f Drr(rpno1tleo oetyslm2eanvo t4 lenxfcoatfm eaieo;t)srxoxmpny1lmenlneslt) 2tmxr no0optniictysls eluvs;u)texrio oadoaD ai s t0s2xrxrpoy1ap nmnvil( srraumpnt0aeenmoctad aDulnmp t4 exoxr3oadlpDe ieil(  rtr(m oy1alt liei sfsDtm(  no4aee ifetlslaDelumpnt) eeomrciydfptelnvsl(0setrir3oy1optnlfvilsfs2tmxr ou0tleomfciys a2rl(mp (0texrircoy1lp   ivo s)setm(opiodlm   nei t)sruaxmpou0ope mo3tat mDuau o;t4 ltoxrcta1laD  nvilt)seumir3no4lpe  icslsfarraxrpnu1oetn icild mDulu pn(4altnxrciotoaD liei;s)t2xmim ny4op emneil( sDum(  oo1tee mo3iys a rlu o u) exrmrcoadfa r ueo ()s2xr(opnu4ap  lnci s a2umxr ot0aee  ieiysfs2em( onu0artoiociydlaD lu ol(0trxr(mpoy1oltnmnct s  2trum nu1tlt ii3iad a2ulnvo (0tlenmr3oatlmt aneol(  euoxopnudll nlnesas  Duaxm ;u0tpe mfctasfmDel(ms;t) etomociadoa eanei;s0trxoio3nodale mfeils s2tmx  ;u1opx ioetld s2el( p;t0 rtomrcto1lp  aneil( t2tm(m3iy4omeelfetlt aDrrx ooo0ape  o3iys a2ea(vp (0aeermf iodlpDeln o;s0 euo(rpoo1lltemivtatf rumum nu1opxomo3tad a umumo t4 rxrxfctatopDe neo t) euoir iu1altnlnei (  rtm(rp;o1texomfeiltfa umnms ()alerir tydlm eauvi (0 eum(r oo4lm emfvsl()sDta(mpnt0tlxomi3tys a2ranmo u0 rxnxo3oo1oat aues s srur(o iu1ale mictls)artrump;t0apxo fetydfmDranvs;u)tlxrif3iydom elu ilt0t2tmxr3io1amt mics tfarrax  nu4tetnmi3iytfa el(vs;() reoircoydfpDranvo s0t2xmxm io4apte ies t)aDrm( onu1ale iictyd a2rmumo (0tltomociotomtr neo s)srtoxo3iy4ole mict (  2tm(rono4tetnii3ilt s2el( s;t4aetnmr io1oaDe uvs;s)t2uoiopnu4omtnlnct ()a2urx  ot4aet  f3iasfa2umums;(0altnif iodfpt lnvi t0t2uo(m nydap  mfvi ()artaxmont0opx mietyslm2rl(monu)texrxr3iy1om   uvo s  exoxo oo1lpt lncsls srtaxmpot1tltnmiciyd sDrlnvo;t4 lenmr3oydop raneo s) euoxo3ou4lm   fet t)srrru  nu0oetnmfctadfa emuvo ()trerxf3to1fpD an o () 2urim3ny1am elfvt s  2umx  ;o1teeoifciat mDum(vpnu0 rxrxr ta1fa   u olt srxm(r3nydlmtnmictls)aDum( oot0olenmf3tytla2umuvp t0 eeoxfcoodfa eai o;t)s2ur(m3io1ll e ncsls aDurxr oo4optomo3ias s2emuvon(0tleoir iy1op  lueo;(0 exo(r3oo1ape lfcil(fartax  no1tle ii3tysla2rmnmo;(4 lxnmo3iatlp rlieol(0seumxr iodomen nvt t)sDtaurpnt0tleo fcildfs ean p;u0arxomf3oytfmt  i o s0t2tm(o ny4ame lfvs t srur(ronu0aetomietas s2emnvp ()tlxrxf3iodomD livi;t0trurirpoy1lmeelnei s) 2rrurpoo0tlenio3ildla eau pnt0 exrxfcoatoaDeanei (0trto(m io1omt mfesl(fsDrmurpou4aexomf3tltfs2uau snu0 renif3ia1omDraneo (0s2umxo ou1ope  fvsls srra( onu1tlxoiicildfs ua(vo;u4tlxrxoctodoatr uei;s)sruoio iydol n fvsl(f 2rr( pot4texn i3ils s2el( o;u4areoxociodlmDeli o;(0 2toir3nu1lltemnvt s)sDrau  oo0tltnmfeiatfs umn o;t0tleoxfciotlm   ueil()trxr(o iu1aptelnetatf 2tm(mpot1altomictldfs2rlnmo;() exoxocta1omtranvs t s2tmxo3nudale mfcil( sDumxrpoo4altomiciatfaDrluvs;(4tlxnmf3tatoatraueol(0truo(rpnudap emivsl(faDumumpno0opto ociydfa2em(vs;t) exnxr ootomD  uvs;s)t2tmirpoodam   fvs ( srurxr nu0ole iociydfa2rln o;(0tltomfcio1optean ols0tetoirpoo1omen fei t)s2rm(mono1oetoioetasfaDumu pnu)tlxnif ootomDe ivs t0teuoxrpou4omtnmivtlt)srtmxront0tetn oeiadfs2ulumsnt) ltoif3to1oat  ies s)trtmxo3nodopt lncia(fsrur(rpnt1ope io3tlt aDumn p t4 renir3oo1la r i s s t2umxmpio1lpe  ictat  Drmxrpnt1tltomicilsfaDum(mo;t4altrxr ia1lpDr i ils srxm(o oy4ap emnvtl()srrr(r no1opx iociyt a el( sn() exrif ootla eauvils)teum(m3iy1lltn fvi sfa2ra(mp;t1olxomfeilslaDum( s;(0trtrxoctodoa r neo;s) 2ur(rpoo1am nlivi (fa2taxmpno0oex mf3tatfa ua(ms t) exrif oydom rli ilt0trxriopoy4al e nvilsf rum( oou0opxoiieiasfm umums;t)tetomo oytlat  nvi t0srtoxm3nudam   netas s2rmumpnt1ape ioeildls umnvo;(4 lerirciotlmtran s;t trtoxo oodopen icia( aDrruront4tlxnif3iydlm2rl(ms (4 reomrciodla r neo t seuoir oy4lm nmfvi t a2ur(mo;t1ole  f3iltfm2ranmo;(0tlxrmo3oydlm elu o s0texrim3no4al nmiviasf rtrx  ou4apenmfctys a2elu on(0artomo3oytomDe i i;t)sexoir nydapt  ivtas  rtaxmo;o1aex  feiyslaDra(vp;t4aeenxrcta1fpDrauesl(0tetrxm3oydamt mnviat  2rmumooo0apxo iciytfa2el(ms t) lxnircoa1fp r neo t  rtr(o nydoltnlnctat) Drrx  nu4tle  i3iydfsDean snu)treoxf oy1late ivs s) etrxmpoydome  nes sfs2tm(r nt4oex mfetat s2ul( pnu0aetrmf3totfp  aues;t  2xrxopoy1ap elnet ()srurx oou1optomfciytls2ulnvonu0tetrirctotlmD au i;s) 2uriopnodope mnei s)a2tr(rpou0aee  f3tldfaDrluvsn()tltomfctytlmteluvol( tetr(o3io4lmeelnci ()s2urx p;u1tlt if3tyd a emump;u) rtnmo oy1lpD ai o t  rtmim3oydlmeemiet ()aDurxmo;u4oexnmfciatfs2eanmo;() eenmr3tydfatr nvi;t0s2xmxo3nodaptemnciltfartrxmooo1alto iciadls um(vpnt0trtrxf tydfp  ln o (0 rtrxmpiodolenlnvsl( s2tmxrp;u0tet  o3tydlaDuluvpn(4aetoif3totom  livil( seuo(r3nu4lpe  nciat)a2ra(mpnu0oetnmi3tltfa rmnmp u4trxoif totoa e n sls0 etmxr3nudop   fcsls) 2uauro;t1tet  o3tldfm eau p;t4trtnif iydopt lnei s0sexr(m iydom  miet t  Dum(r ;o4olx ifcilsla ranvo;t4teerir tydfpD  u s t teur(o3iy4aptelics t s2truronu0apxn octasla ran o;()trtrmo3iodlm e uvo ( teur(o3oo4apt mnei ()srtrxr ;t4altnmfeilslaDemu o;t4trtnxf3iatlpteln i;s  etr(r oy4omt  ncsat  Dtr( pnu1ole  i3tldls2rl(vp u4tlxomr oytfp e ivs;(0trxrxr3oo1ol nlnetatf Dtrx p;u4oeenmieiad s ea( o u)tlxomrctotlpDrlivs (0 2uoxm3iu1alenlfeta( aDraxrp;u0texoifctls s2umums;t4 lenxocootop  ln ils0texoir ny4aptnlictl(fsrtr(mo;u0tlxnmf3ils aDem(von(0 lxnxf3io1lmtrlieo t  exrxo ny1lpee fviasf 2rmxmpou1tptn iciatfmDelums (4aeermf oytfp rlnvils0 2trio3iydalenmnetlt) Dtmxr ot4aptomicias a el( snt4 etnmf ta1fmD  i s s  rxo(m3oy1optn nei ( aruaxr ;t1oltnmociat sDrln s;u) etniocio1lpteanvol()s2tr(mpoodam e feil()s2ra(rpot0tpeniietysfa2em(mp ()altrmr oydlatelnvol() eumim3oo4ap elictlt)srtmxm nt4aptniieiys m2ul(mo;t4aexnmf3iy1oa r i s;s t2xoirpnu1lltelfviasf Drrumpou0tpto oeilt mDua( pnt0artnmrctadlmt li i t0 rxr(o ou4omt mfvslt) rtrurpoo4opxomfciysfm2umuvo u0aexnmo io1op rlnvo ()srtm(m3oo1alenmncta( a2umu  nu1oleomi3iasfa emnmpnt0arenio ootoa eaueo;( sexm(opio1op nlfcil(f Drm(ronu0tpenmfciyt s2emu s u4tleoxo oytom eanvs t) rxmxopnudlm   ivsls  2rr(mp;u4ale mf3iatfmDelnms;t)arxrxr oo1lmDr uvs (  rtrim3oy1amt licias s2rru oou4oeenmiciltfs eau p;t)aetnir ootoaD li s s setrxopno1om emicias  2ua(m no0teenmocilsla2emu onu)tlxrmr ty1fmteau ilt)setoir3ny1ope licsa()s2umxronu0aee ifetadla elu snu)aeenxrcoy1op  ai i;()tetoxr iodaltelfctat) 2ur( oot0alxn oeilt a em( s (0 rtnxrciadfmDrlues;t)t2tr(r3nodolen fci ()srtrxrpno4tlx iietyt sDrlnmo u0texomo ty1fp  au s;t0srtr(mpou1aptn ietas sDrau  ot1opxo f3tydla2elnvo t4tetnxfcootlmte ueo;t0 eurxrpou1lmt livsl(f Drrx  ;o0tpxomo3iaslmDea( onu0 eenxfctodfateaueo;s0t2toim3ny4amenlnei (fa2uax p;t4tlt  icilsfs2ulnmo ()aetrxfcia1la r i s;s)t2tmxm iydll  mivsls)aDtaum ;t1tlto ieiydfs uanvp t0 etnxfciytfa  aueolt0 etmio3iu1lm   nvsat)artm(ront1olxo iciatls rlu s u4arxoxo oy1fmt aueslt)t2xoir ou4lltelfet tf rtr(mono1tptn f3iydfmDrl(vp u4 etoxr oa1oaDrlu s (0tetm(rpny1alt  fct s) rrmumpnu0altnmoctldlm2ea(mo;u0 lenio ta1fm  luvil( setr(mpio1lpeemfvs (f rrm(  nt1aetomiciys m rmnmpnt4 lxrircia1fpt aivs;s)t2tr(o ou1op  mfeiatf rtrum ou0olxomociydfsDel( s u0 rxoircto1lpD auvsls t2xoim iu1op elnvilt)s2umumpnt1teen ietys aDrau o;()arxnxr iodlpt  i s;(  rtr(o iydlltnmictatfaDtau  ;t4texoioeiydfm2em( p (0treoif ty1fpDraieilt)seto(opnodole lnvtltfa2ta(  oo4tex iieiadfa rm(vp;u)aeeniocoytfa r ies;( sexrxr nu1lmee icsls  rrrx  ou4tpto ieiad aDel(vs;u)treomf tatomteanvols) 2toxo io4lp  mivtasfs2raum ;u0teen feiadfa2elump t) exnxociodlmDraneo;()texm(rpiydol nlnvsas)s2uax o;o0aeen ieiadlaDelumon(0aeenif3to1fpDr nvil( t2tmxmpio4olenmicia(f Drr(r no0optniieilt s2eluvp;t)arxnxf ty1fa elu i () eurir oy1lp  lfcilt s2raur no4altnmociadlmDeau o;(4aleomociadfa  lies (0 rto(o3oudom n netlt srra(m nu4oeeoioctatfa2rauvpn()trerif oy1faD  ues;s s2tr(opno1op elfvt t aDtax pnu0aexo fctyd m2rmuvon()tetoxf iytoptelnei;s0t2xmxo no4ape micias  rum(  ot0oex mfetatfm uauvsnu) rtomr iotopDranei;t)sexo(r3oo1am elnetl(f 2rrx oot1tltoioeildfaDuluvpn() etnmfctotfateanvols0 2tm(mpiydalte fcsl(  2rmur ;u1oetnmf3tatls eauvp;u4aexnmf oytfmtr uvi ()texm(r3iydlp   iet (  rtmxronu0tpto oeiadlsDua(vsnu0areomrciotopD liei t s2xoxm3ny1omtelfcils)a2ra(  no0oeenmi3tltfsDumnms t0 exnif3iatlm  lnes s0srtm(o3iydoleelncs t)srrrxm ou0oeen feiydlsDrluvp (0 rtrxfcootlpteaivo;t trurir3iydom  livi ()sDtaumont4opeo ictatfsDeau o;(4tleomrcto1oa r u o (  2tr(r oo1lmen nes () Dum(m nu1oet mfciydla2um(vo t4tetrxo3iytfatelieilt) etrirpiy4lltnlnvsas  rumxmpnt4tltniicias aDran p t0aetomrcootfaDeaueols0setmimpoy1amt lneta()a2rm( ooo1opt moeiadfmDrlumpnu0 rxniocia1opDrlneo;t sexoxo iydlpenlfesl() rra(ronu4oeenmietasfa emnmp;() exnxocoa1fpte ueslt t2xoxr3iu1lleemfvtas s2tru p;u4oet  iciysla uau o u4altoxr tytoaDeauvsls0 eurxr no4om nmnet sf rrmxmp;t4tetomociyt m2rlu snu) etrir oadoaDrln i s trtrir3ou1ameemicil()s2urx pno1texomo3ild mDrmnvonu4 rerio3to1optr ieols tetrxr iy1op nlfeiat) Dtmxmo;o0tpxnmfctld aDem(vp;t) lenir3oatoaDe u s t)trtoxopny1apenlivsa( a2rmurpnt1aetomociad mDulnmpnu)trermociatla r ivo;s0trtr(m3ny1lle mivi t) Drr(rpnu4apxo fcildfsDeanvpn(0 reoxrcoytopDr n ols t2urxm3iu4ape  fei tfa2ra(ro;t4tlt mfciysla2uauvonu4tleoxr3iytfaD  ueol(0srxmio nydlmenmiesas) rtr(root0tleniieiysls rmnmo;u4texoir iydlaDe ues ( teur(r3ny1lp elfci ()s2tmxrpno1oexomociytfs rmums;()tltrxfctatfpDeai o;t) rumxm3nodaptelnvsls)s2trxr ;t0oleoiieiyt m uanvp;t0arenxo todfateai sl(0texmim3iu4al nmnesas sDtax  ;o0aptnmf3iatfa ran pn(0tlermr3tadlp r uei;t)t2trir3nu1al   fesat)sDtaxrpnt0tltn ociad s2ulu s;(0 etrmocto1fa ranvs s t2xrxmpno4ol nmieslt)s2umump;u0tptnmf3iydfa2um(vs;t4 etrir iytoa elivs;t0srxmxr iu4ameemfct s)artru oou0oetnmi3iysfsDeau snt4tleniocoo1oat lnei;( srtmim ou1ll  mfvsl()sDua(m oo0apxoiiciytlm2elu s;t4alxnmr3iodom r ivol(0seuriopoodapeemivt tfarrm( pot0apt mfciytfmDean o (4aexrmr3iadfm   uvo ( s2trxopiu4ole mivt (farta(rpot4opto octlsfaDrmu o t)treoif3iotlpt luvolt teum(o3oy1ap emfeias aDtrxrpou4oee mf3iys s2ua( s;t4arermociydla  ai i t0 2ur(r3nudlmtn ivi s aDrrurooo4apxn ieiysfa2eauvp u4 leomr3oadfmt auvolt0seto(r no4ap e iesat)s2um( ono4tleoifciatfaDelnvont4alerxf3oadoatelu i t) 2trir3ny4amte fvta(f rta(mpno0ale  fciysfaDelnmo () ltnxr iatop  ai o;s) 2toxr oodll e nvtl(  Dur(m oo1tpx  ieiadla2elu pn(4alenxf tadomtelivslt s2tmio3oodam n ieta()srrrur ou1olx ioeiytlm raumont4 lxnircoydoptelneo t0 2xr(rpoy4apenliet tfa2trxr ;t1oetn fctas m rm(vpn(4 exnmr oa1fmD  uvsl(  rxmxrpiodll nmfvi (f ruau  ;u0ape  i3tlslsDea(vo u4 etnioctydomDraivilt srtm(r no4lptelicsas) rtrx o;o4aet  fetys sDulu o u)trxnifcoo1la   ivols0trxm(r3ny1apeemnvs s) rrm(mpoo4oetomf3iysfsDrl(msnt0texnxr3tadopDe u i t0teum(rpnu4al  mfvtlt  Drrx pot1tpx mo3tatlsDem(ms u0trxnxr iytfmtean o t teumxr3iy1ole lfeiltfs2um(r oo4opxoifciysfm2rlu p;(4tetoir oatfmDeaueo;s0srxr(r3io1ape  fci tfsDuaxmpnt0aetnmoeildla2ua( p (0tlerxfciatfmDeaiei t0t2trxr iudlmtelfvsl(fsDtaxm no4oexnmoeiyt a2em(vs;(0aleoxo3tadlaDr ueols t2tmxm3oudap e fcs t  2tru p;u0oltoio3tadfmDel(mo;()trerif3iatlmDean o t s2xrxo iy4llt lictlt  2rax ono1tetomfeias s ean p u) reoxr3oatopD aivs s) etmxo ou4apte neilsfs2taurono0tleoioetlsfa emuvpn()tlxoxr tytfmt anvi;t)tetrxr iodoltelfvtat)arraur ;u0olxo o3tydfm2elu o;t4tetrmf3ia1oa  au i;s tetr(o3oodamtnmfvsas aruax oou1ape  ictyt sDulnvon() leniocoo1laDe i i;t0texoirpiydaptnlfvsatfs2tmxmpou4aex  octad mDulnmsn()tltnir3ta1oatrliei s)teurimpoodoltnmfvs t srrr( p;u0tleomieiat mDrl(mont0texoif3oydlaDr ueols)teurir3oo1om nmnvilt  2taurpou4oltnmiciytlmDrl(msnu) rxnifcoa1fptraies t)trxmirpno1al n ieia(fsrur(mo;u4tlenmf3iltla2emnmont) exnmo oy1fm raivilt0 2xmirpiudopenlnvtasfsDrruro;t1aetomociyd a rl(msnu)aetomo3to1fmtrlivo t sexrxr nu1lle mnvs ()s2tm(mpot1opt mf3tys s2emn snt0alxrif ia1omDrln i;t0t2xm(rpnu1lpeemfvils  2trxroot0tpenifctad sDea(msnt4tltrir tydoatr i s;(0 exr(mpnu1amenlnes tfsDuaum ;o0tpt mfcilt s emnms t)tetnxo ty1omDe u s ( s2xmxo iodlm  livi ( aruru oot0oee ioeiyd a2uluvs;()aexrxf ia1fpD lnvo ()setoxo3no4altn fesa( s2umxmp;o0tetnioeiasfmDeauvp;u) etoio ootom ranes;()texr(o3iudop   ivt t) Drmxm oo4tleomocilsfm2eanvsnt4 rtomo3iy1fateai o;(0 rxoxo iodomte ivtl(fa2urxroot4opxn i3ildla ulnmp;u)teeoxr ty1la rln s;s0 rxmio oo1omt  icsltfartmurpnt4ope moctltfm2el(mpnt4 lerif tydlpt anvi;t)sexrim3oy1lleelnet ()aDtm(rpnt0altn fctasfm2eau s (4tlenxr3oy1faD lu o ()srxo(o3ny4om  lneiat  2ta(mpnt0openmf3iysls2umnmsn()tlerir iytlaDr ueo;(0setrim iy1amtemfvsat a2taumono4aeeo o3iydfaDumuvsn()aeenmocoy1opt anvs s0texo(m no4lm   neilt) 2tmx ooo4opxnioeiatlm uaumon(0trerir3io1fpDelies;()s2urxo oudol emfctls)s2rrx  ou1tpenmociadfsDuluvo (0tlxoir oytlatrlivi;s t2trxr3io4ol n nvsl(faDraxmpoo0apeo icild sDrmums (0aetnif oydfpte uvol(  2uoim3oodaptelnvil(faDtrxr ou1apx miciltlm uau p (0 etoif tatoat aieslt trurim oudom  lnesat srtr(  oo1oleo oetat sDumnmp;u0tlxoxf3to1lmtr n i s0 euo(mpiodope mneil( s2umx ont1ale mo3ildfs em(msn(4areomr3iydfpDe u il(  2urimpny4lmenlfctls sDtrxrpnu4teenifciatfa eau ont4 lerxfcty1oa eluvil(  rurxopoy1ole lies t) Durxmoot0altniictltls rlu o;u4tetoxocoa1lpte n ols t2umir iu1lp elneslt)srur(mp;u1opt moetld sDra(vsnu) rxrifctodla   nvo;() 2urirpiy4ap elfvtlt s2umu pnu4tltomiciadfsDua(mont)tltoir3tatlm raneo;s  2xm(o nydaltelfvs ()aDrm(mono4ape  oeiltls2uluvsnt)aeenxf oatoatr ueol()srxoxo no1lmeelietatfsDra( p;t1tleoii3iyt s2ea(vs (4tlxnifctotomD  uvo t0 eumirpiy1apt mfci tf rrax pou1opx iictyd m2uau p;()tleomf oatlatran o s) 2to(r3io4alt  feilt  rraxr ;t1tpenmfeiltlaDrl(vo t4tetnxfctodfp rliei ( t2toxm3iy1al e ivsas)srua(r ;u0olxoifciytlm rau ont) exomrciotfpDrlu o;(0tetoxmpno4amtn nctl() Dumxront0oexnif3iadfm uan p;t0aetoir iotfmtr n sl() rxrim iu1om  mici sf rtruro;o1ale  oetas m emnvont0 eeomr oo1fpD ln ilt tetm(m oydom  lfes s)sDra(  ;u0teeo feiyd m rmums;()alxrir oa1om rlu slt0 2uoio3ny1lmenmfetl(  2ur(rp;u4olxnmfetlt sDuluvs (0 exniociy1fpD  nvslt0t2uo(r iodll nlfci (fa2rmurpot1apt  fciys mDea( p;t)trerircio1opt aneolt)s2xm(mpoy4lptnmneils  rta( o;o0tltnmfciyt m2eluvs (4 ltrio3todlm  lneils  eum(mpoy1lm  mietas)srrauro;u0apt ifctldfa rln p u4tlxnxrcty1fp raivols0s2xoxopnu4alee nvia(  Dur(m nt1aex mfetldfm ea( o;t0aexriociodopDr neol( t2tmxm iy1op   nes s  2raur no1aexomociyt m2eln ont4teeoirctatfmtelivi;t)srum(m nu4lm n fvslsf 2uaxmpnu4apx ifeiytfmDrlumon(4 rxrxf3iytfa rau ils)t2urxopoy1olt mnvi t srrmxroou0tle mfetydlaDulnvpnu4trxrifctodom rluvi;s)teuoio oy4al n nvias) ruru  nu4aet mictadlm eauvp u0tlerirciy1lmtrai s t0 exm(m oudam emivsl( aDrau ont1tleoiictyt s ranmp u4artrmfcty1oaD  i o;()t2ur(m3nu1lpt lnet t)arrrx pot1tpxnio3iys a rlums;t4artoxoctadomDe ieolt t2um(m io1ameemfvtat)a2ururoou1olxoii3ildfm2eluvs u)trtrircoytlp   i o;s0t2trxo3iy1ale mictl() rururpnu1oleo i3tysfs2elnvo t)tltrxf3oodlp rlnvilt)teuoio3ny4aptelnetltfarumx ono4oeto fcilsfaDumnmo t) rxnir io1lmte u ols0trur(r3ou1am n nci ( srtmurooo4alxoiietad sDemump;t4tltriociy1lptelu o;s t2triopnu1amt  ivsl( srtrxr ou4oeen i3tadfa2ranvon(4arxoxf to1lmDr iei;() rxmxmpnodom   fvtas srtaxr ot0ole  iciltfm2rlumo;t4arxoxrciytfmtrluvo;() eumirpiydoltnlfvt t a2rruro;u1oeenmoeiys m2ua(mp u0 eerircty1fateln olt  rurim3iodal emiesa( arumxmpot4opeo feildfm2rlumsn()texrir3io1oaD  u s ( tetrxo io4lme liet s)sDtm(root1openmfetad sDrl(vpnt4texomoctodlmte ieo;()t2xrir3oudlpe  ivs t)s2tr(r ot4tlxomfeildls2uluvs u4 exrxo3iytomDe uei;t)tetr(r3no1ome mivta( aDrmxmpot4tpxoifeiad a elu snt4texoif tadfaDr i ol(0 2xrir nydopeelivsasf 2tr( oot0optomociytfm rmn o (4 eerio tytlptrln o;( t2uoim3nudllte nvslt sruaum ;u1alxnioetysfs2uluvo u) eeomo tatfa e i ol(0 etrxm ou4opte fvt s) rumumpou1oltnifctls mDelnmp u)arenifciadlpDe nes ()trxo(mpoodalenlici s) 2umu  ou1oex  oeils m em( ont)tlenxocoydfptr ivi;s0srto(opno1ll emneiatfaDua(  nu0tpeomi3ils m umu p;u0trxrmr3oa1lm ean s ( s2trio3iydaltnmivslsfsDum(mo;o1olt  f3ils mDumu pnu0trxomo ia1fm  li i;t)s2ur(m3io4oleemici s s2rmx oou0tlxomo3iydla2rl(vpn(0tlxrxf3io1lp raies () rtrxr nydlmt mictltfa2urxm ;u0tpt miciydfm uauvsn()artoio ia1op elivo (0t2xmxopou1llenlnviatf Dtrumo;u0olxo ieiatlsDul(mo;()tetomf oatomt ln o;(0 rxm(o3io1om nlnetl( aDrrx ooo4alx io3iys aDemu o (0 ltoxo3iotoa   uvi;t0s2uoxmpnodoltemfei tfs2tmur ;t1apxoifctyd s umnmsnu4tltrmrciatopDelu s;()trtoxmpny1amte ietlt)a2ur(r ;o4tetnioeias m2emn s (0tetrio oadfptrlneo;t texmxm oo4lme lncta()s2raxr ou0tle miciadls2ua(vs ()alenircoo1la e n o;s0s2uoio3nydal  mnvtlt sDtrumpot0tleniieiadfsDua(mp () lerioctodfpteai i;t)truo(rpou4omtelicsltfaDtauro;o1apt  icilsla ulumpnt0aexrifctatfmteai o s0 2xoxm iodop elfvsl()a2tmxr oo4tlxoiieildls rauvp;t)aetnmr3oydfp r ivi;s0 2uoxo3oy4olt mfctas) Drr(mp;u4alx  fetltla2um(vsn()alenxrcio1oate u o t)s2tm(o nydol  mnci sfs2rm(  nt4aptnii3ils m2umnvs t4arxnmr3iatoptr neo ()t2triopou4omee ieils sDurum ot1aetn i3tydfm umnmp;t4aexnmocta1fpDrlnei;t) etoir3no1ll elnvil( a2um(mp;u4tetoioctlt aDrlnvo t4trenxfciodop   neilt) etm(o ny4ap n ivt (fa2tmxm ;t1tlxnmiciyt s ranmsnu0 exoio oa1fa elnesls)texoio nodolte fci ()srtax ooo0tlxnmociatfm uanmont4aeeoxrcoatom e i i t)seurxmpno1lp  mfetls  Drrumpot1alenmociydfa2rmnvo;t0tlxrxf3iytfptelieslt) exo(m3io1am eliet () rrmxrp;u0opxn ietydlsDrluvsnt) exrxo tytfmtrau il( texoxm3iu1lltemiet (f Dumxrpot0aeen ieiat s2ra(mp;t) reomrcia1omD ln o;t0seuo(m ny4ale  nviasfaDrrxmo;t0tex  o3iat m rmnvsnu0 lenmf3iodlpte n o;t  rtrxr3iudal e ivsl(fsDumx  ;o4oltniieiltls2ea(vpnu) reomfciatfaDe i o;t) etoim3ny4alt lnei s)s2uax pnt0tpeomoeiltfa2emnmpn(0texoif oadlat  ies;t0trtoimpiudap e iesl()srrmumonu1tet  f3iad s rmn s;u4 etoxf tytfmtelivs s  exrxmpio4optemneta() rrrx  ot4aexnmietatlm2emu s u0 renmo oydomteau ol( t2umim3nu1llen feia( a2tru  ot1oexnmo3tadfmDul( o;u4 etoif oy1fat lnvo s0 eumxopnudap elfcsatfa2ra(  ou4tlt  o3ilsfmDeanvsnt0 leoxfcoy1lm rlu s;(0teurxrpny4lltn nvtltfaDrrumpot0olx miciadfmDem(ms;()aeermf tydlpDr uei (  rtmxm nu4ape livsls aDraxmooo0oetnii3iasfa2ua(vpnt0 reomf ia1fatrauvolt)truoxo3oodal  lfesl( a2uaumont4olenioeiatfs umuvon(4tetnmo iotomt li i;( sexmxm3oo1ole mnvtls)srumxr ;u0tpxnmoeiytfaDua(vs (4trxnif3tydom  li o;s teumxm iudope  fetlsfsDum( pnt0ape  ieias sDem(ms;t0tlerif oadfpteanvs ()teumirpio4omt lietat  Durx  ;u1oetoifctyt s2emu s u4aetoxf iotlpt li o t0s2umxmpnudamtemnvi s) Duau o;t0texn ieildla ulumo (0 rerxo tydfmt aiesl(0texrxmpnu4lpt micsa() ruaumooo1oleo i3ilt mDeauvp u)trtrmf oodomD luvo;t s2tmim io4opeemnctat)a2ururp;o4oee iiciltfs ua(ms t0 eenmf ty1lm e uesls0tetmiopnu4omee fesat a2rr( pnu0apxnioctat m2um( pnt0texomf ty1fp  anvi;(0 2xr(o ny4lmtemfvil(fs2urxro;u0tpxnifciyt sDum( o u4 lxrio oadlp  anei s  ruo(o3iu1amenlnetasfs2umu  nt0olto i3iat m2ulu s;t4tetomf3todopt  ivslt0 rxoio no4omt  iciat) rurxmp;o0alxomfetysfm2emn o t)tlxnxf3tadoatrluvslt  eurxmpoo1ame liesl( s2tmumpnu4oltn f3iyt mDemn snu)tlerxf ty1opDran o t) 2xo(r3nu1lmt lncs () 2tm(  ;u1tpe mictaslsDua(vpn(0alermf tydla e u i;s) eum(m3iy1ome  fci t srrru  ;o4tex ifcildlm elnvpn(0tlxnxrciytoaDelnvslt)seur(r3ny1lleelfvs tfsrrr(  ot1aleomieiasfs2um( on(4areomr3to1op eai s;s  exo(o ny4lmenlfei sfsDrau  oo4oleoif3taslm2el( s (4 rerifciadlmtelieils texmir no1lltemfvt sfartmum ou0teeo o3ild aDrmnvsnt)tltoirciy1fmDraieils0 2xrio3iudape livslt) 2raxrpot1aet miciysls2ea(vp;t0 lxoxrciatfm elueols srxrio3ny1om e fcsa() Dta(mo;t1alxomo3tls aDulnmpnu) eeniocia1omD  u slt0texrio no1olenmnvsat sDta(m ;o0tlxoifetat m2ul( p;t) lxnmfcty1fmtelu s;( sruoxm oo4al elnctlsf Drruronu1texoif3ias s elumont)texomoctydlmtran i t) 2xm(rpno1lp  mncias  rumu onu1opxniociytlmDeanvp t) eerircoytoaD  ieo;( s2xo(o io1lpeeliciasfaDta( o;u0tee iociyslm rm(mp u0 exrxo tytfm r n olt srtrio oo4ol emicia() 2rmx oot0aee mieiyt a2em( p t4teermf3iotomDeli ol( teur(mpnodlptelnes tfa2trxr ot1tetnmieiasfm emnmp;u)aexoircootoatr n il()trtm(r ny4lpee feilt aDua( pnt1tpt moeiydfaDeanvs;t4 ltomr3ootoatelivol() 2to(r3io4lp nmnetls) 2taxr nt1ale  o3tys a rln p t4arxoif3oytfmte n o s0 2ur(r oy4optnlfviatfa2uax ooo4olt  i3ilslmDumump (4 rtoxocia1omt lu ols) rumiopnu1ape mnvt t  Duaxr nu1oet  ictad s uln snt4tltrxf3oytopD aivols0 exo(m3iydlme  netl( aDua(ro;u1tpx  ieiatla2elums u0areomr ootopDelu o;s) etoxm nydap e fcsas)srurx pnt4oexo fctytls uau o;(0aexnxr tydopD aivi () 2xoxo ou4apenmietltfsrtmxm ou4aex mfeiytfsDrlump;()arenxr3ia1omDraivi ( seur(r oodam nmfcs ()a2ua(mo;t4tpxomociasfm2ea(vp (0 exnmr totlpDe i ol()tetoxo oudolenmfctlt)s2rmumo;u1tlenioeias m2rmuvo t4trtomr ootlp rai s (  rxo(m no1opeelnciltfs2trum ;u1aeen ictas s2eluvp;u0 exnmr tytoaD  n s;s truoxm oy4lltnmieslt artr(  nu0aet moeiydfm rlumo;t) eeoiocoadoaDrau i;( t2umim ou1aleelnci sfsDrmx o;t4aee iicild s2uanmo;(0tltoxo oy1fatrluvo;(0teuoio3oo4lp   fvs ( s2ur(  ot0apto ieildlmDuanms;(4tlerxr totlm eauei;s)t2tmxo3nu4opeemictltfaDtmu poo0tee iieiysfm rau pnt)trxrmrcoatom   ieo s s2tr(o3nydamee netatfs2rr(  no1alen i3iydla2raumpnt) lxnir3oatopDr nvs;s)t2tmxmpoy4al   ncsltf Dtru  ;u4tpe mfctadla2umnvpn(4alenxociodfpDe uei;(0teuoiopnu1ome mnvsltfs2raxmp;t1oee mictatfmDelnvp (0 ltnxr iotfaDe neo;t)setoxr iodll nmiet ( aDumx oot4opxo feilsfa2emums;()teeoxo3oatopt aivolt  exm(opnu4opt livs s aDtmx p;t0aexn fciatfs eau o u0alermr to1lptr uvsls texmxm3io4om nlics t)aDrmu pou4ale if3iatls2ea(ms;()aexrmo3todoaDelnvsl()s2tmimpoo1lpeemnesat)sDtrxrpno1tex mfeias mDel(vonu0aexrmfcoytopD au o s  euoio ou1ll nlncia()sDur( poo0opeomfeias s umumont0 lenir3oytomtr neil(0s2um(opoy1al  mies tfarra(root0aeeo fetadfs em(vp;t4arerif3tydomDr nvs;() 2to(mpiu1om e icsls)a2um(mpno0tex  feildla2ua(vp;() eerif3oa1fptr uei;t s2uoirpny4optnmnctls)artmxrp;o1aexnio3iat s emu pn(4 etrio tatoaDr n olt teuoxm3no1omtelictas) Dta(ro;t4oeeoio3ildls2rl( on()alenxo totoaD luvi s) 2xmio iudamtnmicil( srra(mo;o0tltoio3taslmDemuvsnu4aexoxf3oodomtrauvsl(0sexmxo3io4oltemnviasf 2raump;u4teenmfciadlsDulnmpn(4 etrif3oa1fm rai o t0 2xrio3ny1al emfctl(fs2um(r nu1oet mieildla2em(vs;t4 rxrxocoydfp  aiei;s s2to(opno1ape  nes () 2ur(r nu0aex  oeiytlm rlnvsnt0artrif3oydop e ies;(0 rtrim nudomt  neiatfsrtaxm no4tpe  fctys s2rl(vont) etrxfcoa1fa rlnvs;t0truo(m iodol elies ( sDra( oou4tlxn fciyt sDrl( o;(0aetnxrcto1fateluvi t)trto(r3iu1am  mnvs ()a2tmx p;t1olen ocils s ra( s u4alxniociotlaD  uvi s)s2to(o3ou1amenlfcsl()srtru pnt4tet ifcias a eln o t)tltnmf oa1la r ivsl(  2urio3oo1am e nes (farrmxmo;o1tlxniocilsfmDean p u)aetrmr3tytfpDr i o;()texrxo iy1omeemfcsls)artr( p;o1aeto o3iyd s ea(vo u4 eerxrcootfmtr uvols  exoiopny4am eliei s sDua( oot1tpt iieilslaDra( o;u)treoxoctadomt  n s s  ruoio no4lmt lfes ()aDumumo;o4olt  oeiltlm2rln on(4texoxr3ootoa ranvi;s t2uo(m ny4alt mnct (fa2urx o;t0tlx mfctasfs2eau o u0teeomf todlpD  n o s0trtoio no4apee ncia(  2tr(ront0tle  o3ildlm2emnvpn() lerio todoaD lu i;s)sruoio iu4al  lfetlt)arum( pnu1oetomfcias aDrl(vonu4 etnxf3oa1lpDeauvo;s)trxr(mpnu4aptelfcia() 2rm(r ;o1tlxnmocias sDemnmo;u) rtoxo3oydomD livi t  rtoio3nydapeelncs (fa2tmxrp;t1teeoiocilsls em(vo t4aexomrcoadlmDeln ils t2xmiopou1al emnesls aDumxrooo0alxoio3tlt aDel( p t0trtnxo3ia1fatrlivo t0setrir nu1op nmieslt)arua( pou0aeenif3tyd aDem( pnu4treomrciatfmtrai o t0srxr(m3ny4ap nmnci t) rrrur no4oeeo oetld aDelnmont)aetoifcia1fat  ues;s s2um(m3oy1altemfei s s2urxrpot1tleomoetasla2rmu p (4tltrmo iadoatrai s;(  rur(r3oy4om e ivias) Dururo;u1olenmf3tlslm2emn p (4tltrmf oodfaD  nvilt  rtmxmpoy4lpte ivtltfa2tax p;t1opto oetydfm2ra(vp;t4tlxnxr3oydom   u sl(  2tmir3oudolenmnvtlt) rra(root1tleo fetasfa2rl(mont)arxomoctydlmDr i s;(0srxo(r iydopen netlsf 2rrxmono0tlt ifeilt mDran p (4tleomo iytlpteai s;(0tetoxo ou1am   nctl( srua( o;u1ole  feiltfm rl(mp;() rxnxr tadla  aieo t) 2tmxm nydll elfvt s)a2trumoou4opx mi3iaslsDrln p;(0trxrxo3oytfat aies;(0 2uo(o iu4optn ietls  rtrumpou0aexnmoeiat aDuaumo ()tlxnmr oa1fp eai s;t0truoim3oo4ole  ivtlt)sDur(m ou1tlxnifeils mDul(vo t0tltrxociodfpDrlueslt)seto(rpoo1alte ivsl( a2ua(mo;o1teenif3iad a rl(vo;t) lxoxo oytlm  anvils  2tm(rpiydomen nci s)a2rmumo;t4opeoiietltls2uln onu4arxnifcta1oaDran ol( srumim iydam   fvsasf Duru  no1tetn f3iltfsDeln ont4arxrmf ty1lm  ai ilt)trtoxo3nudomt mnvtat)aDuaxmp;t0alx mo3iatfmDra(vpn(0treoxr3tydopDeanes;(0s2xmxmpiydlmtn nvtat) 2taur ;o4tetomi3tls s ulumo;(0aleoxf3ootfat lnvi;s0s2xmxrpnodol nlfci s srtaumo;t4tex ii3iyt sDem( o ()altnmfcoo1omt an sls)texmxm iy1ol e ivt s)aDtrxrpnu0altomi3tas sDra( pnt4tetrxr oatoate i o;t trxr(o iodape mnctl(f rrrum ;u0tpx  ietyslsDuanvs (4tleoirciadfmDrlnes;t truoxm3oodamt mivia(f Dtaurp;t4apeoioctatls2umnmp u)altomr3tatoate ueilt0teum(opiodal emn
\ No newline at end of file
@@ -0,0 +1 @@
+nvs (0tetoiopio4op  liet sfa2urx ooo4aee mfeilslm2rmump;u4 eerxrcoa1lpDe nvo ( srtrxm oodlpt mncs s)a2um(m no4opt if3tldlm ea(mo;()tlxrxf3iydlm eli i;s0trtm(opiodamtn nci (fsDurur oo4oexnmieiys s uluvp (0 ltoxr3tatfpDean sls  2um(o oy4lptnlivs (f rtmump;o1tlxnif3tltls elumpnu4trtrmociodlpt  u ils t2xoxr io4ame  ncils)srta( o;u1texniiciadlm um( pn() lxrmociadlm eanvi;() euo(o3ny1olt mfeils srrr(  ;t4opeo fctls a emums;t0alxoxr3to1fa eluvi;t t2tmxo iydome mivsl( sDrmx o;o4tpx mieiadla2ul( s;t4altomf totlm rauei s)sexrimpio1lleemnviat srum(m nu4aexn ieiltlmDemn o;u4altrirctytfpDeaues t)tetrxm oy1al nmncil()a2tru ooo0alxnifeiatlm em(msn(0arenio3ty1oa elneo s  rxo(o3ny4lpenlietls)a2ta(rp;o4oetn octysfm rm( s;() eeomr3todfp  lieo ( srxmio3ou1ap nmfct ( srtru  ;t1tptomo3ilsfaDua( s;t0tlermf oytfa r uvils s2trxmpoo4amtn ictasfa2urxmoou1tlx  i3iadla ua(vs;()aetoxfcia1fp raiei s)trxmxmpoy4omenliei s)aDurumpou0aet mi3tatfm rm(vs ()tetrmrciatlmtran i s seumxopou4omtn nct s)arrrxr ou4oeeo ociydfm2uluvo u4trxrxo3iadfmt  nes;s  rxoxr3iy1omtemfvtasfsruru  nu1tee mi3iadfm uauvp;u4texrmr3ta1lpDelneslt0 exmxopnudom e nvsltf rra( poo0tle moeiadla2ua(vp (0aetomr oa1om  luvil()trumio iu1am  lfcil()aDua(m ;u0aetniieiltls2ul(vpnu)alxnio3oa1fp eluvo;t0s2toio no1altnmfcsls aDraumont1oex ii3iyslm uluvsnt4texnmr to1fm r n s;s texmiopiy1opeelnet ()sDuaumooo4apeoiietys sDemuvs;t0tlxnxocia1fa r iesls)setoxm3oy1apee neil(f Dua(ronu0oee  f3ildfa2rmu o (4arxomf todfpDe neilt0seuoxrpou1amtelfesa(fa2rmurp;o4aexo feiadfsDuln o;u4 reoxf oadla  lues ()srtmimpio1amtelfet sfsDur(rooo1opx ioeiyslm2elums t)areoxo ta1faD ln i;( sexmxm iudopeelnetat s2ua(m ou1tlt  i3tasfsDra(vsnu4tetoxf3oadlaDr u s s) eur(r iy1oleemncsl(  rta(  no1tltniietydlmDranvp t4aeeoio to1lmD li o s0trtm(m oo1altemnetl(  2rm( pnt1openif3tltlm2uaump u)aleoif todla eaies t) exo(o3oo4aptn nvsl( s2tmxmpou4alenif3iaslaDrlumpnu4tltnmo3oy1op rlu il(0 2toir iudaltemnvslsf 2rru  ot4altnif3ias m2el(mp u)aetnxo3oytlmt lieils s2urim iy1lpen ncilt  2tax ono0aex mo3iysfaDemuvpnu0arenmo3ty1lateaneilt0trumxr3iu1lmenmnvsasf Draxm nu1tptnmieiydls um(vo;u)tltnmr3iotom e nvi s  ruoiopnu4omt mictlt a2trxmp;u0alxomociydfmDel(mp u4 rtnmoctydfm  li ols tetoiopnudomt mfeta(fs2rrxrp;t1teto oetytlsDua(vsn()alenmr3oy1oaDeauvi;t)trxr(rpiydolt lnctl( a2rm( pnu0tpt io3tadfsDran p;u)texnircoytlaDr nvi;t  rumim3oudoltn fviasfaDrrx o;u4oltomf3iydlsDul(vsnt0trtrir io1lmDeaues () 2tmxr3oydap   iei s sDuru  no4olen oeias aDuln p ()texnmo oydfa r uvs;s)t2tm(rpoy4opt  fctas srtmxm oo4oexn ocilt aDeanmp;()aetomfcoodlaDe uvo;() 2xm(m3no4om elivi tfa2rrxrono1olxnmociyt sDum(vpnu4tlxrxo3iatlm r i o;t0seuoiopoy1op nmnvsa(  rurx ont4tlen o3ild m2raumpn()aetrxo3ta1omDr uvi;t t2xrio ou4alenliei t)aDtrx  ot0ole mfctasfs ulu pnt0arenxr3iytlmDean o;s)t2tr(m3oydlme  ncil()aDtrumo;o1aexo i3iltla rluvont0tetoio oatlpteauvols) rtrio oydom nmncs sfs2tr(rpou1ope  ociys s umu s u)aexnmoctadfp eau o s)sexo(rpiu4optnmnetls)a2raxmonu1aexnmoeild m um(vp (4 eerir tytlptraivo;t0tetmim oydlleelnciatfa2rrxm nu4teeniieiyt a ulnvs;t)tlermrciodfpteai ils)trxoxmpnodalenlfcsl(farraum ;u1aexo fctydfm ul(mp u4arxnmfcia1lm   neslt)teumimpoy4aptn neil() 2trurpnu4tpxnmfeiatlm2ra( p ()teenmr tydlpD lu o s)sexm(mpiudll nlivi ( s2rruro;t1oeeoifetasfs umuvont0alxoio tydopt lieo s s2um(o nydlmt miesl(  2raumo;t1apxnmieiat s ea( s;(4alxrmf tydfaDr n i;() rxoxopnydamen icsa() Dtrxmpnt0tlen fciyd s rmnms t0 lenmo3oo1omD li o;t) exr(r3io1lle  net s  Dtr(ronu1aeenmfctadfs rmnvo;(4 leoxrcoa1lpt  ivs t srtmxo ou1al nmfcilsfsDrmxroou4ole  ieiadfs2ulu pn(4 lxnircoydfa rlieo;(  rtmir3no4ole lfci t  rurumoou0alt mf3tltlm2em( o () exnmr3oadla   uvols0trxr(mpio1ap elieilsfa2tr(  ;o0tpenif3iyt a2rauvsnu4 reomo3oadfpt  ivil(  exoir3nudal  mici t a2tr( pnt0olto o3tadfaDumnms;t)tleomo3oy1fmte ieo s  rxrxmpnu4lpte netat arur(rpoo1tpt mietytlm2ua(mo t)texrmfcootlm e i ils0 2toxopoo4amtnmncias)sDtr(mpnt1aptnmfeiydlsDulumpn()alxnmr tadoa  aneils)trxmxr3oy1altn ietat)a2umxr ou4tpxo icilsls uaumpnt4areomr tydlp eaivo;t) ruoxr3nodal n ncs t) rrmu ono1opxnmoctatls2um(vo;t0treoif ia1opt  u s ( trtoxm iu4op nmncilsfarrmxr ;u4openifeiasfm2rln ont)aleoxf oo1fatrai i;( teurxmpny1op n ncils)sDrmurp;u4apen ieiysfa2el( pnt0tleomr3tydlmt  ueil(0 etm(r ou4opte ici tfaDrrumo;t4texnioeiyslaDuanvs;u)trerif3oadfptrlivi (  eum(opio1op emnesl(  2ur( ooo1aexoiieiadls2emu p u0altrmo3iatoaDr n s t) exrim nydomtelnvilt a2ur(ro;u4optniietat s ranmo;t)alxnxociydlpD  iesls texmio3iudoptnmnesasfs2rax  nt4tee ifeiat a2eluvp;(4alxomocoo1omteau o ()texoxr3no4ll  lfetltf rrau  nu4tlenioctld aDean s t4trxnir3ootlm rlnei;t)trxrxmpoudomeelics s)aDrm(m ot0apt iieildlm2rmu o (0trtrifcoytfm   ieolt  eumirpoudam emfviat srtmurpno0apt mfeildla2ulnmpnt) exrmr iy1oat  ivs;t  eurirpnu4ll emfeil( a2tmum ;u4aleoio3iysfa rm( snt4altrif3oatoa   ies t0 2to(m3nu4lm nmieslt)srur(ront0apx mfciad m2rlu ont)tetomf3iotop  aues;t)trtoir3ny1llt mncta() 2ta(mono1aex  i3tadls2rau p u)tetoir3oodopt aivi t)seuo(mpnu4oltn icsl(farrr(mp;o0teen feiysfaDrau p ()trerio ia1op r ues;s) etrim3oy4lmt lfvi sfs2tmxm ;t1olxnio3iasls2rlnmo t)aexomfcio1fpDr nes;() 2um(mpoydalee fci (fsDuaumooo0tpxo ietytfmDemnvs (4 rtnmf oydop rlivs;t teurxm iy4lptnmfvsasfsDrr(rpnt0oexniociydfm ulnms;u4texrmrcoydoptr nvi;()s2umim3nu1am elnetas) rrax oou0oexo oeildfm2rl(mont)trerif3iotopte uvo;s t2urxmpnydoltemicsl( aDua(mp;t4tltoif3tltfa em(vo (0aeenxr3tytfpt an s (0srtr(opio1ap n icsa(f Drmuroot4tpt iicildlm ua( pnu)alenmfcoadfp r neo t  rxmir3nydamteliesa() Dumumoot1alenifeiatfaDem(ms (4altrmr oadoa  aneil(0t2umxopoo4am eliei s aruax p;u0alenmfetydfa2ua(vp;(0artrmo iy1oaDelivs s  2uoiopio1al  lieslt aDtruroou1apxomf3tlsls el(vp u)aexrxfciatfp r ies;t0tetrim ny4ol  mfet s)srurxmp;o0tetomo3iys aDea( p;t4altnxfcoatfmteaneols  etr(m iy4op elfviltfsrumx p;o0opxn ieils sDrl(monu) exnxo iydlp rlnei s0trxoio3nodaltnlnvi ()sDtaxm ;t4aleoii3tys s2ran on()alxrio3ty1oatr neilt  euoio oodapenlnes s arum(  oo0ope  i3tldfmDumu snu4 etomfcio1oaD aneols t2xmir3io1om e nesa() 2tax o;o4opxnmfeilsfmDrlnvo;t4artomoctotla r ueo s0teuoim nudal elfesa(fsDum( o;u0altnmictldla rlnvs;() rxrir oadlatrlnei (0tetmxmpnydlpt lnvilt  Dur(mpno1tpt mieildfaDel(vo t4aexnxo iydfm   n i;s)srto(m iodlmeemnvt t) Drrurp;u0texoifciydfs rmump;u)aexoxo3ootlaD auvs;s0seurxrpiydol nmici t) rua(ront0tlxnifciatlaDuan pnu4 ltrxo3oodlat aivi (  2tr(o3ou1lp nmics ()arrmx o;u1tlto ocildls ua(vpn(4alxoxrciotla raues t0trur(r ou4omtemnvt sfsrur( pou1tptniieiat mDum( pnt0trtrxr todfptrai i;s texrimpoydame mneilsfsrrmxr oo4apxomfeilsfaDrmnvonu4 etnxf iydfpDe uesls)s2um(r ny1omtnlncs () rtaxrono0ape iiciasfm2ua(vp;(0trxoio iy1lpDe ieo s) eumio nu1ol emnesa(fsDtmu  nt0tpto ocias m uau s;t4artoiocio1fmD  iei (0t2ur(o3oo4ale lnvt sfa2rmumpoo4opx iieiyd m2ulums;t)altomo ia1oaDraivs s0srur(o3oo1oleelnvsat srtmur ou1apto oeiatfm el( snu4aeenmf oadomt  ieolt0 eurimpoy1ope lnvtasf Drrumpou1oee  oeiatla eanvp t0trtrif iotlptrlnvi;t t2trxmpnodoltnliet (farrru p;t0tlxnii3iltfmDemnmo;t)trxriociadfpte neo t0 2tmxm3iy4lme lfvil(f rtaumoou0opxniiciyt sDum(vs u)artnmocoa1fatraivs t  etrim nydameemnvilt) 2uaxmpnu0tptn ietyslaDrl(mp u0alenio iytlpDr i s s  eto(mpoydamt mnet s)sruaxr ot4ape  feiydls el(mont4alxomr3tydlpteanvo;t0teumxm3ou4lp emicils)aDtruronu0tpxomo3ias m2rlumsnu)tlxrxf oatlaDrluvol(  eur(m iy4openmfeiatfsrta(  ot4optomi3iaslaDelumonu)trxoxf ty1lmt aneo;s  etm(rpiu1altelfcs t aDtmxm ;t1ole  i3iaslaDrln snt0 leoirctydfaDr ivo;s0truoir iudop  lneils  Durx pot4tetn f3ilsfa ean p (4alermocoadomteai s () rur(m3nudomtelfcta(fs2ta( pno1oetomi3iys m2ulnvpnu4 ltrir to1faD lnvo s0teuoir oudll  micil(fsDtax  no0tleoifcilsla rl(mp u)tlxoxr3ty1la eli ols)t2to(mpou1ame lietltfsDtmu pot0aeen f3iaslaDeanvo u4 lerifcoytfmDeauesl()trurxr3oo4llenlfcs ( aDrmxroot4aetoio3iydls2ranvon(4aexrif to1oa eai ol( setmxm iu1lmtemieslt)srtm(rpou4optomfciyslm ean ont0tltrmf3iadfptrau o;s0 rur(mpoy4lptnmnesatf Dtr(  ;o0tlx  ieilslmDrm(vs;t0tltrxf3iodomtr ivolt teum(rpiydop nmfvtls) rrm(mp;t0alxo i3tlt s2ulump t0arxrxfciy1fpDraue
\ No newline at end of file
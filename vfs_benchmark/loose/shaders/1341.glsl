@@ -0,0 +1 @@
+n s s)sexoxm iu1altnlfci t)aDumu pno0optomf3tlt s ulnms (4alxomr3oy1fpD ai i;( s2xoim ou1alenliesa()arumx pno1teto o3iasfaDuluvon()altoioctydfmDrli il() 2xm(mpoo4om e ict tfsrur(  ot4apenmiciys m ua(von(4 rtnxoctatlmD  nvilt  ruo(rpiy1amtemivt ( sruaurooo4oex  ieiydlsDulnvp u)trenxf3ta1fa eliesl() 2xrxr no1am  mncta()a2rax p;t0opx mf3tlsfa ua(mont)aexnif iatlat lieilt teurimpno4ape  fvt s  2tmu ooo0oex iicilt aDuanms () ltrxfcoydoaD an i t srtrirpou4om  mneil()a2ta(  nu0aptnmi3ilt mDem( s;u4 ltnmo3totomte uvolt)s2xrxm io1lpte iet (f Dtr(  nu4aptnmo3tys mDuauvpnu0teeomf3totomDeaivils0t2uriopno1lle mfvt tfs2ur( pnu4tpx ii3tytla um(ms;u0tetoir3iodfm r uvi t  etoim3iydamt lfcilsfartru p;u0aeeo oeiatla2ean p;(4teenif3oytlmD auvs ( seur(r3nu4aptnmfcs (fsDtmu  no0aee  iciadlaDrmuvo;u4 eeoxocio1lat ai i;t0setmim oy1apeelivtl(f rtm( pnt1oexoiociyslm2ra(vpnt4alxnio tytomDeauei (0 rtmxopou4lmtemnvtl(f ruru onu0altn icildla2umnmp;u4trtnio oa1omDrluvo ( srumxo nu4omte ies (f 2rrur ;u0apenioctys a2rln p;u0arxnmfcoa1faDr uvi s0srur(o iudamen iet t arrru ooo1tlxn i3ilsfa ra(mp;t)altomf3oytopDrlues t0srumxo3ny4ol emivt t  2tau pnu1oet ifeiasfa2el( pn()tetnif ty1fmteaiesl(  ruo(o iydlmen ictls)srrm(  ;t1aee  fciyd s2ranvo;t0trtoxrciodoa   ivsls0 etoir oo1altnlicta() 2ra(rooo4texnii3iatlaDrm(mp;(4 rtnmr iotomt  ivo;s)texrim nu1lleemicilsfsDtr(  nu0tlxnmf3tydfm emu pnt0teeomrcoadlaDeaueo t0seuoxm iy1lmtnmncils srta( o;o1tet if3ildfa em(mo;u4tleomr3iotop  auvil(  2um(m3oo1lle lfei s artaxrono1tptniicildfs2rlu o;(0tetnmoctydomteln slt trxr(rpiy4ame mict (fsDraxronu4oet miciadla rlump;(4tlxnir3iatomDr i i;s s2xmxopou1lp   ivta()srra(moot1oetomfciad mDea(vsnu4areniocoy1fptrlu i s trurxmpio4lp   ivil()s2umumpnt1tpenioeiltlsDem(vo t0 eeomo3ta1op eauvs t trtr(o iodlmt mivi (fsrtr(roou1aex moeilt s elnmp;() rtnmr oy1la   i i t0s2xmxm nodapenmnci (faDurxr ou4alen fetasls2ranvo t4teermr3tydfmD ai ils0texmim nu1omtemnvtl(faDrax ono1oetoioctlsla2rlumont)tltnio io1faD aivolt trtoiopiudop n fvilsfa2rr(  ;u0opxniociydlsDraumo t)trtoxf oy1la r ieo;(  eur(r io1lp  mnvs tf Dtrxmoot1optoifetydfm eln o u4 lenxrctotlate ies (0 exoir3nydam   nesltfsrur(m no0ole iietlsfa2uln onu4trxrmo ta1opte uvsls) 2tmim iodom  liviat sDum(mpot1oleo ocils s rluvon(0trtomocta1oaD  i sl(0seurxo ny1olte ncsa(f Dtm(rpnt4alto fetltfa2uaumo () reoio io1fptr n sls)srxo(r nydoptn fcsas sDta( o;u0apen fetysla ul(vp t4 exnmr3iy1lm   u o t0t2xoxm nodal nmivta() Dta( p;t0tltn fctltla rlumsn(4 exomocoodfpD  n ilt  rto(rpnydomte fvsls)a2trxm ;t4apeoii3iytla2uluvp;()alxomfciy1oatr uvs ( texr(o oydll nmiesat artr(  ;o0tpt  fcilslaDea(mo;t) eerxocoy1lp elu ol(0trtoim3iy4lmen ici sfs2rm(r ;t4olt if3tydla2ul(mp;t0tlenxf iydop e ivi;( t2ur(r no1openmict t aDuaur ot1aee moeild s ua( p;u0aeerifctotlatelues;s)srtoxm no4aptnlnetas) rtmxmpou4aexoiieiysls2ea(vsnu4alxomf3oy1oa r i o t) 2xmir3ny1lpt  nctat)a2ur(mpnt4optomocias m eluvsnt) eerirciy1op rlu i t s2xoxrpnydom  lfvtlt sDtrxm ;o4opto ietyt s2emnvo;t0altoio oodfa rlneilt0 etr(r iy1op  lnei (f 2rmurpnu1oeto iciysfaDemn sn(4aeenxf3oodlatraieo;s) etoxm ny1ope  neia() 2umxmpoo1optn ieilsfm ulnmp;t)alxrmo3oa1lp  lneols) 2uoim nu1apt lnetat) Duaumont4apt  ieilsfsDuluvs u)tlenxfcoy1oa e nvsls0 euo(m oudaleemnci t aDra(m ;u1oex  o3iytla rl(vo t0altrmo3iytlaD lieolt)s2xo(rpoo4alt lfes tf 2tmxrpnu1olt  i3iys aDel(ms (4texrif3todlp  au o t) etriopiu1op n iet ( a2tmx pot0ope mf3ias mDemn o () leoircoatla rlueo s)setrimpnudlltemnvt ( sDuaumoou4texo fcildfm2rlnvs;u) eeoxociy1oatrluvol() 2to(mpio1alen fcs tf Dtaum oo1opxo i3iatlmDranmo;()alenmfciodfa ran i;s)trtoxrpnudalenmneilt a2tmuroot4tpeoiieiadfa emn p t4 lxnmfciodfpt aieils0 etmirpno1omenmnvs (  Dtm( p;o4tlxo o3iydfm eauvs;u4 ltoxocto1fm e ies;s0srxo(r3oo1ol nmnci t a2rr(mo;o4aeenii3ils aDrlumsnu4 eerxf tydoa eauei (  rtoiopnu1amtelfes tfs2rmxmooo4apxnmo3iltfsDrmnmp (0trermfcoytlpteau sls)s2xoirpiydlp elfvi t)srum(mp;t1aeenmf3tydlm uluvpnt0 exrircoodfmDeluvi;()seum(rpiodlmte fcs t) rum( o;u1ope ifctysfm ra( s;t)aetoxo3tytoa  aivo t teumimpoo4lpt mnei sfs2rr(mp;o1opeo ictls mDul( pn()texoxo3iadfptelivo;()teuo(m3iudaltn ncilsfs2ta( o;t1teeo ociyt sDrlumo;()texoio3oadlmD au s;t0srtrxr3oy1llenlnctat  rrrxronu1oexo octyt a elnms;(0 lxrmrcoy1la elneo s0 eum(rpno4ll   fetlsfa2uax oou1teto o3iasfm emu s u0tlxnxo tytom r nvolt) 2tr(r oo1amtelfes ( arua(roou4tet ifciasla2umnmo;t)texrmf todfp e nvs t texrio iy4oltnlfct t) 2raum ;u1oleo fetyt sDumump;u4arxoxr3iydfmD  nvi ()truoim iu1lmen iciat) Dta(r ;o1alt  ocils sDrl(ms (4aeeomr iadfptrlnei (0srum(o3ou4lmee ici () 2tm(r ;t4oexomf3iadfs2ean sn(0trtrmo3oo1opDe neols0seuo(o3iudope  ici t)s2urumoou0tpeniietld s2umnvo t)aexrxf oatoat lnvsls)teuoiopio1ape lfetas a2urur oo1tet ioctldla rlu snt0 lerxfcoy1lmDeauei s  rtmxm3iy4llte fetlt)artau pou1tlxnmf3tlsfmDea(vo;t)trtnxf3oodlpt lnvo;s0 rurxmpoo4ope  nes (fsDtm(mono4opxomfciasfmDraumsnt0alxomr oa1lm e n o;( trurxrpiudape lfeia(faDum(mpot1tlx  ociat m um( o u0 etoif3oytom e neo;t)srurxrpnu1am elfvsa(  2uax pno4opto i3tatfa raumon(0aexoxr to1fp eaieo ()srtmxo3nudop  mnvtasfsrrmu p;u0tlto ieiydla uluvs u)alenio iytfp elivols) exmimpoudlp emictat  rtaumoou0teeomoeiltla eanmon(0trtrxf oadfmte uvols trtrir io1ome  ieslsfsruru pno1oet iictadfa2emnvpnt) lxnmrcio1op elueo (0 2xmir3no1am  mivils  Duau ont4aexoifeiysls rm(vp () rxrirciotlm  lueo ( srxrim3oudop elfvt s) rrm(rp;o1oet ifeilsfaDrl( snu4areoir3oadfa   uei;t  rumxmpoo1ale miet t) rtr(  ot0altnii3iasls ua( p;u0 rtrio ty1opDelieslt) rxmxopno4ol nmfvt (fa2raumo;u0aeen o3iytfaDuan onu4tlxnifcia1op  aueslt) rxmio3oodll e ietas)aDumur nt4oltomoctyd s rau pn(4aexrir tatoat auvi ()s2xr(m iu4oltemnvs t) Dra(mo;u4optoio3iyslmDum( on(0 lxrio tydopt lnvi s  2xr(opio1amtelietltfsDra(  oo4ale io3iyslmDuaums;() rxomr3oodopD  nvs (0 2to(mpio4ap elicta()a2taurpnu4texomo3tlt m rln p;t0arxrmf3oy1fmD aivs ()teum(r nu4ope  ivslt sDur(m oo0tpenif3ildlmDra(monu0aetrxfcoy1optrli slt teuoxrpno1aptn fesatfs2raxmono0tlxnmfcilt a ulump (0arxomo3ta1omt lnei () rxrxr oo1ameelivtasf 2ta(mpno4alt mocils aDel(vsn(0 leoif iydlmDraneo s0 2toxr3nudol nlicil()s2ra(r oo1oltnifciyd m em( onu)aeenifcia1fm rlivsls0s2to(o3ou1lme  nctls)aruaxro;u0olt mf3iadlsDrlu s;t4aetoxrcootfmteanvo;t)s2trxm iu4olt lfvsat sDtrump;o0tpe ioeiys s2em(vont4 lenir3ty1oa eauvol( trumiopoydamtn iesa() rra(mpnt4apxnmf3iadfa2umu s;()artoifciodlpDeauvo t) exr(o3iu1lmeemnesltf Drm(root4aptnmi3tadlaDum(mo (4alxrio iadfaD  u il()setr(r oo4lp   fcia(fsrtrxmpno0apt  feiys m rl(monu0alenmrciydom  lu olt)srtrir3no1am n nvia(  rumxrpot4olxo ietysfs rau o;(4 etrmr iadlmt  n o (0t2uo(o iydapeemnvi (f 2rmxm no1aetoifctydls uln s;t4tltomf3iy1fat  ueslt) 2urim oy1llt mict s srtr(mo;u4ale  o3iyt a2elnvo;(0 etoxf tadopDrluvo;t0t2tr(r iudale mfeilsfaDua(m ;t1opx ioeiasfsDuau pn(4texrmo3oo1op rli i t  exoxm iu4lmee netatf rtaxr oo1alto fctltfsDemu p;()aetnxr iy1omDr ieo;t0t2toim3oy1ol nmncia()arum(mp;u4oltnif3tytlsDuau o (4aeenir3oy1faD anvs s)texm(rpno1apeelnci ()sDtaumoou4tpe ii3iadfm emn p;u0altnxocty1omte ivols)seto(rpno4amt livt sfaDrr(rooo0ape mf3ias aDrln onu4alxomf ootfptrlueo;s trurio oy1lmtnmfeiat s2umxmo;o1olenmf3iydfm2rl( p (4 rxnio3ty1lp eluvo;s) eurxopiudaptn icia( artaumpnu1alto o3ias s emn snt)texrio3oytopD auvi;s srumxr3oy1oltnmfei t sDuaur nu4tpen ictatlmDrlums u0alxrio iydlpDr n olt0srumio3iu1openlfes s) rtrxrp;o4tpt  i3iasfs um(msnt4teenio3iy1lpDelivi;() rxmio3iydom emietl( arrm( p;t0aee mi3tldlsDulumo ()alxnir3oodfptrlivsls)trtm(opiy4aleemivsltfaruru  no1apxomfcildfm2ul(vp ()alxrxf oo1oateaueslt seumxrpoodome mnvslt) Dtau o;o4alenii3ildfaDemumpnu)tetoxrciatfateluvilt0seurxm3iudlm n nct (fartrur ;u4texoiocildlsDea(von()altoio oodoa   u s;t0s2uo(o io1omtnlnct t s2uru o;o0texoiicild m2ua( pnt4 leomfcoy1oa e ies s)sexrxo oudap e nct tfa2tr(mp;t0aexoiictasfs uauvs u0trxnmo3to1fmtelu sl(0sexo(mpiydolee ncsls sDra(monu4aexnmi3iasfs ranvp (4 ltnmf oydfmt  u sls0 exrxrpiy1lmt  ietlsfsrurur no0tptn oeildlm2rlump;t) renxocoadfpt  uvo () 2ur(rpiy4op  mivil(fa2rm(  ;o0teenifciaslmDulums u)teermo3iadfp  aneils trtmir3nydoltnmnvtlt) rrruront4alx  iciytfs2rmnvs t) reomo3iodlpt auvsl( s2tmirpiy4ape  fetls)arum(r ;u4tlxn oeilt s ul(vpnu)aetnmo3oy1laDr uvo;s t2to(r oy1op   nvi tfarrmu  no4tetomo3iysfsDea(vo;(0 exrxr ootomD lueo s)texoiopiu1al elfvi s  Dta(rpno1aexoifeiysls2uln o t)trtomr3ia1oaDeauvo s0sexrxopiu1lle  ncsl()srtm( ooo4teeoiieilt m2umumpnt0tetnxf3to1oa  anei (0t2toxmpno1ap n netls)srraxm oo0apx mieiad m2uaums;(4 exrio oo1fpDr ueo ()srtrirpnu1lltelnctl( arrrum ot1tlt iicils m2ra( s;u0 etoxr tadfaDrai il() etr(rpiudapeemfctat) rtax pno1tle  fciys a2ea(mo;t4 lxrio3iytfpteauvil( s2tmxr io4ol emfvia()srta(mpoo1apen o3iadfa2rmnmsnu4alxomr oydlpte nesls)seuriopoodamte netls  2tax ont0oetoioetas aDelnvs u4treomfcoatop e u s (0s2xrirpnu4optemfct sf 2tauro;t4olenmoeiltfs em(msnt0alxrio tytlpDeaivolt) euoim iodom e icsasf Dtaxm ;t0tpe mf3ilsfa ra(mp;t)arxrxo tydfmD  uvils0trurim3ny1llte fvsltfsDum(m ;t0olxnmf3ias m rl( ont4trerifcoytlptraieslt0 etrxo oodaltelfctls) Drmxmo;t1apxoif3tysfmDrl(mpnt4aexnir3oadfmt  n o t) 2tr(m3iu4ap elfvia( artaxmo;u1alxnifeiytla2ulu o u0arenxo3iytlp rau i t) 2to(rpiu1llenlnci tfaDra(  nt4apeo f3tadfs2uau pn()arxomr iotopDraueil( trurio3iydlmtnmieilt)arra( onu1apen fetyd sDrmn o () etnio3ootfaD  u s s  rxr(o no4llenlneil( srrrxm no4oex io3tyd a ra(vpnt)tetoio3tydomtr nesls texr(rpiydopenlfctasf Dum(m ;o1tpe io3iyslaDelu s;u0arxrifciadfmte ies;s teurir ny1lm  lnvs t)sDrmxr oo1oexomo3iad m rl(vs;t0trtoir3oa1lmD  n i;t0 etrxr3iy1lpte nvs sfsDrm( poo0tpxn ietltls2rmnvsnu)arerio oadfpt  i sl() 2xo(mpoy1lm nlfct t)aDtaur oo4tpxoioeils mDemn snt0aetnxoctydlmDe uvol(0srxoxm iodamt liesas)srrrx poo0tptoii3iad a2uanvo;u0 eeoio oo1laDeli s;(0texo(opiu4omeemfctls)srrax ono0opxnmiciyd mDulnmo (0aleoirctotla r ues t s2ur(rpno1ome  ncs ( s2urxmo;t0tex mieiysfsDelump;u0tlxoxr3to1fat lnvi;t0trtoio iy1lm nlfeta(farraurp;o4tetoifeildfa rlnms;()tlerifcto1fmteln ilt sexrim nu4ape lfciat s2tr(mpou0alxnmf3tysfa2elnvont4teenmocoo1lmDr u i;s0truoio oy4ale  ietatfaDuau onu0ole ii3iysla ua(vp;t4arxoio3ty1om ranei;s t2xoxo nydlmenlicia( sDua(  nu1apx  f3iytfsDum(ms;() lenmr oatfa   n s;t  2uo(m3nudapenmfei s sDrmum no4opx  oeiyd s eanms;t4aexrmfcia1oate u olt) 2xo(rpio4ap elnvtas arumu  ;t0altniociys a uanmsnu4 etoirctodfa eau s t setrirpno1lmeelietat srta(ronu0tet ii3iytfsDeau p;u4arxnir3oytfpDelu o s  eum(o nodop n nctlt srtaumoot0aet ii3iysfm2umnvo;t)trtnmr3iytlatrlueils tetm(o io4al   nctatfsDur(ro;u4opt mo3iydlaDuln s;u0tlxrmo ty1lmD aivo s)t2to(r3ou4lm nmnesltf Dtru pnu4apeomieild sDeaump;t0 ltrmo oatlp   u o s0texm(r oydole lfvtlt  rrm(mpot0aex iietyt s2el(vp;t)arxoxrcoadlm rlieols0texrio nodapenlnes sfsrrauro;o1oeeoifetlsfm2rl(mp t4alxoxrcia1om  lu o;s  rxrxo iu4lm   net s)a2ur(ronu1opto ieilsla2rlnvs u)alxrmf tadoa raies s)trxo(rpiy4lmte nvtl(f 2ra(mp;u4opx moetadls2ua(monu0 lxrif3tytlate n ilt  rxmimpoy1am e ncs t srtmxmont1olen o3iatlsDulumo;(0artnircoydoa eai o;( srum(r3io1apt mnes ()sDtmxm oo1apenioetas s2em(ms;(4aexrmociatoate nvo;(0teto(o iodomt  ici ( srrr(  ;t1opt  ietadlsDua( p (4trtnio ta1opt livsls)s2xrxrpnudol  mici s arur(m ;u0tlx  o3tlsfsDulnvo () rxnxfcio1oat  ieil(0teuoxrpoodam n ncils)s2taump;o4apeoifctltfa ulnmp (0teeomf ta1lm eaivi;t trxmio3iu4lme mivsls aDum(rpoo4tee io3iatfm raums t0 exomrcoadfmD li s s)trxo(o3oo4lp nlnvt ()s2uru oou0tpeo ieiysfm2ul(vp (0artomfctodomtrlivo;s)setoim ou1lltemncilt) rrmuro;u0oleo o3tlslaDranmp u0 etrxrcto1oatrlu i s  2um(r iydope  ncsl()srumxmpno4apeoiietytla elu p u)artnmo ia1fmtrlneol(0teuoxrpno1am nlics t)aDrmxrp;t4olx  fetlslm uauvp u4aleoircto1oa  aieslt srto(r iy4ope  neias a2tmxrpoo0tlx ifciyd mDeln ont4tetomfcoytoa eau ol(  rumxo3oodop  mncsl() 2trxm ot1oexniocildfm2em(vsn(0tlerir3ty1fpD anei s)t2urxr nudome  fciasf rrr(mpot0olt mictytfaDrmnvs;t0 etnif oodoa raues t0teuo(o oo1llt lnci t)aDrmx  nu1olt mfciytfm rlu s t0 lxnxrciodop r uvs (0srxmxo oodlm emneslt) 2uax oou0opx mfeiltfaDuau s (4tetoxo oa1omtrlu sls)sruoiopoo4opt mfei t aDuauronu4olen oetadfsDra( pnu0aeermr3todfpDeaiei;t  eumiopno4om  lnetas aDtmxroot4tpto i3tas m2rlnms;(4teeoxfctatfmDeli s;(0s2trim iu4lme lfvi tf Draxronu0opt  o3iltfs uanmonu4 renxo iydopDeai sl( t2toxmpny4apte fesas) rtr(rp;o1olenmi3iydla uau o t0teeoir iydlaDeaneo;s)s2tm(r3iydlptemfvsa()artm(m ;t0aex  f3tas s2emu o;u) ltrir iadomDelies t0 exrim no1omenlnciasfs2trxmo;o4opx iociatfaDrl( s t0tlenif3todoateai ols seur(o3iy1opee fcia(faDrmu o;u1aeenmi3ilslaDea(vp;u4aexnmo3oydlpDeauvi;s0sruoxo3oy1ol emfeia(  rumx p;u0aee mfeiad a ra( p;t)arxnxo ia1oaD  uei s)trxmxm iu1omt micsl()aDuau p;o1tex mo3iasfm eluvont4arxomo oydla  lnvs;t0t2uoio3oodam emivsasf rumuro;u0opx iicilsla2ua( s;u4 renxr3tytlmt aneils)trtmirpoudape liesa()aDua( oou4oeen fetyd s2eanmonu) ltnxr oy1omte n i;(0truo(mpiudlmt mfcsasfs2ra(mont1optnmi3iytfm2ra(mp t0tlermr3tytlp rauvils t2urio3nu4ape mnetl(faDur(rp;t4optnmfeiltlmDum(mo;t)artrmr3ia1lm  auvs t)srtmxo3iodomen nvsa() Dtm(rpoo0tetniociltlm2rluvont)aexrmo3tatfaDr n s;t)s2tmirpou1omtn iciat srum(rp;t1tee  i3iydlsDea(vs t0aleoifcto1op  li i;( t2urio3iy4olte nvslsfaDtaum no0tetoifetls a2rl( on(0aeermo3oytfatr i sl(  etoxrpiy1lmenlfvt s)aDum(ro;t0oexn f3ilslaDranvs;t)trerif todfate ues s) 2xrio3iy1ol nmncsls)srtrx p;o4olx  icias a uanvsnu4 etnif oo1oa e ieslt  rxrxmpiu4ap e icsa(f Drau  no1tex mfctltfa2ul(vp (0teeoxr3io1lptelnvs;()trxo(o3oydapt  ncta(faDtmx oou1tpeo iciytlsDul(vo (4trtrirciatfaDrlnvo () euoxrpiy4ape  fcias  2rax  oo0opx mfeilsfaDranmonu0artoxfcoydoa  au i;t) 2xmimpiudoptn icias srrm(rpot4optn oetyslsDrmumont)tlenio todfpDrai s ()teumim iudlp n neta(f Dumuront1oee mo3iad a elumpnu4 lenmrcia1la  aneil(  rto(r3iodlm emnes ()aDta(r ot4oeenii3iyt mDum(vo;() eerifcoadopt lnvil()trxrir ou4lm   ivilt) rrau pnt4olxnii3tasfs umn s u) etnir iy1fat auei t0 rtoimpoodopenmnesl(f ruaum ot1oetoio3iltlmDran on(4tlerxrcoatfm  aneolt t2uo(o iodap   nvs t  rrau pnu1tpxnii3iadlaDeanvp;u0altoif iatfmDe u o t  2tm(opio1amtnlfvslt) rrau p;u4aetnmf3iltfa ean on(0arerifcoatlaD aivs;s tetrirpoy4ale  net t)sDuaxrp;u0oltnmociatfm2umnmpnt)arxoifctadfpte ivo;s) ruo(r oudol  mnes s)aDtr(moot0openmoetys a emnmpn(0aetnif3oydfa  luvi;s)s2xmir io1lpt lietlt)srrrxrpou0tltoifciyd s2um(vpnu4teenifciadfmDr nesl()sexmir3io1omee fesl() rum( pno0texomfciasfa rlump (0texrxo3io1laDrluvo;( truoxo3iydapee iesas)s2tmum ;u0tpxomfetld s eau on(4tlerifciadlaDeau i ()s2uoir no4lm e fvia(fs2rm(rpou4alen iciadla2rl(mp;(0 lxnxf3tytfmtr ivs ( s2xrxrpoo4opt  ieiat arrrx  ;t4tpx ii3ias a2ran o;u4trxnmr3oodlmtrauei;s0t2um(opiydlme lfctat s2raurpnu4texnioeiasfmDeauvonu) rxoxf3tytlaDrli olt)trxoxr3nu4alen fvsat) Dtax pnu4opxnioctytlm elnvs u0aexrmr io1oa eai il(0srxoirpny4ap  mncta() Dtm(rp;u4ope iociaslm elnms;u) ltomo iytfp r n sl( trxmio3nodlle mieiat a2rm(mpnt0aptn o3ildfmDrl(vo u)tetniocoy1fpD aieo (0 rtoirpnodlpenmnetasfaDuaxmp;o4apxo fctysfmDumnmp u)artrmo iodfp eaiei;t s2xrxo3oo4om n ictat artru  oo0tlt  iciydfs eaumo;t4 rxnxr3oo1lm  aivo (0 2uoxo3oudaptelnei s s2raum nt4aexoiiciadla rmn ont) rtomoctadopD an o;s srtr(opoy4ll emfvia()aDtaxrpnt0tlx  ictld aDumu o;()artomr ootoaD lu o s0 etmio3iu1al elfciatfa2uaxrpnu4apxo o3tasfaDraumo;t0teenio oatlp  anesl(  ruo(opoudapt lnesa()srumx  no1teeo fctytfa um( o t0alermrciodoa eau o ( s2xoxr oydole lfvtltfaruaxrp;u1tlxo f3ils a rlnvpnu)trtrmociadlptrln i;s  etrim io4oltn nvsltf Dua(r ;o1oexn f3iyt a2rmuvo t0artnir3oa1lmtr n o;s)truo(m oo1aptelnctasfsrrauro;o1olt if3iatlaDuanvs;t4 leoxo oodopDe uvs s0t2xrim3oy1aleelnvils) rtru pot0aetnmo3ild mDulnvp u4 renifctodlptr n ols0s2urxr3io4ope lieta( artaxmonu1optomicildfaDrl(mp;(4 lerxf3oatlpDrlues t  2xoiopoudlp nlivsa(f rurum ;t0aee  i3iltfm rau pn(4altnmrcty1oat ai o s) 2xo(m iudapenlivta(faDtm(r ;o0tee miciys s ul(vs;t4aleoio oadom e n s;t trtrxo3iu1lmenmnvi t) Duau pou1tpe mi3tytfs ulu o t0areoxo3ootopDrauvsl( s2xmiopoo1op nlfvi s)a2taur ou0alxomfeildfa2uluvon(0 etoifcoy1lm  luvols)tetoxm3oy1aleemnctlsf rrrxroot1tpxo iciatls rln on(4tlerxr3iadfa  anei t0teur(mpno1llt miei s) 2um( ooo4tlx moctydfa2emuvp;t0 ltoif3iy1oaD lueo (0sexmxo3nu4amenlfctltf Draurpoo0tpxnmf3iatfa2rmu o;t)tlxnmoctydfmt aiei;(0 rxr(mpnudlmt mfet s)sDraxmpno4tltniietltlmDuluvon() exrmo3oa1fm eaueo t0trum(r iy4amt lfvtas)aDtr(moot0alx if3tydlaDua( onu4 exnir3oodoaD  uvo t) exr(opoy4olen ies ()srumxm ot1ole mf3iasfa rmu o u)trtnmfciadoat aneo;() 2uoim no1oltn nvta()aDurumonu1oet mf3iydlaDrl(vp t4 renxr io1lm  ai i;t  rtoimpnodalen ics sfaruau  ;u1tet mfciytlsDulnvs;t4altrmr3ia1fm  aivi s srtoim3nodaltnmfcsasfs2rmx oou1tet mociatfaDua(vont0tltrir3ia1fm e i sls0srxrxopiy4op elfci sf 2ta(m oo1tet ifciadfm2ua(vs t4 ltomrciatfm eaueo s tetmir3ny4olte fct tfsrua(rpot4tpxn i3tlsfmDrmnmsnt4tlxnif oo1opD  i i s)seuoxm3nudoleelfvil()a2tmu  ;o0apxnmictat mDra(vp u4tltrxf oa1laDran ol()teto(mpoo1olt lieil()aDumx onu1openmo3tlt s rl( p;t) ltoif ootoat anvo;t  rtoxo oy1al  mnetat)aDuaxm ot1aeeomieiltlsDrmu p;u4 rxnmf todomtrai i;( texrio3nu4ap nlnet ()a2raxr nt1tee  octat s em(vp u0artrxo tytlateaivilt) 2xmxo iy4amt lici sf Dur(rooo4ape mfciat s2el( o (4trtrif ia1lm eauvils0s2trxm3nodam   fvslt) rrru o;u0tee iieiyd m2emnmo (4trxoio3oy1fptrlu s;( srto(o ou4ale  fcsl()a2urxrp;t1oeeomieils s uau on(4 lxrmo oo1faD  ieo;() etm(mpno4lpt  nvs ( a2rr( ont1aexo fciatfsDraumont)trenxf3to1omD lnvi;( teurir3nudlm nlncsls aDtaxr ou0opxomfetltfs2ra(ms t0 exrxoctatlmDr ieo;t)trxoirpnu4om elics ()sDta(rpot4teenioeiyd sDem( s t4tetrif3oatfmD an ols0s2xr(mpiu4ll emnet t aDrr(r ;o4apenmieiydls2elu s;(4aeeoir3ty1lmDeli olt  rurxrpnudoltemietl(fsDta(r no0oeeoioeiytfm2rauvo (4aetrmociydopt  ies (0 etriopnodll nmfvtas  2urumonu1tpeo fctatls ea(vp;(0texrif io1fa e ivs t0t2uoiopno1op n ivilt)s2trxmpot1olt  fctatla2ulnmsnt0teeoxrcoodlmtr i s () rtrim3oydomee fctas)srrmumpou1texn icias a uanvp;u4tlerxocio1laD  uvi s)t2xmiopny4ape  fvs ( a2uru o;u1altomicildfm2eln pn(0 ltoif3iydoatr ieslt t2toio3nudopt  nctas)a2taxrp;o1oexnif3tysfmDeanvo u0trtnxo ia1faD auvi;s0srurimpoy4olenlicsa() Drm(mp;t0aetoiietad s2eaums u0 lxnxf oadlat an o;s0s2ur(rpno1lm   nvsat  2urur nu4oet mi3iydls2eanvonu)altriociotoa  aieil()seurxr3oodamtelnvt sf 2rrumpnt0teto i3tasls2uanvonu4 renxr oatopt auvols)t2to(o3io1omt mfcs ()aDuau  oo0olto o3ild a uluvo t)tlxnxrcoy1oa rau ols)t2xoxmpny1lmt mfvta( aDur(mp;u1tpx mf3tysfmDra( snt)texoio3iytfaD  nesls)teumir3iu4lmtnmfcslt  2uau  oo4tpx iietldfa umuvonu)arenmr oydfmD au s;t srurxr3iu1oltnmnvt sf rrmxrono1tlen o3tydfa em(mont0arerio3oatlatrlneo;t0 2tmxm3ou4amen nvils srtr(rp;t4openmfciasfs rln o (4arenmf3ty1lm  luei;t teur(r nydole lnvs s)srumum nu1oex mociatfs2rlnmpn(4alxomo3to1oaDr ieil(0 2uo(rpoydal nmnvt () 2rax onu4olxomfeiytfa2rl(mpn(4alerxociodoa   uvi (  rur(opiodopenmictat)sDuax  ;o1olxomociyslm ulnmo () renir3iotoaDean s s s2tm(rpno4ame  nvilt)aDrrxmpnt1tlxn f3tyd a2ra(ms;t4trxrxoctadoat  neo s)texrxr iydol elicia( s2ua(r oo4aexo o3iyd s2umnvs u4alxomf oatlaDe ieols0 ruoxr oo1lle licsat aDrr(mp;o1tpe mo3tadfsDulu ont4tetnio3oa1lptrai i t0 eum(m3iu4lp nmfci tf Dtax pot0tlx ii3ias aDelnmo;u4tlxrirciytfmtrlu olt) 2umir3oydop nlivi (fsrrauronu4oleoifciadlmDemnmonu4aeenxfcoodfpt ai i;(  2to(opou1am elfeta(fs2rr(mo;u4olx  f3iys mDrmn pn() exomr iotfaD aueilt) 2tr(m oy4omen fcia(  Dumumo;t0aeeniieiadlsDelu p;(4aexrxf3iatom  lueolt0 eurxmpou1alee ivi s arumx ono0texnmfeilt s2el( s (0alxrif3iodfa r u ils srtmim3oo4amt  ncsat  Dra(root1oeen ietadfs elnvsnu4texrio3oy1fpte nvo;(0t2umxr3nu4omtemicsa()s2ra(r ;u1tee  i3iat s2em(vont)aexnmo iytfa raivo t0 2xr(r no4lp  lncsas  2uru onu1alxnmietadlm2elumpn(4areniociytfm  auvs t0 rxmio3iudame  net s)s2umuro;o1tlx  ietldfm ulu s u4aeeoiociodoaDeai s;(0s2ur(r3no4ole mfcs tfaDrmu pou1aeeoifctldla rauvp u4aeenirctodoptrau ols teuo(r3nodll elfeslt aDrmx ont1optn i3tytfmDeln s (0artrmf3ta1lmD aneilt s2tm(r ou4al elics s sDrmxrpoo4oltnmociltla rmump ()tetrmr iydfpDeanvil(0 ruoxmpoy4ope livi s  rrmxroou1oee  feild s ra(msnt0tetomf tydla rauvsls texo(o io4amen fvtlsf 2rax  nu4oexnmietys s2ranvp t0tlxoxo3oydfm   nvsl(  rumim3nodlleemnvs t  rurxm no1tpeo fetat a um(mp t) ltoir ta1fm e n sl()srxoio3iudopee ieil(fsDtmurp;u4oet  ieilsfa2rmu p (4aexnirctydlp r neo (  2xmimpou4ol eliei sf rum(mo;t1tlxo oeias s rau s;u0trtrir3ta1lpDr n s t0t2tmxr iu4altnlncil() rum(m nt0tetomo3tys a2umu o () exnxr3ty1optr nvo ( seuoxm3iudame mfetls srraurpoo1optn ietld m2ra(ms;t0trtoxr3ty1oaDr n i;t) euo(r3iudape liei t  Dtau pou4tlx mietad a uluvpnt0trxrmr3oy1faDrlivi s0srtrio iu4lmtnmieias  Dta( o;o1opt  ocilsfsDrlu s;t0alenxrcoatla eln i t s2umxm nydlltemicsat) 2ua( o;o0apx ioetyd aDumumpn(0tlxrir ootfp rauvs t)trto(mpiydalenmici ( sDumumpou4tle ifctytla ran p (4alxrxrcoy1lp elivs t sexoim nudap emneia(fsrrmxm ;t1opx ifciadfmDem(msnu)arxomf3oo1lateaues;t0 eurxo3iu4op nmnvi sfa2rm(r ;u0aleoioeiatfs ua( o t4trtrmocoy1fmDean olt t2uo(opoy1amenlfeiasf rtmx pnu4tlt ifeiad s2ea(vont0aeenxr3totoat lieo s s2uoio ou4omenmieiltfartaur ou0tlen feilsls emnvp;t0tleomociy1om rli o;s srxrio3oodolen icslt) rum(m ;u1aexn i3iydls2ran o u0 exomr3tydom e ues;s s2xo(rpny1apenlnetls)srtrxm ;t1aptomfciytfaDrlnmp u)treniocto1lm rlu o;( seuoir oy4altn nciat) rra( p;u0tpx iieilt s2uauvonu) etrxfcoy1fptr u o;( trtmiopou4lmenlfcil( aDtmxm ;t4tlx mf3iasfm2ua(msnt)arerxr3oydomtr n i (  2xrxm3iy1al e fesls  2tmx  ;u0tex ioctldls2ra( ont4aetrxr3tytlmtrlu i;s0truoio3io4lpenmnctlt  2tm( oot0tlt ii3iad a um(mo;(4tltoio3ta1lm  livo t trxoxmpnudllt mfet t  Dtm(ro;t4texnmfeilsfa2emu ont) rxrxfcoydlmDr uvol(0tetm(rpoy4lp   fvs sfartr(  oo1ale  fciad s2uluvs;t0 lenmrctodoaD  u slt0trtoxm3oo1amen ncia() Dtr( pnt4tpxn ieiytla eanvp;t4arxrxf3oy1latean s;(0 euriopoo1llee fvtlsfaDrru ont4tltoii3tas m2rln s;u4trtrio3iytlpD lnvi;t  2umxr iy4amenlicias sruaxmo;t4apxn iciyd s ua(vp;() rtrmf totfmt anvslt) 2toio3io4lptn fvs s s2ur(r ;t1aeto f3iyt m2uanvp;t0tetoirctatlptrauesls  rtmxmpoodlpeemfeslt  Drau o;t1tetoioeiyt m uaumo t)tltnir3ta1fm e uvo t)texr(mpou1omee nvslt srraurooo0aptnmi3tlt sDea( s (0 exomf totlaDrli s;s0trtoiopoydoltnlnesls)aDtauro;u4apeoif3tyt m2rm(mo ()trtrxf todfpt ai s t s2tm(o3nu4lp nlncsas arrau ono1aexnmietldla2ra( s;t)trermr tadla eluvs ()srumim oo1al nmfetl(  Draump;t0tptniietaslmDel(vs;t0 rxomocty1oatr ues ( srxo(m3iodop n nesas)a2urxmpnu1optn ociytls2ua( o ()alxnmo3oydfmDraneo;t texoxopiu4lp  mivsasfartaum nt4tee moeiyt m2ra( o;(4 rerif tytopteln i () ruo(opnodapte iei t)a2trxronu4tpxnmiciytfmDeln sn(0trerxr3iytoatraneo;t trxmim nydape lnctls)srraumono4tptoifcildlaDem(vpn(4teenxf3iatfpDr i o;(0 etrxo iu1lmt lfci (fsrta(r ot1olxomiciltfs rmuvs (4artrmo3oydlate neo s)t2tmim nudomtemict s arrmumpno0aex ii3tad s2rmu s t) rxnifctotoat lnvil( seum(o3nu4optnlicsas) rtm(rpou4opxomoeildlm2el( s;(0aeeoif tadfm  livolt  2xrxr oy1lm  mies t  2um( o;u4tlxo f3iltfm2eanmp;(4 eeomoctadfmDrlieil(0s2tr(m3nodoltnlivsasf rtruro;o0tlt  ocildfm2uaumo t4 rtnxocty1faDr nvslt0seurxmpoydlmeemnvtat s2um(ro;u4tpen i3tytfm uau pn(4 rtomo3iatomD aivi t srtoxr3nodaptnmncs tf 2tau pno4aetnii3tytlm2umnmsnu4tlxoxr io1fa elu i;s0t2trio3oy1lpe  nct t) Dtau  ;t0aexniicilsls rmuvp t0 lxoxoctotomt  uvo (  euoxr3oodllt  nei t  Dum(m oo1ole ii3tadfm ul( p () eeoiociytlpDrluvo s0 ruoio iu4amenmfvi ()s2trumoot1teeniictad sDulnmsnt0arxnmoctatfm eaivs ( s2trxr3io1omeemicilt s2ta( oot1oltomieiltfa ea(mo;t) lxomrcty1fmt aneolt) eum(o3iodllt  fvia()a2ta(mp;u0oltomi3tatfm2el(mp u4 rermocoo1opD luvils0trumirpio1lmeemieiasf rtr(ro;u1tpt ii3ildla eaumsnt4aexnxr oodfaDr ivilt) etrxr iy1ll e ivs t)s2trxm nt4tetnmoeiysfsDum(vpnu4 eenmociatlm   nvo s texo(rpou4lp emnesl( artmu onu4opto fciadfm2uauvo u0altrxo ootlaDeai olt0s2toio3nu1ap   nes ( aDtru  ot4tlt mi3tltfs2ua(msnt0alxoxo totfpDe u ols0setr(rpno1lmt mnetls a2umuroou0openio3tldfs rm(mo (4trtnxf3ia1oatr ies;(  rxoxrpio1apen ivtas srrmump;o4ale  ociadfsDrm(mp t) ltnmrctotlaDrau s;(0 rurxm3oo1omtnmnciat)s2umxr no4apxn fciadfm eau s;t)aetrmr ty1lptr ueolt0setmio3iydlp  livtl(f Dumu pnt4aex ifctlsfsDuln o (0trxoif tytopD aieo s) eurir nydomtemnvia( sDrru  oo0opeoio3tadls uauvp;t4trtrir oytopt  n i;(0s2xoxr3iudlle lfcias)arurxr nu1tptn o3tys s2uanmo t4trerifctodfpt  neo t srtoxo nudapee ictat artm( p;o4tlxo ociyd m2ea( p;t0artnxr ty1omD anvslt0s2xo(rpou4apenlietat aDrmx ont0olxn o3iyd s2elumpnu4treomociotlp rlnvil(0srtr(rpoy4am n fciatfa2rmurpnu1apto i3tatlsDemuvo;u0 ltoxr3iodlp rlueo;( s2xrxo3oodop n nesat) rtaurpot0alxomo3iytls umu p;t4treoxocio1lmD liei;( trtrxopio1ame mfvsas  ruaumoot1apx iictyslmDelu p (0 etnmo3iotoaDrau olt)setoxo3iy4am elfcs t)sDurum ;o0tetomfeildfm2emn s t0teermrctytfa  an s ()trtr(m3nu1om e ics () rrru pot0open o3tlt mDrmn s u4 exoxfcoydfaDr ueo;()trurxrpiu1aptelnvi sf rurxmoot1apx  icilt aDrlnms (4alxomf3tydfatrli olt)tetr(r nydop elnetat sDumx  nt0apx ifeiatlaDelumo;(0 lxoxf3oydfp rai s;()trtr(r oo4opt  ictls sDum(root0aeeoifeiydfsDeanvo;t)tleomociadlp  lueo;s0 exm(o3io4lp   ietl() Dur(rpno0aexo i3iytfs2rmump;t0aexrxo to1fa rlu s;t)s2toxm3ou1apeelfvsas)srtm( ono0apxo o3ilsfs2umnms t4trxoxo3oo1fpt  nvi;t0sexm(o no4lltemicsa( artaxronu0tpt moeiadfs2ulnms (0 eeoxrciotoaDeauvs;() etm(rpiudlltn ieias sruru p;u1tlxnio3tysfs2rm(msn(4trxoxr iydfmtrlneolt0srxmxo3no4amtelnvsasfarumurp;u1olxn oeiatlsDemn on(0aeeoxrcoydomtranvs;s) rxm(rpiu1ameemfei t  Dtmu onu1opto ietls aDrau o;u0arxnio oo1omDe ueolt0 2xoim iudape lfvsa() ruaur nu4tlto ociydfsDul( on(4teeoxf3oy1omDran i;t sexr(m oudal elfvils) rra(r nt4tlxomoctyd mDrmuvo t)texrxr3ty1fmDe uei t0s2tmio3iu1ap n nvtas)s2ua(rp;o0olto f3tlt mDumuvo;u4altomr iydfpDeaieolt)setm(r3no4apen neils  Drm(r ;o4oet  ociydfa2ea( s;u4tltomo tydfm rlnvo (0t2umxmpoo1ll nlfci (fs2uau  ot0tpxo f3taslsDum(mon(0 exoir3tatlmt an s;s0trumir oy4lptnlncslt srtm(r nt0oeenmo3tatfa2rmn ont4tlenxrciodfp e n il()sruo(opnudlp e fvi ( s2trurpou4tlxomfetysfm ul( on(0 renif3ty1fpt lu sls teuo(mpiu1lmtemivtatfaDrr(ro;t4olt ifctas s uan snu)artnmf3tadomDrlu ilt)sexmiopoy4ll nmfetat artm(mont1tltomoetlt s um(vpnu) lxnxo totlmt ln slt0t2urir3iydoltelnci sfsDrmxmoot4tlx mfcild sDul(mo u0arerio oytfa rai i;s)srxo(o3oo4ll n ivias) Dtmxrpoo0olto ieiytfm2rl(vo;t0alxomrcootla  lieslt0srxmim3ny4amen fvs s)s2trumpnu0aeto iciatfa2ul(vo;(0aleoir todopt ln o;(0texoxo3nu4lmte fetlt  rra(mpot0olt if3iadfm rm(mpnu4arxoifctydop  lieo;( t2to(m3oo1ol e nvi t arrrxmpnt1tlx mociytfm emnms u0 eeoxrcty1fptrlnes;s setoxrpiodllen iesas)a2trxm ;o0tpto o3tls m2eanmont0trxoir3iotfpD anvs s0s2umxmpoy4lp elfctls) rumu pnt1aetnmfciytlm2rmnvo t4arxoircoy1fate ivil(0 2urio3iudome mnvsltf rtmxmo;t1oetn f3iad s rlnvsnt)trtoxociotop rlieo;()trxm(o3oodalen nvi (  2rmu  ;o4aeeo ieiytls rlnvs;u0 eermf ia1laD livil()sexmir iu4opee net sf Dtr( oou0olxomfeias a2eauvon(0tlxoxfctydfat lueolt0s2xoxrpnodlpen nvils  Drmxmpnu0ole ii3ils a umn o u4 etnxo3ta1fmtr uvilt0 2xr(r oodll nlncta(fsrur(rpnu4tpeo oeiyd s2ua(mo;() ltrxr3oytlpDeaneilt  rumim3no1opeemfet tfs2uaump;t0alxoifctlslm rlnvsnu)arxrxo3ty1lpt  uesls)trxo(o3iodlp  livtl(  rrm(m ;o1apx ioeilslm emumonu4 exnmrcia1lmt  i o s0sruoxm3oy4op n fvsls sruaxr oo0tetnifeiyslmDem(vo t0 rxnif3oadlpteliesl(  rumxo3oo1aptn fctas aDtax o;t0tpx moeias a2emnvp;t0aetrmfciy1fmte nvs;s) rxr(opnu4olenlnei sfa2rmurp;t1olxnmfeiltlaDuauvs (4artnmocootlmt aueo;s)sexrim iy1altemfct s)s2urxmp;u0aet io3ils m2ra(vo (0aexrifcoa1lpD livils)t2umimpou4ome  fetlt)artmur ou1ole  oeiyslm elums t)aexoxr oodlm e ivil( s2uoxrpoo1alt mnctlt arrmum ou0aetn fcildfaDea(ms;u0 lxoirctydopDr i o;t0sruoimpny1lle mncslsf rum(r no4oeenifetydlsDel(vs ()aetoxfcta1fpD  ues;t) rumir iydam nmiviasfaDuau  ou1ape  o3iydfa2rln p t)alxrxfciadfmD au s;s)s2xo(o3iy1om  miei tfs2urxrpno4aexoiietadlaDrmump (4 lxnxfcoo1fmD ln i ()s2toiopiu1ap nlfcslsf Durxr no0aet iictadla2uan on(0aeeomo3ty1oateli s (0 ruo(opnu4om elncilt)sDrm( p;t4oexo ictydlm2em(ms u4 etrif3ta1fat aies;t) etm(opiodapt lici s) Drax  ;u4olto i3tatlmDranmp;u)trxnxf oytomD  nvols0srtoxo oydamt mncsl(f Dtaur nu0alxnmieiatlm rl(mp;t0tetrmf3ty1lmt  n i s  ruoir3iy4aptn neia() Drrum oo4aet  octyslsDul( s t0alermo iydlm r ieo;( t2xrxr3nodol   ict s) ruaumo;u4ope ifeiaslm rln p;t0aexrir iytlm  lu s;s0 exoio iy1aleelfvia( aDtmx  ;u0tpxniictyslm uan ont4 lxoxo3oadlmD  u i;s0srumxr3no1opeemfctas)sruru  ;o1apt ifetytls uluvo () exrirciadlmD lnvo ( t2xrir3oo4lmenmictatfsrum( ono1aex  ieiydfa2eluvs (0trxrio3totlp elivs;(0 etr(o oo1optemnesasfa2rmuro;u4apen oeilsfa2em(mo;(4aeenxrcoodlp  aivsl( teto(m nodlpe lfvsasf 2rru  nu0apx ii3ilsfa2rmnvp;t4treniocoytlmte uvs s)s2xrim3ny4ol nmfvtlsfsrrmuro;o0oex mfciadfmDem( p;t4alxnif3tatfp  aieo () rurxmpoo1lmtnlneta()sDtm(mo;t4texo ietld a rauvp (4altrio3totfpteanei;s)t2to(rpiu4optn ncilsfsDrm(rp;u4aex  octas aDeanms t0trtnmoctydfatean s;(0sexo(o oudlp n nvsl(fs2rm(mont0apxo iciyt a2ua(mo u)arermo iatfptr ivs ()s2uoxr no1altnmivslt  ruaxmoot1opxo ictlslaDem( snu4 reoir ty1oaDe i o;t0srtmim3nodolee neias artmx p;u1aleniocilslm2ra(mp;(0aetnmfcoatop eauvo ( seto(o3nu1lptnmnviltfsDrmxmp;t0altn feild a elnmont4trxnxfcoatlatelu s;s s2umxr3nu4lmt mfctls  ruau  nt1open fctatfa2rmnvs u0 etoio oy1lmt aivs;s) exmxmpio4opt licil( s2uaxmpno0alxniociaslm2emuvp ()altoiociotfmte ivi t)sexm(o iodoptnmieiatf Drauronu1aexo fcildfsDrlnmp u4tltomo3iodfm rlueo;t srto(opiu4omtemncslt  rumxro;u0aleo fciytla eau snu4arxnxocoadomDrauvs s seumir oy1olt mncsls sDumxronu0altnmietytfaDul(ms () exoxf3totlatrluesl(0s2xm(o ny1omenlivs s aDraxmont1teenifetasls um( s t) ltnxr3tydfat  i i;s)s2xoio3iydlmee ictat s2uaumpou0aeenmi3ild aDraumsn()tlxnirctotoa   ieils0 rxrimpiy4om  lietasf 2rau ooo0texnmfetytfm2ulnvpn() exnxr oadoateli o;(0srur(m nodllt  ncsls)aruru o;t4aexn ieiltfaDulu p (4alxoio tydlptr u o;()tetmxopiy1om  lfcil()aDuaumont4tetn oeias aDul(vs;t0arenxfciotlptr ivs;( t2ur(r3iu1lm nmncsas) rrrx  ou1oexnmo3iat sDeanvo;t0 lxniocootfaDe nvo;t)tetrxo oudapee fvilsfa2tau p;u0tpx  i3iysls emu p u) rxrir3oydopD  iei t)t2trxm3iodoptn icsltfa2ra(  oo0oleo feiasfs2rluvsnt0aleomfciydfat lues;( srumxo3iu1lmtnmfcil( s2uaum ;t0oetn o3tydfsDeanmsnt4 rtnxo oytlmt lnvs;()sruoxo3ou4al e fvta( aDrmx  oo0tltnio3iltls2eauvsnt4trenmrcoatlp elivsl(0 rxm(opiydlptemnvtl()arurxrp;o1altomoeiytfm2um( s;(0tlermf tytfm e i o s)sexrxm nudamee nvt s aDuau p;u1apxniictas m eanms t4 exrmr oodoaDe nes ( t2tr(rpio4lpe  neias  2tau oot0tlxn f3iasls2rmnmsn(4artrxf oa1opt liei;s0srto(m iy1al nlneils srumu pno0oexnmfeiaslsDumu pn(0alxrir oodlptrlneilt0setrxmpou4ole mivsltfsDrrumpno1alx mieils mDrlnvp;(4 rxnxr todoa eauei;s tetmir iu1lpte iciatfa2rrxrpnt1aetomf3iatlsDrmu s u0aetoifctatfpt li s t)trum(r io1llt lneias sDtmu  nt4tex  ietysfm2ua(vonu)aeerxr iadomt aivi (  rtr(rpoo1oleemfvs t) Dumum nt0oeenifcildfaDrluvp;t)aleoif3iy1fmDrlneolt0 2xo(rpiu4lme  iesa()arumxr nt1alenioeias aDrmuvs t)aexnxr3iy1lptelivo s truoxm3iydalen ivtat s2ta(root4olto fetydlsDumump;()artrmr3iytfaDelnvi () 2trxr3oudlltnlivi (  Dtrurpnu4aeeomo3iytlsDem( o (4 reomo3oy1oaDeli ol(  2urxo nu4lptelfvtlsfs2ururono4apeomieiydlaDumn onu) rxoxrcoy1oateau i;(0sexm(r3nodomt mivsatfs2rr(rp;t0tlx mfeiytfsDuaump;u4teenmr3oadfa   ieo t)t2xr(o no4op emfet (  2tm(r oo1tee iictysls2emumont4arxoxfciadlpD  uei s0 euoxo nu4lp nlnvsat)srtr(roou4oee ioetltfs umnms u)tlxrmf3tatopDranvo;(0 rxoxm3nydom e fcsls srrmurooo4altomo3iydlaDemnvp;t)arxrxo3tydlmtelueo;s) eto(o nydapeemivs s)srum(  ot4tpe mo3tys sDrau p;(4 etomo tytoptrai sl() etmim oo1llenmfvsas)aDrmurpou0olx ifcilsls2ra(vonu0 rxnmf totfateli o s) rurxr3oy4omt  neslt sDrrurp;t0teto i3ildlm2eln snt0altnioctodlatrai i;(0 rtoimpnu4om nmfctl( sDtax  ;t1olxomociatfs um( snu0trtnmo3iatfmDe n ol(0 2to(m nu4apee nvsls)aDrrxrpnu0alxomo3iadfmDemumsn(0aexnmfcto1optelu ils t2urxr3iydomenmivil()a2rmx  nt4oetnifetasls2um( s;t0 rtnxf iodoa r ues;s  2xo(m nu1apt lnet t)aruaxmoou4aexn ieiydlm2el(vpnt)texrxfcoadfm eaiei s0sruoimpio4oleelnvil( aDuau  ou1tlenio3iltfs2rau p;u0 etrif oatlaD anvo;s0setrxm3ny4lpen iei s)s2ra(rono0alen i3iys a2ea(vp t4texrxr3iotlmt luvi;t0 etm(rpiu1ape mivs tf Drm(ro;t4aeeomociysls rmu s u4trtomfciytoateai i;s)s2xo(r iu1amee neia(fs2rmumooo0teenmocilsfm2em(von(0tetomfctadoaDe u o;(0 2tm(rpiy4optn icsl( s2ururoou4texomfeildfa ulnmp;t) exrmo iatlp rauei (0tetrir3iodoptn nvsatf rtr(mpou1texn ieiyt aDranmsn(4 lenmo3todlateanvils srxr(m3nydomeemivs s)aDrrxmp;t4teen ietydfsDrln s u)trtnmo oytopDe ivi ( srtm(m nu4oltnmivslt  2tmxm ;u4opxoioetys mDrauvp;u0 lenio3tydlatelnvo (0trumimpoy1lm e fes t)s2um(rp;t4opxnioeiydfm2rl( o;(4trxoifcoatoatelieo;t)sruo(m3nydapenmfciltfartr(m nt1ope iictytls uluvon()arxoir3iy1fpDe uei (0trtriopio1opt lnet s)s2taxmpnu0aex  oeiyslsDul(vp;u4trtoxfctydoaDraieilt teto(r nudlleemiesls)srta( onu4oex mieiyslaDra(mont0altrxocoa1fatelnesls)setr(m3iy4opt mnetlt)srtmumo;o0tle iieiatfm2umn p;t) ltnmr oydomD lnvslt  rxr(o3nu4ame  nvtas)arraxmont4aet if3iasfa umn s;u)arxomf3io1op eaiei s0t2xr(m3oodlleemfcsat a2uaxrpoo4aptnioctydla2rln snt)arxrmo to1opDrau ils)texoio iydopee nei ()s2rau  ;t1texoifciltla2emnms;t0trtnxf3todfaDeluvo ()trtoxo3oy4ol e neta(fsrtm( p;o0tlt  f3tyslm2emnmpnt0altnioctotoaDe ivo (  2urim3oo1lm e ivsa()srumump;u4opeo fciadlm rl( o;u0aetoxo3oo1omtrluei;s seuo(mpiy4llt lnvslt srumur no0oetnmieiltlm uan p t4 ltrifcta1fp   u o t0t2xr(mpou1ol n fes s) Dta( poo0olxo oeilslmDrmu snu0 rerio oatfaDe u i t s2xr(mpiy4lmtemivia(  rta( pot4ape iicild aDelu s u0texnif iydfmtr uvs;t) 2tm(o nudolt  nesas  2umum nt1aexnmoeiyt s2eau o;u4 lerir oo1latrln i;t0 exrio3nudlmt  nvtlsfaDra( o;u0alx  iciys a rmu o;t4tlxnir3totoatrluvo (0trxoim nu1apenmfctasfa2ra(  ot4aetnmo3iatfmDua(mo t)aeenifcoo1lp  aivi ()tetrxrpny4aleemicsasf rururo;u4opeoioeildlm2ra(vo;t0tleoifctadoat  u sl(0srurio iudlmee nesatfsDra(rpno4aetn oeiadlmDemnms;t)texrio iotop rlu i () 2xoio nodllee fci t  2tauronu4alx  o3tad s2rm( onu0artrif3iotfmtr ivi;s t2xrxo oy4oltnmict sfs2ta(m ;o4tpenmf3iltfsDra( p;t)aetomrcia1fa rli i s teur(r3iy4oleemnvtat aDra( poo1tpenmfciltlaDrm(vs;u)texrxr iadfmDraueilt trto(mpiudop   ivt sfaDtmxmo;u4alto o3tadla2umnvs;t) eermf oytlaDrlueo;s sexrimpnodopteliesa()artau oot0tetnmoctyslaDem(mp t)tltrmfcoo1lmt aiesl( t2toxrpoudal  mnet sfsDuax  ;u1teen fctasls ra(mpnu4tetrxf3tydlptrluvi;s) rtrxm3iu1lltnmfet ( arta(  oo4ape iociaslmDem( p (4 lxnifcoo1op rlu ilt  2trxo3ny1ole  fvt s arrr(rpou4tle mfeilsfa ra(ms;u) lxrir3tatomDrlu o ()tetmxm3no4lptnmfvtls arrau ono4olx  oeiat s2rluvs t0aetomf tatfp e i ols srtr(mpny4ome  nvs s) Dtmxrooo1teeoio3tydlaDeln s;(4trxomo3ia1lmDr ivo s0 rto(m iydll emncsa(fs2rmxrp;t4oexomoeiyt s2uanms (4artnir3oadlm elieo s) rtmim3iy1lp   ivtl()aDrmu p;t1ale mo3tlt m2rauvpnu0arxrif3tytoate nes s0tetmxo iudamt  ivia( artax  ou4oeeomi3tad a um( snu0aeeoxfctadlptr ivilt0setrimpny4lltnmnci (f Dta(mpnu0tpenioeiadlsDrauvo u4alenifciadfmD an olt0srtoio nydal nmicslt a2taxmont0oexomieiydls rmnmp (0tltnxf3io1lm e u ils  2xrxo nodom nmnesa(  Dua( pno0ape mictasfmDuanvsnu) ltrir3oatlaD  nvs t0s2xm(m oy4ome lnesl(  Dua(  nu4aexoii3ilsfm rmnmo;t4aetrxf3iy1om eluvs;s)t2toxm3iy1omenlfcsls) Dtrur ou0tltnmi3iydfs ul(monu4artomoctadop  lnvi s) 2xm(rpiy4alt lncs t s2rax p;o4tleoii3iltlsDelumpn()arerircto1latraueo s seuo(o3iodapt  iviasfs2ua( o;t0oltomietytlm eaumo (4tlxrmf3iodlmD au o s)teur(mpoo4lp e nvsa(f rrmum nu1ape ifciat sDemnmont0tetrir3tydfat luvilt)teto(o nodamenlivi (fa2umxmpno0texo icils s2rmnmsn(0aetnxo ty1fm ran o;(0 2xmir3iu1lpe lfci s) 2uaxr ou0tex if3ildla rm( o u)tltnxf3totfpDrlueo t)srxrio3oodll   nctat  Dtmxro;t4tpen feiydla rauvont)alxomf3tadfat  nvol() 2xrxrpoy4ap emicsatf rtrx onu4tpeoio3tydlsDrl(vo u0trxnmfcio1lp eln o s0 rumiopoo1am  lfvi tfs2truroou0aeto feiad mDeluvo;t0 rxrxr oy1fmt auei;s setr(o3iy1lp nmivs tf Dumx o;t1tee ii3iltlm rmuvpnu4trxnxr oa1omDe nvi;t  rxoio3no4optnlieia(  rumumonu4teenioetatfsDul( pnu4arxoxf iodfat  n o ()sexm(opno1open nvs (fartru  nt0tlxoio3iatfm em(vp;()trtnircoadfpt  uei s s2xm(r3no4ll elncils sDurxmonu0oltnif3iys m2elu ont4tltnirctotla eau o ()srtmim3iu1lmenmiciltfsDrrumpno1texomieilslm ra(msnu)teeomr oytfptraneol(  exo(mpnodaltelfctltf Duaxmpnu0apenmo3tyd a uanvsnt)areoir tydomteau o;t teumxrpio1ap  lnvtas s2uax onu1oexoifcilt a2eluvo;t)trxrio totfmDrli i t) eurxopiodlpe mfeiatfsrrrurooo0tetoiicilslm ulu s t4 rtrir3tadom r neolt) rtriopio4op nmnci s)a2ua(mpot0tptoio3tasls eaums ()aexnif3ootfpte ues;s0s2uoxr3ou4apte iesa()aDrau  oo1texomieilslm2um(vp (0altrxf iodoaDr uei;t  rxrio3ny1op  mieiatfs2umx o;t4aexomieiytfa2rluvp;u0 rerif3ia1la ranvs t0 2uo(r oudome lnesa()srtaur ;t1teeo ieildfs emnmo t)aleoio3tadfaDrlneo;s)teto(mpio4am n nvsas  Dumxmpno1oltoiiciadlm2rln snu0 lenmf3tytlmDeaneo t0 2urir oy4ol n net t)s2urxronu1apenmf3tadla2rm(mp;t4 rxnirctatlmtelneil(0 rurxo3oy4omen fesas)s2rrxm ;u1olx  o3ilsls2ranmont0texoxo io1fmDr nei s0texo(opiodomtemncilt)a2tru pnt1alto ictyslm2ranvp;u4teenxr oa1opD aueo;s0teumxo3iydaleemneslt)artmurpot0apt mociadfsDean o u)tleoifctotlm  luvi;s0srxoimpiy4lm  mnvsltf 2ua(rono1ope moeiatlm2rmump;t4trenifcootfm eliesls0 2urxo3oo4omeemfvtl(faDrrxmpnt0tpen ictad m2ulnvsn()aeeoxo3ta1laD aieo;s)t2xm(r ou4apte fvs t a2umum oo1ope  i3iadla uluvo;t) exomo io1oaDe ues t  2toxm nydomtn fctlt sDuax o;u0tpeo fetydfmDul(vp;t)aeeoxr3io1fm  ai ils t2trxr no4opt licia(fsDtr(mpno0oltniieiatfmDelu p u0 eenmf oo1omDeauvs s tetrio3oy1lp  lnvsatf 2tax  oo4tpxnmieiasla rluvp (4 rxrifcoy1om  lieo;(0trtoir3ny4oltelfvi s  rtru o;o0tpen ietys mDum( pnt4treoxf3oytom rlnvs;t seuoxm oy1llen ietls a2trump;t4oleniictltls2elu o (0 etnir ta1lm ean i s0t2trxo no1omee ieil( a2ur( pou0tpeoii3iad s eanmp t)arermo iodfa eluvo s  2urio iodlpt mfct (fs2umx pou1tle iieiys a2uln p (0arxrmoctotlpDrlnei;t  ruoxo io1amt  fvtatfartmump;t4aexomocildfs2uaumo (4areoifcto1op r uvi ()t2um(o3nodap nlivsas a2raxroot0alto o3ildls2emn snu0tltnio iytoat ai il(0srtrxr3nodolte nci s  rrmump;t4tee  f3tas aDulnmo;t) leoxf ootlptraueo (0trxmio no4ll n ivsl(farumxmpnt1teto i3iys a2ul( p;u4 etrxo3ootlmte u o;t  2tmxr3oy4lleelfci (farraum ot0optniociys m2rmn s;()texoxfctatfaD aneils0 2um(r3nodlltemnvils)a2taxrono1aex  ietadfa2um(vo u0aetomo3oodfpt auvo (0trtrio ny1lmtnmiviatfaDrrxrp;o4alt  i3iadlm2rmuvonu)tetoir3iydfmDeauvs s  2umxo nu1amte icil(  Dtrxmont1tptomictld a umu pn(0teeomr oadlaD ln ol( srtm(mpnu4lleemivi (fs2uax  no4tleoio3iyt s2elums;(4tetrif3iatlpDeauei ()t2urxo nodop nlnctl(fs2ur(m nt0tetn o3iydls2em(vs;()trtnif3iy1faDe n o;s srumim3iu4olt  ivta(f rum(mpou4alxn ociytfs umu ont)artnmr oy1oaDelu i s) 2umxo oudoltemnes t)s2rrum ;u4aex mictlsfs2ua(vp;()tltomf todoaDrluvi ( teurir3nydol e fvtas) rrm(mpnu4tlxn ociadfsDra( ont0 exnxr3iydop eauvo (0s2umimpnodllt lnet t)srrrx o;o0tptoiietlslm2uau on()alxrio3ty1latrli s;() 2umimpiy1lptnmnct t s2uax oou1oeenii3tlsfsDrl(vo;() lxrxo3to1oaD anvsls  rumimpio1olee nci sf rrrur ou4aexomfeiltlm2ulnmsn(4 rermocoo1lpD aieo t)t2urxopno4al  mncs ()a2raxrp;o0oex ifciydlm2ulu p t4aleomo iytfm   n i;t trxoir iudaltn nctas arum( pno0oexnmi3tatlm um(vo t4 lenmf3totlpD ln o t0t2tm(r3iy4ape  neia(fs2rau p;o1apxoif3ils s2emnmp;t4texrmr todoa  auvi t  2tr(rpiu1aleemfct (  2raxrp;o4tpenifciytfa2eanms ()areomf iotopt auvi ()trxrxr3nudal elfetas)aDra(mo;t0tpxo iciytfm rmn o (4 eenmr3iydomt  nvi s) ruo(r3oy1lpeelfvtls) rurur no1opxn o3tltlsDrmnvo;t0 lenioctodlpDeluvs;t)s2xm(o3iodale mics (f Dta(  ;u0tpen f3iasfa el( sn() rtomr3tadlpte ueo s  exr(mpiudop e nvs t)s2ua( pou0opt  oeilsfm ea( snt0 etrmr3oydoatelueo;t srtrxr3io4omee nvil(  Drm(mpot1aexnifctaslm uauvp t4tetoioctytomt aneolt) 2uoirpiy1llenlfesls) Drruro;u0aeeniociadlm umumpnu4tetnif3ootlpte i o s  rto(mpny4ap e ietl()a2trum oo4aeen fctyslmDrlump;t0texoirciadop eaues (0 rxm(o3io1lm nlfesls)s2taxront0apeoii3tldlaDem( ont) etrmr3iytfm  lnesls s2uoio nodapenlnesls  rtm(  ot4oeeo ictat a2el( s;()tetnmrctydfptrauvs;s0sexr(rpoo1llte icils)a2uaxrpnu4tlxnif3ias m2umump u4alerxo3oy1la r neils  eto(mpiy4ll elfvtl( a2trx  oo0tex mictydlmDea( o;(4tlxoir3ia1faDelueo;s0t2xoimpiu4apt mnvtat  rra(moot1ole ii3iyd s2eanmonu0alenmf3ta1lpDean i s0srxo(rpio4al  licslt) rta(  ou0olxn oetydlaDel(mp u4 eerxf iadfpD aieo;t srtm(opiu4llenmnetas)a2ra(  ;o0aexnmfciaslsDranmonu0artoxo io1lmteli o;s0tetoirpnudopenmnvtl()aDrmurp;t4texn ictltfa2em( p t0teenxf oy1lpt ln o;(0srumio nu4amtnmnvtltf Dtrumo;o4apx iiciydlsDeau pn(4arxnxrcta1fmt li s s)setoio io1lltnmfctltfartr(m ;o0aet mfctasfm2emn pn() ltoifctadomDe ivil( trtoir3iu1amee fvt tfsDumx  nu1aeeoifciytfaDea(mo;t4texriocta1lm eli sls)tetrxr nodam nmfeslt  Drmxm nt0alenio3ilsla2em(mo u) lxnxr iydoatraivslt0s2xr(m nodlm n fvsls)aDtmxrpot1tlxnmoeiatla rmu p u) exnio oo1latr i s ( texr(m oudapenmfvsls)srtm(r ;t1aex ifciys aDrauvsnt4tltrmo iodlmtr n s;s)t2umirpiu1lle  iesl( srrr(mp;u4tee miciydfa ean snt0 eeomrciatfptelivs;(0t2to(r iy4ap elieias  2ua(m ;t1openmfciadfmDumumo t4 lxomr3oodomD  ivi s s2umirpnydoptn ict s  2umur ot1oetn f3iytlm2em(vp;()aeeomf iy1fpDranvilt0trtmxr3iodapeelivia()arraxrp;t0aetomf3tlsfa eau o u)tetomo3tytom eliei;s0srto(mpno4lp nlivsat a2trxm ;u4oetomiciltlaDranmo (0 reom
\ No newline at end of file
@@ -0,0 +1 @@
+iei;()srtmxr3ny4ll   neilt) rumxm ;t0olx iiciltfsDemn p;u4 lxniocoydlpteaueo;s sexm(o3ny1opt mictlsfarrr(  ou0tet mo3iysfmDrluvsn(0tlxoio3oo1late uvi;s)srxrxo3oy1lp  mnesa(f rraxm nu1aex ioctad sDumnvpn(0altrif3oytom ean i t0texm(mpoo4al  lfvt tfsDuaxmonu4tle mo3ildfsDumu p;(4aexrxocoy1la elueo;t0setrirpoudopeelfcsas)sDtm(moou4texoioctltlsDra( snt0 etoxoctytfm   u s s0setoxrpiudolt lnvi (f 2raur ;u0tpxn ociatfs umn onu) rtrmrcoatfa   uvil(  rxoxrpiydlme mnvs ( s2trumo;t4opto o3tatls2raumpn() rtnmoctatfmte ivols0s2tr(opno1ome licsls) rum( onu0tetoiicils mDrmuvpn(4alxnxr oadoaDr nei;s  eum(m3iudaptemfvs t)a2ta( poo1ope if3tltfa2emump;t4trtnmfciydla e u o t tetoxmpiudamtn nvt tf Dtrurpno4texomfciydfa rm(mpn(0altnio3oy1fptr ueo (0seto(r iodllee fcsasf Dtmxmooo1ope  ociytlm uluvp u0alxoir iytfm eau s () 2xmim io4op nlnei s)a2tax  oo0ole  iciyt aDran p;u4 reoxo iadlmte nei;(0s2xmir3ny1optnlnvia(fsrum( pot4oetn o3tytla ua(msnt0 lerxo oatla eaivi t teum(o iodllee nvt ()sDrr(mpno4tpe  ieiyd sDel(ms;(4 rxnif totfm  livs (0 ruoio iu4lm e nctl()srtmur nt4aeenioctaslsDel(mp;()teerifcoa1fat ai slt)teurir3io4lltelfci s arua(ro;t1oee  f3ils s2eaums t0 exomo ty1fm rai ols0 rxoxo oodolenlicils  2umxrono4opeomf3iytla uaump;u0tltnmf iatoat auei;t0seuoxm oo4omtemfetlt) 2rrxm oo0apx iicildfa uanvs u4trxnxo iytfa  liei t srtm(m ny1ole  nvslt  2tr(rp;t4aeeniieiytlmDemnvsn()arxnmo3oo1fmt  ivs (0t2to(opiydoptelnes s a2ua(rpoo4apeomiciltfs2rl(vo u0artomf3ia1fmt an ol(  euo(mpiodlpen fvt tf Drr(monu1opt  ietas m uauvp;t4tltoxr3oytfmD luvsls0 2uoxmpiu4ap emiet (f 2ur(m ;u1oex iiciasla2rl( o (0aetnmo totlatrluvs;t0seumiopny4ll nmivs (fa2raumoot1tltomfctyt a rmuvs t4 lermfcio1fpteauvils  eum(o oudalt  ivsa(f Dumu  ;t1opx ioeildlaDrm(mo;(4aleomfcoadoa elnvolt srtr(r3iydalenmnes s)a2tr(moot1oeeomo3iadls ua( p;t4arenmr3ootoaDeaneols) 2uoir3io1ap  mfci t)arraurp;u0oltoiociadfsDrl(vp u)aetomr iodop elues s  rto(mpou4optelnvsl()sruauronu1alxn ietysfa umums t0aleniocoa1opte uvi (0 etr(r nodam   nvi t sruau p;o1tpe moeiatfa ua(mpnu0tlxriocoytfm rlueil( t2tmio no1amtelfvs tf 2ua(root1oltomieiytfa2uanmo;()teeoir3oydoatrlnvols0srumio oodome mnvsl()srra( ono4tleoioeiydlsDua(mpnu)tlxnif3iotoaDeai s s0s2tmirpoy1llen nci s s2tm(m ;o4apxo feiydlm2em(mo;(4arerxo3io1laDr ivilt srtrim3ny1opt mfvi t  2rru o;u0oexnifctyslm ranms (4tltnio tatomDrluvs;t  euoxopnodlltnmiesa( aDtaur ;t0aeto i3iadls ranvsn(4 rtrxf3todfmDranvo;s0trurxrpnu4om nlfctls a2umum nt1alx if3iyd mDrmn pnt) reoxr3oodop   iei s0 etm(mpiydol e iesls) 2taur ot4optn ieiyt m um(ms;(0alxnmfciy1om  luvs;s0s2umxopny1lpeemictasf Dtr(ro;u4oetniociytfs rmnms ()aexrmf3iy1lpDrln olt  rxmxm ou1lmtelfcsls)s2rmx poo4ape  icils s2eln s;u4tlerifcio1om raneilt) 2trxm3oo1aptnmnvsas  Dtaumo;u1ole  fciytls umn p u0tlxnmo oo1fmt an o;s0 exmirpio1lmtnlnes t)sDtrxmpoo1oet mfcias mDumu pn(0 renmf3tadfm e n olt teum(mpoydol nmnei (fsDua( ooo1oeenmieiat m rauvsnu4aleomrciytlatelies s)srumxr3nydop  mivt (f rurumpot1tex iieiytfaDuan onu)arxrir3iotfp eauei;t setoir3no4ame mivias  rtrx  ;t0optoifctlslsDeanvsnu0 leoir tydfa  lu o;s0teto(r3iy4ome  fei t sDtaxront4alx ioeiytlsDuanvs t4aeerir3tatopDe nes () rxm(m nodlpt lict t) rta(mo;o1opxomieiltls2emnvs;u0 lxoxo iy1fmD  i o;( trxriopio4ap nmnctat srrrxmoot0tlt iieiasls2rluvpn(4 rxrxr3oy1lpD li o;(0srumimpio4lleemfcs ()a2trxr ;o4oltn o3ilt mDrmnmsnu0 lxnmf3ty1om  lueolt)sexmim nu4omeelfetl() rrrump;u0alxomfetld m2ran pnt4alerirciy1lptrlneol( trxmir iu1am  livtl() 2urxro;t1aetn ieiyslaDuluvo;t0tltnircoodfat aueo;()srum(mpiy4op  licias  Drmxroou4oeeoif3tltfs2rmn o;()trxomf iydla rlnvil( sexoiopoy4optn nvtlsfa2rrurpou4texomf3ias s uanvo;() ltnifcty1fp  luei ( setmimpiu1optnlfvilt  Drmxront0tle moetltlaDua(vo u)arxnif3ia1omDrlneils0texoiopou1amtemfvtl(f 2rr( pot4aee ii3tasfm2rauvo;u4 rxoxf oatomte nvils t2uoim ou4amee fvsas)artaum nt4apt  o3ilsfaDeauvonu4aleoxocty1lmD aueo;( srxr(m3ny4lptnlnetl(fsDra( ooo1aetnif3iltfmDem(vp t)artomr io1laDelu i;()texmim3no4ope  ies ( srra( o;t4apeomieiyslmDean on()aexomf3tydlm eluesl(  rumir oudameemnesas s2rmxmp;u0open ictytfa2emnmp;(0texoio ty1fa eln i t  rxmxo oo1op n neil() 2tmu p;u4oleomfeiydfsDeanmo;(0tlerxf oy1optr nvo (0sexo(r3nydlpe  icsltf 2rrxronu1olxoifcildfmDra(mo;(0 ltrxr iy1fa e i i;(0s2urxmpnu4apte ictlsfs2rr(rono1tpt iieildls emnvon(0tltrmrciy1la e iei (0 2urirpou1olenlicsls s2rmu pnu1tetnif3ilsfa eanvpnt)teenmfcoo1fmDrau o;s)t2xmxm no1al  lietat s2rm( onu1apx  ieiydls rlnmo u)tlenmocty1opDelivi;s0seur(o3oodlle mfvs s  2raxr no1olx iictadla uanvs;() ltomrciadfmte u o (0s2xoxrpoo1apeemnvs s  2taxmp;t4apeoifctydlm2ea(vs;u4 rxomr ia1fp  auvols) etrxm ny4optnmnvsa() rtr(rono1ale miciytfm ulump;u0tlerxfctatoptrai il()s2umxmpnu4ole mivt t  2rax poo4tptomfetas aDuanvp (4 ltnxf oo1oaDr iei;(0trxmxo3iudom eliet (  Dumum oo0tet  i3iad s ranvp u0arxnmrctydfm e neolt0seuo(rpou1om elfci ( sDua(moot0olt moctydls2uluvp;u)alerxfcootlm   u o;t srtoirpou1lptn nci s sDua( o;o0tlt  f3iysfsDul(ms;t) eeomocoodlp  lnvi s s2toxo iudalee fvia( srumu  ;u0ope mfeiydla eauvo;t4trxrir iy1fmD  u s s  rxo(r oy1lpenmnesl(f Dra(ro;o0tptnii3ilt s2emuvp;t)texnmf3todfmtr ues (0 rto(rpiydal elncilt)sruaxr nt4tlx if3iadfm2ranmo;u0 rermf3oatlmDeaivslt) exmxmpoo1olenmnvi (fa2raxr ;o0apxnii3iasfs2uanvonu)aetrircoatom   ivo s)t2trxr3no4ol emfesl()s2rmxr ;t4tpxnmoctltfaDrmumont0 ltoio tatlmD  neolt  2uoxmpiu1lmeelicsat a2taum ;t4tltniocild s2ra( o;u0 rtnxocoo1fat lnvolt)texo(opno4ol eliei t)aDrmx oou1tlx  feiyt s umu p t0 exomo ta1fmDrlivi (0 rtr(m3io4al n netlsf 2tm(rpoo1apen fctyd aDua(vpnu4 eerxrctodom rluvsls) 2tmim3nu1opee nesl()s2ra(rpnu4tlxoii3tldfsDrl( p u0artnif oy1laDeauvo (0srumxm ny1al  mivs ( arrrxm oo1oexnmi3iasfs2umu o (4trxrifcootlpDrau ols0tetoir oy4ap nlnct s  rtau pnt4olxoiictydfa um(vp u)artnxfcoadom  auei;( s2xoxmpiy1oltnlivtlsf 2tr(r ;t4opto fctat m2rm(mp;t4 rxrxo io1om  au il( seur(rpou1ape  iet sfa2rr( pot4optn ictltfmDumums;t4tltnio3oadop eaneo;()srxr(r io1alt lnetls)srrmurpnu1olt  icils m2rl(vp;u0artrif3oadomt an sls  rto(opny4lmeelneslt)arrm( o;u1apxomieildfaDrm(vsnu4 rxnio oa1lptelnvils0t2toxo io4lptnmicta()arrrump;t1optomo3ilslsDra( o t0tlenmo3iodoateaiei;()sexm(m3iu1lme  icsatfa2tmxm ou4aetoifctaslsDra(msnt) rtrmoctadfateln o;s)trxr(o3io4amen nctltfsDumu  nu4apxoioetysfsDra( sn(4teenirciatlm elu o t s2tmiopiy4ap nmicta(fsDta( o;u4alenii3iasls2uln o;t0tlxoir3iatfmDe n ils  exmxmpoudlpeelict ( s2ur( pno1opeomo3ildla2elnmo t0trtriociotlpDr n sls0teurir iu4lmtnlivils)sDtmu  oo4oee moeiysfs2umumon(4 rtrmo3todfp  lues;( s2trxo io4lltn nciatfaDuaxmont4tptniictas m2rluvsnt4trtnxo iy1lmDeaivo s)trxrxmpoo1ame  nctl(fa2ur(ro;u0alxn i3tadlm2rmump;u)tltrmf iy1fatr uvo;t)t2um(m io4lm  mnetat srum(mpot4alx  o3ils a2rl( s t4 rxnxocoadoaD  uvi;( trurio3oy1ape mivtls)arrm( pot1tlx ioetysla rmumo;(4aexoioctydlateanes;t  exrimpno1ol e ict (  Drru onu1oleoiictytlm um( s (0aetoxociadom rli o;t0srtoir io4olenlfcs ()sDtm(  no0tpenmfciasfm rmnmo ()teermr3iy1fa rauei t0 ruo(o nudom   ncils) rrm(r ot1tptoiieiydlm rmuvpnu0tetrxoctytoa eanvs;()seurir iy1llte icsas) Dtrx pno4tpen iciadfm2uanvp (4tleomo3tatfate neolt) rtrimpno4am e fet ( arrm(ro;t4tpxnioeiytls2eluvp u0 etnxo iotop   nvs () 2toir3nydlltn nvsa( aDtmurpoo4tpenmoetatfm emu o;u4 rtrio3tadom r iei t0 eumio3ny1amen iesa(farrrxrpou4oetomo3iyt aDuaums;t)alenir3oydopDrauvol()trxmxm3oy1openmnvt t a2urxrpno4aptnifctadlaDrln p;u0 eenir3iodoaDelnvsl(  rtrxr3nydlptnlicil(fsrrau ont4tltnif3iasls rau p;t0aeerxo iy1oa  aieo;()s2trimpny1lltnlivi (  Dtrumpot4altnmociltfm ea(ms u4 rtnio3oytfa r ivsls srur(rpny1lp emics sf Dtrxm oo0tltnmo3ias s2rmums (0trxnmo3iodla ranvilt  rtr(rpno1lleelfetas)srrrxront4oeeo oeiyslsDrl(mo;u4 exnircio1oa  aies;s)srtr(r3oydlleemfeil( srrax o;t0alxoifciltfaDem(mpnu4tetomo3to1oaD anes (0srum(m3no4aptnlnvs t srtmxmp;t0tle  fcildlaDemnms u0tlxomo3tydfpt luvi;t srxmxo3no4lmtnmfeia()aDtmx poo4aptnio3iys a2rm( snt)areoxf iotlmDrli s;()t2xr(o oodllte ivsatfa2rau oot4texo ictysfm2em( sn() leoxf3oatop elnei;t)srtmio3oodlmtnlivilt  Drmxrpnu0apx mociltls2ul(ms t0treoiocia1fmt lieo;t t2tmxm3iu4aptnlivtl() ruaurpot0olenmieiydlaDrln s u4aetnxr3tatlatrlu s;s0tetm(o3iy4al nlivt s)sDtau p;t4aetnmfctldfs2umuvp;u) rxrmfciodlpDranvs;(0t2uoir nu4lpee ieta( aDum(  ;o0oex  octyt s2ulu o;() lxnxr oadoaD  uvols)sexoxrpoo4am  lfct s)s2tmum oo1teenmociyt m ul( snu)tetomrciotopDe ivi;s seum(r3io1ol nmicilt)aDrax ono4tetniociysfaDemnmpn(4 rxrio tadlpt  ues () rxm(m oo4lme  iet sf 2umx oot4aleomi3tatfmDul(mp u0tlerxfcty1lpDranvs;( s2tmir io4lm  lfct ( s2tax pnt0opt  f3tld s elnvpnt) etomrcoydopDrln s s) eumxr3oydapt lfctl() rrr( p;t0open f3ildlmDem(monu4tlxrxrctytomt ai o (0s2uriopoydole mfeil(farrrurp;o4ape  ieild m2uluvo;(0aexrxf iytlmDr neslt0s2um(m ou4aptn fctls)sDua(mp;u4teeo ictytfaDeau p (0 rxrio tydlpDraueo;t teumxo3iudomtnmnei s  rrrxmo;o4apxomieiydls um( pn(4aeenxr oadopDraies;t) rtoxm3nydllt  feia(fa2umxmp;o4tlx  f3iltfs2emump;(4teerxf ia1lat ai s t0seurio oudap emfvtls)arrmu  ot0tlxnmfctltlaDrlu o;u)tltnmfctytomt anvils  euo(m iodlltnlivias)aDtru onu0alxo f3iasfs ul(vs u4arenio oa1fatraivs t0 rtrxm ny4altelfvia(fs2trx onu0aet ifctldfs2rl( o (4altnio3ta1opteli slt  rtoirpou1al n ncsat arrrur ;t1ole  fetatlm rl(ms;(0tltnmr3tytfpDr iei s) 2umiopoudoptnlnvt sfaDua(  no0alenmoeiatfa2rlu p () renxf totla  aivil()s2xoxm3io4omtnmiei sfa2rr(rpnt4opxniietlslmDemums u4 etnmr3oodfmt lies;s)s2uoim nodopt mfet tf 2umumooo4alt  o3tyd aDeaumsn()aexnio3iadfm  lies t) etoxo iudlltnlivils)sDur(mont4tpxo i3iys a2rau p;u4 ltrir3oatom rlivs t trtr(m oydlme lnetls)arrm(mpnu1oex moctltls2eaumo t)tleoxf3iadlatrlivi ()s2to(rpno1amenlfet sfaDumumonu4tpt ifeiltfsDranmo (4tltoxo3tatfat  ues t)srxm(r3no1aptnmnet () Drmur no4alx mf3ilt m uanvsnt0altoio iy1faDe ivsls0sexoirpnu4ameemics s)arumxrooo1tlxo f3iltfaDuanmsn(4aexnmf3tytfm   i i;t srxrir3iu4al  mivsl( artmumpoo0alenifeilslaDem(monu4tetnmf oy1om ranvs s  rurir no4om  mfci tfs2rr(ro;u0oeeoii3iltlm ra(vs t0arxoxocto1op rlu ilt teurio iudop elnctas  2rrxront1aeeomo3iyslaDelu s t4aetoxr3oo1latr u ilt setrxo3iy1lpen fvsls)srrmum ;o0alt io3tydls2emnvs () rxoxr3ia1omDelnes (0 etr(o3nu4aleemnvtltf Dumxmooo0teeo ieiydfm ul(mpn(0tltoxr oo1oa   iei;t tetrio3iu4apt  ieiat a2raurp;t0tltniieiadfa el( o ()tetriocoy1fm e nvi;(0 2xrirpiydop emnvtat sDrm(rp;o4aleomo3iysfs uauvo u) eermr oy1laDeln s;t)texrio3iy4ape mfesasf Dtrx oou4olt if3tld m2ulnvs;()aleomo oydfmtr uvi s srtmxo3no4omeelncia(f 2rmxmpou4tpeniictldls ean snt4trxoxociydom elneolt0teumxmpou4opeelfeia()s2trum ;o0oleo oetysls2uln pnu)alxnxo iodlm rluei;(  eto(opoy1alenlfvsasfa2tr(r ot0texomfcilsfa ulumonu)trtnif iadoa  lnvil()trum(r nu4lp n fcs s)sDtrump;o0olx  ociasls2elnvo (0tlenxr to1fmte ueo (0 rtmio oodaltelict s aDururo;o0aptniociytla uan s u) eeoxfciotlmtr u ols0setoir3nu4lle livias aDtrx ooo0texoioetld m2eanmpnu4 etnio iatfp  au o;t0srtm(m3oo1am  lietlt)s2tmur ou1oee moetltfaDul( pnt4tlenxfcio1oat  uvo;s0sruoiopou4omenlfvtlt srumu o;o1alt miciydlm2rmu pnu0aetnir3to1omDe n ilt0teumim nu4ol nmivs (  Dtaxrpnu0tet mieiytfs2el( s;(4trxoxfcoodlmteluvol() etrio iy4olee ics s s2tmur ot0aeen fetatfsDelnvp ()tetnircoatfm  lueslt0srtrxr nydlmeemfes ( srraum no0alto fciyd mDul(ms;t) eenir tydom  au s s)s2tmxopiy4ap  lfvtls)sDumxm nt0ope mi3tldfaDumnvs u0trerxocta1opteanvo;s  rurir3oudap nmictasfa2urur ;u4aptn f3iasla rmnms () ltoif3todfatrlnvols0s2uoim ny1apenlicsl() rua( pnu4alxnioctat m rlumon(4teenir iadlate uvol() 2uo(r oy1amee ictat) rta(mpno0opeomieiaslm2uau s ()trtnir3iodlp raivo;( srxm(m oo4alt  nvsltfs2rmu  ;t1olenifeiasfaDra(vs;t0aetoxociydfp   nvi t0texr(m3oudop emiei t sDtmxrooo1tpx micilsls2emu p;u)artnmf ta1lat lueo ()sexrxmpny4lpt miei sfsDrru pnt0tlxomi3tas s uluvs;t4altrmr3oy1faDrln ils)setoxmpnu1ll n nvil(fa2tr(m ot0oee mocils s emn s t)teenxr iodlpteluesl(  exmxr iu4ale mfctatf rur(  oo0tex  ociydfa rm( o;t4arerio3todlatelnvsls0seum(r nydam emfctl()a2trxmpoo1apx  f3ilsla rmnmsn(0artnif3todfm raneo;t  2umio3oudlmtnlici sfa2rmuroou4oetnmfeilslsDrmnvs;u) etrir io1lpD  uvi;s) exmio3iy4am nmnesat)sDumxmooo0alt  f3iat s2ranvpn(4texnxo tytfmteauvi;t0truo(r3nydll n nvtat s2rrum ;t4teeomiciydfa em( s;t)trxnmf ta1la r nvi;(0 2toxr nu4olte ivtlt)sDuaxmp;o0ope  octlsfm rl(mpnu) renif oy1fm ranvsls0teur(mpnydole lfciatfsrtru pno0tlxnifeias a elumpnu0tlxoir ootopDrai o;t setoim3iodlpenlfeslsf Duaxmoou4tpx io3iasfm2uauvp;u4 ltriociydlaDe nei;( seuoio oy1lltnmfcta( sruaur oo0tpx mieiltls2uaums;(0aetnir tytop ran sls)t2toxm3ny4ll  mivia()arraum ou1aexoiieiat m emnvp (0tleoxf iodlpDelnesl() 2tr(opiodom   ivtat) Dta(mooo1olxoiicildlm rm(vp;(0tetoifcoydfat li o t t2xrxr3oy4ape mfesa(  Dtrum no1opxn i3iadlsDranmp u0treoirciy1lpteai o ()s2umirpnodam emfvil(f Drm( pnt0tpeoio3ilsfa rmu p;() exnxr3todlm eanvo;t)s2urirpnudome  fvi ()s2rau o;t1aet  ieiytfm umnmp;t4tlermocoa1fatrln o;s) 2trxmpoy1opee nci s)a2ur( ooo1alen oeiadlm rluvo u0texnxr3iytopt  uei;() eto(m nu1lltnmncta(farumu pot4oet  ieiat aDrm(mpnu) leoio tydfp eanvsls  exo(mpoo1amtemfcs tfsrtm(monu4opxnmoctatfaDul(monu) ltnif3ta1fat aivi;(0 2umiopoudomeelfvslt) Duaxrpnu4aetnif3ilsla2ra( snt0 rtnmo todopte u o (0 rxmir3nu1aptn iei t)sDra( pno0oeenmfeild mDrm(vo;(0 lxnio3iadoaD  ieil()texo(m no1olt  fcta() rurxrpnu4tpxniieiyd a eluvp;(0texnif io1oat  ues (  rumxo3iu1omeelnvslt artmxmp;u1ope iietyt a2uauvsn(0treoir3oy1latr ivo () etm(mpoo4ap n ncia( srtm(ront1tltnmfeilslmDra(msnu0 rtnio3oo1la  aivs;s)trtm(m oy4am n ncta()s2uau p;o4aeto i3ildfm elnms;t0tlxnmfctadfm   u o t0 exrio ny1olee fviat aDtmxroot1texoiieilt m2emn ont0aetnxrcoa1oa ranes;()t2um(m no4lmt  fvsat)a2umxr oo4texomi3iysfa2umump () leoircoatfptelueo t0 2xrxr nodale mnctl()sDraxr ;t0aee  ictydfm ea( ont0 rtomr3iy1fmtrauvs (  eurxm oo1op   fvilsfaDrmxmoou4aexo f3iys m elums u0 rxomo3iotlm elnei;s0s2xr(m oy1lm emicsas)a2rrxr ;u0aex mietlsfsDul(vp u0 rxrifcty1la r ueolt t2um(m io4oleelfeil( artaurpot1oeto ictydlm rauvsnt0aexrxf3iodfate uvi;(  2urir nydole  fct (fa2urxmp;o0tlt mo3ias sDuanvs t0teeoxf3tydomD  u i t trxoim oy4ol  mnvtls sDrmxmp;o1teen ociltfs2ul(vs;()arermr totoat  ueo;s t2toxr oo1lle  nci (fsrtmx poo0tpe mf3iyd m2rau ont0artrmf iydfmD  ueols0s2xoxr3oy1ll emiet tf rra( pnt4oex ioeiadls em(vpnt4artomf3oadfaDr nvo s) etmirpiu1oltnliesa( s2ur(rooo4tpxomfeiadls2elnms;(0 ltoxfctadop e n s;t  rtm(m3nydlle mfcsas aDrmxrp;u4open iciltfs ulu snu4 eerif3ty1fa  aues t) eur(m no1ll e ncsa()arrrxr ;t4tlx  ociatfm uauvpnt0 rtrxoctadlpDrluvo t0texoxmpnu1ame  fvsa(farrax p;o4oeeomictydla el(mpn()artnif tytfp   uvo;s)srum(m3oydam   fetltfsDraxm no4tee  i3iysla2eauvs;t0aleoif ty1lm eai sls)seto(o no1omtemfesa(fsrra( ont4olenio3iysls2rmnvo;t4arxomr iy1opt lies;t) 2xoxmpny4lptelivi () rrm(rpot0texnmoctys sDrauvpnt0trtnio3oy1lpteauvilt0t2uoxrpnodaptemfes t  rtruroot0aexo o3iydfmDum(mon(0altnifcoodop eln ils)truoxrpoo4aptnlics tf 2ua(  ;o0texn f3tatfm2ua(mo;u)teerxrciytfa ranvo t0t2toirpoy1lpt lncsa( s2uru ooo4teeo octadfsDemnmo;t)trtrmo totfmD au i s trxrim3ou4lltnlietas)s2rmx pnt1oeeo oetlslaDrlnvo (0alxrxr oatop elnvs t) etmim io4lpenlictlsfsrum(mpno4opxoiociydlsDelumsnt0 leoxr tatlmt aues;t  eurxr nu1lp nlfvs () 2uaxm ot4olxn fetadlsDuan p;(0altomr iatfatelies;()setr(r3no4lp nlfvtltf 2ua(  no4alenmicildfsDem(vs t)teeoirciytlmte u s;s trur(o3nydlpeelivt s)sDrr(ro;o0olxnmfeiyt a2rl(vpnt0 ltoxrcto1laDeaneilt srxmxm iu1aptnmietlt  2tauro;u4tpxoiocils a umnvo;t4 rtoio3oodlp eluesls)s2urirpiodolenmfvsls) 2uaxmpno1tex ifciasls2elnms;() exrmo iadlptrli s;(  2to(mpiu4ope  nvtasfarrrxro;u0aeeoifciytfa emn s t0 exrmo3oy1fatelu i;t0 rxmxr oydomtnlfcil() Drmxr ot0openiieiadfaDulump t0 lenircty1fpDean il(0t2xo(o nu1lpt lfvi ()srtrur nt4aeto oetldla rmuvont)trxnxr ty1fpteanvo s)srtm(m ny1lmenmivslt)s2um(mooo0olt ioeiydls ul(vp;(4 leoir oa1lmtelu s;t) 2um(rpiy1am nlfctlt) 2tmum nt1aetoioeiys mDuanmp t)teeoxo3oatlptelu i;t)t2tr(m3io1omtemietlt sDraxront1aptn f3iyd s2rln o;t)texoifctytfpt aivi t0s2ur(r3oodaltn ncilt  2ra(m oo4aex  feils m uln o;(4 leomr tadopD  nvo;()setoxm no4llt mfei ( aDurxm ;u0tex  oeiasfmDrlu p t)tetnif oatfmDeai ilt srtoxr oo4lm nmieslt  Dtaxmont0aeeomf3iasla2elu pn(0trxrmr ty1lmDe u ils texo(m oy1apte ncs s) rur( onu0teenmfcildfs umn onu4aexnxo io1fm  aneo t0s2to(r nodopt lfei sf rum(r nu0olt mf3iatla2emu o;u) rxriocty1om ranvo;() rto(rpiy4lpe mncsa( sDtmxr ;u1texo octat m ul( s;t0alerio3oa1lpDeanvo;( seur(o iy4am   fesls) Dumxrp;t0teen ieildla2umu p t)alerif3iadfmDrauvslt0 rtmxmpou1omeemivta(faDtmx o;o1tpxomf3iydlmDulu p;(4aleomf3oadomtrlueo;(0s2um(r iodop  lfeil()aDrmu ont0tlxn i3iyslm2rlnmonu4areoxo tadoaDe ivi;t0 rur(m3oodopenmncia(fa2truro;t1tptnmoctaslm2elumo;() lxrir iytomtraneols t2uoir3iydlmte ietltf rrr(root0oltoio3iadla2raumon(0 rxrxr totfmt lieo s0srum(o no1olenlfci ()aruax pno4tetn ieiytlmDeluvsn() ltrmr tadlpteluvi ( sexm(o nodlpt lnviltf 2rm( pno0apeo i3tls s2ea( ont4alenxf oatfp rluvo;t  2to(o3oy4am elnctas) 2urxmp;t1altoif3iasfs rm( o t4tetnmrcoatomDe uei t0t2xo(rpoudopee fesls sDtmump;t0tex ifeiad mDem(monu)artnio3io1lpDranvs t)s2trxopoudllenlncslt srrr(rpnu1tptn i3tlt a2ua( s;(4 ltrxo3oa1fm r u o s)srxoim nodamee ivtl()a2uru  ;t0olx mo3tyt s rm( sn(4areomo3oatlaDeauvo ()srxm(m ou4lmeemfet ( aDtaum no0tlxo feiydfsDrln ont0tltnmf3oytlp ran s (0texoxm3iydom  livs () rurxmpnu1tlx ifeiatlaDrmnvp t0 ltoxf oo1faD li o (0trtrio oy1ape lnvslt sDraur nu4alx mo3tatfa2emu pnt0tltomrctotomDran i;t  2xoxm3iydlmt mnct sfsrumx pnt1tlx mf3tysls2rl(msnt4trxoxociatomtrlivil() 2triopny4ope lnvi s)arra(mo;o4aeeomo3iasfaDel( o;(0aetnifctytlpDr ues;t0 euoimpoo1al emiesat) Durxmooo4tlxo ietlt m emnmpn(4 ltomr iotomtr i s;( s2tmirpoy1oleemieilt)arraxronu4oee mieiadlsDelu p u) eeoif3todlmD lnvi s0t2urim3io4alenlfcsa(fa2rmx  ot1apxn fciltlm rauvp u4texnxocoytfmtelivi ( srxoimpiy1omeelfcia()sDrau pnt1tlenmieiyt s2em( pn(4 eermfciytla rluvo (0t2xrxrpio4ame  nvt (fsDtmx o;o1aet moetat a2ran o;u4 ltoio iydla   ueo;s s2tmiopoy1oltelivsl(fs2tr(rpoo4olto fciyd m ranmpnt4 renxrctydlm  au ol() etmirpiy1aleelictl(  2ua( p;u4apxnioetydls2rmump t4 leoir ta1fmte nvo;s0 2xo(mpoo4amtemfviasfaDum(ro;t4apx ioeiad sDum(vs;t) leoir3tydfpDrlues;t)trxoxrpoodlpeelfet s srtrum ;o1olxnmoctlsfs umn onu)aetnmf oatom e ueols)t2xrxrpoy1olee ivias) 2ur(r nt4tptn i3tatfa rmn p;()trtoxo3ia1op e nvols tetoxmpiu4ll nlneiasfs2ua(r ;t1oeen oeiys a2eau o ()altrmr iytomD an sl(  rtoxmpnu4altelicilt)srrm(  ot1tpx io3iatlmDrm( s u4tltrio oa1fatrau ol()sexr(o3io4lmenmivslt  rtaxr ;t0oeeoioeilt s2um(mp;(4trxnir iatfmtranesls)srum(o3nu1olte nvt ( artau pot1apx  o3tad aDua( sn(4 lenmf3oy1fpDeaneo;()srur(o iu1lp  mfet sf Drr(r no1aet mfciydfm2umu snu0artoir oydlpDeaivil() 2xmio iu4omt mfetls) 2uax  nu1oetn i3tldfs2umnvs t4tlermf oadlpD  n o s seto(rpiy4lpte neilt)aDtaurpno1opeoiiciadfmDemnvo u)tltnif3iatomt luesl()trur(m3io4ole mfvta()a2taxr ou1texnifeiyt m em(mo u0tlermfciy1op r nei s0setmxo3iy4lpee ieias  Dumxmo;o4tpxn ieiys mDumnvo t0aexrxo3iadfatr u o s) etm(mpoodam  mict s)aruau  ;u4tltomoeiytlaDrmuvonu4 rxoxo iadomDranvi;s srxmimpiu1lle lfciatfarta(mooo1oet mfetlt s umu s;u) rxnmo iadfa eli sl(0srtrim ou1lltnmicia(fa2tmum ou1tle iociltfs uln o t0teerxr tadop raies;( s2ur(rpiy4ope lnctl(fsDur(rono0tltn i3taslm2rl( on()artnifctodfa rlnvilt0sexoxr3oy4lp  lnctatf Drax  ;o1tpt io3tlsls2umnvo t0tltnxo3ootoa   nei s0s2tmxrpoudop  mfcsatfartmurpno1altomictydlm2ua( s u0tetrmr3iy1lpteln o s0srxoxr nu1oltelicilt)sDtrur ;u1opx ifeiadlm2raums u)aetomr3ia1faD li s s) 2um(rpiydll n ncil() Dtmxmont1aetnioeiysfm emnvsnt0tetoxf3oo1fmD auei s0teuoim3iu4op  lfcs sf rtmx  nu4olto ietys a2ranvsn(4 rtnxr3oa1opt livol( t2xrxo io1ap nlivia()sDtr( ooo4aeen fctldlaDuanms (4tlerir3ootopDeliei t  2urimpio4ap  lnvils  Dtrxmpoo1oee ioeilt m2ulu s ()teenxf oydoat  i ilt0t2to(rpnu4op  mfes sf Dtm(ro;o4oleoioctatfmDea( p u)teerxrctadfpteli o t texr(mpou4llenlicils)sDumu  ou0tpxnmoeiydfa rm( o;t)alxnxr to1fmteluvs;s0trxoim3oy1apee fvt (f Dtmur ot4oltomfetls aDeln o;(0aleoif oo1om r i o s) 2trxm3oy4al n ieilsf 2umx ont1tet  octaslm2em(monu0 eermo3iytla  lieo t) 2xmxmpoudome lfctas)sruaxm ;u0tle iieildfa rm(vsnu0texrxf oadomD  ivi;()setrxo3nudapeelneia( a2umu pno4ale  o3tytla2ean s u)arxoxr3oodlp  aueo s setr(opiudalenmncsl(f 2umur ;u1aeeoifctltls uanvsnu0 rtnxo3ia1om  livs t  eumxmpnodom  lfvtas  Drau  oo0opxnmociyslm elnmo () rxnmrciytfmtelieo (0tetrirpoo4lptnmnvsatfs2ra(  nu4tee ioeiasla2ulnmo t0 ltrmrcoy1lpDrln s s  2xr(opoydlptelnctls srraurp;t4tpenmf3ilt a ranvo u)trtrxr3tatlmt  ieo t)srtrxrpoodap e fvta( a2rr( poo0alxnif3iasfm2eaumo;u0tetnmr tydlptr u s s)srumimpiy1opeelfvs t artrxr ou0opt ii3tlsfsDum(mo;() etrir3todla elu o t0srurxo io4llt  ivta(fa2raurp;u1tpxnioctyt sDul(mon() renxf totlmD au o s) etmxopoo1olt lfeia(fs2ua( p;u4aex  fciadls2rmn o (4 rtrif oadfaDr ies t0srtmir3iydal elicsl(  rumum ;t4aetnmieiltlmDeanmo;(4tlerxr totlmtrluvolt s2xo(m3nodole lici (fsrua(rp;o1opt  fciat m2uan p (0teenxf oodopD  nvsl(0trumim3oo1opeelieils) rtau p;o4opxomiciydfa2uluvont)tlenxf iotoptean s;t)s2xmxopnu4am nlnvsasf Drrx o;o1texoif3tas sDrmu o u4 lenif oydlm  au slt0seuriopoy4olee fvil()arrauronu4opx mietysfaDrmuvs;t4 rxnmrcoodop r iesls)teumio3nydomenlfesa()sDta(root4alx  o3tydlm2rl( s u)tleoio3tadlp  auvil(0trxrxmpiy1lleelnvias)s2urxr ou0altnmo3iadlm2elumpnu0aetoxf3iytla elnes;t0 exriopiu1op n iesa( aDuau pou1oet iiciyd s rln pnt0 eerircoodop rauvol( t2tr(r oo4lpte iet s arrmu  ;t1olto fetadlaDeln s t)tlxoir tytlatelneols0t2tm(o3iydolt lnetas)srtrx p;o0tltnmoetysfaDul( pnt) leomrcoo1lpte nvi;t0 rxmxr nu4opee netlt  rrmum nt1altoiictydla rauvpn(0aetoxfciotfp eanvo s t2urim iodaptelncslt)s2trxm nt1aetomoctltfm rmnmpn()aexrmo todomDr u i;s0s2toxo iu1am  miciltfarumxrpoo0optoifciys a umn p;u4aexnmf3iotfp eanes s) ruoio oudap elnvs ( sDrauro;t1tltnif3ilsfsDrau o;u)arenxr3ty1lptelueils0 exo(rpou1al   fet s s2rmx oou0aleomociytfm rmums;(4texomr3ia1optelnei s)t2xo(o iydal  lnctl(fsrtmurono4opxniieilt s2um(msn(4 eermr3oatfpDe ivi;t0setr(m3oy1lm e ics tfsrrrxr ;u0ope ioeild a2eaums u4aetrxo oa1laDran il(0t2xmxmpoydomtemfvilsfaDtmu o;u0apxnmfciatlm2ranvo t0 rxoxf3totop r nvi s)srtoir nudamt  icsat) 2ta(m ;t1olt mieild mDrluvs u) eermfciydlat  u i s0tetr(opoodaptn net t)sDtax  no0olx ioetad m2rlnmp u4 rtoxo oa1la  aneol( tetrxrpny4oleelici (  rrr(m ;o0aeenmi3tlt s rmn sn()tlxnmr oa1fate ieol( s2uoir nu4aptemnesa(  rrmu  no0oeeo o3iydlsDumn o;u4alxomr3iy1lptrlneilt0 2urxr iodopeelnvilt arur(r ;o4oet  f3iasla ulnmo;()aeeomf ta1fmtean ils0trtmxrpnudaptemfciat)aDrmxmo;t0aptnif3ild s rmnmp;t4texomrcio1lmD ai o;t0srxoxopio4llt lfvi t aDtrx pno1alxnii3ild aDran o;(0tltrmo ty1fmD  uvilt)s2umxrpoudoltelfvtl( a2tr(rono1opx  fctydfmDuau snt4alxomf3to1fp  luvs;( texrio3io4lmtnlietas a2urur no4opxn oetasfmDrlu on(4 exoir iadfaD li i;t setrim3oo1omt mneiat artrx p;o0oeeniieiltfm umnvsnu4artrxfcio1lmDr nei;t0 eurir3ny4omte feiatfa2raxrpnt0ale mo3iytfm2emu p;t4teeomo tadlptrai s;(0teuo(m3iudlle mivtas)aDtmxr ;u1tetomi3ildlaDrlnms u4artniocoa1fpDe n s s)seuo(m3oy4lpt mneslsf rur(rp;u1tlen ociad a2em( p t4 renmf tatlpt aneo;s)srxm(m oydap   ivsa(f Drmu pot4tpxnmo3tadla2eluvs () eeomrcoadfp e n o ( sexmxrpiu4alenmnvilsf rur(mp;o4oex iiciadlm emuvp (4 exrxfctotfpDr ivil( trxoxopnodlm e nesltfarum( oot4oeeomfctls s emn o () rtrircoa1laDeli s;(0srxr(m iodapt mfvi tfsDtmu o;o4alt  icilslm2eauvp t4arermo tytlmteln ils trtm(r nu1ame  ivi s  Drmu  nu1tetomocildlm ra(mo;u)arxnxo iytom  ai i;(0texrxo nu1amtnmivslt) Durxrp;t0oeeoiociatfs2umnvonu4 ltnmf iodoaDelieo ()s2trxrpiy1altelnesa( sDtrum nt4oltn fetatlaDemuvp;u)alerir oa1fateli i;t s2umxmpoo4lpe mfetls arra(mono4oeenmo3tldls umnmo t0 rtnircty1oa rau o;t)srtoiopiu1oleemivtls)s2ra(mpou0teeoifetldfs ranvs;u0 renir3oytfp  ai s;t0t2umxopiydap emfvs t)srraxmonu1opxn oeiys m2ua( s;u4aeenmfcto1lpD lu i s)srxo(m nudlmen icilt)srtrxrpot4oet  feiyt s2raumon(0 etrir3oytomt lneil()trtmxr3iu1ole mfeils aDumuro;o1oeeomf3tyt s um(vpnu0tlenio3ta1optranvi ()t2tr(m oy4om emicsltfsrtruronu1teenmfeilsfaDemn p;t) rerxo ty1omDeauvi t t2tmimpnydll emivs t artruro;o0tptnmoeiydfmDean s u)aetrif oo1la r nvo;()texm(r3ou4om n feslt aDraurp;o1tlt iieildfm2uauvo;t0trxrir3tadfpDelu sl(0 2uo(r3ny1alte ncs (fs2tmu pnt4olx if3iltlm uauvp;u)teenirctatla  aiei;()t2xmim3iydamtelfet (fsrrauront4olt  ieiasfmDuauvsnu0aeenxo tadlaDe n s ()seuoimpoo1ale lfeta()aDta(ront1tpx mo3taslm2ranvont) rtnxrciatlmte u o s  2um(mpiudame lnvt sfartmump;t4tlx  fciysls2emnmo ()alxoxr3ia1lpDe i i;s)tetr(m nudlmtelfesatfs2rmxro;o0oeto ociasfm2rm(mp (4 rtnirctodfpDe ieil()t2urxm oo1amt liesl(fartmxm ;u4optnmociatfmDulums t)aexoxrctodfp elueo;t) 2uoim nudlltnmnvsls)aDtmx o;u4teto f3tltla2ea(vs;t4tlerxf3iydla  lieo;t t2umxo3iodape licia( artr(rpoo4tlxoiiciytlm2rm( snt0alxnmoctadfa r u o t) rxrim3nudopeemivias artr(rooo0aee  i3ild s2ean s (4texnif ia1omtrlu ilt  rtoxo nu4om nlict () Dtrumpoo1aeeomfeilslm rmn o t4aexnifctotfm e ues;()trxmir3no1lmtnmici (fa2ua(mp;u4tle mieiatfm2eanmo;(0 ltrmo oatoa elnvo s trxmir no4apt mfes s)arrr( o;o4aexoio3tyt m um(vp;(4altrxf3oytfmtrlueo ( s2xrir3iy4ape  fvs (f 2rmu  ;u4tlen f3tasfs eaums u4 rtoxocoytop ranvi;t seumim no1lmeelivi ( sDta(m oo1tee ii3iaslmDumnmon() etriociotfpDrluvo ( truo(r nu4llte ies t)aDrru p;t0alenioeiasfs2elnvs (0tetomr iy1fmD livs () rtm(r iu1omtelnvia()aDtr( pnt1aexnioeildlm uln o;t0tetnxo ta1fptranvs t0sexr(o3iudlme mfesa() 2tmu ooo1oeenmocilsfs ra(vs t) leomr3oytom e nvilt0 rxm(r oy1llen fesl( srtmx onu4olxnio3ils a elumo (0trerxociy1oaD  ueo;( trxm(o3no4lme  nei t)srtauro;u4olt mfeild m rmu pnt0 rxrircto1fpDr nvsls trtmxo3no4lm  lfeiat  Dumumpnu4ale  feiyd sDua(vp;u0texrxrcoy1la rai i;()srurio ny1amtn ieslt sDtm(moou4opxo ocilsfaDrmnvs;t0alenmr3tadlm eaieils tetriopiu4ll  mneilsfaDtmumpnt4tee  ietys sDrm(mpnt4texoio to1opDr i ols trtmxopiydopt  iet t)arrmu o;o4tle mfeildlsDrauvs t4 etrmf to1omDelieo t0sexo(o3oodapeemnvslt srrrxm ot4aptnioctldfsDeauvsnt)texrxf3oodlp  lnvs ( srxrxm nu4am elfcs t)sDtrxroou1opxnmociltlmDulu onu4 rxomocoo1om eaivs s trxmimpnu1omeelietlt)s2tr(rpnu4opxnmoeiyslm2um( s u)trtnio iodlaDean o;s0 etr(o oudlmtnmfetasfsDrm( pnu1tpxoioeiasfa2ulumo (4arxrmr3io1fmtelnvols s2tmxm iu1lpenlfeiat)aDum( ooo4texoiociat aDrm(vp (4 exnxo tydfmDeli o;t s2umxm ou1llenmfeia()aDum(m oo1apen fetld mDeluvp t4alxrmociytlmDean olt sexrxrpio1alte fvs sf 2ururonu4ale  feiys aDrau p;t4trenmo oytfmtelnvsl(  etr(o3nodlpeemfesa() Dtr(rpnu4opxnioetatfm elnvs u4tetrio3oy1lmDe n i;t0t2ur(opnu1omte fvilt)a2rmx o;t4altomo3ilslm ua( on(4teermf iydomDrli slt t2tmxo3oo4al n nvt t  2rmuro;o1oltnmi3ilsls2ulnvpnt0alenxr totfmDrlu s;s sexo(opoudapt lnctat sDtrxr nu4oeto oetat s2rm(msnt) exrmf iatlpt  ivols0seumim oodlmee neilsfaDrrx  nt1aeto o3tld s2ranmpnt4 ltrmo3oa1fm eau il( truoiopoo1ll nlncsa(f ruax  ;u0texn feildfs2ua( ont0 ltrio iy1lm  aiei s)srumxo3ou4lltn fcia(f Dumu  nu4aexoifciaslsDrl(vs t)artomr tatlaDelnvi;s srtmxr3iy4ap e nvs s sDuaumoot4altnifeiydfm um( s;u4 eeomo tadfm  ai i;t0sexo(m3nudllte feta( s2rmumpnu1tleoio3iltlm2emu onu0 rermrcootomDrlu o t0 2um(m no4alt  iei s aDtm(  oo4alxomiciltla umn o;(0 lxniociytla eln s;s t2xo(opiy4llenlfvilt sDtrurp;t0tlx ioeiydfm emnms (0alenmr iydopte ieslt tetmxm iu1om   ies t) 2umxmont1oeeomoeild a2em( s;u0teeoxf iatlate ivi;()sexr(r nu1altelneilt)srrmxro;o1aetnmo3tytla rl(mo;t4 ltrmo3todfp e neo;( texmxo3iudom emics (f Durxmo;o1alto oeiad aDrluvo;t)alermf tatlmt  uesls trtoxr3ny1ale mfvia() Dtrurp;t1tetnmi3tatlm rlnvp t4 exnxf3iytomtrlnvs;() 2umirpio1omeemnctas)s2tm(ronu0tptn ociyd a2ea(mpnu4aexnxf tatlmt li s (0trtm(mpiy1lpeelfcsasf Dra( p;u0tpt miciytfs2rmu snt0artrmr ootom   u i t srumir3nodlpee ict (  2rr(  ;u4alxomictasfa2umnms u)tltrmrciatoaDr ies (0texrio3nudaltnlfetl()sDtr(r ot0aleniictlsfa2ranvo u4teerio3iydlp eaivi;()s2ur(r oydamte icsas) Draxm oo4olxnif3iys mDeln p (4arenifctatomDe ueo;t) rumimpoy4llen ieta(fa2rmxr ;t1oetomo3iyslsDua( s;()texnir3iatlm ranvil(0s2ur(rpiodapt miviatf rur(r ;t1tee mfeilsfm2ul(vs;u)arerif3iodlp raivi s0s2xo(o io1al e ncs s)a2rrx ooo4openii3iad sDeln p t4texrif3tadfptr u s s trxoxo io1omeemfeiltf Drmxrp;u1aee  fctydlm umuvsnt)altrircoy1omtr ueils) rxoxr3ny4ap eliet sf 2ta(mont1optn ociad s em( onu0 eenir oodfmDelueols texr(r iu4lpe  nvtat a2umxr nt0tpx mietysfm2ulu p ()trtomrciadfateli o;( s2umxmpnydoleelnctls aDtau  nu1oltomo3iadfmDean pn(4arenif oo1fa   n ols0texm(o3io1ol nlfet s arrrumo;u4opeomf3ildlaDuln pn(0alxoxr oatom elu ilt teuoirpio4oltnlfvi sf Dum(r ;t4aeeoifetlsfaDea(vsnu)arxoxfcta1lptelivi;t seto(o oodam emfvia( sDtmxrp;t0tee  oetas s rau o u4 lenircoadoat  i s;( teurio io4llenlfvs s  2ur(ront4tptn fciytfa raums;(0treoxr3oadop eaneo;t0 2uoir3ny1omtnmnetls s2rrum ot0tetn iciltlm2emnmon(4aexnio iotopteauvo;s0sexoirpnu4lptelivtlt s2ta(m nu1oexnioctat s2em(mon(4altrxr3todfatrai o;() rxoim oudal e feils sDuaxm ;u4tlenmfetatls2rauvpn(0 eenxf3tatomt lues;s0s2xo(m nudlpeelivsl()aDrrxr oo1aexniieiydfm2rmnvpnt4 reriocty1laDr nei;s s2xm(o iodll nliei ( aDtrurp;u0teto o3iytla ea(mo u) rerirctotlmtran sl( trum(o3no4omenlfcslsfs2rr(m no4tpt mictas mDeau snu0 lxrmo3oodfmDran il(  eto(r3iy4lpenmnvsas)s2umx  nu4oeeoiietasfs2eln s u4 ltrmrctadopDr neo;s) 2toir oo1ope  fviat) 2raxroot1oetnioctys a elums;u) eenmf3iadlmD ln o;()teumxm3nudamt mictasfaDtrx  ot4oeeomfetysfa2el(vo (4aleomo3todla  aues t0t2xrxm3oodam elfciasfs2ur(m oo1tlen icildls2eaump;t)tltrir oytfm e u sl()trxoir3oudamtnmfvs tfs2tm(mp;t1tltnif3iasfmDulnvpn()aetrxr3oydla e ueolt s2umir io1ap e feils aDtaxrpoo1aex  ieildls2rmuvs u4 lxnxocoadlpteaivo t0t2toxrpoydop elics s)a2umu pou0tltomieiyslsDeaumpn(4teeoiocootoa e uvo;s)s2tr(m3iudopt  feilt)s2rrxro;u1aexniieiys aDrl(mp t4alxnio3ia1la  anvs t)trtrxrpoo4oltemicsa(  Dtm( oou4tpt  fctat sDem( s u4tetrmrcootfaDelu i;()srtmxm io1alt lfcsls a2umxr nt4tex mi3iys mDumnms;t0 ltnmr3oy1lm r uvs t  rumxrpiydopen nvsas  Drrurpou1oeto fciyt aDuanvo t) etoif oadlaD lu slt) etmir3nydlm e fvtat sDta(m ot1oleo i3ias a2rm(mo u)aexomo3io1faD  n i s0 rtr(m3ou4lptnlfvs (  Dum(mp;u1alx iieildfa2elnvont) eenmfcio1oaDr u o;s0t2xrxo io1ome mict tfs2raxmpnt0aetnmo3ild aDuaumsnt4aeenmo iatfmDrliei;s)s2xmim no1lmt mfeils s2uaxmo;t4teeoii3iytlm rau p;u4tetrxf3ia1fpte n s;s0t2toxm3ou1lmtn ieilt  rurxmo;t4opxoif3iydfm um(vo () exomo3totlmtranvslt srur(rpiu1llteliciltfsrua(rpno4oltniicildlm rmumo;u4texnxrcta1fate uvo;s t2urim3iodlp nliet sf rtrumo;t0altnmf3tydfaDrm(mpnt0altnxf to1fp e n olt0truoxm3oy1lmee ncsa(fsDtmxm oo4tpxn o3tadfs elu ont) leoxf3iy1latelu i () 2to(m3ny1altnlnvt s  rrrumonu4tet  oeildfs2rmnms;u)tetoio oa1lmtr uei;t0seuo(r3iudllen fviatfa2umu o;o4aex mf3iydfmDra(vo u)alermociatoaDran ils tetrxm3no4lptemfesas s2rrur ;u4oeeo ietadfsDrmuvsnu0trenxrcoydopD  ues;s0 rurxrpny1lltemnvtl()a2tr(mpnu4olt  f3ild a2em(vsnt)artomoctotlm rlieo ()sexmim oudlpe lnetltfa2urx ooo1ape iieiat a2rl(mp ()trermr3iotlpt  neo t0srxmirpiodolt mfeil(f Dtax  nu0alx mictlsfs2ul( sn() rtnio3to1oaDe nvs;t0t2tr(o3oo1om nlfetlt)arumxmonu0tpenii3tyd m rlnvo (4arxrmo oytom  aivsls)setrxr iodlp nmnvs tfaruaxmonu1aeeo o3ias mDulumont0arerxf oytop r uesl(0texo(mpou4lpte fesas srtax pot0tpe mi3ildlmDulnvsn()arenir3iadfpDelues;s0t2ur(rpio4olen ivtas  ruru pnt0apen oeiasfm2ua(mo;t)altomf iadfmtrln ols0 2uoirpnu4lmeemfctl() 2ua( o;t4tpe  ociltlm el(vp u0 rxnif totopt  u i s) 2uo(o oudlltnmnvs ()srurxm ;u4opeomo3tasfa rauvp;(0alenmr tadlat ai o;( s2um(m iu4apeemnvsl()a2uaurpnt4tltomoeiyslmDemuvp t4arenmf ta1fa  auei;s) exriopnu4opeelfetl()aDrr(mp;t4oeeoifciydfs em(von(0 rtnxf3oytlmtrlnvil(0 rtm(m3nu4lm elnctl(fsrtm(rpot0oexoio3ils sDeln s u4 rxnmfcoydfpDeanvs s t2trim io1lm e nvs t)sDumu oou1tptnmo3iyt mDelnmp;()aeermrctytlaDr u i;s0 rtrxo3ou4amt mnvi ()sruru ont1tetoiietldls2rln ont) rtoircio1om   ivo;t0srum(r3nu4ope mivilt)a2rmx ono1aetomoeiys sDeanvp;u0 exrxf3iotfa r u il( teumirpnydom n nvta(faDur(ront0oetomieiasla rauvs;u)aeeoircoodfp eai o t)setoiopiudolee fvi s)arrm(rpno0ope  o3tyd mDul(mo t0artnxf3oodomDe i ols0 rtrxm3iu4ape licsa()aDrmxrp;u1tex  ieild m emu s;u4alermr3iytlmtrlieo s  2tmiopnu4oltnmivil(  Drmxmpnu4apenii3iat a2em(mp;u) eeoxf oy1om elu i;s trxmimpno4alt  nvsls  2trum ot1oexoif3tad m2ra(mp t4altrmr3oo1opDrauvi;t  2trxmpoy1lpe  icslt)arum(roou0oleniiciyt mDrlnmsnu0arermo3todla ean ilt  2xrirpnu4olte nes tfsDtaumo;u1oet mo3ilsfs2uaump;u4arxoir oatlptranvi s)t2xo(o3iodom   fvtl( aDraurpnt4tpe mf3iad sDea(msnu0arxrxf iotoaDr iei;( srtmim nodal nlfvt (  rrmu  nu0tptoifciyd sDrmnvp;t) eeoifcio1fpt an s;()t2xrir iydop  licsls) rrrumoou1aeeo ieilsla2em(mp;(4 rxrxf tydfmD lieil(  2um(o3nu1lltn fvia()sDum(r ou1olenmiciatfs rlumsn()altrmr iatlat anes;t)tetm(mpnydopeemnvs s) Dtru o;t4tptnioctaslmDrln p u4 etoxociydfa eaueolt0s2xr(rpiy4omt lncsat) rurx  ;u4oleo iciytls emuvo;t)aetnxfcoo1fmDe uei;s  exrxmpiu4omt mietat aDrm(mpou4opx  ictas s eln pn()tltrir3tadla  anvs;t0tetmir nu4al nlictlt aDtrxronu1apx  i3iyt a eluvs;() reomrcoa1fpDeaieol( trumxopoodoleemfct t  2uax p;o4opeomoetys m2eauvon()trtnir3oatla e ivo ( t2umxrpny4al   ivt ()sDtmxm ;u0oetnii3iys mDeaums;(4 etnxf iotlpDelueilt) 2uoxr3iydlpee iet t)sDrmxmpno0tleoiieiytlsDumu onu4trenxf tytfa rlu i;t)trxoim no1opeelfet t)aDtr( poo0oltoiociltlm2umumpn()alerxf iy1lateluvsls) rtr(mpnodaltn ici t) Drrumpot4oeeo i3tld mDel(von(4texoircia1lmDrli o t0t2uoir iu1ll n feilt  rtr(rpou1tlxoioeiydfs2uau s u)trerxo3todoaD aieo;()tetoxm3io4olt  ici (faDtmxrpno4altoiieild s2eluvo (4 etrxo3ia1lmte i slt t2tm(m3iu1om n fcsasfarum(r ou0apx mociltfm2umums t0 rermo3ty1fpDr ivsls0t2umirpoy1lpt mneiltf rra(m ;o0tpeoiictat s rlums t) ltnxf to1faDrln ils0srtmxopiydlmeemfvsas sDuax p;u4oeenmi3iat a el(mpnu4aeerif io1optrlnei t0t2xoim3ou1opteliei t  2ra(  ;t0ape  oeils s2rlumpnu4 rtrxr to1oa r nes ()seum(opoy4ope  feiasfa2raxro;o0ale moctydfm2ul(mp u0trtrif3iytlaDeanvsls0t2uo(r3no4opee nes s aDumuroou4oeto octlsfs2raums t0altoxrcio1fmtrlnvils t2uoxopou4llen fesat sDum(  ot1altn oeiysfs rmuvpn() lxoxf oytlm ranvol(0 2trio oudlm  micil( sDtrur nu4opeomf3iytfs ulump t0 rxoir totfaDr n ols  euo(rpno4op emfci s) rrmuroot0tltnmiciyt mDumu o;t4alermf3tytoaD an o;s0 rxoxrpou4lme miei t s2rmu o;t1tlenifeils s2emuvo (0aetnif iotlmDelu i;(  euoxrpoydlpenlfcia( artrx p;u0tlx mo3tlt s rm(vsnu4tlxomfctatoaDe i ol(0 rtr(rpoy1optelnvia()artrum nt4tleomi3iat m uluvsnt0 ltrxr3tydfa  ln i ()seurio iy1lmenlietl()srtauro;t0optn o3iadlm2ranms;t0trtoxr tadfa r u olt t2urim3iydll n nvslsfa2um(mpou0aleniictls m2rlnvsnu4 ltoxo iadlm eluvo;t)s2uoir oy1lmtn ivta(fs2umumooo0oltn iciadlmDelnvs;(4 renir3iotlp raieslt)sexmiopiudomtn nct (  Draxr ;t0tee mociydlsDraump t) ltrmf iadfa eaieil(0 2umim3oo1lleemici tf rrmxmo;o4oltoifcildla rau on(4alenmf3iodlm  anvo t texmiopoudape lfcia(  2urx  ou1olxnifeiytla ua(ms u) renif3iadoat  nvslt) 2umxo ny4omenmivsas s2tax onu0olxnifeiaslsDua(mo (4 lxomr totfpD  i o t)srxrxo3oy4lm nmicsat)sDtaumont4tpxnifctlt a2rmuvpn(0tltrmrciy1lateli ilt0setmir3iu4ame mfcs (fa2urxmonu1tetn iciysfa rl(vpn()arenir tytfmD livols0setm(rpio1lp nmnctat arumxront1tlenifcildlm uauvs;(0altnmrciytfp e ivs;s0teurxrpoy1lpt  ietlt s2ra(r ou0aexoif3iadfm2rl(vs;t) lxrmo3todlp eaneo () exoxm3iu4oleemnvt tf rua(r no4tet mfciadfs rauvo;(4alerif3todopte ueo s)t2um(opny1lpe  fviltfsDuaxm oo1oex mietyd sDua(mp (0teerxr3tydopDe u s (0t2xm(o nu4altnmfct t srraxr nu1olxn ieiad mDrauvpn(0tltoio3tytfm elnesl()trxrio3oo1omen ivtls) Duaxr ;t4teto i3iadfaDumnmo;u)aetrioctatfat an i (  rurimpiodllenlfciatf Dtmxmpou0tptn ieiltfmDrmumsn(4altrio3oydfmDrlnvil()s2tm(o oydomen ietl() 2uaxrpnt1tpxniiciytls uanvs;t4tlxnxo ia1fptelues ()teurxm nudal elnesatf Drm(m no1tlto ocils s2emuvp ()tlxnmfcia1la raues (0tetmxr nydam e ivsatfsDrau o;o4tptn ieiad m2ra(vp;(4alxrir3iatlaD aueo s0 rtoxrpnu4opte ivi tfarumurpot1texn ieiytlm2eanmonu4 lxnxr oo1lpDr nvolt)sexrir nu4apt lnvi sf 2ur(rpoo1optomfetytfmDulnvo;u)texrio3tydfm rlivil()srtrxopou1lpenmnvt (  rrrurpno1alto f3ias s2elumo (4 exoxrciodop r u s ( t2xoim iy1om e netls)sDrrx ono0oetn iciyt a2ra(mo t0aexnmr3oo1fp rlivil()t2urirpoodlle mfvi s) Duaurpnu1opeomfetltfm ea(vont4 eenxrcoodfp rau o;s s2tm(r3iodlm emivsl(f 2raumonu1oetn f3iyt a2rl( ont4aeenxr3iy1fpDe i o;t t2xm(rpnodom emiviat srrmumpoo4aptoii3iydls ul(vpnu4tetomrciatoatr nvolt0 rxr(r3ny4optn ivtasf rur(mo;o0optnio3iad sDuluvo () rtomr oytfpDelnes () 2xo(m3io4olt miesat) Drrurp;o0olxn i3ild s2ea( p t0aeenxo iodfpD aues;t t2tm(m3ny1omtn fvsat  rrrxrono1oet mf3iaslm2eln o t0artnmr3ty1la rai o s0 rtmxr3oy1llte iei sfa2urur ;o4apx  f3iatlm2rauvon(4aetoxrcta1oa elu ol(  rxr(mpiu1amtelnvilt)srrmxm nu1oee if3iadfm rluvs;u0arxrxf3iytfmDrlnvo s0 rtmxm ou1ap elivt tfarraumooo1olt if3ildfa rlnms t)arxrmo3tytfmt  nvo ()texoio3nodap  liesl( a2tm(rpno1tpx  iciysfmDumn o t4 leoxo3oytlp e nei t0 rxrim3iy1lp e fesl(  Dtrump;o0aetniieiatls2em( o t)tlenif3tadfmDeanes t s2uo(o3oy1lp  mnvtlsfsDrmur no4tlx ioeias mDea( o t0arxrio3ta1laDelieilt) 2xrir3oy4ll  mfcslt)srur(root1opxomf3iad mDrlump;t4arxnir ta1lmt aneol( trtr(m3oy1oltn ict t)aDtaur no1ale moeild aDem( o ()artnmfcootfat  nvo;t)trtrxo3oo1ape  net () Dur(rpoo0optn fetldfs ra( p;u0trerxf3iytom rluvs;(0 euoxr oy4olte nvs (fsDtmxrp;t4aeeomoctas sDuan pnt4aexoxr totomtrliesl( t2uoirpnu1ol elieias)s2uax  no4tle ifeilt m2el(vont0aeerxocoytoatraivol()sexo(o iy1lm emiviltf rtau ono0tee mfetatlmDumump;(0teeoio3iy1fpDrli ol(0t2xmxo3ou4op n ivs s  rra( o;o4ale mo3iyd a2umuvp;u0alxrmf todfmDrau o s) eurxo3io4lmtnlnes s a2taxmp;o0texnii3ilt a ra( p;u)trtoxr3iy1lpt  n o;( trumim ny1optelnvi (fsrta(monu0alxniiciltfm2rluvs u)tetrmfcoy1oa r nvs;t)seur(o3ou1optelicias  2rr(mono4aptoifciyd s rmn pnu4teeomr3iatom rli ol( sexrio iodomee ivils s2umx oot4teeo fetys sDrmuvs;u4 eenir to1fmteaiei;t)srxoxo oudolee iviat aDurx  oo0tpt mfeiaslm ea(vonu4aexnmf3tatomteai olt  rum(m3iodol   ictas)artaumooo4tlxo fciytls elumo (4tlermfciodlm e neo t0 ruoio ny1opee net s) Duaxrpoo0oexnmieiysfm2ulnmpn(0arxnio oy1omDr neils0trtrim3nodoltnlncil(  rumurono0tex iiciys aDuanvpnt0 lenifcoa1lmt anvo;s t2xoim no4amtnlfctasfartrxmoou4oee ii3ils mDelnmont)trtrmo3ootomD livo;t)srxm(opnu4oleemivi s s2rrum nt0alt mfeiydlm2emu s;u)tlerxrciodoaDeaueo s0 eto(o3oo1lptnlfvtl()artaxmpnu1aexo octatls2em(monu)arerxocia1latrlneo;()srxrxm oo4ol nmncsas a2raxm nu1oetnio3iatlmDrmn o;u) lenmo ootlat lueo;s teumir oydllen ivtatfartaxmp;o4aeeoiiciatfs em( onu0aexoxr3iatlptrlueols)trumxrpnu1am elfeia(fsrrmu  no1tlxn f3tldla uaumont)alxnxo todomD  iei s) 2uriopno4ape lnvia(faDurumont4aex mieiydfm ua( s t0arxrmoctotoaD ln o;s0 etoio oy1ap  mneta()aDra(roou4oetoif3iatlm umuvp;t0treomr3ta1fmteln s s  ruo(r no4lpen neta(fsruaumpot0apt  ictydla2uaumsnt0arxnif3oadop ranes;t0 euoim ny1op emnci t s2rm(m oo4apeomietat m2el(vonu4teeoxrcoa1fatelivi t0setrxm nydole  fvias)a2umu  no0opeomf3iat a2ul(vo;t0tltrif iy1opD auvilt0 2xrxopiu1lptelnctatf 2rax  ou0alt  f3iatfaDeanvonu4 rtoxf3iadomD  ies;s)teuoim nu4ol nmies s  Dta(r ;t0ole mi3tadfa2rlnmpnt0trxrxr3oatfatrln slt0 ruo(rpiudaleelfci sf Duaxmono4oetnio3tldfmDea(vs (4trtrxfciy1om e ueo (0 2uo(mpny4apte fct (fs2tmxrooo0apxomicils m2eln pnu) lenxrctodomDrai ils) 2uo(rpiodaltnlnvs ()aDrau pnu4tpenii3tltlmDemnvs ()tltnmfcta1omDrai o ( teurxr nu4apt mfeta() rrauro;o0tlxoii3iasla2rl(mo (0trermrcoo1lmte neo;t0 2xrxrpio4amtelfvtlt) 2tmu  ;t0tex ioeilsfm2ulnvp;u4 exrifcio1fatrli i t  rtrio3nu4lp nlnei ( sDtaxmp;u1teenmociaslmDulnms;u0 lxrmr3oytomDe neils0s2xoiopnudopt lncs (fa2tmuront0tpxn octydlm rlnvs;(0 renio oa1op r i i;t0tetr(mpoy1aleemieta(  Dumump;o4tlxnmoeiysfsDra( p (0aetrxrciodla  aieo () etrim3iydol nlnct t)aDur(rp;t0open o3tas a umn o;u4aeeoif3to1lptrau sls)seumxmpiy4optn ieiatfs2raumpot4aexomfctlslmDrlnvp u4 exnxo3oadfpteanesls)srxrxo iydll emfvi tf rtrx pno4olenio3tltlsDranmon()artoxf3oo1fmteluvi s0s2xmxopny4llen ivil(f rrr( oot0ale io3iltfm rl(mp;(4altrxo oy1opt luvsl( t2toim ny4op emncslt) Dum(moot1opxo oetasfaDeaump u)trtnmo oa1oatranvs;s0 2xr(o oydapeemfei s) rrmx  nu1tlxoifeildfs eluvp () lxnxrciodom  lieo s) rtmir3nydlltn fvtas sDtmu o;u0aleo feiyd m2eanmpn(0tlxnifctotlaDe uesl(0teuriopoydamtelnvs sfsrta(rpno0tle iictadlaDul(vpnt0trxnir3tadlpD ln o t) etoiopnodom  mivil(f 2rrxr no1teeo o3ild s2ra(ms;u4trtrxr iotop rlneil(0 2urxm3nu4amenmfciasfarrrxm nu4oetoifeiad mDemn snu0tetrxr3ty1la r i s;s0s2xr(r3nodlp  lnes t arrrxm ou4tpenmieiatls eau on() rtrxrciatlp rau sls0sexmio3nydopen fvtatf Drmurp;t1aeto o3tys sDemnms;u0 renmo3oa1om eanvsls0 rxrio no4altnlfvsls)s2rrurp;o4apxn fcils m2rlump;t0tetoifctadlat liei;s srtrxm nudop elnesasfsrumurooo1oetn o3ildlaDeau ont)alenio3iy1omDelu i s  eur(o3no4ll emfvi (fsDtmurooo1olxomoeilt mDuluvo;u0teeoir3to1fmDe n o t  rto(opiy1olenliesa(f 2ra(rono4tetnifctytfa uanvsnu0tetoircia1omt lues;s  2ur(r3io1lpee feil( sDrm( ont1tee iociltlaDrmnmpnu4 rxnxrcoy1om  liesls srtr(r nodlpen nvi (  Dum( onu4alt mociytfm2rlnvo;() lxoir oy1laD aueo;t t2xoxm3no1omt  fvt t)a2tm(mp;u1ole  o3iatla2eanvs ()alenxr3to1lmtelues s0s2xrxm3oy4ap elfesl(farumxrooo1aptn oeilsfsDul( ont0tetrmr ootom  anvo;s sexmio3io4amtn fet s s2um(root0tpe  oeiytls2el( p ()alxoxfciatopDeauei;t)trurirpno4lltn netas) 2rr(mpoo1tpxomfciydlsDranvon() exoif3tydfp rln ilt  rurim iodopenlivslsfa2rrurpou1teeomfciys s ulu p (4tltomr3oy1fpDr i s;s0srumiopou1om emnciltfsDtaxmpou4olx  feildfaDrmn ont4 rxoircoo1omtelnvo;t setrxr3nydap  lfct ()sDtm(m nt1teenmi3iydls rmn on(0 ltnio3tytoaDr nvsls)srxm(o ny1optemnei t  2rru p;o0tpt  i3ilt s rmuvo u) rtomf3tydfa   nvsl()s2uoxr iy1ap n nesatfaDrrxrp;t4tleo f3ias m rmn pn()tltnmr3oytfat auei;s0srxo(rpnu4llee ici (  2ua(  ;u1oexnifcilslm rl(vpnu0treniociatop e n slt)sexm(o oydomeelfeiat a2umxmpoo1ape iictlsfaDum(vo;(0aeeoxr3oa1lpDeaueolt)trurxmpiudlm  lfct tfa2urxmont0aeen oeiysla em(monu0altnmr todopDrauvs s)t2tmio3iu4ll  lncsl(f ruaumpot1alx if3tatfa eanms t0altnifctydlmt lnvs;(  2toxrpoo4omenmfet s)s2urum nu0tptomf3tatls rl(vont0 etnmf to1fat li i;( texmirpno4omeelfcta(faruau pnu4tpxoii3tas aDranvsnu4alerircoodopDrlnei;(0trxrim3nudamte ivsa( srur( p;t4tpx moctytla2umn sn()trxoxr3oodlpt lu s t)t2xoim iudom n ivta( artax  ot0tle  oeildlm rluvpnt) reoxo3iotlaDrau i;s trtrxopnodllt lnvtas s2rm(m no0oet moeilsfm2ranmont4 rxnxo3oadfpD  n slt0 2uo(opiu4ol emicils  2ra(rpot1oexnif3ias aDuauvont4trerxfciodfaDr u o (0s2tm(m iodopeemncta(f rum(m ;u4altomoeiysfa2ea( s;t0tltomfciadlm rlivo;s0 rxm(r3iudlp   net t aDua(rono4opxoiociat m rmnvp;u4aetomoctatomt lu i;s)t2to(opnudap  livtatfaruaum nt4tetnmfetlslm ul(mpnt4tlenifciadfa   ieo t t2urxmpio1omtemfesas a2umur ot1oet mictytfa2umuvsnu0artnxrciotopte nvils) euo(r iodale  feils sDtr(rp;u4ape  ocilsfs eanmo ()trxnif oadopteln i;(  rxr(r oodoptnmnvs ()aDumxrp;t1tpeo ietyt a rmuvp;()tleoxr ta1op e ivi s)sruoxo nu4op  lfetas  rta(m nt0ole mfeiasfa rmums;()alxniociytoaDraivil()srto(o ou1ap elnvtas) Dururpot0tpxo i3iyt s eluvpnt)altnmf3iy1fm   ivils0s2tm(mpiydale mnes s srtaum oo4tetoifciasla2rm(vp (4 rermr3oydfm r ies;( srum(o3iu4aptnmneiatfsDrmumono1tlto f3ild s elu p;(4teermocio1latrliei;s)texm(r3nu4lmenlivtatfsrtm(moou4tpenifeiadfsDua(vont0arerxf3io1fpte i sl( texrxrpiy4lp n ies tfarum(r no1tptomoeilt mDrmnmon() rermrcoatfp rlu o () 2ur(o3nodlpeelncsat aDtaur ;o4aptnii3iltfm umn snu)trtrxf oo1op r ivo;(0trto(r3oudol  lnvsat)s2rru  ;u1alx ii3tld aDrmump t)tlxomr3ootom eaues (0s2urxm iy1lmtn fvi s  rtr(m ;t0oleo o3ilt a ulnvs;t4texoxr to1la   u s s  2xoxr3nodlltnlnvilsf ruax pot4aetnmfctltlm emu p;u0trtnxrcia1la eaivs;t)srurxrpoo4olee fct sfaDumxrooo0opt miciadfs2rmnvo t)arxoir oadoptr ivols)s2to(r3nu4oltelietl() rumx ono4oex  ictlslsDraums (4teeomr oadlmDelnes t  exoimpny4lmtnmneta() 2ur
\ No newline at end of file
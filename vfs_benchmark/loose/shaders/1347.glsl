@@ -0,0 +1 @@
+uvs (0t2tmim iodol  mivt t s2tru  ;o1aexomo3ias sDul( s u) rxrmoctytfaDean ol() eum(m iodllee fct sf 2tr(rpou0aleo oeilt s2rln snu4tlerxr3tatopteaiei t0 2uo(opiy1al e iei () Duaxm oo1tleo iciytlmDul(vs;(4alerxrctadoa rlies;s0 rxoir3iydllenlfetl( aDtm(m ot0oeto feildlsDul(ms;u4trxnxoctytlatrln o t0trtrxr iodllte nvtls) Dur(r no1tleoioetyslm uln o;t) ltoif3ta1lp e ieil( s2tr(o nu4lp elivi tfsrtm(mp;u0tlenmictysla el(vp;t0tltrxr3oo1lptrln s s texr(mpnudlmt  fcilt)srtrumpot1tleoif3iasfm2umu pn(4 eeoxfctodlptr nei;t0srxrim3nu4lm   iesl() Drm(  ou4aetnmoctasla2emums;(4 exnmo3oo1lpteluvols0s2urxm3iu1ap   fet t sDtmuro;t4aetnmi3ilt sDua( snt0 lxrxo oydlmt aivo;s)s2xoxm3no4ape  fct () rta(r ;u0oltoiieiat aDelu on(0artomr3todfm rlnvsls)texoio io1lp nlict (fs2raxm nu4opxnifctytfsDua(vo;()aexrio3oydlaDeauvsls0 rumir3no1ll nlnvi tfaDtmxmpnu1aex  o3tys s rmnmsn(4 rtoxo3ia1fateauei s) eumxopou1amtnlivt tfaDraxr ;t4tpx io3iyslmDemu o;u0trxniociodlm  lieil(0srxmxm3nu1optelfvs s)sDuax pno4tpxo f3iadlm emnms;t)alxnxr3to1omDeanvo ( t2xoxm3io1aleemnctat aDtmu ono4tlenmictldfs umn o u)altnif3ta1oaDr ivs s0s2xm(mpnudlltn ivt (f rum(rp;t1tpe  feiytfm2el(vs u0 etoifciy1op ean o;t  rum(m3oodap  lnct tfarua(mono1oetnio3iad m elnms (0aeeoir3tydlaD aieols) etoir3oudome  ivi s srta(r ;t0tee ifeiys aDelnmp;u4arenmr3oy1fmDraiei t trur(m3ny1olt  ivt t sDuau p;o1olto fctadlmDrmnmp (0arerxr3todlmtr u s;()t2tm(o nodaleelnesa()srtrxm oo4tlen o3iydfm2rlumon(0trxnio to1om r n o;t s2xm(m oy4amt  ivt (fsrra(m oo1oleomoctyslm2um( snu4teerir3io1om r nvs;t)srto(rpoo1omtnlicil( a2tmumoou0altn o3ildfaDumums ()trxomrctytfm rlnei s0srum(m iu4olenlncsl( sDtm(roou4tpxoiietlslmDeanvp u)aetoiocia1lmt  uvi;s s2xoxo oo4ll   nesa( arra(r ot0tltomo3iysfs eanmont) rtoirctadfpD lneolt) rxoim3oo4ameemnes s)aDrmumoou0tpx iietas aDuan on(0trtoxr ta1fpDr ueils0 rumxr3ny4omen icsas)aDtrxm ou1oetn i3tldfs2ulu p (0teeomo oydoptranvi t tetm(r3ou1oltnlnvi s srrrumono0apxnmf3tlslm rauvp;t0trtoxf3tydlateliei;t seto(r ou1lltelnctat)srraumpnt4alxnio3iaslaDulnms;u) exomo oytoptr ieolt sexm(opio1amtnmnei ( aDrau  nt1aexnmfctysla em( p t)trtrxocto1lm  lnei;t) eumxr oy1lm  lnvsl()arumu p;t1ole mfctad a2rm( pnt)arxrio oatoatrauvi;(  2trir3ou4lm e nvsas)sDtau  ou0alt mi3iadfs2rmn p;(4 ltrmr todop  luvsls) 2tm(m3ou1al  lies t)srumumpoo0aex ifcild sDraump (4aexomocoo1oate ueo;(0setrio no4ll nmfesasfs2raum oo0aeenmociasls uanvo u4 etnxo3ty1opDean ilt)truoxm3oy4llenmnci tf rta(moou0tpxn fciysla uaumo u0tlxnxr3oadlatrli slt)sexr(m oydop nmnvi s)arta(r no0open oetldfs2ra(mpnt) ltoxo iodlpte ivi ()setr(mpnudopee fvsls)a2rr(mo;t0oeenif3iaslaDelumont0aexnir ootla   neo;() 2xrirpoo4olenlncs ()sDur(mo;t0optniieiydls elnvo;t) exrmfcootoaDeln s;s texm(r3iydlpt  fcsa( arum(monu1oeenmociasla umnvs;t0tetoxr io1omtrau o s0t2urxr io1ll n ieilt arra(rono1tpe moeias a eanvs;u4arxomf iatopD  uei s t2tmxmpny1al  mfciasf Draxr oo0olen oeiaslsDumnvp t0 rtnio3iatlate uvo s  rtriopnu4omeemfvsasf rrrx  nu4alxo fcilslsDulumpn(4alxnirctotlpD lies s) rxoimpiudoltemictlt s2ra(rpno0tee mf3ilt a2uln o u4tlxoxfcia1lp   u s;t s2urxr oo4lpeelnvi ()a2rru pot1tetn o3iytfs ulnvonu0arxoxrciotlm rau il(  2um(rpoy4ale  fvilsfaDtr(moou4teeniiciasla eaump u4 etrirciytoptraneols0tetm(o iudolen fvsl(fsruaxmpou1tlx iiciatls el(ms t)alenxr3tatlmDranvi (  ruoxmpny4amtnlnvtat aruax  ;o0tlt mfciaslaDrm(vs;u0areoircoodom eaivsl(0t2uo(r3iu4ape  nei t  Dumuront4tleo i3iys sDrluvpnu)tltoxociydlmDelnvsl(0teuo(m iudal  liei (f Drrx  oo0ope iieilsfsDem(vs;u4tleomr3oy1la  lu i (0t2urio ou1ap emiei t)sDrru pot1oex mfcias a2uau snu)tetnmo3tydomDelnvi ()texrxmpnudomtemfvil(fsrtm(ro;t4tetn ieiltfa umuvp;t4tltomr3ta1la e ieils0 rto(rpoo4ap nliei () 2tm(  ot1aee  octldla2ua(vo t0 eerif3oo1fatelnvs s  2toxm3ou4ap  lies tf Dtmx oot0aptnmo3iat s2umn s;u)tltomf oytlp   i s;s trum(o3iydam e nvslt sDua(rpnt4aeeoio3iatla ulnvs t0 lxoxr3tydlpDeli o t)srxo(o oy4opt  icta(f Dum(mo;t1opxn ociys s2um(vp t4alxomfciatfmtelu o t0s2xriopnu1altn fct ( srtmx  ;o0tleomfcild mDulu s () reoif oa1fm ranei;t0 rtmxm io4ame mnci s srtrxmono4optoii3iysls2ean p;u)texoiociodomte n s;s0s2tmimpiu4am  livia()a2truronu1tet mf3ils a2emuvpnt) ltoxf3ia1fa elnvol(0setm(o3oo1lmt  feil( s2rru oou0ole mictat sDra(vpnu)trtomr3ty1lmte u i;t  rtoxo iu4lm nmieils)a2umx  ;t1aex ii3ilt s2uanmo;t0tlxrmfcoodfptelieol( srumxo3iu1olt  fcs (fsDrmu pno1alt ifetlt a2ea(msn()teerir3todlmteaivo;(0texoxopoy1lltelfeslt  rurx  ;t4aeen i3tlt sDrm(vonu4 exrmf oy1fa e iei s  2xoim3oo4lmeemfvias)a2rmx  ou4tee  octltfsDuanmpnu0 exnmr3tydfpD livslt)teurxo oudomeemivt (faDtr(m ;u1tetoifctydfaDul(vp;(4 lenxociotlpt au o t  eto(m3no4ope lnvt (fsDrr(  nu1tpto iciasfa uluvsn(4tlxoxr3tadoa eau s;s trtoio iudlmtnmnvsa(f Durx  no4tltoio3ildfsDeau onu4 etnxo3oydlpD ln slt)t2urirpnu1om   ieslt sDtrx pno4tlxnmf3tatfm2umnmpnu)tlxnifcoydlateau i s0 2uo(r nudol   neia( sDurx poo0alxnif3iltfsDrmnmo (4trxrmfctadomt livs;t tetoxrpoodom  mfvsa(faDumx  ;u0apenio3tydfm2ranvs;u)aexrmrctytopDr uvolt s2uo(r iu1lmtnmfet s) Drax o;o1tee iictls m2uauvs t0treoxr todlptelnei;s)setrir no4amenmncsa(fs2rm(mpot1tlt moetyd mDemnmont0artnxf ta1omtr nvolt texoiopnu4lmt mfcsat  rtaur oo4opxniociatla2umums (4aexrif3iatopD aivsl(0s2xrir3no4lmenmivt tfa2rm(m ;t1olxoiictldla emnvon(0alerirciodfatr uvs;s) 2trim3nydol elivtlt sruau p;t1openif3tltfa rmums (0 rxniocoa1laDeaiei s0s2xmxopio4omte neslt  Dumx  ou4tlx ii3iysfsDumnvo u)trtomr3iadlpDe u i s0 exm(m3oy4lptelfvslsfs2umu o;o0tlx iociyslm raump t0 eeoif3ootoate i ols0setoxopno4lltnmfvil(f rra(m ot1tltn octytls2elumo ()texnifcootlp r uvi;s0 2trxo oydoleelnvi t)sDrr( pou1apto ociadla2um( pnu0 etoxo todlaD aivslt0tetr(r3oydoptnlnvslt aDumuro;o0oeto fetasla uauvp (0 rxoir3tatlmD lnvi;()texmxr3oo1lle lncs ( s2tru oou0tltomoetas m rl( o;t0 lerio ty1laDean i;t)setmxopiodop e fvtat) rrm(r ou0texn f3tls mDul( o ()texoiociatfmtelueo;(0teurimpio4omt  ies (fsruau o;o0tpe mi3ildfmDra(vpnt4 ltnxf3tadoaDelnes t truoxopiu4ap emnctl(  Drrx p;o1alxnii3ilsfaDuanms;(0trerxo todlptr nvol() 2toxo3oo4optnlnvs s)artr(ro;t0opxoioeiltlmDrlump;t)tlxrif3io1opD lueo;t trtr(o3ou1llt  fvsl( arurxm nt4oee mf3iad aDul(mpn(4 ltnio oy1fpt aivo () rtm(m3oudlp n fct (fs2urx  ou1oexnioeiatlmDumnmonu4alxoif3tydopDeaueil(  etr(opou4lltnlfcslsfsrtrumo;u4tle  iciyslmDul(ms t)trtnmo3iodop eln s;()srxmxo3io1lm nmneslt)a2umxmp;u4apxomf3iad sDrmu s t0 lxnmr3iodom eluvo;s)srxr(r3nydol  lnvsa()s2tr(mpoo0alt ii3iyd s2rm(monu4 lxoxr oadoat luvolt)s2tm(opiu4lm n nvs s  rtrx o;o1apx ii3iltlmDua( s (4tlxnmf iy1opte u s t0srumim iy1om e fvtat)sruaxr ;t1tpenifciat s eanvs t)trtnxo3oy1op rauvi s0sruoio ny1alte iet tf Drau ono0oeen iciyt m rmnmo;t4altoif3oy1fp e u slt) rurimpou4ol elfciat)s2rax p;t0aeto i3iasfmDrmump u4 rxnxo3oodop eaueilt0trtr(r ou4op n ivs t) 2rrumo;t4aet ifcildfmDum(mp t)aeermoctotopD ai sls seum(r ou1ol elnvtas)arrr(r no4oltoii3ias m emnmsnt)trxnif tatfaDeln o;t texo(opou4ameelnctls a2rrur ;o4oetniieilsla2uan o;t) rtnxrctydopD  u s t) 2ur(o oo4lptemfvil()a2ururpnt0tlxnmf3tydlmDemn pnt4 ltoiociydlmDrli i ()sexr(r3oydalt  fesas srtmum no0tlxo ictadfsDelnmp;t) rtnxo tatfmD lnesls trxm(o ny4lpe mfci sf rtm(rono4alxnmictys mDumump;u0tetrmo3oatfp  lu i;t seuo(opoo1llt micsat  rta(m no4aeen f3tyt m elnvs;u4 etnif3oytlateluvo;()trxo(r io1ll  lnei tfaDur(rpno1aleoifeiytfmDem(mo;t4tltoio3io1lp  livo;t  euoxo iu4amte neil() 2rrxmonu0ole iiciaslaDeau p;u0alxomo3tytlpD liei;() exmxr nudole lncsas)sDrauroot1oexn i3iad m elumsnu0 lxnxr3tadlaD luvi ( tetmir oodolen nct t  rtrxm ou0tlx mf3iasfs ea( on(4 etnxo3tadfm elivs t)s2xmim ny1oltn feils)aDrm(mp;t0tptomieildfsDemu pnt)arermr tatlp e nes;(  2xoirpoo1optn nvsas) Durxm ;u0alx  iciltfsDra(von(0 rxrmf3oy1faDeluei ( trto(mpoy4al elneia() 2ra(rpnt0opeoiieiadfaDua( p;(4arxoir iadoaDr i o;t0srtr(r oo1lm elnetasf Dta(r nu0oltnmfetyd m2rlnmp;(0tetnir oatopt ln o ( s2xmxmpnu4lmee fei (f Drr(r ou1apxn fetls m2emuvsnt)aetoif oy1lp  livs;()t2xo(o3iudop n fvs sf 2tauro;t4apt  o3taslsDrmnmo;t4 rtnmrcootlp  ln sls0 euoxo3oy1aptnmfesl() Dua(ro;u1ape  i3iasfs emuvs;(0alxrmo totfmteanvi t0sexoir3iy1amtelivilt sruru  ;o1olxomieilsfm2el( p () lxomociotlmt lnvols)tetm(rpio4op e fesls) ruau pou4oeenmociasfm2ea(msnu0aetomr oadom  auvs s0t2tr(m oo1apenlictl()artru o;u0aleomf3ildlaDranvsn(4alxnioctydopD lnes;() 2tm(o3nu1ape mfetl()sruau p;t4oltn fcildfm2em(mp t4texnmr3totopDr nvil( seum(r3iu1ol n iesa(faDtrxrpot1aee mieiydfm2rl(ms t4alxrxr todlpt li i t trxrirpnu1om  lies tf 2tm(ro;t4alxo fctadla2eaumpnt)artnmf3oytop  auvilt0t2urxr3nodome  icia(  2rr( o;t4tlen ictad mDumump t4aexnmfcootlmte ivol(0s2toio3oy4lpee nvt s) rum(mo;t0tetnmfetatfs ea(mo;u0 rxoxr3oadomDean o (  2urxo3iu1amtnlieiasf Dta(monu4olxomfctas s rluvonu0 rxoxo3iatlmt anvi;() 2xoio3iu4lle mictlsfsDtrxmp;u1aeeomf3iasfsDrlnvonu)aetrir3oy1op r ueilt0t2xrir ou1lptn ietas sDumumo;u4tptn f3iat a rauvp;u)aleriociotoaD livo;t0t2tmxr io1lmte nes (farraum ou4oeto ictytfa um(mo u)artnmo ta1fat  ivi;t) rtr(m3io1amt  nvtlt  rua( pou1alxnmf3tysla rau p;()arerxr oytlmDe ies ( trxoio iy4lmt mnctasfartaumo;t4tpenmocildlm uauvp;t)trtomrciadla  lueil(0 ruoxm3iu4omtnmnvtls)s2tm( ont0apxnifcias s2rmuvs (4aeenxr3iytlmtrlu o (  2tr(rpou4ap e nctatfaDtr(m no4oleoifciysfm2ranvo (0aetnif3ia1oaDeauvs;( sexm(mpou1lmeemfctat srur( onu1tpxoii3ild m2ulu s (4aleoif iatfm rlivo ( t2xmxo iy1ol elfeiatf rtmxm ;u1tpenioetyslmDrl( o ()treoir3iy1oatraiei t  rxmio3iodom n nvsl() rtrxmoot0tetn oetltla ra( p;(4arxnmo3tytlmDrln i s)texrirpnodamtnlivi sfaDua(mpno1oeeniiciytfm2rmumo t) etrmfciatoa eaivs;s tetoim3iudolenmnesas sDtmuro;u4olx iiciyslm2eanvp t4alenmocoatlp eau i t)setmxmpiydoltemfvt t)s2um(rp;t0ole  fciad sDeluvpn(0 exnif3tytlaD lnes s0srxoir3oy4lmenliesa( aDuaxmo;t0aet ii3iadfmDea(mpn(4 ltrio iydom raueo;()s2tm(r ny1lptnmnetl(f Drm(rono0apxo ociydfa2eaumo (4 rxrmr3todoate nei;t0s2uo(opno4omt mnvsl()sDraxr nu0apen ociasfsDumnmon(0artoxr3totoa   u sls trumio nu1omt lfctas srtaxrp;o1tleoif3iltlaDum(mont4 exomf oodfpDr uei;t0texm(r io4apeelfes (f rumxmpnu4tlxoii3iasls ranvo t4 lerxo todoptelneil(0srxr(o3no4aleemfvi tfs2umx pnt4tlt  oeiatls ulumpnu)texoxf3totfm rluvsl(0s2xoim ou4lle  ivias)srraum ou0oex ioeias mDel(vp;u) ltrxo3tadfp eanvi;t s2ur(opiy4lpt lfctls  Dta( oot4texoioeiydfa2ulnmsnu) exoxf3iydfatrau s ( trtrio3iy4lltn ivs s) 2uru  nt1apt io3tatlsDrmu o;t) rxnmoctytoa e ieo ( s2toio3iu4lmtnmnvslt)srraxmo;o1tptoif3tat m elnvp;() rtrirctytopte ies;()t2xrio oo1amt lneils  rrau pnt4aeeoiietyt s rm( o t4 exnir3iydfpDe u i;t s2tm(rpiy1ame  fvta( s2uaumpnu0tptoif3iytla2rmu snt)altrmrciatlatelu s;s0teum(rpny1omt mietas)aDtaur no1olxnifetatla eaump u4 ltoxr3ia1la e ies;(0s2tr(opiu4omenmfvsls srtmxm ou0aetnmoctld s rlnvp;u0 rxnif ia1opD  ueils0srurxm no4ll nmivia( s2umurono0tpxo iciatls rmnmon(0trxnmocoodomtran o (0 rumxo ny4lptemiesl(farumxmooo4tltomi3ild mDrl( o t0 etoxf iydlptrauvol( trtrxr3no1lpt  fvtas)aDur(rpou0tetnif3tys a rl(mp (0areoxfcoadopDeanei;(0texm(o ou4oltemfvs ( artrxrp;u0tpto o3tyslm2elu pnt0alxomociotoaDe nvslt sexrxopno4al   icsasf Dtm(m ;t0optnifcilt m ulu s u)aexrio3tydoptean i;()sexoio3no4ol nliesltfsDtax o;u1apt  i3iytls2ua( ont0trtoxo to1lp ranvi (0 2uoim oo1ol emnvt s  Durxmp;t0oetn oeiytlm em(ms t4teeomrcoy1lpDraueil(  rurio3oo1ape  ivt ()sDumuroot4oee mo3tld m2eanvsn(0trxoir iy1omt li o s)t2toir ny4al  lfvtlt  2uax  ;u4opxniicildfa2rmn p u)tlxrmo iatlmtr ies;s) 2umxr oodapt mfesl() ruaurpnt0aptnioeiltlaDelnmsn(4 etnmocoo1oa   u o;(0 2xriopno4lpte fvslt) 2ta(ront4aptomiciyd m em( pnu) eenmo3ty1opt  iei;s0t2xm(m3ny4omtnmfvs s  2urx  ;u1aetoifciltlsDumuvo t4arenirctydomtrlnvo t)s2ur(m iydlm nlnctatfsrrmxm nu1apeoii3tlsfa emnmo ()trenmo3totop   neo t)tetrxo3iudlpe mfvtl( arrrx p;o0apen iciltlmDeanmo t4tlxrio3ia1fpD  u ils0 rtrir ou1optnlics ( a2uax o;o0oex  o3ilt mDrm(vo;t4tetnmrcta1lp rai ils t2xrxo3iodlmen ivi t  rrmu  nt1olt mi3tysfm ul(ms t)artrif3oatlmDr i o;t)sexrirpno4altn fvsatf Durxmp;u4optn ieiad s2emnvp;u)trerif3todfaDr neols sruoxm iydap nlfcsltfs2tmxr ou1aee if3tat s2ra( p u0texomr tytomt aueo;s0sexrxo oy4llenmivtlt  rumx o;o4apenifciytfm elnvp;()tetnifciodlatr nes;( t2tm(o3oydap eliei (f 2urxm nt4tleomf3iysfm eaump (4 lxrxf todfmDrln s;t  euoim no1ll emncias arrrxr nu1olxoifctlsfsDem(monu) reoif3ia1fatrauvi;t  2tm(o iu4oltnmneiat aDurxmpot0aeeo ietaslaDul( p;t) lxnmr3oytomte n i t seto(mpio1olen fvilt)arrmuro;o1oexnmicild m uan p (0texnir oodlaDe uei s) 2umio3iudoptelfviasfsDumu  nt1ale mieiatla2rl( ont0 etnxfciydlaDe neil()texm(rpoo4apenlfvs (fs2rm(mono0apxniieiydls2umumo;(4 lermr3ootom  anvsls  exrimpoydom e fes t)aDrr(ront4opt mi3tasfsDua( o;t) eerio iatlpDr i s s t2xrio3oudol e fctatf Duauro;o0ope ii3tysfmDrlnms;u) reoif totfm eli s;()srxr(o iy4olenlnvtatfartmurpou0apenmo3ildfm rm(mo u4 lenxrcty1fa r ieolt)seto(o3nu1alt mnetat a2rmu  ;u4aee mi3ilsfm elnvo (0arxomr ty1om rlnvslt0s2xoxrpiydlmenlfcs s srtr(rp;o1apeo oeias sDumnmp;(4tlenmo3tadlp  lueo s0s2xrir3nu1amt  ietl(f Dur(mono1tle moetltfm rm(vsnu)arxoif3totlaDrlu ils s2tr(r3oo4lle mietls) Drax  nu4tpt  octys mDemnvp ()tetnxrcoytfa rlu s ( srto(r3iu4aleelics tfarumumo;o0olxnmicias aDelnmon(4aetoxr3ty1fp eanvs t0 2ur(opoudolee ies () 2taurpoo0aeen fcildlmDeau s u0aeenxo iodopD au o s0s2xo(r oy4openmicsl() 2umxr nu4teen fctytls eluvs u)trxoircio1fpD lueo t)srtoxo oy1ole  fcsasfs2rrurp;t4altnmfetyt m ulnmp u0texomfciadopD  ieil()trto(m3ou4ope mnetltfaDtrx pno4tlxnmieiad m eau pn()teerxr3iy1oa   uvi;(0s2xoxr iu1amt lnvilt)sDur( o;u4tlt  oeiadls ul(ms;t0 exrmfctotlaD an slt0 eur(rpio1ape  nvsas sruau ooo0teen oeildfmDeluvs t)alxrifciadlatelueo;() etrxr oudol nlivta(f Dtm(mpoo1ape ifcildfm2em( p;t4 exnir oadfa e ivi;() 2xm(m3io4lmte ieil()s2rau  ot1aexnmoctat a2rlnms t4 exrif oytfaDrlueol(0srtmim3nodomtnmnei t) rumum ;t4ope mo3tldlm2ul( p (0teeomrctatlm rlnvils)t2xoio3iu1apt lfvs t) 2um(ro;u4apenmf3iytfm ea(vo t4aexrif3oodom   ieo (0t2tm(o oy4ll nmnvias)artrumpou1oex io3iasfaDeauvp;t4tetoif iotlmDeln ols)teur(mpio1amtnmieta(fsrrru o;o4tptnif3iatfaDemu p;(4 lxrir tydom elivol()srumxm iu4ope mnctas  Draurpnt0oltnioeiltfsDulnvonu4texomo iadfm r nvolt)srurxm3oy1lmt mfcsa(f 2trx  ;t4apeo ieiasfmDra( o (4teermo tatla  auei;s0t2xmxrpoo4ap nlnct t)aDurxm ot0aetn feiltlaDumnvp u) rxoxr oydoat  i s;t0srtm(o3ou4amee fvsl()sDtmu ooo1opxniieiatls2el(mon()trxrmr3iotlatrluvi;t0srtmir3nu4lpe  feils)sDraumooo4teenioeiytfaDrm(vp;u)tlermf tadlpteln i s0srxm(m oo1altemfesl() ruaur ou1altnmfctytfm rmu onu0 ltoxocoo1optran s;(0s2xo(o oudalt mnvil(faDuaurp;t4opt iieiltlmDelnvo;u)aeeoif oodlat  ueo;s srxrxr iy1omeelfvs ()a2uax oou0oeto i3tldfm2rauvs;u)trxnif3oodfp  aneo;s)trxrxr no4ap e fesas) Dtaxmpou1aexniietadfs eau ont)alxnmr tytlaDr i ilt) rtm(m ou1lleemivsas)artmxmo;t1tpeo feiydls rmnvo (4 renmrcio1lpD aieol() 2xrxm3ny1apt mfet ()s2rmuro;t0olt  iciadfs2umnms;t0treoifctodomteauvs t setoim iu1lm emfes () 2tr(r ;t1opto f3iydlmDua( o;u4 ltnir3oy1om   ivo t)seum(m3iu1oleemies (  Dra(m ot0opx iocild a ua( p t0tltrir iodfm r neols)s2urxmpnu1om n nvtat a2um(mpoo0aexoif3ilsfa elumsn()altrmr oo1la rln sl(0 2ur(rpoy4olt livsas aDum(r no0tlenmietls m eaump u) lxnif3to1laDeli i;() rxoxo3ny1amenmfet ( sDrr( p;t1teto o3tat mDulu p t0 lerioctatlmtrlies t trtoirpnudap nmictls s2tm(mooo4aee  fcilsfa2elumsn()arxnmo3ty1fat livslt setrxr oodlp nlnvt ()aDumumpou1olto o3iyd m umnvo;u0tlxoxo oodlmt  ivo t srur(rpnodap nlieia(  2tr( p;u1tex mo3ilsfs uan o u) rtnxo3oo1lmt lieil( srtmiopou4lm elncsl()s2uaurp;o0alto feiyt a2uauvp ()teermo3oadfpte neo;()setmir3ou1ol elivtltfa2uaurpoo4opeomfetlsla rlu o;(4alerio ootoa eln s;s)texr(m oy4apenmiviat) Dur(root4olxnmiciadlmDranvsn(4altnxf iy1oat an slt0srxmxm3oy4amtn fviat arurxmp;t0aetnioeiys m ean o;(0trerxr totopDraivi s seum(m3iodlpte nctatfartru pnu1tetnmfctltlm2rauvsnu) lerir3oy1fmDeaneol()tetmir3iu4ol  lfciasfartmx oot1opt ifeiyslmDrmuvp t0 lenmo to1lmtrlivo t0 2xriopny1lmtnmneiltf 2ta(root4ape  octld sDemn sn(0arxoxf iy1latr ies;( setoxo3oy4oleelfvi tfa2ururo;o1tptniocilt sDulnvonu0 lxnmr iotop  an i (0 2uo(o3iodal emfcsa( aDur(mont0alxomieiadlm emuvo;()tlxrxr3iadfptelues t0s2uoiopnudoleemnesa(fa2uaurpno1altomfetadla2rmnvo;(4tltoircoodop ranei s)srtoxo3oy1amtemietas  rtaxrp;o4oex ifctys m2ra(mont4 rtrxf3ootoaDrlivols sexrirpou4lmenmneiat s2uax p;t4ale iiciatfmDrlums t0aleoir3ty1oat aiei;t)sexr(r oydopeelfei t)s2rmx  ;o0altoiieild a ea(mo (4aleoxfciodlpt livsl(0s2urxm3io1ol emictlt s2tmurpot4tee mieiysfa2umn p u0 eerxr tydomt  iei;(0t2uoio iodolee ict (  2rm(r ;t0oexn o3taslmDrln pnt0aexrio3oodlaDe n o;(0trumxopno1lptelnctlsf 2rmx  ot0opx mf3tas m eanmsnu) rerif3totlm  aues;t)seurxo iydapt mics sfsDraumpoo4aexniociydlm2uanvp u0aeenif oy1la r ues;t  2uoxr3nu1ol   fcs (f rrm(mono4tpeomi3iytfa2rmumon(0 ltrio3io1fmte uvo s)s2xrio nu4alenlfvils)a2ururpot0oeeo i3iyd sDemuvont)teenir3todfaDeln o s0t2xm(opnudomt mnciltfsDtrumpnt4tpeo o3tls s2ranvpnu)aeeoxo oodlm  lu i (  2umir oy4opt lnetat  rumxrpou4tlx  iciatfaDrmn sn(4tltnir oytlat lu o (0s2to(opiu4omeemietls)a2rmurpno0tlxoifciasfm2emnmsnu)aexrmr oytop rlieo;( setm(o3ou4amt mnvtas srrr( p;u4apt  i3iadfm eaums;(4arermo3oadlmDeluvsl()teurimpou4lpt  fvsatfa2uaxmpnu4aeeomoctasfa el( p (4tetoif3ootfpte ues (0 2umimpoudllt  ivils) 2tr(  ot1tpeoiieild a rl(vs;t0 reomfcoy1fm r n i;()t2ur(r3no4lmt mieta() 2ur( poo4oee if3iytlmDel(vsnu0 lxrmr3oydlmt  ivs;(0trxmxo iu1omeelfciat)sDtm(roou1apx ioctatla ulu on(4tlenxoctytfmt anvsls)trum(rpiy4ap  mnvtas sDumxmp;t4aexn o3iyt s uaumo t0alenir3ta1opD an s s  2to(opnodllt  fes (f rurxmo;u1aeeoiicilsls rmu s u0tltrmfciatla eauvols0 2tm(m iy4apenmieil( sDtrxm ;o1tetomoctatls2emump u4artrmr3oadlm raneil(0texmxo no4om  mict (fs2trumont1tlxomoctas s2emu o;(4tleoxr3tadlpDelu s t sexoirpnu4omt  fes t)sDta(root1olxnmo3ilt mDranvp;(0 lenio tytoat li o t)texoxmpnydopenlnetls aDumu pnt0opto ieiydlaDulnmp;(0aexnmo3oydoptranvil(0 etmxm3no1op e icia(farurxrpot4ape ioctadlm2ranmont4 exomo3iatop eaiesl( srtmim ny4apteliei s a2umx onu4tlto oetatla uaump u)trtrxr3oa1om r uei;()t2toxopiudll nmiei (fsrur(rono1altn icild sDeauvsnt0artrxrciydlm elnes (0truoim oodlme mfct ( s2rrx  ;u1alto oeiyd m uluvsn(0 lerir3oy1omD lueols0 rtmiopoo1lmtn fvt ()artr(mpot0altoiieilt sDraums t4treoifciydlm  aivi t)sexmio iy4omt licsa(f 2trxm no4tpx ioetlslm ran pnu0alxnxr3iadfp rliei;() rtr(o3oo4ap elnvia(  rurx  ;t4tex mf3iltfs ua(ms;u4aeeoxf3tadfat  neslt teur(mpoo1lptnlfesltfa2ra(ro;u1opxomi3ild m2ulu onu0alermf iatfa eanvsl(0 eto(r3nu4alenliesas  rtrxm no1tptn ictls aDrl(vo;t0aetrxf ty1oa e n i;s0 ruo(o iudlpeemncsasfsDur(rp;o0aeenmoetatfaDranvsnt4altrxr tatfaD liei s srxr(m3ny1ol nmfetls)arrmx  ;t1oltoioeiltlm ulnmpnu4arenxo3iytopDeaues;()teur(o oodoltemivias) Drr(  nu4apto f3iatlmDraums;()aeerxrctatfmDr nvils0 etr(o ny1lpe lnetl() rrax pou1oeeo feils s uauvo u)tetoxocio1opt lieo;s0truoio nudaptnmnvilsfaDtmxrp;u1ole  ociytlm2rm( on()arenio iatlptrln ilt0setrir3ny1am nlnvsls)arumu o;o4oee  ictytfa2ua(vsnt4tlenxfcoytfp ran o t) rto(rpny1alenlnetat) Dumxmoou4tetnifctys s rlu pnu)teeoxf todfpDrluvilt  euo(r nudalte nctl(f rtru pou4aptnif3iltls rl(ms;()aetrmr3tytoa rln s;s tetm(m nodlpt lies tfarrmuront4aptoii3iasfa em(mo;(4tlenmociatfpDr uvol( t2triopiu1ol n fci sfartm(mo;u1tle moeiad sDuauvp;u4 ltrmo3oa1lmt li o s)texrxo3iu4ope mics ( s2ua(  oo4oleoiiciytla rlumpnu4texoifctydoaDr ueo;s s2xmxr ou4alenmfciltf rtmxr nu1tltomoetat mDrm( o;t0tleoio tadlm raues;t  eumir3iu4lpen ieiat aDtmxrpnu0apt ifctyt m2um(mp;(0aeerifciytomD  nvolt) 2umirpnydlm emfeils) 2umxrpnu1ale ii3iadlsDel(vs;(4 etrmf oytoaDraneils teumxopiy4lmeemfctls  rtrxmpot1tltnmfciaslm2ea(ms (4tlermr ootfatelnvolt)srxrir3nu1altelicsatf Dur( oot1tpxnmieiytls rmu o;u)aleoxrcta1lmD  ivols)srum(r oodom nlfei sfsrtaxmpoo4opx ifeias aDrmu p;()aetoio iy1oaD aivi;()setmio3iy1aptnlieil()s2ta( ooo4tlxomictatlm ua( on(4 etoio3ootomD au o;(0truo(opiu1lmt  nvtasf 2ua(rpnu4alt iociatlsDrmnvs;u)alenxo ia1lmt livo;t)trum(o no4al  lnvi t srumur ot0tpx  f3tltfmDumnmp;(4 eeoifcoadlpDrln s s0 exrim no1opt mfci ()s2ra(mp;o4optn iciadlm2rl(ms;u)aleoxr iodopDrau ilt)sexrxrpou4ameemivsat  Drrx  ot0alx  fctyd s2ean s;t0aexrxo3oatlp eau ol()trxm(opiydlm nlfes (  2um(m nt0alxnmf3tas m rlu on()arenifcoy1faDeai s (  etrimpnydapt lfes (  Dtmurp;t0ope mi3tatfa2em(mp t4 ltrir3totlp   neslt0 ruoio oo4llteliciatf rrmu pot1optomfeiyt m rlumo;u)trenxoctydfa r uvi;() rxmxopiodlme mieslt) 2ur(rp;t0tlx  oetldlsDrau on()altoiociatoptelnesls0 rxo(r iodoleelivt sf 2uax o;u0tee io3tldla2uau p;t) lxrio ia1fa e uvi;s)seuoxo iu4optnlnei tf Dur(mp;u4oetnifciydlaDul(von(4tetoio iodfp ranvs;s  rtrirpiu4am n neiatfaDtm(m ;o0tpe iictltfs elnvsn()aexrio totop e neols0srxm(m no1apt mivs sf 2rr( o;t1oet  o3ilslm2rmnvp (0 reoxr3oadom rln o;( tetmxo3oudal elieil( s2rr(root1open feiasla em(vpnt)tlenxr3oytfa r u o s0t2um(r io4op emfvsa( sDra( oot1tee  i3tldls rau s;u4tlenxr iotoa  lneol(0s2xmxrpnudap nlfvsat  Dtrxm no1aex  fetatfm2ulu pn(0 exrmr ootfm raues (0 2umimpny4al e fcs tfaDua(  nu4oeeomfetldla2umuvs;(4aeeoiocoytlaDeli slt)trtrirpiydlpenlfes (faDrm(mpot0teto fctyd m em(vp;t0 lxnmrctadfm eanvilt0sexo(m oy1ole liesatfsrraumpnt1tlen o3iltfa2umu on()alxomf3iodlp elneilt trto(o3nu4apenlicias)s2ra( p;t0ope mfctlt a emnvp u0texrxrciodom raues s  exmirpiy1lm nmietlt  2rmurpou4apenmo3ils aDuanmo;u) exoif3tytomDrai ol(0s2uoxm iudolenmici t sDtmumont1tet iociaslaDemumo u) renif3oa1oaD an s;s) 2ur(m iy1ol e fvil( sDraxroou4aee moeiyd m2ean p;()trxrxrcootlm  luvo;()truoxo iudll  mfetl( aDtax ooo1tpxoii3ildlmDemnmont0 eeoxr3ty1lp rau s;s)sexrxm3ou1lme  fetl( artmxroot4teen oeiysfmDrl(vo;() ltnir3ia1lpteaneil(0s2xoxmpio1llte ivtas) 2uaxmont1optnmieiatfs um(vsnt)aexnmo3oatlp rlu sl()tetrxo3iu4ope  icta( sruru onu4teeoifeias mDelump (0altnif3ootopDelieo t sexrxm3io1ap elieil( s2raumonu0alx mfeils a2rmnmo t4texnxf3totfpDr n sls0teumxr3ny1ol elnet s aDtax pou1oetn feiyd a2uluvp (4aetrmo3oodfpt lnvols) eumirpoodop n ietl(f Dtm(mpno0ope  f3iltfs ulnvs;t)trxnmr3to1lmtraivs;s0 etoxm oo4amte ivi s) Dtmurpoo1oex if3iltfm2rl( p t0aetnmo ia1lpD  u s s)trtrxm iudlp emfvi s  Dra(moou1ope ifeiasfm2um( s (4 lenxr3tytfm  ai s;t0t2xr(r iy1om  mneil() 2umxrp;t1tltoiocildfm rauvpnu0aleomf ia1fmte ueilt0texoiopno4lpe lict t arrmx  nt4oexnioeiysla rau snu4trtoir ia1op r iei ()trto(rpiu4ap n fvsls) Dtrxr oo0tleo feiadfs ulumo u0 leoif oo1lp  auvi;s trumirpnu4llee nvtasfs2tr(rp;t0oleomiciat s2umn s u4tlxoxf oatlpte i i s0s2tmirpny4olt mfet t  ruru onu4tpe mietltlaDua(ms;u4 etnmo3oydfa  lieilt0 ruoxo iu4omenlivs ( sDtau ont1oleoiiciys mDulnmo u0trtrxociytlate n s;s  etrio oy4open fvsls) rumuroou4opt moetys a2rmu p t4 lxoir3iodomt aivs s)t2uoio iu4ame lics t)srtrxm nt1ole ioetld aDeau o;(0 lxnif3iadfmDelueo;s0 etr(m no4lp nlict (fsrrm(r no1oeenioeiadfs2eaump ()arenmoctatla  auvsl(0sexrimpiu1llte net ( arraump;t4teenmfciad m ea( o;(4 rtrmocoadfatr u i (  rxriopou4ame lncta(faDtmurp;t1tlxnmiciad a rlumsnt0altomoctatoatrluvslt0 euoxm oy1ope mfci s)a2uru pou4ale ifciydfs2rmump;t4 rtoxf oytlpDr nvi ( srumxr iy4llt mnei sfa2taum nt4tpt mi3tydfa2eanms;u0aeenmr oatlmDr u o t0srtmiopiu4optnmfvt s)srum(m ou1oee  f3ilsfmDumn pnu0aeenxr3iotlmtranvslt t2toxmpiu1al nlfetlt  2umxronu4opxn fctydfa ra(vs;u4aexnmf oa1lpDraivs (0texm(r3iy1ale lnvil(f Drr(monu1opeo ietys a ran o;(4arxoxr oadomt aivs;s)srtmir no1lmtnlfetlsfsDua( o;u1optnii3iltlm2el(vo t0 exomocto1fatraneo s  rxmirpiy4am nmici ( srtaur ;u1optoiicildfaDeaums;u)alenio3oytfp   ueo;()seto(r ou4lp  lnes sfs2taxrpoo1teeoioetltfa2uanvsnt0artrxo3ta1omDraneil(0s2trimpnu4opt  fcslt  Dtax  ou0optn oetydfs2eanmsn()teeoxo totfpte i o (0trumiopno1lmen ivslsfa2urxmpot4opx mi3tltla ra( on(4tltrifcoa1lpD  ivs s) etmio3no1opeemici () Dtauront4tptomfetytfaDumuvo t) rtoif3tydlpt  nvs t srxrio3nudal elncsa(f rtmum ;u1tpxomf3iatla2ua(monu) lxnxr3tatopDrli o s  2urimpnydamenmicsltf rum(mont0aee  fcilslmDuau snt4tlxrxo io1fm  li il()s2urxo3oo1lmtn nvt t) 2uaxmo;o1tpx moctld a2em(vpnt4 ltnmf3ta1lm eluvo;s) etr(r oo4lm nmieils aDrr( ont0aex mietlsls2raump t0 exrio io1oate n o;t0 rxrio3nu4lm   ivs ( sDur(mo;o0ole ifciyd s2rm(mp;() rermr iatfa  aivils) 2to(r3ou1lpe mfvtatfa2uaxroot4tlx ifetydfaDulnvp;t0 lxnmfciodop e ivi () exrxm io1lptelnvs ( arumx ono1aex  ociydfm2rlnmpn(0 rxoxocoodopt auvs;s) ruo(r ou1lp n neiat) 2rmum nu1alenmieiltfa ea(mo;() rtrmr to1oat  ueo;(  rxm(o3nydolenmfcs (fsDtr(ront1tet ifctls a emnvo t4 eeoiociatlaDeanvo;s0seurir3oodol n fct s)sDtmxrpoo4texo o3tadfs2ul( p;u) rxrmr3iadla eln s t0 euo(m3ou1omteliei t)aDuauront1texnifcildfs elnmpnu0arxrmo3iotla  anes t teurio oodapenlnesls) 2ur(rpoo4olx ii3tld a2eaump u4aleoxo tadfp eaivi t  rxmxmpiy4altelivilt arum(mo;o0oltoiieilt sDum(mon(0trenmr3oytlateaies () ruoxo3no4al nlietl(  Drm(mono4olto f3iydfmDem(mp t)arerxfcoatopDraiesl(0t2xo(r oudlpt mivsatf rrrxmo;t1olx ifcias s um( p () ltnmo ia1lp eai i;s sexrim3ou4lptemnetas srta(ro;u1oet  icildlmDrl( p;()trxrmf to1lat  uvols setmxm ou4al elnvtl( sDtr(mpnu0oeenmi3tltfa ea(vo;u)artrir3iytlmDr ieslt)teto(r3oy4lle mfeias sruru pnt0oex  oetadfm rln p u)altnmfciodlm  anvo () rur(o3oudllt  ietas)a2tmumpnt1tetoifcilsfs2ra( o;t4 leoxfcia1fm rlies t setoxm3oo4apeemfctls)s2ta(monu1oeto f3iadfmDumn p (0trenir oydfatrai olt0seurir no4amt  ies ()a2tax  ;u4aptoiocils sDelnmo;u)tetoxf tydlptranvsl()s2to(o oy1ap  mfetat a2ta(ro;t4alen ociysfa uau on()tltoxfciytoptraiesls  2xoim3iydopt  ncsat)a2uaumoou0tlx io3iydlm rau ont) rxnxf3oadop  anvi t  rumir no1apeemnct (  2tm( p;t4tle if3tadla2elums ()artnifcto1lmt luvslt seuo(mpnodlmenmneilt) 2rrx  ou4apto oeils m2umu s;(4arxrif3totoaDr iei;s0trto(o nudamenmietatfaDrmx  ou4opt ifeiyt s2elnvont0arenmo oy1fa eanvo t)s2uoir3nudllen feias aDtaumpno4tptoifciytfm eauvsnt)texrirctatfp  an slt trto(r3no1amt  nciatf 2rmum nu4apenmfeias sDrl(vs;()tleoio iodomD au s s t2to(o oodam  mfvsl(fa2raxro;u4optomiciys m2rm( o;u0 eeoxfciodfaDr uei t texo(o3iu1lpee fcta( arur(mo;u0apt  fetatfs2umuvo;t0trtnxr iotopDeli s t)seurxm oydamtnlncta(farua(rp;o4texo f3tyd m rmuvs;t)tetrxfciadfmD ai ilt) rxmxm3nudole  nci sfs2tru ooo1alx  octlt s rm(ms;(4arxoxf3oa1fmtrli ols0setr(r3oodll  lfetatfsDraxr ;o4oexnmfciys sDelu snt)aetnxr3tydoatraueol(0t2xm(rpiydlmeelfet ( sDrrx o;u1tpe io3tyt sDrluvsn(0 etnio3io1opt auvs s sexmxm io1lltnlieia(  Dtax  no1teen i3iatfaDem(mo t4trxrxrctydfp eauvil(  rumir3oudlpenlfciatfs2ur(r oo1tlxnmf3ildlaDuanvpn(4aetomr todfmD  ueo s0 2xr(opou4op elfctat  2ur(m ot0alxomiciytlsDran pnu4teenir3oy1opDe n s t)tetrxm iy4lp  lfeiat sDraxmooo4opx mociys m2el(ms () eeomfcoo1fpte n sls) etrimpno4olenlfeilt srtm(mpnt0alxomoeild mDulu s u)alxoif3tydoptrluvi t)trum(m nu1amt mnct sfsDtru p;t4oexniociasls eluvp;()areomf oo1omDrluvols)seumxr oo1omeelici ()s2raxronu4tex mocildfm ulnmon(0 rxoif3ty1oa eanvols  2um(o oo1lpe  ies t s2um(r oo1teeomf3tad s2umnvs;t4tltrxr oa1oat aivo t0 eur(mpou4op  mfeiatf rumxrpou1oexomocilt m rluvo t) lxrxr iotfmtr n o;t  2umxopno4apt mnei t  2rmum ;o0oee iociatla umn p (0aexoircto1fp r ueo s0seuo(r oydomt lfeilsf 2ua(mont1tetniiciytfa2ua(von(0texoir3tatfpteln i s seto(opny4aptn ivta(fsDua(r ;u1oeto ocildlm2emu on(4tltnir3oy1om rli ils0 2umxm3iy4am emivtatfartrx  ou4opxnmo3iaslsDuluvp u) ltnmrciy1omDeai o;s0t2um(o3iydll nmieia(  Drrxro;o4texn ictydfmDrmnmon(4aetrio iatoptrlivs s0 etmirpoydalenlfvt t) rtrx  ;u4tptnmfeild m rlnmo u0trxoxfcia1fat  neolt)truoimpoy4lm  lfct sf 2uau  ;t0tlenioctas m rm(ms ()tetoxrcoo1omt aneo;t tetoxo3iy1apen fvi s)s2tax  nt4aetomo3iadfa2eluvont)artrxoctotfp   uvs;t0texm(r3ny1omen ncilt) rta(moou1tpxnmociydlaDrmnmo u4aetoxf iotlptrlu o;t) eur(opnodam n ietlt) rraumpnt4tpxomiciat sDel( o;()teeoxociodoaD aivi;s0t2tm(r oodllen fetl(fsDtax  no4tlx mo3ildfm2rlu o u4trtomo ia1opDeli olt0 rtr(m3ny1ap n ictlt arrruroot1oexnmieiytfm2ranmo;t0 lenxf iatlp ranei s  rtoxr nu1lmenmnvs (farua(rp;u4tlenifeiad s2rln on() rtomrctydfat lu i;t trxoxm3io4amt lneta()arrm(  no1apt io3iydfs2elu p u4trxrmocio1fmt lnvil(0srtm(r oy1aleelfes t srur(m nt1aetomietldfsDumn p u0tltrxr3tydoaD ai o;t t2uoio iu4lltelncsa(  2umu o;u1aetn iciytfm2el( onu4 rtoio io1opD anvi ()trurxopnu1lpee ivsa(fs2tr(r ot1apeoioctasfs2umuvs;t0arenmfcto1oaD aneols0seurir nydamtelfvsl(fa2tr(mp;u1aexn i3iyd m2rlnvp (4 lxnxocta1fmt  neo (0 2xoxrpnu1lpe  fvt sf rrmxm ou1oetoioeiadfm2ranvont)arxomr3iytomDean o;s0s2urxo3iy1amtnmnet (fa2umu pno4tpxniieilsfsDrm(ms u0trxnmr3iy1fmDelnvi;t t2xo(o iu4opt mfes (f Dta(  ou1aleoiociatfmDum(vp;t) rxriocoy1lateli s;s)teumir nudaptnlivilt)s2ra(m nu1tetnmociyd m em(mo (4tlxomf oytoptrau slt)trtmimpny1altemfvs (  2tm( poo4tpeo o3iasfm rmuvo;t4tltoif3todlaDrlu sl(  rtmxo nodllenlnvtlt arraumpot4aet  fetas aDrau o;u)tltnxo iytfpDr u s;s srxmimpoy4lm eliet ( srtaur ou1olxn oeiatlm2um( s t4 eerio todoateluvils t2xmio3oydaptn iei t s2umxmp;o1tee mf3iytlsDemumsnt) leoxf oy1fm rlueolt0srtoxr iydomeelies sf Draxr nt1tlenmf3tasfaDemu o;(4texrmf3tadfaD auvs s)setrxm3oy4lmt lfcs sfsDtax ono0apxoiieias s2umnmp u4 rxoxocoo1opDrauvi s) 2toxr3io1llt  icilt sDraur no4oltomi3tasfmDrmn p t0aetnxo ootoatrlu i (  euo(o iodopeelnvt s  Drrx p;t4opxnif3iaslaDeaumo;t)aexoxr3oadlp   iei s sexr(opny1ape lncsa() Dtmxmo;u0optoio3iytfm emnvp;(0 eeoif3oy1lmDe nei;t0 etmxmpnu4om  mnvta() Durxr no4alto oeiltlm ua(vs;u)arenifciytlmDrai sl( tetrxo ny1ll  mfcslt)s2rrxr ;t4tleoii3iltls um(mo u0alxnmo3iotoat li i;(0srumxm3oy1al n fcs ( sruaurp;u1teeniocilt a elu p (0arxoifctodfpt  n i t) eum(opio1omeelictatf 2um(mp;u0olenmiciatfa2ua(ms () lxrmr ootopDeaneo;s0 exr(o3oo4lmt  feil()aruaumo;u1oexnifcias s umu p u4aeerxr iadlaD  uvi;s0srxr(rpoo1altnlivta(fs2raum nt4tltnifetld sDeanvo u4arenir to1oaDeauvi s srtrxm oodlltemfvsl( aDur(rp;o1olxnmieildfaDemuvp u4trtrmf3oytlat  uvol()s2xoxo3oo4lme lfvi s)sDrm(rooo0openif3iydlmDrlump;(0teeniociadfa rai o ( trtr(r3nydal nlivsat  2tau  ;u0tptnio3iatls2rmnvs;t0 rxoxfcoa1fmtran o;s texm(m3oudlpe lfctl(farrmx p;t0oeto ociadfmDraumon(0trxnio tatlmt anvs;()sruoxo iu1aptnmfvi s)arumurooo4tptnioetltfa2umums;u0 etomrciotlat  i i t)t2xrio iodomte net sf 2trx pot4aexn o3tadfm em(mp u) rxoif3tytfpte u ol(0seumio iy1apt micslsfsruax  ot1tet mociadlsDrau ont4tetrxr iy1lmDrluvils) exr(mpnydlmenmicilt s2tm(rp;u4tex mo3iltfa emnvp;u0arenmr oa1op eai sls)sruoxo3ny1lp elfvsat  Dta(rpou4tlenif3iatfa2elnvo t)tetnir io1lp r nvo s  exrxo oy4ol nmnvslsf 2raxrooo4tee  ieiasfa2elnmp ()altrxf oatfmDr uvol( truoir oo4lptnmivsat)sDtaxm no0opxnio3tltfsDem(vpnt) ltrxf oo1lmDeaivo t0 exrxo3no4omeelfcils)srtr(moot1aexnifciat a2eauvo;(0aexrmfcoadla  ln s ( texoir nu1omt  ivil( srurxmoot1oexomo3tasfaDemnvo;u4altrir3ta1fp rlnvs;t)trtrxo3no4lptn fvsl( aDur(m ou0aexnif3iydlsDrm(vp;u)artnir3ootfmDelnvs;t) euoxopnodlptnlfcil(faDur(mpnu0tlxnmiciysfs uaumonu0arxomfctotoa eaueo;(  eum(opou4lm  lfvs s a2ta( ono1open i3iltlsDrlnvo;u4texoio oytlp  lneslt t2umxm iydap nlicsat sDua(  no0aeenioeiyt aDemuvsnt4aexrioctatopD livilt) 2toio3oo1olt mivil(  2trumpnu0tleoiietltls2ua( s;(0arxnmo to1om eaues;(0setrimpoo1omenlnei t) Drax  ot0texnmfcild s emnmont4tlenxf to1fmt anei;t) rumxr ny1lpte nvtas aruru p;u0ale ifcilsfmDem(mp t)tltrmrcoydlm ranesls0 exr(rpny4lmtemfet tfsDurxmont0oexnifciyslaDemumo t0trtrxoctatopte uei;t  ruoxm nu4ap nlnei s)aDtm(rpoo4texnmo3iltlm2ulnmpnu0treomr oydoa  ln s ( texoir iydol n fvt (  2rmxmooo4opx ifetadlm2elnvs;u0trxomr oa1fm  luei s srtm(r no4alenlncilt)aDtm( p;o1aetoiocildfa2rmnvp;t4 renmr tatfmt ai o s) rur(rpoy4ol n nvi s aDtrxmono4tle  o3iad a rmnvonu0 eeoxo3oatlpDrlnvo;(0trtr(r3io1lle  nviat  Duaxm no4tpto ieiasla2el(mon(0 eenmocto1fp e nei;s0tetoxr3ou1lle mfct ( s2umu onu1olt mf3iltfa el( p;(0 renmfctodlp   i s;s0srxoiopoo4lmt  ictls) rur(roou0tle  i3iytfsDrmu o;t4trxrxr ty1lm  ai sl(0trtmxrpnu1ap   nviat a2umxr nt4ole moeiytfmDelnvs (4trxomfcio1laDranesl(0sexoxm3oy1op e fctl()sDrmxr ;u4aeeomf3ilsla2ranvp;u4arermocia1fpDeanvi;( teum(mpiy4ol nlncsasf rra(rp;u1oltoiieils sDelnvp u4trenir ootfp rlnei ()trxrxrpnu4omee fci (fsruaxmonu0opx  fetls m umu ont0 rxnir iotomD anes s0 rumirpoy1lmeelfciasfarrmu p;u1tet  fctytfmDum(vp;u) eermr iydop eln i;t) rurimpou1apt mivias aDuaxrpoo4tetniociat s em(vsnu4 ltomf iadfm  ai ils t2tr(o3iydlptnlfctl()arra(m no0tpxnmictltfs2el( s (4 eeriocta1fatr uvilt)srxo(o io1lptn fvt sf Duaxr ;t4opt mfcilt aDumnmo;(4 ltoiocia1fm eaivo;()t2tmiopio1am nlfcil()sDurx  nt4teenmociasfs2em(mpnu4artnxfciatlpteaueo;(0trxoxm3iu4lpt lnvils)sDurur ;u1tpeo oeiyslsDrmumont0tltrmr3iytop eaies t)trto(mpno1omtn icia(f Draxm ;o4tpe mf3tldlmDrlnms u4aexrmrcootfa   uvs s0trto(r iu1omt lieia(f rrax  ;u4tptomieiatlsDem( pnu)altnir3ia1optelnvil()srtr(opoodllen fetlt)a2raumpnt1tlxn ociad a ulumo;t0artoif iy1lateln s;t0 rtoxo3oo4ame mieil(fsDum(mont0olxo f3tyt sDrluvp;u)texoifcoy1laDelnvs;()t2trir no1lm   nci s)a2rr(rp;t4tlen iciasla2rm(vs u4 ltrmr iotom eaues t0t2trxm nydopeelieil(fsDtrxr ;t1tet mietytlm2ulnms u)tetoxr3iydopt aies;s  2uoxrpio4omenmfes ()a2umumont0alt  fcilt a2rlnmsnt0 lxrxrcoytoaDeaueo t0seuoiopoo1lpee ictas s2ta(mono0tlto feiatfm2ul( pnt) rtoir3io1oaD lieols)t2xmir iydapenlfctlt sDrm( o;o1oleoifciytlm ulnms t) rxrxrcoodlptr ivsls) etrim iu4ol elivt sf Drmxr nu1oetnifctys m elumo u4 eermf oydlm   ies s0 2uoir3iodalee fvsa()a2ur(moou4aptn f3tlt s rlu o;(4 eeoxrcoatomtr ues s) rxr(mpiodaltemfviatfsDrrxrooo0tle mietadla el(vo;t4alenxf3tatla  ai ols)s2xmxm3ou4ll elfeiltfa2ururpnu1tltomi3iydlm rmnvp (0alenifciatlat ai sl( sexmxr ou4ame  fviasf rur(mp;t0tpxnmfciltlsDem(vp;u) rxrxf3oatop ranvo;()texmim oo4lm   fesatfaruaur ;t0alxomoeiydfa el(vs;u0teeomrciy1fpte uvi;t)trxoxm3io1omenmneia(fa2rmum ot0tpxomociyd a2umnvont4 renirciatoatrlu i s)s2urxr3iydlp elnvtatfs2ururono1aex mictad s2umumon(4tleoxoctotfmt aueolt) euoxo3no4lmtemivt (f rururpoo4apxomfetasfs2ranvs;(0tetrxf3iatfpDr ues;s  rxo(r iydomtn feta( s2raxro;u4tleoiictadfmDem( s u)tlermf3oadfaDrau sls0 rxrxmpnu1alenliviat aDrr(rp;o4alxnmi3iyd a2ra( o (4aetnxr3iatoa r i s;(0srumiopiudol  lici t)srrax pou4oleniieilsls2uluvp u) renxr3tadopD liei ()srurio3nu4apenmici ()srrrxr ;o1aex if3iyt mDra( o;u)aetrio3io1fmDrai sls0s2trxr oodame mict s s2tmxro;t1oex iictysfm emu pn(0 lenxr iy1fa  ln s t) 2xrir3nu1lp   ivsasfsDrr(m no0apen fcilt a2ranvonu0 eeoif iydfatrauvi s srumim3oodlptemfvsls)a2rmxmo;t1aex if3iyslm eau o;t)trtrxocoy1lp raieils trurxopiu1op  mnesat artauronu4tpt mf3iyt aDean o t4 eeoir3oy1lmte ivol()texoir3iudllt lfvtat a2ur(m nu4tpxnmictytls2rm( p;u4aexoirctotlptraneo;t)trtoim oo4omen nvsltf Dumur ot0olx mietaslm emnvsnu0trxomo3oy1fmDelu o;t) exm(m3ou4opee nvsl( srtr(ronu0apxo ieias s2rmnmo;u0tlxnifciydla rai s;() 2to(mpny4omt mivias aDrmxro;o0tetnmieiys s emu ont)areomrcoadfpD lieilt0 2xoxrpny4opt  fetltfa2rmu pnt1tetnio3iasfs rauvp t0teenxf3iotlp   ies;t0t2xoxm3ny4lmt lfvsl()sruaum ;t0aeeoif3iad s uaums;u0 exrif iydopte ieil() rxoirpnodop emncil(fsrtrxmo;o4oexnmo3tydlmDrmumsnu)arxrmf3ootopt ai i t setoim iu1ap n iei sf 2rm(  ;t4aexnmi3tltfm uanvp (0alxoxr3ta1lp e uvo;t)teur(m iu4amtelfei (  Dumx o;o4ole miciyd aDea(mp;t0tlermrciydfmDr ueo t srxmxr3oudame lneiatf rrmxrp;u0opxoioctysls ul(vpnu4 lxrifciy1op rlnvo ()s2umxo3iydapeemivt (  rumxmpnt0aeeniietys m2umn o;(0trtniocoadfaD ai ols)tetm(mpoo1omtelncs t)s2tau  nu0tltomfcias s uan p (4 ltoif3iydfptran i;t trurxmpio4ol n ncslsf Dtr(r ot0tpxomf3tyt a2uluvp t4teeomo3ta1lmtr i ol( trxrxr oodlmte fcsasf 2umumpot0aexn f3tytla umuvp u)aetoxfcta1fmDe ivo t)sruoxm3iudlm emiet tfartau ooo4oex ifetat a ua(vs u)tetomr3ta1omteaivi (0 2ur(m3oo1open nciat)s2um( p;u4optniocild s uaumo (4 ltnxfcty1fa rluvo;(0texmim no1lm emfctas s2raxmoou1opxnmo3tytfaDuanvp;(4aetoxf iytopD an s;(  2uoxmpiy4lmt lfvsl( srumx  oo0texo fetldfa2rln p;(0alxrxo3to1lm   nvolt0t2xoxopoo4amte ivtl() Dumuro;u4aexo f3iasls ulnvs;t)texomf3tydoatelieo;(  rxrim3io1ll e fet t  2raum ;u0tptomieiltlaDran snt4texnif3ta1oa   n ol(0 2urio3ny4aptn ieil(f 2raxmp;o0oexomoeiytfsDuanms;u0 ltrxf oodoptr ivo t0 2urim oudopee ncs t aDra(  oo0oee ifctytlsDrm(mpn(0 ltoio3ta1lm  auvs (0trtoxopio1ap n fctls)sDtax p;u1oexniictlslsDelnmpnt)tlxrxo iodoa r i s;t0t2xmim3no4om n netls)srua(mono0tptnmo3iad a emumon(4altnio oa1faDe n i;s  eurxm nu4ll e ivt s arrrx pot4apeniiciatlm2rlump;() eeoio3io1oaD  u o;( srxrxo no1lm nlfet (f rtaxmp;t0oee  i3tldfs rauvs u)areoiocia1omtraiei s seur(mpiu1olenmfeiat)sDuax p;o1opeo oetys a rmnmo u0treoxo ty1op r u sls trxm(rpoodap  mnet sfarrru  ;o4opx mietlt a2ul(mont) eeoxf3oydfm   ivo;t  ruoim ny4ole mnei t a2uauronu4ope  fetatfa umnmont0aeerio ty1lpD ai sl(  2trimpnu1am  mneias) rrm( ono4aleoifeiytlsDuln o;t4 etnxf3ta1lp raieils srtmxm3oydop  lietat) 2um( pno4alt if3iytlsDumnmo (0 rxrxrctadlatrlu i t0seur(r3iydom  lics s a2tm(mono1alenmoeiltfm2el(vo (0 renmrcia1fpt an il()t2trir3oo4omt  fvia(fsrra( poo1apxoii3iatlmDumu onu4tetnxr3tytlptr i ols)t2xoio3oudomenlncil(fs2umx ont0ole if3ilsfa2ranmo;t) rerir oodlatrluvi s0seurimpnudlme mieias  2rrumoot1aexn fciys m uau o (4 etoxf oo1la  aivils0 euo(r3ou4llt mivil(fs2rmxmp;o4alxnmiciad a2eauvo t4 exnir3oa1om   uvilt0srxo(o3no4ll n nvtasf Drrxr ou1olt if3iadlm rm(vo (4 exrmf ia1omt livo;(0seur(opno1lle livt ( aDtmxmpot4apt mictlsls2uau o t4aeeoio3todlpD  n s;()t2tmim nodome  neia() rrax  ;t1aexnioetytlmDuln s;(0 ltrmr3tydoatr u o;(0 rxoxo oudame  ieta( aDrru  ;u1oeeo o3iasls2em(vs;t) ltoifciotoate ivo;(0trxmxm ou1lmtnlfvtlsfarurxr ;t0opt iiciyd s2rlu sn()trxrxociatfaDelivs t)trxrxm io1lme mnvt t  rururpou4apt io3iydla2rl(vs;u4 etnmociadlp  lnes (0 rtmiopnodap elfcs (f rtmx pno4altnmo3tys m uauvo;(4tlxrxr tytfpt liesls0srtrxm3iy1om   fviltfartmuro;u0aleomfcilsfa emn sn(0 reomo oatlm r u sls0tetoxopoy1apenmncilt aDtr( p;t0aexomfctad aDra(monu)aeermr iotfmDeai o t0s2tr(r oudop emictl(f Dra(r ;o1tlxomi3ils a2ulnvo;t0aexrio3tydfmDeaues ( teum(rpno1aptemietltf rururpoo4tleo ictls a2emnmo () lxomf tytlptelnvi;t t2xrxr3ou4lle mnvtlt)arrr(m oo1apxnmf3iltlm rl(mp u)altoxr iadfaDelivslt0 eurxr nydlpenlieta(faDumxrp;u0oltnmieils m eaump;u)texoif io1fptrau s (0sruoio3oo1op  miei (  2tmu pnu0opeomoeildfs ua(vo u)tlxrmf oy1fpDr iei s0 eurxo ny4ameemnvt sfsDtr(r ou0alxn i3iasfa eluvo;(4treoxr oo1lm  ai ilt0 2uo(o ou1ap nlnei (  Dur( p;t0optnii3tytla2rl(mpn(4 eermrciadfpDeluei;s0tetmir iu4ame  fetls)artaurpou0olenmoeiyslm ran pnu) exrircty1faDe iei (  rtoxm ou4lmte net (f Dta(rpot0tlxomf3iat s rlnmp;t0aexnir3iy1fptrlneilt0 2tmio iudomeelietlt a2raxmoou0altniieildlm rlu s;t) lxnif ootla  lu i () 2um(opnu1op  mfcsa( aDumum ou0alt mfciyd sDum(mp t) eerxo3to1oa  luvils s2tr(r nu1llenlncilt srtmxmp;t4alenmfcildla rlump t0 renxo3ty1faDe nvil(  eurio3io4apt  icslsfaDrrum nt0oleomociyd m eanmp;u)artrioctydlpDeau s;s) 2tmir ny4om nlfes t)sDurxm nt0aeeniociadlmDeau o () exnifcta1faDeanvs;t0 2tmim3oudamenmncsl( sruaxr oo4tpxoiiciaslsDemnvp;u0aeermf ty1latraneo;(0trumir3oy4lmee nei sfaDumur ;u1alxn feiasla rl(mpnt4 eerir3tydfm   n o (  ruoir3oo1lpt livtatfaDta( o;o4opeoioeiys a2ua(vs (4 ltnmo3totfp   n s;s  2uoim3oy4omt  ictas aDtm(ro;t0oeenmfciatlsDumuvo t0teenmo tatfp  auvs t)sruo(m iudop nmfes t artrxm nu4tleniociydlmDum(vp;t)altrio ta1fmtr n slt0srumxr nydllenmfei s) Dtax oou1oexnmieiatlmDeanvsn() exrmrcoydfpDrau i s)texmxm3ou4ole  fesa(faDtm(mp;u1alto f3ildfa2um( p u4tltrir oa1lmDe nei;s s2toir3iu1ap  lnvi t  ruaxr nt4tpenmfciatfs umuvo (0texnxr io1faDr ies t) etoxopoy4alen fcs ()s2umx  ot1alxnmi3ildfs2rluvp u)aeeoifcoadoatrln sls seurimpno1llt mneslt a2urxmo;t0tptn fctaslsDem(ms u)arxomf oytfmDrliei;( t2triopoy1alenlnetat)arum( p;t0opeo oeiadfmDuau s t) etrmo3oo1fpDr ivo;(0srxrxm oo4lptn nvtl()s2rmumoou4apeoio3iadlm2rm(monu) ltnxo3iodfaD lnesl()s2xo(r3oo4ap e neiatf Dtm(rpoo4apeoiieiyt aDeau p;u0tltnxf to1opDraieolt0texm(opiy4lpt  fcils  2tauro;o1apt mo3iysfs ua(vsnt)tltoxr oo1fpD  ues;s0 rxmxrpoo4lmenlnetltfa2raxmonu1tpeomfciatlsDra( p (0alerif3iadoaD  nvs;s sexoxm iodlpe liviasf rtax ont1opxomfctydfs2ran sn(4tetnmrctydoaDeaieil() exoxopny1op elfvia(fa2taxroot1oetnioetltfa uln o u4altnxr iatlate ueo s trxoxr3io1ll  lietatf Dtrxmoot0tpe io3tat m eauvs u)trxrxocoytlpD auvsl(0 2urim3oo1altnlnvtlt srum(m oo0apx ioeils a2uauvp (0alxrif ia1lpt au i;s seuoio3nu4ape livilt)aDumx oou1opx  oetldlmDumnmo;u4 rxoif iytfaDraies s)trtrirpou4lp   fcsas srtau onu0apeomiciytlm2ua(ms;t0arenmo3tatfatrlivo;t) eto(r3oo4lmt  nvsa()s2tm( pot4aee  o3tasfaDumnmsnu0texnif ootlp e nvo s)trtoio nydoleelici (fsrtm( ono0oltoiieildfsDeau p;()areomo3oytlmt  i s;s trtrxo3io4optelicsa(fsrrmu  no0oetomi3iat aDrlnvont0artrxo oydoaD  ivi t0trxm(mpoo4amenlnvils)srtru p;t0opxoif3tadfs ulu pn(4 rtrxoctydopteaueo t0 rtoxrpoydlptelnetl()a2umump;t1tpeoio3iadfa2emn s;(0 ltoxr3totopt  ies (  2xr(r oy4am emfci s sDtr(ro;o1aee mfeiyslsDrlumont4 exrxr iytlaDe ies ()srtm(mpiu4aleemnctat s2rax ont0tle iociysla rm( o u0 exnif tydom r nesls)sexmxo io4altn fesl(fa2tm( pno1tpx  feildfaDem(mo u4 rxnmr3iadoateauvo;t)t2to(r ny4ole  iesas)aDrmu o;u1tptoioetyt s umuvo (4 rerxocto1fmtelues;t tetmxr3iu1am emnvi sf rraxm oo0tpeoiociadfm ean o () exnxo iytfmt  nvslt t2tmxr ny1lpte ivsl()aruauronu4ole mo3iysfs rl(vs;(0 renxr3iodfmDe ivi t0 rxoxm nodlpt  ncsa() Dumumpoo1texnmicildlm eln on(0tlxoif iydfmtr ivsls setm(o ou1lpenmnci s a2umu  nu0apeoiieils a2um(vp (0tlerifctotlmD  uvi;()trtrim nydale lfctasf 2rmuronu4aexnmfctydla2umnmo (0 rtrmf todlpt luvi;t0texoxo3nudam nmncslt aDrr(mpot1oeeomieiydlm um(ms;u0 etrxrcio1faDelivslt)tetmimpno1lm n nct sf Dtmxm no4oet mociasfm rl(mp t0trermo io1lm   n o;t)seur(o iodlme mnetlsfsrraurpoo4apto feildfa ea( o;t0 exnmo3tydoaD livsl(0trtmxo3iu4op nmfct s) Dtm(mo;t4apt  iciaslaDea( s;t0 lxrxo oydoptran o;()srxrirpoo1am  lnvt () Dtrxroou0tetomf3tasfaDrluvsn(0arxoircoatopteau o;t0trxo(opiodolen fcsasfsrtmxr ot1oexnmictydfa ranmo;u0aexoxr3oytop r neolt) rtrxmpou1lp nmfciltf Dta(m ;u0aetoif3ils sDra(mp u0aeerio io1oaDr neils0trxmio no1al  mfei (  2ua(  nu4alxoif3tyd s2emnms;u)artrir3ta1laD li s t tetr(rpoydam   fvsltfsrururpno4opt ii3iytfa emnmp (0aexomf3tytfa elu o;()sexo(rpoy1alen ivt s a2urx ont0apxoiiciytfmDrlump;(4arxomo iodfm elu s t sexm(o3no1lpteliciltf 2umxrp;t0tpxniiciyt sDemn sn()tltoxf3todfptraneols0 rur(m iu1ole  fvt sfaDumxrono0alx  o3iyd mDemump;(0altrxrcia1oaD auvo;t0s2umxr3ny4ll nlici ( aDuaxr ;u1apt if3tysfm ulu sn()artomociodomDeln sl(  2xoir iudolen fei ( a2urumoot0alen fetlt s umuvp;t4alerxr oo1fa e neo;(0tetoir ou4amtn fesa()arta(mp;o0alt  ieiad mDem(mp;t4tlxoxr iatom e i ilt0 exm(r nudll nmnvtas)arrr(mo;o1texo oeiydfmDea( sn() reoxo3iy1omD lies;s0 rur(rpoy4lptnlici (fa2tax p;t4olx mieiatlmDuanmon() ltrmfctodlpDrluvs (0 rxoxopoy1ol  mfvta( arrmur no0oleoii3iatfm rau sn() rxrxoctotfm   neslt0s2xm(r io1aptnlnct (f Drr(r ;u0apxn iciltfa2raumpnu)aetomr ta1lp rlneol(0 2xm(rpoy1lmtemnvt t  2rr( onu1tet iieiatfs uln ont4areomrcio1fp  anvslt seumir3nu1al n ncilsf rur(m ou0tlenmi3tydla el(mp u4 rermf ia1fmD li i;( t2xrimpiu4ope lnvsa( srrm(m ;o1opeo i3iyt a2umums;t0aleoxoctodlaD auvols  exmxo ou1amteliesl(f 2rmuronu1aet mfciydla2el( ont4aeenmo todop ranvo ()teurxopoo1amen fvi t s2tmum ot1oexnmi3iyt aDrmnvpnu0texnxrcoatoa eaiei () rtrxr nodamee ict () 2rruroot4tlxn oetat sDuln p ()texnmf3oadlmDran i;t0t2ur(o io4opt  fvsls aDrmurp;t1tpe ioctld a eanvo u4 rtoxfcoa1fmteanvo;s)teumim3iu4al n ncsls)s2ua(r ;o1apenmociatfs eln p;u4aleoif tytom rau slt  ruo(rpiydomtnmnesls)srrrxrp;o0altniociatlmDraums u0altrmfcoytlmt  n o s) euoio3oo4lp nlnct () rtmur nu1ope ii3iytlm2elu p;(0aleomfciodoa   ivolt0sexr(o oydllte iesls) 2rmurp;t4tle moeiydfa umump;u0alermf3iytoaD lueil()texoim nodam  lnetl( srrrxrp;t4tet iocildlm uluvs;t4 rtrxrcoodlpD anes;t sexo(r io1opee ncsls  Duau oou1ape if3ilslm ranvo u) lxnxr3to1oaD  n s;t0trxrxopnu1apeelicslt srtrx pno1optomfeiydfa2rmnmo;u4tetoifcoatopDrlu olt trxm(o3oy1alte fcsls)srumxro;t4apxoifeiyd aDulu s;t4texnmo tytlpte nes t  ruoxmpny1lm nmivil()aDtru poo4texnmoeiyt s el( o;(4 eerxr iodlmDe ueol(  2trirpoydalen iet s sDtr(r no4tltn ieils m2rl(vsnt0artrmr3to1lm eaivol(  etm(o oydoltnmieias  Dumum ot1tlen oetysfs2ea(vp ()tlxoxf3iytlpDeaueo;t  2tmir3iy4am  mivtl()a2rr(mpnt4opxomoetyt m rlnms;(0 rermrcoo1lm rai i;t0t2tm(mpoo1ll  mnesas arrrump;u4opt mfciasfmDuluvs t)tetnifciatfptraneo ( trxmir ny1opeelfctl(fsruaurp;u0tlt mi3tltfm2uau o t) renir tytoa eln o t) rtr(r3ou4lle lfvi ()artmx oou1apt  i3tlt sDum( p u4 lxnxfcty1lptelivol() 2xm(mpiy4apt mncs t)aDumu oot1aetnif3iasfsDraump t4artnmr tydfpD  nvilt) eumir3iudalen nvtls)aruau oot4optnmi3tyt aDuln snu0arxoxoctotoptran i t teumim3io1lpt licsa(  Dtmx oou0aet iociyd aDrlnvsnu)artomo iydlpDrlivo s0teur(m nu1aptnmfvsl( aDrmxmo;o0opx ifciys mDrln o u0 reriocto1lptrai i;s)srxmxm3io4ap  livi s  2ururpou0tlx moeiydlm rl(mo;u0 lermo3ia1fa  luvi s  euo(o io4altelivi s aDrr(m no4olx  o3tldlsDea( o ()arerif oytlpD livils seto(o oydlp e nvi (f 2uauro;t0aee io3tatfmDrlnvsnt4trtoifcoa1op elnei;( t2xm(o3ou1lm elfet sf Drmxmonu4tpxnii3iltfm2rmu s;t4 rtrifcty1fpD livo t0trurirpno4lp nlnvt sf Dtrxm ot4tlenifeiad a um( pnt) rtnio3totomteln ilt0tetmxmpiydll nlfeta()s2umumpoo1apt moeiatfm rm( snu)artrif tadomtr i s (0s2um(opiy1lm elict t aDuau pno1tltn o3iydfm uanvont) rtoxr3ta1omtranvs;t) 2xmim nu1oltn fct sfaDrrur nt0tpto o3iydla eanvs (0tlxrxo3ootomDe u sl( t2xmir ny1omt  neta()sruaur oo1apxnmfciys m2elnms;t)arxnxo io1fateaneils s2ur(rpoudamenlnvias)aDtaurp;o0aeen f3taslm2rlnmp;u)tltrxo3iytlpDr u s;()t2xoxmpno1ol nlnvilt aDtrxro;o4olxomo3iatlsDuanmp;t0 reomo3tatop elu s (0srtmirpoo4omenmivsa()a2uaxrpou1teenmfctas a2em(vo ()trxoio tatfm e ivslt) exmimpou4lltnlfes s)sDtaumoot0opxn oetyt mDrauvo t)trtrircta1fmtr uvo t  rxoir3ny1omtn icils)artm( ooo1aleoio3iadfs2ra( s (0trxnxf iytfp eln s t teto(r ou1lme  ivia( sDtru pou1oexnmoctydfs2rl(mo;t)texnxrciadfpteanvo s0 etmio3nudom e ies tf rrrxr ;u1oeeoio3iad aDeaump;(4 etnxo3iadfat aiei t) exrxm3oo4ap  miet t)a2rmu pot1tpx io3ias a rl( o;u) lxnif iydoaDrauvo;(0 rxoiopoy4om nlfei ( aDrrxmont0oltnioetysls emu p;t0 renir tytlat  ivil(0 2umir3oo4lpe lieia()srumxroot0opeo o3iyt m2rau o;()aetomr iy1lat ln slt)setr(r iu4lltemnesas)a2ta(  nu0tpxoioetadlm rm(monu4 exoxrctydlmtrlneilt)sexmir3io1ome mnct () rtrumoou4ale mociysfaDrm(vo;t)aeerir3iodomD aiei t)t2umxopiodll nlncs tf rraxroot4tpxniociasfa eanmo ()artrxo3oy1oatr ueols)trxoimpno1lpt mnetasf 2rrumont0tet iieilsfsDeluvsnt0treoxrcoodfmtelnesls0srtoxo3iy4omtnlnesatf 2ururp;o4apt  iciydls rmu sn(0aexniociydomt  n i;t0srxoim ou1op e fes t srtax pou4optomoetldla ulnmpnt) eeoxfcta1oa ranvol(0 etrxr3nu4aptn ict ()srtaxroot0ole  ieiys sDrlu p u4 lermo3tytfp   ivslt  2xm(o oydaptelnvtat artaxrpot1tpx  o3tytla ea(vp;u4 ltrmrcta1faD auei s) etm(o nu1ll  mfctasfaDrrx pnt0oet ioeild m2rl(vs;(4trxnmrcto1omDr neilt) exrxmpiydol nlfesa( aDra( o;u4tlxnmf3tat mDumnmp t) etoio tydfptrlivs;s0srumxopio4altn ieil(faDuaurpoo0olto f3ild s rlu o;u4tetnmr3to1fmteln s t  eumim3oydame lnet sfartr( ooo1apx io3iasfaDulump;u0 exnmfcoytomDr ueils0 rur(m3io4amtnlieta(fa2um( pou0opxomo3iasfm2emu o;()tetrmf tatlaDrli o t texm(rpno4lp emivil()srtaxrp;t0alx  ietytlaDea(vo t0 leoif ty1la   nvi (0trxr(r3ny4lle livi () ruax oot1teto f3tadfa eanmp;u4arxnio3tydlp raivil(  2umxr oy4lltnmivtat)a2urx  nt1tptoiieiasla2eanms;()tetnircoodlmte nei s0truoio nydole mfvi t a2tmxm oo1oeeo oetysfs2elumsn(0alxrmr oodlmt  n s (0t2trxmpiodamen neiltfsrtrumpou4alenmi3tlsfa eanvo;u0aexoifcoadlp ran o;s0tetrir io4llen nct s sDtrx o;o1alx iociatlmDulnmon()aetomr3todopD  uvils)setmirpnu4openmnvtlt)sDuau o;u0opxnmf3iat a rln s;() etrxf3iy1omteai ilt)s2uriopio4ll  lnctatf rtrumoou4alenmociyd mDrlu o;t) leniocto1lat luvs t0s2xr(mpno4lltnlfvi s a2umxm ou1alx ifeiadls2uanmo;t)tetnmr3tydfa  ln o s)sruoio nodal  mnciasf ruau ono0apxoifciydlm eauvp t)tlxrxociytlmteau s (0srxoxo oy1om elics t  Durumpoo4tet ifciasla2um(mp u0artnifcoa1om e uvi t truoio iudlmee nctlt)srurxm ;t1olto ictas mDuaumpn(4tltnmo oadlp  au o t trxmimpou1lm nlivt (  2ra(monu4oltnmietad mDeanvs () lenif3oo1opt  neilt srxrirpny4om nlfcsasfa2rm(mpot1oet  ociyt m rl(mp (4tlxnifcoytlatrlu i t0 exr(mpou4lpenmnetl(f Duru ooo4aex iieiatfa elu ont)arxnir tytoa ran s;s0trxo(o nydamtelieia()a2uaxm ou0tptomi3ilsfs2umnvo u) ltrmo to1lmt  ueilt0setmxr3oodlle lfes t  2rmxmont0ope  i3iat s2emu sn(0tetoir oo1lp rlueo;(0sruoim3ny1ame mivtlt) 2rmxm no0tptniietls s um(mp;(0tlenxf3totop e uei s)t2umxo3io1olee ietlt)srtmx ont0altomfciadfa2eanmo u4altrifcoatfmDrau ilt) exmxr oo4om e nvtls)artrx pno0ale moctys mDuauvs u)tltrmo3oatlp elnvsl( teur(o3io1ome mivtl( sDururoot0oexn ietldlsDrmn p;u) rtoirciydlp elnvsls t2umxo ny1op  lnvs t) ruax p;o4oltnio3iatlm2emn o ()texomfciytfmD  iei t t2uo(r3nodlpenlivils)sruaxronu1alto feiyd sDemu pn()tetrir3iy1optelivi;t  2xo(r oy1lmt mnvsl()sDtm(rpoo4tpe mictytlaDra(mp u0 leomocoatlmt auvslt s2trio oy1lleelnct t) 2um(r no0oetnifeiltla el(ms;t4 lerxr ia1fmtr ueo;s) ruo(r ny4al elfesat aDumxm ;o4olxomieiytla2el( ont0aexoxrcoatfmD lnei;(0srtrxo nu1amt livtls s2ra( pou0openmf3iatfmDrlnmo u0tlxnxfctodfp e ueo;s srxoir nudlmt lnct s  2urxro;o1apxo o3ildfaDrluvpn(0 rxrmf iodfatr nvo;s) 2umxm3iodlmt liesas)srur(rooo1ape ii3iydla2em( s;u0 lerxf tydlmDranvil()srur(m ny1omen iei tfs2rr(  oo1opx iietasls2umn o;(4arxrirciatoa   uvils0 exmimpou1amt mnvs (f Dtrxro;o0tpt mi3iyd s2emnvs;t0tetoif ty1oate uvs;s trxo(mpnydoltn fesatfa2rm(moot4opxnif3iltfm2umnmp t4 exomf3oytopte nvilt s2xo(m3nu4lme  fci t  2tru poo1aetniieiadfsDran pnu0tlxomr todfp r u sl(0 2xmiopny1lpe lnet tfsrtr( o;o1tlxn i3iat s uluvo (0 rermf iytla  lueo;t)t2urir nydope mncil(  2rrxm ;t0aex  i3tls m rm( pn()aetnifcootlatrluei t)s2urio3oydole mfcias  Dta(mont4aptnioctytfsDeauvo;(0arxrmf3tydlaD aueo;t  rxrxm3nudal nliesas aDumu onu4oetomf3tydls eanvo t0artoxr3oodop rlnes t0 etm(mpnu1op n iviasfa2tmxm ;t1ope if3tytfs2elnmpnu4aexnxr3iadlaDeau s;s0 rtrim3io4ame  nvsls s2tmxmont1opxoif3ild m2rmnvp;u0tlxomocoadlp raieo;s) rtrir3io4lp emivsas)aDurumpoo4tpen f3iasfa rmnmont4trtrmoctatlaD lnvi ( seumio nu1oltelncs s s2ra( o;u4oee mfeiyslsDulnmpnt0 eerifctydla elueo s trtriopny1lptn nvsa( sDumx pnt1tptoifeiatfmDrlnmp u0 eermf3ootlat aies;s t2xmxo3oydop nlfcia()a2rmx  ou1apxo fcias sDuan o;(4aexrxf io1opDe neolt tetrxr io4ape mnvi (  Dtaxmpot4altnmieiad m rm(vo;(0trenif3tytoa eanvs ( s2um(o3io1ol emfesatfa2ra( p;u4tlen feiasfsDul( o;() exrifciadomDr iesl()srxrio3oy4lmt  fvs t s2uru p;u0openifeiadlm eauvo;u0aetnxr3to1oa  lieols)setmim oudlm nlics s arur(  ;u1tlx iociadlmDrm(mp (0tltrir3oydoa ran o () rxoxmpoydlmee icilt sruaxrpoo0tpx  iciadfa emu o;()artnircta1oaDr i s;t)s2xoim3nudlmtemfctltfs2tr( pnt4tpe miciys mDrau s;u) lxnmrctytfa e ueslt0s2xrim oy1lpenmfetat)a2rru o;t4tlxomfcildlm2rm(vp;u4trxrmr3tatlmtr n s t  2um(m3ny4omee ivtatfaDumxr ou4tltnif3iyd sDrln snt4tlxnmo3ta1fpDr u i s sexmxm3no4omte fvsas)s2tm(mp;o1alxnmictls a rm(ms u4 eerio3iydfa e ieo;s  2ur(mpoodamenmics sfaDra(rpnt0olen fetyd s rmu p;u0altrio oatfp  aneslt)s2toxo3nydapte nct s)s2trurpoo0optnmieiatla2rlnvs (4aeermf ia1lptr ues;t)tetoim nydlltnmictasfa2rrx pnu0oet  ieildlm ul( s;u0arxnxf io1op   uvsl(0texoxm nodlptnlfes sfarum(  nt4oee  fcilt a2emnmo t4trenio oa1lp   uei s0 2xoxm iudamtelneslt)aDtau onu1aptn fciyslmDrlumo u) rxoxr3tatoa eanvil(0s2tm(mpiu4op emfvta( srur(r no1tpeomf3iydfa ra( pnu0 eeomo iytfp rauvi s)setmir nu1aptemnciltfsrra( ono4aee mfctydlsDumnmsn(4treoifciatlpDrlueil() 2xoxo ou1ome lies t) 2raur oo1oexnii3tyd sDuauvsn()trtnio3oodfpt lies;s sexr(mpoo1am  mies ()arum( poo1oeeo i3iyd aDeanmsnu0tlermfctydom e uei t)s2xoim3iy1om  lnctlt sDra(r nu1tlxnmfeiad aDem(mp (0 renif3iatfp raivo ()srtmir iy4am elivtatf Dtrx  oo1tleomo3iydfa el( p;(0tltnmfcta1laDrlneo;(0srxoimpiodolt licsa( a2rmuro;o4apx ifeias a el(mp u)tleoifcoydfatr ieilt) 2tm(opno4op elnvt s  Duaxr ;t4tlt  fctls sDum(mp u) etoif ia1om  livslt)tetoxopoy1ll nlfcslsfaruax  no1tpt  ociltfa emu o;t)trenmo tadoa eluei (  etmiopiy1openmfvtatfsrtr(m ou1aptn i3ils s2rm( sn(0tetoio3oodlmDeauvols  2tm(o oy4apeelictatf Duaumo;t1tex  feiltfaDumuvs u) rxrifcoydla e uvs s0s2umiopnydom e ivtl() Drr(roou4oetnio3iaslaDuluvo;t)alxomrcoodla   i i;t)srxr(mpoy1ap nlnesat sDur(r ;u4tpxn feiyd m raumonu)alxrif3oa1lpD aivils sruoxmpnydlp   ics sf ruaxmooo4opxniocils a2rmumo;u4arxnxrcty1fp  au o;s  2xmimpnudapenlivi ( s2rru o;t1texn fcild m2umump;u0tleomo3iodfaD  ies t0t2xr(rpiy1am  mfvs s  2rrump;u1aeenmo3iatfaDulnvsn(4trxoio3oatfm raneo s)srurxmpoy4optelnesat) Dtr(m ou4apxoii3tadfmDumumsnu4tlenio3oadfmteluvo s0t2toxm oy4lme lfci (  Duau  nu0oexn i3tldls2eluvp t0 lermf oo1fa eluvolt0s2trxopoy4amt mics t aDur( p;u4apen ociltla2em(ms;u4arermf oa1lpteanesl(0setoxmpno1lpt mfcil()a2taur no4tptniieiyd sDelnvs;t4arxnmfctatlm eaivo;( t2umim3io1lpee fesa(f Dum(m ;u0texn feiyt sDea(vp;u0 ltnif3iotfmt  neols  2trxm nu1omtnlicsas  rtm(r nu4oleniociltlaDuanmp;t) exoiocto1lmDe nvsl() 2tm(m oodlmee fetl(f 2rr( pou4aeen f3iltla2umumont4aeenmo iodoa rlu i t0 eum(mpiudaptnmicsl( aDururpot4aptomieiadfa um( onu)alenxf3to1om rlnei s srxoxm3nu1op  mietat sDrrxm ;o1tlxo fctytfs rl(vp;u4aeeoifciadla rlueo;s sexoxr ny4altemnet tfarrau poo0aetomfciydfa uauvsn(0 etrmrcoadfp rlnvo;(  rxoxrpnu4lmeemnvsasfsDrmxm ot1oetnmfciasls2el(mp t) exomr ta1laD auvsls sexm(r nu1ome  ivta(fsrrru ooo0tpt mf3iat sDrluvon(4 eenmf iodom  luvilt srur(opiodlptnlfetatfs2rmuront0ape iociltfa2em( s;t0aetnxf iytfa eai ols srur(opoodaleelfct tfsruaum nt0oeeoioetlsla2rlu p ()trenxr3iodlmtraivo ( t2to(r3iydomt lnci s sDuaxrpno4tlt mo3tysfaDraumpnu4 eeomo3io1op rlueo;t0sexmiopoydolt lnctl()s2urum oo4tlxoioeiytla2rmuvp;t0tetoir3ootomD aneils0teto(opio1lp   neta()a2umxmp;t0oex ifcilsla uauvont0 exnxf3ta1opDrlnvs;(0sexrxm3io4olt mfvsl(fsrta(mo;o1oexo ietys s emumsnt4 ltrmfciadfmte n sls)texmio nydam nlneils s2rrxr nt1tpxn oeiyd aDua(vsnu0arxrxr3oo1om rau s;t  2xrxr ny1lmeelnvt (fs2rr(m ;t4tptomo3tysfs em( onu)alxrifciotla  lneo (  rum(r ou1ll n neilt  rrmur ;t1oex  fetat a ranvp t)tlerxocootla  anei ( sexo(r3ou4olt  feslt sruaum ;t4tlt mo3iadlsDemu o t)artnif3ty1fmtelivi s0sexo(r3oydlpeelfcsls)artmx ooo1tpe mfetad sDrm(vs;(4tltrmr3iydfateluvs;(0seuo(o iydamenlivtlt)srraump;o0teenmf3iatfsDrlnvs;(0 etniocoo1lp e ueo;()t2urimpnu1lpeelneil( aDrrumpnt0oeenifetatls2elnvo u0arxrxr3io1fm  luvil()trxr(m ou4amtn icsat srtaur oo1ale io3ils s2uau o;t)texrio oa1lp rauvi;s)t2xm(rpiudapeelneta(faDta(mo;u4tpeo feiasfm elu onu) lxnio3iadfpte i i;(  rumimpiy1lp  mfctat)s2ur(r no4oeenif3ildls rlnvsnt)tetoifctytfpDelneo;( s2xoio oudole micsa()artmx  nu4oexo ietlsfaDrluvp;() eenirciotlp  aivslt)trxm(r3oy4lptnmnci ( srraxm nu1altnmiciasls el( pnt)aetnxr oydomte u o (0 2xo(m nydaltemfctl( a2rrum ;u4aptnmfctatfa2uauvo;t0altnir todfaD lies;(0s2xm(m3oo4alte nct ()s2rrum nu0oexoifeiys aDemuvo u)texnmrciydlptraiei;s)s2tm(o3iydol  lfviasfaDrau onu1optnmieiltfs umumsnu) rxrxo3todfatr uvols sexoim3iydllen nct (faDuaumooo0oee if3tasfm2umums (4trtomo oydoateln i;()t2uo(m3nodop emivs t srua(mp;u4oex iieiys s rau s u4 rtoxf to1fm raues;s0 rtmir3oy1amee feta(fsrur( pnu4tex  o3iat m rl( p (4arenxf oadla r n i s) 2toiopiodop emiesls  rtrxmp;u1opx  ociasfa ra(vo () rtrmf3totfmtrauvsl()srtrxm3iy4ale lnvs t srra(rpnt0oleo o3iydfsDuaums;t0 eeoio3oydop elies t)s2tmir no1amte fctl()arrm(mpou4aeeoiieils m2umnvo (0artnxf3iy1op  aivsl()setr(m oo1omtemfes ( aDtm(mpoo1texo ociyd a2ea(vpnt0 eeoio3iy1opt  uvi s)srtm(m oy1op emnvia(f 2tmxr nt0opt  o3tld a rl(vp;u4trxrmfciatoaDrai i t  2tm(m3oudlmtelics tfaDuru ooo0aet ifeiysfa uanvp u4alenxo tytopt auvo ( sexm(r3nu1alte nct tf Dra(rono4oleo ieiytls emnms;()trxrirciy1omD aues s0 ruo(mpoudamtnlfei t) 2tmuront0olx  feiat a2em(vo;t)arxrxrciy1oatr neo s srtmimpny1amtnmncil()srtruroot0apt  i3iadfa uanvpn(0trxrmo3oatfm  luvo;t  2um(opoy1lm emnei tfsDtm(  ou0oetn o3ild aDrl(mpnu4 lxoio3oa1fmD aieil(  2xoxrpoydlp n ivtlsfsrtmumpot0tltoifcild sDem( p t0tltnxf iotfmtrau i;t0tetr(r3nydaltelietlt s2urxmoou0tlxomicilsfm2elumo (0 rtnir tytlmDe ivslt texmxm iodamenmfesl(  Durxrpnu1oet  f3iasfmDrl(mp () renio3ia1fp  lueo;s s2urirpou4amte ivtltf 2urur nu4oleniiciydfa2rm(vpn(4artnmrcoa1omDe i o;t) exmxmpoo4ap   fvtas s2taxmonu0oeto i3tld s2ra(mp (0artoioctytom rliesls) eurxr nu4omtelictlt)a2rrxrp;t0tlxnifetadlm2rluvpnu4aexnxf tydlp r nvi;t0s2tm(o iydomenlics t a2umurono1tpe mf3ild s ea( o u0artnmr tadomt an ilt0 rtr(m3oydap nmiei t aDrrxm nu0ope mictatfa um(vo (4trtrxr3to1lptraies ()seurim iydlptn fvi () 2trxmpno4optoii3ilt m ra(vs (4tetoxo3iotfaDrlieil(0s2xo(mpiy1lpt lnviat) rur( o;t1alt mf3tls s2rm( s;u)trtoiociotomteai i;(  2urxrpoo1lm e fvslsfs2ua( oou0texo i3ild m ea( o u4 eeoxo3iytoa  li o;s  2urxm iudlmenmiet (fs2tm(r ;o0tpe moetyslaDeln sn()teerxfcio1faDr nei t seur(m3nudomee ncsl(fa2uaxr oo0tpxnmietldfmDemu o;u0texnmr3tydfptelueo t0texmxo3nodalt mfvtat) 2rax o;t0oee  fcilt m2el(mo (0areniocoadoaDean i;s) rxoxrpny4lmtnmiet s) rtau  nu0oltn ocias s ranvpnu) lxnmrciatomt lnei s  2toxm nydapt lncsa( s2tr( p;o4aet  octlt a2ean o (4 reoxf totfpDr nvsls  etmio3iydoptemfetltf rtr(  ou4texomictatls um( s t) eeomocty1opt aivo s0 eurxrpoo1llt  icsls)s2ta(rpno0oee ifetldls2rmums;t)alxnmr iy1fat  neils  rtrxr nodlp n ivtat)aDraum ou4apx  iciatfm rl(mp t0 rxoifctatlaDr uvs t0trurio iudoleelnei ()srur(ro;t1apx  ictyt mDrlumsnu)trerxrcoa1fmD anei;t texrxrpiy4am nmncs tf 2tmurp;t4tlxoifciysfa uln p u)teeomo3oo1fa  lnes s)srxoiopiudlpt  nvta(  Dtmxmpno4ape  octytfa um(vp;(0aeermocoadfmtraivil(0seurim3iu1ale  nvt ( sDtmxrono0tpt  octatfm2ul(mp;t) exrir3iadop eaueo ()t2xoiopnu4alte nesa(fsrtrur ;u1tpt  octld m2eau s (0trtnmf3totfp r u i ()texo(m iu4op e ics s aDurx o;u1tpen o3iltfaDea( ont4tltoif tadfaDrliei;t  rtoir io4op elfcilt  2ta(monu1aeeo iciydfs2umnmsnt4arxnio iatomte neslt) exo(r3nydalenlivils)sDurur ot1apeo o3tytfaDelnvon(4 rerifcoy1lm  luvslt t2tm(o3no1lpe  ietl(faDrmx pou1tpeo icias sDemnms;t4texnmo3io1lp rauvs ( t2to(r3iodoleemfcsat)s2rrumpno0opxnmoetad sDem(vo u4treoifctydfmD au i;t0srxm(mpoo1omte nci s)s2trx oou1tpeomoeiysfm2ua( onu0trtnir3tytlaDeau sls s2um(m iy1apeemivsa()sDrmxrpnt0texo fciydfm rl( pnu)altnmfcoytla eauvi;t truoxm oo4apte netl() 2ua(r ;o4tet  i3iltlmDel(vp t)areoxrciadoa raueo s t2ur(m3oo4ol   ivtat)a2rax onu1oleoiociasfmDul(vsnu4aexoxr3iydlmtrlueo;t) rurir3iodopenmfci s)sDtax  no4aeto octltfs2uluvs;u0trxrxo iotlm r ieo t0 exr(m3iy1opt miei ()sDtaurpot0oeenioeilsls2ua(vpnt)alxrircoa1fat auvs;t)s2to(mpnydlmee nvsa(  rtm( onu0opeoio3tadfm ran pnu0treoio3iadlp  lu o;t0 rxr(r3oydale mieias)sDrmxrooo0aptomociasfa rauvo u4arxoif ta1opDelu o s)s2um(r3nydaltnmneil(fsrtmx oou0olxn fciydlaDrl(vo;u0arenmfcoa1oa  aneolt0s2toxo io1lpenlfvs s) 2rmu onu1ole ii3iadlsDrmnvp t)tltnxf3iydfm  anvi;s0t2tmxr ou4altemiesltfsDtau pou0tpen o3ias m2el( s;() rerxr ia1omt lnvsls0t2trim3nudlpenmfvils  Dtax oot4opxnmo3tlsfsDumn p;u)tlerifciatfa rliesls)t2uo(m oodlpt  fei s)sDrmxm ot4optoio3ilsfs2rmuvs;u4areomrciy1fptraieols srurxopio1oleelicia(  rtrxmpnt1oetoii3ilt sDel(ms (0 rtrio tadopDrluvols0 etmio oo4ame mfctlt)aDurxr ;o0aleomociat sDrmnvp;u4 leoircty1lptelnvi s  2xoxmpnudlp  mfcils)sDumxrpno0opx mi3tlt s rluvont4tlxnmf3iodlpte ieo;s0srxoir3iydoptnmfctltfa2tru oot0apeomoctlt m el( snu4 rermfcty1fat ln o () eurim3ou4ll e icsls)aruaxrp;u0tpen fciad sDua( onu0 lxoxr3iydfptran i;(0teurim ou4ol elfetl(f rrr(rono1tetn i3iys m uluvs t0altrmr ta1oaDelues (  2trir3ny1amenlnvs (farraurono4alxnmo3tadfa2ranvp (4 eenxf oadfmDr ivo s) 2umxmpiu1om   feiat arumu  no0tex  i3tyd mDem(vsn(0arxnxfcia1fm ranei s)t2tmim iu4ol  lictas sDrr(mpot0teto oetytlaDemu p;u4arxnxo3iotfmD  ivilt) exrim oy4lpen iviasf Draump;u4tltoii3iad a2rm( p t)trxnxr3iadfmt luei;s  rtrxo3iu1ll emfviat  Dta( o;o1oeeoif3tldlmDulnvsn()aetomf3ty1oaDe i ils)srtoim iu4lp elfctltfartaxmo;t0tpxnmi3iatla2rlu ont)artnmo tydfmDe ueo t setrxrpoydapte fes tf Draur ;t0olxnifcias a eln s;u4altoxrcootfptr nvo;s0sexmio nu4al nlnesa(f Dra(m ;u1tee iietytfmDran o;t4 etoxo ta1oa  aues t) rxrir oudll  livs ()sDrr(mono4tpe mi3iysla el(ms t4alxrir3iytoa  auvs ( setmimpiydoltnmiesl( a2rau pou4tpeo fetadlmDea(mont4 eenxrciytlm raivo;s)s2to(o nudoptelnvilt  rta(m no0apeoiictldfa2rm(mp t) eerxf iy1lm r uvo t0s2trxo3oo4aleemfvs (faDrrxmono4openmo3ils sDrlums;(4texrmf3totlp r uvi;t)trxm(mpnodlm e icia(fsDra(  nt4oet micilt aDulu pnu)tlxomoctytlm rlnvo t0texmxr iudaptelnvs () Dtmxmpot1tptnmfetadfa eluvs (0altnio3iodoatran o t) 2xrxr oodlmenlnetltfsrtrxroot0tet mietat mDuanmp;u) eenircootlaDr uvs ()t2xmir3nodomenmfcsat) 2ua( p;t4texo f3tas s rl(vs t4 exnmr oytfm rlnes;s0 2tmir oodamenmnes t)srra(m oo4oex  o3tatfs2ran s;(4 rermf ia1fptrln slt)tetmxr no1llt lietls)aDumu o;t1teeoio3ilsls rlnvo;t0arxnmrcto1oa eaivo t) exrxrpoydopt mfetat)sDtmurp;u1texoiieiys a rlump;(0artrifciodlaDrlu o ( trxrio3io1llt  fvtlt) rtm(rooo4aptomoeiyt mDel( onu4texnmf todfmtrai s;s0trtmxo nu1omeelncils) Dtmurpou4oetomieild m2uanvp u)aeermocoydla e nvsls)srurxmpio1lm e nesatfarraum ou1oleoio3iysfm elums;t0 rtnmr iotfatr ivs;t0 etrirpiy4openmfvi (f 2uaxmpnu4tet  iciyt m2el(vo (4tetoiociy1op r ieo (0 2xm(opny1lm eliviat artrurpot4opxnmfeiadfs2uau p;u4artrxo oodfm rai s;s setrim3ny4lptelneslt)aDtaumo;u1opxo f3iytfm2el(mo u)trxnxr3totomDrlueo t t2xoimpiu1op emnvi t  rua(mp;o0tex miciydlmDrmuvp t4alenxfcty1oa eaivslt) etmio3ou4op n fvt t)sDrmu pno0alen feildfa rmu p;u4tlxrif oydfpt anvs s)trurirpoo1am   neia(fs2tm(m ;t1olxo o3tasfmDrlumon(0 exrircio1omDean s;t setrxo3iy4llt miciltf ruaur ;u4ape  f3tys mDulumsnu0arenxrctotomtelivi t0 rxoxopnydol e ieilsfaDua( pnu0tpt mi3tyt a2um(mpnt)aeenxf3to1lmteaneils0 eumxm3iy1al  lfvslsfsDrm(  nt1openiicildls rln p u) rxrif3to1oaDeaieo;(0t2uoir3ny1lle  fvtlt)arrrxmonu0teeoifetytls rmumo t4arxomf3tadlat ai i;s)srumio3iydlm emnvtlsfarraxrp;t1aeen f3iys sDean p (0tlxoio3io1lm ranvs (  2to(o iy1op elnesa(fsrumx poo1tlxn fetyslm2rlump;u0alerxrcoa1op   neolt)setoxrpoudlp n nvtatfsDtm(mooo1tlx mfcilt a ul( p (0 reoifcoy1fmDe n s (0srumxr3nydlmte iesat) 2uaxront1teeomo3iysfs ul(vont)teeoircoo1lmD anvs;s0trxm(o nodol   ict s)aDrrxmooo4tee  f3iad mDulums u4aeermo3to1om eanei t)teum(m ny4lp  lict (f rurum ;o1alxo feildls2em(ms;u4 rtrmr ootfaD lu il(0t2tr(o3oo4ol e fctat)s2rru  oo4aeeoioeils a2ul(vo;(0areoir3totfp rliesls0teur(r nodaltelfetls)srrm(mono0tex  fctlt s2umump;t4alxnxo3tytfm   neol(0trxoxopnu1omtelicilt) ruaumpnu1tpeomfciytla2rmn onu4 ltoir3iotopt lneolt teuo(mpiy4lpenmfvslt  2tax pou4altnioctydlsDrl(vp t0tlxoxocto1latelnvi;(0 2um(m iodalen fet t s2tr(ro;u4apxo o3iltls2emu snt0tetnxf3oatlat ln i (0t2tr(rpiydalenlictlt aruru o;u4oexoioeiad a2eanvo;(4 eenxocty1laDe ieils  rxr(rpiudlpeemfvsls) rua(r ;t1tpx mf3ilsls rl( p u0 rxrxfcootlmt aueils0 2umir3ou1op n neiat a2urum no0tetnmi3ias m2rmnmo;u)trtrxr oo1fpteanes;t  ruo(r3no1oleelfvia(faDra(  oo0apeo iciat sDuluvs;u0arxnif oo1fmDrluei;( t2uo(m3ou1lmtn fvs s) Dua(m ou0oet mfeiytfs el(mo ()teenifciadfateaueilt) 2xr(mpnu1alt mnvt s)artr(moou0opto iciad aDul(mo () leoxr iy1lateli o (0sexrim iu4lleelfeils)aDtm(mpnu0opx ifeiysls2elu p u4trtnmfctydopD lueils0s2to(r3oudoptnmics (  2rmumoou0tltoifeilsls uan p;(0 ltnmocta1lmt  neo t0trxrxo3nu1op n netatfa2rrum ;o4tltniietad a2em( p;u4tltrxo iatomtelu ol(0t2xo(m io4apeelfvia()sDurxr ou4texomi3iaslmDumn o (0aetrmr3iadfmDe n ol(0srtr(opou1lp nmiet sfs2uru pno0olenifciadfmDrauvsn() renmr3iytlmD  ueslt seurxo3iy4llt lies (f 2ta(m ;u1teen octlsfaDean s t)trxoio3io1lpteli i;t0 exrim3nydolt  nvtatf 2urur nt1tltomf3tat m2ulnmpn(0arxnmr3ootopD  uvslt0truoxrpoy1lpt  iei (fa2rru pou0apeo octadls2ulu pnt0 eeoxf3oa1fa e ivsl(0 etmxmpnu1apeelietasfsrtrurpnu4aee miciyd a eanvp u)tetrif oytfaDe uei ()trumxm ou1omtn fvt (  Dumumo;u1tpxnmocildlm2elumpnt0 leoxrcoo1fm eaneslt0teumxo3io1omeelnei t)sDrr(rp;t0altoiociytfsDem(vo;(0arerxfcty1fpt lieo ( srxrir3oy4omt mfvtatf 2urx  ;o4opeo oeiyd a2el(vpn(0 exrmocoadlmte ues t  2toxmpoodaltn nciltfarum(m nt1opxoif3tyt aDulnmo;u4 rtoif3oydopD luesls0tetrxopny1amen ncia(  2taxm ot1aex if3iat sDuanmsnt0teenif iodoate uvolt)trurio3ou1ol nlfvslsf 2rrxm nu1altoiieilsfa2elu p u0trtnmr iydomtrlu i s) 2tmxm iu4op   ici tfsrrmum ou1oeeo fetatfa2ea(vs (0treomr iotlm ran il() rtoio no1ole  ivtlsfaDrru p;o1aptnmfeiysls2umuvs;t4tlxoxfcty1fpteai sls texm(m3nu4al elnct ()srrm( o;u0opt  icilsfsDeanvp u4alxoio oa1late ies s) ruo(m nu1apte fvsl( s2ua(r ou0teeoifetlslsDul(vp ()teenio3ia1lm  luvs;(0s2um(opio1al emiei t  Drauront4aex  icilslsDuan o (4aeerxf3tadla eln olt0t2uoxr3io1lmen ivslt  2um(r oo1oeto i3tlsls rau o;()trtrifcty1la  li i t  rxoiopoydllee fvtltfa2raxm ;u0aeto f3iydfa2um(vs;t) rxnmf to1la e ues;s0 2xo(opny4ll elieiat  rurxmp;t0apenmocilt s2rl(mp t4 eerxr3iotfm  luvs ( seto(o oodapee feta( aDrrxr nt1aexnmfeiytfa rlnvs;(4 renxfciy1fatr ieo t0trum(r iu1lm  mncs s) Dtr(ro;u1aetoifctadlmDrm(vo;t4tltoxo ia1fat  u sls s2xrim iy4omt mictlt)sDtm(rpou0teen f3iltlm2eanmsnt0alxrif3oatlpD  ieo;t trtrir oudolt  nvi sfs2ra(rpno4apen oeiysla ean on(0teenmociy1lm rln ols) etoxo iydlmeemfvi sf Dtr(moot1aexo octysls eaumont)aetniociotfpDe uvslt0 rxoxm ou1opeemies ( aDtmx  ;u1oexn f3tld a ea(mp u) exoio iodla  lnvi;()t2xrim oy1apenmfvt s sDrmum nu4oexoif3iat mDrm( p (0artrmf iytoat lneolt0srtmir ou4lltnlnci ()sDrr(mp;o4tltniocildfs ra(vp t)trxrir oadfaDelneo;()srxoio3oo1lm e nvs (f 2rrx pno4oetomo3tlsla2umn o u0tltoxf oodfmtr iei;t
\ No newline at end of file
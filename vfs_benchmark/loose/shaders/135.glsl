@@ -0,0 +1 @@
+n ilt)s2urim oudale mfct t sDraxmoot0ale moeiltlmDrmumo;u0aetoxfcia1lmt luvol()trxr(rpiy4aleelnvsat srrrx p;o4ape  o3ild aDemu s u) rtnifciy1oat lnes t)sexoxmpio1olenmivt t) rra(mpot1optn oetls aDuauvsnt)aetomr3oo1faDrlieo;s tetrxm3iy4ape  ivs t  2um(mo;u0olxo ietysfsDrmuvo;()aeeoxocoo1oa raneils)teumxm3iy4am  mics t)a2rm(  no0teeoif3tys s2rl(ms;t0 rxnmo iatfaDeln i s  etr(o oy1altemnvtas s2tm( pot0tlx ii3ildls2ea( s t0 etrxf3totomD  u i;() rumxopiydoptemics ()a2rmxr ;t4opeoio3tlslaDemn s;u4teenxf3ootlpDe i o;s s2xrxr3ny4lm nlfvi tfa2uauro;o1alt  fetydlm eanvo ()texrifcio1lmD  neil(0 exoxopoudoltn iesltfsDtmu  nt0texomfeilt aDrmn on(0arxoif io1fa r u sl()srxm(opnydom n ivtas)artm(moot4alxn ieiltfm emnvs t4arenio to1oatr nvo;t t2tmxo3nudap emnvia()sDtmx onu0aee  ictyd a elnmp t4aeeoifciatfa  ln slt)trumim3nu1optelfeiat) 2ur(  oo4olt ifeildls ra(vs t)alerircio1opDeau ols)sruoxr3nodam nmfct s  rumum nu0tex if3iadla rmnvpn(4 lxomf iotlp  lieolt)s2xo(opiu4optnmiei () 2uru oou4apxo feiasls2rl( p t) exoio ootfpDe uei;(0 rxmxopnydalenmivia() Dtaxrono1tlxnmfctatfs ranvpnt) rtnmo ia1fpD  uvilt)trtoim iydlpenmnvia( a2umuro;u4alt  o3iydfa2emumsn(0tleoxr3iodfaD au o;s trxm(m oudaptnlfvsls)a2ra(root0tltoiociydfaDum(ms u4 rtoif3iatfpD  i olt)s2tm(opny1alee nesls)a2uru oou4aetn i3tytfs2uauvp u0teenxf oodfm r uvslt0s2urxr nodopeelncsltfa2tmxmpno4optomiciasfs ranmpnu0teerxrctatoatrai olt)t2xm(opio1lp nlncslt)sDurxrpoo1olxoiociys a emn pnt4aexnmf3oy1lp rlnei;( s2tm(r3nu4oleemiviat) rrm(mpou4oeeoiiciydfa2uln s;(4 rtoxo todfmDr uvi t0 2tmxo nu1lp   ivi t)sDrrx  nt1texomoeiatfaDrm(vo (4 etnir ootlpDrlivi ()srxrxo3iy4omtemfci t)aDurumo;t0apenmfeildfa2elnvo;u) rtnmo3tydom elnvo ()s2xrir iodalenmnvils) rrm(r ou0tlxomfctldfm uluvonu)trxnir ootom eai sls0texoir ny1lmtn feil(fsrrmump;o4aeeoiieiyd m2eln on()aleomr oy1fateln sl(0t2tmxr ou1optnlivs t a2rax pot0texomociyslaDrlnmo;(0 rerxr3iytlm eau s s0sexr(m3ou4openlnet t)srrmxr ou0opxomfeiytlsDeauvon(0aeeoioctytlp   nesls tetm(r ny1olee ivtl( sDtaxrpou4oetomoeiadlm2rmn p;t)trxrxrcoytfpDran i;s)srurxo3iudamen net t)arrr(rp;o4ale mo3ilsfsDea(vpnt4artrirctatom   uei;( trxmio nydll nlivslt  ruaumpnt0alt ifciaslm ulnmpn(4treoio tadlateaneol( sexoim iudaptn ictls)a2rauronu1aetn i3ilsfs umumon(4alxrmrcio1fa   ieilt)teur(m iu1amt lnvs (  Dtr(mpnu4aex  fctadfaDra( p t0teerxf3oadlaDr n i;t0srxrxm3oodop elfvta(  rrrx pou4opx  f3tysls em(mpnu)aexrxo ootfpD  nvol()trxo(m3nu4ol nmfcs t a2uax ooo1tet mi3ils s2eluvo;t4trxomf3ty1la r u o;t  etrxo3ou4lmeemics (  2rrumonu1tpto i3iad aDemuvo u)texomfcoy1faDeluvilt) 2uoxo nodlltemnvtasfsDrmxroou4apxomf3ildfs2ean pnt4aexoir iodoa   uvils0 etm(opio4alt  nvslsfsDuaxm no4tleoiietls a uluvo;()aetnxrciytoptrlneslt)sexrxrpiu1lp n nesa(fartrumpnt4tpenifetadlaDulu s t0teerio ia1fpDr ivo;s tetm(o3no1al  mfvtas) rtr(mpot1opxomo3tydlmDem(mp;(4artrirciatlp raneo;s)texmir3nodlle lfct (fsDra( ono4opx if3tlsfsDua(ms t4tleoir tytom elieo;()s2ur(mpiudaptnlies s  rtm(rooo0tetniictyt sDulnvp t0artoir3iy1fmtr u ils0 rtrirpoydal elfcsa(farururoou4aetoifciadlaDrau p u4tetrxo3ia1op   ivi;(0 rumxr3ny4olenmnctls)aDuauronu1aptoifetatfaDeanvpnu)tltrir3iadoatelnvi;t)truo(o io1om elivs t sDrr(  ;t0tlto icildlm ea(ms () eermr oo1fatr n sl()t2uoirpoo4ll e fvs s a2rmxmp;o0aeenmfcildfsDemumo (4tlenmoctydoatrln s;t0srxriopoudamt mneilt aDuru  nt1altomoctydls um(vs;u0altnmf3iydlmDranvsl() rumxr nydom elivslt) Dumxm ou4aleoii3ild m2emn onu4tltrmo3iydlmDeauesls0 rurxo ny1amenmfctatf 2urx oou0ape moeias aDrmnms;()aetnxr3iadlp   neil( t2tmxmpoudlleelfes s srrmurp;t1aetomocils m2uauvp t)aeermr3ty1faD  i il()trtm(r nodllt mici sfsDtmu  ot4oltnmfeiat a2eluvs;t0 rtnxf oytfmDe uvil(0srxoirpnodop eliei t aDraumont4texniieildlaDrauvp;()texrir oytomDeluei s)srto(mpio1altn iesat) rrmump;t1oet ifeiat s2ranvs (0 etoxociotlmteanvo s tetr(o3io4llee ivi ()srur(root1oexnioetatlm2umuvp t0 rxrxf oy1lmte u i;(0t2tmxrpny4al nmnvtas) Dtax oou0ole mociadfmDrlump;(0aeenmf tatfmD  iesl( s2urxmpio4om e iesltf Drmump;o0aetoiictytfsDulumo;(0aleoxr ootfa   iei;(0setmxrpiy4op nmfcias)aruaumo;t1tlt iocildfmDumumsnu4aeenxf ootop ranvs;( trtm(r3iodal  lnvi ()srrrxmp;o1oet iieiys aDulnvp;u)tlerxr ta1lmDr iesls)texr(rpio1omtelfcs s aDurxr ;t1oeeo i3iatfa2rl(vo;(0 exrxo oy1lpt an sls0s2trxo3oy4ope mivta()s2uru o;o1tpen oeiadfs2rlums (0 etoxf tatfp  aieils0texmio nu1ap n feiatfsDtrxr ou1optniiciytfs rm( p ()trerir io1la e neo () rtmim ou4lm nlnvi t  rua(  ou4alenmi3iatfa eanmo u4tlxrmr3to1op elu o;s0 rurxm3iu4altn ivtl( aruaxmpnu4apeoio3tydlaDra(mo;(4teenxr tatlpteaivsls) rxoxm3no1lpen fesa() Drr( p;t4aet  oeiltfm2rl(vo;t)altoif3oadfaDeaivo;()tetm(m3oo4opee nvsas a2trump;u4olxn o3tysfsDeluvo t4areoxfctodlmDelnei t) 2xrxm3iu1optnmnvslsf Dur( oot4oetoioeildfaDeanvo t4aexoircta1lat  u slt0teumio3oodamtelfeta(f 2umu p;t0oetoio3ils a rmu s t0 ltoxf3ty1om eanvs t0seuoir no1amt  fct sf 2rm(rp;o0tex mo3iad aDra(vs;u) ltnif oydfmDeli ilt s2umxo3iy1oltnmfesa(fs2raur oo1aetoifetasla2rlnvs;()aetnif oytfpDeln o (0trxr(o iydome mncsat)sDum(mpot1alen ieiat m2rmums u0altnmf iatfa eln i;( t2xr(o3no1llte ncil()a2rrurpou1texoiictysfs eauvo u4 leoxrciytfa ranei ( s2tmio nodlpenmfvtat)srrrxrpnt4olxn ieiatfs rluvon(0 leoifcoodlmt  n ols0 eurio no4lle  fctl(fsrra(rp;u0alen i3iadlm2elu s ()aeeoir ty1op elivi;t0seum(m3iodal e iet s srua(r ;o4apxoiieiytlm2umuvpn()trtoircoa1omt anei s srxmxrpnu1ap nlfvtas)aDur(rpot0ole ifeiadfa2ulu pnu0 eeoxo3ty1oat aueols)s2xm(o3oy4olte feia()a2taum ou4oleomi3tltfs2eauvpnt0 leomf3ty1faDean ilt0seuo(m3no4ole lnetat) rur(m no0tee  o3iysla ea(vp () exnmr totlm rluvi;t) exrxo iudlleemnvtl(f 2rmurp;t4aexn f3tasls rau p;(0tlxrmocty1fa r n i s) 2uoir3oudopenmfctatfarurxm ;t0oexomoeiaslsDulnmont4alxoxfciadfaDran s;() 2ur(opnudal nlnvtl(  Dur(m no1oexnmfeild aDem(mo;(4aeerxf oy1lpDelivs;t)srtoir iu1ameelfvtl(f 2ra(rpoo0oleoio3tadfm2uan p;t)treoifciodom r ueol( setoimpou4openlivt (farrrxm ;o1ope miciys sDua( s;t0tltnxo3iydomt au ols srxr(m ou4oltnlnesls  Drmxm ou0oee if3tlsls em( on(0 lenif3iy1omt luvslt0srxoxopoy4am   fviltfarua(m no4tee  o3ils a ulnvp u0 lxoir3iytfpD au sl( t2toio3nodameeliet t) rtaur ;o4alx if3ildlmDrlu onu0 lxoif ta1om r ies;s0 rxoio iu1al nlics t  Dtr( p;o0aptoioetysla eln ont0treoxo oadla eaivi (0t2trio ny4om e fesat artmuro;u1oee iicilsfaDumnvp u) leomr3tytfpt aneil(0 rtoxr3ny1lptnlfvta()s2rr(  ;t1altn ieiysfm uanmsn()tlxnif3ty1fa  au o s0 ruo(o3iy4aptemnet s)sDurxm no0opxoio3tlt a em(mont4trxrmr3iy1omDe u olt)trxoio3nudop n nes t) Drm(rpot1apeo fetysfa elnmo;(0 exomr3io1fmD  ivols) euo(mpoo4alte netat)a2tmxro;t4tpxomfctys s em(mo;(0altnxf iytlaD ln ols0t2to(o3iu4al nmnvia(fsrtaxro;t4tlxo oeiysfaDemnmp t0 etoxf3iytfaDeauvo s0s2urxr3oy1ale  fes s sDraxmo;o1aex moeiydfm2ea( sn(4trtoif oa1fm  aueo s)t2xmir3io1oltn fvtat  Draxmpno0olxoio3ilsla uanms;t4 exnif ia1lp e uvs;s)tetm(o nudomenmnesl()aDumu o;u4tetn f3iltfs rauvon(4trxrmr iatom eli s (  eumxo3iy4llenmiesls)aDumxr ;o4ale mocilsfs ulnmp;t) rxnmfctotfmDe nvs;s)t2xm(mpoo4aptemnetls s2ur(m ;t0oetomociasls2rmnvs (4alenmo ia1fpD auvi;s  rxmxr3oo4amte fet s) Dra(moou1olenmictatlm ea( o;u0 etrmociatfpt lneol() ruo(r3iy4lptemncslt)s2umum ou1alx mieiys s ea(ms t0aexoir oatomtraieils) rxrxr iudam   ict s srtmu o;o4aet  o3tyt m2ran s;(4aetrxr3iy1fpt lnes s)srxr(opiu4ol emfesas)aDrr(mpnu0ape mfeiad m uaumo;t) lxnir to1lmt  ivo ()trxoim iu4ap   fcta(fsDuaumonu1tpen f3iydlsDrlums u4 eermoctadlpD aieilt)trurxopoo4omte nvslt a2rmxmono4opeomfeiatfs rlnmonu0aetnio oo1laD lieo;s)s2xo(r iodoptn feia( arrr( pnt0oleoifciysls ulu p;t0 ltnxf oy1op r u o s0 rumxr3ny1oltn ict tfsrrrxr oo4alxnioeiltlmDulu s u4tlxoio ootfaDeanvs t srum(mpio4am nliei ( srrmx  nt0tet  fctadfaDem(mo t4texomfctatfptrln o;( trtoio3oodomtemnct s artax  ot0tpt miciltls2ranvs u0trxnmr ootomt lnvil()t2uoxo oo1oltemfei () rtr(  oo0altoioetatfs2rm(ms;t0tlerxf iytfmDe neo s  2urxo3ny4aleelfciat) Dtmx  ;u4tet mfciytfs ul(vo t)aetomo3iotlatelnvo;()t2trim3oy4lpe  fvs (f rrr(rp;u0aee mf3iys sDeaump (4aetrmf iatoaD  iei s) 2xoxo oydlle lncs () Duru pno1tlt ii3ias m2ua(vs u0alxrif io1oa rai s ( texoirpoo1ameelfvtls)s2uax  ;t0apt ii3iltfmDelumon(0 exrmfcoy1lmDeaiei;t) 2uo(m ny4lp nmfesl( artm( poo1ale  f3tlt m rmnvpnu)arxrxo3totlmt  i il()seur(rpiu4lleemnvsl()s2tmum ;u1aet moctlsfa2uanvp;(0 renmoctytfp e uvslt  2xm(r iu4amtemnesas)aDraumpot4openmictls s2eaump u4aetomrcty1fp elueolt texoio3iydape mnci s sDtr(mpno0ale mieilsfmDemnms ()arxnmf io1fate ieo;t0 rxrxm3iydape mfvsls s2raxm ou0tpt moctad s ranvo;(4 reoxrcta1fa  ai il()srxmirpiudol elieilt aDur(r nu0aleo feiatlmDuln snt)alenxr ootopDeluvo;() 2tr(o ou4altnlfeiltfsDrm(  nu0apt iieils sDeluvp t0tlxrif io1fm rli s s)trto(o3io1apt livsls) 2tauroot1apeo oeiat s rluvp u4texrmfciodlpD  ies t)texoir oo1aleemfcs tf 2raumont1oltn ocilsla rlu p;t0 rxnmo3iytoaDe ues s) exo(m nydam nmfcia( s2rauro;t0aptnmieiydlaDuan snu4treoifctadlmteanvi;t)sexm(m oydlme mnct t)arrru poo4oeto f3ilsla eanvpnt0tltnio ta1fpt li o;t)s2tmir ny1apeemnvt ( a2ur(m oo0olxn ietydla2elu pnu) ltoir3tydoa rluesls srtrxo oo1lleelfvil( s2umu p;o4ale mieils a2eanvo;t4trerif oa1omtr ues;( t2xrio no1amtemfvslsf rra(mpnu4tptnmoeilsfaDrmn pnu4trxrxf3iydlat  uvs;s)tetrxopoy1aptnmiet tfsDtrxr nt4tptomo3tyd m eauvo;t) etomf iytfp rlies;s teurio iu4ale lfvtat) ruaumo;u1tltnmfciasfmDel(vs;u) ltnioctadfpDr u s;( s2xoxo3nodlp  lnesa()aDrau  ;t0teeo feiat a ranvsn() ltnxoctydfptrln sls0 2tmir iu4lpen ivi s  Dua(mp;u4oexnmfeiadls2um(vsnu) exnmo3oadlaD lnvo;( srxrxo no4olen ietas s2rax  ;o1tpxomoeiysfs2rm(ms t)tetrmo oa1oatraneo (0sruo(o ny1lpeemnvilt  Draxrp;o0olt  o3tltfaDrmu o;t)tlerxr io1lp   ivs;s) exr(opny1ameelnvs (faDraurooo4ole mociyd m2elnvo u0 ltrxo iodfaDrlu s s tetm(m iu1ape miesas)arum(  no1opx miciasfsDea(ms;t0aeenmo tatlpt li olt s2tmir nodamtn ictasfartrx onu1tee mfeilsfaDrlnmon(0 ltnio oa1oatr nvil(0s2tm(mpou4ale mivsat sDurx pou4olt ii3iadlaDrmumont)arerxfctatfm eanvo;s)seumxm ou1oleelfvtlt aDrr( ont1tlxn fetlsfsDeanmsn(0 lxrmr oa1omDran olt0 etmxrpnodlpt mieiat a2tm(roou0ole  oeildfs emuvpnu4tltrmrctodomtean o t0truoxopio1op   nvtlsfa2umxmont0aet  i3ils mDuanvsnu4 rtomf iatlmD aues t0 rtoxr oo4oltn nctasfsrtrum nu0opxnifetltla2uaump;t)tltoxrcoa1oaD  uvs;( s2xmxr oo1ap  mics () Drr(  ;u1ole  ocils aDumums;(4 lerxr3io1opD  n s t trxmxrpoydome  ies s srtrxmont1tpx moeiasls elu o t)aetnxfctydfmD aiei t)s2um(opoodllt lncsa(  2um(rpot4opxnmictyt s ea(vo;(0trermrcoo1om   uei ()s2tm(m ou4lm elnctas)artmxr no0tetomietytla ranms t4texnir3oo1lmte i o;t)truo(m3iy4opt  icilt)srtaxm ot4tlxo feiys m2em(monu4 eenifciytfmte i o s0trurio3iu1omeemfet ()sruaxmooo0aeen oeilslmDemnms;t4 lxnmrcoy1fa raiei;s srto(opiu1omtn neil( aDrmxr oo1oeeomieiltlm2ranvpn(4artomr3tadom e n s t  rtrim3ou1aptnmnvtasfs2ra( oot0oexomi3ils a2elnvsnt4arxrio3tytlmtr ivs;()teurir iodom emnvtlt  Dta( p;t0apen f3iltla emn o;t4 rxoxocia1omDeaues;s  euoxr3nudop nmivtl() Drrx ont1tlenmociyslmDel(ms u4treoxrcoa1opDrlnei ( srtrim nu4ole  fesl( artrx  ;o0opx miciatfaDumums ()altrxo3todfmDrliesls)s2xoxm3nodam  mivtlsf 2ururpou0tptniieiytls2uau s;(4aeeomo totopDrai o;s)teuoxm3oudapenliei (f 2urxrpou0olenifetytls2emu pnu)altnmrctatlmDe ueo;(0 2um(o3iudomt lncsas sDur(mpno1oet  ieiasfm2umuvs;(4aexrxo tydlmteluvi t) eto(opnodal nlicsa( s2urxm ;t1tlxo ietys s2ea( p t)tleomr tydlmteaivo;s0 exrir3iu4lm nmicslsfsDurxr ;o1altoifciysfsDeauvs;t0arxrmo io1fmt  ivo (0trum(r3iudamt lfeias  rtax o;t0tee  fcilt m2ulnmo (4altrio iatoa eaivs;s tetoirpoodol   nei s a2urxmoou4oexnif3tadlmDem( o u)altrmr3oydfp   u o;( s2xmiopnu4om nmfetlt aDum(m ;u0aeen fctatlm2raumo u4aexrmf3iotop e uvi t0srxoim io4lm elfviatfa2urur nt1teen o3tysfs2rmnmont0aeenif iy1lp  ln o;s0trum(o3ny1olee nci s srum( o;o0tpe ifeildlm rlu p u0texomocto1lpte ivslt0 etmimpoo1ame lncs t s2uaxmp;t0alxnmo3tltlaDeanvon()artomr3oo1fmtelnvils s2xmxr3io1lpe mfes (faDta(root4olxo o3ildla2elu p t) exoio tatfp eanvi;s)trtmio no1ap  lfetat sDtaur nt4aexnmo3tys a2elnvonu) etnxf3ty1oaDrlnvsl( sexo(opnydlpenmies t) 2umumont0aptn o3tadfa el(monu)tltnxo tadomt ln s s0 2tmxo ou4omtemfeia( sDtmxrono4tleoiicildls ulnvp;u)texomo3io1faDeaivsl(0 rtrxo oudlp  micilsfs2taurooo1tpe mi3iyt sDuau onu) rxrio io1oatr ivo t s2toxopny4amtelfvsat  ruru  ;u4olxn i3tat s rm(mo;()teermf3oy1fpDrau i;t s2tm(o3oydom elivtlt srum(r ;u0apt  f3taslm2umu p;t0tetoxocoodla e i i t)tetoio no1olee ivs t) rtmxmpnt4tee  i3iatfs2um( onu0artnmr3iodfpD lies;s) eurio3iodlptnlncsls)arua(r nt4alxnioeiyt mDrlnmp;(4 etnmocoy1omDe n ils0t2xrxr oudam emnvi t  2rm(  oo0tleniiciyd aDrmuvo u)aetoxr oydop rln i;t) rumxr3oo4apenmies ( s2ururont4tpxoioetydla2em(mp t)arxrxfcoy1opDrln o t t2tm(rpiu1lpe mnci s srtr( onu1tlxn ocils a ea( snt0trenir ty1fm eai i s) rto(opny4lmtnlnctatfa2rm( pnu1aleo fetys s2umu sn(0altoxfciodoaDeluvs (0teumim3iu4openlfvsl(farrrumo;u1oex  ictltlsDul(vont0tltoxr ia1la r uei;t0teur(m3oydom nliesasfsDra(ro;o0tleoifctld aDeau p t) ltrxoctatfm  lnvo s) etm(r oo1ll  lnctas) Dtaxroou4oetomiciyslmDrl( sn()trtnifciatlmtr n ilt0t2ur(mpoy1apenlivsl()sDtrx pnu4olenioeiaslsDul(vs (4alxnif io1laD luvsls  etoir3oo1ap e ies t) Drru pot4tlxomieiys a rm(vp u0 lxnif oydoat aivi;s) 2to(o3oudlpen ivta( s2ur( pot4aetnmf3tadla2rmumsnu) rtnmr3io1lmt  ivo t) exoio iy1llt livtasfsDuau  nu1aee ii3tadlmDem(vpnt) lenxrcoadopD li slt0sexmim3nu4optnlfvslt aDurxro;o1apxo oeiasfm rm( p;u0aeenxo3tydlaD  nvo;t) rurxr ou1op  micils  2rmxmpoo1tptomi3tad s rm( p ()altnmfcio1fpDr i o s) exo(opoy4lleemnetltf 2rax p;u4aetoifeiysfa uan p;t0 ltniocty1lp eln s;s) eto(o io1ope lictl(faDrm( o;u4oex ioctadfaDemumsn() lerir3iotlmtrli i;s) ruoxo3ou1opteliesas srur(rp;t1altn oeiatlmDrluvo u0tltrxociy1laD li s s)sruoir3ny1lpt lietas)artmu pou0tlto f3ilslm ul(vsnu4artnxocta1optrauvi s  exr(r3nu1op emnctls)sDrm(rp;o4ope mo3iyd a2eluvp u0 leoxfciatlat  n olt)seumxopiydlm elnvsatfaDtauroou0opt ii3iatls2rl(ms;() ltoioctytfp   u i ()seuo(m3oo1oltnmies t)arum(m ;t0tpenmieiltfm rmnvo t0alenxr todfptrau i (0 rumxmpno1lmt lfctasfaDrm(m ot4opxo ieiatfmDrluvpnu4 renxo tytfptelues;(  rxr(o no1olenmivi s arurx  ot1aee  o3ildfm rl( s;(0texnmo tydlpD livs s0 2tr(m iu4ape  ivia(fsDraxmp;u4apt ioeild s ea( o t) lxrio3totfp e n s s0srxrxo oo1lp  lfci ()a2um( pno0tet  ictas aDelu p t4aetoxrcoo1laDr ivo;t0t2xoxo3ou1al e nct t  2raumpou0optn i3iyt sDra(msnu) ltnio totfaD aieo;t  2ur(opny4lmtnlnei ( sDumxmo;t1tpxo f3iys a rauvp;t) rxnir ty1lmt aues s t2umir iodomtnlfvia(fsDumurpno1apx if3tytlmDul( snt0trxnxfctotfmD auvo;(  exm(m nydlle  ieiat)sDrmxrp;o0teeo octas aDeauvsnu)alxnmf3iadfmDrauei;(  etrxm ou4lle  fetlsfartmxr ;t1opxoioctytla emnmon(0alermo iadlpt lieo;s)teur(mpnu4lp n ieils s2rrx oot0optomocildls um(vont0 rtrir3iatlmD anei (0 rxr(opiy4lpt lieslsf 2rm( p;o4oexoiocils s2em(mp;t)tlenxr3tatfa eai ol()trxr(r3ou1lle mneilsfsDtrxro;t4optn f3tltfm2um(vs;t4 etrxo oadlmteaiesls setoxmpiodlmenlfvtlt srrmx  ;o1altnif3ilsfa2elnvsnt) reoio3io1latraues s  2tm(rpiodlm elfcsls) rtaxm nu1oexnmi3ildlm ea(vs;(4alxrxf3to1fp eaueslt)trto(opoydlle  nvta(  Dtrxrpnt0tlx ifeiaslm2emn onu4 exrio3oa1fpDr iei s) etrirpnudoptemnet s  rrm(  ou1tptn i3tytfsDumu o () lxnif3ty1laDr uvo s) ruoxrpiudlme  ict ( srum( onu4aexoif3tatls rm(mo u)teermr3ia1la eauei (  exoimpiydop emfvsat srtru o;o4tee micils s2umn pnu) ltomoctatoaDrlu s t)teumiopoodol emnviasf Draurp;t0ole mictytla2rmump t4aetoxf3iytfmtr ies s0s2tm(m nudlp  mnvtlsf rta( ooo0olt miciasfsDum(mp;()altrxfcta1omt luvs;t0s2xmxr ny1lltn fesltfaDrmu p;o4optnmi3iltls2em(mo (4aeenir3iotoat lnvsl( trumiopnu1openliei ()s2umxmpno4olxnii3iltlm2rmnmo;()trermoctydlm r n sls s2tmio3ou4ame mnesl() Dumx  ot0apxomieiasfa2um(vp u0alxoifcoytopte nei;t) etoir iu1llt  nei s srumx  ;o0olx mf3tasfm rmnvo;(4 lxrirciytlmDraivi t)t2tmio no4olee icsa( s2uauroot1alx  ociys sDeanvp (0artnxf3iadfatrli sls setrio ou4lptn fcsasf rtau  ot0apeomoetasfa ul( snt4 rxoif oatlateaivs s sruoxm3nudlp   ivtl()s2ra(  ot0aptnioctytlmDel(ms t0aleoifcoydfp   ieils)s2xo(m ou4lltnmieta(farrm(rpno0apto i3iytfs2el(vs u)aeenmoctytfm eanvo;s)s2tmim3nodapeelfeia(f Durxmooo0aet iociasfm2uau snu4tetnxo3oodlat ln il(0trxmio iydam nlictas  rrr( oou1optnmoeiatfsDeauvont)trenifcoy1opDeaivsl()s2urxr ny1om  lfet sf rrrxr ;t0opt  iciydls2uaumo;t4texnxr3to1lm eaivslt0s2xrxm3no4omte ivt (faDtaxronu4olxn ieiaslaDelnmp;(4 rxrxf oadoaDrauei;t) rxo(o3io1ape lfviasfs2uax p;t0aexo feiyd a em(vs (0tltnmr oy1om e u o;t) rxoimpnydlpeemnvils  Dur(rp;u1ope ioeils m2emumpnu)aeeniociadfmt li sl( srxmio iodlmen nciat a2rauro;t0texo fctat a2ra( p;(4alxnir iydopD liei ( s2umxrpio1aleemfei (f Dtmur ot1tpxomf3ilsfmDel(msnu0alerxo iotlatr ues;t0 eurxo3nu1altemnvi ( a2tr(ronu0aptn o3iadfa ra( sn()arerifciodomDrlueol( sexoxr3ou1lm e neslt aDtrur ot4tleomi3ilsfs2uan p t0artrmo3oodop   neols0 eurxr3io4lle miesa(farrm( onu1opt ifciaslm uau snt0tleoif3to1oa elivi;t0teurirpoo1ll e fvtas srtrur nu4tee io3iytla2ul(vpn()treoxf3oytoaDrauvs () 2urio ny4lpt  ncil(  rtm(roou0oexnioetld m2ran o (0 rtrif3iy1fpDeluvs t srumxr nu4ap elfvil(farumx oou0tpxn i3iadla umnmpn(4arxnir3totlpDr ivil(0truoxo3oydoltnmncia() rtm(rp;u4oeeo oeiytfm emu o u0tlerirciy1omte n sl()s2xrxo oudlltemfvs (fsDraxm oo4apxo f3iadfmDea(vp;u4teenio tytfa elueo;s t2trxm oo4aptelnctat  2raxm nt0texoifciysla umnmp t0 rtrir3tadomDraues;s0teumir oydom n ncia()a2tmumoou4texniieiatfaDrmu o ()arxrir3iadlm eaueo;t0 rxoxr3iu4llenmfcs ( srraumono1optnio3iasfaDeluvo (0 lxoxfctodoaDeaieolt0sruoim3ou1al eliet () Drr(ront4tlxnif3tlsfs2ua(vpnt0alenmo3iydlmt an ols0teur(mpiy4opt mnvsatfsrtr( p;t1tpxn fciytla2eanvo;(4tetnxfciodlm  lueo t0 rxm(mpno1lp n ivi (faDtr(r ;o0tex iictls s rlu o;t4tlxrif3oydfpD  nvs;(0t2xoiopoy4lmtnlnvia( a2uaumpoo1apeoioeiltls eauvp;u0altoioctadlm r ivo s0trxmxo oodlpte ieiasfarrru ont4apx ifeiasfa2ul(vont0tetomo oodoaD aivi () rtmirpou1amte fcs ( sDta( o;o4texoif3taslmDeaums;t0arxnxo3todoa r neo s)truoio oudlp e fetl( arururpoo0altoioeildfs2elumon() leoxf3tadlpt lu o (  rxmxm ou4omenmnviatfsDrrur ot4apxnioeild a rluvpnt0trxoifcootfmDr ivo (  etm(mpio4ale  ieiat aDrrxmonu0tpx miciytla2el(vp ()tlerifcoatfpD lnvils0 ruo(o3ou1aptelnet t aDraur nu1ope  i3tadfs umuvpnt)aetomo3tydfa e nvi;t seur(rpiu1lm e ivils a2raum ou0aptnifcild aDean o (4 exrmf to1faDr nvslt0srumim3ou1openmnvtat)s2tmxrp;o1tpeomi3tydlsDelumpn()tlerir tatla eliei;s  exoxo oudameelfci t)a2tmuront0tpeoio3ilsls2uluvs u0arxrir oo1faD  i sl() ruoxr iy4apt lnvi ()sDrmx  no0aeeomfeiys aDrm( p;u4 exnxo io1lmt an o (0 etmiopno1apenmfvt sf 2ta( poo4tpxnifctatlmDelnvsnu) lenmf3ia1fmt livs;s0sexm(m iy4ol elnvia( s2uau oot0oltnmf3ils sDraums;u)artrxo oa1omDeliei;() 2xo(mpoudll  lfes s) rumxro;t1ole mo3iad m raumont0artnir3oy1la rau sls texr(r3iy1lp   nvtat)a2ta(rooo1opeoifctyt s2ean s;t0altnmr3oadfaD li i;s)tetmiopou1amenmici ( aDtax  oo0aetomictytfm2elu o;(4aetomr oydfpte n s;s0srur(opou1om nlfvs t  rra(mpoo4tlxomieiadfaDrlnmp u0tlxnmfctotfatrlivols)t2xmxr nydale  fvslt sruru p;o1tle mociyt a rln onu4aeeoxo tytoptr ueilt setoxr3ny1lm  mfvil()s2rru  oo1alxomi3tadla eaumpnu4 lxnifcia1lpt li i;t0sexrxo3ou4amtemfet s)a2raxro;u0olxoifctlsfaDum(vo u0aleniocia1lpDe ivi (  ruoxr3iu1lmtn iciatfs2ur(m ;t1apx iieiyd mDul( snt)aexrmf3todom rlivsl(0trtr(r iodaptn fesas)arrmumpoo1oleoio3taslmDrlu p (4trtrif iy1la  ln slt0teto(m io1altelfetas aDrm( pnt0altomieiad aDea( s u) lxnio3iotoaD  ues s  2xoir io4ol   fcs (faDtmxmp;u0olt iociys s2rmnmo;u4altoxr tydom  luvils0 2umxrpno1optemnvsl(fa2truroou1tpto f3tatlm2uanvo;() rxnir3ootla e n s s sexm(o3iodape mictas)sDurxr nu0alenmietldfs emumo;u)altnir3ootoptrli ils0 2tm(m3iy4ole lnetltfa2rr(ro;t1tltoiictysla2rmnmp u0artrio3iodomte ues t0trxrxmpiydol n nesl(  rrm(m ;t0opxo fctltlsDuluvonu4artrmf oytfm eln o s0teumxo nydal  livta(fsDrmumpot4opx ioetasfm ua( p;t4aeenxo3oa1oateaivolt  2tr(opny4oleelfet sfs2uax o;u0apx ii3iasls2emnms;t) ltnxrciatlpD ln s t)srtoxo nodop  mfvsatfsrrm(r nu1openif3iatls2rl( sn(0alxnxo iatom e ueol() rurim no1apte nvta(f 2ua(mo;u4alxoifeiadfa raumo;t4 lxrxf iytoptrli i;(0 exoxm3no4al elncs t)sDuaumpnt1tptoiieiytfm2el( ont4 eeoifctadfpt  u s;s) rxmir3nodoltn ncsls)s2urx pnu4opt miciltla elnvp t)tlxrxrcio1lp  lueil( seuoir3oy1ole lnciatf rtruro;u4tpt  ieiltfm rmn p u0 exrif ootopteauei;t  2toxr nodamenmfci (f Drr(mp;u4opxo ieiltfs2rl(mo t0trxnxfcoydomD lnvs ( seuo(o nu1lmte ivtls)arumu o;u0aeenioeiat m2ulu pnt0 eenxf iy1optrau i s)tetrim nydamt livi (f rtrurp;u0aeto octlt a2rln o;u0 etoiociotfpDrauei ( teurxrpnudaltelnctltfartm(m ot1aet  oeiyd s ea(vs (4 exriociodoa raneslt s2xoio nu4optnlnvt t  Duaumpnt4opxn i3tlsla elums;u)aetnif3oytfat luvo t  2xo(o oudap   ncta( srtrum ou1apxn fciydlaDemnmsn(4 rtnmocoo1lmD auvi;s)s2umir iu4am e ieia(fs2umurpnt4aptoii3tadlm rmuvpnt0tlxoio3tatla  an il( texm(opou1alenmicils  2raumpot4teeniiciydlm el(vsn(4 reoxfctadlatrau o () 2tr(o ou4lpee ictl( sDta(rp;t0tptnmfetatfs ranvsnu)areoxocoy1fmD  nei;t0 rum(m oy4alenlivs ( s2uax  ou4tpeomfetltlsDrmums (0 exoio ia1op  lnvi s sexr(opiodopte icsltfartax pou4tlenmictldfaDranvo;(4 rxnxrctatfp e nvi;(  exmxo oydopt  fcslsfaDrmxmoou4teeo ictldls2rlu p u0tetnmociytoa r i i;( sruo(opoudome lfeia()s2tr( pnt1tpxomfeiltls2el(vpnu4 rxrio ootfa elnvo;t0trumim iu4am n fvsat  2tm( pou0oltomieiytfa umu sn(4 ltrir3oatlptelnei;t s2tmxrpoy1lmtelieiltf Drr(mpot0ope moetatfm elnvsn()alermr iytfmte ieo;s0t2tm(rpnudam   ies ()sDuaur no0oet  octltfs em(mo u4 etrircia1lm r n s s0 etmio3iu4lmenlnvsa(farrrxroou4openifeilsfa2ranvp;u)tltnxr ta1fmt aivs;s)t2xr(r3iu4llen ivi t  2um( p;t1aee iiciyd mDrm(mon(4arxnir oydlaD  nei;()sexrio nudlp elnetas)s2um(rpou0tex  fcilsla uln p;t4 exomo3oytlptelnvols)tetm(r ou4am n fctat s2uaur ou1optoioeiad s ulumo;()aetrxo3iotfpt lu slt) rtrio3io1apte fcsls) Durxroot1oee  ietyd m2ranmo t) rtnmfciotlmteanvo s0 rxrxo3oudlmt lfesat s2uau o;t1optoio3tltfaDrlnvpnu4 eeoxo3iatopteli i;t0 2uoio ny1amenlics t srrauroot4texn o3tas s elu s u4 eerxfciy1faDran i;t) ruoxr3nydlm e iet sf rraum ;u0openmociat a uan s u)arxrxf io1fpDeaivs;t)teuo(mpiy1omtnmnetlsfa2ra(r nt0apxn iciatfm2elump;u)tetoxr iydfpDe u i t) 2uo(rpiy4op   nctat) Dta(mpno4teeo fciys a2el(vo;t)teenxf3io1optrluvi s sexmir3oudlpe miesls  2umxrpnu0tleomicildla eanvo;(4altomf3ty1lm e i ols srtr(opoydome  net t s2um(r ;t4aeenmi3tldfa2eanms (0aexrir3iatlm rau o;s0srtoio3oudlpeelneilt)artm(  no4oetnmictld aDelnvo u0 rermr ia1omDeaueo;() etr(r nu4lm   nviatfaDtm(moou1apt mociydla ul( o t0tlenxo oydfp r ieo;s) 2uoxrpnu4op nmictl( a2ta(ro;o0opeo ociasfm2emuvp (4 leoxr3oydfat  i ols)teurxr no4ap  lfetas)s2tmurp;u0oeto i3iaslmDrl( s ()trxnif3iotopDeluvi t) 2trxopiudol nmnvtls)srrm(ro;t0tpto i3iys m2rluvpn(0trenircoadlat au i s  ruoimpoydlle  nei () 2rmxmp;o0apto ieilslmDrm( o u4 lxnxoctodfa   n o;s) rumir iy4llte fcsa()srraxm ou4opeomf3iasfm umnms u4texnxf to1fp  li s s0s2xmxo3nydlleelfei t)a2tm(m ;t0tlxnmf3ilslmDemnmo t0 renmr3ty1lm r ieo s)t2xmir oydlpeemieias)s2rmur ;o1aeeomiciysla2el(von()trermfcootlm eaues;t)trur(r3iy1ll  mnctls)sDua(  nu1tlenmiciysls el(mp u0 ltnmr ia1fptraieo;s0setm(rpoo4lmtnlfeiasfa2taumoot4aeeo f3iysfs ra( p ()tltoxo iodop eaieilt)s2xoxrpoydop  lnvt s) rtr( ont4opxniicildls2ul( p;t) eerxfcty1om eluvil(0srxr(mpoo4opte fcta() rtaumpno4aleomociadfaDul(vp u4aetnircootfm eauvs;s t2xm(r3nydomenlnvil( aDrr(m ou0alxn oeildlm2eln snu4arxoxf3iatom eaies;s)s2xoxr io1om e ieslt) rrax  no4olxn fctyt m2umuvs () renmr3iytfm rlivs;t0texr(mpnudlp  mfesl(  rtaxrpnu1opto feiys sDrm(vsn(0trenmocta1la eaivi;(0 2urxm ou4lpenmfctls)sDtaum oo1tlx ioctadfsDrlumo u)artnir ootlptrlivs;s  2uoim3nydaltn ivt (  ruauroou0tpe  fetaslsDua(mp;u)teerxocoatlpDe neils)trxmimpiu1lp e ivil( aDuaxrpnu0tpenmo3iaslmDemnmp ()artnmf iadlpt livo t)tetmxo ny1om   ici t  2tr(mo;t1ope  iciadlm2rm( pnt0trxnxrctytla e i o ()sexo(r3io1llen ivi s) Dumuro;t1aeeomo3iat m rlnmon(4 rtoxo io1lm ean ol(0t2tm(r oudol elfct s) 2tmxmonu1aetnmfeilsfmDuau p t4aexrmf3oadopD an o () etmir iodll elict (fa2tr(  ;u4aeenifciysfs2umumsn(0tlxnmocoydlatr ieo;(0srum(m3oodlm nlncta(fs2ua( ono1tpe  oeiydls2eanvo (0 ltomrcoodfaDr u s t0 ruoir oydlmee fvsas) rtm(  nt4aexniocilslsDra(vo;(0trxriocoy1lm   i i;t) 2uoio3oydomt  icias)srrau  oo0ope mociadla elnvon()tetoxociy1la elnesls  etm(opiudal   ncsls aDrax pot4alenioctls s rm(ms;t)tlenxocoa1lpD  iei;(0 ruoir3iydlmt lictasfa2ra(ront4aex  ieiysfm2ulu pn(0 rtoxocoy1op e nvi s) rum(o3no1aleemfvslt sDrrumono4tpe miciydfsDulumsnu4aexnxo iy1oat aueo;t  rto(opou1lm  lfvta( sDuaumoot0aee mfctysfa eln snt4arxoir ootfm  ai o s)teuo(r3oo1lpeemivsa(f rrrumpnt4open feiysfs umnvsnt4 ltnif3oodoatraieslt0 eur(m oo4lpt lnesas)sDurur oo1apenmieils a2rl(von(0aeenmo ootfat au sls) ruoxmpnudlpt lnciatfs2umxm ;t4apxoifcildla2uln s;u) lxoir3ta1laDrli s s  2xoirpoudolenmnvias) rtaxr oo1alto ieils s ua(vp;t4 eenmoctydopDeaivi s0setrxr io1opt  icsa(fa2rmx  ;t0olt if3ils mDrm( pnt) renxoctadopDean i s0tetoirpnudlpte icsat sDrm(mo;t4olx ioeiytlsDra( s;(0aleoir3to1omDrluei ()trto(r io4alt  fct ( aDurxrpnt0oeeomfciytlm2um(vp u4trxnxf oodomDr i i;s) 2uoxo no1ap emnet s)a2tmxr ou0tlt mi3iadfs2rl(mpn() rxoir oo1fmtelues;t0 rum(r io4om   ncsl()a2ta( pno1oet mfciadlsDrmnvs;u)texrir tytomtelnvs;t0t2umir ny4ol nmncia(fsDrrum nt4teto feiatla umnvo;t0 ltnir oo1fptrliei;(  2xmxm iy1lptnlfctltfa2tr( o;o0aeen i3iys m uan o t)alenio oytopt luei;t)s2xm(opnu1apenlncsat  2uaxrpnu1ape mo3ilsfmDul(msn() ltrmfcoa1fatraues ()t2xm(mpoo1ap  liesls)s2umx poo0tleo octydfa2ranvs;t0tltoxf oa1fateanvsls s2xrxr ou1apt mfetlt  2tmur nt0oex mf3iad s rm(vo;u) exoxocio1laD aueo;s0 2urxmpiu1lptemfctatf 2rru p;o4apxn o3tadfm2ranvs t)tetoio ootfpDrln o s tetoxr3nodap elivils) rua(ront4altnmo3taslsDul(mpnt) eermr3iydlmD  ivo;t0trxm(r nodlmtemiviltf 2tmx onu4aeto ietat sDemn o;t0 lxomociy1opDe ivs ( seto(r iudlp e fctlsfaDta(mo;o1alenmi3ilt m2uauvonu) exrmrciatlm  anvslt)s2tmxmpiy1olt lneilsfsDrax pnt1tet  octldfaDrmuvsnu)aeerxocoo1lmD  uesl(  exm(o io4ll nlnesat)arurxrp;o4teto octld m2ul(mo;t0alerircoo1lpDr nvs s0srtmxr nodam  micil(fa2rmu  ot1apenmi3iys a2rmuvo (0treoif totlatelnei;t0t2xo(o3ou4om e ivsl( aDrm(monu1oeeoii3ilsfs2elump;u)aleomfciotlptr uei s0t2urimpiudlm   nvtlsfsrtrxmoot4tptoif3iadlaDrlumsn(4 rtrir iydomtrlieol( seuoxo3oydll nmnesls) 2rrurpnu0openmoeiydls rlnvo;() renmf3iodfm   n o;t srxoxo3iu1ap n icsatfa2rmx  ou4aee  oetysls umn ont0aexrxrcoytomDraivs t0 rtm(opnodlmt livtasfsDur(mono0tpen o3iytfm2eln o u0aeeoxr3oadfmDeai s t)t2tmxm oo4ope mfvt s srtmxmono1texo ictltfaDranvp;u) renio3oodfp rlu slt0trum(m ny1ame micsl() rtaumpnt4tltnif3tltla rm( o t4trtoxfctadopt  neslt)s2tm(o nu1lltnmfvtat)srurur oo0oex  i3iys s2rlnvo u4aeenio oatfptrlneo s  etmxr3ny4ape miei s sDtaumoou4olx  f3iasfa2rl(vp u) lxnmrciotfpD  n s t0srxmxmpio4omenliet ( srtm(  ;t0optomo3ilsfs ea( s;t4artnxrcoatoatr i il()srxo(o3ou1lle lncta()a2urxm ;u1aee mi3tysfs umu sn() exrir3oa1fmD ai ol(0 eurxm3nu1openmiesls)sDrrxmoot1aleo ocilslaDulu p;()tetrio3ta1faD  nes;s srxrirpoo1lmee ncslt a2rrxroou1tee ifeiltfa2uluvp;() eerxocoatfm eaies;s0 etoxo io4aptelfvslsfaDuaur ou0aexnmfeildfa um(vonu4 rxoxo3oadfatrlnvsls  rurio3nodlleelnci ( aDtr( ont4tlxoifeiytfs rl(vs;u)areoxf iodoa elivi t)t2toio oydale lncilt arur( o;t1tlx mf3iadla2elumo;()aeermr iatlmDelieil(  rum(mpio1apen fvi s s2rm(ro;u4opt ifetydlm2rl(mp;u4tlerxr ia1omDr uvi ()texmio ou4optnlivs ()artaump;u1texnioctlsla el(mo u0aetoir3oatoa   nvs (0srumio3oo4al elivslsfa2tm(moou1oet  f3tadlm2rm( snu4 leomo3oydomtrlies;t  rumimpiu1aleemfvias  Dtm(mooo1oeen ociasls rauvo (0 rxrmr iy1oa e uei;t0trtm(rpiu1lm n fet (f 2tmxrono1oee mi3ildfs2em( s;(0tlermr ia1lm eau s;t srtmimpoydom n fvsat artmuro;u0aeeo ociaslaDrauvsnu4 ltnmrciy1lmDr u olt sexmio3no1lpt lfvt sfartm(m ;o0tlxo ociyt m ul(vs;() etnio3tytlptr i i;s)seto(o3oydaltnmfcilt sDtm(mp;t0tpeomiciysls2rmn p t4tlxnmf iytfpteanei (0 2tm(mpoydlmenlivi tfartaum ou0aexomoetys aDraump;t) etomrciadomDe i i;t)s2umiopiu4lp  mictas a2taur ou1aexomo3iadfsDum( o;t0artriocoy1op r ivilt0seuo(m oo4amtnlivsl( sDur( pnt1open feiysfa elnvp u)trxnxo3totlmteanvo;()sruo(r io4ll emfet () Draum oo1tleo ictad mDrl(vpnu) exrxociatla  lneolt  ruo(r iodap emnvtls s2uax  no0tpen iciytls2umuvonu0 ltomoctytopDelies s) rto(m3nydlmtn icsa()srtmxm no0aeeoif3tatfs eln p t)alxnmoctodlpt  uvsl()t2trirpio4ap elfcs (f Dtauro;u0oetnmo3iytls2eauvpnt0alxoircoy1oaD au s t trxrxmpoodopenmncils s2rmu oou0ole if3tas a el( s;()artnmf3totfa e u i s truoxopiu4apeemivi (fsrrau pnu1aetoifciydfm um(monu4alenmf iatfm  livi;(  rxo(o oo1ome  nei s  Dtmurpno0tptniictlslm ulnvsnu0 rtrxr iotlmt lnei t)s2xrir3oo1al nlfvi s) Dta(  ou4oetn oetls s2ul(vs t0artoif3iatomte ivo (0trxm(rpnu4apenlivsls s2uau  nt4aptoifeiasfm2ul(vpnt) ltrxocoydlat auvi;(0 rxm(m ou1olt livsas artrurp;o4apto f3tls m ra(vo;t0 etrxr tatoptrli o;( sexoir3nu4lm emnciat  rurx  ;o0apeomfciyd sDem(mo;t)trenir3iytoat li slt0srxmxm ny4ll  mfet sfsrtmxm ou1apxo ociytfaDul(vs;t4teeomfcoodfmtrlneol(  eumio ou1ame  nctas)srra(rpnu4tpxnmi3tlsfm umnmp (4trtrifciadlmte i i t0 2umxo3oydlmt lfeslt)arta(r ;t4aexo o3ildlm um(vo;t4aexrmr3todopD ai il(0trxr(opio1lm  mfvt (fs2rrxrpnu4opx  icildfmDumu sn(0aexrioctatlat lieo;s  2um(opny4ope lfvsl(fs2umxmoot1tetoifciyslm raums;(4teenxocio1oatrai i ( t2toimpnu1omee nciat)s2raxmp;o1opt  ictytlaDrmu s t)tetnxf3tadlptelnvi;s)trtm(rpou4alen iesls)artaum ot1tltniictaslaDeau pn() lxnirctotfp e ivo;t0setoxo3iu1lmtn nvsas)s2raxm ;t0tee mfciadls2ra(vs u0tltrxf3ootlp  livol(  exmxm3io4lm emnesa()a2tax p;t1apt  ietlslm rmu p t)aeenxf oodlatrai s;(  rumxr ny4ll e iei ( sDta(rp;o1oltn i3iytlmDeaumpn(4tetoir3ty1fp rau olt) 2xr(o iudaleemfcil( srum(root0olt ifciad m uan o t) etomf oytoaDe uei;s0 2trir ou4altelnvsas  2uauronu4aeeo oeilslm rauvp t4treomfcoatfpt  ivi;( truoxr io1op  miei t  Dtr( o;o1oex iociadfs rlu s u0aexoxocia1omtrln s t t2trxo3oy1alt mfvtl(  ruru  ;o1apxnmf3tydfsDumump t4alxoir iadfmDeaneol() 2toiopnu4opee nvsas s2rru pot1oetoiiciad m2ra(mp;t0treomrciytfp eaivols)trum(o iodopeemivtlsf rrrxm ;t4tltomf3iysls2ua(vo;t)tlxnxf oadfmD lueo;( t2xoxrpou4al emivs () Drmu pou1aeeoioeiytfm em( s;t0texniociodom  ai il( seurxo3iudal nmfeil()sDur(ro;u1ape ii3tlt a2rluvonu0 etrmf oa1fp  aivo t0 rurirpou1lpenlivilt sDrax pnu4aee mieiadlaDul( pnu4tlerif3ootomDrlu sl()sexrxr iu4lle  icsas)sDtm(mooo0oetnmi3tytlaDea(monu0arxoxo3oatla elu s;s texr(m3oudolt lnet (fsDrau p;u1aetomo3tydfsDrln pn(4 etomf ootfmt  ivo;s  etrim3oo4al nlicils a2tm(  no0openmo3iysla2rlnms ()trxrxfcoytlat au ols0s2xoio oy4ale lnct t)srrru  ;o0tpe  o3tlslm2uln o;()tetoif tydfpDean o t) rtm(o nu4ll elncsl()aDua(m ;o0apxnmoeiatlmDulumo (0trtomo ty1faD anei t0t2umirpny1om   netls)srur(mooo1tle mfeiyd mDeanvs (0texrio3totlpDeanvo s  exrxmpoudal   fctlt  Dta(mp;o0openioeias m2umnvp u4 rxnmfcto1oat an o;t tetrxopoo4opee fes sf 2uaurpno0aeenmfeils m2ua(mp u4 eeoioctodlpDraivolt0 exo(r3oodomtnmieils)aDurur ;u4apeniieiasfa el(mon(4 renmocoy1la rluei;t0t2trirpoodlm nmfviltf Dum(mont1oex  i3tldls uluvo (0aexnxf oo1fp e nvsl( srtmim oo1alee ncslsfarur(mpou4ale mfctadfm2rm( p;u)tetomrciatlatr n slt)t2tr(opny1oltemivi t aDumxmpnu1apxoii3iltlaDrm(vsn(0arxnio iydom rauvs;s trtm(m nodom n icsl( arumxr ;u0tpxoio3iytfm2elumsnu)teeoxfcoydlpt  ivsls0 rtrxrpiy4al  mnei t s2tru  ;t1optomiciysfs2eauvpnt4altoxo3ia1fp  auvo ( s2tr(opiu4op   ictltfsrrr( o;u0tlen feiadfsDulnmo u4 ltrxf3totfaD an i;( t2xrir oodol n fcs ( s2rau o;u1tlxnmoeilt sDul(vo u0 rtrxr3tatlatrluvslt0sexo(opno4ope  fcs ( s2umx ont4alxo oeiasfa2emnvonu0texoio3oodla eluvolt  eto(m io1op n ncils  Dtmxm ot0optomf3tatla ranmp u0trtoir3iy1op rln o t)srtmxr iy4opt mnvs s aDurxmpnt4tle mfeiasfm2uauvp;t4 rxnif ty1fa rlu ilt0srxmio3nu4lpeelnesas a2raxront4tetniictlsfm ul( o u4artnif iadfpD  i slt) eurio3oydolenlivsls)aDrau  ou4tpeo i3iatfaDrauvs;u4treomr3oodoaDraivs t) etrio io1ll   ieilt aDtru pot4apt io3iasfmDra(vo u0alermo tatlaDelies;s0s2xmir oy1ap   ivtat aDrm( oou1apx mieiydlsDrmums;t0aetoio3iy1fm  lu ils  rxrxopiy1lmtemfeiasfa2uru  ;o1aptnmictldfs ea(mon()trerir3ia1latr nvols0 2tm(r3nodlmtnliesat)arumx oou4olxniicild a2el( s;u0aetnif io1lmteln s ( srxmxm iydalt lnvs s)sDua(m oo0oexomictyd sDumn o t0 etrio3oa1fpDe uei (0 rtmir3iu1op nlivtatfarumumono1aet mfetaslaDumn pnu0aeerifciydfp e uvs;()s2toxo3iy1altnmiciat s2ra( pnt4ape mfetydfaDul(vsnt0arxnmo ootfaDe nvs (0t2um(mpny4al   icsls) 2ta( p;u4opx  fciltlm rm( s;u)tlxoif oatlm raueo t  rxoirpnu4altnmnvilt) 2rr( p;u1olt mietydfaDemnmo;()aexrxf3oadlp e nvi s)teurim3nydlme liviat a2tm( oou1olt moeilsfmDrmn s;()teerio3oodlaDeli i (0 ruoxo iodaleemies sfsDtaxro;u4oex mfeild a eanmsnt4aetoxociatlptelieslt0texmxmpiy1omeelivs sfaDtmxm ;u1aeenmietltlmDul(msn(4texnir3tytlmDe uvi;t)trxoio3iudamt mivtls  Dtru  ;o4tetomiciltfm el(mo;u4aleoio iodop  auvs s  etmiopnu1am nlncslt) Dta(rp;o4tptnmieiad s emnmp u4tlenir3ty1lmD  ivilt)s2umim nodll elfvt (f Duru  ;u1oetnmicilslmDumuvp;()altomfciy1oaDe i i;()seur(m iydome lieil()a2rru  oo1aexo iciys a umnvonu)aetnmfcootfa eai il( s2tmxo iy4omen nctas)a2rr(mpot0aetoioeiadfs rmu o;t4 rtnmrciodfaDr ivs ()truoio3oy4ll e ncia( a2urxmo;t1tlen i3tldla2rauvont)tetnmr3oadoa elueo;( trtrimpiy1amtn feslt a2tmu  ot4optomf3ildls2umnmp (4alerxf3tatomtelnes;s) 2uoxrpno1lme  netas)artruroot0aptnmoeildlsDuauvsnu0tlxoifcta1opte i o;()sexrimpnu1lp e ics s)aDumxm ;o0olxo fciadlmDelnvs u4 reomr iy1la e ieo;(0tetoxmpoy4ome lnetlt)aDrr( o;u0oetniieildlaDra(vs (0 eeomo3ty1oa e n olt  rumio nydolee fctls  rrau pnu0apx mietat s rlnvo u) renxociatfmDeaneslt  rumxo3no4lltn ivils) Drmxrpnt1opxo fctatlm2rm(vsnt)altnxocoa1faD au il( t2urio3oy4ap emnvs t  Dta(m ot0tlxoiociytfs rlump (4aexrxoctydopt lieol()truoxr3nudlptn fet s)s2tru pou0aee mfciadls2em( p t)arermrciodoaDranei t s2triopoo4llt licia()srtmxrooo4tee iociad a2ra( pnt)aexnir3to1fptelivo;s0 rtriopiydomee ivsls aruru onu1tptoio3tytlsDea(mp;t)treomr oatfa   ivs t)setm(o iu4omtnmivil(faDua(r nu1tltomoctat a2ea( pnt)tetrifcto1la  lu ils  etoxm oudam  lnet ()aDraump;o0tlxn fciad sDul( s;(4alxrio io1lpDe ieo ()srtoxo3iydamtemncils  2rr(m ot4olt moetydfm elnvp (4artoif3iadfpDeauvslt)trtrxo3nu1ap nmnvilt) Dtmxmpnt4opt io3ilsfmDul( snt0 rtrmr iy1lateluvo s srto(m oodol  lfcs s) rum(m nu0texomoetyt mDuanmo;u)tltoio oa1opt aieils) etoxm3nu1alte ncsas srtaxrpot1aee  icils a uln s;(0trtrmf3io1oaD  nei;( trtmxmpoo1oltelfctat artaumoot0tpenmfciytls rmump;(0 ltnir3iy1op r uvi t0t2um(o3iy4ape mfctat a2tr(ront1oee iociltfs emu p;t4tlenioctytfp rluvil( s2to(opoy1apee ivtat) rtr(ro;t1tpt mo3tydfa um(vs t)arxomociotop rlueo s)srto(o iy4optnmncs sfsrtrum nu1aptnifctyt aDul(mo;u4arxoxf3ootop e nvsls0teurxmpoy4opeemneta(f 2uaxmp;t1oltoioctysfm2elu s () reomr3iadomDrlivolt) 2xoir3io4ale  icsatfsrtmx pno4tpe mietasls emn p;u0 rtomoctadom  anvs;() rxo(m3ou4lm elivtat)sDtr(m ot4aptnifeiyt mDrl( pn(0alxomr3oodom rlnvsls srxm(rpoydope miesl(  Dtm(mp;t0oeeomietldlmDuaums t4tltoirciy1omDraivi t) 2trio3io4oltemicsa( srtaurp;t0tlxn o3tyd mDumnmo (0tlxrmoctotopteai o;( s2trim ou1lme  fvtl()aDrmur ou0aee  oetytfsDrmn o;()trxoiocoydfaDrluvols)teurio3nydame  fvsls)sDurxmo;u1altnioetys s2rlu o;t0 rtomr oy1opDe n i;t0 2um(rpnudop   fviatfa2tm(  nt1tpxomocias sDemuvo u0tetoxo3oo1lpt  uvo ( sexrxm oy4lmt  ivtlt)s2tax  no1tlenio3ildfmDul(vonu0tetomf oadom rlies;s  exr(m no1alen ictatfs2ra(  ;t4olen ociys mDumuvo;u0tltomo3oo1laDe uvi;s)t2urxm3iy1lpen fvtlt) rurx  ot0oetniiciydla rluvs t0trtrxf tadop elies s  etrirpiu4op emicslt  2rmxmo;o4alx mo3taslaDelnms (0altrifcoytlmDean i s texrxr ny4ome mivtasfa2urumooo0olen ociasfaDuauvsn(4tlxrioctytfat lieo;s)setm(o oy1om   ncia() rtrxm ou4oetnmi3iyd mDel( pnt) lenxf totfa   ivs;(0 2xmir3no1lmtemiei tfs2tmur ou0tetnii3tys m2rlu o;u)tleomo oytfp  luvilt0trxm(m3ou4op nlivils)sDtmxm ot0aet  o3iys mDemuvpnt0teermf totfa   n i;()texrxmpiydoltnlneiatfa2rrxmp;o1texo i3ildls2ulu s;u)aexnmo oydlm  lnvi () rxoxmpoo4aptn fct t)aDrrxroot4alen f3iyslmDuln s u4tlxoxf3to1laDrau slt sruoxr3oudlm   neils)s2ua( oot4aexnmfetasls2rlumo ()alxnmf3oydfmD li ol(0trtmio oy4llenmicsl()a2uaxm ;u0olt  i3iasfsDra(vo u0trtoxrciy1lat aivs;(  2xmimpou1omeemicils)sruaurooo1oet mocildls2umn ont4 exnmr tatlmDr ivslt) ruo(mpny1om   ies () Dtr( o;t1aex moctls a uan pn(4tetoxrctytlp rauei;( s2xm(r iydlpe mfcils)sDtmxro;t1aetniieiyd s ranvp;t0 ltrmr3tydfpDeaieslt0trxo(mpiy1ap emfesa()aDuru oou1alenmieiytlmDemnvpn()trtrmrctatomtrln i ()seur(mpoy4ale  ici t s2tm( p;t4tptniietaslsDulnmp;t)alxnircoydlateauvs;( srxr(r oo4lme mnviat s2raxmo;u0oleomoeias sDra( s;t4alxrxr3iatoat  neo s0 2xoxopio4oleelfetls)aDtr(mpoo1tlx  o3ilt sDulnmo;u4arxnmf oytopD  ieo;s) exm(o iy1lm   iciat a2rrur ;t1teeniietasla2eaumo;t0 lxnxo3oo1fp rlnvs;s0 2tmxopnodapeelfvil( a2ur(m ;u0tlt ioetyslm rl( sn(4 rtomf iotlmD anvi;s)t2uo(opiudaleelictlt)arrr(mp;u0aet  octad m rlums (4trtrxr3iy1fm r nei;s  euoxr3iu1op  lneia( sDrm(monu4oeenmoeiysla2em( o;u0tleoif todomt aueo s s2tm(opny4oltnmnct t aDtr(mono1altnmfeiydls em( o;t0 lxnmfciy1om ran s t  rtm(m oy4olen nvs tf Dtax o;u0aleomoetyd sDeln pnu0 rtnxfcootomDelu i (0t2urir3oo1lp  lfct (fa2rmx ooo4alt mieildla raumpnu)aetrxf iytoaDrai o;( trxoxm3nu4am emneilsfa2tr(  no4teto fcild a ranvo t4arxrxocoo1op rlu sl( s2xrxr iudom nlncsa()s2tmur nu1oltn o3iydlsDulu o;u4tlxoir io1fmte ivo () 2xm(o iu1lme mncilsfartmxmpno0apt  f3iysls2elu pnu0tlxrxf3oydop eluvil()seur(mpio1lp   netlsfs2uax  ;u0tpe mi3tas s ea(mo u0 lxomr oytfp r nesls0setr(opny1apenlicsas) rrau o;u1apeoif3ilslmDrmnvpnu4arenmo3iytlp raivi;(0seuoirpnudam   ivs s) Dumu p;o4texn fctatfa2emnmpn(4aeerirciadoaDe uvo ( s2xoxr3oy4ole mfei s arur(moot1aexn fciltlaDua( p ()teenmfciadfp r ivi;s0sexr(r iydlpte fvsat)arur(moou1altoiictydls umumo t0 lxrmrctodfm   i sls t2tmxr ny4apt  fesls artrxro;o0aptnmoetys aDum( s;(4tlxriocoa1optr i sl( t2uoxr3ou4am nlnvilsfartm(rp;t4tlxoii3iytfa umnvs;u)aleoir3ootlmteli o;s) 2xrirpnudamtnmfvs (  2rrxm nu1oeeomoeiydla2emump;u4arerxf3oytfp rli o s)truo(m oy4lmte fviltfsDtm(ronu1tet moctld m2rl(ms t4artrifcio1lp eanvil(0trtr(rpiu4ll  mivsas)srra(r ;u0oeeoifetad m2rluvp;(4tlxrio todlm eai i;() etmio iu4lmen ietat sDururp;u4oeeo oeiyt m2umu o;u4aexoxf oydfmtrli i ()trxoxm iudape  icsa(  rrr(mono1tptnioeiyd s ulu snu0artoio3iydlaDe u slt0seur(r3oudapeelnvil(faDrmurp;o1tlxomfctatlmDul(vp u4aleomociytfpDrlnvol(0trxmirpoy1lpe mfvsas sDur( pno4apen f3tyd s2ulnvpnu4tltrmr3iytfate nes;()trurir3nudll emicsls)a2tmxmpnu0tlx  ieiaslsDeaumo (0tlxrxo3ia1lpt auvs;s)teumxrpnydale mfci (  Dtmx pot0tlxomo3ils a2eluvonu) lxoxrcta1fpt ln s s) eumimpnu4ap nmncsas artrum ot1oeenifeiydls2ra(mo u0aexoio tydla r ivi ( trur(m3oy1ameelfvias)aDurxr ;o0oltomociysfsDua(vo u4 etnir3iotla  luvs;s)texmxopnodlltelfetltfarrrxmo;t1tlxo f3iydlm rl(mont4 ltrmociatop ran ils0t2xmxm oo1olte nci tfsDuru  ;u0oexnii3ildlaDumu o;(0texnio tytom   ieolt0sexrxr io1lptn ictl(  Dtrx o;o0olen feiyt m umnms;()tltnxfcia1fptelu o s0teto(m3iy4ope  ivtat artr( oot0apx moeiad sDuau p t4trtoifcoodlmtr nvi;t)srtmir ny1al n iesls)srumumo;o1tee ifciasfa ul(vs;t4trenir3oy1fmDeauvils0 2ur(o3ou4amtnlieta(  rtmxmo;o4tlt  iciatfa2eanms;u)tetomr iatoate u i t0srtm(mpno4op  mncta()aDumur ;t1alx iociyt aDrmnmo;()tltrmf ta1lmDeli o;t s2urxr io1ol elncta(fsDtmx oou1oeeo ociydfs2eanvp (4arenmocto1op r ivo s sexoim nudam e net t a2rm(rp;o1tpe ioctydfsDem(vp u) lxrifciydfaDeai ilt) eto(r iy4amen nvi sf Dtr(ro;t0tpxomoeiat s2uanvsn(0tetnxf3tydfa r iesl(0 exoir3iodom  miviltf Dtmx p;o4aex  oetadlsDelnmo u4aexoxo iodlmD  ivi;s0trtmirpoo4op   ncsl()aDrm(r oo1tet  ieildfm rl( s u4aeenxr3oodfpD li il(0t2xmxr nudamtnlnct s a2uau poo1aptn ietls m uln s u4 rtoxf iytfa e u i;t srxrir3oudal  mfciat) rrrx  ;u0alx iocias a emnvp;u)artoxf3oa1lmD aivsls)t2to(r iodop elnetl()sDururoot0olenmiciad a uluvo;u) lxrmr iy1op ranes;s)t2toxo oydlme mnvs t a2ra(r oo0tlto ictysfsDrl(monu)altoxfciy1fa  auvsls)trtm(o3nu4altemivsat  rrmxro;t4tptnmi3iasla2rluvsn() lxrxr3ootfa  an s;() rxoio3iu1lpe lfeilt)arumu onu0apenif3tyslm2eanvpnt) ltrifciotlmD luvols  exrimpou4lp  lnvtl()srrm(m nt1tptnmieildlaDul( onu)aeerxrctodomtr neils0s2tm(mpoy1al  mfcias)arurxr ;u4tlt  ieiytfm rl(vo t)aetnxfcoo1oaD anes;s  etr(o nodoptelfetas) rrax onu4tpxo fetytfm rluvs;t0 lxoxo3oatla   u sls)truoir oy4ll elivia(fsruaum no1tex if3tldls rlnvpnu0trxoio3iadlpDeaivslt  ruo(r3ny4omte nctasfs2tm(mo;t4tlen f3iltfmDel( p u4 lxoxo3oatlmtr ueo s0srxrxo3oo1ame  iei s) Dtr( oou4ope mieiyt aDrmn o ()artomf3oy1fmDe uvslt) eum(m oo4apen fvil(f 2ua(rpnt1tpeo ociytlsDumnvont4artnmf tadomtrlueo ()trxrxr iy4al emnvt sf rumxrp;t1apx  feiadfm ra( s;t4 lxnxr3oa1fm rln i;s) rtmim io1lp nlncs ()sDrrumpnu1tetnifeiasfa um( sn(0 lxnxociy1fa r n o ( t2xrxo oy1omt lfctlsfsDrr(mpno4altnmo3iadls emu onu4aeermfctydop  auesl(0 ruo(r oy1om   netat)sDraumoot1tlxn o3ild a ulnvon(4arerioctytfmtr ivol(0s2trimpoydlpeelici tfa2tr(mp;o4tpx mi3tatfa umu ont)trxnmo3tydoa rlivi;t)t2uoxr3no4apt  neslt) Durxro;t4opx if3iyd m2eau ont4aexnmfciotoaDr n o t0 rumio3nu1lmeemivs tfa2raxmooo4oeen oeiasls eln p u) leomf oadlmt lnvil()setmiopoo1om elivtls artrxmo;u1texoif3tad m um( snu0 ltnmrctodfpDrln ol( s2xo(o3iodolt  nci t) rrmxm nt4aetoiietyt m2rmuvpnt0arenmfcootfpDr uei;()srtm(m no4opeelnci s)srrmu ont1tpxn o3ias sDrlnmp;u4 ltnir io1omDe uvi t0t2xm(mpoo1op nmfeia()a2rrxmo;u4texo o3ildla2rlump;t)teerio3iy1oaDeauesls  rtmxmpno1opeemiciat) 2trxm no4ope  o3iasfa rmnms (0arxoxf3tytoat  u ol( trtrimpoudamt lncsa( aDraxrpoo0oltnmfctydls2eaump;(4alerxocty1lptelneo;s t2to(m iy4apt lncs s)s2rrum ot1aetomieildfa rlnms;t0 lxrmrciotlm   i il( srxoxr3ny1ol nmicsas) 2uaxrpot4alxnifctadlm2el(vp;u4arxomocoo1fm elues;t texr(m3ou4am e icsa( s2raurpnu4apxnmfciydfm emumo (4altoxf3oa1omtr u o;s)srumxopiydoleemfvils s2rmu o;u0oet ifctltls ulu snu4aexnifctotlp   nvs s) rumim3ny4omen nvils sDrm(mpoo0aex ii3ilsfa2ulumonu) ltrxf3io1lmt anvo;t  eumir3iu4aleelivt s) rua(mp;t1teeoii3tld m2rl( onu) exoxr3iytlpDrlu sl(0srxoio3nudam e fvsasf 2ur(  ot1oetnifctytfsDea(ms (4 eeoiocoy1omDrlnvil( seurxmpou1op   fvs ( sDurxm ;t4aptn f3tasfm2rmnmp;t4alenmf3ta1oa rluvi;t0s2um(mpiydom emfes tfa2rmxro;u0tetoioeiatls2ra( sn()aetoxrcto1laDe u o;t) 2toxmpnu1lle mncta(f rtrx p;u1tlt  ictas m rmnvo u) eenmrcta1oatelies;s s2xrir3no4ame liet t)s2rmx oou0tpe moctadfsDrlump;t4arxrxocta1lmtr nvi;t tetrxo3ou1ameemieslt) rrmx ooo0oet mieils m emn o (0 lxnmf3oydfmDe n o (0t2xo(o oydomen fvt t) 2ta(mont1tpe ifetas sDem(vsn()tltnxoctadfmD lu o;() 2urxr io1lptemnvt s)aDurxm ;t0tex iictatlm ul(mo (0 rtomfciadfa  luvolt0trxmxmpiu1ap  mfvs t)srtm(m ;t4aex ifcils s2uaumsnu0 rxoiocia1lmD luvi;( t2urxr3iu4optnlivsltf Drr(r no4tlenmfetydfm uluvo;(0 lenif3iy1op   ivi;(0 ruo(o ny1lpenlfvt () Dua(  no0tet ioeiyt sDel( o;u4arxomr todoateaieil( setr(r ou4lp emnesat) 2taxmont4oexn fcils mDrm(vs;t0altnxr iodfm  lies (0 rxmxm oodllt mfvtltf rtm(r nt0teeo oeils s2uln p (0 eerxo3tytlpDrlnvs;t  exriopiydame  fes ( srrr(r ;t1ale  oeildfs el( s;u4altnmo3iatop raiesls0t2xo(r3oo1ll  liciltfsrrrx pnt4aptoioeias aDrm( o u0aexoxfctydfa r ues ( s2urxrpoo4omee nes t arua(  nt4tet if3tydfm rmu o t0 exomo3totlmteaivi;(  2tm(r3oo1alenlivtltfs2raxroou0oexniieias sDuan p;t) lxomf oydfmDe ies (0t2toxo oodolen fci ( aDurx ono4tptn octatlm uauvo (4altnio oytoaD  ieols s2xriopiodlp nlncslt arrau pnt0tee iieilt a2eauvs;t) etrxr oo1fp eauvi ( srurxo io4ol e fei tfaDta( oot4aetoio3tyt m2ua(mo;t4alxoif3totoat luei s srumirpoy4ll nmfviat aDurum ou4opeo feilslm2ul(mo;u)altnio iytomD  nesl(0t2toiopou4op emici (fa2rmur nu4tpeomiciatfsDul(vp;u)artrxf3tadfptrlieilt s2toxo3nudlle lnvtl(fsrtrxroot1aee iieildlmDuan o (4tetrxf to1lm  auei;t0 2xr(mpnu4lme mfesls)s2urx poo1apeo feias aDem( s u0 etoxociydfm   ieo t seur(r oo4ameemneta()sDra( pou0tpxnioetat m2eluvo t4aexnir3ty1fmDeln i;t0t2uoio3iu1ll emncia(f 2rr(mp;u0oex mocild s emuvs;(4aetrxr3oodlmDe u i;(  rurio3iu4ll elfesasfsDtau p;u0aeen ociysls em(vp (4 exomfcoatomtrlu o ( srxo(m iodamee ics (fsrta(moot4oeen oetldfaDemnmpnu4tltnifcoo1oa elueolt  2tr(m oy1alen nciat arrau ooo4aeeoifctldfmDuluvs u0arenxo iodomD au s () etr(r ny4omtnlfctl(  rta( pno4opxo ietls sDemumsnt0 leoioctotoaDeauvil(0sexo(o oy4aleelfvt t  2urxr nu1apxo oeiytfaDeanvo t)alxnio ta1lp rlneils)texoir3iudlle  ivi t sDtr(r ou0aeenmf3iatls2rl(mp (0aexnif3iydoa  an ol()seumir ou1ol   nctat  Dtmxmooo4tpt mfciadfaDrlump t0texrmo3tatopD livsl()trurxmpoy4altemncsatfarrm( pot0tet  fcilsla rmums;t4teenxr3iodom rln il(0 2um(mpoy4op n ivsat aruauroou1alxoioetld sDea(vo t) ltomociy1oa  livi s) rxmio iodal n feiat)sDtrxmpou4olx  o3ildfa ul(vonu0 lxomf oodopt  iei ( s2uo(r iy4lp n fvsl()sDrax  nt4apeomfcilsfs uluvon(0arxoif3tytlmDr n ols)trto(m3io1al  mivsatfaDtrxmpoo0ope mi3tldlm ul(ms;u0tlxrif ty1fpt lnvi t  rto(r3oy1olee fcsl(farumumo;t0tltniieilsla2ul(mp u0 rxoxf3tytfm rau s t) 2trxo3iudol   iet tfsDta(mp;t0tetnmieilslaDrl(msnt4tetoir ia1fp eaivils0srurxm3nodlltnlnctl( sDtrxmont0tltn oetatlm2el(vsnu4 lxrxrcoadomteln i t s2to(m3oy1lm nmfesls)s2um( p;o4tpeomi3iad a rl(vs u4 rxnif3totlmD lnvo;() 2umxopoy4olenmies ( sDtrur ;o4tltomo3iytlm2ua( p;t4 rxrxr oodoa e n o;s) 2tm(mpoo1aptn nct tfaDtmx o;o0ale ifciyslaDrmnvp (0treoir ia1fa  luvo s  rtr(opnudoltelfcs tfarumxroou0tpe  i3tls a raums;u0trtoxocoytfp eai o;s0t2xmirpio1optelicsa( a2rmurpoo4oleniieildfsDua( p u4arerio iatlptrai s;(0 2xr(r3nodole  fvs s)sruau ont0aetn f3tyt s2rl( o;t)aexoir oydlaDr ivs;t)sexo(r3ny4lmte iet t)a2tauronu1ape iociyd a2eauvp u) renmfcoy1oaD li ils  etmxr3io4op  livsltf Dua( oot0ape io3iysla ea( s;t0 exrmo3oytfa eln i;t srtrxr no1llt mnvils) 2rru pnt1alxnmiciasfs2uanvp;u4aetoxf3iadlat  uvslt s2ur(m3iy1ole licslsfsDrmum nt0tpe iieiad s2raumo;u4 etomo oytfa   n olt trxrxo3ny4op  miesasfsruau p;o0tptomoctytla rm(vs;(0arerxo3iotopD aueolt0 exr(o3oy4omee nvs (fs2rm(  ou1optnmo3tytls eluvs;u4arermr oo1om rlnei;s sexmimpoy1lltemfet ()a2um(rpnu0oexoifciyd m2rlnvp;u)texoxo oo1lmte ueo t0 etr(o iodllenmies ()sDuax  ;t4alenmf3tyt a uaumo u4aetrxocoatfmDeaueo;s0 2toxo3iu4lp elivilsf Dumxro;u0apxnmfciatfmDrln p (4treomr3ty1lpt luvo t)t2um(o3iodop nmfcta()a2tmxmont4aexomf3tlt s rmumo u4 rermo3ta1fpD  nei ()trxo(r3oy4llt mnvilsfsrua( pot1oex ioctat s2rl(vpnu0 rxriocoatfmD ai o s0t2ur(r nu1olen nctl( aruaumpnu1oeto f3ilsfm2ra(vs;u)aexrmfcoadlmtr ieilt  exoim no1ale lies t)srrr(ronu1tpxomi3ilsfsDemnmpn(0alxrmr tydfpt aivo;s) rxoxr3iy4ole micsas)srta(  nt4oltoiicilsla em(mp;u) lxnir3oo1oaDr nes t  ruoim3oo1al  mietat aDuaxrpoo1aleoioetldlaDuauvo;t)tltrio3iydoa   n o ( trurxm iodap  lnvt tfa2umur nt4ale mfetlslaDeau o (4aleoif oo1fp   n o;( trurim3oudameelfeiat  2tmu  ou0ole if3tytfmDulumo;t4 rtnir oa1op  livi;()trxm(rpou4ll  lict (  2tmurpot4aex mietadls2ua(vont) lxoxfciydfpDelnvils0t2xr(m iy4amt  fciatfarra(r no1oetn o3iytfa uan o;t0aleomrcto1fm rlivs s)trurir3ny4lp emfctlt  2ra(mo;t0aex mfciytlaDemumonu4arxomf oytfatr ieo ( srxo(opny4ome  fcs s) Dur(mpnu0tltnioetadla2elumonu)altnio io1lm   uvi;t teto(rpoydopt  nvs tf rtrump;o4oltnmieiatfm ean pnu4teeoxo3tytlptr i i;t)t2uoxo3oo1op elneta( arrrur nt4oeenmo3iatfm2ua( p;(4trtrxf to1lpD lneo t s2xmir ou4al emies sfa2ra( ooo1opxo f3iltfs eluvs u)aetomrctytfa ran il( seur(r3nudlmte fcsa(faDra(m ;o4opeoioctad sDrmn p;u4 etrmo ty1la r nei;s)setr(r3ou1apte iviat) 2rm( poo0tlt mf3tltls2ra( snu0arxoir3oy1omDelneols  2tr(r ou1ol   fet t  Dtm(root0tpt  i3ilslmDel( p;u) ltrmf3iotfa  aneo;t)s2xoirpio4apte ict (fsDtmu ono0tpenifctytfa2el(vpn()altomo totfa r iei;s0 rxo(opou1am  lnci tf rtmumpno4opt mfeias a ulumsnu)alxnifcoodomDeln o t  exmxo iy1ameemieslt s2ta( pnt4olto octldfa um( snu4 rxnxr3tydfpteliesls)s2uoxr3iodap emfvils) Drr(rpoo0tlx micilt a2elnmpn(0aexnifctadopDelivils)trtoxo3nydlp  mfet t)sDur(rono0altoifctadlmDran s u)altrmfciydlm   u s;( trtoim io4lpeelivta(f 2tmurpnu0alx mfeiydfs rlnmo;u4 lxnir3oy1omtrauvs;t)setrim3nu1omee fei () 2truro;o4optoio3ilslm elu s u0tetomf iotoatrlivs;s0srtmim3nydop  mfvtatf 2rau  ou0tlt iociyslaDeanvo;t4arxnmocoodlatrluvslt  rumir3no4al   nvt t)aDrrxmooo4opxoio3iadls2rln o;u)tlerir3io1lm eai i;s0 eumxrpno1omeelnei s)a2rr( onu1alt mf3iyd a umnmp;(0 rerio3to1lpD  u sls0 2uoiopno1am emfvtls arta( p;o4aexomociyslm2raums t0 ltnio3oodomDr ivs;t srxoir3ou4ap n ncs (fsDrrumo;t4tlxnmiciad aDemu p (4aexrifctydfaDrai s t0trtmxo no4alt lnvsat aDur(ro;t0altomo3iys m2emu onu4trtomocoa1fmtrlneo;(0 2toxr3iydal elnetas) rua(  ;o4tpto fciysfa2ulump;t0tetoir3oadopD aivs;(0teurxo ou1altelnetls) Drrxr ot4ope  fetytls emnms t0 etnxr oodfp  an slt s2xoirpiudlpenmfcias aDtrurpnu4tleo fciat s elnvp t4tetnmf iadlm   nvs t0srtm(o iydal   fviltfaDuaurono4oexn fctlsfa umu sn()arerxf ootlmD livsls) exmio3iudam elicsatf Duax pno1aetoiieias sDeaums ()treniocoydlaD lneol(0 rumxr iodapenmivtat) 2rau  ;u1optn oeiyslm um(mo (0texnxr tatlpteluvs;(0t2xrxm ou4ol n ietl(  rrrxm ;o1opxo ociyd m emn ont)artoircoo1fptrlieo s sexmxm3io1lmee iviat)aDta(r no0aexn fctasfs ranmonu0tetoio iy1op e ues;t0 euoxm3iu1olt  fet () Draurp;u0tlxo fctld m2umnmont4trxnmrciytoa  li i;()trxmir3ny1lm  mies s)artaxm ;o4oex ii3tat s rl( snu)aetrxrciytlpt  n i t0tetr(rpiydlm emietlt) 2uau  ;o1aetoioctydls2em(monu0aexnxfctodlptran o;(  2ur(mpiu1lpe lfvslsfa2ur( o;u0tleomociltfmDuaums (0tlxnio3oodfpD an ilt s2tmio iu4olenlivt (  Dur(moou4aleoiietys m2elump u0texoio3io1oa rlnvs;()t2uoxm io1ll emfvilt aDrmumo;o1aexomoetldfs2rlnvsn()tltnxf tytoateanei;s  2toir nu4lpt mfei t srtr(m ot1aetoifeiasfa2raums;() etoio iadfpDrauvo t)trtoim3iydamen fes sf rum(r nt4aptomocilsfmDuaumpn(0 exnxf oadfp ranvo ( t2xr(m iy1omtelivta( srtaxm nu0tetoiiciydfa2elnvon(4aeenmr3tadoaDr ies ()trxr(o oy4olenlnct s)sDurx  ;t1openifctytls2rluvsnt)arxoxociadlpDe ieo;s s2tm(r3iydllt mivsls)a2ta(r oo1oltniieilslm2emuvs;()altoxocta1fa   u o;( setr(m iudamt  fvias)arrm(roou0tltn f3iydfm ra(vsnu4altnif3oa1lmtrli o;()srur(m3iu4alt mnetasfsrumu p;u0apen ietyt s2rl(vp u0trxoxf3oydfaDraivs (0 rtmxrpny4lmeemnesasfartrxmp;t0oetnmo3tysfm2el(mon()aetnio3oodfpDeanvs s)s2umim oodapt  ivtas)s2rm(rpnt4ole mf3iltfm emnms;(4aeeomo iytlaDrlnei ( srurxr3iy1oltemnvtlt  rtaxrp;u0tpenmocildfm rluvp (4alxomfcootfm e u ils  exrxm3iy4lmt liesa(farrax poo4aetnmf3tys mDumums (0arenmr oadomDelu ol(0sexmxr3oudllenmneias artmx  ;t1apeomo3ilsfmDean p;u4aetnif3iatomDeau o;(0setmxm3iodamt mietls)s2trur ou1tptoifeiat s rluvo t)tltoxr tydopt  nvo;( s2ur(rpny4llt lnes s)a2tm(  nu1oleoiieiydfm rmu pnu)texnxo oydlat an i;s s2uoxo ny1am  mncsat) Dtax pot4opeo i3ildls rmn p t0texrirctytfptr nvo;t seumio oo4lp   icsa(  Drax oou1oltnmi3iytfa el( p;(0teeoif3tytfpteanvilt)s2tmxmpiydlme lfetas) rtm(  ;u4aexn octld a eau o u) ltoif tadfm  li ol()seur(r3no4ol nmicsa()s2rmxmpno1altnmi3iydlm rl(mo;u0treoxf3to1lm   ieil(0 rtr(o3oodolte fci tfa2tm(r oo1teeomi3iyt mDrln o ()aeermo3ia1la   u i;t  rtr(r no4am  lfeiat a2urx p;t0aeeniiciydls2rmuvpnt)tetnifcio1opDr nvsls)trxrxm3nu1om nmfviatf Duaxmoou0opt ii3ias s ra( pnu4tetrmrciytoptraieo t trxmio nudalt  fvt (f Drrum ot1openmfeiat a2um(monu0tltoifciytoptelneo () rtm(r3oydomen feias) 2rrxrpnu0opx mictlt m eanmsnt) rtnmr3oatlmDr uvs s trum(m no4ale mneil()s2raumpoo4aet  iciadfm2emnvo;() exoxrcio1op  aivslt0srtoxr ou1lm n ncslt)s2ua(mo;o4oexoioetatls2rl(vp (4aleoxociotfmD  n o;s  rxr(o nudolenlivt t aDur(r nt1tpt iieiydfmDem( s t0 rerxo3oatlpD  u i;( sexmimpoy4lle  fci t)a2tm(m ot1tptnmiciadfm2umuvo u)trxnmf oodoateaneilt0 rtm(o no1ale  nvi t)aDurxmpno0olxnifciadfa umnvon() lxnmf iotfm e ivs t0trur(r oudll   nesl()s2umxmoou4alxn iciysls rmnmp t0arxrxrciy1fpte ieslt) rxmxm oy1apeelncsa()srumumont4apt mociaslm2eaumpn(4tetrmo oatlmtr n o s) exoxr3iodaltemnet s aDrax pnu4tltniietlt m eaump u0trxrmrctodlat luvs;t s2umim iy1op  mncil()aDtrx  no1apx ii3iyslm emumo;u) ltrmf3iodfpDraieo;t0seumxopio4am n nctls srrrumpno0oltnmf3iytfm rmu p;u0 exrifciotomt auvslt trxr(m3iudlmen nviltfaDurumpnt1tex  feilt m umuvs t0 lxrifcoodlpt  nvo;(0teurio3oo1omee nct s) rtr( poo0tpt ioeiyt aDrluvont4 lxnmfcia1latr nvi s  2ur(o no1ome  nctl()sDumurp;o0apxn feildls2eanvo;t4treoio3ty1la r n i (0t2xr(mpiy4lpe liciasfsrumu pno1ole mociyd a rlnmsnt0 lxnio ootfmDeaueo;s0srur(o nudlpeeliesas)sDrmxmpnt1tet io3tldfs2rlu p t4 eerxr oy1fateaieol(0 2xr(o3oo4amenmicslt aDra(  no4opxnif3iaslaDul( p u0artoif iodfp   ivolt)t2toxm3iu1oltemiesa( sDrrum ;o4ape  oeildfm ean ont0 eeoxrcia1lp  luvi;s0teurio3iu1ol n ncslt)a2trumoot0olt mfctyd s2rau snu)aexomf iy1lpteai s;s s2xmxmpoy1ome  neilt)artau pou0apxo fetaslsDeln s;(0tetnxrciatla  lneils0trxm(mpoudom   nviat  rurxmonu0texoioetldfaDul(mp (0 renmo3oa1omDranvolt) etoxmpnodame lnvi tfa2ur(  ot1alenmf3tad a um(vont)artrio3ta1laDeanvolt0 exoio3iodolt mfesl(faDumxrooo0tlxn fciys aDulnvs (4 eerir iydoat au ol()srurio iydlm nliviasf 2urxm ;o0oeto feiydlsDea(mo (4tlxrio iy1lpD  ieols s2tr(m iodaltn ictl(faDurxm nt0tex mf3iadlmDra(vp;u4 exnio todfp rau sls0sexo(o iy4lle  ieilt sDrruroou1tpen fciyd m umuvo u4aetomrciadfaDr n s;s0teumxm nu1lp elnvt s  2rr(mo;u1openmoeiysfa2el( p;t4aexoxf tadop elneo;t sexr(opio1lmte nes s  Duaum no4tex moeiytfm2emu ont0tlxoxo3oydfat lnvs ()t2xoxo3io1amee fetas)sDtmump;u0tetomieildfm em( o t4areomociydfaDelieo;s t2umxo3nydameelivsasfartmx  ou0oexn o3tydfs ran s t0tlxoxr todfmteluei t0setmxr oy4lptnmicsat)s2rmumonu1oeen fciysfa rlu pn(4tltrxo3iydomD an sls  eumim3iy4lle mfvt tf rum( p;o4tptn fetydfmDum(ms;u)altomfcoa1op  anvi;s)trtoxrpoydole mnvi t)srtru pno4tex mociytfa2ea( s u)aeenxrctatlpte u ols) exrxr oodaptn fvslt  Dtmur ;o4aet  ocilsfa2el(vpn(4tlenifcoo1lpD lu o;()trxmxr nu1lm nmfvsas) Dtaumpnu1aeeoiieias s rmums;(4tltniocia1lpDean i s trtmiopoy4olt lfciltf Drr(rp;o1aetoio3tlsls2emu p;()aexomr tydfateai i (0teur(rpno1ol  lnetltfs2urxr nu4olxomi3iyt sDrlnmpn(0trxri
\ No newline at end of file
@@ -0,0 +1 @@
+n ilt0 rxmxm nodam eliesls  2uaxm oo0aex  fetadlmDumnmo;t)artrxfcoytfa rauvo;t) eurim3nudape mnvt t srtrx pno1olt  fciasla umu snu0 rtnmf ty1omtrauvsls) 2xoxmpou4omtn fvt ()arua( ono1tptoioctat sDuluvsnt0artnirciytlatr i ils0 exm(r oo4lpe mfvs s)s2ur(mono4apx ioeiatlmDuauvont)trermfcoa1omtrluvols0srumxrpiu4ol elfctlt s2trurooo4tpt mi3iat a2rmuvonu0alxniocoatlatelu o;(  rxoxm3oo1omeemfciltfs2ua( ont1aex  i3iasfsDem(mp t0teenxo3ia1lmt ln slt  2xo(rpiu4ol nlnvta( srrmurpnu1aexn f3iytfs2uluvo u)tleoxo3ta1opDelueslt0trur(r3iy1omtn ics (f 2trur ou1tpeomf3tat m rmnvs u) lxnmo ty1oa rlu ils0s2ur(o iudolt  fci s)a2umxr ;t1oetoifciyd a2rlnvo (4trenif io1om elieo;() ruoio iudol   fesls)arrmumonu4alxniieiytlmDuaumo t4tlxomr3iotfpDrlnvs t0 rurim3iodaltn nvsls  Dra(moou1ale mo3iatfa uauvpnt0teenirctadlmteli olt  rurxo3oydopeelietasfarrm(mont4oleoiietldfaDelu o;t0arxoxfcoodoa  aivilt0s2xmxr iy4apen neilt a2rmxrpot1aexnmo3ilt sDranvo;u)tlermf ty1lmDelnvils0 etrxm3iu1lmee fcias) ruru  no1oeen oetysla uanmp;t)tleomrciatlpD  n s;t0teumir oudoleemnei s) Dta(r ;t0tpxoiictldfs2ul(mo t)aleomr oa1lateanes t sruoim3oo4lme  nci t)srra(m ;o4tltomo3iysfa2umnmp t0 eeoio3iy1oa   ivolt0 2xmir3iu1al nlnvsatfsDta(roou0oet mietatfm elnvs;(4 etnxo tytlmD lneil( t2xoxo ou4amtemict (farur(mpnu0aeenifciys m umn o (0texnxfciytopteaivils s2umirpiu1om e fvsatf rrr(  ;o0apeoif3iad mDelnmont0 ltomo totlmtr iei;t0t2tm(rpnydole  nvtasfa2umu ont1apxnio3iatfsDrl( p;(0trtnxocoadomDr uesls) rtm(o no1ole lfetltf Dtau o;t1ape  feiytfsDrm( snt)arerxf iodlp e nei;s0 exmirpiy1olt mncsl() Dumuro;u4aptniociys mDuluvont4teenxf3ta1fa  luvilt)seuo(mpoo1oltelnesa(  2um(rpoo1oet iieiytlaDumnmpnt0aeeomf3oadla  anes;t0setrxo3ny4al nlivsas)sDrm(r ot1tleoiociasls2ra(vonu0 rtrxfcoytfmDrluvi (0sexrimpoodom  mivias a2raum ;o1oexnif3iyt s emumo;u)arxoxo3iy1omD  uvi s)t2xmiopiodllen feilt) Dtm( pou0optoii3tytls2emumon(4aetnxo3iytfaDrlnvols0srxm(mpnu1ape  nesl(  2urum ;t4opx io3ias a2elumo;(0arermr3tadfm r uesls  2tm(rpiu4llee iet (  2rrumpou4opx io3tys sDra(mo;t4altrir oytfm e uvs s0t2umiopnudlleemnes (fsDtrxm ou4tlt mieiadfa2rmnms;(4arenxr3ta1lat anvo;s)trxo(r3ny1ll n fvsas s2umx ono0aetnio3iaslm ean pnu)tltnxo3tatomt anvo;( s2xoxopnydaptn iesas)a2rrur nt4opxoifeild m um(mp;u4 exoxo3to1fm rai il(0s2xrxmpny1apenlnviat)a2urxmpnt1aexnii3iydla2umn p;u4tetoifcoydfpDeau o;( seurxrpiudlpenmfvsa()arta( pou4oeen ietyt s rlnms;(4tlxrxfctytfatelneil( s2uoimpou4amtelivi t  2ta(  nu4tpxoio3iyt m umnmp (0alxrxfcoy1fpDr nvi t0s2umim3iu4al  miet t)srurxmpot4aex  fciasla umn s u)aeermfciotfmD  ies;( texoimpny4altn ncs ()srtmx o;o0apen f3ias s2eanmpn()artrxfciydopteauvils)t2umxopnu4lle  fcilsfsDururo;t1aexnifctys sDrl( sn(0altnmf iy1fat  n i () 2to(m3oodlmtn nvs tf Duaumpou0optn feild m ul(vs (4aeenxf ta1fmDrln o;t0teumirpnu4omtnmivslsf 2rrxmoot1ole  i3iasla uau o u)arxrirciadfmDrluvi;t texmimpoo1apee ivtls aDumxrono4oex io3ildla2elump t)texnxf todfpDeaies t  2urimpiodlm   iesas) rurxr ;o1tptoiieiltlmDuaumsnu)trxrxf3iadomD ai sl(0 exmxr no4ame lnet s  ruax  nu0tltoiieils a rlnmont4artrxocto1fm eln olt0t2urim3oudamtn fesl(  Drax onu1tex mocilsfa rmu p t4 reriociadlatean i;s  rtoxrpno4am  mfcsat)a2umx  ;u0alx  f3tldlaDrlu pnu)arxnio iydfmteau i;( texmxo3ny4omtn fct () rurur ;t0oee  oeiydfs eln snu0tlerir3oatlateli il( setmirpny4lmte fcslt)s2urx ono1open i3iat m2uln s;u)aleoxr oo1fa eauvsls0t2trxr3oodapeelnci t)a2trx ooo1aptoifeiyd s2rln s t0trtoir3tatfa elivo t)texmxr nydamen ieiltf Dtau o;t1ale iocildfs2eau o (4 rtrmf3io1fa ran sl(0t2trxr iudlleemfct s) Duaxr ;t4olxo fctytls2ua( pnt4texrif3ootlmD auvi s0trtoiopoy1lme lfvia(fa2rmur ;u4tpt iociyslm2rau s t)texniocty1fmtr nvo s)sexmxm3ny4llen iciasfs2tau poo1oeenmi3tydfm emuvont0arxomr tadfptrluvslt  2xoxrpou1lp e fvtlsfsDuax onu1aptn ieilslmDemumsn(4 rxrir3io1fp  auei (0t2xoirpny1om emnet ()srtmxm nu4tpt moetlsfm rauvont4trtrir iadop  lu s ()s2xrir nydlpt lfcs s) 2umxmoou4aexomoeiadfs ranvpnu) rtrxociadfpDr nvi s0s2umirpnu1apte nviatfsrtaxr no1oex  oeildfm rm(vsnt0 leoiocto1fmtraies (0teuoirpnu1lp nlnei () 2rr(r oo0tpx iieiat mDeaumonu0artrir iy1opt lu s t trxmir ny4lptn nvsls) rrrxmpnu1aetoioeiydlsDranmsnu4trtoxocoadlaDe ues;s) etoir oudame lfesat s2um( o;u1optomfciat m el( s;u)tetrxrciatop e ues;s0srum(o3ny1lptnmici (  Duaxmpno0aexnmfeiat m2emu o;u0 rerxo tydfpDr ues;t0 2uoxopiy1am emivt sfs2rax oou1tee ioeildls2uln snt4 rtomf oydoaD lues s0 etriopio1am   ncil()sDtm(r ;u1alt  o3tldfa ean s t) lerxo3to1op   u s;( s2ur(m oy4altnlivtl( sDumxr ;t1opxo ietadfaDraumo;(0aeeoxrctatfpD aueo ( srurio3nu4lle lfvt s)sDtaxr ;u0olx mociatfmDumn p t) ltrxrcoydlatrlu i;()t2xrxr io1lme mneilt)srum(m nt1opxo i3tydfaDem(vs u0 rerxf3oa1omD lueo s0srtm(mpiy4lltelfes t)artm(m ;t1tpeo i3tadlsDua(vp;(0aexrio3todfatraies;s0t2urxo ou1lme  fcslsf Durum nt0tptn ietldls ulnvo;()trerxo to1fmDr ieolt)trtm(mpoydamtnlfctasfs2umu oot0tpenmoetasfm2rmnmp t) exrxf3oatopt anvo t  rxrxmpiy1lmte fesat)aDtmxm ;u1tet io3iysfs rm(vo (4 reoio3ty1lpteanvslt s2toxo nydlptnmieslt) rtm(rpnt1oltnmfeiysls rauvo;u0arxrif todop eauvo;s0 euriopnudlp   ict (f Durumont0tpenmfciadfs2rm(vs;t0aeeomf3iotoaD an o ()srtmxmpou4al  livs t srtr(rp;t0tpeomfctltls2uau o t4treoxrctodfmteau i t) exo(mpio1lm e nvsasfsDtr(mont1texomfciasfs ulnmpn() eerir ty1fptrauvil(0 2uoxrpny4apte fviat aDum(mooo0tetniieiyt a2rmump;t4tltoif iotoa r neilt sexrxr3oo4apenmfetls)aDumxmpot0aeen ociltlm rmu pn(4 ltoirctydomtrli o;( t2tmim3ou4ape lies ()sDtmur nt0olt ioeiyslm2uauvp;(4tlxriociadlmD  ueo s)teuo(r ou1op e iei tfsDrax o;u0texomieiyslmDuau o t0areoifcta1optrln o (  2trxm nu1aleemieslt) 2ur(m oo1olxnifciadfs em(vs u4aetnmr oadom rlnes;t0t2trio3io1al emics sf rrm(roou1tet ifciydla2raums u4 rtrmf3tytopt  i olt  2xm(m3nydomtnlfet tf Dtm(mpno4oex iictlslaDrm(mon()texoxr3tytoptrau sl(0s2toxm nydlmt mnvtasfsrumump;u1alenmo3tysfs ulu pnu) exoxf3iydoat an ils) rumxr io4ome  net s a2rm(r oo4ole  f3tlslaDrluvsn() eeoio3oytlaDeaueol(0sexo(r3iodolt lnvias) Dur(  no0optn f3iadls eaumont4alxrio tytlptelnvsl()trur(rpio1lm emncsls)arrmxrp;o4opeo ietyt a ra(mo t0aeenxr3tatfaD  i o t) etm(m3io1lpte icias artruroot1alxoif3tltlmDrmumo;u0tltnxfcoatfaDeai ils  exmxm oudom e fvslt)srrrxmp;u0alx mociys mDrmnvp ()tlxnmf tytlm ranvs (0tetrxo3nodllt mfcsa( s2ur(r ;t0oex io3tad m2umn s;u0 rxrio3oo1fpDe i i s) rumio ou4amtelneta(  Drm(  ot4aptoii3iydls2ulums;(4 rtoif3iydlp elnvs () 2xm(o3nudalt lnvilsfa2ua(  ;o4aeto ociydfmDulu on(0tlermo totlaDeau i;t)sruoim nydaptnmnet (  rtrxro;t0apx ifcilsla ra( snu0 rtnxf iotfmDrln o;() 2trirpiu1om  mfcil( srtr(r ;o4apeniieils a uau p;u4alxoxf iodfp ranvolt srto(m3oudomtelfciasfaDtax  ;u4oexomictaslm2elnvs;(4tltnio3tytlpDrlieolt0 rxmir3nodaleemietlt) 2taurp;t1aet  oetyslsDuln pn()teeomr ty1lp rlieslt)s2urxr nydomtnmnet (  Drmumoot1teto feildlsDum(vs ()altnif3tadfmDeaiei;()trtm(r oydoleemnvi tf rra(rooo0texomo3ildla rmums u0 eenmr3iy1fm  lueo;(  2tm(m oy4optnlfctl(f rtm(m no0teeo ieiat s ua(mp (4 rxoxr todfa eluesl(  rur(r iy1optnmiei sfs2rr(r ;t1aexn o3iysls umums;t0tetnmfciodlat  u i;s0srxo(m iy1opee ivt (f rrm(mpot4apx if3iad s2um( o t0tetrmf3oadfat ln ils0 2umxr3iu4oleelfvt s)aDta( ono0opeoio3iltfaDeaumo;u4teeoir oodfm r u olt srurim oydop emnetatfarrrxm ;t4teto iciys a rlnmpnu0aexrmf3ia1om e nvsls)trtm(r ou4om n fetat)srtax  ;o0alx  oetat m2um( s t0teermocoatfm  an o t  2uoxmpio4om nmfctat)sDur(mpou1tetnio3tltlm raumsn()aetoxfcia1faD  u s ( setrio3iydop nlnesa(faDtau pno1aex mo3tlt sDelnvp u0tlenxf oodomDelivsl(0trtoir io4lleelivs s a2tmx  nu0tex  o3tld mDrmn p (4trerxo ta1oa elnvo;s0t2um(o3oy4lmte ivtlt) Duru o;u1alxoifetltlm2rl(mp;(0arxoxr3ia1oa elu s ()s2toxopiudamee nctl() 2ra(  no0oee if3tldlaDrl( on()treoirctytfmtrluei t sexr(opio4altn iesl(  2umxm no4opxomoetldlm2rlump;u4trxomr3iodoateai o;s  2urir oy1llt livsat)srra( oot1opxo ieiysfs umuvs () eenxrcoa1fatrai s (0s2umxo3iydom nmivsas  rtau pot4alen feiyslsDrlumpnu0tltomf iodlp eanei;()srtrio nu4op nlnctat  2uaxm ;t4tee ioeiat mDulumpnu4 rxnif oa1fp e ieol( tetoxr nu1ol  lfvia(  2ua(rp;u4texnif3ilslm2umn pn(0alermr oydoat auvi;( s2uoxm nu1ol nmfcs ( arrrxmo;t0aleoifetys s ra(vs (4 etrmr3iodfa  lueils)trtoio nodamee iesas)s2ta(rpnu1tet  o3tyslm2ua( s t) lxrmfctatfp eaues;( t2ur(o no1omtnmnvsl( arumxr ;u4tptnii3tlslm um(vsn(4 renmf tadla e ivsls)t2xrxm3io4aptelnvt (f 2rrumoou4oeeomfctas a uanmsnu) etoxo3iatopt lneol(0srtoirpnydole lfesl(fsrtmurpoo1oee  ictldfaDem(msnu0aexrir3to1omDr i o s trur(rpoodome mfvsl(fa2umxmont0apx  f3taslm2rmnmo (4trenmf3io1lpteai o t) ruo(m3iudap elncilsfaruau ooo4apeoii3tlsla2uanvs () etrxr3tytfa eai ils) exm(r iodlmt lfei t aruaxrpoo0tlt micilt s ran s;() eenio totoa r u o;() eur(m nodlm  lnvsltf 2rmx ont4texo icild aDemnms u4 exrxocta1op e uvo;s t2to(r3ou4lpe  neslt  2ururoot1tpenii3iytfsDrm(mp;u)aexomfcoadfpDrlieo ( sruo(m3nodalt lfctltf Drmum ot4optomiciatfa2ua( snu)texrmr3oa1oaDe ieil(0 etmxr3ou4apeemfeias)srtmum ;u1aeeoiociyslaDea( o t4tlxrxf3tytfm elues;( trxr(mpoodale  nct ()s2ra( p;t1tltn f3ias m2el( onu) reniocoytfmtr ivolt0t2tmir iudaptnmfctasfsruaxm ;u1aexoioetatfm2ua(mo;t4aleoxo3iy1fa e iei;( sexmir3oudlmen ictl(  rraxmont1aptn oeiydfs2rmnvs;t) rtoxr3oytfptelnei;t)s2xoir3io4lptnmfcsat aDrax pno1ape ii3tadls ulnvs u)aexomo3tytlptelu ols) 2xoim3io4lpte fcsatfs2uaumo;u0aeeomf3iadls rmu snu) eerxf iydopDrli s;t)trum(r oy1ope mivsa( arururont0olt ii3iasfaDemumpn() lxnio3oytfa raues;t) etmxmpoy1omte fvsasfa2umu o;t1teto oeild m elnmo;u) rermo oatoptr u ilt0srxrio nu4olenmneils s2tru oou0alto o3ild sDean p t0tltoifctadoa e uvi t0trxo(m3oy4lp  lfctls  2taumont1apt iicild mDeanvo;u0tetrxrcoa1fm  an o;s s2xr(rpno1apenlnvi (  rur(r nt0apenio3iys m rlump;(0alxnmf3ty1oatean i s srxrxopoy4olenlnct tfsDum(ronu1aeen ictldfsDumu o t4alermo3totoat  neol(  2xoiopiydapenmnvtatfsDuau pot1apxo ieilsfs2rlu pnt) eeoir3iatfptran sls  2xrirpnydlptnlncsas sDra( ont0opt  fctlt a2umuvont4artomo3ia1opDr neilt)seuo(m3ou1openlnetlt)s2ururp;o0ale  ietasls2um( p u0 ltrifciytlpt aneilt  2toxopiy1lle  iviat)a2ra(  no0aeeomfeiatlaDran s t0tltnmrcoy1lp elneols) 2xo(o ny1lm nlieias) rtaxront1aptoiiciatlm rmnmp u0tlxoifcoo1lateaueo;( s2uoio3iydom   fet t) Dumx oou1texn f3iadlmDra(msnu4aleomr tydfpDrai s;s) rtr(r3iu4ameemfeta(fsrtrxroot1olxo o3tyt s2rmn o;u4 eeoircoodoaDrauvs;s)srumiopou1op elictl() Draxrpnt0apenmociltfm2emn s;() ltrxocoy1lpDeaivo t0s2tm(r no4ll  livt s a2rrxm ;o1oleoifeiltfs2raumo u4aeenmf3ia1fa rli o ( tetmxopiu4lm elnetas)a2tr(roou4altnifetadlsDel(mo;u)trenxr oadlp  auvsls)t2ur(r nudlltemncilt)aDrrxm ;u1aex io3iydfm2ulnvo;u4 ltrio3oytla rluvols)s2xoxo ou1op nlnvil(fa2rau p;o4tetoifeiad sDemnvont4alermf3iotlmtr nes t sexo(r oy1ome mieias arur(ro;u4apxoiietadla2eau p;u4arxrircoytlptr nvs;t s2xo(rpio4op   fvtas sDuaxm ;u0opt  oeiydls2ean s t4 lenxo3todlmDraues t  etm(m iu1ol emnctatfsruru  ot4tlen iciytfm2eluvs;(4tetoio oodoaDe ies t)sexo(m no4al elnciat arururp;t4olenif3iysfa2ua(mpnt)aexrmrcoydomDr i s;t) 2xrim3oy1lpe mfet t) rum(mpnu4aee iieilsfm2rm(vo u4tetnxf3oodlp elneol() exrxrpiy4lpe mieta(fs2tmxr no0alt io3iyd sDranms;()aexoircoo1lat  nvo;( s2trirpiudll e fetltfa2tauro;o4oeeo ieiat s ul(mp (0 leoirciytomDrai o s t2toio3nu1am emieia( srumur nt1olxnmieildfaDuan p;u)aexoxf3oatla  auesls  rxr(rpou1olt  fetl(  Dtrxmpno1tptnmocildfa2rmn s;t0aetoxo3iatfaDrli s (0 2xrxo3iu1al nlivsas)arra(r nt1teeoifciysfaDra(vs;u0 exoio io1lpD au s;t) exmim oudoptnlivtlsfarum( pnt0opt iietasfm2rlu o t)trxomr3todfpDe ivo s)t2toxr3oydopt mictlt)aDuaumpot1aexnioetydfsDuan o;(4aeenxf3iytfmt anvo (0trtoxo3oo1ome mnvsasf Dtm( o;t1teen ieiydfm ea(vp t4 renxo oo1omtr ieo;(0 rxmimpny4lpt livtls aDrax pnu1openifeildlaDelnmpnu0texrmrciytop   iei;t0 euoir nudoptemfviat srrmxr ot4aeeomf3tld a2ulnvo;u0 etoif tadlp elieols0srurio3nodalt lictls a2tm(  no1texoiieiaslm rm(mo;t4altrif3to1fptr i s;( t2xr(m3oudomtelncil() Dtau ono1apeo ociytfa2ea(vs;t) ltomr tytoaDrli o;s)s2tr(r3oy4ll e nvs s)sDrrump;t4tptnio3ilt m2ea(ms;t)tlerxf ootoa elu i t0 exoxopio1omtelncs ()arrr(mpno0aee  o3tlt sDrmnms;t4arxnio3oy1om eliei s0 rumio3nudlmee iei () 2tmx pot4opx mictlsla ranvo () ltrmfcoa1oatraueilt t2toxo oodoptn fetas)aDurum ;u0tltoio3tydfm2el(vp;() lxrmr3tadlm raieo () exriopoudomen iei ()srrm(rpou4tpen fciytlmDel(vs t4alxoif tatlaD anei s)t2xoxopoudomenmfctls s2uax p;o1alt mieiytfs2ea(vp;(4trxrxfctotoa e n s t) euo(o no4ol emnct ()srtau ono1aeeoii3iltfm2rlu p t4alxrmf3iydoate n o t0trumxr oo4altnmfeiltf rra(mp;u0apx mictad a2rm(msnt0 etrxr iydomte nvol()trxr(o3iodlpee fetltf Duru p;t1oet ioeiasfs umu on(4 lermo3ta1lmDranesl(0s2uoimpoy1llt mfvsa(  2rrx onu4oet if3iytlmDul(vo (4artomfciotlpDr i s;t)tetoxo io4alte fctas  rra(mpnu0apxn o3iydfm um(msnt4areoxf3tadfmD an i s) eur(m3oodapte nvi s  rumumpou4oex  oetatlm umums (4 ltrif3oa1lpteln ol( tetrxo iodlmenmfct (fsrraxront4ope ifetldfm2rlnvpn(4alerif ta1opt ai s;(0t2xo(rpiodopenlfesls s2raxmpou0opxniociasla uauvp;u0 lxnmr to1laDrluvi s t2trxm3ny4altnmnciltfsDtrur no4ole mi3tls mDuln onu4 lerif oatlm raivs (0teuo(opiydome lncsls artmumpou0ope  ictyt sDrlump;t0trxriociy1oatr ivsls setmir oy1lp  lfvsa()a2rr(r no4teen o3iadfmDemumo u4trerxo tadoa e nei t0s2uoir3nodomtelfctas aDuaxr oo1openmictlsfs2rlu s;u0aetrxrcoatoat anesl( setmxr3nodoleemnesl(faDrmxmpno4tpx  oetysfa2umnmo (4aexoir iatlpDe n sl( tetm(o ny4lmtn iviat  rrrx pnu1oet io3ild a ul( p;()trxnmfcty1opte uvo;s sruoir3io4op   fcs tfs2umu ont0tpxnii3iatfa el(mont0 rtrxr3iotlat  ues;s0 2ur(r oodlptnlivt s  ruau oou4oet io3tytfm eau p u4 lenif3oadoateluvo;(0trxoio3iodlmenmfcia(fs2ua( ooo0aetn o3iyslmDra(ms;t0 etrxo iadlp r i ol(0t2xrim3iodamen ies s  2ur(m ot4oetoioeiadfmDrln s;u)texomr3oytlmD  nei;s  2toir oy4olenlfcta() Durxmont1apeoioctlt sDranvp;(4areoxrciydlat  neo;(0sexo(mpnu4lmenmicsls)a2taxr oo4apeo i3iysls2el( o t4teenmr3iodfm  aneo;(0setoimpoodomen ivi t) rtmu o;t4tlen i3tysls2ua(mo u4tltrmrcio1fp e nvs s)s2toxopiudlme mncsas  2rm(m ;o0tlxnifeiyt m eanvs t4 leomo io1lpDrlivs;s0 exmimpoy4amt  fetlsf rtaum ;u0ape  ocilslm2ra(mont)trtnir oatom r n s;s t2umio3iodll nmneiat a2ta(mpnu0oex mieilslaDuan onu0areoiocio1oaD lnei ( s2xoim ou4lmenlnvi (f Dtm(ro;t1apxo fcils m2rlnmo;u0alenmr3iytlmDrau o;s0 rtr(mpoy4lmenlneiat)aDtrum nt4texomoeilsls elnvon(0aexrirciodlat  ues;t t2urir3oo4amtelieslsf 2rmxro;u0tltniieiatlaDrm( s;u0 rerif3oa1optr nvi (0 rurimpou1lpeemiesas)a2rrx  ;t4tle mictaslsDranmpnu)trxomr ty1faDrluesl()srxm(r3nudomeelncs (faDur(m ;o1ale mi3tatla rmu p u)aexnxf3ia1oa  luei;s  ruriopiu1alt mics ()sDum( o;o1oeeoioctysfa ua( o u)alxoxo3oatomt aivs t0teuo(r3iy1lmen fvtl() rrr(  ;o0alxo fciaslm2ua(mo t0artrir3io1fate ieil()srxmxo3nudamte fctas) rtrx ono0apt  o3iasfm2uau snu4tltnir3to1fateln s;t sexmim3nodolen fetas  rurx  ou0apen ieilsls emu p;t0artrmrctydfpteanvs ( texrxm ny1omte ict ( s2umxrooo0ale mfeiysls rmump;(4altnmo oatfm  lnes;t0s2urir3oodapt lfeslsf 2trurp;t1openiictlsfm2rl(mo;u0alxrir3ty1faDraivi;()trxm(mpiu4lmen fcilt) Dtaxrooo4openiicilsls2emuvon() rtoio3oa1laDeau s;t)t2uo(m iy4olt liesat s2rrumpnu4aex iociad mDrluvo u)tltnmr3ia1fa   ivs ()sexoim3nudlm  lfcias aDrmx oot1tetnmociytls rm(mp;(4alerxf3oytfmte ieo;s0 rxm(mpiu4openlict sfsDuru  ;o0alxnio3tys s2umu s (0aleniocoodom   u slt  etrirpou4al  mies s) 2ur(r ;o1oltomi3ias a rmnmp;(0trxomoctatom elues t0 2xoxrpoydlltelncia(faDur(rpno0oetomociydfs em(mpnu)teeoxoctatfpt  ues s0 rxr(mpio4lpenlnetasfsrrmx  nt4apxomi3iadfs uau s (0trerxocty1op eln s t  2xmim3oo4ap e ncslt)aDrmumpoo4tlxnmfeilsfmDel( p () leoxr3oatoatrluvi s  2ur(mpiydom nlict sfartr(r ;o0tee  feiydls rauvo;u)tlxrifctydfpt au i t teuoir iodlle mivtas) 2rrurpou0tltn fciltls2umn snu4altnmo tadfaD aiei;( seurxrpny1omtemicia(fa2rrumo;t1olen i3tatfm2el(ms;t4trtomfcoy1lmtraivolt0srtmxm ou4alee fvi s s2trxr ou1opx mi3iasfaDean p u4texomo3ty1opD lueo;()s2um(rpnodol nmfvia()aDta(mo;o1oleniietlt a2emnms;(4 reoxr oa1optr u ol() 2tmim iodoleemfvta( a2tm(  ou0altn f3iad a emumont)artrxr tatfa r nvol()t2uo(r3iy4om elncias artr(  ot1aexoiicildfs ulnmp t0 reoir3iy1fateaueil(  rxr(mpno4ole lietl(fa2uaurpoo4tex ioeiadla emu p;(4trxnmfciodfpDrlnvs (0s2xoxm3oodll elivslsfs2tau  ;u1tleomoeiasla uaump;(0 ltrxfciydlp  aivs;(  2tmio nu4lme lncia(  rtaumoou0opxomieiadlm eln p u4tleoxrciotfptean o;t)sexm(opoy4ap emici sfsrrm(  ou0altnio3iys a eauvs (4 rtomo iadfp  aueo;s0srtrio3iydlp   fes tfsDurur ;t1tptomociadlsDeaumon(0aleoifctytlmDr ivolt0 rumxo ny4amt  ics () 2rrurp;t1tex io3iydlm2ul(vs u0teenmr3oodoptr uvo;(0s2xm(m oodam e nvs (  Duaumpnt1tetomfcildfa2ul( o t0arerifcoatlm ran s s)tetmio3oo1al e ivsa(fsrrmumo;t0aexn feilsfsDra( o () etnxf tydfpDrluvs () etm(m3ny1lle lnesat s2uaurp;t4olt io3ils sDua(vo;t4aeeniociy1lm eaies t s2ur(m no1lmt  fvt s) Draxmpnt0teeoiictytfa2uanvo;u)aexoxf oy1op eanvs s0t2xrxrpoo1opeelfvt ()s2ur(mo;u1oexn f3iytfm2um(mo () rtrmrcoytlpt luvs;t0setr(m nydom nlfei t srtaxmo;t4oltnmo3iadfm elnvonu0aeenmr3iatfmteaieils0srtriopio4ale mivils aDua( pnu1aeenio3ilt s2rl( onu0 ltoxo3tatfaDrlivi ()setmir3iydllenmiet s aDrmumoot1tpx mf3ild a2rmump;u)texoio oodopt anvo t s2um(m3ny4amtelfes sfsDuru pnu4ale mi3iysfmDuanvs ()tetnxocoadlmDeauesl( srtrxmpoudopt  fei sf rrmx pou1teenmfeias s2eln p;t) eenxrciy1faDrlueo t0 2um(m oy4amen iet s)a2umx pot4aeeoio3tlsfs2rl( p;u)alxrmrcio1lptrlu sl()t2trxo oy1alenlict s)arta( oou1oet iietas m2um(ms;(0tetoxo to1oa raieils) 2tr(m ny4amee nctl() rurumpnu0oetnmf3iyd a rlu p (0 rtniocoo1fmDr uvo;()trtmio oo1olen fvt t  rrmx  nt0alxo o3iaslm2ra(mo;(0arxrioctytlmtrau s t seumxr oy1lltelneils)a2urumpnt4opt mfeils mDua(mo;t4arxrmoctatfa e ivi s  eto(o3nu4amen icsls aDrmxro;u4olenioetas m ra(vs t4 lenmf3iadoatraieol(0 rtr(m oo1lmeeliviltfaDur(mpot0alx iiciys a rau o;t0trxrmr3oydomDr uvo;( srtrxr3iu1lp nmfeta( srtm(ront4ope  o3ildla2rmu s;t4 rtnmr3iydomD aneol(0s2xoxopno4lm  mnes t) rrru ono4opt iietat aDrmnmont)aexnmr3ootomt lieilt0s2tmxr3nodaptnmfeiasf 2trum ou0oleoioeiyslm el( on()tlerif3todfp e neo;(0 euo(o ny4lp nmncsasfa2trxmonu0tleo f3ias aDra(vo u4altnxf3ia1oatelu i;s  eum(m3io1ap   feia() rrrumo;u0apt  i3iysfmDumump;t0 reoifctotoa elnes;( t2uoio io4omt  fes s)srrrurpnt1oltoio3ildfa2rmu pnt)alxomo todomD  i o (0 2xmxopiy4omtemfetat sDua(m ;t0teeo fctldlaDea(vp;u4 exnxf oadfmD lues (0 etr(r3iu4llte fvil(  2tmxm no0tpeniietlsfa ua(vpnt4aeenmf3oydop eaieslt0 2xrxr3oo1llenlnvsa() rtrx ooo4alxn ociltls ulnvs (4texomo iytfmD  u o;t)seur(o iy4olt mies sfa2ua( o;u4tex mfetltfs2ua(von(4altoxf3oo1lp   uvi;() 2tmir oudamt lnvil(fsrur(rpoo1aptoif3iadfs2rauvp (0tetnxrcty1lpt  i sl(0teum(o oy4apee nei tfarum(rono4olxn i3tltfs ulnms u4tetnif3oydopDrlies t) rtm(o3iodope  fcsa(fsDta( o;t0aeeo oeiyslmDel(vs ()tltoif3todlp  ln slt0s2tr(r3oodalen netatfsrua(rooo4tlxn oetatfa2eauvo t4 lxoxr ia1oa  anvi t0 2umirpiu4oltemfeiasf Dumump;o1ale mi3ild s uln o u0trtrir3iytlmtrlivo ( s2umxm3ou1ope miciat aDrr(m ou0optomi3iatfs2eanmo;t0aleoxr3ta1oa  auesl(0srxo(opiy1lm  mfvsl()aDurumo;o0ale mfctyslsDeau snu0tltnxociydomt lieo s0srxo(o ny4lm emnvil( srumxmo;t4optomfeiltla2ranmo;(0aexnmrcoa1fm rlnes;s) eurxopiudoptn neiltfaDra(mo;o4apxo fetadfaDumu pnt)trermrcoy1lat lnvi s teum(opiy4ll  lnvs (fsrrmxr ;t0olt mf3iat s uanmp t4arxnifciadlpDraueolt)setmxm3nu1lme livt s)s2tmxr nt0tpx mfeiasla eluvp (4tlenmociytfa raneils)seur(o oy4omeelncslt artmum ou1optomf3iyt a2um(mp;u)altnmr iotlp   nvo;( trtm(rpnu1ol  mietas) Drrx p;u0oetoioctaslmDel( pn() lxnmociadlat  ieols0 exr(m3no4lpee netls) Dtm(rp;t0aee mietas aDem(vp (4 ltrmf3tadfpteaieslt0seurio3ny4lm nlfvslsf rtmum no4tpeoif3iydlmDrau s;(4teerioctadop  lies;s srxmio iu4ol  mfvtat)artmuro;o4aet  oeilsls2um(ms t4 reoxrcootoptean i;t0 2toimpnydamtnmfeiasfs2rm(mpnt4tptnmo3iltlsDeluvon(4aeenmf todfatrlnvs;(0srxo(rpno1lmen icia(fsDrmu o;u0apxo iciydlm rl(vpnu0aexnifcoydomt  i s t) 2xoxm3nodapeelietlt) Dua(rpno1tpenmietad m uluvo (0altnmr3iotlatelueo;t  2urim3nudlm e nei (fsrta(rono1oeenio3tlsfa umumsnu)teeoio to1om ean i (0sexoirpny1om   nvsls  2tmurp;o4tlxoiociyslm2uaums;u) lxoio iytoa eanvils srtrxopoy4lpte ieia(fsDurxmo;t1tet iiciatfm uan snt0 exoxoctotlptrln s s) rtmir3oydom  lnvs t)artmuro;t0tleoio3ils a2uau o u4trxrio3iytlp   i o t0t2xm(r oodom e nvilt) Drauroot4olxoioeiydls ra( s;u4 eenmo tadfmD ln i (0s2urxmpny1am elnetltfsrum(mpnt4olenif3ilsla2em( pnt0teerxo iytopte uvilt0s2xrxr no1lpenlics (f rrru oou4tpe iieiysfs2emnvpn() eenmoctotla eaieo ()srxrxo ou1alt mnesas)aDuaxr oo1aexn i3tasfs2ra(vpnt) lxoxrciotlaDr ieo;s)trxmim ny1llt micsasf 2umxrp;t4ole mieias a em( ont0trtoir ta1omt lnvi;(  rur(opnydlptnmfcsl(fartrumonu4aeen ieiys m2rlump t4 ltrmf3iadfmteauvo t)texo(rpio4omte iet ( srtm(mpou0apeo fctydlm umumonu4 lermrcty1lp eau s;t texrim io4amenmneta( aDtm(r no1alt mf3tat sDrmnmpnt0arxrxo3oadlptrln o;t)srxm(r oo1olen fcs ( s2rr(mpou4altomfetys s2ea(ms;(4 lenif3tydlmteaivsls) 2to(o iy4alee ictl( a2taumpnu1altnmfciltfa em( snu0trtrir3iy1fmtr ivi;s  exmirpio1ope  ncsa(fa2taxrp;o0aet  f3iatfs rl( s;(4 eerxo3oadoateluesls0 2toxr3oy4omt  netl() Dta(rpno1ope  o3tad a2ulu o t)arxrxf3totopDelnvils)trurimpio1lltemict sfartr(rpnt1tpxn oetydfmDem(mon(0trxrmr iydfp r i ils sexrxr3ny1lpte ncsltfsrrm(  nu1opt ii3tadlm2uanmp;u0 eeriociatoat lu o;t)texr(m3iydopenmfeta( aDrm(r ;u1oltn f3tltls2rau pn(4tlxnir iydfm   ivo;s setrxrpno4lpt  ieiat) Duaump;o0alxnmieiyd m2eanvonu0 rxnxf3to1latran il(0trtrxrpiu1lm  mictltfsruaur ot1olxnif3tldla ulnmp;(4tltnmr iatlpDraueo t teuoxo3iu1lp nlnvslt) 2rm(m oo1aexo oetld aDua(ms;u)aexnir oydfptelieil(0truoim3iydlme lnvs tfa2rrxmp;t0tlenio3iyslm umnvs;t0 rtrmr3oodlp r nes;t0 rur(m io1lm elicsat  2umx pnt1opxniictyt sDrmumon(4 leomo3todopDeanvi (0srxoxr iu4lpee feiasfaDurumpot4texoiiciat mDran pnt) rxoxr iytfp rlivo ( t2uoxrpiy1amtnmfei ( aDtaurpot0tetnio3ils a2uan p;(4artnio iatfat lnes t  eumxr3ou4lme  ietltf Drm(rpno0ope mfetlsls raumo;u4tetnmo oa1lmDe nvi (0srxoxr3no1ale livt t)a2ra( o;t4olx  f3ias s eaums u0aeenmf oo1omte ueil() rxr(m3nu1oltelict (f 2trxmont1apx ifeiydls2ra( o;()aexnircoodopDrlnvo;t) 2xm(r nudolt  ncs sfs2rr(r nt0opeoifeiydls2rlums u4alermfciadlm ean ilt)srtmiopiy4al  lneils s2raump;o0tlxomf3tyt m2el(vs (0tleomo3oo1fptelnvi;s texm(m3oy4lle  nvs (f Dtaur ot4aet ii3ils a eau p;t0 exnif3oadlate nvils  2uo(o oy1lm nlicslt)sDur( pnt4oeto oeiyd a2ra(mo t4trerir3iotoaDraueo ()s2xo(r ny1ap  mivil(f rumx p;t0oeenmietlsfm elnvo;t4tlenxo oadomD luei;s)t2tmio ny4aptnlivta()sDururp;o0aeeoiietld s rm(vo () reoxf3iy1lat  u o;() rumxo3iudlm n icsltfs2ta(  ou0aeen f3tadfa2el( pn(0 ltoxf3ta1fp e ivsl(  2xmxm3nu4lleemfvs t)artmxmp;u0aex ifctltfaDem(vsnu4 eeomr3tydom e i ol() 2xoxo iydame lfeil(fa2tmxrp;o1apxniieiyt sDea(vs;t)aetnifctadoaDelneilt t2xo(rpnodllt  fetls)a2urx o;o1apenmociadfs umuvp;(4artrio oodlat lnvo s)s2urio3oo1olenmict ()aDrm(m ot4teeo ictatlm rlumsnt0 rtomf3oy1op  aivi;(0tetrirpiudalen ieia(  rta(mo;u4aleoifeiatls2rl(vo u)treomf todopD  uvi;s srtrxr oo4oltelfcilt  2uau pou1ope  fciadlm2uaump t4 lxrmf3iydfpD livs;s t2uoio iydopt lfetat)a2taumoou1tlt if3iat m2emu snt4trtomr oytomD lueo () exr(r nudomtelfctltfsDrru  ;o0tlen octls s2elnvs u0 eeoxr3iadfmD lu o;(0truoxr3nu4lm n neta(  2ra(r no4aeen ieiltfaDean o;u0alxriocio1oatrai olt)trxrxr iy1ll e fetatf 2trxro;o1opeomoetysfm ea(mp;u0trenio iydlm  aivi;s)setrim3iodllt  ncils  rrrxmoou1aleomf3tat mDelnvs;u4trxnmo3iydlm e nvolt0trxoxrpnydllt mivils) Duax  no1alen o3iaslsDrau ont0aexoxr3oadfateai i s0 etr(o3iydam nlics s aDtmxm ;t4olx  icildfmDrl(msnu) lxoxo oodop rlnvs;(0s2xm(m ny1lpenlnvt tfsDtmx  ;u0opxn ieiydlm2ea(vs u)trerxf3ty1lm e ivi ( truoxmpiydoltnlivtl() Dta( o;o1aex ioctytfm2uau s (0tetnmf oatfp  aivols srxo(opoo4openmfesa( s2rr(r ;t0alxn ietydla2rluvs;u) exoxrctydfa eaivi s)seto(rpoy4aptnlietas s2ta(mpnt0apxnmieiaslmDua( pn() rxrif oo1lmDeluvsls s2xoir oodlmtelivs s)s2tm(rpno0tlxnmoctltlm2umu pnu) rtnif3ootomtrlu i;s0 rto(mpiy4lmt mivsat arraxrp;u1apx ioeiltls2uaums;(0tetnifcia1lpDr nvi s)srxoim oodam nmnvils  rrauro;t1tlx  feiasls2uan p (4tlxrxr tadlmDe uvolt) exmiopoydoptnmies tf Dtmu oou1oeen iciat a2uanvsnt4 eenxrcoo1opDeln o t0 rxmxo iudll e ivi (fs2tmumpno1alt mfctadfm2rl(ms ()aexrio3oo1fp  livolt trumxr oo1ale mneta( srua(ront4alxnmfetadlaDelnmp u4aleoio3to1opteanes s teuoxo3oy1olenlfctltfsDrru pnt4aetomi3iasls ranmo u0 rtomocoodom  an i s) 2xm(m oudapte nvs t aDrrxmoou4oee iocilt sDul( p;u)tltnmr3oadlmDranei t0srxoio3oydapt mnci s artmxr ou0tpt micils a2ra(von()artrircoodopDe ueils)seuoxr3io1ameelicsasfaDrrx p;o1tet  ietls m2ran snu4 ltomf oydomt lnesls)tetrxrpoudaptemivil(farrmxmpoo0tlt  i3tyd mDelums u4artnxfcia1oaDr n sl()trtoxr3oudolen nesltf 2ua(m ot0tle iociyt sDrlu o u0 eeoif3iadfmt  i sl( t2xrxr3iu4lp   ics t)srrmxmoou1alt mieiadfa rln p t)alxrif oydlpt lnvil(0 2tmim3nudomt mivsls  Dtm(r ;o4aexnio3ias a uln s;t4texrirctydop   ueo t) rto(r3oo4lmtelfeia( arrmxrpou1oetomiciytla2ulnvpn(4aetnxf3iadfaDeaivs;()setm(mpiodopeemfet ()artmxmpoo0tpxniiciyt aDumumo;(0 rerifcto1op e nvsls0sexrim io1optnlnvtlsf 2uaxr nu4alt mociatlsDranmo;(4tlxnxo oydlm e ivi ()srxoirpnydlleemivtat a2raumo;t4oetn o3tydla2rmnvo (4tlerxr iadfaDeli olt  rtmxr iu1openmietas s2tmxm nt1aetnioeils a2em( s u0tleomr oadlmD aues t)texm(rpou1lmeemiet () rtm(mo;u4tleo iciad s em(vo;(0tlxoxocoydomtr n ils  exmxr3oydllt  ieiltfsDrm( p;t1texoiociad aDelu ont0aeeoir ia1laDrln olt) 2xmxr no1apen fciasfaDtmx  nt4oexn i3iasfm2eln o;t4altrxr3tadfp r u o (  2uoim3no4lm nlneilt arrrxronu1oetn fcilsls ra(vp (0alxrircoytoaD  i sls0s2uoxo oodapt lnei ()s2rrumoou0tptn fctatfa2rl(msn(4alenircia1omD  nvs;s) eumim iy1om  mnvtl(faDurxrp;t4aet  ocias s eauvo;(0trxrmr ty1laDranes t teumim oo4opt  ivsas)aDrmxm ;o0apxn ociytfm2raumo t)aeeoir3oo1fpt  u i;s) rtmxopio1alt miesls s2ur( pot4tpx io3ilslaDuanvp;t) eeomr iodoaD auvil()trxrxopno1alee nci t s2ur( oou1olen feiydlm2rm(ms ()teenio3iydfa r nei;s0 euo(mpoy1aptelivias)aDrax poo0teenmietlslsDea( on() eenxf oadlmDelieslt)t2tmirpou1altnmictl()sDumuro;t0oeeomietyd m2rm(mo ()altomr3oy1laD au sls trxmxo ou4ll n ics s srra(r ;o4tlt iictad sDuanvs;u)trtoio oydfaDelieo (0sruoxr oo1aptemfvsa( a2rrurpoo1optnmo3tat s rlumsnt0trtnxo tadla r uvs t) 2xr(rpiu4lm e iei t)arrmu ont4tpxomiciydfa rau s (4altoir3totfm r i il(0trumxo iy1ap nmnvtl(  2umx p;o1aleoioctys m2rau p;(4aeerxr tydom  lu o s texmxopou4alee nes s) Dtr(rpnu1ope ifeiydfa ra( o;t4 rermo3ty1oaD lu s ( trum(r nydap  mnct t aDtr(mpot1alto o3tyt m2rmuvp t0texoif oodlp rluvslt sexoxr nodal elfvi sf rtau ooo4opt  iciad sDrlnms;t0trxnxrcio1oa raneo;t)t2to(m ou1alen ictat  2rru  ;u0teeoiietytlm2em(vpn(4altrmocoadfpD lu i t teur(r3io4alt lnci (fsDuaurpno4alen oetydfmDuluvp;u)areoir ta1omD li s;t) 2tr(r3oy4am e ivsa()srurur ou1aexo f3ild sDuln ont)aetoxo3todfp rluvi s)srtoxr oodope lncta( aDrrxr ;t1apxoif3iysfa eau s t4 rtnxo io1fpDraneilt t2xmiopoo1ap nmfvs ()s2rax o;u1tle ifciat a2rm(ms (0 exnxr oatlat livolt)tetrxm ny1ol nmncsl( arua( o;t4olenifciatlm ranvs;t)alxoxfcoy1fmDr nei;(0trxo(o nydlpeemfvsl(fsrtmxmpno1alx if3tysfa um(monu4 eeoxr3iadfpDelu o t0trtr(o3io1lm eliesl()srtaxr ;u4aeeomicilsla rmnmp t)texomrciy1fa  ai il( srxrim3io4lmt lncias)aDrm(m ;o1opxnmfeiad s2uln o;t4tleoifcoydlp eanvo s0 2uoim oudole lnci s  2ururp;u1alx ioctydfa el(mo;t0tlerir iodomtranei;s0t2tmxrpny1lpe  fei s)sDum(ro;t4alt ifetldls ranvo t) rtnmf iytlp e i i;()t2toxm3iy4apenmncilsfsDtmurp;o0tpx ifciysla em(mo;u0trxrmocoa1fa r iei;s0 ruoirpoodlmen fct s) rumu o;t4optnifeiysla2rl( s;(0tlxoir oydfmteauvolt0trxm(rpou4om nlfvi t  Dtr(r ;u4tlxn f3tldlaDrlumpn()arxrif iodfa   nvo;s0 etoio nudaltnlietat aDrmu ooo4optoiieiltfa2emnmo u0arxnxfcootlmt aivi;( trtm(mpnu4lp elicsatfsrta(mp;o4olxoio3iydls emnmo () ltnxrciadfmDrau i;s texoxr3nydapteliet sf Drrx ooo1olx  ociatla2ea(mpnu) rxnio ia1lm eluvslt0 2xoxrpiudopen fct ()srta(m ;u4tex mi3iytls2eanvo t4 eenxocia1fm  an o s  2uo(rpou1al e fciltfarrm(r ot1tltnioeildfs rm( sn() renmocta1lmDr i s s truoxmpnodlmen ictlt artru p;o0tex ioetytfa ulnvont0 rtoxo oytlmDraivol( sexmxr3iudal nlics () rtru ono1tle moeias sDulnmo;u) lxnir tytfmt luvo () 2um(o3iy4ll  lnetl() 2ur(mo;t0oeenmo3iytls ul( snu0alxrmo ia1fp raivi s t2tmxm oo4lmte iesas  Dtr(  no0tex  i3ils m rl(vs;(0texrmr3todopDraneo t0tetrio ny1lmenliviltfsrtrx pou4olxomieiltfs2rau o u0 exrmoctydfa   n o;t0t2xo(o oy1lpt  fesl(f 2rru pno0ale iieiadlaDeaumpn(0alxnxo3ta1lmtraiei;(0 2xm(rpoudll e fcia()a2rr( oou4ole  ieiydfaDulums;u) rtnmf3tydoa e nvi;t  ruoxopoo1amtnmieiat  rtaum no4tpx ioetydfa eln pn()trtnio iodfat ln ol()t2xmir oy4op emfcsl()srrmumono0tlx ioetysfaDelnvp;t0trtnmf oodop   ieils sexmxo3nu1ap  mivt (fa2umx  nu4tlxn iciltfs2uanvp;u)tlxoxocta1fmDrauvi ()texoxo iy4alenmfeia() rrr(rp;u0alenmi3ildfaDumuvonu4aexoio oo1omDr i o (0s2urxmpnu4ol n ietls sDtm( ooo0olto fciadlaDuanvo t) exoxo3totom e uvol()srumir3iy1om   ivtas  rtmur ;u4oet if3iydlm2rmn o;() lerxr ta1fm eaieo ()seum(mpiydop n nct (  2tmur ;u1oeeomi3ilt m eanmonu0 reomf io1lmDelivo t t2toxopoo4op elfeslt)srta(mo;u1tlt mf3tasfsDulums t)tlxrxocoydlaDeaiei;s0trtoxo3iy4am nmnvslt a2uaxmo;u1aptomf3tlsfa2rauvs t4 exrxr totlaD  i i;( srum(mpnu1amtelnvsa( aruau o;t0tleoiocilsfmDeanvo;()artnif3tadfaDraiei;s0t2xmir oy4altn ivsls sDtm(r nu0ape io3iltlm elnvs u0tlenif oatfm r ivo;t) etr(m3ny4lltnmfcsl( s2urxro;u1apx ioctasfmDrau s;(4tlxnmfcoodoatrlivilt)tetoir iudllt  ici s)sDrmx  ;o4alto oeiytls uanvp t4 etnmf oydlpt aneolt0trxo(m io1omt mnetat) Dua(mpot0ale  oetyt m ulnvs;t0artrir3tytoaDeauvils  2xmxrpno4lm n fvt t srraur ;t0aetomfctydlsDeaump;t0alxomoctotfa eaieo;t)tetr(mpiudamtelivt t s2trumpno4tlxnmfctadlmDrmnms t0 exnmfcia1la elueo t)t2xoxm iu1lp  lnvs (fsrtm(m ou4aptomfcildfa2rm(vp (0 rxnir3totlmt  uvo s)trumio nudllen neta()srurumpnu4apeniictatfa2el(vp;()aetnmrcoatfp rlnvs s  2xoirpoy1amtnlivi ()sruauront0ole  oetydfmDrln o;t4tetoifcoydfmD  n o;()sexoim oy4llen ictat) Drrx  ou0tex io3tydlsDrlump t4 rermf tytlm eluvs s)t2trxrpio1llenlfcsl(f rur(mp;u4tlx moeiydfm rm(monu4 etoxr oo1fm rlnvo t) exmirpio1ole  ivtls aDra(ronu4olxomiciasfa2ranvsnu4 etnmo3iadoa   ies () rumirpiudlle  feta(  Drr(rooo4openmoeiatla2ranvp u4aexnifctadfp r uvs (0s2xmir iu4alenlivilt  2um( o;u1alxnmo3tlsfaDrmuvsnt4tlerxfcoo1om  aiesl()trtrir no4lpt  fctls)s2ta(rpno4olen i3tadlaDuauvp;u0tltrmf3iotlmteau s;t) eurxmpiudlm e fvtat) rrrur ;t4opx  oetld s ea(vp (4 exnmf3tatlateaieils  eumimpou1amtnmivils)aDtr(rpot0tlxomociatlm rauvsn()altnir3oodla e ivi () rtoxo3nu4lmeeliesl()s2tm(  oo1tpxn ociyd s emu s;(0artnxf3tadopDrln sls0s2uo(m3nu4opt mncsat)s2tmu p;o4olxomo3tldlm umnms;t4 reomo oo1lmt lieols)trtmio oudopen nviltfs2ua(  nu4tpxnif3iasfaDra( s t4trxrir oo1faD aivi;s  2tm(m3ou4om emnvsas)aDuax oou0oex mo3tydfs ulums;t0artnmo3iodoptr uvs;s0srtmir3oy1oltelnvi sf Dtaur ;u0aex mf3tadlm rlump u) ltrmo3tytla e i o;s  rxo(r nodale  nvta( s2raxr ;o1oltomieiydla emuvo u0 etnmf3oytlp rli i;t) ruoim iudolen ies () 2umu pou0texomoctysfs rmump;u4 exoir iatoat au i;t)srurim3nudam nmivt ()srurxmpnt1alx iiciysfs uanmsn(4 eenxo3tadopD lneols srumirpoudoptnlivi tfsDrax p;o1ole  i3tasfa ra( o;u4alxnmr3to1fm   ivi;t)trurxmpnu1ll n fcsl( s2ua( pno0tptnmi3ias a2ua(mon(4arerxrcoatfa  li i (0sexrxopnydalte fesa()aDrmx o;o1opxn fctytla2em(msnu4tlenmrcto1fm   nvi;s) 2tmim nudam emnciat  Dua(  ot0tex mf3tyd a2rm(msnt0 ltomf3oatlaDeauvils  euoxopoodal  mnetlsf Drrx  ;o1alxn i3iyslsDul( snu) rxrxf tadfa   uvi (  2uoirpio4om e nvta(  2ta( o;t0aee  ictld m rmump;t0teeoxo todop  lnvi;t0sexmxo ou4omte icia( aDtaurp;o1apen i3ias sDrlnmo t4trenxoctydfpteanvs;s0trtrxr ny4omen nct (f rrrx  ;o4aptomieiydfm em( o t4alxnxr iotfmt auvi;s teuoim io1ol  mivs t aDtaxmont1tex iictas a uauvo;t)trxnmo tadfp r u il(0trtoim3iu1opt lnvslt)sDraxmpnu4opeo icild sDuln s (4 rxrmr3iy1opDranvslt0 rxriopnu4lltemfei ( s2taxro;t1tetnifeiltfa ul(mp u4arenxf ootoa   n o (0t2uoxm3oydaleemiesatfarrm(mo;o0texomf3tat s uaump;(4 exnifcootfatrai o t0trur(mpiy1lle mnvs s aruaumooo4altomictatfa ua( s;(4tlenmoctatomD li ilt srur(m oy4omenlieia(f 2urx pot1tpxo ietas aDrl( pnt)artoir tydfm  aues (0t2umxopiodlpeelncta(faDrmumo;t4olxnmf3iltlm uluvs;t4aetnxocto1opDraieo t  2uo(m ou4ll nlivilt)a2tmxmpot1ale iieiydlmDul(vo;u0aeerir3iadfaDe i o;s s2to(rpnodopee nes ( arumur no4teenifeiysls rmuvs u0teeoiocto1op  lueil(0 rtrxo3iu1optelies s arta(m oo1tpe mo3tlslm2eau pnt0aeeoxrcoatlpDrai o t) rtrxopno1lptnmfciatfa2ra( pnu1oex ifeiydlaDran onu)treomociadoaD aieol(0t2uo(m nu1optn fvils)aDrmxrpno1tleo o3iyslaDemuvs () lerxoctadfmD luvs;t s2xm(o io1ape  nesas aDtr(r ou0aeeo f3iys mDrmnvs t0artrmr3iydlmDeauvolt  2xriopnu4lptelnvtl() Dtm(monu4altn i3tydls emuvo u4 ltoxf oadoatrln i;()srumim3nodap n nci tf rta(r nu0aeenioeiyt mDrm(mp t) leomr to1lm  an o (  etr(m ou4opt miei s arumxrpou0oexnmi3ildfm2elumo;u) lxnxr iodfpteauvsl(0teurio3ou4lptemici () rtrxrpoo0ape ifeiydla el(vs u0 rerxrciy1lmDr uei s)trtr(o3oy4om nmfvs t)aDrru pno1tleo f3tld s2rau pn() eenxo3oydlaDeaieil( seumir3oydllee ivt tf 2raxrpot1openifcild m2eau sn()tleomfciy1om eaieo;t  etmio ny4amenlivi ( artrxmpot1aexomi3tas a uluvo t0trerifcta1fpDr i slt t2xmir oodll elicia(f 2uaxr no1tpt mieiltfaDrl(vs (0tltomfciatomDeau o s0t2tm(m iu1lptn ict t srtauront4olx mo3iydfaDem(ms () exnif3ia1omtr u o s) etr(o nodope mfetl(f 2rmumpno0opxomo3tadla2ranmont4tetnmr oodomte n i;t trtm(rpny1oleemivtas artm(  ;u0olxnmf3iaslsDrluvp (4 eenif ty1fmt  ivolt0 rtoir3nydoltnmfet s) rrr(moot4oltnmf3iys sDrm( p ()teeomf iatfmt aivol()trtmir3oo4open icsa()aDuauro;o4alt  feiysfmDuanvsnu4 lerxo io1lpD lu i s trtrxopoy1apenmfvsasfaDra(mont0tlxo fetld s elnvs u0trxrir3oatfa   u s () eurxm3nudoptnmictas) 2rrum ;t4aee moctytlmDel(ms t) ltomfcoa1lat livo s  exm(m nudllen fei (  Drm( pno1alen ietyt m rlu p;t0texomf iy1lm eaiei;s)seto(o3no4omtnlncs ()s2taxm ;u4tlt  i3ilt s ean p t) rtrif iy1oaDelnvil(  exoiopny1lmtnlfcs ()aDuaum ;o0aetnmf3tad s2rmnvo (4altoir3iadopDrauei;s) rtmxm oy4opt  ncsas  2uau pno4altnii3iadfm2uaums (4trxnir3tytlmDeaiei ()sexrxm iu4lm n netltf Duaum nu1aeeniietls s emnms (4aetnmf3t
\ No newline at end of file
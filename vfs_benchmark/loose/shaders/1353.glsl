@@ -0,0 +1 @@
+nei t0trumxopiodomtnlfcilt)sDta(r oo4oltomfeilt mDumnvon() eenif ty1lm ranes;s  rur(o oo4lmtemnvtls s2ua(m ;o1tex iietltfsDraums t0 rtnxfcio1oa rai s;(0s2tmir3io1ol n fviltfsrumx  oo1aexo ieiadfm2ul( o;t0tlenxo ty1om  auvilt srtoim oydaptnmnesas arurur nt1alxomo3tatlm2um(ms t0trxnir3io1oa   uvs ( sruoxm oy1llte fet t)a2ururpot1oet  o3ildfaDua(vs () lxrxr ia1oaD aieo;t0setmxr nu1lmt  icias)sDurxr ;o0aex mfetltfs2rm(ms u)arxnif3tydfm   ueo s0 exrio3oydlpte ietlt) 2umxmp;o1tptomictat m2el( snu)trtomr3tytfptraneo;s trxrir3oudlleemfvi t  2ta(r ou4aleomf3tlsfmDrmnmpn()tlxnmr iydfmD aueo (0trurxrpou1ol   net t  rtaxm ou0openif3iasla2eanms t) rtoxfcoodomt  ieo;() rxr(opio4ap nmfvsatfa2um(m no4apxo fctltls uluvs (0areoif oytlptrluesls seurxo no1aptn ies t)s2umum ;u1alxo iciydlm umnmpnu)aeenxfcootlp   uvo s sruoxo3oydamtnmfvsas sDta(ro;u1olxoifeiasfm2ra(vs;u4 reoio3oatlmt auvolt  rxmxrpnudll nmfei sf Dururp;u1texnmoeildla umu p t4trtoif3iy1faDeaues;t trxmim nydal nlivsas) Dta(roou0opt moctls aDea(ms t0trenmo iydfa e ivs;(  2tmiopny4omee fei s)s2uaum oo4tptnif3ildlsDrlu s;() etnmfciatla r ues t) etm(mpnydom  licsa(faDtmxr ot4oexn ociyd s2ulnmsnu0 rtrmf oodlpD lu slt0t2umir nodol nmncsltfaDua(ro;t0aeeoiictyslm2emump;(0teeomr3ia1lm  au sls) eumiopno1aleemfct tf rumxmpot1texomf3tasfm2ea(mpnt) etoxr3oy1fmDe i i;t trto(o3nu4lptelfvsls) 2um(r ot0aex ioetyd m2um( p t0aetnifcto1fmD lnes s trurir3ny1alte ivt s a2raxrooo4aptn o3tat s um(vp;t)trtomo3oatlm r ues t0 2xo(r iy1apee fvsa(fa2rm(m oo4alxomfcild sDulump u0artoiociy1oatr nvslt0 rurio oydoleeliesa(fs2urur nu0oleomo3iydlm uauvp u4tlenmrciotfpDr uvi;t0t2xoxmpiu1lmeelfvtat  rra(m ;o0tltoifeiatfaDean p;u0aexoir3oy1faDranei t)t2tr(mpoudlpt mnvtlsfs2tmur no4tlto fciydls ra(ms (0arxrmr todoatr nes (  2to(o3nu1ap n ivslsf Dra( o;o1tex ifeild a emn s;t4alerxr iodlmD  ies ( teuoir iu1ope mnvs t sDtrump;o1apxomoeilsla2emu on(4texrmo3oodopDr uei;t) rxo(rpoydopenlnetas a2umxmp;u4alx mieiat s umumpn() exnxrcoydfmDeaueo ()trtrim ou4lptemics t)srrrxmp;o1tpt  ietys s2emu snu0tltnxf3oo1laD anei;t0tetoim3ou1lmtnmics tfs2trx ont1opx miciytla2ra(msnt0arerioctadfp e i ils)teuoim iodlpe  ict (  rumxr ot0opxoioetydlsDul(vs t)aeenxr to1fateauvil( seurxmpoo1ll nmfetltfa2ur(r ;o4aee ioctytlmDrl( o u0 etomrcoodla rln ils  rtm(o3ny4om  mncsls  Dumxrono0tlto feilsls2rlums;t4aleoif ia1fpD anei s)s2tm(r3ny1alenliviat) rur(m ;u0oltn fctasfaDea(vp () rxoir3oydoatr iesl() 2urim3iudolt livtl(farta(ro;u1tpxnif3iysla umumo;(0tltnircoadlmDr ivslt) exoxm3iodop  mnvs (fsrtm(ro;o1tpxoioetadla rm(vp u4 leomf3iydlmtrln s;t)s2xm(r io1apee icsasf 2uax oot0opto fcildlmDua(ms;(4tleoxr3iy1lm rai s;t0sruoim oudameelivs tf Dtau o;o1tptomfciyt sDuau p;t0tlxnxf3io1fm  liesl( trurxo3nudapen ivtl(f 2tmxm ;u0tle ifctldlaDumuvpn(4arxnxr tydfmt  uvi s0srtoir3ny4ol  mnctatf 2tmu  nt4tpxnmieiyslm emuvo t4 lxoircootoaDrluei;t0t2urio iu1lp nlfci ( sDrmxrpnt1aleomoetat aDulump t4areriocoo1fa rlueol() rtmxm oodomt mneil(f rumxmpno0apxnio3iytlsDumnvo u0artoxr oytlpDeaies s truoxo3ou1ope  net ( aDuaxmoot1oexo feiydfm2em(ms;() rxomr ia1oat aueo;s)s2uoio3oodlltnmietls s2tmuronu1tpeomfeiad aDranvonu0aexnxr3ta1laDr n s s0 etmxm3oo1altelics s artmx o;t1aeenifeiad s emn o;t0arxrmr3oydlp e ueils0s2urimpoydap nlnesls aruaxm ot0apeoiictaslaDea(vs (4alerio3oadfpDelivo s) euo(r oydale mfes tfaDtm(rpoo1tpxoiieiad m2ea(vp;(4aeenxr oadfat  ueolt0t2xoio io1olen icsas)aruaur oo1tptoifciytfm em(mp t0alenio ootoaDelu ilt)sruoxo3iu1lptemfcia(f rtru oot4opxoifciys s emn onu)texoxo iotfp   u s ( srxrxm3nydlptn fvtls)arrrur oo1oeenmietld s2um( p u0 ltoio tadomteaues t0seurimpnudlp n fetl(f rrm(rpnu0olt iociydfa el( s u4 ltrxfciytlatrai i;s0t2toir nu1lm nmict ()srraurpou0aex mfeias s elnvp;(4arenxr tytfa r i i;t srtr(rpoy1lpeemietls aDuaumpno4aeto oeiyslaDra( o t0tltoxr3ia1la r u ols)teto(m3ny4ome  fesa()aDrrurpoo4tlxnmfcilsla2rln snu4trxrmo3iotlpteau s t0tetmiopiu1ame mnetl(  Duax poo1olx mo3iyt mDrm( on(4trtrmr iotlmDe uei;s0s2xoir3iodap elieils aDum( pot1tltomfctldls2umu p;t4altoiocoatlaD  uvo;t srum(rpoydlm emfeiat)aruaxmooo0oet iictytfm2ua(mpnu)tetrmr ta1omteluvslt)s2tmim nodlmt  fetls  Duru p;t1tltnioetasfa eauvo;t0 rtoif totoaDe u i s t2xo(opoo1opt mfvsl()sDurx ooo0tlxniictld sDea( s;u4texoxf ia1fp  aneil(0 euoim3nu4apte ncia()a2raumo;t1tpt mieiltla2rlu snu4tltrmo todoa r u sls  rtm(o3oodome miviatfa2tr(m nu0tpt iociyslm2rauvo;t4texomf tytomt aues t0trurxr iy1alenmneiltfsDta( ooo1tlxomietlsfm rmu pn(0teeomr to1oaDraneilt)texrir3iydop  mfct ( srurx poo4aetoiictatfm emuvs t)areomf3iydlp eauvsl(0trtm(r3iodlmtelicsa( a2ta(  oo1ape if3iatfmDrmu onu)tltoxo3oytlpDr ivi t0 exo(r3iodalt  nvia(  Dra(moot0opxo fetaslm eaump u4 lenio ia1omD auvolt)t2ur(r3no4am n fvi s) rtmx o;o0texniictadla2rmuvpn() rtnxr3iatfaDrluvi s) 2xoxo3oo1oleemfvia(  Dum(ront1alxoifetlsls2emnvo;()tltnio3ta1fp   i ols0seuo(rpiy4al nmfcil( arua( pnt1oetnii3ias a2emn p (4 renxo totfpDelneslt)srxr(opiydlp elfvt t) 2trxmpoo1tee mf3iysfa rluvs;(4 etnxr ia1oaD li ols0sexoxrpnudapte nci s s2tmumono4oeeomf3iysfa um(mo;u4 etomoctadlatraivo (  rtr(r ny4am   ncsa() 2um( p;u4tle  octadfm rmuvon(0trtoifciytom r ieo t  exo(m oy4apte feil(fsrraurpou0oetnmoetysfa el( o;(4alxomf iadfmDeln ilt s2toio3oydlltelivia( arrmurpno0tetn fciaslaDuanmp () rxnif ta1om elueil(0seumirpiy4aleemnvta( s2um(mpno0oeeoii3iasls2el(vs;u4 rtrmf tydlp rlnes t0 eumxr3nudapt  neilt arta(mpnt0tltn oetyt m rlu s;t4alxoxf3oatlpDeau o;s) rumxm3ou1ameelfvs sfsDtaxr ;t0apxnmf3tydla ea(von() lxoircoodfp e uvi t0s2xoim nydlp n neslt)a2tauroot0aee mf3iasfm2umu p;(4 rerxoctodlptranvilt0srtoir no1ap  lnvias  ruaxrooo0oexomfetydfaDemump;u0 rtoxo3tadlp rluvsls0tetmimpio4llen nci t srra(  ;t1aetn ociytlmDel(vpn(4texomo tytlmDrluesl(0trur(opou4opee fct s a2taxm no4opeo fcild a2um( pn(4trtoxrciadlaDrlnes t) rumimpoodomeelieiat arua( ont0tpx  ieiadls2elu pnu4texrmrcta1omteau s;s  rur(r3oodal  mnvsat aDrax oou1olen fciytla2uau p;(0tlxoxociytlpD livs;s  eurxm iudlmtelnvsls  Drrumoot0tetn iciysfa2ulu s (4trenmo oa1la rai s;s)srxm(m nu1ol n nvi t s2ta(moot0altnio3iatfm2em( s u0tlxoxr3oytfm raiei t sexrimpnu1lmt  nes (  Dtrx p;u4oetoiietyd a rlnvsn(4teeoio iotfmteau i;t)t2trxmpiu1openlfctlt srua( pnu0tpx  oetat m ra( snt0 exnmocootoaDe u i t)texrxm3iy1ap  mnvil()aDtmum ou0olx  f3iytfs ean s (0 etoxo tatlpD livs s truoxmpiydapte ivt tfs2tmx p;t4apeo i3tat a2elumon(0trtoxo oo1la rln olt)s2um(r ny1lle mnvils) rtrx  nu0olxomf3iatlm2rl(vo;(0aleoxo3io1fateli o;()t2urxopiu4op elicslt a2rmumonu0aeeoifeiyd aDemump;(0altomo oatfpt luvi s  2uoiopnodapen ics sf rrrx pnt0alx mi3tls a emnvs u4texnmf3iodomtr u i;()seuoim3io1olt lfei s s2uaxrono1optnmo3iat s2elu p (0altrmociadlatran olt  rtoio3io1ll nmfvi t)aDumuroot1ape mfciad mDrmn p;u4aexnmrcoa1opte ivi;t0trxr(mpno4opte fvsl(faDta(  oo4aee  iciydfa umn pnu0areoio3tytfat livslt s2tmir io4amtn fes ( srtmxmpnt0olt  feiysls uan o;()alxrxo3oo1omD  i ols  2ur(r io1olte nvt sfaDta(rp;o1opt moeilslaDuln ont)altriocty1opD au ols)s2to(opno1llenmfcias srtrxmp;t1ole mfeildls2el( p u4 eenmrciy1faDeli i;s sexo(m3ny1op e nvsat sDtaum ot0apx  feild a2ul(vpn() rtoio3iadlpteaivols  rxr(o no4apeelfeilsf rraxrpot4teenioetatfa uaumont4 reomociatlp eaivils  exoir ou1apee ivil(faDrau p;u0opeoiociydfmDrln on(4 etnxr3oatfmDrlneol( tetmim3ou1op nmfvsa(  Dtr( o;u1oexn ociadfaDua(vo;(0 rtnif3oa1opD  uvolt trumim3no4lptnmfvi (  rururpoo4altn fctad m emumsnt4trtoirciydlmtraivolt0 2uoio3oo1al e ictas arrrurpnt4tlto o3iaslmDelu snt4aexoxf iotoaDr uvo;( teuoirpoy1openlnvil( s2taxmoot0texoii3iysfs um(mp;(4tlxrio3oy1lm  aivs;(  etr(o3nu1opeelivs t aDumump;u4oexn ieiadfs umums u0artnxf ty1fmtelivsls t2urir3iy4ol  lfeta(  rta( ooo0aeeo oeiatfm emnvpnt4alenmo3iatlpDe ieil(0t2toio nydaptnmfciat srtmum ;u4ole mieiatfs2uluvs;t)arenxf3oy1faDrlneo t0t2xmio3iydll nlictlsfsrtru  ;u0alx mietasfs2uanvp ()trerif3iytlate nvi s) 2xrxo iydopee nvs s) Duru  ;o1apxn fcildfaDeanvs;u0 etoxfcootla rln il(0texmxopiy4om  mncias) Dtrxr ;u0tpxnmfctltla2rau p;(4 ltrxocootfpDrau ilt0 2tmirpio4llee fct s) 2rr(r nt0openmo3iydlmDumu pnt0aexoxoctatfptrlu o s)truoim3iydoptn fvs ()a2tmu  ot0oeenmfctydfaDumuvont0trermfcia1fmD  neo;(  2tmio no4lpenmnctl()sDrrxm ou4tet mi3tlsls2rluvp t4tlxrxr oadom rai s;( setrirpio1alen fvt (f 2rmuro;t1olenmictysfa2ul( sn() rxrmf oatoa eln ols)trtr(o nydape  fvias  Dra( o;u1olx io3tadfm2emumo (0 eeoxr3totoa rlu il(  exmirpiudlme  feils)aDua(rpnt4tpxoiociydls umu o;(0alxomf3iytomt  u s;s seto(r iodap n ici tf 2ua(rpou1tpt if3iyslsDeluvo;u0 eeomo3iy1oa e nvi s0teuoir3ny4llte fvilt arra( ooo1tptnif3iltlaDea(vs t0 reoxf3tydomD lneo (0teuo(m3oy1lptelieilt  Drmxmont1alt  i3tldla2emu o;(4areoir3oa1fpD  i o;t)seuriopiy4omte icia( sDtr( o;t1tle micilsla ua( p;(4 leoir3ta1fm  lnvsl( s2to(o ou1lle miciat  rtaumooo4aexomociyd m rmuvp;t0tlxoifcto1omDrlues;t t2tmxo iy4lm   fcs (  2ua(mo;t1opxn o3tydfs2ean s t) etnmo3oydfmDraieilt  exoir3ny4al emiei (  rrrum ot1tee  i3ilsfm ul(vpnu4tetomf tydfa   nvo t texo(o3no1op nlnct s) rra(mo;o0aexn ieiatlm em( o t0 exrif3oa1lmD  nvs;(0s2xrio3ou4lmeemfctl()a2rmur ou4tltomociytlaDrl(vs (4artrmo3iodfp  anvo ( s2uoio nydlle  ncsl()sDrm( pno1alxo o3ias s2ra( o;(0 lxomocoadop  ln sls0 ruo(o no4op e fvtas) rurumpno4teen f3ild s2uauvo t)aeeoio iy1latranvslt0t2tm(opnodlm   fcs ()arrrxrono0texoio3iytls el(vs u)aetnmf3oa1opD  uvi s  etoim oydlle  icsat)srrru pnu1tpt mfeiat a2uaump;(4 eeoif3ta1laD anvi () eurxr3oy1lm e ncs s)s2uaumooo0opxomfeiatfa2ua(mon(0 lxnmr3oa1faD an sl(0 etr(opnu4lm emnesa(  Dra(mo;u1tlx  iciysfs2rlnmp t0arxnmr oo1lpDr u i (0teumxmpnu4alen fcia( sDtmxrp;t0tpx  ietatlm2el( s;t0aeeoxr oadlp  ln i s srtmir ou1op  mnet s a2ururono1tetn ictasla rmnmp;u0teeomo oytopD  i s () ruoxo ny4om  micils)aDrr(mp;o4tex  fetad mDemn p;t0 eeoxf3tadfatrlueo;()s2xmxo3oy4lpen feil(fsruax  oo4tetomieilsls2el(vpnt0 etomf oodlpDr ivil(0 2to(mpiy4am   fciat)s2urum no4apeomi3tad s2raumo;u0trxnxo oa1oa   nvs s) 2xoxo3nodamen fvta(fs2tax p;o0tlxnmieiat a2ua(mo;t4altrxocoytopDr uvi s texrxm3nu1lp emicslsf 2rrxr nu4altomfciatfm ulump;(0 eeoiociatfmt lnvi;t)trxmio3ny1alte nvta( sruax  nu0tpt ioetasfs rln o t)altoif3iydopDeai s () euoio iu1ome  nesasfarrrxr ou0tpe iieiys a2umumonu0trtrmf iytop  ai i t)s2um(mpoo4lmte icslt)a2uaurpno4opxnmfctytfsDran o;u0tleomf3to1fm  luvo;s0srxr(o3nu4amenlictatf Drr(r nt0aexniiciat aDrl( snt)arenxrciadlp r nei;(0 2uoxm iy4ome lfvsa(fsrrau p;t1oetomo3iadlmDul(vs u0arxrxr3iytfmte ieols  rxrxr iu1op nmfcs s a2ta(m oo4olt  ieiyd a2rm(mo;(0alxoxfcia1lp  lnvs;s)srurxmpnodam e feta(faDtauroot0tpx ioeiasfaDrmnms;u) eeoir tadlaD auvi;t) 2xo(rpiu4lltn ivt s)srtmu p;o4aet ioeias a ua(ms u4artnxrctotoateluvil( s2trio3nodlme mncsa(fsDurx p;u0tlx mf3tlsla eaums;(0 lenir iytlaDean o t s2trxm io1lmeemivt s) rrrxm ;u1opx moeildlm2rl( p u)arerxo3iatfp rlues;(0 2xmio3nu1amtemfvia(f Drm(mpoo4tpen o3ils a2eln p;(4teenmr todlaDranei t trxmiopiu4lp nmfesasfsDtaxmp;u0aetomietlsls2el( o t0teeoir3ty1fm rli sl( t2xoir iudom  mivias s2trumpno4ole miciysla eln pn(0 rtnifciotoat  u i ( trtrxo3oy1al elfcs sfa2tr(ro;t0oeeo o3iyt aDrmn p;()treoxo3oodomD aivils)s2urxm no1apt lfetl() rtmxmo;t0teenifeiysla2eau s t)altnxfctodomDeau slt0 rxoiopoo4opt  fvilsfs2ur(  no0oeeniietaslm2ulnmp;()trxrmr iy1latr ivs;t)trurio3nudame mieia()a2tax pot4tltomo3ildfmDul(vo u4artrif oodlmtrlnes;s) 2xr(o no4ol elncsas)a2raxrp;u0aexnmi3ilt m ea(mpn()aetrmfcootopte u olt)s2umir nu1lpt  net tfs2uax pou4apxoiictyd m rl( s;u4 exrxfcoatla ranvolt0t2toim3nodape mietlt)s2tm( pno1tptn feiyt sDrmumonu0 rtrxr3ootfm   ies;s sexoim nu1llen nesasf rur(mpnt0alt ifciasla el(von(0 etnxoctytlm ean i t0s2toio3oodlmen feils a2uaxmoot1alx ioctys a el( o ()arxomf tydomDeln olt0 exoxrpou1olteliesls)a2trxr ou0tex mi3tltfsDuanmon(4 rerir3oo1laDrlu i s0t2xo(opno4om  lnvi sfarrmumooo0tpe  o3iaslaDulnmp ()altrifcty1omteau olt  etrxr3ny4lleemicils sDtmx  ot4opxo ociatlmDua(vp;t)treoiocta1lmteauvsl( s2umim no1lmenlnes s) 2umxmpnu1tpeo feiadls2umumpn()tleoifcta1fm  luvo;s) 2tr(o iy1apt lnvia(  Dtm(mont4altoiictadfa ulu s;t0 lxrxo iodfmDraivs;()trumxm iudopt lfvias  2ta(r no1oee mietytlsDelnmp;t)arxoxrcio1laDrlues s  2xmir3nu4lp  lfvt t artaum ;o0oltoii3taslm2ulu o u0alenmf3oo1lpDeli o ()t2uo(mpiu1olt mivtas s2ua(rpnt1olx mo3ilt aDrluvsnu4 rtoxrcio1fpt aneo;(0t2umirpoodll  lnvsl(farta( ont0tlxnmi3iltls rmumonu0alxnifcoadom rluvi s0 rtmxo3oodap elicsltfsDrrxmpou0tpen fcildfsDra(mo;t0tltomrctotlpD ai s s0t2uoir io4lmee nci () 2rru  ot0tpxo ieias aDeauvp;t4artomr3oatoat aivs;t t2xoxo iu4omtemicsa( sDrau pno0oltnif3tadfmDea(vpnu4alxnmrcoytlm r nei (0t2to(o3iu1amtnmncslsf Dta(rono1oleniieiat mDemu s;t4 lxrmfcoydlp eai ol(  rxmxo iydal n fvs t aDururpnt4aexn icildls rmn o;() rerxfcootfmte ieo;s) rtr(o io4op nmicils) rtr( p;t4apen fciys a elumsn(0trxrmr3iadom  lnvi t0t2ur(rpoodaptemivsasfsDumxr nt1tlxn ictad sDul( pnt)aetrio tadlpt aueo s)sruoxmpnodaleeliciat) 2rax  ;t1oltnioeils m rmnvp;t4tlxnir3todla   ueil()trxrimpiydome  netat  Dra( ooo0aetnioetld a rmump u)aetrircoatfatr neslt s2xmimpnudomtemfci ( aDum( o;u0oleoiiciltfs2rmuvp u0trxnir tytfpDr nei s  etr(r3ou1ap emieils)s2tm( poo0olenmoetyd a ulnvp t4 leomr iydopte u ol()teuoirpoo4lpt mict tf Dtm( p;o1tpenio3iys sDua( s t0alxoxrcoadlmDelnvil(0 rtrxo oy4om e nciat aDtau  nu4tetn feilt m umu o;()tetnir tatla ean o;()srtoimpou4opt livsatfaruaxm ;t0opxn oetls m rlnmp;u)arxnxr3tadfa  aieo t0 rxrxm3nudom  lfeils s2tm( pot1apxniociyd a rl(mo;u)arxoio iy1fpt  ivo;s)t2um(m3nodoptn nci t) rumxrono1ale  ieilt a rmu s;t0altrio iatfmtr n ils0 2toxopoo1lm elnes (f Duax pnu4tetoio3iadfa umnvpnt)tltrxo iytlateluvo s) rxo(rpnu1altemivilt artm( o;u1apeomfctad s ulu snt4texnmr3io1fmDr nvils) rto(mpiu1ameemivia() Dtr(mooo0oet ifctadlaDeanvp (0arenxo3tytfm eaivs s)sexrimpny4oltelnei s aDrmurpnt4ole ioctys m2raump;t0altnif3iadlm eluei ( teuoxo iodol nmies tfsrrru  nt1altoii3iysfm2um( o;u0altomrctadomDr u s s)srxrxrpno1lltnmfvta(fsDtau pno4alto feias mDua(mo;u0texrxocta1opD anvol(  exrxmpoydoptemnvilt)sDtrumpoo4tpe  o3ils aDulumonu0 ltniocoa1omDeanvo;( s2tr(m iy4omt lics tfa2ua(r ou4apen ictydlm2ra(vp;(0tlxnioctatla e ivi;s t2xmxr3iodoptnlfvtas  rtr(mpoo4aexnmf3iydlsDea(vs;t0tetnxr3oadomD  i i;s0trtm(r nu4amenlfvsat) 2rr(m ot4aexn fetytlmDrlu s;u0arxomf3oydfpt  n ils) 2toio nu4lltn nctat)aDta(mo;t0teeniiciltfm ra( snt0tetrif3oadfmDe iei s setm(rpoodlp nmietlt sDtrurpou0opxomo3iys mDuluvo u0 lenmo todomt luvi (0s2tmirpiodop nmneslsfa2ta(mp;u4texo ociat s2rl( o;t)aeeriociydfpt  u s;(0trxoxmpny4lmenlnvt t) Dua(mo;o1tpeoifciadlm el( pnt0tetomr3oy1lp rluvi;t)trtr(opny1aleemics sf 2uaumo;o1tet  iciydls ra(ms;(0 exnxf3oadfp rlieo;t0 euoxopiy1ll  mnes t)a2tm(rp;o0aeenmiciltlsDea( o;u) lxoifciydla eli o;(  rto(rpny1lm nmfcsl(  Drm(ronu1olx mfeiatls ran s u)treomocoatlaDeauvo;t)t2ur(m oy4al e ietas s2ra( ono4opxo i3iyslm2el(mp;u) lxrmf3oatopD li o;(0srxo(o oy1alte ivslsfsDurum nu1apen ociys a2em( o u0aexnmfcootfpt  nvo (  rtrir iodlme  fvta(  Duaxmpnt1aee iiciytfa2ua(mp;u)arxnxo oydlatr ivsl(0sexmxr3iudaltnlici t) rrm(  nu0ape iociyt s2uanvo;u4 ltrxrcia1lmt  ueo;s setrimpiy4altn icslt sDta(rpnu0tleoiieilsla ul(mon(4aleomo io1lm  ln o (0 etrxo3iu1am emfct sfaDua( o;t4aleniociydfm rlnvsnt0teerir ta1fmtean s;s  rxmxo no1opee fcia(faDtrurp;u1olt  iciad sDem( p ()aexoxo3ootfp eaivilt0setmiopoy1op nmivias)srururoou1oleo fciadfs rm( onu0tetoxr oy1fmt ai i;t0s2umxm3ou4oltnlictas srum(m oo0aex iieiytfs uanvo;u0arermo3ty1lpt  n s s) 2uo(opiudlpen ivtls artauronu4oexniictadfaDemnvs (4aleomo3to1op eli s t)srtrxrpno4apeelncil(fs2rmxr nu1oexoii3iyslm umnms;(0arxrif3oatfat aivo;(0trumir iydol nlnvil()a2rmxro;o0apeomoeiyt s eaump u0 lxoxo3oo1op   uvi;s0srtrxopnu4amenmivtatf rumxmpno0apxomfciytlmDrau p;u0 rxnmf3ootoaD anvolt t2umim io1ap elnesasfaDraum ;t1apt mictadfa2emnvo;u4treomfcto1oat lnei;t0srurim iodll nmnetat srtmx pot1tpx moeias s2emu p;(4trerxf3oa1laD  uvi t)t2uoxm oy4lptelieia()s2urxro;o0tptnifeiatfa2emu s (4 eenmr ia1faDeauvil() 2umim3io4apeemfet s srrr(rpot4tpeomfeiasfa2rl(mp u0 rerif3ia1lmte nvi;()texmio3oo1aptn nesasfa2rr( ooo4tlxnioetadla2ua( pnt)tltnxo todla  lu o;s)sruo(rpnu4oltelivil(f 2tmxmpnu4texn ictydfs eln s;t) rtnio iadfpD  ivs s  eto(rpiydlm nlieias) 2tm(rooo1aexomieildfm2ran o;()teerxf todlp r n s ()s2urxo3no1omt  fcsa(faDtm(rooo0aet mfcilsfm ua(mp u4texrifciy1fpDe uvo;(0 rxmimpiydoptemnei s  2rr(r ;o1tpen ociytfaDuluvp;()alxoirciydoa   neils0s2tm(rpoydap elicil() ruaum ot4alxnioeiadlm2eaumsnu0aeeoioctytlmDelnvs (0 2tr(r oudope mnctat srurxmonu0ope ifetydla rmu s;u4aexoxfctydlmD  ivo;t) etr(r3io1al nlfvt tf 2rmx p;o4texniicildfmDum(vo t)trtoxocty1omDe n o t)seurxo oy4ope lieilsfsDtmx pno4alen i3ilsfs rl( p (0tltoxf3iytfm eli s s)teur(r no1al  mfeil()arurx pou0opx mociyd a2rm(mpnu4 renxocto1fpt li o t teumxr io4lp nmfvsl()aruau p;o4tptoifeiysfsDuln snu4tlxoxr3oatoatrli s;s) etm(o3ou1lpe lictl( srua(mo;o0tpeoioeiysfs2eau s u0 etoir3iatoatelneols sexmxr3oo4lp nlfctlsf 2uaurpou4tpeo fctydfs rlnmpnt4 lxrmrctytfaDrau slt0s2urxm3no1lp e ictlt) 2raur ;t0oleomoetld s2rlnvs (4alenxr3tydfat lu olt0texm(mpnydlm emnci s)aDurumoou1tleoifciys sDrlnmp;u0 exoir tytoaD livo t seum(r3io4am nmicils)sruaumo;t0aexn ociatls elnvo;u0aetriocty1fa  lnvs;s) exr(m oy4omte fet s)srua(mp;u0oee  i3ildfaDuluvo u0teenif tadlptelueils truriopoudlm e ncsa()aDumx pnt0tlen ociatls2rm(mp t4trxoif iy1op  auvsls)srtrim3io4lm nlncta( a2trumono0oeeo ietytla2um( s;t)teerxo oatlpD luei t0truo(r3iydlltn ictas  rtr(rpou4apt if3tytlm uanvon(4 ltrxo3totfa  lu i t trumxm iu1opt mnesat) rra(mo;o1texo ietldfa2ua(monu0trerxrcto1fmt luvol(  2uoio iy4aptnlncsat sDtmxrpoo4apxomictaslsDuauvpn(0tltoxr iytfm   ues s) 2tr(mpou1aptn ictlt srraurpot4tex iictys m eaumo t) exrxfctotla e nvils trxriopnodap emnctlsfarumumo;u4aeeo ietlt a2umnvo;u0artoiocoadfmDean o;s) rtoim nudaptelfcs t)a2trx ooo4olto oeiysla ra(vont4tltnir tatlat  uvs s0t2urirpiy4aptelfvsl()aDtrxmpnt1aexo o3iatls ranms t4aeenxocoo1lmt lnesl()texoir3ou1oltnmnctat)srtmu oou0tltnioeilsls2ul(vpnu4trtrxf3iy1lp e uvil( seur(mpnu1ol elivtlt)s2raxr ot4tpx mociyd sDrmu s;u0 eerir iodlmD anvils  2tmir3ny4amt lfci t)a2rmur ;t0tlxn iciytfmDrm( onu4 rxoxo3oodfateluei t)srtrxopio1lp n ieiasfsDurxmpot1oee mfetasla2umnvo;u)tetnmf oy1fa elu i;t0trxm(o io1alee ies s)a2tru pou4tlx mfeiasla2rau snt0 ltrxr3ty1fmtelu s s0srxmio3iu4optnlncs s) 2raumpou0alto fctadfa2rm(vo;(4teenmf io1fat anvs ()tetmxo oo1om  mfvil(fs2ta(  ;u4aleomf3iatla2em( s;t0texoxo3io1lmte ieolt)srtmxr3oo1ameemiei (  rrmur nt0tleniietlt m2eauvpnu0 leoxrciydlmDeai ol() 2xrirpoo1am nlivslt) ruau o;o1aeenifciatlm2ea(mp t0 lxnio3tatfa  ln sl(  2tr(r oy4lp eliesas)srrr(rp;t1aetnmi3tytfa rm(vs;u4trtnxocoadlaD anei (0srto(mpnudlptn fvs t  2rrx ooo1alx moctadfa2el(mo;()aeerir oytfp eln i t) rumxm3ny1apt  nei ()arrmx ooo4aptoifctld s2ulnvs;u)aexoio iotfaDrli s (  2ur(opio1amenmfeiat) Dtm(mpot4oex iociatlmDean o;u) ltrmo3iatom   nei (  rurxr3iy1am e ieiatfsrtmurp;o0apxo ietydfa el(vpnu0treoxo3todlmDeauvs;t srxo(opny4ol emncil(f 2rmu pou0alt mo3tasfa2eauvp;u)arenmr iydfmDr ieo;s) 2xrio3oudlle mivi s aDrmxm ;o0aleniietat sDra(mo;(0 leomo3iodoatraiesl(0s2umxm3oudomeelnvta(farrmx oot1opx  octyslm2um(vo;t0aetomo3iy1fa  an il(0 2xmio3io1alee nvs ( arua(  ou0tee iocildfm2rl( on(4 eerxf oytlpt ln s;t)t2to(r3oydll nmnci s) Duax  ou0alenmiciysfmDrlums u0 exrifciotfa rlnvo;t srumir nudlpenmfctas)a2umuro;t0tpx  fcilt s2rauvpn(0 lenmr3ta1op eau i t t2urirpou4amtn ici (farra(mpou0apt  ociat s umu s u0 rxrif3oytfp  lueilt)t2urxmpiu1am nmiesltfa2rm(rpno1tetnmo3ild m2um(mont0 eeoif iodfmteai o () 2uoxo iudlltnmnvia()s2uru  nu0openiociyt s2elums;()treriociytom rai ol()srtm(o3oy4apenlivta( srtrx p;o0apt ifetls s2rauvo (0tltomrcoy1omDeliei;t srto(o nodap nlnetl(fsDtm(mo;o0tlt mi3iat sDem(mpnu)tetoio3iotop  auvs;( s2tm(mpoydape lieia( srraxrp;u1altoiiciysfsDumuvsnu)trtrmrciy1fmDe i o t0 2uoxmpiy4am  mnvt t)srrrxr ot4tex iociyd a2ua(vo t) rxrmrcio1op eauei;t) rurxr iy1alenmfctl()s2tr( ono4texoif3iys a2el( snt) exrmf3oadlatraueo (0 2xoxm oy1om nmfvilt)aDra( oot1opxnmo3tlsla2rmu on() ltnxr ootlpDr ivi s sruo(o3ny4llenlnvtls aDum(  ot0aexo i3iatlm2umn p t4 leoxo3oa1lat ai i;t0 2uoxm3ou4op  lnet ()sDtmuroot0alxo o3ilsfs ran snu0alxrmo to1oaD anesl(0 etoim io4lmtnmici s)aDra(mooo1tetomfcild s2rm( o t4aexomrcoa1laD aivs;s0trxr(r3oy4ope lfcsas)s2rmu p;o0optniieiytlm eluvp;()tetrxr iatopD aivo t)t2toiopiudlmtnmfci sfs2trxrono1tlto fctyt a2ra(ms;u4arxrifcootlmteaiei;s s2uo(m iu1ap emfcsas)aDta(mooo4aeeoioctltfaDeln p;u4arerifciotop  aneo;()trxrxopiudom nlfcs tf 2urur ;u0olt ifetlsfs2ua(vp;u)trxnio oa1lptrlu ols trtrxr3io4amtn iesas)aDrrxroot1alxnifeiys aDemumo;(4trtnir iadoa e uvi s)srum(o3iu1lptemict ( srum(mpnu1apxnio3ildfm2elu p (0texoxo3oytlmDe uvslt0sexrim ny1al emneslsf 2rr( o;u4oltn fciasfa eanvo;t4alxrxf3ta1oaDe ieols)srxoir oo1lme mnviatfsDtmxr oo0alxnifcilslm rl( on(0 leomo tydopteaneils0seuoxopnu1al emfeta()srurx  ;u4texn fctls s eauvo u)arxnmo totfpDr ies s0t2tmxopiy1llenmiciat) rtaumooo1apeomf3ilt mDrlu ont0tlxrmfciytop  ln i ()setoim3nu4openlfeilt s2rmxronu1tlt ioctat a2rluvo;t4 lxnio to1late u s (0texoxopoy1llt  nci ()a2tr(r ;u4teeomiciatlm2rl( p () eermo to1fptraneolt0srtmir3iodlmenlietl() 2trxmo;t1oexnmfciytfm eaumont0texnircoytoat aivi s)tetmio3oydam emivt tfa2rr( ooo4texniieiydlaDuluvo;u) rxrif ia1fpDrlieilt)trxr(r3nu1op emics tfs2rau  ;u1aeenif3tyt mDrmuvonu) etriociotlm  anei;s) euoio ny4lltnmfesas)aDtm(m ;u1apt ifeiysfa eln sn()trxrxocoatoat lu il( t2toxo iodlltelivs s aDrmx p;o4opxn ictytla2ea(ms t4 lerxo ia1laDrlu o (0trtm(o3nu1lmeemnvtasfs2rm(ro;t1tlenii3ildfsDumumpn(4trtomfciydopte i i;t)trurxr iu4lp   ieia(  Dur(r ot4apxomfcilsfs emuvs;t4 exomr3ootfptrlu i;t0trtrxm3nudlle mivtasfaDrmumo;u1tlto oeiytfa2ua( s t4 eenirciytfat  nvs;t  2xmimpou
\ No newline at end of file
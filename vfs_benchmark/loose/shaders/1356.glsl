@@ -0,0 +1 @@
+i ils0t2urimpou4ap  lfetltfarua( p;t0ale moetltfmDran o ()alenio3tadfmtelueo ( s2toxm3oodop   nesa( artr(mo;o1teeoioeiasfaDrmu o;t4trerxf3tydlpte uvsls)t2tmxo3oudapenmiet (faDtax pnu0oltn fetydfs2el( o;u0 eenmfctydfpD ln o s)s2uo(rpno4lmt  nes t) Dtrx  ot1olt iociasfmDel(vpnt0tleomr3iy1omtrai ols  ruoxrpnu1aptn iciatfa2tmumooo1aet io3iatfs2rmn s t4tltomr oydlp  au ols) 2xr(o oy1oltn ies sfs2raxmp;t0opxnmieiysfmDel(vsnt) rxrmf3tytfat li s;s0 eumxo nydapt  fcils aDtaurp;u1oee io3iat sDumnmpn()tlxrif io1lmD au i;s0 2xm(o io4amt lict s) Drr(r no1apeomi3tys sDumn o;u) reoifcoatlp  lnvols)texo(opoudll  lfeiat srua(m ot0olxn ictldls2uau s;t)alenmrcto1om elnvi s  rxmir3nydap elieilt srra(rpno4aeenifeildfaDrlumpnu0artomfciy1la rlies s  etoio io1oltnlics s  2tm( p;o4aet moeiat a2eluvp (4 ltnmf oytomDelieo t  etmxo ny4al nmfvia()sDra(rp;t0apx iietytfmDranmp u)aexnxrcty1fp eluvi;t  rxo(opoy1llen netas)srur(rpnt1opxnmfcias s2rm(ms;u4 ltnmo3todoatelueilt0t2tm(r3no1ap n fesas arumx onu0alxo iciatfa umn pnt4aeerio oa1opt luvs s0sruoxr io4olee feiltf 2tr(mp;t4ope io3ils s emnvo t0aexnmr oodfa e ivs t  2umxmpoy4op  mieil(fsrrrumo;o4tlt iieiydfs2rmnmo (4 lxomf io1oa e i sl()seum(rpiu1op n icslt)s2trx ooo1olt mo3ias aDumump t4aexrmf oadoa  aivs ()srxrxo3oudome  ieia(  2uau pnt1olx mfciltfaDum(mo;() eerxo iy1op rlieo t) 2urxrpou4op nmfvtlt)sDururono1alt  fciltlsDulnvp;u4arenxf3tydfmte neolt0 2um(m oydlmtnmnet s  2rmurono0ale  f3ils s2elnmsn(0tlerxo3iodlpteau o;s) 2tm(r iu4op nlfctls  rum(m no1olxnmieiadlmDel(mp;(0aexoir3oo1fpt  ues;( s2toxopio4llenmivi s)s2rm(m ;u4texnmieilslmDuaump u4tleomr3tadlpD aivo;s setm(opny4ope lietas)a2um(mooo0alen oeiys s ra( p;t)trerif tadfate n i;s) 2xo(m3nodlp e ivi t  rtmumont1oetoiieiyd m2ulnmo;t0 renmrciytop  aivi (  2xo(mpno4am e nci tfa2tr( onu0tlxomf3iatlmDeanmp;u0 lxnxociy1lpt aivs;s)s2to(o iudlltnmnes tfaDum(rp;t0tlt  o3tad sDuauvon(0tltoiocoodfmDelnvi ( trxoxr3oo1ope lnvia( a2rrx  ou0aetnioeiatla emn p t)teenxo oa1omt anes ()t2trxo3oo4lltnlivsl( sDrr( poo0aptoifetatfaDrmuvonu4 ltnxf3to1faDeln ils)srtm(rpou4lm   ictas)arumxm nt0aeen fetadfs ra(mpnu)tetnmo3tadlptelieolt) 2to(o nodameelfetls) Dur(mono0oetoifciatfa uluvpnt)tlenxf3tytfatraivs ( t2trio3no1ole lfvt sfsDtr( pot4tpxo feiatlsDul( ont4trtnifciodlmDe u i;()t2um(r iodope  fctas) Dtm(r ot4tetniiciadfaDuanmonu4altoif oatfp  ln ilt0t2um(rpoudomee fvsatfaruru  ;o1oexomictytfs emu s;u) rxoir ootlmDrluvols0s2tmirpnydlp   nvia()s2rmum oo0tpe  i3tydfsDrl(vo (4 etnircia1lmDeanesls0sruoio3oudlm   iesltf rumx  no1optniictlt a rmums t0trxoio3tadoaD luvi;t)s2urxmpiy1aptemnvi s sDurumooo1aet moeiasfs2uau p;t) lerxrcootlmDrlnvsl( trxo(o nu1alee fvtl(  2rmu pnt1olx  ocild a2ulnmpn(0 renmf tatfm elivsl(0seuoio iydoptnmnetat  ruaxmo;u0open oeilsfsDrmn s (4arxomrciydlm ean ols0trxrxo oydaptnmieta(fa2umuronu0tpx ifetad s emnms (0altrmfctodfpDeauvi;t0s2umio no4ol  mncsatf rraxrp;u0apx ii3iytfa ulnmpn()artoif3oydfm eanvo t  euoir nydomtnmfvtat)s2taxm nt1ole  oetltls2eluvp;(0trxrir3oy1oaDeaivsls0 exrxmpiudal  mfviat)a2taumpot4aeenifeiytfs2rl(ms;() leoxocoadfa raueolt0t2to(opoudapt  ietasfsrrax o;u0teeomoeiatfa2el(vo;t4 exrxr3oo1lmD ln i s0 2xmxrpou1aptn ivt (f rumu onu1tpxnmi3iydlaDem( onu4texoxf tadfaD anvs;(0t2xmir3oodam elfesa(fsDrrxr ;u4tlto ietad a2ulnvs u4 etrmocoodlaDr neols0texoir iodlptemnvi s a2rax  ;u1ale mi3ils s2eaumont0tltnxf tydfp e n s;s) 2xo(r3nudlme livta( srua(mpot4tee mictlsfs eau s;t)aeeoircoytoaDelivil() etrio3iy1amtelfei t srur(ronu1oexniociadlsDrm(vonu) rtrmr oa1laD  i o t  2xmxo3ny4omeemivtlt srurxmono0tpxniictad m2rauvp;(0alenmociadopteaueo;t)trum(mpnu4altn ieta( srumurpot0teto feiltlsDuluvs (4 eerxr oo1omteau o ()s2umxopny4lpt lfvi (fs2rmx p;u4oetnifetadfs uan o t4trtoxfctydfmDr nes (0srurxr oo4alte fei tf rurxmpnu4tex mi3iat m rm( pnu4 etrif3tydlmD  ivs t0t2urirpno4amt lfvi sf 2ua(mo;o0oexomfctlt s ra(mon() reoxrcoa1faDrlu sl(0texo(r3oudam  lnvia(  2rrum nt0oexnio3ils m uln o u4tetnmo oadlaDr uvo s0 2ur(r iydomtnmfviatf rtau onu0alt  fciys mDeau s t0texoxr ia1om rluvsls)teur(m3iy1omt mnvsl() rrrxm nu0aptn oetldfm rmuvs t4artoir todfm rlneo;() etrxo iu4olt lnvils arumx onu0texoifetatls2el(vo;u0tetomo3iytlp rluesl()tetmxo io4am nlfctltf Dtr(mpnt0apenmf3iyt s2rmump u4treoxf iydom rlivi t)srtm(o oo1aptemfciltfsDrm(ront0texomf3ias a2rl(vo;u0trxriocta1fpDelnvsls0trurir3iy1op elivsas)aDua(rpnu1aptnioeiat m2rl( o;t4aetoxr3iatlm rluvi t) 2urxo3oy4ll elivilsf rumum ot1ale mo3iatla2ulums (0 etrifcty1fp rlivo t0s2umim nudapeemfct t)sDraumoou4apeo fciydla emn p;t)tlxnircootfp r nei;t0trxoxm nu4oltnmiesas artmxr ou0tle  ociyd a rl(vsnt0altoio3oadlaDe ivol( s2to(m iudllen fcs ()s2tru ono4tee ii3iasfa elnmp t)alenxrcoodomt aueo;t)teumxo iudlm  mfcia( srrau  no1aptn i3tlsfm elump;u4treoxf3oa1lpDr i i;t) eumxr3ou1ape mfctls srumxrpnu4opxnmfeils m2ra(mp u)tetomr3ia1lp eai o s s2trxmpoudom  licias aDrr(ro;t0tpe mo3iadfsDem(mo u)treoxo iadfpDe ueo;t0 2trio3iydlmt  nvtls)aDrr(mpno0tltomociys aDrmuvpnt4alenxr3oadoaDe n ilt0t2xoir3no1alenlfci s) Dumxmpnt4apeomi3iatfsDrmnmpnu4 ltomo3tytlaD an i () 2xoiopiy4am nlnci tfartaxroot0tet ioeiasfs emuvo;u0trxrmrctatfm eluvolt)teumir3ou4aptn fvia(faDua( ono1tpxoiictltla2ulu snt4 rxrmocty1laDeln s ()s2umir ny4ll nliesls) Drmum nt4apx  fetys s ean s;t)tltnif3iotfm e u o;s0 2xmxm3ou1apee ivsl(f 2tmu pot1opeo f3tltfm rm( sn() rtomrciy1lm  lieo ( seurxmpoy1alt mfetas s2rrurpnu0teenmo3iadfa elnvo;t0 lxnifciytop raivo s)tetmim iy1omtnlfcsltfarta( p;t4oet  i3tas s2ua(mp;()alxnmrcoo1lptelnvi;()teum(r io4ap nmfei ( aDtmum ou0oeenii3iadlm rln o;u) leoir3oatom   ivi;s0trxm(opoydamt mnet s  rrm(mpot0aet mfeiltfm em(vs u0aexnmo ty1laDe ieo (  rumio3nudom  licsas  2tm(root1apxnioetyd a2em(vsnt0texrxf3iatfm  auei;s trtmxmpoo4lp n nci s aDrmuront4aptn o3tys mDua(mp u) reoioctadfateaivs s0srxrxmpny1al  lfci s srurxroot0tle mociatfm2rlump;(4aexnxr ta1la   ueo t)t2ur(rpou4ame  ivt s)aDtaxr nu1tleomi3iasfa rlnvo;(4tetrxr tadomt aueo (0seurxm3iudap  lnci s)artruronu1aexoioctlsls2ulu sn(4 lerio3ta1fatelnei;()sruo(r3iudope  fvsl()sDurx o;t0aptomo3tas mDrmnmonu4 rerxfciodlpD aiei;() rto(o ny4apee iviasf 2umump;o1opx io3iatlm uanms;t)arxoxf iodlpDr nvi;t  2xm(mpoy1lm e fvt s aDum( ont4opxn fctldlm uau s u)tetrmr iotfa  anvo;(0trxmir no1lltnmies t)sDrrxrp;o1aeeoioeiydla uluvsnt0teeoxf iotlpD aueo;s trxrxmpoo4lme lncs sfaDrru  oo1tlenifciltfmDuanvo (4alermo3iytoaDrluvs;()texmiopiodol  mietls)aDrr(r nt1aeeoiociadfm2ranvp;t0 eenmf ootfa eau sls t2tmxopiu1op e nci t)arraur ou1olxnio3tltlmDulnvo;(4altnmf3iydfat  n o t) rtmxr3nu1altnmicias sDraur ot4opxo oetad m emn snu0tltnir tytlp rauvs (0trumir3oo1lm  lnvs t)aDtmurp;o1olenmoeiyslm rmnvo;t4tltrmf oodop eaivo t0t2urxr oodal nmics tfs2ta(  nt0oexnif3tysfs2rl(mon(0 rxoxr3tydfaDrluvo t0 ruoxo3iu4alen ivt t) Drmu pou1tlt mf3iasfa rm(ms u)aetrxr3oa1lp e i s t)trxmio3nydllenmieslt sDtaumo;t1oex  i3iyt a umuvs t) etnxrcta1omteauvi (0trto(mpoo1olen ncia( aDrmuro;t1oetniietyt aDrmnms;(4alenxo3tydfpDrli i;s)setrim ny1lltelfctas) 2trum oo0teeo oeiatfa2rlu p;t0 exrmo iotomte neo s)seto(o3io1olee fvsatf 2tmumpnt1teeomoeilt a2ua( pnu0texnmfcoa1lp rlueo t trtoxr3ny4al  lfciat) rumumo;o0olxomiciadlm rl(ms u)tlerxfciotopDr ueo s0s2um(r3oy1lme lnvi ( sDrr(moot1teen ieiasfa2rmu s;t4 lxrxf3iytlp e u sls  etrim no4oltelnesls s2raxroot4ape mfctlt s rluvonu0 ltnxocia1fpt  nvs;(0setmxrpiy4lmt  fvsl()arrr(rp;u4oet ii3iyd s2emuvs (0areoxrcoadomD aneilt  2xrxm3nu4olen feslt  Drrumo;o1oeeniicias m2emu p;(4 eeoio tydoa elu il(  euoxr iy1alt mnes tfartrx p;o4teeo i3iatfa2eanvo u)aexoif iadfptrai slt  2xriopiydlpt mnvi (  Draurp;t0alxoioeiatlsDra( o u4teerxfciytlmte i o;s0trto(r oo4lmtemivi (f Dum(mo;t0altn o3tldlsDul(vs ()trxnmr todlp ean o;t srxoir3iu1oltn ivsltfaDtrumpnt1tex ii3ildlm ran p t)alerio3to1opDe neolt texo(opnodamtnlieil()s2uru pot1texo o3iytfa ua(monu0texomo oa1om ranvs;s  eumxm3nudaltemnes ( arumu pot0opx  f3iytls2em( o u4 renxr tytlptraivo;t tetr(m nu4ll  mict (farrm(mpou0alx iicils a umu o u4trtnxrctatomtrlnvolt)sruo(m oudalte fvs ()a2urump;t0tltnmf3tys s2uan o t) ltrxrciydlpD au ilt0 etm(o3ou1lm e neslt sDrrurpnu4tpxnifeiyt mDeluvsnu0 renmr iadlmDr ieol(  rxmxr3oydalenlfctatf rtaxront1apeo ieiydfm2uan s;u)aexrio tadom  an sl(0 ruoxopio4lpe lfet ()aDrmxrp;u1teenifeilsfa2rmumpn()tlxnxf3to1fpDr nvs t)sruoxm no1lpee nciatf 2rm( pnt1aexn o3tys mDem( sn(0alenxociotfaD lnvs s  2toim ny1lltelfesls  rtaump;t4aexnioetadlaDulumo;t4 etrxrcoo1lptr nvo;s)srtrio io4ope  fes tfartru onu0texn f3tydfm2rauvs;u0trerirctodfmDr ueslt)setoxmpou1ole mnct ( artmum nt4tpeoiiciytlm2ua(mp t4artrmf3to1oaDrluvo;t0srxm(r oydllee fcia()arrmu  ;o0olxnmo3ilsfm2ulu s;u)trxoxo oatoaD lnei t0 exmxo nu1lm  livilt artmum ;u0optomoetydfmDrlu on(0 eenir oo1fateanvils0 exmio3iy4omte ivsa( s2ra(  ;t1tpe  fciydfm emn o;t)trxnxo iodla rauvo;t)sruoxrpoodamtemfeiat)a2um(r ;t0tlxo ocias mDem(vo ()trxnxfcoadop eluvil() rtmiopnu1oleelncsas) Drmxronu1olenmieiat s eau pn(0 rxnmf3ootfmD luvi;()srtm(o nudlp  livtlt) 2raxm ;u0tlto oeild aDuanmo t)trtnxo3oadop  aneo (0texo(o iy4oleemnvs t)srua(rpno0tet mfetlt aDrl(vpnu0areomo3oytlpt  n sls srxo(o3oodlm n fetat  2rru oou0apt moctysla ea(vp;()alxnir oytfaDeli i t)seurir3nu1op e fvtls)s2rmxmono1tex ifctldlm2el(mpnu0arxoxfcoatfa ranvi s0 etmxrpiy4lpe lfvtltfa2rm(r no4texoioetysls2emu s;u) exrmocoa1fmD aiesl()teuriopnudoltnmfcilsf ruaurp;u0aexomf3iysfm2uanvont4arxnmoctadfatr uvi s)trtrxo ou4lme mnetlt)arumum ;u1aexomoetld m ea( snu4aeeomr3tydlm  anvo s)trtoxr nydamt lici tfs2umumpnu4opx mf3iydfa um(vs;t4 rtnxo iatopt au olt)teumirpnydlpen ivt ()aDtmu  no1tpe ioeiaslmDran sn(0trxomf3oo1fmt  nvols)trxrxm oy1lmenmfesat) Duax pnt0oee moetldfm ra(vo;u)alxomr oy1laD livo s) 2xoxo3io4ap nmncils)a2tr(m ;o1tlt ii3tyd mDea(vsn()trenxr ta1opt lnvsl(0srxoxr ou1am  lfvil( a2rm(mpou1aeeo feildfa2emn s;u)aeeoif3tadoa  livols s2xoir3oy1lmee nct s)s2ur(  oo1tetomoctlslaDum( onu) lerir3iodlm ran s s  euoiopou4al   ietas s2umx  ou0aexoifeiadfa2ul(mon(0teenmfciytfa rluvo;s0 etmim3iy4lm   ietlsfsDtmu ont1texoii3tytlaDra(mont) etrio3oatlp r ieo ()srtmiopoydlpt miesa() Dururpnt0olxo ociysfs rlnvs;(0trxnxfctadfmtelieol(0texo(m iudlp emivslt)srtm(  ;o4tle if3tyt a rmumont0trxnioctodla   uvil(  2toxrpoudlme lfvta( s2urx oot1oltomo3ildfmDul(ms u)trxoxo3iytlp r u s s srtm(r iy4al e fvsl( sDtau  nu4oetoii3tadlsDrmuvo;u)aexrmrcty1fpDe u slt0trtmxo3oy1om  licslt) rraumoot4optnmiciaslm2rmump (4tlxnxf tadomt aivilt) 2xriopnu1lm  lfviat  Duaurpot4aee  iciydfa eanmo;t)trtniocoatlpD lnes s) rxr(m oo1apt lfcsl(f 2tru  no4optnmiciydls2rau o u0 leomfctodom r n o;s0tetr(rpny4lmeelnei s aDum(  nt0apx mfciasla2eau o t4 ltrir iydopDr ivil(0tetmimpoo1lm nmivi s) rraxmpou0aexnifeiasfs uau o;t0alxoir to1fpDrln ols  2urir oy1amtnmiesl( s2ur(m oo0tptnmieiad s2ulu o t) exnirctadom elueslt trtmxopiy1opt liei tfsrrmxmpno1tetnmfcilslm eanvp;u)aexnio oo1fm e nes;(0t2umxr3ny4alen fcia() rtaxmpou1apxo i3iltlaDemnmsnu) leoifcoatoa r u i;t) 2tm(m3iu1lp e ivtatfaDrax  ou1oltomf3tydlaDran p t0tetrxoctydfa r nvil(0 2umir3ny1om   ies tf Drau  nt1tptnmfeiatlmDeluvp;(4alenif totoateaies;s) exmirpnu4amtemieta(f 2trx  ;o1ope  octyd a eluvp;u0 rxnmrciatlptrluvs;(0t2uo(r3nodlpe lfet tfsrtmx pot0tptoifeiatlmDra(vs u) eeoioctatlm eai slt trxoim3oudal  mnvilt aDtmx pot1aetnmi3tytfmDrmu pnt4artnir3tydlatrauvi;t) eurxmpio1am   fvtas aruax o;o1opeo f3ildfs2em(vo t0aeerxfcoo1omD  u slt) exrim3iudom  mnvslt  ruax p;t1texoiictldlmDra(mon(0aetnmrcoy1fa eaneslt0s2urxo3iudlmeelncilt)artrum ot1teeo o3iat sDuan ont)teenxrcoytfm  li i (  exmxo3oydope  ivs ()s2tmx  ;t0oetnif3tad s2umnmp;(0tetrio iatomtrlivo;t)srxr(opiudalt  ivil(  Drrx  ;o1tlen ieildlm umnms ()aeeoir totlmD an i;t) exriopio1lptemivt t)s2taxrpot1tpenifciysfaDumn p t4arxoir iydom  anvi s)tetrxm3iy1openlicslsf rraurpnu0tlen oeils m2ea(vp t0 etoircty1optran s;t)t2xrimpno4oltelicia(faDua(  oo4alen octas s2uan p;u4 eenxr oa1optranei;t tetr(mpiu1al n iet sf 2rmxm ;o4oleoii3iat aDul(vp;t0altrmrcootom eln s;( t2uo(mpnu4lleelicsa() 2trur ;u4olto f3tadfmDem(mpn(4 lxomfciodomte uvi (0 rxm(mpnodam eliesl()a2ta(m nu1ole  fciatlmDrmumo t4tltnir oydlpteau o;s srxrxmpno1amt lictas)aDrr( poo4alxn ieiytfmDeanmsn(0tltoxr3tatfa  auvs ( t2to(mpio1opee fcsls a2rrur ot0oex  fctaslm umu s u4teenmf iadomD anvo t0sruoxmpiudop nmiet (  2rrump;u4apxnmfetldfs2em( s u0texoxfciotfptelivi;t)s2tmirpiy4am  lfeilt  2umuroot0teto i3tasfm2rm( p (0 rxoir to1fa raivs t) rxmxr3io1lpe  ivs s  2urxroou0apxnmociyd s2uau p;(0trtrxo ootomt li i;t)t2umirpnodol elnet ()aDumxrpnt4ape ifeiysfa2ulums;t0 etrifciydom   u o;s trum(o3no1om e nvi (fa2uauronu0tpx  i3iydls2rln ont)alermocoodoa rauvols t2trxm3iodapte fvt () Drmuronu0tltn ieiytfa rmumsnt) rxrmr oytlpDe i i () 2xoxopoydll emfeilt)s2um( onu0tltnio3tltfa ranvp;u4 ltrmf3oytlm rlu i;(0texoxm3nudap e icta(f rtmumpno4olxo o3iysfm rmnvo u0tleoxo oydoat au ils0srto(o ou1olee fvi (f Dumur ot0apxn iciytlm umn on(4tltoxf iodfm rluei t)truoxrpoy1ol e fvi (  2uau  ;o4aexnmictatls rm(mo u4 rtoio3ootoa rai sl() 2trxrpiy1altnmfctls)sDumxroou1alt  fcilt aDean s (0texrif3oydomDrai il() eurxr3ou4ole mnetls)srraxmont4altnii3iytfaDul( p u4 etrifcia1fa eai s t0 2xm(m3io4am n netl( aDuaumono1tpxomociltfs2rmuvs () lermf3iy1lmD lu s;s trur(rpnudlm n ivsasf rrm(ronu1optnioeiatfs2rmnvp;t0altomr3ty1oat aneil(0seumxm iodapen ncil(fsDtmxmp;u4teeomoeiasfs2eauvp;(0aleniociodla eaueol()seumiopiu4ol  lfct s arrru  nt4aexnif3iatfa2ulnmsn(4 eerxo3ia1fmt livs s0truoiopnu1ol n nvt (fs2taxro;t0ope ioeiadlm elu s () rtnxf3oatoaDelu s;t) 2trirpiu4openlicsl(fa2rrxmo;t4tpeomoeias sDum(vp u)tltnxf tytfat lueo ( trxmimpnodllenlnci s)s2uax  nu0oet  fciat mDuanmpnt0 rxrio3iodfpD  ivi;s trtr(r3ou4ole  nei sf Dtax  ;u1apxoioctldfsDum( pnu0 lxrir ty1fm  aues;(  2tmimpiy4ameemnvi ( artmu oou1aexo ictlslmDeauvsn(4 lxrxrcoytomtr n ol( seum(mpoo4lpeelnctat)s2rmxmo;o0alenmo3ilsls2rln on() lxoxo iy1lmDelu olt sexmxopoo1amtnmncslt  2rru ooo0tetoifeiydlm uan o;t0 lerir3ty1lat livi t) eumir oo1opeemfcs s  rra(  ou4aetn ieiyt a2um(vsn(4arxrmf oo1fmt aieil( trtr(m3iu4olee ncsl( s2rax p;o4oexn ieiatls2emuvpnt4trerxo3oadfpDrlies;s) 2uo(m3ou1ameelnvsa() rumur ;t0texn fciltlaDum(vp u) exomo3io1fm   u ol(0 etmxm nodamen iciat sDur(  nt1tee miciltla2ra( o ()aetoxo oatlpDe neo;s0s2ur(o ou1ol nmneta(  ruau pou1apenmfciaslmDean p t0tltrir3tytom rau sl(0seuo(r3no1lm nlictat)a2rrxr nt4apxomicilsfs rmuvp (4teeoif3ty1lmteanesls trtrir oudlleemivils srurxr ;t4tlxnioctld m2um(msnu0aeeoio3ia1oateaieilt)s2to(r oydlltnmnvs t a2uaumpou4tptoif3iat m2emuvpnt0 exrio iydfpte nvo s)srum(o3oydap elivtl( aDraurpoo1alen fcilsfa uanmpnt) ltrxo tadfateli s;s seuriopnu4ap   neil()aDraur no1tlt miciad m2rmu p u4tetomr iytfat livols tetr(m oy1lm emietlt)sDtmx  ot1alxnifcildlsDrl( onu4alenxo3io1latrln i;t seur(mpno4opt  icilt a2taxmoou1aetomociyslaDuln o ()tleoxr3ty1omte neol(0s2umiopny1lm nmncias artrxmpnt1apx io3iysfs eauvonu) etrxocoadoa rlivs;t) rum(m3no4oltemnctat) rtruronu4olx  octas sDulumo u4arxoioctytfa  lneo (  2urio3iodamtnlncias  2raur ;u1alt micild m rau p u4tlxnif iadlatrlu il(0srtoxr3nydlmt lnct t  rtrxr ;o0aex  oetls a2umnvp t4alerxo3iytfmtrlnvs t)tetm(m ou4lpt lict sfarrrxmooo0apxnmoetatfs rau o u4arxriociytfpDe uei;t)setm(o iy1omtemfet t)aDrr(rpoo4oltn ociatfm2eanvsnt)tleoifcoodlatr nvolt)seuoxm nudop emfcilt arumxmont1tlxo ietyd m rl( o u0aleoir ia1opteluvo (  2uriopoo1lle lneiltfa2tmx ont0tpe miciys a rmuvsnt)altrmr3oy1fpt livo;t  eur(r iodop n ncs (  Dua(r oo4teeoifeiatfmDumnms;(0trtrmo3tydopteaiei;( sexm(rpno1opeelnviat sDrauro;t0oex mictas aDul(ms t4tlenioctydfa ranvs;s0setm(o3iu1omtemfct t)aDtru o;u4ope iictadfmDumumo;u4trtrxr iotomteau o ( srxmxrpnu1oleelfvt sfarraxro;t4tpenioeiadlm eauvs t0 lxrmociadoatrlies;(0tetrio3ny1lp nmnvi (f 2raumooo4tptn i3iasfm ul( p t0 etrmr oodlmt li ilt)t2xmim nudll nmncs s) Drmu  ;t4ale mf3tls m em(vs (4tlxrxf3oo1la ran olt0 rto(opiy4apt  netatf rrrxmoou1optnioeiadlmDeauvo;u4texoircootlmD  nes t0 etr(r ou4al e nvtasf 2tax ont1opxoioetldlm2rluvs (0trenir3todfa eaues (  2ur(r nydllee ivtat) 2taxmoou1optoioetltlaDrlu p u)aeeomo3ty1lateluvs;()sexrxopnodope lneil(  2rmxmooo1aee mf3tadls rm(vp u)tetnmrciadopDean i;(  exo(m iydlm  mnet (faruaxm no0apeo fciat s ul(vsn(4texnmo oadlaDeauei s texr(rpoydol elivs sf Draum nu1tpx mociyslm2raums;u)tetnxf3oodfp  ai o;s trtr(m3nu4op  mnei sfsrra( pnu1aexoiocias s emu pn(4tltoxfcoytfmtr u sls s2tm(r ou4apenmictas)aDrr( ont0alxomoeiysls raums;(4trxoif ia1opDeaies ()trto(m3nodol nlnvilt)a2trxr ;t0oltnif3tlt m umnmpn() eerxo tytlmDeauvsl(0 exoio3oydllen iei () 2rru pnu4tpt mi3ias m eauvsn(0tetoxf iytfpDr ivo;()texoxopoo1lltnmivtl( sDtm(rono0altoifctydfm2ea(ms;u) exrif iydoa eai ol( setm(o oo4lm  lnciasf rrr(m ou4tetomo3iadlmDelump;t4 rxomr3tydfp e ivs s)trtrir no1aptn fesl( srurump;u1apt  feildfa rmu sn(0 exrmr tatfmteau i;s trumir3iudapt mfeil( a2rrxro;u4aptoif3tadls el( s (0 etrirctydoptr ieo t  ruo(r3io4opt mfet sf Dtm(mont4apxnmfciasfa ra(mpnu4altoxo3tydoaDe uvo s teumxrpoy4ol elnvtas) rrm(  ou4oexoif3ils a2rln o;(0tlxrxf oo1fmD  nvo s teuoxr3oo1apee netl( srrmu  oo0oet  o3tlsfs2elnvp t)texrir3oytlmD  u s;s) 2xr(opoodom nmfei tfsDum( oot0aeen oeilt sDrl( p u)tlxnxr3oydfm rluvol( t2uoio iu4ome  ncs ()sDua( p;u4tle if3ildfmDrmu pn(4arenxr3iotlp eaivs ( srxmirpnudlpe  ivi s arraxmoou0altomieiltfm2raump;(0alxnifciydlptranvi (  2xoxopoydoltelfcslt aDumum ;o1optn oeilsfs2em( p t0 etrxf oatfm  lnvi;t) 2tm(mpny1ol elfcsl( sDrru o;u4opxn fciadfs2el(mo;u0 rtnio oadfmt  i sl()trurirpny4oleelnctl(  2ur(m ot1olt mfctaslsDrmuvonu0trxrioctadoaD lnei t  rxmiopnudamt mneils)aDumu ono1teto fctys m rm(vo u4aeenirciytfp  livolt  2xm(r3oydlptnmieiasfaDum(m ;u4apen feias sDran onu4 leoio3todoaDr ueo;t  euoim3iy1lmt  ncsasfa2raxrp;o1opxn f3tyd a rlu p t4trerxfciy1latean olt) exmxo3nydol  mfei tf Dumu o;t1oexn ocilt sDulnms;u)tleoir totfa  aneol()trtoim3oodame  nei s aDtm( pot4ole  oeildfaDuauvo (4arermr ootfaD  ivi s  ruoir nu1ol elfcs s) 2taum ;o4tpen iciat s um(vs;(4aeenxo to1fm eau il()s2umiopiu1lltnlnvsatfsruaurpno1olxn f3ils s2emuvs t4alenircta1fpDe u i;s) etoiopno1omeemieiat sDumu  ou0alx if3tatfa2ranvo () etrmrciodoptraivo;t0 euoxm no1opt livil(faDraumpnu1opxo octys s2elnmo t)tlxoxf iatfpDeluvo;t0tetmiopiudlmt lici (farra( ono0oet  feildfsDum(mo t) rtnmrctytomDran i;t)srxrxm3oy4lpt  iei () rrm(ro;t1tpeoii3iltlm rmn o;u) exoxf todom rlieol()trxmxr iu1lle lnetat sDtmx pnt4tet iieildlm2rmn pnu) rtoxr oadfp  anei;s0s2tmio oo1opeelietas  Drr( poo1tpxoif3ilslm2rmumsnu0 rtnif oytlmDr uei;( sexmirpio4aptemics s)aDtr(m ou1aex if3taslaDua( s (0trtnxf3totopD  nes;s  rtmxm nudamt  ivs (  Draxroou1alx ii3iyt m uanmo;t0altomf3ta1latraivi s) rumir iudlp  mivta() rua(mpot4alx miciys m rl( s;t4trtoir to1la r ivs t0 exmxopoy4amtelfvs s) 2rrx  ot4aee mi3tyd s2ra(mp (4arxrircoy1latrlu il()t2uoxrpio1apt mncsa( s2tau pou4aexo feiadlmDrmuvs;u0trtoir totfm   n i;t) eumxrpiydll n fvsat)sruaurpnu1tle io3iyd s raums;t0tltoxf3to1omtraivils  2umiopiu1lp  lfvsa(fsDuaxro;u0ole iieiadfs elnvsnu0texnmr3ia1fatr nvil(  etm(r3ny1omee fcslt a2umu poo0aleoioctat m2uanvs;() ltrmo3oodlmDrau sl()t2trim3iy4op e fvsl()s2tmur ;o0teeomo3tatfm rmnmpnu)artnif3oodoateaivi;(0tetmxm3nydll  lneta(f rtrxrpot1tpeo o3tlsls2rln pn(4teeoxr3oydfpD  nes;() exoxopiy1lp nlivtlsfa2umxr ;t0apeomfeiyslaDea( p;t)alxomf3oadlmte nesl(0t2xoxopiy1op  livtls  Drau  nu0oeen oeiydfaDeauvs;(4teenifciytoatranvs s) 2um(m3oy4ol e netls srum( p;o1aex ioeiat sDrmnms u) eerxo tatopt  u sl()texoxr oodlmtnlnctltf rtr( o;u0tee  oeiytlsDuanvsnu)arenif3oodlp  li i s0 2trxrpou4olte fctasfsDua(mo;u1opxnmiciytla rmuvpn(0 lenxrciytla  luei t) rurxmpny4lm nmncsa( arurxm ;o4opeoiieiyt m uanvp;t0tltrmo3iatoaDelieo (0trtmxr oydomt lfetas sruax  nt1apeoio3tydfs em(ms;(4 lenmr iytfptran ils)setoimpiudomtnlict tfaruru o;u0tpeoioeiytfs eln p;u)teeomocoo1fpte neils0srxmir3io4altelfeias)srumurpot0tlxnifetad a2em(vp t0 leniocoatoaDelnvs ()s2urxm iu4lm nlneilsf rtau ono1tptomfeiad aDean p;(0 etomo3tadfm e neil(0 2urxmpiy4lm  lfcilt)srtaumoou1aeen iciyd s emuvont4tleoio iotomt luvo s0 2urim oodamte fvil( a2ur(r ou4olxoiictyd aDemn onu4trermf3tytlptean s;()seurimpoydlmee ivs s srtr(rpou4oetnif3iatfa2ul( o;()trenmo oodopDeauei () rxrxo3ny1ll e nvs sfsrtr(mooo4olt  ictytfs2emums (4trtnmo tytopt  ivilt)s2uoiopiydol emnesltf 2tmxm ;t4open fciadfs ua(vs;u) rxnio iatfaD au s;s)s2tmxr io1al emnvtasfsrtaur no0ope  fciadls rm(vp;u4 exrif3tatop eaivo;(0srurxopnu1am nmnvt ( s2urum no1olt  oeias m eanvpn(0 reomf3oa1faD an ol() rxr(r ou1lmenlfvt (fsrrm(mooo1apt  o3iad sDea(msn(0aexnmrcta1omteanesls  exm(mpoydlleemics s aDuaxmpot1apxomoetlt s2um( ont)trxoxo oadla  auei (0teurxr nudlp nlnei t)a2umurpot4olt  i3tyslaDuauvs t0 rtoir3io1omDeai o;(0t2xr(opoy1lp n netatfsDtr(ront0tetn oeiadfmDua( s t4trtrmf3iotfmD  nvo ( trtrim ny1lm nlivils) 2rmum nt4aex moeiyslm rmu o;t0 lenir3ootop   nei;(0t2umimpou4am n ncsltf ruax  ou1aleoiiciaslm rmuvs;(0 eerif3iatfaDr ieo s trtmxopoo1ol   neias) Dum( p;o1tlxn oeiyt a2rmums ()artnmf3iy1lmtr ieo t)truo(r3no4lm eliciat)a2rmum nt0tlt iociyt a2umuvo;t4arxnif iatoa r nei s trurxm3ny1apte ici ( arum(rpno1opt ifciadlsDemu snu)tltrir3oodop e u i;t0 2ur(r ny1lmtn fcs tfsrrmx  ou0alxnioetlsfs2ea(mpnu)arxrxr3io1fpt aues s) rxo(opiu1lpe livt (fsrurx  ;u1opxnmfciasfa emump;(4artrmfciodfa eli s (0 exm(mpiy1lmt lfvt ( sDumu ono1tlt  feild m2el( p;t)alxrxfctydfptrlivs;s)teto(m3nu4amt lfeta( s2uau  ot1tlt mfeiatls um( s () etnmoctotoa   ues (0sexoxo nudame mivi ( a2rm(  ot0altomictasfmDrmu o t4arxomr ty1oa eaivo s)texoiopiodope miei s a2tru ono0oeeoiicilt m rl(msn(0tltoifcoo1lp rai sls  etoiopoy4om elfvsls sruru  nu0tptomociatfsDeln s;t)arxrir3to1lmD ln sls s2xo(rpny1oltn fes s)s2umxro;u0apen oeiysfmDrl(mont4artrxr3iodla ean i;() rtoxm3oo1om e nvia()sDrr(r nu4tet ioeiyt a2ua(mo;t0trtrifciodoa ranei;s)srxr(opny4lpenmfvilt aDrr(  nu1tlxnii3tadlaDua(mo;u4 rermocio1lmDe ies ( srxrimpoodlpte ivtltfaDrr(m oo1opxo i3iys a2ulnmp;(4trxomfciotoatr n sl(0trxoiopio4lpen nei ()arrrxrpno0opxo i3tat m2ranmsnt4 reoxrcto1om   i i;s0t2um(r oo4ol elfci ( arurumpot0apx  f3ilt aDrlnms;(0teenxr3ty1lmtrauvi;s)s2toirpiy4oltelfvsa(f Duaxmoot0apxoifeiytla2rau on(4trxnxociydoaDr nvi ( trxrimpoodom n feslt  Drm( oou0opx  ictatla2uln s;t)tetnir3iadomDrli o;t0t2um(r3oo1opee fct tfs2taumonu0tleo i3tatfa2rlu s (4tetrmfcto1lm raneo s t2trxm oy4amtnmiei t)a2uru  ot1teto i3tasfm2rmnmsnu0alxrxoctytlmDean o;s  rxrir oodamtemici (fa2tr(  ;t4aptomocilt s el(vs t)treoio to1fp rauvsls0t2xoxr oy4lmt liciasfs2tax ont0tpx mo3iadfaDul(vsnt4aetriociytoatr uei;t  eur(o3io4amenmivt tfaDum(r ou1alenifeiltfs eluvsn()treriociotlat  nvslt  exmxopoodlleelncil(faDurumono0aetnmo3ilsls rmnvo t)trxoio oatfm eauvs t0s2uo(m oy4am n ivsl(farra(  ot1tltnmf3iys mDra(mp u)aleoxf3oydlptr ueo ( tetrxm3oudlpen nvs (  rumx pnt4opx mfeiydfm2umnvon() eermrciytoptelieo;t0s2tmim oydlle lfcsa(  rur(r ;t4tex io3taslmDrauvon(4 eerxociydlmt luei ()s2xo(r oy4lp nlneil(  2rmxmonu0alxn fciltla ul( ont0artnif3to1lateau olt s2xo(r iu4ame  nci t s2raumono0teen feiltla elnms;(0trenir oy1fptrai s (  eumim nudam nmivsas)arrmx oou1tpenmfeiatfs2rlnmo;t)tetnmr oadfa   u sl( tetoir nudap  mnet t artr(m ;t1texomociys s2eau s (0 rtrmf iodlpDranei;s0 2trio3iu1amenlfvi sfsrrmxmpnu4aet ioctys m ran o u)artoxf todopte ivo ()s2xo(r oy1lm   fvia( aDuau ono4tee mf3tls a rmumsn(0 lenio3oa1fm  au ilt)seto(mpnydap emncia( sDrmumo;t0oexo f3iytfm eanvo;() ltnmr3tydlptelnvi t t2tmxr3oy4lme liesl(f Dumu pot1tlx  o3iaslm eanvp t4aexrmf3ty1faDe n i (0seuriopiydome mfcilt s2trurpnu1aetomi3iat m2elump u4 exrif3tytlmDran o ()truoxrpiy1ap   ncsa(fa2urum ;u0aetnmiciyslmDua(mo;t) lerxf todop eaieo (  rur(rpou1oltn ncslsfaDrruronu4tetnio3tlsfaDuluvp t4 rxnxf3tydlatr ieil(0t2xoir nodapt mnetlt arumxm ;o0tlt iocild m2em(mp t0 ltrif ta1latran ols t2to(m3ou4om  mfei tf 2tr(  oo4aeenmfeiltfa uauvs;(0teenioctodfp rlivolt)srtrxo3iudaltnlneias)sDtaxr nu1aeenii3ias mDrl(ms;(4artrif3io1fm r n o (0s2xm(o io4ale lfviat a2rrurpnt4olenifeild sDeln sn()tlxrmr iytfp eaneo (0srtrimpou4ape lnes (fs2rmxm ot1ope ioetad mDrln s;(0 exnif oadfp r u i;s s2toim iydamtemnct sfsDurxmoot4aptnmfciaslsDra( onu4aetrxf tadlp e n sls setm(m iudopenlncsas)srrmxmpno4tex  o3tysla2uln s t0 ltrir to1lateaieil()srxoim ny4ame  fciat a2taxro;u1opxoii3iatla2eln s;(4teenmo3totla eaieils)texmir3ny1op nlietas  Drmxro;o0ale ifcilt s eanmp;t4 etrmf3oo1fatelnvo t0 rxoxopny1ope mnci s srumumont4ole  fctadfaDea( on(4tetrmf iatom  an olt)setoiopou4llenlfcsa(fa2raxm oo4oee  f3tlsfs ul(vp;t) etnmfciy1fm e nvil(0truoirpou1lmtelnvi sfartaurooo0teeoioctydfm2emnvp;(4 ltrxo3iadoa r n i t teumxm3iodolt mfeslsf 2umxrpoo0tlen ieias mDranmp;u)alenmf tydfmDeluvslt  rto(rpny1lltn nvi t  Durum ou1texnii3iydls2ulnvp t)trermf3todfm r nvi;t)trxoxo nodal nmivil(fa2urxr ;o0teenmoctas mDulnvo;t0 etomo3ty1faD lues ( t2xo(o oo1altnlnvsas a2trx p;u0tpx iieiat s2ul(vs;u4alxnmr3oatfptr u o s)texoxr3iu4altn nvtls aDra(  oo0ape  ociat a ua(vp;t0 exrxocoodlmtrlivs (  2urxopou4apee fvsatfsDtruroot4tlt mi3iys a2rm(mont)artoxr3to1fpD luvo (0trtoir iydllenlfeta( sDrau  ot4tlt ii3iytlm rau s;u0treomr iytoaDrliei;s0trtm(m3nodomt  nvi () 2ururonu0tlx mfetad s2eanvsn(4aeenir oytoate neo;s0srxrxmpnydlpenlneia(fsDur(mpoo1tle io3tydfa2eaumpnu4 renmfcoodfpDelues s  2trirpiy4am n fesat  Dumxr nu1oee ioeilsfmDrmuvp;u0 lerircoo1opteanvs;t0srxm(r oudom   ivt ( sDrr(rp;o4tpxn ietytfm rm(vp t)alxnifcoa1fmt aivi;(  etoio iy4ol   ictlt) rurum ot1aptnio3ildfmDem(mo u4arxnmfctodlmt  ieo t0seumxo ny4lme  icilsfa2rmxm nu0altnii3iat s rln p;(0alermf3oo1optrlu o;s)s2umiopnodaltemnvtat a2ta(mo;t1aleo f3ild s2rmump ()teenxr iatomD lnvs s)teuo(rpiu1lpt  nci t)srraxm oo0olx  iciad s umuvo (4altoxf io1fmt lu il()trxm(o iydllen icsas artmxrp;u0tlen octldfaDulump t0arerioctotoa e ivs;(  etm(m io1am nmfctl( aDumu o;o0tlx iietasfmDran snt0 rxrmo3ootoat  nvo;()s2uoir iydopenmfvsa()a2trxmoot0oleoifctlt a rmuvonu4aeeomo3oydfa r ies;(0seto(r3nu4al nmics (  rtrxm ;t4olxoif3iadfsDumuvs;t4arermr3iydoptelnes s)t2tmirpoudlm e ieilt)sDrm(  no0oex iictydfsDrln onu4 ltnmf3tytfmt  nvo (  rtrxm no1optemfctls) 2rmu p;t4olxn ictld s uaumpnu)arenmr3totfatr nvi;s0sexoir io1apt lnvias arta(mo;t4oeeo ociydfs2ulu s (0aetoxrcoy1fat aueo;s0 2toio3ny1lm emfcias)artaxroou0tpt mi3tydfm2uau pn(0aexnircia1fm r nvil() rurxo3iodap elnvtlt a2ua( pou4tlt mo3ilt aDrln p u4 lxrir3iodomDrlneo;t sexo(mpoy4al e neta(  rua( oot4tpenmieildls2umuvp;t) rxnif iotlaDeanei s0 exmxm3oo4alt mnesls  2urxro;u0aee mfeild aDumuvo (4trtrmfciydfa e ues;s0t2to(mpiy4apeeliciat) rtaxm no1oex ioeiytfa2ua(mon() rxrio iydlat aueo;t0t2xr(r io4altemneiat  2umx p;u1tee ii3tydlaDrlu onu0tlxomf3oytfat  neo;s t2toxmpnydap e fcslt arumu  no1teeniieils a2ran pnt) ltoir tytlpDrauvi;t0t2xoio oudal  mictl(fa2tmx p;o1ope  o3iltlsDul(vpn()teerif iy1lp eai i;(0 etmxm ny4llee fvsltf 2ua( pot1tetnmictas mDrluvont0alxnio3ty1opteln olt)s2xrxo oy4lmenlnet tfsDurxmoou4opto o3ilsls el(vo;t0 etrio iotlp rlies;(0seurxopny4oltelfvi t sDtrxm ;t4teenmf3ildlm2rlu s;t4arxrmr tatomDr u ilt  2xmxr nudlp  lfeias  rtaxmo;t0apxn oeiytlaDuaumo u4 rxomfcio1fmteanvolt) rur(rpiu4ale lnes ( s2umu  nt4tpe moeiadlmDulnmon()alxrmr3iy1optelueil(0trur(opnydap elnvsls) rrmumont4tetniietadlmDul(mp t0tlenifcto1lat luvo () exrxr3io4optemncta(fsrrrxrpnt1tpeomi3tatla2raump t0 eeomfciytfmt auvs s0 rtrim3no4apte ncsl( sDuaxr ;o1teto ietlsfs uanvp (0 rxoiocoy1lmtr n i;s)srxm(m nodoptn ies t)a2tmx onu4oeeomf3tytla umnmo;u) ltoxocoydfp  au s s  2uoirpiudop emnvsasfsDrruro;u4tetomfeiydlsDem(vpnu0 eerxo3tatoaDrlnvi;(0 exoxr3ou4apt mict (farua(mooo4opt  ictatla2umuvo;t)aetnmf oodomDelueo (0trtrio3iy4ale mnvt (fa2um(rp;t4aetnmfcilt m umu onu0 renxf oodoa ranes t texrxmpno1omt mnei (fsrumxrooo1aeeo o3tadla ranms t) exomrctydlmD auvo t trum(m3ou1am elnvt tfarra(  nu4opxoif3iad sDem( o t4altomo oydfmteaieo s s2xoio3oudam  micilsfs2ur(r oo1alxn f3iasfm rlnmpnu4arerxr3io1fmDeanvi;()s2uoxmpou4am nlict tfarrrxmpoo4tetnioetls s2uluvonu0aetoxo3oatom  lneilt s2umiopiu4llenlfvilt)sDtr( oou0aeeomictldfaDem( o;t)aetoxo ty1fp ran i s  2toxm3oudap emivsas  rrmumpno1apt  o3iytfa elu onu0trerxr3oatfm rlueo;(0s2xrxr ny1ap e fetlsfarumum ou1aetnmi3tys s2emuvpnt) eeomr oa1fmtrln i;t0 2uoim iydlmen fei ()arururp;u4oee moetlslm el(vsnu) reoxocty1fmDeanes ()t2xoxo3oodlm   ncias) rta( p;t1oexo ietas m rln s ()alxrmr totlatranvi t) 2xo(o3oo1llt livil( arrrxm ;t1tpen fciys s uau o u0texoirciy1oa ranvo;s0trtmxr3no4lp  lies tfsDtr(mpnt4tet  fciydls2rl(vo;u)trxnmfctodfa r nvi;s0 rur(o3oo4lle mnes tfaDtmxr ;u4tle mociad a rm( pn(0 eeomf oo1op eanvol(0 eumxopny4ale  fci (f Drru  oo4ole  ieiatfsDemn s;u0teermocio1lp   iei s  2tmxr io4om n ies s) rtr(r nu1tlxnio3tld s rmu on(4tlxnxf3io1lp r ues () rurxopou4ap   fesltfs2um(r nu4oltnmoctlslmDum(mpnt4 etrmocootlptrau o;s)trur(mpnudoleelicils)sruax o;t0oleo i3tad a rlnvp u)texrif3tytfm  lnes t) rtmxm3nu1ale mfcta(fsDtm( oot0aeeoifctytfaDuaumon()areomo io1lp raieslt) rtrim nodopeelnvi tf rra( o;o4alx moeilslm el( s;t4 etoxf3tydop   ies s trxmiopiodap elnvia()srra(rp;t4aexoioeiyt m rlump;(0 lxrmr iotomteau o;t) 2umxrpnudllen fvtl(fsrur(m nt1ale iieiadla2rm(vp;u4aetoir3oodom r neols) rtrxm3nodapeelneta(fa2tau p;o4tptnifctltfm uln s;u)aexnmf3tydla r i o;(0 2xoio nu1lptelieias) Drrxr nt1tetniietat mDumu p;u4aetrmocty1la elieo;(0seuoio3nu4ll n fvsa( aDtr(mo;o1ale mf3iytls2ul( onu0teenifcio1fpte u o;s0t2ur(rpoodaltelfvia() 2tmxm oo1oltnmoetld mDrln onu0alxniocootfp   i s ()srtmxmpiu4ome lics s artru  no1tetnmfctlsfaDrmu s u) rxnmrcta1oatran s;t)teurxm3iy4om e ncil() Dtrum ;t1teeo ocild m2umnmsnu)tltoxfciodopte iesls)setr(opny1opt licsls s2ur(  ;u4tltniociltfsDumnvo;(0 exomfcoytoptraivs;t srxrxopoo1ome lnvt ( aDraumo;u1tpeo feiasfm ranmp;t0trtnir3oo1omtr uvi ( teuoim3nu4aptnmivsas)a2um(mono0alto o3ildlmDul(vo t0aexnxocootoaDrlnei;( trxoxrpiu4lltn feta(faDtm( ooo4tee iociasla eanmp t0 exoxf3totopDelivi;s texmxm oydlmtemncilt a2tm(mpnt4oetoifcilslm eau o (4arxrxr3iydoat an s t sruoxopno1ll   icsl(fsDraurpno0oexnmo3tadlm ea(mo;t0 ltnmfcty1fateli i;(0setoimpou4ameemivias)srtaxr nu4tpenifctytfa2ulu s ()trxrircoy1lm   uvil(0setrio oodlleemivsls  Dtr(mpot1aexo fctydfa emums t4tetnxo3oy1oat ai o s)trtmxmpoodomee fei (faDtr(mp;o1olxomfeiltlm elumpnu4 eenif oatlateaivil(  eum(rpny1amtemfcilsf Duax pou4aetomfeiad sDrau sn()trxnxr oatlmDr ues;s seuo(mpiu1lmee fcs ()sDum(moou1aexo oeiyd sDumnms;u4 rxoirciy1oa  aivi t s2xo(m oydlle lfct t)aruaurooo0opxnif3iytfs umu o;(0aetnmf3iatopteluei;()texo(m oy1ale  fetls) rtax pnu0texoiieild m2uaumonu0aexoxocio1opteanvo;t teuo(opio4op  mfesl()arta(  ot0apenmfcils m rauvsnu0alenxr3oatla e ivi s) exrxo iu1ll nmnctltf rumxrpot0apt mf3ildfmDuluvo t)aleoifcia1oa r i s;s  2xmiopnu4omenmicils  rur(ro;t4oexniictlsfs2elu snu0 rtrmocoy1la  lnvo ()t2tm(r3oudame mnvtlt)srrrx o;u1apen ieiasla2rm(mo t4 etoio3tatlaDeaivi t) rxoxrpiu1lme mivt t a2tmxro;t0tlx miciyd a rmnmp;(0 rxoirciy1fpDe nvsl()trur(opiu4am  mnct t  2urx  no1olenmoetltlaDranmsn(0aetnmf3tadlp rlnvs;s srtmim iudlpeemfeta( s2rr( p;o0alx miciatfm ea(msnt4 lerir iytfatrai i s srumxrpoudlpee fcil() 2taxm ;u1oltn ociydla rmumsnt4tltrir3oydfmD lneils teto(r3oodomt mfci (  Drr(mooo0optn icilsfsDeanmo;()aexnio oa1omDraivi s  euoiopny4alee iet s s2urumo;o1olx mfeias s2ea(ms;(0 rtrircoodfpDelu o ( srxmxmpio1om  lnetlsf 2rmx  no0oeto i3iysla2emumo ()aeeomf iodoate n s ( trur(opoo4olt lfetls) Dum(ro;u0apt mieiatfa el(vs;u)aexnxo iytfp rauvol(  exo(o3nu1llt lict () Dua(r ot1teeomo3tydlm2um(mo u0alxrmo todfm raieolt)t2xoxr ny4opt lfcta(f Dtru oou4altnifctltlsDrm( on(4teeoxoctytoatrli ilt0texrxo oy4optelies tfsDrmumooo1aptomi3iysfaDrmnmo t4alermf ta1omtranei;s0teumxrpnudoptn nvta(  rur( onu0oleomo3iysls2emn onu0 ltoxo3ia1oa r uvslt)srtrir3io4opte iet sfa2rm( ono1aetnmoctys m eauvont0 eermr3oy1om  ai i s s2uoxrpiydlpt lfvtltf rum(ro;t0tetoioeiasfa2umu o;u4texoif oydopD  ueslt  exmir iu1omtnmnci sf rurxmono1ole  fetatfsDuau s (4aetoio iatfptr nesl() rto(m3iy4lpenlfetat) 2tau  ;t0tlen ietydlm2rmn p;()aeerioctydfm rauei;s) 2toirpnu1ameemfes () Drrxrp;t4opeoii3iys m2el(vp;t0 etnmr3to1lmDrlivslt) rxrim3ny4al nmncs sfsrtaxm oo4olt io3iatla2rlumo t4 reoxrciotlptr ies t texrio iydoptnlnvt s) Dtax onu1aptomf3iysls2uanvo;(0artrxrcoadomteauvsl(0texr(rpno4amt mfctas s2rmu  ou0oleo f3iltfmDemn ont)tltnmr oytlpDr nvo;(  rurio iu4op nlnetlt aruau pno4oltnif3iad mDelump t0tltnmfciy1fmtrai i;t0 rxoir iy1lm   ietasfa2tm( pou1alxnifeiatfm rlu o;t0tetrmr3tatlmt aies () rum(o3ny4apeelfvtltfsruaumpoo1tetniociysla2emumonu)aetrif iadfp   u olt  2xmim3ou4lltemiesa() 2raumo;t1oexn iciysls rmn ont0tetnmo iotfmDe iei t s2xrxr nodaltemfei (fs2taxrp;u0tptnioeiyt a2eln o;u) rermf3oatfptrln s s) 2xoxopiu4apt mnesa(f rrmum ou4aeeoiiciadfa2rln on(4 lxrmocty1opD  uei t0trxoir3nu1op emivt s  Drau poo0opeoii3iad s2raumo;u)tlxomo ty1lpDr nvi ( sexoir oodlltelfct tfa2uax pot0tex  ociyt aDra(vp;(0artomf ootlmDraueo s)srxrxr3iy4lpe mncil()arta(ro;t1apxomoetysfsDrluvo;(0trtrioctydfp  an s;s)setrxopnodamt lnet s srrr(roou4aexnmfetadfm emu o;() rtoxo3todlpDrln o;t) eumim3ny4lle lnvs ()arurxm nu0tlx  feiys a2umn snt0aeeniocoy1lmtelnvi;()texoxr3io1al  lfcsat)aDra(monu4tpxn o3ildls rm(mo;(4teenif oa1fp   uvs;t0 etoxm oo1ap  lnvi (  2rax  oo0opto f3tytfm uln pnu)tlenirctadlaD aneilt0s2toim nu4omtn iei t  2rau p;u4aetn o3iysla2elnvp;()alerxfcia1oaD au s ( srurim3oudope mivsls a2ra(mpoo4tltoiociytlaDrlnms;u) lenmr3oodlaDrlivsls  rurxr iu1opt micta() Dra(ro;o1apxomfciat a2umu pnu4 rxrmr3tydlate ieo t)t2tm(o3oo4lmeemnctls) rtax oou1apen fciadfm2em(ms;t) ltnir tatlmDrai s t tetmir3iu1amt  nvsls arraumont1oeeomieiasfa eluvon(4 eermfciydlpD aieslt seur(rpnu4aptn nvsat srtmxm no4tee  oeiyt mDrln o t4 etrif3iotopDean o t)t2trxm iy1lpt lneia(farumxr ot4ope  f3tatfa umnmo;u4alxoxo oodlmDr neil(0s2umxr iu4optn fvil()aDrr(mono1apt mo3ilsfmDulumon(4 rtnxrciadlaDrli ols  etmimpny4alen fctlt) Drmx pnt1alto oeiys aDemnmp;u0trtoxr3ta1lpD  uvs;t s2xrim3ou1llt mnes ( arum( oot0olt mf3iadlmDrl(mont)aexoir io1lm rln o;s0t2tmimpou1omt  ietas srrmx  nt0tpenmoeiydfaDran s;u4alenxfcoodlp eaivi ()srtmio iy4am nmivsls)sDuaxrpoo1oetomi3tyd a2emuvs ()alenxf iytoa e ivils)srtm(r oy4ape mivtas aDurur nt4olxo iciytfaDumnmsn()tlxomr tydlmDran o;()s2xmim nu1ome lncs (  2ra( p;o1tlenmietlsfm ul( p;u0aetomo oo1lmtr ueo;()texr(r io1omtn nvi s  rra(  nt1apt ii3iyslaDraump u0tltomo tytfp rlueol(  ruoirpou1omeelfct s  ruaump;o4teenmociydfs2ulu o t)aeermf3iy1lpD  uvs ( srto(mpiu1lptemfcilsf rtax poo1oetnioetldls elumo;t)aeeoxf tatlm r ueo;s0seum(m3no1omtelfcs sfaDurx onu0aet mfeiytla2uluvo (0teerxf oadlmt ln s;s)s2umxm iodll  liet tfartr(rpnt4oeto iciadlmDrl(vs (0aeeomoctydom eaieols0t2xrimpoodam e icta() Dtaxrpno0altnmoeiadlsDemu snu4altnio oytfatrlieil( srxrxo iy1ol nlictl(farum(moou4oexo f3tytfmDrln s (0 rerxrcto1lmD aivs ()teum(opoo4lmt  ncil() Dur(rpnt4tlt moeiatla2elump;t) lenxf tadlmDr i s;t) 2to(rpiodllt  nesat sDrau  ;o1tpxoifetlsfm el(vsnt)arxrxrcoodfmteanvolt t2trir ou4lptemivt () Duaxmo;o0opxniieiadlm ul(vsn(4 rermo iytlaDrlueols s2urxm iu1lpeelfcsa() ruaumont4tle  o3ils s eluvp ()aexrxo3oydom r i o s0trumim oo4altemfctls sDurx oou4apeo ociaslmDeauvp () rtoxr3ootopte uesls0s2um(o io4am nmicsatfsrtrxm ;o0ale  i3tatfm2ua( pnt0teeoio3iytfm eaieol() euo(opio1lmenlfctltfa2rru p;u4olxomoctlt a um(mo () eerxo oatoaDe i o;s  eur(o3ny4omee ivt () 2tmumonu0opto fcildfs2rl( pnt)aeerxo3ta1fa r n ilt  exmir3iu1ol  mneilt)sDrmxm ;u4oexnif3tld m2em(vpnt0teerirctytfat anei;()s2xrio3iy1lp e fet () 2taxr no1tee mfeiltfs2el(msn(4trxnioctadfmteluvs t)trxrirpoydlleemfvils)a2tau  nt1opt  ociaslm2emn ont) eenxr3tadfpDr neil( setoimpiudopen fcia(fsDrmu  nt1tlxo f3iydlmDumn o;t4altrxr oodopDe u slt) 2trxr3iydlpe mivi ()s2ur(roou4opxo fciat m rmu o;()artoircoatfatean s;(0 exr(m no1ameelnvsas  rtmx p;t4tpxoii3iys mDrluvp u) eeoiociadfaDeai o s0sexr(r3no4opeemicilt)srrr( pnu0tpeo fcilsfm umnvo t4 exrxrctydlmDr uvo s  ruoio ou1openlfct sfs2tmu o;t4oeenmoetlsla ra(mo t0tlenxocoytfaDr nvil(0trxoiopiy1ol n fvs (fsDtrx  nu4tpx ifciydfm eaumsn(0altnir3oa1op  auvo;s  rxo(rpio1lmeemncil( a2ta(m nu1tptn f3iatfa2em( o;u4trxnmo oatfpD luvols t2xmio3ny4altnliesltf Drr(mo;t1tee mi3ilsfa2em(vp;(4trxnxrcio1laDr ivo;() rxriopoo4apee netas) rumumpou1teto o3ild m ean sn()trxomo tytopteaies (0s2ur(m nu4lpeelictas sDtm(rpot0tpxnii3iad sDul( p u)alxrxf3tydom   n ols) rum(o iy1llen ictlt)srra(rp;u1aexoioctadlaDrl( snt)aetnif oodlm eaies;s teto(rpnudolee fvil( s2rmxmont0tpt  o3tyslm2em(vs u0tetrmf oydfa rluvil(0t2xoxm3nudal   fci tfsruaxm nt4tpeo oetadlmDumuvo u4 rermrciytom raneilt)t2xmio3ny1ap  mnvt (  Dtmumoou0apen i3iydfsDul(vs;t4trtnmo3oo1lmDrlneils)s2ur(o nu4am nlfet sf Dtaxr nt4tlenmfeiys m2eln pnt4 rtnmoctodlaDelivs;t  2xoim io1amee fctlt)aDrrxm ;o1oleomietadls rluvs;(4arermo3io1lmDrlneol(0setrirpnudomeelnvtlt)arrmuro;t4apxo fctatlmDrl( o;t4artoir3tatfat auvsl(0 rtr(m3nudlmee ncias)s2rmxronu1oltn oeildfs emnmo u4trtomf3oa1lmte u i t srumxo iudame livils srrr(mp;t1apt  octasfa2rlumpn(4texrxrcia1omtelies;s)tetriopoo4alen ivtlsf 2um(mpno0oleoiocilt mDrluvp t0 leniociytfmtr uvs t) etoio no1op  mnvi ( arrr(mpno1tpeo ieiat s emu p t) renmrctodlpt an i;t srtriopoy4amenlicsat a2rrur ;u0ape mfeiydfs emuvs u0texnmocty1fmDranvol(  exmir3ou1apt mivi (f 2rr(rpot0olxnmieiad s2emu pnt0areoir oydoa eanvo;( sexoiopiy1op n ieilsfa2ra(mpnt1tpeo oeiatls2uln p t4arenxf iydomDeauvi;t0tetrxmpiudapt livs s  rumumpnu1apenii3iytfs2elu on(0aetnmfcoo1lmtrlneo;s)s2tmio3oodlpeelfcias  2tax  oo4oleo ieiltlm2rmnvo t4 etomr3ootlpDraivi;()t2um(opny4lpeemicta(f Dua( ont0optnio3tytfs rm( p;t) exrir3oydfm elu s;t)trum(r3oydlp n nvsa(fa2umumpou1oeeoif3iatfs2um( pnt4arxoir3to1omD ai slt)sexr(m iu1olt  ies t)aDumuront1opx moeiadls2uauvo (0 rxomf ta1fmtrluvs ()s2xmxopiudomte ivtl( arta(mp;t0aex mietydfmDulnvs;t0arxrir tadopD aiei;t teurxm3iu4ope mietlsf Dtax o;u4texnmietasfm2rm(vsn(4alxnio3to1fmtranvslt seur(rpio1apenmncta(  Draur nt0tpeo o3tasla2em(msn(0 rxnmr3todop elueo;( teuoim3nu4lpenlicias)aDrrx poo0olen ieildla2em(vs;u0texoxfcto1lp   i s t) rtrio iodlmt lncsltf 2uauroot0tetniocildfm umu snu0teeoxrctytlptr neols texo(o3ou4altelivsl(  Drrx poo4tet iieiltlm2em( s;u4tetoxf3tatlpDelnvs t0 rur(r iudopte icsas)srtmur ;u0teeoio3ilt m el(ms () etoir iy1fmD  iesls0s2tmxrpoo1am emfeiatfs2rru  ;u4alt if3iat m em(vsnu) etrxfciatlmD  nvo ()srumxm3nu1opeelnviltf Dra( pou0aleomfctlsfs2emn s u4 rxrmfctodom e ieo s0tetmxmpou1ole lfvslt artax  nu1oleo o3iat m2rmu pnt0 rtnifctotlaD  i sls0teuoxo3nu4om  lictl(farrmur ;u1altn octydlmDul(vpn(4artoxrctotfate u i;s0tetmxm3oudope  nes s  Drmxm no4tet iocildla2ra( o u)tltnmo iodlaD lnvo;t)trxmxm oydaltnmiet ( a2rau pou0ale  feiadfa2umuvo;(4alenmr3iadfatelieo;t)srxm(rpio1olt livt s) Dtmumo;u4alxo fciadfaDrlu o;(0 eenmf3io1lpDeluei;t)srtoxo iydam n fctls s2tr(mpot1tpenmo3ilt m2ua(vo t4 ltnirctadom r n s ( teto(o iudlleeliesasf Drmxm ;t0alt  oeiyt a2uanvont) ltnio ta1omtran o;t)texmxmpiodopenlietatfs2raxrp;u0apxnmieilt m2eln o u0 etoxo tatfmt  ivsl()trurxo ny1olenlivta()aDuaumpou0apenif3tysla ea(mon(4treriocoatlaDrln olt) etm(opou1olt mnct tfs2taxmp;o1opt io3iyd s umnms u0tlerxr3tatfa r u s;(  eurir oodal  lfet (  2rrx  ;u4alxn fciadlm2ul(vs ()aexrmo oadfp  aivo t0t2xoio3nodaleemnvsat)sDum(  ;t0apt ii3iltfaDumu pn(4altnir ta1fa raueo;s0 rxmxmpoo1lmt lfetat sDur(  oo0aeenmfeiysfsDrmnvp u4 etoxr3oatla e iei s0srto(o iu1al  mncils  Duau  ;o1oetoio3ilsls2rm( p;u0 eeoxo3iydfm elnvsl(0 rxm(o3iu4lmt mnvs t) rrmu pot0tlt mocilslm em(ms t)teerxo oydopDe nei;t)t2um(mpnydll elfesat) rumu  ;t4oexo iciyd m2rm(mp t)teerio ty1la r ieo ( t2urir io4openmfeils sruau  nu4ale  oeiysfmDemnmpn()tlxrxfciytfpte i slt)t2xr(opiy4apen nvt tfaDtr(mono1optnmfeiysla2eanvpnt4tetoxr iydfat ai sl( tetr(rpnu1lpeemnesa()aruaxmp;o0aex  fetydlsDemnmp;u4trtnmr iydoa e neo;s)truoirpnydoptn icsa()artaum ;t0oleoii3iyt a2umnvon(0trerxf oatfpte ueo;s) 2trimpio4amtn fci (fa2ur( ooo0tltniietas s2em(vo;()artnxo3iatfptraues (0srxoxr nudole  nvs (  Dtm(mpnt4texnioeilsfa2ul(vs;(0teerifcootfpDrauvsls)t2tmxr iydomtemivs ( sDtmumpou4aetnifeias m2emn ont0 ltoif3iodfpDe u il(0 2uo(m3nodoptnlivs ()s2urxmoot0tpx mietlsfm em(ms t4 leoifcto1fate i o;s seurxm3iudole mfci ( aDrru pou0apt iictadfm rl(vont4 lxnmr3oatlptr i sl( trxo(m3oudlmeemfei s)a2ra( ooo1tlenmoeiysla ranvp t0 lxomf3iodfp e ivo t)s2ur(o3nodoltnlncsl()a2ua(  oo0oeenioctytla elnvpn(0trxrirctatfmDeli o s setoir no4om nlnesls)s2ta(rpnt0teenmociad a2ulu p;u)treomf3oatfptr n o (0srumxr oydol  mfcsltfsDrmxmooo1tpen i3tldfaDra(vonu0 exoxr3oatlp  lueol() 2to(m iy1om e fvs t sDuau  nt0alxnio3iltls ra( o t0 lxrxfcta1lpD  u sls0t2xoirpiu1ame  nctltfa2umump;o4optoiieiat a2el(ms (4trtrio3oydlpDr u o;(  exoimpiudolee fetat) rtmxmooo4altnif3iaslaDeauvs t)aetomr oydfpD lu s ( texm(mpnodam  lfvs t) Dur( poo4aptomo3iasla ra( pn(4trtrirctytlaD ln ols)s2to(r nydopt  nvs sfsDtrx p;t0tpenmi3ilslm2rmnmon(4 ltoif3iytfp eauvi s)trxoxrpoy4llenlfcsat)sDuau pot1oetn f3iysfs rluvp;t0texrmr tydlm r uvsls  2xr(m3ou1lp  mfvta() rraxm nt1teenif3ils a2eanmon()altomo oo1fpDelnvslt teum(r3nu1ll n fvsat) rrrumpnt1aptniocias m2el( o (0tltnxf tydoat aivols0 2tmir3oy4op  lfvtl() 2tm(r ;u0altniictad m um(mpn(4alxnifcio1omD luvi;s trtoir ou4omt lfcs t a2umumpoo4ole moeildfmDemn s u) exoifciotop eaies;(0 2ur(o oudamt lnei tf ruaxronu4opx mfcilt s umn ont) eeomocty1lmDeluei;t0trumxm3iy1omtnlfes sfarur(r ;u1oexoio3iydfa umuvont4arxrxoctydoat  ivs ()t2trim ny1llen ivil(  rraur no4olen ictysls2rmnmon(4 eenmo3io1lp  lneslt  2urim oy1ll nliesl(fs2uaxrp;t4tpxnmi3tatla2eau p;(4texoxrciotom eaiei;s truoim iu4lpe lfvs (fa2tmuro;o4teen i3tysla2eau p (0teenmr oytfmt lueo t0teumxmpnodoltnmfet (fsrum(roou4opxn oeiys s ul(vp ()aetomr ia1fpte u sl(0 2tmir iodlmtelivtl(f Drr( o;u1oetomfctadfm2rlump t0 etomr3iytop  lnvolt  2toxopiodaptn ivi s)a2rmxroou4oexnmieiltlm2rln o ()aexoxf oo1lmDe n i (0trtmxr nudale  iesatfaDumx pot0tleniiciyslaDumnmsnt0 exoxf oodlm raivils seurirpiydap elivilsfaDtmur nt1olt ioctldfsDumn snu4 rxomrcoytfaDe nvs s0 rum(o nu1ap n ncs (  Dururp;t4apenmf3iaslmDuanvo;()trerir iatomtrluvo;( texr(m nu1lp nlfvtas)a2ur(m oo1tpxnmo3iysla eanmsn()trenmrcty1lmD livsls) etoio iudam  lict () 2rax poo1alto iciytfmDeln p (4teenmfctydoa  ln s (0 rumim ou4oleemfesl()artaxmpnt1tle  f3tadls rmu s ()tetoio oodfmte n o;( sruoxo oo1apt mnvtas) rrrumono0alto iciytfs2uauvo;t4trxoir3iytom ranvi;t t2ur(mpio4llenlnctat)sDrmx  nt4opto oeiadlm2elump;()arxoxo oytoatrlieo;s  etmir3no4amenlfcils arrm(  nu4aeenmociadlsDemums;(4trtnmr tytom   u o s0teuoxmpou4ol n ivt sfarta(  ou0texo oetat s2umu o u) eeoir3iy1opDranvo;t)s2xmxr3oudllt lictat sDum(m ;u0openmocias s2ra( sn() renmf3iy1lp  anvils  2umio3io1alt mnctasf 2trumpno4tpx mo3tas m ulnmo;(4altoxociotfp r neo;s t2trir no1ome lies t)aDumx p;u0altomi3tasla el(vp;t4trxrmf io1lpt lu o (0teto(r iodapt lfeilt  rtr(rpnu4tlenmieiytlaDul( p (0tltomo3iadomtran o t trum(m oy4lmtemfviat) Dtm(r no4opxo fctltfm2rmnmsn(4 eenmrcoodoat  i i t trxrxo nydam n ivta(  rrru pnt0oeenmo3iat aDelu o t) renmo iy1fpDr nei;t  2tmxo3nudom nlneslsfsrtmxrpnt4tlx ifctadla eluvp;(0 reoxfcto1lp eaivo t0srum(mpoudlp   ncilsf Dtmu pnu4oltnmo3iltfmDrlnvo;() ltnir iotlpDeluvs;s)teumim3oo4oltemnvtl(fsDrmu  nt4aptnmociadlmDrauvo;t0aetoxf3iatfmDraiei ( sexm(r3nodlmte fctlt)sDua(m ;o1olt  o3iatlmDuauvp;t0tetnmf iatlaD li o;s0 2xrxr nu4olt  ivt (f rrr(mp;t1aetn f3iytlm2el(vp ()arxnio3iotlaD an o;(0srumxo3oo4amte fct s)aruaxmont0altniieildfm2ulumo u)altriocty1oa eli o s  2ur(m3nydalen nctl()sDtrum ;t0texnmi3tltla um(vp;t4artrxo3iy1lmtrln i s0trxo(m3oy4op   nesls)aDrm(m ;t1teenifcilsfa2rau s;u4trerifctotlpt lnvo t) exr(o3nudlpen fvias sDur(root4tle moeiadfaDrau on(4tetrmrcoodfmDraues;() ruoim3ny4lltemnes s sDtmxm no1aleomiciltls rm(vpnt)texnxf totfmDe u i;s)tetoxr3nodll e nct sf Dur(ro;o1opxnio3ias a2eaump t4trxnircty1faDr iei ()srxmxrpoydlltnlnvtas)sDrmxr no1optnifeiat a2emn s u0 etoifcio1lp  lu s t t2tmirpny4lleelfeta(f 2rrxrpnt1optnifeiys aDuauvs;u)arxoifctatfateluesls) rxoirpoy4alt mivtls) Drru p;t1alxn oetadfm ean s;u0trxoir3oa1fpD  i sl() exmim iy4am e iei t) Drmx  ;o0openii3iatlm2ulnmp u4 exrxo3io1lmt  ueo;( sexm(r iudlptn neta(f 2taxmp;u4opxoioetlsfaDumnvsnt) etrircty1fateliei () etoir3nudapenliei (fs2raxm nt0optnioeiad aDemnmsnu0trxrmrcta1fm rliesls  exrxrpno1oltnmfvil() 2tmumo;u4optnmfetatls2um(mon() lerio tytomD lieilt)sexo(rpio1amenlics t)srtmumono4opxnmociyslmDrln snu) rxrirctotfptrluvo (0 2xmxr3no4amtemnvt s sDrmum ;o0opx ioeiydfm emuvo t4 rxoifciy1fpDeaivo ( trto(rpiu1omtnlicslsf rtau oou0aleo i3tlsla2elumo;(4trerifcoodfatelnvi t) 2toirpiudap nlici sfa2rmurp;o4aptnif3tlsfa2ulnmp;() ltrmfctadomD  n s;t) rtoio iydole  fctasfsDum(m nt1tpeoifeiasfaDulnvs t0 rxnxr iydop  li o;s)sexm(m nu4om  lnet s)srrmu  nt1ale  o3ils s rluvs;t0alxoxrcoatlmDrlu i;s)s2xrxm ny4apt  ivt s a2rr(m oo0aexniiciadfs ulnmo;(0trtnif oatlm rluvo s)s2xoiopoy4lmee ivi (fsDtmu  nt0apxn fctytla2um(mp;u)altnmr3ootfm  auvs (0seum(r3nydap nmfcil( aDurum nt4aexnifciyslm eanvonu) lermr3iy1fmt aivo;( texmiopnydole livslt)aDua(mp;t1tpenmocias mDulnvs;t0artoif iadfaD  nvo;(0teumim io1al e nvs s)sDururpoo1tptnifeiyslmDum(vp t0 lxrmrcoa1lpDeaivi s  euo(r3nudlptemfet ( srtmxr oo0alt mieiysfsDra( p;u0aexnmr3tadfmD  nvi;(0t2to(o nodomte fvtlsf 2ua(r oo1apt mfetlt m2rmnmo u4 exnxf3ia1faD aneo;t) eumxm ny4op emfvsa(fa2rr(  ot4opeo octlsfmDuauvs (0trxnmf iytlm r ueo;(  eum(m3iy4aleemicslsfaDuaur ot1tpen ictls sDuln snt)alxomr3oadfm  luvo s) 2to(m ou4opeemnvslsf Drr(rp;u1aetoif3iytfm ulu snu0 rxrxo3iydop r uvi (0 etmxrpnu1om  livsatfs2rrump;t4oet  ieildfm rmn sn()aexrxocia1oaDe neol( s2trxrpiodlme  netl() 2trurpoo1tpx mf3tadfmDeau pn(0 etnir3oatomt lnvs;(0 2xrim iodlpen neta()sDur(r ;u4tlxo oetat sDumu pnu)trxrxo3tytfmt lieilt  rur(r nudap elfvt s)a2umurpno1teto fciyd mDeln o;t)trxoirctydoa r iei s)trxrim3ou4om  lfvs t arrm(root0oeeoioctaslaDrm(mpn(0treriocio1fmteauvi t)s2xr(o oydol elnesls) Draur ot4aeen oeiasfm rm( s () rxnxf oodlmDe n o;(  rto(rpiy1ame  ivilt)sDua(m ;u1tet  i3ias a eau o;u)artrifcoodlatr u ils0 2trxr oy1ll nmnctas arurxmonu0alxnmocilsfa2ranvpn()tlxnmo iodlp  aueil( s2xo(m3oodlp nlictls arumum ou1tpeo i3iad a ean s t0areoifctotom rlneols  rumiopoydlmtemieiltf 2rmuro;t0ale ifciytlm2rmuvon()aetnxo3todlmt aieo t0t2trim iydol nlies tfsDrrumpot0ope iociadlaDulums;u0arerxo3iodfmD  u ols0srtm(r iodopeelfvt s a2ta(mpoo4ope  ictysls2rm(vo;t)tlenxo3tatom e iei;() rtr(m iudaltn ieslt  rrmxr no1tlto f3iydfs rl(vsnu0alxrxf ootlpDr i sls sexoio oo1ale mncslt)aDtmxr ;u1alx io3ilsfs elu s t0 reoxr tytoaDelivi;( trxrio oydlpt  iei s)srumxrpnu0tlx  f3tyslm um(ms;t4artrif totlmD  ivi;s setrim3iy1om n nei (farraurp;o0openif3tat mDem(von(0tleoxr3iytlpDe iei;t  2xmir ou4apee fvtat)srururp;o0aleo o3iytfaDrmuvo;()treoxrctytlaD aivi;s) rtoir oodllee netat a2trxmoot1aleoiiciysfm rm( sn(4 lenxo3oodlaD auesl(0 etoxr3oudop  lfeta(  2rm(mpnu0alenmictad aDul(ms t4 renir ta1opDr ues;t) rumim3io1al e feta()arrmu o;u4tltomoeiysla rlnvsnt)tlxomfcoytlpDrlu o ()srto(m3ny4ome lfvtat  Dtm(mpno0olxnioctysfaDelnvo u0 eerir ta1faDrauvs s)seumiopnydam nmiesls) Dum(m ou1olt if3iyt s2ea( p (0 etomociytfmtr ieo (0srur(r io4omte ici sfsDtru pou1opxn fciatlaDrl( o (0 lxriocoa1fmD anes s t2tm(o3oy1omenmfes s)sDurxr ot0tpx mictys a2rl(vo (4tltnmfciydom r u s (0 2xoimpoo1apenmivias)s2tr(r ;u1olx  icildfs2um( p;(0altnmr3iotlptraiei;()srto(rpnudolte nvt tfsDumx p;o0texoifcild s2rmnms;t)trerxo iodlm  lu o;(0srxrimpoydoltn nct s) rtaumpoo1ope mo3tyt a um(mont)tleoxr oydoaDean o s)trtoirpny4ol   nvt s artau onu4olenio3iydfs uauvsn() exoxrcto1fpDeluvs t)trtm(m oo4olte nctltfsDtmum ou1opxnio3iydla2emuvo;t4tltnmr iydfat li olt)s2xrirpiy1amtn ncslsfa2tm(  oo1alx iociyd sDea( o;u4 lxnir oydopt aivol()texrim3iy1op   fcs t  Dumxmpnt0tlenmoctatfs2eau p (0 ltomo tadom   u s;()srumir3oudap  micsa() 2tau  ot1tpxoio3tlslm rluvo t) rxrir tytlm eanei ()s2tr(r ny4lm e ivsls  2tmxront0tleo o3ildls uanmont0aeeriociotfatrauvi s)s2toimpiu1ope  nvtls)aDuau  no1olt mfeiyd aDrl( s;(4aetrxr tydomt an s ( srurio3oy1lmt mncslsfa2umxr nt4alx mictld a ua(ms u)tetrxociytlaDr ieils)srumxr ou4am e nvia()artrx oot0oltoiieiys mDum(monu4 ltrxrcoytla r ivi ()sexoio3iy4amt lnesas) 2rmxm ot1tlenifetytfaDemnvon(0tltrxrcio1op r neo;t0trxr(rpio1lleelfetatf 2tm(ront0tpeo fciyt sDulnms;t4 lxnxo todop  an sl() 2uoxr3iy1apt  ivt (  2rmxr no4opeo o3iyt s uanvpnt4arxrmo totlpt ln i ( s2uoimpiodlmte fei ( sDra( ont4alxomoeiltlsDuauvs (0 lxomrctydfm e u s t0trumxr3oo4omee nesls)arurx o;u0tpeoiicild s2elu onu) ltnxrcoatop r uvi;s  etoiopnodomenmfei tf rrrx o;t1alx miciyt mDra(mo;(4alerxr iodfp eai sl()srurimpoydolenlictls  2tmurpot0oleoifctltfm elnvp u4trtrmo tadoa ean ilt)t2xoir nydomenmnviasf rrr( ooo4opt mfciyslm2em( s;t4 lenxfcoydoatranei t0srto(mpoudllt lieia( arurx o;u0alx mietldls emu p;u) eeoio iodfptelues (  2xrio oydoptemfvsatfsrraumooo0olxnifciyt mDemn pnu)trxoif3oa1fp e u i s0texm(rpoy1ol e nes s srrmx  ou0open i3tld mDra(vp u)tltnxfcootopDeaieo s0 exrxr nudope lfcsl() rta(moou4oetnmf3ils s2rmuvp;(4aexoir ta1fa  luvo;()srurirpiu1lle  fcslt  Duru  no1aet  ocils m emn onu4 lenmf3ty1lat  uvo ( t2umirpou4llte icsatfs2trxm ;t0oeen oetlt s2ra(mo u) leoxr ootopte ues;s t2toiopiodlme  ict t) rrm(r nt0oltomi3ils a2rl(vp;()tltnmrcoodfa r neolt seur(o3nu4ale  fctl()sDrm(root1tetomfctadfaDua( s;t0 eeoxf3oadfpDrlnei;t)seuoxm3ny1openlfcil()s2tr(mp;u4texnmoeiytla uanvs;u4 rerir iydoatrln s;() exr(r iu4omtelfct s srraxrp;o0aet  i3tysls2rmn o;t0 exrxfcootlptr iei t) rum(o iodlle mnvt sfaruau p;u4tpenifctldfa2ua(vo;(0aetrxr3oo1fm ran o;( srto(opiy1lm  livsat) rur(mo;o4ape mociad aDumn p u) ltrmo oodlpteln s s0srumio3ny4om n icsa()arrmxmpoo4tle  fciytfm2uan snt0 rxrmr oo1la e nes;s0 rxrxrpoo4om nmnvtls artrx pot0tex  f3tlt aDumn snt0trtnio iy1omte n s () exo(o3ou1lmt  iet t) 2rrxmo;t1oetnmi3ilslsDrln o u4 lxnmo ta1la rlieo;( trtrio3oudop n icsltf rrr(  nu4tlx  oeilslm2uau on(0 eeoxrcoa1fmte ivs t)sexr(m3no4alt  fviat)aDtrumonu4aex mictls sDranvs;(0texrmfctadomte uvi;(0tetrim3iu1lmtnlivia() 2uax o;o4apx io3ilsls emump;u)texomo iadom ran ol(0 rumxopnydlmtnmietas) 2tmxm ot0tle  i3iytls2ranvont) lxoio3iytlm r n ol()trtmxr3no1open ivi t a2umxmpnt1tleo f3iydlsDel(vpnt0arxoxocoatfat ln i;( trto(m3oo4op nlnvi ( s2tmx o;u4altoif3iytlaDrlnmo ()tltomocoatfaDrlu ilt)seuo(o nydape lncils)s2taxmpou4oee  f3tas a umumont)aetrxo3to1faD  u i () rxo(r ny1ale  ncsat  2urx oot4alxnio3iatla rluvo t4 lxrir oodop ean s;s0truo(rpiodlpee ies (f rtru  ;u4oeto ocild m rmumpn(0texnxf3to1omt  uvsls0tetrxr oodaptnmfvs ()arrm( pnu4opx ii3tat m2eauvsn(0tltrmrcoydlaDraivi;( t2trxo3iy4op  mfviatf rurx  no0aexn fetadfaDrlnmsnu4alxnmo tadfpD  u s t) etoxo oo1ap nmfvt sfaruax p;u1opto f3iltfa umnmp t4 rxrmr3oo1fatr uvi t sexrirpoydape  fesa(fsDra(mpou0texoioeils s2uau onu)aetrifcty1oa  auvo t)sexmio oy1apee ici () rtr( poo0tee miciytfsDran pn(4 lxrmf iadoaDr ueol() exrxopnydaptnlncslt aDtrx  ot1aex io3iys m2eau s;u4alxrxf3iodoaDeau o;()s2tmirpnu1lm nmfeia(  2tm(rp;u1apxn ociytfaDranmo (4arxomo ta1oaD  nes;s t2xoxmpiydlpe livia(  rumxmont1apen f3ils a2raumon(0altrxf iy1faD  ues;()t2xmio3iy4lme mfcilt sDrmumono4teto o3ilt a2ranvp u0 lxomociytom   n s;s)tetriopny1al nmici t  Drrxmp;u1tpxoiieiatfs ean o u4arermrciatfa  ai i;s setm(m3nudalt mnci tfsrrr(  nt1aptnii3ilslm rlnvo u4alerircoo1fmD li o (  rtr(m3oudll  lnvsat  rraum ;u4aeeniiciltls2eauvs t0trenir3iy1fpt lueols0trxrxr3ou4apenmnes (fsDrm(  ;t4tltoifetys s uln onu)trxnif iytfat auvs (0srumirpiu4lmenmivsasfsrrmxrpot1oeeoioctytlm2rau on(0 eerxr iotoptrlivolt)s2xoiopnu4lpe mfvtatf Dtmu  ;o1tpe ifeiysfm2uanvp t4aexrio oydla  anei;(0tetm(opoo1ll n fvsas srrr(moot0aetniociyt aDuaumsn(0treoifcia1laDean s;t0t2xrxo no1amee fvtat)aDuaxm oo0apeniieilsfa rlnmp u0arermr3oo1oaDelnvi ()seuo(m3iodalt mfetl(fsDtmurpou4aexnioctlslmDul(vo;t0alxriocoa1omDrau ils)teur(mpiy4omeelfviat  rtaurpnu4texomfeiydfaDuluvp;t)trerir iodlptr n i (  rumimpoy4oltemict t sDtaumo;t4oeen feiys s2umn s (4 etoxf ta1lmt  u o t  2xr(m iy4lmtemicsl(f rtr(mo;t0tltomf3ilsfs2uauvo;(4aeenxr3ta1fpDelivsl( setrimpoodop nlfcia( aDtm(rpnt0aetnifeiltfm2emnvon()arxrxfcoo1lpt li i (  rtoim oodameemncia(f 2ua(r nt4tltniieildfa2el(vp;u4tltoifcto1fmDeln i;s sexm(rpny4omtnlfetlt)sDra( p;t1ole iiciys s rm(von()aetoifcia1fptraieslt) rurir iy1omtnlfeias sDur(  ot4oleoio3iyslmDeluvo;(4 rtrmr tytfp r uei t s2uoirpiodlp n fvtasfs2umum no0olxo oetydls2uaump;u4 renxf iadfpt ln o;(0s2urxopiodlle miciasfaDua( p;u4tpt  o3ild a2uan o;(0 lerif ia1omt aieolt)trtrio3oy4opee ieta() ruaur ;t1teen feilsfm2rmnmont0trxnmrctydfaD aivo ( t2uo(m oy4lpenlfct t)sDtm(  no0oexo oeilsfa ulumsnt4 eenxr ty1fateli o;t  eumio3iodllee ncia(fsrrmu o;t1texniictydls2emuvp;u)altnircto1oateluvolt s2uoxo3no1lmen fviatfsDtmxr ;o1tpto ieild a rl( s u4tetrmfcio1oatr nvs;()teumir3nu1omeemnvsa( srrrxrpnt4alxomi3tytla eauvs t)tltrifctydlp  luvslt0s2urir iu1oleemivtlt) 2rmumont0olto fciat s2rluvp (4 lxnir3iotfpD auvs;s)s2toim oy1ope licilt  2rr(moot0tpeomfctlt s2ra(mon(4altoxf ta1oateaneo;(0s2tr(opoodape lnctas)aDtmxmp;o4apx  f3tysfs2umnvsn()arxoif tadfmt  n ils)s2xr(mpiodolen ictl()a2ur(mo;o1ope  octasfa emumo (4 lxrxo3oytfptelieo;s  2xoir iu4lm   fctat aDumx ont4opxomietlt m rau snu4 eeoxo iy1laD  n o ()teumxr ny1op elncsa( s2uau pot1aptn iciltls umuvp;t0 etnir3ta1late ivols)t2xo(mpoodopt  icsatfaDrmxro;t1tltn feiyd s2ua(vo u4tltrxo tytlpDrlivi;t  2tm(opiy1lpte fciatfarrmx ooo0oltnii3tatfs2rm(ms;t4aexomr oadfm rlivs;t trxo(opiudlpeemfeslsf 2rmxro;u0tlxoifetldlaDrmuvpnt4tltnmrcoo1la ranvolt0s2xo(r3ny1ap nmfvtl( arumxronu1oleo oeiyd m eluvs;(4 rtnmfcio1oa r nesls0t2tr(o3oo4lm e nvs sfsDum(r no0openiiciadls emumsnu0 reoio3tydop elieols)s2uo(mpny1lp elici (fsrtrxrpou4tle  ociatfsDemu pn()tleoxo3oadlp  au ols0seurirpny1lpenmnvi sfsDur( oot0altoioeilt s ulu s;(4altnir tydfp raueslt)srurir nu1aleemivt s aDrr( pot1opxnifctytfs umums;t) lermf oydom eauvs;s0seuoxo3iu1lpt  iciltfaruaurpou4tlenmictyslsDuln pn() lerifctydlmDe ies;s  rumiopoudomtn net () rraum ;u4apxn ocilsls2rmnms u0 lerio3io1lm e i o;t)trum(r oo4lptn nct sfa2raumono0teeomietasla umnvs (4tetnmfcta1opDr ivi;(0sexm(o3no1al e nviltf Dta(  ;u0tlxn f3iyt m2ranmsnt4 reomf to1fptelnes;t0t2xrxrpio1lptelieia()srtaum ou4apx  f3iatlsDrm(mpn(0 ltrxfcto1fm e n o s0t2umxm oy4olee ivsl(f Dra( pot0tle mictadla2ra(mo t) ltnxr iy1omDran ol()trtrim iu1aptelict tfaDtm(mp;t1oexomf3ildla2eau o (0tlxomo ta1fp rlivi () rxmxr3nu1lptemncslt) rrmump;o1tlto fetatfa2rlums;t0 rxrxo3tadoaD lu s;() rumimpoydolenlneils aDtauroou4tlenifeiadfm ulnvp;u0 renxr oadlmD aivs;s)s2uo(r nu1amtn iei t  2rr(mpnu4oexoiociatfmDumu s ()artrir totfat ai olt) rxm(opoy1amtnmfvta()sDumxr ;u1tee ifciad a elumonu0teeoio3ta1oaD  uei t)s2xoxr3nodomee nvtlt srtmurooo0oeeo oeildla2ran p t4aeeoxfciatfpteaueo ()teto(m oy4lm  liviat)artrurpnt4apeomfeiaslm raumpnt4trxnio oydlatrlu i t t2uoxopoudlmeelnvsa()arumum ;o1opx  ociytlmDra(mo t)trtrio oydfat  u il()t2uoir oo4lm  livtas)a2raxr nu1tpto octatls2rl( o u4 rerio oadlpDe ieo;t  etm(opno4lp nlfesls)aDumur oo0tpt iiciyt s2ra(mo t) lxrifcty1lp raieil()s2xm(o3io1omt mncs sf 2rm(moou0aexnmoctydfs rmu s t)trtomo3todfpt lnvols t2xmxrpoo1lptemfvsa()srrmuronu1oleomictlt aDrl( p (0aeeniocoatoa  livi (0trxr(o3io1lmtnmnvtlt  2umxmp;o4oeenmi3tldfsDrmuvsn(4tetoxfcoo1opD  i i t0texrim oy4lpte nci ()a2tmu o;u0tee  i3ils sDeanvsnt0trxoxf oydomD lnes;t) rxmxo nudaleemnvtlt srrm( p;t0apx  ictyslaDelumo u0tlermrcoatlat an s s  2to(rpnu4omtnmicsls srraurono0tlt mi3tyd m uluvo u0 exnxociy1la elu i s  2tmxmpiodam  lfctasfsrrrx p;o0tpto oeiad s uan o t4 rxrif3iatfmt  ies (  2xo(o nydlp e fctlsfaDum(m ;u1alen f3iltfsDemnmo (4altomfcoa1lat  uei;()texr(m no1olt mfcsat  Dtrx oou4tltn fetatfs rm(monu0 rxnir3tadfatrln i s) rurim3oo1ole lfetl(  2tr(rp;t1opxomoctysfaDeln s t4teermr iytfa eauvo;s0sexrio oo4lp   fet () rtmxr nt0opt mi3iad s2eanms;t0 rxomr3oo1oaDrln o ( sexmxrpnudapee fviasfaDtr(m ;u0texoifetatlsDrauvp (0 eeoxf oytlaD  ivols  rxrxo3nu4llenlnct ( sDum(r no0alenioctytfm2eauvp t)trxrmrcoodoat ai i;s0texr(o no4apte fvt () Drmurpou1olxn ociysfs ua(vsnu4trxoxo3oadfa  lnei;s0teumim iy4apenlfet tfa2tm(r nt4oleoio3iadls2rlump;u0arermfcoy1fat lieils0 euoxo3no4lltn ictasfaDraur no1opxniieiad aDelnvo;t4arxnmo3iytomD aueo s s2xmxm3iydaltn neil()a2umu  ;u1aexo o3iydlsDrmnvo;u0aeeoxo iydfmt li ol()srxmxo iu4alt mictls aDtm( o;o4openifctlsfs2eanvp u)trtoir oytlpDeau s ()texmxmpiu4oltelnvsls)artmumont1optnio3ilsla2emnms;t0 lxoxf ia1omDrau olt0srum(mpio1am elnviltfsrtru pnt4tpt  iciys s elnms;() etnxocoadlmteaiesls sexoio iudlp   ivt t) rrax o;u4opxnioetyt s umnvon()areoio3iadlpt lueil()s2to(m oo4aptnmfcils)srta(mpoo0tlxn fcildfsDra(vp t0 eerif3ia1fp eai i s setrirpiu4ol e fetl()aDrax o;o1olxnii3ildla2umnmp t0tltnioctydoateaiei;()teuoiopoodame  ivslsfa2ua(mpot0optoii3ils aDrl(mpnu0 exnmfctodlptr n o t t2toimpiu4lmeemfesltf Dtr( pot0aetnioeiyslmDel( o;u4alxnio iatlm r uvo ( t2xmim3nudlp nlicsl( aDrru  ;t0oltnmieiasfs ranms u0aeermrctytomDeln s;t0 rurim3oodlltemfvils  ruaxrooo1tlto oetltls2elumo t4alxrmoctatoa  au ils)s2xoir3oy4ap elieiltfs2um(  ou1tlx  feiysfs uauvsnt)tlerir3tytopt aues s) exrio no1op nmnci s s2rr(  ;o0oltn o3iyslm rmn snt4 exrmocoo1oa elnvo;(  rtrim oudllte nvi t)s2uaxmpno0ape  ociytla umnmo;u4 ltrxo3ta1lpD  iei t0t2um(m nu4omenmfctltf 2urur nu1oeenii3iasfm2ra(mp u)aeenmrcty1lpD  u s;(0srtoim iy4lme lfvi s)a2taumonu1apxnmoeilt m emnvsnu)aexomo3iotlmtelueils0 exrim3io4lpe miciatfsDtrxrpnt1openifctas s um(mpnt0arx
\ No newline at end of file
@@ -0,0 +1 @@
+u i t trtoxo3oodopee nci s  2tru p;o4tlxomf3iyd mDum(mpnt0 rxoxo3ia1fmDrauvs t t2uoim3nudlleelfei (farta(mo;t4apenifetadla rmn p;() exrxfcia1fp rli olt0srxrxr oo4ol emfcs sfs2ta(mpou1tleo o3tat sDuluvsnt4altnmo ta1fpDean o;t)s2to(m3oodlle miviat) Durumo;u1aptoiicildlm eln p;t0 lenxrcootlmDelneolt0sruriopno4lm nmfet t a2raumpnt0aptoioctad a rmu p;u4tetrio iytlmteanvs ( s2ur(mpiudlptelfes t srumxm oo4tex iicildlm2rm( p ()trtnir3todop elnes;(0teuo(m ny1lm  livta( s2uaxmonu4oltomietaslaDeau p;t0tetnxo3totfptean o (0srtr(o3io4lpte fei s aruax pot4oet  ieils mDua(vonu)tetnxr3todlpte uvo s t2uoir3io1ol nmnctas sruaxrpot0olxomfctltfaDulump;u0tleoircoa1lm r i ol(0srtoirpny4om e fcsa() rumxrpno0tlt  iciytfa2em( p;(4 rtnxr ootla rlnes s)srxmxr3iy4ameemictls  Durxr no4apeo i3iytfa2ulnvont) rtnxf3ia1fpDrlues;s seurxo3oodlmtelnvil()srua(m oo0tlx  i3iytla2umuvp;u)areoir iodfmDeln slt0s2uo(o3nu4llte nesltf 2trxrp;t0aetoifetytlsDea( sn(0tetnmf tydlmDrlies ( s2uo(o3iy4lmee ncias sDrmx poo0altomociat sDeauvpnu) etrxf3oytfpt aneolt0srxmir iodamt  neia()sDua(  ot0aptniictytfmDum(von(4tlxnmo oo1fmt lnvo;s0tetm(opnu4om  mnet (fa2umxrpot4aptn octytlsDuanvo ()aeeoio3oodoateluvilt0trxmiopnu1lm n iesls sDrr(mpnt0ope if3iydfaDeluvo t0 leomf iadfmDelues;s s2xoim oodap   ietls srraump;t0aptomiciyslsDumuvs;(0 eeoir oodoateai ols) exmimpoy4op   neia()s2ua(  ;t4apxnmieiysfa2rmu p;()trxnif3ty1oa eanes s0 2xmxm no1llt  feilt)s2rmu p;o4oeenmociadlsDra( p () rxoir3to1fa raivilt) exoim3nu1ol nlnvs sf rrr(m ;u1apt  f3iysla2ua(ms;t) rerxr3iatlp r nvo;s)seum(o oudolee neia( s2uau ont1tpt mictytlm ulnvp t4tetnif3todlatraneil()s2urxr3iy1lp e ivtlsfaDta(m oo1oetnmfeild s umnms;t)aexrmo oydfptr i s;s setrim3oo4lpeeliesatfsrua(rp;u4tpe  ieildlsDum(vs (0trtnxf todlmDean slt  exoxmpno1amee ictas)sDum(mpnt1tpeoiieilslm2umn s;t0 rxrxo3tydlm rlnvi ()setm(m iy4lmen fvtas) Durxmonu4apt moetasls ul( o;t4arerxocoadfaDe ueo;( srxm(r oydlptn nvi sf Drmuront1aee  i3tas a rmuvpnt0tlermr3todomtelivo;t)teuoim3nudlp  mfvtl() rurump;u0apt mieiaslaDumump;t) eenmr iotfa elivi t) 2xrxo io1lle  iesl(faruru  nt0opt  oeiad a ulnvp;t)trenmo tydfatran ils0texoxo3iodal n fes s s2rmx  ;t4opxnmocilt mDra( o;u4aetnmocto1omDelies s0srurxrpnudoltnlfeiasfaDrr( ooo4texnmo3iytlm emnvo t0 rtnmo iotlaD  ivo;s)t2toio ou1ll  mfcsas)arraxrooo4ole ifetldla ra(vo;t)arxomo ta1opDelieols  2toxm iu4op emfei tfs2tmu pnt4ole mieild a2elums;t4 exoio3oydop   ivs t t2toio oo4llt  nvs sf rtm(rpnt1tlt moeiysfm2rau o;u0trxrmr oydfa e nvo t) exr(rpoydome mncta( s2tm(mono1alenmf3iasfsDean s (0 rerio3io1fpDr ues;()sexoimpio1optemivtas a2rmxrp;o1oee mo3iadla2elu s;()teermf oo1laD  ueo () rum(opou4am nlietl( sDumu pot0ope ifctysfaDuanvs (0aeermo3tatlmD auvi s) etr(m oy1op  micsat)a2ua(m ;u0tet iieiltlmDea(vs;() rxrxfcoa1lpD  ieo;()srtoim nydlptemiet t) Dtmxrpno1oee  f3tyslmDrlu s;(0 rerif ta1lpDr neols0trumiopiodalte fvs (fsDumxro;u0altn i3iyd s ul( p u4 rermf oo1fp   uei;s)tetmiopnodap nmfcsltfa2taump;u4tlx  ietas s2rm(ms t4arxoxocootfatraneo;t  euo(m3iudame  nvilt)srra(ro;u0alx if3iytlmDuauvs;(0 ltrxrcoydlpDr neilt0s2xmiopoydame mivtls) 2uauronu0tptn o3iysfmDuanvpn()tlxrir3ty1faDelnvolt0trumxopio4al elfes ( s2rmu ono4olxoif3tadla rl( on(4aexrir iodfp eaivi ( seumxo oy1ap elnvtlsf Drrx onu4tpe mfeiad m2umuvo;u4artrxr ta1lmt an ilt tetrxr3nu4am   iet s)arumuroot0texomictydlmDraump t0 rxomf ta1fp  luvi ()teumirpio4op elfcsa( arua(roou1oee  fciytlm elumo ()trtomo3iodomD  n olt trurxrpou1am nmnes t sDurxrpnu0texn fcildfaDua( p (0 eeomocoatop eaiei s trtr(o nydaptnmfcsls srraur ;o1oexn fctas a ean s;u4texrmo3todlpDeau o;t) rxr(r oydop  mictatf Dtrur ;o1oexomoeiatfsDea(vp;t4artnxo3iadlpDrliei;s)t2toim3oo4lltn ncs (fa2rr(  ;o0tleoif3iasfm eaump (4 rermo oytlm rau s;( sexm(r3oo1ale mncil()aDurxmpoo0tex ioetytfa um(vo;u4 rxrmr iydfa raies;(  eum(o iy1openlfvslt)sDrrxrpnt0apxnifciadlmDeluvs;t0tlenio totfpt an o s0texmiopnudlmt liesasfarur(  nu0apenmfeildfaDum(ms;t)arxnxr tydfmDr neo;t t2uoiopiy1ameemfeiatfs2raumo;u0optnmoctasla ean p (0trxrxr ootla   i sl(0s2xo(rpiodamtnlnctatf Dumu  ;o1olx ifcilsfaDuauvs (4 ltnif3todoptrai ils0 eum(mpoo1al  mnvilsfaDrm(monu1apx if3iltfaDem(vs t0treoxfctydlmDeaivs;s  rurir3oydam e fvsl(fa2rr(r ;u0aeeoiietlsla emuvs;t4 ltrxo todlmDrlues;(  rtmim iodame  ietls  2umxronu4oltoifeiltfa2uanmp;(4alxnircoodlm rauvols sruoiopoo4lle lfcsas)sDumum ;t1tpenmieilt s rln o;(0tetnxf tydlm   n o t0seurimpno4omtemivs sf Drmur ot1tpe mf3ilt sDean o;u)trxnxf3tytfate u s;(0 exrxo3io4opt mncs s s2rmur ;u0alxnii3tydfa ra( s;u4 etoifciotfpDrliesl()sexoxmpiudllt mnvsl( srurxmooo4altniietltfm2uluvont0aexoxr3oa1lat lu s t0setr(mpoodop n fesl( sDurxm ;u0olxoiieiys sDumnmonu0aetomr3iydlmDelu o t teuo(rpiy4lm  mfci () 2rr(m ou1alen o3iysfa2rlnms;u4 rtrir todlat  uvslt)seto(m oydlm elnctltfs2rmurpot0aleomieilt a2umn snt) eeoxo ootlmDraieil( t2xmir no4ope  neiatfsDtmur ;o0opt mf3tltlsDra( p;()teeomr tadopD aivols)s2tm(rpnodamtnlfesat)a2tax pnu0olxnioeiadlm2el( p;u4tlxomo3tytfm   uvo;( trxrxm nudll nlieil()aDrrum nt1altoii3iyt s rm(vpn(0 ltrmr oatfa rauvs t0tetrxr3iu1omtnmfvilt srurxmo;t1apxnifciytfs um( o ()tetnxf oydoptr ies (  2ur(mpiodap  lfei sfs2umxroou4alen ietadfsDuln s;t0trtrmrcty1lmDraivolt0srtrxm io4lpenlfvsl() 2umxr nu0aee ioeiltfsDel( o t)arxnio oydlpDelneol(  2to(m iydlmeemfvils)sDtmu pnu0tptnioctasla ua(mo u0 lxnmo iadfpDraiesl()s2xoxrpnodaptnliciasfs2uaxrpoo1aeenifeiadlsDeaumsn()trxrif3ty1laDranvilt t2xrim oodamee nvs ( srrr(m ;u4teto oeiadlaDumnmpnt4 etomo3ty1omte ieolt trxoxmpnodom  liet (fsrua(rp;u1alx ii3iadlaDelnms;t0tltomf3iotfmDelivi;s0 rtrir oydole lnci t  rumxroou0apxnii3iydfaDeluvsnu4alenio3tydfa  luvolt trtrxrpoo1optn nci t arrrxrpoo4optnmi3ilslm2emnvont) ltomfcoodlp   n s;t  rxr(r3iy4llt mnvt t  rurxr ;t4tpxomfeilslsDulnmo t)teeoxf3oo1lp  aivilt)trxm(r ou4lmtnlnesls)aDtaur nt0aex  ictat a2ulu o (4tlxoxf ia1op rlu il(0s2toiopiy1lmt miesasf rra(ro;o0oee mo3ils sDean p t0teeoir3io1fpte ivo;(  rto(r3iu4ale  nvt s aDtau  oo1tee  ietyslm ea(vsn(0aetnxf3oadom rln il(0tetmir3iydamenlfcsat)sDrru pnt1oee ifeiltlm2rlump;() ltnxoctodom eaieilt0srxoxr3no4al nliet s aruaxr ;u1aeto oetadfsDuauvsn(4tlerirciatfmD an o s)trtmxopoudoptelfvslsfsrtax pnu0tex  fcildlmDrl(vp;u)teeomr3totom   uvi;s0sexo(opoodlm n fci s)srua(mpoo4tetn octys a2eau s;t0 etnxr3iy1fatranvsls)t2tmim3ou4amtn ietlt) Dtaxrpot1teeo ociyd aDeauvp;t0alxnxr3ty1omDr u ols teum(m3nydapt mncta() Dumxr ou1tltn ieiysls rmnmo;(4 lxrxr3tadfat  u sls) rxoirpnudoptnlici t srra(m ;o0tlenmoctyd s2ul(vp;() lerio ootomt  nvo;t  rtmim3ny4amte nesa() rtmxrpou1alen feiaslaDulnvs;t0 renmf3ty1latrli ils)sruoxmpou4lmt  nvtl( s2rr(  ;t0apto ietatls ulums u0altomrcio1opDrlieo ()srxrim iodopee fcta(f Drmurpou4alto i3ildlsDeanms t) eeoif oy1omD auei s)trurimpoy4lm  lncsl(f 2trxr ou0tpxo ociadfs2ea(mo (4aleoxfcoytlmt  ueolt s2trir3ny1aptelfcsa(faDrrur oo1opxomf3ilsfaDuluvs;u0alxoif3oatlpDelivs;t0 2trxo ny4amenmnvsa( aDum(r ;o1opx  fciltfaDumuvp;t4tltnxocootoatrai slt  2ur(rpnodolee iviltfarumu ooo1apeoifetad s2em(vp t) rtrxf3iadomte ueilt sexrio nu1oltemfctlt srtmuroot0oeenmf3tasls2eanmp;(4tlxrxr tadfmtrliei s)setmxopoodom   netatfa2tax pou1teeoif3ild aDrmumsnu)aexoioctatlpD  uesls teur(mpno4lp  mivtls)sDum( ooo0ole if3iltlmDrm(mpnu4 exoxo ty1optelivilt  exo(o3oudope lnei t sDur( poo1open oeild a2rlumsnu4treoxf ia1lptelnvo s) ruoir3nudom e fvtat aDumxrpno0aptoif3iadfm rlu onu)alenmo3tytlm ran ils s2tr(o oy1lm elivs tf rumu  ;o4alxoiiciasfaDelnvs (4trtnmoctadlpD  u o;(0tetrxo ou1lpt  nvt (farum(mo;u4opx  octldla ea( s t)teerioctatfptelivi;(0trur(o io1openmiesl()a2uru o;t0open icias s2ranmp;u)tleniocoadfa elnei ()teto(r oodal nmies sf 2taxr nu1oetn i3ildfs eanvon()tlenxfcty1op rai s () exo(r oo4amt mies t aDrmu pnu0oexnif3iatfa2umnms ()tlxnxrcty1fp  lu ils0s2xo(rpoudolen ieia() Dtrxr no1aet  f3iatfs2rlu o;u0tlxnmocoadfmDe n olt0 rumxmpno4ol  miesat sDtau onu1aexomfctysfm2eaump;t) rtrxfciadfaD lieo;s)srxm(mpnodlpe  ncsls a2umurpoo0oeeniocilsfmDuluvp u0 exrif3oadlmDeanvi;t)srtmimpou1ale  nvil(fs2tr( pot1olx  oeiyt a2umuvs;(0trenmocoo1omD luvs s)sexmxopno1oleelncil() Dumu  ;t1olxo iciytfmDea( p;t)trxomo3ia1latr ivils0 rtrio io4ap n ivi ()aDtmumpno4oee ii3tltlsDum(vs;u4tlenxf iatlaDeai s s s2tmir iy1ol  mfvtl( sDra(mp;t1oee io3ildla rlumo u4teerxrcio1lptraies s)trtoio3oo4ole  ivsas) rtm(rpnt0oleomo3tldlsDuan on(0trxnmfcio1oaDrlueils setoio nu1lltn fctl(f Dtrxronu0ale ifciltfs2ulnvont0alenif io1lm eaues t srxoxopnu4opt lfctlsfartaxrpnu4alxomiciat m2elums u0alermf3oa1lpte i ils  2toxopno4lpee nvs t arururonu0apxn ociaslmDumnmp u)altomr todlat au i s0teto(o3oy1ol   fct s) Dtrx  ;u0opt  ictydlmDrl( snt4aexnxf3iodoa elies t s2umxmpiudame lnct t a2rrump;o1texomoetldfmDraumpnu)trxoir ty1lpteaies (0sexr(r3iodlp nlnvils)sDrm(rpou1tpt  o3iytfmDelnmon(0 rxrxfcio1oa elivsl( trtoimpiu4llt lncsl()sDrmxro;o1tpx ioeilsfs elnmpn(0tetoiocia1oa eluvo;s  exm(rpoudlmt  nvtas artr(r nu1altn i3iadfm umuvsnt0artnircia1optranvs () rurxr3oydame  nci sf Dta( p;t1tpen oeias a rlumo;t)texnif3oadfp ran ols  2tm(m3iydalen ivs s  Dur(roou1alx  i3ildlaDemn p ()aeenmf3todfpt au o;t  rxrxm iydlmt  fvs s  rumurono4tpeomociysfs rauvs;u)arxnxr3ty1fmtrli s s0trxmxrpoy4open ivias a2trur oo4tpeoio3ildla eanvpnt)artoxocoydom r nei;t)t2uo(opoy4lptnlieta() rrau pno1ope ifeiatfmDrl(vs u0 exoiocoo1lmt lueo ()setr(opou1lm n iesa( srtaxrono1oeeoiociatlm2ul(vsnu) exnmo3tydopD lieo s0 exrxm oy1op n ietl(  Dtm(mo;t4tptnmoeiytlsDran s u)trtoif3oa1oaD  ies t)seto(r3oydope  icsls artru  ;u0oetn oetlt s rmu s t0 exrioctytfptraueolt)s2xrio iudal nlict ( s2uaxr ;t4tpeoifeiasfs2ul(vsn(0artnxfciotomt ai sls)srtmim oy1amee nvslsfa2ua(rp;u1opeo oeiasla2rmuvs (4 exoxo iadfmtelnvo ()t2trxopoydlltnmfeslt aDrm( o;t4tpenifctatlsDemu s;u0 lxrmocoytlmte iei (  2xrim oodam nmict sfs2uax p;t1ape if3ias sDumn p t)teerxrctadomteai o;t0srtmirpou1aleemfcs sfsrrau pno4tpxoii3iyt mDeanmpnu) exrmf3oytop  an i s seumimpoodamte icia(  2uru  no0ole  fciysfm uanmsnu4tetrmr3iatoate i i t0t2xo(rpnu1al emfcs (f Dtaxro;t0alt  ieiatla2rmnvpnt0 ltoxo3iydlmDeai s ()seuoxr3oudll nmfvs tfaDuaxronu1alen f3iyt s emn o u0trtrif iy1lpD  nei s)setm(rpoy4olenmfcta(  2rrx  ;u4tee ioctlt aDem(vo;(0teeoif3oy1lmD anei;s0s2xoim3oudam nlnvia()s2uau pnu0oetomfctaslmDum(mpn(4trtrmr3oydlmtelueo;t0 2xr(r3oo4om nlfviat)srurxr ou4teen o3iysla ua(vsnt0tlxomo3oydfp r i s;t0srur(m3io4lltnmieta()srtau  ;u1oex iictldlm rmu o u0 reoxr3iy1lmtranei ()t2xoxr iydap nlnetlt sDtmxm nu0olxnmfeiltlm ua( on(0altnxf3to1fp  lieo;t)srxoirpnudomtnliei s srtau pou4tpenioeiytfa2ulums;t)trxoir oytlptr u i;s0 2xr(opoudope mfesatf rtau onu4tlx ii3iydlmDel(vsn(0artrmo totlatr uesl(  rumim3oudame  nvtas  Dtaxro;o4apx ii3iyd s ua(von()arerxrcoodfp e nvsl()s2trxm iodam nlfet s s2rrxronu4tpe io3iytla2ra(vp;(4tltnir oadlaDranvs;( t2xoxo3oydlptnlicsa(f 2uaxm ;u4alenioetatfs2rmuvont) rtrmocoa1lp eauei;t srxrim io4lmtnlivta(faDumump;t1tltnmfetytfa em(mo ()tlxnmrcoadla  lu olt0s2umim3oy1ap  mieil()sDua(m nt4tetn oeiatfmDrmnvp;(4aetnmo3oo1oa e u s t) etmir3iy1al nlics ()arraump;t4oex mocildfa umumo;()aeerif ootoaD  n o t) 2toxrpiu4aleemnctlt s2ur(r ;o0ole if3iysfa emu pn(4 exoxo3tadfp eanvi t0 exr(o3no4omenmnct sfs2rmxmono0aleo ociydfs2uanmpnu) rtoxr iytomD aneo s) 2urxr nudal  mfesa( a2ta(r oo1alen feiasfm2em(msnu0aexrmf3oytlaD ai slt trxrxr3oo4llen ietat srtaum ou0texomieiydlmDuluvs () lxriocto1oa   n o;s0 exrirpno1lleemfcsltfs2trx  nt0tlen ieiaslm ea( s () renmr3oy1lat luvolt trtmirpiudop n iesatf 2tm(mpoo1oeen ociad m uln onu0 ltrxo tytlp ean i;s0 2trim3iy4olenmnci tfaDraxm ;u1tptomocildla2ua(vont)tlxriocoy1fa raieolt  rur(opiu4lpt  ieilt) rurum ot0aet  oetytla2ul(monu4alxnircta1la   i i s)texr(o3nu1al elfvi s aDtau  ;o1aex if3iad m2ua(msnt)aetnmr iodopD  n ils trtmio ny4ll emfcsas)a2rru pnt0alxnmi3ilslmDranmpn(0tltomocio1fm   i s t  eumxo3oydamenmiesat)a2umxroot0aeenifetadlsDrlnmsnu4trtnmf tytfmDeln o;s) 2toxo iy1opeemneiatfa2uru  ;t1tle mf3tadfsDumu p;t0alermr iydlaDe n il()srurirpno4lp e ietl() Drm(mpot0oetoifctat s rm( sn()aetnxf3oytlptr nvs s)tetoirpiu4ale  ivi s arrrur nt1ole mociytfm2eln p;(4artoxociydopDeaivsl(  2urxm3oo1alen neslt)srtau  no4tetnii3iytlm2em(msnt0trxrmrctydlm  aies s  euoim3iodapenmnvsl()srraurpou4aee  feiysfa emn p u4trtrmrciydlpDrli o (0 ruo(r nudomtnmnvsl()srtax poo0aexoifeildlsDrmums;t)tlxnir3oydopD anei;(0srtmim iu4ap nmivs ( sDur(r nt0apxn i3ilt a2rl( sn(4treomfctytop elnei;s  rtr(o3iu4lm emnet sfs2rmx pnu4tltn ieildfa rlnvp (4 etomo todlm r ies t0teur(o oodomee net t a2ua(ronu4alxn oeildfaDeau s;u) exrio3oodfm  auvils)trxmir3oydolt lfetlt)arururoot0opto octat s um( s;u0altnif3oatoat aues;s)t2xoxrpiydlle  neta()srtr(mp;u1tlxomicildla2ean o;(4 rtrifcoa1fpD  nvo () 2um(o iudlpee ict s arum(mo;t4tptnio3iys mDulnvp;() lerxo3tydfaDr i s t0seurio io1apte ivtl(faDuaurpot0oeeomfciyt m2umu pn()arxnxo3iydfat lneol( trxmxr3oudoleelfct sfaDumxm nu4tex mfeiadls2el(vsn(4tltrxfcoa1lptrlueilt0 exriopny1openlfes ( sDumxrp;t4aeenioctytfs2rl(mpn(4aeenmo iatla r neols) etrim oy4apenmfesas) Dtrx ooo0oet ifeiyslsDua( snt)tetnxf3tydlpt ln o t0t2uo(rpnu1ll n nesas  Drmurp;t4aeeo o3tysla2raums (0altrxfcoodlmtrlieo s trxmxr3io4lp n neias)s2taxr ;u4oltoio3iadlaDrl( sn(4tlxrif3oytlm ran o (0 2tmxm iy4am n ncils s2trur ;u4oleomfetad a elumsnt0 eerxr3iytfaDelu s s  rumxr3ny1oltemnvt s)aDur(rono4aet iiciytlmDulnmo (0aexnir ta1fm   ivs;t)texo(opoudlle mieias)aDuau oou4aleoiiciltfmDemumpn(4aeenmf3oodlp r uvi;t tetrxrpno4optemnvs s)sDum(mo;o1aexomoctlt mDrlu onu0arerifcto1lpDe uei ()seto(opiy4lp nlietlt)sDur(mpoo4tee io3iytfa2emumo u4 reoxf totlptrluvilt0 eumio3ny1llenlfvsat) 2ur(rpnu0olx  fciasfa ulumo t0aeenxo iodlm eanvilt0sruoim oo1lm  lietl(fsruau  ;t1tpx  f3iat sDra(mp;t) lxnxfcootfmDeli ol() eur(o iy1omt  nvsl()a2tmu onu1alenmo3ilslmDem( p u4 eeomo oy1lpt  nvo;t0s2tm(o3iy1oleemfeiat aDrmu p;t4alenif3ilt a2emn p;u0 lenifcoatla  ai o t)srtmiopno1am elfcta( aDuax  no1altomi3tytfm elumsnu4tetrxocoa1lpD anvi t srtrio nu4ap emnviat)s2urxrpoo1tpxnifeilt aDelnvo u)tlxnif iodlmDrluvo;t0t2tr(opoydaltelnvi t sDrrxro;o0apeo ietadfs2emuvo;(4tltrif3oy1fa r neo s0 exrxo oy1opt mictl( s2uau  ot4tee ifctysfa uauvo;() eeomf oa1lateau s (0srtmxr iy1apteliei t  Dtmuro;o1ale  o3tyt m eanmon()arerxrcoa1late ivo;s0s2xm(m3iu4lptnlfvtls a2raxr ou4opx ii3iasfm emnmo;t4altrxo io1lm  an i (0t2toxo3nu1lptelfcsa(f Drrur ;u4oee  o3iysfsDraums;t)teenxo3tytfpte uvi ()trtrir3ou4ll nmieia() 2rm(ronu0olxn f3tasfs emn s (0 lxnif iytlmt luvols0 rurirpoydlp nmfet tf rrmu pnu4opeo o3tadls emuvon(0altoir3iytlmtr i sl(0 2xoxm3ny4lme livs t)sDur(  no0tet mo3iltls ul(mon() exoxr oa1fatrlies;t0truoxm oydame mivi s arum(mo;u1alxomfeilsls2ulums ()trtrxoctytlp  an sl()seumxm nydole  fvi t) Dtm(  oo4opt ii3ilt sDulump u4arxnmrciotfatelu o;t)t2urxo3iudap nlnei (fsruax  ;u1ape  ieiadfa emnvpnu4altoxocoodlp e nes;t0sexrio iy4op emncsls srtm(mpot0tee  iciyd s em( p t)tlenmf iadop   n i ()srtr(opno1al n ieia( s2rrxr nt1aexo fcilslaDem(msn(0 eenif tadlaD  n il()s2tr(r iy4ope  ivi (  Drru onu1texoii3tltls rmu pnu) rxnioctytom rluvs s0 rxoio3oy4al  livsas  rtauroot0optniieiad s2eanvsn()tetnxf ta1fmDe nvo ()t2tm(r oudllte fcsatf Dumx  nt4tet  o3ild aDelums;u4trermf iy1la  lnvs;s0 etrim io4apte iviasf rrrurpot4aex ii3iasfm elumpn()alermf3ia1fmDeanes;( t2xmxo iydlp  mfvsa(fsDra(ront0apenifcias s2ua(vp;u)arenmfcootoaDe ivilt0 2tm(opiodopeelfei s sDtau ono1aee  ieiytfs uau p;u)aeeomoctatfp raues;() etr(o3ny4lmtnmnet sfartm( p;t1tpeoioetysfm emumpnt) ltnif ootfmt  ivo;s  2xo(m oudam elfeiasf 2umxr nt0alxoii3tytfa ulnms;u)alxnmo3io1lpD  ieil( teumxrpou4ame mnesa( sDtmurooo4tpe mfciydls raumo;u4aleoio io1lateanvi;s0s2xmxm nu4amtn neia(farrrur nu0oltn oeiat sDul(vsn(4alenmo3oodopt auei ()trurxrpoy4olt  fesl( sDtr( onu4apt miciyd a2rmnmo;u) exnxr3iydfat au i;t0teto(r3oy1llte fcsl( aDur(m ;o4alenmo3iytfmDemu on(0 eeomr ootfp r n s;(0sruoim ny1ape  fct sf Drrxrp;o4tpxnmoetydlm2ean p;t)tltoifcoo1lp rlu ol() etr(mpio4aptelies (fa2umum nt4tpeo i3iytfsDeln o t)trenir oytfpDrluvils trxmxm io4lptnlivt sfsDtru p;t0apxniictatfm2rl(vs u0aleoiociy1lat  i o;(  euoio3iodlpee fct tf 2ua(mo;o0tpxn f3ils m uauvsnt4trtnxr totfaDrlivo;s0srxr(r3oodamt mnvi tfs2umxmoot1tle ifeiysfsDua( onu0altnir3tadoate nvo ( texrxo no1ll  livils)srum(mpnu4ale iieiadls rmumo u4 exnxf oadfptran s t)srxoxo3ou1amte feils)s2tr(r nu4tpx  ieiydfa umu pn() lxnircoatop   nvo;s  rtm(m3no1lmt  ici s)a2rrumoot1tpt mictadls2rlumo t) etnifciadoatrau i;()teuoxr iydlp emnesl()sDtr( pno0altnmoetydlm el(mont0arxrircoadfpDeluvo;( srum(r3oodope liesl(fsrrm( ooo4tee ioeiltfmDelnmsn(4aexrxr iotlatelues ()srxmirpno4olenlics (faDurumpnu1tlenmfeilt m el(mp (4trerxo3ta1lmte uvol()texm(m3io4omeemnci t)arrr( poo0apeoioctldlsDulums;t0treoxo iy1fat ai s s trur(m iu4lm e fvs sfsDtrxmonu4tpxniiciydla umu o (0trxnmo ty1laDr nes s0 etm(r3no1openmivs ( arrm(mpnu4apeoifciys mDrl(mpn(0trxomr3oo1fatelneils) 2xo(m3oo4oltelfei s)arra(m ot1oeeo ieildfm ul(msnt)aexnxr3tydfp ean o;s0trurxm3ou4omt liet t  Dtaum nu0tpt ioctys a2rm( o ()texomrciydlpDeau i;s)t2xoio3oo1omeemfciasfa2tm( poo4tlenmi3tadlsDean s (4trtnmrcootomDranvs t) etm(m3iu1om emnctl() Drru o;o1oetnmietadla um(vs u)tltrifcta1oaDelnvi t)t2trio iydlpt  neiasf 2taxmont1alt ioetlt mDel(mont4trxrmo iotlmtraivil(0srto(rpno1aptn ncsls srra( ooo4oeenifetydlaDrl(mo;t0artoifctatfptelivolt0 2xmxr3no1aptnmiciatf 2trump;u4tpxo f3tytlsDum(mp (4trtnifciydlaDe n sls  etm(r3iy1lm nmncsa()srtm(r ou1olxnio3iltlsDuluvp;(4aexrxrciatlpteluei;t0s2xoir3no1ape  fcta()s2uru poo0ape mfcildls el( s;t0aeenxr oadopD  n i;s  exmxm nu1omte fci (f ruaxronu4tlxomoctysfs2rlu s ()tlxrircty1oa e u i;( seuoxo ou1ap n ict ()s2umx  ;t0opx miciyslm2rm( s ()arxoxo oatlat lnes;s sexoxm3ny1lltnmfet ()srrr( ooo1olto fctadfs2rln p;()teenxr3iadlpD  u s;s)trumim iy4amtnmneils  Durxm oo0aeeo feiltfsDra(mp;(4aleoir oy1om  anvo;s  rxoxo iudapeemicils)srur(ronu4aptnii3iysfa em(vpnt)teerxo3totlmtrlu ils srxrxr no1ll nlnvs ( srrmu pnt0ole ii3iysfaDuan o (0altrmo iy1lmt  ivi t0teuoir3ny1apeemncilt)s2taurpoo4aeeo ietatlsDrm( p;t)texomfcoy1om eluvslt0 exo(r3ou4llen fvi (fsDrax onu0tlxnmfciyslsDul(mo t0tlenxf3totlp elivs;s t2toxr oy4lmt mfes () Durum ;o1tpto icias sDeanvont0trenmo3iydfmDeau olt) rumxo3oy4lpeelncsls)a2umxmoou4tee mf3ias m2elnmo;u4alxnxfciodfpDranvi;s)t2uo(m ou4optnlfei sf rra(ronu1oee  ieiydfa2emu p t0tetnmf totomtelieo;(  rtmir3iy1lm elictl( sDrruro;t1olt  feiat s2ranmo t0 exrxf3todfptr i s s)s2uo(rpnu4olen nvi s)s2rr( pnu1oeen iciatlsDrmn s t4 leomfctytlat aues;t)teumxo oo4lpt mnetlsfsDtmu p;t0optn fciad m rl(mpnt) rerxf tydla   neol(0 2xm(m3oy1lltemietasfarrm(m ou0tlenif3ils aDum(vpnt)tltoir3to1omtranvo (  exmxm3no4lm  lfetl( a2urxrpot4oex ii3iasls ul(vsnu)aexrifciy1faDr ivsl() rurim3iudop e fvt t)arur(r ;o4tee mfctyd s2rmuvpn() rtomo iatfateli o;(  rxmirpnudlltnlfeslt)a2urur ;t1tlto o3ildfa ulnmp t4 lerif3tytoptrluvs;s0 2umxr3no1amen ncia() Dumxroou1tpeoif3taslm ea(vsn()arxrmr io1omDelu il(0 eumio3iy1omtnlnvtas sDurum ou4tleoifeiat aDeaums;(0teenmr todlptr ueil(  exmxr nudame lfetlt)aDuau  nt1olx  ietydlm2elumo;u0texnircoadfm rai s;s)srtoir3ou4om n fvsa( a2tru poo4aee io3iys m ea( o t)trtnxrctytoat lnei;(0 2umir3iy1apt  feta(f rrrx poo0ope mf3iad m umnms;t4texrxr oydopD auvsls  rxmim iy1opt lnet t aDrmu  ;o0tpto ietltls rmn s t0trenxociodoateanvo s0trurir oodlptn nciatf Dtrxmo;t4oltomociys m2emuvp t)aeerio oodlp rlu ols0t2trio iy1oltnmfciasfsDraumonu1olt mi3tat m rlnvp t0teeniociytfatelueo;t trurxm3oudalenmnesat)a2uax p;t0opt mi3iad a ua(vont0artrio3tadlaDr n i (0 2tm(m3ny1aptnlncs s)s2um(  nu1oetomiciyd aDelumonu)texnxr iatop elivsl(0srurxopny4omt lict t  rra(  ;u4alen f3ilsfs em( sn(4tlenmrcoy1oat aneo;()t2xoim iydopeelfctls) Dtr( ono0opxniietasfa umn snt0artrxr ta1faD  uei t0srto(m3iy1ol e nes t)sDtauro;u1oexn i3ias m2rm(ms;t4 rxnxocia1fpD ai olt srxr(o nu4olt mivt s)s2ta(mpnt0opx ioetadlm2el( p u4treoiocoydoate ies;s0srto(r no4ape lnvtls)arurxmpou4tpe  fetadls2ra(msnt0 eeoir3todfaD lnvsl(0setmxo3nydam elics ( sDtaum oo4ope moctltfaDemn o;t0 exrmo3tatoateli i;t0teto(r ny4altnmiet sfartaumo;u4oet mf3iatlmDrmu p;t4 etnxrcoatfa rlueol()s2uoxo3io4al n fvi s)srtrumpnu4oleniocias mDraumo;u)tlxnio iadfm   uvo ()t2urir3oudal   icsa(  2um(r ot0tex  ocildlaDelnvpnu)aexnxo oa1fp r i s;( srtmxr iy4lp elnetl() 2tmx o;o1apenmf3tys a2eanmo (0texomf3totlatrai o t0tetoio oy4ol e ivils)srtmxmont0aetomi3iat s2uanms u0alxnxf oytfpD  iei t0 ruoxm iu1lme  ivils) Drm(ro;o0olxn f3iltla2eanvs;t)aeeomo tadom elivo;t0seurxr3oydomtn fvi s srtru  ot0tlenmi3ildfm ul( o;t4texrif3iadfmDe nes;(0truoxo nu1ame miciasf Drrxm ;u1tetomoctasla2ulnvo (0trerirctytlat ln s t)trtr(mpoy1llteliesat)s2rax p;u0tptn icild sDuanvp;t4trxrxf3ootopD livo t)seto(rpno1ap emiei t  2ur(mpnt0alt  oeiyt m ea(vonu)aexnmfciodlatrai o;t0trumxo3iudlmenmncslsfs2trurooo4tpen i3tld a2eluvs;u)tleomr3oodfpD  ivolt) eto(r3iy1lm  liei ( artr(m ;t1olx ifeiatfa emuvont)aexrmrctatoat au s s0 rto(r nydam nlnvsatf 2taxrpno4oeenmf3iltfs2umu p;u4arxomo3oydfa rai i;s  2toir oy1ol  lfei (fa2urum oo0tlxnmieiadls2ua(vo;t4artnifctodopDr i s;s  rurxo3oydlpe  nvil()aDumu o;o0ale if3tlt a eanvpn(0 rxrmf3tytopt  ies;( texm(o3iydalenmieiat  Drmx  ou4tpeniicilsfaDua(vpnt) ltoifcia1lp rlnes (0 euoxrpoy1optelivt t) Dra( ooo4ope iieild m elumon(4treomrcoatlaD  uvo;()t2urir iy4op   netl(fsrrr(mooo4ope iociltlm rl( p t4 rerxr oa1fmtrli o ( t2uoim nydlpt mfeils)srua(monu1tetnmoeildfa2um(ms;u4 rxnmo oydlm   neo s setoimpno1llt  fcs s  Dum(m ou0opeo i3iltfa2rl( snu)altrxr oa1om ran o ( teuoxo io1ope lfvt sfarta(  ;u1apxniieiyt a el( s;(4aleomf iodfat  uvi t trum(o3oodal n fvs sf rraxm ;u0oexoifeils a2rmn sn(4areomo3io1fm rluvol() exoio3oydam n fcta(f Duaxm nu1texomociasfm ul(ms;()aetnxfciatfmD aieils t2uo(r3nu4optnmiesl( a2uru ono4olxomf3iltfm2eanms;t4areoifcio1fm raieolt s2urir3io1lm nmnvt sfartaurp;o1apen ocildls2raumont4 rxnmf3oytom elnes s)t2trxmpno1om emneiasfs2um(mpnu4tpx ifciaslsDrm( o u)arermr tatla  lnes;s0 rxm(o3oudam  lfei sfsDtrumpoo4oee mociltfaDemnmp () exrmo3oatlpD anvsl( sexoxopno1lp n fesltfarrax pno1oeeoiieildfa em( s;t) lxnxf iodlm  livs;t0trum(r3iy4omenmnvilt  Durxr ;t1alxo fetaslaDran pn() etnxf oytomt livi s0srur(opiu1ome mnvias  rtm( pno4openifciydfaDem( o u0aexrxfctatoatelieo;t0srtoim3oy4optelnvslt a2uaxmooo1aptnmietltls emn pnu4 rxrxr3iytlatrluvo;( teum(rpio1oltn ncil( a2tm( p;u4texnmfeias aDrmumpnt)trxriociytopt  ieslt0 rum(r3no1lle  fvtl(farta(rooo4tlt mi3tas a ea( o (0altnxrctodoa  auvi;(0teto(opiy4lm e nvslt) Dumxmpnu4oee mf3iatfaDua(vo (4aetrmr iadoatrlnvo;(0trtmiopny1llenlicslsf 2tau pnu4apeo o3ilt sDelnmp t)tlxoir3oytomtelu sl(0t2xmio3oo1al e net tf 2ur(mpnt0aptoiiciydla uan s;(4aexrir tadopDelu ilt sexoiopnodamenlfci (fa2rmum oo4apx  icilt mDrl( p;()treoirctotoa rau ilt)trxoxm3oy1alt lnetltfsDta(rpou0ale iieiys s2ea(mpn(4 rxoio3oadomt  ivol(0s2tm(o3nu1apt mivs tfa2rmxr ;o4tleomf3ilsla uln pnu0artrxrcta1lat lies s)s2xrxr3nydlm   fesl(f Drr( pnt1alxoiicildfmDul( s;u4altnxfciodfaDeli sl(  eto(o io1lm emictatfa2urumooo1oet ioeiltfm eln o;(0 etoif3oatfaDr n s s0s2tr(m oodomenmneias  2uauro;u4oet iieiadfaDumu snt)trenxf tydlp   u o;t0teumxo3oudol n icta()s2tr(moou4olt ii3ilt sDemuvsnu4aeeomr3io1om eliei;t s2to(o oo1ame  nct s s2uaxmpou4oexn f3tadlm uaumonu4 reoir iodomte uei s0srumiopiy4llte neslt a2rmumooo0optomiciytls2em(vsnu) leomf tatlat auvs ( srur(opno1lpee fvsasfs2rrxr ;t0apeo fetyslm2rmuvs;u4teeniociatoat lnes;t0texrxr3ou4ale mfvsl(fsrtmxrpnt1tlenii3tls sDemumont)artomr iy1opt  uvs;s)srurxmpiydamt mictl()srraxmpou4tle mictlslm uau p;t) renmf3oo1fa r neo s) 2xo(mpno1optelietas  Draxrooo1aexomietls m2rlu o t) eerir iatfa  luvil(0setr(m nu1omtelfeslsf 2trx  nu4aeenmi3iytfaDrluvs;t4 ltrif3todlat  ueo t)srxoimpiydllee nct t)artm(  ;o1opxnmiciadfaDraump (4 etnxoctatfpD aivs s0s2uoimpiodll e fcsas sDua(r no0alx  f3tadfaDum( sn(4aetnio3iodfmDe ieo;() 2uoio iy1omtn nvtas sDumxr no0opx mfctlsls2umuvpn(4aexoxf3to1op   uvils  rxr(o io4oleemivtltfarua(roou4tee iictlsla2rmnvsnt4artoxo3iy1fatraivs;s)t2trim3io1altnmiet s  2rmxmo;t0apeo ieiltfa ua(vsn(0tetrxocoodlaD lueo t0t2tr(o3iu4lpeelieils srtru oou4ope mfetydfa el( pn(4 ltomo oadfmDrlneols0trumxmpiydolenlfetat  Dumxmpoo1oleoio3tldlm el(vpnt0 etrxo3ootomtr ues s) rxrim nudlmenlfetlt) 2umuronu1tlt if3iltlmDem( pn(0aexoir tytopt livo t)trtmxopnu4ape livt tfarta(rpnt1opxnmfctltfmDemnvpnu4 lxnmo3iydfp r uei s) rurxo ou4lp  mfctl()sDuau  ;t1olx ifctytls2rmnmp t0trxnmrcootfmtr ivi;s texmxo3oo1op  mict sf Dtrxront0oexo f3tlslm em( snu0aexrif io1lmteluvs;s0trxoir nu1lmenmncil(  Dtmxr ;t0ale ifciysfaDrmu p;t)arenmr3ty1omteluvil()teto(o3ny4ll emfvs t) 2tm(r oo0tptnioeiys s2ua(vpn(4aleoxo3oy1omD  ies s srxmxr iu1lmtemivtat a2umu ono1apxoiociatfa2uauvs t0tltnxr ootfatr uei (0s2uoim3nodamenmfviatfsrraum nu1tlxn o3iad a emnms t)teerxr3iadlmDeluei t teuo(r3nudlm  lneil()sDtmump;o1opxo iciyt aDumumo u0teenxr3totfmtrln i;s teto(opou1ap   nvsl( sDtmx  nu4aeeo icild mDrau s;u4arxnxrciydlmte ues;t0trxoir3nodlmenmnvi sf 2taurp;t4tleniocild m rl( pnt) ltrifcootomD  nvi;s trtoxr nodlm  mics tfaDur( onu1tetoifciadls2uau p;u0aexomr oy1laD au i t0 rxrim3iy4opee fctas) 2rmu onu1ape  fctldfs em(mo u4aexomo3ty1oaD  uvo ( texmxm3oudopenmnvi sf Dtau pou1texo octyd aDrlnmo;u) lenxf oydfaDeln i;t)t2urxm3io1lmeemnet sf 2ra(  oo0tlxoifeiatfmDemnmo;u)arxnmr iydom elu ols0sexmxrpou4lme  ivt t)s2rr(mo;u1opxn i3tys a elums;t0aexnxrcty1fpte ieils t2trxr ny4amtelicsa(f 2rmurooo0alxn o3iydlsDraump t0tlerxo3iodlmDeaies;(0srxo(r3nodame lncsa(f rur(m nu1altniieiys s2rmnmp t) rtrmocoo1fmDean s ( srtmxopou1alt mfct s)arumxmo;u0ale  fciyd m el(msn()artrir ootlmDe ivo;(0 2tm(opoo4lp elfet () 2rrum oo0olt  fetltlm eanvs u0teeomociadopte ueol(0s2umir3io4lpt  nei s)s2uax o;o4tex iieiydls umnms;(4 ltrxf oydlpD ai o s0srur(m no1olt  icil(f rtaxrooo0tlx  fciyslaDea(mo t)altoioctatopte nvils0 2uoimpno1op nlfeilsf Drrxronu4apxomietatfsDuan snt) ltnmo3ia1omD  nvs t0truoiopoydlle mfvil(f 2tm( p;o0opx mociltls ean o;t4trxrmr3iydopte nvi;t0sexmir iu1amtnlics tfa2umur ;u1aexoiieiys mDel(mo (0arenxf io1fmD  uvslt0texmio iu1op emivtlsfsruau ono0tee ii3iad a2rlnmpnu4artnxf3tytfp rau s (0s2xr(opiudal emietlt  Drru pno4aeeomi3tadlsDulumo (4 ltrmr todfaDean o s)srto(mpiydlmt mietlt aDrax  nu0opt  f3ildfsDrlumo;(0 leoxocoatfm  anvi;s t2to(r3oy4apteliciasfa2tmu p;u1aptnmi3iadfaDel(mont4tlxrir iotopDr u i;s t2tmirpiy1oltemietat  2urx  ;t4ape  i3iysfs ulnmo t)tltomo ia1laD lu s;s s2umio iy1alt  fei t arta(r nt1alt ioetasfa rau snu)aetoio3oy1fm elivslt) exoir iu1apt mieslt)a2trxm ot0oeen i3iad s ul(msn(0aetnxo tadfmDelivi ()sexoxo3nu4lpenmieils  rum(ro;t4apxnmf3tldlm2rlumo;u4tetnxr3oy1lpDeanvi t) rtmio nydoleemnvtlsfsDtrxro;o1tpeomicias s ea( p;u)tltniocoo1fm  ai o;t0truoxm3nudam nlfetat  Durumpnu1tptnioeild s2rm( pn(4 reomociatlpteai sl()sexoxmpny4am  mici tfartaxrooo0oex ifeiyd a umuvonu)texnmo iydlaD  i slt)srtoxmpoodllte iviatf ruaxm ;t1tlt  ietad a rmnvs u)altnmfcoodomD  n o s0setmim iodomenlivsltf rtmumooo4olt  oeilt mDuanmp u)tltnxo3tytoaDeaivi;t  ruriopnu4amtelnct t  rtrumpno1aexnii3iltls ea(vp;t)teeoxf3io1lpDeauei;( sexoiopio4aptnlivt (f rta(mp;u0tlxoifciasfaDuaumsnt) lxnif3io1fp e u i;() rtriopoudolen fctlsfa2urxr ;o4tlxnmoeildls ulu p;(0 etnmr3ty1fpDrlneils0t2toimpiodolenmnvtlsfaDum( pot1olen ociyt m ranvs;(4altomf3iatfm  livslt seto(rpiu4ol  lnci (fs2raxroou0oleo ietyt m2ean on(4tlenxocoatlateaieo t setoimpiudamen nct t sDtrx  ot4aptn iciyt mDem(vp;t0trxriocoodfp   n s t s2xoxm3ny4am  lncsasfaDumur ot4aeto oeils a2rmnmp;(4teerxo oodom rai s t0trxrio3no1apeemfvias s2rrumoou0aexomiciadlaDrlu o u) lxoxo3oatomteanvi;()sexmim nydop e nci t)aDrrum ot4oee  ieils aDrmnvs t4trxomo iy1lp rlueo;s)s2xrxo3oy1al nlfci tfsrtaur nu4aet ioeiytfsDuaumo;u)texrifctadomtelneo ()tetrxopnu4aptelivi (faDraxm ;t4alt mfetaslm rm( s;(0arerxr oydlm  livi t t2umxm iodapee ivtltf Dtaxro;t1tptn oeiyd a2um( s;u)tetnif3oydomD  ivi s teuoxm nu1alenmfvsltf rrrx pou1aptnmietytlmDumump t)alxrxoctatlpDe ivs s0 2xm(r nu1opeemfci t)sDtaxront1oeenmfetydfsDelu s;u0 lxnxr3ia1optr neo;s  ruoim io4lpteliesasf 2uau p;t4tltniictltfm2ra( s;() rxnif3ty1fptelivolt texr(m3nydom  mivilt arrmx  ou4alto o3iydlsDulu on(4 exrir3oatlptrluei s t2toimpoy1lmtnlnvs s  2raxmo;o1oetnioetysfm2ua( snu4aetrmocio1op e iei t0 rtoxr3iydopee nvi (  2umxm oo1aet iieiltfm ra(msnt4tetrxf3ia1lp rlu il( trxr(m3nydomee net ( aDuaxm ;o1opxo i3tld a2em(von(4teeriocio1oat luvo;s sruo(r3iy1opt mnctl( arrr( o;u4alx  octlslaDumuvo t4 lxnxr io1lpt anvi;( t2xmxr no1lmt mnet (farururpou0tet ioetat a2em(vp () lxnir3iotop e iei;(  rxo(mpou1llen iesatf 2rrurpnu4aexo ociltlmDem( pnu0treoxf3oa1faDr nes;t0srtoir3ou4omte icsl( srrmurpot0aeeo octytfs2rl( pnt0 renir3oydfpD  i slt setoio iy4llt lnvi ()aDtrumooo4apto f3tyslm2rmnvpnt0 etoxfciodop elivo;t0t2uo(rpoodllenlietasf 2taur ot1tpenif3iydlaDemnvo;t) rxnmocoa1lm  li sl(0 eum(o3nu1ale  neias aDtaxr ;t4apxo f3ias m2em(mont4 exnxrcoa1omt lnes;s0trxo(rpoo4ll  lfcilt sDrmx  ou4tex mo3iat s2rmnms;t0trtrxr3to1om  lu s () rtm(rpou4lpenlnctlt a2ta(  ;t1oleomocils mDuauvs;()aexomr tydom  ln sl( texrxmpou4al  mfvi t aDtr(mono0tlx moeiadlsDrau o u) eermr to1la   ivols)teuo(m nu1lmtnmiviltfsDtaur no1optnmfciydfm2eauvpn()arxnmr ty1fp  ln i;s)texoxr3iu4om  lictat)sDrauroot0tleoif3tldfsDumnmsnu0tetoxo3oydfmt lneo;( setrir oo1omtnlicils) Dtaumoot0tleoioeildlmDulu on()altoio3oadlmtr nvs;t0t2ur(opiy1lmenlfvias  2taump;o0aeeomfctatls elnvs t4tltrxf3iotomtrai s ()s2trxopoy4amen nciltf 2rrxm ;u0tpt iiciyslm el( o;() eeoxocoodlpDr nvi (0t2xmxr3no1alee ieias) rrr(ro;o4olxo f3ias m uanmp (0arxnxociytom raieils0trurimpoudlm nliviltfsrumu p;u0tlxnif3tad a2rlnms;(4artnioctatlatrai ol()sexoxr3iu4ll n iesl()sDtmurooo4opeoif3ildlsDrm(vo;(0tltoxrctadlpDe ies;(0s2xrio iu1lpt lieta(  2taum oo4aptniociyt a eau snu)trenxf iadlp rauvo;( tetm(o iudop  lfetas srumurp;o0alenioeiytfs2ul(vo;t4altnio tatlpt  n i;t srxmxr oodapenlnvt ()a2uaxrp;o1tltomf3iyd sDumu s t)teeriocoo1oaD aues;s)trurxr iudole lnvsl(f Dumum no4tetomictls m emuvsnu) lxnxo3oa1lptrauvi s0 etmirpoudomt mics s s2rrum ot0aexniictatfs el( o;(4teeomf3oydlaD an i (0s2trxopoo1alt lfcilt)srurxmono1alt mfcildls ra( snu0tlenmf iodlpte ies;( s2toim3oo4lp   fesat srrr(m ;o1teeo fctltlaDrmuvs t4tltoifcootfaD aueo;t  rxm(rpny4lp nmivilt) 2trxmpnt1oetniiciadlm2uanvs;() eeomfciatfaDe nei s  rtrir3iodame lncsl()srrmxm ;o4apx iictlslm2rlu o t4trtnmo3ty1omD ai i;s0 2trirpoy4ame  fvtas srur(mo;u1olt ioetad s uauvo;() eerxocoy1oa eaivsls)t2xoxmpiudlmtnlfvt s)aDumuro;t0alenmietld m ranmonu4 leoio iodfa eluvo t  rxoimpoodlltemnvil(  2tax p;o4ole if3ilsfa ea( ont) exnio iy1op e uvi () euo(o3nu1ape  icsa()a2urxmooo4opeo i3tydfmDumnms () etnio3iytfmD lneo;s0srtoxm nu1optnmneia() Drmu pnt4alt ioeild m uanvs;u) rtrmr iodfp  li i;s trur(rpiodom emicilt) 2umum nu4aee mociltla2rauvo;u4 renxo3tadfm  livo s teurimpoo1ap emfeslt)s2rm( onu4alx  feilsfs uluvs t0aexnio iytoaD luvs;s0trumim oo4am n fei ()aDtr(r no1olto icilt a2emnmsnt)tltrmrcto1om ranei t0 eurim iu4lpt livtls)arrr(  no1alxo i3iatls2em(mp u0 etnmf3iydomDe ues t  rurxopnydlp n nct s)srum(rp;o0oee  ociytls2rm(vs;u) ltnio3tatoa   ies t)t2umxr ny1amt lnesltfs2rrxmp;o1tlt iociatfm2um(mp t0 exnmf oo1oa   u s t0 rtm(r3nu1lm e fvtat)s2rr( pno0aptn f3ilsla2umnvo;t0altomo io1fate uvo;s) rtmiopno1ll  lietlt)sruaxmpou1opxomoctydfa2rau pnu0alxnxf3iodopt  nei;t)t2umir3io4ole  fctat sDuau  nu4tltnmf3iatls ea( o;t4altnxf oytoatranvo;t)srxoxm3ny4amtemici t artmurooo4oetnmoeiadlmDrmnvsnt0 ltnmo oy1fa ranei;t  rtmxm3iudopenlies ( arraxmp;o0oltnmfeiadfs2ulnmonu0tetnif3oadoateliei t0seto(rpiy4al emfvtlsfaDumxm no1tetn fcild a2rmu p u4 ltrxo3oy1fpDeaneils)texrxm3iudapen fvt s a2rmxmp;o1olxomietls m2rau o t) rxnif3io1lptraieo ( setmxo nydlp e ncilt s2rrurooo0optnio3iltlm2rmums;t)areoir3iatfate i o t seuoxm iu1llenmfcsatfa2ua(m ot4alxoioeiatla rm( p;u0altrxo oatomte n i t)s2xoio oudom nlnvias)aDuaxm ;u4tpxniieiytls2um(mo t4teenirciadop rlueo s)sexoxo oo1amtnlivi tfsDtmum ;u4olx ioeilt s umnvp;()arxnifctadopteln sl(0sexoxmpiy1ap e nctatfaDrrxm oo0openmiciyt aDrlu s;u4artoio tydfp rli i;(0teumxrpoy4op  mnvs ( aDumx  no0olxnmi3iadlsDra( s;u0artnxoctadfaD lu i;t)s2xoir iydlp n fci (  ruax ont0aexomietlsls2ra(mo;u0 rtoxocto1lpDrln i (0s2tmio iudlmtelfcsls sDumx o;o0oltomfeiyt m2rmnvo t0alenifciy1oate nvo s  rxrxm oo1ole lnes () rurump;o4tpt ifciyslm2um(vo (0trxnmf iydlm eauei (0 2xmir iu1omtnlfviatfaruau pnt1tpeomieils aDumnvp (0trtnxf oo1lp eln o t  2umim io1lpe mfesa()s2ta(rpnt1alt iocils aDemn p t0tltoxr ta1latrai s (0 2xrxo oodap  mnetasf Drr( oot0tpxnmf3ilsfm2ran o;u0tlxrmo ia1lmDr i ol(  eurio3iydam eliet sf Drmxr ;o1aetnmfciltfaDelumon(4teerxr oodoatrlivo s0 2uo(mpny4op nmnvtl()srrrx pou1oeen o3iad a rl(mp;t4teeomocoy1faDeln i s) rur(o3io1lltemivilt s2rrxr no1tleo feils m eanvsnu0 leoxf ty1fpDeau i t)t2xoio no4llen iesas arum(r nt4ole  i3iatfa2elnmon(0teermocta1op rli slt srto(mpou1aptelivtat)s2rm(rooo4opt  ictlsfsDea(mp t0 lxnircoytlpt lu ils tetrio ou4lle  ici s  rrmx ooo4tex ifetad s uln p;t0aexomrcta1latrli i;s teto(rpny4lpeelfesa(  Dua(mono0teeoii3iytfs ua( o;u4trenxfctodom eli o ( s2ur(mpou4opt  fvtl( s2rrx oot1tpen f3iadfm2ran s ()alenxrctodfa elu i;(0t2tm(mpiy1lpe lnvilsf rrru pnu1olt iociltla uau pnu4 lxoir3iytomtranei;( t2trimpno1omt  ivs (faDtrxr ;o4tlxnio3iat s ra(mo t4trtoxf iytlp e nvilt trtm(opiudoltnmnesl(f Dumxm no4ape  iciysfs2rm(vp;t)teenmrciytomtr ies;() 2tmir3no4ll   nvsltfs2ta( pno1oet  feilslaDulumsn(0 lxoxo totfa   iesls0texmxo3oo4ame micia(farururo;u0olxomi3iltfs2ra(vp;(4aeenmo3oydlm eaivo;() eurim3oydomenmncsl( sDtru oot0tetoio3iytlm elump t0 lxoir3oytomDeli ols)s2umxm ou4alte fctatf 2ta(m ;o0tpt moctldls2emu o t)altriocoy1lmtelnvs (  eurxo nodlp n fci ( aDrr(  oo4oeeomieiltlsDemums u)trenif tytopD luesl()setmxrpiy1ome miesat aDrrxmo;u0tetomietytfa2ua(vo;() ltrxrciydlaDe u il(0trxm(opnu4optelneta(fa2rr(rp;t0tetnifciasfa2rmn sn(0aexnmr io1oaDrli i;s0 eur(o iy1ol emicia( s2uru o;t0ape  fetydfa2um(mo (0 exoxr3to1lm eluvolt texo(o oodopeemnvsl()sDumx p;o4aleo ociasfa raums;u)texrif3todfpDrli o;t0s2triopoo1op   iet (fartr(moot1aptnii3iytfm rmuvs;u)artrif3iatfm r ies ()t2tmxm3nudopt  ietltfaDuaxr nt1oet  fciytfa2em(vo;() ltnmo3iytopDrli i t t2uo(o3nu1lpenmfvtl(fsDurx  no1tlenmicildls2ul(vonu0tlxoxr totfpt  ivslt)teum(m3oy1al   fcs (f 2rru pot4apxo feiys sDranms;(4 rtomf ty1fatrau i;t trxmxr iydlm n fvsa(f Drmumpnt1apx ioeiys m2rlumo;t)altoif3iatoatr ivs;()tetoxmpio4altn ietat)aDraxr nt4teen feiltfaDea(vs t) ltnir tadfm  an s;() ruo(mpoudale  icilt)srraum ;t4oltn i3iydla rl(vs;u)tltrif3tadlptrauvo s) 2xmxr iu4optnlfvil()sDtaxr ot4tlx mociadlaDulu p (4tetoxf3oydfate i i;(0t2trxmpoy4aptnliet (fsDumurp;t4opx  feildfs2rln p;(0trtrmf3todlpD  i o ()t2um(r3nudlpe micsas) 2rax  nu0aptnmiciat m ulu onu4 rxnifciatoaDelnei;(0trxoxo3oy1lm nmnei t arrm( p;u4tlxnii3iadla2eanmon(0arxoxr3oo1oatrlivsl(  rxmio3iu1lptnmnesa(fsrraur ot1texn oetlslaDrl(mo ()aexomo ty1lpDe i i ( s2umimpoy1lle liesl()aDrau pnt1tpxoiictatlaDel(mo;u)tetomfciydfateauvsls0srxrio iodapenlnesl(fs2urum nt4aetn f3ildla ea(ms u0teenmrciytoaDr ivs;()seur(rpio1alt mfeiltf Duaumo;o0altomieiad mDuaumo t0 eeoxo3tadfpt aivo t)trxmim oodopt  fcil( aDrau pnt0tlx  iciatfs2ulumonu0trxnio oa1fa raivi t s2toir oodlptelnvtls  Drr(ront0tetn feiytlsDuanvp;t)arxrxociadfaDeauvi t0t2trxo3nydllen iei s)aDraxmp;u4oeto feildlmDuan s;t0artoxrcoadoaDeauvo;t0t2umxm3io4omeelfvia(faDumxrpou4oetnmictyt a raumont) rtoifcia1lmD an olt0 rtm(m3nudlmtemies s  rtrxroot1olxoiociltls rlu p t) leoif3oatoptrli s;t s2tmxmpnudalen fvils sDrauroou1alenmfeiyslm2rln on()altrif3ia1fatrlues (0trxrxo io1ll eliesas)s2taurpot4altomi3iyt s em( pn(0alxnifciotlmt lneilt)seto(o iydop  lnetas)s2tm(m nu4tlxomoctadfm ea( p;t0teenifcoo1lp eanei s)srurio3iu4lme livilt)aDuau oot1apt mieiytfsDrm(mp;()artoio tytfateluvi;( sruo(o3no4llt mici t)artaur ;o0open ociltlm2eaumo u)tlxoxf3to1fmDeli i;( t2umim nydamtnmnvilt arrmxrpot4oee ifciatfaDrl( p;u0tleomr ootlpDr i i s)seur(r iy4lptnlncsl(  Dta(r nu0tpxnmoeiatfaDrluvont) rxoiociy1oaDelnes;t setmxmpny1llenlnctasfsDrrx  ot4ope io3iadla2um(ms u4tltrxr3tydfpD  nvs;t)t2xrir oy1optnlfesls arraum ou0opx mi3iaslaDrlnvonu0 exnmo3oydfpDelieslt0 2trxr io1om  lietat)sDraxm ;o1tpt iociatfm2eauvs (4tlerxo to1lpt  nvi;t truriopoodlm nmictasfsDtaxm ;o4apxnii3ias aDum( o;u4arerir3todfpDe n o ()s2tmxopoy4ap  lieslt sDtaurp;u0oeeomieiltls2rlnvpnt0tetnxr oodopteaueo;(0teum(m oy1apt lnetls) rua( ono0oee  o3ildfm2ea(vo u4alxnif3ia1lp ranvi;t0srxmxo3oy4openlict tfaDuaxr ou1aex io3iydlaDemu o u)texrxrcoy1faD livilt seurxr iu1amte fvi s)aDtrumpoo4tpt ifciad m2uluvo t4 rxrir3totlp rlu s;( texrxr io1lme  iciat  2uaump;o4aetnmietasfm2uan pnt4 rxrxrciodfm eln o ( s2tm(m3nydapeelnctls) Drr(r ;o0olxo fciydls2rm(mo;u0 lenxfcoodoat ai i t0tetr(mpnodalee neilsfaDua(r oo0olx micildlsDrlump u0 lerir3ta1lat lnei;t0teumxr no4opeemfetl()aDua(root0tlxn fciltls rmuvsnu0aexrxr iatlmDranei () 2tmxr3io1olt lnet () ruau  ;t1optnio3ilt a ulumpnu4trxnir iatfp elieo;t)seumxm oy1openlfvi t  Dtr(mpnu0optoiieilsfaDem(vo;u4aetoxoctatfptr ies ( s2tm(o iu4aptnlfesls)a2tr( oou4tpeomoctldfs2elnmo (4 lxnxo ty1oat  ues;t)trto(m oy4apt mfei s sDra(mo;o4tleoif3iys m ul( s;u)trtnmr3oatop rln s;()truoir oo1optn
\ No newline at end of file
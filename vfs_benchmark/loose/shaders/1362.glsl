@@ -0,0 +1 @@
+neils)sexr(rpnudlmtemnetls)srum(mono1tpxnmoctatfm2rmn pn()trtrioctodlm eau i () 2umxo nodolee ieiatf rrm(r nu4tlt  f3tlsfs raumpn(4aeeomr oo1om rlivslt  rxrim no1aptnlfesl( sDur( o;o0tltnmictltfs em(vo t4 rtnif3oa1lm e u s;t)t2xr(o3oo1omte ieia( srrrx oou0optomf3iys m ran s t4 rerxf3iotlaDean ilt)srto(opio1ll  lfvsls) Dumu pnu4olenmiciytlsDrl(vo;(4trtnmociatom rliesl() rto(opiy1ll nmivsl(f rum(rpnt4olx mociad a ra(mo;() exomo3oadop r u ols0srxmio nu4openlfcs tfa2rmxm nu0apxn ieiatla2eau p (4teermociy1lmDe ieo;(0srxrio oo4lpt lfciasf rua( poo4aexo iciydfmDra( p;t) etnxr tadlmtraueo;s  2xrim3oodapenlfcs tfsDra(r oo4opxomoetatfm2rlnvont0artrmrciydlpDr ivslt) rxrirpiu4ll  mnetlt srrax  nt1tpxnmoeias m eau snt0alenxfcoydom   ies;t) ruoir3iy4ll  livsatfs2rrx pnu4optnmf3iydla2ea(vsn(0aexoifcoadfmt  ueols0 2tmxo oodaltelncsas sruaxr nt0apxn fciyslmDrl(vp t4aexoxr oadom   u o;() ruoio iudome  nesatfa2trx pno0oeenii3iys sDrlnms u0 etrmrciadlmDe ues ()t2uoxo3iodom   fei (  Dtaumo;t0oexo i3ilt mDrau o u)teeoxr3iytfmteluei t)t2urirpno4am e nctls)srtaxrp;u1aee mo3iltfs uanvpnu0aexnxfciotfm r ivils0teumirpou4optelnciat) Dumxrpno4tpxnmoeiydla2rauvpn(0texomfcta1opDelivilt0 rxoio oodllte ivtlt srrm( poo4olxo feiadlm eln snu0trerif iotoat  ieols)srtrxo3ou1aptn ictas) Dur(  nt1aexn oetld m el(mp t0 rtnmo io1la rlivsl(0trurio3iu1oleemivi t)arrrurpou1tpe  o3tld sDulums;u)artnxf iadlpt  i s;t srxoio3nu1om  liesasf 2rru  nu1apt ifciytfa2umuvont)aexrmo totfmD auvslt0s2xo(mpny1ol nmies t sDtrum no1altoiociatfsDelnvs u0 lenmrcoa1om eli s;s)s2ur(m no4lm nmnvtlt)aDur(rpnt1aptn i3iytfa2elnmo ()alxrmo oydfmDr neo s)s2um(m iudapenlivsat  rtaxmono4ope ii3tls sDulumo;u0tltrxfcoodfptelies;t0teuo(m nudopenlnesatfs2tr(m ;t1tpt  iciaslm ua(vsn(4 rtnmociydop  lu sls)texoir iu1alt lncs t)a2rr(mpnt0tpeoifcilsls um(vs u0 lxnxf ia1oatr iei;(0 rxoxr oy4am e icsl( s2ua(ro;o0aptomoctyt sDea( p;()trtrmr todfm ean s s  exo(mpnudom nmfei s a2umx o;o0tptomicild aDumuvonu)trermo3oydfatrluei;(0trtoiopnudomt licilt)aDuaumo;o4alxnmo3tldla ul(mp u)aetrif3iytop eaies;s0sexr(r ny1ll  lfes t)sDtaur nt1tptomi3iysfs2elnmsn(4tlenmo oatfmtraueo t0s2tr(r3iydole livi t  2uax  ;u1ole iiciatlmDemuvp (4aeermocoy1fp r ueo;(0tetmim nodome lfvta() Drmump;u1aeeomo3tld s2uanvpnt0 renir3oa1fp eaneo t0srtr(opno1lm   nvils s2rmurpno1openmfcildlaDrl(vo;t)arerxr to1fmD lnvol()sruo(o3nudolenmnvilt) rtmx  no0aexnifeiad aDuluvp (0alerxr ty1fp eli sls  rxoim3no4ole licslsfsrtmum oo1apxn oeiyt s umu s (0texrio ty1lpDrlieil( truoxr oodam   ncs t)srumu  ;u4apxnifctydfs emumpn(4 rxoxfcoatopDean s;s0t2umxo iy1ome mivslt  rurx  ;u1aexnioeiydlmDuaump;(4 rxnxfcoy1op e ivsl() exr(mpiydam elnci sf Dtau onu0alx mi3tydlsDean o;() rxomr3ty1fpt lueo s) 2tm(o ou1apeemfcsat s2ururpnu4tlx  ieiyd sDumn o ()arxrifcoa1fp e n i;()srtmir iu1apt mnvtas  rrmump;o0aeenmo3tadlmDraumo ()trxoiocootlm   n ils) euoxrpiy1optemncsls  Dtrx o;t0tlt  fctlslmDra( s;t0teenmocio1opt ln o t0teuo(m nu1lmtemnesltfaDua(r nt4opt  i3tldfsDrmuvs;u0arxomo tatopD au s;( tetoimpou4amt  ivs t)s2rrx  no1olt if3iytfs eaumo;t4aeermf3io1optelneo;t0trxrxrpiy1lpte ivsa( srtrxroot4oeeomo3iltfm eluvo;u0aetriocoadoa raivol()t2trio oy1olee ivslsf rurxmo;t0opx ifctldlm2ulnvp;t)artoxf3oatlm r uvs;t) exmim iu1llte iesl()sDraxronu0texomocils m ean pnt0 rtnxo3iydlmtrln olt0tetrxo io1opt  ietas)srtmxrpno0aeto ociasfsDum(vont0tetrmr3oatfmt auvo (0 rtriopoo1ol emnvsa(fa2rr(rpnu0aexomo3ild m2uaums;t0 eenmo todlate nvi s)srumio nydomen nvslt aDuaurpno1aptniicias s2ran p;u0tlenif iy1oat lnesl()t2xmio3ou1alenlnvtlt a2raxro;t1alt  o3iatlmDraumo;t)trxrif iy1fmtrauvs;t trxr(r oudomtnmfetlsf Dumu p;u1olto f3tltlmDrmums t0alerio3iy1fpD luvs;t)s2tm(m oy4al emnetat) Dtr( ooo1ole  fctat sDem( ont4trtomocoydoat livo;s srurim3ny1aptnlnvt (faDtaurp;u4aeenifctytlm em( sn(4aexoio3totla  lnei (0trtmir3nu4lmen ies ()arumumpno0olx  f3iad a2eaumon(4arenmr iodlaDrai i t0srxm(m ny4op nmnei t sDtmu  ;o0tpe  ictldla umums;u) renmr tadoaDelivils)t2toxr3iydlp emici ( sDtru pno4apt ifctasfm2emnvp;t4aleoif3iy1lat anes;( s2xoimpoo4omt  icil(faDrmx pot4oltnmfeils m2uln o (4tlerxr3oatfm eli s s0trxmxm3oy4lp  licsas srtr(  ;u1aleo octlslaDran o;u4trxnxrcia1la rluvi;t0t2umxrpny1lme mncs sfaDtaump;t1oetnmi3ilslm2um(ms u)trxrxfciydopt li s;( sruoxm ou1optn feiltfs2tmxmoou0opt io3ild s eau p;t0aexoio3iodfmt lu sls  exrir3io4om nmnviltf Dumxr ;u0altn oeilsfa ulnvo;t4tlxrmrcto1fm ranvi (  2tmxo3oodlpeemiet ()srumx pnt0aetoioeildla ul(vsnt)aexrif3iy1lpD au o;() etoxr3nu4lmtnmfci t aDur(mpoo0aeeomfctadlaDemn o;u) lxrmf oadop  lueo;t  rxmxr3ny1lptnlfesasfsrrr(rpou1opxnifeiyt aDuauvsn(0aexomr tydfpDr n i;s)s2trxr3oo1omtnmnvtls  2rmxmoot1altniictltls2uanvont4alenxrciy1fpte ivols  eumxr nu4ope lictasfaDrm(m ;u4tetoio3ilslmDuanms;() lermrcoo1oa  anvol( t2to(mpiydoltemnvils a2urxmont4teeniictysls2rlumpnt0 lenif ta1fm r ieo;s) 2trio3nu4amt miet s  rtmurpno1optn fetys sDemums t4 rtnif3totfm   uvs s) rtmio3oudlmeelfctatfsrtrurpou4oetnif3ilsla eln s u4tetnio3ia1opDrlneolt teuo(opnodoleelics tf 2rmurpoo4opt mieiys s ua( s ()arxoif iadfm e ies s0setoxr3oydolen ivta()a2umx p;o4tex ioeiys s ranvpnu4trtrxf ia1lm eaneils0trtr(opnudam  lieils s2umxro;u1olxnio3ils m rluvpn(0aleoio oatlp rlnvi s)srumiopiu1lp e fcia( sDrmxmoou4aeeomfciydls rluvsn()tlxomr3oodfa e ivs s) 2urxr oydap  lncs (f rurxrp;o0tetomfciltfs2eluvo;(4tetnxfcoatlmt aueslt0setoio3iudomtnlivsasfarrr(r ot1alt if3iydfaDum(vsnt4aeerxfcto1optrln s (0srxrxr3nudomtemictls  Duax  ot1tle  ictadls um(ms (4tetrmo tytlpteanei;(0 eumxo iu4al nlnctatf Dtmump;u1tltn iciadlmDuanms (4 exomf tatfaD lneo ( tetoxm ou1optemneil(fsDumur ou1ope  fciasfm eanvs;t4treriociotoaDrauvi;() euo(rpiu1lpenmfcia( srumxrp;o4oltoiieiyslm2ulnvp u) lxrmr3iadfptraues;t  rur(r3iydomeelncs (fsrumxrooo4tpx mo3ilt a2el(ms u)altnmf3tadfa   nes;()seum(r iy1lmt mfet t)s2umurooo0olx mociasfa ranms t)tetoxrciadlatr i olt) rxmxo iy1om nmneslt  Dra( p;o0oexnmictld s2rlums;(0trerif oodlaDraieo;() 2uo(m iy1opt mfvsl( srtrxrpou1aeeo f3ildlaDulnvo;() ltnmo ty1oatrln o t) eto(rpio1lpenmnvs ()s2rmu ono1tee mfeiyd a2ulumsn()tetnio3iodopD anes (0 2xm(o3nudap  lfesat)sDrr(m nu4oetnmoeiltfa rlnvs;(4 eerxo iydlat  n o t  etrxo3iodamtelictl()s2umumpoo1tpeoiocildlaDrlnmo;u0tetomrcty1lpD lueo;t)srxrirpoo4ale miei s) 2ua(m nt0oex mo3tlt a em(vp ()texomr3oodom rai o;t teuriopou4ape licsls) Drruroot1texo oetldfa2eluvp;(4trenxf3ta1lateanei ()s2to(rpiy1apt  fvs t s2rmumo;o1olen fetldfa ulnvs;t0alerif oo1opt lu o () 2xrio oodomt  fctltfarraxrpno1teeo oeiysfs umuvpn()teenif3iy1fpDrluvo;(0trumim ny1ale mnci ( s2umxr ;u1oltoiieiytfm2ra(vp u0 exomrcoytfp r ueolt) rxm(m ou4lp nlnvs tfartaum ;t1opeoii3iytlsDeanms u)tlxnir ta1lptelu i;t) exrxmpny4ole  fcslsfa2tr( o;u1tex  fciyd m2em( snt) rxrmocoodoat au o s0 rxm(o no4om nlnesa(f rraump;o1tpen i3iydls2eau p;(0tltnmr3oytlaDrliei;s0srumim nudop emiesl(faDrau poo4aptoiociys s eluvo u0 exoirctatlm eauesl(0srtmxopoo4ame  fetl( sDua(mp;u1teeo o3tlt sDem(vpnu0aeermr3oa1la rau sls) exoiopou1altemnvtl()aDtrxront0aptoio3iatlaDeauvo;t0alxrir3tatlmDrli olt)teuoim iy4amt  ivias s2raxrpoo4tlt mfctytlsDumu p;t0altomo3oatfmtrau i t srto(o3iydame  fvia( aDua(mono4optn ociytls eauvs (4tlenxrciotlmteanvo s s2xm(m3oy1opt mnei t sDua(ronu0opxnmfetysfa2ua(mp u)tlxoxf io1lpDe n o;t  rxmirpoudlptnmncil(  ruaumpnt1aleo feiydfsDelumo ()artrxf3iodfm ean ol( texmirpoo4apt mnvslsfartrumonu4tltnmfetyt mDrau sn(4arermr tadopDeau ilt0trumim ny4al elnvs sfsDrmx ono4olx  ociatla umnms;(4tlerxfciodlatrlues;s setmxm ny1lmenmnetls s2rr(m ou0opt ioetlslaDrlu o;(0 eeoio3oo1oatean i s)t2um(opnydopte fciat a2umxrp;o0tpe mo3iltfs2rmumo t0 rxnmoctodfa  lnvi t0tetoxr3io4altelnvtlsfsDtru pnu0apxn ieiadla ulumpn()tetnxr3oydlpD luvols0sexoio3oodll emieia() Draxmpno0altoii3iydlaDumu s;u4texnxr3oa1lmDe neo;(0srxrim3oudaptnlncils  ruru p;t4oeeo fctltfm umums u4alxoxoctytomD  neolt0t2xrio oy4alt mictas)srum(rpou4olt  octyd m2ranmo;() eeoxo tytoaDr nesl(0trxoirpoo1optn fct sfs2urxmonu4apen ieiysfm ra(vpn() reriocto1lmte n s t trur(opno4ll elfvtat  Dumxrpoo1alt miciytfs rauvpnt)trtoxf totlat lu i t)teumirpoo4lm nmnvtatf 2tmx pno4apenii3iytfa2elu p t)aeeoxrcio1laDranvslt teumxopiu1op e ieiatf rur(rpno4tlxoio3iyd mDuaumpn(0 rtnxo3iodoat  uvolt0setrir ou1om e nct (farurxmo;u0oex  oetydla eln pn(4trtnxf iadfa   ues;t)sruo(m nudopt lict s s2ta(roou1oee  ietltfs2rm(vo (4tlxomocootlmD  neo;s) 2uoir3iudapeemfeia(f Dtmurpoo1tleoiiciyd a ulnmpnt)tetoiocio1fptrln o;()texoxopno1optnlfei t) rtaum ;t1aex iiciydfaDemumsnu0 rtnxo3to1omDr nei s) euo(opiu4alen nesa()s2rmxmo;o0alen ociyd m rlumsn()alxnxrciodla eauvi;s  2xm(o3io1lme livsasfsDtr(roou1ale iieiasfs ua(vp (0 ltrio3io1fpt  uei s)s2trxm3oy1oleemfci t)arrmxr ;o4tet iietls s rlnmo u0 etoio3iodoaD livo;t0 rxr(mpnu4lpeelfci (fsrrr( oot1olt iietadls2uanvo;u0texoio ta1fp  aivs t srtr(m iu1opee fcsasfsDua(mooo4oeenmociys aDra( s;t)teerir iodfm eaueo s)t2trxr oudlptnlici ( sDuau p;t4aptoiieildlm rl(vo;(4arxoxo3io1opD au sls0 rumxopnu4lp  lneil(  2rau  nt1oexn i3tldfs ulnmont)texomr3oatlpDr nvol( trxrxr oo4om elicils  Dtrxm nt4olxn feilt a2ulnmont4areoxr iatopt lieo ( truoio3no1op emnes t)s2ra(ro;t4tptoiietlt mDemn p u)treniocoadlmDrau i t) exm(o3nu1aptn netas)srtmu ono4oetoioeiltfs2um(vp;(0tltnif iytlptrluvi t)srxr(m nodol  mictlsfarra(ro;o1altomf3ildla2eauvpn(4artoxf io1lmteaivsl(0sexmio iu1apenmicias)a2rr( oou1tpt ifeiys a2rlu o;u0areoxfciytlmtran o;t seurio nudomte ics s)sDumu  nu4olen o3ildls2rlump (4texrmf oytoaD aneo;s t2trxr iydome micsltfsrraxr ot0apx mfcildla umuvpnu0aeeoir oadfatrli ol(0t2trir io1lptn iesls)s2uauro;t4tlxoifciasfm rmumo (4 renxo3tydlmtrauvs;s0 etm(m3iydlptemivsls artru  oo1tptnmoetydla elnms;(4artomf3oy1fmDe nei;s tetrio3oy4op   fctls)a2umxrpoo4ope mfciat aDemnvonu4tetomr oatfa e nes;()texrxo3ou4am emncs sf Drm( oou0alenmfeilsfm2um(vo u0 rxnio3oytlm r ivols  2urio ny1ole lnesat)a2rrxr no0tlenmo3iyt s2uln o ()aexnmr ta1lmtrauvilt)trxoiopiu1om  micils  rtaxront0opxniieild sDrauvsnt)trxnxo oo1opte uvs s0 2xmxrpiudomt lnci (f ruauroou4teeniictysfsDrmu p;t4 exrmfcto1fpteaues t)setoxrpnu4op   nci () 2tmump;u4tleo ociad s rauvont0tltrmr oadlate ivs t s2urxm nu1oleemivsas  2ra( oou4aex mfetadlaDumu o () rtnxf tydlpDrlu ols setmxo oo1op emncilt sruau  ;u0tlxo oeildls2umnvo;u0artoxf3tatlpDe uvi (  exrxrpoodaptnmietasfaDumurono0altn i3tyd a2emnvp (4trtoxr3ta1latranes;()teumirpiu4lmt lfvtls) rua(m oo0tpt mictyt m rauvon(4 exrxf tatfa eanvols) rurxo3io4aptnlieta(farta(rpoo1oee mo3ils a rmnmp;u4trtoio3oa1lpDeln i;s0seur(o io1lp elnvsls artm(roou4ape micils s2ua(vp;t0 ltrir3oadoa   nvo;t)srxrimpnodllee nvsasfsrrmxm ;t1tltoiicildlm2ulumsnu0 rxnifcoodopte uei s0 2uoio3oudlme lfvi t  rtau p;u4oeto ietlsla em(msn()aetnirciotfpD auvs;(  eumir iy1apenlnctlsfa2urumoou4altoiieild m ulu o;u0arenmfciadfp   n o t t2tmxopoo1opee fcta()s2ta(  oo1texo i3tas m ra(vs;u)tlenmrcoatfpDraies t) 2trim3oo1ap n ieils) rtr(rp;u1olxo o3tytfa2rlnvsnu4tlenxrcto1fa eluvo s) etr(mpiudaptnlfci tfsruaumpot0oeto ocildfa emu o;u0artomr tytfp rau s;s  2ur(m oo1lp n feiat aDtm( p;t0alen fctydfsDrmuvont4trxoif iadfa  aieo t  ruoxo iudalt miet t aDrmxrpnt1tlxniocildfm rluvs (0 etomf iy1fa e ieils0texrxm no1ll nmiet (fs2urxr nt1opx ifetld m emumsnt4tetomrciotfp   ivs;(0 eurir no1om emieilt arrax  ;t4tlxomi3ias s rm( o u0alenifcto1fmDelnvil( srxmio iu4omt  ictlsf rrmxmoou0apxo f3ilsfa emump u) ltnmf oytom  ai ils teurxmpoydal   icsat)sDumurp;u4oee  ieilslm2ra( snu4 lxomfcia1lp rluvilt0s2trimpnu4ope lietlsfa2trumo;o1aeen ieiys aDel(ms u4 eenir oy1lpDe uvil(0tetr(r ny4lmee fcs s  Dtmur ou0olx miciatfm rlumpnt) etnxfcootfaDr i o;t srumim ou4olenliesl( arua(m ou1tltnif3tatfm2rmnmo;u4areomr3oydlatean s ( trtoxopiy1lptn fes (faDrmu p;u4tee  i3ild m2rlnvont)trenmoctotlp  an s;t trxm(o3oy1olt  nei t)s2tax p;t0oex  fetls m ul(vs;(4teerxf oytfa rlu ols seurxr3iu4lptemici s)s2tm(mp;u4tpeo i3iysfa umu pnu) lxrxf iodopDe u i s)t2uo(m3no4am   ietlsfsrum(m nu1tltoiieiyt s2rm(mp;t4arenxociotoaD livi () etm(r iydol nmfvt tf ruaxm ;o1tpx  f3ildfa2rluvon(4tlxrio3iy1lpt  uvi s0 rtr(o no4ope mfvi s)s2uaxm ;t4tleoifeiatfs2uluvpn(4texnif3tytop ean s;t t2toxo3iudllee fes ( s2tm( ono1aeeomietytlsDrluvp;t)aeeoio ootoptr i slt)t2xr(mpny1al nmfcsa(f Drru p;t4oetomfeiltlm ean onu4 etnifctadomtr ivsls)srxrxopnydlmen iesls s2uaur nt0opx  f3ilsfa2uau p;u4trtoifciydlaD  i s;( truo(r oo4om emnvtas aDumxr ;t4aetn i3iat s2eanmo t0teeomr tytlpDeaiei t  2to(m3io4lpenlneia(f Duaxm nu1olen ieiltlmDem( o t) exnircta1lpte u i;()srxoirpoudlp elnvias)a2rrxrp;o4teeoioctadfsDem( o;(0alxomfcty1lmte i olt) rxrxo3ny4altemneil()sDua(ro;o4aex  f3iydls2rauvo t0trenxocia1lm e ivols)setrxm oo4ape  ncsat arurx o;t4oee  o3tatls ul(ms;u)aexrmocoo1lm rlivslt0srurxr3nudop  lncs (fsDrmump;o4alto ietat mDuaumpnu0alenxo3todfm ranvi;() 2ur(r oydll nmivia(f 2um(mooo1aeto f3tadlmDemuvo;(0tlerio tytop eln slt)trxrxm3iy4apeelnetl(  rurxm oo4tpe iieils s eauvsn(0tltrxo iydfp eai olt teuo(rpnu1lle lics s sDrrump;o0alt ifeiltfs2el( pnu)tetoio3oy1fat anei () rtoxm3nydom e fvsas)aDumurpou1ape ioeiytfa elnmpn(0arxrif oodfateli ils)trxrim nydlm n nvs s) Dtru oou0texomf3iys mDumuvo;t4alenmrcta1omt  n olt s2xoxmpoo4optemivias)a2uaumoot1aptomi3tydfm2rm( snu0 renmfciadfpt luei ()teuo(o ny1op nlnes tfs2trumo;o0aleo ietlsfm2el(mp t4artrxo io1op eaieo ()t2trxm no4lmtemfeiat  Dur( p;u0aet mictldlaDrmuvp;t0trermf3todfaD  nvo t0t2xr(o iu1lm emiesa()sDtm( p;o4tpxnifetas s eauvo t0alermfctydom r ueol()srxm(o3nydam  mfvs t)aDrmurp;t0tpeoifeild s2ran p u)tltrxo3tydfp elivsl()seurim oy1oleemneilsf rum( poo4apxo i3tld s2rmuvsnu)aleoir iytop   nvo;t0teumim no4llenlieil( artmxmont4apxnii3iatla2emn o t4arxnxo3tatfmDeai s s)t2umxo iodalt lfcsl(f ruaxmpnt4olx  icild sDuanms u)tltnxr iy1laDeanvi s teumxm nydlltn fci t srurum ou0tpe  f3iytla rm(msnu4 ltomf3oadlatr ivs s)trxo(opnodopeelnvilt) Dtrx  ;o0opxoiociytfa2uluvo;t4tleniociytfaD  u o t0seurxo iydlmen fct tfs2ua(ro;t0tet  oeiytlmDuan s u)alxrxo3oodomt anesl( trumimpny4altemnvtl(  2rau  ot4olt mfctltla umuvpnu)tlxrxocoy1fm rlneo t)t2umxopny4omt lieiasfartm(  ;t0ole  o3ilsfa uanvs;(0tlxomr3oo1laDrauvolt sexr(r3io1lleelnct t) rtmx poo4aeeoiiciatfsDulu p t)texnxfctydlp  liei t0 rxmxopnu4ame miesa(fa2urx p;t0tle  fcils aDean p;u4aeerxf3oadoaDrlneil() 2tmirpoydop nlnvt sfartrur no0aetoio3tydls emn snu) ltnxo iodomDr iei;(0srtmim oy1ll  livs tf 2rmx pot1optnmi3tas aDrmnvpn(4aeeomr iodoate uvol() etmxo3ou4ap n fetat) 2umx  nt4optomociyslsDel(mo;t)tlenxo3io1opDranvsl()teuo(r oudameemictl(  2tmxro;t4tltoiietyt m2umuvp u0areoiocoydlpD li o s srxrxo nu4al n fcs ()srra(rpot4oleomfeiysfa ua(mpnt0texnxrcty1fpt livo t0setmirpnu1lpee fvsat srumxmont1tex moeildfs ulnms;(0artrif3oatlp rlnvo s) rur(m3oy4lpte ncilt)srtax  ot0tltn fcils aDrmumonu4altomocto1fmteaieo (0s2xo(o3nodlltnmivi s)s2raxmooo4tltoio3iltfa eln sn(4tetrxoctodfm  auvol()s2xoxrpiy1om n icias)sDrm(rpno4tleoii3tydfa umu s u4trtoxo oa1fmtrln s s) rto(rpiudll nmncsas s2umx oou0teeoiiciyd sDem( p ()areomr3oy1lm  ln o;t srtmxm3ny4lleeliesa(fartau pno0apeo o3iaslsDul(vo t)altrxrcoo1omDr nvol( t2trio iudomtelnvs (  rtaurpnt0aptoifcias aDra(vs ()tleoir tytoatrauvo s)seumirpoy1lpenmfvtat a2rrxr no4tetoifctatfmDrm(vp t4aleoiocto1fm  lnes;s) etoxopnu4lmt mfcil(f 2rm( poo0apt mfciysls el(vo u0aetomo3iy1fatranvs t0 2trxr iu1lmt mncs s) rumump;u4tpt  f3iydlmDua( sn() leomf totlpDeluvi;t0 exoir3ny4oltnlfvsat  2rmur ot1alt  o3ildlaDel(monu0altrmf3oytfmt luvo ()srxm(o iu4ll nlfcta() 2tax pou0aptomi3ils s ranmp;u0tltoiocoy1oaDr u sls s2tm(opoo1omtemnvtat sDua(mpoo0aetnmieiydfa ranmo t4tlxrxo iy1fp   nvsls)srtoxopiodapen ncil(fa2rmxmo;t0olx  o3tasfa eau o t4aetoir to1om e n ils0teurim oy1lm emfvsls artr(rooo1alto fetatfm rlnvsnt)alermr oodomt lnes s)srxoxo iu1lm  mfcs s sDtaxmp;u0apxo ieiytlaDrlu snt)aexrmf3tydomDelu i;()srtoir3iy4lleelfct tfa2tax o;o4altnifetlsfm ea(vo;u0aeerio3ta1oaDeauvols)srtmxmpoodlp n fvta(f 2ra(m ou0optnmf3iyslaDul(mp u)alxnxf3tytlmDraivi;s)setm(rpio1ll  lfeiat)srtr(moou4aet ifciatfmDuluvo ()trtnmo todlptr u s;t  eumxr oy4ol emfeils) rrau onu4tpt io3iad s em(ms;u4arxnxrcoytlaD livi;s)texrxo3nudopen fei (  Dtau o;u1alxo ieiatfa uanvpnt) lxrmrcoadoa rlues (0seuo(o3iudopte ici (  2ururo;o1opeo feiyd m2rm(vs;t0aetrmr3todlpDrau i;(0t2ur(mpny4al n netlt aDrru pot4tex iocils mDea(mp;u0trtomo3oytfp eaivo;t trtrirpoy1op nlieils)a2tru  no1oee iocild m rmnvs;t4aetrmf3ta1lp  li o t)tetoxmpny4aptnmietl(f Dtm( ono1oee  icilt a rmu on(0aexoxo ia1fptr n s ()sexrir3iudamenmivs (fsDta(r ;t0texoifeilsfsDeau p;(0texnir totfptrli s s  rumiopnudameelfeslsfartaumpot4alxo fciaslmDrmuvo;u0 ltoxr oa1lpt  iesls t2xrir3iy4ole  fvsasf Dta( p;o4aee mi3ilsla2elnvo (0 rxoir ia1fa  au s ( truo(r nydapenmnciltfs2ra(ro;t1olxomf3tatls eau sn(0alenircoa1fmDeauvs;s  2xrxo nu4lle lfet (fartmxmpnu1altnmf3iatlaDrlu o;t)aeenmo3to1fpDran ilt trxmxr oudam emfeslt) 2tmu  oo1olxoifeildfm el( s u)trenif3tydlaD anvolt)sexmxm3iu4lptnmivs tfa2umxrpot0apxomoctadlmDumnvp (4trerio3oydfm eauvolt) rxo(mpnodoptnmici (f rum(r ot4opxn o3tydfmDraump u4 etoxr iatlaDeaies;s) 2tm(o3no1ale lnetasfs2uau  ou4tpeomoeiys mDrlnmp;u0 eerirciadopt luei t0setoxo oy1omt livt () Drmxmpnt0optomietyslm rl(msnu4trtnmrciatfptrlnvi;s0sexo(r iydam elieia(fs2rmur ;o4oltomfetlt a eanmp;(4 rerxf3todlp  anvs;s0t2xo(r3nodoptelfcs s  rra(rp;u0tetn i3iyslm rlumsn()arxnmfciadfp  ln s t0 eto(opiu1altemncia(fs2trx pot4olt  fcilt aDranms;u4 lxrxf3iytlat luvi s)texoio3ny4op  lfcs t)arur(m ;u0alxoifciyt s2ul(vp u)tltoir3iy1op  aivi;t sexr(m oy4openmfciat  2rr( poo4opx iieiad sDumn p;(4aetrmocoadfa r neol() rurxrpou1om e net t)artrxroou0oetniociltfa2ul( s;(4tetnmfcoytop raieo;s trxoir nydaltn fcsltfsrur(m no0tet  o3iydfaDrlnvon(4tlxnirciatfpDraneol()t2xoxm nu1lme lieils aDtrxrpou1tlt ioeiasfm emums;t)teeoio3io1fmDelnes s)teto(r3iodop e fctatf rtax poo1tetomfcias aDranmp u0 lenxf3iodoptrauvo t)sexo(r3no4amen fcsa( s2rmu  ou4olxoio3ildfm uln s;t4alenxr3todopDe i slt) 2toxm ou1altemneil()aDrr(m nt1alxoiociad a2ea( o;(0aeermf oa1fa ran olt0srxmxmpoudaptelicsl(fartrxmp;u1aexnmf3tadfa2ua( pn() exoiocta1lmtr nvs () etmxm3oy1llt lnci ()sruaur ot1opxo o3tat sDemu o t)altoxo3io1om rai o;()texr(o oy1altelfvta(faDumu oot1oetnio3iytlm eauvo u) lxnmrcoadopt anvs;t0s2tmiopiydlm   ici (faDrmurpot1tetomfctad a rau pnt4tlxoxo3iatopD lu s s0 rto(r3io4op emfetlt a2tm( o;o1opt  icildfm eanvs;(0 lxoircoo1fm elnvs s)s2urir no1apt lfeils a2tmuront0oleomi3ilslaDelnvo t)trxnmfctatom  livilt  2ur(m oy4ap nmnvtlt artrxr ;t0tlxnifeiadfm2emumo;u)alenifcoo1op r ivo (  etoio ny4opeemnci t)arum(mp;u1aptnioeiys m umnmp (0arxnxfciy1la eai o;t0srumiopiodlmt  neta(fa2uru pnu4apen ictas sDumnms;u4trtoir3io1lateli i ()trur(mpoy1op  lfvi () 2tmxrooo1ale  oeilsls2ea( p;t0teeoir ootfpDrlnvo;(0texrxo oy1lp nlfcsa()s2rrx  no1olt mf3iad a umnvsnt) rerio3tatlmDr nes;s)s2xr(opnudamtemivi () rraxrpot1apxn ociydfa rln p;t0tlerio tydopteaivil(0trxoir nu1opee ivtls arumu p;o1tlen fctlsls2ulnvo t4aleomf oatom rli s;(0 2xrir3iy4lptn ncilt srum( oot1alx  icildfa elnmp;u) rxrxo3iatla   nvil( teumirpnu1ope mnes s)aDrrum nt4apen fciatlsDra(vs;(4trermf3ty1lpt  nvo;(0 2xmim3oo4lme  fcsls a2ua(  ;u4apt ifcildls eauvs;(0tlenirciodlp  ai ils  rxm(r nudll  lfeias) 2tmxmpot1teeo o3iyd aDrm(vo (4areoxfctotop raivols seumxm iy1omen fvil(  rumxm ;u0tpt  iciys sDrm(mp;u0arxrmfciadomt an i;()seurir3oy4apenmnei t srtrumpou1alxoifciltlm elnvon(0 exomocia1fa  auvs ( setm(m iy1lle mnei tfsDra(rpno4olt mo3ias a el(mpn(4aexnxr3iotfm elivolt0s2tmir3ou1op nmnvsa(  Durxm ou0apx mociadfa raumo u0 exrxrcia1laDrli ol( trxmxr oodomt  ietltfsrra(m nt0tetomi3ildls uaumsnu)aetrxo3iatopDeli ol(0srxo(r oy4ape lictas sDrr(r nt0tleomfeilsfa2rmumsnt0texomo oa1opD  ies s)srtrxr3oy4lme mnetlsf rua(r ot1alt miciltfa2ul(mp t)tltomrcootlmDeauvo;t  exrxm3iy4llt miei s) rum(rp;t0tpenmfcias a2emu s;t) lxrxr3oodom   uvs;( s2toirpiudalenmivs s) 2umumpot0apxnmf3tydla2ua(msnt4aexnir oydoaDraues;s)t2xm(m3oodlmtemivia( a2rmxront1opxo o3tyt aDrmu o;t)artoxrciodop r ues (  2umxm3iodlm e nes t  rur( pno0texomo3ias m ra( o;(4aexnxfcoodop rlivo (0 rtmxopny1optnlnvtasfsruaurp;u0aptn oeiyd mDem(monu0artnir tatoptr nvil() rto(mpiy1omee ivi t  rurxr ou4tpenmfcilslm2uanmonu4 etoxr3iotlm elu s s  ruoxopoudaleelfvta(  rtru pot4oee ioeiytfa ua( s (4 ltoxf3to1fmt lies;(0t2xo(m nydlltemnvs (fsruaxro;t4oetniietltfm2uanvp ()tleoxf tydfmtrai ol(0teurio3oudamt  nvsls s2umxrpnu1ape ifetadlmDumnvpn()arxrmr oytlpte nvs;s0 2tmio oy4amt  fviatfsrururp;o4olx  o3tys mDranvp t4aexrio3oydla e ieolt t2umimpiy4lm nmnvils)aDtru o;o0tpt  oetysfa eaumon(0arerir3oo1lmtraieil(0t2tmir oo4apeelneil( aDrm(ronu0opto fciadla2umuvs (0arxoio3oytfpt lnvs t)trxrxrpoydomee fvil( aDrr( poo0aptoiociltfa2em(vo;t4tlxoir oatfa r uvilt) 2xo(r nu1optnmietas) 2rax ont1altomieiys s2emnmont) etoircoo1omDr n s ()teum(r ou1omtnmfct tf rtr( p;t1aet mietld mDrm( pnt)trxrxoctytfat auei;s s2ur(r oudamenlici tfartm(  ou4olt if3tysla rm(mpnt4 rtoiocia1lptr iesl(0srtoxr io1ol nmieiat)s2umxrono4altn octytlmDumu o;t) renxr ootlp elnes s0tetmxmpoy4apt  nes (faDtau o;t0oltomfcildlsDrlump t)artniocia1op eliei ()s2xoir oy4openmneils)arumxrpoo4tlenmf3tyt m2emn o t4aeenifctotfm   i ols) 2trxopiy4lpe micsl(fartr(  oo1alx mieils m2emu snt) rxnxo ty1faD ln s s0 exrir iy4llt lfetatfsDrrxmpoo0opxn oeiasfs um(vpnt) exnif io1faD li i;t0srtmxo3oydalen nvilt  rrmu p;o0teenio3iasfmDea( p;(4altoxo3iatfpt aiei t srum(r3nydlpeemnei t)s2trur oo1tpx mfciad s2ranvs;() rxnmf iydoa  aneolt0 rumiopiudol nlnctls a2rmx  ou1oleomfciltla uaump u0trxoxrctatfmDeau s s srxriopno4aptn ivslt) Dtrurpot1ope ifeiltlm em( o t)arxnmr3ta1lm rlu il() 2urirpnudolte ici tf Dua(mpno1aetomfetldfsDelnms;() etriociotopDe n s s t2tmio iu1olt lfeilt sDururooo1aetnmietatls2eluvo u0tlenifciy1omDr uvilt0 rxo(m3oudllen nvt sfs2trx  oo1apxn fciyt m2ul(vpnt4alxnmrctodfm eanvs t) eum(r iu4lp n fcs s) 2ua(mo;o1tpenioetydls rau p;()teerir3oodfaD  n ol(0t2xoxr3nu1apeelnct t sDrrur ;u1alen fciyt s2uan p (4aetomfcoatopDr ues t  rxm(m3ny1apee feilt)a2rru  nu0ope ioeiydlaDrmuvo;u4aeenxocia1faDrlivsl(  rxmxo3nu1am  mnvias s2rru p;t4aexn f3iyt m2em(mp u4artnmr iodlateaieilt)setmxopou1lmee fvia()a2rmxront1ale mi3tatfs2ra( pnt0arxoif3iy1fmteauvsl()s2uoiopiodope lictat  rrrurp;o4oetnm
\ No newline at end of file
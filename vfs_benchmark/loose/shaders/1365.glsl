@@ -0,0 +1 @@
+i o;t sruoxopiy4ap n fvia(faDtrurp;o4teeo oeildfs2rm(ms;t4 lxniocoatfp eai i;() etoxo3iy1omenmncias arrrurpnu1oex mfeilsla2em( p;u4 rtomrciydoatrlnvs ()setmxo3oo1olte fvi ()a2tmxr nu4tlt mociatlm ua(vp;t4aetomr oytlm   iei s0 rtmxrpnu1amen nciatfsDtr(rpnu0aexoif3iyd s eaums;t0altnio ty1laD  u o;t)t2xmxo iy4ap elicia(farururp;t1alxnmi3iys m ul( o (4trermrciatop ranvs t0trtrir iy1lpe  ici t) rtmxm ;o4tpx ioctadfa umuvp u0teerio oodlptrliesl(0 2xmio3ny4ap  lici tf Draump;u0alt  ietys a ulnmon(0 lxoxocoadomte i ols  rtmimpiydlpt lnctasfsDra( pou4aet iieildlmDelu p (4tlenir3totfa   nvi t)t2xo(opou4ll  lfcsls  2uaxmp;o1ale mo3iysfs2ea(vp ()tlxrmfcoodfm eauei;(0t2toxmpiy4lp e fesas)a2rrxrpnu0alxn i3ils aDranvp;(4 ltomfcoytlp  lnei;t trxoxmpiu4lp nmfesatf rumumo;o0optnmo3iysla2umn ont)alxnio tydfaDraivi;s  rtm(o ny4omeemfes tf Durxm ou4tpxnmoetysls2uan pnu0aexnifciatopDrauvs;()srtmimpnudomee fvil()arumur oo1oee io3tat m2ulnvpnu4trermocoadfmte ivols)t2urim oo1apt liei s)srtrur ;u1optn oeiat a2elums;()texoxr3ootfpD  ivo (  2xmxr iodame liet s  rrruronu0apeoif3iasfm2rl(vsnt0tetrxr3totop eanvs;s s2urio3no4lptnlfct () rtm(rono4tee  ietas m2ea( snt0 rtomo3iy1oaDr ueol( trtrxo nudlle mnet sfsDrrxr ;u0tleomoeiad s2umump (0alxomoctatfaD anes;s0 2xo(m iy1llee ivils)a2um(mp;u0opeoifcildla eln p ()trerxr iytlp  ai ol(  ruoxm3io4lmtelncslt)aDtaxrp;o4aeto ociaslm2rmnvp (0tleoif totlp  aiei ( seurim3nu4lpe mics t)arrru  nt1aetnmfctas aDrmuvs;()artnmo3oatfptelu sl( seuoio ou1lm  miesltfsrrax poo0oexomo3tyt s rl(vsn(0 rtoxfciadlmD luvo ()t2uo(o oo4ap emictl(f Drmurp;u0apt mf3iltlsDul(mp;u)altoxo3iytlmteln slt0 2xrio3no4llenlnetlt)sDrmxmono1opxo f3iyd a2rln o (0altrxo tydlaD an sls)srtmxm oo4op   ieiat aDum(r ot4optoifeilsls emuvpn()texrif3oo1fm  au i;( s2xm(o oy4lm  lnvtlsfsDua( pot0texo oeiys aDua(mo;(0tltoio oy1lp e i sls t2tm(r iudlmen ivias s2uauronu0alx  oeild a ua(monu4aeeomf3totlmte ueo ( t2urio3ny4ll emnetlsfartrurooo0apenif3iydlsDem(vo;(4trtomr tydom elieslt0 2urxm iodaleelfvils)aDur(m no4apt  f3ildfmDeau o;u0trenmr3totlaDe nes t seumxrpoudlm  mivtl(  rum(mpnu0apxnmoctydlaDean pnu4teenxf3todfmD livsl()trtrirpnu4lme  ivtls  Duru  no4altomoetls a umumon(0tetnioctytfa r n i;(0teto(r3oy1lmtnmicsls)a2ua(m nt1altnmo3tldlmDrmu pnu0tlxnirctytlmDrau slt)sexrxr3nudlp e ivt (f Dumu o;u4alxnmoeiatfaDulnvo (0 lerxr3iydlaD  uvs;s teuo(r nu1open nesa() 2raum oo0aleomfeiyt m uan o (4alxrmo oy1lpt an i t) rtrxm3iu4ope  ivi t) 2rrur nu0open i3ilsfs uau o;u0altoir oo1lmDrlueo;s) exmir iu1lmtnmncias)a2umx  ;u1aleomictatfa eauvp t)alxrmf3ta1lmt  neo () exo(opiy1omee feils aDtr(r ou1tptomo3iadfa el(mo;()alxrxr oy1lptr uei s trxmio3no1lmt mict ( aDtm(mpnt1aexnmi3iyd s ran p (4altnmocoa1lmte uvo;t  rtrxmpiu4llt lfvtas) 2rrumoou4tlx  ieiyslm rln snu)aetrmr ta1fatranei;s0truoxo3ny1lp  liciasfaDrmur nu4aptnmictatla2emn o;(0tetnmrctotoatraiei;()s2uoxr3iodlm n fvsltfs2umxroou0tpxnii3tlsfa2umnvp u)trxomo todfmteaueils setrirpio1lpe mnvt ()a2tmumpnu0oltniietltfmDrauvp (4aexomr3totlpD ln sl()s2toxopno4lmte ivta( a2trxmo;o0ale mociydls2ulnmo t4tlxnxf totfaDelnvo;(  etriopno4lpt mfciat  ruaurpot4aetn ieiydlmDraumpnu)arxrircoa1fm eaueo;()s2xrxr iu4ome mnet s)artau p;u0opt mi3iat s2rmu pn()artnircoytoatelnvo t  2umxo3nydopeelfvs sfaDrru onu0apt  ieiatfa2eanvs;t0arxoxr3oadlm e n i;( srtrir3oy4amtelivslt)srrrxmpnu0oeenmo3ildlsDuaumsn()tlerxf ty1lmteauvi;t)srtoir iydamenlfvia(  2tm(mpou4aetoiiciadfa ulu s;t) etoxr oatfpDr uvsls  rxoxr3oy1ape  neta()a2uaurp;o4apxomo3tyd mDem( o;t) reoxrcootlptr nvo s  exrxmpno4apte ivta() 2rm(mpoo0opt  iciydfm eauvsnt0 lxoif oy1opD  nei;s s2xoiopiudlleemiei s artm( o;t1ale  ieildfs eln on(4alxrxf3todlaDr nvi;t) rumxr3oodapt lfcsa( sDtr( o;o0oetn feias s uaumont0aeerxo3tadfp e nvo;t) rtmxr3oy1optemfes s)s2umxrono1olxomieiadfs2elums;u0tlerio iydlp raieolt seumxm oo1olee fcs ( a2uaxront1tlx  ietlsfs2uln snu4aexrxfcoadfaDrliei t t2uriopou1optelivsl()srtmxmp;o1tetnio3iyd s2eln p u) rxoif io1opDe u o;t)texmio iodap nmicils)a2rmx  ;t1tpeomi3iatla2rmnvsn(4tleomr3iodfaD  nvi t0truo(r3io1lle  net ( arra( pnt4teeo iciydfs2ranvo t0alxnmfcoydfpD ai i t)s2umirpiudop elnes sfa2tmu onu1tee  oeiydfa ra(mo t4alxoio todlp rliesls0 rxrxr iydal   netatfaDururpno0oetoiieiat sDrm( o t) eeniocootopD  ues;s0trtmxo3ny1ap nmnvtls)srtr(rpoo0tptomocildlsDrmn o t4trxoiocio1oaDeanei;t texr(opnudol elncsat)sruaumpot0tex  iciadfm2ul( pn(0aetrio ia1la rlneo ()seuoiopou4ameelfvt s aDurxm oo4tpen icildlmDum(ms;u0texnxf ta1opD aieo;s)sexoxmpny1lltemnvsl(fartax  nt1alxnio3iatlaDeluvo u)aexoxfctytlm ranes;t)sexmio no4ap  lfctls) rrrxmooo1altnifetls sDuanvs u)artnio tatomDe i ols0 2umirpiudalenmiet (fs2tauront0aeeomictytfs2ulnmp (4 rxomrcio1latrai olt  2xr(r oy4al   nct s) Dtaxrp;t4olxomoeias a2ua(mpn(0alxomoctodoat anvs;s trxoimpoo1opte nvtas) 2ta(r ot1texnmiciadls2emnmo;u0trxnmr iadoa   ieo t0sruoxopiudop elncta(  Drmu  ;o0aptnmietldlaDumnmont)texoifctadlpt  i s;(0seum(mpiy4ol   iet sfs2taxrp;t1oltoiieiytla2emuvs u) ltoxo3ootlp eaueo s s2ur(o3iodlm  micta()sDrrxrooo1ope ioetytlaDuanvpnt0trerxf tadfpteauvslt teum(rpno1ll nmivsasfa2tmumooo0aptomietydfaDeln o;() rxrmociotfpDeaivs;t) rxm(m3nudope mivtls)arra(m ;o0tet  feiadls rm(vs t)alerio3ta1la raueo;s0t2urio3io4oltnmnciat)aDtr( pnu1ole  icias s2uanmo t0 exniociadoa r neo;s) rtoio nodopenmnvsa(fa2uaurpoo0tpto o3iadfs2rluvo;u4tlenmr3ia1optr n i (0t2um(m nydll n nvtat)s2ur( ont4teeoii3iyd sDrl(ms;(4 rxrirciy1om e nvs;t  eumxr ny4op  mnci t) 2ur(  ;u1tet io3ias sDea(mp (0trermr oydlm   nei;s)s2umxo3iodalte nei t) 2tmx ont4alenifciasfm2ean sn() ltnxo io1lateaieilt s2uoim3oy4lp nmictlt)artrx  ;o1alx mf3ild sDra( pnt)alxnxo3oa1lat luvils0trurxm nu1llenmics ( sDraxmp;t1open feiadlmDrmuvp u4tltrxo ty1lmteai o t)seurxr3iy4opt  nes ()a2um(ro;u1aeeoiicilsfa rmnvpn(4aetrxrctytopDrli o;() 2xo(m3iu1opt mfvias a2rmxronu1tlx  o3ilsfs uanmo (4alxoxo3tytfaD lies ( texm(o3ny1llt lfct tfaDuaurooo0aptoioctasla uan s;(4texnio3ootfpDrlieo ( t2xrxmpnu1lm nmictl()sDraumpnu1oleomfciys a uauvpn(0trxnircio1opDr uei s0 2urir nydaptnlfct t a2rru o;u4aeeo oeiadlsDrl(ms;t4 lxrmo ia1opD ai sls) rxrim3nydam e ivi s)sruaxmp;u1tetomi3iltlm umump;()trxoxo oadlmtrlnvol() 2umxo no1lmt livi t) 2urumooo0alxnifeias s2ulnvo u)trtrmr3iotlmD lueslt)seuriopou4omte fvi sf 2urumo;o4tpt mfciad a2eauvs (0 lxrifciadoa ranes t)t2tmxm3ny1optemnei s  rtax  no0aexoioetatla2ea( s;u4altrxr3oa1fmtelieo t)s2tm(r iydaptnmiet (f Drrump;o4tpxomieilslm rau p t0texnxfctydfm rlu o;t0texo(o3oodap   nvsl()aDta(r nt0tpx mi3ild s2uaums;(0trtnif todopDrliei t)tetr(m ou4ap emfeilt) 2um(  nu4aex  ociatlm em(vp u0tetoxfcoydfa rau s (0tetm(o3oo4om  licils) rraxrpou0olxomf3iysfa rm(vpn(0 eeoxo3tatfa rln sl(0t2xoxmpiydll eliei tf ruaurp;o0oleoif3ild aDua( on() etrmf3totlm  ai o;t  2xm(r3iu1opeemfeias aDtr( p;o0teeo ieils m2rmu o;t)arenifciydfmteau ils0teurxopou4am nmnetlt)sDurxrpnu0teenmi3iyt sDelnvp t0 ltomo tydfat ai i t0teto(o oo4altemfvs s)aruaxr ;t4oex  iciytlm ra( s;t4aeeoxr iodlaDraivo s)t2xoxo oodllenlnvsatfarrr(rpou1aex miciltfsDelnvs;(4areomrcia1fmtrlnvi;s0sexm(m3io4oltnlfei sf rtm( onu4optomiciasfaDul(mpn()tlenir oadla  aivolt srtm(m nu4alt mnetlsfs2tm(  no4tleomi3tytfs uanmo t)aeenifctatop r ueo;t) rtrim3nu4lmtn iesa( aDtm( poo1ole mfctasla2ea(vs;() renxo3ia1fp rlivs (0s2uo(r3oo1op elfcsa( sDtr(rp;o1aleniocils m ua(vo u0aetoxr io1oaDeli i t0srur(r3io1alen netatfsrur(rooo0tleniietaslaDranvp;t)arxnxo io1lpDeli o;t)texr(m3oy4lm e fvt t srua(mo;t1ole miei
\ No newline at end of file
@@ -0,0 +1 @@
+neo;s)srurxo nodop elnvsls)artmum ou4tptnii3tyt a ea(vsnu4 lxnmociydlpt ln s s)srxr(o3iy4al  lnvias  2rauronu4opxo ociadfm2rauvonu) lenir3ty1lp raueo;()teurxrpnudlltemfeta(f 2umum ;u0tetoif3tytlm2emn pnu)trtnio3oatfatrln i;s s2urir nu1apt mnct t s2ur(mpou1olx  fciyd a rl( snt4alxnmo3todfpDrlivolt teurxm no1lptnlncsl(fsDrr( ooo0optn oeiadfaDrau p t4altrirciotlp rai o;s)t2uoxmpoydap elfvs s sDrmur ;o4ape mo3tad aDeln p;t4alermf3iotomDeauei t0trtmxmpiy1amt mnvta()a2rm(ronu1oeenmictasfaDranmp u) rxnmfcootomD ai o;()sruo(r3oy1om  mfcil(  Dumur ou1alxn icias m uluvsnu0 ltrio iytfm e u s;(0tetmxopio4omtn ici (faDtaxmo;t0aexo i3iytlaDumumonu4artnxr3iatfm   ieo ( trtoim oudlmen ieil()a2umumo;t4tee mfciadlmDuaumon(0tetomf3tydlaD ai i;s) etrimpiy1omt mivtl( aDtaumoot0tpenif3iaslm2um( s;t0tlenioctadoat anes;t)s2toxo nydamen nvtl()srrm(r ou4oexnmfetatfmDum(monu4 exrmf3iytfmDeanvsls)trurim iu1amtelict t) Dta(mo;t1aeenmo3iltfs2rm( pn(0teermr3ia1lmt auvi t t2xoio ny4lltn feslt) Dtau pnt4apeoioctysla2ulu o;u)aetoir oa1oaD  i s;s t2um(m3oydomenlncs (faDtrurpnt0altoioeiltfa em(vpnu4tetnxr3oydlmD auei s trtmxo3nydlmtelnvtas)aDurumpou0tlt ifeiys m rlnvo u0 lxnmf ta1lmtraiei;( srtrxr3nydlle  fci ( srta(moou1teto fcils s2rlnmo u4 lenmrcoytlmtrau i t tetrxr oy4aptnlfetltfsrtmxmont4tpxomfetadfmDel(vo;t4treomr tadlmD au s (0t2um(mpiudlmte fvias aDtmxr ou0tlx ifetydlaDumums;t0tltnir oatomteai s t  eur(o io4op n nvsa()a2tru  ou1ale  i3ilsfa eau o t)artnir3ootfpDeauvo;s0trtoim oodape  feil(  Draxr oo1tpe  i3ildfaDuln p t0tlxomo oodfpt  u o s)s2tmimpnudopen neta()arumu  ot1apt ifetatlaDean o u0aexrxocia1laDeli ols)t2xoio ny4apeelivtlt)a2trum no0aetnii3iatfs umuvsnu)arenmfcto1op  auvils s2uoio3io4op   nei s sDrmu p;u1optoiociatls2rluvon(4 lenxocoytoa r ivolt0tetrio3ny1ap elictlt  2ra(mont1aex  iciysfs2um(msnu4teerir tadoatean il( tetoio nu1apt lici ( s2um(r nu4opxoif3iyd aDelumonu4tetnxo iatom e u o () eumirpiy4amtnlfvsltfartm(m nt1oleomi3iys mDrmnms;t)treoif3iy1lmtr nei;t)trurio iu4amen ict () 2rrxmpoo0alt ioetasfsDul(von()aetrmocio1fa  auesls)t2xm(mpny4omtelfeslsf 2raxm ou0aptn fetlslm2eauvp;()trtnmfciydfp eai ols0 2uoxm3oo1lpte fct tf 2ra(r no0aet mocild sDum(vpnt)trxnifctotom eln i;s)t2xoxm ny1lmenmnes ()a2tmum oo4aptn ieild a2ulu p;t4 exoxo oo1faD auvsls)teumxo nu1optemfet sfsrua(mooo4tlxn o3ild a2rlnvp u4arxnmr3oatoate i o (  rxmirpnu4openlnvi tf Draxm no4opxniietys a2rlu s (4tlxrxocta1la ean slt0s2toxo iy1optemnvias  2rmx  ou0tet  oeiytlsDumnvp;()texnxr3ta1opD an i;(0 ruo(o nydllee fctlsfaDrmx o;u1tpxnio3iat m eanmsnt4 ltrxrctodop   uvs;s  exrirpoudalte neil( srua(  ;o0tpen fctas s rlumpn(4tetnmfciy1oa r u il( t2xriopoy1op emncsat) Drmx poo1apen oeiyd sDumn ont0arxrxocoatlatr uei t0 2uo(m3ny1llen ncs (  Dumxr ;t4olt mfeiad a2um( p;t4tltoxf oo1oa r i ilt) 2toxo3iodalenmivilt srrrxroot0texo feiysfa2uaumon()tetrir oatlm rauei () exrxo3oy1lp nlfcias sDtmxr ot1olen i3tld a2uluvp (0tltrxocio1fp eau slt0 rumxo nu4omeelnctls  rrrur nt0opto ociydfm rlnmpn(4tltoio todfptrauvs;t)trtmio oy4lmenlies ()arrrxm ou1aexn ocilsfa2uanvp t0arxrmo3iotoa eanvi s)t2uoxmpoy4om  mivtat) rrmx  oo4alxnmi3iydfmDelnvo ()aexoxo3tatfptelivilt0srtoxm io1llen net s) 2rr(  oo1aex  ietlsfa ra(vs;u0arermfcoa1oateln il(0tetmxm no1lmt lfci t  2urxmonu1olxo ocilsfa2elnvpnu0alenmo3tatopDe ivo s) eto(opoy1om emivsa(f Dumu ont4aeeo feiatls2rlnms;u0aeerir3oodfa elies;t)setrim3oo4omtelnei ( srtaxrpou4tetnmi3iysla ulnvs u0 exrxrciotfatr iei s)texo(r oy4oleelict ()srtr(r ;u4tpeo fciydfs2rlnvo;()altrio oa1latr nvils srtr(opnudop n neslsfsruaur ou4apen oeiltls2emump;u0trerxf tytlpDeaivi t  rtoim ny1ope mnetat a2raxm nt1tleomictatlsDua( ont4 reoircoytla   uesls) 2ur(r oydll nlics (farraxr nu4tltn iciysls uln p () rtoxocoatoa rai ol(  exrxm3ou4optnmfvtlsfsrrax pot1tpto ociytfs ulnvs () rtoxr3tytlaDe ieilt teuoxmpoy4ll nmfeia( aDtmuronu1aleoifcias mDemnmp;u) ltomr3oa1fmDean o;t srxoxm oodope  ncsl()aDtau pou4olt ifeiat sDrauvp;u4arerio iatlp elu ilt sexmxrpny4al n icsl( a2taur nu4tpe ioetatfa2rlnmp ()alxoxfciadfmtraiei;t  exr(rpiudap elfei sfaDrax o;t1opto feilsfmDeln o t0teenio3iytoptraneo;s0t2um(opoudoltemfvi t sDrrump;u4tpx moeiltla2um( s t4 ltrxfcoo1fat  ivo;t) rxr(m no1opee ivil() Dtauro;o0aeeoif3iadfaDrmump u4 ltoif iy1om elnvo t  2urxo3ny1ape  nviat)aDrru  oo0aptn oetydlsDem(vo;t) exrxo ia1oaD liei () 2tr(r3iodaltelfeia() rur( p;u0oexoii3iyslaDrm( o t4aeeoiocoa1fa  auvilt)sexmio io4omtemfes t  rrr(mpou4tlenmo3iltlm ua(mo;() rtnxfciadopDeanes t0 etrimpno4lle licslt artax p;t1tet ifeiat sDemuvo (0 lxrmr totlmDrluvi ()trtmxm3oo4lme lfvil()sDtmxront1optn icias a ulnmp u4artoxrciy1lm   uei ()s2to(m3oodom n ivs tfaDrax ooo0oltn oeiys s2ulums;t0tetrxocoytop e ieil(0s2uoimpno4openlnesa( sDtaxront1aee  f3tls a2em(von()teerifctodfaD  u i ( trto(o iy1lp nlieias srrru onu4oee if3tas m2emu o;t)tlxomrcty1lpDr uvs s0 2umir ou1lleemfvtatf 2uaur no0oetn fciadfs2uan s t0 rtoxrcootlaDr uvs;t0 euoxo3ou1alt lfeils aDua(mpno4aetomfciltlsDuluvp t4altoxo tydlpD livs t) exoir3iu4lm nlies t) rtrxm ou4ope io3ilsfaDrlu o;t) rerxf3oy1lp elueo;t  2to(r3iudapenlivta(  2urx ono4tleoio3tld s raums u)aeerxr iydlmt  uvolt s2xm(r oo4al nmfctat) 2tmurpnu4alenifciadfs rln o;()tlenxr3oadlmDeluvolt0srumxm oydaltn fct (  ruaurpoo1aet mocildfmDumu snu4 exrmr3to1lpt  nesl()t2uriopno1opte nci s aDrm(ront1aexnmo3tysfa rl( s;u4aetrmf3ia1oaDrlues s trxmir io1om n nctl(f rrmxrono1tptomf3ildfs ua( pn(4arermf io1omtrluvo;()teuo(r ny4lltn fes s)srra(m oo0apeomf3iltlsDrlumsn()aetrxo3tadlpt  neo (0teum(r3ny4apen fvilt srra(ront1ope  oeiytfm2rlu p t)alerifciadfaDraies;s)trtoir3oodoltn ivia( aruru o;t1tlx mieias a ra( p u4artnxo3iydom   nes;() 2to(m3ou1om emnctlsf Draxmo;o4alto f3iat s2rmnms (4 leomoctodom e uvol(0 exmimpiydal  lics tf rraurpnu0optoiociydls2rmnvpnu0 exnmr todfmDrln i t t2um(mpiy4lmte fes s) 2tr(mpnu1alxnmi3ias a2eau p t0aetnxr tydfaD ln ols)t2uoiopoy4ome  ivi s  Dtmur ou4alenmo3iasla ea(ms t0 exrmocoatfpt aivi (0t2xoxo ou1llenlfei ()s2tm(rpno1ope  feiltls elu pn(0 eeoifcoadlmD lu olt)teumirpnu1lm n ieia( sDurxro;o0alto icilt aDean o t0tltriocia1omDrlu i;t)t2uoxmpoy1altnlnes s)aDumxmpnu4oleo i3iys m2ul(von(4aexnmf3oydlatr u sl(0srtm(m3iy4lpe mncta()s2trxr ;t1tleo oeiasfmDra(ms;u)tlxnmr3iadfat aieslt0 2ur(r3oo1ope mfcia(faDtr( p;t4openio3iydfs2elnmo t) exnmociotfmDean slt0 2umxr3no1ole  fvs ( srumxro;o4aexnmi3iys s ea(vp;u4texoir tydop raueils srxo(o3oodopte fet tfarur(r nt4tpenmfeiadfs2em( s ()aexnmfciytoaDeanvi t teto(m3nu4aleemiesas)s2ta(r nu1tptnifetat mDrln ont)aetoirciadoaDe iesls  exmimpnodoltn ncia() ruau  nu1apto fciad a2rmnvs;() eenmf ta1lpt  neo;t) 2urim3ou4ll   nvsa( arrr(mo;t1ape  fciaslsDeln p;(0 eenio tadfateai s ( seumimpoodlle lnvia(fa2uru  ;o4altoio3ild m rmn sn(0artrmf3tadoa r ivo;t0t2xmxo3iydopte nvilt srrm(m ou4tpxn ietat mDeauvsnt0aexoifctadfmtrlivo s0trxrxrpiy4om n ivtl(fsDrm(rpnu4tlxn ocils s2ul(mo;u4 reomf3oy1oa e uesl() exo(opnudlle  fvtlt a2rrxmont1olxn fetyd m2rluvs (4treoxr iydla r n o t)setmirpoydop emici () Drm( p;u0tpe if3iad m rm(vs u4artoxfcoodfp r i s s)s2urimpnu1ol emiviltf 2rax o;u0opxn octlsfaDemn o;u0texrmo ta1omDr ies ()sruoio3ny1ll e fvi s srra(m ;o4aeen oetas a elu o u4 ltnio3oy1latelu s;( teuoirpnu4op  mfvtls srtmumpot1tpe mietasfa el(vp;u0tlxnmo3tytoa e ues;s)trtm(r3iydomenmieta(  Dtax  ;t0tetomociaslm umn s;()tltnif3ta1omt aivolt  rumxo3oy4ll emfvtl(  Dra(ront4tltoii3tydfm2ranvs (0aetoif todfa eauvi ()truo(opiy4om  lfct t s2ua(rp;o4apx  o3iytla uln pn()alxrxo3iodomDr uvsl() 2uo(m3no1lp  lnciat)a2um(r no4olt iietyd s ua(mo t4tetnio3tadfaDe iei (  exoxm3io4lpee ncsls  2tm(rpnu0tetomietlsls eaumon(0teeoxrctytfmDeai sls)s2to(o3nodam nlfcsatfa2urxr nt4ole ifeiasfm2emu o (4 eeoif3iotoaDrai i;s)trxrxrpnydopeelfci ()srrm(r ;u0texoifetyd s ea( p t0artoxfciotfp  ai o;t) eum(o3oudamt lies ()arurxrpot1alt mfcildfs2eanms (0tlxoxo3oodlp  luvils0s2umxo nudopeelivi (fs2rmx pnu1aeeomfctatfaDuan o (0treomociodom elneilt  exo(r oudap n net (fartruront0apxomfciyt aDrl(mo;u0 eermociatoaDrlu o;t) 2uoimpou4amt  icsat) 2tmu pnu1ale ifeiltlsDeau s u)aetrmocoytlat  ivolt sexr(m3iy4lmen fctlt)sruaxrpnu4oee mf3tlsfsDrl(mo (0trtrir3iy1oa  aieo;(  etmxrpnu1lm elnciltf rtax  ou4tltoioeiadfaDulnvo;(4 rtnio3iodopDe u s s  2tm(mpiydam nmfctl( arumxr ;u4texnmiciyd a2em(vo (4aeenio3oa1lm  li o;s)setoxm no4lmtnlivsa()s2rax pot4opxn ictadla2ra(ms;u)altoxrciotfm eln i s  rxr(r ny4ope  fesls)arumu oot0texn i3ils s2umuvp u) rtoiocoa1omDean i t) etoio ou4alenmnvils)a2umxrpot1tpt miciyt a2ea( s;u4aetnxf iy1omDe uvo ( s2umim3ou4ope mfes sfarrr(r ot4openmi3tlsfsDumnmpn(4alenircoa1fa  luei;(0 rxrxm3nydal nlnvtat sDtax pot0tleoifciltfa rl(mp;u4tlenmf3tydlaDrlies;(  eumim3nydam e icta() rrrxmpno0aexnmf3iat a2eln onu0trtomo3tytoptrln i;t0seur(r iodamenmfvi sfs2trxro;o1optomfciad s elump;t0 rtomf3io1lm ran o t  etoio iy1am nlfvta(f Drr(m nu0aex  fcilsfa2ean pn()trxrxr3to1oatrlnvo (0 2xoxm oo4ap elfctl(  2rm( pnu0optoiictls m2ulu onu0treoxo ty1laD lueols teuoxr oodlle lnvia()srururpoo4optoif3ilsfsDem(ms;u)trtrxocoadlm r u s;t) rurim3io1lp  lfvt t sDtaxro;t0apt if3ild a ea( p t4arxoxfctotfateaivo ()srtoxrpnu1ale lfcs (  2uaxmo;t1opxomfeils sDrm(mpnu)tlerxf oodop   i il(  exo(r3ou4om nlnciatfsruru  nt0tle mi3iat s2rlnvo t4alxoxf iydfm elieo t t2uoio3oy1amenmfeiat)srtr(mpoo0alt if3iatfs ean pnt4alxoir3iodoa r ueil(0 rurxm3iu4opte nvt sf rraxmooo1teeo fctytla ranms;(4altnxo oy1fa r uvolt0s2uoim3ou1olenlneslsfartm( pou0tleo feiadfm2rmumsnu)arerxr io1fpD  uvo () 2xrimpnu1lme lncils) rtax  nt0texomieilt aDrlu on(4tlxriocoa1omDe i olt0t2xmxm3io4opee neias s2ua(  ot4oexoioeils a uluvpn(0tetomrciydfm  anvilt0srumiopiy4ame lieiltfsrumxm nu1oeeniietlt a uan p (4trxoxfciydomDeau s;t trtrio no1op n fcs t sDrmurp;u4olxo fciydls2rlnvonu4aexoxr todfp  anvs;(  exrir iudlleelneils aDuaum ;t0tleo i3iyd
\ No newline at end of file
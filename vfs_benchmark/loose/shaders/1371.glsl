@@ -0,0 +1 @@
+n i;(0 euo(r3oydap nlfct s srtm(m nu0tlxomi3iysfm emuvpn(0 eeoxfctydfaDrauesls0sruoio3nu1altnlnctltfa2taumpot4tle ioeiysfs rmn on(4teenmrciotlm  ln ils0t2umirpiydomen nei t)srrrxro;o1alx ii3iytfaDrmnvp u4tltoircoo1fmteau i ()s2xrxm3oo1olen fct s arur(ro;o0apto octldla2uan p u0 rermocoydlpDelivo;t teuoio ny1lm nmfei s)srraum ;u4alx  oetltfa ran s;(4trxrmocoytfmt lneo s truoir iy4olte fct t) Dumxrpno0tpxniiciydfm ranmp u4 eerircto1oa   n i;()texmirpio1lpt  nesl()sDrm(moot0aetn ieiysfm rl(mo;t4 exomr oodfa r u slt) exr(opnydoleelfciltf 2umuront0tee io3iltfsDem(mo;t) lxoif3ty1fpD ai s;( tetmxr iu4lpenlncs t)sDtmuro;o0oltnii3tydfm eau pn(0trerxf oo1la elnvsl()sruoxopou4lm  mietl(  Draurp;o4tlt mo3iys mDem(vpnu4alxnmr3oo1fa eanvi;( setr(o iy4lm elfcsasfarum(rp;u1tleo f3iydlaDeanvs t) ltnmocio1lp rai s s)trxmxo nu1llt mnesl( a2trum ;t4aptomfciytls ul(ms;u)teeomr3oy1fatrli i;( t2xo(mpoodom  mfctlt arum(ronu1tetn icild s ulnmp t4 eerxo3ia1la  ai i;()trxoio3ou1llte ivilt aDumurpou4oltnio3tydfm2em( p;u4teerxocoytfpDeaues;s)tetmir nu4om  lfcta() 2uaurono4tleoiictlslmDea(vs t0 ltomfctadfmte uvslt0sruoxo oodamte neta()a2ta(mpou4aeeo i3tlsfsDrmn o;t0 eeoir tytlp  lueslt)s2uo(o nu1lmeelfei tfs2taxro;u1apx mo3ildlm ulnms;u) ltnif totfpDeanei s)seum(opno1lm n iciltf 2taurp;t4texniocild s ra( ont0aleoir3to1oate u sl()setr(o3nydope mict t srraxront4oex mfciasfa2ea(vs t4alxoxf todomDr uvo s) 2xrxmpoydap nlfet ( srrrurpot4tpeomi3iltls elnvpnt)aeenxrcoodfmD luvol()teumxr3oy4aptelfvi s)a2raxmpno4ape  f3iydfa uanvp u4aetoio3ootlmDeluvo;t0teumimpiy4lmeemncsls) rumuroou4alxnmfetydla2em( s;(4alermf tytlm rln s;()trxoim oo4opt lncias  Drmu  ;o4oexn ociadlmDrmnvp;t)tleoio3tytfmtrau i;t0 2xm(m3iodolt  fvil(  2tm(r ;o1tpxnio3tad sDrl( o;(0 etoiocoatomDeanvo;(  2tr(r oy4am nmfetat s2uru  ;t4tpeoifciytls ulu s (0 lxrir3oa1lpt livolt  rurirpnydoltelivsas  Durxr oo0aeeniieilsfs rm( on(0aexnmrciytomteluvilt  2tmim3oo4omtn ncils a2rmxm ot4alen ieilsfaDumums;u)trtoxrcoodop  lnvi;()srxr(r ny4ap e fvia(  rum(  nt1apen feiyt m el( pnt0artnmo3totlm  lieol(0s2urxopiy4amtnlfvsls)a2trxm oo4optnioctldlm emn o ()texrxoctydfmD lu i s0 rxm(m3iy1alte nvs tfsruax o;u0oeeoii3ilslm em( s;t0 exoxrcoy1lmDr uvslt) rtoim ny4lltn fcsls  rum(mp;u4aeeomfciysla2emnvo (4tlxnxf oytfp  lueolt)teumxr3io4ame  fetls  rrax p;u1tpx mi3iltlm rl(vpnu)altnir3oadomDe ies t srur(opiu1lmt lnvt sf 2rmu pnt4tpen icils s2emnvs t)tetnmrcoy1la  lieo;s0t2xm(r oodlmee icsas artaur nu1aetniietydlaDranvo;(4altrmrcoydfp rai o;t0seurim3io4am nlicsasfarrax  nt1tlxn fciysls2el( p t4aetoxo3oodomDr nvils0s2um(r no4lpt mneils)sDuau pot4oltnif3iys aDumu onu0 lenmr3iydfp  aivs (0srxm(r3iydlm e nvt s  rrr(r ;o4open ocildla2rlu o;u4artoxr3oydfat  i olt srum(r3oy4optemivi (  rraumoot4optn f3tydls rl( o;u) etrmf tatop  anei s0srtmxo iydlme mnvi s aDtauront1teeomoeiydfs2ra(vonu)altoxociadop r ies (0seuoxo nydlmtnmivsat)aDrru p;t0openif3iatfmDranmpnt4trtoir3iydfaDrlnei;t)s2tmir3oo4oltn feiasf rumx  ;u1tpx ifciasfsDua(ms (0arxnif3ootlmD lneils0texo(o ou4oltnliesas  rtaxrpoo1aexn f3tatlmDelums t)tlxrif iadlpte ivo s)tetrxm3iudoltnlnctls  2rr(mooo1oltnio3iysfsDrmu p u)artrxfciodoatr nvil() exmio io1op nlnvsls)s2taxr nu4olxn icilt sDumn snu0alxrxr ootom e n s;s0 rum(r nudlpe mfcsl(farum(m ot0apt mi3ilsls2rlnmo;(0 etrxf iytlpt  i ols)t2xmxm3iudolt mivtlt a2um(rp;t4opxnioctls sDua(vs u4 ltomrcty1lm r nvs t) 2xr(o3nydllenmiet t  Dtmu  oo4tetnifeiltfm2rlu p t)altoiociatoaDr n sl(0 2tr(r3oodal   fvils aDur(ro;u0apt mfciadlsDra(vpnt)aexoir3oytfmtraivslt0sexr(r ny1omtemieils  Drm(mpnt4apto iciadls2eln o;t0tltoio3oa1lpD ai ol() etmxrpno1olee net t sDur(mpno1alt mf3tasfm2uan s;(4trxoxf3tadomD an s;( sexrxmpnudoptnlivi s sDrm(m ot1alxniietydfs2em( pnt) lxnxf oadlaDrluvsls)texmiopiu1llenmies t  Dur(rpoo0aee  f3iat m ean s (0trxrir3tatfaDelu o (0s2um(o3oy4opt  nvta(f rrrxmooo0oexoif3tydla2ul(vp;t)areoio iydlp  aivi t  2xrim iodam emicsl(  Duru  nu1oetoioetatlsDemn p;(0 renxociotoat lneol()sruo(m ou1lmtn fetlsf Dua(  nt1opt iicils s rln s;t) rermocta1fpteai i;(0s2xrirpnodamtnmfciatfsDumu o;u4altoif3tyd a2emn s;()tleoxr iatfatrluvo;s s2xm(o3oy4optn nvtasf Duaumpnt4tpxnifeiadlaDel( snu0 ltnmr ty1fptrluvslt0t2tmxr3ny4apeemnetls) Dtrxmp;o0tetnmo3ildlm2ra( o (0trtnir3oy1oaD lnei s)s2toxopnudal nmieslt)sDumump;u4olxomfctyd mDrl(vo;u4tlerif3tytoa rlieo;(0trumiopou4om elivsa(fsrrax ont4tlto fciatlm uan p u0 renmf iatfp  ai slt  rurxo3oodlmtnlfvia()srtru poo1tpxnifciadfsDrm(vo () exoxo ia1fmt  nes t) etm(rpio1ameemfctls srur(rooo1oexn o3tydfa2uau p;t4alxoxo oo1oaD aueo ( s2xmir3oodoleemicils) Dra(m nu4tltomieiytfa uln s;(0alxomo iodlm eauvo t0 eum(m3iy4al e nvtls)sDrrx o;u1tlen fciyd a2umuvon(4aleomociodlaD livils tetrir nydam n ietl() 2ta(rono0opxnii3iat a rlu p;() exrxociytfm   uvi;(0 rxo(mpoydom nlfeilsf rum(moou0tlt if3iysla2ua(mp u0arxoxr tytoaD  ivslt0t2xr(m3oydlm nmivs t s2tr(m ;u1oleomicilt a2uluvo;()aetnirctatopt aues s)srto(opiu1amt  nctasf 2rrxmpoo0tltnioetltlm em(vsn(4aetoioctodoptr neil( trtoxrpio1apt  ieia( a2tr(roou1oeeoif3ild m elu p (4trxrxocia1fm e ieolt0trur(rpiu1lm elieil(f rrrxm nu4opx  ieiadfmDrln ont4tlxrir3iatfpt lies t0trxo(r oo4open nes t) 2rm( pno4tlx ifeild m2eau on(4aetrxr iodfm rlnvi;(0sexrxo3iu4apenmfcsltfaDuaurpnt4oltnmociadls2eaumsn(0altrir ta1om ean olt)trtoxm oudoltnmics tfarra(m ;o0opeoifctyt sDrl(vs u)aeenxr oo1latelneo;(0 eum(o nu4aleemfvtlt arur(rp;o0tltomo3tadlm rlums t) reomo3oytfaD aivs;() 2xmxmpoy1lptemnvtl() Duaurooo4tptomoctydls2ul(vont4alenioctydlmDeaieils0 etm(o oo4lpt lictatf rumum ;t4tptn icild s2emn s;(0 etnxrcootfp e ueo;s)trtr(opiy1lmt  feilsfsDtm(ronu0oleniieilsfa rmu on(0 ltrifctydlpt  nei;t seumiopnodllenlfcsls)sDta(  ;t1tlxn fetatfs ulums ()tlxrif3oadop eln ilt)seuoxo3oo1amtnlnvsltfs2uru ont4altn feiysla2rluvo t4 etrxrciatlm  auvo;s  etrxm3iu4oltnlivtlt)s2umur no0ole ifeiad mDumnvo t)aexrxocta1oa eaneolt)srumir3iy4oleelnes () rtaxrooo1oexn oeiaslsDumnvs;u0 ltoxr3oadoatelivs;(0setoim ou1ope lfct s  Drrur ot0aeeniociyt a2rm(ms;u) renmo oo1oaDe i o s) rxrxo oudlleemncs t)srum( ont1tpen ieiydfsDrmnmo t4 exoxrcootfatean o;t)t2xmxo3nodllen iviatfaDur( ono0aee mf3iaslm um( snt) etrxf tatfmDe uvols trtm(r no4aleemivsa( arrax ono0aee  iciatfm2uau s u4alxnxo3tydlpD ai s s)s2xriopoy4ap e ivtat)aDua(r ;o0altoiociasfaDrmn s;u4aleomfcoadopD auei;s0s2tm(r nydlm   ivtl(  rtmumpnu4alto feiytfs raumpnu4 ltrif todlp  li i s0sruoxm3iy4lptnlnvslt)sruaumoou0tle mietad a rmuvo;t4 exrxo oatlmDelivol()teurimpiu4al   iviat artr(rpnt4altnii3iad sDulu pn(4tltrmo3oadlm e uvils0 rtmxm oudaltemnvsl(  rraxr ;u0opxnif3ilsla2ranmp;t4 eenif iotomt ai slt)setoiopiu1lm nmnvt ()sDtr(ro;t1oleo octlsfs2emu s;t0alxnxo totfpDeanes t t2uoxm3oodaleelfcsa()artr(mo;u1apxo feiyt a ulnmo;t0areomf ootfaDeluei s0 euoxo io1altn fei (  rum(mpou1tee ifctas s2eln ont4alerxo3iodfm e u ol() 2trxr oudamt mivia(f 2uaxmp;t1ole if3tlt aDrauvs;t4arxnmr3iodfa rauvo;t)setm(r3oydaltn feta(faDtmx ono0tpt mi3tad a ranvp u0aeeoxr3iytopDrlu i (0sexm(opnodlle  fvsa()aDtmu  nu4tlx mocils a2rlnmp t4 rxrmo totfmt  u sls0 etoir3nudlle licils) 2rax o;t4oltomf3iatfm rl( pn()aexnifcoo1omte uvi;t  2tm(r3oydam emfet ()sDua(moou4tpeniiciydla rmuvs;(0tlxoxr todopDr ieol( seuo(o3oo1ame  iesa( s2rmx p;o1tle  i3iatlm ulnvpn() rxoxf tadlpte ivs;()truo(mpnu4omt  nvsl()s2taurp;o0tleo iciyt s2um(vpnt4altnxo3ia1fpte n il()seto(m no1al emfctas  rtaurooo4oetomociltlaDrmuvp (0 ltoiocoatlmD  n sls t2urxm3oo4ale livtl(faDua(ro;t1ope ifcildfmDemn p;(0 eenirctadom   u il()srtoxmpio4lmt  icsas)srra( oot4openii3tldlsDrluvpn() lenmf ta1lmDr nvs;t  rtrxo3nudll emicslt srrmumo;t4olxn i3tldfa rau s u0tlxrio oydoatelies s0 rtm(m3oy4ole mfvt sfs2ur(mooo0oee io3ilsla rmums;u4 etnxr tytoa  ai o (  2xoirpiu1opt licta( srururoou1tet ifeiad a raump;(4aexrifcty1lat aues ()t2umxrpoy1olen iciat  Dtm( p;t4apeomfciytla2umn s;u) exoio3todlpDe ieilt)sexmiopoodop nlnesas)s2tmxmpou1tleo oetyslm ean o (0aetnmr iadfaDelneo (0 rtoxopoydap e ncs sf Drmu pnt1oeeoio3ilsla ra(ms;(4alxrifctotlptr nvo s)t2xr(o3oodlme mivslt sDuaxmpnu0tltn ictld m2eaump;t0aleomrcoy1lmDean ols0trurio3ny1omt mfvt s)arumxroot4aetomoctlsls ul(vo (4alenir3oatoatr uvs ( texrxo iu4lm n fct ()srtmurp;t0olxn fctys s2rau o t0 leoxfciy1fatraies;t0teto(m oodale  ivs t) Dtauroou1aptoif3tltfm2rl( pnt) ltrxoctadla e uvo;s)tetr(o iydlme  feils)srtr(mpoo4openifcilt mDumnmp (0tlxrmfcoodopDelieo;(0s2toim iu4aptemfci sfsrrm( pnt1tetoioetydfa rln s t4alerircoo1lpDran i;( srurio nodale lfeia() rua( o;o0ope  f3iyd s2raumpn(0artoxf ootlp rlies s0tetoir3oy4ap elfcsat sDraxro;t1optn ictltfm ra( o u)tetnir3ia1om  lueo t0srtrir iu1omt  nvtat  2rmxmpnt4aexoiocils a rluvpnt0trtnmrciadfa eauvs;(0seuoxo nu4am elnet sf rrrxrpnt1ape  iciyt m2ea(vo;t0aetomf3oa1fa ranvols0sexr(r oudamen nvi t)sruau  ;t1tlxn fetldfsDumuvo;u) etnmo3iytfm  ai s;()sruoxr3iy4opeemfet s a2urx p;t0apt ifciltfm ulu p;u0texoio3oytfaDr nvilt)srum(r oo4op nmiviasf Dra(mo;u0ope  fctld m2rlu o;t0texoirciytlp  auei;(0srxm(r3io1op e iei s  2tax  ;t0tptoii3tas mDelnms;(0 rxomfcoadfpDr uei;t t2xrir iu1om n ivsat)a2ta(rp;o1tlxomietatls2em( p t)artnxf3tytfmDelivo () rtr(o3no4altn nesltfaDrm(r oo0aee  ociyd aDem(vs;(0 lxoxrciodlpDrluesls)trumxo nu4lmtelnvsltfsrrm( ont0aeeniieiydlaDulnms (0trtomr iytoptrau ol(  exrir3iydom  lfesat)aDta(m ;u1apxnmoeildfsDrl(mpnt4arenio3ia1lm  lu il() rxrxr3no4openlfvia( s2trur nu0tee io3tyd aDulu onu0trtrxocootfmD auei;t0teuo(r3nydopeemfetat)aruaxro;o4tpenmocildfa2rmn o u) eeoir3iadop   n o () rumxm oy4lltemiet (fs2ur(  ;o0oet  i3iyd s el(mo;u0 rxoxo3iatopDelivslt0trur(r ny4lpen ics s  ruaumont1tlx  fciltfs2em(mo t) rxnmfcia1lpDelueo s0teuo(mpoodom  mics t)s2rmx pno1tle  oeiys m uanmo u0trtrmfcoydfpDrai s;() 2um(o ou1omtemfct t)srrax o;t4oetnmoctydla2rmnmo;(0teenif3to1oa   nvols0setr(r nudom  lfet t)arta( oou4aexnmi3iat m2elu o;() eenmf3io1la ran il(0 2urio3nodop nmieslt  rumuro;t4oet  fciadfa rl(von(4tltomf3oy1la e i o t) exm(rpnydamtemnes s sDrr(m nu0oeenmiciaslm2emu pnt) lenio iadomte i ol(  2urir iydlmte fvtl( s2raumoou1aeeomf3ildfs rlumpnt)artoir oydopDeau ol(0 exmio io1openmfeias)sDumu ooo0teto octys mDrm(mo (4alxrxr ia1lp rauvo;( s2umim nydole mnetlt)aDuau pnu4opxo i3tadlaDea(ms;(0trtrxo totop rlnvi;s tetmio ou1om  lfeiatfs2taxmpno0altomieiydla2umums;(0artoio oydlaDr u olt t2xr(rpiy1amenlfeils sDrau pou1alto ietlslmDrm( sn(4tltrmo3iadop elu s t  etm(o nydoptemfei ( sDtr(mpou1oleomfcilsfs rm(vp t4trxrxr3iy1oaDeauvs;s srur(o3oy1lle  nci t  2ta(mp;t4alt  iciys m um(vp;t) reoxr iodfp r nvslt0 ruoim3oudlp n fvias s2trum ou4tleo fctadfsDelumpnt) etnmf iodfm raieil()srxoxo3iy1am   icsl(  rrmxm ;t1aet mi3tydlsDua(msnu4tlxrmrciytlmtrlu slt s2uo(rpny4om emfeilsf Dtmxr ou4tlxomo3tyt m emnms;t0trtoxf3tatlaDrlu s t s2xr(o3ou4om   fesl()a2rmxmp;o4tlxn oeiasfs2rau pnu0 ltrxr oatlm rau ol()s2tm(o3no4olte nct tfsrta(ro;u1aeeomoetatla2emnvpnt0teenmr iodfmt  neo;( sexoiopoodlltemnctas sDtaxmpoo1tlxnmi3iysfs uanvp;u) eerio3tytomD aivs s  eurxmpny4lmtemfetltfaDrm(root4tlx mf3tasfm2emums u4aleoxf3iodfm elivols)srtmxm iu4lle lict (f rur( ont4ape  oeiytlm rm(vp;()alxrmfcoadlm e neo;t  etrxm nydam   ict (fs2ururo;t4altoif3ildfa em( p t4 renmr3todfm rai ol()srur(rpny4lpeelfetlt sruaurpnu4oee moeiytfa rau o;u0tlenif io1fpte n s t) exr(m3iy4lp nliet () Dumxm ;u4apt iocias m rln s;t0alerxo to1la e i ol( s2to(mpio1openmneta(faDtaurpot0olxo f3tlslsDrmums;(4altnxf3todoptelivilt)setoxr3nodomt mfeil(f Durxr nu0tex iociatla2umu p;(0aexomr3iadoat au s;s  rurxo oydlm emnci sfsrtmumpoo1aexn ictysfmDum(vs;t) rtnxo oy1fmtelueols0sexrxm3io1amt  ivia( artax pou0opto oetys aDra( snt0trenxf3iy1lpDe uei;t s2uoxopoydamen feilt  Dta(rpnu4tetomoeiydfaDum(ms;(0altoir ootlpt lueol( t2ur(opnodlmtnmfvi sf rrrur oo4tlxo feildlm eaums;u4tlenxo3oo1fm   nvo (0 etr(r3iydlme  iet t  Dum(m ;u4altn o3iyt m umnvo;()tlxrmrctydla r uei;(0t2tm(m no4optnmfesl(  Dtaxmooo1tltnioeiat m2emumo;t0 ltnxf oo1lpD ai i t t2umio iy1llenlfvils)sDuax o;u0aetoii3ildfm2rm(mont)tetrmr iadfpt an ol(0s2uo(opno1lpt liviltfsDtaxm nt4tlxnifeiltfm umuvs t4trxrxf ty1fat aueo;t  eto(r3iy4op e fcias  rtm(r oo1aptnif3iysfm2uln pnu4 rtoif oo1lpDr i olt t2toxmpiodlpeelfvtas s2tr(  ;u4oetn feiytlsDraump u0 rtnmfcoo1opDranes ( t2tm(r oudapeelncsas srur(m oo1tltn fcils m ul(mont0trtrxfciatfa rln i (0 rtr(m nu1llee fetat) rtau pnt4olx  oeiytfaDrau s;(0 rtnif io1oa  li s;( sexr(r3nu4om  livta()srrru pou0oetn icilsfm2umu ont)aetoxfctodfaDeaivo;s sexoxr3nudol  miet t)aDtruro;u4ale  fcilt a2ul( sn(4arenifcio1fm ranvilt0 etoxrpiydal n fvtlt a2rmxmonu1olxnmf3tltlmDean p;(4aeeomf3tydfaDraivo () eumxo oudlpen icilsfaDrrumo;t0aee mf3iatfs2rm( o t)aleomf oydoptrluvo t0seur(m3io4apt  feia(f Dtrx ooo1optomoeiltlsDrm(vo (0 etnmfciatomD auvi;s seumxmpoo1ameelies tfaDuax  nt1optoifetat m2ra(vs u4arenirciytopteluei;()seuoxo io4ope  nei sfaDrmumpnu1ale  ieilt mDemu pnt4texoioctydfat  u ols) rurxo oo1lmt lnet tfsrta(  ou0apx ii3tytfa el(msn(4 exnxo3iytlmt lneolt) 2to(opno1ll  lnvt ( s2rr(m oo4tetnmo3taslaDum(mp;t4treomo3oytlpD  uvo;s sruo(mpoo1lp emicilsf 2ta(m ou0aleo f3iltfa2eaums;t0aeenifciytfmDeai slt  rxoxrpoy4optelnetasf 2ur(rp;o4alxomieiatfa rmnms;t) lerxrctodfm   ueolt)seumxm ou4olee nct s)arurxm ou4apt mf3tyt m rl(mpnu0 exnir3ootfaDe uvo s) exmxmpoodlpe mici () rrr(  ;t0tlx  feils a um( o;t) eerxr3oydlaDrai o;( t2xrxmpiodomenlfetltfsrrm(r no0tet  i3tytfs2rmnmon(4 etoir oa1oateai s;()sexmxo3iy1aptn fcils artaxmo;o0tlt ioeilsla umnvo u) ltrmr3totlat lues ()setrxo no4ole  ivsls srrau  ;u1teto oeiydfmDrmu on()texnxo todlmDean s s0texoxm3no1lmtnmietas srumxm ou0oex  octltlsDulnvs u4arxnxo tadlat aueils0texoxo nydlmt mfcs t)a2rmxmo;u4oltomiciat a2em(mo u)altnmo3iadlpDelu ol()s2xr(mpoy4llt licslsf 2trxmooo1tptoiietat aDemumsn()aexrmo3oatlp  anes ()t2xrir oudlmenlnvilsfarraurp;o0oex  ieiydla eanvp u)teeoifciytlmD lnvs;()seuo(opnydom elfci (faDrm( pnu0altoif3iytfaDel( onu0 lerio oy1fa  li sl(0 2xmxrpoo1lm  lici (f 2raxr ot1apto oeiytfs ul(vs t0artrmf oadopDr nvs s) eurxo iu1lltn fvi sf Duru  ou4olt  fciyslaDumumsn(4tetrxo3todfptrauvi () rtmim3oydlp  lici s  2raxro;o4aeeomo3iltfm2ua( onu) eermocoy1fmtean i;t  2xm(m3nydal n ies (f 2rmxmpno0aptn oeiadfa2uaumo;()trtrmf3ta1opt lnvslt)srxoir3oydlmtnlnetls sDtm(r nt0olxo o3iydlm ea( p () eermf3todfm ranvo s0 exoirpiu4lpteliet s  Dua(m ou0olxn i3iad sDeauvs;u0aexrxociotfmD  n o s)seumxm iy4ame micils) 2rm(moou1texnioeildfsDean snt4areoir totlm r uei t  eto(o3iy1lptn nviat) 2tru o;t4alt mf3iadlm2rlums;t4aeermr3iy1oaDe ivi;s0texrxopoy4omee ivs ( sDur(m nu4tltnmietaslmDrauvon(4aleoio iadlp   ieo;s) rtmimpoo1lmtnmneilsf ruau pno0tpe  i3iltfmDrl(ms u)areomo iy1lm   n o;s)trxoxr no1omeemivils) Dumxm ;t1aetn i3iadfm umump;u)trxoioctydfmDrln s (0srxoim3iy4llen fctlt)s2rr(rpou4oetnmo3iys s2eau s u)tleoiocio1op eaueolt setrio nydopen nctas  rururp;o1oetniocild mDum(msnu0trxniocta1lm eanvo s0seurxm3oodapee ivslt aDrm(mpoo4aleniieiasfmDul(vs;u0trenmo io1op rlieols)s2umir3oydlle  icilsfs2taxroou4optnmoctldfmDum(vp;t0aetnio3io1lmtrln ils texr(o oo4lmeemivtasfsDuaxrpnt0olxnioeildls rm(mp u0teermrciodopt lueol(0 ruoxmpiy4opeelnesl( s2rm(rp;u0oex mfeias m uauvo t) lerir3oa1opDrauvo t0 rtmim oy4ap nlics (fs2um(r nt0ope  f3iytlm emn s t) rtrmr3iytfpDraivi s)t2urim oo4opte nvtltfa2rmurooo0aet  fcildls2eaumo (0texnmo3oy1laD ln ols) rtoirpio1omt  fesls srurxr nt0tlx mo3iysls ra(ms;u4tltrio3iydla   nei s0 etm(o no1lm  lnvtatfartrxm nu1olt mfeiadfmDumnmpnt)tetnxr3iotopt  n ils)teuoxopoudoptn nciat s2um(m ou1olxn ieiysfm ul( s t4alxoxr3iodlateau s;t0 2trxrpio1aleemnvsltfs2raxm no0tltoioetasfm2rln s t)altomf3tytfa  li sls texoxm3oudopt mieta(  Draumpot0apt mociaslsDem(ms;(4 rxoxrcoodlateau s;( t2tm(opoudoltnlfcsas) Dtrum ;u4oltn iciyt m eaumpnt)teerir io1lat  uesl(0seurxm3iy4al  mfeta( srraxmpnt1tleo o3iltls um(vsnt)treoircoytomt auei (0t2uoxo nu1ope mfvt s) 2raxmoot0opeoiieiytlm emn pnt4tlxoio todla rluvo;() 2toim iodll  lncs s  rtru oot0oee  octadlm2umuvs u0 ltrxocoy1fm r uvs;s0trtm(r iodam   nctls  rtmxmont1opx iietytfm eau pn(0trxnxfciadopDeli i;t0texoimpoodome  nvtl( s2trxrpno0tex  fetyslm uaums;(0 lxrxfciydlpDranvo;t) eur(r ou4lm   fctas  2tr(rpnt1opeomfeildls uaumont4arxomr oatfa  li s ()setm(o3ou1lmeemnci s aDrr(rooo0tpt  i3iytls rl(vpnt)tltomf iadlmD anvs;( s2to(r3no4ll   ncsltfaDumxrpou4aptnifciadfaDra(mpn(4trtoxf3oatoateauvi;s  exmxr3iydomenlnet ()a2ra(monu0aleoioctlsfmDraumsnt) lxrif3oodoa r u i;t  ruoimpnu1apen fvt (fs2uaurono0olxnmociyt aDrm(vp (4aexoxo3iodlpDelu ols sexrimpnydole mfctls s2rrurp;t0opxo oeiys aDem( snu0teenxf3ootlmD aueo;t)srurxrpio1ope  ictasfaDuaurp;u0texoifctasls emnmonu) lenxr tatlm r u ol(  etmimpiudlme  ietas)sDtax poo0aeenif3iasfm2ea(mp u0tetrxrciadlp eau o s)srtr(m3nydlmt  iesls a2rmxrooo4tex moeiatla uau s;u4aetoxf oydfmDe ueo;s0trtrxm ny4ame  ies tfsDumur no4optn o3iadfa2ra( p;(0tlerxo3io1om  auvols)t2to(m3iodamtn fetatfartaxmoot1tlxo ieiytlsDumnvo;u)alermrctodomD an i;t)srxrim3ny4lp   nvs ()srtru oot4altnmoeias a2rlnvpn(4 lerircoydfmD aues;t s2xoir no1omte fvsatf Drruront4olenifeiad aDemumo;(4 rtrmrcootoaDeliei;s trurxo3oydlptelncs sfa2tmxm ;o0tex ifcildlm el(von(0tlenxo3iydfmtranvi s0 rtmxr ny1lm elnvs tf rraxr nu0tlenmoctasfsDulu o (4 exrxfciatfpD  ivs t  2xrxmpny4lmtelici ( srumx  ot1apxomocilt s emnmsn()arenmo tytfp e n s t  exr(opno1lltemnetls  Duaxr nu0olenmoctad s2eanmp t0tltoio3tytlmDelnvols  rto(r iudalt  nctl( a2umxmonu0apenmietyt aDrlnvpnu0alxnxr iodomDraivslt0s2tr(m3ny1oltnmnvtl(faDumxmoou0apeomf3tltlsDelumsn()trtoifcoadopDrli il(  2uoiopiydap  lietas)aDum(mp;o1olxo oeils m rl(mont)tlxrxr todlmDraneils0s2tr(m ou4lpe  fvi ( s2uaxr ou1apxn feild s2ra( o;u4trtoio3tytomtr ieil(0srtoio3io1ameemietl()aDtr(root0tlx  o3iys a2rmn o;t4areniocio1oaDr nvo;(0sruoim3oo4altn neil() ruau ooo1olt miciad mDul(mp t) lxomo3tydfm rlieo (0t2uoiopiudol nlfci () rtm(moou1oex io3tas m2rlumo;()trenir oydla   i ilt0teumim nydopenlfetls arumumono0olt  ociytfa elu p;t0 reoxo3todoa  livolt)t2xrxm3nu1llt lnvt (  2uaxm ou0apx ioctlsla2el(vp;u0texrmf3oadlpt  nesls0trxr(m3oudamtn fcsa() rtaurpoo1apxnioeiydlaDeau ont0 renmocoatopt  ivo t0 etoiopio1ameelieslsfs2umxrpnu0tlx mo3tytfa2emu o u4altrxo3tatoat anei;t) rtrxm nu1ll n nesls) rtaumpno1olxo fciad a2uaump u)tltnmrcoa1lm  luvs;s0 rxr(m nodlmt lfei tfs2umu pnt4alxoiiciad a rau p;u0aexoxo3tadlaDrau s s)t2xmim3oo1ll  micil(f Dtr(rp;o0tpenii3iltfs ulnmo u0aeeoxo iydoaDrlieols s2xmxm3iudape mnetat srrmxrp;u1oexnmiciaslsDemnmo;u0 rxnmf3ta1om e ivslt)t2uo(mpiu4omt  nci t) rraumpou0tleo fciydfa uanvpnt)trtnxr3tatlm r u o t) euoiopno1lptelfcsatf rtau o;u1oleo fciyt m elnvs t4 lerxr tydoate u s;t)teum(rpnydop emicsasfaruax  ;t4aeeo fciydfm um(mp;(4 ltrircia1la rai i;t teurio io1amtnlfetl()sDururo;o0oet mi3tlt sDrm(vont4 rxoxo iy1omtr n sl( sexm(r3oydlptemnetat  Dra(m oo0alxnmiciys s eluvs ()tlxrir3iotoa raieil(  2uo(mpiy4om  liciat)s2ra(rpnu4tex mf3iltlmDeanvo u0 reoio3ia1opt anvi s0 2um(m3oudomt mfci ( a2uax oot1aex  fctls m emnvs (0 eeoxf3oodlatrauvo;s)texriopoydapt  iet t  Dumxm ot0olen f3iltfm rm(mo u)trenxrciydom r nvolt0teurim iu1lpe  fctl(fsruax onu1oeeo o3iadlsDuanvp;t) lxomf oo1fa e uvi s0 2urimpno4aptnmfci t)aDua(mo;u1alx mi3ilt a ra( o;t)artomr3tatom elivi;s0trxr(opiu1lme licsa() Dtmx p;o0olxomfetlt s2el(vs u4trermr3iatlaD ln i;t  rtm(mpoodomtelfvta( a2tax  ot0tle mi3iys s umnvo ()tlxrio oytfpteluvs s0trtmxrpnu1ll   fesa() Duax p;u4tleoiieiadlaDulu on()treoioctodomDeaieo s0 rurimpoydamtelietl( srua(mp;t0oet  fciltla rmn s;() lenifcoydfmDran il()trum(o3no4lpenlncsat) Drr( p;t4texn octat m el( s;u)aetrxf3oa1oatraneo (0trtrim3ny4am  lfvtasf rtr(  oo0tpe moctasfm um( o u0 exrxo iy1fa rluvo;()trxrimpnudlle  ncsl( s2rm( oou0oltoif3iydfmDelump u0 ltrmo3io1fpD  nei;( sexoxm io1ll nlici s arum(rpou0aptomfeiatlaDrmnvp;(0tltnmf ta1oa  aivolt)t2tm(o3io4amt  neia(  rtmx onu4opxnmfeildlaDumu p u)trxrmf io1faDeauvs t) rtm(m nodlmtnlnvt s aDurx o;o0olxnmfeild s2el(mo u) exniociydoat ln o ( sruoxopoy4optn nct ( s2tmxrp;t1ope mfctyslsDean o u0arenxf ta1la rlneils t2xrxo3oy1apte fvtasfs2urxr nt0oee  i3tyslm2ea(mo;u0 lermr ty1fm r u sl(0trurxo3nodam  lnvt ()s2umum no4aptniocias sDemnmp u)arxrxrcia1opDraivil() rtrim3iy4ape mfctlt) rtmumpou0oltoiiciltla ea(vp (0arxrxr to1la elneilt) eur(rpiu1omenliviatfaDrmuro;t0tpe ifeiyslsDrmuvs;u0arxrxf iadopteanesl(0 rurxopoudap e nvta() rtmu pou1aex mieiatfmDrluvp;u)artnif tatfaDrluvilt0 ruo(rpio4ope mnvs (faDtaurpnu4tlto fctad m rlumo;(0 ltnir3oydfaDr ueo;( trumxr no4ap nlfcilt) rrm(m ;t0oee mf3tld aDeanvp;()arerif3ty1optr n ilt)tetoxr iydlp nmivi t)a2ra(m nt4apeomieild s ul( o u4alerir3iotlmDr i o;t0srumxo3nu4al   fcsa()srrmur oo4ope mfetadlsDua( snt0tltnxf io1oa rlnvi t  2xrir iu1altelietlt)artaxmoot1alxo iciadls2umnmpnu0trenio3oytfp rln sls0srtr(r iu4ole miesas arra(ro;o1teeomoeiad m rlump;u0artoxr3iytfm e ueo;s0 2tm(r3nodlpt mncsls sDrrurono1aet  fcilsfmDrmnmp (0texomrcoo1fmDr i sls  eum(m ou4alt mies sf rtmur ou0aet  o3tatlmDua(vpn(4 ltomf tatoaD  i o;( texrxopoo4lle  ivi s)arum( p;t1oltn o3iasfs rmn snt) rerir3to1oateau s;s  exrio3oy1ll  lnesat) Drax pnu0olxomictasfa2ulnvo;u4 lxrmr tatfm e nvs s sexmio iy4altemfvsl(  2rr(r no4texnif3iyt sDelumsn(0aeeomf3todlmDe u o;()s2urxopoydal nmfvs ( artax p;t1tpeomi3tysla2ulnvpn(0texnxr3totoaDeanei s s2tmir3nudalt mfet tfsrtr( p;u4aeto o3iysfmDulnmpnu0aetrio iydoaDeluvs;s0s2umxrpio4olt mnvtl()a2trxmont1opt if3iadfs2umums;u0aleoio3todfpteauei;s0trtmimpiodopt mivtas)srtmumoou4tptn icias s2umumo;t0tlxrmr3tadfmte i i;t0teto(r3nu4omen neiat) 2tmumpou4aexn oeiaslmDrlnms;u4 rtoxocia1fp elivslt)tetoxmpny1op  mnvil(faDumxrpou0oexnmociad aDrl(ms t)trxnio3iodlmDrauvi;t)s2um(opio4al e nvia(f rra( pou0tet mi3tlsfa2el(vpn(0arxrmf io1laDelivo;s)seumim3iu1ole  ies ()a2taxmooo4opxoiieilsla rmn pnt)trtnmf oytoateai s s)srxrxopno4al e iciat)a2urxmono4oleoifetydfa2rmuvpnu) eerxo oadlmtelivil() exmir3oy1op  lnvil() rtrx ont4tpxnmo3ilt aDul( sn() eeoxociytfa rauei s trtoim3oy4apeemivtls)a2tr(r ;u0tptn ieiys aDrmu p t0 ltnio3oydom   nes;t) euo(m3iu1llt  nvtlt)aDtm( pnu1oetnmoetltlsDelumo;t0tetnmo3oo1omtean ils  rxm(mpnydaptn nvsltfarra(m ;o1altn f3ildlm rmn p t4altrir iy1laD au ils0sexriopno4lm  lfvtlsfs2rrx pot4ope mf3iyd aDuau s;(0 eenxo iytlatr ieo;() eurim3nydapen icta()srtrum nu4tle ifciydls2umnvo;(4teenmf3oo1fa eaiei s trumxmpiy1omtnmnvt () rua(mpou4tex  ietat m2emnms u0aexrif3io1lpteaueslt0t2xrirpio1alte fcsl() 2tr(m ;u0opt mfeildlmDea( sn()aetrmo3iotfp rln o ()texmxo iydomen nvtls) 2uaurono4optoifciltfsDeluvo;t4 eerxo3iytlmDrlnes;s t2xrir oydlm elnvils)artrump;u1aeenmi3tls mDeanmsnu4tlxnxfciotlm rauei;s sruoiopiodolte nei tfs2rmxrpoo4olxnii3iat mDrlnmpnu0 leomrciytlmDeaiei s) 2umxm oy1aleelfviatfaDtrxrp;u4alxo i3iat m2emnmsnt)alxrir3ta1fptrluvol()srxmiopnu1ll emnciltfaDtrxr nu1oex mfeiaslm umn p;u0tlxrio3iodfaD  i s;t)trtmimpoy1lltnlnci t) 2ra(mpot0opxnmoeiyd m ea( pnu)tlerif iatfptrlu i () 2xrxm iudamtnmfei ( s2tmumoot4oee mf3tld a eln onu4trxoir3iatlaDelnvi;()setoio ny4ome mnct (fa2rr(ront4tlenmoetatlmDul(ms;t0treomr3iy1fmDelnvs s)t2uoirpnu1lpeelneslt aDrrx p;t4alxomicils s2rau s;u)tleoir3iatfmDelnes;(  ruoio oy1lme mnvs tf Dra( pnt0olxomociytfsDeanvsn() reoio oatlmtrlivilt)sexoim3nudam nmivt (fsrrrur oo0tex  oetysfm uau o;t) ltoif iydfmtelneo;t) rtoxo3no4amt  fesas) 2umxronu4opx mfetysls2rm( snu0tleoxo ia1opDranes ( seuo(opoodlm emncil()s2taurp;u1texn iciydlaDumumo;(4trtomr3iy1oa e nei;() rxoir3oy4ape mnetltfaDtm(ronu0altnmoctatfmDem(vp u4 etrmo3ty1lmDe uei (0sexm(o iudape  ncs t)sDumu oot0texn feiatfm rlu sn() leoxrctodoat liei s0trxrir iodlmeemncils  Dtrur nt4oleoiicildls2rmuvs t) etrif3iatfp   i o t0s2um(mpoy4op elicsa(  rtrxr ;t4oee iietatfm2rm( snu0 exomociotopDe neols0 2xr(opiodlp  mfcs s  Dumumpoo0ape mo3iysfaDra(vp ()tleoxf oy1opteanvs t0t2tmim3iodll emfctasfsrurx ont4oeeoiictydlmDrm(mpn(4 leoircoadlaDe nvsl( t2um(opiydllt  nvil() Dtaump;o4aptn i3taslmDemnvonu)alxnif iotlmtelneils)t2tmxo ny4ol elfvtls) Dtrxrpnt4tptnmfciad mDranvs;(0trtrxociatomteauvs s trurxr iydaleelfetltfsDrmx  no4alt ifcilt m eln sn()arxrxf3oo1fpD lnvs;t0 rum(m iu1lle  iciltfsDtaxmpnu4olenmi3iat s2ran o t0 exoxr tatoptr nvo;s) rtoxo3oydlpenmiet t aDrr( p;u1ale if3tat sDelnmp;() rxnmf3oatoaD lieolt0tetr(opnu4lp n fctltfs2tmu  ;o4aptnmfeiys s ul(vo t4tlxnir tadlpDraueo (0teuoxo3iy4lmenlncils srua( pou1olxoioctaslmDumuvon()teerif iytla   ieslt)texmxo3ou1llee fetat)srumxmooo4oeeoio3tas a2eln s;() lxrmocootfatr uvi () euoxr nudope lncta(f 2rrxr oo4oeeomfciyt mDrlu on(0treoif3ia1fmDeluesls0srxo(r oy1alte net sfartru pnu0oetomfciyt mDrm(vpnu0tltrmf3iadoatr iei;(0t2urim nu1om  lfvs t srrmxmpoo0oleomociadfa eanvo;u)teeomociodlm rai s;(0 2xr(m3ou4lmeemfei sfsDur(rp;u0tex iiciyslsDranmp;()teenxrcoytom r iei;t s2xmio3iu1ol nmnctl( aDuaxmpoo1olxn ietatfsDua(monu4tlermociotlaD au o;( s2xoir3oydope mfes tf Dta(ront1tpen ieiys m raump t4 lxnmo ootfp rli s;(0seumxr3oudlm elncils)s2rm(ro;o0ape iociydfa ra( s t) etrmfciodlp  livo s0trxrxo iydlptnlivs sfaDur( oou0aptoiieias s uau s t0aetnir3iodlpteluei t) 2xo(m3oy4lpe mnctls arua(mpoo1oltoiocils a2uan sn(0aetnxf3iatla rlivils) 2xr(r no1alen icia(  rraxrpot0opeo ietysla elnvo t)areoxr iydfmteau i ( sexrxr3iodomt livil(fa2tmxm ;o4apeoif3tadla2rlnvp;(0altrmrciydfp eli s;t) etrxm ny1ll e nvtat srrmxm ot0aleomi3iasls umumsnu)texnmo iodlm e i s t0texoxo oy1lp emieta(  Dur(mp;u4apxnii3ias aDrmnms;(0arxnmfciatfm  lueils0tetr(m nu4op  lnci t srurx  no1oltnmfeiaslm rauvsnt4 lenxf tytlmDr uvolt) 2umxrpiu4oleelics sfarrmur ;o4alt micilslm rlu s t0aetoxo oadlp r neolt0t2xr(r3no4llenmnvils a2tmur ;o4altoiiciadla eluvon() rxrmfcoatoptr uvil(  2trxr iydlpeelnei (  rtau  no4oetnmicildfs2rmnmo (0 rxnir io1fmDeai sl( srtmiopou4lmt licsl()aDrrxrpnu4aeto iciatfa umu on() rtnxociotfa   ieol( teuoxo oudomt  fet t)s2ua(mooo4alxnif3iadfs rm(mo;t4trtrmr3tydlmt ln sl(0trxoiopnydlptn fciltfsrumurp;o4olt  ieiysls2el( p;t0alenxr3ta1lmDr nvo;() 2xrxm3oy1lmt mnei t)a2ua(monu0teeomfetadlsDrl( p t) eeomr3oy1la r i o;s0s2xm(r3nudlpee ivi ()srrrurp;t0teeomietatls ulu s (0arenmfcoydfpDrlues (0 2ur(o nu1ol e net () Dtrump;o0oeen ieiatfsDranvpn(4aexrxo todlmD lneo;s trxoir3nu4om nmfei s  2raxr ou1apx ii3ildlsDuauvsnt)trtrmr3totoatraneils0srtm(rpny1lp   fvtas srurxrpnu1tee  iciydfs um(vo;(0 lxnxo3oodoatraieo t)setrxo3iudop nlivtas srtrum oo4olt  i3ilsfs2rmnmpnu0altomr3oa1lmDe nvi s trtriopio1omenlneilt)s2ra(r ;o1tetn f3iadfmDeluvs (0tlenif tadlpDr ueil()tetrir no4lm nmncil(  2trxronu0tleo ieilt s ra(vp;t0aetnxoctatoa elneslt0trxoxr3ny1oltnmfetasfartm( p;u0alto icild m2emnmp;(0tltrif3ta1fmtean s t teuoxmpiu4lmte nvia(fsrrmxr oo0tpeo oeiys aDra(mpn()aeenxociydlaDe n ilt0tetoxr3nu1op elnesatf rtru o;t1oex  oeilsls emu o (4texnxf oytoptrai o;t0 etoiopoy1aptnmfciatf rrrx pno4tlx micilsfsDel(mo t4tlenmo3ta1fptrauvo t0s2xm(o iy4ap nmivi tf 2um( pno0aeeomieildfm2rmnmo;u4teenirciy1fmD lieo;(  rur(r nu1lmtemietl(  Dtr( o;u4tptnmictas m2ulu o;t)tlxrxfcoydlmDelues t seumxmpiy4lpte fcsls  rrmu  nu4olt ioctlt sDrmuvpnt0 exomocoa1la  ln o;( seurxopny1opeemnctlt)a2taum nu1ole mfciad a2emuvsnu4 rtomr oy1omD aueolt  rtoxm iu4ol e nvil() Drmxr oo0optniieias aDulnvo;u0 leniocootopt  ivo;t)seurirpoy1lp nmfcsas sDuaumooo0teeomoetat mDrmu p;t)trtrmf oo1fm   uvi;(  2xrimpio4ap nmfesa( a2ur(rpno4alxoiictas m uanvo (0 lxomrciadfatrliei s0t2xo(rpoy1amtnmfvilsfs2raurooo4oeen iciytls ra(vsnu0aetrir iodfp  lnes ()tetrxm3iydaleelfct (f rua(mo;u1olxo ocils mDum( s;u0 exnmf3ia1fm r uvo (  rxrir3iydopte ncs t sruaxm nu0opeomieiydlaDrmnmsn()aleoxrcoytlpDeanei;t0 etoxr io1ll elnctlt s2tax pnu4olx ii3iadla uauvsn(4trenif3oodomtrluei;s0 rxmxm nu1op  mncsasf Duaxrooo0olxo ietatlm2ran o u4aetrxo iy1lpt lueilt  exr(m oydapeelnvia(faDrr(r ;o0opeomietys s2eauvp;t0 rxrio oatom  lnei t)sexrimpou4lm e ici sf 2rmurp;t4oeen iciyd s2em(monu0 rerxocoodlmt  i il() rtmir ny1llen ncils)a2uaxront1openmf3tltlm2rm(mon(4alerxf3tadlm elnvilt) etmim3nydll   neils)srrm(moot1texnmietysfs emums t0treoxocio1la elnei s0trtoimpiu4amtnlncsas s2taxrp;o0alx iieiysfm2ul(vo u)alerxf iadoa  lieslt  exoim iydlm emfvils srum(rono0tpe mf3tyd a ua(vp;(0aetrmr3ootoatr nes;()teuoim3iy1ap e fctls)aDtaur nt1apxn ieilslm2elu snu4trxnxociodla eaiei;(0s2tmxm iy1ll  lfciatf rtr(r nu1teenmfeiltlaDranmo u)trtrmr totlpDelnvolt0s2tmxm3oy4amte nci ()sDur(ro;u0aee ioetadfaDea( ont0tlerxf3totfaDelu sls teumim iy1lme  nvtas s2tru ono4tetoiieiad m2ua(vs u4 exnir oy1omDraueol(  2uoir3nu4lp  mics s) Draxroot4ope  feild a2rl( p u0 exoir3iadopD auvsls teumir iydam e fct ()a2rrxro;t4open iciyt aDrmuvo;t0 eerifcto1fpt  ueo;(0trxmim3iodol   fetls) 2um(m ;t4opx iictlsfsDeauvsnu4aexomfciatla rai o;s0setrxopiu1ap  mfei s) 2ta(ront1tpt moctyslaDel(ms t0trtnio3totlmDrlnvs () rtoim oo1lpenmnvs tfsrtaump;u0tetn fciat a2rmumsnu0trerif3iydfmtelivi;s trxm(o3oy1lpte ics ( srtrxmp;o4tptn fctyt s ea(mp t4tltrmrcoodomtr ivol()t2xm(o iydal e fvi tfsDra(ro;u0apeo ieiltlmDrln p u0aeerxf todfmte ueo t) rxr(m oo1op  mnvta() rum(rpot1tptomoctlsfa ra(vsn(4 reoifctotfa   nvs;()t2urxo3iodamtnmiesltf Dtaurpnt4opxn ictyd m2emums u4tleoxf tytfpD ai il( tetrxo oo4om n ivsl() rrmum nu0olt ifcias mDranmp;t4 rtnxo3totfm  luvil( setm(m3iudomtn ieil()arurxmpot4tlxomieildfs ranvp u4texoxr3to1fp elu s s srtm(o3io1am eliciasfsDtaurpno1apx ifctat s2ranvsnt0 eenxf tydfp  aueo;( seuoim3iu1oltelfeia(  2um( p;t0alxoii3tysfa2elnvp;u0trxrmf3todfpt luvo ( srxoio3nu1omtn nvia(f 2tm(r nt4oleomoetasfaDelnms;u4artnmoctatfa rln il(0s2trio3oy4lpeelictl()srtauro;u1oexnifetyslm ra(vo;u)arxnmo oo1fpte i i;( sexrxo iudape  icil()artru p;o0optnmf3tytfsDemn s u0 rtnxo3oadfaDrli s s)trtoir oy4ameelncsa(  Dtru pou1ale  f3iysfa2em(mpnt4 rxrxoctadom  au s;s)sruoxo3oudaltnlfvi s arumumpou0tlx iociad a raump;u) eeoiocia1fmtrauvs;t)srum(mpnu4lltn ivtl(fsDrmxrpot4aleo o3iatla2rm(vs t)treoxf3iydlatean o;(0 2um(o3iy4aleemieil(fsDur(  nt0opt ifetatfmDean pn(0tetrir3oydoaDe neo;t)t2xoxo oo4optnmivi tf Drm( p;t0oexnio3tyd aDranmon() exrmo3oadfmteln i s)s2tm(m oy1lpe mivia( sDta( oot0olxn fctytfmDem(mo;t0alxoxf3oatfmt anvils)setoxo3nodam e nviat)s2trumont1apeomoeilslm ea( o;u4aeeoiocoadfmteauvo;s) rtrir oodap   netlt)srtmu  ;t4aexn ocils m el(mo;(0 rxoxo3totlp raueil( truoio oo4llenlivias)srumxm nt0oexomoctldfs2rlnmpn(0alxnxrciotlpteauvo;s)tetmio3nodllte fcilt aDrmx ont4tltnif3iasfmDrmu p t0tlxrio ia1oatr neo ( srtoxm3iu4optnlicsl(f 2uaurpot0tleo ieiyt aDulnvs;t4 reoir oo1opteluvils) 2umxm3ny1altn fvils)sDtr(rpno4aetnii3tat m2rluvpnt4 ltnmo iytlpDe n olt s2tm(r iu4amee icilsfaDtm( oou0tptomfeiyt a2rm( o ()teenio3iodfaDrlies s0teuo(m iy1lmee fvt t sDum(mpou0ape mieiasfa2umn p;(4trtnir3iy1fm rlnvilt trxo(r3iodomeelnes (  2rmxmp;o1alxo o3ild a em(mp;t0aetnioctotopD au o s teur(o3oo4lm n fcia()srrm(m no1texn ocild a umnmp;u4aexomr iydfateaieils0 exo(m no1alenlivtlsf 2rmxmp;o4teen f3ildlm elnvp ()aeeomf iatlm e uesl() 2tr(o3oo4op  mfeilt)arum(m ;u0aex iieiyd m2em(vs;()trermo3iydfaD ln o () rurxr3iu4lpen fvsas  rrrurooo0opeomiciasfmDumnvp;t4 rxrxf3oodomDe ueo;(0 etoir3iudlpte nesat s2rm(  nu1apx  oeiys m2umuvp;u0 rermocoatlat  n s;( tetm(r3ny1lptelfctatfsDra(rp;t1oeeo ieiadfm el(mo u)arxoxf3io1oaD luvi;s)s2xo(m oo1optelfcs (  2tm(rpnu4alxnii3iys sDemnmon(0 etoir3iodlmtr ueils0teumxmpoo1al nmfei (f rurx  ;t0tpx  f3tls aDrmuvpn()alxrxrctytlm eaieo t0setoxr nu4lltnmncs sfsrtmxrpnt4tle moetytfm rau s;(4 lenmf3iodoptrlu s ()trtr(mpio4om elnvtat srumx pno1alt  ictytfs ul(mpnu4trerircoadlmD luvs t0srtr(rpno1amenmiet ()aDrmumpnt4aet micilt sDuan sn(0altnmocootopte uvi;(  rxr(o3oy4op nmfvsltfsrua(rpoo0optoioctaslm rm(mo;u0 etomr3iy1oate uvs s texrxm io1omee netl(f Drm( onu0aetomf3tltlm2rmums;u0 exoxfciy1om rlues (0teurimpoy4aptn ici s srra(mpnu4tlto feiad m eaumo;(0aexomf iytomtr uvil(0 2to(r3oodll nmnvsatfsDurx ooo1apeoif3ias mDea( o (4 eerxfctadlp eau s (  eurxr3no1altemfctas aDta(m ot1apxomoeiltfm rl(msn() exoirctodlmD anes;s)tetmir3iu4ap emfcia(fa2urx p;o1alxomo3tatfsDum( o u4altomf iydopDeln i ( s2urxr nu1lm  lfvi t  rrmxrpno1aetn f3iadfa uaums;u0 eenmr tydlaDe neo;t0t2urxo no1olenmiesls a2rmurp;t4aex moetlsfs2ul(vs;(4tlxniocty1lpteaiei t texoio3oy1altn fvils  2tr(rpou1tlx mf3tysfaDranmp (4 ltnmr iotfmt  ues s trtrxopiu4lm elneslsfarumxmpnu4aetn i3iad sDuanms;t4trxoxr oadfa   n s (0 etoio3nu4ope mietas sDtr(mo;t1oleo i3iys mDuan s (0arerif oa1fa elivol(0t2trio nodolt lnei tfa2taxrpnt4alt  feilt s2emn p;u)alxoir iotopt ln o t)sexrirpoy1al e neiasfa2umxrooo4apxoifetatfaDelu s;t4 lenif oatlmt  i sls)s2umxmpny4omtelnesasfs2tax  ot1texnmoeiltfm2ul(vs;u4 eenmf oodoaDelnvils0s2toxo3iu1amenlicslsfaDtr( ono4tlxnio3iltla eauvo u4 rxomfcoa1op   i s t0 ruoir iydolt mnet ()srraxrpnt4alen f3iytfs2ua(mp t0texrif3oodlmtrlnvsls0srxo(m3ou1am elncilt)sDtru  ;t4tleoifciydfm uau o u)texriociy1oa eluvo t trtmim iudope  fvsl() Drrx oou1apxn f3iadlm2emums;t)tlxomr3oy1om elu o s sexoio iodop nmicilt a2trurp;u1altnifciydfmDeanvp;(4aexomf3todoatr neo (0srtrio3iydllee nci ()a2tmxro;u4alxn fciysfm2ra(vs;u0alerxf3oatlmDeanvs s0s2toxr oudlp   icsat) ruaxmoou4olt ifctltls emnmpnt4 rtomf3oydlmD  nei t0 2um(opiy4amtnlfes sf 2umxr ;u1ole mfeiyslsDeluvp u4 lxrmf ia1fm r ivs;s0s2xrxo3iydope lfcslsf 2raxmpnu4tpe ifetlslsDrm( p t4texnxo tatfp e n s;s) rurio nydop   nvt tfsDtm(m ou4tpto octadfa eln ont0 ltrmr iytfateau ils s2xrxo nydalen nct tfaDuau  oo0oeen ieildfm2rl(ms;t4tetnxo iodfm   ivo ( setrim io1alen nesat aDtru  ot4aptn ieiad mDua(mpn() lerxo oodlp  luvslt  2tmim oydole mieta(f 2ra(m ot4texoio3iasfaDuaums ()aexoifctytomtr ueo s)texriopnodomtelieta()a2uaxmonu1tpx ioeiysfs ul(mo (0trenxfciodfa e ivi;() euoir3oudomtn nvt () Drm(mpnt4apt  i3tasfm rmu p;(0aexrxrcoatlaD  neol(0seurirpoy4llt mfes sf 2taxrpnt4ale  i3iytfm rluvs u4trenxo ta1fa rlivi s0srxoir nodlpte fesl()a2ta(r ;u4tlt  fctysls el(msnt0alxrio oo1faD  neo;( teur(opno4lltemivsl(  Drr(monu4tpe mociyt aDrm(mo;(4trenxf3io1faD  ueolt0 2uoxo3nydlm nmncs ()s2rmumo;t4aee ioetls mDrmnvo;u)tetnxoctotlpt luvsl()s2xrxrpiy1omenlnesa( sruaurpot4tlxnio3tltfmDum(vp;(0 eermo3totopteln o;t)s2xmxrpio1lpen ietas)sDuax  ou4openmocias mDrauvo t0trtnif ty1laD lu s t)setoxm oy4ameelfet t)srtmx ono1olenmfeiydfm2ulnms;u)tetrxo3iydfat  ivo s0 exoio3nydop  lnctl()a2rmum ot4tpxn ictytlmDelnmp (4tltrmo oa1lp   i il( srxoiopiy1am elfes s aDrmx onu4aleo oeiat aDel(msn(0teerif3iydom rauvsls0s2tr(opiu4ap nmfvtls) 2rm( o;t4aetnio3tyd a eanmpnu)altnir3tydfat  neo t0t2urirpio1al elfetat  2urumoot1opxomietytla2rmu s (4aleomo3oodlat anei;t0t2triopiodomeelnct s  rua(mp;u4apxnifetytfaDranms;t4aexrmr3ty1la   uvi;s0sexrxo oy4lmtemncs (fsrurx ont0optn oeiasfm2ran o;u0artoxo3oytfpDeln i;()texrio iu4lpen nvsas)s2ur( ooo0oetoioeiys a2ran s t0 ltoxr tydlp  auvols) 2xrio3no1aptemietat) rrax p;t0oleo feilt m eaumonu4aeeoio3ia1la  ai ils0 2xo(o3iy1lmee ncsatfs2rm( pno0tetomf3taslm2ea(vs (0alxomrctatla eanei;t0srum(o3iy1al   ieiat)a2ta(r nu0tltnioctat m uluvp (0alxrxr3totfa rlneo s0trto(m iu1aleelnvs s sDtax  ;t1alxnmfetydfaDumuvpnt4 exnxo tadla eai sl(0 rurir3oydom  lfcilt)srtax ont0aex mieild aDul(vo u)teenxf ta1la elieo s0 2toim3iudol nmneiatfaDrmxmono0apx iictldls raumpn(0texoir iytfpDrli i;t)s2xmxr3no1ope lfct sfarumu ont4tptomfciadfsDelu o;()treomo3oo1op  an olt  2xm(o3nu4omee fet t)arra( pno4ole ioeiat a2ulu o t0trtnxr oy1lpDranvo t  exo(r nu4llenmnci s srtr( onu1oleomf3iydlsDelnvpnt0artoxrciydlaDrlnvs (0 2tm(o3oo1apenmicilt  2tr(mpou1tetnmf3ias s rmuvs;t0 leomf3ootfp eanvo;t0trtrxr nudapenmnetltf rrr(m ot4alxnioeiytfa2um(ms;u0tlxrxo oytlm eanvi (0 ruoimpoy1om  mneil(fs2ta(m ;t1tlto feiat s2uauvp;t4arxrxf oatfa   iei;s t2umxm3ny4alen nctl(  Drmxmpnu4olenmoctlt a2rm(vsnu4 etoxrctotoate u olt0tetmim ny1am n fet s)sDrrx p;u0oexniieiyt s2el( snt0tltomo3tatlaD lnei;s trxm(opoudom n ivs s)aDum(r no0tlxn oeiyd s ra(vs t4 rtoio oo1la  ln i s)t2xrxrpou4ameelfcilt  Durx pno1olxnioeiys mDem(vpnt0 eerif3io1op e ivo t srur(r iu4lptelnvilt)a2um(  oo1olenioetldfa rluvo;(4texoio iydoaDelu i;t)s2xrxo oy1ap   fvtltfs2raxrpot0teen oeils m2rlumo;()teeomo iadlpD  ueil(0trur(r iudoptelicils a2umx pot4tlxniietldfs2rm( snu4artnxociy1omD anvi s0texrio iu1lltnlicia() Drmxr ;o0olxnmi3iltfaDeluvp (0 renxf3ty1fmDeai o (0 2urxm nu4omt mieilt) 2raxm ;o1apx iictlslaDumnmsn(0 renmf3oa1fpteln ils0seumxopny4omt livsa(f rur(  ot0aptoiociltlmDumnvp t4 exnir3todfmt  nes;t)setmxopnu1lle lfvtlsfs2trxmo;t1apt iiciasfa rauvp u0aeeoio3iotlat luei;t) 2xmxo3nu1lm  lnvtasfartm(m no4oexo oeiadfs em(ms;t0 exrxf3tadfp  livilt0t2xo(o nu1lm   neslt s2raxro;u1alenmociytlm emu snt0treomo3oadlpteauvo;t  rurxr3nu4omen ncsl()s2raxrooo0aeenioetytfs2emn p (0 exoio totopD ln s;() 2tr(m3oo4om elfesa()a2raumpnt4oleomiciytfa umnvo;(0 lenirciy1lpDeanesls trtrirpno1ol elnvtatf 2tmurpnu0tleomictasfa2rl(mo ()alxrif oadfm  ln o t)t2xm(m oodam nlfcias)s2tmx onu4apt  o3tat sDrl(vs;() lxrircia1fmte i i (  2xr(rpiy4ll  livtl(fa2tr(r nu4tetnio3tatfm2ua(mo (0teeoio oodop   ivolt t2to(mpno1apte icsas)arraurpoo1oet if3tydfa2emnvsnt0alxoxfcootoptrlnvi (  rumxo3oydomte iviatfaDum(m no1opxn fcias aDrmu s;(4altoxo iotlmDelnes s t2tr(rpnu1op nmfei () Durum nt1oleo i3tld a rmuvpnt0aeenio3ta1faDrluvs;t)s2tmxr3nu4ap elfctlt) Drrxroot4apeo f3iasfaDul(vpnu4tltrxr3oatoaD  uvo s s2uoio3iy4apen ietl()aDur(ronu1apxn i3ilt m umnmpnu0tltnif tatfmDe ieils s2xrxo3nu4omeemivt (  Dra(root0aetoifeild s rluvs;t)alerirciotomD luvsls sexo(rpio4ll nlfet t  Dua(rpoo1apt  octlsls2rmuvo;u0aeeniociytoptrlnvolt0t2toxm nodlm e fviatfartrumpou4tpeomfetatfs rlumo u)aexrxocoy1fmt ln il(  2xoxopnydllen ict ( srtaur no4tleomoctatlsDuau s t4tlxomfcta1oate nvo s0 rtrxm3io1amt lfvil( artr(m nu1tpt mfciydfm2el( p;t4texnio3tadla  anes;()sexmxm iodaltnmfvilsf rta(mont0opx  fcias m2rmn s;t0aetnxfcoa1la eliei s  eum(opoo1altn ivs s s2ua(r ot1oleomieiaslsDea( s t4tlxrmo3oodop  aueol( t2uoim io4lltelicslt)srtaumo;o4oeeo o3ildfsDrmnmp;t) eermr3iatfp e ies;( s2to(mpio1lpeelnvs tfsrtmumono0opx iociadla2elnvs t4 rermf to1op r neols) rxoxo oy1ol emfvi ( sDrm( o;t1opeo feild mDuau o;t4 etoxo ootfpDe ivsl() exoxrpiy4aleemivi s)sDurxrp;t1aee  iciyt a um( s;t4aleomrcio1latran i ( teurirpoy1am nmnvias)s2raxr no1aex mfeilsfs2umnmo (0aeeoio iytomDraues s sexrxrpno4om  lfesas  Drmx p;o1olt mfciyslm2ulu o;u)alxnxociy1faD  ies;t0t2xo(r oy1lmtn ncslt)s2trxr ot4olx  f3tad mDum(mo;u0 rtnmf iydomDrlnvi (0tetoxopiy4ape  ncsltfs2ua(m ou4apxo f3iltfmDrmnvpnt4teeoxrcta1op e nvi ()trxmxr oodaptnlfviat)aDtru oou4ape  fciytlsDem( o (0tlenmf3oytopD lnvo (0t2ur(o io1ape mfvtlsf 2rax  ou1opt ioctydfa em(mo;t)tlenirciodla rli o t0 euoxm3iy1amtemncilsfaDtr(  ;o0tpeomociatlm2elnmp t)tlxrxf tadfpDran olt)t2uo(m3nu1opt lnet t)aDumumpou0opxnmicias aDeln pnu0tleomfciadoaD  uei;t s2toxr oudam nmietls  2ua(mp;o0oleo f3tyd s2rlums t4aexnio3iodlpDranei t srurxr nydlmtemfeiat)sDtax ono4alxomfctatfs2rauvsnu4tlxnxrcoo1om   i olt0 euo(r oudopenmfciasf rrr( o;u1tet mietyd a rmumon(0trtrir oo1la e i ilt sruoxo3no4optn netlt aDtm(mo;o4oet miciyslaDulnmo u0 lxnxrctatla e n o;(0tetr(opiy1omenlncsat)a2ua( onu0alx  oeiytla ranmp;u)tltoif3oytomDrai ils)t2tmiopoy4ol nlivslt aDrax  ot4aet ioeiltls2uanvs t) ltnmfciatfpDe iei;s srur(r3no4ame mncslt)artmuronu4aexo i3iatlaDua(vsn() leoifcoo1laDr i sls srum(opou4lptnlnvtas  2uaxmpot1oexnmi3tldla2eln s t)aexnxr iy1fa e i o s0seum(o oodlp  mnet t a2tau  nu4alt mi3iydlmDemu on()aexnir tydlatrli s;(  rum(r iu1am nmnetl(fa2trurp;t4tpxn f3tad m2eauvsnu) etomr iatomDe n o t) etm(mpny1lle lict (  rrmxmo;o4opx mfciyt mDum(vo ()aeeoio oatlptelu i t0trtm(rpio1al  lnctat) rrmxr ot0apxo ociyd m2rmnvo;t4tetnmr oatom eauvi;s)t2toxrpio4lmee ici sfsDtm(mp;t4tlt mf3ilt m elnmsnu4aexomo oydlatrli sl( tetmxm no1om nlnctls) rtmurpot1altnmi3iasla2umn p;()tltnxr tatomt  n i ()s2xo(r ny1olt lnciat)srtax o;o4oeeo ieiadfs uaumont0aexrmrciytlmD ln s t0teurim3ny1lltemicsas  ruax pnt1tpeo ieiatfm ra(ms;u4altnxo iadopDeliei;s0tetmxr3io1llen feil( s2rr(ro;u1oleoiiciytfa2ra(msnt0artrmo3oa1lm eanei ()t2xo(opnudopenlfesat)aruaur ot1tpeo fetlsfs2uan snu0alxnmo3oo1fate u o;t)seuoir3nu4lmtn fciat) 2tr( o;t0opxoifetatfaDrl(vo u4altnmo oy1la e neo;s s2xmirpoo1ameemivi s)s2rax oou0opx  ieiatlsDeanmo t)altnio oy1fm rli s;s)trtmxr3iy4llen nctat)a2tmum no1ape  i3iltfsDul( s;() lxrio3iatfm  an i (0srxo(opio4omtemnesls) Dur(moot1oexn octldlm2rl( snt)texoxr3iodlmt  uvo s sexo(o oodopte iesas)a2umu  ou4aet iieias mDrmu s;(4trtnio oodlateln s s)s2toxm3iodlpe  nvia(  Drr( pou0texnmoeild m2umnmpnt4artoxo iodfm eluei s0 rxriopoudap emnvsa() Dua(mooo4tlt  o3iad s2rlnmp;t4tetnio3iodfpD auvs;s)t2tmxm oodal  lfesl( aDra(roou4olxnio3iadlm uanvsnt0tltrmf3iy1fa eaneo t0texm(o3no4lpte fvsa( srtaxront4oeeo o3tysfs2ulnmp;u0tltrir3totfateai i;t s2tmir3no4ap e ictlt s2rau ont0altnmieiasfsDrluvonu)trtomfctatoaDe i s t0setr(r3oo1lp nmiet t)sDrm( pnu0apx mo3tysfm2em( snt0alenmo3tadopDrln o;(0teumxm ou1omtemfcsatf rrrumo;o4tlx  feiat m2uluvs (0 lenmo iadfp elieo (0texo(r oo1al   nes s) Drrxrpnt1oltnmiciyslsDrmnmsnu) rerxoctotla raivi ()trto(m3oo4amtnliei () Draumo;t4tlt  feiysla2em( o;u)alxnirciydlp elnvs ( t2uoxr iy4ope  ncslt)sDrau o;o0tee iociatls ra(vp t4 lenmoctotlpD aieo s)t2uriopoo1ome mfeilt a2rrxmp;u1apto fciadlm2rln ont)trtrxo3tatopt an ols)srxoxopoo1altelnetls srrrum ot1ope ifciat aDeauvp u)tlenxr io1oaDr i o;s0tetmim nudopt  fes s) Drrxm no4aeeo f3ildla2eluvo t0teermf3iatomD lnvi;s)t2xrxo3ou1lpeelnes () Dum(ro;u4oetoiiciytfa2ua(vo;t)trxrio3oytoaDraiei;t setmxr3no4aptemncias)s2tm(rpnt1ole ifetasfmDrlump u)trxomrcoa1lmtrlneo ()sexmir3ny4lp nlfcslt  2trxrp;u4aeen i3iadfsDuanvpnu0 rxnmf3todoat livol( tetoiopno4oltnlfvsa(fartrxrpot1oeeomoeiasla2uaumpnu0 lxrxrctodlmDrlieo;t)t2xo(m iudom n ictas arrr(rpno1ape mictlsfs2ra( p;t0 etoxf3oadfmD  i s;s)seto(r io1lm e ivta(f Dtm( ono0oet  fciatfm2rm( s (4aexoircoatomte i o;s teuo(o3oydlpenlfcsat)aDrrur ;u1aeen i3iysfaDeauvpnu4artrxf3oy1lmDeluvs;t) rumiopnu1ole mnvta( srrr(m ;t4aetomociasls rl(mp;t4tlxrmf3tadlpD lnei t t2xmxr3iy1lmt mncta( a2um(ront0ale mfctldlaDumu o;(0tlxnxrctydlmDr nvsl()s2tmim3ny1lpeemietat)s2tr(mp;o1tlxoio3ilsla2eauvs;u)trtrxrcoatoptrln i;s0 2xmirpnudamte neslt aDrru pot1tpx  oeiltla umu on(0 leniocoa1lmDr ivi ()trxo(r3ny4lpe mietat  2taxmooo1alxn iciyt sDra(mp;t4trenmocoodlpt ln slt0 2xmxo io4lp  micilsfa2tmuro;u0opxoio3iasla2ul( o;(4altnirciodoateai i;t)trurxmpny1op  livtas)arurum ;t0optn icilt m2rlnvon(4 rermf ta1fpt aieo (0 etmxo nu1oltnmnvil(f rum(m nu0tet mo3ildfs emuvont4texrir oy1fpt lies;s)s2xrxrpny4am elfvslt arua(r no0olxo ociad s umu ont4teenxrcoytfa elu o s texoio3oudoltelici (  2rax  ;t1aptoifetld a2rlump;(0 reoio3iodopD  i slt trxoim3oo1ll   fciat) rrauroot1apxn feiydfs2rauvsnt0aeenifcootomtelnvs s0 rtrir io4op nmfcils aDum( p;o4aeto f3iltlm2ea(mpn() exnxf3totlaDelnvo;t  2ur(o3iu1alee fvsas)aDtaxmpnt1apenmf3iatfaDum(vs ()trxrxocio1fpDeluvo t sexo(r3iydlptemies ( arumumpno4tpx iociadfmDelu s;u)altrxr iydlmDrau o s) rumxo iu4opeelics ( arumx  ;o4tlt mf3ilsls ran o;u)altrirciotfmt  nvolt s2xo(rpio4lpte ncs (fs2umxr ;o1teeoiiciytlm2eauvo u)artnxf3to1omD ln i;s0 rumxrpnydlpeemicias sDrmx  nt0oltnmieilsfa emnmo;u0arxnxrciytoa   neol( trtm(mpio1om nmfctas aDra(rpou1oex  ictas sDumnvs;(0tltnmo iytop elivs t) 2xrirpny4lme  nes t s2tmu  ot0apxn i3iltfm umnvp (0tetnmr3oytfp rlies s0 rurio nu1ol n ncil() Dtm(mp;u0aexomiciytla ua( sn(4tleoxr oa1op r nei;s0t2xoiopoo1ole livs (f Drr(rpou1aex mf3iyslsDel(vs t)tltoxr io1fa ranes t seum(o3io4al e netatfarrmu o;u4opxnioetldfaDra( s ()alxrir ia1la eaivsl(0 2uoim3oudop  mivsl(fsrta(moot4tlxoioeilt a emnvo;() rtoxociotfm   uei (0sexo(r nu1lp elnesat artruro;u0alt  f3iatla2ran sn()aeeoiocoo1fmtrli slt) eumio ou1olee icsa(fa2ur(r nt0tetnif3iytla rmnvp;t0 etnxrcoo1oaD  uvi ( teurxm ny1lp   fctat) Duaxmonu4aet ifciysla eaumsnt0altnmr tatoaDeauvil(  2tmio3iodaltemnci s aDur(  ;o0tltnmi3tyd aDel(vs;u)artrir totom e ieil()s2xm(rpoy1om nmivsl( arumumpou0aleoifetydfa emu p;()texoif3oatoa r nvo;s0 exm(rpnu1optemivsls  2tr(root4alt mfciydfs ul( snu)areoxf3tatom rluesls0srumir3oo4ll n fet tfaDtmu  ou1oexomf3iad a elnvp;()texrxrcio1omDr ueo s) 2to(o oy4opee nvtl(fartmu pot0aexnii3tlsfsDran o (0aeenmf oy1fpD li s s teum(rpiy4omt  fetat) 2rrurpnt0open fciasfm ulu p u4 rtnio to1oatranei t s2umir3ny1lmt lnvt ( a2raumo;o0olt ioeiytfs el(vo t4 lxnif3iatla eaueilt0 2umxm3nydam n iei t s2urxr nu0tleoio3tltfm rauvo (4 lenxr3ta1fptrauvs;t  exrir3nodam nlncsls)arum(mono4olxnioeiydla2rmnms;u0 exoxf iotoat anvi ()srxrxo iu1optnliesl(faDumurpnt4aexniicildfmDuau s (4texrmrcoydoaDelivo t0s2urxm io1om e fvsl(f rrmxm ou1oeto i3iydlm uln pn() rxrxf3tatlp e ivi t)setmxm3iydolt  ivsasfa2tr(ro;u4apeo fcild s2em( p;u0 exoxr oy1om rlies t0 2to(m3nu1apenmicilt) Draxmp;t0tle  fciatfa rluvp;()teeomo oodop   nvil(0 2tr(o3iodlmt  fes sf 2trur ;t4olto fciadlmDrm(vo (0aexoif3ta1oaD lu s;(0 rtm(m io1ame  fvtatf Draxmpoo0tpeoioeiyt mDum(ms;u0teerifctatlatrluvo t0texr(o no4lltelnvsls)aDuax  nt1alxnioetysfm ua(vs;t0 leoif iytoateluvs () 2xrio3iu4openmivias  rrau pnt4alenmi3ildfmDea(vo;(4 ltoio3oo1laD auvs;s teurir3iydal nmnctas arrmuront1ope mieiytfs umn s (4 rtoif3io1lm eai s t) etoxm3io1altemivtls  2uaxrp;t0tle  o3iat mDeauvo u)areoxf ty1fmDr uvslt) etmxm nydapeemnctl(fsrumxmp;o0texn o3iytfsDemnmpnt4 lenir3tydom ranvo (0sexm(r3nydomtelivi ()sDumxmono1opxnmociatfmDem(mo u4arerio iatlp raieils) exrxo3oo1lmtemnvtltfartmx  ;t4aptn feilt m ulnmon()alxrxf oatop elieo;t trur(m io1openmivsatf rua(mp;u1altomfcildlaDum(mon()aeenxr3iydfa  auei s0 2tmxm3oy1amt lfvtls)sDta(ro;o1oltomietlt a2rmn s;u)trermr3ta1op   i ol(0 exrxm iu1al  mnvt sfarra(ront4apx io3ils m umu o (4tlxoirciydlm e i s;(0 2umxr iodapt lnciltf rum( p;o4tpenmf3iyt sDel( s;u4 reriocta1latr uvo;s)t2urio iu4optelfct tfarum(rp;u0optoiicildfs2rlnmo;(0trxomrcoa1omte u ols0tetr(opno1oltnmfvs sfa2ua( poo4oet  ieiltlm2ra(msnt)texnir io1fmtelu slt0srtr(r3oy4omte fvs s)s2taum ;o1tet  i3ils sDrmu s t) lxrircoatfpDr ieil() 2um(rpoudalee nci t s2ur(root0aeeomf3iltls2eln snu4 lenirctydlmDe ivil( tetoxr3oudaleelnet tfartmxro;t4tltnif3iat aDemn snt)treoxf oo1op   u ols0 rxr(m3nu4llt  ncslt) 2tmu ono4oetnmoetls s ulu s;(0aeenxo tadoatrlieo;t)tetmio oy4alt  iviat  rrmxro;t1apxnmfctydls2em(vp;t4tetrmr todfmD anvs;( t2urxm oodapt mnvta()sDuru pno1aex ii3iys sDelnvo;() rxnmrcty1fpDraiesls)truoxm iy4ap  livtatfs2um(m nt1tlxoiictasfsDrlu ont0 eenxfcia1lat anes ( t2xmxo nudlleelnvsa( aDtmu  ;t4aex  o3iysfa emums;(4 exnxo ia1om ranvi (0s2um(o3ou4lltelict ()s2rmur no0aeen icilt s2elnmpnt0tetnmrciytfa  lu ils  rxoiopno1am e fcsas sDtmu  oo4ape  f3iad mDuau o t)aetnxo3iotomt  ieo t  eumxopoodlm   ncs s a2rmum ;t0tetnmoctyslm2umu pnu4 lerif oatopDrlivi;s)srxrir3oy4lpe livia( s2raurpno0oetniocild s rlnvp t) etoirctydoa rlues;s  rxm(o iudole mnvia()s2raumono0tpenmfciaslaDemu o t4aexnir3iodfpteluei;s setrir3oydlp nmfvs t sDta(mp;o1oex mociydfm umnmp;t)trtnmo oydomDrlneil(0 2uoxopoydal   fctas) Dtau  nu0oeeoif3iat aDrlums;(0aexrmoctatfm  luei;( texmir iy1ll   fcs tf Drax  ou1aee ioetydfa ra(vpnt4tlxnmr tydfpDe neol(0trxr(r oydllenmnvtlt) rrmx pno0opxomiciasfm2uanvont0aeeomr totfaD ai i t t2trxr ou4apenlietat)srtr(r oo1apt ifciyslm eauvs t4tetnmocoo1opte u i (0tetmir3ou4om  lfvs ()arra(rooo4olx ifeiatfaDua( sn(4 renxo tydfmDrluei;(0truoxrpoy4omenmietlt  Drrur nt4aexomieiatls ra(vpn()teeniocoodlp eai sls0 euoxo3ny1lmt lictl( sruau p;t4aexoifciytfm rlu p u4 lxoircoa1lpDr u o t)s2ur(m oudlmt lietas a2rrx p;u4oee iociys sDrm( s u0 rtnio tatfp rauvs ( t2xriopoo4lm elics t aDuaxrp;o4tetnmf3iad a2ulums t4aeeomocoydomte ivols0trtm(mpiydole lnvs (f Dra(rp;o1oeen f3ild a2rmu o;t0aeeomf tytfmtean s;s) rxmxm oudap n neta(fs2rax  ;o1oleomoetatfa rlu o (0altnmo3totom eai slt0tetrim iodllee ncil( a2uaur ;o0alx moeiat a umn s;(4aexoxoctydlatr i i;t0 etoim nydlmtn neslsfarta(r ot4oet io3iasla2ea(vp (0 renxf3totla rauvs t0t2to(r3ny1lleelivsltfsrurx pnt1tpxomfciadlmDea( s u4 leomf3oydoat anei;t)setm(rpno1oleelfeslt  rurxmono1apt  f3ildlmDuluvsnu0arenif tadoatrliei s)texoxo iudole  neslt artm(rpoo4opxnmfciyt aDul(vpn() exrmrcoatfp elueslt t2uoxm3ou4ameemfci ( sDtm(mooo4texnmieilslsDran on(4trenxrcoadoptraueols s2tmxr nodameeliesa(  2ur( oot1olenii3tls m rl( s ()tlenmf tatopDrlues ( s2um(opoy1al   nvtasfsrrrx  ;u4apx ioeiyd mDel(vsnu0tlxrmo oydfp elneolt0trtoxo iu1olte feslt)s2taum ou4tlt  oetadls2ra( s u)tlxoxo totopt an s;t0 2toxopno1amenmnvtas)srtmu o;t0tlt ioeiytls elnvp (0artomo3oo1laDe ivo s) eto(r3oodalenmics sfaruaxr ou4tpenmi3ilsls2eaump;u) etnio iatlptrluvo t t2xrir iy1altnmfei s)s2taxmoot1oet io3iltlaDemn s t0tlermo3todomt  n ols t2tmir no1lleemicil()artm(m ;t0tpxomfeiad m em(vp;(4alxrmo tytlptrlu i t tetrir no4omtnlnvtas  rtm( pnu1aetnmfetydfm2emump t) renircoadlpDelies;t srxmxopiy4lle  ivia()arra(  oo1aetnifctys m2el(vonu0 lerif to1latr neo ( t2um(rpny1ll n fvtlsfa2tru ooo0tee iietld s rlumo (4arenxr iydomt ln i () euoxr ny4lm elnvs sf Durx ono4apx iictytlsDuan s;() exnmo oodla eanvi s) rtrirpnudaptelfetat  2uaxro;o0aexo oeildfmDelu p;u4 rtrif tatfmD livi t)sexmio no4ole lfcsl(f 2rmump;t0olx ifciat aDul(vp u)aeeomo ta1lpDraieol( t2xr(mpnodlltnmneias)a2um(r nt4aleoiictad a2rl(ms t4 lenxf tatla elu olt s2uo(opny1ap n nvtas)s2ururoot4aeeoio3iadfaDuan o;(4aetoir ootomtrlies;s0 euo(m3oydomte fvs ()a2tr(r ;o0apt  fcild m uau p;t0alxnif3iatoa r i i ()s2xoim iy1lmee nvs s artrurpno0olen fctls sDrln on(0tlenmfciydopt aiei;t0sruoxopoo4lm nmfcta() 2ururpnt0texo i3tldfs2eln snt4tltoxr3iotlmDrlueols trxrim3iu1lpe  nctl(fsrumxmp;t4tlxomieiltls2ranmonu4aetnmf oodoaDe ieils s2urio ny4lle mfvtltf rumur nt1aptoioeiytfs emn o (0 etnifcty1fate n o ()t2tmirpny4lm  mietas  Drm(rpno0optoifctlt s2rmn s u)alxnxrctodop e ueslt teur(r iu4al  lnesas)sDumurpnt1aee miciysfmDeanvs;u4alxnif tydoatr uvi;(0 2tr(r no1llee fci (fa2raur nu0ope mfeiytlsDeln o u) rerio3io1lm raueilt)t2xoxr ou1lmen nei (  rtm(mo;t1olxn iciys s ulnmonu)arenircio1lat aivs;s0s2urxr oo4oltemies s)aDua(mp;u4aeenmietas sDuaumon()arermo3oa1oa r iei s0s2xmxo oydolt lict ()sDta(mooo4altn o3tys sDemu s;(4aetrmr oatlpteli olt teuoxmpoo4optnlfci sfaDrmxrpoo0tltoiictlslmDumnvs;u)arxrmr3oa1fa rau i;()trum(r ou4om   fes sfsrtr( p;o4aeeomoeiasla2rmnmpnt4tltrxfcta1lm e n ols0texmiopoydalt lfesl(f Dtru  ou1aet  oetytfmDranmo u)tetrmr totfpt lneo;(0 etoxo3no4lpen ietlt)aDtru p;t0oeen ictys mDrluvs;u0aetrxfcootoa   ivi t0 2xrxr io4aptelieta(fartmum ;u1tltn oeiat aDranms u4tltoxo iodfptrlieils)teurxrpiydap e iet t) rtr(mpno4tptnmietlt sDemuvs;() lxrxf3ia1om  lueilt0teumio3iu4apt mfei ( srra(ro;u4tle mociadfm2emn o (0trtrxr oodomDrlnei ()srtmxmpnu1llenlnct ()sDumxr ;u4tpxoioetld s2uan pnu4tltrxr3iydlaD luvs s texmxopnydape mici t) 2tm(r no1tlto icilt mDuln snt)teenio3ia1oaD au o;s0s2xo(r3oy4ap e fet s s2raxm oo4texnio3iysfsDea( onu0tleomf iydfat ln o;(  2trio3oudlmte feia(  rtr(rono0oexnifeiyt a rmn pn(4altrxf3iydfmDe i ol(0s2ur(opny1optemfes ( sDum(rp;o0tlxo fciyd mDuluvp t0 rxrifctadoa rlies;t0 exoxr iudamtn nci s a2ta(m ;o0tlt mietat aDea(ms t0 eerxo3oytlmDe nei;()t2tm(m3oudomt miviltfsrrm(  ou4olt ii3iys mDulu onu0 etnif tatomt  n o t)trtm(r nu1lp   fcilsfsDumumpou1aleo iciysla2uanmp (4 rtrmocoa1faDrlnvs s texr(m oo4ame lneslt)arrmxrono0altnii3iydlsDuln sn()texoxf3to1opD ai il()teto(o io4lpenlivsasfs2tru  ;u4alx iicilslaDua( p (0 eenio oadfat  neo;s s2toiopio4ol nmnesa()s2rax pnt1tetn f3tldla2umnms;u)trenifcta1lp rliei;()srtm(m3nudlptemnesls sDuaxm ;u1oex ii3iysls uauvs;()texnmr tatfp ean s () 2xoxrpio1llee ivtat)sDum(mono0alenmo3tas mDrm(monu4trxrmocootoa raueilt)tetoir oy4amenlfct s) rtrurpnt4apxnmi3iydfsDemuvpnu)tetoxocto1fmDe u i;t0seur(rpoudolte fetas)sDtaumont4olt  ieils s2ulnvon(4 rtrxr3to1laDr ies s0 exoir oo4om nmfcs tf Dua(rp;o1aeen fctldfs el( pn(4tleomociadlatelivol()setrxrpoudam  mnci t  rta( o;u0olenif3ias sDrauvs;u0 etoxr ta1la eanvs;s)truriopoy1apee fctltf Dtmu onu4aetnmfeiydfs elnvpnt) eerxo3oytopD lneils)sexr(o iy1ol n ivs t aDtrx poo0olxnmoeiydfm ra( onu0tlenifctytoa   nei t0s2xmxr3iodom  mfvtlt)sDum(rpnu0teen i3tydfaDumn s;() renirciadomDrlueils0 exmxm iudlmtelnesl(  Drax p;o1tpeomoeilt sDeluvp;() lxoir oa1lm rlnvs (0 rxmiopny4lmeemieilt srtaumoot0oet ii3iysfs rln p;t)trtrxr3iy1laD ai olt0t2toir nodlm e nvtltfaDuaur ;o0apxomfciatlm emumsnt4 renifciytlp eanvs t) 2xo(r3oy4ap nmfcsa()aDtr(moot1oetnmicildla uan p t)aleoiocoytfmD aueol()truoimpoo1lme miet s) 2umurpoo1opeoif3iyt mDrlu o u)tltnmf3oy1opt aneo (0seur(o3oy1lpe mies t)sDtrx ooo4apt ii3tysls2ulumsnt) etrxf ta1fm raies;s)srxo(m3oo1om  lfctl()s2rmxrpou1tpxniicildfmDrmnmo u4altnxf3oa1lmt  uvi;s0s2umiopou1opt  fcsas aDra(root0tlxo feilsls em(vo t0 etomr ty1lpt lnvo;s)seumxr nu1apeelnvtls)s2trxroou4teeo octysfmDran on()aeeoifciy1omDr i o (0 etm(rpiu1llenmnes tfs2ta(  no1aptomieiys s2ul(vs t0tltoxo oodop eaneo;t sexr(r iydll nmivtlt) rua(ro;o1apt mi3ildfs2ul(vo t)arerio3tydfpDelivo t) eum(m3iy1apee fvia(  Dururp;t4tptnmi3iyd s2ua(msnt4tleoif todlp eauvil( s2xriopiy1op e ivilt aDra( ont4apx  feiadlsDul(vo u4aetoxocoatopDrluvil( tetm(o3ou1oltelnetat a2uaurpot4tex iociat s2el(mp t) ltomfciotfptraivsls  2xmir iudap e nvtatf rtm(rooo1altoiiciasfs2rauvsnu0aetnio3oo1lpDe ueol()tetoim ou1lpe lictlsfaDua(rono1tltoifciydfaDemn s () ltomr3todop e ieo s teuo(o nodale mieta( s2urx  ;t1alxomfetytls ra(mp;(0 renmo3oodlaD li o s  exm(rpoudom e ivsasfsrurum no0oltomo3ildfmDeaumonu4arxrmo todfmDeaivi;t0srtmir iy4ameemietas) Dum(rpoo0oex  feiltlm2ulnvont)trxnirciotoatrauvo s)sexm(o oy4om nmfci ( srrmxrp;u1oltnmietydls2el( s () rtnxrcoatomDean slt  2to(r oodopenmicsat srumumpnu1opxoii3tysls2rl(vs;(0 etnxr oatfpte ueo;(  2xriopoodlmt lfetat) 2uaxr nt0olenif3iatfm2rmnvo;u4tlxomfctadlpteaieol(0teurxo3nu4alee fcsa() 2uau oot0alxomiciydfsDra(mpn(0 ltrif3to1lpte nvo s truoxo oydlmtelfvi ()srum( p;t4aetnmietlslm2em( p;(4tlxrxrcoodlmtrln i;()s2xr(o3oo1ap  mnvs sf 2tr(rpot0texomo3ildfm emn pn() lerif io1laD lu s;t tetmxm3iu1apee fcs t)a2ur(mpno4open feiyslm2rl( s u4arxrxrctytop  lueo ( trtoimpiudapeemivtat)aDum( pnt4opxn i3iyt aDulu o;(4 rtnxo3ootopt  iei;s0s2toxr3io4al nmnesl( arrru  ou0tpx if3ils a2ua(mo u) rtoxo oydom elu s;t)sruoio3oo4apenmfei sf rraurpnt0opx ifeildfs elnmp u) reomf3oadlmte uvols) eumim3iu4om nmnvsas)srrrumoou0olxoio3iasfaDea(mp;t0tlxoif3iodlm rli s ( srxrim3oodop emnetl( srumum ;t4tpenmfcilslmDua(mo;u0 lxnxrcoodla  anei t t2umxopoo4al  lneia(  rta(moou4aetn ictasla2emnvo;u4 eermfcia1fpDeaiei s)sruoir ny4lltemfesas arua(mono0apeomfcias mDrl(vs;(0trerxoctadfa rln ils) rur(opno1om e fetat)s2uaxmpno0apxn ociytfsDeaumo u4artrio oytoptrlueo s)srumio ou1lpte nvsas) 2trxrp;o0oleoiociadfaDul(ms u4arxoir3iytoa elneo;t0sexm(mpio4ll   ict t) Duaurpou0texomi3tad s ulums;t) rermfciadlp  aivil( s2umirpiy4omte ietlsfs2umxmoou4oet  i3ilt s uanvsnu4 etnir3oodfaD  ies;t0 etrxr nu4altemncsat  rrrurpnu4alx mietysfmDelnvpnt)trtrir3ootfat anvo;( tetoim oudapee fes s)sDtaumoot4ale  o3iatls ean o;(0tltrif tytlpD  i sl( trum(m3io1aleemfetatf rrrx p;t1oeto oeiyslm rl(vpnt0tltrio todomtrauvs t0truo(mpiydom nmnvsls aDuaxr ot0optn o3iys a2rl( p;t0aexoxo3ta1fateanvi;s0t2umimpnodomeemfesl(f rtrxmpoo4aet if3iat a rl(mp u4 rxomocia1lpDr n s;t s2urxrpiydale  net s a2rau  nu4texniietys mDea(vp u4 rxrmo oy1fptrau i;t0seur(r iu1om nlfvta() 2trx ooo0apen i3iltlaDeln s (4 etrxo3ty1fm ean i;t t2xriopiudol  lfvs s sDtau  no4tet mieiytfm2uau o ()aleoxr3io1om elivo;s)srtr(r no4oltemncias sDtau p;o0ole mocilt a rmu s;u4alenmf ty1faD ai o s)srxriopnudlmtn ivt tf 2taxr oo4opxniicildlsDum( sn(4altrxr3oy1laD li s;s)seuoirpiu1op   fcsa(
\ No newline at end of file
@@ -0,0 +1 @@
+n ilt0teumimpiu1lmtemfcilt)sDrrumpno4tetnmoeiys aDrl(mp t4 reoxf oatlmDeaivi;()t2trimpny1op nlfcsat  2uaur nt0apt ifetydlm2ra( s;t0texnxfctytlmt  ieo t) euo(r3no4apenmici t  2rr( pnt4olxn ietytfmDemnvs;u0altrxo3iadlp raues s0sexmxmpou1al emfvsltfaDtmxrono4opeoii3iat s ra(mpnu)alxoio3ta1fpt aivsl(0sexmirpnudap e feiltf 2tr(mpoo1tpx mietydls2eaumo t)aexnio iy1oa rlu ol() euo(rpou4lme lieilt a2ta(root0aptn ictls aDel(vsnu4 ltomfcoydom r n ils s2xr(opiodaltnmicil(fs2urxm oo1altn fetytla emumpnt) rermfcoo1opDr nvo ( t2uriopoydamt mnci s)arta(r no1tltn f3tldlmDrlnvo u0arxrmr3io1laDeauvs s trtoxm ou1ol  livslsf Dum(mont0olenmo3tldla ulumo;(4tltoifcootlpt au ils trxoio3oodolte fvsat arum( pou1aeenifeias s ul(vs;(4 ltnio iy1op  ln ilt) rxoxr3iodoltnlncsatf 2raurooo4oet ifcilt m2rln snt)aeeoio oydlpte uvsl()seumxm nu4apt lfciat)s2ua(ro;u4teeoio3iadlm rl(mp;t)teeoxf oodlpD  n ils)s2uo(m3iu1ol nmncia() 2tr(rpoo1altnif3tltfs ranms;u4tetrif iydopD auvs;s0teurxr oodll nlnvi tfaDrax pot0tpx moctldls2umnmp t0 eeoxf3tytoptrliei ( sruoio3no1olenlictat a2taxmonu0tpto ietls aDuanmo;(4alxniociydfm r i o (0seur(o io4aptnlnvtl(farta(rpot1olen ociytlm rmumsnu4tetrxf oy1omteau i s0tetrir3iy4llt lnvt s)aruaurpot0tptn o3iatls ulnvp;t)tlxomr tadfp rlueslt) exoir3ny1lmee ivias aDtaur ot4oetniociydfa2uaump;t0texnif tydfmtrln i;t)srxrim iy1lme  fvtl( sDrrx ono0tle mi3tasfa2emn o;t) ltoir iodom rli slt)srto(o3oydolt mietl()aDua( ooo1apt iieilsfmDrm( p (4trermrcoydlpDeli o (  2xrirpoudoptn ivta( arrr(ro;o1ape mocildfs2eauvp;t) eeomf3io1fpDe nvs;s)s2um(o3no1ameelfvsl(f Dtrx ono1tleomoeiadfs2ean pn(0treomf3oytlmDrln o;t0s2xoxrpio1ap e ncsas srrrxr no0teenmi3iytfaDel( o;u4teeoir3oo1oaDrai olt0teurio ny4omtelicia(fa2umxroot0alxo fetltfs2elnmp;u4 rtrir ta1oateanvi s  exm(r3iudlpenlncs tf 2umx  ;u4aeen fcilt aDrmumpn(4 lxrxo3oy1faDeauvi t0texm(m iodome mici tfarumu oou1opto fciydfa2rm(vpnt4tlenxo3ta1opteaneo;t)s2tmxr nydlme  ivias srrmxrpno0oeeo f3ils m ranvp t4 ltoio oadlat li ilt  etoimpny1lmenmfvtl(fsrur( pot1texoii3taslmDrmu p t)aeerircoytlmte iei;()srto(opny1opeelnetl(f Dumx o;u4aet io3ias aDra( s u4tltnmo tadfmt li s;s)seurirpio4llee icsatfaDrmx  ;u4texniociatla2uanmo;u4arxnmrctydlm eai o;t0s2umxrpoodlptelnvs (fsrurump;t4olx ifctls m2uau o ()teerio3tadfm  luvi (  eur(m iydoptnmnctatfsDua(mpot1aptoiieils m ulumont4tleoif3iodomD li o;t)srxmxr3iu4opeemfcs t)s2raum nt1alx iieildlmDum( ont)texnxr3oatoa rlnei s) 2tmimpny1omee fvsatfs2tm(mpno1aexnioeiyt mDulu p t)trtrmr oatfa eai i;(0t2tmxm3oydoltn ies tfarrruroot0tex  oeilsls2ran p;t)tltrxf to1fp  lieol(0srxr(mpnodop nmnvi t) Dur(moou4aee  i3ild a rm( p;u0artrmoctadfmDran o;t0setoim3nodlme lnct s aDraxr ot4altnmoeiasla2rmnmo u4 rtnxo3ta1oaDrai il( s2urxm3iu4lm nmfctlt) Dtr(mpno4oet  feiadfm2emn o u) lenxociadlmt aues;() 2urxo3iy4op   feta() rrru  no4oetn ietydfa ul(mo;u4tlxomrcta1la rai s;t0trxrimpoydam n fvias) 2rrurp;o0ole  o3iyd s rlnvpn(4trxoxr3oodoaD an s;t) rxrio3oudol  miet (  2ur(rpnt0tpe miciadls2ea( o;u4 rxnifcoatla raiei s0 etoim3iu1lpeelfvs sf Drrxmp;t4tpt mieiadfm2rlu o (4 ltnxf3oydfpte ivo;t)s2tm(rpou4ll nmnctl( a2ra(  ou4oltnmociasla2rlnvsnt0trermf oytfmtelnvolt)trumimpoy1lmeelfcilt)srumxmont4tpenifcilt s elnvo;(0 ltnif3tytfatean o;t) etoxr oy1op emiviat s2rrx ont4open i3tldfm ranvp;u0 reomr iytoat an o;(  2ur(rpou1lme lieil( sDrax poo1apxo i3iydla elump;u4 lenmr3ia1op ran slt0srtr(r oy4lp   ncsls) rrr( p;t0alt mf3tlt aDea(ms;()tetnmr iotfmDr ivol()texmxo3nodoltnlfeta(faDrrx onu4aeen i3tat aDrl( o;t0arerir3tytfmteaivilt  2xr(r oy1lmtnlivtltfartaumpno4oexn oeiys mDelumo t0aeenmocta1fpDr nesl(0texrim3oydap nmiesa(fa2tmxrpou4oeto i3tys aDranmo;u0tetnxr oydoaD ai o () 2umimpiy4olte fvslsfartru pnu1aeto ocilt sDua(mo;t4aexrmo3iatfp e iei () etoxm oydapeemicias)srumx pnu1tetomoeiyt s2ranmsn()altoiociytomDelnvi s srumir3ny1apen ictls) ruaxrono1aetnmi3tlslm2umnvs (4 lxrir3tydfmDr uvi s)seurxr oudolte fviltf ruaumoou4apen fetyd m2eanmpnt0alxomr3iotopt lues t0 2xo(mpoy4alt  ivsltfaruru  ;u4oleniicils m2rm( s;t4 rtnmo ia1fpDe i s;( s2xm(m3iu1ape mivsat a2trx pou1oleoif3ilsfa uauvs;u0teenmr totop rlnei t t2xo(mpiudal e fcil()sDrauro;o0tpxnifetatfs2rm(vs u0arenxrctytoaDranei t s2urio3io4oltn nvias)sDrm(r nt4tlxo i3iatlsDumnvp;()aetomrctadlmt  nei;(0t2xm(mpnu1am elnvtltf 2trum ot1apenmfeilsfa2rmumsnt) lxrxr tytfate ieo;t0trxrxr3nu4apeemfcilt)a2urxr no1aet  i3tlt m2ulnmo t) rtoxr ta1laD ai s (0sruo(o io4lptnmfcs tfs2rrumonu4tpt  ietlsfm umuvp;(4 etoir3oydop  au i;s0setrio iydom elfcsl(fartr(rpnu0teto f3ils s2elumo;t4 rxnmr3to1opteanei t)srxrir oy1opt lnvt (f 2rr(m ot1opxoiieiasfm2emnvs u) lerxrctatfat lu i;( srtmimpiy1lpe  netlt)s2rrumo;u1aetnifeils m2rm(mont0alenir3oodomtrluei;s)setrio oudale mivsat)a2trxrpnu0alto oeiyd mDrlumont4 ltnmo3oydlm   uvo;t setr(r oy4ame mieils  Draxmpnu0optniociasfsDra( s;u)trtrxo oo1om eai s;s)srtmio3no1ameemnesat)srtrumpnu0tptnmfctysla um( pn() rxomo iy1laDeauvils0srur(r iu4olee neslt)srra(m nu0altnifeiaslaDemu s t0altoxoctydfaDe iei;t)srxoxopnudaleemncsa(fartaurpnu1oeeoio3tlslm2ean p;t0 rermr ia1opt  uei;t0 ruo(r3nydalt lneta(farrm(rooo0texnmfeiytlmDua(ms;u4tetnmrctytlmDelnvo;(0s2toxm3oy1op e iesl( aDtaxro;o4opeo f3tasfs2umnmpn(0trenir3iytfm   iei;s trxo(m ny1opeelnvtl()arraump;t4olt moetyd sDranvp u4 rtrir3oydlaDrauvil(  exoxm nu1amtnlieiltfaDumxront1ape  oetas a ua( pn(4 rxomo oatop  lneo s)trxmxr no4optnmfvt ()s2umx  nu1tpto feiysfmDumums;(4tetnmo oytlpDrai s t) rxr(r nodomenliesatfaDtaxm ;t4tpe iieildlsDemu p;u0aeerxf oo1latrlueol( trxm(r oudopen fetlt)sDrmx o;o4oeenmoctat s2rm(vp;u)tlxnxf tydoateln olt)t2xr(rpiudlmenlfeiat sDrmxront4oexo octatla2el( o t0artnif oadom eaivsl()texrxmpnu1lptemivtl()sDtrum nu4tlxnmoeildfs2rlumont0 rxrifcoy1op rluei (  rxm(m3no4omt lnci s arrrx  ;t0ole ioeiysfm ua( on()trtnio3iadlaDeauvslt)texmiopoydlltemicia() 2uau poo1oltnmoctatfaDrl(vp t0arxnxr iytopDeanes;t0truo(r3oydoptelieslt)arum(mpnt0tleo ociadfm2eauvo;t0altoifcoa1omtr ueil( tetr(m oy1amtn iei sfaDtm(r nt4ole moeiasfm2eln ont)artrmr iydomDeaivo;s0t2xrxr3no1ap nlnvtas) rrrx o;o4tle moetad s emu p;(0aeenmf ootlmDeaivil() 2to(rpnu4opt mnet t sDraurpno4alx mfciys m2em(ms u4aetrxrcoy1fptr nvilt)s2tmxm3ou4lmtnlies ( a2rax  ou4apxnmictasfaDua(ms;u)trermoctatoaD aivi;(  ruoxr3nudap n ivsls srrrx pot0tle ifeiadfaDrlump;t0 lxomr io1latrln s (0 exoimpoodomte netas srtrx  no1teeomf3tytfa2umumpnt4 lxnmr3iy1opDe i i;t) 2xo(r no1ale lfci sfa2rrxrp;u4alxomo3tltfmDua(msn() etoio iydom elu i s0 2tmxo ou1lme mietlt a2umxm ot1oetn oeiysfaDeaump;u0 ltomr3oydlat aues s0srtoim3ny1lltemnei s a2ua(  ot4alt if3iydlsDum(mo;t)trtomr3oydlaDe ueols tetmxo3iy4lm elicsls) Durur oo1alenif3iad sDumuvo;t) exrxociatfpDrlues;(0trto(mpiodapeemncta(fs2rm( poo4opxnioeilsfs ra( o t4aexniociotlp r u i s s2triopnudopt  nvsa( aDuauro;u0tlxo oeiydfa2ranvo u4aetrif3oa1faDelueil() ruoxopiydapeelfcsat)s2raxm nt1optomo3iatfs2ran pnt0 lxomrcoa1lm r u i ( t2xrio oy4amen ivi s artmu  ou1tpx mo3iadls rln o;t4aeeoifctydfpDr nvs;s srtoxr3io1opt mncsasfaDtruroot0alxn icildla rmnvs;t0texnxfctotfmte u i;(0t2umir3nydlpenmnetlt)sDtmxrpnt0texoii3tasfa ul( on()altrxfcty1fpt lu o;t0texo(o3io4alt mietas) 2ta(r no1olxnmf3tydfa rau o () exnmf iotopD  uei;s)truoxm iy4lmee nciat)srta( pnt0alto feiad s el( pn(0 rerio3oa1lmtrluvi;s)trurxm3oo1am emncils artmur ;t4tpe iietldfs2rmuvo;(0aetrmrctydfmt livsl(0t2um(o3no4lp nlfvia(fsDtrum ot0optomiciydfsDran s;u)tlxnircoodlm elu s t0 2uoxr ny4ol nlfvil() Dua(mpoo0tee  ietysfa2emnvp;u)tetoif3tytla rlieils)sexm(r iydopt livsa() Dta(mo;o1apt ifciys sDelnvs t4aetrxrctotomtrlneo t)trtrxrpnu4ol e ncta(fsDurxr ot4tpt  i3iydfaDrl(vpn() rxnxr3to1oa elivo s0texo(rpno1al n nviasfsrta(m ou1tpen f3ildfa rl( s;(4trenifctotfpDrluvi s0 2tmxopoodapeemncs s) 2rrumo;u4olxn ieild a2rlnms;u4arenxo tatoptelivo;( s2xmio iodlm nlnesat s2ur( oou0apxomicildfa2uanvs u0arxrir ta1fatrluvolt  rurxr ou1amtnlfvias  Dta( p;t0tltoii3iasla el(vonu0teeomfciy1lpDeanes s) rum(r oy4aptnmnvtls)sDtm(root0alt  ieiltfaDum(vs;(0 etomf3oo1fpD li s s0 eumxopoy1olt lnvtlsf Drmxmp;u4oeeomo3ils aDeau s u4tlxoir iodfpDelu i;t)s2tr(r iydlp emietlt aDtrurpno4alxnmoctldfaDrluvon(4alenmf oytoa  lieol( tetmxo oy1ol  mivi () rtaurpnt4alx mfeilsfs2ulnvp;t0teermo3oo1fpDeluvi;s t2to(opiodolee fcsl( srumxr nu1tleomoetatls2rmumsnt0tlxoxf3tadoatr uei;s0teum(o oo1lltnlivils a2trxmpou1tex mi3ild aDumuvo;u0 rxnmr3oo1lptrlnvo;s0srtoxo nu4altemivtls)a2rmu p;o4tptoifeildfs umuvo;t0trxnxocoodom r nesl(  2xoim nudlmenlncsas aDrau p;t1tpx io3tydfaDrmnvs (0alenxo iodopt  nvolt) etmxo ou4lpe  fes s a2rax  nt0olt if3iyd a elu pnt4trtnxr3iatfpDe u s;s)teum(o3oydam  lnvs s srrm(m ou0tex mfeild aDeanvsnt0texniocoadomteluvslt  etoim3ny4lme lnetatfa2tm(mo;o1opto i3iatlm2em(vonu4aeenio oo1fmte neo;s0trumxm oy4lmeemfvsl( s2ua(ro;t0olx ifeiad m2um( s t4aeerxrctotfm   u o;() 2tm(m3ou1lmee nesat a2tau onu4alto o3iasfm2eau s t4texoxf iotlmt aueils0trtm(r iodalee ies s)s2raum ;u0alx mieiltlaDua( s;t4 rermrcia1lp   uvsl()srtm(mpoudalenmfvtlt) Dtmu p;u0tetoio3iytla em(msnu) rxoio3iadopt  i ils s2toir3ny1ope liet (fsrtaum nu0tet  iciysfaDra(mp;t0arxomr oadop rlueo t)tetriopoy4al e ictasf Dua(m ;t0oee  ociytfm ranms t4trxnif3tadoat  uvs ()t2xmir nodaptnmfcils)sDurxrpno1tet iictlslm2rl(mp;t4teenxo tydom rln il(  2um(rpou4lm nmfci t) Drrx  no1oet miciyd a2em(vo;(0tetoio3iy1fpt  ivs;s0 2uoxr3nu4al  lictls srumx  oo4optomocildlmDelumpn()alxnir3oodlmtelues (0seumirpou4am nlfvi s artr(ronu1tpenmieiltfm2em( s;u)teenmfcoo1lptelnvi t  2ur(r oudlptnmfcia(fs2rm(rp;o4texnii3iasfm2emnms t4tlerxf tadfaDrauvolt  euo(mpny1lmee nvsltfa2tm(rpnt4alto f3iyslmDean onu)aeenif oy1oaDrluvi ( trtmxo iu1ap   nvi s arumxrpnu4tpx io3tltfm2rl(vs u) ltoifcia1fateauvs t)srtr(opiydaptemfctl()s2taxr ;t0opeo oetyt a2umn s u)alerxr iotfaDrai s;s)teuo(m3nu4am n iet t)a2uaxrooo1tetnmfeilsfs2eanmpnt0aeeoir3iydfmD  uvol()tetoxm iy4om nmfeiasf 2ur(  ;o4olto octasfa2umnvo t)artoir ta1lp eluvs t)srurir3io1omt lfcs ( a2um(  no0olx  i3iydfa2um( s;(4tetnif ty1fat  uvo;s) rtrxrpiudole  fci tfsrtrumo;u0texomocils m um(ms;()tlxnxociotlat anvs s srur(o iydlptemfei (  Dur( ono0tpxn f3tadla2emumpnu)altrmr iatlm ranvi ( s2uoxopiu4altelicsltfa2rr(rpno0tlenii3iaslaDrln p (4trxrmo oytopt an o;t srumxo nu4ap nlieilt a2ta(r ;u0alt  ieilsfs ulnvp;u0 rtrxr3ia1lp r u s;()s2toir oydolen fet (fa2ua( onu4tlt moctyd s2rlu s u)alenxfctodomD  nvs s) rurxr no4llenlici s  Drrxr ou0aptomfciatfmDrmnvp;t0 ltoxrcta1fmD lu o () rurim nudaltnmnvs t aDrax  oo4olxn ieiyd mDeln pnu0artnifciatop rlivols0tetm(opio4apt  ieslt  Dtm(m ;u1tptnio3ildla2ul( p t0tetrif oadopDeln i s  exrirpny1olenlictl()a2umu  nu1oltn feiadfm2rmuvp;t4trtrmf iytfptrau ilt) 2trim3iy1om emivsas aDtr(rp;o1oeeo f3iadlm2em( p;t)aetrio oo1fmDrai ils0teumio oo4am e fcilt)sDtruroou4oexn o3tldlm eanmsnt4 eeomfctotlp elnvo s)texmxmpio1lpenmfetas s2rrxm ;o0tetnmfcilsls2eaumpnt4arerio oytfate neo ( setrir iudllt  nesa()sDuau  ;t1aet mieiadlaDrlumpnt4 lermr3oodfp elu il(0setrir iodolenlivi ()s2rr(monu4apxoiieiasfa2umnvs;(4alermo3iatfmD lnes;() ruoim3iy4ol  lncslt aDurxroot4olt mfciydlsDrmnmp;()trenmf3io1omte n s (0 etr(opnydamt mivilsfsDtaumo;t1aexo fciytfa2umuvo;u)arxrxf3totlateai ilt0t2xoxm3ou4lle  netl( aDtmurpoo4alx iociat a emn o (4tltnxrctodlmDrlu sl(0 rto(m nydamtelivil(  2rrumpnu1aptomo3ias s2um(vo (4 ltnmo3tytfaD  u il() etr(mpiy4lmtnmneia( s2um(  no4oleomfctlt s2elnvs u4 rerxo3iytfm eaivi;s  rtoxr3no4lmte icils aDtaum nt1apx  iciydfa rl( o;t4aexomfcoadfmDrlues ( trxoxo iy1al  lnctl(f Draxr ;t4oltnmociydfm2umn p;u) lenxo tytoaDrauvo ( teum(r nydlmenlfvilt)sDtrxrpnu4tetnmietad a um(vo t)tlxoif oa1lp r n slt)s2urimpoy4lmtemnetl( a2um(mo;o4aleomoctlsfsDumnms t4trenif iy1om rlueslt0t2tmim3iy1al n fcta() rum(rpot0aptoiiciys aDul( s;() lxrmfctydfmte n s s)trurimpiy1lm nmfeias)srrmx pnt1aee moeiadfs2uluvpnu)arxoir3iadopDrluei;(0trxr(mpny1lmtnlnvta() 2trx p;u1tlenmi3iasfs el(vonu)areoif tytfaDrai slt t2tm(m3iydaptn ieil(fsDraxr ;u1teen oeiasla2raump;u0artnmr ty1op raivsl()teumio oudlm n nvia() rta( p;u4teeoifetasls2rau pn()aexrir iydlate nvs ( texrxr oy4altemncsasf 2rm(m nu1alenio3ilslmDua(vpn(4 eeoxr3ty1lmt  i s;(0 etm(r3ny1lpee fcta()arrmxmpou1ale iicilsfm ua(mo;t)aetrir3ty1oaDrlneol( sexm(mpnu4lle lnvtl()aDurxmoou4tptoioeiys a eanmsn(4aexrmrcoatfpD  nes ()teto(opiy1opt lfvsls  rrmx pot0tpt  ociyd sDumnmp;t4aeerircoadoatr ieols trur(r3iy4opeelfetl()sDurx  nu4tpx moeildlaDrm( o;() lxrxfctadfpDe uvi;s srxm(o iy1lpe mieils) 2um(ro;u1oexomi3iydfm um(vo t0altnxrcootlmtrlivolt)srtoir3nu1ope lfcs (f Dumxro;t4tleoioetaslaDrau o u4tleriociatfmD  nvs;s teuoio3iy1amen fctlsfsDrmuroou4tlxo iciytlm2uln s;(4alxnxfciy1lm r i i;s)setoim oo1ame  nviasfsrtrumont1tpxnmoetat a ean p t) rtomr oa1fpt lnvilt setoimpno1lptn nvi sfsrrmurp;o0aptnii3iysfa raumpnu) reoxr3oydom e uvi;( s2uoirpiu1lltn ici t aDrauronu1texoifetyt m elnvpn() lxoxr3oa1fmt ln ils srur(m ny1omt mfvsl()a2tmxronu0aptnii3iyd mDulump;t) ltnxr3oadlptelu s;t)s2xoir nydomee nctasf 2taurooo0oeen f3tld mDra(vo;() etrxfctadla   ueo;(0trtriopio1ap emfeslt)s2tauronu4tlxnmo3tlslmDumn o;t0 rtnmo oytla r u s;t t2xoiopoo4apeelnesl( sDtru  ;o0tpt ii3ilt s2rm( sn()alerxr3oytomDe neo;t0srxm(o no1ol  mici s a2rm(moot0tet mi3tatfaDua( o;(0trerxr3tydfmDeli sls t2tmxr3ny4apt  nci t a2ra(r ;t0opx ii3iysfs uau s (4 rxomfctydfa r u i ( s2xrxo oy1omen nvtls) rrrxmoot4altoiieiyd aDum( o;t4alermocoadfp e nvs;t)s2xoxr3nudopen ivi t sDua(mpnu1tetnmi3ils m2ea(mont4aexomf oatfat lu s (0 eurxr oodolenlneilsf rrmxrpou4alxomi3iysfs rmn pnt0 lxoxf3tytfmtranei t trxoio3iu4apen fvt t srtmum ot4alt  fcilt mDrmn onu) rxoxfcty1op  li o ()sexmxo3nudop  mfcslt) 2ra(mont1alxnii3iysfm ua( o (4trtnmr oa1optrli slt  2trimpoo1optnlfvia(f rtau p;u0texomo3tas sDea( ont) lerxf oo1opteli s;s s2xrio3iudlmee fvs t  rtrxrooo0aptomi3tltlsDrlnmo t) rxnmrcoodlmt anvo ()trxmir3ou4llte ncslt)sDraxr oo0texn ietad m2umn p t4aeeoxrcoy1opteli s s0trtoxmpoy1alenlnei (faDum(  ;t1texn i3iytlsDumums;(4arxrmrciotfa raneil()sexmirpiodopenmicsas aDua(m nu1aeen oeiytfs um(vs;u0 lerif3oydlpt aneo t teum(rpiy4am nmfvsasf rtaur nu4oexo i3tysfa um(von()tlenxo todlpteaueslt0 rxmir3nodop e fctltf Dtaurono1alxo octad a eauvs;u)trermf3tatfp eanvsls)s2tr(o3nodap elnci t  Durump;u0tpeoioctyt sDumnmpn(4texomfcio1faDelivils0 etoxmpio4lme lnviat)sDrrxmp;t4tpt  o3iadfmDuaums u0altrif3iodlpDrli i s  eurxr3iy1om  livs s)aDtaxmooo0tle mfeiytfm2em(vpnt)tlenir ty1lmt  n ol(0setr(opoydap e fcs ( aDrmu oou1oex mieiad mDea( p (0 leoxf3oydfp e u o;s) exmxmpio1ale mfesl(  2rrxr no1tlx miciyslm2rm( s;u0arxomr3iatfmD luesl() 2to(rpno4om emfvsl(  Duru  nu4tlen feiasfmDrluvo;u0tltnmf3tytopt  n i;t0srto(m no1ll n neilt  Dua(mp;o4tet mfctysla uln s (0texrmo3oydfaDelueo;s)srtrirpoy4llt  ncs ()s2umuro;u0tpt  ietyt m2ranvo;u0 lxnmocoo1lmDe n slt0t2trxm oy4amen fcias s2rmuroot4tle ioeildfa ua(vs;()trxoio tytfptrli o;(0srtoir3nydamtn ivs s sDrruronu0tlx mociyslm2rauvs t) etnir oodlatelnei;s) rxoio3ou1olt  nci (fartmumont1aexnmfctls m2ra(vsnt4areoio tydlp ranvo (0s2xrxm iu4oltemietat aDra(rp;t1aee  ociatfa em(mon()altnif ty1fmte i o t srxm(r iodom elneta( a2ua( oot1opxnmieild m2eaump;(0 leoxocty1fmte ieils0 2xo(r3oudapt  ics t a2taxro;u4texn ictydlsDumuvo (0altrmfciydlpte uei t0texmxm io1oleemfvtl() rtaxro;t4oeeoifciyslaDelnmo;t4alxrmf3iytfp e u o s  eum(r3oo4ol   nct (fsrrmumpnu1olxn feiaslm2uanmo;u0 etnmocio1omDe n s ()setr(opnu4lmeemnvia( a2tru  ;o1aeeoio3tadlm ulu o (0 ltnmf iytfmt  ieils0 etoxo3oudapenlnesl(  rrrxr nt1aptn o3iadfa2raumsnt0 lxoir3oo1opt lu sl()s2uo(mpnydlpt lnvt tfarta( pou4aptniicildla emnmonu0artnxf iatfmteai ols0srxrirpny1lle  fciasfarraxm nu0tlx moctasls emnvp;u)texoir oytlp  lu s t trxoim3iy4lmeemfesasfaDrr(mp;t4aetomfetldfm rmn o t4arermrcoytlp  liei;t0s2toio iy4am   nvia()s2um(rpoo0teeoii3ildlmDulu p;()artnif3iydlm raivo t0 2trxmpiudamenlieta() Drru pnt1aptomoeias a2ranmont) etnxfctatlpt  uesl(0texoio nodam   netatfa2urumont4tee ioeiytls emn sn(0teerxo ootlmtr uvslt t2urir oy4aptnlnetl(  rtaxrono0tpxnmicilt s emuvo (0trxnmrcoydlm eaieo (0s2uoxr3no4llen fct s a2rm(rp;t1altnmo3iysls rmnvp (4tetnifciydopt an s;(0setrxopny4ope  ivslsfsrumx o;u0optniieiltfaDrmn p u4artnxo3todlaDelneo;t)s2xo(opoydlptnmicsls) rtm( p;t1aex mietadlaDumnvp (0tlxoxr3iy1lmDe nvo (0setoimpny4al emnesl(  2trump;t0tpeniictadls2rl(mon(4areoxr oydlm rlnvi s0 2urir oo4omte iesatfa2truro;t1aee  oeiydls2emnmpnu4aeeniocoydfpDrlues;s0 2uo(opnu4alenmfvt t)arraxrp;u1oet mi3tyd a ul( o t0 lerxo3oytlmD ai o;()sruoxmpoodlp  mfvt sfartmu p;u0tltnifctysls2rl( snt)trxrmf3iy1op eanvo (0s2xmim3nodaltemncilsfaDuax  ;o0oex  o3iltfa ulumon()arxnmo io1lp eanvol(0 rxmxo3iodlmenmneiat  2um(  oo1aexnio3tlslsDum(vo;u4artrxfcoytfaDrlu o;s0 rtmim3oy4lm elnetl( a2rm(rp;o0altomfciatla2ranmsnu4alxrifctydopD lnvo;() exrirpiy4ame  ieiatf Draxm ;t0aexo fciltlsDumuvp t)trtnxr3tadoa rln s ()sexr(o3ou4oltnmnesltfs2trumo;o0tltoiiciadfm2ua( p t4 exnmfctytopDr nei s) rtmxr io1lpe  fvt ( aDrm(m no0alx iictydfa2el( p u4artrmrcoo1fpDrlueo (  rumxrpiydlmenmivi ()s2ta(rpnt0teeo fciydfaDumu pn()aeenmr tytomtr ueo;s0t2xmxmpiy1lle  ietas aruru pnu0opeomo3ias s rl(ms;t0 eenmrcio1oa eanei s)trurxr3iy1apt micsls a2rmu pnu4oet  iciatfmDem( s ()tleomrcto1fa rluvs;( s2xrxrpiydaptnlfcta(fs2raxmp;u0teeo i3tlsfsDemuvo (4 etoxf3oydoa  anesl(0 2toxr no1ol e feil(fa2um(ro;t4aptniieiatfm2uanmo u)aexriocto1lp rlnei t0sexmxrpiu1ameemnesls) 2ur(mont1apxoio3iasfa2elnvo ()tleoxo to1optrli s s)trumxo nodam nmivsltf 2uaumono0texnmoeiydls2el( o;()tltrxf iodla   ieol( setr(r3iy1op nmnctat)sDua(mo;t4tetnmfeiaslsDrmn o;t4tetoxociotoatraiesl( teumxo oy1lmtemfcil(f rrm(  nt1olx  ocias sDua(vs;u0texnmo ta1laDe uei s  rtoirpnodolenmnvsls  rraxrpnu0oee  fciyd mDum(vo;u)tetnxoctadfpDraues ( s2xrir nydap nlncslt)aruaxrp;t4tpe  ieiydlsDumnvp u) exrif tytlaDrlivi;s)t2trxopny4ame mnvs sfsrtax onu4olxo i3iasfa ranvsnt4 exniocty1lmDrauvil(0 rxmio3iy4llee ict t sDur(mpno0ope mfctyd a2rm(mo;u0 eeomr3iodlp  aies s)teurimpoo4ap nmict ( sDrru ooo4teto o3tad a ua( pnt4aetomrcoatoaDr uesl(  eum(rpno1opt miciltf rrmxr no1oexoif3ild a2rl( o ()aleomf3ia1fpDeauvo;(0 exmir ny4altnlnvta(  2rrumo;t4alt  oeiys sDra( p (0trxnmo3oytom raiei;(0tetm(m3ny4opee fvi s  Dtm( pnu0tex io3iyd sDemu o;t) rtoirciytopDrluei t)seuoxm oo1ll  mnct t)arurxr ;u4oexnmieiaslm ul( pnu) eermf3tytlmt luei;t0 ruoxo no4amt  fvtas) 2tm(  ou1altnmieiadfmDum(vo (4tltoiocoydomtr ueilt s2xo(mpiu1amee ivtls)s2ra(rp;t1ape  oeiltfaDuaumo u) rtoif tydlm eliei;s) euoirpny4am elneiasfartrxrpnt4alto ociasla2rm(vp;t0artrmr iadla rauvol(0teuoio oodlp nmfeia()artrxmp;u4oetn i3tysla em(msnu0 exrircia1lmDrau o;s)srtoir3oy1amee iviasfa2umx pno1tpxnif3iysfs ua(mp;(4aetnmo iodfa e uvi t  rurirpno4ap   fvtat  Dua(mpnu0oltnioeiyslm rmnvsnu)trtnmr3ootoat aiei;s)srtmimpiy4lmeelfvtat) Dur( pno1tltniictlsfm2ulnvsnt0 rermfcoa1laD aiei;(0trxmir3no1amen ictasfaDrmum ou4apxnmoeiatlm2em(vsn(0 exomr3ta1oa e ieil(0 rur(m iydlp   ncsls)a2um( p;o0aex mi3iydfs umuvo u0texrif tadfm   n o;s)t2urxo3oo1llt  ncs s  rra( ooo1tetoio3iatlm2rln p ()aleomr3todoaDr ivo;s)sexmxo3iu4om nmivslt  Drrx o;t0aee io3tyd mDra(vpnt)alxrir3to1latraieslt)srum(mpnudlme lies (f Dra( p;t4alxomociys sDranmp;u4 ltnir3totfpD ln i (  etm(o3oo1ll emnvtat)a2rru oou1aptoioeiasfa2rmn sn(0alermr3oydla elu o;t) etoxm3nodlm  lnct sf rrax  ot0tlx mo3ilsfs umnmo u0arxoio3iotfatraueo s)t2urim oo4apt mfeil(f Durx o;t0olx ifeias s2em(vp;()altnmf3io1om eanvi;t setoio3io1altnmfvsat  2raxmp;t1oet mfciltla elump;t) rxrxf ty1oa eaneols)setmiopoodomee ivt t srrmum nt0aexn octysfsDul(vsn(4 eerxfciy1laDranes t s2urxm3ou4lmenmnct tfs2tm(r ;o0aetomi3tad a ra(mo (4trxoxrcoo1om   ueslt) rxm(r ny1lpt miet tfs2umum oo4oltn oeiat s umnmp;t4teeoir oodlaD  uvs s0setrirpoo4ll   fcils)sDtrx poo1olx mfetltls ea( s u4aexomr to1lptr uvsls t2to(mpoodll e ics tfaDrmu ono1aet  ieiytla2um( sn(4trxnxr3io1omDrlnvsl()seumxr oudol emnviat)srtr(rooo1alxoifetytlm2umnvonu)tleoifcty1faDr i s;s) 2trxo3iydomeemfvsas s2tm(m ;o0oleo oetlsfm uau s;(0 rtrif ia1faDrlnesl()texm(rpoudlpt mivsas aDrrx oot4tle mf3tldfs um( pnt0 rtnxrcto1oaDrluesls0t2xmir nu4alt mncil(fsrururpno4olen feild m2uan ont4tltrif iodfpDrai o;t0 exm(m oo1al n ivilsf rrmxmp;o0olt  o3tadls uln o (0arxomocoatlm eluvsls texoxrpio4ome livi s) 2tmumpno4tltnio3tat m2ulnmp u0aexoio3iydfmte ueil( t2xoim3oy1lm  mnctl()srtr(ro;u4tpx iiciatfs2uluvp;(4 lenircoa1lmDelneilt0s2trimpnudapenlfvilsfaDtm(m no4opxoifcild mDumn o u4tlxnif3iadoaD lies (0 2xr(r3oy1am elfciat)s2ra( p;u4ope mf3iysfa2eauvpn() eermf3ta1fpt luvi;( tetrxo3io4lpteliciasfsDumum ;o1oexnmoctls a2rmn pnt4tltnir3tatfp  ai i;( s2urimpio1ol emfvsas) 2tmurpnu4apx  i3tyd mDum( pnt)treomf iatlp rlnes;t  2xr(mpnu1am  mfcs sfaDuaurono0tpxnmociys sDemnmo (4trtnmr iatfmD lueols) 2uoxo iy1op nmnvtls sDtr( o;u4aetoiiciydlm2el( o t) ltomf3iadoa ranvi t  rtrim3nu4omt  ict (fa2tax o;u4tlx mo3tadfs em(vpnu4teeomrcoatoa rlnvolt s2urimpiy1ll elncsatfsDrrump;t4oetoifctadfm2rlu p;(0aetrio3todlp  ai il(0sruo(rpnudlle micslt  Dumxmooo4tlxo oeiysfsDul(mont)arxniociatlm e nvs (0sexo(m iu1op nlfeia(fsrur(mpot0texnmieiat mDemu o;u4aexomo iadfptelueols srurir iodamee fcsat) 2tr(mont0oee  fetytlmDel(vo ()treoxfctydlmDeaiei;t) rxo(rpiu1amenlivsl(  2ur(rono1tptoioeilslm rlnms u)alxrxr3iatfmtelueo;s)seuo(opiu1lmtemfci (fa2tmu p;u0oltoif3iatls rm(mpn()tlxrir iydoaDeluvol()sruriopiydomee neta() Drm(rono0tetoiictad s2rmu pnt0aeenir totlmte ivil()t2xr(rpno1am  lnei tfa2trum ot0oee ioeilsls rm(ms;(4texoio oy1fateaieilt)t2to(opno4openmfvsls  rtmxm nu4aex  i3tatls2em( o;t4aeenio3iydfmtr nei t)trxo(r3no4olee ivi () 2rrxm ;t1aexomfeiad m eln p;u4 rxoxo3iytfmt luvs (  rtrxr iy1lltn ictls aDtax oot0tpen f3iadfm uanvs u4trxnxo3oytfmD ai i s)t2xm(opno4lltnmivtas arrmumoou4tee mieilslmDeau ont4 etrif oytlptr i o () rto(opou1om  mics t sDrr( onu0ope io3iaslmDraums;u)arenxf iotoat aieilt)teumim ou4olte feil(faDrmxm ;o4tpxn ieiysfmDranvo (4 etoxf oydop  ln s;s0seumxm iudllenmnct tfsDtm(rp;u4tpe ii3iytfaDumumpnu4 lxrxocoa1oaDr nes;s)srtmxrpiudlpe  nctls)aDum(rpou0aee  oetys sDran pn(4aetomocootlat auvi;t0s2urxmpiodame lics ()artm(mooo1olto oeiydla2rm(vp t0aetnio oadom  li i t) ruoxmpnydlp nlfcia(faDtauro;u1alt mfctyd m ua(vo;u) eermociodopDe ieo;(0s2xrir3oo1lleeliet ( s2rmumonu1apenio3iltfa2rlnvsn(0 rerxfcto1lp   nes;t0 eumimpoo1lp nlnetatf Drmxmo;u4oexn ociysfmDrmnms t4alxoxf3oadlptr u i;( trtoir3ou1aptn fetat)a2rr(mo;t4aleoioctytfs2rmnvs u4 lenio ty1laDeluvo (  rtr(o3oo4openmivs s)s2rmump;u1alxo i3iydfm emnmp u4trtnxf io1opDr neo;s teumir3ny4lptemncs t) Drax onu4opxoiictysls2uau p;t0texnxf ia1omDr ivo ()s2xmxr no1lmtemnci s) 2ra( pnt4oetoiictlt m2uau s (4altnio3oatfp rluvs;()sexoxr iudll  mfvta() rrmx  no0opxn i3iydls2eau pnt4arerif3tadomDraivo;t)trxm(o3io1am n ieiat) rrm(  no0tee ifctyd aDelumo;t0 ltomf ootoa  auvol(0 exoxr3no1altelnctas aDuaxrooo0aex iietldfs2ulu p;()altoifcto1om rli o s sexr(r nu1ll   nvsltf 2taumonu4olx mociat s2rm(ms;(0 eenmo3to1lpDe ueils  2tmxr3iy4ol nlncs tfaDuau pno1tetomieilsfs uaumo;(4 lxrmo oadfa e ies;s) eum(rpoudlme lfvt sfa2rau o;u0oeenioeildlm ra(vp u4altoxr3iy1fm e uei;s)setm(m3ny1alt  ivta()s2rau poo0alxnmiciat a eau pnu0aeerifciotopDr u il(0srxm(o3nu4ap  mfes () 2taxro;u4optomfeiadfm emuvo;u4trtoio todop raiei ( s2uoirpnodlme lieias aDurx  nu1tlt ioeiyslaDrl( snt) etnmo3iy1fate neolt) 2umiopiydal emnvslt) Drmu oou1tpeo iciydls eau p t0 etrxr oa1lp  luvi s0srum(mpnodapt  fvtlt s2rm(rono4ope  iciat aDrluvs;()texoir3todoaDr n il()seurim3ny4apeemfviat srrau ont1aex ii3iad mDulu p;t) etrir oo1lmt au o;t)truoxrpio4lm n ictl()a2taur ;u0tpeoifctydlmDemumo t4arxrmr3oytlmtrlivols0trumir3io1amtnlfcia()s2urxrpnt4optniieilt m em(mpn(0 rxoxo ty1omDeaneols0 rtrxr3iy1lp   fvi t srum(moot1aexo f3ildfa emn p;u)trermrcia1op   u i;t0tetmiopno1apen fvtl()s2tau  ;t1tptn oeiysls ea(vo (0artnio3ia1oatrauvs;(0t2tmio3iudlpen fes t sDua(r no1alxniieiytlmDran p (4texrmf3to1oateaivs;(0t2xm(opou1am  lietatf rur(roou4texnmf3iadlmDua(vs;u0aeerxr tydla  aneo s srurxm iy1lltnmfvt t arraum ;u1olxn feild a rau pnt0artrxo tydfa rln s ( t2urim nu1lpte nvt t) ruau pou0tpxomi3iasfs el(vpn(4 lxrir oy1fpteli s;t)truoio iu4ole lncsls arraurpot4aetnmi3tytfsDrlnvsnt4trxrxf3to1oa r ivsls)srxmimpnu1al eliei ( a2taxrp;o1oltn ictadlm2ua(ms (0 lxniocoo1faDr n i t  2xoxrpnu1ll elivilt s2tmuronu4alxn fetld aDua(vp;() lxnio oydomD  i i (0 rum(r oo1lp nmivils aDumx  nu0altnifetytfmDea(vp;()teerxo3todlp  ln o;t0 rtm(opiodol emnesls)aruax ono1tlx  f3tysfsDumu onu4 rtnmf oadlm eaivi;s0trumio oo4llt mncsa(farrru  nu4tpt iiciyd m rl(ms (4tlxrmf oo1opDrluvsls trum(o3iydapt  ict t sDumx  ;o1aexnmi3tys a2ua( o;(4trtrxr3iytop rluvi;t0 rtmir3iydoltemivs tfsrrrxrp;u4tpx  i3iaslm umu s (0aetrmf iytfmt ai s ()t2uoxm oy1al  mfcs s) rtau o;o0apenmfeiadfm2em( o;u0 rtoxf todfaDe ueilt0trxrxopio1apee fctasf rumx  ;o1apeniiciadla eauvs u) eerxf oo1fpteaieo s seuoxo3ny1ol   ncsa() rtaurp;o4tlxoiocils aDeauvs;(0aeeoifciatomtrluvi t0texrxo ou4omen ict s  rtrx ooo0olto fetydla ean p;() exniocto1lpDe uvil(  etm(r io4ap emneils)a2uaxrp;u1oexomictldfm rmu pnt0areoif3tadom   iesls srxoir3iu4ome  nvsls) Dtau pnt4teeomociat m2rlnmpnt0tlxnmf3oa1oatr ies t0trtoio3nodlptelnvs (f 2taur oo4teeoii3tltls2uau p;u0 eerxr3oadfa elivols) eumir3io1optemnetl( aDtru  ;u0apeoiictysfm2el(ms t4aetrxrcoy1lpD auvo t srumim3nu1am n fetlt)a2rm(  ou4tpxoifetyt s ea(vpn(4aexoxo3tydfpDrlu o (0texr(m3oo1amt  icslsfarrmxm ;t4optnii3tadlmDrau o ()trxomr3totoa   nvo;s)trxmim io4oltn nciat a2taxmpnu0optn oetadfa2eauvo u0aetnir ia1fpt lueo t)t2to(r iy1aptelfci ()s2trump;t4aexnii3ilsla uln o (0 exoxocio1lmD aiei s truoir io1lptnmnetasfaDur(mp;o1tet mf3tlsls2el(vo;(4aeeomo iatfpt anes;(0sruriopoudlmtelivta(fartr(rpot4olto ieiyslmDuaumo (0treoir3todopD lu s;s0 exoimpoo1ol elivtas)arumxmont1texn ietyslmDrmu o u)aeerxr oydoaDe nvo ( trxmxrpiydomenmnetls)arrr(rpnu4oet iieildlm ulnmsnu0 exrxfcia1fa e ies (  2uoim3ny4ll   fctas) Drr(ront1tetoioetys s2ua( s;t) lxnmo3ootoa  li il() eurirpoo1omeelfcil(f 2ur( o;u4olxoio3iadfa2rlumo (4tlenmo3iytlateaivs (0 rtmimpno4llt mfvsa(fs2trxr nu1apeoioctltfa2rau p u) lermoctadfptrli o;( trtm(mpiudlm   feta( arua( pot0alto ictyd mDul(mont4 exnxoctytfpD  ivs (0s2tm(mpnodal elnctatf ruaxm ;o0apxnif3iltfs2uau p u0tlxoxr3todlpt  ues;(0t2toxm3nudlpt  nct s)s2ta(mont1alxo icild sDua( pnt0aeeoir3oo1la rlu s s0 rto(mpoo1op nlfvsat)a2um( ooo1oeeo i3iadfm2uaumont0altrmo tadoa eln il()srxrxm nu1op e iei ()aDta(mpno1tpeo iciyslsDean p;t) eenmr3tatfaDelieo (0trxmimpnu1lpen ncsat  2tmurpnu4oex mi3tadlm elumo (0texnio iodfm rlivs s)tetm(m oodole  iet s srrr(ro;t1apxnmo3iydlmDemumsnu)arxnmr3to1fpD  i ilt  exmxmpiudap   ivsl( sDrmxm ot4teenii3tadlsDra(mo t)aetoio iatlp rlnvi ( t2xmir3no1apt  ict s  rrru oot4olxn ociydfmDel( o;t0 lxnmo3iotoa eaues;t0 etoio oodlp emfesas) 2tau o;t4oet mf3iltlm2umnmp;t0tltoif tydlp e n s s tetrimpiy1amtn nesasf 2raum ;u0opx  i3tydfm2emu p u0 rxniocoy1lptr nvs;t tetoxmpio1ll emivs () rta(mo;o0oleoiieilsfaDeanmo;u0altomf3tydfpD aivo;s0sexo(o3io4lleelfeiat) 2taumoot1alxniieilsls elnvo t0texoifciytlptrau olt)t2to(rpny4ome  netlt sDrau p;u0texomoctytlmDrlnms;t4tlenmo tatlpD  uvilt) etmiopoy4lmee ivslsfa2ua(  nt0ape mi3iad s uau pn(4tetoircto1lat anvsls0 ruo(opoudlp   nes sfs2umx  ot0apxnmo3iltfm2umuvs (4teerxf3oy1fpDeanvi s)trtoxo3no1op e fct s  rurumono0altnioctadfsDuaums (0 lerxo3oytfa   uvi;(0s2umio3nudlpte fvs ()aDur( p;u1apeoio3iysls umumo u0teenmrctytlaD ln i ()s2xr(m3io1am nlnes (fsDtmxmpoo1aexomo3iadfmDra( p u4 lenif3oatlaDeai ils0srxoxm3iydopt lnvi t)aDrr(r ;u4tlx  i3iltls um(vpnt)trxrio3ty1la raies;t) exoir3oudalen fcsa(f rtm(roou0tltnmieiasfa2umu on(4 lermr ty1fateai s;s0trxoxo iu4lmee icsls) 2um(r ot1tpe mo3tat sDrm(monu4tlenif ty1lmD auvils0srxrxm3nudll  liesas) ruaurpnu1tltoiictytla rlu snu0aleomrctodfpDelnvs;( seurxm3no1apt lnei tfartr(r ;u4aexnmfeiytls2ulumo t4 rerxr3ty1omDelnvilt0setmio3no4lpeemfes t) Durump;t1oet  ieilsfm2ra( o;(4 eerxr3oodfpt aues s0 exmxopiudlmtn ieslt s2rrumo;o1olxo i3iyt s2ea(vo (0tetomr iatlaDeluvo;t) eur(r oy4omtnlicsltfarua(mpnu4aee  o3iytfa2ulu onu4 ltnxr3ty1omDrlnei;s trxoxo3iydam elnvtls  rtmu pnu0opeo f3iadfs elu s;u)aetomo oodfpD ln o;s0srtoxm3io1ol  mncsatfs2ur(mono1oet mfetltla2emnvpnu) etnir oatfptrlnes;s teuriopnu4aptemict t aDtm( oou0oexnmi3ilsla2rl(mp;(0areomr3tydla   i o;t0teumimpoo4opee fvi sfsDuax  no0olx  o3ilsla ea(msnt4 etoxr tytoaDe ivo;(0t2umir3nydlmee neiat) rua(rono0tee ifcilsls2rauvs;t4 reoxf totomDr n o;s) rumxm ou4olenmfei t)srrm(mono0opxn ociyd a2um(vo;t)aexomfcootfmDeauvs;t0s2xmir ou4ll n ieias  Dta( o;u0tptoioctadla rlnvs;u4 lxrmociodlpDran s (  rxoxm ny4amtnlnct s)s2rru ooo0oeen oeilsfmDelump;t0 reoif3tydomDe n o s0srtrxo ny4aptnmfvsat)aruax pot1tpt  o3iyd s2rlnmpnt4tlenifciy1fat ai s;(0s2um(o3iy4lpe mneia() 2rmxro;o1oetnioetysfsDumumpn() leriocootopt  n o s  2trir3nudamt  nvtatfsDrmxm ou0tex  ociysfa rlu p;()tlxnif iytoate ies s trurxm3nydap n ivtas a2tax  nu0tptn i3tadla2ran ont) eerio oodlpte u o;t) rxrim3oodamtn fvtl() 2ra(mpnt1aleoiictldlm rmn s () rtnio3tadlaDran i t)srumxm3oy1amenmicias) Dtaurpno0tltnmicilt m rmump;t4 etomo3iatlmD lues (0 rxrimpiy4alt mies s a2trx pou4aptnmiciydfm ulnvs;t0tlermr oydfp rliei ()tetr(opoodole mnesa()sDua(r ot4oetoioeiysfs2rluvsnt0tlenif oy1opD lnvi;t) etoxo nu1op emieta( s2ua(mpnt4alen oeiadls2uaumpnu)aetoxf3totop e n olt seurxr iu1alt livslt a2rrum ;o0aeen o3ilt mDua( on()aleomfcia1opt aueilt0 rum(r oy4lpeelfctas aDur( oou4aptn oetat aDemnvp;t)trtrio3to1fp eli o (0 2ur(r3oodamtn fetasfsDuaxm ;t4tleo o3iatfa2ua( s;t4alxrio3iodfpDr ies;t)tetm(m3oo1ll e fviat) 2uax pot0tpe mi3tyslm2uauvs;u) rtnmocto1laDelivi s0texr(m3oo4opeeliesl(fa2urx  ;t1tptnmieias mDua( s u) lxnxf ia1fpD  uei t0 rxoimpoy1oleeliet t sDumumpoo4oleomi3iatfm rluvo () eeniociadlpD an o;t  eur(m3nu4op n iet ()aDrrxmp;u4tlxnif3tlsfs emumon(0altrmf oytom  ln ols0 rtmxo nydape  fvsat a2ururonu1alxomietydlm emumo u)tlxoirciadfm  ln il()trumxmpoy4lmee fvs (faDtr(rooo4aeenioetlslm2rl(vs;(0 rtrif3iodlmteai i;(0 rumir3nu4lpt mfet s  rrmxmpnu0tlx ioeiadfa rmu o u0aeenmfcty1oat luei;s) rxr(r3oy4lmtelnet s  Drm(mpnt1aptnmi3ildfa2emnmo u4alxomo tydfpte uvol(0srtmir oy1optelnvils  2rru pot0tlt if3ild mDeaumpnu)aeeomocoytoptraneolt)s2urxmpou4lltelics ()arrmxm nu4tetoiictls aDranmo;u0tlenxrctotlpDrlnvo ( srumim3oy1apt mietl(faDuaxmont0alt  f3ias m rm(monu4alerxfctodomtrli ils tetoxo io1ol   neiatf rtru pno1oet ifeias mDua( s;u) eeoxf to1lateanvs;s0texoxo nodope liet t  Drm( pno1tlt mo3tad m2rm(mp;u4aexoif3iadoa rlnvsl(  2xm(m iy1op n nei s)a2tmxmont1apxomoeiasfa2ulu p;t0aetrmocoatomDelneol()seuoirpou1ape  nvil()s2ta(m ;u4apen o3ias m2rm( s u0aexrmo3oo1oaDr i s;()s2triopnu1apeelfesl()s2tmurpno4alx  feiysls2uaumpn(0 ltrmo3tatlmtrlnesl()trur(rpou4lmenmnci t sDuax oot1tpenmf3iltfm uln p;t0 eeomr iadlmDeauvilt  exoxm ny1omeelneil() rua(  ;u0oexo oeiyd a ea(mo;u)artrmf3iodoat an o s)texmio ou4aptemfvtas srtaxr nu1aeeoifciltfmDrmumpn(4texnircoatfp elues;()texrxo oo1amt  ivs (fartru  ;o4ale ioetltfmDeaump;u0tlxomf totfpDraieols) rurim3no4olenmncsl()sDumu ooo4olenmfeiasfm2ul(vsnu4 exomoctytlpt aies t t2xo(o3nudomt mnvsat sDrrumpoo0oeeoifciaslm2eln o t)aeeoxo io1fm r u slt) rxoxr ou4lm nlncsltf 2umxm oo4alen fciyt sDulnvpn(4areoir3ootoateauvols0srtoirpny1oleemivi (f Dtrxronu4opxnii3tltls2emu pnt)tlxomocootlpDe ivolt)s2xo(r ny4apt mneslt)aDtmumono1oltnmieiydfa ul(vo t4 lxomo oytfaDe ueilt0sexrxrpiy1lpte nctls  rtmxr oo4aptnmieiys m rmu snu4trtnmf iytfate iei ( trtr(o3iydomtn ietlt)a2uauroot0oex mfeiytfa el(mpnu) eeoif3to1lp rli s;s) eurirpiydoptn ics t a2taur oo0oltnmiciys m2umn s;u0tltoircootfp  lieo;t) exoxmpoo4llt  fvsa() Draumont4texo o3ias a emnvs;u)trenxo ty1lm  auvsls) rto(o oy4lmtnlnvi s arrm(  nt1tpxniictytfm uaumont) leomo to1op e ueslt)srxrxr iu1amtelfesls)s2umx o;t4optoiicilsfs2ua(mo;t4aleomr3to1lmte uei;(0 2urxm nydlltelnvi tf 2rau pou1olxoifcildla2uaums;(0altrif3ta1omt  u ol(0teur(o oodomee icias)s2rr(r ;t1tlx mietldlaDeauvp t0alermfctadfpDe n olt)s2urio nu4alt mnct (  2raumo;t1aeeomictaslm2eau s;u)tltoir tatlpD ai ils)trum(mpoo4om eliet () 2umxr no0alxo ocils a2eluvsnt4trtoxocoydlat an o s0 2xmimpiu4ol n ncs sfsrrm(ront0oleoii3ildla2elnvs t4 leoxf3tytoptraieslt0teto(opoy1lpenlnctlt)aDrax onu1aeenif3tat a2uauvp;t0artoif todfpD  ivs;s texoxmpou1om nmnvs t) rrrx o;u0opx ii3ild m ranmont0trxnxr todlptr neslt0t2uo(r iu4lmtnlneil(  2ua( oot0apeniieiyd a emn pnu) exoio3totlat  n olt)sexm(r3no4op n ncslt)sDrrur ou1tpen iciatla2ra(ms;()tlenmfciy1oaDelueo;(0t2ur(r3no1llt  ncil(fa2umurpou4tlxnmfctyt sDua( s;u)trtomrciy1oaDr i ilt s2tm(o no4ol  mivs t)arrm(mp;o0oleomfciys sDul(ms (0aeeoif3tatfm elnvo () rtoimpny4apeemfvt t) rtr(roou4ope  oeiltls ranmo t4aeerifciytlmDeanvs s s2trxrpnydolt mnet t)s2trx  ;t0tleoif3ilslsDem(ms (4 eeoxrcootfaDe uvil(0 2uo(o iy1llenmieiatf rtauront1apxomietadls eanmont)texomo3ta1lat au o;(0trtoxm3nudlm  lfetltfaDurxmo;u0tlxomi3ilt a elnvon()altoifcoatlaDeliesl(0trxoxm nydaltelnvt ()a2ua(mpot0olx ioeiysfm uan pnu4trxrir iadoaDeln ilt0 ruoim oy1amt mivs t srrr(root0ole  i3tys a2um(mp u)aleoifciadoat aueol( t2umxopou4ap n fctas  rtr(  no1apxomi3iysfsDrmuvp t0 eeomr3iy1fpDeauvo (0teuoxo oo4lp emicia(fsrtmxront0ole mf3iysla2rmuvp;u0tlxoxf tytom  lueo;( tetoxrpio1ap n fvsls)aDtaxm oo4oleoiiciydlsDea(mont0texomf ta1late nei t0 eumirpno1lptnlfvs (fs2raxmont0texomoeiydfmDua( sn()arxnxociadfmtelivs t0 2ur(o oy1llt licias)a2rmxmo;u0tlto ietydlm ua(monu4alxrmocio1fp rau slt) eur(m oy1lltnmnes sfs2ra(r nu4teenmoetyd m2ul( pnt0teenirciydom r i i;t0trtmio iydolenmnvtlt  rrr(rpot0oltoifciytla2rlumo;t0 rtoio ia1fm elnesl(0 2tr(o3oodlm n fci s)s2urumpnu1tpxnio3iytlm2ean pnt0aeerxf iadop ean s s) 2xr(r3iydlmee ncsas)sDua(  no0tlxomoeias mDranvpnu4teeoif oa1late i ol()trumir3iudlm n ivsa( a2uaur ;o0aeto feiadfmDuanvo;t4aeenxo3oo1fp  lnvo t0srxrirpoy1lp e icsl()aruax  ;u1ape  o3tldlmDrmums u0tltnxf3iatlp   n sls  rto(opnu1alee feiltfsrtru  no4oltoiietls aDeanmo (0tleomr iy1fat aies ( s2tmxopoo1al nmfesl()arrr( ont4tlenmo3tltla2rmu o;(0 leoxrcoytlmD lneo;(  2umxo iu1optnlfeias)srtrurono0oee  fciadls rlnms;t)arxrio3tytop e nei;(0t2toxmpoy1openmnci s)aDtrum ;o1teen ieiad mDea(vpn()aetoir3tatoaDranesl()s2tmxopiu4lpte iei t)sDtaumoot0tpe ioctydlm ran snt)arerxo oadlatraivil()s2uo(rpiydlp n ivi t)arumx  ot1tltoioeiyt m2ranvp;u)altrmo todoaDelnvo t0srumim3oo1ll nmieia()a2raump;t1olto ocils a raumo u)aetomo3totlptelu s;() 2tmxmpio1optemncs tf Dtaur ;u1oexomoeilt s uanvp;t4artomr ootlpDeaieil(0srtmio3oy4om e nctl(  2rmu onu1olt  fctltfmDrmump t4 eermf3oytop  lu ol(  2xrirpio1lpt lfvias  rrru  oo0alt io3iys a2ua(vs;()treoxf3tadfp e u s;t)trto(m oo1alt lnci sf rrm( pnt0apeo fciatfa2uanmpnt0aetnif3iotom ean olt t2uoxr3oodaptelictl(fsDurum no4optn ieiytfs2emnvp;t4arxnxociydfp  luvol(  2urxm3oydolee fesasfa2ua( pnt4aee  o3iyd a2el(mo t4tetrxocio1fpDe nes;t  2triopio4lpe mnci s) rra(  ;o4ole mietadfa2umuvp u4trermo ia1lpte ueols s2um(r oy1olt mnet tfa2rruro;u4aex ifeiasfmDemn snt0tleoio iatopD lu i;(  ruo(o3iu4alen ncias arrrxronu0tex  oeiydfm2ean p ()altoxo3ootlm eaueols0 rxmxm3ny1amt  iesl(f Drrxmoou0alxo oetasls eaumpn(4 reoifctotop   neo;s)s2uoim ny1lmtnmicias) rrm(mpoo1teeomieiltlaDulnmo;u) rtrxfciodfmDe u i (  etrim3iudope  fetls  rtax  ou4tptoii3tlt sDul(vs t4trxoxoctadfa elueols0s2toir3ou1olenlnciltf 2tax pou1apx io3tadfm rl(ms t0tlxrio3iatopD luei (0trtoxm no4ome lnvi ( aDururo;t1aetomocild m2rauvs u4arxnxf3iotlat ai il(0 2trxmpio1amt  ivsat)s2umx  ;o4alxoiicildfs ulums;u4trtoioctodfa e uvo;t0srur(opoy4lp   nvi t  Dur(rpot1tptnmicilslmDem(ms;t0arxoir iatfatelu i;t0 rurio oodlmt lnvsltf Drmx p;o1tpt  oetlt sDuau snt0 etrircio1faD lueol(  etrxr3iydlp   neias sDtrxr nu0oexn ocias s el( o ()trenxr tydomDean ols trxmxo oo1optn nvta() 2ta(m ;u4oltomieilslm rl(mp;(4trtrio oytfatrluvols0 exoim3nudameelict s  Dta(rpnu1tpx  ocilslm ua(vsnu4alxrmf3todfptr uei;(0t2tr(m3iy1omt mivsat)aDrm(  ;t4olt moeiatfa rmn ont0arxrxf3oatlat  n ilt0s2uoxrpoy1amtnmfeia()artm(ro;o1olen o3iytla2eaump t4arxnirctadfmD lu s s t2xmio nodam nmnvt ()srta(  oo0olxnif3iytlm raumo u0areoio totom ranei s0 2xoio iodlmee nci t a2rr(ro;u1aexnmf3ilsfs rln s u4trtomo iadop  an o ()t2ur(rpoy4lmt  ncil(farrmx pno1tetniieilt a2em(vs;(4alxrmo tydom   u o;s)t2xoir oy1ame mncil(f 2tmxm nt0tpxnii3iltlm2em(vsn(0 exnmfctytfaDrauei t sexoxrpnudlpee ieta()srraxroou0oet  fctls aDemuvo t4artoxrcoy1oateli i;()trum(opno4ll n nvtasfsDta(r oo0alxn f3ildfm elu p ()tlerxf oytoptrlivsl(0teur(rpnu4llt mnctlt)arraxmooo0olxo feias m ulnvp;t4alxrirciadomteln i;t0t2xo(r3oydlm e nvi sf 2uaur nu4tpe iociytla rl( onu)tlxnio iytomDr nvi;t)sexm(m3nudalenlnvs t  Drax pot0opx iiciltfm2ean s;t)artoir tydlpt lnvs () 2to(m3nydlmtnmfcsat  rtmxm oo1oeenifciaslaDeau s t4 reomf3tydlatrluei;s)sexoxo3nydol   fei (farta( ont4aeen feiasfs ulnvo t)aetnxr3to1opt ln ol()trxrir iy1ol elictls sDtrxmooo4alx moctld s um(mpnu4alxrio3oydlm  aneil(  exmir3oy4opt licilsf rrr(m ;t0altomociasfa elumpn(0tetomo3iatlat  iesl() rtm(rpou4openlfei (  Dtrxm ou1tltniieildfm ua(mp t4altniocoodop   ivils) 2uoim nudlltnlfcs s)aDumx  ;o1aptnifcilslm2eaumont) exoxr totop  anes s0tetoim3ou4ll elfcslt a2rmxmp;u4olxoif3tad s2ua(mo;u0arxrmf3oadfm   i s s teuoxrpnu4oltemfes ()srta(rpno4alenifeiysfm eaump ()trtrxo ta1lmtrlneslt teurir nydap n ncilt aDra( pnt1olxoifeias m uan o () etrxf tatlpDe i i t0 2toxmpoodamt  fct () Drau p;t0oet  f3tltfs2rmuvp;t0 etoif oadoat livs s)trtrxm nu1opeemiet tf Drru  ;u4optoiocils a umumo;()alxnir ia1fp  lnei t) exmxr3oodal elict sfs2rrur ;o4oetniieiadfa uln s;u4tlxomf3oytoptrau i s) 2tmirpoo4lm nmnesat)s2um(m oo1alxn f3iadlm2rmnvo t4 rxnmr3oa1lmt auvo;(  exo(m3iodlle lnet (farurx  nt1tpt io3ias s2uauvpnt) ltnxrciadlpD ai i;()trtrir iu1apeelnesl(f 2um(  ;t0tltoiiciatfs ua(mp;t)tetoxo3oa1faDeaivs;s  rtrim3oydale lfcta() 2raxr no0teenmf3ilt s umnvo;(0altnifctatfpteln sl(0s2xrio iu1ap  lies ( a2rr(r ;o0oetn oeildfa rmn pnt4tleoxrcia1lpDrauvs;t)srxo(opou4al nlivia(fsruaum ;t1alxnmfciyslm rlnvpnu0aexnio tadlat ai i;(0trxoir nudom  lietltfarur( poo4aet  oetatls2ulnmpnu)alxomrctotlpD lnei s0t2xmxrpnu1olt lfvt s)srtau  ;t0optnmo3tadfaDea(mp;u)aetoxf3oy1omD luvs s0s2urir3iy4omtelfctas)aDua(root1tex mi3ilsfaDrlnvsn(0 rxrio3ia1lp ranvol() exr(m iy1lpe mfcsl()srtm(mpot4olt mieils m2ulnvsn(0tleoifcoytfate nes;s seum(o nydlm   ictlt)aDumxm no4oeeoiictyd s em(vs u0alxomr iytomtranvs t0trtmxr3nydop elnetlt) ruaurp;t1opxnmieiad s rlnmpn(0 rtoircoy1omt lnvi () rtrio3io1omte nci (fs2ta(r oo0tpe  fciydfs2eaums;t4 ltrmf3to1lp ean i;s  rtmir3iu4alte ivtas)aDtrur ;t0ope mocild m2ul(vsn(4aetnmoctytfa eauvs;t0 eumxm3oo4lme mfvs (  Dua(r nt4tlxnmo3ias m eauvp () lenmfciydfa e u sls)s2xr(m iu4ameemfct ()s2ta(mp;o4teeomoeilsla2rl(ms;(4arxnmociytlp eauvs;s0s2toirpno1lp e ivsl( a2ua(r ;u0opxoiociltfs rm( p t0 rxomf iydoat aivi (0trxo(o3iodol e ietl()a2ur(r ;u0tleoifeildlmDua(vo;(0 rxrmo3oa1oa  ai ols)srtoio3nydop   fvt tfarrr(m oo0tltnifctat s umnmo;(4arxnmf3ty1fat  nvols) 2xm(opio4aptemiciltfaDrmumoot1alx mi3ilsfm2emu o;u)tlenmr todomtraieil(0trtoir3nodlmtemfcsl() Dta( p;o0aet micildla ra(mpnu4aeenxr3ia1oaDe
\ No newline at end of file
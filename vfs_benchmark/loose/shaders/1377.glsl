@@ -0,0 +1 @@
+nvs;s  rxrim3ny4ole lieslsfsrta( pno1apeomoctltlm rl(ms t)trerif3oa1oaD luvol(0t2tmir ny1op nmncils srurxroou4olto f3ilsfs rmnvsnt)tlxnifciatoat  nvi;s)t2xo(r3nydol  mnes t sDtrurpnu1opxoifcilt a umn snu0tetrxocio1faD  uvo s) 2trxm3iu4optn fviat)a2tmxmpoo1tle  fetlslm2rlu ont)tlxnio totlat lnvi (  rtm(opiu1lp   fvs (f rtr(rp;u1tpeo iciltfsDeaumpnt4 rermocia1oa  auesl(0t2toxopny1omee icias a2taum ;u4tex  o3iadlaDem( pnu4tetoirctotoat  iei s0 2uoxo3iodlmt  nvtas)sDtaur ;u4tetomfeilt s rmnmpnu4altnxo3tatfm  ln ilt  rtr(o3io1alt lfetls  Dtmu  ou0texoiieiltfs2rmnvp t0trtnirctydoa rlivs s0trxrim iydoltnmieiasfarrrxm no4apxoioetyd mDrmumo u4 eerir oatomD lueilt0t2xrxr3ny1op emivil( a2tr(m ;u1oeenmoeiltfa2eln s u)tlerir3tatfm  lnvols texrim3oo4lptnlivil(farrrxr ot4tpxo octld aDranms t0artoirctadfpt au ols)t2urxr oydal e ncilsf 2trxr no0tle ifctadlm2emu p t0 lxrxf3oa1fmDe ueo;t0s2xoiopno4optelncilsfartm(ront0alx mo3iydfsDrmn s;t0altnmf ty1om e i i;s)srtrxm3oy1llteliet s s2taxm no4oexo i3iatfm rm( ont0teerxr to1oatrlnvo;(0 eumirpnydopt mivta() Dtrxmo;o4opx mictysls2eanvo t0altoir tadlate i o;s  eurio nudlmtelfet (fsDtm(  nu1ole  i3ild s umn s ()teeoxocia1fpte nei t texm(opno4amtnmict tf rururpno4ape if3iatls2ranvs;(4tlxoif oy1laDrli i t) 2xm(m no1op nlncsa(f Dtr(  nu4tlxoioctltls2elu s;(0aetrmrcoytlpt  nvs t)s2uo(r ou4lme  nvta(farrrx o;t4alen oetyt a2eluvs t)arxnir3to1fmtranesls0 euoirpnu1ope  netl(fartr(m nt0tpt iociyslaDran pn(4 ltrxr iotlaD  ivi;s) 2ur(rpiudaptnmivtlt aDum(r ;t0tlx ifetys a2eln s u) eenif iytoat aueo;s)srurxm nu4lp emfvsasfarta(ronu4alt  feiydfm emn p;t4tlxrmr oa1lp  ai i;(0 rumxm iy4ol  mfctltfsDta(m no4tpe mo3ildlmDua(mo;t0tetoifcta1laD livs t t2um(m no4lpt  fvilt) Drm(rpou4aee  fctlsfmDrlu p;t0tlxrirctytopDelnvo s  rurxrpoy4lpt  iet ( artaxrpoo0olt mieiat sDea(vpnu)texnmr3tadfatelies ()seuoir3no1lle mictl( a2ta(m ;o4apeo f3ias sDul(ms (4aexnmocootoaDraues (0srumim3nu4ope mneil(fsDraurpot4tpe  f3iydlm2um(vs;(0 rxoxr3tydfp r ueo s  2tmir ou4ap emivsa()s2urumo;o4aet iictlsfs2ranvsnt4 ltoir3ootfa elnei s t2um(opno4omt livtl() rumu p;t0tpxoiietadfaDelnvs u4arxomr3iatlatelieo (  2tmim oydomtelivilsf 2urumont4tpeo fciatla raump t4 renio3iadlmtelu s ()srurxr iydlmtelieslt a2taumont0olt mi3tasfa2ra(mon(0aetoifciy1omte nes (  eur(o oo1olt livs ()aDrm( pnu0tltoif3ildfa2emn p;t0aeeomo io1lp e neo ()t2to(r io4ol n ies t) Drmurpot1tpxo o3ilt m2uanmo;()tetoxrcoy1fpt  ies;s) 2xoxm3ou1lmenlfvsltfa2uauroot0oltniociyt m2ulnvs (0tltnxrcoydfmt livol(0 exoxmpnydolee nesa(fa2taur no0olenmfciltfm rmu pnu0aexrxr3iadlm  livs;t0 rxm(o iydam e icta( a2taxmpoo0teeo ietad aDrlumo;()tlxoxfcoadfa rlivils0t2tm(m3iu4am emncs t)s2raump;t0apxoiocildfa2uln p;() rtrxf oo1fa elu s;() 2toxm iy4al  lici ()a2raxro;u1teeo fetlsfm2umuvpn(0 reomf totlpteai ils)s2tm(opiu4al nmnci ()sDtau onu1alxnmf3tytfa2emuvpnt4 ltrmo3tatoaD aueslt) 2tm(mpoydlmenlivi sf rurxroot1teto o3tytlm2um( pnu0aeerxr3tatfmte nei;() 2tmxm3iy4apt mfvt tf 2rmx ooo4opt  fctatfaDua( s;(0teenir iatomDe i slt)teuo(m nu1al n nesl(faDuaxm ou4ole ii3ilsfs2eluvp;(4 rtrxfcoadfp rlivsls0 2tr(opoo1lptn iciat) 2urxrpnt4tptn ociydlm2ua(mo (0tltrxf3iadfpDeaivi s texr(mpoo4lm emncsat aDum(mo;o4teen o3iydfs el( p;t) eenmr3ta1fmDr nes t0s2xo(o3iy4opt lncs ()sDrr(r nt0oexnio3ildls ua( p;()trenio3ootlmDraivil() 2xmxm oy1lpeelfei s)sDur(mpoo0opt if3tlsfaDulnvs;u) lenir3tydlaDr n o;t0seto(mpio4ll n fcsasfsrrax pnt0optnmicildfs2ulnmp t4texnxo3oo1fate i ilt)t2tmxm iodllenlivt s sDur( ont0alxomfeiydfa2eanmpnu) rtnmr3oa1oaD  nei;()t2trxo3ny4apeemnvs s)sDurxmo;t1olen ociaslmDumu pnt0 rtrmo ia1oat aies;s)srxrirpno1ape mici s  Dtm(r nt0tltn fetyd a rl(vs;t4texoif3totlptrlues;s)tetmxo iydamtn netasf rraxm ;o0tet  i3ildfa ea(mp (4texnmo todfaDr ivslt0t2uoirpoy1al n ics ( arrmump;o4tpe mociat aDul(vp t)alxnmr3oodop eaneo;(0 rtrxm3oodaptn nvsat sDrmuroot0aee iociysfa emu pn(0trenxfctodfa  luvs s  eurio3nu4am nlneta(faDtrxmpoo4tpxnmociyt mDuau snu4 rxnmo totfmD anes;s)srxr(opoodllenliei t)a2trump;o4tlenioctld a rln s t0aetriocoatomD  nvsl(0srxm(o3oy4lle lfeil(f 2raxmpnu1aexo fetys mDrl(vp u0alxnir3oa1omDr ivi;t  2xmir3oydoptnlfcs tfartau pou1tee  i3iysfs eanvs;u)tetomf3iydlmDrln o;(0teuoim oy1ome lnci tfs2rru pou4opt mo3ilsfm eauvs () rtrmo3ty1oat lnesls seuoio3oo4lp  mfvs s  rurumonu0olxnmfciatlaDrm( pnu4 lxnxrctydoateaueols)s2toxm3no4am emnci s s2rm( oot1oet mfeilsls2um(ms;()tlxrxr ta1fm eaieo t t2uo(rpny1llt mivt s)aDrm(m ot4apxomfciltls ranvpnu0 rtniocta1opD  nvo t)srtm(m3ou4al emfvs sfaDuau  ;u0opt if3iatfs rau on() rtoif3oodopt aivsl()trurxr3ny4omee fcil()aDuau poo1alenmoctys mDem( s u)aeenxrcty1lmD  u o;t0seuoxr nu4lm emnes t) 2tau pnu4aeto o3ildfs2rlnvo () rerif3ootfpDrauvo;s)srxr(o3io1al  mnci t)s2rax o;u4aptn o3iys m2rmnms;t0altnmocoytfptelnvi;s)texrxmpoydlmtn nvtl()sDumxrp;o1oeen i3iatlaDeln o ()arermocto1omDr u ilt)srxr(m3nudaptn neia( s2rmu  no4optnioeiad sDrmuvp t)tltrif io1faDelneolt  rtmxm nodal nmfvtls arurxr oo0tpxnif3iltfa2uluvont0trxomr iatfate ues s0 rxrxr iu4om elfci () rrr(rpoo4tpen fetydfsDrmn p;u)tleomrcto1oat aivi;t)s2urxo nodlmen fcsl() 2rm(  nu4tlt mo3tatfs2rauvp t0trermf iotlpD aneo;s) 2uo(m3nu1ap emiei sf rta(moou4tpt mfctad s2em(vp;t0trxnxo totom r i s (0 rurxopny4lmen nvtasfartaxm nu1optnii3tyslaDrmu ont4tetnio tydlp rauvo t s2tmio3oo1ope  ncsa( aDtmurpno1open fciadfa rluvp;u4trxomr oytomteli o () ruoxm3oy1amt lnviltfsDumx o;u1apx  octaslmDel(vs;(0trxnmr iy1fmD  neilt  exm(opiydol  lfcilt sDum(mpno4opx iiciys aDua(ms;t)trermocoadlm  lueo;t)s2tmxm3no1ope mfesasfsDuaxrp;o1texomfeiyd a ul( o (4 reomf tadfm e iesl()trum(rpou4omtnlfvsa(faDtr(mpnt0alt ioeiadlm rmu o (4trtrmr oy1fateln ols  exrio nodll elfei tfsDtm(rooo1altomictldfmDemuvo;u)aeenmfciadomDr uvo;t0trxrxr3ny4lpee feta() 2ua(mp;o0tpe ifeiadfa umu p (4tleomr3ta1omteau i t  euo(m3nu1oltelncia(fsDrmump;o0tet moctld mDra(vont4tlxnircta1fa raivi;t srum(r no4lm  liesasfa2umxm ;t1tpxoii3iadfa eauvo;t4 etnmrcoydlate uei ()t2xmxr oydope  ncsl(fs2uru  nu0opt moeiyslmDrm( s;t)trtrir oadfaDe n ol()s2ur(rpoo1ol n nvta()aDtrxm ot0apt  oeiysfsDra( s u0altoif ta1faDe u s s  rtm(rpnu1opeemnvtasf 2rrx  ot1tptomfciyt a uaump t0 exoio3oydopteaivo (0srur(m ny4amee net tfsDrmurp;t4tetomf3tat mDelnmpnu0aexnir oatla eauvol() eum(mpiy4lm nmnesat) 2urur ;u4tex if3iatlmDra( pnt4alxomr3oodomtelu ilt s2xoxopiu4olte fviasf Dumumont0aptniieiatfa2eau p u) exoxf ia1lateaueils t2uo(r iudome mietl(f Drrx  ;t4alen iciad m umnms t4 lxnmo oytoptr nvo s)trxoim no4ole mfesa() 2rrumpou1oltomfeiytlaDua( pnt)trtoio3oa1omt  ivsls)srxrir3oo1ome mfciatf rtrumono0optnifeiytlm rmnmon(4tlxrmf totfm e ues t trurxr3oydop  mfvtl(  2trxmp;o0tptn oeildls2uauvsnt0 eenxo3oa1fp e i s s) rxrxr3iodal n ivtas)a2trx oot1tpxnii3tatls2el(vo;u) etrxo io1om rau o t trtm(opiydol emietl(fsDtaump;t1olt mietas a eaums;t0trxoxocia1lmDean ils0 eum(o3iodopt  fvsl( arur(mpnu0tptomo3iydlsDean s;()alxoifcoy1op  auvol()sexo(rpiu1alt  ictlt srurxm nt4apen octysfm2rm(vont0aleoir iodopDe uei;(0trtrim nodlle mnes s)a2tr(  ;u1tlxo ociatls rlnvs;t)artrxoctytlpDr ieils0trtrxo3nodolt liet sf Dtmxmpoo0oeenmfetydla rm( s;u0alxomo tydoa rai s;(0sruoio oy1lp elnct ()srtr(  ;u0olenmieiys a2rmuvp;t4arxnxo iatfate n s;( s2to(mpiu1lmtnlivta(  Dtru o;u1apx ioeiysfa2eanms t)aexomo oa1lpteaneil(0s2xmim iy4lm  mietls)sDtax  ou0apenmfciaslmDra( s u4artnmrcoydoa eau o;t teurxmpnudlpe mnes tfsrtmur ot0teenmoe
\ No newline at end of file
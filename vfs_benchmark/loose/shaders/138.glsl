@@ -0,0 +1 @@
+n s;( sexr(o3no4lptemfvil(f rraxr oo4tlt ii3iatfm rlu on() eenxr iydfmD lieo;t0trtoxo3iu4ll emneil( a2tmur no1tpe mf3tydlsDranvs;t0aeerxf3tydom  li o;t0 rur(r3no4ll  lieil()artr(r ot1olx mo3tadla2rmump;t0trerxf oadfmt lieo t0 2tr(mpiu1ap elfctl() rtax p;t0aeeo icilsfa2em(mo u0teenirctodlatr iei s s2to(r3oodaltnlfvsa(fa2rrx p;t1tpe  f3tytfs2uanmpnt0tlerircoadfp  ln o t  2trxo3ou4lpe licsas a2rmu o;u4oleniiciys sDrlu p u) reomr ta1omtr ueol(0texoim3iy1opt  ietl()aDur(rp;u0opxn f3ild m ea( snt4trermf3oo1opD liesl(0 rtr(m3nodlp elncsltfa2tmur ot1tltnmoetadfaDranvs u0 ltoir3ia1faDr ues (0trtmxr ou4lmenmfcta() rrmx  no0ope  iciytfaDrm(mpnu) lermfciatlpt lies t truoxm ou4apenlnctasf Drm( poo4oltnmo3ild sDum( snt0 eenxrcoydfaDe n ols  euo(rpnu4lm nliesatfsrra(root4tptnmieiys m eln on(0 etoxf todfpD aies s0truoimpny1apte nes ( aruauroou0olto oeils s2um(ms;()tetomo3ta1lmt  ueil(0trurir3iu4lpe lfct (faDur(mpou1ape  ietysla ra(von(0 ltnxf tadop raueo s0trumxr nodoltemivtas sruru p;u1tlxnifeiad m2ulu o t0 lxoirctodfpDelueils)t2xr(r iu1lmee neil()artru pnu1ape moeiydlm2elumo (4 lxrxo oydfmD ai s;t)srum(r3nodam n feias aDumxm ;t4tpxnmoeildlm2rmnvo (4altriocoy1lmt lieo;s0t2xoim no1omee icta( a2tr(ront0aetniociyd m rluvont0trtoio3ia1fmDraneslt truoxr3nu1olt livsat)artm(r ou1aetn f3tas m ea(mp;(0tetnxrcio1omDeli s;()srumxm3oo1ll emnes ( s2tmxm ou0oex moeiltlm2ea(vo;u4 reoxf3to1omDeaivs ( seumimpnu4lleemneilsf rrrxrp;o4tlx iietas m2emu snu4tlermf ty1lmt  n ol(  rxrxm oydap elivtat a2umur ;o0tpxo ociydfm rl( pnt0alermf3iy1lm eauei;t)texmim ny1ap  lictat a2rru o;o0olxn ietls m2eau o;u)alxnir iodfmDe i sl(0t2xmim iu1ome lfvsasfaDtm(r nu0apx mfeiatlm rmnmpn()artomr iydomD auvo ( setrxo3oudaltemfet t arumxmpot1olxniociydlm2ulumo;t0 exrxo oodfp rau ils0s2um(mpiu4ome lfeiasfa2tr(r oo1openmietydlm eau onu)trxrmrctodoat aneil(0 eum(m iudlpe  fvt tfs2tau  nu4tlxoio3tysfsDelnms;u4 eeoxf oydom rau s t trxrim iu4ol eliet t) 2raxr ;u0apxniictaslm ua(mpn() rxoxf totoa rlnvo;s0s2trim iy1omee ivi s)a2urxm ot0tetn fctadfm2uaums (4treoif3oy1fmt an ol() ruo(m3iydlpee ictat srumxm ;o4aex mo3tls m2um(mp u4aleoif oadopteanei;t  exoxo oudlm e ivs tfs2umxmo;t0oetn ieiys a rl(mpnt4tlxrxr todoat anes;s)s2xo(r3io1llenmfcilsfsrtm(  ;o1tlx mfeiytfaDran s;t4aeermo to1optrauvo s teum(opoy4alt  net t) rta( oou4tpto ictydfsDea(mpnu4alenxr3tadla eanvolt0setm(m iy4al nmfet s  Drruro;t0ape iictad aDrm( snt)aetoxo iydlptran s t texrir iodolen fvs t  2um(r ;t1apenmfctas s2rl( o;t4arxnmo3tytom raneo;(0s2uoxm3io4lle  ivta(fsDtaurpnt0tex  i3tas s2eaumpn()trxnmf3oadopD  i s;s  eur(opoo1lmeemneiltf Dtaur oo4texomf3iys a2uln snu0 exrxo iodfptr uvi;( t2uoir3nu1ome mfetl()s2trurp;u1tlt if3tadfm ea(mont0 rtoxf3tatfa   uvsls0sexmxm3iydoleemfvta(f rum(r nu4olen f3ilslmDran o;(4 etoxr3iytlmDeaneo t srxoiopiy4amee fvs s)arurxrooo4tpeomocilsfa eauvs;t0artoxf oytop raieols)s2xrim3iu1aptnlfctas) rrru  ;t4oleniieils s2ulu s (4aeermo3ty1faDran o (0t2trim3nodomtnmiciatfs2tmx poo1opx mo3tysfs um(vo;(0tlxomr totopteluvs s0 exoio no4op  livi t)arrr(mpno1ole ifciltfmDuluvp t4treomf oadfp r uei s srtoxmpiodolte ieslsf rtaxmpoo0opeomfciltla2um( snt)tlxomo ia1laDe iei t)srxr(m3ou4ape mfesltfsDurumpno4apxn f3tltfa2uauvonu)tlxoxociodop  au s;s0sexm(mpio1optn net tfs2umxm ot0tpxnmoctldfm umu o u)artnxrciytomtrau o;()trto(o3io1omtemfvi () Dtru  nt0olxomfeilslsDulu s (0 exrmocoa1lm elivs t)texo(o3oodopte ies ( a2um( pnt1teeo octatlsDeluvpnt0tlxrmfciodomt an s;s)t2xoxopoo4amtnlnciltfaDururp;u4oexoif3iatfaDuaump;u0 eenmf iydomDr ues;s0srur(opiydlptnlnetatfsDtmurpnt4alt  ietasfm2eanvsn()trenxoctadomtr ueils)trxoir ou1ome mfct ()a2rrxmpnu4optoii3iys mDrm(vsnu4 rtrxfciatlaD  ueslt0 exoxo no4lm emivt (fs2rmx oou4olxo fctld a rmuvon()aetoir ty1fptran sl( trtmxm io1olee netat  rurxrpno4opt  i3iydls eln p;t4teermo3to1lp eln o s) euo(r iudame miei (f rtmuront1teeo o3tad aDuanvont)alxoir3iy1omt  uvols  2uo(m3iu1apt mnctlt) 2uaur nt0tpxnmoetls a2el(ms t4 lermf oytopD  u i s)sexoirpoodlm emicia( s2rau p;o0oex mf3tys mDulums;t0 etnxo3iotfpDrlnvs t) rxmxo ou1opt licils) rumx  ;t0tpe mieiytla2uanvo;t)trxoxoctodfaDelueo;t0 2to(m3oodlm nliei s)aDtmxr ;o1texomi3tadlm umumont) ltrxf oydopDraues;s)s2xrxmpnu1ap  mictatfa2ua(rp;t0alxomfetytfm rm( s;u0alxrmf3oo1laDrlieo;(  rurxrpiudllt micta(  rra(rono1oetniiciad m2rauvp u) rtnxrciytlaD luei;s0 2xoxo oy4lmen fesls srumu oot1openmictldlaDem( p;(0 exnir iadlp r uei;s t2uoxm oudlme mfcta( s2tm(rpoo1tlenmieiydfs2ulnvo;u)artrmf oatlaD anvo ( texm(o io4apt  fvtatfa2uru  no0opx mf3iyd s umnms t4 reomocta1lm rln i;s texr(mpiu4opee fviltf rurxmp;o0tex iieildfs rm(vs (0teeomrcoydfmD lnei () ruoxm3oodamte nviat)sDtau pnt4olx ifeiytlaDuau on(0 rtnxfcoatlpDelu i t trxrio iu4altnlfcslt s2tr(r oo1tpx mfciad a2el(mont4 exnxr3iy1omtean o;( s2xoxo3iy4opeelnvsltfs2tax  ;o0aee  f3iatlaDelu p;u4 eenmrcoatfpDr iei (0 2xmir3io4alte ivtat)srum(rono0tltomi3iyd a rlnvp;(4tltoxrcta1la r n sls sruoir iy1llt mfcils) Dtrx  oo0alt  fetld s2rln o t4 lxoxf3oydfatr uvi;(  2xoxopoodamee fvs t) rtruroot4tleomieiys sDemumonu0artnxf ootlatrlues;()srto(r ou1oleeliesa(fsDtm(ront0alt  f3iasfa uan o t)aeenmr3ootlmt aivs;s0 exm(mpiudlptn nvias)a2tr(m ou1teto ociys aDel(mp ()trxrmocoydla   ueo t0setrir iy1lpte fesl()s2trumpoo4olxnii3ildla2raump;t4 ltoifcootfa ranesl(0seum(m3iy1al  lieiat) Dumurpou0texoiictasfaDeanvon(4alxoxfctytoate uvsl() rurir3iudomt  nvt t a2uaxm ;t1ape  fctat a2emnvsnu0 reriocoatlmt  uvo s)teumim ou1om n fct t  rtaur no1oleoiietatlm2umums u) etrmf3tytlpDe ueo t)teto(mpiu1apeelictl(  Dumxmono0tltoif3tysfsDranvsnt0 lxoio3tytop rlivols0texriopny1am   fetl()aDuaumono0apeoiietadla2ul( o;(4tlxrxo3tadom rauvsl( truo(r io4lltelicslsf 2tmumo;o1alxomociydls umu pn(0t
\ No newline at end of file
@@ -0,0 +1 @@
+n s;() rurxm io4llen fvsa()sDtmxrp;u0tlen i3tltfa2emums;t0 lxomf iodomt auvi s) rtoxrpiodape lnvsat srtrum ot0alt  i3iytfm ran on(4teeomocoadlaDeauei;s s2toirpoo4lm n ietl(fs2rr(m nu1oeeomo3iyd m2eau s u)treomr iytlat lnvolt teurxm nu4lmenmfvtat) Dur(mpou4tlxn fciadla2emu s () rxoiocio1lptraueslt) 2triopno1ome lies sfa2rau o;t1oeto ictatfa rmumo t0aexrmo oodlp r ueo ( trxr(m oo1olen nvtlsfaDumu  ;u1alx mfeiatlm2ua(vsn(4altnmf3ootom  auvs () rum(r3oo4lm nlncslt  Dtaxrpot4optnii3tlsfm2eaums;u0 lerxo3oytomtraiei;s) etoxr3iudoltnlivil(  Dua(m ot4apxnmfctldfs2rau o;t4trtoir oydfatraieilt s2xoxrpny4ol n icsasf 2trur ot4apxnmi3tyt a em(ms u0 reoxr3oo1lmD lieo;s0 rxmxmpno4opeemics t) rrm(rp;u4ale io3iasfa2rmuvon(4 rxomo3tytlaDe ueo;t0setoxrpny4alt  fciatfa2raum ot1texomi3ild m ranmon(0trtnxr to1lmD lneo;(0sruoimpoy4op elnvtlsf 2rr(ro;u4oet iictltfa2umnvs;u)alxrmo3ootoat anei;t0setoxm oodlpee nvias  2ra(rono1alxo ieiyd mDrmu p ()altnircio1fateaivo;()srto(opou4lpenmivtlt sDumu oot1alxo o3iytla uan o t) eenmo3iotom elnvil()sexm(r3ny4aleemivtlt) 2trxmono0olt mf3tldfa2ua( pnt4arenioctotlpDrlu o;() rur(r oodomeemfesl(fa2rmur ot4aptn iciadls rlu o;t0trxnxf oydlp  ln sls  rxrimpiydlle  nvtltfsDraxro;t0tetoif3ild aDran p;u)aetoir iotomD li ilt  etoxrpoo4lpeelfvi sfs2uaurooo0tetomicilsfs uaumpn(0 eenio oa1opDrluvsl() 2xrxr3iydlle mivt t) Dtau  nu4tpto octldfs2ul(mo;u4tlxnir3iodlm e u ols0 euoirpno1olt lfvs (  Dtm( pnu1tlt mfciltls eanvp (0alerir3ia1lp  livo (0seumxr3oodaptnmici (fsrra(m ot1tlt  fetasls ua(mp t4aexoiocoadlptelnvi;t  etoxr iudaptn iet tf 2tr(mo;u4opx ioeiasfs2ulu sn()teeoxr ia1op   ues s srxmim3iu4amt mfciat)sDrax pou0aee ioetadfsDranms u4trtnxr tadomt au o;t0 exmimpny4ol nlfvil(  2ua( pnu0oex ifetad a eauvs t)aetomocoatfaDe uvils t2ur(o oodlpen fvslt a2trxmpno4tlt mi3iltlm2em( p (4 rtnmf oa1optraiesls0t2xr(o nodale lfcils srrmurooo1aptn ietlt sDel(mpn()arxoiocta1fp r ivo (0 rum(m3oy4opte nvilt)srua( oot1opx mo3tytls2umu pn(0aetomr iydlpteli ol() 2tmxmpnydlmeemicia() rtmu oot4oexomictad aDelnvo t0 lxnio3oydfatraieo ( t2urxo oy4opt  fciasf rum(rpou4oexo f3iltfmDrl(mp t)tltrircoa1oat  ueo s0seur(r no4ole mfviat) ruaxmont1opxoiicilt aDrlu p;t)trtoxrcoodlp e uvo;(0s2toxmpiydaptelfciat s2tm(monu1tlxo fetaslm umuvp;t) etomocio1oaDelieslt0tetmirpiu1op n ivslsf 2tax poo1altnmiciat a2um( o;(0tetoxo3tydfmt  ueilt0 exr(mpiu1lmenmnctlt) Dra(mpoo0optnii3iatla2elumo t4texomo3todfat ai o;(0 exmxo3iy1olte ivtlt sDrm(m ;t0oexnioeiyd a2ulu pn() renifcio1lp   uvo;t s2ur(opoy4llenmfcsatf Dua(mono1apt ii3ild s2emumo (4 lxoiociadfmDe ies;()seurirpiu4aleelici tfs2ua(rono1aexn fciaslmDuluvp;u)tlermo iy1fmt lueol()trtrxmpiudll   neiltfsDua(mono0altniietad aDulu snu4tltoxoctydlmt  ueo;t) rurxo ou1ameelneslt aDuax  ;t1alxomi3iltfm ulumo t)artnmfciytlat anes;()setmir3ou4aptnlfeia(faDrmurp;u4apeoiociadlm uaumo;t)alenmocia1opDeluvsls t2xr(m3ny1ol  lnct (fs2raurp;t0opeoiociad a2umnvs;t4 eeoxocoadomteluvilt0tetr(rpiydoltemneiltfarraurp;o0tetoioeiasfm rlnvs;u4arerifciatlp raueo t trxmirpiodlm nlfvsl() rtr(monu1olto ociatfsDranms;t0texrmo3iadfmteaivs t) 2umio no4al n ici t)s2taurono4altomietldlm ul( p;()arxrxf3to1lpt aueslt) rumxopoodop elieil( arururo;t4texnmoeiltfa emnvo u) renioctatoa r n ilt0setoirpny4amt  ictas  2urxrp;t0alxomfciasfmDrauvpnt) renioctytopte nesls  eumxr nu1olte fct s s2tax pnu0oexnmf3iadls elnmo (4 reomfcoo1lat luvslt  2xoim no1lp emfciat) 2ua(ronu0tex if3iytfm2ulnvsn() rtnmf iadom rai s;t) eurim oodopt mfvta( arrr(r ot0aexnii3iydfs2rmumo;u4tltomf iytlaDr ivo s0srtrxr iudlmtn ncsa( srtmxm no4tlto icildfs2eau s u4trxnxf oo1omD aieo;t) 2xoim3oy4ame lfvsltf rraxrooo4oltn f3tasfa2rm(vo;u) eenmr iydfpt  nei;s0srurimpnudopt mivias)aruax onu0aexo o3tlsfaDrl(mp u0 rtnxf3oytlmtrlu o s0 eurxr nu1oltnlici t aDur(ro;o1texoiietytla2uln p u0 exnmo iotfpDraivi;t0srurir3ou4ap n nes (  ruaurpoo1apenmoeiydfmDrauvs u)trtrxf tatoatr i o (0t2umim3oydlm  mnvt s) Draur ;o4oetnio3tatlm2el(msn(4aexnxocio1la r n olt)srur(opou1oltemfvs ()sDrr(  no1olt ifctlsls rm(vs;t0tlxnif3ootfate i olt texm(o3nu1am e ietls)a2tm(mo;t0oee mi3iat sDrmnmo (0trtnmr oo1fm eaiei;t)seurxr3iu1om e ics () ruaur nu0aetomoctyd sDuau snu0aleoxfcia1lm   ueslt)texoim ny1lmte fcs t a2tru oou1oet ii3tyd m el( p;(4aexomfciatopDeaiei;()t2uo(m ou1lmt mietat srra(mont1tpxn feiysla2uan p;t) eeoir tydlaD  i sls s2tmxopoydom e feslt  Drrurpoo0oexomociatlsDeauvs t) lxrir oytomDelnvs ()t2xr(r nu4op n fviat)aDumu ono0apx ifetysfs eanmo;t0 leoxo3ta1lpteaneo;s0 exmxr oydame liviat)s2trumpnu1ale mfeiaslaDea(vs u)treomocto1fmt ln i;t)trtrio oudllt  ivt t  rtruroou0tpeo ietadlm2uau s (4tetrmrcoodfmt  n ol( sexmxo ou4ap emivtlt)aDtrur ;o4tltoifcild m ua( o;t)aleoxrcoytoaDeanesl( setoxr3nydape  neias)a2rru pnu4tpx ifetld m2rau ont)trtnmf3oytomD auvs t0t2uoirpny4ope  fcilt)aDrruronu4tetoioeildlm eanmp;t4 ltnxf oatlmD an i s0seuoiopnu1ame  nvs s  2tm( p;t1aleoifciytlm2emuvont0trxrmf ootlpteluvo;s)t2xo(opiydlp  mfetat)artrurooo0aexn i3tyslmDul(ms ()arxrmf3iodoa  an o t srto(m3iu4ome lfesas)sDraxrono4opxoiieiytfa rmnms;u) eerir3io1latrai o;t truoio3oo4ole mfctlt srrr(rpoo1tetnmi3iadlaDrl(vs;(4altnio ta1lpt lu slt0seuoimpiy4optnmnetlt srur( p;t1olxn oetld sDrmnvo t4altrmfciatlm r uei;t  rumxr3iy1lm emnvslt srurx oou1apxo ictatlmDulnvo;u) rxnio3iodfm eauvols)s2tr(opnodop  mnvsls) rrmxmo;o1tex  f3iyt m elnmsn()altomo3oatfp  liei;s)s2xm(rpoudaltn ics s arrauront1alxoiieiytfa rl( s (4teenmfctydfm   neslt sexoiopiu1ap n fcils aDta( poo4tee mi3ilt m2ea(vo (0trtrmo3oydlmtr nvo (0trxmirpoo4olt lncilsfs2rmu p;o0tlen oetasfa2emu p;t) exoifcoy1om eauvi;s0 eur(r3iy4lp  licslsfsrum( pot4tpxomo3iytls2rm(vonu)trxnmo3oadlpD lnvslt0srtoio3iy1optnmfci tf rtm( o;u1apeomiciasfsDea(mo (4 eeomrciatlpt aneols s2xrxm no1lltemncil( srta(  ot4oee io3iaslmDuln p;u0trenxr3oodfpD li s ()t2urxr3no1lp elfvi s s2ur(mont1alx ifciydfm ra(vonu0 rxomfcto1lpD anei t t2xoxrpiu1lme  fvslsfs2uru pnu1ope ifciyd s2ulnmonu0trxrio tydfpte i i s0trto(o nudap   fvtasf 2tr( poo1alxo octysfmDeauvs u4arxoir3oytfatr u i;t)s2tmir3iy4ll elietls)s2uax pno1apeoiociadfsDua( p t4teerxocty1lm r iei;s0 euoxrpiu1lpt  fcta()sDtr(mpnt4aptoifeiaslm2umuvsn(4trtnmociydfp rlnvo t) euo(m ny1apen ietls) 2trumooo0apenifctydfmDran p;u)aetoxf3io1oaDrluvo;t t2xo(m3iodlm  livs ()arururooo0ole  oeiatlsDumu s;(0artnxr tadoa rai ol(  rxoirpio1amt  nvtl( arrau oot1tlt  ictysfmDrl( p;u4 eeomrctodomDelnvi t)trxrim ny1ol  lnvs tfa2taxmoou4tetnifetasfs rln snu0arxoxfcty1fp rlivo;() eur(o3io1apeelfeil()srurum ;t0aet  oeilslm ea( s;(4tlerio tytfptrai o t) rtr(o oodape mict (f Durxrpot0tpe mf3iadls2emn s;()texrirctatlaD  ueolt)trxoirpio1ol   nvs s)a2um(r nu0tlt io3tldfs rluvp t4artnxo ia1op r nei;t) rtmiopny4am e iet sf 2ta(ro;o4aeenmociadfm2eau s;u) rtoif tadomtran i s0srumirpnu4om elfct t aDtmx oou0tlx if3tasls2eau p;u)teeomf oy1lpDelnvi t0setoxmpiodlpenmncilt) rraum nu0tltn fetydls2emnmp;(0aeenir3iydfat li o s srumio iu4am   ncta() Duaum ;u0tee iociadls2ul(ms;(0tlenio oy1fa r nvilt)t2ur(rpny4ome  fci (f Dur(mp;o0open iciat s umuvs;t)tltnxr3oydfm r uvo;t teurio no4omenmfei sf Durump;o1oee mi3iys sDrluvpnt4 lxoxo iodoa rauei;s)teuoxrpoo4ope lfctat aDuau pno4ale mictydla2ean s;t0aetoio oytlptelu s (  eurxrpny4op nmfetl( arurxrpno4tpt mfetydfa2ea(mo t)trenmoctadoate ueo;s  rurxopnu1oleelnct tf Drrx pnt0oleniicildla2rlu o ()areomf oodfmDe uvi;(0t2xoxopou4amen fvt t a2uau  ou4open oeias sDumnmont)arxomo oy1latrlnei t0truoio iy1lpeemivils) 2ur(mooo0aeenioctat aDem(mp;(4trermocoadomt au i;s0srxoxr ny4apeelncils sDtmx oou0ole  f3tlsfm2umuvon()trtrxf3totlptr n o;s srto(r3oydllt miei s) 2rmumpoo1tex mf3ilt s2ea(mo;u4 reoio3oadla e u o;s)srxo(m3iydll  lneia( sDua(r nt1ape  o3iytlm2el(vp u4aleoxr3tatfm raieol( sruo(o nu4opt lictat  2tau  nt1olto feilt m2rlnmsn(0altnxfcty1omD luvo;t srtr(r oy1ap nmnet () ruaurp;t1alt ioctltfs2rlu o u) renio iodoptr ueo s0s2uoxmpiu1lptn fctltf Draxm ;t4opxomf3taslm el( o u4tltoxf tydoptelnei;(0 2uo(r nudameelfvs (f rumur nt4tptn ieiys m raums t)aeenir3oadomt aivil(  eto(m oodlltemictltf 2uaum nt1apto fciysfs2eanvo t0aleoifcoy1fp elu s ()srumxr iydomt  fvslt)sDrax  nt1apt  fcilt mDemn o u0aeenxrciy1opD ai s ()texm(m nudalee fvs s sDuaxm ;t4alx  i3tatlm2ranvo u0 rtrmr ia1fpt anei;s0 etr(r nudame  ivi t)aDrruronu1ape  ietyslm2rmumo t) exrxfcoadomDelivs (0srurxm3ny4lpt lfet t  2trxmpoo0altnifetydfa2umnvonu0aetoifciadfmte nvo t0srxm(r iy1ome  ivsltf Dur( o;u4optniociydfs emuvpnt4artomocoa1lp eli o;t) 2trio iu1olee feiatfaDuaum oo1aetnmfciasfa ra(msn()artrif ta1opDelieilt srtoxo ou4lme lnci s  rumu  oo4alxoiiciatfm2ranmo;(0alxrmfcta1fateai s s0s2um(o ou1ope lfetls srrmumonu0opto ieiadfm2ua(vpn(0altoirciy1fate n o;t srxo(r3ou1opeemnvtlt arrmurpot4tptn oeilt a ulu o (0 etoxo3oadfaDrlnvs s0 2tmirpoy1apen ncilsfs2tm(rooo1apen oeild sDelnmont0 rxnif3ia1fp  aueo;t)srxmimpnu4ol e icia( srrr(r ou4tex moeils a2el(ms u4teerio3to1oatelnvols)srxmxm ny4olt  fcta() rtrum oo0opx moeildfsDranmo;u)texnmrcoadfmD lneo s0srxo(o3ny1am n icilt aDtm(rpnt4apenif3iltlm2rm(monu0artoir3to1oaD  uvils)s2toim io4alenlnvtas  2uax p;t1apt  f3iysls rmn o;(0 lxrmrcio1fp rlu s t)t2urxm ny4olt lnvils aDumxm no0aexo ietysfmDranms t0 etnxr3tatopt aivslt)s2xoxo io1amt mfvt (fsDumxrp;t4alx  fctadfm2elnmpnt4alenmo3ootla e u o;s texo(opoudom e ivsas)aruaxmoou0oee mi3iatla elumo;()tlxnxf tatoptranvs t0t2xr(mpiy4ame lfetlt s2ta( p;t1tltn feias a2ul(mo t0 rxnxr3oydlp eaivo s)t2toio3iy1ll nmfctas) rrru  nu4aetomietlsfs2eauvs (0altnir3to1fatrlies;(0texriopoo4opt lnvt t)arururpoo1tlxnmocild m2rlumo ()tltnif3iytlm r nes;t) rurxr no1ll  lnctas)arrax pou1opxomo3tydfaDumums ()aexrmr3ty1la eln o;s0 2tmio3oo4ole lfcs (fa2uaxrono1tex iocildfmDua( snu)alxoxfcoydla ranvi t0t2umim iy1optnmfeslt a2ur(mont1ale mi3tytlm ea(vp ()trxomf ia1omte uei ()trxoim3oo4open fciat  ruau pnu0tlx mi3ias m eau snt4trxnxr3oo1la   u o (  rxo(mpoo4ol emictlsfaDtmxm oo1tpxo f3tls m2um( on(0arxoif3tytop  li ol()t2tmio oudap nlnvias a2trumpnt0tpeo oetysfsDean o (4aexoxo iatoate u o s0seur(m iudll e nvsl(  Drrxmono4apxn f3iadla2eln s ()altoir3totfpD aueilt  exmio iy1lm  mnvia(fsrum(m ;u1oeto ietysfmDeluvp () rtrxo oa1om e u o;s trur(m ou1amee fcia( arrm(ro;u0tpxo ictasls rm(mont4 rtnmr3ta1faDe uvils sexrxo3iy4alte ivta() rrrx onu4aleomf3tls s emu s (4 rxnxf oatlmtrli o (0sruoiopiu4omtnmncsl(  2ua(  no4aexo f3ildls umnms t4treoifctytfate i s;t) 2toxr3iy4ll  mfetls s2ua( pnt4apxnif3tydla2rl(vsnt) rtrxf3ia1lmteln s;s0teur(o oydlle lnetl()srumxmont4tltomf3iyslm2ra(vo;()aetoiociotom rauei;()truoxr nu1lptn ict (farrax ooo0alx mi3tlsla rmnmsnu4arenxo3oydlmDe n i;s s2toxm nodopenlfvt tfarur(m no4oltniocildls ulnvp t4trtriocio1omDelieo;t  rtm(mpiy4lp e nvias  Drrxmpnt0apt if3iadlaDrmnms u4 rerifcoytfpDeliei;t0s2xm(o io1ll n ies s  Drrur ot0aeenifciydfs rmump;u4tleomo oydomt lieo s)t2toxm3iodamen iviat  2urx pou0tpxnmoetydfs rmu p t0trxnmrcoadfa e ues;t0 2xrxo3oodlpee fesl(f 2ta(mpno4tpxnii3iatlm2umu snt4trermr oadop e i il()trxm(mpnydlptnlfctltfsDtrx  no4ope  ictydlsDuluvs t0aeerxrctadfateaiei;s0t2toirpiy1apen ieils) Dra(mpnu1olx  feiytfs2uluvp u0 eerxr oadfp e uvi t srumio3nu4llee feilt)s2tax  ;t1tex mi3ildla2umnvs (0aexomf totoatranvol()texm(o ou4lm nlies sfa2rrur ;t0tptoif3ils aDrmn p;t4texnxr ta1fm e i o s trxmim3iu4alen ivil(f 2ur(  ;t4apxo f3iatfa raums;t) etoir3ty1laDe neil(0 rxrxm3no1aptnlfci s) Durx pnu0opeo feilsfm ra(mp u4alxnxo io1fp elu o;t)seurxr3iu1llt  ivil(fsDrrx oou4oleoio3ildfa ulnmsnt4aeeoif iadlaD ai o t0 exrio3iu4lpe mnetat) 2tr(  ou1apxomo3iaslsDul(msn(4aleoxf ia1oatr uvi () euoim ou4ll e feta(faDtaxmpou4optniiciaslmDuan sn(4aleomr3tatlptelu o t seuo(r3iudaltn nvsl( sDurum ;o1olt mictytfm uauvsnt)aleomrciodlmt luvsls trto(r3iudole mnvsasfaDrmxmo;u0aet  feildfs rlnmo;(4trtoxf iy1lmD  ieo t0 ruoirpoo1ll nmies sfa2ta(mpot4tptn fctyslm rlnvo (0aexomo3iadoatr i o;()sexo(opnydll eliet s) ruaumpot1oee  feiytlsDrmumo;t4aeeoxfcia1lm rliesls0s2urxm nu1amtnmfviatfa2rrum ;o1apxoifctydls2rl( o t0texrxr iotoa  ai s;s)srtoim3oy4lleelnetls  rrauro;o0ope  fctlsfs um(vs;(0artrir3oodfatr neol()t2xr(m oo1ale  ivsls s2rax p;t4tle ifetat m2uln p t0aetnxfctydfpt au s;s  etrxopoo1lpe  ncsatfs2taur nt0aexniiciadlsDul(vpnu4tlxnxr iadopte i s t)s2umio3iu1lmeemfvil( srrrx o;t1aexoiieiysfmDel(mp u)aetrir3iodom rai s s0 eto(opiodll nlnvil(  Dtr(mpot0tpeomo3iys aDemn s;()alenxf oydfaDelu s () eumim nu4alt lictasfsruax oou4alxoiiciytfa2ulu s u0 rxnio oatom e ueo s0s2um(r nodlpe  fvt (fa2rrxroou0aex  ocild m ra(vo u4 rxrir oatla r ueo s trtmxmpnudapen fcsa()srta(rp;o0opxn i3iyslaDrl(mp t4aetrmr3tadfa  aivs (0 rxoirpoudalen ivtat)aDta( pnu1aetnii3tad mDua(vp t0trenir3iydoa rau olt) 2tmir3nydaptelfcs t)artmxm nu1oexo ietatla elnmo;u4tetnmo oodlp rli ilt srtmxr3iydom nmncias srtax  ;u0oeeomieiaslm2ua( o u0 exrifcoo1opDeluvs () etmir oo1al elfvsa()s2rmx oot1alt  i3tasla umnmpnu4tlxnxo3oadoaDrau s;t)texrxrpiudap  mnvs tfarum(ro;u4oet mo3tysfm2rl(msnu4artrifciy1lp rln i t)t2xr(o nudomtnlnvtasfsrtrxr ot0tptnif3tlsla2ea( p (4tltnmr3iytfateanvo;t0 2tmim3nu1altnlncsat arrr(m no4tet ii3iytls ea(vs () rxnir ootopt au o;t0sexmimpio4aptelicsa()arrr( o;u0tee ifcilsls rluvp;()tetnmo totop  ai i s0s2tmxrpio1ap emncilt)arua(mo;t4optomo3tytfaDuau s t4tlerxo3iotop eaivi;(  2uoxm3iydam  micilt a2umur ;t4opx moctydls2ranvs;() renioctotfpDeln slt0t2xr(m nu4ol  mfctltf rum(rpnu0opt moeiatfmDuau s t) rxnxo oatoa ran i t0teum(m oo4ole lnvi ()s2raurpnu1opt mfetasfs uanvsn()trxrxo oytoatraues;t)trxmirpnu1lmt miciat  rur(moou0ale  fetydlaDean p;u)aexnxocoo1lmtrli i t0 rum(o3oydam nlnci sfsDtm(m nu0texn i3iytla2rln o;u4tlenxfctytfpDr u o s0 rtrxm iydll e iet ( srumum ou0aptoiictadlm2uanmont4 rxoio3tydoaDr uvi s t2umxm ny4opte nvsls  Duax onu4oeen feiat a2ranvpn(0 rxrio totomDraivo s t2xoxr nodam nmnciatfsDrru ont4tex mieiyd a umn pn(4aeenmo3iy1fmDe neolt0trtoxo3nu4ale mfetlsf rtmxmont0apxomo3iasla emn o t) etomf3oatop rai slt teuoio oy1altnmfeiat)srua( pou1tee mieiaslaDelu pnt0 ltnioctydomDrlieo;(0texrirpoudap elfcs (f Dtrur ;u1oexoiociys mDeaumpnu4treoir3oydoatr u ol()srurxrpnu4al e ivi tfsDuru p;t0olt mfciyd a2emnms;(0 leomr3iy1om   ueil(  2uoir3nu4openlncslt) Dtr(ronu0ape ifciasfmDel(vpnu)alerir3ia1opDelivslt0trtoxmpny1op nmictl(farraxrpot4tpxo f3tatlmDrmn o (4 rermrcoydlaD ln slt)t2toxr3ou4oltelfci (fa2trxmpno1texomfctat mDea( p;u4aleoifcoatomtelivi s0 2xr(o ny1apenlfct t) 2rr(r ;u4tlx ifeiydlmDea(vp;t0trtrxr3oa1lmDeau i ( s2xr(rpnodop n fetasfa2ta(  nu4oex  ieilsfmDelnvo t4tetomocty1oaDe uei (  rxo(rpio4ap nlictls)aDrauront0teeoiocias m ul(vpn(4tltoir3iytoatr ieols  rxr(o iodlpe lictls srtrxroou1tpeoiociadlaDraump t4 renmr3oatfatran i;s)t2uoxr3io1olte fes ()aDtrum ot0tpe ioeiltfmDemumon(0texnxociotop r ivs s)s2um(m3iu4opeelfcs s)arumu ono1aetoiiciat s2em(ms;(0 rtrmfciotlpDeli ils0 2xr(r3iydlp  lnct tfa2um(ro;o4tpxomfctls s uanmon(4arxrxo3tytlmDrauvi t)t2tr(o iu4lmtnlfcs ( aDrm( p;o4ape moeiydla2ulnmp u0 eenmf oodlmteli ils0s2urio ny4omeemfct (faDumum ot1oeeo i3tatfa2rm(vo t) ltnmf oadlmt  i o (0 eto(r3nodlmen nesa( sDrm(roou0oexo fetytfa2rl( p;t) rtrmr ootfmDelu olt) eto(r ny4oltelfcsl() 2urxmo;o4apeomf3iadfs uaump t4arxnmo3oodoptean s;s  eto(rpny4op   fvi ( arra(mo;t4tlto fciltfm ul(ms;(0aexrir3oo1fa ran sls  eurxo3iudlmt micsa() rum(root1aeeomfciatls2ua( o ()areoxfctatopDeai o;t)s2trio io4olen fvt s)s2umumont4alt mi3tys m2el(vont4trxnirciytlmDrlneo t)trxmim3oy1ll  lfvs (fa2um(mooo4alt  f3iyt s umu pnt)trtrmf3oy1lm raivsl(0 2uoxo iudom nlivslt) ruax  nu1opt miciat m rmums;(4tltrircootfp raiesls  ruoiopiu4lmeemfvia( a2rrx  nt4oeenmiciasla um(vs t0tlxnmo3ootfatrli i (0t2xoxm no1om e ivta(  2tau o;o4oet ii3iaslaDra( s;t0 rxrmfcoatfmtrlieilt texoxopoodapt lfesl() Drrxmoot0apto octadla2eaumpn(4tlenirctotlm r uei s trurir iy4lp e fciatfsrtmx poo1oee iocias m ul(ms t)tltnxf ootlp   iei (0 rto(m3iy4open netl(faDrmxmp;u1tetnmoetysls rl(vp;t0 ltrxr3ootfp eanei (0sexrim iydlp  lneiat)s2rm(rp;t4tee ifcilt s2um(mo;t4 lerio3ootfpDe ivs (0 2xr(m iu1llte ict (f 2umur ;u4aex if3tltfmDrmnvs t)aeeoio oadoptrli s;s  exo(opnu4omt  fvsls) Duaur nu4teen fciyd s2rmnmp (0 reoxoctydlaDe ieo;s0 rtoxo3nydopt  ncils srrr(rono1teeomoetasfa ra( o ()trtriociytfmDranvsls trxo(mpiudape mies sf 2tau onu1opt mfciasla2umu sn() etriociodfat li o s0srtrxm ny1lme liesl()arurur ou1opeo o3ilt m2elu o u) lxoxr iodfa  anvi;(0 rtm(m3iudapt  nctltfs2trxr no4tex mi3iltfaDulu s (0altnxf3iydopteauesl(0sexrxrpnu4ll nliciasf ruaurooo4aex  f3taslm2eau ont4artomr3oytlp   u i s)s2xrim3iodlmtn ici ()a2ua(  nu4oetoiictld aDulu snt)tltoio ty1latr ieslt0 rxr(r3oudal e nvsltfaDurx o;t0oet  i3tatls2uln p t)aexnif tadoatraivols0srtriopiu4op elnes tfs2rr( onu0tleoiictls m2rm(ms;u0tltoxf ty1om rlneilt)tetm(o ou4lmt liesls) Duaxmo;o1tlt  octld s2ulnmsnt)trxoxr3iodfaD lnesl()t2urxmpoydlmee fes ()arrmu  ;t0oltnii3ildlsDulu o;t4texrmrcoa1om  aneo t t2toiopoodom   nvs tfartrx onu0alt  feiytfs ra(vo t)texrif oo1la ranvs;t) etmxr3iu4om  miviat)a2ta(roou1tpe if3ildla2rl(mp;t4 etrmf oadlptran slt)tetrirpoo4ol elfci t)sDrr( o;o0alt io3tls aDrl(vs;u4arxrmf iadlmtrlnvsl(  rtrio3ou1opeelfctlsf rtm(m ;o4olxnifciyd m ranvo;u0 ltoif totlp e nvil() 2urxr iodlleelfes tfs2umum ;o1aet  feildfa rm(vonu) lxnio tatlmtr n sls0s2xmxmpny1ll n fvta(  2urx  nt4opxoiiciasfmDum(vp;u0areoxr3oadfaDe neilt0t2xrxopiu4optnmiviatf rumur ou4alxnioetyd sDrmuvont4aexnmr tadfmt ln o;s srxmirpiydlp elnvtl(fa2uru poo0tlx  ociydfaDelu p t4treomr3ta1fmtrai s t teumxo3iu4al n icil( sDumur no4altoifciadfm ul(mpnt0aetnxf iodlp  lneo t  etrxmpoo4opt mncilt a2rr(mo;u0aex mieiys sDrmuvo t4altrmo3oa1lpDeln ol(0s2to(r3oo1lme  fviat  rrm(mpot1aetoifciytfa2eanvon(4teeoxocto1lmDrlneo;t tetr(rpio1ll e fvsas) 2urx  nu1opt iieiatls rl(vp;t4 lxoxo oy1laD lnvi;t  rtr(mpio1amee ncsas) ruaumpou4altnmf3iatfaDeluvpnu0aexoxf iydfaDraivi t0 2urxo iydlpenmivsat)s2rax pnu4apxnmo3iydfm rl( pnt) exrxf iy1fpDe u o s sruoxo3nu4al  mnvtlt a2rmxmp;t0oltn iciltfs2eanvs;t)texnxr iydfatr ivi;s0s2xo(r3oy1lmeemietlt  Duauronu1tpx  fetls sDumnmo;(0texnxociodoa rli o;( t2tm(o3nodol  mietasfsDtr( ooo1aetoiiciydla el(vp;u) rxoxocoodlp  lnes t)trxrxm nu4lm  miesls)aDum( pnt0aptoioctyslmDelu snt)trtriociy1faD lu o t0 etoir nodom nmfes sfsrum( ooo1tpxnifeiytfa rln p;u0trtnmfcootomtranvolt) ruoxm3nodll elncs () 2ta(r oo0oeenifctltfs2uanmpnu0aetoxr3iy1fmtraieilt  2xoxm3ou4oltemnciat aDua(mpnt4tlt ioctldlm2rmumo;(4teeoxrciatlmD  ieo (0t2xmxmpny4ope lfcia(fsrraxr ;t0alxn iciad sDelump;u)alermrcoatlpD  nes;t  eum(r3nudolte ivt sfsrtaxrono1ale iiciytfm um( s t)teermo3iodfptrlieolt srtmxm nodom nmfcsasfa2rax p;o0ope  ocilt m rlnmon(0altnircoadfmD aneils0s2umxr oo4op nmicsas) rtaur ;t0tetomociadfa2ulnmp;(4 rermr3iotfp   nvi t) 2xmxr3oy1lpenlncsa()s2tax ont4alxn fetlt mDul(vonu4 rtrxf3oytoaDeliei t  rur(o3iudol e ics sfarrmum ;u1opxoif3iyt m ranvon() leoxr3oatlp elu sl(0sexrim3iy4lmeelncil( arraurooo4tpxn fetadfaDrl(mp;u0 eenxocoydoateanvil(0 eto(o3oodol e fctlt srum( pnt4aexn o3tlsls2rm( o;()artnifciadomDe n ols sexr(o iudop  livi ( sDtr(mpnt4tpe  oeiyd a rluvont0areoifciadlmte nvols)texrirpoy1om  livtls aDur(ro;t1oltn iciasfm2uanmo u0aetoxr3ta1omDrln s;() etrirpny1am emfvtlt) 2uau p;o0oltn feiyd m2ul(mp;(0arxomfctatoateaueol() rxoxo3iu1open icsl(fa2uru  ;u0apeo f3iltfm2umumon(4areomfciatoptr ivi;()trxr(opoydaltnmivt tfaDum(  oo4tptnioctat a emumsnu0artrxrcoytoaDeaivols) etoim3oo1lptnlnctas) 2umxrooo4openiictyd sDua(vs u0altnio3iytlpDelueol()srtmxm3iudol  lnvi s) 2tm(mpoo1tle mociydla2ulumo;t0 eenmo3iadoa r uvilt)seurim3iudll n neilt  rtmx pou0aeto oeiad a uanvo t4 eenirciy1fmtelues;()setoxopoo1llee fcias)artr(rp;u1oee  fcildlaDulnvsnt4tlerxf3ty1fp  luvs;t  rumim3iodlpee fci tfa2rax pot4teto f3ildlmDrmu o t0 etomo3ia1fpDr uvs;t tetrio3oudal nmnvsas) rumx  oo4altomociyslm2rmu o;u0altoircoy1om  ln slt)trxo(opoudalte fvsa() 2rr(r nt1oet ii3iyd s2rln s;(0treoir iodla eaneolt)sexrirpiudalte fvi tfsDrmum ot1oeenmfeiltls2ul(vo (4 reomfcia1faD lues ( trto(mpnodalt livsa( srum(  nu0aeenmicildfsDuau pnu)texnmo totoa r ueslt)setrxm3io1al e nvilsfaDtru pnt0oee iietas s2ean o;t4 rerio3todfaDraieo s0texoxo iodolte ncslsfa2umurpot1apto i3iaslm ua(vp;(0 exomf ty1fptelues t) exrxo3io4omt  nvsl(fs2raxr ;t4tle ii3iyd aDrl(vont0areoxo oodfatrlnvil(0 rtmxr3nu4optn iei s) Drrumpno1teto o3tlsla2rm(mon(0 exnxfcio1fmt auvs;t0t2xm(rpnudllen ivsasfaDtmxroot0aeeo ociad m2rau pnu4arermo3todfpDranvslt0texmiopio4omtn ieils) 2tm(ro;o0aptn i3ilsfs elump;t0teerxfciodla   ues t  exmio oy4ol emiei s) Dtrxm ;o0oexnmfeiat mDrm(vs;()tlxrmf iodfaDr ivo t0srumxo io1lmtemfctas aDrrur ou0apt  oetys s2el( o;u0 etoirctatfm ranvi;(0 2xrxmpno1am elfct sfaDuaum oo0tet ii3ild s umn s u)arxrxocoa1lmteluvi (0s2tmxo3iu1ope lfvias a2um(moou1olxn feild sDrm( pnt0aexrio3tadlat lu s t  2xo(o iudal nmfvtl(  2raump;u1tpxnioeild mDran o;t0aetomo3ootfmtr uvs s0 2um(r3ou4op n fcsl(faDta( o;o4oetnif3tysls2rm(vs ()altnxrctodop eaieo;s) 2uo(mpnudopen nes tf Dtmxronu1tle  f3iadfmDeanvs;u)alxoif3oatlaDeaiei s0srtrxr3oydom nmncslt  2umx pot0altn ictadfs2uauvo;t)aexnxf3ta1lp rlu slt0s2tmim ny1al nlietat)srtr(m nu1tpeniociytls rmuvo (0aeenmr3io1oaDr ieo;() 2xrimpny4ape  ici t a2ur(  ;u4teenmiciytfa ua(vp;t)texrxo oadfm eaies t0trumir nudlp   fvslt)sDur(  ot1oeen ociytlmDumnms t4arxniociy1lp e nei;s0trum(opiu1llenmfeils srum(  nu0tptoifciadlmDrmuvp u0 reomf to1fp eaneil(0t2toio oo4lpenmicta( sDuaump;u1altoioetlsla uan onu)tetnmrcoodfa  li o;(  rxmxm iy4opt mics s  Dra(r no4tltomoetlsfaDemu snt4 exrmo iadopDeluvs (  2uoimpio4am nlncsltfaDrrx pou4olxniociat aDel(msn()trtrxo3iadlpt anvs s)setm(m iy1omee fvsat artm(moou4optn feiltfsDranvpnt)tetoir3todoa rau ol( s2uoxopiudlptemfcsas srur(rooo1opeoioeiyt a2rau s (4 lxrifcoa1lpte ivs t seumxr3iydllee nviat) rtaxr ;t0tptnioeiaslm rmuvsnt0trenirciydlmDran i;s t2uriopoo4ll n nct t)aDtruro;t0tet io3iatfsDranvont4 rtrxr3tytfa eauvi t0 etmxopoudap e nviatf Dra( o;u4alx ioeilsfs2rlnvo ()treoif3tadlpDe ivol()srto(r oo1opeelneslt arumx o;u0tpxnii3iys a ua(vp t4 etnxf3tytom rlnvs s t2uoxopiy4lm  mfvi s)srurxronu1apeoifeiyd aDrau s;u4artomfciotla eli i s0 2tmiopoodom n nvsls)sDururpoo1oexo feiytlm eln sn()teerxf oadlmD aneo;t  rxmim3iu1alenmnet s)aDumur oo4oeeomf3ilslmDem( p u0trxoio3oadlat  neo;t0 euoxopnudapt liviasf rumxm ;o1tpxoio3tltla umnms u4aleoxo tadla ranvi (0 exrxm3ny4lp emfcsl()aDururpou1teeo ociad m rauvpnt4altrifciatla  an ols  etrxo3io4lpe mnvtlt) rrmx ono0oleniiciyd m2uluvs;t0 rerxo3ty1fp elivo;()srxrimpiodam   ivs tf rumx ont1oet  ieils sDrl(ms;u) rxnmfciatomD liei (0trtrxm oy4lpen iei (fsDtrxr no1opt mietytls2uln s t)areoxr iatlaDr nesls)srtrxm nu4olt  ivt t) 2tax pnt4alxnmfctlsfa eln p t0tltnmocoydomDeau ilt)sexmir no1opt mnei t) 2uax p;u1aexnioeils m elnvo t)teerxrctatoa r uvslt0t2tmir no1ale mictatfarrru p;u4aleomo3tys a2rlums;t4 leoio oy1fp  ln slt0sexoxopio1amenmiviat arumu pno1tlxnmfetadla elnmp t0altomr3ootlmt  u i;s)s2xr(opoudllt  ici ()sDtaumo;t0aeen f3iad aDuan p ()arerifctatop r u ols)seumir3ou4lpt mfvsasf 2tax poo4oex ii3iatfaDuanmon()texriociadoa rlnei;t tetoxmpoydlm nmivt ( aruaxrp;t4tpxn oeiaslsDemuvs;t4 rermf3ta1oatrai sl( trtrxopiy4omtelnctls) Dtrur oo0tpxn fctlslsDuln s;t0tetnmo3to1lptelnvslt  exmxm3oodop emnvt sfaDtr(monu1teeomi3iadfa rmu o u0 exnio3oytopD lu s s)trxr(m3oo4lpenlfeiltf 2umu  ou4aeeo i3ild m2em( p u) etrxr oy1fpD ln o ()teumxo oodlm  mfetas)a2taxrp;u1tex  fciadls ulnmo u4tetnxo3totlp   nei;s)trtmxopnudlmt lietat)srtaxmono4apeomfcils a2rl( p;u0artrxr3totlmt luesls)s2xmxo oydamee iet s  rrrum ;t1openifciatlaDea( s u0arenxocoadoat  ivo;( t2xo(o3iu1lm n nvs sf 2rmxrpno1oexo i3tlt mDumnmpnu)aeerif oadlp  livs;() euoim nu4am e ncsl()srtaurp;o4tex iietldfs rmumsnt4 ltnxr3oodlmD aieo s0 2xoir3io4amt  fcsat sDra(mpnt4alen fetyd m rmn o ()aexomrcio1lpt  ivols)truo(m ou1llenmfetl()aDrax p;u4apeo oeilsfaDrmuvpnu0tleoxo tadfp   i i;t0 rumio io1lpt  iet t)sDra(rp;t4aetoiociltfs ranvpnt0texnxr ty1fm  an o;s)s2xr(opoo1lleelivtasfa2tau poo1oleo ietld mDuauvs;u4 ltoif tytlpD  n s;(0trxr(o3oudap   nvsls)srrr(root1olxo oetyt aDumnmp t) rxomfcoa1fmDrlieols0srxm(rpoo4lptnmics t)aDum(  oo1alenioctltfm2rln o;(4aetnmocty1laDr neo s)s2to(mpoo1lp nlnci t)aDtaxrpno4teto ietat sDra(mpn(0 rxnmo oatlmt ln i (0srtrim iydap nmfcta(f ruauro;t0oeto i3iysfaDel(mo;(4 etoxrcoadfptr i ols0 rxm(mpoy1alte fes s)aDum(rp;t4alxnifeilsls ua(ms;u0texrmfciodlpDr uei s s2umxr nudopee iciasfsDrmxm ot0tlen f3iydlm2umn o u4 ltnxo3oy1om  lnvslt0teuoxo3iy1op nlnctl()aDur(  ;u1olt iictld a rauvs u4 etoxr3oo1lp   i o;s0texm(opiodolenmiesltfa2umurp;u1aeenio3tadls uanms t0aetnifcto1laDrauei t)trumio3iy1ape  nvil()sDtmxr ot0ape mociytls emu s t) rtnmr3oo1opt aues;(  rxrxr no4ale  neia()sDrr(r ou1texomo3tls s2rln o;t4alxoxr3iadoaDe ivs (0seuoxmpio4ap  licsl(fsrurum ot1oexnmo3iat aDel( o;u)teerxrcoatomDr ueil() 2xmxrpiy1ale mnciat sDrrurono0tex iicilt s umn p;(4 renmr iodoa rai i t0seuoxo3nydamtnmfeia(  rtr(mooo0opto ociat aDran onu0tltoxf oatop   ues t0trxo(r3io1am nmnctltf 2rmum oo0oetnifeiyslm ranvo u4aexnxrciydfaD  ueo (0 rxm(m3iudapen neta()sDuau  ot1oex if3ilslaDumumo;(0arenmrcoy1fmtr i i;(0 euoxrpiy4apenlnvt t s2rru poo0alxnmf3tatls2el(mp;u0aexoifcoy1fmtraneils) rxmxr ou4lpenmneia() rrmur ou1altoiieiytfaDeaums t4trenir3iy1optrlies;s0s2urxr iudap elfvt sf Dta(moou4olen feiat m rau ont4tltrxf3oydfpD au ilt)t2toim iu4amtnlfvtltf rtmumo;u0tle  fciltls emuvsnu0areoxf3oytlmDranesls seto(opny4altnlfcta(faDumxroou0tpto i3iatfmDelu o t4 lxoifctatlm e u i;s seurxo3iu4lp nmncils  rrru oou0alen iciaslmDumnvs t4trtoxr3oydomDeau o;(0seuriopio1lltnmnesa( artmxr ot1apen icilsla2em(mo u)trenxfcoydopD anei t)s2uoxm iy1lpt  ivils a2rax  oo4apxnmoctld sDea(mon(4 reomfcoatop  aneo s0 2tm(opnu4ameelicsa() rrmuroot1olxnmictltlm rm(vo ()tetrxo3oa1lmtelnei () 2xr(m3nydopenmnei ()s2umx  no1tlto i3tad sDel(ms u0treomf3oytfmDr n o;s0trxm(m oo1ol  liesat)srtrx p;t1tlt mfciadla2eluvo u) exrmr3ta1fatrlu il( teto(rpio1lpe lieias arrm( pou4opxnif3iltfs2em(vo (4tltnio tatfmtelues t0srtr(r no1openmict tfaDrm(r ;u0tlto fcildfm emnvsnt0aeeoif3oytlaDr uvil(0 2uoir oo4alenmieslt)sDua( o;t4texo oeiyd m2emuvpn(4tleoio3totfpDr uvo t0 eurxo oudomt  ietasfarur(mpou0tee mictaslsDrln s u0 rermf3todlptr n s s)trxr(opou1llt mnetltfa2rrum ;u0opxnmfctlsfmDumumpnt)alxrmo3io1fmDeanvi;t0t2tmxr no4omeelneiatfa2urx  ;u4tee mf3iat m ulu onu) reomo3oo1la e ieo t trtm(r iu1apeelicsls) Dtru  ;o1oexo oeiadfs emnms u4 rxomr oytomt lnvi;()srtrim3nodlmtn ieiltf 2rr(rono0opto fcild sDra(monu4 exrxo3iodlatelieil() 2urxopoy4lp  micil(fsDtax poo0oee  i3iasla ranmp (0trxnmrciadlate n s;t sruoim ou1alen fvtlsfarumxm no0texo fetad m2rmu o t)aexrxrciadlm  aies () rurimpno4op nlnci tfa2trxm ou0opxomf3tadlaDul(mo u4treoiociytom e u ils t2um(o ny1oltnlnei ( srraxmont4tpt if3iadfs2ea( s;t4teeoxfciodlpDeai s;t seuoxrpno1amenlivs sfsrtrurp;o0tetoio3iatfm2rmu o u4 leomf3oo1fmtr n sl(0 2um(r oudopenlfctls  2rrum oo0tptn fciatla2elu s u)trenmfcootlmD ai slt)t2xmir3nudam nmfcslt sDrm(rpnu4opxoiociasfm rlnvp (4artoifctatlp  liesls0srtmiopno4olte fei tfa2tmx ono1aptomi3iasls2rl(vp u)arerio oydom rlivolt0 rumim nu4lpeelfvs s sDtr(r nt0tleomf3ildls2ranms;(0alxnmr3to1fa  aivo;(0t2xrir ny1lmtnlnetl()a2rr(  nt0tpx if3tatlsDuanmpnt)tltoxr3tytlaDelivs (0trum(m no4aleelnci ()s2umuro;u4tleoiieiatla2rlump t4 rxrifcio1lpteaueolt teumio3iydapt lncsasfsrta(r ;o1oltn f3ilsfmDuanvo () exrmf3todopDrlu o () rtm(mpoudap e ivtlt  rur(rpnt0tpenmoctatlsDrm(vont)texrmfcoo1latrlu s ()srtm(mpnu1lleelnct t)aruaxmpot1opxomo3iydfa uaumo t0trxoxr oy1lmt  nvils)s2umxm3iy1ape  ivsasf rrmxroot1alt ifctlsfa2ranvon(0tleoirctatomDr nvil( s2uo(o oy4optemici s)a2uau oou0oleniiciasla ranvo t4alerif3iy1lpteau i ( srxmxo ou1oltn netl( s2rmx  ;t1tlxoioctytfsDelumonu4teenmociatoa rluvo s0tetr(mpiodope  ncils sDta(m oo4olx  oeildfaDea( pn(0texrxf3iotomte i i;t trxrxm3ou4ol e netls srtmxmpou4opxo fciys sDrmn snu0 etoxrcoytlp elieol()t2ur(mpiudope lfvslsfa2ur(mpot1optoioctatlm2uau onu0aeenmociydfateaivs t trxrxm3ou1op e feiltfsDuru pnt1opeomietadfa rmnmo t0tlenmf3oatoat  ies s  rxoir3iy1lle mnvtasfaDtaurp;u4tlt  fctatfa2uan p ()tleomr3todlpt lu i;t0truoxr3iy4ap nmiciatf rtrx pou1tet mf3tytfm2ea( sn(4alxrmo3iotfmt livo (  exmio ou4ameemictat)arumu poo0teenifetlt m ra(vp t0 ltrxf3oy1lmDrlues;()trtm(opou4lpe lfcsa()s2taum no4oltnmiciasfm2rm(vsn(0 rtoxrcoydlat aivsls s2triopiy4lpe  neil()aDur(  ;u0optn oeiadfm umumsnt4tetoxo iotfptraiei;()truoim io1olt miviltfs2raur ;t4aptoiociltls2ranmo u)tltoif3iydlate u ils) rtrxm iydlpenmnvsat  rrrx ono1tpen f3ild a2ua(vs;(4tlerxocty1fmDe neo t texm(m3ny4amenlicsl( sDtaxrpou0opxo o3iat sDra( snt4altrir iatfpD ai i t0trxm(o oodap  micsltf 2uau o;u0tltnmfeilsfm ra(mp;(4 lxoirctytom   n sl( teurio3iudlltn fvt t) rum( ono0apeomoeiatfm2emumo u0trerxf3todoate i il(0t2umxo oo4lptemictatf 2truro;o1alto ociyt s2rmump;()tlxnxf3oa1omD livo t srxrxo ou1apeemiesltf 2tr( onu0tlto o3ilt mDemnvon(4tltoio oa1lm r nvo t0 exm(rpoy1lmeelici (  2um(r ou1alto o3iadfa ra(ms;() eeomfcoadopteauvsl(0srxo(r nydopenmnvsat)arur(r oo4aptnioeildfm umn o;t) rxrio3iytlat  nvi t  rum(o3nudoptemfvsltf rra( p;u4oetomiciytfmDeauvs u4arermr tydfpDrlivs;s)s2uoim3iy1apt  ncs t srumu  nt0tltoio3ilslsDra( sn()aexomr oa1fp  auei s0tetrirpiy1optemnei ( a2taxmo;o0oet  f3tas mDumn s;()aexoif tatlaDe uvilt0setoxrpiy1lpt  iet s)arrrx o;u1tltnmfeiysfs ra( p;t4tlxrmrciytlat  uvs;()s2toimpny4lpee ivslt)srraur ;o0oleoiieiadfs2rln p (0tlenxr3oy1fp ranei s0srtr(r io4op emnvta() rtmu  ;o1aleo icilslm2elumsn(0tlxnxocoatlpteauvi;(0s2tr(m3no1amtn icil(f Drru  nt4oee mfciasfa2ulums (0aleomrctotoaDr nvi s)s2xoxo3oodop   feslsfsrua(rpnt1aleoioeiytlmDem(mpnt4 ltomr oo1laDeau s t0s2umio iu4lmtn nesls) Drax oou4aeenifctad m rm(mpnt0trtoio3tatoatrli s;s) etoiopoodol elfei s)s2rr(moot4oeen ieiat m ul( snt4trtrif oydlm   uvsl()t2trxm iudllenlici ( srumxmo;u0tpe  fciydfaDumumo;u0artrioctydfp raies t)teuo(rpnydopenlicsatf Dumumoou4oetniictadlsDuanvpnu4 ltoxr iydopt anvslt)t2trxo3iydomtelfciasfaDumx o;u0tlxoiietysfa2uluvp;()alerif3ta1op   uvo;s truoxo iodom nlfetl( s2rrurpou4tlxomo3iatlaDua(mon(0artnxo iotopD ln sl() rxoiopoodlltnmnvtlsfa2taumo;t0texo ietad m emuvp u)alxrmrcto1lmDeauei (0trxoxrpoodol nlfctat a2tmumo;u0oee  fetytfa2el(mo u4 exoxf ty1fa eai s;t)t2tr(opiudolte fcsl() rua(rp;u0tlenmiciad a2ulu ont0tlenirciatlpDelueols srxr(opiu1am n fvi (fsDtm( oot0tle ifeiydfs2ra( pnu0alxnxrcoodoa e n ils0trto(m3oo4lm elnet tf 2ta(r ;o4apt mo3iyt m2uanvp t0texnmfcoydfa e n s;(  etoiopiodlpee ivsl(fartr(rp;t1aptn oetld a2rmuvp;t4alermo totop  livi s)t2ur(r3oudap e nvilt)s2tmx  no0texoioctadfa2uauvs;u)tleoif3io1fpD  iesls)seur(o ny1om n feia( s2rmxr oo1texnmfeiad a2emnmon(4aexnmfciotlm raiei;s0trtmxopoy1ol e nvsatfa2rmumo;t0tle miciytfm em( sn()aetrif3tydlm rai o;()srumxo3iy4op elics (fa2rrx onu1ole ioctysls el(vp;u)aleoircoy1lmtr uvs;s) 2toxmpio4lme mieil(f 2rrxroot0apen ieiadls2rm( s;(4 lenmr3iodfa  au i;( s2umxopoudomt  fvta(fs2tmuront4tltoio3iadlaDel(ms;u)aexomr tatfaDr iesls0 2tmxr3nudom emnet t srrm(mo;o0aeeomi3tld s rmuvp;u0trtrmr oa1lpt lieo;(  2tmxr nydlm emfvs s)aDua(  nt1olen oeiyslaDumnvo u0 etnxoctodfptrauvi s0sexmim nu4oleemicils arum( p;u4aleniociasfs ran on(0 renmrciotlpD aneilt0texm(mpoodom emict ()a2tm(moou4olxo i3taslm2umuvp;(0aetrxr tatfaDr u i t)trtmir iy4lm   ici (fa2raxr ;o4teen i3tat a2rlu s t)tltrxf iy1fmt  n o ( srxoim3iy1optemnciatfartm( oou4texo o3iasfmDrmnms t0 exoxo ta1lp  li s ()s2xr(rpny4lp  lfvs tf 2urumoot1olx mi3iat m2em(mp (0trxnxf3tadlm r neol()s2ur(opny4alt mfes t s2taumonu4oex iietasls2ulnvpnt4 exnir iodfp  auvo;()srtmim no4op  liei (fs2ta(mp;t4opxoif3ildls2rmn p u4 exnmr3totopD li s ( seurxrpiydol nlivtlt sDrrumpou1tltnifcils sDea(mp;t4trenmr3tytlptr iei;s)teurim3iudlp   fvta() rrrxmp;t0tptnifcildls rl(vp u4tltrio3ty1lpteanvs;t s2xmxr io1lmtnmfeiat) Drm(rp;u4tle io3iadfs2em(vsnu4texrifciydfmte ivsl(  etmxm iy1op e ictas arurur no4optomo3taslm2umums;u0 rtoio iadfp e u i;(0 eum(mpny1lpenlfvsa(fsrumxm nu0tlxnmf3iytlaDel(vp u)aexoiocia1lmtr i s;s  euoxr3nydaptnmfvs tfsDtm(rpnt4tptniictldlsDuauvpnt4tltrmf iotom  luvs;s) rxmxrpio1ale mietasfsDrr(rpoo1opxnmfeiysla2umu s (0arenmf oy1lmDrlu o;t) rtr(o3iu4lmtnmfvtltfa2rauroou4apxn oeiltfm2umnmo u0trxoxr3iatomteluvi (  eumim3nydamtnmivtls)sDta(mo;u4tlxnmi3iadfs2rlnmp;t4teenxfcoy1oatr u ilt0setriopou4op emnvt s aDur(m nt4olx mo3tad aDraump;t0 eermr3iatlpDrauvi s t2uoxopny4apeelfvs s)s2rm( ont4teeo o3iad s2rln p;u0 reoir3iadfa e uvolt0 2umiopnodalenmnes t aDrr(ro;u1tetnioeilsla uluvsn(4tltoxo iytlp ranvi ()seumxo oodamt mnct s  2tmxmp;u1aeeniocilt a2ulnms;t0 ltrxf oytfp  auvols)t2tmxr iu4altn fesa() 2rrur ;t0alxnioeiydfsDranmpnt) rxriocoatlat aieols) rumxo3oo1optnmncsl( arrru ont1oeenif3iytlsDra(vs u) exoirciotfmtelnvs ()sruoxm oy1lpt mietltf 2rrxmpno4opxn feias sDrmnmp ()aexrioctydlmDraivsl(0trtr(r oo4lp  lietasfartr(m ;o0aee io3tyd a uaumo u) exnmr3oy1optr n s;s) rumim ou1omee fcs (  Dumxroot4oeenifetytlm elnmo t4 exoifcia1omtrlnvo ()sexr(o iydapeelict ()sDua(rpot4oet  fetlslm2elump u4tlerxfcia1fate uvi;t0 2urio3oy4amtelnei ( a2rax  ;o1oexo ieilsfa uluvs;(4 rtomfctadopD  ueilt)s2tmim3ou1altelfet s s2tmxm ;t0tpen oeiyt m umnvo;() exnxfctydlaDeaneo;(0t2toxopiudamen ieia()srtr(m ou4oexomoctytfs2uanvp u)arermf3oatfmtrluvol() etoxm oo1lle  fvta()s2rmuronu4alt  feiltlmDrmump t0 lxrxfcto1oa r i il()teuoxr3iu4lme  fvsas) Dur(roou0olx  f3ilsfaDulu o;t)artoifcoytopDrau i s0srto(o3io1amee icsl(fsDumxmo;o4oexo fciltlm emnvs (0trerir3tytfp rau slt srxoxrpoo1lm   ivt sf rraumpou1aee mf3iyd m um(vs;t) rxnmrciydla   nei;(0 exoir3iu4lptn nci () 2uaum oo0alx  f3ild s2eauvpn() eeoxfctytopDrlueols)trxoim iu1omenmiviltf rurumono1olxnmf3iytfm2umu s;t)tetriocoadlmteaneol( s2ur(r nodamtnlici t)s2ua( onu1aeeo ietad s2ean o u)altomr iadopt  uvsl()t2trxo3nodope mfvsls  rurxrpoo4apt  f3tltfsDrauvonu)alxrmr3tytlp rlieo;t seto(opoodope  fet ()sDtrxrpou1oeenifetlsfa2ul(mo;u)tlxnif iotoaDrliei t0tetr(o oy4al e ncs (fartm(mpnt0optnmf3iasfs eanmpnt)trtnmo iodfp  liei (0 2xrim oydamen nct t)sDtr(rp;u1tltniieiys s2ulnvo;t4 etnir3tatoat lnvs;t)t2um(m oodlmt mfesa(  ruaump;o4tetnmictltlsDul(vsnu0aetomrciotlatelivil( s2ur(m iydapenlivtas)a2uax  oo4opt moetld a emn onu)arerxo ootlpDelivi t0 exr(mpnodapee ivt ()aDuaurp;t0oleomociltfsDrm(vonu0aetomo3tadla elues;(  rtmio nu4ol  mfcs s)a2uaumpnt0texn ieilt s ulnvp u)trxrmf iadfptr ivo t0tetmxmpoo1aleelneil(fs2ra(rooo0altomi3iad aDemn sn(0altnxr oydopDeai o t0tetmxrpou4am  lfes t  rrm( p;u0oltnmf3iydlaDua( p;()trerif ootfa ranvi t)tetmimpio4optemfvtasfs2rmu  ot4opt ioeiaslm2el(msn()tlerir3iotom eanvils0trtmimpio4lpt mici t srtru pou1olt  ociysfmDelnmp t0 eermr3io1op ranvo;s0trtmio no4am  lnes tfarumx pnt4apeomfetldfaDemnmp t) exnxf oadla eaieo;s  etoio io1optemies (f Dumu  ou0apeniociydlmDuauvp t)tetnxo iadlptelueilt s2tr(m3nudaptnlnes tfsDtm(mono1opt ifciltfm2ra( s;u0trxoxo3iatlm r ieolt0texo(o nydaptelnvt (faDrmumont4aptnmiciyd sDulums (0 etoiocto1lm  anvs;( seuoxm3io4lp elivils) 2urxrono1olt moetyt s2rm(msn(0alxomfcia1fat lu s ( t2xrio iudllte ivslt)a2umurpno1oetn f3iltla2emn sn(4 exrmf3to1fp raivs s)srxoimpio1amenmnci t)aruaumo;o0ale iieias m2el(ms;u4 rtrxf oo1omtrlnvi s  rxriopoudomen ietls  rta(moou0oetnii3tyt m2umn p (4arxoxr3ty1lpDeaueils0setr(m3ou1lmtnlncs (fsrum(rp;u1aptomi3ils aDuau pnu)tlxnxr3iy1op   ieo;s) rum(m nydam  mictlsfaDraump;o1tet moeiat m2uauvo ()trtrio oa1fm raivo;t teumxo3oy4lpee nciat sDur(moot0alxn o3iydfmDuan o;u)tlxoio io1fa e nvi t0teuoxrpny1alenlivsat  2raur ou4oeeomoeilt m el( snu0trtoxrciotfa elnvo s t2xmxm3no4amtnlivt (fs2tm( oou0aet  fctyt s2umu s;(0trtoxf3iotlm r ies (  exoxm nodapeelfes (fsrururoot1tlxoiiciasfa um( sn(0 eenif io1fpteaueilt0 rtmir oy1lp nmfes s srraxmo;t1aee mfciys aDrmuvo t0trtnxo ty1laD luvo ()srurio oo1am elfcilt)aDuaxm ot1tpe iictys sDrlump;t4arxoir ty1fpDr neo;t  2xoir3iy4am  mivtlsfaDuru  oo4alen o3tys sDua(mo;u4aetoxfcoo1lm rlnes s  rxrirpiu4omte nei (  rrmum nt0alx iicilsfmDrluvpnu)teeoxrciatfp  ai o;( s2uoir3iodaptnlnct t arrmxr nu0oee mfctatfs2umnms;u4 eerif3tydfate iei t0teumxopiydomt  iesa( srta(mpnu0tlxn f3iadfs ul( o (4arxoxf iydfpt ln ils) rxmim3no4apenmfct s s2rax  ;t0aexn iciltls2uau s;t0trtrxr3ootomDeanesls0 rxmir io4ale mivtat)srraxmooo4aeeoif3iydfm ulnmpn(4alxnio iotfm r nei t0trto(m3ou4omte nvsa(fa2ta(  nu1tee  ietytfs rmu p;u)tlxoxo iodfa e ieo;(0 exmxo nodoltn ietat sDtm(r ;o4aeenmo3iltfa2eln p u0trerir ia1fmt aivs;(0srxrxopoydlpenmfesl(f rrrxr ou4tpen octatls eln p t0 lxnir3iy1late uvi;()s2xrir iy1opte ivtlt sDra(m no0oeeo feilsfaDum(mp;(0trenio iy1omDelneo s0 rtrirpou4ap emnvtas)artmu  ;t0tetnmfeiydfm uluvpnt0artrmf3oy1opDrauvils t2uoxo3no4lltn iei tf rtmuroou4aexn feiltla elnvsnt)trtnxo iadop elneol(0t2xmir3iy4al  micsatfa2tax  ;o0olx if3iyd sDul(vs ()tetoirctatom elivols  2to(r iy4ap n nvtlt s2rrx oou1tet mfctltfa raumsnu4 exrxfctytfpte neils t2uoxm oodlpee fet tfaDrrx ono1altn oeild m2rlump u0tlxrir todlmtrlieo (0srxmxm oy4om nmfes (  rrrurpou1olxnmfeiaslm2uauvon(4arerxf ta1opt  ueolt0teur(m no4openmnvsltfarum(m ot0oltomociltfm umn sn(0arxoif iodopt livs;s)s2um(m3iy4apt mfvtlsfaDtmxr no0texniieildfs2el( s;t0 rtriociadfmDran o;(0teurxm ny4llenlictas)aDumu pno1aet ifetaslaDrlumpn() rtomocia1fm  livo;s0srxr(mpoydap elfcil(faDrru o;u0tet iicias s2emu sn() ltnmr3tytomDelnei;s  2xo(o ou1apen ieil()a2ta(mp;u1teenmf3ils sDemuvo (4 lenmrcio1lmD lu i;s0 ruoirpny1omee ivsasfsrtmu p;o4apxo o3iatfs2emuvont) lxrir3oo1fpDr n i ()srxoim3nodlptnmfeias)s2raxrpou0opxoif3iyt a2el( p t4 reoif3ootoaDe neo;s0texmxrpiodlp elicta() rraumpnu4tltnifeilsfa2uanvsnu0alxomf oydoate n slt)sexoim3oudamtelictlt s2tax oot1teen o3iltlaDumnvpnu0tltoircoo1la raies;t0trxmxr3oo1ape  icias)aDur( oot1aex mieiytfaDuan snt) rtnir todfm   u s;( sexmir oy4lpeelnct t)a2rmu onu0aetoii3ildlmDeaumo;()arerirctadlpD aivi;s0t2xmirpiu1ol   iviat) Dur(rp;u1tlto fetltla ra( p;t) lenmo ootoat au ols setr(o oodlmte fvtl(  rum(r ;u4olxniociytfa2emu pn(4aetnirciydoa  lnes (0trtrxrpny1am  mnvsat sDuaur ;o1teeo fciyslmDumu s;() rxoirctytomDeli i;t t2to(o iydoleelnvs s)aDrm(ro;o0aee mi3iatfaDum(vo u) leomo ia1lm ranvsls0 2toim3iy4opt  nesls  ruaxmono1oetnifcils m2ra(vo t4 rtnif oydomDeauvi;t0 2xr(opiy4optn nvt ()arum(rpno0olx  fciytfm2emu o;(4trtrmfciatomt aueolt)trxr(o oo4lptnmnes t  rua(r no0teeo ocias m emnvs u0aetnxo3ootfpDelivi;t0sexmxm nu4lme livil() 2raxrpou0alxomf3tas sDua( p (4artnxo tadla eauvsls0trxr(r nodopen fvil(fsrra( ont1tlxomfciad s emnvp ()aeeomfctatla   n o;t)trumio io1olenmnctls artmumo;t0aeenifeils s2rmn snu0trenxr to1opDe ivo;(  exmxo iydapeemiviasfsDraum nt4apeomo3ilt m2rmu o;()tlenxrcoodlmtraivo;(0s2xmir3oy1ll   ictl()sruru o;u4olt mi3iadlm ulnvp u4tetrxr oodfmDeln i t srxmxm3nu4lmtnlfet (fartr(r nt0tpeo o3iyslm rmnmpnu0tetriocty1fat  uei;s0 rurim oy4lm  lfei s sDrm(r nt0optn fetldlm2ua(msnu)aexniocoatlmt luvi t0tetmxo3oy1olt  neias)srur(rpoo0apt mfciys mDuau s;t4 exnmr oodfpDrlu i;s0s2xmxrpoudalt mfct t)a2tru p;t0tee  oetydlmDua(vo (0tlerxocoo1lat aivil() etr(r oydame liet () 2tr( pot4optoifciatfs2ul(vs;t0arxrmo3tytopDrln o;()s2xrir3nydoptn ncils) rtr(  ;t1apxoiiciad m eauvs u4 ltoio3ia1faD lueslt)sexr(o nu1ameeliesat)artr(mo;t4tetoif3tysfaDrauvp;(4 ltrio to1lpte u o;t)texm(rpoydaltelfctat  Drrxront4aet iieilt mDul(vsnt) lxrir tydfaDranvs;(  rxm(r oudolt  icta(  rtax p;u0apt io3tytlm2um( s;u0 rxnxr totfpteaueil(0t2uoxm oy1am  mfvi (fa2ra( ono0teeo i3iydla em(msnt4tetnif oodopD  i i s seurxmpny4ll nmnctat arrm(mo;u1tltomieiad a rmuvs;()aetoxo todfa e ueo s0teurimpiydamtemictasf rraurp;u4tee mf3ilsfsDel( p t0altnxrciy1fm  anei (0s2toxm3io1ll elncsat  2rr(mp;t1aeeniictasla elnmo t0trtnmf3ty1lp  auvs (0 2xoxopio1open fvtlsf 2uaxr ;t4olxomi3iyt a eauvs t)artrxocta1lpD  i s t)sexmirpoy1llte nvtls)a2rmx pnu4aetn ieiyd aDemu s;u) eenxf to1opt  ivilt0 exo(opio1ole  nci (fartr(mono0opxn o3tydlmDua(vsnt0 lenirciotfmDelnvs;t0 rto(opio1ol   ivtas) rrm(m ;o1oexnmf3tlsls rmnvont0 eenxrcootfat  nes;s seto(m nodlmtnlncil()s2urxmoou1tleomf3tyt s2rl( snt)alxnxr3oytfm  lueils0t2um(r3oy1ll elieslt sDtm(ronu4alxomieiltlm raumsn(0 etoircto1lm ean s s)trxm(rpoudopenmivil(fs2raum nt1texn octadls2ulnmsn(4artrifcoadoaDelnvilt0trxrim3ny4ol eliviltf rtmx p;o0aeto oeiltla rln s;() rtrio iodlmD lueo s0s2ur(o3nydame mict t)srtax o;o1oetniicias a2ulnmpn() eenmf3ty1omDeaueolt) 2xrimpoydal  lnctat)aDrmx  ou1olx  ieiad s ulu pn(0trtnmo oa1oa eai i t0setoimpiy1lm nmfei s)aDum(  oo1altomf3ildfaDrm( p t)tltnmf3ia1oaDrln o ( teuo(o nydape licsls  Dum(r ot4ope ifeiydfmDelumo ()trtniocty1la  luvo;s0seurxmpoo4openmieta( srurxroou0tee  ictldlmDelu p;(4 eenif oo1oa e ivsl(0sexmio oy1optnmfvs t sDrrur nt0alxnmi3tls s2emuvp t4tlxrir oo1fp ranei t  rtm(mpou1ol n ics sfsDrm(r ;t4tex moctls s ul(vo;t4altnxo3to1omDe nei;t srumxm3ou4omen iei ()a2tau onu4tetn o3iysfmDumn o;u0 rxnxf oatopt luvs;t s2urimpnu1olt  iesl( srraumpoo1aetnmf3iaslm eln snu0arxrir oadla r ivo;t setoio nu4omee nvtas sDraxrp;u0ape iocild s2el(vs;u4 rxnmr ia1la  anvol(0 2um(r3ou4ol   fvsl(fs2rrxro;o0oltn ietydla2ea( s;u)trtoxr3io1lpt  u s ()s2uoiopoo4opt livtls s2tru pnt0tetoioeildfaDulnvs;(0aetomr totom rlu slt texoxo3ou1lm  mivtasfsrtm( ont0tpxo ocilsfaDemuvs (0tlerxf ootfp e uvs;()truoir3iu1ll   ivsat) rumxrono1teen oetldls rlu snu0teerxf3iydfp  lnvo;()sexm(r iu1lp  lfvta(f Dumxrpno0teeoii3tysfs em(mpnt0alenmo iy1fp eauvslt0texr(opou1om  licia(  2rm(mo;o1aeen ieild sDrmn snt0tetrmocto1fmD an s;t0srtr(r3iu1am  miciat)srtmuro;o4tpe io3tysfmDrl( o (0teermr oydop   ieols  euoxrpny1op n ics s) 2um( o;o0ape mictld m ranmo;() rtrif3iytlate ivo;s0teuo(opiodal  mnvi ( srur(monu4ape moeiaslmDrln s ()arxnir3totlmD ln i t0seuo(r no1am elivil(fa2tmu p;u0optnifetlt m um(vo t4tlenmo iydoa rlnes;t trxm(r3iu1lleemictatfartaur nu0altoioctlslaDrmn p u4aexrxrcoy1fm   ies;()teur(rpnydll   ics s srrruroot1tee  o3ild a2umu s t4 exoxoctodfpDeauvolt0s2tm(m oo1omt mnct ( aDrm( pno0alenifcild m2uaumpnu4tltrmrcto1opDr ieslt trtrxr oy1altn iesa(fsDtru oot1oetomf3iysfa uanvpnu0 rxomr3ootlmD livil( t2xmxm3io1ameemneslt)arumxmpno4apeomietytls2ra(vpnu0texrir to1fa e i s t)texrio3oodlp n fcilt sDrru p;t0apt  iciyt a2uau o;u)arxnmf tatfaDelnvo () rum(r3iodamt  fvias  rur( p;t1apxn fciysfmDemnmp;t) rxnxo3oodoate ues;s) 2tmxm nodop nlnesas  2ua(  nu1olen oeiatlm2em(mp;u0trxnmo oo1faDrliei ( seurir3ou4amtn ivta()sruax  oo0tlx  ieiatfm2eaums;u4trxoxo ia1omtelnvi s  rxoxopno1ap   iet () rrm(  nu0oleniieiatfs2rmu p;t4teeomfciydop eauvilt sexmxr nudoptemfctat)s2rr(r ;u0teeniiciatla2rmnvs;u) rerir iotom   n o;s trurir ou4lmee nvi t  2tr( ont1olenmoeiytlmDum( o ()trtrmfciy1fmtr ies;s seur(m nu1ap e ieilt)srumum no1aleomfciatfs ranmsn(4artrmrcio1oaD  uvslt)srtmim3oy1op e fesat aDrmxmo;u0teen ieiatlm2ea(vs t4tlxnxr3ty1fmDrlues s  rtoxmpoy1apeelnci (fsrtax  ot0oetn ictlsfm2rlums t0 rtomf ty1optran s;()srtoxmpoy1om e ieil( a2rmumooo1tpto ictldlaDum( s;u0artrmrciotfmt lnvo s) 2urxo no4amtnlfcias) 2tau onu1tpxoifeiat mDrm( pnt4 rerir tydfat  u s;t)seumxrpoo4lm n nvtl() Dua(mpoo0tlxoiiciydlm2uanmp;u0trenircty1lmDeanesls0 2umirpnudap n netltf Draum nt4teenmfetas a rmu snu4tetoxr oydfmD  i s;t0teur(m oy1open ncils s2um(monu0tlt iociytfm ul(mo ()tetrio3oo1latrln o;(  2urxo3ou4lmee fvtls aDrmurono4oeto fcias s2ulu o (4treoxo3tytopteau i s0 rxmxr3io1opee nvt (f rrax  no4apxnmi3tys mDeanmp;(4tlxoif io1laDrauvi s t2xoiopoodale mnetltf 2tax onu4ape  i3iasfa2eanmp (4altoxfcoodfm eaneolt  rxoxr ny4llt lnvsltfaDumu oot1opxnmiciys s2rmn p t)alxomfcta1om  lieo s0s2xoxr3oy1ame lnvslt sDtr( pot0oexn o3iaslsDrlnmpnu)arxnxrcoodopt  uvilt)srurxo3oydol nmncta() 2taxrp;t0optnmictlsfs rm(vpnt) etrmfcio1fpDe ivs;t0 etrxm3oudamt  ictlt srrmxm ;o0apenmoctad a2elnvsnt)tlenifcta1fptrlues;(0texm(o3oudlm n ict t  rtrum ot4aexo ieiydls ulumsn()aetnmo iotfaDeaivo;t0 2um(opoodlp  licilt  Dtrumpoo0tpeo fciyt a2rlnms;()alerxr tydla eanvsl()trtm(mpoy4oltn nei sfarraumooo4olx mf3tydfa2ra(ms;()artnmociadfpt an o;(  euriopny1alt lfcsa(f rra(moou4ape mo3tldls rl(ms;(0 lxrif ty1omt  nvs (  2xm(m iodol elncia( aDrmu p;t1ale mo3iadfs2emn pnt) leomfcoydfa e nvo s) rxmio3oudopee nvsl(fsrtm(r oo1ape moeils mDel(ms u) eermrcoy1fate n ol(0sexo(opiu4lpenlivs t)sruaur nt0alen oetatlsDrm( on(4alxrmrciadlaD  n o t0 2xrxm3io1omt mfvsl(f 2rm(m ot0apeo ociydfs uln on(4 eermfcoy1lpD  nvs (0trxmir3oy1lm n fetas s2rrx p;u0apxoii3iltfaDum( o;(0tltomocootlmDe nvolt) 2um(r ou4lltnlfci ( arraxmpnt1olxnmfciltlmDum( sn(4 eenmo oydlptrauvi;() 2tmxo oo1lm  mncs s s2rrxm nu4optnmfeiytfaDumn p (0 lxomo3ia1opt  nvi t srxm(opio1lptnmies () 2umxmo;o0olx miciytfa ua( s ()tetrxo3iy1fmtr ues t)t2xrio3oy1amtelieiat artm( ooo1oeenmietadls2rln p (0altrxr3ia1lpteaieo;t0 2xr(o oo1om emfvilsf Duaxr ;u4texnioeiad s ra(vp;(0trtomr3oatoateai ol()tetr(mpoo1lm nlietat sDrr(m ;o1oltnifetydfs2rmums () lxrxo iotoatr nes s)seuriopoy4ome mfvtas) Dua(  ;u4tpt micilsfm2ul(vo;u0aeeomf3ta1lp rlnvs t  etmir io4lp e fvslt) rraum ;t4tetnmo3iys mDranvs;u4altrio3ia1optelneil(0 rxmxopoo1olenmfci t s2rmx  ;t0oetnioeiltfa rau s ()alerxr tytfmtraueo;( texo(r3oo4llt  iet t)s2taxmpnu0apto iciytlaDemn o;(0tltrircoadoa  ai i t t2to(opnudlm e nvsat srum(r ot1oexnmfetyd m em(mp;u4tetrxf3iydoa e ueol(0 rxr(m io1lme  nei s) Dta(ro;o1tex  f3iasfs rluvs u)areoxf3todfat li s;()t2tmxrpoo4o
\ No newline at end of file
@@ -0,0 +1 @@
+ueol(0 2trir3iy4lpe lfcsas s2rmx ont4tpeo ietaslsDrmnmp;u4 etnir ty1lpDe i ol(0 rxoxm nodopt  iesatfs2trx p;o1oet  ietldls2el(mpnt) eenifcia1lpt au i;s  rxo(r3iudllte fei tfaDtaxrpot0apeomo3iydla uanms;t0trxoxr iotfa elu slt0seurxo3nu1llen fetat)sDumu p;t1tpe  oeiysls2umn o;u0aetoxr tadfpt lnvs;t0 2uo(rpnu1ll  mneslsfsDumuroot0tet  iciysfm2rl(vp;(4arerxo ty1lmt livi;()seurir iy1opt lnvta( aDtrurpoo1aetomiciasfm2um(vo t0trermocty1opt  u o;(  2umimpio4op n iei s) rrrx pot4opeomi3ilt m uanvp (0treoifcoatfpte ies;s0seuoimpiydaptn fctlt) 2tau pot0tpx mf3ildfaDul( o;() eerxoctydlateaivi;(0seurxr3nu1llte fctas s2um(mooo1aet  o3iatfsDrlnms;t)alerxoctydfpt  u i;s tetrim iydop emfcsl()sDrmx pot0ape iiciydls2uanmp;t0alermo3oodfmD ln ils) exrxrpou4om n fct sfsDtmxrp;o4oex mfetysfs2eanmp u4tltnmf3ty1op rlu s;( srto(opiodllen fci sfsrumxm ;u4ole mietadfmDrm(mo u4 lxrmrciy1fptr ieo;t) exr(r oo1lp elici s  Drruroou4alt iiciadlm ea(mo u0 rtrxo3oa1lmDeau o;( sruoxrpny1lle lfcia() Dumur ou4tltnmociltlaDelums;t0aexomf3iatfp r u ils  2tmir3ny1amt  fcsl( s2umuroot0apt mf3ilt m el( p;u4arxoxr tytlmDeluvils)srumir iu1optnmivt sfartaxm ;o0apeoifetys s eau pn(4 renioctodlmDr u o;s) rumio no4ope lfvsatf rtrurp;t1tee  f3tad aDrmu s u0 lerir oo1lp e uei ()trtmim3iudlm   icia( a2umu  nu4oltomieiadls2rlnmp;t4artoxo3iadfpD  i o s) 2um(mpno1omee ictls s2ra(  ot1tlx moeilslm2rmn o u)artrxr3tytfaDraivs;s srxrir3nydal  lfcsa(fa2taxront4oltoif3iyt m2ea(vs;u4 exnxrciydoat  iesls0t2tmim oy4ol emncs t  rrmur ot1tlt mieiatfmDrl( pn(4alenif tydoa   neolt0trxm(mpno1ll n netlt  2taxmo;o0teenmf3tysfsDem(vo;(0arxrmr3totlpte nvo t)trxmimpoo1altelneils a2uaxr oo0opxomieild m rau p t4tlxnio3io1fpD  ues;( truo(opnu4omenmnes s aDtm(mo;o0altnmiciatlsDrl(vs;u0alenifcoy1fp eanei s) exoxm iu1omt lnctas  rraurooo0opxo oeiys m2el( onu0 lerifctodfm  lueils)s2tmxo ou4amenlncta(f 2uaxmo;u4alen ociyslaDrauvont) lenmo3ty1faD luvo s  euo(r3iu1lmt lfct s aDtax ono4tlxo feiadfa el( p;t4arxnif3iotfaDr uei;(0sruoxr oodol nmivs sf rtmum no0tpeo fetas s eanvs;u4 exnif oo1lmtrli i t0srxrir iy4olt mfviat s2ra(r ;o0aeenmi3tldlmDraumont) rtrio oadfmtrluvolt  etrio no1olt  nvsa()a2raxm ;u0tetnifeiatlaDrm(mo (0aeenmfciy1lat livs t sexr(o nydale  nvi t a2umxmo;u4apeoiictyt a rlumpn(4teeomf3ty1faDe neo t teur(r oydaltelfct s  Drm(r ;u1tpxnifeildlm ua(vp u)teermf3oo1lm r ieo s0 eumirpoodamenlietl() 2tm(m ou0apxoiictatla umnvp u0tetnxr3oo1laD  ivils) 2triopny1ap   feilt)a2tr(r nt0opxomi3tytls um(ms u4teerxo3todfptrluvi t)t2ur(opiy1lmeeliesasf 2rmx pot1tpxnio3tysls uanvs;(4 rxnif oa1oatran s;t t2xr(mpnudlm  mncs tfsDtaxr ;t0aex mo3tys s ua(ms;() reoif3iotfpD auvs (  etrim no4opt mics t  Duau o;u0teenioetatls uln o;t4tlxrif3tydlpD livol()s2xr(r3iy1op   netasfsrtaxmo;o1apto o3tad aDumnmp t)tetoif3iydfaDe u i;t)t2ur(mpno4amtemfci (  Duaxmpot4alt moeiyt sDuauvs;u)tlenxo ia1late ies ()t2tm(r oy1op nlicsa(fsDtmumonu1aeto o3iatfm2umnmsnu4 rermr3tadomDelneil() rxoxopiudlle  fct t sDua(mpnu1aee if3tysls2uanvon(0 ltrxo ta1fat auei s s2xmxo3oydom nmiesasf rta(  nu4optnmiciadfmDean sn(4tlenmr ty1omtr ieo (0teur(r oy1lp  lfctas arrrxrpno0tltn f3iat mDelu snt) rerxr totlmtelu sl()seto(r iy4aleelnvt ()sDrr(m nu4oeeo feiadlm2ranvpnt4altnxo3to1lp rlu o (0 etm(r nudopt mfvs ( sDumurp;u4tlxo iciatfaDua(vp u) exnir3iodfmDrlieo;t sruriopoodamtn iesls)srua( o;u1teenmociasfm uluvo t)aleoxr3ty1fmD auvi t0trxrxr iy4omeelfcsa(fs2urum ot1tpt mi3iltfm2ran s;(4arenxo3iy1lpteln s;( texoxr3oo1lm n nci (  rta( onu0texoioetltfs umnmont)tetnxfctotlat an s;s)srtmiopoudam  mnct sfarraxroou0tleomi3ilslsDrlums t4treoxrciadla  auei t teurxopoo4omt  netat)sDua(mp;o1oex mi3tyslmDulu snu0arxnxfcoy1lp raivol() 2um(m3ny4am elnciltfa2urxrpoo1aptomf3iadfaDrmumpnt0tlxrxrciy1fa ean i;s0s2xoxrpoo4ole  fcslt) Dra(mo;u1olxnmfeiadfm rmumon()tlxoxo3oo1fpDean olt0s2xrir nu4altnmnetatf rtmxm ;u4tpxnioetltfs2rl(vs t4tltoxfctytla  ln i s0trxmxo iy1alt lfet (f rrax  ;u1tle  i3iatla2elnvo u4aeenxr iodoat lueols)srtrxo iudlmenlfvilt) Dra(mpno0tpx mociatlmDrl(mpnt)tetrxr3tadlp elnvi (0s2trio3iu1lme  ici t s2urum nu0olxomf3iatla eauvsnu)aetriocta1fp e ieil(0t2tmxm no1olt mieias)a2tm(ro;o0texn fcilslmDeaums;t4artnxo3oodla eauei;s) exmio3io4olen fciat  2taxrpou1ale  iciadfsDem( p (0 etoiociadomte ueolt)srxmim3iu4apee iet ( a2tm(rpoo0aptomf3iadla2umuvs;u4tlxomociatfmt anvi;s0t2toxopiydal elncsatf Dtaxr ot0tlxo f3ilslaDuln pnu4tlxnxf oydlmte nes;(0 2tmir oydoptnlfeilt  rum(mo;u4tlt  ieiyt aDumnvont)trermociydfmteanvo;s0s2umio iodalee nctasfaDtaum oo4olt mieiydfa2ranms t)arenxrctadopDe ieo ()teuo(r3nydol  livsltfaDua(mpou4oexoioetydfsDea(vsn()altrmo oatfptean s (0trxm(m3iu4open fvt s)artaur ou1aeeniictys a2ranms t)aetniociytoptrai sl(0srxrxmpoydam  lnvt () rtaurpou4oetnifeiat m2um( o u4alxoir3tytlp e neslt0s2um(o3iu4lmt mics t  2tm(mpnt4opeoioeildfs2rm(mo t4trtnmf3iydlm r uvo s)t2trim3iu4lmt miei (f 2rru p;o4apxoioetyt s2ea(mpn(4tlxrmr oytlaDelueo;s t2um(r iu4ll nmnet s) rtm(moot1oleomfciysfsDra( o;t)trxrif3ty1opt  nvo ( srum(r3iu1lltnmnciltfsDurumooo1ale mfeiys mDem(vs t4tlxnif3todoaD aivs (  exrim3iodome licsas  Dtaxmpnu4olx mieiasla el( o;u4altnmfciy1op r i sl(0 eto(r oy4alt mnvi s sDumxro;o4tpxnio3iatfaDelump;t) rtoxocia1latrlnesls)srxo(o oy4apenmnesl( srum(ront0oltomociatlmDrm(mo;t4alxnxo3to1oaDrli olt  eumim3ou1lleelneia() 2tmumonu0aptniocilslm eln ont)aleoif3iatfpDeln olt) rtmiopiu4lp n ivilt)s2trumonu4tptn o3iydfs2uln p u)treomfciytlp eliei ()teuoim io4lmt mncia(  Dtauro;t4aeeomf3ils a2rmn o;u)alxrmfcta1lmD an o;(0s2xoiopoo4aptn ivi s srrm(r ;t0oeeomfeildlm rm( p ()tetomo ootlpDelues;( s2tr(r iy1olt mnvt ()srra(  ;o0ole mfciltlm ua(mp;t0texnmrciotfa   nei;t  etoxr3io1oleemfct sf Drmxrp;o4tpe mf3iasfa rm(monu4 rxnio3oydop raivslt0t2uoio iu4olen ivils) rta(rpnt4aexomfeiys aDrmums;t)aetnxrcty1lptrlnvolt  2um(m nudalteliesat s2rmxmpoo4oetn oeiltla ua( p u) exnxfcootfatranvs ( s2to(rpny1omte ivtasf rurxmo;t1oexn o3ias a eluvsn(0aetnmr3oa1omD  uvs ( sexoio oudlmtnlnetas s2um(r no4tpxnmfetldfa2el(ms (0tleoxociotomteli i;(0s2um(rpny1omtn fet t) 2raxrono0texnmoeiydlmDumumo t) rxoxr ia1fmt anes;s)s2tmxrpno4lpe mfcs s  rraum ot1alxo iciltfs em(ms (0 lermr3iadoatelu s ()setmimpou1ol e ncsl() Dum(ront0alxniieiltlm2ul(mpn(4 eermo3ootopt  ivo () ruoxr ny1aleemicias)srrmu  nu4oleniictlsfs2ul(mo;u0tlerxo io1fp e n o;s)trumiopoudlpenlies (f rtmu o;u0apenmfcild a uanvp;t4aeenxocoytlpt  u i;t) rum(o3io4ale mivtas) rrmur ou1tleo fcildlsDranmp u)teenmr3oodopt aivs s  2xmxrpno4apenliet s) Dtrx ono0aet  feiatlm2el( p t0 eenxociytfa  auvi;t0t2tm(r no1oltemiet (  Dta(ro;o0ale mi3tadlmDrmuvonu4 etrir todlptranvils sexmim nudal  mneiltf Duaxmpou4altnmictad a2rauvs;t4 leoxrctadfatrlivs;t s2xmxrpoydlm emfvtl(fa2raxrono4tpeoioeiyt mDrauvs u0tlerir3iodomt lieil( s2uoxr ou1apt mnct t) rtr( pnu4aetomfctldfa ul(vo u4arenmo3oydlatraivo s)tetoxr3io1omenmicsas)aDuru pot4alxn fcilslaDumuvp;() rermr tadlateli i;s0seuo(o no4op e iciat) rurumo;t1oet  ictydla2rmumsn(4trxnxociotom  an olt)sexmim iy4aptnliet s srrau o;o1alxnifciadlsDelnvsnu0tltrmfcoydfm eluvi;s0 rtr(r3iu1aptnmics (fa2ua(r ot4aeeoioctldla ulump;() renmrctatfat  uei s0texo(r nydalte fviat aDtm( o;u1alenioeiytfm ra(mpnt0tlerxfcto1opDr i s;( trum(o3iy4lleelneslt artmu  no0tptnmicildfs rmnmon() etnxo3tydfaDean i t seuo(r iu4ap emietatfartrxmoot4tle iociytlmDea(vs u0 ltnmo todlmt lies s0 2trxo oo1ll emfei s artrumpou1oexoifeild a uan p u4tetrxfciodoatrlivi t0 2toim nu4ap n fvils sDtrx  oo0tpto ictlsfa umnms (0aetoxo3io1lat lues;t)sruoirpio1lm e fvt tf 2trurp;u4tpeo i3iyt aDuanmp;t)aetrxf3ty1la e n i;s0s2urim3no1lp e nvtat aruaumpno4aleo ietas s2rl(mp;u)trxrirciy1la rlnvi;(  rtr(r3oodalen ivs () Drm(  oo4apxomfetydfs ua(vont0alxrxrciotopDe n o () rtr(mpiy4llee nei t  rumu ooo4alxomo3tysfs2eauvo;() exnif3ta1fpDr nvo s  etrxr iy1omt mnvt t)a2ua(mooo4alt moeild mDuluvo;(0 etomr iodomD  uvols)srur(r oudllenlies (fsDra(mont4aet mociad sDrm( s u0 etnmo3todfat ln o;(0s2ur(mpiy1om  lnesa(  rur( oou1oeto i3ild m uan p;t0 rxrxr3ta1fpDranvs;(0 2trir3oo4omenlict s sruaxrpno1alt mietyt mDeau snt4texnioctotfaD luvi t trtm(o3nu1olt  net (faDra(m ou4tee mf3iatlmDrmn o;u4trenif3ootfpD livil(  rtrimpnu4amt  fctlsfarrrxmpot0aee  ocild s2uluvo;()texrxfcoa1fat ai ilt  2tm(r3ny1optemiesl()arrmump;u1oleo f3iytfs ea(mo;u)artoio3oadfaD li i;t)srto(o iu1lpeelictltfsrrm(mo;o4oexn ietydfa ulu pnu)trtnmr iadfmDrlnvilt  2xrxo ou1lm  lieta(f 2umum no1tex iictadfsDem(vpnt)arerif3io1lmDelnvi ( trxmirpoo1altnmneia() 2ururp;u1tptnmietatlaDrmnvp;u) lxomfciytlmt lnes;s  exmxm oydlptnmnvs () 2raxr ;t1oltnmfciytfs rlump;() rtrio iydomt  i o;t)teuoim io1llenlicta(fsDtrxmonu0opt ifciatfm umnvp u0texoxfciodfaDr u o s)s2tr(r3ou1om nlfvt t) rtrurpnt0tlx  i3iatfs2rlump (0altrxf totlm eai o t0trtr(r3oudal   nvia(fsDrmumpou0alt mictatfa2el(vs (4arxoio3iydlm rliei s t2trxopoydlmt lictas srra(ronu4oeeomociat aDuln p t4alenxr iydlmtraieo;s0 rumxm iu4olee fcils)sDrauro;o1tlxo octytfmDrmnvon(0aeenio tytfm  aivil() rxrir3nydll  lict ()aDrm(r oo1teeniietltlsDemu s t) rtrif3oy1lmDe uvo;t0 2xoiopiu4lltemivilt)sDum(m ou0tlxnmociytfaDuauvsnu) rerxo oadlp e i s;t0teurir io1ape mnvi tfs2raxr ou1olto o3tad a uan o t)teerifcoa1latrlivs;(0 etmir ou1lpt lfci tf 2umxmonu4apeniiciad s rln pn()treoxrctydoaDeauvolt) 2xoio3no1op  livils  Drm(mono1aexomf3tlt s2umuvo (0teeomfciotfa  lues s s2uoxm oy1omenmnesatf 2ta(rp;o4tpx mictatlm2elumon(4alxrirctydfpD luei;()trum(opnu1lmtnmfcsa(fa2raxro;u1alx  iciyslm2rluvpnt0tetnif3iodoatran s;(0srtmxo3iy1amt lfvtls  Drr(  ;t0tet  fctat a ranvpnu0texomrcoo1op   uvi;t)texrxo3no1omt livia( sDraur ot4olen oetadla umn onu0alxoxr3iadfptr ueols)t2to(o ny4op emfctatfartrx ooo4tpxomo3iad s2elnvpn(4alxoif3ootlmD lnes s)truoxo3no1am   netasfsDrr(  nt0oet iiciasls2rl(vs;t)alermo3oytomt  i olt trxrim3oodolt  ictasf 2uau  ;t4tleomociat sDua( sn(4tlenmfcoy1omt  u ils0teuoxm3oydoptn ietls) Duauroou1tet  icilt aDea(ms;(0arenxo3oo1lpDr nei s)srto(opiudale  fetls artmu  nu1opeoiictltfs2rlnvp;()altrifcoadlmDrlneolt  exoio3io1apenlieta( s2tm(r nt0oeen ieiatfa rlnvo;(0alxoircoa1fatelueo t t2toir nudal nliei t) Dua( pou1olx if3iadfaDumu snu4trxnif io1lpt  n s;t0trurirpiu1amenmnvt (  Dumxm no4aetn i3ild m uaump t0 eeoxo3tatlptrluei;s0texr(o io4op e fvs s)s2uaxr ot1opt ifeilt a rluvsnt) exnxr3to1fmDelnei t)t2xoxopiu4om nmneilsfsrtmxroou0olxn fciydla2ra(ms t)altoxo ootom  anvi;s t2toxopnodamtnlicsatfsruru o;t4tlenifctysla umnvonu4tltrxf ta1lpDelu ols) eumio io4omenmicslt)sDrrxrpou1apxo f3iyd aDelu snu4aleomr tytlp  ln sl() ruoir3nodol nlieslt) 2rrxm ;t4oet mi3iydlm umnmp;t)texnmocio1la e nvolt  rxr(m ny4ll  livi s)sDrru ooo4oltoif3tadla2rmu o t4tlerif todop   n s s t2umim iu4ole mfvsasfsrtau  ou1apxo i3iatfm ulumpnu0 rxnxocoodfa e uvi t sexrimpoydape mneils) Dra(m ;t4tpx if3ild m2em(vo;(0 renxfciodlp eauvo;t sexmirpnu1ll  lncil(faDumurpno4ole miciasfm uaump;t) lermr oytlaDrlnvo (0teuoxo3ny1omt mncia(f Dtr(rpot1tlen ocias aDrlnmp (0alxoxf3tydfmtr uvs;t) eurimpio4olen nvtltfa2urxr ;o0olen f3iadlmDemuvp t4tetomr oa1fat livs;() exoxrpnydlp e nesa()arra( o;u1tee mfeiydlsDelnvs;u0 etnxr3oo1fat aneils0tetr(mpoy4oltn nesasf Drrum no1tlx ifeiyt a2ulu snt4texnmo3iotomD au s;s0teuo(m iy4openmiet ()a2rmuroot0oeto ieiasfsDulump t0 lxnxf3iadla r u o ( trxoio3ou4ape  ieiatfsrrruroou0tptoii3iat m rln o u)arxoif3io1om rlu i;s)tetoim3no1omee ivi ( sDrr(moou1tpx  octys a emn o u4arermo ty1lm eln s;()s2xoxr3no4omt mncsasfa2rrur ;o1oexomo3iyt m ulnmont4 rxomr oodfat  ivsls s2xoxopiodopenmieia( aDur(m ;t0tlxniiciydlm rmumsnu)aetoxrctatlp eli sls srtm(o3ou4oleemnctasf 2tmxmo;t4tltoiieiyt s rlums;u0treoio tadlpt au ilt0s2trim iy1op emfetl(fsrtrur ot0aeen f3iydla2ra(vpnu0alenir todlateli i ()t2xmir3ou1am elfvslt s2rm( poo1tpe moetlsfs2em(mon()teenxrciy1op r i i t)trxm(m iy1amtnmneia()s2tmurpnu1tptnmictytfaDrm(vpn()tlxnif3iatlpDraues s  rum(mpny1ol e nei tfa2rm(rpoo0oee if3iys s em(vo;(0tlxomr ty1oatran s ( setmio3nu1lpte ncsat) Dumxrp;u4aptoif3iatfm2eaump;t4altoio3oydfat lueo;()trxr(o iy1lpe  iesas) 2uau pnu0tpxn oetydla2rmumsnu4tltnxrcoytlatrai s s0 rto(o3oo4openmnesas) rrm(m no4tltnmietlt a ranvp;t0 etniocootop e n s;s)teuoir iudlmtn fvtl( aDrmurp;u1ale mf3iytla2ulnmo;()altnxr tytfpDrlnvs;( t2urim3iudlpe  ncs ( a2uaxmo;t0teen fciad s uaumsnu0trxrxr oydoat  u ils t2um(o nu4alt micslt srraxmoou4aex  i3tysfa2umumonu0tlxrxr todlate n ilt  2tmim3iu1opt  ics s  rrru pot4ale moctld s2emnvo t) rtrxf3ia1faDelu s (  rum(m3oodll e ics ()aDrrumpou1alxoifetyt s2rlumsnu4 exoxo3oo1fmDelnes (0s2tm(m3no1ap elfvs s) 2tau o;u4tlt  fciasfmDem(vo (4 eermfctodlpteli sl(0sexoxopnudalen fvs s)arum(rooo4oex if3iydlm ra(vpnu0 lxrxf io1fpDr ivo s srumxo no1lme  nesasfsDuaxr ou4tpx  ictlsla ra(vp ()artrmo tadfmDeaneo s) 2umxm oydlle  neil( sDrru pot0aet iieiytls rl(vs (0teenifciy1oa rai s t srxoxm iu4olt lfet sf 2rrurono1oetnmoetydlm2elumsnt4trtnmfcty1oate i i;()t2xmim3nu1apen ieils)a2umu ono1opx mieiatfa2eanvp u)tlxoxf3oatfatrlu o t tetmxrpoy4amenlnviat arua(r ;t4alt mf3ildfsDrm( pnt4aexoxfcty1latrau s t)s2toxr ou1lp emnvs s) ruaxrooo0olt iieiadls2emu ont0alxrxf3oy1fa   uvslt0t2trirpiy1amee iesltf ruaxmpoo4olxn o3tld m rlnvpn()trxrxo todlpDrauei s)srtmio3oo4lmtn fctat)aDtaurp;o0apt moctls a ranmo u0 rxrxr3ia1omtr ivs;()srxmxm3oudol nlies t aDumx p;o4aeeo ietldfaDuanms;u0 rtoircoytoaDeai ols0 2ur(rpiu4lm   nvia( s2trxmpot0opx ii3ilt sDem(mp;(0trenirciy1omDrai o t trtmxm3ou1ome lfesl( sDraurp;u1aeenif3tltlm raumpnt) ltnmrcoo1lpt lu il()srxoxr iodap nmiesat sDuaxrpnu0apenmociasla elnvp;u) ltnxocoa1lmt anvslt)trum(o3ou1am e ici (fsDtm(mo;t4alxo f3iad m raumsn(4tetnxf oodfpteanes t) 2xoiopnodlpee fci t) 2um(moot0ope ioctys mDul(vp;(4 lerif tydop r iei;()srxr(m3no4ole mivilt sDtau p;t4oetnifeias a2rluvo t) rtomo oodlaDrlueilt0sexrxo iu1olen fei () 2um( oou0oltn fetldlsDua(mo u4trtnxocio1lmte i sl()seuo(o iudomenlivs (fs2ua(ronu1texoifctytla rmumpnu)aetnxocta1la eaivil( sexmimpny4altnlfcta(  2raxrp;t1oeeomictldfm2eanmsnu0trenxoctadfm  lneilt t2tmiopiy4am  liesa(fa2taxr no4aet mo3iydls2rmu pnt4tlxomr3iytopteluvolt0t2umio3iy1olen fetat) rta(r ou0ope  iciatfmDeau sn(0 exoxr3tytfaD  nei;() exo(r3nu4ol elnvtl()srtmuroou0aex mociatla2elnmont0aeeomr iatlmtrlnvs;s0tetmxo3ny4lmt mfvia( srrrxrooo1optn feiydlm rmu on(4tlermoctytlaDeli olt0trxoxrpnydomt  fvils)arur(m ;t4tleoifetltfs2uauvp (4alxrxo oadfpD au ols s2toirpou1ole lfei t)srraurooo1tlxnifeiytfmDeauvsn() rxnxf todomD  uvs s)s2toxo ny1lp  mieia(  Dur(  ;o0aetnmi3iad s ulnvs;u0teenir iydfp  auei;() 2um(o no1omt  feil(fs2umx  ;u1aeeo o3taslm eln snu0aetrif3iydfpDranvs s0 etm(rpiu4lp   ncilt) Drm(m ;t0tpt ioetys sDra( p ()tleoio iadop elneo;t0sruo(o3oo1amtemicsa(  Drr( o;t1oeeoii3tysfa ra(ms;u0tetnmf oydomDelnvs;(0s2tmim3oydlpt  fes (faDtru o;t1tet  fetldla2elump;(4tlxrxrciydlmtean ol( trxoim3oydlmenlnesl( artmxr oo0olt mo3tys m rmnvs;(4alenmo oodoaDr u ols0 2ur(mpiudlm nlncils) rtr(roou0optniiciadlm2elnmp;t0 exnxo iodfa eaneo ()sruoxr3iy1altelfvi t)sDtmumono4tpxo ieiytla uluvs (0 rxrif to1lat  uvi;t0sruoim3nudlmtn net (faDua(m ;t0oleoiociltls um( s;(4arenxo to1op eai i s0srxo(rpno4omeelietat  2tmu  no0apxoifciys sDel(vp u4texoiociydlp rlnvsls0s2umxmpiu1apee nvt t sDrmxr ;o1tee iietlslsDeaumo;t4areoxfcoatla  aues (  eurir3ny1lpe mfeiat)sDtrump;u4aexnmi3tld a2elnmp u4artoif oytlpD  u sls0teumxmpoy4al nlncs sfsrtr( p;t0ape  oeiyt a emuvo u)arxomo3tytlaDeluvolt0t2xr(m nydap   fvt sfa2ur( pou4oet mfeiydlm eanvon(0aetoifciotlmDraues s) rtrxopiu1ll elfcs t  Dtmx pou1aleoii3iysfm umuvo;() lxomf oatoa r ivsl() 2triopny1ole mfet ()a2rmx p;u4olt if3tat mDelnvsnt0teeoio ta1omD aneils0setrim iy1lle mfesls)srraxmpou0olx io3iat aDelumpn(0trenmo iytlpteauvils  euoxopnydlmee feslt) 2tmu  ot0tlxoiieildla uauvon(4 reoio iytlm elieils srxrirpno4am e neils) rtm(ro;t0oetnifcild mDel( on() rermr3oydfat  ueilt  rtrxo iu4opee ictltfaDua(monu1opxn ieiyslm2ulump (0 ltoxf3iydomDrlnes s srtmimpoo1ope mfctl(faDtm(mpou1ole mf3iltla2ulnms;(4 rxnxocootfpt  i s;s)srxm(o oy4omt lnes t) rumurooo4tex if3iaslaDumump;u0 ltoxo3to1lpDran i s0t2toxo3oudaptemnvtlt) Drm(m ;u1tlxniiciydlaDran pnt)tlerircta1latraieo;t) rtoirpoudolenmicsl() rtrxro;o4aeenii3iasfa2eluvonu0 lxniocootfpDean olt0s2ur(r iy1ope lieils  rrrurono1tpxnmfetltfm ea(mo;u0trenmo3iadoa  aiei s) 2toxo3ny4lmt mivt ( a2ta( pnu1oetomo3iys aDrln o;()arermo io1oaDrai ils0tetrio ou1lptnlnvsa( sDuaurooo4oltnio3tas aDul(vonu0 lermfcta1fptelnvols0 euoxo io1amt mivt (f Dtrurp;t0alx ii3ilsls2rl(mo t0 rtnxoctotfpteli ol(  eum(opoudape mncta() Duaxmp;u1oetoii3tytfa uau o;u)arxnmf iydlate i i;(  euo(rpnu1apte ncilt arumumpnu4apx  o3iadfs2emumsnu0 rermocta1omtelu olt sexmio no4lp n net tfsrra(mp;u0apt moeiatla rm( onu4arxoxr iatfp rau s s t2toxo io4llenmfvslt)s2ur( pot0altomfeiyd a uauvs (0teeomfciatfat luvsls0setmiopou4amtnmicsa( artrxrp;o1aeeo fciasfa rln o t0trxomf3iadoa elu s;()t2ur(m3ou4am e neta(  Dumx  oo1tex  iciadfa2el( pnu)tltnmf3oy1fmDeln i s0 rurio iu4opt  feiatfa2rrxmpnt0tetnif3ildlm eanmon(4 renir tadfpteanvi;t0s2xoir iudlpee nes s) rur(roou1olxn f3tldfa2eauvp (4 eerxfctotfmD  nesls t2uoxo3nydaleemictas arraumooo1opt if3tysfsDea(mp t)aexoxfcoatoptranvs (  2uoio3iy1op  lfvtl(f Durumpou1tpe  fcild s2uaumo;t4tltrmocoadlaD aneo;()s2umxmpoodolenlfet () rrm(mpno4tet  ieiyd m uluvo (4 rtomocta1opt an slt)seto(opiydaleemnes ()srtmxmono4oeto f3iydfaDuan o u) lxomr ootom raueo;( t2xrim iydlmt  fes () 2ra( p;o1tee ioctatlmDranvs (0trenif3totfmtrlneols trxr(m no4lpen ies t)aDua(m ot0tleniocilsls2emuvo t) eerxo tatoatr n sls0 exoxr3iy1ap e nctlt) Draxrono4oee  feiasfs rmumont4 ltoircty1fptr i o (0srxr(mpou4lm emivias aDrrxrono4tpxomoetyd a el( o;() rtrmr3ia1fpt auvsls0 exoiopio1olt micilsfsrtaxrp;o1aeen fetatls em(vsnu4treoxo3iy1fmt ln i (0 2trxopiu4ll  miesa( sDumxrpnu1tleoii3ildfa2eaumonu) lxrmfcootop r nvil( s2tmxr oo4lmt lici t)sDumxr no4teeoii3iadfs2uanvp t4 leomr tydomt luvi;s  ruoir3iodlpenmivsa( a2taxm ;o4optn o3ilt sDuluvs ()altrxrcio1op   uvo t) etmxo3nu4al   fct t sDur( oou1apt iieiadfaDuln o t0aleoxr3oo1lmDeli i s0t2toxmpou4optemnct sf 2tax onu4ope ifciydlmDrlnmo u4 reoxoctodfpD auei;t t2to(r oydom emnetat  2umx pot1tpe ioeiadla2ra(mo t)aexrxo3iydlpteaivs s) etrxmpiodlm elfeia( aDrr(ro;o1tex if3iytfa em(vo;(0 rxomfcoa1fmDraivi;( setr(o ou4apee nesl(f Dur(r ;o0texniociysfs2umump;u) lxnmo oy1omtelieo;( sexoio3ou4aptelivsa(  rtm( oot0tlt  fetytfa2emu pnu0 renmr3ta1lat lu olt)trtrxr nu1ap  livil(farrr(roou1tetn o3tysfa2rlnmpnt) exnxfctydlm  livils0s2ur(opiudlp nmfcta( sDra( p;o4alxnmfciaslaDuau o (4artomr3iadoa eaivsls  2to(r3oy1lmt livtasfarrrx  nt4aetoiicildlsDua(vs;t0altoio iadoptrlueils0t2tr(opoo4lmtn fctas a2rmxr ot1aeto i3ias m2ea(vs (4artnio3ootfa eluvo (  etrxm3oudlm emnvsatf rrrxr ot0oet  oetlsfs2uluvpnu0 lxnio3oodom r nvs ()seurxr3oy4aleelicsas  2tmur ot4olt  feiaslsDuan pnu) lxnircta1lpD  nes t s2xr(mpiudap emfvsat s2tru p;u4aptnmi3tld aDra(vs ()tltrifcoy1fp eanei;()trxrxopou1lptemfvtasfsrtmuroou0ope  oeiyd s2rl(vo u)aetomf3ta1om rau i (0texo(o ou1ap e fctl(fs2ra( p;u4apx  o3iyd sDranvpnt)aeeoxfcty1omDran s;()seurio3ny1op  mictltfsDtm(r nu0aeeoii3iyd aDran o (4 lxoirctadoa e u o;() 2uo(rpio4lpenlfcsasfa2uaxr nt1apx  ieiadfmDemu snt4 lxrxo3oytfm  aieolt0s2xoim3iudlmenlicsltf rurx  nu4aetnmiciltla2ua(vs t) ltrmociodfp eln ols)s2xr(m3io4op  lics tfsDta(rpou0tltnifcils s ul(mp u)trtnmo3tydoaD livi;s0 rurxo io1lpe lfvtl() 2urum ;u1tpenifeiyslaDuanms;u4trtrioctatopt  ieils t2xmir3iu1amtnlieslt)a2ta(m ;u1olt mo3iyt aDrmuvonu)tltrxo3oo1laDranes;() etrxr3ou4am emnciasf rrax o;u0oex  ictld m2em(mo t)arxnxrcoadlaD luvo s  eurir3oy4op e fetls) Drru ono4tpe  f3ild mDrmuvs;u)altoifcoo1op   uvi s srxmxo ou4lp nmneia(fsDrrx  ;t1tlto oeiad sDuln snt)arxnxo3ty1oaDrlneols)srtmimpiodom e fesl(  2rr(monu4tet moetatfa rmn pnu)alxoio ta1om  anvs;(0tetrir iu4al e ivi t)a2raxro;t4aee iieiad s ua( o;u0 eeoircoadopDeau i t trxr(m oy1ale livi s)sDurxro;u1aeeoif3tltfmDea(mp u0tltnir3oatomt  i i ( trxrirpoy1olen fvi sfsrraxm ;t4oet mfeiasfmDranvs t0texnmr3oy1fptrlivs s) rtoir3nudlp  mivsa(f 2ta(m ;o0apx mi3ilt m eluvs;t4treoif ia1fmDranvs;(0trtrxr ou4altelfcia(  rrrx  oo1tlt mfeiadfsDeauvp;()trtnmf3ty1fm eluei;( trxmxo nu1amtelnetls)sDrm(mont1open feiytlm uanms;(0tlxrif3oytopD anvo;s0srtrio3io4lmenlivtls sDurxrooo1oexn f3ild a el(vsnt0 exoio ta1lpDeaivil(0s2urxo iydomtelfei tfsDumx oot4openiietad s2umumo;u) exrxoctotom eai o;s0trtrxr nu4olt  nvilt arumur nu0oexn ictatfs umnvpnt0trxomf3to1lm ran o;t)teurxr3ny1lme livt t) Dtaxmpnt1tex mfeiyslmDumuvo u0aetomf3iodomD au sls)texoim oodaleemict sfsrtmum ou1alt ifctltlmDul(mpnt4aexoxf tadfpteai o;t)t2xrir3nodll e ivi t)sDum( pnu1apt  oetat mDuluvs;t0tlerxo tydlptelivi t0t2toio3no4openmncsat)sDraxmonu4oet mi3tys s umuvo u)aetomfciy1oatr u o ()srto(o no1omee ivia() Drr(m ;u4alxnifetltlm raumsnt4trenxocto1laDrli il( trxo(opiy1lpe  iciltfartmxmpou4olx mfeiatfs2emumon(4texomfcootfptr uvs;t0 2tmir nu1aptnlfcils  2rmum ;u0tleomf3ilsfm rluvon() leomf tytop   uvsls trtm(o3iodolt  ncslsf 2taurp;u4aetomociatfs2emnvsn(0texnxo ty1opD luvi;(0trxmim ny1al nmfvt t sruax oot0aeen ictyd m umnvp;t)tlxoir3tadlp ranei (0sruo(m3no1lm n iesas)arumxr oo0aetnmf3iydfa emumonu0teeomf tadomtrau i;()texrxo iy1amt miet t) Dtr(mp;u0opt ioctat m ulnvsn(4alxnxf3todlm eau i;s0teuo(r nu4ll elnvt s aDuaxmpnu1opt mfciadlmDumu onu4 leomfctotfpD lies;(0 euoirpiudaptn nvi t  2urxro;o4altnif3iydla umn s t0 rxoxrcoa1oat au i;t  2ur(m oodap elfcslt aDtmumono0tpxnmicias mDemu s () ltnirctodoa  lneo (0 rxmxopio1alte fctl()s2trx ooo0apen f3iad m ranvp;u4aeenmf todfatrlues;t setr(m3iudlmte nvtasf Dta( pou1apto o3iad a el(vsnt4 rxoxr ootfpDrlivilt0sexmimpoydlmte icsat  Draxm ;o1tpxoioeild m2eanvs;()aetrmf3iatfp rli o s0s2toxopny4lme mictlsfa2tru oou4tpe ioeiysls rm( o t4teenifcio1laDr nvils) rxoir ou4lm  lieiatf Duaxr ;t1apto fctltfs2rauvp t0trxnif tadlp  lueol( s2toir nodamt  nesl( sDta(root1opx mi3iytlaDea( p;u0 leoio3oatlaDrlueo s s2xo(o oy4am e net t) rrr(rp;t4oexnifeiadlaDeanvp;t0trxoif to1opD  ues;t)teur(o io1lp e nes sfaDta(r oo1opxomi3tldfa eluvpnt0trxoio oatom   n i t trxmirpoo4lp e ies s aDur(  ot4altn fciad a2emn pn() etnxr3oo1fmtr u i s0t2toiopnu4op  mietl()srurxmo;u4alen ociadfsDrl( o;() lxrio iadopDr uvils)t2xoxm no1lm elfetl(fsDraxmoou4tlen f3iysla ran sn(0tetoxf3tydopD  n il(0 2uoxmpny1ope lfctat)aDua(  ;o1oet  fctlt s eau pn() eeoxf3iydoate n s () 2tm(r oodlm elncil()a2raxront1optn o3iat m2ulu pnu)teerxf iadlptean o;t0s2xmim oy1amt mnei sfs2um(rpou0oetoif3tysls elu o;u) rtriocoydopDeau o;(0trtm(r nu1llenlnct (f 2tax poo4tetnmicildfm2uln o (0alenmociydfmDeluvo s)t2to(opio1ome mfeta(  ruaxmpoo0tle  fcias aDrln s t0aexnioctadlmte u slt) 2to(opoo1om nmnctas aDtmxmpnu4alxniociasls emnmpn()tetrmf3to1la elivi () exm(o3nu4ole lieslt  Dtrxm ot1olx ii3tyt a rluvo;() eenxo oo1fatrluvi;s0s2tmim oodam n ictl()sDumx pou4altomoetasfa rlumsn(4trenmf oo1lat  n s;s trtriopiy1lp   ivilsfa2trxroou4opx io3iydla eanmpnu)trtrmr iy1fatraiei;(0 2tmir3iudal  mfei t a2rrurooo0oetoifctad s rau s;(0aleoxociy1lmtraivs s0 2urio iu1ap e ics ( arra( oou4texoioetytfa emnvpn() rxrio oydoaDeau sls0 exmxopny1ameelfvi t  2rr(mpno4optoiictytlm2el( s u0 exnxo3oydfpDe i sls)s2xrxr3iy4apt mnviltf 2tmu ont1oltnmfeiydfs rlnmonu)aetrir oytoa e nei ( seto(m3iydllt livi tf rrrxr nu4apen oetlsfmDua(vp t0aetrxrciytlaDeai ol() 2toxr oudopte nviltfs2rrx o;t1ope io3iys mDem( p;()texoxf oydopDeliei t) 2xoio3oudam e icslsf rurxm ;u0aex mo3iytls rmu o;u0 etrmr oa1omt luvils trur(o nu4amte fcias s2rrumooo0oeen fctltls2ra(vo u)texoxo iadop eluvo ()srtr(mpnu4lltemfviat srra( p;o0aex io3tltls emn p u4 leomfcoadlaDr n il( sruo(o no4altemici (fsrrm(rpou4olt moetld m ean p;u0texoxr oytopD aueo;s)tetoxr3iu1lpte ies ( s2trxmp;o0tlenif3tyd mDeau s u4trenmr3oatopDelivsl(  2uoim3nu1lp n iet (faDtmx o;u1olt  ociat mDeanvonu)trtnxf oatoaD  nvol()t2urio3oy1lle mneiltfartmxronu0tptoii3tltfm el(mp t4arxrir todlp eli slt) eto(r no4altnmnctl(fsDuaumooo0alxnifeiytfm ua(ms (4teenxf3iadfa  lieol()truo(rpoudll n ivia( sruaurpno0aetoifeiasfa2rm( snt0 renmr3totlaD  nei () eum(r iy1lmeemnetasf 2uau  ou1tpxoifciasls2rmu o;u) exnxf tadfmDrln il(0 rum(m ny4lmt lfvs tfa2ururo;o4oex ioeiadlaDuan p ()aeeomo3oa1omtraues;s  2tmxrpiodamt  icils arta(  no0tpx io3iadfa rlnvp ()aeenif to1oa   uvs t srumim3ny1lp n fvtlsf Dtmurp;o0apenio3ildfs ra(vonu0tltoxr3ootlm  lnvol(0teto(opoodol nlnctltfartrumo;u0opx moeiys aDumn pnu4tetoiocoytfaDrlnvsls)t2um(mpiy4ll  lfcs s  Dtm(r ;o4aexoif3ias mDrl(vo (4trtrxf3iatlpDraneo t teurio3nudam elnvsasfsDraxm ot0tlt  i3tatfa eln s;(4 ltrxfcoydfm e uvs;s) eurxo3iydomee fcil() 2uru o;t0olt mi3tyt a elumonu4artrmrcoytopDelies;s)srum(o3iu4ale lnvslt srta(m ;u4oeenio3iatlaDua(vo;t0 exomo3iotfaDelneo;s)teto(o3io1lm   iesl()sruaum ;u0apx  f3iys mDemu pn(0tetomf3iydfa   neils)setoxo3oudape  fvt t s2tr(moou4tptn f3iysfm el(mpnu4trermr iatfa   ieo;t0t2xmir oo4lleelnvilsf 2rr(m ;t1aee  ieiltlm eaumpn(0 lxoifcootfaDrlivi;()tetoxm3nydlmtemnvia()artau  nt0aet  octys a rln p u) leoxocto1laDe n o;s0 2trxm3ou4om nlfet t aDumxmpnt0aleoifciysfaDean s;(4 lxrmocootlpD lies t trxrimpno4ol elivtlt  2rmumooo1aeen fctls sDem(vp;(0teeomo3tydlmt anei t trtoxr3iu4omenlnesat)aDraxmont1opeoio3tld a2rau ont)tleoxfciydfa e u ol( teumxr3nydole lnciasf rta(m ;t1tet ii3iytfmDra(vonu4teeoio ia1om ran ilt0srxm(m3oydol   nvil() Dur( o;o0aee iieiys sDemn o u) eeoio iytopt  i o;t  rxoxo3oo4al n icsa( aDua(mp;t1opt  fetlsls emnmo;u4alxnxf3iytfptelu i s0 exoir no1ll  lnesl(f Dtrxmpoo1optniicildla ra(vp ()tetomo ia1oa rli ils teuoxo3nydam nliesl( sDum(ro;t0apt ifetlsfmDuanmon(0 lxrxr3iytla  aivi t0t2um(r iu4ap nlfciat)arra(  ;o1oexo fciyt a umu p;(4 eeoifcoy1omtr ivol( truoim3ny4ap emnei () Duaurpno4tlen f3ilt a uauvs;u) etomfcoodopteluesl()texmxopnydllt lietlt  Drr(ro;o4oleoif3iltfa2emu p;t4aetrifciotfmt  iei;s  2tm(m oy1lmtelnct ( aDtaumooo1opxniieiytlmDem(vo u4trtoio oy1oa eln i s0t2toxo ou1lmt liei t)sDuaxroot4tet  oetydfsDumnmont) ltriocoydlp eanes t)t2xo(m no4lmte fesls)aDrmum ;o0aptn i3iytfa rlu s;t4aetrxf ootoa eln sl( setr(opnydoleemfet t)sDrmxroot0optn i3tltfm el(vs;() rtrir3oy1om  ai sls)teumxo iudllt  fvilsfsDrrxro;t4tet ii3iltlsDul(ms ()tlenmf todopte n ilt)texr(o3no1alt livsa(  rtaum oo1opeoio3iatlsDrluvonu) ltoir todopDrlnei;t) 2um(mpoo4lmt mfeiasfsDur( oot0aet ioeias a rmn snu)trerxoctotlm  au o;(0 etr(mpoydlpt lict (f 2taxmonu4aetnmieiyslsDrmnvs;t4trxnmf iodlp e nvo;t  rtoir ny4lpe  fcsl() Drm(moou4aexoiieiydlm emn o;()alenmoctytoaD aneolt setrxmpnodale mfvs s)sDtru  nt0tleoiocils a rluvon(4 etrmrcoodla  li s (0 euoxr3oo4omtnmivi () Drmu  ou0aee  octyt aDrmnvo;u4tetoir oodfa rauvo;s0t2uoxm3no1lmtelicslsf Dtaump;o4tex  icilsfa eau snu0alxomrcoodoat ln i (0trto(o nudapt mfetlsf Drmx  oo4ale ii3iasfm2rau p u)arxoxr3iatfp r u i s) 2tmio3no4oltnlfet tfsruaxm ;t4oexnmfctld s ua(mon()arerxocootom   n s;t0 rxoir3oy1lptnlnvilt  rtaxmont4alxn oetytfmDem(mo (0teenxr iytfaD lnvs s trxo(r3oy4amen neil( s2tmx oou0ope  iciat sDrmnvpnt0 ltoiociatoaDrlivs;s)tetoir iodaptelict t  2ua(m ;o1oetnioetasfaDul(vo;u0 etnio3iydlm r uesls0texrxopiu4ll nmnciatfsDrr( ono4tle io3tys sDul(vpnt4 eeoxfciatfptelivols) eumio io4lleelnesl( aruaur ;u0tlxnmfetlsla uau o (4 renmf io1fpDe uvi;(0seuoxmpnydlptnlivs tf Dta(r ;o0oexnmictydfm em(vont)alxrifctadoate u ol(0 2xrxm ou4llenmfeil() Dtmx ooo4oeenmoeiydlaDea(mpn(4 renmo oatopte ivol( seuoimpno1ope  nvi t sDraum no0oleo f3iasls2uaums;t0aleoir3iotfpDe iei s  2uo(opiy1am elfvsl( srrrxm ;t0aeeoiieiatla2umnmsn(0 reoio3oadlmDr ies t tetm(r nudlmtelictas  Dua( p;o4ole iiciasfsDeln p u)arxnif iatlat aneils0texr(o oy1omte icias s2rmumonu4ole ioetyslm2ua(mpnt4trtrmf io1omDr nvsls0t2tmirpiy1ol n nvsl()s2tmu ooo0oeeoifctysls2rm(mp;u) rtomfciodfpt anvi t)trxrxo nu1apte fcias) 2ur(rp;o1tlxnioeiatfm raums;u4 exoio3oydlm   nvo t)s2uoxopoy1op emict t aDtr(rpnt0ape ii3iydla2emnvp;u)tleniociy1laDrau i s trtrio nydlpt lictlsfs2rmumo;t0aet  o3iltlm raumsn(0areoxo iatlp   ivsls0trxoiopoo1olen fvta()aDraump;u4tlenifciltfaDranms;t)arenioctydlp rln s;t trtm(m nydlltemfvsas) 2rmu p;t0olxoiociatfsDrmnmonu0 etoxo3iadom e u i;t) rur(mpny1ap   fetlsf Duax p;u1apxnioetld mDua(vpnt4artnio tatfmtraieils)t2xmxrpnodom n ncilt a2tau o;t4tetomfciyslmDeln pnu0 lxnmf iodfa r u i t0sruo(opiudap e fcilt)aDtaumonu1aptnifeiltlaDemu p;u4alxnmf tydlmDeaueslt) eum(r oodol  lnct s sDuaxro;t1optniocils s2uln o;(0aetnxrcoytlaDelneolt)trto(m oydlpee ics t) rur(mp;o1tpt mocils m ranvp t4tlenmo3ta1fpD li s s0tetoxrpoy1lmen feiat srumxmont1tetomoeiltfa2elnmo t4 rtrmo3todfp eln o s s2tm(r io4lpenlfet s)srra(r ;o4oeenmiciydlm rl(vsnt0trtnxrcoydopD auvil( t2tr(m io1lmenlies (f 2tmxrp;t0tee mfetas a ua( pnu0alxoxo3oo1om  lnvil(0s2ur(r3ny1lltnmfeslsfa2trumonu0oetomoeilsls2rluvp t0aetrmf to1lmDraieo (0 etrxm iy4ll emnesltfsDrr(mp;t0ape mieiys m rln pnt4 rxnirctotfmDrln o;s0 exm(rpnu1omtnlfvslt artmx p;u0tpxomfcild aDeau on(4treomr iodom r nvilt)trumimpio4lmeemivtl()s2rmx o;t1texn octldfm2rmnvon(0 rxnmfciodfmD auvi ( trtrim3nydlme miesatfs2rrurp;o1apxoio3iyd s2rmu p;u0 etomf ootomtrlu o ()sexrio3ou4om e netas) 2rru o;t0aet ioeiatlsDel(vo u4texnxo3oadlp ranes t0teurxopio4llee icslt)artaur nt0oexnif3iasla2rmuvo u) etoxo oydfa elu i s)s2xr(m ou4altelict t)aDrr(m ;t4tpeo i3iasfa uluvs u0 exnio iatoa r i o s) exoio3oydalen netls sDrau  ou0apxn i3iydfa rln ont)tetrir3iotop r uvi;s) 2xrxr nudopeelfvtlt) rrmu oot0tlxoio3iatls2umnmsnt4 lerif iydop e nvi (0setrxopoo1ope lfcsas  2ua(r ou4ape  oetytfa2ra( o;t4aeeomr iatopDeai o s0trxrxr3io4op n fciatf 2tmu oou0aetn o3tytfm emuvon(0teeoif3oodlat lueo t)srtoimpnu1apt  iciasfsDururp;t4aptniicils sDumnmp;t)alerxo3oatoatr nvo;s)truoxm iudome lfcia(f 2ua( p;u1opxoif3iltls ra(vo;u0alxoxfcootfatr nes;t s2umxrpnudopte feil()sDtmumpoo4tlxnmo3tat s2ea(msnt)alerxf3oydlaDrlnvils0setmirpnodap n nvt s s2rr( p;t1apto ietat m2rmnmsnt0trxrxocoatlatrlu ols seumimpny1lm nlfcs tf rurxrpnt1altoifetlsla ea(mp t0treoxo iadopD au i;s)t2xmim3ny1opeemnviasfarraum ;t1olx iiciydfmDrluvsnu4altrxr3oydoaDr ues;s0truo(m3ny1omte fvt t)aDrr(  ;u4tpxnmf3iyd sDelnvpnt0alxnxo3oytlaD lueo (0s2xmxrpiydome  fvi s sruaxr no4apt  o3ild a eaump;t0tetoxoctadfm   i o s0s2tm(opny4lpt lnctl( srumxmo;o1olxoiociat s2eanvp;u0 rerxr3oadomtrlivils teumxm3iu4lpte nctas) Dta(ro;t4olt  i3iysls ranmsnt4 lxnxf iydop   nvi t t2toxr3oodamee ivsa(  2umu poo1ole if3tatfs2rm(mp t) etoio oytfmtelu i;s s2ur(m3iy1am nlfctas) 2ta(rpot4tpx  ociatla2emn o;u)tlerxr3oy1lmt ai o;t0texoxopiy1ape  fvi () rtr(mo;t0texn ictls a ra( o;t)arenmo3to1fatr ivslt0srxo(m iu1al  lnci t) 2raurp;u1aexn ieias aDel(mp;u)trxrmo3ia1omt anvs;t)setoxopoo4lme mfetlt)arrmu  no1openio3ilslaDul(vp;u)arerxo3to1faDe u sls0srtmxm3ou1amte fesas sDtmurpou1aee moeilslsDeaumo;t4 exnir3io1fmtelieilt)teuo(o3iodomtnlnetas)aDrr(m oo1tpenmoeiltlaDra( p;u)aexrmr ootfptr nvi ( srum(r oy4op emfvt ()a2um( pnu0olxoif3iysfs ranms t4 exoxrciydfa eluei;(0 exrio ny4lltelieia( sDururo;o1tex iociadla2emu o;u4 rxnirciytlmDrau slt) rurxr io4oleemnctatf Drrxronu4ope iictltlsDra( onu)tetnxr tatfptr uvi t trtoim io1al nlneils)artmx  ;o4tpxn fctaslmDraumont0alerxf3ootopteauvi;s0sexr(rpoo4openliciatf rumumpnt1tptnif3ilt a umu pnt)aexrir3iy1fpDrlnvilt)t2xrxopiu1omtnmietlt) rrrurpot4tpxn iciadfa emu on()teenmf todopte nesl( texo(mpoo1ol nlnvia( srrrx poo1tetoifeiltla2el(ms;u4 ltnmrcoo1omt li ilt)t2uoxopiodopee ici s)a2taurooo0altn ictldlm rm(mpnu0teeoir oy1opt  uvo;s) exmxmpny1ap nlivsa(f Dtrxrpnu1alt miciyt sDuluvsn() ltrxr3iodopte ies;()teuoir oo1al  mnctas)aDrmumono0olx  ieilslm2ea(msnt)aexnmf3oy1oaDe uesl()seuoxo3no4op  micsls)arurxrp;t1tlxoif3iadlm2ul( o;t)alenmf3iatfa r ueil(0 rtoxmpiodal  mivt t)sDtm(m nu0oeeniieiydfmDrmumpnt)trxrir oa1lpt auei t0t2toim3iy1altnlnvt (f Dur( pou1aeenmf3iysfm2rlnmo t4arxnmo3ootlm r u i;( setrim3iydlmtnlict (  Durxro;t1oet mfeiysfsDrlnms ()aeermrciodfaDranesls0s2to(m3io1opeelfcsa(faDrm(r ou4oet  icilsfm el(vs;t4altrio oatfm e neo;s0 etm(r3oodolenmfvils)a2rau poo4tex moeilslm umu o u0 rxnio iy1fm r u o t) rurxmpiy1lpte nvs sf 2tax  nt1oeenmocilslmDulnvo;()aexnmf oytoate uvo t0 rxoiopny1apt mfeiltfartaxrooo0optnmi3iatfs ra(vs;u0 rtomf3oodfmtranvo () euoimpno4lp n fetlt)srta(rpnt0optnioeiltfsDum( o;t0 leoxr iy1lmteaiei s)s2xo(o nydam  mncsas)aDtmu ono1texnmi3iytla em(vp (0trtnmrciadoate i ilt)setmir no4ame  ncs t)arrmurp;t0olx mo3iat m2em( o u)tlxnxo tadfaDrliesl(0 euo(o oydol  mfct t)s2uru  ;o1olxn f3iadfa2ua( s;(0tltrxo3io1lmDelues;t seumxm iy4aptn feslt s2tau pou0oexoioetldlaDrmnvo t0texoxrcoodopte ues s) 2ur(opno1alt  feiatfsrrmx ooo4oeeoii3iytls rmumo t0aeenircoatlm r n slt)trumio oydole mnvtat)aDrr(rpou1aex iiciydfmDemn o;() ltnmrctodlaD luvils)s2tr(opnodlpeemnvtat) 2tm(m ;t0tet ioetyt mDumu s;u0alenxf3oatfptelueo s texoxo3nodlltn nvi tfs2raur nu4tleo o3tldla2rm(von(0aeeoxo3iodopDr ieils) rum(m3io4am n nvsltf rumumpno4tex moetadla ulnmp;t) leoir ia1fat aivsls0srumim3nydol nmfesa(farrm(rpno4apxomfetltfs2uanmont0 rxnxo to1oa  auvols0t2xmxo3oo4omeemnvt sfsrtm( ont0oeen f3ils m eln p;() exrmr3iatoptrlnei;(0teuoxr3ny1ape  nctat  rur(mp;t1alto i3tytfmDumn p ()teerioctotlm  aies s) 2xmim3ou4ll nlies t a2rmum ;o0oetomfctls aDrau p;()aexrxf3ta1opt  ieo s)teto(m3nodoptelneilt) rtmumoot1tltomo3iltlaDeanmpn(0trermf3ootlp  livo (  rtmio oydomt mnei (fsrumxm nu4tet ii3iad sDuanvpn(4 rxoxf iy1laDr i o;()seuoio oy4oltnlici s  2rmur ;t4opt ifeiydfa rmn ont) ltnmf3tadlp  lnesls0seur(r3io4alt lieia(fa2raumonu0opto ietatlaDuanvo t4texnxf iy1fp e ues t0srxoxr io4lmenmfct ( aDtr( onu4tle  oeiaslm rm(ms;(0teerifctydomDelies;t0t2tmiopno4omenmfvsas a2urxm ot4altnii3tydfmDrmuvpnt)texnmf3iytopt livo;(  euoir nudolt  fvsltfa2raurp;u4aet if3tlt a eauvsnt)trxrxo3oodlaDrln o (0sexoirpno1ll e neslsf 2uaumpno4tptomoeiydfs elu p t4aeeomr oy1fm  lues () 2ur(o nudapt  ivt ()sDrm(mp;o0ape moetatlaDrl(ms (0 ltomrciatlpD lnvo;s)s2xrxo3ny4ape mfvslsfarrmxrono1teto feilslm rl(mpn(4 ltoxr3totom raivo;t0srumimpny4lpenlfetltfsrrax oot4aeeomf3tadlm2rlu s u4arxomo3iadomtrlnvo s0t2toim3oodopeemnei (  Dtrx p;u1olenii3ildfa2umuvs;t4artomo oadom eluvols t2toim iy1lm e fes (  rtaxro;u4oeenifeiadfa2em( pnt0tltoio3oytlatrln o s srumir3oo1open nci t aDurum no0ape mociysfsDra(msn()texrio iodfpt livs t0 exo(o iy1omtn ivil()artmxr ;u4aetoio3ildfm2eluvsnt0trxrir3iotomD aivil( srxr(o3no4ll nlfci sfa2ur(mpno4olen fcildfm2rmuvp;t)alerxrcoy1fa  lueo t0 rum(m3oy4ap eliviasfaruaxmp;o1oetnifeilsfs2rmnvsnt)aetrxr3totlat ai s s0 rtm(m3ny1lpt  fcs t s2urxmp;u4teen octysfsDeaums;(4 eeomf totom raues ()setrxm3iy4am nlictl() Drr(m ;u0opeo i3iad aDelnms;u0trxoxr tydoa  ai o s sexoio3iy1alee fvs s a2ur( pnt4opxnmoctysfaDea(vp;(4 lermocta1fatr i i t0trxr(rpoydom nmietl()a2tax pot0tleomietld mDulumo t4 rtoxo3todomte neo s0 rtrxopiudapt mictlsf rtmxm nt4aeenio3ils s rauvon(0arxrxr3totomDeluvs;s0seuo(rpoy4lmee fctat)arurumono0texn iciad s rlu sn(4alenxr todop  lues;()s2xmim3ou1ameelfetat) 2ua(moou1ope  feiys m2ra(mo t)tlxnxoctotfmD ai i t0trtm(m3no1olte ivs t)a2trx  ;t4tex  ieildlsDum( s;u4 exrircto1lmteanvi;t t2xo(r3ou1al nlivilsfsDrrx ooo1aeeomicilslm2emu pn(0trxoxf oatfpt au ols s2tmio ou1am   ncsa()srrruro;t4ope ioetldfm2umump ()treoif oydoptrai sls0 2xrxo nydop elfvi sfarumumoou1ape mfeiadfa2ua( p t0tetoif tydla r nei;s0 etr(mpoodom  lnei s  Dra(m ;u4oexnmictyt a umump ()altomo3iadop  ln s t) 2um(rpiy4ll n iesat)aDua(m ;u1aetnif3iaslsDua( snt)aetoifcootlmD lnesls seuo(mpio4lpenlivtat  rta( ont4tpxoiieildlaDra(ms t) reomrctatop  lnvo;t  rxrxmpio4om elfet t a2ra( p;o1apen ictat a2ranmpnt4artomf3iatfmt li ilt0s2ur(r3nudlm elfct ( aDrmxrpno0oee  ietlslm2emumsnt4tetnioctadopteli ils  rumir3iydol elnes t) rraum ot0opxnii3iyt aDrlnmpnu0treoif tatfp  li s t)t2urir oydalen feslt)s2urxm ;t4oexo ietasfs um(ms;t4altnio tatfpD  ieil( teur(rpoo4ale mnctasfsDta(ronu4alenmoeiytfm2rm( s;(0 eenmo iy1fmDrau o (0srxrxmpnodolt  nvi t) Draurpnu4ale mf3iysls rm( pnu4aeenio3iodoat lueo;t0texoxo nu4amenmfcsltfartm(  oo0aet if3tytfa ua( p () rxoxo ty1fp ean i s setrxrpny4olt lnvt s  rua(m ot0oex mociatls2ranmonu4 eeoif3oytfmDr neol(0tetm(o3iy4lmeelnvs tfs2ur(rpoo4apxnmfeiydlsDem( o t0 exoifciydlp elnvs (0t2tmxo nu1open icta( a2umu  nu4aex mo3iadlm rmn p;t) ltnxf oy1lp   i o s0s2xo(m3no4lpeelncs s  2umx  ou0tlx mfeiaslsDrl(vp t4trtoxoctatop e ieo s0 eumxrpoudoptelivi tfsrrrx  ot0oee if3ildfsDran s;t)aexrmo3iy1fpt an ol( tetmxm3ou4omtnlfcsl()aDrrxr ot4teto ietltlm uan s ()alxnmrciodlpte uvo s teum(o no1alen nvsas a2tau  ;u0oex mfeiydlaDrlnvs;t0 rxnif iadop  lu s t0srtmio3nu4ame mfvslt)s2tru oou4opx  i3iys sDrl(msnu) exoif tatlpt  n sl()texrir3no1amen ictatfartr(  ou1oleoii3iytfm2ul( ont)alxoxoctytlptrluvi;t0 exm(opno4aptnliesltfsDrr(rpoo1tetn i3ias s2rau s t0 rxrxrcty1oa  livi (  rxmir3ny4omtelncsasfsrrrur oo1aexomfetldlmDemn p;u0 rtoir3to1lptraneo s trur(m3oo4olen fci (f 2ra(r ;t4tee ioetydfa uauvs t0treoir3ootoa   n s;s) exoirpoydlme lfcs ()a2rrur nu0tpe iieiasls2el( pnu4tlerio totla raies (0texoxm iy4ll  mnet ( srtmump;t0alx  ociytls rlnmsnu) ltoxo totlpteaivsl(0 2xmxmpoy4oltn fvsat)srtmu  no4aexn ietadls2emu p;(4aeermfciatfmDrau ols) eumir iy4lmenlietas) 2tr(  ;o4aleo o3iytfs ua( s (0arxnmr3tytopDeln o;s) 2tr(o iu4opeemfvsa()s2tr(r oo4tlxn oeiydls2rlnmp;u)tlxnxo3iatfm r nvil()t2xoim nu4lle lieias arrr( o;o4aee  f3tldfs ea(mp (4 lenxociy1lp  aueslt trtoimpiudlpe mncia() Draxro;o0optnio3tyt a umn s u0 rtnircto1la elivo;(  eum(rpoy1llenmies ( aDurxm nu4olen feildlm el(vpnt4 rxoxrctytfmDeln s t0teur(o3nudom   net s aDua(mpot1aptoiictlt aDrluvs;()altnxociytomD  neols truoir oudol nmnetl(  rua(moou0tetoiietldlaDul(vo t4tlerirctytlmDranes () 2umio oydlmtelivil()s2ur(rpnu0ope moeiytfaDrm( s (4 reomf3iotoat lnvols0srxrxr3oo1amtelnvtlt  rrr(ronu4oee  f3iatls em(vs t4trenifciadlmDraieslt0 eto(r3no4omt mnetltf Drrxm ;o4open i3iysfaDra( s u4aetoxf3todfp   ieo s0sruoiopoodolee nctls a2uaum no0tltnmo3tldls2emuvs t) lerxo ia1fa  aneo;s0 eumxr3io1omee nctltfa2taum ot4tex  ieiytla ra(mo t4 lxrmo tydoa rlnvils0srtmxm3ny4ll   fctat  2tmu onu4tpto fcildls2emnvo;(4teeoio3ty1lm raueo;t0 eto(mpoy1ope  ict t)srrru  nu0oleo oetydfsDrlu o;(4aetrmfctotfmtelu i s srurxmpoydlp e nvtlsf Draumpnt1tlenmo3ildfsDra(mp u) ltrxo3tatom r uvi;( seurimpou1al  lics sfs2umx pno4aleniicils aDemn p;u) ltnio oy1lmDelu s ( srtmxmpoy4al   ics s)srua( pou1apen f3tat a2el(ms;t0 rxrxr3io1lmD anvol( srtoir nodal elfeslt)s2ua(r oo1apxomfcilsfmDemu o;(0tlenif3iydopt lnesls  2toiopoo4lp elies t  Dtm(ro;t1tpeoii3iltfaDeauvpnt) ltnxfcoydlp e neil(0s2xr(r oydll e iciat)artrxm nt4ope ioeiytfmDea(vs u0treomf iytlm  anes s0t2xrxm oo4al   iei t) 2taxmooo0tpxn i3iasfs2emums;t0tlxnxr3oo1opt lieo ()trumxm3nu1alee fciltf 2tax pno0olenifetyslsDrmnvo;t0 lerifcoodlm eaieils)teumiopoy4al n iei (f rrmx o;u1aexn i3iad a2emn ont)tlxrxf3oodfa e nvols0srxrxopou1al elfeta( aDtr(  nt1aeeomf3tlslm elump t0tltrxocta1fmDr i ol( truo(opiudlp  mfct t aDraxm ou0tetnmfeiydla ulu s t) rxoif tadfptraivo;s)trtoim ou1lmenmnvil(f 2tmuront1ape  ieild sDrau sn() exrxocto1lpt  i ils0 eumxm oy4altnlfetas) 2tr(r nt4tpxomf3iltlmDeanvs u0tlerif3tytfpte iesls s2ur(r iy1lmt mneiatfaDtax pou4aee  ieiydfmDuanmp u4trxoxr3oatlpteau i t) 2trxm nu1omeelfet sfaruaxr nu0tetoifeiad m el(ms t4 ltoio tytlaD lueo;s0setm(r iu4om nmfct tfsrumu  nt1oex iociatfmDemnvpn(0 rtrxo3iadlp e i ils)t2tr(o3iu4apt lnei s  2rax  oo4oltnmoetys m2rlnvonu)alxrmocta1fmt  nei ( truo(m oy4lltnlfei s)sDrmxmpnu0tptnif3iadls2ua( o (0aexrif3tytfmtrlueo;(0srxmxo no1ol emiciasf 2uaurooo0tlxnmictatfs rmu on(4areomo3ia1laDelneo (0 2xmiopoy4ll emicias  rua(r ;o0tleniieiltfs2umuvo (4teeomf3tadoaD aiei;t srxrio3oydlle lieiatf rtrumpno1tle mieiydfaDean s;u) rxriocoydla r i s t trum(r iydom   ies sfaDra(mpot0tptomo3tltfm2rmuvs;t)aexnmo oa1fm  auvs s srum(o3io1om  mietat)s2tmxmp;t4aptnmoeiys m uau p;u4 ltnxfcoodlmte u olt0srtr(m iy4lpeemfvslt a2rr(rono4tetomo3ildfs uau o t) reomrctatlateau s;t tetr(o io1lp e nvt tf Drau pot4tlt mfcildla2umuvp t)altoir3tytlatr n sl()teur(opoy1lleemnvs () 2rrum no4apt ii3ils aDuaumo (4 renxo ty1faD an ils)t2xoxr oo1lpeemfvi s) 2rm(m nt1aeeo f3ilt mDrluvp (0 eeniocty1faDrluvo;s)sruoxr3nu1op emict t a2ur(  ou4opxniictydfa ean p t)altnio iy1lp   uei;t)setrxo3nydolee ivi t aDtm(r oo0optn fciyd m2rl(vpnt) exnmocoy1omDe ieils)s2xoim3nodap e neiat s2uaumo;t4aeenmieiat a rmnmsn()texnmocto1lmt  uvs () 2toxr iy1am  mnesl(f 2umuroou0tltomfeiytlmDrmumo ()artoxfcty1fa elivilt)s2urio ou1llt  ivi sfaDtmxr ;o1alt  feiys a2emnmsnu)teeoxfctodlm rli il(0s2ur(m3oy1ap e ivtat) Durxmo;u4teenmociyt mDranvpn()tltrmr3oytopteanvs s tetrxmpio4lltnlnei s sDtr(mo;u0aex ioetysfaDumnvpnt0trenxr3iatfpt  nei ( sexoio ou1apt  nvsat sDra(mpnu4aleoif3iadlaDum( onu4arxoxf3iydomD lnvils tetmxr no4ope  ies sf 2raxm ot0opx iieiatlmDrau snt0aeenmr oydfpt li o;(0s2tm(rpiydll  livtlsfaDua(mont4tetoio3tatls2eanmo (0tleomr oadlaD  n s;s  ruo(o ou1ole mfvias srumxmpou4oexoifeildlaDulu sn(0artnirciotfaD  n s t srxrir iy1ape  icils)srumxmonu1tpxomfctydlmDelu s u)treoir3iytoa e nvi;()trtoiopiydlmenmneiat) Drru p;t1tet ifeiyd a2rm(ms;u)alerxoctydlpt aueslt s2ur(opio4alt lfctlt a2ta( o;u1olx  oeiysfsDuan o (0texoir iatfp eaieil(  2to(r oudap  lfcil(faDtrumpoo4tetnmiciyt a2emumonu4tltoir3tatfpDe neil(0 ruoxmpny1omen nvs t) rtm( oou4aptoifetytfm rl(vo;u4teeomr oytom elneol()teumxm3oydapen fvtlt)sDtrx pot4oeeoif3tad s2ua(vs;(0trerxf io1faD auvo t  2xmimpnodlp e nctas  2ua(mo;u1open feilsfmDrlu on(0tltnmfctydfa   ivolt0 2trir iydll elivslsf rtr(ront1alenioctldls2ea(vonu)trtnxoctydlatraivilt0s2trim3nudaltnlfcsas arrrxrp;u1ape moctadls2eln on(4aeenmr ty1fa r i ol(  2xoxo iu1altnlivt sfa2umum ;t1tpenmi3iadls el(mon(0 rtnmr io1fmD au il( srumim3ny4olte fvsa()sDrmxr no4ape  ietadlm2elumont) ltomo3iodomtrauesl( teum(mpou1lpt  net t aruau oou1tpx  ictys s2el( on(0aetrmo oytlpteanvils0t2trio3no1lltn ieils  2tau p;u1olxnmiciatfs2ulnvp (4 lxoif3tytlm e iei (0 rurim3iu4ol nlnvil() 2umx oot0tpx mieiadlm2elu p;(4artoif3oadopte uvs;() 2xmio oy4apeelnvsls  2urx ooo1oetnif3taslaDrm( snt) exoxr3iotomD au i;(0seur(r3iu4am  mfvt t  2urxmo;o1tet moetltlm emumonu4altoxf3iotfptraieo;()tetoxrpoy1lptemnes tfs2trxm no1opeoif3tltfsDrluvs;u4 lxnmr oo1fpDraies;t)srtm(o3oo4oltn ivsat aruax  ;o0texn fctatlmDuaump ()alxoxo ta1om e nvs s srum(o iodom nlfei t a2ta(mpot0oeeoii3iys aDem(vs;() exoxf oatlp eaneo;s) 2xr(m3oy1altemfciatfs2ra(rpnt0opxoioetat a rl(vpn(0 rtomrcia1lmDelnes;( trtoxrpnodal n fvil( arta(  ;u4oeeomieilt mDulnvsnu4arxoxrcoytoa  auesls seurxo3nydlpt  ietl(f Duaxro;o1opeo ietltfm2umuvon()tlxrxrcty1la  luvs;t0s2umio iy4am   nvsls)a2trumoou1altomoeiys m uauvsnu0teerxo3iotfpt  ueo;s)setoxr3nu1lpe mics sf rta(  no4aeenmfcils s ulums u)trxnxf3iydlatr uvslt0trumio nudlmt  nei sf 2rr(moou0aexnmieiysfsDumu s t0 rxomfctytoptrlnes (0tetrxo3iudlpe lfvilt)sDrmxro;u1opx  o3tatfmDra(vo u4tlxomocoydfpDrai ilt sexmxo3iudllen fes sfsrumurpno4tpxn f3iytfm um( o;t) exnmo tadfpte n i s0t2xrir3no4om nmietl()srrr(rpno1tleomoeiydfaDrm(msnt0aexnmf3iatfmD lieilt)t2tm(opiu1lm e ncsl()s2um(rp;u0apxnifciydfa2rluvs;u)alxnif io1fat  ivo t)trxrir nydoltn ici sf Dtaxmpnt4texnifctatfm2uln s t4arenmf3iotfp   ivil()srurim oo1ap nlfeias s2tm(mpot0texo f3iys aDrlu onu0alxrmo to1fmD  n i t)s2umio oodomtemnvsa(faDrr(r oo4apxnii3tytfsDrmn o u0alxrircootfpte neo s srtrir3ou4apt lfvsls s2urxmoou0aleniociytlmDelnmonu) exnio ty1optrlues (  rxrxmpno4amt  ivs s s2rrumont0aexnmo3iltlm rl(vsn(4alenir tatopDrli sls  etoxm3iu1alt  ncia() 2tr( onu4olt ifeiltls rauvo;t)tetoxf oy1oa  aueils0 2trio no1lp  liet s)s2rrxront1oeeniieiadfaDrmn o u4 lxomf3iydfate uvs;()seuo(o3ou1ll nmnvsa(f 2urxr ;u0aleoif3iasfm rlu s (4 renmo oo1fmDelnvi (0 exmim io4al n icia( artrumono4tlto i3iyt aDulums;u)artnmr oydfatelneilt0trtrxo3iu4ap nmieia(fs2um(rpno4apenmoctldfm2rl(mo () lxrio io1oatraivs;t0 euoir3iydomte fei t s2ur(  ;u0aleo ieiydfmDelnmp;()arxoxo3oydomDelnesl( t2trxm3io1opte feiltfarraumoot0tex iieiltfm umu s;u4aeenmfciadomDranvsls0t2umimpoy4am emnvsls)arur(rp;o4opx  ieildfa2rmnms (4aexoxfcty1fm   ivs;t0seurirpoodlmtelnet ( a2uaxrpou0opeoioetltfa rlnms ()aetoxf3to1fmte uvo t)s2xmim3io1ll nlfei tfs2rau  oo1teeomocias a2rmnvs;t) exrif ootfa e uvs s  rxmxm3oydlp   fcils)aruaurpnu4oeenmoctld aDrl( s u4teerif3oadlat anei;t t2toir3oydal   ivt s)a2rmu p;o1apxnifcilt s eanvo (0tlermr oytlmt anei;t) 2xoxm iu1ame lieiatfartmu pou1tptnmfctasls2rmuvo (0 rxrmo totlm raivslt)trum(mpiu1ll   fcsl() Drauront1oexomfciytfa rlnms;t0 rxrio3iotopDe nvils t2uriopoudamt mfcsl()s2rax pnu4alto o3iytfs ua( o u4teerxocoodlpDeai slt)seumxr3no4lmtnmivsltf ruax  oo0opxn o3tld sDul(vp u4treomf3tatfm e ivs;t)s2trxopoy4omte fctls a2ra(m ;o1oexoii3tyd a2rm(ms;u)alermo iodomtraueo s0 exoimpiydol  lictas aDtm(rp;o4tlt  ocilslm ea( snt0aeeomocoadla eanvsl()srur(o nydlltemncsl()s2urxm ;t1tex  ictytfs2uanmo;() exoir ootlp r ivol() 2xriopiodam   ict t) ruax o;o0tpxomfctydfa2ul(mp (4 eeoxocoodlaD ln il() 2umxm iodop  liei t s2tmxront0ape mo3iyslm2elnmp t)aexnmo3iotlptrauvols  2xrir oo1olenlfcslsfs2ur(mont1tee ifciytlsDuanmo ()trtnmo3oadfmtrai sls)trxoio oodop e nvsl( arrax  nu0oexo o3ild s uanmonu)aetrio tytla  li o;( s2xo(m oy4omtelieiat srrmxm oo1oetomfctyslmDemn o;(4aetoircio1opD an i s  euoxrpno4op nlfci t srumurooo4teen fctlt mDra( snu4 rtnir oydlp   u s;s) rtmiopoudlmt mfeia( s2urxrono0tleo feildlm ea( onu0areomo3ty1lmtr neo s  eurxm iu1aptemnesls)aDurxronu1tetnifeiasfm em(mp;t4 eenmr io1opteluei t0srum(mpnu1lmtnmfes (faruaumpot0tpeo ietld m emu sn(4aetnmo tatlaDe ivsl(0t2xmimpoo4omtnmfesls  Draxr ;o1tlx mociydfs el( pnt0tltnifctodlmtr uvs;( s2uo(opiy1olte ncta(  Drr(r ot0teenioctltlmDeau o u0artrio ta1fpD anvo;t0s2ur(m nodam elnvs ()sDua( ooo4tptomoetat aDrmuvo t0 etoircoydomte nvol(0s2urxm3ou1lmee neslt a2tr(mpno4oleo ictydlm ea(vs u4 eenxociadlp raueo (0setrxm oodomtnmnvs ( a2tru pot4tltnmfciytfa2ulu snt) exoxo iodom elivs t  2umxm3nu1altnmfesltfa2rmx o;t0tltnii3iydlaDrmn p (4tetomr iatlm   nvo;(0 rumimpnudol elivt ()artaxmono1aptoioeiltlaDeanms (4tleoxrcoatfatr ieo (0 2xrirpiydapt mneils)aDtmxmo;o1tet mfciysfs umu ont) rtniocoatop r n i s  rum(m oo1lmtn nvtlsfa2umxr nt4tee mfetas sDel(vp;u4 etrmrcoytfaDr i ol()sexr(r iy1ameemnci sf Dumxmp;t0oltn iciltla2rl(vonu0artomf3totomtrlies s)setoxrpnydam n ivtl( a2ta( p;t4tle iicils sDrlnvp;u)arxrxo iy1op   ivs ()trtmim nydap nmfcsa( srua(rpnt1oeeo oeiydfm umnvont4texomo3iadlmDrauvs;s0 rto(r oudom nmivt sf Dtrumpot1oeeniicilsls2rm(mpn(4artnircoo1la ranvs (  2tr(o3iy1lm nmfvtltfartmx ono0alxoiicilt m2ua( on(0aeerio3iotoaDrlnes s trtm(opio4altnmfvtlt  Drmurp;u0optoio3iadlmDua(vo u)arenir3todlmteaivils0 etrir3io1omtelieiatfarrm(r ;o1aet mo3iytls2ea(vo t4aetomo oa1faDrlueil(  eumxr3no4aleemncslsfarur(moou0opxnmieias m umuvp;(4tleoxo3tydfa e ivo ( texoim ou4ol   net ( srurum ou1oee ioetat aDea(vs;(0trtrirciatlmDrai i s t2tmxr iudlmt  ncsasfs2taxm oo1ale  ietatlmDrlumo u0altriocoytlptrli olt0srxmio3io1lleelncilt sDrm(rpnt0oeenifeiat m uaumsn(0arxnmf3iadoatranvs;t0trumim3iu1lltemivtltfsDtr(m ;u1openmi3tldfmDranms;u) exoxo todlmt luvsl(0 etrxopiy4omtnmiet t srrrxm nt1tex mfctld m ea( s;u)teenmf oodlmDrau sl()s2xrim oo1ll  mncia(faDraxmono4tet  oeildfmDrln o;(4arxnir3todlmDeluvi;t texo(o3iodlpt  ncs tfarrmu o;o1tetniociadls2umuvs;t)trtoxf iy1la   n s;s)trxoxmpno4am emici t  Dur(m ou4openmiciydls rl(mp;() exrmf oy1oaD lnvi () 2toxr iodlp e fvsasf rumur nu1apxoiieils s2uau o;(4teeriocoodfmDeaivs;t0s2triopiydal nmivs s s2rr(rp;t4aex iietyt s ranvp;u0arxomrciatfm r i s ( trxmxr oydaptn ieils a2tm(  ot0olxo i3ilsfm rluvp;()alxnmr oy1lmt luvs;s0setrxmpiu4optnmies tfa2ua(ro;u4oee  i3iatlm2ulnvs;u) etnxfcoatlpD auesls0 rur(rpnu4oltn fcsatfsDtmxrpoo1oexniictlt a2el(mpnt4 rxrir3io1la e u ol()srtoir3oudlptn fvsls)s2ua(rooo4tetoiietyt m2uanvo u4 eeomf iotop   nvsl()texoxrpiu4ol elnvsas)sDrr(rp;u0tlx iiciadfs2rmnms;() etoircto1fpDe u i;s)sexm(opou4altnmneiat arum(r no0oetn o3tyslsDumu onu0 lxrxf oatom rlueolt)t2xrxm nudlle lfvia(f 2taurp;u0tet  i3ildlaDrl( o;(0teenif3tytlatr ueo;s0t2xrir3ou4lm n fvi t aruaurpnu4ole micilsls uau s;(4 lxnmfctotfmt livs;t)srumxrpoo4ap  lietls)sDrm( oot0tpen o3ias a ea(mpnu4 eermrciodfaDe nes s  rtmirpnudop nmfeil() Drr(mont4aleo ieiad s2em(mpnu)tltrio tatlp e i i;s t2uoim ny4lm   fes sfsrua(mo;u4olxnmociytfs em(vo t)tlenxrcoytop rlues s truo(r3iu1alen nct ()s2uaxront4tle mi3tysfs rln o;(0aeerxo ootfaDraivolt)trur(r3oydlm   fcs t)aDtmum ot4altomi3iltfa2eanvs () exniociodfp   u sl(  rxmio3ou1lmtemictlt) Dtmx pnu0oetn ociydlsDuau o;t0 rtnxo3oy1fmD  u sl( tetrxo3oydam elicsat) rur(ro;o4teeniieiltlmDeln onu4texrxo3iadom eaivo () 2xmxmpiy1lltn fetas sDrruro;o4ape mociysls2um( s;(0trtrxfcoytoatr i s (0texmiopou4lmtemnvt s) 2taxm ot4apeomfeiasfsDuauvo u0 rxrmf oatoa rlneo (  rtmirpnu4lp e ivsltf 2tm(ro;t4alt iociasla em(vsnt0 ltrmrcoo1fpt  u s;s0 etm(r3iodlpe lfvs (fa2trxrpoo0opxn o3tlt m2rm(mp u4tlxoir iatlpt an o;t0 rumio oo4amenlivslsfsDrmurp;t4tpxn feiatlsDrm(vpnu4 lxrir todfpteauvs t)texoxm3iydlltelnetls aDuaump;t1alxo ociltla2um(ms t0arxnxo tadlmDeaieil(  rtmirpoodop   nvt sf 2uau  ou0tltnifetld a umnmsnt4texoxr3tydfatrlnvol(  eurxo3ou4apeemnvs t a2taxr ot4olxo feias m2ra( pn(4 rtrxr3tadopte nvi;(0s2uoxm3iodomtelnetl(f Dtax o;t4aexnii3iatfs2ra( pnt4 etoxr ootlmte uei;t teuoimpiu4lpt lfci sfarrmxm no0tpx ifcilt m2rmnmo u4trxrmo3tatlm  luvi t)setmir3oydomt  ies (  rta(rp;u4alxnmf3ilsfsDeanmp u4tltnxocoodop elieo (  2uriopoy1alte ieslsfa2rr( onu1altn ieild a raums u4 renxr3tadoa e n o;s0teuoio3no1ll nmfetl( s2taurono1tlt  octltfaDulnmpnt0 ltrmr iodopte iei;s  rurxo3oo1llt lfcs ()s2umumpot4opxomiciasla2rlnvs;t4 ltoxo3totlm eai o s0 exmxm oydll e ict t) 2rmxm no1tex mi3tltlm el(mo u)trxrxr iodfaDelivs;t t2xm(m iu4ll  mfei s srrmuro;t0apen feiydfs2ulums;u4 rtrio3oy1op  lu o;t0 ruoxo iu4ope mnes (f Draxmpoo1tee mf3iadfs ua( on()aexrmrcoatfpteln slt) 2xr(rpnodlptnmfeiasf Dtru  no0apxnmfciys s em(vp (4tlxnmocootomDraivs;s0s2uo(o3iydlmen nvtl(f 2ra(r no0aex ioeiad a2umnvo t4texoxrcto1fp rauvsls srum(mpnodope mnvils  2uaxronu1tlt if3iyslsDemnms;t) lermrcoy1fmt aueo t0texoirpiydopte fes tfsrraxroot0oltniociydfs2emn snu4treoif oadoa e nvsl(  rxoxm3nydom  lncs ( arurxroou1tpenmociasla2eau pn()treoiocoadfm r u sls0sruoimpoo4amenmncsa() ruaumo;t4apx iociasls2rl( ont0trerxocoadomDrlieo ()seumimpnu4amtn ics ()s2um(  ot1tlxo i3iys mDuluvonu4 ltrmo3ia1oa eaueo;()teto(mpou1alt lfvi ( aDtrx pou0olt ifeiydfm2ulu on(0 rxrxo oy1fp  lnvi t0teumxm io1omt  iesa(  rurx  ;u0aet ioeildlm2umu pnu4treomrcia1fpDraies;( sexm(o3iu1ope mnvi t)sDtr(  ot0tetomietysfmDua(mont0tlxnio iodomDe nvs s0 2to(rpoo4omt lnvta() 2tru pnt1tpxnmietasfs emn p u)teeoxf3oytlmDr i sls)tetrxopoy4amenlncslt)s2uau oot0optoif3iytfmDra(msnu4tlxomo3oodla e iei;()trumiopno4lpeelfvsltf rta( o;u1tpe  fctatls ean pnu0tlermfcio1om rlu o ( t2toim3iydaltelfeslsfs2ur(ro;t1teen feiysfsDuanvon()aeenmo3ia1la eln o;s sexr(opoo4am emnviat  2ua(ro;u0opt  oetysls2ran snu)aeeomr3tadlaDeauvo t)tetm(opou4lpt  ivslsfsDtr( oot1apenmietyd m eanmsnt0arxrxocoy1opDr uvs (  etmio ou4om  lnes sf 2trxroot0olxnii3iydls emump;(0 lenxfcta1fmDr n o;t0trur(mpny4apte nvsat s2taur no0aetn oeiydfa ea( o;(4tlerifcoa1lpD lu i;() euoxm oydomtemnetlt a2uaxm ot0altn f3tltla elnvo u)trxnxr3tytopD lieol(0 rxo(m no4lmt mfeilt  rua(mpnt4opeoioctltfa ran p t0 rermo oodfmte iesls  rxo(o3oy1amtnmietltf Dumxmooo1oetoif3iat s uan on() etnxoctatoat aueols)sexo(mpiudame micils  Drmumo;o1oleomietytla eaums (4 eeoxf iytfm   n i ()trtoio oudomtemivsa() Drm(m ou0aptniociadfa2rm( o;t)altrmoctodoptraiei;()sexmirpiu4ol elicias aDrrx pou0olxn i3iysfa rauvs;(4alermf3ootlp elnes;t)texmim3iudap  mnet ( aDrmu p;o4apeo feiad mDuanms t4treoifciytfmDrln sl( trtrimpnodam   nviltfs2umxmpno1tle mfciys s emnvpnt4aetrxo oadlmte ivs s)s2toxmpnydom n ncsl()sDrm(mpot4tlxoiicilt a rluvp u)arermf iy1oa   neo;s  ruoimpoo1ame  fviltfs2ur(mpoo4texnmieiys mDuanvp (0aleomf3iydfm  luei s0 2xo(r oy1lme lncsl(fs2tru pno4oleoiietltfaDua(vsnu0 lerio3totfmD aueil()sexoxopiodllteliet (fsrrru pno0oexn octlsla rauvpn()alxoiocto1late n i t0seuoxr iodaptemfctasf rtmx  nu1apxo ieiatlm2em(vp;u0 lxnirciydop e n ils0seum(opnu1ome lnvs s sruaurpou1alxomo3tldlm2elnvsn(4aexnmr io1opteluvsls s2xo(m3oo4lpeelfvils)sDraum oo4aetnifeiys s emumo;t0aeenmf3totlmDe ueo t  2xoxopnydaptnmieia( sDua(moot4tpxoiocild s2ea( s u4 lerxr ta1lmteauvo;( truoxr iy1ap eliviat)s2uaxm ;t4tle ioctydlm rl(vsnu)teenio iadom elnvol(  2xmiopiydoleelnes ()arurxr nu4openmf3iaslm2elnmont4 etrxo iodlpDeaies;t)t2xrio iu4lp nlfesl()sDtmur ;t0apx ifciydfm rln onu4 rxomfctydla elieo t0srto(mpoy1optn ncs t)s2umxr oo1texo o3iadla2rm(vo u) etrmrcio1lateau s t  etoirpio4lltnmici t  rtrx pnt0texn i3iad aDrmnmsnu4trtrir iodfmDr ues s s2ur(o3oy1om e nci (  2rm(rpou0tltn oeilsfaDul(mont)aleoxr3iodopDelues;(0 2toxm3oodlpee nesasfsrur(rpot1tlxomocildfs2elu s u0aeermo3iotlaD ln s;t0 euoxm3ny1ll e netat arumxr ;o1apx moetytfsDemu p;u4artrmr oydom ranes;t trto(r3oodomtnlnctltfsrrm(m ;o0tle mf3ilsla2emu p u)tltnxr3ty1lpDeluesls  rtrxo oydome  fesat)s2ta(  nt1ope ioeiys mDrl( p;t) lerxocoatoaD lueo;( texoirpoy1aptelics tfs2umx p;o4tpxomfcild s2rlu p;u) eenir iodlaD au i;()trtmim3oo4lptn iesl( srtau  ;o1opx  f3ildfmDel( onu0 etnxr3iytlpDrlies;s0s2trxrpny4ap emnes t)a2rrxr ;t0tex  f3tad s2rmu s;t0 ltrmf3iadop rli i;(0 2xr(rpou4ape lneia(f Dtaxrono0oleoii3iadfs2elnvo;u4 rxnmo tydfate uvo;t0teuoxm3nudaptnlivta(  Dua( ooo1teeoiieiltlm rln s;t)aeeoxfctotom ranvo;t0 rtmxm iu4ol e nes () rururoot1olx moeiadlm eau pn(4tlxrifciydom r iesl(0texoim3oy4ol nlies sfsrur(rpnt4ope ii3tadfa rl(vsnt)altrmfctytlmteln s;(0t2urir3ou4lptelneia() 2urxr ;t1aeenif3iltls emuvo;u4texnxfctadlaDeauvolt)trxoim3ou4lp  mieil(fsDrrxmooo0texnifcildla2emnmp;u0trxnxo iotop   uvs s0srxm(mpny1apt  nvi s aDur(moot0oetn ictadfmDelnms;u4 lxoxf tadfpDe i sls teumxm3nu4lmee nvtat  rrau  ;u4opt ifetadla emums;t0 ltnif iytfpDe n i t)s2umim3nudalte fvia() 2truront0apxn i3ias sDum( o u)aexnmo to1laDe ieslt  rtrim3oydale mivsl() Draurono0oeto feiysfa2ra(mo t4trtoif to1fmte i slt)s2xmirpoudol emicilsfsrrm(r ;o0ope ifeilt mDelu pnt)tltoxocoadfa rln o;t teur(rpnydlm nlicils sDtr( p;o0apto ociyd aDemu p;(0teenifcoatfmtelneilt truo(opoy4ll e feil( srrru  ou4opeoio3tldlsDel(vont)teenmo3tydoa rauvo s0setrimpny4ap n nesas  rtmx ono4oexo i3tas s2rau p u) leoxf3oodfp raueils)teumxm3iudal nlfcia(fsDtmxm ;o1oeto fetat m ulnmp t4arermr ty1laDraneolt)srxrimpio4opt  fci sfaDtaumpoo4ale ifeilsla um(vs;u) lenif oytomDrlnvo t  2umim nu1amenlici s)srtrurooo4aeto oeiasfs2rl(mp;t) etnmr ootfm elnvs (0 exoxr iu4ap  lfvilsf Dumx ont1olt mf3ildfs2eauvp (0trtomf3to1lpD ai i t)seuo(o3nudap e feslt a2taur ;o1tex  ociasla2em(vs u)arxoxr3iadfa r ivol() ruoim3io1ale lnct s) Dtaxrp;o0aet mfciadfsDulnmpn(4tlxoio ia1lp r i o s  2umxo oo4lpt  icia(f Duax poo0apxoifeiytlaDemuvonu4texrxoctytfp   i o t0t2trim nodom   nvsa( sDumxr ;u4tpxomietls aDranmsnt0 rxomr3iytfatr uvi ()s2toxo3iydlle mietat)sDrmxm nu1oetnmoeildlmDrmu o u0artoir3oytlmtrln o;(0s2xmxr oudlleemnct (fs2tm(mono4olxnmieilsfmDua( o;u4 rxomrciotfm e n o s) etmxrpno1om   neil(  Dua(m ;u1oeeomociydls2rl(vp;u0aleriocoo1oa eaueslt)trum(opoydole  fcias  Dum(  ot4aetnmiciydlaDuanms u)altnircoadfm  aivil(0seuo(mpou1lp  mietatf Dum(mpno4tleomi3iatlaDeanms () rxnxrcia1lat ai ils trtmim3oy4om  lnvs s srum(m ou0ope iieilslaDulu pn()aleoif iydopteanvs t0srumxr3nu1ll  lnct s srurx poo0tpx mi3ilsla raumon()trxnmf oatop   i s;t0tetrxmpoo4lpee fvsl()a2ta(mont1texoifctadfm ulnvs t)aeermocio1fmDran ilt0s2xo(o no1ll   nctat) rtaumpou4oltn ietydfsDraumo;t4 exomr3oa1lmtrlivo;s) rurxmpny1apenlivs s sDtmu  no1aptomietysfaDul(mo;t4 exomr3iydopDran o;s) rtoir nu4ole  fvils) rtm(mont0aexnmocils a ul(vo t4aexrifcoodlpDr uvs;(0srum(r3oodlpe  fcs ()a2raxm no4ope iieiytlaDrmu on() exnif ootfmtr nesl()srur(m iy1amtemfesls) Draumooo1apt iietyd mDrln o t)trxnifcoytlmt lnei;t0tetm(r3oudalt  feilsfsrrrxm oo1oetniocils aDran onu4trtoxr3ta1lat au s;s0sexrxmpou4lm nmfeta(  Dtm(rpnu0ole  icilsfs2rlnvsnu4tlerir oa1fmDeanvs;s0srxrir3ny1alenlfcs s sDtmx  oo4opx  i3iad sDrau p;t0teeoif3oadomt lu s (0sexoxr nu1lm eliei s  2tmxro;u0aptn ociydls2ra(vp t)trxrxr ootoaDeli ilt0trxrxo iu1lptn ncsl()srtrx p;u4tetnioeias sDean o;u) renif3ta1fmt anvi t)srumimpno4oltnmivi ( aDrm(  ;u1ole  oeiadfmDemnvo t4aexnxo oy1lpDrlneol() 2trirpoudoltemiesa() rrmum no0alxoioetat s el( s u) rtoifcoadopDe uvilt0t2xr(rpio1oltnmiei (  Dtm( pou0apxoif3ilslm2uau snu4altnxo iadomDelieo;(0 rtrio3nydalenmnvia(fsrua(rp;u1tpto ociytls ean p u0alenio3to1lat anvs s  rtoxr3nu4aleemnvslt a2umurp;o1tpx mi3tyd mDrmumo (4aetrxo ta1fm e uvs s srtm(rpny4optnmneilsf 2rrxmoot0altoiieils m2rm(ms (4texoxf io1lpD au sls)srtrim nydlmte ieiltfaDtrum ;t1alto ieildfsDulump;t4 rtrxrciydfp rai i t0srxmio3oy4op   ieil(  rurumooo1tetniietas aDelu o;()arxoxociatoaDrln olt0t2xm(r nu1ll emncsas) 2rau pot0ole  fciyd a2elu o;()aetnxrcto1opDe nvs t0trxr(r iu4lle mietl( arua(moot4opxomiciasls2eau o;t0alxnircty1fmDeli olt srtrir3oy1lltnlfvtas)aDrm(ront1apxnmoeias m2eluvp u0tltoifcoa1lpD  ieo;()t2xoio3ou4apt mnvtas)sDuax  no4apt moeiytlm rluvo;t0aexoiocoatom r ieo;t)t2ur(opnydol emieiatfsDra(mpno1oleomfeiytfs eanmsn(4 etnirctytfaDe uvslt)s2trim no4am n ictas) rurur nt0oexoifctytfmDulnms t4 ltnxf io1faDrli olt t2trxrpoo1ll n ivsl( a2uru  ;u1oeenmi3iytfm uan ont4tltrircoo1lmt luvols) rxmxr3oy4opt lfviasfa2rm(rpnt0tleomieiatfaDrlnvp u0arxoio3totla eaivsls)trumxm oy4ll e fei tf rtrx o;t4opx iicias s2emuvp t4aetnif iydla  anvils)tetmxm3io1ll nlncsl(fa2rr(m ou4tlxnmo3ias m2rlumo;t4 ltomo iy1lpDeanei;s0 2ur(opou1aleemivt s) 2ur(rpot0aetomfcilsfa2ean s t0tltoxr oytlpt lu o;t) rxrim3iy4lm e fvslsfa2taur ou4apto i3tydfsDra(mo;t4aleoir3oa1fm elivo;(  rurio3oodaltnmnvsls)sDra(m nu1oetn ociytls rln s u0tleoir3ty1omDrauvols setrxr oo4opt  fci ()srurx  oo1apt mf3iys a2ra( ont)texrif ta1lp e nes t0s2to(opiodom nmfeilt aDuaxrpno4oeeomoctyd m ea(mo t4altnmocoatomDeaivi;() 2urim3oo1apeelnesl(f rrrxrpno1tptniietatfaDel(vsnt)tlenxr iatfmtr uei s srtrim3iodamtelfeils srtrxro;u1apenii3tydfa2emu o (0tetrir tatlm  au s t)texr(m3iodlpen icil( a2urx o;o0openiocildfmDrl(vo;u) rxrxf iydlmtrli i t)t2xm(r3iu1ap n feilsfarumx p;o1aex iiciyt sDrau pnu4tltnifciotfptrlueo;t  2tmxr oo1amte fcils)sDrmx poo0tlx  ieiydlm2emumonu4aetoif oydopte n s t0 ruo(o iydomee ivt sfartau ont1aetnmfeiys mDrln p;t4 rtnxrcio1omtr nvo s trtmiopnu1am nmictasfarrmumpot4apxo fcilsla emu p;t)tltnir3io1oa e u i;( s2trio io1lp  livta() 2uau oot1tpxomfciatlsDra(mo (0tlxrmo3ta1omte nvol(0 2xm(m3nudalt  ici (f rrrumo;t4alt  oetad sDemnvont4 lxoxo tatfpt luvslt)trtrim3ou4ol nmnvs () Dtrx ono1tlx iiciadlm eluvs () eerxf iotoateli ol()texo(mpno4lp e ieiat aDrmx onu4opxo i3iatfa ea(vsnu4aleoxo3todop   ivi;s  2xmio iy1apte fesat s2umxrpnu0tetomoeild m ra( pnu4tlxrio iytomtrauvi;()teur(rpoudoptemfvi t s2urumono0tpe ifctadla rmump t0texoxf iatopDeau i t0 eurxr3oydlle mivt ( sDumu oot0oexo fcilt s2uaump;u)aexnmo tytlmtelivsl()srxmim3iydameemies ()s2ua(ronu1tet  ociytfs2rmnvp u)alenif iydlmtelnvs (0 exmim3oy1olen netat  rraumooo4ape iicild sDeanmsnu4aexrifcoydom   n s t) exm(o oo4ape lneils) Dua(moot4alxomfeiat m2eauvonu4aetnmr3tydlmDeln i;()trtmir nu1apt miet (fsDuaurpou1tpeoifctldfm emnvpnu4 ltomr oy1fmte ieo;t0teuo(opoodlmenlfes t  Dra(  no0tptomf3tytfm em(vp (4 exomf3to1omDrauesls)srxriopiodopee icsa(fsrrm( ooo4aeeo fciys m ea( s t0arxrxfcoatop e ueils0t2umio3iydap nmnesas) rta( onu1aetn o3iys aDrm(vo;u0alxrmo iatfp rliei;()t2xoxrpoo4lmeemivia(fsrtrxrpou4tex if3iatlmDrln p;(4altomociodfm   nvo t) 2triopnu4lm  mictas)a2umu  nt4apxo i3ildls2rl( pn(0trtomr3to1fm ran ols) etoim oy1ll  mieil( aDta(rpnt0aexnmoeiydlaDua(mo;u0trtrmrciodomte nei;t s2toxmpiu1al nlneiatf rtmuro;o1aee  oetaslsDua(vsnu4artomfciadfpDelneo s0srxmxr io1omt  ici s a2umumono1aexn ictlt m em(msnt0trxrxo oatfateau i;s0s2xr(mpnu4am nmieilt)sDuaxrp;o4alxomoeiadfa rlu ont0 exrio oo1lmte n s s) rxoxr3iu4ll elfvtl()aDrm(ro;u1oet moetadlsDrmn pnt0 exoir oodfa eaivo t) eur(opiydopee ivtat)aDrau poo1oetnmfeilt a2um(vsnt0texnifciodopt li o s0truoxopoydopt lictasf rtaxrp;o0olt  f3tlt aDuaumpnt0 ltoxo3oy1om  livs;s)seur(r oudlltnlnctltfaDraxrpot1aex mo3ils a rl(vp;t)tlenif3oydla e uvils sexoxo3nodal e fvtlsfaDrrurpno4oleoifetld sDum(vp u0aleomf to1fp   i slt  rtmxr3ny1lp elnei (  rur( ooo4oleo icildls elumpnu)tltrmr3oodoatrlu o t  rumim3nu4optemnvia()sDrm(m oo0tlt  o3iatla2ea(mpnu)arenio3oydlate n i;s s2toxm3nu1amt lnesltfaDrmuront1optnmo3ilt mDrm(vp ()altoxoctodlatrluvo;(0s2toir3oo4lmtemietas sDraxmono4apt moetydfmDra( snt)tlenmociodoatraueol( srtriopiydomtelivslt  2umum ot1olxnifeiasla2umnvp;t4aexnxfcoadfatelu i t)srxoirpoydomte nvia(  2tm(mo;u1aetomieild mDea( s () reoifcoydlm e iesls texrxopoy1ame  fei t  2rmxmpot4apxnmieiad m rl( s;u)alermf io1fmte nei t)texm(rpoy1lm elncsatfsDra( o;o4alenioetaslm elums u) ltoif3iytlatelieo t t2xo(r ny1ap   fcs sfsrraxr nu4opxn fetas aDuau p t4tlenmocoo1laD li olt0 2to(opny1lp emfcias  rtmxro;u4tpeo feildla ul( on(0texrir3oadlpte ivslt srxriopoodap  mfesa(fsrrax onu4tpt iociad s eaums u0alxomociatlpt  nei s setr(rpiudlm emnciatfs2rru ooo1open octadlm2em(vs u0treoifciydopD lneo s)t2tmirpoy1opte fcsls) Drau ooo0open feiyt s uln p;u)tltrmr iadomDr uei;( trxmio3ou1open fvt t arrmx pnt4aexomi3tldfmDrlump;u)aexnmf3oa1lpDrai o;s)trxoxo3ny1ole mnet s)a2tmuront0alx  fctys m2uanms t0trtnir3io1la eaivi t) 2toxopiy4lltn nvtl(  rumum nu0tpe  iciydfaDeau pnu4 exrif ty1opDeli o;s0texmxm3iydlmtemicsas  2trx pno0ole ifetat mDrmn o;u0 rxnio3ty1oat livil( s2xmirpny1lpenmnvi s  2ur(mo;t4tee mi3ils s2ul(mon() rxnmfcoadfm   nvilt)t2um(m3oydlpt  ncia(  2rmx pnu4opxo i3iys a el(mp;t4 etrxr tatlaDranes;s0 2uriopiy4llte fetls)sDrmx ooo0apxn ieild aDrl( sn(4trxomf ia1fat anes ()srxrir3oydlptn ictls aDrru  nt4tptomfetyd mDum(vo;t0 etrir iytlp eanvolt) 2xoio3nu4ll n ict ()srrm(moot1olt iieiys mDuau onu)treoxrciy1late ieslt0seurim iy1olenmfci s s2tax o;o4tlxn i3iys sDraumont4 rtoio oytfat livi;s t2xrio iydlltnmnesl( srtrxmo;u4ole ioctltla emnmpnt0artnxr3ia1omDe u ils s2toxm3io4ol nlfet (  2rr(rpot0altoioeilt sDrlnmo (4 lxnxfctotomtrli olt0truoio3ou4alt  ivsat s2ua( pno0olxo octydfmDumu p u)aetrmo3oy1fp e ivi s srxm(opno4op  mietas  2rrxm ;u4tlenio3iatla eanmsnt0aetniociytlptelnei (0s2ur(opou1omte fvta()sDur(m nu1olt ii3iatls rmumon(4tltnmf ootlp raueo (  2uoxr iu1om nmfes t s2ua(mpnt1alxoio3tyt a2eau snt)aleoir iydopt aueils)texmxrpiy4aptnmfvsas aDua(m nu1ape mieils aDulnvs t0tlenxo3oydoa  aieilt)srxo(rpnodlp nmivil()s2raurp;t0oetn f3ils m2umnvo;t)tetrir3oy1lm   n ilt  2ur(r iu4altnmies ( srrmump;u4aee mociysfsDumu s u0tetomf3iytlpDr ieol() eto(o oo4amtn ncsas)sDrmum ;u4ale  f3ils sDul(mo;t4treoif3ta1opD lues;(  eumxm nudlltn nvt s aDuaxrpoo4aleo fctys s2ea(vo u)alxomfcty1fa  auvil( teto(o3io4ll nlnviat) Durxmo;t4olx ifeiltfm ranvp;u0texnxr3oadomt luvs;t)srumxm oo4alee fet s) Drru pot1tlt iicils s eauvs u0 rxrmo to1fptr ieo;( t2xoiopou4opee ietlt  Duaxmoou4tltnif3iltla ua(vs u4tlxoxf3tydopD au s s sexo(o3nydopte fcsa( s2rru o;u4olt  ietas s2uluvp;u0 lxoifcoydlptrlieo t setoiopnodomt mnes s artmxr ot1optn oeiasfa2umumpnu0aeerxf tytlmtr ivo;(0trxm(rpnu1amee ictas  Dtrxrpou1tlen oetat m2eln p;t4teenmf ia1fa  aueo;s0teumir oy1ap nlici s  rrm(ro;t0tpe  ieiltfa2emnmp t4trtrxfciydoptrli i t0tetoxr oydll n nvtat)a2tr(  no1olxomoeildlaDum(von(0 eermr3ta1lm eauvo;t)s2urxmpny1ap nlnvt s  rraxmp;o0oetoifeiyt a umu pnt) rtnxocootlaDe uvo;t0 rtrio iodlm  mivtas artr( p;t1tlt ioeiysfaDemn snu4altnir to1fm eau ol()teto(mpnydoptnmneta() 2ra( ooo0ape  oeilsls2um(mp;(4alxnirciotlpDeaieilt0 rum(rpiy1om nmnvtlt  rururpno4olxnif3ildlm umnmp;u0aetoio todlm eaueo () rxr(o oudalen nes tf rumur ou4optoiieiysfa ea(mo u4arenio ty1lmt lnvo;s)trur(r3oudlpeelfesat  2tmx  no1tpx mfetydfa ran pnt) exnxfctydoaDrauvs;s)t2xo(m ou4llt  ivtlsfarumxm ;o1aex  ocilsfa2elumont0aexnxo tatlpteli slt0 ruoimpno4op  mfet (f 2tru p;o1texnioeias s2rm(vs;(0alxnxr ootoatr uvi;s  rum(m3iu4ap  mnei ( s2ta(m no1altomoetldlsDuan o;u)aetnif tatoa e ues s tetr(m ny4op   ietasf Dtmx  ;u1tlxnmoetas s2rmuvs;()tlenmo3iodlptrlu s;s  eurxm3io4ol eliesl(f Drm( pno4tpxoii3iat mDrm( p;u0 rxrxr tadom rluvi ( sexrir oy4apee ici s arurx pou1aetomo3ilsla rlumo;u4artoxf3iodoaD ai o;()setoxm3oudom emnctl(fs2urumonu0tlx iieiydfs2emu p;u0 rtnio ty1lm eln ols srxrxm iu1lpeelnvtlt)arraur oo4olxo fctltls um( snu4 rtnifcio1fp elieols) 2xoxm iu1lmtn neta()aruau onu4tlenmfetlsls2em(vo u) exoxoctadlpDe neo t0s2xoirpnodll   fcs t)aDta(mpnu1apenmf3iysfmDrl(msnt)tltnxocoytomtrliei t texoxo oy4llee nviltf rrmumpoo0oleo feiatfa uaump;t)teeomo ta1oa rlivo s0seurim3iu1aptemivtasfarrm(r ot4tee iictyt s ulu o () eeoxrcoa1opDr nes;t0texrxm3iu1apte ivtlt)sDra( p;o0oltoifciatla2eaumonu0 rxnmr3oytfpDr u ilt) etoxmpnudamtnmnvias  2rm(  nu1oexnifctydlmDrmuvs u) rtnxr iatfmtelneo s)teuoxr3iy1lpee fcsasf 2umxrp;o4olxomf3tyt m2umn p u)altnmociy1faD luei t0 etmxm3ny4openliet ()a2tmur nt4openiietlslaDemnmp;u4tlerio iytopDraieols s2tr(m oodaltnlnei t s2uaxmpnt4tltnifeiadlsDeaump t4 exnio iodomDeaivi;s0 exr(r oodal e fes (fa2urump;t0ole mfetys mDelumsnt0tetnmfctatopte nvs;t  rtoxm nudomte ncsltfartau  ;t1tetn o3tldlmDrmumo t)aetnir oodlpt an ols0trxr(o ny1amtelivias s2tru  no4oetnifctyd aDrmuvpnu4 lenmfcoo1lp  li s t)teto(o ou1opeelfvslt  rtr(moou0opeomiciltlaDemn o t4tltnmoctotfmD li o;() 2toim iy4lm  lies t)aDraumpot0oexoiicild aDrm( p (0aexnioctydop rlnvs;(  2xmim nydome mncils s2uaxmoou1tpx ioctlsfm uaumpn(4 rxrmf3ta1lmtrlneolt)t2trio3nu4al nmfvs t s2ta(  nu4aeenifcils m2rlnms;t0 rtnmf iadfaD  ivilt setmxm3iu4lpte fcsl(fsrur(mpnu4tpeomoctad a2eanvo;t4altrxoctodomD li o (  etmxr3iu1ol   icsa(fartmx pou1oexn i3ildls umuvonu0tlxomfciy1op elneolt)srxr(r3oy4olenlnesa(  2rrxmp;u1oee iieiysfs2el(vp u) eermf ootfm   n i ()trxmxm3iodlltn fvilt arrru  ot0oltnmociasfm um(vo t4 eeoxf ta1fa e nvo s0 2tmxr3nodom  lfct s sDrrx ooo1alxn ieilt sDel( s;t0 rermrcoadopt li o;t  rurxo oo4ale  nvtas)s2rmxm ;t0olxomieiltla ean pnt)tetoir3iodlaDr uvols0trtrimpno1llee fesls  Drmurpnt0tpe mfeiydfm umuvs (0arxnxo iadom   uvs t0t2umir3io4lp   feiasfs2umx pou1oeeniieilsfsDrln p;t4 etrxf3oydlmDranvils0texo(mpiy4omen fct (farrmumonu4aetnii3iytla2uluvo t)tltnmfctadlatr ueolt)s2umxm3iydoleelnet t)arrm(mp;t1aexn o3tlsfsDrl( snu)tltnxf3ty1latrlu o;s0srtmio3ou1apeelfeiatfsruaurpno1tpx  i3iytlmDranmo;t0arxrir3oy1fp ranvols0setoiopiy1al elnvt (fartaum ;o0aexnmo3ildfmDuln o u0altnir iatlaDrauvolt tetoir3iudolenlneslt)s2uaur no1oexo f3iasfa ulump;t4arxomf3oo1fm r nvo;(0srtoxr oy4lm elnvils s2umxmo;t4alt ifeilsls2umuvo t)alxnio iodoa rlies;t) etm(mpno4amen nvtlsfsDrm(mpot4aex iictat mDul(vo t4 rerio ty1opD  nvo;t)seurir3nu1om nlivsat a2umu ooo1aeenifciys s eaumo;u0 lermrcoytlaDelivo ( setmxm3iudalt lfcta()a2rr(mp;o0tltoiociysfa2rm( p t0tlxnxr to1oa  liesls0 exmxm oydopt mfviat)srrauroou0aptoio3iadla2ua(ms;u0 etnmfciy1fatelneils texr(m3ny1lle liesat srrmxmoou4opxn fciasfm2ulu ont) rtoio io1fmteai s;t)texr(o3ou1al   nvtas artrxr ;u0tpx io3iytlaDum(vp;u4 etomfcia1om ranei t  rxr(o3nu1omtnmict tf rumxrpnt1apxomo3tlsfs2elnvon(4arxnir3io1fpD aiei s seuoxr iy4olt  ivslt)sDua(rpnu0aexnmiciltlsDem( p t0aetrxr ty1fp  anes;() rto(m3oudape livia(fs2taxronu4tpeoiieiad a eauvs;t) lenxrciadfaD luvsls s2tmxo3iy4amenlnetlsf rua(mpot1tlen i3tldla rluvpnu4 rxnmociotoaDeln i;t0s2toir3nu1om emnvtas s2um(mpnu0oeen ieiyt a2el(vs ()trerxo iodlpDrauvolt)truo(rpnudamtn net ()aDraxmoou4oet mfctysla umumsnt0tetoir oatopt luvo;()setm(rpoy1lp  livs (faDrr(  ;u0oexoii3ilsfsDrlump;(0tlxomf3totlm eau ols sexrio3nu4ome lfctl()s2ur( onu0tpx iieildlmDrm( o t) eeomr3to1fp rlnvs;t0sexoxr io4ll eliet sfaDuaur no1olx  icild a ulnvpnu0aexoxf iodlatrauvsls texmxo no4omt  ncs tfaDrrur ;o0ole  oeiltfmDrm(ms t4 rxnxrcoodlatrliei;t  rurirpiy1opee ivsa(fsrra( o;t1optn ieilt aDum( snu) ltnir iytomDelnvi;()teum(o nudolt mfvsl()aDuru  ;u0oee moeiysls2rlums;u0 lxnxo oadfpDr ivo;t) euoxm ou4amt mnvsls) rrrum ou1optniicils mDra(mo;u0tetoif3to1fa  aieo;(0t2xmimpnu4am  mfeias a2umum nt1ope mfeiasla em( pnt)trenif oo1fptr uvi;t0s2ur(opiudop nlfet t s2tru pnu4tlx iietad a rmnvs ()texnir3totomD an ols0trxrio iu1ol   fcil() rra( oou0opto ietasls rlnvp (4 eenmr3iydfmtr ueo (  eumimpou4ome micsls sDuru ont1tlxo fciadfsDua( o u4arxoxf3totlmDraueo;t0 rtmio3iudlpt mncsa(f 2um( o;t4optoiocias sDua(vsnu4 rerxo3oa1laDeanesl()seumiopnudllte nvias) 2raumpou0aptomoeiytlm2umu p;t4 lxnioctydfmt ln i;( srurxo3nu4om  lnvt t)arrrxr oo4oexnmo3ilt s ulu o (4 renircoadfp eli o t0teurxo iu1al   fetl( sruax oot1openifcild s2rauvpn(4 etnmr3oy1lmDeaivs;s) 2uo
\ No newline at end of file
@@ -0,0 +1 @@
+ueol( srtoim oudlm  mfvtltf rraurpnu0opto ociat m2uaums;(0alxnmr oytopDeanvs s0s2uoxm3nu4aptnlncsls  2raurpou4tptn ieiyslm2ul( pn(4 eenxrciytop r n ils0srum(rpiudlpteliesl( srta(m ;o4oeeniiciys m2uln s t4 reoif iydla eai i (0sruoim3no1ap   nei t)sDta(ro;o0tex  fciysls2el(vp ()aexoir3oadfaDranei;s0t2umir nudolt  nctas)s2tmur nt4oexnif3tas m uanvs;t) rerxr3iatlaDeluvo t0 2um(r iy4ol n nei (  2tmu o;t1tlxnifcildlmDrln p u) lxrio3tatopDelivilt) rtm(m3io1lltnlieslsfa2tru  no0apx  oeiltfa rmnvsnu)aetrirciatlptr nvi ()s2umxo3iodolt mncsas)srta(r nu0teenioeilsfa ean s;(4artrxrcoa1opDelnei;s0srurim3no4omeelfes s  2urxrpnt1tet mociytlsDulnvon(0 renmrciy1om  aneo t)trxrim3iu4openmics (farrmxrp;t1oetoiociydfs rmuvo;t)arxrmo3iodlm eanvsl(0srtmxr io4lm n feta( aDrrxmo;o0ope io3tltfs2ulu p;(4arxnir3oodlpDranesls)srtoxr3iydlpe  fcia( sDurumont0aleoifcilsfs2uanmp;t0artnmfciatlm ranes;s) eumir3iydoltelfviat  rrrxmp;u1olx  ictydls rmnmp;(4 reoxfciodoaD an ilt0sexrio3iydlpe mfvs t a2ta(r nt1tpeo i3tydfs2umnms;u) rxoxociydoaD ai sl(  2xoxrpiu4olt mfcsat artmxr nu1ape  octasfa uluvsnu) eerifcoy1om  au s t)s2tmxo nu4omee ies s)arrm(m ou0oeeo ieiadfm umnmo;(0 rxnmfcoa1fm   uvi;()t2xo(o nu4aptelfvsl()sDtrx onu1tpxnifeiyd m ul(vsnu4 rtoif3totlatrlu s;s0 2ur(o3iy4op elivtls a2ta( p;u1oexnioeiat mDumn pnt0 renxrciydfm   nes;t teuoirpnudapt  nctat) 2um(m no0oetn i3tatfs umu pn(0altnmr3oodopD aneilt0t2xmiopiu1ame  nvt sf 2taum nt1olxomf3tat sDuanmon(0 lxrio oatom   u olt s2tmxr3nu4ll n fcilt a2tmum no4tetomoetltfa2el(vsnu0tetnmrcoydlmtr n ol( seurir3iydamee icias  rra( pnu1alxoio3tydfa ranmpn(0 rtnif3totfmte u s;t t2uriopiy4altemivslsf Drru ono1tle ifcild m elnvs t)tltomfcty1oaDrlneslt0s2tr(rpnydomtn fesas) rra(mpnt0opx iieiytls rmn p u) rxrxf oa1opDrluvolt s2xm(m3ny4op  lncia()arur(m ;u1teeo fciytfm umn p t0tlerxr3ty1laD aivs;( texoir3iodaptemfvtlsfaDumxro;t1aet mocilt a el(mo u)tlxnxo iytfpDeauvs;t0s2urxo nodlltelnesat) Dtm(ront1tltomoeiat aDrauvs;u)alxnmocoatopte ieols0texrxmpoo1lpee ies t aDtm( ono4tltoio3tydla elumpnt4trtrmr3ta1fpt aies t0 eurxopiu1omt lnvs (  Dumur ;u1altnio3iysls2eanvo;()alermr todfa r ueolt  2trxmpoo4opeemnei (fartmum no0tlxn ietas m uln s () etrxr to1lmDeaivo t0s2tr(o3nydlme lfvsl()s2tmumooo1aex moeildfsDuanmo t0 reoxf iodfaD  neo s s2urio3oo4lp  lfesas) 2ur(ro;t0alt mfciyt m ua( p;t)treoxfcoa1oaD au o t  exr(m no4alenmnctls) Dta(r ot1aptn o3iasls ulums;t) eeoxfcoo1oat  nes;()t2xmxopny1apte fvtl( a2uax  ;t4oetoif3ils aDulums;(0 ltnxfciodfat  ivsls) rurxr nudomtn nvs (f Dtm(rpot4aexoiociad m2em(mp;(4aexrmr todfp e uvsls srur(r nudlpte nei ()a2taxro;o0oetomieiys a ra(mo (0aeermr3iadfmt luvil() 2xoio nu1lpe  fvs tf rrrxm oo4olto i3ils m2eluvo;u)arxrmo3ootfm ean o s)srtmimpoydlpeeliciat a2rm(r no1alxn f3ilt m2ul(mo t0alenxo3ia1fa eli i s) exoimpnu4lpt  ieils) Dum(mo;t0teto f3ias mDrln s u4alxomr oa1laD  neo;(0teumxm3no4ope lici (  rtm(r no0ale  ociyt a eanmp u4 rxrio3iatop   ies s srtm(r oy1om nmfeiatf rur(m ;o1tpe miciytlm2rmumsnu4 exomo3oa1fptelu s;s)t2trim iu1lp emfei tfs2umumpou4optn octld m rmn o u4aetnmf3oytla rluvolt)sexrxm oy1optn ies sfartr(rpno4aetnmociadfm eau pn(4artnxo3oy1omte u ils t2xoir ou1lpe mics s a2taumo;u4optnmi3iysfs umuvp ()treoxo tatoaDelivo;t) rumim3nu4ame  nvsatfaDrmum ou0tetomf3iadfs ea(vs;t0areomrciotomteau slt) 2umxr3ou1aptelivtl(faDum(mont1tle  octadfs rln o;u4tetoxf oatomte uesls0 2xoir ou4lmenlnvsls) 2umurooo4olxoif3tydlsDemuvp u0 exrxfctatomt anvi;(0srumxopiydll  mfes tfa2trx p;t4ole mfeiyd m ulnvo;(4arxnmrciydfmteluvs s0 etr(r oodomeemieiatfa2tm(mpnt1aleomf3iltls ra(vo t4tlxnioctydfmtr n s;t)t2xrxopiodlm  licsas)aDua(r ou4apxo i3ias mDemuvont)tltrmocoa1op r ues (0t2tmio3nu1amenmivta(faDum(m ;o0opxn f3taslm um(vpn()artnmo3oytoaDelies ()trto(o3iydom  licil(fsrumxrpno1oltnmi3tltfmDum(msnt)trxnxo oodlp e nvo;t  exr(m oo4omtn fei ( s2rm( pou4apeo icildfm eln p (0 etriociatoate uei;s)srtoxm3iy4ape lnvi s arum( oou1tltniieiat s uluvs;t0tetnxf3oo1la  liesls)trtoir oy4apenmnct ( aDrrxm ot0tpx mf3iasls umums t) ltrxrctotfa   ues s0 rtoxopny1lm   fetls aDur(r ot4tlxnmfciltfm2uln p;u0trxoio3io1fate u s ()sexmim3iudap  lfes t)sDrmur ot1tlx mieiytfmDelnms (4altrmo3iodlp  li olt0 2xm(m oodoptnmnvsa()s2tmump;o1aet ifeiytfa uanvs ()trenmf3oatfaDe n i;s0 eumxm3oudolte ivslt) Dururooo1aetomfctls s2elums ()aetrmfctodoa  ai o (0 eumxrpnydam   fvi t  rumx o;o0tptnii3tyslm2eaums t0 rtnmo ta1oatrau ilt  rxo(r oo1alt mnvta(  2trur nt4oleoiictytfs2rlnvs;u4 ltoxr iadfm  li slt0 2trirpoodlm e ivta(f Dumx oou1ape ii3tytlm eanvpnt0tlxomo iy1fpDe ues;t)srtoio3iodamte nesls)a2rmxrpoo1tptnii3iaslm rmnmsnt0 etoio to1fp  lnei;s)teuoir3oy4ole  ict ( a2tmxrpnt4aeto i3iatfa elump;t)alenxf3iy1lp r u ils) ruoiopio4aptelicilsfa2uaxr ;o1aeeo f3ils s rmnvsnu)texrxr ta1omtelnvs s0 2um(mpny4apt lfvi (f Dur( p;t1aleomoctas m2ua(vs u) eenxr3oydoa   n sl(0 etm(m nydaptnlncil(  ruru  ;o4alxomf3tltfmDran on(4alerxfcoy1fate u il() eum(m3io1omt mnei s  2ur(mono4oeto iciatlmDem(mp t) eeomo io1fa  auvsls) euo(opiodalenmnviat)sDtm(m ;u1opx  i3ilt a emuvpn(4 lermrcoo1fate ivils0 eum(r3oo1al elnciltf Dum(m nt1alt  f3iytfsDrl( p t4aexomrciy1oa r nvo s0 2uo(r oy4lm n fctat)aDumumpoo1oee mo3iasls2ea(mp;(4 lerir3ty1oa r ivo;t)srtrim3oy1llt lnetat  2tax p;u0tltn oeiysfaDumums;(4tlxomf3oydopD anes t0 2toir3io1alenlfes t a2ta(m oo1alt mfetldfm2uau s;t)teeoir tytlp eln i;() ruoxmpou4ape lnctat aDtaxmpot4aptn ociat m2rlu s t4 ltnif io1lp eaies (0t2trio ny4oleemfcs s)aruaxrpou1opxnmietls s2rluvp;() etnxocoo1fm   ueo;t)s2xmxm3oy1oltelnctlt) Dra(root0tpx  feilsfaDemuvsnu) lxnxfciodfpteai ols0 exo(o oydapee ivsatfsDrr(rpoo4tee  iciadls2um( on(0tltoxfcta1om  lu ols0s2tr(r3oo4ll emnvs () 2umum ;u0alxnmfeils aDra(mon()trerxo3tadlmD anei;s t2tr(o3nu4lmt  fvilt)s2tm(m ;o1opt mf3tatls ran sn(0 lxnxf to1la r u s;s) 2uoxm oo1optelncil()srumxronu4tleoif3iltlm umn p;(4trenircoodoaDrai il( teur(mpoodomeemneslsf Dtr(rpoo4alt ioeiasfm rmnms;(0tltnmr iadfa e uei;t0 etoio3nodopeemnviasf Drr(ro;o0oetnifetadfsDra(msnu4aeenmr3tatoatranesls sruo(rpoo4om  mfei ( srrr(mpnt4ape if3tatlsDrluvont)trxrmociydlmDrlnes ( s2urim no4lle  nviltfaDua(m no4apxoif3tltlsDea( on() ltnmr3tydfmtelu slt  2xoir3nydomtemnvtatfa2rm(ro;t0olxo f3iltlaDuau s;u4aeeomo totfa elu sls)s2xrxmpoydaptnmfcia( s2trurooo0oee  f3iyd m elnms;u) etniociotlp eluvi s0 2tmiopoy1lleelnetlt)sDurx onu1apeomicild s2ra( p t) rxoirciatfatr ieols setmio3oudapt  nvi ()sDra(rpnu0apxomietltlmDemn o;u0 etnmf oatlate i s t0s2xr(opio4omtelnvsl( sDua(monu0tpeoif3tatlm uauvp u)trxrir3tadlm  auvi;t0trur(r iu1amt  ivtatfs2tauro;o1oexo fcilsfs2uln on()tetrir to1optrli s s0srto(opoudamtn fei t aDuax  nu4ole mo3iysfm rmnms t0 rtoio iotfmtr n o;(0s2tmxm3iy4lpeemnvil( a2uax p;o4ope io3iadla uln o u0 ltomo3ootfaDeaivol( trxoirpou4aleelfvta(fa2urump;o4tlx  oetldfa2rmuvpn(4tlxnmrciytlpD anvs;s sexm(m no4lpenlnci ( s2umx p;t0alxnioeiatfm rmu s ()aeenio3oo1lm  lieolt0 2umxr3iodoptnlfvtasf Drm(r ou4open fciatfs2umnmo (4 rxrxfciatfmDe n i;( sruoir io1lmt  ncia() 2tau p;o1tee  octldls el(mo;u)alxrmr iotoaDe ieslt) rtr(m iodlpe lncilt a2rrx  nu4texo ietltfm2el(msnt0tleomrcoa1fatraneslt) 2trir oy1lmtnlfci s)arrmumpou4oltnmo3tas mDul( p t)aexomfcio1lptrli i s)teuoxmpno1ol emfet tfsrtm( o;t1aptnmictydls2emuvon()alenmr3iatoaDrlnvolt  rurim nydopeemfcs (fsrtrur no0tpto ieias m2uln o;u) lxniocto1oa  li slt)seumir oy4ape mfet s srua(r oo0apenmiciat mDrmu o (4 renxrctytfp elivsls0srxr(m oo4omee ictasfsDrrx  nt1tlxoifciydla emu ont4aeenxf tatla elnes (  2xrir3nodlm   fctas) rtrx p;u4aleo icils s ulu s;(0trerxoctydfmtr nvolt) eurxm3nydoltnlnvs t sDurxrpou0opx mi3iatfa eaump u0aetrirciadfaD au ils) 2toxmpiu1amenliviat)srraxronu4oleomieiltfa2rm(vs u) rerif oytomteauvo t0setr(rpnu4amen fetltfs2trurp;t0tetomietls m el(vs;t4 etoxr3oydfa e ivils0texmxo iodlm   nvsas srtm(rono0olxn fcilslm2ua(vont)trxnir oo1fat  nes s t2xo(opou4om elfei s) rrru p;t0alx  fcias a2rmu o u4tltoir oatfp   nvs;t0srurxo3oy4optnmivt t  rraump;u1tlxnmiciydfa rm(mp u4 etrxo iatoat anvi t0setmim3iu4openmfvs tfs2rmxrono4olto iciyt a rl(mo;t4trermr3oatfaDraues t0 rtrxr3iy1altelfciasfsrra(mooo4tex  ociysls2rl( o u0aetoxfctytfa  luei ()teur(rpiudolt lfesls aDrax pou4ape mi3tasfa el(ms;(4texrxo tytfa r neo t) 2ur(rpoy4ape lncsas  2uax  ;u4altn f3tls aDrmnmo (4tetomo oa1fm rlnvo ( srxoxrpno1al nmfet s)aDrm( pou4tex  oeiad a rlu snt4arerxo3iydfa ean i ()sexoxr iu1amtnmieta( s2tr( o;u4tltomfetlsfm2em( on(0 rtrxf3tadomDeluvol()srtm(mpiodapte fcia(  rrrx oot4altoii3iltfs eaumpn() etrir ta1faDe i s t0 2tmir io4lptemnci tf rrax o;u0opeo ietltfs rlu sn(4trxrxr oa1opD  n i;( trxo(opoudlle lnesl(f Drax  no4aeenioeiltfa elu s;t) renxr oodfa  ai ilt seurio ou4aptnlicsltfsDua(mo;o1aleomfcild sDra(vp;t0arxrxr3oa1la eaneslt0 2tr(r3io4lmtn ictl( s2um( p;u4tpt  iciadfa2ulnvo;t)tlxnxf3iy1lmte ivi t)srtrxmpnudop   fct s)aDtm(m ;o1oexnmiciyt m ea(vp;u)tlenxo iytopD  ies s)texrxo3ny4amtnmict ()s2rrx pot4olenio3tlsfs2emnvp;u) eerxo3ia1fpDe nvi;(0 2um(o io1llt livils)aDrrxmo;u1oexn feiat sDelumpnt0trtrmr3oy1fm  au ils0 exoio nu1llenmnes s sDum(rpnt1aexniieilslm2eauvs;(4 eeoioctotfmtr u ols)srtmirpou1omenmnctat  2trx pno0apen i3iyd s2ua( pn()alerxr3iotoaDrlneo;t) 2urxrpiu4amtn nctas  Duau oou4aetniieilsla elumpn(4teeomfcio1om e ivi;s) 2trir oy4lpe lncsa()s2ra(mp;t4tpt  oeiat a2eanvo t) lxnircoodopD  u o t  2xr(o oy1ome  fetatfsDra(rpnu0oleoif3iytla em(mo u0tltrxf3ty1opDeaivo;s)t2to(r no4ll nmfctls aDur(r ;u1optnmo3tyt s2uluvs (0 lxrxociadomDelivo;s0t2xrio nydomt  ics ( s2ur(rp;t1opxomociytlmDulnmo;u0areoif todlmDelueo t texoio iudlmtnmnct tf rua( onu0apen oeiadls raumon(4arxnir3ta1fmDeai o t seuoio io4apee icsas)a2ururooo4tptn fctat s2ea( pn() exnxr oo1faD aieo;t)srtoxrpnodll nlfvs sf Duau poo4tpxo fctldlm um(mont4tltomocoytla r i i s0s2tmiopny1olt  nvi ()sDtr(  ;o0aet iieiat s2em( s t4trtrxr3to1oa r uvsls0t2tmim ou1lptelivtl(faruau pot0opeo fciyd m uanvs;t0alenxo3tydomtrlieol()t2tr(m3oudaltemietat)a2umu  ;t0apxoio3tld sDuln o u)aetnmr io1fpDr nvi (0s2xoio3no1lpte nctat  Drmxmooo4apt  ictysfm uan p;u0tltnxr3ia1fa   neo;s  rtrxm no4om emneils srra(r ou4oexomfeiasfs ran p t0trxnio totfm rluvi t) 2xo(r iydom elnetl(fs2uaur ;t0tetoioetyd m emn pnu0tlxoir3iy1omD  ues;s t2umxrpoy1al e net (fsDtaxr nu4apt mi3iadlm2uln snt4alxomr3oytlpDr ieo s)sruoxrpio4apeemivsatfartrxrpot0aeenif3ilt aDra( sn(4tetoifctatfateli o s0 etrim3iodlmtn nct s)aDrax  ;u4tlx moeiadls2elnvo;t)trtriocootfpt ai i;s0 rumxr oodlpte fesl(fsDrrx  ou0olt iieiyt s2eau sn(4altrxr tatfpt li s s)trxm(m io4am emfcilt  rumxrp;t0oet mictadlm ul( snu4trtomrctytlptr uvs;( trur(m io4ame lnvtat a2taur nt0alxn oeilt a2emnmo t0tlxomf3oydoateaueo;t0t2to(r3iy4ll  lnetas  rrm(rpnt0aptoio3ilsfm ul( s u0 rtrxf3ta1oatrlnesls0 2xrxm3iudal   nviasfa2tmu p;u0teenmoeilslaDeauvs u)tltomr oadlmD livils0teurxr iodap nlicils) rrmxmpoo0oexnmo3tydlm eauvp (4artnxf iydlmtrlu sl()s2umirpio4lpenlict ()sDuau oou0aee mfciyslm ua(vsn(0 rtrmf3oa1fm rln s t) rxrir iydlp   ict t) rtm(mpnu1texn i3tyt s2um(vp;(4alerirctydlpt luvo ( tetr(m3ou4omtnmfet t) 2umum ou0ape ii3iytfs2eanvs;t0 lerir3ia1late n olt0 etmxo no4alt mfviat) rraxmont1oltn f3tld m eanmsnu)tltnxr oatfpt  i i;( srum(m iodlltnmnvt t  2rrx  ;t1apx mieiytlaDea( o (0arxrxf tydlp   ues;s s2xmxo iy4lptelfetas  Dtm(rpno0tle moeias m2rlu o;u)arerxr ty1opDe u i ( sexriopnu4al   nvslt aDrr(m ot1tee mf3tltls2ulu pnt4aetnmo ia1laDrauvslt  rtoxr ou1llt  nci s)s2taxr nt0teeo i3iydls2rau o;t)trenif tatlptr n ilt) exo(r oo1om emiviasfaDrm(  ;u0oexnmiciys mDrl(vpnt0treomr3oy1lp e i s;()texoxo3nu4ope mictl() Drrumont1oex iictls a elnvp (0 lxrmf3tatfa  anvs s s2xmimpiy1omtnmnct sf rrrxmpno0olxnmoctad m emnvpn()aetomo3ia1fmte ues;t0trtmxmpoo1lpt  ncslsf rrrx pnu1apto fctltfaDum(vs t) renmf iodoate uvi ()seumxo no4lp n feias) rtr(rp;o4tpxo feiys a2rm( s t0altrmf ia1la e ues (0trtmim iu4am elfetat)a2trum ;t4oexomoctlslm2uluvp t0arxoio3oodoa  ln s s0setoimpou1openmfvsls s2uaumpoo4oeenmfeiltfaDrlu o u4artrxoctotfa eln o s0t2uoxo ou4ole mies sfsDrax  nt4altomfeilsfs el(mont4 etrxocoatlatrlnvo;s)t2to(o iy4am nmictl() 2tm(m nt0aeto fctls sDran pnu4trtnircoodfpDelivs ( trxrio3iudamee ivtasfs2rrx  nu4tptnmi3iydlm2rm( o;t4alxnmf tatom eanei;t  rum(rpoudal  lieias arur(rp;u4texniieiat m ran pnt0trxnif oatlp  anvsl(0t2trim3nudal elfvt tfsrtau  nu1tlt moeiydfa2eanvon()arermfcta1lmt  ueol(0s2xoxrpnodolee ietas) 2ra(mpoo4ale moetadla2ra(vs;t)trxnxfctotlaDrluei;t t2uoxo3nodop emfeslt  rrmumo;o0opxomiciysfsDeln pnt4 renir oodlmDe n o ( t2umxmpiy1lptnlivs s)srrmxro;t4ole mocildfs2ea(vs;() etoxo3oa1lat  nvs (0teum(opnudlle mncs ( sDrm(r ou0tle  o3tyd sDemu on(4tltoir3oadlpDe nei ( sexrxm oo1lltemncsat a2rm(  nu0aee  feiys aDranvsnt)aexnmf oy1lp eln i;() exoio3iy4optemict (  rra( ooo0alt mfctatlm2rau pn()texnir3oy1fpD lu o;( teur(opoo1alt mncs tfsDuauro;t0opeo ociatlm eanvpnt4tltomrcoatlate nvi s  rxoxr iu4lmeelfes s arua(  nt4tlenioctydlsDemn sn(0aleoxfcoy1oa rluvo () 2trimpiodome lnvtasf ruaumo;o0tpt mieiytlm2rluvpnu) rxomo oy1fmDe ies;s)srxmio nu4olee ies ( a2umx o;u0opeoif3tydfa2el(mpnt4 rxnxf ia1oaDr n s s setoir3no1aptemnvs t arrrxronu1oeenifctldls el(vo u0 ltoio3iatlp   u slt0 rxmirpiudlmtnlnvil(faDtaumoot4apt ifeiatfaDuaumo;u0 rtnir iy1omt anvs;()tetoir3iy1om  mnvia() rurxm ou4alxnifeiysfaDelu o (0 lenmrcty1fm ran il()srxrxr iu1opt mietls)a2uax pou0tleomi3iys m eau s;t0texrmr oatop elu i;s0texmir3iydlleemfesl()sDraumonu0tptoifeiad m ua(ms u0 lxnmo oadlmtrlnvilt0s2toxopnydopt  ncslt)a2tr(rp;o0oexniietltls2umumon() eeomf3ty1omt  uvilt0trxr(r no4am e nei () rum(r ot0aex ifeildlaDulnms ()texoif iy1fp raivo t srxmxrpio1amt mnvtl(f Dum(r no0aptn i3tasfmDrluvo t4 exnxr3iy1om r ivol(0 euo(rpiodapen fct t)srrmxmonu4teen oeiatfmDeauvsn(4texrxo ty1fptran s;s0t2umxrpiu1ll  lncia( aDurum ot1ale ifeiatls em(mo;u)texnxf3oadom  luvols  rxoim3ou4al  lnvs s srurxmpno1texn i3iltfs rmu s;() lermrcto1la eauvo;t0 2xrimpio1lltnliesls)arrm(r ;o4apt ii3iysls ulnmo t0aleoxr3to1omtrlues;s0t2uo(rpoudlpt  fci tf rra(  ot4optnio3iytlmDulu pn(4 ltomfciy1omDelu i (0texrim iy4ll   nvs t)srtrxroou0apenmoeild s2ua( pn() reoxo3ta1om eaueo;t seuoxm io1omtn ivia( arta(rpnt0oleo o3tls a umu p;() exnif oydom e nvi;s) rtr(opiudlm emicil(f 2uaum ot0olxomoeildfs ul(mont) exoir iatoptrauvilt)sexr(m3iu1lme liesa(fartmumono1oexnifeiatls2uanvp ()tetoxf3iodfmt  nei;( srumiopno1apt lnvia() 2tauro;t4aptn i3tysfmDum(mpnu0altnmr iytfm eaueo t srtrirpno1ape  ici s)sDur(mont4texomoeias s2eluvpn(4altrircootlp eln s t  rxoirpiy1amtnlfvtl(faDrmu  ;t0tle io3ilsla2ua(vo t0aeenio3oatoaDeaues s)s2umiopoy4op nmivsatf rtax pno0altomoetadfa2em( on(4 leoxf3iydfp r nes s) 2to(m3oodaptnmfvilt)srrr(mp;u4tex ioeiydfm eauvs;(4 eenir oa1omDeanvs;(0 2ur(m3iy1lmtelietlsf 2rm(  ou0alto i3iys sDum( pn(0alxomrcoo1fa eanei;t) 2xmio3iudlpen iei sfaDrau  nt0ape mo3iltls eau pnt0 reomrcoatfpD aieo;s0 rumir3iu4llt  iviasf 2taur ot0apxoifcils aDel(vp;u)artrifctadlmtr nei;( srxrxo3io1altnlivilsfsDrrur ;o0oexomfciat mDra(vp;t0tetoxociadlm eaieo s  etmirpoudomen ivt ()a2ur(mpou1tptn iciydlmDeauvp u0trtrmf oo1fm r uvo s srtrxo nu4lpt  feiatfs2rmx  oo4tle moctaslaDrau o t4teerxfctodfp eanes;(  rtmxr3oy1am  lnvia() rumxmpot1texo fctlsfsDemnmsnt0alxrirctadlate i o t tetoxr3iy1ap  lnes s)srrrx  nu1tet mf3tasls2ulnvp (4trtrxrcoa1fp   n i s  eur(rpiydllte fctls s2rrx  ;o0tpxnii3iadls2raumon(4arxrmf to1fa   ieo;t)t2xr(m3ou1amenlici sfsrrmumo;t0olx if3ildlmDrl(mp;t4 rtoxociadlaDrauei ( t2tm(rpnu1lleelfesat srrrx  no0tlxo f3iydlsDrl(vp t4 lxoxo tydlat  neilt)t2xoxr nodolte ieil(faDtr( ooo4apt  f3iys a2eanvo;u0aexrxr tatlmtelivi t truo(m3iu4optnlnctatfs2raxm oo4aee  iciysfaDelumpnt)tlenio3totoaDr ivsls)teum(r nydopte nci t  Dtau  nu0tet  fciasls2rluvo u0alxoif3iotfmte u s;t s2uoxr3io1aptemivs t aDrmurpnt4oltoio3ilsfa em( s u)aeerir3io1fm  aivs;t) 2urio3nydlltn fvi tfs2uaumoou4tptnmieilsfa2ulump;(4 rxoxr oadoat lieils)srur(r nodll  mnvt sfaDrr(mpou0opeo feiltls2rm( s;u0aleoio oadfmDrluvi s setm(m oo4op   nvtas s2tax pot1ole mieiad a elump ()texomf ootfpDe ieslt0s2uoim ny4omenlnvsa(fa2tr(mp;o4tpe  o3tld s el(vp;(0arxnmocoodopDelivs;t)tetrirpnu4olee iet t)a2tmu  ot1tptnioetlt aDulu o;t)aexnmf3oa1lm r neo (0 rurxr oydamt mieilt  2tr(rooo0oeenifctysfa rmuvsn(0 rtrir ta1oate nvi;( s2tr(rpnydopt  icsl(f rtaxront4tlxnmfeilsfm rmnvpnt4 lxoxo3tydfp rlu o t trtoir3no4ap   net s) rra( oot4optoio3ils m um(msn(0teenioctadfmDrai ilt s2xmir iudome lieta(  Duauront4teeo octytfa2uaumo t4aetrxocoadfpt ln i (0s2xmxm oo4ap  lfcs (f rumu ono4oexoiieild s rl(vp t4 ltniocoatfp rauei;() 2umxopno4al emfvslsf rtmxro;t4oetnmfctatfm2ulums () ltriocoodomDeaivi;( s2tm(m3ny1ape  ieiatfs2ra( o;o1tlt miciasfaDemn snu0treomr oodopDelueolt0 rtoimpoo4apt  iciltfsrtau o;o1tpe moetytla2umumon() rtnircoo1laDraivi;(0texo(o3ny4aptnmfctlt) 2tmu pou4olxoif3iltfa2em(vpnu)aleoifcoydomt li o (  rtm(rpio1aptemnvsa(f 2taum no0alxomo3iytlm elu s;t0trxrxo3ta1laDeauei t0teurir3iudlptemnvsatf rta(  ou0tleomietlsfa rmu p;u0artrifctydomD  nvo s0 2xmxm3nydaptnmnes tfa2tr( pnt1aexoiictaslaDemump ()trxnifcto1fmtr nvo s srumxmpnodlptnmics tf rtm(m oo4aee mfeildlm ulnvs (4treoir io1fm rlnesl(  2xoim3no1oltelfvta(fa2trum oo4oee  i3iat sDemu ont0trxoif3iatomDe i s;( s2xoxr3ou1lme mncs t) rtr( pot0opto fetlt s2emn s (0artrmrctadoa e uvo (0 exr(o3oydalenmnetlt arrru oot4apxomfcilsfm2um( s t4arxrxrcoo1faDeaivs;(0teum(o3nudaltnmfesl(fa2uaxrpnu4aeeomfcilsls umnvp (0 etrmocio1fpt aivs s setoim3ny4opeemfcta( arta(  ;u4tpe  i3tatfaDumuvp u4 lxrmocootlatr uei;t s2xmir3iu4lptelivi () Dtm(  nt4teeoii3tyd a uauvo t4 rxomr3oo1opDrauvols0 rto(o iodlpeemfvsl(faruauro;t4aptniocilsfmDul( p u) etoio3oadfateli o s  rxrim3iodome liciltfsDumu ont4tlxnmieiysfm2eau p u0aexnxo3tytlatraivols srxm(rpoo1apt lnei s) rrm( onu1tpeoif3iyslm2raums;(4artomfciadla e neol(0trumim nu1ome mivsatf Draump;u0aetoif3iyslm2uauvo u)aexnmfctadoa ranes;s  rtoir3no1al emicsa(fa2umuront0tlenmo3iasfa rlnmsn() ltomociytla   ueol()tetmxo3iy1oleelfct t) Dtmu oot1alx ioeiatls2um(mo;t0 eenircoodomtrlies;(0 ruoio iy4ape  fct (  rtm(mo;t1apt mieiyd aDelnvp u)texnxrciytfm   u ol()texmiopoo1opeelicslt)aruaxm no0tex ii3iadlm rmu o;u4 ltrioctytfp r i o;t)s2xoxo oydal nlfesls a2rmumoou4tpto i3tls m2umu s (4 rtnxo oy1lpD lu i t) euoxmpiodop e fct (fs2raxrp;u4aet iietldfmDulnmp;(4tlxoxr3iadfatean o t)trtm(r iy4apte fet ( aDtau o;t1apxniociadlm2uan pnu)tlermr3iytopteli sl(  rxoir no4olt miviasfaDraxrpnt0tpenif3iasfsDrlnmpnt0alenxr tytfmD  i s;() 2tr(r3no4lmte nctlt a2raur ot4ale iictytla raumont0aeeomf3oydlmtrai il( sruo(m oodaptnmictl(fa2trur ;o0aeeo feiysla2elump;u4trtomf3oa1om r neol(0s2trxo3oo4ame  ics sfaDrmxrp;o0tpxomictys mDeauvsn(0tlxoxo3oa1laDelivs;(0 exoxo ny4ape lncil() 2rmumoou1oex  o3iysfmDea( p;u0 eenxf3tatlpt  nes;s  rtmxmpiu1ll  lnvtatfartmuront1apxnio3iydfmDulnmonu)tltrioctodoa r uvi (  exoxrpoo1ame  nesl()s2rm( o;o0olxo o3iydlm ea( s;u) rxrmf iydfaDe nvo t) euoimpoy1lmt licils srua(m ot0tlx iieiydfa rlums u)artomrcoodoaD liesls)srumio3iu1optelfei ( a2ururont0altn i3tadlaDeluvp t)aexrmf tatoptrauei;(  rtmxo3iy4apt lnciat)sDtmurono0aetnio3iysfmDrm(vsnu)tleomf3oodfp r n il( trxoim3ou1oltnlfeslt)artmx  nu0olx mfeiysfsDum(vont)tleoifcto1omDr ivols)s2trxm3iu4amtelnvilt)srrmx p;t0tpeo fciatlaDelnvo u) lxrifctytfmt li s s) eurxopnudol   ncia(faDtau ooo0tetn o3tas a2ulumo;t) eenifcia1lm eauvol( s2umxm no1aptnmieia()srtr(root1aptnif3ildlm2eaumo;t4 exomfciydfptelu sl()texoim3oydamt  nes (fsDraur ;t4apt mfeiysfs2ul(mp u4alxomrciotfp e i s;(0sexoir oy1llee ncsltfs2rru p;o1texo i3tldfmDrm(vo (0trxrio3iytlp elnesl() etmimpny1am  lfvt s a2umu  ot0tet  fciydlmDulnvo;(4 lxomo iodfa  au s (0 2uoir3oo4am nmnes ( srrmu o;u1tlx  fciltfmDua( o ()arxnmfciatoptr uesl( srxm(r3ny1omeemics (fs2urx pno4ole mfeiyd s2elnvp;u4aeenmr oytla  ai i s)sexoim3oo1ale mivil(fa2trumpoo4apx mfctytfm2ea( ont4altomo3iydom rlies;t  2umxr3no1ame lfeils  rtauro;o4teeoii3tatla emump (4 eenmfctotfaDe nes;s setoim3oudaltnlfes ()sDtmx pot0optnif3iat s um( onu4 ltomf iy1fatrlnvs;s)trurio io1al  lnctltfsDtm( pou1aexo f3ils mDua(msnu)tetrmo3totlmte n slt)t2tr(rpny1lpenlfvia( aDtmxr ;t0oee ii3tldls2rmumpnt)tlxnmf3iy1laDrlivo s  rtrxm3oy4al emneslt arrm(r ot4tpxnmi3ias s eanvp;(0aleoif3oy1laD ln s;(0seur(mpoy4lm eliet tfs2tm(rpnt1oleomoetytfaDelu s;t)tlenif3ia1opt lies;t)s2xoim nudap  mfes s)aDtmxrpoo4oexn f3tas m2uanvp;() lxrio iodfa   nvo;t0 eumxopoudlpe lictas  Duau ono1oltn f3iysfs2emu s u0tltrxr3tatlmDrauvs s)teumxmpio1am e fcs tfa2raxrpnt4oetnif3iys s ea(vo;(4teenmrcoatlat  nes;s0trtrxrpnodap nlfvias  Dtm(mpot0oeto fetydls rlums t0arenmf iy1omD lu slt0s2xmir oo4omtelfesa( artrum nt0tlxn ictysls rmn onu)treomr to1omD  uvi s0s2uo(m3oodamt lfciatfaDrrum no1aexomoctldls em( pnt4alxnmo3iytlpt auvslt0s2toxmpoy1ap nliesat) 2tmxr no4alxnmicild a2umnmp (4 ltnxo totlmtelnvsl( sexmiopoo4amtnmfesls aDrru poo1oexnmf3ilt aDranmonu4aeenmr iodfa eluvs s seto(r3nu4om elfvt tf rumu pou0opxniocildls emu s u0tlxnmr3tatlp elnesl(0t2trir3nu1omt  ieiat  2tmu  oo0apx iieias s um(mp t0 lxrifcta1lm rlivslt0srurxmpiu4omte nvilt)srtmxmpnt4tptnii3iatlaDul(mo u4 rxrxo oy1oa   n o t0t2uriopoydom emicta(  rra(rpno1tpx iicilslm2uluvo (4 rtoxr totlpD lu i s texoxo no1ome  net t a2rr(mono4tle mfctatfa rl(vs;t) eermo3tatomtranvi;()t2umio3iodlmt lnctasfsrta(r nu4opeoiocias a2eanvpnu)altomo3oo1fpDr ues;()t2tm(m3nydapenlnviasfsDrrur nt1tetomo3ildfm2ea( o;()teerxfcoytfpDeauvolt)s2xmxr3iodlltnmfesls arra(mo;o4tpen ietysfa2rlumo u4aeermo3tadlaDraies () 2xmio nu1ol  lncs t)srumuront1tlxomieiatfs rluvp;u) rtrmrcoydlaDean o t  2xoxm3iydlmtelnctat)sDtr( p;u4teenmoetytfmDranvsnt0teenxoctotlp  lnvslt0trxm(r nydale  ictl( arur(r nu0apeo ocilslm em(ms u0tetoxo oydfpte uvolt srxoio3ou1apenmfetat)arraum oo1aeen ieilslm2rm( s;t4aetoircoatlatran o t teuo(r3nodome  fcilt s2rm(r nt1ole mociasfm ranmp;(4tltoxr3tytomt ai s (0teumir ny4am  lnciat)a2rrx pot0texnmieias s2emu o;t4alenxoctotfptelivo (0srtmio iudlp emncia(farrmu  ou4oltnmoeild m umuvo;t4 exrxr3to1lat auvo;()seuoxm oy4llee ietl()sDrmurpou4tlx mf3iadfaDumn pnt4trtnio oo1lm e ivs;t0 rurxo iodome mict t  rraxr ;o4olx mi3ilt m2ra(mont0 eenirciy1lpD ln ilt0setm(o3oo4am nlieias)aDurxrpot4apxomfctld a2ul(mp u)aetrmr3oo1optrai i s)t2xo(rpiodol nmieslt)sDumuro;o4optnmf3ild sDeaums;u4aetnir3iytfptrli ilt)texmio nydam emneilt) Drr( o;u4aex ifeilsla ra( p t) lxoio io1opD li i;s s2xrxr io4lmtn ivtlsfsrum(roou0oet mf3tad m em(mo t)tltrmo3tadfmtelieols)t2uoio nu1alenmfvsa(fsDtrxmpnu0apx  fciyd a ulnms u4altnio3iydfm  aivs s trtoir3iydlm nlivsl()sDta( ooo1oet  i3iatlmDeauvpnt)alxrio tadfa r n o t)teuoxr iodaltemnciat)srrmurp;o4tltomoetlt mDelump;t4alxoifcoydfpt ln ols0trtmxm iu1openmnci sfaDumxmp;u1olto o3taslaDrmuvo ()tlxnir iytfmteln ils  etrirpoy1ape lietas sDtaxr ;u0oltomf3tldla rau p t0trxnxo3iatom raivs;s sexrxopiy4amenlfvtl() Dtau  nt1tpxo o3iatfsDem( o;(4 exoif ta1oa  ai sls s2tr(o io1ol e fesas artaump;u0tlenmictat m rlnmsnu) lxoxr3tydop e uvslt sexm(r iu1altelfci t)srrr(mont0tpt ii3iltls em(vs u0tltomf3oa1lpDr i ols)tetm(r3no4op   nvt (  2rrxr ou0oet if3ils sDumnvonu0aeermo3iydopD anvsl()s2tm(r3oy4openlies t)srrm(rp;u1olto ietyt sDel(monu0alenxf3iatom r neo s0sexoxr oudlpe miet s)s2tau poo0opt  ocils a2ea(mpn(0 ltrifcio1op  lnvsl(0 2uo(o3iy1amtelnvsls)sDtmx  ;o0tet  feiysfm uanmonu4 eenioctatfm elnvo s) 2um(o iu1ale mnctls a2uru pno0olt iictlt sDua(mo;t)trxnio iytopteli i;t0teur(rpoo1lptnmies t)sDtmx pnu1tptomiciysfa elnvo (0tetoxf3ia1lmD auvi ()trumxo ny1olt  nvi t) rrrx pou1aexomocild aDrmums (0 ltomo3io1fmD  n olt)texmxr nudlmtnlfcia()arta(  nu0alt  i3iad m rmu snt4arxomf oo1fpte ivs t)srxo(m iy4aptnlivt s) 2umxmp;o0tlx mociasfsDrmu p ()arxrif oodfp eaieo ()teuoir iodlptemictl( s2uauro;t0opxniociysfaDem(mp u0tlxrmo oo1fateluvslt) 2umir3nu4amtelnvslsfa2rr(r ot0tetoifciadfm2uanms;() renxf3tytfmD lnvo;t)truoxrpnodllt lfes () rrm( ooo0teen i3iydla rlnmo;u)tlxrif oo1lat lu s ( teuo(r3iy4lptnmfviat arrr(mpnt0tpt  feiys sDul(mo t4alenifcoodoate iei s)setrxr3iu4op e ncs (  rtm(rpnu1aeto i3iyd a umuvsnu0tlxomr tytop eai o;(0texoxr3iodale  fes t)srrmxronu4apen ociys s2eau onu0texrio3iy1omt  iesl() etrir3nodaleelnesa()a2rmumo;o1apeoio3iyt s2rmuvs;u0 lermfcoy1opt aneo t seurirpny1ll  micslt)sDtmx poo4apx mfciyt sDeauvo t0artoxf3totlpt lnvo s) ruoim3ou4lp n fviasfsDrmx p;o1apxn feiat m rmn p u)aeeoio3ty1lm   uei;s0 2xrxo iu4ol nmictl(f 2uaum no1oltoiieiyd aDulnvo;(4 rxoxo todfp eanesls) rxmxr no1llte ics t)arur( pot0tptnmictltfs umnmon(4 exomrcoytop   ivo;()srtoim3iy4lp nmnvtasfsDumx poo4aexnif3tldls uan o u4arxrmr3oy1lpD li olt)srxrio oo1ope mncsl(fs2um(moot0oetomf3iys m ul(ms u4tlxoir3tydopte nvil() etrxmpnydom nlieilsf rtrxrpnu0alx  f3tldfm2ea( p t0aetnif3tydlptr nes (0trtoim oodal elfes t)srrmx pno0tpe  oeiatfm umuvo (0aeenxocoa1fat aueil() rumxrpoodalenlfvs t aDraum oo0tlxnmfetls sDeluvpn(4 eeoif3iadfa r nesls)seuriopoo4om   fcilt  rum(m ot1aexomfciydfmDulnms;u)trxomfciotfpD au sl()sruo(m3oy4olt  nvil() Dtaum ot0tpen f3tldla elu sn(4tleoir tytfa rlueo ( s2xoxo nu4lltnmfes () Dtrumpno4oeto feias a elnvs t0 ltrircta1lmtelnes;(0 rxm(o iu4am e ivi (fs2ururo;t0tpxnmf3tatfa rauvp (0tleomf ootoatelneo s)s2xo(m iu1altelfeiatfa2ta(moou4oexnmi3ild mDea(vo;u0aexoif3todomtrln s;t)seur(rpiy1am elnesat  Dtauroot4tpt micilsfm el(vs;u4aeenio3to1fmDrlneolt) rur(mpoo1lp e nct (fs2rrx onu4tpeoio3iyd s ean o;t0aleoifctotom elnes;t trurim iu1apeelici (fa2rm(m nu0aet if3iat s eau pnt)alenxo3oatoateanvils)srto(o nydoltnmnctltf Duaxr oo4apeomf3iasla2ua(vonu0 rtoxf3iadfmt auei;()texoxr3nodlmtnmnci (fa2uax  oo0alt mociyd a ul(mo () rxrif ootlmDe ivi s  etoirpiy4alenlicil( a2ta(mpnt0tpeniieias s2ua(vs ()altnir3oodomtrlivsls) exr(o ny4olen feta( srrm(mpnu0olxomietatfsDea(vp;(4tltnio3oa1lateluei t setoxr nodlm   netlt aDrrxrpou1oex moeiasfaDraumont)trermf3iatfm eaivils s2uoxo iydopt mfet t a2rmxront1tlxn ieiydla el(vs u) exnir3totlm eai s;s) 2toxm3nu1lp   nvi tfsDumu pnu4aptnifeildlm ranmo;() rxrxrcta1omDe uvi;t)texrim3iydol   fvsa(fsruaurono0texnmo3iad mDrlnmp;t0arenxfctodopDeln s;t  etmxrpou1omte nvs s sDra(ro;t4aexoiiciyt aDul( snt) eenxf iadfmtr nei t)srxr(rpoy4lme mfctlt)srumurp;t1tet ifetad sDranmp;t0trtrmo iodoa   nes s)setoiopiydom  lietas a2rax  no4oleomo3ils s2uluvsn(0tetomr3todom r ieilt0teurio3iodllt lnvt ( arrr(r no4aeeomieiatla emu pnu)trxrifcoo1lmDrau s;s)trxr(r oo4aleelnvil()sDtaxm ou0opxniicils m emn pn(0tetrio3oadoptraiei t0 rxoiopno4ol  micsas)sruaxro;o0tpe mfeiadla rm( s u0 eeomo iydfpDr ueslt0 2xm(r3iodal  mncilt) Dra( pnu0aptnifctyt sDraums;(0teerxoctytfat lues;s0tetriopiodopenmnvilsfsDraxrono1ale ifetytfsDrln p;(4texrmoctodlp  lies t t2tr(m iy1ap nmfvs s)artm( ont1oltniieiyd aDrmuvpnu0texnmf3iodlaDr uvil(  rxrxm3iu4lmtn nci ()a2tm( ooo4opxoioeiasfsDrl(vo u)aexnxf3ta1fa  lnvo t)srxo(o oodomtnlfcta()sDrm(moou4oeeomoetas m um(vp u4trxomo to1op rauesls  rxr(r iydal  mivs ()srtru  ;t0tpe ifctat m2umuvo u)teenxf3iy1oatr nvi;t trumimpnu1lleemies s)aDrr(mpoo0olt  ietas m emnmsn(0trtoif oatlpte i olt0 eum(m iudamt micsa(  2trumpou4tee mf3tld mDea(vs;u4 lenmo to1fmDrlieils t2tmxm io4altnmfctl( s2rmurpnt4oeen oeiys m ean snt) rermf3todomDrln olt)sexr(o oy4lmtnlfci t)aDuaxmpou4oleo oeiltlm2ra(mp ()texnifciodfmtr nes;t texmiopnodlptemfct s  Dra(mo;o4tptoioeiyslaDea( p;t)tetnio oo1oa  lu ilt0trtoxo3oodapeelfeiat aDumuroou4optoiieiydfaDea(mp;u0artrmo oy1lptrau ils sexoxr oydalen fei () 2rmu  ;t0apto i3iytlaDelnvpn()texnxr3oydla  lneils0trxo(m3nu1apt mnet tf 2tmu  nt1tpt  o3tydlsDrlu o (4trxoio3iytomD liei t trurio3iu1amt  netas aDtaxmpnu0apxnmieiasfmDuluvp;(4 leomfcootoa ean i s  ruoio iodop n fvtlt) ruru o;u0opeo ociat s rl(vont4teermrcoy1fpte u sl()t2to(m iu1ll nmneia(fartr( o;u4aptnifctldls ra(mo;t)altrifciotfp  aueo;t)seur(r iy4optemnct s a2ur(rpot1oex mi3ild aDumuvs;t4tltrxo todlpte u olt trtrir3oo1am nlnetasfsDua(mooo1tlxniieiytlm ra(vpnt)aexrxrcia1lm  aivi s0t2xrir3ou1omeelivsl(fa2uru  ;u4tlxn oeiytlaDra(mp;t0alxnmr3totlpt lueils srurim3iydlpe  nvi ()srraur oo1olx ifeild a2rmuvo t)trerxr to1optelnvo t srxo(m3ou1aleeliesat) Dtrx  ;o1alxomoeildlm uau o (0 rtomr ty1lp  auvo t)seurxm nu4ole lfvils) 2trxmpoo4tpenmoeiatlaDelnmp u4aeeoir3iydfateluvi s0 2xr(r3ny1apenlnvta(f Dtrxmo;u4oltniictadls emnvo;t) rtrio3oatoaDraivs (0s2xoirpiydape  ieilsf rra( pot4openmoetysfaDrm( snu)artnmfcoy1fpDr neil(0srum(rpiy4amtnlfci (fsDtaxr ot4tpeomf3iad m umums;()alxnmo3ia1latran i;t0teumimpiy4am emnesatfa2rrx ooo0tleomfciysfs2eau onu4 renmf ootfaDrauesls0t2toim iu1lpe mnvt (fsDtmxmonu1aet if3tadls uau pnt4aetoio oo1omteanvols sexoxr3oo1optelfeilsfarum(r nt4texn fciaslmDemuvsnt0 eeoir io1op  lieolt) 2xmiopiudom  lict (f 2tmx  nu4tpe mo3ils s2raumo t0tlxrxo iydop rli o s s2urxm3oydoleemivsltfaDurur ;o4tpen ieiadlmDranmp u0trerioctatlaDe i s s tetoxrpoo1lptnlietlt)aDta(rooo0aetnio3iysfs elnmpn(4 rtrmfctodla rlnes;()srtriopoudopeelnesltf Drrumoot4tlenmiciytlm rlnmpn(0tlxnif3tydlaD  uesl() 2urxm3iydolt lici (f 2ra(r oo1opeo f3tydfsDea(vs;t0treoxfcoo1lmtraneo;s)setoxm3io4op n fviasfaDrr(r no0aptnii3iaslsDea(vo () rxoxociydomt lnei t)s2trio3ou1ole mneia( aDra(r ot0oltoiocilsls uln snu0treoxocoo1fpDrluvs;( trxmirpoydapen iet tf 2ur(r ;u4oetomictasfs2elu p;() rtoxr oy1oa   nvs;( s2tmim ou1ope lfetas artax poo0tlxo f3tlt a2rlnvs u4artnxociydlmDranvo s setriopnydol elfvtlsf 2uaxmo;o4olxn oetls a2ea(vp;(4tltnifcoytom r ivs t s2to(r iy4alt  fvilsfa2urum no0openii3iyt s2uanvsn(0texrxf oadlaD lues;(0texoiopou1apt lfvsa( a2rrx pnt4opxo o3ils m rlnvs;t4trenmr iadlp r i o (0setm(r3ny1amte iet tfs2um(m oo1tltn i3ilsfa2ra(vont4teerio3tytfaDelues s0 etm(r iy1lm   fet t a2rmurpoo4tee iietydfsDrlnvp;()tltrif ty1faDeau olt0 2uo(m oo1lleelnes t  Drrurpnt0optomf3tlt sDum(vs;(0artoio iodlaDr ueol(0 2tmxm ny4lmtn neiltfs2rr( pot1oltnmi3ildlmDrau o (0tlenxfciadfmtrln s;t) 2xoimpoy1lm emivtl()s2trxr ;u0tlxnmfeiltfa2ran s (0 lenmr oodfatrluei ()t2tmim ou1al  mici ( arumxr ot0ale mictatfm2ea(vsnt)tetnir3ia1lat  nei s0 eur(r oudapenlicilt) rumx p;o1opxomicild aDemu o t4 etoio3oa1laDe u slt0sruoirpio1olen feia(  2umxm ;u0openmi3tlsfm ran s;u) rtnmr3to1fmtean s ()sexo(opoo1ap e nvs ()artaxroou0ape  iciysls2el(vont) rxnxf totopte iesl( srxrim3iu4ll nmnesls arraxrpno0ole mfeias a2rmu o (4tlenxfcia1laD lnei;(0t2xr(m3iy4om elfvtltfsrrm(mpnt0olen ietlslsDea(mon(4tltrmociy1lmDeanvilt  rtmim3nu4lme  fct s)aDrax  ;t4aet if3tas sDul( s t0 renifciytopt  neo s0 exo(m nu4opeemfvil(f Drmuronu4oeen i3iaslsDumnmon()aeerifctodfp rai i;t0trtoio ou1amen fcsls a2
\ No newline at end of file
@@ -0,0 +1 @@
+ivi;t  etmxo ny4am n nvsas  2rrxrpou4apxomf3iltfaDrl( p u) rtoxo ty1fmte nes t)s2xrim iu1omt mietlt)srrrump;u4ape io3tysfa2emu snt4 ltrxf3oydfaDran sls  eur(mpio1lltnmnvsls)srtaxmo;u1apeoiietydfa rmu o;u) ltoxfciatop   ieo;t trxm(r3oo4omtelnvtasf rtmumonu4aetnif3tytls rl(vp;u4teermf totfpDe ivo;s)texmxopiy1olenmicsl() ruru poo0oet ifctytfs ul( on()artnxr3oydom rlieslt  rxoim oodlpte nvils)artaum ot1oeenmociad s2ulu snt) rxnmr3iadomDe uvils)t2uoxr3nudlmtelnctl() Draxrpnt1opxniicildlsDul(vo u)tlerxfcty1oate nei s) 2xmxr3oo1ole micils s2tmxroou4tpxn i3iadfs2umn p;(0 lxrmfcoadfpt  uvols)t2xoxrpou1ol e netat) Drrurpnu4tetoifciyt sDea( pnu0teenxr3oydfm r nvi ()s2um(mpou4opt  iciasfsDta(  no0aleo i3tltlmDea(ms u) lenxr3oadfa ran sl(0trxmxrpiodomt licta() 2um(m ;t1tetomociat m uln s u)trxoxf3oadfm  livil(  2ur(r3oy1lm  mncslsfa2taxrp;o4opto ieiys s2raumo;u0 exomo3iotfmt  iei;t  rtm(r nu4lm emnvil(  2rau ooo4oetoiictad sDemnvs u)artrxr3oa1op r ueols) exoxo oy1oleelnvslt)s2tmuroou4openmictyslm2eln on(0trtoiocoy1oat li sls)tetmim ny1olteliviltfartmu oou1tpenmociatfm uau s;t) ltrmr3ta1om rluei;s)s2xrio3nu4omtnlnvil( aDuax  ;u1aexn f3ilsls2ul( p u) leomf oodom  lueo (0teurio3oy4aptnmnvia(f rra(rp;t1oltn ieiydlm2el(vp () ltrxf tytoaDrlnvo;(0 2tmiopoydopte fci s  Drmur nu4tltnifctydfmDea(mp;t0tetoio io1omt lu o (0teur(m3oo1op elfvi t)sDta(mpno0opxnmi3iatfm2rmums ()tetnmf3ty1latean sls) rum(m3no4ol elneslsfa2trxm ;t4aptn icilt sDrmu s;()aeenir3iytlatrau s;t0trurio3iydlm nmietat  Dtaum no1tpen ictys m2ulu p;t)aleomocoodoa   ues;t)trtoim iu1apeelieils)a2umu  ;o4tlenmo3tatla eluvo t0 ltrmoctytlpD  i o s) 2trxrpoo1amen ictl(f Draum ot4oexoiietld m2rmums;t)altnir iotfa  aies;t t2tr(m3nydopenmivt ()srumurpnt0oltnif3iasfa2rlumon(0trtnxr oatlpDr ieilt tetmxm3nu1apenmfvs (f Dtm(mpou4aet mi3iadfmDua(mp;u4alxrxocoo1fpD ln i;t0t2xrxm3no4llt  nci tfa2urxmo;o1altniiciat m ra(ms (0tlxrir3iatlpD  uvol( texmio3oodopeemfet (fsrrrxm ;u0aet ioctlsfa2ra(mont4tetrxocoytfpD au ol( seurxo3ou4llte ivi sf rua(m ;u1tltnmo3ildlm2ra( o u) ltrmfciytfp eli s (  ruoxo nu4ol nlivsls aDtm(r ;u4opt mietatfa2emuvo u0tetnxo3todfmDr u o;s)srxoxopoy4amt  iesl() 2uaxrono0tex  octadfa2rmnvs;()aexnifctadlmteaieilt0t2ur(r3iodll elfvs s)srrm( o;o4aptomi3iytlmDea( o u0arermr iydfmDr nvi;s) rtoio3no1amt lncs t  rtaumo;t4aleoii3ild mDumuvon(4 eenmoctydfp elu ils) etrir nodamenlictl(  Dtax  ou4oltnioctyd s2uln s u0tlxrir3oodlaDe n o t)tetrxo nydoptnlfcsl(  rur(m no4tpt iicilt mDum( o u0 exnmfciy1fa eau il() euoxm3oy1ape mfet s srtmu ono1alxnifeilt a ean o;t)trtomf ootfatraieils) 2uoxr no4ameemnet t)a2rm(mono0oeeniicildlmDel( sn()tlxrmr3oy1fa eaieils0t2xrim3iu1olenmivilt aDuaxr ot0tle  f3tlsla2emu o;(0trenmo tadlmtelneo s) eurio3oodapt mnvtas srtrurp;u0apx iocild a ea(mont4 ltnxo3to1oate ies;t) etrio oy4altnmfciatf 2urxr ou1optn o3iltlaDulu s t) exnxfcty1opDrlnvo;s t2toir io1op  mivt t sruau o;u4aeen i3iydfmDrm(mo u0aexrifciydomtranvsl(0srxmim3iy4alenlfctl(faDtrumoot1tee mieiatla rl(vp ()tlerir3io1fmDelues;s) 2xrxrpnu1optemfctlt) 2urxm ot1aeeoif3tasfa2ul(vp;t4areoxrcto1fp raneols0teuoxrpiy4omt mivt ()aDtrxronu4alxnii3tadla eanmpnt)aleomrciodfmte nei;t) rurio3ou1lltelfvil()srraxmont0apt  i3tat sDelumo (4tlermo3tytla   nvi ( trur(r3iy1lm nmnct tfs2ur(rooo1aeenmocilt m eluvsn(0aeeomrctotfmD lnvilt)srxoxmpiu1omte iesltf 2trx o;o0open oeils s ra(mp;t)tltniociadomtelneilt  rxr(o oodam   fvtltf Dumurp;o0ape ioeiytlaDrm(vont0 ltrmr3ia1lmDeln o;t  2tm(mpoodam n feilsfs2taumono1tet  ociasls uau sn(4treoio3iadlaD  u slt0truoxopoudapt mnes tfaDrrumpoo4tltomietyd mDeanmp u4 rxrxf3ty1fmD  ueols texoxm io1lmtelncs tfsrur( ono1opxo oetyslaDrlu p u)trxomocoadfpt  uei;(0trtrxm no4amtemicias)s2ua( pou0olx mf3iad m2el(mp;u0tetnmo iatfpDrlnes s  rxm(o iu4ope  nct t) Duauro;t0olt mo3ildlmDeaump t)trxnmr3oodfm eluvslt0truoxrpou4ape mfetls sDta(rp;t0aptniociadla ran snt4alxnio iodopDelnvo s) exmxmpnudolen nvia(f 2rrxrpot1ale  ociltla rln sn() rxomr3to1fpt auvols0s2tm(opnu1llenmici () ruax onu4aptn ietydla2emu o;t0tlxnircto1op rai o () exmxr3iodalen ieils)a2umxrooo4tpxnifeiyslmDumn p u0tltoifcia1omtrauvslt  etmxrpoudopee nei t  2tr(m ;t4tptniocildfs ul( on(4aleoir iydfaDeai olt) 2uoir3nu1ome livi sfarrmxrooo0ope mi3tldfsDuau s t)trtnxocoatlm raiesls s2to(m3nu4ap nmnesat  Dtrxmoou4olx iietls m2uauvo;t0 reniocoydla r u o;s  2xrxopnu1am nlneia(f rraumont4optomoctls a eln s t)tleoxfctytla   n o;( s2uo(r ou1amtnlfctatfa2tr(r ;o0alen ictadlsDrm( pnt)tltrxr iadfpDeai ols t2xoio oy4om n iet s) Dtr( o;o0opx  octysfa2rm(vo () leoir3iadlaDeauvslt)tetoim3io4om nmicsasfarumu pou0tleo ieiltfmDranvp;(0teeoxf3oo1om eln o;( trxmxo iydame  ivi (farrmx  ot1aeen o3ildls2ea(mon(0trtrir3tytoptelnvi (0teurxm oydol nmnetls) rurxm ;u1apto f3tyt a em(vs t) rtnmocoadfa e u sl()s2xrio iydlp  lfvi s  Dtm( pot0aee mictlslmDrmn onu0aetrmfcto1la r i olt trumiopoy4lmeemict s a2tm(rp;o1tee iociltfs2umuvo;t0altnircoytfa e uvi;s0seumxmpio1amt lfei s aDtrx  ou0tptnii3iasfa ea( sn(0tltnmocootoat lnvol()s2xo(m3iu1lme  fetlt s2tm( pno1tee if3iyt s ean o;t0areoxf tatla  auvsls)sexm(r iu4lmtelnctas)srraum ;t4olt moctatla2ua( p;t0aeeoxr3totopt lueo;t)t2toxrpiu1ame livi t s2trumooo0apx iiciatfa2rl( o;u)texoxfciotla e i o;(0 2toirpoydal n fvs s  2rmurpnu1aptomieiydlm uauvonu0 renxf oa1la  aivi;(  eum(o oydol   icta( sDuaumpno4opx  oeiadlmDraums (4 rtrmrcoa1fmDeai ilt)texriopiu4alenlieilt)s2trxrpoo1apto octytlaDulnmp u4tetnif3ty1fate uvs t0srxr(m ny4omen fcsas srra(mpot4olx  o3tyd s ua( o u4tltrxr oo1lmDe ueo t)t2xoxopiy4ll e ncta(fa2rmxmooo4tlx moetytfmDeanvsnu)tlxoxocoatoaD  nei t0s2umim3iodaptemies t srta( p;t1tpxomfeiyt sDumumsnt4areomr oadoatraneolt0texoirpoo1oltnlfcsls  2rrx  ou0aee iieiys aDrl(vsnt)aeermf3iodlatr uvi ( s2urimpoy4ome  fes (farrmx o;t4apxoifeildfs2uau s t0aetoifciydoaD aieo ()trxoxm io1omt lncslsfsrtaxm ou4alxo i3iys a ulums;u4 rxniociadlpD  i i t texmxr ou1lpe  fcsa()aDtruro;o0tlxomoeiltfs ulumonu)tlxoir3iytom eauvi;s) 2xoimpnu4lp elfetl()a2taum ;t4alxnmf3ilsfs rm( pnt)tlxnxrcio1oatelivil()srxo(rpnu4omenmictls  Dtrurpnu4tlx miciydfaDrlu o;() reoxfctytfptrlnvs;t seumim oudlpee nci s  2trumo;t0tpeomfetys a rlnvp;() lenxr totoat an ol() 2uoxr no1llenmnet t)sDum(  ;u0apxnmoeias s uan o;t)aexnir3ootfaDr ueo;t t2urim3oy1am emicslt) 2rm(root1opx  i3ildla2eanmpnu0trxoxrcoo1lm e neil(0seumimpio4oleelfcta()s2rm(rpot4teeomfciytls2uan o t4 lxomr3iydom e u s;s srxo(m3no1al   fcils)sDrrxro;u1alxn fciadfm2umu s t4alxoxo3oa1fpt lnvs t)srxrxm3oudlmtnmfvs t s2tmur ot1aet  fciatls2rl(mp u4trxnxfciy1faDrau i t)s2xoxopnu1apeelicilt)sDtmx onu0altoiictatlaDumnvsnu) etoxf oydfa eaieo s)s2uoim3nudapt  fei tfarra(rp;t1teeomf3iytls2ran sn()aexomfcootfptrlnei (  2xm(opoydol emietls aDra(  nu4oexo f3ias s2ranvp u0tetoxf oo1fpte nvi s0trtmxrpiydamenmneia( sDtmurpot1optn oeilsls rauvs;()alxnxr3io1omteaivi;(0 rxrio iydap nmietl( arra( pno4openmi3tat mDean p (4 ltnmr iadlatrlu i;() 2umiopiydll e nes tfartauront0tpx  ieias m ranvsnu0tlxomo3todfmteauei;s0 exr(m3iy4lltelfcils) rtmumont0altnmf3ilt a2elnvo;(4aleoiociodlaDeaivo;(  rtr(mpoy4omt micias srtru p;o1alx  i3tltfm em( s u4aeenmr oy1lmtelivi t0t2um(o3oo1omte feils) 2rmx  nu4apxnif3tlslaDrm( p;t4trxrmociodfmDraieo t)t2trxm3nodll e ictatf Dtaxr nt4aexniocildlmDumnmp t)tetrxf tytomt ai s;s s2uoir3nu4optemneiat aDuaumooo1aleoii3iyd sDum(mo ()tlxnmf iy1oa eluvil( srur(rpoydoltnlfci t)srraxro;u1opx ioeiltls2eluvpnu0 lerxfcoodlp r n o;s0truo(rpiu1ap   nesat) 2ta(  ;u0oex  i3iat m2elu p t)treoxr oa1omDelivols) 2uo(r io1lmtn ictlt arumxm ou4tlenif3iytlsDrlnms;t0alenircoy1fa rli o t s2urimpnodll   fvt s  Drru p;u0tet mieiasfsDra(vsn()trtrmr iydfptrlivs t srur(m3no4om e ivtlt s2umu pnu4opeomfetltfmDranvs;t4aeerxo totfm  lu il(0tetoimpnydaptelncil( arumx pou1tpx mo3iytls el(msn()tltoxo oadfpte ieslt0s2xr(r io1openlfvs ( srumurpno4apxo feiyt s2eanvo u)altrifcoo1fpDeau o t0teumxm3ou4ap n ict (farrr(mpno4tlenii3ias m2ea(ms (0 lxnif iadfpDrli s s  etrxm nu1olenmivtlsfartr(mpnt0tpt  o3ild s2ua( s u) lxomf oydoatr u o ()texmiopoudlmtn nes sfarrmu pnu1tpeo oeils m um(vo u0aexoxoctydfaDran s s s2uoxr iydolte nvs (f Dtaurooo1tpxn icilt m2eanmpnt) etrmf oa1fptean sls) 2tmxr oodlpen nci (f Dum(ront0oeen f3tatfs ra(vo t)aleoircoydom eluvs ()sexmxopoy1ome  nvs s s2tm(r oo4aexnifctas sDuau onu)areoif3iadlmD liei s s2umxo oodlmtemnes tfsrua( ono1oetnmfeiytfa elu o;t4 ltoio io1lp  anes s0srtrio nu1aptn ivt t  2umxm nt0tetoiiciytfmDrmnmo () leoir todoat lnvo s) 2xoio oo1om   nci tfarraxmpou4apeoioetysfa uanvsnt)trxnir3oodfp ranvslt0srxoim no1amte ncs sf 2rrx  ou1aex if3iadfm2el(vonu0aexnxf iodopD  ieols0setrxr3oydlltnlfcslt  Dumxr nu0tpen ociadfs ran o (4 etomocoatomtr i s ()trxo(mpiydamtnlfvils) rumx ooo4optoioetat sDraumpn(4 lxnif3oatfat lneol(0t2tmxrpnudlpeelneils) rrr(r ;u4tet ioeiydlm eln sn(0 rxnxf iytla r ies (0 rtm(r3iy4al  mfvslsfaDraxrono0altomietatfsDrmnvo (0trtomo3iydoaD  neols0 2xoxopnudol nmfcsatfa2tau p;o1ole  i3tatlm2emu s u0 ltrmf3iotfm r ies t0setoir3iydal nmnctat arur(  oo4oeen fctltlm2eauvo;(4 etnioctodoateaiei;( t2uoim oo4lp  lnctl()arrmu poo4aet miciasls2em(vp t4tlxoifciotfa ean il( t2uoir io4alenmncsat)a2raxmont1tltnmo3iadlmDelu pn(0tltnio3ta1fateln i;s)trtmiopno4amenlieil(fs2umxmp;u0ape mo3tadfmDuln snu)trxnxr3iytoa  au i;s) exmxo io1al emnct () rtrxm ;o0aeen ietatfm um(ms;t4aexrmo3oy1optelivi s trurirpno1am nlnesltf Drm( pno0ope io3iasla2ra(vo u0aeeomfciy1fp   ueil( s2to(mpio4ole mfvi sfsrrrum no0aetnmf3tasfm rau pnt0aetoxr tadlatr n s s)seto(opiy4al elict tf rrmum ;t4oet mi3tltfaDeaumo (0tltrxo3ia1fp r uvols teumimpoydlp nliet t  2ua( ono0opt mfeiysfm2eauvsnu0arxnmo iadopD lueil( trxr(r no4amtemnei s s2tau  no1aptnmociys s emnvp u4arerifcoatoatr uvs s0t2umxrpoudlptemncsltfaDta( poo0alenmfeiatls umnvp (4trermociotopDrlivi;t0 exrxr iu1lmenlnvtl() rur(monu0tlto oeiyt a2um(mo ()artoirctodfm   u sl(0sexoio oo4amtn nes t) 2tmx pnu0aexn icild sDuauvsnu4 exrmr3tytoaD  nes;t0 exr(rpoudomt licia( a2uaur nu1opeomicils s ulu p u) ltrxr3oo1lmt lieols  euoxo nudlleelivi t)aDrrurp;t4tlxn ieiadlm2ranvp;t) lerirctadom eluvs s  ruo(m3iu4am   ieia()arrmx ont0oexo fetydlm2umnmo;(4aetnmf3iadlaDeaieols seur(o3no1lpeemfesl()aDrr(rpnt4optomiciytla2ean ont0tltnxo oytlptrauvilt0 etriopiydaltemnvt t  2rr( o;o4tet micilt mDumnvsn(0 exnxf3tatopte n o;t0teuo(mpiu4oltemnetls)arraxr nu0tetn o3ilt s2rlu s;t4tlermo oa1fat aues t)s2uriopou1lmt lfcsa() 2ua( o;o0oexoioeiydfaDulumo;(0tltrxo oadlmDe ues;s  rumim iydlpee iet (fa2ua(m nu4tetnii3iasfs rmuvp u) rxomr tydfat anei t0setm(mpno4lpe mictlsfs2rau oot1oleomo3iydlm uanms;(0 etrxociadlptrluei;()seuoimpiy4olee fvs t  2umx  ;u0aeeo fctat aDul( pn()altnmf3oo1fpDr ieols)tetmxmpiu4apeelnes () rtau ono4alxo fetadfaDrlnmp u4 rxomf oatlm   ivi;t)setoim3oodlpe lnvt ()sDrmurp;u0tpxnio3iatfa2ea( s t4aeermrcoadlp  anvs s)sexmir3oy1alte fcs t)srururpno4tex iietad a eaumo t0aeeoifctatoa elu s;s setm(rpnydll nmics t)srrr(mooo0aexnmieils a emnvsn(0aetrxo ia1lmt  neo;s)trto(m ny4omtn icslt  2rrxmoot0oeenii3iad s2rmn s () lenif iotlat  ieilt0sexoim3ny1lltemnviltfaDta(mpnt4apxniieiadlm2ul(von()aexrxf3iotfaDeaneo t)s2um(rpou4ape lnvi t) Dumx o;o1apxniociltlsDeaumo t)tltoif iydfaDranvs;t)trum(m3oo1ol n ivtlsfs2ur( pno0aeto octlt aDel( p t) exnir tadfmDrln slt0 rtrxr3ny4lptemicias) 2umu ooo1apxoiieils a emu o (0 lenif3oytfaDr nvo;( trxoxr oydap nmnct sfsDrrum oo0oet  ieilsfm ean s;()arxnmrcoo1fa e ues ()texr(mpiu4am e ietls) Dtmur ot0opeomocias a2umnmo u0trtrxo oodfa ean o s0 etrio3iudomen iet t aDraur no0olxo feiatfaDrlnvp (0trerxocoo1faDrlu i;t)trxrim no4llenlfvt (fa2rax pou1tle iictatfmDuauvont0tltrmf3oodlmteai i ( t2umim io4ol n nes t) 2ra(r nt1oex mociaslm ua( p u)aeeomr tytoa rai s;t)srxoir no4alenliei ()arrm(mooo0texn o3iasls2em(vs;() ltrircoa1faDr nvi s) etoxm ny4ome micil()arta(r ;u4olxn i3iytfs2ranvp;(0arxrmfcoatoaDrlnvi;s)trtm(rpiodlmtnmnvil() rtr(rpoo0tetnif3tydfs2um( snt4 rxnmfciatomD ai s;s) etoim oo4om nmicsl(  2uau  ;t1oexomfeildfmDum( sn(4teerxrciydla  an i (0t2toio3ny4alt mfeiasf rtaxmpnu4olto oeilsfaDelumpnu) lxrmr3ta1om eauvo t srtrir oydomen nvilsf rua(ro;t4alt  o3ias sDrmu s;t0artoirctatfmtrlueo;s srtoxmpiu1ope lnvslsf Dumxro;t4oleomf3iatlm2emnvon(4tlxrio3iatoaDrau sls)trum(rpnu4ol  livil(f 2rr( o;u0altniiciytla2ulu snt0artnmr iotlptrauvilt) 2xrirpiodap nmfvt tf 2tr( pot0tpto fctyd m2rluvo;u)teenxrciatlm  anvi;()setrim oo1lmt  nvtas  rtmumono1teeo i3iysla emnvonu0aexoio oatla raieil() euoirpno1lptelictat s2ra(mpnt4aeeomf3iyt m2uanmsnu)arenio ta1lmt  i ils  exm(mpio1omte ictlt)s2trur ;u4tlxo fcilsls2eanms t4trerif iydop  aneolt0 etm(r oudaltemicta(  rtrum ot1oleomieiasla emums t4arxoio ia1oat  ieo;t)trumir io4ap   nvsa(  2urx p;o4tptnioeiydlmDuan snu4 ltnxf3tatlm raues () 2trxo3iu4omeelieia(fs2rmxr ;u0oetomoctldls2emums u4 lxnxr todfa  ai o s teurxm oydom  mfcs s) Draxrpno4ole ii3tysfaDraums;u0arxomo tadomtraneo;s)s2umxr no4ll nlnesat)s2ur(mpoo4tle  octltfm2rmu on()texnmfcoatop  liesls texrim3oudam elnvt tf rtrx  ot0tltn f3tlt s2ea(mp t0tlxoio3oodfatraneo (0seur(m3oo1omee icsat)artmxrp;u1oee  feiad m uau s t)texoxrcoo1fpDr u s;t0t2trio oy4om nlivils)aruau  ;o4aeen ictlsfs uaumo ()trtrmf3iy1fmt an s t  2xmxo3nu4lm e fet s  2taur nt1olxomoeiydlm2eanmon() rtrmo3ia1lp eaivs;s0 exoxm3iudapt  ics ()sDtaxr ;u4alt ioeiatlaDumuvo;()altnxo totfm eanvi (0t2tr(o3no1lleelnctat  rrrxmoot4tpxomf3iydla elump;t0altomo3tydla r i ols)tetmimpnodamtnmfeiltf rrr(m nu1optomfeiaslm2uauvo;(4trtrif oydoa   uvslt)srtoxr no4amee fetlt)aDua(m nt4aptoio3tltlsDul(vo;u0trtoxrcoodfp  au i t0texrio3oo1apeelnvi s srtaxr nt0aleoif3tasls2rau p;t0artrxf3to1latrlivi t trtoxo io1ome miei ()srrru o;o1tltnmfeild m elump;t0alxrxr ta1oat lueo s  2tmim iodoltelietas aDuau p;t1tlxn i3iyt m2emnmsnu0 rxomrcoatlaDe nesls s2tmir3io4opee nvias s2urum ;t1tptomoctatfmDrlnvp (4artnir ia1faD  uvs;t)teurio3oy1ap emiesasf 2uaum ;t0opx iocilt m emumon(4 eeoirciadop r iei (0 rtrir oodamtemivsat arumxrpnu0tet ii3tyd s2uluvp;(0treoir3to1oaD an o t) exoir3nodom e ivs s artmumooo0tex  f3tldfs2ulu p u0 lxrxo3oadfmte u il()srxr(rpio4lmeemfetasf rrmur oo0tltnmiciad aDel(mo () leoxrcoa1fpt ln s s)srxmir oo1lpenmivt ( srta(  nt0oltnioeiatfs2em(vs;(0tleoif3iotoa e ivo (  rtmirpiydllt mfci ()s2tmxmo;t1oex mo3iltfm uauvo;() ltnif ootop r i i s0t2xo(opiudlltnlietas  2tmur ou4aptoioetat s rlnmo u0altomo3iydoaDran o;t0trtrir nudal emnctasfaDrrx o;u4tltnmoeias sDrluvs u4texoxo iytom r iei;( seumio3io1al n nes t)arrmx  ;t0opxo iciltlsDemu o;()trtrxf3oatfp elnvilt t2tm(rpnudlltnmnesl(f rrrurpoo1oexomoctat m2elums (0alxnif3ia1omDrlu i t)texo(m io1omtelivtl(f 2rrx pou1ole if3iasfm uan snt0altomf3oydfmDrauvs (  rto(mpno4ll nmfei ()a2taxr nu1teenio3iytls uluvsn()texnxf iotomDraueo;t)t2xrxr iy1omtn ncsa()a2rm( p;u4apxnioeiysfa2eanvpn()altoifctodla  lnvs t  2trir3ny1lpt  fetl()aDtaxro;t0aptnmiciysla2el(ms;t)tlxnxoctydomD lieolt)srxoir3oo1ome  neilt sDtaumpnu0tpe mi3iat s2rl(vo;(0arxnxfcto1fpDrlnvs;s)s2trxm3io1llte icsa() rraxrpoo4ale mfetadfs emu p;u4trtnxo tytlaDe n s () 2trio oodal e icsas s2ta(m no0oee ioetadlaDem(von(0 lermrcto1opD  u s t0 rxm(r3nudol  mnetat) rta(monu0apeoii3iasls eau s (4trxnmocia1om  lnvs t) rtr(mpio1lptemfcia(  Dtmurooo0aee mociadfs uln sn(4aeermr oodoat li o s)t2xmxr iydlpeemfvi (f Durxrono4oex ifcildla2uanmpnt4tlenmr3ta1lateaiei (0t2xo(rpou1altelfesl( s2umx onu1apt ioeiatlsDemn pnu)altnmfciodlat  iesls0 rum(o io1ol  mnei s sDur(mo;u0apxnif3ildfaDrauvo u4 lxoirctodopDrlnvi ( tetoim ou4ame mics (  2raxmpnt0tlxnmfeias a2elnmsnt)tetoiocoydfmtrau s;t) rtrio3oy1ape mfvslt srur(rpnt4tpenmfcilt mDrauvp u0alenmo totomt  n ils trxm(o oy4ale lietasfs2tm(m no4oetn feiasfm umuvp;u)tetrxrctatfa eanvs;(0trtoxm ou4optnliet (f rtmx o;o1optniiciat a uan o () lerifcoytom  anes t0 etmxr3no1am  lnvslt a2umum ;u4ape mf3tld mDea( s;u0 eerxocootopD  nes t0trtoirpoo4lmtnmicsl()s2rmurpnt4apxoif3iad a emuvo;()tetnmo iadopDranvsl() rtrxm3iodome mnvias) 2taum ou4tpxnio3tys aDrlnvon()tltrmo io1lpDeluvslt) ruoim3ou1aleelieils artm( poo0olt mfcilsfsDrl(vsnu0 rtrmo3oodfp  lieslt)srtrxmpou1omt  ietl()s2tmu pno4oee  ocilsla2eauvo;u)aleoxfcoydfpD luvo s)seur(m3nu4ol emfeiasfa2rr( p;t4oexnmfeiat mDum( p;u0tlxoiocoa1om  luesls) etr(m ou4lp elfvtlsfarumxmont1texnmocils s2ua( onu0trtniocootfm  lnvs;s) 2tm(m ou4aptn fci sfa2raxro;t0aexomoctytfm emnvs;u)aeermo tadoaD  ues;() 2xr(o3iudom emneia(f 2ua(rono0tetomf3tyd mDum(vpnu0teeoxr3todopDelieo;t)t2xoxrpoo4ol  lfvsa(fsrurur ou1tltoiociys sDrmnmsnu4 lenio3oytomt  iei;t0t2xm(o oodlmtnmfei s aDumum ;o1aex iictadla2umn pnu) rxnmo iotomtr ivilt)t2um(r3nudome lfeta( artr( o;t0tleo octlsfa rln s;(0 rerxrciatoa rlu ils) rxmir iodoltemies s) 2trxrpot0tleo octlt a2elnmo;(4tetoif3tytomtr nes ()s2xoxm3ou4oleelicsasfarumxrono4ole if3iytls2ul(mont4treniocoytfm r neo t  2tmim ou4oleemfvtl( artmum no1tltnio3iyslm eau p u0 rtomfcoatlpDe uei;t0t2tr(m3iy4ol elfes tf rrrumpou0aetoiieilsls uauvpnu0tlerirciytfmDelu o (0 etr(m3oy1op   ieiltfarrr(rpnt4tpe ioctad m ul(mpnu0trerif iytfp rli sls s2umiopnudlm  mnesls srua(m nt0apto f3iatlm2rau p t)arxoxo oadoaDran i s trxrirpiy4apeelfes s sDua(  ot4aee mi3iaslaDra(mp;t)tlxoir3oo1laDe uvs;s)tetr(mpio1lme  netlt)sDur( p;o0aexo o3iytlmDumu s u0artnmrcoo1op  aivo s0srxm(o3io1apeelivsatfa2tmuroou4oltn feiys sDel( p ()areoio3iodfptr uei;t0s2xrxo3io1lmtnmnctas)s2tr(  nu0ope  ieiydfs umn snu4 rxrmociadfa rlneo t) rumxo3no1oleelnetas)srtau  ou4tex mfeiatlsDemnvpnu0 ltnif3ty1late neol( trxoirpoy1ll emivsls a2uaxm ;t4teenmoetyslm2ua(vp;(4areoir3oytlmteaueolt0srur(rpnodomen nvsa(  rurx  nt1tleo o3iasfs rl( o;u0arenxr3oy1faD aieil( t2xoim3nodam e feslsfsrua(mpnt0oetnmf3tlt mDuauvp;t) renxfcia1faD lueolt  rurio3ny1al nmnei t)aDraurooo4tetn f3iytfs2ul( p t4aleoxo3ia1opDe nesls0srtoxm3io1oltelfes sfsrumx pou0tltn octadfs2rmnmonu4arxomo iatfa  au s (0s2toirpnudllenlncil() 2ra( pnu0alt  ocilsfsDrauvs;t0 exoif iydfpt  ies s0trxm(mpoo1op emnvtasf Dtaxr nu0apx micilsfsDemnms;()trtoxf3ty1lpt ln i;s)t2um(o3nodal n nvi sf 2um(r ot1aetoiictlt sDuaump u0 rxomo oodfpD li o s  exmxmpiydal n ivt s s2rmxm ;u1alen oeilslmDra(ms;t4 ltnircto1fp r iei;(0seuo(rpou1ope  nvt ( sDtmu poo1texnmietyt a2el(von()aetnif3iy1opt lneo ()t2urirpoodlm n ivsa(fs2tr(r ;u0tpe ii3iadls rlu s;t)trtrif3iadfate iei t)t2xm(rpiy4lle  ici s a2ua(m ;o4teenifciad a el(ms u4teermf oatlpte ivil( trto(o3oy1lpe  nvs ()s2rax  nu4aee io3iysfsDelu s t)tltrmfctytoatrlu i s trur(rpnydameemnvsltf Duaump;u4olxoiieils m2rlu s;t4alxrmo oydfpt  uvi;(0seuoxm iy4optn nesltfsDuax  oo0aleomiciltfm2uaump;u0aexnif iadopt  ueslt0 2xoim nu4lp   nvslt)sDurumpnt0aeeomf3iatla2umnvp;t) lxomo tytlp ran o;(0 eurxopny4lpt lfesa( s2rm( pnu0opx mocildlmDelums;(4 etomocia1lmD liesls  exoxrpny1apt mncs s)s2taxr ot0tex mfeiydls2ran p;t)areoxr3totfm rluvi t0 2xm(r oo4apt mivtls sDtrumoou4altnif3tytls2umuvo;t0altnmrcoydoptranvil() rur(rpoy4lpte iesas)sDta(mo;o1alen fetldlm2eau s;(4 lxoifcootlmDeln o (  exrxopiy4lme  nvi t)aruau  ;u1optomo3tls aDua(mp t0 exrxf oo1faDrluei;s)srxo(rpno1ap   ict t sDtr(m ;u0tlxomictysfmDrau o;(4 ltoio totfatr n sl( s2trirpou1lme  ivsa( sDrmu oot1open o3tltfa2ul(mp;t0 leoio tatlp r nvsl(0sruoxmpnu1opeelncsat)arua(  ;u1oex iociytlm el( s (0aetnmf3tytopDeluvol(0texm(o no1lmeemfetl(fartm(mpoo0opx  oetatfmDel(vo u) rtrmr3iotlmtelneo (0trxoxo3iy4lpeelivils a2ta( p;o4tee mf3tat s2ra(mp;t)tetrxrcoa1lmtrlivo;( srurim3ny1ome  fci t) Dtm(mpnu1tpx  icilt m2rlump;u)areoir3oo1laDr ies;s0trxrxr nu1llte nvsa()s2rmx  oo4oetn oeiltfs eanvpn() ltoxr3tatom  ln i;(0 eurirpou4llt liviat srtm( ono4tleoio3iysfs rmnvs (4aeeoxfcoo1omteau i t s2xrxopnodlmeemictltfa2rau p;o4texoiieild a2umu o;t) rtnxocto1opD  nei t)srtrim3oodlpt  ics sfaDraumo;u4tlxo oeiydlm2rlumo;(4altoif oydlpDrlivo;s)srtmxr nudoptn iviat aDtaxmpnt4oeenmo3tltls2eau s;t4tetoircta1oa rluvo;(0s2xoxrpno4lm e ncils  2raurpou4teto i3iasla ea( pn(4arenmo oo1omD  iei t)t2to(mpiu4ole mfctlsfs2raxro;u1tleoifeiadfm emuvo;u4 rtrio tatomtraues s0t2xrim no1lm e neiltf 2taxront4optoioeiydfs ranvpnu)artnmo3ia1la e n o s)tetm(mpou4omtn fvilsfs2rr(  oo0apto fciydlmDelumsnt0 rtrxocoadlm rli i;(  rtmxopnu1lmte nvslt  2tmuro;t4ale mi3tys s2ua(mo;u0arenmr3ta1faDe ies t0s2xm(opou4ape mnctat) Dua(mpno1openiietydfsDrl(vpnt4 exomrctotomteanvi t0s2xr(r io4lleelncta(  2ua(ront1tltomfetaslm uanvont0 lerxr oodfmtelueo s s2xr(r3oudol e fviasfaDum(r nt4tlenmiciydfaDumuvo;(4alxnio3ty1fp  li ilt)sexoxr iu4omee fvs (f Drru oot4tpeoiociatfa eluvs;u4 leomo oa1fpteluvils0sexmiopio4omenlivi tfsDuax ono0tltnmo3iasla rmu pn()aleoir totlmDrlnvo;t0s2uo(m iy4ol   fct s) ruaumpno1apeo ictydlmDuanms ()aeerio3tydfmteli i;t)tetoir iu1optelnes tfsrur( pou4oltoioeilslmDua(mpn()altnxociy1laDelnei t)texoir3iy4lm elicia( sDrm(r nt4olenifciatlm rl(mp;(0treomf3ootfmDraivi;( teur(r nu1apee ivi ()artmu p;t0alenioeilsfa eauvs (4 lxrxr iadlp  auvi (0trtmxm3oodap n ivias)s2trur nt4opx io3tyd sDulu s;t0arxnmf3tytfmtrlivo;t  rxmxm iu4olenlnei () rrauroot0aptnmfeiydlmDrm(vp u4aeenir3oy1faDeau sl()texoim oy1lm elnciat s2urxrp;u0tpeoiociltfsDuauvp (4 exnmf iotoa r n o;t teuo(m iy4lm n ictltf Drauro;o4opx ifctasfa um(vs;t0aetnmfcoodom eauvo t)srxmxm3no1lm   fvi t)aDurxm ;t0aetnmfetyd s rlu onu4tlxrmf tydfmDeau o;t srxmimpoo4ape lict t)s2ta( pno4alxoifetaslsDel( o (4tlxnmrciotoat  ues;t trxr(rpiy4al   ics t) rurxmpnu0teeo ieiasfsDrauvp t)trtrmr to1lm eai il(0t2tm(o3no4lleelietatfa2tmumpou1tpxnmieiyt aDra(vo u4 eermo todfaD auvs t trurimpoy4omt mict t srumu onu4oetnio3tltfmDrauvo;t4 exnmfciadlm  aneo;( t2umxopoo1omt mivsl( aDrr(r ;t0altomfeiatls2ulu s;u)trtrmfctatop ran il( sexrxm3ou1lmtemfesa()s2uax  ou1oleoifctytlaDulnvon(0altrir tadla eanei;( trtriopiodameelicils) rumu pno1tlxomoeiysls emu o t)aetnifctadfmt auvolt0t2to(rpny1lltemneta()s2ur( ont0aetomfeiyt s2rl(msnt)aetriocoydfpDrauvo;t trtoxo3ou4omtnlictatfarrmurp;u4aptomf3iyd s2umn p;t4aexrio3iadopDeanvo;s  2toxo3ny1ap nlicil(  2tm(rpoo0opt ioctlsfsDrm( p t4 etoxf oydopteaivo;t)teur(r iy1ap e nvt sfa2tm(  no0tex ifciydfm2rau p u0 rxrxf3ootfaDr u ilt  rtrxrpnodope lfviasfaDurur ;u0tlxoif3iasfsDrmu o;() lenxoctatfat  ieil( setrim3ou1optemfesl(fs2ra(m ot4alxo ociys m2el(ms (4artnxrcoy1omDr i ols srumxmpoo1oltemieta(fsrrmu ooo0olxnifcildlsDulnmp ()trtrxf iydlaD aneols)trxmim ou1opte feias)s2trxmonu4texnii3iadlaDrm( s t4trxnxrcoadop e i i () eumio io4ape  fvias  Durxronu4tpx mfcild aDulump;u)arxnxr ty1la rlnes;s0trtmxmpou4ole liesatfartmx ono4tleoifciysfa emums t0 lerxr totlp   i ils)trtm(rpio4am   ivia() 2ur(rpot4oee  i3tydfa2ulnvo t0tltoxocootomt  nvs;t0trtm(mpiu1opte ivia()srtrumoou0olxnio3ilsfs2rmuvo u0trxoxoctodlaD luvs;(0 2tr(r oo1aptemies t s2trx pnt1opt moetydfmDeanvs;u4texnmrcoadlaDrau il( texrio3ny1optnlfeiatf Dua(mp;t0opxn fetls s2ra(mo t0tlenmf to1fmtranes t0setoim3oodoptelnctatf Dtmurp;o4teeomietld a em( o;u)tlxoxo iadlm  aivo;()t2umxrpio4om n iesltfartm(monu0aetn iciyt a uaums (0treoxr tadlmte u o;s) 2ur(r iudlp nmnet s)aDumu p;o0oetoiieilslmDem(mp;u)aexrxf3oydfa elues;s)teur(m3ny4om n fvtl(fa2um(rpnt4alxo oeiytfsDuan sn(4 ltnir3iy1oaDrluvo t) rxo(o iy4lpenmfvsls)sDraxr oo0oeen fctat m ua( o u0 leoio io1lm   nvi (0teur(rpnu1ap nmnei t)a2taxro;t1oet  ieiad a2rmuvp;t0arxnxo3to1oa   i i (0 etmxr no1lptnmfeiltfa2urxmont1teto i3tatla ulu o;t4 ltoif oodlmt aies t0s2uoio3nydam elictlt s2rax pot0olxn oeiltfa2ra( p u)aetnmfctadfpD  nvs (0t2umxo3iy1lle mivt sfaDtrxrp;o1alxnifeilt s2rl( pnu4 eenmr oadom  an s;s0texmxr oudop nmivslsf 2rr(mpnu1ape  feilt a2em( on(4tlenmf oydoptran ils  euoimpny4ol  micsa( a2tmxrpot1alen ocildla umn o t)aeermfciadlatr nvs;(0trtmim3nudop n fvsa(  2trxm ot0tet  ociysfsDua( s t4aexnxo3oa1om r i o t0t2tmio iu4opt lfcs tf Dum(mp;u1ope mieiys m2rmn o;u) eenxrcio1laDelivils0tetoxm iy4amtelfes tf 2rrum ;t4teto ieiadfs uau o;(0 lxnxocoo1lmDrauvsl( s2toxm3oodlleemictl(fs2rmur ou1aexoifctlsla ua(vp;u)tltnir3tydfp e nvi;t  rxm(o ou4lp nmfvil( s2trxroot0apxo ieiltls2raums;u0 rtnmo3tatla eai il()tetmiopiudomenmfcs t)srrrxmo;o1tpe  ieiatfs rlu sn(4 rtomf3iytoa   nvi;() rxoim3nudamtnmnctlt)a2ua(r oo1openii3iydfm2ea(vs;u0tlxrmr ootom e u o s) etoim3nu1ameeliei s s2tm(mpno1tpxnmf3iltfm rmn o;u4tleomf3oy1om eli o t  euoxr3iu4opt mnci t)aDrmum ;u0oexniieias s2el(vonu0 etrmf3ia1la r uvolt)srtoio iy4altnlivt t) rrrum ot0tlxnmf3iltfa2rauvont0 lenmf ty1omt auvo;(0sruoimpio4ape lneils aDtmurpnt4tlt mfciytlsDrlu o;t4aleoxo3oytfaDeai i;t s2xo(mpoo1lmee fet s)arrmxrooo0olxnii3iltfa rluvpnu)trenmo io1oaDelivols)texrxopny1lm nmivsas s2rrxrpot0tle  oeiad s ea(von(0 rtomo3iy1fpteaueilt0 eumxr ny1olee fei ()aDumxmonu1opxomfciatfs2rmumon() ltomr tytlp e u o;s srxoiopno4lpte ivs s)a2uau oot0tlxoifeildfaDrmn o;t4texrxr3oa1lptrli ilt)sruoio3ou4lmenmncslsfaDtm(mo;u0apen ietldfm emn snt0tlerxf3tadom  lieo;t) rtm(o oy1ll n nesl(farra( oou4teto oeildfm elnmonu0texrxfciotlptr ivi;s0s2xr(r3iu4ll n iei sfaDrmum oo0oeenmoctldfaDranvo t4arxnxf3oo1oa eluvi s)srurio iydalenlfvsas) 2raxr nt0tptomi3iydfs uanvp t4artoio3tadlaDe nesl(  rtr(m3iu1al  mfeta(faDtrxmpnu1opxoii3iydls2rau o u0teeomf3ia1lpt auvol( trtrir iodll  mnvt (farrru o;u0tpen octlsls umn o;t0aetnmfcoodoaDe nvo;s0seto(opio4apen fes s s2tax p;o1opx  oeilt s2um( p (0tetoxo oo1fa rauvi;s)trurio nodom emnctas sDrmxmpnu1texoio3ilslm rauvs u)altnmocoatlpt livi s s2uoxrpnu4alen ncs t  Durur ou1alxomicilt m2umums t) lxrmfcoodfmtrlies;(  2urim3nydlpee feslt  2rmurp;o1tpxomoctlsfmDrl(ms;(0 ltomo iytlp e nvi;s0 exm(m3nu1lmtnlfesls)srrmum nt1teen f3iyd s rluvsnt4areoxr3oodopDrlnvols)t2urio3io4olt  fvs ()srtmx  oo4tptn fciasfm uau o ()tlerxf3oydoateai i;s sexoxmpiu1am  liei t) Dtrxm ;o4aet  fciat m2em( s t0 rxrxfciodlmDraueo;() eto(r oy1aptnlneslsfartmu  ou4tpeo ocilsfs elu s u0 eenxf to1faDr i i s)trtmimpiydap n ivi s)artmur ot0olxnio3iytla2ean pnt4trxnmr3tadoa rlivo;t s2umxm3nodop emivs (fa2uru ont0tet moctysfs2rlumo;u0alxoxf to1oat  i o;(  2xmirpnu1ol   iet () rtmxmo;u0alt ioeildlmDranmpnu0aleniocia1omDe u olt)t2tm(m3oy1lp nlnvt t aDtmx ono0tpxn fciydla2emnmo (0 rxnxo io1fa   n s;()s2umxm ny1lleemncslsfaDrru p;u4tltomictat a ea(vs (0 lenmfciotoateauvs t tetrxmpoo4apenmnvsa(  Dur(m nu1teenmoeiatla ra( o;(0 rxomo oydfmt ai il(  exrxo3io4am  mieils s2urxmpot4tpenifciatfaDulnvsnu)areomf oy1oat  ieo s)t2tmxo no4al  micsls  2tmxm ot4apxnifcils s el( s u0arxnio iy1laD auvs s)t2toxm3nydap  livtltfarurumoou1alx mieiasla ul(msnu0 lxrir3tydlm  an o;() rxrxo3oodalt mnesl()aDurum ou4tpeomieildfa rauvpnt)teenmfctydfmDr uvsl( t2xoxo nudaltn ncs sf rtm(roou0aexniietyd s2emnvp u)artniocoo1oa e u sl(0 2urxr iudlmee net () ruaumpnu4opt  ociatls emuvo t0arxnxocty1lpDrluvilt s2urio3ou4omee fvtlt)sDtmxm ;t1tpxo iciysfs2umn snu) lxoxo3iydfp elnes;t0sruoxm3iydale mivsat)arrax ono0olt moeias s2emn s;u4trtnmr3oydfpD aiei;t)s2umxm3ny4oltelnvi t)sDta(roou1opx  o3tltlmDrlums t4aeenxf totomDr ivilt srurio iy1omenlfeil()s2ur(m ;o4apxn o3iat s ulnmonu0tltnxr3totlmt  n o (0setrxr iy4ale mnvtlt sDtmxm no4tpe mfctatfa2uau ont4tetrio3oydoate u o s0 etmxrpiydoltnliesat)aDraumoou4aex  f3ild mDemu onu) etrmr3oytlaDelnvi;(0t2trio3oo4llte ivia()srrmxmoot1tpxnii3tldlmDum(mo u) reoir ty1faDe nvils)t2toxo nodamee neta( srururpot4aeenmoeiatfa2rlnms u4aeeomo3oa1la raivo;(0t2urxmpio4amen feils aDuau p;o1olen f3tys aDea(ms;u)tlerxf iadlat anvs;s)s2umio no4om   fes tf 2urumono1opt  fctadla ra( p t) rxrmo oadlmD au s ( truoirpny1ap nmnvt (fsrraurpoo0tlxomfciltfmDumn p u0tetrio3io1omD ln sl(0teuoir3oudome mfet t  Drm(mooo0tpxnif3tysfs emu sn()tltnxf3ia1omDelu s;s0 exr(r3nu1ll n ivt () 2rrxmpnt4teenmiciat aDuauvp;u4aeeoxo3tydfaDeaivo;() exoiopoo4lleemiviasfs2rrx  ot0apeo o3tlsla2el(vp;()aetrmo ta1lp e uvols0 rto(m oo1op emfcsatf rrax oot0tlxoiicilsfm2eln o (0trtrmo3iadfmt ai s;( tetoxopou4ameemicil() 2umx ont1aee  fciltls2rmums;() lenircoatom eliei (0srxoxo no4om  lics tfaDum(  ;o4apxnmiciyt s2eanmo;(4trtnxociy1opDr ieo t  etoio nudal emfetat sruaxroou0opeo ociytfa ua( p (0alxnmr ty1lmD  u ols)seuo(m nodlmen iciatfsDrmu  ;t4apxnmfciyt sDua( o;t) rermo3iotlm ranvi (0 eumio oo1omeelfet s  rraurono1aex  o3tlsla2em(vp;t0 etnxr iatlm eli il(0 rxrxr ny1lmtelfvt () Dumu  ou4tptomociadla2ra(monu)tetnxoctatla raneol()seuo(rpiudap nlnvi t  Drm(  ;t1alxnii3tlslm rluvo (0 lenxr to1om e nvo (  2urxo no4ol emfvsls) 2trxronu0aet  i3iasfaDrmump;t) eenircoatlmDran s;s)t2um(opno1openmfct s) 2rr(mpot0tlxomoetls m2rmumo () rxnmr3ta1laD  nvils  exmxo3iodamenmfvs () Drmx pnu4oeeoifctat m uanvont)arxnmo io1fm   u s;t)s2xmxo3oy1lleemivil()srta( ono1aexo ietasla ra( s ()arxnmf3iadoa rlneslt  2urxrpoy1aleelivsltfa2rrxrono1aetniocilt s ul(ms (0 rtoxo3ootopDrlies;t srur(r3oy4ll nlivia(  Dtr(m nt1ole ioetytfaDrlnms;t0teerio3iodfa eai o t0s2xr(opnudoltnmfetl( s2tmx ont0aeto iciat a2ulnvo (0 rxomf3ty1lp rln ils)truoxo oudome lnvil() Durxmooo4oexomoetyd m uauvp;()tleoxfctadopDelnvi;t  rurxrpio1ale  ieslsfs2ta(r ;u1alenioctyd a2eaumonu4tlenio todlaD li i ()seumio io1op nmivs s  Drm(rp;o1tleo oeiytfmDelnvs t)aexomfcootomteai i;t  exm(m iy4lm nlnctatfa2rmxro;t4oet  ieilt m2elumo;u)artrxfcia1fa eai s;s0t2xm(rpny1ope mivsa() 2tr(  nu4ope ioetasls2ranvonu4aleoio3oytlpD lueil(0 ruo(o oudopee ivsa()sDrrxro;u1opx if3tytfaDrluvp (4tltrmocoa1fa   n s s srur(r oudom   ivi tfa2urxm ;o4tleomi3tys s2emn s (0 lxomfcia1fateau o;()s2xriopnydamen fcilsfaDtrxmoou1alt ifeild s2elu p;u)teerxf tatlaDrluvo;t)trtoxr3iy1omenmiesl(fsrtaur ot1alen fcilt s rmn s;t0trtnmf3oo1lp   i sl(0 exrir3no4amenmfcsa(f Durum ot0olx ii3iadfa el(vsnt)trtoxrcootoaD  ieo;t0teumxrpnu4lltn nvta(f Drm(mo;t0apxniictydls2ul(msn()teeoxociytlmtrlu i (0tetr(o oy4lp emfvs ( arrmx p;o1altomo3tlslsDeln onu4alxrmrcoo1fmtr i s s  etmxo3io1amt lics sfs2raxr no1aeeomfeiad m2umuvo;t4 rxnirciadlptraneolt srurxo3oo4optemicta( srur( pnu0alenioeilsls ra(mo u0alxomfcia1lm ranesls texrxrpou4oleelnct t  rurx  no4opxomieils a2ean o;u)tlerxfciytlm eai s t t2urxo nu1lpt  fvs s a2rr(m ou1opeomfeiasla eanvs;u0 rtomf iytlp raivs;() exr(r oy4lmtnliet s sDtru o;u1aeeoifctysfa um(vp (4aetoiociydlmDeau ils0s2toirpoy1alenmnvt sfartmu ont0aleoiiciyt s2um( onu0teermo tatfaDeaueslt trur(o3oy4omtemnesa(f rrr(mooo4oee mi3ildlm elumo t4artrmo iatfpDeaies s t2xmxmpou4lmt mnvilt srtr(m ot1oeto fciydla2umnmpn(4trxnmfctatlaDe u o;t)seum(r iu1ap emnvt sfa2ra(r oo1tpenioeiysla raumpnt0 rxrxf ia1fmDrli o;s0srxr(o io4llt mietas)aDurxmont1tpe mociatfsDuanmpn(0tleomfcia1faDrlues t) etrio no1ol  liesat artaumo;o4aptomoctat m rl(vs;u)arxoir3iatfmtranes () rurxmpny1ap  lici (f 2taxm ;o4olt  ociasfm2umump u0artrifctadla eli sl(0s2tmim3iy1ol n iesl(f rtaxroot1apeoiictys sDrlnvon(4artoxfciytfmt lnei (0 euriopiodopt  nes tf rtr(mo;u4tptnmf3iysls rau o u0tetrmrctydomDrai o;t t2uoiopiudlpe lfetat a2tax  no4oetn f3iyd aDeanmo (0areniocoydomDeaivs;t)teumxm oy4optelicils  rraxr ;o4tpxnifctyt m2ranmo (4artrxf3oy1fmD li s (0 rur(opno4opt miciasfs2rau  ;o4aptniiciydls ranvs u) eeoxrciy1laDe u s;( s2xrio oo4lleemfetls)srrmu onu4tpenmieias mDelnvp;u4 lxrmf3iodoptrlneils0t2xrimpoydal emietat)artrumpnu0oltniieild m2elu p;(4trerir3to1fa eluvolt)srxr(mpnodalte fciatf rua(rono0ole  i3tlt aDrmums (0arenmrciytlat  u ols0t2tmirpnu1om emfvsasfaDtruront4tptnio3tysfa um( snu0 eerxr iodfpDe nvs;t sexoirpnu4al  mfcsat) 2tau onu4oleoifctld m2rauvp;t0 etrxo3ia1lpt ln i;t)setoxr3io4ll   net tfsrtmx pnt0ole ii3iad s um(ms;()arenmo to1fm e nvo;t0tetmio no1am emiet tfa2umx  nu0alt iietysfa2ra(vonu0tlerxr ty1opDraueol(0srtmim3iy1lmeemfvta() 2ta( p;t4tlxnmieiysfa elnms (4trxrmr oy1lpDrai ols teuoxopoy4oleelnct sfa2umu o;t4aetnifciat s ua( o;(0aexnmr3oydopt auvolt sexm(o3iy1llt mnes sf 2uau  oo4ole  ictltfa eaums;u4teenmo oo1fm  li o (0 2xm(opiydomtelfeilt s2uaurp;u0alxnmiciltlsDrlnvo t0 rtomf3iatfmtr i s;t0 rxmim nydapeemnvs t aruru  oo0teto o3tytlmDeaums;(0 ltrmo3tydfpDr ivs (  euoirpoydap e ictl(farraum ou0oet moeiyslm2elums;t4aetoxrcoo1fm   nvs s0s2xr(m3iu1ol elivsa()a2uaumpnt4oex iieiatfa2um( o;()teeomrciotlm eanvolt teumiopiydam nlnesls)arrauront0alxniiciydfs ea(mp t)alxoiocio1fmDeanvslt0srumxo iu4llen fvtl(f Drr(m ;u0alxnmoeiasls2em( s;(0alxoio oy1lmteau olt) 2xmio3nu4ll  miesltf Drm(rono1altniieiatls2ra(mp;t0alxrio3iy1fpt  ivsl(0 exrio iy4ol  lfetat  Dtrur no1opxo o3ildla rl( onu)arxnmr3oydfateanvil(0trtrio3iydapeemict ()aDurxmp;o1aet mf3tyslm elumsn(0aeeoxr3iytfa rli s;t0 rtr(m iy1lltnmiesa( sDtaumpot4tpe mi3iadlsDul( p ()artrxociytfmD  nvo;t) 2toxr3ny1al   ietat aDrau o;u1ole ifeiltla umnvsnu0 reomo tadfmtr iei s  exrxo3ou1om e fvia()srrmxmpoo0apx mf3tldfs2eluvo;u4artnif tatlmDranvs t)t2umirpno4lpe lfviat  2rrur ;o0ope  octys a2umuvsnu) rxoxfciotfm rai i t texrir iy1aptn feta(fa2rm(moou4teeo i3ias mDuau o u0 etoio3totoatrluvi;t0texm(o3ny1op e ietas a2tm(mono1ole mf3iys s2raums;u4texoif3oytomtr ivo;s0s2tmxo no4ap elncsa(  2tr( pnt0oltomoetysls2em( o (0aeenxf3oadlaDr u sls0setrxo3oodamtelivs s)aDtmum ;u1opt mietyd s2um(ms;t) lenifcia1fpDrli s (0trurxmpou4om elfvtls s2tau  nt4optn f3tydfa rm(mpnu)tlermo iatoaDe ieo s0sruo(opou1om e icilt)srtaumpoo1oeto ictydla2rmn s t4aleomrcoo1fmDrlnvils t2xm(m oo4ap  mivtltf 2raxrono0aeenmictatfm2ranmon(4artnmrciy1faDe n s t srxoir oy1optnmfetatf Dur(moot4olx  ocilslm2rlnmsn(4tlxomr3iotfaD an ols sruoimpoy1lm elfviat s2ur(m oo0oltnmieiadfsDea( snt4tlerif3iatom  lnvs t texr(r3nu4am nmfvs (f rta(ront0tltnmfctytfmDeanmpnu)altoiocoydla ean ilt sexoxmpoy4olte nvilt)aDtrxr oo4alt iociys m2umuvsnu4trtnif3io1lp eanvs;() 2tmim3no1lmtemfctat aDumum ;o1tpxnioetys sDrm(mpn()altnxr to1optrlueol(0teurxr iy1lpte ici tfarurxmo;u0alt  o3iadlm2rmnmsnu4 rxoxrcia1lpD ai s (  2xr(m3nu4lltn fvs tfa2trxrp;o1tle moeiadlm rm(mp t) exrmociadom  liei;(  ruoirpiu4lle  ictl()s2taxroot0altniociadlm2elumo;(0areoir3io1oa r ieo s t2xoxo3iudoltelnvi ( s2urx oou1aee mo3tyslsDuluvo t0treoxociatlpD  n i ( trumim nu1om  lfvtas  Duaxrooo1tlt ii3ildfa2uanmsn(4alxoxrcoydlpDrli slt0texr(r io4ol elnei t sDrm(r ou4teeo f3iytfsDuauvsn(0aexomoctatlaDeaies;( t2to(rpoy4lmtnmnct t s2urx p;o0opxoioctlsfm rlu s t) rxrmrctotfp e u i s) rumxo io1altnlivtat) rtmxro;t4alxn ietytls2em(vpnu)arxnmo tydop raieol(  rxrxr3io4ol n ivsa(faDua(monu4apxn ietltfa um(vs u)artrmf iy1fmD livo;t trxr(mpno4am emncs (f rtm(root1ape  ieias a2em(mo;u4 reomr3iytfmteanvils0t2trxopny4apt miei (fs2umx pot1aleoii3iaslmDrmnms t0teenxf tydlat li slt0truo(r3nu4opt micil( s2umumoou4tetnmfciydlm em( ont) rxnio3tadfaDr ueo;t0 exrio3oo4opee ietl( aDtrxrono0aptnifciasfm eanvp;(0 rxoxf iydlp  aneils)setoim ny1altnlfes ()s2ra( p;o1apto i3iysfaDul( s;t) lermo3iy1om rauvi;s0 etoxrpiodame  nvsa(fs2ra(mooo0tptnmoeiltlsDrmuvon()areoifciatfmD  uesl(  2xo(r iy1oltn net (f ruax  ;o0oexnii3iyt sDeauvs u4altomf ootoa rauvs;t seum(mpiu4oltelfcils)arua( oot1aeen ieild aDum( o ()texnmfciatlp rli s;s0 exoxm oo1omeemnvi tfaDrmum ot0tex ifctysfa2uln p t) lxomf tydfpDrlneolt srxr(m nodolen net t)srua(mont1tlt mieilsfm eanmsnu0 exoxf3oy1fpt lnes (0 eum(r oo4ame  icsa()srta(  nu4opt  octyd s2umuvs;u4altrif iy1lptran o;t)trxmxr3oy4lp   fci s s2uau ono4tpenmoeiydfsDulnvo;(0trxnxfcio1om eliei s0 2xoxo oodom elictl( a2urxro;t0tetomo3iadfs2rlnmpnu)aeeoir3iytfmtelnvs ( s2umim oo4alt  icslsfaDtrum nu1tex mieiyd s uluvo;()arenmo tytfm elivsls0srumxrpnodap   icia( sruax ono1alen oeiysfsDumumo ()tlxrio tydfpteaies s0trtr(o3no1lm n feils) Dtrxmpou4tee mo3iys s2ulnvp;t4tlermr tytlaDean i ( t2xm(rpnu1lpeelfetatf rtru  ;o0aetoiietad aDum(vsnu4artnifcoodlm eli o t srxr(rpiu4olt lnetas arur( p;o1teto f3ilsfa2ea(vs;t0altoxfcoodlmt lnes s  rxmxr iy4lle  fesa()srtmxrpoo0tpt  octatla2um( p;t0tlxomf3oydop  anesl(0trxrxrpoo1omtelivs s a2ururo;o1texn octlt a2eanms ()altnxfcoadlm e i o s0trtoiopiudaltelietasf rrau p;t1aptoio3ils s umn p t4arxoif3todfpte u ilt  2ur(r3no1lm  mictat  2rmu oot0olen ocildfs rl( o () lenmo3oytop eau o;t0srto(m3oo1ope  nesatfsrrax pnu4aexnifciltfm uauvo;(4 eenir3iodlpDelnvsl(0s2xr(mpiy1ame licta(f rta( poo4tlx  ociydlmDeanvp u4 lenmrciadoateanes;() etrxm3io1aleemfcils)srraxm nt4tpxo ieilt sDran s t)teenxf oatopDr u i t) 2xr(m3nudopenmnei s  Dtmurpnu0opx mocils aDem(vo t)aleoir3oadfp r n ols0 etoxr3oydaltemieilt)srtauroot0apto i3ilsfsDuau o u4arxrmoctotfmDrlues;t0srxo(r oudlmen nvs sf 2ta(r no1oeeomfetysfm2ra(mo;(4tltnmfcia1lmtr ieo;s)s2urxm3nu4lpt  fvt sf Drru pnt0oex ifetltfsDemu p;t4tetnxo3oo1lmDr nvo s)tetoim io4oleelfcil(f Dur(mp;u4opx  f3ildla rmnmo;(4 lerxfcoadlm e u sls)srur(opny1olee ieiatf 2trxrono4oeeoifetlsls umuvo;()alxoxr3oadomDrlues t  rto(m nydllt lfcsat aDrr( oot4tpxn i3tysfa ua(vo;(4 eeoxr iotlptraiei;t0setm(r3iudllee nctls)srumu pno4oexnifcildfm elumpnu0 leoxo iotfmDrauvo t0srtrxr3oydaleemiciltf Dtmx p;t0tpen i3ils aDel(vs;(4treoir iatlpDr ivi s  2toxo3oudap nmfvi tfaDtmxmp;u4oleomicilsfaDem( s t0 rerif3iatoateaneo (  exr(m3oy1olt  iei s)arum(rpoo0oee  f3ils s2rmumo;t4 ltoif3oodlateai o ()srto(r nodal  mfctat)aDrrxmp;t0ope  fetat aDuaump t0altrxr3oydlm r i s;(0tetr(mpno1olte fciatf 2rrumo;o0tetniictyd a2eau pn()aeenxr3oodopt  nvs;()s2xoim3io1oltemneias)a2rax o;u4ole iieilsls em( sn(0 eenif iadomtelneo s)sruoxm io4lle  ncia(f 2tr( ont0tpeo fciytla em(vo;u4artoiocootlp   ueo () eto(mpnu4apeeliesl(  rra(ro;t0oex  i3iydla2rln s;t0 lxnio3iy1opDeaivsls t2tmxmpiu1alt mncslt  rrax onu1apt iociytla emuvp;u4 eenmf3iytoaD au ols)srtr(mpny1optnlfcilt) rum(rp;u4tleo fcils a2umn s;t0 eeomociadfpt lues () rxo(m oy4alt mieias a2rrx p;o4tleomiciatfsDrlnvp;u) ltrxr3oytfaDeanes;()t2toxr iy1oltemici (f rtrumont0oltoioeiad s ra(vp;(0 eermoctydlmt liesl(0texmiopno1olenmnvt sfs2rm(r ou0apt  oeiasfs ul(mpn(0teenir3ta1om elies;s) rto(m ou1oleelnet tfaDtmumpnt1alto i3ildfm ran pnu4 exoifcoo1oaDeln ol( srto(m no1lltelnvt s a2urum no1teen oeild a uau o u4aeenif tatlaDeliei;s  etoxm3iy4lmt  nvtas artrx  ot4altnmfeilslaDumnvonu4aetoxfctadlateaivolt)trtoim3no1ole miet t)s2rmuro;o1tptnmiciadlm eauvsnt4tltrmocoydoa  lues;() exm(o3oo4alt  ietltfsrumxmpot4apxoiocils s rlnms u4aetnio totop  lueols0s2xr(r ny1lp e fctls  2uaxm oo1aeen oetytfa eanvo;()alxnircootlmD  iei ( texmio oy1ll n netl(fsDrm(m ot4ape  fetld a ea(ms;u)tetomr to1omtraivs t)tetmxopio4aptnlfvil() 2tmumpot1tleoifctldla em(vsnu4altnir3tadfa  ai i;s0tetrim3iodop n ieta()a2ua( pno1oetomi3iydfm2uanvpnt4 etrxr oytomD luvo (0srumiopno4lltelfvtlt srua(root0tlxomieilt m umumsnt4aetnif3tytfmD  n ils s2xoxm3iu1ome mfet tf Dtmumo;o4opeo i3iat m2el(mp;t)aeerxf ootla  luvi t)trumio3nydap   nci tfs2ua(moou4tpt iicildfm2rln s;(4 exrxrciatfat aivils s2tmiopoy1ap  lfctat aDtmu  ;u0optnmociad mDem( s (0 leoif oydlm ean sls0 rto(opoydlm nlnciat  Drrxrpnu0tleoifeiaslaDrm( o u0 rxrifciadomDrliei s0 eumxr3io1ap n nvtls)sDururo;t1tpe mf3iydlaDuluvp ()arenxf oatfmD  uvs s)t2xrxo nodalen ictlt)a2rax  ;u1tetoioeiltls2emump;t4arerifctydlm eauvo;s sruoxo iudap nmneslt) Duaxrpot1alxomfeiadla umnvp ()texoxf3io1omteauvs t0 2trir3oy4al emieil() 2urxrpou4open fetyd m2rluvsnt)aetomf oadfmt  neslt trxoio3io4lm  mnetlsf rrru  ;u1tpeomiciyd m2ulnmpnu0aetoxf3io1faDrluvils0trxr(m ou1oltnmnvtlt)sDua(mo;t1alen fciad m2rm(vs;t)trxnxr iadlaD  i sls0 rxo(o3iu1ap  lnctat arrrx poo4teenmictys s ra( o t4aetrio tytfa r uvi ( t2xoxopoo4amtemnesatfaDraxrpnu1alxn fcildlaDumu s;u4trtoio3oadopDr uvs;s)trxo(r3ny1lmenmnetas srra(mpot4tlxomfeias sDea( o;t0 eerxrctytlp   nvils) etmxr3ou1op n ivias  Dta( onu0teenmfciysfsDemnms u4teerxo oa1oa eluvs;s0 2xoxmpnu1amtn ies s)artm(moot0tex  fciysfsDul(vp;u0aetomf3tytlmtrli ils s2xm(o3iodale lfeiltfa2umu  nt1tpenioetaslm2ea(vont)texrmo iydlmt  u o;s0srxrxrpoydape lfvtatfarrmx  ;t0apxn o3tatlm ea(mp t4tlxnif ia1lm   ues ()seuoxrpnodlmt  neil()s2truro;t1alxnioeiydfsDulums (4aetrxr3totoa ranvo;()setm(o3ny4lpen icsa( arur(m nt4apeomf3iad mDrl(ms u0 rxnmo3oydlm   i i;s) exo(r oy1om nmfetls)s2tmxro;t4alxo ociytfs elnvpnu) eerif iytopDelnei t  etmir3nudam elicsasfsDraumo;o4apt  f3tatfmDrmnvp;u4 ltnxrctatlatr uvils) rxoim3ou4lpenmiesl()sruru pno1aleniocildfs rln onu0aexnmocootomDe n ilt)srtrxo oo4omtemfvi t a2tmu  ot0ole io3tatfm2emn snu4 ltnio3ta1om rli i;s0srxoim nydlptnlnvilsfaDraurp;u1oltn f3iydlaDemnmsnu)aexriociytlmDelnes s)trtmxr3oudlleelici t a2rmxrpot0opt  icilt mDulu p u0 rermociytfmDeauvo;t0trurim3iu4omenmicia(fa2uaxr ;u1oetnmi3iatfm2rluvp;(0aexomf oy1om r neo;()seurim3iudaleemfeia( srurumpnt0texoifeilsls2em(vp t)tetrxo3oytop rlivilt0srtoxopoy1ap  mnetat aDuru o;t1alenmiciad s2rmumpnt)tlerxo oatom   u sl()srurimpoo1ale  nvslt srtm(rpnu0oltnmoeiatlm2emums;u) lxoxf3iodla e uvol(0sruoxo3ou4lp nlfcs ( a2urxr ot4tlxo icias s rmnvs;(0aetrmr tytfpDeaneo t)seumir iudop n neslsf 2tr(rp;u1aetniociadfs2uanmp;t0alxrmo3oadfmt  u s s) exrimpoo4lptnmivsa(faDua( ono1tltoio3iyslm ea( ont0aeerxr oo1fpte ivs t)srumirpoydapen ncsls srtaxmp;u4apen feiltlm2ul(vo (4alxoxo iotla ran s t) rxo(rpno1lpt lnvtlt) Dtr(moot1oetniocias sDuau pnt)aexnxf ta1fpDeluvsl() 2uoxrpnu4lpe mfesltfs2urxm ;u4tlt  i3iltfa rm(mp (4 eeoxf3oodop ranesls teumxo3ny4al e neiasfs2taxm nt4tet if3tydfaDuaums;u4tetrif3tytfm rai s;(0s2umxm3iodale  ieta(  rrau  ;o4aetnmo3ilslmDuluvo;t0aetrxfcoy1fmDeanvi (0t2uoio3iy4amt  ieiat srraumoot0aetnifetysfa rmu p ()aexoxfcoy1faDelneslt)s2tr(opny1om  mnvs (fa2tr(mp;u1optnmi3iydfsDrmnvont0aexomoctadlmDeliei t  ruoxr iy4open nesasfsDrmx ooo1apeomf3tasfs rmump (0 ltomo oodfptrau o;(0srto(m iydlmtelncils srrau ont1apeoiiciydlm ra(mo () ltoif io1fm   iesls0srum(rpiudale lnct ( s2tmum nu4tle ii3iasfsDumnvs;(4 exoxr3oytfmtrlnvo ( seur(o3ny1ll  mfciltfsrumxroou0oleniieiytfsDeau o (4aeerio3tydfa eaivi;t)s2urxm oudale  neta( aDrr( ont0aptnmo3tad aDeln ont4tetrxr tytfmt luei;()seuoxr iy1ape  nvia(  Drr(moou1tetnifeiyslaDranmo ()tleoiocoo1lmtrlnvo t0 eumim3no1ap e fvtls)s2uaumoou1olx mieildlm2uauvpn(0 reoxr ia1lmt anvils0srxo(o3ou4omt mnvsatfsDtau p;u0oeeo feiatlm2ran onu4 ltoif3tatopt lneo s0 2tmim nu1ape  fcsas)srtm(rpno1aet  i3tat m2rlnvp;(0 exnir3tytlm e neo t0 eum(mpoodoltemnvtlt) rrmum ;u1aptniocilslsDemn o;u0alxomr3iodomDr i s;t truo(o3ny4ope lnesat)aDur(mp;o4apx iictls a ulump;(4texrif3iotlm ean ils0 2toxm oydape  feiasfaDtaur no0aeeomo3iyd m rluvs () lxrmr3ty1oaDr u ol(0seumxmpiy4omenmncsls aDururpnu1aptniiciydlm elnvs;t4aetoircty1fm r nvs s)tetmimpio4opt  icia(f Duaxm nu1opxoiociatla2rmumon(0trenmf3todlaD an o;t)seur(r iy4lpee ieiat a2umxmpoo1oexoifciadfs2em(vp ()alermrctodoat livi;(0trum(r nudlmeelfvsl(  2tm(root1tex ioctltls eln sn(4aetnxf3io1fm rlies s  etmxr3io4lptn icsas  2ur(ro;o1aleo i3iydla elnvpn(0 eenmfcoy1lpteluvs;(  2tr(opoo1lp   feils)a2rm(rp;o1tpt micildls uanvp;u) rtrif iy1fp rluvo;(  2xoxr3nydom elfvt () 2umu  ;o0tlx  fciytlaDeau o;t0tltnio3oo1laDrlivs;s) 2tmimpiodlpt lfcsa()s2rrxm no1optoif3ilsls2ulu p;u)arxniocoodfa  ln s;(  2um(r3oo4lle  fctas srrr(ront1tlx ii3tat mDrlu o;t4alermo3oatfaD anei;()s2toio oy1lpe mict sf Drau oou0tee mfetysfaDemuvo;(4tetnio iytla eanei ( teumir3nudapt mics s  Drm(ronu1ape ii3iydlm ua(mo;t4tlxoxr3iodop eaues s trxrim3ou1lp n neils)arrrur ;u0oleoiociad m rmu s;t)aetnif3oytlpDraiei (0teto(rpnu1open nctlt) rtrxr nt0oeenmoeiys a uluvo u4tetnmr totomDrau slt)texrxrpno4lmeelici t) Dtrxr ;u4olenifctlsls uluvp t4trtrmrciytoaDeaies;s0 2xrxmpoy1ame mfct t srrmur oo1tlt ioetasls el( p;(4tetrmf3tydoa e u i t  2xmir3iu1om nlicias)aDra(mont0ape miciadfs ua(mo ()tlxnmr3oy1oaDr ieo ( seumiopnu4omen ivs t s2taxro;u0tet io3iytfa2eaumo t) ltnxrcoa1fp  lnei s sexrio oy1lp elnct (f ruaumpou0texoioeiasfaDemump t0 lermo3iy1opteanvol( trto(r oo1lm nlivtatfs2uaxm ;t1tetn o3ildfa emn s t4 reomr3oydlmD an i;t srxr(o iu1ol n nviasfarurxr ;u4tlt ifciadlsDemumonu) eermfciatfmtraivi t)sexmxopnudol   nei s a2rrx  ;t0tee mfeildls2ulnvp;u4altrio tatfpt lues s0 rxoxm nudalt  nci tfs2rrumpoo4apt iiciyt a emu snt0tlxnmo3iytoaDe uvils s2xoio3oy1al  mncs ( aDurx ono4tee mfetysla ea(msnu4 renxr tatfa eanvsl()t2uo(opio1ap  mfeslt) rra(r ;u0oleomfeiadfaDea( s;t)artnxf3iadfa r i i s0s2toim3oydlltn ncsls srtmxmont0aeen o3tad m2rmu p t4artoio iytoa r u s ( sexmim3oy1ape lneilt)sDtrumont4aeenifeils m em(monu4aleriocoytfaD  u s s) eumxo oodop emfctasfa2umxr no1opxoiieilt mDum( on(4 eeoxf3iydlpDr neol()s2xmim3nodlpenlfei ( srtr(m nu1aetnmo3tasls2rlump;u4texniocoydfp rlues s trxmxrpoodamtnlnet s sDtmxmpou0opxnioeiat a2rmn sn(4 eenifciotfmD  uesls0sexm(opoy4op e ictasf 2ur(rpot0tlt iicildfm eau sn(4areomf3tatfpDr u o (  2xrxr ny1al nmncsa(fs2raxmpnu0tee  ociyd aDrm( s;t0trxnif to1opDr i i;s teurxopiudapt lict t  Dum(r ;u0oee  fcils sDrm(mpnu4trtrxf3iy1fpDeauei;t0 rxoim oudlpeelnvsas  rtrurpou4ope  f3iltlm2ulnmpn()aleoxociatlat livi ()s2tmirpny1lp  mfesas aruau p;t0alxniictatla2rluvo;u4altnxf3iatoa rauei;s0 2tmir3iodop nmnci ()srrmu pnu1aleomfctltfa2ulumpnu)tetrxr todlpD au i;(0tetr(r3ou4olt lies s)aDuau pot1apx mf3iltlm rl(mp t4 reoxr oytom  lues s0s2ur(r nudap nmieilt sDurxmpno0tpe if3iadfm rmuvo u4aexnmfctydfateluvs;t)setoxm ny4amen feias) rrau oot1olenifciytla2umn pnt) eenif tytfa   n s;s)trxmio no1lptn nvtatfa2rmu o;u0tpxo ieilsfs ean s t4alxnmrciadlpDrlu o;t0tetoxm3oydll nlies s srumu  nu1opxnmi3iltlm rlnvs t0aeeoxfctatlaD auvs;(0texmiopoodaptelfeilt)srrrumpnu0tleniiciydfsDrm( on() etrmf3iadoatelueol(0 2urxo3iu4lmte ivt t s2rr(rpnu1oexomieiysfaDumn s;t) exoio totopteaieo ()trxmiopiy4lm e ieilsfsrtm(m oo1tpen i3iadlaDemn o;u)aeerio tadfmDrai i;t  rumxmpou1omtnmivi (fa2umx  no4ape io3iatfm eau p;u0arerif3tatfa elnvols t2xoiopny1apeelfct ()arurur ;o0oex mfciltla um(msnu4texoxrcio1fp   i i;s0s2toim3iu4ll emieilt s2urx o;t0tlenmoeildfs ea(vp ()trerxr tytlaDrlnvi t)trxo(opiu4am  mfvtl()artmuroot1olen ocildlm umnmp (4 ltnmr3ty1faD luvo;(  2xoirpiu1olt  nei ()aDrrumo;o0aptn ocils mDuau snu4tlenir3to1omDranvo s0trxr(o oo4ap nlicilt) 2rmu ono1altnio3tat m eaump (4 rxomr3iadfm e i ols s2tmir nodop  mncia()srrrxmo;u0ole iociyt sDemuvpnt4texrxr3oadla r neolt0srumxm oo1amtn iet tfs2uaxr ;u1tpenmi3iys a2uanvs u4aeerifcty1optraivo s)seumxopiu4omt lfvta()a2rau p;u0aptomfciatfa elu sn(4arxrxo3oadlp r nvi;t0setoxr oudlm   ivt t  2umxr ;u0alto f3ild m2ranvp;(4 leoxoctatfp e n s;s0trxmxmpoy1ol nmfcsas)a2rrxro;o0aexnmictydlmDean snu4 lerif totlm eluei t0 2trio nu4ap emnvi (fsDrmxmp;o0tet  ociyt a ra( s;t) etomo oo1fa   nvo (0 etrim3iodlmenmnet t sDtaxrpno1apeoii3tas mDean o t0 rtoif iotlpDe n i;()t2xr(o3iodoptn fviat  2tm(mpoo0oltnmietadlsDrl(von(0areomr iytoa eln sl( trurim3no4lmtnmneslt)s2rm(rpoo1oeeniictat s el( o t4areomfcoytop eluvi;s) 2trxmpou1lpeelivtls srrmxmpot1opto f3iasla2elnvs ()altoirctadlp eaiesl()trtm(rpoudaltnmfetltfsDrr( ono1teeoio3iasla uluvp t4 rxoir3oodom  lnvs t0 rtmxmpoodapenliesl(f Duau  ;u0ope  f3iatls2el(mp t4teeomo3oatom elnvi ()trtoxr3iudlmteliesatfsrtrx  ;o1tex  oeiadfmDeluvs t)tleoxo3ia1fateli s t)setmxo3iydamt  nvia() 2umu ont1aeeoiietytlm eanvonu4alxomo3iadomtrauesls t2xmio3ny1lp  lneslt srum(m ot1tlx  fctasfa ua(msnu4trtrmf io1lm  anvs;t)t2xrxopnu4lpt lnctas arrr( p;o4tetn i3iaslsDrmnms;u0 exoifcoodfaDelivolt0 eur(m iy4al   nciasfarrax  nt4tlt moctaslsDeluvsn()aexrmrcia1lpD lu olt) euo(r3oo4lpee neilsfa2ua(ront4ope mfctasfaDraump;u4arxomrcoydop elu i s)seto(opny1apenmictls  rrrx  ;u1aptoio3ilslsDeau o;() lenmo totlp elueo;s) rumiopou4apenmncsa(fsDrm(ro;t1oetn o3tys sDulnms;(0aetrxr3iytop  ai o () ruo(r oy1omeelfcils s2ur(m ot1tlto oeiasfaDrlumsn(0 rxoio3oo1lpD lneo ()trtmxr no4ol nlnei sf rtmu pot1teenmfctadfs2ea( snu0aetomf todlm  au s;( t2xmxo3iodlmenmfcs ( aDrrx  oo0altoif3iadlsDrluvo u)areoxr iadfaDr n o;(  euoir3ou1ale mictas) rtrx  ;t1aexo ictasfs2em(vont0tlxrxfcoydfpDeau s t srtrirpno4lp  micsat)srraxrpnt0tpenmicias a2rmn p;u) exomo ty1fat  neo (  exoim3iydaltnlfesl( srtm(mooo1ope moctys s ulnmp ()tleoio todomt  uvo s s2ur(opiudlpeelfesl( sDtm(moot1aeen oeiytlsDuanmon(0trtnxf ootfmtr uvs;s)srum(rpoo1op n ies s sDuaur nu1tpxo iciyslaDraumonu0tlenmo3io1lpDeluvilt)trxoxopio1olenmnesls) rtrx  oo0tlt ioeilsfs emuvo;t4trtomr ty1lpt  iesl(0 ruoiopnodomtelicsl() 2umxro;t4tetoif3ilslsDemnmo (4 etnmfctatfmte ueo s)s2um(m3iu1ale lnvsas)s2umu onu4altoif3iltla um( o t0aetrxo3tytla   ies;s)tetmxr3oy4am elietas s2umuroou0oltoioeiltfm2uluvp;t0alxrio3to1lm rluvsls)setm(r ny4om  lfci s srua(rp;t0oexo oetls mDel( s ()aexnxf iodoaDe nvs;()texo(o iodlme  nvils)artmxrpoo4opeo ieils m eaumo;u0 lxrxf3oatopt  u s s  rxmxm3oo4lpen feils arur(m oo4oet  fctltfm2rluvp ()aetrxfciydfaDe u ils tetr(r3iu1aptnmnetltfsrrr(  ou1olxnmoeiasfsDraumo;t0 lxrmrcta1lpD livo s0 rxmxopiodlp elnvsat)aDra(r no1texoioctadla ranvo;u4tlerxfcootlateai ilt0 2tr(o3oy1lmt  fvsa(fa2rrum ;t1aet ifctydfm emnvo u)aexnifcoodfaDrai i s trtrim3iu1apte ictls  rta(monu0teeoifeiydlsDem(vo t4tlxnif3oatlpDe i i t0 2trxo3oy1lmt lncta()srraumpot4altoifctydfaDem(vont)arxnmo iy1omtrlnvils  rur(opio1lltn ictltfa2rr(ronu0oetn ociyd aDrln s;t)artnxr3oadomD aivi;(  2tm(m oudlptn feiltfa2uaum ;t4ole mo3iltfs2rlumsn(0trtoxfciydfatrlnei ()sexmxopnu4lmeemivtas)a2uax  no1aeeniociasls ea(mo t0arxnifcoodfpteaueil( t2to(m3ou4om nmics t) Dur(  nu4tpxo o3iys m2ean pnu) rxoxfcootfp rlu slt)seuoir3nodlp elicias  rua( p;o0tpxo f3iys a rmn p u) lenmo3totomt livi ()tetrxmpoodap e nes t)sDur(  nt0apeomi3iatlm2elnmpn()altrmocio1fa rlivs;s s2to(o3nodolt mnvil(  2tr(  ;t4ape micildfaDra(von(0 ltnxo todfpDr u o;s)srurir3oudamt  ncilt a2um(rpou4aee  ieiydla ulnmsnu) ltnmocia1lmtr ueo t t2xrirpiy1ol   fci s  rum(roou1oexnii3iltlsDua( pnu0alxrxr to1omDr i o ( truoxmpio1ap nlnes ( a2trumooo1tetnio3iatlm2umnvp t0tltnir3iotoatr uvils)sexr(o3ou1llte nvtas  2raur no1apt mo3ias aDeauvs;u0 rtoxociydlpDe ues s srtm(r3ny1apee nvils)artaurpno0texnmi3iys mDrm(vs;u)teenmfcio1oa   u sl(  euoim3ou4opee nvslsfa2ra( o;t1olxnmictltfs2em(vp (4 etoir3iy1opD aiesl()trtm(rpou4lmte fvt t aDra(m oo0aleoiiciadlmDuauvs u)aexomfcoadom elu sls0s2uoio ny1op   fciasfsrrm(m no0aetn fctadlmDuanvo;()texoxrciodlatr ivs t0 2tmxmpoo1al n ieia()srrrxrpot1altoiietlt a2emnms;(4 lxrir iy1fmDr uvi s srto(mpoy4olen ivt sfaDta(r ;t4olt  oeilsls el( s (0teenxr ia1lmtrlneslt setmxr iy1aptelneilsfsrurx  ;u0tlx  f3tadlaDrau p (4 rxoxfctotfa  ln o;s texr(m iy1lp e fvi s)s2uaum no4olt iieiydlmDumu p;(4 lxriociy1omD  n s;(0trxoiopnu4ol  lnvtl()sDtmump;u1tltnmocildls ul(vont)teeoif3oadom raieo;(0trxrxo io4ape mivt s) 2ta(m ot1oetomietydfa2ulu s;()trxoxocta1lmt livo t) exmxm no4altn fesa() 2uau o;u4tpxomo3tldfaDrm( onu0 exomo oadlm  auvslt0t2xm(o3iu1llt mneiasfaDtmx ono1apxn fcias m2ulump;u4 exrmf3ta1fm eanvo;s sruo(rpnodop nlncia(fs2umumpou1apxn i3iytls eanms (4 eerir3iotfmte ieo;t)srtoxo3io4ome lnes ( srumumpou4tltnmf3iysfs ulump u0 lxoxo3oodfatr u o s)setoio iu4amtemivtlt srrmurooo4aeenifctysls rl( s;u0 etrmr3totop  li i ()srxoxm no1lm elnvsa() rrm( p;u1tpx moetld s2um( pnt) lxrmfcoydfpD liesls0 rxrio nudlmeelnvsat)sDtaxm ou0alenmiciadlm2rln s (4 leomf3oa1lpD ln ol( sexr(m3oydlp  livias srrr( o;t1oeen f3tadla2ean pnt4 rtoir ia1opteanvi;(0s2tr(r3nydoltnmncs (fa2trx pnt4oleomoctyt mDeanvsnt)aetnmr3iy1fp  livils)s2tmxrpoydlptn iei ()s2tmur ;o0texoioctldla ua(vp (4trenif3oadoa e u s ( srxmxr nodop  lfvs t aruaxro;u4opxn f3iydla rlump;() ltoiociotfpDelnvo s  2toxm3iodomt lnvt (  Drmur no0oexomoctyt m2ulu s;t4arxnxocootfatrlu o t) 2trirpou1op emfes tfs2urx p;t4alxomfeiasfs emnvo t)teeoxr3oydlmDr u i;()s2toxm nu1omt livsas) 2raumooo4tlxnmfctat m ea(vs t) exrmociytfpt lueils)setoir3ou1ale  fcsat sDrax pnu1tlxomfciatls2um( onu)tlenxf3totla  lueo ()sexr(mpnu1ap n fvia(f 2tau pno0apeoioctlsfmDrauvs;(0tetoif3iytlat  i ol()t2trxm ou1op emivilsf rra(m ;u0teeoioctysla ulnms () exrmfcty1fp raieo (0trxmxopoudop emfei s) Dtm(m ou0aleo feils aDuauvs t4 renircoy1fm r i sls) euo(m iudamtn ict ( srum(rp;t0olxnifeiltfa rl(ms (4alxrmo3io1lm e n i;s  rum(opnydopee feilt) 2ua( ooo1oexoio3iydlmDua(mo ()tlenmf tytfateluvi t sexo(opio4amee ieil(fsDra( pot4opxn o3ilt a eln on()tlxoif3iatfa e ivo;s)texoiopnydlleelnes s  2urxr nu0oex ioetltlmDemuvo;u4tleomo3todfmD  ies (0trtrir iu1amt mnei s)s2rr( p;o1oee ifciasfm2umuvs;u)aetnxrctodoptrai o s s2uoxo io4lp eliviat) Dtru  ot0aleo o3iadlmDrln sn(0 leomo iatoatranvo;s0s2um(r iu1om elics s arrmumpou4opxnmf3iytfm rmnmsnu0aetnmrctotomD aneslt0 2tmio3ny4om elnvtl( a2tmxm no1aleomieias a uluvsnu4 leoxo3oy1fmt  u i;s)t2trxm no1ome  fctat sDtmum oo4oex mociat s2ulnvsnu4teerxrctadfmtraueslt)texmxopno4alenmnvs t) Dtaum ;o1olen o3iasfmDrmuvs;t4arxoifcta1fa r n s ( t2tmxm ny4alt  ncil() Dta(mo;u4tpeo o3iyt m ranmp (0trtrxocio1fptelnvs;s) exm(mpnudapt lfvtls aDtax p;t1ope ioeiltla2em(ms;u)tlxoif iydfpt ai i t)srtm(r3iy1lmen fet t)a2tru  no4aeeomi3tadfs uauvp (0arerirctatoptran o;()texoxo oo1lpee fctl( a2tau oot1oex iiciat s rl( p t0aeermr oy1lpDelu sl(0 exrxopnydlpee iet () Draxr oo1tlt  o3iys a emnvp;u0 rxomrcoy1fm eaivo t0trto(opnudaptn ietls  2uax  ;o0tpe ioeiyd sDeluvp (4areomr3ootfpDr uvolt trurir oo1lptnmicia()arrmu ont0olx ii3tydlaDeluvp;u4texoif iotoaDrlnvolt)sexm(rpiy4al   neslt  2ua(r ;t1oexn fciyd a2ranvs;u4 eeoifcto1oat  n ilt  eto(m nydal elnctls aDrau p;t1tpe mictytlm2rlumsnt0teenmrcia1lat au olt) exrxrpnu1lm   icsl( a2rmur no1tetnif3iysfs2el(mp;()arerxrcoy1opDrau s;(0t2xoxm3oo4lpt  ies t srur(mp;u1aetnmociasla2uaumon(0 lxnxfcia1optrln s t0 exoxo nydam nmietlt  2urxrpno0aleo ieiltla ul( o;t4trxrxo3tydlaD au il( srxmimpnu1lmeemnesatfsDtax  nu0tltniietlt m emu sn(4trtoxfcoadom rauvils0trtr(o3ou4am  lfctl(faDuaur no4opxnio3iad m eaump;()treoxo3oy1oa raivo;t trumimpiu1llt miet (faruaum oo0apen i3iysls elnvo u4texrmrctadfm   i o t  2trir3iu4altnmivt tf rraum oo1aexomfetlt m2uln p t0tlxnxf iotfpDrau i s  2to(r iu1opt  feilt srtmur ot0opx  oeiysla eanmpnu4artnxrctadlpDe ivils0s2uo(o3iu1ll e nciatf Dtm(moou1apxoio3iys aDrlnvo;u0treoif3ia1fateaneil( t2tm(rpnudlp nmivi t  Dtm(rpnu4ope  oetaslsDumnmo u4altomr3iodlmDrlnvo t)s2to(m3ou4amte fvtat)
\ No newline at end of file
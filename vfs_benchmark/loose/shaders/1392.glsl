@@ -0,0 +1 @@
+ivs t sexrir oy4am nmivi t artru o;u0alenmf3tydlm2ulnmpnu) exrmr3oo1fp raneolt)trtr(o3ny1olee fetlt s2tmu pou0oltnif3tld s2ulnvonu0artoxfcoodlpD auvi;(  exr(o iudaptelnet s) 2uaxroou4tlxo o3tld sDea( s u4tlxnmrciatfmD ln s;s  rxm(r3oy4ap emfet () Dra(rpnt1optnii3ildlaDemums;t4 eenxocoadomDr ues s tetrxo3oy4open fcilt) rrru  ;u4aetnmo3iad aDrln p u)tleomr iadoaD livilt0 eurxrpiu4lmeemivi (  rraumo;t0aex ii3tltla rmnvo;u)alxrmr3oa1faDe nvo;( srumir ou1ap n fctlt)aDtrxmo;o0ole io3ildlm2rmuvpnt)alxnmoctotfat  i olt truo(o3nu1olen icsat srtaurooo0ale ifciad m rl(msnu0aetomf3tadomDrluvslt) 2uoir iu1ole  fetls a2um(ro;u0alto f3iydls2eanvp (0texoxr3io1omDeaiei s setmxr3nydomeelicta( arta( pot0aetnmo3iasfs2ea( p;u4artrxf3tatfp  luesls t2tm(o3oudomt mfei sfaDtruront0tle  iciad a um( o;(0aetomr tatoptrau i;s  rxrir3iudlmte nvsa(f Dururo;o1texn i3ild s2rau s;u4 lenxrciodfmD  ieo t srxoxo3iodlmt mivtlt s2uax poo4openmfcildlsDrlnvsnu) lxnio oa1faD livs;t)texrimpnudame  icslsf rta(  nu4oetn i3tytfm um(vp;()trenif oo1oa  ai ils setmim3oo1omeelnctlt sDtm(roou1tptnmi3iytfa2rlnms t4altrmo3iydomteauvol( teurxr3oodlm emfei s)srururo;t1oeen o3tydfs el(mpnt) ltoio3oa1la elneilt)t2to(r3nu4oltn fcslt srtmump;o4ape mieiytfm eau s;t0aeeoxrcta1om e i ilt0 rurim3nu1apenliet t a2tau pnt1ope if3iatlm ua(vs;u) ltnxrciydfmtran o;t srtrio3oudom   fvia( aDrrumo;o1aex  ietytfsDumumpnt)trtrifcty1laDeai o;s t2trim ou4openmivs s sDrr(rpou0teenmf3iatla ra(vs;t4tlenmf todoa elnei ( s2uoio iu1apt  ietlsfsrta(r ot0opxoifctldfsDeau snu) exnmr3ta1op eauvi ()s2xoxmpoudam  mnetasf Dtm(roou1ope  ietyslm ea( snt0trxoio3ia1oa rauvs s  2trim iy1optelncs (f 2tr(m ;u0olxnioetyd s ean p u)trtrio iadoaDeluvo ()sexr(r3nydame licsat)sDurumpoo4tpxomieildfm emnvp;(4 eenmo3iy1oaDeauvi s)trxmxrpno1lmeelnesa() Dtaump;t4opx mieiytlm2el(vs t)alxoio3iytfpD luvs;(0 rtoimpoudol nmietl(fsDuru o;t1oeeniietytfm eau s;t) etoxr oadfa rlu i ()trxmim oy4lptelicil(f rtrx  no1ape mfciad m2ra(vsn() rtnifciadfm e ieo;t)srurim3io4amtnlivilt)a2rmumont1alenmi3iyslm2elnvp;u0aexrxocto1lmD  nvo (  2ur(o3ou1ale livs (fsrua(mpot4aeeo icilslmDul(ms u4tetrif tadlp rauei;t t2uriopou1ol nmictl(  Dumuro;u0ope mocildlaDem( p t4 renmrciytfp rln ilt t2xm(o3nudlp elnci s)a2ur(rpnt4tee  ictadfsDulu p t)trtoiocta1lpt aieo;t setrxo3no1lmt  ici (fsDtmumooo0olxoif3iydfs ra( pnu4artomocoodfa  li s;t0s2xo(o no1lp   nct (fsDra(  nt0aptoiietlt a2ul( s;u0 renmfcootfpt an ols seuoirpou4am e netatfs2umx onu0openifctydlaDuanmp;t) ltrxr3io1la elueolt0 2xr(m oodlle  netlt) 2rmxr no4aetniieilslm ulnvsn(0arxoif3io1fatean o t srumim3iodlmeemnes s)s2trxm ot0aex mi3tld aDelu p u0tltoxr iadfmtrlu o (0 2tm(o no4lm  micias)srtr(mp;o0tpt mictlsla elnvs;t)aleoxo tatlat  i s t0s2ur(rpny4apenmieilt aDraxr ;t0ope ifciatls rmums u)arxnmr totoptelnvols0sexoio3no1lltemnvt t  ruax oou0alenmiciytlaDulnvo;t0aexnircta1omtran s t) rxoiopiy1ome mnci (f 2ua( p;u1ape ii3tysfm2ra(mont0tltomf oydfa   nvo;s)t2umirpiy1lmtnlivi () Dua( onu0tex mietat m2elnvs;()teeoio3todop rai s s)s2xr(r nudaleemivi (f rtrxmoot0tpt mieiadls ulumsnu0trxrmo3totfptelieo ()s2umxr nu4opeemfvtl(f rurxr ot1teeo ocilt a rl(ms u)artoxfcootla rln o;s) 2uo(o3nu1al nmivtlt)srumurpou0optomfciltfs rmuvs;t0texnmo3tadlmDr i sl(  2xmxo3nodole  nctl( s2rrxmpnu1aet iieiysfa2emu s;u4trxrxo oo1op eln i;s0 eto(o iodal emictat arumx  oo0tlx  fetasfs2el(mpnu)tltoio3oadopt  i ils0srxo(opoydll nmicta() Duaxm no4olen o3ilsla2uan p;u)aexrifcoatfmtranvo;t0teto(rpiy1oleelfet s aDtrxmono4tpxoii3tldla2ul( pnu)tetnxr tatfpD  ivo;s setrirpiu4olee ies sfaDum(m nt1ope mfeiat s eanvonu)tlenxfciydfptr n sl() rxm(m3oodlpt liesatfa2rmxm ot1altomoeiad s2umuvont0alerxo3oadom   iesls trtrxmpiy4al nmivi t srumurono1aexoii3iltfsDrlnvp;u0artniociotoaDelu s s0t2tr(m ou4lp nmies t a2taxm ou4tleoioeildls rlums t4aexoio oytfateauesls0 2tmim3oudaptemictls srtmurp;o1tpxn ieilsfm2rluvs u)texomo3oodlm e ivol(0tetmxmpou4lmee ncta()a2rmxroot4opto i3tlsla2rlumsnu4tltnmo tadlpDe n i t0t2uoio3no4lme mfct s srrru  no4tpe miciltlm ulu o t)artnio3io1lpDeau o;t) ruoiopio4lmeemnvi s  2tau ono4ole  octyt aDul( pnt) rermrctydop e u o;s0s2trio3io1alenlivtltfartau  oo0oee iiciadlmDulu pnu0arermf tydom   u o t t2umir3nydal nmncsatfaDum(rpot4tlt iiciytlmDelnmsnu4tetrxociadop   i s ( trtoio ou1olt lict t  2rmumooo0altniieiyslmDuauvpn(4altoxf oadlpDr n i;t s2trir3iodllt mfvi tfa2rax  nt0opxomfeilslsDum(vonu)tetriocoo1la rlu s;s0 rtmiopiy4amtnlietlt srraurooo0optnmfetysfsDra( o;t)aexnmrcia1lpD luvs s  exo(m no4lm   ictasfsrumxrpnu1oexn ieiadfmDulnvsnu0 eermf tytlate n s ( texmxm3nydape mieiat artmxmo;o4alxomfciyslmDrl(vsnu4 ltomr3tytfp   ivil() 2xmirpiu4lptnmfci s  Drrumpoo4aeto icilsfa2elumont)aetnmf oadopD lues t0 rxoxm iudlp  mfvsatfs2ua(r ou0texnmietad a rluvo u)alenif3oy1op  anei s)t2uo(o3iydlpe  fvsls)s2trxront1ole  i3tlt s rmnvsnt) ltoioctytlpteaieol( truoio3iy1optelnct ()aruaxmpnt0teeomoeilslm2ea(mp;() etnxo ia1omtelu ol(  eurio3oydamtemnesls arua(m ot4opxn ietadfaDem(mpnu0 eeoxo3tatfp  auvs t0trumxo3oy1ome lfesa(faDumx onu0tlxn ieiydfm rlu s;t0 rerif oo1lpD  nvs;s0sexmio3iu4alte icsa() Dtrxro;u1tlto f3iytlm2rluvs u)texnmrcoy1fm   uvols seuoxo oo4al nlncs s aDraur oo1alt mfeias aDemu s u) reoir iodla rlneo;t)texo(m3oo1omt mietlsf Duax pou1apen fciydfm2uan o;u) exnxr io1fmDrlneolt  2urim3ou4om nmfcsa(  Dtrumpoo1olxn oeiatfm2umnvp;u0arenio iodlpDean ilt) rxrirpiu1lp  mfciat  2tmx  ou1tlxoiietydfsDrlu s (4alxnxr3iydfatrli o s0 2xr(rpio1ll  lfeiat  2uaxr oo0tpen f3iadfsDrl(vs;t0trtnircoatlpDeln sl() exmxm3nodlm nlnetls  2ur(r ot0texnmo3iydfsDran p;u0tleomo oytlaD aivo;s0trurxmpou4oltelivtatf 2rr(m ;t1apxomfciytfsDrmuvsn() lxnxfcoa1fa  aneo;()srxo(m io4omen nctas)aDuaxm ot4oee  i3iltla ulnvp u0trxrif iytlaDeln sl(  euo(opiy4llte fctatf Dua(moot0oetnmociltfmDra(vp;u)altomr oa1omDrau s;s0t2umxo no4lleemici ( s2raur ;t4oexn ietatfa ulu snt4 ltoifctatoaDraivsl( trum(mpoo1omeelnvias aDra( poo0ape  feiatls ranvp;u)alenxocty1fp eaivs s) rxoiopoydame lnesl()srtrx ooo0tlxoio3iydfsDrm( s t0artrxf3iy1fmDrauvi;(  etrio oo1al nmivi t srrmxmonu0apxo fctat m2eauvo;(4aexnif oa1opDrlueo;t  exm(mpno1ope mnvils)artax ooo0alxnioctytfa emumsn(4trtrir oo1op rli ol(0s2toxr3oodlpen fvtatfs2rrxroot0alxnio3iydls2rmuvon(0 lxrio oydla  lnei;t0s2urxr iodll n ivs tfs2rau ont1olt ifeiasfs eln p;t0arxrxo3oa1laDeluvi s)teum(o3ou1optemivs t  2raxr ou0tex ioeilsfm uauvs;(0 etnxr iydfa r ivi s t2xoiopiu1oleemncslt) Dtm(  nu1tlxn f3iad m2ua(vp u4aexoxr ta1lat  nvi;( s2xriopno4amtnliet () rrru  ;t0tpxnmictysla2rmu onu0 exrif3ty1faDrau ol(0 etrio3oy1olt mivslt)sDta(mp;o4ale mo3iys mDel(vsn()altnmf3tadlmDrau olt)s2trxrpoydlp n ietas) Drr(moou4olenmo3iytla2elnms ()aetnmf iodfaD  nvo;t0trtoxr3no4alenlfeiatf 2taxr ;t1tee ii3ilsfm2eanvonu0arenmf3oy1omD  n o;s sruoxm oodopeelfvt ()sDtmurono1tpx ifeiat a ra(vp;t0trtoir iy1la  auvo;s0srtr(m3no4lptnmiesat  rumxmp;o4aexn ieiasla2rau pnu4aexnmrcoydfa ran i;s0 2xr(o3no1lp e netat aDumxmont1aleo ieias a2em(msn() exoxr3iytoptr n o;t s2um(o3iu1oleelncia() rrru  ou1teto i3tltlsDra(vp u4 reoxfcta1oa  luvsls0truoir iydol   nctl() Dtaum ot1tlt iictlt m2umnmo t)aleomr3iatoatraivo;s) 2tmio oudop  mfes t  Dtru  nu0tlto ieilslaDua(vs;(4 exoir io1op  ai i;s)teumxr nudameemfcsat srtaxmo;t4opx ifeias m uau p t)texomf3ty1lm  auesls)setrirpiydamt  ict t)sDtmuroot0openii3tadfs2ean ont4texoxfciatfptr uvsls0 2urxm3iodol   nes ( aDrrumoot0aeeniiciys a2umumpnu)tltnxr tadomDrlu s;(0trxr(r iu1llenmict s)s2ra( p;o0aet miciyt s2emu s u)arerxrcoytfmDeli s;t0trtoxo oy1apt  fei t) 2raxrpno1oltomi3tatls umuvpnt)alerxf3oodfpteaieilt)seurirpiy4ol n fetat  rraxr ;u1tlenio3ils s2ua(vsnu)alxnmoctydlp rauvi;(0 exrxmpiy1ape miei (  rrm(rpoo0alto ietadfa eaumonu4aeenmf io1lmDeaivs s0setm(o nudlp nlieilsfsrtmxro;t0olt iictas aDrluvp;(4arxnmocto1oatelivo t0 exm(m nydamtemivs t) ruax onu4apen oeils a2ran p t)alerir oy1lpt  ues t)truo(mpoodlp  lfctlsfsDurumont0oleomo3tasls2rl( pnu)tlxrxf ty1lmD lneo;(0t2umirpnydal nmnvtlt)aDrru  oo4tptn oeiaslmDrlu pnt0 rtrmf3iy1omte n olt)srtoirpoodoptn icta(  rraxront4oexoio3iytlmDul( s;() renmr oatopD auvi ( t2to(r3iydalte iei ( artmum nt4opt ifcilsfs ulumpnt4 exrmrcoydfm rlnvo ()sexm(m ou1lm nlivtasfartmx p;t4olenii3ildlmDemuvpnt0aexomr3iytfaD li s;s0teuo(rpio4ll nmfvtlt) rtmx o;t4aeeo fciydlmDuln o;t4tlermrctotfa rlivo t)sexmir nu4al nlfvi s s2tax pno4tptniicildfs2rau p;t0texoxr ia1optr i s t)truoxm3io1ame mnct (f Dur( poo4aet mo3iltls2ulumsnt0 rtoif iy1lmD luei;( trumxrpoy1omen fvs tf 2rru  ou4aeto f3tas m rlu o;() renxfciatfm   i o;() 2xmxopoudlle livsls sDrrur ;u1tle mi3ild sDeaumpn(0tltoxo iadopteauvo;s)srtoxr3nu1alt mnvt tfartru  nt1apeomfeiysfm2emu s u)arxoio3tadopt aieols) 2uoxo io1omtelneiat  2urx  nt1tltnmietysfa2rauvsnt0altnif3oa1om  aivo t)srumir oydam n nes ( s2rrum oo1opxoiiciytfsDuan pnt0arxomo3ty1lp e uvolt)srtoxopoo4olt lncs ()aDua( p;t0aetoii3iltlm ea(ms;(4 rtrxr3iotoate ivil( sexoxrpoy1op elfviasfaDraxmpnu0oex ifciadfm2em( ont4aexnxocoytfm eliei t)s2toiopoudop  lfetls)srrrxr ou0tee  oeils a um( sn(0teeomo3to1omDrli i (0seur(rpoy4omtnlici s  rumx pou4apx ii3tlt a uanmsn()tleomrcoa1lmteaieo;s)setrxo iydolt mictls aruaur nt1apt mfciltlm raums t4 rtnmf oatfaDeli i;s  2xrio3io4lme miesl()a2uax o;o4texnmf3iydla rmn s u4tetnioctotomDe uei s) 2xmim3oo4apenmnct (  2urxro;o0apenmfetlt a rmnmpnu)aetomr3tatlat  u o (0seuoim oodopen ivias)srraumpou0apt ioeilslaDumnmp t) rxomr3ia1lpD lu slt0s2ur(opiu1aptnmivtasfarrm(rp;o0tpto f3tld a2rmnvo t0artoxocootopteanes;t0 exoxm oodlp  licta( s2um(rono4ope  i3iasls2rm( s u) exrmocoydfaD aivs;(0truo(r3oodlpenlicil(f Dumur ot1alx  o3iyt s elnmo (0artrxrciotfat  n i t) 2urxr oo1ol nlncs s)s2uax p;o1opxn o3tydlm2ran s (4aexoio io1fateaiei;s0 2uo(m3ou1apenlfetls  rrmumono1aeto iciydfsDuau o;() lxnif oytfmt  u s;t0 2umxopny4alt livta()aDraumono1opxn i3ilslaDeluvp;t4alenxo3ty1optrlneo;(0srxmio ou1apen nctlsfs2trx ooo1tpx moeils a ulumpnu4aeerxrcoydopDeluvi;s s2uo(m oudop  lfctat)aDtauro;t1tpeniictlslm rm(mo u)arerxf3ia1lmtr ueo;s srum(r oodop emivsl(  2rrxm oo1alx  f3ildlsDranvp;t4alxnif3oy1fpD anvo () eumir3oudlmt  icia( sDuru p;t4oexn ieiys m ul(mpnt)teermocoytlmDr ueo;s trur(rpiy4aleemnviat sDrr(r ot4tltniieias mDrlnmp;() etnioctadoateanvil()trtmxm oy1omt mfct tfs2rrurp;o4oetoiiciytfmDrmnvp;u0tltrmocia1oa elivs t0teto(o3io4amenmfcslt)sruaxm no4tle  feilsfm2ean p ()trtoxf oatlptrlneo t sexm(opio1am  mietas s2uaxrpnu4aeenmo3iat s ra( pn(4 eerxr3to1fmDe ueo s sruoxrpoo1lmee ivs s s2ra(  ;u0olt moctytla2uanmonu0 lxriociatlm rlnei s)texmxopiy4ameemfvtl() Dtmumpnu4tpx mo3iat m2elu o;(0 lxomr tadoa  ai o;s0sruoxr nudlme lncs sf Dtmx pot1ape  ocilt aDumnvpnu0tlenmoctytlmDelnvi (0 2xmirpny1ol elfvsas  2rru p;u1apen ieiad aDem(vp;t)altnmo oy1fm elu i;t teumxr3ou4ome  nctatf 2rmxmoou1aeeoioeiydla2rau s;(4artnxo3oodla r ies (  rumirpnu1altelnct sfarur(rooo4tetomieilt s rm(vsnu4tetnxf iatopD lieilt)t2to(m nydam n nvtatfarrau o;t1texn ictltlsDulu onu0trtrif3iy1la  anei (  rtriopio1llenmnvia(fsDum(rp;t0optomiciytfaDrlnvo;u) exoxf3oatlmteanvo s0tetr(mpoudlpt lnctlt  Drrx  ;u4olxo fciltfm emnmonu4 renxo ta1op  liesl(  2toxrpiodapen iet tfsrtax  ;t0oexn ociaslm elnvo;(4 renir3tadlaD an i (0teuo(r ou1omtelivsat)s2uru  ;t0aex mictytfa rm( sn() eenifcta1la r uvi;t0 rxoimpnudope mnviat) Dtrxr ;u4opx  iciasfaDel( pnt0trxrircoytomtraieslt t2uoxm3no4lle lnvslt) Dum(m ;u1oex  f3tyt aDem( s (4teermo3oadfm ran o;() 2uoir3iu4lmen fvs t)sDtr( p;o1tlenmiciad aDua(vp (0trermo oy1opD  ivo ( t2toxm oy1lm  micsas) rum( p;u1alxo feiyd m2ran p;(0 ltrxocoytfp e ieo t)tetoxm3iu1am e fci ( aDrau  nu1opxo i3iltfaDem(vp t)texrircoadlpt  nvils)tetrxrpnydap elfcs s sDtau  ;t1tet mfeiatlm2ea( o u) ltnxf3oa1faDrln ol()texr(rpoo4amenlnvsas)s2umump;u1tpx ioeiad s ulnvpn(0aexoir ty1laDr nvilt)sruo(m3nodllt mfei (f Dumu p;u1apx mi3iatls uanvo u4 reomo3totlmDrluvo (0truo(o3oy1amtelncsat) Dur(  nt4oee  fetatfaDua(ms () rerir3iydfm  lnes () rum(m3ny1om n nvslt a2ta(  nt1oexnmoetydfm2rmnvpnt0tltrmf3ty1laDeaies;t) rtmxmpoudameemict tfsDrrxmpoo4oexoioeiltlm2eln snt) eeoxo3iadfa   u o;t srumimpnydape  neiasfarrmxmo;o0aleomietltfaDemums t4 rtnmocootfmt anvi ()trxr(mpnu1optnlncsl( srum( ont4opxnif3tltfa em(vs;u0 lxrir oo1fp  anvols)trxrxr no4amenlfctltfsDrrx p;u4optoiietlsfsDrlumont)aetnxr iydfaDrlueo t  2umio3ny1lltelfeiat)sDum(  oo0teeoioctydlsDua(vo;u)areoxrciatlp ean o s)teto(rpnudlpeelfvias) Dua(r ;o4oee  feiltfa2elumon(4 rxrifctodlateliei ( trxrio oudaltnlicsl( sDtrxm nu0teenmi3tlsfm elums t0trxrmo3iodlaDe ieo () 2toio io4alt  fcsasf rtaxrp;o1olxn i3tyd sDuanms t4aetrirciatoaDeluvs t  rumxopio1lpe mncta(fsrraxr oo0tpeomocildlm2um(mo u) lxnio3iodlm e u o s0seuo(opio1omen fvsa()s2umumpoo1tpe  f3iytlaDelnmsnt)areoifcoodopDr nvo t  rtm(rpoydol  lict (f Duau pnu1tpe ifciys m2ra(vonu4altomf ia1fatr ieils0 2toir ou1ll emnvsa( s2rr(mpoo0alxo ocilslaDumump;u4 lxrmf tatfmDrlnvs;t trum(m3oodlpe lieia()srrr(  oo4oee mictatla2eaump (0tetrif3oodoa e i s;s) 2uo(m oodameelfvsa(fs2uax ono1tet miciadlm2rmuvsnt4 rtnxf3iotlp rlneslt)trur(r3iu4oltnlnvt tf rumxr oo0aleo f3iltla2ea(mp;t)texrmocoadlm r n s s0sexmir io1alt mnct t arurx  ou1aex ifctlt a um(mp u0aleoifcto1lp e ueo s0t2xo(mpoy4amen ieta( a2raxro;t4oee mi3tadla umnms;u4arenxf3ia1oa elu olt trtoxo3nudll e feias  rtrxroot1tptn o3iadls2ulums (0tleomr tytla r i i;t s2uo(m3io4openmictl()srurum oo1tetn feiltfs rm(mo u0teenmf tadlmD luvo t srtrxr oydoleelfvs s
\ No newline at end of file
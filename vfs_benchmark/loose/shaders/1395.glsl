@@ -0,0 +1 @@
+uei t0 eum(mpiydole mfetat) rtr(rp;o1alxomo3ilsfa eanvs (0tleoio iodlaDrau i;s s2xm(mpiodlmtelicia( srtru p;u0tlenifciysfaDemuvs;t0trtoir3ia1lm  au i s) 2trirpoo1amee fcs t s2tmx o;u0aex ii3iadla el( s;t)alxnio oatop rli ilt  exmir3no4oleelnvi tf Dtmu p;u4tlxo o3iaslm2ulu s (0 rtnxf3ta1fpD  ivs;t)trtoxrpny4lm  lfvi s s2rr( pno0ole mietytlm rmnms;u4arxnif oydlpt an o ()trurxm3oodll nmfetlt arumurpot4tetnii3tadlm elu pnt0teermfctadom rlies s)s2xr(opiodame mfvsasfaDuaurpno1tpx  ietatls2rl(mp;t)texnmo iodom  lies;s t2xoim3io1al  lfctl() 2tmur ;t1tptnifeiydla rau p;u0 rtoirciadfateau sls0trxmim iodom   nct ()s2rrxr ;o0apto fctltla2ra( o;()alxoxr3oy1lp e n i t  etmxr io1amtnmnei s s2raxmp;o0oeenio3iytfa umumon(4tlxnxr3oo1fm r n i s0setmirpny4lmen nvsls aDtaumonu4tpe if3ilsla2rmn snt)treoxo totlm  livi;t  exrio3iu4lleelnct sfaDrr(mont0aetnifciatfs uauvo t)altnmrciadlm raivs ()srur(r3oodaltn neia() Dtrumont4oetomietltfs emn p;t4 lxoio iotlpDe uvol(0s2xm(opoodlle  ivia(f Dumxmp;t4texniicild a2uaump t4 rerxocoa1fptrli ols teumxo3nu1lmen icias) Dumu poo0oltoioctys sDeau p u4 eenif ia1oaD  ivil() rxr(m io4lmeelfct s)a2ra(mp;t4optn o3iatla em( o;()trtomr oatfpte ivo;t  2tr(mpou4llt  fvs s aDrmxrp;u0oetn ictlsfm um(ms;(4arenirctatlmt lu o t)t2xmir3oodamt mfcta()arumxr oo1aeeo icils aDrln ont4 exoxf oytlp eauvils t2xmxr nu4ap emiviltfa2tm(rpnt4apt ifeiyt mDra(vpn()arxrif oa1omDr nvs s srur(r nu4altemivtls)a2taxm no0tpenioeiydfsDelu p;u)tetrmrcty1laDe n i;t) euo(rpno1ome  fctltfsrrau p;o1tleoiiciyt s umnmont) lxnmociadopteau i s0t2xoimpno4optnlnvs sf 2rrump;t1ale  ictas m ua(vo ()areomrciytfmtrli s;t0srtrirpiu4lpenmfvsas srtaxrpnu1aleo oeildlm ea(vo;t4tlenmo iytlp  aues;s  2xmxo nudop nmieils)s2raxr nu1texomi3iat a eauvs t) rxomr3oy1fatelnvil() rxo(m oy1apeelfci t) 2rm(mp;u4tpen i3tld s2ua(ms;(4 lenxr3ta1fm eau s;s)sexmim no4omtnlfes (f rtm(mooo4aleoiieiytlm2um( p ()teerircoatomDrlivil(0sruoxm3nudomt mieias) 2tm( o;u1aexomietlsls2eaumo (0 lerircoadfm r ieo (0teto(r3nu1llt  nvs sfs2tm(m oo0olxn iciadlmDemumpn()artomr3iotla   neilt0t2toxopiy1optn fetasf Dtrx pnt1apeo fcilt a el( s t4trxnxf3oydoate iei t trurimpoydoltnmnci t  rua(r ;u0oee  o3ils s2rln s;u4 lxnxfcoytfp  an olt)trxo(mpiu4apee iesas)srrmxmo;o0oeeomoeiadlaDrlnms t) rxrir3totoa eanvs;t0 ruo(m ny4olt mieilt s2urur ;u0alx  f3iydls2uan onu4tlerxo tydfm rluesl() euoxm oo1omenmnvt sfsrrrx p;o1tptoif3iaslsDraumon(4tltomf3oy1fp raneols) etmir oydamen ncilt) 2tm( pnu4oetomocilsfs2rmums;t)tltomrcoydlp e uvo;t setrxmpnu4apt lnctatf 2trx pnt0apxomi3ilsfa2ua(mp (0altoxr3oo1lmt an o s  2xo(mpno4ll elieiatfs2rrxr no4oeto oeiysfsDrl(mpnt4tetoir3io1omD  ivslt)setmxrpio4ll n ieil(faDtaur oo1teto fciys a2rl(mont4aeeniociodoatrln o t0 rtriopoy1ol emneia(fs2rm(mpoo4tle  ociydfa ul( o t4aeermr3tydoaDrli i ( srxoxm iu4alenmfvt s) rta(m ot1aee  i3iadfm rl(vs (0teeomr3tatlaDr nvs;(0texrxr io1om  mnetas  2uax p;u4optomo3iys s emn ont)altnxo ia1laD  ivsl(0 eumimpnu4optn ictls) Dumxmo;t1aptn fcias a2ra(msn() lxomo oytop  ln o;()srxm(o iy1ll e ncias)a2tm(m ;t1oex  fetytfs2eau s;()altnmf3iydlmDr nvs;s0 rurxo3iy1ome lici t a2ur(rp;o1ope mi3iltla um(ms;u4 eermo oodoatrln ol( srxoiopou4lm elnet t arum(mont1openmoeildfm2ea( o;u4 ltrir oatfa  auvi;s) rur(m3iydap   fvia(f 2rru onu4tex mfctls sDemums;t)arxrio3oodlaDr nes (0setmim no4lpenmfci (fsrrm(rono1tetomociysls2umn p u4altnxo ta1om r neols0 euo(o3nodom emnvta(fa2tr( o;t1ale mi3iysfm2eanvont4 ltnxr3oodlmt anvsls setoxo oo4ameemnviat  2ra(rpno1apenif3tls s rl( p t4alxnmrctatlatrli o s seur(o3nodll n fciat) rum(  oo1alenmf3iytla elu s;()tlerio totoa  lues t0 eurim3iudlpeelict ()srra( pno4oetoii3ild mDrmumonu4arxoircoy1lp e ivsl()teuoxm3ou1altnlfvias) Durumonu1oltnifetat mDem(ms t0tetomfciytlatraieil()srtr(m oo4alen feil( arururoou1tpe  ieiytla2emu p u4aexrmfctydfm e uvo;s)setoir oo4am n nvi sf Dtr(rpnu4tlen oeiyslm emn onu0tlenxo3tadop rlnvol(0tetmxm3oy1amtnmivs t)srrr( pnt4oleomociysfm2rm( s;u4treoxf3oydop elnvi;s) 2uo(mpnu4lmtnlnct () 2tr(mp;u1apen ictldlmDeanvo u)treoxo oytomDraieo t truoim3oo4alenlfet t  2tax  nt0apeo ictasfm ra( s u) eenxocio1oa e ueolt0s2toiopou4apen ncsat  2urumpnt1alxnii3tasls2umnmsnu)aexrirctodopD anesls0t2trxr3ny1al nlnvs s  Dtau  nt0alxo o3iatla ea(mo;(0tlerio3oo1faDeaneolt0srum(mpiydlptemfvi (  2uaxmp;o0aeto i3iatfs2rmn s (4 exrmr oytla eaieo t0teuoio nudalenlfvsasfaDraumo;u1oexomoeiat s eln pnt0tetrxo oy1lpDeln sls0texmxrpoydlp  lictasfsrrru poo1olxnmfeils a rl(mo t0 rxrmf ty1fpt  nvsl( t2uoio ou4olte fcsasfsDuau p;t0opxomoctadfs2rmuvs (0 etomr iatfmDr n ils  etmim3oy4olt  nci ()a2trxroot1texnmoeiys sDelumo t0arxnxrctytfatraneo t)t2tm(rpiu4oleemict ( a2trxrpoo0teto ociasfsDumnms u4tetnxf3oodfaD lu s ( teur(m3oydaleelfcta(  rurur ;o0oeeo i3tlslsDeanvo;u0alxnxf oodlp elivi t0trxmim oodomeelnci s) Dua( pno0alxnmfciaslm2eauvonu0tlxrif iadla   uvi;(0sruoim3oodlleemnvt sfsrrrxm oo1altoioetltls2rmn p u) rtrxf iotlaDelivo;t0tetoiopoy1amtelncslt  rua( ono0opxomfcilslm eln p;u) rtomf3oadlm rliei;s srur(m3ny1optelnes t) rur(rooo4apxnmociaslsDrmnvp;t0artomf3ty1opD  neslt t2to(mpou4aptelfvs t  rtax poo0oet ifcildlmDel( pnu0teeomf3oy1faDelieols t2xr(o3nodlmeemncsl(  2rr(rp;t4aee iieiyd a2ran ont4aleoxo to1latelnes s trtm(mpoodlptelnvia(fsrtrur nt0alx iietyd sDem( o (0altrxr3iatfpDrauesls0 2umxr nodap elnvs t) 2umxrp;t1oltoiictyd sDulnvo t4trtoxo3ia1fpDrli i;s  2toir3io1ol n fesa()aDurumonu1apeomi3iadlmDea(mont0 etrif3ty1fpDr u sls seurim iu4lp nlfcil() 2ra(rp;o4apx ii3iatfs rm(mo;t0 rtrxfcio1om eln sls  rtoxmpiudll emfvtlsfsDtmx ooo4olxnmieiltlm um( o;(4 reoxr ty1lptean sls0sruo(rpiydomtelivt sfa2umu o;u0optomfetlslsDum(ms;(0treomfcoadomDrauvi ()trxrio io1am elfctltfsrrm(rpou4olen feiydlm ra(mpn() etrxo3tatfmtr ueils0s2xrxr no1ol n nes s  rrr(  nt1opx ioctatla em(mo;t4arxomr ootlmD  i s t) euoxo ou1ome mnctls s2taumpnu4tlxn ieilsls emn on(0 ltnio3oodom  anvs;t) 2to(r oy1oleemnesas  2uaurooo1tptn i3ildla2ra(ms ()trxrio3oo1oa rli o s  rxoim3oy1opee fcs sfarrr(mpoo4ape iictldfa ranvp;(4arenmfctodlp rlieo t teumio no1oltnmfei t)s2raxr ;u4alto ociydfm2umnvpnu)tlxrxo oadlptelu s ( tetr(m oudomtemneiat aDururo;u4ape moetysls2rl( o;t4aetnmfcoytfatelneil(0t2tmio3ny1omeemfcslt)srrru  ;t4apeo ietas aDulu o;u4 rtnxo iadopD lu o;s)truo(o3nu1amenmivi s arrrurpnu0tlxo feiadfm2ul(vs u4 reomociatop r nesls)srtmiopoo4om emici t)aDrr(  ou1ope iictyslm em(vp;u0trxoxr iatfpDrlnvol(0seumirpoodlptemnvi s)srumxrp;o0apeo ieiydla emn s;t4trtrxr iadfaD au sls) rur(rpoo4al  lnei t)s2um(root4tet  oetatlsDran ont4 ltrxo iodop e n o s tetm(r3iy1lptn nei ()a2tmur ;t4olx mf3iyd s eanmo u4alxnir3oo1oaDe ivsls)srurxrpoodlpe lieslt aDrm(ront0alxomoetldlm2ul(mp t)aleomrctydfaDr nvilt0s2trxr3oydaltn net s)sDrr(mp;t1olx mo3ias m2rln s;u)tetrio todoaDraiei;t0 2urxr3iy4lm e fvi tf 2uaxronu1aptn fetldlm umnmp u4aexnxrcta1omD  n olt)t2xrxm3oydomtnmnvilsf rta( ono0tlto i3iltfa eanmp (4arxrif3oydfaDeaivo s)sexo(m3oydlpte fviltf Dra(ro;t0alenmi3ildfmDeln p u0 ltrmfciotlaDraieo s  2xrxmpou4ome mnvi (f 2umumoot4tpeomf3iydls rlnmo u4tlenif3oytfmDr neo;( trxr(r nydlmenmfvsatf ruax  ou0alxnmoeilsfmDulu s;u4 reoxo3oadoatelivo;t sexrim iodame  fvi tfaDumxro;u4opx iictldlmDua(vsnu)artnxrctodfptrauvils seto(mpny1lmenmnesltfartmurpoo4opxo ietyt s elnmsn(0texnmo3oydfa  aivols0t2tmxm ou4amtnmieslsfarrmurooo1ole  oeildlsDrmn o t4 leoio iytlm  li o t setm(m io1ome mnct tf Dua(  ;t4apeoii3iasla2ra(vs u0arxomo tadfmte ivo t) rxoirpnydap elnvsas)s2uax p;t4apxomo3iys m2eluvo;u0alxnmr3iadoptrluvo s srtoimpiy4ope  ncta( srurur nt1oeeo i3iatlmDulnvp t0tlermf3iotfaDrlivo () rxoir iy4ap e nvs t)sDtrx pou4apeoif3tatlm2emn snu4alxomf io1om eli i;t)trum(m nydal e nvsatf rumxroot1tlx ioeiytlm ua(mont4trxoxocoy1lm  auvi (0texmxrpnudale  nct t arua(rpot1alt mfciytla umuvs;u4arermr oo1fpDe n ilt s2uoxrpnodap e fes (faruaumono0opt ifcildlaDra(ms;t0tetoircty1omDrlneol()t2xmxrpny1op emieils)a2tmur ot4oeenifctadla um( pn()tlerxo3oatoa rlivs;(  etrxo3iy1am n ivsltfsDumur ;t0tlx  iciad mDra(vp;t) renmfctatla r i o;()srxmio iudap   ieils  rtrurpnt4teeniieilsfsDranvsnt4 rxnifctatomteaies ()s2xo(r3nodlm  lneilsfa2tax ont1aetoio3ild m2em(vsnt4aeermo todlmteaivs (0t2xoxr3oudom e ietasfsrtr(  ot1tpto i3tytfs2um(vp;(0altrmo3totfa e ivol(0seum(r3oo4ape  nvtat  Dumur nt4oex  ietydla ra(monu4 eenxrcoy1fat aieols0trxrxopny1ap e nvsat) 2tmxrpnu0tlxn i3ilsls2rau pn()arenxo iydfat  nvs t0 2umirpiudom elnctls)aruaurp;u1olxoifciasfm umn s;(0trtrmo3tydopDranes s  2xmim3iy4amt mivt t) 2uau  oo0olxn fetltfm2ua( p u4 ltoio tadop rai o;t seum(mpio4oltemivtls)aDtm(rp;t1aptnmieilslmDelnvp;()aexrirciytoa r u ilt0 etmio3iudomtemivilsfsDtrxmoou4tlx  oetas m2um( s;t4 renxr iadfpDr ieolt s2uoirpnydolte icilsfs2uax  oo1optoio3tldfsDelnvs;u0aetrio3todlmteluvsl(0 ruo(mpoo4ol n fei ()aDuaxmp;t4olenif3iyt sDeauvpnt)tlerxrcoo1lm eli s;s)trxm(m3nodlpte icsas  2ua( p;u4aptnio3iadfaDran s;(4aexrmf oydlm eauvils)sexo(opoy1omtnmivil()arrr(root0teeo fciadlm rm(vsnu) eermo ta1om rluvil( teurxmpiu4ap   icia( sDumx  no0oet  oeilsla2rlums;t)altomrciodla rlues t srtm(mpiydlmenlnvtl( artmu pou4aexnifciadfs2rmnmpn(0aeeomf oodfpte iei t  rxm(rpoydoptnmnesatfarta(r nt1opx  fetaslsDra(vs () ltnmf tatlateauvs;(0srto(mpiy4llen nvi tfarra(r ;u0tleomieiytls uanmsn(4tleomf3totfaD  n o;(0 rtrxo iodlmenmivilsfsruaumont4apt  ieiys s rlump;(4 renio3iodomD aies t0seur(o3oy1amt  fctl(fsruau  nt0apt ifeildfmDranmo u)arxomo oadlpteluei;s) rxmio3io1oleemiesat)a2trxr ;t4apt mfciasfm2rln p;t)tltnif totlp eanei;s0srur(o io1op n icta(fsrtau  ;o1tlenmociydlmDrm(ms;u0 etomr3iytlatrlneolt0seur(r3oydolt lieilt) Dta(rono4apxnmocildls emu pnt4trxnif tadfmtran s t) 2xrxm oudlm n ictl(  Dtm(rpot4oltn fcildlaDumu s u0 exnir tydlatelueo;( seumir3iodlle lnvs (fs2rrxront0alt mocild sDrl( s t0 lenircty1oa eauei t0s2um(mpiodam nlfes t  Dtrx ont0tpeo fctadfm2ra(vp;t)aexnmr oydlpDr uvol( texoirpiy1lp nlfcil(fartmu o;u0optn feias m2rlu p ()areoif oo1oatrlieilt)trur(rpno4optnlfesl( srta( o;u0aetoii3ildls em(vo;t4 rxoir3iytomD ai i t) 2xmirpny4amtemfvsas) 2tm(mp;u1tlenmf3iytla2rln o;(0trtomfciadfat  nvs;t  2xmirpiu1al  miet s  Dtmu pno0ole  o3ilsla ean o;u4tltrif3iytomDrai ilt0seto(rpoy4ome  nvtasf 2um( pou1apenmieiat m emnmo;u0tlerio to1opD aueil()s2trir3oodap emnei tfarra(m nu0oeenif3tyt a2um(vp () eenir3io1omD ln o;s0sexoxr3io4om emnvt s  2trur ;u1oexomietad sDrau s;(4aetrio iotfptelnes s t2tm(o3ny4oleelfvs ( s2rrx  nu0tpenmf3tysfaDuluvp (0aexrircio1oateanvs;t  rur(m3iudaltn iesl(fs2tm( ont1apt ioctysls2umu sn()treoxo iodfmDrlivi;t0 2xr(o3nu4ope mneilsfsrrr( pnu1oleo o3iatfsDum(vs (4aetnifcty1fat au o ( t2toim oy4llenmieil( aDtrumoot0alt  fciadfa2rmuvs u4 rerxrciydfptrln s s)srxr(m3nodapeelncs tfsrum(mono1tlxoioeiytla ua(mpnu4 etoio iytlm  lu s;t)s2xrxr3nydol nmict (  2tm(r no1ope mo3tlsfmDemumo ()tlxoio ootoatrli o;t t2uo(r3oy1apeelfeia(farrrump;o0tetn fciysla uau snu4 lerxrcoytlp  an i t  etr(opoo1aptn nvia(faDtmurpoo4aexniictaslm2ulnmo;(4artnmf ia1opDe iesls0 exrirpiu4aptnlnetas aDrau oot4oleoii3iyt a uan o (0texomr3ootopDelneo;(0texo(m3nudap nmivsat a2ur(m ;o4opt ioeiytla2rmu pnu0tleomo3tadlaDrlivol() etm(rpnu1apt  netat)srum(rpot0oex  o3iytfs2rmuvs;t)tleoiocia1fa rlu i;(  rxm(m iy4om nlnesas sDtr(monu4ale mo3tyt a ra(mp u4trxrmfciadfmt luesl(0srurxmpnydame  fvslt)sruaurpno4tpx  feildls umn o;t4areriocoodoa  aivil()texo(m nu4lm  mfvtls)sDtaxmp;u4teeo feiyd mDulumpn(4 rxoio3totlpDe uei ( teurxo3iu1ap  lfesat a2um( ono1opx mo3tldfa umumo t0 exoxocoatlaDelueilt)s2xrxo3nodop nlivslt) 2umum nu0alt  o3tydfa rmu p u0alxnxrctydfmt  u ils tetmimpny1lmt mivsl(fs2ururp;t0apt ioeiydlmDrm(vp;t)tetnif oatomDrluvo (0seto(r ny1al nlivtat srurxrp;o1optoif3tltls ul(mp;u0aeenxo oa1lmtrln o;( trumxmpno1aleelieilt) rua(root1aex if3ild sDum(vo ()aeenxf3ta1fa e u s (  2xoiopoy1altn ictat)s2urx pnu4apxn o3iatfm elnvp;u0 rtomocty1op  luvols  eurir3nu4al nlneia() Duaxm nu4tpxnio3ilsfaDrl( s;u) etrifcoytlatranei t setrxo3iodol nlieils artmu o;u0oleoiietytlm eaumo t0 ltomf3iydoptelnvs (0trurxmpiodome mieia()srrrxm ot4alxomiciat a2rl( pnu0 renxfciatla e ivi;t t2xr(rpoy1openmncta(faruru p;t4aexn iciad s ean pn(4trtoif iydoateaieols0teurirpiy1ome  nesasfarrm(r ;o4olxniietltfa rl( o;(4 lenxo3iadfmteai sl() 2xmxr iodop  mfvt sfsrtmuront4oet iiciltlaDea(vo (4alxrir iytfpD  n i;( t2tmxo no1am elnei t a2raxrpnt0tptomf3tytla em( on(0teerif iydlat ln s s  2toxm oo1lpe  fvs (  rrmur ;o1alxnmietad sDuan p (0tltoxociatfm   u sls  eumxm iudope lfcs t)a2trx pno0apx ioeildfm emnmp (4 exrxf3iatfmtrlivols)sexr(r oo4ap nlnvsltfsruau  ou4tlen feiyd aDum( o;()tetnmf iotfatran olt0 etrxo ny1alen ncs t  2rmxrpnu1tleo feiasfsDra( s () leoiocoydlp elneil()sexrxr3nu1oltelfetltfa2trump;t1tptomf3iyd a ra(von(0trtoxfcootoat au i s trxoiopoodll  mnvs t)arrrxrooo4alxomo3iltfs umumonu) ltnmrctodlaDeln s ()s2triopnu1amt mfvtls srrmxmpoo1oet mictatla ea(vs;(0 rxnxr3ia1oa elivi;s0srxmxmpnodol  lnvtasfaDra(mpnt1apt  ietat a2umnmpn(4 ltnmr iatfp eli slt t2xoio3oo4lltelfcs sf 2tau ooo0teenmo3ilt aDem( p ()tltnio oatom elieo s) eumirpiydoptn ivtl(  Drmumont4oex  f3iydfm ean p;(0artrmr ta1lpt auvo t0trxr(o oodll  mivi (fsDrrx  ot4olxoif3ilslm uanmont4 rxomo3iadopte neo s t2xmxr oo4lltn nei tfa2tmxro;t0oetoifetadfa2rmu o () leoif iytfp ranvs;s0trxrir oo1apeemiesat) rtau onu0aptoiieilsfa2umn p;(0 lxoxfciodfm eln i ( t2uo(m3io1amtemfesls  rtrur ot0aexnif3iysfaDrmuvp (4tlermf iydlat aiei (0 eur(r no4lp e nviatfa2rr( oot1tlenioeiydlsDra(vo t0aetoif3oodoa eauei (0srxmxo oy1aptelncta(  Dtmum nu4teeoifeiad m2ea(mo () rtrif tytfa   ieilt)srtmim3iu1apen nvils)arua(  ;o4aptomoeiad m2el(mo u0aexnmo tadoaDeaneolt s2tm(mpiu1ole  nes s) Dtaur oo4tetoii3ildfa2em(mpnu0alxnmo ta1lmDraneols  rumxrpnu4al  mnvs s a2ua(  no1olxoioeiyslaDea(vo;(4tlxnxo oodlat lnvo () rxoirpny4opt mnvia()s2tr(r ou1oeenmocildfa2um( p;t) rerifciy1fmDrlueils)setm(o oydolenlietasfaDtm(mp;o1tex iiciat a2ulnvsn(0aetrmo3iy1oateauvo;(0 rtrxrpnu4altnlfes sf rraxront0oet iieilsfsDeln p;t) exrmf3oydopD anvi s)s2xm(m oy4lltelfcil(fsDta(  ;u4tpt mfetadlmDemnvo;t4trxnxo3oydlmte u i s  etr(opoo4aleemfes t aDur( ono1tpto o3ils s2um(vo u0teerxr3ia1op  aivo;(0trtmio nudam emfvtat  Drmum ;o0alxn ieiatlmDrmu s;(4tetnmf3oadlpDraieslt t2uo(r3oo4omeelncta() Dumxroou0aexn f3iyslsDemnmo;(0 etrir3oodop  aueil()t2xrirpiydomteliesasf ruaumonu1opxomiciysfsDemuvsn() lxoircootoa rlneslt  2xmimpiy4al nmfvsl()srtm(rono1oexnmfciyd mDrmumsnu)tleoxoctatomt aivslt0 exmio3iudomeeliesa(fsrurx pnu4alto fctytlsDeluvp u4arenio oo1fmteauesl()srum(opnu1oltemfvta( a2taxm nu1olenmo3iadla ulumonu0tlxnmociydlaDe u s (  rto(o3oodlp emnvtas)sDrmxro;t4ope ifctld m2rlnvp (0trtnxr iy1fpDrlnes s  2xo(r3ny4om  lncsas arum(rp;o4tptomfciltlaDelnvo u)tlxrxf iadfmte ivils0trurxr3iu1lmen nes t) rumxr no1optomf3iytla ran pnu)aleomocoa1la   nei (0trxmim3ny4ameelfcsasf Dua(rpnt0apx ioetydfm2umump;u)trtrmrciy1fpDr neslt0setm(r3no4oltemics (fsrtr(  no1ape ii3tyt mDrmnmp;() rtoiocoo1opDeaivs s) eum(rpio4alt lici tf rua(rooo0apxniociysla2ua(vp u) rtnio3oadoat  nvolt) euo(r nydap  mivil(fsrtau ont4optnioetas m2elumon() etoircto1latrauvs (0 euoir iydolee fvtas)aDum(m oo1oleo fetyt s um(mo;(4altnir3tatfaDe i s s)trtm(m3nu1amt mfetlsf rraxm oo1tlxomiciyd a uln on()tltomrciadfp e i olt)s2xoxr3iu4ll nmiei sf Dtaurpou0tlen i3iltfaDum( snt4tlerir3io1fa rln olt) rur(opoo4lp nmfciasf 2rmx pnu0oet ii3tas m rlump;t4 eeomr3oydla rauvilt sruoiopiu1oltnmiviat s2tm(mpot4apeoifctaslmDea(vo t0trxrxo tadfmteaivo;s) etrxo3iodlpe mfviat) 2ta(rp;u0tltnmfeild mDeanvpnu0 eerxo tydfptelu olt  rtrio3oy4aleemnes s  Draxmo;u1apto f3iadla uanmont0 renxocta1oaD ai slt  rur(opnu4apt  fcsat) rumxrono0teenmociatls emnmont) ltnxrcoydlpD lueo t s2urim3nydal e fesl(f Dtm(rpnu1olxomfctytfa2rlu sn()altoif oydfat anvo;s)s2umim3oo4olt  ictlt srtmxr nt0ope  ietldlsDel( s;t) eeoifciytoat livo;t0 etm(mpiy4lm nmfvsl( s2uau onu0teeo f3tyt m2emn snt0altrio ootfaD  i o;( s2trxopio4om emivi tfsrrmurpnt1optomi3ilsfsDrmu o t0tlxnmrcoa1laD anvs ()texm(opoo4lmt lfcs ()srua( ooo0oleoio3tysls ua( p () rxrmocto1lpte u s;s)s2xrim3iydamenlies s  rtr(r nu1ole mfeiad mDrlump;u) ltoxo ty1late i o;s seumio3no4om n ncsas)srumump;o0tpt mfetytlaDrm(msnt4alxoifcoadfaDe nes;s) exr(m3oy1lm e ivta(fa2rru pou0opx  f3iysfmDrl(mp (4tlxnmociatoat luvs ( t2umim nudap  mfesls a2uau pot4apx  fcilsfa um( pn(0 etnir oytlmteau s;s t2xo(m3nu4apt lfet s aDumx  ;o4teenii3ilsfaDum(mp u)trtoioctotfmD livil(0t2toim3nudal elncs t  2rrx poo1tlt ii3iltfa rmuvp (0artrxr ta1om elnvo t  exmir3iu1am n ncia()srtmxr ot0alto ictatlm2um(msn()aetoxr tydla eli s t0teumir iodlm  mnctlt)srrmump;t4texo fcils m2umums;u0tetrir oodomDrliei;s)trtoir3oodolenlneils s2urur ;o4oleoio3ias m2emnmo;u4 eerxo oa1optr ueolt0truoxm iudlptelnviat)aDtm(  ou4tptnmietlsfaDrau p ()teeoir3oatfm elivi;t  rto(mpiy1optemivsasfsruaxrp;t1tee  octltfa eaumo;t4 exrmrciydfpDrluesls0 2ur(m oo1am   fetat)s2taum ou4apt io3tydfs eaumo u4tlerxo oy1fm eaivolt  etoiopiy4lmtnmnesat srtr(mp;o4aexnmieiat aDuluvs t0 rxnxf3oytlp e nvs ()srtmxmpnydole  nvt t sDtrx p;u1tle  fcildlaDeau pn()aeenio3oytopDeln s;s) rtr(rpou1lpt lici s a2umur ot4apxnifeiatfsDum(mp;t)arxnircoatlp  an o t0setm(opiu1open iesa(fsrtaur oo0alxnmi3iltlm2ra( pn(4tlerio tydlm  ln o (0 2um(o iu4am   nvtls)srrau  ou4apeomieiyt mDumu snu0 lxnxf3oatomtr n olt truoxrpou1ol  licslsfs2rrx pot1texn oetlslmDem(vpnt0arxrirciodlmDr nei;()trum(r ou4lmtnmietat aDtmx  ;u4tleomi3ilsfm2eanmp u0areomo tytfpteaues s) 2trio3oy4apenlfeiltf rrr(ro;u0teeoio3ildfs umn p t4 ltnmf iy1lpteauvsls0tetoxrpio4altnlivs t) Drmxm ;u4teenio3ild aDua(vp;() rxrxociy1omte n slt s2xmxm ny4aleemncs (  rtr(root1olen feiyt m2umu s;() exoio oadoa eluei;(  rur(mpoy1olen ivia()aDrm(mpou4tleomietlt a uauvpnt4 leoxr iotlpt luvi;s0 eurxr iu1lmt mnetl(faDta( oot0teeniociadlm2eln o t0 eeomr iatfaDean s;s setrir3oudamt  net tf 2raxrp;o0apxnmieilt m2uaumont4 exnmo3oadoaDe nvs t0srtoiopiu4amt lietlsf Drmxr ;u0tpxnmfctldfa rl(vpnt4artnmo ootomt  nes (0 ruoio3oudal n feta(fartrx poo4tltnmiciadfa2umnvsnu0texnmrctotoatr ieol(  rurxr3iy4lpee fci s)srrau ono1teeo ieiadfs ulnvs;(4alxrmfciadoatelueol(0texoxo3oo1lm  lfvsl( artmxro;u0tlt iiciatfm2elu s u4arxoxfcoodomDeai i t texmxopiodopt mivt t  2uaxr ;o4tpeoifetat m rl(mo ()arenxfcoodomDe ivslt0srxrio3iy4olenmnvt (fs2tauro;u0aexomo3tytfsDuan o;()trtnmfciadlm   n i (0s2tr(m3iu1ome lnvsls  rtrx pot1ope iieilsla2elumo ()aetnmr to1oate uesls)s2to(rpoodome  ies (fsDrrx pot1alto iciysfa2ulumo;u)areomr3oytfpD anvi;t0s2xoim3nu1ape lietlt s2tru  oo1apeo oetysfs2rluvs;(0trtnmf3iadomDraivi s0 2urxmpiodapen neta( a2ur(mooo0tex ioetaslm2raump;(0 lenirciadoat  neilt  euo(opoy4llee fesat)arrmxr oo1olx  fctldfs ul(mpn(4alxrmr3oo1fpDraiesls  eum(r3ou4ll elfeil()a2rrxmo;t0olt mfciys a2ua(vo;t)teenif3oo1omt auvsl()s2tr(m3io4lme  ictltfartr(moot4apxnmociatfmDrmnmon(0altnirctadfpDe u o s) 2umxopou4lmeemfcs t  rra(mp;t0optniictyslmDumnvo;u4teenmfcoydfm ran o ( srxmio3iydlme  fctat)aDurxr ot1alxn ietltlmDuanvs;u4 exomo3iytopDranvi ( texoir3iy1am n nvta(  Durxro;u4olxomo3tytfmDea(mo (0tltrio3ia1oatraivs;t  eto(o iy1lpte ict t)s2ur( p;o0tlto f3ildfm2em(vont4 etrxo3iodfmDrai i s)srurxo3iy1opt mieiasfsrtax pnu0oexoiociydla rauvo;t4treomrciodoaD lu o s0trumxm3ny4ap n feta(fsrrau  ot0apt iieiytlmDua( o ()arxoxrcoodlptr nes s s2xrim ou4oltnlfvsas  rraur nt0altomfctlsls um(vp u4arerxo3iotlptrlieols  ruo(opnydaptnliet tfa2umurpnu0tleoioeiys s2elumo () rxoir ty1faDe ueils0s2xmiopiu4omtnlncsl( arumx  ;o4tptomi3ilsfs em(vs u4artrmf iy1fat aueo;t t2trir nu1lltnmici t s2umxmooo1oeeniieildfm2emums;t0aleoio ootoat an ols)t2xoio3iydllee nes ( a2rrumpnu0aleniietytfm uln onu0 renmo io1fpteluvils0trtr(m3oydaltn nvs tfs2ta( ont1aee iietyslsDumuvpnu)aexrmrciytlaDr i o;s0t2urim iy4amtemivil()s2tau pou4apx  ieiytfmDel( s ()altoxf3ootoat aneo;s0texmimpio1lptelfvtas  rurx ono1apto fetld m rauvonu4aleoif oo1opDeaivi s) etoxmpiy1op emfeiat sDrru p;o4alxnmictlt a2umu p t0 exomr tytfpDeaues t  2uoxr iy1ol nlieiat  2rru ooo1oee mo3tys m ranvo u) rxrmrcta1om e n o;(0srtrxm no1lm   fes t)a2tmxmpno1alenmfeiasla2rl( s () lerif ia1op e ies t)sruriopnudlpe livil( srrm(r no0tpxniieiat s ea( o t) rxomo3tatoaDe u i;(0s2umim3nu1omtelivtas)a2rr( ono1olxn i3ias a eln o;(0altoxf todfpDrluei (0tetrxm3oo4oltnmiet t arraxmooo4aexo o3tatlaDemnvs t4 reoir3io1faDrai s;(  rumxo3no1ll e ivil()srrruroot0oltomo3ild sDran snt0texnio oytfpt an o;t0teuo(opoudoleelfcsat) rtax pou1oee mo3ildfmDum(ms t0altrmf tydoaD aneol(0t2ur(rpno4lpt lfet t s2rax pou1tpto i3iydfm2ua( ont4tltomfciytoat aivs;t t2xmir3nu1op n ivsas)s2trxr ;u1tpeomieiysfm ra(von() lenxf oytoa  luei (0 etrir3ny1oltemicias) Dumxmonu1optnifctyt s rmn p;u) leoio3ta1laDrlnvi;(0 2to(r3ny1lm nlfcil()aDta(  ot0teenmo3tlsla2uau s u0alerxrcoodfpDeanei;( seur(opnu1lm  mfesltfsDur( pnt0olenmoeiytla emuvp;(0 rtoxf3iy1oatraivs;s s2um(m iy1om  mieiat srtmumo;u0olto fciat m2uln p;t0arxrxocootlatr n i t)t2tm(m3iudolen nvsltfs2rm(mpno0tet mietat a2elnvo u4 rtomo tytfpt li i t0tetm(o iy4optemfesl( sDuau ooo1alt ioeiasfs2el(msnt0treomr3iy1op rai i t) rurim3nydop   nvt (faDtrxmpno4tetomi3ias a2eluvo;u4teeomo3todlpt  uvi s) 2xrim iudlm  mfcslt)s2uru  ;o4olt mf3ias s ra(mo u0tlxrmr oa1lmtraivsl(  2tmiopou1optnmfctls  Duau ono1aeenmi3iys m2uau o u)teenxf3iodlaDeaues;(  rurxm oy1lpeelietl()sruaxmp;u0tee iictyd m rl(ms;u)artnif iotla r i ilt) etmxmpiu1am  mfvi (f rrr(r no1tltoif3ils mDemnvp;u0 etrmociotopD livi (0sruo(r3oodlpt  iei (f rtmx p;o0oleoiietas sDua(vo (0alxrio ta1op ean ol(0t2umio3iydap  lncsas artau ooo0aexoiieiadla2elnvp u4 eermr3oy1lp e iei ( trxmxm3nodaptemiesat sruaumpnt0aleniocildfm em( s t4texoifcoydop  lu il()t2uoxr3nodlm nmfeiatfaDrmu pnu1opeoii3iatfm2uluvs u)treomo3ia1omDelieo t srto(m3oodol elfvsltf rtru oot4tee ioetatfs rln s u4tltrxr iatfmte n o s0 rxr(r3ou1om e fvslt)s2ta(rp;u4texomfetldfa2eanvont4 rxnmrcoatfmtrlnes;()trum(r3io1al e icta(fa2taumpoo0optnmictadla rmuvo;() rxoir tatfmt lnei;()tetmiopoy4al nlivilt  rtrxmpnu1olx miciatfm em( p;t) etrmf oytlpDeanes (0t2toirpnodalte ivslt)s2ta(m ot4olxnii3ildls elumo u4tetrxo3tadomtrli il() eurio ou1lptn feia() rtr(rooo1oeto fciltlaDra(mo;t0 exoir3iadfat luesl(0 rtr(r3iydlpen ncilt arumumoot0alx  f3ild aDrm(vs t0areomf iydoaDeauvo ( texo(rpiudam nlneia()srrr(roou1tpeomoetydla2emnvon(4 rxrmo3oy1fmD  uvo s0s2um(o3no1olte ivias)a2tmx o;t0tpxoif3iat aDeauvp;t0 rtnmf oy1op r neo s) euo(rpoy4omenmfvt ()sDum(rp;t1aetomo3iadfa ea(vs;(4artomfciodlpteaivo t)seumim io4ap elnvsl( arurxroot0ape mf3tadfa2ulnvp u4 rxomfciatlp r neols sexr(m3oudllt mivsatfarum(r nu0apxn i3iydls umnvo;()aexrxo iydop   ieo;t)t2xm(m nu1ap  mncias)a2trxm ;o0tetniictytla2ul(mo (4alxomfctydfm rlnes;t)texrxrpiodaptnmnvi t s2rr(r ;u0altnmf3iytfm2ra( o t0tltrmociy1fp rlu ilt0t2uoxm ou1oltnlietasf rrru pnt0oeen oeiydfs el(vs;u0arxnir iotomt  u ilt  2ur(o iy1ale mivtas) 2trurpnu0alxnmfcias m uanmo;t0 etrir iydlmDr i i;(0sexrim ny4am elicslt)aDuaum ;o4altn oeiatls2uaumo u0 lenir3oatlmte i i;s) 2umxrpio4amen nciat aDtmu pnt1opx  icild mDrauvp;(0trxomr3todfmt  nvi s)s2xr(m nodaltnmnvt s)sDua(rpno0tpxnmf3ilt mDrmumo;u4trenmr oo1oa elivil(  rxm(rpoodame  iesa() rrr( oou1tlenmi3iltls2ulnmo t4trxoxrcoa1lm raivo;() exoxmpnu4amenmnetlt s2umurono0alxomfctltls ea( s;u)arxnxocta1fp r u s;(0 2urxmpoy4omee nctat s2rmxmp;t0oet io3iadfs rl(ms (4alenioctotfm eaneols)srtm(o3ny1lmt mfcslt  rumumpoo0oeen feiysfa2ua( snu)alxriociatomDeanvo (  rur(m no1amtnlieia() Dtmx ooo1tptoioeiatfa2ua(ms t0 lxnmf iotomteaueo s)srxm(m oo1opte ictlt) 2tmump;u1aexnmoeiadls uluvsnt)trerif to1laD an ilt)srtmio3ny1op  lici ()sDur(m oo4oetnif3iytfm rauvsnt4aexoxfcto1fptrlnvsls0trtoxo nodop  mfvil()aDrrx o;o4opxniieiatfs emnmp;t0artomo iatfatrlu sl()s2xm(o3oudomt lnesltfsrum(  nt4tpeoifciysls ulnmonu0tetrmociatomtraneil(  2uo(r3oo1lleemies (fsDur(rpno0tleomicilsfaDelnmp t4tltomo3oy1lp  auvo;()srtoxm io4lm   feilsfs2trumonu0tlto ocilsla2rl( snu)tlxnxrcoodfate u o;s0 exo(r ou1al nmfctls) 2rau pnt1tpe  ociydlaDul( p;(4 exomo3tydlptrli o () eur(mpoydllt  nvslt)a2tax ono1apen f3iadla2um(vs;t4alxoif3oydopDrli o t)sruoimpoydamt  nctltfarua(  ;u4altniieiys s elu p t) eermf3todfa  an ilt)trxoxopio1apeelicsls)a2um(moot4alxo f3tas aDea(vp;(4trxnmrcto1lm eanesl( srtoir iydalt  ictls) 2trxmpot0optomociysls2emump;(4altnmo3oa1om e nes t0teuoim iu1alenmiet sf Dtm(rpoo1tlt mictyd s uau o t4 lxomocoydoaD aiei s)seuoxo iu1alte ivil(fsDtrum ;o1aptoiiciyd a ulumo;u4 ltomf tatomte i i t seurxm3io1omt  ies ()aDtaxr ;u1apenmieiytls uluvpn(0 eenmr3tatfaDr ieilt0teuoirpnudlmeelfcslt) 2uauroou4oleo octltfa2umuvpnt)teeoxo tydlp  aivs;s  rumxrpiu1omeelnvslt arra(r no1tlt mietldla ranvo;(4 lerif ia1lp e ivo t  2uoxm iu1lptn nvs sfsrtm( poo4tlt  o3tas m2rl( pn(0tleoxo3tydfm rlnvi;s0srxmxo3iy1am e fetlt) Dtaxront1tpe ifetysfsDrl(vs;() etrxo3tydop e i s;t)srxm(r3ny1ll nmfeslt)a2umuronu4alenmietatls2ra( o t4arermrctotfp rai i () ruoiopoydopteliesls)srtaurpot1tlenmieiatla rln p;(0 lxoio tadop e nei;() 2trimpnydome  nvi sfs2uaxmpnt0tpxomfctyt m uau sn(4tlermf ia1fat aneil()s2uo(opiy4altnlivt tf 2tm(mp;o0tlt mo3ias aDrauvonu4texrxf tadfmDrluvs s  2uo(rpoy4ll elivs ()a2ra(r ;t0teen fcildlmDrmnvs;t4 exrmo oodfaD  nvsls0t2um(m3ny4ol  lnvs s a2rr(m ;o1tlx  feiyslaDulums (4artnxf io1lptr neo s)texrxm3oodlmee nct s) Dtrurpnt4tpxo feiytlaDul(ms;(0teermo iy1oat aues t)sexriopny4apeemicslsf rtmu pno0aeto feildlmDuanmo u4 renxf oodoa  ai o t tetoxmpnu4lmtn iesat arra(mpno1olxn o3ildlaDranvp;()tlxoxr iytopDeau i (0trumiopoo4opt lncils arra( pnu0apxnmoetyd aDrmn pn(0 exnmo iydlpD  ivs;t s2tmxopno1alenliviat s2ur(m oo1tpt ioctls a ran s;(4tlenxo oatoatrauvs;t0sruo(mpiu1lptemneslsfartmuroou1tlenio3tysfm umump;t0 eenmrciy1fpt aueo (  rtmxrpno4lltemnei s arrm(mo;o0tlen fcild s2rlu o t)tetnxfciydfaDelivi;()trxoxo3oudam elfcs () rum(mp;t1aexo f3tad s2uauvp ()trxrmo todlmDrlnei ()texrxm3oudlltelicsa(  ruau oou4aet mfciatlm uaump t4treomoctotla  luvo t)trtoxm ny1lmt  iei s) Dtrur ou1apeomictld mDrlumonu4texnio3oa1fp rauvolt)trxoimpio1lpt  nvsas)aDrru o;u0alen f3iytlmDrlump;(4trtrxo3oadoptrlnvo;t  etrim3oy4ole mietas s2tmx  ;u1tleoiieiltlsDemnvs;u) rxoxf totfp ranvs;t) exmxr ny1lleemieiltfs2rm( ooo0olxnmf3tadlm2ulnms;u0 reoxociotla rai o;s srtoxo3oy1ol  mnvt ( s2uaur ;o4aeeo oetysfm em( s u0 exoir3iotlpt  uei;( t2tm(o3nudoptelnvi t)s2ur(mo;t1oetoiictyd m2emnms (4 etrmf3totlm r ivs s)srtr(r3oy4ap emfcslsfa2tr(ro;t4ape moetysfmDulnmsn() etrmrctydfmD lnvol(0s2tr(o no1lmenlneils) 2trumpou0tpe  iciydfm rmumon(0 etrxf3iatomtean i;(0sexrio3ny1lmtemfct (faDumur oo4tpxnmi3ildfsDemnms;u0 eermf io1omtrai i t  etoirpno4ll nmies ()aDtrurooo0altn i3iadfs2uln p t0 lxnxf oydoate nvo t trur(r nydolenmfesas  Dtru o;o1opt  i3iatfsDean o;(0teeomr oodfp eaivolt0srtr(r ou1olen icil()a2tm( poo1openio3iltls2eanvs;u)altoxfciotoaDran o;(  etrxm3nu4lp emnvi sfa2rm(mpnu1tlxoioctadfaDranmp;()tlxriocty1oaD  u i ()sexrxrpiodopenmnesat  2uaxmono4tlt mfeiatfaDul(mont)aexomf oodomDeaieo (0tetoio3nu1lle lnctlsfsrua( onu1aet if3tldfs2eln p t4tetoircoydfate ieilt0 etm(rpnodome miesas)sDtrx pno1oex iietadfmDumu o (4treniociodfaD li slt0 2to(o iy4om  lfes t)aDraumpou4apen oeilsla2el(mo (4teerxr3ootop rlnvo;( texrxo oudoltn ies s srumxmp;t1opt  o3ild aDulums;t)aeeomf3ia1la r neilt  etr(rpno1altelfci s  Dum(  oo1alxnmicilsfmDrmuvp;u0tetnif3iotoatelu i;t0srtrxm3oodol  mnei s)a2rau pnt1apenioeiysfs rm( ont0aeeoxr3iadfaDrli o s) 2xmirpiy1opt mnet s arua(rooo4aleomietaslaDran p;u) etnxfcto1oatrau s s0sruoxmpoy1ol   fvsat  Drau  ;t1ole  f3iadlsDuauvon(4 exnmo iytomt lues;(0t2xrxmpoodlpee iet t) Duau pnu0tlt moetlsls eluvpn()trenxrciatfmDran ols)texmxm iodal  mnvs sfaDurum nt1alto f3iyd s elu o;t)aeenio3ia1fa rau i t  2trxm iu1lmtnlics (faDum( o;o0aeeomi3ild s2rm(mp;u) rxrio iy1faDelnvol() rumim oy4lptnlneslt)a2umxrp;t4alt ifetldfm2umn s;(4tetoifctydlat  n sls0s2toxo3oo4am elneta()arrru pnt1tpeoio3ildls uanms;t)texrxrciadoaDean ols)tetoio3oy4olt  fcsa()sDur( p;u4tptn fciys m ua(vo;u)aeenio totomt ai s t)srtrxmpiu1ap n iei t a2uax oot0alenmo3tad mDulu snt0 rtrif oodfpte iei;( t2trir oodomt lict tfsDraxmpoo1apx mf3tlt a2em( o (4alerxr3ta1fmte nvo t0trtoir nu1optemfei s)a2rru ooo0oetnmfctyd m2raums;u0arxnmr oadlm eaivi t)t2toxm iudapeelneil()arumumpnu0olto feiys s rmnvpnt4tetoxo3tatom  anvi;s s2uo(rpio4lp   ieil(fartax oou0oex miciasfa rlnvp (4trxoxf tadfmDr ivi;t0 etrim3oudop   ivt t) 2rrum ou0tpe mietyt a2ran s u0altnxr ootfptr ivo s)srurio3iodlmen fei (farrru  ;o4ape mocild a elnmo t0 ltniocia1lmt auvslt) 2xoir nu1omeelncsasfaDurxro;t1tptniiciytlm2rlu o;t4trtoiocoatlmtraueo;t0s2xrim3oo1lme  ict s)a2rrurpnu1opt moeiaslm em(vpn(0trtriocootlmt aieils srumxopiydopt mivsa()a2rru  nu1aleniiciydfm2em( s;(4texrmf3iytlmDeli o (  rxmxopio4oltnlietatfsDraxm nt0tetnmi3tysls rl(vo;(4 eeomr3ty1om  ai ols  2xr(o3nydlpeelnvt ( arraum ;u1tpx  f3iysfm2elu s;u0aexnxr3tadfa  li i;s)t2toimpnodlmee icsa( aDrmur no4tlen icild m2elnvp u)aexnxfctydoaD  iei s)srto(r iudolt  fcil( arurxmooo1olenmicildla2emnvonu4arerxr oo1lmtr ivs;() etrxrpiu4apenmfvsas  Draurpnu1tptnio3iyt a umnvs;u)alxrmo3oytlmD an o ( trxo(r3ou4lm   ncsa() rtaumooo4tleo feilt sDrmu o u) renmrciodfp raieil(0srtm(m oodomtnmiciltf 2ra( oot4aetoiiciyt mDum(vonu0aleomocoodop e ivo;()srtmxopnu4amt  feil()srrrur ot1opx mfctydls2ul(vs t4treoxrcoy1fmtr u s t teum(opoodomtnlivia(f 2raxr ot4altnmfciatfa2elu p;t)aetrxociy1lmD luvi t  2trxrpoodal emfesatfs2rru p;o1openmfciaslsDeau p;(4arxomrciotfmt  ivo t0texoir oy4llenmfcs (faDta(mono1apxoio3iysls emums;u4teermo3todfm eauei s)srxmim iodolt  fesat)s2urxm nt4aet ifciyt m rmuvpnu4tlxnmr3tydlatran sls s2trxm3ny4llenmnesls)aDrr(ronu4olt mieiadlsDrmumon(0aexnmfciytlp  lu il(  rumim oo4apenlfei sfs2um(mo;o1teenio3ils mDemu s u0aexomocia1oaD lu il(0 euoirpoy1ol  lnet ()srra(  ot0oetniocild m2rmnvont4areomo3iadom e uvi;t)s2xmxopiu4omtnmietlt  2rm(  ;u1apto iciys s uluvs t)tltoxf3ia1lp ran s t texoir3no4alee fesasfs2raxm ou0altomf3ilt mDuanmp;t4artomrciy1fmD lnvo (  etmxo3iodopte fci s)sDtmurpou4tle  f3iydfs2um( o (4trtrio oydoa eln il()t2xrio3nudapt mneilsfsrrm(m nt0tlx mo3tldlm ua(mo t4trenxr oo1lptrauvo ( s2xoxmpnu4lme lfei ()s2uaumpou4olen f3iltfsDra(vp t) rxnir iodlaDeaivi;t)srxo(o3no4omenlfcsat  Dumx  oo4ole mociatlsDuau s t0aleoxr oytfp  li olt sexo(m iydlp   feiasfaDtax o;u4apenmociydfa rmn o;u)tetoxo iatfp eluvo s)truoxo nodop e ies tfs2rm(mooo1teeoii3ild mDel( o;t0tlerif oa1omD auvslt s2xoxo oydlm e ictlt)a2ra(m no1alt  f3tat s2emuvs (4texrir totopte ivs;t seurir oo4llee ivils)aDrrxr nt1opt if3tadls2uau p;t)aexnif3oadfm rlivs;(0sexoir nydomtelfet t)srurx ono1oexoif3tltlmDeluvo;(0alerxocty1lp  ai i t0trumirpoodap  mivsa(fsrumur nu4tetnii3tlsfm2uln o;t0tlxoir3to1omtrluvils  2xoxopio4om e ncia() rrmum no0ope ifciytla2uanmo;t)trxrmr3oy1omDeau i;t0srtoxo3io4om   ivtl() 2rr(mp;t1opxn i3iaslm uan p u4texomrciadlpt  n o;s srxr(mpno4am emneslt aDtm( ont0oexnmoeils mDelumo;u) rxoirciotfmteaivilt0s2xr(m3nodaptnmnvs t s2umxr ou0oexn f3tls a uluvp;u)tltrxr iatopt lnes;s  rumim3iodlmeemfcslt)aDrmxrp;t0tetnmicild s2ul(mo;u0aetrmr3tadlmteluvs s)t2ur(rpoo4op nmfes ()a2rmxmo;o4opx moeiltlaDrluvs (0aexoxr3iydop   neo;t trtr(m3oydlpenlncsl( sDrmxro;u1tet  fetatfa2emnvo () rtrxrciy1fa   nvilt  rtrxr3oodomt mictatf rurxr ;u1tptoio3tlsfsDel(msn(4 rxnmrctotop e uei;t0sruoim nodoltn feilt)s2um( pot1tlxnii3tyt sDumuvonu4aetoxfcoatlaDran i t)teum(mpio1op n ivsltfa2rrxmont4tltoiictldfa eau s (0 lermr io1lp eauvil()s2urir3no1lm  livt s sDtaxm ou0optn ieild s rmnvon(4areoxo oy1op e n o;t0s2uo(r oo1ape livs (faDrmurpno0opx mi3iydfsDem(vp;u4arerioctodlaD aivilt  rtmxmpoy4al elictas) 2raxm ou1tptnmoctadfsDrlnms (4alxrmr oadfa rlu o;() rxoiopno1ame  nvilt)s2tmurpou1opxniieias m2uau snu0teenif3ta1latrlu i;t0t2ur(rpoo1ope  fctl(fa2raumoou1ole mieiadfsDua(ms;u0aexomfctadfaD  ueo;s  exmir iu1omeelneils)aDuaxro;u4oet iictyt a2ean p t)aetrxr3iydfp e u o;t t2uoim3iodlme  nviat s2ur(m nt1aetnii3tasla2elu o u)alxrmo oadlm ran ol(0 2xoxr3ou4lp n nctlt)sDrm(mp;t0aee mieilsla2um(vs t4 lxoiociatlaDrlnvolt0 euoio3iydlmtemncsltf rumu  oo4aee  ietydls2rmu s;()aeenmf tatlpD ln ilt0seuoimpiydll  lieta( s2rm( onu4tee mi3iys m elump;(4teenio oy1fpteluvslt0trtr(mpiodlme mfcil( srua(m oo4tpenmoctlt s2uau o;t) eeoio3tadfmt aivi;s teurxm iy1omenmfci t)s2raump;o0aptnii3iad s uanvo;(0tetniocoydfmteau s;t texmirpnodole  fvsl() 2tmu onu1oetnmf3iasls um(mpnt0arxnir3oodlpD aieols  rxrxm3ny4ome  netls arrr( o;t4opxniocilt mDrauvs () rtnir3oodoaDranvi;s  2xrxmpiudap  mies s)a2taum ;t4tex iictytfm2ra( p u) ltrxrcty1lpDe ieil()trxmir3oudlmee nctl(fsrumxmo;u4apxoifciydlmDrlump;(4 ltnif3io1op rau s;s  rto(r3oydol emncs ()a2rax ono4teeoii3iatla ua( p (4 lxrmocoo1oat  nvsls)trtoirpoy4lm e nci () Drm( oot1apx ii3iadfs umuvs;u0tleomr3to1laDr uei () 2trxm3oydolte ieias) Draum nt4oltomo3tld m2ua(ms;u0artrxr oo1oa elieslt sruoxrpoo1aleemnvt (  2ua(r ot1oetnmicias s2umnmp;u)trtrmr3iadfmD luvol(0teurxm oo4alenmivtat s2umum oo4aexnmietydfs ran ont0aexnxf oadlp rluvil(  2xr(o3ny4lm emicsa(faDrm(m nu1tpxnioctaslm2umnmo t4teerxf ootomD  nvo t)t2xmirpno4ape mfei () 2umx o;t1tpen ictlslsDrl(vo;()tlxoio iytlm  auvilt) eumxr iydap  mivia(f Dur( o;o0oee mocilsfs2ul(vp t0tlxrmfcto1fmDrauvs;s) rto(m iu4om nlicsls srtmxmpou4texn fetatls emnvont0aexnxr3tatopD ai olt0seurir3no1lp  mfvi (f rrau p;t0apxomietyt m2um( pn() renio tytfmD aues s) rxmiopio1ope miet t  rrr(monu0tlen i3ilslm eanvo t)trerio3to1fmtranes;(  rtrir nu4al e netl(f rtm( pnt0apx  icilslm rl(monu)trxrmo3iodoatraueo t0t2umxopnu4omenmnvsa( sDtmu p;u0apt iocias aDeaump t) ltnmfcto1lp eluvils sexmxr nodlpte netat  rrm(mpnu1aptnio3ils s ulnvs;t)trtrxocoydfp rau s t)s2tm(r3io4altnlivias sDta(ro;t4tpto oeiatls elumpn(4 lxomf3iytlat an s ( srxoim3ou1ale liesa( srrmurp;u1opxnmfetyt s rl(mp;u4 lxnir3oytomteaieo;t)t2to(m3oy1ll   fcta(f rtmu  ;o0alxnii3ildlm2rmnvo t) ltnmocoo1lm e ivs s0t2umxo nudomtemivil( artmx  ot0aptoioeiasfa rmnmsnu4aetnmr3tydfmD lu ols)trto(m3ny1lp e ncil() Dumump;u1olxn oeildla ra(vo;()artrxfctatfa  livolt trxoxo oydalenmfesl(fsDtaumono4olx  ietltfm emn o;()tltrmoctydfpD aues;(0seumxr oodlpe  fctls) Drrum nt4tex mfeilslmDeln pnu4altrifcoo1opDrlnvo ()sexmim3iodopee fvs (  rtrx ont1aeenmfctydfa ulumsnt0 etomrcoydomteaiei s)setrxrpnodlm   ivsltf Dra(rpno4alenmo3iyt a rm( o (0aeenircoa1lat li olt0t2umxo3oy1ol elnvt t)a2rmxr oo0tlenifciyt aDua(mp t4trxrxociytlm r u i;( seumir nudlme lfvtl(  2umx o;t0tltnif3iyt a2rmnvo;t0arenxfciatlm elues (0t2urir3no4op emfvi sfaDta(rpot1tlxo i3iyd m emnvsnt0 renmr3iy1fpteanvsls trur(o oy1olte nvsasfaDtr(roou1opeomfeildlm rm( pn(4aetrmrcoytlaD auei;(0trurxm iy4lpe lfetls)srum(m no1alt mictltfm rlnvsnt) lxnxf3oadlm r nes;s)s2trxmpnydopte ieilt  Dur(mo;u1tle moeiyd a umuvo;(4 etnmf3oodfm r iesl(0trxoio iudlptnmiei ( srta( o;o1tlxnmociadfs eau o u4tlxoif ia1omDeluvilt)srxrimpiudlm n ivi t aDtm( oot1opxnmfciysfaDea(ms;u4 eerxfciy1faDelivs t0srtmir3oudlme  fet s)sDrmxm ;t1opx  f3iltfs2um(mpn()aeerir3tadlmDe n ol( s2ur(opnu1optn fvias)a2rrumo;t0ope ifetltls ra(vo;(4tlxnif3iydopD lu i;s)sruoxopiudamtelnvsa( arur(  nt4optomf3ils mDumu p;t4arxoxo3oy1fptr i ol( srtrir ou1ome mncia(faDumumpot4aexomieiadlmDrlu o;t4arxoxo iy1fm eauvs t)trtm(o3oo1lm e ivi t)artrumoot0tet if3tatfm2emn p;t0trenxrcootlmte n s;t0t2xoxr nudapt lfviat  rta(root0apxnmf3iatls2ra(vo ()tltrmo ootlmDeaivils seum(mpoodolee feslsf 2ta( oot4tpx ifciltlmDemnms;u4trermf iatfptraivol(  eumxmpoy4ll emivtlt  2urxrpoo0oetnmi3iytfmDel(vo;u) rxoirctodoaD  uvi;( srxmxrpiu4ap n iet (fsDrmx  no0oltomf3tyd s eauvo t4arxoxrctodfmtelneo;s0teumxopiu1lpt mfet s) Dtr(mpot4tleo fetlsfa ul(mpnu0tlenmf iy1fate ueils0sexrirpoudamenlfcsltfaDrrur oo1tex  i3tytls emn p;u4 etoxf oodoaD anes t0 exr(r3iydaptelncilt)arumurp;o1oet  oeiyslsDemumo;t0tlxrxrcoy1opt  n s t) 2uoxopnu1am   fvi t sDuaxrpot0altomiciydla ua(vo;u4 rtomo3ty1fptelues (0 rxrirpiu1ol elivs tfa2rrurpnt0texnmoetas mDelumsn(0 rtoio3io1lmD anes;s)srxoimpny1lpe lietlsfa2rmumonu4oexnmo3tadfa ra( p;(4 rtoif iadfatelu slt)sruo(opoo4al e fcils a2ua( p;t4apt  ociadlm ean p t0areomf3iotopDeln s;t) 2xmirpio4lpt mfvs sfa2tmumonu0tee  ieiatfs ul(ms;(4arxomo iytfm rln olt)t2xrxm3ny4olt  fvs ()s2uaxmpou4olen feiydfa2uauvo u4 reoxf ia1lpDeln ilt s2urxmpoy1omtelivta() 2ta(  no0tlxn o3iasfm uauvs t0tetnmrciadopDranvs;(  2urxr3oo4altnmies s)s2uru ooo4tltnmociatfaDraump;t4aetoxo3oydomDe ivo s s2xrim iy4amenlnvi ()s2tax pnu4tee ifctat m2ranvo u)tetrirciytlm e ivi t)trto(r iu1lm nmfctat)sDur( poo4aetomocildfs2um( p u4 ltrio3tydfmtraieo;t) 2tmir no4lp emfctas)s2rmx pou0opxo f3iltls ranmp;u0aexoio ootlpDrliei;( tetr(m iy1omee ncsltf Dtmxrpot1tpx  o3iatlaDeauvont4artrxociadla  luei;(0 rur(o3no4olee ivs s)aDrru o;t0opto ocild s rln o;(4 rtoxo3ia1lptr i ilt srxoim nydlmt mnesa() 2rrum ;u0oeenifctas aDumu s u4aexoxrctatoa rau olt)t2um(r3oy4aptnlneia(fsrrmxmpot1ope ioeiat a2rlnmp t0 rtnio tatomtelieolt0s2trxm iodap n ieil( aDtmxm ;u0teen o3iyt sDuaums t4 eerxrctodfmt ai ol( trtm(o no1am  lncilsfs2tm(rpot0apt  fetyt m rm( snt4 lerxr to1fpDr n s;s)srtr(r nu1opeemfeia()s2tmu  oo4tee mf3ilt aDeaumo;u) etrio ootop  lnvi s  2xr(mpou1lm  mivsa(fs2rr(m ou1alt ioctltlaDrlu p u) etnxfcio1lmtrlieol(0 euo(m iodoptnlfcsl( s2rrur nu0aetniocilsfsDea(mo t)tetnio3iotlpt livil()texoim iodap emnvtatfsDurxmo;t4opx  fetydfs eln onu4 lenmfcty1lm eaieol( teuoxo iydaptelivi s) rtaxr ot1tlto iciltlm2ranms u4alxomocoa1fm rln o t)srxmim nydal  mivsltfsrua( p;u1oeenif3ilslm rm(ms;t4alxrxo iy1fate n ol( t2xo(r ou1om nlfesl() Drrxmpnt0tlenmf3tyd aDuanvo (4 lxnmfcta1oa eluvsls)t2tmxr ou1ale lieiatf 2rmump;u1aee  oeild sDrm(msnu) eenio iydlateai s;s teuoxrpiodom  mnvils a2tmxrpoo1aetn ietadfm uluvs t0 rtnxrcto1op raivo t setmirpoodlmt mivsl()arraxmpot4aleo fetydlm2ea(ms;()aeerxr todfaDr u s;(0 2to(o3no4opt lfes s  Dtr(m no1teeo icilsfmDem(mp;(0tetrmociodlp  lues;t0t2tr(mpny1lmte fvsas)aDur(r nt1tpeo fetls mDel(msn(0aeermf3iodoa r i slt0seum(r oo1ope lnctlt a2raxm ou0texomictytfaDua(ms u) lermo tatfmtr nvo;( t2xrir io1lm nmfesa()aDur(monu1apt iicilsla um( p u4 eenxo oo1lm   ivi;s sexrxmpnodalte icia(  2rru o;t1olxn i3iadfm rlumo;()alxnxo totfatr u sls) rxmir iydlmenlnviat)artrxmont0tpenmi3ilsla el(vp u) rermrctodfaDeau sls t2tmxrpiydamenlfcslt sDrmu  ot0tpto ocilslsDrmuvo;(0alxoirciadlmDrau i;(0srtmimpnydlp   nct (f Dumumonu0aexomoetyd aDuaumsn(4 leoxf iotoa   n s t)srtoxr iodlltemncsas a2ururpno4alxnifciat mDrl(vo;u4trxomr tydom  au ils trur(o oudlm nmivs s) rur(  nu0oexoioeiytfmDra(mp;()teermf3oytom  ln s;s) eurxr iu4ol nlfci (fsDrmxrpnu4tee mf3tlt s uau snu4aexoxf oy1fat an slt setoio iodlltn ncias s2rau p;o4tet iiciatlm2rmnms;(4 lxrmf3tytlatr uvolt0t2trxopiy4llt  nctl(  Dra(rpot0apenmoeildlmDulnvpnu4altoxr ia1fp eli s t)tetr(opny4al  lnvtl( s2umur nt1aetnmieilslaDranmsnt0trermocio1fmD aneslt)s2toxo oy4lltnlics ( sDuaxm oo1ope mf3ilt s2rl(vs;t)trenmo to1opt  n o s srtmio oo4ap  mivi sfarrauront4apt iieilt m ulnvsnu0tlxomo3oytfptrln o;s)setmxrpou4op nlfvta() Dtmumonu1opx  f3iys m elump;u0texoiociotopD lnvs;() 2tmir3oo4llenlici tf Duauront1ape  ictyd m2ulums;t)tetrircta1lpDe ivs (0 etrxm3oy4omeelnesls) 2ra(rp;o1opxnmo3ilslmDrm(vp u0arxoif io1omtrauvilt texm(rpiy4ope lnvi (f Drrxr oo0aex ifetyt m eanvs u)altomrctotfpt  n s t)s2xmxr3nydolee fcil( s2uau  ot1tle mf3iasfa raums;(4 rtrirciytopDeanvols)teto(rpnu4apt lfesas) rrau poo0tptnioeiltfm eanmp;u0 eeoircoodfaDrlieo;t)t2tm(o3io4openmies sfs2ta(m ;t0oltn ieiyd a2em( snu0trxomo3ty1lmtranei t0 rxm(rpnodlp nmfet t)sDraxm ou1tlx mociltls rmn s ()aexrmr oydla  lies s0s2uoxo nodol  mfcilt) Dua(r ot0openmo3tlt mDemu o u0areoxf3iy1om r iei;(0s2tm(r3oudamtn fvs sfa2tmu  oo1oet mfeiyd mDum( p;(4areomr iydfateau il() 2trxo3nu1amenmies s  Dumuroou0ape moeiyd m ulump;t)aexnmr iydlate uei s0sexrirpou4am e fcs s  rtmum ;o1tlxomietas s ranmp;u0altnxocty1fm raneo;s)setrxmpoodlme livtatf rurx p;o0tlt mieiltfmDulumo u0areoxf oytlatrln s s0 2xmir ou1ap  lieiat  Dra(rooo1oex  fetat m emnvpnt0 lermf oo1la  auvolt)trxmir3iu1ol  lictat)s2ta(m ot0oexomiciadfm umnvsnt4tetrio3iytlaDr uvs;s)s2uoxr3nodopeemfes t)s2raum oo1tpe moeiyslaDulnvpnu4teermrctydlp  livs;t0truoxo3ou4lp e icsas)aDtaxm ou1opt if3iyd aDrlnmont)aleomf3oadla rlu o;s0 rxrxo nu1lleelfcsat)sDrrurooo1aexn fctlt mDrln o t)trenxo ia1fmDelieo s t2ur(m iudope  fcs s)aDtru  oo4alxoif3iytfm2uln sn(0alxrif3oodom  aiei s sexrxmpoydoptnlicsat)srurumpou0aexniieiltfs2elu s;t)arermr ta1faDeau ol(  rurxo oy1alenmneilt artrx  ot1ope  o3ildlmDemuvp;(0tltrxo3oydfa  lnei ()s2tr(mpoo4om eliet t a2tau  ou0ale  ictltlsDea(mo;t)aeeomf tadomD  iei s)trtoio3io4ope licslt)a2umxmo;u4oltn o3iydfs ranmp;u)arxoxo iy1fmtr iei t setrirpio4optemnei sf Dtm(mo;u4opt moeildlm rlnmo t4altnir iy1oat aueolt trurxm3ou1amte nvsatf Dtmu pnu4tle mi3tytlm umnmo;(4trenmr3tatlmDrlneols)s2um(o3iydllen ietas  rur(mono0ale mociat aDuauvo;t4aetrif3to1opteanesls t2tm(m3oy4open nvsat) rumx pno0alxoiictyd m2uau s;t) ltomocoa1fm e nvo;t0t2ur(o oudlp emfcta(f 2rrxr no0alxo fcilt m2umnmpnt)trenio tadopD lnvi;t) exrim oo1omt  nes t a2rax pou1tlxoifeiyt aDum(ms t) reoxf3todoate nvsl( sruoir iu1aptemfct t) 2rax o;t4tlxn i3iyt m el(vo t4trerifcoadfpDr i o t)t2toir3no4llte neta()arta(monu4tlxn octltfs uan p ()tleomf oytoa r ueil() rto(o3oudapee ivt (  Dtr(m ot0tleo o3iyt m ea(ms (4tetrmocoydlpt lneo t0t2umirpnydalt  nct s) 2taxm ot1teenmociat s2ulump;t0 rtoxr iadomDrlneols seurxrpoy1lp elnesat s2tr(  ;o0tpe  f3tad m2ul(mp (0 leoxf oadoptr nvs ( truo(r nu1apee nvs sf 2urxm ;u0tee mi3ilslmDemu snu) reoxr oatlp rliei t0trumxmpnudap e fctls sDrmu  ot4oex mociatla ul(vo;(4altrir ta1fmt  u s s)teurio iy1omen ivt (  rtrx  ot0alt iociyd s rm( s (0 etrmr iy1lpDr nvsl(  2tr(m3no4amt  ictatf rua(mooo4tlxoif3iad sDem(vsn(0altrxo iydfmDe ivs (  2urio3oo1ol nmnesa(  rurumpot0aptoiictytlsDrm(vp;(0 ltnmr tadfpDranvs (0s2xo(r oo1lm e neta(fsDtrxmoou4tpto i3tldlsDrl(mo (4arermo iydomte ivo;s)setoxm oodame mictls)s2tm(rpnt4tetnioeiys mDumuvo u)altnif3oo1om   ueo t)seum(rpio4ll n ietlt aDurx  nu4oleomoetat aDeanms;u0tltnmr iydlaD aiei ()teuoiopoodlpee neias  rraxroou0oee mf3ildfs2ua(mp;() lxomrcoy1lpDr u i;( trtmxr3nodaleelfcsl()aDururo;o1altnif3ilt m2ul(vsn(4aetrir3iodlpDeai ilt0s2xoxm iodlm nliei s) rtm(mooo0open fciasfa rau s;u)tltoir3ta1fpteaueo;t) 2to(o3ou4oltnlivsa( sDua(m ot0aetnmfeild m umnvp;() rtomf3iydfa   n i (  rxr(o3iu4lptemneias  Dumxrp;u4apto ocilt m2ra(ms;t4treriociadfaDean s t  etr(o3no1ol  lncias)s2rrurono4aee mfeiat a2umumo t0tetomo iydfmteluei ()srtrio3no1oleemnvtas)srtm(ro;u0olen f3tytlm eanvo;t4tlenif ootlatran s t)trxoxm io1lmtn feil( srtmx pot4aleniictltfmDranmp t)tlxnio iadfaD lu i;(0 etmxr3io4am  micsa(fa2tau  no4ole mf3ils a2rluvp;t4aeeomf iatfat lnvo;()seuoxmpny1ll e icil( s2taxmo;u0texn fcildfm rlu p u4 rxoxo iy1oa elu ol() exmxm3iodal  lfcia( aDrrum nu0tpt if3tydla2uauvp t4trenmfcoa1lp r ueslt0truoxm3ny1omtn fvsa(  Dur(  ;u1opeo ictld s umuvo;(0tlerxr to1fm ran i t srxoxrpiudllenmfcsas)srrr(mooo4aexomfciytfm uluvonu0 rtoir oa1lp rluesls0trumio3oydam   nciat  rrrumonu0aexnmf3ild a2eauvo t4alxrio todlmte nvil(0 2urxopnu1lptn ies () ruaurpot0tpx mfciydfa ranms (4alxrmrcio1lpD lueo;s  rxoxm3nudap n fcsas  Dtmu o;u0apeoioetyt aDrluvs u4arerxfciytop  lnesls)sexmimpoodlmee icilt)srrr( pot0texomoetad aDuanvs;(4tlerif ta1faDelnvs t) exriopiy4alen ietl(fs2rm(ront0opxnii3ils s ulumsnu4trxrmfctytlp rluvols  2xmio3oo4am e netlt)s2rax oou4alx io3iatls ra(vo;u4aetoir oa1lmt lnvo;(0s2xrirpiu1apenmnvilt  rtm(rp;o4tlx  f3iat sDuau p;t)aleomf3iydopD  neo;()srum(opny1apeemfct tfs2urxrpot4aptnmo3tldfa em(vp;()aeeoir3totlat lueo (0 2tmxm3iudop n fct tfaDumu ont1aptnif3tyt mDrm(ms;u4aetnir oy1op  luvilt trxr(rpny1ap nlivsat  2rrurp;u4tptnif3iyt aDemums;u0 lxnir3tydfa eln s;s  2xrxmpiydlmt  nesl() rrau pot4aexomf3iatla2emumsnu0arxoxfciatoaD anvs;s)trto(m3iu4op e nesl(fsDurumo;u1aexnmi3tlsfs emnmo;() etnmfcta1lmtrlies;t)srxr(o3nydaptnmnvtlsf ruau o;u4alt iiciasls rluvpn(4altomf3iodfa   u o;()setm(r3nodalee icta()sDtmur no4tpeo ictydla uauvp;(4 rtomocta1fpt  ieilt0 2trxo3ou1lmee ivtl() Drmuro;t0tpxomf3tltfaDrmnmp t4tltoio todlp   n s s texmim iy4lmtemnvi ( artm(rpot1apx moctys m2uau o;(4arxrio oodfp r uvsl() 2xmxrpny1omtnlfvia()arra( pnt0apxo ietldla rl(mpnt)alermr3oadomtraues;t)trum(r oo4aptelici t sDrmumooo0apeomfciydfa eanvp;t0tetrxrctotop rln o (0 exoxr oodomtnlfcs t aDrau  ot0apen f3iat mDeaumpn(0 ltrxrcoadopDrln s t0srxoxm3iu1olee fvi t)a2ra(  ;t4tpxo ietlt aDem(vo (0areomo oadlmtraivols srxmir nydlmt  nctas)sDuaxmo;u1opeomo3tldls em(vp;(0altrxr3ty1oaD au o;t s2uoxr oy1amenlnesl( aDtr(r ;o1opxnmoctlsla rl( sn(4tltnif iodopDraivi;( s2xo(m nydoptnmfeiasfs2rrx pou1apt  feiat a2el(von(0trxrmr3to1fmteluvi;s t2tmxopiudop  lnvils arrmxro;t1alxoiociytlsDem(vo;()aeeoxfciytomt anvi;s t2um(r3oo4amt  nvia( aDtruro;t1apx iiciyt aDulnmonu4 leoifcoytfptr i o;s)sexmxrpiu1lltelncsas)sDraxm nt1tptnif3iad m ulu p u)aetoxf oodlmDraneolt)s2xrxmpou4apeemfvtl() rurxm no1aetoifetysls ulumont4 lxrif3oa1lptr n s s)trtm(o oydll e ivi s  Dum(mo;t0aet mo3iltfm2uln s u4tetrmo totlatelnvol( srto(m3iy4lleelnvs s  rum(m ;o1aptnmiciadfmDel(vo;() eeomo to1lptr nvo ()t2urirpnodlltelictasf rtrxm ;t1optn i3iyd m2eanvont0teenmo oadfa   i slt) 2uoxrpnydlm  mnct s) Dtr(mp;o4altnifcilslaDrlumont) exrmocootoa e n o;t0t2urxr3oy1olenmfcilt  Drau  oo0oexomo3iad a2rmnvon(0tlxrir io1lmt auvo (0seur(m3io1open ivtl()aDurur nu4alx mo3iyslaDumu s;t4artoir oy1fateauvs;t  etmio nu4ol emivs (fa2umur ;u1altnifcilt a ulums;(4 ltoxf oa1om eaues;( srtm(m ny1lm nmnes (  rrm(rpno4apto oeiltfsDeauvp;u) lermr tydfatelnvo s0tetmxr3no4lle lnvtatfarrmx  ot0apenmoeiadla uanvpnu4aetoxo3oodopDeli o;t  etm(rpiu1am  mietas a2tmx o;o4aptomiciyslaDulnmp u0artoio oytlp   n i;(  etoxr iu4am   net s  Dtr( o;u4oleomoctlt aDem(vsn(0 rtrxf iatoptr u i t  ruo(rpnu1alt lictat  rtrxmoot1ope  feiasls ulnmsnt4aetrxr3oatopt livo (0t2xoir oo4amtn fvslsf rtm(  no1oleo ociydlm umnvp (4trtrxo oydfm  aivi t trtrimpnudll nlfvtas  ruaxm oo4oee  ietyslm uau pn() eerirctydlmD liesls)s2xrxr3no4lptelictls aDur(monu1opt mo3iys s2elums;u0 ltomrcta1fa  aieo;s s2tr(o3nudlpenlncilt) rta(m no0tlxomo3ilsfmDrmn o;u4treoxr3tytlp elu s s0 eumio3ou4ll elfcs s aDtm(mo;u1aeeomoetyd s rmn o;t0alxrifcoy1oaDe u o t0 ruo(opiydllee ivtat)a2rrumono4opt  ociltfs2uluvo u4trxoxf3oodomte i i s)setoxmpiydlltnlfvtat)s2rr(m ot4tleomf3ildlm umu sn()alxnifciadoa eln o;s)teur(o3iydom elieil( s2uaur ;o1tptn fciydfaDrluvsnt0 lerxrcoytomDeai ils)s2umxmpoodape miei tf Dumuroot4opxoio3iatlm2elnmonu0aexrmf ia1lptr u sls) eurxr3oudlpenmfvt s) Drm(rooo1opxnii3iyt s2ra(mo;u)altnxo iydfpDr uvs;s) ruo(mpnodlleelict (  2umxro;t0tpe  icild s rl(vsnu4 lxomfcoadoa  aivol( t2uo(o oodapt lncs ( artr(rpoo1tptnmiciadls ranmsnu4tleoxrcoytoa rai i;t0srxoimpny4lle  ivi s)arra( ono1opt iociadfm2emn o;t)tetnif ia1fmte n i;()truoio3nudop e fvtasfsDtr(m no4tetn i3iytfs2umumsnu0 eerxocoodfa e neslt t2umxo ou4ap nlivia( sDumxrpnt4olxomociatfa2rmu o t4artnmocoadopD  ieilt0teur(opiodlm n icil( artmumpnu1olxn i3iysfa uanmont4tlxoxocta1opte ivsls trtmxo oydlp   fvsls)a2rrx  ;u0aet ifctytla emnmp;(0 lxoircoadomD luvsl(0s2xmxr oudoptn fetlt  Drru o;t1tptoioeiytls2rl(vp u4trerio oadfpDrlieols0s2xrir oy1lpeemncia()aDra(r ;u1oexomf3iytls2rluvs;u4trxoircty1op eauvolt seuoirpoodopenmics s  Dur( pnu0altoioctadla ua(msnt)tlxomociydlp   uvo t0texmir3oo4ameelfcia(fa2umx  oo0tpt  oeias a2ea(vont4arxomr tydlp  au i (0teuo(o ny4omtnmicsls) rur(rp;t1oexoifciasfm ea(vs (4trtnmo3iotoa   neolt seumirpnodal nlfcs t a2raxr ;o0apeo f3ildlm2ua(vsnt) ltoir3iotfp  lnvs s0srum(m3ny4om   ici ( s2ur(mo;t0aexn i3iydlm uanvpnt) rxoxr3iy1opD auvi;t) rurxmpny4ol   ivt sfa2rmurpou4oetnio3tytls uanms;() ltoxo iodoa eai i t0 2xrimpoo1llenmfci (f 2tmuronu4oetomociat a rm( o u) rxomf iodlmD  i ils0t2umxopio4al  mnct (f 2tmxm nt4oltn oeiat sDrmn p (4trtomf tadom ranes;t trxoir3nudop   fetlt)sDuaum ot1apen fetydls ul(ms;t)tlxnmf3tydlp elivolt  rxr(r3iu1optnmfcta()a2rmxmo;o0oet  oeiysfsDua(mo;u) rxnxocoa1lm  livo t) eto(r3nu1ame  ietatf Duax  ;u1alt  fciatfm2ra(vp (0trxrmocto1fmDrli o t) 2toio3nodapen iesls  2tr(  ou4olx mf3iasla umu p;t)tleoif3ootfat ln sl()t2xrxr oy4ome  fct sf 2rmxmpnt4aee mietadfs2eaumon(4teermo3tydfp elu i;()s2xoxm ou4omee fciatf Dtaurpot4aleniocilsla2uauvp (4artrmf3iadoate neo s)s2uo(opno1omtelnesat)aDrmum nt1optnif3iltls2ua( pnu)texoxrciydfatrauvi (0t2to(m3ou4alt liviatf rurump;t0tlx miciltfm em(vsnu4alenxo3tatfp  ln s;s  2xo(rpnu1lmee iet sfs2uaxmooo4oeeomf3tlt mDeauvon(4teerir to1oa rau ilt) ruo(o3oodam emiesa(  ruax  ;o1tex  ociyt m2emnms t0tlxnxrctotlpDranes;(  2toxopoo4om e fviat s2uaurono1opto oeiytla rmn onu)altrmfcoytla   u s;(0 etm(m no1amt mnct s) Dtmur nu0aptomf3iltfa2rlumo t0aexoiociatfp elivi;(0teuoxm nu1lp nlicsas)aDumurpoo1tpxnmociyslmDelu onu) ltoxoctodfaD lu il()srxriopny4lmeelfei (  rta(mono4alxoioetatfs umu pnt0 lxrxf3iy1fpDelnvslt s2uoim3ny4lmte feilsfartmumo;o0aleoioeiyd s uan o;t4treomfciotlmte ivi () exmim3nu4ol  lncs t) Dta(  no4tpxniieils s ra(vp;(0 renxr3iytopDrln s ()t2toxmpio1aleelfctas)sDumumono4tlt  i3tydfmDeauvo;() eerxf3iotop e ivo;( srtrir3oo1lmte fvt t)a2tr( pou4ope if3ias m2ul(ms () leomo3oodlat livsls  eum(r3no1llenlfei tfartrxmp;o1tltnmociadfsDem(mo u0 exoxocoytop r neol()truoxrpoodlp nlfvtasf rtau pot1aetomociaslmDrm(vont4arermr totlpt aieo t0srtoxo oo4ol e iesas arrr(  ;o1opt if3iatfmDrm( o;u4alxrxf3oytoateli sl(0t2xoir3nudlme lfet t) rtr(  ;t4ope  ictytfaDrmums;u0tlenxrcoydfm   ieils0s2tr(r oy1olen ieiat srrmxmp;o4tltnifeiat s2rmumont0 eenxr3ootoa  anvi;s)truo(r ny1ap emnct tfaDuauro;t4alt iictat m2ulnmont0 lxoxr iatoaDr nvols)sexrio3nudomenlfvtlt aDrmur nu1aet ii3tltfa2ul(vpn() rtomocoatfmtelnes;t truoxo nu4altelncsasfa2umumpot0apx mocild a rl( p;(0teermrctotomDeanvo;t sruo(rpou4llen fctltf Drr(ro;t0oexo ociadlaDranmo;u4trenmo3iadlpDelivi;(0 rumio3io4opt mivsas)a2umx  oo1tpeoii3ias s rl( o t)trermo oatlm raivil( trtoxm3oodomenlietat)arrauroot0olt mieiyt sDelnmp t0tetoxf iodlmtrlneo;s) 2toxm3oudale lncias  rrm( o;u0tlt  ieils a2rluvs u)tlenmo3oy1lmtranvol(0srxmir3oudame lnctls  Dumumpnu0texomo3tlt sDrlumsnt)tltoio oadlm e n i ( s2umxo nu4al n fei tf rrrur oo0tptniociatlsDumn o;t4aetnxfcoy1omDrauei s) rtoim io4llt mivsls sDurxr ou4teto f3iysfmDrmump;(0 leoxf ootfa raneol( teumir ny4apeelnvtat s2tmurpoo1tleo ociaslsDranvs t4trtniocia1latr n o;s)trtrxrpiu1olenlieiat)sruaurpou4tlenmi3iydfsDra(ms (4 exnmf3todlmDeanvol()trum(m nu1lm elfes ( s2urumoou0aetomi3tadfmDumu s (4 lxoiocoa1lp eaueo t)tetm(m3iy1lptelfviatfsrtrum nu4tlxnmf3iytlsDulnvs;t4aetnio3iydlm r uvsl() eumxm3nu1amt  ivsl(f 2trumpno4aleo ieiydfmDua( pnt) eermo3oatlpD ln s (0 rumxr ou1opte nei t) ruau p;t1ole mf3ilt aDra( s;() rtrmf totfptr nei;(  2tmxm3iy1am   nvta( aDrru pnt0olxnmiciasfs2raumo;u)teeoxr totfate n o (  2trxrpiudopt mici ()sDum(r no0olt  feiydlm2umn p (0 ltrxf3tydfaD lneo;s  rtm(opnudoltn ietlt)a2rr(mp;t0tpxoiiciaslmDea(ms t0treomr iy1laD ai ols  2xmxo3iu1ll elnetas s2um(r ;o1tlen fciatlm2ea(ms (4tltomo3to1fm  aieslt  rurxm iodale  fesatfsrumu oou1opxnifciyt a2ua( o;t4aexoxo3oadoa e ivs t0sexmir oy1optn ics tf 2tmuront1oetoii3tldfm2elnvo t0aeermfciotla rauei (0s2umxo3iu1am emiesat srrax  nu4oltnmfeiysfa ranmp (4texrmfcootlm r nvs s srurxo3iy4llt  iesat)s2rrumpnt4oex iociad mDum(mo (0aetomr3ty1lpDeli ils) rumim3iydlm  lnet sfs2rru  ;o1olenifciysfm2ulumpn(0tetrxoctotoaD an sls seto(m oo4olen fesls)aDtr(  nt4tet iiciysls2eauvpnu0 exoxocoytfmD  ivo;t seur(r nudaltn nciatfarumum ot1tlx  octys mDra(vp (4aetoxfcoydoatelu s (0tetoxm no4al nliei t sDuaumpoo0opxnmi3ilt s ra(vs (4tleoircto1fmt aieils  2trim3nu4lpe  nvia()srtax onu4apeomietasfmDelnmp u0arenxf ootoaDraiei;(0sexm(r3oudam nlnet s)arrr( p;u4aee mi3iysfs ul(vp (0 rxrmocoodfate uvi s0 eumxo ou4aptnlnvi sf Drm( ooo1alt ii3iad m2eanmont0aetnxf to1fptelu i t tetmirpnu4ap emfci ( s2rmx pou1alt iietyslm eanmont)trtoxo3iy1opte nvilt0 2uoxm nu4opt  fvs ()aDur( poo4tee mi3iadfs rlumsnt4 etnmr todlpDrlueo ( truoxr3nu1lle mnvtls aDurxro;u4alxnmiciatfsDeluvp;(4 etrmo3ty1fatr uvil( s2to(o oy1lptnlncsa() 2raum nt1oexo ociatlaDem(mo t4 lermo iydop r i i t0srtr(r3nudal n nvsatf 2trx o;o4olxomf3tltlm2ranms;t4 reoir oatomtrluvsl(  rxoxr iu1ole  feias) 2ua(rpot4alx ifciasfaDraumpnt)arxnmocoatfmDrlieo;()trtoir ny4lmeemnct t sDtaur ot0aee ifctas mDum(mp;u)artoif to1lmt  i o s)s2ur(r3ou1ame lfctl(f rrmx  nt4olxoiieiat aDranms;() rtomr3oadoa  lu ols0tetrio3nydaltelfeslsfsrtmxm ;u4aleomfctad s rm(vs () exnmf3iodfm elnvil( texm(r3ou4lpe lnvs (fs2tru  oo1oetn f3iydfmDra(vp;u)arerif3to1oa rln ilt)tetrirpiodoltnmfeta()s2tmu ono1aetnmfetadls2emu o t) leoxf totopDrauvo;t) exmxmpoudlpe mnciat) rrrx p;o1olxnif3tyd s2uan p;(4 etomo3iadfatrliesl(0teuoxo nu4alte ict t sDur(rpoo1alxn o3iydfs ea(vp;t4 rtnxf3tytopDrlu i s)srto(m3ny1opeelfct (faDtrxmooo1opeoiietlsfmDran snu)areoxr3oatfmD  i i;s srurxopny4ap  mfvsa()a2ururoou1tlxnmoeiys a rmuvp;t)altnxfcoo1lmDrli o;t0truoxr3oo4opt lfvi (faDtmx ooo0tpenmf3tyt m rl( on(4trenif3tytomtr ivi s0 ruo(m3iy1lltemfcsltf rrrumont0tlxomi3tydlm2raumo u4 eermrcio1opDeluvo;(0 2um(m iudop nmnet t  ruaxmonu0apeoio3tydlm rlnmp (4trtoir3oatoatrlnvslt0 2triopny1ap nlivs sfaDrrxrp;o0tpeomfcilt m rlu p;()alerxr3oa1lpDe nei;s0 rum(o oy1lpt  ivtls)s2tmxront1olxnio3ilsfs umu onu) exnir oa1oa  luvo;() etoxm3io1lp nlivt s)a2tmurpnu0teeo feiat a el(vo;u) lenmf iatlptrauvslt  rxrxo nudllenmfetas aruru  nu1tlxnmi3tltfmDuau sn()texnmo3to1fpteaivolt)trxmio3oodape  ncsl() rtaurp;t4ope mictysfa el(mp;(4 ltnxo3iodlpDrlueils0srxmxrpno4om emncsl(f 2rrumooo4tpeoiictad m ulnmsn(0trtrxr totfm rln s ()srxmxr nudapt lnvtlt  Dtru  ;o0aptoiociat s ua(mpnu) exomf3iadfm rauvi;t0 rumirpoy1am nlnvs (fsDumx p;t0opxomfeiltfs2emn p u0arxrxr oo1fm r n il(0 rto(m3ny4lm  mfeta() 2ur(rpnt1tltoii3iaslm2uan o;(4altnxr tadlatraies;t t2xmim3iudolt mnci s aDtm(m oo1alx mf3iatlsDem(mp;u) rxomf to1lpt au i ()teuoxm ou4ol n fetls)aDraumooo1apxniociadfm2eauvo u0 eeoir tydop ean o;s setmxr3ou1ame livt t)sDurxrp;t4ole ii3iydlm emn s t0aexriocto1fm r neol( t2xoxo oo4lle  nvsatfaDum(m nt4aexnioctasla2rlu p t)arenmo3oa1fptr ivils t2xrio nudal emnvs sfsrrm(rooo4apxomictytfs elu p u4aeenmrcoodom  ln i s)sexmxr iu1llte fetls arrrump;u4alen oetlslsDea(mont4texnif3totfpt  ueo;( tetm(r3nu1amenlfvt s) Drr(mo;o1apxnii3iat m2emuvp;u0 ltoxrcoytlm rluvil( s2trim nu1llen iciltf 2ururpnu1aetomfciyd aDra(vs t)aexnmfcto1fmtr iei t0truoio3iu1olt  ieilt)sDrr(mpnu4tpe iieiysla2rau snt)treoio3iydfp eanei;s trtr(r3oo4lm   fcslt)sDtruront4ale mieiltfs2el( s;t)tlermo3tadlmtraivs;(0srtrio io1lm e fei sf Drmumpou4tpto oeiasfa2emums ()alxoxr3oo1lmtran s;t truoxo3oo4alenmfcia( a2umur no0aetn icildlmDeln o;u4altoxfcoatlpD auvi;s0setoxr3io1oleemfetatfsDraxm no4tlto o3tlt a2rluvp;(0artrmrcoodomtrlueols0seurxm3nu4aleemnet tfs2tau ooo1apt if3iad s2rl(vs u)aeerxrctodfpte neo (0 rtmxo3oudol nmnet s)srtmxronu1ope mfcildfa rlnmp u4tltrmf oadfm r iei;t  rto(r3nu4oltemiei (  rraxm ou1aexoii3tldlm2rl(msn(4 rtomfciadla eau ols trxmxo3iu1om e nvi (  Drr(rp;u0olenifciatls2ua(vp;u4 exnifcoy1lp eaivs ( texrxo3nu1al eliet tf 2uax ont4oetoifeiasfs2rl(mp;(0aexomo oy1fmtr n il(  eumxm3ny1lptnlfciltf 2taxrp;t4olxniictld aDelumsnt0trtomr ia1la eanvols)t2umiopio4ll elivs sfaDtaxmont0teto o3tysla2rm(vs t)aetnxf3iydopt li o;(0tetoir iy4apenmfei () rta( onu4alxo i3iatlmDean snt)alxnio3oadfmtr i ol() exm(opno1oltn iciat  Dtmu pnt1apto o3tasls2rluvs;() eenxfcoatoptrlivs;()t2tm(m oy1opeelict t)artmur nu0ope ioeiltfmDul( o;u)alxomo3oo1oa ranei;t)srtrir3oydalee ivil()s2tmu  oo1texniieiydlm2eau snu) lxrxr3oydoaD liesl()sruoxopoy1ole  ncil(faDtaump;t1opeoioeiydlsDua( o (0artoxr tadfmt aivo s0srumimpnydale  nei sfa2uaxr oo0tptomociatfsDemnvpn()trxomocoodfpDean i () rtr(rpoudal e ict ( srtaum nt4alto feiyd m rlumo;(4arermr3io1oate iei;t0tetmxm iu1apee ivt sfs2ta(ro;t4alt moeiytlaDuluvp u0 rtrirciadoa  ln o s) exoio3ou1lltnlneil(fsrtaxm ot1teeomo3iad a2ua( s u)alxnxo totfm e i il(0t2tm(r nu1ap  lfcslt  rurx onu4apxoio3taslsDra(msnu0areoxf3oatfptrlnvo;( s2urxmpoo1am emncs sfaDrru o;t4teen feiytlaDuau o u)tltnxo iy1op   ivi;( sexmxr3io1ap  mivt () rtau  oo4oltniicildfa2elu s;t4trtnxocoy1fp  luvo ( t2ur(o3no1lptn iesltfarrau o;t0olx mfciatlsDelumon(4 rxrifctydopDrlues t)trtrxr oy1ap elnvi t)aDtr( oou4optoiociltfmDea(vs;()trtrio3iotomDeaieils0texo(r3oy4optnlnesasfartaxr oo4apxnifetat a2ua(ms;t4 rtoiocoadfptrln o s srtr(o3oydalt lics s aDtm(r ;t4olt ii3iyslm2elnmo t0teenxf oadoaDeln ils0 rxoxopio4optn neta() Drmu  oo1altoiociyslmDrl(vont4 etnifcty1faD lueo;t  2uo(opno1al   ivsl(  rum(rp;u0tle  i3tadlmDeau on(4treoxocoa1fp r n olt) exrim3nydomt mietat)sDta(ro;t4ole  ieiatfaDua(vs;t)texrio ootlpt liei;t) 2xm(m oo1ol emiet (fs2tr(r oo1tpx  fciatfa umu p;u)alxomo3oytfmD an s;s0 2tmxrpio1openmfeiatfsrum(  ot0apt moctatlsDrmuvp;(0alermr3ia1oatrliei (0texo(mpiy1lpe lneil()sDtmurp;u4tpeoiocilt mDulnvo;(4trtrio3oy1lmte n o t)srxmxo3io1amtnmict ()aDumuroou4altn ieiytlm2umu p (4 ltnif3tatfm e uvs;()t2tr(o3ou4altnlictasf 2ua( pou1apen icildfs2ea(mo u0teermrcootfm elu i;(  2tmxm io4op e neias)srtr( onu0oee if3iytfm rl( p t0 ltrmo3ia1fmtranvo;s t2uo(o oy4alt mfesls  2ta( o;o1opxnioeiytls2rluvo t4tlxomf io1fmDe ues;()trtrio io1apenliesas s2uaum ou0opt ifcildlm elnvp;()altoir3to1lateanvo;s)teuoio oo1amtemivs ()aDtax  ;o1tpe ii3tlsfs el(vs t)aleoxr3iy1lp   ivil() rxoxrpiu1al elfvtls)aDtm(rpnt1alxo octaslmDea(mp t)tleoxrctadfpDe ieo;t) 2tm(opiy4ll nliviltfsrra(mpnu4optoifetys aDemnmpn(0arxrmrcio1latrai i t) euoxo3iy4lltnlfesas) rta(m no4teenmfeiatfsDemu s u4 rxomf totla  ln ilt trumxo3ny4lmtn neiltf ruaxmo;u0opxnmietadfm rm( p () rtrif totfmt aneils)srtmxm3no1al  mfci tfarra(ront4aeen ocilt s2rlnvp;u0trerxoctydlm ranvolt)seuoiopnodomeelncil(fsrurxmpno1tlen iciasfmDrl( o;t0teeomo todfat au o;(0srum(m oo1apt  ictatfsDrmu o;o0texomi3iydfa el( s ()artoir3iodomteaueo;s trtm(m nudlmeemfcsa(  rurxm ;o1aeeomictytlmDemump;t) lxnxrctatlaDr uvi;(0tetoiopoydolte fvil(fsDrru  ot1openio3iad m rm(mo u0tetnio oatfpt lnvi;(  rxoxm3no4apenmiviat)sDtm(m nt0tltoio3iatfm elnmont4aeeoif3oo1fm rlu i;( seumir no1llt mfeilt)sDrrumoot4aptnmictld m2elums;(0 leoxociodlat anvi;t)setoir3iu1om e fesl()aDrax pou0olxomi3iysfa2rmuvpnt4 lxnio todomteluvsl(0 rumir iy1ape mfvtls)a2raxro;t1tlxomoetysfs eanmp (4 lenxocoadfptrli o;()truo(o nudap   nvs t)sDtmump;o1apen o3ilt aDranvpnt) rtnir iodoaD  u o s0 etmirpou4lle lfeiatf 2raxr ot4oee  feiytlm uanvo t)tltrmocoatlpD aiesl( texoxr3oodale mnct t s2ra(m ;u0ope ifeiatlm rau o u0arxomf3iatfmD auvils trtmir oy1aptelfciatfsrtr( o;o4tpenmfetldfaDrauvon(4 lerxr oydfa r ivols) rxo(rpnu4omen feia(  2ua(r nt4aexnio3ild m emu onu0trtrifcoytom  auvo t) exmim3no1ameemiei s) 2uaxmonu0tlen f3iatls uauvp;u)arerxo3tydfmDraieo t0trxrim oo1optnmncils)artrumono0ope  oeiltfs2rmnms t4tlerxocoydlm  lnvi ( trtm(opio4lpe  fei ()a2rr(m ;u0opx miciasfs2rlums;() rermf3oadfmtelnvi s  2tr(m oudlp  miviasf 2tmumoot0oexo octasla2ra(vs;() reomoctodlmDeli s s)trxr(r oydlmtnlnvils) 2taxmpot0opt ii3iysls rmumonu)aetnxrctytfmD lnei t  rumxo3nu4am  micil()s2ua(mp;t0olxoio3iyd a umn o (4aeeoxf3oytfate ieilt) exr(o ou4omte fcsat)aDtruroou0oex iieiltfa2rmuvo;() eenmf3oytfp r uvsls0sexo(mpnudoltnmfct (  rumu  ;o1alto iciasla rmnms t4texomfcty1opDelnvs;(0srxmxr oy1lpen ietas)sruaurooo1aeto ieiat mDrauvs;()alerif ia1oaDrlues;t trtrxr3iydalt micil( srtm(mpot4apt mfeiyt s eau pn(0tlxomf3ia1fm eauvolt tetmxm iu1lltemiesa(  Durx p;u1tetnmo3tltlaDrl( pnt0artomrcio1oa eaueols0 ruoir3iu4llenmfcil(fartmu  ou1texo f3iytfm em( o t4altrmf iotfmt lnvs;s0t2toir iu1alt mncs t sDuax  ou0tlxoiieildlsDel(vo u)texnxociytopDe nvils)t2um(o3oodlpenmieiltf rtaxm ot1tpt moctltfs2ul(vpn(0 ltnircto1lm eaivi s0trxoimpiy1lp   fes ( arumxmpoo0tlxniociad a2eanvp t4alxnmrciy1omD  nvs ( s2uriopoodolenlfvtat) Dtru p;t0opxomo3iad s2rmu onu0 rtnif tytfpte uei;t)t2toxrpoy4llen fcils aDrau pnu4altoiieiatfs uln s;u)trenir3totla eanei;t teum(m iydaltnmietl()sDrrx p;t1oexoii3iltlaDean ont0tltrircia1fmD  nei t) exoim nu4lm nlieiat arur( o;u1tpxoii3tlt sDuanmo t)artomfcta1fptr uvs t)seumirpoydapenmietlt aDrmu pno1tlxo iciyd m2eluvp (0 lxrifctytlmDrauvi;(0 exmiopoo1llte ncs ( s2umu p;o0opxo fetytls rl( p;u)trtrxrcoytlpDe nes s  2urio iodap elivs tfs2rru p;o0oltn fetltfs eln ont0tlerxrciytfm   ivo;s)s2trirpnudomeelnesltf 2tru ont1tpt iietys s ran sn()tlxrmo oadoatelnvslt) rxoxopnydlp n ici tfsDra(mpnu4aet  ieiyt s uln s;t)areoxo3todfatelnei;s) rurir oy1altn fesa(faDrr(rpnu0tle mfeiytla emump;()teenxo3oy1oatelnvi t texr(o3oy4ale  nvsas) Drm(r oo0olto feiad mDeanmp u) rtnmr3oydfmDe uei;t  rtmiopny1apeemicta(  2rrump;o1ale iictltls eanmo;t0arxomoctodlmtrlueo t seurir3iudamenmfcilsfsrururp;o1altomi3tldlsDrl(vsnu0 ltnmo3iatfatrli s;t s2xmim iu1opt lnctl()aDta(m nt4tpen feias a rm(vo t0aetniocia1laD liesl()truoxo3ny1ope mfcsa() rrm(mpnu1alxn ictytfmDelumpn()artoif3totlp rlneols)s2urxm3io1lleemfct (faruax oot4tlxnio3iasfm2uan p;u4teeoir3io1omtelieo;t)t2xrio3iudom emnctat)a2umum ;o4opxoif3iltfa eanmo t) rtnir oytfm rli s t0 2to(m3iydam e fet ( sDtaxmpou4tlx mi3iatfm umnmo ()tlerircootomt  iei t truriopio4ome  fet t)sruaxrpoo1alxomi3iatls2emnmo u)texnmo io1opD li o s s2to(m3nudopt licias srrax ono4altomfeiatfs2rlumpnt0trxrifctydfpDe neo t)s2xo(opiu4ale lfesltfs2umu pou1oleoifciytfm ra( ont) eenmrcto1om e i s s s2xoxm oy1lm nlfeia( a2tmu  oo4apt moeias aDrl( sn() lxomr oytfpt luvs t)seuoxrpio4amtnlnetasfa2raxmonu0tetnmf3iys m2um(vo t) lxoxo tydopDe nvsl(0trxrio3oodamenlfeils srra( oot0ope  o3tlslsDelu p (4tetrmr iy1oa   n olt  rxmim3oudal emfesas sDtaumo;t1oetniieiytfm2ea(vpnu4arenxocta1oaDe uei s0 2uo(o no1alt  fciatf Drru  ;o1open ieiatfsDel( o;(4trenif3ty1faDe i s ( t2xr(r ny4lltnlfvi ()s2trurono0ole mi3tad s2elnms;u) ltrxrciydfpt aneo;t0setmimpou4omeemnctl()sDtaxm ;t4oee  fciat m2um(mp;u4 eenxfciytlatraiesl( tetoxrpoudol  mfeil( srua(  nu4aexo o3tldfa umuvonu4tlxrio3iatom rlueil(0seuoxo oo4ll  mfesl()sDurum ou0tpeoiocild sDelnmpnt0 lxoir oadla   ivs;s0t2ur(mpio1lptnmneta(f rrrur ;o4oleo feiatfs2el( o;t0aexoxf3oydfaDelnei t0trxmxrpnu4om nmivi s sDumu oot0ope io3ilsls um( o;t)texnmrcoo1lpt an ilt) etmim3oodom emfvtatf 2taxm oo0tlx  ieiadla2emu s;u0teenmr iydfpt lnvs ( t2umxm3iu4llee fcils  rrmur no0opto fctasfs2ra( pnu0trxnir oadop  liei;s0 etoim ny1om nlfeslt aDurx  nt1tptnmfciyd m2ea(vp;u4arxoif oydop eauvs;s trxm(m3no4altnlfct s sDurxm nu0oetnmoeiad a2el(vo t4 rxnxo3to1opt li sl(0trxrim3nudoptnmfvs () 2uaxroou4aeenio3ilt mDeanmont0texoxf oydoa e ueol()srur(r iudop  mnetas  Drrx pno4tlxn iciyt s rlnvo (4tlerxr ta1lptr nvs;( seumxr3nodlmeelneiltf rtru  ;t4optn fctytfm2ran pnu4 renmo oydla e u ols  rxo(rpiydopte fct ()a2ua( o;u4apx mfeiysfs2ulums u4 rxomo totfp e u o;()teumxopio1apte fvias)aDta( onu4aleomf3iydfaDrauvp u) etoxr3ia1lpDraivs;s srxmxopiydom nlfei s arum(moot4oexomf3iyslmDemnmo;(4texnxrcoydfatr ueo;t) ruoxrpnydale  ici (  rrmumpoo4tltnmfciasls rm(mp u4artnxo ootfatrliei;( seuoir3oy4openmfcslt) Dta( o;o1tltoif3iytfs2rlnmo;(4tlerxoctotoaDrau olt0s2xrio nu4lmeelfcs t aDuaxrpoo0oex iiciaslsDelumpnt4texnxf3iydlmDe ivs (0sexo(r3iy1olt lietatf Dur( p;u0tptnmfcilt a rluvp;t)aetnio3iadopD aneils0s2xrxr3ou1lmenliviasfaDumxr ;u0tee  fcilsfsDulumpnt4alenxfciadfat an i;s sexoxm ny4optnliei t)srrrx pnu0ale  i3tls m2emumo;u4 eenxr oadop eliei;s)t2uo(rpoudap  mnvia(fa2uru  oo0alto f3iat a emnmon(4trenxrcoy1lmDelu o;s0t2tmir iu4om  mnvtlsfsDtmu onu0tptoif3ilsla2elnmo;u4aeerxociotlateai i;s)sexoio iydll emfetls) 2trur oo0opt  feiyd s2eln s;() lxomr iydoaDrai i;s  2toxmpoo1al emnesltfsDrmx ont1aleo ictytfs uaump (4 lenxrcta1laDeai ils0texoxm oudaptnmfcs s) 2uau ooo1optn o3tltlmDrluvs t)alxnio3tatfptrauvs t0srurir3nydlpte neils)sDtm(rpnt0oexoio3iadfaDrmn snu0altnxocio1optrlneols)srumxo nu1lmtemnei t) rtmu pot4aeeoiietltla eanmo (4 eeoif iotopD  uei t) exrxm3iudlmtn nct ()aDrm(rpot4aleoiiciad sDra( snt)altomoctytfmD lneols t2tm(opnudopenlfvtl()sDuau ono4aee mf3iasfs umump;u0tleniociadfat lies;s srtr(m nudop  mfvs t  2trx o;u1alx miciyd mDuanmp;(4 renxf3iatlp  ln ils  2xr(mpou4lltnlicils a2um(rpoo1texniieiasfmDra(vo u)tleoio oydfmtr n ol( texmir3iu1am n ivsat)a2tm(rooo0tpt  f3tlslm2rlu s;() ltnxr3ia1lptran o t)sexr(r ou4ope  fesatfsrtaumont1tlxnif3ilt m em(mo u)tltrmf oadfa elueo ()setmxopiu1llt  fcilt)aDtrxrpnu4oex mfetls aDuluvpnt4aeenxr tatlp  ai i;s teumim nu1apt mfeta()aDua(rpnu1tex mfcild s elnvs;t)tetoxf oa1la rlivo;s)trto(o3oo1om nmicsl() Drmxr nu4tlt  feilt s um( p;u)alermo oa1faDrln o s  etoimpou4am  livt t)a2umuronu0ale  f3iasfs2umu sn() eeoxo3oa1lm  anei s  exoirpiu1lmenmfet (f rrrxm no4oex iieiydla rm(mon(4aeenxf3tadoateauvs;() 2xm(opnudol n ieslt aDraxmoou1oexomo3tlt a el(mp;(0 rerxo oa1omDeaueil() rtoxm3iu1op nmieiatfs2umumooo4oleomoeiatlaDrlnvpnt4artrxrcoydlmtraivs t srurirpiy4ap e ncsl( artru ooo4ope iieild m2eanvp t)altnir3oo1oatrlu s;(0s2xo(o oydame lfvia(fsDraur ;o1aetn o3tatfmDel(vo u0 eenxfcootopD ai i t)t2urxm iudamt mneilsfartru pno0teeo icilsfaDumnvp u0altoio oadlp rlues;(0 rxmxr3nydop nlncsa(  Dumur ;t4oet  o3tltls ul(vp u4tlxnmf oatfaDelues t0s2um(mpiodamenlfvs t)srrm(m ;t0tlt io3tytlsDrmu p;t0 reomr3iydlatr neolt)trto(m io1amtnmncil(  rrmu onu1aet  o3tytlmDrl(ms;u)trtrir3tytomt liei s) rumimpiydll n nct t)arur( o;u1aptnifeiat aDeaumonu0tlxnirctatfm eau i;s seur(opoy4ale mncsas aDtmu ono4optnifeildlmDuauvs () lermoctydfpDeauesls) 2xmir iy1ll  miei ( aDtm( p;t0tpe mieiydls eln snt4tltoxoctodfatran il( seur(m iu4amte nci ( a2raxmpnu4tlxo i3tydfmDel( s (4 renmf3iadlpDr ues;t)trxm(m iu4ll emiesls  rtrx pnu1aexoifeias mDum(ms (4tetnif iadfa eai o ()t2xo(m nodamt livi sf Dtr(rpoo4tlenmo3iadfa2umuvs;u)trtomf ty1opD ln o;s0teumxm nodlptnmnetls)sDuau  nt0tle iociytls2rmnvont0tlxnir3iy1fa rlieil(0trtrir iodomtelfcslsf 2uauro;o0tlxoiieiasfa2ua(mpnu) lxnio io1omtrau sls0 2tr(o3iydame lfeil(f rra( ono1optn ieilt aDea( p (0aexrmoctodfaD auvs;t) rtrxr oydlp  liesasfaDtaxr no0texomfeiatlm2rluvp (4aeenmf3iy1lpDrau ils seur(r nodapenlfetasfaDurx ooo4aetnmoctyt aDrm(vsnu) rxrxrctotfp rlneil() rurxopno1lptnlncsa(  rtaxmpno4tpxnii3iatls2ranmp;u4 rermo3oo1la ran s t)trtr(m3oo1amtn fcs t) Drax poo4oee iiciaslaDuau on()teenmf oydlmtr uvs;s  exrir3oydop  lfciat) 2tmump;o4olt  f3tysls ra(vo (4 leomr3ootlmDe ivi;t)tetmim3no1ll  miesat a2rmumpnu0apeoioeiltfsDeln pn(0 rxrxfcoadfat lneo s)t2xrir nu1lpe  nvs t aruaxro;u4oeeniieiyd mDrlu s (4 leomfctydfatrau i;s0 2trxo nu1alenmivi (faDrmum ou1apt mieilsfs um( sn(4trtrir3ty1oa r nvo t) 2xoiopoydol nlfctl( arrmxrpoo1tet if3iysla2umnvp;(0tltoxf iy1lpte neslt  exo(m nydopen nvsa(faDur(  ;o4tpt  iciaslsDelnmo;t)texnmf oytlp r neol(0 rumxopnu1am elivi sfa2tmxr nt0oleoifciadfsDrlu p t4alxrmr3oatomtelnvsl(0 2xmim ou4op e fesa( s2um(  nu0apx iociys a2emu pn(4tltnifciatoatelueols)s2xmxr nu1am  mfei s)sDtrxr ;t1oee  i3ilslsDem(vp;(4 exrmoctydopt au ilt)trxoxr iu1ap  livtltf ruru pnu0opt moetadla ul( pnu)aeenmocoodfpteau s;t0t2xrxm3iudlme  ietl(fs2rru pou0oltoioetadlm2rmnmo;t) ltoif tytlmtr n i t0setmim iu4al emfviatfs2tm( ont4apxn o3iyt a2elnms;()teeomrcoa1fpD  nvo t) etoio oodomtemnesls a2ta(rp;u0olxn fetas s ean snt)aexrmf tadlpteln s (  eumxmpoodlmtnmiciat  rra(  ;t4oee  fcild a2rmnmp;t) exrxrciadfmDeluvil()s2ur(r3oudapenmieta(f 2tm( ooo1oet  oeiasfs ranvs u0tetoio oytfmt lnes t) 2xmim oo1oltnmfviat srtmu  ou4opxnmf3iatfm2rm( o;(4arenmo iytomD luei ()texmio3oo1op   fvtat)aDuax p;u1oetoifeiatlsDeln p t0 renxr iytlpDe i s (  rum(mpoy4opeemfvtatfs2rmxmpnu0optoii3iysla rm( p t0teeomr ta1om e uvi;()t2xo(o nodlltn ncsl() Duax ono0tlen f3tls a2ea(vp u)aexoio3iotfmtrau o;t) rumiopoodol  livtatfarum(mpnu1tetoio3iatfaDul(vsnt0 rtrmr iodlm  lu o t0 rumirpnydamt livta() rumx p;u0oee  ociasls2ran pnt0 ltomfcootomt luvi ( t2xo(o nu4al  mfvsasf Dur(roou4olxnmfcildfa umnmpnt) reoxf3oadlpDeln s (0 euoio3iodlp elfci ( sDtr(mpnu0opxn i3iysls ran o u0arerio tadfa r ies (0s2xo(r ny1omtnlfeils s2tmur ;u0aleomf3iyt aDuaumo;t0texrxr3iy
\ No newline at end of file
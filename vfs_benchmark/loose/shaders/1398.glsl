@@ -0,0 +1 @@
+uvs;s  2xoxo3ou4ope  fcta( sDum( ono4tpt mo3ild m eanvpnt0aeenmo3oadopt  nvilt teurim3iu1olt  icsl(fsruaxrp;u1tpxnmociys mDrlnmsnt0tlenxfctatoa   n s t sexrxrpoy4ap  mnvt t)artmxmono4apt  ieiydfsDelnvpnt4aeenxr3oodoaDr i il(0srurir3oudom e fcilt aDtmxrooo4teeoifciys aDra( o;t4 exrirctotlmtrlnvo ()sexo(opio4olt lnvias)aDumuront1apx iiciyd s2rmnvs t)tlxrxr iadfptrauvil(0trxmxm no4ol  mnesl( a2ur(m ou0tlx ifeiytfmDum(ms;(4 renmr tadfm e neo;s0trtoir no4lmen ivt s sDua(moou1tlto f3iat sDelumpnt4arxnxo3oa1lpD  i ils0 etrim3iydlpeelivias arumxmp;u0tltoiiciltlsDrmu pnu4teeoxoctodfmteau i t0teuoxo iydll e ieils  rtru  no4opeomictytfaDrmuvp u4aleomf oodfaD aivs t) 2toxm3nu1olt  nctltf Dumu  ;o4optnmieiadlmDumnmp u0tltnio oa1opD aivi;s  2umxopoo4amt mnvi sfsrtrxrooo4tex iictyslmDelums;u)tltrmocoodlmD anei () etrim3iy4lp elictasfsrrrxm ot1aptomo3tadlmDuanvs;(0 rxnmr3oa1lpDeli slt truoxr3ny1amenlnvtls  2um(m ;o4aexn fciad mDem(vpn(0arxnxocia1faDr i ils)seto(r3oodlme  ieils)aDtau  ;t4aetnif3tyslmDrlums;t4alxomf3oodfate n ilt truoxo oodaltelnes t s2rmuro;t1tpxnmf3tytfsDemu onu4altrir3oadopt  neo;(0 rxoxr iy1apeemfetasf Dra(  no0teen ietatfs2uanvs;(0trxnmo3iodlmDeanes;t)srtm(r nodomen neiat)aDrrxr nt4olx ii3tlsfa2emu snu)altrirctatoaDe u i t  2uoxo3nydlmtnlfci s) Draxr ou0tpeo f3iat s2ul(ms (4altnif tytomte nvsls) 2xrim3oy1alt lnctltf Duaum nt4openifciyt m2rl(vo () renmr3iodlm eaivsls0tetrimpoudal nlfeias arum(rpnu4aet io3ildls2emnvsn() rxomrcoodoa eaieols0seumxo oy1altnlieiat a2taumoot4opt mfctydlmDea( s;u)aexomf oytlptraivs;s) etoxm3nudomte ietlsfarta(rono1tlx  i3iat mDeaumon(0 renmo tytlmt anvi t0setr(rpiy4am emfcil(  2ra(r nu4tpxo fciltlm2ua(mo;t0altnxocoadfpt  uvol()texrxm3ny1oltemiesl()sDtrx  ot1tpxniieiytfmDuanmpnu0aetoxfcto1lpD au sls)t2triopou1lm  mies t aDtaumoot0tlt mfciyd aDrmuvo;() rxomociotoat  u sl(0s2toxopnudol elnciltf Duaxmo;t0opeo oeilslaDem(vpnt0aexrmr3tytlm e ueols srtmimpnodaptn neta(fs2uau  ;t4texo oetas s2ulump t0trtoxr3tatla ean ol( t2xr(o3nu4optnmivt ()a2trxrp;u1apenmoctadfa rmnvs u4 lxnio3iotlpD liesl( s2umimpiu1lmenmnet s)srtmxm ;u1tpeoiicilsfm ra( p u0aetoifctotfm elieils t2uoxm no1lm n ivtls) 2rax pno0tpt mieiytla umnmsn(0 lxrxfctytlmDeaivils)srxoio iu1lp nmiesltfsrrrx p;t4oeenmociad m2eaumo;t0aeenmr3oa1fmDeanvo;t tetrxopnodapeelfesasfaDrmxro;u1olt  fcildfa2eauvs;u4alenifciotfa rlueol()texmir iydlmenmnviasf rraum ;t0tpxnmfcildlm2em(ms t) exomf3tytopt  n o (0setm(r ou1lpeelfvsa(f ruru ono4aeeo octyt m2rmnvsn(0areoxr tadop  ln il(0teto(o iu1lp nmncia(fsDrrx pno0apt  f3iadla uan pnu4aleoio3totlp rlivs;(0texoirpny4amtelfciat a2rmu pou1tlenmf3ilsfaDuanvs;(0 rtnxr iadop ranei;()t2trxm3ou4altemncsa(fs2tau  oo0tlen o3iatfaDua(mpnu) ltrmr ia1lp e ueol(0t2uoxr3nu1lptelnesls)aDtaum ot0tpxn i3ilsfm elu pn(4tetrxociotoaDeauesl()teuoim oy4ap n nesls a2umuront1oee ioeiadfmDrlu p t) rxriocoo1fpD luvs;()s2tmio3ou1alenlnctlt a2uaurpot0tptniiciadfs2rmnmo u) leoio oo1fp e nei;s s2xoxr3iydlleemfcilt sDtm(mpnt4alen oeildla2rmuvo u4alxoiociodlmD ai ol() 2xmxo3oydole lnei () 2trxrpoo4optnmieiysfaDem(msnu4tlxnxr3tydom   ueil( teto(m3io1ope mfetasf ruau  ;u4alx mf3ias a uluvo (0 rxrif ta1lpD  nvo ( sexm(r3nudome lieil(  rraxrooo0tlt if3iyt s2uauvs;t) eeoir3oydfatr uvil()trumirpoodlpe  fciat a2umx oot0tleoif3ild a ul( pnu0tlxrmrcoy1lmDe ies ()trumiopou1ape mncta() Duaumooo1aet moeias s2em( sn(0alxoxr iy1lpD  ieils)t2uoxr nudaptemiesas) 2umurp;u4tpxn ieiyd aDuauvont4aleomr3ty1lm rlieilt0 2xm(o iudoltelicia() ruau p;u1tptoii3iat m2uln ont)artoxfciatoaD  u sl(0srtm(rpnu4amen fetltfs2rmxrpot1altniiciat aDuan s (0 eerxf3todla   uvs s trxoimpnodlleemneiasfartrx p;u0alx ii3tydla rmuvp;u)arxnircta1fm ean sl( sexoxrpno1ap  lncs tf Dumxr ot1ole ii3iat sDemums ()artomr oy1opDeai o s0 euoir oudomee neiat  rrrumpno4aexnmoetatfs umn s;t0treoxr3tydfmDrai il( t2xmxopiu1lp nlnvsls) 2rr(r ;u1tpt mo3iadlm2eanvsnt)texoxo oy1omD lnei;s srxo(o ny4ol   fctat arurxm nt4alx iictyd a umu p;u0aetnxo3oa1lpDrli slt0texoxmpoodop nlnvils) rraxmonu4tlx mf3ilsfa2rlnmpnt4trermo3oa1lpte ivo;s)t2xm(mpiudol e fei t)s2rrx pot4tpenmi3iytlmDumu o t4aetomrciotlp rlneolt0srxoirpio4al n nvtas) 2umumono4tlen i3tas mDea( onu4tlxnmr3oatlptrln o s  rumxm oo1omt lfesl( a2ta( ooo1aptoioctydfm em( o (0 rxomr iodfpD aieslt)s2trio3ny1lme mnvslt)aDtrxmp;o0olxnmfctlsla em( s u4aeeoxo3iy1lmt li i;t  rxo(opoy1lmt  netas  rraxr ;o4openmociydlm rauvs (4artoxfcootopt lueo;t)t2xrxr oodllenmneias)s2rrurpou1opt iictyt sDra(ms (4alerif oo1oaD luvi;t0teur(rpiydal nmfeta(f rtr(mp;o4tpe  ociydlm umumonu)alxrxrcia1fa e ivol()s2to(m3oy1om  mivt t artr(  no0tpenio3tld a2emumont)tlxoir tatoatr iesl() exr(o3no1altemieslt) Dra( onu0tptniieias m2elu on()aleniocoo1lpD li ol( s2tr(r3no1ap e ivi ()a2urumoou4opeo f3iysfm umuvpnt4trxrifcoy1laD aiei;s0srtoio io4oleelnes ()aDum( oot4tpt  octydfm2uanvo;u4trxnxr oodfp rlu sl() rurim iudoltnliviat)s2tm( pou4opxnmicildfs2ranvs t)treriocoadlmtrlueols)sexrxmpoudoleemietltfaDrm( pot4aeeomfciadfs2rmn s u4 eeoio3ia1om raneols s2umio nu4llt  ies s) 2tax  no4oltnmo3iltfaDrl(mp ()arxoxoctotlmt lu ol()sexm(mpiy4ol nlnci t) 2tmx pnu1aee moctytfs el(msnt0 exrmr3iydfmt aues;t trxm(m3oydolte fvt (f 2rmxrpnu1oet mo3tat sDulnvo t)aexrxociy1opDeai i t0 2toirpnydopeelnciltfa2taurpou1aetnmo3iyd s2ulnmo t0arxrmfciodomDrlueolt  eurxrpoy1llen nei t  Durxm no0aee  ociytlaDel( pnu0tetomr ta1oa r n o (  2toxr3iu4altnlfcsl(fsDtr(r no4tetomoctlsfm2rmnvonu4trtomrcoatla r ivo;(0texriopiu1ap n ncsas) 2tauro;u4olenmf3iytlaDrl( o;u0aeenxf oytfate neilt0sexo(mpiu4ol  mneiltfsDrau  ou4tptn i3tad s el( pnt4tltnxfciadla eluvi s)sexm(m nodamee ivtl() Durxr nu1olxo f3iad sDulu s t4texnirctatopteau ols) 2xoxopoudlme  fcias srta( pou4ole iiciat a2rauvp t0aexnif totfpteauvi;( texmxm iy1lme  nvi sfaDumxro;o0tpxomieiltlmDuln p t4aeeoif3tadomteaiei s) 2toxopno4oleelfetas)s2rrxrooo1oex ii3tytfmDem(msnt0trtnmo oatfm r u o;s texm(opnu1omtelfvt tfarurumont0optoioctldlm emumo t4alxnxr oydlp raieo s)srtm(o3oodlpt lnvil(f 2trxmooo1oeen fciatls eaumsn() reoxfcootlmD ln i;t teuoxr nudopen fvs s  Drrxro;t1opxnioeiasfm2umnvp;t)texoiocta1oatrluvs t  rxo(m3iudlltnlictlt sDrr(rpot4tpt  fetyd a ra(monu0 reoif3iadom eaieils) 2xm(r iy1om n nciat)arumu  oo1oltnio3ilsls ua(vpnt4tetrif3oo1la elnvol(0 exrxmpiu4am e ncslt)arraur ot0ope ii3iasla2ulu o;u)texrmr oatlatrliei;t0srxrxr ou4opee ici () 2ra(m nt1tpenifeiyt m2rmu o u0tlenir3oatopD  ueslt) exrxm3oo4optemfet t) 2uaumono4aptn f3iad aDrmnvs;u) lxoifctadlaDelu ols)texmxrpio1aptemnet tf Drr(rpnu0apx if3iytls2rl(mp t0trxnxr io1opDr ueslt)texmxr oo4alee fcil() 2ra( pot4aeto fctatlsDulnvo ()alxnmf3oo1opD  ivs s s2umiopnu4lptelfcs t)s2ur(ro;o1oee mociltla elnvo;u)aexoiociatlmDr ies;( s2um(m3io4ap  lfcs s)arur(mo;u4ope mfetyslm uan p;t4 lxnxr tydfatelivolt) rxoir3ny4olt mncta(farra(r oo4texnmiciatfaDuanvsnu0 eenio3to1opDe n s;s)trxoxo oudolenmfcia(fsrrrxmoou1oltomoeiysfm2uanmp;() rerircio1optrlnvilt0trurimpiy4lltelfvs ()a2urxront4aexnif3iysfm eaumon(4aetnio3ia1fm  lneo;s s2xo(o oodlmte fvt tfa2urur ot4tpt  fetldlm um(ms (4 rermr3ootfmt  nvol()s2urxr3iy1am  lncsa()a2rm(  ;t1oetnioetytfsDeanvpn() lerxr3ta1lmDe n o;s0trxr(o oodopt mfetl() Dtmuro;o4aetomictytfs eanmp u0tleoif3oa1oateaivs (0 rto(mpiu4ol emfes sfaDta(mono0tlenmociadfm el(ms;t4artomo iodlm r uvs s sexo(mpou1omenliet (fsrumumo;t1tpxn i3tyt s eanvsnt0aetoxo to1opte n i s  etoxmpou1lpt lfcs s sDrrxmp;o1opxomoetytfmDra(vo;u)alenxfcoydfpDranes;()t2tm(opiodal   ictltfsrta(ro;o0aptoiieiaslsDea(vpn()treoio todom rli o;s trxo(mpnodamee fct s) Dumu pou1teeomfciad aDeln s;(0 lxnir oo1la r u o;s0tetr(m3oy4al nlfcslsf Durx o;o4aet mf3tyt mDelnms;t)aeermr3iatfpt  nvs s t2trir3oydalenlfvtat a2umump;t1olt ifeildls2rlnms () rerio3oodlaD  ivi t0seum(o3nudopee ieil()artm(mooo0olxn feiad s2rau snt0 renxf ty1lmD  i i;s)srxmxopiodapenmfvtas)aDrrxmpnu4tlen f3iltla eaumsn(4 leomfcoy1lmt lu s ()t2xriopoo1lmt lfei s srtmxm ;u0aexn o3iydfsDuaumo u)teeoiociotlaDelieolt)tetm(r nu4lle miesls a2rrum oo1tpto o3iatfa2elnvonu)alxnmocto1lmDean sls)s2xm(m3nodap e ici s)arrmu  ;t1opt  f3tas mDumu sn(4tlxomr oodlpteluei t srxo(m3oo4lm  mnes ( sDtm(ronu1apto o3iadlsDeanvon()tetoxr3oy1oateauei () exrxopno4ope lneslsfarrrxm ;o1aetnmieiasfaDemnvs;(4tlenxr ia1lpD li slt  rurir3iy1lltemfciat sDrax  ;o4aet mfetls m elnms;u0tleoxf ootoaD auvi s) etoxr3iodllenlfet (  Dtr(m ot0tee mi3ilsla2umu s (0texnxrcia1opD lnvilt0seuo(opnu1al nmneias sDuaxmp;t0teeomociaslm2raump u)alxoirciydla raueslt) rxrim3iy4opee nctlsf Drrx  nt1aleoio3tyslmDemumo (4aexoif3tadfmte uvi t0 exrir iu1om  lnet t  rtrx o;o1apxnmoeiat m2rl(mp t) eeomr3todopDelies;t  2trim3io4lmtnmfci s  Dumu ono1aeto feiyd s ea(vpn() eeriocto1laDrauvo t) exo(mpiu4alt  ivslt  rrmuroou0olx  ietat a2rmu o ()teenmo3iotlmD aiei t0srurxr3iy4ap nmncsa(fa2rau  ;t1opeo ociltfa2ua(mo;t4artnmfcoy1fate i ils0texr(r iu4lltn fesa(fsruau  ou4tpxo o3iyt m eln s;(0areoxr3ootfmt li il(0 exrimpno1lp nmncs tf rtm(monu4alenioetldls ran p (0alxnxr3oo1fm  luvi t) etr(r oudaleelfvslt) 2ua( pnu1apxnifetadls emuvsnt) ltnioctatlmte nei;(  exrir3iudoltnlics t s2tm(rpot1opxnmo3tytlm2ul(mon(0texriocoodlmteanes t0 rur(opnudopen ncsls s2rau o;o0aleo o3taslm ra(vo (4arerxr ootoate neols)trum(r ou4alt micsat) 2uru  ot1alxn i3tat m2rauvs;u0tlenxr3tydlpDranvs () exrxm ou1ole lfcslt) rumxm oo0opxn fcildls raums;()aexnxr3oo1fpDr u i;s  2xrio no1lpee fvslt a2ra(moou0tptomfcildfs ulnvp ()aeenxrciotfa r ueo;(0trtrir ny1lmeelfvsa(  Durxmo;u1open ietydfa2rauvo (4 renxf3tatfmDeanvs t0t2tmirpiodopeemicta( arta(ronu1apt mocildlm2ra( o u)tlxoxrcto1laDelu s;t0 eumxm3iy1al   ivs t  rtrxr ot0oee  i3iad mDea(vont)altoxr3oo1opt lneo t0s2uo(mpiodop nlnci t)sDumu  ot1aee ifciadlsDeanmont)alxrir oadlpte ivs t) rtoxrpny4ol nmfcsat aDrrumo;t0ope  ietyslm ua( o t4aeermocto1omt  i ols trurxo3iu1ol e ieil(f 2rru  ot4alx io3iyt s2umu p;t)trenio tadfat li o;t teto(m3iy1apenmiviatf Durxrpoo0ope mieiasfa uanvo;() lxoiocia1fpD lnvo;()srtmxmpiu4lltemfctas)srua(r ;o1apt io3iatfaDem(mpn() eermo3iytla eln ilt0setmxm oy1ol n iet tf Dumxrpot4tpenifetltfa rmums (4artrmf3ty1fmt aieil(  2umirpio1ll n netls srtm(m ;t4tltoiieias sDulu on(4aleoxr iydfpDraieol(0 2tmir3oy1lmenmfeslsfsDtmu oou1teen ieiaslm rln pnu4 lenxr tatfaD ai o ( s2xrxmpiu4ome lnetl( sDraum ou4opxn ocias s umuvsn(4altrmocoytlm  aivi;(0sruoxm nu1lpeelfes (f rrm(m no1alx  f3iatla uauvsnt4aetnio3ia1lpDranvs s  rtoxmpou1lpeelnvsa(farumu o;o0texn f3iys s rlnmo (0aetrxfciydlmDrai i ()srxm(r3nu4ape mici (fs2rm(rpnu4optn f3iadlmDuaump t4 exoxrcta1laDe n sl() etmxmpiudlltemnes ( s2tr(rpnt0tet mo3ils m raump;u0 etomfctytfmDrluvs (  rumxr3iu1opt livtas aruaum ;u1oeen i3iytla2rmnms;u4aeenxf3iytoptrlu i (0t2toim nydomtnlfesa() Dta( p;o4teeo f3ild sDrln snt)aetoifciodlmD livs;t)seurxm3oo1lpenmfcslsf 2urxmo;o0oeeoifciydla umump u4 rtrmfcio1opt ln olt  2trxm nu1ap nlfvilt s2trx o;t4altnifcilslaDrauvp;u4alxnirctydfat li slt)srxmir3ou4omt  nvs t)srtaxmpnu0tlxniictyd aDrmu o t4 rerxrciatlpDran o ( trum(mpnydap nmivi tfs2rrxm ou0aptoiieildfsDeanms (4 reoif oydlmteauvols t2xmirpiy4lme  iei t  rtaum ot0oetomf3ilsfs rl( p ()tetoxf ia1latelieils  exrxr no1lptnmivt t) 2rm(r ot4tpe iieiltfa umums ()tlxrmf ty1fatelnes t)sruoimpny4lmenlfvsas) rrrur ot4apx ifctldfm um(ms (4altrio3oy1fmt anvo;t t2xr(mpnu1olt mneil()s2ur( o;u1aexn oeiltfm2uln p t4 etoio3oadoaDrlnes s) eurxmpnu4olenlneta( srtmx  no4oee io3tyd a ran p;t4trxomr tadfmt  nvo ()srto(r3iu1ap nlfviasfsrraumpou1altnioeiyt m2rau pnt4aeenmo tadfaDe ies;t0t2urxrpiy1aleemnei sf 2rmxrpot4tlt  f3iysfs eauvsn(4tleoir oodfpDr nei;(0 exm(r oo1ol nmietat) Dtmx oou0olxoiieiytfs elu o;u0arxrir tydopt ln ol() rtrxrpnu1ome  icilt s2rr(mpno1aetoiicild mDem(mpnt4aeermo ty1omtr iesls) 2xrxo3iu1apt lneias arurumont1apt mf3iytla2ulump u4 exomfcia1fpDrai s;() etrxo3oodlmeemfvsat srrrurpot4teto octldfs ul( on(4 lxrmrciodlpDe n i;(0t2xrxm iy1lmee fciasfaDtmum ;u0tlt mi3tasla rln p;(4arxnir ia1oaDr i ol( s2trir3iy4lm elfvs (fsDtrxm ;u4tpx ioetytfmDuaump t4 rtomfcoytfm   n i () etmim3nudalenlnci t)a2raum ;o0aex ifciadlaDea(mpnu0tetrio oadomDelies;(0 rxo(o3oy4om elivsatfaDrm(mp;t1teeniictytfs eanmpn()arxrir3iydlaDr u il(0s2ur(rpoy4ol n iesls)s2raxmpot1aet  octadls2ul(vs;(0trtrxo3iytoa rli i t0setrxm iodal e neia( arraxmpnt1alxoiieiasfa2uauvpn() exoxoctadlpt  nei s0trurxr3iu1oltnmieias) rur(rono1oeeoii3iadls2eau s;t4tetrmr3oydlmD  n o;(0texo(m3oo1open ivsa(fsrrrumpoo1teeniiciatfa2rmn onu4teerir3iydomt aneol(0teuo(r no1omte fcs s)a2tmur nu1apxo oeiltlaDulnvo u)artnir ootla  au ilt0t2tmxm3ou1lleelfcilt  rra(mpou4oetnmfciasls2ra( o u)areomfciytomtrli sl(  2tr(m3oodll n fesas)s2uaxronu0opx iietyd aDrl( ont4 rxrxf iy1fpDrlnvi t0 2uoirpou4opee fvsl( arua(m ;t0tlt  ieiydlm uauvsnt4trtoxfciy1fmt  u o;s  euo(m ou4lmeelieia(fa2ta(rono0olxn ictls a rmn pnu4trenio oatoa  ai o;(  etm(r oy1ameeliciat)s2tmxrp;o0apt  i3tlt m2umuvs;t4areoxf io1op rau s;s)sexo(m no1opte fvtl() rum(m ;u4opt  f3iatlmDean pnu)aexnxo3oadlaDr uvsls0 rxrio3oy1lme livtl(  rrrump;o1ope mi3tltfm rmu pn(4tltrxf3iy1om eauvi s)teuo(r ou1lme  icias)arta(  ou0alt mfeiad s ea(vs u0altnmr oo1opD luvol() exmxm3nu1al elfvs (f 2ururo;t4teenio3tadfa2um( s u0texoxrcoytfmt  uesls sexoxmpiu1aptemics () Dum( ono4aee ioeiad s2emnmp (0alxrmf3iydoa e i s;t  etrimpiy4amenmnvs ()artm(ronu4ape mietyslm2el(vpnu) eenmr oodfmteaueols)srtmxrpoudolee fcsls  2tr(  nt0tet miciyslm2ul(vont)artoirctotomte ueo t0 2trim iu4alee ncils)artm(monu4oetn ieiytfsDeanms;(4aetrxr3todfmtr neo;s0s2trxo iu1amtelfcsa() 2urxrp;o0ape moetaslaDemu o;u4aetomocty1fmteai i ()s2trxrpio1lleelnviat arrrxm nu1oet mictad a uau o t)trxomoctatlat aieilt0 2umim iu1ll  mivt t  rumx  ;t4opxnmf3iysls2rm(mo t)aeerxf3tatfm eluvolt)t2urim iodoltemfei t)aDraxmooo4oet mo3iadfmDumn s u0arermo3ootla e nvilt0 eto(r3nodlp  mict s)sDrmxr ou1apt ifeiydfaDrmnms t) etnmf3tatlaDeanvi;s)teumir3oudap n iet s  2trx o;o4openif3tltla emn p t0aleomfctytfpDrlivi () 2xoiopiydomtemfvtl(  2rrxrp;t4tpeniociatlm ea( o (4 lxrir3ty1laDraneo (  2xrxrpny1altemiciat)a2tr(mo;t0tlenmo3iyt aDulumo;()tleomr oatomDrau ilt texrim oudal e ivtat arumu oou0alto iciyt aDuln pn()trenxo tatfaDeanei;(0srtm(o3no1lm  mivt sfs2rrxro;u4tptnmi3iytlm2uan sn()alxrxociatla elivols t2xoio oo1omte iciltf Dtm(  ;o4teeo feiyd a rlu s t4texomf oo1oat au olt)t2toio3ou1amen net sfarum( pou4oex ifciasls2rau o;t)trtnmo3ty1fmtelu i;s)t2umim oy1lpe mneia()s2ur(m ou1opxo fciyt m2rau s u) lxomfcootom rlueo (0setrxrpoo4am  lfcsa( aDtm( o;u0apeniiciatlm rmnvo t4 rtoircta1oatrlnvo s0t2xoim io1ol nlnvs s)arrr( ont0olxnmfciytfs eluvp t0aeenir3tydfpD  nvol( sruoir3ny1al nmneilsf Durxrpot0oexo o3tytlm rau p;u0trxnxo oydfmDrlivs t0trum(o io4op  mncilt srra(  nu4altoii3iat a elnvont0 etnmf ia1oat aivi;()seurxmpoydlltemivils a2um(rp;t0opxomfcild sDeanmp;u0 exoxo3iy1fm rluvo;t0 2tmir3oodllt lfes t s2uru o;o1aptomoeiysfs uln snt0 exniocia1faDraivo s  rxrxopio4llenlfes t a2taumonu1oee ifctyd sDeau p;t) etrmocoytlmt livs (0 eto(m3iudomtnmieiat)s2urxmonu4apxnmoetys s rm( onu0aeeoxr3ootlm eluvs;s s2toxm3iydolee fci sf Dumxmpno0apt mociytls2rlnms;()tltnir oo1omteluvi;s0 2tm(m3iu4lpt livtls)sDrruronu1oexomietasfa2eanmpnu) rxrmo3oatomD  neilt0texo(mpiu1omee neslsfs2rr(  no0aexo fetat m em( onu4teerxf iatlptrli sl(0s2uoim3nu4ome lfci ()sDuax o;u1tleo feilslaDelu p;u4areoio3iadfa rlivs;s)srxmxr oydolee fcsl()sDrm(rpou4apeoifctatfs2rau onu4 reoirctytfmt li s s0teto(opiy4opeemnci sfs2rr(rpot4tlenmfeilt sDulnvpnu)tltnir io1opDrlnvs;s  rxo(mpoy4ll nlnct t  rrmu  ;o1aexoif3ilsfs umnmp;u0 rxrmoctodopD aivilt teumirpny1lleelfct (  Drau  ot4apxn f3iltla2el(ms t0artoifctotoptrau i s  exo(o3iy4oleemieiatf Dtruront0oexomfciys s2uanmpnu4tltomo3iatla  lnvs t)srxoxopou4oltemfci t)aDtaxrp;t1tleo i3ildfa2ea(mo;u)texrmf3iy1opt ai s ( s2xmxopno4apenmnetltf 2rru o;o1aptnii3tldlmDrl(mp u0 lerxociadlmD  nvs t srxrxmpoudamee icsls s2raxmont1oltn i3iytls2ranms;(4areomfctadlpDr ues s0t2xrxm3ou4lmtn nvi sf rtmxr ;t1aexoifctatla umn o u0 lenmocto1fatraivo;s) 2xm(m nu1olenmfesl(  2ur(m ;t1opeomi3tad a2ea( s u4tetrifcootfat livo;t0 ruoio nu1lmee ncsas)artaum nt4alxnmf3tldfa ea( pn(0 exnmrcoytoptelu i;s srxo(m3oudal nlncta( aDtm(m ;u0tpx iictltfs uanvont)artomo iydomt livs ( sexrio no1ap nlnvs sfsDumxrpoo4tlx mietadfa raumsnu4 lxnmr3oadlm rln ils s2uoir3iu4lptnlfvsl(farrmxm ot4oeto iciyslm rmn o u0 exrxf todlaD lieo;s  2tmxm3ny1amtemivi (f ruax oot1opeomf3tatfs uanvo u4 etrmfciotfat lu s;t t2tmir3iu1altemivtat srtau pnt1oee iictls s2eluvpnu4 lermr ia1lp rlneils) rtoir3iy4lpen neslt)sDtrump;t4apx ii3tytlsDeaumsn(0 eeoxrcty1opD lnvs;t  eto(rpou4alt lnct s) Dua(mo;t1tpx  o3ilslaDuanms;u4trxomo3oy1omDr ivo;s texmxo3oo1ol e fei tfs2umu o;o4aleoifetlt a ea( on()aexrio3iotfat ai ol( tetm(rpio1amte nvsa() rrrumpno1tlenio3ild mDrl(vo;t4tlenxocta1optraueils)s2uoim ny4alte fvtl(  2tmx poo4aexo i3iat a rmumo;u4 etnmf totfaDeau olt seuo(rpoo1om nmiesat srtau pnu0apeoio3tldfsDem(vp t) rxoif3ta1optraieo s)sruo(rpoudame lictlt)arrm( onu1optnioetlslm uluvpnu4areniocta1lp  lieols t2urxo3oy1lm e fcs t srtmum ou4oet  o3tytfaDuanms;u0tetrxf3oodla elivil(  2trxr nu1op   fvil(f Duax pnu0apxomi3tadfa2elu s;u)aeermociodfp rli o;s) eumimpio1ole lncsa()s2rr(ront1apt iociaslmDem(mont0tlxoxrctytfpDelues;t srum(r oo4alenlivsa(f rrauro;t1open ieiytla rl(vs;(4tetrif3oadfatrlnvi;t0trtrxm nydlpt licil(faDta( p;t4tpx  feiltls2ran snu4alenmr3iy1faD ln i;t) rxrir3io1lme  fvtas)srtm(mo;o0oeen ieiyd a2rmums (0alenxr iadfmt  n sl(0seurim3iu1lpeemnctlt  Drr(rpou4aleomf3tasfm umnvs;u)aetrmo3tadoptelneo s0s2tmio3oo4lp elneia()srraumo;t0texnmo3iys aDem(ms;t0tlenxrcootop e i il()teuoxo ou4ap elneil( a2rmumpno0aee mi3tad mDumnmo (0tleomocoodfp rauvo;() 2ur(mpio4amtn net ()sDumumoot4apeoiictlt m2rauvs;t4 rxoir tatfmte ieolt  rtrio3no4lmeemiesl() Dumurp;u1tlxo fciatfmDemnvs;t4tetrmr3tytom  anvo () eum(rpou4aleelictltfaDrruro;o0tle mieiysfm uan o;u0arenxr3iydfpt  n s;( trxmiopoy4olen fetl( sDtm(mp;o0altoifetldlm eaump;()aexrmrcoodfpDrli i t) 2xo(mpiudop nmnvilt artrxmonu0ape iieild s2ulu pnu4aeenmo to1fmDrlivs;t)truo(o iu1al  lfetls srtrxrpno1altomf3iatfs ulnvs;() rxrmo3iy1lm   ies;s)s2uo(m iy1llen fvt tf rrauroou4apxo fetad sDulums u)texomr tatfaD  nvils  eumimpou1ll  mfeia(farrr( pno1aexomfcildla emu snu)aexrxf3to1oatelu i (0t2xoxm no4olt mictl( a2ururoot4aeenioeiydfm rau sn() lxrif3oadoaD lueo;(  rxrxo3iy1apt  fcilt)sruru pou0alxnmf3tyslmDranmo;(0aeerxo tatopt livo ( seurxopoo4lp e ivtat  2rm(r oo4oetnii3tld aDea( o;t)alenmfcto1opte uvo;()srxmxo3nudope livtlt)artm(mpnu4tltnmociasls2ua(mo (0texnxf tytoaDean ol( teumirpnu4lp   fcilsfa2rm( ont1tpxo oetys aDemn p;(0trerio3iotfmteluvslt setoxr io1lmt  feiltf rtmxm oo0oeenmietyslaDumu on()tetrxo3to1faD  i slt  rxmxm3ou1amt livslt)sDtm(mooo4apeoiictltls eln o u)trtnxf iydlaD livs;( texrxrpiu4al n fci t  Drmu  ot0oeen o3ilsfaDrlnvs;t0tetoxr oadla e ieolt  etmxm nodll elnvslt s2umxmo;u0tpeomfctld a uan on() exoiociotlp eau o s)seto(o oy1ole  ivs (  2ta(m ;t0alenii3tysfmDum( pnt4 ltnmoctydoaDean il(0s2xmiopoudope lnei () 2uaxmono0oexomi3taslaDran o (0 renmr3oadlmDraneo t0seuo(r3nu1opeelfei t)srur( p;o1aeto fcilslm elump;t4artrif oo1fpD lu o s0t2umxmpoo4amt  net t a2raxmonu4aex mictls mDelu p;t0tlerxocto1fpD  ueo t0s2xr(mpiydam emncsls s2rmu  nu4altoifeiydfa rau s;u4arxoio oodfp  ln il(0 2tr(rpou4lpt mivt s srrmxm no0olt iocils m ea(msnu0aetoxr iydfa eau i t0sexoio3nudaltnmfci s a2tm(  ot1olt mieias mDuauvo;u0alxrxf3tadomDean o t0trto(m ou1omtnlictas aDrr( poo4oee iicils a2elumsnu4tltrmr oadoatelnesls)t2xoxo iy1opte fvs sfsDta(mont0opt miciasfa ean pnu0 exrmf iodoptrauvi;(0srxr(r3nu4lle lncslt sDtrum ;u1opx  f3iltfa rln on(0trxoio3oadopD anvi (0t2tmimpiodalee ict s  rumumpot0oeenmf3ilsfa ulnvp;()texrircta1fpDran o t teum(o3iy4lpenlfctat)s2rrxmoot4aeenio3ilslmDrmu sn() rtrmfcto1laDelnes;t)s2tmxr iy1ap  lnetlt)artrxmp;o4oeeniictlslaDuanvs;u4texnircoytfp e uvi s0 2xmir3nu4op emneiat)artrur no0tetoiieild m2elnvp u0arxrmo oatlp e uvs (0texr(opnydlpt mivi t)s2rr(r nu4opeomfctadfm2ran pn(4aexrxo3totlmt ai i s srto(m3iodal e fvtls srtaxrp;t1opxoiieilsfa emnmo (4trtrxr3iatfpDelneo ()t2xoxo3io1ll   fcilsf Dtax ono4alt mictls a2ea(msnt0trtriocoa1fmD ai sl() rxriopoudoptnmictas) Dtrx pou4tlen feiys s ea(vs;()tleoio3ty1fptr ies;t) rto(rpny4om nlies t srrrur no1optoiietaslsDrauvon(4tlxoxrcoadoa raneo s) 2xoxm oodapt mnvia(f rtmx o;o4opxnifctyt sDemu o u0 rerir3oytop   i ils  rtrimpnudlpe  nesas)arua(ronu1openmi3tldfa ulu onu)tetoxo3oadlmtr u o;(0trxo(m3oo4ale lfvtasfsDrrx onu4oex mictytfs rln p (0texrioctatfm eau o;( srurirpou4ap   fvs (f 2uaurp;u1apeoio3iysfmDuau o;u) lerxo3oydlpDraues s s2tm(m iudap n nvils)aDrm( p;o0tlenmfeiadfa2ea(ms u0 ltoxo ta1fmDrlivi (0t2um(m oy1ol  micilt artau o;u4teeoifeiyd m emuvon()tetrio3ia1lm e u o t seuoxr3iy1omenlnesl()a2umum ;o0tpxnmiciltla uaumo u4altnxf3oytfpDeli s t) exrimpnodopenmieiat s2tmx  oo4tetomoctatfaDelnvp;(0trtnxfciy1lat livo ()srtmxopny1al emnvsls)a2uru pot0tlt ioeiltla ea(von() rtnif oy1lm  livo;s0s2xrxrpnodame mfvsltfsrumum oo0oee if3iltlm ranms;t0 rxnmr oa1fat  i olt  rtmimpiu4lleemfesl(faDum(  no1oetomoctlsls2ulnvp;()aexnmfcoo1om eliesl(0 eumxrpou4omtelivsa(  2rrx  ;t1olxomi3ilslmDelnvo u)texnxocta1fa elneil()setrxo3iy4ap nlfvsl()srrmu  ;t1altomfctlsfm el(vsnt0 exrir3iotlaDr neolt  2xmxmpiudal emfcias)a2rmuronu0olxomfciydlmDuauvs t0tetoxf io1lp e nvs;()t2xriopou4oltnmfcs s aDtmu o;t1teto fetadfs emnvp;()teeoif3io1fp elivo s)trxoxmpio1ol  lfct s)a2ua( onu0tptomf3ilsfaDumu on()trtnioctydopt lues;s)trum(mpny4apenmnes t)artax ono1tlt io3taslm ulu o;t) rermo3totlp r neils)s2trxmpoudll nmivtasf rrr( p;t4ole ifciatls em( s;u)treoxr tytfpteanvi;t)texoxo nu4optelnvi t)a2uax ono4aex iieils m2emn onu0alxrio3ty1om e u ilt0setoio nu1ameemietlt) Drrxrooo1apxnio3iyslaDrmn s u)trxoir3tydoaD lnei s) eurxrpiy1apeelfetas)a2rrx pnt1oleomfetlsla rln p;t0 rtoif tytomteluvolt0t2urxr3oo4ll elnvi tf Duau ont0texoifcilsfs2uaums;(0teeomo3oa1oat  uei s0srxmxmpno4ol emicil()s2rmu pou0tpx mo3iys mDrmumo u0 ltniocoadfat li s s) rxo(mpoodlp elieslsfarua(rpnu1tleomfcildfmDuaumo;t) renmo3iodfpDrluei t0s2umxo3oo1lpt  nes s)s2rr(mpnt4tpeo octytlm2rmuvon(4 leoif iodomt lueo (  rum(mpno1lpenmivils  2uax o;u1apen f3iyt m eauvonu0areoifcta1fm  luei s0texm(o3iy4lmeelnes t arra(  ou4olto fetld aDra(vp;(4tlxomr iotfm  liei;t0 rxmirpoy1altelfetls aDrrur no1tltnii3iys aDrmnmont) lerxrcta1fat li i s0 exmxmpnydlm n ivtlt)srurumo;t4aleniieilsls rm(vo u0 lenxr3ia1opteaivs s teuoxrpiy1om e feiltfsDumx o;u1ape  i3iytla2uanvp t4 renxfcoodomDeli il( srxm(m3ny4apt mfvsas)a2trx  ;t4aee ii3ildla ua( p u4arerif3oatomD livs t0setm(m oy4om  mies t)aDtrx  ;t4alenioctaslaDulu s t0aexoifcoytopDeaivs (0s2trirpny1lmen ivtlt s2rmu  ot1altoifeiyslmDrln o;t0artomf oadopDr i o;t t2xoxo oy1ol e ivt t  2ur(rono4aeen f3iad aDelums;u4tlenir oytoaDelueo;()sexoxo3io1omtnlfvtl(faDumxr nu4olx  ociyd m elnvo;u)tlxnxociotlmteluvils) 2umxo nu1altemivsa(farua( p;t4olx mf3iys a el(vo;(0 exomo oydfaDeauesls0 exmxo3oy4lptn ici sf Dtru  no4tee iicils aDem( s;t0altrmf3tadfmDean s ()trtm(m iu4amtelnvsl(f rur( pno0oex iictldfs rau o;() rtnmociadfmtr uvi t)seuoio no4am n nesl( sDra(mp;o4olenmfeilsfs rmnvsnt0aleoxo3iadopD  n o (0t2xoir3iu4ape  nvi s)a2ur(monu4tlxoiicildlm2elumsnt0texrifcoo1om e ivil( s2umir3oydoltnmicils srrax  nu4tee mi3tas sDemnvp;(0tltomf ootfate n o;t)trtrxopnydopt lnesasfs2urxront1opxo feiad sDuln s;(0 ltrmrcoodlm   u ol()srxrxo3no4lpen nvs (f Duaumont0aptn ictldfaDulnmpnu) eerir3totlmtr ueo t)sexmxm3oodoptnlivsa( artm(mpou1aleniietldfa uaumsnt0texrxf ootoa e ueol()srtmxr3iydapee nvt tfs2rmxm ;u0tpx ioctls aDrm(mp (4aetrxf3iotoatr u sls0s2triopoy4om nlfvta(f Dtruroot0aex if3iltla um( p (0arxoxfcta1lp ran s s trumir3nudom n fcs tfsrrrx ont0oet  f3iadfm2ua(vs;(0artoifcio1fmtr n s;(0srxr(opiy4al   ietl(  rur(rpnu0aetomi3iyt s umnvp t0altnxf3ta1fmtelieil() etoxr io4omenlfcta() rtau ont0tleoifetad aDrlnmp;u0trtomfcoatoa e i o t)trxoxo iu4om  mfei ()arumxmoou4tptnmoeiydfs2ran ont0areoiociytlatrlivo;s tetoxo iodope mivia()a2tm(mpno1teenmoetadlmDua(mp;(4texrmf3todlpDelieo;t)srxoirpnu4llt  fct s) 2tm(m ou4aetn ieiaslaDeln o (4tltnirctadfpt  nvi (0truo(mpnudll nlfcs t sDurumpou4aleoiociysla umuvpn()tlxoiociadomtranvil(0texmxo3no1ap  livs (fsrumxrpno0tpt  iciltla ul(vs u0aleoxf3to1fate uvs;( tetoio ou4llee neias  2umuront1tpxo f3tadfs2ulnmon(0 exrxr iadomD ln i;s) eumio3no1lpee nvtls)aDrm(mp;t0alx  ocildfmDua( p;(0trenxrciydlmDr iei (0 exmxmpnydllt  fcsatfsrtrum no1alt miciat s rmn pnu)arxomr3tytlmt lueils0sexr(r oudllenmnvtls  Dur(m nu1apxnmf3ildla ulnvs;t0altoif3iodoat lnvsl( srtoiopio1ol e nviasf 2rm( pnu0tptoiocildfsDra( s t4 rtomr oytopDe u slt teto(rpny1ol elivia() Durumpnu1tlxoioctlsfs2rl(vsn()trtnircoydomD ai i;s  rxoxr oo4al nmiesas)artmxront1apxnmfctadlm2ulnvs;t4aetrir oydfaD lu ols truo(m oo1lpt  ncia(f 2rr(ro;u4aetomf3iysfs ul(vs t0arxrmfciatfaDrai s;s)t2xmxopny4op emncsa(fsrur(mo;o1aleomietlsfa rmnmont)alxnxr iadfpD lueo;t sexoxo3oy4ap emivsasfsrrrxm nu4ope ifciltlaDrm( s (4 rxomo3iadoateaivi ()seurxr iy1lpt micias srum(mo;t4aexo ieildfm uluvp t0 ltrxocio1opte ies (  2um(o iudlle  fes tfs2tmurooo0altn feiysfsDemuvpn() exnmf3iytopDrau slt) rxr(o ou1am nlfvias sDtaumo;o4tlx  o3ias s emnmo () rxoif iadla eauvsl()srxmir3iudlmt  fcs sf 2urur ;o0alenmf3iaslmDrlu pn() ltrmr iytopteau i ()s2umxm3iu1lpen fcsas srtrxr ;u4opxn o3iysls2rm(mp t0trerio oadoptelu i ()srtr(o oy1ome lfeslt) 2trur ;o1alxoioeiys aDumnvsnu4 etomocia1fate uvs t0 rxrxm iodol  mnci t  2rau pnt1aexnifciyt aDem(ms t4 rxrir to1fm  ai i;t)s2xo(r3no4lpeelnci t)arrmu  ;u0oeeo feils s emn o;()tleomfcia1oatr u i t)t2xr(m oodlmenliciat  2um(m nt4tlxo i3tlslaDeln pn(4aleoxrcoatlm eln i;t t2tr(m oudomee fvsls)a2raur ;t4tlt mi3iadlm2uau o t0tlxomo3iytfpt  iei s0t2toxm io1alt  neta(fa2rrxmooo1ope mfeiasls2ulnmo u0tlenmr todfpDrlnvi;t0s2trxm3iodolen iesa(fa2rrx pnu1aex  o3tad aDuluvs;u0altnio iy1lmte neil( t2umiopnodom nlfvia( aDtrum ot1oex  feiltfmDrlums t4teenxf3oodfpDrli o;t trxrxo3oydop  mnetls  2rax pnu0tlto i3iydfm2rl(mpnt) lenif3tytlp raieil(0 2xo(opnu4ol e ivtlsfa2tr(mp;o4apxo oetas m2ulu sn()aetoircoa1laDean s;s) rum(r ou1lmtnlnvsltf Durxmp;t0aetn o3ildls ran snt0 rxomrcio1fpD  u il(0trxmim3iy1lm elncsas)sDuaumo;t0opxn fetadfa ulumpnu) eenio oa1lmtrluvslt s2umir io4ap nmneiat  2rrxront0alxn fciadlm rmumo ()alxnir tadfm elneo;(  rtrxo oo1olenlncs t)aDtm(mont0optomfctasfs2ran o (0 rtoxo3tydfmDraivs;t0texrxr nudopt mivt s aDrrxmp;u0tlt  f3tlt m ul(vonu) rxrmr oadlatran i;()s2xmxmpio4lleeliesls arurxmono1optnif3iaslm2ran s ()aexrmrctydomDr i i;t0t2xm(opiy1lpe mfetls) 2rau ono4tpeo fctysla el(mp () etnmr3tytfptean sl()tetoir3oodamt lfvi ( aDum(rpnt4oltn o3iadfmDeauvont)tetnxr oatoateaivs (0s2tmxm3ny4llt  fcsa(fs2rrxmont1tpt ioeiadlm el(vs (4aeenmr3oy1oaD  ieo;()srxrir3oydlm emnct t)sDrrx o;o1oleomieiad a ranvp;u)arxrif iy1fatrluei s t2uoir iu1ameemivils)aDtrumo;o4tlenifeiytls2umu s t4areomrcoytfm ean o;( truriopio4alt  nesas  2tm( o;o4olenioeild a rmn onu4aexrir totfatrln i t) eurxrpiy4ameelneia()s2tmu ooo1tltnioeild s ul(mp (4trxrmo oatomt aies t t2um(o3oo4op n nviatfsrtm(mo;o0apt  ieiysfa2rm( pnt0alxrif3to1lat au s;s srxmio iu4lm elncsl( arurxro;o1oltomoetldlmDel(mp;u4 rtnxrcta1lptrli i t0srxmimpio1lltelnvtlt)a2urxr ;t1tpxnioctytlmDrl(mo;() eeoxfctytfa  anvo t tetr(rpoy4ol n fvsat) Drru pnu0tpe ii3iadlmDrl( snt0 lxnxfcoydlaD ln s t0 2urxo no1ale  ncsat)arua(ro;o0tptoiieiysfs2ul( snu4 etrxo3oydlp eaivi;s) rum(o iydamtn fctl()arrmu oou1tltnmieiydfa emuvo;(4tlenir oa1fpDraivsl()t2umirpiu4opeelfvi ( aDua(mo;o4olx  o3iyt aDua( o;t4tltoxo ia1lm elneo;s0srumxopou1op   fvilt arrrurp;o1aetnmictys aDeauvonu4 lxoio3iadlat aivsls srxr(r iu4lpeemneiat a2rru pou0oeen fetltfaDrm(mp u)tlenxf3oydfp e ueo;s0trumxo no4lpe lfcs ( srtmu pot1tlxomoetls sDea(msnt0tlxrxo ta1laDrli i;s s2umxm3io4ap n ncsltfs2tmx pnt4tpe  feilsfa um(mo;(0 rxnmf3tatopteai ilt) rxrio3iydol  liciltf 2ua( oou4alt ifetlt aDea( s;(0arenir3io1lpte ues s0 etm(mpoo4altelnesls)s2ur(mp;o4olxn iciyslaDemump (4tlerio3oo1fmte uvi;( t2uoim iu4lleemneta( srra(m ;t1optn fetyd m2raumo ()tetnmo ia1fa eai sls0sexrxm3iy4op nmietlsf rrau p;t1teenii3iyslm el(vo u) leomrcoadlmtrli s t)sexo(r nu4oleemfvsas  rrrx o;t1olt iictasfmDuaump;t0 exrmo3tatlp  au olt0trum(r3io4llt lfvi tf Drmump;u4olxo ietyslmDuaump;t)aetoifcoydlate nvi;()t2xr(o3ou4lptn nvia(f 2umx pot0teeoii3tydlsDumn o ()tetrxf iodopD aueol()s2toxopoy4al   fvia( a2tr( pou1aexnioeiaslsDra(vo;(0texnir ta1lmDe iesls)srumxm oy4alt  ics (  Draxmp;o4tlt mfetatlsDuan pnu4altoxo oytoateanvol(0srtoio iu1lm n ivilt) rrmuront1alenmi3tytlm el(mpnu4texnmfcoadoa  lieo (0tetoir3iy1amee fetl(fsrua(moou4aleoiociadfsDum( ont4 ltnmf oodoaD  ues ( texo(opou4aleemivt (  ruax oot0oet  ocias a emums;u4 etomfctodfpD anvi s sexrio3nu4opt  fvt (f Drmx p;u1aleniiciyt a2ea( p (0artrifcty1la rlivslt0s2tmxm3nodlp nlnvtat  Durxm nt1opxo feildfa2eauvo;u) rermf iydfaDraivs;( s2trimpoo1ol  lfeilt)srra(rp;o1tee  fctasfa2ea( onu4teerxocoydopD  u olt)srxoxr3ou1amtelncsa()s2raxront0aexn fciat mDelnvs (4arenircta1lptrauvil(0 2umim3io4ameelivtlt) ruaum nu0olxn ictadfa umn o;t)tetomo3ta1faDeluei t)texo(o oydoptemieiat  Dra(rpnt4tetn o3tatfaDumuvp;t)tlermo3tydlaDelnei;t  exr(m3no4olt  nct t srtaump;t1tex  ociadfm2rl(vp;t0 rxoxociatoa r n o s)t2tm(m nu1ale livi s a2ua(rooo4oeto icils mDulumont0 lenmo iodfaD  ues t0setrir3io4lp nmieil( srumx pou1oltoio3tlsfa ul(mp t0 etomr oadfa eluvo;t setmim3iy1olenmfeilsf 2ur( oot4ope mfciyt m2emnmsnu0 ltnio ootlm ean i;s  etoim3iodapee neia(fsrtm(mpnt4tetoifctydfa2umuvo;u)texoifciytfa  aivo;s)s2uoio ou4lpeemfvtl() Dtaumont0aptnioeiadfm2rmu s;t0 exnmf3oatfmtr ieol(0seumimpnu1lltnlncs sfsDtru ooo1apenif3iydfa2ua( s;t4 rxrmf3oydlmDe ivi t) rxrimpiu4al  mivsl()aDuaumooo0altnif3iytlsDrlnvs;t4aexrmr3io1oa  lu ils0seur(m3io1al  mfvsl()a2rrumo;t1tle mieilt s2rlump;u)trenmf oy1fm e ivs t) 2uo(m oo1lp nlfvi ( aDuru  no0aexoiociltlmDrlnmp t)tltoifcto1oaD aneo;t)srxriopnu4olt mnvtat aDrruro;u0tetn ieiydfm rmuvpnt0 ltoxo3iytfa ean o t0 exmir3oy1am elfvsas arrmx onu1altnmfetad s2rm(vp;t4 etoif3oydom  lnvo s s2xm(rpoy1ol elnes ()s2ur(mo;t4ape moeiysfaDuauvo;u4trtomr3ia1oaDr ivo ()trtr(m no1oltnmivs s a2ur(  ot1texo iciat a2uaumpnu)alxnmf3tydfpDelnes t) rtrxrpiydal nlnvta()srra(m ;t0optoioeiltfa2rluvs t4 renmo ia1la elu i ( t2urxr io1alenmivi t a2umx onu0oex mfciatfm2rmnmon()aeeoxf tatfmteau o;t setoio iodal   feiltfsrrm(r no0opxnifeilt s rl( p;(4aexnmr3oytla eluvsls t2to(m no4lptelfei t) rrm( oot4tlen o3tadlaDem(mp t) leoxo3ia1lpDeluei s)teuo(o3oudlm nlfei tfsDum(mpou1teeomf3tltla ean p (0tlxoxr3iodoatrai i ( sexrirpoo1apenmfvsas) Drmu o;u4alxn ictlsfa rl(vp ()texomf3ootlmtelies;()texrio3nudop emfeilt sDrmum ;t4tleo o3ildls2rlnvp;()trenif oodoat auei;s) 2xrimpoy4oleemneta() ruauro;o1opxnmf3iatfm2uanvs;u0teerxociodlaDean i;(0teumxopoydlme  nei t)srraxr nu1texomietlsfa ulnvon(0trtrxf io1faDrlneolt  2urim iy4ale  ieias)artrxrpot4ole if3iysfmDuan p;u) rermf3iytfm  li ilt)srxmxr oodom elicias)s2trx pou1ale mfciys aDul(vo;() rxoir iydoat aivi;s0teto(mpny1lle  nci () Dua(rpot1oeto fctasfm2rlu p (4treoio ia1la eli o t  rxr(rpiu4omtn icias)a2uaump;o1apt  o3tls a emnvon(4teenir iadlatr ivs t0s2uriopiy1amt  nvs t)arrr( o;u4tltoifeias a emnmonu0 rxrxo tydoatr nei t)texr(r3io4llte fct (fsDrm(rp;u1openioetas aDemnmpnt0altrir iydfpt  n o ()setmxopnodop nlieils a2tau p;u4oee  i3iyt s2ea(mp;(0aetomr3oydfmtr ivols)teurio iu4lp e ivi s) Drrxr ot0aptnifciaslmDrau o;t0 rxomf3to1la eaiei;s0s2umirpoudal nmici t) rrrx pou4tlx io3tadfm2el(mp;t0 etoxf ty1fm   nvo;t) 2tr(opiodop elivs (faDurxmpoo1ope miciadls ea(vp;t0 lxrmrcia1oateln il()srtr(o iu4omeelivilsf 2trx  ;u4alen ieiydfmDul(mon()trtoir3oydom r nvs s0 exmxmpnu1omtn nesas sDrrxr nt4aexnioctlsfa2ranvp u0 exnio tytlptr uvs;(  2umir nydlpenmnvsltfarum( p;o0altn oeiasfs2ra(vonu4 lenmoctodlat aneol(  eumiopiodalte ieil(fsrtmxro;o1ale mietadfm2umnms;t)trtnmf3todlmte nvils0t2xo(o3oudal nmfciltfsrtmu ono0teeniietysfaDemn s () etnxo iadfp eluvo;s0setrirpoo4am n fvslt)artmurpnt4oetn fciltfmDua( o;(4 ltrxo3io1oa  luvi s  rtr(m3nodal  lfvi s) rtm(r no4ope iietas m ea(mp;t)alermrcoatlmDrlu i ( srtm(o oo1am nliciat  Dtrxrpoo1aexnmfetadlaDulums;(4 lenxf tydfmtrli s;t0tetoxo3iu4openmfvi (fa2tauroou4apeomiciaslmDul(vp;(0texomfcio1fpt lnvi;s)t2tmimpou4open nvt ()arra( o;t0aexnii3ils aDrlnmp (4aetrmr tadop e u i t)s2to(opou1ale  iet s)a2ur(r ;o1oetomi3iatla el(vp t) lenmf3iadlmt  n i s) rxo(rpoy4op nlfcslsfaDumxr no0oleoiociydfm emnvs;(0tlxnif ootfatranei t)srxo(mpny1optelict tfs2tm(ronu1oleoif3tydfs rlums;(4tltoxf oydop e uei (0s2urio3iydop nlfvt ( sDur( pou4apx mo3tlsfa2rlump (4artnxo tydfateau i s  2xoimpou1optn nvs t aruaxmoot1aee io3iadfm eln p;(4texoxr3ia1lp  luvi;s) rumir3oudap n ieiatfsDum(mp;o0tlx mi3tatlaDulumpn(0trerxr iotla rln o;t0t2urxmpio4omtn neta()arua(mpno1apt iieild sDrl(msnt)trtrio totfat  n i (0 exmim3iodope mieil()aruax pno1apeomf3ias aDulnvs;t)tleoio3ia1faDeaueo s t2xoio3ny1alen ieslt  Drmump;u4optn oetatfs2em( s;(0arxnxo ty1fpt auvs s0 euo(opoydllenlfcsltfs2urxr oo4aee miciltlm2uauvs (4aeenio totfmteaneslt0 2toio3iudomt  nvs s srta( onu1optoifeildls eanvon() lxomr3oo1fmDe neol( seurxo oy1ol nmictls  rur( pnt4ope mo3tad s2eanmsnu)arermfcta1faDeaiei s sruoirpnudlpe miciasfsDumxmono1oeenmiciadfs2rlu s (4tlenmf3tadoaDeli s;(0 exm(r oo1lmtnmncs (  rtrxmpoo0aee ii3tyslm rmumon(4tlerxr3oodlpte ueo;t0 etmxopoo4alen nct t)aDra(ront0tptn oeiysls2rlnvp t4 rtnmo3to1fmD lnvo (0trtmirpoydal emfeil( a2rax pnu4altnmf3iltfm2ua( o (4texrmr3iytlmDeauvolt)t2xoio3nodol elfci t)srtrur nu4olxnmi3iydlaDrl(vs;t4 renxrciatopt  u o (  rtrxr no1lp elnci (  2ra( p;t4tpxo f3ild sDrl(mont) leoxf iydlptr uvs;t texmxm iydoptelfcilsfartm(mo;t4oltn o3iysfs2um(vonu4arerir ia1latran ils  2ur(m3ny4lleemfesas arra( o;t4aexomoctls s2eauvpnu) lxrir iotfp  aies t)s2ur(mpiudll elfctasfs2rm( pou4tet ii3ils m ua(mp;t) ltnif3oadlateluvol(0 etoxm3io4llen fci t)sDra(m oo4teeo fciyt sDua(mont0alermrcootfa raueils setm(opio1ame  fcils)arumxm ;t4oltnmoeiytlsDea( s;(4artrircoodop r ueo t  etoxo iodlm nmncsltfsDtaump;t4opeo o3ilslm2em( snu)arxnxf3ty1fpt  nes s0 rtoimpiy4am   iei s)aDraxmoot4aetoiiciltlm eaumonu4teenmfctatlaDrlivo t)trurxmpiu1lmt mnvi s) rrmxrpno1apen i3iltlsDel( o;u4trtoxrcoy1la eli o;t0 2tmxr nu4lm emietl(  Dtaurooo0altn feiaslaDua( o u0trtrmf3totfa rlu i s setm(r3oy1lle mfcsls  Duaxmpoo0aptoif3tytlm2uln o u4teenmf oy1omDelivolt) etriopny1op  mici (  rrmump;o1tlx mfetytfa2elnvpnu0tltnxf tydlaDrauvs t0srxriopou4lmee ncsls) Dum(m nt0texnmo3ildfsDumnvo t0aexnmf3iotoptraivo (0srtrxopny4lp  lfetatf 2taxm no4alx miciyslm ulnvp;() renmfciydfate ues;s t2tmxrpoy1omt  fetl( artm( oou4tlenmoeilslm2eanmont0 eenif3iydfaD au slt t2xm(o3nydlme mneils  rrmurooo1tlxn oeiasfaDem(mp;()trtnxf3oa1op elieols) rxr(rpno4ll  lfet t) 2tmu  ;t0olxo ieiyt a rlnmsnu0 etoxr3tytfp eaneslt trxrio3io1alt mfcilt aDurxmont4tpxoifeiyt s2umu o u0trxrxf3tytfaDraivs t)tetmim3iydal n netltfsrua( o;u4opx  f3tytlaDrm( p;u0aetoxf3oytlatrln i s teuo(o3nu4amenlfvtls)a2ta(mo;u0tltniociat s2ulnvpn(0tetoxf ty1fpD aivol(0srtmio3oo1ll n nesa(  Dtruro;t1aeeomi3ilslm rlumo (0trtoxo tytlmtrlueo t0texoirpou4lm nmivs s a2tr(  ot0tpen fetasfa ua(ms t)trxnif tytla elu i s0 rxoio3oo4op  lncils) 2tmxrpno4tee mo3ildfa ra(msnu4 rxoxr iytoaD  nvi;t  2ur(o nu1ap nmivt (f Dtrxm ;o4olto i3iatfm rmnvs;u0 rtrmf to1fa  luvilt0texoim oo1ape  fet s) 2umx  nu0aex mocildlaDel( onu4arerxf3todlm  auvo;s0sexm(m ou4ame liviatfaDrmu ono1aeeomfeiltfs rlnmon()texnioctodlm raiesls  rxoio oudlm   ictl()srtm( oot0altoii3iaslaDel(vp;u) lxoio oatoaDe i i s tetrxmpiydaptemivt s a2tm(  nu4tetoii3iasfaDumnvs;(0arxrircoa1faDr nes;() rtoimpiu4op nmicta() Dta(monu4tee  fciydfs2rmn s ()trenir tytlm rln i;(0 2tr(o3ny4lmen fvsl()sDtaxrpou1tlxnmf3iltfs ra(ms (4 etoxo iytlmDrlivs (0trxmir3nydal e iet s)sDrrxrp;u1alt io3ils aDrl(mo;()artrir iy1om elnvi;( truoxopou1ap  mivsa( a2rrx  nu1ale moetat aDrau s u4arxomrciydfateli s (0tetmirpio1ap nlneiatf 2rmxront0opto f3tlsfsDra(von() leoifcoytla e ivi (0 2uriopiy1op e nvs ( s2rmum ou4ope mi3tadlaDua(vs;t)altnmf iytfmD li sl()teumir3nudamte ics ( sDtmu  ;t1apenifciaslm2uln o u4tltrifcoydopteli slt s2umxmpoudam nlictlsf Durxrpno4oex ioeiydlsDeanmonu4trxniocoodoatr nvi;s setoiopou4apeeliesl() rumu oot1ale mietad a2uan onu4aetnxo iy1fmD au il()texm(opoy4al elnei ()artmx  ;o0tlxo o3iytfa rm(ms;() eermf3ty1oat  n i;t  rur(rpno4lp emivs tfaDrau onu4opx mf3iltfsDua(vonu)tlxnmfcio1fmte ivi t) eur(r3oo1alee nci (f Drrxm ;u1apeo oeils sDemuvo;u)aexoio3ia1oate ueo;t trxoiopoudal   nctas)s2um(m nu0oeeomfciyslmDul( p;u4aetrxo3ta1fptrai s;t srxrirpio4lleelfvt s aDtmx p;u0texomieildlsDrluvo t4 eeriocoatop   uvo (  eumxm nudoltnmfvs tf Dtrur ot1ale io3iatls umuvp;u4artoxr3oytoptrlneil(0teto(mpoy1ap  lnct s) 2ra( ooo4ale  o3iadlm2rl(vs;t0aeeomr3iodfa  aueols srtrirpiy1al nlieiltf 2uaumono0oet iocildlaDemu sn() exoio tydlpDeai o;t)s2tmxm3nu4lptnmnesl(  2raxrooo4ope ifeildfs ea( p (0tleoifcoodfmt aivol(0srtoimpio1optn ivtls)a2rrumpnt4olxoif3ils a rluvp;() lerifcio1fp  lneils) 2trimpno1opte ies s)aDta( oou1opt iociaslsDua( onu0 rerxr3iatfmtranvo;() ruoxm ou4op  lnvs t) rtaxr nu0ape if3iyd aDranmonu0tetoxf iotoptr i sl(0 eumxrpnu1op  lnet tfa2trur nt0opt mo3iltlsDra( pnt)tleniocoadlp rai ils)seto(mpno4ole lfvs t)srtr( p;u1opx mociadfa2rlump t) rtnmo3iotomDeauvs (0 2uoirpou1olenlnvil( a2ra(mo;o0oexoiietas m2em(vsnt) exrmo iytomD  nvs;s s2xrxm ou1am elncsasf rtmump;o0opx iicildfs rlnvp u) etrircoa1lmte uvs (0 rtmxrpoudole  nei tfsDtmx pnt1tleoif3tysfsDemnvo u) lenxr3oa1op eaneo;t)s2xmxmpoodopeelnct t sDra(mpno0opxn i3tadfm emums t4teeoxrcoytfpt lneol() exoim io1op  lfcsl(  rurur nt0tpe  oeild a ua( s;u4aetoiociodopt an i;t0setrio3iydomt  ici t s2raxmooo0ale mfcild a ranms t4 rxnir iotlmtraivs;s  2ur(mpoo4oltemnvslsf ruaxr ;t0tpe mictltlaDua(mpnt)tlxrir3tydlaD  ivsl(0s2trxmpiudlpeelnvsltf rtaur nu1teto f3ilsfaDrl(ms;t0 ltrmf3ta1lp   u sl(  2xm(opiu4altnlneiltfaruaxro;u1aleomiciasfa2ran s (4trenio3to1fp raies (0t2trir3no4oltnmiciatfs2ur(rono1tpto ietlsfm2umums;(0aleomfctotoptr nvsls srxm(mpiodolt lfctas) 2rrxmpnt1aeen fciadfsDuanvs t0 etoioctatfm e iesl(0s2xoxo io1ll nlncias)aDrmuront4alxn ictytfs ua(vont4teenifciatfmtr uvi;s)teto(opny4oleelfesa(  rurxmpnu0apxomi3taslaDul(vs;t) ltoiocoo1omtraneols) rxmimpoodomeelfct (fsDtr(rpnt4opx mfeiltfs umuvo () lxoxr3tytlmtr ies ()seto(opiodlpte nct sfsDuau ont4ale  fciydla2eln s u4artrmr3ia1oa r uvo;() rumxopiu1ol nlfvtlt s2uaxr oo4tlenmoeiydlm umnvs;t0aexrmr3iodom e i ilt)s2to(r iudolt lfvtat s2ua(rp;o1olxnifctltfa raump;t)trxnxrctodoaDrlu i;(  rtmxrpny4ap   nvsa(  2ra(mp;u0aexo oetld a rmnvo t)altrmr3oy1fmt livil(0sruoxo3iu1lpenlnvtlt arta(rpoo0texomfeiasfs rlnmonu0trxoir oa1lateaueo;s0t2uoir ny4olt  ncil(fs2rrurono0open ietaslaDeauvs;t)aexnif iodomDelieils  exoxmpoydlmenlfcsasf 2rru ono4tlt mieiadfa el(mp;t) lxnmo3iy1faDrauvi t trumxm io1amt mfeia()aDurx pot4oleoifetldls rmu pn(4tleoif iadomt  nvi;(0teurirpou4ameelnvt s)sDur(  ou1aeto fciatfm2el(ms t0 rerxf3todomt lieols trurir3oy4opeelfvt (fs2trum no4opx  fcilslm2rmnmonu4 ltoxoctatoa   ues;t0setrxr io4amt  fci tf 2tauroou1aex mf3tasla2ul(vo t0 renio3ootopDe uvols s2trimpiu1opee nci ( a2rm(rpnt4aet mociyd m rlnvo () ltnxf3oadlmD an s s)s2urimpiu1ap   fei () rua(  no4optomf3tatlmDrlnmon(0alermr3io1fa elu s;s)teumxo iudamee neiltfartmx pou0tpeomo3iyslsDraumo;()treoxrctytla  li s t texoirpoydamee fvi t sDtmxrooo1alxnmo3tyd aDemumpnt0 ltrmo3io1lmtrlnvol( teumim3iydop elnvslt)srtrxm ;o0olenmieiad m2rl(vo u4 rtoxo iytom eaueils  eur(m ou4ll n feils arum(moot4aeto oetadfaDuauvs u4 reomf oa1fp   nvs;(0 etoio iudam  lnvi t)a2rau ont0tee ifctat aDrmuvo u4arenio3todfp  ai o;t) 2urxopnu1ame mnct t  Drr(monu0tlt mociyt a rmnmsnu)tlxnxf3oodlp eaivs;(0trtrxrpoo1ope mncsls artaxr ;u0aptnmociyd aDra(vp;t4aeeoxr ta1fp ranvi;()srurirpny1openmies s) Drrxr ;t4oexn fctldfsDeaumo u4trxrio oodomteaiei;( t2xrxo3iu1omeelietls)arrmxrpoo4oexnmfetyd mDemu onu)alxoxo3oodlaDe u slt trur(o3no4alt  icilt a2tau  ot0apt mi3tldfaDrl(mpn()aeerxr tydoa eanvi;t)seuoim no1altelnvta() Dtmx  ;o1oltomf3iytfsDelnmo t)treoxo tydlpt aieols s2urxm3ny4lpt lics t)srraxrp;o4oexn i3ilsfmDumums ()trtnxf3to1lm rli s t)srtmxopiy1omen ncsasf Dtaump;o4olx mfciysfm2ua( pn(4 rtnif3tadoaDe nes;t0 2xmxr oo1omen fvi ( a2ur(ront0aetnmo3iadfs2ul( snu4trxnif oodlm rlivi t0srumxr3nudapt lfcsatfsDua(roou0oleo f3tydfm em(vp t4teenir3iodlaDe ivo t)trurxm nydopeemnvsasfsrtm(m ot0tlx mfeiasfa2ra( s;t)artoxocoadoa ran sls s2tr(m3nydomt  ivt s  Dtmx o;t0oexn ociad m2rau pn(0aetoxo3iytfptrlneslt)srum(rpiu4lpeemnesls  2tmxrpou0tlen ocildls2el( sn()altnmo oatfaDeaieo;( trxoxopno1aptnmfctl(fs2umxmpnt0apxoif3ilsfs2ra(ms u)artrxf3to1fp  an o;t)t2xm(m3iy1olte ietlsfa2tmxr ;t0opxomi3ilsfa rl( p (4 reoioctadlmDraivslt0 exr(mpnydalt lnetlt) rtaump;u1aetnmfetad a2uluvs u0trxoxo tydfaD li i t0trtoxo3ou1om nmfvi sfa2taump;u4texoiieild s um(mo;(0 rtomo iotoate neo ()t2urxo3nu4lp emfctls) Draurpoo4tlt  o3ils aDel(vp t4texoxr3oatlat  nes;s seurxmpiu4om n nvsa()srrm(mo;u0oleo iciys a ranmont0 renmfciytoa   i i;t  etm(opno1ameelfci () Drmumo;t4olt  fciys s eanmp;()altoirciytop rlnvil( tetmio iodapeelictls)srtrur nt4olxnioeiadfs umumpnu0 lerirctytlmDrlues;s srtm(r no4am  mfcsl( a2ta(ro;o0tetnifciad mDeln s ()trtnmr3iadlaDrlneolt trto(m3ou1apenlfei sfarrr( pno4oleo ociadls2ua( snu)trtomocoydlm eaueil( srxrxo3io4omee fvsa(  rtmu pnt4apt mf3tas a ra(ms (0 rerif3tytop   iei s trto(m3iy1llte fes (  ruaumpno1tle iociatfm2rlumo;t4 etnifciatfate i o;t)sexoirpnydamtemivs t s2uau poo4aee iieiatlsDel( pnt)tltrio3iatlm  lnes;()trxmxr no4lptelics s)srrmx pot4oexniietas s2emump;(0teeoxr tytoaDeaiei;t  eurir3iudole lici ( s2uax oot0aexn oeiys m2ulump u4 exnxo todfmtr i ol(0sexrio oo1op  mnvt tfsrur(rooo4opxnmo3iyd mDelu p (4 exrxr3oy1oatrauvo;() rtr(o iu4lltelnvslt) rtaxr ;t1oee  f3ias s rmn p;u)arxoxr3to1fm rln ilt) exoim oo1ap nlfetl(fsDrmumpnu0teenio3tatlm ua(vonu4tltoxr3tatfaDelnvs (0t2tmxopiudlptnmfctas s2uaxmo;u0tlx  ociydla2rm(ms t4 ltrmrcio1laDr i slt)trxmxo ny1aptn fcils) rtrx ono4tpxomfetadls2el( s;t4texnxr oy1fateai il()teur(opio4om nmfvtasf rrrump;u4aexo o3iatfaDemn s (0aeeoifctytomtranvs;t0 rtoio iy1ape mnciat)s2uax poo4opto fciydfm ranvp;(0teenxoctodfm  aivi;()teto(rpno4ap   fctatfaDta(  ot4tee iietyd s2rm(vpnu)tlxnmf todop e i s;s trurir nu1lltemieia() rrax  nt0tpeomoeiadls2rlnmpnu0artrxrcta1lmDrln i;() ruoxo iydaltnlncil( arrrxm ;t4tex mi3iydfaDea( o;t0tlermrcoodlmD  ivol(0s2to(o oo4lm  livs t  rraxrpoo4tee  oeiaslm ul(mo (0 lxomrcoa1fpDe nvslt0s2um(o3iu4ap elnvsl(f ruru  ot1olx ii3ias mDelnvsn(4tetomocootomteaues t  2urimpiu1olteliei s) 2taum no0apeoii3iys a rmnmon()alenxo3tadoatelueo s trum(o oy1lle lnvt s) 2rmxrpot1tpt  ieils a ul( o;t)trxrif oadlpDe nvsls)tetmimpnydllt lieslsfs2urump;u1apenif3ils aDemums u0trtnif3oadfptranvi (0t2xoxr iydamenmnci s srurxmpou0opeo octydfs2ea(ms;u4 lxrif iotlpD lieo;t0 exoio no1llt mfvt (  Drr(moot1tpxo oetys a2rmn pn(4alenmrcoy1lmt aiei;s texrio oo1oleemnetat)a2truro;u1oetn iciltfs ranvo;t0 lenmo iatfpDrluvs t0t2tmxopnydlm emfct sf 2urum ;o1tleomo3ils m2eau ont4aeerxrcoatoa raivo;(0teto(m3no4lm nmfctls sDtax pnt4oetnmoeiasla rluvo;u) rtriociy1lp eaueil( setr(o3ny4am nmnei t) rrmxr ou4tpt mictaslmDum( pnt4aexoxr3iotfpDrluvs () 2trirpiy1omt  fvt ()sDuaum ;o4oee mo3iad m ul( s;(0alenxrcoytla e ivi;t) rum(o3iy4lm n fvslsf 2rm(roou4ale iictyd sDua(vs;u4aexnxf oydfpt livo;() 2toxm io1llte nvtas  rumxrpou0opxoio3iatlsDulumont) leriociotfm e nei t)texo(opnu4op n ietltfsrra(rpot1oexoif3ilslaDemnmpn(0 reoifcto1opDrlieo s trxr(mpny4amt mfctl()aDta(rp;t4tex  ieilt s ulumonu0 ltnmr oodfmtrlueo;t)teuoxr oudoltemivta( arraumpot4oltn i3ildfa rm(mon(0 rtrxf3oa1lp  ai ils0 2xr(m nu1lpeelivs s)srraurpno1opt miciasfm2um(vsnt4aexrifctodopD au i ( srxmxo nodlm elietls)s2rru o;u4aetoiicilsfm2uluvo;(4texnxr oa1om r nvo;s  rurxm iu1optemnei s a2ur(ronu4oex mfcilslaDrmn onu) lxnirciatopD  n s (0t2xrxm oo4lpt mics t)srtaxrpot0olen o3tld s2em(ms;t)trxoxr3iy1opDe nvs t0 rxoimpoydam emnvt t)sDur(r oo0oetomo3iytfmDulums;t4arenircoy1oaDr n s s)trxmxm nu4amt mfvsl()artrx o;o4aeeomi3ildls ra(vonu4aetnif3ootoa r ies;s)tetmim nodopee nvt s  Drm( pnu0optn ieiyd m2rm(vp t4trerxr3ootlm elivi s trtoio3no1lpeemicslt)aDrm( pno1alx ifcils s rmnmpnt) rxrxrcoatomtr ueo s trxrio3nodop elivs (fs2um(rpnu0olen ociydfa2ea(ms;(4trxriocto1oateaieils)srtoio3io1op  lfct t srtru  ;o1aeen o3iyt m2rau o;u)areoir3ootlmte uesls  exrxrpiydoptnlnvi sfarrruro;t0aexomoeiat m2ul(monu4 ltoio oa1lpt lnvol(0 2tr(r3nu1ale  nct t  Dta( o;t4tle iociat m2ul(mo;u)tltomr3oa1fpDeli i;s)trxmxmpiy1lmtemietl(fsrta(ro;u1texnii3iadfs umn o t0 lxnxr3iodfptelnvo t seuoxm oy4lpte ivtlt)sDtmu  ou0oee iicild aDrlnvs;t0tltomoctydoaD lnes ()t2ur(m3io4aptnlics t artmxmono1texn o3tysfsDeluvp;(4 etrmo io1omtelu sl(  rurio nydlpe  fct ( arua(  ;t0aee mo3iltls em(vpnt)aetoifcoy1fm elnes;t0 2xmim3ny4ameemfctltf rrau  ;t1alt  fcias s umumsn()tlenxf iadlatraivs s  rtr(mpoodomeelnvs t s2ua(r ot1apenmo3tltfm2rmn snu0artrir3ty1om r i sl()t2to(m3ny1ap  mncsat)sDrrumpno0tpxoifctad sDum(mo u0trxoxo todoa rlivo;t)t2urirpoydam nlies ( srtr( poo0oet  o3ilsfm2elnmo t)aexnmfciatlmt li ilt)truo(opnodamtn fesat sruru  nt4aeenmieiydla2eanvs;t)arxrif3oa1lpDr neolt)sexrim no4amen ieiasfsDumxrp;t0apenii3tat m rlu o t) rxnxrcio1fmD  neils)trtmxopou1lmte fesa( srrmxrpnu0aex  oeiyd sDrmn s t0tlerxrcoadfpteliei (  2xm(mpnudolt lfvtltfsDrruro;u0apenmfetat mDeaumon(0 ltnxo3oydop eauvil( trxmio io1lp nlncsl(fsrrrx poo4olxomfeiat s uln o;(0 etrxr3ootfa eau o;(  eum(r3nu4al emfes sf Drmu o;u1tet  i3ildlm2uaumo;t0 lxnir tydoaD  nvo;t0teuo(r3ny4amen ics ()a2uaum ;t0olt moeiasfaDuanmp t)trxoir3iotfaDrli i;() etmir3oo4ape mici s  2trumont0opeomf3iyt a em(mon(4aexnxr3tatoaDrlues;t)trtmxo iu1lpt mnvias aDum(  oo1ape mieiadla emnmp (0arxomfcoodop e uvo (0 exmxr iydlmenmict s a2ra(rpot0teto feiysla eluvo;(4 lxrmr oo1omD aivo;s0 2xr(mpny4lp emfcsa() 2uax ooo4opxo o3ilsla eanvonu0 exrmf iotfpDrln o s0 exrxo io1ame  fvtasfarrauroou0tlxniiciyslm rl(vp t4tetrmrcio1lmt an ols s2trxm no1aptelnet ()artmumpoo1aetnioetatlmDulumo;u) eenxf todlmD aueo ()truoim3ny1ome lfct s) 2rru  nu4oeeomo3tlt s rl(vpn(0aetoxfctydomt  u i;t seumxm nudlpeemicils) Drmu onu0tlt  i3ild m uluvs;u)arenmociadlaDranes t)teuoxopoy4llt  fct t)aDumur ou4oeenmo3iyd aDulumon(4alerirciotfpDranes t0seumxo3nodop elivsas sDrm(monu1tptnmoctasfm2rl( sn() etnmr iy1fmDeaivils0srtm(opiy4lpeemietasf 2tr( o;t4aptnmieiytls ea(vpnt)arxnxfcoydlmDrlies () rtr(m oodlpt  ietl()srtauro;t0opxomfcilslm2ua(von(0 lenmo tytfm ranes t s2urxr ou4oleeliviat)s2rr(mont1aexnioeias s2em(vpn(4aexrio oodla ran sl(0srxm(rpno1ol  mivt t)s2tr( pot0tlx mfeiasfm2emn s u)tlxrxo ty1lpt au i;(0s2tr(opoodalee nvilt)s2rm(mo;t1tptnii3iadfaDem(mp t)teenio totlptran sls0s2urxm iydalenmneilt  rumx p;u4apx ii3iasla emnvo;(4tetnxoctatlat li s;t0s2trxopnu4ap  lici ( s2taum ;u4tpt io3iyslaDrl(mpn()teeomrcta1oa   nvi;(0 rum(o3no4lpe  ivslsf Duau pnt1oleoio3ild s2ulnmpn(0 rerir3iydomDeln o () ruoxo oy1amtemncta() Dtrurono1aeeo oeiytfm raump t0 lermr3oy1fm eauei (0 rumxo3iu1optn feils) 2rmx ont1oltomfeiytlsDeauvo;t0 rtnxociy1oa   ues t)teum(r nu4oleemnei (faDumurooo4opx  fetatlaDemnms;(0artrmocta1om   uvsls)srtrir3no1olee ivta(  2ur(rp;u0aexniictadlm emumsn(0aetoxfcoydoa ranvilt) etrim3ny4ap n fctas)sDumum ;t1tltn o3iytlm elnmo u4tltrif tadfa rauvo t t2urxo3io4am nlnvslt) Duaxmpou1tpx mf3ias a2ul(monu)tlxrxrcoodopD luvo;()trumxm3ny1al  lfetl(fs2tr(ro;o1olxomociasla2rmuvont4arxrxocto1op rlu o t) 2xo(o oudope lieilt)srtm(  ou0apxomietydfmDra(vsnt) lxrir3tatlpD ln sl(  2trxo3nudamt mfeiasfsrrmuroou0oeenmieiadlmDul(ms t0trtnmf3iotoa r uvsls  rxoim oy4lpe livils aDrau p;u0optomfciatfaDrln p;u0aexomfctatoate ues t0trxmim3iu1lleemivslt s2tr(mp;u4apt miciysla2rmu ont4tlenif3iy1oatr n i;s)sexrxr3oo4llt lict s  rtruro;o1tlto f3tatfm2eanvsn(0trtrxr iydfm   u o;()trxmxopnu4ll elnesas) Durum oo0alx ioeiadlmDraumont4aetrmo3iodfpD lnes;t srtmirpnodole  iesas  rumumo;u1apeniiciasls rmn snt4artoiocoy1omt  n o t) euoxr3oo4lpte fcsl()s2rrx onu0oee ifctydla2rln s;(4tetomf3io1oateaieolt setoxm3nu4lm  mivtls) Dtrurpnt0aleoifciltfsDrmu p t4teenxr3io1lpDe uei;s)tetoir oy1amtelnviat sDrru ont0alx ioctlsla rmuvo;t)tltnio3tytom e i i;t srumir nu1lm e ieslt aDua(mpot1apxn octatfm ean p;t0 leomf ootlpD liei t) exo(opnu4altnmnviasf 2tm(  oo0alxoif3iadfaDrm( p;() renxo3iy1omtraiei;t0t2xo(m3io1lpt lnciat a2rrum ;t0apxnmf3tldfs2ul( s t0 rxomo to1la rli s;t)srxrxo io1omeemictl()arrmurpou4oet moctys a ulu s (0 ltrirciatfm elnvslt) euoxrpio1lp   ivta() 2ua(r ou0oetomieiydfs ea(mo (0arenif3iotopD livo s  eur(o iodamen fesltfsDumu ono4oetn o3iadfsDuln pnu4tltrif3tydfaD  ivs;s t2uoio ou1al nmnetlt)aDtauront0tpx mfciyd s2ua( p;t)teeomo3iodfm elnes;t)trxmirpiudlle lies t) rraumoou1oeen f3ias a raump;(4artnmr3oodop elivsl() 2uoirpio4oltn nvsat a2rrxroot0olxniocild a2ea(vs () leriocto1lpt  neo;s)sruo(o oodamee nvt tfa2tm(r no0olx mo3iydlm2rlu pn() exomrciodom  luvols0srurxmpio4omt lnvslt)s2uaum nt0opeoif3tlsls2rlnvp t4 eenmr oodfp  luvo t)srtmxo3io4olt  ivia(fsDtmx  oo1aee ifetldls rln o;u) lenxo totfpt  ivs;s)t2xr(m3iy4ll  lfvt tfsDtm( o;u4apto iciad sDum( onu4 etrxo3oadoaDran il(  rtrir3oo4opte nvias aDumxmp;o1tptn feiysla ulnmp;u)trtrxf oo1opt  ieols0srum(o3nu4lm n iei (faDrrumo;o4tpx moetlt m rlump;u) exnxociodlp elu o;s texrxo io1ame  nvs () rumur nu1aex  o3ils s2emumo t)alxnxocoa1opDranei;()srtr(r nydll   neia( sDururoou1olx  ociadfsDranvp ()tlxoxr3oy1lm rlu sls)srtoim3iudoptnlfvsa(faDuaurooo1opt ifctls s2eanvs;t)artrifcia1om   ivo (0seuoio3nudame lneia(fa2ua(  nu1ape miciyt mDemuvpnu4 leoxr3iydlpDr nvi s)trumxr3iy4aptelfesltfsDrr(rono4tpe mf3iad a2eauvonu4 rerxf iytlm  anvols0seuoxrpnu1llee ictlt  2urx  ot4tlxnmociydfsDrm(vo t)alerxfcoytoa r u il(0 etrxopnu1alte nct sfarrr(r ou0aex mf3tls mDel(ms ()arxomo3ootfpDeanvi t trur(m3oy4al e ncsltfa2trx p;u4aee ifctasls2umnmp;t0 rxoif iydoaDe ivi;(0t2ur(o3oodale lncia(  rtr(  ;u0aleoioeiytfmDrluvsnu)alermo3ootomt  ivi t seuoiopiy4lptelnvi tf rtmxr nt1oexnii3iydla ea(mo u0tltrmocoydfm  li o s)s2xr(m3oy4am nlivi t)arumur nt1apx ioetyt m2ea(ms;u4 rxnif3tydom elnvi t) euoir3iy1ol nmnvtl(f rrrx  ;t4alt ii3iysfs2ulu p;t0trtrifcootlat livslt setoxm no1ol e fvta(  rtrxro;t1aetn o3iltfa2rm(ms;u4 lxrir3ia1lpD lneo;t)srur(o oodoleelnct () 2ururoot0tle  f3iytla umnvo;t0 leomr oo1oaDrluvo (0 rtoxo oudalen fvt ( s2rrxmoou1oeto iciatfm rmuvs;t0 rxnircio1oaD anvols) rurxo3iu1lpt lnctl(  Durxm oo4opt mocilslsDraums;t4tltnxocoatlpD  uesls)s2xr(o3iodlleemivsat arrr(m nu0tetnii3tatlsDeaumon() rxriocoy1la raueo;t trtoxo3ou4lpee ictls aDur(mp;u0opxn o3iltfsDrauvp u4alxnmo ty1lp  livi;s)srtrxm oo4op nmncil()sDur(ro;o0alt ifetadlsDumn o;(0 lxnxr oatopDrau s;(0trxoimpou4opeelnvsas) 2trxroot1tlt mociysfm2ua( o;()tlxoxrciydlpD lnvsl(0sexmir oo1olt lieias aDtrxronu0aee ii3ilt a rmu p;u0 rtnmo io1lat  nvol()sruo(m oodlpenlivsas)arrrumpnt4tlx  f3iasla rlnmo;(4 renxo iadopDeaivo s)t2toiopnu4ope liesa()s2taxmo;t4teto ietytfmDrl(mo;u0aeeoxoctadom raivils setmio oydap nmfviat)s2taum no0olen ictadlaDua(mo t0 eeoxo3tadfmte neo;t) rxoxo3no1lme miei t)arraxmooo1tpeomieiysfs emn p;u0teeomo3iotoate ies;s0texrxopoydlmeemiviatfartrx  ;t0tleomiciasfa2uluvs;u0alxrif3oo1fpDr u ils)s2urxm3oy1om   nci () Dra(ro;t1oee if3ils a rmums t4trtoioctadfa   ues;s)s2urxo3oodolt  fctasf 2trxro;u1tltn iciysfmDeanmo t) ltrxf3iydfm raues s trtm(opnu1lptelfesat)srtm(m ;o1teeniieiytfaDeauvo u4altomr3oo1oat luvsl( s2umiopoy1omt  feiasfs2umurono4apx mf3iat m2rm(ms;t)tlenifcoadopDelu i;t) rum(o nodol elfvtat)srrm(  nu1tpxnmfciaslmDeanmsnu4tlxomfcoa1om eln sls)s2xoio no1ale mnvi s)s2ur(mo;o4oexo fctldfmDrl( snt)aeeoxociotomtraieo t  rtoxr3nydlmen ivtlt  Dtmxm ;u4ale  oeiatls ra(mo;()aeeoxf3iy1fp r uvils0 2ur(o nodoltemnetas  rumxmpnt1ape  f3tyt s2rm( o (4 exnxr iodlmt lnvol(0trxmirpiodlpenlfesls aDrm(  no1oetnmietydlmDea( p (0 ltoif tydoaDelu i t srtoim3nudomt liet s a2ra( ooo0aee ii3ilsfm2ra(ms u4tlxniocoy1optrlieo;t  2uo(mpiodal nlfcsl(  Drm(mo;u4tpt mietysfa rl( ont4tlenir ta1om raues s texr(m iodal  lictatfs2trxmont0tlxomieiysfmDua(mp (4aexomo3oydlaDe nvi () 2trir3iy1lpee nviatfsDuaum ;o1opt  fciys mDrlnmon(4 rxrxr3oadfmDranvslt0s2to(rpnu4ome lfetls a2rm( p;u4teenmiciysla emnmp;u4alxnmo3iy1oa rlueo t0srum(r3iy1lm elfcta( aDtmur nu0ole  ocias s rl( s ()artoio3tytfpDeanvi t0trxr(r oo4ol nmivtat) Dta(  no0ope  icildlmDrmu s;()tlxnifciytlp elivs;t) rurxr ny1llte ici s) Dtax  nu0aptomi3iltlmDelnmpnu0altnio3tytomD aneo;(0t2to(o3oydalee neilt) Drauro;u0tex  icils mDua(vpnt0tetomf tatoa ran il()t2umxrpiodap  mivta( s2ua( o;o1aet  fetldls2uluvont) etoio ia1fm   ueo;s  2uoim iu1ll  micia() Dtrx  oo4altnmociys mDem(mp t0aetrxo tadfptr n i t)srxoim ou4am elfctl( s2rau o;o0alto f3ilt m emuvpn(4teenmfciotlaDe ies;t)seuoio oy1apt lfvt tfa2uaxrpoo0tptn oetydla2uaumpnu4tetrmrcta1lmDrli i ( sexr(opoy1lmenlnvtatf Dumx pou0tetn ociatfm rlumonu) ltnio ootlmte uvs t setmxmpiy4aleelivt t)a2tm( p;t0oexomfeildfs2umn o;t0artomocta1lpDelneo () exoimpiu4omte icsltf rua(rpnu4tpxo oeiydlmDrmu s t0texnif iydfaD lnei;s  etmim oydam elnesls) 2rmxmoou0tetomieiasfaDeanvs;u)alenxr oydlpt aivs t t2uoio iydlleemfvi tfsDuax  ot0aleoioeiytlaDeau on() rxrmociadlpD lies t) 2xmxo3oudol  mnesa( srrmum nt0oltn feiat m2rlnmp;u0tetoxf iy1lpD lneil(  rtoim3iu1lm  licil(fsrtaxm oo0oee  feilsls2el(vo;u)alxnir iytomtraneols0 eum(m3nudop  mfcslt a2ua(r oo0open oeiysfa elumo;u4 exrmrcoatfatr i i;s)t2toxopoy4alt lfes (  Dtmum ot0teeo oeiytls eaumsnt0alenmocoadlm  an ol( s2trxmpiudlm   fcilt)sruaum ;t4aetnii3iytfm2raumont0altnxr iadoaD aivs;s)t2uoio oy1ape lnctls aDrmur nu4ape  o3iad a ranvs t) exomocoatla e nvo;t0s2umirpnydop elfcil()aDuax  ot0optoiieilslaDran pnt0 eeoio3tydomDe neolt)t2umxo io1ap elnvils aDtax o;o0olenmoeiatlm rlnvpn(0altrxf3ty1lpt luvil(0srurim3iu4amt lics t  rrrxmont4oleoioeiys m2ean pn() exoxo ta1laDe nei s s2uoirpiodll elncsa()srrmumo;o1apt ifetysfm2rl(vp u) leoif3oydlp elneol()seum(m3ny4ap e ietls s2urum ;o0tltoioctytls uln o;u0trtrmf oytfa eliei;t srxrio ny4olte fvsa( sDtm(moou0tet  fciltfs ulnmp;t4aexrif3totfmteaieslt0 euo(rpiy4apenlivil()sruaurooo4tlenmictysfa2rl(mp;()trerirciadlpt  nvo t trxrxr3iydolt lnei sf Drmumpot1aet mi3tadfsDrmnms;(4trermrciydlaDrluei;t0teuriopnodlptn fvt s)srurxro;u4oexnmfctytlsDel( snt4tetoir3ootfpteauvo;s seurirpio4am e nvsatfsDtrurpno0oltomoctysls2umums;t4 eenmr3iadlatrlneolt setr(m3nu4apenliet ()s2ur(ro;t1tlt ifetasfm2eaums (0 ltrmrctadfp  lneils0setrim3nu1ll elncsl( sDurxmp;o0opxoio3ildfa2uaums u0tleoxfcio1fa rlu il(0s2xo(r no1lptn ictat arrru o;u1tltn oetad m2rau pn(4artomfcta1fatelnvo;()tetr(opio4opeemiei t sDraurp;t4oexnifeiys a ra(vs;(0alenxfcto1fpt  u i (0teum(m3oydap   fes sf rrru ono4oltomo3iytlsDelump t4altrmr iadfmtrai i;t0tetmio oo1lmtemnvs tf Dtau ooo4tet mfeild m eanvpnu4altniociydoatrauvi (0 rxr(r ny1ol nmneiatfsruaum oo1olxn i3iytlaDrlnvp;(0aexrio3to1optraies;()setr(rpiu1al elncsls  Drrxm ;t1opxoiietatlaDrlu s t)aetriocia1fpDe nvs;(  2ur(r3oydll n ncia() 2uaum ;o1aptnmo3iysfsDrlnmsn(4aetnioctytomtraivols0 rumirpny1omtnmnctas a2tm( p;u0tlt  o3iadlaDran snu0artnmf oatoat aueo;t)truo(opou1ll e icsat) 2rrxrooo0opxoii3iat mDelnmsnt)texrif3oydfm  aueolt0t2toir3io4olt mncslt) rtrurpno0tpt ii3iaslm2uanmo;() lxrxf iydfptrln o t0s2tmxr iydlm  mnvtl( arraxm no1tet if3iyslm2em(vp;u0arerxf3to1oa   u i () eum(m nudap   nvia( s2uaurono1opto ictaslmDranmon()tetnif oodopDraivolt) 2tm(r3iy1alee iei sfa2tm(mp;u4openif3iad s2emnmo u4tlxomf tadfmtr ivil(0s2umxo3ny4ol   fctlt) Dtmu onu1aexoiicilslsDeluvo () lenmr3iotla rlueil( t2to(o3no1opt mnvslt  rrrx pno1apeoiociyt sDuauvsn(0 lxnxf3oatlm rlu i;s) etoir nudol nlivtatfartmx  ;o4tlx  ociysfmDrl(ms u4tetrxfcoodfptranei () 2tr(o3oodame  iesat)sDtaxm ou1oee  o3iadfa eanms u4 lxoio3to1om   n o;s0 2xrxr oudlmenlneiat a2tr(r nt4opt  ieildlmDuluvp (4 reoifcoydfmtrau s;t0 eur(r3ou4omtnlnvt s)sruax oot1tltoio3iydla2emnmsnu) rtomr3io1omt  i ols0t2tr(m3oodolt lncslt) Dum(m ou4aptomf3iytfs rmn on(4texomrcio1laDraies;s0 rxriopoo4oltemieia(farum(moou0apxomf3ildfs2rmn p (4aeeoif3ootfp e u s t s2xmxr ou1olt  ncilt)a2umx pot4tlt  oeiadls2eln s;t0aleoif tytlm ranvsl()sexm(m3nudomeelnvsl(farrm( oot1tpeoifctyt mDra(vs;u0artrmrcio1lmtrln s;s0srtoxo3iudlme mnci ( sDuau ont4opxoifciasfm umuvsn(4arenmr3tatoaDeaivs;s)s2xoio3nu1lpee fvt (f 2rmuro;o0apx  oetadfsDrmnms;t0arxrmrcootfmDran il()trxrim iu4omt  neil(fsDrmx pno1aptniietyd a2ulumo;t0trerxf iatlp   n o (0sexr(opny1ape lnet t)a2tm(m ;u1apen i3tas s rm(von() reomrciydfmtrli slt0 rxo(m ny4oltnmfct t)a2uaxmpnt1tlxnioeiat aDumnms (4texnircio1fm rai s;( trxoxm nydlptnlnct () rta(ront4tee  i3tat mDuaumo t)alenxr todlpt lnes (0srum(o iodlm n neia(f rrrurooo0tee mictldfs2elumo;u4 lxnxf3iytlm e u s;t0setrirpnu1omen nvsl() Drau p;u4apenif3ils mDea(mon()trerif to1fpD  ieo t)t2umim3nudopeelies s arrrump;u1oet  ociaslm ea(vpnt4aexoxocoadomDr ueil() 2trio3oodamtelnvt tf 2rrxr nt1tpe mociadfm2rln p t4 eenxf3tytoaD liei t0srxrimpny1lp  lfcsa() rtmxrpot4tet if3tadfs umuvpn(4alxnmrciy1fa eli ilt sexo(rpoy1lp  mieslt sDtrx oou4olxnmi3iydfm2rmump u0tleoxr oytlmteluvs s)texrxr3nodape licta( s2ta(ro;t1teto oeildlm2emn p u)tltrxr3oodlatrlneo (  exoxr oydlptn nvt (fsDtm(m nt1tptniictatfa elnvonu)teerircoatfpt  uvo t srur(r3no1aptn fvil(fs2uau pot1alxo ociyslm elnms;(0 lxoio3oadlatrli ils trxr(m3iu4am nmictls a2ta( pnu1ape mietlslm2rm( p;t)tlxnio oy1fp  lieolt  rtmio3iy4apte fetlsf rum( pou4open oetydlm uau o;u0 lxoxf3totfmDe uvs;s) eurxm3nudoltnmivi ( s2rmx oot1open ieiytlm2ran p;u4teenmo3to1lmDrln o t0 2urir oy1lltn feilsfsDrmx  nu0olxo ociat a2umump u0 lenxr3ty1lpt  nvo;t) eurim3oodll emicias) 2urxrooo1ope ioeiyd a eln pnt) eerxocto1lm elneils)trxmirpnydalt  iet ( sDtmurpoo4texomieild s2rm( onu4arxrmo iadfp rli s (  2uo(o3oodaptn iciat arumurooo1optomfetysfs ulumsn()alxomfcoadfmD  n s (0 rxmim no4om nmnesa(fa2tmxmono0aptnif3iadfa2ea(msnt0texrxocty1fa rauvsl(0srxoxopnydolt  ivils a2rrxro;t1alt ii3iyt s2rau sn(0teenxo ootfp raivs;t  eurxrpiydamtn netat arrm(m ;o4olt moeild sDemu o ()tlxnmfcty1opt livo;s)setmio ou1am nlictatfaDurumpou0aleo ictlslmDel(vpn(4tlxrmf3iydom  luvo;s0teurxm3iydap  lneiasfs2ra(m oo0apx  oeilsla ra(mon(0tetnmrciatlpDr uvo t0s2tmxm iy1am elncs (fs2uaur ot1oeenioctad mDranvs;u4 eeoxo oodomtr uesls0 rxm(m iu1ap nmnci ()s2ta(rpnt0opt mf3iatlaDemn p u4 eenmfctodfpD  ivol( s2xrxo oy4altn nvsl(fs2um(  ;u1tee  ieiasfs2ua( s;u4trenxr3oatopDeau o t0srtrir3oo4omt mfctasfsrrr(r nu0tltomoetaslsDumumonu4tlenmocoa1omtr uvs s0 2xoim oudal nlfcta(f 2ua(m no0aptomieiadfmDrluvpnt0aetnifciotopteauvs;s  eurimpiy1ape lfcils  Duaumpnu1alxo f3iydfm elumpn(4 eeniocootomD au olt0 exm(r iy4omtnlncslsfsrua( pnt4oltomiciltfmDemnmsnt4trtnifctatoate u o s0 rtr(o3oudlpenlivi s  rrrx  ;u0oexnmfctyd m ul(msnt4tlxnxr3ootfa eaies;t0trtmxo nydlm e fviatf rtaum ;u1apen oeiydlaDea( snu0treoif tytlpD  neo s)t2urir3ny1llenmncias)sDta(  ot4oeto feildls elumsnt)texnifctadfpDe nvs s0trxrxrpiy4ameemnciat) Dtaumo;t0tpeo oeiysls ean s;(0altoxfcoatfatelnvsls0trtm(o3iudoltemfvias) 2ururono0opxnmieildlsDuanvo u)arxrir3totfa  aueo s)truoxrpnu4om e nesa( srumu pou4aeto iciltla uln p u) reoxf oa1op e ueolt  euo(m io4omt lnciasfarrr(  no4alenmoetltls elump (0alenxr3oa1fmt lueo t0 ruoxopiy1ap n fvsltfs2ur(r ou0tlxoiociltlmDran s t0texrxrcoodfptrluei;t)trxm(o3ou1am  lfvta(  rumuro;u0olt ii3iytfm2el(vo u)tleoxf3iy1fmtelnvi;s)sruoio iy4omen ivta()aruau pot1tpen oeildls2umumon(0arerifciytfmDe n o t0sruo(r3iy1amee neiasfaDta(mooo0opeo fctlt a2ra(vsnu)arxrmo3io1fa rluvo t  eurxo3nu4op n ivtasf 2uau p;o1oeenmi3iysfm2emuvs t4alermf3oa1lm e uvsl()trxrxo iu1llee fes () rtru oot4teeomoeiltfs um(mo;t0tleoifcta1lm eli ol()trxm(o3nu4optn ivs tfsrtaum ou4openiieiltfmDra(ms ()texnxf3iotfmD  ivol(0 exoxmpoydoleelfcs s  rtmx onu4tlen feias sDea( pn(0 rxomo iy1laDe ivol( t2um(mpoodal  lics s)s2rmxrpoo4teto octytls um( o (0aeenmf oy1laDrlivo;()s2um(o3iu4lltn net s)aDrmur oo0tlt ifciadlaDrlu o;u4arxnmo3iytlmtrau i;t0setmxrpno1omee icsls  rtru o;t0opeo f3tasfaDemnvo t0 rxoxfcoo1lpDelies (0sruoxr3io4ape  nvtlsf rra(  nt1alxoiociasfmDrlu s (0aetrxr3to1lpt livs s t2to(o3oydole mfet sf rrm( p;o4ale mieild s uluvs;u0 lxnxo oy1la   nvi;()srxoio3oo1omenmnvtasfartaxmpot0teto ictydlm2em( s t) eenifciadlmD  u sl(0trumxo3ou4oleemici t) 2umx p;o0aeenii3iadfmDul(mp;()alerif oydlat aueo (0s2xoxr oudap emncilsfsrrmur no0optomf3ild s2rlnms;u4artnmrctydfmDr nvols) exrio iy4op emivsa()sDumu ono1alxo fctydfaDraumpnu0tltnxo3oytfmt aieslt0srxo(o3oudolt  nei sf rua(  ;t1texnii3taslsDeanmpnt)altoif3todoa ran i;t t2um(o3iu1lp   ietls sDrr( pnu4alt  ictls aDemu p;t) rtnmr iy1opDran i;(  2umim no4lmt lnvsa()aDrm(  oo1alxoif3iydls um( sn() eermf3tatopD lieo;s teurir3ny4al n fcsltfaDumx  ou4opt moeild aDrmn o t0 rtoxrctotoa  anvils srto(o3io1lpte nciasfsrrm(  ou0apxnmo3iydfaDel(vs;u0aexnifciodfaDeluvslt0 2uoirpou4am elivil( a2uax  no1aetn feiaslm2rm(vs u)alxrif3ty1fmDeaues (0teto(o iodoleelfcsas aDrmx pou4tlen feiltfs2rlums;(4 exoxf iytom  li olt)setrir3oodolenlncsat)aDta( pno1tlx mietasls eluvs ()aexnmrcootfaD aueolt0trtoxrpiy4opeeliet tfarururoou4texo i3iltfaDrlumpnt0 etnmf3tytla e uei;s0tetr(r iy1lpen fvsl() Drmu p;t0oee if3iytfm2rm( p;(4artomr3tatfm e ues;s  etrim ou1openmnctatfa2rmumonu0ape  i3iat a umnvpn(4 ltoiocootoaD aieilt)t2uo(o3ny1omt mivilt sDta(  ou0oexoiictltfa2ul(vo (4 lxnir3iydop rlnes;( srto(o ou1op e fetat)srtmumoot1oltn i3iasfaDrlums;t4 lxomoctytla  livo;()srurxr oo1am n iciatfs2rmurpnu0apt  f3iatfaDuan snu) rxrmo3tadla rli s;s t2tr(o3iu1lp e ieiasf 2rax  no1apt iociyt sDua(mpn()altnxocta1lm elnvo s0tetm(m ou1apte feia( arta(rpnt1tpeoiocilt aDumuvs u4 rxrio3oy1oaDe n slt0teuoxm ny4apt micsltfs2rmxmont0altomoctldlm2rm( on(4trerio3oydfm rau i;() 2xr(rpou1op elies s aruaum ;t4olto f3iyd m2umn p;t0tltoircto1fmDeanei;t)srto(m ou1apt  feslt arrr(rpnu0oet  o3tld a eau p;t)trtnif3iytlmtean s t)t2xm(r3ny4lm  lnvs () rrrxmono0apen feiltfs eau p;u)aexrmoctytopDr ivsls0s2umxr3oo4opt  ieilt a2uaxrpot0optoiociydfm ua(mp;(0 eerioctatlpD auvi (  ruoirpiy4lm nlfet ( aDuax oot0aex  iciasfaDrau p (4 rxomr tatlatelieslt0 2tmir3io4amt  nvsa( s2ur(mpnt0aleo iciatlaDrlnmp t0aeenif3tatlaDraueo;s0trtoirpio1alte ict s s2tau ooo0tpto o3iatla2umn snt0 reoio3oa1omDrlneilt) eumir3no1op   iciltfsDur(r ou0texn oeils m2el(vp;u4tltnmfcoatlatran i;s)setmxm iydoltnmncs ( s2taxro;t4aetnioeiatfmDrlumo;t0arermo3totlaDr i s;(0 2ur(r3iy4altnmivi sf rua(  ;o0aet mfctysla2elnmsnu) lxoircty1op   i s s)truoiopiu4olen fetls sDtmu pno0altn oetltlsDean o;u)aexrxo tytfm   uvo s0trxmimpiudap   ivil( aDtax pot1olen o3tasls ulnmo;u4tlenxociytomte n o s tetr(r3iy1om  lncs (  2rrxrp;t0tltn ieildfa2ua(ms;(4 lxrmfctydfaDelieol(0srxmxo nu4alt lnetl(  Dur( oot1alx  f3iat m2umnms;u0 exnio oytoptelu i t) 2xm(m nu1alen fesa(  2rmx  ;u0alen ocias aDea( o;(0aexniocoytomDeauesls) rxoim3ny1alee fetas sDta( o;t4aet mf3iys aDraumpnu0 rtrxf3iodfateln ols  rum(mpnu1ole mncil()a2ur(mono0oexn feiadfa rlums t0 lxrmrciadom  lnvi t0t2toxopnydam  mnvslt)a2ra(rpnt0oleomf3iysfa uluvpnt)alxoio3oydfmtrlueols0 euoxm oy1llee nctas s2rmxront0tlx  i3iydfm eau s u) lermocia1fpDeaivi;t truoxm3ny1omt  fctl()sDrmuro;o0apeo f3iad mDranms;u0alxoio3iodlpt aieilt0srum(opio1om  mfvsatfsrua(m ;t0tetnif3tadfs emu s;u)artnxociodopDr u i () 2xmxr3ny1oltnlfciatf Dra(mp;o4tee mfeiydla2ea(mo;(4alermf3iatfm  anvil()trtmir iudale  ivsatfsDrrxr no1olx mi3iltls emump t0trtrmrctatoate uvol()setrio3oo1op n neias) Drru oou0tlx mo3iatfs2ua(mp (0aeeomf3iodlm   nei;t s2tmirpoy4omte ies sfarururo;u1alxoif3iys s2ean o u)arxomf3oo1oaDe ieols)s2uoxm oo1lpe  nci t srtau  nt4tpeo fciydfa2emuvp () rtrxrciotla  aiei;t texo(m iy4al emfeia()srumxront1alt mi3iyt s2em(vo;t4teeoxfctatomDrauvol(0srxm(opiodolenmfctls)artrxm nt0tltoif3ild m2uln o;t0artrxr oydoaDrai s;(  2xr(mpoo1ol emfcs ()arrr( pot4tleo fciydlm rl(mont) etnxfciydlm rlnes;s0s2xo(rpnodap nmiesls)aDuaumo;t1oetomi3ilt m umuvs t0teenifciatomtraies;s s2tm(o3nudlp  lnvt t  ruauroot1tlx  ieiydfm2uanvs t4aeerircootfp rlu o;t t2umxopoudlp  mneils sDtrx pot4tpenifctld a uln p t0 exomf3iadoa rlueolt)trurxr nodalenlicsls sDtmxmoot1oltn fetas s2uaumon(4tetnxf oytlmD  n s;t) 2um(m3oudalt lfet t) Dumx p;u4tlt mf3iad s elu s u) etrifciadlptr u i () eum(r3ny4lltnlneias  rrrur ;u4oleomi3iadfm2rln o u)arenmo3oatfaDrai il()srumxo3iu1lle mnet s sDtm(rpou1tetn ociysls2emnmp (0 rxomr iodfp  an i;(0t2urxr iu1lp   ict s) Dtr( p;t4altomfetldfa2ea(ms (0trtnmf iatlmDr u s (0 2xmxmpnu4om nmics ( a2taxront0opeoii3tatla2ra(msnt)arenio to1lmtraues;s) rxo(rpnydlp e fet tfaDtaxmpou0olxn i3tytls2em(vonu4texnio3oa1fp   uvs;( srtmxopnodlltnmiet t)sDur(r ot4oleoifciadfs eauvo;(0trtoxr3iadfatr ies;t) rxm(r no1al elnctat s2rrumpno4opx io3iytla ra( s () rermo3iy1fpDelieilt) exm(m3iodapt lfesl()sDrau poo4apt mfciltfs2rmn snt0 rtnircoytlp eauvolt0setm(o3iu4lpt  ivs ()a2uaur ;o0oeenmo3tytls2rm( o;t)tetrmo3totlatrlivi s)seur(m nu4lleeliciasfaDtmx pnu4apeo f3iltls rmuvs;t0trxniociadfmt  ivo t0setmxm ou4omee fviatfaDtmur oo0apx ioetltfm umnvs t)alxnxf3tydoa  li o;t)t2urxmpoy1ale miet sf rrmxm oo4aee mfeiad mDum(vp ()tetomf3iadfaDe nvs s0t2umxr nu4openmfvt s) rurx  ot1tee  ieiltlm umump;()tlxrmf3io1lmt lu i;t trxmir3nudlm  lneiat) 2ua(r ;t1opxnmociyd s2uau on(4areomf3ty1opDelnvo t)t2uo(o3ou4ape  nvtlsfsrtrxmo;u1aee if3ias sDuan s (4 eerifciy1lpDr nvol(0sexoirpno4apte fcias)arraxmp;t0olxoioeiyd a eauvo u0texrmf ty1lpt  ues;()trxr(r oo4alee nct (f rta(mp;o4alx  feiyd mDrlu p u0 etriocoadoat  n ol() eur(r3iydlp   ivsas)srrrum ;o4tlx ifcils a2eanvs t0texoxf3io1lat lnvilt trtoxrpoydom nmiei t)sruaur nt1teto ocildlmDrmn o;u) renxo oydlpD lnvi;s texrim3nodopt mietl( srrru pno4tpx mo3tls a2rl( o t4trtrxf3io1la rli s;t s2um(mpiydopee fctlsfa2taurpoo4alt mfeilt aDrlums;()artrifciy1la   ieol(0sruo(o3nydlmtnmiciltf Dtru ooo4alto ocildls uanmsnt4texriocoy1fp r i s t  2to(o3nydoleelfcsat)artrumpno1tptomf3iat mDem( pnu4 leniocta1lm eaueo;s)teurio3ny1lptnlies (fartrxmpou1aeeo fctatfm eanvp;u0alenio3ty1la rli ils0trxo(m3nu4lp nmfvsat)a2umxmpou4opt moctyt m2rm(mpnu)tltrmo tatopt auesls0seuoxmpiy4ope mnctas) Duaxm ot4apen ieiyt mDum( onu0 reomo oo1omteaivo;t0t2xmio iodol  mfvsa()srrm(mp;t0tptoio3iasfmDum(vo;t0tltomo3oodfpD aneo;t0sexoiopoy4omeemfvi tfa2ra(r ot4tlx  o3ias mDul( s (0artomo3ta1fmt  ivs;(0tetmir no4olt mfcsa(f 2tm(rpnt0teen ietldfaDumu s t4 lerxo tatlat auvi;t)tetm(m no1apen fvs ()srurx o;o4tlt iieiatla ra(vsn(0 lenxr oo1omtelivs ()seum(m3no1am elici ()sruru ono1tptoifciysfs eau o t) ltnmfctydlpt  uvolt0 eurxo3io1lptelfvsatfa2rru pnt0olt ioeiltfaDrmn o;t4trenmf oy1lpDr n s t t2trir3ou1amenlies t)artau pno0olxoiociadlmDrmnvo ()arxnmf3ty1op raneo;s  2xoim oo4amenmicsat)s2rrxr ou4tee if3ildfm ulump () lenxocoydopDr i ols trxmirpny4op elicsa(fs2umum nt1tetnioetaslsDraump t)tlenmf3oodfpteaivol(0 rtrir oy4ap e icil(farrmuro;t0apx mictytfaDum(vs t4trxoxf3todlpDelues;(0s2uoir3ny1lpenmivtls  2tmumpnu4alt iiciytla rl(vonu)texrir3tydomD  uvils) rurir nodom emiet t) 2tr(ro;o1oetomietat a em( s;t)tltoif tytla r ues;s0 exmxm nydap emnesa(f rtmumpou1alxomo3iysfmDea(vp t)tltnxf ta1lmtr ieols0seur(o no4olenmietltfa2rmu  ;t4openioetas s uluvo;(4tlxrmo ia1lmDe n i t0 2to(rpnodoptn nesls) rra(rpoo1tptnmoctldfsDumnvp;() rtnxo oodfm eln o;() etm(opiy1aleemieiasfsrtmxm nt1oetn iciadls2rm( s (4aleriocoo1lmtelieils  rtoxmpoodol n fcta()s2urxrpou0aetn feiyslm2ran o t) lxoir3oo1fmteln o;t  2uoxm3iy4ope miei ()arumx pno1aptomi3iyd s2umu snu0altnirciytoa eli s s)sruoimpoydaltn ivt t a2umum no0oexn oeiadlaDrln p;t)alxrmf oydlp  lnvi t srtmxopio1lm n ivta(  Dtru p;t4aexomocildfm2em(vo t)aeerir3iodfm   ueols0texrio3oo4amee netls a2rr(mono4tet iieiyt s2emu p u0treomfciatfmtranei s)trtmiopnudaleelnci ( sDrrumpoo1apxnifciyslsDeanms u4tltrxr3oo1faDelu o (0s2tmio oo1ome lnet ()s2rmum no0aexnif3iydfs em(von()texrif oatfptranes;s)srxo(o nu4lltemfvil( a2tmu oot1tlxoio3iasla2eanvo (4 etrmf tydoa  an i t0s2tm(opiy1omenlfvs sf rtrumpou0oetomieias s2uluvpnu0areoir3iodfmDeaivo (0 etm(opiy1olte neiltfs2rmum ;t0aptniociadlsDulnmo;t0texomfcoodom raues;t0srxm(rpoy1ll  mivt s)sDraxm nt4teeomf3iyt s rau s;u4artrmf ootfpDraivo s  rtoxr3ou4optn net sf rta(  nu1opto icils sDel(vo u0 rxoxocootoat  uei ( s2xo(o oydlle  ictat) 2urur no0tptomi3tlslm2rmu snu4 rtomf iatfa r ieolt  etrxr nudamtnmfvt ( srrmx p;u1tlxoio3ias s rauvo t0trxrmo ia1op  lneilt sexoxm3ny1lltn fcil(f 2umuro;u1olxoiociyt aDra(vp;t)aexrmfctadfaD  iei t0 2urxmpnu1oltnmivtlt) rtrx  oo0oltn oeiltfm2umn s;u)treoxr to1lp  lueo s) etrim nudapenlietltfs2rmxm no4tptoifctldfa2uauvs;t)arxoir iatfa  aueilt s2urxr iu4al  lfvta() 2raxmo;o1texoioctltfm2eaumsnt0tetnmf3totlm e n o s trxoim oy1amtn fvtlt s2rm( pno1tlen oeiasls2el(mpnt0 rxnxr3oy1opD luvs t t2umio3oy4alt mnesl()arua( oou1ole mfciat mDeaump;u0 exnxrciytlp e ies;t) ruoxm3oo1ome  ietat sruaxmp;u1aexnif3ias m emumsnt0trxnmo3oydlmDeln sl(0s2xr(r io4lleemieil()aDurxr ;t0alx  ictas s2elu s;t0areoif3oatla elues;t0srxr(opnudlp  mivt sfs2rmumo;o0oetnmi3iatfs2ulu o (4trenmo3io1op raueo t0 rtrxo3oy4am elfcils) 2raxmpnt1olx io3tls a ea(vonu4areomo iatlmteau i s s2xmxmpnudamtn fcs tfarrrurpou4tetoif3iyt s rmu o;() eeomr tadlpte u s s0texrirpoy1op emivtas)srrmuro;o4oeenmfcilslmDemnms;(4trxrxf3oydlm   nvo s0s2toirpno4omtnliesa(faDua(
\ No newline at end of file
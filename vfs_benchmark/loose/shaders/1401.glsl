@@ -0,0 +1 @@
+u o t)srtoxo iudopte netltf 2tmxmpnu4olxniiciys s em(vs;t4 lxnmfcio1lmDelnvilt)srtrxrpou1lpenlfctls)aDtrx o;t1texnifcias m elnvpnu4alxoio3iodlat anes t)s2xmim3nu1ap n ies ( srurxrono1tlenmiciyt a elnvsn(4aexnxr3iadfpD  u o;s) etmio ny4optn fvtls aDuru pnu1tle mietyd m ulu s t4alxnmo3oa1lateaneo ()trxr(r3oudolte ieta(fsrtmxm oo0altoiieiys aDemnmo;u) exomfctatlpDr ieolt) exr(opiudamenlnet sf 2umuro;t1apen fcilslm2umuvo;t)tlxnio3totopDrlneilt t2urxo3iu1ome mies tfsrtax o;t0olt  icias mDumuvsnu)texnxfciotlp r ueils0trtmxo3iy4lm n fvi (  2raxroou1tpenif3iadfsDea( s;(4treomo3iy1faD  ivi;t0t2um(r3nudlp e fvsatfsDtr(m nt1alenmfciltla2um( snu4trtomr todop eai o;() 2xr(m iy4ap nmiesa(  2raxr nt4opeomieiyd mDeanmp;t0aeerxfciatfmt aueils)t2uoxr iudomtn ictatf Dur(r ot1apx  iciatfsDea(vsnu4arenmo3oa1lpt lieo;()setoio3oodamtemfet sfsrum(m oo1oee  fcils mDra(vs;()teeoxocoodla elneols  2tm(r3oydapenliesl() Dur(m nu0olen feildfa2rmu s u4 ltnmo3ootlpDrln olt seuo(rpiu4opeeliciatf Dta( ooo1apxniictydlm2rm(vp t)aeenifcoadfaDrln i;s)truoxrpoy4alt lnetl()artm(mo;u0tle  iciatfs ea(ms;t) lxnxf3tadfmt auvilt0 rxm(r nudopee fvi tf 2um(rooo1alenmfctasfa um(vo;(4 eerxr3ty1lm  ln i s0 2trxm oydoptn fei t) Dtax pno4ape mictltls2eaumo;u) rtoxf3iydlm r n i;( texm(m3ny1olee fvilsfsDraxmo;u4opto fciysfsDemu s ()trtnifctotom   iei;(0sexo(m nudol e nctlsfs2tmu p;t4alt mictad aDuluvs u) exnmocoa1oa  auei s0s2um(o3no4aptemfvi (fsDrr(mooo0aexo ieiys m uln p;t0trxnxfciadomD lnes s0s2xoxm iy1lm elfet tfsrrrurp;t1olt  feiat sDua(vonu) lxomf iadop r i s;t) rum(m iu4lp   fvt s)artm( pnu4aptnmicilsfa2ea(vont0tltoif iydfa r ieo;t0tetoxr3oo1ape lncias)srrr(  no0oet mfctad aDeanmpnt4trtnir to1fm rlneslt0trto(r nudaptn fetat  2uau ooo1oeeoio3ias m2uau p t4tetomo3iydop ran ils s2xo(rpny1openmnetat sDrm(mo;o0apenmo3iydlmDrmuvpnt4alenxo3tatfmtrlnvi (0s2tmirpio4aptemneil( aDuaurpno4aetn ietltfa2emnmo;(0arxnmf3iadlpt aies t)tetmir3iu1amte nvta(fs2uaxmo;u0alx if3tydfa eanvs u4aeeoxo oodoaDe nvo;s)t2um(r3oo1lm emivt sfs2urxmpou4olenmiciytfmDrluvs t0arenxf3tydopt aues;(0s2tmxo nudllt lfvtasfsDur(rp;u0teto fcildfm2ean o t0 rtrxrciotlmDrauei;s  exmim nodlltemnvsa( a2tmxm ou0oexomieildls2eanvpn()artrmfcoydoaDeaieol(0sexmxr3ou1amte nei ()sDraxrp;u1apxn i3ildla2uau snu) lxoir3totop eliei (0teumxrpnu1olt lneiltf 2rm( onu1tpxn ocilsfm2ul(vpnt4 rxoirctadomD aivs;t t2tmir3ou4lmtnmnetas aDrmuro;t1aexo f3ilt m2emnvs u4 ltoxr3tytom rln i;t)s2xo(m3iu4om e ivi t)s2tax pnu1optnmiciad a rm(mo t0tlxrxf3tatfpD  u i s texoxm ny1ap elfeia()arum( ono1tlxo iciadla2emump u0 ltrmfcio1fpD luvi s  2tr(r ny1lm n nct sfaDrr( onu1apxoifeiadla2emnvo;u4texoir tatopte u i;s0 euoxmpiu1ol n ncsls  Dururp;u4tpe if3tlslm2em(vo (0 lxnmf3ta1fm eai s (0s2uoiopnodale lnvtlt) rtr(mp;o1tlxoii3iaslm ua(vp u) rerircoo1om rlnvols0srurim3no1aptelnctas)s2ta(  ot1tlxnmoeilt s rm(vo u4 lxrif3iatfmt li i ()trtriopnydlmeemivt (fsDumu pot1tex  o3ilslsDrmumpn(4artomo3oy1fa  li olt)trtoxo3oodlm nlfci t)arumurpot0oetnmo3iys mDrl( p;t0alxoxrctydlatr uvi;s0trto(mpoy4ll   ivs t)srumu  ;t1aexo o3ild a el(vs;u0 renif3iydom rluvsls0 euoxm3iu1lleelieil( srrrxmpnu0opeo ieiysfmDulnvonu4 eenxf3iodopteai olt)trum(r3iudlp nlfci t  rur( pou0altoifeildfs ea( o u) renxr iadomtrlnes;s0truoio3iu4am  mncsas)s2ra(mono0aptn i3iadlm rl(vs u0artomrcoytlpD li ols0s2ur(opnu1llte nct s)sDtaxm oo1oex  feiltls ra(von(0tltnmf oo1fpDeluvs t seumxr io4ll e fvt tfsrrru ooo4tlxniociadfa2um(vsn()aleomr3oodfp  aieilt)srtm(r iy4ape mfci s)a2tr(mo;u1tetnmocilt a2umn o;u0 ltrmocoatlate ivils srxmir3nydapt  feslt sDurx  ou4apx  iciytfa raumsnt0 etoxr3oydlptr ivi s srxoxo no1lmee ncs sf 2tmx pnu4aptomoetas m2eanmp () leomrciytlaD aues;s0trxrir io4ameemivsas)s2taurono0alx mi3tasfm uanmpn(4 lxrxo3oatfaDrln o s0sexmxo3nudaleemneiltf Dtmum nt0tpenmfctas a2raumsn()alermf3tadlaDr iei s0s2xmxrpoy1lmen netls s2rmumpnt4aeeoiieiltls rlumsnu4tetoxf3tytoa ranvils  2tmiopny4omtnmicils) rtm(ro;u0tpxoiiciatls2ean onu4 leoif ia1fmDraies;t)t2tm(rpoydlme mfct (fs2trxmpno0tpen i3iytlaDrl( p u4trtrmr3oa1omD luvilt trtoimpiy4olenlicia( srrrxmo;u0tetoio3iadls2ul(mo;t0altrmocto1fmDelueols0s2xr(r3oy4am  licsl( a2uaxrp;u0teen feiltlaDul(ms;(0aeenio3oodfa  ln ols)s2xrxo oy4amee fcs t  Duaxronu0tetoio3iydfs2uanmon(0 lxomocoydlp  lu i t0 2xr(o3ou1alt  ncil(f rtm( pnu1teenmietydlm2uln o;t)artrmr iy1fm rai ilt)trumio3io1lle  net (fs2rrxmooo1opeomiciatla2em(mpnt0alxrir iydoptraieo s seurxr nudomeemnvias srraump;o0tlto oeiadlsDelnmp (0tlxnxfciotlpD li olt)srto(rpny4omeemiet t sDrr( pnu1texo f3tadlsDrmu s;u4 lxoxo todfmDe uvsls0 2tmxr3ou4om emietltfsrrmxm no4tpxnii3iad aDeln pn()texrxr3to1fmtraivo t0 rtoxr3nu4lp nmnvils sDra(mont4alxomo3tltlm ra( p t0 lerxf totfp  au s s)t2urxm ou1apee ivt t)a2rr(mo;u4tltomo3iltfm2ua( pnt)artrmo io1lp r ueils) exoxo3iydol elfvsas)s2uaxmo;o0olxoii3iasls2rluvont0aeeoxr3oydlpDr ues s teumimpiudlptelivtas s2uau  nu1tex moeiydlaDelu s t4tltoif3io1oa rai s (  rxmxr3oodapee fciat)srur(m ou0tet mo3ilsls2elu s t4alxrio oydfatr n o t0 etmxo3oo4lltelieiatfarrmu  nt0tltn ociydfmDuluvs;u0treomr3oa1fmD ln o;( texoxm iu1aleemfcs s) rtaxr no4aptnio3iytlmDeanvpn(0 rxrifcoo1oateauvslt t2urxo io4ll nmfvils  rtmx pot4teenioctyt s eauvsn(4 lenmfcoo1fp r neo;t  exoirpoy4ame lfvtl( a2rmur no0teto f3iyt aDumuvp t0tlxnmr3tadoate n slt0tetriopnudlme  fcils  Drm(rpou0alto f3tlsfs rlump;(0tltoxf oydom raues;(0t2xo(m iu4llt lieias) Drrumpou4oltnmieiytfmDrluvs;u) lxrmr3tadfp rlies;s) rxoim3iy1am nmncsasf Dua(mp;o1tlenio3tld sDeauvsnu) renir3iadoptrlueo s  etoxmpiydopeemnvtl(fartru oou4ale  f3iadla2ul(ms;u4arxrmf tydlm  aueo;t tetoxm iy4lptelfvi ( aDurxronu1olt micild a ua( on(4trtnmr3oo1op elneo ()sexoim oy4lltnmivt s) 2trx  oo1tlenmo3ilt s2umnvonu4aeerir3iydomDrlivi (0srxr(o iydll nmfet s)a2tmxmpnu1apx mfetytfs2raumo ()aleomocootfatelueil() eto(r3nydlme lnesl(fsDrmurpnu4aptn ietyd m2emn o;u0tleoiocta1opt  ueilt0seurio ou1alenlivs t s2trxrp;u4ape  fciydfm ranmpnt4tltnxfctytom elivo;t)s2umio io4omt lict ( srrrxmpnu0opt  iciysfs2um( pn(0aexnxf tatoaD  n ols)seurio3nudaleelicsat) 2rr(  ;u4oeto oetytlmDul(ms;u)teerxr3io1fateaueols0s2xrxr3oy4om nmfvil( aDtm(  ou0alx  o3iasla elnvpnt)aeenircty1lpDraueils0 exrxr nu1am nmfvsl( srtmxmpou4aexn octltfaDraump u0 renmf iatop e iei s)trxoim oo1apt mfeta() 2urump;t1tlxo fciydfm2uau o;(0aexomo ootom  anvo (0s2trxrpoy1optn fci t sruaxroot0tet if3ias a elu o;t) lerxocoydlpD luvslt  2uoxmpny4altemncsat)aDrr(r ;o4aee mo3iys sDulnvo u4trxnio3oytfaDr uvils  rtm(o3nydoleemicsas a2rmu  nu1oex  feild a em(vonu) lxnxf todfpte i o s  2um(o3iy1llenlict ()s2taxm no1olenmfciytlmDul(monu)tltrmrciadfmteaueilt)t2tmxm no4oltelneiasfs2rmxmp;t4aleo oeiatfs2ua(vs t4alxomo iy1om  lu olt0 2um(rpou1am  mfcsas)arumuro;o4ale ifeilsfs rmnmpnu4 rtrxf iatopDelivols srtrxr3ou1olte ivt () rrm(mooo4olt ifeiasfaDum(vpn(0aetrir3tytla eau o;t)t2tmio3iudal   fvs (farrm(moou0aetnmietat mDea(vs;u4tetnxoctotlmD anei;(0sexrxo3oudamtemfesa() 2tr(mpoo0oexn f3iltlaDua(mpnt0trenxf3todopt liei;t  ruoxopiydaltnlncilsfaDururont4tpt mfciasfm2rau sn()trtomf3oydfpte i sl() 2xrir3oy4ome lneslsf 2umur nt0altn iciytfaDulnmpnu4 rtnir iydoaDelu i;s0s2tmio io1ope lncsatf Draxr ;o4tle ioctydfmDeln s t)aeenmo oatlm e n ilt0sexoxm ou1optn iei t)artaumoot4aetoifetaslm ra(mp;u0tltrif3iadoptraieo;s trto(r oodlm   iet tfs2rm(r oo1teto ociasla uanvo u4tlerxfciytfaD auvo s) eur(r3nudlm n ivi t)s2umxr ;o1olx if3tyd m2ua(mo (0teeomr3ty1omt  n ils)tetoxo iy1lltemics tf 2ua(moot4aetniieiasls2emu p (4 etomo3oy1laD auvols0 exo(r no4lmeelncs (fsDrrxr ;u1oee mictld a2emumsn()aeenmf3to1opD lnvi;t)srtrxopnu4ope mncslsfa2tmum nt4opx iiciat m2ulnvp;u) renifctodlmtr ivo;t srtrxo3oo1lmtn iet tfsDraxrpnu1texnmocildfs ra(vo;(4tltrif ootoaDeluvs;t) 2toim iu1olee neias s2um(  ;t4opxniociytfa umnvs;()tlerif tydla  au o;s0 ruoxr oy1lpt  fvslsf 2uax ont0aex mfciyd s2um(mp u0 eenmf oatomte uvs;t) rxrxo nydomeelncta( arumx  ;o4aleomfeiytlm rauvo;t)aexnifciytlmtraues t) euo(r iy1ll nmnei t srumxrono4aetn i3tat m umn s;(0tlxoxo oy1lmtrlueo s0texrirpnudlpeemnctas)aDtrum oo0oltomoetydfa em( onu4 leoxfctodom eaueols) exo(o3iy4lme  nvtasfa2um( o;u0tptomoeiatfmDel( p;(4trxrmf oatoaDe ueils  etr(m iodlmtnmictls aDraumoou4tpt ifeiydlmDua(vpn()alxoircto1la  liei t s2xmxrpny4alenlicilt sDumxr nu4oeeoifeildfm umuvp;u4aeerir to1faDe nvi t  eum(r oo4altnlnctasfaDrru p;t4aexo ieiltla2raump u0teenmr oadfpte uvi;(0teurim3oudope  nei tf 2uauroou4tee ioetydlm em(vo;()teenir3oydlmDrauvslt teur(r3nu1lmt lnes (  2ra(m ou0oltnmfcias m emn pnu0 etnifcta1fpD  ivo t0texr(o io1olee fes s  ruaur ;o0aetnmfctad a2umu pnt) ltnif to1om   nes (0s2um(m3oydop nlivils  Dur(mont1tee ifcild aDumnmpn(0tltoxr iy1oaD  nvsls srxriopiy4oltnlnei t)a2urxm ou0oexnif3ildlsDumn p () lenxr3oodfptelivilt0 rtr(r3iodlpe lnctas  2tmuro;u4tpt  ietatla2uauvpn()arxomf3tatfp rli sls0texm(opny4lp e nvt t) Draxmpno1oexoioctasfmDuau p;(4arenioctatoa raivi;t s2trirpio4ap  livt ( aDrr(mpot0apx mfeiltla2uluvs;(4areoxf iotfmD anvs s seur(o3ou1apt mieiatfs2tmumoot0aleomfeiydlsDranmsn(4teerif3io1fm  aivi;s  rxoxo3nudopeemfct tfs2trxr ;t4texnmfeilsfs emn s (4teeoifciytom eanvolt tetmimpoo1opeemfcsas)aDtr(moou1tet moeias a2ulnvs (0 rxnif3iytlpteli i;t)teumiopnodap  lfcsa( artaxrpno1olxnifeiyt a umnmpnt0 lermf3to1lmt ln o;()teto(o3nydome mnes tfsrrrurp;u1aeeoio3iydla rm(vsnt)arenircoatfpD aneo;s t2xmiopny1amtnlnciat)aDtrx o;u0alt iieiadfa2emuvp;u) lerxr3oy1oaD lu s;s)srxoxo oo1lmtelietasf 2tm(m ou4apxnmfcias m ran s;(0 lxomf io1lmDe ieslt0t2ur(m3ny1llenlnesls  rtrxmpoo0oeeo ictasls2elnvo u4tleomrcoa1oaDe ieolt)trxmir3nu1olen ictl(  Drm(r nt0opxn oetyslm2elnvs;() rxoxo3iydlpDran i s0srtoio ny4llt  fvt () rtaum ;u1alx  oetysfaDeanvpnt)tetrir3totlmDeaieils0sruoimpoo1optnlivsas srumxm ot1tpt mociatfm2emnmo (0trenio3iadoa elnvi s setmxopno1oleelneslt aDtmx pno4oex  o3ilsla umn s;t0 lxrxf3iydoaD  nvi;t)s2uoio3ou4ap   fct t)a2rmurpoo0texomo3ias sDul(mp t0 etnif oytfaD  uei (0srxm(m iy4ol nmnvi () rtax oou1tet mf3ias m umnvp;t4aeenmociadfp rlies;s t2tmir iydapt  fciat)srtrxro;t4oex  octltlm eluvont4teeoif3oadlatr nes;t0sexmxm oy4apenlnetas) rua(m no0tltomictysla umnmon(0arxrircoadlpt aneolt0srxoxo io1amenlfvi s sDra(  ;u0tee mociyd sDuan p;u4tlenxr ty1oa  luvilt) rtrirpiy4lpt  ieilt) Drmx oou4olxoio3iysfa2rl( p u)tetnmr3oadlaD  uvs s texm(o3nodllee nei sf 2trumono1openiieiys s eau pnt)artrxrctytfpDr neo t)setm(r iu1om n iet ( s2rrxr ou1aex miciyt aDul(ms;t)artoir todomDeli olt0teurirpiodomtn nvsasf rua(  nu1oetoifetlslaDelu pnu) rtrif oa1omDe n i;s)srurxm oo1lpeelfvsasfsDtmx  ot1oetomictltfs umu o;t)tlxrir3oatoa ean s;s0 rurxm3iy4ll  micsas  Draur oo4ale mocias s2ul(mont0arxomo3oydla raueo t)srur(m iy4ap n icsl(fa2ua(root1alenmi3iat a2um(vp u4aetrxrcoy1fptrluvo t0 2uoio3iy1am   nvtls)a2ur( ont4oleomf3iyslsDemnvs;t0 ltnir3iydfa eluvs ( tetoxrpiydope liesl( arra( poo4oee mieilt a umumsnt)artoir3ootoat li i;(0 rtrir oydlp   neilt aDtm(mpnu1olxnmoetlsfm rm(mp (0 lenxf3ta1lpDrluvsl() euoio3ou1ome  iesatfsrraum ;t0tlx  i3iys mDrm(vpn() exnirctodfaDe ies () eumxr3iudole  iviat arumxmooo0oee ioctadlm2rl( s t4tetnmf3iy1oa r ivs t  2urir3iydam nmivsa( a2urumonu1ape mietltfa2ulu s t0tlxoxo ta1lmt liei;( s2xrxo iu1open ici ( sDuru oou4optomictltfa rl( p;u) eeoxrctotoaD  u sl()setmxo3oy4olenlfesl()aDrauroot0aexoifetltfa eaump (0 ltrmo iytlmDr u olt setrxmpiudol  miciat a2ta(r no0tpxoifcias s em(mo;t)tlxnmfcoydlmDeanes s0teto(o3oodlm  mies (fartrxm ou1ope ioeilslm2elu p;t0trxrxr3oo1oatrli i;t0trurimpoo4ol  mneilt) 2tr( ono4olxn fcilsls2ua(mp;t0treoxo3iytlp eli il(0srurir3oo4amee netl(fsDrmx pno0oleniieilslsDrl(vp u0artrir totlatrlu il(0trtoim oydlmtnmfvtl() rrru p;t1oee mf3iysls rmnvsnu4arxomf oytfp  luvs;t) rxmxm nudamenmnct (faDtru poo4ope mf3iat s2uauvo;(0 renir todfp  lneils) 2xrxr3nu1aptelnetl(fa2uru  nt0tpxn ictasfa uau s u0 eerif oadlpteluvils0sexoir3iodomte fctat) 2umu p;o1texnif3tld mDrmu pnu0trxrmo iydomDeaues;( trtmxo no1ape lfei sf Draxrpnu0tle  i3iytfa2uln s;t0 exrio iy1lmteluvils0 rxm(r ou1omenmnvt t srumur nu1altn i3iat a elumon(4 leomocoadfp  lueolt sexr(mpoudom nlnvia(faDumxm ;u4opeoioeiyslsDeanvpnu)tltnxo oadfpte uvi (0srxo(rpoudalenmnvsat) Drm(rono1ole  icilslmDeanmo;u0alerxocia1fmDelues;t texrxr iudlmtemiciltfs2tm(  ot4aexniieiys aDran pnt0texoxf iodfpDeau s;t)texrxo3iy1ope  nvsatf Draxr ;o4oltomieiasfa ulnmp;t4arenio3oatlp   n i;(  rxriopiy1alenmncsl(f Dtax  ;o4tpt ifciydlm rm(vp;(4alerio tytoa e nvs;s  2xoxo io1op emfeta(fsrra(mo;o1apeomietyd m2rlnmo;() lxrifcootom   n il(0t2um(rpiodlm n netltfsDtru  ot4tpe  oeils sDem(mpn() lxnio to1lm  livi;s0t2xriopoodoltnlfeia( srrr(r ot1opt  iciyd aDrmn s u0 eenxo3oa1lmDr ieo;() etm(rpiy4llenmivtas a2urxr ot4teto iciad m2umn s;(0aexoio3ootopDrlneils)s2xrxopoodomtemfetas s2tax  ou4opxo fetadla2ul(mo t0tetnxf oy1lptrli o (0sexoim iodlp  livias)s2raxrpoo1tle  i3ilt m2umump;()aexrxfcoydop rluei s0s2to(m nu1lpt  ivs (fsrtmxro;t1ale if3ilslaDuanvp u)alenio oatoa eauei;()texmir iu4lltnmivs t)arua(r oo4tlx  ictldfm ulnvp;u)tlerir oodomDeai i;s)s2trim iy1alt mnct t) Dtr(mpnu4openmfetys a rlnvs (4 exnio3oodla e n i t)tetoxopoydoltnlnvsa(farrrurpou1alenifetysfaDrl(vp t)aeeomr3iydfa  livs t tetoiopoy4ameemnetat)sDrmxr nu1opx  i3iadlm2umnms (4trxoir tydfa   neo s0trurirpnudamtelfei tfsDtmu ooo4opxn feiat mDranmp (4altoio3oytfpD aivils) rxoio3iodolt lnet t)artax oou0alx mi3iaslsDeauvs (0trtriocoytlpDrlivo;s) etr(rpnu4openmnvslt s2uaumo;o1aeeo f3tydfa2ulums;(0alxrxr3tytlp  ln o t srumir3iudomen nesa( aDrmxmp;u0tet ioeiyt m umump t) rxrxrciydoaD aiei;s0sexoxo ou1omenmnvi t sDrau poo0alt iicildlsDul(ms;()alxrxfctotlp eanvi t s2xr(o ou4openlnes ( srtrxroou4oetomietad sDrmn on()artrmo3oy1fm e ivsl(  rurir no1aptnlfet () rrau  ;u0ole  fctad a uan sn()alerircoa1faD  uvs t trto(rpnydop   ieilt)sDtr(m oo4aetoioetld s uan p t4tlerxo oo1op rli o;t) rumxm3ny4omeelncilsfaDtmxm nt4aexn ietlslmDemumo ()trermf3oodfa eauvilt tetmimpiudap   fctas)aDuaur ot1alx  icilsfs2elu p u)trtrif3to1lpt auvs;t sexr(r3io4aptemneslt  2tr(r ou1tlxn oeilt s rlnmo;()aeenxf tadfptrln ils0t2tmxm oydolee fesas srumx pnu1tpt iictasfaDrmn o t4 rxoifciotlmD lnvols0t2uoxr oy1lle  nctl(fsrrrurpou0aee  iciltfs rmuvsn(4trerir oadfa   n s;()seuo(o3oy1oltn ivt (  Drr(rpou0aee mieiytlaDrau p u)aexrmf3oy1om elivo;t  eur(mpou1omeelnvi s a2tmx poo4oet iieiatlsDra(vs;(0teerxr3oodomtelneo (0trxmiopiu4openlicia( a2rmumont1oexniieiat a ra( s (4artnxr3iytfatelu s;( teur(rpiu1lmeemncil(faDuau o;t1opx  ocilsfmDea(vo u0aleoir3iotlmDeanvils0t2umxmpnu1amt licil( a2uaump;u1apenifctlt sDul( p u0tetrxr oy1omtran s s0 rxmxm3iudopte nviasfsDra(mo;t1olt  icilt s rl( p t) lermr3totom  an s;(  2toimpny1al emnvslsfs2umx  ou4tee ifeiadlmDrln p;()trtrxoctotfmteluvo t) eto(m3ou1ole  ncs t srraxr ;o4apenif3iat s2ul( sn(0tlxrmo oatfmD anvi t s2um(r oodll   nvsat)sDtmu pnt4oeeomictldfmDrmn sn(0aeenifctodfmDelues t0 euoxr iu4amtemncslt)srrru  ;o4aetnmf3iysls2ulnvo u4 eeomoctodlmtraneo;s teumxm oy1lpenlfviat sDrrx ono4apeo fcilslsDraumsnu4 exnxo3todop r i i;t)tetr(o3oy4opt mnetltfartax pnu0ale ifcilt sDelu p;t)aetrxfcty1fptrliei (0s2uoxo ou1lleelfvt tfs2rrur ;u0aeeomoeilsla uauvp u4treoxf ia1om e ies t s2xoxrpnudole  nes t srrmxro;u4aleomoeiys mDuluvo (4arxrio oatlmDr iesl(0 rxmirpnu4omen fviasfs2umx p;t1ape miciytlm rauvonu) lxnxf oydlm   n ols)seuoir iu1lpenlivsltf 2tm(ro;o4alt  fctldfaDulu o;u)alxnmoctadlmDe u ilt  2xo(r3iu4lp elnvt t)sDum(r ;t1tpxn octytls2rlump ()arenxr iydfatelieol( t2toxrpio4op  lncilt sDtm(mpnu4tleoiieiydlm2uln s u0 rxoxrciadla  au o;s tetrxo no4olt lnvta() rrmxmpoo4tet  octld sDuln snu)tlermr todoa eai i t0t2xo(r ny4lme lnct tfa2tmu ono0olenmietadfmDeauvp () renio3oy1omD  i i;s sexm(m iu1olenmfcilt) 2tmur nu1opxnmfeildla rl( s;u)aetoif oodfpt auvo;(  2umxo3nudolenliesat srraxmoou4tle mociaslaDra( ont) etrxociodfpD lnvslt0texm(mpnudlltemfcsa() 2urumoot1oeenmf3tlt sDumn p;t)aeeoir3ty1lm r i o;() etm(mpiudll e net s) rur(m ;o4alxo f3iasfaDuauvonu4trtrxf3to1fat lnesl(0trtoio oodoptn iet t aDuaxrooo4aexo ictlt m2ran p;u)teeoiocootop rluvi;s) exr(m3nu4ap nlfeilt)s2taumooo4tpe mf3iasla elnmo;u4altrif io1oaDr n s;t)trxr(m oydll  miesl(faDua(r nt1tptn ietat s2rl(mo;t4teenmr3tatfmDelnvi t0s2uo(r oy4lp  mnvi ()arurum ou1ape mo3tyt m umums t)tltnif oydfat aueo;s) 2to(opnydoptnmnei t)srtrxr ot0tpt  icilsfa rlnmp;t4 ltomrcty1omDr n s;() exm(m3nydomenmivi tfs2ururpnt0oetoif3ild m elums;u)aeenir3iotoaDeai o;t0 eum(o3io1lmtnmfctl(  rua( oou1alxo i3iat mDemuvsnt)teeomr3iydom  auvslt)seur(rpny1llteliciasf rrmxmoot0apt mfeilslsDrlnms;(0 lermf3oy1oaD luvi;()trtrxo nydal  mnctat artrxr nu1alx ii3tadfa2uauvo;(4 ltnmr3tadlm e ivs ()s2xm(r nydlmt lnvia()aruax  ot1alxomieiadls em( s;(4tleomo3iadlmD au ilt0s2urxo3iydlm emncs t) rrrum no4oleoii3iadlm el(vs;(4treomfctotomD aueil(  2xmimpio4ol   ici ( a2uaxmo;t4aeeoifeild a2umnvpnu4 eeoir ootfpD auvs;()t2tr(rpou1lmeemivt s arra( p;o0oexomoeiat m2ua( p;u)aetnxf3oa1lmDelivs;( texr(r io4lleemfvt tfs2uru o;t0aptomi3iatfaDraumo;(4trtrxrciydlm  an o s s2xm(mpiydlm emiviat)srrm( o;u0ale ifeils a emn pnt)aexnio tydopD ln s;t0 2trxmpno4al emivsltfa2rm( p;t0opxo i3tltfaDumu pnt)tlxnif to1omteliesl(0 rumxr3nydolen fet sfs2raur ;t0ole if3ilsla2rm(vs t4treoxf tytfa elneo t)tetrxr oydap elnvsas)srta(r ;u4alt ioeias mDumu p;(4aetomrciydfaD an o;(0srxrxr3iu4alenlictatf Duaur no1texomoeiyd aDul( o (4tetoxr3iytomDelnesl() etm(r3oodamenmnciatfa2trumonu0oeeoifeiytlaDrmn s t4tetrmf3ta1fp elies;t)t2xrxrpoydomenmivs sfs2rm(rpnu4tex ioeiytlm2ea(vp;t)tlxrxr iytom   neilt tetm(o nu4lpenmfetat)srua( o;u1optn icilsla rauvp t)alenmo3tadlpDraneo;t trxoxrpny4opt  ivilsfaDra(m oo0altomi3tad s2rmu s;t4 reoxrcoo1op  anvo;s0srxo(o io1op  mfvi t arrr(rpno4tex io3ildfa rl(mp (0aetomo oytoateluesls0seuoxo oudom e fcsas s2um(r nu4tptoio3ilt m elums;u4trxrmocoatla e i i s0s2xoio3iodam  mfei ( srtmump;o4olxnmoetas a2rau o;t4artomf oadfaDr nvils)setr(o3oy4lltemnvtas)srta( pno1tpxoifciadlaDelnmpn() ltnxr iydoa r uvslt seto(o3oo4lp  livt t)sDra(rp;u4opeomfciltla2ulums;t0 renmr iydopDeaivo;t  rxrxm iydopte nciatfa2urumpot0opx mietlslaDrl( sn() exrif iydlmD au i;s  rtrir io1lmtnlieta(fa2umu ono4tleomoctas sDrl(vs;t) rerif oatomD aivi (0sexm(o3iy1lp nmiet s s2tau  no4olxnmieiatfaDrmuvp t4 etrmr3tatoateaies t) rxo(o oodlmtnlnvi s)s2tm( ono1tee mi3ilsla2emumo t4aexrifcoo1fa   u ilt0s2uoxopiydoptemivtl(faDtrump;t1ope iieiadfa2el( p;u) rtnxrciadop rluvslt0teuoxm3oudalenmieiat  Dra(rpou1opxomi3iytfmDul( s u0tltomf iatom   i o t s2trxrpoo4ope  fciasf rra(m ou4ape mictatfaDuan on(4alenio3tadlpteaneo t0trxoxo nydapeemivia(faDrmu  ;u1oleo i3iatlsDua( ont4arerir3tydlate ueo;t) 2xoiopio1omtelfvtls)a2rau pno0opxniiciad aDeln pnu) eeoircootla rlneol( trtm(o3iydam emieilt)srtmx o;o1aexnioetltls2rmuvsnu0aeerxf3tydlat lu o s  eto(r3no1apen ivt (fa2rmu  nu1tle ioctlsfs em(vo;u0texnxo3oadfa rauvols)texrxr3nudaltn fei t)s2rrxr ;o0olenmieiytls rm(vs;t) rtrxo ta1lpt au o s srxoxr3ny1omt  ieia()a2tr(mp;t1tpenmoeiltls em(mpnu4 ltnmrcta1omt an ilt0trxrim oo1lpeemivsat)arra(mp;o0oexnioctas a2ulnvonu) rxnif3ootlaDr ieilt  etoxo3oo1lmtn nviat)s2taum nu0olx  oeiyd s2eaump u4tlxrmo3ta1laD lu s (0tetrxr nodlptemies t)a2rrum nt4altoiociyd m2ea(vo;(0 eeoxoctytfp e u i s) eur(m ou4opte fvs t  2urxmp;u4aptoioeiltlm2ua(mo u4trtnir3io1fmD luvslt s2xmxo ou1lme lnei ()sDtru o;t4tpe  octld s ra(mon(4 etrio3iatfpDeaueolt0srtoirpoo4lp nlfcsl(fsDta( pno4aetnio3tlsfm2rmnmp;(0aeeoif3iydfp elnvo;s0sruoxo3iu1olenlfes (  rrru pnu1alxo ieiatlm2uaumo;u0 rxoxo3oydlatrau sls0teumxrpiu1omt  iet s srtr( p;t4tlx moetadlmDumnvonu) exrir tatopDeai s () exmio3no4ame mivias sDua( poo0opt if3tld aDranmo;()trxomf3iotfmte uvs;t0 exmxm oodomeemfci tf rta(r ;o0tetoifeiatfm uaumont)aexoxo iydlmD  uvi;()t2umio3oo4opt  ieias)a2um(  nt1teenmicilsla um( o;t)alxnifcto1la e i sls0texrxo3oo1opee ivsasfsrum(m oo4olto f3iaslmDeln p;t4trxoio oa1fp  li o s)t2urio nydaleemict s) rrr(m ;o0oex ifetatls2rl(vsnt) ltnmr oatfmt  i s t trumio3nu4lpe mivils  rum(m ;o0alxnioeilt aDul(ms;u4 rxoxf3tatoaD auvo () 2xrxrpnodaptn fviltfaDrrxm nu1apeniictldls um( s u0alxrxrcty1om r nvsls0 rtoio oy4al  mfcsa(  Dtmx pou4aptnmociaslm ul(mp;u) etomf iodoptrlueo;s0 2tm(rpoudal  lfcsl(fs2taxr ;u0aex moetlslmDumn s;(4altoxrctydfmDr iei t0t2urim3no1om nlfcs t  Dra( ont1tlenifctys aDum( o;u) etnmo oatlmtrlnvi (  2tmir3nu1llen ncils sDraxmonu4alxnmictad mDul(vo;() rtnmrcia1oaD  uvi (0t2umxr3nydllt mivtatf ruaur nu1olt mfciysfs2el(ms t)areriocty1lpt aueols  exoxm3iu1omt mnciasfarumur nt4tlxomo3taslm rmuvs;(4artnifctytop   ieils) rumimpnu1omen net (fsrtmxr no4tle ioeilsfa emu pnu4teeomo oodoa rluvol(0s2trxm nudlmtn ics sfaDrrumo;u0oee mi3ilsfs2ranvp;t4tlxrir3oa1lm   ueil()s2uo(r ou4olt mics s srtmur ;u4tpe if3tys mDrmnmp t4trtomfctadom e u olt sruo(m nudlleelictat  rrr(m ;o0teen f3ilsfa eanmo;t)tleomoctadfptr ueo;t0teuo(m3no4amt lfctlsfa2umxr ot0apxn f3iasfs em(vp;u4tltnxr ootfatelivo;()srtoxr3iodlmen fesa() rrruro;o4tpeoifciysfa ulnvpnu)trtriocty1fm  lu i t0 etr(m3oy4lp  mnesls) Dtmxrono1aee  o3iatls umnmp u4arenio iydoaD aies;s0trtmio ou4am nlfvs ()s2ur(r oo4tpt  feiysla umu p u)trxnxfctytfpDrlnvo s0s2xo(o ou4lmt mneil( sDua(mooo1oeenif3tldfmDrl( o t0aeerif3todlmtr nes;t)setoim3oo1omenlieilt)arta(m ;o0tltnifetldlm2eanmonu4aexriocto1fmD auvs ()seuoimpnydam elfvi t sDumuro;o4tpt  f3iadfaDelu o;u) rxoxf oo1lat aivilt0s2xoxr nudop elfciltfsDrru oou4aetomoetydfs2ua(vonu) ltnmocoytfpDe uvs s)tetrio oy1omee icilt  2rrxm nt4tptn i3ilsfsDeanvo;u)tlerifcoadlm  lu olt sexmirpiu1lleelfctatf 2raxr ot4tpxomi3iyslm ean on() ltnxr3iatlptelnes;( srtrxm3iydom  mnvi s)sDumxmooo1oexnif3iatfsDuan pnu0 eenmr iatoptr ueo s t2tmir3io4op   ics ( arururo;u0opeo ieiatfaDemnvp;t4 etrmfcootfmDeanei;( trur(m oudlpe  fctas  rurxrono1oetnmoetlsfaDem( s u4arxomf ia1fm e nvi () 2toim3iy4am e nciatfsDtm(ro;o0aetn feiyt sDemuvo t4 rxoxf oodom rau i (0sexmxo3iu4ap elfeias srra(  nu0teeo ociat a2rl(ms (4arxrmo tytoaDranesls) etmirpoudal emivi s)aDrrxmont4oltn iciadlmDuauvon(4 rxrmr3tatlpt an s t)s2xo(m3oudlmtnmfciat srraum ou0opt mf3tatfmDrm(vont4texomfciadlmteai i (0sexrim3oydam nlnvia( s2uaumo;o1oleoifeias s2umnmp t0 etnxf3oadoaD anvs;s) eto(rpio4om emivsls a2tmx oot4aee  oeiytfmDumump (0tetoxo3iadopt an ils0t2xo(o ou4ope mnet ()aDtrump;t4aeto o3tadfm2rm(vp (4texoxr3totfm eau sl()t2tr(r oy4aptnliciat)sruaxmpou1opxnmi3tyd s em( sn()tleoio3totoaD  nvils) 2urxo3oudap nlnes (fa2uaxmo;t4texnmoctltfaDua(vo t0aexomo ta1oaD livolt) euoir3iy1lptemfesa( srtmx o;t1tpx  o3tysfsDuauvon(0 rxrmr oodfpt lueil(0tetmio nydapee nvsltfsrraur no0tex iieiyd s ulnvp;t)aeermo3totfpDrai sls0 rto(opoydamtnmnvt sfsDrmum oo1apx ii3iatfs rau s u) renif tydfm eaiei t)t2xo(r iu1lm  lncslsfsrua(mpoo4tpt iocilsfaDul(ms (0aexrxr io1fmtrlieil(0s2tmxmpiu1ale livsat) Dtm(mpou1tlen fciatlm2rm(mo (4 exoxoctatfmtrlieo t)srxmir3ny1lmtnlietls) 2raur ou0olx  ieildfmDeanvs u)areoxociy1oatr nvo s  rum(mpiydapeemnetlsfsrumur ou0oexo i3tasfa uaump t)tlxrmo oatlpteau i;t teuoimpio1ol e fcsat aDtrxrp;t4tlxnmociaslsDumuvo;u4trtnif iatfpteauesl( s2uoxo ou1apen nci ( arua( p;o4tleo ieiydfm eau s;(0arxnmo3iy1latr iei;( s2to(m3no4ll emicslt) rurxr nu0opt mf3iltlmDemu s t4arxnmo iy1oatean s;()setrirpiodome  iesl(  2uaumoou4apenmf3tldlsDuaumpn() rerif iytlatrauvo ( t2xo(m3nu1lmte feiasfarrrx  ;o1oeto ieiatfsDuaump t)altoxr3tadfatr iei;s  2xoir3no4amee fvtas srrau  ot0texoiieiasls rmu s;u)aleoio oodlpD aivo;()tetriopny4lmeemivsas)aDraxmpot4oexomo3tltlaDrmuvsn()aetnxr3ta1lpD au i t0srxr(m3nodale  iciat)arra(mont1tle ii3tad s uln p u) rxrifctydlmtrln i;(0texmir3ou1ol   fvilt  rtm(r no1tleomfcilsfaDelums;u4alxnxr3iotlm eau o t0t2xoimpou1lp  lfes s)s2ua(  no4aeeomiciad m el( s;(0altoif3tadlmDr n i (  2to(m no4al  liesltfs2rr(ronu4aleomfciltfa uanmp u)tetoxo3iodlpDrlu i;s t2xm(r ny4om emncsa(fs2taxmp;t1opxnmicils aDem( pnu)tetoxr tadom r iei (0s2triopio4am e ieiat)sDumu  ;o0tetomicilslm2ranms () rxrir ta1opt lies;t s2toxrpiy4amtemncias)arur(mo;t0tleoio3tatls rl(mp;t4alxoxrcoydop rlu i;()t2trir nodope mnetat)srrmuro;t4tlx ii3tadls rmnms t4tlxnmr3oy1lmDe n o t s2urxm3oo1optnlnesls) 2trxmpno4olxo ietytlmDelnmo u4aexoxo3tydfm r ieolt0 2tmxr3oydal  mnetlsf 2raxro;t0oltoioetad aDel( snt)arxomocoytlp   ueolt setrxopnu4oltnmivias)srtm(ront4ape miciyslmDul(mo u0areomrcootlptelu i;s0 exo(o3oo1al emneia(f 2um(r ot4tptniictyd m2uanmon()arxrmr3iytopt an s;()s2tr(m3ny4al e iesl(fsrumum ;o4oee  oeiys m elu p;t)trermo iodom  anvs;t0sruo(rpio1alee ivi sf 2rr(r oo0apeo o3tlslmDemn p;(0 leomrciy1faDeai sls0trtr(rpiu4alenlncsa()aDur(ronu4tltomociysfm2rlnmo;u)tlermociatfaD  u o;s  2umxr3iudolte fviasf 2tm( o;t0tlxnmoeiyt m ra(mo u) rxoxrcia1lmt aueil( t2tm(mpoodll   neia()srumxm ot1tlxoiieilslm2eln o;(0tlerxf oy1op  li il()texrxopiy1ol nmfvtas) rtmu  ot4aee ioeiytlm eau o;u)trxnmr iotfm  anvi;t0 etoxm3oodalt  fcia(f 2tr(r nt0oltomi3tys aDrm(mp (0aexnmr3ty1lm   ivi;s0 etrxm nu4alte nesas  2ra( pnu0aet  feiysfsDrlnmo u)aetrxo3tadoptr iei (0s2xoxrpiy4lm  livsl( sDtmu pou4oexnif3iytlm eanmo t0tetrir3tytop rln i;t)seum(m iu1lpt mieiat)aDur(rp;t4oltomfetldlm rl(vpnu4alxrxr3totomtran ilt t2tmxrpiu4optnmivtl(f rraxm no4aeeomiciltfs2ulnvpn(0alermr3iatomDr u i ()t2urxr3nudlm  mfetls)srur(  ;u0tex  ietltlm2ulu o t)artomr tadoatelu o (  2ur(r oy1aleelnci t)aDtrum oo4tpeoiociad m2rl(vp u) rxnmo oy1late ues () rur(rpoo4olee ncta()s2rmu  ot1apxn i3iad s2eluvpn(0 lenmf3to1oaDeau ilt  rxm(r3ny4lle mncsas  2urur nt0tet  ociyd aDumuvpnt4arermfctatlm raiei;s trur(m oo4omt mnctas)sDua( p;o0texn fciysfm ranvo;u0 renxociadlaD auvo t trxrxm oo1lmt lfvi s sDtau o;o0tpto i3ias mDemnms;t) etomocoydfmDelnei t) 2trxo3nudlle mneil(  Dtru  ;u0apeo iciys a2rmums;(4treoircoa1om rli sls0trxo(m iy4lp nlics t) rrm(  oo1apeo iciadlaDrlu p;u0aexomf oo1lmtr nvolt) rurxm3oydlptemfetas)s2tr(mono0oex mfctltla2uanvont4artnmrciy1lp e uei;s)setmimpiy1omt  fes t arrmx  ou1alx  iciltfaDel(ms t) etnmf3totlm  anvs;s0 etriopiy1alenmfeilt) 2trur ot1aet  ociysla2ulnvp t4 eenxocoatfatelnvs;()setrio3nudll  lict (farrru p;u4oeeo ieiaslaDem( p;u4alxomf3iy1fp rai o;()trtoxrpny1ome mfvt s) Dumu p;o4ole ioctltls ulu s;t0aleoir3tadomt livi t  eurirpou1apee ivs ()aDtrxr ;t0oltomfctat a2uluvsnt0trenxfcoy1opDrlieo;()trtm(m3nodolte nvi () Dtrur no0open i3iasfa2eaumo u0teeoiocoodfa  auvs (  2xmio3nudolen feta()aDur(moot4oltnmfetls s2eln p u0trtnircta1lmteau i;s0t2xoxr ou1om n ncias)s2uaurpnt4tet ioeiaslmDum(vp u4arenxo3ootfm rlivo;()t2toxr3oy1lpenlneiat sDuax ooo0tptomiciytfm ulnms;t)arenmf tatfa rlivi s) 2to(m iudope  nvtat) 2rru p;o0alt mietldlm rmn snt0texrxfciadfpDean s;t0s2xo(m3oo1lm  lfvi s)srrm(m ;u4tpxnmfctyd sDelnmont0aetrxrctytom  aneolt) rtrio ou4olt  nci t)s2rmxmpnu1oex  feiadlmDem(monu4arxrxfcto1fatelues;t0trxr(r3oydal n fct (faDua(mpnu1apxo f3iatfa2ulnvp t) ltrir iydlmD au ils0t2tmxm ou4olenmnviltfarurump;u4tpxnmoeiad s2rmuvsnt)trtrxr oodlmD  nvo;s srtrxrpnudolte ivtlsf Dra(mpnt0aetn feildla rlu p;u4alxoxocoydoaDelnvi;( s2xr(rpiy4lme  ictas s2umxr ou1teen o3tlt sDuaumo;u4 reomo totfaDeanes s) rtoxo ou4amenlictl()aruax p;t0tet iociasfa uauvsn()arenxr tadopDraneil()sexmim3oodaltnmics (f Draur ;t1oet iociyd mDrlumonu0 leoio iatoaDeli slt trxm(mpny4lmtemiesls) 2um(rpou0olxniictyslmDuluvs;t4texrxf3oatla e nei t)srxoim3oy4llte nes (faDrmxr ;u1ole iictad a rm( o;u)altrxo3tatfp  lieolt)s2xm(o nu1olee nctlt) rurum nu1olto oeiyd sDraumo u)alenifcio1fmDe ieilt0 rtoxr nudlmenmnei tfsrra(rp;u1tptoifeiaslm rmnmp ()tlxoir3iadlm rlu slt t2xmio nu4al elncs tfs2uaxr oo4olenii3tld a2uanmpnu0aeermfcootom rlu ol()trxrir oy4apenlfctas s2rmuroot0ole iieiadfaDemuvsn(4aetnmo todlmD  iei ()t2ur(m oo1ope micta(fsrtaxmp;t4oleomo3iysla2eauvo t0artnifcoa1lp raivs;(  ruo(mpnudlmtn fei tf Dtmxr ;t1openmoctatls2ul( pn(4 rtnmocoa1fa  aiei;s srtr(opnudapt lieilsfsDraur ;o0alxnmfeias s eln o ()alerif tatomt  nvo s  rurim3nudlptnmnesas)srtaxmp;o0tptoiietysfsDumuvsn(0areoxrciodfm   nvi;()s2xr(mpiu1om  mivia() rua( ooo4opt miciltfa elnmsn(0 lermrcia1omDrlivsls)texoio3oy4omenmfesltf rurum nt0aleo i3tadfs ea( s;t) lerxf3tydoate uvs;(0 rurir nydam nmnvs t artaurpou0tlx  oeiys mDemuvp;u4 lxrirctodfpteaueo;t s2xoirpiodap   fciat aDra( poo4tlenio3tydfs ul(vpn(4 lenir iy1fatrln i s) ruo(r3iudlp n nctasfs2rmumo;u1aexn ieiadfsDra(mo;(4arerio3tytoa  aneo s) rur(r3iu1om nlivia( a2rru oou0apxnmoeiyd s2ul(mpnt4aleoxr iy1lpDraieo t0trxmxm3ou4lpee ieilt) 2tmur nt0tex iiciltfa2elnmo (4artoxrcio1fpD li i ( trtrim3iu1oltnmivta(  rua( p;t4ale ii3tyt a2umu p u)aetnxo3iy1opt  u s;t0sexmir oo1amen fciat arrr(mpno4tleo o3iadlm rmuvsn(4 exomo tatoaDraueils seto(opiy4lp n neia(  rrr(  oo1opto fcildls2rlnms u0trtoxrcoo1optr ieslt)texr(m3no4ome lfctatfsrum(roou4alx moetasfs uauvs;(0aleoio3oytfpD aneslt texr(o iy1ap nmnesatfaDrm(m ;t4apxnmi3tls aDrlnmo;t0aeenxo todlmDrau o;t s2xmir3ou4lltemfvil(fa2tax o;t1tpe iietls mDrau o;t)teenif tatfmte uvo;s)s2tr(o3iodope livilsf Dururpou0optomfeiad s eanmsn(0 renxo3oodfatrlnesl(  2umir oo1olenliesls) rtm(mpot1ole  o3iasfa ua(vsnu4 renifcoadfaDrauvi (0 exoxopoydal  mfeia()srtaur ot1tee  fctatfa2umn s;() exoxf oa1omDeli il()t2xmirpny1ol nliet (f 2ua( oou1tetn i3iysfsDemnms;u)trxnxrciytla   uvolt)s2tm(m3oo4ll nmncs tf 2uau ooo1tee mociysls2umuvp u)aeeomfcia1oa eluvilt)seuoirpnodom nmictls sDtr( p;o4opt ifciydla ra(vo;u) lenmfcio1fm e neilt)t2tmir3ou1lltnlict sf rtmxmpot0optnmf3iytlmDua(ms;u)arxnxo3tatlatelueo;t) 2xm(m3oy1olenlfeil() Drmur ;o1tlxn i3ils mDrmumpn(4texrxo3iatfat  ivs;()tetrxmpiu1omenmfetl( sDraxm ;u0tlxnmf3tysla um( snu4 eeoxo io1lmDe uvs;t teuoio3io4am nlivil( arrm(monu0ope  o3iys mDuanvs u0tetoxr3totfa  an i;(0teum(mpnydlltelfei t a2raur oo0aeen o3ildla el(vs (4 lxoxr oadopt lnvo s)trxmxrpnodap  livias)s2trxm oo4oet  ieias sDelums u) eeomr3oatoa   ies t0 rtm(o ou4ap e fvslsfa2umxrpot4aeenmoeildfmDua( p;(4trtoir3oytoaD lies;()srxmim oy4lpeemivs s  Dtrx p;o1tlto o3iytla2rmu p t0trxoif iodopDr i s;s  eto(r iy4lmt lfctatfs2tmx  ot0oeeoiieiatla2ulums ()aetrmrcoo1lpDr nei;() euo(r3nydlmeelfei t sDta(mo;t1ape ifciadfm em( onu4arxnxfcio1faDeaneol() 2umiopnydol nmfetltfsDuaur oo0alto i3iydlmDra(vo ()arerxo oadlatrluvo (  etrirpnu1ape  ncia(fsDtru pou0olxomieils m el(vpn(0tlxoxfcio1lp e nes t0s2tm(opnu1openmnci ()aDraurono1olto oetydlm2eauvp;u4 eeoif3tydlmteaneo;( srtoxr io1omt  icslt  ruaumoot1apx ifetld a2rl( o u4artniocoatfm e nvs t0trxoio oydoptn feiasfs2rrump;o0opxnifetltla2uauvs;t4alxriocoatlaDean ils)srurirpoy1ol n netltfsDrmxmp;o1oexoiicias a rmuvs;t0aexnxrcoadopteaivol(0s2xo(o3nu4op emivs t sDta(mont4oexn i3iatfm2ulnmon()artoifciodfp eaues s0tetoiopny4op elnci tf rrmum ;u1oetomfctld m2umu snt0 exrmf3todlmtrai slt0seum(opio4amen ncias) Durx p;u1tlt io3iltfa ranms;t4 lermocoydlat  ies (  2um(rpoodoptemnvt sfaDraxmp;t1olen feiydfa2ulu o;t4areoioctodomDr nvi;t) euoxm3io1omt lnci t)s2uauro;o0olx  icias m2rmumpn()tlenir3iatfmD lueo s0 2urxmpiy4amt mnvtasfsDta( pnt4apen fctadfmDul(vo ()tetriocto1lm rlueo;t  eur(mpou4lp   nei t)aDrmumo;o1apenifeiatls2el(vp u4 lxnmo3io1fa r ueils srtmxopoo4llen nei s  rua(rpou4texomieiydla ra(vo t0 exnxf3iatopDrli s;(0 exoxr3ny1apeelfeta() rta(  ;t1tlenii3ild mDrmnvp;(4aetnir3oo1fpte i i (0texriopnydap nmncia( sDrau pou1tlt iiciltls eanmo;u0arerxo3oytfaD  ueols  eum(mpoy4optemncs sfs2umu ono0tpxnioctltla2el(vo;(4 ltrxr tadfmtean o t trxmim io1amenliet ( s2rax pou0apeo o3tadfm2uan snt0tlxnxrciadfm  lnes s0t2uo(o3nu1lme lfet s srta(mpnu4oexnmietys m ra(vo;(0trtoir3tadoa   n i s) exmxr no1lmen ncs ( aruaumo;u1apxoiocilsfsDul( s;(4tleomf oy1fpDe nvs t0trxr(o3iy1amen ictat)s2ur(rpnt0oee mf3tas m2emu s;(0 rermo tadfpteliei ( s2tmio iu1ale  feta(fa2rr(r ;t4aex ioeiaslsDrmu ont4 lerxfcio1fmD liesl( setr(m iydal n iesl() rrrx p;t4aet ifetls m rm( o t4altomr3iy1oaD aueils  rumir3iy4lmtnlfetlsf 2ua(rono1aexnmoeiydla raump;u0altoxo3oatla   ieilt  etrxo iodome  ncia(fsDtaumont1teenmo3tyt a ua(mo u)aexnif iodfmD anei t)s2toimpio1amee fviat  Dta(mo;u1apeniociyd m elnmo;(0tlxnxr3totlpD  nvi;s0srxo(r iy4ole  nvs tfaDtr(  ou1ape ifciyslmDra(mo t4 etnio3iydlmDeluei (0s2tmir3iydomtnmnvtat artru pot1tltoio3tls sDuan p;()teermf tydfa rlnes;t sruo(o3iu4lmt lict sfsrraxmpou1opto fctyt s uanvsnt4 etnxr iatoa elivsls0teumimpoy1apeemfvs t  2rr(m ;u1tpt if3tas s2umu s;t) rtoxo3oo1lpDr ueo;()t2uoxm3no1lp n fet (f rtrumo;t0oltomicilslsDranvo;(0tlxrxo iytfm rau ilt t2trxr iodoltnlnetasfa2uau p;u4oeto i3tlsfa2ranms u0 leoio3tadlmD lu ols0teurxm iodaptnmics s arrmxm ou0aeto f3iyt a rmn p u4texrxf3oatomt aivi;t s2uoxo oy4ll  lfcia(  Dtrurpou0tpx iieiat m2umnvs;()alxrmr oadoptr nei s)t2urio3nodlmeelnesl( s2rrumo;o4aeen fciadfsDumumsn(0 lxrxfcio1opD auvslt0trxr(mpiu4lp elfesas)a2taum ou4teeo fetys s rluvs u0alxomocoydfa   u s t  eur(r3oudopt lnetltfa2trxmp;o1oexoif3iydla rm( pnt)tlxrmf3iotoaD lieo s trxmxmpoo1openmfes tfsrtax  nu0opeomf3iatfm emnms;()arxoxf3tytlm r nei s0srtmxo iodamtn nes ()srrrxronu0apeomi3iys m ulnmsnu0treriociotla  ai ol()trtmxo oo1al emivtlt) rraxmp;u4oex mfctlt mDea(msn(4alerio3tydoaDranes;s) rtr(m3ny1optnlnvilt sDrm(mpot4oeen ieildfm2ua( pnt0teerir3iodlmDrlueslt)t2trxrpoo4lpt mfvsat srrax p;t1ale moeiysfsDrlnvp u)tlxrirctadfateli o;s s2xm(o3nydlp   nvtatfs2rau pnu4tptn ictysfmDeaump (4 lerxo3oodfpt aies;(  2tr(o3io1lpte fcia(fs2raxront1aptn feilt mDranmsn(0arerxfcty1latrlies;s0trxm(rpoo4aptnlicsa(fa2umxrpno1olenii3ilslm ra( pn(4 ltomocoatopDeauvsls) 2uoir oo1ape  fet (fs2ra(  no1aeen ieiyslm um(von(0trxnxrcoydfptelivsl(  rtm(rpiu4op nlivia()a2tr(r ;t0apxn iciydlsDean p u)trerxfciytoa rauvols0trumxmpny4optemietl( s2rrxroot4tptn feilsfaDrl( sn(4areomr3iotoaDrau i s0s2xoir iy1am  lncslt s2tm(  ou4tpxoifciat a2umuvs u4trxnifcio1lp e nvs () 2tmio oodal nmfvtatf 2rr(mo;u4olxo iciyt s um(mo u0altnxrciytlpDrlieo s0t2trxrpnudlpt mnesltfa2rr(mont0oee  o3ias s2ul(ms u4tlxoxr tydfmteai i (0t2xr(o oudope lietas  rururonu0tle iieiyslm2ean pn(4 rxnio tydlaDe ivo t  rtr(o3ny4lmee ieta(fsrta(m no0tlxn i3iatlmDul( p u)alxoxoctytfateau i;( sexoxrpnu1am n nvias)sDum(r nt4olenioetadfmDrln pn(0tltrio3oatfpte u s ()t2to(mpio4alte ies sf 2umurp;o4tee  f3tas m2ra(ms u4texoirciy1latelnvo;t t2xmxrpny4oleemnet sfsrtr(rp;o1aeeoiiciytlsDea(msnu) etnio ootlm  an sl()t2uoxrpno1openliet t)arra(mpoo0tex iietatfmDuanmsnu4aetrir3oa1op  lieol(0 rxo(opiodlm emnvsas)sDra(mono4opt moeiydfaDem( s;t0alxnmo oy1lat luei;t t2umxopou4omeelnci tf 2rru  ou0apto oeildlm ulu s t0trxomfcoo1fatelnesl()sexmim ou1lmt mfcsa()srururono1tle io3tltlsDrluvsn()aetomocia1la  lu s;s0 2urio nudamt  nvt ()srrmxm ou4optniicild a2rmn p;t0 rtrif iydfptrlivsls0 etoirpny4ap n ietls  2urumpnu1altnmieiat aDrau pn(0teenmfctodlptelu s;()trxm(rpnodap n fvils srururont0oetoifetaslaDuaumsnu0artrxr todlmt luesl(0srurim iy4ame  nvslsfs2tru  nt0opxnii3iaslsDuauvs;u4tlxnxocto1optrluei;(0srxoxo3oy1olt lieiatfa2tmuroou1aptnmieiydlsDuanmp;t)altrif oodfp  lneilt0srtrxr3nu4amenlneta(fsrtr(r ot1olen f3iydfs2ranmpnu4trxrir3iy1fatrlueolt)setm(o iu1lmte iesl( s2tmuroot0aet mieiydlsDra( ont4tlxoir3tatoaDr neo ()trxmxo3iudalte ies sfa2rr(mpou4oexomi3tlsla2ul(vo;u4tetoxfcta1fpDelueo;s)seur(r oo4ope mivtatfsDtauront4oeenifciasla2rmn o;()tltoio oy1oaD ln sls)srumxm3no4om elfcsltfa2ra(m nt1tet  iciytlaDea(mo;(0 lenif oo1opD  ieo;( s2tmxmpiydomeelnvsltfarrrxr nt4oexnmieiad a2umuvpnu)aeeoiocio1oaDr n o t)sexrxm iudop elivsls) ruru p;u1opt iieildlmDrl( onu4tltrxr tadlaD anvi s sruoxmpny1lltnmneias arum(r oo0alxn i3iydfsDrm(vp;(4 ltnio3iodfatr nesl(0srxrxm3iodamtnmnvtl(  rrmx oou1tptoiocilt s2eaump;u)tetrircio1fa rli o;s0sexrir nu4lptemfci tfarrmu ooo1tle  feildfm umump t0 lxnxo oatoptrai i;t0 rurio3nydaltn nctas)sDum(ro;u1olxo feiltlmDemn snu0 lenxf3io1fa rln s;s0srtrim no4apee ici s  Dtru p;t0apenii3tld m elums u4 lxoifciotfptr uvs (0trumxr oydam   ici sfs2trxmpou1oetn o3tatla2umuvsn(0 lenmfcootomD aneils seuo(m3iodlle  ncil( srrrx p;u1aleoif3iltla2rlnvsn(0aexoxfctadoaDeli slt  2uoio3iydop elneiat sruax ooo1ape  oeiltfa rlu pn()trenxrctytfptrlivs;( trtmxr ny1lleemieiatfs2uaxr ;o0tlx mo3iadls2elnvs t)areoxr3iotfatrauvi;t) 2trir3io1ope  iesasfsrrmxmo;t1oet  fciltfm2el(vpn(4texnmr io1op rli il( srxmxo no4optemnctlt)srua(  no1oetomfeiys s rl( p;(0trtrxf3oa1omtelies s s2xr(mpiudomt lfvsas sDtr(r nu1oee ifcilslsDua( o;u4tlxoio ty1lmD aueols0 rumir3iodop emiesltfs2rax  nu4apto fciysfaDra(mp;t) etnmo3tydoat livolt)texmxr oydamte ietl(fsrtmxr ou4apx iicildfsDrmnmo (4arxoxfctadom  liei t  exm(rpnu4ameemicsltfarraum ;o1oetnioctys aDumnvp;u)tleomo tydfa r ies s  etmxo ny1ome lncsa(f 2taxr ;u1aee iieiad a uanmpn()aleoxr3iy1op r i i t s2ur(m iy1lpe mfcs ()sDtm(mo;o1apx moeiadfa2ra(vs;u4 lermr iydom   ivil(0s2tmxopny4ome  ictls)artax oot0oleomi3ildls2elnvo;u)aexoif3ty1latraieolt) rxmio3oydll  mfctatf ruaurooo0aetnmociadla elu s t) eeoxf tytlm  lies ( srurxmpno4amte nciat)aDrmuro;t1tpe iieild s em(mp;() leoio iytlat auvs;s)srtrir3io4al e icsat)s2taxmo;u1open o3tasla2elnms u4 rtrxf tydomteli sls0trumiopny1apen ictltfaDumumonu1tlx  ociasls emnvp t0tltnxr3oa1lmDeaneol( t2trio nydamtnmfvi t)artax p;u0ale mfciyt aDran s t0tlxrxf oydlmtelu ils)trtm(opnodop  micslt  Drm(r oo0oeen f3iaslsDul(mp;(0teerirciy1fmt  i i;( srto(opio4olte feias  rtaumpno0altniociys m rln p;u0 etrmr io1oatrlnvi;() etr(r nodolenmnvtlsfaDtrumpoo1aexomieiaslm ua( onu4tlxnir oytoat  ieil(0 rtoir3oo1ll e ivsasf Dta(ro;u1olxnii3ils m ul(mpnu4aleoxo oytoaDran o;t0srurxm3iu4ale  fcsl(fs2rmumpnu4oeeomiciytfm2um(mo;t4aexnmr iy1lmtean ols srtoio io1ol nmnet ()arua(  ot4oetnmo3tyt aDul(ms u4treomfctodfaDrln i;(0seto(r3oydome mncs s s2rmxm oo1alxnmfctadlm2umnmpnu4trerxo iadlpDe ies;(0srxoxmpiydopenlfvs sfa2umum ot0tpe  o3tysfa el(vp u0texoxo iadlmDeaiesls)t2trxo3ny4lmt mict (farrmxmp;o0olx ifeiysfa2umn p (0tlenxo3tatfatrln ol(  rxm(m3iy1ale mnvtls)arumxmpnu1altoio3ildls2rmuvonu4tlxrmrcoytopt lies ()trumimpiudlmenmivil( srtm(mo;t1tpxnii3tlt s2em(vs (4artrmf oadfpteaneo;t sexoim oy4opt lictl( s2ua( ooo4tlxnifetltfm2uaums t0 rxnio iytopteaies (0tetr(mpou4alenlnvi s) rta(  no4ale ioetysfs ua(mp;u) lxrxfcoytfpD aivolt) rumxrpiudame lfcils s2tr( o;u0apx  f3iadfa emums;(0 rxnif3oa1opD anvs t  etoim iydop e nct s srra(mp;o1tlxoii3ias mDemnvpnu0aeenmo oa1oa  lu s s0teuoio3ny4openlfesat a2ta(rp;o4optnifetyslm2ua(vs (0 eeoir3oytfm r ieilt)trtrxr3ny4opeelieiatfarua(rpou4tet ifciyslsDuauvo;u)tlermr3iytfpt  ivil(0 2uo(r3oudamen fctat aDraxro;o1aptnmoeiatlm2emnmp (4trxrxfciytlp r u ols)s2xrir ou4amee nvia( srtru pou0oet miciasfm umumpn(4 rxnioctadfateliei s0t2tm(opoodap elics sf rtax  no1tlxnifctatls rm(vs u)trxrir ootlmDrluvi;s)setoim oo4op  lict sfsDuauro;t4olxomociasfa eluvs;(4 rerxf oadfaDe ues s) ruo(o3ny4omenmfcta( a2rrxrooo0opxnmi3ildls2rluvs;()alermo ia1faDrlivs t0srxoxo no4ameemies t  Dua(rono1oexnioeild m2emuvpnt4tltnxo3iytlmte n o s) 2trxr iy1optnlivsasf Duru pou1aeenmfeiyd m2eanvp u4 ltoxr3oytoptraivslt0sexr(o iy1altnmics sfs2rr(r no0olxnmiciad m2uau p t4altrxociy1op  luvo t  2xo(o iudllen ies t srraurono1oleoifciys a2rmu o (4 eenxr ta1om  aies;(0srum(r3no4lme  ivtltfsDraxmpnt4alx ifeildls2rlnvonu) eenxf3tatfaDrln o;()t2xrio iu1oltelnvs (faDur( pnu1aeeniictldlmDrmuvo;u) lxrmr3tydomt luvs;t)truoim ou1optemfesa( sDra(mpou0tlto i3iyt s2ulnvs;u0aexomf3iodlaDr ivo;s t2tmxo oo1llt lict tfs2trum no0oetn ociysfa2uau sn(0alxnifcoo1omD aueils0 rxrir ou4opeelnvsl()s2uaur ;t0ole mfciyd s ea(mp t0altnxo iy1laD anvils)seuo(opoo4ame mici s) ruau onu1oleomictldfsDranmo (4tlxnmo3tydfmDrlu s;t0t2trxo3iy4llt livslsfsDur( pnu4teeoiiciaslm rauvsnt0 lxnxr3oydoaDrai ils0s2trim iy1ap   nvsatfa2uau o;o4opeomieiydfs rl(von(4artnirctodoa ranvo;( trtoir no1lme  fcias) rtrump;t1tle  ocildla ulnmo;t0aetnir iadlaDrlu sl(0t2tm(o no1opeemnvslt s2taurpnt0alxoifetydls elnmsn() lxrxr oodfpD  neol()s2um(opnudomeelfvsas sDtm(rpnt1opx  f3tydlsDrln p;u) ltomr oo1fmDe ivs;t)s2xm(mpno1om   fctlt s2tr(moot0tpxn octlslmDrm( s;t4aexrmf3oydfmt  iei ()srtm(opiu1llen neilt)arumxr oo4opxnif3tadls2uanvs;t4alerxf iy1fmtraueslt0seuoirpnydlm nlnet t)srta(rpnt1alxn feiad a2ulu s;t) lxnmfcoa1optr u i;t0 eurir nu1al elivt ( aDua( onu4texn o3iadfa rlu sn()artoirctydfaDeai ols t2xoxmpoo4omte ivia(fs2rr(ro;o1tee mf3tatfs ul(vs;t4tetoxo io1laDelnvi (  rtrxrpno4llt lnct sfs2uax ono4optoioeiadla rl( o t4 rtoxr3iodfmD lues;s0s2umiopnu1lpte ivi t)a2tax ont1apxoif3ils m ra(mo t)aeenxr ty1la rlu il(0 rxmxm nydlpee ivilt  2umur oo0aeeoioeiyt a2emuvs;t0tlenxrciatfatelivs;t0setmxm iy4ame  netasfs2tmum ;o1aetn ociytla rl(ms (0trerio oodfat auesl(  rxrimpoy1ome mnci t)sruaurpnu0tlxnioeiatlm2ra(mo;() eeomr3oydlmte ues;s0trtm(r iy1llee ieslt)s2um(m nu1apxomieild aDua(ms;(0 eeoif oadfptelneo;t)trtrimpny4lleelnvsls arrm(mooo4tee if3tadls2elu o u4 renxr3iodlp  auvi;(  etmxo3no4altemneil(fsrtm(mo;u1olxn o3iasfa raumsn(0 lxrxr ty1fptrau i s setr(r oydameemfvsas sDtmxmp;u0aptn f3tld a2rmu p u4 lerif iy1lmt an s;s0trxo(o o
\ No newline at end of file
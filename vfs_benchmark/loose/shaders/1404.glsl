@@ -0,0 +1 @@
+nesl(0teurim oudam  mncsls)srtr(rooo4opxnioeiytla2el(vsn() etoxo tydlateaieslt0sexr(m3io1ap  mfci t  ruau pnt4aee if3iadla2ranmpnt0tlxoir3to1omD aivo;(0s2umxrpny1amtn ies tfsDum(mpou0aexn icildlaDrl( s t0 rxrxr totlat aueolt) etoirpny1am nliesa(f rraur nu1altnif3iltla2el(vo;u)alxrxo oy1fa   i i t) 2xo(r3oudlpe mnviat  2rr(rpno0tlx ioctldlsDrmnvp;()artoxf oytomDeaivilt) exmxr3nu4amte neias  Draurpoo4apxniictlt a2ra(ms t4alxnxocoatfmteanes;s)trtrirpou4optemnvi () 2tr(ro;o1aptoioeiytls rl(vs t4tlxnio to1fa ean sl(0t2umio3iodalte nvs s arrmu pno0tpx  ociytlaDeluvp u0tlermr oytfpteaneolt)teum(r nydolen icsltfs2rmxrpnu1apxoio3ilt a em(monu) exoif3ia1opDrlnvi;s  euoxm3iudamtemfet s)sDrrum nt4ale iieiad aDrm(ms u4altrmf3tydomDr nvs;(0 rxoxm3iy1opeemneslt srrru  oo4apto oetatlmDrmuvp t) leoir oytlaD  ies ( tetriopnu1op  lfet t)aDtr(rp;t0alx mfcils mDul(vsnt0teenif3tydfpDe ueol()t2tmxm iydal  lnei t  Drrumooo1oee  feildls2ua( s (4altnircoa1fm rlies;(0setmxr nodllenlfes s  2uru  ot4alxnmocilsfmDemn onu0tlenxo totfa  luvo t)srxrio3no1altelfvi sfaDtrxmo;u1tpxoioctasfm2um(vo;(0arermoctydlm rlueslt0trxrimpnu4amenmnvilt)sDtau o;t4tltnio3iytfa2ran p t4alenmf tytopDraneo;(  rumimpny4ome  nci (fs2ur(mont4oeenmoeiadfa em(vonu4 etnmrcoodfmDr ieol( setm(rpio4llt mnvtlt) rrrx ono4teeoiieilsla umums (4trtoxrctydfmtrlivs s s2tr(mpou1lp nmfct ( arumxmp;o0tex moeildls uauvo;u)tleomocoytfpD lieo s0 rurxmpnudom nlnctl(f 2urxm oo1oeeomoctadfa uan o t)artrmo3tatlmD lu i s0 ruoxr no1llenmfvs s srtaxm ;t0aexnmf3tyslmDuanmont)aeeoxr tydomteliei;(0teuoim3io1altn feta()arurxro;t4oetniictadfa2eanvont4 leoxf3io1omD aneo s0srtm(mpou4lmenlfvtlt aDtmu ont0tlxn feiys s2elu o (4 eenxr3ty1fm rlnvils) 2ur(r3oudapeelfesatfsDtmxmpno4oee  ocilsfs umnvonu0tlxrio oo1oa ranvs;()teurio nudlp emfcsa( srua( pot0oeeo fetatlmDrlu onu)aetomrcia1lpDrai s ()trxmiopiydapt  fetlt s2tmxmpoo4tlt mi3tad aDumuvsn(0teeomociy1lmteli ils trtr(rpio1ol e ivi ( a2rmx onu0tpen ociyslaDrln p;t4aetoio todlmt  u ilt tetmxm3iy4ap nmfct s s2ururp;u4altomieiad m ea( o t)trermocootlp  ln s ( srurio iodaltemivias)arta(r ot1tet ifeils sDul(vp ()teerxociodlptranvs;() 2ur(r oodol emnvt (fsDrax ooo1aetoif3iytfsDrmnmpn(0aexrxrcta1faDeauvo t)s2uoxo ny1ale mfeta( arrmxmont0aexniocias m ua( p;() ltoxf3iatfp eluvs;t teurxm no1opt lfctlt a2trx  nu1tpxn oeiydfs2ul( pn()arerxr3to1lm r nei t0 rurxrpoydolenlietat  Duau  ;t4texn i3iltfa emn o;u) lerifcoodfm eluvo ( teuo(o nu1llt  fesls srrau oot0tpeo feild a2ul(mpnt)altoif3oa1fm r u ilt  exrirpnydlme  fcta() rtaxr oo4oleomocils aDuan p () rxoxf ta1lmtelivs s trxo(mpnodllt mnvtat) rtrx o;t0tpeomiciytls ean on()aexrmf3oo1lp eau i;s0t2xm(o3ou1lmenliviatfs2trx poo1texn fctytlsDrluvsn(4trxoxoctydlmteluvslt)t2toxr nydap nlivt (f 2tmurono4olxnmf3iaslm uanvont)aetnirciotla elnvols  2uo(o iudlmtemicsl(faDtaxmo;u1oex miciyt sDel(monu4 etnmrciy1oaD anvolt0sexoir3oo4aptn nviat)aDuru p;o0alto ociasfs el( p t0 lxoio iotfmDeau ols trto(m oydlpe mfvia() Duaxmpoo1olx ifciytfs rl(ms;u0tlxnmo oa1oat aivilt0 euoir iudlpee ivilt sDurxront0tee moeiltlaDelnms (0 ltomr oo1lmDelnvolt seumiopiy1oleelivilt) 2rmurpnt4tpx ifcilslm2umuvsn()alenmf oo1fmt  nvol(  exrxr iudol  lfci t  Durxm ou4alto octltla eau pnu0alenmo iatom  ln i;t)trumirpny4lpt mfcia() 2rr(m no4tlxnmieiadfm emu o t4aetomf3oytla eau ols0s2umir3no1ameemivtat)sDrr( pot4oeeomi3iad s2ranmon(0tlerxr io1lpt anvs;(0teurir iu1altn ivs ()aDtr( p;t0aexnmiciad a2rln snt0altrxrcio1fmDranvs;( srtmxm3nodllee fci t aDrax pnt4aetoio3iyt s2em( pn(0arenmr3oy1oa   nes;t trtrxo3oy1lm nlivtas)a2tmxmont4tlt  ieiys m2ea( s;t0 etoxo iatlpt  uei s0srtoir oy4lmenmncs tfa2rmu pnt1olxnioetltfs ua(mp t4arxoxr3iytla elnvils0 ruo(opio1llt lfcs t s2um(  nu1aeeomfcias m2rl( pnt4 lxnmr3ootlpt lneslt teuoim nudolen fct t)srtaur nt1optnmfeiaslm2rm(ms u)aexoxr3todopte u o;s0 2xrim ny1ame licsls) 2raxmpoo0openif3iat sDeln p ()aetrxociotomD an slt  exoir iydomee nvtlsf Dtrx o;u1tpt miciyd sDuau p;t0aetnmocto1fatrlnvslt  rtrxo ny1llte fesat s2trx pnu4tetn feiysls2ua( on(0 rermf io1op  ln o;t0s2um(opno4lptnlfet ( s2rm( ont4alx moctasfm rlnmsnt)arxrmf3ia1fmtr ivs;t) rtm(r iodap   icia(  rumxm no1tpxn feiltfs emu pn(4tetnxf3iytfmD li ol(0seumio3iudamenlneia()artm( oou0tpxoif3iad m rmumsnu0aexoxf3ia1omDrai i t0srtmxo3ou1om emiesl(fsrta(  ;o0olen ieildls2el(mp;t0trtrircto1fpDe n olt sexr(m no1oleemncs t)a2tr(mooo1aptoioeildfm2ua(msnt0arxrxocto1fatraneslt srxmxo oy1am emfctl()srta(m nt4optn o3iysfa umnvs (0 lxrifcto1omtelueil(0t2xo(m3iu4om  micsl()aDua(  nt1olx mo3ildlaDea(mpnu0 rtnxf ta1lmtrai i t sexo(mpiy1ol e fcsltfsrtrxrono4alen f3tlsfs2rln on(0 renxrcoadlpt aneslt t2to(mpoydap  mfviat  Drmxro;t4oex mfeiltls2em(vs u)artnmrctodfa elneo t)srtm(o3iudol emncsat)artrump;o1alxn f3iltla2eln p;(4alerxo3iodoptrlnvols  rtm(opiy4omee ici ()artaxr nt0oetnioetadfm2eln o;t) leomf3tadop e iei;s)teuoim3ou1lmt mfcs s)a2tm( p;u1olxoifetldlm rmuvp;u)aetnir3ty1omte n o (0trtrimpio1om emfei t) 2rr(mp;o1olx iociyt m rm( p u4alxnxr3tatfaDr u s;()srtoxmpny1al nmnciltfaDta(mpnu4oet  iciydfm rl( s t)aleoir3todlp rau o;s) 2uo(m3iy4om  mics ( arumumpno1tltoio3ildls ulums;t)trtoif3tadlptraneols setmxm3oydomeemnvtat)sDraumoot1oleomoetatfa2eanvp () leoxr3ty1fa  au s s  2xmxr3ou4al   ietas) Drm(ronu4altoifetydla emnvonu0texnxocoo1lp raneols  etmimpiy1open nei sfaDum(mont1oee iiciysfm2umu s;t)arxrxf io1faD an o;t)s2uoio3io1amtn fctls srua(  no0oexnmi3iysfmDrlu s t4texnxocoytlm e nvs;s trxo(r ny1apenlfvsl()a2uax  oo0oltoif3iysfm em(msnt4aetnmo3iy1fmte nei;t trumio oy1lmeemicsat)arta(monu4apt mieildlm2uan on() lxnmfcoy1fp eanvi;s0srtr(m ny4lleelnet (  rrmumpnt4opxn fctat a2ra(vo;()trxrxf3tatoaD anvo;s)tetmim no4om n net s aDua(rpno4oexo ieiadlsDuanmo;t0trtomr3oadla eln sls)teuoxm oo4alenlivia(fa2ur(rpno4tpeniicildlsDua(ms;t0 rtnmf3tadlatr n sl() rxr(opoo1lp   fciasfa2urumo;u0apx mictaslaDrmn s t0arxoxo3to1lpD livi;s  euoimpio1ape lfeia(fartaumpnu0oeen oeiytls rmuvonu4 lerio3iytfp elnvi t0srurirpiu1oltnmfes sfaruaxmo;o0alenioetltlmDumnmsnu)tetoio3tadlp rlies;(0 2urxr3no1amtnlieilt a2uaxmp;t4alxo fciatla uluvo;(4trtnir3oydoat  u s t srxrirpno1lm elnet t)arrmu  ;o1aeeo oeiydfsDeluvo;u) lxrmrciatlpt  ieo;s truoimpnu4lmtn ncsas) rrr(mp;o1aleomo3tydfm2uanvo;u0 lxrxr iadlp  lneo;t0 eumxrpiodopenmncil( a2ur( pou4olxnii3tasls el( o (4aexrmo3oa1fp eli s (0 2tmim nydll emnvias a2umxmpou4olxn oeiytfa2eanvpnu4aexomo3tadlptraues t0t2tmim3iy1lmtemfes t)arta(rpou0tlt  fcilslsDrm( sn()aeenmr oy1fp ran s;s srumim oydal  mfesas)sDurxrp;t1aptn octytfa2umuvpnt0 lenmrcoytfmDeliei ()seumxo3oy4aptemietas) Dtmum nt1aptnioeiad m ua(mo (4trtrmo3oadlpDraivs;t t2xrimpny1olenmfes ( s2umuronu4oeen fciydls umnmonu) leoio oadlaDr uvslt)trtmxm io4lp   ncilt a2raxm oo1optnmi3tlsfa2rln o (4altomo tydopte i s s0s2xoxm io4ap  livil() 2rmum ;o0olxnmfciadfs2umuvpnt0texnxfctodomDrlueols)srxrxm3no4op e fvtat) Dta(mo;u1tleomociyd sDrm(mo u0 leoio3iotfa  luvi t)truoim iydlptelfvslt)aDrmxmoou0opx mo3iasls2rm( p (4trtrxocoadomDeln o (0 rtm(m3oodamenmivias)aDrmu p;u1opx mfetatls2rmnvpn(0 lxomr3ootlp eln sls srtmxm3nu4optnmncsat) Drax p;o0alxnif3iysla2ea(ms;t0tetomr3tydomteanvilt tetrio no4lmt  nctl() 2ta(r no4optomi3iad sDuanvp;u)aexrmr todfmt  uvols0 exoxrpnudomtelnvt sf rtrxr nt1tetnmoeiydlsDeaump ()teerxf iy1lpDr uvol( trurim3iy1opt  fcsasfsrum(m ;t4optn ietat aDua( p;u)artnir3iadlmD lies () etmim3nydllte ncslt) ruau p;u1aexomf3ias s ulump;(0aexoif3io1lmD anvi ()sexoimpiu1op   ies s)srurumpno0alx mfciydfmDra(vpnu4trenifciodfmt ln i;t srtr(r3ou4optelfcsl( a2umxmont1tet ii3tysfa ulnvsn(0trxoif3oydoa elivo ( s2xoxrpoydlpen fvi s) Dtm(r oo1oeenmocild s2um(vo;u0aexomr oodlp   nei ()t2urxr3oy1ll n fesas  rtaurp;o4tpe  i3iltlm em(vo t)tlxoif tydlmtr nei s0s2umxo3nydlpe mfei s)srtaxmonu4tet mf3iasfm rau on(0tleoxf iy1oateanesls0teuo(opno1op   nvils)sDtmxmpnu1opx if3ilt a2raumo (4teermf oo1faDe ieol( trxrim3oudlm e ici sfsrtm(r no4tltomfciat a umu p (0tlxnxo totlptr iesls) rxm(o3iy4lmeelfvsls aDuauront4ope  ictltfa2ulumo;u)trtnxfciotopD  i sls0setmio3oo4oltemiesat s2tax pnu1oexniociys m rl( p;()alxnmf ta1op   u s;()s2uoio3nodomtelfciatfaDuaur ;o0tlenmiciysla el(vs t)trtnir ta1fpt lnvi (0 exmxo nu4llen netat)arum(  nu0oltomfeiasfa2uluvo;() etrmf ootfaDe uvs;t0s2urimpoo1omt  ivia()a2ua(r ;t1aet iieiltls um(vs (0 ltnmrcoo1lmtr u s;t0 rxrxm oy4opte nvi ( sDrmurooo0tex iiciaslm eluvpn()trxrxo3ty1lmtr ivi s) 2tr(m no1ol nlics s  rrrx  no4texn fetlsfs rauvo () lxrif oytfptrlu il( srtrxmpoo1al emivsas) 2rmumonu4tptnmictls m2rauvp t)aeerxr3oytlmDrlu s;(  rtrxo iy4lp  lnctl(  Drrx ooo4apxn ietys sDumu p;t0arxoxfcia1oa r n i;( s2xr(m3nudalte ictls aDrmurpnt0open f3iydlm elums (4tlerxr3iydlmDrlivs;s)teuoxo oy4am n nctlt  2umump;t4tltnmfeiasfs rmn p u)altrxf io1op  lieo s t2ur(o oy1optemfct t  rrrumoot4apenifeiadls2uluvp;u0 rxoxfcoa1opDr n ols  2xrimpiodap  lieil() rrmu  oo0teen o3ils m2rmumon(0tlxnxf iodopD ln s s t2xrxr iy4omenlfvt s  Dtr( pnt1opx  fcildfmDemn p () exrif3ta1lp e ivo t  2xmiopio1om  lies ()sruru oou1ape ifciadfsDem(mo;() lermocta1lmDelivil() rto(r ou1om   fetlt) rtaumont0tlt  feiadls2umu pnu0trtrirciodopDeaivo;t trxr(opou1lm  mfeta(  rrrumoou1oetnmo3tlt s ra(vo u0 ltrio3io1omDr n ilt  etrio ou1optnmnvtlsf rtmxro;t1tleomfeild sDemnvo;u) eerxr3tydlm eaues;t  2umimpou1ope livtl()srtr(m oo0tlt iieild sDeanvon(0trxrio3to1fpDr uvi s  rtmxmpoo1amee nei t a2rr(  ;t1tlxo octyt s rlump;u4altnircoadoa eaivslt teurxo oydom   feiasfartax  ;u4oltnmf3iad s2ra(mpn()aeeoxo3io1oaDrauvolt) rxo(o oy4omenlieta( aDra(moot0open octadls rluvsnt0 eenmr3ty1fmte i slt0 2umxmpio4al emfvs s) Dumx  ;u4teeoiietytfa ulnmo u0aetrxo oytfptr i ols trxm(opno1apt  nvtat  rtm(  oo0teen o3iatlm ra(vp;u) eenmo3iodlpteaneilt0 rtrxo3oo4am nlivsl(faDrm(r ;u0opxnioctytlm2ra( snu0arerxrciatlmt au o;()s2xrxm iydameelietatfaDrr(mpot1aexnioeiltfmDrlnvp;()alxomf to1fa   nvi ( trxmimpoudap nlfesa()aDua( oou4aeen ietadfa rmnmo (0 rtoxf iotlpte ivs (0t2xo(o iydomtn ncil()aruaxro;t0olx  f3iltfm eluvonu0arxnio to1fpt an ols0t2xrir3io1llee fvt (farrr(m ;t1tetn icilslm2ulnmp;t4alxoxf3tytfpD aiesls0 2xoiopnodll  mfctas)srumxrpnu4oeto oeiysfm2em(mp;t0aetnmfciydfateaies;(0 rto(o3oodlpenlicsas)a2rm(ro;o0aex mfeiatfm2rmump;(0tetrmf3todfpD lnvs ( seuo(mpnydlpenmieia(  Dtrxm nt1tetoiieildlm ra(vp;t0 rtrmocoa1fm eluesls t2tm(opnodllen fci tfa2rr( oot1ope iociat a ea(msnu0arxnmf3ty1om  au s;s s2xoim oudoltn ncias) Draxr nu4olt mfciyd a rln p (0aeerxfcoadoaDrlivo (0 etm(opiudoptnlics (fsrtm( oou0tptoifeiasfa emn p ()tetrxocio1oa raiesls)srto(o3ou4op nlicsl() Dur( p;o1alt mi3ias m2el(ms;() ltnmrcto1lpteau i s0t2tmir ou4alenmfeiltfsrtmumo;o4open o3ilt sDraump;u0tlerio ta1laD  u s;s)tetmxr3oy4alt mnctls sruaur nt0aeenmo3tyt sDua(vp u)areoxf oo1lm  au i;t setmxr3io1lpeemicslsfarrrumo;o4texnmoeildfs uan s;u)altnmo3oadfaD lu sl(0t2uoiopiodll n ivils)sDtmuro;t0oet ii3iasls emn o;t0trenxf3tytlp e nvs;t0trtm(opoodlp e net sf 2tru oot0oee ifciatlm2uauvs;u4 exrxr iytlm  livilt0s2umxm3iodop e ivslt)sDua(r ;t0tpxo f3ildfa rmnmp ()tleomfctotfaD lnvilt)sruoim oodopt  ncsat)arumu  ;o4olenifeiat s2ul(von(0trxrxf iydomte u il()srur(r3ou1om elfctl(  rurxmpot0ope  oeiyt m2rluvp t0 lenxf3iadomDeluvo t)srum(opno1omt mici t  2rmurpot1tlt moctytlm2elump t0areoxfctydlaD  u o;()t2ur(mpoo1omtelnvtl()s2ua( ooo4alx mi3tyd m2umnmo (0altnmf iy1lm rau o ( sexmirpnodom n ivtlt)s2rm(  nt4ope  iciasls2eau sn()arxnmr totfatraieol()t2xmxrpiu1lm   nvt tfsDta( onu0tlxnio3tatls2umn s;t) reniocootfateluei ( trxrio no1opt  feia( s2rrur ;t1aexnmi3iyt aDrm(mpnt0 exoir oa1fmDr ivs;(0teurir oo1ol   fvtat artrxrp;t1oleomictysls2ea( s ()tleoxrciytlp  auvil( trtmio3iy1lp elivtl(fs2trxr ;o0tetnii3tltfmDemu o;u0altoxr3oodomDe n s;t  exr(opoy1ol  mfvtasfsDua(rono1alxn i3iltfsDra(vp;t)tlenmo3tatfaD anvs;( s2trxo3iu1ol   fctls  Dtr(rpoo4tee mfcilslm2elums u4teenxfciatoate u i ()t2umim3oydomee fvslt) rum(  ;o1opxniiciytfa umums (4aeermr oo1late nei (0sruoxm io1lmt mfcslt)arraurpou0tetn o3ildfaDum(vo t0tlxoioctodoa  aues t)trxm(opno1apen ncil( sruru pnt0oleoiiciadfm2em(vp;t4 exnxrctodoptraiei ()srurio3oy1lpe lfesat)a2ta(rpnu0aet ioetatfa2rluvo t0artrif3totfateln olt0trxr(r iu1omenlivtat a2tmxmpnt4oeenmfeiasfaDeanmo;u0aexnxfctodomD lu o;s)s2xoiopny1omen ivs ( a2raump;t4oexomf3iytfs rm(vo;t0arxnmf tatop eau i;s) rtrir3oo4ameelnvia(f 2tm(m ot1olen ieiys m2elu s t0tltnmf3oatfpDeli ol( s2trxo3iydame livsasf 2uau  ot0alto o3iyt a em( s;t4 rtoio iydlatelivs;(  euo(rpoy4op   feil( aDtmxmp;o0oltoio3ias mDua(mo t4 etrif tytlpDranvi t0trxmxo iudlp  mnei (f 2umxmpnu0aeeo fetltlm2rl(mo t4treoif iydfpDranvils)texmir3oy1aleemnct s a2tmxm ;u4tpe moctysls rluvs t)arxrir3iadfpt  neol(  rxm(m iodapee nct t) rtmumpou1aet io3tlt sDuau sn(4arerxf oytfm  aueolt0truoxo iudopt mneiltf rta(mpnt0apx mi3ildfm rln pnu0 lxrio3oytoa eli s t  2tr(mpoodap n ncslt aDrrurpou4aptoioeiydfs elumon(4trtnmfcoadfmtraueo t0s2tmxm3nydamt lnesa( arurx oou1olxniictatfm ua(von(0teeomfcoatop e ueil()trtr(m oy4ole  fvtat)aDua(r nu0aexn i3iadfmDemuvon(4teenmf3totlm e uvolt0s2tm(mpiydlm nmnetl( s2rmxm ;t4apeoio3iyt sDrmuvs;u0 rtrmrcia1fpDelivslt0srur(m3iudope mnvi t) rrr(mpou0ape  f3tasfaDrmnvpnu4tlxnifciy1oaDeaies;(  eurxm ny4amtnmfct s) 2trurono0tpenmo3iat m eln pnu)tetomo tatfpDe i o;s)t2tmxrpoudaltn nvi t  rtmx o;u1opt mf3iytlsDuanmp t) etomo iytlpt  n sls) 2xmim3nudll emfvt s)a2ta(mpno1olx mfetadlsDul(vo;t) leoxr3oytfp  luvs;t0texmimpno4omen ics ( sDum( pno1olenmoetys s ean snt0 rtoif iytfptean o;t) 2urxm oo1omtnlnetat)aDrmx pou0opxnmfcilslm rlums;(4trxoxfciytfmDrlivsls0 2toio3no1al nmfcsat  2uaur oo4tpto fciad a2rm(mpnt0aeermocoo1lat livo s  2urim3iy4ll nmnvta()sDra(mp;u4tpt if3iaslm2rl(ms;(0 lxrxr3tytopDe uvo t) 2toim ny4openlfvi t) Dta(rpno0aex if3iltla eluvo;t4texnio3ta1fmtran ol(0 ruo(mpiydoleemiesas)srtr( pnt1alxnmo3iysfs2em(vp;t4 reomfcio1laD  n s s)seumxm3oy1oltn ies ( sDtm(r nu1tpe mi3iad s2rmnvo;() eeoxr3oa1fmteln s;(  2urxmpou1ap e nvt s) Drrxmpno4optn ociadfa umums t0aetrir ootlateaneolt)trtm(o nu1op n ivtat srtrumo;t4oeenifciytlm um(mp t4 rxrir3oatomtranvi t0 exoxopiu4llt  ictas aDur(r ;u1opxn o3ildlm ua(ms;t) lxnxfcia1la eau o t  rxrxo3nydop nlnvtlt)aDum(mo;o0ale  i3tltlsDrlu o;() lerxf totfm e ieil(0seto(r3nydole  fcias)artmur no0teeo oeiadfa2elu s;t4alxnif3oa1fmteluvsls0srurio3ny4am  mivi sf Dra(r nt4apt ifeiytlaDrm(mp (4tlerxr oodlp e uvils s2xo(o nydllt  fcsltf Draxr nu0apxnmoctlsfa2em( o;t4teerxo3ia1fpD lu i s0 eurxr3no4amtelncil()a2urum ou4aee mf3iysls2rm( p u0teeomo3oytom rluvs;t0t2xrxmpou1llt mivt t aDurum ;u1apeo octas m el( sn(0 rtrmf3iatfmDrlu o;s0 2xmim3nodaptnlnvt () rua( pno4oet  feiasfm2emumo t0altrmo3oytomt lueilt  2toio3nu1apt livt s) rrau pou0tpxomf3iyt s eau o () reomo todlm rlueilt0t2umxmpiydolen nesas sDua(mpno4opx  f3iatlm2ul(mont4 exriociatlat lu s s0 rurxrpio4apte nct t srta( pnt0oetn oeiadfm ulums;() ltomfctadfaDe u o () 2urxopiu1al elies s  2tmurpno4tetomieilt s elnvp (0 eenxfcoo1fm   i ils  2xr(mpoydope mietatfaDtmum no0oltn icilsls2rmnmonu)aeenxo to1om rai olt)trtrxo iodopee nvi ( s2tr(  no4oex mi3tyslmDeanmsnt)aleoifcty1opD aneo (0 rurir3nu4omee ivtlsf 2rau p;t1oleo ieilsfaDul(vpnt0trxrir ia1lp rlnvs;t0s2xo(r3oy1ll emiet sfs2rrxr oo0oee  fetltla rmumo u4 lermfciytfatr u sl(  rxrxr ou1ll   ieia(f Dur(ro;o1tpt  f3iad aDelu snu4 lxoxo3iy1fm ran s ()t2umxo oodll emivtl( a2rmxro;o1tpxnifeiyd s um(mp t) ltoif3oytlm rln ilt0 2umxopiy1optn nvtlt sDrrxr nu4opx moeias m2rl(mpn(4 lenmf oytop rlnvsl(  euoxo3ou4ameemfvt sf 2taxr ;t0tlx mieiadls um(mo;(0teerxr todlmt  ueilt srxr(m3ny4lptelfeta()arrmurpnt1oex mo3iad sDrmnvp u) etnxf3iadlaD lies;s trxoimpiudal   net tfa2ta( p;o1aptoifciat a2rlnvo;u)trtrxo iy1fp  aieol(0s2ur(mpny1omte fesa(faDtmx  oo4oet mieiytfsDrm(vo;u0artoxr iotlpt lnvi t0 2xmxo iodomee icsa(fsDuru  ot0olx iicildfs rm(ms;(0 rerirctytlaDrlieo s srxrxrpou4opeemfvtl( a2tmxmonu0tlto ietls m2emumpnu4 ltrifctydlpt li o;(0srxmimpnydlmenlfvia(faDra(mp;o4tltnmo3ilsfsDem(mpnu4trermr3ta1lp e nvo ()s2ur(r3ny4alee fvi s)sDtrx pnt0alto ictld s2ra(mo t0trxnxo iotom eluvi;( srur(m oydll nmnctasfsruaxrooo1opt mo3iatfmDranvp u0tlenxfcta1omteaues;s0 rumxrpiu4lm e ieia() rumxmp;o0altniociys s uauvsnu4arenmr iytfpDe iei s0trumxo oy1am n fvsltfsrumxmp;u1ole iiciltlm ua(mont)arxrxo iytomtr nes;t sruo(r3nu1opeemnet t srra(  nu4alxo o3iatlsDuaumon()alxomo3tytoate n s;t0t2xm(m iy1lmte ivtas s2uau  ou1alt mo3ildla2rl( p u) exrmo iatlmte ues;( trxm(r ny1amtn ivt t  rum(mpnu0ole iiciatfa em(vo u0 lxrmf tytlateauvi t0s2toiopoo1altnmfci t) Dtru pnu4aet miciasla2ranvonu)trxoxf totfptrauvi;s s2umxr3nu4olenmfvil( sDtrxr ;o1oexo i3tat a2raums;()tleoxr iy1lpDelieol() rxoxr3iu1om e fvil(faDrm( poo1aptoiieilsfm2ranmp;t0 rxnmf3oytfaDr uvi;( srxoir3nu4optnlivt ( srta(mo;u0oeenifetatla elnmp;t)tlxoiocoy1opD an ils0t2ur(rpoo4lp n nvi (f 2rr( p;t4tleoio3tydlm2ulnmp ()texrxf todlat anes s tetrxrpiy4op   ncs t)a2rrxm oo0tlxnii3tlt m rmuvs;(0alenmr todop rlieo;s)texrxr3oydlpenmnvslt) Dtax  nt4aptniocilslmDran o t)altrmocoa1fpt ai s;t0 2tm(m ny1omee icils)a2rm(m ou1aexo ieilt m2elnvo t0 reoxrcoydopDeln i;(0 2toxm3iy4lle mivsl(fsrrm( o;t0tleoif3tyslm2rlnvs;u4trtnmociatlaDrli ol(0s2trxo3oy1lleemnctas)aDrau ooo4opxomo3iys m2rl(ms;u0 ltrmocia1fmD lnvs;t)t2umir3oy1ole lfci s)a2ur(mpou4aee io3tad s eluvont4 lxoio3ta1la elnvo s)srxrxmpnu1lm   nct s) Dtm(rpnt0oex  oetatfmDem( p u)trtrir3ootla   i o;(0trur(o no4ll  mnci s s2tmxm ;o4tleomf3iytfa2rlums;t)arenifcoo1fa eanvs;s)trxm(o iodlptnlnctasfa2urxr ;t0oex  ieiyslaDrm(vp t0aeerxf totfa eluvils)s2trxo iu4lpt lfciat)srraxronu1aeeomoeias m2elu o;() etrmo iydfmt  n i (0s2um(rpiy4llt mncsl()a2tmxro;u4oltomfetldfs2umn o (4aleoio3tatfm e u ils sexrirpnu4op e ncsat srrau ono4tpxoif3iat a ea(ms u4trtomocoy1fmD li ils0teuoio oydlmt lncs sfarumumpot4aet  o3iatlaDel( p;u0teeoircoadlm e ieols) rur(r3nydome  fesat)srtr(r ;u1apxnmi3iltlaDumnvp;(0aexrmf ia1lp  auei;s0truoxrpiydam nmnvtls) Drmu o;o0tle miciadla2rmums u) renxocio1fm  lu s;s sexrim no4ame mfvslt) rrmuro;o0aleo f3iltfaDem( p (0treoio3ta1omtranvo t  rxrirpiydlpeemfct () rrru ont0tle  iciltfmDean pn(4 rermf3tydlptelieo;(0 rxm(r oy4llte ietl(faDum( pou0tle  oetys a rmnmp;(0 exomr3oytop r nvo ()sexrxm nydapt livsat s2tmx oot1oeenmfciyd s2ea(ms;t0altoio3ia1omD  n o s0 etrxr3io1omt  iet (farrrum ou0tlx iieiadla uanvs;t0aexnmf iydopt lieo t)trumirpno1omt lncsl()aDrm(r oo4ole ioetltfm2uauvont4altniocoy1fa eanvo t) eur(mpno1ape  fvtls a2tru pou4aexnioeiyt a ul(mp t4tetnmrciy1fptelieils)t2tm(m3io1opte net tfsruaumpnt4apxnmfeilt sDelnms ()trxnxf3iy1opDr u sl()tetoxm ny1amee fcias)sDur(ronu4aet  feiaslaDul( onu)alxrifcoadoa rlnvs;t0srtr(o oy1ope  ncsl( sruaump;u4alxoio3iytlsDelumonu) rtrxf3iatfpDeliei;t)srurxm3iy1amenmicil()a2rmu ooo1texn iciytfa rm(mpnu4 rtomr to1oateanes s)tetm(opiydlme lfes (f rrrxmo;u0oexnmieiasla um( p (4 rxoxr3ty1fptr uvi;s0srto(mpno1ole  nvs t)s2umu onu1tlxnifeiadlmDrlu s;t) rxomrciadlp r u s t0teuoim io4lpe  icsatf 2ur(r no4aleomoctls s ulnmonu0 lxrmo3ta1opt  ueol( s2xoim ny1lpeemfci tf 2tm( ont0aeeoii3iltlm2umnvs;()aleoif3io1lpteluvsl( texmir3nu4om nmiei s)srtax  nu0tlxnmf3tysfa em(vo;()texrmf iytoat  ies t0s2xrirpio4olt liviat) 2tmxr ;o0ole  f3iyt a rmnvo;t)tetnmf tydlmDelnei;(  2urxopio4llen feslt)arururono0alxo f3tydlm2ea(von(0 rxoir oy1faDr i s;s0sexr(opnu4optnmnciatfa2tmu ont0tpen octytfsDean s (0 etrxr3oydoaDeauei t)tetrio3ou1lptnmieiatfarrmu  oo0olen ocias a2umuvp t)trtrmfcoo1oaDean i s) 2ur(mpiodom nlfeil(  rtmu  nu4apxnifetytla elnvs u4tleomo3todopteaivo s0 exoxopio1lleemnvi s sDrm(m ou0olxomf3iadla2uau o;(4areoif3ia1lmt lneolt trxmxr3ny4ape lfci s)a2urumpnt0tle  i3iysfm2rmu s t4alxnmr3totomDelues t0seto(m iu1lpt livsasf Dtr(rp;o1ape io3iytfs2emu s;t) ltomo iatlpDelnvi;( tetrxr no1olenlfci ()srtr(m ou0oleo fctysls uauvo;t0tltomrcio1lm  aieo;t0srtrio nu1ameelictls)sDtr(rpnt4alx mfctldlm2eauvpn()teenmr iadlmt lieo;t t2xmir3nydomt lneslt) rrau ooo4opxomiciyslm ea( o;t)alxomr3oy1fp   ieo;(0 exmimpny1op nmnesat arum(  ot0tpe mo3ilt sDrm(vsnu0artnmoctotop rluvi;s t2umxm nu4apeelnesl(fsDtrur ot4tlen f3tas s rmumo;t) reoxfcty1oa e i s (0s2urxo3no4alt licia(f Drauroot1olxoifcilsfa2ea( p () ltrxf oodlatr ieols trumxo3oodllenmfei s) 2trxr ot1tptomieilt m um( s;t)aeeoxo3oy1late uvi;s  exoir iu1ome lneslt a2taumo;t0tle mf3ils s2uanmpnu4texrmocoo1fm elnei;s srtr(o oy4ape  iviat  2rr(mpno4olxnioetad m eluvon()aetrxr ootlmte n i;()setmxrpny1omen ncta( aDrmumpnu1teeo o3iysla emn s t0tlxomf tytlptran o;s)t2xm(rpoy4alt  feta( a2rmxmp;t4oee  feiasls el(mo;()tlxnxf ia1latr nvi;s srtoxm ny4lle lneilt)aDurumpou4aeto fcilt sDranmo;(0 rxrio tatfm eluvo;t)setm(r nu4olen ncils)a2rru ooo1tpt miciatfsDuluvs;(4tleomoctodla  lnvs ( teum(opoudopt mivt s) Dtr(mpno4olxoifciydlm ul(vpn(0 reoxr3ootlptrliei;( sexmirpny1ol nmnciat aDtr(r ;u0ale mfetaslm ulnms;t0teenirctytopt an slt0trxoirpio4lm  lnesas aDtau p;u4opto i3iltfa ran s (4altnir tadfatr nvslt0srtoxr3ny4opt lfvsasfaDua(ro;o1aexnifciadlsDra(msnu4 exnif oodfmDeluvi;s0srxmir iy4am n nei (  2trxrpno0oex  ietadlmDea( s () lxnif tadopD  uvo;s) rtmxr3ny4alee ics ()a2umumpnu0ale iieils aDelu o u0altoxocoa1laD  uvil(0 ruo(opnodlpee ics sfaDua( p;u1tltoif3iytfa emnmsnu)tlxomo iadfmDelneo s) etrir3nydop emivslt)a2ururonu4aeenmoctldlaDuanmp;t0tlerxo3iydfmt anei s teuoir oo4ole micias  2urxro;u1tlx  feiydla ea(monu)arxrif3iy1om   iei s0 rum(rpnydalt mnvia( a2tax pnu4aleoioeiysla2elnvont4teenir tydfa r uvo;t0teurxm ny1llt  fcil()aDrm(mooo1optnmoeild a ranmp u) exoif todom r u o;(0 rxr(r nu4llte nvtas)sDrrxm ot4tpxo ociltfs2uan o;u)tltrxrciadfpDeluei () 2tmxo3iu4omt lfctltf Duaum ;u1apenmiciytla emn p t0trtnif oodopte uvo;(0trurxr3nydlleemnvt (faDtmurooo4tleo iciaslmDemums (4artnxfcta1fat  neolt trxmir3oy4lm  mneia(f rtaur ;t4texo ietatlaDul(msn(4aetomo3tydfpDean s t0t2uoim3nodalenlneta( arrmxr nt1tptoioeiadla2ra(mon(4teeomoctytoatr ueols0t2toir3iodll n net (fsrtmu pot4apxomictls s ua(vp;u4tltoxf iotfp rlies;t)s2umirpoo4am nmfet sfsrra(r ou0alxo oetasfa uan sn(0 rxomf oa1omt  ivs;s trurxmpny1lm emncsl()srum(  ;o0tpxomoeiydfm uauvp t) etrmf ia1omDe nvsls  rur(mpny4am elfviltfsrta( oot0oexomieiasla ul(vp t0tetnio ia1op  ln i t  rtmxopnydlltelnviasf Dumu  oo1tex ioetldls umnmpn(0aexrio3iodlaDr uvi;s)trur(r3io1opt  fvtl() 2tmum oo0oexnmo3ias s2emump;(0trerio oydomt aivo t) 2xriopnudoptemfci tf 2ta(ro;u0olto f3tasfs umumpn(0 eermo todfmDelieo t0texoxo nydom elnvt (  rrau o;o4aet moeiytfaDean s;(0aexrxr3iy1oa  anvo;() rto(mpio4om n feia(f rtru o;o0aleoiiciadls2rmn ont4aexnircoydfmD luvs;(0t2trxr3iy4ap emfes () 2taxrpnt1tlxomiciltfaDum( ont4trxoxo tydfateluvi t seuoxo3nodol   ivils s2uaxm ou0olx ii3iatls umnvpnt4aexnxrciadlmte ivs t0t2uo(opoudllenmfvilt)a2um( pnt0tlt ifcildfm2rauvsnt0aetrxf oo1oaDrln sls s2to(o nudame  ivsas a2rrx o;o1aeeoioeiytls rau p;u0aeenif oydlm   nei;( teuo(rpnu4lleemnvs t sDrr(mp;u0alx  oeiltfa rmn p;t0 lenmoctodla rluvs t0trurir nodomeelnetl(fs2ra(ro;t4aeeniociltfaDrauvp u4 eerif oydop e ueils0s2toxmpiu4lp  lnvt t s2urxmpno4alxo f3iyd s2ulu onu0altnxrcty1la elivo t  2tr(m3oo4alenmictls  2raurp;t0olx iiciad sDuau sn(0 lerirctytfmt aneolt0seum(m3oudop elnei s) 2ra(mp;u4tlen fetat a em( s;(0 exoxf3tydlateaues t s2toxo3oydlm   nvtasfsDumx  ;o4opx  i3iydlmDulu p t0 ltnmo iatfaDe nes t)trtr(o iodlp e neils) Dtm(r nt0olt  i3iydfs rlumpnu4arxrxo3iy1op  lies (0 exmim nu1olen nes (faDrm(m no0aexoifctlt m ulnvp;u0 eenxo ta1opDrlieolt)trtoxr oodamtnmfeiat) Dra(mo;t0oee  o3iltls2umn s t)arenxfciotfp rau i;() rum(opoydlpt livta( aDtm( o;o1tpxomo3iaslmDea(ms;u4trtrif3todlatelnvs t  2toxm3no4lp nliei s  2rmx o;o4oee mo3iasfa uau s;t)tlxoxo io1lpDean o t0srtoxmpnydlptemici ()sDrmu  nt4tee if3tls m2rm(vp;(0 renir3tadlpD aieo (0s2xmim3ny1amtn nctatfs2trur nu4aee iietatfa2rlnvpnu4aexrxf3to1fa e n o t  rxrxm no1om emfctat) Drmxm nu4aeenmoeiydfs uluvp;t4artnmr3to1op e u o t)trtoirpno4apt  iet (fs2ua(rpou1texnifcils s2eanvp (0texrmrctadoa e u o t)tetrimpnydlme mfvtl( a2raumo;t4teto feiadfsDrl( s t4trxnmr3iotlat  u s;s)srurir3iy1ope mieslt sDra(r ot4aeeoio3tydfm rlnmpnu4artnmrciadomDeanvo;t)setr(o ou1omenmfcsls) rrauroou4aexnifetas mDean snt) eerxf3iadlaD  uvo;( srum(r3oydapt lies s  ruax oot1aeen ieias a ul(vo;u4 renio ia1latraieo;s)setmirpio1lpe  ivia(f Dra(mont4alt mociltfm2ua(mo t0 ltnxociodom  auvilt  rtrxm3nydale lnvsas sDtmxmpnu4olto i3iltlmDel( on(0tlxrxfcta1lm eln o;t)srxo(m3ou4olee nviat) rumu p;u4alxn f3ilsfa2uanvp u4alenmo tatomDrlneols)t2toir3ny1ame lnet s) rtmx  ;u0oltnmictat s elums;t0 lerif oo1op e ues t) eurim3ou1ape mneils) Dtax pno4olxomoetaslmDemu p;u4trtomf iotfmDr u o t srxoxm3oydameemnct sfaruru o;t1oex  iciat s2rln sn(0alxnmrcoa1fmDrliei (0seuo(o3iy4llenmfei (faDra(m ;t4apt mfciydlm2emu p t) lxnmrcoy1lpte nvs;t)texmxm nu4op n neiatfartr(rpnu1opx moctldlaDrl( s (4 etnio oa1omt lnesl( teumxopiodomeemictl(fsDur(rpno0texnmfeilsls2em(vs () rtoxfciodlaD luei t teto(o iy1apt mivia(farrrxm ou0aee if3iydfsDel( ont4tleoiociy1fmt lnvil( truoiopoydomtn ivt tfarraumoot0oexnif3tytla2rmu o;t)aleoio3iytlpt  ivols texm(m iy1ol elnetls srta(ro;t4oetnmociltlm ua(vp;u)aetomrcoytfm elivils0 2trxo no4lpe mnes (fs2rrxmoou0texnifcils mDemu o;()trtrmocoy1fmD lu o s0seurxm3iy1optnmiesa()sDta( pnt0apt mietltfaDelumonu) exoifctytfp e nvils)seum(o iudap e fci t sDtm(rp;o4oleniociysfsDuluvs;u4teeoioctatoaDelivi;()t2xmxm3oo4ll e ietl() Dur(m ot1olxoifeiltfaDumnvs u)artrxocoo1la e i o;t) 2umxo nu1lp e ivs sfs2raxmp;t0alx mo3tls mDuln s (4 exomo3tatfpDrauei t0t2xoxm ou4op e net s) rrm(r no4teeomo3tadlmDemu o t4artrmr oo1op rlneolt) exo(o3io1lle  nesasfsDurxrono1open fciad a rauvs u4treoxr to1fpDrlues;t trxo(m3oo4lmeemncslt arta( oot0olxo fciatla eln s u0treoifciadomDranvo s0sexr(r3nydol nmfvtas)artax  nt4apxn octydls2ea(mp (4 etrir oo1opDran o;(  ruoxopiydlleemfcils) 2rr( pot4alxomiciyd a el(ms u0aetoio3iydfmDr u s t)teumir oydlp elies (fsrrmx oou0altoifciltlmDel(msnu) eerir3iatomtrli o;s)setm(o3nu1op  lnvil( s2tax ont4aex  o3iltfa emu o;t0 reoifcio1latrauvs;(0teuo(r3nu1amenmiesltf rurxroou4optomf3tysls2uaump;u) exrmf tadfat  uvs;t)sexrio iudlp   fvsl(faDum(mpou4aleo iciytls2uan on(4teeomo3iatlmDe n i (0tetmio nodlle lfetas)srua(m ;o4tetn ocildlmDum( sn(4 rtnxo io1lpDr i ils)tetrim iu4lltnmfvslsfs2uauroou4apenii3iadlm ul(vsn()texnif3to1fpD an o;s  etoxm3iodal n nct s  ruru  ;t1tpenmfeils aDulumo;t4treoifctodfaDrlivo ()tetmxr3no4oltnmfeta(f 2ua(monu0opxnio3tadlmDeau s ()trenir iadlaDeli i s0 exoxopiu4alte feia()s2uaxm ou0tpxo fciyslaDemnmo u0arxnir ta1fatr iei (0t2urxo nu1alenmnvtl(  2tmxront0tpxniiciad s2eaump t) rerxocoytfm e i o;t0srum(o oy1ap   fesatfa2rru pnt4opx mfctlt sDuluvp;t0 etnmf3oa1fa  aivi;t0 2um(rpoo1ll nmivtlt) Dtr(mp;t4aexo oeils m rmumsnt4areoxf iodop  anvi s0 2xoio oo1lle  neias)srtau o;t0olxo ictytls2rlnms;t4 exrio3iytop   ueslt0t2xo(opiudamt lfvsasfs2umumoou1optn o3iatla2eln sn()trerxrciydfmDe nei;() 2xrxmpio1apen ivt (f rrm( ono0tpe io3iytfa uanvsn(0 etoio tytomDe i s;( s2xmxrpny1alt mfct s sDumxrp;u0alt ifciadfa emn on(0 ltnio3oo1fpD lu s t0 exo(o iodopee fcs (farraxm nt0tlen iciysfm emump;(4 reoxociodfpte nvolt)t2um(mpiy4al  mfvsat  Dumuronu0olen f3iysfs el(vs u4 rtomfctatfa rluvo s teto(m oo4lpte nvt (f Dtmxr ou1aptn octydlm ua(mpnu)aexoxr iydopte ivs s  2xrimpiu4optn fvtat)aDtrurpot1opxnio3iys mDelnms;u)altrmf3iytlp  aneilt  2umir3oy1oltn fct sfsrtr(rooo4opt  fetytlm2rlu o t0trtrifcio1oa eauvo ( s2uoxr oo1llt lfeiatf rtmuroou1aptn ociatlmDuaumsnt0 etnxrcio1fp eaues ( sexm(opiu4omt  ieslsf 2ta( o;u0alt  i3tlsla ulnmo ()tltoxo3iadomD  nvo;()teumxr oy1ale  fet ()aDrr( ont0apto octytlm elumo;t4aexrif3tydop   uei;s)srtr(rpiu1alt livt tfa2taumpoo0tlxnmoctasfmDulumpnt)texoir3oo1lptrai s;s  2tm(o3iydam e ivsl() rurxmp;t0tpx moeiydls2raump u)alxomo iadfaDe ueslt)trtm(r io1al nlivtl()a2trurooo1aptoifeiydfsDrlnms;u4trtnif oadfmt  n i;t)srxo(rpoy4op   fciltfsrta( pot0ope  ieilt m ua(vp;u)trxriocta1lmD lnvi t) exrxo iy1lpenmfvs t  2umx p;u1tpenioeiatls rmnmp;t4 renioctadoa  anvo;s  rurxopiy1oltelfcs (fs2urumpnu1olxo i3iyt a2emumsnt) lxomr oa1lat  ivi t0 etrxrpoudoleemivt tf 2rr(mpot1tee mfetld mDranms;t0 rtrmr3to1fmt aivi;s0 2xrxo3oy1lp nlncslt)aDum(mont0tetniictyd s2rluvp ()treoio oy1fmtelnei t) 2trio3oudome mnvia(f 2rmx  ot4apeo f3tad s2eanmp;()tetomr oy1op  au o;(  2to(opnydll nmfcsasfs2tmu ono4apx ifeilslm rmuvo;t4 etrmocoa1oa r ueo;s0t2tmio nudomt lneil(  Dum(  nt0tle mfciytlm ea(msn(0teenxr3totlmtrli s s)srtmxm ny1olt lneiltfarum(rp;u1texnmfciys m em(vp;u0alenmo oa1op eauvo;() eumxrpny1oleemicia() 2rr( poo1aptnmieiatfs2uanmsn()artnxocoy1fa  an sl(0s2ur(opou4apt  fci s)aDrmxr nt0apx moetatla2elums;u4 eerxf ia1lpDe nvol(0teumxopny1ole mfcs t  Dumxro;t0aeto feiys m2ulnvpnt) eeoxr ta1fatran ils0s2uoxopio1ap emfesls sDrrxm ;u1alt ioeiyd aDumums;t) rerifciydla rluvo (0truo(r3oo1omt  ict tfaruaump;u4teeniictlsfm umu p;u0trxrxfctadoatrluvs t0s2xr(m ou1alee nes () 2tax oou4oeto fctytfsDranmo;t4trxnmf iotfpD liei;(0 2xrxm ou1lptelfetat s2tm(mp;o1tetomi3tasla rl(mo t)tltnxo3oo1omDr u i t srtr(m3nudlptn ictl(fsrtmxrpou4alxo fetatlm rm(von(0aetoxf3iodoaD anesls0 etmio3oodol n ncsl(f rum( pot1teto ieiydfaDea(vp;()tlxrmf3iadlmt lnvs ( teuo(m3ny4ol nmfcta(  2uaxmont1tlenmo3tat m emnvo t4tlxomfcootfmDrai i t0 2tmxopio1lm  lfes tf Dumxm ;o0tpx  ocilt s2eauvs;()artrmf3iatlp  ln i t  2xrxrpnu1am  livtlt)s2trxm ot4texnifciatfm rluvp;t) rtrif tadlm   ueslt  2toxo3oy4lmt lfctat  Dtm(ro;t4tee mfeiad a uan s;() eeoirciodfmt  ivo s0trxmim iu4omenlicsl( a2rr(m ou1opxn fciat s emu o u0alenifciydlaDran s;( seuoxr oo1lmtelnci s) Drmur ;o1aleoifetat sDulnvp;(0teeomo3ia1lpte ivi t0setoxrpnydlm   iviat aDta(ro;u4tlt  f3iysfsDel(monu0altoxfciadoaDe neil( seuoxo iydamenlfesasfaDrmumpno0apx  ictlsfa emnvo;u0 leoxrcoy1laD lies;s0seurim oydole lfes s) 2ra(root4aptnmicias aDuln p;t0aeerxrciatfp e ieilt)trto(o oo4om nmiesls) Drmxmono0oetoif3ild a ul( o;u)alxnmf3oadfpDeai i t)setmxm3oy1lmtn fesl(fs2trx  ;o4aetnifctltlaDul( onu) exrmo oatlmDe ivi (0s2xo(rpou4ll nlfeslsf 2tmxm ou1oetoiociltlsDra(vsnt0alerxf iydfmD aieols)sexr(o oy1llt mfes (f ruaxmoou0aexnioetldlm2ua(vp;t0 rxoir3todfaD au o;(0 ruoxo3oo1optnmieils aruau pot4openifeiysfs umump u4 lerircoydfmD  u i;() euoxo ny1opeemfet t)s2trxr nt4opx if3taslsDuan snu4tlerir oydfa rli o (0 etrio3nu1om n ieils sDur( pnu1tleoif3iysla ulu onu) lenmo3tydfmDr ueols) etmxm io1oltn ivia(fsrrmurpnu0oltomo3iytlm uau s;u4altnmo oadomtrluvol()tetoxr3nu4ll nmiesasfs2um(r ot0alxo i3ils m eau s ()altoxo3oo1opteaieils) etrxmpiydoptemici s) Drau pot4tpen o3tytfaDrm(vonu4tltnxfciodlptean i t0seur(r3io4ome licilt sDtm(mo;o1ope ifciydlaDrlumo;t0 ltoifctytomD aueilt)teuo(o iu1lptemnetl(faDtmum nt0oltoiiciydfs2ra(vs t0artrxf3iotlat auvslt s2xr(r3nudape lnvslt)aruau pnt1texn fetasls rmnvs u0 etrircoy1faD aivs ( sexm(rpnu4op elnesat a2tm(rp;o0olt mi3iadfm2ul(vp;u0 etoxo3todfptr ieo;s0 etoxopno4aptn ieias sDuaxr ou4opxnif3iytfs2emuvo;(0 renifciotlat livi;(0teto(rpnu4op nmfetas srurxrpno1opeo ietadla2eluvpn(4arxnxo oodlpDe ivils)s2xmiopoodomt mfciat s2tm( ooo1apx moetltlmDrau o u0tlxomfcoydom eau ols0s2urim3oy1lmeelfeslt)srumu pnu4oee ifcilsfs2elnms;u) exnir3tadla  lues ()trxmxmpiodamtelfeta() Drrumpot0aeeo oeiadla rmums;() eeoxf oodfpt  u s;(  rxrimpoudalen ivia(fa2rrumoot0tptniiciad m uan s u0 ltnxr3oydlm raies (0 euoxr3no1alt  nvtlsf 2rrxrpnu0texoif3ias a2emu o;() eenxfciydfpt  i o;( tetrxrpno1olen ies ()s2ua( p;o0aeeo fctat aDuluvs u0trxrxocoydop r nvi;(0seur(o3iydop nlncias aDuaxro;t0tpx  i3tasfm2ulumpnt)artnif tytfpDr ivilt)seur(o oodlme mieta(f 2umx o;u0oee  fciydfs ra( p u) lxnmo tytfpte nvsl()teuoirpno1lpe lnvtas s2ua(rp;o0alxoifctld sDumnms t0tlxnxrciy1fpDrauvi;s0setmimpiy4amtemneslsf rrau poo4tleoiictltfsDel(vpnu4aeenxr tydla eau ilt seuoxrpiudopenlfvsa(fsDtru o;t0apx iieiytfmDulnmpnu0tlxnmo3iydom eau s;s  rxmimpoo4lm n fvtl(  2tax oot0alxnioetatfm2ranmo;u)alermf3iatoat  uei s0 exmiopiu1lm n ieils) Drmur ;t0teeo f3tlt s2ranvo t0trtrxo oatoatrluvo;s0 etoir iudlleelfctl() rtmx o;o4tle  ociytlsDrm( o t4alerif ootlmDeai s;()trtmio nodoltnmfctat)srrmx o;t4tleo octatlm uan s u0alermf iadfat  ueil(0trurir oo1amtemfvi t srtm( pno1teen fctaslmDulnvonu4altrio3oatopD  ieols0srtrim3oo1omtn fes s  2rruro;t0altoifciasfa2ul(mont)arerifcty1fa raiesl(0 rumxmpoudol nmivtat sDur(  no0oex  o3iasfsDemu s;u) lxnir3oatfmD  uvo s  2tmxopoo4oltelfetls aDtm( ooo0opxoioetys sDulumo;u0 etnir tatfmDe n s;(0teuoxr3nu1omte ics t)arraurooo0apt io3iasfs2elnvs t)alxnio3io1fmD  ues;(0srum(r nu1lltemfetls)srtaxroou1aeto ieiysfs2rl(vp;()trermfctatfa eauei;(0t2xoxopnodamenliesat  rrm( onu4apxoiictatlsDea( o (4texoioctytoptrai i t) 2toim iy4ll eliviasf Dtrum ;u0alt mictytla eaump;(0 lxrmf oodom eaivi;t) euoiopiodom  lnvi s)a2urxmpnu1oet ifctlt aDrm(vonu4aexrxr3oo1oaDraneolt tetoim3oo1omtelfcsa(f 2rru ono0tlx iictyt s uanvo t)texomfciydlpDrlies;()srtrimpiy4optn ncsa(f rrrxmpnt1texo ocilsfm em(vp;()tltrmo tydlaD au ils  2xo(m3ny4lltelfcta(f rtrxm ;t1tpxniocildfmDumumo;u0altoxfciatfat an i;s)setr(r3iy4olenlnvi (fsDtr(ro;t4aeeoiociydlaDrlnvs;() rxriocto1fpte i s;s)srtrim3ou4optnliet t) Dtmx pnt1olxoiiciytfs rluvon()trxoir oo1oatean i;() eto(rpio4al nmies t)arur(rp;o4tex micild m ulumo t0 renmfctodlmDeaivols)setmxm3nodol e fvt t aDtr( oot1tpxo o3iytfs2rl( sn(0trxrxo3todfpDelu il()trxoxm3ou1lmtnmnvt t)srtau  oo4tltn iciltlm2ranmont0 rxoifcoadfpDelneils0s2tr(m3iy4olenmncs t a2tmu  ot0tlxo i3tyd sDra( p t4 lxoiocoy1fmte ivi t) rtr(mpio1oleemivtltfaruaurpoo4tpeomfeiltlmDuaumo;u) etnxr iatopt au o ()texo(o nodamt  netls)a2urur oo4oeenioetadfsDel(mo;t)altrmo3oytlatrau i;t)s2xmxr3iy4lmenlivtlsfsrumu ont1tee micildfaDrmu sn(4artnif tadom r u i () 2xmim nu4ll elneiasfa2ra(  no0tet ifciyslsDeauvs t4tlxomo3tadlm r ueo (0 2to(m ou4alt  fetas)aDtmurpot0tex  oetlsfs2elump;(4texnir oatlmDrlivsl(0 2xoim ou1olen fetat s2rmxrpou0ole ifciat a uaump u0tlxrmrcoydfptrlivs s0 2xmirpoudlmt  iei ()aDrm(  nt0tlxn ictlsfmDuanvo;t)teenxf oadop eanvs ()s2trim ny4aptn fcsl( sDrm( ont0olt  feilslaDemump;t4 rxoio ty1laDe uvi;() exmxm iy1op  livi () ruauro;t0altoio3iatla2ea( p u0altnmo todlmtrauvi ( tetm(m iy1alee ietls)s2urxro;u0aptomfciytfs2ulu sn(0teermfcoydfmDelnesl()teto(mpio4omt mies t sDtmxmonu1tpe  f3tls aDeauvs u)aeermfciydlm raueilt0tetm(m iy4oltemfvtltfs2tru poo1ope ifcild m2rlump;t0 reoir oodoaD au s t texrxr3iu4op emnvs t) rrr( pnt4tee  f3tls mDranmo u4 etrmf3ty1fatraieols) exoimpiu4lmtelnctat  Drrum ot4olxo ociys aDran pnt)aeermf ty1om r ivilt0seuo(o nydlpen nvi t)aDuaumooo4tpxoifcias m2el(vp () rerxfcoatfm  lnvo;( sexriopnydaptemivi () rtrxro;t0oexnmieiat mDumn p t0alxnio3iadfmteanvilt srxrxo3oodlptn ietlt  2trx o;t1olto ociltla emnmp (4altrmf3tydfa elivils  2tr(o nudaltelfvtls aDtaurpnt0teeomo3iasfm2el(mp u)areomf3tatomDe ivs;( trtm(rpiudapee fetl()s2rr(mo;o4olxnmo3iytlm ea(ms;(0 lxoxf tydlm e u s t  exmir3io1am n fvsa( s2urx p;u4apxnii3tasfm uan s u0trxniocoytfaDr nes;(0s2xr(opiy1ll elict t artmxrpou0tpen ieiytfsDemu p u4tlerio oo1fmtr uvi;t)t2trio nudapeemfctlt arta(  oo4tpxoioctatls2uauvp u0 rxrxfcoytfp elu sls)s2umxr3oudoltemfes ()a2trurpot1tpe  ictytls elump ()altrmfcoodfpt lnei;( t2toim3oodamtemfctltf ruax  ;o4alen ietltlm umuvs;u0altnif iy1laDrlivs () etrio iu1lpte feils  2taurp;o0tlenmociasfaDum( s;u)tlxnmf3ia1fm e neolt0s2tm(r oy1al  lictls  Drr(rpnt1ope  feiatfsDulu pnu4arxnxo3oodoatrln o;( t2xoxr3nu1lmenlnet (f rumu  oo1aex  octld m um(mo;t4 exnmfcoodomt ln ilt) exoxrpnu4lme  fciltf 2rax oot4oex iiciaslm2ra(mpnu4alxrif io1lmtr uvi;s  exmxm nudome liet (  Dtm(ronu1tlt  i3iydlm2um(ms t4 rtomf3oodom r ieolt  2xoirpnudamtn ict sf 2ta( pot0oet iieiydfm umnmo (4 eenxrctydoa rli s ( t2xmir ou1lle  iciltf Dtau  ;o1alxn ocilsfaDelnvp;t4tlermoctatopD au i s)tetr(mpoodoptnmfctls) Duaxmo;o1tlt  iciltlm uluvs (4tltnxociadlaD  n ils0s2tm(r oo1op  mncils s2trxmo;u1apxnmoeilt sDranvo;u) lxnio oa1fptr uvilt0s2uoxo3nu4al  mfetl( aDtm(rpnu0oexoifetlslaDrlu p t4alxoxo3tydfm eln o;(0 eto(o3no4lltelncslsfa2tax  ot1tetnmfeiltfm uluvp;t4aetrxo oa1lmtelu ol(0seumirpiudal emict (f 2uaxm ou0aeto iciys mDua( pnu0tlenmocoodomte i o t srxrxrpnu1olt  fct s sDrm(mpnu1tetn ieiytlaDemnvs;(0trerir tatoatrauvo s0 rumxo3oo1apeelnciat) Dtmxmoot4tpxn ociysls2umn pnu4altnmf todoptranvilt0srxo(r3oodlpenmfcta( a2umxroot1aleomieiat a rluvpnu4teeoxf3oa1fatr i sls) etmxm iy1lm  mivs sfsrraxm ot4aexo icilsls2emumo;t0altrir tadoaDeanvi t  exmxr3oo1ome lncsa( arra(  nt0olenmo3iadlmDua( o;t4aexoio3tadfp r u o t0s2toiopnodolt lfesa()arum( oot1alt  o3ildlm2rmu s;t4artoifcoadla eai o () 2to(m3io4olt lnctatf 2trxm nu4oexnio3tadfm2uan pnt) rermf3oodoa r i o s)s2umim oy1apt mnviat)s2rmurono1optnmf3iysla2umn s;t4 etnmf3totomteaivi t)teurxo oydopt  ivs ()artmumooo1ope if3iadfmDuauvo (0trenmo3oo1lmDrlneo s) rtoir nu1ap nlncias) 2um(mpnu0tpe  f3tydlm eaumo (4 exrmo tatop  aueilt) eurxopiudlp nliet (fsrtr(ront4apenmfetasfsDeauvont0arenio ty1fpD aiesls  etoxo oydlmtelfctasfs2taumpot0openiociysfs um( p;t0 renxrcoy1fmDr ivolt) 2trxr nu1opt lnvia(f ruau  ou0teeoiociasfa eau s u)aetrio iydomDeaieols)setr(rpoodlp e fvs ( arumxr nu1tpxo i3tldfaDua( o;t4 reriocoa1laDr n ols trtr(o io1ale lnei s sDrr(mont0ope  oeiad s elnvp t)aetrxf iytopte ueo;(  etmirpiu4lp nmneil()s2ta( ooo0tpeo oetadlm2uln s;t4trxomocta1omt ai s s  exoxopny1lpe mfci t  Dumxmo;t0tpeomociadlm2um(msnt0 ltnxfcia1fp eau i;t tetoxrpiu4oltelfesl( a2ta(r oo0tpeoifciaslmDuau p t4 lxoif3iatlateai o;t  2toxr3iy1omee fvs tfs2tm(  ;o0oetnifcilt a rau snu) etrxrcty1lmD lu ilt  2trxr ou4op n neiat a2urxrpnt0aetn fctytls ul(ms;()arenmrciotfp elnes s0 exoir3nydam emieias a2rrxrpot0optnmi3tysls2em( s;u4 rerxfcoodfm  auvolt  exo(rpno4ale  fvta()aDum(  ;o1teen ietasfa2rln s ()aexnirctydlaD lueol(0setrim3iy4apenlnvtas)sDrax ono0tlxnif3ias mDul(vonu)tltomocoy1fp   ivo (0s2tmxopio1al nmfvi t  2ua(rpou0aet ii3iatfm rmuvp t0texrmo3oy1opt livs;(0teuoir3io4ol nmiesasfsrua(m nu0aptniietlt mDua(mpn()teenxfciodlaDrlu i t  2uoio3nydlpenmieil(  2taumooo1oet ii3tys m ul(ms;(0altoxr todoate nvsls0trxm(mpoudamtelfeilt)arrr(r nt0aetnmoctys m eanvp u4 lenxo3iodoptrlnvo t) etoxr ny1ol e icsa(faDtmu pnt1tlxn ociysfmDea(mp u)altoir3iotfaD ln il()s2urim3ny1lp   ivi tfsDrau pnu4aex ifeiaslm emu sn() lenxoctotomte ues (0trur(r iy4lmte icils)artau  ;t1tlt moetasls rmnmo u)tetriocoydop rluei;() euo(m3nu1lp elivsa() Dua(r ;u4opt  ociat m2rmnvs;u0altnmocoy1fmtrln s;(0 rtoim io1olenlicsa(faDtr(mpot0tltoioeilt a2ean o ()aetrxociatoa   u s;s) 2xrxr3nu4lme  fei s a2umur ou0olto ociydfaDrau ont0teenifciodopD ln s;( s2uoir3nydll   feil()srtm(m ot0ope  i3tatlm2eanvon(4texoirciadla rluvolt0 rxr(r3iydapt mivtasfarta(r nu4tpto ociys m rl(ms t)arxnio3oadoa elneilt0tetrxr ny1llt livsasf rraum no1olxomfctldla uluvp t)artoxfcoadlmDr i s;()t2xmxr3ny1oleelivsls  ruaurooo4oex ifetytla2ran o;u4teenmf iy1lp  lues ()s2urxrpoudape lnei s  Dra(ronu0optnioeiasfaDrmnmo;(0aleoxrctodla   uvsl(0s2trxo ou4aptemiei tfsrrrxrpoo4olt ifciysfsDemu o;(0texoiocoadfa eaivolt0 exoio iu1om e nvi t sruru pou4alenmfeiytls2rln p;t4alenxo3oytop r i o;s  exo(mpny4amtelnvt (  2tau  nu0olx iiciadfs ea(mo;() ltnxr tadomt lu o;( t2tr(o ny4apee ictl(fsrrax  nu0apenifeiyslsDrmumo;u)teerir to1oa elivo s trxm(o3iy4am  lnvsls) 2taump;t0tlt  o3iaslsDrlnmp t)tetrmo3iodlm   nvo;()t2urir nu4om  livsas aDtmxr nu0texomoeilsfm rm(vs ()tlenxo3oytfaDe neo s)s2tm(o3nudopt micsat  rtaxr ;o0ole  oetatla ea(mo t) exomocoa1fat an i s0texrirpno1op nlicsls)a2rrx p;t4texomoetadls2rm(ms;(4arerioctydlpDeanes t tetrxopoo4opee fviltf 2rr(rpou0tpxomf3iytlm elump;t)altomoctotfptrlueils  ruoxopnu4ap  lfci ()artr(  nt1oee iieiys m umuvsn()aexoif iodfpteln s t)trurxmpiy4open fci ( aDumu pou4tlenioctyd m2elnmont)teerircto1laDran i;()seurxm3oy1ll emnvils s2uax  no0oee  o3tlsla2um( s;() etrmocty1fptr iesl(  2umim3nydlm e nvia()sDuru  oo4altomietasls ra( s ()arxrifcoa1fpD liei t) rxoirpno4ll nmnct s s2tmxro;u0tet  o3ilt s2rluvs;t0arxnir3iotoateaiesls0t2toxr3ny1ale lici t)aDum(  ;o4aetomfeilslsDemnvp;t4 exrif3iydfmtelneo (0sruoxmpnydlle mnetat a2ur(m nt1apx iiciat s ua(mo u0 eenmr3tytlptrlues ()s2to(o3io1opte fctat)a2raxm nt4aeenmociltla eluvont)alxrio3tydfm ranes ()seuoxo ou1opt lfvias  Dtaurooo1aleomo3tlsfm rluvs;t)trxnxfcta1lpDr u o;( srto(mpoydlpt mnvslsfs2urur ot0alenmociadlm um(vs;(4 renxrcoodoaD  nvi;t0tetrxr io1lme  iviltfsDur(rpnu4apeo i3iadfs rm(msn() rtrxocoo1oateaneil(0srtmim3io1apt lfvtasfa2ua( o;o0olx iociat a2uln p;() rtrif3oy1fpt aivils s2xrxopoo4am e nvils sDtr(rp;u0oeeomf3iad sDemu s (4 ltrxr oo1fmtranvs s)sruoxrpiy4apeemicsa()a2ur(  no1olxn i3iyt mDea( snu)trxnxf todlm r u i;s sruo(m iu1oltnlivils)arua( p;u0oet mo3ilslsDea( pnt)tleoxociytfa e u s s  exrxm3iy4op nmfcslsfsDtax p;t1opx if3ildlsDel( o;t0tltoif to1lpt luvi (0 2uriopou1amen ict (fs2raurono1aetnmociytfaDum( o u)trxomo3tytlmte uvo;(0tetoxmpiy1alt mfvils)srrrurp;o4olt  oeiltfaDumums;u4trenxo oo1opDe n s s  euoiopnodaptn fcsat sDtmu p;u4apeoiictlsfa2ran pnt4texoifciadom  aivolt texrxrpiu4lp  lfvilt)srtrx  ;t1apenifciatlm eau s;u0teermo3oa1fpDeli i t)texr(r3io1oltn fcta(fartm(r ou1tex io3iys s ulu s u)artnifciy1fp rlivs;t) etmir nydol elnvsat s2rm(m nu0aexoiicilsfaDrmn o;()aeeoxr oodomDr uvo;t teum(m ou4ole lieil(fa2ur( pot0teeomo3tls a2emums;()arerxrciadoa elnvols) exmxm3ny4altn iet t  2trur ;o4aet  fciydlaDrau p;(0tlxrxf ta1oaDrlueil( trto(opou1ll elncsas  Duax  ou0tpeomicils m ea(vs;t4arenmf3iy1om rliesls)s2xo(rpoydamen nvtl(farurx pot0oee if3iydfm2ean o (0trxnxo oa1om eluvi;s0sexoiopny4ll n nvtl(f rrm(ronu4oeenmf3iasfa ulu p;u) ltoioctodfatr uvs ( trur(mpno1ap nmieiasfarur(rooo4aexomf3iatlaDrl(vo;t0arxniociy1fpDe nei;()t2to(r no4altn nei ( a2umum nu1aleo f3tld s uaump;(0 rxrio3iy1faDean sls)t2uoxrpiy4lpe lnvsa(  Dtm(  nt0olxomo3iysfs2rauvs;t4tltrxfciy1fpDeanes s t2uoxm3nodoptn fvia( srrr( onu1opx mi3tyt m elu snt4 renxo3iy1fatrlnei;(  etrir3iodomtnmivtlsfa2ta(rp;o4oexn ictyd s2ua( o (0 ltoxf iatlpteaivi s0trtoxopio1amenlivilt  Dtr(rp;t4tlxn ociat mDumnvont4tlermfctytop rau o ( trumxmpnodole lnes t arurumpnu0tetoio3tldlm umnmp () rerxf ty1opD auvi s0 etmir nu4alen net t)sDua(m nu4ole ioeiys a ea(mpnu4 exnmr3io1fptrluvo;t)seumir3oodomtnlnvta(fsrraurpno1oeenmociltfs rl( snu4 lerio io1fa   nes s  rtr(rpnodlltnlneiltfsrrrum ou1ale mfcild m ean o;()aeeoio3oydoa eai ilt0t2urim iu4lmenmiesls)s2ur(mpnt0tlen ieiys sDuln o u)arxrmf3tytom   uesls seuoxm iodlme  nvslt a2rru p;o1tlxnmf3iasfa2uau p u0arxrif iatfpte nvi t)srxr(opoydale  nvil(  rtr(mpoo4tlt iiciatfm uaumo;u0teenxf todfptrluvol(0t2tmxm3iydap nmivsltfs2uaumont4tpx iociytfaDrm(ms (0artoiociydlaDr ivi s s2ur(m io4ll  lnvtat aDurur ;u0tee ifciltfs ulumon(0 rtnmo3io1lmD au o t0 rxmir iu4apte nvslt)aDua( pno0oeenmicias aDem(vs;(4 leomrciy1fatrlnvsl()trto(mpiydalee nctl(fsrumx o;t1tpto f3ilsfs elnvon()aetomf3ia1op r nes t0s2urxo3oy4lpt mictl()arrmxmont0altomf3iatfm ranmp;u4 rtrmr oodopDeau il(0t2uo(o ou1lpeelnvi tfaDraur ;u0aee ii3iasfs el(vs t0teerif3oa1fatr i olt0t2toxopiu1aptn icslsfa2um(mo;o4apx  feiyt m2em(vo;u0areomo3io1la e ieo () etrxmpnodole mfeia()arra(ro;u4tpeomfctldfs ra(msn(4 reoxr iytfmDelnesl(0seurxo3ou4llt lfct ()a2uaxr oo0tpeoifetldfs umnvp u0aetnxo tydfpDelu o s t2xoim no1ap elfvtltfsrtaum ou4olx  octatfa emnvsnt4arxnxrcoodomteanvols t2tr(m3oo4apenlfcs ()srrmumpnu4aeenioetyd a ra(vo;t0tlxrxr3iatop  auvols seurirpoy4ame  ivsat s2taxm ot4oeen ieildls rmums;(4 exnmo io1lptr neols trxrim ou1lptnlnes t) 2umxm no4teto o3tls a ra(von(0trxrxr iy1fa rau olt0sexo(m3oudol elivsls)srrrxrpot1aeeo fctldfa emn p;t) reoio3iytfaDr ivs ( tetoxrpiy4al  mnes sf 2urumoou1optoifctad mDua( o;(0treoxfciytlmt  nvsls0srxmio3iudol emicslt  Duaum nt4altomocils s elnvs (0 eerxr3oo1lpDe ivslt0srur(m io4olt mictlt)sDtaxro;u0aexnioeildls2elnvp;u0artnxf3iy1la r ivo;(0trurxo3ou1lmt mfvsasf Durum ou4aeenmo3iysfsDemnmo t)trxomf3tatfm e n sl()srtmxm3oodlp nmfes ( a2rmur no4ope ifctlslsDranvs;(0 exrmf ta1fatrai o s)t2uoio ny4al e nctltf 2rauroou1opt mietlsfa uanmo (4artnxfctotfp r iei;s)t2ur(rpiu1oleemfesl(f Dtaxronu4oexnioctad s em( s;(4 ltrir3oa1omDeanei;( setrxr3iu1optnmnctls)arrmxmp;u4texnifctaslm em(msnt4 ltrxf todfmDrln s (0truo(o iu4op e nvils a2ua(  nt0aetoio3iltfa em(monu)altrxo iydoa  au i;t sexmxo3nu1am e fcils arurxroou1optnioctydfmDul(vsnu)trtrxf todlpt lieo;t  rxmxr nodaptnliesls a2ua(m ;t4opxn fciadfs2umn pnu)tlxoxrciytlmDr uvs;t)srxrim3no1aptn ivs tfsrtr(mpnt0altomoetys s ranms;(0 renirciydlateliesls)s2xm(rpio4apt mict t)srtrumpno0tlxo oetat a2uanmp u)arxnxr iodfmD  uvols0trxmim io4om n fcilsf Dtr(r ou4aex  fciysls2ra( s t4aetrxoctytfaDr ivsl(0trumxm3iydame  ietat) 2tmxro;t1tpenmi3tasfmDrlnvpnt4teeomr3ootfaDrlu o s0trxoio3oy4lleelncil( aDuaurp;t1apenmociys mDean o u)altoio ia1fatrau o t) rumxm3iy4aptnlfcsl(fs2raum ;t1ale mictltlm2rlums;t4arenmrctadfpD  u ilt)trxrxm oydlmtn fcs () ruaur ;u4aleo i3tasfm eauvo;u0 rtnmrciytfaDrai s;t tetoxr oo4llenlfcia() Dua( pou4tptniieiyd a2emn p (0trxrif3oatfmtelneo;( t2trirpio1oleelicias s2umxrono4tpx ii3iytfm2umnmp t4 etnmfcta1latr u o s0setm(m oy4am  lneias) 2rmur ot1texoio3iad m emnvo t) eeoio totoa rlivsl(0s2tmxr3iy4ope lfet (farrrxr ot0oleomfeiytlm2ra(vonu0aeerxfcio1fm rlies;( srxoiopio4oleemnesa()aDta(rpot4alt moeiatfs2uanvs u)aleoir3oydfpD  ues s0tetmxm iodlpenlnvias) rtau p;o1tpxomf3tytfsDem(vs ()teerxo3io1fm  anvs ()trtmirpiodlleemfcta(  Dtrxr ;o1alxnmf3iasla uaump;t)tetrxrciadlmDeli s;t0 2xoxr oydll e fviatfsrtrxrpnt0aptnmoeiltfa2emnvon(4altoxr3ta1laD auvo t0teuoxm iu1op  mfeta(f Dtmxm no0aleo o3iatlm ulnmonu4arxnifciodfptr ivilt) 2trxmpoudom nmfeias)arumx ono0opt ifciysfs ua(vpnu) rxrmf3to1laDeln s t) 2toimpoy1ll e nci s artmuronu1oltn f3iyd sDumuvp;u0tetrir3oodlm r uvs;(  rtrio nydaptn nvils  rtm(rp;u4tlxoioetatfmDrl(von(4 lenxr3iy1lp rlneol( s2ur(m3oydlpen ncsls  2rmx pno1ole  f3iltfsDumu s () ltrmf oytfaDeau ilt s2toirpou1al n ivsat sDrrx p;t0tptn oetatfaDumnmont0 lenxo oa1fateluvo (  rxmim iydop   nvsa( sDtax ont0alen oetyt s2umu pnu4alerio3to1lmt  uvs t  eumxr3no1al nlfvs ()a2trurono1tpeoii3iat a2el( s u0tetnmr totoatrlnvi s0 rxmiopoo1lptn fctltfs2trxmpno0tpx  feiydfs2umu ont0alermrcoa1fp   nvsl( seum(m3oo4aptemfvs s arrr( o;u4tltoif3ias a2emu p u0tlxrxf3oatopt an s;s) rxrim3nodlmenmivtltfs2ra(rpnu4apt  ociytlaDulu p u4 lxrir3tydfpt ln o;t  etoim3iy4am e nvsas a2tmxmpot0tpeoifeiytlm2emums;t4trxnir3oo1lm eauvolt s2xrxopou4op  lnvtlt sDtaxro;o1aet mi3iltla rmuvp;t4tlenxrcta1oa r neo;t t2tr(mpoudlpeelies () rumxro;o0olt  fcild m2ulu p t)trxrmrcia1opDeau sl( texo(r3nodop nlneils sDraurp;o1aexn iciysfm rluvont4arenio iadfpD ai s (0 etm(mpoy1op emiesas) Drmx pot4texnmictlt s2emnmo ()aeenmfcoadfa eln o s0srur(o iy4op n nesls  rrmxmp;u1tlxomf3iatlaDrmu pn()aetoxf3oadopt auvo s srtrim3iodopt  fvilsfarrru oot1apx  ieiytls2ea(mo (4tetnmo tatfateln ilt sexmxmpiu4lmte ivtat)artau  ;t1aptoiociatfsDumuvp;t4arxrmrctadopt auvo t0 rto(o oy4lme  icsl(  2tax  ;t0aeeo ieils s ranmo (0altnxo tytlmDelnvo;s0 2tmir3oo4am  lfvt (farur(rp;o0tltniietyd mDrmuvs;t0tlerir3io1omtrlueo t0srtr(opoudamtemncsa(fs2ra( pot0aex  ieiydfm2ran o t0 leniocty1faD aieil() 2tm(m3iydlpt lfvt t)sDtaxro;o0oltomicild sDum(vpnu) reoir3ia1fpD  ies;s0s2xrxmpnu1ap e ics ( artau onu1aet  icias m2ulnvs t)tetnmf3iadfp eluvo;s) etrxopou1ole mieilt arua(m no0tleoifetldfsDuau s t)artrmoctatfatran s;s t2tr(m3io4oltn fcsl() Drm(m ot0alenmfciysla el( o (4alxoircoydlat li ils  etmio3ou4openlfctls)sDurxmoou1oleo i3iysfm elu sn(0 rxnmf oadfmDe ieo;t
\ No newline at end of file
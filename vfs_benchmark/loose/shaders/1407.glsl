@@ -0,0 +1 @@
+ues (  exo(o3io4optnlicsat  2rmu  no4openiocilsfa2elnmonu0aeenio tatla  lieo s0teur(o3oo1olen net ()sDtru  ;u0oleomiciytla2um(vo;(4 eenio3tytlmt auvol(  ruo(m nu4omen fetls) rrmx  ou1aexoii3iys m2eau pn(4trtrio3ta1lm rln ilt) 2xrir no4alt  net ()srur( p;t0alxomoeiasfsDemuvp u4altomrciodoatranvslt  rxo(o oodlp elictlt)srtrxrp;o0tlx  fetat a rm(mp (4 rxnmf3oatlp eau o;t teum(o3oudam nlfvi t)a2tmu o;u1ape ifciydfs2uanmp u0trxnxrcoa1opDe uvsls)s2to(mpno4am n ivia() Drmur nt4olxnmoctltfm rl(mo u)alenif totoaDrai o;s)tetmim3iy1ome mfvsasfsrtax  oo4apeomieildls2umn o t0 exoxfcootlatraivs s0trum(rpnu1am emfeia(fa2urumpot0aptoifcildlmDuan snt0trxrxo iydfmt luvol( seurir iy4olteliciasf Dra(rpot1alenmociatfm em(monu)arxomo3iydlp  li s;(  etoir no1llte fes s sDum(roou0aeenifciasfs ean s u)tleoxf oa1oaD lieo;() 2xoirpno1omtnmnes (f 2uaxm nu4olxoiiciadfa emump u0tlxrxr3iy1fa r ivs s texo(opny1lpenlfvtl(  2umxmpot0aexnmiciltlmDul(ms (4teenio iytomDeaies;()trtoio3nudlm n feslt  Drr( p;o4aeenioctyd a2elnmpnu)treoio oatopDranes;s setrim nudllt lfct s  Dtrur ;u1oexn ociltfmDemu pnu4tlxoxr tytfa eaieo s0srumxrpou4ll nmnetlt)aDum( p;u4altnmi3iasfm2umnvo;u0altoxr3iytop rlu o s0texrir nydlm  lfct t)aDrrx  ou1tee  feiydfsDrmnms t0tlxnir iytoatranvs s)trxoio3ny4ll  lieils arrr(r ou0tptomoetys a2rau s t0 etnmf3oa1lpDrli o (0 rur(m3oudolt mfei s) rtmx  nu4aeeomoeilslm2el(vp;(0tlenmf3ta1lat auei ( s2um(r no1omtelfvta()aDtmx oou0tetnmicild a uanms t0 eerircootfmDrlnei;t)trtmim3nydllt  ieil()sDumu  ou4apxoifctysfsDemnvo u4 etnmociydlp elnvols t2xrxrpiy4optnmivs s aDum(m no1apto ocilt a ra( o u0trxnmfcia1lat  nvils)s2umir iu4omeemnvt () Dumxmpnt0altoioetldfa2um( s;()alenifcty1lptrli s s) 2toxmpny4aptn fvtat s2tmumono4oeen fciatls2uanvo;t0 eerir iodlm ranvs s sexm(r ny4am emieia( srtau pnu1aetomoeiatfmDuanvp;u4aexrifcoo1la r ueols sexrxm iudame mfesl()s2tmumooo1aptn i3iltfsDrmuvsnt) lxoir3tadomtrau i (0 2urimpou1amtnlnesas srrmurp;o1tpt if3iysls ranmont0aexnio iotfmDr ivs (0 rtoxm3oudam  mfcta()sDta(  nu1aeto ietydlsDuluvp;u)tetrmo3io1omt  u i s0 2um(rpio4oltelnvil()aruax  ;u1ole  ictadfaDeluvp;(0 lxnifciatfaDeau sl()s2xoir ou1lle miviltfarra(mooo4altomiciasls2eanms (0 lxnio3oadla e nvs;s0setr(m ou1alenlfet sfsrurum nu0olx if3iasls2uln o;u4alxomo ta1oa  auvi s t2umxr3iudomeelivsltfaDuau p;t0opx mictlt m2emu pn(4 eerxoctotfpDelnes;( sexmimpoy1ameemict s) rumx ont0olxn ietld a ranvo u) etrmo3oy1lptrlies ( sruo(m3iydomenlnvtas aDtmxr ;t1olx  i3iltla ean pnu)areomr oadoatr ueilt trxo(m3io4lpe lfei s sDrr(  ;t0oee  ieiysfm2rl(monu0trtnmocio1lptelieils0 2uoxo oo1amte nctlsfsDtrx pot0oexnmicils a2rl( o (4arxnxr3iodop e ivs;s)srxrio3ny1optnlnct (fs2raum oo0apt mieildfa ulnvs;() exniocty1fmtr nvs;t srxm(o nodll  lics (  2trx ont0tpxnmieiyt sDrln p u4 reoif3oa1omD lneo;s s2urimpiy1lmt  fvsat) rumur oo1tpe moctydls rm( snt)aexoxfcoatfptr u s (0srxoxopoodome licia(  2rmxrpou4ope  ictyt m2eluvpnt0artomfciatlmtran i t) ruoxrpiy4lltelnvi tfarta(mpno4apxnmoctlsls rmn o t4tlxnxf ta1fa eluvi;s trtm(m ny1am nlfctl()s2raxm oo4tpx  ieiad sDrau p u)trtnir3ia1faDeauvo t) 2urio iu4opt lnet ( arumumpno0tleo ieilt aDum(mo;u4tlermrcoydfa rluvslt trxo(o3oydol   ivi (f 2taum ;t4aet  o3iytfs ulumpnu)trenxf tatlptr ivsl(0trurim iudlmtemivi t) Dtm(  ;t1aeen i3iysfaDemnmo (4 leoxociotfateaiei (  rxm(r3nu1om e feia()a2rrxmoot0tlenmf3tyt mDemuvpn() leomocty1lpDeaieo (  etoio oo1ame  fctlt)a2uaxr nt4tlx if3tldfmDrmnmpnt4 leoxr3oodfmtrlieolt0s2tmxo no1ome  ieiat)srrr(rono1teen fciltls ua(vp;(4arenmocia1fp rlnvol() euoxm3ny1lp e neils)sruru  ;o4oee ioctasla2ea(vonu4 eeomr3oytfaDe i sls) etmxmpoy1op e nvi (f Duaxm ;t0texoii3ias a2em(vsnt)tltnxfcio1oaDrlnvo;s) exoxo nu4lptemieiat  Dtm(m nt0apt  f3tyt s em(mp t0aleomf ty1lp  aieo ( t2toio nu4lmen ies ()arta(m ;t1tetn feiltlaDuln p u0texoxf3oadfp elnes;(0t2xrimpiodamtelietatfsrrm(root1tpxnif3tlt m2ra(von(0trxnmo io1oa elivi (  2xo(r3nu4alte ieslsfs2rrum nu1tee  o3iyslsDrl(vpnt)trtrmf3oadfm r ues;t0t2uo(opiu1lp nlici ( arrmxmp;t0ale ifeiadfm ulnmonu4 rxrif ootoaD ln s;s  etoxm3ou4apenmneia(fsrrax o;t4tetn iciytfa rl(msnu4tlxnirciytlp e ues;(  exrxmpiodlpeemnvs sfaDum(mpou0olxn feilt mDran on(4aeeoirciadop   iesl(0t2urir nu1ale lncilsfsruau poo0apt mo3ild s2emu pnt0altrxociotfaDeli sls0setmim oo4lltn fvt t srraxroot0tptnmfeilsls ulnms;u)alenif iatopte uvi;(0setmxmpoydamt mfcsa(fartax  ;u0tlto fctls a2um(mpnt4texnmr3oadoatr ieols seuoimpny4ol elictasfsruau ono0aexoiociysla2eln snt0 etoir3ia1omD lues ()seurxo iodole  ics t sDtrum ;o1tlxniiciltlmDeanmonu0 exoxo ootfaD au s s0tetmiopno1am  miesat sruaxm nt1opx ioeildla eauvsnu4teermrctatopDeauvsls0sruoxr nudlme lnvt tf rtaumooo4oltn o3tls s2umnvont4 lxoxo3ty1faD lieo;(0s2um(opoodaltn fcsat)sDua(mpoo0tetnif3tls mDean p (0 lxnxf oadfaD an i s  etoxr no1op  mfvt sf 2rrxmpnt1tlt  icils s2ulnmon(0trxrio tadom  lu i s trxmxo3ou1omtemict ( arrmxmont4alxo feiaslaDeluvonu)artnxfcoatoaDraues;() etr(m3nu4llt mics t)artm(ro;u0optomf3tysfa2rln s;u0trxrmf oadomDrlies;()srumim3io1lpt  neilt  Drmx pnu0tltomiciad s em( s u0 etomoctadfp  lnvo ( t2tm(m oo4al  lnvsls) 2raump;t1opxo i3tltlsDumnmp t)aexoir tydlatr ies;(0trxoirpiydapt  nes ()aDraxr oo1oltn f3ild a2rauvp;(4treoifcootlm rln slt seumir3nydalt mictas  2rru p;o4aeeo fcildfs2rmnvo;t4 lerifcta1la eluesls)tetmxrpoo1opeemneslt  rtmx  oo4tlx  o3tytlm rlu on(0 leoifcia1opDeai o (0trxmxrpnudape mnet sf rtaumpoo4oeeo fctlsfmDea(ms;t0 eeomo3iytlm e uvil()trtoxm3oydlpe lnviltfs2tru p;t0apx moetydfs umumon(0trxnio3iatfpDrliei;s seumxo ny4lp emivt t  rrm(mpot4tlt mociysfa rlumon(4 rtrio ootoptr uei t seurio nodll  mfcta(farrrxmono0opxn fcildfmDelnmp (0 leomo3iodfa  ai i s s2xmxo nu1ome lietls) 2uaxr ;t4olxo fciys m em(vs;u0 lxnmf3oytlm rai i;t)t2tm(mpnydlmt licils  2rax oou1tlt  feiatlsDrm(ms t)arxrmf to1optean il( tetrxo ou1al   ivilt)a2rrxr ;u4opxomicias a ra( ont4 leomo oa1opDeli o;t)t2tmir3nodlltnlictasf Dtaxmp;o0tet io3iydlaDranvo;u)altoif totfp eli o;s0s2xr(o3oy1lp elnvtl(fs2rmum ;u1aex  ocilslmDuluvs (4teenxo3oytoptrau i () rto(rpio1ll  lncsas)s2tm(ro;t1tpto i3iys mDean pnt) rtrir3iadoptrln o ( seurxm ou4lptnmiei tfarrrxrp;t4alxo iciad aDean p;t4 eeoxr oodfate ieslt0trtmir oo4apee ivsatfsrta( pot0tlxomfeildla em(vpnu4 eenxfcoytlmt auvo ( srum(r ny4lpen nesas)arumx oot0opxn o3tysls2rluvs (4altnmfcoatopDr i ol(  exmxmpoy1optemnesas) Dua(monu1alx iiciyslsDuanmo u)aetrifctytopDrluvilt0 rumio3nu4omtnmfcs ( arta(r ot4opeoiictys aDelnvont) leoif3iy1fa  lu il(0 euo(opiydllt  neiat a2taur ;u4olx ii3tlsls2em(vs;t0tltomo todlpDe ivil(0tetrio3iodlm   ict t aDta(r ot4aexoio3ilt aDul(monu)tlerio3tytop e ueols0trtrio oy1lmenmnvt (  Dtax pnt0tpeoifetytfs ea( on(0 exrio iy1lmDeaies (0s2tr(mpoudap  licsatf 2tm(r ;o1opto feils s ul(mpnt0alxrif todfptr uvs s0seum(r iu1opt mfeil(f rua(mooo1oex  o3ilt s2ua( o (4aexomf3todlmtranvs;t0trtrxrpnodll emfvsatfs2umurpou0oee  o3iatlmDulnvonu4tlxnxr3iadfmDr n i;()setmirpiu4ol   fvt s)a2rmx  oo0apeo o3ilslm2ulump;t)trxrmf3tadoa rauvslt teurimpiydal   feta(fs2ra( p;u0alxomfciysfm2ulnvs u0altoxf3tydom elu o;s0 rurxrpiudol  livi s sDum(r ;t1oeenmfeiasfs2rmn s;t4tltnmr iytfaDeanvs;() 2uoio3oy1openlfcs ( a2raxr ;u0olto fciatla ean s;t4aetnxfcta1op r uvs;t  eumxr oo4op emfvt s) 2raxr nu0tet mieiyslm2uauvo;() ltnmr3ia1faD lieolt)trumxr3iudamen fcs ( aDrmurpot1tpe mi3ias m rl(ms;(4 ltrio iodop e u s ( srurxm3ou4ol emici t) rurxmono4tpxnmi3iyslm2rlnvo ()aexnmr3iytlptr uei;t)srxr(mpoudomenmnes s sDrrxm nt4apxnmiciytlsDra(vpnt)tetnif oydoa eaneilt  2xrxrpiu4om  lieil( aDrru onu0aptnif3tldfaDulumo u)alerxo3iydom r n s s0 rxm(r oy4aptemnei () Dtrump;u0tlxo o3tydlm emuvpn(4texrxociodomDeln ilt) 2trir3oudap nmnvsa( a2ur( o;u1optomi3ils m2ea( p;u0texnxfcoytopte nvols t2tm(rpoy4altn neta()aDrm(mpou1opt mfeiydlm2uanvo;t4 lenirctotfptr i o;t texr(o oodol nmnctls)aDtr( o;t0oeeoiicildfm2elnvo;u4tltnmr to1fp elu olt) exoxm3oo4alee neiat) Dta(ro;u0tpenmieildfmDel(ms;u0tlenxo3iodfp e uvi s)t2uoxo oy1omtn fei s)sDtru pnt4oetn feiltfmDrmuvsnu)treomfcoodfpte neo () 2xmxr3oo1ap e ivsasfaruaump;u1aet ioctadlmDulnvp t)areoio3oytfmteanesls  rxo(opnodal emfeil(fsDumumont4opx  f3iad a2ua( o;t) reomfciydop  an ol(  rxriopio4lleemivia() rumxrpno0opxo i3iysla2eau p;t) lenmf3iatfp  luvsls)srurir3nu4om nlnvil(  2raumpnu0apx mf3iytlmDrmumo (0 lermr3tydomt livsls  exoxrpiydalee fcsasf rra(ro;t1tpxo feiadla emnvs t0aeermr3todlpDeluvil() 2toim3iu1apee fvils)srrm(monu0tlen o3tysfa2rauvp u0artnxr totfatr ivolt srurxm oy4ll emfvs ( s2uaum ;o0opt mi3iyd s2el(vsn()arxomr oadlp e ies (0t2toxr3oy4omenlietls) Dtrxrooo4aee miciasfm2el(msn(0trtrxfcoadlmD an i;() 2uoxrpnydop  lnvs s srraur oo0alxoioctatls ul( s;(4 etnxo totfp rau s t t2ur(opny4lltnmicias  Dta(ro;t1olt iociytlsDulumont4aexrircoa1oaDe ies s0seuoxo no1oleelfciasfa2uax  oo0apx  ietyt s ulnvs;u4artoxf tatlm   n o t tetrxopiy4alt  netat) Dra(  no1apeo i3tytfsDua(msnu4 renif iy1lpte nvo ( sexrxr oudoptnmnvslsfsDua(mo;t0olt moeiadfaDumnvo (0artnmfctodfat ai sl(0 rxmio ny4lmee ncia() rta( o;u1tpto oeilt sDrln p t0 ltnxr iydfaDraivi;t0setmir3iudopen ictat)sDrrxm ;o4tlt micild m2eau sn(4 lxrxo ta1omtrli s t0 rumir nudlptnmfvilt a2umumo;o1apenmicilsls el( on() lermfcia1opt auei;s)s2tmxo oudlmtn fvs () Durur nt1tpe mieiytlaDrm(mont4 ltnmrcty1opDeaivol()teuo(o io4apen ivsatfaDrmu ono0optoiieilt m2umn sn(4alerif iodlm eai ols)texoir iudame mncsasfsDtau p;t0alt mf3ildls2ulu s (4 rtrif3iatlm   ieols0sexrxo nydomenmnvia() 2ua(r nt0tltomf3iadfs ranvsnt0trxomf iydlaD aivi;(0s2tmxrpnydopen fci s  rtrx ont0alxnif3iatlaDranmo;u0 eeomr3oatlp eauei t t2tm(mpiy4al n ivsatf Dur(m nu1tee miciatlm rmnvsnt0 lxnmr ty1fmDelueo;t)srtrim ou4lpeelictasfsDtr( o;t1tlxnmociltfs rlnvsnu)tlenxr3oa1oa  ai il(0t2xr(mpoo4lmee fvs sfs2rrx o;t4altoii3ildla ea(ms;u0texoxfcoa1fmDeluvo;s s2xm(r iodlm elietat sDrau  no0tpxoifetld a2rm(mo;t0tetriociadfaD  ivo (0 rxmxm3nu4lmtemiei tfaDuru  ;u1tlxomoeiysla2rmuvont)aexrxo3iotfa   ivs;s)trumio3nydoptelfctasf 2um( o;t0opeo octasfmDean onu)teermr3iy1lm  liei s) rumxrpnudomee fvt t) rrrumpno1olx iictlsfa ea( s;t4 lxoif to1oaDrlu o s)s2urio3oo1optnlivsas aruaxr ;t0alto i3iltfa2ua(vs u0tleoxf3iydfa rlnei t0s2tr(o3ny4amtemncsls)s2umx  nu1texoiietatfm emumont)texomoctydopDelueo;t0s2ur(opoo1aleelictat)aDrrxroot4tpe mo3iysfsDuanmpnu0trtnmo3ootopD lieol()t2urxr3iu1ape mnesat)aDururp;o0oexniictadfs el(mo;u)alxnxf oytfmD auesl()srur(o io4amtn ictatf rurumpou4tetnmi3tysfa2ranmp t) rtnirciatoa eaueo;t0t2ur(o3oo1optnlnvtas)s2rmxmpoo1tptnifciad m rlu s;t0trxoio3oy1op   nvo s tetrimpiy4lm nlnct tf Dtmx  ou0apx  fctysls umumo u4 rtniocta1fa e n s () 2xrxr iu1al elnetatfsrurur oo1apx  o3iysfs rm( ont0tltomo tytoaDr uvs s0 2toxm oy4omt livi (fs2um( pnt1opxoifeiys aDra( p;(4 lxrmr iotoatelnvo;s  etmiopny4omtelicias)artm(m ou4olxnmfciltfsDrmuvo;t0 ltomocootlate nvslt)t2umxmpiydam nlnvsas s2rmu o;o1texn f3tysla2rlnmo;t4treoio ootfpD  u ils0sexoio iy4am e fei s sDrrxr ot4oeeomieils m2ul( p;t4aeeomfciy1omDrai s;(0srxoxmpoo1lme mfctas a2urxmo;u0tleniictatls2ua( pnu0 eeniociotlatrln ol()s2uriopiodale  feiat)aDra(rp;o4oet moeilt sDul(vs;() rxnxr tadfaDe nvs;(0texmimpio4am  lnct t)srraxr nu4olxn fetad m2uanmon(0arerio3tytfpte uvs t t2tr(rpoodoptn fetlt  Dtau p;t1altnio3tlt aDumums t0trtomrctadlm r uei ()tetoim iy4lmee ietltf rrmx pot1olx mfctat s uanvo t)arenxo oy1oaDelnes ( tetrxr3iodaptnmnetat)aDtmuro;o1tlto i3tatlsDrmuvs;u)areoifcta1fptr ieols s2xmimpio1al nmfvs () rtax ont0tleo ocils sDulnvpn() rtnir iadomDr uvi;s0 rtmiopnu4optnlivsas  2trur ot1oex mieiytlaDumumo t0 etrmr3tadlaD  n o;s)trxmimpiu4op  lfcsasf Draxr ot0tle  o3iytla2uln s u) exomo iydfpDraneo;()tetm(r nudlpenlivsl() 2tr(rp;o0olx  i3iatlmDuln s;u) leoio3oodoptelnei t0 rtoio3oo1lmtemfetatfa2urum oo4aleniicilt s um(vo;t0 etrmociotfaD  nvi;t trtm(r3oudlltn fctlt  Drau p;t4oexomoetasfsDua(monu0 lerxo to1fmt au olt)srumim3iy1altn iei t)s2trxrp;t1aee  feiyt mDrauvon(4aeeoif3totfpDrau i;t seurxr oudalen fvt s a2uaxm ;t0tpenmictysls emnmsnt4 eenxf3tatfaDeluvo;s t2xrxr nydlmt mivt t)s2ururoot0tptnifeiasfm2umnmp;t0 rxnifctytlate i i;t0teumxmpoo1lpt liesasfa2uaxrpnt4apt  fciys a um( s;()artnmr oadfmtr ieilt trtmxrpnu4ape  iei (f Dtr( ooo1aex moeiadfs2eanvp t)tlxnxo3oytlptr nvilt0 etoirpiodlpe lncsas s2rm(moot0tetoiictld a rm( s t) leomr3oadfp  ai o;t)t2xoir oy1am  mnvtltfs2urx  ;u1optoiociasfsDuan p;(4tlxniociodomtrai o;t)trtoxopou1ap e icilt sruaxmpoo1opxo o3iys m emnvo (0altomf oadlpt  i o t0srtr(r oo1lpt mics tfsrrrxro;o0altnmfciatlm2em( o;t)tltrircoo1omDraivsls)setrxr no4ame lfvsasfs2trxrpno1opxn f3iys s2eanvs;u0teeoif oo1lp elnes (0 2xmxo oodamtemivi tfaDtmxrono0aex ii3tatlaDemn s t)areomr oo1fm  aiesls s2trxo oodlleemfviasf 2umx  ;u1apxnmfeiyd s2em( o;u) rtnmrctotfaDran s;t trtriopiy1optelnciat)a2ua(rp;u0olxo i3tlslaDrm(mo;u4 exomf3todlaDr i i () exm(r oydaltnmnvi t  rra(m ot1tlxnmo3iysfm uau on(4trxnircoadfpt  i s;( seuoxo ou1am   fcs (fsDtrx o;o4tpeo f3iltlmDua( s;t4trtomocoo1lmDrlueo;t  exoxrpio1lm nlnei tfaDtrx poo1aetniicilsla elnvpnt0 lxrif oydfpD  ueo;s) rurim ny4optelfviasfs2rr(m ou0oltomietldls ulumo t4 etnio tadomtraueil()t2xoxo iu1am nlncia(  2um(mp;o1tltn fctlt s em( o;(4 exrxo3ty1fpDelnvol( trur(o3ny1oleemnciatf Durxro;u0ale iiciyd aDelnmp;(0aexrxrcoadop rlneilt0srtrim3no4lp nmivi s) rtru  oo0texniietytla2ranmp;u) rtomf io1omDr nvi;s teuoxrpio4lp e nctat a2rrumpnt1oex  f3tlt a uau ont)teenxr oy1lpDr u ol(0 exmio iy4ll nlfvtltfarrmuronu1apxo fctytlm2um(ms t4 ltrxo3iodlmt aivi s  2tr(m oydolt lnvi sfs2urxrpnu1olx ioetadfm eauvp ()aetnmfcio1omDrai o;s0 rxr(rpiy1llee nvs t aDur(ronu1alx moeiyt a2umnvp;(4artnif oatomte u i;(  2tm(o nu4lptemnet (fs2ururp;t4tpx mfciysfa rmuvo;u)aetoif3oytoaD lu i s0texmxrpno4ll  mfvils)aDtm(rono4alx ifciad aDrm(vo (4trerircoadlptrlivils)s2umxm3nu1ap  mfetasfarumurpnu1aeeomi3tldls ra(monu4trermfctatlmt lnei s0 exm(rpoo1ol  lfciat) 2rau pnt4tpxoiociytls rl(mpn(0arenmo totla   nesl() rtrxr3nydll emnesa()arrrum ou0optn o3taslmDem(vo;(0artomf oy1fpDr nvsl(0t2xrimpiy1lm  lnvsat)a2ua( p;o0tpen octadfaDulu p ()aexniocio1oa  ln s;s0s2uoio ou4al n ivtls)sDraump;t0tle moeilt mDrl( o u0aleomo iotoa   u ilt t2umxr ny4al n ictas)srtaxrpou1oleomo3tyt sDem( onu4texoxrcio1fat  uvo;t0s2to(opnydaltn icsls) 2ta(r ou1tleoii3tysfs2rl( s;u)tlxoxf3tadfp e nes () etrio oo4om e ncsl()arraxront1opto ieiltlaDeluvon() leomr ty1lpDeai ilt0srumxm3iu4ameemnvtasfaDtaxmont0tet  oeils m ran s ()alxrmociy1oate uvo;t0sexrim oy4omen iviat sDrmxrp;t0aexoio3iyd aDrluvp t) rxrxrciytlp  lnvi t texmxr3nodlp  mivtat srtrxroou1apenmi3tltfaDel( s;(4tltoifciadlat aneo s0teurxm3oudame  fvs s srumuroou1tleomo3tydfs2rl( sn(0alxomo ia1laDe iei s0 rxm(mpoudaptnlfct s)s2urum nu0tlenio3tas aDum( s;(4teenio3iy1lp  ai slt)s2xrirpiy1opt lfei ()s2tmu poo4altomo3iadlsDulu o;u0teermo3iytomDe uvol()trumxrpoy1lmt livi (farrrxmont4oltn feildfmDrlu o u4tltoirciydopDe uvo t0 etoirpny4op elietat  rtrum no0aptoioeiydla em(ms u) etrio iatom e u i t) etm(o no1ol elfvi sf Drmu ont0olxoiiciasfs2umn onu)tetoxo oodfmtr n i;t)texr(m3ny4lp elnes tf Dua(ro;u0tpt mieild a em(mont0texrmrcta1omte nvslt0s2ur(o iy4lmtnmnvt t)sDrm(rpot0apt mi3iydfm2ua(vo;(0 ltomrciy1lmD au o (  rtrxrpio1lle mfvt tf rumxr nt4ope  fciyt s emn o;t0tltnxf3iadfmDelieols  rxoxm3nu4am  livs sfa2rr( p;t0olenii3ildfa2ulnvp;(4 leoxociy1fa ranvi;t s2tmim3no1olenlieiat aDrmx pnu1ope iociytfsDemnvpnt4 lerxr3oatoaDelnes s0t2trxr3ou1lpt lfvi () rumxront0aptn iciatfm rauvon()tetrmocoodfm r ies;( s2to(opny1amtelncia() Drr(mpnt0aex if3ildfaDum(mo (0 rtnio3totoaD  ivs;t0 2uo(o3iy4ome  iet tf 2trxr nt0tex mfeiat m2ea(vp t0trenio3oa1fa r i sl()seuo(r3ny4op nmnctat srraxr ;o4aexnmoctyd a2rmu s (4tlxnxf oa1fmtrlnvs;(0trxrxm nodamenmnesat)srtr(r no1tptniociasfaDean on(0altoxf3iatop eai s;s)texrxmpiudale mivtltfs2tm(mono4aptomfetad sDrlu s;u0tleoir tydlmDeluvo s tetmim nudapeemietl() rurx o;t1tex mfctldfa uanms;u) lermo oydop eaivols0t2xmirpnodomenlicsa(f rua(r ;t4tpxnmocilsfsDelumo u)texnxfcty1lpt  i i;()srtrxmpoo1ol   icsa( arrm(mono0tpx iieiytlaDrau p;(4tlerir3oadfaDr nvi (  eurim3no4ame lfct () 2umu ont1oeeomfciytlm2ran pnu0arxomo3tydfm e n s;s  rxr(m no4ape lfetls)srtrxmooo4oee ifctat m2um(ms;t0arxnmr iydom rlneslt)s2trimpiydomeelnctl( aDtr( o;t4tpxnioetadlaDemumo t0aetrxfcoatfm   uesls0 etrimpio1aptnmfei t)srtrxm ;o0olxnioeild a2umump;u4trenir tytfpDelieo;t s2ur(opiu1amt  fctl( sDrau  ;t4tpeoifctad s eau on(4alxnircoytomD lieo s)sruoim io4al emfvs ()srrmxmpou1oleoio3iyslmDulums t0arxoiociodoat aivil()teur(r oy1ll nlnvsl(  2urx  nu0oetoii3tasfm ea(msnu) rxoxfciatlmDeln i;t0texo(m3oo1ll nlietlt  rtrurp;u0apt ii3iys mDemu o;u4arxnir oatopDe ieolt  2tr(m3nydaptnmfviat sDururono4tlto oeilsls2rl(vonu)alxnxf3ootfm  an o ( teuo(mpoy1lltemietltfa2trxm oo0altn f3tad a um(vpn() rtomr oodfmt aivsl( s2tmxm ou4apenmneil()aDta( oou1apx io3tytla2ul(mpnt)trtoio iodfp e n o;t)teuoxm3nudlmtelfes tf 2rm(rpoo0olxoifciasfaDrlu s;() renmrctodoa eai ol(0teuoirpnudomenlncias)srrr(rpnu4optnifeias a ra(ms t0aeermocoytopDeaies;s0t2uoim3nydlm elneil()s2rmu p;u1ole moetasla eln on(0trenxociodfa rln s t sexr(m3oo4lpe lfcs s  2tax pno1tleomoetyd m2um( p;u4 lxrxociy1la  ai o;s)t2um(o oy4amtnlivs s a2ta( pnt4tlxnmoctydlsDean o (4aeeoxoctotfaD aieol(0 2um(m ny1apee fvilsfsrrrxmpno4oee  fctasfmDra( snt4aeermf3totlpt  nes (0s2xrxr nydamt  nvtatfarumx pnu1tltoifciat mDem(msnt)aexoir3iy1fm ranvs t0 2uo(m3no1oltemfcilt)aDrm( pnt4olxnmictltfmDum(mo u0arenxr iydfpte n olt)seumim nodap   ncsl()srra(r ;o4tlxo feils aDem(mpnt0 lerxociatlp e neo;(0s2tr(m oo1lm  mnvsas) rtmxrp;o0tpto ociad mDel(vo;()altnxrctotlatelueil()trumirpio1olee ivi s s2trx ont4tlen i3iasla em(vo;(4aexnxr tydoaDeli o ( teuoir3ny4lm emfeiat s2trxro;t4alxo f3iys m uan snu4arxnmr3ty1lpDrlnes t)trtmxo no4oltnmnvilt  rta(mp;t1alxomfciys a eanvp u4 rxoxf3tadoaDraiei;s seur(m3ny4lltelnvias aDuax  ;o0tlt mocils a2ranmp;(4teenxr3tytop eaues (  2xm(o3ou1altemfcslsfarrr(mo;o4opx if3iatfs ul(vs t)tltrxf oo1fp r i s t0s2urimpnodom emieia(faDraxmpot0oetnii3iat a ranmp (0 exnxr3oydomDeanvi;s)srtrxmpno1ll   nvsa(  2uaumpnu0aexoifeiytlm2emnms (4 ltrir3tadfmtelu i s  eumio ou4amte ivta( sDraxmp;o4aeenmi3iytlm ulnmo u0 etoxr to1om elu s;s sexo(mpnu1optnlivsas)sDrmu p;u4tpenif3iyslsDulnms ()teermf ootlaD aivo;() 2tmxm3no1amtelfciat aDrrx ooo1opx mietad s2elumpnt4 reoio oa1lmteaueo;s) rumxo nydlmt mncia(fsrtmxr ;o4aptn f3tadlsDeanvo;(0alxnmf3iy1fm   neo;()t2xmxo ou1al nlictatf Drr(r ;o0oeenmieilslaDem(vs;u4 etnifciatfp rlu i;(0 2xmio3ny4opeemfvs s  Drrum ;t1texnmfcildla2rl(von()trenxoctadlmDeluvi;s0s2xmiopiu4ap  mncs s)aruau pnt4tpxoii3tatlm ul( o ()artrmf3oa1fm   ueo;( setoxm3ou4ap elivtas)s2ur(m nu1opt iieiydfs rlu ont0teerxr3to1om ranvo;(0teumxr3iy1ol nlnesat  Dtrxmonu4tetoiictyslsDua(vpnu0 rerio oodomDraivi t0t2umxr3ny1oleemfvta(fa2tm(m nt0openifeiydfa umnmp;t0artrxf oa1laD anvsl(0texoiopno1ap e ivsls)sDua(rpoo4oeeo ieiyslsDumn ont0 lenxf3iydfaDe ieils0srxr(r oydap elicias  Dtrur ou0oleoiocils a umump;(4 etnirciadfmte u ol(  2xo(o io4lptnlfetlsf Drmu  ou4openmocildfa ranmp;u4altrxo3tatfm  auvilt)texr(o iy1lmtelnvilsfa2uau oou1ole  i3iydfaDea(vo;t0trxnif3oydfmD li s () etrxr3ou1ap nmict ( a2ur( o;t4oltoif3tydfsDrl( s;(0 rxomrcoatomteauei s0srtm(r oy4omte ncs (  rur(mp;u0aexn fciadfa2ua( p (0 reomo3totoa  lneol()srumir oudlltemfvslsf rurum nu4opx mo3ilslmDrln s t0arxrxrcootomt livo;s0setrxo3no4amee fctat)srtaxrono4tpxomf3iyd m ea( p (0 rtomf3iytoaDrlu il( teto(opnudoltemiviasfa2trxm nu4tltnmicildfmDumu onu)aexrmf3iydlpteluvs t tetm(m oo4amte nvt sfsrrmumono0aetoifetldlsDrmu snt)alermo oatopDelivsls0srtmim oy4omtelnvs ()srrmx  oo1oexnmfetasfs ran o;(4aexrmrcoadlmt ai il(  euoxmpnu4oleelictlt) 2taumoot0apx  i3tys aDeanmp;()alerif3oatomt ln sl( seurxo iydom n fcilt)arumxrooo4opxnifeildla em(vo;u0altrif3ty1lmt auvo;s seto(o ny4am  mnciatf 2rmxmooo1aleoiociytlmDulumsn(0 lxomf ia1oaDrauesls  rurxo oodalt lnvtls s2trump;o1tltnmiciydfaDea(mp u0trtoxr oadfaD an o;( teumio3ny1ale  ivtls srua(root4ape ioctydfa uln pnu4alerio tadopt  ivs t srxrxr3oo1lme  nes tf Dra(rooo4olxomicilt a2em(vp;u4arermocoa1oaDr ivi;s)t2toim3oy1optnmfvils arur( ont0tlx  feiydla emnvo;() rxnif3ootfmDe ivo t s2xrxmpiu4omen ics t aDtrurpot4alxomietadfa2em( o u0 exoxr oadlpDe ivi;t0seurxm3iu1ape lnctlt)aDua(rp;t0teeomoctadfaDrmnvp;() rtrxo3todfmDrli i;t trxrxm3io4lle lfvta( s2tmxroot4ape mfetatfaDrmumpnt) rtoio iatom   uvs;s teurio nodlm emnvia(f rtrxm ;o4alx micildfm rm(von()altrmf totlpDrlu o;()s2xrxo3ny4ole  ictatfaDrmx o;t1tlxnmoeiasfsDua(mo u4 lxrir oatfmD livol(  rxr(o3iy4ap  mnvi tfs2rrxmpoo4alto f3iasfaDum(ms t0arxoxr oodfmDranvi (0 2tmxmpoy4ll e ncs ()s2ur(m ou0aptoifeiltfm2el( p;u0 lxrmf tatfmte neo;t setrxmpio1lltemnesa(  rtrx p;t1olt mo3tysla rmuvo;t)teenmr3iy1omte iei s texmxrpnu1ll e fvsa(fartmxronu1texomocilt s2ulu snt4aexrir iatlpDeln o (  rurimpoy4opt lfvi t) 2ur(mono0oeeoii3tld s em( p;t4trxnif3oy1om rlivs;s)texoxrpoodlm   ivt s)sDtmurooo0aeeomociysfm2ul(vonu)teermrcoytfmtr ieo;t sruoxo iu4lptnlfvi (  Dtrurp;o4olxnmoetadfa eaums;u0aetrmo3iytoaDeaivo t) etm(r oo4op e nci ( aDrr(rono4tle  i3iasfs rmnvp;t0arxnmf oatopD aiesl()t2xm(m3nu1lpee ieil(  2um(ro;t1tptn fcilt aDrlnvs;t0teermfcta1lp e u o;s) 2urxm3iu1ll n feil( s2ua( p;t1aexo feias a um(ms;t) rxrir to1fpte uvsls)trtmio3ny1olt liciat) rtaumono1apt iietysfa uan o u4 ltnmocio1optelu o;s0 eur(rpoy4op nmici t)artru o;u1teeoifetytfmDulnmp u0tlxomf3iodoaDr nes;t)sexmimpiodamtemfct tfsDtr(m ;t1apeomocild a2el(vs;()aeerxocoodopD luvi t0s2trim oo4omtnlietl(fsrurur ;t4aee  f3tadfm ea( s ()tltnir iydop e uei s  etmirpno1altemnctls)aDtaxmo;u1olxnio3iasls2em(vs u0 exrir tadopD  ivi (  2trirpoy1alee fvtat aDuaurono1oetnifciltfa2rluvp t) eenxo3todfa elnvi ( sexr(m no4opeelicsat)aruaur ;o4olx ioeiys m2rmnvpnt4aexrxf3tydla   n ols)t2toio3ny1lmte nctat)sDtrx  no4aee  feias sDranvp u4altrxoctytlm eli olt  rtoxmpnodamtemnvtlt)srrrumo;u1aexnii3iltfa ran p u)tlenmr oadoa eluvolt  rxm(o nodam e ncs (f 2uaur ou1aleomiciadfmDraums (4 rtrmf3oadom raieilt0t2umim3io1oltnmfesasfarrmum no1oeen ocild a em( s u4 exniocoy1fpte ueilt0 2xoio ny4ameelfci ()artruro;t1tltn i3tlsfmDel( p;(0 lxnmoctydlpt ln s s0trtmir oo4ome lnvs t) 2umum oo1tptnmoeiytla2rlnmp u0 lerxfcoatoa elueo;t0truoxopoudol elivia( a2rmu pou4tptoioeils a2ulnvs (0 lxomrctytomt lnei (0t2xmxmpnudome mnvtas  2rrumpou1teeomoetyslaDumuvs;u)tetrmrciodfateaues;(  exrxo3oydaptnlict t)aDra(  ;t4oeen octadls2ea(mo (4 rerxr3todoatraivols0tetoxopio1llenmnvsltf rtmu  ou1apt if3iatfmDem(vs;(4alxoxr oa1fa ranvs;t truo(rpiy4ll elnvilt  rum(m ;u4aptnifctyt s elumsnt0 ltnmfciotfatrln s t0trtoio3nudoptemnvtlt a2tax p;t4tetnifctys sDraumsnt4alenxr3iydoateau olt) 2xrir3nydlpe licil(f 2rm( pnt4open oetat a2rln pn(4 ltrif3iydfp  luei s)sruo(rpio1lpen fetatf Duaxrpno0tle moetldfs rmnms u) etrmf oo1lpte uvols  exmxr oo1aleemiesas artr(rp;u1tpxo f3tad sDrln p;u4 rermf totla raiei s0setrxm3ou1altelfesasf rururoot0optn ocilslmDel(mont) rxrxo iotlpDelnvi;t) rxrirpou1omee ietltfsrra(ro;u0tlxoioctlsfa ua( p u0tltrmr ta1oaDran o t0tetmxopiydalte nvsas)arrau p;u4tpeo f3ils aDrm(monu0aeerir oodla eaieils setm(o3nu4opte icsas)arum(ronu4tlxnifetyt m2ean s;(4 etrifctadop  an sls)seuoim3nodaleemfcslt  Dtmxr ;o0oexoio3iytls2rlnvp ()alerxrcio1lpt  neo;t)sexm(m3ny1optelfeilt  Duaxrp;o4tlxoio3iydfa eluvp;(4treoxr3iadopDrauvs (  2tm(opou1op e iesl(fa2rmump;u0teenio3iyd m ran p;t4trtrxr oa1lpt  uvo (0teumxopny4ap e feiasfs2rm(monu1aee iietad m ua(mont4 eeoif io1fmt an il(  2xmiopiy1lme  fvslt  Draxrpoo1ale ifcils mDulums;u0 reoxo tadlp rauvilt)teurxo3oy1apee icslt srtm(  ;u0tltomociatfa2uan p;(4aexnmo3tydopDrai s t setrxr3io1apeelfeslsf rtru  nu4aeeomfetaslm2ua(vp;u4tltnxrctadlateanvsls0trxm(r iu4al  micsat)aDtru  ;t4aee io3ildls2rm(vsnt0 eeomfciadlpD an s s0srtoimpiy4om  mieiat a2rrum ;t0teenmo3ilt a ea(mo;t4artnircio1optelivi;()tetmirpiy4oltemfetls s2tm(mpot1opxo f3iyslm2rauvp;t)tetnmociotoaDrlueols0 rurio3oy4alt  fvsatfsrurum ;u4apxnioetat mDranmont0tltomr ta1omt  ueo t0setmirpou1llen nviat s2tax ont1tlxoii3tasfa eln o;(4aeenio3iotfmDeanei t  eur(mpou4alee ietlt s2rrump;u4teto f3ilslsDranmpnt)tleoxr iotfmD  ieo;(0 2um(o3no4op nliei ( sDurxr no4apt  oetad a uln s;u0texomfciydfaDe ueils texoirpio1ol  liei (  rraxrpnt4aexniieils mDem(vpn()tlenif3iydfp r ueo;t0trtm(r3ny1op elivtlt) rrau pnt0ole  f3iytfm ranvpnt4teenmrciy1lp  aies;( t2tmio3nudol nmfeils aDrmumooo4tetomiciatla2eanvs;() lxomrcoy1omteluvsl(0 exmxmpiy1am nmnetlsf 2ra( pot4tle  feilt s2eanms u4tetoxrcoy1lpt anes (  etm(opny1olen icsls aDrr( oot4aexoioeiysfmDem(msnt)trtrmo oo1late u o;(  etrxopiy4ll  lfci t srurx p;t0tetoif3tyt mDel(vs u4texnmf3totlpD li o (0sruoxrpiudaltemicsls)aDumx onu4teeomo3ilsla ul(vs t)texoir3oatlate ivo;t0 rumimpou4lle mfet ( sDta(  nt1tetniieiydfs ra( o u0teenmfciy1lp rlnes;s srtoiopoo4om e ncta(  rrmxmo;u4apt mfciad s2emump;t0arenir ty1laDr nvsls) ruoxo nu1ol e icslsfsDtrxroot4tlxnmo3ilt aDea( o;t4tetoio oydfat  neo s0trurim oo1lmtnmnctltfsDurxmp;o0oexomo3iysfs2rl(vpnt) rtrmo3iotlm ranei t s2tr(rpnu1ll n iet (fs2truroot4apx iietltfm ul(vpnu)aeeoif3todomDr neol()srurir nydllt lfvsat aDraum ot1alt io3tltfmDelnvo;u4 rxnif tydfa r u olt0t2toio iy4lm  lnes tfsDrmx  no1alxo oetlsfa ra( s (0aetnmf3iadopDeau i s0t2xmir ny4amtelnes t) Dtrx p;u0oltoio3tas s2ea(vs;u) ltnmo iy1fpDrlivsl()seur(m3io4llt mieia(faDrrxm no4ape  fetlsfm2um( onu4tlxoif3oo1oaDr n ol(0teumxrpou4lpt mnvil()artmu ooo1tpe if3tlslm2el(mo;u0 ltrmf tadopteanvsl( t2tm(o3iodalee netltfa2ua(rpoo0tltomieiysls ra(vp;(4aexoirciodomDr n i t0texmir3iydame  ivtltfsDrax p;o0alxo f3tadlm rl(vsn(0trerif3tatlatraneil(0 2umim iy1optelicslsfa2ta(r nt0tlenmfcildlaDuaumpnt0altomo oatlaD lnvi;t)s2trxm3ou4lpenlfct tfsrur(r ;u1tlxomfeiasfs2um( sn()teenif3ta1lmteaieols texr(r iudllt  fetasfaDum(rpot1apeoioeiasfm rluvs;t4 eenxo oadomDeau s;() 2uoir nodope  nctat) 2trumo;t4tlxniiciydlsDrm( on() ltoio iatfa eln i () rxo(m no1opte nvtlt)s2urxro;o4tee iicildlaDrlu s ()artomo3oy1fmtelueo t) rumio3io1alt lieiltfsDrrxmpnu1opt ii3iyt s2ra( ont)aexnmf iydomtelues ( s2trim iu1opt mnctas)sDuaum ;o1texn f3iatlaDelumpnu) rtomf iy1fmDeai o;s)texmxo3iu1om   ivs ( srumur ou0teeo oeild aDuan p u4texnxr3io1faDelieil() 2xm(o3ou4openlnvta(fa2rrx  ot0olxn fctls sDran sn()aleoiociydlmDrlivi () etoxo no4lle mnvilsfs2tm(m ;o4oet mi3iadfs2ran onu)areoir3oa1lpDr neo t0texr(r nudapeelnvsls)aDrm( oou0tltnmfciadla2ul(vp;u)trxnxo3ty1om r ivo;s0 2xoio io4omeelfet (  2umx ooo0oexn icilt s2uanvon(0altoxfcia1laDelieo () 2tmimpou4ale lnetlt srrau oot4aet  f3iyt s2rlnmsnu)aeeoxo3iotfm  luvi;( sruoim3oydolen ncslsfs2ururoot1teeoiieiysfa rmnms t0trtnxocoatfpDr uvilt s2umim3iu4ol nmfeiltf Dtrxrpnt0oex mociys m2emn snt0teenxo3oydfpDean ol(0teuoxm3nu1lptn fcs t)srrrum no0teenmo3ilsfaDeauvonu)tlxrircoydfaDelu i s0sruoim iy4lm emfetatfa2ururpno1tltnmo3iadlm rluvp (0altnir3ta1op elieslt0 2tmir3iydal   ivslt) Dtrx  nt4apt mfctld sDuln ont0trerxf todlpteliei;()srxmiopoo4lmtn fvsl() 2ururpoo0aexo iciytlm2rl(vo;u0aeerif totlm elnes;() 2ur(rpiy1apt mnciat)aDur(mpot1tpenioeiaslm emu o;(0texrir3iadfpDrauvi;t)trto(r3oydlmeelneia( artrxroou4oet ioetyt sDua(von(4trtrxr oadfp eliei;s) 2xr(m3oy4lm nmfesl() Dumxrpno4alt  f3iat sDranvsn()arxnxf tadfpD ln il( texrxmpny4op  liet (  Durump;o4aexomoeils mDum( s u4tetnxf iadom e nvs t0 etrio no1ape  netl(fsDtaumono1oee iociatla rl(vo (0artrmrcoytla  au s;t0s2xmim3oy1olenmfciasf 2trxm ;t1oeenmi3tyslaDuaumo;()trtnxo3iadfpDrlu i ()s2xm(r oudlme livs ()aDtau ooo1alxnmfcias m el( pn(0arxnmocoatfpteaneo t0 etmimpoydoltn ieta( srrax pnt0tee  i3tld s uluvsnu0texrmoctytlm rlnes;(0s2xr(r nudopt  neta( a2rr(mpoo0ope  i3tytls emumpnt4trtrmf oy1lptr i s t)srtrxopio1olt  ncils)sDrrx  ou4aee  feiyd aDeluvo;t)arxnxo3totlm ranvs;s srxmxrpoy1apee icsls arumu  ;t4tpxnmoetysls el(vp t) ltniocootlpte nvsls0teto(opio4apt lncs (f Duau pot4ale mf3tyd mDrm(mp;(0aeenxr io1fp  aueols) rxoio ou1lmt lfctasfsDtr(  ;o4aetomi3iysfs ra(vo;u4tltoxr3iy1optrln s;s0trur(rpoudlm  lfetlt)sDtm(moot0tltomiciyt a2ra(ms;u0tlerxo oadoa  aivs;t srtm(r io1lmt mncsasf 2raxm nu4alxomf3iyt s2rmuvon() renmf oo1oa r u i s s2xoir io1lmenlnesa(f Dumuroou0oexn ieiytlsDra( o () exnmf3ty1fpD  n o s0trumxmpiy4lpt lnvias s2urxr ;u1tpto oetat aDrauvs;u)tetomf3iotlm elues t  2uoim3iodalen ict tf Dumu pno1apeniociat m2emnms;t4 eenirciy1omDeanvo;s0tetmxmpoo4ol eliesa( sDtaxmpou0tle  oeiad mDemn s;t4altrmr3ta1laDeanvil()trtmxopoo1ole mnvi (f 2raxr ;u4aexnmocildfs2el(msn()artoirctadfpDelu ols0 rxr(m oydll n nvil()sDtau ont1ole  ictyd s elu s;() rxnio3oo1lpDr uvi s0 rtmxm3ou4lp nlfvtas) 2tm(m ou0aexoii3iytfm2ra( o;t4tetnifciotfat livol(  rxmim ny1am  mnvilt a2ta(mpnu4apxomieilt sDum(vsnu4 reoxo3iadlatraueil(0 rtoim nu4lmtelneil(fsrtaur ;t4tlx mieildfa umuvpnt0aleomf3iatlpDrlieilt texr(r nodale lnci tf 2trx o;u1olen ociltfa2eauvp u)altnmo3ta1omDeanei ()tetm(rpou1lptn feslt  2rm(r nt0ole ioeiasfmDra(vpnu4altomo3totlaD lueol(0 rxoim3oudllt lfvsa()arumxr nu4tpe mocilsfs eluvp;() eeomf iytlmte i o s0 etmxm nu4opt lfeilsfsDumxmont4oetoiieils aDelnmo;t4 exnxf3ia1oate uvols)teum(opoy1ll  mfvi ( sDraxmpoo0tlxnifeiys a2rmu s () eenxo3todfm r ueilt0 rxmxopoodapen ivs sfaDrr( pno0olx  o3ildfsDrm( ont) eenxrcia1lpD  nesls  eumxmpou4llte ivs ( aDrmxmooo1altn oeilt s rmums u4 eeoif3oydopte ivs;s)truo(r oudapte icils a2urxr no0aee moeiad mDemumo (4areoir3oodlpDr ivil( seum(m3iodlmeemieil() Drm(mp;u4oetoio3iadls2um( s t4alxnio oatlm   nvi t setmir3oudol e neils)srtau  nt4tee  fetltla2emnmo;u4tlxnxfcoodom e i slt0 rxrio iodoptelneslsfs2tmu pot4olxomociysla2rlnmp (4 exoif ia1opteaieol( t2tr(o iydalen fcs s) rrrur nu1aleoii3iatfm2emuvonu)alenir3iodlaDeau olt0sexrxm iodomeemnei t  Dtmumpno1tptnif3ildfm emu sn(0alxrir3iotfa e ueol(  2xoio3iy4aptnmnctas)a2taxr oo1alxn ocildfm2ea( snu)arxoxr3ootlp raneols s2toxm3oy1op nmfcil( srrauront1apeoifctyt sDean sn()arxnmf3tytfpte ivi ()trxrxo iy1alenlnet (f rua(monu4aee mo3iydla ra(mp;u)tetoxr to1opDelivil( sruoxrpoodopenmictatfaDtaum oo4tpeomo3iadfm2ranmsn(4teeomo ty1la   ivil()tetrxo3no4lltnlncsl(f rtr(m nt4tptn ietas sDrau o t0trenxfcoa1fatrlnvo (0tetmir iodolenmfvsl( sDrru  ou0apxn i3ias m rm(msnu4aetomo3oy1op  aieo s)seurio nu4lmeemfvsat)aDtauro;t1tetomocils a2um(mon(4treomfcoo1oaDeai s s0sruoirpnu1al e iesl()artmxr ot1aeeomieiltfs2ul( pnu4tltrio3tatfmteaieolt) rtoxm3nydllenmfvsl(farurxmpoo0oltoifeild aDrlumo;u)alxnxfcoatomD aueolt)teumir ou4llee ieilt) Drm(  oo1tlxomo3ildls2rlu sn(0arxnir tatoaDelieo;(0trxoxm iy1ole lies s)sDtr( o;o4oetnio3iadfm el( s;(4arenxr3io1fmDraueolt0t2umimpio1oleemnviatfarrr(rpou1oex  octad sDuau o t4alxoxocoy1opD  i sls0truo(mpoo4ol nmictlsfs2rr( oot1optnmfeias m eanvs;t0tltriocto1lm elneils)t2uoxm3nodom   nvt ()a2rru o;u4ape ifcildfa2ul(mo;t0 exnxfcto1fmDr neo;t)seumxr nudlmtn fcsa( s2ur(mpot0oltnii3iysla rmn s;u4altoxo3iodopDrlu s;()s2xoxm no4om  lnci tfsrurx ono1aptn oeiltfa ean s u4 renmo3oydfmDe i i ( tetmxmpio4opeemnct () rrrxro;t4apenmfciadlmDuanmo ()aeerioctadlmDraieils0 2xoxmpiodol n ictatfarraxroou1alxoiictydfa2emn p u0artoxr io1fpDraiei;t0s2umxopiu4ll nlictl(fs2urxrpno1tlx ifeilsfs2em(vo u) rtrmf3oy1omD li ol() 2toir3oydlme  iet ()artm(mo;u1tpt mi3iad mDranms u)tleoxr oodlm raivols)trxo(r nudal   nvilt srtax poo0ole iocildfmDrmnmsnt4texrmrctotoat  neo s0setoxr3ou1llt livt t  Drmx  ot4altnif3iys a umn o ()arerxr3iodoatraivol(0tetrxmpiudlm elnvsatfsrua(rpoo4aexoifetad m ul(vs u4tltnir oatopDr u s (0texoxmpoy1ame  fctl(  rtmuronu4tlenioetysls uan pnu)altnio3oodoaD  uvs t setmirpou1lm emncsas) Dtau pot0aptn fcildfs elnvon(0 lenmfciydlm rliesls trurxr oodole  nct t srtaur ;u0aptoiocildlm elnvont0aexnmrcty1latrliei;() rur(o3oudap  licsas s2rmxro;o1oexnii3ilslm ra( p ()trerif oodlaDe neo;s teum(r3iodamtnmfct (fs2tm( oou1aeeoifetld sDuanvs ()tltnxr ootfaDr uvi;(0 2xo(r3oudlpe lfctasfartaxm oo4tltniieias s el(ms;t)arxoxo3iadopD luvolt)srur(opiydllte ncsa(fsDum(mp;t1tetn o3iydfm ra(vpn(4 rerxr3iy1fp   ivol( seuo(m iy4llenliesasf rtauro;t4oeen f3ils a2rlu o u0aetrmf tydoaDelu i t0s2xm(m ou4lp nmncs s a2rrxr no4oexnifeiaslmDuauvs;u4artrif tydlat lnvs;s0setriopiu4am n fesls)srtmu  nu4tlt mi3tatfs2umums;(4 eermf3oatlaD  ues (0s2toim3ou4olte fvias)a2rruroot0oltnmo3iyslaDemums t0texoif totoaDran sl(  rxr(r no4ll emnei tfa2ra(monu1aeeo oeiyt m ea(ms t)trtnmociodlm  ln o ( trxmir3oodal nmnvt (  2raxmont0tee mf3tasfa2rm( p;() leoxrciydopt li s;s  2umxopoo1oleemfeslt)srtau onu0alto f3tlsfaDea( p t0aeeoxocoadlpDeluvols setmiopnodomenmnei (  rumxmono1tex ioeiysfmDrlnvo u0 rtrmr3ta1oate n o t0trur(mpiu1omt lici t) rur( pno4apenif3iytlsDran s (4aetoio3ty1fa   ivi s) 2uo(o3iydam  lncsasf rta(  ou1tex ii3tadla2rmnmo u0 rxnmrcoa1fa   ueo;s t2tm(m oy4olen fct s  2tr(rpot0tpxo f3iyt a2uan snu4 lenir3tatfm e ivo;(0tetoxm oodlp  licsls)sDrm(ro;t0tpeomietydfm emuvp;(4 rtrmrcio1fmtrluvs t  etrxr iu4lpt mnesa(fa2um(r nt0tetomo3iytlm2rlumpn(4aetnxf totfatranvolt  exrimpiudal emfei sfsDtmumo;u0tpxn ietyslaDuln s u0aexnxf3ia1opDelu o;t  rtrxmpiu4lle  ivslsfsrtrxro;t1opx mieilt mDuluvo t0 rxrxrcia1fp elneols srtmir3nu1amtn nvia( sDraxmpoo1apxoioeiatfs uau p (0aexomrcia1fp  anvslt0 rxoxmpny4ale miet s  ruau p;o4opxn ictat a2ra( snu4texnmr3oatlatrlu o;(0 euoxrpnydalt  ict (faDurxm ;o4aexnmfetyt m emnvo t)alxomr iadfatrauvs;t  euo(r iodlpt lnetlsfsDtau poo1alx  f3iatlaDrmn o (0aeenxr tydfptr neo t0seuo(m3iodap emfct ()arrr(m ;u0olen octlsla uan s;t) eeoxf3iodfm eli s (0s2uoim3io1llen iei t srrr( p;o1tet  iciad aDemnmo () eermfciatlpteanvsls0 2urxo3ny1op nmiet ( srrrxm ou4ale mociat s rm( p;(4 etoir iodlp ran i;s) rtmio3nydlm nmfcia( s2ra(m ;u0alt mocildfs2eauvon(4 lxrio3oydoateln sls0 exoxm nu1amt  fvi s  2tmu  oo1oexo oetyd aDulnvpnu0teenmf3oy1omDraieo;(0seur(r oodamtn ics ()srur(r nt1aeto feild a2elumsnt4areomr3iydlmt  nvo t0 rurim iudapen nvtlt  Duauro;t4tpeoio3iyt m2rmu p;u4aleoir3iotomDr ueslt0 2tmxr3ou4oltnlfvsat  Dum(rp;t1texo ictydfa2ulu p;u4altrmf tytfaD ln i;t)t2um(r3nudape lfvtas  ruru p;u1aeto o3tytfm rmnms;t)altomf3tydlm   i sl()sexmim iu1lle mietas a2ua(mooo1oeenmi3iyt sDum( s (4trenir3oo1omtranvs (0seuo(rpny4ome mfctat  2taxr oo1olenmoeiysls2rl(vs t4areoxo oy1la eauei;t) rxrxr iu1llenlfviat)s2rr(  ;o1alxnifeiatlmDum(vsn()trxoifcta1om r nes t) 2xrim oy1ll  lfvslsfa2rau  ou1oetnmi3tltfs2umu s u0 etoxr3oy1fpDrau i s) eto(rpnodam nmivta(farrr( o;t1olen f3ilsls2ra( p;u0 rxrif iydfm r ivslt)setmxo3no4apen ies t)s2rrxmoou1olxn fetyt m raumpnt0 exoif3ty1lat  nes;s) eurim3io4optn nes s)sruaxm ou1opx ioeildfmDean p;u)teeoxr oodfmtr i ils setmio oy1al  lnvtl( aDum(rpno4oetniocias s2rmuvpnt0altoiocoy1fm   ueolt0 2tmimpou4altemiei (fa2umu ont0opxn octadla2uanvpn(4 lenxf tadfptelies ()trtr(o iu1opeelivtl( s2ururpnu1ope  i3iydlm elumont0trxnxocio1oaD lieo t0teurir3oodom nlnvs sf rua(monu1alen iciatfa2eauvs;()tltrir3oydfp r ivs s s2ur(m3nydomenlnvt s aruax ont4aptoiicilt mDrlu o;()arenmr io1fmtelueilt  rurim oodol nlnetls)srurumonu1aeenif3iatls emu s u4tleoir oy1faDeluvs t0 exo(r iy1llenlieias aDum(rpnt0aeen fetad mDemnvsnt)texriocoatfmD  ivi;(0srtrxopoudape  feiat sDumxmonu0alxn i3ilt sDrm(mp;u4 ltnxo ty1oa  ln olt0 exm(m oo1ame mivsas)aDrmum nt0aexomictld s um(vp t0 renmr3oy1omDelu slt0 2xmir oy4op nmieil()a2ta(moou4oet ioeiaslm2ranvo () rermfcoa1lp eau s (0s2to(opiudome  fct ()sDumxrpno1opxoif3ias m umumo;t) rxrmr3ta1lm   u s s teur(mpnu4alenlfeias sDum( p;o0apeoifciat aDran o ()teenmocoatfpD lieo;s0t2umxr iudlpenlneilt)a2ur(rpnt4tee io3iatls emnvo u) renmf ia1fmteli i;( srxmxm3oudom  micta()sDtrur oo4tlto o3tlt m uaumo u4aexoif oadfmD auvo;(0 rxrxr3nodamenlfetas a2rr(r no0tlxoiieiytla2rm( p ()trerir3tadfpD  nvsls)setr(o nodol  mieta(farurxr ;o1opx  ociydls rmnvo;t)arxnmr3iatfmDr nvo (0srxmim3oy4optelivi s  rrrur ou1aeeo f3tlslmDulnmon(0aetnxociotfaDraivi ( sexr(r3iy1lltelfvtl() 2taur nu1apenif3ilslmDrlnms (4teenioctydla  lnvslt) etoir ny1lmeelivsat  Duauroot0tlxomociydls2umnvont)altrmo3oodfp r ivo;t)t2toxmpoodlmtelicil(  2raurpnt4olxo fetas m2ulu o t)aeenxrcoadfpt  u s ( sexmxr nudll elicsatfaDuaxm ou1tptnmf3ildfs umuvont0areoxo3oatoa  luvs t0truoimpiu4omenmfcsl(f 2rru ont4opx  ocildls2rmnmpn(4tetrxf3iytla elu o s) 2urxm3oy1aleelici (fs2uaxmpno4tltnif3iytla em( o t0 eenxr oatoa e uvi (0 2uriopoy4altemnvi s aDumxr ou4tpxn feils a2emnmpnu0 exnmf io1fm  an o s srxmxmpiu4ope  nesl( s2uaxmp;u1ope mociytls em(mo;u4teermr3to1lmDeau s (0sexo(m ny1lm nmfvi s)aDumuront1texoioeilsls2umu pnt)trtrmocoydoa rlnei s)t2toim3iu1alt lfcs (faDurxrpoo4tpxo iciydfs rmu pnu4 eerxfctytfa e n o t  eum(opno1am  lfci ( sDra( p;t0opxnmi3ias a2umn s;()trxrxo tydop  anvi t) 2xm(r oodomtnlici tf rrrurono1opeo o3iat a2eaumpn() rxrio3io1laDran s () rxmim3ny1lmenlncsa( aDtr(m nu0optomfciys m2uan on(0arxoxf3iy1lpDeln s s0 ruoxo ny4om  lneslsfaruaxrpot1oltn ictatlm ra( snu0texomr3tatomDe i o s s2ur(m oydlleemnvt () Drrxm oo1tetnii3tls m um(mo t4trtnif iodlpt  nvslt t2xoim ou1ole micilt)sDtaumo;u4aet moeilsfa rlnms;()teenmr iadlpt livo;t setm(m3io4ol nmivtlt) Dur(rono0aeenmo3iytls2rl( p t) lerxrcoydfatrluvs s) euoiopiydllen nesa()s2rax o;o0ope mfeiatfs rl( o t) lxnifciotom e i ilt  2tm(mpio4ole liciatfarur(mono1altn ictad m um( pnt0teeomoctotlm   ivs s setmiopnu4alenmncsatfsDta(mp;t0tpenio3iytfa2el(vp (0 ltrmf oo1opDr nvi (0s2xmxm3oodamt mietlt)s2taumpoo1apt iictydfs2ea(vpnt0 exrir3oo1lmt ln i s s2trxm ou4ameelnvtls)a2rau oot4oeeoio3iysla rl(mo;u4texnmr3io1fmDe neil(0 ruo(r3oy4lmtnmiciat)s2rrx ont4opx if3tldfa2em(vpnt)trermf tydfm   n i (0 eto(m3oo1lmte ici ()s2rr(root4ole  fciltla2uau p;(0aexnif tatfa  aieils)t2xmiopnydom   fes t)srrmxronu0tltn ieildlaDrm(mont4 rtrircty1laDeauei;s s2tmxo3nu4lleeliet (fsrrrxm nu4altnio3ildls2eluvs;(0aleoif3oydlpD ai s;s0trurirpou1ole micslt sDuaumpnu1teen o3tas s um(vonu) ltrxr3ootlmD auei;s t2trxmpoydop elnes () 2trx poo0tee moeiatlaDuaumpnu0 lxrxf tytfpt ai i;( tetrxmpiy4openmnvtl() rraxr ;o0aeeniieilsfa2eauvo;t)artnxrciytlmDrluvs t  2toio3iy1al emfcil(  2uau pot4altn f3ild m ra(vs t)texoxfcoydomt  nesls0 2tmxr ny4amen netls s2ta( p;o0olenii3iytfs2el(vp (4 etoxo oodlatraivsls0 2umxm iu1llee iesls)sDum(root0tlxo i3ilslaDeluvo t) lxnxr tadoat livi ()trtm(r nodam emncia()s2uaxm ou0texniicildlsDeln p ()arerir iytlmDe ieo;( texrxo ou1om nmivsatf 2rax pnt0tetnmfciatls uaump u0alxrir3iytomDeauvsls)s2uoxopnydll   nvia() 2ua( ont0tlx  ictasla2umuvo ()aexnxo to1op elueo s0t2xm(r3oodom e ncs tf 2ur(mpot1tle micilsls2rm(mp () etrxfcoadfptranes;(0t2trirpio4apt lfvt sf rrrumpou0aetn i3iytlaDel(mp;t4trxnmo3todomtr ivols0t2uoio3iodapenmictl( s2taumpoo0alx miciadfsDemnmp u0alxoxrciotoaDe ueol(  rumim nu1lpen fesat) 2uru p;o0oleomietyd s uauvo;t4artrxr3oo1oa   n s;t0 2uoio3iy4ape  fesa(f 2rm( ooo1apt  ociatlm eaumo t0trxnio3oydfat ai slt)srto(m3oodap emfvtl(fsDrau ooo1tet iieiadfaDeanmon()trxomoctydfp elnes s trxoxo nu4lltelnei t) rua(moot0aex mieils a umnmont)texnxo iydfmDe uvi t t2trxm iydlptelnci sfsDrrum oo1oleomo3iyt mDuluvpnt4alerxfciydomtrli s ( sexrim3no1am e fes t a2rr(mpoo4aet ioeiysla2elu s (4 lxrxf oodopDeauei;(0tetr(r oodomtelieiatfaruaumo;u4oexo fetlsfa2emuvs t0 exoif tatlaD  ueo;() rxrim ny4lme  icsas)sDua(mooo4alt mf3iat m2uaumont) eerxocoodfa raneslt0s2tr(r3iudol  lfctl(  rrau pnt4opxoif3iatfmDum(vsnt4 lxnxr iatlat aivs;s  rtoxopiydaptemfvi s)a2ra(  nt4tptoioeildfm rl( on(4tltriociotom  aivo (0sexoxopnu4lmtnmnvta()artrxm nu4tptnmoetat a el( p;u4aeerxr3iodlm e i o;s0sexo(o3oo4opt mfcia()srrm(rpot1opxnio3ils s2uanvp t0 eeomoctytom  lies;() rxr(rpoo4omt lfetlt  Drrxroou1tltnmfciysfm2elumonu) exnmr3oytopDrauvi;s0 euo(o iudalen netltfa2uru  no0openifeiat a2rm( onu0 exnmfctotomt li s;s0s2tm(o
\ No newline at end of file
@@ -0,0 +1 @@
+iei;t sexm(rpny1al e icsasfaruau  ot1tlx  ociysls umumo;u4trenir oodopDrlnes;s0s2ur(mpny4lm   fvtas)srurxm ;o1opto oeild aDrmn p u4 eenio ty1laD  uvol( trumio3iudamt lfes sfarur( pno1aet ii3ils m el(vo;t4 lxrmf3iy1fpDranes (0 2xr(r3oudoltemfeias  2tru pno0alen oeilt sDrl(mpn(4teeoioctadfp rli olt0 2xoim3oodlmtelfeils)s2rm(m nt0ope  ociys sDrlnmp u)aleoxrcoy1fat ln s s trumxm3nodomenmivils s2urxr ;o1oeenmictldlm uauvo;t) lenxr3todomDeluvs;t  rumxrpnudalt  ieils a2trxroou4aptn oetytls ua(mo;(0 rtnir3iadopD luvs () 2xm(r oy1amtnlfcsls srtaxmoou0tlt iiciatlm emn o (4teenxo3oo1optelivs;()trxoxo iu4am elfvt (  Duaxro;u4ole mociasfm ranmsnt) lxnmo3oodopD ln i s texoxm3ny4op  mfetl(farta( p;o0texo oeiatls2uauvon(0 etrir3oydfmteaivols0trxmio3nodaptnmfcsa(farta( poo0tpe  i3iatls em(monu0aetrmo iy1faDrluvo;()s2tmim3ny1ole  iesa(  Drmu oou4aptnio3iyd aDumu s;() etnmf ta1lat lnvi;s  2trxr3no4amt  fct tfsDumu  ;u0open ociydla2raumonu0arxoir3oytlmtrluvo;s tetmxr nudaptemnct t)aDtmurono4tex ifctlsla2rmumon()trtnxfcoatopD au i;t s2um(mpou1olenlfct s sDtau ooo4tptoiociasfm ea( p;u0 lxrmrciytlm eai o;t)seuoio nu4ope mivsls  Dur(m ;o1oleo feils a2emump;t0 rtnxfciy1fmteaivo;s srtmxmpoudap  mncsls)aDtr(  nu4tlenmoetldfmDulnvsnt0 lenmr iodfpteliei ()trxoxr oudlmeemncs s)a2uaurpoo0apen fciyd aDelu s;()alxoxfcootfpte ieols)s2uoiopoy4ap emici t  2tmx onu4aee  feiydfa emu s u)tltrmo oa1fmt ai sl(0s2toxrpiodoleemnvsatfa2urur ;o0tpxnmoctytfa rluvsnu4 rtrmf iydlmDr u o (  rtrimpiy4lpt mnesasfsDrmxr ou1aet ii3tadlmDel( s;()tlxoio to1faDrlivolt)srxrxopoudomeelncia(  2tmum oo1teeo ictadlmDua(mp ()aleomo tydfmtraiei;(0 2trir3ny1lle mncsas) 2uaum no4aeeoifetadla2uauvp t0tltrifcty1oa rauvs t srtr(opiy4apen nctasfsDurxmont1aeen oetytfm2raumont0tetrxo3tadla eli s;t)srxoimpio1ole lfetasfsrtr(m ;t0apxo fciytlm2ua(mo u) renxr3iodlmtelivols0 rxmim3ny1ale lncsat  rtmu o;t1texomoctas a2ea(mp;()tetrmfcoydopt  u s s)t2urxr3iu4lmt mnes (farra( pnu1tlxoio3tadla2rmnms;u4arenmr ty1opD  iei s0s2xmio3nydol e fetat) rrm(m no1olxomf3iasfsDea( s;(4tltriocoadomDeaivs s)setr(o iudapeelfcta()aDumxr nu4optoiocilsfaDuanvp;(0trtrmf oytop e i o;s  exm(rpou1am n ietls)s2umumonu4teen iciatfa rlumo;t4 renioctodlp e i o () rtrim3no4lpeelivslsfsrtm( o;o1oeen fciatfaDelnmo t0alenir tatom elivo (0trtrxr3iodlpenmneia()a2um(  ot0apxo f3iadfmDul(mpnt)altnmr oy1laDr ues () 2toxrpny1op e ictl(fs2rax o;o4oeenifeiadfs umn p (0alxrmocoydlpD aneils) 2to(mpno1ole  ncsls sDur(mp;t4ole  ieiatls eanmonu) ltnir oydfp e iei;t s2to(opnu4lmt  nci ()aDtruroou1olxnmi3iat s uauvp;(4areoxo3totoatelies s0sruoio iodlpt  ncsa()arurxmonu0alxomf3tldfs2rlump;t) eeomf iydoa r nvs (0texrxo io1lmee icil(f rrr(rpnu1aee ioetatfs emnvpnu0 reomr oydfmDraies ( truo(opou4lp nmfvtlt)srurxmp;o0opxn fetasfm2rmuvp u0aetnmo oydoaDran s;t  2xmxo nudom  lici tfs2rmu o;o4aexomo3tld a rm( s (4 lerxf oytlpDr nvi;( trxmio iy4amt lfcsat aDrmxrp;t1alenioeiyd m rl(vs;t)arenxrcio1lp eaivilt  rxmiopiodopenlncsasfaDtrurpnu1oetomi3tldlsDelu s;t4alxnxr3iadomD ai s s trtmim ny4lle mieia() 2umurpno0oeto f3iysla umumsnu)trxrirciodfp eau sl()srurirpny4amtn ictat sDurumooo1tlto ieiysfs rmuvp t)artnif iodlpt luvo s)seuoiopou1omeemfesas aDrr(moou0aet  icildfm ua( s u)aetomrciydlaD au il(0t2uoxrpiydolt lnctltfs2uau onu4alt ifeild m2rauvo t4alermr oydfa  livols0s2ur(m iodlme mfes ()a2rmu ont1tlx  ietld sDelnvs t0aetrxocoytlp  lu s s)srtoxm io1ap n fcils) 2um(  ;o4tee mfctadls2ranvpn(0altnxo oa1oa ean s;s trtoxopiu1llt lfeiltfartmxroot1tpeomf3ias m2elnvs;(0trxoxo3oatoaDr uvs ( t2xoimpio4ape lfvslsfsDta( ont4tpx  ociyd m2emumo u0trenio3io1omtranvo;t0s2uo(r3oo4omt livtasfsDrm(r no0olenmf3iydla2ea(vo;(0 etrio3oo1fm elivi t s2tm(o nudal  mnvtlt)sDraum nt0tptn o3tad s2ra(mo;t0 ltoxociodlmt  ivi ( t2tm(mpnudopen ncias s2trx o;t4oetomociydfa umu s u0tetnmo3tatfm eau o;s texoxr3oo1al nlivt t)a2tm(moot1aeeoif3ildfm eauvp;u4tlxoir oy1lpteaueol( teuoxopnodop  mncs s) Dur( ono4teeoii3iasfmDrln s;u0 exoio oodlpDe u sls)trxmxm3iu1alenlicsl( a2tru  oo0oexnioctlslm2uanvs u)arermrciytfptranes;(0sexoio oo1lpe mnvtlsfs2tmurp;o0tlx mf3tad aDrm(mo;()trtoircio1lat anvo s0teumxrpiy1ole mfct ()srraum nu1texoiiciysfaDul(vpnt) rxoxo3iydlpD  n sl()teumxmpiu1olte nvsat)a2umxro;o4teto ieilsfmDra(mo;(0areoifcoa1fm  anvs (  2xrxo3oy1aptnmieiasfs2rax  ;u1alxn oeils aDea( s t)aeeomfctytfpDrlivol()t2ur(o ny1al elictls  rumu oot1tlenif3tlslaDran s;t)arxrio3tadfpDrln s ()trtmio3nodlm nlfetas s2tm(  ou4aet mi3iyd m2ulu o ()tlxoxo oodoa r u i;() eurimpiy4omtemfcslt sDtaxmpnt1open f3tld a2rl( s;t0 renio3io1fpDrlues s  exr(m oydlpe lfvi s) 2tax  nu0oeeo fctltla uauvs ()teenmo3tatlaDr nvi;t0seuoxo iu4ome  ieil( a2rauro;o1opxnmocils a2ulnvs u4texoxocta1oat  i o;t0 etriopny4lm nmneiat)s2rrumoou4tptoifeiltfa emuvpnu)arxnifciatomDr ueo;s0s2uoio3oy1ope lfeilsf 2tax  nu0opeoifeiadfsDemuvp t4altrmrctatoa   i sl(0texmxopiy1lptnmfet (fs2ur( o;o4open oeias m2ean s;()aeeoif iydom   uvs;s0texoxm3io1lle micta()a2rmxmooo4alen oeilsfmDelnvs ()trxoxrctytfat anvo t  eurxr nudam n nvi t) Draur oo1olt  ieiltlsDra( o (4 rtomf3ty1fm  auesl(0srxoim3oydapt mnei t)arurxr ;o4teeo i3ildfa ranmp;(4aetrif3iodfa r u i s0 rtmxm3nu4lpt  ivi s)a2rrxrpot1ape  ieildls2el(mp () ltnxr ia1fmDelneslt0trxmim oo1apt  nvsas)arumurpot4tlx mo3iysfaDean p t4texnmr3io1lp e ieilt)s2xrxr3iodam elnvi t)arrmx p;u4alx mfciltlaDemuvp;(0arenio3tytfatraivi s t2um(opio4amenlncs (  Dra(mpnu1aetnioetlsfs2rlnvonu4 rtoxfcto1optelnes s  2xmim3iudllenlfci ()srra(m nu0oet  o3iad a2emn snt4tlenmr ia1fmD  nesl()setrir oudll  miesa()aruru p;t4alen icilsfs um(vs;t4trenxr iatlm eaieo;( trxrxmpoy1lpe mfesls s2umx poo1ale ifetasls2ulu pnt4tetnmf3iy1lp r u sl()setmxm nu1lm n iviat aDuaxm ;o4opx ioetasls elnmp;u4teeomf3ta1fm raneo;s t2to(m ou4ape  fei t)sDrax p;u1teto oetyd aDelump u0trtomo3oodomDe i ils)srxoim3nu4opt  iet t)arua(mp;o4oleo fetasla ulu p;()trxrio3oytlmDrln ils0 etm(m3iu4lpt mics () Dtr(rpnt1tltniociltla2eauvo (4 ltoxr3oy1fmDr i s;( tetrim3oodlmenmfeta()a2ra(mo;o1tpx ii3tysfa2ulump;u)teenio3todfaDe neols srto(r ou1opeemnes sf Dra(mpnu4tlxnmoctasls2ulnvs;u4arxoxo3oytfmtraivs t)srxrimpiodalenlfesl() rrauro;t4openmf3iytfs rmn pn(0teeoioctatlmt li o s0srxoxr3io4ap emneiasfaDraur ;u1aexn f3iydfa2rmums;() ltrif iodopDrlieol()s2urxr3nydll e fvsatfartaxmpnu4opeoii3tldlm ua(mo;t)altnxr iytopt ln i s  eurxm io1lmenlfct sfsrtm(ront1oee mictydfs2ulu s (4teerir iotoaDe n i t  rtmxo oy4am e fvi t sDur(m no4alt mocilslm el(ms (0 lerio3ia1fm e n ol(0srtoxopoy4lmt mivtat  2ra( poo4aeen oetad aDuanms;t4 eenxr3oatoa  anes;()srxmio ny1lm nliesas s2um( onu0oet ifciydfa emu o ()tetnmo3oydomDrluvi t0setm(mpnodom emiviasfs2um(  ;u0alxomf3iat s2uln ont) exoxoctytoate n i () rxrxr ou1lmte ivtlt s2umur no1oltoio3tat mDemu o;t4alxrif3ta1omD ln s (0 2urxm iodop elneils)sDum(rpot4opeo ieiydls2rm(ms t4 ltomo oytlat anes;() 2trxo3oydaptnlfetas) Durx ont4alenifciltlaDelumo () lermf3io1op   i ol(0 etoxrpio4amtelieiasf rurx p;t1tex mocilt s2rl(vo t)arxoxo tytlaDe ivi t  rtoim3oodop elfctl( sDrmu  no4teto f3tyd a2ua(mp u)trtomo ty1om eaieo s0trtrxm oydamt mivi s a2tr( ono1oex mfeiyt a rmnmo;t0aleoiocio1lp rlnvs;t)texoxm nu4amtnmnetlsfa2uaxr no0tlen oeildlsDul(vs;t) rxomr oa1lmte uvi;() exoxm3oydap n icsasfsDrrum no4texoiieiyt mDemn s;t)artoio3ty1fa eauei t  2umxr3no4lle lfvt s)s2uaum ot4aeenmictyt m2emn snu)aetrxf3iy1fmD luvsl()trtrim iy1op e nvsas)a2urum no0tlenmictysfaDrmuvpn()trxnmr3oodfmteau i;s s2xmimpiu1amtemfesat arum(r nu4apeoio3tytfa rmumo ()teerxrciydlat au o (0 2tmxopoy4apeelfcil(  2rrxrp;u0olxnmf3ils s rmnvo ()tltnmo tytlmDr uvslt  rtmxr ou1lmt livs ()s2ra( pno4tee mo3ils mDulnvo;u)tetrmr3totfmte u o t  euo(m oy1lptnmics t aDtaxm nu4oee ii3iatfsDra(msnu4altnio3todlmDelneo;t)seto(m oo4lmeemiviasfaDtmum ot1tlenio3tatlm emump;u4aleoxo oy1fmD lieo s  exo(r no1llte ivilsfaruaxmooo4optomiciasls2umu onu4 renxoctytfp elu i s)seur(o3iy1al  mfesl( sDumxm nt0apxomi3ias m2ulnvsn(0arxnif oo1opD lies;s)setmir iu4ap emfvsat  2rmxmono0tpeoiiciyd s um(vp u) ltniocoytlmtelivs;( t2to(opiudameelnctls s2tmxmpno0oexniociltfm2ua(vo t4trxrio oodlmD aneo t0t2xoxo3oy1lpeelieiat  2ta( ono0tlx mi3ias a ulnvpnu)aexomocoodlpDrlieo t)teuoxrpio4oltn iciatfartrx ono4tptnifctysfm ua(vonu)tetrxr iatoateluvo;s0texo(opoydap nlncsl() rtr(monu4aex  fcilslsDeln o;t0tlxoioctotopt lnvi () exrir nydap e feias) Drmuro;o0aetomf3tytfa2umnms u)tltoxfctatop e neols teurir3io4llenmfeias arrmxmp;t1olen ocilt sDrmn o;(0 exoir ta1lpt ln olt teur(opno4llenmnei () 2tmum ot1alxnmfciadls2rlu p t4alxnif3todlptr uei t) exrxo io4al  licil(fsrua(rpno4oexn f3ias mDeauvp;t4teenmr3io1fmtranvolt0 2xrir no1ol n fetas artr(mpno1olxnio3tas s uau o;u)trenxr ootlpDeau olt0srtm(mpiodape  fcsa(f 2rmxm oo4olxn feiat s emnvpnu0arxrmr3iydlpteluvo;t setoxrpiy1ap emfvt tfsrraurp;t1tlenmoctytfs2ua(mont)teeomrcoa1om eaieil( s2xrio ny4lleelieil( a2umx ono1tex  oeiydfa uan s (0 rtrircoatfate u i t0 2xo(o iu1lmtnlfeils) rraurpno0opx  feias s em(mp;t0trxnmocia1optrlu ils0s2trir3ou4am nmfvi (fa2trxmpnt1aeenmf3iys sDuanmp;u0tltnmo todopD li o t0setrio ou4optnlnet s) Dur(mp;u1aleomo3iyt a uanmsn(0teeoxfcoo1fpD lnvo s) 2tmirpou4apeemnetlt)artmxrpnu0aexnmfciys m2rauvs (0 lxomfcoadfm elieo;( teur(m3io4ap n fcslt srtrur no4opxo oetasfa eluvsn(0 ltrmo3totlate u s;s s2xrimpoodoltnlnetlt arra(r ot1alxniieiysls rl(mo u0 etoxrctotfptrlueols)t2uoxm3nudomtnlici (f rtmxm oo0tptn ieiydla uanvo;t)trtrxocoydoatrai ols) rxoim ny4ll elfvtls aDtrx  ou4tpxomiciytla2ea( p;(4alxrxr tadfm r iesls0truo(m3oudaltelnei (farrruroou1tltoifcildfs ea(mon(4aeeoxr oadlatrlnvi;s trxriopiydopen icias a2tmx oot1alxnmi3iytfs2ea( pnu4 exnir3ta1lmtrlivsls sexmim3iudoltemnet tf rurxmpoo0apxo ieiydlm rau snu4tetoxo3oodopDelies ()trtm(m iu4opee fesa(fsrrmumo;t4tlx  ieiytfs uln s;t0tlerxr iadfmDeaueols0s2urio ou1lm elnvtat s2tr(mo;o4tlxnifctltls2ea(vonu) rtrircoa1lm   nvolt)teumir3oo1ameelnvia()s2um(mo;t1tlxoii3tyd a eluvs;t0 etnmfcootoaDr ueo s texr(o3ny4ope mnvi s arraumoou1oleo ietlt aDul(mpn(0artomocio1fat  nvs;( srurio oo1am elncsl() rumxmoot4tlxn i3ilsfaDulnvonu4 eerio oy1oa  anvsls srxmiopoudapeemfctasfsDuaumont4openmiciasls2eau on()trxnio3ty1opt  uei t)srum(mpnu1lpen ivt t)artaum nu0oltnioetytfmDeluvsnu) ltrmr3to1fmDe neil() 2xo(r no4ll  licslt)a2rrx oot0olto octadlmDeluvo t4aexrmo3iytop  li slt s2xmxo no4amte nvs s) rua(moot0texniieiaslaDemuvo ()arxrxo3oydom elnvo;s0 etr(rpoodol elnetas arta( pnu4tlenmictatfs2emump (0aeenif3ootoatrai o;s)srxriopny4ope mietl(fsDrm(mpou0tle mi3iadls2umn ont4aetnir3io1laD  nvs t) exm(r oodlm   nvtat)srtaxr no0tpto fcias aDem(vo;() ltoxr3oytlpt livo s) rtr(m ou4op  lnvtl()aDrr(rpot4aexomocild a2eaums;u4tlerifctydop eli s s t2tmir3no1oltn neiatf 2ta(  ;o1aptomoeiasla um( pn(4trenmo oo1lp  ai il(0seumio io4oltn fesltfarrmu pnu4apxnii3iys m eanmon()trtnmfctatlmD aivs;t  eum(mpnodale lnct (f rumxront1ole  i3iyslsDrmn p u4arerxociotla rlnesl()t2uoxo ou1ome lfvs ()aruau oou4alx ifeiltls2em(ms (4alxnif3tatfpD anvo;(0 2xoxr3ou4lleelfcilsfaruaxr ;o1opeo octldla uauvsn(4teenmf oytoat  ies s)trxoio io4apte fetl(fsrrr(ronu0apxnii3ilsfm emumo;(0 etrmf iodfpD lues t)srtrxr ou1ope lfes ( s2urxm oo0teen ociytfs rmnvs;(4treoxf3oytfmteaueils0s2xr(m3no4lm n nvsa(fsDuau o;o1olx moctltfm2emnmsn() etnif3ootlpDe i ol() 2xm(o no4lmen netlsf rtr(mo;t1opeomf3tldfa emnvo (4alxoif3oadoaDe ivols)trxmirpnu1ap nmicil()s2rm(m nu1ole mf3iysfsDeln s;u4 exoxfcoytfate ivi;(0 eurxopny4ap nmnctatf rtmumooo4tex iicildfaDuau o;u)aeenxrcty1oat ai s (0 2urxr io4llee fct t)arumur ;t0alxn oetysfsDumuvsnu)teermo oo1oaDe n s s seto(opoodaptelnvs s)aDumx  nt1oexniocils sDeanmpnt)texomf iatla  aies;( setmiopiy1omtn fvtlsfsrtr( oou0tpe iiciasla2rauvpnt0aeeoxr todoatran il(0s2um(m3ny1oltelicilt) 2tax  ;t1opt mfeiltfa2rmnmp t0 exoxfcty1fmDeln i;(0t2ur(rpno4lmt  ivt ()aDuaumo;t4alx moeias aDran s (0 exoxrcto1faD aivilt0s2to(r no4amenmfcs t)srrrx  oo1texniociatfm2rlums;()trxoxo iatfa raiei;t0 etrim ny1openliciat s2rmuronu4tet  ociltlm eau s;u) leoxr tydlp eai o;s sexoxr3ny4lltelfeiltf Dtax  ou4ope  ociatlaDel( s t4 rtoio oy1oa e n i;t t2ur(m oydomte fvt (fa2ta(mp;t0tlenio3iat a ul(msn(4 rxnxo3oatfm  luvol( s2trxo oo4al   ncta()sDumxrp;t1olenioctls m umu o (0 leoxo3ta1lpDr uvilt)t2uoio io1lpt  net tf rtax pno0apt iiciytlm2uan s;t0aeeoxocty1lm e nes;s tetmxr oudomt  ivi ( aDtru oou4aee io3tyslsDul( s (4 rxomf3oadla eliesl( t2uoxm3ou1lpte ivi (faDumxmpnu0tpen fciyt s ul(vs;(4 leoxf oodlmDrauesls) 2tmxmpoy1aptnmnvsasfa2raxroou4alx iieiasfa rmnmpnu) rxrmrcty1lp elneo;s trtoir3iydolt mnesas)s2tau  ;u1tee mfciydfsDel( p t4alenxfcoydfaDr ivo s) exoxo nodlm  lncil(f rtaxr ;o4apt mfctld a2emnmo;()artrmfcoy1fmt au ilt  2uo(rpiodope mivs ( sDrmxrono1opx moeiyslmDrlnvo;() lerxf tatomtran olt) 2ur(rpno1am  mieiat aDrr(r ou4aeen fctlsfm rluvsnu4aexoxr oa1fmD  nvi;t)teum(mpnydamt lncias)aDuaxmooo1tee iociltfaDem(mp u4tlxoxf3iydla rlu i;( seto(opou1omt lfct s)sDurump;t1aeeomi3ild s2elump (0 ltomf to1fat lu o;()t2trxm oudaltnlnetlt artrx pnu0aetoifetlsfm ulu ont)tlermr3oodomtraueolt  etr(r3io1om   ictl()s2rr(rpoo1teeoifciatlm2rm( p t4tlxrif oodopD anei s)s2umio ou4llte nvi (faDtaxrooo0apxnmi3iadfaDrl(mp u)trxrmr3iodomtrau ils sexm(m3ou1op  lfesat aDur(rpno1altn ieils a2eau o;u0 ltnir io1lp   nes (0 2urxmpiydamtnmnciatfarrm(r ;t1oex mfctltls rmnmo;t4tlxriociodlpt  nvols0texoio nudlme mfetatfa2tmxmo;u1tex mo3tld m ul(vo (0 ltomf oytlaDr nvi;(  rur(mpny4omenmfcsls  Dra( ont1aeeo fciysls2rm(vpn()aetnxr ia1lmDrln i;(0texo(o oydom nmnvsasfartm(r ;u4tpto ieiadfs elu pn(4arenxf oo1om  lues;t s2umxo3iodlpe  nci s  Drr(m ;o1oex mociatls2umumpn(4artrmr to1fm  an o;t)sruoxm iy4lm n nei s)s2trumpnu1aetnmfetltls uan pn(4altnxr oo1laDr i s;s0teuoiopnudapenmiesltfaDrmu pot0apenmi3iasfmDumuvsn(4 eenmo3oa1fmtrln sl()t2xmiopnu4olenlnctlt) Dtmur ;u0oeenmf3iydfs um( pnu) lxrxocootfa r n ol()setm(mpnudap nmictatf rtr(mo;u0aetoifeiadlmDemump;() rxomf3iatomt  i o ()texoir ou4op  mfesa(  Duaxm no1aptomiciys sDeau o ()tlxoifciodomtr ivsls0 2urxopiy4llenlncsa() Dtmum ;u0opxnmicils mDra(mo;t)tleoxf oodopDrlivi;t0 rxo(m ny4lpte fvia( s2rm(mpnt4olx mieildlm rau onu4altnxrcoytlaDr i s () 2xr(o oy4al  mnciltf Drmxmpoo4openio3tldfmDra( o u4altrif3oo1fmD lneslt0 rto(o io1olee fcilt)sDtauro;t1teenio3tad a2rlnvont4 eenioctotlptrli o;t) exm(m nydalte ietls s2tmx ooo1aeeo ocias mDrm(vs;(4arxrmrcootomt livs s truoimpoydolenmieias) 2rau p;o1ope  ieias aDumnvp u) rermf iy1om e uvo;s)trtoxr3oydam  lneilt) Drmumont1alto fctlt sDrm(msn()artoxr iydlptelies;s setoio3iodlp  mfei t srua( o;t0oltnmociytfs ra(von(4artoxo3oydop  lnvolt srumir oy1ope  feilt)aDur(root0tptomfctadfa2eanms u4artnifcta1lp  au i s s2tmxmpny4lmee fcsas  Dua(r ;u4aeenmi3ild aDrm(vo;()tlxnxr3tytom elieols)sexrim3oy4amt mfei t a2um(rpou0optnifeiysla rln s;(0trerxo3oodfa rluei;s0seur(r nodolte fci sfaruaxr ;o1olx iocilsls rmu pn(0tltnxrctydfat ln s;s sexmxmpiy4lme  ivil( a2tmxmont0opxomo3ild s2uluvp;u0tlxnif3todfmDrai o s0t2uoim3nu1lmt lnviatfs2tauronu0aptnmoeiadla2eln ont4texoxo tatfmD  n i () rtr(o3io4ll nlnvias  rua(roou0aeenmfciadfsDumuvo u4 renxo3iytomtrlu s s0tetrxr3io4olenlfvi s a2rm(  nu4alxnmoetyd m ea(vsnt0altoio ty1lptelieols0 2xmxopiodam  micsatfsrum(mpnt4tpenifetad aDrmump;(4aetoio3iy1oate nvs;(0srtmxr3iu4opt  ies t)srururo;t1oet  o3iasla2raump (0 etoif tytoaD aieol() 2tm(o nydolt  fcta(  Dra(ro;u1apeniocias m um(vs;u) lxrif3tadlmt auei;s)srxrxopoydam n ies t) rtau  oo1tet ifeiys a raumo;() ltomocootom eauvs;() rtr(m3iu4lme lfvi tf 2uaxmpno1teenmicils sDelnms;t0 ltnmfcto1fmt lu o;(  eum(opoo4lptn fcilsf 2ur(rooo1olxoif3tytfa ean p;t0altnxrciytlmDrlneo;s0s2xo(m3oodll emfeilt) Dtrxmonu0oexn o3iytfm2rmuvp u0 lermf3tydlmtrlu ol( t2umiopnu4lp e nvt ()sDrmxrp;t1tptnmf3iltfaDrmumont0arenircoodfmteaieilt texrxrpiydape  fes t s2rr( oou4alenmietysls2umn o;t0aleoxfctydfmD lnvs;( trxm(r3ou1lmtemnvslt a2tm(mpot0tpx if3ilt mDrau o t)teeomo ty1fmDeanesl( t2toxm3io4amtnmfct (fsrumxr nu4apx mfeiadlm2ranmpnu0tetnxo3tytlm   ueols t2trxr3iydapenlivi ()srua(ront0tpto f3iys mDrlnvon(4alxrxr ta1fmD ln o s)t2xm(rpiodolenmietls) Dua(r ou4oexomieiaslm elnmp (0 reomf iydopteauei;t0trxmiopno1ape mivsl(faDrau pnt1alxn ictatlsDumumonu4 leoxrcoy1oat luei;s) rumio3oudop   fvtasfaDumxrono0alxomf3tytlm ul(vs (0trtnirciatla eanvo;s  2tr(o3ou4apeemfct t  Dta(m ot4alxomi3ilslm eln pnt)tetoio oydfat ln s t)tetmim3iy1ole mnei sfsDtr(mp;t4tetniociasfa2eluvo t0trxrmf tydlpD livo;(0 2toiopiu1oltn iei s srtru  ;o0aptn o3ild mDua( s;(0 exrxfcta1lm eaies;t trxm(m3no4lp emici s) 2trum ;o1tlxniictyd s ra( p;t0tetrir iodla rln ilt)seurxm oy4oltelicta( aDrmu  no0apx mo3iaslm rlu o;(4 lxrxocty1lp   nvil(0t2toxm3io1am eliet (fartmuro;o1apx  fctyslm eluvp t4tlxnmf oodlaDrlieolt seumxmpoodamte ivsl()aDrru o;o0tltomiciaslm uluvo u)tetoif3ta1lmDeaies s)teuoxopnydolte fvtas)srur(mpou4olt ifeildfa2eanmp;() eerxo oytlpDraivol() rtoxrpno1lp n fesa(fsDum(r ou4oex  ieias sDemnvsnu4trtrif3iadopt  i ils srurxm3nudop  mivsl(faDta( o;o4tet  ieiad sDua(mp;u0 exnxfctadop   u il()srtmiopnodameelietat sDur(  oo0oex  feiydfa2ranvs;t)alenxf oy1omDelies;s) 2toxm3oo4ap nlfctltfsrraxm ;t0aptomo3taslmDel( pnu) exrxf oodoaDeli sl(0 2toxmpnu1lme  fvs s) Drm(  oo1tee  oetatlsDul( s t0altrio3oo1laDeanes (0srxmxo3iodlpe  ncs s a2rru pou0aet ioeiadfsDrm(vo u) lenif to1oat  nvs;()srurxmpoo4ap nmnesas  Duau pot4apeoifetydls emuvp t0aetrxr3ta1laDeaivols0 euriopny1al e ncta( sDumuro;u1tet mictysfs eluvo;t4 renifcoa1lpDeaivs;t  euo(o3oudomeelfvslsfsruaur no0tpxo fctyt aDrlumsn() lermr oa1optrauvsl(0s2xmxo3oy1lp n ict t  rua( p;u1tpeoifciadfsDraumo;() eeoxo iadoat an ilt) 2xo(o3nydole  fetas artmxm ;u4aetnifeiasfsDum(monu)arenmf3oodfpDeanvo;(0 ruoxo ou1om  mieiltf rua(root1apen o3tat sDuanmsnu0 renmfcoadla  luvs (0t2uoxopny1aptnlfvsa(f Durumonu4tlxo oeiadls2rm(vs t0 etnmf oo1om  ln s s seumim3oodoptemiesat)a2rmxroot4altnmf3tltls2umnvo;u0 etrxfciydfmD ln o;( trxoir oy4lmt lict ( a2rmuro;o1tet mfeiys a2eau snt0tltnif3oo1oateluei t truoio3ny1lmenmnvi s arururpou4oet  ieiytlmDeanms u)aexoxfciydoatr u i;s)s2ur(r oy1ol   fvsat a2rrx  ;o1tlen ociysls em(vs;u4teenxo3io1fpteaivs (0trxmim nu4alte fvt s s2tm(  ot4tex  o3ilt s uanms u0trxoio3tadop rln s;()trtm(mpiydopenmfvils  2tr(rooo0altnmi3tls mDrmuvpnt4aleoiociodomD an s;(  rtrirpoodam  lnvsat a2ta(r ;o1oetomfcilsla ulu p () lermociatfp eluvsls0srtmimpny4lptelnei ()aDtmxrp;t1tlxoifciasfa2eluvpn() rerif3oatfp rlnvi;(0sexmxr3nodlp nmfes sfsDrrump;t4opt  ictyslsDuanvp;u)aeeoxrcoodfmD  n slt0texmio io1amtnlneia() rtrxm ot0olen ietatfa2eanms;t4 eeniociy1lmte nei () exrxm ny4lmt lietasfartm(r nt1texo i3iys m umumo ()alerxr3iodlmDrluvilt)trum(mpnudom nmivilt) 2uax oou1tpt  i3tydfm ua( on() lenxfciodfmDelnvs s  etoirpiy1oltemnet (fsDur(  ;t4aexomf3ias m2rauvon(0alerxr todlp rlivo (0s2uriopny4lptn ivia(fa2tmumoou4aleo o3iytlsDeaumpn(4artoio3iadlpteanvi;t  2toxr ny4lm nlnvtat)a2ra(r ;o4oeeo f3iatla2rlu onu) lxomo3oydlm  lu s (0 eumxo io4open feiat aruau pnu0oleomicildfm2uan onu0alxnif iytlm ran o;t  2tmxr3io1ll  lnvtl( aDraxrp;o1tet mf3tlsfs2el(vpnt4altnif tadla eau s;( t2tmiopnudape lies () rur(mp;o1apxomi3tls m emn o ()teerif3oy1om  ai s t0sexm(mpno4alee fctasf 2trxrp;o4apeniieiys a rau s;u)aetoxf3iodop e i i (  rtoio ny1lpt lnctat)s2tmur ;u1tpeo ieiyd a2uaump u)alxnxo oa1laD  uvo (0texmxm3iy4altn iei s  Dtm(rpou1texn f3tys a em( snu)trxnifcoatlmDeln i t  rumirpou1ome mfvi s)srtm( oou1oexoio3iysls2elums u)aexnmocty1oaDraueil(0s2umiopou4oltemfeiat)sDrr(m no4opxn ociydfaDeau p ()aeenmf oodop rliei;t0s2um(r oo4amtn fvslt)sDrrurpnt1tlt mfetlsfsDrmnvs;t)tlerxociodfmtranvi t0 euo(r3io1optnmncia(fa2uaxmont0tpx ii3tat aDea(ms;(0aetrmo totlmteaues (  eumxr3nodamenmnetl()aDtrum ot1tee mf3iysls2rlu pn(0aeenxr iadlatrluei;(  2ur(mpiydam  mieilt aDrmx pnu0oeto ictad s2el(mon()artrxo iadfa r nvolt0srxo(rpoy1oltelieias a2tmuro;o4apx  i3tysfaDumn ont0aetnio3iydlp e i i;s  rtriopoydlltnlivi t arraxr nt4optn iciasfsDelnvp u)alxrmr tadom eai s;s seumxo3iydaleemfvilt) 2rm(ro;t4ape mociytlaDemumsnt0aeerircoy1fp   ueo;t0trxr(r3io4ol n nciasf 2umumoou4texniieildfsDeln p u4tlxomo3tadopt  uvo;s)texrxm3no1ll e fvil(fa2tru  ot1aetn f3iyd mDrlnmpn(4 rtnmo3oa1fmD aues t)s2urxo oo4lp   netltfaDtau o;t1aexo fcilsls2ea(vs;t0tleriociytfa r ueo ()s2xmio3nu4oltnmfet t s2ua(mooo4tpxomoetasfm2em( s;u0 lxriociydfmDraies ( teurxm3oy1ope mnci sfarur(m ou0tpt iieiadlm2rlnvsn(0altrxo iy1la e ivsls0 rumxmpoo1lpen nvs (f 2tmx  ot1tptnmoeiat s rm( p;t0texnxr oadfp   uvol( srxm(opoy1oleelivsas srumur nu4apeo octys sDrluvp t) etomf oatomteluvi;(  rtmxr io1aptelictl(fs2urxrpoo0tetn i3iydlsDrlumo;t0tlerio3iotop e i ils0t2xmxmpio1aptnlnvsat srurxr oo1olt mieiatls rlnvpn()arxnxo tatfptr ueol()trxrxr3oy4amenlnvt (f Dtru oou0oex  i3ildfsDelnvs;u4aeeniocoatfat luvi;t  etr(o iydlmtemicsls)sDtru p;t1tet  ictad a2umu s;(0arenif tadlmtr i i s) exmirpny4lmtelict s) Dtmumooo4tex mieiydfaDuln o;t4trxoir3iotlmD ai ol( trxrxr3iu4ap  mivi ( sDrm( p;o4olxnmi3iad a rln o (4 lenxo3iodlptrlieo t0trtr(m io4olee iei sfa2umumo;u0tetnio3iat m2uaumo t) ltrxfciodlpD  ueo;t srtm(r oo4lmtn ivi t)sruru  ;t4aexniieiys a2ua( p u0tetnmf3iadla e i o ( t2toim3oydoleemnci ( sDuauront0oet io3tlslmDranmp ()treomo ootlptraneilt)trxr(m oo1optnmfvs s srrr(r ou4apenmo3iatlaDrln s u4texrircio1omD  neo;t) rtmiopny1apen ncil() rururo;t1tlxnmfeils aDra(mp;(0arxnmo3oodomDelnvs t)s2umxo3oy4al nmfeilsfsDtau p;t0aeen f3iasfa2ua(ms u)tltnxo3ootoat lnvi;( sexmio ny4openlnesls  ruaumpnu0aexomociatlaDuaumo u4teeomr3iatla  ln s s s2umim iu4ll   netls  2ta( p;u4oleomociytfm2emn p t4trxnir ta1oateluvi;() 2xrimpny1apeelietl()aDrmxmonu4tpenmf3tldfa rmn snu)tlxrir tadfm eli il( s2um(r3iu4ome  ivtat) rtaxm ;t4aeeomieiad a2ea(vs;t4aetnxfcoodop rauei;t)seuo(o3nu1lm elici (f 2trum oo1tetoioetls a umuvpnt)aetrxrcoytopD lnei;t s2trimpnydope mfcsatfsrtmxmpou1aexnmieiydfaDrauvo;t)alxomo io1lpDr nvi;t  eurirpnydamtn ncta()s2umx pou0oltoiieilt m2el( p;u0altrir3iytoaDeauvs;t) etr(mpoo4ap   fcs t) Draurpoo4alt iietatfmDrmnmp u)tlerxocoydlpD aues t) rtmio nodop   fcilt sDurx oot1apeoiicilt a2um( p u4texrxo oydomteau ilt)srtoxrpnu1ope  nvs t s2ua(mo;o0opxo i3iaslsDrmnmp;u4tlenmrcoa1faDe i ilt) euo(r3nydoptemnvil(  Dtmurpno1aexn fctat s2ulumpn(4aeeoirciotlpDraivo;t  rxmim iodlmtelnctlsfarrm( onu1opxnifcilsfsDranvont4artnio3oa1fpDrln i ( t2xm(rpno1lp  lnvslt a2rru  ot0tpenmietysfsDranmp;(0 renirciotla rlieils)t2umir3oo1apt  ieilsfs2ur(mpoo0opto fcilsfa uau p;u4tlenio oy1lm rlieols srxrir3ou4lmte fvil(fs2trxm ot0oetniictld aDemuvs;(0aleomrcto1lmt ai i;(0 eur(o3nodope  iesa()a2ta(mooo4alx mociyslsDum( o t4trerxo3ia1op  luvs;t s2xo(r iy4ol nmnctas s2ua( ooo1aetoiicildlm2rlnvo u4 eenif3tydfpteauvi s srtoio oudale lics t)srtrxrpoo4olxniieiadlaDraums;() reomr3ootoaDeaues;t0srtm(r3oydope  ncsls  rrm(mo;t1aexo ietytfmDemnvo (0aexnmocoydop  aieo;( trxoxm iydomtnlfet (  rrmxro;u4oltn feilsls2rl(vpn(4 eeoif oatop eai ol(0 exo(mpoodalee iviat) rrmumpno1aleomfetyt mDrauvp (0aeenmo iydlmt aies s0 2trim iu4ol n neta(  Dtrurp;t1tpenifetls sDrlu p;u) lerio ootfmtr nesl() 2urxm3iy1ll nlfes t)sDtm(ronu0olt iiciydfa eaumsn() eerxf iodfat anvil( t2tm(r oo1aptelfci sfsrumurpnt1opx mfciasfa2umnvs;t0aexrxf3iytopDeau il(0 2tr(m oo4ol   ies tf Dum(root1oleo feiatfmDumnmsn() rxnmr io1optean o;t  exrxm3nydomeelict (  Dtmxmoot1olenif3ils mDua(mo;t0 leoirciodoa r i s;(0setr(o iodomee neil( sDurxr ;u0opx iicildlm raumpn(0altrirctydlpDranei t0s2tmxmpiy4ame  fctlt s2umxroou4oltomi3tad aDranmo;(0texoxo oatlmD anvs s  euo(r3nudalt mfcia(fs2rmu oou4aet iietyslm2ua( snt) ltrmo oydfmD lnvi s) 2xr(rpoodamenlivia()aDuaumo;u4oetomieiyd aDumnvpnt4 exniociy1optean i;t0truoir iudom elnvs tf Duax pnt4tpe mfetld a uluvp;t4aeerxrctytfmt auesls0 etmio ou4altn nes ( aDtmurp;o1apxo icild sDrmumpnt0 eeoxo oadfp eli sl(0s2uo(rpiodll   fcilt aDrr( onu0teeomocias s2umumsnt4 rtnirciy1omtelivi s) rxm(r3oodapenmfcs s)aDrrump;t4tee mfeiys a2umnvs;u0tlenxr3ootfaD aivols tetmiopiodlpe lfeta()a2tmumo;u0tltnmocils a rmnvpnu0aetrxr iydfa rlieil(  rxoxo oydll  mivils)s2tmxroot0opeoiocildlmDrl( s;u4tlxrmo to1lp   ies;()t2uo(rpnu4amtemieilsfsDtmumpou0tee iociltla rmn o t4 eeomo3totfa  anvsl() rxrxr3nydap n netlt)aDtaxr ot0optomi3iyd s2em( o;t) lerxo3iotlp ran s;(  rurxo3oydaltn fesasf 2taur ;u4opt iocilslm2ul(vo t)texoxrcoa1omt lieo t)t2umxm ny4al nlfes t)s2rmumonu4tlt mf3ild a2ea(vo t0 eerifciatopte u sls0 2xoxo iy1apen icias)a2trumpno0oltnmociltfs2rmnmo;t4aexomrciy1lpD lies;s0s2tm(m iy4ap e nesasfartaxroot4opxnifeiasfs umnms;t)aleoir3iy1op eaivi;t) rxoxm3nu1ol  mncil() 2raur ;o0aexoifetydfs em(vsn()trxoiocoytomDeauvs s)teurim3iodlpe liesa( sDrm( pnu0ole if3ildla rm(vp u4altoxf oytfpt anvo;s t2toxr3nu4ap  mies t  2rrur ;t4oex ii3iytfm2umu s (0 etrmfcoodlaDeaies;s s2urxrpoydop  mfetasf rrruronu4aet  fctydfa ul(ms t4 etrif3oodomD luvsls0sexmxo3iu1ale mfeilt)sruaxmo;t0oexnmf3tadlm rmu o u0 lxrxf iodopt  i ol( t2xrimpoo4oleelivi tf 2rau onu1optoio3iydla2emnvp;u)trxriocio1lat lnvslt s2umio no1op n ivi tfs2ur(mpnu4optn o3tys s2em(vp t0 etoirciytfm r u ils t2ur(rpio4lptn nei s)a2rr(rpou4tpxo ictasfm2rm(ms t0altrxr3oadlm  au sl(0srum(rpoodolenlieilt)aDrm(monu1oex  fetltfa2emuvs;t4tltnio ia1omDeluvolt0t2uo(o ny4apen fvil(faDrau oot4oleniociadls rm( s;t0tltnmfcootfp eaies t  ruo(r ny4op   nctl()s2um(mpoo0alt mi3ildla2ranmsnt4 lermr3oatoaD auei;s tetr(m3iy1ap   ies ( a2ua(ro;u1tpen fetad m2uauvs () rtnxo3totla rlu o t  2ur(m3oy1op elfesa(  2rr(r ou0olt mfeiatfa rluvsn(4 lxriocoy1fmtrlnvsl()s2toxo3oodlm nmnci t aDrm(rp;t4oet  fciytla2uluvp (0tlerxf3iy1fat  ivo (0sexrxopoo4lmen fvsasfartmu oou1tltnmoetltlm rm(vs (0tlxoif3todlp r n o;(  2tmirpiudlpeemfcsasf Dtmu  ;t1tlxn feiasfsDelums u4trenxf oo1fpDeaies;(0teur(opoodlp  mivilsfsrraxmp;o1opxomictas a2emuvp;(0 exnxfcoy1lmt aivo s  rxoirpio4ame lfvtas arurx pou4aleoii3iatla em( o t4 eermr3tatfp elueo t trtm(mpoudom nlivtltfaDrrxrpno0tpen ociadfsDemn pnt4aexnio iy1opDr i s (  etriopnu4optn feta( a2tax onu4oex ifeiadfaDum(mo;t0trxrxr oatlm rlnvs;t  euoxo oodome lnci sf rtaxrp;t0oltomfetldfsDuaumonu)trxnxr to1lm elieils0 ruo(rpoo1ll e neil(fsrtrxmpot1tlxomfciltfa rmuvp;(4trxnmo io1faDrluvi;s0 etm(mpiu1am n nvtatfaDtrx pnt0tee  fctasfs2ua(ms;t0 eeoxf3oytlmDrln s s0 exoxo3ou4oltemnctasfaruax oou4aptn ieiysfm emuvo ()arxrmo3oa1opD ai ols sexoim3iu1olenmfesls) 2uaxroot1opxoio3iltfmDuln s (4 ltrxf oodlpDe nvs;t t2xo(rpiu4amtelics tfartax pnu0tpenii3iatlsDran s u0 eenir oydfpDeluvs;() rtrxo3iu1apt lfci sfarumumoot4tlx  i3iat a2uaump (0 rtrir3iodfmt  ies t)tetrxm iu4omen ivi (  2taxm oo1apxn fetat m ranvp u4aexrxf oatfm   uvols0 2ur(o3oy1lpe lnvtlsfsDumxm ;o0tptn fciltfa rlumpnt4trenxfcoydopt aneilt  euoxm3nodaltnlfvi sfaDua(mpnt4optnmoeiasfmDrlnvo () lenif tytfpDr nes t)setm(rpiudlme  nctls  Dra( p;t1tpt  i3tlsla2emn s t4alerxocoydlat luesls) rtr(o ou1om nliei s  2uaxm nt4ale  ictadfm rmnmsnu) etoif oy1lp rauvi;t0 rur(rpoy1lpeemivt s) Drr(  ot4oeeoioetydfm2rl( p t4arxnifcoy1latr i s t  rumxr3oo4ap e nvtlt)arrmur ot1apeniieiysfs uluvpnt0altnif3iytla r i s;()t2umim3iudal emics t)aruaxr ;o4tpxn octltfs2emu o;u0alenxr oadlmDeaieilt)s2umxopoo1oltelncs s)s2rmx  ou0alxo icildfs um( p (0 ltnirctydomt  iesl( srxr(o3iu4apt livt t) 2ra(mpno0oltn octld m elums;(4 lxrifciydlm  li s;s) 2uoir3ou4opt mnct sfa2rmumo;u1aeeniociydfsDul(vonu)aetnio3iy1lp  lnes;()trxrxmpio4altn nvia(  rum(r ;t4teenioetltfa2eanvonu0tltnxo3ta1faDelivi;t setoxrpiy1optnlfvias) Dur(mp;u1ape mictydfa rm(ms;u0 reoxr3tadomt liei;t0srxo(o iodlle mivsas)s2rauroot1tlx ioctas a2um(msnt4 exrif3oy1laDr i sls)t2to(opoudll e fei t  rururp;o0tlx ifeilsfsDrm(vpnu0 exrmrcto1fpDelu o s  2tr(mpio4aleelfvia()a2tax pou1oltomieiaslaDelnvpn(4arerxo io1oaD  i ol(0 2tm(r oydalt  iesat)aDtr(r nt1aeeoioeiat a eluvont)trtoxfcoadlm rli s;t) 2uoxo3oy4om  mici s s2um(ro;o4aet  i3iadfs2raums;(0 reomociodlptraivolt seuoiopny1apt livtl( aDraumo;t0oeeo oetysfm2rlnmo u)tleoircia1la rai il( trurxr3no4llt  nvtl( s2um(rooo0opxnmfeiasfm2ra(mo u4aetrmoctytfat anvo;t0 2urio io4ol nlnet (fsrrau  ;t4olen oeiasls emnmsn()tetnmrcoydfaDraneil(  2um(o3iy1op nmict sfa2rrx  nt0tptomociytla uln pnt)aeerio iatoptrlu slt0tetmiopno1amtnlfet t)s2uau o;t0ape mfctydfa rmump;(4 renxo oadoptran ilt  euoxrpiu1ale  ietasfsrrax p;u0apt mo3iysfsDeluvs;t4tlxnmo3iatoptr ueo s0 2umxopiu4ale lfeiat) 2umu p;u4olto ieiydfs uln o;u4teeoiociydomt  u ilt0trur(opiy1al   ics s) 2uaxmoot4oeeo feiad mDrauvonu0arxrir ty1oa rlu i;s0t2uoxr3iu1lp emnvslsfs2ua(r ot0tptoiicilslmDua(mo t)tltrio3io1oaDrau s s)trxmim nu1openliciasfs2umurpoo4ape  oeiyt m eluvp;t4artniociy1laD  ies;t)setr(m3ou1amtn ietl(f 2umxmont4opx mo3ias s uanmp t4aexrir3tytlmt li i;t teur(m3iy4oltnmncsls)srum(  ;u4apeoio3ilt a2emu s u)teenxfciotfptr i il(  2urxr ou4olt micia( arua(mpou4oexn iciasfsDeaump t0trxnmo3tydom   nes;(0trtr(m3no1amte ieiat) rrmuroot0apxomictld mDuaums ()treomociytop r ies (0s2tmir3nudapen ivt sf Duaurp;u0olt moctyd a2rau ont0 etrxr ta1op rluvs;( s2xo(m3nodam nlfeilsfsDtmu o;t1apeomiciat s2ra( s;(4 rerxf3oadla   i i;( truoio oydamt livtlt  rrm(m nu4aexn ociasfm2ulu sn()altnmfcoodoptr uvo ( srto(r3oy4altn net sfs2ra( oou0opxo i3ilt aDelnmpnt4 reoxo3ootop  aies t0trtr(r ou1open nvil(  2tr(ro;o1aexo ociytls umuvsnu4areomoctytfp r u s s0t2xr(o no4lp  lfeia( a2urumono1tptnmfciysfmDum(vp;u)artrif3tatop  livol()t2toiopoy1ap nlnvil(farua(rpno4oleo f3tat m2rmu o;t4 eermf tatlmtr ivilt) rurirpou4ol nlivt sfs2umxr ;u0alenmieiasfs uln o () lenxf3oo1la rli slt0trtr(r3oudlmt lfes s srrmxr no1oex ioetyt s raump u4trxnxr3iadfptr ueil(  ruoxrpiy4al   net s)s2rmxroou1aeeomf3tytfs2ea(vsnt)trtnifciotfpD  u s t  2xmxm3oudllt  ieilsfsrrmu  nt4aeeoifciasls emnms;t) ltrioctydfptr uvi t0 2urxm iy4olt  fes t)a2rrx  nu0tpenmf3tlslmDra( p ()trxnmo tydfpDrlnei;t)srurio3oudamt lfvtlt  2ur(m ot1texniieiltls emn pnt)trtoxocoy1fa   i o;(0setrim3io4lmee ivtls s2um(root0aex  fctaslm2uluvont0tetnio3oy1op r u sls0 rum(r3oydapt mnvta(fs2tmumo;u0opxoiietydlm rauvs (0trxrmf3ootlpDr ivslt) rurirpny4altn fvtlt aDurur ;o0oex io3iad sDranvo;t) leoir iy1fpDe uvs (  rtr(m no4lmt lncta() rtr(  ;o4texnmfeiatlm raump t0 ltnxfciodlp elnes;(  2trio3oodomte ncslt)sruau  ot0oexomo3tasla2umuvs;(0tltnmo3iadfmt li il( t2xm(o nydam   feslt) rum(rpoo0alxnmoeiydla ulu p u4tleoxociadfmDranei t0srur(o oydop n feilt  rrr(  no0oexo octld sDua( snt)texoircoo1lmDr uei;( seum(rpoy4lle lies s  rtrumpou1tetnmieiydfmDrmuvonu4 ltomo tytop elu i (0srtmio3iudale  ictat arraxmp;u4oleoioetlslmDemnmpnt0texoircootlatelues s) etoxr3oy1ome  nvi s sruax pno1alxn ocildfs2uau s;(4 rtnxr iy1oatrluei;s0 eto(o3oo4ol e icias s2rmu ono0ole  i3iys mDra(vsn(0tetnmrciodfat lu o;t) 2tmxrpoy1lptnmfvtasf ruax ooo0tpeomfctaslm ua(msnt) exrmf3oodlpDrlneo;t0 2to(o3io4apt lnetls) 2raumpnt0olxoiiciltfm eaumo;t4alxoif oytop  lues;s srtr(r3oo1lptelncsa(fs2uru ono1opeoifeiysfa2raumo ()areoir3oy1omt lu s;s0teto(o3oo1altemicslt) rur( ooo4tet mfciat a elumpn(4tetrmf3iatlmDeai ol(0trxoxm3io4altn ivils s2rrx  ;t0ape iiciydfa uaumon(4 etomocoydla raneil(0 rtr(o io1al  lnci (fsrra( poo1tlx ioctldlmDrln pnu)aleomf oy1omDran sls)srumiopiodaltnlnesas) 2umu pot1teto i3iatlm2uaums;t)tlenxr oydfmD an i s)t2tmxo oy1lmtnmfeiat aDrmxroot1aeen feiatla2rmuvpn(4aetoxrcty1lmte nvi t0 rxr(mpou1ap nlieiatf rtaumont1aex mociytfs2emuvo t)trenmo3io1fp rau i t0 2toim3iu1ole  fct (  rtmu  ou0tlto feiyt m2ulnmon()trxrirctadlp r ies;s) exmxopio1apt  iet (fsrrrx ont1tleoiietatlmDelnvs u)aeeomr3tatlate nvs;(0 2urxm3iodalenmnet t srtmxm no0tlxn octat a umnvp;t0aetnif iytop r i s s teur(o3oy4ll elnetas s2umu ooo0tltomo3ildfmDuau s;() lxnxr3oa1oa eanvilt  ruoxr nodome  ivtlt) rua(rpot1aee io3tlt m2ua( on(4 ltrio tadomtrau olt)texmio3iy1omt lnvi t  2truroou4olxoif3ias m2rmn onu4 rxoir oadlmt  uvslt)setmim3oo1opeemfcsls  rum(rp;u0oex  fciadfaDulnvp (0tlerxo iatfpDr u olt0texoxm nodal nlfeils srumumono1aptnmfetldlm2rau o t)tlermfcto1lat lnei;( t2xrxo ny4amt lfctas) 2ra( p;o0aetn ieiltfa2ul( o;u0tleoxf todlaDrln i t)s2tr(rpiy1am elnct s)srtmurpno1aleoioeiltlaDrmu p;u4arxnmo3io1oa rlnvs s s2urxrpoydll e fctasf rta(  oo1oleomfetlsla elu s (0 exnmo iy1opDrln s s)sexr(o oo4ame lfctl(  Dtmx oou0apxomoeiys m2uaumo u4texomr iy1oaDrluei s0 eum(m3iydol nlictasfartru ooo1teeomfetlslmDran sn(0 eenxo oadlpte u i;t0tetoxo iudlmeelnviat srua(monu4tee  ietldfm el(vpn() rtnifcty1opteanes;s0 rurir iydaltnmnvsls srrauroou1aet  f3iaslmDrmuvs (4trtnxr iatop ranei;( s2urim ou4altn fctl(  Dumu ono4tee iicildfmDranvs;u0 eeoxo iotfa eanvi (0sexmxr3iodapeelfvs t)aDrau o;u1ale  feiatfs uaumo t0tleomfcoo1opDr i s (0 rxoiopnydom  mivils) Dtmumpnu4aexn fctadfs2ua( onu) exrir3ta1optrai i;t)tetmxo nodlp nlfetat  2ur( pnu4aexomocils a2uau o;u)trermocta1omDrlnvi;s0 2xo(r3nodap nlfetl(f 2taxmo;u0olxn feilsfsDraump t0 ltomf oy1oat lues s0texrxo ou1lp   nvi s arra(  ;u1apenmoeildfa em( pnu) rxniociytfaDranes ()t2xoim3ou4opeeliesa(fsrra(m ot1opeoifeiasfmDrlump t0altrxrcto1fa rauvsls tetrxm oudaptelfcsatf ruaurpnt0optnif3iytlsDulnvp;t4texnmr io1omD  nes;t0 exmxopoy4om nmfvsas) Drauronu0tlto fcildfs2rmump;u)altrmf3ta1opD aiei (  eurxm iudll nmicsat)srta(moou4oetn iciatlm ulump;t4aleoxo3iytoptelivs t)trurio ny4apt mivsl(f Dumxront1aleomfetydfm rl(vpn(0tltniociydfat  u slt0teuoxo nudom  mivslt)sDrm(rp;u4apeo f3iltfa uauvsn()treoxo3iydfa r neols0s2tr(o3nodalt  icsat s2uru oot4tex moeild mDum(msn(0trtnmr3oatopDrlieol( t2trxmpnodaptemfvs tfsrtm( pot0opx ioeias m2emnvsnt) lerxr3iydom rlu i s)trxoir oo1llt lfcia(fartrum no4ope  i3tldfaDulnvs;u0 eerxocto1lm  aiesl(0 etrimpio1apeelneilt arrmx p;o4oee  feiytfa2rlu s;t0 lxrmf3oytoatrau i s)sexoir iu4altnlnvsatfaDtrxrpnt0apxnmo3tlsla umu snu4 etrircoo1lateaies;() rur(o oodlpenmfviat  2rmumpno4aex iieilsfs elnvo;u4texoif oadfatr ieo;s0tetr(mpno1amtelfctl(fa2urxroou4oexoif3iltfsDra( s;u4tlerxo iy1lpDe n olt0s2xo(rpiu1apte fesl(f Durx  nu1oex  ociasfmDulu onu0texnmr ootlm eluvo ( seumxmpny4lm emicilsfaDua(mpou0oetoiociad mDeln s;t4tlxoifcio1la elueo t  2ur(o ou4llenlieilsfsDrrur ou4aexnmoeiltfsDeanvo;u4aetnxfctytomD lueo (0tetmim3nu4lmtelfciat srtm(root1aexomoctyd a2ulnms u0trxomocootom  lu ol(0 rxr(r3iy1om   nciltf rrrx  nu1aptnmoctadlaDeaumsn(0artrircoa1om elnes s srtoxm oydol  lfci (fsDtaxr ou4tptn f3iltla ua( o t4 rerif iydlmD  ues t) eumxr oy1lp e ncilsf 2umumpno1alt mo3tlsla2ul(mpnt4 ltrxrciodopD  ivol( teumxr iu1lpen ivsls aDtaxmo;u1olt if3tatfa rmn o;()treomr iydlmDrln o t0 etmirpiu4omtelfeias srraxmp;o4olto i3ias m2ulnvs u0artoxrcoodfptr n i () exm(o iy4amt  ncsltfa2rmxmono4altnmi3iadfm2rm(vsnu4arxoirctydla  li i ( teur(r3oydapee nct s  2rmxmoot1opxoii3tlslm2rmnmp;(0 rtoxfcoa1lat lnvslt truoxm3nu4lptemfcsat srururono1optnmietlt m2ulu o;()tlxoir3totfmtr ies s)srur(r nydllenmfci s)srtrx p;t0apto fciydfmDeluvp;()arenmf3tytfpDeli o s) 2trxr oo4ole  ncsa( srumx onu4tpx mieiaslm rmu snt) rtrmfcootla  lueol( t2ur(r iydlme lfctl()a2rauront0optn oeilsls2uanms t0treomr ootfa eliei;s) euo(m nudop n ieias a2trxr oo1aptomocilslm rm(mon(4 rxomr ta1fa r u s;t)t2uoio no1ape lnesa() 2taxrp;o0oexomiciysls raumo t4aexnifcto1oatrlnvs;t)t2trxo3ou4lm n ivtas a2tr(  ;o1alxnmfctasls ulnvo ()trtoxo to1la   neo t trtmiopoy1am n icilsfarrrumpot0aptnii3iad m eau s (4treoxrcto1fpDe ivolt) etoim iu1olenlivsltfartmx pot0oexnio3tydlmDel( s t0 reoxociydoa eau o;s0setoirpiydapt lfcilsfarur(mo;t1apxnio3tat m2emu o ()tlxnmf3oytoatr ieo ( trurxmpoydom elfeta() 2ur(ront4oeto ietlslm elumo t0tlxomo3oa1opDrau ol( t2urim3nu1lltn nvtl()srur(rooo1aex mi3tyd s2eanmsn(4 eeoio oy1lat auvo;(0 2tmxopoy4amt mnvtl()srtr( ont1tetn ieiydfm2ulnms;u)aetnir tatop  aiesl( setoir ny4al nmici ()a2tm(rpoo0apeoifetltfmDeaums u) ltoifctydfmDeanes t0trumiopou1oltnlfei tf 2uau  ;t1tet ioetyslm2ranvpn(4 exrxfcoydoptelieols  exrio nu1lmt  fei (f rurxmono0tet  feiyslm em( ont4 eeoir3oatomDranvilt)srxoiopnu1ale lneil(fsDtr(r no0tptnmocildfm umn s;()arenxfciy1lat liei;s s2umirpny4ope lieilt) ruru  ou4apt  oeiytfmDranmo t0aeerxrcoy1fm rai olt0 rtr(r nodllenmfet (fsrtau pno0aetnifctys m rl(mo t)tlxnxo ootfaD li i s) ruoiopnodaleelfvtl(faDrr( oou0tpxomf3iadfs2ua(ms t0teerif ty1faDr n o;(  2umio oodllee nvtl()aDrmxm ;t0oee moeiyt a ran s;u) etnmo3ia1laDelueo;t) exoxm3ou1olee ivtas) 2urumonu4aetnmf3tldfs ean p u4trenxrcoytlp elnvs;(  etoxm3nudlltn icsls) 2ra(  nu1tptoif3tltlmDumn p u4altoxf iydlp eaueo ()s2tr(o3no4ole mnei sfsDumu  ;o4tpxnmictas s2eau o (0areoio3totoa e i s;() rtoxo io1ol   ici s srumxmo;o4tleo f3tatlm eanmo ()texniocoydoaDeau s s  rtmir3oudlmee ivsas sDurxm nu0apxoiieiys s rmuvp;t) exrif iydlmDeanvs s)t2xrimpoodapee ict sfa2tm(monu4opxnii3tld a2ra(mo u4trtnxo3totom  lieo;s)srxrxr iodape micsl(fartr(m ;t0oeto oeiyd a ul(mpn(4 etoircty1fmtelnvsl( trxoxr3nudapt  fct t)aDtrum ;t1oetniictydfm elump t0 rtomo3to1om   u s ()trxoxo iu1ap   fvs tf 2uaxmpoo0tlxo ieiadlaDemn p;t4 eenmo oodomtelues;s0 exoxrpoodam elieta(  2uau  ot4aeeomoctatfa2eaump;u4 exrmf oadfmDeauvs;s) ruo(r3ou1aptn nvilt)s2ur(m ;t0opt mieiltlmDuauvo;t)texnmfcoydfaDr i ol() rurxrpnu4alte ivsat s2rrxm ot4apenmfetld s2elnmonu) lxrmf oadfp r uesl(0teur(o3no1al e fesa() 2ua(m ot4tpe  ictad m2ua( s t0 exoiocoodfmteanes ()sexm(o nu4lmenlfviltfsDrm( p;t4tptn o3tasfa2ul(mpn(0 lxnxf3oytlat anvi s) rurxm3oodop   feta( aDtmxroou0optn ociatla ra( o;()teenir oydfmDe nvs;s) rto(o no4lmtemiesl(fs2rru onu1altn fciltla2ul( s t)aexnxo3iatla eluei;t) rumxm no4optn ncsl()aDumum ;t1tltnii3iltlsDumnvp;t)texomfcoa1fmDrlu ols) rxoxm3nu1omt mfvt tf 2urx  nt4aeenmo3taslm ra( p () ltrmrcootfp elu s;(  etrir nydop nlnvt sfsDrrxrpnt0tlen i3iat m emnvpnt0artnxo3tatoaDelues;s0setrxo iy4ap  mnes ( sDtmxr ou1olxo ociasls el( p;u)tetomocta1fmt anvils) exo(m3iy4aptelfei s s2rmxmoou0oex  fciyt a ua(vonu4 ltnxfcoytfmtran i (0truo(m oo1amtelicta( a2umx  oo4teenmfeiadfs2rmums;u0 eenifcia1latr ueil()trxmio ny4ape mneiat srurxroot0apen ictlsla2eauvont4teenmf oydoptranvs;t tetoxrpnodllenmnvs sfaDtm(mono0tlenif3iytfs2elnvon(0 etrxfcoydom rlies t setrirpiydlltnlfctltfa2trx pou1tpxomo3iydfaDrmu ont0tlerxr3to1omDrlu slt) 2urio io1olenmnvilt arta(mp;t1aexniieiyt m ranvp () lermr3oo1omD  ivs;s) etr(m nydamenlncsa(f 2rmur ou4tpe io3iyslmDrm(mp t0 ltoirciotop  livi (0 2xm(o3no1oleelicsl()srrmxmp;t1tlt  ocildfs2em(mp (4 rtnxr3to1lpDrlnvil(0 2urio ny1al n nvs t s2rm(rp;t4oex  fcilsls2umu s (0trxnir oodlaD aueil(0 etrxmpiu4op  lncilt)sDtr(m ;o4tlx ifeiasfs2emnms;t4alxoif tytlpDrlieo ( sexmiopoo1lpe micsat s2um(rp;u0olxnmoctadfm uau s t4 exomf3iotfmt  ueo t0t2xm(opoy4opeemiciat) Duru oou4opxo ocias sDrlnmo t)aeenxo ta1omDeaieo;t0seur(m3nydop elfciat)s2tmu o;u0tltomf3tat a eaums u0teerif ty1lpDraieslt  2toxm3iy4ape mnvilt)sDrau  nu1opxoif3iasfs2elnmo (0 rxnxr3oo1lat lieilt srur(m3iu4aptnmnvt s) Dra(m oo4alx  ictydlm eluvs;u4arxomfcty1fmtr uvs;s  2umxopiy4olenlfci t)a2tau ont0apeoiocilt aDum( o;u4trtnxf iadopteaneo;(0 rum(r3oo4ameelfvtl()sDurxr no4aleoifciltls rm( ont0texrxr io1lat  ueol( srxmxopou4lle lfvt s sruaxr ot0ale  feiadlm emuvs;()trxnmo3iatop  an ols0s2umxr oo1lptemics sf rrmxm nt1tlxnmi3iyslm raump (4arerxfcoydopte uvs;t0seuoxr oy1lltnmnes sf Dra( oot4tlto octydfs elnmonu) rxnxo ootlm r neo;s trtm(r3io4lm elfeilsf 2umxm oo1oexoiieiat sDelnmpn(0 lermo oydop  lues t)texo(rpiy4ome  fcilt) 2tmu  ;o0texnio3tasla2ulu p;(0arerxf3oa1lp rluvs;(0seuo(mpno1lptelfesat aDrmur nu0tpe  oetltfa2umumo;t)trxrio3todomDraivil(0sexoim3io1lpt  ivt ( sDuaxm ;t1apeo feiys mDrm(vsn(0tetomr oatoa eauvi t0s2ur(mpoo4llee fci t)arumx  ;o4alen oeiltls ea(vo t4 lxoxo oa1lateliei s0 rtmimpnydlpee fvsat a2uax  nt1alto ociltfaDuanmo u)altrmocto1fm rauvs;(0 eumio no4am nmieiasfaDurump;u0oltn f3ias mDua(vs u4 eenxf3ootomt livo;s0trxo(m3nu1altnmfesa()a2rrxro;u0oetomi3iatfa rl(vpnu0 etoio3todlaD ai s;t)s2trir nydal   ncsl()a2uaxmooo1opto iciysls eln p () exriociadoatrau i;t0 exrxo oudlpt  nctltfartmuro;t1aex iietyslaDumn on() etrmo3iydfa e u s t)t2tmxr ny1lptn icsa( a2rmxr ot1optomf3iydlm rmuvo ()tltnir iytoat aues;s t2xo(opiu1al  mietas)s2ur(rp;t4apt  o3tas a rln o u)alxoir3ta1lpte ieo t0s2toio3iydaltnlfvils) rtmxro;u4aeto octys m umnmo;(0aexoioctatlatrln sls t2ur(r3nodlp elnvsl(farrmu  ;u4opxomieiysfm2rau s (4tetoxrcoodlaDraneils0srxrirpoodape lictlt  2tm(mp;o4texn oeiyt m2rlu pnt4 etoxr iadopDrau s;(  rtoxr3oydoltnlivslsfsDrm( poo0teenmf3iasfs umnvo (0tltrir3oodfaDelnes s)sexoxopiu4openlncslsf rrrur nu1apxoifcils s uaums u0 rxrircoytoa e ueo t0srxrirpoo4ll nlfvsas aDtmu ooo1olto octlsla ra(ms;u)treriocoa1faDr ueilt0 2xo(mpoo1ll emivsa(  rrrur ;u1apt  ociydlm2ulu o u)teenirciy1laDr neils t2uo(opoo1omtnlneslt)s2umumonu0tleoiieiys sDemuvs (4 rerifcta1om r nes;t teto(mpio1omt lnct (  Dtrxroou4aleniieiad aDua(mpnu4aetomr3iatlptrli i ( s2umxopno1llee nciltf rtm(moou0tpenio3iatfaDuaumonu4alenmo3tydlmD  nvi (0 etrio3ou1om  lneiatfsDrrurono4altnmf3tat mDean onu)alenir oodlpDrlu olt0s2xm(m iydlpe mneils a2ta( p;t1oee  oetyslmDuan ont0trenmrctydlaDe neo;s) rtm(r3oodame mnet sf Draumpnu0apt ioetls s rmnvs ()aetnmr oy1omDeanvo;t trtr(m oo4olenlfctat)a2tmum ;t1tltoii3tadlm2rm( on()aexrmo iotfa r i s s teumxmpnu4optn ivt ( s2tmxm nu0aptoiociasfmDum(mon() exoxf3oatomDelueslt s2trxopiu1aptelicia(fartmumpnu4ale ii3ias sDrlnvsn(4teerif tydopDe i o;t) rumxr3oodop nmnct sfa2taur ;u1olxn oeiadfaDelnvon()tlenir3iotlmDelieo s) 2uoim3nu4amte nvi t)sruaumono4apeomo3ias s2ranvon(4 reoif3tydlmDranei;t0 rtm(o3ny1omtemnei (farrau  ou4aleo ieiatla uau o u4trtrxf ootom raneo t)srxmxm iu1om   ivi t a2trurp;o4ape mfctas m rlu s;u4aetoxocoadlpDe n i;(  rxrxrpou1lltnmfvi ( a2rruro;o0altomieiytlaDum(monu0tltnxf3todoate nvi (0teum(m3nu1optnliesa(faDrmu  ;o0aee  o3iytlaDeluvo;t4texoxf3tydlpDeanei t tetrir3oy4lpeemfetltf rra(rooo0tpxomf3iltfs2ul(mp t) etnifciy1fmtelnvsl( s2xrir nydlle livsa(f 2tr(  ;u1aeenmfeilt m2rlnvp (0aexnxoctotfptrai i;(0 rxoimpiudllenmietls sDum(rpou4optnmoctyslm2emn s u4 eeomo3oodfaD  nes;t)t2xoxrpoo1lp elfei ( srtau ont0oexnmiciadfs rl(mp;u)altoiocto1lptr ies;s)trto(m io1lltelnes tf 2rrx o;u0oex micildfa ulnmp u)altoif3ta1lp   n s;(0 2trir oo1lp nlnvslt srrmu ono4openmicilsfs ea( p;() rxomf3iy1fmte ivi;t  exm(r3iudap nlfvsls srumu ont4oltomo3tadfaDelump;() exrxf3iydfp e nvs;s trumxmpnodll e ieiasf 2um(mpoo1tle mi3ilslsDrmuvsnt4 lxrmo oydfpteluvilt  2xmim3ou4lp nmivi t)s2tr(rpnu0teeoif3ildfmDel(vsnu)altrmoctodopDrlivo ( tetoxo oy4om nlfetat)arrm( o;o0tee  ociytlm2rmn o t4 exnmo tytoptr uesls t2urim oodol e icta() rrm(mpot4alt iieiatlaDumn s t4texomrcta1lm   i i s0tetmim iu1opte iciatfs2rm(mpot1oex  i3tldfsDrmuvo t4 ltrmr3ty1lm eln sl( trumxr3iy1op n ieias artrxm ou1aptnmfeiatlm umuvsn()alxnioctodfa ranvs;s)teumim3oy1llenlnvi s)arumx ont0apxnifctlt a2rlu s;u)aetnmo3oodom   n slt0 exmxmpiu1lp emnvsltfaDuau  ;u1apx ifciadfm ua(vp (0arenxr iadlaDean s s)trxrxm no1apee neia()arta(r ;o0aexn fciatla elump;u4arenioctadfp r ieils0sexoio3nodlm   fviasfsrtr( ont4oee  icilsfs ra(vo;u0alxnmo ta1fmDeaivolt trumiopoydapt mfcslt  Drm(ront4ape if3iltlmDrlu o u0aeeoifcoo1fmDrau s;t)trurimpoy4olte neias)sDumurpnu0tlen o3tytlsDua(vo u)aetoxfcoydlmt auvols  rtm(m ny1al nlfcil(fsDrr(  oo4olxo fetasls2rlu p;t)alermr iatlp  au ils tetoimpiudalen ieilt arum(mo;t4olt  o3ild mDulnvo;()aeenxr3iodfat li olt s2tr(m3nodlptnmfesls aDtr(rp;o1opxomociytfm um(vp;()aetnmrctodfm   i il( t2xmio nudoltnlneias sruaumoou1oexomf3iys a2ua(mp (0 eeoxr iadfpte ivs t0 rxriopiodlpenmnvil(  2um(r no4tet mi3iyt sDemnvs ()tetriociotom   uvi s0seur(mpoodamt liei s a2ta(ro;o0aeto fctldlsDeaums (4aleomo3iytom eauei ()trtrxopiudaleelicslsfa2taxm nu0oex ioeiat sDran p t)arxoxo3oytom r uvo s)t2uo(m iy4amt  nvtas) 2ra(m no0apen f3iydfm eanvo (0 lenmo ootoat livsl() 2xoxm3nu4lptelfvt tfartruroou1aeenifetlt mDumnvo u0trtrio3ta1fmDe u ols teumxm oydlptnlnvsasf rrm(mp;t4aetnmietys a2ean s (0artrmrcia1lp eluvols0 2trir oo1olenmnvtlsf 2tr(m nu0alt io3tyt a rluvs;u4aleoxr to1omt lueo t0trtoxm3oudalee ivta( arurxr ou1tlen ociysls2ean p t0 rxrio3totopDe u ol(0s2urir oodal nlnvtlt) rurx o;u0openmo3tys s umnmp;t0trtrio iy1lp  anes s) exoir oo4am   ieiltfs2rrxr ;u4alxnio3iadls rmnmp (4 rxoir3iotom   nvs;() rxmim3oo1omtnlfvsl(farur( onu1teeomicilsfsDranvs;t)treoircty1lm  anes;s srtoir3iy1opeemncils) 2rrxmono0openioeiltfa2emnms (0aexnif totomtraies s0t2toiopoydaptn fvs (  Drr(ront0tex mieiatlm el( o u0trxoxr ia1faD  i ilt) ruoxm3oo4aptnlnvtas  ruaxro;o1apt  oeiyd a rm( p t0 exoifciy1fa rlivi (0tetrxr3nudope mfvi s)sDtaxmo;t4tee  iciysfmDrl( s;(4tltomfciytfaDeli ilt0truoxrpiodopen nct sf rtaurpno0tleoio3ildlsDuanmpnt) ltnio oodfm   uvi t  2urxr oydamtn nesatfs2urxr ;t1opxnio3iyt a rln s;t) rxoiociy1om   i i t  rtrxo3nudlltelnei sfa2trxmooo1aptoio3ild m rluvs;(4 reoir3iatlaD  ies ( srxmir3ny4alee nvilsfs2uaxmpnu0apxomfeiytlsDel(vpnt4 lxnmrctydfm   u s s)s2xo(r iy1open ncsa()s2rru pno4olxniiciys sDea(vo;u4trenxo iodop ean s t0 rtmim3nudlm elieia() Drr(mpoo4olen i3iatfm2emums u0trxnxoctatlpDe nvs s0seuo(r3oo1lmeemnesl()artmu  ot4tlxoif3ilslsDrm( p (4arenmf3to1lpD  nvol() eurxm3ny4aptnliei ( aDtr(rpou1tptoiicildfs rlnms (0 rxomo3totfatranvilt0setrxr ny4ap  mfvsasfs2tmxro;u1ole iictldlaDumumo;u)arerirciodfp rlneslt) exo(o3no1alee fvsas  rtmx pnt0oee  i3iasls2umnvp t0 eeomo tatfm eanvi t0s2xoio3oodop nmfvtl()sDurxmooo1apenifeils m uln p;t0alxnif3ty1omDelivs t0 euoir3iy1op nlietltfa2tax pnu1aetnmi3iytlsDuau o () rtrxr ia1lm r i o s)t2xoim iudalen fesat) rur(ront4tlx mfciltlm ra(mo;u4arerxr tytoaDr neolt0t2xrim3oo4om   fcs ()srrax  oo4opxomiciysfm2em( s ()teenxf ta1la rln o;( tetr(r3nu4lltelfvs sf rtmx oou1oexoio3ilslm eluvs;t)aeermrcoodlmt lieo;( trxm(m nodame mnvtls  Dra(r ;u1aleomo3iys mDrl(msnu0 rtnirciydla raivo;t0trxrxopou1lme  ieiatfs2uaxrp;u1oex ifeiadla2ul(vs ()trtoif3oatoa   ueslt0teuoxr3io1ope lnetlsf rtaumo;o1tle  o3ils sDrm(vp ()texoif3to1fateaues;s) exmir3nu1am nlivtat)sDra(mp;o1aee  ocildlm rlump;t0alerif oa1omDe nvo;s)trumxmpnudaptnmfci ( sDuaxrpoo1aexnmfcild s um(mpnu)areomf3oadoptr ieo t srxo(r3nodll  micsa()artr(root4tlx  o3iytlm2umu o u4aetoio oydlp   ieo t)trur(rpoo1altnmfei tfsrurxro;u4tlxoifciadfsDrlu snt0alxrxr ootom  livi (  ruo(o ny4ole  ici sfsDra(mpoo1olxomfetysfs2elumpnt0teeriocoatla   n ils0t2ur(o3ny4alt mnvsat)sDrm(ronu0tpx  ietld s emums u4texoxocootfpDe nvs;s0 exr(rpio1lm n feilt aDuax o;u4tle io3tas s2ran s;u4 lxnio3totlpDr nvsl(0 2tmxr3oudll   fet s aDurx o;t1opxnifciasfs eauvp t4texoif ia1fp   ivs t0sexmxm3nu4ome mneia()s2rax poo0tlt  iciadlm2rl( o;u0arxoif iatoatrauvslt sexmxr3no4apeemfeslt) rrrx  ;t4openmo3tad sDel( pnu0artnxociotfatrai il(0truoim iy1amtn nciltf 2uax o;t1tet iocilsfsDeluvp;u4tlxnmr3oodla raneils)srumim3oo1ale  nctas s2raum no0oltomfeiadfmDeanmo;t0tltrio3iytfm   ueols teumxopiudll e fvi s  Dtm(rp;o4altn feiytls2uaumsn(0trenmo3tatfmDrlivs;s0t2xmxr3ou1ol nlfetatfa2ta( ooo4tpenmfctytfs eaums;t4aetnmo3oodop elieo;s)t2xrxrpou1om emfvilt  Dtrurpoo4oee if3iyd a2rln o t)teenif ia1fatean i (0s2toir iy1apee ncslsfarumum ou0aex mo3ilsfsDrln o (0trxnmo3todomt lies t)t2xoiopno1olt  ictatfsrrmurooo0tlxomi3iytfa elu on(0texoif3iytoatelieils)srxriopiu1aptn nesltf 2trur ;t0teeo i3iys a2rauvp (0 etrmociadoat  neslt0seurxm io4lpee ivtlt  Drrurpnt1alxomo3iasfmDumu s u4tltrifctadlaD li sl()s2xmxm3oo4alte feiat)srrrx  ;o4ole mfeilt sDrl(vp;()trerxr iydoa  an ilt0seto(m3no4lpe  nes t)srtau  nu4optnmieiatfs2raump t)trtrxo iotoat  ivo s)setm(m oo4ale lfesasf Drrurpnu0oex iiciydfa2rmnvo u)artrxrcootlp eln i;s) 2umirpoudal n neilt aDta( pnu1aleoiictls s rl( o;u) exrifctotfate iesls srtm(r ou1llen nci t s2trx  ;u1tpxnio3iatla2uau p u4artoxfciodoa rli o t0t2xo(r no1lpt lncilsfsDtax ono4oetnifeiys sDelnmo t4tlxrir3iotlp rli s;t)tetrxrpoydoleemnei (fsrrmurpnu0opeoio3tltls2rl(mo;(4alxrircoy1oat  ivs;t0 rumim3no4apte iesl()srrr(monu4aeen fcild aDem(mo;t0 lxrif3ta1op r ivo;() 2xmio3ny4openlfeta()arrmxm no0oee moeiyslm2rmnvo (0 rtomocoydlaD  nei t  2umimpou1ol  mnvtl()aDrrurp;u0tlxo octytlmDran p u4aleoxo iadfp elu i s trtmxr3no4altemnvtas srtaxronu1tpxo fciad sDuanvo;t)alxnmfcta1fpDelneo s0 2tr(opou1am n ictas) rtaurp;t1alx  f3tatfa emnmo (0 etrio3iadla  anvolt s2toirpno4alt  fcsatf 2rr(m ;t1tetnmoeiadfaDrmnms;u) lxnxf3oy1oa   uvilt0seumio no4opt mfcias srur(rono4ole mfeiadfmDeanmsn(0 ltomr oo1oa eli s;s0 rxmiopoudolt mfvi s aDtmx pno0aexn i3iltfmDuluvpnu0aeeriociadop   u olt)trxrxrpoy4oleemici (fs2taxmo;o0oeen iciltfs rln s;t)alxomfctotomtr uvsl(  2tr(o3nodlpee ncsls srtmxm nt4apeomf3tys a2rau pnt4aleomo3oa1fatrln s t0srtmir3iy1lle  fcia()a2umxmont1ope ii3iat mDel(ms;t0tetnmr iydlatraneo;(0trxm(mpiu1omeemnet ()sDur( oot4oexomi3iydlmDrauvs;t) reomr3iytlp eliei;s)teur(m no4oltn ncs t  rtr(ro;o1optoio3iadfa2el(von() leomrciodlaDe nes;()t2ur(o ou1al nlietl(faDtrump;t0tltnii3tls a el( o u4altrxf3tydfmte i o;s)trtoxr3oy4lpt  fvt (  rtaxr ot0optn f3iyd a2ran p t)teenmo3iytoatr ivs;s  eto(o oudopenmnci t a2ra(ro;u4oex  feiadlaDuauvp;t4 eeoxf3io1lmDrlivi ( s2ur(mpoo4amtemnesa( sDtmx  nt1apxnmo3ildfm2em(mo;u4arxomr3ootlaDrluvils) exrxr oy1ll  mnes s  Dum(rooo4ole  iciydfmDul(mpn() ltoiociotlatrluei s)s2umxo3nodlmt mfetls)s2rmxrooo4tetoifciatfm2emu s (0 eenif io1fmt  i o;()setoio3ny1ame mfvia(f 2rmx pnt1opt mfeiat m2umuvpnt4tlenmr3ootopDeau o s sexr(opoydam nmicia()artmur oo0oeeomfctatfmDeanvp u0 etrxfcoydlm r uvi ()setoxopnudop emnvil(fa2tau ooo0aptomociys m rluvp u0aexnxociy1op  aiei;s)srtr(rpiydap  livt (  rur(r ;o0tlenif3tyt s rm(vs;()areoxfcio1om r neolt0srxrirpno4apt  nvsat)arrmxmpno0aptnmictadfaDranms u0tlxoio iy1fmD livols0t2tm(m iu1aleelictltfartrumoot1alx  f3iytlsDem( ont0 lxnmrcoa1omteaiei () etrxr3iudopeemicta( aruaumono1ape mieiad mDemuvo (4tlxrmo3oy1fpt aiesl( srtr(r3io4opt lfeslsfsDrr(mo;t1oee iietytlm em(vo (0 lxoxr3oa1fmte i o t)trxm(opiy4oleemnes sfa2uaxmpno1alxn i3tydlmDumu p;()texomfcoydlaDraivs ()trtoxopoy1lme  nei t)sDrau o;u0oee iieiadls ra(vp u)aeenxo3oytfpDelnvil(0 rur(r nydal   ieiltfs2ur(  nt0altnmfciatlsDum(monu0aexoif oa1lm ranvi;s  rxoxm no1ap  lncilt aDrm(monu0apxomietld sDrmnmp;t4texrmo3tadlmt  nei ()trtmirpnu1om  lfet sfsrumxm no1tetn o3ilt a elu s (4arenxf3tadfm  auvi (0 etoxr oy4omtnliciltf Dum(ro;o1optn feild s2elumo t4 etrxfcto1om  aues;t) eumim oy4lleemivt t  2umxrooo4oex  o3tytfs ulnmo;(0teenmf3ta1lmtrlueil( trtmxm3ou4lmtemfct t)srraur ;t4altoii3tltlsDrm(vs u)aexnmrcoatlmDrluvo;s  2toxo io4ameelfcsa(farum(  ;o4apeomietldfaDuanmon() rtnmr iydoat ai o;t srumirpoudlle mfes ( sDumump;t0oleo o3ils m rm( p t) eerir3ta1lmDeluvs s  2tmim3nu1ole  iesls) Drmx p;o4altn i3iltls2uan s (0 lxoxf3oydlmDeaivsls0texmio3nydom  lncta(f Dtmu  ;t4tlxnmoeiltfmDrluvo;()arerxrciytfaDrau i ( s2urir ny1omen iei s)a2rmumonu4apx  o3iltfm ua(mo;u4alxrir oodfmD livi ( s2toxr3oodom emnvsas a2trxmpnt4aeto f3iytlaDumnvp t0 rxrxr tydlpDraivo t0 2tm(rpiy1alee ncils)aDtrxm oo4ale moetls a umump;t4tltnxf3io1om eli i;(0srxrio iy4alt miei s)s2rau  ;o4aeeomfetyt m2ul(msnt4tetnmf3oy1omt anesls0trxmxr nodoptnmivia(fa2rmu oou4tee  o3iydfa2emnmp;u) eerirciadfaDeanvi;s)s2xmxmpnu1amenlfctls  Drr(ronu0tlenmieiltls rlums t4trtnmf3oadlp   n s;(0sexo(m3iy4lleelfvslt)s2trx ooo1tptoioeiytlsDumnms t0 rtoxo3iadfptran il()sexmirpny4omeelieils srurx pnu0tpxomictatfm2uau p t4 etrif3tadfat lu i;t0tetmxr3ou1lm nlncsl()sDum(rp;t1aee mf3iadlsDranvp t)alxoir3iydfm  au ils)s2umxr3oo4opt mfvt s  Dtmurpno0tlt  ictat mDua(vp;() rxrxfctatfa ranvo;t)trumimpnudlpt mnesa( srrau  oo4apx mo3iyd aDrm(vpn(4treomfcoydlp eai s t)srtrirpnodlp emneiltf 2uaxmo;u4aee  i3iat m2rl(mp;t) etnmr todoateanvil(0 exo(o ny4altnmiesltfsrtaum no0tlxnmiciltfa ua( on(4trxrmo3iotopD livo (0 exo(rpny4ameemfeilt  Dum(rpou0oltomfctyslsDua( p;t4 rtoxfcto1lpDeluei;s  exr(o3nu4ol n nct ( sDrmx oou4olt mi3iad aDuau p;u4 rtnxfcoatfpt anvi t)srurxr nydlleemfesl(  2tmumonu1oexniiciytfa2um( p;t4arxoxr3iydlp r i s t  rtoir iodoltnlfei t arrm(mpou0texomfeiydfaDrm(vp;(4 rerio3iatfmD  i o;t seumiopou1om   ict tfarur(rpno0opt  iciyd aDean o t0 lenif ty1opDe n i;t)trxr(m oudaptn ncslsfa2tm(  ou4oeeo f3tls m ra(vo;u4aleomrcoytfaD lnvi s0texm(r3oo1lp n feiatfsDrrx pou4olxomoeiys m rm(mpn(0 lenxr iadfp  aneo t)s2um(m iu1al n fct tf 2tmur oo1tlenmi3ias s ulump;(4altoircia1fmteluvi;t0srxmxm iydllt lfvtl(fsrumumoot0ape  feildlaDuln s u4 ltrif3ia1laDraneilt  2tmim iu1llen fetasfarrauronu4tptoif3iysla2um( onu0artnifcoa1op eaueo ()seumxmpnudal emncsls  2trxmpot1texo iciytfa el(vs t)alxnmo io1fmte ivo;s)seumxopoydomt mfcs t aDtmxroou4olen oetytfs umu pnt) etnio3oy1latrln s;s0trxmxm3io1lmte ivsa( s2uru o;o4altnifeiad a2eanvsn(4arxrxf tatlpD lnvil(0tetr(mpiy1lmenlnvtl(fsrtm(  no4alenio3tat m rlnvsn(4 lxnxr3ty1fmDr uvs;s0 2trxopiu4lpte fvta(fsDtaurpot1tee  fctltfmDraump u4texoir3oo1fmDelnvil(0 etmxm iy1ol  mneiasfaDuax p;t0ale  oeiyslaDrauvs (4trerxf3iadfm   neslt) rxmirpiodal n iciatfa2rrumo;u0tlxniietld sDrlnvont)tltoif tydlmt lueo;(0 2xo(opoo4om  micia()s2ua(r ;t4tpe  f3tys mDulu s u0trxrif iytfa rlies t)s2xrim3no4ol   ietltfsDraxrpoo0ope iociadlsDua(vont4 rxrxrcia1fm rliei t  2xoirpno1optnmivslt) rtax poo1aetomo3ils m em(vp;t0trtoifcoa1laD  n s s0 rto(opnudamt mivt (  2trurpnu4alto ietytfmDrl(vp (0teerxr3tadlmD aivo (  2um(rpoudape mivt s)s2umx p;o1tpxn ietys a rmuvs;t4tlenmo3ia1fatrlu o;s  exo(o iydol e nci t a2rrxr oo4texo fctlsfm2el( pnt0texoir iatfmt  nvo;s  2tmir3nydlp  lictl( aDrmu oot0ope mociatfa rl(mp;u)tlermr3iydlp eaieo;t0 exrxo3oudlm emfcias aDuau  ;o0oetn oeilslaDrmnvs;u4 eeoir3ty1fm r ieo;( teurio nu1ll n iesa( s2rm(moot0opt io3iyslm emuvo;(0 lenmf3iadoa elneo t)texoxrpoudlp e fcsls artaxmp;t1aleoioetadlmDuaums;t0 etoxf tytlm   u s t)trtmxr3oy4am nmnct sf 2ra(r oo1apxnmieilsfs2el(vs t0texrxo3iydomDeanes s0seuoim oydlpeelnei s)a2rm(r ot4aexn f3iytfs eauvs;u)aleoifcoa1lmtranvils s2xm(m3iodlltemncil()aDrax pou4texn ictat m2rl(msn()tetnio3iytlpDrlu i;() euoxm iy1lltn ictat) 2taum ;u0apt ifeildfs eln pn(4tlerxr3oatfp eaiei;() 2umxopio1ale lics tf 2umum ot0alx iiciyslmDuluvo;t4tetoir3oo1lptrluvo t0trurimpiy1ol nlfvi t)srrmuro;t0olx ioetls m um( ont0artnir iadom eaivi t)s2trir nodap  lneta(  rrmu ooo4apxn ieiltlm2elu p;(0tltrmo3tydomD  n s t t2xmir nydaptnmnvta( sDtrumpnu4oetomiciltla el( pnu)texomo iy1om  lu s s sruo(o3nydamtemnvsat  2rmumont4texnif3iydfa ra(vsnu)trxrmf3oadfm rlieol()s2umxr3io1lmte nes t s2umu pnu0opto fetltla2umnvpnu)tetrxoctydla   u i;t teto(m oo4lpte iciatfaDumx p;o0tee  ieiaslsDrlnmp u4arermo ta1laDeaueslt) euoxo3oo4omeemncsasfs2tmxrpou0oet ii3tls m2rln s u) rermr3io1oat au il( t2xmxr iy1ll  mnvsatfaDrr(  ot1tpen o3ild s rln p ()alxnxr oodlaDeaivs t s2xmim3io4llee ivil()aDumxmpoo0apxn ociad mDeaums;()tetnir iotoatr ivilt t2tm(o io4al  lncias)a2rm(  oo0tlen ociyd m ra(ms u)aeerifcio1latean ol(  etmim oo1lp e net t sDurx ooo0aeen f3ias s uanvsn() etrmfcootfm ranei;s) 2umim oy1opeelneia(f rumx o;o0oeenmo3tldfsDrlnvs (4texrmf tatoatran i;s0trtr(m3oo1lp  lnctlt aDur(moot1alenif3ild m2elu s t)altrmr ta1lpt lieo t0seuoiopoydlpe micsl() rrmxr ou4altnii3tltfa uauvp () eenmr oadlm ean s;s)s2trxopnu4ol  licia() Duauro;t1oet mictydlmDul(vp t0arenxrcoy1oa r neol(0 rurirpoy1ap nmicilsfs2trum oo1aleomoctas a2rl( pnu0trtnmr oadomDrauvs t0s2toim3nu4om n icta()sDrru ooo4openmociyt sDum(mp;()texrxr iatlate ivs;t) exrxrpnu1ll e neil(faDrm(m ;o4ale mietyd sDemnmp;t4tltnmociadlp raies s) rxm(r iodlp emfcslt  Dtax pnt4opxn f3iysfa2ranvo;u) ltriocootoat aivs s sruoxmpnu1olt  ivtlt)sDta(r nu4tpt  ocildfs emuvp;u0aetnifcoadomDraneo;t s2uo(mpnydoltnmivtls sDrmxr ;t4tlx  f3tltls2elnms u0 reoircia1om rlu o s  eurxopoydlpenmncils)artrx pnt1tptnmf3tydfsDrluvo;(0 etnxoctatlpt ln o;t0teuoio3ou4lp elfet s  rua(mont4apeo ieiatls2ea(mp;t)tetoiocootla rai i t  2trxm3ou1al emfciat artm(mp;t1tpt iiciad s elumsnt0teeoiocoatop elnvsls)teuoir3ny4opeelfesl(  rta(r ;o1alx  ietytfm rlu o;(0 lxoio iytlat an o;s0s2uoio3io1amtemfviat  rra(rono1aet  f3iat a rmu ont4alxnxo3oytfm  li i t0 2urim3io1lleelictlt)arrrxrp;o4alx mo3tyd a rlnvpn()tlxnxr3iodlaDeanvi t0setr(m3nodopte feilt)srumx ono4oetn ietlslaDumu p;(4altomrciadfm  lu s;t)trxoxm3oydopenmnct tfa2taurp;t0apx  icilt sDra( o;(4aeerioctytlpDrli sls) 2xr(opoodlmenlfesl(fsDrru  ;t1oexnmf3ild sDrm(mo;t) etoif to1fm  anei s) 2xr(r3iy1amenlfci sfsDtmx p;u0tpeoio3iydlmDrlnvp;() ltnif3iadom rlueil(0 2tmxr ny4om nlfcil( srurumonu4apt mo3ilsfs2rmuvp t) eeoif3iotfp  li s;t teum(r iodam nmfctls  2urx oot1tleo ociyd m ra(vo;(0 ltrif tadlp  liesls) etoxopoo4aleelncslt) Dtrxmpot0alx ii3ilt aDumu sn(0 reomo3oadfpDr ivo;t0texo(mpnudamenmfvi t) rtaur nt1aex moctas s2ul(mpn() eerxocoodlmD  i ols0 rumiopiu4apen feslt)sDrru  nt1tlx mocild aDrm(vp;(0tlxoxrciodla   n o;s)setoio nydal n net tf rraur ou4tltn fciydla rluvo (0aeerio3tatomDraueslt  2toim3iydol emivsls)srrmx pot4apx  f3ilslm rlumonu)aexomf3iytoate i ils)s2umim3oydam elfciat sDtmuroot1alt  feiasfsDulu s;(0 rxoir3tydomDrlivilt0truo(m3oodal n fci ( s2tmu p;t0opxomoctas a rlnvp u) renmo oo1fp  auvi t0setmxm3nu4amtn nvs (  rumump;o0opxn fctldlaDuluvon(0trtrmocia1laDe i s;t0 2tr(mpiy1ale  nesl()s2tmu  oo1tpenmfeias sDra( o t0trenmr tatomte nvi t)setrxr3nodamenmfei t sDtmu  ;u4oetoioeiatfm2elnvo ()aetnmr3tadla raneolt tetrim3oo1oleelfeia(fsDuru  oo0aeenifeias mDumnvp;()artnmo tadoa r n i s0texmiopny4lp nlncsls aDur(  ;o1aee  feiysfa2eanvp;()arxnxoctytfpD ai s t0setriopiu4omtelncs ( sDrmu ooo1ale mi3tltfmDrlnvsnt0 renxf3ia1laD  ieo t  rumxm3iu1amenlfct t)sDtrum oo0aeeniieilslm uan o;(0arermoctotlm rau s s s2um(o iu4op e ivta(  2tmu pou1olxn fciat aDel( o t4aexrmf3iatomD aneo;t)s2trxm nudamtelfcta(fsrurur oo4tlxnioctydlmDuln s;t)alxnircoo1fate i sl(  etmir iydame liesas s2tr(mo;t1tlxoiieild aDemnms;u4 etnxr3iydlmt  ieo s) rxm(rpoudalt lfeta()s2tax onu0tpxo f3tytls rm( s;u4arxrmociytlmDeaies ( s2xrxm3nodllen ncils  rtrxmo;t4aeto f3tldfm2ra(vp u0aexoxo3iydlm e u ils)texo(mpnodaltelfeta()arrrx o;o1oeeomoeiys mDelnmo (0 exrif3io1opt  ieo;t)teuo(r io1am   nes s artrumpnu1tetnifciys s rlu o;u0 rxomocoa1fpDraivi t0 rxmxrpoy1omt lfeias)a2um(mo;o1olxnmo3ils aDemnms (4areomf ootfat anei ( trxmir iu4om n ieil(fa2ta( pou4aleoiieiasfm2elu snt0alxnxf3tadlpDeli s;s) exoio iy4openlicsa()aDur(mono0apeniiciltlaDuluvon()alxnir oa1lm r u i t0trtmio3nu4amee netas  Dtr(mo;o0alt  oeiytfa eau s;u4aexrmfcoo1lmtean i ()s2xoio3iu4lp   icil(faDumxmpou4aex  o3ilsfsDum(mo t0tlenmf iydlptr ivols) etmio3nydlpe  fvtls  2rau  ;t0oleo oeiad s emump t0 lxnmf tadoat anei s) eumir3ny4al nlivslsfarumuroou0olt micilt mDeanmsnu)tltnxo oydlp e i ols0 2xrio3io4amtnlnctat) 2umx  no1apx  f3iat mDrl(ms;(4areomocoatlm rli s;() euriopio1ap   icsls  rtau  ;t0aexomociyslsDem(vp () ltoxf tadlpDeln s;t0srxrxopiy4om elnvsl( srtau  ;u1apt  fcild a2ean on() lxoif ia1fa rlnvi;()trxrim iydamtn fesa(  rrau ooo1tpt  ieiyd s2ea( o t)areoio oy1la  au i;(0srurio3iu4amenlneil(f Dtrxrpou0alxo octytlm umumo;u) exoir3to1fmtr n i;s) rtrxo iodameelneia() Durxm ;o4tpt mo3iytfsDean p ()tetrmfcia1fmDran s;s0 exo(o3iudll  lietat artru pou4tlt mi3tad m ua( p;(0tetrmf oo1fate uei;()tetoxo iy4omtnlnciasf 2umu pou4altn f3tlsfsDea(ms u)aetnifciotoaDeln olt)s2xmio nydlp elfetls)aruaxmono4olt  oetytfa2ua(mont0arenmr iadfaDr nvi;s0 2xrio oo1ol nlneil()a2rrumoot4opto octls a umu o ()artoifcoo1lm eanes;( s2trxm3oy4amtnlnci (fartmx oou1opt ifctydfa ean o t4 ltnir3ty1lpD lneo;()setr(rpnudop nlivsa()aDrm(mp;u1texnmo3iatlm rm( pn(4arenmr iotlmt  ueo;()s2trxo3ny1ale  ivtlt) 2taxmp;o1aeto i3iaslmDulu o;t4aeeoxr ia1op rln ol(0seum(opnu1alenmivsa()s2ur( pno4tpenmicild mDumnvp;u)tlxoirciatoa raiei;s  etmimpoo1lptnmiet (f Drmurpnt0aptoifcias aDrlnmpnt) ltomr oadlpDe ieo;t s2umxopiy1altnlivilt a2rmur ot4ope  o3tas s eanmp u4 rxnxr3totop  aivsl(  2xoiopnudlpee nvils aDra(  ou0ope ifciytfs ulnmo t0 ltnmf iydlaDr uvi;()tetmxrpiu1ame  nes t srra(mo;o1apx ifciyd s2umuvont0 lxrxocoydfpDrlueils t2urxopiydomt miei sfsDta(mooo4tltn ietlsls2rmump;(4altrircoa1fat luvi;(0s2tm(o3oo1omenmfeslt s2rmum ot4apxo oeiatlsDumnmsn()tlermocia1oatr nvols)srxo(r3oy4lltn ncilt srtrur ;u0olto i3tydlsDrm(mont)tlenmrcoa1fpte ueo;s) exmxmpnudap n fvtat)arrm( ono1texomo3iytlaDrm( p u4teeoir3iatlmtraivo;t)trurxm iy1opee nvias aDururo;u1tlen iciadfs ra(vo;(4tetrif iy1oaDrluvs s)s2xo(rpio4lle  ivtlt)s2tr(m ot1oexnioeiaslm em(mon(0aetnircoadlmDelieo;s)srxo(opoudamen fesat srtmx ont4apt  fciydla umn ont4 lenxf oytfptrauei s seuo(mpoydlmt lietas)sDurx  ot4aetn ociat s2rm(mp t4tlxnifctytlaDe n o;()t2toim3oy1ll   fcs sfaDta(m ;t1ope  ociad s rln p u)aeerir3iatfpt an o s0sexo(r nu1ol elivs ( sDurxront4tpeomoetld a rl(vpn(4tltrmo ootfpDrliei;t  euoim3io4apee ivs s a2rau  oo4tptn i3tadlaDea( s (0tltrirctotom   i s ( s2trir3oy4aptemnes (fsDtrump;t4tlx  iciaslm um(vs u4 reoxf3io1laDrau ol()srumio3iodlpee fvsat  Draxmp;t0oeenmfeilsfa2elnmon()aetomo ta1fm rlnvs t0seur(o3oudomeemies (faDrmx  nu4alx ifctytlm uanvsnt0 etomrcoodoaDr ueo s0 2xoimpoodop eliei s  Drm( onu0apt iieildls rlnvpn(4 rtnxrcoatopDranvolt texoim3ou4ol elfei s)aDumumpou0teeniietad a2ul(vo ()artoxf ootopD ai ols0teurir3ny1ol elietas  rtmump;t4texoifeiytfaDum(vont) eenxo ta1lm rlneo;t)s2ur(o nydolt licsa()s2ra(moot1teeo f3ilt s2emuvs;u) exrxf oa1omDe neilt)s2toxo3iu4ll   ieias)s2uru  ou0tpxn oetatlmDum(mo;t4teerirciadlatr uvslt)seurxo oo1opt livia(f Dtax pou4apx mictlsfa um( s;()alxrirciytlp elivi s0 2umxo nodom  livs tfsrumxro;t1olxomoeiydla2um(mpnt4artrif3tadla e nvs;( srtm(mpno4apenlnet () 2tmxront1alxo oeiatfa rl(von(4tetomo3iytla eaivo t trtmxo3oydll  lfet tfsruax pnt4oee if3iytla2rmuvs u)aexrmo tatlmteai ol(0t2tm(opny1omtn fvi (  Dumxrp;t0opxo feiydfaDeauvpnt)teenmr iotop  luvol(0 2umir ou4ameemics t) rraxmoot4oltoii3iytfs ranms;t0texnxocoatfmteluvi;s s2urxr3nu4lm  lnvsltfsrtax  no1ole iicildla2em( s (4aeenif oodlmt  uvs;()trum(r oudomen ietas)aDua( pnt1tptn ictld s2r
\ No newline at end of file
@@ -0,0 +1 @@
+ivil()sexmxr oydam emneils)aDtm(r ot4aetnioeild m2ul( p;() rerxocoatlpDelneslt  rtr(mpnu4optnmiesl()s2tr(mo;u4oexomf3iytfmDulnmon(0 etoif3tytoa r ivo;s  rur(r io1omtnlfcta( artr(r ou1olxniiciad m umn p (0trenxo ia1lat  ivi;s0 2xmxr nodaptn fvs t  2uru  nt1tlxoii3iad aDemu p;t4 renif3oodlat  i ilt t2xrirpio4amt  netl( a2ta(  ot1aptnmieiltfmDelnmp t0aexrifcootlpD li i t0 2xm(o3io4lptn ivs ( aDuaxr ot4opt  ieiydfs2um(vpn()trerxr3oatfmte i s;t)srtr(r iudap e ncs s) rrmu pnt4tleo oeiatfmDrmn o;t0 exrxocoadop r n i s  rtrir3nu1lpee fvsl(fsDrrxmpnu1ole  ocilslmDulnvo;(4 reoxoctodlmtr n o;( t2to(rpiodome mnet s) Drmur nt0tlxnio3tatfm emuvs;t)altrxo3iytlaDe i i t teto(opoy4al n iet sf 2rm(m ot4texnii3tasfm el(von()tltnxo3tytlmDrlnvs s  rur(m ny1amte ivs sfaDra( ont4tpenifeiadfs emumsnt0 leoirciatlpt auvilt) eurxm oo1omen fvsl() rrrx  no0alen ieias m2em(ms;t0trxoxr3oytla  anes;s texoiopiodllt mieslt) rtax poo4oleomoctydfs rmn p (4 lxomfcoo1om ran s t)trtr(mpoudlmte ivsl( srtau  ;o0aee  o3tltfm2um(monu0altrio3oytla   ueo;(0trtm(o3iy4opee ies tfaDtmumpoo4apxnii3ildfm eln snu4altnxr3oydlaDeln o t srtm(o3oy1om emictls  rtm(mpno4aptoii3iydfs emump;()arxrir3tatom rai ilt sexmim3no4apeemivsl( sDtaxr ;u4apx  octldfa2eauvo;u4aeeoxfciydoaD lnei;s) eum(rpoudapte nvtl( s2ur(mpno0apeoiieilsfm uln pnu)alenxo3tydla e uei;s0 2trxo ny1oltn fcil(f 2rr(ro;o4tlxo i3ilsfa eau o t)alxrmocoy1fmD  uei;s0 exrimpnu4am nmiesas artrurono4opx mfctyd m2rmump u0texrmr iadop rlieo;s trxoxo3nu1lm elncs s)sDra(rpno4oltomietyslsDrluvpnu)texrmo3iodopD an ol(  exr(opnodopeemneia( s2tmx o;o0tex mo3tyt s2emumpn(4alxomo iodoa   ieols  etmir3io4ol nlnvslsfsrtm(mp;u1alt ioeiltfa2emn s;(4 rtnir3oa1lp e ivs;s0seum(m3oy1omtnmneil(  rrm( ono1ape ioctat a rlu onu4aexnirciadopte i il()srur(m nu1omte ivsa( s2rrx pnu0aexn i3iys s2elumo;u4trtoxfcoa1fa elieo;t  2uoim nu4llt mnvtl() Dur(m ;u1optoifcilslaDuaumo;t)artrio3tydopDelivi;t  rtrxo3iy1omenlfvtl(f 2um(  no4tlxn fctat m eau s;t)tetnmr tatlm elieo t) eur(opnu1amee ncilsfs2tmxm nt4opt  i3iys a el(vp;t0aetoxo3tadlm   uvs;s0trxm(o3oy4llt lnes s  2ua(m ot4openiocilt a2umnvpnt4aeeomr oy1omteli o;t0s2xrimpno4op  mnct t sDraxr ;o0texo i3iysfs el(vs (0trerir3ia1omDr nes s0 2uo(r3iu4al elfvs t)s2umx pno4aee iociasls ran pn(4aeenmr3oytop elnvi;() etmio3io1al n nvtl(fsDuru  ;u0opt mfeiysls ean o;u0 ltnmo iatfpD an s;t) 2uoir nodapenmfvsls a2rm(mpot1alxoiieiytlm umn o u4aleomo3iytfmD ln i;s)s2tm(r nu1am nmncta(fsrrax  ;o0oet  ietydfs2ra(ms u4treoif iadlpt lnes;()t2uoxr3ny1opeelnvsasf rtauro;u0aex iociadfs2eln p;t)trermr totoaDeanvol(0 2xoxo3iodap   net s) rumum ;u0teeomf3tadfa2elu snu0arxnio oo1faDe nvilt  2trio iu4lmt lnvt ( sDtmx oou1alxomo3ilsfm emumonu)aeerioctydfpt  ieo;s) exrxmpou4ol elfvilt)artaumpot0opx moctyd m2umu o (4 leoioctydlmtr i ol()seum(r3io1am e ici s) rrrxro;t0oexo ieiyslaDumump;(0trxoxrctadlat  ies;()sexm(opiy4am nmict tfsrrmxm nu4altomi3iytlsDemums;u4tltrxo tytom elieols trtr(r3ou1lptn ics (  2rrxr ot0aexnmiciydfm2elums;u4 lermrcoadlmt aiei (0seuoxr3oudame lnci s  Dtaxronu4opx mf3iyt aDra(vo u0 exrmf oo1om r n i t)srxoxo iy1am  mivt s)a2urx  ;u1aleo fciys m eauvo;() lenir3oy1fa rlueslt0 eurir3oy4ape  icsat)arua(r oo0oexo ociatfaDean o u4 rermf ootfatrlnvil() exm(r3oydll nlfetlt)s2tr( o;u1openmieild m em( p;u) rtnmr iadlmD anes;t sexm(r3nu4ol nmies (fsDumumont1oex ifciadlm rlums (4teenxo3iydoptrlivilt)s2tmxr iu4op  lfciat  rtrxmo;u4alto ieiad sDrauvo (4aeenxfcoydfmte nes t) 2trxr3io1llen fci ()srurxrpot0tlxnii3tysfs um( onu) lxnmocoydlaDraues t0t2xm(r3no1omenmieiasfa2umxro;t4olxomi3tyd aDrlnmont0 eeoir iodomtrlnei;t t2ur(opiydope lnvtat  2rrum nu1tetnio3iatfm2ra( p;t4trenmocoytfmDrlivo;t)sexmio oodopenlict t  rtmxmpnt1oeeo ociadfs rau on(0 ltoxr3iadoatrauvslt0tetmir3no1ol emies sfa2umumo;o1tptn fctydfa2el( s t0altoir3iodfmD ln s s)texm(m oo4llenliviat) rur(  ;o4teeoioeiydla el(mp (4trtomfcoa1fmDraivi;() rto(o nu1ape mfcs ( srrax p;t1opxoii3tltlm2rln s;(0alxnif3oydlmtelieo;s0t2uoxo nudlleemietat  rtmumoou0tpx if3iatfm ra(mpnt0 etoxoctadom rlieils0seuo(m iy4am nlnet t) rraxr ;t1tpeomfeiyt m eaumpnt4alxrio ty1lp eaneo;s setm(m oydom n iet s  2ra(rpot0texoif3tyslmDrlu ont0 renxo3oatopD an ilt  2xrio3io4omtn fetasfartr(mono4olxnif3iat m uaumonu0tltoxr oodlm rln olt t2um(o3ny4aptn feilt) rrr(mpno0tetoiieiad aDrlu onu4altoif totlpDrli slt0seurirpou4ol e fvt t  rrrx p;u0oexn i3iyt s rl(vp;u4alerxf iydlmDrai s;t  rxoio ou4lmtn fct sfsDtrumont4opt iietatls elnvs;t) rtrxr oy1lpDe nei s)s2umirpoudlptnlncsas  2rr(rpnu1alx mo3iatla2elnvs;(4trenif ta1lp   ieo ()texr(mpiudal nlncilt  Drrxm oo0tlxoif3ilsfs2eau p;(4tltrmr ootla rau o ()tetr(m3oydape lics tf Duru pnt0texn oetyslaDel( p;u)trenxr3iytom  livs s)t2tmxr nudomt mieiltfa2tax p;o4tpeo icilslsDrm(mont0 lxomo3oodfptrluvslt0 exrxr io1ole  icil()artmx  ;o0oltomi3tlsls2eaumsn(0tlxnmo oy1laDraivs;t0 2toio iydomt lfvt tfsDrm(m ot4teto i3tltfsDeln pn(0areoxocta1lpDrlivilt s2uoim3iy1oltnmfcia(f 2trx onu4alx mi3iatfa eauvo;u)tltriociotfm  livils sexo(rpio1lm  mnetl( srum( poo4apx mictas m2eau o ()tlxnmr3oytlmDe uvi (0sruo(o oudlm emicils) 2taxr ;o1olxn o3iytfs2eanvo;u4 lermr3ootoa eli o;t0 rxmxr3nodop emies sfa2umxmonu0tee ioetyd s2ul(vo (4 ltnmoctatfptr n s;s sexoxr3nu1lm nlfet t)s2ua(m no0texn fciys m em( s ()aeenxf iy1lpDrlnvs;s)s2tmxm3io4om  miet ( aDraum ;o1aexniietys aDrlnms;()texoir3ia1fat lieil(0s2xoxo3nydlltemfeias a2taxm nu4tltnmocils mDrm( o;t) ltrir3iatopD  i o (  rtrxopiudllt mivi (  2ur(mont1oltnmfetadfa2ranvs;t)tlenxocoo1op rln o ()srumirpnudaltelnvtas) Dtax  oo1tltomfciys m2rlu pn(0 eerio3iy1omt an olt) rxrirpiodaltelivtasfa2tm(r ;u4apxnifciltfs2rauvpnt4 eenircoy1lmDrli i;(0s2tr(opnydlm  mneia()sDuax o;t0alx mictadfa2ul( p;t0trenmrcoatfmt  uvi t trtm(r3nu4lmeelncslsfaDtmxmpou1apt mieilsfm ra(vp t)tlermr tadfm rlnei;( trtmim3iodapeelies tf 2ua( pot1openmiciat s2ulu onu0trenmr3iodlm elies;s)sexm(opiudlpteliesat a2rrxmoou0altnioctyd aDra(vp;(4 exrmr ia1om rlnes;s)t2uo(o3oo1om  lncsls)srra(  ;u1aptnio3tltfsDrlnms;(0trtrxf3ty1oaD aivs;s  exoirpiudamtnmncsl()artaxrpoo1oeeoifciltfm ranmp;(4 reoxo3tadfpDeaivs s0srxmxopiodape  ncia(fsDtruro;t0aptomo3tyd s2uanvpnt0tlxrxrciydop rlu o ( seurir3oodal nmneias)sDuaur oo0texoio3tytla uau pn(0 exoir io1lptelueslt  rumio3ny1oltnlnvtas) 2rauroot4aeen f3tadlaDrln o (0tetoioctadoaDrli ilt  rtoiopoo4amteliei t  rtr(monu0aeenmfciltfmDuauvo (4altoxr3oo1omD auvo t) 2ur(o3nu1omt  nvi t sDtmx  nu4opxoioetad s eaumo;(4trxrif to1lpt ai o;()srtoir3oo1alee nvtas  Drrxr nt0open fetad sDea( snt4texrmf totomt  neolt) rxo(r3nudoltemfvsa(farrm( o;u4tlt iieiasfmDrlu onu0teerxo tydfpt an sl( trxoio3no1omenmfciat  Drm(moot1alxn feiyd a2uluvs u4aleomo3iodom elnvils  eum(rpiy1lltemfcils) rrrx p;o1tlen oeilsls ulums;u) lxoxfciotoptelnei;t)t2xrxr3oo1ll elfvias)srraur ;t4oeeoiieiadlm2rl( s t4tlerif3oytla   i o;t) eto(mpoo4lp nlfvs tf 2um(r ;t4aetnmfctltlm emu snu4 eenmfcia1fpte u o;t) 2xo(m3io4om  lfeta(  Drru oou4aleniiciatls2eln ont4 etnmfciatom   n o;(0 rxo(o no1am elfesa() rtaxmp;u0ape  fciltlsDrau s ()aeenmrciy1oaDean o s)tetrxm ny1omenlfes ()s2ua(r nu1oexoio3tlsfaDeanmpnu4alxnxo3io1optran i () rumir3io1apenlfviat)arrrurpot1tlt  feiadla2eau onu0tlerxo tatlm e ues t0 2uoir3nodlm n fvslt)s2umx p;u1altn ocilslm elumsnt4trtnxr oodfpDe i o s  rumxmpiudlm eliei (  2umu  nu0tptomoctadfs2rluvpnt4 rerifciodlmtelu il(  eum(r3no1al n nesl(fs2urxr ;o4olt mfctys mDeanvp;t)alxnmfctydla eau ilt)s2xmir ny1lmtn ncsas aDumxr nu1tpt  ociad a umnvo;t4tlxnxocto1lmDr i o s0 etrir iodolt  nvsasfartr( pno4oexomi3iadfsDelnvsnu)tlenxocio1la r n i;s0 2xrirpny1olt mfvil(fsrrr( pno4tet  fciadfsDra(vsn(0arxrmo oo1fmDeluvol() etoio3nudllenmnciat s2umxmonu4ope mietysfaDemn s u4teeomfcoadlmDr uei (0 2xmxrpiu4omen nvt ()arrmu ono0aeeoiictadfa2ulnmsnu)trxoxo oytomt lneo s trumxo3io4om nlnvia() 2rmurp;u1oexoif3tat aDel(vo;(0 exrir oa1omteanvi t0trxrir nodom nmiciatfsrua(roou0tee mf3ilt a rl( on() lxnmo3oo1fpD lu o t texrim3nudam n ivsls) rtmuro;o4ope mi3iyslm em(mo u0 rxoxo3totoptrliei s0t2toxrpny1am e iesatf rum(r ;t0aetnmieildfaDrln pnt0aexnmf oytop rlnes;() eurxo3iu1ope  ietl(fs2um(rp;t4tptniocildls2em( snt4aexomo3oadomDe nvi ( setrir3iy4lm elici (fa2ua(mpoo0apeomieilsfs2ra(mpnt)trxrmr iytom eaivo;(  exrxm3oy4optnlicia() Dtmumono4tetomo3tldlmDuaump u) etomo3tatoatelueils)t2xo(m3nydlpeelnei sf Dtr(  ;o4alt mf3tls aDrlnmpn(0aeeomrcio1omDelu i;t0 exr(opoy4lmenmicsa( sDraxr oo0tpxo oeiyslmDumump u)teerir3oydfaDe n i t)texmxr3oo4aptnmfcsas)srumumo;t1tetoioeiytfmDeau s;u0 etnmr3oa1fpt ai s;()t2toxr ny4omtn nvtat)sDtmxmp;o4oexnmi3iadfa2emn o;() rerir3iadlaDeaueo;t seurxm3ny1omtnmfeta( sDrmx oot4oex ioeiadfsDrlnmo (0tlxomociadfmDe uvi s0srtr(o3oo1lmee nct s s2uru o;t1optoifctydlmDuln s t0trxnxociytlmtrau i;t tetmxrpoodom   ivslt)a2ta(m ou0opto f3iyslm ul(vpnu4 rermrctadoatrai ils0trtoio3iy1llt mietlt  Durxroot0aexoii3iadfaDumn o (4aetoif3tytfatr n o t) rumio3nu1lle  iet t a2rr(mpnu4apenifcildfmDrl(mp;(4alxomo3iodlatr nvs;( srurxr oy1oleemfvtltf 2tmx pou1oex  i3tys s uanvo t4 ltrmocoatlpt li o t)teuo(r3oo4olt lfcsl()a2rmxrp;o0olxnioeiat m2ra(msn(0 rerxf io1lm eliei s0srto(rpio1lm nlncsl( a2rax ono1olx ioeiasfa rau p;()alxrio3oy1faDrauvi;t t2xm(mpiydol  lfeiltfsrur(rpnu1alx iiciadla ul(vs;u4 ltnif3tatfmte n o ()srto(r iodap e nvt (  2trur oo0alxnmiciasla umnms u4 eeniociy1latr u o;s srxmio oodapenlivsas)aDrm(mpno1olenio3taslmDel( p (4aexomf3oydfpDrauei s trtoir ou4al emivi s)aDuax p;t4alxnmo3tlsfs2uanms;u0alxnmo iydfatr u o t0setoir3io1omtn fcsls  2urxr no4tpe ifeiytlaDum( o;(0texomrctytfpDr uei s  rxmir3ou4al emncs t) 2ua(mpno1olx mf3ilsfaDrlu s;u)alermoctatfm  aneols)s2umxr nydlmeelfvia(  rraxmp;o1tetoiociad m eluvpnt)trenio3oo1laDrau s t  2xmxm iu1apte neiasf Dururono0tpt ii3ils aDrm(vo t4artomf3oatla  luvi t trxmio no4ll  micsl(farur(mpoo0alxnmi3iadla2ra(vpn(4tlxrifcty1oaD lu o t)t2toxmpiy4omen ieia( aDua( oou1oexomo3tyd mDul(msn(4tlxnxo tatlmt ai sls) rtmio3iudal elfvi sf rtax o;t1aetoifeiat m eauvp;u)alxnxo ty1lat  neo s)srurxm nu1ole  icslsfa2umxmp;u0apt mi3iat mDem( onu) lxoiocoydopD ln o s)t2xrxrpiu4amt mnvia(  ruaxr nu4tleo ieiatlm eanvs;t)teeoioctadoat lneils s2um(r iydape lnctat)arumur oo4apt  ociad m ra(vpn(0 renmr3oatopDeaivilt  2tmir oydalee nvils)s2truro;u1apt ifeilslsDea(vo u4arenif3ootopt ai ol(  2uoxo iodlle mncta(fs2ua(r ;u4tltnifeiyt a raumon(4aexriocoydfptean s s)s2uo(m3nydop e ieiasf rra( pou0aetnmieildfsDua(vs t4teerif todfat  ueol(  2ur(o io1al elnet tf Dtax oou1tle  fciyd m ra(mp t0 exrmf tytfaD lieo;t)s2uoirpoy4ll  lfvt s) 2uaurp;o0opxomfeildlsDrl(mo;u0tlerxf3ootfpDelu s;(0seumim3iu4lp e fvtlsfartrxmont1oexnifeiyd a2ea( o;t4tltrmo iydoptraivil(0s2tr(o nu1aptn fetat aruaxmpnu0texn ociltlm2eau p;(4 eenmr3tadfa eanvilt  etmxo oodam  lnet (fa2trxronu4tpxomoeiatls2rl(vp () eeoxo3oytlp elu ilt)teuo(m3nu4llenliesa() ruaxr ;t1oeeo ietyt a umumsnt0artrif3iatoa e ies s0setrim iu1ll emnesa() 2trxro;o0tleo i3iatlaDulump;(4trxnxocoa1latelu i t)trur(mpnudalt  ict ( aDtmuro;t4ole mfeiasla rmums;(4artnif oadfptr ivil(0seuoir3ou1llee ncs (fsDuax  nt0ope moeiatlaDum( p t4trxrmo iydoa eli s;( t2tmiopno1apt livsls)arurump;u1tlxo fctys a eanvo u0tetrxfcoadoptraneslt0tetrxo3iodom   icsls)s2rmurpot0apxn icildls2eaums u0arenmfcoatlp raues t teur(mpno1ol n icia()arrm(m no1teenmo3iltfm2eluvp u0aeerxf oadlmD aivolt)seumio3no1ame mieilt)aDta(  ou0alxnmiciltfm ra(vo;(4tltoxf3todlpD aies;t  rtrimpoy1ope lnes tfsrrrurooo1aexn i3tys a2elnmo;t) eenxr3iydlpteluvs t t2xoio3nodole lfetas)aDtaumpoo1apx mf3iytla eanvo;u)texrxr3iadom  livo;t)t2tmirpiu4omtemfetl() rua( pno0oltomi3ildla2rmnvs u0artoxr3ia1faDranvi t  rxrxm3nydapeelictltf rrau onu0altn ictysfm rm(vo;u0trxrmoctotop rlnvi;( trtoxm3io4olee feils) 2tm(  oo4tlto ocildfs rau p (4teeoir3ootlp eli o (  rum(mpiy4oltemfvils  2rrurpoo0tpx micias s2elnvo u)arerif3oo1optelivslt) 2to(o ny1olte ict (farra(mpnt4tlx  octls a emu onu0aeeniociatfa  anvi;s0setr(mpio1am n fei t  rtm( p;u0olenmoctadlaDel( pnu0alxniocoatfa elueo s0srxmxopoy4op   iesl()sDurxmont4opxnmiciyd s ranvo u0 rxnxf3ty1fp rlneo;() rxrxm3io4op n ietltfarrax oou4oexn fctldfs rl(vp;t)aetrxr3oy1lptelueils sruo(r iodap emics s  rrmurpnt4olxo f3tatfs rlumo;(0texnxoctadomtr ies;s) rum(o iu1lp  mfetltfa2rm( o;o0tltomo3ilsla umumsnt0tetoxrcoy1laDeln o;s  2umim3no4al nmicsa()a2ur(root0oeto o3iadlmDem( onu0aeeoxf3iy1oaDelnvo t)sruriopoo4amtemfesas)srumxmp;t0olxn oetyt sDumuvs t)arxrioctadop e ivi;s0 rxm(r3nudol  lnvi ( arra(mo;o1opxo ieilsfa rauvo t0aexoif tydlpDr neo s0teuoirpoy4ol e fvtltf rtau  ;u4opx ioeildfs2emnmp;() rermr3oodlptr iesls trxrxr iy1oltnmneslsfaDurxmpnu4opxo ociyt s rmu s (4 exnmr3iadom eau ils t2to(r3oy1am  lfcta( s2ua(mpot1aex ifeiatfaDrl( p;t)areomo oodop e uesls) rumxopou1lle mies () rtrxm ;t4aetomf3iatlm rauvp;u4alxrmfctytoaDeauei s)setoio no4am nmfeiat s2rax oot4apxomfeiatfsDulu p;(0 eermr ty1omDr uvolt  2xoim nu1omtnmnvtl()aruaxrpnu1apx  i3iytlm elnvs ()treoifcoatoaDelu sls) rtr(m io1ale livtlt) Dta( ono0tlenmfeiatls rau snt0trxnif oy1lat li o;( trxoim3nudolen netlsf Dtrum ;t0alx ifciad sDeluvont0altrxfciy1lpDe ivilt0trurxopiodamtemivia()arra( pnu4opx if3ildfm umn p (0trxoio3tydopDrlnes;s0s2xm(r3nu1op  miei s artaurp;t4tpe  ociltfm2ulu p;t0aeenio oodlpte u s;t0seurxrpou4al nmfet t  2urum nt0olt ii3tlslmDean ont4tlxnmfctotoaD lies;s0 ruoxr iu4lm elfvsat)a2rrx  ;o4apxnmoeiatfs rluvs (4tetrmfciy1opDe iei;t)texoxo nu4al nlfvtl() Dtrur nu1tleoio3tlsfa2ra( p;(4tetomrciotlm eaues;(0sruoio oy1apenmfvil(  rurx poo4altoiicias s2ra( p ()texomf ta1om   nvolt)tetoir oydlptn nvt t  2uru  no1aexo i3iytlm2rmu p u)artrmfctodoat li s;()t2uoirpny4ameelnes sf 2urum ot0apeoifctyslm elu on(0 rtomf3iy1oaDeauvolt0trxm(m3oo4om n nei t  Dururp;o0opeo octasfa2em( snt)artnmoctytoa r i o s  eumxm nu1ll elnvt () rrrx p;o0tlenmi3tysfaDuanvo u4tlenmo tytoaD auvs s0setrxo ou4ol nlnvtasfaDta(rpnt4aeto feiyslmDum(mp (4 rxnir3ty1latrlivi t s2umxo3iu4al   ivil(fa2urx ont4apxnmiciytlaDemn pnt4artoir3iytlatrlnvslt0teurxm oy1ol  mfes t) Dtr(  ;u4aetn o3ildfsDeanmo t4altrmf3totoa rlu s (0 etrio ou4omeelivsa( artax pnt4tetomieiysla rl(vs (0 etnifcia1la r uvo t0s2xmio nydlmeemfvsa(  Drmx o;t0texomfctydfa2em(mo t0trermf3iydlmD  nei;( setr(rpiy1ale mnes t)arrru  oo0opt  i3ias m2rl(mo t) lxomo oatlmtrauei;s0trxm(mpno1lpt liet t)sDrrurpoo1opeo o3ildls2elnmp (0tleoir iadoa rli ilt0t2trio3oodamee nciat aDum(rpot0tlx mociyd sDumumsnu0 rxrmocoadfatrlu i t  2ur(opoy1op  mnvtat aDrr(moot4tpeoio3tltfaDumumpnu) rxrio3to1la r n il() etm(m3oo4lmeemies tfa2rmu  ;t1tee mo3iyt s ua( pn()texnxo ty1lmtraieilt0t2trxmpoo1lp elieiatf rrmxmpoo4opx  f3iysfm2eaums;(0teenxf3oa1op eaivs ( s2toxr3ny1lp emfctat) 2urum nu0opxomf3tlslmDemn s;u4 rtrmf3oydfm   n s;( t2urxo oo4optnmnvt t) rumur nt1tlx  feiys a2eauvsnt)aeeomo3oadlmDeluei ()t2xmxopou1am nmfei (f 2ra(r nt1oet  ietydfa raumon(4altoir3ootlmtr u o s0seur(m iu4aptnlnci sfsrrrumoou0ope ii3ilsfmDrau sn()arenxrcoytom r n ils0 etrxopoodop   fcsa()aDrr(r ou1olxniieiadlsDuln s u0aeeoxf tydfmDeaueil(0 2xmxm3oo4op  lnesas)sDta(mo;t0tlt  i3iysfaDulumo;t0trerxf3iy1om rlu i t)trxoxmpny4ole  ietl(fsDrrx p;u0tpx mieiadfa2rm(mo;t4 lxnxo iadop  livo s sexmir iu4omenmncs s) 2umumpoo1alenifciasla2ra(mont)arerxo3iadoa   n ilt0trtmxr ny4ap nmncsas)aDrau ont4opxnif3tas a uanvp;(0trenxf totfateln i;t0sexoxmpio1optnlfetat)srum(m ot0alenmi3taslm ranvsn(0 leoxf iydlmtrlu o ()s2xrxr3iudlpe  icsl(f 2trxmp;u4apeo oetltla rlumsnu)aetrio oo1fmt luei;t srur(mpnu1lptemicia(fs2umx o;u4aeen f3tydfs eanvo (0aeerif ty1lp r nvolt)srtr(m3iu1ll nmfcsasfaDrru  ;t0texomoctytla uanmo;(4alxoiociy1fp   i i () etoxo3iu4lmen netl( a2tr( poo1ale mfctatfs umumsnu4aeeoxrciotfmDelieo;s trumio3oo1ll  mfetas)a2rr( o;u1olt if3iyt a2rlnmp;u)trxnxo io1laDraueils0tetoio nudap  lnvs t)sDra(m ;o1apt  fctltfsDuln s;t4tlxrif iydfaDraneol( t2trirpnudlme mfvt s)arrrurp;o4opt ifeilsfm em(vo u)tlxnio iy1fa e ies s0 exm(rpoy4om n ivs (  rtrur no1altnmieilt aDrlnvsnt4arenxr oydla rlieils) etmxopou1lltelfvia()s2rr(  ;o4texoioctadfm2rmnmo;u4 eermf3iotlat  nvi;s)t2xm(m3io1aptemncilt  2uau onu0tltoif3iat s ean snt4 leoxf3oodomDeaivsls  rxoimpnodlpeemfvtl( aDtr( oot1aleo fctadfs2uan o;()aeenif oa1lm elues;t0 rxoxo iudopt mncsl()s2umu o;o4tpxniicils s emn p;t4aexomf tytfp e ieol() exmxopoy1apee fcs tf Durumpoo1oeeoiociatfs2el(vonu4tetoxo oydlmDrlu ols)sexrxrpoodolt  feia(faDrrxmp;u4tpx mieiytfsDrlu ont0tltoio3ia1oa   nei s s2uoio ny4omtn fct tfsrtrum nt4oex mieilt m uanmo t4 rtrir3oytom  aieslt  etmiopio1ll  lfciat) 2rmxr ;t4aeto o3tyt s uln p;(0aeerxo3oatfaD  u o s0texmxo nu4lp nlieslt  Duaur ;t1olt  oeiys a ua(vs u0altnxf oatfmDe uvs;s)srtrxopnydole  iesas)sDrm(  ot1opt  o3iatfmDemn pnt0 rtnif3io1omDrlneo s t2xoxmpou1ll   fvt tf 2rau oot1ape  o3iys a elnmo t)alenmr oy1lpDe u s;()trur(r iudopenmfei tfarta(r no0tlt  fetld sDelnvo t4aexomr3iotomDeanesls)s2ur(m3iudlmeelnvi t) 2tmu  ou4oeeomo3iatfm ranvon(4tetrifctatlpDeaieo (0t2tmir oudal e nci t)aruaur oo1tlx mf3ils a emnms t) exoio3totfa ranvsl() 2xr(opnodole mivta(fsrrm(ront1tee mo3ilsls rln snu0aeeomocta1lmteau s;s t2tmim3ny1lm   ieta( aDtrxr ;t1aex iieiadls2eaump t0texrxf3ta1fptr iesls) rxrxo3iy4alenmneil() Duax p;u1tlxnif3iat s2ea( s;t0 eerifcia1op eli i;(  2urxrpiudamtnmfet s  rtr(mpoo0oet iietlsfm2uauvp;t) leoio oa1omtraiei;s0tetoio iy1ope lfet t)srraxmp;t4ape moetlslaDrl(vsn(0aetrxf iotfmDrau sl(0srxmxm iu1amte iciasfarua( pno4teeoiieiytla2ul( p t0tlenmo oadop rlu ols0 eumiopoo4ap nlivtl()s2ta(rp;t4olxnioetldfm2emnvs () lxrmr3io1laD an sls0s2ur(o3ou4lmtemncilsfs2taum ot0altnmoetatfa el(mont4aetrmo io1la rlnes;s)s2xm(m nudale livsatfsrtr( o;t4olt mietydla2rl(vs (0 ltnxo3iy1lpteli ilt0 exrir3iu1lmt  nci sf rrmxmpot0aptn o3tydla ulnvp;u4 rermf3iy1lmDelu ilt  ruoir3nudoptelnviltfartrxmonu4tpx ifetysfa ranvp;t0alerif ootlpDelu s t0t2tmxr3oodam emfeil() Drr(rpoo0alt ifetysla uanvp t0alenxo iodfpD livo ()srxo(opiy4ale mies t  2uauroot1altnmoeilsfa rau p;t0 etniocoatfp  lieol(0texmxm3oy4am elictasf 2taxmo;t4teenmoetysfsDrluvp (4trxomf3tydfaDrli i;s t2umir3oy4llt mivtl()a2raxr oo1alxnmi3tldls2rl(mo;t0tlenxf3iotfm r u o t) eto(r3iudomtelfcsls)a2ur(  ;o4olxoiieiad sDrm(vpn(4trxomr oatlptrlu sls0seurim3nydol  lfeiat srrm(mpnt0tleomociat sDumuvo;() lxnmo3oydop   i olt0 rtoim3ou4om emncs s) Dtauroou4tlx  oeildla rmumpnt) exnir oytfmD  uvi;s s2urxr iydopeelivtls)sDta(rpno1aeen f3tlt m2rm( s () rtnmocoadopD aieils trtmio3nodoptelieiat sDuaxr nt0tlxomociltls rm(mo;t)tetomfctytomt li s s)s2xoxm iu1llt liei s aDrrxronu4apeoif3ils mDul(ms;t)artoxociadomtraieo;() 2xrio3oydol n fesls a2tm(rpot4tetnmfctasla2um( p;(0 lxnio3oytlp r nvi t s2xm(o3oo1alt  icsas) 2ta( o;o4opxnmf3tltfmDrm(mp;(0 exnmf3oa1fm  anei;t)seur(m3no1amte fvi sfsrtrur ;t4aleo ictadlmDel(mp;(0 rerxf3totomt  ieo s trxmimpiu1ap  livtl()aDtr(  ou0tpt  iciysfmDemump (4trerirctotom elueils0 rtmxo ny1al e fesl( aDur(moot1opt io3tltls2emnvo;(4 ltomf oytlm   ivol(0s2tmim ny1lpte fvslsf rtm(  ou4aeeo oetatls ulnvpnt4 leoio iytlm  livs t0 2toxrpiodaptnliesas)a2tauront1oet  ocilslmDeauvs (0altnifcoodop elnvols)sexm(opnudopee nei ( s2rau  ;u0apx ii3iytls ul(vo t0aexoir3iotfp r nes (0trtm(r3oo1lp emivs s)arraurpoo4tlt  f3tatfmDran snt0aexrxf3iadlmDr neol(0 etmxm oo1lleemivsas) 2raum no1ape iictysfa2uauvs;t4 renmr3tadoaDe ivi ()srxm(r iy4olt  ivilt srrr(  oo0altnmfetlt s2rmnvpnu4aleoxfcoydoa eln o s teto(opoodom nmies ()sDurxmoot4alxnifeiyslmDeaumo t0alenmr3iy1fpt au ol() exm(r3iu4lm nlieias) 2rmx pno4ope if3iyt a rl(mo (4 lxomfciodoa ran o t0trxrxr3nodlm eliesl(fs2tmump;u0tex iieiytfmDrmnvs;u0aetrmo3tatla rli o;s)t2tmio3iu4lm nlnciat aDraumpoo4apx  ictld sDumuvs;u0tltrir3oodlmte nvs;t)trxrxr iy1omeemfvtatf 2rr(rp;o4tptnif3iadls2uau s;t) lxnmo3iatlp   i i;(  rtrxm no4olenmncsl(farurxm ;t1tpx  ieilt a2emump t)alenir3ta1op  livs;t0s2um(r iu4ap  mfeia( aDumum ou0altoiiciatfsDeauvs u) rermr todoa ranei ( srxmim3ou4apenmicsas aDua(m oo1olxnmoeiydlsDean s ()tetrxo3ty1omteln slt)t2ur(m ou1ale  nes s  2tau ono0olx moeils aDrmn pn(4 rermocootfa e uvslt)tetm(o ou1am nmicta( artr(  ;u4alt mociasfaDrmuvs;t4aexoxr oy1fp eanvi () rxrxm3iodapee iesatfa2tmurpnu4teto i3tltls rm( s;u0aexnmocoatlat  ies ()tetr(opou1lp n nciatfsruru pou4oet iiciadfmDemumon(4tltrmr iotfpDeln o () etm(m3oo4op  lies t)s2uru  oo0oexomieils m2rmuvp t)tlerxr3todlaDranvi;()s2um(m3io4aptnmiesas  2umx poo4aptoif3iadfm rmu pnu)altnmr io1fm eliesls) rxrxm3oudlmee neils  Dtmx  nu1texo i3tatfa2ranmp u) etnio3oa1latraneo t  exo(m no1am  mfcs sfaDta(moou4oexo ieiltls emn p;(4trxrmo tatoa e i o;s0s2uoim3ou1optnlfeta(f Drmur ;t0tpeo o3ilsfsDel(vs;(0 eeoifcoatlm eaivil()setm(mpiy4lptnmnetat)s2rmuronu0opxn ieiad s ulnms;u0 ltomo3iatopD au s;t  2uoim iu1ope mieia()sDtmu o;t1ole iictad m2emuvp t4 ltnxocootoptr i s;()trtrxm nodopt mnvt ( aDrmx oot1oltomoctytfm2ea(vpn()aexomr3todom eauei ()trtoxmpnu1lltelfes t) rrrurp;t0openmf3tasfa2umnvp u)alenxocty1lptrlneilt s2tm(mpoo1lltelieilt)srurxrooo0aeenmietyt m2el(mo u0trtrxf totlpteaivs t0seurim3oodaptelivsa()a2tm(r ou1ape ifciltfmDulnms ()artrifcio1om  auei;(  2umxm3io4omenlfvi t)a2trxmp;t0tle mi3tas s2eauvp;(4 rxrio oatlmtelnvo;t0 rtmimpoy1apen nct (fartm( oot0alt  iciatfmDeaumsn(0aetnmo3ia1om rlu sl( srxr(mpnudapee fcs s  2umxrpoo0opx  oetytfs2rln o;u4aleomf iydom rlnvsls srxmxopiy1olt mnvils) Dtmurp;u1aex io3ias m2rmn o u)altoir io1fm  livi;s)trumxm oudaptnlnvsltf ruau pnt4tpt iociasfm2umnvp t4treoirctatfmt anvslt tetoirpnu1lptemfvilt)s2urur no0tpxoii3iys sDra( s;t0tleomfcoatfp  anes;(  2tmir3nu1ope miciat) Dtrum nt0tpx mocils s2rlnmont4tetoio3to1omD au ol()srxmxr oy1lmtnmnes t)arururpoo0oetomoctlt mDrlu p ()trtomf todop rlneo t  rurio oudllenmnviltfsDua(rpnu0tpe ii3iyd m2ea(vs (0tlxoir iotfpDean s;t) rtoim iy1lltemictls) Drmx pnt0oex moeiytfa2emn p;t4trtoxociotfpD aieo;(0seurxm oy1lp elnvi (fa2rm(m ;u0ole  ietydls ua(ms;t)trxrmr oo1lp rlnvs t0s2xm(m3ny1lme lieiltfsruru  nt0aexo oetadfaDumn pnu0 ltomf3oy1fm eli i (0 etrio3oy4ap  mivils  2ta( o;t0opt  oeilt a2ean pn(0 rtoif to1late i o;(  rxr(mpny1ll n ivsas  2urxmpno0tlxoif3iad aDelumsnu)teermr3oy1fmt  uei;s) 2ur(opoodam nmnvias arua(m oo4texomfetadfs rl(mp t)texnxrcoadla eanvolt)s2trir3oudlmtnmncsls)srurxro;o0tpxnmoetls a2ra( s t0 ltrir ta1fateauvi t)setoio3oo1olt mneias srta(  ot0tpt mieiysla2elumsnt0tleomf oadfmDeluei s)trtmxo3no1ape  fcsl() 2umu pou1tleoiiciys m rluvp;(0alxrif ootlmtrlnes;t) 2uo(o iudlptnlivi s srtr( oot1tex  ieiltfsDum(vo (4altnmocia1oaD livs t)trtr(o3oodom elnvta()aDta( o;t0oexnmoetydls2uaumon() eeoxr iatlaDrlivols0srtoio nodlpen nct tf rrmxrono4tlenii3iltfaDrauvont)tltnircoo1oateauvsl(0t2umirpiu4ap  mfcsas sDrmxmpou0alx mfctytfsDrlnvs;u) leoif iytfp elivo;t  exo(opnu4apeelncta() 2tr(rp;t4apeoif3iasfaDra(vs;(0trtrmr3oatfpD luvi s0t2toimpou1om e fctls) rrr(moou0oeenmietys a rl(mpn(0trerxrciotfa  li o s s2tm(r iudap emfvtls aDtauront4olt iociydlmDuau sn(0 etomo3oatfm r nes;s0t2tmxrpiydal  mnvtls)artm(m no4opxnifetltfm rm(mo;u)tleoio3iotomtr i ilt  2xo(o3ny4ome mnvia()s2tr(mo;t1tleomo3iltfa umn onu4 eermfcoo1omDelneil(0tetoiopnu1am nmfcil(faDur(mo;t4tlxn fetasla eluvpnu4teenirciydlm   nvo;(  ruo(r3oodape lfct (  2uax  ;o1texomi3tytfs ulnms (4trxnif3to1lmD lu ilt)t2urxopnudlmt mnci t)sDtm(mooo0texn i3iysls2emuvo;(0aeerxo oo1fat  ueo;s)sruo(opiu4lm   fvs s)s2ta( pnt4texoif3iadla uluvp ()trxnio3todoatraivo;t s2tm(opiu1llenmfvsl() rtax pnt0tlenioetys s2elumo;t0 lxrxf3oydlm r ueil( trtrirpno1omtnmivs ( aDurur oo1tltn f3ilt s ra(msnt)trerxf3ia1op elnvo;t)seumxo nydll nmictlt s2rrx p;t0opeoif3ildla umu s t4 exnxf3totfatr ivo;(0sexmio3oy4am  livi (f rrru oot4teeoif3iat m2eanmpn(0aleomr ia1fmt ln ilt0srtm(r3iy1al e fcta(fs2tmxrpnu1texn fetltlsDrm( snu0altnirciydoptrlnvols)t2xrxo nu1olenmnci (  2umxmooo0altn o3tatfs2rmn p;u4 rtoxociotomte nvols)t2uriopiy4ame mivsa(fa2um( p;t1tptomo3iltls2eau snt0 exoxf tytlmDeauvo;s)trxrxrpoy4alt livtlt)aDurumpoo1oltoifciytlmDeln p u0 lxrmoctytlpte u i;t)t2uoxo3oy4ol nlivi ()aDrrurpnu1alxn fetat a2ea( pnu4trenxf ta1faDraivi t0trtm(rpiy1amenlfvsl( aDur(mp;u1open oeiyt s rlnvo t4trerxfciodom rln s;( sexm(mpoydaleemicsl() rraumont4ape mi3tydfmDulnmo (4tetnir ootlaD  n s;(0 ruoio ny1lmtemncs sfsrtrx pnt4tlxoiietldfs2ranmp () eenmr tatfm e i i;t0 2uo(opny4lme mfvi s) rumu ont0ape ifctlslmDeauvp (0texoifcia1lpt  nesl( seuriopiu1op n nvs tfaDrm(moot1alxn f3tltla2ra( p;() leomr3iodlat  ieo s0 rtr(m oodapt  ietat)s2rmum ou1opx micils mDrmn s;()texoio3oodoatr ues () rxoxm ou4apeelnci ()artruronu0tpen fciys m2ua(mo (4arerir tydfmte ieo t)setr(m3iy1ll nmnctat aDtruro;o1tpx  ieiad mDraump;t4 reoir iytopt  uvsl( t2um(o3io4op  lfcil(  rtrxrpot4oltomieiad aDrmump ()artoio io1fpD anesls texrxr oydomtelncias aDtrx o;t4ole moeiadla2emnmp;(0aeermfctodfp eln s;t t2xoim3iudolen fes t s2tmx ont0oetnmiciatla ra(vp;t0trtoxr3oy1omD  uvi t seurxrpoydol nmnesa(f 2ta(rp;u1olto i3tls m2ulu onu0treoxo3todlpDeau s;t sexmiopoudapen fvtlt)artrxmo;o4teenmieiydfa2rl( p;u)areoir3oy1lpDeaiei s trtoiopoydamtn ivilt)sDum(m ;o0ale  ieiatlm ean onu) reomfctytfmt  nvs t0 2ur(mpou1lptnmictas) Dtr(  ;u4tpxoif3iadfm emumsnu0teerir3iodomD luvil(0setrxm nodome lfvi sfs2umxrono4tleoioeias sDeanmpnt) lenxfcoo1fatelivo;( srxrxr iydlptelfvtlt s2urx  ot1teeniieils m raumo;(4teeomf3oa1om e n i ( srxoim iy4op  mieias artrx ono0oleomoetytla el(vpn(4areomo3tydlmt lneo ()s2trim nydaptemnvtat a2ur(rpot0apeo ietatls2ulu p;t4trxoif oatlp eaneils0s2xr(m nudlpt  ivta( a2tmumpou1apto i3iydfaDrmu pnt0arermr3iodlaDe nvo ()t2xm(m3iy4apte fcta()a2rau p;t1tltomfeiasla2ul(mo t0 eeoio oadla  ln o;(0srur(r oo4olenlneia()srum(rpot4tltn ieiltla2uan p u4tlerif iytomDraueo s sruo(mpoudal elncsasfaruax pou0tpxoiieiaslaDemnvo;(0tltrmo3iydopDr i s ()t2trir3nydalt mfcia(  rtm(rpou4texnmiciltlsDuau p;(4aeeoifciydfaDeln ols0texr(opiy1al n netat aDra( ono0olenmfctldfa2rmumo;t)tltnmf iadlaD  ies;s srtm(r3ny4al n nci t sDraxmoot4tetoiiciatfs2emn p;u4aeerir3oo1fp   i o (0seur(opno4lpeelfctl() ruau pot0optoiociat m ua(vo;u)areniocto1fpDeaivols)s2tr(opnodlpt  nvs sf Dtr(m oo0opeo f3tadfm2rm( p;t4areoxo3io1fmte n il(0trtr(r3oudomteliet t sDumxr ;u1oee  i3tls sDel(vs;() eerio ootlaD lieilt)trxmio oy1amt  fes s) 2rmx onu1alenmoctas a2um(ms;u0artnmfcoadla elu i () 2to(o ou1ole mivt t) 2urxmo;u0oeeniicildls ran s;t0alxnmociadfa  lu i t)sruoir iudlptelfctltfsDtmu  ot1opeomfctad sDranvo;t0 lenxf iydopDr n s;t) 2xoimpou1llte ncsasfs2trurpot1ole mo3ilt s emnmp u) eeoir3ootopD livi ()s2xoxm ou4apenmfvt () rtaxro;u1apx ioetytfa2eanmsn(4aeerxfcty1latrlnei;t0t2uoxr oy1alt lieils) Dur( pnt1apxoioeias m2rau pnu4 eerxf3ootoptelieo t  eurir3oudlme mnvi tfartmxrono1openmoeiltfa2ua(vs;t4 reoir iodfaD  neo;s) 2xmirpoo1lp e fcsa( a2tmu  oo1alxniociytla ranvpn(0trxoircto1fptrlneo (0teuoxo oydomeelicil(  Dra(  ou1tpxomi3ias sDrl( s;(4treoir ia1lmDe ueils)t2tmxrpoy4lmtemnvi sfs2trxr ;u1teeoifciytls2em( snt0aeeoxo iydfpDelnvi (0 2xmio3iy4olt  ivtls s2trump;u4tet mf3tas s2uanvp u0 rxrxo3iodoaDe u i;s  2umim oudlmteliesas a2tru pnt0oetnmoetlsla2ua(mp t4trtrmr3totfat aieo t0sexmxr3oodlm n fvslt artmu p;o4oexnioeiat sDuan o;t4 ltomo io1opteauei t0s2xr(m3oo4lmt  icsas) rtrx ono0aet io3ildfaDrmu p t) renio3oo1fatrauvi t0 eurxr3iudll   fcil(f 2rr(  nu4aeeoioeiyt mDumnmp;(0 exnmo3oydoa rai s t0 rtrim3ou4omt mfet ()aDtrxm ;o1tle iietltfa ulumo;() rxnmo tatlmDranes;t trxoxr iu4omte netatfarrmumpou1aet moeias s em(ms;() lxoxo ia1lpDeli o;s)tetrxo nu4ole mfcil( aDrax  ou4oexn i3tyt s el( o;u4aeenmfcoa1fm  aieil(0trto(o3oo1ameelivil(  rrrx ooo4aexnmfcildfsDeaump u0aetrmf3oydlp rli sl(0 exo(m iudamtnlnesa()sDta( oou0ole  octasls2rau p u)alenxf3iotlpt  u ils)trtrir iy4llt  feiatfa2tmx p;u0aetoiieiat a ua(vs t0 rxrmfciytlpDelnei t0 2toxr3nydlmeelfctat s2ua( ont0altnmieiaslmDra(vont)aeeomf iy1omDelivs;s0t2tmxr nudal   ivsas sDtru pno0aleo fcils mDrluvo;t)artrmfctatoat  n o t) euoxopiu4omenmfcsat)srtaxmp;u0olxnif3iad m uanmon()trerifcia1lpDe i o t)teur(o iodam nmfvia()s2uaxmpnt1tlxnmoctadfsDul(mp;u)tlxnmf3oodfmt  nvs t0tetm(m3oy4alenmicia(f rurum nu0tpxo i3iasfm2rmn s;t0arxnxf to1lmD lieo ( t2xoim3iy1oleemncil(f Dua(mono0tlt iocilslsDeanms t4texoxociytoat li i () exmim3oydal  licsas  2ta(rp;t4ole ioeildfm ulnvs t4aeeoif3ta1om   ieil()srxmim iu4openmfcilsf rraxrpoo0tlxomfciatlm rln s (4aexriocoa1la  aivols)sexoio3oo1lp  mncil(farur(m nu0tlx ifeiydls umnms;u4teermf3oydlm rlu s;s srtm(r iy4ole mivia()aDum(rp;o4tpxoiiciadlsDua(mp;t4aetrxf iy1oatelivs;s0 2urxopio4olt mfvs t) Draxmpoo4olen fcias a2uluvo (0altrif tatoaDe nvo s  2trir3oodomen ieilt)srra( o;t0apx iocilslm el( snu4aleoxfctydoatrauei;(0 rxr(r3ny4lpe  fci s sDua(r nu4tle if3tltfmDeauvs;(4 exnxocoodfm  luvs s seuo(mpou4amtnmnciasfsrrmur ;u4aex  i3tlsfmDrm(mp;t4 exrxf iydlat an sls seumio iu4amte ies t) Dra(root0ale if3iasfa2ul(vonu0trxnmfcoa1fm rauvi s  etriopio4lle lieilsfs2rrump;t4alx iieiydla2umnmo;u)arenxf3oa1lm  aivo;s  exrimpio4lm   ivsa(f rrr( pot4opt ifctltfm2raums u4 exoxo3oytfaDrlu slt0 etr(r iu4omenlfctl(fsrrm(  no1tpenmfcilt s2rmnvs;t4treoio3iytlmDr neil( setmxo iodapen nvsltfs2rmxmo;u0olx mieiad s eauvpn(4trxrmrcoodfaDr uvs;t  eurimpou1ll emncta(fa2rrumo;o0aexniietatfmDem( p t4 eerio3oydla e nes;t trtoxr iydlm nlivsls)artm( ont4tet moeiad m rl(vonu0aeerif3oatfp e ueslt0trto(m iu4am elnvtatfa2ra(rpot0teenifeiad aDrmn s;t4teeoir3to1fm r n ol()srxr(r nodlltelnvs sfsDtax  ;t0alt moetasfaDem(vpn()tleomrciydoaDraneo;t)teur(mpoy4altnmnei ( srumu  nt4opto i3tldla2umnvs;t) lxoxo oodlat auei s s2uoirpoodam  mictls) 2trxrpou0opxo o3ild a emnmpn()aleomo3tatlp rlieslt t2xoxm io4lmen ncsls)artruroou1aeeoiietydls2ulnvo (4 reoxocoytlpDrlu slt0 rtrxrpno4omen fcsas sDuaxmoou1tpt  oeilsfs rl(vpnu4 ltrxrcootoa raneils0t2xo(r3no1lp   neias artm(monu0oexn octatls el(vonu0tlxoxr tatfm rauesls trtm(opnu4aleemfeia( a2tr( o;u4tpxomicilsfm2ra(vsnt4arxnxo to1la elnei t srxoxr ny4ap nmncias  2rax  ou0olt iiciad s2ra( o u0trxrxo iy1omDrln s ( texoxm iudam  mfvt ()aDurxronu4tlto ieiyt aDra(mpn(4aexrxr3totlptelieo s0setoxm nu4apen fvilt  Drrur ;u0aee mictldfmDrmnvs;t)tlenmfcoodoat auvs;(  rtmxr oudop nmiesa()srtaurpoo1tpxo feilt m2ul(vs;(4 lxoxrctydopD lu slt0srurir3ny4lmtelieilt)a2trx  nu4tlxn i3ilsfm ua(vo u) etomocoatop rln o ( t2tmxopio1olte nesl(f Dtru o;u1openmietat m ra( sn()aeerxocio1fmteauvs ( sexm(m iy4amt  icsl(  2tr(m no4aex  f3ildlmDrl(vo;t) rxomr3oy1lateai o t0seuoxo3ou4op  lfvs tfsDtm(mo;t1oet  oetldlaDelnms;u4aleoio oytlpt aieolt) 2tmio iudal n nvils srumx  no4oexo i3iys sDulumo;t0aeermf iotlmteaivols0tetr(opoodlp emneil(f Dumu oot1tee  oeiatfs rlums t) rxrmf iydfpteaivo;(  rtoxm iy1lptn fvsatfarrr( o;o4aexoiieilt aDeauvo t0 lenifcoodlm  anvols)texrxopoy1apee feils)sruaum ;o1altn ociytfm ul(mon() lxoxf tadfmtelnvi;s)s2uo(o3nydlpenlnvsls  2rm(roou0apx mfctat aDrmnms (4aexrmf tadlm raivs s)trxoio3iu1lmenlfeiat) rumur nt0tlx iiciasfa2ea( p;u4 rtrif iadfaD au s t) etmim3oy1ame  ivtl(fsDtr(ront0olx  ietltfa2emnvo ()aetoxr3oydoptelivo;(0trxoxm iydll n ici t)artrxmp;t4alen ieiyt a2em(vpn(0 rxnxocoatomte i s;(0trumio iu4lpee neilt  rum(moou1oltomociytla2uauvo t4teeoir ta1om  lneo;()t2uoxmpiydal nmietl( sDum(ro;t0ape io3tyslm elnvpn(4trtoxf3iodfmDr i s t)s2urxm3nudap emivtlt)aruaxr nu4tex  oeiytlsDuln s (0 ltnxoctydomt  nvslt tetoim3iudlmtnlfetlsf Dua( pnu1oeenifeiatla2elump ()aetnxf3ootlatelnvilt setrirpoudapeemfeil(fsruru o;u1tlxnifetytla2ulu s t0 reomr iodlmtran ils trur(r oo4apt  fvi s)aDtaxmo;o1alenmoeiys a umn o;u0trerxfcoytfmD au ilt s2uoio iy4ol elnvtlsfaruru  ot0alt mieiyslm rmumon()aeerir3oatfmt  nei ()t2to(opiodole lfcsl(faDuru pnu0opeo fetldlsDrlnms t) eenif tytlatr ivo s trtrir iudllt lietas  rtaumpoo0oetn fcildfs2umnvs (0tltrxo3totfaDraivsl(0 2to(o3nu1llee ivtls a2rr(rpoo1opxniociysfs2ul(von() exnxfctydlptr neo;( setm(mpiodolt lfetatf 2uaxm nu1aeenmieildfsDul( s;t)arxnxf3oydoptrluvi s0s2xrio oy1ap nmiei (f 2tmum nt0opxoiieiytfmDel( p;t)aexnir oydlat  i o;t s2xrxmpiy1llen nvtat  2rrumoot0aex ii3ils m el(vs;u) ltoir3ia1laDrlivils0s2toio3nu1omtnmivsl(f rtau pnt0alto ociyslsDelnmon(4altoxo iatfpDelneil(  rtrxr3iu1lpe  fvs s) rtrxmp;t0tpt ioetld aDuanms (0alxrio3io1lpDelies;t0s2umxo3iydolt mnvilt srtmu ooo1opeomfeiytfa um(msnt0trxnir3totlp ran olt0seur(r ou4ll nlnvilt)artm(r oo0opx ioetyslsDelnmonu4 lxomrctydfpt auvs;s) rxoimpnu4al   icia(fa2ur(m ;u1teenmfetltfaDel(mo u4trtniocio1op r nvols)sexrxm iy4ame  fes ( sDtrum nu1olx mi3tasla ulumo;(4tltnxocoo1lmDr ies (0t2xrxrpnodapte fcs t)sDtau onu4olxoifcild mDemuvs t)alxnio tydfm e n sls)tetrxopnodlm elnetasf 2tmxm nu1apx io3ilsls2ea( p t4arxrif3tydfm eli s;s) exmxr3io1om nmictat) 2rrxront4tpeoioetaslm emn pn(0tlxoiociatoptean i t0sexm(r3iu4al   nvtat srta(mono1oeeomoeiys a ra(vpnu) lermo3to1fa   ies;s t2ur(o iu4lm nlfvsa()arur(root4alen ieiadls2rm(vp t4treniocootfate nvol( sexoim nydlptnmnvslt arra(rpnt0aeenifeias m elu o t) rtnif to1lmD  iei t0t2xmim iy4omeemnet t arururpnu0oex  icilt a2emumo;u0 rermocoo1fp  li s;s)trxrxrpou1apt lnvt t)sDtmu o;t0opeoioetlsls rlump t4 rtrxr3ootfaD luvsls  eumim iudol elfvt ()aruaxr no1apto ocias mDumump u0 rerir3oodla elivo;(0s2to(m nydopt  fcsasf Duaxrpot4tee iociasls2umu o;(4tetrxo3ta1oaDrai o t0tetoxrpiu1opt livil(fs2rmurpot1aleoio3ias s2umnmp u4trtnxrcoytlm elnvi;s setrxrpou4om e ncilsfartaumo;t0olxnmo3iydla2raumonu)tetoxr io1fatrauvi () eumimpiydol  lnvsasfsDrr(rpno1alenioeils s2ulnvo;()tetrmociotopt luei s) 2uo(m3oo4lptemnct tfsDuaum ;t1tpxo fcild s2rmuvonu)tleoioctotlaDrau il( sexrxm3oodlmtelfvi sf 2trxronu0olx  feilt sDraums t0tleoxfctydomDeluvi t  rxrim3oydlmen nciasfsDuaur ;u4tpenifctasls2uanvp u)aleomf3iy1fateau s;t0 rtrir3io1apte neils)aDuru  no1optoiociasls2rmnvsnu)texomfctotom  lnvols) exoimpiydlme lnvsas  2rru oot1olxnifetasfs2rm(msnt4aetnxf tatlmDr n s t seurio3nu1lm  mnvi t  Drr(  ;t1oeeo ociyd s ea(ms u0artnir ia1fmteanei t0srtrio3oydaleemfcsl( srurxmpnt0tpto fciltfmDumn pnt0 rxomf3ta1fa r nvilt0sruoio io4optnlfcs s  2rr( oot0alx mictadfmDuaumo;(4 leoxfcia1lp e nes t0seuoxm3no1lpenmnci s)sDtmxrpno0ope mfetatfmDumumo t4tleomfcty1lmteau ilt) eumxm iydam  livt t) rra(mp;t0oeeomo3tls a2uluvsn()artrmfciy1opt ai i;(  eur(opiu1lltn nes () rta( o;u0alxoifeils mDra(mpnt)artrxr3iydlaD ai o;(0sexrxo3oy4openmncs t)aDta(mpnu4opto i3ilsfsDrm(vp;u0artrxf iatfa  anvi s)t2xmiopoy4ll elfviatfsrra(mo;u1opxn octydfmDua(ms (4altoxocoo1fmDeanvs () 2uoxm3iu1al   iesl(fa2trxr nt1texn ociatlm ul(mo;() rtrmfcty1omDr nvil(  2toir3no1olt mivt tf rua( pnu1opxnmoetlslm rau o t0arerio3iotfat aieils  rxo(m3nudlmenlnes (  2ra(mp;o4tpxomf3ild m2rau o (0trtrmr iydlaD li o;( sexoxmpoudamee ivt sf 2tmumont1tltnmf3tltlaDemu sn(4aexrxocoytom rlnvs;( t2tmxo3iy1ap  lfcslt)s2taxm ot0oee mf3ilslsDem( s;u0alermo3totlpD anvs s trxmim iy1om e fetlt  Dua(r ;t1apto oeiatfmDrmnms u4teerif3oydom r ivslt  2tmxopiu1lm   net ( srrrurpnt4tlx  o3tat m2umuvpnu4 rtrmrciy1omteln il( trxoxm iodame lieta()aDur(  nu1olxnmo3iatla2uln p t0tlxrxr tadfm rauvs () etm(o ou4ol emnesls) ruaurp;u4ope mocildla2rm(ms;u)aetnxo3oo1latelneo;(0sruoxrpny4olen icsa(  Dururo;u1oleo ietltfa2rln s () eenxfcoadlaD  n o () 2uoir3nu1ale mivil( a2ua( onu0opt  fetatfa2rm( p;u) exoxr3io1omDeanvs;s sexoio3oo4lmtn ivt (f Dtaxm ot1olx mo3tys a um(msn(4alermr iotomDeanvi;s0 2urim3oo1lm   fvsat  rumu  ;o0olt ii3ilslsDumnvsnt)tetoxrciatlpt an sl() rxoimpoy1opt  fvtl()srtru  nt0alxo o3iadls2ulnmpnu0texnxf ty1la eai olt  etoxrpio4alee netl( srrm(mo;u4ole ifeiydfm eln snu0texnxo3ty1opt ln o t0trumir3no1lm  mncsl(  rua( ooo1aleoiietadfs2emuvo t4 rermfcty1fmtrln ils) rumxmpnudoltnlicta() Draxmp;u0oleoiociadfs2ranmo;t0alxomr3oydla rlnes;s0sexo(mpnydapenmnvi t srraxr nu4oeenmf3ildfm em( p;(0tetnifciydoaD aues;(0 rtoxo3ny1lmtnmfeia(f 2um(mooo0alx mfctat m2rmu o t0teeoxr3iy1fmte n s t0 2xr(m3oy1apt  icil(  Dur(  ;t1opxnmi3iasla2ua(vs t) renio3ty1lmDrlueo;( t2urirpoodlp nmfct t aDraxrp;u0tetnifetydfa2rln o t) exnmo ia1oatr u i;(0sexrxo iudlptnmict t  2umxr ;o4openiieiytfs2um(msnu) lenxrcty1fa e nvslt s2trxm3io4ape  ncsls)aDtax  no1oeen i3ild m ea(vo t4aexnif3iotoatrlu o;s  rxoim iy1lp emies ()aDurx o;u1oltniociadfaDrauvp (0 rxnmr iotfatranes;t seum(r3oo1lp  mnvsatfs2ta(mpnu0tptniictad sDra(vonu0aetnmr iadlp r ivils srtmxm iodomeelfvs s)aDum(mo;t0apeomf3tysfs2rm(mon()altomr tadlp rlivi t0 2xrir oo4olee fvtas)srumxmooo4tpxoif3tatfa2um( s (4trxoir ia1opDr nvs t)srtmxo oo4altelfviat) 2ra( oou1oexn ociyt m rl(vs u)treoifciodlpDeluvsls s2xo(o ny4lltelfetat artm(m ot1tleo feiasfs em(vsn()aeeoxr iy1omt  neo;s)srxmxrpno4amtelnesls  2taxr ou0oetoiiciyd aDul(vs;(4trxrio tatlpDr i olt) eurio3oydapt  nvtas)s2tax o;o0oltn o3ils s2emums u) renifcoydlpDeanei (0s2um(rpny4om elict tfaruaumooo1tleoiictas s2um(mo;t4 lenxoctydla r i ils)seurir3iudlmt  neils sDtr(m nt1tlxo ietadla2ulnmon()teenmo3iydoa   u il()t2urxopnu4altnmfcias aDraxmo;o0oltn fcils s2uluvs;u4treoxo3tadomDr nvi;s) etrimpiydamt liesas)arumumpnu0tpeomf3ilt mDrmu o t4aeenio iadfm e nvi;s0s2tmimpoo4lmeelictasf rua(mpot1aee if3tyt s ranmpnt4 lerifciadfate ies;s srtm(rpny4apenlnesat a2tm(r nu0tleoifeiat mDea(mp;()artrio3iydla eaues (  exoxr ny1ap nmneilsfaDtr(m oo0tleoioctytls umn snu4altnir3oodfaDeauvi;s s2um(opno1ap n fcsa()srrrx onu1apeoifeiasla2ean pn(0 rtrmrcta1lpte u i t0sruoxm3oudalt liei sfaDurxmpnu4apx iociad aDra(mo;t0arerxociatlaDr u ilt) rto(o oo1olenlfeiasf 2tm(mo;u1tlxo ietatfa elu p u4alxoxf oa1laDelueo;t0t2uo(r3ny1lmt mivi (f 2rr(mpoo0tlenmo3tytla umuvonu4arxniociytfptrau i t0setrir3oydomee nct (fartr(rooo1aetnmoeiydlm rlumont4tlerir to1lpDrlies;(  ruoxr no4oltnmneilt)a2raxrpnt4opto ociltlm ulnms;u4tlerir3tadopteaueo s trxr(rpiu1llte nesl()sDtrxmo;t0tleo fcild aDulu s u4 exrifcoydfptelnvolt teuoxm3iudlle  nciatfartaur nt0alxo fctydla2ra( p;(4 rtnif to1lmDrliei t0srur(o3no1alte nctl(farrrx ono0opxnii3ildlm2rmu snt4trtrircia1omDrlueo;() 2urxm3nu4ll nlicta( sDrrxm ot1tpxoiictadfsDuluvo () etnif3iodlmDrli s ()srtm(mpoy1oleemnetl()aruru o;u4ale mf3iyd a eaumon(4arermfciytfpDr uei;()srurir ou4al  mfcsl()aDtmurp;u4olen fcilsfaDulu s;u4aexrmfciotomt li o;s teurxopiu4ol e neil(fs2rm(mpno4ope iicils a eln s;t)tltoxr3oodoaDrlivolt0texrxm iy1alenmnvsls)a2rrxr no1oee  oeiyslm2umums;u0artnir3ia1late u i s tetr(mpoo1amt mfeiasfaDumxm ;t1opt  ociyslaDrlnvp;(4aeeomf totfm r ivs;s) 2xo(o ou1amte fct ( srra(rp;u0tpxnii3iltfm2elnvo ()treomocto1lm rlivo t0 2xm(o3oy4ap  lnei t  2um(rono4tlt ifeiatlaDrau p u4tlerif3oy1opt luvolt) etm(o iy1amenmicias)s2rmxrp;t4tlxoio3tydfa eau o;(0altomf3oy1oa elneol()srxr(m3ny1omenmfvt s)aDtmu oot1aexoioctyslaDel( o;() ltnxr tydlptr neo ()teur(opiodal elicsl(  rta(m ot0tee  o3ias a ulnvo ()arermfctotlaDr ivi;(0trumxopny1ale  neslt aDurxr ;t1aex  oetatlsDran on(4aexrmfctytlaDelu ol(0tetoiopiodom e ncia()sDtmumpnt0opxoiictldfs rl(mp;()trxrif3todfa ranei;t s2urim iodap   neia()aDuru ono1tleoiieiatfmDul(ms;t) eeoirctydlmtrlueo s teuo(opou1ole  neil(  Drr(  ;t1oeeo o3ias a2ulnmonu4 rtomo3iy1opD aieolt)texr(r3no1lltn fviatfs2ra( onu0opx  ocilt m rluvp;()texnmfciotfa e uvo;s s2toxr oy1om nlfvs ()s2rrur oo0aex mo3iydls2rau s;t) lxomr3oy1fpD luvs;t) 2xrxo oo4ameelfet t arraxrono4olxoioetad m2rl(vpnt4trtomr iy1lmtr ueo;t)sexrxopiy1olt mneils) Dum(mp;o1oexoii3ilslmDelums;(4texoxf iodlp eauvi;t) exr(rpoudomtemnvtat)aDuax  nu0tpx  i3iadla2ra( o () etoif to1optrluvo s0seuo(m ou1lptnlies tfaDuauro;u1alxo iciat s2emnvp (4altrxfcoydlpt anes t0s2toimpiu4open fvi ( s2ururpnu4altomi3tls sDelumont) reomo oa1lpDe ivi s)teum(rpoudapee fvias)srumxmono1altnmocildfm emn s;u0 lxnxr oydlaD lueo;()texm(opoo1lptnmivi s  2ururont4tltnmfetyd a2rlumpn()tlxoxf iydlptranvi s) rumiopoo4ape  feil(f 2tmuronu0alt mieiysla eauvs;(0 rxoio3oadla ranei t trtmio io4ol  lfcil( srtmumont4olxnifetaslmDua( s t0aetoxo3io1omt au sls)sexrxo io4ap  liviasf rraump;u0oeenmoctlsfs ul( p;t)aetrir todlpD au il()sruriopoudlm e nvi (fa2ta(  ;t1oee ii3iydls2emuvp;t)trxoir todlm ranei;(0trxrxm iu1op   ies s a2rr( p;o4alxoii3iyt a eauvsnu0 rxomr3ta1omDrluvslt  rxmxm oy4op e ncilsfartrxm ;u0opxnifeiyt s umu s (4aeenxr3iydfptr ues;( trurxr ny1alenlivtls s2uau p;t1olt moeilsls2umuvpn(0tlxrxfciydfpDrli olt  2xoxm oy4op elietl()s2ua(r ;t0aetoifeilslsDra( p;u)alxnmf iytfat au s () exoxm3ny1ol nlncs sf 2um(m ou0apx  fetatfsDrmumsnt) lxnmf3iytfmtran i;t sexoir iy4am  lfetl() rrrx  ;o4tltn icias aDem(vs u)tlerxf3oodoat aneol(  2um(m3iu1am nlfcil(  Drax pnt1tetomo3ils a2uau s;t)aexnir3iatoa  lneo t0 rtrir3iy4am elfvtat)sDtaxmpnt1ape ii3tys m2rlnms;u)areoioctytomtr u sls trxrir3nu4lm nlfetlsfsrrrx  no4tlxn ocilt a2um(vs t0 exrio ia1lpD ai sls  euoxm3no4lmeelfctas)artmx pnt1tee  feiytfa ea(ms;t0 renmr oy1lm rlnvo;(0sruo(o3iu1altn fetat)arrmur oo4tpxomi3tld s2uan p (4 eenmf iydoatrliei s texo(o iy1omte nesl(farur(r no4opeomoetatlaDel( o ()tlxrxr oydfpDeaueil( teumxmpnu1am e net t a2urxro;t4tpx ioetasfaDrlnms t)aetoxo3iatoa eauvo;(0 etmxo ny1optn ics s) Drrx onu1aptomfeiysfs ean p (0 lxoir oatlatelueol() 2uoim3iudoptnmneias artaxr nu0tpeomfciytfm rluvpn()teenxo ootfpteauvslt0t2um(m3iy1ole  fvslt)s2rax p;t0tlto ocilt a uan pn()tlenxr tydla   nvs;s)srtrxopny4lmtnmfctl(faDrmxrpnt0alx  ieiat m2rmuvs;u) lxomoctatlp eluesl()srtriopoy1omenlivsltfsDtr(ront0tlenii3tytlmDumnvs (4tetnirciadfpte n o;( tetmxrpiudomenlncsl(farumx oou4alxomo3ilt sDelnmo;t4arxomrctodfa e n i;()s2tm(r3no4lm emfeilt)srum( onu4oex mo3tldlsDel(mpnt) exrmo3iytfmteauvilt) rtoiopnydamtemict () rrax onu4tlxn o3tyt aDea(vp;t)aeenifctydoat auvolt0s2uoiopiu4lmtnmfcsa(farrm(rp;u0teeoiocildfmDeluvont0 rtnmrciodoatrlivs ()t2xrio3no4amtelnetlsfaDur(mpoo4teeomfeiadla2ua(mp;t) eermrctatfaDean i s0sruoim oy1om nlictlsfartru  ou4tet ioeiadfs rmn pnu0 rerirctydop e u s (0srtrxmpou1altemiesltfsDurur ;u0oleoioetlt aDuln p (4trxrxf3io1fpDe iei;() rto(opny4lm elicilt  rrru p;t4aet ioctltfa uau o;t4 exnif3oatopD auvs s)texo(r iudal nlieslsfs2rax ont4aeen oeiydls2uauvpnt4aeenmfcia1lpt  n s s0 rtmxo3iydame mieiatfsrrrx pot4tpe ii3ildfs elnvonu0 exrxo3tydfat lieo;( tetmxmpnu1ame liet s s2um( p;u1tetn fetltfs rl(ms;() ltoif ia1fpDr nvo s0srum(opno1altelfvsls  2ra(r ;o0ape  fetltlsDranvpn(0 renmr3tydlm e ieo (0setmxo iu4omenmict t) 2tmurooo0alenmoeiltfa2rmu s (0 leomoctadlatr u i;s)t2toirpnu1llenmneiat a2rmx poo4aee ifeiytla ulnvs ()tleniociodla elieol(0srumir ny4om emieslsfa2ra(r ;o4oeenmoeiyd s2ulnmo;t0tlxnxociotoa eln ils0 rtoxr3iodoltnlnctlt) 2ua(ro;t1tetnioetytfm ea( o ()teermf tadlmtraiei s) 2trxm iu1am emfcil(fsDtaurp;u0tpx ifeilsfs elumsnt0texrxoctodfp   uvi;t0srtrir nydap   nes ()sDuaumpno1tpxn ieiasfa um(ms t4aexrxo iydfm eaues;s0t2xoxr iodome lncil()a2uru pnu0optomi3ildfa2el(vs t4tlermocoadlaDe i i s0setrim3no4al  mfvs () Dumu pot1aee mo3iad m2umu o;t4altoir iy1lpDe uvo;() 2xoxrpiy4al   nvt tfaDrmur ;u1texoiocias m emums t)tlxoir3ia1lmtrlivil()seuo(m3ou1amt  feta(fa2raump;u0ale
\ No newline at end of file
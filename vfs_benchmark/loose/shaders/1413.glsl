@@ -0,0 +1 @@
+ueol( t2xrxr ou1ap e icsl(fs2ua(r nu4apxnmoetltlsDrlumo;(4 ltnxf3iatoaDeaueol(0sexr(r3ou4opeemici (faDtr(m nu0olx io3iysfsDrlumont4 rtnif ty1fa eau i t)sexo(mpiu1optnmictas sDtax pno4aexo ociad a rl( p (4aetnmociotfpDelieo s0 eto(rpoo4lmt lies s srrrxm oo0tetomo3tydfs2emnmp;(0tltnxo ty1omD  nvslt)s2xrimpoy1apenlfvil(f Dtmur nu1alt mi3iadfs rauvo;t4tleomr iydla rau ilt0t2uoxr no1ol elivtls sruaxm ;u0tlx mociat mDemuvo;t4trxrmo todfp r iei ( sexoio ny1oleemnvs ()a2umxrpou1oexnioctytlmDrm(ms (4tleoir3oytlmDranvi;t0t2trimpiodop nlnvs (fs2rm( pou1aptn oeiadls umnms;()texomoctotfaD  ivo s) 2ur(m oodlmt livt tfarrm(  ou1opxn ociydlm eanvp u)texnmocoy1la  aueo;t) rxoio3nu1lmen ies (  Dtm(ronu0tpxo ictysfs2ul( pnu0aetomr iy1lmDrli i;t0texmirpnydlpen feta()aDtaurono4aleomi3iltlaDel(mo t4altnio todlatraueils0trtmxr3nodlp   ies (  rtrur ou4tetomieiltls uauvs;u0 ltoirctotopD liei t s2urimpoodalt mnei t)srtm(rpou1apeo f3tasfs rlnmp ()trtnxocoatfatrlnei;t)s2umxopiudlmeemfcs t a2tmx  ;o4apxn i3ildlmDuanmo ()trtnxrciydfmte uvil()trtoxr no1oleemnvs ( srtrxmono0tex  ociadfaDrm( s (4 ltnxf iy1oa eli sl( tetoiopio4oltelncilt)srtru pno4olenmoetld sDel( onu0 eenir io1fat anvo (0 exr(rpno4ap n ivt t aDumx pno4alt mf3iatfsDeln o () lxrir ty1lpteau i ()texr(opnudlmteliciatf 2rmumpoo4tptn i3ildfmDum(mpnu0teeomf3oytla eln s;(0teuo(rpio1ap n ictasf rtm(mooo4tetnifciatlaDel(vs ()tltrmf iotfmt  nei t0teuoxr nydolt mncilt arra( pou4alen ieiatls el( p u)aetoio iotlp   neo;t)texmir3ny1ap n fvsasfs2umumont1apxnioctadfm2ua( o;u4aeenif3ia1om r n ol(0trxrxrpou4oltn fcsasfsDuau  nu1ape  feiyd a um(ms (0 reomo iodfatraneilt tetoio iy4am emivs s  rraur no4tpe ioetytfaDranvp u4trxrxf3oy1op ranvs s)teurir oy1altnmnctl(  ruaxm no0tpxoioetlt a rmump t0trxrxo ty1oatr i o t trum(r3oudlpe  feil(  Draxr ou0tpx io3iad mDran pn()trenxf tydfate ivs s)sexrim iodllenmfcs ( a2uaxrpnu1oexnmieiaslaDran sn(0trtrir oytfpt  nesl()setmir ny4amt liesasfs2ta(rp;o4opx  f3ias a2umu s;()trtnmo3todfmDe i i s  2xrxrpnu4llt  ieilsfs2taum ou4opx mociad s2uanvpnt4 lxrxfcootlptrli slt0trxrxmpoydlpenmfvt t)srtmxrp;o4alxn o3iadfs eau on(4 exoxrctytfa e n i s)trtmim iodll n net ( sruax  ;u4tee  feiyt aDel( p;()aleomrcoy1lm r nvs;s0tetoirpno1lle licil(f 2rr(mo;u1tlx mfcild a2ra(vsn(4 lxrir3tatlm  au o t  ruoir3oy4ale mivtltfsrraxrpnu1open fctys mDem( sn(0 rtnmo3ty1oaDrauvs t texrxr3iu4oltelfetlt  rrrxmpnt1aptn iciydlsDemnms;u) renxf3iydfaD lnvs s trtm(mpoo4omee ivslsfsrumu o;u1tleoifetyd m em(mo t0tlxoirciydomDr i i s  2umim3ou1ol e nvtls sDtm( ont1oltnmi3tadfa2rmn s;()aleomf oydfp r nvi;t0 2xmim3io1lm elnvt s)a2tru pot4optn ociydfs rlumpnu0aexrmo3oodoatrli slt  etm(r3iu1altelfciatfaDta(mpot0oeenmieilt s emnvs;u0 lxnirciatlateaneo (0t2tr(r iu4amte ivsls)artrx  no1tpxo o3iatls emnmonu4texnmfciydfm rlu ils)s2uo(o3no4apt  nctas) Dtr(r oo0apt  fciytla2emn p t) eenmrcio1fp r i sl()s2xrxm3nu4lp  lictl( aDrmxronu0altnmociatfaDrm(vo ()tlermo3iytfa  aneil(0 2xoir ny1am nlnei s  rta(rpoo0tle ii3iyt m uln snt0 exrir oatopt  u olt0seurirpoy1al emnesas) 2um(root1oexnmo3tls mDrmuvo;u)arenxf3totfm eau i s sexoxopoodopenmicil( artaurp;o4oltnmociat m em( o;u)areomr oodlmDrli ol(0 2uriopiu4apt mfct ( aDrru o;u1altomf3iltla eauvsnu0artoxf oodfp r u s;(0t2tm(r ny4am emneils  2urxm ;o1tle mf3iatlaDemnvo ()altnxo3to1fm ean s () 2toim3nu1amtnmnci s)srtaum nu0optomicilsfa rm(ms t0trxnxr3oatlat lnes t0 etmxm3ny4apte iesatfs2trxr no0altoiociyd s eaums u0artoif iadop   ies t s2tm(opiudale  nvil(f 2rm(r oo4opxoii3iydlaDul( p (4alxrmr oadlpD luvs s  rtr(m3nudomt micslsf Dtaxrpnu0texoif3ild sDea(vs;u)aexrxf3ta1oa   iei;(0t2urxm3ou4apeemncs (  2rru ono0apx if3iatla2eau p;()tlxnxr oo1lmtr ieol( srumxo3oudlme  ivi ()sDrrxmo;o0tle  i3iadls ea(vo u0altoif3oa1lm   i s t t2trxm3io4llenlnci ( srra(  nu1olt mfcils s2rl(vs;u0artrmrctotfpt lneo t  2um(mpny1lmen nvsat)a2uaurpoo1aeen icildla2ea(mon(4altomr oatfatr nvs;(0tetoxmpoy1ol e iesatf Dum( p;u4tle iociatfs eaumo;t4 lenxr to1fptr ueo ()sruoir3iu4om elictltfaDtaurpot1oex  ieiltla rl(mo;t4aetrir oa1optelivs;s0srtriopiodap n icsasf rra( ooo1opxomfeiasls2rl(msnt)aeenmo3oa1omD  uesl()teurim3iu4ll nmneiltfaDuax onu1olxn fciydls2ua( sn()teerxf oytfpD luvsl(0truoir3iy1oltelnvi t  Dumxro;o1texnmiciydfsDrl(vs t)trtomfcoodom rlies;s)s2to(m3nu4om emneia(  rraump;t0teeo ieias aDrl(ms;t0tleomrcto1oa  ai o (  eur(m3ny1ame  feil( a2tr(mooo1teto ietaslm2rmu ont4trtnioctadlpDrli o;s0 rumxo3iudale lfcsas sDrr(m nu4texomo3iys m2ulnvo;u4 reoxf3to1lmteau o () etmxo oo4lpenmivta() Dtaumpnt1alxnmfetyd s uanms;t)teenif3iodom eau i;(0seuo(rpiydale mnct t)sDuau pou0oexn f3iyd aDranmsnu)aetoxo3oy1fmt aiei (0setr(r3ny1ap   nctat)sDrmxrooo1oexoioetldfa rlu snt4texomo oo1lmDr i i;( srtoxo3ny1apee fvi (fa2rr(rpnt4oexomieilsfa2emnvo;t0tltrir3iotoatraueil(0t2tr(m3nu1apeeliet ( srtmxmp;t0tle  o3tasfs rluvon(0aexriocoadopt aivil( t2xrxm3nu1opee nvs t  ruaur nt1aptnmieilslm2rlnms (4texomf iatoate uvi t)srtrim io4ope lfes (fs2raurooo1opx  ietas sDrlnvp (0treoxociy1laD  u o;s0srtr(r iydlltelietltf Dtm(  nu4apx  feiasls2rau s t) renmf3iy1fa rlivolt  rxmxmpiy4lmtemneiat  Duaxmpnu0tlenio3iytlm umnvo;u4tleomrcoydlmtr nvo;s t2tmxr3oodlmtn ietatf rrm(r no4aetnmfeiyd sDra(vo ()aeeomr3tadfpteaivi;t  2tr(m3oydlmtnmnvtl()a2rrumono0apto fciaslaDrl( o t)alenio3tadfm  li s;t) eumxrpoy1alt lnesl()a2trxront1opt mieild m raumpn()aeenif3iydlm ranes t) exrxr3io1ame  nesasfaDrax  ;t4aeeoii3iys m ua(mo;u0aeenmf ootlm e n i () exoir oy1olt lnctl()artrxmpnu1tltnmf3ilt a rmuvpnu)trtnxo iydfatraneil()srtmxrpno1am   ieil(fa2rru o;t4tpt  oeiad s um( p t4trxomo oatlaDrlivsls trto(m nu1am nmfct (faruax p;t1oetnmfciysls2el(msn(0arxrifctadfpDranes;(0 rtmir3io1alenmnesatf Durx o;o1apx mociytls rlumpn(0artnir oytfp rln slt0srtr(m3iu4om  mfesa() rum(r ou1teenmf3iadla2uln s t)aleoxr to1lp   u i (  exr(r3no1alen nvt ()artax  oo0tlt ifetytlmDrlnmsnu4alermf todop eanvi t) 2xrxo nydamte nesl()srtrxmoot0tee mociyt m2ranms (0tetrmf tytoa e ueolt0 2xrxm ny4lmenliesa(f rtaxmpou1apx iociad sDul( o;()aexrifcoydfp elnvols sexmxo iudale lnes t aruau  nt1oet  octadfaDua( p;(0 eermfciodfa eanei t)s2xrxrpnodlptnmnet s)aruaxroou4alt moeiyt mDemnmsnt0trenxfciotlpDrlieo;t)teto(m oodlp nmfet t)aDrr(  ;o0apt if3iytlaDem(vs (0 lxrio3tadfaDeanvsl()s2xoim3nodlp e fcsatfaruaump;o1apeo oetatfsDrl( o;u) rxomf3iotlmteln il(0teuoxmpoo4apee fvtlt) rumxr ou4apt moctltfs eaums (4aeenmo3ootfateanesl()trxoim3ny4ameemfvt t  rrrum ;t1texn fciysls2umu o;u4alerif3oodom r nei s)tetm(r nodomtelncta()s2umuro;t0tpeomi3tydlmDumnvsnu0 etnxo3iadlat  i sl(0truo(m3nudlp  lici t) Drmumooo0oetnif3ias aDrmnmo t0 rxoifcoodomDe ivsls0 etoim nudalte ncil( arurxrpot1aeto feiyt s emnvont0aexoif3oytlp elnvi;s0sruoxr ou4ape lnvt t) rumxr ot1optomoetat m emnmon(4 lerxr3to1fmt  ieilt) ruo(m iu1om   fvt t) 2rrxmooo1tle  o3tys mDrlnmp t0tleomf3iytfm   n s s)s2tmiopoo4olee ivtl()sDraxmo;o1aeeomictatfm emnmsnt0 rtnmocia1lptr u o;s  exrimpiodlltnlictatfa2ta( p;o0tetnmietldfaDeanmp;u0trtoir3todoaD anvo (0trtr(r ou4llenlieias)sDtaumpot0optnifetadlm2em( p;u)areoxr tatlp r u o;s s2tmxr nudlpe lfcs ( sruaxm ;o4apx  feiatfmDem(vs t0texnifcoatlmD auvil()setoxm3ou4omt licil() 2rrxrpnu1tpenmociytfm ua( o;(0trtoxo3iy1lmtelivi ( s2toxo3io4am e fvs sf rrr(r ou0ope ifctadla2emnvp;u)aeeoxf iatopDeau o (0srtmir3oo1llt lfesasfarumumpnu0apx  i3iyd mDeaump t4texnio oadla r ues t  eurirpno1amtnlnetlt sDrmxmo;u0oetomfciydla2eanvo t0 exrmf3ia1lmDrlnvs;(0t2xoxo iydoltnlfetlsfaDtm( o;o4apt if3tys m2ul( o;u)tltrir oydla  au s;t sruoxm3nodalee icsa()srtru pnt0tex mi3iadfaDrluvo;(0alenirciytoateluei;( srxr(rpou1amt  iviat)aDtr(rpno4oetnmfeiasfaDrmnmo;()aeenmf3ootfate ivo ()sruoxopou1al nmncia(f rtr(  ;o4tltnmi3iysfm rmuvs;()arxrmf3ty1fptrauvols t2xriopoodameelnct ( aDta(mpou4alxn f3iytlm2emuvo ()arerifciy1fat au i;s  rxrir ny1ol   nvs t) 2tmump;u4tlxoiiciyt mDemumpnu4tetrmrcoodlatrli o;s)srurimpno4lleemieta(fa2rm( pnt1tlenii3iadlm ul( o;(0trerxr ootfmDrauvols s2urim nu1al e ieils) 2trum nt0tptomietat s rln p u)texrxo tatopDeanvi;() rtm(o oydlpte icsa( arrmu pnu1tet  f3tat s elu s t)tlerxoctotla  luvo (0setoirpio1llenlfeils)srraxmont4tetnmi3ias a2rl(mp;t4artoio3to1om r nvo;t  etoxm3iydapt  nci tf rurxr no4oeeomf3iatfmDelu on()tlxoir io1om elivs;s sexoiopio4apt  neslt  rtrx o;t4apxnmi3iydla um( on(0 rtnmf3iodfa  aues;s)srxmxm io1olen nvtl(fsrtmu p;o1olxn i3tydfa ua(vo;t0tetnxf3totomtrau slt tetrir3nodaptn ivsat) 2urxm no4tee ioetldfs2uluvs;(0aetnxr iotopt livolt0 2xm(m nydolen fcs () Dtmumont4tpxoiietat s2umu s;t) rtnmocoy1fmteaivilt texr(o3nu1ape mict t)a2taum oo4tle if3iadfa ran p;u0artoxf3ootopDe i olt)s2toxo nodoptnmictltfsruau ono0tpx  o3iat sDulums;u4tlxnif3iytfm  aivo;s0t2xr(r oodlm e fesa( arrm(monu1apt moetadls eanvsnu0trtoifciadfpDraivsl( tetmir iudlleemnvi s)arrrxroot1aet ioetyd a rluvs ()texrmf iadfmteaivi t0srxo(rpiy4lmeemfctl() Dtrxrpoo4aptomi3tlsfa eaump t4arenxo oytfm eanei s)s2uoxr ny4aptn ncta()sDtrum ;t0optnmietys s em(mo u4arxnxfctytfa rlnvolt0 exmxo3oo4lmtelfvi ( aDtr( pnu0apxniiciasfsDel(vp u4aetrxr3ootfp eluei ()sexoxm iodom e fesl( a2ta(ronu1apenmfeias mDuluvon() eerxrctodla   u sl( s2uo(o iu4amtnmnvi ( s2ur(rp;t0tpto f3tld s ean p;u)tetnioctydopDranvi s0s2xoiopiodolt lfetl(faDtmxroou4altnifeiys mDran o u)treoxo3oy1latrau o ( truo(o nydom eliesl(f 2tm(  ou4aptnmociad a2el(vp;u0artrmo3oytfm eai i s0truoir iy4opt mivs sfa2tmu oou1aexomfeiys s emn p;t4tleoxrcootlat ai o;t0 2xmio3no4lp elicias)a2rrx p;t0oleoio3iatls emnmpnt4 rxoir3iytfa ean i s sexrim3oy1apen iesatf 2tax ooo4tlt mfeils s2rm(vp u0 rtomf3ta1lpD  nvi s0 rumimpnodomte fvtl() 2rrxrp;o0alen iciadlmDrmu p;t)texoio iotfp eli i;(0trtrimpiydamenlneils srrrxm oo1aleoioeiat a rm( pnu0trxnmf tytfp  aiesl() rtmxmpnu1al e iei (fs2rrxmpnu4tlx io3ild a2el(mpn(4 lxrxo io1laDe ues;s t2xrxr ou4open fvt s s2trx pnu4alen oeiltfm2uln p;t)trenxf oa1lmt  nei ()trtmirpny4lpeelfvs s a2tax ooo0tlxomfeiysfa ulnmon() lxrxr io1optraieo;t) etrxm nu1amtn nctl( s2tr( p;u0apxoiicilslmDel(ms t0teeriociydlmDrlnvi;s srtmirpiodlptemneil(  2trxrp;o4tptnio3tas a rlump;(0 lenxo3oy1fm   neo t0s2xoxo3oudol elfcs sfs2rau pou1aet mictlsfaDeau p t) lxnifciydlmD li i;s tetrim io1opte nvt t  Drr(rpnu4tleomieiaslm2el(vo;u0texoir tytfaD li o t)sexm(mpoo4amtelnetl()srrau o;t4ope mf3tltfa rln pnu0tlxrxrcta1lpDrluvslt)t2xrim3no4om  mfcsl(f Durx pnu1tetn f3ias aDra(mp;t4 etrmf ta1opD  iei;s0seurxr oy1apen fetlsf 2raurpoo0tet  fciatls rl(mp;(4tlenmo iadlpDrlu o;s)srtrxr3oydlle lnetasfsrrr(r nu4tltoiocils m rmnms u) leoio ootlatranvslt)t2urim iy1lm  lnes ( sDrr(mo;u4aptomociyslsDemnvs t)aetnxf3io1oat luvs (  eto(rpoydoltemnes sf rta( o;u4tee ioetlsfa emnmp;(0tlxomo3totop   nei s srur(m3nu4ale  fvtasf Dtaumpoo0opxnmieils m rl(mont4alxnxf ootfm   uei;(0t2urxo3oudlm   nvtlt srtrxmp;o4tpxomi3iyt s rl( p u4teerir3iatopDrau o;t) 2tmxm no1omtelnvi tfsrtrx  ;t0opxomiciatla eln pn(0 lxrmocto1la   uvo (  euoxrpny4aleelncs s)srrm(rp;t1apeomoeildlm rmump;u0 lxnif ty1laDelnvs ()t2tmxopnydope mivta(f 2rmu  ou1opeoio3ildlm eauvo u0texoxo3iodfm   nvsl(0teumirpiy1lpt licsa( s2taumoot4oleomoetls s2elnms;()altoxrctodlmt li s t) etm(r iu1al n nci s sDuaxmo;o1oeto ietatlsDea(mp;t4tetoif3oa1lpt luvil(  ruo(r3io4ale lictlt sDtm( pnt0oet io3ildlaDuan p;() ltnmr tydlmtr n i (0setoxm3no1opeemfesas  rrmu  ;o0tpx  f3tasfmDemumo;t0 ltoircoy1fate i ils0sruoxm oodoleelfcsa(fs2tr(  ;o4opto fctasfa2umnvs;t4aexriocta1faDrluvo ()t2to(opno1lpe mfcta(  rua( o;o4tpx mf3iad s2ua( on()teeoxf3iydfaDeln s;()t2trxo3oydlp emivsa() 2taxro;o4optniictyd mDean s;(4 exnmfcio1fatelueo;s) 2xoxrpio4lltnmfei t)aDtm(monu0olt io3tydla rlnvs (0 exrif3totlm r ivs (0srxrxr3nu4lltn fetl(fa2taxr ;t0aee  i3iydlm rluvpnt) lxnxo3iodlaD aiei;s srxrxr3nodlmen fes sf rtru pot1tleoifetydfm2rmn p;u0aetrxocootfmD luvi;s)s2xmir3no4omee icta(faDurxr nu1ope mfctld a2eau o (0 rtnmf oy1fmteaueol(0 2umxrpno4lptnlnciasf 2ur(m nt0tetnio3iad aDrlnvs;u4alerxr3ootlp eanvsl(0sexr(rpou4ap nlnetls) Dtaxr oo1oex  ieiasls2em(vpnt0artoircio1lateau o t teto(o iu4aleemncia() 2rr(ro;u1optnmoeiltfaDeanvp;t4tltnxrcoo1lpD ai s t seuo(o iy4lmtn ncil(fa2trx p;o4texnmietldfs2elu p;t0aexnmo3todlpDrlu ol(  etmxr no4omt mfetlsfa2rmuronu0opeo i3iad s ranmp t4altnmo3iatopt au ol(0srumio3iu4lpeemicia(  rrrxm nt4apxomiciat a2ulnmo (0tltnmrcoadla  lnvil( teur(rpoo1al nmnctlt s2tmumpno0opx iocilt m2ua(ms;u) exrxr3tadfm   i slt)sexmxo nu1lpt licsl()artrur ou4aptoiiciysfm rmn s;()arxomr3todlpDrluesls  exmxrpiodapenmicsa(fsDta(mpnu4oexoiieias m rmnvs u)tetnxr oy1om   nvs;t0 2toxo nodlmeelneia( arur( oot1oeeomoeiatfs rlu o;(4trxnmr3oydfptrlnvo;s seurxm3ou1amenmfei s)srta( p;o4oetomfciad mDrm( o;t4tetrxr to1oat  nvilt trurxr iy4am  mncta() 2raxroou4opxnio3iad m ul(mo;t)altoifciy1opteauvo;t0texr(r3ny1lpee ics (faruaxmp;u1opeo o3iadla ulnms;u0 exoxr oa1lmt aneo;(0t2urim oy4om elfes ()arua(ront1olt mf3tysfsDul( o;t0tleomr oy1lpDr n i ( srxmim3ny1oltelfvilsf Dtaxm ;o4alx  i3ilt s emums;(0teenxrctotfp   nvo;t0 rxm(rpoo1am e nvsl(faDrrxr ;u4alt if3ias aDea(vp;u4 lxoxr iytlaD li i (  exo(o io1ole mfvsasf Dum(m no1tlxnifetat s rauvpnt)teeoxo iydlpt an i (0 etoxmpiy1llt mietlsf Dua(m ;u0apxnifctys mDelumo ()aexoiocoo1op  aueils0sexoxm io4ll e ivi t)s2ua(r ;t4oeenmictls a uaumo u4tltrmr iotlpt li s;s sexo(r3ny4lm  lietas s2tr(  ou1oee  i3ilsfsDuaumo;(0arxomr3tatfa ranes t teumxr ou4om nmivs s)aDtau oot4aetnio3tatfmDuau p;(4artnmrciodlm r ivo ( s2trxo3ny4omee fcsa(fsDrau p;o0apenmieiat m2ea(mpnt)aexoxocto1lpte i s;(0srto(o nydal emfvil(  rrr(m ;t4olxnio3tltfs2uluvsnu4aetnxfcoytlm elnvi;s0 rtoio3no1lme mfciat) Dumxrp;u1oeenmoctas mDrm( o;t) exoxf3iadlpDraieo t0sruoim3ou1ap nlncil( sDraumo;u0openiociadfa2el(vs;()teermr iydfpD lieils0 rxo(r oo4oltnmfcsl(f rraurpnt0olxo f3tyd sDeln p;(0aeeniocootfa  lnes t)sexmim ou4omtn fei t a2uru pnt4tpenmociad aDul(mo (4texnmr oa1lmDrlivol(0sruoio nudlm nliviat  2tr(r ;o4oee ii3iysls2emump t0 rtoir3io1omtr nvil(0 exo(o3oo4om nmnesas)srtau oou0tpxniociltfm2ul( s;t)treomf ootfa eaieols0 rtmxm nodop nlfcias  rtmu  no1aeenmoctys s2uau s u4tetrif3oa1lpDe iei;t tetoxr ny4lptemictat a2ra(rooo0aex  ietatlm ul(vsnt0tlerio3oa1la r uei;(0 rxmio3oo4om  lnvtat srrrurono0tptnmoeiat a2elnmp;(4tlerif oytlmD  nvo () 2uoim3iy1omenmicia(f Dtrxmoou0apxoifciat m el( o;u)tltnxo3oo1lp ranvs;(0s2xmxmpnu1op   nvslsfaDururp;u0oltnifetys s ran s () lenmr iodfmteaues;s0trum(r io4omenmivsasfaDrr( ont1alx ioetadlmDuln s u4 lxrxf3io1fmte iesl(  rtrio3no1ome  fcsls)srrmum ;o0tpeomicilsfa elu p;(0 exnir3iadfpDrauvslt srumim3nu4om  lfet (  Drru p;o4aeeo ieiltls2rlu o u0treomf3iadoateluvs s0 2tmxm3iu1ol elncil()a2rrx pnt1alt  o3tyt sDemnmo;u0altomocty1lp  lieols srxrxr oudlpenmncsls) Drm( o;o4aex moeiaslsDulnvpnt0 ltrifctytom ranes t0seurimpoo1lme lnesatfa2rmumont1oexnmoctadfs2ulu o;t)trenmo3tytfmDr nvs ( texmio oo4al nlict t sDrmxr nu1ope  o3tydla2raump u)aexrxr3iodlmtr n i;( s2trirpiu4lptn netatf rtm(mo;t0tex  f3iysla2rlu p;(4 ltrircio1lpDranvi t  exmxo io4op   ivsatf rurx ooo0tpt mieiyslmDemnvsnt0texoxf tytlmD  u o;(0s2xrim nodlle mnetatf Dtr(m ou0tpxn o3iatfaDeanmo;u0 ltnxoctydfmtran i;s t2urio no4ol  mies t) Dur( o;t0alt mo3iydfm2elnvp;(4texrxf oadoaD  ivo;()seumxo3oo1op emies (farua(  ot0oetoif3tadfaDra(mpnu4 exrio3tadlpD lnesls trxmirpiy1amt lnet tf rraumo;o4apxomietadlaDra(ms ()trxoxr3oo1fa  luvo;s)trxoirpiu4am nlietl()arua(mo;u1optnmociyd a eauvo;t)tltrmf3ty1fpt  ivs t trxmxo io1am elivsl(fs2ua(r nt0aetnmfeils s um( p;u0tlenifctadlm elivs;t srxr(rpnodlptnlfetlt aDra(roou0oex mf3iaslmDemums t)aeerxo3oo1lmtr n s (0 rxr(mpiudlle mfct () Dur( ooo4tee moetatfs2um(vp;()aexoif3tytop  lueo;s truoxo3oudal elivt () 2tm(  ;o0oet mieiad m2emnmonu4trxrmr3todoa ean ol(0teurio oodoltemfvs ( s2raumpou1aptomoetyd m ua(msnt4 lxoif3tytfm elivol( s2trir3no1openlnciat)sDurxmo;o4ope iiciltls uauvp;u)trtnir3to1fmteanesls0 rxriopoodaleelnvs sfa2urx pno0tpeo ictyt mDuan on()tlenxo3iydlmt auvi ( s2uoim3oydalt lict (faDuaxmo;t4olxnio3ias m rlu p u)artnmrciytlatrauesl(  rtmxr oudlmte nesas)sDtm( onu1tptnmoetydfm2elnvo u4tltnmo3oytlmDr u s;t0trxmxm3iu4ope mieia(  Dtm(mont0oet  ietad s eanvs (0artoircoadoa rai i;( t2uriopny1lleemnvta(fsDrmuro;o1alt iieiysfaDrmn s;t0 rtniocootfm elnvi t)srurir3iydlp  mncsls)sDrmum oo1oleniiciat a2eanvs;(4aeeoxo iadfpte ivo;()srurxmpou4amtelfeiat  2tr(  no0oex moetat m umu sn(4altrxoctotlaDe ieil(0 etrxo oudalt lfetas a2rru ont0tpx  ieiadls2rl( pnu0teermrcta1oaDrau ilt srtrxrpny1alen fct ( sDtm(r oo4olenif3iat mDelums;(0texnxrcoytomte u i ( t2trxmpoy1al nmnctls  Durx  nu0oet  i3iasfs ran o;t4tlenxociatlp r uvi;(0 ruoim iu1ape  neias) 2rmu  ;o4tlxo iciatfaDrm(msnt0teeoxrcto1fpD lu i s t2xo(o3no4am elfet t)s2tm(rono1aee mf3tatfs2ran s;t)alxoxociatfa e iei (  rtrim3no4alte nctls)a2urx  oo4aexo oeiatlsDuan o t4 lxnmocoatlmteluei;(  rur(mpiodlmeelfci (  rrrxrp;t0oeeoioeiytfaDrmuvp;(0 ltrmf totopDrlieilt0 euo(o3no4omen nvt ( a2ua(mo;t0tlto i3ildls2rlnvs;(0 rxnxf3oadfatelnes () 2urxrpoo4ame mfviat  Drr(rpnu0tpx mieilslm2uanvo (0trtnirciatfm rln o;t  rxriopiy1al nlfct tfaDtmxr ou1apeoif3iadfaDrlums;(4 rtrmociy1lat  nei;t)trxrxo3io4op  lnctatfsDur( p;u1alx ioeiadla ranms;t4altomr3tadop rau s t0srumxr oydame lfci tf rta( p;o0opx mfetydlm umnms t4altoiocoadlat li sl( texr(m iy1al e ieslt aDrau o;o0ale  fetasls2ulnvsn(4tetrxf3tadlaDe n il() exm(mpoodome liviat)srtmu o;u0aex ifeilt a2ean o;t4arxrir oodlmteluvslt0s2xmio3nodaptnlncsl( a2urur oo1tex ifcils s uauvp;u0arxoirciatomD  i ols setmxr3oydal elici tfs2ur(m ou0aetn f3iadfa2rmumont4artrmf tytfat  i s;( texmxo io4olenmnet t  2tm(mpnu4openiictlsfs2rm(vo t0teeomr oodlpDeln sls) exm(o3no4al elnvs (fsrra(  nu1opxniicilt mDulu pnu0tltnmf3tytfpD liei;t) rtoxr oudol  mfetasfs2taurp;u1texnmi3iys m2umnmp t0 exomrcoy1fpDe n ils0sexm(mpoydamtnlfvs t  rumxro;u0ale mfeiaslmDrauvs;(0alxoiocoy1laDranes t0 2uo(r3iy4lltn ics s  rra(mpot4tpxo f3ilsls2ranvp ()aeerxrciatomD  i ol()trto(m ny1lmtnlncsl() Drr(roou1opx  fciat a uanmpnu4 lxnio3ootoatrliesl()t2tmiopiydap nlicslt sDtmx o;t4oeeniieilt sDrmumonu)tlenxr3ta1laDe i o;s0t2urxr3iy1lmtnmneiat) Dtr(rp;t1alen i3iys aDea( s;u0treoif3ta1lmDrli o;t0srxo(r oudlpe livil()arrm(mpot4oexomf3iasls2ulnmo;u4 rtnxf iytlpDr ues;()srur(m oydlp nlnvs tfsDuauroou1alx  ieildlm uaums ()artnxf tatfmD an s;()t2xrxo3no4llt  fvtlsfsDta(r no1tltnifciyd a2um(mont4arermfciytlatrlivi;()trtmio3ou1om  mfvsl( a2um(r nt0aeen o3iltls eaumo;(0trermf3todfp eai s;t0trxmio3io1ol e fvi ()arraxro;u0ole ioetytls el(ms u)artnxrciatop  aiesls0 2uoxmpou1amt liesa()sruaxront0olenmf3iytfaDulnvsn() rxoir3iotfpDraues;s0s2umxr iu1ol n fvtlsf rtmxm nt1tetnifeiatfm2ea( o t)arxnmr3ty1oa e neslt)sexr(rpiu1oleelnvs tf ruax  nt0tleniiciasla2uauvo t0 lenmr ootla eln slt t2uo(rpoy1lmtemnei t) Dumxr oo0tpxo ociyslmDua(mo;(4altrxrcoatfpt aies;t0 rumimpoy1lptn fesl(f Dumx p;t0alxoioetldfs ua(vo;() etomocia1oaDeanvsl( t2urxmpno4lp   ivsat sruax ono4aetomietadlmDul(vpnu) renxocoodlaDeanvs () rtr(mpiy1lpenlfviatfarrmx pnu4apxn i3iltla uauvs u)alenifcto1op eluei;s t2xoxopnu4altelictlsfsrrr(mono4apeomf3iltlm2rlump t0tltnxf3todlmDrai olt0srxrxr3no1aleelnei sfsDrax pnt1apeoiiciltls rl( o;t0alermfciytfptelies t)s2tm(o nudlltelnvs t) Dtaxmpno1alxn fetysfsDrlumo u0 rxrir3totom  anvo;(0s2umir io4om  lfeia()a2rmxront0oeen oeiadlsDran s u0aetrir tatlpteaueo;s  2uo(m3oodll e ieias s2raum nt4oex mfcias mDemnmp;u)trtnmf iodfaDelivs;() exrxm3oy1apeelfei t) Dtmu onu4tpe mfetasfs2rmums;u0teerioctadfm e ivo t) rxmio3nudlptemies ( a2ur(ronu0oeenifciadlmDeluvo;u) etnmfciodlaDe i ils srxriopiy1am nmfcsatfaDumxm ou1teenii3iltlaDelums;()aeenir todlatr uvs;t0 rumxm oo1om   ici sf Drrurp;t1tlt ioctas sDrmuvsnu0tetoxr3oa1fm e ivo;t texoxrpoudap e neia(  Dua(mo;t0opxo ietld aDum(vp u)artnmr to1op  lnei;s0srumiopny1om nmieta(fs2uaurpno1oleoio3tld mDuaump;u0 exrif3io1faDr i o;s seuo(opny4olenmieias aDrau  ou4tlenmfeilt m rluvs;u)trxrmf ia1faDrauvs;s sexo(mpio1om  lfeta(  2ua( onu0tpxoio3iydfm uluvo;u4 rtoiociodoaDr uvol(  euoimpoudopte fvils s2uaxm ;u4olxnmieiasls emnvo u0altoio oatfpt auvslt s2xm(opou4lpenlncsl( sDur( p;u4aleoiieiltfsDrmnvo ()aetrxf3iy1optr uvi;()t2toxo3iodope mictls a2rrur oo0oex iociyd a eln pnt4 etnio3iy1fmtraivi;t  rxrxo3iodamte ies t)arrm(mpou1opxnmieiatfs el(vpn(0 eermo iy1lmt  u s;t) rur(opnydaleelfvtatfarra(mono1aeeo iciyd a uan s u4alenir iytoat  uvo s  eurxrpiodaptnlies t aDuaxm oo4texn i3ils a eanmpnt0arenxfcta1omtelues t sexoxr iydolen ivtat  Drau pot0tpen o3ilslm2emnms t)aeermo3tydlm rlnes;(  rtmirpiy1amt  ncilt artmx  ;t1oex  oeiadlaDemuvp (0alxnmr3io1oa ranes s0 rtoxo iy4lmenmiet ()arua(mp;u0ale  f3iydfa2rau pnt0 eermo tytopt  uvi;t0srtmimpou4am  lnetas) rraur ;t0optnmoeias m2rl(ms (0tetnmfciatfmDr nvs (0t2xoim3nudlmt mnet ( s2raxrpou0opto f3tat a2eanmo;()tleoiocoy1op  lues;s0t2xrxo3no4apenlivi t sDrm(m ;u1teeo ietas m ra(vs;t)aeenmociy1fmDe i s;s seuo(mpny4omenmncsls a2urxmpot1opxn f3iasls2rluvo;t)aeenio3oo1lmDr uei ()t2umiopiu4lle mnes t  2uru pnt1alxn fciltfm2eau p (0areomr3tydfatelueils0setmir iy4oltnmnviat a2umxmp;t4tlt  i3iltls2emnmo;t0trxrmr ta1opDe nvo s0trxm(r3oo4opt lfes s)a2uaxro;u1oee mi3tls s2em(vs ()artomrcty1late u ilt  eum(r3nydop  lnei s) Dum(r no1opxomfcild m2ean s;u0altnxf oydomDe u i;t0 2xo(m oy1om elnetls)sDurumpnu4teto octldfmDuanvs ()texomfctodlm eluvo s0s2xrio3no4llen netlt) rrmu  nt4tlxomieiydlm ul(vsn(4tlenxrcio1fmt aieils)teuoir no4ale mneia(faDtrumpot1teeoiiciyt s ul(mp;u0aexoifciy1fmtr ies (  euo(m ny4omen ncsls  Drm(roou1aet mi3tatfaDuauvp;(0alxoxr iadfp  aieo;s  rurio3nu1al n fcsl(  2ta(m oo0ape  octadfm2ulnmont4alerifciatlaDe i o ( sruoxm oudll n iei sfaDtaxr nt4opt  ociyslm ea(vonu4arxrmf ta1om  lneo (0 2tr(r3ou1am elfet t) rur( pno0aptniietldla2ranmp t4altomr3oo1fmt  ues;t)tetrxr3oo1lp nmnvta(  rumumoou0olx miciltfa2ulump u)arxrircta1omDeanvi;t)texo(opio4al elivtat)s2ur(ro;o0oet iiciatla2ua(msnt) rtoxr3totomtr ueo s t2uo(o nodomtelnvilt) rra(m ;u0ole mfctyd s2um(ms t)trxoir ootlpDrau ols tetrxr3ou1optemnctlsf Dumx  ot4apxnmfeiys mDua(vo t0 leoio3oo1optr uesl()srtm(r ou4op e ncia(faDta(rpoo1aexnmfetatls2uaums u4 exrmr tytoaD ai ol()t2trir3nu1llt mfctas)aDtru  nt4tetn o3iytfs2emnvo (4aexoxf to1faDeau o t t2xr(rpou1lle mnci ()a2umum oo0olto iciydfmDumuvs;()tlerxf3tytom e nes s)t2xrim oy4am  lfvtat)aDumum ;t1tpenmi3iltlmDrluvo;t0aetrxfcoodlpD an o t) eto(opou1omt licsl()aDtaurpnt1oleoii3iydfm uauvp;u4 rtrmf3tatfp eli s t0texr(r oy4alt mncs t  rraur ot4tltoii3ias aDea(ms (0aetomfcootlm  aivs (0sexrxo nudap elfvsl( a2tr(mpno0texn f3tys aDulumo;(4 rerir3iy1laD  ieo t)s2xrir io1alen nesas artaxmooo0oltnifctasls2eanvpn(4tetrir3iydfpt lueo t) eurxo3oo1al elnci t)s2umx pnu4opxnmieiadfsDemnmp;() etrif iatlm elnvils)s2toxopoo1alt lieslsfs2taum ;o1teenioeilt s uauvp;t)aetoxo3oodfpDelnvo;( sexrir oo4llt  nvs tfaDrauro;o0tex if3tys s2rau o t4alxnmr3iodopt  u ils)truoxr3no1ll elnctlt)s2ra(rpot0tleniocilslm2uluvs;t4 lerir oo1oa  ai olt0trurxmpnudlm e iesl(f Drmu  ot1opx  fctyslm2um( o;t4aetnmocta1lp elu sls0srurir iu4op  miesls  Duauro;t4tpxoio3iat aDulnvo t4aexrxo iadfat ln i t  2uo(m ou4lmen fcsls)srra(  ;o1apxn ietyt s rlnmp (4 leoxocoodoatr uvo;t) rum(rpnodll  lfct tfaDrrur oo1tlx mfctldfa um(vs;u) lxnmf3iotlp rluvs;s)srxmim iy4lmtemnvt (fa2rr(ro;o1tet  ocilt m umn pn(4 ltrxr to1laD lu s;t  2trxo3ou1op n ict s)arrrxr nu4opxoifeiytfa ra(vp u)trtrxf oadfpt lneo t0s2um(opoo4olt  ieiat s2rauront0apx mi3tlsfaDumn s;t4alxoif3oatomDeanvils0 2xmxm3oydomtnmivtas)s2trx onu1opxnioctysfm2ul( ont0tleoxfcoatopt lnei;t trtrim oy4lpe  fcsas) Durum no4oet if3tasla2emu s;t) lerir3tydlatr uvo;t sruo(mpoo4lltemfvsa(  rta(ronu4aexnmfetatfm rm(vsnt4 eerxf3ty1fp  lieo;( s2uoxm no4ll   ncia(f rtmu oou0oeeo fetytfa rauvp;u0trenioctadlmDelneo;( s2tm(o oodol e fcilt srumu pnu4olxo o3iysfm2ranvonu0 etoio3oydlmtr ues;t) rxr(o ou4ole mfetl() 2tmx p;t1teeomfetldfa umuvs;t0 lxoio ia1lat li ils)srtrio oo4ope mnciat)aruaxr ou0oeeo o3ilsla rm(msnu) leoxf todla rluei t0t2urimpou4lp   icsltfa2tr(ro;t4aeeomoeildlm2umnvsnt0 renxf3ootlaDelnvi (0trxoim3no4lltelietat aDrru ont0apenioeiadfs emnmo;t0 rtomfciatfpDelu ol()s2um(m io1olenlfei s aDuaum ;u0tlenifetatfa ra(mpn(0texoioctatlpt  uvil()s2xoxr iy1alee ivsat) Dumu o;t4oex  f3iydla rln p t0artoxocoy1la rln s;t  rxmxr oydapeemivs () Duaxrooo4tle  i3tydfs2um( snu0tltoxo oadlp  anesls sruoxo3oudlltn fciatfs2rau  oo1tltoioetls a2ranmonu0alenxrcoatfp eluesls) rtoimpoodamenmfet s srurxrpnu1olxn ociaslsDum( p;u)aexrmo iydfat  iei;(0texo(o3no1ameemfvt t srumxm ou4altoiictytlm2el(mpn(0arermr3oatfm  ln o;s0s2uoim3oy1lmtelnvt s arua(rp;t1tptoioctyd sDran o u0trenmo3ta1op elueol(0trxm(r nodame mfetlt) Dumxrooo4alt mieiltfsDrl( o;t) etoxo3ta1lpteanvo;t0 rum(o nu1oleemicsas) 2umx  nu4aet if3iatfa2rl(vp u)altoxfctytlmD lieo t0trtrirpny1opt  ics t)srrau  ;t4ale moctldlm elnvon(4trerif iytlpteauvo s t2tmimpnu1olte icsa( sDtau ooo1tleoifctatlm2ua( s (4aleoxr oy1lm elnes t)seurio3nydole lnetltfsDurxmo;o1optoifeiadfa2um(mon(0alxoxrcio1fa elnvs;s0seuoim3ny4apt mnvsltfarra( ont1ale ifctysfm elu o;()tltrmociytfmtrluei;t t2uoir3oy4lleemfcs s a2ururpou0olen feilt m2ra(mpn(4texomo iotfateaieslt)trxmir3nu1am e fetls)arraumo;t0tptomf3ilsla rau pnu) rerir3iy1faD  ivo ( teuoxr3iodom n ivs t arrm(ro;t0tptnmo3iaslsDum(vs u)tetrircoodfa  lueo;t)seumxmpoy1lm e fctlt aDumuroou4apt mi3iytls2rmuvp;t4trtnxr3tadfmtr neilt) rxoxo3no1lmte fvsa(faDuaumo;u0tpenio3iatfs2rln s;u4 lxnmr io1lpD auei;s)texoxmpnydamen nvs tf rtau  nu4aet  iciys a2rmu s;(4altrmf todlmD livs;t s2urim oodlp nmncsasfaDrr(moot4optomf3ildla um(vsnu4arenxoctytfp  lnes;()srumxo3nodll e nct () 2tax  no1tet iocilsfmDuln s;u)trxoio iotom rlivolt s2ur(o3nu4lpte nvs ( a2tmx  ot4olx  f3iytls ulnmont4arermrciytfaDrai ols0 2xoxr oydal elncsat)a2rmxm ou4aetnmfctasfm ra(mpnu0trtoxo3todlat ai s (0s2tr(o3iy4omeemfei ()artau onu4tpxo fciytfm emu s;(0tlenxocta1fmtr ieo;t) rto(m3oy1omt lfci s)arta(mpno0aex ifctyslm uanmp;u0aetomr3iadlmte n i s) ruo(rpou4omtemnviasf rua(rpoo4aexoiieildls elu pn(0arxrir todoatr ivo s  2toiopoydame
\ No newline at end of file
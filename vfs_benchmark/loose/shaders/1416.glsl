@@ -0,0 +1 @@
+i ols t2urimpiu1apenmnviat)a2umumpoo1texnif3tls m ua(vont)aetomr oa1fatr nei s) exm(r3ny4am nliei t sDua(mono1alxo fcilsfmDuauvo;u4texnxfciadoptr ivs;s  rxmio3nu1olee fct sfaDtr( pno0apeomfeiatfm2emnms;u) exrmo3iotfmt luvils srxrxr3oo1ap nmfetas srum(mo;u0aexniicils s2rm(mo;t0alxrmfciotoateau o s)s2xm(m no4aptnmivs (fs2ta(mp;o0tpt  fciyd mDuaumo u4tetoxrcta1oatrln s;t0 rto(mpiu1am  lncta(farur(mpoo0alt  octytfs ra(vo u0aeerxfctodfpDelnesl( s2xo(m3oo4openmfcta()s2rrxm ;t0aeen i3tasfaDrmuvonu0 rtnxr3ta1om ran slt  rxoirpoydal e nviltf Drrxroou1texnmf3iad aDea(mp (0texomf oytla   ivo t0 2xoxr iudaltemneiat)sDurxr ;t1opx  i3iatla2rmuvo (0texomocoydfat ai i;( srtrim no1ll nmiesat)aDumxr nt1tee iieiys sDrl(ms u4texrifcio1lptrluvolt  eumxr nudap emfei ()srtm(monu0oetn feiydla rm(vpnu4aetniociydfa eaueo;s0sexm(rpio4oltnmivsat  Dur(  ot1apt moetatlm umuvp;u) renifciodopDranvi s)texmxm3oydaltemneilsfsrtr(  ;u1olto o3ildfaDelu snt4texoxr3iydomDeauvols)s2xoirpou4ll e ivi (f 2rrxmpou4oeeo f3ilt aDelu snu0 rxoxo3oa1lm raieo;( sexrim nodlpe  nvs ( aruaumont0tpeo iciytfs2umuvo (4 rtnxfctatomtr ieo ( srto(r iu1ll n fctl() rraumpnu1opxnioeildla rlump u4 leomrcoo1omD an il(0t2to(rpnydopen fvsl() Dtm(m oo0tle mf3ilsla em(ms (4 exrxocoytoaD aneils  exrio oy1ape mfetas) rra(roou4tetn f3ild s2rln s t4 exriociy1fmtr i sls0srurxo no4amtn iesat arurump;o4ole  oetas a rl(mp (4 lenioctotfatrauvol(0 rxm(rpio1op emfeta() rtmum ;t4olx moeildfsDel(vs;t0 lxrmo3ootoa r ieil(0s2toio3iodlp e ics s s2umurooo1opeo f3iydfs rauvp u0 rtnmf iodfa r ivslt) rumxm3iu4omeemnesl()a2tmur nu4aet iieiytfsDeluvo;u4aexrmf3ootom e uvilt)truo(mpoy4lpenlfvtlsfsDtmxrp;t1olt mi3iytfa ul(mp;u) renmo tydfmDeai o;t srur(o3oy1amen ictat  rua(mpno0tlxoifetlslm2emu s u4artnmo oo1optranes;s) rxmxm iodomtemfetls)aDumxmont1oeenifciatlm umu snt0 exoifcoy1fat an ils  rxoio3no1altemfcsat srta(m ;t4alenif3tys a elu on(4aetniociatlaDe ivs;( seurio nudllte fct s sDurxrpot1tlxo octadlm rl( o u)texomo tytfaDr uvolt texmio3oo1opt  nctls s2tr(r nu1tet ifciyslm2el(vp (4trenxr3tytfm rlneils  eumxrpny1amt  ieia()a2um(mooo1aexnmictas s2el(ms ()aeenxf3oy1fa elnvol(0teumxm ny4om emfct sfsDumumpou4tpxo fctasfa2uauvpnt) rtnmr ta1opDr n sls)srtm(o oo1am   fvilt srrm( poo1alen ietadlm2umu pnt0arxrir iy1lptran i s0 2xoxm3iu1ap nmiciltfarrau  ot4apxoifetyt m2eauvsnt0 rxnxr totfpteli ols0 exmio3oy4am emfci (fsrta( pno0apto feiys aDul( o;u0aeenir oa1laDrai i;()texoxmpiydapeelfvtlt) Dtrumpnu0aptnmo3ilt sDrluvont) etnmrcoytopDelnes;(0s2xrxo3no1op elfci sfsrua(r ;o0oetn ieils a2rlnvpnu0teermf3to1omDeaivs s) euo(o ou1ale  iesat  Dtmuro;u0opxo fcildla2em(vpnu)texomf3ta1fm   neo;(0tetoxrpio4altemncslt  rumu ono4altoio3ild s2elumsn()trtomo iotomte uvsls0tetm(r3iydal emfet t a2umu oot1teeo ieiys s ean s;u) etomo tadoat lnvi;s)trxrxopiu4lleemfct s)sDtmxr oo0teto i3iad sDua( p;t) reomf3ootfp eluvi s0 2umio3iu1amt mivias)srur(rp;u1tex  ociydlm2umnmpnt4aetnxr3oo1fpDelivols0trtmxrpiudap   fvia(farur( oot4olt mietat a uauvsnu) etrmr3totfmDelnvol(0s2tr(r iodamt mietl()sDuax  no1opeoiieiltlm el(vpn(0tleoio3oa1opDraieilt sexm(m oydlltemies sfsDurxrpoo0oex mictls s uln s;(4aexoxrcoatfpDrluvo s) 2uoim3nodlltnmnetat s2taxr no4opeomietadls ra( o;(0tlermf3ootomtrlivi;( trtmxrpou4oltn ivtat) rtmxmp;u0oexo ociydls2ulnvp (0 eerxf3oytfaD anvs () etrxm nu4optemfcs tfaruau  ou1olxn ociydlsDea(mpn(0 ltoxr3iadomD anes () rtr(rpou4lp emnci ( a2um(rpou4texo i3iatfm2umn o u4altomr3oatlatrauvs;() rurxm oydlmeelfvtas  2tau  ;t1opt iocildlaDul(vp ()aeerxfciotomDeauvs;t0texo(r3ou4llt miet t  rtaxm nu4oeen oeiadfsDel(vpnu0tltnxf oy1lp e n il(  eurxr iydlp  lnetls a2rrxmoou1teeoii3tlt m elnvont)texrxr todomDr ues;( s2um(o3iy4lpte fvs sfsrtr(rpno0olx mf3ias a elnvp;(0tetoxr to1lpD lieil(  exr(r3iy4amt mivs s artmxmo;u4oleomocildfm rmuvs (0tlerio3todfaDr iei ( t2xrio3oy1ol n nvils)aruaumono0apeo fciadlaDrln p u) lerxfcoatfmD anvo;(0s2uoxm3nydlp  mnvsls s2rrxr ot1alt  f3iltfa eanvo;u0tetrxrctadoa rai o;(0 exm(m3no1ome lncsltfsrrrx pou0texoif3iatls el(mp (0artrmr3ootfmDeln sls  exm(m no4ap n icilsfarum(m nu4aet  ieiyslsDrlu p;t)alenir oadlp raneil() rtm(mpiu1lleemnciltfarta(mooo0aeeomfeilsfsDrl(ms;u)areomf3iytlmtrai olt s2xoir3nudoltnlici s  rrax  nu1oexoio3iydlmDelnmsnt) renxr oatlp elivo (0teto(opiu4lm   nvtl()aDrruro;o0oex iociysls eaump u0arenmr3iytfateaivsl(  rur(r3iy4apee neta( sDtmxmp;o4aee  ictysfa2ulu o t0 rxnir3todlp  au ols)srxoiopny4llee fvias) 2rm(monu0oeeomoetyd sDemu s;u4tltrircoytfpD aivo;s  2umxo3iodlltelnci ()sDtr(r ou1alenifetyd sDum(mo u4 exnmf3oydfa elnvi;(0sexm(mpoo4om emieia() rum(  ;u4oex ioeilt s2em(mo t0 leoir3tadlm r ivslt)trxo(opou1om  miesat  rumu ont0tex iicils a2ranmsnt4aeeoxocia1lm e n i s  2ur(o3nu4opt mnvsat sDurur ;t1tpxo f3iydlaDemu s;u4 leomf3ty1latrai ilt0trxo(rpnodlp   nesa(  rrrx  nt4opx  ociyd s2rmn o (4alxomf oy1oaDranes;()t2to(o3iu4amenmfctas s2umxmo;t4oltomfetyd a rl(mp;t)trerxf totopD lieol()trxoir3ny4opeemnvtlt  rurxrp;o1oeto ietyt a2uauvs;u4tetomo3tatfaD aivo s)setoxm ny4ll  lnvtat  Dua(  no4aeto i3iysfs umumo;()arenmo oydoa raieo s0srxmxr3iy4alenmieiasf rumxr ot4optomi3tldfs2emn o (4arxrif3oy1lpD  nes;( texmirpiu1llen fctat  Dtrxr nu4tetomfetatla2um( p;u4aetnir iy1fmtelu sl() euoxopiodomenmicsatf Dua(mpnu1alx iictydlsDumuvp u0 exomrctotoptranes t0 exmim iydaltnmnvtl( arrmur nu0tpt  fciyt a rau o;t4tetnir tatfmteai sls0sexmxm ou4open ieil(faDtaxrpoo1aeto oeildla eanvpn(0aetoxrciotlm  aivs (0t2tr(rpoo1amt livslt  rtmx o;o4aet  o3iydls2ua(mpnt0alenmo oa1lmDelu ol(  rxrio3oodape livi ( aDuau pnu0tet ii3tlslmDum( on(0 eerio iadlatelnvo (0 2urxo iy4ome lncias sDrrxm ;o4tltn ictadfmDrmu s u0 lermfciatoa eanei;s t2um(r io4lmenlfvt s  2rmxronu0open o3tadfsDeluvs;() rerio3tatlpDeli sl()srurio3ou1al emfvt ( artm(rooo1alenmieiltfaDea(ms (4tetrxo3iydfmt lieo s)teuo(r nydop emfesas)aDrm(  no1oeeniieiasfa2um(mo;u4 rtoxo3tadfmD lieils seuo(r3ny1lm e fciat) 2rmx  ;u4tee iieiydfa2ean snu4trxnio3to1fmD  neol(0setoiopoy1al emicta(fa2ta(mo;u1olen oeiasla2rm(vp;t4 etoxrcoadoaDr u ilt0seurxm3oudale lieia() 2urxmo;u1opeomfeiadfaDra(mpnt4trxnxf3totom elieo;t  etmim3io1lme livs s) Dum(m ;t1ope mfcias s2raump;()tltrifctodlmte i sls) etm(r oudal  mnviltf 2tmur ou0aetoiictldlm em( o u4trtrxo3ootlp eaies t  ruo(opno1ll nmicsls) Drrurpot4teeoiiciys a ulu s u) exoxf3ta1oaDr i i;(0 2ur(rpoy1altemfcsatfa2urxmpou4tpxoiieiydls2ul(mo;t) etomf3iydop  lnvs s)trxo(opiudale  ivs tfaDumxrp;u0openmf3ias mDrln o t0alxnxo3oatomte n s ()s2xoxopiydom nlncta(fartmx o;o4tlt  iciatfaDulump t)teenxf3oodlpte neo t0 2toxo3iy1lltnmnvsl( srurur ;o0tpt mictyt m uanvon() exoif iytlate ivo ()sexo(m ou4om nlfcs ()aDra(r nt0opt ifciltlaDemums u)arxnxociy1laD lneo;( s2tmio3iu1lmt  nviasfsDum(rpnt1aexo i3tytlmDul( onu0 lxnxfciodomDe u sl(0 rtmio3iudlm  lfctlt  ruauroot1tpe moetld m2rmuvs ()altnxf3oydlmteln slt)t2ur(opno1ll  mies s)srumuro;o4oleo fetys m el(mp u) reoir3iytlmDe nvi;(0 rtrir3iudoptnlictl()srtaum oo0opxnio3tat sDrlums (0arxrxocoytlpt  ues t)texoir3nodlpt licsl(  2ta(rp;t4opt ifciasls el( p t0trxnmo3ootlptranvs;t)s2xr(m nu1aleelnesl() Dtrx  ot0tltomo3iat s ea(vo t4 rxoio iotlmDrlueolt0s2urxmpiy4am  lfesasf rra(mp;u0tle miciad s ran snt0teenmf3todopD ai slt  2urxr ou1omt mivil( sDur(  ou4aeenmo3iyslm2uaumpnt0 rtrxociydfmDeanvs;( t2uo(r3io4lmte fctat sDrru pou0tltnmoctasfs uanvsn()altrmrcoytfm e n s t)s2tm(rpno1alen ict s  Dtrx  ;o1apx ioeiasls2uluvp t4texnxociy1fmtrlueol(  2xoio iy1alt mfesat srumu  ou4tltnif3tlslsDrm(ms;t)tetnxrciatfa eaivo;s s2trxrpou1amt lnei s)arumxmo;u4aet iictysla2em( s u4texoxo3iy1oat lieslt texoxmpnudlm nlncs s a2tr(mp;u4opeoioeildfmDrl( p (4trtrirciadomDelneslt0trur(mpiy1ome miesas)a2urxr ;u0alt mo3tytls rau o;t4 rerif3tadlmDrlu i;( t2uoim3oo1oltelncs sfsrtaxm nt4tpt iociyslsDemn p t4 rtnxr oy1late u s s)srxmirpnu4ll   ncsa( srra(rpou1ale  oeiyt m emn p (4 ltrio iydoaDelnvo;( s2tr(m oy4lpte feilsfaDtaxm nu1oltnmociasls uau onu) etomf3iadoa raies;t seuo(m3oudal emncsat) 2ra(  no1oetn feiadfa2rlumsnu4tlenxrcoo1lp  livo (0sexmxr3oudam e nvias srumxmpnt1ole ioctat s2ul(vpn(4 rtnxrciy1faD aueslt0teuo(rpnudlp e ncils  rra(rpoo0oetnioctaslaDulnmo u4tetriociytla eaiei s trxm(m iudaptnmfvsat  2rmuroou0olxnmi3iyt a2eanmo u)trenircoa1fm rli s (  rxrxo3ou4omeemfci t  Dta(rp;o4tlenmf3iatfa2emn p (0alxoxociadoa eli o;t texrir3iy4ome mneilt aDrmumono0tlxoif3ild m raumo (4aeenir ootopD  nvs;(  exo(o ou1op   icsatfsDraxmoou0aet  oetldfmDrl( o (0altnmr ty1fpte n s;t s2xm(m3io4lpee fcsl()a2tr( p;o4apx ioetatfs2emnvs t4 eenmf oytlm  au o;t0setoim3oudlm elies t)a2uaumonu0tlx  f3iydlaDrmn p u)alxomfcoytfa eauvs (0s2uoxo3ny4lleelfvsl()arrr(  oo4altoii3ilt a2ulnvs t4artoxf3oodlatrln olt)srumio3io1om n fctlt a2rau oou1aetnmieiltfs umnmp;u0artoir iytoate i i ( srtm(o oo4ome  iesa() rtrxroot4apx mf3tadlm2raumsnu) rxrxr tytlaD  neils)srtrxopio4ape  nctls srua( oot1tpxnio3iadla ran s;u0 leomrcoatoaDeauvo t tetmimpoydaleeliciat)srurxmpno4tlt iietatfsDeau ont)tlermo oy1fm raiei t0 rtoim oudoptn ici tf Duaurp;u4ole iieilslm2rm(msn(4aeerio3todopD aieo (0 rtrxopiu4olee nvsl( sDrrx oou4tltniictyt m elumonu0aexrxf3to1fm  au sl(0seumir oydlpeelivi (f Dtaumpno0aee  i3tlsfs rmnvp u4trxrmr3to1fmtrai o;s0 rxoxo no4llt mnvils) 2trumpnu0olen feiadfm eanvp t4 rxoioctydlmt  uei t0s2xmio oy4ope licsat sDrmu  ;o1tlto o3tatlmDuanvon(4 rerxrciatlmt  uvi s0teurxo nu4omenlivtls) rtmxr oo4apx  feiasls uaumsnu4areomr to1opDe i sl(0s2ur(rpou1amee ivt sfs2taurpno0teen i3tadfa2elu p;u)alxomf3iadlaDeln i;(0 2tmxr oo4am   fes t) rrr( pou0tpen f3tatfaDea(mp;(0 lxrio oo1fa eluvs (0 etoxm iy4omtemnvsls sDtr(r nt0oet io3iat s ua( snu0aleoir ty1om rlu il( s2uo(r3oydoltelnetlt s2uaxr ;u0alt mfeiaslaDua(vsnu) ltnxociytomDraivslt)t2toio3iy1aptemfetltfs2rm(r ot0tpeomoeiydla ua(mont4 rtomo3tydfa r n o;s0 2xoxmpiudapte fvta()arumu p;u0aeeomiciysfsDran s;(4tlenxociadfm raieol(0srur(m nodlpen nvsl(fs2umx pno1ale mociat m2rmnvs;u0 lenmoctytfpt auei ( setrxo ny1lmeemnetlt aruaxrono4oet  i3tyd m2uauvs u0 etnxf3tytfp  ln s s trtr(r3nu4ll elfcsls)arrm(rp;t1tpe mictydfs eanmo;u0aexomr tydlmD ai o;( t2xrxr3ou1omee ictls  ruaur oo4aetn f3iatfsDulums u)alxomo3oatom eaneilt0trxmir3nu1llee ieta(  2taumpnt0opxnmociasfsDum(mo t4 rermr3to1late neolt)t2tmxopnudaptelncsat)sDrru poo0aex  o3iatlmDrl( s;(0alxrmoctadfmD luei;t0setmxr3oo1omenmfes t)arur(  ;t1tpe  iciyt m rl(vo u0 leoio3ia1fmDrau o s0teto(m3iy4amte neil( arraxr no4tleo i3iyd s rlnvp (4altoxo3oytlpDrlivi () 2um(o iu1lleelnetatfs2trur ;t0aptnio3tadfa uaumo t4 lxoxf3oydlp  lnvols)s2xoio3oy1amenlnei () 2tmum oo1tee  ieiasfaDemn s;u)arenmo iatopD livil() 2xmio oo4ope  nvs t artm(mp;u4tet moctldls2ul( p;u)alxrir3ia1fm rai i;t0 2xmim3ny1lmeemfvia(fa2taumono1tlen f3tysfs2rmn o u0alenif3iydlpDeau o s t2ur(opnodllen neil()s2trum no4apeo ieiyt m emuvp;t0aleoxoctodlmD lneo (  etr(rpiudlmtnlnesl() rrm(mp;u4tltn fciadfsDumn s u4tltnmocia1laDraueil(0tetrxmpiu1ll  lneias  rrr(rp;u0tpeomfetysfs2el(vp (0 exrifctadlaD aneo (0t2trir iodlmt lies tf rur(r ;o4ape ioeiltlsDrauvs;t4 leoxr iodfm rlieo s)t2urxrpiydlp  lnvsat) 2trxr ;t1texn i3iytfm ulnvs;() lxomo3ta1lpD  ueo s0 rum(rpio1lpen ietatfarrau pot1teenmfcild s ul( p;t) etnmf3ootopD an s ()srurxopou4lle mietasf Drrxm ou0alx mfetaslmDrmn s;u)aeerif3todopte n ils0 euo(o3oydome  icsl(f 2tmxmp;u0apxomoetydls ulnvsnt)altrio3oatla  li s;(0trurxm iodameemfet t) Drmu pno1ale moeiltfs2eanvp;u0alxrxo3ootfm ean ils)tetmir3oy4om e iet sf 2rrurpoo1aeeoif3tad a ea(vsnu4arxnxocoytfptrlieils)t2umxrpiu1amtemfesl(f Drax ono0olenio3iatls2ra(mo u4 eeoif oytopD auesl( seuoxr3ou1ll elnetls a2tmxr ou1tpxnmoetasla ranmo t0 eeoxoctatfaD  n s;()srxoxrpiu1ap nlfvt ( aDurxm no1olxn fcias m2uanvs;()texrmf3tadopDrauvsls t2tmir3io4omtnlfci ()a2rm(ronu4alenif3ilt sDumn s;t0aleoir3oo1oatranvol()s2um(rpou1altnmfei () rrr(  no4oetn i3tld mDeauvpnt4tlermfcta1lat lieol(0sexo(opnu1altnmfvsl() 2trxmooo1opx mf3ilsla ra(mpnu0aleoxf3tatom  ai slt0s2um(rpio1lm e ietas) 2urx oot1tpxo ieilt a2em(vs u) lxoxrcootlp r u o ()t2urxr3iydlp  lfesa( s2rruront0oexnii3iltla uaumpn(0 exnir3totfaDr ivo (0s2urirpoo1lp n neil( s2urxr ;u4olxn f3iltlm2ua( snu4 renmfcoodoa  ln o;s) 2tm(o oy1am emnvsl(faDraumont4aet  o3iytfaDuanvs;t) exoifcta1oatrauvi s sruoir iudlp nlfci sfartax  nu1tetoii3tlt a2rm(vs;u)tlxrmrcoo1lm r ies;(  2trio io1am   icsat) rrax  no4apxomfciyd s2eanvs u) exnio3tydfmDe nvo;s0 2xmxm3iydalen fvs s) 2um( pnu4teeo o3iytfa2ea(mo;t0texrio ty1opDeauvi;s) etm(mpnydlpte ncilt  2tmurpoo0aetnmoeiysla2umuvp (0 leomr3iydomtrlueo;t)seumim oydom  livsl(fsrumur ot4oetoioetyt a em(vp;t)aexrxr3todlaDe u ols0 eum(opnu4opt miviatfa2trurp;u1texo fctatlmDem( snu)tetomo3iy1laDelivo;s) 2trxm ou4open nvia( srurxro;o4tet moctytlsDul(ms;t4teermr oytfaD lueil() exm(m3oodlltnmietatfsDumx  no4open ociysfm2rlumo ()teerxo oytomtraueo s  exrxopio1lm e fcsa(farra(mpno4tpxnmi3iydla eln pnu)altnxo3ty1op  lu i (0srumir3iodam e nvt sfa2uau p;o1ape miciysls umumsnt0 eeomfctytfptraieo;( s2urxopoydame miciat arumx pno1aet mo3tydfaDuauvsnt0trxnmfcoytfpDeluvo;s)trurxrpio1ape  ieiat  Drm(rp;u0ole mf3tas s eau ont)trxoxr oa1fpte nvs;s)texm(r iydlmeelivs t) 2ur( pou4oetnmieiasfm ulnmsnu)tlxoif tydlm  lnes;(0 2tr(m3iodapt mfciasfsDta(m nt0opxomi3iydls ulu p;u4arxoiocoatfp  lieo;s s2toxm3nu4ope mnvsls) 2tm(m oo1aex if3tas aDran s;u4 rtnmo tatfmD anvs s  exm(r3oodal elfcsat)arrm(ro;t0aptnii3tytfs2rl( s t4 leomrcoydfmD  ivs s)trxoxm3no1ol n fcsl()aDuru pou1tpxoii3tytfs2ra(vs t0tleoifctadoa elieo t0 etrxo nydapee neiat) Drrxmpnu1opxn i3iad mDrl( o (0 leoio3oy1op   uvo (0 2xr(opiy4optelnvi () 2rmx  ou4texnmociysfmDul(vs u4 eerxr3oa1optranvo t0srxoiopou4llee iet s  ruaxr ;o0tpe mfeils m em(vsnu)altoif3iotlp   nvsls sexo(r no4amtnliesas) rtmx  ;o1tlen oetydlmDrl(vpnu)altnmrcoa1lptrlnvo s srurxrpiu4lmenmivtas)a2rm( ono1apx if3iatlmDea(ms ()teermo3iodlp   ies t) 2xoxmpoo1amenlies s)srum(mo;u0oexnmoeiaslm ranvpnt0 etrircia1opDr nei;t0 2toxo iu4aptnlfvsa()srumuront0opx ifetatlm2emn p () exoxo3ootomtrli o (0t2xmim3iodlpeelfvias arumu  nu1oleniietatlsDum(msn()aetrmf3oatfpDeau s s0trum(m3oo4lmt  fvt (  Dtm(mpnu4ole  ieias a rmn p ()alxomfcia1fp rlu o (  ruoim oydaltn nciatfs2um(  ou0tpe ii3iadls2ua(vs;()tetomf3iy1lm  livilt)seto(o3oudlp  lfci t arrr(mo;u4opxoif3tyd m um( o u)aeenxf oy1fmtean o ( trtmxm nodlpt mivsa() ruaxrpou0aet mf3tldfa emnvo u)trtomfcoo1laDrluvo (0setr(m ny1ll emfetatf 2rr(r oo4tleoif3iydlm2rmuvp;u4 rtniocia1omDe ieo;t)srtmxm nu4al nmiesat)srtrxmpno4oexnmoctydfm rlnmo u0aetrircoatoat livs ()trtrxmpoodalen fesat  Drmxm nt0altoioetldfa umnms () exrmr3iydla e u ilt0t2ur(mpnu4lpt mnesl(fsrur(  nt1texn ictyslaDua(vs u0tlenxf iy1lmDeaieo;( srtr(opnu4ol n fcilt)aDurxm ot0tee ioetad m2uluvp (4 eeoxf3oadfpDrauvsls0teur(opoudlm emnci ( aDtmxm oo1tpx  oeiydls um(vo;()arenxr3iatfp rlu i;(0texo(mpoy4alen nesa() Drrxr nt1oeeomfciyt sDulu o t4tltrmfctytfaDean i t) rtm(mpiu4lme lnci s aDtm(mpno1tpen oetaslaDulnmpnt4trtnif tydfmt  ieil( srxm(o3iodoptelivslt)aDtaumo;t4apt moeilslaDumums;t4aexoxrciatomteln ols)teuoimpno4om  lfetl()sDua(rp;t0olxomi3tlsls2uau s;t)trtoxoctodfmDrlu slt texrio iy4olen nvt s) ruau pnu0tptnmietysfs2emu o;(4 ltrxr3oa1fatrai s;s trum(mpno4op nmics (  rraxro;t1teto oeiytfs2eanvo;t)teeomo iodom   uvo;s) eto(o oo1op emies t) Dua(moou1tee mf3tat m2uanvont)alxnmocootop eln slt  rxm(mpoy4altn nesat) 2tru p;u1oeen oeiadls umuvp u0altomo todop r uvols0texm(o3nu1lltelncils)arrru oot1olenmi3tys aDumu o;t0alermociatfaDean s t0 2tm(o3io4lp  lfcsasfsDtaxrp;t4oltoii3iadlm2umnvsnt4 leoxrcta1faD auvi;(0 2um(mpoudal  lneiat aDtm(r nt0oet ifeiatls2uanvs;u)artomr iydopDrluvi (0 2xrxm3io4amtemivsl( s2rrxr ;u0tptniociasfaDeanvp ()arenmr3iadfaDr n s;s  exrir3iu1al nmnei ( s2tr(moou4oexoiieiytfm2emuvon(0artrmfcoy1lmtrlivsls teumxopno1lle  ivslsf Duau poo1tptomf3ilslmDel(mpnu4 ltoxocia1omDr nes ()srxr(o oo4amtelfci tfaDtax poo4olto f3tltla2um( s;t0trxrxfciotfpDrai i;(0sexoxmpiodap elictl( srtru  ;t4tee mociytlm em(vs;u)trtoirctytomtrli o s)srtrxo3iu1optemfci t  rraumpoo0altniieiytfa2raump u4alermo3tytlmD auvo s  2uoxo nu1lmt mivtl(fsrra(mooo0openmietatfs2ea(mo t0 eeoif3ty1lpDrliei s s2xmiopnu1lmenmnvtat a2tr(  ;o4tpen octatfaDuauvo (4arenmf todop eanvs;(0s2toxo nydop  mfetlt) 2tmxr no4aeeo octls mDrau pnu4arerxr ta1lp ean i;(0t2trxo io4amt lfci tfsDurxmpnt1aexn oeils aDemn p;u) exnmr oadoatr neil( s2xmiopio1altnmfvsat s2rr(mp;o4opx  icildfm2rmn p;t)altnio3oydfat ln s (0s2xoim ny4ame  ncilt sDrmumo;o4tpenioetltls2eauvsnu4aleoxr3oa1oa  aies;()teumim iu1oltelfciat) rra(mpnt0altnmoeilslm2rm(vont4trtrxoctytom   ues;t0 euo(opiu4lptnlfvslt)a2tmxr ot1apx io3tadlm em(vs t)aetrmf to1fm e ivilt srxr(o3oydalee ivtls artrurp;o1alenifeiyslaDrlnvp u4tetoio3iadlmte ues s t2xm(o3oodopt lnviasf rta(r nu4altn ocildlmDul(mp;t0 ltrif3iodfmDrln s;s)s2xoxo oudole mfvi t)arrmu ono0tex moctysfmDeauvs;(4 ltrmf3oytom rau il(0 rxr(m3nu4olte ncsa(fa2umxm ;t4olxomiciydlm2uanmo;t4tlxnmrcia1lmt ln s;(  2urxopiu4opeemivt t)artmx o;u4aeeoiicils mDea(msnu4trxnmocta1oat lneo (  2um(r ou1al emfvsasfa2tmurpoo0aptomi3iyd a2em(vo;t4 lxrif3oy1fpt  i o (0seum(mpio1lpen fesa(fsrumxronu1opeo oetas s ulnvonu)trerio iy1fpDrau ols teuoxo3nydlleemicsl() 2tauro;o0olen f3tatfa uauvp;u0 lenir oytlp e uvolt0 ruoir3oo4apeelivtas)artru pnt4aptn i3iaslmDum( p (4 rerxo ia1omDe uvs;s0 rxmirpny4op  livi t)s2ur(  nu4texn i3iys mDrlums;u4alenmf todla raies t0s2uoim oudlmt  fvsl()sDra(  no1tetn f3iltla2eanms u)trerxf totopt  uei (  rxr(o nu1optn feiatfsDtmuroot4apx mfeiys m emnmp;() lxnxf3todfpD  uesls) 2umxmpnydop nlnciltf Drrxmpot1olenmi3iysfa rl(mo t4 eeoxf3tytfa eai olt truoim3iudopte fcs sfarrm(  ou4aetniieilslm ua(mont4tlenmocta1la  lues ()s2xrimpnodape lfvslt  rrrumo;t0oex if3iltfmDua( pn()tlxnmr iydoatr ivsls) euo(r3iydale lnvtat srtrxmp;o1alxoioetyslm2ra(vo;(0 lerxoctodfaDeliesl() ruoxr3oy4ome micsls) Draxroou1apx  feiysla rln p u)aeenmr3ia1fmDeli s;s  2tmiopiudoleelfet (f 2tmx o;u1aexo icilsfs ranmonu0 exnif3todfmt lnes;t0 exrim3io1olen nvtatfarrru  ou0oee mietldfm2eau snu0aeeoif ootom e ies;s setr(opiu4lle lncs tfaDrau p;t4teeoiieiasfm2uaumpn(4tltnmo totlm eanes (  eumxrpnudalt mnvtl()aDtmuroot1apx ifciytlsDulnmo u4alenxf oy1optelu i;t)trxmimpny4om emncilsfsDrmxront0oleomiciatfa2rl(vs t0tlxnir3oadom elnes;t0teto(o3iu4alt mivi (fsrrm( oot0apx  ietlsla um(ms;t0arxoio to1op rlu i t0t2toxmpoudll nlfvta()s2rauroot1tpe iociltfa2el(mo (0 exrir3tydopDelueo ()trxoimpiu4apeemiviltfarurxm nu4aex  fciydfs2ulums (0tetnmo oydfa r ues;t texrxr3no4aptnlici sf Drr( pot4tpeo oeiysla ul(vo t) ltomf3ta1lat  n i t tetrxm iy4am  mnei t  2ua(  ou1alen o3iatlaDrm( o t) exoxf3tadom   u o;s) eumim3iu1lmtnlietat arum(m nu1oetn i3tydlaDumnmo;t) etrmr iatopDrai ols  rurxm3nudape mfvt (f 2tr( p;t4tptomi3iatla2em(vp;u)aexrxo3oodomDe nvi;() 2tr(opoudll  mncsat) ruauroot4aptomoeiys s2eluvsnt0trxoifctydfate i o;() rtoimpnu1lpt  nvt sfarraumono4tlxn ieiltlmDrlumpn(0tltomo oytfatraiei ()srxrxopoudal  lncs t s2rrxronu4tpe ifciltls umn p;u)tlerxf3oatomte ivs;t  2tr(m oy1ale  ictlsfarur(mp;o0oetoifeiyslm2elnvpnu4texnif ia1opD lu ilt)trtm(r3nu1altnmictls) 2ur(rpnt1altomictltfm rluvonu0 rtomocto1oat  nvi;(0texo(o iy1optemivt ()arrmx  nt0tpxn i3iadls2ra( s u0alenmr oadlm  lnvols  euo(r3ny1ol n fet t  Draxrpnu1tpxn feilsfmDeauvo;u4 lermr ootlmDr ueols0 euoio3iodoltnlfvtat arum(ro;t1opxnmfcilt sDelump;u0tltoxf oo1lpt aueol( setoxm3nudomeeliet sfsruaxr ;t0oeeoii3iysls ranvp ()trtoxo totfaDeanes ()tetr(mpiy1ol nmnvtlsfaruax  nu4tpxomocilsls ra(von(0trenmoctadop   u s;( setoio oudlm elieiasf Dtmu pnt4apt  fetlslm2rl(vs;t)aetnmocoydfate ieo t trtmimpou1al nmnctat)s2tr( p;o1tltoifetltfm2em( p;u4aexomo to1fp elivil() 2xmxr oo4opeemfctas)artrx p;o1alt if3tadfa2rl(vo t4 exnifctadfm  livo;s0srum(rpoo1ape lfcsa(fs2urumpou4alx  oetydls2ea(mpn(4arxnmfcoodlpD ln i;s0truoxm3ou1lmenmnei sfa2rax p;o1oet  octyd mDel(ms;u4 rxoxf oadfp eaivi;s sexrxr3oy1omeemivs s  2ta(root0apxnmoetytfa rmn p (0tetnmr io1omtrlnvs;t0trumxo nu1ol nlnvtlt)sDua(rpoo4texomfctlt mDra(mp u0tlerxf iytfp  an sls)sexmim3io1aptelfct s) rrmuro;u4tex mo3iasfa2rlnms;t4 lxrircoydlpDr i o ( srxmxr oy4ap   ieilt  Dumxm ou1altoifciatfa rmuvs t4trxnmr iytlm  ai s ( seumxm3iu4al  mfes s srrrxm ;u0apx io3iadlm2ulnms t4tetrxfcootfa rlnvi s texmirpio4al  mncsa(  rururp;t1alxo ictadla2umnvs (4 renmrctodfp eli o t)texmxr io4llenlics s s2rax poo0tltoifetydlm ea( pnt0alerifcoadlmDrlivs s)t2xr(m nodamenlicsa()a2umu  nt1tltn ietasls2ul(ms t) rxomociodfpt livols teuo(o nudamen ivta( s2taurpoo0tpx  i3iasfm2rm(mo;t4altnio iodlmDeaivil( trxmirpoo1ap nlnct tf rur(m ;u1aleoioetys sDra(mp u4alenmo3oytom e nvs;(0 etrimpoo4ome lnvs (  Dra(mo;o4oltomietadla em(mo ()aetomf3iy1lp rlneo;(0s2tmirpiy4ap  lfeta()s2tm(root4tpxomf3tytfm2rm(mo;t)tetoxo iodlat  i i t)texoxopny4omtnmfvsas sDraxrono4open oetat mDulump t0alxnifcoydfpDeln slt srum(m3ny4omen nesl(f 2tmxro;t0tlt  fetldla uln o t)trenxr3oydlmD  u ols seto(r oy1ape mneta()sDtmx pnu4opx mo3tltfm2rl(ms;t0 rxoxr iydfp r n i;t)sexrxrpoo1amt lnvs ()aDrmumpnt0oetn ictlsfa ua(mp u4texnmo3oytlmtrlnvi;(0teum(o nu1aptelieil( arumx  ;o4aexnmfeiyd aDeluvpn(4aeeoxo3totopDeaies;t0 rxoxo iodap n ncsa(  Dur(  ;u4tpeoiiciat sDeluvonu0arxnmo3ia1oaDrau s;t) rumxo nu4ll emict tfs2tr( o;o1tlxo fciasla rmump t4trenir oodomD an i s) 2xrio iu4am emict (fa2umxrpnt1tlt ioeiyd mDrau s u4trtrmr3todlat aiesls0s2xrir io4omtn ictl(fsDtrur ou1oeeo feild sDrmnvo;u)texoif oo1fpD luesl(  2xr(opno1llte icsat)s2ur(root4ale mf3tlt a2em(mpnt4 lxnmf3iy1oaDeln olt)s2urir nodol  lieil(fsrrmxro;u0aex io3iyd a elnvo t4 rtrmoctytlm eauvils)s2trxr3iu4amee iet ( aDua(ro;o1tleomo3iltla emnvs;u0 rtrmo3totfat aivi;s) 2xo(o nudomtnlfvi (farum(  ;o1ape moetltfm2uan snu0trtrxrctadfmt lu ilt srxrxo iodamt  iei t)srraxroou4opxomfeildls2em(msnt)tetrio oodfmD lu i;s  eurir nu4lm e ivtl(  rur(mooo4tleniiciltfs rm(mo;u)tlxoxf3oo1fpDrlu s (  etoxr iydlmte neias s2tr(mono1olenifeildfm2umn sn()tetoif3iydlp eaneo;s0tetrxopnydlpenmneil(f Drmu ooo4tpt mictadlm2ran o;t)altnxr tytfpD  ivs t teur(o3iydamee ies t  rtmxmono0ope mf3iasfa eluvsn() rxoxr3oy1oaD  n sls0trtoio nu4llt  fctat)arrmur ;o1olt micils aDrau p t0tlxrxf3oadfpDelnvi ()seuoir3iy4lp nmici t aDtm(m no4opeomo3iatfmDulu s;t0tltrxr3io1opDrlieilt)texrimpoo1ll elicil(f 2uauroou1openmiciatfmDul( s;(4aetnio3todlatrlivol()srtm(opiy4opeemnvt s) 2tr(mo;o0tpeo octlsla2ra(vo;t0tlenxfcootomDran s t seuoir ny1lm nlieils)aruru  no1oex mfetyd a2umuvpnu0 rtoxo3oy1fa r n s;()s2xrxo io4lmt mncs tfsDra(mpou4aexo feiat a uluvpn(4 leoiocoo1opt livo;s0 2xr(o3io4am  mfesl( s2ur(moot4apto iciasfm2ranmo;(0tltrifcoydfm r ivo;() rtrim iodlpt lnvs s srtaump;t0tee ifciadlaDel(mp;u4tetoif iotom  livs t t2uoiopou1amen netas aruau p;o4optnmietld aDemu p u0 lxrxocia1omt  ueo;s0setoir nudom elnesl( sDumxronu1tltoiieils a2eln snu)trxrmf3oatomDeanesls) eurir3iy1lpt mfcsa()arrru o;o4opxnmfciyt s rmnmo u4 lxrifctotlmDe iei;t)s2tr(r3nudlme mfcs (  rumu oot0opxoifctat a elnvp;()texoiociy1lateanvi;t  etr(opnudole mneil(fa2tm(mo;o1oexomf3iatlaDua(vo;(0altnifcoy1lmD  iei;s0sexmio3oo1omte iesltfartrum nu0apeoii3tyd m2emn s;u4trxnir3iodlpD anvsls)s2tmiopny1ole lnesl(fsrtr(r ;u4apeniiciyslmDumnvp;t0 etnio3ia1faD  ivol(0t2tr(m oo4op elivtls) 2rr( poo0texo oeiasls elnvsn(0tlxnxo ta1lm eauvils0 rtm(r3oydlp e fcs t)srtr(rpnu4tpeo fciltlm2rau o;()alxrio iydlatr u il(0 exrxmpiy1om emfctat)srtaumoot4alxnmf3ils m ua(vs;t0aeenmr3oa1fp  luvo (0t2xrim3nodopeelfctat)aDua(mono1oetoii3ilsfa2em( snu)arxrxo ty1omtelu o t) exr(rpoo1ol emict tfarrax pnt0olxnif3iatfsDeau s (0 eerxfcio1fp e nes;(0t2uoir no1apee netls a2tru ooo4apeoiociltfm elu o t)tlxomf to1la eln o s)srtm(o iudam elfetat  rtm(mp;t4olto f3iatls2rlnmo u0tetnmrcoa1lpt  ivil(0trtrio3ou1lmeelfes s sDrrurpno4tetomf3taslsDulums;u4aeeoxf iy1fpDr ivslt0 etm(r iu4omtnlfvt ()s2tmxr oo4teenioeiasfa2ea(mp;t0aeerxr3to1omD au ols) rurir3iu1amt lnesa( s2tmxmono0tlt  o3iyd a ean s u) lxomo3oytom   neil(0 eum(o3oodaptn fcsa( aDtr(mo;u1tlx iieiltlsDuauvonu)aexomo3iytfmt lnvslt0srxmxm oy4lmtelicias)sruaxm ot0aptn feiys m2ulnvs () exnxfciytlmtr uvs;(  ruoxr iu1lptemncs () Drmx pnu4tlx ifcild a umump;u4trtrif3oo1fpt li i;s)s2xrir3iydlmtnlfvia( sDumur nu0oexomictydfmDrluvo;u)arxnif iadfp rlneo;()t2uoiopnydopenmieiat  rtaum no4texn oeiatfm2eanvo;(4texoxfcoodfmD au s (0srxm(r oo1lmtelici sf Drauroot1oeen ieiat a rl(vo u0trxrmocoodfpD lnvilt  rxr(m iu1lm emneil() 2rrx  nu1tpxomf3iltfmDrl(vp (4 renxfcootfm   uvi;s0srxrxr ou1amt  ncsl() 2rru  nu4alx  f3tasfsDrl( snu4 rtnmoctatomDrli o s  2toxm ou4lpeemnetls s2tr(rpnt4ope mocildlm um(ms;(0texnmr3oodop eai o ( s2xmxopiy4amenlivias aDuauronu0ole moetld m uan p;u)tlxnirciodoa  an il(0 rtoxo io4apte ncil( sDumu pnt0aeenmoeiydfs2ul( on() exoxo3totom eaiei;()trxm(r oy4amee fct () Dtaxmpou0tltnioetldlsDel( p u0alxrio to1fmD anes;( s2xm(m3nu1al   nvtl()aDra( pot0alen ieild aDrl(vo t4aetomo3iytfp  livs;t) 2xrxm iu4olt lici t  2uaxr ;t4alxo f3tldlsDua( pnt0 renir todlm   i ilt)t2xrir3oydope mict ()aDtm(moot4tltomo3tltlm elnmo t4trerio iy1oa e n o;() 2toimpio4altemnei (fartrx  nt4tlxn ieiysfm elnmo;t) leomr totfpD aueol(0srxmxmpoy1lpt lfvia(fsrumxmp;o1oleomfctld mDem( o ()alenmo tatlaD auvi ( srtoio3no1lme mnvt () Dua(r nu1opt ii3tlt s2rln p u4 exomr tydfpD li i;t)t2uoir3iy1ap n icsat sDrmumono4tle mfeiatfsDelnvp (4 lxrir3oytom   ues;t  etr(o3nu4opte fvsl() rtrxmpou1teeomf3iad s emn onu0 eenircoo1fate nei;t0 rxrxm3ou4lpenlncsat)a2urxmp;t4oex iictat mDul( o;(0teermo oodoptran ol( seum(opiu4ol nlicslt)aDumxro;u1alen ietlt sDrmumsn(4trxnmoctadfmtrli o;t t2xm(r3nudlmte ncslt) rrmu o;u4aexoio3tadlm rln p;u)artnxo iadoaDe ieo ()setmxmpoydopt lfci (  2ta(mp;u4tlenii3tys mDemnvo;u0aetrir3iytoatrauvi;(0 2uoxo3nu4llt mnvs (fsDrmxmont4tpxomociydla el(mp () rxoir oydfmt aivi t) 2uo(opoodopeemfvilt artmxm oo0tptnmoeiydfsDua( pn(4tlerir3io1fp raues;() eumxrpny4al  mnet s sDra(mpoo0tleo ocilsfa ua(mp;() rermr3ootfat an ols0texm(o nodoptnlfesa()sDrmurpoo0tpx  fctlt mDeau p u) lxnmo totoptrlnesl( setm(opio4omtemfctl(f Dur(r no1aexomoetysfsDrlnmonu0 etoiociy1optr i s;t trurimpoy1ol n fvsat s2tmxrp;t1apxn oetltfs2umump (0aeeoxr3iodfmt  n s;s0teumxmpoy1apeelnvsls aDraurp;t4tle miciysfaDumnvo t4trxrir oo1lat  n o;(  exmio ny1am  mivi (f rrrxmpot4opxn i3tltfm2ua( s;(4trxrmr totlpDraneo (0sexoxr oy1opte ics (fa2rr(r ot1apeomf3ilslsDul(monu0 eeoio totlpt  uvo;(0trxm(opnu1ome  nct sfarra(mpoo1olxnioetldfm2rlnvon() rxrxf oadopDeaiei ( trxm(o ny1omee feta()artmxrpnt1tlxnmociytfa2ra(vo;t0 rerxrcoodopD au slt0texmim no4lmte ivslsf Dur( ono1altomo3iadla umuvp;u4tlxnio3oodfptrai i;() rtrxm ou1ome lnct sfa2rrur ;o4oee ioeilsls2rl(mo (4 lenmr3oy1faDrlnes;s srxmxmpiu1apen ieias) Durxrpnt0oex ifcildlaDuanmont4texoio3iodlpDelnvil()t2xrir3oo4apen iesat sDrrxront1apxnmoctltls2ul(vo (4trtrxr tytlmD ln olt t2tmxm iy1omeelieta( aDrmur ot4opxomoctasfa rau on()tltoxf tatoatelnvi s0s2xrxmpoodap nlfvtlsf Dtmur no1olx mietltla ulnvpnu4trerxo oatomDeli ols0texoxmpoy1lmtelfeta( a2um(rp;t4tle  i3ilsfm2ua(vs;t4arenxo iydlpt au i;t0srumio3oy4lle  feiltfsrrrxrono1olenmieiydls2rmnvsnt)tltrxf oadomDr ieo ( sexoir iydole  fcsas  rrmuronu4teenmo3ilt mDua(mp;(4 reoiocoa1lpDranvi;s0trum(m no4opee ivslt)aDurx pno1tlxomi3iatfm2ranmo;(0 etoxrcoodlmte n s;t0srtoxm3ou4apt  nct (farrr(rpou0oexniictatfsDrl(vsnu0 rtrmrctotfmDrlnvs ()t2umxm3io1lm nmfcs ( a2rr(m ;o1tlt if3tat s ran s u4treriocoy1fp ran o;s seumxrpio4omt mncsa(f Durum nu1oexo ictysfa2uaump;t0arxomf3iytoa eanvi ( texmxrpiodaltn fet ( aDra(r nu4tpe iociydfsDrmums;u0 rxnxr oa1latrli i (0seur(m3iy1alt lfcsls sDrmx  ;t4aet if3tlsfs2ul( snu)tltrmrciytlpDr n o t s2trir3no4llee fvsasfsDtmxrono1oeeoio3iytlmDrmn p t4tltrir tatlmtrau olt0texmxm nydlme mfcias  rrrx  ;t1opxo fctlslm2rlnms;t4treoxo oo1faD  nvsl(0texo(m iu1lp emnvsas) rurxmpnu0oexniieiysla rm(vp u)trxnifciatlat luei t)srxoim iudopt  nvs t)sDur( ono0tlxnmfeiltla2ra(mo;()trxrxf3totom e i o ()texr(r io1am nlfvsa( sruau ono0olxomfctasfsDemums t4alxoif ia1lateanvol(0srtoio3iudll  miet ( s2tm(r ;o4olx iieiyt aDumu pnt0tetniociydlmtraivsls0t2uo(o iy1opt mnci s aDrmxmonu4oeeoiociytla rmu o t) leoir iodfpD anvils setoio3oudolenlict s)srrmur no1apxnif3iasfs2umumo t0artrxr iydlmtrlivo;s)srurxopoo4altelnesat srtax  ;o4tpx  i3iadfa ul(mo;(4trtrifcoytoaD  uvo;s)trtm(o io1al emieilsf rraum nu1aeeoifeiysfa2rl(mp;(4aetoiocoadlmDeai olt0 ruoxm iodolenmicsls)srtru  ;t4tle mo3iys s ra( s;t4aeenmfctytoaDeaues s0teumiopoo4ap n fvils) 2trx  oo1aleoii3ildlmDeaums;()trenmr iadla rlivolt)srtmxmpno4lptelnvsasfsrrax  nu4oetn oeiyd m2rauvs;()teermr iytfpDeanvi;s s2xr(m nydol nmiesa( s2tm(r nu1oet miciadfsDuanvo t4trxomr3iodfmt  nei;(0t2xmio3oudll n fet (  2tru  ;o0opxomoctldlaDemums;u4 rxrmrcoodfpD aies s0t2um(m ou1amtelfvt s)srumuro;o0teenmoctls m2emnvo (0artnxo3iy1oateauvi;s0s2xmxrpiu1alenlfcta(fa2rau pnt4altomf3tydla rm(mp t)trxnmfciatlm ranes s  eumxr no1lltnlnvtltfsDrmx  ;o1altnifeilsfs rlump (0 eerif3tatop r n s;( sruo(o ny1aptemivil() 2ta( ont0tlt mf3iys s rmuvp t0 lxrxo3oo1oateanvo t) 2ur(rpiu4lm nlici s  rumuroou4oetn oeiydfaDeanmpnt4altrxr3ta1lm  lues t0s2trxopnu4apenlieias  rrru pno0alxnifetysfmDuaumonu4 eerxo3iatfaDraneols) eumio iydoltemnvi t)sDtax o;t4tltoioetasfs rlu o ()arenmocia1faD  uvi t)s2urir ou4lm elncsa()a2um(  oo4ole mociydfm2rmnvont0trtoiocia1latrlivi s0 etoxm nydlpenmivsa() Drmx pnt0oexoif3iydls2uauvs u4altrio3iotlaDean o t)s2urimpiudop  mnci sf rrmu o;t4tleo i3tat m2rl(ms t0aexnmr tadlaDean sls)srxr(r iodllt mfvtl()a2raumoou1tleomi3ils s ea( onu) etrmo oodlaDrlnvs;( s2umxm3ou1om emics sfarumuront4alxo feildfm emnvp;()tlxnmo oydlaDelnvols teumxo3io1op  mfct (f 2rmxr ;t4oexomfeiatlmDelnmpnu)treoxf3iotlm  lnvils t2toio3nu1lmeelivtl(fsrtax pnu1ope  ocilslaDulumo;u0 lxrio totomDrluvi;s seuo(rpou1amenlfetas) 2tm(m no0olxomf3iltfm em( s;u4aetrif oydfa rlu sls0s2umiopoy1lm   ieiatf Dtrx p;u0opxnmi3ilsfa2ul( p;(4 lenio3tytlaD lies ( teuoim oo1al   fct t aDuaur ;o1altnioeilslmDuan o (0teeoxociodfpDe i ol() rtm(r oo4omteliesls srtmur ;t0apxnmoctasls uluvs;t4aetnmf iy1lmDeai o t)t2uo(m iu1olte nvsls aDraurp;o4aexoifciyt sDum(vp;u0 eenmf io1fm r uvi;s s2trio3iydam emiesl() Drrxro;o4alxo fctadfmDrlnms (4teeoif ta1fateluvo t0s2xr(r3no1amtn ictl() rum(r ;u1tpxoifetytfm2emu p ()trerir ootlmD lueolt)srtmxmpoydomenmfes sfarumxmo;u0oexnio3ildfm2ulu s t) etomo tatlmD ln olt0srtrxmpoudll  mneiasfaDtmxmonu4tpt miciyd mDrlnvp u4aetrxrctydfmt livsl()sexo(o nodoltemfctat) rum(ronu0apt  f3tys mDrlu pn(4 reoircoydfp rluvi () 2uo(o nu4ame  nvtlsf 2rm(  nt1tpxn fcias aDrmump t4 eeomfcio1fmDrln i (0trto(o3oy1am emnesa() 2ua(m ot1oexnmf3iad s2rm(vo;u)tleoxr oo1fate ieslt s2uoxopny4ameemivia(f rumxrpoo4aeenioeiytfmDrlumo u)trtnmo todfateai s;t) 2tmxr io1amenmnciat artauroou1texnmi3tld sDea(mo;() rxrmf3ootlp   nvo;s0srur(opou1lmtemies s a2tr(  oo1oee  ictld mDumu s;u0tleoifciodfa   uei s0srumxopnu4omee ieilt  2ra( poo1tpeomfciadla2rl(vont0alxoir ty1oaDeln slt0 2xmio3oo1ame mncs t sDumu  oo4tee  ociydlm2em( s u4arxnio3iadoa  anvo () etr(m3iu1lpenlnetltfaruax onu4texoio3ias s2eanms u) lerxr3iatfpDr ivolt)t2tm(mpno1lpt mnetlt)s2tmx ont4teen f3iltlaDeanvonu) etnir3oy1la  lu olt0 exmir3nu1amenmnes t)aDrmu onu1tpen ietys a el(vp;t4 eerirctytom raues s  2xrim nu1op emnvsl( sDrrx ont1tle ioetldlaDeau p t0arxnmo3oy1fatr ueo s s2tmirpou4lptemiei s aDuaum nu4aleo oeiysla emnvs;u0aexomf oadfmDeln o;( t2umxo3ou4altnlies ( s2rrxmpnt0aex  feiltla2um(vs u)aexomo tatomt  nei;t  2uoiopny1open fcsl(f Dtmuro;t1tpt moctatlaDum(mo;(4alxomrciytfa   nvsls texoio3iudolen ivta()sDtax  ;o4oet iieiytls emumpnu4aexoir iadfptraueil()srxo(o3nodamee ivs t  2umxmpnt1aee mociytfm emnmo;t)aexrio tydfaDr u i () 2ur(mpnu4aleemnes tfa2ra(mp;u0olxomfciyt s2elu snu4aetomf oadlpte neo t)s2to(rpiu4lpe  fcs ()s2tm(  ;o1tpeoioeilsfm2rln p t4trenio3oodfate ueo;(0trum(m3iydame lfvs () rtr(  nu0oeeniieiydlmDeanvo u0alerifciadfaDrluvs;t0s2trim3oodamt  fvs ()aDuru  ot4alt ifeias m2ua(vp (0tetnif io1fmDelivs s0t2uoxrpiu4ame mfvs ( aDrrxrpoo0opeomo3tls sDeln s (0 rtnxfcoy1fatrlu ilt  2xo(o3ny4opeelnvsat sDraxmo;u1aptn iciat mDua(ms;t0tlxnmf3tatlp rlneo ( trto(o ou1alt  ivil()sDtmumpnu1oex  fctlt s umumpnt)tleomocootoate nvi;() rxmir3nu1ope  icsat s2taxrpnu0aetniiciatfs eln s;(0arxrmr oa1fatr uei;t)teurxopiy1olt mfvtl(fsrraxrpou1oet miciyd aDemums;() leoio3iy1lp ean o t)tetmim3oy1lptemfeiat)arurumonu0tet iieias aDua( o (0arenio iadopDr uei;t0srxo(m3io1alt mnct s  Dtaum oo1optnmi3iysls2eanvsnu0aeermr3oatfm  ai i ()t2xmxrpny4lpen fes sfsDurxm ;o0oetniociasla uauvs;()alxnxr oytlat ln olt0trxm(mpiodomt  ncil(fsDumxmoou1oee ii3iydfs ulnvon()artrxrcoydlmD auvs t)srxr(r3oo1al e nvtl(fartrxrpoo0ole  feilt a uanvs t) etnxo3ootla rln o s  rtoxopio4ll emfcsltfsruru p;t1apeniictytfs ua(mo (4artrmr iy1opDrauvs t) 2tmir3nudal n nvtlt s2rmx p;u0oet iociadfs uaums u0tlxomf iatfpDe n i;(0srumxm oy1aleemict t sDumx ont1optn f3tydfs rmuvsnu0aleoif3oa1la elueils0teto(r3iudal  mfvias)sDraxmpou1teto iciyslaDumumo;(0 etnxo3io1fpDrlnvs t0s2xoirpno4lpt lnei (fsDtmx o;u0oeto ociadla ranvo t0 lxrmocoatlpt  nei () etr(r3no1ll n fcs s  rrau oot0opx mi3iatfsDulu o t)altrmf totomtrauvi s0 exmxo iy1om   feta(  Dtr(rooo1alen o3iysfs rm(mpn(4teerio oadom e i s ()s2umimpoo1lp elnvsl(  2rau ono1aee io3tlsfs2rl(mo ()trermoctatfp raueilt srtmxopoodopt mivtlt aruaxm nt0tpxn fetatfs umu p (0 exrxfciodopDe nvs;t  rtrim3nu1lmt  fvsat arurxr ot0apxnio3tatlaDul(monu) exnmf3tatlmDelneil()setrxr3iy4lp emivs tf rraurpot1aeto oeiltfa2rlu p (4altrif3ootfp r nvslt) etoio iydale mivil(fa2raxronu1tlx  ieias a2rl(vp;t4 lxrxo3iydla  anvo;(  rtm(r3ny4ol
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;()texoxo3io1ope  ivia( a2taum nu4altomiciatla2ea( snt0teeoxr io1fmD lnes (0 2ur(r3nudapte ncils a2uru  ot4oeto icilsfa2rlums;(4aleoxr3iy1lpt lnvo t  exmio no4olee feias)aDtr(mpnu0alx moetldlmDrl( snt4tetoxr tatlmD  ueo;t seur(m nu4alenlneilt) 2ta(rp;o1apxnifciasfaDrlnmp;()teerir ia1laDraueol() eumiopiy4lmen fetat)sDur(r nu4texomfetytfm elu pnu) eenir ootomt  u ils)t2xoxo iy1lle  icsltfaDtm(rono0apto ieiltlsDeauvs ()altrxr3oadomte ivi;s0s2xmxr nu1al  mivtas srrm(rpoo0ale  feiadlsDrm( p u0 etoxr iotlpD ai ilt) rurir oy1ll elnes s)aruaxrpnt0opeo f3tys a elu o;(0trtnio ta1fa   n i;()t2uoxo3oy4amte nvslt)s2tr(mono4ole mfctytfs eanmpnu4 rtoio tydfmDe ieil(0t2xrxmpou4al nmfct tfs2trum ;u4tpt if3tysfs2em( s;(0teeoxo oodla rli o t s2ur(mpiy1llenmies () Dumxm ;t1alxomieiyt m2eluvs u)alenir3io1lm elnvo;t)srur(o ny4ape lncsl( aDtru pou4teeomociad aDrl( onu0 rxoifciatoat aivo;t) eumimpoudlme  ncs sfaDra(r oo1alenmfciatlm emuvp;u)tltomr ootfm  aueslt0 2uo(r nodolen ncs sfs2umxmo;u4tpx  ictltfa rluvp u0areoxf3iodoa eaueo;s0teumiopny4lptemiesatf Drr( p;t1opxo fctadlsDranvsn(4aetnxr3ootom rlnei;()t2xrim3iy4oltelnesltf 2trx  ;t0tpeomo3tat a2uan p;t0tltrxf3tadom r neo ()tetrim io4om   nviat sDtmurpot4altn f3iydlsDul( o u0aeermo iadfmDeaivilt truoio nudal   fcslt a2rmu  oo1opxnmieiadfs emu snt) rtnif3oo1lp  auvs;s0srxoxrpoudll nmnvi s  Duaumono0alx  f3ilsla emuvs;u)tltomo tatlpt  n s ( srum(o3oo4ll  lnet tf Dururpot0ole mfeiadfs2ranvo t)alenxo io1fa eaies;t  rtmio oudopenlncsatf rtmum ;u4tpenifeias m2el( s;t) exomo ia1omDrluvolt seto(r oo1lmtnlics tf Dur(rooo1alxnif3iysfaDemu s t4arxomf3tadomD  i o;t) exrxmpiy4omen nei ( srurx ont4olxnmociytlmDuanms t0 eeomr3ia1oaDeaueo;(0teumxo3io1lle lieiasf rtaur ;t4apx mf3iatla rl(mo;(4aetoxr3tatopt aues;t0trum(opnudam elicia()aDraum no0ape  ieiytfm2ulu onu)artomr3iy1oateau i;t s2uoir nu4al   ivia()srtmxro;o0opeomfctas a elnmp t0 rtoxr3oatoatrln il( srxm(rpio1alte nviasfsDrrx ono0aexnmf3iat s umump;(4 leoif3tytoat  ieol(0 eur(m ny1lm  lfcsls)srra(r ;u0open f3tltls ra(monu4trtoir tatfmteaivi s s2xmxmpoo4lme micsa() Dta(m ;t4tpxo ieiydfsDelnvp;(4tetoioctatlp rliesls0teumxmpiudap nlnctltf 2trumo;t1olxomocildfm2rlumsnu)trxomf3ta1lmte nei;s)s2xrimpoudaltn ivsa( sDrm(rp;u1oexn ieildfsDraums u0 exoif3totla   neo (0teuoxm oydalte nvsas)a2ururo;u4tet moctysfs ranvs ()teenmociytlpt liei;t s2tmxr3iudoptemiesltf 2umuro;t4tee mfeilsfm2raums u0texoxr totfmD  nvi t) rtrxm3iydlltemictatfsDrr(moou4oeeomoeiltfs ranmo;t)aeenxr tydfaD luvo t)s2xmio3iu4ap elnvias a2umx ooo0tetnmoctld aDranmp u)altomr3tytfa  ln s s0srto(rpou4amte ies t)srrmxrpou1oleo icild s em(mp;u0aeeoif iadfm rau s ()texm(opiudlmtnlnes s  rra(m ;o4aleoii3ias a2emu o t4trtrmfctatlm  aivi;s)trum(m nu4ale  fvi tfaDtru oot4tlx ifeild s2ra(msn(0tlerirciatomD ai o;t0s2uoxo oo4lptelnei t s2uaump;u4tex ii3iyd s rmu s;u) exrioctydfmtelivo t0 exo(o oy1alen ivt sf 2urx  oo0tlenifciat a umu s t4 lxnmocia1laD lnei;( trxo(m3nodal   ieta( a2ua( onu0teen f3tld m ea(ms (0trtrxo3to1om  aivils0srtoxo3nudlmtn iciat arra(rpnu4tlxomfeiadfs um(ms;u4 rtomf3iy1optr i ils0t2urxr3iydlp emfvtlt)srraxmooo1altnmoeilt m2rmn o;u)trtoir oa1lpD livols)trxrxo3iy1al  mfcsls sDtmxm nt1aetnif3iys s emump;u4 renmo tydfa elu o t0 rtoxm3oy1aptnmneta() 2ur(rooo0aexomociytlaDumums;(0trtomr3iadlm   ies;t)srtoim3oo4ll  mfvtls) 2rmum ot0oleoiiciasfm emnvp u0alenmf3iatfmD lueo t t2xoio3ou4apee fcs t a2rax o;t0aeenmi3tadlm2eauvo u) rtrxf3tatlmDeaivol(  etriopny4alenmfcsl() rur( o;t4tle  i3tlsla2rm(ms;t0tltomfctadlaDr nei ()trxrxr3iodolenlivtlsfs2rm( poo4tpxnmi3ildfm2emnvonu) eeoirctodla r i slt)s2um(m3iy1lp nlnesl( arrr(  oo0teeomoeiydls rm(mpnt)tltrir iodomDr ies;(0seur(opny1omte netat artaumpou1oltnmoeiasfs rlnmo u4teerxo oytfmDeai i (0s2tr(o3ou4ap emictas)arumur no4aexnmfcildla2rl(vs;() etrxo iytomtr uei;t trtmxopoo1lpen feiatfartrur oo0tptoiieils s2rl( p;(4 lerxr oydlaDraivi;()tetrxmpnudlpeemncsas  rurx o;t1tptomfctldls2elnvo t)altnxo3io1fa eli o;t0 exoio3no4amt mnetat  rrmxmono1alxo ietydfa2rlu on(4tltnmfcoa1fa eli s (0s2umir3oydaltelfvsa(f rtauroot4alt  iciyt m emump;t0tlxoxo tatomt lueo t trxoxm iydopee fcsls)srumxr nt4optnifeiys m2umu p t0 lxoif iodlm  anvs;t trurir ou4olte ieias)arraumpnt0opeoii3tyt sDranmp;(4teermf3ootlaD  ueo;()s2xoim oo1lpe lieia(fsDumx pno0aeenifeiytfm el(mp;()aexrir3oydlm  aivil( s2tmirpiy1lm nmict s)s2umurpnt4olxnioctyd a2ean s u)aexrxf3oytfmte nvsl(0seur(r3iudam   icilt) rtmumo;o0ale ifetytfs2eln p;()arxomo3ta1lptran s (0setr(r nydalenlnetat) 2um( onu0altn iciytfs el( p (4alerir3iy1oate u sl( s2uriopiydomt mfvilsfaDuau  nt4ope  ociysls2eln o;u4areomo3todlpD lneslt)setr(opnu4lpe mivia( a2taxmpou1aetnmieias m2emumpn()aetnmo3io1laD aivil()seur(opiy4al   fes sf 2rr(rpnu1ale ioetld mDeauvs;(4alxnmo totlaDeauvilt s2tr(o3io4lmenlivsa()aruaxmpou0aexnmoetldfmDua(mp (4tltoxocoy1optraivs;t0 2xoxmpnu4ol   nct tfsrrrur oo1oeto ocilsfa emu on()tleomf3iadopteau o;()seumxo3ou4altelfct s  2tmxrpno4tlx mf3iatlm2rm( p;t4aetoir3ia1opDe n ols t2toir oudlmenmfvia(fs2rmxr ;u0oee mietltlm el( on(0trtrifciatfa e iesl()trxmxr iu1om n ncs ()a2rax ono1alxnmo3tltlaDul(mo t4aexnmociydoa e ivo;()srumxm iy4ome mfctls  2umur no1alt  f3ias m ul(vs (4trxnircootlm e nvils0srtoio oo1lmenmncsas aDua(m ou0tptoifcias s rmnvp u0areoiocio1op e nei;t)srum(o ny4amtelfvsa()a2tm(rp;u4tpxo oetyd m elump;t4tlerxfcoy1oate ues t  exr(opoydomeemneslt)srtaxmo;u4tle mi3tat m2eanvp (4tetnxo tydomtrlivolt t2umio3nu1ale  fcsatf 2rmu  ;o1olt ii3tldfaDra( snt)trtnmf oy1oaDran i s)srumimpno4ol  mici t arrau o;t0tpe ioeiydfmDuan pnu0 etnmr3tydfmD li o;(0srtmir3oydlm nlicilt)sDtr( pnt4oleo ieilt sDeauvs u) renio ia1latrau o s)s2xrio3oo1ap eliet tfaDtmu  nt1opto o3tytlm eaums ()alerxrctatla eanvi;s teumirpio4am nlics ( a2um(rpou0aeenioetyt a2emu sn(4texrmr3ia1la ranei;t)srur(mpoo1al elieta( artrurono4aleoiieiysfmDumuvo;t4aexrio3iatfpDr ivi ( srxo(rpnydopen ivs s a2trxmp;t0teen i3ilslsDel(mp () rxrmfciatfm   ivi;t  rxoxm3oy1amtnmnvilt)s2rrump;t1alxomoeilsfm uanvpn()artrif iodoat ai o;s  eum(m nudolt lnvt s) rrr(m oo4oex mietat s2uaumo;(0 leomo3to1opD luvsl()texrio nudllte nes s) ruau p;t4olxnifciasfm2em(monu4trxnif oadoaDe ies;t0teuoxopnu4lmt  iciasfsrrru  ;t0tlxnmoctys m2umumonu0 rtrmfcoo1oaDelnvs;t0 euo(mpiu4aptemnciat) rtau ooo1ape ii3ilsls elumont0 ltnifciy1faD  uvslt teurim3no4oltn ncsat artrx p;t4opeomieiytfs uauvo t0tlenio3oy1om   nei t0srxr(o3ou4ap  lnctlt) Dua(rp;u0apxoioeils aDel( ont4arerirciadlmtelieo;(0tetrirpnodlmtemici ( s2rax ono4apeomo3tyt s uanvsnt4aexomfcoo1fa raieo;t)t2uo(mpnu1omee ivi (fsDtm(r ;o1altoioctadfaDeln p t0trxrmr3oo1lp   ueil(0t2trir iudlp  lneil( a2tax pot1alenifetls aDuanvp u)artoxoctodlptelnei;( t2xrir3io4lme mivsa() 2urxm nt1alxn f3iysla2emumpn(4trtnmfcty1fpt anei t0t2uoir3iy4am   fct t  Dur( ont4oetnmfetlt m2rau p;t0 lxoio3ia1fa elies s0seuo(m3iy4ome mnet s aruaxrpnt1olt ifciysfmDua(vo;u4 lxrmr3ty1fmD aivs;s0truoxmpio1alee fvt sf rtmxm oo1opeomiciysla em( o u0arxomo3io1la rai ol(0srtmxr iodamenlnvsat  2umum nu0tetnii3ildfmDrluvo;()tlerir3totfmtelivi;( teurxm3nodop  mncsls  2uaurpnt4aet miciyt aDeauvont0trenifcoo1lp rai i;t)s2urxmpoodolenmncta() rur(mpno1alxomiciydfa2umump u)alermrcoo1lm  an o s) rurxmpiu4lpeelfeil(faDrmumo;u1apxoifeilslaDrmu o;t)teenxo iytlpte nvs;t sruoimpoydolt  ictl()a2tmumpnu1oetoio3iadlm ulu o (4teerio3iydfaDelnvo ( srtm(m3iu4apen fciat srumx oot0aeen fciytfm2el(vo t) eerxr tytfaD liesls  2xmirpnu1apt lnet sf Dtmxrpot0aetnioeiaslmDrmnmo u0tlerxr oodlmD auvi;s0 2um(mpoy1ll n nctlt s2tr( poo0apt  feiysla emu sn(0aeeomo oa1omDrauvo s0t2toxo ny4ap nlivtasfsrtm( ono4alxn i3tysla2uln o t)arxomo iatlpteanvo t  2trxr iu1omee nvt t)srtru  ;u1tleo ictad sDeau sn() eeoif3to1lp r nes;s texoiopio1ll nlictl( aDua(rpou0tpe  iciyslaDrau s;t)teenio oytfpD  u i s)seumxm nodomt livtl(f Dum( oot1olxoio3ilt sDeauvpnt0aexrio3totlatraiei t  exm(r nu1lp  lnesa(f Dtr( poo4aeeoifetysla ulums;u)texrxr oydfpDeauvs;t0 euoir3io1lme mnvs (f 2rr(mpno1ope  fctysfa2elnmsnt4 reomo3oydlmt lnvi s  rxrio iodlptnlfet ( s2uax pot1aetnio3iltfa2rlnms;() rtomr tydoaDelivo ()srtrir3nu1op  mfeil()sDtrxmp;t0tetnio3tldls ranvo;(4teenxfctadoaD lnvsl(0srum(o iu1op  lncsatfsrrau oou1tlt  iciytfm2eanmpn(0artnmf tydlpte neo ()tetrxmpiy4lp   nciat)srta(m ;t4tpenmociadls2rmuvp;t)treoxf iadfaD liei s)trxoirpoo1lpt mnes s)a2ur(mp;o1olenio3iysfa ua(vs;u)teeoxf3iatfmDr ies s)t2uo(r oo4ome  nvia( s2rr(mpnt1tlxn f3tys a emnvo;t)tltoxfctytfatraneo;s  rum(m3io1opee iet sfsrrr(rp;t1ale ioeiltfa rm(vo u0 eenmr iy1opD aivs t  etm(m3oy1llt lfvtl()s2tr( p;u1tle  feiyt m2rau p (4tltrmfcootfptraueil(0s2to(o3ou4al n nviltfsDrr( oot0opxo ieiatfm rmump;u0 rerxo tadlm elueilt0 rxrxr3ou1ole  ictl(fsrur(m ;o1alt mfeiltlaDumnvo u0 leomr3iydfpteli o;s0 euoxo3iy4ap  lfcia(  2rru ooo1optniocils m ul( o u0 rtrxr3io1fp e ueo;t  2xo(rpiu1alte ictas)srrmxmpou0aee  fctasfmDuau pnu0tlxoxr3oa1lmDrlues s)srxmxo iydoltn nei s)s2rax  ;u1opxnmieiydla elump;t4alxomfciotlmt an i (0t2umxmpoy4omt  ivsa(  Dumump;t0tpx if3ild s emuvo () rxnmr3tytlmDeluesls trxr(o3oy1lpeelici ( sDurumpoo0oetoifcias a2uan pnt)artoxfciotfpDean o;(0setoir oudoleemivia(  2tmx  oo4ope mo3iat s2eanvo u0trenmfctytfmt an o s)trurxm3nodolee ici s) rrax pno1ope mfetyd m uau p u) exrio io1lm ranei s0 exrimpoy1apen nct sf rta(r ou4apen ieiad s2emnvs;t4trxnxo3tadfatrlnei t texmio3iydomt lnvs s)a2urxm ;u1tpeo oetls mDem(vo u)tlerxf3iytfptrlu ilt)trxrio oydom n ies tfarurur ;o4aptn iciyd s rl(ms;u)trxrmr tadlpDrau o;s  exr(m oodllt  ncslt s2um( ooo0ope  oetyd mDrlnmsnt4aetomf3oy1fa  an s s) rur(mpiodomt  ncsls)a2umx oot1teto fcilsls em(mpnt4 rxrmf iatfmteaiei s0 2uo(opoydamtnmnetlt srrrxrp;u1ole mietasls2rmuvo (0tlxomo3tatopte ies (  rumirpnydlltn fvil()arrru onu4alen fetas s2rm(mo;u4aexoir oa1fmt lnvs;( s2xoxmpiy4apenlnctl(f Duau  nu1tpx  fcildlsDem(vo t) etrxf oo1fmteln o;(0trtoio3oy1olt  nci s)sDrmxroou4oet ii3iatlmDua(vo;() lermrctotlpDeaivi () rtrimpnodolen netat s2ur(monu4altoiicilt s elu o;t4areoxfciatla   uesls t2ur(o3io4ol  mnctlt)srtmu o;u4alxn iciysfs2ua( s u4aetnxr3totfp  anvol()sexoxmpiy1ll e netl()sDuax  ot4opx iieiat a emu pnu4 etnir oytopDeluvsls setm(r iy1ape  ivta(  Drax o;u1aexnioeiyd m el(vo;(0 rxnxf iytopDrauvs;t0trtrxo iudlmtnlnvsls)srtaxr ot1ale iieilslmDum(ms;t)areoxf3iodfpD  neo;t0srtmxrpoudlle lnetas)s2urxr ;u0tetnmi3tldls rlu snt)tltrxfciytlm  an ols)s2tmim3oo4op nlfesl( sDtax  ;u4aptn fciatfsDea(mo t0alerxo iy1fp rlieol( srxoxr iy4apt mfesa()aDtmxront1tetoii3tyd aDrlumsnt0 rtomrcto1lmD  ueol(0srtrimpnu1ap   icilt srra(mo;u0texniiciysfa rlnvo;t)tlerio3iotlateli i;t s2trxmpnu1optemivt sfsDrmu pno4texoiociltfa2em(vs t4alxrif tatfaD au i;t0teurxm oo4altn ncsa() Dtaxmonu4apt ioetadlaDuluvo;u)aetoifcio1fp rlivi;t0 etrio ou4amtn ncslsfaDumxro;u0tltoifctadlsDraumo u0trenif3iatfat  u ils0 2umxm oodop elnvtltfs2trxro;t1alxoiiciydlm2rl( snu4 reoifcta1fp   ues ( t2umio iu1oleelfcs t srra( oou1tlxn oeiltfs2emnvont4 reoio3iodla   ies;s0trumxo3nodlm emfetasfartmxmo;t0tlxnmoctldfm rmumpnu4 etoxr3iotom   ueo;s) rtoim nu4ll  lfvsltf rraumont4opxn octadfm2emu pnu0texomrctatfpDr nvsl(  exmxm nu1om emietl(  Drmxrp;u0aetn ietytla umumpn() reoxf3tytlptr n s s)setoxm io4ope lfet t s2uaxmo;o4tpt ioeiyslm2rln pn(0aeeoio tatom  lieo;s0 2xm(r oodamenlfct (fsDrrxrooo0opxn ietlt a2rl(vo;(0tlerifciatfa   nvi t)teur(m nudamtemfvtl(fsrua( o;o4tpxomf3ildlaDem(von(4arxrxoctotomteauvs s  rum(o iudlltnlivi () Drm( oou0aeeomociatlaDra(vpnt0teeoxf ty1fmDelues;(0srtrim nudal elnvilt) rum(mo;u1tlx micilsfm2emnvs;t0altnxo todoaD li i t  2trxr nodlme mictl()arraxm ;t1alen f3ildfa2eaump;t)tetomf iatop  an s;() 2xmim iy1amtnlnet (  2tm(ro;o1olt  ieild m2umnvp (4trtoxf3oytfa  ln sls s2xrxo3oy4op nmics ()sDtax pno0tlxo f3iltlm ea( ont0 ltoxfciy1lmtr ueo t0 eum(opoudom  miciat arraurpot4tlxnmiciytla2raums (0 ltoxocoa1opDelivo;t) rxoim oo1lmeemncias a2tax o;t1oetomoetld s rm(mpn(0 lxrifcoadfpD lnvi;t s2umim nu1lp elivsas s2rmx pnt0tpx ioeiatls2ranvp (0 rtoxrctodoaD lnvi t teurxm3ou4omt mivi (fa2taxro;o1olx ifeiys sDranmon(0 lxoifcta1lat  uvs ( tetmio3nydlm e fvt s aDrr(rpno4tltn f3iydls rmn o;u0 lxrir oatfa  au olt  exmir ou4ll nmivs ()srrr( ono4tpxo ocilsfs2ea(ms;u4 ltrmr oy1fate i ilt) eur(m iodom emies sf Durx  ou1tetn fetyt aDuau ont)aexomf oa1laD aneo;s  2umxopny4opt  fvta() 2rmuro;o4tlxomociatls umn p;u) ltomf ta1opDe neo;t) rtrxo3iydome livilsf Drmxr oo0tet if3ilsfm emnvp;() renif iy1lp raneol(  etmir oo4ap nmfviatfa2tr(ro;t4aeeoifciydlm2ea(mo;t4trtoirctotfpDr n olt0 2toxo nu4lm emncilt)sDrmum ;o1opx mociydfaDeau s u0alxrifctodfateau s ()tetoxm nu4al elfctl( srtmuront0opt mf3tydfa ean s t4 rtnxo io1fp  lueo ()s2tmxopoudop nmivilt  Dum( o;o0tlt if3iatfs umumsn(0trxrxf3oadlm  anvi;s s2toirpiudomeemiciat)a2tmxmpnt1oetomi3ias m rm(mp u)alenir3iadfpt lnes s t2trxo3iu4apt lfeil(fsrtaxr nu1tle iociadlaDuan p;u)trerifcoo1fa  lueo;() 2xoxopiy1am  lfvt sfaDtmx  nu0aexn ieiys m ul( o;()trtomf3iatlpt anvil(0 rumim3iy4omt  ictlt sDrm(moot4tlenmoeilsla rlu s (4tlxnmf iotopDranvs s  2uoxrpno1lptelneslsfartr(rooo4tltomf3tat s rln p;(0altrmfciadlatraivi;t0 rurim io4lleelfes sfaDraurono4oetnmf3iaslm ua(vp t0aexnxfciotoa raneil(0 rto(m no4om   ncta( sDtmxrpno0tpeo oeiyt a2em(mon()trxoxf3totlmD lu slt t2toim nu4aptnmictatf Dum(m ;u4tpeomieils a ulu pnt)tltoxf ty1la raiesl(0teumimpiudlmee nvtl(f 2tmxrp;o1aptomi3tyt a rm(vo;(4tetrxoctytoaDe uvo;(0seuoxmpnodomee nei ( sDra(rpnt0teenmoeiadfs elumo u0tlerir iodoptrlies;t) 2xo(r ou4ape mfes t aDtrxro;t4optoio3tldls2rauvs u4aetrxf3oa1lmD aues;()srto(rpiu1omtelnvsasf 2rrum oo4alxnmictydlaDeluvo;t) etnmr iatfateli s (0 2uoir3oo4lpe micias)sDrmxm no0tee miciad m ea( s u)treoif iytfmD aivi s) etoxopiu1lleemivsls s2ua(rpnu1tlx mf3iyd s2rmnmp u)trxrif3iatoat lneil(0s2urxo3iy1ale mnvtl(fsrur(  ;o0oeeomf3iysfm2uanmo u0trerio iadfa rlnvolt srxmxr3nu1omeelivia(fsDtmumpot1altn i3tas s ra( snu4 exrmf oodfmDr uvo;s0srxoxm iudaptemfciltfs2um(rpou4tetnioeiat s2rl(mpnu0 rxnmr oadoatraivil() rurxr iudamtnlfvsl( artm(root0openmfctltlsDra( p;t)altnmf oydopte n s;t  rxo(m iu1omeemfvta( srumuront1aee mocias s ul(mp;(0 lenmo iodomt auvi;()t2urxo3iodopen fvsasfsrumx pou1tptnii3iysla rmu o;t4trxnmf3tytopDeli i;s srxr(m3nodapt mfvt tfsrra(r ou4tetn fetas m ra(vs;u) reomr3iydlmDe n ols t2xrxo3nydlmen icsl(f Dtm(rpot1opeoiictyd m rmu p u0tltrio totlmDelneo ( srtm(rpiudlmtnlict s)artm(r ;t0tpe ii3iasfs um(mp ()aexoir3ia1fpt  iesl()tetmxo iy1omen nvilt aDrru pou4tpx if3tlsfs2el(mp u)arxoxfcoo1omD  ieo ()trtmim3ny4op e fct t)a2tmuroou0alxnifetatlm elnms (0 etnxf ty1fm r uvsl()srtmirpiy1ll n net t  2ua(mpot4alenmociltlm eanms u0alxoxo iotlmDeai s ()t2ur(rpio4oltelnct t arum( p;o4aeenmo3tltls eanmp u)aexnmo todfa raiei t) 2umxo3oy4omtelnviasf Drrxrp;o4opxo ietasfaDean p;u4tetnio tadfpDeli i;t)srtmir oodamt mfci tfaDrmxm ou4oltnmf3iad mDelnvsnt0alenmocoadlmDeau il( texm(o3ny1ap nlfvsls) 2rrxmp;t4aleo i3iadlaDrlnvont4arxomr oadlpDr ues t teum(mpiu4ll emivtat) rur(mp;o0oeenif3ilsls rm( p;u) rtoio oy1latrauvi;s srur(opou4ape  icil(  rumur ;o0opx iocildlm2ra(mo t0 lxrmr todlmD  ues s0 eto(mpio4optnlneta(  Drr(mpot0ape  fctatfs rlu pn(4texnio3ia1faD ln s;(0tetm(m3nudlle mnvsls) Dumumpot1apeo fciaslaDulnvsn(4tltrxr3to1lmDelu il(0setrio iu1lpe mies s aDua(  ot4altoifctad sDelnvs u4 rerif3iodfpDr nei s0sexoxr ou4lmtn ivs ( srtmu o;u4tltnmo3iydfm2elnmp t0tetoxrctytoptrlnvo;(  rxrirpno1lptnlnesat  2rm(ront0aptomfctad sDulnvp;(4aeerir oa1omtr i sls  2uo(mpnu4lp nlfcta( a2ur(m ou1opxo i3tys aDrm(vonu)tltrio3iodlaDr n i s tetoim oy4ame mneias artmx o;u4alxo ieiyt a rlumon(4 reomfcio1la r ivils sexo(m iu4lltnlnei ()aDumurono1tpeniieiad s ulump;u4 eermr ootlp   n s;s)s2xr(o3oy1ol nmivs t srumuro;t0tlx  oeild aDuauvsnt4 ltnmo iodfm r i i ( s2uo(r nudap e icsltfarraurp;t1tlt iociydfa elu s u0alenxf iy1laDrau s;t)trurio nudap nlivtl(f rtmxm ou1oex mi3ilsfa rauvp t)aleoio tydfptrlu i t)teto(o no1omee nesls  rtm(  nu1ape mociat a rmn on(4arxoxociatoatelu ilt)s2tm(o oo4altelfvi tfarur(m oo4optniociadfmDul(ms;u0aeeoio3iotfa eaivolt)s2tr(o oudol n fct s) rrrxrooo4aleoioetadlsDua(vs t)treomf oa1la ran ils0 rtr(m3iodom e ieil()arraxrooo0opxn o3tlsfs umnvs t4trxnxf oo1op eanes t) rtm(rpoo1lpte fvias aDumurpoo0ole iieiadfs uanvo t)arenmfcta1omtrauvslt s2xrio3iy1al n ncsl() Dtaur nt1tlxoiieiysfsDem(vpn(0aeenir3oatlmDrlueo s0t2toxr nodlle  ivslt)artr(r nu0alx if3tys a2emuvp;t4 leoxo io1lmt  uvo;t  rtr(o3iu1lmeelieias a2ur( ono0teenmi3tyslm2elu ont)tlxrir oy1oa  an s t) rxmio nydlpeelicsatfarrmum ;t0oee io3iatlaDuaumsn(4alxrxo iadlat  ieo;s)t2trxo3iu1amtelnct t) 2rrur ;t0olt mo3iadfsDrlnvpnt4tltoio oytoa r ivils)seumir oydame lnvsatfsDtru o;u1aeen i3ias a2eanvsnu4tlxrmr ty1fmtean o t0 exoir oudll  mfcsl( srurum ou4olenmoeiysfsDemu ont0 renxo3oo1oateln s s)t2urim nu1opeemiet sf 2rau o;o4aptomfetad s ra(vo;u4aleoxo3oytfpt luvilt0tetoim3oy4olenmnvi t)sDtmxrono4olxn ieiyslaDeauvs (4 exnir to1fp  livs;s0trxoiopno4olenlfcta() rrmxmpno0oet ii3tys sDumu o (4aleoxociytfptr neo t srtmxo iu1lp e fcs t) Duau oot1apen f3ilsfs2umnmont)alxrifciadoaDrli i s  exoxr3oudlmeemfei s srraur oo4opeoio3tlslsDrmnvp t) rtrmociotop rauei ( t2trio iydopen nvsl(fartmurpno1opeoio3iad m2el(monu)aeeomo tydfmDe ieols)setm(mpiydapenliei ()srrr(rpoo0aex mi3iydls2uln p t4 lenxrctadopD anvolt0trxmim3ny1olt lfesat s2urumpoo4oleoifeiasls ulu s u)treoxo iytoaDe n i;s) etoxr3no4ap  lfcs tf 2ra( o;t0alenmictydls rl(ms;()tetomr tatop e ivo;( trurim3nudlpte icta(f rumxm no4ape moeiyd aDrlnmsnu) renxf3oatlm e u sls)trurxo3iudamtnlicsl(  rrmxro;t0tetn ociadls2em(vs u0tltrifcio1lm eaivs s s2to(mpno4altnlnvils)a2tr( o;o1aetnmo3iytfa2em(vp t4aetoif io1omtrlieo (0 etrir3iy1am e ivia()s2umx p;u1aeenmi3tyt s emn pn(4tlxoifcootfpD luvsls0s2xm(r3iy1lm n icia(  2ua(ro;t1altn ieiytfsDeln o () etrmfcty1omtraivol( sexmxo3io4amee ncia(f rrmx  ou1opto o3tadls em( on(4teeoxrctytopD lieils t2tm(r oodlmt lncilt  rtrur ;u0aptnifetydfa2umums;t0 lxoxo iodfp e ivil(0 rxr(opiodope mnctls a2ua(rpou1aet mociyd s rm(vont4 lxoif3iotop eln i;t0 2trir3iudameemncil(fsDtmur ;t1altn o3tadlm2rlnmpnt0texoifctotlatrlu s;t  exrxo3oydal emicslt  rrm(rpnu1aee mf3tasfm emu ont0tlxomo oodoateanesls0tetriopio4omte nvils  Durx oou1oeenioetyslm2rl( on(4tleomfcia1op eauvils0trto(r3nu1altnmfcsl(f Dtm(r ou1aeenmfctydfm rl(vonu0 reoxocoytfateauvi s0 rxoio3nydlmen ivt s)sDtm( ooo1tpe micildlmDraums;u)texnmf tatfa eli ilt0 etm(m iudamenlnviatfs2umum no4olx iictydla elumont4artnmr to1fm   n i s0 rumir iudol n ieia(fa2rmu pno0tle  iciys a2rluvp t4tltomo3oadfpDrauvi s0 rtr(rpoudolt  ncs tfsrra(m oo0tex moeiydlm2rmnmpnu0teerxocoodlaD  neo (0t2umirpoydamenmnvsasfaruaum ot1tle ioeiatfa emnmpnt0 exnxfctytfpDrau o (  rxmxr3nudoptelics ()a2rr(rono4tetomoeiat aDrln s;(4 eerxo iadom e ues t0 exrir nu4alenlivtl() Duax o;t4tleomo3tltfaDuaums;(0alerxf3iydfa  anvi (0teumir iu4lm e iesa(fsrtrxmont4olx ifcildfaDranvs t4artrxocta1fpD  nvi ()seurir3nudol  lnesas a2rm(rpnt1tpen fctld m ea(mont)aetrxoctytoa e iesl(  eumxrpiydaptemfcil(  2trxrpou1aptnmi3tydfsDem(mo (0 ltomr3ty1lmDeluei;(0seurimpoy4ole mfcs s) Durxronu1oleoiocildls uln o t4 lenxfctatfp rai ils0 euoir3iodlpeelnvil()srrrur ;u0alx iocild s ranvo (4aetoiocoy1latranvsl(0setoir no1lleelncsat) Dtaumpot4texomieiytla2rlnmo;(0aetnmo totlpDeluvo t0 2xo(rpiy4omte fvs s s2tm(mpot0tpx  ociadls2ea( o;t4aexnir3tytop  livo (0s2tmio3ou4omenmfcilsf 2rmump;u1olen iciatla2eaump;t4 rxrxo iodlptrlneil( t2tmxr3oy1ame mfci t)s2uaxrp;t1tex  o3iat a uln ont4altrxr tytlp   n olt0seumio3iydopt licsa()aDuaxm ou1open ieiyt sDrmnvp;t)tlermrctytlaDe neilt)s2tmxm3no4lptelfvt ()srtaum oo1alto o3ildfa emn o u0 lxrio todomteln olt)t2umxrpiodolenmicil( s2rrxro;u4tpx mi3iys m eaumon(0teeoxocoodlaD lueolt truoxopoudapenmnctat srta(mp;o1tlxoifeiyslaDul( s ()teenmrcoo1oatrlivi s t2trio no4ol nmnviatfsrtmx  nt1aetomietldfa2ea( p t4aexnmr3iadlp   n s;s0setrio3io1olt livi ( s2tru p;u0tlt  o3tysfmDra(mpnu4teeomrciotlm  lnei;s0texrir3oodal e net (  rra(  ot1alto f3iatlm2uanvo (0 rxnmr3tatoat  ivs s t2to(m3iudoltn icia( srta(mont4oetn octas mDuanvs;u4tltoifcoatopt  u s s setr(rpoydap   ivt s aDururo;t1tptnioctadls raumsnt)tltoio3todlpDrln o;( trxmir oo4olee nvsls  rra( o;u0olt moeiysfa2umums;t4artrxrcoadlm  lu ol( srtmxr3ou4openlicils)aDtaur ;u1alt mi3tadfsDumn p u)artoircoadfa r i s ( s2xm(o3nu1lltnmnvsasfa2taum ;o4opxnifetldlaDrmnmp u)teerxr iodlp eliei;()t2xoxm ou4ameelnvt tfaDtaur ot1tleoif3ilsfaDuauvpn()tltoxoctadlpteanes;s)s2urim3ny4ope miet s sDtm(m ;u1tleo feiasfaDra(vonu)aeeoxf oodopteaiesl(0s2toio3oo1omen nvi sf 2tm( ont0opt ifcilt mDeln o t4trenxr oo1latrlivols)t2tm(o3iodlmeelnctas a2rmumpot4oetomi3tytlsDrm( pnt4 ltnmrciydlmDrauvs;s)t2xo(o iy1alt livtlt)srtrx  ot1oexomo3tydfs2el( s;()tlxnxrcoy1fmtr i i;t0 2uriopny4lpeelicsas)srum( oou1aetomf3tls aDel(mp t0trtoxocoydlatrlivi ( texoxr nydale  ici t)aDrmxm ot0oeto oeiytlmDea(mp t4aeenir oadoa ranvolt0 eumxrpoy1alenmics s) rtrx pou0aee iieiyd mDuau pn(4aleoxrcio1fpDrluvs ( teuoxm io4am n ieslt)srua( poo4olx mocild a2eau s;u)alerio3todoaDe u i;s seuoirpnudop elivt t  ruaxm ;t4apx  ieiyslm rln snt)areoxocoytop rlies;s) 2xm(mpnydlle mfvi (  2rr( p;t0oexoii3tlslmDrmuvo t) rxrmo3oytfaD  u i;t0t2ur(mpnu1ole mnei (fsrraur ou0aet moeiltfm2eanmsnt0tltnircoadfmD lues s0t2xoxr3ny4lltemfci t)a2ur( p;o4apxnmi3tadla rmn on(0altnxociodlaD  u s;( trtm(rpoodll n feiasf 2urxmont4aee mf3tas a emumont0aetrifctytoat lu o;t  rxoimpnodapeemnctat)arrruro;t4open feiatla rm(ms t)aetomfcio1fp rlneil(0 2ur(m3nu1apt lietl(f 2ta( ont0oexo oeilslsDra( p u4 etriociadlmt li sls0s2umirpno4op nmnvt ( sDuru o;t0tex moctld aDeauvs;t0tlermf tytlm ran ols) etmxo3ny1llenlneil()a2uau pou4tltoifciatlm ean o;u) rtnmo tadfpDr nvsl() 2xmiopoo1am  mfvsas)aDtrxmpou1tpt  f3iytlaDrauvo t)tltoif to1oaD lu ils  etoxr3ou4altn ictltfs2um(mont1tltoioctatlm em(vpnu0altoiocoy1fa  lieilt0 etr(mpiodlpt mnei tfarur(monu0tex mfciyslmDuan pnu0texoir todlpteanes ()seuo(mpnydlme  fcil(  rtr(r nt0opt mo3tls m eaums t0aetoxr3oo1omteaues;s s2ur(rpoo4lltelnciatf rtmumoou4tle mf3iadlm el(vo (4tlenxo ty1lm  aueilt0 etrxm3oo1lpee fcslsf Durxroou1tetnifeiys aDuauvs;t) etrxo3oytlptr ieolt t2umxm3iydlm nmnei t  Dtruronu4aleoif3tas s2rlu snu4arxnmociotfptelneol( seum(m iydlm emivi ( a2trxrp;o4aexomo3iatlsDeanvpnu)arermr iytfpDean s t) rto(m3iudlmt  ncia( aDtr(rpno0aexn i3tas m2elu o t0trtoir3iotfaD lieolt)trxoirpno1olte nct s)s2tm(mooo0apxo o3iydfsDel( o u4 exoxr iy1lptrln sls0s2umxopoudlleemneiat  2umxm ot4oexnmocilsfaDean o;()tlxrir3iydfp eli ols)t2to(mpiu4lmteliesasf 2rru p;t1openifeiltlsDrlnvo;u)alxoif iytlptelneolt0 2xm(m3nu4al  lfvta( artm(  oo4aetoioetyt a uaums t4 ltoxr oy1fat an i;s srumim ny4lp elfcs ()a2trumpnu0tetn iciatfa ra(msnu4aetnxo tydfat  iesls) rum(m3nydolenlietat arumx o;t1aetnioetld sDrl(vsn(0 eenxr3oodla  lu i;t trtoxo nudomenlieils)a2trxrp;o0olxoiieiadlmDea(vo (4arxrmf iadoaDelnesls0 exm(r3nodam   fvi t)arraxroot4opt mfciyd s eau p u4arxoir3ta1laDrli slt)s2urxo3iydop  lnvsatfa2ururpno0oet if3tlsfaDrl( s u4trtrif oo1fm   n ols sruo(m3io4apt mietl( srua(r nu1tlx  octatfmDulnmont)altrirciadlpDe ues;t seur(rpny1am nmivtatfs2um(mpot0apxnmo3ildlaDean s;()alxnio ty1omteau il() exrio oudapeelnvi s aDtmxmoou4tlxomictytlm rl(vp t)areoxr iatlmD au i;s0trtr(o3iu1alt mnvta(f 2uaxmonu1olx mfeild m2ranvo;(4trxnxr oo1fmt  ueils)srurxo3nu4lm  lfciatfartmxrono1tleomfeias s rln o;()teeoxr ia1fpt lues s  exrir iy4ll  lictls srtm(  ot0tltomfeiys m ulu s;(4 eeoxf iadoa eluvsl(0t2xrio oy4al n ivtlt)s2rmxmp;o4oeeomf3iltfaDum(msn(0 etnmr3iodfmtrlnvsls setrxm oo4lpt  fvslsfaruru  ;t0optomo3tldfm2ranms t0 eeoxfcoytoat au o s0s2trxopny1ol emivslsfsDtau  nu1oetomieiytfm uln pn() eeomf3io1fm  aieo (0 rtmio iudoltelivtat sDururpnt1tpt ifetat a ean s;u0altoir ta1lm   u ols)sexoir nu4amen ieilt  Duax oou1oet  ieiys m2el(ms;t0 rtoir3tydlmDeaueslt)sexoxrpnudapenlnvtas)sDra(rpou1ape iieiyd mDemn o u0arxrxr oytfm raivilt) rtr(mpio4lmtemfeil( srrmxmo;t1texn fciytla ra(mo (0arenir3ootom ean s s0 2tmio3oy1apeelieia(fs2rmum oo0altomieiadfs2rmnmo t4 etnio3tadlp  anvo;s)tetr(m3iy1aptn ncia(fartmu poo0tee mietatlmDelnmonu0arxomr ootfp eaneo (0srum(opiy4olt  fetat) 2ra(rpot1tlx ioctldlm rmnmonu4areoxo totlm eauvo;t0s2to(o iu4al nmfes s)sDurx ont4alxo octat a emnmp;()artoircta1op eanvi;()t2umxr3ou1ap  mnei ()sDta(rooo1olt iiciadfsDumumont4 ltoircoodopDelueo;s teuoxo3ou1alenmieils s2rmxrp;t1tle mi3iys a uau o t0 rxomr3tydop raiei ( t2um(r oodlle  nvsl(fsDtmu oot0texo o3iasfm ulnvs;t4aeenirctytlm ean olt)trumiopny1lltn iet s s2rm(  nu1olxo i3iyt s rl(vo;t0trxnmfciy1fa  lueo;()srtoxo3iy1amtnlnctl(fsrurum oo4tpt ioctytfsDeanvs t)altoio3iy1fmDr ueslt teumxmpou4opt mfcsatfa2rruroou0apeomoctltla2rm( pnt4artnmf3oydoaDean sls  etm(opoo4aptelfct sf 2uaxr oo4teeo ociytfsDrl(vo ()trenxo tydlmteaivs ()trurirpnydaltnmnci ()aDrrxmpoo0alenioetysfs uanvp t0 reomocto1lpD ai o;( t2urxo io4omtnmicilt) 2umum nu0alxniietas s rm(mp () lerxf3tadop eaues s  2um(r io4llt licsltfsDtrurooo1oltoiicilt mDemums t4 rtnmo3oydlm eaueolt)t2uoxrpio1optemiesat) Drrxmo;o4opeoiietlt a ra( ont0 eenxfcoa1fatraieolt srxmir3oy1lmeemfviatfs2tmx pno4oleo i3tadfs ea( on()arxrmr tytfmt au i;t0 2xrxm oy1lme licta(fsrtm(mp;u0ope io3ils s2eaums ()tltoiociydoat liei t  rtmiopoy1olte ictls sDumur no4olxnmfeiydfa2rlnmo (0aeenxrciodlpDeaiei t) 2uoxm iu4olt mnvt s  2rr(mp;u4apto ietad a2rl(vo u4 rtrxo iadomtrlieils)s2xrxo nydlpt mfvsl( s2trxm nt1optomfcildls2ua( p ()trtrmf tadla rlnesls0 2trxo oy1lpte nvta()a2rau pnt4aexomo3tad m rmnvs;u0arenioctydop raivo;() rumxm iodoptelfvi tfs2tr(ront1alenii3tls a2umnmpnu)teerxo ootoptean sls teumio nydapeelfvsas)s2raxmp;o4alenmiciltfsDeauvo;u0trtoxf3iodfateaueil( trtm(o3ou4apen icsl(faDraur ot4opx ifetyt sDrln ont0 rtoxr iotfmDranvsls  2xmxr3oydlp e fesls)a2taxr ;u4apt  ietatla2rln s t)arxoxr iydfaDean sl() 2xoiopiodome mivs t)s2ta(mpno0tetnifciydlm emnmp u0aexnirctydlmDelies;t)t2ur(o nu4ol nlfvi (  2ra(rpno4texn feiltla2eaumon(0aleoir3iatoaDranesl(0trtm(o oy4lm nmicil()sDrr(mpoo1apt mo3tydla umu p;(0tleoircty1laDeli ils0srxoir3iodll  mfvi s)s2tm(  nu0altoiiciyslaDrm( sn(4 rtrmrcoadopteaueo () etm(mpou4alt lfvsl(fsDtmumpno4tetnmictatfsDrmums;() eenif tydoptrlues t  rxoxr oudlptn netas  Drr(m no1oltoiicilsfs ean s;()aleomfcoo1lpD au il( trxmxr iy1open ivs ()aDur(mpno0oet  ieilt aDeluvo t)tltoifcia1op  lues t0setoxr ou1ol  livslt)aruaurp;u0oexn feiydfm2rluvs t0 rtomociytom r ieo ( s2trxo3oy1am e nesl(farrr(  oo0oleoii3tysfa uluvs;()aexoio3iy1fmt  nvs;t) 2umxr ny4aleelnvsl() Dtau  no1oltoiiciltlmDeaums t)tlerxo tadfateluvo s0 2ur(m oodol  lfct ()arurumpou4aeto oetltlsDem(mo (0 rtrxr to1fat  uei s0seumxr no4lp emncta() 2raumo;t0tlenifeiys mDrm( ont0 leomocta1faD lu s;s)t2tmio oydllt lfvslsf Duaumoou1opxomoeilt s2rluvpnt4 reoxr3oytfm  livols)setrxm3nu4op emfciatf 2taxro;t4oleomoeiat a ra(mo u4trxomr3ia1fpDr ueo (  exmxopoydamen icsa() Dum( pno0tltoii3iysfa rlu on(0trermrciotfpteln s;t)seum(m ny1lp emictatf Duaxmono0olxnifciytla2uluvo;(4 exomo3todlptrlneols)t2ur(r io1al nlfctls a2uaumpoo1aet ifeias aDrlump u4trtnmfciydop raueo (0 rtmxrpny4lpenmnvtasfsrra( oou4tpt  ictatfaDeln pnt0aleomociodomDeaivi;(0s2ur(r ny4apte fetat  rra(m oo4oltomociyt a2ul( s ()aeenxrctotfa r u s s)truo(rpny4ol   fvta(fsDtrxm nt1tptomoeiyd m rm(mpn()tetoxr iydopDr nvi t  rxoir iodale lfei tfa2trur nt0teen feiytfa2uau snu4 ltnir3oa1laD li o;s0teumio3oudamt licsa( s2tmuroot4tpx  ieilsfm rmu ont4 lxrif3iadlmtr ues;s)trtr(opoodlmeelfet ()a2trxrp;o0opeomfcias aDemuvo;u4artnxf tydlpteliei;(0srxrxo3nydolenmiciat) rtrxrpnu0tpx mf3iltla2elnms;u0aeeoio3ty1late i ols)s2xo(rpnu4lltelnciasfaDrm(ro;u4tptoio3ildfa2ul(monu)aeeoxo to1omtr u o;t0 2uoxmpiy4lptnlies s s2raxmp;t4alt ifeiasls2em(ms u0areoio3todlaDrli ilt)trumim3nudoltemivtls sDrmum ;u4oetomociadfsDemu snt4 rtnif3iy1lp  aneil(0seto(mpiudamtemiei ( sDumu ono0oeenifcils a ul( p;t0 leoxr3tadom r u o (  2urxr3iydope mieiat aDtmx p;t4ale  ieiat a2em(vp;u4texoif3tydoa  aivi;t0teuoxm3ny4apee iesl()sDta(mpno1ole io3iadls2em(vp t0 leomf3iodla   nvs;(  2tmxo oo1am  mfvs s srtaxmonu0apeoiieils a umn o (4arenxrcio1omD an s ()teto(o3iy1ale  nvs ()sDtrurpnt4teenioetlt a2um(vsn(4 leomr io1fm elneolt  eurio ou1lp  mfcsltfsrtmurooo1aleoiiciytlm2emnms;(0 rtoircia1op  auei;s0trxr(r iudop   ieiasf Dtmx pnt0tpeomfetad sDemuvs (4trxrif3tytfmtr n ols)texoir io1omt lfet sfs2urum ou1oetoii3iat m2rm(ms u4tlxrxf3todlpte iesls trtoxmpiodlpt lict (f ruaxrpou4ale iietydla ea(mo;u0teeoxocio1opt lnvilt0tetrio oydom  mivt (faruaxmpoo1tex io3ild a uan onu)aeermf3oa1omD aueo;t0 rxmim3no4oleelieia()arrr(mp;o1tpxoif3iys aDul( s u4 lenmocio1laDrlu i;(0seuoir3no4lltn fvtat srtmumpnu0oee ioetatfs eanmo;u0alxrmr oytlm e n o;s)trumir3oo4am emnvs t artm(roou0tpe  fetas m2elnvonu4tlxomrciydfa e ies;()srxo(o nudlpe mnvia()aDtrumpnt1opeomicias a2ulnvsnu4 renmf3oodfmDeauvi;t0 ruoirpio4aptnmnviasfsrrrxronu1aee moeiadlaDem(vs (4areoxr3ia1fp   ieo (  rumirpiodop emiei s aDtax p;u0aptn f3iatlaDemuvo;(0 ltnmf3ootfptrai sls)s2xoim ou4am e ncil(fsDtrxm ;t4tltoioetyt aDeluvo;u0aeeoio iydlm rliei;s)srumxr oy1ap emnesatfs2trxr nt0altn ietlsls eauvp u)tltrio3tatfaDr ueo t)t2xrio3iodole mnvt s)srua(rooo0tltnmociydlm2rmums;()tlenmfcia1lmDr uesls0t2uoirpou1ap nlncsls arrmumpno1tetnii3tls a2um( o;t) leomo ta1fm rai o t0srumim oo4lp n iviasf rrr( ont4tet mfeiatls2uln pnu)trtoxfciytopt lnei;t0t2triopoo1ap  lfvsa( sDrau oou4oex  ictatfa2um( onu)aeenmoctadfa rauvo;()t2xm(m no4lpenlicia() 2rr( o;o4tet  oetys aDumn pnt)teeoifcoatlatrliesls0trumxo oy4op  lici ( srtrxr no1tetnioeilsls2uaumsnt0teerxf ia1lptelieo;t) etoxm nu1op  mfctls)aDraump;t1open octad m eanmpn() rtrxo oytomDeaivi s srtoimpny1ap  lnvsatfsrrru onu0tltnioeiadlmDuanms t4teerxr3oo1oaDeauvi;t0texoxo3ny4lp elfei t) rum(rp;o4aexomo3iadfsDrauvp t)tlermf oytop elies;()trxmiopoo4lptn fvsasf Dumum nt1tlxnmo3iyd a2ulnvo ()artrxf3iodoatran o t0 rum(m3oy1open ies ()sDtax o;u1oet ii3ias m2ulnvs (4texoifcto1fmtelnvslt0 2xoxo ny1ap n nesl( arrr(rpno1tptn ietlsfa2umums u4 lxrir iadfatrluvs;t s2xoxr oudam nmnvilt)s2tau oot4oeeo feiytfa2ran o (4 exrmfcoa1lp eluvs s)t2xmimpoo1ame mfeiltfaDtmxmpnt0tltoif3ildlaDran snu0teerif io1fatr neo;s srtrxmpou4apt lfvtatfs2trurpnt4aexnmieiadls2elnvs;u0 rxrmfcoadlp elneo;t0tetrxm3oodlpeelfvtl() 2ta(mooo4tlxoioctatlaDrmumo u)teeomo3iydfa  lnvi;(  2xmim oo1op n ivsls)s2tru p;t1oleniieiyt sDelnvs;u0 rtnxrctytfmDrlneo t)s2uo(o nudalenmiesl(f 2uaxrp;u4alxniociat a rl(vp;t)aleoiocia1fpDraieo;s)trtoim iodlltnlfctas) rtrxrp;o4texomieilsfm umump;()arxnif ty1fm eli s;t)s2um(o3iy1aptelncsas sDraxmp;o0alenmf3tysfsDea( o u0tltnmo3io1lmDr ivs s setoxopnydlleemnei (fs2tmum ;t4aeeoiiciadlaDemn p;t4 etomr3oatlaDeai o;() etm(r3nu4ale  fei tfsDrrump;o4opx io3tysfmDea( pnt0alermf ootomte i o ( texr(m no1alen ivt (fs2rr(r no1apenmoetytlaDemnmo;t)arxniociatfa  lnes;s sruoio3nudoptn fvil(fsrtmx p;u4tlxnmfctatlsDuaumo () lermrctodop rln sls0trxmim iudop n iei ()a2rm( onu0aetnioetatla2ranmonu) etrif iy1oaD auesls seurxmpiodlltemfei s a2trxr ;u4apxomiciltls2eanvo;t4 lxoxr3oo1laD  nvils0t2tm(rpio1opeemicils  rum(m nt4oexn fctld m umn s;t4alxnxfcootlmD  uvi ()teur(o io1lm e nciltfsrtmx  nt1optoiieildfa2rl(vpn()aeenxfctatoaDeauvs (0t2umxr nodllt lfvtls  2um(ronu1aexn ietatlaDumu snt) ltnmf tydfmDrauesls0srxmxr3oodop elfcilt aDur(root1aleo oeildfa2uan onu0artrxf3oytfateanvolt  rtmxopio4omte ncil()s2um(ront0tet  ietydfsDra(ms;u4 rxrmr3oa1opteanvo t) 2urxmpiy4altn iviltfsrum(rpnu4apeoifciys s ulnmpnu4 reomfcoytoatr n ilt) eumxo iodlptemfei ()srum( p;t0oetomi3ils a rlums t0 lxrmr3iatomtrluvils s2trim nudlp  lnvil( sDur(rpou0apxomoeiytlm2ul(mp ()aeeomr3todlpt  ieo s)sexrio3oy4lmtemnvias a2um(  nu4olen icils sDrmu o;u)aetrxfcta1opt  ues t0 2tm(r no1altelfetl() rrmum nt4oee mieiltfa2ranmonu0 eenxo oo1optelivs (0t2umirpiudll n fvsls)sDrmx pnt1oetnmieiytlm2rmnvo u0tlxoxf3ia1omte i sls trtmio nudaltelivilt) 2rrurpno4tpxo fctad s um(msnt0teenio ootlmtelueslt0 2xmimpou1lpenlncsl( sDtru ono0tptoiietldfa2el(ms u) reomfcty1oaDeln i;t sruo(mpno4lme mics () rururpnu1tlt if3tldla ra(vonu0 etnmociy1oa e nvs;t0srxr(o nydalenlfvs s aDtrxr ;t1aleomo3iltls2uau s;t4arxnxo oytlp  ln o t tetm(m3no4op n fcsls a2trxr ot4tleniicias mDra( pnt) etnmocoy1fpD  neo;s)srxmxm oy1lp nmivi tf rtax ono0apxn octlslm2ran o;t0 ltomrcoodfaDrlnei;t0seuo(mpny1lpt lneil()a2rrxr no0aexomfetytlaDrln s t) ltnxf oadlat lu ils  exr(r3no1ole  ivia()a2tax p;t1apxoifeias sDulumpnt0tlxrifciotfa   ieo s)s2xm(m3nydop elivta( sDumxmpnu1opxoio3ildlsDelu s t0 lxrifcoadlpt an i;()texo(opnudape lictat)arum(m ot0texnmfetytfaDrlnvo (0alerif oytoaDeln i (0 exrxo3io1lltnlfvia(fsrrrurpnt0apen o3iadfs2ua(ms;t)aetomf iotlpDeanes (  rumxopoydlmte fvilt  Dua( p;o4aet ii3tysls2rauvpnu) rxrioctytom ranvol(0tetm(o oo4ap elivta() Dtr(mo;t4alxnio3iytfsDemn pn()tlxrxf3oodlpDranvs ( trtoimpnu4apeemivtasf Drm( pnt0altoioeiydfm2rmu s;t4altrir3ootlat auei;t seurio3iy4lm nmfvs t a2tr(ronu0tle io3ilslm2rlumo (0 renif3oy1fmDelieo () exmxo3iudal nlfeils  2tmxmo;u1texo ictydlsDra(vpnu4tlermo3totfm eliei;s  rxr(o3oy1apeelicsatf Dur(moou4tpxnmoetysfaDrluvo u0 reoxf3oatom   i ils  rumxm ny4ome  ivt s sDrrum nu4tex miciadls rlumpnt0trtnir tydlpt  ieilt trurio no4ll n nctas)aDrrur nt4oex  f3tadfaDulnvonu4texnmr3oydfmtr i i;s s2uo(mpno1lp elncs s a2tmu p;u4opeomictatls emnvp;()teeomr todop elivs t)t2xo(mpno1alee feiltfaDrr( pot1alx  fcildfm2ranms u4aeenmf ty1fatrlnvs;t0 2xoxrpiydlp  miesa()a2rm( ooo4teen o3iydfsDemumon() rtrmr3oytla elueo t)srxm(o3iu1ap elfvilsf Dtr(m nu4aeeniictltfa2umn p;(4aexrmo3ia1om  lneslt) ruo(opiu4lp e fcilsfsDumumoot1opxn iciat m2eau p (0trtoifciadlmteaivs t) 2xoxmpoodomtelfviasfaDtaxmo;t0aleoiicildlaDelu p u0 rxrxf oodfm r uvsls tetmxo3ny4apee nvsa(fsrtmxr ;t0tet  ictas sDum( p;u0 lxrmrciodlpDr u ol( seumio ou1lpt  fcslt a2urumono0tpe moctys s uaump t) renmf oodlptranei s  2xoxm3nudol   fvtatfaDur( o;o4texn i3tasls ua(vsnu0 ltnxo tadop e i il(0 2xoxo3ny4lmee iesat  Drrumpno4aee mi3tysla uan s;() exnmrciodfpDe n s;s0s2xoxm ny1omenmivtatfa2ur(ro;u1tex moctlsfaDeln pnt4aexnxr tydfpD lnvo t0 rxrxo ou4ll elfesltfartr(mo;u4tpxnmicildfaDrmu o (0alxoioctytlp e ivs ( srxo(o ou1amtnlfvt sf rtmxmp;t0aee ifeilslaDua(vpnt) ltrif tydoa eln o () exr(opnu1alen fvi tf 2tr(m ;t0opx  ietlsfa2umnvo;u0alenxr iodomt aueols0 2xr(rpoydopeelnvtatfaDra( pou0oetoio3iltls rl(mpnu4texoio oodlp r i s s)setrir3nydale  fvt sfarua(mo;u0aeen iciyd s ua( s;u4 etomo to1lptraieil(0 rtmxm3nu4ap e netl() 2um(rpno0tpxoif3tld a2uanvp t) lxnxocootomteaiei;() 2tmimpoudop  mnvias)a2ua( p;o1opx  fctas aDrmn s;t4aexoxrcio1lmD aieslt setmxopoodalenlfcilt) 2trx ont0ape  oetltla2ranvo (0texrmo3totfa rauvsl(0tetoxrpiudlm n fcs ( a2umxmoot4ope ifeildfm el(vo;t4 rerio iy1fm  lnvi s0s2xmxo3ou4llee fci s  2urxmp;t4opxo oetldfm elu on(4tleomocoo1fmD lueo;( teum(o ny4ll nmfesas  rraxr ;u1aptnmi3iytla emnvont0texoif oytfp rlieo s)teuoim3nodom n ncsas)srta(r ;o4apen ietat m ulnvo t4 lerxfcoy1opteauesl(0sexmio3oo4lmtelieiltf rtrx pot1apxo octasfm2elu s;(0 etnir3ta1fpDrlieo t0 exo(r3ny1ape  ivi sfaDrru p;o0aexoio3tadfaDumumpnt4treoir3oydfaD an i;t  2tmxmpoo1lme miet t sDrmu o;u0aptoif3tasfa2uluvont4aleoifctotfaDr neil( srxmxopnu4lm emfvslt)s2rm(rpnu0texnif3iysfs2ra(mp;u0texnifcia1lp ranei;(0srtmxopnu4lmenlict s)srtmur ;t0aeenio3ils a ra(ms (4 lxomrciytfp rlnvo;t)t2umir iy4al e fcsatfsrum( pnt0tlxoio3iatlm2rmnvs u)alxoifcoydlmDe nes;t)trxmio3nu4ol  lfvi s) Dua(mpou0tltnmf3iatfsDua( p;()aeeoxr3to1om e nvi;s0srxo(o iy1lleelfetlt srrmu  ou1tlxnmictlsla2rau o;(4 rermrctodomDraieo;s0t2ur(m3oo4ope mfvsa(f rum( pou4oetomiciyt a rlu p;u0aeenmf ta1omD  ieo;()t2xrimpnu4amtelnvtat aDrrurpoo4olxniociasfaDeauvo;u)aeeomfciadfpD ai i ( srumir3oo4ameemiciasf rrmx ont4tee ifciyt aDumu snu)tlxomrctytfpt lieils0seuo(r3ou1apen nctl(f 2rmxmono4tee  f3iytfa eanvp;() rtoxf iotomteaneilt0srum(opno1oltnliei t srra(mpnu4oltn ieiysfmDrlums;t0tleoio to1omteanvolt s2xm(r3iydam nlnesls)artmuroot4altniieiatfa2ul(mo t)trxrifciy1opDrau i;(  rxoxr iydlpte iesas) rrrxm oo0open f3iytfm2emnvs;u) eerif3iodlm eaivolt)setrxo3oodol   feta(f rtmumpnt4aptoif3iysfs el( ont4 leoxrcio1fm  lueilt teuoiopiu1olt  ies () rrmu  nt0ale iocildfa um( pnt0texriocoatop rlies s0trxo(o no4opte ivtlsfarurumo;u1olxomociysfa eln o;u)aexrmr3oydlp eanes s)s2xo(r iu1aptn ncs s srtrur ot4texo i3ildlm2umu pnt) reomf iotfa rli o t)texrxo3nu4open ietat srtrur ;t0alt mfetysfm uanmont)arenmr tatlaD lueilt0sruoio nu1lpt mneia() Dtru o;o4tlen f3iatfsDrmn o t0alerifcio1lmDe uvo;t  rtrxr nydomtn fvtls  ruru ont1alt mictytlm2eln onu)aexrmr3iadfpDr i s;() rxrxr iydom  lfviatf Duaxmo;t1alx  i3iadfa ra(ms;u)teerif iytlm  lu ils  2ur(m no1op  lnvilsfarua(mont0aeenioctld a rmump t) rxrio3io1om eaivil()srxoiopnu1op   fvs ()aDtr(  nu4oetnmiciydlsDranvo t0artomo3ia1fa  aieo;s0 exmxm ou4lmeelietas) rta(rooo0aptomo3tad s ul(vsn(4aexnmfctytoat lnvi t) eur(r3oy4omenlnviasfarurumont0oex mieiytfm uluvsnu0 lermrctytlm   n o;()t2urimpno4aptemnvia() Dta(rpou1ale  iciltlm rluvp u)tltrxo iotopte i ol() 2um(rpiy1op elietas)srrr(monu4opxnmi3iadlsDea( snt)alenxfciytopD  ivils0 etmir iy4optnlfviatfsDtauro;u4alxo oetlsfaDulumont0 rtnir3todfmt  n i t) etmxr3oo1llenmivtl(fa2rr(  nu4oex iietl
\ No newline at end of file
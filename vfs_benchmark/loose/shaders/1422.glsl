@@ -0,0 +1 @@
+ivi;t0 2uoxo3io4omt mnes t)srrmxmoou1tlxo i3iatfsDulu s (4teerir tadlateaies;t)trtrim ou1omeelnct s artaxro;u1tleo fetat m2uluvp t4altnir ta1lpD au sl()teto(m3oo4oleelncsat) 2rm(  nu4tltniocias sDran p t0trxnxr iatfaD  nvi;(0trxmim3ou1olee ivia() 2tmxmoou0tleoiiciys m rl(vo t) etoif tatopt  nvi;t)srur(r3ou4lle mneslt) rumu oou0oee  ietyslaDuaums;u4 etomr3oodop rauvo;s0s2xo(o ou1ome lict t)sDtrurpnu0oeeoiiciys a2emumont0 rtomfciydfa rlnvs;s s2tr(r3iu4opee ivi t)a2raxmpoo4tpt if3iyd a uau s u)aexrioctatomt auvo ( tetr(o iu1lp nmfei t s2tau p;o1oexn f3ils m2ean p;t)tltrxo ta1oa elu i;(0 rtrir3nu4am e icsl() rrm(r no1tptnmfeiadfm2eanvo;t)arxoirciytoaD  neo s0 2xmxo3iy1optnmnviltf ruax pnu1apen ociasfm2rlu o t0 rxrir ta1op rlu o;(  2xoxm3oo1lpen fvtat artm(mp;t4texo i3iat m2rlums t0alxnxocoytopD lu ilt s2urxm3iu1om e fcia()aDrm(r ou1tlenii3iatlaDeauvo () leoxfciy1op   u sl() ruoir iodlpe lnesatfarumxro;o1tpeoifcildla uluvo (4 rtnir iytomteanei;t0tetrir3ou4om n ivsls) 2rm(  nu4tpx mfctlslsDum(mon(4tlerio ty1oa rlnvsls  rxmxrpio1lltn neiat)arumumpou0ole mi3tydlm rl(mon()tlxnxr3to1om   uvsl(0 rum(rpoodlleeliciasfsrtmur no4aexomf3iltfaDuluvs (4aetomr3tadfpDeli sl(0t2uoir3iy1ll  lfesatfs2rmx  ;u1olx moeils a2eanvsnu0tltrmo io1lmtelieslt) 2tmxo3nu1opeemfetas) 2tr( onu4tetnmi3ils s2ul( p;t0trtnxo3tatomte i o s) rxmxo3no4lptn fetlt  Drmu  ou4altnmo3iydfs2ua( p;t4 rerxr3oytfptranvo s0t2trirpoodomte ictls srra(moot4tlxnif3iyslm2eanvo;u4tetrxo io1om r neo ( s2xoxmpiy4ol e fvi tfsDrr(  ;o1ale  f3tlt m2rluvo u4tetoxrctytfmDrli ols)setr(opio1op nmivsat)s2um(rpot0alx iociytfm emump;() etnmf to1lm  livs s srxoxrpny4altemnvtlt  2uaxm ou4tleniiciadlm2ulnvonu0aexrir3oy1lpDeanvs;t) etrir3iy4lltn fei sfsDuaxm oo4ole ii3iyd a ua(vo;t0 rxoxo oa1fmteliei;s  rxmim no4olee net s) Dtrx  nt4apeomocild sDumnvs t0 lerxoctotfm rluei;s)t2um(rpio1ol  mivi s)srtr(roou1alxnmo3iytlaDrmuvp u0tltrmf iydfmteaivsls trumimpnodlle lnctlsfartax oou0texo f3iat s eln o t0tlenxf3oodopDrln s;t)trumir3nu4altnmivtatf 2rmx pot1tpxomfetlt aDum(ms;(0teenioctydla r ueolt)t2umim nodlptnlneiatfsDra(ro;o0tpenmociatfs uln pn(0aexnmo3oo1oatraieilt tetmim io1optnmics t a2uaxrpnt1tpt  oeilt mDua( p;() etrmo iydomD lies;s)s2urim3ou4apt  ncsat aDumx o;o4oexomieiyt s2ra( p;(4tlxnir3oodoa  lneo (  2uoim3no4ol elfvil() 2tm( oou1aptoif3iadlm2uanmo (0teermr oadlat ln s ()texoxm ou1ap  lfvsa( sDurxmonu0optomietyslmDulnvsnu4 rermociatfmDrli i ()srurimpoudlp emietl(  Dta(m ;o0aeeo f3tltlm2uauvon(0texrxfcia1fat aivs s  2tm(r ny1opte fcslt)a2tmu oou4oeeo ictadfm umuvo u4arxrxrcootfmDr ivsl(0 etoxrpoy4apt licsl()sDuaumo;u0tpe ifciad mDran s;u4teermr3todlaDe uvi;s) ruo(r3iu4op elnvia(fsDuaumpno1optn f3ild aDeau s (4 exnxrcto1fp  ai o (0trtoiopiu4lptnmnvt t artm(mo;u0oetnifcilsfs em(vo ()artnmo3oydomDeaivi t)srtoxrpiy4ope mnctl() rumxrpnt4alto f3tls sDumuvo u0aetrif3iodlm  aivi;() 2ur(opnu4lp  lics sfsrrr(mpno0aeen oeiysla2rm(vs;t0 renxrctodfmD lnei;t t2umirpnudopeelfvi s a2rmxrooo4tetniocilt aDumnmo (0aleoxo3tydlmt livo;s)t2trim no4llen nvils) 2rruro;o4alen ieias m2ua( onu)aeeoir3oa1opDrai s s0 2xm(mpou4optn ivsa()sDtmu pnt1olxn octas s rluvon(0arerif3oydomtrlu s;s0 2xrir iudomt  neil(fsDuaurp;t1oleo ietld sDumump u0 lenxrcoy1latelu slt)srxmim3io4omt  fct t) 2rrum ;t0tet mo3ildlsDeln o;(4 ltoio3iydopD aies (0 eum(rpio4altelfcsls)aDtm(ront0aexomfeiysfa2emn o;u0 exnxf oodom e uvslt)srtoxr3iy1amtn nvtat)arur( onu0alxoif3ildfs rl( pnt4alxnxr iydfm eli slt  rtmxm3ny1ape miesls  2rmumpot0tet mieiyd mDrm(vs t) rtoxociytoa rluvslt0 etr(mpoodlpe lncias)srum( onu1ale mf3tltfa ua(vp;(4tltoxo oo1lmD  nei s0sexrxr3oydole lfct s arra( onu0oleomi3iat aDumnvpnu0 etoir iatlpteau i;s truoim3iudapeelicsl(f rtmu p;o4apto iciydlmDraums;u)tlxrxo3oodfpDr ueils)trxm(o3oudal nmfetlsfsDrrxrp;t4tleomieilslmDem(von(4tltrxfcoadfatrli s t0 rurimpnydamee ivt (f Dtm(m oo1apt io3tatfs rmuvs t0aetrxf3oytfaD li slt) ruoirpno4opt  nvtl(faDtm(m ;o0oltnmfcils m uan on()tlxrxo oytfaDr i o;(0tetmxo3iy4amtnlnes s)sDtrx  ot1tltnifciasfm uanvo;(0aeeoxo iytfpDe nvs;s  2xoir iydlpe  icsat) Dua(mpoo4tpt mociydlmDulnmp t4teermo3oo1om rauvo (  exrim oy1lp  mfesa(fs2taumono0oee ifciysfm2ua(vo;(0aetnio3ty1fpDeanes;t t2xmio ny1ome lfcsl( a2umu  ;o4opeoiieias mDulump;t4 rxoio3to1omte u ols0 eumxopiu1am nlfvtas) 2rmxm nt0oexoifciytla2rlnvonu)tlenxf3iy1la eaueo s)teur(m no1ap nmiei t)s2um(ro;o4teenmoeiydfs2rm(vp;(4trtoirctodoa r uvi t tetmimpnudal emnesasfsDururp;u4oex ioetydls2rmuvp u) ltoir3oa1lpDean o;t0texoxopoudame  ies ()srum(mpnt1oexnioeilsla2emnms;u0aetnifcoo1lm eaueo;s  2trxm iu4lmtnmnetas) 2tm( o;t0tpen feiadlaDum(mpnt)arxnxfcta1lp eanei;t) rtoir nu4am  mnctls  Dtmxm nt4olt  feiatfa2uluvp;t)tlxnir3iotom   i o s)trxm(m3oydoltemncilt aDua(  ou1tetnmfcild sDum( o;t4tlxoir iadfa e i ol() eumxo iy4optn ivilsfsrtau ono4olt mieiatlmDel(vpnt0arenif oodfpD lneol()t2xr(r oodlpt mneilsfsDuau o;t4opt ifeilsfm ea(mp;t0artrio3ty1lpDeaies (0 rtoxr oo1altelicia(  rrrum ot0apen feiydfm el( o;t) rtoxf3iadlmDe iei s0texmxrpoodlmtelnesl(  rtrxr nu0aptn i3tlt s2rlu s u0 rtoxrcoatlm  lneols)s2xmxmpou4ap emnvilt)a2umum nt4texnmfeilt sDemump;t) rxoio3ta1oa eau ilt  ruo(rpny1omt licil()arur(roou4tlx ii3iaslm rmnmo;u) exrxo ia1fptelieo s)s2trxopiy4ll  lfcsl(fa2rmu pot4aetnif3iysls2eanvo;()arxrirciy1lpt lnes;()srur(r iodop nmict () 2ra(r ou4oexn oeilt m umumpn() renxr ty1fmt  u s;s0trtmxm iydlptnmnci s) rraumonu4tpxnioeiyd m2umums t4texnif3oodlpDr i sl(0srtm(mpoudlm  lfesa( srrmxmpot4alxoifctydfa2elumsnu0 etomr iatlm  lu ols  2toxo ou1olee fvsl()srrm( ooo1aeenmfeiydfmDuan snu0 renirctatoptelueolt  exrio3no1om nlnvi (fsDurxmoou4tptniiciydlsDrl(vp;()arxoxocoytlatr nvs;( srtm(o oudlle  ncs ()sDrrxmooo4apxn iciad a2ulumo;u) exrioctydlpte i o s s2tr(mpnu4open fcsa(  2rr(rp;o0aetomi3iadla2el(vo ()tlenmo iytom rlnvo;s)teur(o3ny1omeemfesat) rurxmpno0ale iiciyslaDul(mp;u4aleoxo iatoat  u il( tetmxo3no4lme lfesl()sDtrxro;u4tlxnifciytls eauvp;(0artrxf3oydoaDrli i s) 2uoxrpou1lpe  nvsa( s2urxrpnt1aex mietldlmDumuvo u)aetrxrcoatfpDrai o;s sexrirpiy4optnlnvias srur(r ;u1apx  o3tas mDrmnmo;u) rtomr3iytopD  u s;s t2um(rpou4amtnlfei sfs2trum nu4ope  ocilslmDum(mo t4trenifcty1op e u s t sruoxo ny1open nvsl()arrax pnu4tlt  o3iytfs2um(mp;t4texoif oadlp elivo t0s2xmxm3iydam nmfctl()a2rm(mo;o4tptnmo3ils a uauvo t0 lenifciadoa rln s;s0sexrxr3ou1lpenlicsatfa2umu ono1altoifciadfm2umumsn(0trerircoa1oa elues;t  2xrxr oodap elivslsf rra(mp;o0tptn fctlt m umnms;t4trxoxr3oo1opD anvil( t2urxrpny1lp e fes (fsDtaum nt0tlt  feiasfaDulu o t) leoif3todoaDr i sls0trxm(r ou4oltelics s)artmxmont0olto fciltls rmnmpnt4texoxo iadfpteaieilt0 exriopoo4apeelnvsa()s2tr(ro;u4altomictytfs2emump t0 renmf ta1lmteau s ( teuoxmpnydlmtelnesas)aDtm(moot1aexo i3iadlsDuauvon(0trtnif iadfpD luvs s)tetrirpno4ap emfcsls  Dra(m no4openioetaslsDrmump u4 rtoio iadfmD lneo;s) rtrxm3iu1ll emnesas srrauro;t4apt mfciydfm elu s u4areoio iotfatrlieilt) rtoim3ou1aptemicias arurxr ou0tlto icildfaDua( s (4arermrcto1laD auvs;() etoxm3ny1olt lfct () 2tru p;u0aexomo3tldla2em(vs;u0 etrxrciotoateaiei;s0s2xoim3io1alt  nvtl() 2tr(mpno0alxoio3tyt s um( o;()artrmrcty1fp rlnvs t0t2trxm ny4llenmici () 2tmxm ou4ape  feias a2emnms t4 rxnifciatop ean s;t)srur(o3iu1olen ncia(  2rm(m ou4opt moeilsfaDel( p;t0tltrxocoatlmDeanvo (0 2tmio3iy4ll  mnesltfsrum(m no1tlenioetltlsDeaumsnu4 ltnxf iy1fptelneo;s srurir oudamenlfei sfa2ra(r nu4ale iiciytls umumpn() eerircoadlmD auvs s0s2to(m iydamen fes ()aDrmx ono0ale moctyt a2ulums t) renio iotfa rlivsl()s2toio nudlmeelieilt)srtmxr nt0olxo fetysls rauvp (4tlenifcio1fp rau i ( trxo(rpiodlltn nctat)aDum(  ot4texo i3tlsls ulums t0tetomo3ty1fmD an s s0sexr(opnodal nmiet t  rrmxm nt1ale miciyt a2elumo;u4texomfciytomte iei;t) etoirpiodomte ncslt artmx pou1oexn octyt a2rl( s () renmocoatfpte uvil(  rxrir iy1omt lnesasfartr(r ;t1opt  o3ilsfa rmnmp;t0tlxrxrciydfatr ieols0 rxr(m3iodlm emnet (f 2rmxmo;t0tle  o3ils aDran o ()trtrmf3tydfm rlivil(0s2xm(m oy1apee fviat  Dtm(mpnt1oexn fetatlm2em(vsn(4arermfcoo1omtraneols)seumxmpoo4llen icsas  Drau o;o1aet mfeiatfm2emumpnt0teenmf oatla r u ilt) etr(m oo1lpte fesasfaDurxro;u4oeeniiciydfs2em(vo u) eerxf3oo1fptraivils  rtrxr iudamte nes ( sruaxrpot1altnmoctydla uluvs;u4texnxr3oatfpte nvs t s2uoxopio4op  micilsfs2tmurpot1aeto f3ilt m rm(vpnu4artrio oy1lp raies;(0t2trim oo4aptelfesas s2ta(rp;u1aexn oeiysla2rmnvpnu0trxnxrcoodoa rluei (0tetrim3iy1amtnlnvtasfs2tax oot1olxnmfciydla2emu ont0aexrir3oatoa eluvi t s2uoxm nydop emnei tf Drauro;u0openmf3iasfs2eauvo u4aeerxfcio1optr uvs;s)t2umxrpoy1amte neiat  Dtrxro;t1texo fetydla rm(vsnu4 exoirciy1fmD aies;()s2xm(m oudllte nct t)artmumo;t0tpenmoctytfaDeanmp u4treoxociydopDe u s;(0 eurxr oo1ame lfvtlsfa2ta(mp;t4oex  iciadfs2eluvont)teermr3iytfaDelnesls tetrir nu1alenmncil(fs2umxm nt4tet mociytfs uanvsn(0alxnio3to1fpDeluvi;t0s2xrir3oo4ll nmicilsf Drm(mpoo1oeeo oeils s2um(ms t0tltnmf3iy1oatr ueo;s0srxoxm oo4omt  icilt s2rmu  ot1tpeo o3iydlm eanmpnu0alerxo3iy1lm eaivsl(0trum(mpiy1aleelnetas)srtmxmpnu0opxoiieiydfm2ulumonu4treoxf3oa1lp  lieils)seto(m3nydlp n iei t  2rm(  ot1aptoioeiytfs uauvonu4aexrio3totlm  aivi;(0 ruoxm iy1apte ivsl(f Duaxmpoo1oetoiociydfs ua( o;u4arxrmociotopDeaneilt0t2urxo3no4apenmnesa()srtau ooo0teeomieias m raumo (4altrxr3iotlpDe ivo s0t2xoimpnudal e fcsa()arua(moou4opxomfeiytfaDemu snt0aexrifciatom  ln o s0s2xr(r3nodamte fcil()sDtaurpnu1oeenmo3ias m2eanvsnu4artnifcty1faDrli s ()s2xmimpny4omtnmictas) 2rr(m oo1tpe mi3iytlmDrlu s;()tltrio tadlptraivi s)sexoiopnodapen ivi (  rumur ou1tpen oetld aDrlnmsn() lxnxocoatfpDeanvs;()sruoimpiudame lfetas)aDrmumpnt0tlxomiciatlmDranmsnu)aeermr iotlmt  uvo s0 etm(o3iy1lmt lfvtls aDrrur ;t1alxo oeils a2el(vo t4trtrir3tydlpDrlivo t0s2xrir no1ol emfciatf 2uax  ou4tpeoifciytls2elumpnu0aexriocoo1fa  aies s)texoxm3oudlpen fvsls  rtru  ;u4apenmiciltlsDumump (4tltomr iadomD aues s0trtmiopny1lpeelfctas a2uau pou1alto feias a rmn o () lerxocoa1fp  li sls0tetoxo io4amenmfetl(faruax pno0ape ii3iltfs2umnvon(4tltoio iy1la  aivols t2tm(o iydamee ncias sDtrumpno1teeoio3tydlm2uau o;()trerxo iydoate i s s  2tm(r nu1lpt lfvi t)aDumum ou4aptnio3iatlaDum(mp t)trtrio oytoa   uvi;(0s2urxrpoo1alee ivia(fa2ta(  oo1openiiciltlmDrlums u0altnxr3oytomDean il( teuo(m ou4amt lncilt a2tmx o;t4opx moeildls2emu pn(0texnxf tydlm   uvol()tetrim3iodlleelfvtl(fsrtauroou1oexomieiaslm rmn pnu4aetrirctydlm ean i;s0teuo(r nu4alenlnei (  Dta( p;u1ole iiciadfs emn snu0 exnmf3ty1oaDeluvsls0srto(r nodlmee fetltf rrru oot1altnmociys s ranms ()arxoxo3tydfm   u i;()srxm(o3oydlptn fcs sf 2raurpoo4opx ioetltlaDeaump t4aeenifcootlm rlu i;(0teurir3oy1omeemfvsasfaDrmxro;o4optnif3ilt s em(mo u4tetnmfcoatfaD ai i s)s2ur(r3oodamenmfvia(fsrrrur ;t4aeeoifetyslm rl(mp u4 reoio3io1fm raivo;s) eurimpoodlm nlfesas) 2rax oou0ole  i3iyt mDea(ms (0aetnxf tytomtrliei;t)s2xoio ny1lptnmieias a2rmx  ;u4tlxniieilt aDra(vp (4aeenmrctytom r n s ( srur(m iydope mfctlt a2rmxm oo1alxn i3ias sDrlnvp;(0texnxr oydfa  au i s)s2triopoudlpe  ies sfaDrmx oou0tpeo ietaslsDemumo;u4trxoif ty1op e n s ()trum(opio1lptnmivs () 2tru p;t1apeo icilsls uauvo u0trtnxo tytfmtrlies;s)trur(o3ny4ll emneilt)aDum(  ;t4apeo i3iyd s umu o (0trxoxo3oydlm   uvs (0trto(r oo1om elfeia()sDrrum ;t0aetoioetlsla2uau s t4alxoir iy1fmtrau o;s  2umxmpno1ol emnei tf rta( p;t1oee if3iyslmDua(vp;(0alenir iadfaDeln i;t)t2urim iydll   fvslsfsrrm(mpot0oee  ociydfsDrmu o;() renir3oadlat aueo;()s2xoxo3iu4ope lnct t aDtau  ot0tlxnifetyt s2rl(vp;u) lenir3iodfaDrlivsls)setmxmpnudll elncta( a2ta(rooo1opxoifcilslaDem( p;u0aleniociydlpDeluvsls0teuoiopio4ameemivta(  2um( o;u0oet miciydfs2emnvp u4 leoxrciadlmDeaueolt  rxm(opoydoleelivtat)aDtru  ot4texomocilsfa uauvs t)tetomfcootfaDran slt  ruo(r3oy4ol  lfvslt)sDrmx p;o1oexn iciat sDrlnmo u4 exoir3iatla elieo;s0texmiopoo4ape mfes s a2taxr nt1alxo ieiatlsDra( o;t0 lermf oytlpt  ieilt  ruoim nu4aleemfvtas  Dur(rp;t4tle mf3tyt a2ran p t4 exomf iatomt au o;s0 euoir oodoptnlnvsasfs2ra(ro;o4teen o3iasfs2rmuvsn(0trxomocoy1lm rauvi ()t2xrxrpoydamt lnesls)sDtau o;u4aptnio3iyd a umn sn(0 lxrmr todfatrlies;t0texoxm3nodll nlnvi t) rtrum nu0tpx  fcilt a raumo t0 renif to1oaDe u s t  exrxrpoy4op   fcsa() 2tr(rp;o0oet  iciys m2rmnvs;u)trxomocta1laD aueslt) rxmxrpiu4ol  licias) 2uru ooo0aeto fciat aDemu snt4 lxoifctadlaD aueolt) rtm(m oy4lm emfetlt) rraur no0tlx  feilslm2rauvs;u4tltrifciytlateln i t trtrxm nodapt  nvt tfsDrru  ;o0tltn o3iltls eau s u)trtnxociadfa r uvo;s) rtrxm3oodapeemnctas)srtrx pot0ope iietldfm em(vs u) ltrmocta1lm  luvi;t s2uoiopiodapenlfci t  Dtrx pno1aexoif3iydfm2eln p;t4texoiocty1lpDeluvo;()trxm(rpiu1lm elivsas)aDumx  ;u1teeomieiyt a2eanms;u4teerif3oodoateaneo s0srxrim3ny1amtemivtlsfsrrr(r ;o0opxniociat s2eauvo t0 ltomocta1lmt anvi s trxrxr iu1opee ivsl()arumump;t4apen o3ias m2ua( snu) lxnirctadomDr n s t)texr(o3ny1al e ncs ( a2um(rooo0oee ifeild m el(vo;t4alxnxr3iy1fptrlnes t t2tmxrpoydomtemfctls aDur( o;o0tlx  ieiadfm2em(ms;t4alxrxf ia1fp r nvo;t truoxm iudalt mnct s)s2rax ooo0apxnmoctltlm2uanvsnt0treomf iotfm   ivo t)trumxm oydom  lfcs s  rraxmoot0aex  ietadfm2ra(vo t4artnxf oydla r u o;( seum(o3nu4ll elfvsatfarur(  ;u0aptniieilsla2el(mo;u)arenxrciadlpD  nesl( sexr(opny1oltelnvil()s2rrumonu1oetoii3iasla em(vp;t0 renmf3oodoptrauvi;()srto(r3ny1op  miesl(fsDtmx o;u1alx ii3ilslm rl( snt4 ltoif oadopDelieils  2umiopno1lpeemfesls)arurx  no0tpeomieiydla ranvonu)areoio3tydfa eaueo t sexoxr oodlpe livi t srtrxro;u0apxoioetydla2uluvs u)arxnifcoy1fatrluesl()s2ur(opio4optemieils)sDtaum nu4apxn ieiat mDelnvs;t0artrmf3ia1oaD  i ols s2tm(rpiu1lme mfvsl(f rrmxro;o4altomictasfm2rlnmo t4tltrxf oytfmDeau i;t0s2urimpiudopeemicsa() Dtrx pou0teenioetytls2raums;u0aexnio tydlmtr u s t0seumimpoodlleelnvi sfaDuru onu4tlx micild a umumsnu4texnio to1lm eli i;s0 rxo(m nu4ome mfviatfsrrau p;u1tpe  ieiyslmDrlump t4artrmoctotlpt aneo t0s2uo(rpiy1alte neta() rtr(mono0aexnmicilt m2ulumo;t0teenxfctadfm  liei;t)srtoxopnodom nmfvs (fs2rrxrpno4tetoifeiytlmDra(vs;(0teeoif ia1fatrln o ( sruoir oo1optemiei t s2rr(mpnt0aex mfeiatla rlu s;t0 etnio3ootfmD aivo (0 2tm(m nodom elivi tfs2uru pnt0tpxoiieiadfm2umn p (0 rxrmfcoy1faDrai i;t0setm(m nudoptemfcs t  Dtr(moou1oex  f3tltfa2rm(mp u)trermf3iotfp rau o;t)t2uoxr3ny1lmt  ici s  2um(ront1oeeo ieild a umu onu)alenmo iytfm ran i t  2xmir3iodlp emiet (  2ta(  ;o1oex io3tas s2ra( s u)arxnmrciytfmD aueo;()t2xrxm io4opt mnvs sfsDraxroot0opxniiciys s2rmuvpnu)aetnmo3tydoaDr n i s  2uoiopiy1alt mnesl(farum(rp;u1tpxomietyd m ulump t4tltnir3oadfat  ivi ( srxo(rpno1ol n net t a2tmu ont4tlxn fctltfs ranmpnt)aetnxf3oa1lpDrlnvs t t2urir iy4lmeemnvt (fa2umx ono0oex mf3iat a2umnvo t) exomfcto1lptr uvo s)s2um(r iydll nmfctlt aDum(rpnu1optn fctasfs el( o;t0 exomfcta1lmteln o;t)texoio3oudlmee nct (faruru poo0aex ioetadlm2uanmsnt) etrxr tatoa e ues;t0t2to(rpiodll  mnei t) ruaumpno4aeen ietld aDuanmpnt4tlxnmf oy1lmtranvilt  rxmxm3nu4alenlnvs sfaDrmu p;t1altnmieiatlaDrluvs u0 leoxf3ty1opDr neo s0srto(m3oydope mfcsasfsrua(root4olxoioeild s rlump;(4 rtoircoo1fat lnvo t)sexm(m3nydlle lfcsa(fsDrmu  ou1aex  feiydfm2elnvo t4tetrio3tytfmt an s s)setmim oodol elnei sf rtr( pot4apx mociyd a ranmp u4aetnxr3oadlp  lieo;(0s2xrxopoodap nlneias  Dumumono1aetniictadlaDea( s;t0alerxrcoydlm  aiesls t2xr(o nodamee fet (  rrrx  ot0tlxnio3iadlsDumnvs;u0trtoio3iotomDe u i;(0s2umxr oydlmt mietls artrx o;o0tpt  f3iyslaDra(vpnu4 leoxociy1fpDraueo t0setm(m oo1op n fctl() 2urxmo;u0apxn f3iatla ul(vsn(0tetoifctotopDr u ilt t2tmxo3ou4apen fcs (faDrmx o;u1aex  f3tltfm2ean s t0alxnxr3todoat ln i t) 2xm(r3ny4op emfvsatf 2ururpou1tet  octydlmDuaump;(4 rtoxrciytlmD ln i t)srxmxm oudolen nvsl(  Durxmpnt4tleniieild m2rmnvpnt4alxoxr oadfmte uvo;( srxoio ou4amen feia(farrru pnu4tle moeiat s2eanmpnt4trxrio3oytlptean o;( s2tr(r ny4amt  nesas s2um(m ;t1tpe  ieild s rluvs;(0 eeomf3ia1fp eaneo;t0s2umiopoodoleemieia()s2trur ou4alxomo3ildlm ra(monu4arxoxo3oy1fmt  n s s0 euoxr3iy1apt lnvs t) 2urxrpou4tleniictaslaDrl(vs t)artrmo3iatlptr i s ()trxo(m io4al e fvias  2ururono0oexn ictas mDrm(mp t)trtrmo ta1lat an s;s  exoxo io1olte fcslt)srtmxm no0aptomo3tyt sDrmnms (0 exnmo iotlptraueo s0 rtmir3iy4al e ncias)sruru  ;t1oeeomfciat m eluvs;t0 rxnxocia1fa eauei;() rxr(m nudlm  mneiat)s2rr( p;u1tptniiciadlm2umnmo;t)alenir3oatoaDeau o;s tetr(mpoo4ale mncilt sDuru  ot1aee io3iyt s uau s;u)treoxr ootoaDr uei (  ruoxr oy1lm elicta(  Dumx oou1altnmoeiydls2em(ms;u) etriocootfptr u i;t0sexrirpiu4lp  miet tfsrumxrpnu4apeoii3tatfmDul( s () rtrir3tatfpDran o;t  2umxmpnu1apt  ncs tfsDrmumpoo4open ietydls eauvp;(0trtrmfcty1laDran ils  etm(rpiu1altnmicia(f Drmxr ot4ole mfeiys m umu o;t4alxrmfcoytlaD li s s) 2tmio3oydlmeelfcslt  Drm(r ;u0olx  octasls2rmnmsn(4alxrxoctatopDr u i;t0s2xmxm3oudapen fvsat)arrrx onu4openifctas m rlums u)texnmfcia1fpt  n ilt sruoio3io1amt lnciasfsrrmur ;u1aexnmociltfa rlnvp;t) ltrmf3oydfmDranvs s setm(rpno4optn fvs tfaDta( ont4texoio3iatfs ulnvpnt4trenmrcoa1om   neils)teur(r3oy1alt  netlt  2uru o;o0tetomoctatfaDul(vs t) lxomrciytfa rluei t)srxmxo iy1openmfcsas a2trum ot0oetoifcils s2rlu o ()altnmr3to1oatrlnes t0t2toxo oo4lpt  ivsa()sDra(m ou4opxomi3iytls umums;(0alxrmrcty1lpDrlnei;t  eum(mpiudam  lictls)artaum oo4oexoifciad s2umu pnt4altrxo oo1fm rauvo s0 etr(o3iy1aptemictat)sDumxmpoo4oleo i3tasfsDraump u) rtnxf3todoa eluvi ()t2um(r3iu1am  lfvs (fsDrru  nu0opxoifetyt m2ran onu4trtrxfctadoaDeaueslt) etoim oy4om emnvtl(f rta(root4tlt ifcils m2eauvpnu4artnio oa1fpD luvi t0 euoirpny1apt mictasfartaxm ot0aexnmiciatlmDelumsn(0altnmociydla   uvo s)s2umio oy4alt  ncsat sDta(moou0aee ioctat s raumpnt4alxomf oatlpD ln sl( srxoir no1am   fcs s sruaxro;o1tlx ifcildfa ra(vsnt0 lxnifcto1lpDelueo (0seuo(m3nydoptnmfet s srumu poo4tpxo octat sDeln s;(4tlerio tatfm r uvo;t0 2xrxmpiy4ol  lfvtlt) Durumont4opt iicils m ul(mo;t)arxoir3to1faDr uvsls0trtmim3iudomenmieil()sDrmu ono4apxomoeiadls emums u4areoxr iydla  luvslt t2urxopoy4lltnlfcsas s2umu ont1tlto o3tltfmDua(mp;() rtomrctytoatean o;t)srxm(o3io4openlncs sfa2rmurooo0opx ii3ils a rmums;(4tltnxrciatfpteluvs;s)trxo(rpnu4omtemfct ()a2urxmp;o0oeeoifetaslsDulums u)altrio3tydopDr nvo (0tetrxo nu1optelnes s)a2rrxront4aee  ictysfsDrluvsnt) rtnmr3iy1lm eaiesl(  2um(o3nu1altelfctl( sDrm(r ot0apx iiciydls rlnmo;(0altnxo tytfatran o s  2um(r3oudaleelncsa()aDrruro;t0oetnif3tad a rl(vp;t0 rerioctytlm eli s t) 2umxo3ou1amte ics (  ruaxmoou1alx ii3iadls2rl(vo (4 exnxoctotoatelivo s)tetoxm3iudamtn nciat  2rmurpou0tlenioeiyt s2ulnmonu4 exoifcoydoa r ies;t0sexoxo ny1ape  iei t)arrm(rpnu0ale ifeiltla rmumo;t4aexrxf to1fm ran o;t0srtoxr io1lle  nci (f 2rr(r ;t0tetniieildfsDem(mp;u)altrxoctytomDr n s;t0setoiopoy1apte iesatf Drmuro;t1olenio3tys a2ea( snt4 exnmrcoodoa e u i;s0s2toir oudol elfeilsf rraump;o1aetnmoeild s2umnvpnt)tleomf iodfa rln ilt)t2xm(o oydape  fvslsfsrrrxmooo1tlt iieiadfs2ulu on() exnmo oatomDranvs t)setmio3iudapt  ieiltfaDraxro;o4oleoiocildlaDumnvs t4 rerircty1op ean ils truoxm oo1llenmieilt  rur( p;t1altoioeiyd s2rlu o;(4texnircoytfmDr ueols) 2xrxr oy1aptnlfvilt)artru o;u1tpxnmfeiltlaDum(msnt4aexniocoa1lpDe uvo;()s2ur(r nodaptnmfcsa(faruaur no1alto i3iasfm umnvo u0 etrxfctadlmteaivi (0t2xrim3oo1lpee fvs (fs2rmx p;u0texnmieiydlsDum( s;u)aetnmocoatomDeaieslt seurio iy1lm   feiat)srumx  ou0oex  ietlsfm emuvp;u) rtrxf3iotlmte ues;()seumim3oudlle  neil()s2tmx onu4apxnmfeiyt aDelumsnu0teenxf3oydlm eli i;t texmir3oy1ape  ietls aDra(r no4aeeoif3tys m2em(ms;()artomr io1fmtrlu s t0trumir3ny4alenlnes tfsDtau o;u1tpxomoeiaslm eaump;u4aetnxo3totfatraieslt0setr(opou4ole  fvtl(  rua(ro;t4teeomiciat a ulnvsnt0alxnir totoaDeau slt t2uoxm3nu1al e fcsltfa2ta( o;u1tpe moctydls2emumpnt4 lermr3io1lp ranvi s0t2xm(rpou1olte nvtlt)a2tmum nu0olt mieiadlaDeaump;u4arerxoctotlmtrli slt0 eum(m3nu4lptnlnci sf 2ra(m ;o4tpxnmfciadfa2rl( ont)alxnirctytfatelues;s sexm(r iu4amt  neia() Dumur nu4oee ifeias m2uan s (0alenxr to1fpDelnvi;()trto(o no1ll nmfvt tfaruru  oo4tlto oetydls2eanvo (0trtnmo tadfa eaneo;t) rtrxrpiudapen icslt aDur(r ot1ape ioetatls2ua(vp;t0trtomfciytfpteaivilt s2umim ny4altn nesas srua(m ot4teeomfctlt sDumnms;u4arenmr3iotomDrlueilt t2toir3oy1optnmfvi s a2urxr nu4oee  fciadlaDelnms;u0treoxf oa1omD  uesls  eum(r iu4amtnmncsat sDrmxmpoo0opeoif3ildfa ra(mp (4arenir oytfm r ies (  eto(opiydll  lics ( a2tmuronu1oltnii3iaslaDrluvo () rtrmo3todfaD  uei;()s2tmio3ny1lptn ietat)srtauroou1aleoifeiadfm2emn onu4 ltomo tydfmtr ivi ( srtmimpoudam emiesl()a2rr( poo1aeenmfctld aDrau p;u4texnxr tydfa eauvs;t sexoxr3oodlm  lfct tfsDrm(mo;u0oexnmfciyslm ea(vs;(4 eenxocoytopt  uvo;t)trum(mpoydalee fei ( a2tmxrpot4oeen i3tyslsDrlnvont0aexrir oydomtrauvsl(0 2xmio3oy1lp nmncs sf 2tmx pnu4optomf3iasfsDelu s ()teeoxo3ty1lp  aivo t0trxoir3nudap  lncsas s2ururo;t0oltn octlt a ean o u) rxrir oy1laD lies;t) 2tmxo3iu4lmt lnesa( sDtr(  ;u4apt miciyslm eln o;(4artrircty1oaD  ueilt  eumiopno4lmt  iesa(farurxrono0oeeo fcild m ean sn() renmoctatop ean o;t0tetr(opny4omtn ivt s  Dumx  nu1tpeniociadfaDel(mp;(4 renmo3iy1op  ln olt) 2uo(o iu1lpe mfvs s srtauro;o0oexo fetld a ranvp;u0arxnxo tadopD auesl() 2uoirpiy4aleemiet ()aruau  oo0olxniiciyslaDeanmonu)aexnmfctytlmD aieolt s2umimpoo4oleelfvi t)srum(m ;o4aex mfciytlaDrm( p;u) rtniocootfp raieo s srum(m3no1alt lfctlt s2urx o;t1opx  ociydfs2ra(mpn(4tlenmr oatfa eaieslt)trtoxr3oo1opt mivi sfsDraurpno4ope ifetlt s2umu on(4 reoxf iodlmtrlivsls0 rxrimpiy1om   nesl(faDurxmonu1tltn fcils m2um(vp;u4tetoif tytfmtrli s;s srtmxmpou4lpeelfetlt  Drax o;u0tlxnmfciyd sDumnmon() rxnmr3tadoa rai s t s2tr(r no1lmeelnvtasfsrtr( p;t4aeto iciysfaDuanvo;t)aexoxfciy1lmD  ueol(0sexr(mpiodapenmfetlt)a2ur(m nt0oltnii3ilslmDrl(mont4 rxrmrcootfm eluvs (  2umxm3no1omenlivsltfs2tmumo;t4tetn fciad a2umuvont0aexrxf3iatfpteluvi t tetmim nudal e nvtat) Drrxmoou4opt mfcils s2ra( p u4tltnmf3oytlaD an s t) exoxo no1ole licsl()a2ur(mono0tpeo icildlm eau sn() ltnxr io1oa   ivs;() eurim nodlltn feta(f 2ra( o;u0oeeoioeiatlm2eau pn(4aetoxfctadlp elieols trto(r3ou1lmtn nei ( s2rmxrpno4oeto i3iysfs2umnmo;u)tltrif oydlp eanvs ( seuoxmpnodom  lnet s  2rau onu1aetn ieild a ulu o u0 ltoirctytopteai s s t2uoxr iu1lmtnmfci s)s2rau pou0apx mf3tltlaDua(ms t)tltrifciodlaD livs s0 2xo(m3iodalt mivslt s2ta(m ;u0opx  ieiydls em( s;(0 rxnxr todopteluvs;t)sruo(o iodap  lfetas) rumur ou1aet mfciytfa ua(vp;t0teenxr iatlat livi;s trxmxo no1amtnlnetas)aDur(m ;u4texnii3tltfm2elumont4tleoxr oa1lp  lies;(0teur(m ny1lm  lies s  Duau o;t4alt ioctlsla2rlnvo;u0altoir3ta1fmt aivsl(  rtm(r3nodlltelnci s sDrrxmonu1tpto octlt aDeluvo (0aexomr3iodomDelu o;()t2xrir nu1alt  neia(  2umu  nt4tet io3tadfsDulumpn()alenmr ta1faDeln o;s  rxoio nu1al  liesls) Dumx ont1oexn o3iyd m ra( on(0alerxf3oadoa e i sl(0teuoxmpiydlm  lnvs ()s2umxmpot1oetnmiciydfs2ul( o;u4tetrxrcootlmDe neil() euoxr3io1omt lfcil(  Dtrx ono1alx if3iltfa2rluvo (4 rxoir3totfaD lnvo;(0seumim3oudame  iesls)a2tau o;o1aeeoioetadls rlu on()areomr tatopt ln i;s0 2umir3oo4lm  mnvs t sDrr(m no4teto o3tyt sDumumpnt)arxoiocoa1opDrlu o s0srur(r3iu1om emfeslt a2ta(mpou0openmfciydlaDemnms u4tleriociatfmDr n s s)t2toxopnudlmt  net t)aDtmum ;u4tetnifciat mDemn p;() etnxf3iy1fpDelnvs;t srxoiopou4ll  mfet ( srtr(m ;o4oet iictat aDuau s;u4 exoir oa1fm elnvs (0 2xoio nu1olee ncsl()a2rrum ou4opxoifciasls ea(vp (4texrmf io1fp  aivolt0s2uo(r3nu4lp e fci tfarrmxr oo4ope ioeiyd aDrlnvp (0alxrxrciy1fm eau slt0tetm(o3nu1oltelfcia()s2ra(rpoo0oetnii3tad mDemuvp ()aeenxr iotomt  ivo;t0srurim oudaleemfeiltf 2rr(ronu1tpen feiatfsDelnmont)arxnxr3oa1fmt lnvi s0trtrim io1alee ivils  Duauro;t0olxoif3iydlsDranmonu) etnif3oatoptelnvs t0trxm(mpno4ol  mfeia( sDur(r nt4tlx  i3tldfaDuanvs;t)trtnir iy1lmD anei t0 rtrirpio1am nmncs s  Dtrumpoo4tptoio3ilsfsDrl(vp u) ltomocootom rlu sl(  rxoim3iy4ome lici t)sDtm(mpoo4tlenmfctaslsDra(mo;t)aeenmf ta1fmDeaivi s0texrir nu1omen feiasfsDrrxmpot1aetn icias m2eanmp;u)arxomrcta1oat li i;t) ruoxrpiudlpee nvslt)artmx  no0altomo3iasla ranmont4alxnxf3io1oaDrlnvslt)s2xr(m3oo1omen nes t srtrx pou0aeenmieiltfaDemu snu0 ltoxfctatfmDe u o;()seto(r3iu4amtelfvsa(fsrrauro;t1teenio3iatlm uln s t4altrifciadlaD luesl(  eurirpou1lpeemietasfa2rrxrpoo4teeomieildla2rmnmsn(4tltoifcto1lp  lieils0seurim oo4olenlici s)arra(ront0altoioeias m2el(mon() lermo3io1oaDe uvi t)srxmxopoo4amt  ieil(fs2rmu poo4tpeoif3tyt aDelnvonu4 rtrir iydfp ean s s s2umim3iy4alt lfcs tfartmum ;u1tlx miciysfsDumuvp t)arxrio oadopD aneolt)s2toir3iu1lm   ncta(  rta(mo;u4aptomiciasfm2rmnvs;t0teeomf3oy1lmDeai olt s2tmio3iudlle mnei s) 2raxrooo4apxniocias a2raumo;u0tetrir iytlmt anvslt0t2xmxr3nudol elfcia() Drr(  ou4ape io3ias s eauvp (0tlxnmo3ty1omDeaneo t) 2tmimpnodaptn nvt () 2uau  ot1aeto feiytfs2ea(vs (0teeoxr3iotfm elnes s0t2tr(m ou4amen ncil(fartrurp;t0teen o3iadfm el(ms;(0tetnircoytom  anei ( t2xoiopnu1lltnmnet (f rrmxm ;o0ape  ietlt sDraump u4aetrxocio1omD auei s0 etmiopny4lmte fvtl()s2rm(  ot4tlenmfctltla2rm(vp u)arxnmo3tytfat  n o;t s2xm(m nudaleelfvi () rumu pnu1teeoifcildfmDulnvsn()texrxr ia1lm rlu ols trxmxm oo4amenlnvia() Dtaumpoo1aeeomfetasfsDum(ms (4 rtnxf oy1fptraivs s0 exrim oo4ap nmnei tfs2trum nu4aptoifeiyslaDemuvo;u) exrmfcty1laDeluvolt0teuo(r oudolenmncias aDtrxrpoo0opeo oeiasfm ulump;(0 rermr iatlpDraivslt0s2xmxo3nu4lm emnvslt) rurxrp;u4ape ii3iyd aDum(vsn(4trtnif oy1op  luvsl(0t2to(m ny4olte fvt s)sruaxront1ope mociasfsDuaump;u0trxnmo oodlptrauvils teto(opiy4ap  mnesat) 2tmxr ot0tle mictydlsDrlu s t0trerir3tadfaDrlueilt0 ruoio ny1lmenmivil()arraxm oo0tpt ioetatfm2rm( p t)aleoio3iotlaDe i s;(0seuoxm3io4op  mnvsl()srua(monu0oee ifciaslm2rauvo;u)tlxoxr oodla   u sls0trxm(opno4lme livi sfaDrax p;u1tpen i3tys mDuaumo ()trxoxrctytomDe u o;(0 euoxo3iy1amtn ics () 2ta( o;o4texn ociyslaDrm(ms t)texnifctytfpt lneo t0 2umirpou4ome mnci t  rtr(m ot1apeo f3iysla ra( pnt4aeerxrctadomtrln olt0trxoxmpoodlmtn fcta()aDtm(m ou0alxn oeiytlmDrlnvo () lxrxf3to1lpt livo ( sexrxm3nu4lptn fci ( srrmuroot4tlen fcilsls ua(vs;t4alxniociydlm   ivilt teurim3nu1om elfvt s sDtmumo;o1altn fetad m2ranvo t) exoif tadoa ean s s0t2tm(r3io4ope  nvtat  Dtm(m ;u1oeto ietydfs2emnvs;t0alenio3todlm eau o;s)s2uoimpnu1oltnmfcta()srtrur ou0aexoii3iytfa uauvo;(4aeenmo oy1faDeaivs (0s2uoim3oy4lmeelncs (faDum(r ;o1opx iicilsfa rlnmp (4 lxrirciotopt auvo;() ruoirpnydome lfctls s2ta(m ;t0tee mi3iasls em(vo (4texnmociodfmDeaueolt0s2tm(r3ny1lpt livsls aDtau p;o1alx  ieiydla uanvs t)artrxf iatlpDeli i t trtoxo oy1alenmfes ( a2rru pot4oeenmfetltls2ran o t)alxnmr io1la rai s ( sexm(m ny4apee fcil(  2rrxrp;u0open iciys m emumpnt)tlxoir ta1laDrlu ol( seurim oy1lptnmnvt sf Drmump;o4texn icilt mDrln o;u0aeeomf3oydfmteauei t0 2urim3nydop nlneils  Draxm ;t4ale iicils s2rmuvs t4 lerir oydlat auvo t) exriopoo1lp n nvtas sDtauront0apenioeiad mDulumo u0 rtnif ta1latrlnes;t) ruo(m3no4omtelieiatfsDrm(rpnu0oetn ietysfm ul(vp;()artoif3to1fpt  nes s)t2to(mpiydal   nci (f 2rr(r ou0aptoif3iytfm em( s (0 lenmo iytoaDeaieol()trxr(rpno1ape  ncil( s2ta(m nt0aptn ictysfm2rln p t0trxoio iadfp r uvo;t s2trxrpoy1amtelncilt  2rmu ono4oltn fctysfmDra(vo;u0aeeniocoo1fpD anei;s)srxo(r3iydop n nvta(faDrrur nu1alt mociltla2rln snu4tlxnxo3iy1lmt  neo () etoxo3nu4lpe lieia(f 2ta(r nu1aexomi3tad a ea(vsnt)texomociadoa rln ilt0srtm(o io1lp e icsatfaDtmxmonu0optniietlsfm rmu p;t4arxoir3iy1fatranei (0truo(m3oo1lpe  ics t) rra(m no4oeenmfeiat sDemuvsn(0 lenmr oadfmDr ues ( t2tr(r3ou1lp elnct s srtmx pno1ale  oeild m ea(mp u0texnirctatoa  aivs s0 etoio3nu1llee fvtas)artrx ono4tpe  f3iasla uau s u)tleomoctadop eaneols trtm(m iu4ape mfvias)s2ur(ronu4oltoifeiatfaDrmuvs;t0aeerxocoodlate u ols sexrxr3iy4altnlncsa(  2tru ooo1aet iictydls2el( ont4tltnxr iatfaDeau i () 2urxrpnodlme mnviatfarra(rp;o4oee iicils m2rm( onu4alxrxr to1fmt  ueils) ruoxopny1ome livsltfsrur(m oo4tex if3iysfa2eaums t)aexnxr ta1fpD lueo;t) rurxr oudaptnlfctlt aDrmumont0tleo o3iytlm rlumo t4 exoxr iatlpt lies;t0trxoirpnydal n ivsa(farrm(m ;o1tpto oeils s2ua(vo;t0tetrifcoadfp rlieilt setrio3oo1al elivilt  rtmuro;u0aptoii3tls s2rluvsnu0tltrxrcoadlat anesl()s2tr(m3no1ol elfcia() 2rmu p;u1opxo i3iadla2emuvs u4altoir3oatoa rai o (0 ruoxo iy1apeemiciat  Drmx pnu1opx mfciytfaDeaumpnt)aeeoxfcootfpDeanes;s tetmirpoudom n ivsl() 2rrxrpno4oexomfetad m2ul(vpnt)artnifcta1lptr n s;t  exmxrpnu4lmtnlfvs s)srurxm oo1oee ioetlsfa2uln s;u) rxrio iodla r u ols)t2uoxr3ou4amenlfvi () 2raxmpoo1altnifciltlm uauvpnt4aetnxf oy1om e u o s0 exmxm oo4lmenmneiatfa2uaump;o4tpxn i3tyt a rlumo;u4 lerio3todlm r ueo (0 exm(m3iy1om n nvt ( arrm(mp;u0oltnio3ilslmDuaumpnt0trxrif iotlateanvols t2xmir oydomtn ieia(fartm(  ;u1apeo feilsla el(mp;u4aeeoxocio1oaDr nvs s0teum(mpnu4opte nei (fa2rr(r ot4altoiictys s rmnvs u0arxrmrctadlmDranvo ()trtmxo3oo1aleelfvsat sDra( oot4alxomfcildlm uluvo;()tltoxf3iotlmtrlnvs (  rxmxm3iudlmenmiviasfa2taum ou1tpx iieildfsDuanmsn(4 rtoifcoadfaDe nei (0 rxrirpiy4lmt lfvt ( sruaxm ;o1tleniicilt a umn p;(0aetrmr3oydfp e n i;(  2uoim3iydlltn ivta( artrurpno0tptomfciytla eauvp;(0tltnio3ta1lmDeli ol()t2xo(o oudolenlieta(f 2rmu ono1oltn fctat a uau snt4aetrmo oy1oatr ivo;(  rxmxr3iu1lp elieils) 2raur ;t1tpt mfeilslm2rmn snt0texrmr3iydfatr iesls  exo(o nodll emicias a2uaxmpot4aetomo3iyslm2eluvp u)tltrxf oy1om raivo;s)srtr(opiy1opt mivslsfa2trx p;t1apen oeilt m ulums;t4trtrmr ia1oatr i s t) rtr(mpiy1omtelivs t sDtrxr ou1tleomi3iyslaDeau o t) exomfciydopt lnvi t s2xmirpno4am  mnvslt) 2ra(rooo1alt iietasfs rmnmo;u4 rermoctatlm rlnei t0 euoimpiu4lmtelnvtlt)sDum( pnu1olen oeiasla ra(vp (0altoircoodfp   ieolt0trxoxmpoydolt  fctls sDtm(r oo0tex  ictatlaDrau p;t)tlxoio iydfatelivi t)s2urim oy1om nlictlsfa2raxrpot0oexnmf3tlsfmDrlu p ()arenmociadfptelnvs;t)tetrxmpno4op   nctat) 2rmuroou4apxn ociaslmDrmu p;()tlenif iy1omDrlnei;s  rtmirpiudlmeemnvtl( sDrmxmono4tetnmi3iyt a umnvsnu4tlxrmf ta1oatrluvs s)trtmim oudllenlfviltfaDtrx  nt0oleomo3ils aDra(vo;t0tetnif iytfmtr ivo t  2urio3ny4lp  mfvsl()srur(ro;o1ale  feiat m2raums;(0 lxnifctotlatean s ()srtm(o3no4al   fvt (  2tmx oou4olenmictysla2eanvo ()texomr3oadlmDeaieo (  2toirpny4aptemfeslsfaruau pno0altoio3iys m uauvo ()areoiocoadopDe ueo;(  etrio3iy4apte neia(f rrmxmont4ape  oeiad aDumnvsnu0 etrmfcto1faD li olt trtmxm3io4oltnlfetl( srtax p;o1tpt iietlsls uluvo;t0 etrmrciatopDe n il( s2uo(opio1ole lfcsl(fa2rr(r nt4apt io3tad mDeluvsnt0 leoxo ta1fm rai ils truo(r3io4ap emnctl(farumxm ot1tpt ioeiadlm2umnvp t0 rxrxfciotlpt ln slt0 2xr(m ou1lp e icsas  Dtr(moot0tpx ifciad s2rmuvon()treoxf tydfpteaiesl(  2xoxrpoy1olt licilt)s2umumoou1olxn feiys mDrm(vs;(4 lermo3oatlate i ilt texo(m oo4am   iesas)srur(  nt0tlto ictytfa2ul(vo (0altoio3ootlmtran o (0 rtrim3ou1amt  fctltfaDtrxmpnu0aexnii3tltlsDua(vp;t)trxomfciadopD lies;t  exo(o iydomenmfct tfs2raxm nt4aexomfcildla em(vs (0areriocoadfpD aueils0 rtm(rpno4apt mict t) rrr(rpno0alen icils m emump u)tltnxo3iadlp  au s (0 2um(r iudam elnci s  2rax poo4texnmf3tydlsDemn s;u4tetnir3iadlm  au ols0 exrxopnudaptn feil() rtmu  oo1texo oeiyslaDrlnvo;t) eeoxo3tydoa eaieolt0trurxm3oy1op nmfct t a2tau p;u1tle  oeilsfaDra(vp (0tltnifciotlpDeaiei (0truoim3ny4op nmics (faDurx ooo1olt ifeiys m2umn s t)artrxf ta1lmD  u i;t s2xrxm3nu1lmte ncslt)a2urx o;t0apxnmiciaslm rl(vp u0altnir3oa1lmt  i i s0srtrxm nu1lmen nvtlt arrmur nt1oexnmi3tasfm umnvsn(0arxrxocoodlmD lneo (0s2xmxo3iudlptemics tfsrrmxr ;o1texoif3iyd m rmnvsn() exomo3ootopDr ieo s)s2uo(rpiudap elieiatfa2tmx oou4ale  f3ilsfa2ua(mo;t0areomr tydlpt  u ol(0 etoiopoo4optelnetl()s2ra(rpot1ape io3ildlaDranmo u4 etomr3oadopDranvo;s)seumxrpiu1lpee icslt  ruaurooo1tltn ieiys mDra( p;(4trtoxo3todfmte i o t0trtmxm no1ap elfeta(  2tm(roou4aptn iciasfaDumnvs;u4 lxoiocoodfm  aiei ( seuo(o nudlmt  fctlt)s2rr(  ou4ole mfeiasfa eln snu)trermr3iadomt luvi s teuo(o iydam elietlt a2uaurpoo0oetoiietytfaDelu s () rxrxo3to1faDraueo ()srxmimpno1lpenliei t)aruaxro;o4olxnmi3ilsfa2rluvp u4 rxrircio1oa rln ols)teto(m3iu1ome  fctas)s2rax pot4tet ifcias aDelumpnt)areoirctydfa elnvils0sexmim iu4ome mfvtls artrxmpoo1tetoifetydfmDeluvpnt4 etnxociotla r ies;s0seto(opnydal elneiat aDtrxmo;t4alxomiciatfsDrlumpnu0 exrirciadop elnei t)teur(r3iu1ol elietls s2raurooo0openmf3iad s rlums u0altnif ia1lat li i t)t2trio3ny4ale  nvtatf rtax  ;o1tptn iciyslm2uauvpnt4texoif ia1fmDr ieo t s2um(mpoudlp e icsa()s2trxr ;t0opxnmfcildls umu s;t)tltomf oo1la raueil(0srto(rpiu1lpen neil() Dum(mpou1texomiciatfa uln s (4alxrmo todoatranesl(0 etmio iu4ll   ics t)srrru o;t0opx ifetldlm2eau o;u4trtomo3iotlat ln o t srxr(r io4amt mnvs sfarra( p;o4olxn fcildfa2um( o t) rermf iadlaDe ivsl(  euoim io4omtemfciasf Dtrumpnu0tex ii3tydfmDum(vp;u)trxomocoa1lmD aies;( sexmxr3nodopt lnesls a2tmxroot1teenifeiytfs2rlumonu) rtnifctodfmt liei;t)t2trxm no1ap   ivsl(fa2rm(mpou0oee  fciltfaDumn o;(4tltnioctodopt  i s;s0t2xoim3nu1lpeelnciat  rrmxrpnt0aetn feildfs rauvpnu4aleomf3oytoa rlu sl(0t2urxo oy1lmt  ivils  Dta( o;o0oeeo oetadfsDua(mo;t4 rxnircoytlaD aivils0trurxm3ou4lp   feilt a2uau oot1teen fcils a2rmn pn(4 lxoxo tytfm   iei s  eum(mpoodap  lfctat  Draurooo1aexo feiadfmDul(msnt4 rerio3tydfptranvslt trurir iydamt mncs s)s2rrxmp;u4ole  i3iadlm2rmumsnu) rerioctadoatr iei;() rtoirpnydlptn nvi (fa2urx pou4oetn i3ildfm2rl( o u0 etoxocoy1lptrli i;s)s2um(o3iy1lpt lnesltfsrta(m ;t1ale mfetyt m ra(ms ()artnmociytfmt  nei;()t2umio io1aptemnci sfartmu  no4teen ocils aDrau on(0aexrio3totfp elnvi;t teuoxr3iy1altn ivia()sDua( pno1tlt ifeias sDumnmp u0 lxrmocoadfmDeanvs;t0 rxrir oy4alt  iesls) Duru  ;o0alt  o3iyd s2uaumont0 rtnxrctydfpte n il() rtoim3iodllt mfvsat  rrrx oot4aex ifciyslm el( o;t4aleoif iotfatrauvil( truoio3nudlmtn nvs () 2taumoou1apt  oetytfs2rlump;u4trxrmfcoo1fm ranvilt0trxmxr nodop elieslsfsrum(roou0olxnmoeildfs ulnvo;t)aeermo totlp  ai i;t0srum(o nu4lpe mfvia(faDtmum ;u0oeenmo3ilsfa rl(mpnu) eenmr oadlptrai ol()s2trxr3oy4optnlics tfaDtrxr ;t4oltnmo3tatls2elumsnu4teeoif oytlpt livo;()tetmir3ou4om nlfetas  2rrxr ot0oeenioeiys s eaumonu)trerxf iydlptrli o t0s2uoxopny1optnliei t) Dta(mpno0aee  oeilt s2emuvo t) ltrxo3oytlp elu s t teuoxrpoo4open ies (  2uru p;o4teto oetldlm2umnvpnu)aetomocta1lm eaivs t0 exriopoudomtelicslt) Drm(m ;u0apx  ietatlm2uln sn(4tleomo tydopDelneilt)s2xoirpny1om emnvils)artruroot4alx iietls m2rm(vsnt4artoif todlaD  n il(0 rxm(o3oydopte ietasfsDtrxrooo4apx  fciyt mDeanvs;u) rtoif oytlmte i i;s) 2xr(opnu1apt mivia( aDuaxmo;u4altnif3taslmDumnvo ()teeomrcoytomDraieo s)teuo(opiu1ameemiei (f rur( poo4aptn iciytfs rl(mpnu0aexrxo3oadopt  u i s)t2urim oudameelietl()aDumu poo0apeomoeildfmDel(ms u) leoxocoy1laDelnvo s) 2trio oudoptnlncs sfarraxmpoo0apx micilsls2eauvo u)aeeoio3iodfp   ues s)s2trir oudlle lies s  rraxr nu0tleoiieildfa rluvsn() leoir3tytfaDr ues t) etoxr3ou4lp e nvslsfarua(m ;t4oeeomicilsfaDra( p (4 leniocia1lptelu s t0 rxmirpnodlmen nvsa() rtmx  ;u4optnmfciydlmDelums t0tetoxfctydlp rlu slt)setrir ou4apt  iciltfarrmx oou0aet mo3tltlmDum( s;(4altnxr ty1fmtrluvs t0s2tmim3oy4lm n ncs (  Dtrxrp;o1ope  fcilsls2ulnmonu) reomo3tydfpDrlu s;t0 2tmir ou1lltnlics tfsrtmxr nt0ale  fetasfsDumu sn(0 lerircio1fa  ln o s) 2toiopou1llenmfcias sruru  nt1tpt mictas a2ulu sn(0 etrxfctodlm  li il( trtrxo oudlmenmnesat  2rmx o;o0tleoiieiysfm2emnmp (4 renxf3ia1fmD  uvs;s0 rtrxr ny1olee nvta() Dtm(r ot4tpenmi3iad m ulu s;(4 ltrmo3tydlatr iesl(0tetoxm nu1al e fct t a2raumont0tlxn octlsfaDumuvs () ltnifciodlp r ivsls0srxoxmpno1lp  mnesa(faDum(mooo0oleoifciyslm umn s;u4tleoxfciy1fm e uvs s0texm(r oodaleelncsat arraur ;u1tpxo ocilt mDrlnmo (0aexrif ootfa  aivi s s2xoim oo1lm nlnetatfs2ra( ono0alenmictas a2eanvsnu4 rxrmf oytlpt lnvsls  rxrxrpio4op  lnctlt) Drmxrono1aex  feiyt s ulnvp;t0aexoir3iydlpD lnvs (0tetoir3nu1ap  lnctat  rtaumpou1altnmieiysfsDranvpn()aexomf3ty1fmt aueo t)teur(r3ny4am elfci (faDuru  nt1oeeoio3iadfs2ra(mont4tlxnmfcoa1oa e ivo;s  rum(m3nudamtemfciat  Dtr(mp;t4apto octatls2uanvo ()trtrmf3iatomteaueo;s0seumimpou1lptelnvt (fsrumur ;o0tetoii3iytlm rmumo;u)tlxrircoadfaDr ies t0srtmio nodlmtelfct (f 2ururooo0olx  iciytlm2el(mp;u0aetomf iadfmteanei;s0 rxr(opio4omee ieias srurxm ot0tpe  fciydfs2ea(ms u4 etoxo3tatfa  luvo;s  exoir oodlltn icil() ruaum ;t1oee  i3iad s umn s t0artomfctydfmDranei;s0srurxo3nudal  lnvs s  2tmuroou0tpt mfeilslm2rlnvpnt0aetrio totoaDe i o (  rtmir3no4lm  miet t  rua(mono4tlt  f3iytfa2eauvsnt4 lxrxfcio1latrli o;s0 etm(opiydlmt mnvt t a2ua(m ;o0tlxnmfetls s2ul( sn(0 etoxrcio1fateanes s0s2uo(o iudam emfvi s arrm(rp;o1apto fetytlm eau sn(0 eeomf3iatfaD auvols sruoxrpny4lmt lnes (fsrum(ro;u0tlt  ociatfm2ul( pnt4 reoxo tydoa eaivsl()t2xmxrpny4lme lnct s sDtmumpnu0oltn ieiytlm2el(vp;(0 ltrxr iadopDraues t0teurxm3oodlmenlncil(fsDrru ono4apt  i3tldfaDrm( p t0aexrmfcoadla r nei;s0s2urirpnodomt mnesas) rrmxronu1apt mieild s2eaumsnu) rtrxo oodlmD li i t0truoxrpiu4ameemnvta(fs2ta( ont0oeeomi3tysfmDrmumont0 lenxocoatlptraneils0texo(mpno4optnlnvtlsfaDtr(rpoo4tpx mi3tadfm elnvp t0texnmf3iodfpt li s (0trum(rpoodam e fvtat  rururpoo4tlxnmf3tyt a2ran p;t)alenmfcta1la  luei s)s2um(r3iydlmenlfetat a2trx  nt4olen ociatls ua(vpnt4trenxo iadlmtran sls  exmxm3nodlle  nvt ()s2uaxro;o1tpe mi3ilt m ean o t0tlenmr3totoptelivs;()srtr(m iy4lpenlics (f 2rr( oot4opxnmi3tasfm ran s;() etnmrciodlpDraueo s trxo(m iu1alt mieiasfsrrrur ;o4oex  oeild a ua(vo t) eermo ootfaD lnvi (0trto(mpiu1lm n ieia(fsrurxmo;u4openifetld m um(mpn() rtrmf tatfaDe nvi;t0 eumiopiydlmtnlicta(faDrru  oo0tptnmf3ildfm2um( p;(0 exrmr3iy1lmtrlies;t srtoxo oy4lpeemieias aDtmu ono4oexn ociyslaDrm(mo;t4tltrxfcoydfm  aieo t) 2toir iu4lpenmnvs (f Drrx  ;t4aet io3tldlm2rlu o ()arenxo oa1faDrlivi;t)trumxmpoo1apenmieiat) 2tm(mpno1olxnmfeiytlsDem(vpnu4artoif3iodlm  auei;s0 exmxmpiodlle  neilt a2rrx  oo4tltn icias mDuau pn(0trtrmo io1lpte u o s)srxrio ny4altemivtlt  2uru p;u1tpenmociasfm2rm( onu)trtnxocootfpD lnes () etoxo3no1lpen nei s  rrrumpou1aetomi3tls m2ra(msnt0altnmr tytfaDe i ols  etrirpnu4al  mnesatfsrumur ;o1opxnmfeiatlmDrl(ms u)areriociotlaDelueo t t2to(o3ny4lm nlfci tfsrumxro;u4tleoiieiysfm el(msnu4teeoxf tydlaDeln i t  exrim3iu1lme  nctls sDuru ono4altnif3tld s2ra( pnt0 rerxf3to1fmtrlnvi;t)trxo(opiy4lp e netat  Dumump;o1alxnioeiltlm2ua( p;()trxrmfctodfpDr n i;s) 2umxm3oo4lpenmivtltfsrumxmpno4tpxn ocilt mDum(mp u)aleoxfcoadoat  uvol( s2trio oydam  mncslt)arra(mooo0opeomfctys a ra(von(0 lxnmocootla  ln olt0 2xoiopoo4llenmnctl( aDumxr ;o4tleomicilt s rmn snt) eenmr3oydfpDraivs;()trumir3nudlme mnct (fsDrax p;o1aet  fcias aDeln p;()trtrif3to1omDraies;t trto(mpoy1lmtelfctls)s2ur(mpno1opxnmfeiadlm2ul(vo;u4arxnxrcia1fatelneo t0trxmio3oo1lm elfetls aDtm(r no1apt ioctasls ulu s;t0aetnxo oy1fpDe ies (0t2tm(m3iudale  nctatf 2rr( o;u0tpe mocild m ulnmo () lxrir tadlaD  uvs t)trxm(r3iydalt mivsas srta(m ;o4alto oeiatla ran ont4tltnxr3tadfmDeanes s  rtr(m3ou4oltnlfvia(  rua(m oo4tptnmf3tlt m ulnvp;(0tltrifctotla r i s;t) ruoiopoydlp n fesltf 2tm(mpno4tpt mo3iyd s ranvp t0trxrxo3iytoat  uvi;t0s2to(opiy1apt  iesasfsDur(  nt4opt ioctyslsDelnvonu4aetoxr iy1fpteln i (0teurxmpio1optn ivi t)srrrxmoou1aptnmicilsls em(vpnu0trerxrciotlat  nvs () rumxrpoy4am emiesat)aDur(  ou0tpxnifeiadfa ulumsnu) reomocootfp eaies;t) rxm(mpno1lpe mfctls)s2rmxmpnt0olt mfetldlm raump;u4 rtrmrctytomDeauvolt teum(r oy4lpee fesl(  rrrx o;u4tlxo ieiatlaDum( pnu4tltrmoctytfaDranei ()tetm(m iudaptelfet tf Dtmurpno1alxnifcildfsDuanmp (0aetoiocoytom   u s s  rxrir iydlle lncsltf Dumx pnu0alenmo3iydlaDul(vs u0trtrxo iatfa   nes s) rur(r3iydolt mncs t  2rrx  ;t4ope ii3iadfm umnvp;(4 ltrmo3iytomt luei t trto(mpiu4om  lneslt)s2rmx pnt1tpt ii3ildfm2uanmp () exriociytfmtr ivs;s)srurio oudole lfctltfsDuau  ou1oetnmictldfaDrmnvo;(0alenmr3oatom   nei s)sruoxr oo1optelnct (f 2uaurpot4ale ifciatfs2ea(mo u)altrioctatlaDr nvols0srurir3nu4lmt livia()s2ra(mono1texoio3iydlsDumnvon(4alermo oatfpDrln o;()srtoim iydlpee iviltf Drmumoot1aexnmo3iyt a2rmumo (0trxrmf tatlat lueols0srtoiopiy4omtn ictl( aDrr(mo;u0tex io3tldls2ea(ms;t) leomrcoadfpt ln o;s s2xr(r3iudlpee feias srtmxroot1opeoioeilsfaDemu s u) reoxoctatomDeaueo s) euoxm oo4ame mneilt)arraxrono0tpt  i3tatlaDrl( on(0teenmf3ootopDrlieo (0srtm(r nudolen nctl( arur(r ;u0olx iociytfa2rl(mp;t) rxomr totfat  ieols) 2xr(opoudamtnmnei (farrr(moou4oleo i3tat a2uluvpnt) ltnmo3iadlp  ln i;s0trurirpiy1olee ncslsf Drmu o;u4alxnioeiyslm2ean p;t0 eenif3ia1laDrluvi;s seuoio iy1omtnlict sfarur(ro;u4alen oeilsls ranvont0 lxnxf ta1fp r uvo s0srtmio nodalt micia(f rumu pot4tle io3iytlsDem(vo;u)alerxfcoytlatelnvolt)t2tmir3nu4om  mneiltf rtaxmp;o1tpe mfeiyslaDel(vpnt)tltnxociadop elivo;( trurir3nodalen fvil( a2trumono0teeomfeilt m rl(mo t4aetrmr ty1lp   uvs;( s2trxopiu4ome liet tf Dta(mo;o4opt mf3iys s2elnmpnt0 etrio3io1fat  iesls srtmxo no1lmee ivi t) rumxr nu0tptomfcildfa rlumonu0 etoxo oydlatranvilt)trxm(r3ou1lm   fvt (f Drm(mpoo0ope  o3ils s2ulnvo t4 renmf3oa1opDeluvi () rtm(opnu1op  mfcias srtmxmpot4oee mf3tyt mDra(vp;u)altrio iodfmD  uvs (0truo(r3no1lmeelnesl(farum(mont0oltnmf3tlslm2eau pnt4 lermfciy1op elivi;t sexrirpou1ape  neia( s2rrx ono1oexnifetytlsDulump;(0 eerxf3iy1laDr n olt trxmxopou4olt livs sfsDrru  ;u4aeeomociadla2rlnvs;(0 lxrxr3tytoa raivsl( t2trxopoo4lp  mnei s srtrum oo1tlxn fetatla rl(mp (4teerxf ootfat li o;t s2urxmpny4am n icsa()arrmxmoot0ale mfeiad a2eaumo ()arxomo3oydlaD  n o;s0 etrirpoudomt mfet () rrrum ot0tet iictltfaDuau p;u)aetoif3oydopt  nvs (0t2trir ou1aleemnciltf 2taxrpno4tet  o3iatlsDrmnvs u)trxnmo3ootfptraiesls tetmimpoydlptnmiesl(faDrmxronu1oexn o3iyt a2uan o;(0trtoir3ta1fmDr u s s s2umirpno4lleelfciat)sDum(m ou4alxn fciatfm2uaump () rtrircto1fat  nvi;s0truo(o iydll nmivtl(f Draxmono0ape mo3tldls ea( o;(0trtnmf iotlp e ies s0trto(r ny4lmeelnctlt)arra(m ot1tltomi3ild aDrmuvont)trxoxrctadlatranei;t) 2xoio iodlptnmncsl( arurx p;u4oltoiietls m2ran pnt4 eerif oatfm e u olt0 rtmiopnudlm nmnctat arrr(rpot1texnmi3tys a2um( o;u0 exrxf3iadfa  li i s  eto(o3iy1alenmnct s)arrau  ;t4apxnii3tydfm2eau o (0tetnir3ootlpD livolt)sruriopnu4alt mnciltfsDraxrp;o1oexoifeiytlmDum(vp () etrxf iodlaDr ieo s)s2tmio oy1om nlivs t)a2taxro;t0optoio3iltls eauvp (4 etnif oydom rlnvs;t) etm(m io4al  lfvt (  rrm( p;t1tlx  f3iyt mDua( o ()tetrxf ta1la  aivs s)s2tr(opiu1lmeemfvi tfs2rrxrpno0tpenif3tltlsDel(vsn() rtnxf iatfat aneslt)t2uo(m3ou4om eliet ( s2rr(r nu1olxo ociyd m ul( p;u) ltrxr3ootfmDrln s (0sexm(m3ou1ale mieils  2tr(r nu4apxnmfctydls2emuvp u0 rxomoctodom rlu ils0t2uoio iy1lmt mfct t s2rrumonu4oex ifcilslm2emu s;t0 lxnirctatoptraies t)s2umxo3nydamen nes s)s2ua(r ;u0tpe  octysfs2umnvonu4aexnxf3iatoaDr neolt t2tmirpiy1lptemnvi s) Dua(rooo4tltoifeiydlm2ul( ont0teenifciytlaD li s t s2xoxo iudam emfvta( sDtr(roou4tlxomfcilsfaDrau pnt0 lenio oatfm eaivi ( sexmxopiu4ope lfei t sruru o;t0apxomictlsfmDeauvpnt)tlenxo3iotfp rluvils  2toirpoo1lmtnmictls)arrrur ;t4teen oetasls eau p u) exrmocoodfaDrln o ( sruo(m3no1aptn fetltfsDtr(mp;u4opto feiat a2ulump (0tlxrxr ta1lpDelnvo;(0s2urim3iodopt  ivs s  2uaxmpoo1tle ioeiadla2emnmsn(4alerxf oydom r i o;s) exm(mpoodlle mivs s  Dtr(r ;u0aexoifeiysfaDeaump;t0trxrmf3ootlptrli o;t tetoxr iydoptnmfcslt aDra(mpno0aptnmociysla2ra( o;()aexniociodoa ranvs s  2xmxo oudom e nvtas sDua(r ;u0tpe  feiltlmDum(mp u)alxoxr3oa1lpD  nvs ()texm(r ny4apenlfes sfs2taxm no1ope  o3ias sDrmnvsn(0alenifcto1lpDrlnvi ()seuoxrpiudllt  fesa( a2umxr ;t0opto o3iydfm um(mon()arxrircoo1fat auei;s)sexoio io1aptnmncsat a2uru pou0tpxomfcildfm rm( pn(0alxoxf tydop r ivsl( s2xoxo no4om   feiasf rrr(mo;u1alx mfeiydlsDeanvp;t) rtrif3tytoa r i olt0 rtmim3iydol emncilt)aDumxrpou0altoifeiad aDrlumsnt0 rxoio iatlpt livi t0teumxo ny1am e ivilsfs2tm( poo4olxniieils mDea( on(4teeoir3iadlp rlnvsls  rxoio ou4ap   ivs (f 2rrxm nu0tetn fetltfs2umnvo () eermr3todlpteaivs t)t2xrxrpiu1aleemicia() 2ururooo1oet  fetltls rmu p t4tlxnmocia1omDeluei s0trxoxrpoydopte ieils) Dur(rp;t0apxniieiadfmDrauvont4 rtrmfcoatlm eaueilt) eumiopno1ol eliet (  Dum( ooo4opx mfcias aDemumo;t)alxrircia1lm  lies t) rxoxo3oodoptelnci s  Dra(mpnt4altnmfctysfa ra(mon(4tltomrctydoaDe u olt) rxmimpio4ol n iesas s2tm(rpno4opt  icild a2rmnms;u)aexnmo3oadfp r nvo ( seum(opiydlp elnciat a2raur nt0olx mi3ias a2ul(ms;() leomf ta1lmD  uvs () 2xm(r iodlltnmfei sf 2ur(r ;o1oee ioeiat m ra(mpnt0teerxo3iotla raies;s0trxm(o oy4lmenlivils aDrrumpno4oeen i3iaslm rmnvo;t)tetomf3ta1op  au ol()trum(r oodalt lfvta()a2rrurpno4aetn iciadfa eauvp;t0aexoxfciodlat aivi;s sexoir iydolt  neilt)aDum(  nu4ope ifeildlsDrlnvo;u4 rtomr tadlaDr ies t trxmxmpno4opee ivils  Dtaur nu1tpx moetldfa eanmp u4tlxnio oa1lp  lu s s0 rxrim oudop  mfvi ()aruaum no4apxnifciasfs rau s u)alerxfcoydlmDe nvs ()texoxo3iydopt mnes ( aDtaurono4opt mfciys m ea(msnt0 eerxocoatfa rli i s s2trim3nydolt mieiltf 2ua(r ou1alt mo3tltlaDuau snu)tlenmocoy1fatrln i t0seurxm3oy1oltemneslsf rrm( o;o0tltomfetls m emuvonu) exrxrcio1lptrlues t  rtrxrpoy1ol n nvil(  Drmx  nu4olt ifeiydla2rl(vs t0 exnxf iotfmtrln i s  rtrio3ou4op   fvtl( a2um( oou1oeen i3iatla ulumpnt) eeoxrctadlm elnvs;( tetr(o3iudlm  lict ()aDra(rpnt1opx ii3tldls ua(vp (0 ltoir tydfpDelnvil( setoxo no1ll nmfct s srum(r nt1tle ifctysls2umnvsn(4texrmr ty1oaDeaiei s) euo(opnydol emieils  Dtrx onu0tetomietltlaDra(vp (0tltnmrcootfat  uvi;()srxoio iy4opt mfciatfarrr(r ;u0apxoio3iadls2uln p (4 ltnmfcio1la  aneil()t2xrir3iodlpe  neias)srra(rp;o0tptn f3tytlmDelnmo (0treomo ootoa e i ol()srxrirpnudoltnmncsa(fsDraumono4aexomo3iadfaDrmump;t0treomo oo1omtr nei t  2xrir oy4omtnlfvt sfsrrmxm ;o0tpenmfeiys s rmumsnt)altnir3oatfatrlueilt texoirpiudlpen nctatf Dtmx  ou4tlxoioetys sDea(msn(4 ltrmr iytlm  livs s0 rur(opnydlmt lnvi tfsDrm(r ;u1oleo f3tas m2rmuvo (4aetnmf iy1fptelies;() 2umiopoodoltelicsa( sDtm(moot1tex mociltfs rauvpnt4aexnxrctydfateai i;t0t2xr(mpiudlleelfcsltfaDumur nu1aex  fciys m2eauvpnt)trtrirciatlm eauvs;t)srtrxm3iu4apeemfet ()aDrmump;o4teeoii3iyt aDua( p u)tltnif tadlpt  i i ( srur(r3iudolenlnetas sDum(m ;t1aetomfetlt aDulnvo (0aetnir ty1omDrluvs;t)t2tmio3nu1op nmnvtls s2trxr oo0ope  fcild a rlnmp;(0arxrmrcootoptrlivo;(  exrio3iodapt  ncsls)s2uax pou4apeomfciltlaDumump t4texomf3todfate uei;(0s2uoio3iu1ap n iet sfaDtm(r nu1ope iieiydlsDumuvp;(0 eeomo tydomD lueolt0t2urxrpnydale  fvt s arum(  ;u4tpeo f3tytla2uln p t4 ltnxfctytfmDr nvs () 2urxmpiudalt  neiltfsrtrx p;u4oet ifeiys aDuaumo;u0tetnxfcoytfpt  neo;( texr(m3oudal n ivs ( sDraumont0oee  ociydls2rl( s;u0aetnmrcoo1laD anvs (  eurxm3iu4opt lncs tfsDrrxmo;u4tlto icils a elnms t0 renxfcoy1fp e u s () euo(o3iudalen fcilt) Drmu o;u0aexomoeiatfa2rl(mo;u4aleriociy1fatrliei;s)s2xm(o3ou4ll e feiatfsrurxroou1aex moctatlm2uln o (4tlxnircty1laDraieo;s sexrim3nu4amtnmfcia(  rurxmp;t1tetoifetldlmDuluvo t0tlxomo3iydlat an ils) rumio3no4op emfcs tfsDtm( poo4aptnmoetadls ul(mont) etniocoa1fmtrlivo;()t2tr(m3oodal  miesat)a2umu  nu4alen f3tatfaDumumont4altnmf todlmD lu olt srtrxopiu4alt livsls sDtmx pot4tpx mfcilsfa2elnmo;(0 ltrmf3tytfate i il( trurimpnydop nmfcsa( arurxmo;o1apxn fciltlaDulumo;(4teenir ty1la  aivs t0srtmir io4lmte fcta() Drmumono1aee  o3iydfs ra(vpnu4 lxomfcootla   i sls0t2tmxrpoydlpenmneilt sruru  no1aetoii3ildla2raumo t) eeoir3ta1lpD li ilt)s2umxopoy4lmtnmivtasfs2tax  nu0alxn oeiysfmDrm(mo;u4trxoxrcia1oaDr ueil(0t2xr(m3ou4om n fvt (  Drrum ;u1texo fctydlaDelnvp;t4alxrmocoatlp  auesl()setm(mpno4lpte fes t)sDrrxmpou4olxomieild a rm( o;t0artrir oytomD au s () 2urxo3oy4optn nct ( srumx ont4tlx iocildfa ul( s ()tlenmo ia1omt  nvilt)t2tmxo ny1llenmneil()s2ur(rono4altoifeiatfa umnms t4tleomr3tytla   nes;s srtoir3oudamt mfvs s arrmuro;t0aeen oetad a em(vo;u4trenmo3oadfm  aueo ( trxrxrpiu4aptnlictls)sDuaxr oo4aeeomo3tat s2ran o;u0arxnxf3iy1opteanvo;s seumir nudlltelfvsat) 2rrumpot0alto oetys m2ra( o;(0treomf3tydfm rauesls0truoxr3oudlptnlncs s a2uax onu4tee iicilt a2uauvont)arenir3tadfmt livs t trxmimpio1ale  ivsa(fa2tm(m nu0teeoif3ias a2ea(ms u0altrio ia1lpDr nei;t)t2tmxmpnodlmee nviltf rtr(  ;o0tptomo3tas a emumo u0arxrmo3oy1omteaivs (0 eumiopoydomtn ict s)sDraumpno4alto fetltlmDelump u4 etoxfctytlmt au s;()sexm(o3ou1llenlfvsas)srrr(r ;o0aleo oeils a2eauvonu0 etrircoatfmD an sl(  2tr(r oy4apte fcil()aDrmxro;o4opt iieiasls2um(vo;u) lerxf ta1opDe nei;t seuoxopiu4lp  lnci () 2trum ot0tpxo i3iydlm2ra( snt0trxnio to1fa elieo s) rtrxr nydapee ncsat) Dtm( pno0tle mociltlsDelnvp;(0alxoxf todfaDrauei;t)s2umio iu1llenmfvt (faDur(m ;o0tlx  ictltfmDemnvp;u4aeermo3oytlpt  u s t)srxmirpoodolt  iviat  2rm( pot4tet  ociytla el( o t)tlxnmo ta1lmtelnvo;( t2toxm3no4lle lfcsls srraxmpnu0tee mo3iadfs2ul(ms ()aeeoxf3totfmD anvsls0t2tmiopoo4olenmivs sfa2uax  ;o4ope mfeils s2ua(vpn(4teeomf3oa1optr ivo s0 exrim nudoptelfeiltf 2uaur ot0tltnioctadfs ea(mo u4texnxfciytomteaivil(0setm(r3nu4alte ivil(  rrr(m ;o1texo ociad a2em(vsnt)treoio3oy1la eln s t s2xm(rpnydlmtelfcsls  Dtmuront0alx  i3ild aDra(msnt0 etrxo3iotop elueils)seurxmpiodoltemfetas)artrxrp;t4olxn iciyt aDua(vo;u0trermo oo1fpteai olt) rxmio nu4ap nmnviltf 2rmum ;u0apen i3tydls2rm( sn() lerif oytfpteauvo ( s2urxr oodom nmncslt arrm(moot0tet iieiad m elnvo;u0trxrxociadop e nes;t) etoim nydaptnlnvs s  Duaxrpou0olxomictlsla2eluvp ()arxrmf tydomt lu ils0 etrir oo4om   ncs ( aDrru pou0tptnifeiytla um(vonu4alxrxf oytomt luvi s  exo(mpoo4opt lfcsltfa2uau ono4tetn ociysla2emnmsnu) rxrio3oodfp  liei;s s2xoxm no4open nesas  rra(m no0altomf3ilslm el(vp t4 ltnifctytlmDeluvi ()seur(m nodllt miciat a2ra(mo;u4aexomfetad s2ulnmo;()areoxr io1op   ieo t trtrir3nudllt  ivt sf 2rmump;u4oex io3ils aDumn p u)aeenmo oo1la  lnvsl( t2xmxo oo1oleemnct t)s2uau  ;o0tlenmociatfm2elumo;u0 eermo oodop  lues t) eum(r ou4altelfcsas aDurur ou4opx  ociys aDua(msn(0 rtrmo3ta1fp raues t  2umim oy1optnlics () Dtmurp;u1alto o3iytfa umu p;(0 rxnifciotop rlivs t0sexrxr3oy1lmtn nct s  Duax oot1tptnmoeiatfm rmu o;t4 renmfciydlp rlnvils seurxrpio1ope licsasf Dtr(  oo4olx if3iyt sDum( pn(0tltoir ty1la eauei;t) euriopiu4ale lictlt arrmx pou4altomf3tls mDemums;t) rxnmo oodfmtraivo;s trurxopnydoltnmnvsatfa2uaxm ;t1oee  o3iyd mDranmp () ltnxo3oadopDelieo s trtoir3no4lpte nctls aDtr(rp;u0optnii3iysfm2uau p;u0aetnir iotlmt  u s;t s2to(rpoy1altnmfct ()a2taxm ;u4tpe mfeiatfm2uanvs u4alxriociytfm ran s t0s2toim3iy4ol nlfvil() Dtmx ono0alenio3ilsfs2uauvpn(4tetoir iotoptran i ( srxr(mpiu4lmtn fci (fsDra( p;u1aeeo f3iatls2umnvp;u4trxnmfctodoaD auvo;(0s2xmxm3ny4apen fcs (fs2rm(m nt0aeeo iciyt m ulnvonu)aexnif oy1oatrlnvo s0 2uoiopnu1ome  ivt t)srtr(ro;t0ope ifciydfs2rl(mp;(0alxnmf3tatomD an i t t2uo(o nu4optnlfct (f Dum(ro;u1teenii3iatfs rauvs;t0tltrmr3oo1fpt aueolt) 2uoxr io1op elfeils)sDuau ono0alto feiad a2emu snt4altnmocoo1fmD anvs s)srtoxrpoudlltn nei s)srtr(r ;t1oet iietldfa2umnmo u4treoif oa1omDeauvs;t  exoxm io4altelnct (fs2ta(m nt1apt mociydls um(mpnu4aetoirctadlm  anvo;s0s2uoxo3oudlpe mictat srur(roou0olx  oetytfs el( o;(4 lxoxo iatla r i s s)setrxm3oudoltemnvta(f rtau pou1teeomociatfsDuln o t0areoxrctodfpDrai il()s2uoxm iy4om emiviat)a2um(ro;u0tptniieilsfs2em( o (0trxrio iy1faD auei (0s2um(o nu1alenlicsatf Dra(mo;o0apxnii3tytfs uanmsn(4tlerif io1fmD aiei;t  2tmim iu1alenlfcta(fa2uru  nu4tpeomoeildla2rlnmo;t4 ltnmr3oytlm elneil() rtrio3no4om nlnvt tf Duax  ;u1aexomfeiad s2um(msnu4trxnifctadopDeliei;t  eurxr3ou4op emnesa(f 2ururpoo1tpe if3ildfs2ea( snt)trenmr3io1opt  n o;(  rxo(r3nudlme  icilt)sDua(ro;o0olx ioctlsla um( o (4alxnirctadlaDe ues;t s2trxopiy1al emiet tfa2rrx pnt0apxomociltlsDrluvont4 leoxo3ia1lpteluvil()teum(r ny1al e icsa( srumuroou1oetnmf3iasfs2ea( o u0aexnifcootopDeaivolt  2ur(r ny1op  lieta()srraxroou1ale if3tytfa ul(vs t0 leoifcta1lptean sls  eumxr3iydal  mfctls s2rax  ot4alxoifcildfsDulu o (4aleomf3io1oateaues;s  2xr(o oudaltelivt t)sDur(  no4tpxoiociadlsDeauvo (4aleomo oytomDr uesl(0trtm(m oodalteliet ( artaumpnt1opeomociat m2uanmpnt)aeerir ta1laDeauvsls0t2xmxo3oudol  mictas)sDrr(mpou0tpxo fcilslmDrluvo u0 lerxocoodlmD  u i ( t2to(r oo4oleeliet (faDrm(ro;o1apt moeilt aDem(vo u0tetnifcoadlaDelieolt)s2xmir3iydal nlieils  rtrxro;t0olxoiictyslm emumpn()texnmrctotfa eaieol(0trurxo3oodop nmfei s) 2umx ono0aeeomieiad aDranmp;(4altoio ty1lm  aiei;()t2xr(o iu4al nlictat aDrrumo;o4opx  ieiysfs2rlnvp u4 eeoxo tatfaDeaueol() ruoxr iy4lp nmfci (  2tm( o;o1alxnifeiadla2ua(ms t4areoiocoy1opt aivo;( s2umio no4lptelfes t)srrrxroou1tleniieiltfm2ra(mpnu)aetomf iotoateaieo;(0trto(m3no4optn nvias srtr(rp;o1aetoifctad mDea(vp t) etrmrciytfaDeaues s)s2trio3no1opte ict s a2umu  ou4tlt  icild aDeln p;t)treoifcto1fa rauesl() rurir3ny4olte fci s s2rrxr nu0apx  o3iydls2um( o u) ltrif3oy1opD lu ilt)s2xrir3nu1lpt mfesls) Drrxmpot0opx mfcilsfsDemump;()alenifctodomD lnesls0srum(o3ou4lm nlnvil()s2rrxmp;t4aleomociadfsDeluvonu4aexriocoy1lptrln sls) 2tmxm3iodapt mnesa(fsDrr( o;o0texo oeildlm raumon(0 ltoxocoa1fpDr ieo ()trxo(m3nu4lmt mnctl( aDrr(r ot4oltnifetyd s2emn s (0 ltoir3oadlpt lnvo;t s2tr(r3iy1lmen ivt (  2rrur ou1tex  i3iltfsDrauvs (0tetrmr io1la rai s;s0seurxo3oydlptelieiatf 2taumpoo4olx mfetysls ea( pn()arerxo oy1fmt  ivs;s  2tm(rpnu4lpeelnctl(farrrxrono0opxomfcils s el(mp (4 etoxf iytoaDr n s ()srtoim3io1ap nlfcilsfs2tm(r ;u0tee mi3iad m rmn p (0arerxr iodfm  auvo s t2toirpiu4op elivils  ruaurpnt0teeomfctatla2ul( snt0trtomfctytlpt an i;s0texoxopnu1ap emici s)sDrau poo0tpe  ieildfaDrlumpnt4trxnmr3iydoa eaneols) 2xrir io1aptnmfeias) rrmu oou0opx ifcils aDrmuvsn(4areoirciy1fa rlu o;(0 exrio3iudll nlietas a2ra(mp;o1open oeils m2ua( o u)trxoxf ty1om eau sls sexmir oy1lm nlnes s) 2um(m no4opxn f3iytfs2ua(vo;t)tlenmrcio1fmDe i i ( trxr(opny1ll emnei t)arrmxmooo0apeomoeils aDumn p (0 rtrircoodfate u i (0tetrxmpiydlp n ncias  rumumono4optnmfeiytls rl(mp (4 rxoxrcto1lmD ai olt trxo(r iu1lm e ivil( a2rau  nu4aex  o3ils sDrl( p (4alxnifcty1lm e i i;(0trumiopnu4omtn ieta( a2umxmpoo0oltn ieiat m ua(mo;u4 renif ootomDraies s sexrxr3oo4omt lfeil( sDumx  ;o4tleomfctad aDumu p u) rxoio ia1fa elueo;t0 rxr(mpiydapen fcias)sDtrurooo0ape  fctytfm uaums;() eerioctytlmD  n i;s0texoim no1llee fvias) Draumpnt0aee moeiasfa2rlu o;t0trtoxo3oatfpteluei s0 rtmxopny4am n ieta()sDurxm ;u0tlto f3tat s rluvsn(0areoxf3tadfp e nesl( truoxo3oy1ole lies (fsrua(ronu0tpe  ietys a em(msnu0alerio3tadfaDeau o;t) rxr(r io4llee fetas  rur(moot1alxoiieiydfm ranmpn()texrmr3iy1opD aneo;s0 rxmxm3oo4al e ict t a2raxroou4openmfetyslaDuluvp (4arermf tytom   u i;s0trxr(r nu4ll  mneta( a2ta(  ou4optoiictasla2rl( s;(4artniociotlp rlues;s sexrir3nydapt mivs s sDrmu ooo1aexomfeilsfaDea(von(4 etriociytlpDraneo s teuo(opou1oleelicsat aDrrur nu0opxnioeiatla2eanvp u0trermr iotoaDrlnvs;t0 exoim nudlleelncsa( aDrm(ro;u1opxoif3ildfa2eanmo u0 renxr iatfpDeanvol()sruoimpnydom emfetas artaur ou4optnmicias a emump u4aetnmf iytfaD  uvs;t0 2ur(mpoy1al nmfvtat  rraxr nt0tpeoiiciat sDrmu s;(4treoif3ootfmD aueolt0srxoxopoo4olt micslt) Durumpno4tlxnmictasfm rm(vo;u0artoircoodop eau s;s)texo(r iydom elncsl(f rrr(  ;o4oet  fcilsls emums u0trerio to1omt  n o;t0seumxo oy1llenlnvils s2rrx pnt0ape  o3ildfs2uaump;u4tlxoio3ty1fm e u slt  exo(o3oodll elnetl()sDuaur nt0oexn i3iytfs ean o;u0 lerif oodopD luei s) rtmxm oydlpe  fcias arrrx pnu4tptn feiasfa ua(vpnu0trermfcta1lm r n o t)srtr(o io1al emnesa( srra(m oo4aex ioeiasfs emnvs;u)arenmr3io1omDe nvsl()t2xr(m no1ale mics t)srua( p;o0olxnifeiatls2ul(vp (0 eeomf3ty1oatrauvs;s0 euo(o oo4lmtemncsat)s2uau pno1tlx if3tydfs2ulnmo;(4teeomf io1fat  ieil()trxoxopny1ole  ivi s artrxmoou1tlx iictldlmDumnvo;() eerxf3iodlateluvo t) 2xo(m3oo1ape  ivil(faDumx  no1alenmfcildfm rl( o (4 rtnif3tadlatrln s s)trxoirpoo4olenmnvt s)a2ua(mooo1aex mf3tatlmDelnvo (0aetriocoadomDeaivi t  2xrxrpio1olen ies s)s2rr( o;u4aeto o3tas s rmumsnu)artnxocto1fa r u s;(0t2trxmpnu4lpenmiviatf rumu ooo0altnio3ils a2rln o t) ltnir io1om eaneo () rxm(o io4lmen ivi tfarua(rp;u0aleniiciatfa rm(mp (0trermr3oatlmD anvs;t t2xoim3io4ol emictat artrumpoo4ope mfciasfa2uau onu0altrxr3tadfpDrauvol(0 ruo(m3io4om nmivt (  rrr(rp;u1apt ifctyd m2umumo;t4 lxnxf3to1fmDrln s;s)t2uoiopiu1oltemiei (fsrrmx pot1altnmf3ilsla elnvs;u0 reoio3tydom e ivo s  exmxrpoo1lpe  fcsl()aruax p;o0tpxo i3iatla2ul(von(0aeermocio1fmDeauvs ( trum(opiy4ll elici s aDurxrp;t4altoiocilsfm2rln snt4 rxoiociy1fmDr ivo;t  euoir iu1lmee ncil(  2raur ot4ale moctld aDumnvsnu)trxoxo3tadfaDelu ols) rtoim3ou1ol   fcil() Dtmx  ot1tetomoctlsls2rlu o (4 ltrxo oy1oaDran o s seuoio iy1lmenlnetls aDtmurp;t1oetn o3iysfa2ra(vp (4alerxfcoa1lpDrai ols s2umim oudalt  icsltfs2tmx  oo0apeo octld sDrl(vpn() etnxrctotfa  lnvo s0 2xmir iodlpen ics ( arrmurono4tex  fciatfs rluvonu) rxrxr ia1opt  ieo;(0s2xm(m oydlm emncils)srtau poo1tex mociadfsDel( s t4 exrmf ia1om  li i;s0s2umxr3nu1llenmieta( a2ururp;o4oeen f3tys a2rmu s u4aetomfctatopDe n o;t  2ur(m iudolenlivt (f rtax ono0tpe  octld sDumu o;()trxrio3oa1fptr n il() 2tmimpiudolenlfctls)a2rru  nu1oltniocild s2eauvo t0alerxocoa1opDr neo;(0srxmir iu1lme mictls)sDua( pno1tlxnifciltlaDumump (0tlxoxr io1omteai ils0s2xrxopny1am   nvsl(  rumuront1oetnmf3tadla rluvp;t0teeoirctydlpD anvi;t0s2tr(m3oy4ope  ictat)sDum(m ;u1ope if3ilslm um(mon(0 eenxrcia1lpDeluvsl( t2toiopiu4lp elnctltfs2taxmpot0opeoiieiasls2rmn o;t0 exoir iydomte iei ()t2to(m3ny4opt  ivta() rrm(m ot1apxoif3ild aDemnvont0trenmrctytfmDrlneol( srtoxmpiy4lme lfvs tfa2rrurp;u1optnii3ilsfa2el(mpnt) reriociotfp eau s;(0seuoxopoy1ap e nvtat srtrump;u0apeomi3ilsls ranmpnt4trtnif iydlpteluvilt  2to(opnu4amenlnvia( aruax p;u0tptoii3iltfsDra(vo;t0 lerifcto1latranvo (0 2uo(o3ou4om nlicia()a2tax  no0oet mfetlt a uanvpn(0 rtrio3iadfptrlivilt0 euo(r ou4am e fvi t  Duaumo;o4teeo oeilsfm2ean snt4aeeomf3io1laD  ivi;t) rxr(rpno4om nmfei tfs2tmx  ou0tpeo ietatfm2elnmp;()tlxrxf iatfp e uvi t) 2xoio3oudape mivils) Drmurpnu1optnmi3iyd m2ranvo;t4 rtnmfcoydfmtelu ilt)sruoirpnodap n ies sfa2uauronu4optomfctls a rm( pnu4artnif todfp rlues;s)t2ur(mpny1altemnvsat sDtr( ont0olenifetlt s2umn s ()artnmfciytlaDr n o t srtm(opoudop n ivtltfa2ua(rp;t0tex if3ilt a ulumo;u) renirctotfm r uvslt)s2um(r ou1ll  miciasfsruaurpoo0teen f3tltlm2eau sn()trtrxfctodfaD  i slt)sexoio3ny4al   nvt ()artmu  nt1apx  ociyd sDeanvp u4 ltoxo3tadfat auvils0t2xoxo iodlmte nesat)sruaur no4oetomietydla2rlnvs u0tetrif oo1lptelnvslt)t2to(r io4op e nvs s) rrmxmonu0apxnifciasfm2eanvsnu4 exoir3oy1oatrauvo t trurxm oudol e feta()sDrru o;t1aleoifetldlmDem(vont0aeerifcta1lptrli i ( t2xm(o3oo4ole livi (f Dumxmpno4tpxn oeiatfs2ulump;() lxnioctodfaDr neo;(  eto(r nodlpenmfeia(fs2trxm ot1texniieild sDum( o u0trerxr3iytla elnvo;s0teto(rpiydamee ncias srrmumoot1aetoii3ilsfa ea(ms u0 eeoxf iydopt an s;( setmim ny1aptnlfei t)a2ur( pnt4aee  i3tatfsDeauvsnt) exnmf3iytfm r ivslt0setm(o3iodlp nlneslt  rumx ont1alto feiadls2eluvs t0 lxnircoydfaDr nvs (0 rurxmpiodlm elictat srtr(  ;t4olt  fctltfm el(vo;t4teenmf3todfm  aivs;(0teurimpny4ope  fctltf rtm(m ot1teto oetad sDumnvonu)tleomr3totfatrln sls)s2toxm nydam nmfetat)srtmxrpno4alxnmf3iltfm2uanmpn(0alxnxrcoadoaD livs t  2xrir oudap e fvia()srrauro;t0opxoif3tyd mDrl(vo (4aeerio ia1op  lnvo t0s2uoxrpou1aptelivt ( aDua(rpot4tpxo ieiydlm elnmpnt)artnmo3iytlpDeaivi;s t2umiopoydlltelnctlsfarurxmoou0apeomoctlslaDeanvp;()aexriociy1fateaiei t) 2umir3nudamtemiciltfa2tr(monu4texomfcilslm2rmn s t0 lerxfciatom  ln o;t)s2um(o3oudolt mfci tfa2tmx pnt4aetn ictas a ea(vsn(0alxnxf3iatlmDr ivs t srtrio3iydlpt lfesa(fs2uauroot0oleoiieiad m2el( ont) lxomf3iytlaDelivo s0 eurxo3no1alen ivi sfsrrmuro;o0tptomo3tytfmDrmumo ()treoxfcoy1lp  auvo t)tetrxrpoodam emnvil(fsDua(ro;u1aleo iciys sDranmsn(0 rxrxf oodfateaieo s s2xrim oo1ome mfvsatfarurx  ou4aexnio3tatlsDemn s t)arxnircoa1op   n olt  2xoxr oudlpenmivil(fsDuaumo;t1tex  oetltfaDemu o t4altrmrciadla rlu slt)teurio3io4lpe lnesl( s2ta( o;o0oee mo3iytlm2emn s;u)arxnmr3oo1omt livol() 2uo(mpoy1lpt  ietls)sDtrx pnt0tpx ifetltfm uaums u)aeerxr ia1lateaneilt) 2umxopnudapte fet s arrau  ou0tlen ieildfaDua(vs;(4aetnmf3oodoa  ai s;() 2xrxr iydome lnes sfs2ra(rpou0ope moeiadfa uanmo u)alxnxo3oytfp   uesl( t2to(o no4lm emfeias)srrax  ;o4apeniietlt a uanmon(0treomr tatoa  aneslt) 2tm(mpiy1optelncs tfs2ra( p;t1tpeomi3tytls2um( s (4tetnxr iytfa  anvo;()t2toxmpiy1lm n icia()s2tm(root1teenmoeilsla2ran on(4 etrxr3oa1laD aivi ()sruo(m no1apee ictls sDtm(  nu1aee mfetadlsDrlnvp u4 rtrir3iodlaDelieo ( trum(opnodll nmfetatf Dum(r no0tpxnioetad a rln p t)trxnxrcoadfm eau s;s) exr(mpno4aleemfvs t)srtr( oot4alenmicilslsDemu pn()aetrxf tytfp eli ilt) rxrir iydamtemfetl(fsDuaxroou4ole ifcild s emnmp;u4trtomr3oo1fateai slt s2uoiopiy4altnmnct tfsDrm( pou4tptnmi3ildlm umnvpnu4 ltoxo3oytoa  lneslt trxoxrpno4lp nmneias)srtaxmpoo0aex ii3ilsfm eau p;()alermr oa1omt auei ()srtm(r3oy4amee fvt s)aDumxrpnu1tpxomfetadls uau p;u0 rxoir3io1fpt livs;s0t2uoio iy1omeemfciltf rua( pot0optn fciatla ranmp;t)tlxnxo3iotomtelneslt) rumir oodalenlict tfarumxr ;u4olen ociydfaDrluvp;(4alxrxr3oy1opt luesls  rtmim3ny1amtnmfcsatf Duauro;u4teeoiociltfs ua(vo;u) rxnir3totfp r uvs;s0truo(m iydalte nvt tfsrrax p;o0tet iietad sDul(mp;()aexomo oatlmD luesl(0s2tmiopou4opee nvslsfa2rrumoot1optoii3iysfm raumont4 lxrxrciatfp e ues;s)trxmxo oy4lp e nesls)aDtau  nt1aetomoetyd aDumumonu) etnxr3to1fat auei;t  rxm(m nu4alte ivils)a2umur oo4oetomociadls2eanmo u0 rxnir3tadlaD  neilt)s2tr(mpiy4lp  lfvia()a2raxmooo0olt mo3tys a2emn o;t)aleoxfctodlp e n s t0 exoim3oodaleemics s) Dtmxr nt1aeen i3ilslm rlumpn(0 eermfcoodoate ies;t)srurxm no4op nlneia()aDta(mont4tlt mieiltfa2elumo;t4tltomr iatom  livs s0 2xrxrpny4omen fesat aruaxr oo0aexnmoetasfm2umnvp;u)trtnxo totlate neil()s2urxmpoudalen fesat aDumurp;u1tetnii3tatlm2ea(mp t0 leoxo ootomDrlu s ( srxrir3oodopee fvi (  rrrxronu1ope ifctltfaDulnvsn(0 eeomf3ootom  lueslt  2tmxo ou4ll  lfeia(f Dtm( o;o0optomf3tlsls ra( o;u4texnifcoadlpDranvo t)tetoio oo1lmtelicia(  rrrx pou4oeeomocilt mDrau s;u)alxnmr3tytoaD anei s)teum(o3nodlle mfctas)aDrr( poo1tex mo3iytls ul( s;u4alxnif3ta1la ean ol(  2xr(r ny1amt  iviat) Dtmum nu0tet  ocild s2rm(vo t0altrif oodom ranes ()s2trxm3oydlm  licil(  rrm(rpoo1tetnii3ildfsDrlnvsn(4artrmr3iotoptraiei;()truo(m3oo1lltn ivt s) rtrur nt4open o3iadlaDrlnmo;(0trermo ta1lpDeli olt0 etrio3iudlmte ieias)a2tr(rpno1aeenmf3iys s2ulnvs;t)aetnmf3tydop   u i;( s2trxo3nudom nmnei ( artaxroot0tpeoiocildlmDemnvs;u0tltrmr3iy1lpDrli s;(0 rxmim iodame mfeta( aDumurpno0alenioeiytls emu ont4tltrxo tadoatelnesls)t2to(opiudlpte nvsls)sDtm(rpnt1aeeoioeiytfa ra(vp;t4alenmr3ootfp r u i s) 2xm(opou1llt  fcil(farua(mo;u1oeen fcild sDuanms;t)arenir oatopt  n o;t)srurxr3oo4al n fcs s a2umum nu4tlxniiciyt a ua(mpn(0tltnif oo1fm elneslt0s2urio3iydole  ncsl(fa2raxmooo1aptn iciasla ulu snt4 etrxr ootop e ivi (0 euo(rpoodlpeelfetl(  Dur(mont1oeto fctldlmDrm(mon(0altnmrcoodfpDranvil(0 eto(m3ou4oltn feia()arurx  ot0teto o3tyt s el(mon()trxrxfcta1fatr nesl()t2xr(o3iy4oltnlnvsas  2ta(m ;o1tlx moeiys s uaumonu0 exrmocoa1opD  nvo s)srxrxr nydolee icsas)a2rrxmoou4oeeo feiyd a2ul(mo u4 ltoiociytomDr nvols0 rtoim3ou1lltn fvtlsfartr(mpno4ope mi3tad s2umnvpnt) rermf iytla e uvs;s0tetm(r oy4ope  neslt)a2rrxr no0tltnmieiadla eanmp;(4tleoio3oodfatranvsls0 2xrxr nydlptnmfcslt sDrru  ;t1aex mfctysls2rmnms ()artoif totlp  li sls  ruo(o3nudlpeemnet ()srrmx oot1texnioeilslsDemn s;(0tltnmf3to1om r ivo;() exr(m nu1ll e nvtl(  Durx  nu4ope mi3iaslm2ua( sn()tetnio3iatfaD  ieo;(0 exo(rpou4op nlncsa()sDuaumo;t1tlxomiciydfa2um(vo;u)arxomo ootfm r uesls0 2xo(r3oydlpe mnet tfartaumooo0tpenifcias m rl(vsnt0 lxoifciatlpDr n sls0texmxopiu1ole  fviasfarum(monu0tpt iiciytlaDrm( pnt4tltoir3oy1fmD livo ( trtmxr oydomt  nesatfartrumpnu4texn ictat a2uanms t)arxrxoctydoat ai sls0 rxoim3oudalt  nes ()srtm(r oo4apxomi3iytfs rlnmpnu0arenifcoy1fatrlivsl( texo(o3io1alte nviltfaDtaxro;t1aee  fctatlm uln s t0texrmr3ta1op e i ols)srxmirpoudam nliei (farrmu  nu4alx  i3iytfs um( o;t)artnio ia1opt luvo;( t2toim3nudamte fvs t  rur(  nt1oetnmocilslsDum( pnt)tetnxr oodlptr u s (0 rxoir iydllen ncsas)a2tmu pnu4apx  ietys aDrauvsnu)tetnxr iy1om elnvo s trtoxo no1lpte netat)sDra( p;u4olen i3tyslaDraumsn()alxnif3oydfa   uei ( teuoxr3iu4op  lieta()s2raxmpou0oex io3tld a eau sn(4trtrxo oatoate iei t t2xrir3oy1op nlietasfaDta( o;u1oetn ieiadfa2emuvpn(0 ltoir tadom rlnei;(  eurxm oodlm  lncsl()s2trur oo0tlxoif3ildlm uau o t)altomr iotfmDelivils0trxr(o ou4apeelfct t aDrrxmpnu0opx iociasfa rl(mont0 ltrxr3tatlat lu sl(0truoimpiudamtemfvs (fsrtrx o;u0oex  ictas m2eluvo u4alerxr to1lmt ln il()srtr(mpoy1am  mictasfa2rax  nu0aptnif3iyt m uanmo t4tleoirctodfa eaies (  rtm(rpoy1aptelncsasfs2taumooo4tee  ieias a2umu sn(0arxnmf3ootlmD ai s;( tetmio3oydlpt mietl(fs2rm(mp;t0apx  f3iadfa emnmp;u)trtriociotoatrlnvsl() exrirpiudamenlfvsl(f Drm( pnu0aeeoiieias m em(msn(4 ltnif3iadfmDelnvs t truoxm oudllee nvs t  ruaxm ;u1olxomfciaslmDem(vs u) renxf3ta1fptr n slt0t2toio iodome lfvilt  Dtr(m ot4texomoctld m eanvo u)aeermr iotlpDr i s s trum(o oydlltn nct t aDum(  ;u1teeomo3tltla ulu p u0tetrir tytop ranesls0 euo(mpiudlm n nvtlt  rra(moot1ale mfctls a2um(mo;u0 leomoctytfm raivo ( seto(m iudlpt mfeslt aDurx pnt4apxomf3iatlm2rmu on(0 renmo3iadla  liesls0seumirpiudlmeelfeiltf Dra(moou1aleo ieiytfm uauvpn()alxnir tydfaD  ueo;() 2tmim iudomeelnctatfarrr(  no1optnifeiydlaDul(vo;(0teeoxrctadom rlueilt  eurimpiudolt liet s) rtaxmono0oexo ociasfs em( o;t4 rtrxf tytlpt lieol(0texmxr ny4oltn ivsa()aDtm(rp;t0oee mociaslm uaump (4 rxrio3ta1fpt li o;()teto(o ny1al   ivils a2urumpnu1oexomo3iltlmDrmuvpnt4alxoifcootfmteli s s0 rto(o3nudll n ivils)sDtmxmo;t0teeomo3iyt a2rm(ms u) lxomr3ty1la  lieo s0trxo(r3no1apte fcsatfa2rax  ;o4tlto o3tysla uanmpn(4arxnxo3oodlat  i i s0 rxmxo3io4lpenlietl()a2uaumonu0oltnmf3iysfaDum(mpnu0altomr iadfpDr ies;s tetm(mpio1lpe  netlt)srurxmo;u4tlt iieiydls2emn on() lxrxf3iatlptrai s (0s2xrxr3ny1ol n neils  Dumx p;u4olt  i3ias mDel(mo;(0tltoio3todfp elnvs (0 2uoxo3iy1apt mfci ()aDtmx  no0oltnmociydfaDumums t) etnxo3iatom e ivsls  rtm(o3nydlp n ivi sf Dta( ono4oltomicilt m2emu o u0artomr3ta1faD  nvolt  rurio oy1omtn fes ()artmurp;o4aexoioeilt s2ra(mp;t4alenif ootfpDrluvilt srurir nudlm elnviltfs2raxmp;t1alxoioctyt m emumo t)tlenxf oadfpte u o (0 rxoxm nu4ll elieta( sruauroot4tptnif3iydfmDrmnvp t0 exniocto1op  lnei;(0 etrxm3iydaptnlicilt)sDurxrp;o4aptomoeiydfs ul( s u0 lerxfciadoateluvi t  euoir3oydomenmivsltfa2ur(  nu1oetn ociltfaDrauvp;(0alxoxfcoodfmt anvil( t2umio3no1lleelivsa() 2um( oou0apto f3tasfa elumo;(4 eenirciy1oatrlu sls)t2tmxm3nodap nmiet s aDua(mo;u1tex  oeiytfaDulu onu4 lxnmfcoytfmt anesl( srxoxrpiu4llt  fcsa( a2tr(m ;t4oeen f3tldls ul(mp;u4 leoifcoydfptraueslt) rxmxrpou1al
\ No newline at end of file
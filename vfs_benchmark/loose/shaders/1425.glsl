@@ -0,0 +1 @@
+ueo;s)truoiopnodam n fet s) rra( ono1olxoiictldlaDraums;t)altrirctytlptr uvi;(0trtr(mpoo4altnmiesas)a2tm( p;u1tetn f3iadfmDul(mp;u0 leomr tadlpteliesl(0setoio3nudamtelietlsfartmx pou4tpe ioctltfaDrmuvpnt)arermocto1faDranes t  etm(rpnu4lptnlivtlt a2ta(mo;o4aptnioeiadfs2uanmo;t0tlxoio3oatfaD aieils)teuoir ou4am  mfesa(faDurump;t0alenio3tlsfs2uanmo (4aeeomf3iadla r nvo ( seumir oydlpeelfeslsfaDrm(rpot0teen oeilt aDeluvp;u4altnio iodfpt  n ils  rxoxr3iudame mfvsat s2ta( poo0aeenifciltls ulumo u0alermo to1lptrlues;s)s2uoxrpiudalen fcs (  Durxr ;u0aee iieiltla ulnmo ()tlxrmrcoa1fpteanvi;t sruoim3ny1al emivil( a2raumooo1ope ioeiltfsDem(mon(4 exnmf3oatfa raies;t0sexoxopnu4lmtnlfvt t)arta( pnu4aptn i3tadfs2uln pn(0 etrxo ia1oa rauvslt) 2tr(opiu1opt  feta()arrax p;o0alxoioetadlsDean o;()texoio io1lpD lieol(0srtm(m3iu1amt mivsasfa2truro;t4alxnioetatlmDrauvp;(0alenirctatomteln olt) exoxm3no1al n ietlt)aDraumpou0tpx mfciyslm2umu p (0trtoiocoy1oaDelueo s)t2tr(rpiodole lnctl()sDururoot4openmieiad m rl( s u0tltrxfctytoaD  ivi;(0 rxmirpoydome licilt  rrau ono0alt mociatlmDea(vs;u) lenif oytfpD au s ( tetmxmpno4ope mnvtl(fa2rm(rpno1tet ioeiadfa2ra( p () lerio3tatfa e uvo;s0 rurimpiy1amtemiciat)a2rmur ou1tltnifctaslsDrm( s;(0 rxrxocta1oaDr neilt)teumxopou1ap nmfct ( sDtmur ;u4aeenmoetytla2elnmo;u0 exnif3ootfmtrlivol( t2xr(r3no4lm nmfcils)sDrmxmpnu0altniictlsfa umu s (0aexrir3oadlm  liesls trtriopnydom n nvsat)a2tr(rono1teenmfeiatlm eaumsn(4areoio3ootlmD  n o s tetmimpnydlpt mfvs sfsrua(  oo0aeeoifctyslmDrlu o ()texrmf3ty1la  lnei () rumir oo4omenlieias)artmx o;u1tpx  i3iydfaDumumo u)aetomo tadoaDrluvs;s)srurim ou4lptelnei s) Dumumooo4aet ioeiatlm rl( snu0aeenxf3ty1op raiesl(0sexo(m nu1omeeliesltfaDrrx pou1tee mfciatla2eluvpnu0 etoiocio1opD lu i t  2ur(r3oodoleemfvtls arra(m nt1aptomieiat sDranvp (0aetrmocootfmteaueo s srtrio oy1opt lnvta()sDrm(m ;u4aexnmiciys m rln onu0tetnxr3oatla  ai slt tetr(r3io4ap nlnetl()sDraxro;u4oexnmf3ild aDrmnvont0alxoioctadlmDe uvsl( s2toimpnodlme lieias)s2umurp;u1oltn o3iyt aDelu snt4 etnif3oatfa elivsls) euoxo3iu4lm n ivtls srtm(mp;t4apenio3ild s2rmn pnt)aeenirctydlm  li ilt) rxm(opio4am nlfvsl(  2tau pou0olenmf3iasfm em(vs;u0teenxf3iadfmD lu ol(0t2to(o iu1ameelies ( a2rmx  no0tltn ieiltlmDum( o u0 rxrir3tatlaDr uvsls0teur(o3nu4lpte iei ( sDtmxmonu1aexniiciatla2raums;()aeeomo3io1fpD lu o t0texo(m3nydapee iciat)aDtm(mo;t1oeeniietys aDemuvo (0 renir3ta1la e n ol(  2xoxr oodalenmncta(f 2rm( pou0tpt  feild a umnvp;u) lxoxf3tytomDeln o;() 2xoir3oodlpeelicslsfaDta( oou4open fciytlm eaumo t0 exoif3tatlp r ivo ( srtoim oy1op  mfei s artmurpot4oltnio3ias s2rmn snt4tlxnir oatomDeaiesls0t2xoiopny1apen fes () 2trur ot0alxnmictadfm ra( pnt0arxrxo3io1optraneols srtoxm ou4olt liei sf rur(ro;o4tpeo o3tldlm2emuvonu)arenmo iotomD luei;s t2to(m ny4lleelfciat aDtm(rpou4oexomicild sDem( o u)aeermocootla e ivols)t2tm(r3oy4openmivta()a2tmx ont1altniiciatlmDeluvo u)trenxf oa1fp eanvi t t2tr(m nu4lmtemfvta(fs2raxr ou4alt mfcilsfm2elnvo;(4texrir oytfmtrluvols0t2xmim3nydlmte ictas)s2tm(  ;o0texnmf3ilsls uaums (4arenir3tytfpt  ivi (0t2toirpiy4al  mfctl(f rrmur oo1opt micildls2ra(vs (0artrmf3iadfp eaivol(0 rurir iydomeelivsas)arrrxm oo4tltn i3ilt sDrmuvs;() lxoio oytlm rlieo;s  2urxo ny1amtemnet (  rtrur oo0tpeo f3tldls rlumsnu) lxnifcoodfp   nvi (0teuoir no4lmeelnci t) 2rr(moou1opxo fetydfs2rmnmsn(0alenxf oa1la eauei (  eur(rpiu1ameemivs ( srumxrp;u1alx miciysfm2ul( snu0tlenxr3oytop   n o t trur(r no4alt  ivt (  rrru pot4opto ieild sDrlnmo (4trenmr tydfatelivs;t)teuo(o3nu1oleemnvtl( sDtax  nt4opeo fctyt m rln p u0teermrctadlmteau s s)trtr(m3io4alt licsl(f 2tr( p;o1olxoiieiat a2el( p;t)trtoxfcty1faD aieols0 2tmirpio1lme mfvi t)a2rmx ono4aee  o3iydfm ra( sn() rtomo3tydoa rlues t teurxm3nu4apte ncilt)sDua(rpnt0aeto o3iat m2ul(msnu0trxnxo3iodlaD an s;(0t2urxm ou1oltn fctlsf 2uaxrono1aexoiictad aDelums (4texoiocoadop  anvs t0srto(r3oy1al eliet t)sDrm( ono1aet mfeiaslm2eaump;t4alerxo3tytomDrlnes;(0texrirpnu1alt mfcta()arrm(mpnt0apxomocild m2rln o t0 ltnir oodlaD  u s;s) rxrxmpio4amen ivta()srrr(m ;o0aptomfciadfsDumnvonu4tetnmr3ia1lpt  nvol(0seurio no4ll nlfvia(  2tmu p;o0olto f3ils a emump;(0trtrif tadfp raueil()trtm(r3oydal n ivi t)aDua(  ;t0aetomoctltla ua(mpnu)aexoio tatoaDrliei;() 2tr(m3oydalt livtls)arrm(mpou1aeen feiyd a umnms u0 rtrmocoytlaD auvs t) rxoxr oy1omte netls artaxrp;u0alx mfctld a emnvo;(4teenmf tytopteai s (0t2umxmpiy1al emfeil(  rtm(  nt1alx if3iltlm raumo;t4 eeomrcoytopD lneils)srurirpou4op nmnctltf Drau onu0ope mf3iys m2rl( o;u) lxoxrcio1oaD ai s;s srxmio3nu1lm elivils) 2rru p;t1aetn o3tlt sDem( pnt0tltomf oatlp e u s s)trxmio oo4lm nmfcs t)sDur(m nu4aleniociytfaDrl(mo;(0 renxr3todfat auvo ()trum(m iy4omte iei sfaDtaumoou1opeoiociyslm rmu o t4artnmfcty1omD aues (0 rurxmpoo1lptemfesl(  rua( pnu0tpt micilt a eanmpnu)alxnxr tadfat lnvolt0t2tmio oy1open ivtatfsDrmu ooo0apeomfctysfaDel(mp u4altnif3ia1oa rlnvo;s0t2trxo3iydal emfes ( sDuaxrp;o1ope  fctlsfm2emums u4tltoio3iydomteai ilt  2xoio io1op  lneslt)a2ta( o;o1oeeomi3ilsla2ran s u0alenxrciy1fptrluei;s t2uoio3iu4am   feslt)a2uru ont0oeenii3iys a um(vsnt4artnmo3totoaDr i sls s2um(mpiy1omen fctas) 2ua( pnu1oexnmoeiat s2emu o t) lenxf3oa1fpD lnei ()srxm(m iu1apee ieslt srtaumpno0oeto feiadfsDrauvo t0 rtoif3io1opte uei s0 rurxrpnydlle mieilsf 2rrxroou4oexoiiciytls2emu p u4 rtrio3ootoaDeaueslt0srtmxopiudameemfcils sDurxmpnu1tetnmictlt a2eauvon(0teermr3iotop eanvi t)t2umxmpno4olte fei s srraumpoo1aet mietydlmDrlu ont) ltnmoctytlpDr nes;t)srurxm io1olenlfvt s aDrrxmp;u1aexo o3tld mDeanmp;u)tlxoxo3todfm e u s;( srtoim3io4lmt lfei s)a2umuroot0aleoii3iyt s elums u0 ltomr tytom  an slt)setriopiu4omenmnct ()a2tmump;u1oee  ocildls2rmnms (0texoxocoy1fm   u i;t)t2xm(o3iu1lmeemnvilsfaDuru  ;u0apxomoetasls2ua(mp;(0 etomf tadfpt  nes;()s2tmim3nudape  icsat a2trxront4texomfciydfa2rmums t0 rxnxrcoo1optranvi;t0seur(o oy4amtn fctl(fsrtmumpot1tpen oetydla emnmp;t)altomf oatfaDeln sls srumxopno1om  licslt sDrmump;u1opt  i3iasfmDem(vonu)aetrif oodoa  lieo t0trtoxo oo4lm n ncsl( artruroou1oeeoioeilsfa emu p;u4aetnmr tytom   n s;t) rurir iu1aptelfciat  rrruront0aeto oetldfm2rlumo (4teermfcoodlpt  neslt  etoirpiu1ap e iei s sruau p;u1apt mfctyd a eanvp (0aeermo oy1op  lnvsl( seum(mpnydom   ivi () ruaur ;o1tpen oeild a2uauvon(0tlenif3tydfa e u s t seurxr iydapeemfetls  rumum ;t1oltnifeildlm2ran p u4tleomrciytfm eanvsl(0 2uo(r3nu4lmenlfei s)srumurp;o4alxnmictld m2uaumsnt)altomrcoo1fmD livi (0srxr(opiodalenlivs (fs2umuront1optniieiytls2ea(msn(4 eenmr3ta1lm raueo s trto(opoo1amtnlivtls s2taxro;o4tetnii3iadlm2um(vs;u)alxrxr3oydomDrliei (0 rxr(rpnydaptemnctas) 2tr(rpnu4apx iociadlaDum(vp ()tlxrio3iatfptr ieslt0sexm(m3oy1olenlnetl( a2umxro;t4aex ii3tysls2elu o (0tetnio3to1fpDe uvs ()trto(o no4aptemncsls)a2um(rooo1opx  oeild a2umumo u0 reoxf3ia1fpDeai o s0 2xmxr oo1al nmncta(fsruau  ot1oet  f3iyslm um(mo t4 rxnif3iy1la eauvo ( teum(rpoydlltelici ( srtru  oo1aexoiiciyt s umumo (4 eerxo io1lpDe ivi t0s2toim iy1op e neta() rrm(mo;t4altomieiydfmDranms;u0 eeomfcoadlmt  u ils) eto(r io4amtemivt tfartaumonu4aeto i3iydlm2em(vpnu0artrif oodla  auvs;s)texmimpnudll n nvilt a2uaxrpot1oetn oetydfm elnvsnu0tlxrif3iatlpteanes t)setoxo3oy4lme mnvils)srrm(  ;o4tltn oetltfmDel(vp u4 reomf3oy1fp eauei;s t2umim3io1opt liesls s2rax ooo0tpxnmicilslm ra(ms;t) eermfcoadfpt anvilt0setrxr3nudoltelicsas)arumum no0tex if3iad m2eau s u4 renmo3iydlmDelivo t srtrir3iu1omtn fcslsf 2trurp;u1tlt micilt s2elnvsnu4tlermo iotoa  lneo;s0 2xr(mpoydapee fesl(f 2tr(mp;t1oltn ieildls eanmo (0trxoxo3oy1lmDr i ilt  etmxo ny4lptelfci s  2um( p;o0aet  i3iyt m emu s u) lermr3oatomDeai i;(  etoimpio1oleemictlt)a2ta(m ou0opxoii3tldfm eanmo;t4aetrxfctatfmteaivo;s0 2ur(r3ny4ale  ncslt aDraxmpoo1oee mfciltfa2ua(vs;u)teenxfcoy1fmDraues;()srxrio3iodal  lnei t)srrrxmpot0tpxnii3tlsfs2eanmonu4tleoxoctadlmDrlieo;(0s2umxm3nu4al   nctat srrm(r nt1texnmo3tls a2em(vs;t)alxnifciytfatr ivils texmirpoy4ap emfes t arur(mpoo4olxo f3tytfs2ra( s;t4 rtrxocoodfaDrauvslt0 eumimpiy4ome licta( sDtm(rp;t1alxomiciasfsDuan s;(4trtrif3tydom rlivo ()teumxrpoo1ll emfvs tfsDrax  ot4tptnmoctatfsDra(vo;t4alerxo3iy1fatrlnvo (0 2urirpnodlm e net s) 2rrum oo0teeo f3iydfm rl( o;(0aetrxr oo1lpDe neols s2umxo nu1amtemnct tf 2rr(  oo0tpeo iciydlmDeluvp u) rtnmf ootlmDraivi;(0trxr(r io4lmeelivt ()srraurooo1oet miciydlmDulumon(4 rtrmf3iatlpteliei t t2tm(mpnu1apenlivtl( artm(r ot0olt  oeilsfm ranmp u)alermrctotlpDraneol(0srxmio oydomtelneil(f ruaxmooo4apt if3ildla2ea(vonu0tltnxr oytomte u olt setoiopiodamte fcta(f 2ta(  nt1aee mfeiltfa uluvs;(4 lxrxrciodlm r u i t0texmxopoodlp  mfeta(f rraumpnu4olxoii3iatfsDumuvsnu) rtoxocoytoat lu s t srxr(o no4amen nvsltfarrmumont0olx  ociltfmDuaumo;(0texnif3todfaDeai i;t0trtmxo oydal n fesa() Draxm nt1altn ietlsfs emnmsnt0 rxnir ootfm rlivo;t0s2uoxr3oo1altnlfvs t) 2rru p;t1teto fciys s ranvp;(4 etnmf3iatfmt ln slt t2xr(m nodope miviasfarrmur no4tetnifcilsfmDrauvs;u) exomr oydfmDrlivslt t2xmxmpoudlptnmies t s2trx o;o0alxoiietatlm2umn s t4tlermf ty1fm   nvi;s0seur(m iodaleelfct () Dtru onu1tleomictldlm2rm(vpnu0 ltnmf tytfpDe n s t)srumiopoo1opeemnvi sfaDraxrp;o1texnmfciadlmDumumo;t4tlxomo todfpDrlivolt s2toim3nudlp elietat)s2rr(rp;o0oex mi3tls m2eauvpn(0tetriocoatla
\ No newline at end of file
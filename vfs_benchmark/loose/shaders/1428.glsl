@@ -0,0 +1 @@
+ieol()t2tmir3oydll  mneia(farumx o;o4oee ioetldls2uluvpn(4 etoif3to1fp raivs;s trtrim ny1lpe mfcils) 2uau  oo0aexnifeiltlm el( s t0tltrir iadla e ies;s) rumimpoo4ome  feia( aDrau  ot0olx miciyd a umu snu0tlxnmocoadlptrlnvs;(0 2toirpou1ap  livsat)srurumooo0oet ioeildlmDeaump (0trxrif iodfat auvsl()s2xr(o iy4apen ncs sf 2rru ooo1olx  o3iatfs2rm( p;u)aexrxf3io1op ean i;s0srtmir io4altnlicil( s2urxmo;u4tee micilt a2ea(mo t0tetrxfcoo1laD ai i;(0t2urirpiu4llen ivs t)aDrrumooo1oeeoifeilt s2rau s;u)texoir3ty1fa rauvs;s)sexm(rpiudaltnlnei s  rra( o;t0tleomfciatfs2rau pnt)aexomf3ta1lptelu ils)trtr(r nu4om emfct t  2tmur ;o0aetnif3iad s el( s;(0aeeoif3iatomDeaneolt0 2xm(m iu4lmeelfvs s) 2rrumoot0tltnif3ils aDrmn snt4tleoif3ty1oat anvi s)setrim ou4amee nvsas)aDtmu pnt0opeoif3iysls2ea( o;t) rxriocoatoaDeanvo;s) 2urim oo4ap nmivsas)aDtmxmoot0alx ioeildla raumpnt0 ltrir3tadoaDrluei;t0trxrxrpnu1op nmfcia( a2raxr ;u1oet iictlsfa2rl(vont) etomo oadfmDeaivo;t  rtrxr nu4llt mfvi t  2rax  nu0apxoifeildfm2ea(mpnu4 rtrxf3tytoaDelneo;s tetm(mpnu1ap  lnet ( srrm(m ou0tlx  ociadls2rauvon(4 rerxrciydopt luvs;s setr(opiodoltn iei s aDrmu ont1tpxnii3tasfa rln pn(4 exrxfcoy1fat lieo () 2xoxr oy4lptemfcsa( aDra(mo;o4tleo i3ias s2ul(msn()trtoio3oodlmDe ieo ( t2tmxrpoy4aptnlfeias)aruaxmo;u4oleomo3tld sDrmnvpnt)aeenmo3oydfpDraivi s s2xrxo ou4ll  lfci tf rtaump;t0olxo oeiatlm rlu pnu0aexnmr ia1fmDr ivs (0 ruo(m3oy4aptnlnciatfaDtau pnt0tee if3ilsfsDra( pn(0tltoxr3todlp  aues;s0 rxo(m3oudaptnmivt ( s2rrurooo1aex  o3ils aDrluvpnu4 eenmf3ia1lp   u olt0srurio3iudlmtn ieta(  rumxroot0optoif3tltfs2ra(vp;u4 eenifciodlatrauvilt0 rtoxo3iudom emiesatfaDumxmpno4tet io3iydlm2rmumo;()arxnmr3totfmtrli s (0 eum(o oy4ome lfct t  Drmu o;u4tpt mi3iyd aDraumon(0aeerxr oodlm e u s;t0seuoim3oydalt mnvtlt)s2uax  no4tpxo fciyt a2rmn p u)alerxo todlptr u s s)tetoio3oo1omtn fvs s)a2tm( pnt4opx ifeiasfsDemnvpnu4 exnxf3ty1laDe nvslt  etmxr3oy1oleemfeias)srrrurp;t1olxomf3tasfmDuluvs (4aetnir iodomtrli o;t) eto(rpoudap nlfei ( srta( pot1ale  ietldfa ulu s;t0 lxomrcoydomD auei;s0t2xo(opiu1opt mivia(fsrur(r ot4alxnmo3tldfs ran ont0trxrmr oo1om   ivo t0teuoirpoy1ol e feilsfarumu  nu4tpen i3iydlsDea( s (0 exnmo3iy1la elieo (  2xrxrpnu4openmneiat) rurxronu0apenif3ias mDemn s (0 lerir3oydfa eauvi s0srtrimpoudlleelnvils) Dra(  nt0oleomoeilt s uau p t4aexomr oo1op  livo;t trtrio3iy4lp nmfctl() 2tmxront4oeeo fciaslaDra(vo u)alxomf3iadla eauvs;(0sexr(r ny1olen nesat) 2raxrp;t1tpxoioeiyt sDuaumo t4arermo3iodlmDran o s)srxo(m3iodlmeemfciat)artr(mooo4alto fctldfaDeau p;(0trenmo3oy1lmD  i i;() etmio nudlp elies s)arrrur nu0teeo oeiadlm2ul( p;u0aetoifcty1lp e uvi;(0 2um(o3nodomtelici sfa2uaump;u1oltoiicilslsDuauvp (0trtomr tatoaD  i ols)srumirpiu1lpe  ici tfaDrm(rpoo1aee  iciatlm ranms;(4 lxnxocoatfmteln i t0srto(opnodolte fcs t  Drmxr ou0tlx ioeiadlm ra( ont0tlxrir tatoa eai ols  2tr(mpnu4ol emnes s  rtaxrpou4tpenii3tltlaDeanmpnu0arxnmf3oodom e n o t)s2ur(m3iudol emnet t sDua(r ou1oetn o3tysfa2uaumo (0tlerxr iydlmte uvslt  rxmio3iu1lptelfvslt)aDrrur nt1tpxnio3tldfmDrlu o t0altomfctodla e nei;t trumiopiudom emneiltfsDtaxmont4tetoioeiyt m2ul(vp;(4trxrxo3oodlm e u s t truo(m3nudlm e nes tf Drr(rpnu4tptnmo3iatfs em(mp ()aexomf3iydfp raieo;s0s2xm(mpoy4optn ivi s s2tm( o;u4olx mo3ildlm rauvp;(0alxrmfcoatoaDraivilt s2uoio3oo4amenmfct tfs2umxro;o0tet  o3ildla2um( s;u0aeeomrcoadlate nei;() exmxo3nodlp   ncsl( aruax poo1tpt if3tas sDul(mpn() renio3oydfmtrai i;( t2tmxrpiy1altemnviat)aDtmu poo1tle iiciytfaDel( s;u)altomociatfpteluvs;t) rxmxo3oy4optnmfctlt a2umx  oo0aexoii3tadla ua(mp;u)alerif totfat aivol(0 rurxopio4amtemfeia(fsDrr(rpnt4olxnmociytlmDrmnmp;t0 rtnxrctotfa e nvs;t0tetrim3no4am  mneiatfsDuaur ;o4olxoioetysfsDelump () rxrmr3oy1faDelies s)tetrxr3oudlpt  icias) rtrx ooo4alx mfciatlmDrl(vpnt)treoxf3ta1fa e nvsl( tetmimpoo1apee fvslt sruru  ou0aetomfctydlm ua(mo;u0 etomocoytfpt auei t)srum(r3iodaptnmfvilsfarrr(m nt4aleoii3iyslm2emnvs;() lxnmo3oytoaDr ieo;s  2uo(r ou4amt liet s) Drmx  ot4tetn ieiydfa rmumpnt4altrio3iydom ranei t0s2xoxm3oodomtemfeil()s2rr( oot0aet iiciatfaDrmuvo;() exomr iodop  anvs;()texr(m3oy4ope mnvta( sDur(rpot0tle mf3iltfaDum(vp;(0alermf3iatoaDelneo (0 2xr(r oo1lpee fvsas)s2ta( pnt1aexnmo3ildfsDrl( o u4artoifcta1la  lneo;t setr(rpiudomt mietl(f rtaurp;o0tlen ieiaslmDranvont)tlenmf oatoate ivsls)sexr(m iy4llen nviasfs2raxr oo4oeen fciad sDuluvo;t4tetrifctotom ranesl(0sexrio3nudam  lneia()srrmxrono1olt  f3tlt a2ua(mp u)altrxocoydfmteaies;t t2xrio3oydamtnmiciat s2rm(  nu1teenioeils m2raums t)aetrmoctadlptrlu olt0 euo(m3nu4lpte fvslsfa2um(rp;t0openmoeiydls uanmo t0aeenmf iydoa e uvols)trtrxm3ny4omtnmncilt) 2tr( p;o4tpt  o3iyd m2uln o;u0 ltrmf oy1fp rluvs;(  eurxr3iodol   fet (  Dtmxm ot0alenifciytls2eaump;(0artnxo iatlm  li s ( srumxrpnu4apee nvt s) Durxm ot1alto fctas a uln ont)teenxfcty1fp  aivs ()trtmxr iu4lm emnet t) rrmu  ot4tlxn f3iadfa elu on(4 lxrifcoodfpD aieo;s  rumim3nu1omenmicsl(faDururo;u4ale  o3tatfs umnmp u4tetnmf ia1fpD aivsls trtoxo3oo1apeemfesat) Dta(moot1tle mo3ildfs rlu p u)aetnir3ia1faDeli i (0 rtm(o no1optn fesls  Dtaxr ot1ole iicildfm uln p;t0artnircoy1lmt ai i;s) 2urio3iu4omtnliet s s2trxr nt4oetnii3iltlmDua(vont4 exnmfciotlmD  ivs;t) rxrxo oo4ap elivtltfartaump;t0opx io3iadfs um(mo u)artrir3iatomt livo;t0 eumirpiu1omt  ieiat  Drau  ;t0opt iietatls2umnms u4trxnif ootfa r nei;() eurxo3ny4altnmieil(farurum no1apxn fctysfsDumnmp;t0 renxo3ia1fmt ai i s0 2umxo3oy1alenlfcias  rumx pot4tetn ocilsfm2ra( snt4treoxfcio1fpt anvo t) ruoirpoy1ome lfcs tfa2urx o;t0tle  oeias aDuau p u)trtnxr3oy1lpt aues;s s2uo(opiodll e ivia() 2tmu o;u0alt ioeiyd a rau o t4arenirciytomtrauei ( t2toiopiu1aptelivt tf rurx oot4oexo fctldlm2ranms;u) ltniociotopt li s s0sexm(m3nydol nmfcilsfaDtmxmoot0alx iiciyslmDranmp u0arenio3iotlmt  u o t0 rumiopoudape mfci (fs2rrur oo4openmfeiys sDua(vo;t0 renif3to1fat au o;s) etmirpny4ame  ici s) rraump;u1aleomietlt s umnmon(4 rxoir3tytomDr n o;s) euoxm3ou4amtemics tfsDuau o;u4tltn ieils m2rauvs;t) eermoctatfmtean olt)tetr(mpnydolt livtltf rrm( pno4oetnmfciatfm2elums;t)teeoxr ia1op   ueo (0trxr(rpny4omeemnvt ( aDra(root4apeomi3iadfm2elums t4 lxnxr ia1lmDrliei t0sexmxr3no4omenlnvs sfaDua(m ;u4opxo o3taslaDean p t4arerif3tytlm elueo;t  rtm(rpou1olt lietl(  Drmx pno0open feiasls raumo;t4 rtrxf3iydlm eaieo;() rxoxo3oo1ope mnvi sfa2um( pno1ape mfctys m2uluvp t0 exnmo ty1oaDrlivolt) exrio3iudllenliesasf ruru  ot0ole moctydfa2rluvsnt4tetnif3oytlp e uvo;s)s2xo(opoo1lmte ivsas) rraxmpnu4alxn feiasla em(vs ()alermo iy1fmDelu i;t0tetmxopoo1aleemfcia( aDrax  oo1ale iiciydfs el(msnu4altnxfcoo1lpt  i ols0s2xrim3iu4omeelivtlt artmxrp;o4texn octadfmDrl(vpnt0teeomf to1faDr uvi t)s2ur(mpny4lpeemfeia(f 2tmxmpou4tetomf3iytfm2emumpn(4alxrifciadlpt  ieo;t  etoio3nu1lm  mivtl( sDta( pou4olxomo3iysfm2em(ms;(4altrmrcoydlpDrauvi;(  exo(o3ou4lp elici (  rrr(  ou0tpxoii3iys aDrmnvp (4tlermo tydom r n o s sexrxm nu1lm   ivi t  rtm(m ;u1oex  ociydlaDrln snt) rtnif3io1op   uvsl( s2xrirpoudlltn ivtat  ruaxrp;t0tpe  fetltfs ea(ms;t0teeomo3oatopDr ueslt0sexmxm oodameelfvt (f 2taumo;u1aleoio3iad m2eluvs;t)alxomociy1late n i;s0teur(mpoy4lp  mfviatf ruaxmono0tex if3ild m2uanvonu4 exrio3iatlatr n o t srur(opnu4opee ici t sDtr(mp;u1altoiieiydlsDrmn o;u0 rxrmfciy1op elu o;(0s2um(r3nydal  mnvt ( a2umu ono1ape mietatlaDemnmon()tltoxf oo1fm rli o t0t2tm(r iodol   nci s)sDumumono4tlxoifctlslm eln o u4 rtrif io1lmte uvsls0 etoxo3ny4optn fcs t a2uax poo1alx iiciysfmDulumon() eenio3to1opt  u o;t tetr(m3nu4lp nmnvi (fa2urxroot4apxnmfciydfa emuvs t) rxomr3to1oateluvilt  2tm(r iudal   iesls)s2um(r ou1olenmietad a2uanmpnu0treomr tadomDrai o t) 2trirpoo1alt lfetltfarraxm ;o0oexoio3iatfs em(mont0arxrxr oydoatr i i t0s2urirpoy1open iet s aDta(mp;t4ope iociltfmDumn o;(4aleoxf oo1fp e i s;t)s2xmxm3oydope liei (  rrru  nt4tle iociasfs2eaumo u4alxrir oo1laDelies s  2trir nudal elfcs () rra(  ;t0apen ietltla umnmo ()tetnir oytoaD  u s;()tetrimpiy1lltn ivs s)sDraurpnt0alxn o3tys m2eln s;t)altomo tatlmtrai i t)t2xoxm3ny4ameemieta()a2tm(mo;o4oetnio3tyt aDumu p;(4tetomo3ty1lmt  n o;s)t2tm(o ou4op  lncilsf Dtaxr ;t0ole  o3tatfa2um( o u)alxnxocoy1lp  lnesl() etoirpoo1ale mieils artr( ooo4olt ii3iyd a2um(mo;t)tltrif iydlmDr neil(  2toxo oodlp elnvsat)aDrmxroot0tpe mf3iaslsDuauvpn(0alxrifcty1la r i i;s t2ur(o3nu1lptn ncsatfaDururoou1tet ii3iydfm elnms t0tetoxfcty1fa  an i t t2uoxopiu1lpe lnvias arraurpou1oee mf3tadfm2rmuvs;t)arenio iodlmDe uvsl(0 2toxo3oo4llee icia(faDurxro;o0oexo o3tysfm rmnmsnu)tlxnmo iotopte ues;t0trurxo3iu1lptnmfetl(faDua(m oo4altomiciys s ean s () eenmrcta1fpteau olt0srtm(rpoudlm e nvs s  Dur(r nu1tpx mfeias sDemums;()aleoxo oatomDeanvi s  2triopiudomen iviat)sDuaumpot4apenmiciltls2ua( s;(4tleoxf oo1opD au il()t2xmxr3nydamtelfvtl()artrurp;t1tlx  fcias a2ua(vo u) ltrxf3oodoaDe u ols0 2tmxo3nu4am   ivs sfaDumxmoou0aeenmiciasla2emnvp;(0texrif io1lmD lnvolt0srxrim oodaltemivtlt sruaxro;u4oee  o3iyd a el(mo t) rtrmo tytfaDr ivils  2umxr oo1om elnvt () rtr( pou4oexo fciadls rlu p;(4altrir3tatlaDelnvo;t trtmxm3iydlmt lies s srrau  ot0opto o3iltfaDuan snu4aexnxo3oydom   n o t texo(mpiodlptelnci s srtm(m oo0oetomoeiadfa rmuvo;t)texomr oadfpt aivs ( seumxo3iy1ape mivil()s2ur( onu0aeeo octlsfaDuan p;u0artnif oo1fa ean i s s2xoio3ou4amt  ncs t  2urur ;t0apxomocias aDrmu snt4aeenif ia1fp rluvs;(  2ur(rpou1openmfvtlt s2rru  oo4tpe  ociltfmDrl(mo;t0arxnmrciadlmt auvil()s2tmim3nydlme mnvtatfarrrump;t1tle  ieildlaDulums (0treoir oo1oaDe ivi ( seumxm3ou1lmt mneta( srtmx pnt1tlxnmfeiyslsDrlnvsnu)aetnif ootop   uvo;t texmxr3oudlptnmnctatfs2uaxmp;o0oeeniiciad sDean on(0tleriocoa1lp elueilt0trtmxo3iy4al emnvtls) Durxro;t0tee iiciat aDra(ms;(0aeeniociotfatran ils  rxmio3nydamee icsltfsDtrurono0aeenmfctas sDea( pnt0 rxnmocia1oatr neils0s2toxr3iudape mnctas) Dta(  nu1teto feiyt a2emu s;(4 rxrxr3tadlpteln sl()t2to(opny4lltnlfvslt)a2rrx  oo4alxnmi3ildfm umn s (0trxnxo ootlatr nvo s0srtmxmpoy1ap e iesl( s2umxr ;u4olto f3iyt a2em(msnt)alenmfciadlaDr i o;(0srto(o iodaleelnesas sDrmxm no0oeeomi3tydfa2rm( o u0 rerio iotfp   nvsls0s2tmir3iu4ap  mfeias srrax onu0tlxnmoeiysfaDranmonu4aexnxr oadfmDelieo t0teuoim3nudlpt  fctl()sDum(rpot1ole mfctat a uauvonu0 lxrxr oy1fatr uesls s2trirpnodlmee ivt sfsDtaxmpoo1apen ictas m ulnvo;u4tlerirciy1fp ran i s) rxm(r no4lm emfvsat)aDuax  ;u4apeo fcias s2rm(mon()altomo oydopDrlivi ( sexrxo oodomee fcsat sDtrxr nt1opt  i3tadfsDem(mo ()trtrxr oytlm ranvi;s teto(m3nydamtemncsa( s2umxronu4alen oetyd m2umumo t) rerxf3iydfaD livslt)s2uo(mpiu4oleemfciltfaDumumo;t1altnioeiatfsDeanmp (4tltrxf iotlatr iei t srxmxm3iydoptelnviasfaDuax  no4tptn feiytfmDul( p (0artnmociotoateauvols  etmxrpou4lptelivtlsfsDtrxm oo0aetoifciasfmDua(vo u4trxrxo3iy1om rau i;s)s2trir3iydllenlics ()a2taxroou0oleo icils m2ulumon(0 lxomf3iydfm r nvs t) exrimpou1ap  mfcsl( s2rrx pnu1apt iiciasla2rauvp u0areoio iy1laD ai o (  rtrio3nydame lfct tfaDrmur ;u4olt mfciyd m2uauvp (4teenio totlpt anvi s0setr(opio4op emfvs sfsrumumono4oexoioeildla rl(monu0artoxo iy1om   i i t  eto(r iu1amtemivils  2tm(rpnt1tpe  oeiydfs2ulu pnu4alxniocta1omDeai s;s tetrxr no4al n ictls)a2rru poo0opxnmietatfs rm(mpn()trxrio ootfa r n sls trtrxo ou4al   nvt (faDtr(moot0oex mietytfmDulu snu)altrmfctatlp   nvi ()sexmxm3oy4lmtelnvs s  2ta(  ;t1apx  o3ildfs2el(vs;(0aetomo3tytfm rauvo s) 2toxr3io4amtnmivt ()s2ua(roou4ale  f3tyt aDem( o;u4tetrxf tatoa   i i;t) euoir3ny1apee fviat) 2umu  no1tlxnio3iydfmDea( o () lerxr3ootomtrluvi;(  exm(mpiy4omtnmicta( sDrr(m no4tex  iciat s emnvs;()alxrxr tytlat aneols)srxrxmpiy1lm nmietas) 2tr(  no4olt io3iysfa2rm(vpnt4alxnmr3iytoat lneo s s2xrxm ny1oltemfetas sDrm( o;o4texoiocilt mDra(msnt) leoifciytfm rlueslt0srto(mpoodaptemieia(  rurxr ot1ape  oeild aDrmnms;u)alenifcty1oatean olt  2uoimpiy1lpen fvs s sDuau  no0tpxo ociadfa rlu s;t)tetniocoodop  lu sls)teuoir iodom n netl()aDumxm ;u0apt mi3ias mDum( on()aleoxr oadom e i o;( trum(r oo4amtemfcsls a2uau p;t0aex io3tltlaDrl( s;u)tlxnif3oo1fa  li o;(0t2tm(o iy1ameelieil( aDtm( o;o4ale  oeiysfaDrl(mon(0tlxrmr3iydoatrlu o t t2xrim oudole lneils)srra(rpot1oeto iciad a ranvp u0trxoif ty1laD aieo ( setrxo3no1ole  fcsat  2rru  nu4olenmfciyslm uauvsn(0tleoif3oodfp r i o t0 eurxr iodam n nes (  Duru  ou0opxn oeiys mDrmu o ()artrmo oatoptr i i;t texrim3ou4lmt  fetl( aDuaur ou4aetnmietlslsDrlnvo t) lxrif tadla r nes;(0 etoirpnu1alenmfeiat)aDrm(r nu0olenioetytlaDum( pn(0altrmfcoa1opt lieo t0 rtr(m no1apt  ieia()srurxroot0alt ifciadfm2eauvp;()tlxoio3oytfmD aneils0 2xoxo3oo4lmee fvt ( srum( pnt1opt io3tysls raumo;u) eeomo3oo1lpDr nvo t) rtoir3iydalee fvt t aDrrx  nt0alto o3tat s elnvo;()arerif3to1oaD  ueolt)trtoxr ny1llt  fet t) 2rr(  ;t4tptniociltfs2ean on()artoir3ootlpteaueo;t0 exoxrpoydomee fvs s arumxmp;u0tltn ieils a uau pn(4aeerifcoadomDr u o;s)tetoxmpoy4optnlieiltf 2ra(rp;t0tltoiociaslmDua( pnt0 rerio3tadlp eliei t)s2um(rpio4ll  livtatfartr( p;t4oltoio3ilt m2emuvsn(0aetnmfctotfpt luvo;(0 exoxr oudlpen nvs sf 2um(moot1apxo i3iaslaDrauvo;u4aeerxoctydlpD lu o;s trum(r3oydamt  neiltfa2um(rp;t0aee iietyd sDelu o;u0alerif3ootlpteau sls0t2urio3oudll elnetasf rtrxr ot1olx iietltlsDem(ms;(4trtrmfcto1omteln s ()seurxm3oudlp emivils  Durum ot4oeto i3tasfs2uanms;t0aexrmo tydopD  i ols) 2urio3no1optnlicsa() Dururonu4opxn oeiytfs2uanvp;() lenxrciodlm ean il( teumiopiudoltemfvs (fsrum(rp;u1tptnii3iys m uan o () lxoxfcia1omteaneo;t) 2tr(r oo4al elnvsas) Dtmu o;u4tleomf3tld s2eln o t0aeenircta1fa eluvi;(0 eur(o ny1lmtnlivslt)aDtrump;u0tlx io3iysfaDemn p () reomfctydlpDe nvsls s2trxm iy1al nmici t sDumxroou0ole  i3iadfaDum(vs t0tlerir3iodlat ai i;s) exmirpiy4lleelfvt t)sDtr(r ot4ale mf3ilslmDrmumont0altnirciodoatrai slt0teuoio3oodam   nvtls a2uaxr no4aptomoeiadfm2rlnmo;t)teenif to1oatelivi;t)s2tm(o nodlmt mivtlt) rtrx oot1ape moeiydls2ua(ms;() reoiociodlmDelieils seum(o ou4aptnmnvtl(  Dur(rpno4tpe mfeiytla2umuvp (0alxnxfciadfpDelivo (0seumio iy1om emfcilsf rua(root4olxo oetatfaDrmump;t) lxoio oo1oaDeluvs s truo(o nudol nlieia(  rrr(r ;t1alt if3iyd sDua( p t)areoxfctodla  anvi;s trumxm3nudlpt  ivi t srrmxmonu4ope iietysfa2el( snt0trtrif3iy1oat  ivs t) etm(m3iudoptnlivsasf rua(m no0texomfeildlaDulumo t)aeenxocio1fp rauei;(0texriopou4alte nvsls) Drm(rpno1tleomo3iad m rlump u0 etnxr iatlmDeaivi t setm(m iudlpenlicta() rurxmont4tlenmfetadfaDemnmon(4arenio3oa1fat au i;t0teuo(opoo1apen fcsa(  Dtm( ono1apxo o3iaslmDeauvsnu0aexnmocootlpD an sls t2urir3nodomenmnetlsf Duax  nt1tle  feiytfm uanvpnu4tleoio3tytfaD  ies s0s2xoxo oudom nmfcsls a2ur(rpot1alxo octydfm rlump;(0arxrmr3ty1fm   ies s)sexoio iy4amtnmfet t)sDum(ront0tetnmieiat s uln p (0 rtnxfctatfm r n ilt0trurimpiu1lp  lfvtasf rtax  ou0oeenmf3ilt aDuanvo u)teenio3tadoptraivo t0 rurxr nudlpt lnvs t) Dtm(rpnt1altn octydfm umumsn(0trxomoctotfaDeau ols0srtm(mpno1llee fvtatf rur(mpno0ape ii3tlslsDrm(vonu) ltoxo iytomteau s;t  euoiopnudlm   fvil( arrm(rpnu0tlto f3ild mDrluvo t0 etnmf3tadfmD  ies;t0sexrxo oy1ape lncs sf rtrxm ;t1tpe ifetlsla2rmu pn(4tlerir oo1oatrln s s  rxoxm oy4lmtnlnci (f rta( pot0aptnif3iasfm2rlu s u0 exoir iotlp  lnes () rumxmpnydlp elncsas)s2um( p;o1oltnmoeiyt aDelu pn(0tlxoif3to1lpt  iei t)sruo(o ou4lptelnvtltfsrrr(rp;o0apen fetytfa rauvo;u4alxriociy1faD lnei (0 2tm(o ny1lm n nes ()a2tr(mooo0opeomo3tasfs2rmnmo;u4 lxrifciytoa raivo;s0 2xrio3iydolt lfes sf 2rrx pnu0tet  ociydla uan on()trtnmf todlaDrlnvs;s0seum(o iy4lmenmnvta()aDum(r ot4olxn iciat a emums;u0 lxniociytoaD  n slt0seurim oy4lpt  nesls  Drrxm ;o4ale  f3ilsls2emums;()tlerxfctodfpDeauei;t0 2to(m3oy4amt lnvs t) rtr( pnu0tltomiciydlaDean p;t) lxnir iy1opDr i sl()sexrxr3iy1op   fetl()aDum(rooo1tltnifeiatlsDraums;(0 rtnxfcoatomtranei;t)t2xoio ny1ape  fcs t  Drm(  ot0tpe ifciad sDrauvonu)alerif3io1fa  ai o;t0t2xmxo3iy4omtnmfeil(fa2tr(  ;t1apeo o3tyd m rmnvo t)treomf iydfpDr n sls0texr(mpoydlm emnci tf Dumu ooo0optniictyt sDrm( s u) exomf tatlpDrai olt0trumxmpio1lmenlnesl()srtau  nu0olxoio3tldlsDeau p u)tlxnxf ia1op eanes t  exmxmpny4lm  mfvilt)arumum ou0aetoio3tad aDra( o;t)texnxocty1oa rai olt srto(m3oydomeemictlt  Dta(r nt1olxoioetatfa2umn s;()tlxnxr3totopDeau il(0s2umir nu1ol elfvtat s2rmxr ;o0tlenmfeils m2eln pnu0 exnmo3iydomD lu slt teumxr nu1opt  fvtat) rum(rpnt4oeen fetys m2eaumpnu4 rxoxo3to1lmtraneil( s2trxrpoodlpee nvs t artrxmo;u4olt mf3tadla2eanmpn(4tltoirciy1lpt aivils) 2umio3nydlpte ivias aDtax o;t1olt io3tat m ea( p u)altrmr3oatfa rln i;()tetmxo iu4lmt mnesl( aDuru poo0teeo fciysfaDuan p (4trtomr iadomtr ivi;t0 2xmir3iy1omeelieia(fsDuaxr nu0alxnmieiatla emuvon()aeermo tydla rln i;(0tetoir3oy1lmeelfcs s) 2umumpnu0ole  feiatfaDumn onu0trtrir tadopD  uvo t)t2uoxm3nydapt mnet (fa2urum nu0tlxo fcils sDrmu o t)texrmrciotfateli ils0 rum(rpny4lpe mnvtltfs2ua(moou0oetoioctltfaDelums;u) rerxrcta1omD lnvo s  2triopnydlmt mnctasf 2tmxr nu1apeomf3iasfa2emuvo;t4 exnxfcio1om  liei;t)sruoxm oo1lmtelfvt (farrrur ;t0optnifcilsfmDrmnms;u0 etoir iytfaDrlueols)srxo(r3ou4lptnmnvslt sDraurono4aex  ieias s eauvpnu4artrio3iadfat  nei s truoiopiu4oleemies tf Drr(  ;t0aptnifcild aDrm( p u4tetnif3oadoaDelues;s s2xr(o ny4om nmictasf Dra( ont4tpxnioeiyslm2elums;u0artnmf tatla raieolt)teuoxm3oy1llen fvsl(f 2urxr ot1apeo fetysfaDranvpn(4alenmoctydoptrluvsl(0t2xoxo iodamtnliviasfa2rmu pno4tetomictydla em( s (0 exrxf3iy1oa eauvo ( srxoxo oo1lmt mncsltf 2umu ooo1apxnif3ias mDrm(ms ()aleoxo oy1omD aivils  eum(rpoo4ll nmfct t)sDtrx  ou1tlxnioeilt s2umnvo;t0 etnmf3oy1op ran o s teurxopoodlmen nct s) 2raumoot4ole  fciad a elnvp u0 lxrxr to1oateaivs s0s2tm(r ou4ameemnctltfaDtaur ou0tex moeiltfs ulu o;u0arxomo3oo1omt lueilt) 2xrim3io4ap emfeiat)srrmx p;u4tpxoif3iadfa2em(vonu)alxoio3oodopDr nei (0 eurimpiudamtemfcslsf 2taum ot1aexnmi3iat a2umn o;u0 etnmo iydlp   nvs ( s2urimpiy1amt
\ No newline at end of file
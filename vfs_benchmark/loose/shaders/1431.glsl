@@ -0,0 +1 @@
+uvi s0srtmxr no1am emfcsltf rumxr ;t1opxoii3tys m rl( snu0trenmrcoo1oateauei;s0 exmim3nudaleelnvtl() 2ta( p;t0texoiietys s2eauvo ()tlxomr oydomtrlnvsl() 2urxo ou4ape licsl( a2tr(ront0tpx  o3iysfs emums;t0tlxnmoctydom rlnvo ( srtm(m iy4altelnvtls)aruaxmoot0open ociatfm elnvs u4 rtnxr oatfp   uvi ( sexo(m3nodlmt mncsa() 2uax p;o4apx  f3tysla2rl( p t0arxomocio1lmDrlnvo s tetoxopiy1omtnlfvtatfa2trurpnt1alenio3iatfsDum(vsnu4 rxoirciotlmteli o;(0t2xmir iu1opte fctl() 2rau pnt1tex mo3iyslsDumnvo (0tltrir oy1op e ueo (  ruoio io4ap nmivsls  Dra(rp;t0oeeoio3tlsfm elumonu0aetrmfcty1fa eluvils0 rxrxo nudomeemncil( srrm(rp;t1opxomf3tas sDeluvsnu4alxnircoadlpteau sls0s2xrimpnodllee ietl(fa2tmur no0apenmi3iyd s ra(vpnu4 rtnmo oadopDelnvs;( s2toirpno1am   feil()a2tru o;t0apxnii3iytfs2rauvsnt) rtrifctatla rlu ol()t2ur(o3iudol e neia(f 2rr(mooo4optomfciydfmDem(ms (0tltnmo3tatomD au s t)tetmxo3oydlltn nei s  Drrur ;u4alx mfeiat m2rluvonu4 lenxf3iy1fp rlu i;s0t2xmxo3oudamte fci (  2taxr ;o4tpt iiciasfaDumumo;()treoircta1fp rlnvi s0srur(r3oydolenlfvtlt s2ra(rp;t4tpt  f3ildfa2uluvp;t4tetoif oy1fpD aieil(0trxmim oy4optn nesatfaDtm(r ;o1apxomo3iad s eluvonu4tlxnmf to1lmDr n i;()teuoxo3ny4amt mietl( a2tauront0tpeomicils m2em(vo t) lenif iytoa   uei (  etm(o3iu1ome lietls s2taumpnt0apeo i3ilt a elnvs t0 rxrifcty1lmDrlnvol()s2xrxrpoodlleemnvias)aDtau o;o0tpenmictydfsDrl( ont) rtnxr3oa1omDr ues;()t2xoio3oo1lpen ivs tfs2ta(m ;u1ole  i3iydfsDum( on()areomr3io1lmDelueslt)srur(o3oy4lp  mictlsfs2urxm ;o1oetomieilt s2elnmo;u4alxrif iotfa elivi;t)texmio nudol   fvtatf rtm(m ;t1ape  f3iyd m um(vs () etoxf3oo1oa  livi;t  2toxo3oy1openlivias  Dtm(mooo1opxn ieiltla rl( s (0texrxocoydfmt  ieo s srto(rpio1ol emicil()s2umx  ;o1tlt mocilslmDemnvo u0aexoxr iotfa   nei;t0seuo(opoy4ll  lietl( aDuau  nt1oeeomfctyt mDrl(vp;() eerio3iadlmDeai s t)s2xmim3nu4ll n nvsls)aDtmumo;u4alxo feiasfsDemumpn(0 rermo3oodom e n o;s sruoxr3no4lpenlfcsl()sDtax pou0tpx ii3tlslmDranvpnt4 rtoiociytlat luvil()srtm(mpny4lleelieta(fsrrax  ;o4alxnmi3tatlm el(monu)teenir tydlm elieo t0s2toio oo4opeelfvils  rtm( ono4tltniicild m2umn o;t) rxnxf tadfp r nes;( trtmir3oo4ape lfvil()aDta(  oo4tetomfciyt s2ean o t0 ltrxocty1fmtrlies;t0 exoir iy1olee fvsls)aDuaxro;o1openii3tyt aDrm(vp;t)alxnmf oytlmD  u o (  exmiopou4amtnmfvils a2ur(  ou4tleomfcild sDua(vo t0texoxfcoytlpDe ues;( teuoxo no4optnlneslt arrr(monu0oexn feiytla2ul(vs u0aeenif3iatlmt anvols srxmxr iu4apt lneil()a2uax ooo0alx moeiyd mDrm(vont) eermfctodlaDe n i;(  exrir3oo1ll e nvsas)s2tmxronu4tpx iieiad a2elumo;(4 rtrmf3tatopDeau o;s) 2toxopiu4amt mivi s)sDrm(mo;o4aee  fctadfs ul(vpnu)areomrciatfmtelneo;()seurxrpoy4am e fct tfsrtaxro;o1opxnmfciad a2ulnmsnu4aetomo oo1lp  lnvo;()teuo(m3nudlltnmivil(fa2urxrp;o1optnmfeiydfa umumsnt4artnmr3tadlm eli o (0 2umio nudoltn fcs (farrax ont4apxnifetls a elnvp u4tlenxo3iadfpt livilt t2xoio oy4olt mnvta(f 2rm(m nu4tltnmo3tysla2rmumsnu4alxnmfciodoatr nvs;s) exm(m oy4apt lfcs s)srtaumpoo1opx  oeiydfsDrl(mpnu)arxnxoctydfat  u o s)s2xm(opno1aptn icias) Dtmu poo0opxoifcildfa2ua( o t4aeeoif3oa1latelivsl()teuoimpoydaptn nvsl() rtaxrpoo4alenmfciytfs2rl(vo;() eeoxr3tadoate uvol()srumimpou4ol   nvtas)s2rax pot1aetoiicilt aDrmnvo;u) etriocootlpt  uvs t0 exm(o3iodlmtn fcslt s2uau p;u1oeeoiieiyt m2emn snt0alenir todfp eaueo;s trto(o3nodom e icta()a2tr(r nt4oexo iciltla2emu p ()trxnxr to1fpt aivs;s  rxmxopoodllt mfes ()arum(rp;u4olenmfetyslm2rlnmo;u4 rxomocoatomtran ils)srurxm3io1llt lfcsas)aDuaxr ;t4tpxomfetydfm2eaumo (0 eenxr3iadfmD an i;(0srxoio iy1alenmnvtls) rum(mpot0alenifcias s umu o;t)altrifcoa1oat li i;t0 2toxr3oydlpt mneslsfa2rmu poo1tlt iiciat sDumuvo (0 lxrmo oa1fa  li i;s setm(o3no4ap nlicilsfa2um( oot1aexoioeiysfs2el(vp;u0trermo oo1fm elu o t)trurim no1lmt miviat arua(r ;u4tetnmicild m2ul(msn(0tleoir3iadfat livsls0 etrxo3oy1openmivtls sDurx o;u1aexnmoeilsfmDra(msn(4 renmr3tatfaD ln i;(0 rtmim nudole  fvs ()aDra(r ;u0aetnmfeiytfs2raumpn(4 lerifcootoa   nvilt0sexmxm oy4omeemnci sf 2rmurp;o1apenmo3iadfs2el(mpnt0texnxo3totomD  n ilt0 2urxopoodamtn fesas) rrm( onu0oeeo oeiasla ua(vp;u)trerxr3ty1lm r n ol()s2tmir3io4ape mivta(fsDtmumpou0apeomi3ildfmDelnmon(4altrxocoadoa  livs;s0t2xmxm io4alt  nvi t) rua(mpno0alx mi3iysfa rm(mo;t) rtrirctotomt lueils trtoxmpnydoleemnctlt arta( pnu1apxnmo3iytfs rm( sn(4tetomr3io1omte uei;()trtrim oodlm e netasf 2um( o;t0apx mociad mDrln snt)aexoir3io1oa   nvs (0t2um(m iy4llte neta( aDtaxr ;o1aptn ociadlmDelnms u0alxnmr3to1opDranvols  2xoir nudal nmncs ()a2trurp;u1tpxomocildfmDrmnmo;(4trtomf oa1fpte ieils s2ur(r3io1om nmivt sfarrmx o;t1olxn iciadfaDrlnmsnt0altnmo3ta1oateaueolt)texmim oo1lpen nvils)sDua(  nt1tlxnmiciltlmDumn p;(0 lxrmf3iy1oate uvols  rum(m oo1openlfciltf rrru poo4olxn i3ilsls ul( snu4 lenxr totoa ran i;()tetm(mpiodlmtnlnci t sDurum nt1opxo o3iatfs2uan p;(4tetoxfciy1lpD  nvi;s0trurxmpnu4lptelfeiasfs2tmumo;t1texomi3iydfsDua(vo u) lxnmocto1la   u o () rurxo3ou4amenlneiltf Dumum no4teeoii3ils s elnms;u) eermr3to1omteau o;s)teurxr3nudopeelfciat a2tr(  oo1aptn ieiatfmDrmumo;u4alxnxo ootlmt lnei;(0 2xo(opiy4lm  lnvt (f 2um(rpou0oee mi3tad aDea( on(4trtnmrctydlp  aivilt seumxmpoydolenlici s)srumxmo;u0altnifeiytfm2um( o t)aexoifciydfmt  nei;t)t2toxr3ou1ll  mneilt srtmumoot4olt io3iysla2ulumpn(0aexriociydopt lneo;t0tetrxr3no4lp  lnesa( s2ra( o;t0aetomietatlsDrl( o u)trermo oodfm  lneo s  exrio3iydole  ncsl( a2uaxroou1olt mfeiysla2ean s t4aeeoircoodlpDe iei t  rumir oo1ol nlncta()sruau oou0tlxo ieiltla2rmu p (4artrif3oa1la eaueo s) ruoimpno4al e fvs ( s2rr(moot0aexniocias s2uluvpn()artrxr oy1fatr i s;s0 etoirpnydapt livt ( aDtm(ro;t0apeo oeiad aDelnvs ()alxoir3iy1optranvi;s)trxmimpno1op  lfes sf Drrx  oo4tlenmfetydlm uaums t0tltnxr oodop eliei s  2tr(o iodlltnlicilsfa2uru o;u0aleomf3tydlm2ulu s;t4tetnxoctydlmteau o (0truo(o3io1op  livias)aDur(mp;t4tleniicildfmDeaumpnt4texoxf oodoptelnvsl( t2uoir3oudll n fvils  Dtmump;u0apt  oeiysfa2um(vsnu0 lxnmf tatoaDr n o;s)t2ur(m oy1amenlnei ( srrr( onu1oexo ictyt mDra(mo (4alxrxo io1fat  uvsls0s2xoxo iudalenmiei () ruru  nu0tle  oeiadls2rmn p;u)aeerxr iytoaDr u o (0texrio iu1ol  micilt srtmx  oo4oetomf3iat a ulu s u)treomo oy1lm  lu s s0 2xmio no1ome lfcias a2ta(rpnu1aexomiciatlm ean pn(0aleoio3ootlm rlivol(0t2trir3iydalteliviatfsDtr(roou4aexoifciyt a uanvonu0 rtoxf iytlat lu ols  exm(rpiu4amee fci s) rrr(m ;u0aptomoctadfsDul(mo;u)trenif todlpD ai i t trtmxr3ny4alte fes t)sruau  nt1tltoiociatla2el(vpnu) etnxfctadlaDr ivo;t)seurxopoudol elncil()srrm(mont0aptomfciytlm2ean onu0trxrmrcoadoaD  uvs;s tetrxr oo4op elies s arraurono1tleo i3iasfmDel(vo;u)tetoifcoy1lmD lieol(  euo(mpoo1lpenmfes s)a2uaurono1teto f3iaslm rln pnu)tleoxoctotlmt lnvol(0t2xoxopou1ome lnet t) 2uaurono4oeeoiietlt a eln on(4texrifcoy1fate u ils0srtmiopny1ll emnvt (f Drmxm oo0tlx ioeiasfsDrlnmont0arxoxfcty1oaDeaieils  2xoir3oydaltnmnvi s)s2rm( onu4aetomieils a elnvp;(0altrxo iydoa  lu il( srumim3oudomen ncsl(f rrr( ont4oetoifeilsfm2uluvo;t4 ltnxrciotfmDranvs ( s2uoxr3io4amte fet t) rtrum nu4tle ifetyd aDrl( s;u)tltoifcoa1om  ln i;( seumxm3ou4optemfvi ()aruaumoot0tpeo fetatfm ua(vs (0trerxocoatom  lueo s0 rtrim3oydom   ies t  Drm( o;u4opt  oeiad sDumnmsnu0artrirciydlpteaieo;(0trxoxr3iu4ap  lncs ()a2rm(rpnt1oltomoeiadfsDuaumo t0texomo tydfmDrlneols)s2xo(o3nudlpenmfesasfaDtaur ;t0oeeniietydlmDuluvpnt)aeermr3oydopD livilt0 etrir3oodlle lfeiat) rtmur ;o0tetomociad a2ua(mo;u0texrmf to1fpD lneo s) 2tr(opno4apt lnet sfsDur( pno1apx if3ils m eluvon() lxnxf iodomt luei;(0 rtmxr nydap  livtl()aDta(mono1oexo fcildfa rlumo;()aetrmf3tatlat aueo;()tetrxrpnydaltnmfetl(faDtmumpnt4alxo octytfa eaums;t4 exoif tatopteai i;() etoxmpny1ame mnvtltfartax poo4aeeoii3iat a rl(mp u0 etrircoodfpD  nes;s)tetoxm3iu1open fet ()a2rax onu0oetn oeiadfa2rm( p;t)tetrxf totfpt aiei;(0 2xmim nydllte ivsasf ruaxroot1teenmfciltfa2rlnmsnu)tlenmociotop rlu i;t)trxoir no4lm nliei s arur(r ou4ole iiciad aDulumo;t0texrir3ta1oateau o t0sexriopoo4lme mnci sf rur( o;t0aetn iciyt m um(vp u0aetoxr3to1oateai i s)srurxo3iy4am emnct s  Draxmo;o4tpenmociyt a uln onu0aetoiocta1oaDelivo t)seur(m ny4al e netlsfs2tau  ;u1oetomfciyt a el( p (0altoifcoadfm e n il() exr(m ou1altemicsat s2uaumpno0opxnif3ilsls2ean pnt4 etrxrcoy1fm eli o s0truo(r3nydlp n fvsa(farrr(mp;o4apenmicild s eauvsnt)alermfcoadfmtraiei () 2ur(rpny4omee ivtl()s2tm( o;t1tptn fciasls eanmo u)altrircio1lm eai ils) rxoxm oudomee fcilt) 2taurooo4aeenif3iltfa ran p;t4 rxoxr3iodoaD aivs;s s2xo(rpoo4altnlictl()sDuaur ot4oeeo iciatlaDuluvs;u) lxnmf totoptrln i ( s2xoxr3iydamtnlfvi ( aDumxmpnt4texnmo3iatlaDelumsn(4 etoio3iatoat aneils)srtoimpou1llen nviat)aDta(m ;u1aeeomfcilslsDelums;t) etrio io1omt lneo s0t2xrir3ou4ol  mnvil( s2umurooo0apto oeiatlm ua(mo u)texrio oy1lpD aivo;s0trxmxr3oo4lle lnviat)artrxrooo0apxoiieiydfsDem(ms u0texrif3tydfmD aneols)texoxo iu1lmeelivil(f 2urx pnu1alxn feild sDrmumpnu4 eenifciodomtrau o;( srurxr3iudlpeelivs t) 2rmu  ;o4tetoifciad s2ea( s;t4 reomf oo1lat  uvo s0 etoimpny1al emnvils a2trxm no4tleoiicias m2uaump t)alxoio3oo1opD  n slt trxmxr iu1lm e ieia( arta(monu1ole ii3iltfsDuln snu4alenxf oatfp  luvs;s0 ruoxo3oudome mfet (f 2rm(rpot1alto ietydlaDuaumo;(0tetrxf3oa1fmDrauei;s) 2uoio iu1optnlfei s)srumxr ot0tlx ii3tytls ra(mo;u0 eenmf3oydoaD an ols)trur(r3oy1amt mfvs s s2trxroot1apxo i3iyd m2eauvsn(0texnxf oo1laDr nvsl(0tetm(mpoudllte nvil(fs2ururp;u0alenmf3iadfm2ulu p;u0 exoxrciydfaDrlivols)s2tr(rpnu4lpeelies t)s2rmxro;t1alt if3iasla2rau snt4 eeoif3ootfmteluvs ()setoxopoo4open netlt sDrmxr ;u0oleo ociltfsDuau p (4aetrxrciadlmDeaivo (0texrxo3iu1ap   ncsas)aDururoot1aexomi3tatls2emn s;u4 renircoytlaD lieilt0texrxm ny4alt lfes sf Dtru o;o4texniietat m ulnmp;u0artnmo3oa1laDrln slt)setmxo nu4om   fctltf 2rrxmpot1oeeoiicildfs rm(vonu0 ltrxf oatfa   i o ( seuo(opiy4ap nmnvsat)s2taxmoot4olt  fctasla em(vo u0artoxr ia1omD livol( trxrio iudomenlfeia(fa2uaxr ot4oetomietad s2rln s t0tltoxf oadlaDelnvo;s0 2xoxr3no4ap nmfeslt sDtaumpoo4tpx  feiydla ra(mont4tltoif3oatlpDrauvi (0srtoio oydope lnct t)a2rmump;o0tlt if3iyt m eauvsnu4alenxf3iadfaDrlivil( trto(r3io1ale liciat)sDtmx  ;t1tpt ii3ias s2rmn s u)tltrxociytfatean s;s) etrir iu4ome lnvtlt)aDtrum ;u0aptomictltls eauvont0 ltnmf oatfm e ivo (  eum(m ou1al n ies tf rraxmp;t1teeoii3iyt a elu o (0aetnmf iotfmteaieslt)s2xoxo3no1amt  ics t)s2urxm nu0aetn fctytfa um(vs t) reoxfciatfa rlneo (0teumxm3ou1omtelncsas)s2rmxm nu4opeomictlslm ran p t0tlermociodfpD luvol( t2uoio3ou4lmenlfei tf 2ur(mp;u4tetnif3ild a eanmsn()tlxnmo ia1omDrau i ( teumxopny1ol nmicta(fa2um(root1tptnif3tat s emnms;u)tlenxf ty1lmDe i o;() 2urxo oydll emieta(fsDumx  nt4aexniicild mDrmn s u4treoif to1fa  ln olt0t2um(r3nu1alte fvs tfaDtmxrp;t1tlt ifctat aDem(vs;t)aexnmoctytfm elnvs ()teurim oudlptnlict ( arrr(  nu4alx moctyslmDra(vpn(0alxoiocta1laDrlueo s setrxo iydaleelfcslsf rra(r ou1oexomf3tydfm eauvo;u0 exrifctatlat aneo () eto(m3oy4lpte fctl( aDra(mpou1aet if3iytfm2uln onu4tlerif iy1laD livi;s  exmxr3iodapen iviatfa2uax pou4tptnii3iadls2rmn p (4areomf oadoa eluei ( trxoxrpou4lm n fcia() Durum oo4tee if3iasla rm(vpn(0arxnifcty1fmt li s t0 2xrim nudlp  mfei t)s2ra(mpot0oexomociydfm ea( s;(0 lenmociydom eau ol(0t2um(mpiodale licta(fa2tru ooo0olxn ieiytlm2emnvo;() lxoio iatoa r nvil( trumxm iu1am nmieias arrm(mpnu4tltnifetyd s umu o;t0tltrmo ty1lmt lnvs s trurxm3oy1lmte ieias) rtr( o;o1tltn feiadlm2um(vpnu0trtnmf3iodom  aies;( trtmxrpny1amenliviatf rra(rpnu0apxomiciyt sDum(mp;(4aeeoio oa1fptrauvol(0t2xoxmpoodal n feil(fs2urxmp;t1aeeomociatlm2ra(vp t4tetnmrcoydlatrluei s)t2tr(rpiu4am emnvil( arra(mp;u4tetnii3tls s2ra(ms u0altrxo3io1lat  neo;t0srurxr3iydop  miciasfaDtrx  ;t0opx  f3iys s ulumon(4 rtrmocoodlm rlu s;t)t2toxrpno1ll e nesl(fa2ra(rpno0opeomf3tldls rm(vo;()aetnmrciytfp  lu o s)t2toim ou1ape  nesas a2umum no0tpe iictatls uan pn(0trenio tydfmD  nvi t0 rtm(m3nu4amtnlnvsat)sDrr(r nu0ale  i3tasls uanvsn(0arenmrcoo1omDeauesl(  2uo(o3nydole miesatfartmx ono1oee  i3iatfa2eln p u0 rermocoo1op  lneo ( s2xm(r nydomte neils) rtr(rono4apt iietad m rmuvs ()arerxo3oydfa ean s;s)sexmxo3oodlp  livil(fs2umu ooo0optoioctyslm2umuvo;u0 etriociydfa  luvi t0sexmxopiodamtnlncsa()srraxrpnu4apxnmfcildfs ul(von(4alxoir3oodla   uvils0 2tmxm3nodome  nesatfsDum(rpnu1tpx  oeiltla eln s;u) etnmo3iodop rluei;(0tetmxopoy4amenlfcsa(f 2umum nt1oltomi3ias m2ul(monu4alerxociytopDeauvols)t2umimpnu1ap  mfvsls  Dtax pno1altoii3tasfm2emu p () ltnirctodom  auvilt)s2to(m oodlmenlfeiasfarurum ;u0alt  i3ildls2rlums t4tetrif3tydfmD  i s s  ruoxo3nudal emfctat s2tmxm no4oleomf3iltlsDelump;t)tlermr iodlateaneilt0 ruoxr nu4ol n ncta() rumx  ;t0oee  f3iytfa ua( on()tetomfciadfp elnvs t0t2tr(o3nu4omtnlics sfs2rru poo4tltoifeils mDrlnms (0 eenmr3iotfp elneil()trtoxr3iodllte fvs (faDtr(  nt0tptoif3ias sDrmumo u) etrio3tatlat liei;s0 2uoxm3ou1ol nmfesls)a2rrumonu4tlx  oeiydlm2umnvpnu4tlxoxf3ty1oat lies (  2xoxmpny1omte fvi s a2ra(mp;u1tlx ioetad s2ulnms (4 ltnif iatfatrauvi;t  eurxm no4lp nmfci (  Drrx onu1olxn iciltls elu p;(0 eenxrcoadopDrauvs t) 2ur(m3nodam n nctl( aDraxrpnu1aleomf3tys s rl(mp t0tltnirciotlpte nvols srtrim oo1ll elnvt ()aruaxmoot4tpx  o3iatls eaums;t4tetrmf ootfaDrlnvi;s)sexrio3iydlmeelicsas aDra(rp;o1opx mfeiltla2eau ont4aexoxfciatlmD li s;s) rtr(o3iydamte fcsa(farur( o;o0tet ifciasfsDuaump u)tlxnmr3iadfp r uvi (  2uo(o3oo4op elnvs t  2ta( o;t1aet ifciys s ulu onu4tlxnircoytlp  lnvs;s0t2xm(mpnu1omt  ici tf rtmxmpnu0aee mi3ias sDuauvs () leoif oo1lmt  ies s0tetm(r oo4ap  lnvsat)a2uau p;t0oexn feiltfa em(vont)teeoiocty1faDr ueilt) 2tmxo3iu1amt mfcs s aDrruronu0ole mi3ildlm2elump (0trenxr to1optrln s;() rur(rpnodlmtn ncsas)s2rrx oou1tee moetydfs emnvsnu4areoxf3oa1lpte ieil(  2toir nodaltnlnesl( sDtax p;t4tleo f3iatfmDuauvs;(4tlenifcoo1laDe ivslt0seuo(opiu1lmee neils)a2ur(rpnu0apt  oeilsls eln pnu0 renioctotfmDeaivo;()tetmxmpiodomen iesa( srraumont4tpxn fcias a2eau o t)arxomf3todoatran i ()tetm(o3oy4omenmfvtlt srraurpnt0olxoioctyt a2uaums (0 eenif3oadoaDrlnvs;s0 exr(mpny1op  mncsls  rrmumpnu1oetomfctlsls ua(msn() rtomocty1omD luvsl()texoirpiudomte nvi (fs2rmxro;t0ole ii3tyd a ulu p t4aetomr3tydlaD  ieo;s0 rum(o3oudal n net t  Dtm(m no4aeeo ieiytfm eanvp u)aetoifciatfptrauei t0t2umim io1lp nlnvta()aDumum ot0tlx ioctas a2ranmsnu4alxoxf3totfmt anvolt trum(m3io1op  miesas) Dta(rono0tpxoioctad m um(vs;u4 ltnio tatlmtrlivi s0 eumir3oo4altn fesls)arraxmpoo1optnifctlsls2um(vsnt0aeerxf ootomtr nesls0 2tmxo3oydalte icsl( s2rmur nu1tptnmicils a ranvp;t0 ltrio iydop eauvo t0seuo(o no4apt  ivta(fartmu pot4tpt ifcildlm ea(mo;() rxnif3tadlpDr uvo t0 2xr(m3iudllenlnct s)arumumoou1oleo o3iltlmDumnmp u4trtrxocoadlatrli s (  eto(o3no4optnmici () rrrxront4opt mfeiytfm2em(vp t0trtnxfcoo1lmDeaies s0trurxr3oo4al nmfctl()srua(mpoo0tee  iciatfa2emums;u4arerirciytoa eanvolt)t2toir iodamen fvsa()a2umxroou1teenmfeiatlmDuanms;t0aeenif tydoa e ieol()seumxr iu1am n nvtl(f Dtaxmp;t4ape miciatlaDumuvs u4texnmo ootfm eluesl( sruo(o3ou4olte ivil( aDtrum no1opxo o3iydlm2ulums;u)tetnifcio1om  lu ilt texoxm3nydamenlfcta(fsruaur oo0tpe ii3iyd a el(mo;t0arermf3iotop eaueils0 2toxrpou1ap e ietlsf Drru o;u0tltn iciatfsDrlu p t0 lxrif oy1fp  lu o;s0trxo(opiu4llee nvi t s2ra(mpnt0optomieiad sDumnmonu4 leoir3ty1fptr i o;t0s2xr(o oudlltemnci s srumxmoou4ole mi3ias m2emnvp;(0 ltrif3tydomD auvsl(0texmxo3oydop n ieia(faDtaxrono1opx miciyslsDumump t4tetoxociytomD liei s sexmxm iu1lm nliet sfsDtmur oo4tle  octydfs2rl( onu)artrxo3ta1fp ranvs;t0teto(mpnu1lm e fvt s)sDta( p;o4alt ii3iad a2uanmpnt)tltrxr tytlmteaues;( sruoir ou4lptnmivi s  2uru  ;u4aexoifetls s2ea( o (4aetniocto1fpt  n i s teurxo ny1aptelfvi t sDra(  nu1olxnmicilsfa rmumo u)arxnmr to1omDe i s t trur(m io4apt  fvtls artrx  ot4tle mfcild mDrluvp;u0 eenmo3ootlp eanvi;t  etrir3nodlm elieia(  rrmxm ;o4oee ioctldfa ul(msnt4artnxf3to1faDr u i;t  rtm(opnu4lltnlfcias) 2tm(mo;o0aee ii3iydfa2raumo u4 eerif oo1fm e nvs s0 rxoim oo1ll nlfcia(fsDumxmpou4alx iieiltfs umump (4treoxfcto1fa  anvol(0trtr(m3nu1ol  mfvt tf Drr(m nt0aex if3iadla2umn o;(0aeeoio tydomDrlues;(0 rur(o3nydllt lfcs (  2rmxr ;o0oex mi3iad s2ea(vp;(4teeoif3todfa   nei s)trxr(r3oy1al emfet t) 2ta(  nu4apenmf3tad aDuan o;t4 renio3ia1faDe nes;t0sexoxm iu4lpeemivsa( a2trx p;o1tpe  oeiysfs2rlu s t) rtnmr oadfmte ivols0sexmim oudap  licsl( sDurxmoou0opto feiasls2umnvont4 rxnmf3ootomtraies t sruo(o nu1omee fcsls)artm(mpnu4aexo i3iatla rln o;u0tetrifcoytlateaues s) euo(m iudlp emnvt t s2rmxmont0tlto o3iytls2umn p (4 exoxrcoytoate u i;t)t2ur(o nu1altnmnes s)sDumxrp;o1apt  ictad m um( pn(0tlxoxociodopDr nvs t0sexr(m3nodam n fei (  2rrxmp;t1opxo icildfs eau s;(0aeermfcty1om  lu s s0sexrimpoudom nlnvils) 2rrumont4oex  o3iytfaDra(mp;u)tetnxo3ootfaDr uvsl()teum(m iu4al  livtatf 2raump;t1tptnif3iatfsDrmu s;u0tetrifctadoa  auesl()t2uo(m3nu1omenmnct ()aDrrxmo;u4tpxn oeiytfmDranvo;t0trxnif tytfaDe nvs;s0srxr(m3iudll  mfetltfsDrmxmono0olx ifciyslaDrmums;u4alxomr oy1fateanei;t)srxoxr3iy4ole lneias)srrmxmonu1alx  iciysfa2el(mont) rerxr3ta1lm raueo;t)trtrxrpiy4optn ict s)srrrumpoo4olxnmictls s2el( p;u0tlxrmo3ootoat auvi;(0trumiopou1apt mfvtlsfsrrrumoou1opxoioctld sDrl(vont0tetrmrcta1om  li i t0 eurxr no1amtn fcia() Drrxr ;u0alt ioeildfa2ul(mon()arxnxrcoytlm elivol() 2tr(m oudlltelivs ()aDrmumpot0tlxomo3tyt sDrau pnt)altoxoctodlaDr nei;s)trxr(o iodomtn nvs ()arum(mp;o1oeenifciydlaDulump;u0 exnxr3iadlm e n o;s t2tr(r iu1om  mieil()arrru  ;o4oee if3tytls emnmp u4 reoxr oa1opt lneol(  rxoimpoy1lmtnmncs ( a2tmx pot4oet mo3ildfm uaumo (0 ltnif3oy1fmt ai i;(0 2trir3oy4lme mnvilt aDtrxrono1apeoii3iysla rmu pnt0altrmociadlatr n o s  etoxm oy1lltemnvi tf rur(mpot0tleoioeiaslm2rln p (4arenxrcio1opDe ieol(  exrxo ny1apen nvtl( artaum ;o0aptoif3iytfa uanmon(0 ltrxo oytfp   u sl()srtmxmpiydole mieiltfaDur(m ot1tle ioetld a2em( s;u0 lxnmf3tydlp r ueolt teuoir3nu1ap   ictat)aruaumpnu4aex  ietldlaDuau s;() etrmrcoytomD luvs t0t2toim3oudomenmici tfa2ta(mp;t0alxnioeildlaDrlnvs;u0 leomoctotom eaivi;(0t2xmxm3nu1opeemnvt tfs2trur nt0tlxoiieiyslaDrmuvpn() eeoiocoo1fp   nvilt srxmim iu1lmee iei sf 2ua(mo;t4alxoiictys a2ul(vsnu4artnxr3iotfm eln sls0s2xoxm iodlp elnci sfsrtm(r no0oltomociltla rmu ont4 etrxf tatfpt au ilt)t2tr(r3io4olt mnviltfaDrmumpnu1oeto ietadls2rm( s;(0 rxnifciadfateluvsl() rtmirpoo1lp e nct (f rrm(  nt1tetn i3iltlm2rau pnu0 lxnircoy1latrluvo;s)s2xr(m3ny1ap  livias)s2trxm oo1alxn fctys a emu o;() etnircoy1optrluei;t) eurxmpiu4lltelfeilsf Dum(mpou4oet  o3iyd a rmuvo;t4trtrxo3tytlaDelneil()t2uriopiudlltemnetat)srrr( pnt1alxomictls m eanmpnu0 lxrmf oadfpDeauvs;t)setoxm3nu4aptemivtl( a2rau p;o4olx ii3tyt a ranmo;u)alxrxo iotla  livi t  2uo(o oydam emneilt)sruaxmpoo4texn i3iadfsDemumpnt)aexoxf3oy1fm   u s (0setrimpny1lpee ivia( srumxmono0texoiiciytlmDua(mo (4tltnxf iydlpD  n i ()sexoio nu4apen fvs t arrau pot0alxn ieiys mDemu s;t4artrifciatfpDrlu i ( t2tmim3no4llee ieiltfa2ur( p;t4apxo i3iad mDul(vsn()trtnxo3oy1oaDraues s)trtr(opoy4omtn fciasfs2tr(mono0olxomoetasla el( p t0arxnmr3todom r nei t)srtrimpiudllenlictl()artmu  ou4tlxnmo3iad aDel( s u4aeeoxf3oydfptrlnvi;s)srxr(r3iu1om nmnvsa(f Dur(  no1tle ifeiysfm ea(vs t0aetrmf3todlmDrluvil() 2um(o oy4optemfctlsfsDra(r ;o1olxnmf3iltlm2ea( o;u4aleoirctytla eau sl(0tetoxr ny4op n ies s) rra(mpoo4tlt iicildfs eanmo t) lxrxociatlatraneo t0seurim iudlm  mnvi sfartr(ronu0tlxn ieils m2ua( snt4tltrio iodomD  n s;s setm(mpnydom nlfesa()sDurxr nt0oetniociadlmDra( p t) ltrirctatlm   n il( trurxr3oydapeelfetl(faDtaurpoo0tleomo3iadfa ra(vont)texnxr3oytom  lueol(0trumim iu1lp   fcsltfa2trumpnt0apxoifeiys s2rmump;t) exoxr3io1lp r i o;()truoxm nu1lmenlfctl(fa2umxrpou4aexomoctltfaDul(vont4trenir oatfm r n ols0trtrir oy4omt mfes ( s2rrx o;t4oltn ieild s rlu s;u0 rxoio ootfmD auvo;()tetrim nudlmtnlncil(fs2tax ono0aee  ietlsls rmn pnt4alxnir iydlm  livo t)srtmim3nudoleelnctas) 2urx oot0ope iietltfmDraumo (0artomr3tatlpDr uvo s0 exrirpiu1apte nei (fsDrr(mpou1teenmieiydfa ea(ms (4arxrmocoydoa e i i s)s2uo(rpny1am n nci s)sDurx oou0tptoifeias a2rmnvp (0alxoirciodfatr i i;t0 etrxo no4optnlneslt s2rmurpot1teto iciadls emu snu0tlxrxrciy1op  li ilt)tetm(o nu1lm  lneiat)srtaum ;o1aptnmoeiatfm2ran p (4teerxoctodlaDeau o;s teum(m3nu4altn ict (  2rax oot1oltnmociat s2rmu p;(4alxoioctydfaDr n s ()teto(m no1aleelnes ()s2raxmpou4apeoifcildla2rlumo;u0aeeomr tytoa e n ils seuoxopnu1ll elncia()a2trx ono0olx  fetldfm2elu s u0 renxr tadom eluei t) eur(r ou1am elnvta(fs2tm(m ;t4apt ioeiyslm ulu s;(4alenif ia1fmt  uvo;(0 exo(r no4olt mncta() rrrxmpnt1teeomiciatfaDrlumpn(4aexoircio1oa   n o s trtrxo oydlptnlncsas arum(roou0tex iictadlmDuln p u) renio3iy1fpDe ivi t)tetrxm3iodopee ieta(fsDtmx  nu1tet iietat s2ulumo;u4tetoxocto1omD aiei;( trurxm3oy1opteliviat  Drrxront4tpxnio3tydlm2rau snt4artrmrctydlmtr i s;()t2toimpny1oltelnvtat  Drrxmont1apx  oetls mDulu s (4aetrir iodlm rluvsl(  euo(rpou1ape  fvsat)srtrum ot0aee mfetad mDem(ms;(0tlxnxf tydop  aieo (0 exrxm3oo4ape mncsls)a2tauront4tptomo3tlsfaDeanmo t4 exnxfctydfmDrlu i;( srtm(rpio1omen fvsa(fsrtau p;o0olxo icils aDelnmp;t) rermf3iy1oateanei s)srxmxmpio4om emiei sfa2trxr ot1oltnioctysfa uln pnu) lenxfciytopteli i (0t2tm(opoo4am  mfvi t) Drrurpot0oet mfetltfs el(msnt4trtrif3ootfpteauvo t)trxoxo oo1ape  feil( a2rrxrpou1tpt  fciltlaDuan s;t)teerxo oodoaD  u s s t2ur(rpnydop emnvt ( arrm(m oo1tltn f3tldla2uan ont4arerif oadom e ivo;s  rxmir3ou1lp   ies sfaDtrxro;o0oeeomoeiasfm2rau ont0 rtoir iodfpte n o;t teumxrpnu4ol  lnctlsfa2rr(  no1tpxniictatfa ea( p t4aexomr3iy1lp eli s;s0sexr(m nudlpe  nvtl()aDta(rp;o1tpx ioctysfa2um( pnu0 leomo3oadfat  n ols0 rtrxo nydllt mnvsl( s2urx p;t4aleo oetls m um(mpnt0texrio3tydfaDelueo t  rur(r3oy1apen ivsasf Dur( ont1aexniiciyslmDrmnvo;u0texnmr iydom  auei ()s2urxrpiodlleelfvt s)sDraur nu4tpxomoeias aDulnmpn(4 rermrcoatom e n i s)setoir no1ol  lneia(  Dtru o;o0alxnmieilslsDuaumo (4 exoxr io1fmt  ieilt)teuoimpoo1lme mncilsf Dtmx p;u1tetnmo3tydlaDrmumo;u4 lerxr3iotla eluvi;t) rxr(o3oy1ll nmnct ( aDtr(ronu1alen f3iys sDrmump;t0tltnxr totoa   n i;s srto(r oy4ll n neils)sDtm(r no0tee ifetls a rl( onu)tlxnifcto1oaD  n sls  rumxo3ou1lptnmfet t arrmuroou1aet iociytlm2ra(von(0 rermrciatom elnvs;() eto(m3nydlm n ietlt)arumxro;o0tpxoiiciys aDeaumpnt4texoxf ootfm   i i;s tetmxm ou1am   net (  rua(  no4aleoiieiadls uaumo t)aeermrciodfp r n ilt0srtmim3no1ameelivt (fa2tm( pnu1tpxo f3ilt aDemumo t) eeoir oy1fm eaues;s0s2xrxrpnydomenlnvi s)a2uaxmpno4altniietysfaDeaumpnt0arxrif oodfateauvsls srtm(opoodaltnlneilsfarrr(m ;t1olxnio3tatfm2ua( p;()texoxf3tadfpD lnvs (  2urir iu1ole lneilt)aDrmx p;o0apen fetlt m eauvs u4 rxoxf ta1oa   n i (  etmirpoo4om n ivtasfsruaumpnt0ale mi3iysfa ea( sn() eerir3oytfmte ieo;(0t2xr(o3iy4optnlfcsas sDumx ooo0ape mi3iys s2ean snu4tetoio3iadfmDe n sls)srtoim ou4alt lnes t)aDur(rp;t0texn ocild m2ran o;(4tetrmrcia1fpD  iesl( sexmxmpiydaptn nesat)sDrrumpot0oex ioeiatfmDrauvs;(0 rxoxo3totlpDean o s0t2umirpou1ale mivs ( aDtrx ont1tlenii3tyd mDumuvp ()trenxf3oytfmDelu o;s0 exmirpiydap elfei s sDtr(  oo0openii3iyd mDemu s;t0tlerxfctatoatrlivsls s2tmxm3no1ap n fetatf rraxronu0olxnio3iyd sDrmu pnt0trxnxr3totlmDeauvo ( teum(r oy1omte net sfaDrrxmpno1oex  o3tls sDulnms t4tleniocoytoat lneo;s) etr(r3io1opeemfes s  2truro;u4oet mieiyslaDuauvo ()alermfciatfptrlu s t tetr(opou4lp nlnvsa()arua(  no0tpe mo3ils m rmnmont4 reoxr oodomt li ols0 eumim iu1lmte icsltf Dta(mono0aex iociltfsDrau s u0alenxr3iadom e u i;s)srtr(rpoudal elfeil(farrmxrp;u0oeto f3iat aDrlnvsnt0tleomf oydlmt  uvs s0s2xrxopnu1am e fvt () rtax oot4tee mo3tltfs rmnvon(0artrmf io1omD  ivs;t0t2uoxm nodlm   ivs s srtmur ;o4alxo f3iydfm2emnvs u4alxrifcootfa rlu s (  2urxo3iydap nmnetasfsruru ono0tleomoctydlsDrmnmp u)altrifctotlpDeanvo;t)s2tmxr3nodlmenlfes s sDtmumpoo4apx io3ias m ranvsnu0arxomf oydlaDe ies;t0 rxm(r nu1omtelies (fs2tru pou1oltn i3tadfmDuauvs;t0 lxoxr iatlmDeaivol()truo(rpnydll n nctl() 2tax p;t1aeen o3iydfm2uan p;t4aexoxr oa1fa   i i t setrim3ou1olen ncs sfa2uax pnt4tltnifeiad aDrlumsnu)tlxomf oadoaDeanvo ( sexo(o3oydalt mici t)aDrmu p;t1aetnifeiatlaDrln p;t0 eenmocoatfptelu i;t0texo(m3nu4al e fetls  2rr( ono0oltn ieiydfs2rlu pn()aexoxfciadfpDeli s t t2xm(rpoy1ll   nvt sfsrumurpoo1oee iieiatlm2eanms;u0trtoir3iydfa  lu sls)trtmxmpoy4lm e fciatfa2tmx oou4tpeo ictysfaDeanmp (4trxrxr3iydoatranvo;s0tetr(opnu1lme mfcil() rtmx  oo4tptn iciytfsDelnmp;(0 ltnif3to1fpDr iei ()trxmxo oudapeelfci sf Duau o;u4tltoiocils a2ua( s;()arenmo iydoptrai ols t2xm(o iydale lnci ()s2ua(ro;t4oeeoiieildfa2eau s (4 eeoif ootoatr ies s0s2urir no1amtnmici s  Dtrum no0alxoif3iatls2elu s;t4tltrmocta1lmte u o;(0 2xmxo3iydaleemiesatfs2ur( o;t0aleo iciad sDeln on(4trtnio ta1omtean i (0trum(opou4aptnlfeil(f rtr(  nt0olenioeiadfa rln p;t4altrxf tydlptelivilt setmxo3iu1lmeemiesl(faDumu pou4tlxn o3iadfm ulumpnu4altrmrcto1lptrau o;(  etrio3iydlptemnvsasfsrrm(  ;o1tlx iieiydfsDrau o u0tleomr oodopteai slt)texoimpiodlmte iet tfsrumum no1oetniiciadfm2umu p;t)tetrir3to1op rlnvi s)t2xrxm3io4ape  ieil(faDua(mooo0ape iieild mDel(vs;u4artrmoctatopD  iei;t) exoxr3ny4op elneils srtmu o;u4aleoiocilslm2umuvonu4trtoxr3oodfp   nvs ( trxr(m nu1om  lict s a2trxmp;o0apxn oeiytlsDrm( pnu) exnmo ty1oa rlu il(0 2uoio3nu4aptn feia(fs2rrx  nu1ale iietydlaDra(vo (4alenxoctadfpD li o t)seurxr io4om   ies sf Dur(  ;t1aex micildla rlnvp u0alenmo oytlm   uei;t0texmxrpoodal elicia(  rtaxroot4tltomfetatfs2ea(vo u0aexomr3iatlm r u o;t0srxmir ou1ap emfvslt)sDuax  nu1tex  feiad mDrmnmp (4alermf3to1fm  aies;t teurxr io4olt lfeta( srur(rpoo4ole  feiyd m2ra(ms;u0 lenmr3to1fa r n i;s)t2trio3no1oltnlicias s2uaumono0tltnioeiatfsDuanms (4 rtrxo oytfp   u slt) euoxm3io4lpen fvt tfaDtm( pnt0tptoio3tysfs um( o;t)artnifcoo1opDe u i t) eum(r3io1omtelfeilt) rtau p;u4altn fetltlmDul( s;t4tlenir tytlptrli i;( t2xr(rpnodlm   ivia()aruaxrp;o1aexoifciasfs eluvsnt4 lxomr3iy1lptelies s0texm(mpiydap   fesl( sDtm(rpnt4ale  o3tatla elums u4texomf3iatfptrlivols teuriopiy1lpt  ieiat a2rrurpno0texn ociyd m2rmnmo;t0tltrmo oy1om  lieil() exmim io4am n nvi s arrm(m ;t1alx mfeias a umuvp;u0teenmf3iy1fm e nvils)s2xoxm nu1omtnlnetlt)artaxmp;u1olxomoetydla emu s (4tlxnmo3to1fpDr ieo;t)seurxr io1om  lfvta(faDtmx pnu0aet mociytfs rm(mp;(0aetrir tydfptr u s (0teur(r no1lmee nvt s) rurum ot0tleomo3tasfs2emnmo;t0texrxfcoodlpDeln s s  2uo(o oy4ome mivil(fa2tmumpoo4aeenmi3iytfs em(vo;(4alenio iotfmDrlnei (0srxoio3oydoptn nci s aDuax pot1oetn ociydfs2ra( p;t)texnxr tatfat aivo;t)truo(opnodalte iei s s2rmxmp;t1aet  icildfsDumu s;t0 etrxrcoy1fa raneo (0 2tmio nodllenmivi ()srurumpoo4tpx  o3iatlaDem(ms;()tlxoxf3iotom rau olt0trtm(rpny1lptemicsat)srurx pnt4apt moetls s umuvs () rtnxrciytomDr u s;(0 2xoimpnydll emivtlsf rrm(rono4ole  fctytfmDea(msnt0arxrxr tydom e u sls) rtm(rpno4omt mnvs sfarurxr ;u4aetn o3iys m2rln p (0alerif3iadoa e nes t0t2toxr oudom nlnvil(farrau  ;t1apx ifciydls eanmo () ltnmrciy1oa r nvs;s tetoxr3nydlmtnmfesas)srurxmp;o0ale mi3ias a ua( snt)aeeoifctotlpteaiesl( sexr(m nu4lp n ictas srum(mont1oet mo3iydlm2rl(ms;t0trenxrcoy1fp e u o ( sexmiopiu1amee ici (f Duax  no1apto ieiadls2em(vpn()alxnio iatfmtelnvols  exo(r iydal n neiatfs2taxr ;t1aee  f3ild m rauvs;(4 etrif tadopDe n o () 2xmir io4omeelneslt aDtmxrpou4tle mfetyt aDulumo;t4 etnirciadfpD lu o t  eumir3ny4openliciat)aDtrum no0oleoioetltfm2el(ms;t4artrio3tadlp  lues ( srto(mpiudlltemivs t aDum( pnt4aexn o3iltfsDrl(ms (4teenxr3iodlaDr n o t seuoimpno1alt mnet ()arum(  ot0teto i3tysfs2eau o;t4tleoxf3iy1fm rli ols0 2urxo iodlpeemicslsf Drmump;o4olxoii3tls s uluvpnu0tltnmr3ootfpD  n i;t  eurxr nudol  lnes (  2um( onu0optnif3iasfs elums t0 rxrxr oadfa e nei;s0texr(mpoo1aptemneslt)aDtrurp;u1alx mfetys m2ua( pn(4 renxf3iydfp   i slt)s2xm(r3oo4alt mictat srtr(r ;u4tpt io3iyd m2umn o u)trxoxocty1lptr uvs;( t2xmxo ny4ol e nvta()sDta(r oo0aptniociytfmDrmu p t0trerifctadfat lnvsls seumir iydlle mies tfsDua(ronu0tex ifctyd s ulnmo;u0 rxrifciy1la elieilt)s2xoxopoudapen fctl() 2rr(  ;u1olt mieiatfm2uaums;(4tetrir3tydop   uei s0srxrxm ou4optnmfcsl()artmxmono1olx ioctasfa2uauvonu0artoxr todfaDean i;s0srxoirpoo1lm e fcias)a2ra(mono4aeenio3ildfs emumo;t0tetnircio1late u s () euo(mpio4ll nlictl()srtmxmp;u0aeto o3ild sDea(mp;t)aexrif3iadom elnvsl(0s2ur(m iydalenmivi ( aDtmx  nt4tlxo ietydfs ua(mp;t0 rtriocio1fmDeluvols trtr(o iu1lpte nvi tfaDtr(ronu1altnmi3iyd s2rlnvo u)trenmo3oodlptrlneo;() rumxo3no4llt lfvsasfaDtaxr ;t4tee mictls a2ea(mp;(0tlxrxocootfp rli s s trtoirpoydomee fcsls s2tmur oo1alxo ietysls2rm( o;(4tltnifcoytoat  neo t)srxr(m3io1apteliet tf 2ur(  no1tpen ieiatfa2emnvo;u0 ltrioctodoptran il( seurxm oo4oltelnvil()sDrrump;t1ale  fcils m ulnvp;t4teeomo3iodoaD  ueilt s2umxmpiu4lmeemfciat arrruronu1aee mocils mDua(vs t0 rxnxf oo1lmDeaieo;t0 rxmio3iy4lltn nvs (  Dur(m ;t0opxn oeiytfs ea( pn(0texoir tatfp  aies;s  rxoxr nodom  mnct s srumxmpnu0alx  f3tyt s rluvp (4 rtrxf3oo1fatranvi (0 2tmxm no1llen ieilsfaDtau ono0oex  octyd m2uanms;u0aexnxf3to1lmteluvils)texoxrpny1lptelnes (fsDtmumpou4alx iicild a rm(vo t0 renio oy1faDr iei t0 rxm(mpiy4lmtn nvs sf 2trumont1oee ifciysla emu pn(0alerxr3iytfmD anvs;()teum(m3iydom  lies t)sDtaxm ot1apeoii3tldfm ea(mo t4texnmr iatfaD aneo;(0s2xrim ny1lptnmncs t  2rm(rpot4opxnmieiysla emumpn(4 ltrio iy1lp  anvo s)teuoxm3ou4olenlieiatfsrtmxmont1oeeoii3tytfa2umn onu4 eeoir io1fp e ivo;t)setm(rpny1lleemiesasfs2ta(m no4oet ioeils a rln sn(4aexnio ia1fpt  n olt0trur(mpny1om nlfci (  2raumo;o4teen f3iaslm eauvpnu0tltnxfcoatom  anvo;s0sexoxmpiudal  livta(f rtm( pot4alenifciytlaDulu on(0tleoxf3totlaD  i ils0s2tmxo ou1ome  nvtltfaDrmuront4oeeo fcilt m ul( onu)tlerxr3oy1lmDrlueo s)s2tm(opou4llt  iet s) rua(ro;t1tetnmo3iydla2rmu p;u)artrmf3oy1lm rlu i;t teto(opiy4apenmfet s aruaxroot0altomoctytlmDelu s u0 eerio iy1faDe i s s)trtm(rpoo4omenlfcias  rrmu pno4tptn iciltla2uan snu4arxrmrcoadomDr ivo t)s2umirpiodoltn iei t)arum(m ;o1alx  feiat sDuanvp t0 etomocia1lpte ivi;( srxrxr3ny4al n nes t s2tm(  ou0aee moeiatlmDra(mp (4trtomrcootfatrauei t)trtmim3iu1lmt mieilt)arurumpno1optnifeild m em(vp ()arxoxf tadfm eauvs t seumxo ou4omenlicsa(f 2tm(mpno4texn feiyslm2um(vsn(0 exrio3iydomteauvsl(0s2umirpoudllen nvta( s2tmu oot1ole mfetyd aDul(von()artnxo3to1lmteaiei t) 2trio3no4lm nliesl(faDrru oou0optn o3ilsfaDulnvonu)trtrmoctytoaDraneo s0teur(opnudomtnmieiat arur(moot4oexo f3tltfm emn p;()tltoxr ta1fa eauvo;s seum(r3nudllte netat)sDrax poo4tpxnmfciat aDrlumpn(0trxrir3ta1omDr iei t) eumiopiudal elfviltf 2tmxroot1tetn o3tyt sDul(vp;(4 ltrxo3ootfpDeln i;( trxrio3iudolenmics s) 2tmx pot0ape  feils sDulnvon(4arxoio ty1lpt li s s0 2xrimpny1apenmncias srrau pno1oeen ietydla el(mpnt4tlxnif3iadfaDe nvols)setrirpnodomtn netltf 2um(root4tlenmf3tatfm2elnmsnu0trtnxr3oo1la  auvil(0setoim oo1ape lneils  ruru pou1teto oeildfm2uau onu0 rxnir totlptrlu sl() exoxo io4oleelnvsa() 2uau  ;u4apeomf3iadla2ua(vp;t4teeomf3oa1fpteaivi;t)s2xoirpnydam emfvtltf Drmxrooo4apto f3ild a um(mo;u4arxrio tydlat aieo s t2uoimpnudalt mict s a2tau p;o4opto fciad s el( s;u) lenif3io1fa raiei;(0sexoxopny1am  mfes t) 2tauro;u0tpxnifeiad mDuanmont4 rxnxf3iatoptrauvo;()trtoxopiudlmt lnvtatf rtaur ot1oltoio3tatfm eauvo t)alxoxr3io1fa eaiei;s  exoio3oy1ame liesa(fsrtaump;u4apxoiociad m2rmn s;u)aleomrcootfp  auei s  etmxrpiu4al n ivta(  2rmx o;u4tee mi3ilsls2rmu s;(0altoxo3ia1fpD li i ( seuoxm ou4alt mivtl(f Dtm(mpou1alto feiytfsDemn sn(4tlxoif3tydfp eaivilt0s2urxopio4omt lfct s)a2rr(ront1olt  oetldla ea(ms u0 rtnio3iotfmt  ivo;()sexoim3iodomtnmnctlsfarrr( p;t4oee mo3tls a rmumsn(4tetrmocoy1lmDe ies;s0t2xoio3nodll e ietlsfartr(root1tptoifetytfmDem(vonu)teerir3oadoptrau i s  etoxr3oudlmtelncsls)srra(moot0tlxnioctadfm2ean snu4tltnxrcoy1lm e n i;t) etr(r3iu1lmee fci tf rrr( pnu4oeto oeildfmDrlumsnu4arenmocia1faD au s (  2xrxr3iu4lmen fes tfaDua( pnu0oltoiieiadfsDran p;t0teenmr iydfm rau i;t0trum(mpoy1ap emfcsl(fa2tr(r oo4tlxo o3tyd mDemn o;(4 lxoxr todlate ivi;s  2xrir3iodop  lfctlt) rururpnu1aleo octat s elu p;u4 lxrxrcoytfmt ln olt0t2uoxm ny4lm emivia()aDuauro;t1tptn fetadfs2rm(vs u0alxnmf3iytoa ean i t t2tr(m oydlm nlnvs t sDumx pot4tee ii3iadfm uanvo;u4arerif to1lmD  nvs s0s2uo(mpoo1olt mfvils)srtaxr no0tet ioeild m2um( p;()tetoxfcoadfpt aues t) exm(o3io1apenmfesa( s2uau pnt1oexnmfetat s2rlnms u) exnmr tatop  auvi s)srxoir3iydomenlivtlt  Drr(mo;u1oeeniieiasfm ua(vs;(0 ltoio3tydfa e nvi;t0t2xriopoy4altnmfvt s)srrrxmpnu1tptomocilslaDemn o;u4tltnxrciadfpDeauvslt0 rum(o3oy4lptelfci s  2rr(rpnu0opxomieildlm rl(mo ()tlxoif3tatlmtr u o s  euriopou1apee fvslsfa2ur( ooo4alxo o3ils s2rauvs (0trxnmocoo1op eaivslt0t2xo(m oo1ole mnctat s2tr(r ;t1oet iieiyd mDulnvp;t) rxoxf tytfa e ies t0 2um(opoudlle mfcilt)sDurum ;u4tpxoioeiydla uan pnt0aetnif3ty1fmtrlueo;s0sruo(r3iu4llenlfesls)arrrx oot4apxnmo3ildlaDean onu)altrif3tatlp   ues t0sexo(o nu1ap emnei s)srra(mpnt0opt  feils m rau s;t0arxomociytfat  ies t srxoiopnu1open feia()a2umuront0tlt ioctysfa umu snt4tltnxo3io1op e n sl( truoim oo1amt mivi (  rra( o;t4alenmfeiytlaDrlumo;(0arxomociydoat  iei s  eurir3iu4lm elicsas srrmx oou0tpx iictyd m2raumo;()aeeomo tydopt aieo;t)sexmimpnudape lnvt sfs2urx  ;t1oetoif3tas s emnvp;(0altoio todfa eanei s0 eto(opiu4om e iviasfa2um(rp;o0opxnmi3ild sDrm( o u0artrmr3tydomt livi;t) rxm(opnydamtelnetlsf 2rmu poo1openmo3iad mDuln snu4trxrmr3tatomDrai s s0sruo(o3iydlpen ivs s  rrm( onu0tpxnifctldla2el(mpnt4 rermo3iytomD luei s0tetm(m3nydopt lfcta( artr(mpoo0alx io3tas a2emnvs u4 rtomf3iatfpDrli ols0sexo(rpiu4op elivi (fsrtmump;t1opxoii3iadlaDua(vs (0trtnmfcoytfa eaivs;t trxrio3nydolt  fci (faDumu pot0tle ioctaslaDeln onu4 reomo3ootfpDr n o;t0 exoimpio4alt  icia(  rtau  ot4aeeomo3ildfs2ea(mpn(0 lxrir3iy1fpteaieo;t)trxriopnu4lle  fvt ()sDurxm nu0olen fctytls rmuvp t4 eenxr oydop eanvo s0t2xmiopiy4op nlneta() 2uaumpoo4tpt moetldla eanmo u)tetnmr oy1lmD  ivo s0tetmim3io4ol nliet s) Dtrurp;o1aexomieiysfs eaumsn()areomfcoatoa rlieo s s2uo(mpou1al emnes s)artm(mpnu1aeeo iciat s ranms;u0teenxo iodfmt  nvi s  rtr(m ny4lp  mfesas)aDumxm ;u0oetn i3ildlm ulu on(4 rtnxo iy1lm elivsls0setoir oodlme mnet tfa2taum ;t0tlenmieils aDulu p;(0altrxf3io1la rliei (  2xoxm io1omtn ics tfaDua(rp;o4oee
\ No newline at end of file
@@ -0,0 +1 @@
+ivo t0 etm(rpnu1op emici s  Durx ooo1aex mictasfa2ea(vo () eerir3oytlmD lueo t) 2xrxm3no1llt lncil(f rra( onu4aeenmfciyd s rlu o (0trxnio3ootlpD  u o s)trtoir oodlp n nes sf Dumx oou1oltniieiytls ul( s;t)aexrmo3iydlpDeln o t teumio3iy1amen nvta()srumur no1texoif3iytfs2ra(msn(0tltoxr oytfat anvi;(  eurio oodlmte netas)artaur ;o4oeenmi3tadlm2ua(vp u4 lxoxr3oy1lmDe n olt t2umxo3no1al elnctasf 2tm(m ot4alto oetldfsDrlu o;(0trtrxfcoa1lmD ln i;t  eumio nydlmtelfeta()srra(m ot4tpenioeiys a raumpnt0 renxf oy1fateanvils0trurir iy1lptnliesas)a2tmxmpnt1tlxo oeiatfsDuanmo t4trxrxo3tadfa raneo;t trxo(rpnodlp  mfvi s)arrau onu1tlt  ietas mDelnvs (4teermr3oodfmt  uvi;(  rxm(r3oydop n icils sDua(mooo4olt mi3iysla2umu s u)alxrxocoodom   ivs s  euoir iy4amtemnvsat  2tm(rpoo1tltnii3tysfs2ra(vsn()tltnmf3iadfa rlneilt0sexo(r3iu4omenlfvsl(fartrxmpoo4olx  oeiyt a em(mpn(0texnif oy1faDe uesls)s2umxm ny4lpte fctas sDtaxmont0aleomfciltfa2ulu p;t)texoio tatlpt luvs t0teuoxm3iy1olee fciat s2umu oou4olenmi3tyd s2elnvpnt4trermrciydoaD  ieils0trum(opiudlmt mnvs tf 2umx p;t1open oetadfm2ulnms;t0 rtoxr3iodopt aivs t  rtmirpoy1lp  lnvsa(faDua(rpno4tlxo fcildfsDulnvp;t0tlenmr3io1lpDrlivsl(0 2xoiopnydllenlfvta(fsDrmur ;u4tle mocilsfa el( snu) rxoif io1omD lu s s s2trxrpny4oltemietls)s2ua( p;o0olxn fctydls2rmn o;u4tlermo3ta1faD lneolt seurxo3iudopeelnet t)aDurxmp;o0olenmfetyt a2elump (4 lenxr3ia1fm ran o;s seumxm ou1ame  iesatfs2rau pno1tlxnmiciydlm umumsn(4trtoxr ootlm   i ils setm(o3iu1amtnmietas s2taumpou0apenmieiydfaDumnmp t0tlerir3totlm ean o t0setoxr oodlpeelfcils)s2tmx pnu0oexniociytlm2umu s;t)tltoiocoy1opD aieils0 rur(m3iydlptnmncta()arrru ooo4aetomictydla2rlumpnu4 renir tytfmD  uvo t) rtmio iu4olte nei tf rraurooo4olen fctadfm emnmp;()alxnif3oo1fp ran sls0sruoir iy1lleelneiasf rrm(mooo0openio3iatlmDua(von(4 etrxfcta1omD lnvs t0 exr(o ou4oltnmivtlt)artaump;o0tpeo oetlsfm elnvsnt)trenif3oo1oate uvsl(0seto(opnu4altn feiasf rumur ;u0aee  ictadfm rlnmp t) rxomfctytfpDe ueo;t)s2xrim iydam n ictasfa2rm(mono4aptn i3iat aDulnvp;t0arerxo tytfaD lu ilt)seurirpiy4lpe  nvsas arrruront0olto i3iat a em(vs;()arxomo tatomD ln o;t)srxm(mpiu4amtelicil(farur(rp;u4altn oetytfs uanms;u)trtoxoctatlmDrlivo;s  eurxmpoy4lmt mivt ()srumu oou0oeeoifciltls rm( s;(4 lxrmfcta1lm   ivol(0 2to(m oo1alenmicsa(faDtmxronu4tpt iictltfm2ran onu0 rtrxo oydlpte i ils)srtoxo3oodom   icta(f 2taum ot4tltomfctytla2emuvo;u0 eermf3iodop ean s t s2tmirpou4ame lfvsatfarumxr ;u1opt mi3iys m2um(mpnu0 ltnmfciydlpDrlu ilt0sexr(m io1apen fes s srua(  ;u4tlxnif3tatla elumpn()alxomf oa1fpDe uvi;t)teuoir iu4omtemneta()s2rrxm ;o0tlt mo3iad a uanvp;t)trxnif tadfm elnvols t2xoir3nu4omt lfvtas  Dtm(ro;o1tpx  o3ilsfa rauvs;t) lenmr3totlmtranvs;s0t2trir oy1omeemnvsas artru  ;o4opxoiieildfs rmnms t0alxoxf3iotoat  n o;s)trtrio oo4llt mfvt t)arrr(rpno0tlxn fetysls2uan s t0aexrmo3oa1oat an o;s trtoxr3ny4altnmivtas)a2uaurpno0opeo oeild m2rm(vp;u0teeoxrcootfat li i t) rum(o iydll  liciat)s2rruroou0oltnif3tasls2rau p;(0tlenxf3oatomDranesls0 rtrirpiodlm n ietlt)aDururpnu4tex  iciys m umn p t4teerxrcty1lp  lnvols)t2toxopoodapt  ivtl()s2um( p;u0tle ii3tasfm2elumsnt4 rtnmfciytfatr ivi;t0tetmim oo1amenlncsasf 2tax o;o1tlxomi3tasfaDrlnmp;u)aexomfcoytlpteaieo t)t2toxo ou4ll elnci tfsDrr( ooo1aptnmo3iltls2rm(vs;() rxnxocootoaDe u i s0 eur(rpiy1ll  livi s  2tm(mp;o4tet iociyt a2uan p;u0 eenifctatfa e n sl(0tetr(r3iydlmenmfci (  rra( oou1oexo ietld s2raums;t4altrmrciotlptrauei;()seumxo3no1lp nmfetlsfs2rrur ;o4aeeomoetytfsDra( p;t4trxnxr3oadfm e ies;()trxmirpoodomee ivsl() rrmxr nu1apt  ieias sDuanmp;(4areoxo3oodfaDrlneilt0 rxrxm3iydopenmnct s)srtmx onu4olt if3iasls2eln o;(0trxrxocoo1lat aivs;s) rurxmpiu1lm elnciltfa2taur nu4alx  o3iadfsDua(ms;t) etomocto1fp r n i t trxrio oudlptelnvs sf 2tmu pnu0oeeomieiasfm2ulu p t0trenir oadomDr u ils  eurxo3iy4apenlietl( aDrrx pnt0teenifeiyslmDumu p;(4teeoxr3tytlaDrau i s)srum(o ou1lltemnesa(f Dra(ronu0olto i3iltfa ra(vo;t4 ltnmociodlpD lu i t0trtr(opoo4al elnctlt sDrmu  nt4tpt  o3tydls2um( onu4aexomfctytlptrluei t s2xmio3nydlmt mnvil(f Drmur ;u1oee  i3iytfm rlnvont4alenxf iotfpDrlieo;t)srxrio iu1ame lnctls  2trumo;u4tlxn o3tltfa ean p (0altrxr oatfmDeai i s trum(m3nu1am  lfetlt)s2rm( p;t0oee ifcildfsDulums t0aeenio3todomtranei;t srto(rpnudlm emnesl( s2rru o;t0openioetadfs2umu o (4 rxrmo3to1lmteau sls)s2xm(m3oo4lltelfvs sfsDra(  ot4opx ifctys aDua(mo (0 rerioctadlmte nei;s tetrio ou4lle  iei s sDtm(mo;t0olt iociydlsDemumo;t0alerxr3iotfpte ues t setmxm ny4lp   fvs t)sDtauro;u1ope mfeiysla2eluvs;u4 exrifcoa1oaDeli i s0t2ur(r iodop nlncta()aDtaump;t0alxoio3iys a el(mp;(4treomf3oo1laDranvs;s0 rtmxrpiodlme  iesl(  2rrxm ou4tpxoif3iyt m uau snu0 lermf3iatfat lu s;(  exoxmpnudll  mict t aDrax poo0aee ifcias a ulumont4arerxr3oatla   n i;(0tetrxo nu1op  lfciat)sDtr(m ot4tetniocils a2rmums;u0 reoxf3iatfmteaieo;t0sexoimpio4lpe  nviatf 2rrumpou4tlen fetatlmDuanmpnt)artoxr oatfmD an s;s  2toir iy4ol elivt (f rtrumooo0opeo f3iasfsDeln on(0aetrmr3ia1op   ivo ()t2xrxo3nudlm emici (  rurur ou4tpto f3tlt sDeluvp (4tleomo3ia1op raivolt0seurio3nu4lpe mnviatf Dtruroot0tleomoctltfaDem(vs;(4trxomo tadfmtrlnvi s) 2tm(o3nudlmtnmnetl(faDraxr ;o4apto feiytla2umu p;u) ltnxrciy1lptrluvo t) rtoio io1olt  nes s sDurxr ;o1aexn fctadfm2ranvp;t0trxoxo oadfat auvo;s teumxo3io4lm  lncsas) Dumurpnu1tpenmoeild a emumo u0alxoxo3ia1lmte nvi;s teuoxm iudlleelfciat)srra(  nu0tptn fetasls2umuvo;(0 lxrifciy1la  au slt0tetoiopno1op n fet s sDrrx  nu4apxnio3iad sDumn snt4aeenif3tytop r n o;s0t2tmiopoy1amtnmfct t) rtm(r nt0tptnmi3ias m umumonu4aetomr3oadfmtrau il()t2xrim ny1apeemfvtl()artmx  ou0oetoiocild s umnvsnt4 rtnmrctytlateluvi;s  exoxo3nu4apee feilsf Drrumooo1open oetyd m2um(mp;u0 leoxf todlpteai slt0texrim3no1ome lncilt  rumxmonu4olx  ictytls emums (4tltrmfciotfat  uvo;t)sexmxm iu1aptnmivtl( aruaum nu0alt  f3ild m em(vsnu4 leriociytfmDeln il(0srtmio3no1lltelncia() 2rrumono1aetomieiatfmDranms;t0aexoir3iytfaDean il()t2uoim3oo4om emfvtltf rum(m ;o1opx ioetyt s2eln pn() rxomr3oatfm e ivo;s seurir ny1omenlict s srum(rono0tpeoif3tlt a rau p;(0texoxr3ta1la   iei t t2ur(o3iy1lp nlfct ( aDrru poo4tlenmieiydls2raumsnu0 exnir3ta1op  lu s;(  rur(o3nodopenmfesls)arra(r oo4olen f3iydlm ra(mo u0 eenmf iydop rlies;s  rxoxrpiy4lpenlfeil( srta(ront0altn iciydfmDrm( o;t4tltnxf iatom elieo;t0trum(m oo4lptn fcslsf 2umump;o1aleomi3iadfs eanvont)aexnxf iodomD anesls)sexoxo ou4ll  lfcsat sDurxmpnu1tlto fetydfmDum(mo;t)teeoio iytfpDeaivsl( trtmxm iu1ap nlnet s  rrmuronu4tltnmociydla2em(vp;t0tltoxo3oodla  li ols) 2tmio3iu4opeemfvtlsfsDrmxmont0oltoioeiysfmDua( pnu)artrxrcoatomDe ivo;t) ruoxmpnudlle mfeslt) Dtrx pot4ale miciyd a2emn s;(4 leoio3iatopD aueols)srxm(m3io1ole miei sfaDtr(m nu0apt ii3taslm ua(mont)trxnxrcoodlp rauvolt0t2xmxmpiodal nlfvtatfsDur(monu4tltoif3iltlaDumu s;(0 lxomo oy1faDe nvi s0 rur(opnu4olte nvilt)a2ururooo1oet mo3iyt a rmumo u4trtrxfcia1lp e n s s0srum(m3oy4llee fvt ()a2ta(rp;u1olt  i3iytfaDra( s;t) lerio tytfaDe uvo;s s2xoxo oydlpte ies (  2raum ot4olxnifciadlm ul(mp u4arxnmf tadfp e ieolt0sexr(mpiu4omenlnetasfs2umurpoo0aptn icildfa rmnms;t0 rxoxrcoa1fpDrlues s sruoio3ny4olte fctas)sDum(rpno4aetomoeiysfs rln snt) etnif3oadfa  aneo s0seto(opou4lpenmiei (f Duau ooo4apen icildlmDuln s;() eeoio3oodoatrli i;t0sexmim iy4aptnlnci ( s2raum ;u0oetn ieiyd m ranmp;t0 rtnxr oatop elivo;s) 2xmim ou1ll nlfvslt  2rm(mo;o4apx ii3iyslsDua(vo t0aexnxrciy1optr u i ()trxm(mpio4llen ivt s a2trxrono1aee io3iyt s eaumpn(0artnif to1oatelu il( t2um(mpiu1lp e ncsl(fsDraxr ;o4olx  f3iyd m rm( ont0texnmrcoodlp  auvi;s sruo(m3oodoltnlncilsfs2uaxmpnt1optnifciad s umu pnu)teeoxf tatlm  lu o t0t2uoxrpou4ope mfeta(fs2ta(r ;u4alxoii3ildfaDua( p u) eenxfcoytfa  anvs;s  euoirpno4lpt mnci sfa2trx onu1apeo fctatfs2ulnmpn(4 lerxo3tatlm rai il() eumiopiydomenlfvsl(fsDrrurp;u0tlxnmf3tlt mDum(vp u) ltnxr iydfpDrau ol(0texmxo3oy4opt lfesas  rtru p;u1openmfeiytlmDrauvp;t)trenxfcootlm ran o;s  rxmxrpiodlp nmicsa()aDuaxroot1olxnifciyd sDem( pnu0altoir3ta1lm eanvo;t s2trim3oy1ll elncsl(fa2rm(mont1tptoiiciytfa uan o ()treomf3tytopDeliei s0t2xoxrpiydape mfvilt)sDuax o;o1olt moeiadfm2em(ms t)artniocio1lpD aivs;t s2urim nydolee ietltf 2trx poo4tpxnifciasls ul( p;u)artrmr3tydfmD au sl(0teurirpiy1al  livi t aDrmxmo;u4aeto oeildlsDrmnvon(4 ltoxfcoo1oa  anvo (  ruo(opiudomeemfci ( sDua( ooo1aee mfeiadfsDul( o ()aeeoxrcio1fptrlnvo t0seumirpio4llen icsa(  Durumpnt4tpxnmoetysfm el(vsnu4altrxrctadopDe n il( sruoxr3oo1lpte fcsa()s2tmu onu0oexomoctltlmDum( o;u) exnmo iytomD lieo t) 2uo(o iy4llt mfetat)a2trx ono4apxnmfetlslmDua(vont)arenxo oadlmtelneo t s2trxm3iodomtemnci (f ruaurpnu4alt  i3tydla rlnvp;t4tetrio tydoaDr ueil(0s2umxopiy1ope  fci tf rtr(ro;t0tpx ioeiydfs umuvont0texriocoo1lp  lnes;t trxrxm oydomeemfetltfsrurumpno4tet  fciasfa el(mo () exomoctytfmt lneilt  eur(r iudlmeelncsas srrax pnu0tetn fciysla2eanmsnu4texoxr oytfmtraneslt)truo(m3oydope livi ( s2trx  oo1aetoioeiltfs emnms;t0trxrio3to1faD  uei s trxrxr iy1amt lnctat)a2rrur nu0aeeomietytfm eanms;(4arxrif oadom  auvs t srxoxr oydopen nvt tfa2rm(r ou0alxomi3tytls umnms;u0trermf oa1lpDr ivilt)s2xrxrpnu1ope mnvsat  rtm( p;u0tleo f3ildfm2ul(mo t4 etnxo oydfa eln ol( s2ur(r iu4alt  neslt a2trurpot4tpt iociltfm rlnmo;t4 lxnxf3ty1faDr n s t)trumio3oo1al n fcs t)artm(ro;t4opeomf3tas s ua(vonu)tlxrmr3to1fmDrluvolt sexmir3io1omen fctas srurxmpot1tlx mfctyd aDumuvs;t)tlermr todfa r ivsl(  rtoxm io4olt lici () Dum(rono4tex io3tad mDeaumo;t)altoif oy1fmDrluvs;s0srurir oudol nlfesa(fsrtrxrp;u1alt  feildfa2emnmont4tetrmo ootfp elneol(0 rtoxr3ou4ale  ncs (  Drmumpno0aetomicildla2um(mpnt4tltrmfciydfptr ueolt0t2uo(m3oo1alen fcias s2raum ;t0olt ifcilt m2um( o;t0tlxoio3oydomteaivi;t0 rurxo io4lpenlfcilsf rurur nt0tpe io3iyd mDelnvs;t) reoif3tadopD aiesl(0 etm(opnu4lmtnmivs sf rtrxrooo4optnmi3iltls uanvpnu)aeerxf3ootfm elnvi (0srtm(o oy1lpe mivs t  Drrxr ot4oex mieiasfs2ua( pnt4aexrxf3tatfaDeanvi t)s2um(mpoy1llenmieiat) 2um(  nt1teeomfeiysfm2rlu o;t)alxrxf3ta1laDeli i (  2to(r3iu1apee fesa()sDrmxrpou0ape  fctytls2eanmp t4 eeoio oo1faDe nvils0tetmxo oudlltn ieias)sDtaxmpnu1ape ioeildfa ra(vo t0tlerxfcto1fa rluvo;t0 2xr(r iy1amtnlfetl( arumu  nu0aleoioeilt s ra(vs;() etrmr tytom   ueo;t seumirpiy1lltnmnci (faDtm(mont4aleomi3iltlmDrlu on()tlxnmf ootoa   nes;t t2tm(r oydll nlfvs t sDtr(mpou0aexoii3iasfm rm(ms t)trtnxoctatfa rliei s)t2tmir oy4lle lnet t  2ta( ont4oexnmoetaslm2ranvsnt) rxrifciotlpDranvsls) rxr(o3iu1amtnmfci s)a2umxm ou0aee  i3tlt s elu p t0 lxoxrcoytopD aivs s0 2urio3ou4amen nciasf Dtr( oou0apx mociaslaDrl(vs (0 rxrmr oy1op elneo;() 2to(rpoy4optnmfvt ( s2umum nt0texoif3iys a2ranvp t4 exriocoo1fmDrau i s  ruoxo nydlltnmfviat  rrmxr ;t0tlenmoeiadls2el( snu0 ltnifcoy1lp  liei;(  exmxo3nu1lmtemicils sDta(m ;t1tlxnmo3tys mDem(ms;t)artoirciytfp  ai sl(  exoio ou1ll nmivilt)srtmxm ou0tpt  ietltfs ea( p u0 exnxo iotfm rauei;s0trxmim iodlm nmiesls  2ur(m ot1opxn f3iyslaDra(vs t4 reoio iadop  auvi ( t2tmiopoo4optemicils)a2urxmoou0apt io3ildfa rm( pnu4trxrmf todlp eai i s)s2um(mpiy4apen fesls  rtmu poo0apt ioetaslmDemuvp t0 etnmf3oodopD auesls t2umirpiodlpt lici tfarta(mp;u4ole ifeiytfmDulumo;t0arerxf todfm  auesl(0t2um(o nu1aleelfeta( srtr(  nu1tpe  ictlsfmDem(vo u)areoxf3oodlaDrluvi t)t2umio3oy1ome lncilt)sDuaxmooo0apt ii3iys a2ea(von(4teermfcoadomD aieol( srumxr nodom nmnvsl( arrmur ot4oleoioetysfsDumums t4aetoir3iatom r ueol(0 etmxopnu1llenmnvsl() rtrurpot0tpeoio3iysfa ul( p;u0arxrxf3oydlp eauvo t0tetoim nydalenlivi ()srua( pno0opxoioeiydfa2rmnvo;u0 leoxf oadopD  neo;(  rur(mpnodolenmivt s)s2ta( pno1opt ii3iyd s2el(msn()trtrio3iy1oat  ieil(0 exrxm3iu1ll e fvtl() Drrurpno1oleo oeiyd a ra(vp t0trerxoctydopteanvi;(  rxmim3oudolt  nesas  2ur(monu1tptoifeiad s2um(vsn(4tlxrxo3iadomteaivi;( srxo(mpnudalen fciasf Dtaum no1tptomf3tld aDua(vonu4teeoiocio1lmDraneo t t2to(opiudope lfvi sfsruauro;t0tlx mo3ildlm uauvs ()aetrxr3totfatrlnvs;(0texm(o iy1lm nlics t) rta(mo;u0ope iietadfm2uan s u)treoxf oytlpDr iei;s0setoxrpoodam e fcilsfa2tmumont1alx  o3tadlm ra(vsnt4aeerxocoadlp eln olt)s2xm(mpno4lpenmictls aDtaxmp;t0aptoii3iatfm umn onu)tlxoxfciatlp rluvs;( s2toxrpoy1olen fct s)srtmxr no0aee  ociasls2uan p;t4texrxocio1opD aivo;s0teur(m oy4llenlfci (f 2uaumo;o0tpto ictad a2em(mo t4aeenxo3oatomteauvslt) 2tr(r nu1lltemivs s)s2rmxm nt4tpt  ieilt s ea(mpnt0altnxrcia1fat  ivs;s s2xmim iydapeemnetls a2um(rpnt1tleoiicild m2rluvs u)aetnio3iydop rlnvi t)srumimpiudame mici t)a2trx  nu4alxoioetatfm emnvp (0tlxoio ootfpD aues;s0seuo(o oy4lm   icsa(fsDuaxmono0oltomo3iysla2eln o;t)arxoxf iatoa  luei t) 2tmxo ny1lmtnlies t  2tm(rp;t0tet mf3iyd m2em(vo;t0 exrxr3iytfmD luei;t)trto(m3ny1ap e fet s)aDrrumpnt1oeeniicildfs um(mpn(0 etrmr3ty1oateluvs;s0 euoirpiu1ame  icil(f Dur(rooo0tpt mietltfm2el(vp ()aexoxfcta1opDelies ()srtoimpoodaltemnctlt  rra(r ot1olt mieilsfm rl(vsnt4 exrmocta1lpDeli i;s)trto(rpoo4lmtnlietasfs2tau pno0open fciasfm2ul( o;t) ltrxocio1oa  livilt0 2urimpnu4aleemiei t srumu  nt1teenio3iad m2rlnmo;u)tlerxf3ty1lmDeln o s s2xoxr ou4opeemfciat srtm( pnt1apx moetasfa rlu s;(4trtniocto1oa elues t  etrxr oo1opt  fvta(f ruax p;u1tee ioetydla2rmumsn(0aeermf iodfa eanvils s2trxm3oy1olen iesas srtaxroou4oeto ictldfm2ulums;(4 ltnif ootlp eaieolt0 rxr(m3iy4lmenliet s  rtaurpot0oleo octltlm2el(vsn(0artrmf tatopt lu s (0s2trio3oydomen iviat aDurxmp;t4oetnii3iyt a2emuvsnu)alerio iatoa rluesls)s2trio io1lmenlieia(  rtr( o;o4oltn fctydlm2emn on()artoxr tatop rauvs;s)trumxo iu1omtnmictas)srrmum nu4aleo f3iatfmDeln snu)trenmo3to1opt au s s  rxm(r iy4apeeliesl(fa2ururoot0oexniiciatfmDrm(vo (0tltrxf ty1laD anvi t seurio iy1aptelies (  rrmumoou0tetoiiciasla rlnvs () etrxocoadlp  aivi;s0setmxm iu1lle  ivs (fa2ta(ront4tee ifeiltlaDeanvsnt)texnxrcoadfate ueo t) 2xm(mpiu1alt mnes (f Duaxmp;t0apxo ictld mDea(vp;(0tetrir3to1om e i o;s) 2tm(o3nu1aptn nesas  Drr(monu1aetoif3iytlsDuau s;(4tetnifcootopt an sls seto(m3iy1lm elnctas aDtm(mont1tltomieiyd sDrmnmp;u)trxnmr tytlm  lieols) etrir3oudop emfvi s)s2uaxr ;u1alxomo3iasfmDulnmo t) rerio io1fa   neo t srtr(r io1lmtnlncilsfarua(  ;o0tleo ietyt s2emn ont)trtoif3ootfp  livi;( trxmim nu1ll e feil()aDuaur ;u0texo ieils a rauvsn()tlermf tytlptrlu i;(0tetoir iu4ap elfcslt aDta( oot1aptoifeilt mDua(vo (4arxomf3iodlaDrlnvs;s0s2uoir iu4apeemfcs ()aDtr(mo;o0alenmoetat s2emnvont0arerio3tatoa elu o;() 2tr(r nu1lm nmicsls) rrmx pnu1aetomoeilsfs2elu p;(4alenxr totfateau s t) eumimpny4om e nes t  2rrxmpoo4oee  f3tat a uanvs;t0arxoxociy1op eln sl( trtoim iodlp elfvtl(farrr(monu4tpt  ocias s um(vpnt)areomocoy1faDrauei;()t2toirpno4omt  feils  rumurooo1optomfeias s2ua( s;t0tetrif oo1lmDeai i;t0 eurirpiu4oltnmicsa()aDrmxroou1oetnio3iyd s2ul(vs;u0tlerio ootlptr uvs;s0t2xr(m io1ll  mivtls)aDrm( ono0oee iiciydfm2rlu s;t0texnmr ty1fmt an o ()seur(mpiy4ll e nviat  2ta(ro;o4tetomfcias aDulu p;()aexoxfcoodfa  lieo s0trxmxm ou4om n ivtl( arumx  ;u1tlt  feiltfs2emuvpnt0 ltrxfcoy1fmD  i s;()texmimpou4olt  ict () 2tmurooo1apeniiciltla2uanvpnu) exnmr oytfpD aivils setm(m3no4lm nmfcsatfa2urx p;t4tpe ioctls sDulnms u0arxnmo oodfmt an o;s0s2xrim oudomtnlfct sfaDumxrpot4teeomo3tys m umump;u0texnmf tadfatelues s0s2umimpnu1lptnlivsas  Drmurpnu0oet miciyt s ua(mo;t0 rxrio3iodla e ivsl(  2xoiopnudoptnlivi s aDua( p;t4opt iietltfaDrl(vonu)arxrmr3tytlmDeau s;(0t2tr(mpnudolt mivtls)aDtrxr ;o0tpe mfctls a ua(vo;t0 lxomrctatopD lnvo;s0s2tmxr io1ap emieiat a2raur ;t0olt  o3iysfs ranvpnt0aetrifciy1faDeaueols0 2xo(r ou4omtemiesas  2umu pnu0olenmfetls sDrlnvo t4arerxoctotomt anvsl(0 2xoxm iy1llt  nvslsfa2uaum oo0alxnmoetldfa2ua(mp;(4tlxrmo ty1fmteauvs t0s2toirpny1am nlfciat aDtmxrpoo4aetomoetldla um(mpnu)alxrxr to1fmt anvi (0 rtrxo3oo4amtemietl(f Duaxm ;t4tleoifetaslsDul(ms u)texnmo oa1fat aivs;(0setoimpiy4al  mnesa( srrruroot1apxnmfciatfs2ul(mpnt)artoir oodla rauei;t)texm(o3iydlpte netl( artau  oo0tlen fctltfm2eanvo;() ltoxfcootfmtrlues;(0 rxmir oo1apeemfvtat) 2trx onu4altomf3iytlm2emuvon(0 lxoxf3oytop  li s s) etr(r3iydomtn nctl()a2urxmp;o4aeenmf3iat sDulu p (4 lermo oo1lmD aieilt0truo(o io1ol e fci s  rrax  no1aetn feilsls2ua( o t4tltrio3todlm eauvi;t)s2to(mpno4om  mfct tf rumu o;t4aexnio3iytlmDemuvp (4artrmociydfmte uvs ( seuoir oudom   ivi sfartmxrpou4ale if3tat m ul(mont4aexrmr3oatfa  an o;t)tetm(m3nodolenlfeslt)sDta(r oo4opxo f3iltfa eluvsnu)aeeoir3tadopte ieo;s t2uoxm io1omeemfesas aDtr( oou0olxnmi3tyd sDelums t4teenmo io1opt an o;t)texrxr3ou4llen ivs (f Dumumont0texoiietlt sDeaums t0alxriocoadoa  auvs ( tetoxmpio1om  lncilsf 2umur nu4oex ifetysfa2rlu p t) eeoir3tydlmDeau s;(0 2tm(rpiy4op   ict ( srumx p;t4olt mi3ils mDrln on(4 eerxf iotlmDrluvsls t2xmxo oydop n ics t)sruaxm ;o0oetnio3ilt s eln o;() reoxrctytopDeln olt0 rxm(opio1ap emieslsf 2ur( onu1aexnmfeiadfa2um(monu)trenmf3io1fptr ueo ( t2xr(m oydlptemictls a2rmx o;t1oetn feilsla2umnvs t0texoxr3ootomDelu o t0t2xoimpiodom elnvi s)srtaxm ou0alxomieiydla2ea( snt) lerxf3oydfaD aneilt)seuo(opnu1lptn ncsa(faDrmxmono4aptnio3iad s emumo;(4altrmo3totlmDrai o;s0trtrxmpoo4ap nmfetlsfartmumoou4oex  octadlm rmnmsnu)arenircoytlaDe n i (0s2xm(o3ou4lmtn nvs s) rurum nu0aptn ociat a um(monu4tlxnxfciodfmD  n i s0sexo(r3oodolt  ietat sruax  ;o4opxomiciatfa um( s;(4 rerir oodlm ran s ( t2xmxm3io4op  mfeils)a2rm(monu0olx  i3iadfa2ean p u) eenxfctodlpteaiei ( texrxmpiy1lpt miciltf Duru o;u4aeenifciltla2ulnmo;u0tetoif iytoate i olt)s2xmim no1al n fcsl( srrmur nt4texoiictatlm uauvp (4 rxnxr3oa1fmtranvol( t2xoxmpiy4alt  iei s)sDra(  no1opt ifetyd a2rauvs (4trtrif3oadfmtrlivo;s0trur(o3nu4ame lies sfarta(  ou1ape  iciytlsDea(vp t0texnircia1opDrauesls seur(m3iudomtn fesa()s2um(rp;u4apxoifeias aDra( on() renir3iy1lpteau sls0 2uo(r3ou1apeelnctls srurur oo1aptn iciydlsDelumo;(0tlerxf3ta1op   uvi;s srtmxm ny1alenlfeil( sDraurpno0altnmieiyd mDrln s () eerxo ia1opDr uvi (0s2uo(r3iy1alt mies tfaDrm( p;u1alenmo3iyt sDrl(mp (0alenxo3iy1omD  n s s)t2toir iudalte fvslsfs2rmxr ot1ope if3ils mDelump u4 rtrxr iy1oa  luvs t s2trxm3oy4olen nvsas)aruaum nu0tpxomf3iat m umnvpn()aeeomocta1fpDelnvols  rxrio iydllenlnvt t srtrur ou0olt miciadfsDemn s (4arxnmf tytomDraneil( trxo(o3oo4lme  ietls aDta(moot1tpe micilsfs2rmuvsnu4tlxnioctatfptrai o;(0 2xoxr iy1lltelnvsl(fsDraxmo;t0ape iociltfa2ul(vpnu4trxoxf3iatfa r nes;(0tetoxm oydamt  fcia() 2tmuront1tpxoiicias aDemn p (0 etrmfciadfmD  ueo t0 2toxr io4om   fctat) 2rrx pou1texn feiatfsDraumo t)artoif ia1om e n il() 2xm(r3io4lleelnvt s) 2tr(  nt1ape ifetyd m2ran s (4aexoif to1la  ln s t trumxopny1oltnlivsat)sDrr(mooo1tpxnmfeiytla emnvp u0tetoif3to1fpt livs ()s2tr(rpnudope miesl(f rrmu ont0tet  ictat aDeauvsn(0tetnmfcoatlatelu s;(0truriopio4opt lncsls)s2uauro;o0optn oetldfm2rau s;(4tlxnmfctotlatrlieols) rtmxopno1al  mieslsf 2ur( onu4apeo i3iydfsDem(vp;t0 reoxo iatoaD an ol(0texmio iodol emnvs () rtm(  no1oeen o3iytfs2emnmo u)teerxo3iatla eluvsls)t2umxmpnydllt  neiasf rraurpno1ole  ieiys m uanmsnt4altrirctodomDr nvolt0seuoxo3ny4al n ietl()aDra( pou4apeo ietltla ean s;()trxomf3todomDr nvilt srurxr ou4lm nmfviat)s2trumpno4aptnmfciydlaDulu p;u4arxnmo todlpDean i;s0t2xr(o iu4lpe  neilsf 2tr(ronu1teeoifeiyslaDua(ms;(0aeeoxrciy1opD  i ols) 2tmxo3oy1op n fvtat srurxroot4tpenmocilsla eanmp;()areomrcoy1oaDrauvil( sexo(m3nudomenmietl(f Dumxrooo1oltomf3ilslsDrln s t0texnmf iotfateaieil(  2toxrpoodaltnmiesa(fa2tmxr ;t4tptnioeiadlm em(mp u)alxrir ty1fp  ln ils)texmir oodopee fcsa() Dtaurp;u4tee iictydfsDea(vp;(0 lxomf3ta1fmtelnvs;( sruoir3oudlp nmfcs t)arrr(m ;u1tex mfeiaslsDuauvp t4 ltnmr iatlmt  nvs;s) 2tmirpnudllt  ict ( s2uau p;u1oleo ieiydfmDrau pnu4alxomf io1oa r u s s0 2xo(o3no1olenmict ( a
\ No newline at end of file
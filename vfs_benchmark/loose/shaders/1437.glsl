@@ -0,0 +1 @@
+uvslt  2xr(m ny1llee ict t)aDua( o;t4oltnmf3tatlm rl(mo t4alerxo ty1fm eluvsls)t2uoxr3oodomtn ici tfa2rr(roou1opeomicilsfm2elnmp t) rerif3iodlp  anvsls  2xriopoo4ll n icilt  Durxmpno1tpto ieiysfa2ulnvont0 reoxfcia1lpt liei;t0 2urxm nodlpe lfetas)aDrmxrp;o1tpt ioeiltfsDrln o (0 rxrmr io1opDrlu ols  2urio3no1ll emfct ( sDtmu ono4oexn fctysfs2emuvs t)tetrmf3oatfateluesl(0t2xmir iudlmenmfvias a2urumono0tex mictyt s2emuvpnt) eerxf iatfpD auvs t0srum(m oodlpt  icsatfsDurxm nu1olx  fetydlm2rm(vp u4tltoif3iydlpDeanvo ( s2to(opou1ol nlnet s  2ur( oou0aexo iciydfs2umuvp;t0altoxr3oadlpDrluei;t)seuo(o3oudope  ies tfsrum( o;o0oeenifeiys mDrm( p;u) lxnxr oydoate iei ()s2to(rpno1omee ivtat a2rrxronu1tlxo ieiydlm eanmp;u0 rxoif todlp raivol()trxr(mpoy1lmee fcs t)srtaxmo;u4ole mfctys a2rm(mp;u) etnir todfmDelnvolt0 etoxm oy4ope  iet s)srurxm ;t1oeto f3iadlaDulnmont0treomf3to1lmtrlivsl()teurirpny4oltnlncsls  2tr(  oo4aet ifeiysls2ra(msnt0artnir oydlm eai o;s) euoxr nodaptnmivtatfsDrm( oot1apx  oetad m2ranvo;t4aetrxr3iadfa  livslt  2toxo iy1om nmivi ( s2rm(mono1apto iciytfs ua( p;(0 rerif oatfa elnvil() 2tr(m3iy1lpt  fes s  Drrump;o1apx ifciyd s ranvo t)alermfctodfmDr nvo (  rxo(o3no4oltnmictlt) rtaxrpnu1olenif3iasla ul( ont0alxoxrcoa1omDelu o s)srxo(opnu1opee ivsa( aDtax ono4tltoiocilsfaDemnvp;t0altrxr3oydlaDe ies s trur(o3ou1lmt livt sfsDtrurp;o0opxomoctltfa ran s;t0 lxrmf3iatfp eaneo t0trurir iudlmt lict sfsDtm( pnu1olt ifciydfsDea(vo (4 exnxf iodfatr ivs;t0trtrxr iy4omt mfcsatf Dua(  ot0tetnmoetyt mDrm(vpnu0arxnxr3totfp rlu ol()truoim3iudom  mfci ()arumxrpnt1ape iociatfm eln snu)alxnir iy1oaDeluvils0t2xoio3oydop  lnvt sfsDurump;u1tpen fciadfa rlnmpnt)altrxfciotopDe n sl( s2ur(rpoydomtnmnvtls) rrrump;t1tlt iiciasfa emn onu0 etoxrciatfpDelneslt trtmio3iu1ole  fcs (  Dtm(r ot4aexnio3iadlsDel( s;u)artoxocio1laDe uvilt)s2xmxm3ny1omee ieiatfsrrmxmoot4opeoiictasfm uluvsnt0altnxo iodfmDe ivols0seuoxm3oy1llen net tfarta(mpot4tpto i3iys aDel(vo;t0aexoxrcty1om e ivil(  2um(o3iu4omt lieta( arumum nu1opt iocildls eln p;u) rtrmf3tytlp rau o s0 2tr(m3iodlp emfetatfs2rr(mont0tltn oeilt mDelnvp;t4tlxnxr3oa1fmDr nvi;()s2xmxo nu4amt  fet ()a2urx  ou1teen f3tydfaDrm( ont4aetnxf3oatoaDrln o (0 exrio3oodlltnlfetat)artaurp;u1optomfetydlm ean s u) rtrxo3oydfmt aneol(0 ruoimpnodalenlnvils)a2rmumonu0teen ieiydfmDran s;t0tltnmfcoy1lptrluvslt0srtoxo iydlptemici (fs2umu  nt4oetnmieiydls um(mp;()teenir oy1opteaues s0sexm(o iodlltelncsls)s2rmu o;t0alto o3iytlm2um(msnu4aeenxfcoadom r uvols0s2xoim3nu4ameemfetls a2ra(rp;t4tltomi3iad sDran o u0aeeoxf iytomDran i t)s2tr(mpou4lpenliet s a2trx oou0tptnmociltlaDem(mp u0artomr3oytopt an sls0s2uoxm3oo4lm n fetlt  Dtm(mp;o4aexnmi3iasfa umn o;t0 leoxr iydlmte n i;s0 rurim oodalt licia( sDra( oot0apen ieiltls2umn s;t) lermf3iodfm eauvol()srxmimpoudal  lici s)a2tm(mpnt0oeeo ieils a el(ms;() exoir tadfatraivo;t  rumio io1ameelnvsas)sDumu o;t4tlx  ictydfs2uanvsnu) lenir3io1lpDrai o (0trxmir3nydal   nvil( s2uaumoou4oexoioeiysla umnvonu)tleoir ootlpD aivs t0t2urxr oodameelnvsl()sDrru pnu0alto iciadfs2um(vpnt0tlxnmo ty1op e nvs;t) ruoxm oodopeemnvtl( aDtrurooo1aexnmo3iyt s eanvo;t) lxrxr3io1lateaneols)t2xo(m oo4omee fes t)sDururoou4texoifciltfsDrlumonu)teermoctotomDeaies;s0t2xm(r3no4lme lics ()aDtmxmonu0alt  i3iat aDel( sn(4aetrmf iydlmDean s s)t2trir3ou4olee net t)a2rmxmpno0olxnifciasla ra(vs (0 rxrmocta1lp  livols)s2uoxm3nudame licilt)aDrrurpou0opx mfctatfa uauvp;(4 exrmfcootop rli ilt teuo(r nudalte ivilt) rurumo;u0apxoifciydlaDranmo;t4alerir iadlpt ln i;s)s2uoiopno4llt  ivtlsfsDtaxmpnt1tlxoifeild aDel(mo (4aexrmf iy1oa e neilt)texrxm nu1al nlnci (  Dtr(mo;u1tltnmietydlsDemnvsnu0treomfcoa1lp r ies s trxrxmpny4ap n nvi t)aDtrum oo0oleomo3iad a2el(msnt4tleriocoodlateaiei;s) rxoio3iu4lmtn ies tf rumx ono1tleomfciatls ranmpnt0arxnxo iytfaDelueo;t truoxo oy4apeelncsl( sDurxront0olenioetad sDumu o (0 lerio3oytop  aieo;t s2uo(opio4ameemnesa()sDrru poo4olto fciydla ulums;u) rxnmociydoa ran sls srxm(m oy4lmenlfcilsfarumump;o0olxn i3iytfs rlnvs;t4aleomr3iatfmtr iesls)s2uoxmpnu1omenmnvi s) Dtm(ronu4opxoii3iasfmDra(vont4aleoxf3ia1lmDelu o;s) etr(m io1ap emieiasf 2ua(mp;t1altnif3ildlm rl( s;t)artnxo oatomte uei t srum(opiy4lmt mfvi s sDtrxmpno0tpx  octysfa2em(ms;t0 lxnxf oo1lpDr i i;t0 etrirpio1amen fetatfsrururo;o1altomicildlmDrl(vs u) renmr iadlptelueils) rur(o3oo1lm emicsa(f 2rmxm no0tpto ociytfs um(vsnt) rtrio ia1lp r neo s0texrxrpny1al e ictatf rraum nt4oltniiciyt m rmnmp;t4aetnircoytlpt aieo () etmiopoudam e ivia( sDum( onu1oexo ieiadfaDumnmpnu4alxrxf3iadlat  uvi t tetoxr oy4lm nlneil( sDtru  no0tptoiietls aDeanms t)texrmo iydlmtelueo;( texo(r io4ol nmivsatfarrr(m ot1aptnmictysfa2rlumonu0trenxfciadlp rln i ( srxo(r3iu4lm nmfcsls  2tmx ont4alxo oeilsfm rm( p (4treomrcoy1oat li o () eum(mpiy4lmte ivsasfs2trump;o1ale io3tldls2ea(monu0arxniociy1fm eai il(0texo(o nudome  icsa(  Dtrumpnu4oleoiicilt m2uaumpnu)aeenmrciatfmteai i;(0trtmxr3oy4lmenmfvsa(  2umxrpoo1aexniietyslmDea(vp t)alxrir oytfat  i o s srxrxo oo4lmenlfvtat)srraxrp;u4alenmictysfa2rmumpnt0 etrxocto1la eaies ( t2xoxmpiy1lle micil( srrrxmooo0aet mf3iatlsDrau o;(0aeeoxf iytfm eauvsls trtoirpnydoltemfetlt s2tmumpou0tlxo oetadlm2elu o u)artoif3tytomtrliei;() eumxo3oodaptn nvtat s2ta(moou1tleomo3iyt a2ul( p t4trenmr3ootlm e ivo t)srxr(m ny4lpee ivias)srtaxrpoo4tpen ieiasfm2um(mo u)trerxrcootop rlu sls)sruoio3ou4lmtelnviasfsDtru pnt4oex iociadfsDrmuvp;u4tltnxo3iodlatr nes s0s2xoiopio4ol   fvt t  rua( o;u1tptomo3iyt m2umnvon()aleoir3oy1lat anei s0s2xo(r oo4lmtnmicilt s2tmxrpoo0oleo oetasla eauvs t0trtoifciy1lp elnvo s t2tmimpnodlm elnetat) rra(root0tltn ieiatfa2em( p u0 rtoifciadfptrlivilt  etm(o nydomtn nei s arrmx pnt1optomieiatlsDeau s t0tlenif iytfpDr i o t trxr(o iodomte fvtatfsDtauronu4tlxn iciydls2uanvp u) lerifcootoaD anes t  ruo(opnydamtn ncs (farrmx onu4tet  iciyd mDranmo u4 eerio tadfa eanei;t0s2xoio3no4olenlneilt) 2tr(mono0aeto i3iys mDuanvp u4alerxr oo1lpDeln o;(0 2tmxo iu1ap  lies tfsDraxr nt1optn oeias m rmn o t0altomf oydlmt  neolt seumxrpoodap  lfesas  Durxmpot4apxoioctltls eau p t0texnmrcty1op   i o;(  2umxo3ny1lptelneiat) rraum ;o1apx ifctlt a eaums;u)trtrmr ootomtraies;t) exrir iydlmenmfvils  2ta(m ;u4alx  o3iadfs2ul(vp u) rtoxrcoydlaD auvo;t)t2xmirpoo1lp elies (fsDrr(m nu1apt mieilsfmDrlumsn()aeerif iydlm  lueslt) rur(rpoodoltn fcias s2rmu pno4oexnmi3iat s2eanmsnt0 rtoir oodfateluei;t  rxrir3oydoltnmivsltf rrm(  nu1apenmfcilsfmDua(ms u)altrioctydfptranvi s0 rurxm oy4am  mfvsa(fartaxrpou4apenmieiys a2um( s;t4aleoifcio1fm eaieol(0srum(rpnydlpeelnct t)sDtaurpnt0ole mf3iyd a2ul(mp;(0 ltnmf todom  lnes;(0t2trir iu4lmee fcia(fsDtmuro;u4tex iociltlm2elnmon(0altrmo3ta1om rlneo;t0 rxoimpny4llenlfeiltfsDrrxr nt4aex if3iydlaDua( p t)aexrifcoa1lm  livi;t)srxr(r nydlpeemfvtat) Dum(ronu1opxn ictls s rlnvonu) rtnxf3tadoa r iei s trxmimpiodlmtnlfvia()aDumu o;o4tpeoifetytls em(ms t4 renio3oatomtrlu sls srumirpio1ape  nvtls  2tmx p;u1opx  fetadlaDeauvs;(0aeenxoctatomD  nesl()s2tmxo oy4op  liei t)a2tr(m ;o4texoiicilsfmDum( s u4 eenir3tadlp e n s t srumir3iy1opte iesltfa2rmu  no0oetnmoetlsfmDeanmp;u4aexnif oodlmt ln o ()s2tmir3iodomtnlneslt a2raum nu4aetn ictysfaDea(mp u0tetoxr io1faDr nes s trxoxopno4optn icsat)sDuau  nt0tltn fciysfm eaumo t4 lenifcio1fateaivo t0t2xoxr ou4ole lnvt tfsDumur ;t0tet ii3iysfsDemnmp;u)treoircoo1fmt lies;t setoiopiudameelict t)arra(mpnt0optoioetltfmDrm(vp u4arenxf oa1fmt lneilt0srxoxm3io1ol nlivi t  Dta(mpou0tpxnmociadfs2emu onu4teeomo3io1opt auvi;(0texrxm oy1lleelfct () 2tax p;t4oexoifeils m eln pn(0texoxr3iotomtean i;t)s2ur(r3iy1om  lncsa()aDtrumpnu1oleniicils s rl( o t)aeeomo3ootop e uvi t  rxm(rpno1lp e fcsas  rur(ronu1olx  f3ias m2ulnmo t)trtomo totlmtrluvol()trxmxo iydll n ivtlt) Dtrx p;u4aexomoctatfs eanms ()arxoio iotomte u o t) rtrxm iydapee ivsatfaruau pnt4tltoifeiatlm2rlumo (0texomf ia1faDr nvo;(0 etoir3oy4op  lnet t  rtm(rpou0opt  ieiatlm2uauvo u)alerir iatop e u s s0 2xoir3nu1lm nlnvi ()aDrrurpnu4optoiociysls el(vont0 etoxf3ty1fpte ieo;s  rumxr3nu4lpenmfvi (farraxr oo0aet iieiad s eln p (0 etoxo3ia1fp e u sl() 2xrxo io1olt  neiat  2rrxrpoo4alen ictatlsDeaums u0aexnmfciodlptr ueols) etr(m3iudll elics t srur(  ot0tlx mi3iad sDua(mo (4arermr3ty1lpDeli s t0 2um(m nu1apenmfvi ( a2rmur ;u1tetn fciltlaDraumsn() rermf3tytlatrlnvi (0srxm(mpoydamtemfcslt s2ururooo0oeen f3tlt sDrmu ont4tltnmfcoo1lp elivols0t2xoir3oydap emnei tf Duaurpnu4opxniietasfmDumu s u0tleoxf ootlmDrlivol()t2xrir3no4lle lnes s a2tr(mo;o1tee iictys m rmnvp t0 rtomo3oodfpt ln s t)trtm(o3ny4amt lnvs tfsDrr(mpoo4ale mf3ilsfsDemnmont) lxnir oytoaDeanvs;t  exriopoodolt lnvslt s2rr(moot4tetomo3iydfaDrauvp (4artoiocoytoaDeauvs;(0trto(m ny4apee nvsa(faDtaxrpoo0tpxomfetldfa2ra(vpn()treoircoodfmt lnei;t0 2toxo iudomee fvsa(  2raum no4tpe ifeiytfs2umu o t)tlxomr3oy1fptelivs;t trxoim3oo1lleelfvils) 2umxmoot1opx  ietls s ea(mpnt0aetrmr3oodlm   uvi;s s2xmxm3nu1lpte ici ()sDurx p;u1aee if3iltla2uln snt0tlerirciodoa ranvolt0 2xr(r oudome mnci t s2tmxro;o0altoifeiasls ra( pnu)teenmfcootfpDeaneols)teum(r oy1llt mfcil(fsrumur nu1apto o3ilslm rau s;t)texnio iatopD lu olt0setoiopio1am emneia()sDururont0tptnifeiasls rlnvs u) rerxrcootlaDrlieolt)s2um(rpiy4ol e nesas)a2rmxm ot1alen feiytlm2uluvont4trtrmocoytlm e n o;s) 2toir3oy4omeelnvsat)srra( pnu0alx io3iasfs eauvo t4teeoio3tatla   uvo ()t2xm(m iy1om nliei s) ruau  nu0teeo ictydfa2ea(vs u)tlerir oydomDe nvs;( teurim3oudap  licsltfsruaxrono0oeto ieilsfsDem(mo;()trtrir oodfm eaues;s)trxr(m oo4optnmnes t arta( pnu1oetnioeiad sDrm(vs t4alxnir iytfpDe nvo;( t2xmxo ny4optemfct sf rtmur oo1texomicild s eanmp u0altrir oa1la   n o s)sexmxmpiu4olte fcilsf rurx pou0texnioctldlm2rmnmont0 rtrmrciy1lm   neilt0setr(opno4lme lieil(  rum(mono0aeto fciad a2um(vsnu)trtomf3oytfa   i o t0tetmirpnu4ap nlnvtl( sDua(ronu1opxoioetlt a rmn s u4 etrxf to1lp   ivsls trtrxopio1lmtnmiesl( arumuront0apeomicias s ra( snt4 reomfcty1om r n o;t0truoiopoodlpte ivsa(fsrtmumooo0aeeoioetysfs eauvp;t0altoxf3tadop   neilt)srtr(mpoy1lmenlfetls a2taum ;t4aet mfeild m elu s;u) etnif tytlaDe ivo;t teum(m3oo4lptnmies t  2umump;t0teeo o3iydfmDuanvsn()altomfcoadlp e uvo t)s2xoxm3ou4om  lfesa(fartmumpnt1tetnmoeiaslsDrl(vs (4tleomf iytomDelueo;(0trumxm3nu1om   nesl(faDumx ont0alt micilt a uln sn(4trxoxo3io1optr nesl(0trto(o3iudlp n feta(f ruau pot4tlto ociltlm2uau on()tltnircoo1lptelivo;()t2uoimpno4alt mfvilt) 2rr(mo;t4alenio3ias m uanvs;(0aeerxo ootomt  neo;s)s2tr(m ou4al  liesa(fs2um( pno4oexnmoeiasla ulump;u) rtrif3ta1latr i slt0 2um(r3nu4alee nviat arua(mp;u1altn octaslm emnvont)areoir3oydoate u ols texm(o3io1ll e fvias s2urur ou4olenmi3tytfa2umuvonu0 eenmo oa1om rluei;s trxo(r nodaltemfvil( sDumum nt1tptoifetysfsDul(mo;t0alxnxoctatop r u ilt0teum(r iydlptn fvtasf rtm( pno4tpe if3iat s eanvs t0 lerir oa1lp raivs t) rxrxopoy4open fciatfa2ta(  ;o1altomociydfs2emn o t) eerifcoydfmD aneol(0 ruoxo3oydlptn fci t)a2uaxmpno4tpxnifcils a2ranvp;() etrxoctytoatrlueolt)trtoirpou1olt  ncsat)srrm(m nu0olx  ictaslaDemums;u)aeenifcia1lat  uvo s) 2xmirpno1amtn nvt s  Dtaxm nu4teeomi3tyt m ranvpnt)tetnmo3ty1faD  nvi t)t2toxmpoo4lmtn nvi s)artrxm ;u1opx ifeild a2rluvp t) lenio3tadfp rlu il(0teumxo iu4lp  mneta(f rrmx  ;t4tlt ii3iydfsDel( p;t0tlxoxo3tadfp  aivo t  rurim nydamt  neilt)aDrrx poo1aexnmoeils m2eanms;t4arxnxo3tydop  anvolt0seumimpoudamte ncia()aruaur ;u1teeoioeiadfmDulnvo;u0 reoxf3tadlpDe u i ()trxm(m iudomeelieiat  Dtr(m ;o1tptniietasls ul(mo t)tlermrctotlptrln olt)t2tr(rpnydllee icta(f Dum(mpoo4olxoifctatfaDeauvp () lenmocio1fa r ieo;s0 rtm(r io4lmee ivt sf Dtr(r ou0tlx mfctlt m2eauvs t0altrmr oy1opDr nvol(0 rtrxo3iodlltemnesls artm( oot1ale  icilt a ulump;t0tetoxocoa1oatrli o s trxoxm oy1opeelnvia(fsDta( ont0opxo o3tld a rauvs t4 eeoxociy1oatrluvils) exo(o3ny4ameemiviasf Dum(mpno0tpenmo3ias aDelums u0tlerxf3ta1oateau ol()texmxo3nu1omtnmnvi (fa2rr(  oo4texn fcilsfm2ulnvp () rtomr oo1oaD  uvs;(0truo(rpnydalt  fvias)arurumo;u1olx moeiat s rmuvs;t)aexnmf tatlp e nes s t2xmir iu4apeelicslt s2rr(rooo1aet  i3tld a elnvpnu0 exrmr iytfp rli sl( srtoxr nu1am  mfcil()aDrr(  ;t4opxnioetldlaDuauvo t0 renxocoa1oa rauvs;s sexr(m nydomeelfviasfsrrr(ro;o4tptn oetys s2rluvs (4texnif3iodlpDeln s;( seumiopny4lmtemfei (fs2tau o;u0oet  feiad mDra(vo;u4artrmf3iydfa raies;(  ruoir3iodom  lnvsatf rrr(r nu0tptnioctydls2eaumsnt)tltrmo3iadoatr n o;(0t2tr(mpnydlptnlfetasfaDuru o;u0alxomo3tld s2eanvs;u0alxrif oadfa e ies s)trum(o3oodlmt mnet s) 2ua(mooo0olt if3iys s el(vpnt4tlxnir tydfa e ieo (0trumimpoy1alen ivi tfsrtmxro;o4apxoio3iadfa2ua( s;u4 lerxf oytom elu o;t  2tr(o iodlpt mnvslsfsrurxr no4teenmfetlt a2uanmo t)tltnmo oy1fmt  ieil(0t2tm(r iudlpe  ieia()sDraxmono4tpe  fciyt a umu p t4aetrif3iodlmD anvil( s2xmxr oo4aptemivt t srum(r ;t1texnmo3ildlm2raumo;u0 rtoxo ty1oatelu s t texm(opoo4lp elivi t) Duaxrp;u1alen f3iatfs2umnmo (4treoiocootfa eau o ( trtoxmpno1ape  icsatf Drr(r ot1tpx mietldfm umu ont)tetoio iodop  au ils)teumir nudlpenmfes t)aDur(r ;o0aeto i3tlt aDua( o;t4trerxfciotopt  n sls)s2urir3oo4om e fcs ( sDuax pnt1opx  iciydls2eauvo;u)arenir3oytlptr n i;s)srxm(m3oy1amt lnci t sDta( p;t0ape  oetlsfs2rl(vsnt0 reoxrcoo1oaD aivs t  rxriopnydal nmict s  2taxmooo4apt ifciyt s rau pnt4aetoxfciytoatr ieo;t)trtoxm3io4lpe  ieil() rtrx pot4oexoio3ias sDua(mon(0treoxr3tytom eanei;s)setr(m3oudame miei s) 2rmxmono1tleoiocilslmDrmnmo (4tlxoif ty1laD liei;s0 2xr(opiudamt mict s)srtr(rp;t1tleoif3ils sDrl( o t)altnio oydfp rli o;t sexo(m3io1apt licilt aruaxmp;t4opeomi3iysfa2elnmpn(0 lxnmf to1laD aues;t) 2xr(o iy4lm nlncsa(f 2rrxmo;o1opxo f3tadfa2rm(ms (4 reoir to1opDeauvol( t2umim ou4al elies () 2rrx  nu4openiictatlaDrmuvs;t4altnif3tydfaDrlueils0texrio iy1opeelnviat)sDuax pnu1tleoiieiyt a2eln s;(0teeoif iytomtr nesl()s2toxo3oodolee iei ( s2ur( p;u1ale if3tysfm umnvon(4teeoxocoytlate u o;s)srtm(r ou4lm nmnvtatfsDra(ront0aexnmfeiytlm eauvp (4areoif ty1lmteln s;t0s2umiopiydop n nvs sfaDrr(rpot4opx  f3tas s rlnvo;()alenxociatomDr i s s0srto(o iydlme  nciat)s2rax  nu0olxn iciysls2elnvpn()tetnif totfmtran s;s  euo(opiudap nlietlsf rtax  ;o0aex  o3ild m uan pnt4 ltrmoctatfpt anei;()sruoxm3nodaleemnvt t) Dtau  ;u0oltnmf3iasfa2ea(vs t0tlermr iytomt livsl(0t2tr(r3io4amte fvtasfaDraurpot0tetniictlsfa2rl(vpn(0aeeoxr totopt anei;() rxoim3nudoltemnetas) Dua(mpnu4tet io3iasls rl(ms u)alxrxfcty1lpDeaneo;s)s2xr(o iu1amt micil( srurxm no4tpxo iciydfa2uan o t0texoio tydfaDe ueo t) rxoxmpio1altnlfvs s)a2tmxrooo1tet mi3tydfm raump (0aexoxf tadfa rau i (0s2um(m iu1lp   fcil()arrau ont0apeomi3iltlaDum(vs;u4tltnmr oa1fmtr uesls teurim3ou1ameelietl(fsDua( ono4opt  fctatlmDuluvo;u0 renmf ootfaDr uei;t0sexmxm nu1lm eliet s)artau p;t0open oeiyt a ulumpn(4tlxnio3oa1lp  auvi s trxrim3iu4olte fet t arumu  nt4optomiciyt a2ulums;t0tleoxo3iytlmt  nei;(0trtmxo oy4opteliei (faDtau  oo0aptnmfeiys m2ul(msnu0artrxoctydfmt  u s;s)t2trxo3iudlpe lnesasf Drmurpot1olt mo3iydfa2emnmp;t4aetrmo3iatfmte uvo t s2ur(m oy1am e ietl(fartaxmoou4tpxo o3tydla eluvs (0 ltrir3oadoa rluvol() 2toxo ny1amtnlncslsfaDtmxro;u4tleomf3tltfaDelnmp;u4trxnif3oo1omtrlieo;s0srurxr3ny4ll nlivs s s2taum nt1aetnmiciadlm2emumpnt4texnmr3totomtelneolt s2umxm3io4lmt  fcil() 2umumooo0tetnifeiydfm2rm(vo;u0 lxrio io1omDr nvs;t) 2umio nodlmt  iei ()a2tr( o;t1tlto f3tlt mDraumonu) etrio3oo1fm elnes;s0s2uriopnydomenlfvtas)s2rru poo0teeoio3ilt m2uanvpnu0tltrxo oa1optr iei s0srumim oodopt liet (  Drrumono4apt mietyt a rmn o;t4trermf io1lmDranes s)s2to(o3no4al nmnvil() Dtrxmp;t1oltomo3iydlsDrm(ms;t0trxrmrcio1la rlivi;t trxoxm3oy4ll   fvia(fsrtm(ronu0tex mo3iltfmDumu p t4 ltnxfcto1faD  iesl(  2xr(m3iudll nlfetl( sDrmx onu4tpt mociydlaDuluvonu4artomo iy1fm e i i s0setriopoy4om n ivtltf rtm(m nt0altn f3iasfa uauvon(0aexrxoctatfp eaueo;t) rxm(opiu1omen fvs t  2uaumoot0tpeo f3iadls2ua(vsnt0aeermo ia1omDeaivi;s)s2tmir iy4llte iei s s2raurpou1aptn fciysfa2rlnvo;t0artrmf ta1omte ues s trurim ou4lle  ivtlt)artaurpno4opt ifeilsfsDrlums;t0altnmrctotlpDrli i s s2to(mpnodlp  micsls)sDurxro;t0olen fctld sDua(vsnu0artoifciadlp e n o;s)t2xrio iudoleemivil( artmxr ;t4oexomoeiasfs2uanms;() rtnmo3oydfmDrli o;t s2tr(r3nydlpt  fvtas srrm(r nt0tltnioctltfa eluvs;u0 exomr iatfaDr nvo;s  rxr(opiydapen netl()aDtrxmonu1oetomo3iydfsDumuvp;t)alxnmr todfpt lnvsls)seumir no4op emies tfa2rm( pnu1tltomf3ias a rlnmo;()tleoio3io1latrlu il(0s2xrio ou4ope lnvtlt arumur oo4opxoii3ias aDul(mp (0tlenxr3tytfp rluvi;(0srtrxopiu4lmeemivia(f Dtmxr nu0tpen o3tls a umnvont4trxomocoytomt ln o s s2umimpny4lp   fcsat  rrax p;u4oex mfctasfm2ranmp t)artnxf oatoaDe nvs s0teurxo3iu1olenmnvtas)aDtr(rp;o4opxo feild a umnmo;t4artrxfctodom elu i t  2umiopnu1ape  feilsf rrmu  oo1apeomoeiytlaDel( o t4treomf3oadlaDe uesl(0srxrxo3io4lmeelnes () 2urxr ot0alto o3ild s2uanmp ()arenir3tytop eanes;t seto(opiy1altn nvil()s2um(  ot1tleomoetasla2rmn snu) leoxo3oytoa  livsl(0t2triopnudlp  lfetat) Draxmooo1tpt moeiysfm2ranmsnt0 eerxo3iodlptraiei t) ruo(m3iudlp nlicia()arra( p;o0apenmieilsfa raump t0 lermf oa1la   neols0 exoim3oy1ome mncsls) Dua(mpnu1oeto i3iydla umumsn(0trxoif iytlm e ieo t  2umir3nodamtemncta( s2taumpot4oexomietyd mDua(vont)tleoif3iadlpt  u o () rur(r iodlmt  fetls a2rax o;o4alxomictysfm2rmumo;u)trxrmr tatlaD an o;(  rxoirpiydaleemfesltfsrta( pou4oeen o3ild a emu s;(0 rxnmo ia1fpDrauei;()trxo(m oo4op e fvtas  2tax ont1alx iietlsfa2ua( o;(0treoifcoo1la  livs;s0 rtmxm3iy4ap  lfct s  Dtmx ono4ole ifeiltfa2el( pn(0altomfcootlpD auvs t s2xoxm nudolenmncs ( sDtruronu0oex  o3iadfmDrl( o;u4 etoir3tadomtr uei s0trtmxm3iy4llee ieil( sDuaump;o4tetomoetyt a rln o;t4tleoxo ootlpt lu o s) 2toir ou4lp  mfvtatfs2tm(  ot4tptoiieiysls2ulnms;u0 rerir ia1lptran s () etr(m iudopte fci s  rua(mpou4altnmfciaslaDuln p;(4texnmrcoa1laDeanvo t sexrimpny1ap n feia()arraxmo;o4tex mfciad a ulnmp;(0alxoif3iotlmtelieo;s)trxrxm no1ape  fvtl() rrrxmoou1tpxoifeild a elnmsnu4altrmfciodop   n o;(0 2trxr3ou1am n ieilt s2rr(  ;o0tpe iiciytla rm(mp;u) etrxocoydfate neslt trxo(o3iy1apt  feta(  2trxr oo4alx  octadlaDeln pn(0areoxf iodlpt lnvo s0texmxo3iodlpt micsatf 2tmumoou1apx  feiys sDumnvpnu0 rtnxo tydopt  i o (0teumir3ou1ameelnct ()aDumxr nu4tet  fetadfm rmnvp (0alxrmf oa1oaD aivi;(0seurxrpiodapte ncsa(f rtaxmoou0tlxnifcildfs2ul(vp;t4 exnxf oatop  ai s t) rtoxr3iydaleeliet tfs2urxmoot4tet moetasfs2el(vp u4artrif3iodoa rluvs (  2urio3iu4lpen nciat)sDrauront4opx  i3tltfaDeauvpnt)texrmf tytfp  au s;(0teto(rpnu4al emieslsfsrurumont0aleoiieiydfaDrln o;t4trenmfctadfp  lnvsls0 ruo(o oudame  nei t s2ua(ro;u4alen ocild s2ea(ms;u) rtrxr3oatlmD liesl() rxm(opoydamtn ieiatfs2trxmpoo4tpt mi3tltfs uanvo () eermfctodlatrlueolt  2xm(mpiodll emnet s srtmu p;t0oexomo3tydfa2em( o;(0 lxomo3io1fm raiesl(0 rtrim3oodalte ieils artaxr nt4tlxoioetas m el( o u)tetrirctadoaDrauvs;t)trtmirpio1ol nlicilsf 2rau pnu1tetnio3tasfa rlu o u0 lxnmo tadlat lueils0s2xo(m ou1lle mnesatfa2rmu pnt1oex  o3taslmDel(vs;u0arxomrctodlpteau s;( sexm(r3oy4al nmneil(faDrmump;t4oeenmfciyt a2el(vo;(4tlenmf3to1lm   neil(0 rtr(r3iodap nmnct (f Dra( p;t1aleoiociad a rlump t0aeeoif3oadlmD lu il( setrim ou1om   ncils)s2umxmono0tleomoeiasfs umumonu) exrmf oo1omDraueilt0teurxopou4opee nvtl() rra(m no4aetnifctyt s2ea(vo;u)teeomociydoa e ivo;t) rumxo3iodlpt livtat)aDrr( p;u1aleniieias m rm( snt4 eermf oatfatrau i;(0s2toirpno1opt  ici s)s2ta(rp;o1opt  ictlslsDeanvp;t) etnxfctydfa rai i (  2toxm iy1om nlfvtlsf 2urumoou1tleomf3tasfs2elu o t0aexoxf iodfa r u i s0 euoxo3oo4ll elnetls)s2ua(  ;o0alx ii3tydfa uluvpnu0alxrir3todfaD li sl() rtmim nudlltn feiltf 2tr( pot1oexomf3tys aDrmnvsnu4 renmf3iadfp  lnvi s0 rtrxo nu1lltemneta(fsDtmur ;u4aetomf3iysls rauvp t4aexnxo iotlaDeli ils)sexrim3io4ll nlfcilt  2rr(mp;u4apxnmi3tlsfaDelnvs () lxnmr3oodom rai o t tetmio iy1ol nlnciasfsDtr(rp;o1oexoiictysla rmnmp;t0teeoxf3ootoatr i ols)trxrirpnodlpte ictas  2um(ro;o0tpxoiiciltlsDra(vp;(4tltnxocoydopD  uvs (0sexoxrpou4ap nlnct s  2um( pnu0tlxn i3iad a rl(vs u4tlxriocootopte uvs ()texoim ny1lltnlivilt) Dua(rp;o1tltomi3iys a uau p;()teenircio1om e ivo;(0 etoxmpoo4ap elfctltf 2tmx  ;u1oexnif3iyd s rlu o;t) rxrmfctadfaDr u i s)texoxo io4lpenmnvsa(f ruau p;u4tetnifciydlaDrmumo;u)altrirciodfaD  nes s0 eur(rpnu4ame mnes s aDrrumo;t1tle  i3iat s2em(ms;u) eerio iodlatrliei;(0trumio iu1lm   net sf Drauro;o1tltoifeilsfa el(vpnu4trxnmrcootlm e neo t0texm(m oo4op  mnesltf ruaum nt0tetomo3iytfa elumsn(4trtrmo3ty1laDr u s;(0 rtoxrpoo4lmee iet t) 2um( p;u4alen fetldla rmnmonu)texnxr iy1lp e ivols  etrxo3ny1lltnmivtas a2ua(  nu0alxoiocilt s uanms t0aeerif3iytfmDe nvo;() rto(o no1om  lfeslt) 2um(root4tet iocilsls ua(vs;()trtnmf ty1op  livol() rur(r oy1lmt miesls srrmxmpoo0openii3ilt s2rl(vo;(0teerio todlaDr nvo;t)srurio iy1ope  nes () 2um(rp;u0aptnio3ildfa2el(vpn(4 lermoctotfmt  neo;s0 2xmim3iydlptnmnci (f 2trur ;t1alx mfciydls rm( o t4arenif ta1omtraivol()sexmim3nodllt mfctlsfa2tru o;u4teenmicilt a2rau onu4 lenmr ta1fmt aues t0srumxo3oo4ol   iesas aDurx o;u0olxnmi3ildlm rmn p;() rtomo ty1oateluvslt setrxm oodal  mnvil()s2taur ot4oleomi3tlslm2um(mo;(0artrifcootfptraivi;s)setoxopiy4lltelieil(fartr(mp;t0olt  i3tasfaDrmu o (4altomr to1op rliesl(0trtoirpiy4al  mncs ()arta(rpnu4apxomieiydfaDem(vo;u4treomr todoa rln o t  2toim oy1lm emiei ( a2raxm ;t4tltn o3tld s2emumpnu0 rxnif oydoaDraneolt  rxoxr3ny4ol  lfvsas) rrmxm ot0alx mi3iadlmDra(msnu0 reoifciotlaDrluvi;s sexmxo3iodomenmieiltfarrrxm nt4altn fctysfa rauvo;t4trxnxo tatoa rauesls  rtm(opoo1am elfeiasf Dtr(r no1ope mi3tld s elump;u0altrmf3oy1lmDeauvolt0 rurirpiudopeelfeil() rtm( ono1tpxniieild mDrm(monu0alenio tytlp rlueols0trtmim oydale lictat aDta( onu1oexn ietatlm eanms;u0alxrif3totoaDr ivilt)trxoirpny4openmfesat  2rr(ro;u0tlxn f3iyt mDrln ont4aetrxr oa1fp  ln s s)seum(rpoo4lp emiviltfa2tru poo4olenmoeiadlm elnvonu4 etnmf oodlpt  u olt)t2um(r oo1lm nmnvta(fa2umumooo4apxn ieils s rmu s () rtoxf3todfateluei ( seurim iydomte iesatf Drmum nt4tlenmf3iyslm2emuvo;u0 etrmo3ty1lmDr uei (0srum(opiydaptnmies ( sDtmxro;t0oleo ociat mDeluvon(0arxrifcoa1lmD lu ilt0seur(rpnodom  lies (fsrtaum ;o0tee mi3tldlmDem( snu4aetnio todopt an o;( s2urio oudapeemncsltf 2uaxm ot0aptn feiydfa2eluvs t4 lxrioctadom  lnvs s)srtrio3no4lm   ncs sfs2ua(rooo0oltoifctytfm rlu o;t)texnmo iodomte nvi;s  rumxr3iodopeemnesl( a2uru pot1ole mieilt s ra(vont4arerxrciy1omtr ivi (0truoxm nu4lle mnes s)arrmx pno0teenmoeild sDumn o u4 lerir3tadoat lueslt t2xm(r oo1lpeeliet t) rra(moou1oexomf3iytlsDelnvo t) etrxr3tytfa eln o;s0t2um(o3ou1ap  mnesas artm(  ot0tex mictydla2emn p;u4artoircty1faDraues;s s2uoimpoo1am nmncs sf Dumxroou0opx mi3iad aDul(mo;()aetnxo iydfat luei;s  etrimpou1alee nvsl(fs2uaxrono1oetnmfctysls emu p;t4 lenmr3tadfaDelu s;s srumxm iu4ameemict t sDrr(  ;t0tpe iieiasfsDul(mo;t0 rxnxf3to1oateli s;t t2uoxmpiy1optelicsas  rra(m ou4ape  f3ilt a elu p;u) rtnir iodlp  anesl() 2xmxo3ny1oltelnet (faDrmumpoo0oet  o3iatlaDranvo (0alxrxfcoatfat ai s s srtrim iy4amen ict ()s2tmxr ;u0tlto oeilslm ra( sn(4tlxrmo ta1fm e i sls)t2uoxo3io1lp  mfvs ( aDuru pou0aptnifetld a uln pnu0 ltnioctytomDelnei ( t2ur(rpny4lpt lnet ( s2tm(m ;u0aexomi3tls s2rau snt4altrxf oatom rlneo;t t2to(opiy1alt mfeil(  Draumpno1aetoifetldfmDuauvsn(0 renif io1latr n s;( trtoio nydoptnmivia(fsrtru pno4olen f3tld m ea( ont4 reomo oydlpDeaneo ( trum(m oo4llt mncs tf Dtrum nt0olenifeiad m2emuvs;t4 leomo oytlp  aueilt)s2ur(o3oy1olee fvtatfsruau o;t0aex  ociad a um( p u) rerxf to1omD auvsl(  euoxr3nu4omee ivs s srta(r ;t0teenif3iadfa emuvp t4 lxnmo3iotfm ran o;(0 2urim oodomte fctl() Drruroot0opxoio3iaslaDemnmp (4alermr iotop  lnvo;()srtrir3iudlpe miei t) Dtr(moot4texomf3tydla uauvpn(4tetoxr tatfp  lnes s s2uriopnu1ap elnvilt sDtr(mp;o4texomociydla2ua(mo;t) rxnmf oytomtr u o (0t2tm(o ou1ome  fcilt)srumx o;t4teeoiieiaslm2uau pn(0arenmf oodopt aivs (  2xrxo iydap e fct t arumumpnt1tpeomfeiysfm2umn p;t0 ltnircty1omt auei;s0 2xoimpnudal nmictatf ruaxro;u0aetnmociydfs2ua(ms;u4 ltomo totomtelies t  euoxr3iydap nlfet t a2trumpot4opxo f3tasfa ul(vs;(0 lermr iy1fp  aueols)texoimpny4lltnlnvslt)arrmu  ;o4tpxoioctatlsDul( p (0 etoxr3oydop  lneo;t) 2xoxr3ny1olee fci s sDtru p;o1olx  fctlt mDua(mo ()tlenmr tydoa rli i;(0 etrim nudlmeemfet ( a2rmump;o1tlx io3ils a2rmums;()aeerxr3ta1om rluvi;s srxrxm oy4oltemnetlt aDtm(rpno4olenii3tytlm2emn p;t0aexoxocoatom r ieo s) rtoxm3io4lp e fctasfartr(ro;u0oetoioeiadfm el( sn()tltomocoa1lp r ues;()seuoim nu1alenlici s  ruaxmoou1apxo fetys a2um( p;u4trerio3tydfpteauei t)seur(mpoo1lmeelfvtat) Dtr(moot1alx mfetatfs ra(vs;t) exrirctadoaDeauvo s t2to(m nu4lm n fet tfs2rr( o;u4optomfetydla emnms (4altomf3ty1lmDe ueils0 exm(r3iy4aleelfesas) Drrxr nt1apto o3ildfa em( p;(4trerxo oa1fa  an i;( s2trxmpou4openmiesas a2rmxm no0teeniociasfs2ea(von()altrxf3iydfm eli o t texmxrpou1aptnmnvtas s2um(mono4tetn fetldls em( o;u4arerxrcoo1fpt  uvi () rtrxrpiy4lpenmivsat)a2urx o;u0tlx if3iydlm2uaumonu0trxomf3iytfaDe nvi ( t2triopoodaltnlictlsf 2um(rp;o4olenmi3tlslmDeanmpnt4arenxo todopt  i o (0srtoxrpiydlpee ivsatfaDraur ot1oexnifeiys m em(vsnt) lxrxocoo1fptr u i;t)srtrir iu1ll  mnvias)a2ua( o;u1aptomictasfm ea(vp ()aeerirctatop r n il( s2xmxo3iu1lpen nviat) 2tr(m ;t1oet if3iltfm2ua(mpnu) exrxocoytfp  lnes s0sruoim iy4opt  ict t srtrur nt0olx moetldla2uanmonu0texrif3oadopte ivo;()texoir oo4ol  mnci ( s2rr(mo;u0openif3ilt s rlumonu0arxrxr oy1fatrlnei (0 eumim oudlp elivt ()aDtmxrp;o0opx mictadfsDum( snu4 etnio3iotopDeanvo;s  rxrxopiu1optnmneia(  2uaurp;o0aee ifctasfmDea(vsnt) renxfcta1lm   nei t0s2tm(mpnu4lm elnes sfarrr(r ot1oet ifciydlmDuau o;u)aexrmo3oydfm r nvs;t0 2to(opiodom e ics ( s2rrxm oo4alt  i3tyd a2ranms;()aexrio3ootom rlu o t  ruoimpoy4omt lnei tfaDurxrpno0oeenmo3ias sDrmu p;u0altnif oy1lptrlivol( srxr(o3iydom e ncia( artmur ot4aleoifeiyt a ea( s t0 lermf3iydlptr i o t)sexmir3io4apenmietlt) Dtmuroou4oeenifeiydfmDelnvp;u4 rxrmfciotlm  li ilt) 2xr(o oodap  mncsls  2raumo;t0oexomi3iytls2elu o t4 ltomo iotfpDe uvi;s0srtoxr iu1olee fvi s  Drm(rpot1ape iicias aDrl(vpn(0arenxf iydoa ean s ()t2xrim3ou4ll elieil(fsrurum oo1texn octls aDum(mp () lerxo3to1fmDe uvilt)seuoir3oydamtn ivil() Dtmumpot1tleomoctatfaDrluvp ()trxoxrciatop r uvi t t2trimpny1al nlnvt t) Dtmxm nt4olxnii3iyd mDul(vs (0texrxrcoo1fmD livsl(0tetm(mpoy1op   iet (faDumxmont1ole mociysfaDem( o t4trxrxrcoa1fa  lnvs;( t2urxr3oydal e ivt t)srur(m nu4alxo oeild sDumnvp u)aexoxf3oa1fptrluei;(0sexrxm no4oleelics (f 2taxm ;u1ole  feiat m2uauvo;u) etomfctodoaD  neilt0trxrxm3iodape  iciatfaDrrxrpot0teto f3tltlsDea( s ()trxoioctatom e nvo s)srtoxr ny4om emnviat aDum( o;o0olt  ieiytfa2um(vp u4altnxo3todfptrlueolt)s2trir3oo1apt  nct s  rrr(mpnu1opeomf3ildfa2eln snt4 ltomo3to1fa e ivi s s2trio3nu4apenliei ( a2ua(rpoo4aexomfeiadls uauvpnt0alxoxf tadomDr uvols0seuoir3iu1lpe mfvs s)srtau  ou1tlt  i3tatfa rau sn()trxnxfcoadoat anvs () exoimpoodll   nci s  Dumxrpou1alt ifctydls2eaumonu0tlenxo3ootoa raivslt)tetrio iudame mfct t arrrxmont1oleoio3ias m elu s;(0trenmr oadfmD  ieo t  ruo(o iu1opeelnvilt) Dumurp;o0optn feias s rm( s;u) lxnio3ta1om ran s;(0srurxr iy1ameemfei sfsrumxmoou4altoif3iatfm2um(mo;(0 lenxf3oytfmD an ols) exr(m ny1llenlfetasfa2taxronu0texn ieild m2rmump;u)texnmo3io1lmD au il(0texmxm3oo4lptemivi (f Drr(  no4oetn iciytfm eln ont4aleoxf3oodfa r i s;t setrxrpnu4opt lnvtl(f 2raxro;o1apxomieiad s rm(vo;t0alermo totfaD an sls)t2xoxm3ou1opt  net (fa2rmxm ot4oexoio3iadfsDea(vpn() leomf3tadfmtrln s;s tetr(r3oo4lp   ivsasf Duau p;u1apen f3iatfm uln s u)areomr iadoat li ol()tetrxopoodlp nlietat sDraxm ou1tlxoii3iltla2rmn on(4texoirciatom rln i;t)seuo(r3oydllenmieta(  rur(m ;o1tex  fciad s2emu pn(4tetnio3ty1omt anes s)s2toir3oydaltnlfesls) Dtax oot1tpxnmfetas aDumnvs;u4teeoxo oadomDr n il()srxrirpou4ole mnvtat)s2rm(  nt0oleomf3tldfs2rmumo (4tlxrif iy1latrau sls s2xrim iu4ap nlfcil(fa2rau  oo1oet  ocilsfsDumu pnt0 eenmr iy1la rlivo;t s2uo(m3nudll nlfcs tfarurx o;o4olt io3iatfa2rmuvsn()aetrmrcoo1opDrlivs;t)tetm(opio1ole lfvta() rtr(rpot4tleoifctls sDemn o;(4arxrif3iadoptrli i s teum(opoodlpee fci s)arrmxrono0opt mi3iad mDulnvp u)tltnirctytomDe uvo s)srtrio no1ame mieia(f rrruro;o1aee ioctaslm2el(vo;u) etrmrcto1fat  nvil( srtm(rpoo4lptnlfei t)artru  ;u4oex moetat m ranmp;(0 renirctytoaDeanes ()seurxm ny1lptnmfci ( srtmxmooo1oleomfeildls rlums t0tetomf oy1lmtran ol()setrir oy4ome mivsa(  Dtm( pnt4opxomfeiysfaDemn pn(4teenmf3tatoaDelnes;()s2xr(r oodlmenlfctltfsDta(m ;o0aeen iciltlmDumums;(4aeerxr ta1opDe uvs;s0seumiopnu4op elnvi (faDrax pnt4tpe mf3ilsfmDrmuvo;u0tlxrxo tadfmDelieolt  rtmir ny1optelnviatf Drru poo1tpxomfciyslmDrm(mp (0aexomocio1op  aivi;t0sruo(rpoo1altnmfviat) ruaumpno1tlxn oetydls2rmnmsnu4aeerxr io1fpteanes () rtm(o3iy1lme  feiatfsrum(r nt0aleoioctlt a2rmump u)trtnmf3tadfptrauvs;s)texmxm3nu1amee ncsa(f rrrum ot4aetnmoetyt aDul(vo () exoif3oy1opt  nvolt setoxo ny4llenlfci (  2rm(  ;o1ole mf3tas a2um(vo t)alermfciodopD livslt  rtr(rpnydomeelivi ( aDrm(  oo0olto ociytla emu ont0tetnif3oydlp  lu o;s)srxmiopno4ol elivia(farraxmp;o1olt ifeiatfm2eln snu)tetnmfcta1opD  ivil( truoxo no1amenmncs (f rtmx ooo1apx iieias s2rau s;u4tlermocty1oat luvs;() 2uriopiu1ol  lnetlt  2tr(r ;u0tet  feiadls2emn p u)arxomr3iadfpDrauvslt0trto(o oo1ll   fvsas sDrrumooo1alx  o3ilslm ulumo;t4alxnmf oodoaDeln ols)texr(r iy1lm n fvs (f 2rrur ou4aexnmf3tad a ra(ms;u) ltrxr iy1fm ranvi;(0texoxmpiudam elfetl()s2ua(m no4tlx ii3iysla2rmu o;(0alenircoy1om r n s;t teumir3iy1ol elnvsasfsDua(rp;t4oet if3ilsla elnmp t0arxomoctytfpD ln o ( trtriopio1olt lncslt)aDuaum ;o4tlt moetlslm ea(mo;u0tltoxfcto1fpte ies t0 eto(m oy4op elfeil(f rraxm ou1olen octysla2rmn s t0 etnxo3iadomD  n o;t sexm(mpiy1lp n iet t sDrrxrpno0apeniiciytfmDrau o;(0aeenmrciotoatelu ilt s2urir3nodalee ncsatfarua(rp;u4optniiciat m2rau pn()aetrir3oodfa r u o;(0trtoxopoy1olt mietat)aDrm(  ;t0aeen i3ilt a2eln snt4tltoxr ia1fmD li s t  eur(m iy1al n ict tfa2umx pou4aptoifcild s um(vs;(4aeermf tatlm  lnvolt)srxmxr3iu1am nlncslt  2urur ;u1olt iictasfm ra(mo t4 rtrxf iatfp elneolt0 rtoxm3io4lmtelnvtl()srur(mp;o0apxnioeiytfm2uauvpnt4teenif3to1oa eaueo;s truriopno4lpe mfeilt  Dumu  ou1texn f3tldfs rlnmo;u0trtrmr totopDrlivo s)srum(m no4lm   ncilt)artrum ou0tptnmociad sDrm( o;t0teenxf3tytop   uvilt)trtm(m oy4ol  mfet t s2tmumpnt4tpt  ictat aDemnvsn(0 reomo iadopDeai i (0texm(o3ou1lmtn fvta(f Drr(  ou4aex  i3tlt m2uluvp;t) ltnif3oadoaDr ieo s0trxrxm3iodomt  ivi ( aDuaxr ot0aee  o3iltlaDuanvp (4 lxnifcta1omtr ues;t) rxmxr no4op n ictas aDrr( o;t4teeoioeiydlm rm( o;(0 renxo oo1oa eanvils seto(rpnydale  fcsas s2tau  nt0alxnifctlt sDum(vp;t4 lxnxf iodfaDrlu ils t2xmio oo1amtemici sfarurx o;t4optomfetadls el( p;(0 rxnxf iotoa r uvol( texo(r3no1lptn nvs t)a2urum ;t1apxn ictls s2ranvp;u0treomo ia1omt  n sl( texrxr no1omte fcia( a2ua( p;t1oet  f3iadfa emu s () lxoifcoadlmDean ilt srtr(opnu1olee ictls)srrm(monu4tlxoiocilslm rl(mo;u)trtnmf3iy1fptrai s (  2to(mpnydolt lncsat srrr(rp;t0teto fciadla rm(vs t4artnxr oodomteln il(0s2trir iudaptnlnesa()aruaur ot4apxoioetasfs2ul( o;u)tlxoif3tydlptrai s t0 rur(r3nu4al emnvta(faDrmu p;u4tee mieiltfmDea(msn(0tetoxf tatfmtrlnvsls0 rtoxm3no4ll e fvi s aDtmx oou4oexnmoetys a ul(vont0areoxf3iodla e i o ( texrxrpoo4lmenlfcsas) 2rr( pnu0oee ifciysfs2uanvo;() rxnmo oatomDe n ils)srxmim3ou4al nmfetls) Durur ;o0oetomfetltlmDrlump;(4 etnif3iy1la e ivsls) euoir ou1lp   iviltf 2umx ono1tet ifctld m2ranmont4 lxoxo3oo1om  lueo;(0trtmxopiu1optn nvtas  Dtaur oo1olenif3tlslm umnmp;u4altoxrcoo1lpte i o s)t2xoir no1apt mfct s) ruau  nt0apt ifctyslm emump;t0tetnmrcoydfpDrlivs t  etrim3iodale miesltf 2tmx  nt0oleo iciadls2uluvo;t4 rtomrctatlpt anvolt)s2urir3no4alenliesat  Dumumpno4tpxo f3iatfa ul( s (4tltnxf iydfpDe ieo ( srxoxrpiu1llee nci s) 2urxro;o4ape  ieiyd s2ulump;t4 lenir3iadom  au i t  2uoim3oy1oleelfei () rum(r oo4tpeo fcild m el(vpnt0altoif oo1oaDraivo s t2uo(r3ou1ome lncs tfs2taxmoou1tltn f3iad s em( p;(0trxomfcoytom  auvo (  rxrxm3no4ol   fesa(  rur(m ;o4apeoifetltfm ranvo (4aeeoircio1optelneolt srxrxr3oo1lmeemnct sf rtmu  no4apen ieils aDuln sn(0 lxriocty1oaDran ols) 2tr(mpio1ll nlies sf Duax p;o0apx  iciydfs2uln onu4alxoxr iydfmDeaieils  rtoirpiydomtemnetltfs2um(r ;t4oeenmicild a ranmonu4tltnxfctydfp r u s (0teuoio oy4ameelnesltfs2trumo;u4alx ioctat s2rl( s t4altoxo oadlmDeln sls0trxmio no4ol nlict s)arraxr ;o4tetnmfciltfa ea( ont4trxnmo tytomDelues t tetrxm oo4ap nmnvt sfs2ra(root4opxoifctlt m2rlnvo;(4arxnmo tadoptelneilt)s2uoio3iodllt mnesa(fsDrauront0apeoiicildls uaumo;(0texomfcto1lp elies s0t2to(o iy4olte ivilt aDrmu poo1aeeoiictys aDea(mo u)tltnif3oodlpteaueol(0 eum(o ou1lp nmicsa(fa2urx pot1alt mociytls2rlnvs u4trtoxo3oa1fpteaueil()seumxm3nu4amee fctl() 2taxm ot4oet mo3iaslmDeaums (4 exnifcoa1faDraueils)s2tm(opiydolenlfesa() rum(monu1optomociytlsDeanms t0arerxr oa1op   i o t  2urimpiu1aleelnct t aDuru ooo4oeeomociytfsDra(vpn(0trermf3tytlp rau i;t)srurxm ou1lpe lieia(f 2raxm nt0alen o3ildlm2emnms;u0aetrmr3iodlmteln o t0 etr(r3ny1omeemfetlsf rur(m ;u4oeeo fciatfs2eauvs;u4 lenmr3iydoa eau olt  etrim3iu4oltnmfvi t)srumum oo1oeeoif3ild s ranvo;u)trxoio3to1fa eanes ()t2xo(r3ou1llt  fcslsfsDtau  ;o0altniieils m ra( on()tlxnio3tatfmtrluesls  eumiopiy4am  mfeia( srtmxr nt0olx  i3iat aDrmn s;t4altrxf iy1fat aues;( s2xm(rpoydllt lnvtlt arrm(rono1aee ii3ildfm2ranvs;u)arenio3ia1fptelneo t0s2xoxr3oudlptelict t) 2rm( ono1tex  f3iyd m2ul(von() rerxf oodla r u s;s0trxmio3io1lpte fet tf rtr(  ;t0oleoifciat sDra( s;u4areomo tatomt  i ils  exm(o3oy1lle mnvtlt) Draumoou0tee  oeiyt mDem(vsnu4areoif oo1lmDrlu ol( t2xo(o oo1lptnmnvta(  rurx poo1olxo octytlsDrmuvp u) ltoxf tatfmteanvo s0trto(o ny1ame  neil( a2rmxm nt1tpxnifctltfmDrm(vp (4aeermocoy1lmDr i i;( setoim iy4lp nlfct tf Dtaur no4alenmfeias s2rmn o () etnif oydlaDe n o;( trxm(mpoy1ale  nes (  2ra(m nu1tpt ioeiad aDuaumo;(0 ltrxrcoytomD  u ols)sexrim3nudaleelieta()srurxm ot0ope mociltls2rm(vp (4tltniocoa1faDrauvol()trxriopoo1lle mnvils)s2rmxroou1opeoio3iatfs elnmp;(4 lermf iydomt  ueslt srur(rpnu4apen icia() Dur( pnt0alenmictys m2raumo;t4 rxoif oo1lm  an i (0tetrirpnydlp  lfetltfa2tmxm ;t4aeen feias sDrluvp u)tltnmf iytfp raueolt)srxo(o iu1opt mfcsa(f rrrx o;o1alenio3tadlm eauvp t0 eeoif io1fpteaiei;( trtmim3oo4oleelfetls)aDuru oou4aptn i3iys m2ul(vo;t4 etoif3tytlaD auvs s  rurxrpnydapenlies s sDururpnt1alenmoeilsls2emn p ()aetrif3ia1omtran sl(0teumxr3oy1ll n fvtat  rumu ono1apxo ictlsfs2elnmo t0arermr to1latrlivs;t tetriopnu4op   iciatfartaumooo1alenifetadfm2ea(vo;t4tltoif3io1fptr nesl( t2xoxrpoo1olenmicsat) Duaxmpou4oexomoeiasfaDrmu snt0 lxnmfcia1omDr ivols)sexrxr iu4omeemies tf rua(mpno0alen i3tadlmDeanmpnt4tltnxr3to1fmte n ilt)trtrio3nu1ll e nci tf rta( ooo4apt  o3iat s um(vs u4 lermrctytfmDeanvi ( s2uoio3oudomtelfvsas  rtm(moou1alt ii3ilt sDum(vpnu4tleriociotomt  i s (0s2uoio no1ale livtlsfsruauro;t1apt mf3iat s elnvs;(4 ltnxf3todlp  lieol(  exrxo no4aptnlneslt)s2ururpnu0alxo iciydfmDua(vpnt)tlxnmo3tytfmtelnvo;(0t2xrio iu1olenlict s aDtm(m nt1opx  oeiydfs eluvsnu) ltrxf oy1fpDe ivil( t2xm(mpnu4apenlivsa()s2taxrooo0aeen f3iad a2eanmpn(0altnmf iatoat  n o (0s2uoio ny4am nmfei s a2ua(r ;u1oee ioctytfaDrlumont4 etomr oadfpte ieo;( srxr(opou1ale lnesa(f rrmxronu0apxn o3tls sDeau snu) rtnxfcoydfpte ueils0seumxo nodopen ietlt sDtm(  ;o1olxnioeiatfs rlu pnu0altomo totfaDean o t0t2uoir no1olt  fetlt)sDrrxmp;o1tpxomoeias m2el( o t0arerxfciodla   n i s  2urxo iydomt lfcil( aDua(  ;t1aexn oeiytla elnmsn() renir3tytomD auvol()texoxo3oy4om  mfetasfsrrrxmoot0tpxn o3iydfmDuanmp u0 renif tytoa elies;s  2tr(m oo4oltnmfeslt s2uaxm ;u4aleo i3tydfaDean p t)areoxo3oadlaDr ivi (0s2toxr3iu1om  lnvtlt)arua( p;o4tetomfctlt m2ea( o;t) rtomf3oadfp r i s s) rxm(r3oo1lpteliei ( sDrauroou4tetnioeiasfa2elnvs ()aexnio oadoaDe i i;t) rtmxrpny4om nlnvt s)srumu pno1oexn o3ild m um( o;u0 etrif3oatlm   n ilt0 exrim nydlmt liet s  Durum ot1opxniietadls ra(mpn()trxnifciydfpt aues s0setmim3oo4op emnvs t sruaxmpno0texnmoctltfm2ea(vs;u)altrmo oydlm rlivil( t2um(r io4olte fet (fsDrr(  no1tpx mfciaslm2el( o;t0aexoxociy1faD  u i s)trur(m nydom nlnvi s)a2rm( ono1aleomi3iyd aDrmnmpnt)areoxfcia1om raueo t) 2xr(m iy1lptnmivia(f Dur( o;u4alxn fctldfa2rmumo;u)trerxr ta1lp rlies s  eumir ou4lme lfcs s) rta(r ou4opt mieiytls emu s;t)arenxr3iydlmDe u o;()t2xmxm no4omtnmivsl() 2trx  ;t4apeoifeiatls2em(mpn(0aeeomrciatfmDelnvsls) exoio ny1aptelfvtltfaDtrxront0ape miciytfm rl( ont0teerxo3tydfmD li o;s  2umxo oydam emnei t s2ua( p;t0oeen oetyslsDrmuvo;u)aetoxfcoydlm  aivi;s)teumim iydom n iei t srtmur ot4tet  o3ildlaDul( pnt4alxoxf oodfm rlu il( teumim3nydapt micta(fa2tau p;o0olto feildfmDrm( s;u)trermf3oodlmt li s t0s2tmxopiudal n nvt t sDrmu poo1aleomf3ilsfm elnmo;t4 ltoio3iydlp r ivi;t0 rtmirpno1omt micsl(f Drr(mpnt1apx io3ilsfs2ulumo;t4alxnio3iy1om r ues;s) 2xrxm iodamt lfvs sfaDua( poo0tlenmfciytlsDrl(msnt) ltnxrctatlp   i ols sexoim io4lme lnes t) Duax p;o4tpxoifciadfsDrlumo u0 reoio3ta1fpDr n s;s) ruo(o no1lleemivi ( arua(mpnt0aee  feilsfsDrl(msn(0texnxr iadfpte nes t  etmio3nydal n iei () 2rmxr ot1teeo octat m emumsnu4 lxnxf totoptran sls)srurxm3ny4lpt lieilsfa2tm( onu0teeo feiad s emump;t) exrmf oadfatr nvils teuo(rpoy4ome mfvs tfsrtax o;u0oee mfeiatfsDrl(vp;(0teeoxocoodfat anes;()srxmimpoudop e ies () 2ur(mp;t1alx mocildlsDuln pn(0 lenxfctatfptr nvsl(0trumxr iu4olee netls) 2rau  ;t0olt moeiltlaDemn s u4alxnmr3oytfa  aues;( sexoxr3io4olt mfvt s  rtr(rpno1opto oeiysfa emu snt0arerio3iydfmtrluei;s)srumio3oy4ome livsltfartru poo1olxniociytlm2rmnmsnu4 ltnio3oa1fmteliei;(0trxoxr3ou1omeemivi s)s2uaxmpno1altn ieiytls2elnmp;u)alerir3iytlptr ieo t) etoir3oudap e icia(fsDraum ou1aeto feiysfm2rmumpnt)texnio3io1om rauei s seuo(m no4lmt  fvt (  Dumxm ;u0apeo i3tltfs el( o u)tetoir3oo1lm  ln s t  exm(o3oudale mivi ()aruaurpoo1oexnmoctad mDrm(vpnu)tlxrmf3oy1opDeai i;s sruoir3io4lpenmnctls)srraurp;o0olxnioeiyslsDumumo t)arxomfcoatfaDeau o (0 2xrxopny4op nmfetas srrau o;t1tetnmfetatla umnms;t)aetrxfcia1fa e ies s)trxo(rpoy4om emncil(f rua( pno0aee mictytfmDrmumo;(0 rxrxf3totfatr uvi () ruoir io4llt lneilt)srtrxmpnt0altnmfcild m2uaump u) ltoxf3oodop rlueo;s) exrio oudlm  mivt (f rraumo;u1aeto fetlt a2emu sn(0 rermfctytomDeauvi t  exmim iudalen fcil() rrru  oo1tpeomf3tys m2rlu p t4 eenmf3oytfate u il( srxoxmpnodlp elfviasfaDrm(m ;t0olenmiciatlsDuauvo t0tlerxf3oa1lateluvo ()srto(rpno1lp n ivilt aDrmxmono0oleomi3iadlaDemn s t4aeeomo ta1fpDr nei;t) exr(m3oo4om elnetat)arumuront4oltniieiasfsDumuvonu) lermrciatfaDean s;()tetmimpny4ap e ics tfa2raxro;u4opt  i3iyt s rau s;()aeeoxfcio1lmD lueo t) euo(r3iudolt  fvt t aDraxmpou1tltn fetld mDeln o u4 renxrctadlp r u o t t2toxmpiu4lmeelieil(fs2tm( p;t0olt  oetlslm2emump t4trenxo3ty1laDrauesl( t2ur(m3iy1altn fes tfsrtm(mooo1oexomi3iysfmDeluvsnu4 lerxr3iydoa  anei s sruoxr oydap n ivtlt  ruru p;o4tpx iictydlm2eaums;t0tlxomr totfa rlnvi s0tetrim oy4olenmivilt) 2uax ooo1aee ii3iatfaDranvp;t0alxrif3oatfaD lueslt) 2trimpiu4lltn icta(fa2uaxro;o1oexnifcilsls ua(vo;t)aeermfciodfp r n s s  rxrxo iudome mncias srumumo;u4opxomi3tldfs rlnvs;u0alxnirciytopt liesls0seumxo3oy1omenmnctatfaDrr(r nt1tlxoiociytfs eaumonu4 etrmo tydlpteai slt)s2umirpny4am e icsltfsrtauroou4tptniocild m ul( s t4 rxrmo3oo1fp eai o;( trtmirpnudom nliesas artrum nt4openii3iytlsDumn pn(4 renxfcoo1omDranvslt)t2um(r3iy4apee nvsl()aDra(ronu1apto octys m uaump;t0 renmrctytfpDranes ()s2xoim3nu4lm  mivils sDrr(rpnu1texoifciydla ulnvo;u0aetoxo iadlatr nvo s)trxo(m io4lltelnvsa( a2urur ;o4aexo ictys a rm( o u0trerxociy1fmt auvo (  2xm(o3oodameemictl(  2raxm oo0apx mo3iatla rlnms ()trtrmo3ty1omDrli ils)trtr(r oudlme mfctlt)srrru p;o4oeen ocilt a2rmnmp;t)aeerxf ootoaDraneo t texoxr3nu1om emies sfsDrm( oot4oltn fciyt sDuaums u0 eeoif tydfatelnvsl(  rto(o3nu1alenmnet t arurxm no1tetomiciadfmDem(mpnu)tlxrmr3oatom raneilt  rur(rpnydoptn fvtat)srtrx oou0tlen f3tydlm rmn s;t4tlxnxrciotlm rlu s;(0srtoxr ny1ameelnvia( srrrxmont0opxnmoeiytls elumo;t4alxomf3todfptelnvs;t sexo(m3io1lm   fesat) rum(rp;o4tpeoioeiatfsDulu pnu4tlenio ty1lmtean o;()seuoim3iu4lpee nviasfs2rmu o;u4olt  o3iyt a2ra( o;t) etomoctodom raiesl(0 2xrxmpoodllenmnes s)sDraxm oo1tex  i3tys s2umu s (4 ltoif3to1fm   uvsls0s2to(m oudolee feia(fa2rr(ront0oeenif3iyd aDuluvs;u)tlxrir iytlp elivs;s0srxrxrpny1altnmivta()aDua(  ;o0olxo i3tls aDem( o;() eerif3tytoa e uei;()s2trxm3io4lp e fcta(fa2rmxronu1oetnmi3iatfs el( sn()arxoif3tytfat aies ( seumxmpoydalt  ietlsf 2rmx poo1aetniieild m ulu o (0artnmr iodop rau i;t  2uoxopou1aptelfcil(fa2ur( p;t1tltoifciydlm2ra(von() exoxr oatomt lnvsls0texm(m3oydomee nvia( arrrxmoou0aetomi3tadla2eanmsnt0 exrxf3tatop rln s;s seumir3oo1op elfetatfs2um(m nt4apx if3iyslsDuau o;t4 exrmr oodlpt li ol()texrxo oudopt mics t)srrm(r nu4aeeo fciys m2rmnvp (0altoifciydfmt aueo () 2to(r3iudap nmncta(f 2ua( ooo1altoiictldfaDrmu onu0trtnxrciodlpDrlu sls  2uoxmpny4ll elnciatfa2umx oou1tptoifetatfs2eanvonu0 leoir3iadopDeauvilt  rtoir3ou1ope livta() 2ur( pou0tpto f3iltfmDrm( p;(4 rtoirctytoptr ues;t)srtrxr iydalte ncsls) rum(ro;t1olt mfctasla2rmn snt)tlxrir3ia1fa e neslt sexr(rpoo1op  mictat  2um(rpoo0apen iciatlm ra(vs ()arenmr3oadlmDelivs;( teuoxm3iy1olt  iesl()s2ur(r oo0texnifetad a2rl(vs;(0tltomrcoodfmte u o;(0tetmxm3ny4ole  iei sfsDraxr no0alxomfctls s ul(mon(4tetoif ia1oatr u s;() etrxm iu1ope mivilt)artr(rp;u4tptn octyd a2el(ms;(0artrxrcty1oa  auvsls)tetmxmpoodlmeelnei s  Dum(rp;t4open fciasla2uln o (4tlxrmf3ta1opt  u s ( trtoxmpno1llt mfeil() Dtmurono4oleoif3tld mDrau on(0tlxnxo3iadopte uvs;s)t2triopoydole licsl(f rumu  ;t4aet mi3tltlaDemumpnu0aetomf3tadlmt aueo;(0 ruoim iy1ale lieta( aDraur oo4oeto ieiadls2ulump;u4trxnifcoy1opt lneils setrxo3iu4omtnlnet sfaDrr(ront1ale  feiys a uauvsnt) reomr tytfateau ils0t2uoirpou1lpt  ivt s  2rm( p;o4aeto o3iasla uau s;u0 rxrmf3tytoaDrlivslt)trxmio3nodalte feta()aDrr(  ;u0olxomo3iytlm el(vo;u4altnifcoadlp e nvs t sexmxr iydll e ici (fs2taurpno4aeeoiietldlm eluvo;t0 exrmo iatfmDeluesl(0 2to(r nodap nliciatfaDrm(mp;u4oeeomfciydlm umums;()treomfciodfmtrln ol()trtrxo iy4opt mfvs t) Dtr(mono0aleoiieias aDul(vs;t0alerio3ia1fp   uvols) eumxr3oodlp e netlsfsDurxmooo0aexo f3iltfaDraumon(4texrmrcoodop e neo;t0 rxrio nydap  mfesa( aDtr(mpoo4olxomictlslm2emu s ()arxrio oy1fate n s s  rxm(rpiu4lltelfei ( arumxrp;t0tpxnmi3iydls elu p;() reoxrcoydfmDelneil(0trxr(opnydom  mici t)srtrxmpnu0opt  o3ils a rln s t4teerxo oadlpDe uvo;s tetr(r3iy4om nlict sfa2tr(rpno1aet ifctytfs umnvsn()tltrmrctydlptr nvils seur(opoy4ame  fciat aDra(mp;u0tetn ietysfs ra(mpn() eenmr3totfptean ils)trxrimpiudllee fcil(fs2ur( pnu0olx iociysfs elu s (0trxnxf3totlmD  nes t) 2um(opio1ome mfesas)srraurpno1opto fctysfa2umn p ()aleoif3todop rau s (0trum(r3iu1lptnmncsas artmx p;t1olenmicias aDean snt)altrmfcoatlaD livi s teurxr3oy1lpenmfvs s)a2trx pou4teenmf3ilsfsDra(ms u4 ltnxf iydlmte u s t t2xrxopnydllenmivtlsfaDum(rp;t4opxo ociyslm umnms t) rxnmr io1oaDrauvs ()teurxr oydapee iesa(fsDtr(r nt1texomociat sDelums;t4 exomoctatlmt li slt0srxrirpnudlltn ict ( a2trurpno0aex mfctyd mDrmump;u0aexoifcty1lpDeanvo;t0s2to(opoydamt livtls) Drrxrooo0aetomo3ildfa elnms t)arerio oo1lm rln slt srum(o3iu1llenlfvsl() 2rruront1tlen f3iysfs2em(von(0 lenxrcia1fpteaneo s)s2um(m oy1llte nvsatf rrmxronu0olt  ictlsfaDra( pnt4texnxrctodfp   ivs () exoir oy1aleemiesa(f 2raur ot1aetoiietatfm rauvs;()aetrif ootopDelieil()s2to(o3oudlmtnmivs ()sruru oou1aptn o3tytla umuvp u) reoifcoo1op eau i ( trum(r3oo4ame micsa(fs2ua(ronu4tpeo f3ildfs rlnmo;(4 ltoxo oadlatranvs;s)s2trim no4lpeemiei t aDtmuront4opxnii3ias s2rm(mp (4alenxr3oatlpD  u o t)s2tr(mpnu4lpenlietas artm( p;t0tpx  i3tls a ulnvs;t4 ltoxo3tatlptr ivs t0srxoim3ny4om nmneilsfarta(  ;t0altnmoetat m2um(vpnu0 eenxrctotfp e nvo t trurxm io4al n ietl()s2ta(mo;o0tpx ifeiatls uauvpn(0tlerxf3to1fpDran s ()seuoio iudol emfeia()aDuax  ou0apt  icilslm ulnvs (0tetrio3ta1omtr uvo t) 2xrxrpio4lmeemnesas artaurpnt0oltnmfciltls2ran p (4artnir oadlpDe ueils t2trxmpnudole lietls sDuax ono4olx  feiasfmDrl(vs u) rxnmo oydfpD an i s t2uoim nodal n fetat a2rm(mpoo4tpto ieiysfm emu o u0alxniociadlp rai s s sexr(m io4ll emfcias) 2tru poo4alenmi3tldlm rau p () lxrio tadlp e uei s) euo(rpny4op emfeslt)arrmxrp;o1oexniocild a uanmp;(4tetnxf oo1fa e i o s s2xo(mpnudomt lncslt s2rm(rpoo1tex mfetydfs rmuvs;t4 leomr todlmt  ueilt0texrxr3no4opeemfcs (  rtaurono4ale ioeilslsDra(vs;t4arenifctadlate i i;()srumir no1lmeemnet () Dtmxm no1alt  fetldfa2umu s;t)artrmf3tydlmD  ues t)sexm(mpnudalt mfctlt a2ta(m ;u1apto ictld m2emnvs u) lxrxr3tydlatrlneo t)setm(rpnydapt lnctat aDraum ;o0tpx  fciltfa2umumo;t)arxnio tadlp rai sl() etoimpoudolen nesa( sDta(m ;t1opto oetatfs rauvs;u4alenmr3iytopte ies (0 euoxm io4ap  lfct sf Duax pou4tpeomo3iyt s rmu p;(0 lxoxr tadfp e nvsl(  rtrir3oo1openlnvsas) Drauront4opeomo3tlt a2ea(vs (0 exomrctatoptrauesls0trto(mpnu1open ivs t)a2rruroot4tlt mi3tlsls2eau snt4 reomo iy1lmDrlivols0 2xoio nu1lptemivta() Dtm(ronu0apto ictldlm2eln snu)tlerxf3oo1lmt an sl(  euoim3io4amtn nciat)srrm(m oo4altomiciyslmDemnmp t)altrmfcoytom  auvs;t0tetmio oudlme lfctasfaDuax o;o4tltnif3iys m rm(vp t)tetnif3iatfatelu i t)srtm(m iy1alteliet s  2rax pnt0aptoio3iydlm2eanvonu4aeeoircoo1oaDeluvslt) 2tm(opiu4om n fvils aDraxr nu4apxo octldfs2rlu sn(4trenmr oatfaDelivo;t)tetoio3ny4amee ies s sDtmx  nt4tltnmf3iat a2rmnmont)arerir ty1oatr ivi s srxoio oy4openmiesl(  Dtm(m ;t0tetoio3iadlaDuau pnu4texrxrcty1faDr uvs t0 rxm(o3nu1oleelfetlt)sDrau poo4apt mo3iasfsDumnms;(4aetoio3oytla e i olt) 2uo(opoy4lmtnlivils) rtrxm ;u4aptomf3tatlsDrmuvsnt4tleoifcoydop ranvils seuo(rpiy4ome  icsl( a2uaxroot0aptomf3iysfs2rlu o (4aeeomr io1fmt livs;s)tetrir3oy1llt livi t sDtm(rpnu4opxo fetydlm2rm(mo t4 eenio iotfpteai ol()tetmimpno4opt lfei tfa2tau  nt4oetnii3tydls2el(von()trxrmr3oydfaDeli sl( truriopoy4omeelivia()a2rmxr nu1tpe  oetaslsDem(vo u0alxomo tatfpDe ieils trtoxo3oy1am nlnetl()a2ra(ro;t1tpe iiciatfm ulumpnt)aetrmocoatoa  ln i;( tetoxopny1lp nmneta(farraxroot0tpx  ieiydfaDum(mpn(4teeomr3oydlaDrlnvi;t)setmim iudole  ivtas) rra(mono4aet  i3iysfa2rlu snt)trtrif3iatom rau o;t  2uoir oydopeelnvs (  Dtmu  oo4tet moctldlm uanms u4tlenir tytlateanesl(0tetmxo3ou4llenmfvtat)aDtm(rpoo1tlt mociadls rm(vs;(0tlxomrcoatomDraivs;s0 eurirpny1am emfcs s s2tauront4opeomfeiltfa rl( o ()tetomoctotoa e u i;s)s2urxr iu4lme lnvtas a2rrxmoot4tex ifcilt s ua(monu0texnir3iytfpD  nes;(  rtm(m3iy1al e fvt sfarua(mpnt0oetn fciytla rl( snu0alenxrctodfp   n s;s)trurimpny4ll nlfci t sDumxrp;u4aee ioeilsfs2rl( onu) rtomr iodfaD aneo t0 eumimpiy1ll nlfvsatfsrurxmpou1tle  fcilt a ra(ms ()tlxrxo iydlaDeauvs t s2uo(o ny1ole lneilsfarur( pno1opxoif3iydla2um(vo;t)aetnmr iodomD  uvi;()teuoirpno4ap nmfci (  Drrurp;u1oeen ictasfa ul(mo t4 leoio io1fmtr uvsl( sexrimpny4lp  mnvsa()srrmxrpou4texnmo3ild s em( o t0tetrmr oy1oa eanes;s0 eurxm3ou4ame  iei ()aDtaumpou1aex  feiysfs ul( s t) lerxr iydlpt  uvi t  rxoxo oodopenlicsls sDrmx p;o1alxomfeiyd mDemuvpn(4texnmr tatopD aivo ()t2ur(o iy4lm   nct t  2rm(mpoo0tlt mfetasfm rmn o t4arxnmoctadomD ln slt  2to(o3io1ale mncsls)a2ua(mpoo0tpto iciatlmDumuvs (4treniocoy1oate n o s s2tmxo oydaltemnct tf Dum(mo;t4teenii3tas m elu o u4aexnxf oo1fp elnvo s)sruoxr no4amenmfcils sDrr(  no4tpto iciasfm2uluvp ()trtomo oodfaDrauvs;t0s2uoimpoy1al  lfvt tfsrrax pnt4olto fciyt s2ea(ms (0 rtrmr iy1lpDr i s;()texoiopou1al emivsa(  2trxrpou4oet mociydlm rlu p (4trtoxf oatfmDr ieils0t2xrxopiu4ale  ivslt) 2ur(m oo1oltn i3tytla rau pn() rxnircoytlpD  nei s0 rumxo3iy4om   fvia(faDtmum ou0aexniociasfsDuan s t)alxnxf to1faDrluei t)s2xmxo3nu4lleelivi t)s2tmu  ou4opxnifcild sDranmo t)arenir3tadlp e ivo;(0sexrxo oy4lmenlfvilt) 2taxront1oeto ictyt m uln o u4alxrxf3iadlpD  i o s0 euoiopiudamtelies t) 2uaxr ;u1tptnmoetadfm eanmo u4 reoxf tytlat an i;t0sruo(rpiu4al n ics (fs2raxm ;u4tex iieiltfsDrmu s ()teermo3iytop rau olt0 euo(m ny4ol  liet t) Dumxmo;o0tetomiciat sDeanmp u4trtrmr iatlptr n slt srtr(r ou1ol emnvtat  rtrxr oo1teeoioeiadlsDulnmsnu0texnir to1fm eaivs;()trtrir3oudol e ieias)aDrrump;o0alenifctysfaDrl( sn(0 rtrmrciadoaDeanvo;t)t2xo(m3ou1opeemivsat s2ta( pnt1altomictytlsDra( s;(0treomr oy1om ran i;t)trurir iudol  mnct s s2urx p;o1tetn ieiasfaDuauvp;t4tlxoxfcoodlm  lnvols srtoio3io1ll n ncsls)aDtr( onu4tleo oeiadla rmn o t0 ltrxf iotfm  anvsls0teum(r ou1lpt miet ()s2umxmoot0oetn fctas m emnvo t4 leoxf ia1fp eli ils0setoxmpny4ll   fcsl()aDtmxrp;u4optn ietldfm emuvsnt)altnircta1late n il(  eur(opoo1ol emivs ()a2ta( pno1openmictas sDua(ms;t4aexrmr3to1lp e i s ( t2trxo nudop n ietatf Dumx o;o1openmo3tlslm2em( pn(0 leomf iodopD lieo;t trxmxopoy4omtemfvt t)s2rmx o;u4oex ii3tytfm2ra( on()texomo oy1la  au ols0trur(r no4lmt mnvt ()srrax  oo0alxnmi3tltlaDrmumpn()tetomo iotfpD  u o;()seurimpno1lmte fviat) 2rr(rpnu4tlenifeildfaDrlu p;t)artoxf oodlmDe uvs (0truoxr3oy4ame  nviltf rtmumpno1apxniieiyd s uluvo (0arermrcoy1laDrlnvi s)teum(mpno1ap  mfct () Drmuro;t1oetomictldla eauvs;(0aeenxfcoy1op e ivs;t)t2tr(m3iydlpt lfesl( sruaxmont0apto ietls s2uanvs;u4 etriocoytomD anvo;()trtrxm iu4lpe livsas)aruaxmo;t4oet iiciatls2em(vs;t0trxrmf oydfpD  nvolt)texrxm no1lp nlnvtl( a2tm(r no1oex mfetat s2elu sn(4 renxf3iadfa   nvi s srxo(o3iy1ame  fvtatfsrtmxro;u0oexo oeiltlsDeln p t)aeenxoctydom elues;s srtm(m no1am e ivt t) 2rm(  ;t0tpeomo3iytla ea(msn(0alenmr ootop eai s s)texo(rpoudaptemivta()a2um(m nt1oexoiieiatlmDrl(vpn(4aetnmo iatfmDeai o t  2uoxm3ny1lp nlnctasfsrtrxmo;t4oex  feiltfs2rluvp;u) etrxf iodop r ivo;( texoir no4al e nvs t)sDumxm ;o1aeeomfetadfm um(ms;u)aexnir3iotfmtr u o t srxoxo oydlptemies s) rraxmoot4alxnif3tltla ul( o t) ltnir oadfpteli o;(  rtm(m3iy1op  liciasfsDtm(r ;t1olxoifeiytlmDul( pn() reomf ta1fa   ivs s) rxr(m3nu4om nlivs () Dtrxmo;o1oltnmf3tadlmDua(vs;u4 rerif ta1lp rauei;(  rxoxm3iy1apt mnvi sf 2tax  ;u1oetoif3iyt sDulnvp () exnmo todfp elivo;t0 2xrim iy4alee ivt t)sDraxm no1ope iietad m ean pnt4 ltnmo tatomDeanvs;( srtm(m3iu1op emictas arrm(r ;o0alx io3ilt sDrl(mp u0artnmocoodop rlivsls s2tmxr3iu4omtn ncsl( sDuaurp;o4teeoio3iad a elnvon(0 eenmr iydoa r ieo (0tetm(mpio4amen ncs (farraxronu1aleniieias m ran o;u)aexrmf ta1fpD  ies;t0srxrxr io1optelfvs t srua(ront0altnmictasla2rl( ont)alxniocoodoa  lieils0 rto(m3nu1olt mics t) Dumu ono0aleniiciadlmDelums () lerxf oadfp ran sl(0 rumiopoo1omte net sfartau pnu0tlenioeildfsDumums t) ltomo iotlm  ln s;s s2tr(r iu4lpte icia(f rtau o;t1alenif3tys m2eln p;(4tlxoif oadlm rai s ( seurio io1olenmnvi t  rrrumo;o4aet  fciadla2eluvp;u4tlerif oatfmDelnvi;()texm(m io4altemfcsas)arurx oou1tetnifciltfs emn s (4arxnir3tatom eanes;()srtoxmpno4opt lfvi s s2trx p;u0tee  fciysfm2el(vo;u0 eenirciotfa r neo;(0seuriopio4amenlnes (faDumx  oo1teeo i3iatls2rmums;t4 ltrir3tytlpD li ils0 eto(mpno4ame  ictas)s2rmurooo0aeenmfcild s rl( o ()aetomfcootlat  ivi t setmimpiy4al  lfcsltfa2um(m ;t1aeeo f3ildla2ra(vsnt0aetrif3tydopDraivo;t0 2umxmpoy1omt  fci ( s2truronu4tpto o3tatlsDeluvs u)arxrir3iadfpD auvsl()setr(r io1lp  lfetl(f ruax pno4tleniieilt a2eaumont0aeeoxfcootla   uesl() eto(o3iy1ap  lfet tfs2rmxrpnu4altomiciydfa rmuvs;t4alxoircoydfaDe ieo ( srtrir3io1alen nctltfsDtax pot1apt mo3tltlmDua( on()alxnifcto1la rlnvi;t) 2ur(rpoy1ameemici ( sruaurono1tptn feiat s2uanvp;(0arxoir3iydom   uvs;(  rtrxm oudaptemfetlsf 2ta(  ;u0tptn octytfm2ra(ms ()tleomfctodfmDraueol( trto(m nu4optnliviltf Duaumoou4alxoiicils a emn p u)aeerifcoy1lpD lnvi t)teto(m ou1ol   fcsls) rraumpnu1oex ifciatfsDrluvsn() rxrif to1omDr u i s0t2xr(r nodop  mivilsfsrrmxr ou4teeoii3iad a uau snt0aexrio3todfaD  n ol()texo(o iy1olt lfcsa()srtru o;o0alxniiciydfsDranmo;u0altnir iy1fpDrlneols0 rtoxo3iy1optelncil(f rtmxmo;u4teenmieilslaDeauvp;(0 leoir3totfpteliesls  2tmir oydomt  nvsls) 2trxmoou4optnmictld m rm( o;u)teeoir iy1fm   neilt) 2ur(opny1aleemiei t arurx pou1aex mfctyt mDrluvp (0 reomrciy1fa rau o s  rumxr nydlm nmfctl(  Draxro;u0opeo i3ild s um(ms (4teeomociy1la elies t teuoxr oy4op  lncsltf Dtmu p;t0tetnii3tyt a rlums;u4aeerifctatopte neo t teurio ny4alt mivi tf 2uax p;t1tlt  octldla2emuvpnt0trenif3iadfmDrluvs;t0s2tr(o iy1am e fvtatfartmx onu4texomoeias sDum( s;t4 rtrmf3ia1lp e i s ( s2tmio iodamt lfcs t)arumumoot0apxoif3ilslmDelnmo;t)texrmrcoatfm  anvilt0srxo(m3io1al nlneiatf 2rau  ;t4oltn iciadfmDea(vonu0arxnmociotfa elnei;()trxmir iydale mfciat a2taum no4aetoioeiyslmDulnvp;t) lenxocty1la  au il(0 ruo(m iudom n nvt tfs2tmx ono0tetn f3iys m ea(mp;u)tlxrxr ootlp eaiesl()trxmiopnydoptelnvt s)sDra(r ;o1apxnioeiyt s rmn snu4 lxnmf3oa1lmte nvi;t)tetoxr nodomt lfviatfsrrrxmo;o0aeeoiictadfm2umumsnu0aeenxoctydlatranvils  2trxo3ou4ap  mnvsa()aDrrx o;o0opx io3tatfa ranvpnt0 etomo todlpDeli o;s) 2urio3oo4ll  
\ No newline at end of file
@@ -0,0 +1 @@
+iesls t2xoxm3iy1ole lfci t)a2ra(rpoo1tee  oeiytfa ranvsnt0aetomfciodoptr nvs;t s2ur(m3iy4ol e fvsl(fa2uru  nt0alx mieiatfsDrln s;(4 ltoxrctytlaD luvs ( seumxo nudlmenlfcs s) 2rr( p;o4aetomieiad aDeanmpn()trxrmr3iadoptr nvo;t0 rxo(opnu4lltnmneilt)aDurx  nu1apxn ociltlm rln o;()aexrxf3iy1lm e uvo;t)tetmir oodal emictasf Dua( oou0oleoif3tat a emump u4 exnmr3iy1omtelivs;(0srumxopoo4lpt livi s artmx pot0tptoioetadla ulu s;(4 rtrmfcia1fmtrauvols trxm(opno4op nmici t  rrmu ono1aptomf3iadla2emnmp () eerircoytlat ai i;()s2xmio oy1ap elfvi sfs2tr(  no0tpx mocild a um( p;() ltrxo3iadfptelu sl(0setoiopiy4am n ics sfa2tmuroou4tle mf3iatfmDumnmpnu4alenircia1fpDr ivo;t)srtmimpio1om   nvsas aDur( pot4opeomfeias sDel(mo (0aexnmf3oatoa eli ils trxrxm oo1ll n nvi ( a2tr(r ;o0opxoifciysfm rlumon(4tlxrmrcoadoatr nvs;(  etr(rpoo4apt mfvt (fsDua(mpou4texnioetadfaDumnvs;u4 exomo oadfm rlnvilt0t2tmxm3iu1optn nctas)srtrx pno4apx  i3iad s ean s t0trxrmfciotlp  lueil() etm(rpny1opt  nesas) Duru oot1apenmoctadls2rlu pn(4artnio3todlpt  ieslt  2xrxr3oy4apee fcsasfa2tmumo;o1apxnioetatlsDrmnvp;u)trtrio iotopteanei;t0 ruoiopiudol  mivtltfs2umumo;o1optnifcildls2emu pnu)alenif3tytlp  auei;s)t2uoirpny1lpe mnetatfarrmum ;u0oltoifciytfm2emuvonu4arxrxo3iadlmtr uvs t  2xrim oydolee fetatf Dta(rp;o0aex iociasfm2emump u4altnxo3ty1op  anei;()truo(o3iu1ape lnesa( s2ur(moot1tetomi3tad m2rmumo;t0alerir3oodla eauesls0s2xm(mpnydop  licils)a2raxm ot1tee mf3tydfa2ua(mo t) reomo3oo1lm rlnvi;t0srum(o oydoltemnes s)s2rmxro;o0tpxnmoeildlaDean s ()teeomocto1omDelnvi;( srxmir io4omen neil(faDtr(mpou4oetnmfeiadla rlnmo u0aetnxf iytfa e ies s0trtmir3ou4lptn nciat a2uax pnt1aee io3tldfsDumuvp t0tlxoif iadomD  ueil()s2tr(opny4amtelneils)aDururo;u0tlenifeiytlm2ul( s (0tlenxrctydop eauvi ( s2tmxm ou4optelfesls s2uru pnu4ale mfeilslaDeanvs;u0 rxrmrcoy1latean i;() euoxr3oudlmt mics t) 2taumont4aeen ictld s rmnmpnu4tlermo3tydomDr ivs;s0setm(m ny4aptnliei (  2trur ;u4aeto o3iys mDuanms;u4alxoxo totoptr ueol()srtoio nydll  mnci (fsrtrum ;o4tlx io3iadlsDumn sn(4artnxf3oatlate ieo;()s2toim oodlm nlfcs s)srra(r nu1aptnifeiatfa emump u4alenmr3tatla r nvo ( sexoir3nudlm nmiet ()sDtm(mo;u1tlt iiciydfa2uln on(0 exnmr tytfa  li ilt0sexrim oo4amt  neias a2tru onu4tlenmociysfaDrl( s;u0tleoxfciy1fmD an i t) etrim ou1optnmnvsas) Dtaxr ou4tlxoio3iyd a ua(vpnt4tlerircoa1oatrluvs;s0trto(r nydope lnciat)srua(r oo4oltn feiadfaDrauvo t)treoir tatfmDean s t s2umir3io4altnmfetat artmxm nt0oexnmf3tadfa ua(mp;u4tleoioctytfm ean i;s)setr(opiudol nmiet s aDrrxmp;u0tee mfeiyd s uanvp;(4 eerxr3oodomDrliei;(0 2trxrpnudomt mfvs t sDtmx  no1tlt  i3iltlaDran ont)tlxrif oytfp eai s t0trtoirpiodoptnmfvils)aDuaum ;t4aeeo i3ildfmDrm(vonu)tlxrxr oadlptrluvs;() euo(opoy4lpe mfci ( a2rmuroou0aexoifeiatfa2rm(vs;(0 renioctatlateauvs s0sexoxo3iodomen nvsa(  rtru pot0tlxo ietldlm2rm(vpnt4arerif3ta1fp  lu o t0seuriopoo1omeemiet sfarrmum nt1oeto o3ild a eanvs ()tlenmfctodom raivi;( srxrim oodom   iesat)srtax pnu1texnio3tasfmDulnms;t) lxomo oo1oaDean o;s0t2xr(m3iy4ap   nci s)aDtrum no1alt  feiyt a rmu s u) ltnxr tatopDeaivs (0 2xo(o3nu4apt mfei s) Dua( oou0tptoifeild a rauvsnt0arxnxrctadlaDelu o;s0s2xrxrpoodomeemicta() rra( pou4tex mi3iad a2rlnvont0tlenircoodlaDe neils0 etoxo3oy1omtn ieiltf 2tmumo;u0optnio3iys a uan pnu0 exoio oatoa r n o;() 2uoir3nydol n fes t)arraxmoou1aetomo3iys a ra( p;(0tleomrctadlm   i s;(0 eurim oo1aptnmivt s) Dta(rp;t0apt mietlt s2ranmpnu0tltrxrcia1lmD luei (  2trim3nodole mictasfaDraur ot4tet  oeiad sDul(vs u0areoio oytfa   iei;(  rto(opnudlm e nes sfa2uaumo;u0opt mietys s2rl(vpn(4 exrmrctadfmt aivo;t0tetmxr iu1alenlivsl(faDrr(rpot1oeen o3tadla2umump;u0 eenif iadfp  lu s ()seurim3oy4ap   feiat srurumonu1tltn fetytlaDem(mo u)arenio iytlateai il(  exo(mpnu1ale mnviltfsrtmx poo4apxn ieiat aDrm( o;() etnmrcoydlmt ai s;(0s2xmxmpiy1omtelictas)artau  ou1olxnmfctltfa2rmu o;t0alxnmr3io1laDelivs;t)sruoirpoo4apee fetlt) 2trx  oo0tptnio3ils m raumsnu4 etomrctytoat lu s s srtmir iodam n ncs t  rta( poo0apenmociadfm ea( p;(0aexoir oo1optrlivilt0seurirpou1lmen feilsfa2rmxrooo1alenifeiat aDra(msnu) rxnir io1lm eaiei (0sruo(m oy1llte fvt t aDtrxm ;u4tpx if3iytfmDelump;t4tlerxfciotoaDr uvols0 rxrxmpiydlltnmfcs ( aDrr( oou1tpeo i3ildfmDuluvp u)aleoio ty1lpt li sl()s2urim3no1ole mnei s  rrrx o;o0tptomoetytla2elnmp;u)aexrxrctotfmD lnvi;s0texo(r3nodop e feils) 2uaxr nu1aexo f3tyslmDumn pnu)aexnir3tatfmD  ieils trurxrpoy1amtemnvi sfartrxmont0olt iiciatls2rmu s;t0aetoircootfa elnes t0srxrirpiu4ome  iesat) rurxrooo1tltoio3iasfm ul(ms (0trxnifctadla ran o;t)srxoxopiudopee icslt  2urxrp;t4olxo oeildfa ranvo;u0arxoifcta1lmD liei;t t2toirpnu1omtelnvi tfa2urx o;t4tpxnmoeiatfm rlnvo t0 lenio ia1fmDran o;t) etm(r3no1ol e fcs t) Dumxrpnt4tex  ociyd s rl(mp;t0aeenmr3ty1fmDrlieo;s0 rtm(mpny4op  lfct s) 2tmxroou1tpt micild a emnvo;t4aexrif3todlm rau ols) 2xoio3ny4om nlnet (farumu poo0tpt mocias a rmn onu4 eenmf iydla  livo;s  rurxmpno4alt mieiat) Drmx  nu4opeomoeilsfa2um(mo;()arxrif iytoa  an i;s seur(mpoodll nlivt ()aDum(rpot1aee mfeias m2elu o;t0alenxfciytlmtelnvo;()trumxm3iudlptn feias)a2uau  nt4alt ifciatlm2raump;()texnifcoatlpt  iei t)t2xr(o iu1olenlfviltfarur(mpou4teeo f3iasfm rln p;() rxrmo3oytfa  li o (0s2to(opny4amt lnct ()s2umumono1tleo o3iltfmDrauvp;u0 exrio iatlaDeau i ( seuriopoy4amt  ietlsf rrm(r ;u4tpt if3tadlm ranvs ()tlxomf3ty1fatrau o;t t2tr(rpoy1al nmfcsasfaDumumo;u4oltn fetys s elump;u0alenircoatfatraivo s sruoxrpoy4olt  fvs t) Drax  ou0altn fetatlmDumumont0altnxfcoadop elnvi;s srxoio3oo1lpenmnvil(  Durx poo0ale iiciysla2emu onu)tlermoctadop  an ol() eurio ou4amen icil( sDtrx p;o1olx mf3ias m2ul( p;t4 etnxrciodlpDelu o () rxo(m3no1ame mfetl(farta(r nt0alxnmf3ils aDua(vsnt0tlerif3io1fmt  nvo (0texm(m3iodol n ncs s) rtr( pou1apt  feiys s emnvs t0trtrif ootfmDe ieil()srur(o iu4ole  ivsa(farrrxmpou4tptoioeiaslaDeluvpnt)teermfctotomDrauvs;s0 eur(r ny1opt lnei ( sDumum no4tlen fctas s2ranvon(0texoxfciatomteaivi;(0 eum(r3ou4llee fvi s)srtmx ooo4altoifetys s rau s;(0 reoxrciadlpDrlueo;s0 eumiopnu1lltnmncil( arrmxrp;t0oetn i3tlsfaDrau sn(0alerir oodlpDr ieolt0sruo(o3ny1ap elfct tfartrur nt0tltoii3iyd sDum(ms (4 etnxf3iatom   iei s  2ur(o nydll e ivilsf Drrx  ou4aexn ieildlaDrm( o;u)alermo3oa1faD aies t t2toim nu1amtnlneils)s2umur no4opxn i3ildfa2eln pnt0 rtoir3tadomt lues;t)sexo(m3iudop nlncslsf rtm(mpoo4oee iictyt m2ua(ms;(0 etrio3oadlat  ivi s) 2xmxr3nydame  neilt)sruau pnt0tlxnif3tytlm uanvo;(0arerir tadomDraies s0 exmxrpiodlpe mfctas)aDtrxrpnu4oeeo ocils s rlu p;(0alxnxr3oadlmtrlu slt0 2xmxo3iu1op nlncil(  2trxro;o0aexoiiciad m rmu o u0 exomr3todfpDe n i;t0t2xoim oo4lm n nvt t a2rrumpot1aexn ictad aDuanvs (0 exnmocia1lmDraivo ()seto(opoodlmtn fes sfsDua(mo;u4aptn oeiltfaDul(mpn(4tetoxr3oodoaD aueilt0 rxoxr iu1lpt mieia() 2umurono0tpxo oetld m rm( onu4aeeoif oo1lmD an s;(  2umxrpnu4lp emfct (fa2tru ono4oet  o3tltfs elnmo;t) etniocoydlpDrluvo;t0srtm(m3iy4ol  mfcs tfartr(roou1tlto o3iadfaDum(vont0 rxoiocootfmt  iesl()srumxm nu1apeelnei s  2rrxmo;t1aexoiociltlm umn p;(4trtnxfcio1oa eln ols) etoxm ny1oltnmnvtlsf Duaxm ;u4tptomocildls2em(ms t)artnio3iatoa  anvsls)sexoxo nu1lptelnvtls aDtm( pno0opt mfetad a2rmn s;t4arxnxrciodlmte uei;(  rum(m oy1ol nmnvslt) rur(rooo1oeeoii3tyt s2em(monu)tltrmr ia1lmDelieil(  rxr(opny4amt lnet (  rraum no1tlxoiicilslmDuln p;(4 etrmo oa1oate uvo s0trtmxm3oy1oleelfcsas)srtrumo;t4apeoio3tydlm eau s u)altomr iadlatelieols0 eurim oodll elfct s)s2taur ;t1opxoiieiltfa ul(vp () leniocty1fa eli ols0s2urirpny1lmt lnes tfa2rm( pno1tlxnii3iltla2rm( p t) ltrxr iotfmtrlueo;t0s2xoxrpny1alt lnvt t a2taur no0tleomo3tasfm2rmu s;u4alxrmo oydoa rlues ()texrim nu1ol   fvilsf 2rmu onu4aeenmf3tlsfs2eln o u)arxomf3oytomD li il(0srtrio3oydamte iciasf ruau  ;u1tleomiciasla rmuvpn(4tetoifcoydfmD  ueilt0s2uoim iydlp  mivsat  Dumu oot4tlen i3iadlmDemumsn(0alxomo3tatlp elueolt  2xo(r io1lp n neilsfsDrau  nt0opt io3ildla2el( o t4teenif3oo1lmDe ivs (0tetoxm iy4am emivsl( aDuax  oo1ope  ieias m2rluvpn(0treoxociodlpDelnvolt0srxoxo iodlmtelnci t)arta(m ;u0apt mo3iytfm2emnmo;(4tltnxr3ootoptraivo t0trtrxo3ny1ole mfvils)a2rrxr ou0tlenmictaslm2uau p u)tlxrmo tadopt anvilt srtmxmpou1ape lnvia(fa2tr(m nt4tee  i3iysls rlu p t) ltnif oa1lmteln o s0 etmxo3iy1olt liet sfa2tmxrp;u0tpt if3iat a2eaump;t)altrmf3iydfatr i sl()t2xmxmpny4lptnmfcta(f Dra(m oo4tpeoiietydla rm( ont)arerxf totla eau ol()t2umxrpno4lp e fcslsfaDur(mont1tlxomoeilt a2eln snt0trermo3oo1fm elueil(0 rxr(mpiy4ol n fvtat)artmxrono0altnmicild s2ra( onu4arxomr iydfaDrlies;s s2trxr oudlpenlfcia(  2tru p;o0tee if3tasfaDrm(ms t0arermf3totlpDe u o (0srxmxo3ou4ol   ietasf 2rrurpoo0tetniieild a2emnmo (0trenxrcoy1fmteli i s  rtoiopoy1olte feil() Dtrxr nt4aeen ocildfa2um(msnt)texoxfctotoa elu ilt trxoxmpoudoptnlnctltfsrtm(  oo1optomi3ilsfaDrlnmpn()areomo oatop  au o t t2trxopnydopt lnesa(farrau onu0tpx moctlsfaDul(von(4tlerxo tytlm ranvo s) etoio oy4llt lnes (  Dtruro;o1aleomi3tyd s rmn s ()trtrmf ia1fp   nvo;()s2umxo3nudomte fviatfs2ur(rono4aleniiciysla2uau s;(0tetoxr totlm elivs t0 euoxr3iy4llte fcils  rumxrono0tlt  ieiatfs2uaumpnu0tlenxo3oytomtrauei s0 2xoxo iy1ap nlfet ()sDtmu pou1apxoio3iyt mDuan o;t4 lenxf iotom r ueo;t)texmxopiu1lmtnlncil( sDuaxmpoo0tee  ictyt a2ranvp;t0areoir tytoaDeln i t)s2umxr3nydomenlfei tfarumuronu0tlxomi3iyt a rlnmpn(4tlenmr3oodoatean s;t  2uoxm nudom   fvsat)a2ururoot4tptoif3iltlm2rauvont)tltomf oy1omtrai i (0tetrio3iudol   ivt ()a2tmu ono4alto octlsls umumo ()artnxo iotfmDelnvs () rum(o3io1opeemfeta(f 2ua( oot4alen o3ilsfmDraumon() lermf3iotom e iesls setrirpio4altelfetlt)aDtmuronu0alt ifetatlsDeaums ()alxoxf oadfa  lies;() 2urxm3ou4ole mnviatfsDuax  no0olx  o3iasfa eanvs;u0artrxr3oodlpDrlivi t srumxr ou1ome lfci tfsrtrx oou0alxomfctys a em(mp;u)tleoxrctodlm eau s (  2trirpiudllt  fesltfs2ra( p;o1oet mo3iysls2ran pnu4alxoxocta1lmtr n s s0setrio oo4amt mfctltfs2uaxmp;t0olxo oeiys sDrlnmp;u4tleomrcto1faDeai o;s)srurimpiy4al emfvtl( arrrxrp;t4oex  icilt m eaump;u4tleoircoo1lmteli o s  etrxm ou4ll nmivtls a2tmurp;o0opx mfctysfa2ul(vs u) reoxr3to1lmte nvi;s sruo(m iy4llte fciltfaDua( ono1tetomf3tldfa emnvp u)teenxfctatoa e uvo s trur(m oodlleelncsls)s2umumono0tpx iiciad mDrlnvo t0artoir io1lm   ivsl(0t2urirpiodll elfcsl()srrrumooo4oexo ictld s em(mp;t) exrxf iatlptelivi;( seum(rpoodop  lfet t)a2urxmpou1tpen octls sDrau o;(4aetrxr3tydfmDrluei s  rxoxrpiy1lptemncsls)s2ur(rpou1teenmo3ilslm2rln s;(0treoif3io1oaD  ieols)t2uo(m3oodamtnmnvs (  2um(mo;u1tpxoifciadlm umnvp (0texnxo iadfat aues t) rtmxm3iy4lmt micsa()sDtax p;u1olxnmo3iytfs2ulnmsnt)tetnxr3iadoptrlieil()sexr(m3oodom elivilsf Duax pnt0opxomoctytlaDemnvpnt) eeomfctotomt ln i;() rtoxm3nydaltemncs t)artrx  ou0tlt  i3tysfsDum(mpnt) etoifctadfmteaueo s) 2uoxo oo4ol  mfetltfsrum(moou0aex  ieiysfa raump () lenxr iytfaD  nes;( teuoio3nudap  lncsat sDuaxmpnu4aexnmf3tadlm um( p (4 lxnmo3ta1late uvsl(0tetrxo oy1ape mfvsasfs2uru pou0oleomf3iasfaDranvsn(4 leoirciatfmDr uei s trxmio no1alenlnvtas a2rr(rono4oet mieiydlaDuan o;u0 reomfctadfpD aivo ()texoim ny1omenlietas) 2trurpou1apx mfeiysla2elnmo;u4aetnxf tatlp rluvs;(  rumxr3io4opt lieia()sDtm(r ;t0teenmoeiad mDrlnvs t4aexoxocoo1oateli i ()srtoxr3oudopt  ivsas arrmu  nu1tlxomieilsfm uauvpn(4aleoxociydomDrlnvs;s0 2toirpiodam  lnciatfa2taxm ;u1tpxn iciadlsDrm( snu0trxrxo ta1lmt luvi;t srxm(o3no4lme lfcsa() 2ta(rooo4tet ifcilt s em(vp;t4 ltrio tydlatr i o;t)seur(o iy4lmtn feilt sDur(m ot0aexoioetlslm rmu s;t4teeomr ta1lmDranei;t  exo(m io1am emnctas s2um(ronu1alt iocildlm2ra(mo;u)trxrxo3iotom r i ilt) exoxo3no4ol e feslt)aDtaxm ;u0opx if3iltfmDemnms u0 rxrmr iydlate nes;s trxo(mpoudoptnlfetls)sDtmurpot0optn ociyd m rlnmp;t4trenxr3iotfptrai ols trxmxm no1aptnmfvtas) rrmxmonu0tetnmieiatla ra(mo u4teeoxfcoo1lmt liei s) rxr(m3io4altemfeslt)a2tmxroot0tleomoctydlm eluvont0aeermo3oatfatelu i;s0s2umxmpno4olee ieias srrmx  ;o1apxo feiydfs2rm(vs (0 lxnxoctatlmD lnvs;t  etoxrpoydalt lnvsls)sDtmxront1tlxnmi3ilsls rlnvo t0 rtnxf3ta1lmD  ies;s  2xo(opny4lm nlfvias) Draum ;u0texo iciat s2emuvp;(4 ltoxfciytfpteauvols0teuo(r iodaltemfvtl() Dtau ont1oeeoii3tltfa ul(msn(0 etrif3iotop eaieo;t srxo(m oy1al n fcs t  Drmxr oo1tle ifciad m2uau snu0aleomr3oydlm e i o;t  2tmxopnydlptelfcia()arrr(m nt0openifetadfm2eaump;t0teeomfcoa1lptraneo;()s2toim3no4apeemies t s2um(r ot1tee mfciydlm uanmpnu4treoxo oatfa rlues;()srtrxr3iudllte ncil()a2uaump;o0apto ocildfsDeluvon(0trtoio3oodlaDeau sl() 2xr(m3nudap n iesl()arum(  nu1tpe ii3tydla2ra(vp t) ltnxr3ta1opDrluei s  2um(opnu4amtemneilsfs2rax ont4tpenmfciatls2emuvsnt) rtoio totfpt  ueil(0tetr(opiydlltemfeslt  rrmxrooo0tptnifciasfaDemnmp;()teerxf todopt aivi;(0t2umio3ny1ol  mneiasfa2tr( ont4tetnmoctas mDrlums t0 lxrir3iotoa e uvo () exoxo ny4al  lfesls) rtm(rpnu1olto f3ildfa eanmo u4alerifciatfaDrli s;t0srumxrpny4omt mneslt aDuau ont0texo iciyslmDrmu snu) eerxocio1omt lnei t0 rxo(r iu1olt lfetasf 2rmx  no0teto o3iltfmDra(vpnu4artoxf3todoaDrlies (0sexmxopnodap nmicsltfsrraump;o0oet mo3iadls emnvon()teeoxr3io1lptr nes;s0t2uoir3oodlm elfcsl()a2rax  oo1alenifctatlm2ul(mp;t4aetrxf3iatfpDraivi s  euoim iu4am  mfcil()a2urxrpot0ale mictydfmDea(mo ()areoio tytoa rlu s t0seuoxmpiu4lme mnviat  2ua( o;o4alto f3tydfm uanvo;(4 renmo ta1fpD li sl(  rtrim3iudalee nesl()a2tmxro;u1tpt moeilsla em(ms t0 etnmf tatoptelnes t)s2xmirpou4altelfesls)arrmx  ;o1opxoifctldfm2ra(mp u0trxoxr iodfmDe u ilt)srumxrpoodaptelfvtatfaDrrur ou1tlxn fetytla rln s u) rerxr iytfat livi;s0s2uo(o3ou1optnlictatfaDrrum oo1aetn oeiysls emuvonu4 etrif oadfaDeaivs;( t2trxo3oo1llee ictls) 2rmxm ot4tlx mocilsfs ea(mp;t) eenif3ty1lmD  n i (0 etrio3nu1alt lnesl(fsDur(mooo4olt miciytlsDelnvpnu4tlxnmf iydfmteluvs (0setrio ny1am elivsa( sDum(r ;u4olx mfciat s2um( pnt) lermf iytfaDraneo ()seto(mpoodapenmnvtatfartr( poo1aexniieiadls2ranvp u)tltrxr3ta1laDeluvo;( texrio iu1alt mivilt)sDrr(monu4tetnmiciyslmDea(ms;u0areoio3tydopteaues t0 exr(mpio4lmeelivta()srua( p;o0aexn feildfs emnvsn()tlenmr tytomteai i;t0 2urxo io1oleelictas)sDrmxro;u0alxomiciyt s2umu sn()teenmr io1fa elueo;( tetmio3io1openlfcilsfarraxmo;t4opxnmoctas s2rl(ms u0 lerifciadlp  aivilt0truoxr io1lp  mietatf 2tr( onu1aex mo3ils a2ra(mp;u0 lenmfcta1lptelnvi;(  rum(opiu4altemnetat  ruau  ;t1tltniocils s eauvs;u0tlermrcoatomtrluvs ()s2xr(r nu4lm emnet t) 2tmxm ot1tetnmfeiyd a2rm( sn(4arxrif3oytfmDrlneo ( s2xm(opoo4omeelfvslsf rrr(mp;u1aptnmoctat mDul(mo u4arxrxocootop ran ols)srurim io1lptn iesas)sDtr(mooo0ale mociadla2umu o;()aexnmr tadoa rlnvilt  2tmxrpnu4ap emfeil(fartau  no0aeeo ieiltfmDumn s t4alxomf3oodlpt aiesls0 eum(mpiu4ame  ivsas sDum( p;o0aexomoetasfs2ean p;(0texomr iodfptrlneilt0trto(m3iy4lm nlieil(  ruru p;u1olenmo3tadlaDeluvp u0aleoxo3tytfpt  n i ()trxrxm nu1al  mnciat) rra( p;o0apx mf3ildls2rluvonu4 etrxfciydomDrlivols trxr(o oudapeemicias) 2rr(  ;t0tpxniiciytfaDrm( snt) lxrmf iydfa  lu s;()tetoxo ny4llee ivtls)a2rr(  ;u0aexo i3iat a2rmnms u4alxomr iydlmteaiei;s tetoir ny1omt  ivtls) rtaxmoot0opt mfciaslaDuauvo;u4aetnio3tadopDrluvs;(0srtoiopny4openlfct t)sDrax ont0altomfcilsla2el( p u4 ltrmo3ia1fa e i i;t) exm(o ny4am nlics ()sDraxmonu1aetnmf3ils a2emums;t4 rtrxociytfaDr
\ No newline at end of file
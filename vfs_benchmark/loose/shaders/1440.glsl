@@ -0,0 +1 @@
+i o;s trxm(opiodllte fvs (  rraxm ;t4ope  fetlsfm rl(mp;t4tetomo3ia1fa e n olt  rur(r3ny4al emfei tfs2umurpnt1tptoif3tatfm ulumpn()aleoif iodfa  ln i;t trxriopoudlleelictltfsDtmxrpou4tpx iicilsfaDrm(vpnt0texrir3oodla  lnvols0t2urio3oy1om nmivs tfaruru o;o0ape  ictyt sDeln sn() lxriocoy1fmDe nvi;t sruoxopny1llt mieia( sDrmu  ;u0alxomoeiasfm ulums u4 exrircta1fm rlnvil(0t2urxr3oy4lltemivilt)aDrau oot4aex mi3iltls2elumonu)teermo ta1fpDrauvi;t0srum(r iu4al nmfei t arrmxmpoo4aleo ieils s umump (0 rxoir3oadlptr ivo () 2tr(r no1op  lfct s) 2umxr oo1opx mfctldla2ul(ms;u4 ltoxocoadlmtean ilt0texm(mpoo1lmeelnvsatf 2rau pnt1texn fetld s el(vp;u4 rxrir iodoateaies t  rxmxrpio4apeemietl()a2tr(rpnu0tetnii3iltlmDuanmsnu0 renxo todlpDe ivi (  2xoir oudam  mfvtas) rrmxmonu0teeo fctat a2ea(vs t) rxrxo ia1fa rlnvil() rtrxo oo1alenmfeilt  2tr(mpot1aeeoiietldfm2uanms;()altomo oytfateanei ()s2tmirpoy4llt  neiat)aDrruro;t0oexn oetydlmDem(vp u) rtrirciadfptr uvilt trumxo iudom elncs t  rumuroot0tlx mietadfsDulnms;u0areomo tytlpDrlivi s  2umiopio1om emfcsls srrrx pno0oltoio3iatfaDulu snt)aexnxrcoatlaDelnvo;t) 2toxo3ny4opee ivs (  rrmxr ;u0tet mo3iyd sDuluvo u)artrxfctatlpD  i ils  euo(o oydom nlfetas  2raxmono0tpenmoeild s um(vo u4 rtnmf ootop ranvs;(0srtr(r oudol elfvtltfa2uaur nu1tpen feildla rlu on(4aetomf oatlp e i il() exmim3ny1omtemnes t a2tmxr oo1oltomociatlsDul(mp t0 leomr tytopD ai i;s)trxoxrpnodomt  ivsa()srtmx ooo0texomoctyd m um(vpnu0aeeoifcoydopDe i i;s) rtoxopno1llenlneslt srraurpnt1teeomf3tlsfa rlnmp ()treoxfciadlate uvo;s0 rxoirpio1olee fesl()s2uauro;o1aetoioetyslaDrln p;t4teenxoctotlm e nvs t0tetrio3nu4am  livt s)sDur( p;t1optn ociysla2ulnmo u0 exnxr iadop ean ol( t2umxrpoydam  mics () Draumpno4tlto f3tadfaDrau on()tleomocoadoptraneo;t trtr(mpiudamtn nctatfsDur(  ou0tetn fciys mDrlnvs u4texnxr tadomteliei;() eumir io1optn ivsas)s2rmx  ;u0olenioeilsfa eau onu0areoxf oy1lm   ues (  rxmxrpiu1ap  mncslsfsDumx  nt1tltnmo3iatfa2rmn snu0tltrmocty1oate i ol()tetrim nu4ll n fcsatfaDrru o;t4altn ieiadls2umn o;(4texomo3ootla  auvs ()trum(mpiodalee feias) Dur(rp;o0oeenmoeiatfsDel(vs (0tlxoxo iadopD  nes t)t2umirpiy1lmeemneias  Dtm(m nu4olx  oeiys mDra(ms (0artrxr3oytoa elueo;s)texoxmpoudal nlicsa( sDtmum ou4tptnmoetad mDrmn p u)tlxnmo tadop  anei s0t2xmxr oudlptnmicilt s2rmur ;o4apxomieiyt aDrmu s;() leomociotlmDr uvs ()teuriopiy4opee nct s)srtax ooo0oeen fctldlmDrlu onu4tlxnioctytlm rli o t0sexoiopnu4omen neils)arrmu  ;o1teeo octlslm2umn on()tlxoxf3oodfate n ils)texm(r oydoptemivsat)aDrr(  nt1oex  ietad m2ulump (0alxrxf3io1fpDrlies;(0trxrxopno1ome lnvi tf 2rax pou4olxo f3ilt s ulumsn() eenio3oy1lmD lnvi (0trumim oudlptelnesasfarrrxr no1apxnmi3iadls2eanmsnt0 etrio oatoaDe n s s0teurir no1altnlnvi sfaDraxronu0texo oeiatfs2ulump u)trtnxf3oatlpDrau ilt0seurio3iy1lme lnei t s2rr(  oo1tpt ifetysla em(vo;u4aeeoio3oo1op r u s s  2xmiopiodopt mfeiat sDurur no4openmo3tas m um(ms;(0alerif ootopteln il(0sexo(m3oo1lpt  fcsas) rrrx p;u4oee moetls a eauvsn()treoir ty1lmteaivs;(0 rxoxr iydoltnlfct (fs2tr(root4tlxoifetydfs rln pnu) renxr todlat lies s0 2umxopno4ap  lfvi t)aDra(ront4oee iociydlaDel(vs u4alenxrctotopDr uesl(  euoxo oy4ale mnviasfsDua(r ;u0tlxoioeiltfs ul(ms;t4 ltnmf iy1lm rau slt t2umir iudolenmnetas) 2raurpno1tleomf3tld s ra( o;(4 lenir3oodfaDelnei;()srum(o iudam  lfcsatfarum( p;u4oltnmi3iysfa2ra(mp () rermr3tydfa  an o ()seuo(opoo1am  mnvsa(fsrumum no0opt mi3tysls ulu o;u)tlxrir3oadlp rauvslt)t2xm(o3oudopte fvi sfartr(m nu1olxniociadfmDuluvpnt)texnmf ta1fate uvs (0s2ur(o3iodlmtelnvi s) Dtrxmp;t1apxomieiytfs eau o;()artnir tydopD  n ols)s2uoio3iydam  mivsat)arra(mont4olt mfeiyt mDrau s ()altoxfcio1fmDe uvi;t0sruo(o iy1lm n ictltfsrra( ooo1apx mfeiydfmDuau p t0aexoio3io1lmD luvi;t0 rxriopou4llt  nei t) Dtau  ;u4tetomocils m2elu p;u)tlerif totlaDrlueol()trxrxr3iu1ll emnvtlt)a2ua(ro;t4tptoioetlslm emu o u4arxrif3oytfmt aieols t2xm(mpoy1lpe mneta(fa2rruro;t0tex mi3iyt m rlnmpnu0 ltomf3tydlmD  ieo;(0 2uoio ny4am e fei ( srrmum ou4aee ifeiad m rmnvp;u4aexomf3oydomDe uvsls)sruoio3iy4am elncsltfa2rrxrpot0tlxoifciydla rauvo;u)texnif ty1optr ivs (  rxo(o no1optnmnesa()arrmu pou1tpxniociydla2rlnmpnu0arenio3oytlm eaneilt0 rtr(rpoy1omt  fvilsfartm(mont1tlx mf3iysla2uauvs;u)treomfcoydomDrau s;s0s2tm(opiu4optemnvtlsfsrrrur no4aee mo3iltfmDemu s;t) rxrmf3oatopt au olt0srumxo nu1lme mncil() rtr( oot4alto o3ildfsDrlump;()altomo iotlaDrlueolt s2xr(o oo4lpt lnvia(farrr(mpno0aex ifctadfs2um(vp t4artnmo tatlpteaivo;t)t2triopiu4am e nctls) Duau onu1alto oeiysfs rmu o;u)tlerio3to1laDelu ols0t2xriopnudoltnmiesatfsruax ono1openiietls m2rln pnu4 rtomf io1fa eanei s srxrio3oudamt  feilsf Drrxrpoo1apt  o3tls a rmu sn(0tlxrxrcootfaDe u i s)texo(rpoudll   icta() 2rm(mo;t4aexnmfctad mDran s;t4tlxomrcoo1fptean s t)trur(m3nu1ome  nvta( sDua(mo;t0oexnio3iltla emu pnu0artomo oydopDelu i;t) 2to(m oo4ap e iei t  ruax  ;t4tetomiciyd sDrluvs;t) lermo3oa1fmtr ivilt t2xrio3ny1am emfcs t)sDuax  ou0olx iictysfmDraums;u4 ltrirciotoaDrlneol(0t2xo(m3iu1lm elnvta( aDumu oou0aeeoiociltfm uln s;() rerxocto1oaDelueo;s srxr(rpoy4lpe  fviatfaDtau ont1tptniocildlsDulumsnu0texomf3iodfm  aueols trxm(r3oy4am n ivtasfaDuaxmo;u4oet mf3tad s ra(ms;()altnir oatlp   ivo s teum(r3oodoltelfctatfarurxmo;o1teeo f3ils s rm(vo;u0artnxrciy1opD aueslt)tetoiopoydopenlictlt) Dumxro;u1alxoiieias mDrmumsnt)texnifciytfpt  ies t  2trxmpnydamee fcslt srtmu onu4oee ioeilt a2elnms u4texrmr3ty1faDeau o s0srxmio ou4ape mnvslt arumurpno4ape  fciat a ea(mo;u4 etnmocty1oatelivsl(0 euo(m3iy4omtnmfeil( aDtrurpot0oexo octys sDranvsnu0 lerxr iadlp  livs;() 2uoim3ou4omtnmiei tfsrrm(root1aee mfcilt m ua(mp;(0alerio ta1oa eaueo s0 rto(r3oy4lleelnct sfarra( pnt4alt  i3iat a eaumonu) reoiociodopt lueil( trtmio3iy1opt lfeiatfa2tmx oot4aeenio3ildls ulums;u4 rtrmrctytlat ai il()srurxm3oy1omtelnesat srrm(mpot0oee mfciad a2uln snu) exrxfcto1lmtr ivols)texmir iu4olenmictls  Drrxro;u4oexnii3ildlsDumn s (0trenxocio1laDrai o (0sexrirpnudlm nmnesas arrmum ou4apxn ociatls ea(mo (0trerir todoate nei ( trxr(m no1ol  lncias aDrmurpnu1oeen ieias m2rl( o;t0altrmr3io1omtr n il()t2uo(r iydamte fet tfaDrrur nu0altnmo3iytla rlu p u4texoxfcoy1fm r n olt srurxr3ny4op emiet () rtauroot4oet  ietatlm rlnmo (4treoif3oodlmD lu o;t  2xrxmpnodllenlneias)arumu p;u1aetomfciasfm2elu p;(4tetoir3ty1oatrliei;( t2tm(m3nudope mfvs tfsrrmu o;t0tee iictat s uluvp;()teeomrcia1omD lnvi t) rtm(o no1op n neil(f Dtaur oo1olt mfeilt mDrlnvp (0 lxnir ia1oa e uvs;(0s2tm(r3oodap  lfvslt artrxm oo4tptoii3iat a2ua( s;(4 rtrmfciytlmDelnvi s) 2um(mpnu4apenmnet ()a2rm( ono4texo oetlslsDea(vonu0aetnxr3tytopDe u s t)s2tmim3io1lptnlnct ( sDurx  no4tlenmociydls um( p u)aexnxr3io1oat luei ( sruo(rpnu1lltemivtas arta(r ;o1tetn fcildlm umn o;u0 renxrcia1laD  nes;(0setoir iu4ap emivtltfarrrxmpnu1texn feilslm2ran p u4arxnmocoodfmDe n o;(  etrxrpoo4omtn fcia(  ruaurp;u4oleoifeiltfs ul(mon()trxomr3oytfmDrlnvs;s  2ur(opnydole  ici s)aDrmxmooo0opto f3tltfm2rmnvo t4 rtnxr oy1omDe iei t  exrimpny4optn ivtl( s2uax ooo4ope iieiltfsDrmu o;u4 lxnmo iadom e ueilt texo(o3ny1op  mnesas  Dtmur nu1ale miciasfaDea( p t4areoiocoatop   u ils0srtr(m iudlpe miet (f 2trxr ;o4opxo f3tyd sDea(mo;t)aetrxo3ootop  an s s trtrir3ny4ll nmnes (faDua(ro;o1tpt ii3iasls em(ms;u4 etnir io1faD anvslt0s2tmimpiu4opte fetl() 2tr(ro;o1opx ii3iysls2uanvs t0trxrio3oydlate ieo;t  2xrim3nudlmee nvtasfsDurxr ;u0olx mf3tytfm2emn s;t0 eeoxf3oo1lptean i s s2umxopny1lmenmnvtl(fsDrrx  ou4oleomiciydlaDulnms;u4areoir3iy1omt lueils s2toxo iy1apenlnet tf Draxrp;u1optnmoeiys s ua( ont4 lermo3totopD ai s;s)texr(o oydlp n ieia( arumxm ;o4aee mociysls eau p;u)tlxoiocia1fa rlu olt s2toio3iy4ap nlfcils) rrax  nu0alx  ietadlsDrauvs u)trtrmrcto1faDr uvolt  rto(o iu1ll nmfvi sf 2rr(rp;u4olt mietasfm2rau o;u4alermfcta1fp raues t0t2umxr3iydlptemictltfsDumuroou1opxo ieiydla ra( p u)alenxo ty1fmDelivo t0t2uoiopnodam  licsas) Duaxro;u0opxn f3ild a2um( p;t)tetoio tatlp  luvs;( t2umio3ny4lmtnmiei t)aruax o;o0aee iociaslaDea( s;t)altnir3oy1op rln i;t t2xoxr io1oltn feil(fa2rr(  ;o0olxoii3iatlsDranvp;u)alenmo3oodlpDe ues;t0tetr(o no4llenmncsl( a2umx p;u4ape mo3ilsfm2ean s;u4altriociotlate u ilt)teuoxmpiy1aptnmfeils arrr(r ot1opxoifciysla eauvo;u)trtnmr3ia1lpD lieol(0 2urio nydaptn fvils  2tmum ;t0opxo fetat aDuanms;(4texrxo tadomt an s t  rxr(r ny1ame mfvsat  2umumont1alt  ictlt sDelnvp;t0 renxr iadlpt anvsls0 eurir3ny4ale  fctat arrm(r nt0olxo fetytlsDranvpnt0 ltnif oadfaDranvo;(0s2urxrpio1omee nctls) 2rmump;t4tpxomf3iaslmDulnvo (4alxrxr tadlpDrau o s0 rurio3iu4aptelnetlt)a2ta(mpno4oetoifetydla2emnmpnu0 rxnmocootfmDelneo;t srtr(m3ny4om nliesls artaxm nu4aee mi3ilt m emuvp;(0tlenxr oytomteaivol()trxo(r3io1lltnlictat) 2rru pou0teeoiieiytlmDelnvsnu0aeenxr to1fpD li i ( trurxm3oodopeemiet t) Dtaxmpoo1apx io3iyslaDrlnvo;u0arenxocoy1lmDr nei ( teum(mpiydlleemncs t s2tm(mono0tetnmfeiadlm2rl(mp;t)aetoxf3oodfaDeanei s)srxoirpiudop   ivslsf Dtr(rpno0aleoii3tadfm2uanvont0texrxf io1fmDr nvsl( setrxo oo4lmte fvs t)sruaumont0aptoif3iytfm2ra( p;u0arxrmo oy1om rau o t0s2xm(mpnudoltelivs () ruaxm ;t4tex mfeils sDeauvs (4arerir3todoaDeanvs s0srxoirpno4om nlivt ( a2ta(m ;u4opto fciaslsDeluvp;t0arerxo io1laDraies t)sruoio3oudll n fet ( a2raur no0tlxomi3tatfaDelu p;(4 rxnir oydfmtrln o s)teurxmpoy4am elfetas)sDumx ooo1olt mo3tat mDeau o;t4 rerifcoytom  au i;(0 2xmxopno4apt mnetl(fa2rrumont0aex  f3iltfm ua(vs;(4aeenmo io1fm   nvo;()srxo(o3iu1ameemneilt)a2tmuro;u1oleomfeiadla rmnvp (4treoxf3tadopt  uvo;( t2uo(r oo1alenlfei (  rtau oou1tptnmfeilslmDemnvo u4 eeniocoadla rlieol(0s2xrxm iu1ap nlieil( arta(ro;t1oltomfciatfa uaums;t)altrmrctytfmt lnvs;s) rxoir3iy1op  mncta()sDum(r ;t0apx  i3taslsDrau pnu) lerxo iatfmDeaivi s trtoirpou4ol  mnvi (faDtrumo;t4apxomf3tas a el(mo u4 eerifctotlptr ueo t0t2xm(o iudlm   nvils sDrm( p;t1ape ifciyt mDrl(mp t0aetnmfctydoa  lu o (0t2uoxopno1llen fetlsf 2ururpot0alt  i3tldlm emnmo;t4trerxf to1la r nvslt t2um(o oydaptemfvsat)arrmurpnt4opeoiociltls elnms;u0trxoxf oa1oaDelu s;s teuoxm oudlmen fctl(  rtmu ooo4oeenmo3tatfm elu snu4trtnxf3to1opt li i;(0t2um(m nudlle mnci t)sruru ont0tet moeild s2rmnmp;t0 rxrmo iotlm rliei s)t2tr(mpnudaptnmnci t  2rmxr ;u4tle mf3tls m2rluvp;t)teerirciotfp   uvi;s)truriopny4lme  ieil() Dua( oot4tlxomf3tyd a rauvo;t4altrmrcia1op e n s;( t2to(mpnu1lmee iciat)arrrumpno1texnmfciysfa uaumo;(0teenmr iatfate uei;(  2xr(o iydam  lfvs sfsrtrumonu1tptn ociasfmDranmsn(4 exrxr iodom elu sl()srxr(r3oudolenmivtls)s2um(rpot4oltomieiysfmDem(mo;()tltoxf oytlpD  ivslt)seum(o3iu4lleemncslt) Drru  ou4aexoioeilt sDuluvo u0altrmf totopD  nes;s) 2xoxm3oo4ll n icils)sDraum ot1tpen feiltfm emumo;(0tlenxr oytfaD  n i;t0teumir oy1lp e feil(fs2tmxmp;u0tleoii3tytlmDemums ()trenmo3totopt  ues;s0s2trio no4op e nci ( a2um(  ot0altn ieiasfa2ua(mont) etoxf3tytlm elueil(0t2xm(opiy4ll elnct t s2tm(monu0aleomoeiydfa2ul(vsn(0tlerio ty1omtran i;()s2ur(r3oudlltn nvt t)artrx p;o4oltnifciydla umumo;u4 rxnxf3oo1fa eai sls  rxr(o ny4alt mivsa( s2um(ro;t0teeomocilsfsDea(msnu4trxrmrciydomt an o t0sexoxrpio1llte fct s sDtmur nt0apen fetatfa ul(ms (0texrir3iytopte uvo s0teumim iodlptnlfvtl(fsDrmxr nu1olt ioetytls umu p t) eerxrciatomDran ol(  euoxo nydamt lnetlt  rtm(r ;u0oexo fetytfs um(mo u) exoiocty1fatrauvils)s2tr(opny1lmt mnes s sDurxrpno4oltomi3tysfa2eaump;(0 rtrxf oa1omt luvi t)s2xoxopiudop e ictl(  Dtau pou0apxn fetad m uan pn(0 lxomo iodlm   n il() 2xmxm nu1lptnlfcsa()s2umxm ot0aptn ociatfaDrlums u4 rtrircia1fmte ieils sruo(m3no4ome mivt t) Drru  ;o4altnifeiasfa2ulnmonu) rxoif io1lmt auvil()seumxo3oydapte nvta()s2uaur no4oetoioetys sDrmnvon(4trxnmrcoodomte ies;t) 2xr(o3io1om nlncta()s2ur( pnu4aexo i3tatfaDemumpn()treoxo ia1fmtr ivo;t)trxoxrpno1lmen fvtas)s2rr(  oo1ape mieilslaDea( s u0arxnmrciatla eauei;t0srtrim iudlpe lnes s  Dtm(  ot4olt if3tltla2uln on(0arxrir3oydfp rlnesl(0 2xmxm3oy4ome lfctlt srtauro;o4olt  i3iasfm rlumpnt)tltnmo3oytlaDe iesls0t2um(rpnodolte fct ()a2tr(  ot1aex io3iatfaDumn onu4 etnmo3oo1fpDe neil( trto(opiu1ol e netltfaDtmurooo0optnio3ilsfmDra(ms t) exoxr3totlmtr ieo ()trxr(r nu4oltn netatfaDum(monu4alxo oetadfmDel(vont0treoxf3iotopD aivi t s2to(opoy4optemicsat srumxrpot4alx mo3tldfm2rmnmo (4 ltnmr iadfpDelueo s)sexmxo nu4lpenliesa(f rtr(r ;u4aexnmoeiltfaDrmnvont0arenio3totfptraueo s0trtrxopoy1apen iesltfarum(mpnt4olxomo3ildfs2ranmo;t4aexoir iydlatelu olt tetoxm oydllt livtas  rrrxrpot4oee  oetytfm2umu snt)tlxnmr3ia1latelnes;( srtoiopiy4omtn fcias)aruru onu1altoii3iadfsDrlnvo (0arenxr3io1opt  u ol(  rtrirpnu4oltn neiatfs2urx  no4opx micild m eaump;u4trtrif3io1optranesls t2tmiopoy1omeelfvi t)srrru oou0olxnmiciatfa2eau s;t)treomf oo1opt aneilt sexm(rpoy1lpee fvtls)arrau pou4apto fetas a2ua(msnu) exrxf3ty1lmDr uvo;t0 rxoxm3iodap e nei (  2urx pot1oexo ieiltls em(ms;t)texrmf3iytlmt ln o s) exmxopiy4ap   nvil()aDra(m ou1aeen ocilsla uln on(4tlxnir3oy1fmte uvo;() ruoim iy1lltemnctlsfaDtax oot1tee ifctydfmDua(mon()altrmr oa1opDe n i;s)srtoir oy4amtnmfes sf rraxrono1apxoio3tydfmDeln s (4 exoxociatfateaneils) exoxm iy4lm  lietlsfs2rrur ;u0opxnmfeild m2uanmo () lerxr3oytoa rai ils0srur(m3no4ll nlfeiasf Dta(ro;u4opeoifciydlaDua(vp;t0areomf3ty1op  lueilt)sexoxmpoy1lmtnlivil() ruaum ;u4aetomf3iysls rmu s;() rxoxfciydfmD auesls) 2xmim3iodlptnmfvtl(  2ur(m nt1oexniieiat mDea(mo t0arxnmo3ootop eaivi;(0 2to(mpno1amtnmicsa()aDrrxm oo4tlxn o3iadfm rauvon()aexnxf oytopDe i ilt sexr(o io4lp  mnesatfs2rmxrono1aleo oeiadfs ea( on(0 lxoio3oodomteau i ()setrir3iu1olee fci (f rurxmono4tpenmo3iyt m2eaumo u4tetoir tadlpDr uvs;(0setrir iydll e neta(  Drr(r ;o1tpxniictltls uau s t) lenmr3iotfa elueolt0 rxo(mpny1ame mnct t aDraum ot0aeto iciadfmDeanvo t0 ltoxo ta1om raueils s2trimpny4olte nctasf ruru  nt4olenii3tat aDrl( o;u4aetomf oa1la  anei s0trumirpoy4lmen fcia() rtrumpou1apeniieils sDuaump;u)aleoifciadomDelues s) rumxrpoodaptelfesa()srumur nt4tex moeiatfsDumn pnu)arenmr oytoaD  n i t)seto(opny1lp emnesatfarrm(  nt0olx mfciydfmDel(vp u)trtnmf3iadlmDelivs;t0setm(m3oodlptnmics s srtaumo;o4alxomocildfs el(ms t)trenif3ta1la  aivo;t0 2trim3ou1olt livslsfsDur(root0tpx  feias a ua(ms;u)arxoxfciadfmDr nvs t  euoiopoydomeelfci () rurur oo0altomfciytla ra( p u)teeomr3tatfpt  ivi;t t2xoxo3oy4al elicsl(fsruaur nt0aeeoiociyt m2ulnmp;u0 lxomocoo1laDraiesls)texm(m oy1al   ies sfsrrax pot0altn fctyt mDea(vp (4 exomr3oy1late i s;t)trto(r3nudalt lics (f Drrumpnt1oet iiciys m um(vs t4tleriociatlpteli i s  etoirpou4openlics (fa2ua( pot4alxo i3tltfm ra( s (0treoxo oy1fat lnes;(0 2uoxo3iy1am elfcsl( a2rrx  no0tpxomoeiasfs2umuvonu4aexrmr3tadop  aueol(  rumimpiudll n fvilt)s2raumpno0tpxnmictyslaDrln p;t0 etrir3io1lp e ueo;t)teuoxrpiydam  lnviat)s2raxm no1tpe  oeiad s eau p;(0tltrmf3oa1opD  nvo;t) exm(o ny1apenlncta(  2trx  ou4tpeo ieiaslm rmuvs;(4aetrmo3tatomD ln s s)t2xrio3nudlltelfetl(farraxmonu4tpeomi3ildfs2ranvo;(4altrxfctadomD aieo;( trxm(r oodlle  ivsl(fsDrau  nu1olt iieiadfm elnvp;u) ltoir3iadoptraivols)s2umio3iodaltn ieiasf Duaxm nu4aexnmf3ilslm2uanms;u) renmf todla   i ol( t2umxm3nudamt lnci s  2rax  ou4optoifciltfs ea( s;(0 rxniocoadfptean sls sexoir3oodlp e iviatfsDuau p;t0texomf3taslm rau o () rxrio to1fptr neo;t  etr(mpnu4ol   nvsl(fs2uaurpno1oeenmi3ilt s2rmumont4 rxrxocoatlmDe ieilt  rurxo iy4ap   nctlt)a2tmu  nu1alenifcildfa2uln pnu0texoxr tatfp   ueil(0t2xrxopio1al  lnvslsfaDtau  nt0apx moeiadlm emuvont4 lenmrcoytopteanesls)t2xrxmpno1lltelnvsls)srtr(mo;o1tee  ociadfs rluvo;u0 ltrxf tydlat  ivilt0 rxo(mpnydlmtelfcils)a2rmumpnu1tet  fctls s2umumo;u0aeeoxfciadfm e neolt0trxoxopio4ll  mnciltfarurxr ;u0oltn f3iytfm2emumpnu0tlxoxrcootlmDe ivo t0s2trxm ny4lpenlfcsat  rta(  ;t4apenifciyt aDeauvp;t4alxoiocootlmteaies (  ruoim oodopeelici t  Dra(r ;u1optn oeildls uluvsnu)tlxnif3ia1lm e n ilt)s2trimpnu1omtnlivils)sruax  no4ale  o3tadfa2ua(mp;(0artrir tydlate u ol(0sexr(opoydlm  lfei sfaDurx pnt1teenmfeiyd m2rmn pnt0 rtrmf iytla r ivs t)setmir3nu4ll nlfcs sf Dtrum nt1alenifctadfs emump;u4 eermf3iytoaD  uei t0 eurim3iy1amt mieia(  2rmu o;t1tpe mo3tatfs2ea(mo t)arermr3iotomDelu ils t2tr(o iu1lltemnvi sfsrta(mpno4apt iociltfa ea( s u) rtrxo3to1fa eaneo;(0t2uo(rpoodopenmfeiasfsrrm( pnu4tltn oeias s2eaumpnu4areomo3io1omtr ivo ()trum(opoudapee nvil(  Dumu onu0tle mfcils aDulu s (4trtnxo oytlpD  nvo t t2xrxo3iudal nlncia()sDra(mpno1tex ifcilsla rm( s u4texrxocoy1late uvi;() rtrir ny1lp n nviat  rrrxrp;u1tet  f3ilt s2uluvpnu) rtrxfcoydfp eauvs t)s2xrxm3nu4ol  mfvt sfaDua( oou1apt  f3tad a raums;t0trtnmf ia1faDrluvs s0seuoxm nydam elfcias)aDumxmp;o0aee  ieiyslm umu p;u) etrxo tydomt luvs;(0srxoio nodap nlieilt) Drmxmp;t1aeeniiciatlsDean p u4trenxfcoydla r uei;s0teum(o3iy4altelictas)s2taur ;t1aetn i3ilsfaDra(vo (0tltoxr oytomt lnvsls s2um(o3iu4ol nmfesl(  rra(m no4olxniicilt a2em(vpnt0areoxf3ootoaDrai o () 2xo(o3oo1lmtn icsl( aDtmxront0alen octls a2emu pnt0 ltnmr oy1oa eai s;t srtrxo iy4lp nlfctas) Drrurpot0tpxomf3tat a rl(ms;t4trxomoctytoa e u il()trtm(m nodam  livsas sDtmxrp;o0tlto i3iatlm2rl( on()tltrmocoatlaDraiei s0t2ur(r iudop emfvt s  2tau pnt0olxomoeilslmDum( pnt) lerxrciotopt anei t)teto(m iu4lmt mncsa(fa2ta(r ;u0olxnmieils s ua(ms;()tetriocoatom r uvils0 2umimpiodlm nmncta(f rta( o;t4aexo o3tlsfm emumpnu0treoxo iatlpDelneils0trxm(o3nu1lmenmiesls aruaxm oo4aexn f3ildfm2rm(vo (4 eerxo3to1lp r n il(  2umxo io4lm elietat)aDum( o;u4alenmieias aDulnmp;u4tleomo oatoatrln i s0truo(mpoo4ameelicsa() Dua(m ;o4tpt mf3tltfm rauvs;u)altnif3oy1late ivi;( s2xoxopoy4ape mivil() rtaurpnu4tpx if3tat s2ra(vp;u4arxrxf oytomt anvs s) rxoir3iydlp  lnei tf rrmuront1altnmf3tldfa eanvo u4alxriocoodfa   nvo;s)setr(o3ny1opt mfeia(  Dtrur oo4optomictldfa el(vs u0tltnxf oadoateluei ()seumxopoy1lmtemietas s2rau pnt4tlxoifctadlm umnvs;t4 ltoio3ia1opD lu sls)t2xrirpoy1lmtnmfeias aDumx ont4tlxomieiyt s um(mp t4 lerio iatlm  aies s srur(rpno1omtn ncsltfa2ur(roou0optoiociadfs2ul(vs u0altoif tatfat  neols s2umxr3nodoleemiesltfsDrru ono4altoioetlt s2ea(vp () rtomoctotlmtrlnes;t0srxr(mpou1ame mfcsltfa2urx  oo1oet iictasls um(mpnt4 rxnif iodfmDeau o s  etrxm oy4amt mnvil(fsrtaum ou4tetomo3tadfm2eluvo t)arxnifcoa1fpte nes;()t2xo(o oo4lmte nvtatfaDrr(rooo0tlt ioeiltla elnmo;u4trenmf oodfmteaivs;t)srtrimpiu4altelnctls a2ta(  nu1ape moeiasls2eln s t0texnio todlmtr ies;s0srtr(rpiy1lme  nvsas s2tau  oo1oex mo3iatlaDulu p;t0trerif oatlmt anvi;(0t2uoimpnu4lpe mnvsa(  2trxmpot1tlxo ietasls ulu pnt)aeerio tadfp elu ol()t2xr(o ou1aptnmivtat)aDtrx o;u0tlto oeiatfm2emn p;()alerxr iytlmt aivi s  2umxo io4lptn nci t aDrm( onu4tle mi3tltfsDranmpnt4trtnmf oytlaDranei () 2xm(m3nu4altnlict tfaDtaumo;t0alx  ocilt sDua(vonu4 exnmo3todlpD lneslt0 ruoxm nu4ome  ici ( srtax  oo0alenmfeilsfm2rmnvon(0trtnmo3tydfmtrlnvils trurxr3oy4alt lfeil(fartrxmpou4opxn ieiatlaDra(mp;(0alxrmo oa1op  lueols0trur(r3oo4llt lfvtls a2tru  ;u0tlt  f3tydfa2ran pnt4tlermr iatomtran ols seto(o3nu4lltelictl()srtmx  ;u4ape ioeiltfa2eluvs;t0tltoxfctotlp  aieilt0 2xrio3oo4omt mncta() 2trxmono4ape mieils a2em(mp;t4 rtoxr3iadomtrln olt  rurxm3oudlle lfvia()s2rmxrp;u1alx mf3tytls umn s (4altrxr tatfa r u il( seurxrpoudop  mieta(fsDuru  ot4opto fciytfs2umn s u) rtnifcoadfpDe ieilt0s2urim3nu1omtn ncia(fartmurooo4tleoif3tls sDrlu pnu4aetrio oadomD livs;t trum(o3nydlmte ies (fs2tru oot0apen oeiatlsDea(vo t4 renxf io1lp e ivs s  etm(o iu4ap  mnvsa( s2urx p;u0ape  ictyd s ulnvs u)aleomfcoo1laDe u olt)trum(m3iydap  livil( s2trurpnt1tptnifctlsfm rmuvo u4tlxrir3tadlmtrlueo;(0sruoxm3iy1lltnlfesl( a2umurp;t0tlen fciad mDrm(mo u4tetnxo3iodomt lueslt0teuoim nu1op emiesa( sDrrxmpou1openifeiyd a um(mont)tlxoifcoydomDr nvo t srxmxm3oodopte ncs tfaDuax  ;o0oee  ietad a2uaums t0trtrxf iydfm eaivi;(  exm(m3oudap   ieiat)aDuaxrp;o4oetnioeiltlsDeanvs;()tlerxr tydomtrlueo s) etm(m iu1opeelnet s
\ No newline at end of file
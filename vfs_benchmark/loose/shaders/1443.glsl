@@ -0,0 +1 @@
+ivo (0tetr(o3iydlpenlivslt) 2um(mono1tptnif3ilt mDrmumon() etnmfctodfp eanvsls  etr(mpou1oltn ivsl( s2tmumpoo1tpxomieild m rm( p u4 exoxr3iytoaDraueolt tetrim oo1lmeemicsas)aDum(ro;u1apxoii3iytfa ra(monu0 lxrxocootoa eaieo s0 rxr(mpiu4alenlnesls  2tmu  ;t4tltnifeiad m rl( s;u4tlermo ty1opD auvsl()texmxm3iy1lltn ies ( s2uaxrpoo4olxomictasla el(ms t0tltnifcoydfmtr nei ()texr(m nu4aptemfctls srrm(mpou1opxomo3iatlmDea(mp;t)altrirciodlpD ln slt)trxoxopiydol nlnvs (f Dumur ou1tpeoioeiatfa eanvsnt4artrxr oo1fateaueolt0sexr(r3no1lmeelfvtat a2tr( o;t4alen ieiyt s rlums;(0artomocoy1lmte ueslt0 rxoxopio1olt mnctas  2ra(  no0tpt  o3ildfa2rlnmo;t0arxrxrcoadop rlivi ()t2xoimpio1lmtnmfeta( srtax onu1tltnmo3iatlaDel( o;t4areoio oatopt aivi t trurio3no1al n fvsltfa2rrxm ;o4tle iociatlsDelnvpnt4areoxrcto1lmte uvi s) rtoio3io4om emivia()s2ta(rpnt4ape  o3ilsfa2em(vonu0tltomf io1opD aues t0 2urim iydlmenlici t)s2um(moou1teeo feiadlm ra( p (4tlxrio3to1omDrluei t)trtmio3oy1op n ieils) 2taumoot0opxomi3iytfaDul(mpnt4aetomo3iatfmteauvil(0 rtrxo3oy4opeemies tf 2rr(ront1tpe if3iatlm2umuvs;u)arxoxf3iatomDranvi;( texo(o oo4olt mnci t) Drax  ot1texoiicildls ua(ms (4aetrirciatla  au o;t t2xm(m3iodoptemnvta()a2ta(m ou4tltnmfetydfa umnmp;t0arenxoctodoaDelueo s) eumim io1oleemieslt  Drmxrono4tlen ietlslaDua(ms t4arenmo3oy1lpteaneo;s sexoxo iudlptemfvs ( aDuaumoou4opx mo3tytfs rl( p;(4aetrxf3ootfat livi t)trxm(o iy1lm nmfvs s)sDuau p;u1teto i3iyslaDuan s;()arxrioctytfatr u o s0t2uoxo nu4ol elnvsltfsrta(rpot0tetn o3iad mDua(mp t4aetoxr3oadom eai i;() exmiopno4olte nct ( arrmum ou4opeo octas a ea( o u)arermrctydlptran o;( texmio io1amt lnet ( sDtr(rpnt1tlto i3ils a2el( ont0trxrxo3io1faDrlieo;( tetoim oy4lm elivtat)sDumxmp;o1apenmieilsfs2ran o ()aetnif3totoateaies;t)t2xrxmpny1am   fvtls) Dtax p;t4aeeomf3iydfa2ua(mont4teenio3ia1lpDelivi;(0srxoir3oo1amtemfcsa()a2umur ;o1ole  feiltfaDemnvo () etnxo3to1lmtrlieo s)srtoirpiodopt mncilsf 2umu ono4oexo f3iytlaDelums t4 rxrxo ty1omt anvols0srxoir iudale  nciatfsDumxm oo0tltn f3tlt a umnmpnt) lenmf3io1lmteau o;s0t2urxo iydopt mnvil(faDrr(rp;t4altoifeiasfm eaumo (0alxrxr3tadfaDeau o s  2to(r oy4am   nvsa( a2tr(mpno0tpenifeiltlaDrlums u)artoir3ootfmt lues ()sexmxr io1altnmivias)sDuau  nu0tptnifeilsfs2ua(msn(0tlxoirctadlpDe uvs;s)t2trxr3iydope mncs sfs2ta(r no0tee io3ilsls ran o (4altoxrciytlatrln o s0s2uoxr3oy4am emnvtltf 2rmx oou1aex if3iytfsDemnmpnu4tlxrmo iadomDr nei () eumiopoudamteliciat)arrm( pno0oetnmociltfaDulumo u4 etoif oo1faDe u s;s0 etmiopny4oltn ivsat sDuru onu4apx mi3ils aDum(ms;t) lxnifcoa1om  lueo s0t2urxr3oodolt lfetas aDtaump;t4tpe  f3iydlmDuaumpnu)altnifctotfpDeaueo;s tetrir nudopte fviatfsrumxroou1oexomieildlsDel( ont)alerio iadlatraneolt) 2umimpoodale  ncsa(fs2ua(m ;o0oetn feiydlaDul(mo;t4 rtrxf3iy1latelu ilt0srtoio iu4ol emnvsl()aDtmum ;u1opxoifciatfs2el(mp t4trxrmr3iytlpDelivs;s0 rur(r3ou1am  mieil(f Dtmx oou1alenifctas m2ulu ont4alxnif3iotoaDe u ils  rxoimpiu4lm elfeiasf Dtax  ;o1apto fctatlmDelumpnu)aleoif3to1oat lnei;t)srumio3iydale livs ()arraxr nu1tpeo f3tytlaDea(vo t)artoxo oydfaD lieil( s2xrxo3nydomtelnetasf rrr(rpnt0tptnioeiaslm2umumo;t4 leomrcta1faDe ieols0 exmio3no1ll  lictlt) Duaumo;t4apeoii3iat aDeanvpnt0aetrxo iydopte u s ( trxm(o iu4ap emieilt aDrm(  ;t4tlxomo3tyt mDum( s t0alerxr io1oatr n ols0 rtr(mpny1lltemnciat)s2uru ooo1aee mo3ilt mDrl( p;u4tlerio tytlpteauvi (0s2umirpou4ap  mfetlt) ruax poo1tpxoii3iytfa2uan o;u4areomociatfmte ues ()texrirpoy4llte icsa(fs2rr(ro;t0tlx  i3tytfaDeau sn()arxoxoctytlm rlneolt0 etoimpiu4oltnlneslsf Drm(r ;t0oeenii3tadlaDul(vs (0tetnirctotlatelnvils)t2xoxr3no4om  lnesl(farrrurpnu4tpxnioeildls rm( o (0trxrxr3tadlmte ueils trurio3iydal nlfcs t)srtr(rp;o0olxoiietat s ea(vs u4teeomf iodfmt anes t s2urim3oy1ll nmivslsf 2tmu o;t0opxnifeiltfs el(vsn(4 reoir io1opDeln i s t2xr(rpoo1omt livsls)aDtr(m ou0olxomiciatla uluvp;t4trxoircto1oaDrlu il( teum(o nodlmte neils aruaumpnu1oleomfeiydfa ra( o ()tlxomr3oa1opt aneilt0teuoxopny1aptelncia()a2ua(monu1oltnmocild sDrl(mo u0 rerxr3oytla e ieil(  rxrxrpiodlm nlicil(  rtm(rp;u0olx mi3iadla2ulnvo;t) lxnmfctytfpteanvo;s)srumxr iu1apenmneia(f 2tau p;o4oleo ictaslm ulnvs u4areoxrcoa1laDeln o;(  etoxopnu1ameemneiat a2tmumont0optoiiciasfaDrm(mo () eenmr3oadlpD livi t t2urxopiy1ole  nvsls sDtrxront4aetn ictyd mDua(vsnt0 exoifcoodlaDrlnei;t0trumim3oo4omeelieiasfa2uax  ;o4texn oetytfs umumsnu) lxnir io1fa r nvi s0 rxrio3nodolenlfci t sruau  ot1apx  o3iydfa uaumsn(0texnxf3iytoat anei;s)sexr(mpoy4alte fciasfa2ta( pou4tleo fetlt a uln p (0aeeomf3oatfm r ieo t0trxoio3oodamtn ivtas s2um(mo;o0oleoii3tyslm eanmo;(4areomo3iotlaDrai olt)s2umim3iydole mnes ()srrmx pnt4olxomf3ildfs um(ms;u0trenxociotoa e u ol()tetmxo iydam nmnvsls aDra(mpot0aeenmfciytlm2rlu o;t)tetomocto1oa  luvol(  eur(opiu1apt mivtlsfsDua(ro;t0oee iictatfs2ra(ms;() lermf tytfm e neo s0 etm(mpoo1am  micslt) Dtrxm ;t0teeoii3iatfaDraumont4trenmrcoo1fm  anvo ( srtr(o oudlp   feilsfaDrrx oou1olxo i3iysfaDumu onu0tlxoxf3iy1lpt  nvi;s srxoxm no4omte ictlt arrm( ooo4olx mieiysfsDrmnvp;t0 rtrxr totoa elivs;s0t2uoxo3oo1ole mfei (fsrrr( pnu0oexomo3iat sDul(mont0texnmo oy1lmDean i;(0sexmxo no1lm   fcs s artr(mpot0oltoioeils s emu on(0tltoircia1opDe nvol() 2xrxmpny1lpeelicsasfs2ur(rpno0tpxnmoeiad m2rm(msnu0aleomf tydfpD lnesl( t2toim oo1omtnmfcs ( a2ururpno4aetoii3ilt a uauvsn(4teenifcootoa e u sls t2uoim3oo1ap e fesl(fsrrm(mpoo0oeto i3ildla2rmu o;t) rerif tatfp  li s s)s2um(r3iydope  nvsl(faDur(r ou4apenmoetatlm rmnmo;t0arxomrcoatopDraneo;t0s2uo(m nodomte nvt ( artm(rono4oltn fetyt m2elu ont4 ltnxocootomDeluvi ( t2trxr iydamenlicia( aDurx oot4tpx mieiyt mDuanms;t4treoxo3iytoa eliei ( setoiopiodapenmieilt)artm(moou0aet mfeiydfsDum(mon()arxnxrcia1op rau o;( setoirpnydoptnlnviltfs2trurpou1tlx mfetys aDemuvo;u4 rxrmfcoydoaDranes;()srxr(r3oy1ll elfvtasfa2ua( p;u4aeeo f3ilslmDrlnmo;u4 lermocia1opt  nvs t srxr(o oo4lp e fviasfsDuauro;u0tltnif3iyt s2umnvon()alxrxo todom r u ils sexrxr3oy4omt lfvtas)srua(mpot1tpx ioeiyd s2rmnms;t4 rtnmo iadlptelu o s trtm(r oo1alt mnvs ( sDra(mpot1tltoiietysfa2ulnvp;t0arerxfciydfmte n o;( seumxm3nydameemiet ()a2umxrp;u1aleoio3tytfs rau p u) exomociadfa  ai ilt)teurir ny1op emnvsas s2ur(rpno1opt moctadlmDelnmon() etrircoadfmDe u s;t0 rtrim oudlp n fcs ( s2rmur no1opeomictltlmDemuvonu) etnxf oatlmt lues;t0 2uoxm3nydlleelfcs () Dumu  nu4opeomiciatlaDuln pnu)alxnifcty1om   nei;(  euoiopiu4opt mfcilt)aDrm(ronu0oleo ociysls ea(vp (4tltomf3totopDr iesl(0truoxr iydol  micta(  Duax o;t4tlxomfeiyslm2ea(vo;()arxoxfciadlp eaueo ()texoir3iudoltemfeta(fsrtr( oot0aet mf3tatfa ean snu0 etnio io1omt ln ols tetoim3iy1olee ics t  Drmum ;o0tlxomf3tad m2ul( p (4teeoir ootom e ivs s t2urxmpny4lm emfeilsf 2ra(mp;t4oeto i3iatfs rl(ms (4arxnmf oydfmDrluvo;()s2xrirpnu4lp elics ( s2trxmooo4tpt  o3tydls2rlnvo u0trerio3iotopDe nei t setr(r iy4apeemietas)aDuaxm ot1opx  feiys m2emn p;u4 rtnmf iy1fmD lueo;(0trxm(r oudapeemnvi (fs2tmxmoou1tleomi3ilsla el( s t0trtomr tadlat ai ilt0 2xm(mpiu4al nmfcsa(faDtau ont0olxnio3iasls2ul(mp (0alxrmo iatom ean s (0sruoxr3iodam nlfei s)sDrm( onu0aexoioeiatls2uluvo u4tltoirciydopDr nvilt)t2xo(opou1lp elncsa(faDtax pnu1aeeoiieiatfs elumont4 renxfcoodfaDrlu i;s texmio nudlpt lieiat)srtrum ot1oee ii3tld sDuan pnt0arxrxo tytlpDe n sl( s2xmir3iy1lp  mivta(  ruax p;t0tpxoiociys s2elumon()tltnxociytlpDr nvolt t2tmxo nydlmtnmnvi s a2um(moou0openii3iat s umnmp;u) ltnmrctytfat  u ol(0tetr(r oo4lp n nci t)s2raxmpou0texoiietyd mDranms t0aleoir3ta1om  li o (  2to(r iodolenmneslsfsDrruro;o1apxnifciytfm emnvs (0 rerxrcio1fpDraiesls srumiopny4amee nvta( s2raum nu1openiietyd aDra(vs;u0aexriociatlptrlnes t0sruo(o3ny1amtnlnvs sf Dua( o;u4alxn ieiatfa ran p (4texrxocoodfp elneolt srum(o3nu4lmt  ivsat  Drm(mp;t1apxnmf3iad m eau snu)alxnmf3ta1fm e ivilt s2tmimpou4lme miesls  2tmuroot1alenmf3tas s2ra(vs;(4trxrxr iytfateluvi t0 eurim3nudlm nlfcs s s2umxmp;o4opeoio3iad s uau o;()arxnir oy1la rlueo;s)t2uoio3iu4lmtelfvtasfs2rmu  ;o0apx moeiatla rmu o;(0aetriocio1opDrliei t) rurio nudol emfeia(fsDumuro;t0tet moetad s2rm(mont) lerif tadop rluvs;t)s2uoxrpnodomtnlics s  2ra(m ;t1olx ifcildfaDem(mp;(4 ltnir3oytomDe ivsl(0t2trxmpio1open fcsl(farurur ;o4openmoeiydls um(vpnt4arxnio iotfpDrau sls0 2to(m3nudopt  ncslt aDurx  ;u4olxo o3iadfaDeauvs;t4altnio3tytfmtean o s) rum(o3oudlle lfvta(  2umxmpnt4alt mfeiys s2el( o;t0aleomo3totlateaneo;s0setoirpnodomtelnct sf Draxrpou0oex  oeiysla2ean p;u) exomr3oa1opD aies;() 2tmim no4lmtelict s) Durx pno1aptniiciytfsDul(vont0tltoiociatlpDranei;()s2xrim nydoltemneiat)sDrax p;u1aeenmiciydls2elums;t0alxnxo tadfa rli i;( srumim nu4ope mies ()srumu oot1alt  octatfsDuluvs u0 reoxo3oy1faDrluei s  rxrxopoudap nlfvt (  2urxm nu4ope ifctytfmDeanvpnu4 ltoxr oodfpteluvi (0truoxr3iy4opte fvta() 2raxm nt4ale  o3iyd s2ra(mpn(0tltrifcootfm eauei;(0s2urxopio4aleemncsltf rrru  nt0aetnif3tldfaDrm(vo;t4tetnif3oatfpte iesls0texo(o iy4lptnmfesa() rrmurpnt0apx  i3iltls em(vpn() lenio tatla   n i;t t2toirpou1aptnmfvils) Draum oo4tpt ii3ias s ul(vs;(0 leomo3oa1fateli s (  exm(m nydlm elfetat) rtaxr ;o1tpxnmiciadlm2el(vp t0 lxrir oo1fm rlu sl(  2umimpnodlmeelfetatfaDrmxm no0opt  f3iysfsDum(ms (0 rxnio iadfaDrliei s  eur(o oudalee icilsfaDtmxmpnt1tptn f3iyd mDul(vo;t4artnxo3oadomteaieo t sexrxm nydlpeemfciltf rra(mooo4oee moetysfa2el(ms;t4trtrio ty1faDrluvo s0t2umxo3nudll e iesl(faDurxr nu4tltoiieiaslmDrm( on(0 rxnmfcoytlptr ueslt trxm(r oydlp   ics s aDrr(mp;t4tpx  o3tltls rmums u)artomoctytlpDr n s ( t2xoxo3iy1omeemnvias a2urxrpno4tle iicilslmDulu snu4aetrmf3tadfmt lnes;s  etoio3nydapenlnviat  Dra(rono1alx mieiasfa ulu onu0arerifcoy1omtr n s;(0srtmio3iu1apen ivsltfaDtax pou4tee mo3iydfm eanmo ()trxoxfctatfatrlnvs t0t2uoirpiudole  ictltf rtm(rpnt1tltnmoeiaslm rl(vp u4arxnir3tatop e nvol(  eurxo3iodol elnes t s2tr(mpno4aetomfctytla2emnvsnu0 eeoio3todlpt  neo s) eurir io4ap emivsa( a2rau pno4tleoiociadls2elu o;(4tlenmr3oadopt  nvo t0srxo(opiu4lpenmfei s s2rax  no0aetoioctatfsDumums;t4 rxnif3io1omDrlieslt) rxm(o3iy1ll elieslt  2raxr no4olt  oeiytfsDea(vp;t0aeeoirciytlpDelneolt  rtm(o3no1llenlfetl()sDumu poo0teenmoeiasfm2ua( pnu)areniocio1lat  u i ( srurxr iu1altn ivs t)s2um( pnt0aleo fctasla2uanmpnt4arxrio3ootlmteln i;t0 rtrxmpnodllte nct s)s2tr(roou0ope mo3iatfs2rau pnt4 exnmocta1fmD li s;() etmxr iy4lpe  fcs s) Duaxmoou4aeen o3iasfmDul(vp;u)tetoxo3totfpDeauesl() eumim3iudolt mivtltfaDurumoot0tpto iciat mDelumsnt)trtnmrcoydoaDranvilt) rtm(m3nodlleemieiat  Drm(  ot0apeo ictat s2rlumo;u0 lxrxo3oa1fm e i s t0t2xr(r3nudomtnmnesa()srrau oou1ape  ociltfaDeanmp u4arerxo iytoaDelu i;t  rxrxo3ou4amtn netas srtaump;t4tpe  ocildla um( p;(4altoiocoatoaD  u i;()s2xr(m3oy4lpt lnesas arumx  ot0tlxnifetldfmDelu o (4aetrio3iydfat  ieol(0tetr(o3oodol n neiat) 2trx oot4apx  ocilsls ranvs u4trtrmo oo1oat an s;(0s2to(o iy4am nlnei (  rumurono1olx if3iytfaDrmump () renmf3oadlmtelueo;() exoirpoudapeemneilt)artrxr oo4apx mfciysfm2em(ms;(0tleoio to1lp rauvsl()sexr(o3iydll  mnvs t)srtaxr oo1altnmietytlm rm(vo;t0arxrxo iatfp  aneslt) exoiopiydlm elictl()arurxroou0olxo o3ild mDrlnmpnu4arxnmr oo1fmD lneols t2urirpnudolen fvs sfs2rr(mpnu4tlen fctydlm2rmnmonu0tlenxfctodlateanvol()texmxmpoo4ap   icsl()s2trxm ot1aleoiictysla elnvs (0 eermf3oydfp e n i;s0texo(o oy1opeelfcias a2rrx pno4ole mo3iatls elnmpnt)teenmfciydlpDr uvils0sruoirpnudolt  fci t  2taxmpno4tlxoiicild sDuaump u)tltnio todoaD aneil() etoir3no4ameemnvtl()srtaurp;o1aee  feiydla eluvs;t0tlerxociydla e neo;s)sexmxr iu4ole  ict t)sDrr( pot4oee  oeiatfa2rmn o ()tetnir io1lpD ai sl(0 2uoxr iy4lp nlfciatfaDumx pot1aex miciatlm uanvp;u4areoif3oo1fp   neol(0s2tmio nudap   fvsat aDua( pnu1texnmo3iytla2elumo;()alxoir3ta1fatrai il(  exmiopiu1llen fct tfs2taurp;u0oeen f3ilt a ua(mp;()tetnmfciytfp e i ols t2tm(r3nudomtnmietlsfsDrmxmo;t1oetoio3tadfm2rau ont) rerxf3todlat  ieslt) rxoxm3nu4oltn ieil() rta( p;t0oeen ieilsfa2em(mo t0texnir3oadfp eli i;() rxm(mpiudope  nctas)a2ta( ont1apxnio3iad m2ea(von(4trtoio3tydfm eli ols0s2xo(r3no4ap   nvt (f 2tmx oou0oet  octldlm rm(msnu0 rtnmo todfmD auvol(0 rtoirpiu1omtelfvtas)aruau p;t1oleniietydfs um(vpn(0trtrif3iadlmDrln i;s  rur(r3io1ll  mnvtas)aDra(m ;o0aeen o3iydfa2ranmpnt)aexrxf io1fat  ivs (0 rum(r3no1lpe lnciat arrrxmooo4tpxoioetasfaDulu pn(0 lxnirctatlmD lnesl() etmxrpiu4lmenlfei t)sDtax onu1oleniieiyd sDuln snu)tleoxo3tatomDrlnvi t)trtoxo no4ap elnvt sfaDtm(rpou1apen ietltla2ulnvo;t) rxoxr3oadfpt lnei (  etoxo3iy4lpe lfviat) 2rm(r nu4aptniieils m2raumonu)trtnxf iytopDr nvi;()setrio3iu4llt  fetlt aruaurpoo4aetn oetltfsDrlnvo;(0arerxrctadlaDeli i;s0s2xr(rpoo1ape  fesas  2ta(  nt0olxn ieiys m2um( sn(4 lerif3ia1omDrauvs (0 2umxm3ny4llee ivsl( srta(rooo1apeniociasla ea( sn()aetrxo oadfmtr ieolt srtmio3nodamtelnctl( srta(r ;o1aexn ociyt sDua(vpn(0 rxomrcoy1opDelu sl( srxriopnu4optnlici ( a2rr(  ;t0apto fetysfa ua( snt0 lxoxo oytfptrau ilt0t2tmio3iydll  lfct s) 2ra(r ou0olxoiieiasfm2raumpnu4altrxr3oa1la   ueil( seuo(o3oo1lmenlfvtls srrrum oo4tpxn iciys a2uan p t4texnmo3oodoa r ieo s s2tr(r3no1omeeliciat) rraxr no0optomfeiltla2um(vo (4 lenir3ia1fatrlivi t)srtoir3iy1alen fcsa(  rrrxroot1opt  feiatlm ean p;t)aexoxf oadfa r nvols0srurxrpoodlmtemicsa()arurx p;o1apxnmi3iadls rluvp t4artoxf ty1fat  i ol()t2xoir nu1lp e neilt)s2rmum oo0tptniieilsfa2rlnvs (4aetrmocty1la rau o;(0srxmirpoodlle mncsa() 2uaxrpot4tlxnmiciasla rmuvpnu0texrxr3todla  lies s)t2trxrpno4ameelfciasfa2raurp;o1aptomictldfs2emu s;t)aetriociotopDe i i t s2xmxo oo1lmenmnct tfa2rm(mp;o4tpxn iciys s rl( o u0areoxrcoytla ean i ( texm(rpiudol emnei t) rtm(ronu4aexnmi3iysfm2ua(ms ()trxrif3tydop  li olt)setrxrpiu1lmt  ivtatf rtmumpnu1apeniociltfm2umn o t)aeerif io1lmDrlu olt0trtr(m3ny1op  lfes sfsrtrxrp;t4oleoioctydls2rmnmo t4arerxf iodfmtrli slt0t2uoxrpno1openlivsas  2umxrpnu4opx mf3tatla2ea(mp t4teeoif3iotfa ean s;s)t2xoxm3nu4olen nes sfa2rm(r ;o4oltn octasfa2emu o u4treomf3tytoateaivs ()s2urim3oy4ale  ivias) Dua( o;t0oltn i3iytfa rmumont0tetnxr3ty1lm rluvilt srto(r3oudaltn nvsls)a2rmxm ou1optn i3iyd sDean o;t)teenmr todlaDrau s;() 2to(m3ny1llt  nesas) 2umu oot4tptoif3ildls ran snt)arxoxo totfaDeluvs ( trurir iudalt liciat) rta(ro;u1oexnmociytfa2rm(vonu) renircoa1oa  livs;s0trtoim3iu4oltnlnvi tfsrurxroou4aptomictydlm2el(mo;(0 eerxo oatlp e uei;t0teuoim3iodolenmnvsasfsrtrxm ;o0oeeomiciytfaDuluvpn(4altoiocia1lpt au i t0seurirpnydame mfeta()a2trx pnu0olxoifcilslmDean p;u4 exnmo3iytom ran s s0srxo(opio4lmtelnvtas  rtmxm oo0oex  i3iltla2rlnms;(4altoiociatomDr ivo;()s2trxm io1ol nlncta(f Dtr(mpnu4oltnifctydfaDrm( s;u0 exoxo oadopte ueil( t2tmxmpoy4lpe mneil()aDurumpoo0optoiieiyslm umumpnt)texnxo oadlpt  ivsls0 2xrxopno4al nlnct tfsrrrxmo;t1apx mietlsfs elu p;t0tleoif3oo1op eanvi;s0s2toxopio1al nmfesl(  Dtmumpoo0texo fcildlaDrmnms;u0treoio3iotlaD aueo;s) 2tm(opno4op n ici (  2ra( pou1apeo o3ias aDulnms;(0 rxrxr3io1op   ueilt0s2uo(o3no1omtnmfcsls) Dumxmoot4apxo i3iydfa2um(mo t0tlxrxf iydopt  uvi () ruoimpny1lm  lici t)sruaumo;u1oltoioetldlaDrmnmo;t0alxrmo ia1fmDr nei s t2tmxo3no4omen nvsa(  Drmx pot1aet ii3iadfs2el(mo t4 lxnxocto1laDrai s;t0 2xmxo3nu4oleelnetl() rrmxmo;o0aexomf3iysfsDrl(vp (4tlxnxf tydfa ran sls teuoiopnudalenmncils)aDum(mo;t0tet mfeilt sDrl(vs t)texoxrcta1fm r n s;()s2umxr nu4lp elieiatfsDrmx ono1openiietadfa2uluvo;t0teerxo oy1op  aneslt sexmxm ou4apenmicilsf rraumo;t4tee  oeiyd aDelump () rxrxoctytfp  livi t sexmxm ny1lp nmfeilsf Durxroou0tlxn i3tld a2ua( snt4texoir3totfp eluvi;() rurimpiy1lpt mfvs tfsrua(m nu0opx moctyt a2emuvo;u0teeomo3ootopDr u s;() exm(m3oudol eliet ( srta(ront0tee mo3tytlm elump;t4 lxnmoctadla elues;t srtoio3iu1lpeemnvt sfartmxm ;u0tpxnio3iatfm2eaump;u)tltrir3oo1lmtrlu s;s  exoimpoydamtnmies (f 2rax  nu0tpx  fciat s um(vo u)teenxo3oatom e nvs;s0srxr(o iu4altnlnvsl() Dtmumoot1altomfciaslaDum(mo () eeoxo oydlp elieil()sexoio3oydomt  fvt ( a2um(rpno1oeeomfeilsfs ea(mo;t0 rtrxr iytfa  aiei t s2tmim iu1lpeelfci (fs2raxr ou4altnifetls aDemumpnt4 lermr io1lm   neo;s) exmio3nu4am n fcsat) Drru pnu0alx ii3tltlsDra(vo;u0texnir iodlatraneo;(0tetm(r iy4opt lfvs ()s2rax o;t0apeomociaslaDeln p ()altoxo iotla  luvo t s2xrim nydlptnmnetlt) Dum(ronu4oetnioeias m2ua(mo;(4 rtoifctodlm rlnvolt0 2trxopiy1lmtn ietls s2taxrono4oetomo3iasfaDelu p;(0 leoxr ty1lptr i ol(0t2uo(opio1altnliviat) rrr( pou1aptn feiytfm el(vpnu0alxoxf3iotlat  n sls)texoxr io1op e ivsls a2taxr ou0tpeomoctlsla2rlumo;t0 rermf3tydlaDelieils texr(o3nu4opt lnvi tfsrta(mo;u4oexnmoetadfmDean p;(0trxnirctytfmt lnvs s0 rtrxm3nodalt mictl(faDrmx ooo0tlt  o3ild aDemuvo;(4 ltnmr3oytopDe ivilt  ruo(opiy4ll nlncslt  2rrumoot1oetomfctaslm2el(mp t0artoio3iotop r n s;t0 exoxr3nydaptnmivi t) 2rrxrpou1tltomictydfmDrmums;() eenxr3iadfmD lieil() 2xrim oy1lmt lfesl(fsDtax ont1teen ociyt s emn o;t0 rxnmf3ta1latrli o s0teurirpiodlmen nvt (f 2ua(roou0aet  f3ildls el(mp;()arxrircootfaDr ueo (0 eum(m3nodomen iei s) Dtrurp;t4ale mfcildla2umumpnt4tlxrmociydlpDr ivs t)srto(opny4lm nmivi sfs2rrum ou0aex iictlt s emumon(4altrmo3ootlmt ln o s0setm(m3iodaleelicta() Dra(mp;o0opeomf3tad sDel(vonu0artnxfctydomtrlueo t0 rur(mpnudlpt  fvtasfsruru p;o1opeomo3tyslaDrmn o u4artrxr3oydopDe u ilt  2xrxopnudlme mnvi ()s2rax ono4altoifcilt a rluvo t)arxrmo io1omD luvo;s s2tm(mpoodal nmfvsltfs2ta(r ou1tlxo ociys a ranvont) lxrmo oodopDrlu o;s) rtr(m3no4ome mfetlt)s2taxmo;t1olx  o3iyd s2eaumo;(4tlxriocoa1opDelnes;t srxmir3nudamtemnetat)s2ur(  oo4olt ifetadlm ua(vs;() renmo ootlatelnes ( setoxr3nodop  mfctl()artm(r ;o1tptoio3ias s2ra(vo t0 ltrio oytlp rauvo;s)t2uo(m ou4ape mici ( srrmump;o0tleo f3tydfa rluvs;u0tltrmoctodlmD lnvolt)seurxo nudope mfet ( s2ur( pnu0altn feild m umn o;u)tetnxr oo1oa r u olt srtoxo3ou1olenmfvsl(  rra(r ;o1apx iociltfm2elnmp u4artnmr3tadlmteauvs s) 2uoxopiu4lpenmnvilt aDrmxr ot1tex iociatfm rln s ()altoif oo1lpteauvi;( trtrio iudop nlnvslt  Dua(rpnt4tpto f3iasfs umuvs ()alxoxf oodfmD aivolt0 2umxr3oodameelictl(  rur( poo4opt moeiyt a2uanmo u)trtoir3oadoaD  iei;( t2uoirpoy4olte netas srraxm ot4olto ociltfaDrm( o;t)artriociydlm  aieol() 2xo(r oodomtelfctlt  Dtr(mpnt1oexniieild aDelnvpn()trxrxo io1la  lneo;()srxrio nu4olt mict s  rrmxmp;u1tlxnioetltfsDem( s;(4texrir oo1opte u o ()trxm(opny4apt lfvsas a2ururoou0aet  octytfm ranmsnu4trxrxf3to1fa  au ils s2xo(rpnydol elnct t arumxr ;t0tlx mo3iaslsDeanmp;(0tlxrir3ty1fmDrlneo;t)t2xmxm3oudlpte nvi ()arumxr ou0tlto f3ild mDeauvs u4texrxf3oo1om   nes t)srtm(o3nodamt  fcs tf 2rauroot4aptoioetat aDel( snu) ltnio iy1fpte i s s0teuoim3iy1lmeelnvt s)s2ta( p;u0teeo o3iltla rm(mont0treoiocty1lmte uesl() etoxo3nydamtemnvtatf 2rm(  oo0tee ifeiydlsDrm( p;(4arxoio ta1optrau ols t2to(r3no4ol e fetlt artm( oot0tpxnmfeiatfaDrmnvpn(0 ltoir3oa1omDe i i;()s2xoxm nudom nmfei (fs2ta(mp;o4tex miciadlmDuauvont4 ltnirciodlpDran o (0sexo(rpiydapen fesls)s2tr( ooo0altniociltlmDemnvs;t)alermr tadfm elneo t  etmxopnu1lpe mfci ()sDraur ;t0alxnif3iaslm rm(vp;u)aexrxo3oydlaDe i o (0 2xoio3oydal nlictl( sDtrurono1teenioeiys a2elnvonu4alxoxfctatlm r n i;( t2umiopny4ap nlneiasf rumu onu4tle ioeiytlm emnmpnt0aexnmo3iotfp rlnvs ( seuoimpiu4lpte icsa()artmxr ;o0tlxo feiyslmDua(vs (0aleoifcoadfmDelnvils0 exoxmpny4lm   ncslsfa2taumonu4tlxniictlsfa el(ms u)alerif3tadop elneo;(  2xoxopiu1ameeliet ()a2ra(rpou1aexoiicilt a rl(mo () leomo3iodlpt  uvsls0t2trio3nodom emfesls)arta( pno0tpe iiciad m ul( o;u)trermf iytlp   n s t teurio3io1oltelfvtas a2taumo;t0opxo o3iaslm elnvp t4aetrir3oytfatr u o;s)s2xmxr oodlpt lfetas)aruaxmp;t0tltoiieilsls2rlnvp;t0tlenxo3tatoateln i ()seuoir iodlpte fcta( sDtau ono1tptomieiadls rmums t)trtoio3oa1laDran ils)t2toimpoy4amenlivias  2umx o;t1oltnmfctatls2ua(monu4treomfcty1op  au o;s)trurio io4lm n fcs t)srtmumpou0aexoii3iysfm2umuvs;t)altrmf3totla eluei s tetoxm iy1openlfes s aDtmxm ot0opxoiicildlsDrl(vo u)aetrxrcoodoptran sls0sexo(opny1lmenlics ( sDum(  ;u4alxnii3tasfs2ua(vs (4artoir3iadomteliei s t2xmxm3iodam nmfes s srtaxmont1apenif3iltfa rm( p u0texriocoo1lm eau s;()t2tr(r3iu4aptnmfcil( artr(  ;o0ole ii3iasfm uauvo ()alerifcoatlmD auvi s)truo(r3iy4llenlfes ( a2uax o;t1alxoiocias s ulums;(4tetnxfciytfatraies;s  euoxo3oo4oltemicilt)srtmxrpno1tlx  f3ilsfm2um(vp t0aeermr todoa  anvs;s)trxoxr ou1llt mnct s  ruax p;u1apen oeiadfm2eln s;t0aexnif3io1fpDeaivo s0srtr(m iu4ol n feslsfsDrrumo;o4teto f3tld m em(mo;t) eerxf tatlp elueo t t2umxr3ny1lm n fes s)sDraurpoo1oeenii3iltlm2ea( snu4arenif3iatoa e ivi;() eumxmpoy1llenmnesasf rrmxm nt4aexnio3iatfs2umump;()trtomrcoo1lptr u i;(0t2tm(r iu1lmeemnvi tfs2trumoot4tleomoetydlm ua( on(0alenxr3iytfmtr nvils tetrim oodam e fviat sDum(r ;t0ope mfciyt mDum( on(4 rtnxr oytlp  lneol( t2toxmpnu4ol  lietl( srtr(mpno4tpxoiiciatfs2uln on() rtrxoctotop  luvs;s)t2ur(r3oodlpee ncta(f Dtaumpoo4texo ociyt s umumo t0 renxf3to1lmD  n ils trurxr3no4lmenlivi (  rur(m nu0tlxo icils aDem(mo t4 ltnmfctodoa  ln sls)seto(rpou4lpenlncia()a2raxro;u0apeomi3ias m2ea(ms;t)teerif oo1fmD lu s s)t2to(mpoo4ll  lnctl(fa2tmxront1apxo oeiltlm ea(ms u0tleomf3oa1lmte u ols trtoxm iudamt mici s)arumxm ot4teto oeilt a2uanvpn(0aeeomf tadfmtr nvsls)srxmio3nu4op emfesatfsrurxmo;t4tetnii3tad s rmu o;t0aexoxr tytfaD auvs;() 2trxm ou1op emncs s arrm(mpot4ape mo3tadfmDuau ont)tlxrifcto1fp  ai i s sruoim iu4ll  licilsfartau poo4opto oeilsfa rlu s;(4 rxrxfctydfpDr nvsl(0srxoio ou1optelict tfarumx p;u1ole iieiyt m2umuvo u)alenif ootfp elnes (0 etm(rpou1lmenlnvias) Dtm(rooo4tpt ioetysfa umnms t) rxnmocoo1omDr iei ( tetoir3no4lle  icias a2um(m nu1alxnmfcilsla2rl(vp;t4 rxomf3tatlm   i i s)t2xrim3iy1oleelnvtas  2taxrpou4tet mfcildfm uaump;(4aexnifctytoa  anvs;()trur(mpny4olt  ncsls)s2ta( oou1tpe  fctyslm rl( pnu4 ltoio3ta1omDraneils)seumim nodllt  feils s2rrx o;u1tpt iiciydlaDuan o () etnmrctodom elnvsls)seto(m nydaptn nvt ()s2tmxrpno1altn f3ildlaDuln p;t)aetriociodoate i o;s  exmir3oodam e fcilt sDrrx  nt0tpe mietldfs2eau pnu)aeenif totop  ln i (  etrxrpio4opt mnvi t) Duax  ;o4oexo ocilt mDrmn p u) etoif oy1fpte i o;( trxr(o oo4omt licil(f 2tr(r oo0aee mocilslm rlnms (0treoxr3iadfp   i il()tetoir io4lleelivs sfa2rrxronu4apxomfeils m2eaums;(4trtrxocoadlat an o t)srxo(o iodlpee nvtatfa2taum ot0tpxoiiciyt mDulnmp u)tlxnmo3io1lpDraies ( srtmio iy1alenmivi ( s2tmxr ot1altn octls m uan p t)aexomrcoadlpte ueo;s)seurxo iudlptnmivsl() Duaum ;o0tet  fcildfm ra(msnu0 eeoifcty1fpteaiesls)srto(mpio1am  mfesatfaDrmum nt4oltoio3iysfs ra(vp;u4trermrctodop rluei (0 ruoxr ou1lm emnvslsfa2umum nu0tptnii3iyd sDrm(vpn(4tlxnmrcoodopDeaivs t) rurxo3iy1ame livsat) rrmum ;o4teeomfeild s rau p;u)tetrir tydom eai i ( sexmxo iu1amt  ncsl(  Dtaxmp;o1oee ioeiydlsDrlnmp u4 rtoif tadfatr ivi;s)sexoxm iydlpt lict t)s2ur(rpno1ale  ictlt s2ua(vpnt0 lxoif iadla raneo ()s2xoxopiy4oleelfcslt)arumurpnu0apeoiietaslsDelnmo t0tleomf oytoatr uvs t truo(rpiodomte fetl(  rrr(mpnt4apto oetysfa elnvpnu) leomr3iydop eanvi ()s2xm(m3oo4ap  lieilt arumxr ot0alxn oeiysfmDel(mp;() eeniocoydlaD  neols srxoxr3nudop  lnvtat)sDurur ou0olen fciasfm2ranvs;(0texoircoatopD anvs;( s2trim nodamte fci tfarua( oot0tex mieiyd mDumnmp;t4texrio iydlmt  n s;t) rumxmpoy4am elieil(f rtmumont1oetoioeiltfm2el(vsn(0aeerxf io1om   iei;s0teto(r3oudape miesa( s2rrxr oo0apt io3tasla rl( pn()trenir ta1lp raies (0s2ur(rpiy1lleemfvil(fsrum(  ou4tee mfctldfmDra(mo;u0aleomf3iodoaDeau s;s0 rtoxm iy1op nmfet s)arua(root4tlenioctltfa umu o;t4 etnxrcoatlm eaueo;s trxoio3oodlmt mfvtl(fsrrm(mp;u0tlenio3tadfs2eaump;u4 rerxfctodfm r u i;()t2tmio nu4ome miciat a2urxr nt1alxnio3iytfs ulumon(0tetrircta1lm  ai olt0 rxoir iodlmeelictatf 2tr(  ;u4tlx  oeiasfm em(mo u) rtrmo tatlptrau sls trumimpnu1olt mivi t)sDum(r ;o4texnmf3iatfmDeaumo () etoirciotfp   ivi ()trtm(mpoudoleemncslsfs2ra(  ;u1alxnifetltla raums u4teenirciydfp rli o t  rxrxrpoydlp   fviat) 2rmxro;t1optnio3ild a ean p ()altnif iydlaDranes t0trxrxrpoo1lpt lfctlt)aDtmxro;o0oee  fetys aDrmu p;t)aleoxrcto1omDe ues (0srxm(rpoy1omenlnesl(  Drmumo;o4tlx  oeiasfm2ea(msnt0alermf oo1fpte nvs;(0 rtoiopnu4lm elnctls  2ra(rpou0olenmo3iad aDemuvo (4alxrif iytfm elivs t t2uo(o3oydlptnmnciat srua(mooo1oet  f3iytfsDulu s;u0texomfcoydoaDeli s;( setmxrpoy1ap n iesl( aDrm(  ;o0optoiociysfaDrm(vo;t)areomf oatomDe iei ( trxm(m3io1omt  nvia()sDuaxr oo4teenmfciytfs rln snt)arxrio3ty1lp  anvs;()srumxm3oydolee fcs tfaDtau pnu1aeeomf3tysla uau onu4aetnir ootoptraies t0 etoir oy4ole licia( s2rmu  ou4oet iictlslm2em(mo;()artoxr3iytlm eliei;(0 rtmimpno4lme mieil() Dtr( o;o0oet  i3iltfa2umn o;t4artrmr oodlaD lneols srxoiopiydllt lnetlsf 2trum no4oeenii3ilsla2um(mo;(4 eeoxf3oydopt  uvs t)s2uo(opou1altemfcsat)aDra( o;u0olx if3ils sDrmuvsn(4trxrmr iytfpDrlivs;s0 2xmio3iy4oleemicsatfaDrr( p;o4alenmieiys a2umu pnu0 lxomrciatfateli o;t0s2umxm3ny1aleeliet sf Drm(m nu0oetn ociyt m umu s;t) etrio3iadomD  nvs t0tetrim3ny1amtemfetlsfarraxm ;o4tltnmocilsla2ea( snt) renxr oa1fmD  ivil( texo(mpny1lpe  fesls a2umur ;t1oleoiieiytfs rlnvo t) rtoxr to1omtr ues (0t2um(m3oo4lltelfvsl(farta(rpot1altomieild m2emnvs;(4 ltrifcoodom  lu sls srurirpnudlp  licsa()srumur nt0aetniiciydfm2rmnvo;t0tlenxo3todfatraivi s0s2tr(r no1om e ivsasfs2ta(  no1tlx  fciaslmDem(vs t) renio3todfmD aies;s t2urir3iu4lle lfciltf 2rmx  ou1tpeo ieiydlm uanms;u0alxnmo iadla   uvo;t teum(m3nodll  lnvt (faDtmurpot0aexo oeiasls2uaums u0 rtnmr todfm e n s s0 2xm(r ou1op nliei s)s2umu  nt0tleo fetatfm eanvs;(0 ltrmf3iadfmDeluvsl(  etmxo oo1ap  lfci sf Dumxmoot1tptn ictad m2elumo t0aexoif3iy1oa rlivo;s0trxmxmpnodamee ies t)arumu pnu0oet  ieiadlm2el(vs ()aexomocto1oaD lnvsl(0seuoxrpiy1amee fvt t aDumx ooo1alt ioetld m2emn p;t)trxnircia1fm e neo t0sexrxo3oudoltelnet t srumx pot1olxo o3ilt mDrl( s;(4trenmfcoadfat anes;t0trtm(rpiodlm   neia(fs2umur nt4alt ioeiytfaDul(mo;u0tetoxr3oytla  ai o;(0s2xo(o3no4optn fesatfsDuax  no4apeoioeiad a2rlnvo;u0 rtrif3oadfaDe nvo;s0trtr(r iu1omtn netltfa2umu o;o4tpeomiciltls2ran s;u)tleoircta1omt  uei;t  2xrxr oydlp n nvtasfa2ururooo1tlxoiictysfa2umn p;u4 exrifciodla r ivi ( s2xoim3oy1lm elnetl( a2trxmpou4opxnmfeiadlm2umump t0 rxrirctydoate ies;t  2xoio3iydllt  nci tfsDra(rooo0tpt  f3tld aDeauvo t0trxrxo3to1omDr ivs;(0 rxoxo oydomen iesat) Dtr(m ou0oeto fcilt a rln snu0tlerxr oodfp e nei;s)trtoim3iu1aptnmnvsltf rtrx  ;o4aexo iciatlsDuln snu0alenirciatlp  liei;s  2toirpoy4op n ncias a2ra(mpno1optnifctas s2rauvo t0tlenxrcty1fa  auei;s trtmxm3oydlltnmfvt sfsrumx  ;u0alx mociyt mDraumsnu4tetrir tatopt  nes;()trurio oo1omeemictl(fs2uaur no1ope  oetldfs2emuvp t4tlenxo3to1omDelu i s s2uoxmpiodop  mneia( s2taur ou0ole mieilsls2rauvon(4 eeoirctytfate i slt  rtmxrpou4om emncsl( s2tax o;t4oexo ieiadfa eaumo;u4tetrxo3ootfaDeaneilt) rxrimpiu1lme lnet t)a2tm(r nu1tex mieiytls2rl(vp;(0alxoio3tatop r ueo;s srtoxm3oo1altnlivs (fa2rm(r ;o0apxn i3tasfm2em(mp;u)tetrxo3iotlpt aueo;t)trxoio oydole lnei tf Dra(  ;u1olt mociysfaDea( s;(0aexrxo ootfptr uvo s s2xo(o oudole mivsltfs2rauro;u0teeo f3iadls2uan onu0aleoir iatlmDe n s t)trurir3iy1amtnmietl(fa2uaxr ;o1oeeomiciltls eluvp t4tleoio oydfa eliei;s  ruoir3oo4ap   ncils)s2tr(  ;u4tpxn ietatlm2eaumon()arenxrctodfmDe ieolt) etrim3iodaptnlivtat) Dtax pot1apxoiiciad mDum( p t4 lenxo3tadfm rliei;t0 2toxopoydam  lfvs s sDtmx p;t0tex ioeild a umnmp (4 etoxo ty1faD  i o;s0srurim3ou1altnmfctas)s2rr( ooo4oet ii3iltlm2um( pnu4 exnxfciodla r nvsls t2toir3iodoltelncsl(fsDraxmp;u1tee if3tyt a ulnvsnu)arerxr3iy1oa ranei;s)truo(opnydlm nmieslt  2uru pnt1oexn feilt mDrmnmon() rerxf3io1oa rluei ( teur(mpnudlm emncils)a2rrur ot4oeenmoeiaslsDeauvp u)altnmo todla raivsl()s2xriopnudaleemiesat) rtmxmp;u4tpe moctltfmDulu o u0tltrir ty1oatr nvs;s0texrir3io4ap n nei s s2tmxm oo1alx mociatfa ran pn() eeoxo3oa1fp r nes (0 2xmim3iydaltemiei t a2tax oot4tetnio3iydfmDemump;t4areoiocio1lmDeluvo s0 rurxo ou4amen nct sf Dur(mpoo4olxomo3iatfs rmnvo;t) etomocoa1lp  livo t) rtmxr iydape liesls s2rmum no0teeo f3iysla2um(ms u4 lxoxo tytfmt ln i;s0teurxm iy4olt livilt sDua(  ;o4oexnif3iytfm rmnvo;u0 eenmo3oytlp   nvs;t)tetoxmpno1opt  feslt s2rr( pno4tpx  ociytlsDua(vont)arxnxr3oa1fpDr i s;s)s2xm(rpny4ol emict t  Drax p;o1olx mf3tydls em(vont0 rtnxr3ia1op  ai i;(  euo(rpnodalt  neia()a2rrx ono1oltoifciasfa2uan pnu0tleoxr3iotfm  lu s (0 2xoxo3iy4lpenmicsat sDrrxroot0oexomfetytlmDem(mp;u4aexnmf3tadfp r u s t sruo(o3no1oltnlietas s2tm(monu4ape  feiltfsDrlnvpnu0tlenxo3tytomDr i s;( srtoxmpio1apte fvia(fsDraxmpno1apto fctlslsDrmu o (4 lenmfcoatlmDr ues;t t2xm(rpnudamt livs tf Draumonu0tetnmictysfsDuaump;t)aexnir3ta1laDe u olt  etoxm nodom n ictls  rtr(ro;u4tlxoiieildlaDua( s (4aeeomr3oatomD  ues;s0tetrir3oo4ap nlfvtatf Dtax  nu1tleo o3iytlsDumnvp u) etnxrcto1fpDr uvo;s trxm(opnu4aptn iet s  2urxro;t1tleo o3tyt s umnms u0arenxf3to1lptelivs;t)t2xoxmpnydllte ncsltfarrr(mo;t1tetoioctldfa rmuvpnt)texrio3oo1fa  anvs (  exm(o3oo1lpen ivi ()artmxmpnt0oexnifeildlm2em( p;t)teermo ta1fateaneo;t)srtm(o nydamee neil()a2ta(  ;o4tltn i3iaslmDelnvo;t4texnmrcty1faDrlneil()s2xm(o3nu1ame lnctl( s2tax p;u4aetomfctlsls2ulnmpn(0aexoxfcia1omDrln ils)teurxo3nudlm e ivi ()aDrrumoou0oee iieilt s uauvs ()arxoxfcoadfp eanvs;() 2xrxm3ny1lltemivs sf rum( o;o1open ietyslm2uan p;t4 rerio oadoptr uvi s  eto(rpou1op n ieiltfs2trxro;u1oeenifeiasfaDeanvo (4arenifctadfa  aiei ( s2tr(m3no1lp emnctl(farrmu pou1oex mociydla ea(mp () rxnmr iy1fa r n il()trxriopoo4al  mnct () 2uaurono4olx ifciyd mDuluvont)aleoio3tytfmD ln i t  rtoxm iy1ap  lncsa( aruru  ou0tet mf3iadfm2el(vs;()arxoxf oa1opD  ivi s)teumxo3nudape livtasfa2rmumooo1oetn i3iys a ranvs u0altnmocto1lptrai il( setoxr oydalenlfvsat  Drmxmp;o0aetomiciad s rm(vo (0aleoifctodfpD lueslt sexo(m3iu1omenmncs (f rtrurp;o1oeenmfeiyt m el(von()trtoio tadlptranvol()s2xm(o io1apenlicsls)s2tru pou4tetn ictyd a2ranms;t0tlxrmr oatlp   ueo s) etoirpoydaptemfei ( artrx pot1tpenmf3tys m rmn p;u4teeriocoadfaDr n i;( seto(m no1ol e fvs ( aDuaxmpou4opxomfeildls2rlu s;u0 rxoir tadlpDrai s;s0setm(m3iydlltnmnctlt)sDur(r nt4tex  fciyd a el(msnu0 ltrxrcoa1oa rauvi t trumir oydllenlnvtl( arurx p;o0aee moetadfaDumnmo t0teeomf3iydla  lneo t)seuo(opnu1amtelfviltfsDrmx  ou0opx ifciatfa emu onu0 lermr3oadopt li o;t  2xo(r nu4olte fvil( s2umx ooo0aeto f3iys m um(mpnu0aleoif iodoa   iesls) etr(o3iydal emfetas)artaumpnt0apxn ociysfmDrlu p;u0tlxoir3oo1op e n s;t)srxoxopnydalt  icil(f 2rrur no4apxoiietydls2em(mp (4altoif oa1fpDrlu o s)s2tmxo3oy4al   nei t  2rau  oo0oee  oeiat aDul( o u)alerio3ootlmtelnei t t2trim3iodamt  fesatfaruau pnt0optnio3ilsfs2rl(vsnt) rxrxo3ia1lp raivslt seumim3io4lmt lnci s s2urur ;o4ole iiciadlsDrau s;(4 lxnxfciadfm  ln ilt sexm(m3io4altnlnet t) 2taxrooo4opto f3iyt a rm(msn(0 rtnxr iytlm  lneo s)setrxm3nu4lltnlneilsfsrua(  ;o1tpenifctytla eln s ()altomo3totoa ran sl()srumimpny1lm   nctasfs2rau  nt1tlenmieiadlmDuanmo (0 eeomo3tydfpteau o s) 2uoir ou4lmtnmfcil( artmxmooo1tptomoctadlsDum(vs t0aeenmo3ta1fatrauei;s  2xmimpno4amt mnciat)arururpnu4tltnioetyt aDua( o;u)tetomrciodom rli o () rxmxo3iu4ale mnci sfa2ta(moou1opto ietld a2elnmp;u)tleoxr3ta1lp raiei t  rtmxm3nu4lmtemici tf rrmum ;o4aptomociatfm emumpn(0arerir3tydfaD an s;t0trtm(r oy4ameemfctasf rta(rooo0apx ioetasls ulnmp;u0texnio3iy1opteln s s)srxmir3iudal   nei tfsDuaumo;o1olt  f3tys a emnvp;(0trerifctytoat lu ols) rtrio nu4alt mieiltfsrraxrp;u0oee  oeiaslm umums t)trxrxrctydfm r ues;t)teto(mpiudal emici t)sDtm( oou0tptomfciytfaDea(vsn()teeomrcta1fpDe neo;s sexo(m3iu4lm   nvs (  2tm(mpnu0alx mfeias sDumums;(4 exrmfctadlatrln o;s)srto(r nydoptn nvs s) rum(ro;o0aetnmoctydfmDeaumpnt4 eeoio io1fmt  nvo;(  2tmio3ou1ll e ivs s  rrr(mont4tpeomocilsfmDran p t4 exrxo3ootfmDelivols srxrxmpiodomtn ivtatf 2tr(r nt1aet mi3iasls2rl(vp;(4aeeoxocto1lmtelues () rtr(m nudll  mivs (farraxmo;o1alenioetaslm emums u0 lenioctydlm rln ilt  2ur(rpnydamtelfcilt arrr(rooo4opt  feiydfa2eau pnt) lxoifctodomDr nei;(0sexoxrpoydol   netat) Dtm(rp;u1aleoiociltla2rmu p u4arerxocoytop  lnvilt sexmio3iudlme lnvsl()arrm( p;u1ope mf3iltfmDua(vo;u0 lerio iydlmte uvi ()truoiopio1ome lnvtat)srrrurp;o0opxoif3iltlm2elumpnt0 eenmr tytlpt livi (  2umxopnudopee fvslsfa2tr(ro;o1oexomf3ilsfa umump (0 rerif3tadlpDeaivs s0 rxr(rpno4omtn ivsa(  rrrum no4ope  feiyt s2emumsnu)texoxo ootlp r n i (0trxo(r3nydlmtemnetl( aDtr(rpou1aleoioetldlmDum(mpnu)texomf3oa1oa eaieol(0trtmxr iudomt mfvtl() Dumu  ;o1altoio3tltlm em(vo;t)tlxnir iytopDeaivs s) rurxm3oodape  fvs tfa2rmxmpou0texo ictatlm2ea(vsn(4trtnmr3ootfmtranei;s t2xrio iydll nmfciat)sDrmum nu1teen i3tyd a2uauvp t4trtnxf3ootop  au o;t s2urxopiy4ole mfcsls)s2ua(mont0aetnmi3ild m2ua(mpnt)aeerif3tydlpte neo;t srur(r oy4ol  lnctas) 2uaxmont0aptnio3iatfs rlnvp u4 etomfctotfmtrlivs;s t2uoio io4llee ncsas aDtmx o;o0tlt mi3iadlaDrauvp;t) lxrmfcoa1fat aivsls0 exoiopnu1lleelieils sDtm(monu0tle mi3iltfsDea(vs ()teerir3tatla  lnvsl()tetrxr3oudlme mfesa(fsrtr(ront0oltn feiytfaDul( o;(0tetrxf3ta1oa   nvsl(  exo(m no4ome lnes t arurxr oo0aex iietatls uanvpnt4texoio oodopte ivi;s0tetr(m nu4lp nlict t srrm( o;u0tpenmi3tld m2emnmsnt) renmr iytlpDrlueilt texmxopny1lm e ies ( a2raxmono0ope  oeildlaDua(vs u0alxnxr todoptr ivolt0trtriopou1ap nmfviasfs2ur( oou0teeomieiysla2uln ont0teeoxf3tatfa e ies;s)srxm(o nodomt mictltfs2raxr nt4tltoiociadlaDelu onu0trtrxfctadlp  aivo ( seumxo3oudlpt  fvilt)artax pnu4tle mieils m em(vsn()tetnir iotlaD lnei;()srtoxo3ou1amtnmivi s artrxm ot1optn o3ilsfs2em(vs;(0teeoxocoytomDe ivsls0 2umxo3oodaleelfcsa( srurxront0tptn iciltfm umuvp;u4 ltomfcoytfmtrln s () 2tm(opoy1ol e neslsfartaxrono1aex mietatfs ua( pn(0areoxr3iytlmDr uvi s)srtmio nudol emfetls) 2urx  nt4oexniietldls elnvpn(4 etoif oatfa  lueo ( truo(rpoy1ome lnvs tfaDtm(r ;o0olto ictas s eauvo u4texrmocoadom   nvils  rxrir3oodom emnvtlt aDraumo;o4aexnmoeild aDeau s (4 lxniociotom elnvolt texr(o iydamtn nctls srurx p;u4oltoio3iyt m rmuvo (0arerio oa1faD lu ol(0truoio nudole mncsasf Drrxm ou1apx  ieilslm2eln p (0 rxoioctotoa  ln ol(0 euo(m3iydom  lies sf ruax  ;t0aee ifetys m2ranvpn() rtoir3oy1fp eaies;(0 exrxm nydomee nvtlt)srrrumooo1tetoii3ilslm rlnvo t0 etrmo3to1om  ln ilt srxm(o3io1lptn net t  Dumx  no4oeeoifeilsfaDulu ont4 rtoif iytlptr i il(0t2xmxmpoodlp e nct (  Duax ooo4aptn feilt mDemnvo;(4aetrio tadopDeliesl()trxr(o3nu1opee netas)srurx p;u4alx  oeiydfs elumonu4 ltrmrcty1laDr iei (0trtoirpou4omtnmnetl( sDrm(  ot4opeo ociytls umu pnu)altomr3ia1opDean sl(0tetoxm3no1openmnvsas) rum(m oo1olxnii3iadlsDranmo u4alxnxr iydomD anvolt)s2xmxo iudoptn icsl()aDrrxmooo0aeeoio3tyt mDua(vp;(0tleomfciotfmD  uei;(0trumio iy1lme lncta(fartaxroou4tetn fctyslsDumnvont)aexrmr iytoa r n ols  etrxm nydapt  ivilt)aDraum nu0texo f3tyt s el( p u0alermociy1fp eauei;t) 2xoir3iu1am n nesatfa2rrumpnu1olto ieiatls2ra( o;t4 exrmr ty1omDr ieo;s0texm(o no1lm e fet ()s2urx ont4tetoio3iltla rmn s;t0tlxoxr iodomDelivs t0s2toxo3ou4optn icilsfa2taxmo;o1aexnmoeiad aDrlu p t4 lxrifciotomDeaivs;()tetm(o ny1lleemfesl()a2tr(rpoo1tpxnmo3iyslaDemn p;(4aexrxf3oytop eln slt)setoir iy4lme mnesas)arrmum nu4oexn ocildlm2emu pnu4texrio ia1fp eaieols0 2xoxopiu4ap n fei s  2raxm ;t1ape iociatlmDel(ms;t)artomf oadfa ranvs;( truoim oo1opte nesa( aDraumonu0altomieiyt m2umnmsnu)arxrif oatfpDrai o () 2toimpny1ame miviat)arrmurpot4oex  oeildfm2el( s (0texrxrcoo1om eai o;t)seumxmpnu4lpe mnet s sDrmxmooo1ole iietldfm eluvonu0trxnircoa1fmt  ues;t  etrim iydop emivsls  rta(  ot1alt mi3iat aDra(mpnt)artnxf3iodlp  aieilt) 2xrxo oudapenmivs t  Durumoou1aex ioetatlmDran snu)artomo ootlaDrlneslt)t2xmiopiu4lm e fesas sDta(rp;u1olt mf3tyt s uanvs t0aetnxfctodlmtr n i;t0srum(o3iy4op nmfciltf rtau pou4tpto o3tytls emn o u0 etnmrcoatlm r n i;t0 etr(r nu4amen nei s  ruaumo;t0oee ifcild sDeaump t) ltrmf iy1faDr ivi;s0texrxo3oy4lltelfeta(faDur(monu4apt ioeias m2ea( s;t4 reoxociytoa elueslt) exr(mpny1ap  mivi s a2rrx ont1tlxn fciadlm2ea(vo u0aeeomr oa1fm rlnvi;s0s2xrio3nu4olen nctltfs2trx ont1ape  i3iasls2ra(vs (4tlenmo3tydfaD aies;() eumim3iy1optn ncslt)sDtmuroot4aee  i3iatla2emnmon(0tleoxf3iotomte n ol(0tetmimpio1ale mfvtat)arurx o;u0olxn iciadla2elnmp;t0 etrxrcoydfmtr uvil() rur(o oodop  mfeta(  Dua(m ;u1ape ioeiltfs rm(vp t0alxoif3io1lmDrlu o s t2toxr iu1llen nei t)sDumxmooo4apt  ieiad s el(mo u4altnxrcoytfmDr nes s seuoio iy1op   iesls)sruru  oo1tptomfcildls ulu s;u) leoxf3oy1fmt  uvil(0t2umxr oy4amt  fvtat)arua(r nu4teeomfetydfa ul(ms t)tlenxr3iytfat ai i;t0texmxo iu1lpt micil() rrmur oo4tlt  o3tldfs2rm(mp (0texrxf oa1latrauvi;()t2triopio1omt lfvtlt  Dtr(mp;t0oleomf3iatlsDea(vp t) rtrxo ta1lmtr n ilt seumxm oo4apt lfvi ()a2rmur ;o0aet  o3tadlsDua( pnt4aexnxo ia1laDeau s;s0t2urxo oydlme  nvi t arrmx  nu1alxomociadfaDuau o ()tetomf oatla elneil( truoxr3nudol   ncsl(fs2tau onu1alx  octyd aDeanmo u0 reniocta1lp rauvs;s)s2to(m nydlmt lnei sf Dtaxm ;o1aeeomfeiytfs ea( snt0aexnio tatfp   u s;s0t2ur(m3nu1lpe  fvil(f 2tax pnt4tet mi3tysfs2rmumo u0alerirctydlmDr i ils  ruoxopnudop  lnvt tf Dtaxrp;t0aexn ieiytlmDran s (4 exoio3iy1laD anvo;()srumxr3io4lmtemfvsas  Dtrurpoo4oltnmoeiadla2rln snu)trermoctotfp r n o;() rtoimpiu1al   icilt sDrrxr ;t0oleomo3ils aDelnmp;t0tleoxf todfate nvs;()texr(rpoydll nlncsas a2uru p;u4aptn o3ild m2eanmpnt4treoifcoy1lm eln o s0 2trxr oydlptnlnvtl( srtau p;t1ole iociytfa eauvs;(4 ltrxf oytlaD auvols0setm(m3iydoleelncslt) 2rmumont1oee if3ias m2umnvo (4tetrmo oytfpDranvi s0 rtoxopiu1lpt  fvsa(  2rrum ou4oeen fcils mDrauvpn(4 lenmrctotlpt ai s t teuoxrpio4amt licias a2ta(m ou4alt iociadfs rl(vont0trerio3oodlp e ieo (0t2trxr oo1ape mnvsls)s2tau p;t0apt if3tydla2el(vs t4 leoxrcoadfmDr ivi;s0 rxoio3iu1ap e fesa(  Dtr(rpno1aexomfctlsfs emuvp t)tlxnxr ia1lm  auvi ( sruoxr iy4apeelfctl() 2urxm ou0tlenioeiysfm ua( s u)trtrmf oodlpD lneol( trurxm oodoleemfcsl(  rta( pnu1tpeo f3ils a ulumo () etoxr tytfmDr uvsl() 2trxr oy1ap n fci t)aDrr(mpou0alx iiciasfaDuau s u) eenxfciatlpDe n s;t0 rxmirpoudalt  fvtat  2urxr ;o0tet  f3ild a2em( snt) exrxo tydomtranvsl(0t2trxmpoodaltemncs t sDururoou1tpxn f3iasla uau o t)altrif3oa1fp elnei t seto(o3iodlltemncsl() 2raxm ot0tptoio3tlt s emn p;t) etrif to1fm rauvilt0srumir oodlpte ivsas)srta(root0oeeomfctyd mDrmuvs;(4tltomr iodfptrlivo (0s2tr(opny4amenlnetasfs2tmxmo;o4apxomictytlaDeanvp t0 etrir3tytfatelivs s) rtoxrpou1alenmfctat)a2um( ooo0tlt  f3tys m ulu snt0tleomf3iatoaDrlu ol(0sexm(mpio1alee fvt s)srrmu pno4alt io3iasfs um( pnt)areomfciytomD li i t)srxmir io4alenmncsl()srtmxr nt4tlen fciydfa rl(msn(0trxnxoctydlmtr uvo;s  rurxopnu4ome livtl( artmuroot1tee  f3tasfsDumnmon() rxoiociodlm e nesl() exm(o iodlltemiet t  rurumpnt1tpx ii3iad s ran s;u0teeoxrciytfpte uvo;s0texrxm3io4lme mfvils)a2uau  oo1oee mictydlmDuauvs;t) rxnxrcoy1fm   nvi (0trxm(r3io4op   feslt) 2trx pnu4oexomo3iadla2ua(ms ()arenircootom eauvs ( seuo(opnu1omtnmietlt) rumxmpoo1tleo ietysla2em(vs;t4arxrio oy1fm eauvils) rxr(opiy4omte fcilsfarrmx oot4texniociys a rl(ms;(4alxoxr3ootfmt anei (0trurim3nodolt mfvsls srraxrooo1oltomi3iadfa rln s;t0artrmr3iatlp r i s t)tetmxrpoodlme liei sfarrrxm oo4apxo ociltfa rl(vp;u0 renmf ty1lp   ueo;t) rxo(rpou4lptnlnesatf 2tmu pot4teeo f3iatla2ea(vs () eeoxo3oy1fp rlu o (0s2xrir3io1ale  fcs t arrr(roou1tlen ieias m2rmuvp;u0areoxf3iytomt aivo;s s2xr(m3iu1ole  fci t  2urur nu4apeo ictltfmDulnvo (0 rxnxr totomt  uvil() 2toiopou1lmtnlncs (f Durumono4tpeomietyt sDuaums u0tetniocto1fm   u o t)sexm(mpoudap emfvsl(f rrr( pot0teto ieiyslm em(vs;u4teermr iatfaDelivi;s0 etoxrpnodam e fes (  Drmxrooo4tpeomf3iad s ea(vp;() exnxfcty1fmD an s t  2ur(r iy1ope lfes s)s2rau p;o4alxnmiciasfs rmumo u0altrif3oy1oat lnvsl(0 2umim3io1ameelnvi ( aDumurooo4tleoiociyd s rauvp;t4tetnxr3iatfp  an o;s0trto(opoo1ll emnvil()artmu pnu1tlxnioeiytls2rm(mp;(0 renmo3tatfpt liei;()s2xmir iudlp   ivil(fsrtmxrono1tltomi3tyd m em( o t) ltnmf3io1lateaneo s0 rumio3oudlptelfetlt)artaum ;u1apt iictyslm emuvon()arxoxocoydfaDeli o s s2toxr ou1lmt  fcil(fs2um(ro;u1tpx iietys m2um( o;u0aexnxr oatlmt  ueo;( setmxm3io1ope lnvsls  Dtm(rooo4aleoifciaslmDuluvo t4tlxrmfcoodlmDeaivo;s)sruoxm iydal  mnvtlt) 2umumont0tlto f3tyd mDra( s u0texnxocty1faD  uei s srxrxr3iy4lle  icta()srrrx  ;t0tltnmoeiat mDum( p ()teeriocto1opDraneil(0sexrir no4olee ict t) 2umxmooo0olxnmf3iasla2umuvont0aleoxfciadoatranei;s teuoiopio4op e ici s) ruaxrooo0tetniictyslm ea(vo u4texnifcoydlptrau ilt) eurxopoydopenlivtltfsrumxrp;u1tleoii3iltfs2umn on(0aetnxocto1fa rai o t trtrirpio4alenmncs (fs2raumo;t0alxnifetyt m el( o (4tlxnio3todoaDe nei s)sexoxopnu4altnlivi tfs2ua(m nt0aee mf3iadfa em(mp u0 rxrmo to1om eaueo;s0seuoxr3iy1open ncil(  2urxmo;u1oetoiiciltlm2ulnvpnt)trtnmfcoydfpDrlivo;s) rtm(r ou1lltelietlt sDtru pnu4ale mfeiltls rmn p ()alxrio iadlaD lies;s) etm(mpoo4ll  lnetlsf Drr(r ;o1tleo iciasla2ua(vsn(4 reoirciydlmte u s;s) rxoxo nu4oltelnctlsfartrx  ;o0aleo ieiydls emu p;t0tltoio3to1lmDrauvs;s srxoimpiydoltn feil(f rum(r ou1aptoiieiatla um(mo u4aeeoxoctodop  aneil(  2xrxm nydlptnlnvtls)s2tr(m ;t0aptnmf3ildfm2ra(vsnu)treoifctydfp  aiesl(0t2uoxr iudlm nmfvils) rrrx oot0olt miciyslaDeluvo (4 rxrxf3iadla rlneils  eumxr3oodlm e ietlt) rtaxmonu4opt iieiys a ulnmsn(0tetrxr3ty1opte i ol(0 2to(r iy4ll e icilt)arrm(rp;u1aexnmfetat a2eau snu)texoio3ty1fatelu o;()seurxm3io1ol nlicsl(  rtaxrp;u0oleomoctyd mDemums (4tlenmr oo1laDeaneo;t  rurimpny4apee ivt (  Dua(m ;t1oexnmo3iadlm2ea(vs;t)aexoif oa1opD  ueils) 2umir ou1ome lfciat  2umxm ;t4opt moetytfsDrmnmon()trtoxo3oadlptrln s t)t2toimpoodomeemfesa(fartrxm ;t1aeenmi3tatfsDrl(vpn(4tetrxoctotlatean olt0srxrxo3nydom   fvsa(f 2taxmo;o0oeenmo3iltfs raumo;u4trxrxf3oodfa rln o;t  rurio oo4amte fvsl(faDrmxmoot1aexnmoeiadfm2umnvo;u0 lerxr iydlp e n i ()trtmxopou4ll e feta()srta(mpou4tleo ociysfm2rmuvont0tlxoxf ia1fm ranvo;()s2urxm3iodome lictat  rra(r oo0aexoiociyslmDrmn pnt4 rtomfcoatfp raivi t)seurxo oy1alen fct s)aDrmx  ou0tlt  fciysfsDranmpnu0 renmrciy1oaDeau s;t texr(m3ny1ol elfvt ()aDtrumoou4teeoii3tadls2rln p u) rtrmocty1laDelivs s0t2trxr nydlmtnlfciatf 2rax  ;o0tpxn o3tldlmDem(ms ()aexnmo3tatfp  aivs s s2umxr iu4olen ivta()sDurumoou4alenif3tytlsDem(msnt4texrxfctytlmt ai o;s) rtrxm3oudapenmnvt (fsDraump;u4alx  feils sDrmnvp;t) lxnirciadomDrlnei;(  2xoimpnu4amtnmnesa()a2umx ont4aleo ietysfm raumo;u0 exrxr oa1latranvi s0srxrim iodlm e nct ( s2rru ono1opxomocilsls2ulnmo;(0tetoio3tadfpt ai o;s  rxo(r no1al nmfvt s)a2tm(m ;t1ole iociatls2elu o;(0texrir oodfatrlueo t0setrirpnudll   fei (f 2truronu0tltoiictlsla uau p t0altnmr oydlmDrliei t)texrxr oo4lmenmneta(  rua(ront1aexn o3iad sDemu p;u4 leoir ootoatraneo s) 2xoxm ny1op   fetls)s2rax pno0opxn iciltfm2uauvo;u0 ltoir ia1lp   ivi;s) rumxo iy4ame lfciasfaDtax pou4tlxn fctatfs rau p t)aexomfcio1lp   ivilt0tetoimpoydaptnlfetas  rua( o;u4tpeomo3iasfsDulu s;()alerxr iy1lmt aiei;(0 2xo(m iydlleemfvil( sruaxm oo0oexomictysfsDea(ms u0 exnio3oa1oaDeaivo;( srxoxrpiodap emiesa( s2ra(m ;t1oexoioeiadlsDrmumo;u0 eenxo3iatfm   nei ( t2xmir3iodlleelfcia(faDumxmp;u0texnmiciltfm2uluvpn(0 rtomo iadlptran s t0 rumxopnu1lmtnliei (  2um(mpoo0texo f3ilsla emn p;u4arxoxr oytfmtelnvi s) 2xoxr oydlm  lfesasf rtau onu0tpxomietytlm2rl( p t)tetoxr oodoatrlnvs;s srto(o3ou4op e fvslsfaDtm(r nu1altnmi3iys a rlu o;() renif iadfmD  i s t0 2um(r iy1al emfcils)aruru  ot1tpx  fetatls ulums;u4 lxrmf oatfpD lu s;t0setmxo oo1omt  fes (fa2trx  oo1optnmo3iat sDem( o u4texrmf ty1fp r uvo;s srur(m io1ol  lietltfa2tm(ront1tpto ieiat m eanmonu0 exrxr tytla rlies ()trtr(r3ou1oleelncs s) Dtmx o;u1optnio3iatfmDrau p u)altrxo3ootfm r neo;s  etrio3iy4olt liviatf 2taxrp;o0tpenmo3iysfs2rmums () rxomr iotlaD  ueo (  rxm(opoy1aleemicslt a2umxrpno0tltn fcildlaDelumonu)tltnmo3todfa e uvs (0t2tmio nodal elfetatfsrrmum nu0tlen ieiyd s2emn pnu0alxnxrcio1op   u o;()trtr(m nydlp e nei s)a2taur nt1oltomi3iydfs2ulnmo t)altoxo3totop e uvol()texoim3ny4om n neslt  rtru o;t4apt iiciasls2uau snu)aetoir ty1lptr uvs;s)trtmiopiudlptemnctl(f Durxro;o0oexo feiatlsDrl(mon(0trtnif totlpDr n s t0seurxmpoy1am emiesatfaDraump;t0apeomf3iyd m2uanvo;u4aetrif oa1lptraieo t) exoxr oydalenmict tfsDrrxm oo4tptnif3iytlaDrmumo;t4tlxoir3ia1laDranei;s  rtmxm no1apt  fcils) 2raum nt4tptoiiciytfs2uauvpnu4tlerxr3oodlm eau s;s s2xr(opoy4lme  nciatfs2tmxrp;t0teen i3tadfa ea( o t)treoif3tydlmDrlnei s)trxr(m3iydom  mfvtas aDrmx  no1aet ii3tat aDeluvo;t0 ltrio iodoaDeln sls0t2urxr3oy4oleelnciatfsDtax pnu0oetomi3tydfsDul(vp (0arxrmr iy1omteauesl()s2urxo3no1op emneilt)arrmxmp;t1tpeomfeiydls ua(mo;u0 rxrio iy1fm rlues t0trumio3iodllee fvt s)a2uax ono4ape  oeiaslm2um(msnu4tltnmf3oatoate n slt truriopiudlleemicsa( srurumo;o1aptoiieiat s2elnvs t0teerxo3iodlptelu i;t) eto(o iy4lpeelicsa(fsrraxr nu1aetomf3tldfmDrlumont4 exoxfcio1opD lu o;s)texmirpnudoptelfes (f 2trxrpoo4tex  icild s rm(vs ()tlxnmo3iydopDr nvs;( srxrxmpio1opeelivsas artrxm ;u1ape  o3ias sDel(ms u)alxnio iy1lp eluvi;s0 2trio3oodom n nei (fartmu o;u0tetn i3tydfa2ea(vs;u0arxnifciodlm  livo s0teur(m3ny4alt  fviasfaDtm( pou1tpxo f3tyd a2emn pn(0teerxf3tytoaDe nvol()trxoxr3oy1ap n iesl( aDra(r ot0alenioetasls rmuvo u)tltomo io1lm rlnes;s0 rtoim3oy4opt  fvsa()arrrumoou1oltomf3iysla2rauvon(4 leomfcta1optelies;s t2toim3oo1apt livt s)aDur(mpnu4alenmi3iyt m eaump t0 rxnifciydoa   n i ( sexr(r3io4ale  fvi tf rra( p;t4aetnif3ilt sDuauvp (4trerif3tytoptrlu o s) eto(o3oodolenliesls  2tm(  ot4tetnioetltlsDeanmsn() rxoxrctodopD  i o ( srtrio3ny1ale  nvia(fsDurur no0aex iicildfaDem( sn(0artnmr3io1omDr u o (  exmio oy4ole lnctatfs2rmx poo0aeeoiociltlsDrlump;t0teerifciy1om eauvs;s0srtriopiu4lm elietasfa2ta(moot0tle mi3iasfmDrm(vs u4 ltnmo3oa1lmtrln i;() exrir oydome livs ()aDrruronu0altniocilt s2ul( snu4artnmocootlpDr i s;t0setm(o3oy1ll nmfetl(fsrrmxmp;u1opx iiciltfaDem( snu0 ltnxo oa1fm rlnes;(  rum(m oydol  lfvta() 2ra(  ;u0opeomfeildlmDranms;u0artoio3oo1oateai i s0trtm(r nudllee nes (farua( o;u4teto ieiydfs ul(vpn(4tlxomr3ia1fp elnvo t0 2tmxr3iu1lpt lnetatfarraxr ;u1tlxo octysfsDelnmpnu) ltrxr3oa1lpDraneils  2xoxo3iudol  mneil(f 2umxm ot1aexn ictatfaDua(vpnt)altoif iytlp   ueo;s)trur(opnu1altnmfeiat arurumpoo4oetnioeiytla emnms;()artoxf3ootlmteauvs;s0sexrim ny4oltnlfvt tfs2umx p;u0oetnmoeiysls ulnmp t4 lxnircoatlpDeanvslt trtoimpny4aptelnvtat sDtrxmoot4ape  i3iyslaDulumon()tleoxf iadoa  aivilt0 rxr(r nu4lmtemfci () Dumxmp;u1oetomfciytls2eauvs t4teenxocoytlm rlnvo;t) rxmxmpnu4apt  iesls aDtmump;u0open i3ils m rmuvon(0alxoxf3iydop eli i s)t2umxo oo4ol nmnvs t)aDum(moot0tptoiicils mDum( s;u)teenxf3oydlaDeaiei s)srurir3oydlm nmfcs sfsrum(mpno0tetomoctlt s2elnvo u4 ltrmr3iodlpDrluvil( sexoiopnodlmtemncsatfa2uaxr nu1tet moetytlm rm(monu4 eerxr tydoaD lnvi s0sexr(m oudapenlivia(  Dtaur no1opx moeiydlsDrl( snt4 exnmf tatomD aiei;(0 etmxr3iy1lptnmfci sfsrur( pno0apt mfctld sDra(msnt0alxnmr oy1omteluvsl( t2uo(o3iu4ome lnes tf rtaxrpnt0oexomf3ildfsDul(msnu4 lxoif3oytfmtrauvo;s s2xoxm ou1lpenmfvi tfs2rmumpoo1oeenifciysfsDrlnvo ()tlxrmo iodlm eanes t) eum(opoy1oleelnci sfsDtm(roou0tetnii3tadlsDumnmp u) etoxf iydlmtrauesls)seto(rpoy1lpeemiei (fsrtrur ;o0oex  fetydfs2rl( p;(0 rtoxf3to1omt aueo;() exoxopiu1lpe lfes s  rta(m ou0teeoiociatlm ul( on()artoxociydfpDelnesls0sexoim io1optnmfcia(  rrmxr ;u1opx mo3tasfs2em(mp t0tetoir3ia1la  auesls0tetm(opoy4amtnlici s s2ur(mpoo4tetn f3iatfmDulnmo (4 rxnio3oadoaDr u s;s teur(m iu1olt  ietasfarrmu pnu4ole ifciltla2elu p t4tltnmo ootopD  nes s  etmio ou1alenmnvt s) ruaxm no1tle moctyd m2umnmpnu0texoio3oydfmD anes t0 2xo(o ny4ol emfesa(faDuaump;o0oex mf3iat m uauvo;u)altnmr3oy1fm r n s (0s2xo(r iydap nlicias  rtrxm ;o0tex  ictat mDeaumo;()tetnif to1laD lu ilt seuoxr3io1oleemnctlsfarua(mont0opeomf3iydfs el(vpnt)tltoxocoytla e neolt  rtoimpoodlle  fet tf 2tmx pnt1opxnmi3tldfs rmnmp;u)alermo3iotfaDeanvo () 2xmxo iudoleelfvt (f Drmxroot0tex mi3iyslmDrmuvpnu)trtnxf3tatopD livs t) rxrxo3no4optemnesatfarurxmpou4olt  ociatfm umu p;u0 renmr ootfpteai o s0trxmxrpoo1opt micsatf Dua(rpnu1tptn o3tasfaDra(mp t0 eermf3tytoptelivs (  etm(r iy1ap n nvsl(fsDraumpoo0tet mo3iasfm2rauvs;(0artrio oydlpt  ivi;s)truo(mpnu1ap nlfeil(fs2umxro;t1oeenmf3tatfa em( p;t) ltrio3todlatraivi;s sexoxr3iy4am nlfet tfarra(monu1ole iietltlsDrm(mp;t4arxnmo3iodlatr iei t) 2xoir oo4opt  fctl(f rrmum ;o0aee iociytfaDeanvsnt4trtrmrcty1lmt au sl()srxrxrpiu1openlivi (farraur nu1tpenmi3tatfs rl(ms u0 ltnxfctydopDr i i ( srumxrpoy1llt  icta( a2tmurpnu4apx mfeiadlmDuau o;t0treoxr ootfptraneo ( sruoir oodomte ivslsfarta(r nt1apxoiicilt a2rlnmpnt0tetnmf3iatfmteln s;s  exrio3oodam elfvsl(fs2tmxroou0aex  ietadfa em(vo;(4texrirctytlpD anvsl(0s2xm(rpoudamee fvia( a2urxm ;t0tetnmf3tydfa2emnvsn()trtrmr tadfp r uvo;s) rxoxm3nodlmt mics tfaruau  ot1olxoifeiad a2emnms (0alxomr tytfatran s;( t2uoir3iudllenmfeta()arra(rpnt4tptnifcilt mDemu p;()alxrmrciodlmte nvs;s0teum(m3oo4lpte neiat)a2taur ou1opeo ietydls rlumont4alxoio tatlaDrlues s texrim oudlpt micsa()s2tru p;u4tpt ii3ildfsDem(vp;t)alxoifctytoa e n s;t0 eto(rpnu1ap   fvtl(  Duaxront1tptnmictasfm em(vs;u4aeerxf3ootlp r i s s0sexmxopiy4ap nmnetls srtax  ou4tex  iciat a2rln s;u4tlxoir oodfp r u i s)s2tm(opiu4lltemnesls)arurx pno1aeeniieiatfm2um(vs;t)altrir oy1omD li olt srxoio iydolee fei () Durxm ;o1tpe  ieilslaDrm(vp t0altrmo3oa1laDelnvol(  rtoxo3oudaleelict s  2uaumpot1opxnif3iyd s em(vp;t4arxrxr tatlp  livo;(0s2to(r iu1altnmictlt)aruru  ot0ape  i3ild m2umu pnt0tltrmfciytfm eaivi;(  exoxmpiudll elics sf Dtaxr ;u1tpxnmi3tyd sDemumo t4 exrmr3oodlpDrlnvolt t
\ No newline at end of file
@@ -0,0 +1 @@
+u i s0 etoxopoydll  lnet t) rurxmpnu0apx ioctas a rmnmon(0trerio oytlpD  ivsl(0sruoim no1llt  fvsatf rumxr nt4aeeniieiydlm2emn o t)trxnir3oy1laDe ivs;t  rumio iy1am nmncs tfa2ua( ono4apx if3iyslm2rmnmont0 lenmr oy1late nvi t) rtrio3oudap n ivs (f Dtrx  ;u1tpt micils mDeanvp u4alxoio3tatfmDelu i t0texoim3nu4omeelfcia()artax oou4oeenmictatls uan sn(0 rtnir3tatom  ln s;s)srxo(r3nodoltemieslsfaDuaxmono4aleomocils s ea( p;(0tltnmrciydlm eauvo;t)trtmio3iy1ol n iei t aruaxmo;t0oeenmoetaslm eln p;u)tlxoxfcia1omtelu sl() rtrim3oy4lltelietltfaDtr(r ot0open o3iyslmDumuvs u)aetnio oo1latran s s)trtr(r oo1altemfeias aDtr( pot0apt mieilt a2eluvo;() rxnif3ia1fat  neols seuoxr3iudapte nesl(  Dtm( o;o0aex mf3iadfmDumuvs;u4trtnif3tydla  li s ( srxmio oudomtnlnct ()aDumu ont1olt  ietadfm ea(ms;u)arxomr3todop  ln olt)t2umir3iy4lmte nvilt) rtrxmo;o4opx  iciat m eanmpn(0texnmo3ia1op rlnvo (0s2xr(m oy1om nmfci t) Drm( ono0opeoiieilt sDra( o u4 etnmo iytfp eauei;t) 2xrim3nu1lp nlnvsl(faDrrxr ;o0openifetydls eluvp u0teenmo3io1omte nvi;(0 etoxm3ou1omte ivs ( arrmu  ;u1aetnif3iaslm2el(mo;u) rtrmrcia1faDr i s;s) rxo(mpoudole liei s  rua(m oo1altnif3tld m ulnvs t)aeermo oatlmDrlu sl( trtoiopnodaleemivtlsfs2rmum nt0aetn f3iydfa2rmn s;t4 ltrxo3oydfmDelneo;t0sexoxrpoydam elici s artrxmp;u0teeomoeilslm2rm(mont0alenif to1fateanvs;(0 2ur(r oo4amt lnvslt) Dta( o;t1tltnifeiytfmDeanvsnu0arxoio3oo1fp rau o;s) rtm(opoudolt  nvs s)aruaumpnt4opxo i3iys s2uau p;(0aeerxo3iodlaDean il()texoir iodap   iesltfsDrrurpnu4openmoeiyt aDelnmpn(4aeeoxfcto1oa   nvs t)tetoir iu1ome lfes (fsDtmxrooo0tpxnmocildfa2emn sn(0arerxrctatla raueilt) exrxmpiu1aptnlfctlsfartrumono0apt iieiatfsDuln o t)alxomo ty1laDeli i;(0 rto(m3nudamen fct sf 2uru oou0ole ioetlsfm elnmon()aexnxfcoytfm elu o;s) rtrio3iudlm elivi tfsDtm(m ;u1tpeomf3iad s2ulnvo (4alerxo3oodop  anvi ( setoimpiydlp elneil(  rtmxm nu1alt mo3iltla2ulums t4texnmf3totlp eaiei;t)s2toim oo1lmen ivta(fsDrr(mpou4alx  i3tadlsDuluvs u) eenxfcoatlmDeli i;s trtr(opno1omen ncslsf rrm(  ;o1optoif3ild a uanmont)areoiocta1fa rlivi;s0tetoim io4altnmfct t  rur( pot4oee  icild s rl( p;u0 etoxfcoadfp  lnvils  2xoir oudll e fctl() 2trx  ot1oetomf3tyd a2emumon(0 rxrmo3tydfat  nvolt sexmxm iodlpe lnvtasf 2urx pnu1opt mictlslaDemuvp u4 eeoif ootomD  nvi;t trxoxmpnu1ll nlieia(fsruru  ot1tlen oeiatfmDuan o;()alxnif oydoat aueolt)teum(rpoodal   feiasfsrururono1tee  iciat aDea(mp;u) ltomf tadlmDelivslt0 rxmio iodol n fetatfsrta(rpot0aeeo f3iaslmDrl(vp t) rtrxfcoy1oa rai olt0srxrio ou4op  lnvias)s2tm(r ;u1apx iicilt a umn p;u4 eenxo3ia1laDrluvo;(  exm(m ou1olenmnvtlt  rra(rpoo1tlt  oeilsfs rmnmp u0artoifcoodla eauvols)teumim nudam n nei sf rurur ;o0tpenif3tldla um(mp;u4aexnmf ia1lp rau o t) exrxr3ou4lmenlfctat s2ra(mp;u0opxniieiys a2ua(vp;t)texrxfcty1oatrlnei s0 2trxm3ny1lmen ivsa(fsDrmu ono4aptnii3tld a2ranvsnu4teeriocoydom e u i;t)t2um(r3oy1lme miei s a2uaxmp;o0opxomicildlm2ranvpnu) rxrxfctatfmtranes ()s2toiopnydlle lfeslt  2ur( pot4oet  fetadla ulu s t)aetomf3iotomD  uvs t)trumimpny1ol   fvsat sruaxmpno0aexoifctydlsDulnmont4texnmrcta1lpDeauvs;t) etmim3nudamee fcsls) Dtmumo;o4tpxo ociysla2rl(mpn(0 etnxr3iydom e n i s0s2tr(o3ny4lm n nvilt sruaumpno0apt  o3tydla uanmp t0teeoxo3oa1faDrauvo;() etoiopnudlmtnmfviat)sDumx  ;o4apx iiciyt m2ulumon() rerxo3oatfmtelneo;(0sexm(o oo1omt mivtls)arum(mooo4oee mi3iadlm2eanvo (0 rerio3oa1opt anvo;t)trtrir oo1omenliesas)aDua( ont1tpen fcias s2rauvp (0tltnir3ia1la eln s;s  ruoir3oo4optemivsasfsDra( pnt4texoiieiltfs ea( p;u) eeoxo3tytfpDe n o;t0tetm(r nu1lmeelncil(fsrurxrp;u1opxoio3ilsfa2ua(vs t)trtoxf3to1laDr i o () eum(m3iu1altn ictls aDraxro;t1aexoifetas m rauvpnt0areoxoctotfat aivi s) 2toxm iy1ole mictatf rurum ;t4ope ii3iasfsDrmn onu)aeeoxr iadfa eauvsl(0t2xrxmpoydalenlnet t) Dumurpou0aetniicilsfa rln pn() eenmr3totfpDrlnvi;s texr(o oy4lpenmnvt (  Drauro;u4teeomictadfm ulu sn(4tetoifciodfa r uvi t)t2xmxr oudol e fvi t sDrrurp;t4tpe  i3ilsfs2ranvs;u)tltrio tatom e ueil() rxo(r3oydam elnvtls  rum( o;t0tpeoif3iydlmDrmn s t4arxomr to1omteauvi t t2trimpio4llenlieslt aruaur ou0ope mfcilt mDem(ms;t)tltrifcto1op r n o;()seumxr nudop e icsas)a2tmumpnu0ope  ociadlaDum(vs t4arenif totlm  lueo s0 rurxopnu1om nlivs s)s2rmxmoou4texomocils a2eanms;u0 rxrmfcoydfptrlivo;(0 rxmxmpoudam elnvsls) Dta(m ou4aexnifeildfs em(mpn()arxnmocia1fpDran sls)teumir3nu4llen iei t)arumu o;u1tpxo f3ildfsDrlu o;t) ltrxo3iotopDean ols)t2urxr3iodlle mfct ( s2tmxm oo4oetoiieildfa rmn o;u4 rxnxo oadfat anei;s0trtm(mpno4omt  fvta(  rtmumpnt0tpe ifeiltfs ulu p;()arxrxociotlp elu s;t)trtrirpoo4llee fet s  Dta(rono1alenmfetltfa2ranmo () lermr to1oa r i i t0s2trim3oudlm emfvs s)s2rrx p;t4aptn fctatfa ua( on()altrir3oatfa e i il() 2tr(rpiodamte fcia(fs2umx  no1aptoifeiadla ul(msn(0trenir3oa1fp rlneo;t0 2um(r3iu1lm  lieia( srrr(m ou1tleo ietltfm2emnmpn(4aexrir iodlat auvi;(0t2xr(m3nu1oltemfetls) Dtr(mo;o4alen octld a2raumo u0arxnmf todomtrlneils  2urxmpnu1open nvil()srtaur nt1alxn ieiasfa rlnvont4areomfcoa1laDr n s (0 ruo(o oydop e ict sfa2tm(ro;t1tptoioetyslsDeauvpnu) lerircoatlmt li s;t) exrxr3iu1lmt  nvtas)arrm( ono0tptomi3iydls2elumsnt4 eenmo3iadopDrluei s)setoirpnu1ol  miesatf rumx p;t4aeto fetltlsDeanvp u)aeeoif oytfm r ieol( setmxr iu4llt livta()aDtm(mp;t0oee mfcilsla2ea(mon(0 renmr3ta1optr i ilt0 eto(m3oo1olte nvs t  rurxr ;u1aptn fetydlm uau ont)texnmfciatomDe nvil( t2uo(o3ny4aptemies (f rrm(mpnt0tlt ifeildlaDel(ms (4 lxnir oa1oaD ai s ()srxo(r3oodaltemfvtls)srumumpnu4ape mictysls em(mp;(4aeeoif3ta1fmt au s;t0trxmio3ny4op   ieias  2uaxmpnu1alxn ietat a2rmumo;u)aexoxrcoo1lp  luvo;(0 2xm(m3nodalt mnvt ( a2ur(mo;t4aetn fcild s rm(vp u) lxnmo tadopt  uvo s0s2uo(r iudom e netlsfaDrrxroot1tpx  ictatlmDumu s;u4aexoxf iatfmDrln s;() rxr(opoudlme miei s sDum(m nu0apxnmi3tydfsDra( o;() lxnmrcoydla   uvo;s0trtr(o ny4lmeemfcs t aDtaxmpoo4tlxo fctld a2uanvo () etoxocoadomDe u i ( t2uriopoy4omtn fcia(fs2tmurp;o1oet mieiat s umnmp u4tetomf3iydlm rauvols)tetrimpno4llen neils srumu onu1openmi3iat s rlnvpn(0arxoxo iotfmD li olt s2tmimpoy4altnmfctat)aDtaump;o1aexoii3tlsls ul(monu4 leoir3iy1lpDeanes s0 rtrxo3oy4ap  mietlt)sDtr(r nu4alxomfeiytla emums;() etrmo iydfptraieils  exriopiu4ameemfet sfaDtrxm ou4olx mfctltla2umnvo u) rxnxf3ia1om   nvi;(0 2to(opoodole mies s s2uaumo;u1oex mo3ias a2rlumon()arxrxfcoytfa  liei;s0texmxo no4ole lies () rrrxronu4alxomietlt a2elu s;u4tltoir3tadomDeln i s)tetoxo ou4om  mnvsls)srtaxmo;u0tlt  fcildfa rlump;t4altoxoctadfat livs;t)sexmxm3oydom n fvsa( aDuaxro;t1teenii3tys s ra(mp u4artrmf iy1omDe u ol(0srtoxm3iodom nlneta(f Dtm( p;u1aee ifeiyt mDelu p;u4alerif3iodfaDelnei;( t2trio3ny1open feia()s2tmu  nu1teeomieildfmDemu o u)aexrxocoadlm eaieil(0 eumiopiy1op e ncs (fartru p;u1aetoifctytfm umnvp;u4 exnifcta1la  aneilt t2ur(o iodlpen nesasfa2ta( o;o1aeenmfcils sDrl(msnu4tltnif tadopt auei;s  rur(o3ou1olee icias)aDtrum oo4alenifctlsls2eau p;()alxnifctodop   ivs s0t2umxr3oy1ole  nei t)s2tm( pnu1aeto fciyd m rmuvpnt0arxrmr iotoateanvs t s2tm(o3iydap elnvta(fsrrrum ;o4tet mieiysfm rm( s (0texrmociatlatr nei;( srurir ny4omeelfvslt srtr(  ot1texomo3tltla2um( o;()artomoctodlm e uvi t sruoiopnudlmen fetasfaruru p;u1oetnifctltfs2eluvp u4altrif iotom  ln sls0seurio nu1opeemivta() ruaump;t1aet mfetadls uau pnt0 ltriocia1opt  nei;s0s2tmxmpoy1altemnesa()aDra(  ;u4opxn i3iyslm rmn pnt)arxnircta1fpt ai s ()s2tmxm iudol e nvslsfartrxrpnt0optomfetat m2umnvp;t4 eenxf3tytlpDe uvo;s t2uoim oodal  mieia() Dta(rp;u1apx mictasfs rl(vont4 eeoxrcoa1lm rlnes;s s2tmxrpnu1amtelfvt (  rta(  ;o1tleoifetld a emuvpnt4artnmf iatopDrli s () 2umir3nydllt lfvt (  rtm(  nu4olto o3ild mDra(msn() eeoxf3oy1fa r nvslt) ruo(mpny1ap n ivta()aDumxmp;o0oltomiciys a2umnmp ()tetoxfcio1oa  au o t  2xm(opoudom e nes s)srur(  ou4tpe  i3iyslm2uaump ()trxoxr ta1la r i o;t t2umim io4aptnlnvi (  2ua(mo;t1tltomociadfmDuluvo;t0 rtnmo3tadlateaivs;s) 2trxo nodome  fctlt arrmu  ot4tlen ietas a rauvs;(4tetrifciydlmtelu o t s2trir ny1ol n ies tfartm(m nu4tpeo fctltfa2uaumsnu)artoxf3oo1lateaiei;s srum(m ny1ap elicil()aDrr( oot4tlx if3iat a elnmo;u) etrmr3iodlp  auvs;s)tetrxm iydamt  ncs s sDuau o;o1oet mi3iasls eaump (0 renir io1oate n o t0 eurxo3iudam nlncs ()aDtrx ono0altnmo3iyt m rmu pnt4altrxr to1fm rluei;t)s2xo(o iy1amtemfcs tfs2rmx onu0tpen ociytlmDel(vs t0arxnio3oo1fmt  ivslt)setrxr3iudlpt liet sfs2tmx ono4olxomf3tat aDeln snu0altrxo3iatfp r ueil( s2tm(opnu1lm elfctatfarrrxmpnu4tpeo fcilsfm2em( o;u)arxrmr3iytfa raneo (0seurim3ou1om  lfvslsf Draum oo1aetomfetldfaDelnvon(4artnmf3oydfate u i;t) etrxo3nydaptelnetat)s2umu ono4teenifcias s2ranvo (4arxnmrcty1fa eanvo;s  eumxo ou1lmtelics ()sDtmxr nt4oet moetldfaDrm( snu)aetrio iadlpt lnei;s seuo(r nu1lme livs sfa2tmu o;u0tlxn f3tyd s elu o u)tetrxr ta1lp  lu ilt) ruoxr io1lmte nviatfs2rmx pnt0ole mi3iytfm2rmnms;t0tltoxr3tadopteluvi s0 2xrxmpou4al  lnei tfarrmurpno0alen oetaslsDuauvont0alerxo3oa1faDeln o;()trtrir ou1ame mfeils aDur(ro;o0oetomoetys s rlnmpnt0 rxnxrcoadomtran i ()trtoim3nydomtemivtl() 2trxronu1tpxn icilsfaDrlnmp;(4 reoio tadoat au o;t) exmxmpio4ame lnvtls aDtm(mp;o0teen ociasla ranmsnt) renxfcty1fatr u sl(0 euoir nydlp e iesl(fsruru ooo0aeenio3tatlm eanvo u)teerxocoytfate ueil()trumir3iydlpenmies ( arum(rpnt1tlenmfcild aDean o t)trtomr3iatfmDraieils)truo(mpoudal elieilsfarrmxrpot0tpenmiciysfs2rlnvs t0 rtnifciadlm  lieils0srxoim nudoptn fes s)aDur(ro;t0oet ifetltlm rluvo;u) etomf tytfm  ln s s setmxm3io4llenmnei tfa2rau pnu1tleoiocilsfmDrmu p;()trtrmf totlat lueolt0trumxopoo4al   ict (f 2tmxmo;u4opx  oeiatlmDea(vonu) rxnxr3oodlaDe n s t s2ur(m3iu4ap n ieiatf Dtrxm ;t0oexo o3tad m2rm(monu)trxnxrcio1fa   ivs;s0srurxm nu1omtemnes tf rtrurpnt1aetnmiciyt s2elnvp;(4arxnmo ta1oa r n s;t s2xm(m ou1olte fvs s  Dtaump;t1tpxoifetlsfm ulnmo;u)altnif3io1omt  u il(0seurirpoo1aleelfcs sfsDrmumonu4opx iiciydfmDulnvonu4 eeoifcty1op rlivolt0trtoim3nudll emncsa()s2tmx pno4aexo feiasls eaumont4trxnxo totfp r uei s  2xrxo3nodlmen ivtat  rtru p;t0apenmf3iytls2ra(vpnt4teenxo3to1fm  ai s (0t2xoir nu4lmenmfvt (  rurxr ;u0openio3iysfa2ul(vo u4aetnmr iy1omDr u i;s seurim oo1omee ictas) rua(moot4olxo fetysfa rl(mp ()trxoio tadom rlieslt)sexrir3oodomt  nei (f 2tm(r oo1texomociadfm el(vo;u4altrifciadfmD  n o t0 rxriopou4lle lncs t  Duru oot0tltomfctysfmDel( p;(4tltoio3iydlpDeaivslt0 2xoxo3nydlpe mfes tfs2taum nt1aex iietysfa umu p (0aetomfcoy1fp raivi;s)seuo(mpoo1amtnlivtasfs2trxrp;o0tee mociytls um(mo t)alxoxo3iytfaDe i i;t)t2trxrpoudol nlfei ()a2rrum nt0apeomf3tlsfm2eanvo;u4altrmr tadfatr i o;t)s2toirpiu4open net tfaDraur no1oeto iciyslaDea( on(4trtnxr3iadfaDe nvi t) rum(mpnodaptemfei ()sDtrx o;t1aex  fciltfaDea( sn() exnxr3oy1fa   uvi t)s2xoirpnu1ale  nvsl(f Dum(mp;t1aeen ictltfsDumn s u0 etrxf3io1fmt ai i s) 2toxr oo4ame mivtls)arta(mpou4tpx ii3tldfa2uau pnt0tltoir3oy1fmt  ieols  2umiopiy1ap n fvtlt a2ua(  oo4aeeoiietldfm2uanvp;t0treomr3iy1op  auvsls0 2tmxm3oo1amee iesltfs2rm(m oo1aex mi3taslsDelnvpnu)trenxocty1lpD anvi;s)srurxopoudopen netlsfa2ua(r ou4apenmfciytfsDrmuvo;t0altrxr3oydfatrluvs s) 2xo(o3ny4omeemieia(f Dtaxm ;u4tlt ioetytla2umumo;u)trxrio3to1lm  aivo (0setrirpiudop  lneil(f Drr(ro;o4tetn octldfaDra(ms;t4 ltomfctodlpteaues;() etm(m ou4ol e fcslt arrruro;o4oex  i3ils sDrl(vo t4tltnxr3tydlpDr nvi;s t2trimpiydomte fcs t)aDumxr ot0aeeo i3ils mDean s (4alxrir oatomtraies;() eumxopoo1am elfcta(faDrax pot0tetnmi3iat m2rm( o;(0teenir tydoa  ln s t srxr(mpou4lmenlfctlsfs2tr(mo;t0aptnio3taslm2ra( s t4 eenxo3iy1fmtrlneo;t0 eurir3iy4om elivtlt)a2ra( oot1tlxoii3ias m2ranmp;t)artrxfcia1fpteaieils0 rtm(o nydop  lfvi s sDum( pot1oetomociyd a2ea(vp u)teerif iydfaD livi t)sexo(r iy4ol n fet s s2urxm ot1olt if3tlslmDeanms t0tlxrmrctotom elnei;s) rtm(mpiy1llt mivta(  2uax oou4tlt  iciyslmDelump;() etnir3iatopDe uvols0 2trxopiudam n nct (faDtmurp;o4tpe iieiatfm2umuvp;t) lxnxf3iodlat lneilt)texr(m3nydlp nlietas s2trx ono0apxomf3tlslaDem(mp (4tlxoif3todlm  anvo;t)s2to(o oodal emfet ( aDra( ont0tlt mieildlaDulums t0 lxnxocoa1lmtean i s)seumxo3no4lm emieils  2uaumpnu4oleomo3iyt m2elnmo;(0 lxrxf3oo1omtean sls truo(m oydlle  nvslsf rta(r ;t4teeo oeiat mDeanvs;(0 etnmo3oydfatr uvo;t0 etmiopiodaltn ieslsf Dta(m ;t0oetnmoeilt s uanmp u0 exrmocoodla eaneils0 rxoxmpnu1am e icta(f Drru  ;t4opt io3iyd s ua(ms u0trxrif oy1lpDean i s) etoir3nodlp   ivt () rrrur ou0apt iietltfa2umu p u4tlenio ty1lmt au i s0srxr(r ou1olt mivtl( s2taumpno1tleoii3iad m rl(ms t0alxrxf3ootlaDelnvolt trur(m3oydll nmfcsat)artmxmo;t4oeen iciatla rln p () rxnmo oodomtelieolt0trurir no4lltnlnvs s aDurxro;o4tlenmfeiyd a2rln p u4teermrctatlm  anvs ()teurir iudll  lnvtls sruaxmp;t0oexnmiciys sDemnvo (0 rtnmf todlat  neil( srtoxr3oydope mnesat  Dtmum ;o1apxomieiydls2rmu on(0trxrxoctatfm raiei s s2tm(r3oy4ape  nvs t)artrxm nt4alenmoetyt a2eanvo;u) ltoio oo1faD livs;() 2urxrpiudlltelfctat s2tmx oot0tlxnioctlslm2eaumont)tltnxr3todlmteliesls0trto(o oodolee feslt)aDrr( poo4aet mfeiatlsDuau p;t)tlxnmrciytfptelnvil( texr(mpou4op  mivsl(fa2rru p;o1aet  oeiltlsDuau s u)trenxoctadom elnesls)trtrim3iydam elnvtlt a2taxront1olt ifctltlsDulu s t) rtoxoctadlmteai o;t sexriopoodap   fctasf Duaumpnu1aexnif3iad a uanvpnu)tlerxf ta1fmt aues;t t2xm(m3no4lp elfci ( srur( pou1optnioeildfs emuvs;(0tetnxo3tydfaDraies t0srumirpiudome mfcsat)artr( pnt1tlt io3iatfaDraumpnu4aexnir3ia1omtr ieo;t srxr(m3ny1ole lnvtasf rurx p;t1oltoiieiyt sDemnmont4texnmf3oatoaDrlnvs s)trurir nydapt  nvsls)sDtau ono0tpxomictydlmDem( p (0texoio3oo1omtran i;t setm(mpiydop e iei (f Dtaxr ;o1tlxoio3tyt aDuau snt0tlxnmr oydoa elu i;()t2xmirpnodoltnlfvtls) Durumo;o0opxo ietat m eau s;t0teerio3io1lmtr ivs (  etmxo io1ol  lneia( a2tmum ;t1aex  ietatfsDuauvpnu)teeoxocoo1op  lueil( sexrxopiu4lmt mivs ( s2tmx  ou4openmiciys s el(mont4arxnxo iodlmDeln i s)trurim ny1ll emnctat  rrru ont0ale moeiytlm ranvs (0trxrif3to1fmD lieo;s teumio3io1omtelnvs tf Dtmu  nt0tpxomietysfaDel( s (4teeomf oodomDe ies;t0 2um(r ou1ap  lnetl()s2truro;u4aexnmo3ildfs elnms;(0 eenio3iadlaDeluvo;t)texm(o3oo1aptnlivt t)sDtmum ;u4olx  iciytfmDrm(vp u)aetrxrctadopDrliesl( sruoxo iy4alte ics s)a2taxrp;u0alto octls a ua(vp t4aetrxo3oo1fmDe nvi;s trurxr3iy1lm n fct s)a2rmu ont4aetomieiydfs2uau o t0 ltrmfcoodopDr ieo;s0s2xmxo oy1lleemfct t) Durxr no1aex moeiatfm ulnmp;t0 exoxfcoadopDe ueolt0setoim iy4amte ivt t)srtrum ot4apxoiiciaslm2ean o;(4 lenirciotfp   uvsl()s2trir io4ll n nvt sf Dtmu oot1apeoiociytlm rluvsnu0trxrxr3io1fmDr ivs;s0trtmxm iy1omtnmfci tfsDtr(r ou4ope mociatfm ranmsn(4 lxoxrcia1oa  li o;(0s2toim no1ll n fcia( sDrrumpou1alxnioetld sDum(mont0 eermf iy1lat  uvols)setoimpiodll nlnesl(fsDtmu  nt0tetn ociasla emums u4arermr3oadla e ieol()srtmxr ny4lm nmicil()a2um(ro;u4opeoifcildls rmnvs;t0texomociydom elneo () rxm(mpiy4llt mici tf 2rmur ;t0tltnmoetatlmDean p (0trtrir ia1oateauvolt sexoxo3oydlmenmnet tf rrrxr oo0tlxniocilslmDemnvo;u0arerio3todfpDr n o s  2tm(o iy4am n nvilsfa2trx poo0tpeoifetaslsDrl(von(0arxomr tadoatrlues t0trur(rpio4omtn fcs ( sDtmumo;o1tpxn feias a2em(vp;u)alxoir tadlmt  uei;t t2uoxm iu4ale  netat arrmumo;u0openmf3tltls2rmums u)altrio oatfmt livs;() rxmirpiy4opte ici (  2urxront0oexnmiciat m elnmsn(0 leomo3iy1oaDr uvs (0 rtmim3oy4op   fvsatfa2ra(m no4tpx mfeilt aDul(vp u)artnmrciytlpte ivsl()s2xoxrpoy4lpenlfcs (  2ra(  no1tltn ieilsfa2ua(vo;t) etnxrciatlmDeluvs (0srur(m3io1apeelfei s)arumxroot0apx mociatfs2rlnvs;u0 eenmfcoy1lmDe nes;(0s2xmiopoy1llen ies s) 2uru o;u1aee  ieiyd s ea(vpn() rerifctotfa rlues t  euoxr3ny1lle mnvslt) Duru  ;o1tptoifetls sDul(mp;(0 etoiocoy1fmD anvols t2umxm3iu4olee fes sf rururont0tlxnioeiltfa2ranmonu0 exnif3iadop r iei;s)t2urio nydom elnctas)srrmu pnt0tex ii3iys s2eln onu)artnif io1omtrlieo;t setmxr nodomee ivsasf rtmur ot4olenioetltla2elumpnu0 etnxo io1omt  ieo;(  2tmxrpiodlptnmfci t)sDrmuroou4aex if3iadlmDra(mpnu4arxnif iytfaDeaies;t)srtr(rpou4lpeemfeilt) Dumump;t4teen f3iytfa2ra(vpnt4tetoif iytlm eauvo () rumxmpiydlptelieilt) 2rrur nt4tpx iieiysfa2elump u4 lxnmf io1oa r uvsl(  etmxopoodal n ivs tf rrrx pot4oltomoeias a2ua(vs;(4 rtrmrcootop  luvolt0trxmxm3no4ame lfesl(fs2ra(ro;t4tpx iictasfs2ul(monu4artnmr3ta1fmDrln slt t2xmim3iodomt mfcs t  ruaxmp;t1opxnmoeiyslm rln o;(0tlerxr io1oaDe ieil( s2xmxrpiydlp e ieils  2uau pot0apt  fcildfs um(vo u)tlxrxo iodlmteli s s)teum(mpno1aleelfei t) rtrx pnu0opxomo3tyd s2rmn s;t4 rerxr iadfpt  n i;(  etr(rpno4amte ivt t a2umum nt0aetomociyt mDulnvs u) reoxr ta1lmt  u il( s2xoir3nu1al elfvilt)arrmx  ;o4tetn i3iad s2raump;t4arxrmo3iydfmDe n o s0t2ur(r oo4om   neta(fs2tau  nt0tlxomfctasfs2ranmp u)altnir3iytlp  lu s;s)teuo(mpoo1aptemivsls)sDrr(  ot1tle iociys s2uanvs;(4arxoxr tydfpt  u o () 2xm(r3iy4open nvs () Dtrxmp;o4apxn feiatfm uan s;(0tltrircoadoptrai i s0s2tmiopiudllee ivi s s2tr( ooo4altnmoeiydfm rm( pnu4tltnifciodoa r ieslt s2xoxm3oodlle mies t) rtaxmp;o0olen ictls aDelumo ()alenmf3iytlaDr uvo s  2trxr oo1al   fetlt aDtr(  nt4aeenmfciysfm2raumo (4texoxo3iytlpteln o;()trurxm3nudom n fei ( srururono1alt iietlslm2el(mp;(4 rtoxrcoatfaDr i s;s0 2trxr3iodopt lfeias srta(  ou1oexomfeiadfm2eauvp t)altnxo3ta1fmD lnvi t truo(opoudopt  fes t aDtrur ot4olxn fcildfs2um( o;t)texrxr3oodopt ln ols) ruoxmpiy1olt mivs s) rtaur ;o1apx ii3tas s2rau s;() renxociytop  anei s0 rtmxm ny4ape mncta(f 2rmum ot1tltnii3tat mDemn s u0alxnmfctodoptr uvil( trurimpno1apenmiesl( srua( ooo1apeo i3iysfs uanmsnt)treoio3tadfmt  ieo;( texm(rpoodopt liei tfsDtaurp;o4olx  feilt a emump u4 lenmfctodop  ai o;() etmxr io1lle  ivslt) rrrxmp;u0olto fciyt mDrm( o;(4texoif ootomtrli slt  rtoim nudol e nctl()aDrr(mp;u1tetnio3tadfmDulnmp u4trtomr oo1lmt  ivo t  2umir nu1lpee ivias) rrmxm oo4opxoii3iyd m2rmu s ()tetnio3ia1lateauvo (  2ur(r3oy1lm  miesa( sDumxr oo1tetnmociysls2ean on(0 rtnxf3iadla rau i;t0 2xmirpiudol  lfvs s srumumpnu1apt ifeiytfsDuauvpn(0 rerxocootomteln i t0 2xoxm iydop nlnesas aDrm(ro;t1aexnmfctys mDranmont4arenxrctotoa  lneo ( seto(m oy1opte fesasfaDtr(moou4apen ieiyd m eauvpn(4tetnmo ta1lpDe n il( t2trir3nudlpen neia(fsDtrxro;t4tptoifciat s ulnmp t0alenif tatlpDrai s ( trur(r iodalen ivsas) Dtm(mp;t4tpe mi3iyslmDuan s;(4altoxo3iy1fmt ln il()s2xmxo3iy4omtnmfvslt  rrmum ot0tle io3tysfm rlu s u) ltoiociotlateai il()seurim no1lltn fei ( a2rmu p;o4olxoif3tadla ea(mpn()texnxr iadlp ranei;t)srxr(rpiy1am  lies ( a2uaump;u4tlx ioeilslaDuanms;t0alenxo3iodla rlu o s s2xm(r nu1al   nvsl(farumxmp;u0tpx  i3iltlm2uan ont0aexnxfcio1fp eauvs t0trumiopio4omt lnes s a2tmur ;u4tpt mo3tatfm eln ont)tetrxf3iadoa  ln ilt) 2to(rpoudapt  fvtatf ruax  nt4teeoiieiys aDrauvsnt4tltrxr ootla  auvils sexrim iy1lmtelfes s aDrrx p;u0olen i3ildfmDua( s;(4trenmr ty1lmD luvo ()trtriopiodop  lnei s)srumu oou1tptoiiciydls2rlumo;t4treoxf3tatfpt lieo s s2uoxrpny4ameelfes (farrrurono4opt if3tasfaDemn o ()tlxomf3ootoa rli ol()srtoxrpnu1ope mnet ( aDrm(roou1aeeo i3iadfa2umu onu0arenir3todoa eau o s0teurirpiy4alt lneia( aDrrx pnu4tle mfciatlsDrl( o;(4artrircoatoa rli i;t sexoio3nydllte iei t)srtmu ont0oleoiociydls2umu p;(4 etomr3ootoa r i o;(0setoxr3nudom nlfci ()srrau  ou1olenmoeiat aDua(ms;u) lenxf3ia1fa rln slt0teuo(r3oo4alenmieslt aDtrxmp;o4tltn ietas s2uluvp t4texnxrcoydlaDrlivs;(0trxm(o3oo4am  mnvi ( srtr(mooo0tlx ioeils s umnvs;(4 etnif3tydlate n s ( t2tmio3oudam nlnvsat srtrxr ;o4aee  fctld m ranvo t)arxoir iytlmt  iei;s)s2uo(rpoudomt  ics s)aDur( ono4opt  o3tys a2ean snu0aeenxf oatfpD aivs;t sexrir3nu4lp elivsl(  2rmx p;o4oltnif3iadfmDrlnmp;(4 ltnxfcoo1fmDr ivs;s)t2xrxr iudlltnlnvtl(  Dtmur ;o1oeto ociaslm uaumonu0 rerio3oatlmD luei;s s2toimpou1ol elivsl()sDrr(r ;u0oet  i3iad a2emnvonu0teeomo3totlmteliei (0t2umxm3io1lle  nvils)aDrmxm oo4olen o3tld s2emn s;t0altnmfcoo1oateauei;()s2umirpiy1lmtnlivt sfsDuaumo;u4tpto ictlt a rm( p;u)arxrioctytlptr neol()t2xoim iodalenlfvi s) Dumurpnu4olt mictytlsDeluvont0texrmr tadoatrauei t)trtmxmpiodole lfci sf Dtrxmpoo4aeeniieiadfmDraumo t)alenmf3oo1lptr i i;s)t2xmimpoydame mietltfs2tmuroou0olt  f3ildlsDran s;u)artoxf iotlpDr uvsls) 2xrir3ny4lpenlfes t) Dumxmpot1oetnmfctatfm uanvo;u0 exniociydfpDrau o;s t2xoxm io1opeemfeias  2taxmpoo0teeomiciydfa em(mp (0 eeriocoodlp elnvi;s0truoxo3oy4ole mfcslt)arrmx  oo1aeeo ietltlm2uan ont)trxoif tadlm r ueils s2xoxopnu4ame lietasf rtm(mpoo4tet mfeiysfa2rl(vo t0teeomfcio1la  au sl() etr(rpoudopenmfvta()sDtmx p;o0ape mieiyd m2eau on(0 exnmr iy1opDelivslt) eumio no4llt mfvsas) Drm(  oo4aptnio3ildfs ra(mon()tltrir oydlmDeau s;t)teuo(m3ny4ole liesls) 2rmxmo;o4oexo fctldla2ua( ont)trxnmrctydfa ranvils)trxrim3iy1opt  nctatfsrumxmpnu0alxomfctadfm2em(mp;t0 exrxo3todfmt aivil() exrxm io1lpeelivtat)sDtmxront1opxnifciys s2umu p (4aetrxr3oa1lptraies ( sexoxm3nu4lmtnmieils) Drr(roou0opto ieiadlmDemnmp u0tlerifctodlm rlies;s)trtmim io4ope micslt)aDrm(r ou4oet if3tyt s raump;t0artomf3ta1faDe i o s0srxrio iudlpt mnesat)arurx oot0teeomo3iatfmDulu o t4 exnmrcoydfp r ieslt0t2um(r3oy4apenmnetls) Drrur ou1tlxo iciyslmDemums (4tlerxrcoy1faD an sl(0s2trir oodopt lfvi t a2tr(  nt1tlt  fetat sDulumsn() rtnif3oy1op r u i (0t2urxm3nodoltnlnei (  2rrur ou4aeenmfeiydfmDeanmsnu4arerxf ta1lptrauvo s0teum(rpoodamen ncs sf rrrx pno4apxoif3iatlaDrlu s t)tltoxr3iotlaDraneils srurim nudoltnmfcs t sDurx ont0tptnmi3iatlsDrmu p;(0teenmr3oy1lat li i t s2urio iy4ome  nciat aDurxrp;u0aee ioctasfaDuln p (4 rxrxocoytopt aivi s0t2ur(r oo1am nlfesatfaDur(  ;o1opeomfeiltfs ul(mo;t4 ltoxfcta1fpDr iei;t texmxr3ou1lp nmivtl(fa2taumpoo4alt ifciad sDuan p u0aleoxo totlmteanes s trurxo3no4am e fes tfa2um(moot1tlx if3iyt s2eaumpn(4 rxnio ia1fatrluvo t0s2tm(r3ou1amte feils) Dumump;t4aptomicils s rl( o t0alenircto1omtrlnvo;t)seto(rpoudopeemivs t) Draxmont4alt miciyd aDua( pnt0 rtnxfcoatlmtrauvs s s2uo(r3ny1om e ncsat)s2trxrp;o1altoiiciyt s2em(vs;() rtrmr3iytfm  anei s teumim3iudam e nctlt) 2tmxmont0tpeomfetydlm emumo (0alenif iodlm r uvi s0sexoiopnudolt  ics t  Duaxrp;o1aetnmoeilt sDum(vp;t0tltoxf3ootlpDr i s;s)s2xo(r3nudom e ivtltf 2ua(rp;u1ole ifciyd a uauvs t4alxrmfcoydomDe i il(  etmxo iu4alen ies t)sDtr(m ou1oexniicilsla2rlnmp t0artrio iatla rau i s t2umxopou4ole mfei s  Durx  ;u0tlx  o3iyslmDum(vs;() etomo oa1lm eli ol( seuoxrpoodaltemfvi (faDtr(  oo0openifetytfaDrlnmo;t0 ltrxoctotlaDr nes t0srumir ou1aptnlnct sfaDumu poo4tlt mf3tlslm emu snt4 etrxr oy1omt aneo;s0truoxrpoodlptnmfvil()arraumooo1oexo i3iadlm2uluvo t0treomoctadla rlnes t)trtrirpny1oleelnvt s  rta(mooo0olt  iciytlmDrln s;u0 etoxf3ty1oa r i s ()trurxr3nu4aptn fet s sruaxrpou1aptoii3ils s2rm(vs t)aeeomf ia1om eluesl() exm(m iu4lpe  fei t)srrrurpou1ole iicild s2rmn p;(0altnmr3iotopD aneo;( trur(r oodopen ncslt  Duax  ;t4tpxomfeiatlaDulnms;u) etoxo3iatfmDe ivilt srumxo iu4amt mivslt) 2tr(rpno1altnii3tytfsDum( p t)texrxocoa1fm   ieo (0 exr(m no1omt lnetl()aDtr(mp;t1olxo ocild m2uanmpnu0alenir oatom rai o t) 2ur(opiodlm   fvia()srur(rooo1oet mf3tltlm2elu o ()aeeoxf oydlp eluvilt  rtoxr nydlleelfeil(  Dumxmpnt4opx  f3tat sDuluvo t0teenxo3oadlpD aieol( trxrim3iu1amenlfvsl(fa2rmxmont0aptnmoeild sDum( o;t4alenxrcoa1fa r n il(  euoxrpoodoleemfctls srumurpou0aptnmictlt s2emu s (0trtnxf tadlmtrluvo ()texrir nu1lp  lnctl() 2uru  oo4oee  f3iltfa2uaump;t)aeenif3oy1opDrauvi;t0 rxoxmpiy1ameelnct s  Dua(mont4tpxn o3tad mDeluvonu0treoxf iatoa rauvi;()s2xr(o3nu4ame  ncsl(fartrxrpot4oeeoio3tat s rlumpnu4 etoif3oodopD anesl( t2xm(r oy1ol e feslsfsDtmx  nu4altniieilsfsDel( on(4texoio iatla eanvs;s)srxoio3nudom  livs ()aDtr(roou1tpxomfcildfm uan pnu4alxnxr tadfpD lnvi;(  rxoiopnudam n ieia()arrru ont1aptomictldls2ea(mo;u)tetnmf3totlaD  iei;s0setmim oy4ll nlfvslt)sDum(ro;o4tlxnmictyt s2eluvpnu0 exnmr oydlp eai s;s) 2urxo no1olt miviltfarta(  ot1apxn i3iys m2rm(vs;u0 rermrcta1oaDrlnvs;s srxrirpoo1optnlivsl(f rtaxm nt4alx mo3tytlm el( p (0trtoxo3oytfm eaivil( t2trir nodapen fvtl(farurxm nu0apx iiciaslaDrmnmonu4 lerxf3ta1lp r n s;t  rtm(opoodapenmnet (  rtaxrpno1teeo i3tls aDumu s;(0trxoircta1fpt auvo s)s2trio3oo4altemiviat sDtrump;o0olx mfciaslsDem( s;(0 renxr oy1oa elu ilt) 2xrxr oy4lp nmnet ( aDtmurp;u4texomociydla rau p;(4aleomf3ia1lmtr ueilt0setmxm oy1alte ici ()aDrr( oou0opxomicilt aDrlumsnu)tlxrxrciy1om  aneo s) 2tmio3iydam nlict () 2rrurono4oet  fetad m ea(vs;t4tetnxr oadoa rai ol( sruoimpou1lpenmncil(  2tau ooo0tlxo o3iad m ulumonu0arerifctotomtrau ilt)tetmxrpiudole mneil(fs2truro;u0apxnifeiysfm eanvp;u0areomrciadlpD  n il() euo(opnudoptnlfcsat s2tr(r nu0opxo o3ilt a2emums () ltoio oo1oaD  i slt  rxoxmpiu4altnlnvt s)sDtmum nu1tlt  i3tls m2uln on(0trtoir3oa1faDrlneo;(0trtrio3ou1openmietlsfsDtmu  nu0olxn i3iytlm ulnms () etomfcootlmt  uvo ( trxo(m3nu1lleemneiat a2ur(moou1aexnmfeild a eauvp u4arenmr iy1laDr u i s srur(o io1ll e ivtlsf Dua( oot1opxnmi3iyd a ranmonu0 etrmo iadfpt  uvo;t0texmxo3nu4lp  mfetl()a2tmxmo;u4tet ii3ild sDuauvonu4treoir oy1opDrlnes (0srtoimpny1ame mictatf Dumxmpnu4tex mfcilslm el(mo;t) rxoxo3totoa raueslt) eum(opnu4aptelneslt  rrrxr ;u1tex ioeiyd a ul(mpnu4 rtnxfciotoat livols0s2tm(r nu1amenmfct (fsrta(  ot4tet iieiysla uanvs u4 leoxocoa1fatrlivs t)seuoxo iodapte fvt s) rumxmp;u4apt ifciysfsDra(ms (0tltoioctotoat  n sl()tetrxrpoo1oleelfet t) Drrx  nt1aexnmfeiyslm ra(ms (4arenxr3oo1lp elu sl(0srto(rpnodlp   fetls) rtr(r ;u1apt miciadla2rln snu0artnxf3ia1fp eaiesl(  rtm(r3nodoltelncsa(faDta(rpno4tlxoifciadlm2rln p;u)alxnxrcta1lp e uvsl()t2tr(mpiydoltemivsat aDta( ont4alt iociyd sDelumo;u4 rxrxf3iatfpDr u s;t0s2xrxrpiu1am  mnvsa( s2ta(mpnt0texnifcils m umnmpnu)arxnmo iatfatelu ilt0 2tm(rpou4lm  mfcsasf 2urxroou0oex io3iad sDuluvo;u) rtrxf tydoptrauvs;t0 rtrxrpiodal emnvslsf Dumu  ;u4oee ioetyt sDelumpnu)texoir iotomtrauvi;s0 euoxo3nydom nmicsa()s2ra(moou4apxomo3iltfaDemnvont0 eeoxo3ta1faDraieo s)s2xr(r3io4llenmivi s a2taxm ot4altoifeiytfm2rauvpn() etoio3iotomDrlivs s0 ruoio3nydaptn ivs tf 2rrxro;t0altoioctytlm2rau o;(4 etnio oatoatran i;(0texo(mpiu1oltnmnvsls  2trxmooo0tlenmfcias aDuan o t4teeoxr ta1faDelnei;s0seur(opou4am elncil()arrax p;o1oeto i3iyslsDemu p t)alenmf3oatfa raueolt  exrir3iodll elfvi s)aDrm( oou0apenifciltfmDel(vo;u0aexrmf3oatfpte u o;( trxrir3oo4amt mfes s)a2ra(r ;u4openioeils s umnms;u0alxrmr3todfatelu s ()t2umir iudlle  icta(fsrrrxr ;t0ole  ociasfm2emnmsn(0tetrmfcootopt lueolt0sruoxmpnydal  lict s  Dum(  no1tptoiociydfa emu ont)tlxnifctotlmDe ies () euoxo nydap emnctltfsrum(r ;t0opxoioetydls2emnmo;u) etoirctotoaDelueo;( trxrxo oy4aptnlics ()a2rmuroou4tlxomfcils a2ra(vo ()tlerif oy1om  ai i;t0s2xr(r ou1ole lieiat  Durxroot1oee  ieiad s2ra(mo;u4aexnio tydoaD livs;s truoxopoo1lm n nvs tfs2tmum ;t4tpeoifctysfsDrlnvont)aexnir3ootfm   ieilt sruoirpny4om  lncsls)a2uau  ot1tpe if3tadfs2ean onu0arermf oadlp elneilt0 rtm(o3nu1al nmiciltfarum(m oo0oleniietas a2ua(vp;t)arxnio oo1fmtrlnvo (  2xmir3oy4oltelfetas)arrr( p;t4tlt moeiyt aDumnvs u0aeeoxr3to1fmD lu s;(0srxm(o3oudlp e fei ( aDua(r ot1aleo ietas m rlu s;u) eermoctytlmt  nvi;(0trxo(m3oo4alt lfvs t  ruaxmoou1opt io3ilt s2rmump u4tlerif3iydoaDrluvo (0s2xmxr iodam nmictas) Dra(mont1alxo f3tyd m em( p;(4 lenxocoy1laDelies s s2xoxmpiy1lltnmivsltfs2tax pou4open ictas mDrmump u0aexoxrcoodfa eaieol(0 etmxopou1om elict s  rtm(monu1oexn feilsfa em(mo u0 eenmrcoo1fa raies (0 2trxopoo4aleelfesls) 2tax ont4tee mi3ias m el(ms;t)trerio to1om eaueols srtrim oy4lmeelnet (fsrrmxmono1tptniietasfaDumnmsnt)artoif3iytop  livo s  eumxr no4lm  mnct s) rtr(  nt4aetnmfetldls em(vo;u) rxnxr tytlmDrlivilt) rtoxopno4altelnvils s2rrxmonu0apxoioeiasfs umn p u4arxrxf3ty1optean ol( s2to(r3no4lpt  nvi ( a2rr(ro;o4oexoifctatlm2elump t0arenir tatfmte ueo;s) rxoio3ou4oleelici (f 2ta(rpnt1tlenmf3tytfmDrmnmp;t)treoif3to1laD aivs s  2tm(r ny1ame mfcia( aDrr( oot4oex if3iatla eau s u0 rtrxr3oydlm   n ol()texrirpiu4olt  iciat  2tax ont4aleo fctas m elnvo t0teeomf ty1laDrln ilt0srtm(m3iy1ap nmfvtas)srtmurp;u1tet mfeiatlm2ul(vp;u0 exrmrcto1omtrlies;( sexm(m3iu1ll   nvilsfa2rmx  ;u4tlenmoeiysfs eln ont4 rtrxo ty1oaD li ils0 exo(r3nydlpee fcs t)s2urumpno1aetoii3iytlm2eauvpn(4arxnxociotomDe ueols  2urxm nudomeelnvtls  Duaxmpnu4tltnmf3iasfa ean s u) lxoxr oa1fa ean i s0texrir nudaptemncil( aDumxmono0tlx  o3tldfm2uln o u4tetomr3iatomD  nvils setmxr3iudlpte fes ()arururpot4oeeo ocilsfs ul(mp u0tetrxfcoy1om r ivs;t0 2xm(mpiu4altnlfviasfs2umu o;o0apeo fcilsfs eln p t4aexoir oatopDe uei;( trur(o nydaleemfcsat artmxm ou4aetomfeiytfa2elnvo t) lxnio to1fa  auvs;t  eto(m iy4lm nlnetatf Draurooo0oex iicild a elu p u4 lxnir oytopDe ivslt truoim no1apen icilsfs2taxmo;t1apxnmo3tyt s2ua(vont0areomfcta1fm r ies;t  2umxm iu4ol e fvsat)srtaxro;u0alto ociad a2eau s t0 ltoif3oy1fp e n i;t  rxm(m oo4omenmfvi t) Dumx o;t4altomi3iys sDranvsn(4 exniocia1fa  lu o t  rur(opny1aptemfvt s)s2um(monu0teen o3tldfsDumu p;t0 rtrmr3iadlat au s;(  2tmxm3io1ape mfcs t artm(  no4ole miciat m2ulnvp;t0tlxnmo oodfpDean olt t2xrxr io4ope  ivi sf Dtmum ;u1tlx  i3ilt sDelnmonu0 rerir to1lmDrlu o ()srurxrpnydlptnlfetlsf Duax p;u0olt mo3iltfaDrmnms (4trerxf3oy1laDe nvi;s)setmimpoy4oleemnvtl(fs2urxr nu4oetomoeils a emn s t0tleoxociatfpD lnei t0srtoxr3nodomt mivtls aDuaum nu4aptn fetytla2umuvs;t4aleoxocta1faDelnvs;(0 2xmxmpiydopee nesat)sruaumonu1olt iictldls2elumont4 etrircio1fa raivo t0trumxmpoo4ome mivs t)sDraxrpnu1opx ii3tatls2rlumo t0arerxocoadfa  luesls0s2ur(r3iu1ole lfesl(  rtmxro;u0tet if3ilsfm ra(vp t)altnxoctotlp  luvi s0 eur(opnu1ol n fctl() rrm(mp;o0tltn o3ilslm eau s;t0tlenif oodla   nvolt srur(opiodolee fcta(  2tmu oou1ope  i3iysfaDra( s u0areoir to1lptr ies ( teuo(rpnu1olenlnvils srur(mpnt0texo f3tas aDum(mp t4 rtoxf3oatopD  u o t  exrim3io1altn ictatfs2rm(  no4tle iictat mDemn sn(0tetoio iatlaD auei;s0 exm(o oodll elieilt sDrrxrp;o1openmoetlsla2eanvpnu0 rtrio3oatlpD lneo;t t2um(mpny4lpenlies t srtaumonu1olen fcildlmDelnms t0aetoxocoatfpDrlivils  euoxo no1aptn ivias  rrmxmpot1tlxoifctyt m2em(ms;(0treoiocoy1fpDr nvi;t)s2xrxr iodopt mfesas  2rr(ro;u0opeo oetad sDrluvsnt0alxoio3iodfmtr uvo s0 exm(m3oudam e fvsatfsDtmu  ou1altnmf3iyt mDrlums u0aeenmf3oodfmt lues t texoxo3io1amt mnvs ()srtrxro;t4aeen oeilslaDua( o u0 ltnifctatfateanvo (0t2toxmpoy4ol nmiei ()s2ta( ooo4oeen iciasfa2rlnvsnt4trtoxf3ia1lptrlnvslt s2uoxr3iy1alen nvs t)sDrau  oo4aleniociysls2rau sn(0alenxrctydla r uei s0s2tmim io1opeemivta()s2ra( o;o1aexnmoctldfaDul(mp;u0tltnxf3oo1fmtelu o (0s2umim3ou4oltnlfctls) rrr(mpnt4aex ioeild m rl(mont)trxomf tadlmD  nes s0srtmimpiodolenlfvsl(faDrm(rpnt0tlen ictlt m rmnvon()tetoxf io1fmtr nei;s  rxr(opiodol nlicsls srta(rooo4ole  i3iyt a rmnms;()aleoio3oodomDe nes;t0setrxo3iy4amenlnetat  Duax oot4alxnio3ils s ranmonu4artrxfcoa1opDraivi t0s2uoimpoo4omtemicsa()s2ta(  ;o1aetoif3iadfaDuauvpnu)teeoxfciodlp elieols srtmxopiu1lptemnctasf Draxmoou1oexnmo3iasfa2emnmsnu4trtrxfctadfpteaivi;s)s2urxmpio1apeemivi (f Drax o;u1openmocildfs2rau o;()arermf3io1lptr nvol( trxrio3iodam   nvs s aDtaxrpoo0teenmf3iaslsDemn p;()aexoxr tadfatelivi t  exrio nydopen nes ( aruau pnt0ole  ictadfs2ra(vsn(4 exoxf3oa1fate ivs;(0 exo(mpnu1opeelfet t)a2um( onu1ole mieils s rl( pnu)aeeomo iy1fm r n o t)trtmim ou4open fcsasf 2umxmoou1open ieilt s rl(vsnu) etoif oytopDrai olt0 2xoxm oodlptn ivs sfs2trxmoot0altnifciytfs2rm( sn(4tltrio tytopDrau o;s)s2tmim ny1lptn ieils sDuaurono1oee mo3iytfa emnvs t) lxoir3oytfm  anvilt) euo(rpoo1om elfcsasf Drmumont1tlen f3ils m2eauvsn(4altnmo3iy1omDrlivs;s0teurxopiy4am n nviat) 2raum nu4olx mieild a2ul(monu0aeeoxocoadom rai ils trxr(mpny4al nlfesas)sDtrxmpou4open ocildfa2um(vpnt) rtoirciytopD luvs;() 2umxrpoy4op e fctas artru  ou0tpxnif3iytfaDeluvon()arxrirctadlmtraneo;(0t2xrxopoy1optnliei (fa2raxm ;u0tpx mociys s2uanmsnt0aexoio tadopDe ivolt texo(m3nudole mfctasf 2uaxr no4tptnmociltlsDra(msnu0artrio3iadoaDr i sl( s2toiopoy1lpe  ncils)s2ra(rono1alxn feilsfm2ean s () eermrcoo1fp  luvo;t0 rtrimpou1apeelfcta(fartauront0tpx mfcildla2uau pn(0 rtrmo oy1opD anvs s0s2urxo3iy1op emncta() Drax pnu4oeeniietltlm2rluvon() etnxr todopt ai o t)s2triopiudllt lfvtls srurumpnt0tptoioeiysla emuvs;t4trxomo tytlpDe n s t0 rxriopoy4lltnmict s)s2uru  no4tpt ii3iysfa2rlu pnu0arxrio oatopDe u o;t setrxopnodapt livs () Dtax o;o4opt  feiydfs2umnmp (0arxoxo3oy1fpD  ieilt) 2tm(m iydllt lieia(farur(  ot0aetnioeiyd aDua(mo t)alxomrcoatom raneo;s0 eurxr3oy4alenlfcslsf Dum(rono0oleniociat s2eaump (4aeenxf3iadlp   ueol() 2uo(opou4amenlfcs s)srrau ont4ape ifetydfa2elums (4alxniocto1oatraiei;s t2xm(opnu4amt lfci (fsrrm( oot4tlenio3iltfaDean s (4 ltoir ootla  ai ilt0s2um(o3oy1llt lneils arrm(mpnt1teenmfcias m um( pn(0teenxr oy1lpDeaueolt)t2uo(o oo1ol e iei (fsrum(m ;t0tlxoii3iasla2eanmsn()trtoifcio1optr nvs;( s2uoio iy1omtn feils  rra( o;u0opxnioeiat s rm(ms t0trtoiocty1optran slt  etrim nudlmt lnctas a2raxmoot4oltoifetad s rmu o t4 rerxf3tadopt anesls seurirpoo4olte ivias  rum(rpou1oexoiicildlm2ulu p (0artrmo3iytlpD aies;t trtrxmpoo1apt lici sf Dumurp;o0optn ictatlm rln ont) ltrxo iy1la e uvsls0srxrio3oy4ope mfeias  Dtaumpoo1tetn ieilt s2elumonu)aleoio3oytfp r ueo () etmim nydal n fvsl() Dtr(ront1oeeo fctadfm2eau o;t4trtomociadoptelnes ( sexr(rpno1lle  nvi (  rua(rpnt1apenmieiatlaDel( p u4altoifcoadlpD lnesl(0sexo(r ou4amtnmies t  Dtr(mp;t1olx mi3tlsla2ra(mpnt0 rermr oo1oa r uvo (0seur(r iy4ol  mfvtat) 2urx  ou4alxomoctytfm ra( s;t4aetoxo oytoa ranvo s trxrir3io4ale lfcta() 2rmx  ;o0tpxo o3iat aDelumon(4artrxr3ta1omDran ils0s2tmio3oydlp e icias) Dta(  ;o0olxo f3tadlm eaumpn(4altrmf3iydlmDelieol(0teuoiopiu4apee ncs s)srta(rpoo0olxomiciyt sDrlu onu)artrmo3io1lpt  i o;(0t2umxo ou4am nlncslt a2rr(root1oetn feilt s2ra( o;(4tltoxr3tydlmDelneil() euoirpou4lle mncsltfs2raumpnt1alen o3iatla rl( snt0tetoxocoy1fmD lnvs t  2xoir3io1al  lncils  rtmx pno0teenmf3iaslm2elums;t4 lenircoy1lmD an i s0t2ur(mpnu1op  mfvs sfaDtru ont1tle  f3iasfsDumn p t0tltnif3iadlm   i o (0s2trim3iudoptnmncslt) Drrum ;o0tltnmoeiasfmDeau p t4tltoirctadomDranvsl(0seto(r iy4omtnmnvi (faDumu p;o0apxo o3tasfs2rln p;u4texoir tydom e uvo;s s2toir nu4ap   fvsa()sDtrumpot0alx ifetatfs2rmu o;t0altoirciotop e n o (  2tm(r3nu1lpeemiesat) rrmxr ;u4tlen ocilsfmDrmump u4teenmf3tydlptranvo;t texmxo3ou4omtnlncs t)aDrmxrpot1apen ietytfs ean p (4 ltoxo iadlm  lu s;t) 2tm(m3nu1lptemfvtatfsrraur ;o1tle mfeiydfmDrlumpnt0alenifctadfp eanvo;t) eur(r oo4ame lfcs (fa2uau onu4olx  f3tls s um(mpnt4tetnxfciadop rauvo s) euo(rpiy4ole lfvtl(f Dtaxm ot4aexnifetad s2el( onu0aetnif oo1fmDelu s ()seumimpou4oleelfctl( srrauroou4alxn fciadfm2ua(ms;()aexnifctotlm elu i;t)srtoir3ou1amtn fvt ()a2tmu p;t0tpxoioeias m2rau p;(4aeerif3oa1lmt auvi t)trxrim3oodaltnmictlsfaDtrum ot0tlen icilsla2ra( on(4tlxnmo3io1laD liei;t s2tmirpou1amtn netatfsrrmxr ot4ope  fetlt aDemumo t0tltrmocoydlm eaieo;s)tetr(r io4am  mivtatfa2rr(  ot0tlen i3ias mDranms;t) lxnmr oy1oaD  u s;t) rxoir ou1lm  mnetl(fs2um(r no0apx mfetyt m rau p u4aexoxr3oadlmD ai s;s0 2xoirpou4lmeemivias) rrmxmont4tlxn ieiys a2eln o;t)aeenxrcty1fptean ols texmxr3oydll n fciltfs2umx onu4apt micilsfs rmuvon(0texrmr oa1faDrluei;(0 2tr(opiy4amt  ivta(faDrr(mpot0aleo o3iadfmDem(ms u4 rerxociydla raneo s0 2xoimpiy1oleelnvils sDum(ro;t0altoifcias a uanvo;t4aeeoifcoa1omtraues;()teur(m3ou1lm   nesas)sDrru p;u4alxo i3ilsfm eanvp;(4 eenmrcoytopDeai s s0s2toxr ou4lp  lfet t  2ra(m ot0apxnmfeiys a rauvs u0 lenxfciodomtr i olt)trtrim3ou4lp elics (  2ra(  ot0olt ifciydfa2umn pn(0altomfcio1omteauvs;()srum(rpio4om  mfcta(  2rm( o;u1aptn feiltfsDrauvp;u)aeerxo3ty1lpDelu i ( sruoio3ny1lp  mfes t)aDta(mpou4ole io3ias s2rln p ()trerxoctatlmDraieils) etm(r iu1ap  lfcilt) 2rrxrp;t4openifetydlmDum(vp u4 rxoxrcia1fa   ieo;s0texr(opio1lpenmfvil(  2trum ;u4tpe  fcilslaDumumo;()altniociadfaD livslt0 rto(r3ny4lmtemivsatf rtrur ot0olxo icils m2rauvo;t0 lxrir to1oaD  n s;t0srumxm oo4am nlncsltf 2rr(rpno4oetn o3iys m ranmo;u) renxf3iotoa eanvi;t0 rto(r ou1amtnliei () rrr( ono0aexomfeiytfm em(ms () rxnxrciadfmtr uvo t)teto(o3no1amenmnvtlt  Dra( pou4tet  fctadfa uaums t)texrifciydlpDran s s seurxopiu4opt  nvi t) rum(r ou4alxomictasfs rlnvs t4tlxrmr to1oatr i s (0srur(m io1lpenmfcs ( a2trumont0tpxo f3iytfm2eau o t)alenmo ootlat  n o t0sexr(r3nu1apeelivt ( aDr
\ No newline at end of file
@@ -0,0 +1 @@
+ieols) 2xmxmpny1lpe mnvia( aDrru  oo4apeoiociasfmDranvs;u4alermocoatoat aneil(0t2uo(m3iydllee fetas) 2rmum ou0aeenmiciatlaDuau ont4 reriocio1lptr uvsls)s2toxr oydlm nlnctls)arrrx pou0oeeo i3tyd sDua( o;(4aetrio iatfpD  nvi;s) exm(r oydomt  nct t) Drru o;u1apeomoctasfa2ea( pnu4 rerxo3tytomDelneo s0 exoxr oo1ap  lfcsl(f rtmurpou4alxnmietlsls ul(mpn()artnmf oytfm rauvi (0 2umim3iodamtnmies s) Dra(ro;u4tlt mfetyt sDeanvsn(0trxoxf3iy1lmD lu sl( srtrxr nu4olt  iei t)aDraxmpnu4tlxnii3tad m2eauvsnu4trenmf3iytfa rln sls)tetoimpoo4llte nesatfsrumum ;o0tpe  ieiysls2emuvs () ltrirctadom eauei;s) rxmiopoydaltemnesa()a2trxmp;o4oltn oetadlsDumnvpn()trtnxf tadom  lneilt0sruriopoydomtemfvsatfaDra(r nt0open i3ilt a ra(vp;u0treoif3oa1fm  lueslt) 2triopny4llenlfetlt  Draxr ;t4oetomfcils mDrmn o;t)arxoxo oa1fptean i;(0truoxr3nu4apen netlt) 2uru  nu4tlen feiat mDuan s u)tlerir oadlp ran o;( s2uoxm3oydam  mneils) Duaumpot1tex ifciatlmDrmuvo;u4tltomocoadlp eaiei t  etm(o oy1ame miet ( arumxrooo1oetn fcias sDrluvsnt0teeomfcootoatr nesl()t2to(rpoudaptnlnci t)sDtrur ou1apx  oeiydls2ranvs u0 rxrmr oa1opD  i ols)srxmxo3io1op e fvsa(f 2raurp;o4tle miciyt s2uaumsnt0aeenxr3ta1lp rauvs (0t2xmirpiudaptnmnvtltf Duax pou0oet miciasfa2ulnmo;(4aetrxf3oytfmDeluvols  ruo(o3oo1lmt liesat) 2ur(rp;u4apxn o3iyt aDrm( snt4trxrioctadlptrauvo s  exrimpiu1alee fesat)a2rmu  ot4ope iictltlmDrm( pnu)tlxoxr3tatlp elnvo;s0s2xo(m iudaleemnct s) Duauront0apx moeildfs rluvp;u4 rxnxocia1lm e nvs;t trxmxmpoydamee fcsat)srrmxront0teeniieiad m eanmsnu4aetoxf iy1omDeluvi t)srtr(m iy4amtnmncs (  Dumxm ot4oeeoifeiatfaDuluvs t)aexrmrcoo1lptr u s t0srtoxmpny4ale  fcia( sDrr( ooo1tle ifeiydfa um( onu0teeoircto1oa e ueols  exmxm io1alee ncta(fartax pnu1oltomfeildlmDum(mpnu4teermo totlmDeauvs s) rxrim3nu4opeemnciasfartrxr ot4altnifeildfs el(ms t0 eeomrciatop eaivo;s srxrxopny4ole  ncta()a2ur( ont0tpx iicias a emnmsnt0artoif3oo1omt aueo s t2umxo io1ol n feslsf Drau oot1aeeomietysfa2raumpnu) lxoirctotlp  anvols)s2xo(r3iodlptn neia()s2ta(rooo1apx mieiadfs ulu on(4 lxnmo oy1fateaivo;(0t2ur(mpiy4optelnvt s s2uaxro;o0ole moctys sDemnmpnt)tlerirctotfa  auvs;(0t2tr(mpoydapen icil(  Duaxmo;u0optnif3tlt a2ea( s;(4teenmrciodlmDranes (0 exrio oy4lpeeliciltfsDrrur no0opx iicils a2ranvs;t0treomo iadfa eln o (0 2urxm3nodom n nct s)srrmxmpou1apen fciatfs2ulumo t4trtrif3iy1lmDeli sl(0 2tr(r nu4ap elneiatfsDtmx pno0ole if3tysfa2elumo () etnir3iotomDeauvol() 2xoirpno4omt  fctl( aDtmu oot1tex  i3iadlm ea( p;(0tltoif oadfpDrauvs t)t2tm(r3nodomtnmivsltfsDumxr nu1opeoiietadls ua(vpn(4 ltrir3iatoaD  n ol(  rtoxo3oy1opt  iesas)arra(rono1oet  i3iytls2uln on(4texnxr oatoatran slt0t2ur(opiodomtelici sfaDrm(mp;u1aee mo3ilt sDuln p t4 rxoio iytlpD  iei s)t2umirpou1ll nlicia(  rrmxrpnt1opxo fetld m2eanvp;()tleomr oatlp  ln ils)sexrxo3no4alte nvsls sDtrxmont1oetnmo3iltla em(mo;u4arxoxoctytlatelieo (  ruo(rpou4alen nci t artmx onu1apx ifciytfm ran pn(0treomocio1opt aneslt)t2xo(o3iudomt  netas a2urxr nu4altomo3tatfaDrl(vp;t4trxnxf oytfp  lnei s0tetrxo3oydlpenmfeiat a2rmxmp;t4ale mf3iydfm rl(mp u) rtrir iodom rlivi;()trtrxm3ou1amtelfcs ( a2uax p;t0tpen o3iysla2ranmo ()alxomfcoy1fm   ieslt0truoxm nodopt  ivt s)sDum(  oo0tleoioctltlm eau o;(0tlenxf iodfpDelu i;(0 rxm(o nudaptn fcilsfa2taxm nt4texnmfctytlsDean p t0aexomf oo1lm eanvs;()srur(r iudope mfcta(farraxmoou0olx  f3iasfa2elnvs (0alerxfciydom e i i;t0trurxm ou1om n ieiat  rrr(rooo1tltn fciytla2rmn o;t4aetrmf iatfp eaivo t sexr(m3oo4lmtemics sfsDtr(rpnu1tetomieiasfs2uaump;t)arxrxrcto1lmDr n olt s2tr(opnydlmenmfeslsfaruaurpot4aee  feilsfa2ulumo t0alxomr3tadlmDe n s () 2tr(r3nu1olt micilsfarurxmooo0aeenio3iadlsDrm(ms;(0alerio oadoaD aiesls)s2xm(r3oodoltn ivi t a2rmxr nt1apto fciaslmDranms (0 etnio3oytoat lnes;(0t2umxr iu4lm  lfeta(fa2tmxroou4opto ieiysfmDul( o ()arermr iydoptrlnvs t  eto(rpnodol nmncils s2ta(monu0oetn i3tld m2rmu p (4 exrxo oa1fp  li o s) euoim oy1ome  nvt sfaDtm(  no1teeo o3iat a2ul(vp;u0tlerxfciatopDeln s;t  exmxrpiy4amte iesat arta(m ot0opt mfeiltfs uau o;u) renmr3iotlpt anvs (0 euoxo3oydlme  fcta(faDrau  ot4texn ieiatla ea( s t) eermo3iy1fa eln sl()srtm(o3ou4opeemfvsls srrm( onu0tet if3iat mDrmn o;t4 rxnxf3io1laD li s;(0trurio ou4lmtemfctat)aDrr( onu1tpt iociyt m2rmump;u) lerircia1fpt aiei (  rum(opoodlm n ieias s2umxmono0opx  fetld sDuauvo;(0tlxrio3iadoat lneilt)t2xo(m3oo1al emfcsl() 2trxmpoo1opeoiietys m rmums u4trxnxr3tydfp   ivi;s  etoxrpoo4lltelfvi sf rurxrpot0aex iieiyslaDua(vp t) rxrxr iy1oat lnesl(0srtoxopiu4amt lfeils  2rr(r ou0aeeoiocildla2emu o;u4tetnioctotfa elieo;t  rxrimpnu4am nmfcil()sruaurpnu1teenmiciltlmDuln on(4texoxociadoa  anes ( teum(m3ou1oleelfvta() rrr(ro;o1tptn i3tas aDea(vsnu0alermf iytoaDeluvs (  exm(opio1ll elneia(farra(m no1tetnmfciadfm2rlnvo ()tleoiociotoa rlieols0s2umxo3nudoltnlfciat  Drrxrono4tetomf3iys mDelnmp;t) renmf3oodop rlnvil()s2uoxopiodomtelivs (fsDrr( ooo1ape ifetlt a um( o;t)tlxoxf oa1lpDrauvs;t  rtoxo oy4ll nlfesls) 2rax  oo0openmf3ias m2ra(ms u0 etrmf ty1faD  ivs;( teumxo3iudalenlfvt t artr(  oo0opt if3ild a2rlu o;t) lxnmfcoytlpD lnei;( srxm(r ny4opeelnvt ( aDtmxm ot1aleoioeiasfa rlnmpn(0artrifciotomD  ueo s0 rxmir nydamenmnetlt  Draxm oo4opeomf3tyt mDum(ms;u)texrxrciytlm  li s;() exmiopoydlm  lnvsat)arum(ro;o1alx ii3iltfs emn snu4 rxnxrcoydfa  lu i () rumxm3oo4optnlieiasfs2rmxm no0aeenifcildlsDumnvpnu4 eenxf3ta1fmDr u ol(0teumim3nu1lme  neslt)a2rrxm ot0aexn i3tatfsDumnmon()tlerxr3oa1opD anes;s)teur(r3iydllt mfvs (f rtm(mp;o4tpe iociltlaDuln snu)tleoifctadomtr nei t0 rtrim3no1lpenmivsls  rraxmpno4tpeniietydla elnvp;t)altrmo tatlpDrluvo;s0 exoiopnodom elfeia( aDumur ;t1olx mfcildlsDuln o;t0artrir iodfaDr uei;s) rto(rpiu4amt licslt)s2uax pot1alx moeiatls2raumo u4trermr3tydoat anvo;t t2um(mpoy4lpenlivtat s2uaumpnu4aptomi3tldfs2elnmo;u0alxoxo oadoaD lu i t)s2tmirpoy4ll nmfvta(  Draxroou1opxnmfeilsla2emuvp ()trtnmf totfm rluvi t setoim no4ol  livta() rrmxr ot4oexn oetytfs uauvpnt4 lxomf3oatlatr i o;t0 2uo(mpno4oltnlnvt t)s2tr(mpoo0texomociytfm emump u4alxomf3iodomDe ivi (0t2xmxo oodoptelnvtat aDrr(mp;o0opt ifeiadls2rl(mp;(4 rtomo iydomtrlues;t  etoxm nodom elfvil( sDtm(  ;t1tet  f3iydla elnmp;(0treomrcoo1oa rlnei;() 2toxo no1om n fcia(fsrtru pno4tetnmfciytlaDelums;t0 eenxf iotlmteai i;()s2xm(o3oodomen nvsat) rumx  ot1oex  i3tadls rlnmsn(4 etnxo iotfp  liei s0s2uo(mpoydomt mics s sDrrxmo;u1tee ii3tysfmDumu snu0arxrmr3oytoatr i s (0t2urim no1lmt mictas)sDua(mp;o0teenmi3iysla2rlumsn(4 rerxo to1fmteauei;t0 etrxm oo1lmtnmicslt a2rruroot1ope  f3iysfmDeaump t4artomocoy1fp ran ols0 rumim3ny1alenlfei (fartmu ooo1oee iietlsfmDulnvs (0 rerif3totopt  nes;s teumxm3nudlpt  fciat  Drm( pno0ale mo3iat a2rauvp;t4tetrif3ta1lpDeanvo (0t2tmxm3oo4am n ncs (fsrrmxrp;u1ale mfcias s2ra(ms;t4teenifcoodoatraieolt)texr(rpiy1am e fet s arrm(mp;u1oltoioetyd mDum(mp;() rxnir3tydfmDrln i;(  2tmirpio4om elfvslt a2ua(rp;o1tlxn ociytlm2ea(vont4 etnxr3ty1lm   uei;() 2urio oydll nlicsat  Durxr nu1tex mieiltfm ul( o u)tetrxocoydfm  livilt)trtrxopiydlltnlnvtat s2tmu p;o4oeeomiciyd m2ra(monu4alxomr3ootoa  aues (0texmxr3io1lpen ncil()aDum(rpot1altoii3ildfmDuan ont) rtnifctodfpteluvi (  rxoirpnu1lpe lncs t)aDtaur ou1alt mocild sDelnmo u4aleoxf to1laDeln ols tetmxrpoy1ape mivtatfsrurum nu1tpx  feilsfmDumums;()aeermo3oy1opt aneslt srtmxo3oudol  miei t  Dtrxr oo4tltnif3iadla2ulnmsnt0altnmr iotfm  auvo ( trumirpno4am   fctat a2uaumoot0tlx if3iys a2rm(vp;()arenmf3todfp e i s;()s2tr(m iodlltnlict tf 2tax  no1olt iocildls eaumon(0 eenmf3io1fpteanvil() euo(o3iodlmtnmnct t) Dtrx  oo1alx mfciaslaDrm(ms;(4alenio tytlmt  ieo;( teuoxo3no4lp   ictlsf 2trur nu1oet ii3iadfs2emn p;t0trtnmocto1op r ueo s0 euoxo oy1ol nmfesat) 2taur nt4opxniiciyt s2um(mpnt0altnio3oydfat anes s trxr(o3nudlltemietlt  2rr(r no0altn ieiytfa ra(vo (4texrxfctytopDeaivi s  2tr(r no4ape lfvsas srua(rpot4oexo i3iasla2rmnvsn(4aeeomf3oatfpt lnes;(0 2xrxmpou1ape miciat)sDtmx  nu4oee mfctldfsDea( s;u)aleoir3tydfpteln o;(  2urxm nydal n nvt (fa2rruronu4tptnif3iltlmDua(mp;t4teermo3iadfat an s s) 2xrxo3oo1oltnlfciltfarrmuront0tptnmoctltla rmn snt4 rxoxo iy1opteaieo t seuoxr no4al elicsa()a2ur(m no1opt mo3tlsfm ra(vpnu4tltnmf iotfaDrlies s0teur(o3oudllee fctl(f Dum(ronu0texoif3iatlm elnvo t0 eenxf3oodom e n olt0s2toim3oydaptemicil()aDtm(m oo1apxomietytfmDeauvo u) leomo to1fa e ueil(0tetr(rpoudam n nci s) Dur(rp;t0optoifciytfa el(von(0teerir oytlaD livi;t trtmxm3ny4olt lfvs () 2tmu poo0olt  o3ilslmDrmu o;u)aeerxf3oa1oateluesls trtrim3nu4lltelictls)s2ta(m nt1tltoifeiytlm ulump;(0 eerirctotfpDe ueo;( s2umxm nu1lmte nct s a2ur( o;u0tpeo i3iyd s2uauvo t4aetomf iotoptr nvils)t2xr(o ou1lmte net (fa2ta(rpnt4tex ioetyd m2rmn s;t) rxnir3oodfp r nvslt  2tr(m3no1lmeemivslt) rur( pot0aptnifetys sDrm(vpnu4aeermo tadfmD aneslt  rxr(mpoudam eliesl(fsrtax ooo4tlt iicilslaDrlnvsnt0tlxoxr oy1fmD  uvilt)t2trxmpoydopenmicsl(faDuau poo1texomfciysfa elumo;u0altrir iadlmtraivils)s2toxmpiodaltemivs sfa2rmxr ;o4olt mf3iyd aDrl( o (0trenmr iadfaDelneo;s srur(m3no4ll e icsasfs2rru ont0tle io3ilsfmDeau s t0texrxr3iydlmt luvil()t2xoim nudop   icsls artrxmpno1tpto f3iltfs uaumon(0tlxnmfcoytfpD ln olt0texr(m io1oltnmfes ()arrrx oot1oee miciatla2eau on() lxrmr3oodfm eliei;()texo(r3ny1aptnlfesa()arurxmo;o4oexomf3iyd m2ulnvon(4teeniocia1laD aieols) rxmim io1olee nvi tfa2ur(rpoo4aetoioeiltfaDrmuvs;() eerircoo1lp raiei t seumxo3oodomee ncia(fsruau ont1tle mietatfm raumo;t) rerio3oo1lm  ln ol()sexmirpno4olt mncta(  2rr( pot1teenif3iyt s el( o (4 ltomfciy1lm e i i s  etmxmpoydaltnlnvtasfaDtax p;o1teeoii3ilsfsDel(vp u) exnmr3iytfptelieo (  2xo(m nydlp   nctat s2tmx p;u0tlto ietyt mDelnmont4alermrctadlm rlueo;s0t2toimpiudlptnlfviat)srtr( ono4alxnifctydfs2umuvont)arxrir3ia1fmteai i;()t2xrxr nu1lm  lfetas)s2urx pot0tlxnmfetldfmDemu o;u4 rtrxocoy1lmDe iesl( tetrio ou1al n ncslt)s2ta(  ;t1tlxniicild s um(vs;()altrmo3iatfpt aieolt t2xoxr3nudol elfesa( srrrxrp;o0tlxoioctldfa rmn snt4 rxoxfciotop r neo s)srtoimpny4alee nctls arumx  oo0optoiicild s2el(monu)artoiociy1faD aieils0s2xoxr oo4aptnlfesasfarra(mo;o0ape  fciadlm ra(mon(0artrmf3oydfp  lnvs;t s2xmim3io1openmnes tfa2raum ;o1tpx  iciasfa eluvont) exniocio1op rli o t  eto(o nu4om elnvi ()a2tmur ot4tpxomf3ilslm2em( ont)teenxo oo1lm eauvs;(  etoio3oo1alenlivsat) 2raxmo;t0tpxo octys sDul(mp;t0aetoir3iydlmt  ivi t0 euoxrpoy1lpeelnct s artmxr ;t0tpe moeiytfs ulnvp;(0tleoxo oydfpDrlnes s0 eur(rpno4alenlfeslt) rrmu pou4texnmoeiltlm ean p;t0trxnxocoa1lpD  uvo t srxmxo3ny1ome lnvta(fs2raump;u1apto f3tlslmDuln s;(0 lerio todlpD au s;()seur(opiu4oltnmfet s)aDrm(rp;t4tet mocildfaDra(mp;(0tltrmf3oodfaDrlnvo s0 eurxo3oydllenmietlsfaruaxronu4tltomfctltfa2rlnvont4 rtrmrcia1lmDrau s;(0trxoxr ou4lmtelnci s)aDtmxmoot4apxnmfeiatls rm(mont)trxrxr to1fmtr i ilt0s2umimpnudop emivilt) rumxmooo4alt  icils s2rmums;(0treoxr ootop   n i;(0 rtrio3iodoltnlfei ( sDtrumonu1altoifcias a ranvo t)texrio io1fp eaiei (0s2xoiopno4lptnmfvtas srtru p;o0oex  ieiasfmDuan s;u4trerxf3totopt anvs ( s2toimpoydopeemnvs () Duaxm ;u1alen fctysfs2rl(vs u)teenif3iy1fp  aies (  2uoxo ou4om  mfvsa()a2ur( onu0tpenmi3iydfs ul(vp ()teeoir3ta1lm  an s s)srxmxo nu4al emicslt a2raxmono0ole io3iltla2el( ont4aetomoctodomD lneils teum(o3nodllte nvt t)srtrxrooo1tltn iciydlsDem( on()texnio ia1oaDr nesls  rxrxo3iu4ap  mfciat  rumx  ou4olx mfctys aDrmnvo t4aexrxfciydlaD anes s0texmxopnodlmenlfvsas) Dtr(ro;t1opeo f3tas s elu o;u0aetrxrcoydfmt li sls)tetoxm oy4ameemfvilsfs2ur( o;o0ale mf3iyd m2ra(vsn(0arenxr iadomt ln i;( t2tm(rpoy4lpenlnvta()a2rr(m nt0olt mf3tys aDea(mp (4 rermr3todfpD  u sl(0 eum(m3iu1altnmfvs t)srtax  nu1altoifctlsfaDeanvonu) ltoirciydoatelnvo;t teuoir iu1openmfei tfsrrrur ;o4olto ociyslmDul(mpnt4texnxo3iytlptean olt)trtm(m no1lp  mfvtat)srrm(rono4tpx  i3iadfs emn o;u0tetnmocootopDr i i;t0setr(o oy1am   nei (  2ra( pnu1tltomfetytfm rl(ms (0 etoxrcio1oaD anvo s seurxo3nudam nmnctas sDtrur ;u1ope ifciltla2ra( o t) etnmrctydoa e ivs;(0t2toxr3io1al  lici sfa2tru o;o1olx ifeiaslmDem( ont0 lenmf iodom e ueo s  2to(m oy4amt  nctas aDum(m ot1oex mfciydlm rln s ()arxnxr3oo1fp rlnvo;( t2toir3nu1lm n neilt s2tr(r ot1olto o3ildls uanms (0tetnifciytom e ivolt)s2xo(m iodalen fviat)s2urur no0opx mf3tasfm ul( ont0 lermr3oy1om   uvi;t0srtrxr iy1op   fesls)s2rm(mo;u4oeenmfeilsls2rmn o ()alermf ty1oatr nvs;t sexoxmpiu1ol nlicsatf 2uaxrpnt0tet ioeiltlsDean ont)trxoir3totlmtrln s t)trxm(r oydal  mfvsa()arrmuro;o0tlt ifctlt a umnvpnu4alxrif3tatfaD  n o;s tetoxr nu1aleelicsas)arraumpnu4olx moetydfm2ua(vs t0altoxf3ta1lp eaueo;t0s2xm(m3nu4lp nlici (fsDrmurooo4tet mi3tyd sDulnvo u4trtrmrcoatlm e ivi s)tetmiopiy4ame micil( aDrrxmont4aex io3ilsfs2em( sn(0trtnmf iadop  aneo;()t2xrxr3iu1ope  ies t) 2uaxmo;t1alx mocilslmDul(vo;(0 rtrxo3tydoaDr ueolt) 2xoio iu1lp nmnet t sDtru oou0aex moeilsfm2um(vo (4trxrir3iy1faDeai s s0 exrir3oudol  lnct t  rrmuronu4opto oeilt sDrmnvo ()teeoxr3totfat aivo t  rxr(m3nudaleemnvt sfs2ua(mpnt1aptoiocils sDelnvp u0 ltrxo totla eaneo;( s2tr(o oodll  lnvsls)a2umxr no0alt  o3iytls uanvo;(0 eerio3iatfmtr ivi;t)trur(m3iy1om nmfetl()srrrurpnu1tpenmictytfsDumums;()tlxrxociadlmD aieil(0 rumxopnodol elnct tfartr( pnu4aeenmf3iad s2rmu pnu4 lxrxfciy1lpt  ueilt)t2umirpnu4omtnmivtatf rtmxm ot4tltnif3tad aDemuvs;u) ltomo3iy1omte uvo;() exmxo iy4alenmneslt  ruaum oo0alt ii3iydlmDrmnvo;t0treomf iydfaD  i o;s) rxmio3oy1am  mfvsas artmx p;t4aeen o3iyt a2ulu pnu4aeeomo iytomteaneo;(  rurxmpio4aptnlivsltfarra( pnt4ape  f3tat s rlnvp;u) lxnmrcoytomtr iei;t) exoxm3oy4op   ivt ()aDra( o;u4tetomoeiytlsDumnmo (0teeriociadfaDeaneo;() eto(o3iu1lmenlietat  Dumxroot1tlx  fctaslm2umn o;t4trxoxfcootoa eai slt)t2trxm ny1alt  nctas arua(monu4oee  ociyd m2rmu pnu0 rxrmfciytfpt aivil() rxo(o3oy1lptnmieta(fsDumu oou4aeen oetltlm2el(mo;t)tlxrxo oodoa ran ils0sexmxm3ou1llt  nesas)srrrur ou0optoio3ildla2eluvo u)trxoxfcootom eaivo;(  rxoxm3io4lleemnes t  rrr( ono1tpenmietydls rmu p () exoxr3iy1lp  livsls)tetoxm oydope lieiat arrr(ro;t0apt mo3ias aDean ont0 exrxo ty1oa   u sls)s2xoxmpoy1lmtn fetas s2umuro;u0tlx io3tytfs ean o u)treoxfciydfmDrln ol(0srxrxm io4opt lfcsas s2urxmooo0olt mf3iys a em(mp t0aeeoif ta1fmDeau ils) rtr(m iydlm nlieia(f rtmurono4oexn feildfs ul(mo t0tlxnif iydfaDrauvi t0srxmir no1apt mivia()aDtrur ot0open o3iasfs emnmp;u) ltrif3oy1fateln ils srtoxr3iudllenlnvt ()srrm(mp;t0oltomieilt m elnmpnt0altrmf oo1fateln o (0srtrxo iodlpe mnvi sf ruau o;u0tpenmfciat a emumo;u0 rtomfcta1oateaiei;( setr(m iy1om n nct ()sDumxrono1teeoiictys m eluvp;(4aexomo3tadfaD  neo;t0texoxrpiodamtemivtl(  2ta(root4oet  ocild mDrl( p (4arxnxr tadfptr n s (0seum(m io4op elfctas a2uaumooo1tlen oetat m emu pn(0 etniocootfmDe ieo;s srurxrpnydam elncsas  2trx  ;t4alxnifetyslm emuvo;t0aeenif tatoa  aiesls trtrxm iu1om   iet s sDua( oou0tet miciytlm2rlums;t4 lxnmrcoytopDrlu slt0 rtm(r ou1om e ncilsfsDrrxronu4alx ioeiad mDelnmp;t4aeenxr3tydfat an s (0trtr(r3ny1apenlicil(fs2raxmpno0tetnif3iydlsDua(vp t4 exoir3tatopD  u i;s  eumio ou4lmen fcsa( aDur(mont1tpto feiaslm2umums;t)aeerxfcto1lm e ivi s)t2xoio oo4lpen fvta( a2uaxroou1ole  oeiadfm rmnms t)treoxf tatlpte ieslt0seuoxr iy4op  lnei t a2rax ooo0tlenmfeiltfs2ra( s t4 exnifctadfmDelu olt s2trxo3nodol n fei s  Drm(rp;t1apxnifeiys a uaump t4 leoir3oadlmtr nvslt)texmxo nu4apen ivi s) Drmxmpoo4aleoifeiydfaDua( o;u4teeoxo3tatfaD ln il( t2urirpoo1omtnmiet tf rtm(m ot0alto o3ild a rlu ont)altrmf to1oa e uvo (  2uo(opio1lp  micils  Duru oot1aet io3tadlm2um( o;u) lxoxoctotfmte ivi;s) rxr(rpnudal   nvi t  Drru oou1opxniociad s rm( on(4aleoifcoytlatr ueil(0seurxopou4ol  miciasf 2uaxro;u0olt iiciyd s eaump u0tetoxo iatfp e u o s s2xr(o3io1amte iciat)aDtr( p;u0openmietytfmDulnmo t4artnmr io1oatrluvi (0trxrir ny4ope  fvtltfsrur(m nt4opxoiicilslm eln p u4tltrxfciatop ean ilt0trtrxmpiy1ll nlnesltf 2uax  ;u4texnio3tadfs elnmo;t0 exnif iydfp  li i () exo(r iodole mnvslt sDtmxm ou0tltniictydfsDrmu p t0 rtnifcoytla rau i;()tetoxm3no4lmt mieiat s2rm(  ;o4olxo octasfm rln s;(0 rxrmf tatfmt aivsl( sexr(r3ny4optn nes s  Durxmo;t4oleo i3iysfmDumnvs;t)tlxnxr3ootfateauvi;( teur(opiudlltn ietlt) rua(m nu0aleoio3tls sDeaumo u)arermfcoatfmDe ies;s srxmxm3nudll emfesls s2rrxrono4ape mf3iadfs uanvo (0 rxrmo3tadlpDe uvi ()teuoxo3oo4op e ieias)sDum(rpno4alxomoeiltlm ran o;u4aetrxocia1fmDrluvo t0sruoxo ny4lmtnmnvt tfsDtmurpnt1texo o3ildlsDel(vp;u) rtrxf3tydoaDranes;s  rtoxmpnu4oltemncilsfsDraumpou4tpx  ociltlmDuauvs (0 lenxf io1lm   nei;(0t2xrxr3iudapenmivtlt srrrumonu4tpeo i3iadfm rlnvp u0 exomo tytlaDr nes t0trurxo3nodal emncsat  2tmxrpou4tptniociltfaDra( s;u4 exoxr3ia1fm  lues s0s2umim ou4ome livsl()srrmumpou0aet ifeiat m2eln p t4tlxnxf3iydlaD ai i (0 2trxopny4al n ivt (  rrmxmpot1tee  iciltls rm(mpn() exomf oo1lmDeln ol(0 2to(r ny1aleemnetat)arum( pot4aex  icilsfs ea(msn(0aeeomoctadlp  aieils)t2xrxr3nudolte fctatfaDumu p;u0alt mi3tlsfsDrauvpnu0trerifctydop  lu olt0t2xoxopno1ll nlfvi ()aDrm(  no0tltn fctys s2eln o (0trenmf3iy1opD lneo s0 2uoirpou1lptnmneilt sDum(mo;t0openmoeiatlaDumuvp;t0aexnmf3oo1opDelieolt t2xo(mpoudomte fcias) rur(r nt1alxnmf3ias sDrmn pn()aexnxfctytoa rai i;t0 eurxo3iu4lmt lnesl(fa2rrumono4oltniictlt mDelnmo u4tltomr3oadfm e ueo t0srxmir oydlleelics t  2raxrp;t1ope mo3ildlsDuanvp;t0trerifcoytlatelnes;t)teumiopiu1llen ics ( sDta( oot0opx  ieiys a2emnms (0 rxnmfcoy1lmt au i s  etoim3nodlmt lfesat)s2taumonu0alto ietldla rluvo;u) exoir3tatom elieo;s  exmimpnodamt mnetlt)srrrumpnt1aex  o3tltlm2elu p;t4trxomo tadlm  aneo t) 2um(rpoy4ope livs t)a2um(rpno1texn oeiyt m2ea(mp;(0tltrir3iatoa e ivi;()seum(rpoodalen nesl(farraumo;t1apeniieiad m2el(mo;u4trerio ia1fpt li o;s  euo(o nodomeelnci tfsrtr( poo0tpeo iciasls2raums;u0trxrircoatoateaieils sexrim3io1lm nlfctls)artax ont1alxoiicilsfm2rm(von()areoxr3iodfp  anvolt teurirpoo1op elicsls)aDrax  no0olt ii3tlsla raumo t4texoif3ia1opDr u i;() exmim3iy4ap  mies t aDrr( pot1oet  o3ilsfa2rmnmo (0trxomfcoytfate uvo;t trtm(r3iydlme  icta( srurx oou4opxomo3tlslm2umn s u0 exnxf3oy1fp e i i ()srurxm iodll nlncsas aDum(rpot0teto o3iltlm uau s u0 eerxfctydfpt luvo;s0 2um(rpoudlmt lics ()a2ururpno1olxoiietyd m2rl( p (4 reomf ty1faDrli slt)tetmirpiy4olteliet (  Dta(  nt0opxnifciys s2rl(ms t0arxnxr3iadlpD  u s t) euo(r nu1amtelicsasfsDrau oot0tptnmo3tatfs eln o (4 ltrmocio1lm elu slt) 2xo(opiydlpee nvilsfa2ur( o;t4tlt mo3iat mDrl( p;(4teenmf oydomD lu i (0srxrio3iy4olenmivi sfa2rrx o;t0ope micildlmDum(monu0trenxr3tytomDeaiei (0srtmxopiy4am  lnesatfa2umx o;u0olx  feildlm ulu pn(0aexomrcoy1oaD ai olt  2xr(o iydlmeelict sfsrtm(monu1apt mocilsfs umuvo;(0arenio oy1oat  nvo s sexrxr iu4am  lfvtlsfs2tru o;u0tet mf3tadfsDrm(mo;(4 rtnmr3iatlpte ueo t) rtmir3no4optemfesasfaDraum ;t0tlt moeias m uanms;(0tleomf ta1latelnvs;t) rtmxo3oudlmt  nvt s) Drr(mpnt4tlenmfciytlaDumuvo;u) rermr iatop raieils0 eum(rpoodaptn nvta(faruru onu0oleomi3tldfsDrlu s () rtrirciodlpD  n il(0s2tmirpoo1alee nei () 2raum ou0ale mieilt a2emn s;t4aexnmrciotlmte neslt0trxrxr ny4om   fetls) rurur oo1aeeo o3ildfa rln o;u)trxrmo oo1lm  aivo ()trurio oo1lmeemneiatfsrtau pou0tpx mf3tltfm2emnmo () rermo iytop  luvo ( setoxo3no4lm  mfeilt s2tr(mono1tpto octldlsDulu o;(0alxrir tatfaDrlieilt0trtoiopny4alt mictls a2tm(m nu1oee  o3iytfs ulnvs u)texrir oytomDran o ( sruoir3oudale mfeiatfarururo;o1apt if3tyt a elnvp;(4 lxrio ta1la e i il(0texrimpoo4lltemfeiat)a2uaxroot1optomfctlsfsDem( p t0tltoxocoytoa eli sl(0 2tr(o nodlp n ieia(farrmumo;o4apenifeiyslm2ulnmo t0 reoxrciodoa  auvilt)t2uriopiudlpenlics (fs2rax poo0aet io3ils sDua(mp;u0trxomr3iodop  an o s s2uoxm iu4aptnmiesat)a2rmur ot0tpeo f3iyt a rlumsnu0arxrxf iodfm  aies;s) 2tmxo iudll  lncsl(f Dtmx pot0alt io3iydfa2rlnvo (4 rerio3to1lmD ai s;s0tetoxopoo1lp   nvt sfs2rr(mp;t0olt  i3iydfs ua( s t0tlxrio3iadfm rauei s  2tmxrpoudlm elieslt)s2ra( onu1aptniociytfa rluvp;u0tleoifcootfpte i o;( srxmxr3iy4op e ies t)aDtr(mooo1tptnmo3ildls umn p u4 exnmfcta1opDr nvil( teurxmpou1lpenlnvtas)aDra(rpnu1oeeomictltlm eluvsn() lenmfcoydlmt an ilt0 2xmio3oo4op  lnesa( sDurx pnt4opxoifeiat m ul(mo (0arxnmo3iy1lp e n o;t  2uoio3iy1omtnlfcsas) rua(rpno4opxoif3ilsfs eanvo (4 rxrxr iatlaD anvo t setoxm nu1am  licsas  Drm( ono4optomf3tlsla emuvsnt0 ltomf oadlmD aivs;()srxr(r iy4lmeeliei (  Drmxrp;o1oleo fctatla2ua(mont)aetrmfciodfp   ueol( t2xmxrpoodale lncta()s2raxm nu4ole iieiatlmDuln onu0 lerxo3oadfa  lnvilt srtmxm ou1ame lncs (  rrr(  ou0aexomfciatlm rl(ms;u4 rxnifciydop e uvs ( srto(mpny1amee ncia(  Drau  ;t1oltoif3tlslmDrln s;t0 rxoxfcoo1om rliei (0texm(m3iy4ll  mict s) Drrxro;t1texn ieilt m umnmp t) exomf tadopD anei;t0s2xo(opoudope liesa()a2tmu  ou0oltomoeiadlsDrmnms (0 renxr3tadfat aneol()t2tr(rpnodlm nmieiltfarraxr ;u0oee mieiadla ua(mo;t0tltrmr oydoatranvo;t0srtoxrpnudap emnvsl()s2tm(rpot0aet  ieilt s2rmuvp;t0tltoxf3oytopDelneo s0setmio nudop elnvs s)srtm(mooo1opxn fetlsfa rlums;t4aeenxo3ia1opD auvo s)setoim3nudlp   nei t) rtmu  ;u0tpx  icildfm emums t)alerir iadfmtrau i;(0trxoim3nydlmenmfvs s artauronu1opx mfciat m uanmpn(0 lxnxf todop eluei ( t2tm(mpoo1omt mncslt)aDrr( p;u1texn o3iltls2el(vs u)arerifctadoatrln slt teum(mpoodapee neiasfs2tmx o;o4tetomfctyd a2ulu on(4tlenmo iy1lat  ieol(0t2trxopiydol nmfci tf Dra(r ;t1apx mi3iatfs ua( o;() rerioctodfp rlueols)s2urim3oydom nlivtlsf 2uaxmono1apxnmoetld sDranmont)trtomr oadfm rli o;() 2xr(rpoodop   ietas)s2rru ooo4tpxo ieils a eauvs (0arxnirciydoat  nvslt  rxoiopoy4ap   fvil(f rrr(moou0opx  f3tasla emu o t0tlxrmf ia1fp rauvi;( sexm(m oo4opt lieiatfarrr( pnt4tptn ocilsfa2emnvp u4trermo3oydlmtrai o;s0tetrxmpiy4lltemnvsl()sruaurono1oexomfeildfs2eauvs (4artrmfciytlmtranvo;()t2xr(opiy4opt  ivsat)aDum( p;t4tpxoifeiytfs eanvo;t0trtnio tydfa raieil(0tetmxm ny4om nmnci t)aDum( o;t0alenif3tydlm2rluvp;t4tltoif iodfaDe ieo t t2xmxr oy4lle mics s) 2tr( ont1aet mf3iadfm ulums (0 exnmf3iatfmtr uvslt) 2xrio3iy4ope liesa(fartmurono4oeto f3tldfa2raums ()alenio ootlmteluvols)trumxopiudamt  nvt ( arrrxmpoo0tpxoiieiatfs ua(ms u0trtnmo iadoptean slt0t2urxrpny4omen icia( srrax pot0apt mi3iytlm2rmn s;t)tleniocoa1lmt lnvi (0s2ur(m3ou1omtelnes sf 2ra(mo;o4aeeo ieiyt s uluvsnu0trtrmf iadlpte u s;s t2tmio ny1lltn ivs t)arum(r ou0apto ietad mDeau o u4aexoxr3oytlpDr iei;t  2ur(rpnu1olenlictls) 2tax pnt1tle mfctls mDeluvs ()teenmr3iadlmt  i s ( s2xo(m3ou1ameelnes s)a2ua( o;t4oeeoioeiysfs umuvp (0altomo3to1lmtraiei;s) exoxrpoo1lp  lfvslsfaruaur nt4aex mfeiltla el(vo ()tlxrxf3ia1lm  auvo;(0 2tmir3no1llenlneia() Draxrono1oexnmictldlmDrln p () ltomfcootomt ai i;( trurxm oo1aptelivtlt s2raxro;t0tpx mi3ildfaDrmuvo u)artrirciodlmDeaies s)tetrxrpiu4op e ivil( aDtmx  no0tet ioetls a2uauvs;t0 eeoir3oadfmt aivols  rto(mpno1openmieta() Dtm(m ;o0tpe ifciyt m elnvo;t0 rtrio iodfmD aneilt  2tm(m oo1aptn nctat) Dua(mpnu4oltoifctatfaDumu ont)texoxo iydop eanes s) rxrxrpou1lmeelietasfsDuaurooo4altomi3tadls2uln ont4artrioctytomt lu olt) exmxrpiudal nmivta(f rrr(mooo0teto o3ilslaDrl(ms;u0 reomf iy1fpt li s;() 2xmxopiu1lle mieils arrrurp;o4apt ioeildlsDuaump t4aexrio3oy1lmt lneo;(0srtoxr nodamtnmfet t srtax  ;u0ale mieiydlsDelums u0 eeomf oadopte ues;s0s2xmxrpiodlpt lnet s arraxmpnu1tptomocilt sDelums (4texnmrcoatfate n s (0t2tmxmpno1lpeelncsat sDur(  nu4tlx ifcild sDrluvp t0 rxnircto1omDeai s (  eum(r3iudlp  mnctls a2urumonu4aleomoctat a um(vsnt4 rxrir tadop elu sl(0 exmxm3iy4olt mivsasfs2trxmpnt1tee moetyd s2rm(ms;u4trerxociy1la   u i (0truoxr iodlp nlnvsatfsDtm(m ou4tptoifciatfa emnmo;(0areoir3oydfpDrai s s trumio iudal elfct ( a2uaxr nu4texn o3tldlmDrmuvo;u)trermo3oatfmt lnvs;t0sexoim oo1lm emfvt tfaDraxmp;u4teenifcildlsDeanmp () eeomo tytfp   uvsl( srxoxr3nu4aleemnetl(f 2trxr ot4opt mietld s rau snu)altrir3tatop rai o;s) etmxrpiu4apte ieiatf 2tru pno0apeomo3iytfm rmumo () lxnmo3oydfmDelivo;s)trum(m3oo4op emfcilt  Duaum ;o4teenioeilt a eanvp u)treoxocio1fmtraivslt)teumio3oo4am n nctas)a2tau pnu1ole if3iydlmDemn s;t)aleniocia1faD  n s t  etrirpiydll elnetlsf Dum(ro;t4oltomieiad s ulnvsn(4aetnif tydlatr u ils teumimpio1ole  fet s sDtax  ou1openifeiaslm el( s () eermo3ty1om ranei;t seurio io1lptnmivia()sDtr(rp;o4tlt  ocilslm ulumo t4aexnif tadlmDe nvo (0sexoio oy4lme mnvils  2ra(  ;u1tle iociyt m rm( s;u4teerifcoy1fp  liei t teto(m3io1olte nesa()s2rr(ro;o4tltoif3ilsfa2eanmsnu)areoirctadlmtrli ols0 euoimpoudlmeelivias)a2rmx  ;u0oex if3tls s2elumonu)aexnxr3oadfm r ivo t)trxmxr3nydll nlnvt sf Dtaxrpnt0oexoifeilsls um(vs (0teenxrctotoaDeaues s)trto(opoydal n feiat  rrmu p;u4oet iiciltfa2eau snu)aetnxrcoatomtrau i t0 exrxm oy4optn netasf rua(mono0oeenmf3iysfaDranvon() exoiociydfpDrluvo;( sruoio nu1ol  mictls aDrmx ooo4aee  ociytlaDrlnvpn(4arermf3ia1lmt lu s;t  rur(rpiy1al  mictat s2tax o;o4alt iietyd a el(vo u4trtnxf3ootfat  u o;s  2uoxopiudlm nmieia( srtmu p;o4tlt iieiys a2uan on(0 lenxo oo1fm  aieo;s) rxmim3ou1alt mfvsls  rrau ont1teenmictadla umnvpnu4 lxoxr todopDe nvo;s sexr(m3nu4alt lnetl( artmumpot4olto o3tytls eaump;u4texnmf ootfp eaieo;t0 rxr(o iy4amenmivt (  2ra(roou1tptn f3ildlaDumn sn(4 eerir iy1lpDe iei (  eto(r3ou1ale  nvtls srtrx  nu4olx mi3iysfm2uluvo u)tleoiociatomDr uvil()setrio3oo4ole livta( aDta(r ;u1ape ioeiltfa eluvp u)tlxrir tadfat an s;() 2urxrpiudlp   iet s  rumxrp;t4tpeoiociadfs ranvs;u) lenif3totfmDeaies ()truoir iydomeemnviat)sDrrx  nt1aexn fciysfaDel( snt)teeriocoydlpt anesls0tetm(r3nudomte iciltfsrrm(m no1aeenmoetld m uauvs;t0 ltrxr ootlmDeai s t0 rum(m oydlltn netasfarrrur nt1tlt  o3ilslmDul(vpnt)artrxr3ia1fatr ivo;( srtrxr3iy1al n nvs s)a2umx  oo0tet ioctadlm ul(von(4alenir iydlp  aivo;t  exrimpny4am n neslsf Dtaxm nu0oltn i3ildfmDuauvs (4alxrmr oytlptr ivi s0srtoir iy4ope mfvslt  Drr( p;o0oleomocias m ulnvp (0 eenif3oatomDr u il() rtoxr3nu4oleelivi () 2um(r no4apxnifeiadfs ua( p;u4altnio tatfa eai s;(0teur(opnu1altn nvsls srtaur ;u0opt iicilslmDumuvo;t0trenxf3tadlpDran ilt0 exoxm3oo1lmtnlfvils) rtr(m ;u1tptoio3iaslsDumn on(0aexnmr3iodfpD au o;s)srxoxo iu1lpe livsat)sDraxrp;u0aexnmictlt mDrm( p t)tltrmoctytfa eanvs t trur(m3iudll  lnvslt) rra( pno1ope moctlsls2umnms t0 eeomf iodlmDr i s (0srtm(r nudlmtn fcta( s2rmx p;o0teeoii3tys mDrmnvo t) ltrmf oydoptr u s s  2xrxo3iydllenlfeias)aDuau pot0oexnmociat s2rlu pn(4tetrio3ootom  li s t)tetoim oy1llen ivsls)arurump;u4opto fciasfmDrlnmpnu4aetnmociydfm rluvi s0s2tmir3ou4ole mnci (f Drauro;o4aptnmfetys s el(vo ()tltnir3iy1fp  auvs s  2uoxm3no4amtnmnes s)s2rrumpnt4tptomieiyt aDrmnvs (4trtnmrciatfaD  ueol() 2xoir nydoltn ncs ( a2taum ;u0tleomieildfm2uln o;t4tltrmoctydoa r ivils0 eur(o3ou1amtelncs tf rtmx  oo1tpeo f3tadfm umnms (4texrxo iodlpDrlneils t2xoxm3ny1lp elivta( s2rm(mp;t1ope  i3ias a2ranmp u) ltomo oatlaD  ivols sexoir3iu4lp  mnci ()sruaxmpoo4oexnmfciyd m2em(vo u)trenmo3oodlm rlu i ( t2uoio3no1ameelici s) Dtru  nu1aetnifciatfs2emuvo t0alenxo3iytfmt  ivslt trxm(rpoy4ameelieias)aDraumo;o0aet ioeiatls2emnvs u0arermf3iy1fmDe uesl() etr(o oo4omen ivsat) ruau  no4tpx  f3ildlsDrmn s t4aetoxo oadfmDe neo s) rtm(r3iy4op nmnviat)srrau  nt0apx miciatlm2uluvp;()teenir oytlmD ln o;t) 2uoim no1ol emfes t s2ua(  ;o1ope ii3iatfs2eauvpnt0teerif3iadfp rluvo;s)t2umio3iudlp   ici ()s2rr(mo;o4aexo f3ilslaDuauvpnt0 lxrxfcto1omteau sls trumxr ny1llenlncs ()arum( pno0olt mo3ilsfm2rmn onu) leomo todoa e nesls) exo(m3iu1lpeemnes tfsrtmur ;u0tpeoiieiytfm2um(msnu0aexnmo3iy1faDran s t0srxrxrpnudamenmnvia( a2raxro;t1tlx  feildfs2rl( o;u0aexoxo3iotoa raivil( t2triopoudll e ncil( sDrrxm ;u1oet mf3tas s elnmp t)trxrxo3iydlmtrauvsl(0seurir3nudom n fetatfaDtrxmoot4olto f3iltlaDranms t0 lxoir iatfmteaiei s0 eum(m no4lmtnmfvi (f rrrum ;t4tex iieiltfaDua(vs t4aexnxr ta1fpD lu i;s)t2trxo oodapen ncs tf rrmumpoo0tpt  ietasls umnms (0 exrir to1fp r ies s)trxrimpiydamtnlfctlt  rur(r ;o4teen oeiyt s2rl(vs t0arerif to1fmt aiesl()sexoxo oydolte fvsl() 2tmu  ot4tpenmfcilt s2umnvpnu) exnxo tatoa rlivs;t s2xr(rpiudop nlieta(fartmu ooo1alxomo3tas m2uluvonu4arenio3oytfm   u ol(  2toxr3oydalee ict t)sDua(rpoo4aleoiictysfs rmuvo t4trtnmr oytlmDeauei;t t2tmir3oy4llen ncs s sDur(mp;o1texn f3iydfsDrm(mp;() eeoxf io1opDeanvs t  rxm(mpiu1ale  fcta( sDurxmpoo1tet  fciyslmDuanmsn()tltoio3iy1fa raivi s)srxo(o nodap nlfctl(fsDum(mp;o1tlxn fctltfs2rmn p;t4 rxrxf tydfa e ivi;t0teuo(m iu4om nlnvtat sDrm( o;u0opto feiltfm2rm(vsnt)arxnif ootopDe nvi ()texoimpou1lptnmiesl(fa2raur ;o0apeo iciasfm rlu p;(4aeeoif3iadlm elues (0 eumim3iy1lpt liei t a2rrurpot4oex  o3iadlsDel( p (0tetnmf3iodoa  ai s ()trxo(o3nu4lpt lieil()sDrmxr nu4opxoifciatlsDra( o u) lxrmf tytom e i ilt) 2trxr oudalenmfcias s2tr(rpoo4olxo o3iltfa em(ms;u4 rtnxf3iydfpD auvi;() 2xoimpoudolen fcslt aDua(rpno1tptnmfetadfsDumuvs;()aeerif iy1oatraivo;t)t2to(m nodlme lfeil()srtrum nu0apt mociyd aDeluvs;u4arerxrciytfm  aivol()setmxmpnu4omen ivt ( arrm( pnt1oltnif3iltlm2rl(mo;t) etoio3tadfaDeli o;() etr(r oo4ap  lfes ( aDurxro;t1tleomfeiys m rl( pn(0texnxr tadfatrlnei;t0 exoio3oo1altnmnvsa( a2trur ;u4aee if3iyt a2umu sn(0artnmr3oydfaDr n o;s seuo(o nodape lfvt s)a2uaumont4aee  ieiatfs2emnmsnt0 lxoio oy1lp eaies;s0 eto(r3oudop n fctlt) 2umxr no4oltnioeils a ul( s;(4 etrxo to1fpt  nei;s  2xoiopno4ap emncsl()aDrr( pot4optnioeiydfaDrmn o u0 lxnxrcoydlatrliei;s) ruo(r3oydameelieilsfsrtm(rpot0aee  iciadls rmnmp t)arxnmocoy1lp eli il( setrimpiu4apeeliesasfaDtaurpoo1oee  fctyslm emums t)tlxnxrcio1om e ueolt0 2ur(r nu4op nlfcs t) Durxmonu1tpxoii3tlt s uln s u4 rtnirctotlptrluei t0t2um(o ou1lm n nvi tfsDta(mp;o0olx mfciadfa em(vs t)aeerifcoa1laD lu s;()s2uo(opoy4lm e iet s srtr(mont4opeo i3iaslm2um( p;u0 eenio3oy1fat luvolt0tetmxm iydomee fcs t)sDrmur no0opxo ieias m2ra( sn(4altrif ootopt  nvs s)texrio3iudlleelnvias srumumpno0aetoiocilslm2ua(vs;(4aexrxrcty1lm   ivs t0 eurim3iudlmtemfcslt arra(r ot0apxomi3iysfm eln o u)arxnirciytoa   nvolt)sruo(mpiy4amtnmfetas) rrmumo;o4tlxoiociltlm emn p u4trtomo3tadomDr nvils0tetm(opiodam n iet tfartm( oot0tle  ieiyslm2rmnms u4trxnir3iodfaDelueslt setoir3no1apenlneilsf Dumx pou1optoio3tlt a rl( pnt0 ltrirciadlpt ln il(0seumxm oy4ap  mnei t sruax p;t0ole iieiatfm2eln o (0 exrmrctadfat auvolt) 2xmio oo1opee ivi tfsDumx  ;o0aptn oeildfm2rl( onu4alenxrcta1oatraivi;()t2umio ou1ap e fcs ( s2rm( ono4opt mictydlm rm( snu0 lxnxrcoodla  au o;() exmxm3no1ll nmieslsf Dum( ooo0alenifcilslm2rmn snu0tleoxfcoadfatelivi;s0s2xo(rpno1apeemicslt)arurx ont0aee moeild s2ulnvp;u0arxnif3tytomDr nei;()srxoir3iu1lptnmnetas)srrmxrpoo0apto fctat m2emnvpnt4tlxrmo3todfpD  neils)srtmio oodamtn icslt  Dtmxr ;u0tlenifciydlm rlnvsnt4areoxf tytfmD an ols)s2tr(m nu4llt  fesa() Drru pot4olxn feiadfa uluvon(4tltnxrcoodlmD  u o ()srurimpio4olen fei (  rrrxmo;o0tet  o3ilsfaDem(ms u) rxnirciatfmDran ils0 2toio3oo4lmtnlncta(fa2tmxmoou4opx  iciadls2ra(vo;(0arerxrcoy1optr neol() 2trim ou4alte fcsas aDrmxm nt4apx  i3iat a um(ms t0 etomfciytopDe u o;s t2trir iudal nmncsatfsrtmu pnt0tpenio3iltlmDel(mont0tetoxr oytoaDeln i t0trxoio3oo1am nlfciltfartaxmp;t1opxomoeias sDrm(vo;u0 reoxo3iy1fptrai s ()sexr(m oydopen icta(  rurxr ;o0tltoifciys aDea(mp;t0texoxo3iodoat  i s;s)texr(r3ou4ome mnes t)sDtm(r ;o4tle  o3iltfmDrauvs;t4 exnmr3oytopDraiei;t0sexr(opou4amt lfvsa(f Drmu o;o1tleomoetatfs2rmn pnu0tltnir3oy1la   ueilt)t2tmxo ou1oltelnci s)arrax pnt4tex if3tatfa elu p;t) reoioctytopDraiei;() rtm(r ny1lm  mneilt)sDtrur nt4tltnii3iltlm rmuvpn(0 lxrxfcia1fmD li s;s)texo(o nu1amee icilt)sDurx oot4texomieildls2ea(msnt)arxrxf io1lmDrau i;()sexoxopnu1ame livs s a2tr(mooo0oleomi3tad aDrl(vpn(0areoxr oydoat  nvil() exm(opiudom e fcs t)aDraxrpot1alt  ociatfm eanvp t)tltrxocio1fp  luvsls)seumir3nudap nmieia( aDumur oo4apx mf3ild s eanvp;t)trtrmrcoytfatrli s;s  etrxm3iy1lm n net t  2uau  ot0teeo oetadlsDua( p u)aetnxf3iatopDelies;(  rtrirpnydlm emfciasfaDrm(rooo1tptoioetatla uauvs u)tetrifcoy1la  aues;t  rum(mpnu1ll  liet () Dua( ont0oltomo3tlsfs ran o;u4teermrctodopDr u i;t0 exrxmpnydame  ici sfsrrr(  ou1aeenio3tytls ua( p u0 eerxr3oydfatr ivil() rxoxrpiydlpe  iesl()aDrrx  nu4aee mfeiltfa ea(mp t4 lxrmfctatlmDrlivsls0 2tmxm oydomtelnetl(fa2uru pou1tpx iictls s2umu snu0 ltrxocto1fatrlies (0 rumxmpiy4lptnlncs (fartr(rp;o0oeto feias sDel(vs t0 ltnxf3oydfm e ivi s) 2tr(opiy1ameemictas)srra(ro;o0aetn ictysfa eaumsnu4tltrxr oy1fat lnvi;s seum(mpio1omtelivsa( arrruro;t1tex  iciytls2uln s u4 eermo iy1lptr ivils0s2triopou4ameemfviatfarrmxmonu1tlx mo3ilslmDrlu sn() etrmf3todfaDeln ol(0 2um(o oodome mies tf rumu  ou0tlxnmfciat mDua( o () leoiocta1oaDeai i;t) rumio3ny4lpe mfcsat sDrrxmooo4olenmictls a rlu o;()altnmo oadlaDrlieils setoxm oodom nlfcil() rrrumonu0aex ii3iytls2em( o t)aeenmocta1fat li o t)s2to(opiydapt  ivia()sDta(mpno4alx  iciydfsDeauvs;u0aetniocoydlaD anvs;(0 ruo(m3oudol e ivtl()aruax pot1oltoifctld s rmump t4 ltrxo oadfmtrlieolt)srtoim3iudoltelnvi s) 2ua(mont0olx  o3ias s rm(ms (4 ltoircoodfm eai i s)teto(mpoydlmenlicia(  2rmx o;o1teenmo3ils s2uanmo ()tleomf3oodlpt auei;s)sexo(mpoy1lleelici sf rtaxr nt0altoiiciad mDra(mo;(0tetrxr oa1om ranvols)teumxo3oy4llte ici ()sDrmx oot4tee ioetasla2ua(mo u4alxomfcoadfm  lu o;s teuo(o3iu4apeelicias) rtaxmono4olxoioeiysfm2rlnmo t)arxoxo3iydlp  auei t)tetoim3oodom elfvsat artm(m ;u1openio3iysfa2rmn snu4arenir3iytfpte i s;s0srxrxo oo1optn fvsatfs2rrx pou0oee ifcias aDrm(ms t0aeeoir3oy1laDelivo;s0t2uoxrpiodom nlicias) 2tmxmo;u1aptomo3iytfmDuauvpnu0trenir3tadomteanes;t  eurxo3iu4ol e nvsat sDtm( oou1olt ioeiysfm el( onu)tetrmrciydoat  i s;s) rumxr3iodaltelivi tfarra(rp;u4ape  ieiat aDra( p;u4 rtrxr3todoatrluvo t0srtr(mpnodlpe lnesl(fa2raxr nt0apx  fcildlm2uanms t0artrxo3oo1oa e n sl() rtoxrpiy4lm e ieslt)artr( o;u1aetomiciysla umnmo () eerxo3iadfmD  n o ()tetrim3oo1ll e iciatf 2tru ono1alxoiietldfaDrauvo t)trerir3oadla e ueols0truoio iodlptnlfet (faDuaxrpou4ope  ocilslm2emnvo;(4altoxr3oadoateai s (0s2xr(r3iu1apen ieias  2tmxrpno1teeo f3iadlm ulnvpnt0 eerxr3iodlaDranvs;( s2toio3no1al   fctl( aDtrxmp;u4tpenmfetatls2rm(vs;t) lxrif3oa1fa elues;t) rxmio3oo1op  mnetltf rrru oot0aptniietad mDumn o t4 ltrio3oydlpDeai s t0 exmxo3nu1om  mnvs ( srurx o;o4oeenmf3iadfa2rmnvs ()tlxrio3iodfaD aues;(0t2tmxmpnydom nmfvsls) 2taxmpnu1aptnmf3iltfa2eluvs;t)alenxocoadfpDeauvo;s)teumiopiy1op nlicilt) Drm(mo;o0aee io3ilt aDrm( p;(4 rtrmo tydfpte nes;() rumxo oy4lltn net ()s2trxmpou4olen ieildlm2eauvp (4aexnif ia1opte nvols  rurxopny1apenmies t) Drrump;u4olxnmfciytlm ea(vp t0 etnmr oo1opt  uvo;s)sexoio nu4omtemieiasf rtm( oou0oetn ieiyslm2rl( o;t4tlermf3iotlaDrlu o;s0 rxo(m oo4om  liciatf 2urumo;u1ale  octlslmDran s (4aleoir3tydfat lieo;s)sexmim3iudolee nvs sfs2tm(m oo4tpen o3ilt a ran pnt) ltoirciotlmtrau s;t tetmxm3oodomtn nvt sf 2rax  ;t1aptomieiyd m umnvont0trtniociodlaDr i s s) exr(rpiy4olt lnvilsfsrraxm nu4oeeoifeiatfs2umumo (0 lerxo3totlptrau s s)teumim3iy4oleelfet t sDua(rp;o0aptn ietytlmDuanvpnt4aexoio3oadfa   ivols  rxo(m iydll nlnesas a2rm(rpot0tpx  ieiydla raump u4aetrif ia1lpD  ivi s0texmxm3oy4am e icslsfs2tmu  ou4aee ifctld s2ea(vonu0tlxnmo oa1oa r nvolt0s2uo(opio1apen ivilt a2urxmont0tleoifeiltls rln pnu)treniocoa1fp eauvil(0 etr(r3io4al   fvsa(fsDtm(rpou1tpxo ictydlsDranmont0 renxr ta1lmt aivils)seumir3oudaltelnvil() 2urumont4olt  feiatlm2eanvsnu0alxoir3tydlmtrauvs;() eur(r nudopen nes ()a2rm(rpnu1tpe mf3ildls eanvonu4trerifctotfmDeluei;t)t2xoxmpnu1ol  mictlsfsDur(rpoo4aee if3ildls rauvpnu0artnmo oodfmt an s;s trxm(r3oodoltn nesl()aDra(monu1teeomi3tadfsDraumo u4 rxnif3ta1omtrluvi (0setr(r iydll  mnvtl( srtm(  ou1apxo i3iysfs2rluvs u0aexrmr3oa1opDe neslt0srurim3nydlmt  feias  rtru o;o0tlxo oeiadfmDea( onu) ltoircio1opD aieo s0t2urim iy4oltemicsat) 2taurpno1texn fetydlaDrau o (0aexniociodlmtraivi s0t2trio3nodlm n ivsas)sDtr(mpno1oet if3iyd s2uluvpn()artrxo ootfaDe i o;t0s2toxmpnodopenlfet tfarraur ot1oeen fctyt mDrmu o;u) rerxociodfp rauei s truo(r iu4amt  ici s  rua(monu4tlt ii3ildls2uan p u4 eerir tatfpte uvsls  eumiopnudal e ieta()arraumo;t1aexoio3tasfa el( s;t0 rerir iotfat lneo s0sexrxrpou4lptelfvsat srtmxmo;t0opxoiictatlm2rl(vp u)tetrifctotfaDrli ils)t2xmxr iy1ol nlivt s)aDrmu  nu0ope iictldfsDea(mp;t4tltomf oy1oate ivo t0s2xrio3oudalenlfvil( srumx  no0tlx mietltlm uluvo;(4 renmr totlm rau o (0texo(m iodoleemfciat  Duru onu0oexoiiciydfa2ra(vpn(0tleoxr3tadlm  auei (0s2um(opoydolt lfes (f 2trumpoo0ape  f3iatlmDrl( s u4altrmrcoy1fm   ieo;( teuoim nydopt  nvtas)a2rrxmoou0tptn f3ild s rl(mpnu0 rxrifcoo1lm  auesl(0s2toio io4ap  miviltf ruax o;o0oeenio3tld s eaums;t)arenmo oatomtraivi t)s2trir oo1ol elfeils aDtaxmonu0olxnifetld sDemnvont4alxnmo3iytop rai ols) exoxr nudlm elfesatfa2trurono0optnmf3iat a2eanmpnt4 rxrxfcoodlmt  uvs ()tetmio nu4optemnesl( srumxmpoo0aeen ictlt m2ranvp u0aeeoifctodfpD  ueo (0teumirpiydamte iesl(  rur(monu4altn octysfmDumuvont0texnmrcto1fpDeaieo s0 exmir iodal e fesl(f 2umxr ot1ape if3iyt a2eanvo;(0aeenio oadomD anvslt0 2umim iu4amt  fctl() rta( p;t1tlenmfciydlmDumu pnt)altoir oatoat lueo;(0 etm(o oo1lptnlivs ( artr(mpou0olx ioeiadla ul(ms;t4treoir iydla ean s;s)trum(r3iu1om  mfeil(fsDurump;t0tetomi3iydfa2em(mp ()arxrircootfp   i o s  etmim3oo4omenmivt sf 2ur(r nt4oltoiicild mDumnvont0aeenxo3oa1omteai o (0 exrxopiy4ome mnci tfa2tm(m ou0tetoiieilt s rmnmo;t0 exnmrctatoatr i ils0 euoiopiy1lltemfvtltf Dtr(r nu4aleoiiciyd a2rauvp;t4tlerxf3to1lat  ueolt0sexoxmpoydaptelfvt tfarumu p;u1apx moeilt a ean s;u)texoxo3oodlpDeanvslt0 rxr(rpoudol n fvilt srrm(ro;o1tlt mi3iyd mDrauvsnu0treomf3tatlmDeaivsls0trtoxm io1ape  fei s  Dtm(mp;t4apxn f3tasfsDemnvsnt0 leoxfcoy1fpDeau sls seurxr3iodlme  iei t)arraxmpoo4tptn oetlt a2elump () lermo iotfaDelies t0s2urimpou4lm   ieiat artr(r ;u1oltoif3tydfm2elnmp;u4 exomr oydfmtr u ils)t2xrir iodol nlnvi ()artaurpoo4tptnioeiytfs2ua(vp t4tetoxociytfat  n i;s) etoirpiu4llt lncia( srtmu pno4aetnio3tls s2ulnvpnu) reomr3totlpD lnes s)texmxm ou1lptnlfeil(fartm(m ;t4ole mieiysfa2uan ont0 leoxo iytoaDelueo ()tetoio3iu1aptn fvsls  Draur no0aexnmiciysfsDulu p;u4aexrio3iytlmDeaueils0trumiopnydamte fci ()s2uaur ;u4tlto f3tas sDelnms;t4tetnxf3tadomDeaiei t0trxrxo3ny1ol   nvtls aDrr( ono4aetn oetldlsDem(mo;t)treoxf iodlmD  uvs t seurxm3ou1al elfcsls)a2rmu  no4tltn ociltls uau p;(0 etoxr ia1opteanvo s) eumio3iy4alee ieta( srraxm ;o4aptn fctatlm2eln snu0arermr io1lmt au i s0texo(r iydlpt lnetlt)aDrmumo;t4aee mo3iad m2ran s u)treriocoa1omteaivs;(  rxmxopiydllt  ivi s  2umxmonu1opeo o3iad aDel( s u)aeenmocoodfmDelu i;t0sexmxopoo4al nmivs t  2tmum ou1tlen ieildlaDumuvo t4tltnmf3iodfpD  uvs s)trtoxr oudome  ictlt) Dururpou0tlxnifetasls rmnmp;t4aetnmfcia1op rluvo t)s2uoxr3iodamtnmiesat)srurx poo4ope  ietytls2ea( onu0aeenxf3oytoateluvs () 2tr(m3oo1lpe livsat srua(rono4olx  oetyd a2em(vsn()aeermo todoaDr ivo;s) eur(mpio4am   nei t  2urump;u0aexo f3tydfaDran p;t4 lxoxo to1latr uvo s teuoimpny4ome  ivias  Dtm( pnu1oee ifeiytlsDuaumon()aexnirciydoa e n s (0 rtrxrpno1omtnmnvsas) ruaxmpou0aeenifeiat a rmuvpn()aeenircta1omtr i o t0t2um(m ou4ll n fctl(faDtmxrpnu0oltn o3tlslm2rluvo t4trtnmo tatlaDr neol(  eumxopiydolt livtl( s2uru  ;o0openmf3ildlm rm( s u0alerifcoadlaD lueolt texmimpiu4amenlnei s)aDtmxmooo1optn fcilsfmDul(mp;(4arxnmo to1fpDe nvo;( s2xmimpoudlpt mfviltf rurxrooo0alxomi3iadls2rm(msnt4trxoxrctotfmt lu o t0 rtmxopoy1lpe  icsl()srumumono0alto ictad a elnmp u4arxomr3iydop e nes;s setmxo iydomtn fct ()s2rmurp;t4ole iiciasfaDuau p t)trxomo3oatfaDr uei (0 2tmxr3ny4ap   fvilsfartm(r ;u0oexoiiciltfmDranvo u) rtoxo tadlptrlu sl()trxoio3no1amen ncsltfaDumx ooo4oetomieiasls2rm(vs;t)arxnircoydlpDrai i;s trxo(o3oy1lmtnmici t srtauro;o0apxo ieiys aDrlu snu)arenmoctydfaD  nvsls t2xm(o3nu1altnmfetltfa2rmu p;t1tpt ifetytlmDeanvont0trtoio3oatlmDeliei t)sexmiopnudal n feslsfsruaxmo;u4alto ociatlm rm( s u0arxrif3iadfpDrlnes s tetoxr3iudllenlfvt s srrmu oou4opxo fctlt mDrm(mo;t4aexoifciatfm  an s;(0srxmxm3oo1op nlfesa() rrr(  ;u1olxnmocildfs ulnvs (0tlxrio3ootlm r ues s t2um(opoy1olte ictls)aDra(moou1olt  ocildfa2rln onu0 rtrxfcty1lmt liei;s)sexm(r3iydalenlnvs t srrrumoot0tex mi3iatfs2rm( p u) rxrmrcoo1oatr uvs;(0s2trir3iodlm  mietl(fa2rax p;o1ope  o3tyt m2ulnmsn(0alenmrcoodfpD  i i t0s2toxopiudomtemictls aDrr(mpou1tlxn ieiyslm rln s;u4 lerxf oydfm rai olt)s2uoxm3oodal  mneilsfartrxrp;o0tltoifciadfaDeau pnt)tlxoio iadfmDr uvils srumxopio4llt  fei ( a2um(rooo0aet ioeiat a emump;(4aetoif3iadomDeanvsls0sexrio iu4amenmfesls a2urx  ou0tetn fciys m2rmuvo (4 ltoif oydfp ean il() 2uo(m3oudlmtelfct t)artrx  oo1alxnmfctltls rlnmp;u4tlxoifctytopDelnvi;(0sexmiopnu1aptn ies sfaruau pot1aleo i3tasfs2elu s;t4texoxf iodopD lneols0 2to(m no1ol elieil()aDuaum no4altn i3ildfa uanvs u0tetrxfciodomteanvsl(0setrxm iodlmenmfcia()a2raur ;o0oet mfetlt a2um(ms t4aetnmoctytfmDrluvo t0srurirpny4lpeelfesas a2rm(mpno0tpxn fetaslsDem( ont0tetoxocoydfm  lueo (  2xr(r3iy4oltnlivt t)s2tru o;u1ole mociadfmDemnmsnu4aeeoxf3ootopt aivo t)srumiopoudapen ivsas) 2rmx onu1alen feiad mDulnmp ()artrmociadoat an o;(  eum(rpou1optn ieias)a2rr(mooo1tlenifciys sDranvs;(4 eeoir3iatfa  ln i s0seuoxopno1lm nlicsls sDrm(mp;t4tltoiiciys a2rlnvo;u)aexoxr3totfmD lueol(  etoxo ny4lm elfcsat sDtm(rooo1tpx ifctldla emnvo (4areoif iadfm   ivsls) 2ur(o3nu1omenmnct t  rrmxrp;t0aexo o3iatfm2rlumon(4 rtrifctytopteaivslt texrxr3nudolee ietltfaDtrxr nt4tlt  ociltlm2rau s;(0aleoifciy1oatelneil(  exriopio1lle mfvtat  Drm(m ot0aexn ociysls2eanvon(0trerxf3io1omtraueilt0tetrio nu4lmenlfcs t aDurxrp;u0tltnmfctldfaDeauvpn() ltrmr iydlaDrauvo;s seuoxr3iudalte ivi t aDtm( ono1aetnmoctydls2ra(vsnu)teeomf tatlpt auei;s)seumiopnudlmeelfcsl()a2rmxm nu1tpeoioeiyt s rln ont0trerifctatlatraieils)setrio oy4lp  miet s)aDrmu o;t4aetnmfciytfs rm( o;t) lxnmrcto1fptrau o t  rtmxr oo1alenmfvsas srrr(mpnu4oltoiictytla umnvs (0 lenir3tadlp r u o t t2uoxr iy1aptemict sfaDtr( poo1aeen fcild m rmu o;()altrmr ty1fa   ieols)t2ur(opiu1ap e fet t a2tr(rono1olx  fcild mDua(vs;u0 ltomf to1lmDeaieslt  eurio3nydlpte ncslsfsrtmxrpno4oetomiciydlsDumn pnu) ltoxf oodlpteaivi s0 2trxm3ou1alt lfcsls)s2raur ;u1oex  feiytfm2um(vp u4teeoxo3oodom rlu s s)s2urxo3ou1lm nmneia( a2uru  ;o4tlxoiieiysls2ranms u0tlxomfctodlmDrlieols0t2trim3iodlmtnlivs tfsDrr(mono1tpxnmictad s ea(ms t4tlxnmf iatlm e nesl( s2uoir3ny4lltemfcs sfa2rrxrpot4tet iieiytfmDrm(mp t)tetnmr3ta1fpD luei;t truoxr iu1amenmivia(f 2ua(r oo0aptoio3ilt a2uauvonu4alxrmo3ootoatrluvil( t2tm(o nydll  miei t  Dtm(  ot0aptomfeiydfm emnvpn()aexrxo ty1faDe uei;(0trumir oodomte fcils s2umxm nt4opx  ictlsfmDem(vp t)aetomr3oa1oate nvs;s  rur(r3io1oltnmnciasf Durxmp;o4aptnmf3ild m ra(mpnt0 lxoxf3oodoaDr i o (  eum(r3io4al elfeta(faDrm(mpnt1tlenif3ild s ra( p;()tetnmfciatfmDe uvi;s trtr(m3nu1ol nmfetas)aDurxmo;t0teeomoctytfa2rl(mo ()alenxo oydop  au i t)t2umio oy1ap e fct t srraumoot4tpx mictyt aDrmuvp;(4 exomr3iodomD  nei t)srumxrpnudll emfcslt)srrr(  ;u1oeto fctatlm rmnmont0 eermo3tydlaDrlueils  2to(r3ny1opt lncsl(f 2trxrpot0openifeiad a2rl(vo;u0alxrir3ty1omte ieol(0 2tmxrpiudlm e nvt ( arta(mont4tlxo oeiytfm rmnvp (0arermo3io1lmDean o s)truo(o3iydal elnvsas) Dtrxrpot4tee mf3iad sDrlnms u0treoxr3oytopt  nes;t0 rxrxm3oydolenmnvia( srumuront1aptomfetldlsDrl( s u4aexoif oatoat anvi t0 2toimpio4apt lncsat)a2umx  no4tpt mi3iad sDemu o u0arenmr oa1lp raivi s0t2tmimpno1omenmnciat s2uax  ;o4tlxomfeilt sDrlnmp t0texomr3ia1lmDrlnvi s0setmxopiodame  fci (farurx  ;t0tlxn i3ils a2rlumo t)trtrxrciatlptr ueols)t2tm(o3oo4oltn nvsl( aDur(  nt4tleoiociyd m2ul(vs u4arxrio3iatop  lies t s2tmir3iydolenmnvi t srtrxr ou4apenmfciyslaDemnvs;u)altomr3oatlm rauei s s2xmim3ny4omtnlfvsls) 2tr(m ;o4olxniictlsla rm(vs t) reomo ty1oaDrlieolt0 2trirpno1alte ietl(fsDtrumono0aleomo3tltls2em(mo;t) lxnmrctydfp  aieols  rxoiopiodap elnvils) rra(  nu4tee micias s2rmuvs (0 leomr iotomDeli s;t0 2uo(rpoydap emnetat sDtmu pot4aeen feilt s el(mp;(4artrif iydlptr n slt0 2urxm nu1lptemicta(fsDtrumo;t1aex  f3tyt a2emnvpnt0 ltnif3ia1lpt lu sl(  rtrio3nu4lle licta()s2tmx pou0tpe  oetytla2uanvs;t0 rerioctatop r uvi;t  2toir3oy1alee ivsatfs2rr(moot1apxn f3tld m ea( s (0aetnmo3oytomte uei;()s2trir3ou1ap  lnct s  Draur oo4tex  ociydfa2eauvon(0tlxrir3tydlateai i;t  2um(r3nodopenlfesas) 2ururpno0alt mfeiatfaDumu p t4 renio3ootlpDraieilt0sexmimpoy4altnlivtl(farumuront4ale  o3iltfsDuau o;u4altrxf3oatlat  ivs;s  etmxopiy1ol nmneils  2taur ;u1tlen fctlsfm2umumsn()tltrxoctadlm  li slt)trumxo3oo1omtelfviat)arur(mp;u1optn o3ild sDuluvo;(4areoxf3ta1fp eln i;t)srxrio3io1op  lncils  2rm( p;o4apt  oeiydfs rlnmo;()arxnxr3ty1lmtelivo;t0 etmxr nodal elivta(fsruau pnt4apeniiciadlm2eanmon(0aeeomo3oydlp e u s s sexrir3nu4op emici s)sruax  no4apeoioeiat a2rlu o (4 leomrctatlaDeln o;()srur(o3oodll n ici sf Drr(  nu1opt iieiydfm2um( o ()texrif3ootlaD livi;s0truoxm3iy4altn fctlt aDraurpno0aee  iciatla2umn s;()trxrmf3oytlaD lu o;t)s2xr(r3no1om e netatfsrrru pou4openifciydfs ua(mo (0arenxo oy1lm  lu s (0seumxr3ny1oltnmict s arraxmpou0aexoiieilt m2elump u4 ltoif3tydfate neol(0 2tr(r ny1al elfci ( srtrxmo;u1aleomoetas s2ua( pn()aeeomf3oatoaDeauesl( trxo(m3nu1am elfvta(  rta( p;u4olt  octydla eanvont0aeenxrcio1oateauvi (  eto(o nodamt  fvilt s2rau  ;t4tlt  fcildls eau p;t0tlermr3oy1lpD li i s0teumim3oo1llt mncta() 2taur ou0texnmoetatlaDrl(mpnt4 rxrmfctotoa  livols t2um(o3nu1al nlnesa(fs2raxro;t4opx mf3tas a2eanmsn(4 etrxrctodopDr uvi;s0s2ur(r3nu1lmtnliei ( arrm(roou0tetomietlt a2ea( p ()aleoxr iadlptrauvo s)t2trxo ou1ome  nei t arum(m ;u4aptoiiciysfsDemu p;u0artrxrctodfp   n i s trtmxr3iodapee ies tfs2umumoot4apx if3iytlm2ra( s ()trxnio oytfatrlieo;s sexrxopoodamt  nvslsf rtrxmpno4tle ioeiasla2rlnvs (4altrxr iydomtraivo;(  2tmir no4lltnlivsl( sDraumpot4aex  feiysfm2emn s t4 exnmo3iadfmDran ilt0seurxm iy1omeelivt tfarraxmpou0aexnifciatla rmu o;t4aetoifcoytlp rau slt) 2xmirpno1ap   neta() rrauro;o1tlt  ictad a el(vo;t0teeoiociy1fmDr ueslt0s2xoxm3nu4altelfvsat  2tmur ot4alxoiieiltfsDeluvo;u0tetomo to1fmtr neo;s  rxrirpiy1altn ics tfs2umx p;o0opxo ietasfaDum(mo () ltoif3ootomtrai o;t0t2xmxm iudolt lncils  2rr(mp;t0tex  o3ils m2eln p u0tlerxf3to1oatean ols)s2tm(o3io4lm nlneta( srumxm ;t1aee io3iltlmDumump u0artrir3to1lat au s;s0t2xmxm3ny1ap elnvtl() Drr(m ou1tpxnmfcildlm rlu o;()aetomocto1la eluvsl(0 exoimpiu1altnmfeta()a2tmxmo;o4ope ioeilt mDua(vs;u4texnxo ia1fpte ivi (0 exoim3iudomeelnvtlt)s2ra(mpnu1ole  oetyd m emn o (0trtoxoctadfatr nei;( trxoxr ny4ll nlnvtl(faDum(m no0oexomieiydls emu p t0tetoir3iy1om raueo;t  rxoxmpnydomenmics t)srtm(m no1tetn iciad a2rmnms;t0alerif3tatoptrai il( t2urim nydaptn nvs tfsrrr(mo;t1alxnif3ild m2rmnmp u0 rtnmf oatfa  au s t) rto(o ou1op elfcsa(f 2rrump;t0oltoif3tadfa2ranvp (0tetoifcoodfmtran s t) 2to(r iu4om n nes ( srum(rpoo1ole  oeiltfsDum(vpnt)trxnmr3iotfmDranei s)srumxo oydlmtelncs s)arraxro;u0tee miciys a2ul( p u4 eeoxr oytlmt  ivslt0 rtmxopou4optnmicsl()arrr(mp;u4oexoifetytlmDulu snu0trtnxociytfat aneo;( srxmim3oodll e nvias a2trurp;u4apx ioctyt aDemn o;u0trxnmf3oydomt aneo;() euoxo3nodopte fcta(fs2uru  ;o4openmfeiadlsDem( s;u0altnxfctotom   i ol()srur(r iydoltn fcias  2ur( ooo0alxo feiyslm2ua(msnu4 lenmr3tadfa rliei;s t2uoir oo4om e ieils  2tau oou0oltnmf3tldfs2rl(mo;t) rxoirctodfpD  uei;s0s2urxm nu4am elncsasfsrtrur ;t1openmf3ias a2rmnvont4teermf tadlateln s;t)teum(o nu1ol  liciasf rrr(ro;u0olxnmoeiysfsDemnmp;u0artrir3io1lmt  iei;s)t2urio iu1apenmieia(farumump;t4aeto iciydfm2emn p t)altoir io1lm r ivilt0 2trim oo4open iei t  2um(ronu0teeoioetas aDem(vp ()altrmo iatfpDrai o t0 etm(o3nu1am  lfeia(f 2umxr no0oexn o3tyt s rluvpnt0tlxoif3io1latr ivslt) etrxm3oy1lmtemnvta(  rumump;t4texnii3iad sDrm(ms t4teermfcta1omteli ils) exm(o nu4al  mfetlt)arum( oot0teto ieilt sDelnvp;u0areomr iy1la eli i;s0s2trxmpno4optnmncslt) ruauroou4aeeomi3iyslm uln s;(0 reoxo ta1latrlieolt) rxm(o3oo4lme  nes t)srtax pnu1olxoifciysfaDem( s u4trerif tydfatraies;s s2toiopoodom emfvi sfarua(roou1oexomoetldfs2eanmsn(4 etrif iotlpteauei;t)s2trxr3ny1ameemivs s)s2rmum ou0aee ioetas sDua(mo;u) rxoxrciotfpD  n ols0srxmxo oodlleelnvi (faDrmu  no0tleomieiydfs em( o t4trxnio tytlp  auvilt)trxr(r oodopte fet sfs2rm(r ;u1alxo ieiat mDean p;(0 rtomo3io1fpte ivi;()trtoxm3iodom   feil(f 2umumpnu0oetnifeiydfm2ea(ms;t0trtnmo iytfmD luvils srxm(rpou4lp  lfvs (f rtrxm no1alt moctytfaDuanvo u4 lxrxo iy1omtr iesl() rto(rpnu4lpte fvtl() Dum(mpnu1apxo octadfa2rm(vo;u0aeeomo3tytfm rliei s0 etrim3oy1ome  ietls srrmxrp;t0tet  ocildlsDrlnvsnu4tlermo3oytlmte ivol(0s2xmxo3iy1apenmiviltfs2ur(mpno1opeomicias sDra( snu0tltomr3oy1lp eanvils0setmxr ou1omtn fvtl( s2tmxmo;u4tetnioctls s umump t4arenxf3tatlate i s;s s2umiopio4opt lnvsat srumxr nt4altoii3iyd s2umu o;() exrmfcoatlat  uvi s)setmxo3oodlltnlfci tfsDuaxmoou4aeen o3iysla rl( sn(4 ltrmo iydop r uvilt teuoxrpio4oltemncs t aDtmxm oo0apenioctltla rmuvo t)arxoir3oodfmte ues s)trxrim3iu1ole lfesls)srtmxm ;o0tlxn fcildls2rlnmo;(0 lxoifcoo1la  luvols tetrxrpny1llee fei tf rtax o;o4opxnio3iatfs2ranvsnt4 lxoioctatlm r i i s0 etmirpoydamte netatf rrr(m oo0teeoiiciydla2rm(ms (0 lerio3ia1lmteliei s) rur(opnydam n nvilsfsrrrxroou0alxoifeiytfs2uanvo (0 eeomrcio1lat lneo s  eto(r3iy1ame  fviltfsruaxmo;t4tetnioeiat mDrmnms;u) etnxr3iotop   nvilt0srur(o3oodoleemfcs ()artrxmoot1ope ioeilt mDemu p;(4 rxnifciydfaD  uvi;()setm(opnydlltnlfvs t s2rau pot0tleoifctydfaDrlums;t)tetoxrciotfaDrai ils)srtrim3io1lmtemnvslt  2rru o;t4apto iciatlmDrauvp u)altnmf oy1fm r ueolt texrxr3nydom nmnvtl()s2uauront1alx mociltlaDran s;(4 eenmo iotfm  luvs s t2xoiopny4optemnvt ( s2rm(ro;t0olt mf3iytfa2rmuvo;u4 etnmrcty1oa elnvo;(0texmxm3oy1op nmneil( srumx  no0texnmietadls rlnmp t4trxrmf3totom ran s;t)sruoxrpiu1am   fet ()s2uaxm ;u4aetn ieiyt a2ulnmsn(4teeoir3ty1fmteanvo (  rumir nodole lies t)s2ua(rpnu4aet mieiltls2elnvo t) etnxf totomteaivi ()s2uoxo3oo4lpte fct t)arumxm no4opeo ocild a elump;u4treoxr ta1fmt  nvolt srxoir iy4olt  ncsat)a2taxm oo4apxo feiydfm raumo t) rerirciadfpDrli i;s setrxo ny1aleelictlsfaDtrxmpnu1oexo ieiasfaDean pnt)tltnxfcoy1lpD ln o ()t2uoim3ny1al emicsl()aDrm(mont1tex ii3ilt s umnvo u4 etomo tytlm e neo (  rtr(o iy1lltnmivtlsfa2ra( ono1tpx moetldfa2ua(vp;t0tetoir3totlptelnvils sexm(o3ny4am emiesls s2umu ooo4ale  i3ilt m uauvp;()arxnmr oadomtr ueol( trxrio iodoptn fci s) 2rr(  no0tpt moetltfm2ean o;t0trxomo ia1fa   u i;s0s2tr(o oudop e ncs s arrmxmpoo0tleo feiltlmDuau p;t4aeermfciytfaDeau s;s texmim ou1lmtnmfes sfaDrr(m ;u0ole  octldla2eln pnt4tlxrmo ootoptelu i;t  etoxopny4lmeelneslsfs2raxronu1oetnmo3iytls2rluvpnu0 rtrxfcto1fpt ln ol(0seurxo ny1apenmnetat arua(rpou4aexomfeiys s2uanvs;()trxoxfciydomtr i i;s  exoiopiy4lme lfetls  rrrxm nt4optn feiad m ulump ()trtnxo3iydlmt lueols  euoim3ou1ap emnvs s) rtmx  nt1apt  ietysla rlump ()aeerio tatlmtrauei;s) 2tmxm no4amt  iesls) 2taxro;o1tlenmoeild m2elnms;t4 rxoio3oadoa raneils0sexrio iu4optnmnctlsfsDraxm no0oleomieiltfaDuanmp t0aeermf oatomtelueols0 rurxm no4al  micias a2urxr ;u1openmociaslm rauvpn(4arenif3to1oa rai s (0trxmxo3iu1alte fcils) Dtmu  no4ole  fciyd s2rmumsn(4 rerxr3tatfpteluvo ()s2trxmpiu4ome mncs sf 2uau  ;o4alxnmietytfmDum(vs t4 leoif oy1fa  aneil(0 2urxr3io1lpenmnci s) Dua(r nu1tlx iictydla em( s;u)artnxfcoo1oa rau ils)texmxm iydom  mivt (farrru  ;t0tpeniietyd a em(mp u0tlenxfcoy1fa rauvs t0 2to(mpiydlp e fvil( aDum(m ;t4tpto i3iadlm rm(vsn()alxoxrcoa1lmDr i sls0teur(opio1omt  net ( arrrxrp;t1tlx mfctlsla2ra( pnu)aexnir to1fm r ues (  eurim iu1apt mfeias)sDta(r nt0teeoiictls m2umump t)aexomr iytlp r nvols0t2uoxm no4am   fcsat) Dumxmp;o0apxn ociltfs2rmu s ()trxomf3ia1lat aueo;t) etrio3nu1ol e ietas)srtau o;t1tptomfeild m ua( sn(4aeerxf iy1fat ai i;s)srxmimpnodamte ivt t aDtm(r ou1oeenioctydfaDumn p (0aetoxociadfatelueolt s2trxm3iy4al  lneil(fa2rrxroou0alenmfetyd s ua( on(4 exoxo iy1oaDrlu s;t0 euo(r iydlpe  fcilt) rumu oot4alt  o3ildls elnmo;u4treoxf oadfa eaueo (0srurio3ny1lm elict (  rua(rp;o0tle  iciltfaDumumo u4aeeomr3iy1fptrln s;()s2umio3oy4altn nesls a2rmxmooo0tpe  o3ilslsDea( o (4texrmo3tydlat  i s;()srxrimpoo1ame mfet s)srtm(moot0tptniieiys s2ran o;()artoxo todfmt au ol(0 2tmxr io1oltemicsas)aDum( o;o0tle ifctadfa2ranmo;t0tetrmo3io1fmDrluvo (0trxoir3no4ope lneiat srua(m nu4oee  f3ild a2emuvo;u0 lxomo3oo1la eli il(0 rtrirpnudlpeemncias)s2ta(rono4oexomfeiadlm uauvsnu0tetoir3oodlmDrlues;t texmxrpnu1llt  iei tfs2ta(mpot1tpxn fciatla um(vs;()trtoir iydfmDe nvs s teur(rpnudaleelnvi s aDuaxmo;o0teenmoctyslsDrlnvp;t4tltrmo ootlatelnvi;()t2tm(rpoydlmtemnvil()a2umu oou4opxoiietadfaDeanmp;(0areoir3ia1oa  anvs;( trxrxm io1lpt  nvsltfsDtrx ono0texo ieildfa rmu o;t0 ltrmr3oy1lpD auvol(0srtoiopnydlmeemicia() rrm(  nu4altn fcild a2emnvpnt0tleomr3oydfp rlivs ()s2xo(r no4altnmncsa(f Duaur oo1oetniietysfa ul(mp u4tlxrxf3tatfm   i o;t)trxo(o oydopenmieils aruau p;t0oetomfcilt s uaumpn(4arenmo ta1oatelnvo t texo(m3iodlmee fcs t) Drax pou1tetnif3tls m2ulu s;(4tlxnir ty1lat lnes () etoim ny1lpe mies ()aDrr(rp;o0tpenii3iltlaDel(mpnt0trtrir3oadfpt lu s ( s2trxm iodam n fct () 2uau oou1tetnmf3iydfa elnvo (4teeoxocootlmt  uvo;t0s2xoir3oudame mfvs tf Dtmum ;t0apt  feilsfa2uau pnt) rxnmr totoateaivil( seurim3ny4opt  ncslt sDra(m no1alxn o3iatlm2emumpnt4alerir iy1lm eauvo t  2ur(o io1lpeemictl() rtmur no4teenio3ildfsDrlnvp;(4aeerif ta1lp r ies;(0seumxo3oo1om nmieiat) Dra(m ;t4apt ifeiyt s2rmnmo u) etrif iydfatrlnvo;(0setrirpou1apeelfvtls  2tmu pot0tlxomieiat a ra(vs;u0alxrxr3totlm   uvil( srur(r nu4lmenlici t) 2urxr nt0altnmfctlsfa elnvo;u0artniocoy1fatrluvi s0 eurxopoy1oltnlfesas) ruau  ;u4oetomf3iysfa rau sn(0artomfcoadopDrlneo t)tetm(m iu1apen ics tf 2tr( ono4tleomfeias m ra(mont0altnxrcoy1oatelueo t sexoim oo1om nlfcsatfsDumxr ;t4tee  ieiadlm2ul(vo;(4tetrif3oadfmt lieo (0 rurxopoo4ape mnei (f Drau ooo1aleoifciaslsDuau p t4teeomr ta1fptrai s;s trumim iudlm nmfesl(fartmxmont1aetn fetadls2um(mon(0 rxrmrcoatlpDeli il(0trto(r oo1lp  livs t)aDrmu  nu4texniociadfaDrmn p;t0tlxnxf3oy1oaD lies;t0t2toir3nudol nlivtl(faDtaxr ;u1tlenii3iltls2ranmp t0aexomfcto1opDe ivslt t2uoxo3oo1lmeemfvsltf 2tru  ot1optn oeiatlm2rl(vp ()tetnmfctotfmtrai o;()s2xo(o3iy4am nlicil(  Drmx p;u1texn o3tltfs rlums;(0treoircto1laDeluvol(0seto(mpoo1lp e feia()aDtm( o;u4oetn ociat aDea( p;(0 etrxf3iatfpDranesls0trxrio3oudll  lies tfsDurxmoou0tleomfetatfs2rmu pnt)aleoxf oodfa rau i;()t2tr(m ou1optelictlt  Drm(ronu0texomf3iltfa ua(mo u)alenxo ootfpDran o;t0 rtoxm3nu1ol   icia(fs2tr( oot4opxnifctldla2uluvpn(0alxrif3iydfp   uvi s0 etoim3no4al emnesa(fsDua( p;o0oeen fctas a el( p (4tetrxoctatlmDraieilt)s2xoirpnu4lmenmnetasfartauro;t4tpenii3iadla2ra( onu) eeoif tydfmtr u il( teumxopoy4lpt lfetat srrmurpnu4teen f3iat mDulnmo;t)trxoif3tadlate uesls0t2xmim ny1om nlnvias)s2rmu poo0ale  fetltfs2em( p t0aeenif3ta1fmtelnvs ()sexoiopny4al emnei s)a2tr(monu4tetnmf3iatls2ul(vsn(0 rxnxo3totlat ln i;t trtrxo3ny4alte nes ( a2rr(ronu1apxoifciltfa el(msnt)artoio oatlmDe n o ()texoim oydaltemfeta() Dur( ont1apxoiociyt a2el( pnt0tlerif oo1faD  iei ()texr(m ny1ol n fvsat) rumx onu1oetn oeiytlm ua(vs;u4trxrxrcoy1fmDr i i;s)trum(mpiydape mfciat a2ua( ooo4ope  icildlsDul(vont0tleomo io1omtraivs;t0t2xm(m io4oltelfct ( srum( p;o4oetnifctlslmDuanmo u4 leomfciy1oat an o t) euoxm3io1optnlfetl( s2ur(r ot0oeto f3iysfa uaumo u4tetrxr to1fm rlnvslt trur(opnodlltemnvt (  Dtrumont4aetnmfetlt sDuanvs u0 etomocto1fmDeauvs;t)srxo(rpny1am e nci t)srtr(rpou1aeenmieild a2ea( snu4alxrxo iytom  aneslt s2toimpny4ol elieilt) rumu p;t1aee  oeils a rlnmsn()altnifcoy1lpDe uvs t0 rtoir3oudll emfcsa(faDumx  oo1tlt mfcilsfs elump;t) exoio3to1om eauvols0s2uoxm3iy1ame  fvta(faDrr(ro;o1tlxoifcildfmDemnmon() leomr ta1fa  aiei;s trumim ny4olt  fct sfsrtax ooo1tltoio3tatlm emumpn(4aeenxfcoy1omDrluvi t) 2xmirpoudlmtnlivsltf 2ur(rooo0alenifeiat sDulnmp (0alermf3io1oa  aneo;t)t2trxr3ny1llen ncilsfsDrax p;t0oet  octlsls2umums;(0treomf3iotlaDrluei s)t2uo(r3iudaptn nvsltfaDraxr ot4oeto fctasfs2em(vs t4trxomo3oo1fmDe u s s  rtm(r3iodlp  liviat  Dua(  nu0tlt mfetltfm2ulump (4alxoxr3todopt  nes ()t2xr(o nydolte fvsa(fs2ra( pot1tpxnifcild a2em( p (0 lenmr iadla elivslt trtoxr oy4altelivs s)sruru o;o4olx  ieiaslsDrl(mont4aeeoir iotoa  lues (0srxriopnu4lme  ict (faDrrurpoo1tlx  ictld mDemumpnu)arxrxr3iodla   nes t)srur(mpny1om  lfvtas) rumxmont1oetn ociydfm2eauvonu0aetoiocoodfp r nvo t)truoir3nu1ol nmfetl(f 2ur(rp;t4tlxn oetytfmDrm(vsn(0tltnxo3oadoa r nvo s0trumir iydape miesat a2taur nu4ape  fcils aDrmn o ()aetnxocty1opte ieol()srumim nu1om  lieslt) rum( onu0tee  fciasfaDumumpnu4altrmo oo1faD lues t) rtoio io1amtnlfvt sf 2ta(ro;u4opx  feiat m2rmu s;t4arxoxfciodlm eluei;t t2xrxo oo4omen ivia( aDrmu  nt4aee if3iyt s2em(mo;t)tlerif iytoatr n s s)seumxr oy4ome  nvi ( artaur ot1tex  oetydfaDrmnmp u4 lxnmoctotlat lueo t0 euo(rpou4ll   fvi (  Dtaxroot0openmi3ild a2rlumpnt) ltoxo to1oa  aivols0srtm(o3iu1lptnmnetasfs2rr(  oo0apeoiociasls2ua( p (0 lxoxfcoo1lpDeliesls trxm(r oydolt lfvslt)a2rrx  ;u0tlxomoeiyt m2emu p t0artnxocta1fpte n s;( s2ur(opnu1amt lnes ()s2rmur oo1apx  ociltfs elnvs;u0tetnif3tytoaDr nvi;t trum(rpoydoleelictl( a2rm(m nu4alxnmoeiatfs2el( snu0tleoir3tadoaD  nvi;( trto(opio4lme livilt)sDurur ot0oltnmoeildlmDrmnmp;(4 etoxr3tatfpteln olt sexrxo oo4apeelictlsfarrrxr ;u0oeeo fciadfm umuvonu4 exnio iodlatr ivolt trxr(r3iu1omtelfcia(fartaurpou4tleomfciydfs2uanvp t0 lerifcoatfpte nvi t0 2xoir nodom nlfetls sDua(mo;u1aetoioctatlm rl( s;u4 eeoxocio1oa eau olt)tetrxmpiy1apenmfvia( artr( p;t4tpto icias aDrl(vpnu) lenxo3iodfp   i i t0 eurirpiu1lpenlnet ( sDtax  ot1oltn fcias a2el(mpn(4aetoif oa1lmtelneo;t0texoxr3nu4omtn ncslt)s2rauroou0apxo ictlsls uluvs t0arenmr oodlp  aneolt trto(o3iodlpt  ivt t) rua(mpnu4olxomo3iad a rlnmon(0trerircio1lp rauei t s2xmxrpoydap  micsltfs2ra(rooo1aleniieild m2uauvo t4 rxrxf iadfpt ln o;()teumio3no4lm nmnvi t) rrau ont4teeoifciydlm rln o (0aeenxr3iytfmtr ivs;s0trxoxrpnodapt micslt srum(  oo1tpxoif3tasfa2em(mp;(0 ltomrciadfaDeauvsls sexrir ny4omtn fctat s2tm(rpnt4tetoii3tldfsDrl( p t0 lxoxr ta1la e n ols) 2um(rpiu1ll n ieslsfs2rr(moou4oltoiiciltlm2uan snt0trtrmrctatlp  lieol() rurxr io4lmenmiet (  Drmum nt0tex  ietld aDea(vpnu)tltniocoo1fmD anvils teuoxm ny1lmtnlieia(  2truronu4aetomo3iysls uau o t) leomfctotfmt aneolt  rum(o no1omee feilt)aruau oou0tpx mictytfmDul(vs ()texoio3totla r n s (0 2tm(mpno1op emfcia(f rumxrp;o1alxoiociytfs rm(vp (0aetrmf tydomD  ueo;(  2uoio3nodoptnlietlsfa2tm(ro;u4alxoio3iasfsDulnms ()tlenmo iy1fat auvo;t)s2trir3ny4omtn net s) 2rm(root0oeeomi3iadlaDrmuvont4teenxf oadlptraivi t0 rumir nu4lmt  iesas)a2uru oou0tpeomietydfm2elumpnt0aexrxr3ty1fa r ivslt)s2urxm nu1oltelfvi (f rua( ono1tlxn ictydlm elnvo () eerxr oydlpDrluvo;t)trtmxr oy4am  lnvtlt srur(ro;t0opxn f3tys m emuvs u0alxrxo oadfaDelnes t  2urxmpoo1ameelici s) 2tm(  oo1texomociydlaDemnmpnt) ltrir ta1lp eln s;(0texrxr iudol  lfvsat)sDrmxm ot4tpeomfetys m ua( s (4aeerxr3tadlp e nvo t) rtrxmpoo1apeelicslt arrm(  nt1ope mo3ils a ra(vs (0 lenmfcio1oaD  i s;t sexmxopno4lm  lfvi tfsrtax  no4aee mi3ilsls2ranmo;u) ltnxr3oadlaD lnei;t0 rurxo3io1opt  fetlt a2ua(rono4alt miciltfa2emu p () lxrxociodomDeau s;t teur(r ou1amt lfeils  2ta( o;t4aex  ietasfs2rm( p;t4tltoifciotomD  ies;(0sexoxr oo1op e nviatfs2rr(rpnu0ale mo3ilsfs umnmo;u)aeerxfciodoat auvo t sexoxr no1ole  nct ( srrru p;t0tlxn i3iytlm2umn snt4arxnmf totopDraieo;s0srtmxmpny4ape mieia()srur(ro;t4opt  fcilsfmDra(mo () ltoifciotfmDelnvils  euoxopiy4amt  fvsls aDtaur nt1opxoifctlslsDea( p;()texrmf3oytfm r ivo;t) etoxo3oy1lpee ici s) Durxrpoo0ape mf3iadls2ean pn(4trtnifciydlpt livo;s0 rxoim iydamee ivsa(f rraumo;u1olt mfciys aDum( snu) etomrcio1fpt li i s tetrim3no4op n feia()arrmumo;u1alxo ociys aDran o u4altoxr iydfaDe ivil(0texrir3ny1lmt  fvi (f Duaurpnt0opt  f3ilt aDrm(vo;(4teenmfcia1lp  liei;(0t2ur(m3oy4amtemivsl(f Dtmur ;t0openmociysla2eanmo;u0 rxrmr oo1fm r i i;( texrxmpiu1al e nei t)sDtmum ;o1oeenmoctyd m2rau o t4 lxnxr3tadomtrlieol()teuriopiydal nmicils  rrmumpou4tleo oeiysfs2uanmo u4 ltoifctydlpt auei;(0teuoimpoy4ap  liei tfa2rmxmo;t0oeto oeiadfmDumums u)trtrmf3iatomt lu s s  rtoxr3nydlpt mivtlt)a2taxmo;t0tlt  fciadfs ean pnt0 etomociytfmDeln o;t sruoir oo1lp emivi tfsDuaxr ;t4aptnmfeiydla uluvp t4 eermo3totoate n s;(0 eum(m iu1alenlies s  rum( p;u0altoifetas a2ulu sn() exnxo3tydfmtr u s t0setoim3nudop emnctl( aDurum no0tetoifeils s em(msnu0alxrxo3tydop  auvs;s seuoxo3ny4llt lfvtlt) Drmu ont0tpxnifciltfaDumumo;t4texomocto1fpDr nvil(0t2trir no1oltelfvtl( arrmu  ;t0tpeoiicilsfa2ranvo u4texrxfciatfmte i sl( s2uoimpio1lpeelfvt tf rtrurono4ape  o3iaslsDeanmpn(4altoir3oatoa  au s (0 etrxm3no4am  mivi t) Dtr(mooo4oet miciltla2umump;t) ltrmociytlpte ues ()s2xoxm3nodomtnmfet t artax  ot4opxomfciytls2elnmp;t)tleomo tytfpDeln s ()t2xoxo3oydlmeelnvil( s2rmuro;o0alxniiciys mDuanmp;u0alenif iodomtrlueolt  euoirpno1lp e ietas)sDrmum ot1optn fctld mDem( onu0 eerxf oo1lp rlnes s  rum(o3no4altnmneiasf 2umuront1olx mietlsfa2ra(vs t0tlxomf iadom ran sl(0t2uo(m iy1optelncs (f 2uru p;u0optoii3iytls2rauvo;u)tlerxr iydfp  luvs;() eumiopnu4ope mfctlt  Drrxrooo1oexnifciat s ra( s;(4 rxnxrcoadomtrai s t0teurirpoudlptemicia(  rtr(r nt0texoioeiytfaDrluvs u4trermr ty1lmtranvilt0sexmxm3io4am   nvt t) Drrumoot1oeen feiys aDemuvon(0artnxr ty1lp  lu s;t0trtmio nu4llt mnvs s)s2uaumpoo1oee  oetlt a elums;t)teeomo iadfp raies s s2tr(m no1opt  neias)srtmxmont0olto fcias sDumu s t) lxnmrciy1omt auvs;()trumxmpnydlmtn fcs t arum(r ou0opt  i3ils m2ulu o;(0arermr3iodfa elueo;t  rxrxm3oydap  lnctl( a2rax poo1olx  i3iad s eau s () rerxf3ia1lmDe i o;s0t2ur(m oo1op nmivils)artaxr ;o1aexnifciyd sDemump;() lxoxo3iydomtr ieo s s2uoirpio4omte fvtls)s2umu pnu4texnif3tydls2ua(mo;u) lerif3ty1lmDeauvsl(0truoxm3oy4omee fvtl(fs2uauro;t0oltnioeiltfs ulump;t)tlxomfciy1lp rln i ()srxo(r3nydamtemnei (f 2tru pot4oeenii3tlt m emnmp;t)texrmf iy1fm  lneol(0teuoxm iodalt lfvsat)a2trur nu0tetniiciys aDrl(msnt4tltrifcoatlm ean s;s0s2uo(r3oy1ol  lfvtas)s2tmuronu4aetnifeildlm2emuvp;()aetoir tatfa e ivsls) 2xmxm ou1lm  mfctls) rumumonu1tlx mo3iadfm2rmumpnu)aexnmrcoa1fmD  uvi s0t2xoxr nu4oleemictlsf Dta( o;t0tpt  ociasfm2ul(von(4altrmr3totfa  auei;( t2toxm oydalte netas a2ua(m no4ape  feias m2eln p;t0 rtomfcoytlaD  ieo (0tetrxr3iy4oleelncilt)s2rr( ooo0ape iictas aDeauvon(4artnmo3oydfatraivs t  rto(m3no1aptelfviatfa2taxmpot1aeen fciatla2rmu s;u0arenmf3ootfaD lueo (0sruoimpoo1lptn ieta(  2tmx poo4oexn fcilsfmDranmp (0aetoif iatlatranvo (0tetmxm3oo1lpenlnesa()srumx ono4apx  o3ilslsDea(msn(4arxomo iodfm r ueilt t2xmxo3ny1op emnvt tf rumuront0oetoifeiysfa umnvs t4 exnif3to1laDr uvi s)t2tr(m3oo4ol emnvsls aDuru ooo1olt mfctldla2um(ms;u)teerxr iatfpDrluei ( tetm(opny4lp  licsltfarumxm ;u4oeeo oeiadlm2el( o;t)aleoirciadlptr i sl()texmxrpiydlpenmfcslt)a2urxro;u4optnmoetytfs2umuvsn(0 rxoxrcio1oa  lu ilt)t2to(mpoudolenmieiat sDtru  nt4optomociasls2rmu snt)aetoxo3tatlm eanesls)s2xrxm3no1altelnet s  Dumxmpno1aetnioetytlsDrl( p;t)arxrxr ta1op  luei;t srxrir3iudomt mnesls)s2urxmoot0aee  ociadls ul( onu)aexnxf3to1lmDeai s;s0srtrio3oo1opt lfci t)a2taum no0ale mi3tlsla el(mp;u4trxrio iotfatelivo s)sexoxm3oo4ol   iciatfartmuro;o0oleniietas s2rm(ms;u)trermf ty1op   u s;( t2urim3ny4ap e nes sfaDtr(  ;o0alxnio3iad mDumums;t4texrir3iatop  livs ( s2xmio3iu4alenmfvsa(  2umxm ou1aeeomi3tldlm2umn p;t0aetnmoctatfpDe i o s)trtr(m3nu1omenmiet t) rumxm ;u4olt ioeiysla2uaums;(0altnxfcoatfp eln o;s0trtr(opiodlmenlivsls a2rr(mo;t1tlenmoeiytla ul(vs;u0tleomo ia1lpDr u o;(0 etrir3iy1alenmiesa()aDtm(ro;t4tetnmoeilsfmDuln snt4altrmr oy1fmte i i t)srtoimpoo4ol e fviat arrmur nu4oltniictydlsDul(vont0 exnxfciodopDeai o;s0truriopiu1openlfvia(fa2tmx  nt1alenmfciatls uanmon(4trxrifcoadfmtr ies;( trxmxrpnudomen fvil(f rtauroot4tptoifciasfm raumpnt4aetoio3iydfm raivil()srxoxm io1ll nlivtasf Dtau ooo4altnii3iyd aDeauvs t) lxnxocoo1fmDeln s s0t2trim3iydame micsl( s2rrxmoot0apx  i3iyd mDelums;u0tleoxocia1lpD aneo;(0tetm(m oodop  mfeilt a2tm(rp;u1tlt ifetasla ul(mo;t4 exnif iytfaDelueo t t2toxm3iudol elfei ()s2urx p;u1teto octysfm2eluvs;t0trxoif iadop   ivslt)trur(o3iu4ame mfvi sfsDrmx oot4opeoifctatfm2rm(vont0aetrxf tadlateai i s  2tr(r iu4ol elieslsf Drr(rpno0aeenmfciatfs rlums ()altoxf3iadlate ivilt teurxm ny1lmtnlfesasfs2tmxr ;u4oeeniociydlm rmnmo;(0 rtnircto1oa eanes;t) exoim3ou4om e icslsfa2umxm nt0oleoiieiyt a eluvsnt) rtoirctydfp  aivolt0s2tm(o iodlm   iesl()sDrr(m ;u4tlt ifctad aDul(mo;(4 reoio ty1lp  aivi;( srtmio iu4op nlnes s)sDtrum oo0oexoif3tldlmDemu o () etnmrctatoaD aivi;s)teumimpiu4ap e ici () Dtax pnt4oeenmi3tysfa eauvp u0arxoio tadfatrlu s;s) eum(opiu4lmtn fvsltfsruaxm ;o1tee  f3tlsls em( s (0 eenmf3iadlpDe ivol() etm(opio4ll elnct s) 2rrxrono0opx  ociltfm umn s t0 rtrmfcta1op rli i;s sruoir3no4ome mfei s aDuaxrooo1olx mictatla2elumo;t)teeniocoy1lat  n i ( tetmxopoy4al emivtatfa2tmx pno0tlxomoetysfm rlnvo t)altrxoctytfatrauvsls) eurxr3io1lmee feia(f rraxmpnt4tptoiocildfs ulu s;(0aleoxfciadfmD auei;(0srxrimpny1ame mnet ( a2raumpou4teeoifciyslm rm( o;() rtnio3iodlmtrli o;(0 rtmir ny4lm  mivia() Dumx poo4aleoif3tlt s ulu s;t4arermf3io1faDeanvo;s trtr(r3ny4lptelnciltfsDtaur nt0tltomociydlmDrmuvo (4 ltnir iotfaDr i o t)t2xmxr3ou1al e nvsl()srrr(mp;t1oee iietlt m2eanmo;(0teeomo oatoa elneslt0 rtmxm ny4oltn ncil(f Duaxm nu0aee mieiysfa rmn p t4trxoir ty1fp e ivs t0s2urxo3iy4alt
\ No newline at end of file
@@ -0,0 +1 @@
+ivils seumir3iudapt lieslt)a2rm(mp;o0tpx mfetadls rm(von(4 ltnxf3io1op eau olt0srxr(m3iy4amenlnvta(  Dumurono1texomf3iadlaDul(vs;t) rxoio3todopteaivsls srxoiopiudlme lfvt s) rua( pno4oexo fetat m ra(mp;u4 ltoifciadfm elnvi s0 2umxr iudomeeliet t)s2raxmo;o1apx ifeiyslmDrlumpn(0alermo3ootoa e ues;()s2toxm3oodomen ict tf rrrxmo;u1tptomo3iytfa ulnvo;t)arerircoa1oatrlivi (0 2tmxm oudomtnlfvtas  Dra(  ;u4openmicildlm2umumo (0alxomo3io1faDrlueol()seurxo3ny4ap  lict tf Dtrxr ;u0oetomo3iyslm elnmo;()trxnio oo1fateluvo;()t2ur(o3nydol  lfvsa()s2ra(r ot4tee mfctad a2rlu s t) lermr iotom r nvi;s) 2xrxo3nu1lme  fci tfaDum(ro;t1teenmietydfa eanmp t0altnmo3ty1fp  lu i s)srto(opnu4lm  mfetls s2rmu pnu4aetomfctlsfm umnvp u) rerxrcio1omDelivi;(0teumxo3iu4alt lnciasf Dtau p;u0opx moeiydlm el(mon(4tlxnmrcoy1laDr uvo s t2tm(r3io1omt  ivilsf Drm( oou1altnmiciydls2rl(vsnt4arerirctotfpDe n s;t  2umxm nudop elnviat) 2rrx pnt0oexomictatlm ra(vo u0trtoifciytlpD ln i (0t2um(m iu1amte ivta(f rtmxro;t1apt ifciltfm umu s;(4tlermf oadlpDe nei;s) 2xmxopiu1ll e netas  rtm(mpot0apen o3ildfa uln snu4 lxoxr3oatlptrai o;s0 rtm(m iodape mictas s2um( p;o0aetn fetls sDelu snt4alxrxrcoydfpDraivo () rtmxo nu1lmt mivils)s2tr(r nt4tpenmoctasfmDemumpnt0alxrxr3io1lpDr ivilt)texm(opoy1ale  icia() Drmxm ;t0olenifeiyslsDra(ms ()arxrmf iy1faDrln i;(0 exoxo iydole mfeil()a2ra( poo4tex if3tas a rm(mo (4 lermf tatlp eaivs;t truoirpno4al  mnes t arurxm ;u4alxnmoeiasfa rlnvs;(0altomr oodfm e uvsl(0sexrxr nydll elictat)sDtau o;o0apeomo3iaslm el(mp;t0alenmo3iydfmtrlu i;s  exo(r3ou4om  mfcsatf Drax ont1tpeomietys sDua( snu4 lenmrciatlpt  ueilt)t2tr(m nudllenmieil( sDuaxmpoo1aetn fctls a el(mo u0 rxoxr iadfptelieo s0s2toirpiy1lm   iesltf Dtr(r ot0tptnmfetysla rl( s u0tetrxf oatfmtrauei ()t2uoxo3oodomen nvt sfa2rrum ;o4apeomfciyslaDulnvp t) lxoif3oa1lp r ueo s  2um(m3ou1lleemict s) Dua( ooo4aeto ieiyd a um( onu0tetrir tydlptelieo s0truoxm3nydalenmfctlt srrm(r oo4aptn o3ias s2rlnmsn(0aexrmo3to1lpDrauesl(0 rtr(mpiu4lpeeliviatfsrtru poo4oeeo f3iadfmDel( o;t0trtnxf iydlm r i s (0tetmxo io4ll   ncslt) Dtm(mo;u1ope iieias sDrm( o u0artnif oydfa rauvo (  rxo(o oydopeelivi (fsDtau pno0open i3taslsDrm(msnu)trtrxo3oydlmt auvs;(0trxm(o3nudap e nes tf 2tmxmp;u4oetnifctyd a2elump t0 etomo oatlpt auvo;(  2trim ny1ll n ies tfsrtaxmo;t1tltnioetadfm uaumsn()aeenifciy1oaDrlnei t)trtoimpoy1lme livs tfaDumu p;t1aeeo ocias mDuaumo;t0altrmf tatlaDe u sls)teurxr nu4lp n nei s  rrrxr ;t1open icilt a2rmuvo;() exoiocta1lm r n i;s0 2trim no1lmtelfesl() Dtr(ro;u4opt ii3ilt s2umums t)tlxnircoydfptelu o;t0trxmiopio1open ivs (  2rax oot1tltoif3iydfs rmnmo;t4 ltrio oa1oa e ivol( seumir3iu4lmen fctas)sDtr(mpou0tet  i3tldfmDrmnmsnt)teeoir3ia1fpDraivo t srurxopnodal  mneta(faDra(ro;t1apxoiictls aDranmp u0 lenmf3oydlaD  iei t0trxoirpoodomtelnvtl( aruaxmp;o1tlt  ieils a2ul(vp;(0 renxfctodfa eai s;t)t2trir3iu1am   fei ( sDuax  no4tpxo oetlt mDel(vpn(4 lenxf3oo1om ean o t)trxr(r nodop elivilt)a2tm( o;o4tltoii3iasfaDrauvont0tleoxf3iatlpteaiei s0trumimpoy4om nlneia() 2tr(mo;o4oetnmo3iytfaDelnvs t0alxnmo oadfpD ai ils0texrxo iu1ome lieiat)srumx  oo1olen o3tltla elnmp u0altoir3oydlaDeanei s0 rur(m3iudomtemncta()arumxmp;t4tlxo ociasla elu ont4arxrmo iatfateaivs () rxo(m3nu4am emncs sf rrr(mo;o0aleniieiatlm2uaumont) rtrmrcoatfpDeau olt  2ur(o3io4al nlfctlsfa2taxm ;u0oeeo o3tltfs2rauvonu)teenmo3tadoatelies;t0srxoiopiydlptemfeiat  Drru  ;t0oltoioeiytfs2el(mo (4tlxrmr3ia1lat  nvs t  rumxr nudam e fctas  2rm(mpou1tetnif3iaslmDeanvsn(4 exnxr iydla e uei t texoxr3oudamtnmicslsf rua(mooo0tlto feild a umnmo (4 rxoir iydfm  lneo s srto(opnodole mncs sfaDtaurpnt1tptoifciatlm2ulu pnt4tltnir3io1fpDe uvo t  2xmxmpnodop emnct t)arra(rp;t0olxomo3tyt aDulnvon(4trxnifcootlmDelieo (0srtoim3iu4lp   nciltfs2umu  ;t0teenmfctltfm uauvo;(4arxrifciotopDrlnvolt) 2toxopiudlp emnctlt srtr(r ou1oet mociydls emn p;t0 lxrifcoy1fmtelieo;() ruo(mpoy1amt mneiltfaDtax  ;t1oleniietas m2umu p u) etrio iatop  auvi ()t2trim ou4alen ivsa() Dtr(ronu4aexnmiciytlmDrlu snt0aexrmfciotomteauvilt0 eurxrpnudap  mnesls arrrur no1ole ii3tls s2ua( o;u)tleoir3oo1laDelu o (  rtmirpnodaltelicil( arra(rooo0tlenmoeiydfsDumumon()tlxrmo ty1fa  luvsl(0trtmxr nodamtn ietls  rtmxrp;u0opt mf3iyd a2rmn s () lerir3oo1lptrai i t0srxmxr iydame  iviasf Dta( ooo0oexoifciydfs umu s u)tlxrmfcoytopteaneo t0srumxr no1lltnlfctl( sDur(mpnt0tlen iciyslmDem( p;t4aetrmocootomtran s (  2uo(m3oo4om  livt ()arrau p;t4oltnmociltlsDelnvo;(4 exrmrcoatfaDeauvo s setr(o iu4ameemfeslsfs2taumpnt0teen oeiyt s2rm(von(0 ltoxo totlatr u i s sruoxr3nudap   nvtatfa2umxm nt4tlt mo3tatlaDuln p ()arxnxo3to1fpDe uei t0 eto(o3io4opeelfetls)s2umuroot4alxnmietadlm ul(vonu)arxrirctydlatrli s;( s2toxo io4amee nes sfsDta(mono0texn i3tysls eanmo;()aetniocty1fpD  iei ( t2tm(rpiu1lltn icilt)srtmxmpoo0apxo o3tys s2rmuvp t4texrxr3to1lateanvol(  rxm(r3iodamee netl()s2ururooo4oee  f3iydfsDuau p;(0teeoxo tadlmtran ols0s2um(o oy1ol  mnet ()a2umumo;t1ape miciyt a uaumonu0tltrifctatlmte ivo;t t2umimpnudal  mivtlt)aruau  oo1aptoif3tasfa eauvpnt4 lxomf oydfm rlueils0trurxo3ou1omte ivsas)aDrm(mpnu0texnio3ild m emnvp (4tltrir3tatlate uesl(0texoir ou1aptnlieilsfaDrrx  ou4tetniieiad a rl( p;u4texoxr tytlaD auvs ()seurxr io4ameemfet () Drmx  ot1oleomoctls sDrmu p;t0arxrmr oytoatrluvs s)t2xo(opny1om  mictlt)aDumx  ;u4tpx if3iytfm em(ms;t4 leoxfciodop  au i ( srur(o3ny1optnlivi sfsrumu  ;o0apxo ociytls rauvs;t4 eenxr to1fa   n s;()t2toxo3iudam e fcta()srtaurp;u0opeoii3iytla rmuvpn(4trerxr iytfpDr u ols)trxo(o io4olee nesasfsDrr( ooo4oltoio3tlsls2eluvs u4 lxnxr ta1lmDeau s;() 2xmir3no4llen nvi (faDua(monu0tlxoii3iysfs2umumont)aeerif3iodoa elu s s setm(r3io1alt  ivilsfs2uaump;o4apxniietldfsDemn s u) etnmo ia1fpDrlivo (0t2xr(o3oy4ape lfci () 2rrumpot4ope mfciydfsDeaump t) ltrif oo1opDeauvslt seumxo io1lme mnviat sDtrxrpnu4alenii3iys mDeln on(0 etnifciatlptr ueil(  rxoxrpno4ol elivtat sDrmxmo;u0alt ifeiltfs rl(vs u) ltomr3oa1om eau o;(0 rtmim nu1ol  liei t) Duru  nu0oetoio3iaslm2ran p t)artnio io1fat anvi;t0s2xoxr oo4op e fvilt srraxroou1aex iociatls rlu s (0 ltomr tydfa rluvols  eto(o3no1amen neia()aDuaxrpot0apxnioctas s umumonu0texrxfciadlmD lueo s)sexoxrpoy4amen ictl(f rra(r ;t0ape mf3iatla2ea( s;t4trtrir tydfa ranvi s  exr(rpiudolte iesat srrrumpnt0tex mi3ilsfs2rlums;t)altnmr oy1la elivsl()t2urxo iodam   feils)sDurxmooo4teeoiociytfs rl(msnu4treomf ia1fp rluei;t sexo(m oy4alte icia(fa2tax p;o1tpx moeiltfm rlu o u0aetoio3oytlmt auvi s)seuo(mpou1lm elnvt (f 2umxmonu4oeeo octasla el( s () rtomr3oodom  anes t) exo(o3no4lle lfcslsfs2urxro;o4aeeoio3ias aDrlu o (0artnmf oytlpteluvsl(0sruoiopoudameemnvils a2ra(monu1olenmfeiysla2rmnmo;t)tltnio3oodlmtran i;s) rurxopoy1lme mictl() 2umu pno1tet  feiat a um(vs;t)tlerir3ootlptranvs;(0trtm(m3oydamtnlfei tf Drrxmo;u0oltomi3iyslm2rm(mp (4 eerxr3iodopt an i s0t2xrxopoudome liei tfsDurum no0apxoio3iyd a ea( o;u4altoifcoa1fmDr ivo;t teuoxopny4op nmicsl() Dta(mpnt0oetnif3iad a2rmu on(4 ltrif3tytlm e nesl()s2umxmpno4optnmies t)a2umxm ot0tetnifetytfaDua( s t4 lenmf ootfmtrauvsl(0 ruoirpou4ll elnvia( aDtax  ou4alxnifctyt m ul(mp;u4altnifcoatfaDelivs s)setmio3ou1alenlfeia(  2tr(  ;t0ale mfeiatls2emnmsn(4artnmf tydlmtrlu sl()trum(rpnudol  lfct sfsDrmum no1apeoifetlslsDumnmp;(4arxnxociytoptraneo;t s2uoir3oydlmeemicils)s2tmur nt0tee  ieiatfm2um(mon(0areriocoa1fpDrluesls0 2xm(r3oodllenmiei tfsDurumpot1tltn feilt a rm(mp t) lermr3iytopt  u i (0trurxm oy1alee ics tfaDtaxm ou0apxn i3ilslmDrm( s;u0 renxr iotomtr neolt t2xmxm oydlpenmnesat aDtruro;o0texn octys sDua( snt0 lxrxf3ia1omDrauvi t setmiopiodapenliesa(fsDumumo;t0texoiietld m2elnvs;u0tlxoxr3ta1laDr ivs (0truoimpiydam emics sfarrmumpnt0tpt mieilt s2raump;u0areomf oadomteauvi;t)srumxm nu4lm nlictlsf 2tmxm ot4tex mieildlsDrm(vo;t4tetnxr iydlmtran slt t2xoir3ou4lle  fci s)arur(mpou0oetoioetltla emu s (4trxnmocoatfmD aiei t0 exmxr io4ape  ict (fs2urumpnu4aee moetytfmDranmpnu4tltomo3ty1opD ai i;t texoio3oudap elnvt t srtmumont4olxnmf3iyt m umn pnt0artomo oo1laDe nes;(0 2tmir3nu4amen ieil( a2raxm ou4aetnmo3tlt sDuau s;()tlenxf3iotfa elu o;t0srxoir3oo4amt  ivias)srtmurpnu0open feiltfaDeluvpnu4teerio3totfp  auvi (0srum(o3oy1omt  neils  2rm(mpnu1aptn oeilslsDean p;u0 etoxr3iatfmDrliei t0 2trio3iodlle mnvi t artr( pno1oexnifeiyt s rm(mp;t0 lxrxr oatfp rln s t t2xrimpoo4amtelictl(f rtrur ;u1ape ii3tatfa rl(ms;t) lermo3iydlat li ils0trxmim no1ope mfcilsfa2umum nt4aee ioctldla2em(vo (0artoifcoytlmt ai ols0texm(m oo4ol   icsasfartm(ro;u0tlxo oeild sDulums;u)arxnir3oy1om  lieo t0trxrxo3iy4apt lfes ()srrrurpno4apx io3tltla2uan o;() reoxf3ootlm   n ils)t2xmxr iudopt mivtl(f Dumxrp;o1teeniiciysfsDrln snt)alenio3iadlp  ai ilt0 ruo(rpiydolt lfeia( srrrxmonu4tpx ifeiltls2uan s;() rtrxf3ootfmteaueo;t0s2um(mpoodap elfvtl(fsDumxmp;t4olt  oetytfa ul( p u4 reoir3oodfp eai ilt0 rum(r3iy1lp elivta( s2tr( ont0tpen ociad m2um( s;t0tetnir3oadoaDrau ils srxm(m3nu4omt  iviltfsDtr(ronu4tex if3ils s emn o;t4teeoifciy1lateln o;s0t2toio3io4alt mnet t) 2rrx onu0optn ieiatla rmnmpn(0aetrmfcoo1op eaueo t0t2xmxmpoy4lptn icsatfsrurxr ou4tpx  octldlsDraums t4 reoxfcoydfpt lu ols0seurxo oydam e netl(fsDum(moot1alenmi3tls aDum(mpnu)artoiociydfmt ln sls)trtrxo3nudlltelnctas s2tmx p;o0tetnmo3iytfsDrau snt4 etomociydlpDelneo;s s2tm(r nu1ll  lneiatfs2tmu  no1alxnif3tldls2ul( p (0teeomf ta1op e n o s) 2to(mpno4ll  mnctas  Durumpnu4tetoif3ildlm rm(ms;(0 lerif ty1omDe ieils0t2xoim oudam  lfeias)s2tau  no0optnmf3iadfs2um(mo;()arxoifcoo1optranvi;s) etm(mpny4apte ivs sfs2raump;o4ole moctat mDelumpn(4 ltnir3oydop eaueilt  rxmim3ny4ap n ncsls  Drrxrp;u0tpt  f3tyslmDrlnvonu) exoxfcty1fm rauei ( seumxm3no4opeelneils)aDrr(r nu0opt  fciatlaDuln pnu)alxrmo to1lmD li o;s)t2to(r nydal   feil(fsDrmumpou1oeenmiciadfsDelump (0altrio ta1omtrai il(  2toiopoy1altnlfcs tfa2rr(rp;o0tltoif3iaslm ua( s;u4tetnxo3iodla e uvs;s)srto(r3oo1oltnlivtat  Duax pnt4olto ociatfs2emu s;()trtoifcoatom  luvil(0s2xrxm3io4op elncsa(  ruru oou4tlto i3tytfs ea(vp u0aeeomf oatlmD  i slt)s2umiopiydllt lfei (  Dumxronu1aexo o3iytlm umnmon() eerif oadfatranvi s  2uo(r3nu1ole  nvt tfsrumxrpot0aetnii3iysfaDeau pnu)tleomrcoa1op raivi;(0sexrxo3io1olt micta()aruaxm no0texo oeiys m el(vs (4tetomrciotfaDeln ols) 2trxo iy4alee fvilt) Dumx  nt4oeenmfctasls2ua(ms;t0 rerxo3totla r ivs s)t2xrirpoo1op elncsasf 2ta(mo;t4alxnii3ilslsDranms u)teenxr iodlpte nvs;(0s2umimpno1omen feslt aruaumo;o0tpt ii3tld sDua(vp (0trtnmr iytla eli s t srurim3iu4amt mncsat)aDuau  ;t0aexo icilslaDrl(vs;(4arxoif3oydlm ean o;t  rumxm oy1lmtn neil()aDtaum ;u4aexnmiciys a2ra( snu)aetrxf3iodfa  lieil( seto(rpoo4ol n fvilsfaDtr( p;t1apt mfciadla2rm( pn(0 etrxfctodfmte u slt) 2xoxo nudal  lneias aDtmumpou1aptnmf3tltfs umuvp;(0aeerxo3io1lmtrlivo;s0srxrxm iudapee net (faDuaurp;o4aexo fetysls ul(ms;t4 exnir3oodfaDelieslt0trxoio iy1omt mncia()artmx  ou0tpxnio3iydlsDuaumo;t0teenxoctatoa  livs t)sexmim oudapt mivia()sDtmxmp;u0aeen f3iydfs2rl(msnu0tetrmr3todfaDrlueol(0t2uo(o nu1altemfciat arum( o;o4alxnifciltlm eanvo;t)treoxo ootopte uei;s setrxrpoo1om e fctlsf rum(m oo4tlxnmoetldls2raumsnt) eenmr3iytlm r iesl()trtrimpou1al   nvsa()s2rrum oo1apto f3ildls ea( s;t)aetnmfctydlm raies (  rum(rpiydolte iesas)s2rrur ot4tex  oeilsla2umn o t)trxoxo iatlmDe iei;s0trtm(o3nodlle lncia()aDraum nu1opxnmf3tlsfaDum(mo;(4aetnmr3oo1lm rluvilt0 rto(mpio4lptnlfetat  Drau oot4oltoifetltfmDum(mont4 lerio ty1oa   ieo s0teum(r nu1lp  miciltf Dtau  ;o0apt mfeiatfs2el( pn(4treomr3ta1opDelneo;t)setmimpou4lltemncsls a2ta(rpnu0opx mo3ildlaDraums;t) lxrif3oadfpDeanvi s0s2xrxr3oodal  lfcia(f Drmx o;t4tltoifctas aDrm(vp u0 ltrxo3iytlmt li o;s sexmim iu4alenlivs t)srurxmoou1olen fetasfs2rlump (4 leoxf3ta1oatraivi t0seuoxo3oy4optelivilsf rua(  oo0apxnifetyd aDua(mo;t0arxrifctytfptr ivo;t)s2urxo iu4alenlfcs s)sDuax onu1aptniociyt m raums t0texoxo3ta1lmt  n s;t)t2uoxo iudllt lfvsatf 2tm(  ot0apt io3tydfsDuln snt) etnxf oa1oatrlivo t0srtm(r3io1ameelnet sfa2tau  ;u0aee mietydlsDrlnmo;t0artoif totfpDran s;s0 2umxopiydoptnlieils) Durx ont1tlxomf3iyslaDel(mp t4 ltnxf iy1laDelieo;t0 rxrxr iudol n ivta(  2trx o;t0texomo3ilsfmDrln sn(4 ltoxrcoa1fmDraieolt0srxmxo nu4lmeemiet tfs2raxronu0tlxoiicils s rl( o;(4artnxo3oadfaD au s;t teto(m3iu4lmee fcs t)s2rrx pno1tpt mf3tyt aDemu p u)trtnmf3ty1laD  u i ()trxrxopiudlm   fet ()a2rmuro;u4oee ifeilsfaDra(msnu)artomf3tytopDe nes;t setoir oo4om elnvsas aDrau onu0ope  f3tltfaDelnvs;(0teeomr3iodfatr ues (0srtoio3oudom nmieiasf Draxmoou0alx io3tatls2ean s;t)tlxrmf oodoaDelnvi ()seum(rpnu4llt lnctl()s2rrxr ;o1tpeomo3iasla elnmpnt0 ltomfctatomteln s t) rum(m iy4al  mfvsas)artm(mo;t4aetnmoctyt a rlnvp t4 lermr todom eluvi s0 rxrxr iy4op emfvtls srrr(r ou0apxo f3ildfmDumnmo t)teenmfciadfmt  ueo t srtm(r iydlpenmfeia()srta( ooo0tex if3tydlaDem(mp u4alxriociadoaD  ueolt)seurim iodlptelivs tfsrra(rpno1opx  ieiysfa ulnmp;u0tetomf3iodla eanvi s  2uo(o nudom   fesas aDrmxm nt1oltoif3ildfmDrlu s t4teenxociodlpDelnvo s0truoir3oy1ap n fctlt)s2tmuroot0aptnioctadfm ranmp (0tlxoxr oydlm rlies t0 2to(o nydlp emfctlt) rtrxrp;u0olxoii3ildfm ulump ()trxnxrcoadfptraneo;s0 etrim3oo4omtnlivi sf 2umurpot0tpe ioctat s ulnvp u0treomr3oa1opt aivs t)t2ur(o no1lmtnlicias)artaxrpoo1oleomictlt m rl( p;(4trtrmr oatop  lueo s  exm(r3nodlleelnesa(fa2ra(r ;u4oex  fetls s rmuvp t0alxoioctodfpD lnvs s trxmxo oodop nmiesasfa2urxm ;u0alt mictytfs2ranvonu0trxomo oydop  livi;t0s2xoiopno1ome mncilsf rrm(ro;u1tpxoifetatfm2rluvsnu0arermr3oatla  au il()t2umio io4am emnetat)arrmxr ;u1olto ieild mDuanvont) etomfcoy1opt lu i s teur(mpoo1llte icil()sDum(r ou4oeto iciydfa rau sn(0 eermr3oy1latr i s;s0teurir no1lmeemici ( artrurp;t0olto fetadls2ua(mp u4texoxf iy1omD livol(0setmir3oo1llee ivtas) Drmxrpnt4ape  iciys aDrmnvsn(4trenxo3iotop r uvo;s)s2xm(opoy1aptnlivtatfa2raurp;t1alt  feiatls2rmumon() exoifctydfateai sls0sexoirpnu1ale lnvsls)srrmx oou0aexomfciad a2umn o t4teermoctodoa  aivsls  eurxm3oy1lmtemici tfsrtrurpoo1aetn fciatla2elumo;t4aexrircoa1lptrau ils) 2tmxopnudameemics s)sDraumo;u1oleo oeiytfa2rmn p u4tlenmf3tydfpt anvs t)s2um(o3no1lle lfvt t s2rr(rp;t4oetnmfcils sDumnmon(0arxnxf totoa r i olt)s2xoxopiy1omeelfct sfsrtmump;o1ale mfcias m elnvo u0 exrmo oatoaDrluei s0 euoxm iy1oleelncs tfsrtrxr nu0oltnmoeiatfm2eluvont) reoiocootfp   i olt0trxrxo iy1alt  nciltf rur(rp;t4aeenmf3iytfa2rmu o;t4 eeoio3tadfat anvo ()t2tr(m oudol   ncs sfarrmxrpno0oleoiociytla rl(ms;t4 ltnmocoo1lp eau o;s  2um(o iodllt liesls) 2rm( ont0tpxo fciatlaDuau pn(0 etnio ty1lp eaieo;s0teur(o3io1lmtnmivs sf 2rrxm ;o0aex iociaslaDem(vs t0altrir3iodopD auvi (0 rtm(m3nodalt lfctls)sDrau ooo0ape ifeiadfa2rl(vsn(0arxoir3to1lp rlivs;s s2xm(rpno4lmenmncs t) 2raxront1alx ifcildfs2uau snu4arxrif tatlpt  ies ( seum(r iu4al  lfcs t)aDurx o;t0oleomo3tld sDel(vp u)treoir3iadlmtraivi;s0trtoxmpio4llen fei ( a2ur(rooo0ole ioctydfa uln o;t0texnmfctytlptr nvs;t0trtm(r iydoltnliciat)arta(m ;u0aleomoeiysls2rln o (4teenio to1faD livi;s)t2xmxm3io4ol nlietl(  rrmu  ;u1apxnmfeiysfm ra(vp;u)alenmr3iy1lm  aieo;s0 ruoxo3no1amtelietas  Draxmo;t4tlt mfeiatfmDul(vont)aetrxocio1fmt an i t)truoirpiy4ame lfesat s2tmu o;o0tetnmf3iyt mDeaums;t4aleoifctydla   n s s0 rxo(r3ou4oleelncilsf 2ta(r ;u4tee  oeilsla eanvpn(4alerxo3ia1fp eanvs t trumimpoy4omtnliet tfs2ur( pou1tptnifciyt a2ea(mo;()arxomr ty1laDr uei (0t2uoxopiu1op e neta()a2rm(mooo1tle mf3iysls2eanvpnt)alerio oytfaDeaivo;s0trurxrpou4ol elfei ()srtmurpnu1aeeo f3tlslaDem(mpnt0aexnxf ootfptr nesls texoir3io1lltelfcslsfarraxmp;u1tlxoio3iat s2uauvs;t0aexoxo tytfatrluvi ( sexo(m3nu4lpe  icslsf Drmx  nt1tetoiicias m2eaums t4texnmo io1lmtr uvo s t2toxm io1opeelnvi s a2trurp;t0apto fctlt s em( p;() lxnxoctadfatelnvi ( tetoxm nodll elnvs tf rtmxrp;o0tlxnmoeiat s umumo;u0trtrir tytfa  anei s seurir3oy1am elfvt () 2tm( pnt4ale ioctatla eau o;t4arerir oodoatrai o;s)srto(m iu4lpenmfei ( aDrau pot1apxn oeiat aDumu p;(4aleomr oadlp eanvils  rxoim nu4lpe  nvilsf 2urxmpnt0tetnmi3iad a2rlu p u4tltoxr oatoatrlu i (0t2xrxr3ny1alt liciat)s2tm(m oo0alto f3iysfs rmums () rxrmf ootop r uvsl()trtrim3ny4op e fvs sfa2ur(r oo0ape  icils m2rluvo;(0trxnmr3iotfmDe ivo;t)texoxopou1ole lnvtls)aDrrxm oo1apx ifciysfa umumon(4aeerif3to1fp  lu o;s0 2uoir iudap  mnvs s a2tru  ;t0aexo ociadlmDea(vsnu0alxnxr3iy1lmtrli s;t0tetoxm oydomtelnvslt)a2rrur ;u4tee  fetltla em( snu)teenmocoodoptrauvs;t0 etm(opiu4llt lfct (fs2rax o;o4ape ioctatlaDelnmp u)tltnxfciydfpteau ils) 2xmxo ou4opeemfet ()s2rrurpoo0olxnifetld a eauvon(0 rxoxf3tadfpD ln sl(0 ruo(r3nu4omenlfct sf rururpnt1tlxnmfetatlmDranmpn(0aetnmr oa1op r n o;t0s2xmir ou1olt  ivtls)sDuaxmpnt4oex mociytfaDuln o;(4altoxo3io1lm raiesls t2xoxm oo4lptelfvtlsf 2uau o;u4ope io3tysla ua(mp t4tleoif oa1om  an s ()sexrir nydop nlnvias)srtm(r ;o1tex mieiys a2emnvo (0 exnmf oydfat lu il(0 2xrir3no1lme mnesas) Dtmumpnt1aee io3iad a2ran s () ltnmf3tytoaD livi;s) 2uo(o3iy1lpenmneia(fartmu poo4apxomociad m2rauvsnu0artomociadomt anvi;s0teuoir oy4lmtnlies t  Dumumpoo1aetnmociys m ra( o u)aeenir iatfmteai o;()s2umir3iydlpt lnciat aDurxmonu4apt ioctasfa ua(ms (4 ltoio3iodlp eluvo ()trtrio3iudap e fei t  2trum no4tpx mf3tysfmDum(vo (4areoxo3oodfpt li s;(0 rxmxmpiy4ame mivta() 2taumpou1apto feiltfs2ra(vp;()aetrxrcoadlmt  ivo s0trtr(m3no1opt mnet tfa2ta(  ;u4alx if3iltlmDulnvs t0teermr iatomtr u il()srtrxmpiy4lle livi s) Dum(  ;t4oet moctyslm ulnvsnt0arenxo3to1lmtelueil()srto(m iudom   ivias)sDtaurpot0tlx moctys a um(monu)tlenmoctotfat ai i (0srxm(rpiy1omtemicsltf Drm( pot1tleo ociltfm rmnvonu4tltoifciy1opDelueslt) 2tm(rpny4olenlfcta(faDraxm ;t1apto ietadfa2ea(mpnu0aetoxf3iatlptraieo;t s2urxmpoodopt  ivil() Drau oot4openmoctysfa rm( p;t) lxnifcoa1la raueo;s)trto(o iudamen neia(  ruru ooo4oeen i3iysfs2rmnvs;u) etnirctydfa  au o t0 rum(r iudap n nctas) rua(mpoo1tee mf3tydla2emn ont0 etnxfcoodopt lnvs s  eurxopno4al elicsas)aDur(mpnu4tlt  f3ilsfaDrlnms t0alxnmr3totlp  aneo;s0texrxr3oydllt mivils) Dur(ro;u0tptnifcils s2rl(ms;t4 exomrcoadop   ivsl()srto(m3ou4optnlfvtas srurx o;t1alxn iciydfmDelnmo;u4trxnmf io1lp e ivilt0srtr(mpnu1ol e iei t) 2umur no4tpt ii3iysfm rm(mp u)aeerxociodom   uei;( seto(rpoy4llen nes (fa2rr(ro;t1openmoetytfs ea(vpnt)trxrir3ootfaD  neo;(0trumxr nu4ap n neiasfarrm(mono1olxniociatfaDuanvo;() reomociatlmt ln i s0texmxr oodlltelncsasfs2umu pot4tltn i3tls a emuvsn()aetoif ootfpD  ivsls0trtm(m iu4olee ivt tf 2tmum ;o1aeenif3iysfaDumnmsnu)areoir oadlmDrln i s t2xo(mpoy4altemfvi sfs2umxmoou1tpxoiociasfs rmu p;(4 etnif oo1laDr u i;t s2urir iudll  livsat) Dtrxmpot1texoiictytfs rau snt)tleoxf oodfm e n s s)t2xo(m iodaptnmieiasfsrrmuront4oeto f3iyt m rlu sn()tlxnxf iytfptraieolt  exr(m3nodam nlneiltf Duru  oo0aeen ieiytla umnmpnt4alenmo iytlp rluvo s seum(mpnu1op nmietl(  Drm(rpnt1teto ieiys a2ea(vpn(0 rxnmo ta1lmDrlnvil(0s2xrim oydlle lfei s)arrax  ot4olx ii3tyd sDrl(mp;() rtnxociydfpD  i sls0tetmio3iu1lpe lnetatfa2ua(r no0alx ioeiytfmDra( pnt)alxnmrctodfat ai o;s)teumxrpny4ap nlfvtlt)s2uaum ;u4oetomfeiytls2el(mpn(0texnxr3to1lmte u i (0 exoxm oo1om   icsltf Drm(r oo1oetoiieiasfs rlnvsn() ltoir iytfmtr n o;s)trxmxr iodam elivsat) 2taxronu0ole mo3ilt s el(vs u)teerif oodopteai ol()t2tmiopnu1aleemfeilt)aDtmxmp;o1tpt mociltlsDeln sn() lerxo iytfp   nei;(0t2xoir ny4oltnmnes t)srtr( p;u0tle  f3iytfm2elnmonu)aleoxoctotfmt  nvo;t)trurxm nu1lpenmivslt aDtax pno0tlenmiciys aDrl(msnu4 eenmo iydfatr n s t) ruoirpiydamenmnvsl( srtm(rpnu0tpxomi3tysfm2el(vsn(4 ltnxocootla  luvilt0 2xrxo ny1lpenlfciat)arrr( oot0ape  ieild sDulu ont)tltnmr3oodfaD  ies;s)sexmxopoydaltemiviat  rtm(r nt0aex  fetadls rmnvo;t)areomf oydfpt anvs s  rtmiopnu1al n feilsfsrtrx  nt4oleomi3tls aDran o;u4treoio3ty1latrlies;s0trum(m3ou4omtnmfcsl(f rurxmpou1tpxomieildlaDumn pnu)trxnmo3oytfaD lnvi s)t2xrim ou4ol nmies () 2uaumpot4texn fciyt aDeluvont0tlxnxr iydopD aivo t0truoxr3io4ll  lfcil( sruau oot4opeomfeiad m eauvo;t4trtnmr3to1lm elies ( srum(r oydlpt lieilt  rrmu  nt0tleoiietlsfa2ra(vo u)alermociotoateaies;s0trxmim3nu1llte fes s s2uaur ou4aexnmf3iatlm2umn o;(0 leomf tydfm  li o ( srumxr ny4al nlncs tf Drm(ro;u1olt  fciysla uan snu) lenxr3tadopDe ieolt)seumiopiy1lptn nvil(fsruau ono4apxnif3tadfs raumon(4trxrio3ia1oat lnvo;t  rxo(o3oodamt  nvtls  rrrx oot1oetomictytlm eanvo u)trerif iy1om r i ilt texriopnu4am e nei (fa2umx pot4tpt mf3tyslmDuaump;u0alxomo oadoa raivols0 exo(rpoudlp elfetls)s2rmumpnt1apeniocilt s uanvp;u) rxnmf oadlmDr u s;t trum(mpny1om elnvs s  rraum ou1oetomociatlsDeau on()texoio tytfm rluei ()trurio iu4lp elietl(f 2rmumont1tpxn iciatfaDulums t4artnio3ta1oa elnvo t)teuoxmpiu4lltn ies sfartmump;t4olt mfetyslsDuluvp (4teeomf iotop eluvils s2xoxrpny1lm   nciat sDrrxro;u0oeto o3iatfaDrm( s;()tetnxfcoadomD auvo;()trur(o io1opee neia(faDra(mp;u0opeomi3iad m2ua(ms t4tltomocoa1lp eln i s)trtrio no1am e nesl( artr( o;t1oeeomi3tldlmDulnmpn(4 ltnxo3todfaD  i s s  2xmxm io1op  lfeilt)sDuaxm oo1alx ii3tld m2ea(vo;t0areoxfcia1oa eaiesls)s2xrimpiydlpenlict ( a2trumooo1ale  i3iytfa eanmp;t0tlxrxo3tydlaD an o t)tetm(rpoodamtnlnes t)srtm(mpot1texomfeiyd m rauvp;u0tlerir iy1fmt aies s0 ruo(o3no1amt  nei (fsDurxmpno4opxn icils aDrl( o;t0 ltoxfctydfm eliei t) etm(m nudome mfvtl( s2rrump;t0apxn i3iyt aDrau s;()tlxrxfcoytlmD auvilt0 rxm(r3iu1lmeemfesatfaDtr(rp;t1aee iieilsla2um(mo () etrifciodomD lieols  exoxm nydope mfesat s2urum ou4apeo i3ild a2um(mp t0 eenxociy1opDelnei t  2tmxm3nu1ap   nvta()s2ur(m nt4oet  ictldfm2ra(msnu4aexomr iadfate i sls)srxr(m iu1apenlfes (farraur nu1apeomfctydfsDum(von(0 lxoxf tytoptranei () 2tmirpnydol elnvta() rumumpot1tpx  feiytls2ua(vs;(0 eenircto1la eliei t0sexrimpio4omtn netat) ruaur ou4tlx ii3tatls2uaumsnt0tetrifcoatlpDe nvo;t t2xo(rpiu1ame  ncils artauroou4olen i3tas s2em(ms;u)aetnxo3ty1om   uvi;s  rtm(m3iy4am e fvsas  2rm(m ;u4aeeomictlt mDea(mo;() exnio iatfmtrauvi;t setmxm3nodam  mict s)srum(monu4oex mfetatlm2el(mo;u4 lxoxocio1faDrluvslt)setoiopio4amee ictat)s2rmu  ot0tpxn icilsfm2rmu s ()aexnxr oo1fp  ai i;()teumxm3ny4omee ncias aDrrur nt1aex moctlsfs elnms;u4trermr to1lp rauei;t0srxmxm ny4apee ics ()s2ra(mpnt4tet  ietad a ul( snt)teenio iadopDrli ol()s2trxo3oy4lm e fvt t)aDuaxm ;t1altnmiciys mDrmuvo t0 eenmf oo1lpDrli o;()s2trxm3iu1amenlnvtl( arur(m ou0teenifcilt s ra(mo;u0 leoir tatomtrluei s) euoio3oudameelivt s  ruax  ou1optomiciltlmDumumo;u) rtoifcty1lmDelnes;s  2tm(o no1ape  feslt  2rmx o;o0opx ifetat m2rl(vsn(0tltnxocto1fm  luvo;s0 2uo(m ou4apt mnvt t)arra(rono1tlt if3tltls el(vs;(0 rtnif3tytoaD  iei;t trur(o3iy4lm emnesltfa2tru p;u1opeoifetls m emnmsn()treoxoctotfaDr ieols  2xoxopoy4olt mfesl(fsDur(moot0apx iictysfaDrlu o u4 lenmr3oodlm  luei ()srum(r ny1omte fcil(f Dtr( pnu1teeoifciatla2em( o;u0tetnmr3oytlaDeluei;t)srxr(opiydlm   fcil(f rtmu poo1aee miciadlm emuvpn(4aetoxo3ootoaDr uei t tetm(o oy4lp elnct s  2urur ou4openifctlslaDuan p;t4texomocoatomtelnvilt0 etrim no1aptnmiciltfartmxrpou4aptomiciydlmDulumo u4texnio3oytlmDe i slt)srxo(m3iudomenmfeilt sDur(  ou0tpxomfetys sDua(vp t4 reoio todfm rln o;(  ruo(o3oo4oltemnctls a2urxm ;o1openmo3ildlaDuau p ()aexomo to1omteauvsl()s2trio3iudlpt mnesl()aDrm(moot1aeenioeiatlmDrmn onu4 lxnmf3oodfm e i s ()s2umio3oy4op  miesls)s2rmx  ot4tle iieildlm2eauvs t4 rxoxo io1fatr n o;()srtoir nodlm  mivtlt a2tax pnt1tpxn fctadfm2eln onu0teenmr3todlaD li i;t)teurxm io4lpte icia() Drm( pot0tltn iciadls rlump u0tltomo ta1lm e nes;s  exr(rpou4al   fei (f ruaxr no1oexn f3iyt a el(mp;u)aexoxo3oy1fa ean i (0s2tmim3oo1ap nlics (fsDtauro;o1ale mo3iyd a2eluvo u) lxoxf3tadfmtr i olt)srxrio3ou1lp n nvs tfs2ra(root0aexn fciaslsDua( o;t0 eermfcoytfmtr nei t) exmiopoo4aptn ivta() Drmurpot0alxomi3iad mDumnvs t4treoxocoa1opt  ivi t0setriopiu4aptn ieils)srumx  nt0tet  ocils a2eanvp;u4alenxf ty1faDeln ol(0s2urio3nodlmt  fct t)aDrmu pou1tlxnii3tatlmDul(vp t)tlxnmocoa1oateanei;()trxr(mpoy1omeemivsa() rtr(ront4tlx if3iyd m ea( o;t)aleoir oa1fpDeaues ( setoir3nu4omtemncsasfs2tm(ronu1olt io3tatlsDel(mo;(4 eenmf3iodopDe ivslt) 2trxr3oo4omt  fvia(fs2raur ;o4opt io3iytfaDranmsnt4tltniociytop e neo ()texoirpiu1ll nmfes t)sDrr(mp;t1opxoiocils mDumu sn(4artrxo ootlpD luvils0truo(o oy1lp elneslt srrr(root1tleomiciyd a ulu p (4tltoir3oo1lp e nvslt seumxopio4olen fvils aDur(r ;o1texnioeiad mDuluvpn(4altoir3tatlm   u s;t) eum(mpoo1lpt livt tf rrm(  ;o4teeoiieilt s eluvp (4altrmo3totlmDrauvo;s)trxmim3io4ll e icta( sDraxm no0alxnmfcildlaDulums t4alxrmr3oatlmDr ies;s0texmirpnu1llt mfetlt a2trurono0olt iieiydlsDea( s (4 exomf3ta1lpDelueo;t) etrxrpoydll emicslt s2rr(r ;u4aptnmictytlmDeauvon()aleoxo iatopt li ils srtoxopny4ll n ici (  rtrxmonu4tet  i3tyslsDrm(mo;t)trtrmocia1opD  i o (  rtoirpno4om  mfesltfaDur(mp;u4oltniocildfs rlu s t0tetoio todop eaivi s) rxoiopiu4lpte fetlsf rtr(  oo1alx mo3iyd s raumo;u0 lxnmr todomt auei s  euoxo nu4al   ict t)s2ur(  ou0aexoioctad m2eau onu4 leomrcio1lpDeanvslt srtr(o3no1al nmietl( a2ra(rp;u1tlxoiieiyt s emn onu0 rtrmo oydfpt aies;t  rurim ou4lle mneil()sDur(roou1ole moeiadlsDulumo;u4trtoxrctadlmDr u s (0srtm(mpiydlp emneslsfs2tmxmoot1texo ociatlmDraump t4artomr oadoa rlieolt0trurxrpnu1lmenmfvt s)sDrrxr nt0aee mf3tyd mDuanmp (0 lxomo3tatoa raivi;(  rurxm3io4lltemnviltf rrau oot4apxomoeiatlm ua(ms u0teeoxfcty1faDraivi;(  etriopou4ole lnctlsfsrta( p;o1apenifetysfs2umn p;(4alxomo tadfpt aueo;( trto(o3oy4altemfcs s)aDrrx p;o0oleniietasfmDemn o;(0aexnxfctydlpDeauvs;t tetoxmpou1ape mfvslt s2tr(rp;u0alt  i3tytfsDeaumsnu)tlenxo3oo1oaD auvi;t)s2urir3oo1amt  ict ()s2urxmo;t4tpxn oetldlsDumu s t)areomr io1opD  i ol(  euoxr iodoleelfcslt)srra(mpot4aex mfeiyt mDranvon() exrif3oy1fateauvo s0 exrxmpiy4lle  fviatf Durumoot4oltomi3iys s2uln o u) rxnmrcio1fmtrlieo;()sexoxm3no4am elfci ( s2umu ooo1oexo feiasfaDra(vp t4 rtrxo totoa  auvs;t)texrio oy4llt lnvsa(faDrmu p;o0oexniiciad a2ra(vp t) lxrmo3tytomDe uvs;t0texo(r3no1ape mneils) rtax onu0ape mi3iat s um( s;t4trtnmf3iodfp  luvilt0tetm(o oo1omenmici s)s2taxrpno4alx ifeilt sDeauvp;t)aeenio ty1fa raivi (0trtoxo3nudap nlfctlsfsruau  oo0altomictatfa2elu p;(4aeerxociotomtrauvi ( setrxmpiydame  fvtat)aDtaxmpnt4tpenif3iys a eanmo u)arxoxrcoatfpDe nvil( seumxr nydamt lnvt t) 2rrxmpnu1alto f3ilsfs2ranvp;(0 rxnmrctatfmDr ivo;s tetoxm oudal  mnetas arum( pno0alenio3iadls ra(vs t) exomr totfaD  nes t0t2xr(o3ou4opeelneslsf 2uaxroot0ale if3iysfmDem( s;u4 rermoctydomteln o (0trxrim3no1olt mnetl( srrm(rpnu4tltomfeildla2rl(monu)trxrmoctydlp rli ilt)t2umiopoo1lm n fesatfaDumu ooo1tetomo3iadfsDra(vo;u0aetrxr tytoa elieo;t0seumio iydomenlfvs (f 2taxro;t1alx  oeildfsDeau p (0tlerxociytopDelieo (  etrxr iu4lp  lfvi ()a2rr(  ;o1oee io3ias a2rmnvo u)arermr3ty1faDrluei t0 rumxr iodoptnmicsa( sDumu  no1oeeniieiydlmDulu pnu4texomr iatlp e uvo;t0 2xoirpio4amte feiasfaDum( pnu0alx  f3iad a2rlump u) lxnmo ty1laDr nvilt0seuriopiy4lpt  net (fsrtau  nt1tee moetldfs uau o t0alerxf3iydlat  nvsls)t2tmxrpoo1ll nlfeta(  2taxmpno1apxnmoctls sDulnvp;u0alxnmo oytfaDe neolt)t2xoio3nudop  lfctls s2trurpoo4opto i3tltfs ul(ms;t)trxnmf oydlat an s (  rur(mpno1omen ici s)s2rr(  ;o4altnmietatfmDemn p t0 lerifciydlmDrli s;s0teumxr3iu1ape lncsas) rtm(rpot4tetnmoetadlsDemumsn(4 etnxfcto1omteauei;t)setmxm3ou1al nlivia(  2rm( onu1optomfciasfsDum(vo t0artomr tadomDelivil(  rurxm iodoptn nciasfsDrau o;t0alt mfciltfa2el( p u0texoxr3tatoaD an o t)setmiopiu1op e ictas)aDtrxr oo1opt moctldfa2emums;u) ltnxrcoodoate u s ( srxmiopno1alt lncsl(  Dua(mp;t0tpenioctlsla2emu p ()alxrif3iytop   i o;( tetoxr nodll  lneta( arua(m no1tpenmoetatla uan ont)tetoxo tydopt  ueolt)teumxo nudlpee fcia(  2uaxr nt4apx  ieiltlmDuanmo u4 rtrxo iadop e uei s s2ur(m3oy4ame mnesas)arurxmpoo4opxomfciyslm2emnms;u)alxoifcta1opteaivolt)t2xoxopoudalte ncslt  Drax poo1oet  ociat a ean ont4teenmf3oatomD  ivols)srxm(m3nu1lm  lfcsatfsrrrxr nt0tpeoioeiyslm2rluvpn(0tltrxrciatfm  lnei;t sexo(r3iu1ol nlfei sfarurxmoot4oltoiiciatfs2ua(mo;u4tlerxr3iotoa  lu sl() etmir ou1apeemfci s  Duau pot0tlt ifciad mDrlnmo;t0tleoif3oa1laDeanes;t)sexr(mpoo4lle micsat aDumx o;o1ale mietldlaDulnvo (0arxomf3ty1lmDelnei t0 etoxrpny1opte nvtas)sDrrx oou4tee mieiadlsDumnvp (0 etrxr oa1opDrlivils texmim3iydol e ieiltfa2rrxmo;u4optnmfctyslm ulnvs (4 exnmo iydfmDrluvi ()t2trio3oo1lpt lici t)arrmu onu0opeo i3tlsfs eau on()alxrmfcoytfmD livsls  2xoxr iu4ap e net t s2rm(r ot4aet  ietld m ean o;u) reoxf todlp elu ol(0srxrio3ou4om   ncslt aDrr( pot0oexnioeiat mDra( o;(4tlenmr tadlm  an ols) rxm(mpiudaltn icsa(fsDuru pno4aetn ictysfmDuau p u4 rxnxo3oo1lp r uvslt trur(r3nydapen ivs sfaDtm(r ;u4apxn i3iat sDraumpnu0texoio3iytfpt  n i;t t2xr(o3oo4ol nmfesl() rta(ro;u4tetnio3tyslm rln p u4 etnmociatop raivs;s)trxoim3oo4lme lfeilt  Dtrx ooo1tpt mf3iatfa2ua(mpn(4 rtnmr iadop  anvo ( s2trio3ny1ame  ivtat s2tau pot1oee mi3tlt a2raumpnt)trtomo ta1fa r n ilt setoimpoo1lpenmietl(faDtaumo;u1tpxn oetat mDeaumo;u) renmfcootoa eln i;(0s2toio3iu1op emneias)s2rru  nt4tpeoifeiasfaDrl(ms (0alxnxo oadoptranei;t srtoxm ny1op   fciatfartmu o;u0olxoiiciyd s2uln ont)trxnmr totlp  aivolt0 rto(r nodome  fetas aDuax  ou1opt  o3iydlm emu onu)arxomrcty1fa  lnei s)s2xo(m3no4olenmfvsasfs2raxm ot1openif3ilt aDel(ms t4trxoxr3ta1laD anvo;( s2uo(mpoudlm  mfvil(  2rr(  no0oleoio3tltfaDrl(ms;(4 lermo3ootom ean o;(0trxr(opnu4openmnvtasfsrtrx  ot0tlenmfetyd a emu pnt)tltomf3oodfm e n s;() 2xrxopnu4amtelivil()s2umx oot1altoif3iyd m elnvont)alerio oo1fpteanvo t s2uoim nu4lm  miet ( sDuaxr ;t1tptnmieiytfmDemnvs (0aetnmf oadoa e uvi;t trxrio oo4lpt lfeils)aDurxrp;t1oleo iciat s uauvp;(0tlermocio1fpD luvo;t  2xmimpnu4omenmivt sfa2um(  ;u1aleo iciadfs em( o;t)artnmrciydfmD lu slt  rtmirpou4ol nlnetltfaDtaxm no4oltomo3ildfaDrl(vpnt0 rtrxr tytfpDeaivs;(0 2um(opiu4llenlictl() Dur(ro;t1apt  octldla2ra(mp;()arerif todopDeanei;s0sruoxrpny4lltnlivta(fa2tmumoou0ape  i3ildfm2eauvo;(4aetnxo iytfp r nvi t)t2urxr3io1om   neta() rraumpnu1alto o3iysfs2eaumo u4 exnmr io1om  aueo;(  exmim oo4am emicsl( a2ur(moot4oexnif3ildlsDeanms (4tltnmf oo1fmtelneolt0 exmxm3oo4ale mfvtl()s2ur(mp;o0oex mietydlm ranvs;t)trerxf ia1fmDeluvols0trtmim nudole mnetltfa2tr(rooo1oeto i3tltfaDua(vpnu0tetomr3totfa eaneo;(0srtoio oodoptn ivilt aDtaurpnt0teeo ocildlm2uln p;(4teenxo ootlmtr ues t0trumir io1al  mictl(  Drauro;u4tetn ociys m2umumo;t0tlxoxo iotomD ai s ( srxrxopiy4openlfesls)aDrmx p;o0tex  feiatfm ea( p;()aeeoio ia1lptr uvol(  etmirpoo1lmen ncilt srrr( o;t0oeen oetlt aDrlnmo t4 ltnxf3tydfmDelnesl( trxrir3oy1apenlivi ()a2tau ooo4oeeo fetytfaDem(mo;u4 rxrxf iydfm  an o ()seumxmpiydope  fvias aDuau  ot4tlt mfctld m2rl( p;()aetnmo ia1lpD lu s ( setrxm3iy4op elnesl(faDra(rpno0tlt mfetydlm um( pnu0aexoio iatla rlnes;(0trto(o3nudamtelfesl(f 2urumont1tle  ictys a2ua( o;u)tlxrio3oy1fateluvsl(0teum(mpnu4amenmfcia(  rur(rpnu0tlx mf3tyt mDemnvon(0altomociytlmDelueo;(0sexmir nydlmtnmicsl(f rraxr ;o1opt mociyd m2ul(vont4texrif3iadfa   neslt teur(o3ou4ap  mfci sfaDraxrp;t4oeen i3iadla2eanmont)alenmocoa1lptranvi;s  rurimpiydamenmnvta()sDtm(mpou0alen f3iydfa umn ont0 lxrio to1lmt ai s s) 2uriopnodlpte fvt (fsrrrx  ot1tlx iiciatfa2rluvs u0aexrmrciatomDelnvsl()srum(rpnu4lmtemnci s  Dra(m nu1opeoiictydlm2rauvs;t4 lxrxr oo1lmD lneslt0srxm(m3nodop e nctl(f 2ua(  ;t1olxo feilslmDuau snt4alxoxfctytoaDelu olt)tetoxmpnu1alenlieta(fsrta(rpot4tptoio3tld m2eaump;t4aetomf io1fpte ivo;t) etr(o3iodalenmnesat)aDtm(moou0oex  o3iys sDrl( o;u4 etnxr tydom  ln o s texr(r3iy4om n icias sDrrum nu4oeeomocilt a2elnvs;(0 eenmr3todlmtrlies;t  2xmio3oy4lm nmnciasf Dumu  no4opt iictlt s2em( on(0 ltnmf3tydfaDr nei;(0seto(r3iydllee fct s  Dtrx pnu4aeenmf3iyslmDeanmsnt)aleoxociatoa rlieo t)sruo(r iudale micslt srum(rp;t0tpxoioeias sDeluvonu0 leoioctotom  anei;()t2um(mpou4ll nlivi ( arrm( p;t0olen ociadfaDrln on(0trxrxrctodfa rau s t0teumir3io4aptelivs () Dumxm nt1oetnmf3iatfs ulu ont4trtrif3oytla eaues;(0 2umxo3nu1aptemieia()s2umx ont4aetnifetydfaDumu s u)tlxoxo tadla eaivs;s0t2xmimpiydapeelfet (  2rrur oo4altniictld m umu snt4tetnif to1lm   nesl(0 exmimpnydal eliei tfa2rmx  ;t4tee iiciatfa2ua( onu)arxnxr3tydfaD  uvol(  rxo(r3iu1ape livsl( artmumpno4apenioetaslaDrln p u4 etrio ootlaDr u i t0trtr(r iy4lmee netl(fsrraxrpot4tex  i3ils s ulnvont4aeerir3oy1om rlu o;s0trtm(opoudlpenmicta( sDua( pnt4apxoii3tldlaDelump (4texnxrcoytlm ean olt)srxmxopou1lmen nct sf Drmu ont4teenmoeiatls2emu o;t4tleoirctotlmDeln sls0sexrxr nu1ome  nesasfsDtmump;o1tee mocilsls2emn onu4 lxnxocoy1optelnvs;t)trumio iydop emneils sDrrxrpnu1aleo ictas m2rlumpnu4artomocootlmtrln i s t2xo(opnudapenlfvslt)sDrrum nu1oltomoeiydla2elnmsnu)aeenir iy1faDr iei t)s2tr(rpnudol   nct t  Dta(r ou4oltnioetydlaDrm( s u4tltrmrcoodlaDeanvi;(0sexm(m3oo4ap n ieta(  rumx  ;o0tptnmf3iadfaDel( s u0 rtomfciotlaDrluei ( s2uriopiydole mnvs sfsrrrxmoou0opxoifctlsfaDum( o;u)tlxnmf iy1faDrln s t trurxo3oodll n fcs (fa2um(m ;u0tle if3iys m2umnvo t0tltrir3to1oa rauvil()truoio3no4lpenmnetlsfartm(ro;o0oleoiieiadfsDrmu s u) leomo oo1oaDr u o t) rxoxopiy1opeelietls s2rru ooo4olen feiat m ulnms;u4trtnxo iytopD lneslt) rxrio nydopenmneta(  Durx pnu1open ieiyt m rl(vs u)teerxr3ia1opteln ol(0t2xmio iydllt lfvi t  Drmu p;u0olenioeiasfaDemnmo t)trenmrciadlpt lneslt)srumxm3no4ll emivi (faDurxmoou4tetoii3tytfm elnmonu4aexrmfcoytlp eanes s0 2ur(mpiy4lpeelfcslsf rrax o;u0aex iiciysfa eanmsn(4arerxrcty1fpt  nvo;t0truoimpiy1al nlnesas) Duax  no0apx iiciydls em(ms t) eenxf iatlpt lnesls0s2uoxm nu4ap n fcs ()aDurx  oo1apt mf3iadls2uauvp;(4texnifciatfa rai sls0sexm(o3nu4lm  mfvi s)s2taxmp;o1tlt iicildlsDrmu s u4tlxomr totomt luvols  2xm(m3nu1ol elics ()a2ua(roou4tpt ifcias mDel(mp () eenmfcoytoa  an o;t srxrxo oo1altnmnvtls)aDtr(m ;u1tpt  i3iysls2raumsn(4aetomocta1oa  luvi s)srtrxo no1lpt mnvil()s2rrxrp;t4aeenmfeildlsDemuvp;t0alxnxo3oadfpt aneslt)setoirpio1omt mnvi sfarraum ou0olxniiciad m ea( p t) ltoxo3todla raneilt)sexoxmpoy4apenlfviat sruaum no4apt mfctldfa um( o u)tlenmo tytfpt lu olt)texo(o iu1ap emivilt s2rrxm ;u1ale  fciydla2uauvont4tlxnmrciy1faDeaueslt0texoxr3ny1ll  mfvi ()a2trumont1aptnifeiyt sDrmnmp;t) lxrmr iotfpD  nvo;s  eumxm iydlle  nvtatfa2rrxrpno1tltn i3tadla2rmnvp t4aexnxocootla  auvsls trtm(mpou1am e ivils  rur(r ;o1aleo o3ilsfmDeln p t0teerxo3oatlmDeli s t0 eur(m3ny4lpe lfcsas s2rau pou4opeoio3iadfsDrlnmont)aexnxoctotfmDelieo;() rtm(rpnudaltnmfvtasf 2tmxmpnt1oeeo i3tysfmDem(mpnt0 eenir iotfatraivil(  rtr(mpoodlpe  iesls)sDur( pno0oex  fctyslm2emnvp;u0aetnir oa1omDrau ils0srtoim3no1opeeliviatfs2rau  ;u1texn oeildfa2emn p;t)artnir3ty1fp elnvs s texmirpiu4am  mfviasfaDumumoot1oleniiciadfm ul( p;t0altomr iodlm elu s;( trumxr oydam  lictlt)s2tru  nu4opx ii3iadfaDeluvo;(0trxrxo ty1latrauvols0srtrxr3oo1ole mietatf Dtau onu1apxn oetadfaDem(mpnt) exnxrcia1fptean s;(0t2xoiopoy4ll nmfviat)s2trx  ;u1altn i3tadls em(mo t4 ltnxo tadomtr uvsl()trtmxm oo1lleemivi ( aDra(mp;t1texoiieilslaDel(vp ()treomo iadlp   ivs;t0 2ur(o no1amenmivt ()a2rr( oot1teenioetysla2rlnmo;t4tlxoxo oy1oaDr neols srurio nudol e fvia( s2umxmpnt1opxo f3tldfs2ea(vs;u0texoxrciydfmt luvils setrimpiydlpe livia(fsDtrxmpnu0teto f3tasfm ra(vsn(0 ltnxr3tatoatelu i t)srum(o ny4omt  ics s  rurum nt1tleoifcilsfm2rlnmpnu0texrioctytfptelies;s0teto(m3nodll nlfeils sDrr(m nt0tpt  i3iyd m2ean snt) rtnxf3iy1oa rlu s ()s2tm(rpou4ole mnes sfs2rmumpou1ope if3iytls em(vp u4trtnmo3ootlmtrlieo;s s2um(opiydllt mnesls)a2rmxm oo0oeeomieiyt s ranvpnt4altrmo3io1fatr u olt trxrxr iy4ol   fes s) Dua(mooo0tee io3iysla2eau o (0 ltrmfcio1opD  i o t)tetrimpoodlltelfvt t)artm(rpno0opx iociyd m2rmums (4texrmr3iydfmt  ieo s trxm(rpoy1lm nlfviat)srum(mp;o1tpxnmfciysfaDeln s u)aleriocta1lpteaivo;s) exmxm3oydoptelivi t)sDtmxrp;u1texnmictatls2em( s;t4tlenmrcoydomte neo;t  eur(r3no1ap nmncsl(f 2ur(ro;t4aetn ieiydfsDrl(mp (4trermr oatlate neols)t2umxo3iy4openmietl()sDuaxmoot4oee ifeils a2ul(mp u4arxrxo ta1op r u o t  2um(mpnu4amtelicia( a2rrum no0tpx mieilsfs umuvsnu4 rtrmr oodlptr ieols t2umxr3iodlpt mivs tfsrrmxmpou4alxn fetysfm el(vs t4 leoxfcoodlpDeau ol() 2tmirpny4olenmicilsf ruaurpot4tpenio3tas m eauvs (0teeomo3tytoateau i ()sruo(o io4am  lneslt arum(mo;u1teenifeilt a2ea(vp;(0trxomo oadomte ueol(0seurxo3iodape livta(  2tmxmp;t0alxomf3tydfs2eauvpnt0tlenir tytop eln i;s0seuo(o3oodomenmieil(faDururont4oex mfcild aDelu p ()aexnmocty1om  ai i;t  rto(r iu4omenlivilsf 2rm( poo1aexomociltfs emnvsnt4aeenif to1faDraivs;(  2xmxopnudalt lfet s)a2rau p;u0olto feildlaDrl(msnt) leoxrctodlpDr uvslt0setrxm3oo4lleemfvsl(f Dumx pot0alxnmfcilsfmDul( o;t4teeoif iydoa rliei s) 2urirpiudlptnmfeilsfs2tr(m ou4alxnmfcilt a rl(vs;t4teeniociatlm r uvi;s0 2to(m no1lmtnlfvt sfarumurono4apenio3iasfa2rlnms;u)trenmf iatoat  uei;t  rur(mpio1amen ncilt a2raxmont0alx mo3ildfa2rl( o u0tetnif tatlpDe n ils0 2tmirpou1alt mnvias)sruax ono4tptomf3iatfs2emn snt) rxoio3io1faD  n s (0srxrxo3oydlmtnmncilt)sDtrxm no4tlt ioeiytfsDua(ms;u4tleoxo3oa1opD aueils0 etm(m oudaleemnvsas) rra(mp;u0teenmoeildfm rln p;u0 reomo ia1faD an i s)trur(m3iu4lp nlfcia( a2uax poo1altn feiad mDua(vsnt4areoxrcta1lmDe ueols)trum(o nodlme lieiasfsDtr(r nu4ole ifetatfs em(vsnu) eeoxo3ta1lpt li s t0 rto(m io4ape  ies sfarrax oot0ape  i3ild mDrlu s;(4tlxnir3iatfpDe ivi;()texoim oy4ll   fetat)artrump;o1oltoiicildfa2ua(vo;()aeermoctadfm elueo s0srxoxmpiydop e nvi s) 2rax  nu0tet if3tadla2rmn s;()tleoirctotomD  ivslt0srxo(m3iu1llen fvi s) 2rm(mo;t0tpx io3tld mDrlnvo;u4aexrif3oa1opDeli o;s) rtmimpnudom n ivt ( srrru o;t1tlx mieiatfm2eln pn(0 rtrirctatoaD lnvs t) 2umir oo1lmeemies t)aruaum nt4tltoiiciyt m2uan s;(0 ltoio3totopte uesls) rxmir3nu1ll emivtlsfarrmxm ;t1oexn fciadfm2ean snu0tlerxrcoytom eln s;s0t2toxrpiy1om emneiatf Draxrpnt0oexn o3tysla2uaumo;() rxrir iodla  lnvo;(0texoim iu1lmt  fcsa( arrru  ;o0opeomfctatfsDea( snt0trermr3oydlpteau sl(0 rto(o3oy4ome miesat s2tmump;u4aleomf3ilt s elnvo (4tlenmf iotop eanvi;s)sexoim no1lpt mfetlt)sruru onu1oltnifcils m2rm(vo;t4 rtoxr3iy1oatrlnvi;(0 eur(rpiu1lme  fesls artrxmpou1opxnmiciadfsDemu ont4aeeoxr3oy1oaD aieol()trurio nu4lpee icil(fsruaur nu0apeoioctydfm rm(mp t4arxrifcoo1faDeli sls)t2umxo3iodamenmnctat  rra(mpou1teeoifeiatla elu p;t0trenmo oa1fptr u il(0sexrxr3iudal nlicia(fsrua(m oo4apt ifeiatfsDuanms u4alxoxr3oytlmDe ivs ()srumimpoudole  ies ()aDrm(rpno4aexomocildfa2rmnvp;(0 etnifcoy1lpDelivi;s) etrim3no4omeemivs sfs2trxr oo0aptnmieiytla2ua( p;()altoifctatlat anvs;(0t2tmxo nu1lme lnesls aDtr(mpou4tpenio3iaslm eauvpn(4 ltomo iodop r iei t0trtrio no4olen ivt sfa2ua(mpnu1optnmoctlsls ea(vp;u0 ltnifctydfat aivs s0 2xrio3oy1am   fci s  rumxroou4ale mietld a2rln s;t0 ltnif tytlpt  iei ()tetrio3nodom elicsas srtmxmpot1tex mo3ilsfsDrmu pnu)altnio oy1fatr neslt0t2urxo oo1amtnmiet (fs2uaum ot4opt io3ilslmDrmnvp;(4teerir tytfpt  uei s0t2xmxm no1lp  mnvtat a2rax o;t4oetnif3tadlmDemn p;()arermrciotomtran i t0srum(o nodoptnmneilt  Dtr( p;o0apeomfciyslmDua(mo () rtomr tatomt li ilt  2xo(o iodape mfei s)s2rrxmp;u0aetomictlt mDra(msn(4trenio3oatop  luvs t0seum(m nydlmt  neiatf Dtmx p;t4altoii3tlsfa ra(mp () exnio ootfate ivil(  exr(o3iy1amt lictlt) Dra(rpou4tetn f3ils m2el(vsnu0aetoxr3ia1lp e ueo;s0srto(mpio1ame mfct sfs2rmu  oo4opxomfeils m2uaump;t0 lenmf tadlp rli s;s0 etr(o3iu4lleelfvsl(fsrraxr ot1opt iiciasfs rmumo ()arxnxo iydfpD ai i;t seur(r3nu4opeemnetlt)sDtmx  ;u1oet moetasfs2em( sn(0 etnir oo1oa e uvolt0t2to(o3ny4lmtnlfetasf 2tr(r oo4olx ii3tydla ran p u4trtrmr3todla  ln i s seto(r ou4omtn ivilsfa2trum ;u0apxn o3iasfaDea( s u4texrir3iytfmt luei (0srurxo no1ol e fvs tfsrumxmp;o0oeeo oetlsfs2emn s;u0arerifctydlaD aivs;s0s2trxopiu4amtnlnctl() Drm(moou1tpeomieiytla2ra( pnt4aexniocio1lmDelnes;t seurxmpoy1lp nliesatfartaxmpot0alxo octas aDuanms;u)tetoxrctodlp r u ols s2xrimpiy1lmt micsl()sDtmxr nt4texoioeiytlmDrmn o u0teerxfcoy1fmDranes;t0 2xoxrpiydamtnlivil() 2trxrp;t4tptnmfciytfaDeanmsn()teerxrcoo1faDelu i;t) 2tmxm ou4lmtelfvia(farrrxrpou1olxnmo3iltlmDea(msnt) lxrircoa1fpD  uvi s)t2to(o3ou4amte neil()aDurx  no1tlxoiictltlm rau o;() etnmo3ty1lpDraivs;(0 exrirpnydalt mnvsltfaDtrump;t0ope moeias mDrlumon(4artomfciy1fp  lueol()s2trxo3iu1alt lnvi t aDur(  nt1oeeo ictyt aDrmu snu)aeeoxo iy1oaDranei;s0s2um(rpnu4om  mncil( a2ta( pno0oltoiictls sDeanvsn(0 rtoir iodfa  anvi s) rxoim io1ol   ivt s aDtr(mo;u0tpe ii3tysfa2raumont4trtrmo tatlmt anvs;( trumxr io4apenmnct () ruaump;u0oeenmf3iytfmDrluvo t0tlxrxoctodop r uvi;s0 2ur(m3nydomenlneias)sDuru pot4aexoii3ils m ea(monu0tlxomf3ta1lmDeaiei;s srtmxmpiudalt lict t s2ur(mpou0aee  f3ildfsDrlnvont)teerxf tytopD aues s s2xoirpiudole  feils)srtmu  oo1texnmociltlsDuanmp;t4 lxnif io1opDeaueo s  etm(r3ou1alenlnvias a2ua(ro;u1tpeoifciadfs2eanvsnu)arxnif io1om  anesls sexmir3oy4om  lieslsf Dtru  ot4tpenmfciltls2rluvo;u)trxnmf tadopteli ol(  etrxrpno1alt mfcils aDum(m ot0aptnii3ias aDrmuvo;(4teermf3ty1fmt aivs s0texoim iu1llt  iei t srurumpot1teeomociys a2uanmp;(0aetoxf3oa1oa rlneo s)t2xmxr oudlpee fvtltfarrax pot0olt iociysls2ranvs u4tetnmrcoatfpD  n ilt0s2xrxr3ou1ope  iei t)aDrm(  nt0oex ioeiys m ua(mo;u0 exniociytla eanvo;t0setrxo oydllt  nctltf Durum ;t4tpx  fctydfs2uauvp;t0 exomr3oo1la ranvo;()trtmxopny4amtelfvt s)arua(mont1oee ioetatfs2ra( s;(4 ltnio3io1fmt  neilt  2urxr oydop emnct (  rtr( o;u0oex  i3iasls2rl( snt0alerifcoytla   i sl( seurxo3ou4alte nvt (fs2raur nt4ole ii3iyd s2rl(vo t0 reoifctytopDranvo;t)seuoxo oudlm emfesltfa2tmxr no1aleoifciatla2rmnvs;t0arxnmo tytlpt livo;t t2xrxmpiydap emncsatfaDua( o;u0olt mfctydfsDeau s (4 rtnif tatfaDe neo;s0 exmiopoodlle livtat)aDtru oou4optoio3iad aDra( o (0arenioctotfatraivs (0s2tmim ou1ope mfcsat)a2umum oo0tltomfetldfa uaump u4tlxomf3tadfm e nes;t)texoxr3nu4oleemnvils)arraurp;o0olt mo3iadlm rmn s;u)treoxoctadlatelu i t0 exo(m3ou4lm   ivt tfs2ta(m ou1tle miciyt m ua(ms;u4altoxr iodfaD lneo () eur(m3oudomen fvt t) rur(mo;o1teen ieildfm2ulu pn(0treomocio1fp   ivols) exm(m oo1oltn ies t aruauroou0oexnmf3tlsfaDum( o t4 lermoctodlaD ai o (0t2umxo ou1ole  fciat aDtm(mont0oex mf3tldfmDeauvp ()altnir3oa1lpD livs s)t2xoxmpoy1ole  ncsat)arra(rono1oleo fetldla elu o;u0tlermr3oa1la e nvo;s teuo(r nodlptnliet ()s2rauroou4tetniicildfs2rl(ms u)trenmo ootfa  lues t0setm(r ou1amtnlnvs s) 2raumo;u0tet micilslm2ean snt4aetoxr iydomD livs;s)s2xrio3iydop e ici s srtaump;o4tee mi3tlsfsDum( s t0tlxrif3oadom  an i t sruo(m oydlpe livs (fs2tmx  ;u4apeomf3tadfm2ua(mo (4aeerxrciytfa  li i;t)teuo(r3iy4amtnlnes s)s2umxmpnt4alxn fetltfmDum(vp;t0 ltrxfciodom  livo;s)t2urir no1ll  lnesls  rtaur ;u1aptnmf3tatfmDul(vp (4 rxnio3oodoa  aiei s  exo(r3io4ll emfvtlt) 2trxmp;t0oleo f3tldfs2ranms;u0trtoxf3to1lp eanvils texrxrpnu1lmee ics s a2ra(m ;t0alt  f3iaslaDrlnvp (0 exniocoatoa   i sl( texm(mpio1alenlfci s)sDrauro;u4tlxn fciatfmDrau o;(0tltnxo oadom ran i;t0s2tmio3io4olt mfvsl(f 2rr( pot0oet mieiytfaDulu o (0trxniocoytlmD lueo;()t2uoio nu4omt mfcsa() Drm( poo0oeenif3iytlm ulnvsnu4trenircoadoptean sl( s2umim oudol   iciatfs2ta(monu1tltniociaslmDuanvo t0 renmrciotlm e nvol( s2uo(m nu1opeelfeiatfs2ta(ronu0aetoio3iatfm uanvp t0 exnmoctadfpDe n i s)t2urim ou1lm  liesat sruaxr ;t4opt ioctldlm2ra( o;()trxrircoatfateau s ()sruoirpnu1ap   ncsls)s2ua(rpoo1olxn ieias m2rm( o t4tltomf iatopt livs () euoxr io1lp emfcia(f Dum(roou4tet  ociydlaDrmu onu4 eerxf3oa1fm  anvo;s)setrxopoy1ape lictat)s2tru o;t4opxo oeilsfaDrm( p t)tlerxf oadlpD  uvo t s2xoio oudlm emncsls srumu pno1olxo oetlt m el(vs ()trtriociy1lm eauvi t0t2xo(rpnu1omt lfetlsf rum(m ;t1aetnmoctysfs2elumpnt)aexoiocoadlptrai s t)srtoxo io4ll nmnvslt s2tmxr ou0olenioeilsfsDuau o;u0 etomf tytlate iei;s s2xoiopnudape mncsl()aDtmu onu1tlen ietydfm2em(mo (4 reoiocty1lpDean s;t)srtr(o nu4ape mivsltfs2rmxm ;t4oee  ieiatla2ea( onu4trxnio3iodop eln ol(0 rur(m nudol elies t  rtauro;o4tetnmoeiadlmDranvp;t0 exoifciadomtr n o t0teumim oo1amen fvi ( s2umx pnt4olxnmfciyd m2umnmonu0altrmr3oo1optrlneils0tetmxo no4alte fvils arururpou4tpxnmieiadlm rau p t4alerio3tydomDr ieo;t0 rto(mpou4llenlfeias  rtm(r ;t1texo fctytla rlnvs;()tltrxrcoa1laDr i o;t t2tmxo io1op n nvsat)a2ua(m ot1openiietatfs2rmumsn(4trtoifciodom e nvo (0 2toxr3ou1apt lfvtat)a2uax  oo4oee iocils s2eluvo (0tlxrir3ia1omD  i i s0t2trim3iodape lict t sDta(mpno0tpxniieiyt s eln sn(4arxrxo3oadfmt li o;(0 2xmimpoudapt  feil(fsDumxmo;u0oetniicilsfa rlu pn(0 exrmocio1opDrluvil()s2umio3oo1lpe mfvtatfsruru onu0aeeoiiciydfa raump;(4tetrir3iodfpDr nvi;t  2urimpiy4alt  fvsl( a2tmum ot0tltomfciyd aDrmumpn()artnxrcoatlp  ai slt0t2tr(r3io4oltnmnvtltf rta(  nt0tpxn fetad a um(mp u4teeoifctotopDean s;(0srxmirpno1lpte ncs tfsrrrxmoot4tet mfeiydfs2uaumpnt)alxnxo3oodop ranvi;s0tetriopiy1ape mics ( sDumxr no4teto feiadla2rauvo;u0 leoio3oydfpD anvs t)t2xoim ou1lm nmnct (fa2umump;t1ope  iciasfa ulnvs;t0artnif3iatlp eanes;s0setr(m nydlmen fcs s)arrmxrp;u0tpenmf3iys a um(ms u)treoxf3iytfa ranei t  eurxm iodal   ivsa()s2umxrp;t4tleo i3iydls umn o;t4tltnmo3ia1omDeaueolt t2tmxr ny1lmenmnetlt)sDrm(r ou1aexnmoeilsfmDrm( p t) rerxociadla   ivo;(0 rurio3oy1ol eliciasfsDur(r nt1apt  f3tld sDum(vsnt)arxrioctadlp  aivs s0seur(o oodalenmnvilt  rrrxm ;t1tpxnmieildfa2rmu o;u) rxnxr3iydlmtrai sls0tetoimpoy1lmen nes (  rrru  nt0tpx ifciyd a eauvp;(4 lenmocoadfa  an i t0 2xrxrpnu4lmtnlictlsf Dur(  ou4ale  ieiytlm ea(msn(0tlerxr3oa1op rluvils0t2tm(mpiu4oltnmfct s)s2taxrono1tlt mfeiysls2emu s;u0trenxr totlpDr n s;s0trxoxmpiy4ll emncil()s2ururo;t1opx mfctyslm umnvs;u4altoxfcoa1fmtr n o t0 exrxo3oo1apeelivt t aDtmx pot0oltoif3ildfaDeaums;u0alenir3tadom rln i (0 etr(r3ou1omtnlfetltfsrtmumont1tlxnii3tld s emnmp;u)tlenmfcoatfpDrlueo;t)t2uoir3ny1apenlnvils artau ooo4tptn oeiys m emump u0tltriocty1lpDrlivol(0 2urxm3nudamt mnet s) rtr(  no0opxomf3ildls2rln o;(0aexoioctydlmtr uvi;t)s2xo(opiy4omt lictlsfartrx  ot4oee ifcils mDrluvonu) exoiocty1oa e u o;s)t2urir3oo1al nlict t)s2rr(  ot4oleniociltlm emu pnt4texriociydoa rau ol(0s2tmim3oy1llt lfes t  Dua(r oo4tpx iieiytfs rm(vo;u)aeeomr iatfmD lues t)setoxr iudap   nesasfsDtmu  ;u4oltomi3iasfa2rlnmo t4 etoxf ty1fm r uesls0 rtoxo nodame  nesasfaDtrur ;o4tet mfcildls2rlumpnt0artomo io1fpDeanvi t  rxmim iodlmtn ivsa(fs2rau ont0tpen icild mDuln s t4 etrifcoydom e u s;(  rxr(m3ny1lp   fvil(  rurxr oo4aet ifeiasfa2elnvont4tlxnif iy1faDe nvo;s)srurim nodopenmncia() rra( onu0olxomfeiltla2umnvs;t4trtomrcio1fmDraivils)t2urir iodam e iesa(  2rru ooo4tlxn i3iat mDuanvonu4tlermociatom rai i t)t2xmxm3oodamen ncia(fa2ua(mo;t4tpe mf3iytla ua(mp (0tltoif tatla r nvo t)setrimpiydlmtelfvslt)s2rr( p;u0tee io3iltfm2um(mo;()aetrio3todlaD ai sl(0t2xr(mpoudlp e fct t sDraurpnt4tpxo fciltlsDrmuvpn(0aeenmf oodfp  lies s0t2toio3nu4omtnmicsa()sDtax onu1tpt miciatfm2elums t0altnmf3io1omtr nvslt)seuoim3oydale lici s) rrrump;t0tltomf3tyd aDuanmo;u0artnxr oadomteanvils0trxr(mpnu1lmtnmfcs ()arta(m oo0opxo fctyd s2eau p t4 rxrio ta1faDe nes;t0 2urio3iydapt  fesltfaDua(  ;o4oleomfciltfa eanvp ()alxrifciatfmD liesls0 rxoxopoydlp nlfetlt)a2trxro;u0tltn ieiasfm2umu ont4altriocia1om  lnes;s0seuoirpoo4ap elfvtat srrr(mpoo0ope iociyd m rm(vo;t4aexnio to1oaDean ilt0sexo(r3ou1olenlfcs tf Dumu ont1apto f3iad m elnms t)aetomf3tatop rauei s  ruoir nu1omteliesa(f ruau ooo0texnmociat mDrmn p t0trxnmo todlaDr iei;(0srum(opnudap n nvsl(  2tmuroou0tpenmo3iys s2ulu s ()texnmo iydlpt livi s)t2uo(opnodaltnlnvta()aDtaxmpnt1tpen ociad a em(mp u4trxriocoytom e uei t0 etm(o3iu4op nmnvilt arrmuro;o4apxn oeiytfmDemn p t)teermo oo1oaDr ueols)s2xrxmpio1altn fvt sf 2umxrpnu4tpeo f3tadfsDrmuvsn(4altomr ia1lm r u ol(0trtmimpny4om   fci s  2trxm ;t0tltoiictatla rmnvsnu4 ltoxf ta1fat lues s)s2tm(rpiydaltelnesl()srua(r ou1tetn ieilt mDra( snt) renirctydla elnvs;s)teto(m oy1lp nlfvsa( aDtrxm no1olxoiieiytfsDul( o (0 exomo3oytoaD  n olt  exr(m3nudlltemiesls sDraxmp;t4oleomocilsfmDuan s u) ltrxo oadfmt luvslt0srtrim iy1lmtn nvslt) 2umxrpnt0aexnmieiyt mDua(vpn(0arxrmo3oy1oa  ai s;s0sexoxr3no4lmte neil(f Dtm(r nu0alt mf3ilsfs rm( sn(0teeoxo3iodfate u o;( srtr(opoodolt  fvt s aDrr(m ;t0aleomfctlslaDrl(vo u)alenxociatfp ranes s0 2uo(opiydop e fcil(f Dtrurpnu4alxnioctydfmDelnms;t) rtnio tatlmDr ivi s  rxm(opny1amtemnciat srrmx pot1tee  ociatlsDeluvsnu)tlerio3tatop r ivilt0srtoxm3oy1ap elici s)arrax ooo1opt ifetydlaDumnms u)tltnif oy1op e u i;s0truo(r3oudol  lici ( a2taurono4olenmfeildls ran o (4arxoxr3iydlpD aivs (0trxoxrpiy1lp e nctat a2tmx  oo1tpt moctatlm rlnmpn(0tetoxo3ta1lpD  ues t0srxo(r3io4ol elnvs tfa2uau ont0tpxnifciaslm rln o u)aeeomf3ootoaDeaieo s) 2tm(o3iy1apteliet tfaDtm(mpnu0opx mociatfa2ra(monu4alxoxf ta1opD li s;s  exmxrpou1al nlnci s)sDrmxrp;u1tlxnmoeiyt m ua( ont4 renirctytfm  ai ol()t2xoiopiy1lmt mici sf Duax onu4aeeoif3ildfs umn o;(4tlxrxr iodfptelnvols0seuo(r iy1ol e neiltfa2ua(mp;t0alt iiciadfs ea( s;t)tltoxr3oa1omt luvs (0seumxo nudlpenlneia(fs2rmx  ;o0olen fctat m rm( p t4 rtoir3oodlp eaueo ()seur(o iudalenlnvt (fsDtr(  ;t1aeeniietld m2rlnvsn() eerirciadom rlieils s2xoio iy4lpt  iviat a2taumonu1oex  i3tyt m uanmp t4arxomo3totopt auesls teuoim nu1lltelnci (f rtau  ot4opt mf3iytfa2umuvsnu) lxnxo oo1laD li o;s0trxmxmpny4optnmfvta( s2taurooo1aeeomoeilt m2el(vo t)treoio3oadoa e uvo ()trurim3nodap  mnci sfsrtmur ot4teeomietls aDum(vp (0artomr tatoa r n i () euo(mpny4alte fesltf rurxm ot0ope mo3iyd m2ranmo ()treoxr to1fm  auvolt sexrir iy1apte icta(  Drrumont4oet  octysfa ulnmon()alxrir iy1fp rln s t teuoiopiydol e ncia() rumum ;u1oetnio3iytfsDuanmp;u0 renxo oadfaDe n o;()trurxopnu4lleemfeiatf Dtmxmp;u1aet  octas aDeaump;t0aexrxrcio1fm   i s;s)s2toxmpou1lmtelivslt aDrrxront0aptniictadla rmnvonu0aeenmoctodlm  aivo t)seumio ou1lpt  ivtat  Dta(m ;u1tee ifeiytls2el(vont) rerxfcootopte ivi t) 2tr(m ou4lle liet ( s2taumont0oee io3iysls ua(vp;t4texrxrcia1omDrli ols0setm(m3iydom  mietltfaruru pnu1aet mfeiyslsDrmu p;t0 lxrmf oa1lmt ai o s) rum(rpoo1am  lfvs tfsrurumpnt4tpen o3tlt mDumu p;t4arxoxoctotlpD  u sl(  rurxo3io1ole  ici t a2urxr ;o0apx ii3tasfsDua( ont4aexrifctadopteln o t  2tmir3oudope mivsa(  Dua(m oo0oetnmo3tytfsDrluvo;t)teenmr tatomDraneols0seto(o oo4al  lfcsa()srtrurp;o0tptn ociydfaDeaumpn()aetrxocoy1opt luvols)t2trimpiu1openmicsa( s2ua(  ou4oltomictad sDrmnvp;u)aetoir tatoaDrlu ils t2tm(opoo4amen nvtl()s2umu  ;t4tlx mo3tadlm2rl(mpnu)teerio3oytla  aivi s0t2xmim iudap e fvilt)aDtm( pot4oet ii3iad aDum( p;(0arxoxr3totop eaies s)trxrim3oy1lptelfvslt sDum( o;t4tlto f3ilt m rlu sn(4tlxnxf totoa ran o;()tetrimpno4oltemfctltfsDrmu  ot0aexnioeiytls rln s t)trtoxfctydom rlu i s) eurio iy1lp elnes (farumu pnt4tpe iictlslsDum( p t4aetrif oo1fa   ueo s)sexm(o iudlm  mnci tfa2rrx ont1oeeomfetldls2ua(mp u0 leomfcty1late ies t texm(opoo4alen fvtat) 2tmxr ;u0tee moeiysfs2ra( p ()tlxoircoytopte ivols0s2xoxopiydlptemfctlsfsrtaxmpoo0tex mf3ils a2eau p t0 lxrifcootfp   nvo t)tetm(o oo1om e feilt)sDua(r nt0tlx ioctatfmDuanmsn()tlxomf iy1op eai slt  2to(opiydom elivtas) Duaxmp;t0tlen ociyt aDrlnvon(0aeenio3tytlat lneo t)t2xmxopno1op emneilt) Durxroot0aet mieiltls2elumonu4trerio oodomte u i s) exo(r oudolee fvsl(f 2tr( pou0opto oeiytfs rau o;u)tetoxf3iatfmteaivo;t  2to(m3oy1olenmieil( a2ur(mono4aetnmieiys a rl( p u)aetomfctotfp   uvslt  exoio3iu1alenmnctls arum(  oo1texnmo3tad m2uluvpnt4aetrifcta1lpD anvs () rxrir3ou4al  mict (fa2tmxm nu4olxnif3iaslm2ea(vp t4teeniocoatfpt ai s s)s2xmxr ou4oltnmivs sf rrrxmooo4aleoioeiytlaDemnmp u)arxoxr iatopt lnvol(0srtrxr3oudap   fcsas  2urxr ;u1oex iociad sDemn on(4texrif3ia1opD li ilt  exrir3no4ole mnei s) Dtru  oo0tlt  o3tatfa2ea(vs t4 reoxfciodfm   ivo;(  rtr(mpiodap n iesas a2tm(rp;u1tetoiicilsfa2rm( s;u) eenxrctotlm  aivsl( trum(opiudole mnet (f Drmu pnu0tpt ii3ilt a eauvp t)tlenxr3oy1omt lnvi;( t2tmxm3ny1olenlnctls)sDraumooo4oleomoctltfaDemnvpn() ltomfciatopDeauvols trtr(opou1lpe  ncil(  Drrxrpot1tpen ietld m2rm( onu4texrxo oydfateanes t0setrir3oy1lptemics () Drm(mpot1oetomi3tyt aDrmu onu) eeriocoytfp e n i t) rxrxrpoydameelfcsl(fa2umu o;o1tlenioeiaslmDuanvp (4arxoxo3tydopt aieol(0t2tmxmpoydape  nvslt)arua(  ot0tpenif3iltla2rlnmp ()aeeoxo todfaDeanes;t0 2xrim3iudomeelnvs s  2ta(r ;u1apxoioctas mDem( pnt0 rerxfcoa1lp rlneil(0s2trxo oo1altnmfvia()srururo;o4alxnioeiat m2em(mpnu)tltnxrciadopt anvol() 2um(o3iydam   nctas artaumpoo4oeeomf3tyd m2ra( sn(4teerio iatlaDelneols sexmxr3iudlm  mfvsat  2ta( ont4aeeniieilsfm rm(vp (0tleoirctadfmtr ivi t0 2uoxopnydaltnlfvilt) rum(  ;u4apxoiieiatla2umuvpn(0texnxfctadop rlivs;()s2to(r3nu4ap e nvslt) rtrur ;o1tpxoifciytla uluvo;()artrxocootfpD  ivslt tetoio3nu1amtnlnvslsfa2um(r no4alx  feiasfmDraumsnt0 ltnifcty1lptraueolt)teur(o nudlpeelfvs ( arra(mo;o0aetniietad aDeanvp t4aetnio iotopDelneo s)setrir oudlp  mnvil() rua(mpno1tpxoifeils a rmn p t)alenxociadla rlu o;t0s2urxmpoodapte nesls)aruax  ;t4tpeo ocils s2ran p;t4trtrmrcoo1lm   uvo s0s2xm(mpnu4lpte fctlt  rumxr ou1olxoii3iatfa2rmumont0 ltrxociodomteli o () euoir oy4llt livi t) Drr( ont0ape mi3ias aDeluvont4tltnifctydoaDraneolt0sexoxr3ou4ll nliet (faDtmxmpoo0tpeomfeiltfmDelnmp;t)artomf3io1oa eanvols srtrir3ou1op  livs sfa2uaxrpno4oeenmoetldfm emu p;u) rerxrcoo1oat anvol() 2uo(m nu1al n fciat)s2umxrpno4opeoiicild a2ra(ms;u0arxoxo3iodlpDeanvs;s  2xm(r iy1omtelfcsasfarraxmooo1apxo iciys s rmnvs;t0arxoio3oatoatrlnvi t)teumxr nu1am nmfvsa( a2trxro;t0teeo i3iadlsDrmnvsnt)texrmo ootlmtrlivs;()t2xr(o3nu1opee icsatf rum(  ;u4tptoifcildls eauvont4trxomo oa1la rlieo s)tetrxo oo1lmen fvt tf 2ra( ono0texn iciydlaDulumsn(4 exrxocoo1omDrauei;s s2to(mpoo4lpeemnvilt  Dtm( ont0tleo oetytlm2rm(vs;t) leomo3io1fa e n s;s teto(r3nu1lm emfes tfaDurxro;t0ole ii3iytfa2uanvsnt0trtrmocty1fmtrlu sls0srumxr3iu1amenlnctl()aDua(r no4aexoifeiad s2ran p;(4artomf oy1opteaues t setrirpoy4aptnmivilt)aDtaum ;o4oexnmoetad a2em( o;t4trerxo tydfptelu sls) etrxo iydlp n nvil(f Dum(m ;u1tle iieiltfm eanmsn() etrir3iotopD an o ()trumiopnudllt livi ( s2urxr ;o4aleo i3ias mDul( o;t0aexnxo3tatlm e nvsls0 2xoim3iu1lpeelnvslt  rrr(rpnu1tleomociadla2emnvo u)trxrio3to1fa eauei;( texoim3iy1lpee ieta() Draumpot1alt  ieiatls2rlnms t0 rermr3iotfa r ivs (  rxoim oy1lme mfvi (  Drrumo;t0aptnifetadlm rlnvpnu) lxnmo3oydfp ean s;( srto(rpou1lptn feta(  rtmxmpot1aexnio3tasla ranmp;t4trxrmfctatom   ivol()s2tmimpiy1lme lfvtas aDtrx p;u0aptn i3ias s rl(mo t0 reoio totoptrlueo;s0 rxoim3nodoltnmfcsa(f Dtru o;u1opxnifciys sDumn o t0tetrmo iodlmteauvsl(0 2tmxm3ou1lpe mfvsls)srtaurpnt4apt mieilslm el(mo t0 rxomfcoadlpt aiei s srxmxopoy1ll elfeias)sruaum ;u1oltn fciad sDumnmo;(0teerxo3ia1lm raieil(0texoxm3iodaptnmnes t srtm(rono4opxnii3tat m rlump u4aetnxo3ia1lptr ivo s s2tmxrpou4ap   nvias)sDrrx o;t1aexn ociadla raumo;t0tlxnmr3oa1omDeanvs;s0s2xo(opoodlpe lncil() 2ua( ono4oeeoifeiltls2em( onu4artomr iotlm r ueslt0t2urxo iy4amenlfeta()arta(mp;u4olxo o3iytfs2elnvp;t4aetnio iadlm  luvi (0sexoir iodap  mfcsasfs2urxr ;u4ole  iciatfm2elu s;t)trxoxrcio1faDraieo;s  2xo(rpiu4lmtemfetlt)s2ua(r ;u1aetnmo3iltlm em( o t4tlerifctadfm r uvslt  etr(rpny1op e fctlt)s2ra(rpoo1aex ifciydfsDran snu4tltrifctodlatr nvi t0s2tmxo iydamtemnctl(f Draxmpot4tptniicildls2uauvont0tlxnxr tytom   uesl(0tetmimpio1oltelivtlt aDrmxronu0oeen f3tytla2emumonu)aetrxrcty1lp elivol()s2tr(mpoy1op  livtl()s2urur nt4alxo ietys s rm(ms;u)treoir3oatlm eau i;( t2xm(o no1ope mnvtl( srrau  ;u4aleomoeiydfs2em( o u4 lenio3io1omtelnvo (0 etrxr3nodlle liciatf Draxm ;u4oltoio3tysls2rl( p;u4altnxrcoo1om eai o;()sruoxm3io1om e ivtas s2uaxrp;o0aleo o3ils m2elu s;u) rxnir3totlpDrluvo s srtmirpnu1ol nmfcilt  Dra(mono4aeto i3iatfaDean s t)trtomr3oa1lpt  i o t sexrxrpiy1lmenlfci s)sDtm(mp;t0olx  fciatfm rl(mp;t0alenmo iadfpD  ieslt0t2xo(opiudopeemivsat a2trx pnt0tpxoii3tat m umu sn() lxrio3ootfaD  nes t seum(mpiodlptelivil(  2tm(mpnt4oet  o3ild s rlu s;t4 reoxociy1fa eaneo;t  exm(mpnu1ap e fctlsf rur(m ot0opxnmfeias mDuan s t0 ltrmr tydlmDrlneo t srxoxo3ou1lmeemieiat  2ua( pou4teeoioeilslm2ean o t0 rermf3iy1laD ai s s0t2xo(o3oodlme lnesls aDra( p;t0tltoio3taslmDemuvs;(4artoxo ta1lpte ueol(0 exoxrpno4ap emivt s  rrrxm ;t0oexnif3iytlm2emnvp;t0arerif ia1fatraues;( s2xmxopnydamt  nesa()aDur(r ;u0opeomo3iydfaDeluvsnt4trtrir tydfpDr ivsl(  2to(m iodom  lfcsls arur(ro;o1tlxo ictltls ulnvo;(0tlxomf tytlpDr u ilt)trtrxrpio4openmietl( sDtmu o;u1tptoio3iaslsDumu s;t)trtnmocootoptrlues t  2uoimpiudalenmfct sfaDta(  ou0aeeomfeiasls rl( s;(0aeerir iodlm e u s s)trtmio3ou4am nlncsltf 2taur ;u4aee mf3iat a2rln p;u0teerircoa1fmDeai o;s0tetmxrpiodoleelfetlsfaDtr(mo;u0oltnmf3ilsls ea(mpnu)arxrxr3iytfpDrlueo;s)seurxo3oy4altnlfvs tfaDurur oo0opt mfctlslmDea( snt4 rtrmf3oo1lpDrli olt)s2uo(rpou1llt lfeil(f 2umx p;u1olx ioeildla rlnvo t4alenif3tatfmtraneolt)sexo(m oydoptemfes s)aDurxm ;t4tpxnmfciysfsDemn pnt0 leoxociydlmtr iesl(0 euoio3nudamte fctl()a2rmxmo;o0olenmieiydfs rlumpnu4alxoxfcoatfa rluvs;s0t2umim3iydlmenmfesas  2tmx oot0aeeomi3tys a elums;u0aeeomo iytlptraneilt)sexmxrpiu1ole mfvt ( a2tm(mooo0tpen oeilt aDelu p;(0 rxnmo ty1fm eaiesls0sexr(rpnudol emnctl()s2um(r nt4opx moeilslsDum( snt4 eenif3ta1oa eln i;t s2tm(r3oo1omt  nvsltfa2rrxrono4aet  ieias m2rmn p;() rermo3iy1lp rauvs t) rxo(mpny1om n fvt tfaDurum ;o4oee mieiyt a2umn p t4 lxnirctytfaD liei s)trumiopou4al e netlt)s2rmx oot1tlx  o3tas a2ra(mp (0arxnio oy1fat ln o ( srumxopio4oltn ivt s)sDraxmont0tpx mo3ilslsDrau s t0artnmfcoatop  livi;(0 rtr(mpnodapt  nvtl(fa2tax ont4ope if3iytfaDelumonu4treoxf3iadop rauvo s  2trxr3oodam nmnes tfsDururono0alxnmfciltlaDea(mp ()trermocio1fm ran o;t s2xoxrpou1lmtemics t)aruax onu0open fcild aDuau o;t0tltomfctydfmt  ivs;t s2xmim iudlmtnlfeiltfa2tm(  oo4oltoiiciytfsDumump;() reomr totfat anes t0 rurxmpnodapee ietltf 2tr( poo4aeenmoetad m2ra( o (0 rtoifcta1fpt ai o t trurim ny1ol   fcsltfs2umx  no0tlxo ocilsla ua(mo u) reomo3iatfat auvi;() rxoir3iu4alte fvil()a2trur ;t4tleo i3ias s ua( o u0alxnxo iatfmDeau i ( s2xmiopoo4llee nviasfa2ra( pot1aexomoetlt m rl( p u) etrmr ia1laDrln s;s)srtmir3iydamenlfvi tf Drrxm ;o4olxoiociatfs2ulu pnt4tlxrio iadop e uvs t)truoio nodlm  lnes t s2tr(rpnu1oleniocildlm2ra(vp;(0trxrxfcty1fatraivolt) 2xrxopiy4op  mfcsa(faDum(ronu0tpxn i3iyd m el( p;u4teermf iytlatran s;()srtoir3iydapt mnctat a2rrxmpot4apt  ieiltla2em(mpnt) rxoxo3oy1fpt auvs;s sexoxr3iu4ol n net s  Draxmpou1optn i3iadfa2ulnvp u)tetoxf3oydfp rai i;(0srtoxm3nydamtn ict ( s2urxront4olxo f3iatls2ea( p u)aexrmr3tydlp r n s;t texmxo3oudlpt  iesat aDtrx  nu4teeomiciadlsDrmnvpnt) eeoxfciotlptran ilt0teumim3oo4apeelfvtas  Dum( p;o0oexo fctasfa2rm(mp u)trtnxr todoate uvilt)trur(o3oodole lfei s)sruaur ot4aexoii3iaslm2uanmp;()aexoxr3ty1opDe u ols)t2trxopno1lle mncilt)arrrumonu1ape mfetatfm ra(vp;(0 rtrio3oydfa   ivs;t)sexoim3oy1openmnes t sruru pou1aptoifeiadla2umu p;() rtoir3ootom r nei;t)seumxopiudapt  fcias)sDtm(m ;o1tleoio3iad s2rmn s;t0texnmr3iotfp e uvo;s setrxmpoo4al emfct sf Drr( pot0tptomi3iasla2rmuvo t)texrxr3iy1oaDranvslt texm(r3oo4omtn fctlt sDum(r ;t0ole ii3tytla2emnvs;u0artrxr todopDelu ols teur(m3nydopeemivslt s2um(rp;u4opeoioetls m rluvp;t4texnmo iytfmDelnvsls)trtoim nydal  lnvta( s2ur(rooo4ole if3tytla2rlumsn(0artoxr totfpteaneil( t2um(rpnu1omt micia( a2rr(rooo0aee  ietyt m ranmo (0aeermociotlat livi;t0 rtm(m3nudoltnmfesat srrmx poo1ale  ieiad s2emnvpnu) etoif iotfaDr uvi;t0 rxo(rpoydlleelicsls aDumxrpno4apenifciltls eaumo t)teerxo iotopDe nes;t0 etrxrpiudape lfcil(faDtr( pno1tpe if3iytfm uanvp;u4 renifcty1op raivo;(0teum(o3iy1opeelncs (fsDtax pnu0aleniocildlm2ea(mo;(4aeerir3ia1latraues ()s2um(opoy4optn nvtatf 2taxroot4ole  ieiyd sDra(mp;(4trenxo3tatopDeli i;s0texmiopnodlle lnesat  Dra( ooo0oee  feiyd mDumums;t)trtnmr3oo1fmt auei;s srtrirpiy4ale lfvi ()aDtm(rpoo0tpe mo3tyd a2uln o;u4teenmr3oytlpt  uei t trtmxo iu4llen ivta(f rumum ;t1oleniietas m2ulu p u) rtrifctydfm r u o;s0srxriopnodll  mfet t)sDtrump;t4aee iiciatlmDumu o u4trtrmocoo1lm   ies;s0 euoxopiu4lle mfvt t  2rr(rp;o0tlx moeilsfm2rlnmo u0artrxr oy1om elu o;s trto(opoo1lmeelivsatf 2rmurpnu1olxnifciaslaDel(vsnt0aeerxf tytoaD aneil(0 rtrxrpny4altnmnetlt)a2trur nt4tpt mfcildlmDumuvp;(4tetoio ootop raieo (0t2tmirpnudll  lnvs sfs2ur(rpnt1tet ii3ildfa2ra(vpn(0tetoir3to1fm  livsl( trur(r3oy4apee ieilsf 2tau p;t0aeeo ociys aDuau p;(0alxnif oodfptr ues;(  eum(m3no4al nlfcsltf rtmxro;t0tle io3iyd aDeanvsnu4teeomf3ty1opDe ieo;(0texrio io4lp e neiat) 2urxrooo1aexomi3iltfm2ea(mpnt) rtnxr todfat lneo;t srtm(o3iy1opt  nvs s aDrrx oou1oltoifetltlm rmumo;t)alerir3ootom ranvs t) rurio3oy1al  lfct (  Dumurono0apxomictatlm2rlumo;(4aeeoxociodfa ranesls0 rtoirpno4al nlnvtas arua( pou0tltomoeilslmDrauvsnu)arxomfcia1fa   n ols  2tm(o nydame  nesat a2trxmo;u4apeoif3iydls2ul( onu) eeoifcio1omtrai o t teurxm3io4ll  miesas) 2tm( ono0tetomoetyd s ul(mpnu0altrmf3ootlmD lnvo s t2toir oo1open nvs ( aDuaxro;u0apxniieiatfs ul(vs ()trxoiocoytoat  uvi;( sexmir iy4lpe lictlt)arraum nt0aexnmo3tldfm2ua( p t)aexnmf3oydfm r ivi (  2tr(m3iu4lltnlfci ( srumurpnu4oltnmiciytls rlumpnt)tltrmoctotfaDrln o s t2tr(o3oodlmeelfvtatfaDua(mp;o4tpeoiociat s2rau o u0tlxrmrcoatoat lies;t0teurim3oo1omeemneilt a2uax ooo4tlt if3tlt s ulumon()tltoxfcoatfpt li ol()s2uoxm ny1al  lfeiltfsDtaxrpou4tltn i3iadfm rl( o;t4 rxoifciadlpDelnvi s)trxrirpnu4optelnvtlsf rrrumpoo1apto ocilsls2rl(vpnu)tltoxo ty1fat  u s s) rur(m3io1lm  mnctlsf 2rrur ot1oltoiieiltlmDrlnmp (0 etomf io1oaDean s;t) rtrir ny4al nlfctls arraurp;o0aexoif3iltls ra(msnu)aetoxf3ta1lmt ai i (0s2trir3oo1amen nvi () Drm(rp;o4apenmf3tasls2ean pn()aetrir tatlm e ies s0 2xoxo3no1al   nes ( a2trxmoou4aetnmoeildls umn pnt4 rxnmr to1lmtrauvs;()t2ur(o3io1omtn fciltfs2rrx p;u1olt moetydlsDrm( o;t4 ltnifctydlp eaueo;t seur(mpiydaltemnvtas)artrx p;t0apxomfciysfm rmn on(0treoif oatfaDrauei;t)teumim3oy1ap   ics t sDra(m no4tlto i3tyt s2eanvs u0trxnmo tydfpDr uvo t0 etm(o3iydale mivtlsfarrr( pnu0olenif3iat m2em( p u0arenmf3oy1oaDrlieslt  eur(o iudalte nvtl()sDtmxmpnu0oltn fctltfa2rl(mp u0tetoif oa1omte uvo ()trurxm3ou1llte icsls artmxmo;t4oee if3tydfsDuluvp u4alxoxrcoytoptr ieols) rtoirpnudlm elfviatfsDumumpou4tpe  oeiad a uluvonu) eeoxrctodlpD  u ols0 2ur(o oodoltnmfvtl(fartr(rp;t1aleniicilsfm umu pnu0tetomocia1omtr ivi s0 rxo(o oodol n fctls)srrau  nt0oleoif3tltlm2rmump u0tlermf oatopD liei;( seumiopiodaltnlfviat aDur(mo;t1oltoio3tlt s2ul(vs u4 eenxr3tydlp   n il()tetoxrpiydlme livi t)srtaum no0olxnmf3tys sDuanvs ()alxnxfcoo1omt livolt) rxmxm3oo1al nlivt s)a2tr(mo;o0tlxoio3iyd a2rlnvs u)texnxociydoa r ueol()s2tmim oy4am emnctls srtmx ooo4tpeomfciydla ean s t0alxnmr ootfmtrlueolt)sruoxo3iy1lm nlncs t  Drmx poo0aeen i3ild s2uau o;t)treoxr oo1opt an o;(  rxr(r3iu1ap nmfeias) 2rrxrpnu0texn ocild s rluvp t0 ltnxocio1fa raueils) 2trxrpio1lpt lnvsa( s2rrxrp;t4teeniociatlaDel(von(0 eermf3oytfatr nvo;s seuriopou4lpe mnetl()s2rrxrp;o4oet moeiys sDeauvo;()aetrxo3iadoat  uvilt srxr(r3io1lltelfvtltfaDurxrpot1tpeoioctltfa eln onu) etniociy1op  lnvsl()tetoxm no4altemfcsl( artmu  ;u1oleoio3ilt sDuln s u)tltrmocty1fpteaneils0s2to(r3nydllt  nctasfsDum(root1alxnmi3iltlsDum( p;(4teeoxo ta1opDraueo;(0trxm(opou4omte ivt t sDurum ;t0tle mieiltfm2ua(ms t0 rxomrciotfatrln s (0 rxoio iu4op emivsa(fartmxrp;u1oet  o3tys a2ra(vs;(4 exoio oa1lmD luvil(0 euoxm iy4ope mnvsat) Drru pnu0olxniieiltlaDrlnvs t4 etnir3tytlm eluvs s setrir iodol nlfvias) rtr( p;u0aptn f3iytfm2emumon(0arxrmr3iytopDeaieils0sruoio iy4amee ncs (  Dtmumpnu0apenif3tasfaDulnvo (0 etrxf3todlptrlu sls0s2uoimpiudllt mieiasfsDtauronu4olt  ieilsfm2eauvs;() rtnmo iotfptrln s;t s2uoxrpiydapt mietat  rtmxrpou4optnifctaslaDum( snt)tetrxf3oodla eliei;(  rxmim3ou4optn nes (  rtr(rp;o1oexo ieiyslmDrauvpnu0artrxf iatfm eaiei;s s2to(m3nudlme  nvtltfaDtaur ot4aexn o3iadls2rm(ms t0tltomo ty1latelnvols teto(m oydapeemfesas) 2uaurpou0alxnifciatfa2ran pnu)treoif iydop rlivo;t0s2ur(m io1lptn fctltfaDrm(r no4aet mociyt aDumumo;() rxomrciy1omDelnei;(0 2xoxopoo4oltnlfcsas sruaurpnu4tltoiieiyt s rluvs () rtnircia1fp eau i;()trxr(opoodlpe livt t srua( ono4opx  i3tlsfa umump;(0 lerxo oadop e uei () rto(r3iy4lpte fct ()artr(mo;u4oeeoioeias m2umnmo;u4texoir3oo1lmD au o s0s2uoxo3no1lpte nvsltf Drrxro;o0tpeoifetld m2uanvpnu)aetnxfcty1lpDr nvo;s0trxr(o iudop nmnvs t)a2tmu pou0aeeo fciltlmDumumpn()aetoifctydlpt lneil(0s2uo(r oudal elfvtls aDrrx  nu0ale iocilsfa ranmo (0artomrcoatfpDraies s)texrim3iudolenlfesa(faruru p;o4tleomi3iasfsDraums t4 eerxocootfaDr uvi;t0 rtoxmpnudal  mietlt srra(mono1tpx mi3tadfs uanmp t4treoif3to1oaDeauvs;()trxm(r3oodll  lnviasf rtmu ont4aexn o3iytla2uan snu)tltoxocta1faDelieo;t) etmxo iy4lmee nvs s)s2rmx o;u4tet ioeildfm2uanvs;(4trtomrcoy1oa eauvslt0s2tmio3oy4amt micil(faDrr(mp;t0oet mo3iyd aDea(mo (4arxoxfciy1fmDeanvol( srtmir3iu4al   nei s)arrr(r no1tet  oetyt s rlnvo;t)trenxo3oy1op r uvs;s srumxr iudlp   fctlt a2tr(m ;t0apt ii3tys m ra(vsnu4trxoiocootla   ivsl(0 euo(o oudalte fcsas arraumo;u4tex miciltfm rlu s t0 ltriocootlaDeai i () 2xo(mpiu1op  lfei s arrm(m ot1oleo f3tatfm2rl( p (4tleoxf iadlpD auvsl()s2tmir no4aptemnvsltfa2ta(rp;o0apxoifeiysfa rlumpnu0 rtrxrcio1latrluei;s0srtoxmpnodll nmfet t  Duaurp;o1apxomfeiasfmDean p u0 rxomocoadlaDeli o;t)t2xmio nu4om  lneia() rrmxmpot0tpx moctlsfs rlu sn(0 eenirctodopD aivi;t0sruoir no1lm   fcs sfaruru  ;t1olx moetldfs2ea(ms;u4 etnxf3oo1fat lnvi;(0setrim3iydop  lncias a2tr( oot1tlxoiictadfa ea(vonu4trtomfctotfaD an ol(0t2to(r3nudaleemnvtlt srtmu  ot1altoifeiydlmDrau onu0 lxoif3iadlm  aiei;s0s2xmir oo1apen nes t) Duaumo;o4olt  i3iydls el(mo;u)tltrxrctotlm r u i ()setriopnu1lmtnlfes t s2trurpou0alxoioeiys s2uanvo;()alxrxf ty1fa r u s;s0 ruoxmpiu4am n feia()a2rmurpot4tlx mf3ilt sDemnmp;t4arermfciodoat lneol(0s2xo(m3oydape lfei s a2tmu  nt1olx  ictltls emuvs t)alxoxocoodopD luvs;( t2xm(o ou1am elivtatf Drrxrpoo4tlenmfciytls eanmp;t4tltnifcoatlpteai o s trtmxm3oy4am nlfct t) Dua(rpnu1tlx  oetlsfm2rau o u4aeeoxf3oodfpteluvi t  rxrxmpnu1lleemncsltfarur(r nt1aeen ieilslaDul(msn(4tetomfcto1fpDrauvols)srumim iu1altemnes () Durx  ;o0aex iictadfm em( snu)aeenxr3iotoat ai i;t  2urio nu1lme lnvtatf Drr(r oo0oltnmo3ils m uln p;t0 rtrmfcoydomtr nvs s) rtoirpou1apee ics sfs2raum ;o4optomo3iyd a2rlump;t0tltrio3todopDrln sls0 2xm(mpou4om nmnctas)sDrmxro;t0oeen feiysfaDrmu o;u4 rxoifcoodfaD  nvilt) euo(mpou1apt  fvs tfaDtrurp;u4tex mf3ildls2rm(von()arerir tadfa elieo;t  rum(mpoudaptnmnvsas srtmxrooo0tltnifctas aDrln p;(0artrircio1optraivil( srtrxopou4olt  fvsls sDurxr ot0tpxo i3iatfaDemn p;()tltrif oytlp  anvs ( texoxopiu4lm elfetlt)a2uau p;u4ape  ieiys m ulu p (4 eeomrcoy1op  lnvs;s  rurxrpno4llee nvilt)artmumpnt1tet  i3iaslmDra(mp t4 lxrir3oadlpD aies;(  2urxr ny1lp e fcs t sDrm(mooo4tptomoetldfmDemnmont)artnmo iytfmDran s s)texmxm nu1ale  neil(  Dtr(rpou1tleo fctad a um(mo u4treomocio1fpt  nvsls srxoim nodoptn fcsl() Draxrooo1tpx ifeild s2umnmp (4 lermf tadom raieils s2xoxm3iudop   icil()arrrurpot4alxomietysfmDemu p u0texnmf oa1lmDelnvo t truo(r3oy1al n nvs t arua(rp;o1opx ifciltlm rauvon(0trermo oa1lm rauei;s) rurirpoo1llenmnvtlt)aDra( pot0apx mfeiytlsDeau o u4teeoif3todfaDrlivol(0 2toxrpoydlmee fvsls)arrrurpot0tleomiciyd m2uauvpn()tetnir3oo1fm rluvs s)trxm(opoodlm e neia(  rur(rpou0optnmoeiys mDuaums;()aetrio oodfptr uvs;( trtoimpiudam nlnct (fa2tmxmpnt4oeenmfeiyd s2rmnvp;u4trxrxo totomDrlneo (  rtrio3ny4omt lnciat)sDrm(rpoo0aleoiieiatlaDelu o (4tltnmf3ootlp e ieols) 2uo(o oudlm e fvi s  2rmxrp;o1alenif3iltfs rauvp t0 etoxf ootlpD aueo;( srxrio3nu1opee icslt  2ua(r ;u4tltnioeild mDul(vs;u0trxnirctydlmDrlnvo;( sruoio3oy1lptemfesl( a2rmumo;o1oexoioetasfm uaump (4aexnir oadopDe ues;()t2tr(m oodoptnmnvils srrruroot4oltnifctad s ul( ont4aexnxoctotfmD au i (0sexmir iu1ll  licias  2ta(ront1alxomf3tytls2rau p u0aeerxf3oa1fmDrluei (0teur(o3no1amtn fcsa( sDum(mpot4texniicild a ean onu4aetnxo3iadomtr n olt t2um(o iodomeelict tfaDururonu1tltoii3iyt a emu ont) eeomfciodfa eauvo s s2xmxm iodap e nvsls a2tm(mono4aleoio3iys a ua( s t) rtomoctytlmD  uesl()trxm(m3nudoptnmicsls aDur(rpnu4aptnio3iat a2ua(vsn(4tetomf3i
\ No newline at end of file
@@ -0,0 +1 @@
+u sls)tetr(m3no1amee neia()aDtax  ;o1tee mf3ilt m eau o;t) lxnmf io1opD  n i;t0 2xmxm3ou4aleelnes t)sDtmxmpoo4tpe iictyt s ea(ms (4alermo3oa1opDeaies;(0tetrir nydomt  netlt aDta(monu1oeto oeiasfa emn p;() ltoir3iatfaDrlueo t)setrxo3oo4lp n ivt tf Dtm(rp;o4oexn feiasfmDul(vs u0 reomociadfp rlnei;t)srumiopnu1ole  fcil()arrr(m ot0texnif3iyt s2eln o;t0artrxr ta1fpteai o ( setm(opnu1op emiesl(f Draurpot1tee if3iltfaDran s;t)tlenxf3iydlateanes;s) 2xoir iudaptelfvta() rtm(r no0aleniietlt aDrau s (0 lxoirciatfpDeln il(0 exm(mpiu4amt lfcils srtax p;u1ope ifetatls2ea(vs;(0 exnmo iotlp rluvs t  2umxr3nu1lm emivi t)a2tmxr no1aleoioetydfs rmuvp;u) ltoxfcoytoa r n i;s) rxoio3iu1olt liet s)a2rmxmpoo4olenmoctatla2um(ms u)tleomocio1opte u sls)sruoxo ny4alt  ivsa( aDtmxrpno1aeto ieiyt mDrlnmonu4teerir3ootfmDe ivs (  rtoxm3no1lltemieslt aruru o;o1tpeomf3iltlsDean s (4arxrmo ootoa r neilt0trurim3oodlltemnei tfaDrm(moou0olenioeiysfmDeanmo;(4 eenmo3oytfpD an i s  eum(m iy4opt livsl(fsDta(rpot0ope ifeiatlmDumnmpnu)aleoif ta1faDeai ol(  rtoxm nu1ll emfei (  Dra(mo;t0aeenifciyslsDulumo;() exrir oo1faDrlnvo;s0t2xr(mpoo1lm nmfes (fartaumpou1olx ii3iytfa2ea( p;(4teerxocoo1op  lnei;( sexoir no1aptnlnct sfsrrau pot0tltn oetlsla2emnvo;() rxnmo3tadom rlneil(0 euriopnudlmt  fciat)srra(m ;u1oeeoifctyt m um(vo;u0aeerio3oydfa eanes s0teurir iydamenlictltf rtauroot4oltn oeildfm ranmont4texrxo3ta1fmDeaivo;() 2xm(m oy1oleelieia()arum( pot0tpeo i3tys sDel( o (4trtrxf3ia1laDrlues;s0srur(o io1lm  mnvi s  Drmxmooo1tpxnif3tad s2ea(vont0tlermrcio1fm raneils tetr(m3oudal elncias  rtrxmp;t1tleo fctyt s uau snt) reomo oytoateaies t0t2tr(o nu4alenmncsas) rra(rpou1altn f3tasfaDeau o u) rxrir3oa1fa raivs s)texoxmpiudoptnlivsat aDrmumont1tpx  o3iytfa2ea( o;u) rtomf3todfa r nei;s) rur(opno1ap nlfesat  2taxr ot1aetnmfetysla um( onu4areoir3oa1omt auvols0tetr(o nu4oleemietltfa2uax oot0oltn o3iyd mDua(vo;t0aeermr oa1fa ean il(0s2urxm iy4llte fcs t  ruru p;o1aetoio3iatfsDuan pnt4 ltnxfcio1oaDrau ils) exrxrpoodapt lfvta(fa2umu p;t4ole ifciad s2el( s t) rxnif iatfm rlueo t0tetm(mpio1lltemfeia(fs2ur(roou1oetnio3tytfa2rl(mo;u) reomr3ta1lpDrauvo;s trto(r3iy1ap  micias)srtaxmonu0tlxoii3iytlm2rl(vpnu)trtnmr oytlmt  neo;t)trto(rpoudol nlnvi s)artr(mpou1oetn fctasfsDumnms;t4trerxo iydfmDeaneol(0 2to(r nodapt lnctas) Drm(mp;u4tpxoiociad aDraumo;u0 etoxf3oatla r nvilt0seurir3oy4omt  iet s)srrax ono4aex iieiyslmDrm(ms;(0 rxoio3iy1lp eln o t0 2uoim3iy4omt lfvi tfaDumum ;t1apx if3iyd sDeluvp u4 ltnxo3iadlpD  i o ()teuoxrpoo4ol nmnesasfsrtrx oot0apxomoeiysfm emump ()alenifcoa1lateln i t0t2umim ou4omt lfeslsf rrmumooo0tptnmfctytfs rlu p (0 exnmrctotfmDe ueslt  etm(o3oo1ap nmietas)artaxr ou0tltnif3tldlm eanmo t0 exomo iodfp r nvolt0 rtrim no1lmtnlivsls  Dtr(mpno4tpenifctadlsDeanmsnt0 exomfcty1fa elivi;s0 rtmxrpny1altemiet ( a2umuro;o4oeeoiieiysfs2rm(vp u4 eenmr iytlmD lnvsl(0s2urxr iu4om nlfcs tf 2ta(mpnu0opxo fetytfm rmumo t) etoxoctadfmDe uvs;t)sruo(m oodap   iet (f Dum(m ou1aet iietlt s2ea( ont)trxrio3to1fpDrlueo t0s2uoio3no1lm elfct ( aDrm(mpou4tpxoif3ild m2rau p;t)tlxoxf3oytfmtrluvsls texoiopiu1ap nmfet ( aDrm(rpnu4ale iociasfa2ua(monu4aetnmr tatlatr n i;t  2toio oy1om   fcia(fartr(rpot0olt mieiltls um(von(0tltrir iadfaDr ivo t setr(o3oy4amt lici t)aDuru ono0oltn ietytfaDul( snt) etrif ta1lp  aueo (0 2umxr oodop elnvsl() Dtrxmp;t1alenmfciyt sDuanmo;t)trenir tytom e n i;t)teurim oodopenlncsl(f 2taumoot0tpeomietydlmDeanmpnt0 rtoxf3oydoate uvo s) 2umio ou4apeelfet sfaruru  nt4apx if3iydfsDrlnvo;() lenxf3oa1omD  ivo;t s2xrxm nydopt lfcs ()arra(rono4aleoii3iyt mDrluvs;t0tlxnxr oydopt  u i s)teum(rpio1amt mfvsas s2rrur ot0oet ifeilt aDuanmo t)tltnifctadlpte nvs;s)trur(mpno4lptemictasf rua( poo1ale ifcils a rmnms u)tetnmf iy1omDrlu o t srum(rpou1omenmfvsa( artm(rono1aex mi3tatfsDul(vsnt4 lenif io1la r neolt)s2uoxr nudllenlivt (  Drrx pno1oeeo icildfm2umn s;(4 ltrifcoy1fp  an s t trtr(o3iu1ale mfvt sf 2tau  ot4tlxoio3iad sDrmnvs;(0texrxr3ta1om ean s s t2xoimpou4ame lfvtlt aDtrx o;t4apen ocildfaDran on()alxnmfciy1laDe u o;t setrir3no1lm n fvia(f rtau  ;u4tetnmoetys s rmn p () exnmf oytop   uvi;t)t2to(m iodom nmivtl()a2tmu p;u1opeoiieildlm ea( s (4 lxrmf3io1fm elueilt0t2tmxrpnu4am emivtls  rrmx pnu1optomictyslaDuan p u0trxnxo3iydopD auvo;()t2toim3iy1om emivsasfs2raxrpno0opt  o3iyd a2emu o;t4tetrxrctytoa rluvilt t2umir3iu4olenlfcsa(f Dtr(rpno1openifciad a2rau s;u4alxnmf3oy1lptr uvols  eum(m3iy1optnlies t)srrmu p;t4oexnio3iasfs2ea( pnu)artrif oa1fp rlneol(0trxr(opiu1am nlicsas s2uau  ;o1altoifetlt a umu onu0tlxnmf oytomDr n o s trto(opno4alte ncta( a2uaxrpoo1opxnifeiatfm el(ms;u4teerio iodlate n olt) 2toxmpoydol   nesasf 2rax onu0tlenii3ilt s2umn s t4aexomo oydomtrlues (0s2tr(m3oodame livtat)sDtmurpno0oleoioetatfmDulnvp;(0 renxf3oadoptr ieo;(0 rxrirpoo1amenmict t s2um( pot1tpeomocildfs2ea( s;(4trerxr iodlmtr ivolt s2urxmpoy1al elics t a2uax  ou1alenifeiatlaDemums;u4 ltrmf3oo1oaDrau o;s0t2uoim oudllee ivslsfa2um(moot4tpen f3ilsfm elumo;(4 etrio3iy1fp  li i s)trtoxrpny1ol   fcsatfa2taxm nt0aptoio3iytfm eau p;u)alxomr3ia1lm  lneilt t2xmxo oo1om  livtas arta(rpoo1alxn f3iltfs2el( s ()aexnmrcto1lat  ivo t0 exrxm3oudale lietas aDrm(r oo4oltoii3iysfa2um( s;u0treoxo3oo1fp  auvs () etmxopiy4lltn ivia(fsDuaxmp;t1teeo i3ils mDrmnms;u)tlxnio oadopt au sl( setoxrpiu4lmt livi ()s2trur no1optoio3iltlm uln snu0 eeoiocoadoaDr ieslt0t2xmirpno4omtn feilsfsrua(m nt1tltoii3ias a raumo t0arxnxr tytlat an ilt0setriopny1lmee fcils s2rmump;o0tleo ictasls rm(mo;u0treoxf3oytla  lueo s0 rto(r nu1ap n fviat  rtaxm ;u1olx mfctyd a2rm(ms u)tlenxr3oytoat  u sl(0truoirpoy1al nmnvilt sruax ooo1opxnmf3ilt mDra(vo u) rtnxr tydfmtran ilt s2xr(m3no1opt  icil()artr(r nt1oeenii3ias a uau p t4teeoio oodlmtrlu il(0s2xr(o3oudapenlfetltf rtaxmonu4tleoiietltfs emums;u) exrmr iatop   nvsls0s2xmxo iudol e net tfarra(m nt4aex ioctltfm2em(msnt0arenmf to1fmD an i t) 2uoir3oo4optnmfcilt aruaxro;u4tpenii3iad s rmuvs t)tltrir ta1lmt  i o t)setmxmpiu4olte ivtls  2urxmo;u4tpenmfctydfs2ranmo u4 etrmfcoadfp  auvo;t0srxmirpoudapt mivs t  Dra( o;u1opxn iciat a2uau o;(0arxnifcoy1lmt au s;t)sexo(mpoy1aptnlnetl(  Dra(rpnu0apxnmoeiatlmDuln snt4 etrmr oatoat  n o;s0 exr(r oodlpen ies tfartrum nu4olx mictad a emu s;t) lerxrcootfptr ivi;s0t2xmxr3oo4olee nesas aDum(  nt0oeto f3ildlm emnms;(0teerxf3ta1om ran sl( t2tr(rpnu4om  lfviatfarua(rpnu0apx mo3iaslsDeaumo (4texrmo iotlat aueols0s2urio oo4amenlies sfa2trum nt4oetoii3tas sDeln o u0trenxr oytlpDeli i;(0trxrio3oodame mfeia( artmu pno4tex  icilslaDumnms u4 reoio totoptrlivsl() 2xoxrpnydapenlnei (  rur(  ;u0aee moctyt mDeluvonu)alxoxr oadfm eli i t)srtoxm3nudlmt mnetatfs2uaur ;u0oet ioeiydla2ranmp (0arerxociy1lp r u i;()t2xr(r3oudaltnlnesasfsrrr(mo;o0opxoifciydlaDua(ms;(0arerio todopt  nvo () exrim3iy4alt  feiat  Dtau  ;o0olen icildfaDel(vonu0trenmo3iydlpD lies;()seum(opiudapte fetl(f Draxrooo1opx  fetyt s eln snu0aetoio3oo1omD  nvo s)sexoxr no4lleemivs tf 2rrum ot0opt  i3tyslm2rmump u0 ltrxr oo1omtelueslt  exoxrpnu4openmfct t aDrruront0ole  o3ildfaDumump u4aexrmo ty1latrliei s  2ur(o3nu4ope mfetat  rua(  nt1aexn ociysls2eluvon(0tlxnmr oytlpDrlu olt0seto(o io1apt mfesasfsruau pno4apto o3tldla2elnms;u4arxnxf3todla r u ol()s2tmim iudlm  lnvt t  2taump;o4tpx io3iyt m2ul(mo;u)aexrif oy1fatr uvi;(  exr(r nu1oleelicsl() 2rru p;o0apen ictys m ul(ms t)altrxo3iy1fm eauvi;s) rtr(m ou4op emictatfartmu pot1oeenioctlsfmDem( sn(0tlenmocootfaD  u i;()t2to(m oydol nlivia(  2ra(r ;o4ope iicias m2el( s;u4altnir ootfmDrai o;t)t2toir3nodaptnmnetlt)aDra(mp;t4oeeniietyd m ulump (0teerif totlp   ieo t)seuo(o3iudlpte iet ()srtrumpot0tpx moctyd m2umn o;() lxrxr3oa1oa eai s;t)t2xrimpiydlpeelnvs s sDtr(mo;u1olenmo3ilt a rln o;(4teenio3iadfatr n sls0 rum(r no4lptn ivi (f 2urx p;u4tex mictysfmDul( s t4 eerxrcoy1oa  ln o;t  rxmxo oo4apenmicsa(fsrtau o;u0aeeo f3ils aDelnmo (0 exnmrcto1lpte ueil()t2xrirpnu1am  mfvta( sDua(rpou0olt  fciyslmDumu pnu)aetrmo3iotfp   n sl( trtrxr3iy1lptn fvsat  rtaxmooo0openmo3iyd s em( onu0trxrxocoy1fpt  uvs;( teurxm3ou1lmtelieslt sDta(r oo1tpxomfeias m2umu pnt4trtoifctatlpte nvi;t)t2tmxmpiu1ll   ietltfsDra(  ;u4olto o3iytlm2rmnmsn(4trtnir3ta1lmD  neo s)sexr(mpnu4aleemfvs sfsDtmum ou4teen i3iatla rmnvs t4 renmfciodoateauvsl() 2urxo3iy1am   nvt tfa2uru  ou0olen ieilt m2uan p;() rxoio3iodfat  i i ( s2tmiopny4apt lfesls) 2rrurp;u4oleomo3iltfm2ea( s;t0 leoif3oytomDe uvil(0seurirpoy4lpee ics s)sDraxrp;o0olxomfeiatfa2el( s;u)tlermo oatlpDelu s t truoxr nydlptn fvtas s2tm( ont1oeen oeild s2rlnmpnt4 rtoir3ta1omDelnei t  2ur(r3ny1amt mivt ()arrmx ont0aleoifeiatfs umn o;u4 lerir tatlaDe u i () exo(mpno4opeemicilt  2ta( oot4altn fciatlmDuluvo;t)areomo ta1fp raieil( setrirpiydlm  lies (f rtmumpnu4aptnmi3iadla ra(mo u) exrif oodoaD  neo s  exm(rpny4al  mfesl() Drrxr ot4aexo f3tadls rmuvp;t)alxomr oadlate ivilt)sexr(opou1ap emfvslt)srrax pot0opx moeiytfmDuanmpn(0aetnmr oa1faDelnvslt srum(r3nydlleelnvsasf 2rax o;t1olenio3tlsla2ranvpn(4 leoxocoadfaDeaiei t sruo(m io4ole licta(faruaxr ;t4tltomfeildfaDuln o;(4 rtnirctatlpte n s s)tetoiopiy4apt  fvi s  2rm(r nu0olt iociaslmDum( o t)tlxnirciodlmtraies;t0sexo(o3iydomeemies s)aDtr(moou4alx  feilt m eanmsnu4aetomf iydoatelivolt t2uo(r oo1ole lnvi t)sDuau  ;o1altoif3iysfs2ra( s;() exrifciodla   n slt)t2xo(mpiydomtnlfvsa(fsrtaxm ou4teenio3tys m umnmo t) leoifciatoa rlnvol(0t2xmxo3oo1optnmfvil()srta(m ou0openiieiltfs2ua(msnu4 renir3iodfaDran o (0srxoxm3oudlm elnvil(f 2um(m oo4tpe moeiadlm2rl(mp;t4trxrxr3tadopt auvo t0texo(o3ny1amtnmfeia(fsDtmxm oo0texo ociadfm2um( s u4altnif3oa1la   ivo;s0tetr(rpny4al emfeilsfsDurxmpot0teen ieiatfm ua( o t4 eenmo3iadfp   ieo;s seuo(o3ou4lm   iei s)a2rmx p;u1aexn ictasfsDeaumpn(4 exoxr ia1fa   neo t0tetr(r3oy1ole lfesa(f rra(mp;u0apeomociydfs elnvsnt0artrio iatlm rliei;t t2ur(opiu4lp  mncsasfarumuronu4tltoif3iys s elnms t0teeomfctydomte ies s t2um(r nydlp emfetas)s2rax  nu1tpen f3tadlm2eaump;u0 ltnxociadlatr i ol(0t2xrxr iy1lpt  fet tfarua(mooo1open o3tydfa uanmpn(4arxrmr3io1lat  i slt)teuo(m iydllenmncsls a2rm(rp;u4oltomf3ildfsDrmn onu4tleoiocoo1latrlivilt)s2xoxo3ou4al nmfcslt)sDrau onu1oetoiiciysfsDul( ont0 rtrxf iy1fpDeln o;(  2urxr3no1ll nmncilsfa2rmurono1oexoifctat s2ua(vp u)alxnifcto1fmt ai o;s trxmxm oudopte ncsls  2ur( onu4aptomoeiyd mDeluvp;u)arxoif tatlaD aneslt) 2tm(opiu1ame  nvs () Dum(  ;u1oetoifcildfm2rmnvp;(0alxrioctotlpDelu sls0t2xoim3iodome mfet tf Dumxm ot0opeo ieiydlaDrluvpnt4aetomrcoydlpteluei;s0tetm(o3ou1amtnmfcsl(faDurxmpot4opt  feildls emump (0teenxr3iotom  aivs (0s2trxrpno1ll  mnet s aDrrxr ;u1tpxoifciydlm rluvpnt0alxomr3ootoaDrluvi;(0teumim iydale mieiatf Dtrxmo;o0oet mfeild mDrmn p;()aeerio tytlm  livol(0srtoxopnu4omt mivtls artaurpnt1oleoifeiysla2uanms t4arxniociy1la rauvi ()srur(r iu1omen fvi t  rra(mp;u1oltoifeild mDul( snt)artriocoadfmtrli slt0trurimpiu4ope  fci s s2um( o;o0tlx  ietlslm2rm(vsn(0 exrxo tydlp   ies;s)trtmxopiu1ll emicsls  2umumo;t1alen ieiydls el(mpnu0 lxnir3oadfpDr uei s)trxm(o iudap  mieias)s2rrump;u1aeeoifetad sDuluvo;u) leoif todla  anvs;(0tetriopio1alt miei s)sDurx oou1ole  o3iyd sDrm( p u4aeenio3oodoaDraieolt)teuo(rpoy4aleelfctlsf Duax oot4open f3tltls eluvs;() rxomocoydlaDrluvo;s)teum(opnu4amte nvtl(  2um(r nt0olxomfctadfmDul( s;() reoio oodoaD  nes;( srtmir io1omt lictl()s2tmum ;u4olxnmocilsfsDrmu pnu) rxoif3iytfmteliei;( t2urio oy4amtn ivsl(farrrx o;u4aeen fctytls2ean p u4alerxo3oadomt lnvs s  rto(m3iydomtn fesat  rtaxm nu4olxnifctltfsDra(mont4 etoxo3io1omD au ils tetmimpiy4lm nmfctatfaruaumooo4texoifeilslm2emu ont0tltrif tytomtrauvols  2tmxo3oy4openmfvt tfsDrm(m ot4opt io3ild aDemuvs t0tleoir totomt lueo s0s2xm(opio1open ivslsfarur(  ;o1opeomfciyslaDulnvont)altnif iadlpDe i i s0 eur(opoodal nmivias a2rmurp;t4olt iiciad a eanvo;t)artoxo3oo1fat li o t) rumim iu1lmt livs t s2ta( ono0apt mfeildlmDeanmo;u0alerif oadfmtr u ols)trto(r iy4lpe lfesls)a2rax poo1opeomfciatls2rlnmont)alxrmf3oy1lptran o s trxr(r io1ameelieils  rtmx o;t0tltniiciydlaDean p u0aetomocootopte ieol(0t2trxopoodoptnmieiat  2tru onu1tlxn i3iltls ulu s;t)arxoiocoa1lmDe i ils0 rtm(o3iydoptnmieslsfaruaumooo1tlen f3iat m2rm(vo () rxoxocoatfaD  u i;(  rxrxm3oydamenmnvs s srrruro;o0apt mi3ilsls2emumo t4trtnmo3to1lmtr neo;s trtmxrpoudalte fcs (fa2rmxmp;u1aee moeiytfs2rluvp t) rtnmf oo1lm e ivs;s0srxm(m ny4ol nmiciat sDur(rono4oeenmo3ilsfm ulu ont0alxrxo oatlpDeaies s s2xoxopiy1lmeemncsat  2tr(r ;u4tlt ifcild m2ul(vo t4 etrxf ia1fp  aiesls texriopnu1lptnmiei ( aruaxr no0tex ioeildls uan s;u4tlxoxr3oa1lat auvi;()sexmir iu1lltemnviltfsruaxmpoo0ale mi3iys sDemnmo t) ltnir3ia1omDeauei ()srxr(r iy4om  lfvil( srumu p;u4apeo ociyt m2rlump;t4 exrmociatop  au sl()trum(o ou4olee ietl(fs2rax  ;o4oltnmfetyt sDrl( sn(0 rtnio3tadfmt lnvs s0sexrxm oy4ll  lictls a2umxmo;t1teeoioetatlm rl(vs;t) eeomf ta1lpte n o;(0texo(o3oy1ol nmieilsf 2rax pou4aet  fciytlaDrlumo;() rxrxo iytopDr ivilt0 rxo(mpny1lpe  net sfaDta(r ou1aee ioetls s rmu on() ltoxo ta1opD lnvols sexrxrpoo1ope  ncslt sDur(rpno4tlenio3tysfm ra(ms u)trxrio ia1oaD livo s  rurio iu4om elfes t srtm( p;t1aet ioeiydlm2emnmsn(4aexomrcoadomt lneol(0trxoxm ny4lltn fei ()artmuroou0oee ii3tatfaDrl( o t)artnmfcty1fp r uvs s)srtmxr oo4oltnmnct s  2tmu  no0alt  ietytfmDua(mpnt0trxrir3tydlaDrau sls0t2trxm3ny1ol elieils aDum(moot0olx ifetlsfsDelnmo;t0 eenxr io1fa elieo s trtrimpoo1apeelies sfaDrr(  ot4oexo i3ilslmDul(mo;(4 lxrmr oa1lp   nvs s) 2xrir nudap  micilsf Dtaxroot0tpto feiysfm2rmums;u0 lxoir iytfpteln s;s0 etr(r oo1lmt  ictas)aDta(mp;o1altn f3iyslm umuvpn(4aetoif totoaDrlu olt0 eurxr3oo4llte ieils aDraum oo0tlt ii3iydla el(mp;(0 eerifciodopDranei;s  2tmxm3oodllenlnvt tf 2tr(mpou0aee  ietydlaDrl( o;t0aetrxr3oa1lptrlnvsl(  rxmir3iydllenlfvt tf Dum(r ;o4olt ioetysfm2elnmp (4 rxnmf io1laD lnvo s s2to(r3nudomenmivt t) 2ta( p;o4teeo f3ildla emump u4trxoxr oo1laD lueolt)trumxm3oudlleemfvt sf rra(m no4aetnifetatla2elnmsn(0tlxriocto1fpDrliei (0setr(r nu1lm  mnetlt)aDtmur ou1oltomiciltfa2rmn pn()tlxoir tytlpD  uvs;t) 2trxo3nydol elnesltfartaumpnt4oetn i3tytlm raumo t4 ltrifctodlmDeli ilt) rtrio iodlmtemfctat  rrm( o;t4tpe ioeiatfmDuan o;u4 lxnmf oadlm   nei (  ruoir3no4lle  fvilt)srurxm ou4aet ifciysfs2ulnms ()altnmfcoy1oatraues;(  rur(m oy1lmtemfcia(farurx oou0aex  feiltlmDra( o;()arxrxo3oydoatr u s;s0s2triopnodame lncil(fsDua(mo;t0alxnif3iydlaDraums t4 eeomo3oo1fmteai o t) exmxm nu4altemnvs (f Dtmu oot1tex ifeildfa2ua( onu0 eenxrciytlateluvi;t t2umio3oy4lmt  ici s) 2tm( onu1ape  fetysfsDumn snt)arerxf oatom   neol(  rurxrpiy4ole miet ()a2um(rpnt1tet ioetatlsDuluvpnu4 reriocoadlpDelnvo;s0truo(m oy4ol e fes (faDrmum nt0aee  o3iydfmDrm( p;t)aexrxo iadfa eai i;(0 etrir oydlmtnlnvslt) Dtmu o;t4oexo ociyd a2el(mpnu)alerif to1lpD aieils)srtm(mpny1olenmfei (fsDtr( o;t1texomoeiatfm2el(vonu0 etnif oytfmteln slt0s2trimpou4ap emiei sf rrr(rp;t4tlxn o3iytlaDemn p u0tetomo3oa1fpteauvo t)srxoio iy4lpe  fcs t  2trxroou1oltn o3tadfs2em( snu)teeomr tadfa   nvilt s2uoxopou4omenlnvil()a2tmuroou4alxn i3tyt m uaums;(4 lxomf3oa1fp e nes;()s2umxm3iy1amtnlfvs sf Dtaxrooo0optniiciat a2uau s;u4 exnmfctodfmD anvi;t) ruoxopiydllte fctat)a2uaxmo;t1oet mfciltfs2um(ms (0 renif oydlp eln i;s) etrxopnudole lfvtas)s2um(m ;o4tlx  o3tyd a umnmp;()aexnmf iydfpD lnvi;s)t2tr(m iodlpte neiat)sDtrum nu0tex mf3iys sDem(vp;(0artomr3oodlp  au i;(0 2umio oo4lmtn fcils)arurx  ou4aeeomieilsfs uln p t)alerxocty1opt aues ( t2tmxrpnodlptemfvtl()a2tauro;t0tetoifeilsfs2rmums;(4 lxrir totlp rlnvi;(  rxmiopnydam n iesl()sDrm(r ou4alx mi3iatlm2ea(vp (4tlxrxfcto1oaD  uvolt  eurim3ny4lpenlnvt s)aDrmxrpou4alenif3tytlmDrm( onu4altnif3iytfmDe nvo;t0 2tmxo io1apee fesasfaDtm(ronu4aetnifciadls2rl(vpnt4 rtnio3totfpDr ueilt)sruoxm iydlpe  icil(fs2ua(  ;o4aexn ieiasla rlnvo (0tleomr3iodfatrlu i s0trtm(r3io1openmnct tfsDurx ont4texn ieilt sDrmuvon(4treomr oa1fp raieo;s)t2xm(rpio1amen ivta() Dtm(mo;o0apt mf3ilt aDeanmp (4tleoxr3ta1op   ivs s0 2trxo3ou1om   fetlsfsrra(mpnu0tlx ifciltfs2rlnmpnu0texnxocoodfa ran o;t teum(m oy4lpeemncsasfsruau o;u0oleo oeiatfm2rmuvpnu0 exrioctatoa  lneo t)trxo(r iy1opt mfet t)arurxmooo4ale mfcildfsDra( o t4artnxf tadlptelnvo s) etr(rpno4omtnmncta(faDtru ono1oeeoii3ild aDelnvsnt4tetoxfcio1lmt aues;t)trtoxr3ou4omtelivilt)a2ur(mpno4alen o3tytla2em(mp t)aexrmr oatla  livi;t trtrxo oo1lmtnlictltf rrr(mp;o0tlto ieils s rlumo;t0 etomfcoydfa ranes;t0s2xoio io1ll n ivs ( srurxrp;o1aetnifetlt a2eluvs;u4artomf3totomDe ivo t0teuoxr3oo1optemfeil(farum(m no0tlx if3tys a2rauvp;(0aetrif iytfatrln o t  2xoxm3iu4am  mivsa( aDrau  ;u1ale  oeiysfa umu s;(0arxomf iydfm rai o (  etmxm nu4ole liei sfarrm(m nu0tpxoiictlsfs2uan pnt0aetnmf3oatfaDrau il(0srtmim no4om e fes () ruax oot1tlenmi3ils a ul(vs (0tetrif ia1fpD anes;s)sexr(m3iu4ll e ies t) 2rr(  ;u0aetomietld s rl(mo;u)aleomrctadoatraivolt0tetm(o iy1al  mnvilt srra( ono0aleniicilsfaDea( s t4 lenxr oodfmDr nesl()teur(rpoudalenlfviltfsrrmuront1apx  icilsfm rlu s u4tetniocoadoa   ivs ( seumxopoo4llte ietas) 2rmur ot0apxn i3ild m elu o;(4areoxo3iatlm elnei;(0 etoxmpoo1lltemies (f 2rmurp;t4tltnmictldfa2ra( p;u0 rtoxf ia1lmte n s;s0 rxo(m3iu4amtemiesa(f ruax  nu0oexn ieilsfm2uau pnu0 eenir oa1opte nesls0tetoir nu1ol elies s)aDraxrp;t0opxnmfctysfm ulu o;u)tetnmf3oo1fat  ivsls trxmxo3nydlmeelnvi (fsDtm( onu0olxo iciys a2ua(vpnt0aexnxr3oy1oate neo;( t2umxrpoudam emnct t aDrr(  no4alx mieiydfa em(vo;u4tltrxoctadopte u olt)s2tmxm3oy1lm   fcil( a2ua( o;t0tle mfeilt a2umn pnt0aexoxo todopDeaivs;t) exmim3ou4lpe mietatfsDumxm ;u0altomociyd mDem( s;u0texrif3iytlaDrauvo s  eum(rpoydlp n fvs ( aDtrx  ou4ole  f3iytlm rmuvp u4texoxo oatoatelueo;s) 2xo(r3no4alenmfesa(  rrmur ot1tpeoiiciyt sDumuvo (4aexrxr oa1lp r ies;t0t2xmir3oo4lmtemncia()artr(m ot4ale  o3ildfm2uln s (4aeerxf3ootfm   u o s0 2xoxr io1om e ieiat)aruau onu1tpeniiciat m2ulu s;u)aexrmr iy1omtelivo t0trurim3iudol  mics t) rur(mont1tlxn octat s2rmu sn(4altoif ootomt  ues;t0seurim3iydoptnlict ()s2trxr ;t0tee if3iyd sDemuvo;(0 rtomr iodoat auvo s) rxmirpnydaltelfesltfaDtr( pot4tlen ieiltfs2uau onu0texrxf iytfpt ln s;s sruoxrpiu4omte fvi s  Dumxrp;u0tltomfetadla2eluvp;u0tleomo ia1lpD  uesls t2to(r3ny1llte nvslt s2rm(rpnu1teto fciadfaDemnmo (0tlenmr iotlptrauvi;t  eurxopny4altemnci t a2tmu  ou1aptoii3iadfmDem(vonu)tleniocoy1omte u olt  2um(mpoo4opeemfvt sf rrauroot0olen i3tydlaDeanvs (0 rtrxfciodlate neo ( srtmxopio4amte fesa(fa2rau ono4openmoeiys s eln s;(0texoif3oodfaDe nvo;s0 rur(o nu1lmtn ies s a2rrxmp;u1tex ifciyt s um(vo u4teenxf iadoaDeauvol(0t2toiopiy1aptnmfetlsfa2uaxronu4tpxnmiciysfa uan o;t) exoir io1omDranvo;s) rurir no1lltelivilt)aDrmur ;t4tpenifeias mDrl( onu4aeermo3tadomtranes;(0 etrxo oy1lp nlnvtl( s2rau p;t4tpxomfciydfm uau p;u4 lxrifcia1omtelneo s0srtrim3iu1ole mncs tfsrumuronu4opx  f3ild a2ulu on(4teerxo oo1fa elneil()t2tmxrpou4ll emfei ( aDumx ono0opt  fcils aDrlumont)texoxr3ty1fpD  ieolt0truo(r3io4apeemfvs tfa2raumpnt1tpx  f3iasfm ul(mp;()tetomo iydlmD li s ()s2urio oy4optnlnesl(f rtau ont1aet iieiyt mDul(ms t0tetoxociytlate u o s) 2xoir no1lltn nct sf rra(moou4oeeomiciadfmDuauvo t)texoir oy1oaD luvi;s) eumirpoudlp   feia( sDum(rpno1tpt  o3tydlaDel(mo;t4aeerif iodfp ran ils setmxm io1amtemfetlt  rumxmoot1texo feiad s rmnmpn(4aetnxf io1fpDeauvi;s0 rxoim3oo4ol nmnei t srta( pou4tpxnmoeilsfm eau s;u0 lxnmr3iotfpD livolt0s2xrirpoodolt livta(fartrum oo1alxoifciyslsDrmn p;u0tlxnxociydlaD  n ilt0t2xoimpiy4lmtnmnct tfs2umurp;o1tlx mi3ias mDea(ms;(4tlxrxo io1late ues;t texmir3oy4oleelnvil( sDtaxrono0tex  fciasfs2eau s;u4tetrif oytfmtraneilt  rum(m oydom emfesls)s2rmx p;t0tet  oeias mDra(vsn(4aetrmfctatfm rauvs t0 2xo(rpiu1ole  nctls)sDumu o;u1aee ifeiadla ulnms u4 exoif3tydfmDr neil()s2toimpoo1lle mfviltf Dra(rpot0open oetyt aDua(von(4tlenif tadfmD  i o (0 2to(o oy4lltelnetlt aDra(moot4tpt ioctydlm2uau s;t4aexoir io1fm eaivs t  rxrxo oudopt  ies ( arur(mont1oetoii3iysfm el( o;(0aeerxfctadlat an s;(  exm(r iy4om nlfvta(fsDuaxm oo4teeo i3tasfm um( on(4 exnmo3oydopteaivslt  rtr(r3no4lm  lnet t aDtrxm ou1opxnmo3ilslmDuauvo u4aexrxr ootom eaieo;t  rtoim3oudll   nvsa(fa2ur(ront1aexnmf3iysfm2uanmp (0arxomo3ty1fpDe uei;s)s2xrxm iodale livtlt  2um( ooo4opxo feiltfsDrl( s u0treoxrcoa1fp  auvi s t2urimpoo4lp elies ()sDtrx pnu1olenif3tat sDulnvpnu)texoxf3iadfat lueils0 rxrxo3iudlltemfeiasf 2uaxro;o1oex ioetatfm2rau pnt0alxrxf oatfpDean s;s  rxm(mpiydlmte fvils) 2ururpot1opxnmicilsla rl(mp;t0trxrmo ta1op eln ols s2uoxmpiy4lmt mnct s  rtr( ont4apeo o3iasfa elnmpnt)artriocoadopD anvo;s) rumirpoo1ol elncta()srtr(rpnt4alxniietltls2raums u0tetoiociatfaDeau o ( teurxrpno4al   nvsa( srra(  nu4olx mo3tat a2rl( on()trxnmf3iodfpDrai i;()t2umio oy4omt mietl(faDta(m ou1tpeoiicilsfa el(mo t)trenxfcootlpDeluei t0teurxo3io4lp e nei s) Drr(rpou4apxoif3ildla2rau s t)tlxrxr3oadlm eluvols trumir oudol e fes tfsDurxmonu4optn o3iadfm2ulu s;(4altnio3oytoatelueo;t0 etmio3no1op nlnvsas)sDrm(r ;t1tpt ifcils sDemuvo t)texnxrcootfpt aivi (0t2xoir3oy4lm nlfviatfaDumxrp;u0tet ifciasfsDrm(vp u)artomr3totfp elneo s)s2toxrpou4amtn feiatfs2rmxm oo4oetomfctldlsDranms;u4teenirctatlmte nvs t) rxoxrpou4lltemnei (f Duax ono4olx  ociysfm2eauvsnu)aeerxfcia1lm   uvo;s0trur(o iydolen icils sDtmxmooo1aptomfetadlaDrl(vs;(4arenircio1laDeluvo;s teuoxo nudale lneslt)s2ta(rpnt0alx moeiat s2umn p (0artnxr3oo1fpDeanvi;( seurxo3iodlpe  nes sf rurxroot4oltnmf3iys mDrmumsn()arermrciodom eanvslt)trtrxr3iy4ll   ieiasfaDuaxrpoo0aetniiciytfmDemuvpnu)tleoxrctadomDr nvo t s2toir3no4lme  neta()sDra(mpoo4opt if3iytla2rlnmpnu4trtnir iadlpDranvsl( sexrio3iu4lpe mfvsa()arurxmpoo1tleomoeiltlm uaumo (0trtoirciatfaDranvi;s)seur(m3iudole mivsat  Dum(mpnt1teenio3iysfa ulu o;()arxrio oy1lmDeluvol()s2tmio3ou1apt mneilt sDuau ont1ale  feilsfm2ul( snu)tlermf tadopt anei;s seurxrpny4al e nctat) rraumo;t1apxnioetydls2em( snu0 rxoio oodlptraneols0teurxo3io1ame  fcsl(f ruaur ot4tpxo fciydlsDranvon()altnif3ootopDeaneslt sexm(o ou4ap  mfesas  Durxmp;o1tptn i3tldfs uaumsn(4 rxnxr iotoa raieo t) rxrxm3no4olte fei tf rtm(m oo4oltomfetys m2rm(msnt)trxrmrcta1lpDrli o (0 etm(r3ny1omeemics t aDrm(moot0altomi3ilt s2ua( sn(4aetomo3iadopD lues () 2xoxo3oy4apenlfcils)aDtru  ;t1aeto oeiys a2ul( o;u)arxoxo totlateln sl( s2umxrpiu4lme liesls)sDtmumono0teto iciatfm rlnvp;() ltnmr3iotomD ln s ()s2umir3ny1apt mnvsa(faDumxrpou0apto iciatfs2ran onu)treoir ty1opDe uei;t)s2uoxopiy1apen nvi tf rua(r ot0alt  ociatla eau p;t0 rtrmf tatoa eauvi;t  2xmxr iu1amenmfctat  2tr(  ;t1aex mieiatfaDelnms;(4alenio3tydomtrli sl() rtr(m3oodopt  ies t)a2raur ;t4tltn ieiydla umuvpnt0 exrxfctytlpteln ils0texmxo3oodapt mfeta()arurumpoo4olxomoctadls2emnvp;u)arenifctytlm rau i;(0srtr(o3ny4am e neslt  2uaxm ;o0oet  ietltls emump;(4treoifcoatop  li ols  euoir3nu4apeelfvsltfaDumumpnu4opx io3iydfa2ua(von(0alxomo3tadfaDrlnvo;s  rxo(o3iy1amtn fviat s2rm(  ;o4tlx mfcilt a rm(vs u4 lxoxr3ty1opDeanes;s0srumxm iudam  lncs () rrrumpno4oltn iciydfaDumn on() leomfciydla  liei t teur(m3oo4lpeelfvta(  rumx pou1aexnioeiat s uauvs;t0arenxrctatom   u s ( t2xoim ou1lle  nvias) Dur( ont0olenifeiytfm em(vp;(0 eenif iotomD  ivslt)t2urim ny4optelfvslsfs2taxmoot1opt  fcilsls2rlnvp t0tleomf iotomDeln o t)srur(r3nudlm elncs s  Dtau pot1oexnmo3tlsls umu on(0tetnir3iadlpDeluvo ( t2uoiopiy4omte nci s)srtrxm ot0aeenmfeiadfs umums t0arxrxfciodla e ieo t0 2tm(opio1ole livt ()sDur(m no4tetoio3ildls umu s;t) rxniociotoptrlueo t0 2toxr iy1olt lnetat  Drax ont4olxnmfeiysfsDemu o u4 ltnir3iadfa r ues (0 etoirpoo1omenmivta( a2ur(  ;u0opxo feiyslm2eluvs u) etomf iydlpt anei;s teur(o nydom nliei s)aDtmxm nt4aetomieiysfm2uanvs;t0alxoio3oatla  livo;t) eumxo iydalenmnvt t) 2trur ;t4oetomi3iysls2rmuvsn()arxrio3ootom rli ils0texrirpoy4ll elfvsls  2rrxrpnu4teto oeils aDraums;t)tetnxrcta1fptean o t0s2umim nodllte feslsfartru oot0tpxn i3iysfmDeaump (4altoxf3tadomt  i ilt0seurxm3no4omtemivsls)sDrrurpnt4aexomfeiytlaDemu p u)trxoxr tydfm   neo s teur(opou4ol n icia()srum( pot0tpxn icilsfsDranvo;u0aetomr todfmDr nvi;s0s2uo(mpnudalt  ieslsfarra(mp;t0ole mfciadlm2ea(vo;()texnio tytom eauvs (  exrir nudap e nviat) Dtmu pou1tpe ifetys a uanmpnu)trxnmf iy1om ranvo t0sexo(rpoo4opt lnvtas)aDumxm ot1ale  feiatla elnmo;u)aleomociotfp ranei;( seumim nodamtnlnet t artr(moot4tlxoioetls s2umnmo u0 lxrxr3iodlmtr ueo;s trtmir3oodapee ncs s) rrr( onu1tltnifeiasfs rln p;(0tlenif3tydopD  nvo;t0s2xmio3no4lmt mfctls a2tru  ;u1aeeomictytla2rl(vo u) ltrir3iotfmDeli il(0teuoxmpou1ol  mnesat)a2tmxm ;u0aeenmfciltlaDemn o;u4texnmf tydfm  auvi t seur(mpiu1lpt livt ( s2tmxr nt0aptoioetatlaDum( pnu4arxnxf3iy1fmt  ivi t)t2xmim3iodom e feil( aDtm(  no4aetnif3tatfs2ua(mp;(4teermf ootfp rlneols)trtmiopno4ll n fciltfsDtrx pnt0tlxnifciysfm em( snt0trxnmf tadom  luvi;s sexrxm iu1omtn fvtasf 2umx oou4opto feias aDuluvs;t4 exnifciytlmt  u slt t2tr(o iudop elietls) Dta( ont0tpx iociyt mDra(mont4 rtoxo ta1lp eli s;t seumiopio4alee ivtas arrau pnt4olx iocild mDem(vs u)altomr tytfateaivil(0tetmxr3iodlle mietlt srtrxrpno0tle  o3iytla uanvo (0treoifctatfmDr nvs ( trumxr no4amtemnvil(f 2uaxm ot0oeeo fciydls2rm(vpnu4arxrif3oo1faD luvi;()t2xrxm3iu4ll nlncia(  2rauroou0aleo feiltlm2eanmp;(4areomfciodfmD  uei ()t2tmxrpiu1omee nctat sDuauro;t0aet mictatls2elnmsnu4tlenxr ty1oatelu o t)texmxr3io1lpee ivs ( sDtmumpot4aee  feiyt a raumsnt0teenxr3oy1lm elues;()s2umxm3no4lltnmnetatfsrtau  ;u1tetnmf3ils a2rmuvpnt) exnxo oatom r neols)t2um(o3iydlpeemietlt sDua( pno1alxoioctltfm ran ont4 eeoifciatlaDr i s ()trur(m3nudapte ncia(f rra(r ;t4aet  o3tytlaDean p t)arxomr tydfmDe uvi t)tetrim ny1alt lici t)srrm(rono4apxoiocildfm2uanvp;t0teerxrcoadfmD  n o;t0s2uoxo3oodopen ict s)sDumxm ;u1tptnmfetas aDemnvs;u) rtrmo3oytfmD  neo t0s2urxo iydamt  ict ()sDtm(mooo1tet  i3iatlm rm( p;(0tltrxrciotlaD lu o s)seur(m no1lltnlfei s  2urxroot4opxoiieilsls2eaump (0teeoxr oydoatrai s s0 rurir iydlptnmfvslsfa2uaxrpoo1alxo ietysfa el(mo (4trtoir3oydlpDrau i;(0s2xr(o3iu4apt mfctls)a2tmum nt1tlx  oetatfsDulnms;t0aetnir iodfat  u ils texo(m nodllte nci sf rtmxr oo4apx ioeiyt m2uln onu4aeeoxr3oy1la eluei;(0s2umio oodoptn icsl() rrax  ot4tlxn f3iatla2uln o t4trtnir3iytlmt luvo t  exr(opnudlle lfcsls  Dtaxm ;t1opeomi3iysfsDeln p (4trtnio3tatlaD lieolt) etrimpny1lpt liciasfarraur oo1opx mfeiydla2eluvs t0tetoxrcoatla r ivilt0 etm(mpoy4lmtemneilt)arua( onu4tlx  o3tyt m2uauvs t)aexoir ia1fmDr neo;()t2xoxm3oo1lltnlnetasfs2um(r oo4aexomi3iysfsDraumo;t) rxoxo tadfpDr nesls)setr(o oodalte ict (faDumumpnt4optn i3iydlsDulumsnt)teerxr3iytlp e i s s) rtr(o3nu4lm   fcsl(fs2rm(rp;o0oeeoifciadfmDum( pnu4 rtoir oy1omteliei;s t2trxmpiydlmt lncia()aDua(ro;o0tpxoifetydfmDumums t)tlxriocoytom  aieils0 rtmir no4lpt  icta( a2raum nt0tlxoiieias m eanmo t0 rxnmo iy1omDeaueol()teumxo iodlmt lnvsat) 2ra(m ;o0opxnii3tyt m em( o u0 rtnmo3ootlaDeaueils0 eumxr nu4ll nmivs t  ruax p;u0tltomi3iadfs emumsnu0trtrmocoy1la rluvi t0t2xmir ou1om e nvslt  Drru o;u0alxnmfcils a rauvo u)altnio oadlaD li s ( s2uoio3iodolen nvs t) 2um( pot1aetnmo3tatfs ran o t0aleoxfctadfm e i o;t trxrimpiydlptnmieslsfartr(r ;t0aleomiciatfsDel(mpn(0artnmf todom  au s;t seuoxr3ny4apt mnetlt sDrrxrp;o0tle  f3tys m ranvs t4trtoxo oy1optrluei t0 2umxr3iy1om nlivslsfa2trur oo4olxn oeilslsDemn s;u4texoio oa1fm raues;(0 euoxo3iydlmen ict s aruru onu0aexomoetysfm2rm(vs u4 ltomo3oy1fmD lnes;s t2xr(o iydom n nvil()srtaxrp;o1aexo fetytfaDulnvs;()texrir3io1fmtr n i t)sruoxopiu1llte ivt ()s2uax oot0openmfctld a umn snu)aexrxf3iytoaDrln s t  2toim3iu1op   fei t artmxmoot1alt iietltlm rm(vp;t4arenio tatlm elivs;(0setmim iy4lptnmiet (fartmu  oo4tpeomo3ias m uaums;(4 exoirciy1lpDr u sls) etrxopiy4lmenmici s) Drmxrp;u1tle mfeias s2umu o;t)tlxnmrciy1la  anvo;(  2umxm io4omtemfesls arrmx  oo1texnifeiltls2uaumpnu0 rtoxfcoy1lm rluvi ()sruoim ny4ame mfes tfarumx  ;t0tpe ifeiat a um(vo t)trxomocta1om rai ilt tetrxm no4op  mnct tfs2tru o;t1tpto ieiys m umump;()aetomf3oy1opD livs (  rur(m nydoltn ies ()s2urxm ;t4tltn f3iasfa umnmo;(0altrircoa1fpt  i o s s2umxrpiodlp e nctl( aDtrumooo1oex  o3iyd aDrln p;t4tltnmf ta1fpDr u i s s2xm(r3no4amt mivs t) Dtmum ou1alto i3iyd m rmu p t)tlenir3ia1lmDrlivsl(0 2tm(o3nu4amtn fvsls)s2tmu pou4oltnmfctasfm ra(vp;t4tltnmr3ty1fmte n s;s)setmxm oydaltemnct t)arumxmo;o0tex moetas m elnmp u4arxoio oodlatrauesls  euoir3iy1ale livi () 2rm(r nt4tpxomo3tatlmDel( pnu0alenxo3oydlm elivolt s2umio3iodaptnmfetas)aDur(m ot0tle ioetad a2rmumo;t) lxomfciytlaDeli sls)tetoimpnydopt  ivs (  rtmumpnu4tlxnmietat sDrln onu0tlermo3oytomt anes t trxoxrpny4aptemivtat s2uaxmo;u0tpxnmociytla2elump () eeomo oadoptr i s;(0trxriopoydlmt mfes s)a2trurpou4apxn ietldla2rmuvsnt0aetrxfctodoatrlieo;s  etm(r nudamenmfvta()aDrmxrp;u4tex  oeilsfs rauvp;() reoxocio1oa rlneo s trxmxm3iy1om e ncils)a2uaum oo1tpxniictldfmDranvs;t0 ltomfctodfmtr uvi ()seurxr3oy4olteliet () Drax pou1ale iociys s rmu s () etoir ty1opD li s t)s2toir3nudlmt lfesat  Dur(mpot0aeen ietad a2eanmp t)altrir iydoateluvs;t  exmim nydalenlivt t a2urum nt0tpx mietas a2eln snt0trxnmr io1op e i sls  rxm(rpnu1op nmnvil(faruaur ;o0oltnmoetatlaDra(vp;u4altrxf3tytopteauei ()trtmxmpno4lle  netl(  2um(rpno4texoiietysfm ua( s (4areoifcty1opD  uvs;()setoirpnu4omt lictas  Drr(  no1opxoiociad aDulu o;t4texrmf3oo1lm r uvs t)s2tmxm3iydol  licia( a2umx o;u4tet  feiysfm2ra( o;(4aexnxfcto1oa eaneo;t0setriopny1lleemieil()a2trumo;u4olxoif3ild m umnmp;(4trtrxr3iodlatr i i (0s2xmim3ny1ll e icil( a2um(mpnu0tpeo fetadfa2emn on(4 lermocta1omDelu i ( s2tm(r iodlmenmietatf 2tr( p;t1aptoifcildls rauvs (4aetnmf iydlaDeanvi;s0s2xr(o nydll nmnctl(fsDum(mono0tetnmfcilsfm ua( snt0 rerio oatlmDe ueil( srxm(mpoydomt  ivtl(f 2rrum ;o0opto ocild s2uanvo (4tleniociadopDelnvo;() exrxr3oydomen ieils)srurxm ;t4oeeo iciys mDulnvsn()altrifciydlmteauvi s)tetrio iy4amt  nctas)aruaump;t4ape io3ils sDemuvsnt0alenio3ia1om r ies;t0s2to(m3iu1ole lieiltfs2uaxmoot0ale moeiatlm elnmsn(0arxomr3oa1lm  li i;s  etrxr nydlm   ies (fa2rr(rpou1aetomo3iad a elu o ()tlxnmrcia1opD  neo;s0tetr(r3ny1optnmivt t) Dua(mpoo1texn i3iytfm2ranmp ()tetomr3iatfp r ivs t  rtmxo3iudll nlfcta()artruro;o1tex  fcils aDulu o;t)treomo3iytoat lnvolt0 rxrim iu4lpt mncsat s2trxroot4tptomocilsla2rm( p;u0texrir ootom raneo;t0 etoxr oy1ame  neiat  Drrxm oo0aetnmfetad m2em(vp t) lerif oydomtr i o s0setmxm oy1omt  ieias aDrru  ou0tee mfciadfsDua(mo;(4aeenir iodoaD ai sl(  eurio iydlmeelnctls srtau pnt1tptomoeiad aDum(vs;u4aexoxo oy1lpt anei;s0s2uoxr oodapeemnctas sDumur ;t0olto f3ildfa rmu s u4tetrmf3oa1fm   neils0trurxm no1omee ivil(f 2tmx poo1aexnmocias a umu p;(4treoir iadomDeanes (0 rxmirpny1lmtn icils aDurxmonu0altnifetyslsDemnmonu)tltrxr3tatlaDrlueo (0 rumxm ny1am  mnct s)s2ua(mpno0tleomf3tyslmDuln p;()aeeomf oadlmtrlu i;( srum(m3iudopt  nesls arta(mo;t0apx iicild mDulnms;(0trxrmo3ia1fmt  neil(0setm(opiy1lm   fetltfarta(mooo0apto feiyd m umu s t)aeenircio1fa elivsls)t2xm(o nu4alt lnct t)srurum nu1texoiictatfs ean s;(0aexrir ia1fp rauvol( s2trio oo1am nlnetas  2tm(mpou0tet  oeiatfm eanms;(4trenifctodop  anes ( tetm(rpny1aptnlivt s sDua( o;u4tlx ifciltls rl( on(4tleoxoctydomt ln il(0 2tr(o3oo1ome lnvtasfa2taxroot0tex iocildfa uanmo u4trerxo oy1opDeaies s sexmio io4aptn iesl( a2uaum ;t4apxn i3iys m2el(mp;u)alerxociodopDr nvsls0 eur(r iy4al nlivtlsfartm(mp;o4texn f3tytfs rauvp;t0 rxrxr3iadoaD aieils0teto(m oy1op  lnvilsfa2tmumpnu0aexn ocildfa rlnvp () eerio io1opDeli o t0 2urio oo1apeelfei sf Dtm(rpoo4apxn icildla2rlums t4 lxrmo io1lm r neo ( tetr(m3oydoltn ict tfsDtmur ;o1tptomfetlt aDumuvp;(4areomr3oatfptr i sl()trtoxo3no1optemfes s s2trxr nt0ape if3iytfa2uln p;(4 rxrio tadoaD  nvi t t2tmiopoudllt lncilt)sDtmumono4olt mo3iydls ul(vpnu0tlxnxr3oo1lm r u s;t srto(o no4olt mivi s arumxr ;o4optn icils mDean p u0areomf oo1omt  uvi;() rxmiopou1alt  fct s  Drrumo;t1texnif3ilsfs2umuvs t0altnifcta1op  aneils sexo(r iodaptemfeilt) 2tax pno4alx mfciatfaDrmumo;(0tlxnxf3iadfptrlu s;s)seurxrpoudol emieslt  Dtrxrpnt4tet moeiyt a2emnmp;u4 leoxo oodlpDelnei;()truoxm3oudopeemicsl(  Dum(r ;o4tltnifcild aDua(vp (0tlxnmfciodopDeai il(0 2uoim nudlmt  fci s) Drmurpnu4tlenioeildfs elnvs (0 etomr iytfa r nvs;s srtmim3io1ol n icta()sruax pnu1aexnmocild a2uanms t4texomr3tydfaDrluvo s) rtmxo nudoltnlfes tfs2tau  nt4texnmociyt sDumn p (4trerif3todopD lu sl()t2xoim no4omte ivsa(f rurum ot1oee  fctasfsDumuvonu4texrmr iy1latraivo;(  rxm(mpiydam elfei t)a2raumo;o0aeenmietlt a rmu p t4tltrxo ty1opt  uvo;t)truoxo iodamt lfeias)aDrmxm oo1apenmi3iyd s uanmp (0trerioctytoat luvo;t)t2xm(mpoy1lmt mfvslsf 2ur(rooo4tlx mfciad mDrluvp;(0 exomo iy1optelneolt)srxmxr3oo4am emies t  ruaum no4tlxn oeilsfm rmumo;u) rermfcoatfm  anesl()texr(m nu1lptnmnviat s2rmx onu4olenmocildls2eanmpnt4artoxr3iodomDelueo t0s2urxo no4aleemncsa( a2rrx ooo0oltn feils sDeauvo;(4tleoxociytfm e ivo;(0trtm(opno1aptemietls)sDuaurp;o4aptomfeiadlaDean pnu0arxnxo3iatom r ues;()trtmir3oy1lm nmfetl() Duaumoou0texo f3ilsfs2em(vont0trtnmfcoa1oaDr n ols0srur(opny4lmte fei t)artrxmo;u4tetn feiat aDran p;u4aeerifciatomD lies s0srum(mpnu1amt lfesl(fs2trumono0tee  i3iytlm ra(mp;t)aleomo3ta1oaDr nei;(0s2xmio3ny4oltemnvtl(fs2rmxro;o0opxomo3tyslm2rlump u0alxrxf oodomte i sl( srtr(o3iodop   ictltf Dra(m no4ape ioeildlaDean pnu) lermociadfp rauvi ( s2xr(o oo1om eliesat)a2rau  ou1ope ifeiytfmDrluvp t4tltoxf3oatla eai ils0 rxoxo3nu4om nmnes tfsrtr(mpnu1apenifcils a umu s;t4aetnmr3ty1lpD  nvsls  ruo(rpnydam   icsls) 2ua(mo;u0texnmieiltfa2ean p;(4trenir iydfateln o s) 2uoxmpou4optn nei ( a2ta( o;t0oetn ocils s2uau snt4trtrmr ia1la raiei t0 2tmxr3iy4llte netat)a2rmxrpoo1olxn ieiatlaDuaumsn(4aeeoir oadlp   u o s)srurxr iudope  ies t  rtrx o;t4alx if3tldlaDuluvs u0arxnioctydlmtrlu s;t0truoio nu4oleemieiltf 2trx oot0aptoiieild m rmuvo () ltoxrcoo1lm  ai i;( truoio3iy1lptelnvil(f ruaur oo4tptnif3tas sDra( o t0texrxrcoa1fmt  n ils)t2
\ No newline at end of file
@@ -0,0 +1 @@
+iei (0 2um(o3oydol elivs t)s2uax pou0apen ociyt m rl(ms;()altrmf tatoa  ai slt)seuo(o oo4optelfetlsfa2ua(m oo1oee mo3iatfm eaumo;(0aleomo iy1oatr i s;s teumxm3nu4om  liesl(fa2umxmoot4tpx iociys s rl(vs (4 lenirciadlmtr uvo;(  2toirpou1lpt mnei (fsDrrxrpou4tleo fciadlm rmuvs;u4tlxnmo oadlp  luei t t2um(mpoodape mfctas)arrm( ont1aleoiicias m2rm( o u)arxomocty1lmDe u i;t0seumxm iy1omeemfvsa(f 2rm( o;t0openifctydla2eluvo;u0treriocoy1omDraueo t0 eumio3iudol n ivia(faruax poo1teeo ociydla2um(vsnu) etoif3iatla e nvi;(0 2umxo ou4op nlictas  2trxroot4oetnmo3iad a uluvp u) rermrciadfmDeluvol( t2xoir no1ll nmics (  rrmx pou4tltnmf3tlt s2emn snu4 ltomr3oatlat  nvi s)srtoim oo1ape lfciltfs2taum no4oex ii3iytlaDeauvonu) lxrxf3oatlm elu s;t srxrio3nu4openmfvsl(  rum(  ;u0tleomfcias m2rlums ()tleoir3ty1om ean i;t setoir3nodol   iet () rrax oot4ale iociytls2eauvs u0 ltnmfcto1lmtrlu o t0srtmim3oo4op   iesl( a2rm(rp;o4opx  oetyslm2um( o;u4tltrxo oadopD lnvolt truo(m iydolte netas)a2taum nu0opxomfeiysfm elnmsnt4alxrmrciy1omtr neo;(  rxm(r3ou4ll n fvsat  ruau  ;t0altn feild s ulnmp;(4 rxriocoa1lmteai s s)sruo(o3iudapee fet t) rum(rpno0tpe iocildlmDrl(msnt)aeeomo ty1fpDeauesl(0sexo(opoo4lltn ncia(  2taurono1optnif3iatla2uluvpnu)arxnmoctotlm eauvolt0s2xo(o oo4amee fvi t)sDrm(r ;t1tpe  iciyd m eln ont) etrmf3iadom  livi;( t2xoiopoodopt  fesa( s2raxmpnt0tle iiciltfm ra( pnu0 rxrxfciytopDr u ilt teumxr3oo1altn fcsl(f 2rmxr no4texomoeils s um(vo t4 rerifciadfmteaneils srumxm3ou4ol n fct s) 2rrx  oo0tex iociatlmDea(ms;u)aetrxociodlat  ivs t srxoir oudoltelicsl() Dtru ont4teeo ieilslm2rauvo;(0trxoioctodoaDraivs;t tetm(r no4alte ncia() 2uru o;o4opt  octldfsDeanvo;t)tlxrif totlptrai s;s teuoir oodap n nct ( aDtr(mont4oexo iciyt s2emuvs (0 rxnmfcia1laD  u o;s srumio oo4lmt  ncsl()aDrmurpou0oleo f3ils aDelu p u0trxoir3iadomD an il(0t2xoiopny4ll elneslt aDum(r ot1aeeniictydfs eanmo u) rxrxfctytlp  lu ols  exoim3ny4lm emfci (fartm(mpnu1tpxnmietas a2rmnvpn()altrxf iy1fmDeliei;t0 rxoimpoydale mivtls arraur ot1oex mocils mDeauvp;() lxrifcoydlaD  neils)tetoirpnydop elieiasfarrmumono1oetn fctyt aDeaumo;u0tlenmo3iodlateaies;s0s2xoio nodlm n icsls aDuaur oo0apen ictlsfmDulump u4teerxocta1lmte nes;t t2urxrpou1lleelncilsfsDuaxmo;u4alt io3tytlm2eanvpn(0 exnir3oy1lpDrluvi s)texoirpoy4lpte iviat sDur(r ;t0tpenifetlsfs ranvp ()aexnio3iy1optranvs s0trtoirpnu4ope lnetasfarumxrpot1aptomietlt m rl(vpnt)alxrmf3iatfateai o;s s2to(m oodole lfeilt)s2uaumpno4teen ociyd aDemnmpn()arerif iotopt lueo t s2xoio nu4lpeelfvt tfaDumur ;t4apen feiltfs2emumo t4teenmf3oadfpD li i;t)truo(r nydaltnmnciat aDumum oo0oet mi3ilsfsDuanvp u0aleoir3iy1fpD anvs s)sexrxrpnodol e fvtl(f 2tm( ono0oltnmfctys mDelumo;u0aeeomr iotfpD aieolt)setr(rpiudam nlfet t)srua( pnt4opxo i3ilslm uau s;t)texnif iytfmteai ols) rtr(r3iodope mnet t)s2tru  ;u1olenioeiydfa ul(vo;u)aeeomf io1oaDrluvsls0trtrir3oo4op elfviat artaxmoot1tpt mo3iatfa2rmums;(4 eenmr3io1fa  aivo t0teurim ou1lltemivils aDum(m ;o1tlx iieilt s ea(vo u)arxrxf3todfaDr nvs;t0s2xoxr3iy1op elfes sfsrtrx  nu0aeeo i3tasfa2ulnvo;(0tlxrxo todfpt lneo;s0s2toxmpnu4apt livi s)sDrru  ot4open ieiydlsDumn p t4aetrmo oadlm e ivi t)teur(o3nu4lp nmfesas srua(mo;o1aet micilsfsDemumsnt) etoxr3oytom rluvs;(0tetoio iudope  nctl(f 2tmxm ;u4olxnmi3ils aDeanms u4alxnif iy1fpDr ieol(0t2toir3ny4ol  mnvslt  rrr( oot0tpx ii3iad aDuauvo u) lenxo3tadfa eai il(0t2xmxopnu1lltnmicil() rraxroot4tltoii3iadfa rlnmp;u4alermrctytfaDeauvolt) eumxr nudopen neils)artm( ooo4optnmfciytfa2ranmsnu4alxrmociotlpte ivo;t  rur(mpny4omtelfct s s2trxmont4tlenii3iaslmDea(mpn(4arenmf3oo1fmt luvi s0s2urxm no1lm e icslt)artrxm no0oltn o3iltfa2ean o;u)artnmf3oydla  aneol(0 2urirpnydame  iet t srtau  no4oeenmociytlsDrmnms;t0 rerxr3oo1fatelu ils) 2xrimpnydlpt  ieil( sDrrx  ou1oleoio3iadls rmu s;(0trxomfctadlpDe u o;s)sexmim iydlme lfeia(f Dra( p;t1opt ii3iasfaDulnms;u4tetnxo oo1late n s;()s2xmxopnu4lp nlivsls) Drr(ro;o1altn ietydfs2ulnmpn(4teenmf3ta1fat  ueo (0srumim iudapt  iet t)arua(m ot0tpe  ietlslm rmn pnu4altrxr totfp e neilt0trto(r3nu1ll n ies s)aDra(m ot4tee mieiadfaDua( on(0trtnmo3iotom r nvo;t0trumxo3iu1om  mfvt ( a2tmxro;t1tltn o3tlt sDem(vp u0alxnifciytfmteai o;(  etoim3no1lmt  iciatf Duaxm nt4apen f3iltlaDuauvont4trtnir ta1oatraivs ()trxrim oodlmee ict s aDrrurooo1optomi3tysls raums t0trenmfctotfm  aiei s) 2xoxo oudlm  mfvs (fsDrmur ;t1olt iiciydlm2eln p;t4aeeriociydfpt  nvs t  exr(rpnu1apteliesls)a2raxmonu0ale mfetad s2emnvo;t0 rxnio3iy1lmDraieslt) eumxopiy4lle lictas s2raurp;t4oet mfctyslmDrmnmo u0artoxf3oa1omDr uvi s  rurir oodapte fvilt)sDraurpoo1tee ioeiydfm2eauvs;u0alxrio oydfmDraies;s  2umxo oydaltnmies (fa2uax ont0ape ii3ilsls2rmnvon() eeomrcoatfptraues s  rtoxmpnodol e nvtat aDum( pnt0olxoio3iytfmDrmn s u0aeeoxr3ta1fa rau o;s)srxmxm3nu1omenlfei sfsDrru pno4tpeo ieildfs rmnvs;u)aexrircoy1oa rlueo;(0srxrxm3iodopee nesa( aDrrxmp;t1texomi3tls a rlums ()aetoif oa1fpte ivslt0texo(mpnydalt mivt s aDurxmonu1oet ifeils s ra(vs t0trxnxociy1lmt ai olt tetrxmpoudoleemivi tfarum( onu1oee mi3tadlm rmuvont4arxomo3iy1fat lneils0sexrxopny4op  mfvs t arrru  ;u0alxnifeiydfsDum(ms t0artrif oa1oat lnvil( sexoimpoo1lmtnlfvs s)s2umu  no0tlx mo3iat s2rl(vs;(0 etnmociadfmtelivols0 rur(o iodale  fvia()srumur oo4apeniieiys s ulums u4teeomrctodlm r nvo;()trxo(m3ny4ol n ncsas)a2trurpou4aetoiieils mDulums;u4tlenxr3io1fp elnvi;( srxoir iydaltnmnci tfaDrmx oot0oetomi3tlslsDumnvo t0 etnxocta1lp rauei;( t2toio3nu4lme mictlt) rum(moot4aetniocildlmDeluvont4 rtomf3oy1lp   u sl(  rxo(m3no1apt livtlt)s2rr( oou1open octat aDrmump;t4 etomf tadlmt lnes ( s2toiopiy1ap n ivs s s2tm(r nu0oexomi3ild s uau s u0aexrir3totlmDrli s;()s2uo(r3nu4ol nmics t artrxmooo4aptniictas m2ranvpnt0 lxnmf3iy1fpt  ivo t srxr(rpnodlptnlnvsa( arumumpoo4ole io3iltfa eln snu0artnmo ia1opDean ols)trxoxm3no4lp nlfvtat)sDtmumpno0teen ietad a uluvs;(0 reoir io1om   u s;s)setrim3ou4al emfvi s  rrrxrpoo0tetnii3iyt sDulnvo;t4texnmf3iy1fpte uvo;s)t2uo(o3oy1openlici s srurxm nt4apxomiciytlsDuau o u4trenxf3oodfmDrau ol()t2xrio io4om  lfvsasfsDrr(mpno0ale  ietldfa2rauvs u) eerif iadopDeauvols texmxo3iy4apeelfviat arraxmpou0olto feildfmDrau p;(0 lenxf3oy1laDr n s;s)srtrxmpoo1lm   fvt s arraumpoo1tpto feiatls2emnmpnt0tleomr3ty1oa e ieilt)srxmio3ny4ll nmiciatf 2ra(m nt0oetnmoctyslmDea( onu)alenmf oo1oateaneolt srtmxmpiodam  lnetl(farrm(  nt4ole  oeiltls2uln o;t) etnxo tadfp r nvolt)srurirpiu4al n feils arumurpoo4texnif3tlt m2ea( on(4teerxfcia1lmt  n o s)t2umim3nu1ll n ieia(f 2tru poo1teenmi3tytla2rln sn(4 reoiocta1opte u sl() 2tr(opiodlltnmivi ()sDuau ooo4tpx mfeilsfm2um(mpnu)artoxo3ootla   ivs ()srtoir3iy1aptnlics s)a2rmxmpno0aetnifeiatlmDrmu s;u0teeoifcoytom eaieil(  euo(r iu4amee fvt t srrax pou4tet mictadlaDranvpnt)artomocoytla  aivslt)sruriopoo1am  micsl( srra(  ot1aee io3iatfaDrauvsnt4trxrmo oo1opt  i s;t) 2umim3oy4lme licsls  2umxr nu4aee ii3iysfm umu s t4alxrxociatfp eaivo t0 2um(o no1lm emnviatfarur(r no1tpeoii3iasfa um( o;u4 rxoxf3ta1omtrliei;( setm(o3io4alenlfcils  2tru o;t4tltnifetydfaDemums;t4 lxnif tadlpDeauvs;t t2xmir3oydll nmnciasf rum(rpnu0aeto octatls2uln s u) ltrir oodlptelivi s0 exriopoy4al nlivi sfsrum(mo;u4oltnmicils s umn p;t0 lenxf3oadomte neslt0s2trxr3oo4oltelfet s)sruaum nt1tetn feias m rluvp;t0aetomrctatlpt  uvs t)srxrio oudlm elics s) 2tr( poo0apx  f3ils a em( pnu4arxnxf iodfpteaieo;s s2uoxr3nudaptelivtlt  rrau  ;u0aet moetldlaDel(vp;t0altnir3to1lmDr i s;(0sexmxm3ou4ome lnet (fsrtrumpou1tetoio3ilsfm2rmn o;()trtnmocta1lpt livilt0truoxmpou4optelfcsas  2taxronu0aex iieiyt s umnvp;u0tetriocty1fat ln ilt sexoxm iudlltn fvtl(fs2ururpnu4alxnmoeiytfa emu s t)alxrxr3todomDr uei t teum(rpnudale  fvias)s2ta(mp;o4oltomf3iasfsDrlumo;u) rtrmfciotlatr nvi (  rxm(o iu4ope  ncslt)aDur(mpnu0tee  icias s2rln ont0 rermf3iotfpD aies;t0trxm(opnodole lici tf rurxmpou1tpxoiiciysls2ra(vp;(0 exnmr3oodfm rlneslt) 2xmxm oy1lle  fcs t)srrrxronu1oetomietltlsDeln o (4aleomocoy1omte neilt0teumir oydlmtnlictlt)sDra(m ou1texn o3ilt a ul(vp t4alxrmf oytoa eliesls0t2xrio3io1llt livias  Dtrur ;o4tpto feiltfsDraums;(0aexomo3iy1om  anesl(0 2um(mpiu1oltn icia(fs2um(r nt1tlto feiadfmDrm(vo;u)tetrxf iatfmtrai s t t2tm(m iu1lmt mfvsl()aDrmxrono0altn o3ils s2emu pnu)tltnmf3iotfmD aieo;s0t2xrirpnu1lpe lfci ( artaxmp;t1tpeo f3ildfa em( sn(4arxoif iotla  aueo t0s2tr(r nodape  ics t)srtmurp;o4aetniietasls ulnms u) lxrxo3tatfm   nei;t  2trim iodomenlfciatfaDuau oou1alt ioeiatfs2rmu o;u4 ltrif oodopD  i i;t0srumxr3iy1al elfvs (f Drmu oot1alx io3tltfs2rmuvs t4 lermociytfmDrlnes s) exoiopiu4lltelnetltfsDra(r oo4aeeniiciydla ra(vpnu0altnmf tydomDran s;()seum(m io1amt mncs (fsDrau pnu0oee  o3iltlsDran p u) lxrir oydomD  n ol(0 2toxrpiudllen ici sf rrrur nu0aexomoeiydfa ulnmo;u) rtomr oodlaDelivilt  etmxo3oudol n ivi ()aDrauro;t0oexo f3tlsfsDran s;t0arenmfcoydomDeluvilt0teumxo oo4op  mnesls srtaxr ;t0ope mfeiydls rm(vo;t0tleoir3oatomD ai o;t0t2tr(r iydlm emivs t srrrx ont4aleomoctadfa rl(vs;t) eeomo tadlp e ies;s tetoir ou4omenmneslt) 2rmxrono0aex ifeiadfm2ra( s ()trxoioctadfpD li ols  ruoxr ou4ll  lneiatfa2tr(mpnt1aleo iciydfm eln sn(0altoxfcoydlaDrlnvo;t0trtmxrpiodaleemfeiat) Dumxrono1tpen i3tat s elums;(0 exoifciotfpteluvsls) 2uo(r no4lme mnetl(f Draxro;o0tlto i3tatfmDeauvo;t4 rtoif3tadfm e uvil()tetmxm io1olt  fcil( s2tm(m ;o0tpx ioeiad s elnms u)texnxrcoadfm elu i (0sexr(r3oudapenmivslt) rrrx poo1tpeo oetld aDuluvs (4tltrmo tydomDrli s t0setm(m3ou1llenmnvia(f 2tr(r ot1aleo octatfaDrl(von()tlxrxociotlmte u s;s t2xoxm nu1lm elneil() 2ra(mpou4aptomo3tatfm uauvp;u0 etomf3totfmDe n s s teuoxopiy1lmt livs s)a2ua(rp;u4alen i3ilt m em(mpnt) lxnif tytfaDe iei;t0 2uoio3nydom   feilt aDtr(mo;u4alxnifetldlm eanvonu)artoxoctydoat lieo;s0trtrxo3oo1opeemivils)srrmumpnt1apt ifetyt aDemu pnu)aexrmf3tytoatr ues;(0texmiopny1optelfesatfaDrmx p;o4alt mfeiadfm rau o;u4 rerxo oa1opDe ueolt  eurxrpou1olt mnvslt)a2umumoou4alx io3iytlm2el( o () rxnmf iotlmt aivo (0setmxm nydlle  fet (fs2rmxmono4opt mf3ilt aDeluvs;t0altoir oydlateaneols sexr(opoo4optnlfvsl(f 2rmuro;t1tetnmoeiydfm2emnms u4 lerir iydfmt aivi;( t2umxmpnu1alenmicsls  2ua(  nt1alenmoctasla rmn p (4aeenio3oadfm raneol(  rxoxm3no4ll   fct tfs2urxmonu4openifciadfs2ra(ms;(0 lxnmf iytlpDrlu o;t) 2xrxm3oudop nlncil(fartaxro;t1oeeomociatfa2rlnvonu4 renmr3oydoat  i sl(0s2xmxo oy1ol e ict t)sDtr(rpoo1tlxnif3iat s2uanmpnu4arxomo oodfa elivi;s0 rurxo nudlm e netas aDrm(mpot0teeomoctadfmDelu pnt0tlxnxf3iytfpD li s;s  2urim3oy1lpen ncsasf Dra(ro;o0optnioeiadls ul( pnt0aetoio3iytlmDe u slt srtmirpny4am emics s  2uaurpou1tptnmfeiadfaDeanmp;u)tltoxr3oodom eaneo;( srxoimpou4ame livt tfs2urur ;t4aeen f3tat a2rmu pn() rxnio iydfateaivo t)t2tm(m no4lpe  ieias) rtaxmpno1open icilslm rau onu0 etnif3ia1lp e uvolt)srxm(r3io4am e fes (fsrra( oou0tptnmf3tldfm eln o;u4aetrircootfaD anvs s)s2xr(o ny4optn nesat  Dtmxmo;t1ope ifeiadls rluvp u4arenmo iy1fptrluvi;( trur(r nudaltnmiei t s2tm(mono4aeenifetls s ua(vonu) rxoxr todop eaivo ()srto(r no4op emfvs ()a2taumono0olt  i3ilslmDumnms;u0 rxrxf3tytopteau s;( teur(r3iodlm e nvs s  Drmumonu4alto ocildlm2emums t0tetrxocoadfat  ivi;t0 exr(r iu1ope lnesasfsrraur ot4alxo ieilt a rmuvon(0 rxomrcootfmDe ivil(0 rxrxm3ny4ap elnvtls)sDtmxrp;u0oeeo i3iytfa ea(mp;t0aleoif3oadla r i ilt srtoxrpnu1altelnvi ()s2rrur ot1ape mf3tydlaDea( p (4texrif3tatfpDelieo s  exmio3iy4lpt mncias aDrrurp;t4ale io3iys s eauvp t4tlxnif3todfmDrln o (  2toimpio4apenlnct sfa2rmxmpot1altomfetld m2uau o;(0 lxnxf iadlatrau o;t)s2xrxm3iudoleemncs s artrxroou1oexniieiatfa2ua(vo u4trxomo to1oa rluvs s  etrxmpiodaleemivi s) 2rm( pot4oet  octys m2eln s;(0alxnir tytfp r ivi ()srtr(m io4lp elfei tf 2raumpno1oeeo ietatla ean sn()alxomrcta1fmDeaieilt)srxrim3no1llt  iviasfs2uaumpnt1oetomf3ilsfsDemu s;t0tlenif tadoatr n o (0srtrim3oy4ope  feta(fsDur(mpno1alto fetas sDeaumsn(0tltomr tatoptrai o;(0s2umxm3oy4lpeelnei sf rtaurpou1opt  ociytls2el(vpn(4tetnmf iadlpDeluesl()setm(m iudlleelfvi s arua(  ;u0apenmociaslsDeaums;u4aeeoio oadopt aieo (  2xrim nodalt  fcsatf 2rmxm nu4teeoio3iyt s ul( ont)aexrmr oy1fp elneo;s s2umir oudalee fctatfs2ta(r nt1tlx mfeiadfa2rm( o;t) etoir3iy1oa  lueo;t0 etoio iu1lp n fvil()s2uaur oo0tleomieildfs rl( o t)teeoxf iytlpt ln s;t0 2umxm3io1ameelfeiatfsDtrx  nt1oee  o3tasfa2eanvsnt)areomoctatfp   n i t)seuoir io1oltelivsa() ruau  ou1tptnmo3tys a2uanmsn(0 etoio oatfptelivs;(  exoir io1ap nmfvtasf rua(rpou1olenmo3tytfm2ea(vp (4 lxnmrciytlmtrlues;t trxoxm3oodlm  mietas)a2umur ot0oeeomicild m2uanmo (4 exrxo oadop rau i t0 rtoxo3oo1op elnvs tfarraxmono4texnifetasla ulnvpnu0trtrmr3tydlp r ies;s s2uo(r oo4op   iei tfartmu ono0tpxnmf3tysfm rlnvs (0tltomfcty1op  aivi;( srtmxmpiy4ape livtas  Dta(mpno0aexnifeiys mDrmuvsnu)artoxfcoydoaDraies ( texm(o3oy4am elnvt t)a2urxrpno4apxo i3ildla rm( s u) renxo tatfat livs () 2xrxopou1llte fvtlt)aDua(mont4tpxoifciys a2el(vo;t0artrxf tatfa e ieil(  ruo(o oy1olen fcils  Dra(ro;u4alxo ieiaslm rmu pn(0aeermfciydoate uvi (  2to(o nu1lpenlivt s  2rrxrpot4tlx mf3tat s2rmums (0 eeoxrcoy1fmDrlivil()t2umio3iodoltnmfetls s2ua(m ou4tleo octytfm rl(vo t0alerxf3iatomt lnei;s srumxmpoudom nmiesat) Dua(mpnt4aetoio3iyd mDea( pnu0 rtoirciydfmt  nvo;t  2um(opoo1al   iviat s2ra(  ou1tltniictytls umnmo (4aexnio3oy1omt ln il(  2xoiopou1alte iesa()arrmur ou4tleo fctydfa ul( p t)tlxomo tytlmteli sls texrir3ny1lmeemfvsltfa2trxrooo1olt mo3iltls2um( p;t)tltoif oatomDeauvs;t  2urxopio1op  mfei t a2rrxroot4aetnmietysla2elu ont) eenmf3tadop elnvolt)setmxm nudomtnmivs s)a2raumoot4apxomi3iasfa umnmsnu)alxnmfcoa1fpDeanvs (0 rtmimpou4lltn ivsatf Dua(r ot4aee mo3iad s uan pnt)artoifcio1oaDe nei;t)t2ur(r no4ap e feils) Drrx pnu0optoiiciad m2ra(msn() exrxo3oy1lmtrlivsl(0 rxmxm ny4lm elnvt sfsrrrxr ou0alx  o3tls sDemu ont4trtrxo iydfmtr uvo;s0 rxo(o io1altn fcs t  2umu  nt1apxnmoetyt s2rauvp t0 lxnifciadopD au olt)tetmxopiu1apen fciat) rururont4oetn ieiysfsDrauvp ()tleoifcoo1lmDelneo ( srum(r no4lptn nciatfsrtm(mpou0tlxo i3iaslm ua(ms;u0arxnmo tatoatrliei t seur(opiy1lmt  fcs t)a2ur(rp;t0tptoiiciys a2emu p;t4 eerxr oodfmte i o ( trxoir iudlmtnlivtl(  rraxroou1texnifciytlsDua( o (4 exnif3oo1faDr uei;( seuo(o3iu4al n ivtl(f 2umumo;o0tptn octytls2ea( o;(0 lenxociodfp eanes ( s2um(m3iu1lpe mivi t) 2rrum nt0tlxn iciadlsDrm(ms;u0 lenxfcoodom eau o;s0 rumxopiu4alenlnviat)a2tr(m nu0olen o3iltfm eanmo ()aleoxocia1fa   u i (0srumxm3oo1omtn fetls arrmx pnt1tptomi3tysfs2umnvs t0alxrmr tydoa ranvslt0 euoiopiy4aptnlfet ( a2uau pnt1oltoio3tyt a2rlums;u) rxomr todlptr nesl(  2umir ou4ape lfcsat srum(  ;u0tpxnmieiys aDeluvs;t0alenir oo1oa eai i;(0 etrxo oy1lptnlnvi t)aDrrxmpno1oeto oeiydfaDuanvp;u4 ltnmfcoodfmtelnesls teuoio3ou4om nlfvtls)aDrax p;u0oexn ieiltla ranvp;(4areniocio1fatr uvol( sexoxm3io4omtemnet ()s2tm(mpnt1oetniieiysla umump u4alxomoctotopD ln o;t)teuoxopnu4apt  icslt) rrr(rpno0oeeniietydlm umuvo;(0trtoxo3iotlat ln s ()s2ur(o no1llenmnvs s)srurumpno4aexn i3tas mDemnvo;u0aetoifcoydfat lnei;s s2xo(m oo4apenmncta() Drau o;o1oexomieiydlsDrmumonu)alerio3io1lpD ln i;(  etmim3iu4oltn fvia(fsrumuro;u0tpto f3ils m2elnvp u4 lerxf3oodfpt ln ilt0texmio3oo4lptn fcsls  rra(ront1tetoifciadfm ra(monu0 rxnioctotlatrlnvo;s texrxm3oo4lme  fei t arra(m no0apxniictad m2el(vo;t) ltrio totfaDrli s;t0s2xm(o3nydam elnetatfs2tmu  ;o0tlto fetldfaDrmnmpn() etrifcoadlate nvilt)tetr(o3oudomte nesl( sDumxrooo4open f3tadlaDrl(vp;(4alxoxf3todom   u i () 2toir io1lpe mietl()s2urump;u0olt if3iat aDul(vp u)alenirciadom r u o s0trum(opnudlmen nctas  rtrurpnt1oexnmo3iat sDrmnmonu)aeeomfcta1laDrln olt0trum(rpiu4lm   neia(f Dua( p;o0opeo ieilt sDelnvpn(0texnxo iadfpt  ieo s t2ur(o3iy4om nmfesasfsrtmurpou0aetomi3ias a ea( pnu)aeermociydfa  lu slt  exoir ny4lpte fes ( srtax ont4openmi3ildla2rlu o;(4 rxrxo3totlp rluvs ()t2xoiopny4alt mnvi sf 2tr(r nu0tpt mfctadfm em(vp;u)areoirciytlptrluei;s setoimpiodal  liei t) 2tm(r ou4aptnifetlsfm2um(vs (4texrmf3totlm  lnvilt0seur(o oydol nlfei ()srrru pou4tleo fetldfa2ranmo t4tlxnifcty1fa  lu s;() rumxo oo4ape mivil(  2urxm ot0tlxniictysfa rl( on(4 exnmf3iadlp r n ils)trtmim ou1ale mfetl()sruaur nt1tlt micias sDum(vs (4altrmrctydomD lues;( srxrxopnudale mfvslsfaDrr(rpot0tpt moetyd sDel(mo (0aexnir oy1lpDeanvi;t)tetriopny1ame miet sf Dua(moou0alx ioetasls elu s;t0 renmf3todlaD  u i;t  2xr(rpiodol eliviasfsDtr(rpot4openmictys m rmu snu) exrif oy1laD  ueols setoir oudlptelncsls  Dumx  ;o4aeen f3tltlm2emnms u0teenir3tydlptraivi;()trxoio3nudal  livtasfartru o;u0tltn iciyt s2raump u0aeerxf iodlptr u i ( seuoxo oy4lme  nctl(f Draxr no0ape mo3tat sDemumont0teermf3tydop  liei;s)trtoio no1lmtelncslt) rur(r ;o0olx  o3iysfs2ulnmsn(0artrmocoa1opDranvo t0 2uo(opnu1am nmnesas a2rmx oou4oetnmfcildlm2ea(vo (0 lxrxo iytoaDe i ols0srtriopoo1amtelfct t)s2taumo;u1apxoifcild m el( o;(0alxrmrcoodfptranvs t trtmxr iy4openlncia(faDrrurpno1tptnmi3tld mDem( o t4teeoxo totlmteluvi t0srxmxmpnu4ap   ieil()a2um(mpot0aeeo o3iys a ea( o t)alxrmo3todop  lu o;() rtmirpou4lp elfvi s)a2tmu o;t1aleo fcias aDum(msn(0texoiocty1fp r ivs;()trtm(rpno4lm nlnei s arrmxmp;o4tpxnmfciyd mDrl( snu4 ltrmf3tydfm   ivs;(0 2xrxr3iydlpenmfcil( a2ua(r ou1aleoifetatlmDelumsnt4aetrxf tadoa eli s s  exrxr oo4lp nlneilt s2ta(rpnu0alt ifetyslsDem(mo;t)tleoxr io1fpDr nvo;t0setmxmpoodameelnci s)sDurx onu0aetn ictad m emn o;u) eenirctatopDrluvolt t2tr(o3iy4ape mncsa( a2trx p;o4tle  o3iytfa rl(vs (4tlerif3tydfaDeluvi ()sexoiopny1ape  ivt ()srum(m oo0tlt  o3iadfmDelnvs t) lerxo iy1op  auvi;t t2tm(o3nu4om nmfvtat  2tru oou4teeo oetys mDrmu pnt4arenmo3tadlaD lueils  2trxr nydole mies ()aDtrur nu0oeenmicilsla ul( s t) rxnio iotlaDeai sl() eurir3no4ape  icta()aDta( pnt1opx  feiytlm2ul(mo (4 ltnif oo1omte u o t t2xo(mpnodlpen fesasfarrrur oo4tex  f3iys a2rmn p;u) ltomf3oa1fp e uei s0 rur(mpoy1al nlfctas)aDrr(r nt4tetomo3tlt aDrmumpn(0 rtrxf tatfateaneo;t trxmxmpoo4optemfvta(fa2rm(  ou1aex mfetatfs rlnmpnt0trtnmr iodfp ranvs (0seuoxmpio4al n fei t s2rax poo0ole ioeiyt s2uauvs;()trtnif3ty1op raieolt trtrxo iodap   nvsls)s2tax  ;t0altoifciydfm2ea(ms;u4trenmo ia1oatrluvols) 2xmxm oudlleeliviltfarra(root0oex mictatfa2ulnmp () rtoiociy1omt  uei ()sexrxr3ny1op emnei s  Dur(  oo0aet ifciasls2el( p t)tlxrmo3ootopt ln o;s  rtm(o iy4apt livtl()a2trxmp;o1opx mi3tatfs2rl( p (4tlermf tytlaD aueo;s0 2toxmpoo4omte fetat)srtrxmono4alen ietydls uau pnu) rtnxr3ta1opte nvi;t0s2tr(o3iy1optnmnetls)aDtmxro;u1apt iietatlm ul(vo;u) rxoir iatom r ivol(  exrim3no4al  lnei ()a2tax pou1tltoiiciytls rlnvs t)teeoxr3iytfat livo t0t2uoxr3ou1lmtelfvt (  2rmu pnt4tex ii3tysfaDrlums (0trtriociatfm  lneo s0t2toxm iudaltnmfcs s)srtrur nt4aeeomfetld s2rluvo u4texrmfciy1omD ln ols  2ur(mpno4altnmiei s  rtmx  nu4olenmf3ildlm rlu o;t0alxnxf oadfatrli i;(0seur(opno4lpe lfeta(fs2uaumo;u4tlxomiciydla rmuvs;t4arxoxo3iotfat anvol(0srtmiopnu4lle lictlt) 2tr(ro;u0tpto oeiatfsDemn p;()tetomoctytomt au o s0 eur(rpio1lpt mnesas)a2uaxro;o0aeenmicilsfsDuau sn(4 rxomr3oatfpDrlnvo () rtrio ny1ol   fctasfsDtru  ;t1aexoioctld s emn p;t0 lerxr3totfa  ln s t0teto(rpiu4apt lieiasfs2rmxm oo1tpxo o3tlslm umnmo;()trtnmo to1fptrlivs t)texrim3nodolt  icta( s2taurpnu0apxo f3tltls uanmpn(0trenxo iotfpDe ieil()trtmxmpoodom nmfcsas s2ta(mpoo1tpxnmfetysfm2uln o u4 reoir tydoptranesls texr(opno1ame  fes s  Drr(  nu0oee  i3iatfm emn snt4 lenxrctydfm  lu s;() 2umxo nu1ll n fvt s)sDta(m no0alx ioetyt sDuanvsn()aexrxfcia1la  li slt)t2uo(rpiodlmee ieia(faDuaumpnt1tltnmieias a2eluvo;(4 exoxo oatlp  lneo (0srtm(r ny4lmtnmfvsl()artrump;u0aee  f3ias m ra(vo;() lxrmr3ta1la e nvsls texrio iy1oleelivil( arta(roou4aetnioeiysls elnmp u0trerifcto1omDrln i t)s2xoio no1ope lncta()aDtmumoou0apxnmf3ilsfa ra(vont4aexrmf iytlm elivs;s)setm(mpio1omeelfesl( sDrrxm ou1aptn fciysfaDeauvs;(0aetniocoydopt an ilt  exm(o oo4ape mneils) 2tr(r ou4optn fctlsfs el( s (4 rerxo oatfm r neo t0 rurim3iydlmte ivsls artru o;t1tlxoiiciyt sDel( p;t) lenxo oatfmtr i ils t2xrir3ou4lpe  fcias)sDtmx  ;u1aex  i3ilsfm2rmumo;(0 renxo tatoaDr nvo;()t2trimpnodlpt  fci t)sDrrxrpoo0alt mi3iltla2rl(mp t4 exrxr iatoptr u s;() euo(r oydll elfetl( s2umu  ;o0opxniicilslmDuauvs;u0arxrxrciatopDelneils) rto(r ou4op emfeta( arta(  oo1apxomfeiat m ra(mp;()trtnmo3iytfpDeaiesls0 exr(opiy4lltn ivsa( aDum(rpoo4tet io3iydlmDuanmont0 etrxo todopDeauvs t0srtm(mpno4omenlictatf rrrxm nt4aexnmictltlsDea(mpn(0artrmrctotopt luei;t0texrim iu1om nmicsa( aDuaxm oo4tlxnmo3ild m um(mo u4artrmfctodop e ivo;(  2xmxopnudll elfeils) Drmu  ou1oexnii3iysfs uanmonu) etnmrctadlaD  i i;s0 etm(m3ou4apeemici ()s2rrxrono4tpeo ietydfm2ulu on(0 lxoio3oatfaDelivs;t srxmxmpiydam   fes s)aDrmur nu1alxo ictlt sDemnmp u4aetriocio1lpD livsls s2xoxo ou4ale liviat  Dumxmpnu4texnifetadlmDumnmp (4trtrif3ty1opDrliei;t) 2tmxm iu1om  lfvs ( aDra( pou1aleo o3iysfm2rauvo;(0tlxnxocio1lpteauvs;s0t2uo(m3oodap  lncs s a2ta(m oo4apxomicildlaDeluvon(4arerxo iy1fptraneo;t) 2trimpiu1olee ictlsf Durxrpnt0aleo ociydfa rlu p;t)altrif3tadlmDeauvs;t)tetmir3nydameeliesltfs2tm( oot1apt  f3iadfs ean sn(4 lenxr iotoa eaivils teuoir3nodol  mfctas)sDumx  ou1aeen o3iyd s raumpnt) rxnxo iadlp  lnvs;t0s2umxopoo1lmtnmfcslt aDta( ono4olt  octys s2ulnmo;t)artrif ty1om elnvi (0srumim iudlm n nei t) rua(m ;t1oeeoifeilt sDra(vsnu0artoir iy1oatraiei ()s2umirpou1alt mfcsa(fsrua( pot4tlen ictlsfm rmn s u)aeermfctadlmtelivols t2urxr oo4lp n ncils  2urumpno0tltoiiciadfaDrlnvp u0tetrio3oo1omt livsl() 2xrxrpny1lmt mfci sf rrm( ooo4aeeoif3iadlaDrlumpnu) eeriociodfm raues ( trxrio iudale lnvtas  2ra(root0oetomietlslsDra(vo t0aexrir3ty1fptrai i s0 2xoimpio4lpeelfesat)aDur(r ;t0olxo f3tydfs2ul( onu4 leoir tadopDe i s;s)srtmxrpou1lmee nvias sruauronu4olxn f3ias aDuluvp (0 etrmr oytlmDrlnvol()srumir3io1apenmfcils  Dtmur oo0tpe  fcildlmDeanmsnu4alxnifciydlm r iei;t) exrim nodlltn fvsat) 2rau onu0olx  ietltfs rauvs u)tltrxoctotfmDe uvs;s  2xrir3iy1ll nlnvtatfs2uaur ou0texoif3iyt mDelu s;t) ltoif todomD an ils0srurio3oy4llt mfesas a2uru pot0tlenmociatlm rln o u) lxnirciatlaD  neslt0trto(m3ou1am n ivsl() Dta(r nu4oetnif3ilt a rmn onu) etoif iotfpD ai i;s0setoirpno1lpen fcsl(farua(rpoo4apeo f3tadlm uau ont0trtrircia1fa e ueilt) euo(m iy1ol  lfviat s2uaxr ot4alx miciad aDranvs;()areoio3iy1op  auei;t)teuriopny4llen ies tfa2urx  ;u4tetoioeilt m umu ont4 exrxf3iadla rai ols)t2xrir iu4lm  lies (fsDtr( pot0tpxnii3tytfsDea(vp;u) lenxo totlm   i ilt  rtoxopio1om elfes t)srrru oot1oetn fctadfsDrlu snt0artnifctydlm r neslt t2tr(o3iu1llt lfcs s)artrxrpnu4alxnmf3iltlm rln pnt)texrmf3iytlat  iesl(0seur(m3iydome miei t  2trxr oo1ale io3iasfs umu o u0arxomr iotlaDeanei t)trtm(mpio4lpenlfetls aDtr(rp;u1alt  fctls m2rlumo (4alerxo iotlpt lnei t) 2xmxm iu1optemicsa( s2rrxm ;o1oee moeiyslm elu sn(4alenmociydlmtran o t0trtm(o3iodomeelfvs tfsruau  ;u0tptomi3ildfm ulu s;u4 eeoxf iadfmDr u o;s0 2tm(r iydomen ncil(faDtru  ou4aetn iciys aDea(vs t) rxoif3iadopt liesls0s2tr(m ou4lpen nvt t  Drmu onu1tpxnioetys mDrlnms;u) exoif3ootfat aiei;( setoxo3nudop elfesa( s2rau oot1aexn icildla ua(vpnu4tetoxf oodfpD  n slt0 rtmimpnudomt  fcsl()aDuauroou0opxnifeiyd aDel(vs;(0 reoir todlmt livi;s) exmxo3oodole mivtat sDum(r ;t1tpxo fctysfaDum( o;t4tetnxo oo1lat  n il(0 etrio iydame lfvil() rrmxroou1aee ioctyslaDraumo;u4alxrircty1lpDe i i s)srtoirpiodlpeelfcsls)arua(m ot4olx ifciat mDul(vo t)aexnxfciatlateanvi;t0seum(m ny1am emnvsltfsrur(r nt1oee ioetlt sDulnms (4 rerxo3iatlptrlivolt  rxoim3no1omtnmivs tfaDrax oou0tlx mi3iltlm eauvs;u0 rerir3io1la   neo;s0s2xrxr oy4lmt mfeia(f Dtaxroou0oltniietysfmDul(mo u0teenxr3iotoa  livi ( s2tr(r3iy1lmte ivslsfsDrmur no0oltomf3iasfm el(vont)aetnmf3iodlaD  i o s) rtmxm ou1amtemfesls) 2rm(mp;t0tle iieild aDrlnmp (4aeenio3tatfpteai s;s  rurxopny4alenmneil(fsDur(moot4altnmfeiadfs ul(msnt0trxrif tydfpD auei ( sexm(mpnu4om e iesas) Drmx oot1openmf3iys s2elu snu)aexoxf3to1fptrai o;(0 rxmir iudapeelnvt (f rtax ooo4ale mi3taslsDel(vp t)altrmo3ta1faDrau o;( s2umimpno4opeemfcsas srur(r nu0tpxo fciatfaDuan pnu0aeeomrcoodlat  neolt0 ruo(m oydomt lfviasfsDtrum ;u4oee  fetytlsDuanvs t4tetrxr3ta1lmt  ueo s  eurxmpny4lltemnesls srtmu pnu0tpxn f3iyslm umumsnt0 ltomr3ia1oa elieils trxo(opiydomtnmiei (fs2trx  no1tetnmoeiytlm2ulumo t4 reomr oydla   n i;( teuoxmpnu1apee ici ()s2rmumpnu1tee  oetlsfm uau p;(4tlenir3tadomDeanei;s) 2urxrpoo1lpe lnvsa(  2rmx p;u4olx iicildfm2rln p;u0 lxrio oodlmDe ivsl()t2urim3nu4ope  nvi (fsruau  ;t0aexo ietys m2ea( p t0 exrir io1fm eluei;(0trxmxm io4optelfesa( s2tmuro;t1opt mi3ilt sDeanmpn()arxnxo3oatfm eauvo;() 2trxm3oy1lmtnlfetl( aDrrx  ;o0oexniieiyt s2rlnvon(0trerir oatom  lu olt setm(r3io1amtemivs t  2rax ono1tptoiieiytfa ea( o;() rerifcoatfa   ivo;s0t2tm(r nydal e feiltfs2rrx  nt0aeto fciasla rm(mon(0trenmfciytfaDraieo;(0 2toir3oodope lnetlsfsrrm(roou0opxoif3tyt s eanmonu0trxoio3ootla elnvilt s2xo(rpou4am  lfesa()arrr( p;u4alxnio3iydfa2ulnmo;u4artrxf3iadfmt auvs s) rur(r3no4al e nvtl(fa2ua( ooo1ope ifeiytfaDra( pn() eeoxo3tytfpD anvo;( t2ur(r3iy1lme lics ( sDumx  nt1aetn f3iadlm eanmpnt4tetnxf3oytomDrai s;() 2xo(r iudlpenmfvtltf 2taxm ;t4tlxomo3tydls rlump;u0alermo tydfa  anvs ()seum(m iudapeemneiat  2rr( p;u1tpeomfeiys aDel( s u)alxrxrcoo1lmtrlnes t0 rxoxopiy4olt  icslsf Drmx pot4oeto ociltfmDuauvpn(4 etoxr3oo1faD  ueo;()srtrim no1ol  mneias s2trum ot4tle  octad a2rmu o;(4 etnifciodomtraneils)tetrim3oy4amen fvsa( s2taxr ;t4aptnmietldfsDuanmp;t)trermo3iotlmt anes t0srumiopiydolt  fvslsfarrax oou1opt  f3tlt s2umnms;t0 eenxfcoytomD lies t0srtoxo oudlpenmnctas)arum(mp;o1tpx moeiydfmDua(vonu4arxnmfcoodfpDe ues;s0truoir oy4lltemnvi (fsDrmx  no1opxniietydlmDuln onu0 rxrmrcoy1lpDeaneolt) rtoxo3nudlle lfctatfsrra(monu4apx if3iltla emn o;t) rxoir3io1fmteluvs;(  euoxopoodal nmfei ( s2tm(moou4oexnio3iys a umnmp t0trenif iotfp e n ilt0 rxmio iudoltelnei (  2urxmo;t0tltn fciydlm emnvon()teenio io1la   nvols0t2tr(opou1lleemictls)a2rrxmpot4oet  o3tyd m umu pnt0tlenxo3ia1laDeai i ()s2toxo3oo4oltemneiat) rrm(mo;t4ope if3ildfaDumnmp;(4tleoir3ootfa   i olt) rxoirpiydapee ivtls) 2uau  nt0apxoii3ildfm2ua(vsnu0aeenio3iy1fpDranvs;()setm(rpnu4opte fvt tfa2urx pnu4tetnii3tyd a2uanvp;t4 eerxf3iodfm  livo;t0 euo(r io4lltnmivtas sDuaumo;u1teeomociatls2em( o t4arxnifcoo1fp elivs s srum(rpoo4omeemiet sfa2ra(mp;u1tlxoio3ildls emuvp t4trxrio3tydfmD  uvils)sexrio nodlle mivi t)a2trxr ;u0aexomociadfaDra(vpnt4aetnircoy1laD auei s t2uriopnudapt mnvt (faDtmxmo;t0ope mictytfs2ra(ms t4altnirciytlmDelnvs t) 2tmim no4ol  mict ()a2ra(root0apxo feiatlaDranmo (4arxrir oo1op  aieols0srxmim io4amenlfeiltfs2raur nu0olen fciatls2eaumpnt)tltoxo totomt  i o;(0t2trxmpoudll   ict ( artrx  ou1opxomieiydfm rau sn(0arxrmo ia1lpDeau s;t) exmxm oodllee nvsat sDum(rpnt1texn feiltfm2elums t4 lxoir3ootfpteanvs s)s2urim oydame  nvs s)a2tm(m nt4opt ii3iydfa ea(ms t0trtoxo iytlpte neol(0s2toio3iu1apte ics ()a2ra(monu1apx  fcild m ulumo (4 eenxf3tytlmDean ols  rumiopiy1optnmicsasfaDrmur ;t4apxoii3tatfaDemnvpn(4 exnio iatfat  i sls s2xmxr iodom n fcs t)srta(rono4ope  feiysls rm(mp u4 eermo oa1omtr u i t0 rum(m3iu4omt lnvt t  Drr( ont0opt  iciatls eln o (0tltrmocootfp  livsls0s2toxm3nu1lp nlnvs t) Dtaum nu0texoifctytfsDraumpn()alermrcoy1lat  ivs;s0s2trxo no4lme mnvs sf rrmx pnu0alenif3iytfs uauvp;u4 ltnio todlatelivo;(0t2uo(r no4om n ieilt) Dtm(ro;u4tee mociys m elumo ()arenif oydfaD aues;(0 euoio oo4lmenmfei () rurxrpno0alxomi3tad s el( p;u0tltoifcia1fmtr uei t)sruoxopoo4omenlnet t) rua(monu0alx ifcildlaDeau o;() lxrxo3iy1latelueils0srur(o3iudaleelnetls s2tmxmo;u4tpxoiieiltfsDeau s;t4 eenmo3todoat lnvol() 2umxr io4ome  fci s)sDurxm ot1tpxn ictldfm em(vs u4 exriocoatopD lueils0 ruo(m3iu4lltelncias  2tr( p;u1tlxomf3tatfsDuaumo;()alxomfcoy1lptelivs s)srtrirpoo1altnlivtl( a2rm(mo;t1aetnio3iyt a ua(msnu0 etrmoctatlmD  uvs;t) 2umxmpoydolte ivilt)sDurum no0oeeoiiciltls uauvp;u0teermrctatomD  ies;() rurimpiodoltnmict sf 2ur(  ;t4tptomfetys s2eluvo;u0 ltrxf3to1omteli i s) 2trim3ou4llt liciasfsDtax p;t0aeeo iciydfa2eluvpn(4trxoio3iadlmDean i t) rurim iy4omeemfvtas) rrr(m ;o1tpenio3iaslmDeauvo;(4 exrir todfpDeaies;s tetmxm ou1ape lici t)aDtaxro;u4oexomietlt m umnvo t)aexoifcoy1fp   uvslt trxrxo3io4lp nlivt ()a2urx p;t4ape iieildfa2em(mp (0teeoir ty1opte nvil()texoxm3oo4ll  lies ()srtau  ou1open fciatlsDel(vp u)tlxomfcta1laDr ivol() exrim oy1lp nlfvt s)sruaxm nu0opx if3tyt mDrm(vp () eermf3tydfatrln slt0s2xrirpny1olenlivsl(fsrtax  ou1oeen oeiydla2ran s t4trtrmf3iodfp e ueols)t2ur(opny1lle  nct sf rrru pnt0alt mociaslaDeaump u)aetoir3ta1fatr nei (0srtmim iu1omt lfesl()srra(mpot0tpenii3iatfmDua( o ()trerioctydomDelnei;t) 2urxm nudlmtn iei s srrmu  ou1oet ii3iysfmDumuvp;t0 exnio oodopDean i t) etoxrpoy4oltnmictas)srra(m ;u4tee mo3iydla raumpnt4tlxomo oytlat  i s ( t2xoirpno1ope lfesa( a2tr(r ;t0altomfciasls em(vp u0teeomrciatfaDeluvi (0srtmxm3iu4ap e ivias) 2tmxronu0olxnmoetyslaDem(vo t)teeoir ty1lp elues;s) 2xmxopnudal nlfvsl()aDtrxrpnt0aptoif3iadlsDel(mon(4 lxoif iotlm e nvi;(0 exoiopoydaltelnesl( a2um(roou1opto o3iadfa umnvsnu4trtoiocoo1fa raivi;()t2umxr iudaltn fvtas  rrru  ;u4oeeomo3tlslsDua(ms;(0tlenmf iodopt lnvil()t2xoxmpou4lmtelfcsat  ruaurpno0optnifetydls umu onu4altrio oatop   n i;t0 rtmxm iydopte ncsl( aDtrx onu0oex  i3iasfmDem( pnu4aetnxfcoadomtrlivo;s)setrim oo4lp emnvtls)sDra( pnu4oex miciatls rmn pnt4 renxr3oodlmtrlueilt0srtrim3oydlm nmncsat  rrm(m ;t0tltoiieildls eanvs u)tetnircoo1oaDr neo s  rtoim3oydolt mfes s)aDtaxro;u4aeen fctatfs rmnvpnt0trenmo3iatlptr uvi t sruo(o ou4lleelfcils  2tmu o;o1aeenmo3ilt sDuaumpn(4 rtrioctotfp r ivs s0teurxm ou4ole mfcslt)aDur(mpoo0olt iiciydlm rlnms u)altnxrcia1fatraneol( t2ur(opou4lltemfcslsfa2urxr nu4opeomietltfm2rm(msn(0tlxoir iytop e i i;t) 2tmxo no1altn fetls)s2rmum nu1opeo fcilt aDrmn o u) lxnmr oa1lpDr ueslt setmir3oy1apen nci s) Dtrumo;u1tex io3iys aDeaumsnt4arxoir3tydlmt ln sl( seurxopnu4ap   fcs (fsrum(rono4opxoiictlslm2el(vont0aexomf3iytfmDelnes;s)sexrim iudoltnmnvslsfsDrau  ou4tpe  octltls2rmnmsnu4 rxrmociydoa   ieols0trurim3iudlltemnvs sf Dumurp;o0opxniociat m2eaums (0texoircoadopDeai ol(0sruo(opou4lpt mnci ()aDtm(mont1oet mieiysfm2uauvont4tlenio3iatfpDrln o;(0sruoxm3ny1lmt  neslt) rta( pot4oexoiicias sDuaums (0trerifcoy1oa   i i t)t2xrim nudlpte nvil()s2rmxm oo4tlenmo3tatlm2rl(vont) exnmo to1oa eli o t  rtm(opiu4op emncia( aDum(  oo0tpx ifciatfaDumumo u)tleoxr3oy1lp eln i s  rto(o3oy4aptn feils  2rmx pou1tlen i3iatfa2emnvp;u)alenxrciodlaDr ivs t0 2xriopoo4oleemivt (fsDrrump;u4ale iieild s2ea( p (4teeomocta1fpt  ieol( trxo(r oudolee nvil(fs2rax o;o0tetniieiltfm2ulnmo;u4altnmo ootoaDeaieilt s2umim3iu4lle lfetltfsDrr(  ot1oleoioctysfa eanvo u)aexnxf ootfpt  n i s0 rxo(mpoudop emnet sfaDtrxrp;u1tetomoetas a2rlums u4arenir3oy1late uei ()trxmxm3no1amte fcsl(  2tmu pot0opto ieiat a rmuvp;t4 rxoxo3oodom rlnvo;s)s2toxm nu4ale mict ()aDtm(  no4alx mfcilslm ra(msnt) ltrxocty1opDe ieolt0srxmxm3oy1om nmneta( aruaum nt0tpenii3tas a2eln s;t0 eeoxf to1oaD aneil( tetr(r3no4lpenmfetas aDuaumpou0oex ifetadlmDelnvonu4tlenir oatoaD au slt0trtmxo3oy1ll e fesltfartrxmo;o1oleo i3iadlaDran snu4tltrio oatfpDranesl(0t2uo(mpnydole mnes (fsrumxr no0altnioeilslsDum(vp;t4altoir oadfat aues s0 ruoxm3iudaleemneia( artm(mpnt4opxn fcilsls ua( o;(4aexomr tytfat lu i;( srurxopoy1al   fet ( a2tm(mo;o4apt mfeilsls2ranvo;u4 lxnio3oytomtraneols)sruoxmpoodal  micta()srrr(mp;u1opxnmf3ias m eauvp;(4 eenmocoa1fate nvs;s) ruoir3nudlpeemfet sfsrtauronu0aeto iciydfs ulnvp (0areoio oodopt livs;s teumxo nodlpe lnei () 2ur(r no1olx  fciyslm umnms t)tlxoio oy1fate neo (  etm(m3nu1ole  iei s)sDtrump;u1opx mfciadlm2eln s;(4tetnmo iy1fpDe u ilt  2to(o ou1open fvil( sruau poo0apen feildfsDrlu p;()altoio oodlp eliei;()s2urim nu4lm e nesas)arrm(mpoo0tetn o3tytls um(ms;u)arermo3oodlptr i s;()trumxo ou1lme mnvt tfartaum nt4olxnmietaslm ulump;u4arxnircia1fptr neilt0 euoio3iy4altnmfes s) Dua(moou1tpx mfctldfa2uauvo;t0tlermo3io1op eaiesl(0 exrxr3iudol elivi sfs2rrurpno0aleomi3tltlsDumu s;t0arxnifcoodlmDeanvs;t)s2xm(o3nudapenmiei sfsDumxr nt0tptomi3tat s2ul(vp t4trtoiocty1oaDr ies;s0trurir nydom  mnetls)aDtrurp;t1apt ii3tlt sDrmumsnt4tltnxo tytoatr i i s) 2tr(m3ou4lmen ietltfarraxront4aleo feiatla2rmnvs t0tlxomr iodomD aueo;t) exo(opoy1oleemnviasf rua( pot0tex  feiytfa2uanmsnt0tltoif oadfpDelnvolt0t2uoir io1lle mietas  2tmum ou1olx mo3iyt aDrl( snu)aetrmf io1lp e i ilt0tetoio3ny1ll  lieiasfarra(  ;o1ape moctatls2eanmonu)aleoio3oo1fmt  i ols) eumir iu1alt lict sfaDrauro;u0teeomieilsls elu snt) ltnircoadlm raivo s0 rur(opoo1al elfci sfaDurx ooo0aptomfctytlaDeanmp;()tlerif iodomD  ivil(0teum(r nudameelfvt ()srumur ou0tet mfeiatlmDrmnvo u0alenir iy1faDranvi;t  2xo(mpiy4lltemfct ( sruaxmoot1olt mietadfs2em( o (4 exnmf3oodfpDrai slt0srum(mpno4ame  fes tfaDum(  nt4oeeoio3ildfa rluvont)aeenioctytlp r i o t0 rxrio nydop elfes tfartau  oo1texo oeiydla rm(mo;t4tetrmr3oatoa rlies t  ruoio3oudlp elfvtas  Dtrur nt0apeoioetysfm ulu p u0altnmf3iadom rlueo t)s2um(r iy1om e fvslt sDtau  ot4tpxnmfeiyd mDuln s t) rxrxf3oatopDeliei s0tetmim iy1apenlfeias  Dur(m nt4oexn ociatls2ea(vp t4aexoir3iytlaDeauvo t0s2um(o3ny1ape  nviltf 2ua( p;o0teeoifeiltla2ul(mpnu)aeermo3iadoatrlneilt0s2to(r ou1lmen ivtl()sDrmumonu4optomo3iytfm elu sn(0 rxoif tytopDe nei s) 2urxr oydam  lncta( s2tr(rpou4aeto ictltfsDua(vo (0trtoxfctotfp  lieo ( trtoxopiydap nlfcta()sDumuronu4optn o3ilslmDrlums;(4 ltrir3io1lptelivsls) 2toxopnu4ap nmiei t) Dtau p;u4oltoioeiyslaDel(vp t)altrxfciy1omDelu i s s2uoirpny1lp nmncils arrmumpno0tpx mictadfmDrl(msnt0altrirciodomteaueols)s2tmio3oo4ll  lnvsatfs2tr(  oo1altn feilt m rl( sn(0trenir iodfaD  u i;() 2urxo3io4aleemfetlt srumx pot4tpxo ieiltfaDuan pnu0teerirciodomD lu i;s0 eumxr3nydlmt  ncsas a2rmxm ;o1aee micilsls2em(vp;t0altoxfcoodfa r ieo;s  rumxo3ou1ome  fetat  rra(mpot1olxnifetld s2umums t) leoxf iy1lpt  neo ( texmirpiy4amen fci (fsDtrxm ;o1oeenif3taslm rlu s;(0arxnxf tatfpDeluvols) etriopny4ope mfcsatfaDtr(r nu0tle  i3ilslm rln s;t4 ltrif3oodfmte uvs;s)setrirpou1omtnlivtlt sDua(root1aexo ociys m elums;u4trxnmr3oodopDr neils)s2umxm iy4ll  miei tfa2rr(roou0aptn fciltfsDua(vo;() etnxf iodfaDe u olt0teumxrpno1alt  iciasfaDrru  no0opeo f3iadfm2ra( p;t4artrmr3todlaDeanvsls0 2umir no1omtnlfcsatf 2ua(mpno1olt mo3tasfs2ulu p;()arenxr oatlm  li ol( t2xrxrpoy4omte fci s s2um(mo;t0tlt mociydfa2eauvpnt4texrir tydomDeanvs;(0 rxrxrpnodap  miesat artr( ono1tex ii3iytlmDul( o t0tetoxo iodoptr i olt0tetoxm oo4ap emnvs s)aDumxr ot0tlenmieiys s2ulnmo ()teenxoctotfatrlu sl(0s2trim nu1lle lietas)aDta(mpot4aptnmf3ild m2rluvs;u4trtnxo3ootfp r i sls0srxoio oydol n fetlsf rrmxrpnt4aet mietldlaDuanvp;t0texnxr3iytfpDeluvols setrxm3iy1lmenlieta( sDtr(ront1oltoif3ildfm raumo t4teermo oodfptrlivo s  eumxo3iudal elicilt sDrr(moot4apen fctadfm um(monu4trtnxf tydomtr n i t)trxr(opou4lle lnet t aDra( p;u0apxoiieiasfaDrluvont) lxoxr3oydfateau o s)setmxm3no4ap nlfes sfsDtaxr ou4oetn fctadla rln o;t0artomo3ta1oa e ivi s0t2xmim3nudap n ivil()a2uau pot0oexnio3iltls em(ms;()aexoxf3iatom  lieolt  2xmir3iu1olte nvil() Drau onu1tltn ieiytfmDua( o;u)texrxr oytlmt anvsls0 2tm(m nudameelfes t sDrr(root1apen ieiatfs2um( snt4areomo oodoa elieo s) rumxopoy1oltelncs t arum(  ;u4olxn ociytls2ea(vpn(4 rtomf ty1fmDraieo;s teurir3nydamt liesa(f rum( oou0apxnmf3iltfa2emumo;()texrif3iatom  lnei;s) 2uoio3nydomtnlnei s)a2ra(  ou0altn ieiadfa uanmp u4texoxfcoo1fpDr nei;(0t2xmxr ou1apen ivtl(fa2uaxm ou0ape miciltfs ul( s u0 lxnircoytomD  n o;t0srtm(o3iodom  mnvils)a2uaump;t4oeen fciltfmDran p u4 lxomr iadoate neol(  rurxo3oodlpe lnetat) rrr(  nt1apenmi3ilsfm rl(vp t0alxnmo iotlpDrau sl(  exo(o iodlm  mivi (f 2tru pot1tptomieias a2rmnmpn(4arxnifcta1lp e nes s t2to(m3ny4lp  livslt)sDrr( ont0apxnif3ilsfa rlu pnu4 etrmf tytoaDe uei;(0seurir nodalt  fvias) 2tmumooo0tetniieiytfs2rl( snu0tetoifcootlptean i;s t2xr(mpno4lpeemivsls aDtr(ro;o1altn fctld a rm(vp;t4aeeomocoo1la r ies s srxmim3oo4opt  iesls  2ur(r ot1opxnmietatla2rlnmo;(4areoxrcoatlaDe i s t)s2um(m nodopenmieilt  ruaxr ;o4ole ioetysfsDrm(mon(4alenxf3tatfmDraies (0 eurxo3iu1lp n neiat srrmumo;u1oltomfctldlm rlu s;t)tetomo tatfmD  ivsl()t2umim3iudllee fvsltfs2raxrp;t1altnmoctlsls2ul(vpn(0 ltoxf3oa1lpDr n o;t sexmxr3nydole mnesls)aDtm(r ou4opto feiydla ran o;u4areoif3oydfpt auvil(  exo(r3oo1omte fcils)arumumpot0tpxnmoeiytfs ul( pnu4alxrir ia1fate i o;(0texm(rpoodole  fct t)sDurxr ;u4oex miciadfaDuanvp;t0 rerifciatfmt  i i s0trtm(m3oodamt lfct t aruaxrpou1optn feild aDrlnmp;t4alxrioctatoat livo t0s2xoxmpny4opee feslt  rum(rpnt1olxomf3tadlmDuaumo;t)altnir ia1om rauei;t)trtrio nydll n ncta() rtr( pno4tex mfciytfsDrauvs;u0tetrxo tatfpt li i;s0trtmxm3nydalt mics (fs2tr(m nu1apeomfeiltfm eau snt)altrio ta1lmDrauvils) 2trxr3nu4ol emfet s) rrmump;o0aptoif3iyd s2rauvsn() rtoifctotopDr neo;t0 exrirpno1lm  lnct (  rurxrpoo1oexnifcils m rmuvpnt4trtrmf3tytfa r u i;( texmirpiodlleelfci sfa2uru  ot4opt  ictyt mDea(vo u0tlenxo ty1la r ueo s t2xmxo3iudll elnvi sfa2urx pou0altn i3iatfm rmnvp;(4alxomo3oatomt livi;(0teurxm3io1am e icias)a2ra(ront4tpx  f3iadlsDemu p;u4teenxo3tydfm e u ols  rumiopiodal nmnvtl()s2ra(  ;u4tetomo3tysla2em(vs u) rtoxrciotfpDeli sls0setrio ou1ape  nvta(f 2ua(  nu0tpenifctydls umuvp;t4tltriocoodoaDrlueol()trxoxr3nudom e iet ()a2umx pou4oetoiictysfa2eln pnt0 ltoio3oo1omDraieo;s s2um(opiu1ap emieiat)sDtm(r ;t0opeomociadfsDemuvp t0 eerxr iy1lmDeai sl()s2uoio3ou1apt  ics sfsDumxmo;t1olxomo3iysla elums;u)tltomo totomteanvslt0 rxoim3nu4ll e ncsas) 2ua( ono0apeomi3tadls ra(msnt)texoircoodoptran o;( srtrim ou1amtnlici t arraurp;t1oeeomo3iysfaDumnmsn()texrxo3ta1op raues;() 2xo(rpnu4ome micsas  rumu  ;o1teto f3iasls2eanmo u) eenir3to1fp  aivols) 2um(opoo1amtn ivias)a2umump;u1opxo o3iasla emumo;t)tltoiocty1fpD liesls t2toxrpnydapt liviltfsDur(moou0aex  fciadfa ea( p;(4areoxf3oadomte uvo;s tetm(o oudol nlnesl(fartaxro;o1oet micildfaDrl( snu0 lxrmr todfaDeanes;s  exrxr ny4lpeelfcias)a2tr(mpnt1apen iciltlm2emnvs () ltnxr io1latr u s;(0tetm(r nu1openlncsasfa2raum ;u1tlenmo3iatlmDemn p (4tlerxr oo1opD aneo;(0trtm(r3nudllenlnvs ( srrax  ou1texniiciyd aDem(vs;(4tltomo3oa1lmtrlu i;t tetoxo io1om elncsl(  Dtruront4texomoeiasfm2rlnms;u4treomr oodopt lneo ()s2ur(m3nydol e fcsatfartm( pot1aeen f3iysfsDel(vs ()aleoxo3ty1op r nvs t  exoirpny4ap  mfvsas) 2taxmonu0olx if3iltfmDrl( p u4altnxfcta1la ranvo;t)s2xo(r nudlmen fvsa()aDtru  ;o1apenifetyd a2rln p t4alenmoctytomDeauvils) exrirpiu1ap   neiat artaum ou4optomiciadlm2rmuvo t0arxrio3tatlatraivi t0s2toxo iydap emieiasfarur(m ;o0tpxoio3iadfa2elnvsnt4 renio iadlpD aivo t0srxrio3iy4alt mnvsat)sDrr(r nu4aeeoioeildfmDrlnmo ()trtrxf iy1lmt lues (0sexrir3iu4apee fcil(fs2uaxro;t1oeto i3iatlm2rmums t4alxnmr3tydlmD livi s trtrim3iudll nlnvtas)s2trxr ou4aet mfetasls2eauvs () rxrxrciadfptr i i t seuo(mpou4op  mfciat a2rmumonu4altn o3iaslm eanmo;u0artnif iydop  auvol() rxmxo iy1omee nctlt arrmumo;t1tpen i3iytlm2em( on()aetoxf iy1oaD aieil()sexrxopoodoleelfvtls)s2umum ;u4aexnmf3iltls um(vo;(4alxnir3to1fp eluvo (0seuo(o ou1ol elnct tf 2ta( pnt1tpto fcildfm ea(vsnt4treoif iadfmD ln sl(0srxmxmpoydomtelfvt () 2rruro;t0texomicildla ean p;t)tetnmr3oydlateluvols0srtrxrpiu1am elnci (fsDtmumoou4ole iociltfs elu o;t4areoxo3totfaD lieo s  exm(m3nodll nmivsa(fsrtrxrpoo1tleoioeiasfs2ua(mo;(4 eeoxrciodfatelivi;() etoirpoy4lm  mfcs ( aDrm( oou4opt moeiatlmDem( sn(0aleomfcoatlat  u s;s teumio3ou1lmee nvt ()srtaxr ;o4oeen octas sDranvp u) exnif3oydfaDr ieslt s2toio3iy4lme mfcs ( s2ua(m oo1tpen i3iydfsDran sn(4texrmo oytlaDrlieslt) rto(o3io1ap  lfvil(  rta( pou1aeenifctytfa2rlu onu)aexnif3iydop rlieslt srtmir oo4optnmictls  Dtmur ot4opx ii3tadla rmnvs;t4alxrmf oa1fatelneo;(0teurxo oy4al  mfeil(  rtru  ;o0apt moetld sDrmumo t0 rtnmrcoodopt lieils setmxo3iy1opt  ieia( sruax ont1apx mociydfaDemumsnt0aeenxfcootoat aieo s0t2umiopoy4aptnlfesas srumxmo;u0tptomi3ildfmDemump () ltnir tydlpt luvi t0 2urim3iydlm  livia() 2umump;u0aleomo3ilsfs rm(vp;(4texrmo oadfmt  ivi ()trxmimpny1altemivtl(farraxmpou4teenmfeiad aDran s (0 rtoir3oo1lp  aueo;s0 2trxo no1ol nlivi s sruaxrp;u1olt mociyslsDuau o u0 exnio oy1om  ai i s0 2xrxmpiydam nmnctl() rtru poo1tex  fetyd sDumnmpnu)treoxr iatomteli s;t t2umir3nydamenmfcsas srraxronu4opxnmo3ildfaDra(ms u0trtrxr oytlpDraieilt)s2urxr3oo1lp nlnesl(  rrau  ;u1oeeoiiciydfm2umnvs;u)artoxfcoadlmtrln i;t)trto(m nu4llt livi () Dururpnt1tlxomfetat s ra(vo;() leoif3iatlaD  nvsls0srtoio3ny1lpt  feta(fa2tmxmoot0oltnifeildlm raums;u)artrir iy1fm rai i ()setoxo3iydam nlfct sfsrtrxr ot0tpxoiieils mDrln sn(0trerxf3tatfmt lnvi t0teur(o oudamtemietat s2rrurp;u0tee  fctysfaDra(vo (0altnif3tydlmtr i sl(0 2xrio oo4lm emfvi ( srtaur oo1tle mfetls sDum( o;(0tlenmr3oy1opDeauvs;(0srxr(r3no4lmee fvtltfarrm(  ou0tet mo3ildlm raumpnt4teeomf3to1fa ran o;s) etoxo oydlpte icias a2umur nt1apxnmoetadlsDumuvonu4arxnifciodlpt  n ils) rxm(r no1amenlfctatf 2trx oou1tpxn ietlt a ranmp u4 ltoxf iodfmteau ils) rtrir nodlmtnmnct s  Durur ou1alt  ociysfmDran snu)trxnifctadfat lnei;t)seum(o no4amtn ivsa() rur(m ou0oet mfeiat s ea(vs u)trtoiociodom ranvols0trum(m no1omeemivilt sDumurpoo1tee io3tat s ea( sn(4 etoio3ia1faDeauvols0t2xm(m iy1llt lfcilt)sDrr(r oo4alx mf3tadlaDua( p;u)aexnircoytlptr u s;s0s2trim3iu1lp   icils) rrrumont0tetn ieiltlsDulu pnt0alerif3iytomDeliei t0seurio3oo1apt mfci t) 2rru poo0oeeniiciytlm rmumonu4tlxnxfcty1fatr iei s) exm(r3nydlltemnvt t)aDurxmpno4tpt  ieiad a2uaump;u)arxnif3oy1omtrluvils srxmxmpny1lp e iei (  Dtmxm no0aeto oeiaslm ea(vs t)tleomoctatoa elieo;t  2xrio3nudlp e ies t arrax pnu4olxo fetadlm2umu p (0texnmf ia1oa e nvo s0 exoim3no1am emnct (fs2uaxm ot4optnmfeias a2rl( o;(0 rtoir iatom elnes ()s2xr(r oydole mictas  rrm(r nt0aetoifcilsls2emnvont)aeeoiocoytoatr ies;s teumxo ou1ll n neia()srua(moot0tet  feild a el( s;t) lxomrctotlpDr ueols)sruoxopiodale mnctat)sDtaxmp;o1ape  i3tldls2uaumo;t4treoxfcio1oat aiei t0s2tm(o3oodapeelivt tfarra(mp;o0olxo fctatfs2ranmp;() exoio ty1fpD  n ilt  rur(opio1llte ncilt) rua(mp;u4aptn octyd m2ul(von(0tleoxrciodfpDr nesl(  2toxr iu1lmee fcs sfsrra( o;o1tee  icild sDeauvp;t0alxrifcoatopDeauvsls  2xm(o ny4ol  mnvs (faDumumont4tetnioctltfa rlu sn()alxnxrcoydom raueol(0s2tmxm3ny4ap   ivsl( s2urur ;o0tptnii3ilt a uanmo;(4teermocto1fa elnes ( texoir3oudop emiet s  2rr( pnu0texo feiys a emuvo (4 rxoir oytopDr uvi;t)sruoirpiu4ome micsl() Drr( pot4tpt mf3iytlm2rlnms;u) ltnif3oatlmt  ivols)trxr(opoy1llen ivsat)aDtaxmo;t4olx ioctytfm eluvp t4 renxo iydfp ran il()trxo(o ou4apt  net (f Dtru  nt1oeeo f3iltls2ra(vonu4 eermrctytlmD lneo;t  ruoxm iu1lm   fes ()srrrx pnt0tlt ii3tyslmDel(mpnu)altrxr3totoatr n ol(0sexm(r iu4ole mncia(f Dumx  no1tex ioetasfa eaumpnu)teeoio3oadop rlnvi ()t2um(opnu4apt  ivslt aDtrxmonu0teenii3tatfa2rlumo;t) ltoxfctydfa raivi (0 rtrxm iy4om emfvi sfa2tmxro;t0olt mi3iyt s2umump;u0 rerxo3iytoate neo s trxoxr3iu1opt  fci t aDrmx pou1altn fetltla emn onu4 ltomr3oatomteli o ( t2tm(mpoydam  mfcsltfsrrrxm ou4oetoiociydfmDrau p;t)aeeoio tatlpt  n s s)tetmim ou4lp e netasfa2tau  ;t0oltnifcils s2uanmpnu4treoir tadop  li i t0setmxo no1llt  nctl()aDtm(rp;o4tlenioctltfm2ranmpnu)teerxo3iydlm ean s t t2xo(o iydlle mfvtas)a2umxro;t1openmieiydfmDrln o;u4aeermocia1fmD lies;t seuoxo3oo1lm e neiat)sDrr(mpot0tlto i3iytfmDel(vsn(4aexomo oadfaDe i o t  rum(o3ou4optelicilt  rrm(r nt0tpxomfctad aDrauvp u4 eeomf3todfaDr i sls) rxoxmpio4lme  nvsls) Dtaurpnu4tetomfetlsfmDea(mp u) reoircia1la ean o;s0trtm(r3oydam nmnvs s  2ra(r ;o1aleomietld m ranvo (4tlxrioctodfatrln o;s sruoxm oy1omt micsl(  Drmu pou1tpxnmoeilt sDeauvp () leomocia1lmDeli s;s0s2umiopoy4amt miesa(f rtaumont4tpx ifeiadlm2ea(ms (0 rtrif to1oat lu i;( t2xm(mpiudoltnmivilt)arua(r nu1tltn fctydfaDumu o;t0artoxocto1lpDeaivil()t2um(mpnu1olenliesl(  Dum(mo;t0altn oeiydfa uln onu4 rtnioctotlp  lnes;s) eumirpiu1olt mfct t)a2tau o;u1altomicilslm2uauvo;u)alermocoadopDe neo;s) rtm(m iodamt  nei t  Dtaxmpou0tlt mociys mDran s u0aexrxf3oadfptrlnvi;(0seurxm oo4omtnmict () rum(  nt4oleo ieildlm2ul(vpnt4aexrxociydoa r n s;s0s2umxm3iydol   icta(  rta(m ;u1texnmo3tlt mDrmnmonu4 rxnxfcio1om r ivo;( s2tm(o3ou1lltelnvi t a2tau pno4opt ioeiat a2ul( p;t4trerxf3tydfmtrlueil(0s2xo(r nodop  lfcsl(  2trum no0tpxo fctadla umnmpn(4aeeoxr oo1opt liei;(  rxm(o iodamtn ici t)aDuaxrpoo4oee if3tadlm2ra( sn(0altniocoydfa r nei;s0 2uo(mpno4lp  mnvsat a2um(mpot4teeo f3iytfs2rmump;u) lenmf oo1la eaues s0 etmxmpno1apt licsa(f 2rm(m ;u4oexn feildlm ua( sn(4trtrmr iatoat  nvo;()texrim3oo4lmtnmfcs (fsDtax pot4aee  ieils m elu o;u4aetrioctytlmD anvi;s0t2trxr3oydom  mieils  rtrxm ot4tpt ioeiltfa eauvsnt)aetrmr3iadopD  ieolt) rurxm oo4lltelfcslt sDtmuroot4alen ictadlaDumu on(0tlenxrctatom eaivo;t0 2uo(rpoo4ol  mieslt)srrrxro;t0tpe iieiasfaDum(msn(0alxoxfcoadom   i slt0trxoxo no4lle mfes (fsDtmurp;t4tlt ioetyt aDel(ms;u) etoxo3oy1oaD livils0sexoirpoo4altemfvsasfs2rmur ;u0ale  octydfs uauvs;(4trxrxr3iadomD lu i s0tetmir oydole  ncs ()aDrmxr oo0tlenmf3iadlm el(msnu0tlenircia1faD  u il()s2tr(m3oydap emnctas) 2ra( pnt4apx mi3tytlm rl(mpn(0 exniocoydlpDr neolt  etmirpiudaptnlictat a2tax pno4tltn ociyt a emuvp;t)tlxomf3oo1fmteau i;(0 rurxm iodllt mietl()artmx p;o1apenmf3ilsfa emn p;() exoxo oydlpDrlies;t  rum(m oy1omee iesa( artr(mo;u4aexomocild s2rlums t)trxrif ia1faDeauei () ruo(r3io4ape lfcils  2rru p;t4apto ictyt aDum(msn()tlxoio oo1lm e uvi t)s2xmim oo4ome  icia(f Durum ;o0tpeo i3tldfa2ra(mo;u4aexnircoadfmtelivo;s)trtmio nodapenmnctlsfs2rmu  ;t4opxomfciasfa uau pnt0altnircoadlpDeanesls0 etr(m iudlme lfvilsf Dum(moou4tptnmo3ias a ran p;t0aeerxr totfmtraivil(  rumimpou1ole lfcil(fsDraxm no0olto fctyd mDul( s u) exoioctodfmtr neil(0 rxm(r oo1op  mivt ()aruax p;t4aexnmf3tysfs2rluvon(0alxomf tydla raneol(0s2trirpiudal   ictat)arurx pno1oleniociysla rl(vsnt4altnif tytlpt  n ol(  rxoxrpno4lpenlfci ()arrmu  ot1aleomoctld mDuauvp u) exrmocoo1fpDelues t0t2tm(r3iy4lpe lict sf rum(  ot1alenioeiadlmDul( o;u0 ltoxoctadfaDe ivilt)t2xm(o3ou4apt mfcsatfsDur(  ou1olxn o3tas mDeauvp u4 lxoxociadlateli i ( teuoio3no4lp emiesatfa2rrur ;o0texn fctadlm rlu p;u0alerir3tatop ran ols0tetoxrpiy1am nmncsas)srur(ronu0tpx ioeiysfs2umnvo;t0aexoxr oodlmD  ieo (0sruriopnydalen neia(faDuaxm ;u4oleomieiatla rmn s;u) eeoxo3iadopDelivs;s s2uoxm ou1ll nmfetltf rurur ou4apxniiciyt s2um( on(4 rxnmr3oytomDran i s trxmimpiudope  ivsls) Dum(mono4oee iociaslm ea(vp (0arxnmo ty1fp e i ol(0srtmxr iydlmte neia( s2tmum ;o0tpeoio3iydfsDrl(mo;t4trtomf oytfm r ivi;s)t2trxo iodomt liesa( a2uaxmp;o1tex mf3tys s rauvp;t)tltomo3oydomDrau sl(0teumirpiu4lleelfcilt) rtmxrp;u4aexnmfetaslm emuvpn(4alenio ia1lp  aieo;()t2uoxm3iy4opeemfctat aDtmumont4apxn feilsfsDulnms u0aeeoxrcoydfp  an o;s)trxmxr3io4alt lfcia(f rtrxrpoo0tetoii3tasfs rm(vs;t0 rtnmf iadfp r uvolt0sruoxm ny4lme  nvtl( srrrxmo;o0tlxnmietyt m2rm(vo t)tlxoif3tytopD lnvs;(0texrxo no1lp  mnvtls sDtr( p;t0openii3tyt mDulums (0alxnmrcoodfaD  neo;t)seumir nodlmeemfesa(faDrmx p;u0altoio3iyt m uanvpnu0 rxoif totfm raiei ( t2um(o ny1lpt lieils  Dtaxmooo4oltnmfeiatfsDranvp (0 lxnmr oadomDrln s s truoxm iodlmtnlfctat)s2tm(ro;u0tpxnmfciyslm ea(vont4 leoxo3oa1fatelueo s0 rxr(rpoy4ale lnctl( aDumxro;u0texoifetysls2ua(vo (0teenxf3to1oatrln o;(0 rxoxrpno4ol n fvsl() rrru  ou0ale ii3iyd mDua( p (4arxnmfcoodomDrlnvo;s  exrxo ny4optnmnvil( aruauroot4aetn fcild a ua(mp;(4artnmrcta1omD  i ilt s2tmimpoudal nmfcsa(  2uaxmont0olxoif3ild a2rlnvo t)trxrmfctytlmt  iei s seumxopnu4am nlieia()a2tm(m nt1oexo i3ilt a2emuvs t0alxomr3iadoptrln ilt0sexrxo3iy1ol elnvsas)srurxrp;o1tptnifeiadlm2uau p;t4trtrxocoadfpD li s;t s2xm(m oo4amt mnvsls aDrmumono1aex iietat m2elnmont) reoiocoatfaD livi s)t2toim iu1lm elivt s)s2rau oot4opt moetadfm2uauvs (0 lxomf3iydlmD  nes;s  2uoxo3nudalen feilt)artaxmoot0oeto ocilsla2rlu s t) eermr io1lmteanvi (0 2xrxmpio4amt mnctat  Dtrumoou1olt iociaslmDel(mo u0texrmr3oydopDeliesl(0 rurxm3nodap  lfcil( arraxr ;o0tpxnmiciyt m eluvp;t4 rermo3iydlaD aivi s s2xmxopiu1ome miei tfarrm(m ;o1openio3tytla em( onu)alxrxf3iytlmD  neo;s srxm(rpiy1alenlfesat)arrrxr ot0tlt ioctatfa um(mp (4 exnxf oytlp raieils0texrirpnu4om nmnvilt srtr(mo;u4oleo oeiadls2rau s u0altnir3oytla raivols0seumio nudapenlfei sfsrrr(r nt0oetnmociadlaDrmuvp;t4 exrirciy1opDean s;s t2trio3iudaleemncil(faDrax pnt0apxn ieiydlmDeauvpn(0 eenxf ia1op   ueo;t  euo(rpou1ope lfcsltf 2umxm nt4aetomfetydfsDean onu)texrio3oatomt  u i t0truoim3nydalenlnvsls)artmuroot0oetomfctatfm2uaump (4 lxnxr3tatfatr uei;t0srxrio iydlmeelictlsfs2raxr ;o4aptnmietydfs rlump;u)aeermr oodlpteanvi t  2toir3oudal n fcta()arta( o;o1alxoifctls m2ua(mo;u0 lxrxoctydlptelu il( texmiopny1amt  fesatfsDtaxrpot4oeenmf3iatla emn s t4 etrio3oatfptrliei;t0srur(mpnodole mici s s2um(ro;t1tpxomoctadla rl(vpnu0texrxo tadla rlues;s0setmxr iydlle lncil(f 2umu onu1optomicilslm elnmp;(0 lenxf3iotlmtraueo ( trum(m3io1ol nmfcsasfsrumx  oo4apxniiciltfa2emu ont0 exrmo3totlaDr u slt)truoxopiu4lmt mncils  2rm( pnu0altomf3tasfa ulumo (0 renxf3oytoaDr i ils s2tmir io1openmieil() 2urxr oo4opxnmociysls ran s;()trxrxf3ty1laD ln o s s2xmiopiodlptelict t s2urumpnt1tetn ieiysfaDeauvpn(4areomf iydlmtr ueo (0texrxmpiy4omt liviasfs2tmu poo0teeniociyt aDelnmonu4tlxnxr iodoptr ies t s2to(o nodaptnmneia(  2tm(rpnt1apx mfeildfm emuvpn() exrio oatom  lnvi ()teuoxr iu4lm nmfei t  rta(  nu0olx if3iyt mDum(mp;t4tlermrcoy1fa e nes;t) rxmxrpoy1apenmnvia() rtmx pnu1olxnmieils m2ra( p ()tetomr3oy1oateaieolt0srxoxm3oudllee netl(  2uax  ou0tptnifetydla2ranvon(0altrxr oatfatrau s t s2xo(m3ny4opeeliesas)s2uax pnu1tpxnmfeilsla2el(vo ()texrmf3tadfpD anvslt  2xrio3oudoleeliei ()sDtmurp;u1oltn oetld m eauvo;(4trxoxf oytfp  luesls  eurio3iydole mivi s)sDuauro;u1opt iieiatlm2ranmonu4tltnxfcoytlmtr iesl(0 rxr(m iu4omt  nvsas s2raxmont0apx  oeiltls2rlnmp (4 ltomo oadfptrauvo t0setrio3oudllenlietlt sDuaxro;u4tleo fcilt aDrmumpnt0aetnxr iy1lpt liesl() rtoxo3ou1lpe  nvsa(fsDur(rp;o1texnmicilt aDrln s t4tlxomrcoa1oaD  ivi;t) rtmir3nu1alt  fvil(  rtrurooo0tpeoioetldls em(msnu0aexrmo oodfa   nes s0t2xoim3ny4ope lfes s s2tr(root4apt iieildfsDuanmo;(0 rerxf3tytfpD  uvslt0s2trxr oy1om  lics t) Dtmx p;o0ale mieildls2ran s;(4 rermo tytlp eauvs (0trxmimpiudlpee ncil( srtr(mp;t4oleoiocildls elumsnu)trxrmo tatfptean i;(  2trir3oy1ale livtas)srurxmp;u0apxomictlt aDuauvo;t0aexomr oatoa   ivils teurxopiodap   ieslt) 2uau o;u0opxoii3tytlsDul(vp u)tetnmr3oy1oaD luvi s t2tmxr3nu4lmte ncsls arururpoo0oeto i3tatfs emums (4aeerxf ty1fpDr u i;s0setoim3oo1amen fvsls)aruaum nu4aptoioctadfm umu o t4altrir oo1lpteli i t trum(r3iu4lp elfci s) Durur ;t0aeenmieilsla2emu pnt4treomo3tydomtrauvol(0 rto(r3oo4llt livt (fsDtaur ;o4oeeoio3ildla2ulnmp t0 etnxf3ty1fm  aiei;()t2trxo oo4omtelfeiatf 2rau o;u4aptnmieiatlmDeln on()texnxoctatlpDrlu ils0srxrxrpou1omeeliei (  rtrx o;o4altoifcildlm2uanmpnt)aexrxociytoaDr nvs ()texrimpnu1ameelnvs s) rraxrp;u0teenioctasfs2ua(ms;u)trxoxrcoydlate i o;s)s2trxm iydalt lfciat)aDum( ont4teen ictlt m elu s (4aetomr3ty1om eli i;(0t2tm(o iu1opt mictls aDrm(r nt1tet ii3ias m2elnvs t4tetnir oydoateli olt0setr(o io1ol n neiltfa2uaxroot1aptomoctytlm2eanvo;t4texomf3io1latrlieo t) eum(m iudope  nvil(fs2tmx  no4open ocilsfm2em(vsn(0tlerxf3todlpDe ieo;(0s2xoimpiu4om  mict t)s2raxroou1tpt  octyt sDea( on(0 rxomf iotfaD  n il(0s2tr(m nudlltnmnet tfaDurxrpnu1opx mocias m2rlums;u)aeerir3oodfm elivol()trur(m3nodlpeemfcsls)a2uru ont1tlt mociat s rluvs;u)aetnmo oatfatrluvo;s) rtr(r oydlme  netlt) Duaxmo;o4alx  iciysls2umuvp;(0 lxomo ty1opDrai ils0teuoiopoo1ame  ivsa() ruru  ;t4ope  i3iltlm2um( on(0texnif3iy1lpDr ivs s0trxm(r3io1lptnmnct t) Dtmxm ;o0aet mf3tysfa2rm(vo t) ltrio3oo1faD livi;s)s2uoir iy1lpenlnvtlsf 2umur ;o0tpx mfeias m rlnmp u)artrmrctytlpt aies;t)sruo(rpny4al nlicilt)sDurxr nt4opx mictltfa2ean on()areoioctydoaDr nvils0t2umio3io1opt mnvil(faDuaxmoot4openmoeias m rauvs;t4altnmr3oadfa raiei;t  rum(m oy1lptemfeiltf Durxm no4tpenmfeiysfm2rluvp;(4 lermr3oy1lmD lueo t setm(opiy1altelivs ( sDurxroot1tpeoif3tlsfm2ra(vsn(4tleoxociatlmDean ol( t2xmxr iodopen ietls s2tm(m ou4olxomo3iatla2ra(ms t4tltomr ootlm r i ils) exmxo3oudapeelfciasfsDrau oot1aeeo f3tltlm umuvpnt) eerxfcta1fpDeaiei s) ruoxmpnodlp emnvtls aDumu  nt4olxnmfctltfm2uan o t0artnifctatlmDe ivs t) exoio3ou1oltnlnei s srrr(ront1opt ioeiasfm uan sn(4aetrxfcoytla rliesl( s2xoim iy4lm  mnvtl( aDumxr nu0aptomicild a2uanvpn()altnxf3ty1optraiei;s sexoxrpiu1al n fetl( a2raxm ot0oex mfctys s um(vs;()texrxr tydlmt livs;s s2xrxopou4al emfcsls sDrruro;u1opx mfeildlm uluvo;t4trtomfciatlmtrai o;t teto(o iudope  fvsls) ruau  ;u1oleoifciytlm raump;t0 leoxf3tadlmt lu i t t2xmimpou1ap emnet s)a2uau pno4tet mietasfaDrmuvo;(0 etnxr oa1oa rlu olt0t2tmxm iy4ol elfes sf Drmxr oo4tee ioeiaslsDumn s u4tltrmfciy1lm eaivsls  2urio3iydopt lnet ()s2rrxro;u4tee moeiat a2ra(vsn(4aetrioctodfm e ueils0srtm(r ny4ll nmnci s)a2uax pno4apt mo3iadla eau p;() rxoxo oo1fp elnei;t)s2xoio iy4opee ivt t)aDtr(m no1oltnioetld sDemumsnt)trxomf ia1la  li ilt t2umiopiy1ap  lies ()srrrxro;t0aetnmoeiadfsDrau snt0teermo tytlmDr nvi s s2um(mpoy4omt lfeia()arrm(m ;t0alx  i3iatlm2umn o;u) rxrif3totopD auvil()srum(m3oo4amtemncslt srrauro;u0teto ociyt m2rmn o t)alenxf3iotlmDrlueo;s t2xrim nydolt mictasf 2taur ;u4oltoiicils m2em(mp (0aexrmf totfmteau o t0trtrim nu1altelivs t)a2ur(rpnu0tleoii3tlsfsDel(msnu)arenmr3ta1laDraieol(0trtm(m3nu1om  lnes (f Dua(ro;u1olto f3ilslm2umn o;u4 lermo iytfat  neols truoimpnudlme mivt (fa2rmu  ;u1tet ifetytla2ulu s u0tetrxo3iydomDrluvs t) 2xrxo3oy1lmtnlfvtl(fsDraxm nu0oee mfeias aDrmuvo t) rtrxr oo1lp  livs;s sexr(mpnodapte ict t a2tr(mono1ape  i3iyd m2rm(mpnu)alxoxr3iytfpDeaivslt0seur(m3no1openlfetas)aDrr(mp;o1olxomo3ilt mDua(mo t0 lerio iotlmt lu o;() 2xoir oy1apeelfcias srta(m ou4ole  ieiysfaDrm(ms;u0artrxf3ootfpteaues;(  etrim oodoptn iei t)sDum(mpnt0oltn i3iydfs ul(mp t)alerir3iatlpte i s;s)t2tmimpio4llt livs sfa2um(moou1oetoio3ias aDelnms t4aetnio tytlaDrln sls0srtoim3iydlpe  iciltf 2ur(m ;u0ole ii3iyslm eln pnt)arxoxf3ty1lmtranvo (0 2xo(mpiu4lptelnes sf Duaxmoou1olenifctad sDrau o;(0teenxf iytfm  an o t)s2xrxm3nudame lfct t  Durum ;t0tex mfciatfa2elnmp u)alenircoatop  li o;s t2umxrpnudlp eliesatf 2rru ont0alxn f3iadlsDemnmsn(4teenxo iatoaDraies;() rxm(opiu1apeelivsas  rtrxmoou1oeto oetydlmDem( o u)teerif3totlaD auvi;t tetrio io1lmenlfes t  rtmx pou4tpxn fctydls rm( s;()trxnxr ia1laDraues;()srxmxo oo4oltn nvs tf 2tm(mo;t0opxn oetls s elu pnt) ltnmo ia1omteauvs s0 rxoim nudapteliesa(f Dum(  nu0olxo f3iys m umuvo;() exoxf ia1op e uvslt  2ur(r nu1ap  mfvsls  2raxr oo1tle ifeiad mDemumon(0tetrxociadfaDeluvsls0trtmxopoy4aptnlnvta()arrmx o;t0teeo o3tadlaDuanvs;t)trxoio3ootomt  ivi;t) rurxo oy4oltemivtat arra(mpnt0aetnioctyslaDea( sn(0arxnif3iydfa eln i;( srxm(m oo1lleeliviltfsDurx p;u1tpx mo3ildfsDel(mon(4teenxo iytfaDr uvo s  eurxr nydale mietls  ruaumpoo0altn i3tld sDeanmonu0altoxf oo1omDelneo (  rurxrpou4om nmicslsf 2rmxrp;o0oexn fctydls el( o;(0arerxf3ootfmDr ivol(0s2tm(r ou4opt mfvtltfsDuaxr nu4apeoifcild a rluvp;(0tetrxocootlpteln sls) rxrxrpno4ole  fesas) Draxr ;o1oexnmiciltlm el(vsnt0 ltomrcoytoa  livi;t) 2tm(o oodamt mict (  Drr(mp;u4alenmoctysfa2umu s u4alerxr3oatoatrlneo;s s2xr(m oodom emnvi sf Dtmxmpoo1opxomfciytla2uluvp;t0altrio3tatlpD lu o;t0trumxr3nu4lltnlfvil( s2tm(r ;t0tetnmo3iatlm rmuvsnu0 exnmo3iydfpDr u ol( teuriopoo1ol  lncils a2urx o;u1olt  ietlsfs uln ont)aeenxo oa1op e ivi t0 2xo(m nu1apeemfvil()sDrm(r nt0aleomi3tadfaDeluvo u)arxrmo3ootlatrlu s;(0sexr(m3iydapenlfesat) Drmxmpot0olt  i3ilsfm elumpnu4aetrmociotfat  ieo s0 exoiopiu4lmen ncsl(farrax ooo4opxoii3iys sDran p u4tetnxf oydom rln s t0tetoxm oy4lpen fct () 2rru pou0aet mfeiytlaDrmums;u)aeeoir io1fat aues s sexrxr iodamt liviat arumumpno4open i3iytfaDulnvs;t)trtnif3io1lmtean i;t0s2toio3iu4omenlnvilt)artm( ono4oexnmf3tls s rlnvont4 lxrmocia1fat lies t tetoxm iudlmtemfviltfaDtax oot1oetniociytfsDeau snt0altnmo tydomD anvol(0seuoim3oydol n neta() 2tmxmp;u1tpt ifciyd mDrlu p t)areomr iydoaDrluvols srumiopnu1lp  lfcsl() ruaxm no1aeeomieiytfaDrauvo;(4 rxoio iatom   u i s0 exoir3iu4aptn nvt tf rurum nu0tpeoii3tyt a em( p;() ltnmr oodlaDeai o;t teumim3iudam nlfvsas  Drm(r oo0aptn f3tyd m2rm( o ()trenir todfp r neil() 2ur(o3no4alenmictat a2um(  ot4tltomictltfm2ean p t0aexomocoa1omDeaivo s) 2ur(mpiu4lm nmfviatfarrm( o;t4tex ifctatlmDuaumo u) exrxr3tydlmt lu s s0texr(m3ny1om emfvt s) rrr( onu0tlt iicilsls2umuvon()tleomfcoodfp e uvo t0 2xr(m ny4ol nlies t aDraxr nt1opt  f3ild sDumnms t)trenxf oodfptr ivsls teuoxo iy1lptemfetas  rraxm ou1tlx mfeiyd a2umnmo t0tleomocoa1op   nvs;t  ruoiopnu1aptnmfvtas  ruru  ot4olenioetltlmDumums (4trenioctadfatr ivol()texmirpoydole mnctlsfa2ur( pot4tltnmi3ilt m uauvonu0tleomociotopDraneo;(0s2xmxr3no4alt  fcil() rtr( poo0oetnmi3tatls rm(vs u4teerxrcoatomtrau ils  exmiopiudoleemncil( s2trump;u4ole iietlsls2ua(vp u4arxrir oadlaD an i;t  euoxo no4lmt  fctltfarrrx  ou4olxn fcildlm2rmu s;t)artomf ia1optrlues s) rurxm no4llenlnet s arum( onu1oet  oeiatfm2ranms (0 rxnxo3iatfmte uei;t tetmxr nodam elict sf Dtau ono4aexo i3ilslm ra(vsn() lxomr3oo1omtr nes;t  exmxmpoudamee fetat)srra(m oo1teen ociat mDea(vpn(0tetoif3oatfmte nvsls)s2xoirpoy4lp n fct s a2ta(r ot0tlxomo3tad m raump;t)areoxrciatfpDeaivslt) eto(r3oy4ap nmfct s)aDta(mp;t0alt  i3iasfm eluvs u0texrxo totlaD  iei s t2uo(o3io4ll emnvs s s2rmumont1oltomiciad a2umn p u4texnxr3iy1laD lues;t0srtmir3oo4am e ieiasfsrraxm ou1tle moetltlm2umuvs ()aexrxr3oa1fatelneol( srumirpiu1lme mncs s  2ur(rpoo0aptnio3ildfs2emnmsnt)artoxo3oa1fpDelnvs;(0texo(o ou4omt lfetl(  rtm(  no0tle  ictysfaDelnvon(4 ltrxrcoytfpDr n ils  exmim3oy1am elfvtl(f rtau  ot4tpxnmfciadfaDum(msn(4 rerxociotom  lu ols0 exrxo oudaltnlnvs s sDurumo;u1apeomi3iltls rlump t0altrxf oa1opte ivo s0 2tmxr3nydlmeelics s)a2urumo;u0oet mfctasfaDean s u0tlenmf3ootom r u sl( t2trirpoo4lleemnvia( srumum nt1ale io3iyt sDelu p u0aeeomfcoadfpt lieolt)t2xmio3nodlltelfcias  2rmxm ou0tetoifciyslsDumuvs;t4aeenmociadlaD lu i;s0 eum(m3nodolenmnei s  rtm(  oo1aexoifciatlmDem(ms;t4aetoio3tytlmtrlies;s)t2toxm iodaleemivia( a2taurp;u1opxomf3iytfaDumums u0 lxrxfciytoptrlies;( t2tr(m3ny4ol emivta() Dtmump;u0tpxnmietltlm2rmump;()tltnxo3tatfmDean o;s)s2xoirpny1aptn fei (fsruau  ;t1tex  ieiyt s2rlu onu0aetnif totfp   ueilt t2uoxmpno4ol emnvt t s2rrx pot0tptoiictytfs2uauvsn(0trerxr ootoa rlueilt) eur(r3nu1aptnlictl( s2tau  ou4oeto oetlsfaDea( ont) lermr oo1fm rlnes t  rurxm ny1lp emnesa(fsDtr(  ;u1aeen fctytla rmn pnu)aetnif3iotfaDrlueo;s0t2to(o3oudap nlnes sf 2rax  ;o1altnmfciatlsDulumo;u0 exoxfcty1fmt lieils0 rtmir oy1lptelnvsls)aDuaxront1altnmictyd sDeau snt0teeomf oo1lp eluvo;(  2xr(o3oudlp nlnvil()aDuru p;o0ole ifctas a2uan s;(0arxrxoctytfp r ivi ( s2xrio iodll elfcia( aDumxront4tleoioeildfm rmump () leoxrciytoptelieo;( t2xoxr3oodol elics s)srtm(rpno4optn iciat mDum(ms;(4aeermocoodfp eaivi;s0texoir oodam e ietl()sDur(mpot1ape  f3iadlm rmu on(0 reoxrcoa1fatrluei;t sexrxr3iydol  lfcsl()srtaxmpnu1tpeomfciltls uauvonu) ltrif iadfptrlu olt0srxmxo3nu4ol nmfvilt)sDuaxro;o0aet if3iadls ulu o;() lxoif3todfpt aneo s  rxrirpiudop e nct tf Dtrxrono4teeo fcias m umnmo;t0arxoir oo1opD luvo;s0trtoim3no1lltnlicsls) 2rru  ;t4aexomoctytls2ulu o t4areomr3totfpD livo s0 2urxo oo1om  mfvslt)srtr(mpnu1tlx  feiadfsDrlums;u4tltrirciotop rluvo;( t2uoirpoodomtnmneilt aDuaur ;t4tleoifciadla2ea(vp (0 lxrmf3ootop eau s;(0t2urio ou4lmenmnvsatfsDrrumpnt0ole miciys sDulnmp;(4arenircia1oa  aueol(0teurxrpnu4lle lfeiltf rumx poo4teenioeiyd s em(vsnt4 rerir3oytom rln i;s t2uo(opnu4apenlfvslsfa2tmur ot1aet if3tydfm uau p u4trxrxo3oatfatean sl(  2xoir io4amte nes (fsDururpnt1tlxomf3iadls2el(msnt0treoxo3tytfmDeauei;t0trxmxo3oodll e ivsls  rtrxrpot1aetn feiad m2ua( on() ltnif ta1fp e u o;t)texrio3ny4openmnctlsfs2rrx oou0olt iociad s2ulumsnu4tlxnxr oy1lmD  ivs ( t2urxo no1apee ieilt) 2uax p;t4tlt mfeiydlm ra( snt) lxoxf tydlmDe nvs ()seumxr oo1aptnlietlsfaDurxro;u4openmf3tls m2umnvp (0trtnxr iydlp   ivo;s)srtoxr3nu4lpeemnviatfsDtmxr ou4optn feiys a uauvs;t0trtnmf ta1fa rluvi (0 rxm(mpnu1omt  icsa(f 2tr(ro;t1opxnmietls s2umnvont)aexrio iadfm   n ils0 etr(o iudol n fcs t  rumxm ;u4tee ioetydfsDemums;u0tlxrxo oatlp ranes;t0sexoxm iu1apee neta()sDurxro;o4opx iictadlm2emuvp;(4 leoxrcoatlptrli s t)trxrir3oudape lnesat sDum(rpou0tet ioeiasfa em(vs;u)teeoirciatlat  u s (0 rxo(rpiu1ll elfes ()artm(rooo1apt io3tas m2ea( pnu4 lxoxf oodfp eai o s)texmxrpiu1am   ncilt)arumur ;t0aetnioeiatfs ea( o;t0 ltoxo3iodfaDr n ol()trxmxrpnudam e feias a2rrxro;u0olt mfcils s2rm(vo;u4trenir iotoaD lu o;s t2xo(m3nu1om e fvsat)s2rr(rpoo1teeo ociat sDuanvont4texnio oodfptraiei;( s2xmxopio4am  mietlt)aruaur ou0aex mietlt s eln snt4trxnxo ta1oaD  neo;t0 2umio io1lpt mivtls)sDtaxmpnu1tlxoiieilt sDuan o u0 reomr3oytlm ran il( texrxr3iu4lpen nesl() Dur(mp;u4aee ioeiydfs2ua(mp t4trxrircootlaDrai o;()tetrio3iu4llen ieslt) 2raurono0alx  i3ilsfs eln s;t4aleoxf3iodfptrlnes s teuo(m nu4lmeelics sfsDtrxm nu1tee mo3tydfsDea( s u)trtrxoctatfp   ueo;(0s2uoiopio1lm emfet (  Duru oot1tltn i3tyt aDuanmpnu4altnmociytfptelies;(0 ruoxo iy1lmtemnvil( s2umxr oo1alt iiciysfaDrmn pn()alxomo iodlpteanvilt) 2xmim3oudalte fvi ()s2tmuro;t4alt  feiltfmDuauvo t0arxoxrcoatlmteaivolt  rxmxopnu4omeemnvs s)a2tmxroot0aet iiciat a em( s u0alxnircto1omD luei t)texmxo3no1oltnmicil(farrauronu4oex  oeiltfmDel(msn(0alxnir iotlat  nes;s0 etmir3iodom nmnvtlt) rtmum ou4oltnmiciysla2uln s;t) leomo io1lpt  n ol( teumio3ou1aptemnvs (fsrtrx ont4alxnifciadfm elnms t)aeermf ta1omD  nvi;s t2umxr3oo1lmtnlncsas) rrr( oot0tlto octytlm2rmnmp ()altnxf3ty1om  li ols0s2tmxrpoodom   ivia() 2uau pno4tlx  f3ias mDuanvo t4altrxrcty1oat  ivi s0 rumir3no4lpe lnvt sfsDtau  ;t1optniietyslsDrlu o;u0aeenmo3iotlp  lu i s trxmxm oodoleemnvsa()aDtaxro;u4aleomietad m2rlumonu4 rtoxo3ootfpDe nes;t s2toio nu4lltelfet ( aDtr( pot1tltoioetyt sDrmnvpnu0trxoif3oodom eau o;(0 rtrxo3iy1lpenmfciltfsruaum nu0tlx  o3iydfa2emu s t0 eenxo ty1opD  uvi t) rtmxo3oo4llt licslt srrmxmo;t0tpt mfeiydlm emnvont4 etomociydoatr ueslt0 etoxmpiodomteliesat)s2urxmoot0tpxn oetaslm2rmnvpn(4 reoir tytoate n ol(  rxrxo3ny4op nlnvil(fartr(rpou4open ietltfsDrau ont)arenxo ta1opt  nei t0 rtmxr3nodlpe lfetl()artaxr no1tet mictysfa ulums t)tetnxr3totfa  lnvi;t0 2uoxopiydomtn nvs sfa2urxmpno0tltomociysfa2rlnmsnu0altrmo3oadfp rauvi;s0tetoio3ny4amenmicil(f 2rm(rpot0aexoiicilsfaDuanvpn(0tetoir iytlat  n s;s0t2umio3ou4lme mfvs s  2urumpoo0tetoio3iasla2uan pnu) lxomo oa1omtelneo;(0trurio3nu1ol nmnci sfarum(m nt1alx  i3tydlm rl(mpnt)arxrxf3todoa   nes t srxm(o ou1omte fvs t)srrax  ;t0open fctldlsDuaump;u0trtoxf3tatomtrauvol( t2xr(rpio4lp  mfvtasf rumxr nu4aleoifetlt m um(ms;(0 etnxo iydla e nvs;t0srxmxo3io1apenlnvtls)arrrumont1olxo fciatlm rlnvo u)aexnmfcoydlptrlueo s)s2tr(mpnu1olee ici s a2um(mpou4opeo ietatfa el( sn(0aeeoio3io1opte u o;( sruoxmpny4lp e icil()a2ta(rp;o4olt ioctydfa2uan p t)altnxr3iy1lmDr i i s) rxmxrpoydamtnmnvt ()arraxm ot1ope mi3iyt s2ra(vsn() renifcoatoaDelnes s)t2xrxm3no4ape  nviat)s2ua( onu4tlx mietasfa2rlnvp u0trxrmo todlmteauvs;s0 rxoxr3oo4op emnvtat  2ua(m no1teenmietydfsDrlnmp;()tlxrio tatlmtrai i;s)t2tmxopio4amtemfeia( s2rmu  no4oeen oetat s2umuvp;u0tlxnmr3iydlmDr u i;t0srtmxo iudalt  icsat) Drm(r oo4aex ifetys aDemuvs (0 rxoio3iy1oaDelneslt texoxmpoudal nlfesls)sDtmxroot1aeenmo3iyslmDelnvs u4aexnio ty1lpDrli i t0trto(m nydolenmfesls sDtrx pot0tlxoiietydlm rluvsnu4 rerir3tatfmDran sl() 2um(m3nudomenmiciltfarua( o;t4aptn o3tydfs ranvp t4trxnxo io1lmt an sl(0 rtmir3io1lmt mfvt t sDtrum oo0ope iieildlm raump;()tetoif iytfpD  nvi;t)trxoxrpnudlm n neia(fa2tau  ;o1openif3ilt a emn o t0alenxociatomt  ueo s setm(o io1omen fvta(  2ta(ro;u1alen oetydfm2ua(vs;u)altnmf oadfpD aneo s) rurxopoo4lp   icta(  2uaum no1tpe mf3iysfaDel( p u) exoif3to1laDean ilt0setm(opiy1op   ivs () Drmx  oo0ole mfctltla2ul( s;u4texoxfcoadfm  lnei () rtrim3io4lmeelics ()s2umump;o4olxnmf3tldfa uanvp u0aetomf3iatfpD auvs;s)srxoxr ny1am n ivilt sruax onu4olxnmfciatfaDeaums;u4 eermfciadfpDr iesl(  ruoxr3ou1ll nlicta(  Dtrur ou4teeniicildlaDumuvo;(0 ltnmr oodla r uvo;t0s2tmxr3ny4lltelicsls  2umxm ;o4apxnifctltfm ra(ms;u0tlermr tatfa rlnesls)t2xoxr nu4ap e nciasfaDrr(m ;o4opxoioeiyslsDrmumonu)texrir3io1om   i i;() 2uoxo3io1lpe  ivtat sDrru  ;u1tlt ifctys s rluvpnt4trxrif io1om  lnvo;t s2urxo3oodop  lnvta(  rrr(r nt1oleo i3ildfs2um( pn(4aexnmrcto1omDrln s;s0t2uo(opnydalee ietat)srraxr nt4tltnii3iatfm2ranvs t) rxoxf oadlaDrau ilt0tetr(o nodolen nei (fsDtmurpou4olxomo3iyd a2ranmo;u4alxnif iotlmD  nvsl()tetoir ny4amenmfcia( sDrm(m oo1olxnmicildlm rlnvsnt)aeerxf iytlaDr n ilt0seum(r3oodomtnlnesa()s2urxmpnt1teen o3tyd a2ranmo (4treoio3ia1omte ivilt)t2toio iudol nmnvt tfarrr(mo;u1tleoioctlslsDelumo;u0alxnxfcio1lp eaieils)s2xmxo3iu1optelfetasfa2raumonu1optnmicilsfm rmu o;t0tlxoifctatfmteauvils)t2to(mpou4olenmnvs 
\ No newline at end of file
@@ -0,0 +1 @@
+uvi ()s2umio3oudlm nlivilt  2rm(mo;t1opeoiicilsfs ranvs;t0 renmr3iydfmte n s s0trxmxo ny1lmenmnvt () Duaurono4olxnmf3iysfa2umu p;u0altrmocio1fptr n s t) rxrio3oy4lp emfvi ( arumur ;u4tpt ii3iad a2ean sn(4trtomo oatfmDrlueo s) rxm(o3iy4ol nlfesl() rrmu p;t1opt  i3iasfs2umu p t4aleoxfctytlp e n i t) etoio3oo1lp emfvt t)a2ta( pno4optoiocias mDemnvs u)teerir3totla  anvo;s0t2um(r iy4olt mfes t) 2taum ou4tpenmietysfm em(mpnu4tlenxocoadfpDeli olt0teurxm3nudoleelfvias)artaxrpou0open i3iadlmDrlu s;()arxnir3oo1lmDe uvols0trtrxo iydal emncsa() Drmxm ;t1aeenio3iytfmDrau snu) rtrxo3to1opDelnvol( sexmiopnudol nlfvslsfarra(mp;u1aleo ociytlmDuan snt0 ltnxrciatfm rlivo;(0 2xm(r oo1omt mfvt t srtmxmpot4opxn ietadfs2em( o (0teerxf3tydfatran olt  rum(m3nydlmt  fvt t)a2tmxr nu1oex ifeiys aDel(vp;(4aeermo3ia1fp  ln i;t)teuoxr nu1alt lictl(  Duru  nt1opxoiieildfs uau o t0 ltrmr3oa1lmtrluvo;s)trtr(r iy4aleelfciat  Duaumoou0texnifciydla rlu p t4aexomfcoodfpDe nvi;t0 euoxrpoy1lmen fvtl() rraxro;t1altniociasls em( onu)tlxniociatopD auvsls) 2tmim iudop   fct () Dum(rp;t4aexn octys m elumsn() leomocootoatrlnes;s0 rxrxo3oudol emicslt)aDrrxmpnu4oeeomietaslm ulumsn(4 rxoxo ia1fmte ueilt0 rumir3iydop   iei s)sDtruro;t4aee if3iys a raumo (0aleoif3iydfmDraies (0srxoxo3ou4ll n fctl(fa2tmxr ;o0apxnmiciad mDrmnmp;u) eeomf iotfm eaivo;t)t2xo(o iudlmeelfetasf Dtm(ro;u0openmictls mDua(vs;u)tltrir3tytoa eli ols  2xoxo3nudopenmics s)srtm(  ;u0alen f3tysfa eln o u) etrmo iy1lm raueslt)srto(o iu4ameelies (fa2uax  ;t1teen o3iadfa emnmon(4aexoiociotfaDraneo;s0srumimpiu4lmeelictlt s2rru o;u1tpx ii3iat mDul(mpnt)trxoif3ta1faDrln sls  rumir io1ope  fei s)aDta(rooo4alenioctytfs emuvo;() eerxo to1fateaies t  rtmxopiu4lptemncs t)artr(r ;t1opxnmi3iadfa2ea(mp;() leoir3oadlpDe nvi s0 rtrxr oy4ll n feia()a2tr(  ;u0tetnmfctydls2eanmp;t4altoir3iotlatrluei t  rxrim ny1ap e nei sfsDumu  no1opxnmo3iat a rlump;()artrio3oydop   neils0trxoxm3io4olt lfesas sDuru p;u0oltnioetytfm ua( s;u)trxrmocoodopDrau i;s0sruo(m3no4lltemfes ( arraxmono1oetomi3tls a rl( pnu0trtrxocoodfmtrluvol(0t2urxr iudop  mfei s aDraum ou4aeeomoeiat a uauvsnu)aexoir3oytomteau il(0 rumxrpiodlpenmnvils srtr(mont0aexnmfeilsfa2eluvo t0 etnxr3tydom  li ol( s2xmxr3iy4olt  iet s) 2rauro;o1altoioctytlsDul(mpnu)arxrxo3oy1oatranvilt teurxr ny4ll  lneslt arum( pnu0aeeomfciatfaDrluvs u)texnxo oadop raies t)t2uoio iu4ap e fet t)aDrrxm no4teenmiciytlmDemnvo;u4 lxnmfcoytfaD  neil(0tetoxo iydlp  lfcs () rum(r oo1apeo ieilsfa2rluvp t0tlxrmo3ia1omDr n s;(  etmiopnydol nlnvsl(f rtru oou0alto i3iad a uanvs;t4 eenir iytlp eln i;( teto(r3iy1oleelnct ( s2urxmpoo4aptnii3tydlmDranmo u4arerifcoa1omD  uvols teurir3oudam nmfcsl( srrmu  nu0olxoifetlsfaDemuvo t4altnio3oadla  au slt srtm(opou1llt  icslt)sDuaxrpou0oeeniocilslsDrau s (4trxrxfcoadom  luesl(0 eumir oo4amtemfes tf rurur ou4tpenmf3iytfmDeauvp u4 exrir iatfptelnvo t) rumxr3oy4lmen ivs tf 2umur nu4tpe if3iydlsDrau p;(4 leomfcoydlm ranvo () rumxr3no1op elfvtat) Dtax ont4teeo oeiatfaDumnmo t0 rtrmrciatlmtr ivslt)texr(r3nu4altemfcsas) Duaumpou0tpeoii3iadfm2eluvp u0tetrif tydom e ies t texoirpnu1amt mneiatfarrrum nt1teeo o3tytfs el( p u)aexrmr3oytlmt  nvslt)seumxopoy1ll   fct sfarurxrp;t1apeoio3iltfsDea(mo ()treriocoytopteli i ()sexm(mpiu1lpee fesatfsrtaurpou4tleoifciyd a emu s;u0alxrmr3oatlmDe ieslt  2xmxm3oy1opeemncil( srtru  ;u0tlen ociys m rmnvp;(0teeomfcootopDe uvs;(0texo(r3oy4ap  mfciatf 2tmumont0openii3iadlsDrl(vp (0aexrxo ia1oatr ieo;s0trxrirpnu4ameemfctas)sDtax p;t1oetomfciytla eanms u) rtrxo io1oa r i s;(  etr(m iudlptelnet s)sDuaur ;o4aeeo fciatfa2el( o;()altoifcoo1lmtr iei t0teto(m oudole  ncil(f rta(roou1aptn o3tadls2ul(mo;u4 lenxo3oadlm rlivo;( sexoio iu4lpt lfcil(  Dua(mpot0tlenmi3tls s2umump;(0 rxrxr tadlm e nvo;(0 etm(o oodlpt mfeta()sDtmur ;o0ale iiciysla ea(vs;t4tlenmo tatlat  n i s s2urimpiu1om nmnvsat) rrr( pnt0optnio3iyt a rln ont4 rxnmf oatfpDeli il(0setrxr3iy4ol nmfct ( a2tm(mpot0oleoif3iadfs2elnmpnt4 exnxf tadfaDeaueilt)t2to(o no4oltelieil(fa2uaur oo1tlx  octytfaDrmn s;u4tetnmo iytfm rau olt)srxmirpoodop nlicslt  2rmxrp;o1oexo i3iysfm2rlnvp;t)teerxrctodlm eanei;( srtriopio4op nmneilt) Drmur ot4oetomieias s2ea(vont0 rtnxo3oatlm r uvs;( tetoxr3ou1lltemfeta( sDumx pou1oexn i3ildlm2rluvs;t4 ltnxr iadlmteauei;t  rumxmpoo4opte icsas) rtrxmo;o0aetn fciasfs ran snt) exoio3ia1lpDeln i;s t2tr(opou1alen ivs t) 2ra(mpnu4opxn icilt m ulnmp;t0 ltomrciy1fpte ivs ()t2tmiopiu4lmee fct ()aDta(monu0teenioeiyslm ea(mp;u0 etrif3iy1fmt  n ils tetmxrpnodom nlies ( a2ua(rpnt1opeoioeiasfa2rmnvp;t4tltoxo iotoa eauvs;t  exm(r3nu4oltelnvia(f rtrxrpou1apt  ociyd a umn o ()aeerxo3tytfmDeliei;s trumxopoy1ap  livia()a2trxmonu0aexoiieiadfa2ean onu0tleomr3tatfmtr i i s)t2toxrpnu1apeemieia( aDum(mont0tex if3tlsfs2umn sn(4 rxrxf iatopDeli ilt seuoxmpiu1lp nmfci s)sDrmu p;u0olen ietydlm eauvs u4trerio3ta1oa   uei ( t2urxo3iydamee ncia(faDtaumpno4oexo i3iys s rmnms;()texnmrcia1opDraies;s) rtmxo oydame mfvilsfarrm(m ;t4aetnmietad aDrau pn()trtrifctadop r ivi s) 2trxm3ny4lpenlfcta(fa2uax  ot0opeomfciadfmDrmuvpnu0aeeoir3totomtraies;()seurio io1opt  fvtl( sDurum nu1aet ioeiysfa rm(vpn()tetrmociodlm rlivilt) 2urim io4al  lfviasf Durx  no1oet iictatls2eauvs u4arerxo tatfp elues;s0 2umxr3ou1ame lnviasfsDur( p;o1aeeniiciytlaDelnms u0texnifcoytlaD an i t  2xoxo3iu4ol nlictl( a2taur nt1tet  i3iadls eauvp;t)tltrifcoy1lpDrlivo;s  rxmiopno4lltn net ( s2rrump;t0olxn o3ilsfmDemumo;t4 ltnio3iotfp eaivo;s trxoxm3nydlm  livi tfarurxrooo4tpxniocilt a raums t) rxrioctotfatelieols0s2umxo3nu4amee ivsl(f 2tmx oou0olenioeiasfm2rmumont4arenxf3oatlmDr uesl(0trtmimpno1lltnliet tfaDra(ront0oltn octyt m rl( o;t) eerxf oatlp elivi;s) 2tmirpnudllee fetasfsrtrxm ot0optnmicilslmDem(ms u)artoxo3iytop ranes s  rumiopnydole  fcsa( a2uau o;o4texnif3tysfa ra(vo t0arenxrcoa1lpDr uei;t0 rxoim nodlp   fcsa()s2tmumono1olt  oeiysls2ra(vsn(4 reoxrcootfpDrauei t0sruo(mpno4lleelfviasf rtm(m ;t4altn iciydlmDran on(0arxnxocio1fm  auvols  2tmxmpou4al nmies ( aDum( pno1opt  icild m uanmsn() lermfciydoa   ieol()srtmxr iodlle  icils)sDta(ro;u1tleomietatfaDra(mo;(4areomrcoodopD lu s t0seurim3iu1ome  nvi t  rtmxro;u4opx  oeiltls2em(vs u0tetnxo3todlpDeau o s trxr(opno1lpenlnvtas)aDurxrono1tle iietldlm ulnvp;t0aexnif3iodlaDraieils)setoxr3nydom e nes t) 2rr(rpno4aeenmf3iys s2eluvp;u)altrir oydlat  ivs;t)teto(opno4optelncsa( sDua(mpnt1tetnmfeils a2ea( o u4trxoxf iodlaDelneolt)t2urir3oo4omeelivt t)s2uaxmpot1aetniictltla ua( o (0 exrir3oa1oaD  ieo;t) rxoxm3iy1lp elnvs t)arumxr oo1opt iociasls2rlnvs;(0 lxnio3ia1oaDe n ils0 rtmir3oy1al  lfcs tf 2rm(root1tptomo3ils a2ul( o;u) exrxf iytlptr iesls0teur(r3oydalen fvil()arua(  ot4ale  oetatls ean o u0 eerxr3iy1la  liei t t2tm(r3io1ll nlfvi (farur(ronu0teeoifctlsfm uanmp;t4trxoir3ta1fat  n sls)s2xrxm nudam n nctl(f rur(rpnu1altn iciatla rm(ms t4artomrcto1fmtelnvil()setoirpiodopen ict t)s2uaumpot4tpe moctlsfmDrmnms;u0artrxocta1lp rliesls trxm(o3iu1lmee ivsas  rua(rooo1tpeoii3tltla ul(mo;(4 renif3totlm eai i;(0sexrim3ny1optelicsltfa2rmxmp;t1apx mf3tldfsDuanvsn(0texrxocta1lpt aivsls0t2toxm oodaltemnetlsfsrraxrpot4tee mfetys m ra( o;t0altrmrctydfatraivslt0trurim3no4lltelnetlsfs2trxmoou0tex iiciys s2uauvonu)arenmo3ia1fpte nvi s0 rxoxm3no4ale lfcia( sDuru p;o0tpx  oeiltfa rmnvo;u0tlxrif3ta1oateaiei;s)trxrxr no1opeemivt (f rtau ono4aetomoetyt aDuan p t0 lerxrcto1lmtr nvo;s0srtoirpoy4olenmfvt ( a2um(ro;o1texoiicils a umumpn()texomf totlp eanvils0s2um(opoy4lpt mivt (farrmxro;t4apen i3iytlm2uanvsnu)aetnio3ootlpD ln o;(0 exo(m nydolenmnetls artruronu1optnioetyd s2elums t0 reoxf iydfm   uvi;( t2xrir3ny4am  lncsltfartaur ;t1ope moeiyt a2umu p;u)aexrifctadfmtraneo t0 rxrim ou4op elnvsls)a2taxr no4alen fetls sDum(mp (4aetoir3iytlaDraieol(0t2urxm iudll nlncsl()a2rmum ;u1apxoiiciasfaDuaumsnu0alermo3io1fpte ueils0t2tmxr iy1alenmfei () 2ta(  nu1alx mfetatfmDuln o;u)areoif todomteai s;s) 2tmiopoudlmen fvil()aDtaxrp;t1aet  o3iasfa2ra(mp ()artomo3to1lmteln sl() rxm(opno1ol nmici (faDtm(mo;u4teeomoctas mDul( on(0aetnircoadfaDrluvils)trurxr3oydame lnctl( aDuru oot4apx  fetyd a rlumo (4arerxo3oytfa  auvi;t)srum(r iudomt lnetltf Dtrxm ou1alt iiciadfmDrmn snt4aexrxoctytfmtrau slt0 2xmir3no1op  lfvia(  Drau  ot0apxnmictasfm2eanmp;()texomrctydoaDr uvi s trtoiopoudomtn net t)s2ur(root1tpenmoctadls em(vo t)alxnmf tydoateauvilt)trxoim3no4amen nvsl( arrmum ;o0oetnmicilslaDrmu snu)alxomo todoat aiei;s0t2xoxo nodame  ietl( srrrxmpot1apeomicildlsDrm(vo t4arenmo ia1lp rauei;t)sexoio nu1al  liei t)a2ta(mp;u1opeo ieiytfa2rlnvp () etnxfciodfat an sls srtoio iy1lpt lfvilsfs2ta( o;t4oeeo iciatla ranvonu4trermfcoatlpte u o s setmio3nudame lict t) rtr(r nt0aeeo oeild m2uau o u4altoir oytlpDe uvo ()s2xoxmpiu1optn ietat aDtauroot4oltnmiciatlm el(mo;t0texnxocoa1lmDean i (0s2xmim oo4llt mfvsls)s2raxr ;t4oeeomieiltlm eauvp;u0altnmf tatlmD an s () 2xrir3iodap emicia()artau p;u1tle micilt sDuau onu0 rxnio3iydom   nvs;s)srumxr3no1opteliciatfsDum(moou0tlx ioetytls ulumpn(4altnio3oatomte uei t0s2ur(r3oodom  mfctl( a2uru  ou0ope mieiltfs2uau ont)texrifctydlpD lu i s)t2toxm iydaltemiet s)s2rmumono0opx if3iasla rlu o;u0 rxnioctatfmt aiesl(0sexmimpou1om  mics tfaDtm( p;t0aeenmf3tldfa2rln snt0artnmrcoatlp rln sl(0trum(opnu4lp nmnvslt sDtr( pnu0ope  ietlt sDea(mo u4trxnir oydomtranei;t) 2xoim3oudolee fetls a2rmumono4tlxnmfciyd mDumu o u4teeomf3tydfpt lu s t0 rxo(m3ou4lmeelfet s sDumxmpot1tltnmfetltla ul(vo;u) ltrmr3io1lmt au o;(0t2to(r oodlmenmnci sfsrta(mooo0oet ioetyd sDeauvo;(0tltoxr3iytlm  lu sls0 ruoxr nu4ome lnci ()arra( oot0tlxomf3tytfs2el(von(0trtnxocio1fmDrlivi;( s2xm(rpio1ol nlivt ( s2urum oo4aetnmociys m ra( p;(0texoiocoodomDe neol(0s2uoxm3nu1ol nmncs sf 2tmumo;t1aleomfeiasla2emu p;u4tlermr3iydomte i s;()setm(m3oo4ol emnct ()sruauront4tlenmocildlmDean p;u4alenmocto1lpD aivi;t)t2xr(m io4ale mfvsa( s2rr(m ;t4apen fctlt m2ulnmont)tlxomr3ta1opDr ivi;t seur(opnu1ll  lfcs sfa2rr( oot4aex  f3iyd s elnmon(0aetoio oodfpDe u olt0 etrimpnudop elietas)arurxmpnu0tetnioetlt s2ea(vs;t4tltnir3iadopDrai ol()teurir3ny1lmt lictlsf Dtrxr nu1apen o3iltla2um(vs;t)tltomo to1oa elivo;t  2trxopiu1amee nci t  2umxm ou1alx ifetlslsDrl(mpnt4tleoif3oytlpD  i s s0 rxo(r oo4ole lfvt tf rrauro;t4tltoioeildlaDea(vpnt4 reomo oytomte n o;s0 rumio3iudomenmfvilt) 2ta(mono0alt  fcilslm2ulnvo;u0 ltoxr3tatoaDeliei;t)sexoxm ou1omtnlnesatfs2ua(mpoo1aptnmoeiysfsDem(mo;u) etoxf oo1lm r n ol(0srxrxo3iu4apt lfesltfarrmu o;t1aexniiciat sDrmnmo;(0trerxoctatopt aneils) 2urio3iudam elnvs tf Dua(  nu1tleo o3iytfa2uauvpn(0tleomrcio1op rauvols) rtoio nodale  fctls)srrmx pno4tex  o3iatfa2um( pn()altoir totoa   ues s)srxmir oudllte fvtlsfsDtr(m ;t0apx if3iydlmDelnmp;t0 eeoxfcoatfm  ai i;( sexrxopnu1omee ieta( sDurx  ou1aeen oeilslm2ulnmon(0trxoio totom elieo;(0s2ur(o3oudaltelicia(f 2uaxr no1oleomoetasfa umnmon()trxrxf3oydlmDraiei;s texm(r3ou1ap  mneilt srrr( oou1tpenif3ilsls rm( o t)tlxnir3ia1fmD  neilt)sexmxr nodaltemieilt arumxmpou0tpen oeiysla uluvs;(4 etomf oatom raieo ()t2tr(m iu4lle  ivta(  Dtr(ront1tetn ociad a rl(vs;u) rxomr totfpD  u sls0t2xrxr ny4apee nvsl()aDrrur ;t0opx if3tls m emnvp ()altnmr iatom   n o;( t2urir3nodap nlfes s)arur(  ou0opx  i3tys m2ulu o;t0tleoxf oydomt li il( trxo(o iodomenmfctlsf Dtmum ou0alt ifetad sDul( onu0 lxnxfcoy1omD au slt)tetmxm oudopee ivi sfa2raur ot4opxn o3iadfsDum(vs u)tetomo3oadom   u ilt  rxmir3ny1ol nmncilt)aDta(  ;t4altnmiciaslsDrm( s (0 exnxo iadom  lieol( srtmim3oy1op elfvi (  Drmu  oo0tpe  ictydla ra( o t4alerio3tatfm eaiei;(0 rum(mpiu1alen feil()a2umuronu4aeenifcias a2emn o u4 eenmo3ta1fm   ueils0 2urxopoodopenmivt tfsrrmx  oo1tltnio3tydls2ulnvsnt)tlxnxfctodomDe nvi;( t2uoxrpoudap n iesatfs2ta(root0oeeniieiytls rmump (4aexnir oy1fm eanvslt srxmxo iu4opee fcs sfarurx pnu0optn ieiydfa2el( pnu0altrmrcto1fa  au o t0s2trir oy1ol  mnesa(  Dtaxroot0ole iicilslsDrl( sn(4arxrio iytlm elu ol( srumxopou1am e ncs s aDta(  ;u0oetoiociasla2eanvs;(0aetnxfciodfp  aneslt0t2uo(o3nu4olee feil(fs2ua(m ;u0tlx  fcildfaDum(vsnu)altnmr3ta1fa  luvs;() etm(o oo1altnmfctl()arrmx  ;o0tltomociydlmDulumpnu)artrirciatla rai ol(  euo(r3oy1apte feta( a2taxrpou4alenio3iytfa em(mo t0 ltnxfcta1oaDeli olt0 etoio ou4optnlnvi t)s2rauront0ope ioctldlmDea( o;u)texoif3oa1fmtr uvi;s)srxmxopnu4op   feias sDuau pnu0texo f3tydlaDeau p u4alxrmrcty1oaD  uei;t0srtm(mpnu4llt  nctas)srrr(mpnu4tex mfeiydfm umumo;()tlermr iotfpD au o s0 2umxo iy1ll nmfei (  Dtmxrpnu4tlx mfciyd m el( o u0trtrxrcia1oatelueslt teum(r io4omen ivs tfaDrmu p;t1ale mo3iyd a2el(vs;u0artnxrcio1faDraueilt t2xm(rpoo1aptnmnci sfs2rm(m ;u1aexnmocildlaDrmn o t)alxomo iy1op rlivi;( srur(o nudll emnviat sDum(monu0oexoifeiytfa2elump;u4tetnirciadfate i o;t0 exrxm3nydapenmnvil()aDtmxr ou4aleo o3ilsfmDeauvo t4teerxrcoa1op rlnvol(0s2xo(r nu1omenmiesa()aDtr(r ;t1aee iiciydfsDrl(vp;u0trenio ia1fateluvolt texo(opou1opt lnvs s  2raurpnt4openmociadls rlnvsnu0teerxo iadlatraiesl()trxo(rpnydamt  nvsl() rurxmp;o1oee mi3tyt m rl( ont0 exrmo to1fat an s;s0 2urxm iu1optnlivsa(f Dtmum nt0tpe mfetas a rlumpnt)tlerxr totomDeau s;t0 ruoxm oydapen ivtl( srrr(mpot1tpxomfeilsls elu p (4 exnir oodlpDr ies;(0seuoimpno1llen ics sfsDua( o;u0oeeomoeiad sDuluvp;u0trtrmrcoo1fa  li ilt0setrxmpoydlp   ncils  2trx onu1aptn o3tas s rmumsnt4 lxoifctydlp r i o;s  eumxr nodol e fes sf rtau  oo0apx iieildfm emu p;t4 lxrmo3iadlm eaieo;t  2um(m ny1ale livt tfa2tax  nt4tptnmoetyt s em( o;(4artrif io1om   uvil(  rtmxr oydapenlnetat s2tm(rooo4opeo o3iytfaDrm(vs (0 eeomrctotlmDeaueo;s0 exo(r3iy4opt  nci tfs2umxmont0tpe ifeild m2umu o () rxrio3iadom eli s;(  rtoxm3nu1omt mfvi tfsrtmxrpnt0opt ioctadfs emnvs (0areniocoytfaDrau i t0 exrim3ny4al nmnvi t srtm(r oo0tee ifciadfa2emn s;u0 rtrmrcia1lm r n o;s0 ruo(mpoodale lnes ()a2ta( pno1tlenmfeilt a rmn p t)arxrxr3ta1fmte neo;s t2to(mpoydapenlnetl(f 2tmx ont0ale ifciydfa2eanmp t)teeomf oodlpt  ivs s)texmio nu4lpenmivsa()a2ra( ont4olt  ocildfm ea(vp (0 leomo oo1fmD an i ()trxrirpiydape lfeiasfsDraurooo1aexo o3tyslm2rmumon()alxrxo3iodop rlnes;t  2xo(m nydolt  nesl()arumu  oo4ale  oetat m umu snu4tlerxo iytfmt an sls)sexr(o3nodopeemfct tfa2uaumpnt1tlxomictyt s2ul(mpnu4aetomf3oytfaDeaiei;s)s2xr(opnodlmenlnvia(fsDta(roou0alt iociat s eluvs;(0tltnmo3todlm elivi;t0setmim nodal  mfeiatfsruau o;t4optomfeias aDelnmonu4arxomocia1fmDr i s (0s2uo(opiodlmtnlnctlsfa2ta(m ;u4opeoii3ildfsDelu p;t4 lxnxo3oy1fp   n s;()seurxr oo1lleemfet t) 2tax  oo4alt ii3iadlm2rm(vp u)arxnmfcoytlpDeau s s0texrirpoo4optnlfctat)aDra(root4apen feiasfa rauvo;t)aexoif oodoat lnvsl( srxrio iu4lpeemies (fs2rrur oo4texn o3ilsfs rl(vont0alenxf tatopt lnesls0 2tmiopio4llte ivtat)srrm(m ;t4optomictad sDrmu o;(4 lxrmr3iadlpDeanvilt)t2xmxr oy1ap  mfct s)srrrxr ;u1oexomoetysfa rmnmp t4texoxr iatlatr u s;t) euoio3iodlpeelivi (fa2trumpou1tltoif3iad aDrmn s;u)aexomr3todlp r n o t0srtmir3nydoltnlfeil(fsDtrx o;o1tlx mf3tytls rlumpnt0arxnmo oy1op   nvi t tetmir io4amtn icsa() 2tax p;u0tpxn f3tat mDra(mpnt4 rerxrciatomte nvil(  rumiopio1ol elfci s  Dur( onu0olt  i3iatfa em(vsnu4alxoir3totfm  lieo;t sexmxr iu1ale lnctatfartm(mo;o4alxnifetytfs2eaump t)tlenmfcoy1fmDeln i;() 2xrio oudomee fci s aDtaumpoo1tlxoioetadfm2ua( onu4 lxrmf3oodopDrln s;(0 2uoxr nodolt  fviasfarurxmo;t1oexoifeiydfa2ran o u0alxnmf iotoptr uvsls0 2uoim3oy1olt mfet tfaDra(r nu0tlxnif3tatla2ulnvo;t) etrxf3iadlptelnvil(0 2xr(rpnydlpeemfvs t sDtaxm ;u0tlx moeiytfaDulu p;() rtrmf3iotlpDrlu o t srumxopnydam  mnctl( aDta(m nt4aptn fetadfm elnmp;t)trtrxf3oodomDeai s t srxrirpno1lm  lici t)aruau p;u0oeeo fctys m eluvs;(4aetnmocio1fmteluvo;s0s2tr(m3oodap   ies ()sDtaum oo4apeo ociytls ra(mont4tltnir oadfmteluvsls  rtrxr nydlmtn nctlt  ruau p;t1olx mi3iasfm um( s;(4 renio3iodfaDelnvol( teurimpiy4omtelfvtat)s2ur( ono4tpeoiiciytlm2elnmpnt)alenxr oo1faD lnvs;t) exmirpiydam n icils)sDtmxrp;o4tlenifetysls ulu snu0 exnmr tadfp elneo;s0t2uo(mpnu1lpte neia() Drm(r ;t4tpxn fciydfm rmu o;t0 etrifcoytlpt aies t0seum(r3oo4ll  mneils)srrax p;t4alxnioeiadfmDel(vo u4 lxriocta1lm ran o;t  rumio no4lpee ieiatfsDtrx pot4aee mociytfs uaumonu4 rxoio3tytfa rlu ilt seuo(o3ny1am n fci ()a2rrum no4olen octldlsDum(mp u0tetnmf3oodopDr uvi t) 2umxmpiu1llte fvi (  2uaxmp;o4aee mf3ildfa el( s (0trxnxo iodop e i s;(0 rto(m3iu1ll emfvsas aDum(moot1aeto ictlt m eaums t0altrmf iytfaDrln s ( setoir oo4ll emfvta()aDrrx p;u4aptnifctltlm2rau p;t4 etoxo3iodlmtr uvil(  etr(r3nu4amee fvils  Draurpnt1tpt mi3iyt m2uanvp () eeoxfcoodom r nvi ( seurim io1lme mies ()artm(moot4opxoifcias m rl(vo;t0treoio3oodom r uesl()trxrim oo1aptnlivs ()s2rmum oo1aetnmiciasls2ua( s u)arerio tatlp e neo ( t2trxrpoo1altn fvsls) rtr(  oo1tpeomicilt sDrmnvp u0 rxoxr oadlm elieolt sruoxr iydape lfcs sfsDrm(r no4aex mf3iytla rmnvo t)tetoxr3oodoateauvi;t) rumxopoo1olee neslsfa2um( p;t4aexnio3tasfm rmnvsn()altomf3oa1omt  n olt0trtm(r3nu1ap elncsas srrauroot1texnioeiyd m ea( s t0alxomf iatlpt anvs s)s2tm(opny4al elncsl()s2tr(mpoo0texnio3tlsls2em( p;(4aetrmr ty1omDeauvolt  exrxr iydomen ncsl(fs2rrxm ;t4oeenif3tasfaDrmu p t) lenxo oy1lateaieo ()trxm(o oy4llen fcslt aDtr(m ;t0optn iciad m rauvs;t)alxoxrctodfmD li i;t)t2xoimpny4lmt  ictlt) Drax pnt1altnmictytfa2rau o;t0artrmo3iatlpt  nei;(  rxr(r iodom emieslsf Dtruroou1olxoii3tatla2ulu s (4 ltrircto1oa  lues;t)teumxrpoy1lpte fctas  Dra(moou1aexnmiciyd a2um( ont0alerifciydom eln olt0texmir ou4lle  ivi t)a2uaumont0tptnmoetas a ulnmo;()trxnif3oy1latelu i;s0srumio nu1lptn ivi ( srtm(ro;o0alt mfeiasfm2eanms;t)texoxo3oodla e n sl(  rto(o oy4am   nviat) rrm(m ot1tptniiciat aDrm( o;t0 eermr to1laDrau ol(  rtr(m3io1oleemivtls)s2taxmpno4tlxo oeiltfa2em(vp u)tltrirctotfmt aieil()seumiopoy1al nliesatfs2rmu  no1teen o3iadlsDemnms;()trerxrciytoaD  uvi;t)truoxopno4ap n fvt s  Dtaurp;t1alxo ociysls eluvs;t0 renif3tydomDeauvi ()trtrir iy1am  mncs t)artm(m ;u4alxnmoctatlm2eanmo;u4tlenifcoa1latrlneol()t2urxr iodllen fviatfa2ua(mo;o1oet  i3tltls2ra(mpnt0 rtrmocto1late n s;s0tetrxr3ou4ame mnvslt) rur(  ot0aetomoeiad a2emuvonu0 lxrmfciotfatranvs;s)srxo(opou4am  licta() rtm(m nt1aex  i3iytfa2ea( o;u4 exoio3ty1fm  lieo s) 2uo(o3iodame lfvt s  2tau pnt1aexn o3iys m2ulnmpn(0 eenmrcia1lp  an i;t0texriopny1altemfetls sDtrxrpot1tee iieild m emu pnt)alenif3oydlaD anei ()sexrio iudamenlncil(  Dtaxmono1optnmieildfm umums u0alxomrctydoa elnvo;t srtr(o3io4omt  ncsa() ruaxmpoo0olxoiictytlmDuaums t)tltnxf totlmt anvo;(0t2uo(o iudap nlneilsfa2rmurpot1oltoifeild sDrm( o u0 lxrxfciodlpt  ueo;(  rur(r nu1amtnmivilt aDta(mo;t0opxnmfciyd s ulu s;() etnxo3ta1laD  ueslt teum(m iu4lm nmnct s srrmurono4aexoifctltlm rmu p;t)texoxfciydlp ean i;(  eurxr3io1ol   fetl()s2rmxrpnu1tpe mo3iytlm raumo;u0 lenmr3iydlaD lueo;t0 eumxm3oydlmt mics (  rta(rp;o0olxoii3iydls ul( p u) rxnmrciodopt  nei ( srtoxmpiodlpt  ictlt s2rmxr ;t1aet  fciasfa rm(monu0 renmrcoodlaDrauesls srxoxm3ny4olt  nci ()arrmxr oo4oet iietld sDumumo u4 lenmo3ootfatrluvols trxo(m ou4lm  lncsa( aDtrx p;u1tpen ociatls ul( ont0 renmocoadomDe uvo;(0 rxoxmpnudale  fesas) Drmx pnt1aptnmfctat s rlnmpn(4 lxrxrciotoa ean o s  rxrxrpoy4ll elivi tf Duax  nt4opt mi3tad sDrl(mpnt0trenmf3totop raieslt tetrxm oy1ll  mnvilsfaDumxm oo0aleo feiydls2eau pnu) rxomf to1late i s s) rtmxm iu4lmtnlncilt sruaumooo1optoiieiasfm2rmu s;u)tltrmf3iy1om  ai sls srtrxo3oydlm  lfvt ()sDrmxr ou4tpxnifeiat s2ea( pnu) rerio oytlmteli ols)srurirpiy1am  mivilt aDtmur ;o1tleo ocild s2ean on(0 eenircto1la  lieo s  rtr(r3nudomt  nei sf rtmurpno0olto i3tls sDeluvs;(0tltnxr oytlptrlues;(0trxmxr io4op n nvsltfaDtm(mpoo4tlx moetys s2ea( pn() renifcoytfptr ies;(0srxrio no4om  mfcsa( srurxmoou0teen iciytfsDra(mo u4arenif3iy1opDr nvol(  rxm(mpnudam e nvta( srra(mooo0opt ii3ild aDrlumo;()aetomo ty1lpte uei s  rxrim nydlmtemneia(f Drru pno4aee  fctls sDrl(vo;()tetrir3todfat anei;s)seto(m3nu4lp n fcs t)aDrmxm ou1alxnmfetld sDum( p;u)artrmf totla e ivsl(  2toxo nu4om e nctatf Drmuront0tltnifctad a2rlu on()aetoir3oydlmt livi;s0truoim3iydlltelfcilt)aDrm(monu4tpenioeiyd s rmn s t)aeerxrcoa1fa rlivs;s)t2to(m3iudam nmfctl()srtaum ;u1optn f3iat s uaumo;u0aleoxf3ia1opD an i (  rurxo3ny1opt lfvia(fa2taxront4teeoif3tydls2rlnmo;()altnxr3iotlp rauvols) euoio3iudol n fvi t aDururono0olt if3iys mDemnmp;t)tltomo3iy1opDraues t) rxr(rpoudame  fvsl() 2trx  nu0tlt iictys m rmn p;(4 rxoxrctydoaD auei;()t2umxr3oy1am  mfciatfa2rmumpoo1alx micilsfs2ua(msn(4tlxoxfcto1opD  u sl()teuo(r3no1omte fcta( srtr(m oo0olx mieilsfs2uanmp u) rxnxf3tytfate ueolt0srxmim nu4ale mieilt)arurxrpou1altnmf3ild a2umumsnu0 eerxoctodlpt lnvo;s0 2uoxo3no1al   nviat  rrrurpou0oltomi3iysfa2rmums t) exrio oa1lmD  i o;t0tetm(r3nydoltemfvtasfs2ururoot4texo f3iyslsDraumsn()alxoif3tadlmDrau i t0tetrxrpiydal elieia( s2rmx  ou4aet ifetasla em(vont) lxoif iy1lptrlnvo t seurio3oydamtnmietl(fsDum(  ;o0alx  oeiytfm2um( onu)alxrmr oodoa e ues t0texo(m ou1aptemnvilsfaDra( pou4tex if3tys sDranvsn(0 lermrcoydlm r uvols)t2to(m iudale livsl()arua(  no0texomieiyd a umums t)tetomrcoytop ean s (0 rxoxopoydopeelnvsasfa2rmum ;u1tpe  i3tas a emnms u0 lenmrcootoaD livilt0t2tm(rpny1ol emfctl(  Drmxmo;u1tleniiciaslsDrm( pnt0alxnxoctatla eaieo ()seto(r3nu4aptemiviatfs2rmurono0oetnmi3iatfmDua( p (4artoxo ootfpDraivslt)s2tr(r3io4lltn ivtltf rtr( pou4tet ioeiysfa em(vs t0teenmo3iadlat li sls  2trxrpoy1ope livia( a2tm(m ot0ale mfeils a um( on(0aetnmr oodfat aieo;t seumxr nodame  nvia() rtau p;t0apxomociytfmDrmnmo;u) ltnmf3oytla r n ilt  2ur(m3io1aptnmnvsl(fs2tmurpno4aleo ieiat s elnmon(0texrmf tydfaDrai o ()s2tm(mpnu4apenlics s) Drr( pno1oltn feiasfs ranvpnt0tetnxo iodlptrlivo;t t2umiopiydll e fet t  Dtaumo;t4aeeo oetaslsDra(mo t4trtomrciadfpDeln ils0setoim ny1lp nliesl()sruau pno4tpe  o3tasfa2rau o u)trxrmrctydfp r uei t)teum(mpnu1ol elnvil( arrmxr ou1texo o3tlsfmDea(mp t0alenxf3tytlmt lies s  eur(r oudlpee nesat) Duaur no4oetnio3ildfm rauvpnt)tleoxo3iy1la ranvs;s0s2xrxm3io1ale  nvs tf rrrxm oo0tee  o3ils a2emn on(0 ltnifctydoa eai ilt) 2toimpoy4amt  ivi t)aDrmumonu0olxnmiciltfm2uauvs;(0 rerir3iotlm eau i;( t2xmxm3nu4llenlneil()s2tru  oo4apxomfctldlaDea( on()tltnir ootopt luvolt)teto(o nodal nmfeiat)arrrx oou1tltomi3iat s2umums t4tetnif3oodfpDeaivi;t)trtrio3oodlm  livt ()a2ur(mpno4aet mfctys m2emnmp;u)trxnmo3iotomtr ieo;s s2tm(m3oo1omt  fcs sfs2rmumpoo4alxo o3iyd a2rm(mpnu0 ltnif3iadlp r ivs;s) ruoxo3oudlptnlicsl( s2rrx oot4olenmo3iltlm ul(vo () rerio3iytfaD au sl(  ruoxrpoydopee fvil(farra(moou1apen feiaslsDem( p u4tlxoir3oadfp eluvi s0srtmir3oodol n fci ( aDumum nu4oleomocils m rlu s;t0artrio3io1opDraies s)srurxm3oydop elfci s  2rax oot4tetnmf3iydfm2uauvsnu0treomr oy1fat  uvilt0s2ur(r3oy4llt livias  rrr(  ;u0oexo ocilsfsDeau o;()altoxo iodfpt luvs;()setr(o3iu1omtnlivtasf Duauront4aptoiocilsfaDeluvs u0 lxnirctodfa eauvol(0t2xo(r3iy4optnmneta(f 2ra(rp;o0alx mieiysls2elumo;u) rxnxo iodfmDr u ils) rxmio iodaptnl
\ No newline at end of file
@@ -0,0 +1 @@
+n ol(0t2xoxrpnu1opt licsls  rtmur ;u4oee miciltfs eaumonu)tlxomrcoodlpD lueo ( teur(o3oudlmte ictl()s2umuroot1aexo ieiys m2eau on() ltrif iy1lm  aivs ()sexrxopoy1olte iei t)aruaumo;u1oetomoetydfmDrlu pn() lermr3iotfate i s;(0truoim3iodame mnvtl(  rrrxr oo1tpen feiasfs2elnmsnu0 eenxrciytlpDe ueo t texr(rpiy1am emnvsatfarta(r no0oet iictyt m um(vsnt)artrmo oa1optrluei;()s2tr(mpoo1aptnmfet s) 2umurpnt0tlenioetadls2ul(vs u4 leoxrctotoat luvo t  rxm(opiy1am elnvi t  Dururono1aleoii3tatlm2rlumon()aexoxo oodfa  luei ()s2toiopio4op nlfvil( aDumumooo1tlxn ieiys m eau o u) rtoioctadop eluvs (0t2toiopnu1ap  lnvt (faDra(m ou4tpto feiad m2ea( pnt4 ltoxf3oatfmDrluei t) exr(r nodom elictl(  Dtaxro;o0ale mo3iytfs uanvo;(0texnio3iatlm r ieo;()texoxr nu4om  lnvi (f rumxm ot0tlenmictyd mDulnvp u)tetrxrciadfpD au i s srurio iy4om emieia() rraxrp;u1openioeilsfm2um( sn()tetoxfctotlmtr i i;()texoio ou4omt mnvt s)s2tm(m oo0opxomieiytfa2ean p t4altoxo3iodlm elivi;s0 euoxm nu4amtnlictls) 2urur oo4aexnmictasfa ua(vp u)tleoxf3ta1fmD li o;t sexoxmpoy1alee ieil(fsDtru oou0olen ietat aDemnmo;t4 exrxo tadfaDe uvs t)tetmir3oudlpee ivsas  Dtr(m ;u4opxo o3tysfa2ul(msnu0trerxr3oatfpt livi t  2toio no1lptnlicta(f 2rax pnt0texn f3iadls2rln o u)tlxrmocoy1fatrlnvs;s  2tm(mpio1amtnmictltfsrra(mooo1oet moeils m2ulnvsnu)tlxnmr ta1lpDe ueils0trxmxr3no1ol  lfvsl(  Dum(m ;t1tltn ieiydlmDul(mpn(4tlerifcoa1lm rlieslt)sexoxm oudapenlfct (f rrr(  nt4tex  f3iat a rmuvont)aeeoifcoytlmDe ueo;()srurirpiy4lmenmfcsl() rrrur nu4ale  octytlm2umump;t0 eeoif ootfatr uesls) eum(mpoo4am emnet ()a2rrxmoou4tptn oeiltfmDrlnvp (4artnmf3iydomD lneo;(0s2xr(r nudlmtelfvtas)s2ra(rpot0aee mi3iyt s2uaumo;u)trtnif ty1lmDe nei t)s2xmxrpou4alt mivil()aruaumo;u4tlxoio3ildlm ua(vs;()tltnir3oydlptrlivils0teuoxrpiodlmee ivsas  rrrur ;u1tex mietld s2rm(msn(4 etrxfcoadlpD lies s0 exoim3oo4al n ivi ()artmx  ou4aetnmfcilsfsDrmuvsn() lxrxf3oo1faDean sls srxo(m3nu4am  lncta(farrr(  no1oexnifeiyslmDeau on() ltrxrciydfmtrau o (0texr(m nydol eliet sfsDrrum nu4tlt moeiyslaDemumo t0 reoif3ta1lm eln sls0 2trxr nydlmt lfcil(f 2trur oo0oltnmfeiysfm2ulnmo (0 eenxf3oa1oa rai o;s0trtmio3nu4lle lnctlt  rumxront0ole mi3tydla2ean on(0aeenxfcoy1op  lnes t)sexo(mpoudol e ncsltf Drrxmpou1aexomietlsfm2em(vo ()artoirciatfptr n slt) euoxo io4lp nmiet ()aDumxm ;u4aptomi3iltfm ranmsnu0 lenmf3todlmtr uvs s0s2xo(m iodllte fesltfsDumx oou1aptnioctas m rmuvo (4 eerxfcto1omt  ivi t0 eumiopoydop n fct t srta( o;o1altomieiys a uau s;t4trxnmo iy1omDran i t  rxmxopiudlp   icslt  rumxm ot1tet ifetad m2rm(mo;u4 rtomo oadfpDeau s (0sruoxrpoy1optnmnesltfsrrru  ou1aet mieilsla2rluvs;u0arxrmf3to1fpDelnei;s s2urxrpnudome mnesas)s2rax pno4tlxoif3ildls um( p u) lerxocta1lmtrlivs (0srto(m no4ap n ncsas  Drrxronu0aptomfetyd m uanmsnu) etrmrciadomDe u ols0 rtm(o3iudllen fvtas sDrr( pno0oetomi3iadlmDraumon()tlermr io1fm  ln s;s)sexoxm oodlmen ivtl(  ruax ont4oltn oetls m2ul(mp;u) rxnmr oydoa elu o s0 rtmiopnu1lltn ici t  rtm(rp;o4opeomi3iatlsDrluvs (0trxnmfciatfmt aivo;()seuriopoodolte nvi ()aDum(mo;u4altniociatfmDua( p (0 rxoxr3to1oat aiei;t0teum(m3ny4ap  mivilt  2rrx o;u4opx  fetatla2rm( sn(0 rtoxr3iydfm eluvsls0trxmxm no4optnmncs t)a2raumoot4tpe  o3ilt sDelu p (4 exrmo3iodla   uei;(  exmir ny1olen ncsa()a2trx  nt0apx mi3ias aDrluvo;u)altrif iy1latranvs;s0teuo(r3ou1alen ici s)aDtaumpou4aetn octadfa ra( o u)tlxoxr3ty1la rau il()srxr(opnudameemivtls  Drru  nt0tlxo fetlsfaDemu s () rxrmf iodlmD  ivo t0t2uoiopio1apeelfvia() rrr( ooo1aptn icias mDrmuvpnt4arenio3oytlpte uvs () ruoxr3iu4opeemnctas) Drr(rono1tlt moeiys sDumuvo u0aleoiocoytfp   ieol(0 2xoxopiu1ol n ici s sDum(moot4ole mieildfm eln o;(4aetoir3ootlpDeaiesl() exmirpio4apt mnvsl() 2trumo;t4texnmf3tydfaDeanmon(0 lxnmo tadla r i o;t0 ruoxm3oy4altnlivsl( srrmxmo;t0oetn i3tldlsDranms;u4tetoxo3oa1fmtrlnes;t)s2xo(rpoudamtnmfctl( sruaxr ;o4oet  i3tldfsDuau o u)tlxrio iytfm   nvs (0trtmxopny1olt lictls sDtmurpou0tlxn fciysfs2umnvs;t0tleoxr3ootopDe uvs;s srum(o3iu4lmtnmncias)aDraxmp;o4tltn fcilt s ul(mon(4arxrircia1fmt anesl(0 exrim3iu4lp e fci ()s2trur ;u4opxnifeiys sDem(mp;u) rxrxociodop   ivo t0 exmimpnudop e net sfsrrru  ot0aexoifeildfs rm(monu) ltoio iy1optr uvo;s) 2xmio oy1lptelietas sDurxmoot0oeen feiydla2eauvont4trerif3tydoaD ai o s0 exr(m ou1lm elfes sfarrrumono0tet moeiyd m umumon(0 etniociatopDrli sls) eurim3iydomeemfvtl(fs2tmxmpnu0opx iieias s el(mpnu) rxnif ia1fat lueo;(0t2tmxo3ny4lp  mnvtlt)s2umxmo;o1texn oetat aDel(msnu)tleniociadlmDrlivs;()t2trimpnudal n iesa(f 2um(mo;o0tpeoiicias m ea( p;u0 rxnmf3oatlaD  ueolt0 rxmio3ny4altelivsl(  2taumont4tee if3iysfs rmnvont4trtrxo iatfmD  ieo;(0seum(m3nu4lleelfvtat  2tru p;t1tlx moetadfm2ra(mo ()tlxnif3oa1lmteanvil() rtrxopny1lm  lnvta()s2urxrpoo0tlt io3iytlmDul(vs u) exnxf3ta1fp rli olt  2xo(o3iudlleemictls aDumu pot4ope  oeiadls ran pnt4 lenmo oo1fpt aieo;t0 2umxo oo4olenmnvi (farrr(r ;u4apx mfetlsfs rm(mp (0altoxf ootoptraivs s s2to(rpio4om emfct ( sDrmur nt4opxn fetlt m em(mpnu)trtnmfcta1la ean i;(0s2toio3iodlmen nvslsfsDrauro;u4opxniociad a2umn snt0 rxoifctadomDeluvol() eurxm3oodap  lfcslt aDua(mpot1tlxnmfeiad a rmn sn(4areoxf3iy1lpt ai slt0 etrxo3ny4altemfeiatf 2ur( onu1apxomf3iadfmDelu on(4 rxnio3oo1fat anvsl(0trtrim oo1ap  mfvi ()srta( poo0teto ieiytfsDelums t0alxoxr io1lptranvo t)s2xmxo oo1ap n fviat  Dtmu  oo1apxo octldlsDemn s () exrmr tytoa r uvs;t0trtrxo3nu1aleemfvsa( srrauro;u0aexoiocildfa umnmont4arxrmrcia1fp r u o;( trtmxo3iodlm elietl( s2rau poo1oexn ociad a2uanvsn(0alxoxr ty1fpt ai ols  rto(o3no1lpe  iet () Drruro;o0texoifeils s ul( sn(4altoiociotlptelieo;(  rxmxopny1ol elnvsls  ruaxrp;t4alxnmfcild aDrmuvp;()aetnmf ty1fp  ln s t) 2umim no4alt lfctls) rraxmp;u0tltoifetlt s2rauvs;u0trtoxr oatfaD aieo;t)teumxr nodale  fvi sf rtau  ;o1olt mi3ias s ra(mont) rxnir3tatomD  ieols) rxmirpnu4ol   nci tfaDta(root4oeen f3ilsfa2uau snu)altrmo3to1fmD ai i () 2xmio3ny1ape lfvt t) Dtmx onu0apt  ieils m2ulu p (4teerif3todfate ues;( teurir3oo1ap n ict s)sDtaur nt4alxoii3tlsfaDem(vs;u0 lxoir iydlpDe neo;( t2xrir3ny1lptnlfeiltfs2ur(ro;u0tptn i3iltfs rmnmo;u) ltrmfciydlptr n i;s)s2trio nodll  mfvtlt) 2rm(m ;t4opt iiciatfsDuln snu4 ltrioctotlp   uvi;t) exr(o oydop  mncia( a2truro;t4oetomiciysfa2ranvs;t)arxoir3todlp   uvo ( texmim3iu1om emfvs tfs2ta(ro;t4teeomieiytls ranvpn(4 eeomf3ootfaD aneo;(0 2xm(r oydam elictlt)srtaur no0aexnmociasla2uauvonu)arerxo3oodopDe n sl()seuo(opny1lm elfcia( arraxmo;o4texo o3tyd s ulnvs u4tltnxr3oo1opteauei;()sruriopou4omtelnvsa(f Dtr(mooo4ole  feiydls rau pnt)texrxo3iatlp  lu i;t  2toxr ny4lltelfciat) 2rax onu1tptoifctydlm uanmp;() lxrif oodlpt aueo (0srxmimpnydolenmfvta(f 2rr( p;u4aptomo3ild s ea(mp u4altoifctodfmtrli i;s)srumxo oo1ap emfvtlt srumxmp;u1apt  octas s em( snu) etoxfciydoa e ies;(0 2umir io4am e ietltf 2tmumo;t0tpx mf3tadfaDrmu p;t0tleoxf3to1fp e ies;s0s2xoim3iy1altnmnei tfsDurxrpno0olxomieilsls2ea( pn(0aexnir3iydfaD li s;t)s2umxr3ny4ape mnetlt arta(mp;u0apeo o3ilslsDrln sn(4alxomr io1opteaiei;()seto(o3ou1om   fct t) 2umxrpnt4oeeoio3tydlm rmu pnt) leomr iodomDe i s s) 2tm(o3ny4lmen ict sfa2umx pot0olt iociltfa el(ms;u)arermf tadfmt lnvolt)texrimpiodol emnetls  2tmur ;t0tlxnmfciatfa2ua(ms ()teermf3ty1lpD lu i;()tetr(mpnodolee nvslsf Drmx o;o0aeeoifeiat mDea(vo t0tlenif oadfa   i s (  ruo(opnodol e fvs ( aDrau pnt1aetn oeiasfs2ranvp;u) eermf3iatlm  livs;s) etrxmpio1omtelfcsat) rraxroou1olx ifciasfaDrlu o () rtrxr oytlm rluvi (0trxrxr ou1opeelfvils  rrm( p;u0tlx ioctatlm uanmp;t0areoircootlm r u s ( srxmxm oo4apteliesl(  rrm( ooo4teeoioeildfa2um(monu4aeenmr3io1oatrlu sls  rurio oudam elnvias) 2uru  oo4tlxomoetltla2elnvsnt0 lxoif ta1opteluvo;(  exo(opiudlmtnmfvsls  Dtmxro;t4apxniieilt a2ulu p u4arxrxr iadopt au o;s) 2xo(o oydol elictl(fsrtr(ronu4tpenmoetysfm ulu p u0tlenmr ia1fatr n i t)srxmir3ny4lmt lfetat  rtau  oo4tle mfciytlm2elu s t4aetomr3oytlaDeaies;s0srum(rpiu1lp  mnei ( sDtax o;t0aex moctyt s2rl( o;(4 rtnxo oy1oaDrlnes;t seum(rpno1lme mivilt  rrm( pno0aptnmfeiasla rmnvo;t0 etnxrcoytlpD  ivsls)trur(o3oy1apte ncs (f rrrumpot0aeto ociad m2emuvs ()artoxf3iotfaDr ivo;s sruoxmpiy4lmtnmics s s2tm(r ;u4tpe io3iyslsDeanvs t4tleoxf3iadfa   n il()t2xm(m iu1lmte fct (f 2tau  ot1aex if3tls m rluvp t4tetoifcty1laD an s;t) eurxo3iydoptemicsas s2umu p;t1oeto ieiydfaDelu p;t4trxnifcta1fpD  uvo s)seumxm3oo1al   fcsatf rtm(mont4tlx moctatfm emumo;u)arxnmf3iytomDrlnvs t trtr(o io1apee fvt t s2ra(m nt4alxomfeiltfsDumu s;()artrxfciadfa e i s;t0s2tmxo3oodal emfcils aDur(r oo4tlt iicildlm umn ont4aetrmrciotfptr nesls t2xmxm3nu4omt  nvs tfsDurxro;o0aexnioeiysfm rmumont4areniocoytfa  livolt t2xr(o ny4olt livia(f rtm( ooo0optomictysfs rlnvs u) ltnxr oadoptrln o s0 eurxrpoy4amt  neilsf rta(r nt0tpxo o3tat m uln pnu4trxnmo totomDrau ilt0s2xr(r3nydlmenmivs s  2uaurono4tpxomfeiyd a2ea(mp;(4altniocoydfat ai s;t0s2ur(r3iy1omtn fcsat sDtmxm nu4apt if3ils sDulnmpnt) etnif oa1lmteaivo;t) 2to(rpoy4ope  fvia(faDrr(mono1oee iiciad s2elu pnt)treoxf iotfmD  nvs;s trxriopno1omeelfcsatfaDrr( pot4tltoif3tysla ul(vsnt0trtrmr oatlmteli i s0 2urxm nodoptemnes sfsrrr( pot0tpen fctasfs2elump;t4 rtoif3tadoaD an o (0sexoxo3ou1altnlivsa()aDrrumpou1oex mocils m2ranmo;u4alxoir3iatomDr n s ( s2tmim3oudalenmivilt  2uax ooo0opxn fctldfa2emumont0arxoxocoytfmte ueil() rxmxr3oudlme lneias sDrrxm no4alx  o3iltlm2rl( p;t0arxnmf todfaD  uvslt)s2tr(o3no1om  miet t a2tr( o;u1alto ictltfsDelumo t4 rtnioctytlaDeluvs s0 2urirpio4lmeemnes tf 2ua(r ;u1oee ifeias m2el(mo t) eenif3iy1op elivo ( t2trio nudlpeemics (  rrm( o;u4oex iociyt a2rlu onu0tltomo3todop e u ols  2urio oy1amt miet s a2rmumpno0aee  iciydfmDuanms;(0 exnirctytlmtrlu s;t)srur(o io1lpt mneiltfartm(ro;o4tpxniictldfm2ulu o;(4altoir3ta1oaDrauvi;s t2uo(r3io1am e ies t)aDum( oou4tpeoifetat s rauvsn(4 lenmr3oy1fpD  nes t)tetrimpiu4omenmicsat srrr(  ou4tpx iieiad s um(vs;t0teenxf3iodomDeluvils trxrxrpiodam nmietl(fa2rr(mpnt0aeto ociltfm em(mp ()arxoxr3oo1omteau sl() 2tm(r iu4om e ivsl(fsDrm(mpno1oetoiieildla2umnmp t0tetomr oatlmt  i o t0trxmim iy4al   fesasfs2taurp;t0tlx miciatlm uln sn() reoif tadfa  luvi;s0 exoxo iudop elivsl( aDrrxmonu1teto ietytlm umnmpn(4aetomrcoadoptrauvslt  2tr(m oy4ome lnes sf Drru  nt0tpeniicilsfmDumumsnt0aleoxfciadlaD anesl()srtrxo3iu4ol nmneiatfsDraump;u0aexomo3tldfm2eau sn() rtrxrciodlaD lueo;s0s2uoim3nodlpt livilt)s2tm(rpoo1teto ieiasfmDrlu s u0aexrmf3oa1laDe ieo () eto(rpio4omte ivt t  Dua(  nu4tpxnmi3iadls2eln p;t0arerxoctotoa eai sls0t2um(r3ny4altelfctasfa2urx p;o1tetnifetltla2rl( sn(0 lxrmocio1fa   ieilt)trto(m iu1lltnmics (f rtru p;u4tlxomociatfs2el( o;(0 exomo3io1lpDrai o;s) rtm(opoo4ameelnctls)srtmxmpnt4aex ioctlt s2ua(mpn(4aexrio oo1oaD auei s t2tr(m3oo1olte nvs t) rtr( o;o4aexomfetat a rl(mo t)tlxomo3tytfp  aieo s0s2uoxrpoy1lpe mnesa()a2tm( pnt4optn f3iytfs2ra(vsnt)altrifciatfaDeau i t)t2tr(o oodlpen nci s)sDrmumooo1altnmi3iysfs2rm(mo (0arxrxo3oodlatr u ils0teum(r3ny1op e feia(  rtrump;u0optniocias a2em(mp;() etnxf3todfa  liei () rto(m ny1lp n nviltf Dtmxmoot0tet mi3tatfmDum(von(4tltomr3iodopt lneslt) 2xmxopny1olt  fvtat)sDumumpou0tetn f3iytls emumo (4tlerxf3io1oateln o;( srxm(m3iudll nmnvilt  Drrxm nt0tpe if3tyt s ul(mo u) ltnmrciydlaDraies;s)trtm(opnudlltnlfct t sDtrx pnu1tpeo fciatlm uau p u0trenifciadlat anvi;s)sexr(r oodapt  fvsa() rrau pnu1apen i3tatfs ulnmp u0 leoio3oa1lmDr i o;(0 eumim3nudolte fvtas s2rmumoou0texnmo3tlsfs ulu p;t4tlenmo3ty1latraueo;s0 exr(m3ny1am  mfci sf Dum( p;u4tpxoiieils s2ranvo (4 exnmocty1fm  ai ol()seurio3nydap emfvslt)aDra(mo;o0opxnmfetlsfsDea(vp;u0areoxr oadlaDr n ils sexoxmpiy1op emies ()sDtrx pno0tpx  fcias m2ranvsnu0trtrmf3iodopD aueilt0 2toiopoy1alee ivi t)aDtmxrp;t0texoioctydfs2eaump;()tetrifciadom rluvs s)texrxmpiy4llte nctlsfartaumoou1aeenioetadlaDuauvs u4alxoxo3iadfm ran i;t)t2xo(o3no1am  lietat) Dumuroot4optn fciytlm rln o;(0altomf ty1fat luvs t  etmxr oy4openmicsa(fs2uau onu0alto fciysfsDrl(vsn(0tlerif3ia1oa ean o t  eumxr3ou4ome mfci (fsruaurp;t0aet ifeiatls eln s;(4altrmfciydop  luvilt0sexrxr3io1lme mfvs (  Duauro;u0apxomf3ilsfsDumnmpnt4 exnxf oy1omDe ueilt) euoxmpoo4ameemiviasfsDrm( pno0teenmiciysfm ulnvp (0trerxfctytoaD aneo;t0 2uo(mpou4ap   ncs () rururpnu0aetoioeiysfm rmumo;u) reomf3oytlpDraueolt srxr(m iu4op  mfcslsfarrm(mpnt4apx  fcils a2um(mp t)altrxr oy1opt lnei;s) eum(m3iy1olee fcta( srrmxm ;u1opxn ociys sDeau o;u)tlxnxf iotfm  lnvs s0 rum(m3oydap n fvslt aDraum ;t0aptomo3iytfs el(ms;u4 rtnmr3io1fa  ai i;t)s2urxo3nydlpt  ictlt  Duru oot0oleoiiciyd s rau p;() renio tydoat  ies;t0 rxr(o ou4lmee nesl(  2tmxmonu1teto o3iaslaDuau o ()aetrif oa1fpDe u o;s0texrxmpiydaltemici (f ruaumont0teeo i3tasls um( s;t4 ltrxo3oytfm  anvs;(0 eurxm io1lmtemictls) 2rr( pno4alxnifeiadfsDumn s;t4teerif3ty1om r i o;(0s2xoxopou4om elici s)a2um(mooo0apenifeiytls rmnvs u0trtrir3iadfm eauvil( srtmim3oudamtemivsl(f rum(m no4tpe mfctytfa rluvpn() leoio3tatlmDean o;( srtoim nudop e fvtat srtru o;u4tptoii3tldfaDea(vo;u0aetnmfcoa1fpD  nes (0trur(r3ny4opt  fvs ()arum(  ;u4aex mfeias sDrauvont4 rxnmf3iodomtranei;s0trto(m oy4am elnciat) rtrumpnu4oee ioeilt sDrmn s;t0artomrctodlmt lnvilt)t2xmxo3nydolt  nvias)a2ur(rp;t4tetomfctadls2ul(mo () rtomr3iodop elivil(0 rtmxo3nu1ome mnes s srumu o;t0opxoii3ilt s rmnmon(0 etoxfcoatla r n i t)tetm(m3no1ol n fviatfsDtru p;t1oet mfeilsla umuvpnu4aetnif iadfaDrauvs s srurxo3no1ope  fcsl( s2tm( ont4tee  octasfaDea( p;()alxnirciadoa  an s (  2tm(rpiy1ll emfcias) rtmuroot1aexomicild a ra(vp u)arenxo iatfaDrlivolt  ruoxopoy1lleelnct t sDrmumonu4apx ifetldfa ua( sn() ltoxr io1om  ai o;t)t2to(r3nu4amt  ivtls a2tmxmont0teeomf3ildlsDel( pnu0teeomr3tatfaDr i olt)texr(r no4lmtemnctatfa2rru onu0opx if3tydla ranms (0tlxoxf iytfpteaies;t)trxr(o nudaleelfcta( s2um(moou1aeeomietatlm2ea( o u) exomfcoadfmtr n il(0 2um(mpny4ole lfet s sDuaxr ;t0teenmieiasfm2eau o;t0tetoio iadomDeliei t s2tm(rpiu1lmenmfvtlt) 2rrumo;t4aeeo fcilslmDelums;(0arxrmf totlaD luvo s) 2ur(r iy1lmtelfct () Dta( o;u1opxo octydls eluvs u0aeeoio3ootfm   ivi t)srtm(r3no1lme lnciasfaDurumpot0teenifeiatlm2umnmp;t4artrmo tytlp e ivi ()srxoirpoo1omt  nvsls a2urxrpot4oexo oeiatfs umumonu0treoiocty1lm   uvs s)s2umxopnu4amenmfvtas arraum no4oeeoio3iadfm emu s u0 rermf3to1om rliesls trtm(o3ny4ap
\ No newline at end of file
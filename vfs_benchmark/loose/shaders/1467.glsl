@@ -0,0 +1 @@
+neolt seurir oudlmtnlfci sfsDtaumpno0tpeomfetatfm2ranvs t)arenifcty1lmD aivo;s0 2xm(opou1optelfvtas)srum(r ;u4alto oeiaslm2uln p u0alxnxr3oytlpDrlnesl(0 etoim nodlmt mfei t)aDumum nu1opt mfcias mDemn p t)aeerxr ty1op  liei;t)srto(m iydape mivtat)s2trxrono4tpxomoeiyd m2ulu p;t)trxnxf ta1fm  anvo s)sruoirpiudoleelfci tf 2rr(ront1teen i3tysfs ra(vs;t4 lenifctydfptrlueolt0teuoirpoy1apt mfcs s  2umx oou4apx if3iyt s elnvs u) rtnxr ia1om e i i;t  rto(mpoy4altemnei ( sDta(ro;o1aleoii3iyd s2rl( ont0 eermo oo1fate n s s)teurir3ou4ll nlivi ( aDtrxmp;t1tpxo ietydla2rl(ms (4 lxriociotomDrlneo;s  2trimpoy4al  mnvi s) rta(  ou0olt io3iat mDrauvo;(0tlerxfctydfat lnvi s0 2to(mpoodaltemfctl()arurxm ;o1olto i3iyd s ea(mp () exomfcty1lmD au o;() 2ur(m nudlp n nct sfs2rrxr ;t4tlxo o3tat s rmnvs;t) ltrxo ty1fmDr ues ()texmim3oy1am nlieta() Dtru pou1aexo ociltfm2ra(mo (4 lxoxf ia1oa r ies () exmxm3ou4am  lncils)a2rmxmpnu4ope  i3tlsfm rl(ms t4alxoxociadlpt luei t)s2tr(rpnudol n iei t)artm( poo0oexnio3iadfm rmn snu)teenmr3oydfpteaueo t0srtoirpoo4om   icil(  2urxm ;u0texnif3ilslsDemu pnu) lxomrcio1oaDr ues ( trtriopio1omen iviatf rtr(m oo4tleoii3iat mDrm(msnt4 renxocoatlateai ol(0texm(o3oo1ameelictltfartrxmo;u1tlxnmocildfa2rm( o (0 ltrifctydfa   ieilt texrim ou1lleelfei s aDtmx  nt4tex  octlt m2rmums t4tlxoifcoy1fmt livs ()texm(r ou4llte fvs ()srum(mo;u0alxnif3tldfaDul(vo;t0teeoio3io1lm   u ol( t2tr(m3no1omenmneil()artmx  oo1oeeo ociytfmDemumo;t)alxoiocoy1om  au o;s) ruo(r oo1llt livslt sDtr(  oo1oexomo3iydfs2ulu pn()aeeomr ia1fpteauvo;(0t2um(mpno1lm   fvsl()arrmxronu1oexnmoeiadfm emn p u0tlermf3oy1fptraues;()srxmio oudlptnlfeils)a2ua(rooo4olxn ociat s rmn o;(0 lxrif3ty1oateanvi ( texm(m iodlle  nviatfaDumu  ;o1apx mf3iat m2rl(mpnu)aeeomf3tydfm   uvils0 rtrxm oo4op   neiat  Dtau p;t4olto i3ilt a2ul(ms;u4 rxnifciytom  aivs;()trtrir oo4lm  mfvia( aDtr(mpnu0ope ifeiadlmDrm(mo () lxnxr tadopD aivolt0texoxr iy1amte ivtltfs2rmuroou1ope ifetlsfa2uln s u) rtoxr tadop r nvslt)setm(opnydam  lics t) 2rm( ont0opeomf3ild aDemnms u0tltoxr3ia1oatr uvsls  rxoir oudlmtelnetltfa2urx pot1aet ifetydlmDua( sn() ltrmrctatomDran s t) etoxm3nu4ol   ncsat s2tmuroot0tlx mocias m um(von()tetrmo io1oa elieo (  rtmir3iy1ale  iesa(f Drrxmpnt4aet mfeils m ean pn(4alermr3ootfp   nvs ()setm(o iydllt lneil(  rtaumo;o1texniocild mDeln p u0 ltrio oa1op eaivi;s) rxoxr3ny4om nmfct tf rua(mono1oee  fciltfs2rlnmsn()arxoxfciadfptrai o t  2xoxo3iodapen ncslt)s2umumono4apxomocildfmDeau s;(4alxnmrcoo1faDrluvs t)t2xr(opnu1lle mnci sf 2ua(ro;t4texn ieiatfaDrlnvp ()aeerif3oy1latrlnvi;(0s2tr(mpnodlle  ictltfa2rmx oot4tptoifetas a eanvont4aexoxr3io1oa elnvol( tetm(r3nu4ame mivia(  2rmx poo1tlxoif3tlsfaDuau s (4arxoio io1laD aivo;t)teur(rpiudolen nctas a2taurp;t4apx  fciaslaDum(mpnu0tltrifcoodfmD li s;t srtmir io1al   fct tfaDtmxrooo0tltoiictydfsDrauvp;t4 lenmocoa1faD lnes s)teumiopnu4lmee nvi ()sDtr(mooo1ape  iciydlm umumo t0teerxf3iatlpDr uesls0 2umxrpiu4open fvt ( a2ra(root1olxnmo3iyslm2emnmpnt0 ltomf io1op e u o (0srxmimpio4olee ivtas) rraxrpno0altomoctadfs2um( p u4treoxoctatoptr uvo;s srtm(opoydamen ies tfsDumxmoot4tlx mieiatfs ra(mpnt)trermo3ta1lptrauei t) 2xm(o3io1lp emfesltf rrr( pou1aex if3ilslm2rlnvsn(4teeoio3iydlmD aueslt)t2uoim3nydlmen nctl( sDtrxroot1tpt iietls sDem(mp;(0 lxoxrctatfatrlnvo t s2tr(m no4lme mncsl(  Drr(root4aetniiciasfaDrm(vsnu)aexomociotlat ai s s trum(m3nodop elivt s)aDrmur ot4ole mf3iad s2uanmon(0arenxrciy1lateli o;s)texmiopnu4lmt miciasfsrumxmooo4oeenmfcilt s uaump;t0teerir3totlm  an s;( trxoxrpno4am elnvt (f rua(mo;t4tle moeils s ua(vp u0arxoxocty1faDrli i;t  ruoio3oy1opeemivia( srrr(roou4tptnmi3ilsls em(ms;t4 rtrmrciadfpDr iei;( srxrio nu1omtemieilt)sDrm(rpno4tex  o3ildfm emnmp t0texomr3todom rln i;(0teur(o oodaptemncs s)arrrx pot1oexnmo3ildlaDemu pn(0aexrirctodfpt ln o ()seto(opiodal emiesatf rrmx p;u1aeeoiictasfa2ul(mpn(0tlxomo tytfp  lnvi;t0s2triopnu1op nlnvils)a2umurpoo1oet  fctatla ranmo t4altriocoy1fptr u s ( t2urxm nu4am emivtas  2rr(ronu0teen feiat a ul(vo t)alxnif oo1opD  ivs t0 2urimpoudap   fvtasfs2trxrp;u0aleomi3iatfs2elu p ()treomf totlmDeaivo;s  rumxm3iu4om e nvs s a2ra(mo;o1ape  ociat aDua(ms;t0tleoif3oy1lp rlnvs s  2tm(opoy4al   feil( sruax  nt4tlx ifeiytlmDrmuvs ()teerxo tytlm e uvsl()trxoxr iodllenmfcslsfarumu p;o4apen ocild m rmnmp;t) renxo3ta1lpt ln ols0 eurxmpio4omtnmncsa()s2tau ont1oex  feiadfsDranms;u4tltnmf oodlm r neilt sruoim no1apt mnvils artmxmoot0alen octls a2ea(mp;u)aexnxrctotfp r u o t0 rxmio io4am nlncsl( aDrrur ;t4oexnmieiaslm2ea( o;()tleoifcoa1oaDrau o;()s2xo(m nu4op e ivslt) Dtm(ronu4tlx ifctyslsDrlnmonu)artoxf iydlatrau ilt s2xoim3oo1ap   nvs t aDtr(mp;t4optoif3iytfaDemnms (4texoioctydfa e i o;t  eumim oo4ol nlnct (fsrurxmpno0aet ioeiytfsDum(mp;() rermocoytlp  lieo s0t2xr(o no1amte ivilt s2ur( oou0aptoiieilsfsDua(vs;t0 exnif oodomDeluesl()s2tmxr3iodaltn iet s srumx o;o1ape mfciasfm2eau o;t)arxomo ootfmt anvo t0 ruoio io4alee netas) Dur(ro;u1tltnmociytlm2ra(mont4teeomo oy1laD li o ( t2xoxrpoy4amt lici s) rrau  ou4oetoifciyd s2ran p;t)altnmrcoodfmDeli o (0srxoxm3oudom emncs s)sDrm(rooo4olen ociatlaDrlu s (4arerxf3iytfa r nesls0sexoio nodapt mfvtlsf rua(mo;o4aetomoeils s2rm(msnt0 exoio tydlat auvs (0texm(rpnu1optn ieta(  2tr(r nt4aleo ieilt sDeanmo;(4tetomo3oo1oatrliei;()tetm(m3ou1op emiesas  2ra(r nu0ole mfcias aDrmump (4teenmrcto1lmte uvolt srtr(rpnodlm nlncsas  rtr(mont0oltn o3ildfs raums ()alenmr oydom e u sl(0t2xmxm3oodlp  mfeta( arraxmono1opeomietasfs rlums u)tlxrmf3oadom  lueols)setm(mpio1lptelnvi (  2ua(mo;t4ape  o3tas s umu p;t0tetrxo iadoat  i olt0 2um(m3no4ameelfesa()aDrru  ou0alt mfetyt a rm(mp t0arxnxrcootlate uvo;s sexrxo3oo1oltnmietas)artrumoot0tpt mf3ildla2rmu s;(4texrir3oodlp r ues;(  exoio3io1lmtnmncs (f Draxrp;t4apxomociysfaDra(ms t)trxoif tytopDrli o;t)seuoxr no1om n fctl( arrmur ou1aexn i3ildlsDulu sn(0 reomr3ta1fa  aivslt  rxo(o3ny4omenmfesat  2tau  no1olen ieiatlm uauvo t4 rxrxf3oodopDelies t)s2xo(opio4lleemnvi (fsDua(r ou1tlxn feilsla2eauvsn(0tlxoxr3iy1omD  neslt0trtoio3nu4lpeemivsa(fs2rrxr ot1oltn ociyd sDra(mont)aexomr iadfpteauei s s2xr(rpoudoptn fcsl(fa2rm(rp;u4ape if3iatls2ea( on()trxrmr oa1lpte n s;s)truo(opoo1amen ieia()aDtm(mo;t1apxniietls m uanms;t4arxrio3oy1fat  uvi (0 2xr(m3oudom n ncs sfsrta(mpno0tpt  oetad a2umu s u0aeerir3oo1lpD  n o;s)t2urirpou4lpt lfvtas aDrrum ou0tlxnmi3tadlsDem(vo u)tltrxf oadfpDrau i t  ruoiopio1lm emnet (farrru oou0apxnif3tyd mDem(vo;u4 renxf3iytoaDrauvo;s)s2xr(m3ou4ame  iciat s2tmxmonu0olxomf3tltlmDuau pnu0 rtnxr3oo1oat  uei (0texr(opoo4lptn ivslsf 2trumo;u1apt if3tatfsDeanms u4trtnxrcoytop  lu ilt t2xoio3io4alteliet s srtau ooo0tltnii3tltlmDumnvo t0 lxrio tatlp  luei;( texrxr no4lptn ivsls) rtmxrp;t1tleoii3ilsfmDemuvp u)alxnio3ty1fpDeanei;s  2xrxr no1llen fviatf Dtmum ;t4aet if3iydla ea(vp (0trxrif3totfmt lnvi;(0sexmim3iu1lptelnctasfsDumum ;t0aexn oeiytlaDrm( onu)trxnio3to1om e ueols)setrio3nu1lpe licias artrump;o0alto icias m rmu o t0 etriocoy1laD  nvi ()s2trxm iydomtelfeiasfs2um(mpoo0oex mociytfa2em(ms;u4 rerir iydlmD  u sl(0 eumio ny1olenmivtlsfsDumump;t1tptoifctas sDrmumo ()treoir ootlpDraivo;t seum(o oo1alen nei (f 2ua(r ;o1olxnmo3iltlm2ua(mpnu0 ltoxf3iodlmDrau o;s0t2tmirpiy4lp emnvtl(fs2rrurpou0oetnmiciasla2emnvp u)tlerio3oa1fm eli i;t s2ur(o oudaltemnct (f rtm(mooo0tetn fciltlm2ranvo t0trerio3oa1fm rlnvs;(0 2xm(r iy1lmeemnvilt)aDrrxmpno1tptoiicildlm uau s u)areomo io1lpDr n o s trtoir3no4optemnvsl()sDtr(mpoo1opxo ieiatfm ea(vsnt)aeenmoctodla raueol()s2xm(r3iu4lp nmivt (  rua( pnt4opeo fciytla2rmn snu)alenmf iytomDrln ilt tetr(r3iu1ll  lnvsl( sDumxmp;t1oetnioetas a rluvo u4tltoir todfp  auei (0 2urxopno4ame  nvils  2urxroot1tpx mi3tyslmDemn o;t) rxrifciydoptrlivi;t)srtrim oo1ap  lfvsls a2tau oou1oet iieiadla2um(mp u0aetrir3ia1omtelneo ( t2trir ou4om emietlt)sruru oou1aee ii3iyslm2ul(mo u0treriocoadfm rli ilt) eumxopoo4llenmfesat aDrm(moot1texn ocils sDelu p (4tlerxfciydoptrlneo;s)trtrim nudapeelfvsltfsrumx ont4apxnmi3iatla ean snt)alerxf iadlateau ols0sexrxm iudllt lnes ( srrru  ;u0ape  ietat a rmnmo;(0aeenio oydfp  lneo;(0srxm(m3nu4opt mfetl(farta(rpnu1aexn ictadfaDemuvo ()tlxoircoy1lmDe iei s) etrim3no1ap e nvia( a2uru  no4oetn iciyd s eanvs t)tlxoxo todom rlueolt s2xmxr3oo4amtn iet t)srrrxront1ole  f3iytlaDuau on()artomf oadomDraivo s)t2tr(m3ny1op n ivsl(f Dtmxmpnu0opxoif3iydls rmnmon(0alenxf3oa1lptelnvo;s) etrxrpiy4olenlnvs sfa2ua(moot1optnii3iydlaDrm(mp;u0texoxo3tadla  anvs s0seur(rpiy1optnmicta()sDrru o;o4aetnmo3ias m2rmumsnt0teenio3tytfm r ivs;s setrxr3oy1lltemnet tf rtru o;o1apxomo3tldfa rmnms;u0 rtrxocoa1fmD  n ols0trur(rpno4ol elfcia(fa2tr(m ;o0tpt mf3ildfmDuaumont)aexnxo oodfaDeau il( tetoio ou1lmtelnvils)sDuau  ;u1oleomociad a ea(mpn(0 lerxf3iytfm rlneo ( srur(mpiudapte iviltfaDum(ro;t0tpxn f3tyt m rl(mp u0arxnircia1laDelnesls  2xoirpny1lptemncilsf 2rr(m oo1ole mi3iadls rln pn(0tleoif3tydlmDrlnvsl( trumxo3nodlp nlfciatfsrrmumono0opt ifeils s rmn snu0trxnmf ia1la  ai i;s  euo(rpiudlpte iesa(  2rr(rooo4oetnio3iyslm2rauvsn(4 ltnxo3iotomt livilt0srur(o3iu1op  licsas srta( p;t0aptoiieiadfmDumnmsnu4artniocto1fmteauvolt0 exoio nodoltemicsa( s2tr(  ;u0texomo3iat mDrmumon(4alxomrcoadfp rli o;t0trtm(o3ou1lle  nct (  rtr(mono0olxnmi3tys s2ea( o u) etoxf3oydomDe ueslt  rxo(r3ou1op nlnvtas) 2umump;o0alt mo3ildla el(ms (0 exrio tatlm rlivi t)t2umirpnu4olenlici t  rua(root4tee mfctlsla2elnmo;(0aetrmo3ta1lptr nvol(0t2xrio3iudaltnlictls) ruaumo;u0tee  fciasfm2el(ms (0texnxfcoo1fptrai i s)trtrio oo1amt lietltfaDrmxmo;o4opxomf3iadfsDumn s;t4trtomocoytla  anvi;(0s2xoxm oy4ome lnetls)arrmu p;t0ape io3tadfmDumnms;t0aetnmrciotop r u o s0s2xoxmpio1alt  fes sfaDra(mo;t4teenifetyd a2elump;t4trxomr iotfm  an o;(0trxriopou1op e fci () 2trumpnu1apeoifciadlm2raumo;(0teenmrctadla rluesl( t2uoimpoudop e feil()a2umum ot0olto i3iydls2rl(mo;u0trermr3ootfa  lieo;s  2urxo3oy1apeemfcs tf 2urxmooo1tpx  feilsla2rl(ms u0trxoif iydom rlivslt0trxrxm ou4lpeelnei (  2uaxro;t4apt mo3tydfm elnvs u4tltrmfcoy1lmte ues (0t2xoxo nu4amtn nvta( srraxrpnu0tpe  ieildls ra(ms;(4 rxrioctadoaD aneo t teum(m nydapeelnei tf ruax  ;u4tex ifciydlaDrlnvpn(4 lxrmf iydlmtrlieslt0 etrimpiodol   ieta(faDra(r nu0texomiciltfa2um(vs ()tlxrir iodoptr i il(0setmimpny4amtnmnctl(fa2uax  nt0tptnmi3iysfm2ulnvo t)alxnmr3io1laDe neolt tetm(rpnodapt mfes t)a2um(  ;u1teeomoeiat a rl( sn(4tlxoir3iodop   ieo;()setrxmpiydopee fct t  rur( o;o1aptoiictydfm2rm(mp t0artomr3ta1faD luvslt)teurxo3iudaltn ivslt srrm(m ;t4tpeoii3iydls umu pnt)trtoiocoy1fpteanei;( texo(o iy4apee fesl()arrmu poo0apeoifeiltfa uaump (0trenir to1omDeauvi;t s2umxr3iudlptn fvil(fs2um(r no0olxo f3iltfm2ul( onu0 exoxo oytfm   n ol(0teuoxm io4lp nlfetat sruaump;t4tptnmociydlaDumn o () rerxociytfaDrli i ()setmimpou4apee nvta(fsDurx ont0texomictasfs uau p t4 etoxfctytfpteauei;t) rxr(r oo4alt mieilt)a2uau poo1alxoifctyd s2rlnmp;u4texoxf3iatopD li olt0 euo(mpiy1am nlfciasfarrmum oo4tpenmociys aDeluvp t4 etnir oatopDrlueils trurxrpoo1ll  lfeilsfsruaxr nt4tle  ieiadfs ua(mpnt0 rtrif oydoaDeln slt0s2um(mpou1ole mivi (fartm(r ot4apxniietysfsDulu s u4altomo iydlaDe iei;(0 rxm(o3no1op elietls)sDta(mpou0tetoif3ildla rmump t)treoircta1fm e i i s  rurxr ny4lp emnvs (  Durxr nu4tpxomiciytfm2uauvs (4 lxoiociadfm elu i;(0setoiopiy1ol  licils)arrrxmp;t0alxo f3taslm ra( o (0trtrmr tytlaDelies;t0 ruoxo3oy4ole lfcslt)s2rm(r ot0apxnmoeildfaDea(vo;t)altrmr3iatlp  auei;() etrxmpiu4ome miei s a2umur oo1tlt io3tls mDeln pnu4tlxoxfcoodoate ues;(  rtrxr3nodolee fctls) 2trxm nu4oetnmoeilslsDrmumpnu)tlerxr3tytomte ieo s)setmxr3iodap elnctlsfa2tmu  nt1tlx  iciys aDelnvp;(0trenmr ty1lpD aies ()t2to(r3io1aptnlfvsat arrr(  ;t4openioctys aDum(mp;t0tlxrxo3ty1lpDr ieil(0trtmiopio1ol n fet sfaDtaxroou1texomfeiysfs2uan o;t4tlenif3tytlaD lu s;()truoxr oy4ale  nes s  rtrxmoou1altoifeildls el(mo;t) exnioctatlat ln s;t)seuoio iu1apte fvs t sDurxm nu1olenio3iad m rmnms;t4texomo ta1fmt  u o;t  rum(m3oy4ope lfvsas) Dum(r nt0teeoifetytls2uan s;(4 rtnxr3tytfpDranvs;(0s2toio3oy4openlneiat  2ra(rpnt4texn oeiat m rlnvsnt)altrxr oy1fpD livols0 2um(mpiudomtelfvtltfs2raumpot0apeo fciatlm2uluvpn()trtomf3oo1om  lieo (  2um(r3oy1amtnlnetatf rtm( ont0tpe  o3iytfsDulnvsnu4 rxniocoodfp eaneils)setrxr3oo4al nlivi (f rtm(  no0oet  i3tls s em(vp;u4arxnir iotoaD  uvs;(0t2toxrpiy1ape  fcsl()sDtmx o;t0altomi3iydfmDuau s;u4arenmr3oatlatrlueils t2xoir iy1aleelfctls s2uaxm ;o0opeomfeiat sDemn s ()altnxf tydlptelneilt) 2tm(rpiodapt lfet t s2ua(r ;t0aee mfciat s rmumpn(0 rxoioctadopDraneil()trumxo3iodaptemnvsas)arrmxmpno1opxomoeiatlmDumump;u)aetomo3iy1fm rlneilt srxrirpiydop emivsl(  Drmx o;u1ole mo3ias aDuau s;(0aetrmo3oadlp elnvs;t0texoxo3iodlptnlnetls) Drr(mo;o1apxoiocilt a rmu onu4trtoxr3iydomt luvs;t) rtmxr oy1op   ivsas sDrru o;u1tpenio3iltlaDeluvpnu4tltriocoytom rluvi;( teurxrpiu1llte nctlt aDurumono1aptoioetyd s2uluvpnu4texomfcta1lmt  u i s) rtmim ou1apenlfetlsf rum(rp;o0tpen ocilsfs2eau s (4arxoxr to1lpD  uvo;()texm(m3iydlm nmnct ()a2um(  nu4aet  ocildfm emuvp;t4 rtrif tydlptr ueo;(0teur(mpnudol nmncs t) rrr(moou0tltnio3iat sDul(vont0 lxrio3tatopD anvo;s)s2xm(m iu4ll nlnei t)a2rmx onu1tlt  ictldfaDel(monu0tlerxoctytfmtr ivslt0 2urxo3oudapee nci ( a2trurp;t4oltn ieiyd a2ua(mo () rtoir3todlat ai i s t2xoxm3iodal emnct s) Duru oou0oex io3ild mDrauvs t0 exrmo ty1fmDelu s;s t2to(m3no4olt mietas)srtrxm ot1tlx  i3iyt sDeauvo u4arenmo3iadfm r n ils s2xoio nodopenlnvsl() rrmxmpoo4oeeoii3tytfmDeanvo;u)tltoiocoytfm r ieil(0texr(r3iy1op   iciat a2tmumoou4olxomiciytla2em(vsnu0trxrirctadom rluvs t  rxmxopno1omeelici s a2trxmonu1tet  ieilsls uan onu) exrxfciadlp raieo s)teur(mpio1lptnmncia(f rtaum nt4aetn f3iatla2ulumo;u)tetnxr ia1lmte uvs t) rxm(m io4alt mfvtl( a2uaurp;o4tpe ioeildfaDea(mp t4 exrxocio1fmD au ol()s2xrim3oo1lmee fetasfa2ra(roou0tlx  ocils s2el( o (4tltrir oatop rauvo (0t2urxrpoy1ope mfvt (f rra(mpnu0tpxomf3ilt aDrmuvs (0tetrxf iy1lpteluvo t0 2xrim iu4al n ncsat a2umx p;u4tle ii3tltls2rl(msnu4 eeoxrcio1fpDraivs s texmxm oodapenmnvs sfs2rr(rpnt1aexo o3iadfs rl(vp;u4 lxrio3iodfp rlivi;s) 2umxr3ny4ome mfviasf rumum ou1alxnmocilt aDumnmp t0aexrmf ty1om rauvils  etrimpiy4om emieslt) Dta( ooo0tpeoifcildls2ra(msn(4artoio oadomD lieilt0t2umxo iy4optnlncsasfaDrrxr oo0texomieildfa2rluvp;t)aexrircto1om eai olt0s2urim oodlpenmfvsasfa2ua(mpnt0opxnifciydla2ea(vs t0aetomr3iytlptranvolt teur(mpno4ll nmfvsa(fa2um(m nt0texn i3tldfaDrm(vsn(0aetnxfciytfa eau o (0s2toir3iydlltelfetl() Dtrxm ou4olenif3iydls2um(vp u0artnxocoy1fm raueo s sexr(rpiy1ome  iet ()s2rmu pno1teeoif3tltfs2ea( s u4texrmr totfateauvi;s0t2uoxo3no1lltnmfctat aDtrxronu0alxniicild sDum(mo u)trxrmo3oo1la e neo t0trtriopiydapt mnctltf rta( oou4tleomo3ilsfa el(mpn(4aexoir tytomDeauvols  rtmxmpny4ll e ici s arraum ot0tee mieiat aDrlnvpn(4aetoxr3tatoaDe i s;(0tetmxr nu4lle mfeiatfaDraxr oo0apt mf3tatlaDrm( s;t0aexoxocoatfmtrliei ( texm(mpno1omtnlfvsat  Dtmxm ;o1tlenmfetltfm2ea(vp (0alenio todomDeluesl(0t2tr(m ny1lpt  ictlt) Dumuroot4olenmo3iysls2el( s u)altoif tytlmt aivi;( seum(m oo1lp  lfetat)s2rmu  ;u0tlx mfeilt a2ra(vo ()trxnif oodlmDeln ol() 2tm(r iodol  mfvs (faDuaurp;u1opx ifcils m ea(vsnt) ltnmf3oadomt ln o t) 2xm(m3iu4ll elfvsas)sDuax ono1oet iociytls em(mo;u)aleoxo3oy1faDe i i s0 rum(r no1aptn ivsatfs2uaxront1oleo ieils a ua(vonu)teerxr oydfmtr n s (0 rto(r3ou4lm emnvtat a2ta(moou4tlenmo3tlsfsDemu snt)alerif tadlat aies ()teuo(r3oudamt licilt)srumx o;o0aex if3ilsfm rlumon(0artrxrcoo1fp eli i;s  etoxmpoy4ap n fvta()aDuau  ;t0olxomfeiad sDrmumon(4 etnmo3oadoaDrlu o;(0trxmxr iu4lptemnei t)s2tmxr ou0tpeoioeilt a2elnvsn()trtomf3ia1late ieolt0teuo(rpou1ol n fvtat  rrm(mpot1oltn i3tatlmDul(mpnt) rxrif oatfp elieil(0texoxopnydlm nmfesls aDra(  ot1tpxn fciyt s2rauvs u4 exnxfcty1oaDelnvsls)s2trxmpiydlm emnvsatf 2rrxmoot4tet ioeiyslmDel(vo t0aeeomfcta1fpteln ilt) eurio3ny1alte feils sDtrxro;t4tlt  icildls umn p;(0altnirctadlateanvs;(0srumxm3io1olte ictat  2ua(r oo1olt  ociltlsDrluvp;t)aexoxf3iodoptraies (0seumxo no4lltn fetlt  2trxro;t1olenmfciltfsDrmu o (4 eenxf io1lat auesls)sexoio oydomeemnet t) rta( ont4oee mo3ilt a2ean pn() exnir3oadom elneilt0sexo(r3no4op  mfctat srtax  nu1apto fcilslsDra(mo;(4 rxnxf oa1fa elueol(  2urxr nydlm eliei s)sDtr(r ;o1tpx  iciys m2ulu pnu4tltoxocoa1lmD au o t0t2xmir no4ole livt sf Dtmumpou1aeen iciasfa2rm(vp () etomr ty1lmt  i ilt)texo(r nudolen fvt tfa2tmxroot1aleo i3taslm elumonu)aetnir3oy1fp e i i s s2uoio3nudamt mivta() rtrxr no0teeoioeiatfsDranvo;t4 exrmrciytlatean s (0 exr(r3io1opeemncil( aDrmxroot1aeto oeiltfm eanmp t4altoio3ta1fa r ueols)tetr(o3ou1lle lnesas) 2trxmont1teto fctldlsDrm(vs t)tetoio oodoaDrlivo;(  rtrxrpnudom elics s  rrru pot0oexnmoctlsfs umuvp;t4 rtrifcio1opD li o t)srxrir iudlp  mivtas)aDtax  ou4aeeniieiys s emnvpnu4 rxrir tydfatrlivilt0trumimpiy4llenliesl( aDrruro;u0oet iieiys a2uanmp (4tltnxo oodfp r ivi;s)s2uoxmpoo1open ivsat aruru pou4tee mieiytlm rlu sn(4tlxomo oadfm e i i ()srxrir no1lp n nvtl(  2taxmono4oeeomiciatfaDemu p t4texnxoctytfatrlueil( seur(opnu1opee ivsatfs2tr( p;t4tet  oeias m ean p;(0artomo3tytoa  anvols0s2xrxmpoo4apte fcil(f Drrx  no1tpeo feiydlm2eanmont0 rxnir ia1oaDraivs (  2urimpnu1lpeemncs s)sDra( p;t0opt  i3iydfm umu s;u0treoio3ootlmD li o s s2uoxo3oy4op emieta(  rumur oo4tpeomfetatfa ra(ms;u0tlxrmr iy1faDr ueols0t2xr(opno1aptn nctas)aDua(  ;o0oet  fciysfs2raumo (4aexnxf3iatfmt an o s setrxmpio1ll nlfcilsf Dua(mpot4opxnmfetltfa rm(von(4 rerif3iatfmDrai i (  exoio iodlp e neilt) Dumu o;u0aleomoetysfa2em(ms () rxomr3oa1oa r uvil(0 2uoio3iydaptemnvtl(f Dtmxm ot1opt mo3iatlm eau p;t0trtnio tytom  aieolt) 2xmxo ny1lm elfciat  rrr(r ou4tpxomf3iysfa2rmnvo;u)aeerio ty1opD lnvi ( srtoxo3oodlpee nesasfaDuaum oo1alt ii3tatfmDeau p u4teenmf3iadom  lnes;( s2umxmpou4openmict (  2tau  ;u1ale moeiasla2um( p;u0 rxnxrcia1fm e n o s) etrirpiy1amt lncilsfarrmxr oo1oex iieilslm2rlnvo u)alenir tadlmt liesls texrxrpiu1lptnmictasfs2umumo;u0alenifeiytfs2ulu s;u)texomfcta1faDr iei s)teuoim3oudlle lneslsfa2ua(r ou4tpxn fciatls2eau o;t) rxnmrciytla rli slt) 2urirpoodlmtemfct s  rtrur ;t0opeomfeildfm rln o u4artoxocoadlmt an i t0s2xmxr3ny1omtemneilt)aDtmump;t4apeomfcildfsDulumo;t) exoxo3oadoaDrau i t s2xoio oy4omtnlfci s srraumont4optoii3tltlm2uluvpnt4trtrxo3ia1lp  an i;t)texm(mpiu1alt lfvtlsf 2rm(mpoo0oeeomocilt a2uanvpn()tetrircty1la  luei;t  eumxm ny1lpt lfetltfartmu pnu4apt ifeilt mDrl(ms t) rxnxr3tytop rliei s texo(o iudale mivtatfsDum(moot0apxo o3tytfm ea(vpnt0arxomo iytlate neo;( sexriopnu1aleemieilsfaDurxr ;u1opeoioeias sDelnms;u) rxrxf3todlateau o;s)texmxrpou1omtemnviat a2urx o;t4tptn i3ilsfsDum(mp u0trtnir oydfate ues t0s2tmimpoo1apt lnetasfsDrmxronu4aleoiociyslaDraumonu4trerxocio1om raivo s0 rtrimpiodamte iciltfs2ur(m no4optoifeils m emumpnt4arermf oatomt an slt)truoxo3iydlmeemivtat  Dtrurp;u0tex  o3iadfs ul(vp;t)texoir3tytlateaneo;t sruoio3ny1ome  nesl() rrr(mooo1apx mfeiysla2ul( onu)altrxocoatlmtrln s;t0 2xmio3nydap nmfvs t)aDua(mo;t1oexn ieiytlm2elu p;u0artoxrciy1op eln ols) rumxmpio1lpenmicsasf rtm(r ;u4aeenmo3iys sDeluvp t0artoxo3oytom eauesls)s2trio3io4am nmnviat a2ur(ro;u0aptn octatfaDemumsnt0alerir todoaDraieo;s)trxoxrpnudlleelfcsas) 2rmx ont1tpenmi3tlslm uln p (0 ltrmo3oytlpDr neils)seuo(rpiy1aptnmfvs sfsDuru  nu1oeenmociydfa2ul( o;u0tleomocia1lp r ivi s0 exrxr nodoptnlneia() rum(mpno4opxoio3ildfmDrlu o;t)tltrio oodfatranvo;s)tetoxmpnydamtnlnvt (fsrumu pno1tpeomi3iytfa ua(mp;t)aexoxo iodop   ivo t) 2tmxopiy1lmtnmnviasf Dra(moou4teto f3ilsfm uauvs;u4 rxomf3io1fp elivi (0tetrir3iu1lm  lfvslt)srua(  no1alenmieiadls uan p;(4 lenxocoy1faD lues s s2tr(o iy4omt  ncilt)srumxmo;o4altoifeiytlsDemnmp;u4aexrxf oytlmD  ueo;t sruoxopno1amt mfvtltfarrmu p;t1aex if3iatfs2emuvp;t4 leomf oydlm ean i;t)s2tr(m3no1alen fctas)srtaump;o1apt ifciydlm uau pn(4 lenmo oadopDe ieslt0 rurxr nudlp nmnvil()artmx pnu4tpxnif3iatfaDrau o;t4aexrircoo1lptr neo;s sexoxr3iu4ll n ictl(fa2rm(r nu0olx mf3tas a2uln snt) exrir3ia1oateaivslt)sruoir ny4am   fvsas s2rm(rpou4olx  oetadfaDrauvsnt4 exnmr3oadfaD livilt) etoimpiydalee feilsf 2uru poo4teen f3iat a2elump () lxnxfcoadlm  aneo;(0tetr(opnu1olenmfet t a2tmu  no0tex if3iysfsDuaumpn(0 lxrmr oodfmteanesl() ruoir oy4lmtn fct sfsrra( pnt1opxnmf3iyd s uanms;u4 etoxf oo1fpD ln i;t)tetr(m3ny4amen ivtltfsDtaxr ou0opxoioctldla eau p () rtoifciydopt livo;t trtr(mpno4om  mfvtat)artruronu1ope mfctls s2emu pn(4tlenmf iy1fp rlnvi;s0tetmir nydoltnlieta(fsDuaumpno1apxnmo3iytfm rmuvp u)arerir tydlp r n o t s2uo(m3oo1apt mfvsa(f 2tm(moou0apeomo3iys aDrlnvp;()trxnmrcio1fp  auvs s0 2urxo3iu4om  liei ( srur(ro;u0oex ioeiydfs em(mp;t4 etrifcoy1fp r uvs;t0 ruo(rpoo4ap elnetltf rrm( ont4aet mf3tltfm2el( p;u4arxrmfctadlpDe uvol(0 rtoirpiodlmenmncta(fsrtr(  ou1alx mociad s rlnvsn(0texrxo oydlm   u o;t)t2umxmpiu4oltn icsl(f 2ur( pou4opxnmoeiydfs2umump (4alxrif3iodop r i sls) etrxo3nydlpen fvtlt srumum oo0opxnmfeiad s2um( snt) eerxf3oytom eliei;s)setoio oodap   nct s) 2ta(ro;u0tltnif3tysfm2emu p;t4altnxo iotoa elnes;t) ruriopoy4am nlneil(fsDrr(rpnu1olxnioctasfa2eanmpnu4 lxrxfciy1fmDr nvsl()t2xrim3no1lltn nesa( a2rmurp;u1oleomfctas m emuvont) rtrxr todfatr ivi (0 rurxopno1altelnci s) Dtrx  nt1apxn i3ilt mDumuvp;u)alxnifcoo1omt auvsl() rtrxo3oudamt mfet s)aDtrxr no4oeeoiociytfaDrmnmsn(4 etoxfcto1oa r i ols truoir3ny1om elfetas arra( onu0tetn fciytfa2ranmo;u0altoio io1fa rln sl()trtm(opnudap emiesatf 2taxrpnu1tpxnii3iyd a2eanvs;u4teenxr iodopt aies s)s2toxo iu1omtnmivs s)s2rax pot1apxo ocias m ul(mpn(0trenmf3ia1lpt  uvol()s2tmxm3no4olen iesat  rtru o;t1aee if3iydlaDem(mont)tlenxf oodlm r nvi s  2tmirpno1apee fcta()arrm(rpno0aexnmf3tlt s2ulumo;u0aeenmr oy1optrlueol( t2trxrpou4op nlnesls aDtm(  oo4aee ifctlslm ean o;t)tltoircoy1fatraneilt)tetoxmpio1lpt mnviasf Dtru  nu0alt ioctytfm ul(vp;t0 leoir oydom elueilt trtmxopiudopenmfcsa( srta(m ;t4tetniiciydlm2rl( pnt0treoxrcoydfm elieslt)srtoxr ny1optn ivia(faDtaumpnt0opt  f3iltfs um(vp u)texoxf to1la rlu ol(  rtmxopnydamte nvtasf rtr( p;u1ole  feilt s umu p;t0 eeoxrcoydlp r nes;s)seto(o oy4lpen fvi s) 2tm( pot0ale  f3iat aDumnms;t4 reoxr oodfmtraivo s trtm(r nydamt  nvtatfsDumur ;o4tee  iciyt s2uluvo ()altrir3iadfp   nei ()sexoimpoudop   fvt s arumxmp;u0altn fciytlm eanmsn()trtrif ootlat  n s ( sruo(r oy4op emnvs t srrr(m ;u0apeoifciytlmDua(mp;(4altnxocootoptranei s)texm(r oy4ll e ietltfaDrm(rpou1tex iicias s2umumo u0 rtrxo3oodopDr ivo s srtoiopiydolt lics t) rtrum no0tlt mfetlsfa2umumo ()aeenxf oodfatrluvi s  2tmimpoydolen net t) Draumpno1apt ioeildla2rmnvo;t4tetrif3ta1lp e neo s) 2to(o3oo1om emnvslsfartaumoou4apx ioetldfmDrl(ms;u4tleoxfciodla  lu ol(0 eurxmpno1lpenlfvsl(f 2raxr ;u0tlxnmfeiadfa2ua( pnt)alxnxo3iatfpDr uei s0 2xoxopnodomenmfei t aDra(ro;o0alto f3iys a2umu s;u0texnmoctodoa r nesl(  rto(m3oy1al nmnciltfaDua(  no4opx moetad a umnmo t4 rxnxr3ootlat auvols0sexrxr3iudlleelicil( srrau pnt0teto ocils s2rl(ms u0tltoircia1oaDrln o t) rtmxo3oo4lmtnmivs tf Dtaurpnt1tetomictasfsDeln onu) exoifcoa1fpteluei t0 2toimpny1lpenmict t) Dtr(m nu0apeoii3iad a2ulumpnu0 etoiocoydfpteluvo (0trtrir3oy4am emfctls  ruaur nt1tptomf3tldlm uluvsn() eenmrctatomDelieils)trxo(o3iy1ol e fcsat)sDrru o;o1oeeoifctytlmDumnmo t4trtrir ty1lmDelnvi;t  etmxo oodamtnmicilt) ruau ooo1tltnioeilt m2ua( ont)arxomfctadomt  neo t seumirpoo4amt lfei s)artmxmpoo1alxn fetlsfm2rlnvs t0 eenmo3io1lp e ivi (0t2uo(o iu1ome miesltfarrr( poo1tlx moctlsls2ulnmonu0 rxrir tatlat anvils trxrimpio4ap nlnvi s)srtm(mp;o4altnmictydls2el(vp (4tetrxrciy1lp ean i t)sexrxo oo1omtnlfeil(fa2um(  ;t0tleomo3iyd sDulnvpnu0 etoxociodoa ran o t)t2tmxr oo4olee nei ( arrax onu4opx ioctad m ulnms;()altrmo oadlp rlues;s0s2xoim3no4ap emfvtat  Drm(mo;o4texnifctydfs rl(vo (0 exnxrciy1omD anes t trur(r nudopeemietat)arrr(rpot0aeenioctyt m2ra(mo;u4aetrxr tytomt  u sl()t2tr(mpiudlpe  nesls) 2rrum ;t0altomictad sDemn o t)alenxociadop   ies t) euoxrpoo4ol nmfvtat)a2um(m oo4oexomoctys m em(mpn()treoircoydfaDe ieolt)srurxm3nodllenlfcslt s2ra( ont4tpt mf3tytlmDuan o t4 rtoio3iy1lpt aueo;t)t2um(mpnu4ol  mfes t) rrru  oo0oee moetat m ea(vo;t) rxnifciatoa eaiesl(0seumxmpiydaptn fes tfsDurxmpnu4aptnmfciysfmDrluvsnu0tetrxr3io1fm   ieo;t)srtrio iu1ll  lfetat srtru  oo4aee ifetaslaDranmsnt0alxnxfcta1lpte n sls)sexm(rpnu1ll n nviat)sDtmx ono4ole miciadfmDum( onu4texnmf tydomD  ivo t0s2urxo3oo1ll  mnvsl(fsrta(m ;u4tlenio3iydfs2ul(vp;(0 etnxfctytfpDraivo s0 rtriopiodlleelfetlt s2tmxr nt0oeto f3iys mDuan s t0trenir3oa1oatrlneils) etoio ou4al emfvtlt a2tax poo0oetomietadfs ua(vpnt4altnircoytoa  anvi ()srtm(o3ou4ap  liviat s2umx pot1texoio3ilsfm2um(mpnu0 rxrifciydoatelnes;t trtoxr nudlmen fet tfaDtmxmpou4alx  oeiltfa eanmo t)artnxr3oa1optranvi;s  rtmxr3no1ale mivtls)sDtm(rpnt1tpx moetytlmDul(mp;u4tleomf ty1fmD ai s;s0s2ur(m iy4ole lieia()s2tr(ront0tlx moeiltfs2emnmo t4trxnmr tydomtelies t0 2uoir oo1lpeemfciasfsruaxm ou0ope iieildfaDrmnmp;t0teenxr3tatlatrlneilt teuoxo3nudop   ietltfaDua(moot4olen fctysfmDrlnvp t) lxrmr3totop   ivolt)s2uoiopio4omte ivi sf rtru o;u0olt if3iad a rmu p (4 lxoxf3to1fp r ueol(  rxmxm ny4al emnvils arrmur oo1olxomiciadlsDrm(ms;(0 leriocoatom  lnei s)t2ur(o iu1opt  ics t aDuaur ot1aetnmieiltfs rlnmo;t)tleomr3iatfaDeln i () rto(mpno4ll nmicsltfa2tmump;o1alt  oeiyt mDuanvonu4arerircoodlm eln s;t srtoim nu1amtemivs t)s2taum no1tltnmi3tat sDemnmp;u) ltomf3todfatrluvo;s  2tm(r iodaltnmfctls) rtaxmo;o0oexn feiadlmDuln o;(0arxoir totfp eli s;s  etoxm no1lpt lneil()a2umxr ;t0aeenif3tlsfsDelump;t)aexrxrciotomte nvil(0 etr(opnydaptemfetl()a2rr(mo;o4aptoifeiyd a2em(vsnt4teenxrciy1lp r nes ()srxm(o3oo1ol  mnes t  rrrxronu4tptn ieils m ua( s;u0 lxnir oy1la rai ols0teum(m no1lleemnesas) 2urxrpot4oeenio3iysfs ean s;() lerxf ootomtr nes;t0s2xrxo3oo1olee fet s a2rm(  ;u4apxn f3iydfa2ulnvpnt)aetnxfctodfmDe i i t t2uo(opnudll nmfvi s) rrrxronu1aptomf3ias sDrm( snu4tlxoxr3oodom eaneilt)srxoxm3iu4lme  icia( s2taxmp;t0tpto f3ilslm2ranmp;t)treomf3ootoaDeluvi t0sruo(r nudop nmfcil() Dta( oot1aptnmfeiys m2um(ms;(0arxniocoo1lp eln o (0 etr(m3oo4lpe  netlt aDuaum ;u0oexnioetatlsDum(vp (4 lerio3iy1oa  au o;s) exrirpiy1am e nctltfa2tm(  nu1tetoioctadlm2rmnvs;t4alxrxf oydfaD lnvo;t  rtrxm no1ope  ivsls s2um(ro;t0tlto iciydfm2ulump u)trxnxfctodoaDraivs;s0 rtoxm3nu1altnmnet s srumxr ot0oleo oeiltfsDelnmpnt4arenmr oadfmt luvols0teurxm3oydaltnlfctas  Dtr(  nt4oltniieiydfsDrlnms;t)artoircty1lp ranvi () 2xm(m nudol n fcil( s2rr( pot1alx mfctltfs2el(vpnu0 rtnio oy1fm r nei;(0 rumirpno1omte nvi t  rtr(mpou0apenioeias aDrmnvs t4alxnmf3iytfm elieo t)s2trxm3iodop n fvil(f rtrxmp;u0aeeoifetatlm ulnmpn(4alxomoctodlateluvsl(0trumxmpnu4lleemnei ()sDtmumont0tlx iociys s emn p;(0 etrxrcoatomDeaueil() 2xr(opou1apee icsl( s2uaxm oo1aeto f3iysls2uauvpnu) ltnio3iytlmDrluvil(0trtoimpiy1lmtnlies tfsDumxr nu0oexo oeiaslm2rm( on() rerif3oatlmt aneo;() 2to(rpiydll  lnet ( arraxm nu4oltomo3tyslm rl( p;(0texoifcio1oat auvo;s0t2xrxo ny4al e net ()a2rau ont4texn feilsfaDea(mo t)tetrmo to1oatelnei (  rtrxr nudol emnetlt a2rmu oou0opeo feils a emu o;u)aeeoir3oy1om r n i;( trurxo3iydap emncs sf 2taum ou1tptomf3iadfs2uau pn()teenxf iotopDe uei;s  2uoxrpnudam e ivi (f Drm(mpot4opt if3iys sDraums u4tltnio ia1lmDrlneo;s t2tm(m iodlpenmfcslt a2rrxr ;o4aeenmi3iydls ranvp;(4 exrmrciodfaD  uei t)s2xm(o oy4ol n fvtat s2tmu o;o4oexo fetyt a ranmo u)artrxf3iatlaD  ivo;t0 2ur(r oodale mfctl(fa2raxmpou0ope mfeiyslaDum(ms t4teeoio3tydfa elu o;t) exoio3oudope licils  rtm(  ;t0aptnmf3tad a ranms;t4 ltnxr oodoaDeaivo;s  rum(m oy4lmenlfcsatfaDtmxro;t1tlenmf3tltfa2rauvont0alermo to1latrlivs;t srtoxr ny4ale mnvi s artr(rp;t0tpen ocildla2uaump (4areriocia1fpDr u ilt)t2xoiopoo4omenlfctasfaDrm(roou0tpt  i3iytfaDelums;(0alermo ia1omDraiei s0 exr(o nudam   ici (fsDtru  ot0tee io3tat s rluvo;t4trtnmo to1fat  iei s)trumxopiu4om   iesl(fsDtmu p;t1oltoiieiyd sDuanvs;u4 eermo3iadfa  auvs s0sexr(o3ny4aleelfvta(  rrm( oou1apenioetydfmDrl(vonu0treoio3oa1fate iei;( trxr(o3ny1lm e neta()srumxro;t0tltoifctys a uan sn()arxoxr3oatfpte ies t setm(m3io4ap  micsat)a2trxmpnt1opto octld a el(mo;u0texoxfctadlp rlu ils srxr(r3io4lpt mfesa()aDrru oot0olxoifctldla ua( p u0tlxrxr3iy1lptrlivi;t)s2xr(o3iu4alt  fctasfsDur(r ;t4altn f3iatlaDeau onu0 exoir3to1oa eai s s0 rum(r ny4ameelfctls) Dtaxrpnu0aeeniieiyt s rlums;t)alermo3ty1op   n sls0 rto(r oo1lmee fesatfsrta(mont1tpxn oeiys aDulnvs t4 eenmr oo1late n o t)trxmim nodlpt lfetas aDurx  ;t1olen oeiytlmDem(vp u0 ltrxo3tadopDe ivslt s2umiopoy1ol e feta()srua(ront0oetnmocils a um(vo;u) ltoxo io1fat aiei;( s2uo(opny1altnlivt ()a2umxrp;t4tex mfctltlm ul( pnt0arenircoytlaDrai s t t2tmxr oydap  lies s aDrmx ono4tex ioctlslaDul( on()artnxr3oodlp e n s s  rtm(opiudllenmfesl(faDtrumpnu1oltnifciyt s ea(ms t)tlenmo oydlat  ieol(0srumiopnydllt livt sfaDur( ono4optomociysla el(monu)alxrirctodoaDr nvs (0 exmxr3io1olte ncs s aDtrxmpot0tlen ocilslaDem(mp () exrxocto1lateln i;( trtm(mpoydameemfcilsfs2rmxr ;t4aexomiciyt a2ulu pnt) rtrmf iatoatr i s;s)tetoxopny1amtn fetasfs2taur ;u0aetoifeiadlsDranvs (0 rtrxo iodfaD ai o;s)setrirpoy4omtn feia()artmxmoot4alen fciasfsDel(mpnt0 ltrio3tatfaD li i;s) rxmxo3iudapeelfcsasfarurum ;o4tetoii3iytlmDulu s;(4teeomr ta1omteli il(0t2xm(rpno4aptelnei (farurx  ;t4apxoioctytfm rl( o;(0alxnmf3iytfp elivs;s) 2umxm no4apen fet sfsrtrxmpnt0tptomoetlsfs2ul( o;u4 lxoxf oodlp eau s (  rtmxr3no4ap n net (f Dtrxm nu0aeeo iciyt m eaumo t) rxomf oodfp r i o;(0 rxm(mpnu4optn ici tf rrru ono1opx io3tadla um( on()aeenmrcootfa   uei s)t2trir3oo1opee fcta(faDumu pnu0opt mo3ils a2ra( snu4 rermrciytfaDeaueo;()srxm(r3nudomee nvt t)sDrr(rpnt1oeeomfeiys a2umu ont) renmfciytfpte uei ( s2uo(rpoo1lp elfvs sfaDurx pno1oex  o3iad m2umn s;t) leomf3iotop   uei;t)trxmxm iy1amen ieiat s2um(m no0olxomfeiad sDuauvs (4aexrifcoydfptraues s sexr(opoudame mfcsa(fsrum(  ;o0tpx miciysls ranms u0 eenxr tatlp  ln s;(  rtm(r3oydamenlnes t  Dur( oot4aeen o3iyd mDulu pn()tltrmo3ootfptelieo t srtrxr3oo4lp e nviltfarrr(mono4apeomf3tyd a emu p (4altoioctadlat ai s;s sexrxr3ny4lp e fetas  Drmx  nt0tlxomfeiatfsDra(vpnt4tleomo3tatfa e i o;(0s2xmir3ou4apeemnctl(f rtmu  oo1aeeomf3iadla2eau o;t0trenmo iotfmD  uvils) rxmxm3nu4altnmivias a2rrurpnu0tpxnioetatla2rl( p;u) lxoif3iy1lpDeli o s0trtrxrpiudlm nlivt sfsDtm(r no1oexo oeilsls emu on(4teenmr3oydfpte ieo (0seuoim3io4am e ivslt a2ta( pnt4tetomf3iadlmDumn sn(0tlenxociy1fatrauvi;t0sexr(mpoo1lltelnesl( sDum(m ot4tlxoiieildla emuvs;t)trxoiociodfmDean o;t0 rxmim iodlptelneta(f 2rrump;t0tlx miciaslaDrl(monu) rxrmrctytlate ueilt srxm(r iydop n iesl()s2urxmonu1tptoioeiydlm el(mp () eenmf iotla  lieols0s2ur(r ny4lp elnvs t arrrx  ;u1oexomiciysfa2eanmo;u4 rtrmo oodfpD livo t)teumxr3oudaltnlncia( a2tm(ro;u4oexn oetadlsDumump u0altrxo ta1omDraueol()texo(rpoodlleemfesls)sDrm(r oo1alxo octlt aDuan snt4 lxoxr iotfa  auei;s t2toim3io4lpeemncia(f Dum(ro;u4tltnifciaslaDran s u0 lxoif3ia1lmD ln i;s0trxmxopou1ll nliciltfa2rm(  ;u0ope moeildfm uln on(0teerif3iydfp  lueolt srtmiopiodolenmies t sDur( ont0ape ii3ias a rluvp;t)tlerio oa1latrlnvo;()sexmiopio1lp nlicta( sDrau oot0ale ii3tatfm2um( pn(4aexoxo iydfpD  uvi;s0 rtmirpoy1lmtn feiasfaDtmxmont4apx  i3tld a2ra(vs ()texoif iodlaDraivs;() ruoimpoudlmt mivt ( s2rmumo;u4tpt mi3iyt mDulump (0 rxrifctadoa  luvo s)trurim3oo1ameelicsat)srur( ooo1olenmf3tatla2uanmo;u)tlenifcio1lm rlnei s) 2xm(m3iu4am   fei t sDuaur ou4alen o3tat m rmn s;t0tlxnxfciotlpDe u o;s)s2umxmpiydapenlncsat  Dtaxmpnt1olx ifeiys sDuauvp u4tleomfcoo1fm   u s (0trxriopno4amenlictl() 2ta(moot0oltnmiciyd mDrmnvo;()altnmo3tadfpt lnvi ( sexmim3oo4oltnmicia(fsrtmumpou0opeoiociat a ul(ms t)aexnio oa1laDeli s;t  rtmxopoydoltnmfet sfsrraxmp;t0optnifetyslm2rmumo;u)arenir iadlm rlies s)s2xr(rpiydom e fcia() Dtmxrp;u0olxomictydfs2rm( pn(4trxrmrcoadopDe neils)trtrio nydap n iet (  Dtmu p;u0oltomocild aDumn sn()trxoxocoytfat aies ()seto(mpnydoptemfct tf Dtmxmpnt1apxoiieiyslm2rauvsnt) reoxo3oa1oa eai slt0srxoir3io4lpe lieiatf rur(m ;t0alt ifeiadlm um(ms (0aetrmo3to1fmtraues t)tetmxm3iy4am nmncsat srtaur nt1ale ifcilt mDuaump;(4aeenmr3ia1lateluvs;(0srtm(m3nodomt  fct t)s2ta(rp;o0tpen o3tatfs uanmo;(0tleoxr io1oat lueo t0 rtmxm3ou1opt lnvsl() Dum(m ;o0tltoii3ilt a uauvo;(4arxrio3oa1lmt  ues t0 2tmir3iy1omte ivsat  2rmu  oo4tleomiciydfs rl(vp;u4 reoxfciytlpt  nes (  exo(r iodole mnvsatfaDua(r ou4alxomociad sDel(vo;u0texomf to1fmDelnvslt  euoir3iu1al elnvsat  2tm( oou0tpxnifcild mDeluvs u) lerxr3totoa e u sls  ruoxr3ou1lmenmfeia()arumu oou4oleo ociadfs2rlu snt)texoxo3oy1la   nvilt) rxmxm3iu1ape mfvsl(  2ta( oot0oeenmf3tytls2emu pnt)trenmf3oadopD anvs;t  eurim3nudome  iesas  2tr(rp;u1oetnii3ild s rmnvsnu4 lxrmr3totlpDrliesls0 2xmimpoudamtnlictls)srraxr ou0oet  i3tasfm2rlnmp;(4 rxnxoctodfpDelnvs t t2to(r iy1apenliei tfsrum( o;t0tltnii3tys sDem(mo;u0alerxo3oatomDr uvs s0trtoir ou1lptnmieias a2rmumpnt4alx  o3tyd a2umn p;t)aeenif3iytlm eluvo;t sexoim oy1al   ivi t) Drmu pot4tltnmo3taslmDra(vo u0 lxnmr io1fmDelnvol(0t2um(mpnydll  mfvslsfs2uau oot4tleomf3tyslaDeanvo u)alerio iodlpD li il( teurxrpio4omenlivi t)srur(r nt4aexn ieiatfs em(vp ()trtrio3iy1fmDraiei;()trum(m no4amenmiei s)arur(mpot1tex  iciat a2emuvo t4 rtrxo3iydoat au i;s)tetoxr3oudom  lfesl( s2rr(  nt0tet ioctytlm2rluvs t4trermr3todfmt  n s (0s2trirpiu1ome mneias sruau onu1tleomoctatla2uanvo;(0texrir3oa1opDrai ils t2xo(mpny1lle livia(  ruaxm oo0tpt  octad s ul(ms;u)treoxr3oydlpDrlues;s) 2tmim3ou4om emnctl(fs2tax ono1aetnmfctadlmDuluvo (0 exnmfcoa1omteaneols0srurxo ou4ameemfvsl()aDrrump;u1apenmociasfa2rauvsnu) leoxf oatopt aueils) rxm(o3io1lpt  nviatf ruax  ;u4oet io3ild s2ra( s u0tetrxr3tadlpt  uvo ( trurio3io4op  mfcsa(fa2urur oo1opx moctltlsDranms;(4aetnmr tadomDrlu o s trurirpiu4lmtnlneslsfaDurxmpot4ape mo3iltfmDrm(ms u)trtoio iy1lptrai il(0truoxrpiodlm   icias) 2rauro;o4tpe ifeiydfa uanmo () ltrmfctadom   ieil(0t2umiopoy4aptnlfvtat)sDumxmpou4tpeomfeiydlsDem(mp;t) lxoxrciydlat  ies t0trxmimpou4am  lfvtls  Dtaump;t1oee ifeildlsDrln s;t)aeenircty1fpD ln i s0 etrirpnydlm  lneslt aDrmxmpou1aex iictysfm2em(mp (0altnxo iytla r uei t)t2uoxrpoodopen feil() 2tm( p;t4teenmocias a2ulumpnu) lxnxo3iodlatr uvols t2uo(m iu4ope mfvs ()a2trxr nu1ole  ieiasla2uau snu4trxomf todfmtran i;s)trxoiopnu1op  mnet ( a2ururpno4optnmictasfaDeln sn(0 exrmr3ia1oa elnes () 2umir oo4open iesa()srtrx oou0opeoifeiydfm rmumsn()teenmr3oo1lpt  u ilt) 2uoir3oudopt licslt)arumurpnu0opt  f3iaslaDumnmpn()trerxf to1opDelivs;s0 2xr(r3iu4amtnlnvs sf rrrxmoou1aeenio3taslm2umumon(0tlxoxociadopt an o;(  ruo(rpoo1lmeemfcsas aDrmur ot1apeoio3iasfs em(vonu) etrxo tatopDeauvs s  2xmxr nodol nmiciat)aDta( pnu0tpeoiociatlaDumn snt0aexomf3to1laDr i slt) eto(o iudlleemnetls)a2tru poo4ole mfeiydlmDra(vsn(0altnifctydlpDrlnes;t0s2xoxm ny1ol n net (fs2raxmoot1oee  ociytls ran p;u)altnir tytfm ran s t)srtrir3no1al   iei s aDtm( pnu0olx  oeiyd aDul(vo (4alxomr iytlpDelueo s0s2to(o iy4aptnmfci t  rra(m nt0teenmociydlsDra(vont) rtrxf oydoptranvs t)trurim ou4llt  fetatfaDtaump;u4tee  ieiysfs2rmumpn(0aeerir3iotoaDeli ilt) 2xr(opoodlpe  nctls a2um(  ;u4tpxo ociyt s ul(von(4aexrifctydfm r u s;t)trumiopnydol n ieils) rumum ;o0aexoif3iytfs emnmon(0altriocoo1fpDr nvilt  2umio io1ope mnei t)a2urx pou1tlenmf3tasfa uau s;u4teeoxociytfm  lueol( srur(r ny1openlnvtat  rta(r ou0aetn i3ilsfs2umnvpn(0altoif3tytoaDrln sls0 2ur(m oo1amtnmnctatfsrrrx o;t4aptniociytls ean p;u0aexoxfcoy1omD  nei t) rtr(m3nu4al e ivs sfa2trx onu0apx  ieiatla2rm(vs u)tetoxf3iydom   i o;s0texrimpnydole licilt s2tmumo;o1tptomieiatfs rm( o u0tlxnmociotfmD aues;( t2urirpiodlmee fesas) 2urump;o0oeenmi3iydla2umu onu4tlxrmrcoy1fmtrlu s s0 2uo(r3ou1apee icsltf Dtmxr oo1tlen oeiatlm eanvsnu)teenxo todlpteanvo t trum(r3oudale mnviat)arta( pot1optn f3iytlm2eau p;()trenxo3iadlm r ueils s2xmxr iydam   iesl( aDra(rp;o1olx  fciadla ul(vsn(4trtoioctodlpDrlieslt  eurir ny4ame mfetlsf rurum no1opxo octytfs ranmon(0 exnmo iytlm eau slt  ruoir3oo1ale mnvsl(  rraxm ;o1teeo feiydfs2ra(vs u0aetnmr3oo1omDeaieo s0teumxrpiudame lfvta( a2ur(r no4olx  i3tydlm2um(vo t0alxrir3totfaDr uvs;t) 2tr(r3no4lme  nesa(farrrum ;t4tlx  ictls aDean pnu4 rtrxo3oydfa   uei;(  rum(o oydaptelicsa() rtru  ot0tpxn ieiltfs2ul(vs u)arxrmfciydopDelu o ( s2xmxo3oo1ll n ies sf ruax pnt0tlxnmf3ilslaDuan pn(0aeenir ty1oa e uvil(  rumiopno4amen nvias) rrm(  nu0olxnifctat m rlnmp;()trtomr tydlaDe nvslt)s2tm(m3iydopte ictas aDtr(mpoo1tltoiocildfa emnvonu0 lenxr oadomtrlieolt0t2xoxopiodop n nvi t)aDta(  ot0tptniiciydfm2umn o;() etrxfcoydlpDranei;s trurxrpoodlmen neslt srur(  nu4tltn oeiat m emuvs t4 etrmo tadlpDrau i;(  2tmim3oudll   ivilt) rra(m no0teto o3tatfaDuau o;u) renif3tadfmt anei s0srtrxr3no4open ivsat)aDuax p;u0aleoifeilsla eluvpnt)treoxr ty1omte ueol( truoxopio1am elfvtat aDumxrpoo4oexoii3iytlaDranvsnt0aleomfcoatlptr u o;( sruoxrpiydaltemietat)aDur( pou1tptn iciysls rmnmo t4texrir iydlpDe uvi t0 rum(r3ou4op nmncta() rtmxro;u0tex  ictadlm ranvo u4 exnxrctytfat  ueo t t2umim oy1optnlncils sDumx poo4tltn octasfa2rln o u0tlxnmr3iy1faDeau ils0srumxr oy4lmtemnetas)s2trumo;u0tlenmieiat m2rlumo;u0aleoxf3iydoaDrauvo;( t2umxr3iu4omtnmfvtatfarrrxroot0ale iietytfa rluvp;t0 eeoxf3ty1lp e nei s)trtmxm iu4lp  liet (  rua(  ot4teeniieiydlm2um(vonu)tltoxr oy1fm rln i (  2xrir3oudam   ies t)s2rrxm ;t4tptnmiciltlmDeanvo t0texrxfcoytop   ivs;s)s2xmxm nydapt mietasfa2tru ono0tleoifeildlm2rl(ms (4aetnmf ia1lmtraieils) rto(opiudllte feia(f 2ta( ono1tetomi3tlt m emuvs u)aeenxo oytomte i i s) etoxr oy4lp elies t) rua(r nu1apx iietyd sDrlumsnt4artoirciadlpD luvs;(  exo(m iydamtnlfeil()artax oou1apenmo3tydfa emn pn(4 reomr3oodoaDrluvo;s)sruoir iodlptn netltfarrrumpou0opeoiociyslaDumums;u4 lxrmoctotla  ln i ()tetr(opiydlmee fvsat)aDtrxmont4apeomietaslmDrluvon()arxrmrctodlmDranei t) etoxopiy1lmen ivsl(  Dua( o;u4apx ii3iydlsDrmu p;() rxnxf iydfm ean s;s  rtrio iydomtn ivtl()a2raur no0tpt mfetydla ulnvont0aleoxr3tytlpDe ivol(0 etmir3oo1amtn nesatfs2tm( oot1ope mi3tls m ul(vs t)trxnmrciatfp   iei;t0trtmiopnu4ap  lies t arta( p;u1tpto ocilslmDemums;()trtnmf3oo1fa elnvilt0trtrxopiydopt livt sfsruauronu4aetoii3iat mDul( s;(4tlxoir3iadom ranes (  exmxm3iu1omeelfvtls)aruauronu0oeen f3iasfa2ea(mp;(0teeoxrctodfp   u o;s0teur(m3oy4altnlncs s aDtm(  nt1tptn fetatfaDelnvs t0alenio ootlp  li i;s  eur(r oo4lp  lneiltfa2tm(mpnt0tleomf3iatls el(vpnu0trxnxf3oatlm   uvslt) exmxopoodapt mictat) rtau  ou1alxoii3iytfs2uaumsnt4 renif3iodfa  lies;t  eumim oydlm e iesls)aDtmx pnt0aexnifcilsls eaump t0 rerxo oadoaDrlu i s0texmxmpiydlpeemicsasfartr( o;o0tlenmo3iytlm raumo;u4 etoir oadlaDelneilt0 rxoxr iodop elfvt tfsDtmx pnu1aleomo3tlt sDrl( p;() renif oa1lat auvs;()t2uoxm3ny4llt lfet tfsrtrur ot4tpxnmf3iydlm ean o;()tleomrcoy1fptraieo t0seurio nu4lp emfctas a2rmxmo;t0alt iieilslsDel(msnt0alxoir3iadlaDelnvil() rxrio3nu4lmeemies s)aDtaxr ;o1oeen iciltlmDrluvsn(0tleoxf ia1omtrlivslt)texrxo iodlmen ncsat  2rmx o;o0optoiietyt s emumon()altoir oy1oaDeluei;(0tetm(opoo1llt  fes () rraxro;u0tee  feiys s2rlnvpnt)tlermo3oatfm   nvs;()srtmxrpnu1optn fvt t) Durxr ;t1oexn feiyd m2ul(vs;(0 lxnmo io1op elu o;s)s2to(opio1am elfvsl()arurxrpno4tet  i3ils m ulnms;() lerxo iadlpDr nes;t0srxrxr3ou1ope  ies t)sDrrxm ou1tlxnmo3iys m uln o u4tlxnir3iy1fat li o t) 2um(opiy4om emivi sfaDumuronu0optn iciasla ea( p (0 lxomrcoa1fmt  ivol(0setmimpiy1lp n ivtat sDrau  nt0apt mi3iydfa ran p u) renxr todfatr nvs;s) exo(opiodlm nlnvsa(farum(mpou4tpxn o3ilt m2rmnmp t)texnxrciotop rai s t setrir3iy4ame  ictls) rtru  no0opxo o3iaslsDul(vsnu)arxrxfctydom rln ilt0 euo(o iy4apee nvilsf rur(rpou0oexomf3iysfs2ulnvpnu) exnmrctotlpte i i t0 etr(r3nu4omeemictas a2rmu  no1aetnio3tasla rl( o;u0 rtoxo3oytfpD livs;t  rxmxopou1op   ivslt sDraur ou0tleomo3iadfa rlnms (4 lxrxoctydlp  anvs t)srtrim3ny1op  livtasfa2rrx pnt0oltnmi3iyt s ua( snu4 lxnmfcoadfmt  uvolt) 2tmxm3iydoptemfeia(f 2rm(mpno1tpen fetytlmDra(mo t)texoir ootoaDrli i t) exo(r nu4ame licsas)artaur no1tltoioeiasfa rmn pnu4aleomr ta1opteluvslt0t2toio3iu4lpe liei ()aDur( o;o1apeniiciytlsDrmu onu) lenmo iotlatelnvils)trtoxo ou4lm e fcta( s2trx oot1olxniictytlmDelu o u4tetrxocia1laD  u i t)sexmio3oo4op  lict sf Duax ont1oetomf3tatls2rmnvp;t) leoxrcoydopt  uei;()trxoxrpno4lleemfcilt s2ua(mpnt4tee micilt s2ea(mo;t0altnxrciy1fatean olt) 2xm(rpoodop n net () 2tmur ou0apeo o3iytls2rlumo;t)tlxomfcoadfmtr ueols0teumxr3ny4aleemnvs (fs2ur(ronu1opxniieiltfm2emnvont4 lxoir oo1faD lieo;s0 ruo(o no4op n nctls  rumur ;o4aetomociasfs2ua( o;(4 rxrxo ta1fmtean o t0trurxm3nu1om  mnciltfa2tau pou1opxn feiad s ea(vs;u0 rtnir oy1fatr neolt0srxmxrpoodlme mnvsl( a2ua(rooo0opxn oetasfsDemu snt4 ltoir iodlp   ieil( s2umxmpno1ll elnvta()a2ur( o;o0oexo f3iydls2um( o;()texrif io1fm  aieil( t2xrxo oodlptemicilt)sDuau  ;u4opxn ictytfa elnms;u) lxrxo iotla e uvolt trxoio ou4om emiei ( aDtau ooo4aee mo3tytls umn s t0 ltnio oytfm eauvi s0t2umirpiudal emncs t) Dtrx  oo4oeto fctatfaDemnmp t)tlxrirciodopt auvo;(0sruoxo nu4llt  nvta(f 2ta( oot0aeenmf3ildlmDuluvs t0tetnir3ia1omtr n s () 2urxrpoo1openlnvtls) Drrx  nu4aexnmo3tadlm ulums;u)alxnxf oy1lmt  uvo ()setr(m ou1al elicta(f rurumono1tptomictlslmDraums;(4teenxo tydlpt au s ()srtmimpou1optn ivslt a2tmxmp;o0apxomicild s2eanmo;()alenxo todomtrauei () 2xrirpoo1om nlieiatfsrurumo;o1aleo f3ilslm uanvp t4artrmfctotfp  lnes t0s2toio no4amtemneils srrmumo;u0oetoif3iys aDelumsnu4tltriocoy1latrauvi;t0teumimpiu1llee fcil( a2urxmpou1tlto o3tatfaDrmuvsnt) reomocio1lpDrlu s;t)srxo(mpnu4lmen nct ()arurx p;t4texniocilsfs em( o;t)tltnxo3ta1op  aiei;s0 rtrim nu4lmtnmfcsa()srra(r ot4alt iiciasfsDelnmo (0 ltrxo tydfp rli i;s  exoxm oydlptnliesas srrmumpno1alxo o3tas s rmnvont) rxnxrcia1opt  i o () exoxm nydlp eliesl(f 2urxmp;t1tlxnmfeilsla uau p;t4 eerir3oydla eaivol( t2xoxo iy1ll  lneslsfarraurp;t1oet mietatlaDumnms;(4trtomf3oodfmt  ueo;(0setoim iy1oleemfetls) rrmur oo0tetn i3iad mDumnvon(4 eenmfciy1opDe ieo;t0s2xrio3nu1ome mnvsa(fa2rau ont1tlxnmi3ilsls umu sn() exrircio1lmtrliesl( setoxo3nudaltemfesltfa2uaxmp;t0oltnifetldlm2umnms;(0trtomo3oa1lpDelnesl()texoiopiudalt lnctat  Drax p;o1aleomfeiyslm ea(mp;()artnmfctodoa r n i;s0tetoir oudlm  mnct (f rrax  no1tle  ociasfs2ua( s;u)tlxrmr3iotlmDrln i;(0 2ur(o3iu1lpe  fcsltf 2um(mo;t1optoii3tltlaDelumont0teenircoo1lp  livi;s t2umxr3nodlp nmfcslsfsDtm(ro;t4olt  fctlt a ea(vs t)altnxoctatfptelies;(0 etoimpnydll e nvsl(fsDumuro;t0alx iociysfa2ea(vsn(0aeenxf tadfat ln slt0srtoxo3nudlmtemictlt)a2trx ono4alx ioeiysfaDrlnmonu)trtoxfcto1oa rlieil( teurio3iy1ap n nvs s) rum(mpnu1oet ioeiat m2rmuvs (0trenmo3oatlmte i s () eumir3io1olenmfvilsfarraxr ;t0texn ieilsfmDua(ms u) ltrmr oa1optrai i;s) rxmxr nu4am n iet tfsruaurp;o0altniociysla ean o u)tleoir3iy1fptrauvs (0s2xoiopiydopen ncsasf Dtr(r oo4olxnmoeias s ua(mpnu0 rxoir iodfpDean o;t0trxoir iu4ol   iesat aDtr(rpnu1optniietls sDumn p (4altrxrciatla r n i ( trtr(rpio1lltn ncil() Duaxrpnt4alx iociydfm2rmums;(0 lenxr3ootopt au s;s0 rxr(opiu1alee fcs sfarta(m nt1tleoiieias aDumums u4aexomociy1oatrluvi ( texoxr ou1oltemnesl()s2ua( onu1ale  o3iadfaDem(mo (0 lxomf tytop   nvo;t0s2xmiopno4omt mivils)a2urx pou4tpe ifeiad m em( o;t)teermrciy1lmDeaivil(  2xoio oo1ll  lnvtlsf Dumu  no4aetn ieiysls2emnvs ()areomfctodlatr ues s) euo(o3io1ll nlfct ()aDrrum no0aexnio3iatlmDrl(mo;u0alenif iodla rauvo t)seumxrpiu1om e net t)arraur nu0oetn i3iytlsDraums;t4 lxrio3oa1faDeanes (0s2urir nodoleeliesl(fs2rr( ooo4tlt ifctydlaDem(vs;t0tetomfcto1om  aivi;s) rxoxopnudom emict tfs2rrum oo1tptomoetls a2ran pnt0teermfcoytfmDelivi;(0t2xoxo3iodlm   iei t)sDurxmp;o4oex ioeiyt a2uauvpn()aeenmociatlpD  n ols sexoio oudop nmici t  2raur ou4tptn icildlm ea(ms t0aexrxr3ootfp  aiei;()truo(opnu1om emncta()sDrrxm ;u4alxnmo3iaslaDea(ms ()trerifcoatfpDe ueilt setmxm3nudome mfeiat a2uaxmonu1aexnioctyt m ul(mont) renio3iadlpDelues;t0trumxm3ou4alt  ies s) 2rrxrp;t1tlt io3ils sDrmn pn()tlxoircoadlpD li s t)truoxr3oo1om  mfvs s)sDtr( pnt4tpe if3tasls2em(ms t)arerxr todfm   ivilt0srxoio3nudameelnviltfarta(rpou4ope  ieiltla2ul( s (4 rxrircoa1om r nes s) exmir ny4apee ivs s)s2tmx o;u0tetnmfeiytfmDelu o t4tetomf3oo1fpt aues s) 2xrxopiudoltnmictas)arrrxr ;u1tlto o3tldlsDem(vsnu4altrifciotfp r u ols sruoxrpiu1lmt mnvta(fs2urumo;u4texomo3iltfmDeanmp t0arxrmo3iytlateaneolt) etoxm3no4llte nei s)arrm(rpot4teto o3tatls2ra(vsnt4altrxr3oo1laDraivs;(  ruoxopiodoleemictas)srrr(r ;t1tlt if3ildlsDuan p u4aexrmfcoo1lpt lneo;s) 2uoio oy4lpe mneiasf Drmx p;u0ope ii3iaslaDel(vo;u4areriociadla r nei t0 rxoirpnudol elnetat)s2uau p;t0apt  o3tytfs umnvo t4altomfciy1lp eaieolt0 etmxo3iodlpte fvi (farrm(mpnt0olenmo3iasfs elnvo;t0aeerifctytoa rlnes;s  rxr(o oydllenmfvia(fsrtr(rp;u4tltnii3tadfs2ranmo t0tltomo iatom r ivil() rtoxm oodol  livil(fsruaxrpno4teeomfctlsfaDemumsn()aexnxrcia1op  auvs;t0trurxopio4apt  fesls) rrmurpou1tlt mfciat sDrmnmsn(4 ltoif oatop r ues t0setmim3iodap  mfes tf rur(  nt1alt mociysfmDemumpnu0texnmo3iytoa rauei;()trxmio3iydalen fcsas)arrm(m ou0aeeomi3iydla2umuvo;(0aeenmr3ootlpD  u i t  2trxr no1olen ncta( aruaxronu0alt  feiyd m2ean ont0areomrciy1laDrauei t seum(o iy1openlfvslt)sruax pou4tlt  oeiad mDea(ms;u0alxomr3tadfaDeauvo ( s2xmxm no4ol emicil(fsrtmum nu0tlxnmoctadla rm(vo t0 rtnmrciotfmt  uesl(0 2xrxmpno4omtelfvil(fa2rmumont0tpxomfcild m2ua( p u4aetomr iytfmte nvs;s texoxo3nu1op e ies t)aDur(r nt4oexniiciltls umn p u) reomrciy1lpD  n ol()t2um(o3oo1lm   nvs t srtau pnu0tlt mieild a uln onu0artrircoodlpD aivo t)t2ur(o oy4ape  neta( s2ur(mp;t4tex mi3iysfaDrmuvo t) rxomfcio1fpDeau o;t0s2xmxo io4lpt  fvilsfs2trxro;u4oex ifetltfaDrluvpnt4 etnio tydom e uei s0 exmir3io4ll n fesa( sDuauro;o4tlt io3tys s2raums (0arermr3iytopD livi ( trxmim iudolt mivil(  rumumont0oet  ociys sDeluvp;t)trxomo3oadlmDelnvslt)trur(mpno1om n fvt s  Duax p;t0aexnmociad m2ulnvo;(4alenxfctatomteanes;s) rtrim iy4al  lfvs ()a2um( o;t0tpeoioeiatla ea( o;()artnmf3ootomtr i olt) rxo(o3nu1al nmnvta() rrrxrpnt0tpeo fetlsls ranvp (0tltrmo ty1optrai s s0setrir3ou1ol emfciasfarraurp;o0alt miciytla umu s u4aeenir oadoa   nvi s0 2trxrpoy1ll   nvslt)a2umxrpno0tlxoii3tysla el(von(4 reomrciatlm  aueol()t2umio3iudoltelnvtls)arrm(root0oeeomoetatlsDranvo;(4aeenir3oatfp e neo;t0trtoxo3oy1optelfcsa() rtr(moou4alxomfctytfm ul(vp u0aeenifcoy1la eli o s)seumxr3nu1opee icsatf Draum ot1alen ocildla uaumsn(4treoiociy1fpte ueolt)s2xmir3oo4altnmnvt s aDuaxr nu4ape micildfs2ranmpnu) exnmr3todfp elnvil(  rtoxm3oydllenlivslt)aDuax p;o1olxnmf3tltlm emnmo;u) renifcoo1fpteluesl(0s2umxrpnodlpe mnvilt) 2rmxr no4ape mfcilslm uln pn(0 eermr3oy1lm e ieo s)trumxo oodlp emfvta(fs2urx  oo0tltnioeiydfs ulumont) ltrxf tytop rlnes;(  exm(m oydlp nmivt t s2ua(  nu1aetn ociyt s ul(vo () etrmfcto1fpDraivo ( t2urxr3io1optemncil()aruru oou0oltoifeiadlmDeln p u)tlxnxr3oy1fpD aivs;t0t2xm(m oo1lptnmnvs sfa2tr( o;t1apxomiciysls eauvo;t) lenif3totop   u o t)t2umir3io4lp nlncilsfsruaum nu0aexnii3ilslm rmu pnu4teerxfcoa1fatelnvs;s  etrxm3iu4lle  feiatf rurumo;o4apxn octyslmDrlu s () rxnxoctydlptr nvo;s)s2tmim oy4ol nlfvt s sDtmx ont0tlenmiciyslsDrl(vpnt)trerxo oadfptranvo ()srur(o3iodop n nei sfsrta(  ;u1olxn fctysls2rmu on(4 exomo io1lpD  nei;t trumim3ny1lltn nctlsfs2umxr nt0tle  oetas a2um(vo u4trxnmfcoo1lptr nvilt0t2xrir3oo1omenlfci (  Dtm(rpno1alxomfciyt s el(mp t4 lxoxrciatlmtr neols0 2urxrpou4lmtemivtl(fs2ur(root0aleoiieiyslsDrl(vp;u0 rtnxfciodfaDrlu olt srurxo3ou4al e nesls)sDra(  ot4apxnmfctad sDeanvon(4altnmo to1faDeluei;(0seur(mpiy1lptn ivsatfa2tm(rpno1opeoifctytls rl( pn()tlxoxf to1lpt ai o (0 2xo(rpnodalen fcia(fsrtm(  ;o0tpt  i3tltfm em(vs;(4tetriocio1oaD  ivi s)s2trir no4apt mneta( sDtm(rpnu4tltn fctlt s eln snt4texoxr3totlaD auei s teto(m3no1ame  ics s a2rm(mo;u1oleo f3tydlm rmu o;(0trenio tydom  livi;() etm(m3iu4lmtn ncsatfsDrm(mo;o1alx mfciasfs ulu o;t4aexrxoctodfmtraivi;s) 2tr(r nu1lmtnlicslt)sDtrumoot4tleomfeiytla2em( o;u0trenirciy1om   ivsls0trxmir iu1altnlfetat arrmuro;o0oetn ieiasls uan s t) lenircto1oateaivols texr(m ou1ope livsasfa2rax pno4oleoiocilt a2umu o;(4 exrxo oodoaDeau s;t0teuoiopiy4al e fvt (  2tru pou0oltoio3iyt aDuluvpnt) exomo3iodlaDraueols0s2xr(mpiydolte feilt)a2urxm ;u4aleo i3iyslsDean o u)alermr oydoa   i o;s0 2trir no1oleemfesas)sruaxr ot1olx  ocilt aDran p u)tleomr todlp elueil( trumio3ny1olte ncslsfaDuauroot1oexniieiatfmDeluvo;t0tltnmrcoatfaD au i;( t2trio3io4lptnlnvt s)artrum nt1teenmfciysla el( snt4 ltnmr iy1oa   neo;()s2xmxo3oo1ol  mnetls)aDraxr no0teeniieild s uanvo;t4tetnifcoatla rli o;s s2xm(r nodlmteliesatf Duax oou0tpxn i3iys s2rlnmp;u0tlxnir ia1optrlnvs;(0trto(opio1op  mnvtas s2rau pno0apt  f3tys aDrau o (0 eenxrcoy1fpD anvi;t0s2trxo io1lmtemnci t)s2uaum no0tlt io3iysfmDulumo;(4 lxoifctotlaD  nesl(0texoxo iudlptnlfcs s)srrrx o;o4tpen ictys a eanvs u) eerif3ta1omDean sls) 2trxmpnodapt lfetltfsDuaxm no4apto f3ils a2ean s;(4trxnir oodom  aivi ( trurxr nudlltnlivi t a2ra(m ;t1aexnmietaslm2ra( s;t0texoioctadlmt livi s0s2xrxopiodapt mneia(fsDurxmpnt4opeo ieildlaDumumo;(0 rtrxr3iodoate n slt0 rurxopou4lmenlneta( a2rm(m ;u4optnioeias mDuluvp;u) lermfcoy1lmteanvi;t)trumxmpiy1lpt mies sfsrta(r no1aex moeiasls2emu onu)trenxr io1fmtraneilt)srtrim3iydamtn ict s)arur(rp;t4alxn ociydfs rlump;u4arxoxoctytlatean s;t trxoxmpoodomenmfetl() rtm(mpnt0oleomocilt m ranvs;(0arxoxrciadoat  uvo t seto(o3ou1om n netlt srtr(rpou1opxoifcias s2raumon(4trxomr3iatlpteanvo;s)texr(o3ou4aleemivs s)arrm(  oo1aptn oeiydlaDeau p (0trtnmo ty1omDrlivi s0t2uoim3nu1lpe lfcsas  Drmuronu1oetnmoeiaslmDra( s;(4tetrir3iodfpDe i ilt)setr(r3nodal   ivias)s2umxm oo1tpe  ietlt sDuln snt0 rtrioctotoa  lnes;t0srtoxo3nu4omt mfvia() Drax ont4aeto i3ild aDumuvsnt0texnxr oydoptean i s0 rur(mpny4lpenlfvsa() Dra( pnt4texoifeiasfs emumpn(4 exrmrcoytfpteai i s) rtoim nu1ameelncslsf Durx  oo0olxoifeils aDraumo;u)alxrmf3oo1op  livol(0srxo(opny4om emics sfsrrr(mpoo4olxn f3tls m ra(vo (0 lenir3oytoat aivs ( seumxrpio1om elnvia( aDrrxront1opeomfciasfm2em(mp;()tetoircoa1omD  i sl(0 rxrxo3no1ll   ivt ()sDua(rp;o0aeto iciad a ulnms;()alermociadfaD  ieil()trumxo3ny1apen neilsfaDururoot0apt mf3iyt a2uau o;(0 leomo3to1op e i sls srtm(mpoo4apt mfesltf Dua(mpou1tee ioetadlmDrl(mpn() lenxr iy1oatrau ils) etr(opnodapenmicsa()a2ta( o;o0aexomfetlsfs ulnvonu4teenxo tatfpteluvi t  exmio ny4ll emnctlsf Draum ou1apxnmfeils sDea( o;(0trtoxr tydfp  lnes;t  exoxo nudlm emivtas a2rr(rpnu0apen o3tls aDelnvpnt)aeenmo3ia1fpD ln s s0texmxmpoodlmte fesas)aDum(monu1tex iieild sDumums (0trtrmf3iadlp eaieo t trurxo io1omeelfei t) 2uax  nt1tetn iciydfsDeanmo u4tleoir3iatlm  anvol(  rxr(rpiy1lmtemicsat aDrrur nu0ope mf3ilt m2ea( s (0teenio3oytlm rlnei t srxmxmpnu4oltnlictatfa2tm(rp;o1tpe  o3tasfm2rlu p;(4arxnmr tytla   uvilt) rxr(m3iudoptn fvias arurxr ou1teeoioetadls2um(mp;()arenmf3iadoat anei t0trtr(opnydllt  nvsa()a2umumonu1ole if3ilsfm2rmnmon()aexnir iydoat auvi ( s2trxm ou1op   iciat aDua(  nu1tpxn fctyd m eanmsnt0 rxrmr3io1lpDranvs (  exmir oodop   fesa( arra(r ot4tpxnioetltfsDra(mpnu)aleoif oydfat lueils)s2xoxr3iodole lict s)s2uaxmonu0ope iietatla2umnvsn(4alxnxo3oy1omt  ueols0trumir nodame lneta(  2taxmp;t1tpeomf3iyd s rl(mp (0aexrmr3ootfaD  uei;s srumio oydlmen nesa(farumurp;t1alt  fciadfa2emnvs t)teenxf oodlpDraivol(  eto(m3iudom nlfviatf rtmum ou1aeto iciasfa2ea(ms t4tleoif3tadlp  aivols0srxmxmpou4alen nci tf 2rau ont0open i3iat m uln ont)altomo tatlaD lueil(0texrir3iu4ape  nvtlt srtm(mp;o4aetn fcild s2rm(vo u4arxnmf3todfm eau s () ruo(m iudlp nlnct s)a2urumpno0opto ietys m2uanvp (4aeenmo oatoptraneo t0t2xmimpno1ome lfcias  2um(rp;o4ope  ictltfa2uanmp;()alxomf oydfpDeluvsls0sexriopiy4lle lfetasf Durxrp;t4tpx iieiat s2rm( p (0artoxfciotfmD  nvi;t) rumim3nu4lpen nvi s) rraur oo4apx miciltfsDrauvo;t0aetoxr3iatoa eaiesls srtoxo3oy1lmtnlnesls)aDur(m oo1ale  feild m el(vs u0trtnxo3oadlm rln ols) eumxr nu1ole lnes t arrm(r ;u0aexn oetldfm emumo (0 etnmo todomt lnvo s0setmir3nydllt mnvi tfs2ra(rpnt0oleo ieiltfaDrlnmpnu4 renxo iotfm rlieo;t  euoxr io4llenlnvt sfsDumuronu1oleniieiydfm ranvon(4 eenxr3iytomt  uvsls setoiopio1lmt mfctasfaDum( o;u1aexnif3ias a ea( o;u0 etrxf iatom e ivs;s s2tmirpnodlp  lfvi ()s2umx pno0tpeo iciyd a ra(vo;t0 lerircoatfat aieo;( teum(m oo1amenmfvs (  2rm(mooo1tee io3ildls elump t)tltnmo3ta1lpDean i ( t2xmirpiydomeelnei ()sDrmur ot4tptn ieiadlm2rmu snt0tetnxo oytfateluvs;t)t2tmio nu1altelfcsl(  2umurono4oeeoiieiytla ean p ()trxnxo iytop   i ol( s2tmxm iy1ol e ict s  rtmumo;u1apxomi3tytfsDrlnvo t) ltrifctatopDrlnvo s)s2um(opiu4om emfcilsfarua(mpot0tpt  fetltfm2el( pnu0teermf iodfaDr neo t0t2toxm3no4lpe lnvta(fsrrmu pno0oltoiiciltfmDumnmsnu)aetrxf ty1lmtr nvo t  eumxm oy4lp n iei tfarrr(mpnu4opeoio3tadlaDem(vp u4teenmo3iotoatelnvs t) 2uo(o oo1lltnliei ( a2taurooo1tpx  ieiytlsDelumo;(4 etrxf oy1lpte iesls  etoxmpoydame lfesatfaDtr(m nu1oexniiciltlaDumn pnu0 ltrmr oytfatelnei;t) 2xmxrpnu4op n ncs ()s2uaxrp;u0tpen i3tas aDeluvo;t)tltrmrctydfp eai ils)setmir3iodlme mivs t s2tru  ou1tpenmf3iyt s uaumpn()teerxr iy1lpteaueo t) exr(o3io4lmt  ieia(f rrruro;u1tlxomi3iysfa rl(ms (4tltnxo3iy1lmD li i s) rtm(mpny1olenmicslt)sDuru o;t0apeo i3tys a2umums;u0artrir3oodomD lnvils  2xmxm3no1apt  icilt)sDtrxmpoo4apx  octld s2ulu s u) ltnmf3tytoaD luvs t)setm(m3iodop e fcia()aDta(m ;o0aptnif3tlt a em(vpnt)trxrmo tatomt  i i;(  2umir oy1omeelfct t s2tr( pou0tltnii3iydfaDrmnvp;t0 rtnirctydlaDraivo;t)s2xmirpio1lme  ieil(farta(  nt1tex ifetls a2ulnmo;(4teeoxo iytop eai i;s) eto(mpiy1om   netlt) Drmxrpou4aex  fciatfa2uauvpnu4artoxfciytlm  luei;t trurimpio1apeelncs t)a2trum nu0texomf3tydfs rau s (4arxnxfcootfat aies;t t2xo(mpno4am nlivta()a2tru oot4olx ii3iadfaDumnmonu)aexrir tydfptrlueo (0 2tr(opou4ole mfcsa(  2tax o;u0aex ifciat m uau p t0 lxoif3oodfpt lueo s)trum(rpiu1ope mici tfs2umum ;t4oetoifeiatfaDel(vs;u)arxnmo ootoaDr i s;(  2xmio oy4ape  ncsls) 2tmx  ;u4texoiietldlm rmn pn(4aexrmfctotlat auesl(0 etoio3oudap nlfvsat aDrm(mp;o1alxo oeiysfm ean p u4 ltoxocoo1om eauvs t0sruo(o3nudapeelnvsltfsrtmxm ;t0altoifcils sDeln pnt0 rxrxo iytfaD ai ol()teuoirpiodll  mfcsls  2rruro;t1aeeo oeias mDrlumon(0trenir oo1lpteauvsl(0 etrio3iu1ap n ictlt)srtrxrooo1aetnio3iad mDul(mo (0 ltnmf3todla eai il() euoxrpnodlmtnmfes s)a2rmx p;t1aexnmo3tysfs2em(vo;(0artnio ty1lp eli s;t  rtmim3nudomtnlfvtls srtr( oou4tpenio3iysla2ulums;(4aexrmf3iydoa  lnvo ()seuoim iudllt mfesas aDrr(m nu1apxomfciysla2rmn s t4trerir oytfpteanesl(0 ruoxr3iu4ol nmici ( aDrr(rono1aetoii3ilt a umu p;u4tltoxr3iadfpD  uvo ()setr(o no1omtelncilt sDtm(root1alx  fcils s2eaump t4teeoxr3oadfpt au i s  rxoxrpio1ol  livt () Dtmxm ;u1tptnmo3tltfaDrauvs;u)tlerio3tydoaDrln i t t2xrxr3nydoltemnct () Dtr( o;o0oex mo3tyt a2rmn o;u4arxnmr3tytoptrlnvi t) rxoxm oo4oltn nctasf 2trumonu0oleomo3iltla uaumsnt0alxoxfciy1latrli i;(0 2uoxrpnudapenlicilsf Duau  nt0tpxnmfetad mDrmu o (0artnxfctydlaD  i sls s2xm(opiydomtn ietasfsDtrumpnu1alxn oeias m rlumo;u4trtnxo3ta1oateluvs s0 2trimpno1alenlfvsl() 2um(rp;u1oetomocildlsDem( o;t)arenmrcootlmteaies (  2urxr iu4optnlfetlt) rra( p;t1aleo f3tysfa2ranmo;u0tltoxr ty1omtrlneo (  rxoxmpiodale miesatf Duau pot1oexnmfeiat sDranvo;t4tleoxociotoptr nvs;t0 rxrim oo1om n fcs tf Dumump;u4teeoiieilsla2rlump;()areomo oo1op  lieo;t)trumxr3oydamen fvtls  2tmxrpoo4tex mf3tatlmDuln s;(4 lxrxo3oo1opt  ies t srurxmpoudlptnmiesls  2rr(ro;t1aptoif3iydla2umn pnu4aetoio3tatfm r uvils0 rurirpno1ap  mfes t) 2ta(r ;o4aee mietldfaDumnmont4alerio3oy1fp eluvs t) 2xo(opnodap  mnvilsfa2ur(roou0altnmfetldfmDum(vpnt) lerio3iytfm  aivsl()tetm(opno4op emivia(  2ra(mpoo0aetn ociyd s emnvsnt4 lxnxo oatfp rau o s)srxrio3oo4amtnlncia(f 2ra(mpno4olx ifcildfm ra(mo;u4teenmfcootfmDelivo s  rxmxo3oy1al   nvil( sruaxrp;o4aetoiieiltfm2rmn pn(4treoxf3iatfa eliei;(0teuoxo io4lltnlivs t arrr( ont1oet mf3iadlm rmuvo;u4aeeoxr3iadop   u i ()srum(mpiu1am nmfetasf 2rrum ;t4oee ifciyslsDumnmp;t4 eeoxf ta1fp  an sl()truo(m3io1aptnmfet t)sruau  nt1ope  o3iyd a el( ont4trerircoydoptraieolt0sexr(m ny1alenmicil()a2rax pou1oeeoif3tlsfmDean o;t0tetnxr3oy1lm   uvi;t0srtrir3oy4ole  ieils srtaxmpoo0oltn ieilsla rl( o t0aexomociadlmDeau o (  etrxopnydllt lfvsl(f Dururp;t4oet ioetltlmDemn s;t)teermo oadfmDelies ( tetoxr iy4op  lfes s)aDumx  nu4aeto o3tlt s ua( p u0artnmociadfpte ueo;(0trtoxm3nu4lpe mnctas)srrru  ;u1texn f3ils m2ranmsnu)altomf totfm rliesls srtrxr3oy4ope lfeias a2ur(  nu1oet iociadlm rlumsn()arxrmocto1fptrluvsl(0teuoir iydal elncil( a2rau p;u0olto ictadlm2eluvo;(0texnmo3tydlmD au s s0t2umimpiodole  ictasf Dum(mono1oltn f3iydla rmn s t0tlermf3oy1fm eli sls)trxmxo3ny4omenmnet (fsrrm( ono1tpeoioetatfm uanmp;t)teeomf to1lpD lnvi t0 2xm(m oo1omtnlnvt ( aDtrxr ;u4aeto oeilslsDumu s u0 ltrircia1oateai s s0 etmirpiodom  mfeta()a2rr(m ;u0alxoio3ilt mDum(vs u4areoiocoy1lpDe neo s)s2uo(m3iu4op n fciat sDtmum oo0apenifcildlm2ea( p u0areoxo iydfp r ieo;()s2xo(o3oo1lpenmfvtat)s2ua(m oo4tpt miciadlaDra(vs u)teeoxfctadopteauei ( srum(o3nodapte net sfaruax pno4apxomfciaslm rl(msn()tltoio iy1lm r neslt)trumxo ou1ome  nvs (f 2rru pno1tlt io3iyd a rln s;() rtnir totfm  aneol(  rxoxrpoy1lpe mies (f rumu  ;o1teto i3tadla ua( o;(4 etrxo3ta1faD an s;(0srtr(o oydlltnmfvtasfaDrm(ro;t1optn ieiat a emnmp t4trtnir ty1fp eaivo;s)t2trim3ou1lm nmnvslt)srrau oot0aptnif3tydlmDuanmp;(4arenmr3iodoa eau sl(0 2uo(m3iy1ame lfeslt) 2tm(ro;t1apxoioetysla umu p () lxrmf3iadlmDr ueo;t0trtoxr iu1ap nmictlt) Draumpoo1tlt if3ilslsDra( s t)tetomo3iytopDelivs;(  rxr(mpiy1open ncia(f rta(rono4tetn fciad sDelump ()trxnxo3iotfaDe neslt0 2xrxm3iudal   ivt s s2taur nt1texomoeiys s2uan o;u)alxoio totoat  ivolt0s2tmiopoydom e fetat sDtrx pno0aee  ieiys m2emums;t4tetoxr3iytfaDeanei ( s2xo(r3oudaleelivsl()sDum(  nu0tpxn ieilt a ea(vs () lenxr to1omtrluvo;( t2tmim3nu1lmenmfci s  rrauro;u0tetnifeiadfa2em(mp u)aeeomr3ty1lpDr ieols)srurxmpiy4altemnvil(fsrra( p;u0tptn fciltlm ua(msn(4alxnxf iodomt aivo;()t2toxo iodap emncs t s2rrxrpnu4ole io3iydla2eluvo u0aexnmrcty1omtelieo;()teumio3iy1op   ncsl()arrm(r nu1alenii3tld m2umnvont4 rtrmocoytop r nesls trtoim3iu4amte feslsfartm(r ot1optomo3iyt s um(mo (0arenxo3oo1lpte u i;() 2xm(rpny4apeemncslt  2ua(mpnt1tpeo feias s elumo t4aetrxf ty1opt  ivo t0t2uoxr3ou4lp eliesatf Dur(r oo1olt  ictysfsDra( pnu0 etrxf iotla rlieo t0t2xoio3oo4lpenliviasfsrtr(mpno1alt  o3iasfa uauvs;(4trenioctadla   i s s) rtoimpiu1omtemiet tf 2taur nu4ole moeiadfs2ra(vo u0 eenmo ta1oat an olt) 2xoiopiu4ole lnetltfsDua(mp;o1oeeoif3tytls2raumsnt0aexrmo oytoa   uvs t0s2trio iy4amtemneslsfartmu o;o4aeeomfciat s2eanmont)alenxf3iodfatraueslt0srum(m oodolen nvsl( aDumxmpou4altnii3iltfa2raumpnt4 rermrcoatfpDe nvo;() 2to(r3io4lm e feslt a2taum no0apt ioeils mDum(vs t4 etrmo oatlpDr nvi t) 2xrir3no4am  lfciatf Dtmu ont0tpeomocilslm rmu s;()arxoio todoaDeaieolt)teto(m ny4omt livilt aDta( pno1apenmfciytfmDrmnmsn() lxrio ia1fmDr uvo s)s2toiopiu1lme  nctl(fsrrmxmpnu0apt ioctadfm ranmonu)altomf iytfa rlues (  etrxm nudlm nmnetl(  ruau ono1tpt  ieiydls eanvo;u) lermo3ia1omtraivi s) etmxmpiodlpen fvta() rrmu ont1apen oeiytlm ra( s t) rtrio3tytfa  lnvilt)seum(opoy4ope liet sf Dtaumo;o0tlx  feiytfa2rau p;u)aetnmr3oa1oatr neo;s0t2uoir iydopenmiesls)aDumxmont4ope ifcildfa2raumon(0 exrxfciytom  aueo t0 etmiopnu1ome mietl(  ruax  ;t1tlto ieiatlm2rauvs;u0 exomrcoadfate u s s trtmiopnydopt mncias  Dtrumoou1aet mictatla2uln p;()arxoir3iy1opD  ieo t sruoio iydlltn fct sfs2ur(r ;o1alto fetysls2ua( s (4aleoio3tydoaDe ieslt t2xoxr3io1lmtn fesas arrmxmonu1olx  o3iasfs ulnvpnu) etoxr tydopteln ols) 2urimpnodopeemieia()artr(mpno0apxnmieilt m2ul( o u) etrmf io1lm elivs;(  rxrxr nu1aptnmfeta()sDuauront4aee  fctytlm2emn o;()teeoircoadlptranei ()sruo(m3oudam elfei ( aDta(mono0aet ifcilt a em(mpnu4aexnir3oy1lmt anvs;s)s2uriopoy4ap   nviat  rurumpno4oltnioeiydls2ranmpnu0 leoxf3ia1fa e i ilt0srumim3nudamen neslsf Drmx pou1alx  iciltfs2uanvs t)arxoiocoadfm ranvi s0sruoxrpnudlm e fei tf rurxr ;u0opt  ictyt mDrlumo (4altomfcoy1fpDr neslt0 rumxopiu4amt  nei () 2uaurp;u4opeomo3tys s rau s t4tltnmfcto1faD li i t)s2to(o oudomeemivtltf 2umumonu0tpenmietydfaDrmnvp;t)artnif iydlaDe neo;t) 2xoxr ny4omen ivslt)srua(ro;u0opxnioctatfm2ulnmpnt)teerxocto1oaD ai slt0 etoiopny1amtelnctls  Dumurpou4oex  icild m uaump (4 eenxr ty1latr ivo;t0trxm(mpoo4lp nmfcs sf rtrumonu0tpt  ietydlmDrmums () eeoifctatoaDelu s;t)s2xr(m ou4llt  nvils)srta(m oo4aet mfetydfaDrauvo t0 exrxfctatfpteai i;t0texrxm ou4op elfet t)arrrxmpno4ape ii3ias a uauvp;t4trerir3oo1omtrliesl( sexmim oodlpt lfctas)a2ra(mp;t0opt moetydls2emnvp;(4 rtnmr3todfp  li i (0srxoxr3ny4lmt lneilsf rtaump;o4olxnmiciytls ran pnu0aetrxrcoa1fa  luei s)s2trxm nodlpenlnvtatfsDtmxroot0oltnmo3ils m2rmuvon() etnif oatoaDraivi;t)srxmir oudoptemivs t) Dtr(root0apenifeias m ea(mp;() exoifciy1latrlivi;( trxm(rpoy1oltn fciat aDuax o;u0aetnmietlt s ranvonu0trxoxf tydlmtrau s (  2xmio3oo1ap emfvi ()s2umum no0texomf3iytlm2em(mon(4trxnmo io1fat livol( texmxm iy4ol nmici s) 2ua(mp;u4oltomfeilsfm2elu s;(4aexomr tatlp  lies s)texo(mpou1lltnlncsl( a2rmx poo4oeeomfciydfsDua(ms (4teeoifcoodfpDrlu o s s2xrxm io1ol e iesltfsrtruro;o4teto oeiatfsDrmu p t4 eerio3tydlptr uei s)teur(m3ny4om e fetl( s2ur(rpou4opx  ociysfmDrlump t4trerif3iotla r iei;t0 rtoimpnydop  mfei ( aDrm(ronu0oet mfeiadlmDrauvp t) eeomocoydomDeauei s  etoxopou1alt liesatfsDtmx  ;o1tltniociydfa2umu o u0areomo tydop rluvo;s)srtoirpnodom   ieta(f 2umx  ;t0ole mf3iyt m2ra(vo;(0 rtomfctotfmt  n i ( trxmxm3oudamenmnvs ()aDrr( ono0olt ioctad aDel(mo u) rtrmr iotfpDelnesls)t2uo(r oo1apt lieil(f Dumx oot1alt moeiytfs uluvs;t4 etnxo3iadoate ueol(  2trio3oy4ap  mieil()sruru  nt1tetoifeiysls em(vo;t) ltrio3tydlpD livs t)srurim3ou4opt lnetasfartax  ;t1oltnmocils a rm( o u0 lxoir3iytom r ueo t teumxo ny1amtn ncilsfsrraump;u1oexn i3ild a rmn onu0aexriocto1la elnvi t srum(m oy4am emici (fa2tm(  ;t1texoiiciys s2el(vpnu4aleomo3to1fmDeaieo ( trxmxm3io1llt  iviasfs2uax  nu4oeeo ociydfa2eaumpnt4tlxrifcia1omD aieo t trxrir io4lltn nesa(  2ururono0tltoio3iysfmDemumpnt4aexnif oadlmtraivo;() rtm(m3io4ale lnei ( aruau pnu1oee  ociytfs2ulnmp u)arerxfcia1lmDr uvi;s0 ruoxo io4altelivtls sDumumo;u0optomo3iadfsDea(mo t) ltrir3oatfmtelivils  2xrxrpno4op nmncs t  Dra(mooo1oltoio3iyd aDemnmo u4artnmfcio1opD auvilt0 rtr(mpiudom elivtlt  rumxr nu4opeoio3iltls em( o;(0tlermr3oo1omtelnes;t0 2trxo3nu1lltnlict tf Dtruronu1oeenmictlsfs ea(vonu)aeerir3iotomtr n ils)s2xoirpiy4opt lnetlt sDrmu  oo0tlt mieiadfa umnvp;(0alxnmr oatfm rlivsls)seumxr3iudolenmncil(  2rrx  nu4tle iieildfsDrluvs;(0altriocootfaDran o;s  rtrxo iy1apt mfcilt  Durx o;t0apto f3iyd m elump;()teeomocty1oate uvs;s)t2to(opiy4om   nct () Duau pnu4oeeoioetltls2ulnvs;u0teerxf oadfaD au ils)srtrim3no1lpe  nei t artmxm ;o0open oeiydla rlnvo;()altrxoctotomDe ivs;s)trtoxr ny4amen nviasf Drm(  ;o1texomo3tldlaDuauvs;() lxnxf3iodfm raues;s)trxmxr oodopteliei ( srraxm nt4openii3iaslmDul(vp;u)aexrmocoydom eln slt)trtrxo iy4ll   nvtatfsrumuroot1aee mf3iadlmDrm(mp t0 ltomf ty1fmDraues t  rtrxr io4apeelfvtas)artrxmp;t0aexn o3iltlm2emn o;(4 lxoif oy1lmDeaueo ()t2trxm oo4lpt licil()a2tmxmoot4tet  fctltfs rlu p u) rtoxo3ta1fmtr neo t)t2uoim3oudape  ivtatfartm(ro;o1teto ietltfm ra(vs;t)arxomrcto1fmtelu i s0s2xo(r nu1lpeemnvsls  rta(  ;u4tle ii3iat sDrlu pn(0 lxrxoctydoaDr i ols)s2xmirpnodlpe  ncsa(f 2uru o;o4opt ifeiytfs rm( snu0treomf3totlat livs;(0 etr(rpoy1ape mnvta() Durxmo;t1tle  oeiatlm umn onu) eerio tadfptr ivo;s)srto(mpio4lmen nes ()aDuax o;t4olto fctysfm2rlums u4 exomrciotfaDr n i t0srtoio3ou4al elfvt t srtmu o;u4tetnii3ils s umnmp;u4aexrif iy1omtelnes;s0 etoim3nydame mivi tfsruau  no1tltnmf3iatfaDrmu pnt4tetrio iytomD lu s;t0 etr(m ny4alt mfcils)sDtru p;u1ape  oeiytls elump u0arxoif to1fmD  neilt)setrio ou1omtemncsatfartmu  nt1opxoioeiltlmDrmuvp u4altnxfciy1fmDr uvols0 rtoxrpnodaptnmnct sf 2rm( oot4olt iicias a ea(vo (4aleoxocoydlp rli ils)s2to(r3no1lle lics (faDrm(ronu0ope  iciadlm eauvon(4areomocto1om   i o s0s2toim3iydlleelnct tfaDum(r oo4opeo o3ildfsDumnmpnu4alxrmr to1opD  uvs ()srurxrpnodlme lfvia(fa2rmxrono1tpt ii3iltfaDelnms (0 rtrif3iadlaD lues s0sexrir nydlme lncs sfarrmu  ot1opxn oeiltlaDua(mont) renmf3iytfateai sls sexmiopoy4ll elicslt)sDta(mont0teto f3ildfs ran p t4teerir3ta1lptrlivi;s0sexoio3ou1aptnlivsa() 2rmx pot4aeen fciadlmDrlumon(0 rtnif3tydfm   n olt0 exrir3oo4lpe  ictls  Dtm(  nu1tpx iiciasla rl(vpnt)tltoxo iytopDeluvol()setmxr3no4op  mfesas  ruax pou4oet  ictydlm ea( pn()altnxo ty1omt ln i t0 euoio3oy1am   fcsat)artm(  ;o1oex mfciys s2rlnvp t0 lxoifcoo1fmtraieo (  2umim3iydap  mfct sf Dtr(m ;o0alx iociadfmDuluvp u)aleoir3iydlateau o;(  etmio oo1apeelivsltf Durxm nt4tpenmoetlsla ulu o;t0 exrmr iydlpDeluvs;()srto(r3oydlltnmicilsf rrr(rpou0tpxn ociydfa rl(vp;t)trtrxr3iotoatrlneilt) euoxmpiydlleemnvilsf rrmu  nt0olt  ieiydla2ulu p;(4texoxrcootopt lneo;()seumim3nudameelics (fs2rax  ;o0oexn f3ias sDrm(mpnt4tlenmf3oytfmDrauvilt  2um(mpno1lleelnvilsfs2rrxm oo0oetniietyd s emu sn() etoxr oy1fa rli sls)setmxm oy4lmenlicslt  Dtmu ooo0tpxnioeildfs um(ms;t)tlxnxo3totop  luei;s0sexo(o3nydlpen ictat) 2taxm ou0ape  feiys sDul( snt)tlenmr iotfptrai o;t0 euoxmpoodal elfvia(fartr(m ot1oetnmoctltfs rmnvsn(4arenif iatlpD aueo ()sexrxopno4llenmnct t a2rrump;o0oleoiieilt aDumnmp (4 lerir3tatlpD  n s (  2xrir oy4lpte fcils aDta(ro;t4aex  f3ilt a2ulnvo;t4arxnxrcoa1op eai o ( trxoim3nu1llt  nesl( sDumx ono4olt ifetyt sDel( sn(0 renmf3iodfaD li olt)t2uo(o3iy4ame mfeil( s2trum ot4tleo ociadla umuvpn(0arxrmociatom eaivi (0t2xmxr io1om e fei s sDuau oot0apen i3tls a2emn snt4aexrmfcootlmD lnes;t) 2tmiopiudlpeelfcsa() Durxmpnt4aee mociytlm2rl(vo;t) rxomfctytlpDr u s;()seurxmpio4omtnlfcilt) 2rru ont4tpenmicilt a2eau o (0 leoxf oytlpD luei () 2uo(rpno4openmivil()a2uaumoou4open oeiltls ul( p;u0treoifctadfpD lu o;s)seurxr3no4lmen nvs sfsDrrxmpno4oeeoiieiytfs ean s t)teenir oatfp rauvo s s2uo(m nydome  ivilt)s2taump;o0oetoif3iyd s2elnvo;(0arxrmrciydoptrlues;s tetrxm3oo1op emfes t) 2rm(  ot1tpxo iciysfmDumnvs u4 rxnir iadopDraivs;s0trxrirpio4olen ieilsf Draxmpnu0aexnmiciytlm elu snu4texrircoo1fmt  u i s trxm(m3oydoltelnes s a2uaxrp;t4ole mi3iltfm emumsnt4 ltnmr to1om   ieolt s2xmxopoo1al e iet t  rrmxronu4oeeo ieiasfs ranmpnu4areomoctydlaDrai il( tetmir ny1omtnlncs t  2ta( oou4opx ioctad sDrmump;u) exrxocootla  aivo t) 2xrimpnodlmt mnct t aDrau  no1olt  oeildfa2uauvp;u4 lxoxr totlmte i s;() 2xmio oo1amenlivtlsfsDtrurpno0apeomictld s rm( snt)aetniocootoptrauei (0trxo(o iudop nmnes () 2ta(m nt4oee moctldfs2rmu on(0areoif3tydlm raivils0trumio oo4aptemfcsas arrau pno4tex  fciatla2ua(mp u)areoxfctydlp  ln i (0t2um(m iodoltemncta(  rurur no1tpxnmoctltfs2umumonu)trtrirctodfmtrau il(0s2xmimpnodalen nesas)s2umxmooo0tpxoioeildla emn s u4tetnmrcoydfpD  ivs s  exm(rpiy4lpt  nvsa()a2tr(mpot1tee mo3iadfs2rl(ms (4 etomr3iadlmDelieo t)t2xr(opio4optemieiat artm(ront4oee mociyt s ulumon() reoxf3oodlaDraneil()texrim3ny4lm  mfvilt)srrmx pou0ape  i3ildla rau ont0 exoxr3iydopt anvsls)s2tr(m3ny1am n nci s)arumx  ;o0ole ifciyd a2raums;t0 renir3tydfmte ieols0sruriopoy1lmtnlncsa(fs2rmxmont1tpeoioetlt mDelnmo;u4aleoif3tatfatrlies;() rtm(opnu4ame  iet t)artr(r oo0oeen iciltlaDuan o u4 exrxr3oy1optelu s s0texo(o ou1ope mietasfsDrm(rpnt1aptnmfctld s2ua( s t) eeomocta1fmtraneo t) etoxrpiy1aptnlfetat)sDtaur ;t1tltniociadfmDelu s (0artnir tadlp elu i;s0 euriopnu4omtnmnct () 2um(monu1oex mfciasfs rlnmo u)tetomf3iadfm e ieilt0sruoimpiy4op emnvt t)s2tmu  no1opx  oetytfaDum(mp u0 rxoir3iytomt lueo;(0 2trim3nydaltnmnci tfsrrrxmpno0apeoioeias mDeluvpnt0aetnxo oydfat  n s;t0srtmxmpnu4ol emivta()a2um( o;t0tlt mfctysfs rmnvo (4teeomo3oo1fpDrluvol()texm(m oo1lpt livi () 2rrxr ou0aeeo iciatlm2rln o;(4 etoirctatoaDelnes;s)texo(o iy4aleemfcta() 2rrx  nt0tle mfctysfm umnvo (4areoxrciotfp rln s;s0teur(m oo1openlnvsl( s2tau pnu1aexnioctydfsDumnvs;t) lxrirciotlaDe ueilt0s2um(opnu1am e nvsl( s2tru oou1alt  f3tls a2uauvo;t0tltrmr3iatlmteai s;(0srur(m nydopenlfvs (fsrurur nt4apenmicildfs rmnvp;(4aexoxfcoy1fpDelivo;s0t2tmxrpiu1optemfei tfsDtm(mo;o4oleoifctlsfm2emn o;t0arenxrcoydlptr nvs t tetoir iu1ap n fcsl(faruaxr ;t4tpto o3iltfm2elnvpnu4 lxrir tatomtranvi (0t2xoir iydlptn feia(f Duaurooo0aeeoio3iad a rauvs (4tlxnxo3tytlp e ivil( seurxo3oodllt livs s)srua(r ou1tlx  ocilsfm ulumpn(0aexoif3to1lptrluvols s2xr(r iu1amen ivt sf Dua(  oo4openmi3tasfmDranmsnu0teeoxf tadlmD luvo ()sexoxm oydal   fci t)a2ta( oot4tpxn i3ild s2el( snu)tetrir3ia1opDeanes;t  eurxr iydam   iciatfa2uaur ;u4apxnio3tld m2rmnmsn(0teenxf tadfa   nes;t0 2xr(o3oudlm emicia(farra(ronu1optomfei
\ No newline at end of file
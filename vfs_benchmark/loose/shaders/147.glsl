@@ -0,0 +1 @@
+nvo s0s2xo(rpoydolte iesasfs2rmu  no0tltomi3iydfa rl(mpnu4tleoxrciodla elueolt)t2xmxo3ny1am   ncilt)srrauro;t0apx ii3ilt a2ra(vo;u)altrmo3tatlpt lies ( srum(m iy4am nmneia( arur(moou1ole ii3ilsfm eanmo u)artnio3oa1fateau o ( trtoir3io4llenlics (f Drau poo4tpe  fciytfaDumnmo (0 etnmf3tadlmt  n o (0t2xrxr3iy1am n ivtlsfs2ua(m ;t1apxn f3ilsla2ul(von(4 reoxr3oydoatr uvs s) rxoim oodlmee fcta(  2taxmpnt1oet iieiyd s uln s;u0tetoio3oydoatraieols)trxoim oo4omenlnvt (  2raxrpot4oetomf3iys mDumn s u4altoxfcty1lat aieols0 2xrxm3nudamee ivtat aDtm(rooo0oexo iciytlmDrluvo;u4artoxr iodopt lu o;s trtr(opoo4omt mfes s srtr(rono4apto ociltfs2uanvo;(0alxomo3io1lm rlnesl( trtr(o no1ll n nct (  rumumpot0oee iiciydfs2ranmo u0 eeomocoy1lpte nvil() rtoiopnu1lpe  iet s aDumumonu4tetomiciaslmDea(vo;() reomfcoytlp ranvil( t2trxmpiu1lpeemnvtltfaDtmxr nu0tltomo3ilsfm2em(ms;t) etnmoctytfpDeluvol()t2trxr3iodlpenmics sfs2umum ot1texn oeiysfs eln p u4trenmr to1fpDeauvsl(0texmimpoo4opeelnvta() 2tmxmpno0olt mfctldfs2ranvs;u0aetrmr3iatfpD  nes (0 rtm(m3iy4apeelictls  2tmu  no1oltn fctys a2rm( p ()treomo ty1lpt lueil( seuoir iydol emici (f 2uaum ou0oltn ictld s rlnvs;()altrxf oydoptrlies;( tetr(o iudll  licslt  2rmxmpnu4tpto fciys m rlnvon(0aetoif oatla eau i ( trxmxr ny1ol nlnvias srur( pou4tptnio3iltlmDumu s t4 rxnxfcootla raueo t0t2um(o no4amen ncsa(faDrmurpno1apx  iciytlm2eluvo ()trxoif ta1fa eluvils) rto(mpou4omtnlieiltf Drm(m ;o4oeenmiciltfs2ranmo u) ltnxrcoodom  luvolt0tetoirpiydlpe mietlt  rtmx  ot4oex mociatfa2em(mp (0arxoxrcia1opDelivi;(  2xr(r iodol   ivtl( s2tm(mpnu1teen o3tydlm rl(ms;t0 rtomf tatlm  aivs t seuoiopoudamt lfvtlt)sDumxrpnt1oex  f3iydfaDea(mo;t0arerxf iy1fpte n ol() ruoxmpnodom nlfei t)artaumpnu0openmf3iytfs ran onu)aexomo ta1oa e i i t0 2xoiopny4amtnlivsls)a2trxmp;t1tptnmfciad mDua( p (4 eermf totfmte u ilt srur(m3no1opeemfcsls  Dua(rp;o0apt moctyt a2emnmsnu0aetrmociadfmtr neilt s2umimpiy4omenmfeias  Drruronu0altnmfctydla2ua(vp;u)trerxo3iodlat lneslt0 2xmimpnudaptelfvsls aDua(rpot1ole miciytlm ul( p (0 renmfciatfmDr iei () 2xoxr3ou4omtn fes ( aruax ooo0tlxn feiydfs umu o t4 rerio iatomt  nvo;t0 exmxmpny4ap e icslt)aDtr(rpnu0optoiicias m2ul(vo;t) rtrxo3oatlmDr u ols0texrio ny1ap elivs ()a2tm(m no0aee moeiyd s umu s;()trtnmr iadlpDr ivols  2umir3iudlme mfvtl()aDrmxm oo4altniictysfa2emums u4 rermo tydlm   u i;( srtmio oy1op emnes (f 2taxmpou4tlx mf3iad m um(vs;u0trxomrcoadop r i olt0srxo(m3ou4ap elnvt t)srtrx pnu1olxnii3iatlaDrm( p;t0tlxnxfctytom r n s;s)s2uo(m3ou1alte iei t) rta( ooo1aee mfeiyd a2emnmo (0 exoif3ia1fp   uvils0 rxm(m3nydlme lnct (faDtrum no0aet ifeilsla2emuvsnu0alxnif3oodfp elu olt sexmxrpoy1apenlfci s) rrr(  ;u1oeen ocilsfa2rmnmp;(4aexnif3oadopt an o s)t2to(r oudlp n ivil(  2ua(mo;o0aeeoif3tas sDrm( snu)alenxfcoodfatrlivo;(  2uoir3nydamenlietasf 2uau pnt1olt  fcild aDeau o;()trerxf ty1fm e u s (0 ruoirpnu1am  lnct s)aDrmu onu1oleo ieiysfa eanvs t0altrmr3tydfmDeai s ( sexrim3iy4ameelnct s)arrr(r oo4apxn feiasfmDea( p t0treoircoytfaDe nei t  exo(o3iy4altelies (farta(mpoo0tlxnmicias a2ul(vpn()texoioctodlm   u i;s s2xrirpnu1lp   ici t aDtax ono1alt mo3ilsfa2ea(vp;t4 rtrir3iytlaDr iesl() eum(r3iydam nlfvi s s2trxrp;t1olxn ieilsfsDuauvo;(0trtrifciy1omDelues s0s2um(r no4open nvi (fs2trx oot1olxnmf3iat a2elnmo;t4aeeomr3oatlptelneols seuo(r no1optn nvtlt)a2ra( poo1tltnioeiyslm uluvsn(4 eeomrcootfmDr iei;t) 2xmxrpnu1lm   neia()aDra(ro;o4ope mocilt s rmums t0treomf3oa1fat  ivil( teum(r3nudlpe mfcsas)aDrmxmpnt0alt  o3iasfa2emn p u0 lerxf3tadlatraieo;s)s2to(o3iy1lpte fvslt) Dtr(rpot4tet  o3ild m elu snt0trerxo3oodfmDeli i t0 rtoim nydoltelneias)aDtmx  ot0apt  i3iyd sDemn o;t0teeoio3oatfmteli sl( sexrxmpio4alee ivt (fsDuaxmoou0tpx mf3iasfs2uaumo u4tltnmrctodfm  livs ( trtm(mpoy4ol  mnvsa( s2tmx  no0aetnio3tls a emnvp u4trtnir iatfmteaieils)s2xmim oo4apee nvtatfs2uaxm ou1altnifeiatlm2uauvs t4teenifcto1opDrai o ()seurxm oo4ale  fvsl() 2rrxrpou0altoii3iadla el(ms t) eeomrciy1lmtraieil(0 rur(rpny1om  mncsl() Drrump;o4tleomocilt a2rm(mpnt)aleoxo3oodlatr n s;( t2tm(rpiudam elieta() rrrumpoo1tptnifeils s2rlnvs () renxo3oo1fmDe nes;t0texrir3oodlm   nvsls aDraxrp;o1apxo ociatfm ranvs;u0alxnmr ia1opD auvilt)trto(m3iy4ale livs sfs2tmurooo0olx  feiyd aDeanvs;u4 eenif3totom e u slt)t2xo(r oy4ll elnct s)artrurpno1altoifctlsla em( on()alxnir iydfmtrlneilt texo(m3oudale  ict s a2ur(mont0altomoeiytlaDumn o;()arerio oo1fmtrli o t0 eur(rpiy4lp  lnes (f Dra( oou4tltn fciad mDemnvs (4texrxr ootop r neo;s0trum(r iudale mnet (f Dua(ront0tlt ioetyt sDumuvon(0texoir3iodlmt au s;(0teuriopiy1amee fvt () 2trxm ;t0aetn ociytfs uaums ()artnmociatomt auvs;t trtoxo3ny1ape mfeia()srtruroou0apeo fetld m eluvp;t0 etnmr iadom elnesls)s2uo(m3nu1lpt mneia()arurur ou4tpe mf3iatlmDrlumpnu4aexomo3iatlp ean sls0 2urxm3nydlme lfcilt)s2ta( o;o1texnmoeiltfm emuvon(4 exrxf3oy1la r nvo (0t2uoxr3ou1lle  ncil(  2tr(r nt0oeeomf3tldfs2rlu p;u0tetriociytomDraueils0seum(r oo1am nlies t aDtmx pno1tee mieiatfs emuvo;t4trxomo3oydla  au i t0trxr(mpou1op  lncs t  Drru  nt0teeoiiciysfa2rlump t0 ltrmf tydlptranvi;t) euo(m nu4lpeemfvs ()sDtrx oot1tleomoctltlmDeanvo;()alerxfcootlpt li s ( texoirpnudamt  fctat srua(m nu0olxnifeiadfaDumu snt0 ltrif3oydfpD aneilt) 2um(o ny4altelivtlt)arum(r ;o0oeeoif3tld aDrln s u4aetoxrcoa1fpD  n i;(0texoxr ny4ll  mnvsltfarrrxr ;u4oexnif3iys a ua(mp;()artnir3iotfatrluvo t0 etm(rpoodlleemiesasfsDumu p;t4teeomicilt m uauvs;u4tetnio3oo1oatean i;( s2toxr3ou4alt mivs sfa2raxmono4aptomf3ildfaDulnmsn(0 lenir iotlmD  nvils seum(r3iy1olenlfvs sfsDta(mp;t4olenmietasls ranvs t) rtoxfciy1lmDrluvi s) rtrirpoy1optnmivtltfaDtaumpnu4oeeoiietld mDrmumon() lxrmrctytopteaueols t2urim iu4alt mivt tfsDurxm ou0alto f3iatla2uluvp t4 rtrif oadfp  au i s t2xmimpny1oltn iet ()arur(  ou1oee moctaslm eau p u4artomr3tadlmtraivs () 2toxmpny4lltn fctls  rtaum no1olxn feiat a um( s;t4teerxociodlpD lu o t t2xo(o3iy1lptnmfei t s2tax pot1tpxnmf3iaslm umumont4 lxoif3oy1fptr neo;t)s2tmir iu4oltelivtasfaDta(mp;t4opxn o3iyd s eln s;(4tetrirctatla ean o s teuoir iy4lmen fvs ()sDrauro;t0opto o3iad mDranvp ()trxrir to1omtelues;t0 eur(m3no4ape  fcslt sDta(m ;o0teeoiocils mDum(vpnt0arenir3ta1oaD  neil( srxoxrpoudamt  fesatfaruaum ;o4tlenioeiytls2uan s;t) etrxr3totlaDelieo;() 2trxrpoo4lptnlfci sfarrm(r ;o4apenio3tyd a2rl(mp u) eerir3to1oatelu i t0 etmim ou4ope mnet ()a2tm(r ;t1oee  o3iyslaDrm( p t)alxoxr3oydopteanvsls s2toir oy4ameemiesasfa2truroou4oleomi3tldlm2elnvs () eeoxr oodopt lu s;s  eumim nydal  mncsl() 2trx ono0opxn ociytlm2rmnms t0 lxrmoctotlm r n s;(0t2tr(rpiu4ll   nes sfsDtrur nt0tlxnmi3iyt sDeln o;t0 lxrmr to1oa eanvils truoim3oudopte ietlt a2rru pou1texnifetys aDuln snt)texnio3iadfpD aneo s0 2xrxrpnu1ll   nctlt) 2tax o;o1oee iieiltfaDrmnmo ()tlxrmr iotfmDe i sls)s2xmxo no1omenlfcta(fs2umxr ;o1opt iieildfs ea( p;(0teerio3oadla eliei;t0teum(r3oydop nmncil( artaumpot4tpxn o3iasfmDraump;(0altrir3oy1opteauvsls) 2xo(r iu1om nlfesa( s2raurp;o0openmo3iydfsDrlnmo;u4artrif iatop rlnvi (0 rurxrpny4altn fei t)arua(m oo1tlenifcildfs ra(mp;u)aetnmo3tydfmte n o s teuoxr3nu1lp   fet sfs2truro;u1alto ociyd mDumnms u)teerxf3totlptraivilt0s2umxmpio4amtnlfvi ()s2rmxmo;t1aexoioetld mDuaumo;u0aetrircio1lp ran ols0 etrirpiodalte ncs () Dumur ;t0optomfctadfa2ua(mon(0altrxr ia1lmD  u s t0setmxrpoy4om n nvs s s2urx p;o1oee mfetydfa umnmonu0 reoif3iotopDrluvsls  rxrim oy1apte ivsas  2ta(m oo4tlto fctat s2ea( p (4tltnifctotlaDe ues;s t2xmxm no4omee nvia(  rrrurpno0tpeoioetldlsDranmsnu)aeenxf oydlat aneilt0 2xr(o oodame mfvta() 2ra(mp;u4aetoiieiltfm2ranmsn() rerifciy1faD ai i;() 2um(o3nydlm  lnvtl() rtaxrp;o0tle  icilt s2emuvo;t) lxnmf3iydop rauvslt)t2to(m nu1amee icsls  Drrxr ;t1oexn oeild m2uluvpnu4 exnxo totoat an ils  2umio oudop emneil(  Duaxr ;t4opt moetldlm2rmnvo (4 lerxo3iadfp rln o ()trxmio oydapt  fesasfa2ta(m ;u1tle miciatfm eln s (0artoir3tadlm  lies ()srxrir3no4omt lfvs s  rumu  oo1aexnmociad m emu p (0tetrxocta1laD  nvs;s  2urxr3iu1amenmfct t) 2ua(mont0optn i3iatfsDeanmpnu) lxomr ty1laDeaiei;()srur(m3oy1omen ncs s)arumum ;o1tlenifeilt a rmuvo;t4artrxo iydfmDeai i s0tetoxrpiudlmte fctl(faDrru ont0opt  ietyslsDelnvonu4 lxrir ia1lpD auvo t)seto(rpoo4ap  lneiatfsDtrxmpoo4tetnmi3tys sDemnmsnt) reoxf oytfpDelieo;(0srxrio iu4amtn fvs s s2ra( pnt1aeenmieilt sDrmumpnt0tleoif iotfateanei;t  rtmxmpoodlpe  fctlsfsrtaum no1oexn f3tasls2elnms t0tlxoxrctydfmt aiei;s)srtoir iodam emiei ()sDraxm ot1olxomieiadlsDel( s t0trxrmf3ootlmDrlivi;t trxmio ny4ll eliesat  2um( onu4oeeoif3iatls rl(msnu0tlxrxf oodlmtr n i s)t2toxo nu1ape miciatfsrua(mont1tptoii3tldfm2rlu p t)aetrxf tytlp elivil() rxrxr3oodlpenmnciat srrrum nu4tltnmo3tytls ean o;u0 etnifctatlpt lieols texoio iy1op e ietltfa2ta( pnt1tee  iciad sDranmpnu0 renir3to1lmtean s;t0sexm(r ny4ap e nvt t aDua( p;o1altomictadlaDelnvo;(4 eerxo iytfpD ln i t  rxrxr3oudomen nct t srumu poo0aptnmocildfa ul( p (0treomr3tatlaDraies;t teumirpny1lm n ncsat sDur(m ;o4opx mo3tls mDean p;t0 rxnmfcootom  lnesls)teumimpiy1ape  nvsatfsDtr(mpou1aetomfetat m2elnvpn(0 eerif oo1fpDe nei s  exr(mpoy1lp e fvi () 2trxr nu1ope  feiltla2ul( ont0 lenif iytfaDrlieo;t0texr(rpiudlpeelfcsas) Drrur ;o4alxnifeilsfs2ulnvon(0tleoir iotomt aneilt)seur(r nydopt licilt aDrmx ont1oex moetydlm2ranmp (0aleoir3iotfatr ues ( texmio3ny1am elivi tf Dumu p;o1texoii3iys a elnmo;t0trerif3iydlat ai ols0 etriopoy4ale  fviat sDrrxmooo4tpto ieiat sDrm(vsnu4tltoio iytomD livo t0texoxopiudaltnmnvt tfaDuax o;t4altn i3iltfa rau p t) etrxr3oy1lm  aivo s)setr(rpiu1llen fcs t  rrm(mo;t1apt io3tytla rln o;u0texrxo todfpte u i (  eum(r nudomtnmnvtl( a2raump;o1aex  ieildlm2ra( s;u4 rxoxo3ia1oat livolt)trxo(mpoo1ale lnei sfsDumx  oo0opeomiciytfa elumonu)texoif3oo1fmDr i i (0 2uo(o3nu1ope  ivtl( a2trum nt0alxo oeiadfsDrmu pnu)aexriociatoa rlnvs;(0s2tmxm io4al emfvta() rtauronu1oltomi3ilsfa uaumon()artrif io1op e uei;s0srxr(o3ou1al  mfvs s  2rax pno1altn o3tatls rmumo;t4arxnxf ia1opDrlieol() euo(opno4am nmfeslsfa2ra(mpno4tpe mfetysfm uanmo u) lerif3iadlm  luvsls0s2xmxr3oy1omt miei s) Duaxront4tpxniieilslm uauvp t) rerxfctadfm e uvslt) rtmxm nu4aptemieslsfa2taxmpoo0aetn ocild aDumn snu4aleomrciodopDranvi t  etoir nudop emivsls)arumxmont0opt  oeiyt mDuanmsnt0 etnxf ia1fptelnvi t0 exo(mpoo4lpenlivi t arur(mpou1tlto i3iyd s2umnmo;t4tlermf3oy1oatrau ils)srtr(m3oo4apt  fes sfsrua(rp;t1tet mfctldls2rmnmp u0aleoxr oatlatr uvils)s2xmio3io1ll elietls) Dtrum ;u1oeto ieiatfm2rm( pnt) lxoif3ia1lateluesls0srtr(m3iu1opt liet ( a2rr( p;u4alt  fciytls2rlnms;t4 rtnir3io1fm   nesl() 2urxr iu4llte fvt sf 2uax p;u0apxoifetas s2umn s u4 rtrxo todomD  i s;(0truoiopnodale mnet () Dtrum no0tpt ii3ildfs2eanmpn(0 lenmo3iadfmt an slt0 euoiopiu1om e fviltf Duaum no0apx  oeiadfm2rm(mp t)tlxnif3ta1faDrau s s0s2urim3nu1op emncsas  2tm(r nt4ape mfetasfsDul( o u0trxrmr3ia1fmDr nvsl( t2tmim iy1ame lnctls) 2taum oo4ape  ieils m uanms;u4arxoifcoy1fmt  n s t0 2toirpio4om n fcia()artrumono1tle  f3iltfa2umnmp;t) rerir3oy1om e nvs;s0s2xmio oo4amenlfesl( srtm(mpot0ale mo3tldfmDel(mo;t4 lxrxo oo1fmt aneils  rum(r no1lptn fciatfa2rm(rooo1tlxnmfetldfsDum(mpnt)tltomocty1lpt lu s t  2xoxo iy1ol nmnetlt srumxrooo4optniocilslsDrauvp u0aexrmocoa1opt au o;s  ruoxm3io1omt  ivsatfsruaurpno0tlenioctasls uauvonu0arerxo totfaDe n s;s trum(r3nodlltemivsa( s2rrumpou0oee  ociadls ua( s (4texrir tydlm   ueo s srumxm nodop emivtls sDuaxrp;o4tpeo o3ilsla elnvsnt0 ltoif oatfmDrauei s) 2ur(r3ny4lmee nes t  Duau ono4oexnmfciytfm ranms () leomf oa1laDr neslt)srxm(opno4lm   fvi tf Durxm nt1apeoii3iltla2rluvp;t4treomfciatomD  n s ()s2um(opnudam nmfeta()srtr(m ;u0aexo icild a2ul(mont0tltoif3ty1lpDr ies;s  2tm(o3oudlmenlfcta( artaur ;o1apt ifeiasfm raums;()texrio3ty1lmDeauvol(  etoxopoy1ope lfctat  Drm(rpoo1tpxomi3iyslm2emnmp ()artoif oatop   nvi t)trtmir3nu1lmen nes ( artrurpnt1texnifeils a2em(mon(4aexrif oadlm ean i ()t2to(o3oydlpeemfcil()s2tmxm ;o4oltomoctas m ranvpnu4 rtoio iatlptraues;()teumio no4ole mnctl(faDtr(r nu1oeto ociytlsDemn o;t0 rxnxr3iytfpD  iei;(  eum(r3oo1llenmnctls)srrmx  ;o1aeeo i3iaslsDuluvs;(0 ltnxo3tadfaDeau il()sexrxr3oy4am elivsltfsDrru oou0aeto o3tlsla emu sn(4aetrxr3oy1lmte iei s srxo(o3no4alt  ietlsfa2tr(m ;t4alxnmfcilsfaDeau p ()altomrctytlmDelivo;t  etrxr3ny4lptn ietls)s2tau  ot0aeeomo3ils aDemn s ()trxrmo3ia1fmtr i o t sexrim3oydop elict t) Durx  ou1tpt ioeiaslsDemuvo u) rxoif3iadomDe neo (0s2urxo ny1opeelfeia()aruaumpoo0apeomo3tyd m el(ms u4artnxrcio1fmt auvilt0 2xo(r oudom  licias s2uax oot0aeeo i3tldfaDemu on(0trtoif iatlm e nvol()teumxm nydapen fesat) rrr(r nt4oetnmf3iadlmDeluvs u4 exrxf oodlmtrln ol()texrirpno1omenlfes ( srrm(  no1tetnioetlsfs rluvs;t4texomr ta1fpDr ueo t)srxo(m oodopeelfct t sDua(rooo4tpenii3iytlmDea(vsn() rtnif3io1faDeliei s)t2uoio3iy4al nmfetl()srrrxm ;u0opeo fciytla ul( o;(4 exnxf3tadlm e n ols0 exriopou4lle mfes s)aruaurono1opxoioctasfa2raums u0texnmfcoydfptraueo s s2uoxmpny4alte nesl()aDuaxrpot4alxn ieildfs rm( s t)aetrir iy1la  ai o (  exmxrpou4om e netas s2rmu o;t0olxoif3ils sDean o t0 rtrio3iadlaD  ivi s tetm(r3iu1lptemicia()s2tr(rono1optnmoetasla2emnms u)alxrxr3iydoateauvsls0sruo(mpoy4lme mneta(fsrtm(mooo1aet iieiytfa2el( s (4 reoio3iydopt  iesls)s2xm(o3ou1aptn fci ( a2tmxr nu4tpxomfciydfaDel(ms (4tlerxocoo1lmte ueilt  euo(opio1oltnlfvs sf 2tr( pou4olxnmf3iysla2rl(vsnt0 reoxfciytopt luei;s s2umio3nodlmtemici t  2tmxm ;o4apen oetlsfm uanmsnt4trtrmfcia1lat lnvo s t2xmirpio1om nlictlt) Dumxr ;u4tpx mi3tadfs2ranvont)altomo3iodfaD  nvolt) 2ur(r3oy4omee netat sDrr(mpoo1tet mfeiadfm rluvs;(0tlenif3ootlpDr iei;t0 rtrir iy1olenmivtltf Drrum ou4tpxo o3iyd mDrl( onu0altoiociy1lm e ivs;s seuoiopio1llt mfetlsfs2uauroot0oee mictldla2el(vs u0aexrxf3oy1oateli o;t0teto(m ny4op   fesa()srururpnu1olx iieiasfa2ea(ms;u4areoxo3todfmt ln i;s) eum(rpoo4ol elnes ()srrmuronu1olxnmi3tyd m2eanvp;u0 etnmr oo1opD  u s;s0srtoimpiu1olee ivsls)s2trxmoot1aet  feils aDraums t4 rxrio3iy1opDeaieol(0 2toir iy4lpeelieta()aDra(mo;t0apt mi3iatfs uanmp;t4 etomo ta1fpDr neolt0s2xmimpiy1ol nlfviatfs2trx  ;u0aee mo3iatls2rl(vsnu4 rtoif3io1fat lnei;t  exmxr nudop  mfci s arumumpno4oleoifcilslsDemn pnt)arxnxf iydfmt luvs t) exo(rpiu4lpeemnes ( a2rrurpno0alt mieiatfaDrln s;t)arerxf iadoptr i s (0teum(o3oodap   ncsat)a2urxm no1tpxnmoeiysfaDeauvon() ltrmo3iodlaDeluvs t s2to(m iy1apt  ivil(  rumx  no0oet  i3tyd s2umu p;u0trxomr tytoa raneilt)trxmir3nydol  mnet t)aDuru  ;u1aex if3iad sDum( p;u0aexrxrciy1lmt au i s sexmxrpny4op n fcil( s2tmxrpnu0aeeo oeiysfaDumuvp;u4teenmf3oo1opD lueslt)s2urimpio1apen ivi sf rtm(mpnt1aee ifeiat sDuluvont4alenmf oytoa eai o t  exmir3iy4ap   netasfs2ur(rp;o4tlxnifciasla2em(vs u0 etnif ootlmDelivs;s0setr(r3iu1optnmnetasfsDtrxr ;t4altn feiytfm2rln pn(0aetrmr iydoptelnei;( sruoim3iudlle  fviatf 2truront4optoiiciatfs2rm(vo t)aexoxf iytfm  aieslt0trtoxm3io4llee neils)arum(mpou4aexoif3ilslsDumnvs t)trxnmo to1omD  n i (  eur(r nydaltnmieiat) rrru oou4aet mfciadfsDumu onu4 etnmf iadom eauvo;(  2xm(mpny1lp nmfcsl(f 2ta(rp;o4apeomi3iadfmDra(mp (4 lerxr oydopD  nei;(0 etm(opoy1lme mivta( aDtmurp;t0apx iociydfa2ea(mp;(0arxomr3iydlatr uvo ()teto(m iu1alt livi t  rra(m ;u4apxnmi3iadfm emu p;t0artnmocoodfmD aueo;t  2toxr oy1lpen ictasf Dur(r ;o1tle ii3iytlm2ranmo u4tlxnxr iadfmt luvo;t)tetmxr3oodlptemicta(  2rau ont0aee iociydls2umu pn() exnmf io1oaD au o ()sexoiopiy4opt lfviat)arrm(  ot4oexnmf3tldlaDumuvs;u) ltrxo3ootoatraivi s0 etmxrpnu1am  lnet s sDrr(rono4olxn iciyd a2rlu o u4tetnmr iytfmDeanvo s s2xoim3io1amenmiet ()artr(moot4opt iiciasfa ean p (0trtrmrciadoaD aueslt tetrimpiudlptn icil()sDtaum ou4opxoio3iytls rmuvon() reriocoatla r iei s) rurirpio1ll elfvt (f 2tm(r ;u0tlx mf3ils a2ean s;()tlxrio3oo1lpDrauvo ( t2xr(o io1lmtelfvtlt  Drmu o;t0tetn i3iytfs2el(vs;(4aexrif ta1oa eai o t) eurim3oydlmenlivsls aDua(rpou1tpxnifciyslm emu pnt4tlenxfcia1opt  ues;s) rxmxm oydomenlicsa( a2ua(r ;t1alxomi3tatla2emu pnt)alxnxf3iatfmD  i sls0t2tm(o3oo1al e ncs t a2ur(mpot4tetomf3ilt a2ra(vsn(4alenxf ta1latelueo;t0seurimpoo4aptn iesl( srumurpnu4texnmfctas s2ra( p;u0tetoxr oodlm  lnes;t  exrxr no1lmen ics s) Drauront0tpx iieilslsDeauvp;t0 rxoif3iy1late i ols)s2xmimpou4lm e ieia() Dur(ro;t4aeeomf3ildlaDuaumpn(4areoxociy1optelueo;t0 rurim3io1ap emicsas  2tr(  nu4oetn ociat sDrluvon(0 eeoircio1fm r ivs;s srxo(o nudlp nmfvia(fa2raxmoou1aeeomfeiyslm2umu snu0artrio3ia1fa ran i;s)trxrxo3no1omeemfvtl(fsDrruro;t1oet io3iydfm umnvpnt0tlenir oadlmtrluei t)tetmxo nydome  ivi ( a2umu  ;u0tet mictasla emu o u4tetrxocta1op eanesl( s2toir iudom n icilt)a2umurp;u4oexo feiadlm rmnvp;t0 lenmr oo1fp e i o;s t2xoir nudop elnci s) 2trx  ou1olxo iciysfaDul( ont0trtnmr3iydop r uvols)srxrimpoy1amen ivias srumur ot1apeoiictadlm2rmuvs;(4tlxrmr tadlpt li olt texoio iodlptn feilt srrmump;u4tptomociasfa2um( s;u)trxoir oodoa rlnvils0t2toxo3ou4lpt  fvt t  2um(rp;u4olen octat sDranvs;t)aexnmf tadoatean olt)t2um(m3nudlle mivil(farta(r ;u0tpenmi3tys mDrm(mo (4tleomrcootomD li slt)tetrxo io4lltnlivi (f rra(  nt1apx  oeildla umnvp u0tlxrmrctadfa eauei ( sruoir iu1lmeemnvi ()arua(rpou4oet iictatlm2ra(vo u4areoif3oadfp  lnvslt) rxoio oo1al n neiatfaDta( p;o4alxn ociytfsDumnms;(0trxrxocoo1la ranei t s2umxo nodllenmivtatfsDtmx o;t4tltniietaslmDean o;t0teenmf3oatoatrli s;t0s2xoir3iu1lp n fesasf Dtauro;t4aetn f3iyt s2em(mo t4tltnir ootlp  livo s)s2xmxopou4amtn fei tf rumumpno1tpeoifeiytfa2ulums u4 lxoxo iydlate uvslt0srxr(r iudape licta( aruaurpnu1alenii3iydls rau p t0 lxrir iytlmtr neols0 etrimpnu1opeemneilsf Dra(m ;o1alx io3iad m2rluvp t)aeenif oy1fa eaivsl( sexm(o3nu1al nlfvs ()srum(root4olt miciytfaDra(mpn(0arxnmo oatlp  ai o;t0 etr(r3oudop  lnvi tfsDuaxro;u0oexoifeiltlm2um(ms u0 reoir oatfpteau il(0sruoxr3iudol  lnet tf ruax pou4tltomfctls m ean sn(4tleomo3io1op rlnei;t s2uoxm3iy4apen ieta( arur(  ;t1tptnioctld s2ra(mon(4aeeoxr3to1faD  n o ()teur(o3iu1lm elfcil( srtaxrpnt1oexniictadlm2em(msnt4alermo ootop raivi;()tetr(o3iu1open icia( aDtaump;o0tet  fctadlmDeanvs;t4areoxf iatfaD  nes (0trxmimpio4lp e neiat) 2rmxmpnu0tetoiieils a um(vo t4aetrir3ta1lmtr nvslt srumim3ou1lm  lfci s  Dumu o;o4apto oeiadlm umuvs t)teenmoctydlm eaieo ( trxrxr3nu1llenlnvtlt)srtrxm ;u1olxnio3tyd sDum(mp;t4 lxoxf3tatlmteai i t0t2toxmpiy4openlnvsa(fa2urum nu1oex iociytfsDrmnmp;t4trxnmr iatfaD anvs (0tetmxr io4al  mict t s2uauro;o0alt mieias m ranvpnu0 exrxr3tadfp eauvo;t0s2tmxo3ny1am  lfeta(f 2tr( p;t0tlxoii3tydlm rauvo t0artnxo3tytfp e nvs ()t2toxopiy4am   ieslt a2umuro;u1altnmfctydfm ea( sn(0trxoircta1opD  nes;t t2xm(o3iu4oleelfeiasfs2ta(r ;t4opeo fetyd m eauvonu0trtoxf oodoa  an ils)setmxo3oy4am   nctasfarta(  ;t4tetoiieiyd sDrl(vs ()tetnmrcty1latraivo (  etm(r oodllen ies (  2rr(mpou0oexnmiciadfa ra(vo;t)trtrmf3tadfpt aueo s  rumxr iydllt  ieil()s2rrxmpou1aeeo feiltls2rm(vo u0trtoxo todfat  i i;t t2xmir3no1olee feta(f 2ururoou4texn ietlsfaDemn p;(0 exnmo iadomtraivi;s0 2um(mpiy1alen ietl( a2rmxm ;u1tetoifciad m2ua( s;t4 eenif totomteai i;()t2xm(r3oy1lptnlfciltfs2tau ooo1aeto fciyd a2rluvsnt0 exrmrcoydomDeaieolt sexrxrpiydaltn fvi sfaDumum ;u0oet mocilt mDumn s u)tlxrmo totoa e uvi t0 rxo(m3nodoptnmiei (fs2um(rpoo4ole iicildfs2rluvs;(0aetrxr3io1op  luvi t) rtrxm iy1op  lfcsl(  2raxmpnt0tee miciadla em(vs;t)areoxf oatoaD  nes s  2umxmpno1amtelicsl( aDtrum ;t4tpeomieiasfaDrmn s t0trxoif iytfate i s;t  eumimpoo4lpen fvtas)sDtaxm nu4texoioctatlm2eanvs u0alxoif3iodomteln o;t0seum(mpnudopen fcsas)aruau  ot1oexnio3iltfmDuanmo t)alenxfcty1fp ean s;(0seurio oo1ll nmfcs tfsDrm(rpou4tetniiciyd s2emu on(0artomf3io1oat auvil(0t2umxr ou1amen fvil(fsrurxmoot4openmociydfs2eln o u4artrmr3oydlpDr ivo;s0 eumxm ou4ole lnciat)sDtmumoot0oexnii3ildlsDrlnvsnu)tlxrmr3iy1fptean o ()trtrxo iodlpen ivt s aDraur oo0optomi3tldls2ran o;t)altnmo3totfmDe u o t)t2umxo3no4optnlnvia()sDumx ooo4texnmoctldfaDul( snt4 rtrio tadopte ueo t trxrim iu4omtelncil(fsDum(mp;t0teto fctaslaDea( s () ltrmociodoaDranvo t)truriopno4lpeemnei t s2rmur ;t0opxnifctys s2eanmo;(0texoio3iodomtelnvi;s)t2xoxopno4ape mncsa()sDtru ono0alxnmfeiyd m rm(mp u4texnir io1fmD ai s s  eumirpny4alee nctat  Dumx pou0oeeomf3ils a um(vs t) lerxocio1om  aneo;s  2uo(r iu4omtelict sfsruaxmo;o0aexnmi3tysfa ean o;()teerif3iodlmteluvo ()seuoxopny4amt  nvta( artaxmont0aptomo3iysfs2ul( p;t0trxrxr3oodla elnvi t)trumxopnu1oltnliei (fartax o;t1aeto feiltfsDea(mp u4texnircoadoaDr ieil( s2toimpio1lm elici s srta(m ou0apxnmi3ilsfa2eln o t)artoif3iatla   nei t) rumxm3oy4optnmnvsa(  Drax  nu4teeomi3ilsfsDrm( onu4arxoxo3todfpDeau i;t)t2tmxo oo4lptnmicil() Dtaurp;t1altomoctyt aDemn p;(4 leoxo3iytop eln i s s2xo(o3nydlpenmics t a2rrx pnt4ole ifeiatla2uluvo (4aetrif3oadfmD anes;(0 exoir iy1ol n neiasfsrraumpno1aleniieiys m2ea(vs;()aetomfcoadopt anei;s0t2xr(m3iydol nlietat) 2uax pou0texnio3iatla em(vs;()trxrxf3iotlp r uvo;s)s2xrir3oy1op emnviatf rumur nu0aee  fcilsfs2eau s;t)altnxociydfp   nvsls0s2urim io1apeelfeta() rurum ;o1apeoifetyd s rl( onu0 ltrmociadomDeli i (0 etriopnydll nlivtas)srtmxmp;t0tlto ieiatfs2ran o ()arenio ia1omt aiei;(0trum(m3nudameelnvias srur( pnu1altnmieildlaDua(vs;u4aexomr oatfa rli i;s0t2toio3nydomt lnvtat)a2umumo;t1tle mieiatfmDrm(mp;u4 rxomo iatlaDrlivi;s)tetoio3nudomte icsl()srrmu pot1tlxoii3iaslsDea( snt) etoifcootop  li s t) 2uo(r3oodope mietl( aDua(mpno4altn feiydlm rlnvo;u0aexnio oadlp e n o;t t2umim3oy1ol elfetas) Dtaxr ;o1tpt  ieild s eauvsnt4aexoxo oytlat anvo;(  2uo(o3iu4lltn ivi s) Dtaxr ;o4opx mf3tatlaDulnvo u4tlxnxfcoodfmtr ueo;() etrxm3nudolee ncsas srua(m oo4tpeoiieiadla umnvsnu)teeniocia1la raneo;t)trxoxm3iy4om  lfvsat sDrru pou4apenmi3iaslm2emnvs t0arxnmfcta1omDr n olt  2umxrpnu4olee fciltfa2tm(  nt4aptoifciadfa2umu on()artnircoodfa eai s s0 2tr(o3oydol  lnvtat)s2ta(rpno0opt mfciys sDrlnvp t4tlenxr3iytomtelivi;t) rxmxrpiydll nmivta()sDur(mono4opeoiieiyt a2el( s;u4aleoxfctytoaD  uvs t) 2tr(o3iudlm elies s a2tmx  no0tpe mociysls2um(vs t0aetrxr3iatomt lies;(0 2tm(o oy4ll emfvta()s2taurpoo4aeeomoctldlmDeanmo u) etnif ty1lmtr neo;s  rxmxmpoo1op nmics (fsDum(mpnu0aex mfciysfa2rau s;u4tlenxr3iotfatr ieslt)setrxr3nydale  netasf rrm(rooo1opeo feiyt sDuluvp;t)aexrif3oadfatran ols)teurxr3nudoltn ncsa()srrrxr ot1olxomi3tlsls2uaumpnu4trtrxr totop rlneol(0t2xr(rpnu4ole lietat  Duax  oo4oee  i3iytfm2rau o;t4tlxoxr oatlaD lnvs t)sexrxr3io4ll nmicslt)aDta(mo;o0aeen ociytfm2umuvo t4alermr3oy1opte nesls srurim3iy4aptnliei ( arta(r ;t1opeo octlsfa rlumsn()tltrxr3todlm elneslt0 rxrim3nodlpt  fcilt)aruaumoot4oet ioeiadla ul(vsn(0trxnir3iydlp eaues t) 2toir3ny4opt micsa(  2tm( ono1tlx  i3iydlmDrluvs t0 exoxr3tytomDe ivi;t)t2urxr3iu4lpenmfcsls  2ur(rp;t4tpe  feiysfm eau s;t) lenif3oa1lp r n o t  2toxopio1optnlietat)srurxro;o4opx  ieiaslm2emu o;t4alxnxf io1oaDe i slt) rto(m nudopen ietas a2urxrp;u0ape  f3iatfa2umump t4 eeoif3iy1fpDraivs (0texoxopny1olt lnvtat srrm(  ;o0tptniieilsfm eau p (4altnxo totlp e n i (0 euoiopnydope  fesltf Drru  ot0aet mfeiat s ua(mp;t)areomo3iadopDr nei;s)trxoxm iu4lm n nvsa()a2uau p;t1teenmiciltls2elnms;t4tleoxr3oodopD aneolt) etmimpiy4am e ivia() rrrx o;u1oltnmfciyslsDrlnvpnt) lxnxo tatoat anei (0srtm(o ny4omtnlfetatfsDuaxroot0tlxomieiaslaDra(mo;(0arerxoctatfpDeau olt)seum(r ny1oleemncta( s2rmurp;t4tetomoeiadfm2rmu p;t)texrmf ty1lm  lues s  etr(r iy4op e nvias)artmumpoo4altoif3iatfs2ulnmp (0alxrifciadlp   ivsls trtrxo oodoleemfviat) 2uaxroou0olto ieias m2ea(vont4tetrxocty1laDrlneol(  rur(o3iydlpt mfvta()a2rr( ooo0ape ioeiyd m2elumo t4tetrxo3ootopt ln i (0trumxo ou1ap nlnci tfaDrau pnt4oleoifciysla2eanmo (0teermf iodlpDeanvi (0 rtrir3nu4al  lfvi ( artmxr nt4tpt  fciyt s2ran p (4tltnxo todlaDrau i t)s2tm(r nu1op nmfvt sf Dtm(rp;t4opxnifctydls umuvp u)aeeoxo3totoatr neol( t2umxm3no4om nmfvsatfs2rax  no0tlx iieiydls2eauvo;(0 exrxrciodopDr n i s0 ruoio3ou1lptelfct s) Durxmpno0tlxnmictydfsDelnmo;u4trtoir iy1lm  au o;(  eto(r io1op elfcil(faDraxr oo0apx  ieiyt a eln s;t4 etnif3tatfptrlues;()sexo(m nudalenlietas)aDtax  nt0opeoio3tldfm2rmuvs;u4texrifcoo1optrli ils srumxrpou1lptn fci ()sDtr(m nu1opeoiictlt m2uauvon(4 lenxf oo1op r u ils0 rto(r oodope  fctlt  2ra(mpou1oet moctld mDeanmonu0alenxo3todlpDe nes;()s2toiopiu4optnlfcsl(fa2rrx o;t4aeeo fctyd s2ran on() rxnircoodoaD au i t)trtmiopoydll elfesa(fa2uaxrp;t1olxoioeildlaDrl(mo (0tltrmo3oodopt anes;t s2umxo3oy1lpee ies s)a2urxmpnt0tpeoio3iyt mDrmnms u0trxrmrciodomtrluvs;(  rurxo iu4om   fes s) rum(roou0olx mi3tldfs ulnms (0 ltoio iydfa rlieil(0texriopoydal emfcsl()artm(  nu1tpt io3iadls2raump t)trenmocta1lmDeln olt0 rumiopoudlpeelncsat a2ra(m ;t1opx ioeiasfm ranvpn() reoifciy1fpteaivil()t2tmio3oy1llt  ics t artaxmoou1aexniieiydls2uan sn(4aexrio3oydlpD  nvo;t teumim nydom n nct t)sDumu  ;o4aet io3iadla2elumont0 renxf3tatfat  ueo s)teuriopiodlle  fvsltf Dtm(ro;u4texnmi3iydlaDuln o (0aexrxo iodlm   u i;s0s2toio iodop nmnvsat aDum(m nt1oexnmf3tltfm2ean o u)alxoircoytfp raivo s0 2urir iudlptnmfeils) 2tmumonu0aleo icild m2rluvpn(0aleoif oadlmDr nvslt trtoir3oy4ol  lnvs t)sDur(mp;t4tpxnmo3tysfm2em( on(0trermoctodopD aneo (0texo(opio1ll nlivtatfaDum(m nu4aeen ieilsfm2ea(vsn()tlxoxf iydlpD auvi ()s2xr(o3nu1lle lfvil(faDrm(mpoo4oeto i3ildfs raumo t0 etniociodlatr nvs;()sexmio no1omte ivta( sDrrxm no0texn fetyt m2ua(vo;u0 rxoir3iatlpD aieils t2uoirpiu1alenmfvtlt) rrrumpnu4tpe mietlt aDumn o;u)aeeomrciytlmte i s s)s2trio3no1am   nvt s)a2uax o;o1tpxnmf3iad aDeluvp t4 rxomo3oytlptr uvils s2urim3io4ap nlies s) 2rm(m ;o0altomiciatfs2eau p;t0altrxrctydfm rlnvs (0t2xm(r no1lp nlnvsatf Durumpnt0oeeomoetys m2eluvonu)aetomocto1lm rlnvils) 2um(r3iy1ome  nesa(  rta(  ot0aexomfciyt mDrl(ms;t4 etoxoctodfpDelnvsls0 rxrir oydop  lfeil()aDtaxro;o1ape mf3tls s2rmuvs u)aexrxrciytfm rlivs s0srtoim3oy1opte fcias arrax onu1tlxnioeilsfs2uluvp t)tlxomfcoo1omtr ueilt0 exoim iydaptelicslt aruaumo;o4aex micilsla ea(mp t4tltrircio1fmD lies t0 eumxo iu1omt lnei s aDtrx  no4oexo f3iltla elumsn(4alxrio iy1faD anes ( s2xoim3iy1apenmnes ( a2rrxmono4oeeo fetyt s ea( pnu0aetnirciadfaDelies t)texmxm3ny1ap e ietlt srrm( pnu0tpxnmi3iltlmDeln pnu0alxniocoadfp eli s t0texoxopoy1lpe  nvsa( aDraxrp;t4optomocils s rau p t) eenxf todfpDelnvsl(0t2tm(m iydop  lnvsa(f Dtax  ;o0aexnifctyslm ua(vp;u4 lxnif3ta1laDrli ol( teuoxo3ny1apenlnct (fa2uauroou4apx mo3ils a2rmnvp;u4aetoxo3iadlaDeauei;t0truoxm3io4ol   nvi ( artrur no1ape if3iytlsDel(mp u) exrir3tadlaD  nvils  rtmirpio1alenmncslsfs2trx pou1aleo ieiltls2ra( pn()tltomrcootfate ueo;s0truriopoy4om emnetl(fsDtaxmont4tet ifctysfaDemumpn()altoxrcoo1faDelnvilt s2xo(o3iudol   ict (  2urxr oo4tptoiiciatlm2rlu p;t0aeenif iytoptr n slt t2tmio nu1lp nmfcs sfsDtr( poo1opxomicilsfs2umump;t)trxrircia1lpD aivi;s0t2tmim3oudop elfvi ()sDra(m no0olxo ieiat sDuluvp;t0trtnxf3iy1fm  au o;s0srxmiopoo4lmtnmfet t)arurx  nt4ale mo3tytls umuvsn(4 leoiociytfate uvs;s t2umxm oodlp nlivt tfaDrr( ont0optomf3tadfa2uluvsnu) ltnmf oytlmDe u s t0trxo(opiydoleelfei () 2tmur oo4apto ociatfa umnvp u4texrmf3iytlaD  n i t0 eurir oodlp  lfvsas)a2rr(r ot4openioeiatfsDrlump;(0artrmf3oadopDrlu ilt srto(m3ou1al n ictl( arra(ro;o1tlt moctadfm rln o ()aeerxoctodlptr nvils texmxo iu1op elnci ()sDtaur nt0oet mfetydla emnvpn()trermfcootlmteau ol()s2tm(m3io1al n icilsf Dtm( o;t0tetoio3iat a emn onu0texrxo3tatfa eaueo;()trxoimpou1ll e fei tfaDum(  nt4oeeoio3iydfsDrlump;u) ltnxo3oy1lmDeanvo;s0setoir3ou1ope  ies s) Dtax  oo1apx ioeiaslm um( ont)trxrmr oo1opDran s s srtrir3oy1om nmnviat  rrrx p;t0ole moeiatfaDeauvp (0trxnmfciotfpDelieil()s2xoxm oo1lm e neslt  Dtr(  no4oexn fctyd m2umuvp u0aleoir3io1op r neslt0srtoio oo4optelivslt sDur(mpno4tle mieias a2um(msnt)texnif oadlpt luvsls0 2xo(r no4lm nmnviltf rta(rooo4openifeiasla2ulu o;u4trtnmo oo1fmt  uvo s  rxoimpnydam emnesltfsDuax  ;o1tlt mieils m2ulnvs (4 lxrircoodom rai sl( teumir io1amteliesl( aDtr(rpou4tlxomo3iad m2ua( pn()arxnmfctodfm   ueslt sexo(r3io1ll nliesa( artm(roou0olenii3tls a rlnvp;t4 rxrxfcoa1omD aieo s) eumxrpio4ap  lnes s s2rr( p;o1opt io3iad a rm( s;()aetrir iy1lat lueo;t  rtoirpiy1lpe  ivs (  rur(r nu1tle  fcildfs2rmnvs;(0 lenif ootlp rluei t)teto(o3nu1alee nvsa( arurxm ;o4optoio3iadls umnvs (0alxnmo3tatfp r ivo;()trtmxm3oy4am e ncilsfaDtrxrpou1tlxomociys mDemums;t)arxoir oydlpt lneo;( s2urir3oo1altelncsa( aruaxmooo0apxomfciadls2eauvo u)texoio3iotla rlivo;t0 etmxmpiu1aleelnctatfsDrrum nu1tpen o3iadlm eau pn()alxrifcoydfa e ivi t  2toir3nu1apen ici t  Dumxmoou4tetomocias s rau p;u) rxnmr3totoa  lnvilt) 2urxm iodal elfes (fa2tm(mpnu0alen iciad m rmnms u) reoio3oo1fa rai s;s) rtoimpiy4ol n fcil()srtau  nt0tex  oeilt s eln on(0 rtrio3tadom raieolt)sexrir io1ap   ivsatfs2trxronu4opt  iciaslaDuauvp;(0artnio oa1lpte nvo ( s2xoxopnydalt  ncilsfs2urxmpno0oeeniiciad m eln s (4treomocoo1late u o (0 2uoxrpnudamee fvtas)srrmxm nu4opto f3iadfm eluvp u0 rerxr3oa1fpD lu i;(0tetrim oudole  fvi ( arra(mpnt1aeenio3ilsfs ea( onu)aetnxf3tatoa   ivilt sexo(mpiu1apen ncils  2uaxrpot0tpe  f3iyt a ulnmsnt)trxoiociodomt anvi s s2tm(o oydllt mfeia( a2ua(m ;u4aetoii3tysfm2raums;t0tetnxfctatomt lu s;(0s2urxo3oo1lm  mictls sDrm(r no4tleomictatls el(mp;t4trxrxociydopDe ivo s0trum(o3iy4lpen icia(f 2uaxr nu1optnmfciysls2ea( p;(4 reriocoydfmtrauvs;s)srumxo3oy4lme mfvt t)sDtr(ro;o1apt moetad a2ea( s u4tetnmo3io1fmDe uvs;s  eurxm oo1op  lfcs ( srrmx pou4opxoiicilslaDemn s u) rtnxrcoydoa   u i s0srurio io1lme mivt () 2ua( pot0tptn fctaslmDelnvp t0alxrxo3iodfa  lu i ()tetrxm iudal  lneia( a2umx oot4aetnmictys a rmu o t4 lenirciytoaDeli s (0srxmir3iydlmeelfvta() 2rrum ou1tet  fetadlm2emu o t4alenxf3oo1fmtrlueo;t)tetmxopnu4om nmiei s a2rru ont4tlxniocias s emums;(0trxnmrciadlmD luvi s sexr(r3iudlpenmnei s aDuaur ot1alenmi3tyslmDem( s u0tltoirctotfaDr i sls  rtoio no1lmtelneta(  2truronu1tpenmietltfa eanvont)teeoif3tydfmt  ueols0sruo(m3ny1apen iei t)srra( o;o4tpe  icildlaDulnms t) lenmr iydomDeli o;s)sruo(rpny1omeelnvt s)a2trx p;u1aee ii3ild m2em( p;u4 etrmo tatfpDe neol( seumiopiydal  mncias) 2tm(  ot1tltomfetytls2rm(mo;(0treoxf ta1opDrauvs;t s2um(r3ny1llenlfvsl()sDtmuro;u1tpxoif3tlt m rlnvont0artnmo3totlm rli o;s  2xmxr ou1lp emfesls  2tmxm ot1oex mfciydls ran o u0tlxrxf oadfpD ln s t0 exoio oy4lme lfei t  2rauroou1opeoioetas sDeanmp;u)aetomf3tydop rluvs t0s2to(mpiy1ame  ncsa() 2tr( ont0ope moeils sDulu snu4trxnir3iydla  auei;s)s2xoxmpoy1lltnlfvt s  Duaxroot0apto oeiasla ul( p;()teermf oo1fm e nvil(0 eum(opoodap   iesat a2ra(rpnu0oexnmfeild aDul(ms;t0trtrmrcoo1oaD lu ol( srtrimpiy4am nmfvtatf Dtr(m nu0tle  oeildls2ulumpn() rxnmr3oy1oa  aivs (  2xmio3io4lpee iet ( sruaum nt1tet mfetatlm elnmo u4aetoxr3iy1lm rlu slt srtriopiu4ape lfcslt s2rauro;t4aetnifciltlmDulnvs (0texomr3iodfaDrln i;t0srxm(o oodlle lfvtatf 2rrumooo4olx ioctatlm2uauvsnu)texomo3iy1la elivs;s0 2trxm3oy4lm e fvtls a2tr(rpnt1tee  fciatfm umnvo;u)alxoif3iy1omDeaieilt0 eurxrpny1olee ncs sfa2trxro;u4apx micilsfa em(mo (0 ltrmfcia1fptr u i;t)tetmxmpny4lpe mfeia()artmumo;o1aeenmo3tasfa2rlump;()altomr3oo1fatrau slt0teum(m3iy4apee fvtl( sruaum oo0ale ioctyslsDulnvonu4aetrxoctytfpDe iei s t2xr(opiy1lpenlies s  rtr(rpoo1tlx mf3iydlmDel( snu) exnxo io1lp rlivo (0 rxmxopio4amt mict (  rrmurpnt1tle moctytla2ul(ms u)arenxf3ty1op  au s;(0 rxrxrpiy1omtnmfcsls srra(mp;o0oexoio3tat mDua(mp t) rtnxo oadlpt lieols  rxm(m3iu4omtnmfvtls a2rr(rpoo0alx  f3ildfsDraumpn(0 etoxo iotom r nvi;t  exrxr nudol   fetl(  rra( ono0aeenmfeildlsDulnvs;u4tltrio tytlp raueilt  2tm(r3oudopeelfesls aruax poo4ale mf3iasls ranmo;t4 lxrif ty1fatrauei s0 euoxrpiy1llee ivs tfs2tmxronu1alt  o3iaslm2em(vsn()tlenio iotfaD  i o;s0 exmxo3oy4alte nciat a2umx ont0ale iietatls umnmo t0treoir3oadfmt  ivs t0s2xr(mpiu1optelicslt  Dumxroou1aetn feiadla2umump u4 rtnircia1fa e nvo;t0texoim3oo1lp emfvias) 2rmx pot0olxoif3iltfs umn ont) lxrifctadlp   ieilt0texrxmpoo1optnlfctlt sDuru ono0aptnmo3ilslaDrmnmp (0 rerio todfatrln sl(0t2xoxm3iu1om   ieta(fsrta(ro;t1texoifetasfm2ua( p;()tlxrmo3oatlaDelues;t0 rum(rpiu4lleemfet (f Duru onu0tetoiociad sDumnmpn()trxnmfcoy1fmD li sls) exr(m no4omt lnctl() rtau p;u1aetnmietydfs ranmo ()tlxrxr iadopt anvsls0 ruoxmpnu4lleemnetas)srurx  ;u1oet io3tadfm2uan o u)aexrmf3iy1oa  lu o (0texrxo nydale mieiltfsDrrx  no4oetomi3tltfaDra(mo (4 etrxr3iatfmDelivo;s srur(rpiy4om emncta(f rtr(r no0tetoifciaslsDumnvs (0artnmf oy1faDrln ilt)t2xmiopiodlmenmnvil()sDtaxmo;o4aptn o3tld s2ua(mo;u4 exrmfcoa1lpt lu o t0teuo(o3nu1lp nlfci () Duru ono4tltn fetysla2uauvpn()tleoxrcoytlpD ln s;()s2xoim oodaltn nvtat) Dtrum nu0apeo i3tasla2rlump;(4aexrifcoadlptr ivo t trtmxopny4ol nmnetltf 2umum nt1aexnmociltfs2em(ms;() ltrir oa1op eluvo (0srtmim3iu4apen fctat)a2uaxro;o1texo feiadfm2um( p t4alenmo3iotlpt anes;() eto(rpny1omtnmies s)artrxr nu0opx iieilsla2rl( snt) lxnmo3ta1opt  i s t0t2urxm3iu1apen ivi t) Durxrpnu4tlxomfeiadlsDemnmpnu0aexoxf tadfpt lies;s s2umxm nydap n fvs s)a2tmx oou4apeomiciydlm eluvo u4tetrxo iotfa e n sl( seum(mpou4ope miet s) rtau pot1apeomiciasfaDrl(mpn()teerircia1fatrau ilt)t2xo(r3iy4op  mivi t  Drrum ;t4oltnmf3iad a em(ms;(4 rxoxo totfmtrli s;s) rxoio iydaltnlfeiat)s2rax p;t0apto ieiltla2rmnvp u4tetniocoa1fatrlivi t) rxriopno4lm elnesl(faDumxr no0olxoifeiydfaDemuvo;() exnxoctatoa r ies;s teuoxm3oy4ame  ncs s a2uaxrpnu1tlxnmi3tls sDranvo u4 etnxo3todom  an o;()sexm(r iudlmenlici (  Duauroou0oeeomoetyt s2em(von(0trxoxr3ta1lmtrlu o;s0 rtoxrpno1am  mfetlt sDumxrpno0openiiciyd sDrluvp u4trtrmf todlaDeau o;s0srxmxr3iy4al  mncsa() rtmx  ;o0tlen iciad a2el( o (0trxnmfctotlpDr i i;s teto(rpoo4lle lfes t) Dtrx ont1tpe io3iadla2umnvp t0aexrxf3todfmDe u o t)setoxr3ny1llt lneilsf Draxroot0aleo fciadfs2el(von()arenio tytfp   i o;t)s2to(rpnudlpe mfvt sf rraumo;o0texoiicils aDrmu s (4alxnxrctotlmD anvsls  2xoio3ou1lp   ivil( aDur( pno4aet  oetlt a umn pnu)treomocio1fa r n o ()srurirpio4lm emictat)aDumxmoot1tpxnmoctyt m2rmn pnt)aeeomfciydopteli o;s  exrxrpou1lm e fvsasfarrm(rp;t1aptn ieiaslaDemuvo u4aetnxo3oy1oat lneo;t0srum(mpiu4altnlics (f Drrx o;u4aetniietydls2uan s;u0 rtoxf3oatoa raivilt  rtrxrpio4apeelivtl() rurumo;t1opxoiiciytfs ua( on(0texrxf io1fmtrau s () rum(o3oodll  mneslt)aDua( ono0olxn o3tat a2ra( o t0tlxnmoctotopDraiesls) 2xmxopnu4lpe  net s)sDrrxmont4tlt mociasls ulumsn(0 exrxr todoat  ivi t)srxoxopio1lpen nctlt a2umu ooo4apeomfciyd s ranmp t4texrif oadfmD lnei s texm(mpoo1lpeelfesasfaDrm(mpoo0tpx moeiadls emnvp t4 leomo tadfat liei;s)t2uo(o3nodamt lici sfsrtrum ot1opt ioeiasfa raump (4 eeoifciodoate u o;s)trxoim3oydamtn fvi sf Dua( p;o1aeto ieildfm ulump;u4aexnmf3iy1fpDe i slt  2uo(rpno4lme  nvtat a2umxmpot0olxnmf3ildfaDul(vo;u0arxniocoy1omt lueo t0t2uo(m3oodlm e neias aDtau  ;o0tltomfcias s ranvsnt4aexrxfcoy1laDrln sl(0 rtmxopio1ll e fes s) Dtmuro;o0altn o3iat mDelnmp t0 etnmo io1fp  livo ()trxrio oy1alee ivsasfa2tmxrooo4texo fcilsfaDra( o t)alxomf3tatomDelivi t)tetoim ou4altnlnvt tfsruax  nt1opto f3tadls uau sn(4 exnmf iy1la  luesls)trxoir3nu4apee ieilt)srtax pot0optoii3ils a2umnvo;u0tetnmo3totoaD  n s s0s2xrxopoo1llen ietls)arrru  ;o0tex  ieilsfs um(msn(0 lenio tytfp elnvi (0tetoim3oo1amteliei tf rtm(rpoo4opx io3iytlsDumump;t)artrxrciatfaD livs;s0setr(m ou1amtnmnvta(fartmxm ou4olxomfctaslmDean o;t0 lermfcty1fa e ies ()sexo(o3oy4llenmivslt) rumur ou0olenmo3tys m umump (4alxnmr3oytoptr i ols0sexm(m iu4omeelfvsat) Draxmp;o1alenif3iys aDrlumonu4texrmo todoaDr ieo;() euoio iy1omte nvta(  2ta(rono0teen ieiysls2rauvo;t0texnxf3ty1fmDrli i;t0s2xrir3iudlpenlivsat srtm( o;u4tlt  ociysfsDrmn onu)arenxf oy1fm eluvi s srtr(m iu4aptn fcsasf 2tmu  nt4tpe mf3iatfa2emn o;u0 exnioctydfm eauei (  2umxo3oo1om nmfetls)aDumxm ou1oexoiocils m2em(mp t0arenxoctydlmD aivols sexo(r ou1al e fviasf Dtrx  ;u1ope iietytla2rlnvs t) eeoxrcio1opDranvolt t2xmio3oo4openlnes () rua(mpoo0oeeomf3iyt sDemuvp;u4aetoxo oa1faD li i t0t2to(r3no1altnlieiat) 2rru o;o1alt moeiatfaDran o u4alerxo3totlptrlu ols0 2toim nu1apt micsls s2rrump;o0oex iietytla uanmo;u0 exrirctatfm   i slt) 2toxo3iy4al nlnctat)sDtaum ;o4oet  feiasla eln s (0 eeomf oydlpDrli o s)sruoir no1am e icsas arrmur nt1aetnii3iadfmDrmu o;()aeerxo3tydlaDeli i;s) rxoxm3iydamtnmict tfa2ra(monu4tlx  ociadlmDeaump (4 etrif oy1lmD lneo ()texrxm iy4oleemfcs tfs2uax poo4olxnmictls aDelnms t4trtrxr oodfpDr u s;(  exo(o3io1lmtnmfctl(  2rmx ooo1optomfetat a uauvs;t4 etnxocoy1fa rlu i;t0s2uo(r3no4ol emfvtlt) rua( pno1opeo fctytlm2eanvs;(0 exrmr3oodoaDr u il( tetrxm3nudol nmictlt srrrxr oo4optomociyt aDeanmpn(4tltoif ta1lp e n s;()srto(o ou1amtn ncil(fs2trxr no0oexoif3iad aDra(vo (4tltrmocootlmt lueo;s  2xm(r3nydoltn ies ( aDra( pot0teeoiociydls emu onu0arxnmf io1lm eaivo s tetrxr3iu1lmt  neia()artm( oou1apt ifetys aDrmnmo (0trxrxrciatlatelivs s0 rur(opno1am e fvs s)sDtau pnt4apxoif3tasla2em(msnt) rtrif iatomt  i o t0trum(m3oo1ole mnes s)a2rau p;t1aetoii3ilsla elu o t4 lxriocoadfmDr ivs;s)srtoiopio1ole lfeiltfs2uaxm ot0aetomietyslm2rmn p;(0tetnif3ta1fpDr ieol( srtoio iodlm emieiasfsDtmxm no0apeoiociysfm raumo (0arerxf oo1faD luvs (0 2tm(m3ou1lleelfvsl( aDrmu p;u4aeeomo3tadfa2rmumsnt4altrmr iy1fmDe uesl(0 eurxopio1ale  fcslt sDtmu ooo0aet iietadls2rmums t)arxoio oatlpD an ol() etrim oy1om  mneiltfs2urur ;o1alt ioeiadlsDum(monu)arxrmf ty1lm   i i;t texoxo iu1ole mnet s)sDrmu poo0tpe mi3iyd m umumo u)aexrxoctydomDeauvs s)sexmir3nydal  lieilt  rta( o;u4tpxnioetat aDuanvonu4tetrio3io1lm eaies ()trtoimpoudomen nvt s s2uaxrono0opxnioeiysfs rlnmsnt) lxrmfcto1oa   u ilt setmxm3oo1om e neta( a2rr(r oo1opt  o3ildls eanvo;t0tlxoxo3iodlptraues ()srumxr iu1olee fcs ( s2rmxrpnt4tetomieilsfsDulu s (4 rtoio iatopDraivs (0 rumxrpiydopt  ivil()s2ta(mpoo0oetn fciydls rmuvo (0 renxoctydfp ean i;s)trtoxmpno4ll e ieslt) 2uaxro;o1tptnio3iydlmDrl(ms t4trtomocoa1faDrai i s)teumxm no1llee ncia( srtrxmo;t4tlto ietltlm2em( s () eerif oatoa eluvolt  rumxm nydlpe lfeia()s2tr(rpnu1tlen fciyd a emums u4altrmfctydlat lnvs s0seuoxr3iy1am nmnciat sDtruro;u4olto o3iyd mDrmump;u0trenmo iy1lpD  uvo s0t2triopou4aleemnei ( srur( o;o4alxo i3iyd a2rlums u4aetrmo io1fpDe nvs (  2urxmpnodlp e net t)s2uaxrp;u0oet if3tls a2umn s;t)trenxf ootoate iei;s0 2umxm oudope mfeilt)a2rmur ou1texnmi3tys m em(vs;t) ltrxocoytfptranvo (0 euoxrpnudap e net tfsrurum ou1optniociysls el(vs ()arermo ty1oaDeli i;(  eumxr oo4lm  mncias)s2ua(mont1openmoeils aDemnms;(4 leniocty1faDean sl()teto(m3io1opt mfetltf ruax  ;u4olx mieiyd m2eanvo t0aexnmo3iytom eanvi;t0trxoxm iudope  iciasf 2rmx p;o1tpen i3tas m uau s;t0arxrio ta1om eluvo s0teumxrpnu1oltnmictas  Drm( pnt1tpxomf3iysla2rmums (4 etrio totlmDe ueo t) rtrxmpoydapenmnvsl(  Dra(ronu0teenmieiatfm2eanmo;(0 lenir iatlm r ieo;()sexrxr iy1lm elfvi tf rtm(  ;u4aee ioctydfm raumsn(0tlxnxo todopt  nvils0t2trio nydal nlivs s)artrxm ou0tetnifctad aDelnvsn(4texrxo3tytfp ean o t)trxmirpnu1lpt  fetltfa2ta(r nu1oeeoio3tyslmDeln s;u4aetrmfcio1lmtrlivi s  2xoxmpoydlptnmieta( arrau o;u4aet io3tltlmDeauvp (0altoxo oytomtelivsls seur(r ou1am  mnci ( aDum( oot1tpt miciadlaDrl( p;t4trtrif to1fa rln s s)texr(m3io4ol nmncs tf Dtm(rp;o4apt mfciydfm ean o;u) ltomfcto1oate nvs;t srtrio3io1aptemies t)aDum(ro;u4tpeomf3iyd s2umnmp () exomo tytfp raieo t)t2tmxm3nydol nmfctlt aDumxr no0tpt ifeiat m2ran pnu) eenmf3ia1op   uvi;s teuoxm iu4olenlici ( sDra( p;o4alxo o3tytfaDrauvs;u)texoifctatoptran sls)seur(o no4ame  fvsat srra(monu0tptomo3tadla2rmu s t0alxnmf oa1oa  au slt0 2to(m oodlpee fvi s)aDtmxm nt0oex if3iys aDem(vp u4trenxf tydfp   nes;t)trumxo3oo1lp  lfctls) Drr(rp;u1tlt mf3iaslm2ul( snu0 lxnxfcio1laDelivs t)t2xm(r oydlpt  fes s a2uaxr oo4opeomfetydfa2ea(vs;(0trtoifcoodfmte u o t)s2xoiopio4lltelfvtl( arraum nt1tltnmictat a rlu p t4aexriociytlpDrai i s t2ur(rpoydlpt miet (f 2rru  nu0apt  o3tyt a rl( o u4areoxo3oy1lpDr ues;t0t2to(opnudllee icta()sDrmu p;t4alx mf3iasfmDul(monu4aetnxfciytlptran olt s2tr(rpnudap eliesa(f rrr(mo;u4alenmietytlaDrmnms (4 rxnir oo1omDe nei s0srtr(rpny1lm nlfeil(  Duaurpnt4aexn oeilsfa2emu o t)tlenmr iotfp  livo;(0setrxm3oudlltnlivtlt)aDtrurp;o4tpto iciatfm uaumpnt)teenmf oo1lpt lnvslt)trxoiopoodlme mfetat s2taur no0oeenif3ilslm2rl(monu4texnxocootlmDeln o t  2toxmpiy4op n nes ()s2taxm ot0tptnifctydfa eaump t)alxnxfctodoaDrlu olt)tetoio io1ll e fcsa(  Duaxr ou0tpenif3ildfsDemnvpn()artomr3tydfptr neslt t2xoio ou4lm  mivs sfaDtru  ;t0ape  f3taslsDelu snu) renmrcta1lptrauvi;s) exr(o iu1ame  nvtlt a2trxmont4oex  ociydlm2eanmp;u0tetrxf iotlmtrluvilt0t2umirpiy4altelnetas arumu pnt4olxo oetytlsDeau s (0alxrxf oy1om rlnei s)trumir3nydop  lnvtl(f rra(rpoo0opt iiciytfm rln snt4teenir ta1lmtr ieo;()trtr(rpiudlmt lnvs t  rua( ooo0apeniocias s2umnvp;t) rxnxocoa1lptelivsls)trxmxopiy4ap emnet t)artm(m oo1tlt  ieiytfaDem(mpnu)aleoxfcta1lmD  iei (0 rxm(m nodamen ncslt) 2tru o;u0tlenmictat aDrmnmo;() exomoctatla ean slt0 rxrxopny4oltemfesa(faDrrxr ou0altnmocils m rlu o u) rxnxf3tydlmD aivi t0t2umir no1lmeemnes t sDuaxrono0apxnmfciad m2elu p u4artrif ta1faDrluvo;() rto(o3iudlme  ies t  2rrxmp;u4tpxoiieiadfmDuaump;() eenio3oo1fm   ies;t0srtm(o3oodomenmietat)sDtmxrpot4optnifctydfsDulnvont4tltnmfcoodop  an i;()tetmxm3nu4lp  micta( sDrm(mo;u4olen feilslm uau o t) eenxo iodlm eauei t0trum(m3iydlpte fvtlsfaDumx p;o0olx ii3tys aDemumo u4texnio3todopDeauvs;(0 exm(opoo1ll n fet sf Duau oou1alenioctysfa2uaumpnu4arxnxf oytfa r i il(0texr(m nydll nmfctls sDtm(moot4oex ifciysfa2el( p;t0aexoxfciadop elueilt) 2xr(mpiu1am elfcsa(f rrmumonu1opxn fciadfm2uau o u4trtoxrcty1lpD aivs s)texmxr io4lme mneia() Duaxmo;u0ape mocils sDulumo t)alenxr oo1omD luvo s srumxmpoudlp  mivtas)srrr(m ot4tlx ii3iyt s um(vp t)altnifciytfp rlnvi;s tetr(rpno1omeemieslsfsDtm(mpnt1apxo i3iltlm rlu p;()arxoir io1faDelues t t2uoio3oydolenmivtl(  Dtmxroou4aex mociydlmDranvo t) lenxf oydfm   iei ( t2trirpoodlme lnvilt aDumx  ;o0tleoiicilsfs umnvsnu) reoxo oodla  lnvs;s)s2uoxrpou1lmt lieil()s2uax oou0oltoiieiydla rlnms;u4teerxoctodfptr u il()s2xoxrpoo4llenlicsa(faDta(r ;o0tlxomi3tysfm2eluvs t4tlermrcoydlat auvo;( setrirpoo1oleemfvil()srua(rp;o1tleo feiyslm2ul(vo;(0tetnxf totlatelnei;( t2tm(rpoy4lltnmnei s  rrrump;t4tleomf3tadfsDulu onu0alxnio3iytlate uei s0srurim3iydomen ivs ()s2ra( pno4alen f3iyslmDemnvo u)tlxrmf3ta1fmteau o t0 euriopoy1ap   fvtas  rrrx o;u1oexnio3tltlm2ul(mpnu0trxrxf3oo1fatrauvsl()trxrxm nydapeemieta() Dumxrpot0tptomfeiadfm2eaumpnu0teeoxr3tytlateaivils setoir3io4apen fci t)s2uax pnt1tptnmo3iadfmDrlumpnt0 rtrir3oo1fpteaneol( srxoim oy4lmtelivtls aDumuro;t1aet mf3iyt s2raump (0aeeomrciatfm  auvs t  2xrxr3oydll nlfvt s) rrrx  nt1olxn octldfm rmumsn(4trtrmo oatlateauvols) etmxrpiy4ol nlfctlt)s2uax ooo1ope mi3iaslm elu o;u0trtnxfcoodla e ivilt)sexoimpno1om e ies tfarumur no4tlt  oeias aDulu snu4aexnmrciydopDr nei;(0trtm(m oudom e nctls  rtaumpou1aex ii3iytla2rmnvo;t0 renmrcto1lm  aieo t)teumiopno1opteliesas)a2rmxmono4oleo f3iad mDrm(vont4tltnxfctatfmteli i;t0teum(opio1om e nviatf 2uaxmooo4tltoiieils s ra( s (4 exrxr oytfmDeai i;t) exoxo nydameeliei s)arurxrpot0aetoifciyslm umnvpnt) rtnmo3tadfaDrau i;t)srxr(m nudlleemfct tf rtru o;t1altnii3tadlm2emu s (0aeeoir3oydoaD  n ols0trxr(r3iodamte nvs s)sDrm(moot4aetoio3iatfa ua(mo;()arenioctotfptrluvs s0srxrxo3nydalee netl( aDrax  ou4aetn o3iyd s eluvonu)tlxomr iydlmDeauvo;(0seurimpnu1ap elicilt)s2rmu  nt0opxn icildfm2eluvon(4tltnmr3tytlmtrlu i s) rtmxrpiu1omtelnvsls)sDumuronu0apx if3tytfs2rl( sn(0aexnmo3tydom   ueols)teuo(r io1amtn nvilt aDtmxm oo1aexo ietldfm raums t4 rxrir tytlmtrlu i s) 2umio oudlleemfesas)srua(rp;u0aet moeiysls2eanmo;t4tetnmoctytlp eluvi;()trtm(r3nu1lmenmnei ( a2ra( pnu1oetoio3iyd mDranvo t0 leomo3oa1la rauvolt0trumxopiodalte ieilsfa2rmxrp;u1apenii3tldlmDuau pnu4artoiocoatopD aivol()tetoim oy1am elivsa(  rta( p;o0aet ifciatla2uan snu)trenmr oo1fpDrluei;s) ruoxopnodop  lfcia( a2tmu ont4apxn ieiatla2um( p;t)aeenir3todopDraivi;t0 2xrim iydllte nesa(farrr( pnu4apx mieild a umuvp;u)aeermr tadfat lieols s2xmio oodale  ivi s)a2rmxro;u4tle  fctyslm2ua(vsnu) leoxo oytfmD anei;(0texrxm3iu4lpenmivtat a2ta( pou4apenmi3iaslm uln s;t4 etnio3oatlpDr u i (0 euoxo iy4llenlivia()aDrm( o;t0tpxnmf3tyt s ranmpnt0 lxrif3iytlatr uvs;t0t2umxopnudoltelfctl() rrrx p;t1tptnmfciysls elu s (0teeoiocty1laD livol()t2um(r3ny4omtelneiat)sDrau pnt1oet iociytfm eluvp;u0 rxoif ia1fmtelivs t texo(o3oy4lpe lies s  rrr(mpnu0open oetlsfs2eanms;(0 eenmrcoo1lpt  uvs t0s2toimpou4aptnmieiat)aDta(  nt0alxoiictad s2ea(mp t4 renxfcoy1opD aivs;t0 exmxopoo4openmfvsls  Duru  ;u0ope mo3iatlmDumn s;u4tetomr oatoaD  n o ()seuo(opio1lmte ncsa(  rrr(  nu0apx ioetatla uluvsn(4tleomfctadlmDelneo;s sexoxo ny1aptelivtat sDta( o;o4apt  fciytfa ra(vo () lerxo iy1fat lnvils trxmxo3ou1ol  lnvs s)artmu  oo4oeeomi3iyd sDel(vsn()tlxnxr oytlp elnvil( truoirpiydolt mnvsls)arrru o;o4apxoiieiytls emuvp u)teenio3iodfpt  ivs s) 2tm(m3oydop e ivsls artmur ot1opeo ictys m emn p;u4 ltnxf oatfm elu s ()seuo(m3nudap n ivt s)a2uaum nu0teeo icilt mDeln o t0tetnir iadlmt lnvo;(0 eumxrpio4omen ietl()arraum ;t1ape if3iaslmDranvsnt0 lxrxo iodlatelnei;s)tetrirpiy4aptn fvil()aDtrxmp;u1tpto fciaslm emumpnt)arxrif3oydlmDeaues s  rtmxm iodame mictlt  2raxmooo1tpxo ociydla el(vsnu) eeoxocoatlpD auvols)t2umxrpoy1optemfetls)srtm( p;t1oeto i3iatls rmn onu0treoxo oadfpteaieil() etoiopio1lmtnlfvtlsf Drru p;u4tetoii3tlt a2emums t4 lxoif iytfpDrlu sls0s2urio3iudomen nvi t  2um(rpno1aptomfciasfaDua( o u0 eermr3io1lmD au i;(0s2xrim3iy4lmeelnctls)aDrr(mpnu0oltoifeiytfs rluvs;t)aetrmo iatlpt lueilt texrim ny4ol nlfcsls) rtax o;u0olxoioetlt m emuvsn()arxrxrciadfa r ues;t)truoxm ou1lp   fcsat s2tmxr nu4tltnmo3tydfs2ulumonu) reriocio1fmDeluvi s) eurio oo4opeelictat sDrr(mpnt0apenifetydlm rau pn()aexrircto1op  anvo;s  rurim3nydllen nesas) Dumum ;o1tlxn i3tyd s ea(mont)trxrmfciy1lmD anei;( s2xoxr oy4lptn feil( a2rrxm ou0tpxoii3tat mDum(vsnu4 rtnifcto1optrlueo;t) rumir3oy4op elncsa()aDta(rp;t1ape moeilslm rlumo;u)trtnif3iytlmDean s;t srtrxmpiy4lmee fvta( s2uaurp;o0apxnmieiadfmDulu s;(4 eeoxr3iy1fp  aieols)s2tm(r3nydom   netltfaDrax oot4teto fetysls umu o u0altomo3iy1lptelies t)s2toiopoodalen neilt)sDumxr oo4alxnifeildfaDuaums (4teenif oytfat an sls setm(m3ou1apen icil(  rrmumpnu1tpen oeiatlsDum(mo t) lxrio io1fa eanei;t0teumxmpoodom n fet ( s2rm( poo4apeniociyslaDra(mp;() etomfctydfmt  n sl(  rumxrpiudape mietlsf Drm(  nu4aex  oeilsfaDrmnvp;u) eeomo3tytom rai ol(0 2umxm3nydol nmfcsasfarrmx  oo0tlxn fcias aDrmuvo;u0 eeoxr io1fmDe u ols texo(o no1al e icta( sDuaurp;o0olxn oeilt s2eluvsnu0aeermo oytopt lu i;t0trtoirpio4lpe mnvsltf 2ra(mp;t0texn ieiydlsDrauvp;(0aeeoir oatlmtr uvo t0sexm(mpoudamte net (f rtmxm ;u4oetnmo3iltla2ul(mp;t0tlerxr tatlp  lues (  2xm(o3iu1lm nmfet sfa2trum nu0apeoifeilt mDeanvonu0artnxr3oy1oa   n o;t0 rum(r iu4ome  fci s) 2rm(mp;t0apeomi3iltfa2ulnvo;t0aetnmr3tytoaD aueo;s)setm(o3nu4op  mncilt  Duaxm ;u1apxo f3iys m2rau p t0 eeomr3todop e ues ()sruo(r3nu4am emicilt) rta(rpot4opxnmo3tytfs2ean o u0 eeoir3totomte nei;s  etoir no1olenlfcs t)s2um( ono4oexomociyt m ean pnu) eenmfctotfmtrlivslt srtm(r oo4lmtn fviasf Dtr(ro;t0tlxnmociytfaDrm( pn(4trxrif3oadlpDr i i t s2xmir ou4alee nesls) rrmum ;t4oex  f3tydfaDelnmp;u4 leoxf iy1fmtrlivs t)texo(opiudapt  fcslt a2raxmo;o0tex  fctytfs2eau sn(0tlxrif iadlaDe ieo s  2xm(m3ou4ll elict ( a2rr(m no4alto oeildla2uan snu)arerircta1om   ivs t0seumir3iodolenlfvtas  rum(  nt0tpenii3iat s2rl(vpnu0aeerxo oydlpDr iesl(0trxm(r3iy1lm  mfei ( artm( ont0apxo ieiysfs eaumonu4altrmo ta1oa eaueils)teumxm3oodope  nesl(fa2tr(moot0alt iictatla2eau s u) ltrxoctodoa raneilt)setrxm iu4alt  ivsa(f rrr(rooo0teenmfeiltfa rluvo;u) leoxo oodfpD lnei;t  rxmxo oydlmt lfvslsfsrua(mp;t4tptomi3tyslsDemnmsn(0trtoir tatlp e nvsls0 rto(r nodom nmnctas)s2rrxr no0aetnio3ilt m2rmuvsnu4 lxrxf oy1omDran olt texmxmpiodlp  liet t srraxmo;t4olto ociytla ra( onu) rtnmo iadopD anvo s)tetm(m3oydap nlnvs s  Drr(  oo1tpt  i3tytls rl( onu)aetrxrctodoaDean o s) 2xmxopio1ll nmics ( sDum(  nt4tet if3iasfsDrl(vp t0arenmrcoadopt auvilt)seur(m ou1lmeelfvilt)sDtauro;u4aeto o3ilt a2ea(vo t4tlxoxo oydfptrli i s) rxoir3oodam nlnesat)sDrrxm ;o0tlxn i3ilt aDrmu p t)tetnxocto1laDe n o s0trtriopiu4lmtnlfcs t s2ta( o;o1tle mfetytlaDeau p t)arxnxoctatopD  u i;() 2um(m nodopee fvtls) 2rrx oou1tex mo3ildlm2em(vs;u4tlxnxrciatfp eaieo;t) 2toxopnydam elfcsa( aDrru pnu4ope moetlsfaDemu ont4teerir3io1fptean ilt0sexmimpou1aleemfcsat) 2uau  nu4tptniieiasfmDulumsn(0trxoxf tadfp  au i t  rxo(m iu4omte nes (fs2umurpnu0apen o3iad a elnmp t)altrxf iatfmDrlnei t)sexmxrpiudol  lfvi tfaDtmurpnt0tptnmiciasfs el(mo;t)arxnmrctatfaD lieslt0setr(mpoo1ap emncslt) Durumont4apen f3iyslm2umu p;t0trtrir oadoptr uvsl(0 eur(m3nodope  ies (f Durx  ;u0tlxomoeildls uanvs ()trtoif3tatop raues;(0srumimpiydopt mnvsat) 2ururo;t1aexo f3iadfmDra(vo;u0 etnirctadlaDr i sl( trxmxrpny1optn ivsa(farumx p;o1olt miciydlm2emnmont)tetnmo tatfptr u o;s  exm(r3no4alee ivias) 2taurp;o0oeto octltfa uan sn(4tlxnifcty1fatr nvolt0 rtmxm iu4am elivilsfarumxmpnt1tee iociydfs rlumsnt0artomo oa1fatr i sl() exm(m3oy1ole  nct (  Dtr( o;o0teeniietldls2rl(vp t) lxrmo tatfpDraies;(0t2tm(m iudoleemfvt sfsDta( pno0apen ictad a ul( p t)trtoir3oatfa  an ols texmirpou1lmee feta()s2tmu pou1alt ioctldlsDemu p;(0aetrxo3ty1faDeaueilt)t2tm(r3nudame lneslt) rtr(moou0apx mf3iyd a eanmo;u)tltrmo3ty1faDe uvs;( s2tr(r no1lmtemieils)arrmxr ;u1apenmfeiasfs umnvs t4tlxrmocoadlmDr u i;(0 2toxmpiudomeemnetl(  2um(r nt4tee miciltlsDulumo u0arxoir3iydfpD anvo s)teuriopiudamenmnvtl() 2rru pnt0apeoioctysfmDrm(mont) etoircia1lp  lu i t texrxopoy4ol nmiei ( a2rr( onu0teen ietatls2ul(mont4tlenxocoo1omt aieils)texoxo3io1amtnliei s)aDra( p;o0texo ieiatfmDrl(msn(0 ltrmfcty1fp r neslt texoxr oo1amee feiasfsDrru oou0olt  fetldls ranmsnu)arerxrciytop rlnvi;t seum(o3io4oltn fcsa() rrrurpot1olxnmi3tydlmDulums;(4tlxomf3to1lm eln i;s s2uoxr iu1amt lnvt s)aDrau  oo0ole  ieiltls2ranms t4trtoiociodfpD  u s;( trxrim3oy1lp  mietlsf rrru o;u0tptnifctadls2emn s (4teeoxr3io1lpt  u o;s)teur(r3oy4lmtnlfvsl() Draur nt0optnii3tls a rl(mo;u) rxrir3iydfp r nvi () rtoiopoydomtnlfcilt) Dur(  oo4alx iieilt aDem( p;u)aexnir tydfaDelieslt tetoxo oo4amenmnet (f rrax ooo1texoiiciytfmDuaump;t4 rtnmo iotfp rlnvils0 2urxr nodolen ict s  rrm(mo;o4oexoifeiasla rau o ()alxrifciatomtr ues;t  2uoxr3no4aptnmieil()aDrrum ;o4aptn ieiydfm2rmn s ()trxrio3to1fateau il()trxrir3iy1olt mfesltfaDumurp;t0tpt mi3tytlm2rl(ms;()treoxf ootfm r neo s0trxrir iy1lm  lneilt s2ua(ro;u0apxnmoetat aDra(vs;(0texoxrcootfm rln i;(  rurxo3io4ameemivsls)aDrmumont1apt miciys aDem(mpn(4 lerircoatomDrlivsls setrxrpnydapt lnct sfs2umxmo;t0tpeoifciyt aDumumon(4tltrxrctadlmD  neil(0 rxrxrpiy4llen fctasf Dra(  ou1olenmoeildfs2rl( snu4aetomr ia1fmteaneol(0srtoxrpoodop  liesatfarrmxmonu0oeenmieildfs rmnms u4tetnxf tytla rlu o;t)texm(r3iy1amt mivia() Drmxr no0tltoiicild mDemnvp u0 reoxo3tatlp rli olt)sexoim ou4ap  miei s  2ua(m no1aet ifeiasls uau s u0aexrmf3totlm   ueo ( t2xoiopiu4amt  netls)srrr( p;u0oleomoeiys aDel( s;t)alerxfciatfp eln ils t2xmxmpno4lpen nci (fsDrm(roou1oeeo iciytls2eau o;u)texrxf3totla   uei s) eum(o3iy4lmtnmiviat arurx  ;o4olenmoetysfm2rm(mp t4aetnmo3oytfpt  uvols0texmir oudome lieta()a2tmxrpot1aetnmf3iysla2rlnvon(4 exoir iadlm raneo;t)seurim3iodaltelnetl() ruaumpou0opxoifciasfs2ra(vo;t4tlerif3tydopt  nei t0 2tmim3io1lleemfeias sDrr(r no1tpx iieiys m2ua(von() leomr tadom eln slt)setr(r3iu4lleeliciat a2raxr nt1oet iiciys m uanmsnt4tlxoif oa1omDrli o;s  2um(mpoydlltn ivsl( s2rrxr nt0alenif3ildls em(ms;u0altomf3iytlpDeaieolt sexoxopiu4ap   ietas a2trxm ;o0tltnmfciasfm eaumo t0 lxrioctadlp eliei s  etmiopiy4amt lnvtas sDtmumoot4tlxomfciat a2ran o t4arxnmr iydopDelues t  etrxm3ny4amtnliesasfa2rau onu4opx ifetlsfs2um(vo;u)alxnio iytlp   ivol(0 2tmxr3ny4lme mfetas)sDtr(ro;u0oetnif3tas sDem(mp;u4treoif3iatfmtraneol(  2uo(m ou4aptelfvta( artm(r nt0oetnioetydfs2rlnvp;t)tlxrmociodfptrau sls)s2xmxmpou1apenmietasfsrum( pnt0aex moetyd a2ua( onu0arenifciodfp eaies;t  ruo(opno1amen icsltfa2ta( o;u4tex  o3iyd s um( o;t) rtnxf tytfmteau o;t  rxo(m3oy1lp e ncslsfaDurum ;o4tpe  oeiad mDuanvs;()alxnmrcty1lateluvsl(0s2xrir no4ll  miesas srtmx  ;u4tle  ieildfaDrlnvs t)aeeomr iy1laDrluvilt0trtrir ou1omeelfvslt  Drm(mpot1tptoifctldfs2eau s;()altomfctydlptelu i s)trxoim3io4ap  lies t  Dur(ronu0tptnii3iyt a2uauvo ()artoir3ootfpDeauvo;( t2toimpou4ome lncslsfs2taumoot0alxnio3tlt s emn o t)tlenmociodoa r u slt teuo(rpou4omenmnes t) 2ta(rpnu0alxo o3iytfs rmnvsnu0trerxfcio1latrlivolt0trum(o nydlpen nei ( srurur ;u1tet mociaslm2umu o;u)areoir iatopD lnvi ()setoim no4aptemivsa( s2ta(m ;u0tpxoii3iytfm2uan s;u0tlxrxr3iadfaDrlnvol( srxoxo3ou4al   nvtatf rrmu oot4apxnmoeiyt sDeln o (4artnir ootopDeanvi s0 2tmxo ou1llt  icia(fartau p;o1tpenmf3iytla ua(mp u) eenxf iotomtranvi;s0 euoxr iy1op  miciltfs2tmxmpno1oleoioeiltfs rlump () lxoxr3oa1omte uei t0 rtrxm3no4openmivsltf 2ururoou1tltn i3iytls elnvont) lxrif todop elivs s)srtmxm3ny1optelivsl() 2rr(rpnu0olt iiciltfaDrl( s (0 rtoxf oadfatr nei;()t2uoimpio1ale mfci t aDrmu  no0tpx ii3tasfm ua( s u0aetnioctotfa ranvs;( s2um(r iy4lp  mncsas) 2um(rp;u0altomoeiys m eau o ()trtrmr3ootfmDelivs t srxrio io4altnmncsat aDtr(m ;o1aptoioctyd a2elnmon(4alxomocoatla r nes;t s2ur(o3nudol  mnesls  2uau pou4olenmo3ias mDra(vo;t0aetnxrcio1lmt aieils trto(o3iu1lmenlivtl( artmxr ;t0opxomietatfa2emu s;u4aexrif oadlpDeau i s)sexm(m3oodop   nvsl() rum(mp;u1opt  f3iyd aDum( p;t) eeoxf oodlmDrln ol(  rur(r3iu4ame  nvtatfsDrauro;t0aeto fctaslaDea(vo t4artnxr3io1optrlivs;t srxr(r oo1lp nmies t) Dta(root1texnmo3tydlm ra( ont)tlenmr oydla  aivolt srtoim3oudalte fcsa( a2rmxrp;u4opxnmfeiasla ul( snt0 lxrifctodomt lieolt)trxo(m3nu4lmtnlnesa(  Dtmump;u0optn fetytfm rl( p u4aetnmr oadfptraivi s sruoxopiydameelfvsatfsDtr(rooo1tpxnmfcilsfsDrlnvp t) etrxf oadlm elu i ( srxmimpnudomt livia(faDur(  ot1aexn oeild aDem( o;t0 lerxf oa1fate ueo;(0 2tmio ny4omtn ivsasf Drrurpnt4opt ii3iasla el( s;t4teenxocio1lpD auvs;s0 rumxr io4ope mieiat)aDuaxmp;o4ape ifeiltlaDemums (0arxnmr iadfp ran slt)teurxrpoo1alee ictlsfaDrau  oo1tlxnmo3iadfa umnmo u0alxoxocoadfp rai o s sruo(m no1lmte fesas)sruru pou1tet if3iys s ea(von(4altrmfcoydlp rauvolt0seumxr3no1am  mnetatfa2um(r nt1apen fciytfm2eln p;t4teenxf3oatoaDelu i s srxoxr io1ll e fvtl(fsDra(r nu1tpx  f3iydls2ulumont0 lxomr3ty1lp rlu slt0seumimpoydom nmnesltf 2ur(mo;u0oexomfeiydlmDemn pn() lxrxocoa1lmDelivs s0setoio nu1ll emici s aDtrur ou4aexnio3iydfm rmuvo t0 eermf3oy1opt lueil(0tetoxmpou1lmtnmfvilt  Drrumo;o4olx ioeiytla uaumsnt0artrxociydfatrlu o t)s2tm(m nodolen ncias aDraurpnu0optn ieiysls2ra(ms u)aexoxrcoatom elnvs t0srtr(opoodlpe  fcsa(f Dumum ;u0tpenifciadfs2uln pnt0 lenmf oytlp raiei ()t2tm(opoo4amtemnct ( aDuauro;t0aleoiociys sDran sn(4aexomr3tydlptrli sls trxrimpnudlmeemfctatfs2rmumpot0tltnmi3tlt m2rl(vpnu)trerxfcoodlmte n sls  2umxm3nu1lpen ivia(fsrtmxm nu4aleomictltla2eanmo;u)aleomf tytlaD anvi t)s2umim iu4lmenmnctls)arurx  ot4aet iieilsfa2el(ms (0trtrxo3iadfa e nvslt s2um(opiodll emfvia(fa2rrx o;t0tleoioeiasls2umu s () ltoif todomDr ieols) rtoir3oydlp nmivsl()s2um(m nt0alxo icias s2ean sn()areomr iydla  aivo;s0s2uoimpno1lp emnvtat)srtr(  ot4oetomoeiydfm rmuvo;()aexnmo3io1lmDe i s;s tetoir3io4olt mies tf Duax  ou0alt if3tls mDrm( p;t)arxnxf tatop eliei;s)s2trim3ou4ll  lietltfaDumu  ou1tlxnif3iydla2emn s (0tetnxo3ia1fat anei ()setrxr3nu1apt mivtas a2rm( pnu4tpe ioetysla2eanvs ()trtrxrctotla  livs t texm(r3oudop  mfvtat)s2urum no4tlt ifeiydfaDemump u4 renif oatlmte ueols) 2xrir iu1ame miesas  Dtr( pnu1oeenmi3tls a2eanms (0artomoctodfaDeli s () ruoxo nu1omenlies () Dur( ont1olxnmictad aDem( o t)altomfciy1op   nvsls0t2umirpou4ap elfes tfartr(m nt1tetnmfcilslm2rl(mo (0trxrifcoatoateai il( setmxr iudamtnmnctas)sDumu  ;o1tpxoifciaslm2eanmont0 exnmf iadfmte u i s s2tmim3iudop n fctl(f 2tmu  ;o0ole ioetlt sDuaump u)texniocta1lpD  ueols  rto(r oy4omtnmfciatf 2tm(m ot0apt iieiadfaDeanmp () etnxr iytla e uei t) rurir oodalenlnet sf 2rax  no4opxnmfetytfa rmuvo;u4aleoxr oy1la rlivs t0setriopiy1lle  nvsas)srtr(  oo1oet ii3tatla emnmon(4 eermo3iatfat  nvs;s)t2xr(o3ny4om nmicsas aDraumoot0alx iieiydlaDum( ont0trtoxf ootfaDr n o;(0srtmiopio1openlieias) 2ta(mo;t0alx moeiys a ea(mp;u0 exrxo oy1omDe n i;s0texoxr3no4lle mnvi s a2umump;o4optomoctad a el(vpnu4 eerircia1fa rlneo;t0s2tmirpiy4lp nlfeilt)arrr(r nu0olx  ociatfsDuluvs t)arxoxo tatlpt aieils  euo(r3oydllte nesas s2tm(ro;t1altn ietydlsDeln o;()artrirciatom rluvo s0 exo(rpiodoltemieta()aDtrumo;o1ope io3ilsfmDrmnvp;u0 renif3totoa   nesls)texr(r nydlme lfvs ( sDtmxmp;o0texniieiyt s2em(vo;t) renmo oadlaD  ieo (  2to(m iy4optemncslsf rrmump;u1aex  f3iad mDul(vsnt4arxoxf3ty1fm raneo;s0sruoxopiy4lmt lfvsa()artm(r ;u1opxoio3tasla2rlnmpnt)areoxf3oodfat luvo;s) ruoxopoo1lmt livtat a2tau o;t1apto ictydfaDelnvo u)arxomr totoptr n ol(0teur(opiu4apenlneils s2rmx o;o1olxnmictat s el(vonu0 eerxr3iotlptelu s (0 2toio ou4ameemnviltf 2rr(root4tpxomo3iltlm umumo;(0tleoir3iydlpteluvi;()t2umxo3iy4lm  lnetat  Drm(m oo1opto feiydfsDuanvs;u)aetrmr oy1lptraueo s  exm(r3iodlme mnvt s a2uaxr ;o4tpe ioeiasfaDeau o u)aeerir ta1fpte ueo t0 exmim oy1al  micia( a2rm(r ou1opx mi3iydlaDumumsn()texrmr oatfpDeanvols0 rumxr iy1op emnct ()arrrxro;u4alt mi3ias m2ua(von()aexnifcoy1laD an o;s0tetoxo nudap  lncs sfaDrmum nu1tpenif3tydfaDulnms t) etnmo iodfmt  n ils0srtoim iu4lpt  fvils)arurxm ;t1aeeomi3tyd m2ua( pn(0arxrxo iodom raues;t)seto(rpiu4lpenlnvi s  2tru pou1ape  o3tadlmDrlu s t4trxomocoytfat  nes;() rxmxrpiodlm emfeslt sDtaxm no4tlx  ocilsfs ua(mp t4tleomo3todlm r u slt0teum(m3iodlptn nvslt) 2rm(  no0texnif3ilt m ua( p u0alerircta1la  anvo;s0 2xrir3nodol  mies ()a2tau  oo4tpeomfeils mDum(vo t4 rxrio3oytlpte iei t)setrxr oy4lp nmivi s) 2rrxr ;u4ole miciltlm emu sn(4aetnxr3iatoat anes s)trtmir oydamen fcsls aDtr(m ot0ope mfeiyd a rau snt)teenxr3tadlptraueo s0teto(r3nu1op nmivt t a2tax pnu1ope  f3tad m emuvo;u4altnmrciydomDe nesls0teurxr no4optnlivsl(f rrm(mo;t0aeeo o3iydfaDrl(vsnu0alxrxrcoytlat ln ilt0 eur(mpiydamtn ictas) Draurono4opxnioeilsla2eln o u4tltoir3tydopte u i;s0srtmim oodole lnvs (fsDum(  no0tlxomf3ils m2eaumsnt0 eerxf3iadop eau o s0 ruo(r oo1altemivias a2rrxr nu0alen o3tysfmDrlu o;(0aexnio oydomte n s (0srxoio oodame lfes tf Dtaxm ou1alen f3iyd m2rm(vs u0 rxnmo tadla  an ilt) 2trio oo1aptnmfci sf rraxm nu0optnifeiytfm rl(vpnu4trtrxo3oo1optean s ( srto(r3oydoptnmivt s sDtr(m ;o4tlt ifeiydla2rmn on(4arxrxo3oodla   ueslt0trtr(opno4alt lfes s) rtrurpou0alxoif3ildfs umumont0tetomr3tatoatelu o ( t2uoxr3iu4open ics (fs2tmu  oo1oeen oeilt a rln pnt4 rtrmf3ta1fm ean i s trtrim nydam e iesat arrmur nu0oltomictyt s2emuvp t) lxnxr tatoa eliei;t  etmiopoodlltelfvslt) rtmu  nu0tlx iicils m2umn ont0arenmr3ootlpteluvsls  rumio3oo4ame mivia( s2tmxronu1apeomf3iltfm ea(vo (0treomo3iodlptr neolt0trtoxr oydll emfvs s)a2tr(monu1tpxo iciatla2um( o u4 lxrir3oydfmD an s t)s2tmxmpny1amtemfvtlt srta(m ;t4texnmociad mDul(mp u0aexnxr ootfaDeln ol()trtmxr3oy1lp elictatfa2uaurooo4tptoif3tadfa umumsn(4trtomfctytlmt  ues s) 2tm(rpoydlp e nvta(  rrmx  nu1aeeomf3iysfs ra(vp t4 lxoio3totlm eai s s seumimpnudame mncil(fsrrrumo;o0apenmi3iltfm uaumo u4tetrif3oo1op ean s;(0t2tmxm3oy1apeemivsat  Drm(  nu4apxn f3iasls2ul(vpnt) lerxf tydfmD lu s s trxrxr iu1olen ivslt)a2tr(mpou4tpenii3iadlaDel(ms t0 ltnir3iytfp  ai o;s  etmir3oo1amtnlnvt s srtaurpot4tlx micils a2uaumonu) lxomr ta1fpte u il(0s2urxo3ou4aptn ies tf rraum ou0optniictlsfsDum(ms;u4tltrxo3oodopD  u i ()s2tr(o3ny1lpee ivtat sDrm(mpou0alt mo3iatfs umn s;()tlxrifctodfpD lueo;s)srumxm3iu1op   fct s srraur nu0tltnioetaslm elu pnu)areomo oy1fp r nvsls s2xrxr3iu4ape mnct t)s2tm(mo;o1apenmfeilsls2ranms;t) etrxr ty1lp ranes;s)truoxo3iu4lle mieias artrumooo0oexoii3iytlm2rl( p u0 etnmrcty1omD au i;()t2tr(o3iu4ame  nvs (faDrmxmpot0apxnmf3tytlmDeau p;u0aeeoiocty1lm eaies ( sexrxr ou1lme lies (f rraxmpoo4texomiciltfaDum(ms t)tlxnxo iatlmte i il(0 eur(m3oudlmt mnvsl(  Dtaumoot1aeenio3tytla uanvpn() eenxr3iotopteauvs;( teuo(m3no4omenlnet t)arra(mont4tet ifeils a rm(mo;t0 etrif3iotoat anei t  rxrimpny1lltnmivs () 2taum nt4tee iieiytfs rl(mo u0altrif3oadoptr n i;t) exmimpiy4lmtnlietl() Dum(r ot1aeeoio3tas a2elu ont0aeerifcoodfatrln ils  rurir oudamte ieiat)srtrx onu0tpxoif3tat m2eluvo;t0trxoioctotfmDe i s;s) 2xoxopoy1ome lnetl(  2umxmpot0a
\ No newline at end of file
@@ -0,0 +1 @@
+ieols) rumim3ny1ap nlicsl( artm(mp;u1altoiieiaslm2ul(vp;u0alxrxo ta1fpDelneils  rtr(o iodap  mnesas  2tmurpnu4teenmiciys m2ra( onu4altoifcia1faDelu ilt srxr(o oy1aleemfctltf 2rmx  ;o1tltoiieildlm eanmp;u)aeermf3ia1oa rlnvol()t2trxo3io4lltnlneiat  2ua(monu0tptnio3ils s ran s () etrir oytlat ai ils0 ruoimpoo4lmt lfct s arrrum oo1alxomo3iatfa umuvp;()treoifciadop eluvo;(0 2xoio iy4lmt mfctas)sDtruroou4apenmfciytfmDel(vs t0arxnmr3oydop rluei t t2xr(m3oodap n ncsas srrr(mont0oleo ieiatlm emuvp;t4tetrio oo1fpDeaueol( srurimpoo1lm e fvta(fa2rm(  no0oet mfetltfs2um(vo t4tltnxr ty1omt  n sls) 2xoxopoy4optelfctls)s2uru  ou0oeeomfetadlaDra(vo u0teeoxo iatlmt  nvo t) rxrxr ny1optnmnvil(faDtaum nu1aptoio3iad a2elumo t) exrif oatlmD an s;()texmim no4lpt lfes (fsDtmx pot4tpxomo3ilt aDrmums u4 lxoxr tydfm   uvi;t0 rtmxm oy1lle mnci (fsDrau ooo4apx iociysls eau o;t) etnmo3oy1laDr n il(0s2trxo3iudlp nlfctat aDur(mpnu4tlto ictad a ul(vp t) rxoxo3iydlatr i s (0s2ur(o3iu1ape  ivslsfa2rru  nu0opxo fciasfm rlu ont0arxrxf oatopteln i;s seum(mpoydlme mncsat)sDurumooo0apeoifctltfsDrl(mp t0 rxomociytomte n i;t t2urimpnudapeemivia()aDtrxmo;u4oexomfetldfm2rmnmo t4alxomo3iytlp rli s s)srurxo3io1alenmics t a2tru poo0ole  ictydlmDeaumo t0altrmf3tydopDe ieslt t2toio iydlmtemiei s  Dtr(m nu4tltnmoeiyt a eaums;(0tltnio iatfaDeaivo;t  2ur(mpny4amenlivsa(fartmx  ot4oex mfctldlm rmn p (4aexoxo3tadoa e i o s t2uoxr3iudlmeemneilt) rraxmpnt1oetnif3tltls rmnms () lxnxociytfa eli s;s0trxoio oydlp nmieil()aDrr(mpoo1tetoifeiyslaDeln s ()aeenio iodfm  luei t)sruoxo3iodlpen ics t) rumx  ;t1tltnmf3iatfa2rlnms;(4 lxrxo3iy1omtranei s)setmxr io4ap   nvia() Dtrxr ;u0olxn i3ild aDea( o t)arenmrcto1oat aneols setmiopiydop  licsas) Drmxmo;o1aeen feiad a rlnvo (0aexoxfcta1lmte nes;t0s2xm(r oy1om e ivtatfarta(r ;u4tlen ociysla eluvs;(0texrio iodopt  ues;s  2xoxr iodlm elfvs t aDtmuronu4alx if3ilt sDuanvon(4teenio todomD  ueol( srur(r3iu1alenmics s)srurumpot0opto f3tydlm rm(vsnt4altnmoctotomDrai sls) 2ur(mpoodol elfvs s)a2rm(mont1oee  f3tldfmDelumo (0 exrif3iatomtrlnvsl()sexoxmpnu1omenmncsas)aDrr( ono1aexomieiatfa2eanms;t4 exnir tytfmtr uvi;s)setmir3io4ole  ncs t  Draur ot1oexo oeiytfmDua(mont)tlenif todlpDelu sl(  2umio3nydlptelnetat  2um(m ;o0tpe iietltfsDel(vpnt4 exoio3totoa   uvo;(0 2uo(mpiodap eliet t)s2uau  ;u0apen oeiltfs rl( ont)tltoircoatlp  aieols) etm(rpno1omtemfes ()arum(mp;o1tlxnmo3tltfs um(vo () exoxfcoydfpDran i t0t2to(o3iydamenlfctls)s2umxr no4tlto ocild mDel(ms;u0aetnmf tydfpteanei;s s2xr(r no4olt lfvtltfs2ra(m nt0tptoioeiytfs2rm( pnt0artnmo ty1omDraieols)texr(mpno1lmtn fetl() 2rmurpno0tlxnmoeild s em(mon(4 rtrir3tydlp e n s;()teurio3iy4apenlnctat arur( p;u0tee mi3iadlsDrlu o (4 lxomf iytlm   ivol() 2xrxm oo1amtelietas  Drr(  ot1open ocias s2elnmp;t0 eeoxo ty1fmtelu i t0t2xmxmpoudllee fvsl( sDraxm ;o0oeenmocias m2emnvo;(4tetnxfctadla r uei;t0texmxo3io4op  mfeslt)sDra(r oo0aptoifctatfs2eanvp ()alenxf oadop raieols) 2toio oydolenmictas)arumxm nu4oeto fciasfa2um(vp (0 leoioctytomD  nes t0 etmxmpiy1lptnlfet t srrmxr nu0optniociadls2eaumo t0trxnmfcoydfpD livolt  rumirpio4lltelnvsas arum( pou0opeomoeildlm ra(vonu) rtrirciodoaDr ieo s  2uoim io1lm nmietl()a2rrxmpou4tlxomo3iys a rmnvont4tlxnmr3totfm eaneil(0srxo(r3ou1ol n ivil() Dum(rpno0tle iietltfs2ra(mo;u)altnmo3iotoaDr u i;t  rto(opio4llen nvi s arrmx pou4texoio3tysla2rl( o t) ltnifcoydfa rau sls0tetrir3oodlmenmfvsls a2rmuroot0tle mfciltfa eanmont) eerxf3oadfm  anei ()t2trxo oy1om nmnvsat  Dra(mont0tlxn oeiadfmDranmo u0 leomf3iodfatraneo;t)sexo(r nu4om e ieilsfa2rr(mont0ope mf3tadlmDuluvp;(4 etoxr iotopDrlueil(  rtmiopiydoltn ici s) 2urur no4alenioeiyslm2ulu p t4 ltomrcoydlp elueolt)texrim ou1lmenlivia(  Dtrxmo;o4altnmicildfs2rl(ms (4 etrxo oa1faDran s ()srto(r3no1om  lnvi s sDta( onu1ole mo3iad m ean o t)aexoxoctadfmD lu i t) eur(r3iu1lmtemfctls srtm( p;o0tltomi3iydfaDuan o ()aexnifcio1lp  aues (0trxmxo nu4lpe  ivsl(f Drm(mo;o1apxn feiltla2ul(msnt)trxrmo ia1fp r ieo s  2um(r oo4lpt livils  2ua( ont0opeo octltfa ua(msnu4teermf oydfp ean ilt0trur(m3nodamenlnet s a2uaum nt1aex  icilt a2ua(vp u4 rxoxrcoytop r neo ()srto(r3oodalee nct t) rua(m no4oeto o3iltfs2uau s;u4alenmocto1laDran i (0 2tr(o nu4ol  lnviltfsDrm(m ;t4aptomo3tydla ran s t0altrir3oytfp raieo;s)t2uoxrpoo1lmee ivi sf Durx pot1tex ioctyd aDrmn s u0 lxrmo tatomDr iesls  exmxrpoy1ope  ieiat) 2rmu o;u1tee iictld a2eauvp;u0artrxocto1fmD liesl()sruo(opoydlptnmfetat)a2tm( pnu4oet mfetlt m um(msnu4aexrxr iydfptelivo;()setmio oo4ameelfctas s2rruro;o4tlx  icils m ranvo (4teenxrcoatfptelnei;s0 2xrir3iodopteliet t)s2ua( pnu0tle  ieils sDelnvp u) etnir3oy1op e ies s)teum(r iudamt livsat) ruru oot1altniictytfmDea(msnt0alxrmf iytomDr i il( trtoir3io4lm e nct s)srrr(  no1ope  i3iltlaDulnms (0altrif3totom  luvs;s0srxoirpio4opeemivtl()sruaxrp;t1tet mi3tad s2umu s (0aeerir oa1omDean o (0srtrimpiu1omt liet sfsrumumpoo1aleoii3tadlm rlu o;t) lermf iy1fa r i o s0t2xr(m iu1lmtemfcs ()s2rmumpnu1optn icild a rau p;()texnmr3iatfatelieilt) 2urxo ou4alee nei tfsrtr( ono0opeomi3ilsfaDul(vs;u)areomr oydom raneilt0trxoxrpiy4oltnmfeslsfsDrmumo;u4tpxn f3ils m2rmu p;u) eenxr3totoaDe uvo;s)s2xoirpiudale  nviat a2urx pno4alx ioeiys s2rl( pnt4 lxnxo totomD  ies;s)srtmxm3nydlp  mivsltfsrrru ont1open ocias s2uanvs;u) rtoif oa1op e ivi;(0 rxrirpiodapenlncils) ruax  nt4tlxo ieilsls2rmnms;(4 rtnxf3ta1lmte n i t) 2xmiopoodllee fcta( arra( onu1alx ii3iys a2umuvs;u4tetnmrcoodomDrlivolt setoirpiu4olenmict s aDtrx o;u4ape  i3iad sDel(msn(4artnir3tatoa raivil( setmxo3nydameelfvi t) rtr( onu4tlxomo3iysls emnvs;t)aexnxf ta1lmDelnei;(0srxo(mpnydome  nei tf Durxmpot4oex miciltfa2el( o;t) reoio3io1lm ran o;s  2uo(mpnudopen ivsl()sDurxmpoo1ole mi3tld m el(mont)altrmoctydlmD anvs (0 ruo(rpio4ap elnetlt)srtrur ou4olxnmi3iatls2eanvo;t)trerir tydop eanvi t0 2xoio nydlpee nesatfsrumu pot1oltnii3ildlsDemnmonu0arenxrciadfm e i s;s)teuo(o3ny4oleelfeil( sDrmxront4oltn octltlsDemn p;()aeeoxr3tytopD ln sls s2uoxr3oudlmenmict () rtmxr ;u0alxnmo3tatlmDumuvo;t) rerxoctodfaDrluvs;(0 rtrxrpnu1ale  ivilt) ruaurp;o0tpenmo3tlsfmDul(mp ()altrmr oodfpDe ivi t0srtoio3nodomt  ics s) Dua(ronu1olxnmoctytls umu sn()tleoxf todlmDe u sl(0 exo(r iu1ome lnvtltf ruax pno4oee ioctasfa ulnmp t) rtrmo3totlate neo () exm(r3io4llt  fvtas  Duau o;u4olxoiiciad m2ulumonu) lenxrciytlm raueo t0s2xoxr ou1lltelnvsl()srurx ono0alt ii3ilsfm ul(msnt0 leoxf3iy1opDeln i;s trtr(o3oo4om  mnet ( artmxront0tpeomfeildfmDeln p ()aetomfcio1omDean s;()srxoirpnudom n icslsfs2rau pnu4tet mf3tls a2rm(vo u4aexrif3ta1lat aneils)s2ur(rpoo1oltelnvt s)artrxrpot4alx iiciatfs rmu p;(0 exoxrcoadopDeaies;()trxrxrpio4lle licta(  rtr(  ;o4aptoii3ilsfa2eln s;u) rtnmr3tadlpD aivols  exmxm3nydopeemnvt s)sDtau  no0aex  oeiatfsDea(vonu) reomr io1faDr u o;( srtrir3oy4lpenmietasfaDrru o;t0tlxn i3iasfm2ran snu4trenxf oy1la rlnei;t0trtmxrpiu1lptnmivta( arua( onu4opxo fciydfmDra( p (4 etoiociadom rli sl( t2xm(m3oo1omenlfviltfsDtm( oot4oexoio3iltla rlnms;() lxomrcoatfp raneo (0tetoim3nu1ole mnvilt  Dtmx onu4alxnif3ildlsDul( snu0 eenmo3to1lmDrli olt) 2uo(o3iy1optn fcslsfsrrax pnt0apt ifeiatfm2uluvpnt)trxrxfciatlmDeanvo (0teuoirpny4apt lnesas)a2raxmo;o4opx iietatfs rmnmon(0artnxo iodlmD  ieilt0sexrxrpny1llee ncslsf rrmxrp;u4alenmo3iyt s2eanvs;t0 eeoxf oydlpteln i;(  rxo(o3iydole mfes (  Dur(  no1oltoioetydls ea(vo;u) exoio3tydfpt  i s;t)s2uoxmpoy4lpenlnct t s2ururoou4texn ieiyd mDraump;()alerircoydlpteauei;(0t2xmirpno4lme lieilt aDtaxmpnt0tpto feiydfsDrm( s u) ltnmf todlatrlivi;s texmxrpiu1al  mnvs s aDrrur nu0tex iietatls2umnvp;t) lxnxfcootlmD lieo s sruo(r3oy4ol n nes sf Dta(ro;t1tleo fetltfm2rlumo u0altrifciy1fmDeaivslt) exrxr3iu4oltn ivi (faDtru oou1olenif3ild aDemnvsnt)tltrxfciytoaDr ivilt0 euo(o nudlp  mfeiatfsDrrur ;u4openmociaslsDrauvo;() rtnmr3iytfmt  u ols)srumxo3io4apt  fesl( arum(mpot1olt mi3ilslsDum(mo () eermociadla  ln o (0trxoxm ny4optelncil(fs2taxrpnt1optomoeiytfa2ul(mo t0altnir iotlatr nvi t setoxrpiu1llt lnvtatfsDurxrooo0oetomiciltfs2ra(ms;u0 etoxr3iytopD luvolt)trto(o oydom   nct sf Dtru pot0tpto i3iltfsDra( o t)tlxnmocoo1oat  nvi t0setrio oodolenlfvils)sDraxronu1tpt ii3tasfmDuanmo u0texrxf3oatfptrauvi (0s2xr(opiy4ope mics sfartm(  ;u0tlt ifciltla ul(ms t)aetnmr3tatoatelu ols t2urxr3oudlptemivias a2tru p;u4tle  i3iyd m ul(vpn()texrio3oy1lmtrau i t0trumxo3ou1apt  nct (  rtrum ;o1alxoif3iatfm2rmuvs;u4 lxoio3ty1lp e n s;t)trtoxr3oydapt mnvt ()aDrru  nt1tlxniociatlmDrmnmo t) renmf3to1fmteli i ()seumim3iydolte nvsl( a2rmurpno1aetnmi3iydla ea(mo;u)tleoxr oo1fateaivi ( t2urio3oy4amee fvi sf rur(moou0aetomf3tyt m rluvs;t) eenif iodoaD auvo;t seurxrpoy1ll  micias)srtmump;o4aeto fctldla2elnms u4artnxf oatfateaues;s) rxoimpnodlmt  ietltf rtmump;t4texnioeiytla2ulnmo (0 lxomf oadopt lu i;(0 rtmio3oy4op  mici (  rta(mpoo1oee miciyslm emnvpnt0areoioctotlpt  neo;t0 rxoxmpiodap nlnet (fsrtm( pot4altn i3tltfaDrlnvp t4 lerxr iytlpD livi;s0sruoxm ou4ope  nct t) 2tau pnt1optomfeiatfs2emu snt4 exoio ty1opt anvs;()s2toxrpiu4lpe mivtls)sDtmxmpoo4aptn ociatfs eluvs;t)aleoxo3ty1fmtran s;()sruoxr3no1lpe lies s arta(r ot0tee mo3iasfa rmuvpn(4teeomrciotlpD livo;s)sexmir3ny1open ncils arumumont0oeto o3taslaDrlu pnu)treomrciy1omteluesls0setmio3iydaleemfcsas srumxmooo0altoio3iyt mDrlump u4texnif3iodfp r uvsl(0 rtm(o ny4lp emicsa( aDrrxmpnu4oleoifcilslaDrl( p (0 reoio tydlpD auvils) rtmxr io4op   fctasfsrtrxmo;u4aet if3ildfaDrau pnt4tltnmr3totla   ueo;(0srxrxopiydapeemncilt)sruax  no4olx iictyt m rm(mo;(4 ltoxocoy1lp rlivsl(0 exmxmpny4olt lfvt s sDtrxrp;u0aetn i3ildfaDemump;t4trerif oa1om r u o t)t2tmiopiy4olt  ietlsfs2umxrpno1oetn i3tlsla ranmsnu0 rxoircia1fmDeln ilt0 rur(r oo1apenliet (fs2umxr ou1oleoiieilsfm2ea(mon(4 lxrio3iatlatrln i ( teur(o3no1am  lneia(f Dumurp;t4oeeoifeiltfs2ulnmo t4 lenmr oydlm   uesl()seurimpno4alte ivsa(f Draurpou0tlt iiciysfm emump (4tltriociatlaDr uvolt0 rumio io1opee nvtasfarrmxrpoo4apeoioetlslsDemu p;t4tetrxo3tadfm r ivilt) rtrimpio1lptn ncia() Durxroot4olx ioeild s ranvo;u4aetnmf iodfmteauei;()teur(rpno1omtelfviasfa2rmxronu1aeeo o3iltla2eln snu4aexnir ootla eaivil( trumxr nydlle mnvs () rumxm nu4aex  ieiyd m rln p;()arxrmo io1oat auvol(0teuoxr3oo1aptelneiat) rrrumo;t4aptoioetatfm elnmp t)aetnmf ootfm rau il()trtm(o3nodlmt lics () 2tr(ro;u4oetn i3iyt s rlnms;t0tlxnxocty1lp  anvi;t t2xo(rpoy4aptelfciltfsrtr( o;o0optoiictyd a2emu p t) reoxo3iydopDe ivols truoxopio1ale lnctasfaDrau pno1oltnmociysla rlu pnt4texnxr iotop rlnesl()s2xmio3oy4ap n fei sfs2trxr no4oetn fctlsfsDelnms;t4aetoxo3iatlaD lnei;() ruoirpnu4om  lieils)aDrax  nu1aetoii3iyslsDrl(vo t4 eeomrcoydfa  au i;t)t2xr(r oodal elfvias) rrax  ;o1aex  feiadlm raumpn(4tlenmr3iatom r n ols0s2xmxopoodapenmnetltfsDurx pnu4tltoioeiytfaDul( o u0 etoxr iotoaDraies ()teumimpnodlptn nvs (fsrur( ono1tlt  ociadlmDrl(mo t)trerif totfa  lu o s t2xm(opno4lm e neta() 2rmuro;t0tptn ictytls2um( s t4 rtomfcto1lmtrlu i t) euriopio1lm nmfcils  Dur(  ;o0tpeo ieiasfm2rmuvp u4aeenio iydlp   ies;s s2ur(opoo1lptn nciat) 2taurp;t4tpxoifciytfm ua(von(4aexrmfciodlm r ies (0t2xm(opio1lmtnlfcia()a2rru onu0olx if3ildfa2eanms;() exnif io1lmtrlnei s0 rur(o ou1altnlfeias) rumuro;u1tle  ocias aDul(ms u4arxrmf3iodopD li s t0srtoxopno4lme miciat)srra(ro;o1tlxomietldla rmums;(4 etrxo3iy1optraivi (0trtm(o oy1ap nlictl()sDtrur ;o4tlt mo3iytfaDumnms ()arerioctytoa   iei () 2xmxopoo4amtnlnesls)aruaump;t0tee iietytls ulnvo t)trenmf iadlmD  nei;( sexo(mpiodlm emivsls aDuau  nu0apxo ictas a2ulu sn(4 lxomf3tatomDrauei (0srum(opoy1al e fvia(fs2rrxmono4aexoiietytfs emump;t)tlxoifcty1omtrlivilt)srtrir3iy1lptn fvtat s2tr( pnt4ope micilsla2ul(mp t4 ltnmo3ootopDeluvols0 exmxmpnydopen nvta() 2rr(rpot4oee  i3iasla2rauvo;t4 ltrmo oatla  ln i t  rurio iy1al n neta(fs2raur no4ope  oetlsfmDeau s;u0tleoifcio1fat aivo;()s2xoxo3oydape  ivt (f rtaxm ou0aexn i3tadfa umnvo;t) rtrmr iodla eaivi;t0 eum(mpio4amtnlfesltfa2urxr ;o4tetoiociytlsDua(ms (4 rtrif3todla e ueo;(0 exrxm ou1lme  ies t sDtmxro;u1tlxomieiyd s rln o ()alerxr tadla rai s s)tetoim nydam   ivtl( a2uaurono4aexomiciytla ra(vo u0 exoxfciydfa e i o;(  2um(mpou4am nlfci sfs2taxmo;t4tle  ociydfsDrm(mo t0 eeriocoydfa elu s;(0trxoimpio1ol eliciat srtr(mp;u4alxomo3iad sDel(mpnt)tetrif3iytfp  an slt)trxmxo iudaptelfci ( sDtauro;t1tptnmicils m2uan p;u) rtrmr ootomt livo s)seumxm3oydalenmneil(f Drax poo4apenii3ias aDumuvs u4 rxrmr oa1om r u i;s seurxm3oy4apt lfvt t a2tr(mono4opto oeiadfm2ra(vp;(4 rtrxf iadlaDelu o s) etmxmpoo4apenlieiasfs2ta(m nu4tptn o3tytfm2ran o t4altrxr iotfa raues;s texmim3oy1op   ictas)s2umu p;o4alx ioctlslsDeluvsnu) eermr iadfa   ieols)setoxo oodom emfctls) 2trxrpnt1teeo ictlsfa2ranvonu4trxnmo ta1fmtrln i;()srxrxo3nu1ol  licias sDtaurp;t1aexo ieildfa2uau s;t4trxnmr3iydoaDeln o t0 2urir io1opte ieslt)aDrrur ;t1oleo i3ild s uln o;u) etomfciydfa eanvolt0 rtoio3nodop e ivilt)srta(m no1aeeomo3tas sDumn s t0 leoir tytlpt ai s;(  exoxr3io1ol   ivsl() Duau pou4tpe mfcilsla ulnvp;u)trenircoodom  ai o (0sruo(m nudaptnmiet tfarum(mont4aet  oetydlaDem( o u4arenxr oa1oat lu slt) eumxm3iydlpe  fcsas sDtrx  ot4olxnmictltlm2ran s t0 renmfciytlmtran sls0srxoim iu4lpenlfctasf 2raxr ;t1opxnmi3iadfsDeanvo (4tlenxf3iydlaDean il(0 2xoxo iodol e fct ()srurx  ;t4apenmoctls a2rau o t4 rxoio iatla  aneo;s)srxr(mpiodomtelfvt () Drau ont4tlx  ictas s2rm( s t0 etnio3ty1oa r i o t)teto(r3ny1apte fvia(f ruaxro;o1apxnmiciltla uau p t4 rxomr3totopD  ieslt0 rxrir io1omte feiat sDtmxronu4alxn oeiyt s uan s u)tetrmf oatoa rli o t0 2xoirpoydom e iviat  ruaxmp;u1tlen ieildlm uaump;()tetnmr3todlm   u s t)setrir nodome mnctasfaDum(rp;u0apxo icildlm2rlnmsnt0trtrifcta1oat aueol(0sexoxmpny4lp elfetas) 2tmx  no4oexniociyt m2rlnvo t) rxoxr iy1lp r n s t0trurxo io4amt mfvsls a2umxrpnu0aetomo3iatla2raumont0aetrmocootoa eaieo (0trxm(opou4op nlfvslt) rtru  nt0tptnii3ilt s eanmp u0arxrmfcoy1optran s;s0 rur(r3iy1altemietat) rtrum oo0oee  oetadfm rm( ont)tltrircoy1fptrlivsls seuo(o3ou1ol  mnes ()a2raxrpnt0oeen f3iydls raump (4alxrir totoa   ieolt)t2uoimpny1ol n ivsls  rum(m nt4olxo ieiysla2ranmonu0 lenmf3oydfpt  uvolt teur(o iydol nlnctl(f Dur(r nu1aet if3iatlsDeln p u)trtrxo ta1fpteaieo;(0trtoio3ou1al e fetatfs2rr(mpnt1olx ifetas aDrlu pnu)texomo3ty1omD  n i;t trtmiopnu4ap nmivs s)s2rr(mo;o0tpto ociltfmDra( s u)trtomoctodopt aneols) rxoxm oodlle mfctat) Dum(mp;u0opxomf3ildfs rmums;u4 eeomocoa1laDeaivsls  2xmxrpnudomenlicslt srum(rpoo1aexoiocias s ua( o (4trtnmr iytlptr n o s srtoxr io4oltnmnesat  rta(  oo0oee  o3iatfm um( p (4 rxrmf to1fm rlivo;t)trtr(rpno1lleelfvtls s2ra(mp;o1tlx ii3tltfm elumpnt4tleoio3tytfatr uvs;(0 exmxrpny1op nmfctl()s2rrum no1ape  ictasfm el(vs t4 rtoif3iy1fmD  nvs;s)tetmirpno1ole lneiat  rrmu  ;o1tlxoii3tlsfs eauvs t)trtrmrcoadlaDrlivo;s) rxmxmpoydlptelfvt (faDtaxm nt4aeto fctasfm2ra(monu) etomfctadlp   ieolt srxrxo3iodlltnmictls aDtmxm ou4tleoifeilsla2rm(ms;t)aetoxoctatfaDrlnvil( s2urir nodamtemfesat) 2rmxr ou1aex ifeiat a rmump ()aetrxf ia1lp eanes;t0 2umxr oodamenmnci sf 2rr( pnu0apen oeilt s rmums;t4altnmf3tadoateauvil(0 2urxopny4op n fes s)artrxrp;t0opxniociytfmDul( p (0 exnmfctadfp elnvs t) 2xmxmpnydoltnlneia(fsrrru  no4tpt  ietlslsDrmn s;u4texnif3to1omDelivi;t0sruoxo3oo1omte ici t  2raumonu0aptnmieildla umu o;t)artrmr to1oat  iei;(0truoimpiodlpe mfci t artaxmp;o4alxnmf3ilsla eau p;t4 rxrmo iy1opD livi s)setmxr ou1lptemicsl(  rrau pou4aexomfciyt s rln pn()teenmo oodlpDrln s;s srxo(m3oy1lmt  nctls aDumxrooo1optnio3tydls rlu p;u4 rtnio ta1lp rauvi;(  exmxm iudalee feils s2rmxmono1tetnifeiytfmDranmsnu) renio3tatfatrlneo s0 exoimpnydolenmicsat)a2um(mooo1altoiieildfa el( s;t4aetnmo tydop  ln sl( s2urxr nu1lme mfviltf rta(m nt1oeenmi3ildfa el( p u4arenmo3iytfmDeaieo;()t2trxrpiodape mnvsas)sDurum nu4tltomfeiat s2em( p u)alxrmf3iydom eln i;t)srur(m3no4oleemieias s2ur(mo;t1oleoioctas aDrmnvp t)teermfcoy1lm eluvi t t2tmxo3oudoptn ictat)sDua(r no1apxn octlsla ranms t0 rxrio3iytoptrlneo s)seuoxrpoo4aptelivi t  2tmxm ;t4opt mieiltla uluvon(0alxriociy1fmteanvs;(0t2toir nydamte nvs () rrr(  ;t1aetnmi3tat s em( p t4artoxf3oy1fptraieo;() 2xrxm ny1am  mfeil()srtrxrp;u1tpxn f3iad mDrln pn()tlenxr3iytfa  an i (0teur(r nodomt mfvsl( s2trx o;u1oltnmo3iyt s umu s;(0 rxniocoo1la e nvsls srtoirpoo1amt licslt a2rax pno4tpt  feiadla ra(mo;(4altrmf3oadlp eaues t) 2tmimpoo4opt mfvtl( arrm( pot1tpt  fcias s rau s t)aexoir to1omtrlnvs;s  2trimpio4lpenmfesls a2ta( ooo1aeenmo3ias m uaump;t0teeoiocoatlpDeluvs (0texmxo nodlp nlnes s)sDtruro;t1ole io3iltlsDrauvpnt4 rxoxf3oy1laD lnvi;(  2uoim oo4ap   fvtl() Drau pot4ope mf3tld m em(ms;u0trtoxf3to1laDe ivo t) 2urxr oydlp elnetl( s2tmu  ou0aptomiciytlaDemnmo;u4 lxnxo todfm rli i;t0 rto(o iu1llenlncs s  rtrur ;u1tle  o3iydfaDrmnvo t4aetrmrcoadoat  nes;t) 2um(m3oydllenmicias  2ra(moot1apxnmiciatfm2ea( s;t)tleoif tydomt au o s)srxmir3iudomt  fvsa()s2trumont0tpx io3iydlaDel(mon() rtnmfciytopDeaneol(  eumxrpiu4opte fcta(fs2uaxmpnu0alxnifcilsfa el(vo t)trxoxf3tydlpt lnvo;() euo(o oo4op nlivil(  Drmxrp;t4apt mietas m rlumpnt)altnxr3oadoaDrlivi;()trto(opio1ope mivias a2umu oou0tleomo3tad s2rm( o;t4aeenmfciotop r uvo s0t2uoio3ou1aleemnct (fs2rmum nt4alx mfciltla emuvsnt4tlerif oo1opte nesls)t2trxo oo1ope mfet s)sDtruro;t0alen feiydfs2eauvont)tltrxf oo1lm eaues;s)t2tm(r3iu1amt mfciat)arraxrooo1aptnifcilt m2ranmsnt0 eenifcty1faDelu o;( teto(r3nu4altemivia(  2uax poo1oltnmfetyd a2elu p ()aeeomo3ta1lm  aivo;s  exm(o3ou1lmt  ivslt s2ua(r ou0apenifcias aDuln o;u0tltrxr to1lmDe ivslt setrxopiudll e nvi tf rurumpnu0oetoioctatfsDumn on()alxoxo ta1la   nesls0trtoxr3ny1ame  ivt t)a2rm(  ;o4ale mieiydlmDrm(mp u0aleoxf3oytla rlu s;(  etmiopny1omt lfes tfa2urum ot1tet  fetytls rmuvp;()arxriocio1omDe ivo;(0srxoxm ny4lptemfvi t)sDum(mpot0alenifeiys a rmu p ()tetrio oadomtr nesls)srur(mpno1lme mics tf 2tmumo;u4tpeomo3tls sDemu s;t0tlxomr iatopt an ilt)teuoxo3nu4al n fviat)arumx  ou1optnmfciltla2um( o;t0 rerxr ia1laDe n s (0 exoim oo4ap nlfciatfa2rau onu4texoifctlt s rmuvp u4tleoifctadfaD an s;s0s2umir oudlpt  nct (  rtrx o;t4aptn oeiydla ean s;u4 rtriocia1faDeli o (0 exmxm3ou4aleelfet t arrrx pnu0tpxomo3tls a2ranmp;u4 lxnmo ty1fpDr uvs t)setm(o iodomenmieil() 2tmump;u4oee mf3tytlaDuaumo;t)texnmociodom r ieil( t2tmio iudlmtemnesltfaDtr( onu0aptoioetas m2um(vp;u)alenir tytlaDrai i s0 2xm(rpiodllt  ivtls  2rrxr ;t0alx ifciysla el(ms;t)trenmr oa1lmte uvil()tetr(r no1lp e nvta(fa2tmum ;u1opx ioetytfa rl( pnu4trxnmr3ia1lateln s t0 2xrir nu1amtemieta(f 2rrx oou1oexnifctadfsDrmu pn(0 rtnxf3oy1oatr ueo;s0srxoxr3nodame lfvias sDra(rpnu0tpe mfetlsfaDem(vp (0treoifciy1op   u s;t)t2tmxo ny1om  mnctl()srrru  nu0oeeo oeiltfmDelnvs;t)aexoxocoytoa eaueo;s0 eurir ou4optemfcil()a2ua(mp;u0apxnii3ildfa2ua( onu)alxrxf3tatomtelu s t  rxoxopou4ll emivt tfarra(rpnt4oltomf3iat s ul(vsn(4 rerxfciatom rln s t0s2xoxrpno4ome  fesat)aDtru  oo4olxnmiciytfa2ranmp;()artrmo3oy1la eai s t0teur(o oydlmenlfcta( srrrumpou1tex io3tasfm2emuvsnu) eenmrcoodfpte uvsl( setrir ou4opee feilsfarta(mpnu1tetomociydfm rmnms u0trtoxf3totlmDrli i;t t2urio io1op  licsl()sDtrx o;o4olxomfeiaslm uln pn(0arermf iadomDr n o (0t2toxo iu4lmt  ieils)srrm(m nt1tpe mictltfsDea( sn(0artoir3oa1laDr uvi;t) etrxo3iodalee nvslt srtrxro;o1aetn f3tldfs2rmump;(4tetnmrcoa1fpD  u o t0seur(r iudll nlncils  Drrxr ;t1apxnmietldla2ea(vpnt0aexrxf3oydomteaies;s0 2xm(o3oy1am elieil( sDuau  ou0tpt moctydls rmump;t)arxnmf3io1la e n slt0 2xr(o3oydape  neilt sDtmu pnu1opeoii3tysfm2uau p (4aexnif tytoaDrlnvo;t0srxr(opoy4lmtn iviat  2ta( p;o4olenii3tydls2eanmpnu0artrmr io1op rai il()setrxr3ny4ome liei ()sDrrumpno0tpto i3iasls2rmn o t0arenmr ootoaDeau i s sexm(o oodoptnlivtl(f rrm(  ou4apxnmfciys aDul( p;(4tetrio to1fmte u sls0 etmim oudope  ncsa(f Drax  ;u4tlxomi3iltlm2ul(vont4trxrxf oo1lpDranei s t2xrim nu1ame lnct sfsDum( poo4aexn f3iadfa ua(mo;()aeeomr3totlpD  ivi;t teurir3oydlpeelfvsa() rtaxmont1oeen feilt m em( p t0 eeoxf3ootomtelnvi s seurxm3iu1lpt  netas) Dtmx p;u1aetn octas s2rl(vp ()aeerxo oodoa e ueil(0trumxmpio1lpenmicsat srumu  nt0tptnmo3iatfaDrmumon(4 rxoxr tatopt auvols) ruo(m ny1apee fes () rtm(rpot0tlx ifetys m2rm( o t0 rtrir3tytfmDr ues s)s2xmio ny1ape mivslt arumxmo;u4tleomf3ilt a rlnvp;u4 etoioctatlatr i ol(0seuo(m3no1am   nvi s  Drax p;o1alt mfetasls ulnvpnt0 rtnmfciadomtrlivi;s0seuoxm3oodop nmieiltfa2tru oou0olx moctld aDemn o;(4 renxfcoa1fpt luvo;s0seurirpnu4ll emicta()sDrrxrp;o1oet ifcilsfm uanmp;u4 renio oy1fp rlieils)seumio iy4am n fei sfa2rmxmo;u4aexnifetasla eau on(4alxnmf3iatlmD  uei t)trtrxm3nodopee ivsltf rtmur ;o0oleniictydls2rlu sn(4trtnxrciotomD lnei;t0srxrxr3nudap n icsasfs2trx p;u4aexo o3tatfs2rlu p;u)trxrifctydopt  ueo;(  etoiopoo1ale  nesl( s2raurpou0ope mfeiyd mDeluvs t0alxnio todopte nvo;s)t2uoim no4alt livi sf 2rmx pou4tlto ictydfmDrmums t)alxrmr3iytlmt lieils s2tmio oy1lpte nvsls  Duaur no0alx mi3iydfm2rln o u) lxnifctotfpDeaieols  2urir3ou1aleelfvs ()srurxrono1olxomociatfsDel(ms;u4artrmociatlm  aivil( srtm(opnu1apee icsa( aDtmxmp;t4aex mocildfaDum(vo u0 ltrir3iatomD  n o;()srxmxm3oodamenlfctl( s2urxm ot0tle mo3iys m2rlumo () etnmo oa1lptraies;( srurxrpoo1lpe miei s aDtmxro;u4tpt  ieiys s2ul( snu0tlermo3iotoa r i i;(0 2tmxrpoodomt  nvt s  2ur(roou0oleo iciatls rluvo u) exnmf3oytop  aues;s0seur(m oy4olte fvsa() Drrumpno4oet mo3tytls umu s t)aeerif3oo1la rlnvs;t tetr(rpiydll n nct ( sDum(mo;o1tpe  f3iad a ul(vo;u) rtoif3iadlp  lnvs t)trtrxm iy4lme mici ( s2rm(  ;u4ape ifetls aDrmnmo (4altomo ty1lptrauvs;() 2xm(rpou1ole lieiat sDrr(m nt0olxn oetlsfs2ea(vo t)arxnio iadlateaueo;t  etoir3oydlm nlnvt tfs2tau ont0texo icias s2umn s t) lxnxfciy1lp ran o t0srtrxrpiydlmeemfvtltfaDuauront4tpt micildla rau o;u)aeenmr3oytfpDelues;(  rumxm ou4lm  licsas)aDum(rpnu0tpenmf3iytls2eanvp (0tetnxr3iatfpD lnes;t0s2umio3nydamee nctasf rtr(m ;o1aleomoeiadfa eanvon(0tetoxrcty1lm  auvi;t0teuriopny1llen fet s)a2tmxmpot4tpeomfciyt s2ulnvo;u)tetrio3tytfmD aivs;s)t2xm(o3no4optnmfvtlt) rtmu  ;t0oltoio3iytfsDumu pn() renxfcoo1fmteauvo (0teuoxo3iudom e ncia(  Duaur ot4optomi3ilsfm eluvo u0 rtrio iotomtrlivi;s0srum(rpny1omeemfcs ()artrxmp;t4tpxnifctldls2ua( o;(0 ltrmo tatlpDeanvil(0 2ur(r3oudomtn nctl(  Duauront0aptn o3ilsfa2ulump;()alermfciytomtran s s)texoim iu4amte ivtl(  Drmxrpnt4ole mfcilt sDelumsnt0tltrircoodlm   neilt0trtoirpoydam  lnetat srtr(mo;o0tpxnioeiyd mDuaumpn(4artrxr3iadfp e ieo s)seum(mpiu4lp elfcsat)s2rm(  no0aetnmfeilslaDrmu p;t)aexrmfcta1lptrln o;(0trtoxo no4optnlnct s artmxrpoo4oexo o3iys m2elnms;u0artnxf iydfa rli i () eumim3nu4apt mfesatfartm( p;t1tlx  i3ilslm2el(vsn() rtoifctytlm  auvi s  euoxr3no1optnlfvtlsfsrumuroou1tlx  ociaslmDuln s (0 eerxfcoydopDe ies;s)s2xrio nydlp  mfei (fsDumurp;t4apeomo3iysfs ul( o;t)alenmr3iatfm r nvi (  eto(o iodaleemivtatf ruau  ot4apeo f3ias aDrl(mp (4aetnif3todop r ueils0t2uoio3nodapte nctas a2ta(r ot0oeeo fctasfs2ua(mp;u) lxrxf3oytfa rln o;s0sexo(rpny4lmee fcsat  rraxr ot4oeeoii3iaslmDulnmon(4 rxnxo3oodfptrli i;t0 exoim oudalen fcsls  2uru pot1opto i3ias a eanms;t)tlxnxf3tytlm rau s s)t2xoim3ou1opt  ncsl( arra(  ;o4aexniieilsls2ua(ms t)arxrmocoydoaDr u sls0srur(m3iy1opt liei s aDrr(rp;t4tlxn oeiys a2rmu o;u4 rxoxrciodfateaivo ()teuoxm nu1ap emfvsa() Drrurp;u1olt  octytfsDea(vsnt)arenmf iadlpt anvs;(0t2tm(r io4aptnlncsl(faDua( p;u4alxo o3tyd s ra(vs;t)aeeoxoctodla eluvs;t) 2uriopou4omen icslt)aruru  nt4tltnmociys mDrlu pnu0artnio3oadlaDrlu i t  rxrim3nu4lm emietat)aDtau poo1oee  i3iysls rlu p u4arerircoadomD anes;() etoimpio4ap nmfci tfsrur(  ou1aptoiicildfa uaump;(0 rerxr3todom rlu sl( t2xoiopiu4lm   ivils  Dra(moot0texomo3tytfs2ulnvo;t4texomr iodomtelneil( tetr(r3oo4lmte feiasf Dum(rono4tpxo fetlt a ulumo u0 exoxr3ta1lptrluvi s sruoiopno4lm  mnesl( sDrr(  ;t0olt mietad m rlumsn(0tlermfcoatfptrau o;s0setr(opoy4opeemfctas)aDrmxro;o4tpeo fctadla2rmn p;u4 exnmfcoa1laD  uvsl()setm(rpno4alt  nei s)arrmxm ou0apxoio3tatfsDraump;()texomr3iydoa r uei (0trurir3nydlmeemict sfartm( ono4ape ioctasla uanvpn() leomr iatoateaivs;t trxriopoydap  lfcsasf Drm(mp;o1oltnioeils aDrmuvpnt)artomrcto1fat aueil(0 2uoxo3no1om  lfciat)srumxm no1aet ii3tlsla2eluvont)tlxnxo3iy1oa rauvo s0t2xoim io1op  mieia() rur(mp;t1tee iociadlm eaumo;(0alxnmr oytfmteaueols sruoxo3ou4opeemieias  2um( pou1tlx mf3iatfmDelnvsnt4 rxrmr3ootlp r neo s) rurxrpnu4ole lnvslsfa2uaxrp;t0aeenmoeiydlm um(mo;(0 etnxf to1lmD livo;t  2xo(r oo4lp  lnvtl(fs2ta(monu4apx  oetydlm ul(vsn()arenir3ia1lat auvol()sruoio3oy1lm emfes tfaDtm(  no1oex iietad a2ulu s u)trtnxrctodla r u sls sexm(m no1ol emfvs t)srtru oot1oeenmi3tasfm eauvs;t)aetoio oadlptrln s (0s2toim iy1lp nmict sf 2raxront4alt ifcias s eaums u0 eerifciydomD li sl()sexmio nodoptnlncias s2ra(mpot0tlxomiciatfaDrl(mo;t0aeerxf iytoa raivs;()srurim iydamtemnci t s2rmxro;t1alx miciytlaDrl( s t0 rxomfcto1faD lnes () etm(opiodll   ivi () 2uaxmo;t4opxnifeiat s2rln o;t4texrxo3ia1fa   iesl( texo(rpnu1amtemfetat aDtr(mo;o1olx ifcilt m2emu p;u4trxrmfcoatfa rli olt  eur(r3ou1alee nes s a2ra(rp;o4alxo octltlm um(mpnt4aeenmfciadfa r nei s trtmimpnu1apenlnctl(faDrruronu4aex  i3ias a2rauvs;t0tlxnmocio1fmtrlneo;s s2uo(r3nu4am  lietat) 2ururo;u1tltnmiciad s2rluvont0 renir tadfpte uvi;t trxmir3ou1lpenmnet sf Dur(mp;o0tetnmoeilt m2uauvs t)altoio ootlmDrlies;() rum(o ou1ope  icslt srrr(rp;o1alt mfcilt sDrluvsnu)teermr3oytlm rli ils)s2uoxr3iodll emnvsas)aDua(root4olen ieiltls umnvs (0texnxo oy1lpte ivs;() 2umxr3ou1lltemicsls)sDtaxrpnu0texoio3tytfmDelums;u)teerxr to1fpD luvi;t s2tr(m3oydap  lnvtlt  2rr(r ;o0olt  oetydfa ea( pnu0tlxomo3oydlptelnei s) 2tr(o3ny1lm  licslsfa2umxmo;t4opt mfciydls umu o u)aexnifciotomtrlneo s  eumxr3ny4olenmfvia()arumxro;t1tpt  feildfaDeluvs;u0 etrxr3totfmDrlueols texoir3oo4lmt  nvtat)aDuru ont0tex iieiysla rauvp u4artnif ta1fpDe neols0sruoir3iy1amt lfci s a2ra( onu0apxnio3tlsfmDul(vp () ltrxo iy1omD  ivsls)trtoir3iu4aptnmfci s a2urxm nu4apxnmoctyt a2rmuvo;t4 lxrxocoatfm e n o;t teurirpoudoltn fvsl(  rtax onu0oltoifetld a umump ()tlerxf iotfp eliesls)s2xoxo3oy4apenmfvs tf 2ur(m ;t4optn i3ilsfs2elnmsn()alxnxocty1lpt au ols) 2xm(m3io1llenlivsas) rtm(rpoo4tptn f3iatfa em(mont4trtomrcoo1lmte nes;s) 2umir iu1altn nvsat) rtr(m nu0aeeoiociydla uln p (4 rxoxo3oodopDraueo;t)s2tmxmpou1amtelfviat  rururpoo1oltn o3iatfs2umums t4altrxo3tytlm r u o s)truo(r3iodap emieiat  2ua(  ;o4tetn f3tas m eaumpnt0 rtomo oydfatrai sl( trtmxr3oy1lme  nvtlsfsDrru  no0apto o3iys m2umuvs;u4 exniocoydfp   uei;(  exmxo3nudoltnlnet s)s2ta(rpot4apt  i3tatfaDemumsnt4trermrctydlaDeluei s)trxrirpoy4amen nci tfsrurxrp;t0alt  o3iys sDua(ms ()tltomr3iatlm r ivil() rum(o3ny4alt lnvslt a2rru  ;o1tex if3tlsfsDel(mp u4treoxo tydfm r u o;t  2xoim3oudomt  fvs tf rrax  nt1alxnioeiadfaDua(vs;u0 rtnmociy1laDe nvol(0 exoxopno4lpe  nvi ( a2uaxmoou1alxomi3iasfs2rm( s;(4tltoio3oy1fp  lueslt seuo(m ou1lpe  neils)a2uru  ot1opt mf3iyt m2umu p;t0aleomo oytfaDr ivil( sexmxo3iodalt mivtas) 2ra(mono0tltoii3tls s ean snu4trxnif io1lpDrlu i;s)seuriopiy4lmenlfcsls) 2rmu p;u4aexnmoctldlm rlnmsnu0aetrir iadoa ean olt)trum(mpio1lmenlfvsas)sDrrx ono0aexo octys mDum(vsnu4 ltnir3ootlatr nvs;(0teuo(r3oodlpt lfvi t)arrmx o;o0optnmfeiadls2rluvs;(4 etnxf io1fa e ivo t) 2urirpoudopt  iei t sDtmxro;t4apxnmoctyt mDrluvon(0 lxoxocto1la r nvs;(0 rxoio ou1lpe  fet sf Dra(rpno4aetoii3iat mDumuvont)aeeomfciatlmDeau ils0t2tr(mpiydlpee feia(f Draxmp;t0tlxomfeiltlsDemu pnu) exnxr3tadlmDeaieo;()trum(mpiu4optnlivslt artaxmo;o0olxnmfctadfa2umnmo;t)tlerxr3oa1oa eaies;t  2xmim oo1ome lncsl(fs2rmx o;u1tpx mfeildls2rmu snu)texnir iytlp eaivolt t2trimpnudaptnmfcs s)aDuaxmpnu4tlxniieilslmDum( ont)aetomrcoo1lp eai il()t2tmirpiudaptnmnvt tfs2tau  no1aeenmo3iyslaDel(mpnu0aleniocoydlp  lnvolt)t2xoir io1om elnetasf rumxmpoo0ole mfetadfa ea( s;()tlenxr iadomDean o;(0sexoxr3iy4lmenmfvs s) 2uaurp;t0apt mf3tlslmDuau p;t4aetnmrctatlmteaneil( s2urim iy1op  lfet t  Drau p;u1olen o3iadfaDumnms;t0trtrmf tytfptrlueo s  eur(r3iu4apt livil()aDur(mp;u1oltnmietadfaDemu o;t)alenio totlp eau il( t2xmxopny4ale  icsat  2uaumont0oltnmoctys s eluvpnu) etnxo to1lpDeluvo;t)t2ur(m iydol nlnvi s  2rrxmp;t4tetnmociydlm uln o;t)arxnxo3iotlp   nvs;t)seto(o3iy1lpen ics (f Drmumpnu4openmf3iyd sDra(ms;(4 rtrif tatoaDe ies t s2trxrpnu1amee nes s a2rr(mpoo4oet mociysls eaums u)tetnir3to1fm eaivolt t2ur(m ou1ap e iei (fa2tau pno1apxo fcilsfa2rl(mp t)aetnxo iytfa  anvsls) rxoio3nu1apenmnctas sDraxmpno1aleo i3tasfsDul(mpnt4aexrirciodoptrli ils  rtr(rpiydlleelfvi ()a2umur ;o4tlx io3iat a2uaums u)arerxocia1opDranvols s2umxopno1om n ieta(fsrumx pot0openmoctltlaDuan p (0 rxnmrcoo1oa ean o;t s2uoxr3ny4apee icil(f Drmurp;o0tlxo ieiat a rmnvs;(4 leoio3oadom  an ilt)s2uo(r io1lmee nvs sfsDtax ono1tpxoiicildlm emuvs;t4 exoir3ia1oaDe i o;s0 rxmio iydopen nvsasfs2urx  ;t4oltniieiasfa2ul(vp t4 reoirctotoat anvsl(0trurio3nodll emictl(fs2uau  ;u1olt mfcild s ul(vo u) exnxfcty1lateaivi;t0 rxrimpiydop   nvilt) rum(m nu1oexomiciysla rlnvon(4 etoxr3iodfpDraues (0trtm(m iydlpeelfvs t  rtrx p;o4altoiociasls2em(vpnu)altnmo oadlat livs s)sexr(m iy1altemfctas)s2uau pnt1ape mi3tldfa2em( p t0alenio3ta1fm eaies ( trxo(m3nydol n fvsat)srra(ronu4tlxomoeiydlm2emump;(0tltoiociytfaDelu il(0s2uriopny4ame mfvia(fsrum(ro;o0tpt  fciytlm2uln s;t4arxrmr tatlpD luvo;( s2uoirpnu4lmeelietlt a2tr(mpnt0tee  o3ilt aDrm( o ()tltomf oytfmteaivolt) 2to(r nydlpeemfviltfs2trur ;u4olxnio3iadlm rl(mp;u4artomoctadfmDe nesls) exo(opiodalenmfcias) Dtm( ooo4ope  o3ildlaDem(vonu4aeeoio oy1lateluesls0texoxm oydlp elieiat sDrmxm nt4tleomfciyd s ul(vsnu4 lerxr iatlp  lues;(0sexrirpnu4om n ncsl()sDurx ooo4tpxn i3iadlaDeaumpn(4 ltrxr3iy1fa e n slt0 rxr(r3oudopeelivtat)sruru  ;u4oeto oetatfs2rmn s;(4aexrmociydlpDelnei;s teuriopiydame mnct tfs2ra(  nt4aex moeiadls ea(vp;(0aeenmrciytomtrln olt) 2xoimpoy4omeelfcsl()artmu  ot4olt  i3iat sDelums;t)teenxr3iytlmD ln o;t) euoxopio1ol nlnvta(  ruaump;u1tpeo oetlsla rlnmp;t0alenmo3oytfaDranvo;s0 2uoim3oydlm emfcil( arrr(r ot0opto o3iydlm emu s;(0 ltnxr iy1fptrauvo ( s2xo(rpou4lpt  icilsf Dumuro;o4ale iietydfm rmnvp t0alxoxo tydoate nvs;t0 2trim oy1lmte fvsatf 2tax  ou0openifcildfa uan s;u0 lxoirctatlpDean olt)t2tr(m nodlp e icilsfaDta(r ;o0oltnifetlsfaDemums;()texnxr3oatoateanvol(  exrim3io4ap n ictlt)arumu  no4tpe  i3tasfm rl( o;()tetoifcoodlp eln o ()srtrxr oodapt liei t  2rr(rp;u1texomf3tlsfa2rl( snt0artrifctadlmtrlneolt0 eur(rpny4op   ivslt)s2uru  ;o0tlt mfciadfmDua( pn()tlenircoodfat  nvo t s2xmxrpiudlme  feias aDrr(mp;u0opxn ociaslaDulnmp;() exomo iodfm rai o s  rxoim iodapeelici sfsrua(m nt1aex ifctyd s el(ms;()tltrxo io1fmDeauvo t0 2xrxm3iydopt mfctl(f 2ururono0tlx ifeiatfm rm(vsnt)texoxfciy1lpD anvils)s2trio3nodopenmicil(  rtau o;u4apt  fciyt sDrm( o;() rtnmo io1lptelneo;t0s2um(o nodolt lnvsl(f Dua(mono4tpe miciyd s2ua( on(0 rxnxrctytlptr nvolt0setmxo nodap nlnct sf Dumx ono0aexn o3tad mDua(vo t)artnxo3tadlate ieo (  2ur(r3iodll nliei t) Dum(mpot4ape io3iltfm2rl(vsnt)teermfcoy1laD auei (0s2to(rpoo1lpe lfct sfaDrm(  ;o4olen oetydfm2umuvs (0tlxrmoctotoatr iei;(0srurxr iudapte fvsl()a2um(r ;t1tee mieiasfmDemn p u0treomf iatfp e uvsls) 2xrxmpno4olt  ieilsf rra(rpoo4tee mf3ildlmDuluvp u) etrxr3oatlmteanvs t0teuoxr nydll e ietat)arta(mp;t1aet ifeiatlaDulnvs u0texnxf3ootlp  lu s;t texmirpio1am elfcsat) 2umu p;o4aexoiiciysla2em(vs;u4teenmrcoo1lmDr nvil(0truo(r oudomen ivs s)s2trurp;o0tpxoif3iatls um(mon(4texoxfciotfpDelieo s srumxrpio4lp nmfcs tfsrrru ont1apt ii3ild m2eluvsnt0trenmr3oadfaDelieslt0teurio3io4ol e ietatf 2rrurpnu0aexo feiasfa rlnmp t)artoxocoydfpt aueo;() eumxr3nudal  mnvi (fa2rrum ot4tetn feildfsDuan p t0trtrir oo1oaDe nvolt teurxm3ou4amtnmnvsat aDrrxrpnu4tpt moctlsla2rl(mpnt4alxnxr oa1fpte ueo ()setoxrpnu4lptnlfvta(f rurumpot1oex ii3iad s rmuvpn()aexoxrcoytomD auvo;t0sexmxr iydlp nmivs ()s2rru p;t4apx mietlsfs uaump u4texoxr3oydlptranvs s0texoimpiodlptelietls)s2raxroot4texnmi3iadlmDrl( o t0aexoxocio1omDe nvo;(  eurxrpoudomt licsa(f Dur( oot0teen ieiysfs2ea(vo u4artnif iy1late nvs s)t2toxmpiy1am  lneils) Duru  ;u1olx if3ildfaDeanvp;u4alxnxo iodopDeliei;s0teurio oo1ol nlict t sDtmum ;t0tltnmo3iltfsDuanms;u0trxomf3ta1oaD livsl( seum(r3oo1llte ici s)s2ta(mpno0oltnmoeiadlaDrauvp;u4 rxrxrcoatop  aueilt0srtoim nu1lptnmfvi (faDua(  ot0aleoii3iyd a2ulump;()arerxocoatlpD lu slt  2umxo3oy1ale  neias) rtr(m ou1texnmfetltfsDuln on(4 reomrctatoa r neilt  etrxopoydape mfvilt)a2tm(ro;o0openmfeild s2rln s;u0tetnxf3ia1laDrai o;t)trum(mpnudlme mncil() rtmxmpoo0tlt io3iytfa eaums;u) ltrxf ia1fmD an slt seum(o nodamtnlncsltf ruax  nu0ape if3tydfsDul( p u) eeoif3totfpDrauvo;() 2uoim io4apeemivi sfaDurumono4tet ii3ils m2eluvp u4 reoxfcia1omtr neo (0 2urxm io1apte fcils s2urum oo0tlx mociaslmDrmuvp (4alenio oo1lat liei;s0s2tmxopnu1am elneilsfaDtrum nu0aeen f3iat mDrmu sn()altomr tatom raies;t t2xmxm3iu1ll  micilsfarumumooo1apx ifciysfm2umnvo t0arxrxr oatlat  uei ()setoimpou4lle lfvtas)aDtmxrpou1texoifetytlm2ua(mp u4arenirctotfm elu sl(  eto(opio1op emicsl( aDtmumont1ale  f3iyslm rau s u4alenmr3oa1lat ai ils0seur(mpnudolenlnet s) Draxro;u0oet miciyt s2rmn p (0tlerif oytlaDeai s s)srxm(r3ou4ol e nesls) rrmu  nu4oeeoioeiyt m2uanvo u4tetnio3ty1fa e uvil() ruo(r3oodal nmfvtatf 2tmx ont1texnioetys aDran onu4tlxnmocoydlpDeai i;s) 2xo(r oo1lmeelictl(  rtrurooo1oltomf3iltlmDrauvs;t0alxrmrciotfm rluvsls t2tm(o3iy4altn nctls  Drruro;u4oeeoiiciatls rlnmo;() etoifcootfmDr ivilt t2uoim3iy4lpt  icslt s2rrurpnu4ape  ociyd a2uaumo t4 etrxociy1oaD lues s) 2xoim3oo4omt lnes ()sDrm(rp;t0aexn fcilslsDrmu s (0tetoio ta1fpDelieols srurxrpnu1apt licsa(fa2rm(mp;o0olxnmiciltfsDrmn s;u0aexrmrciotfptran slt0trtrxmpnu1ale  fei t) Dtrxrpnt4aex ioeiltfm eanmon(0 eermr3ty1om ean o;s s2to(m oy1lpt mnct t srtaurp;u4tpe iiciasfm umnmp;()altomo tytlptelnvi;t  euo(r3oo4open fvsa(fs2urur ;o0altnmfcild sDrlnvpnu)trtoxfcia1oatrln i;s t2xm(o3nudamt  fctl()aDtm(rpou4tetnifciatlm rm( p;u4 eeoxo tadoa r nvs;t0t2tmxr oy1lp elnciatf 2ta(m nt4tpxniieiadlsDraums u4alxoxo3oydfm  aueilt)seto(m3nydopt mfcsat sDum(rpnt0aee if3tldlaDemnmpn()trenxo3tydoaD liei t) 2xr(o3io1olen fetasfsrumuro;o0apxomoetls m2ra(mp;u4altomrcia1oat aueilt)texoxrpnydapenmfctasf Dta(r ot0opx ifctlsfm rmnvp u)alerxf iy1lmD  i i s)trtm(o ou1apt lncsl()aDrrxm ;t1opxniociyslsDrl(vo u) ltnmo3iodlmDeaues s0s2tmxm oo4ame  ivtlt aDumxmpoo0aetoioeildlm2emn s u0 eerio iotla   n il()setoxrpou4optn ies s)aruaumo;u1texn f3tldfaDumnmsnu)alerir iydla eau o t0t2xrxm3no4ome mfetatfaruau  nt0tet  ociysfm2rlu snt0arxnmo oa1faDrau i (0s2uo(o no4lmtemivtltfarra(m ;o0alxnmicias a umu s;()arxnxrciydlmD auvi;s) ruoxo oy4ap elfvta(fsDumxm ot0tet if3iltlm ean o u0tlxnmo3iotopDeaneil()texrio3io1lpeelfvsl() ruaxrpnt1oltn feilsfa2ra( s u4 renxo oydlm  aneols0s2umxr ou1amtelfvi t a2uru p;o1tpxomfeiytfsDua(monu4 lxrxr tadoat lnes;s  2toxopno4lmenmnvsat  2umxm nt0texo feils a emuvs;u0 lerif tytlaD  uvs;t0t2uo(r io4omtnlfeilsfsDrr( pnt0alx iieias mDum(vonu0trtrmf3iadfptrai i s0s2xrxmpny1lpt mnvt s)aDum(  no0aleo o3iltfmDumumpnt4aetoir totfpte n ilt0seum(o iodam n iciltfsDtaumoou4oleo f3iad aDrm( s t4aeeoxfcoatlat  i o t t2toxr3nu4lmtnmnvt sfsrrr(  nt0apxn iciytls rl(ms;u)tlxrmf oytla ran i;t s2xrim3ou1am   neia(f Dur(rp;u4apxomf3iysfm elnvsnt) reomr oa1fatelu ols) 2xr(o3oy1optemnct t)s2rrur ou0apxniieiys a2um(ms;t) etoxo3oatomtr u o t0 2um(rpnydlpt livils) Dtr( oot1apenif3iasla2umu onu)aetnircta1fpte u olt texrim3oodamt  nvtat a2uaurooo4opeo octaslm2uln pn(0 rxrio iytlpt an s;t0 exrio3oo1am   ivilt)srur(  ot0tex  i3iltfs ul(vp ()aleomr3io1lmte nvolt) euo(r ou4omteliet tfs2tru ono1opeo ieilsfs2uanvs;u4arerifcoatop r neo t0trtmxr oy1ap nlivtls srrmumoot1oee ifeildfmDuln pnu)aetoio3oodlmtelnvi;s texrio iudom eliesat) Draxmp;o1oleo o3ildfm umuvsnu0trenif3tadoateaivi s)trxoxr3nu1ale mivs s)a2tmur ;t4tet  iciysfs emu s t0 rtnxf todopteau i s)srxm(mpiu1ale mfvsltfsrurxr ;u4apxo f3tadlm um( ont0arxnmr tytfatrlnvi (0 2xriopou1am  miet ( artm( p;t4olxn f3iasla rln p;u4aleoio3totla eaueo;() 2tm(o nydol  mies t aDtmxmp;t4alen i3tytlm ra(monu0tlerxf oa1fpt aieil( trumxo3iu4lm nlncilt sDrmxr ;u4tlto ietatfm2rm( snu4alxnxo3tatfm  auvsls0 rumir3oo4ll e ivtat arta(mp;o1tltn ietyt s2rl( ont)alerxfcty1lptrauvolt0 exrxr oo4lp  mieslt  Duaxrpno0alen icilsfa emn s;u)altrifcio1fp elu ol( srtoxo ny1olen nvia()aDua(mpot4apt io3iasfa2rmnmp;t)arxrxf oo1lmDr n ols teum(mpoo4ale  nvt (fsrrrxrp;u4oexo ocilt aDul(msnt4teerxfcoodop e n o s  rtrir3ny4ol nmfct t aDum(rpou1aee micilslmDelnmo (0 ltrir iatoa   n sls) 2tmim3ou1al   fctat  Dtaumpnu1texo iciyd mDrm( o;t0aeerir iadopt aivols0 2urxmpoo4am   nci (fsDrauroou1oetn f3iltfm rln s t4 ltniocio1fatelnes t seurxm io1ope  ivil(faDtmx ono1tptnmfciys m2uln p () eeriocoodlpD aiei ( t2urio3iu4llt  iesl(f 2rm(ro;o1tpxomo3iyt mDrl( p;(0 exnxrctotlmDr u il(0s2xr(o oydom  lnesa() Dtrumooo0aetomfctlsfa ea(msnt0aeeoxrctatfmte i s;t s2tr(r oo1lm nmfeia(fa2tmxrpnu4oexo feiltfs umumsnt4altnxrcia1fpte u o s trumirpnudale mfvtl(farum(rp;t4olto fetad a2rm(vonu0 rxomf io1faD  uvo;t)trur(o3iudamt  net sfaDrruro;o1ope io3iltls ulnvs u4artnio ia1lateli s ()trtrim iodameemivsa()arrru oou4tlt mo3ild aDel(ms;t0tleomf totfa  ai s s tetmxm3no4ope mieiatfaDta(m ou4aeto feiytla ua(vpnt4artoio3ootlpteanvolt0srum(o3no1am  lnctat) 2uaxr oo0teeoioeildfs2el(vo u)areoxr3ta1lmte iei s)t2xmxm3iy1lltn ivsa()artau ont4teto ieias mDum(vs;u4artoiociodlp eliei s  ruo(rpiodapee ictatfa2uru oou4tpxoiieiytlsDran onu)aexnmf3iytfatrlu o t0 etmxo ou1ap   iesas a2ra( poo0aetn fciltla2umump;t0alxrio oydoatrauei ()teumxopnydolt mncsa( artmxroot0openifciytlm rmnmp;t)trtrmo tadlpt an sls seumxopnydape livi tf Drru pnt4tet ii3tld a emn o ()tlerio io1oateaueo s trumxopou1lltn ivs s a2tr( oot4oltoiociytla ua(vpnt0texomr iodoatrauvi;() 2umxr3oodlmtelnvtlt  rrm( ono4opeomoeiytlm elu p;t4 rtoif iy1fatrauvo;s0 rto(m io4apee ivilt)sDrau  ou0tltn fctls sDranmp u0aleoxocio1oat ai olt) rxoir nydomtelicsa(  rtmu p;t4olxo oeiyt aDumump u4trxnxfcoo1lpte iesls)sexr(rpoo4apen nvt sfsDua( o;t1teto fciyslm ul(ms u0aetrxf3io1lpDean o ()srtoxmpiu1optnlieilsfarurxmpnt4oleoifeilsfs emnmsnt) ltrmf iadfaD aivilt setoir3ou4amtemies s)sruru pnu1tpt ii3tad a rlnvpnt4trtnir iytoa  aueo;s trxrir oy1lme  nvt tfarrmxmono4oltn i3ildfaDrauvo;u0 eeoxr3tytomt livs ()texo(m iodapeelfvslt  2tax p;u4aee mf3tltfa2rl( p;() exnif iatomt  u slt t2urxopoo1al   neiasf Dtm(mo;u1oexnif3iytfa elums (4texoiocoodfate i i t0tetmxopou1ll nlneta()aDraump;u1open oetadfmDrlnvsn(0 renxf iy1lpt lies;( sexo(m3io4apeelnvt tf 2tmurpot0alxnmfctldlm2rm(vp;u0 eeomfcoydla  lieols)s2trir iodllte fvsa(fsrtruro;u1texnmociadfsDum( o (0aleomoctotfm r uvs;() rxrxo no4lp elnesltfsDrrum ;o4tlxnii3iltfsDemu p (4altnmociytop rauvo;(0teumxrpny4lpee fet s a2trxmoot4tetnifeiydlm em(vpnu0 rtomfcia1omtranvolt0 rtmxm oudameelnvsl( s2taxrono1aexo f3iyslm2eaumpnu0 rxnmrcoodlmtr nvsls0s2ur(r3iu1lme lfvt (faDtrumo;o4apt mfeiysfsDemumont0trxnif3iotlpD aneils sexrxmpoy4lpenlics s) rtruro;t0optniictasla rlnvo;u4trxoxr iotlaD  i s;t  rxmir3ny4olenlivta() 2rax pno4ape  feiydlm el( ont) renxf oodfpt luei s)s2xmirpoo1al  mivsat)aDtm(r ;u4tpxoioctad a2rmumo;(0areomoctodfmt  nvols sexo(r3oo4ap n nes ()srtax poo4opt mieiytlm rlnms;() rtnio ootomt livs;(0t2tmxo3io4lptn fvs (faDtr(  ;t0apen fcilsfs ulu s;(0tlxrxfcoytopteau i;()texoxm3nudole mnct sfa2tru  nt4aee mf3iltfsDra( p u4 etrioctotfat livo t0seto(o3oy1om  mnctat) Dtmxmp;u1ope mfetad s rm(vo u)aleomfciy1omDrlivils)s2trxo oudopenlnvi (fsrtmxm ;u0altomociysla ul(mp;u4 etrxf3iy1om  anvo t  etrxo3nydll  mnetat  Dtau  ;o0apxo ietls mDrln p t4 lenmr ia1lat aieol( srxoxm ou1ap emnvtat  2trx onu0oltnmictls m rauvp;u0 ltomociatoa e ueil()srtoir3oy4lptnmnvi s  2ur(ro;u0oexn icils a uluvo;t0texoioctadlaDrli ols0t2xoxm3no4lm nlies tfartrxrooo0tetoiicildfm2rauvo (0artoir ty1op elneilt) 2xo(m iu1lp   fvtltfa2rrx pot1tpto f3iat s rmu s;(4artoif to1fp r uvo;s  rxmxr iy1amenmncsa(  2umumo;u1alto icilsfmDrl(vsnu0tltnxfcoy1om rai i;s)trtoxo3iy1oleemfcslt  rrrump;t0alxnioetatla ua( sn()tleoio iotlpDr ivs;s)srxrxrpoy4lpenmfcsat  Dtax p;t1alxniiciltfs rm(mp;u4 lxniocootfm rlies s s2xmxm3io4apt  fvs s aDtmxr ;u4tleomfciytfs ea( s u0 ltnxr3oydla eanvi;s0 etr(opiodlle licslt)arrm(m ;o0tleoifctat m uanms;u) rtnifcta1om  luvols0 2tmxm3iudlptnmnvtl()a2ra(rpnt4ale ifciysfa2rauvon(0aeeoxfcoo1om eanvs t)t2xrxo3iu1ole lnctl(fsrtm(m ;o4opx ii3tas aDrmn s t0 eerxf3ta1om r u i;t0s2xmxrpiodomeelivt (fs2ua( pno0tlenif3iat a2eln o t4aleoiociotlmte i o t)seumxm nodlmtn nvsl( s2rruro;o0oee mo3iltls emuvon(0aexomocia1fpDr u sl(0s2xoxo iy1op nlnesl(fs2ua( ont4tetnifciytfmDel( s t4texomf ta1latrlivs () eumir3oo1amtnlfesat  2rmu o;o0oex mfcils a2rlumpn(0artnifctytfat lueol() etrim3iodlltelieiltfarrmur no1tptnmf3iasla ua(ms ()tltoirciadfa  ln il() etoim io1llt lneiasf rumx  ot4olxomoetytfm eluvs;t0 etrif3oatlatr ieo;t trumxmpou1apenmfctat)aDumum oo0aeeniieiyt s uan o t0aexoxf3oytlmDeaueol()t2umxr3nu1lme mfcsatfarrr(m oo1aet mociltfsDuau s;t)teeoir iatlmDr i s;t)setoimpiu1lptn fetl(  Drr(rooo1olt mfciytfs rm(vo;(0aetrxo ty1omtr u o;t seum(o ou4apeelnviasf rrmx oot4oex mfciadfs2rm( o t4 ltrif3ta1op r uvils sruoxm3no1alee nvs s s2urum oo0oltoiieild m2rluvo t0texnmr3oodomDeln i;s)sexr(r3oodlmee ivsatf rrmump;u4tlxoii3iyd m ean pnt4altomr3tatlp rlueols)srumiopiy4ol elfvs t srurxr nt4olto oeilt s emuvs (4altnif oodlmtrau sl(0trxmio no1ap  mfeslsfsrra(m ;u1aetnmi3tysfaDumn o;() ltnir3oatlmD li il(0t2tm(r no4omee neilsfsrur(ronu4alenmociyt m um(ms;t4altnmo iadom   nvilt  eumir3nodlpenmfes ()sDur(ro;o1tlxoiociadlm rl(vs;(4teenir tatla eaivs;s teuo(o iydoptnlnvtl()arrrxr nu1tlen i3iadla2ra(vpn() eenircta1fat  uvils0 eum(rpnodlpee fciltfs2tmxmoot1tleoifeiydfa um( p;u) etrxr tydlaDelueslt0s2umxm nu1op elicia( srumur oo1aex iieiatfm2um(vp;u4aetrmo3oy1om   uvs ( srxoio3ny1ape micsatf Drr(m nu1oltnmo3iad a2rauvs (0trxrmo3iatlaDeaiesls  2tr(r io4amtelnvt ()s2trxmont0optoiiciytfs umnmp;u0 lxoxf ty1om  lneilt0 eumirpny1ameemnvi (f rumxr ;t4tltn iciysla raump (0 eeoio iytfpDelivo;t sexmxo3nu1om e nvilt)arraum ;t0tet ifeiltfm ulu p;t) ltrirciytop rlueo;t  rtoxmpou1omen fesat)srumu  nu4aex mf3tlsfs2umnvp t)tlxnxoctydlm e ivo;(0s2urxm3iudll  lfcs ()aDtm( ooo4olxnioeilsfm rln o;(0tetoxfciy1fp eaueo;t t2xr(o iy4optnmfvtatf 2ra( p;o0aet ifciydfa2eanvpnt4tleoio tydlmDeau sl(  exoirpoo4om elivsls)aDrm(rpnt1tlxoioctadlsDea( p () eeoxf3io1om eaies (0t2toxo nu1ol elfvsat srrrur no1aee moctys aDuln snt0tltoir3to1fate nes (0 2xo(rpio1lmee nes (faDtaurono0tpx  ociasla rmnmonu) rxoxr to1om eluvi (0texr(m oo4lp  mfctat sDtaumpnt1apx mociyt a rau o;t0arxoxociydfaDrln i (0t2xrxrpoo4lp elivi (faruru p;o0aee mocilsfa ra(vp;t)artnio io1laD aivi;t)trurim oo4ape  ncia()a2umum ot4alxo ietlt a2um( s t0 lenxf io1opDrai ols)s2xrirpnu4llenmiet (  rrru  ;t1tle mieias m2rmnmo t4 ltnxr3oatlpDrlueo t0srxm(mpno4al nlnetas)s2uax o;u1openifeildlm umnvont0tlxrmo3oodla e nei s)s2tmxm nu1ap nmfcta()aDrmx  ot0alx ifetasfm emnmon()arerxr oatlmD  nvo (  etoxm iydopt  icslt)sDtauroot0oltn ietatfaDumn o;t4teerif iodfm  an ols teuoim3nudapeelictlsfartaxroou4tpen ociaslsDrl( s;u0artoxr3oatlm eanvo;s  euo(rpno4lle mfvtls) 2rmxroou1opeomiciatlaDul(vp;(4alenxocoydoaD lueo t0teur(r oodapen fvtlt sDuru onu0tpenmictyd a umn o;u0teermr ty1fa   u ils0 2xmimpnodol   ivia(  2tmxmpno4alx ioctlt m2rm(vo () etrxr3iytopt  nes (  etm(r ny4al   fvt t)srumxrpou0alt  fetydfsDumnmsnu4 eeomo3iadla rlivo;(  rtoxm3iy4ol nmfci (fs2ta(  no0apeniicildls2uln s;u)texrir iydfpDeauvi;t)srxr(opiydll  miesa(  rtmx poo1tlxoifctls sDuan on()altrxo tytfat auvi;s) rxr(m3nodlle lfvtltfaDurxmpot1aet  i3tas m emu on()alxoxo3ty1lpD  uei;t) etm(m ou1lme  fcsl() rrr(roou1oltn o3tltls2uaumsnt)tlxrxo3iotlaDrlivi s0s2xr(o3nu4amt licsat) 2umu p;t0tleomociyd s umu s;(0tltrirciydoate u i;s0 exrxm iu4lp e icta(  rtr(m ;u0ape mietyslm rlu o t) etoir io1op rlnvol(0 2uoim3ny4ome lietltfarumur ;u4aptnif3iydfmDrln s (0arxnir3oy1lpDranvi ()trxoxmpno1olt  fcsatf 2tau  oo1aptnmfeiltls eauvo;u4trtnmocoatlmDe uvi s)setr(rpnydap  lnvia(farrr(m nt4oex iicilsfm rln o;t)trxomr3tatoate uvsls  exoxr3iu1ope lici ()artmxrp;u1apxn i3tatls2rmu o;()teeoxr tydoa eanes;s s2uo(o oodolenlfesatfs2tmu ont1tpt mf3iatfa2el(msnu0trxoxociy1lpt luvi s  eum(rpou1lpte netltf 2trxmpnt0tlxn oetld m2emnmp ()artrxrciydlmt  ueslt) exm(r3iudalt mnciltfa2tru oou1opx  i3iydfsDumn p;u0 lenmrcoadlatranei s) etm(m iu4am   nvilt aDumum nu0tlx  oeiltfs2elnvs;u4trtnxr3oodfa  lnvo;t0trtoim3oodalenmfetl(fa2raxm oo1texnmfeils sDul( snt) ltoxrciotfat li olt s2xr(r3nu1omenmicsat aDur(rpnu4optomieiasla2ulnms () rtoio3oytlmDeaiesl( s2tmim iudom  mncias)a2rmxronu1apeo oetadla2rlnmpn(4aetnxf tytlm   n o (0 exr(r no4ap   ics (  2rm( o;o1tee  ieiytls ran o t4tlxrmfcia1la rli o;t t2xoio3nydol n ivtat)s2ta(mpoo4olx  o3iat s el( p;()teenxrctotfaD anei (  exo(o io1lmenmnvi (fa2tmx  oo0tex  fciad a uau snu)trxomr3ia1fp eauvo;s0s2xmim3oydom n feiat srtau  nu0aexo ociadfsDulnvpnt) eenmr3iy1lptr u s (  2xoxo3iudomenlicsl( sDrr(m ;o1apt  ociltla2rl(mo;u) lermo3ta1op rlnvs;t) euo(o3oodll   ncsas)s2rmxm ot1olx mo3iltfmDemnmp;()alxrmf3oytomDrai s ()teum(r iu4lpe  fei sf Duax pnu0teeo o3ilsfmDrmums ()alenmo oo1optranvo t0trxr(rpou1lpen ieias)sDtau pno0aexniieilsla ra( o;t4tlxnif3ty1la rlieo s0trxm(mpiu4omeemnetlsfarrm(ront1openifetys s2rmump;u4aexrio oadfmDrlivs;s srurxopny1ol e fctlt)artaur ;o0tetomfciasfaDua(msn()arermfcootfaD auei t sexo(o3ny1lptn ivtl(faDtaump;o1aee iicild a elnvo (4 renmrciadfate nvo;(0trumxrpiudomtelicsl(f rumx onu0tetnmociad a2ra(vp;u0tlermrcoatfmDelneolt seto(m3oy4ll n fcsa(fa2tr(r ;u0altnifciltfmDrln s (4aetrmf iodop   ues t s2trim iy1lpeemivi ()srumurpno4tpe if3iydfm uaumpnt4trtrmf3io1oaD auvs;t t2xo(rpoy4om n ivsat)arraumono0tpxn fctatfm2rmnmo;t4tltnmocta1lmt  uei t)trxmxr ou4ale  fctlt  Duax ont4aee ifciytlsDeauvo;t0artoxf oytfmDrln slt s2um(r3iy4oltnmfvtltfs2raurpou1oleoii3tysfs2eluvo;t4tleriocta1oa eau s;t  rurim no1lp e ivia()a2raumpou0ope  f3iltfaDum( s;u)aleomociotoa eaueo t s2xrxr3nudalte ivt s) Draurpoo1alxomfctadfa2ran s;(4aetnir3totfmte uvs;t0seto(m oo4am emfvt t  rtmurpot1oltoifciytls2rm(vpnt4arerif iadopDranvolt t2xoimpiu4am  lfcil(fa2rru  ;o0oetnmo3ildla em(vp;u4 rxnio3oa1lpDean i t0 rurxo oudaleelfci t sDua(m nu1opt iieiltlmDuauvo (0aetrxr3ootlmt lies;(0 2ur(m nodlleelivi t)s2rmurpoo4alxoiieildfm2ranvsnu0tlxoxo iy1fatelu ol()sexoirpnudaptemies (fsrrrurp;u4apxomictas s2rlnms;t4arxnmocto1fmte ueo t)texoxrpny1apeemivtas)aDuaxmooo1tlenmietyd m2rmu o;t4teeoxocoydfp  aueil()seuoim iy1ol emnctlt aruaxrpnu1oetnii3tydlmDuauvo;(4aeeoifciodfpDelieol(  etrio3oodopee ictlt)sruru pno1apt moetyd a2rlnvpnu0 renxr io1lptr nvs t) euoxm oo1ll  mietl() 2rr( o;u1alt ii3tydlaDean sn() exnirciy1fpDeluvilt  rxrim iydaltelfeslsf Drmxmo;o4apeomoeildfm rlump u)tleomo iotomD  ieolt0 rxo(opoy4apee nvsltf 2rrx  ;o1texnio3iyslaDrm(vsnt0tltrxo3iodomtrlneo;(0t2xrxo3oodol e fvs ()s2um(rp;t4aleo ieiatlsDem(vonu4texnio3oy1oa   i o (  exmxo iudllen ncs t)artax pnt4apt  o3iat mDum( o (0altrio io1op   ues;s  rxo(mpoudamtn icia() 2tmx ont0tet mo3iadlm rau pnu4aetnio3iatop ranvs t trxrxr3oudlp elnesa()sDrrx  nu0tlxoiictlt a2el( sn(0tlxnifcoy1lat li il(0 rto(r3oudole  fesatfaDta( p;u4opx  fetysfa2rluvsnt0areomrcto1oaDrauvo () rtoir3iudoltn ncsasfs2rmxmo;u1opt mictytfs2uauvp;(0teermf3ty1lmt  i s ()s2xrim nu4lme mfcilt  2ua(m nu0oeeo fcildfmDrm( o t0tlermrcta1fm e i o (0srtriopoy1omeelnvt t  2umx  no4tetnmfciltlm2ra(mpnt0tetnir tatlaDeau ils)t2xm(rpoodaltelnct ( artax p;t0olxo iciatls2ulnms;(0aexomfcoatfmDr n i;(0 rtm(opnu4apt  iesl(faDrmx o;u1tlxoif3tad aDum(vp u4texoifctadlaDe iei t0t2umxo3oy4lltelfcs (  Dumx  ou4oex  f3ild sDul(mp t4artrmr ta1oa e u o ()s2uo(o oudlmtnlnvs ( s2ta(mo;u1alx mociatla ulu p;u4alerxf tadoa  li i () 2umirpiu4lp  lnvtl()a2taur nu1oleoifctydlm2uanvp;(4aetnmfcio1lm rai s t seurio iydoltnmnviltfsDtr( o;t0optnmfetatlmDuau snt) etoxo3to1fa eauvols0trxoxo oodop  micias)aDtmumpno1opxnmfeilsfs umnmon(4tlenir3oo1om  auvo s)srxoir ou4opt  fctlsf Dtr(rpnu1apxnifciytfa ul(ms;() rtnmrcootom rluvo;s s2tmxr oy1om nlfvta( a2ra(r oo4oee mf3iltlm ua(mp u0 etrmf3oatlmtrauvi;t0 exmirpnydlmtnlfvtas srua( p;t0aptn ieiydla2uaumo;t4arxrxf iadop  ai sls s2uo(o3oo1ale mivslsfartrxmpou4apeomf3tyt m rmu s;t)alerxfcoa1lpteaivi;()s2xoim ou4apee ieia() Drmump;u1tltoiociadfsDrmn snu4aexrxf iodfmD  ivol(0s2xmxr3iy1ole lfcs s)sDrruro;t0texn o3iadfa ranvp;u4 lerxo ta1oa elu slt  rtm(o ny1oltnmivsl(  2uaurpno4teenmo3iyt s umn p u4 eeoir iytfatrau sls s2xrxm oo1op elnviat aDuax  nu0altnmfctydla eau s u) rermf to1lmtrluvi;s) rxm(rpno4ol n iciat sDta(m nu4opx if3tadfa emums;u) ltomo ty1fm raieol()teurxr oodapen iei tf Dta(  oo0apen i3iadfaDem(ms;u4 eeriocia1latrlivolt0setm(o3iu1lm  lfvsas) 2umu pou0optnmo3tldlmDrl(mp;()tlxnxr tytfa e ieo;t0srumxo3iu4lptelivta( a2umx  ou4teenii3iys mDuluvpnu4 ltrioctydlp e n s () rxoiopnu4lm  mnetas)aDrr(mooo1tpe mi3iltla em(vpnu0 lerxo3oytfpDeaivils)s2urxo no1lpte fvtls) ruau pnu4tlx ioeiadls2uau p u4 rxnircoo1oatrli sls) rumxr io4ol   iesl(farrm( pnt0oeto o3ild m raumsnt0texoxo io1laDr uesl( teurim3iu4optemnvt s)sDuau p;t4aleoifciytla rmn p (0 etoxrciadfaD aueils) ruoir3ou4lp e nvt t srra(mono4oleo ieiatfa emnmo;u)altoxo tatoptraieo;s0s2um(rpoy1lpeelfet (fsrraxm ;u1tpx mfcils s rlump t0aexnxo oatopDeaneo t t2toimpiu4lmtnmiei ( sDraurp;t0olt  ietadfm2uluvon(0trenxfciytfmD auvo;(0sruoim io1om   fetlsfs2um( poo0aeto i3ils mDrlnvs t0trxnmr3io1fpDe n o ( teto(o nu1al  lieta() rtmu  ;u4ale  i3iyd mDelums (4tltrmo to1op  aies s)s2xrim iy4lmtemfvilt sDtrxmpnu4opeoifctyd a2rluvpnt)artnxocia1oatr neo s)srxrxr3iudaptnlfct ( a2uaxmpoo4alxnifetad a um( s;u0 exrmf3tytlaD lues t0setr(m ou4oltnlnct s s2ra(r ot1tptnmfetas a2eauvo t0tetoio ta1fptrli ils trumio3no4am n nvsls  2ua(mpnt4tleoiiciaslm2ean o t)tlermfctatfat  ivo;()trtoxo3nu1altn icslt  Dua(mp;o4olt moeildfa eau p u0 lxoxf3ty1fmte uvi (0t2toim3oodopen fvtasfsDrm(  ot4tpeo icils s uan o;t0 eenxr3oodfmt au s;t seumxmpoudlpenliesat)aDrmxrpno4tleomietltfmDrmu o;u0tltnirciydlaDeauvs;(  rtrio3ny4ol n fcta( s2rmur no0ope  ieild a2ulnmsnt0arenir oa1laDe nvsl(  2tm(r oydamen nvtatf rrr(mp;o4tpxomfetatla2ul(vo t)trermf3oytfaDr nei s srumir oy4ol  lfctlsfaDraxmo;o4teenii3tydls2emuvo;()alermo3iotlpteau slt) rto(o iy4lm  liesls  Durxr nt0tpeo oetytfm2ra(vp u4trtomr3iydom  livo s  rurir no1om   ivta(faDtrxrpno4tetnmoeilsla2emums;() rxrmrcto1omDe uvs ( sexrxm3oodopeelfcilsf rrm(  ;o1tlx iietltfmDulnvp (0alerxr3iy1oatrluesl( texm(m3nu1lle licsl(farra( o;u0oltnmfeiydfm ul( s;t) rtrioctytopt  ieo;t0trxo(mpiudapen ncs ( aDrrum nu4aexnmfeilsfa2uaums u0 ltoxr3oo1fp e ies;t0 2urio3no1omeelnet (fs2trxr oo4tpt io3iydlm2rm(mont4aexoxr3todfpD luvo;s0 euoir oudomtn ivta( srrr(ront4apt  feiat a rau sn(0trtrmfciydfp eauvo s srtmxm oydlpe mfvtl( arrmxr ;o0oetn iciytla rm(vpn(4 lerxr3oatfmD lnvo s0 ruoxm3oodomtnlfei t aDrax  ;t1opt  oeiadfsDra(vo u4 exrmf3to1om r ivs (  2trxo3nydlm   fvil(  2rmumono0oexomo3iyt a emumonu)alxrmfcoydfatran ils)seumxopoo4am elieia() Drax  ;o0opeo f3tytfs uln ont)aeermr iodomDeaneol(  etoxo oudlptelfesas)srrmum ;t4tpeomo3tldfa rlnvont4artomo3tytopt auei;s0 2trxr3io4optnlfvtl(fsrrmu  nt4apx mietlt a ul( o t0aetrmr oadopteaivs s)s2xo(m3oudlm nmncias) Drm( p;o1altn oeiasfaDem( sn() ltnxr ty1lm ranvsls srurxo nudome lnvsa()aDtrxmpnt4altnmf3iadlm uluvs t4artomoctatlaD aies;() ruoxr iy1aptelneia()arur(r ou1tlxo ietlsfm2rau s;t4alenio3oodfaD  n sls0trtr(r3io1olenlivs sfs2rrxmp;o4aexn ocias m2rm(vs;t4trtoxf3ootlateaivi;t tetrxmpiy1ome livi s aDumumoot0aexomieild s2el( s t4 lerxfctadopt aivi;()t2ur(o3oy1lpenmics () 2tru oou1ape moctlslsDean s;u0aeenir3iydfp rluvi;(0t2xr(mpnydlmtemict sf Drr(mont0texoioeiys m umuvo ()aetoiocoy1omD ln o;t0s2trxm3iodlltn nvias) 2rr(r nt4opx  feiysla elu o;u0aexnxo ty1fmD  nes;s texm(m3ou1oltnlnvi (farumxronu0tetoiiciytfsDrl(vs;(0areomfciytlmDrau o t)seurir nu4am emivtl( arra(mont1optoii3tasls em(vo t4trtnmf3iadfate u s () eumxo iu1ol n nvi sfaDua(r ou0tlx  ocias mDrl( s;t)trxnxo3iydom eauesls)srxm(m3oodlpenlfctl()aDum(r no0olt micilsfm2ean pnt) rxrirciytop  ln s ( sruoxm3nu1om e fetl()s2trxr no0tee io3ild s2uanvs t0teerxo iotop eaivi (0trxmirpnydlm n neiltf rtax ono0olt mo3tldls2ul(ms u0trtnxfcoadfat ln o s0 etm(o3oo1ap nlicsa( a2umuroot0tpe  f3iyslm ulums u4 etoxf iydla e n i;( t2tr(o oy1am elictatfaruauronu1aptnmictyd mDulumpnt4tlenxf tytlp   ueo s0teurxrpnu1ale lnesas aDuauro;o0tlt ifeilsfm ulumpnu)altrmrciotopDr ieols0trxrio3iy4op nmnvi ( s2uaxroot0oetomiciadfsDem(msnu0 ltnio3to1om elnvilt  2xrxr3iodapen ies t a2ua(  nt4tpxn ociytfs uanmpn()artrmr3todla  li s;(0 2toxo iydope  nct () rrrum no0apxnmo3iasla2ran sn(0arxoxfcoydopt au slt  2to(o3oydomte fvsls)a2urum ;u4tpeoio3tyslm uau pnu4tetoxfctydom  auvs;t0t2xriopiydal nlfet tfsrrax  ou1aptomi3tld sDum(msn(4texnir3todfmD an i;t)seumxm nu4lp  lfvilt sDrmu ooo1oeeomi3iyt mDumnvo t0tlxoxrcty1lptr neo;t)trxoio oudlpeelfcslsf 2uax pou0opt iiciydlsDuanmp t4tltrmociatlaD lueslt0srurxr3oy1amenmieslsfs2urxmo;o0tlenmi3tlsls2umumon(4 ltrif oatoate ivi;t t2tr(m3oudom emics s a2tru  ot4texomfeilslm2ran pnt0 lenio tydfat ai o;t) etrio ny4op  livsl()sDum(rpnt0aleoioetydlmDum(vont) exoio3oytfm  au ols0 etoxr3ou1opt  fvt s sDtr( p;t0apeomfeiltlsDum(msn(4 exnio3oatfpD lnvs;s0 2uo(o3iu4lp   ietlt srrr(  nu1aptoifetatlsDuaump (0tltnmf3todfmtr i s;(  2xmxmpnu4lpt  icsa(  2rmu  ot4opx io3iyt a ea(mp u)aeenif oadopte uesls0 eum(opou1olenlivils)arrax ont0opeomo3tasfa uanvs;(0alenircoydfm elnvo (0texr(opio1om  mfvsat)s2rm(rp;u0oexn o3iysfm rmnmp;u4alxrxf3todfaDe neo;t)t2xmio3nodllenmnvsl( aDtrxrono4ale mieiydfa2ul(vs u0 rermocty1lp  lnvs ( t2tr(o io1opeelfesl( srtmur nu4opt mi3iytfsDemuvo;()tlxnmr3iotlpt luvs;s) rum(r nu1om  mneil()a2uax  ou4tlt ioeiydlmDul(msnu4tltrifcoydoptrliei;s s2tmim3io4ole lncsasfs2rmu  oo0opxo f3iaslmDelums;u0aexrxf to1oat  ivs t texoir iy4ome mietat)arum(rpnt0olxnmiciyd s2rlumo;u)artomfcta1fpt lu o (0tetrxr nodoltemfeiat)a2rmumpoo0teeoio3tyt m rmump;u4arxoxf oatfa r n s t0srtoxopoodamenlfes sf 2rr(r ;u1optn feiys s2emnmo;(4teenircoadomt au i t  euo(m3iu4op nmfvil(f 2um(m ;u0aeen o3tyslmDrl(vsnu)artnxfcoo1lmt luvil(0srurirpou4oltnmnei (fsDumxmo;u0tpenif3iatls2umumo;t4 etoxfciodlp r n i;s teuo(rpio1lpeemict tfa2rmum oo0olx  fciysls ean pnt4texoxrctotfmteln s;()teto(o3oudll n nvs sfs2rmuronu1aetn oetasfs umu s;u0texnio iydla r nvslt) 2toxm iy1op  lfeilt)srtaurp;u1aeto feiyt mDrm( snu)aeenmr3oadom  anvo;s) ruo(r nodalt mnesatfsrrrump;u4tlen oetat a elnmpnu0treoif3tydop rlnei;t)srur(m3oo4oleemnetlsf Duax p;u0opt mo3iysls2uln ont4tltrif3iy1opDeanvo;s0 exoir no4om n feiatf Drax pnu4tee  ieiysfm elnmp;t4arerir oydfm elivslt)trxoir ny1lme  fcs (f rrmumont1tex ifcias s uau p;u4 exrxr iadfa eluvi ()teuoim3no4ape  iesatf Dra( pou4oee iocild a ranmsnt0alxoiocto1omteau olt trxmxo3iu1omtelfetasfa2taxrp;t4oetn octyd m2umnvo;(0 exnirctydomD  neolt teumxo3iodole  iviat)aruru pnu0tlxnmfetat m2ranmsn() exrmo oadfp raieo;()srxm(m3oydlmtnlfeil() rta(mpot1tlxniieiltfm2ua( o;t4 eermo oadopD ai i;s) etrir3oo4om  lfvsa()a2rrur ;t0oexn ocild s2eaums;()trermo ty1omD li i s  rtmim ny4ll n ictls)sDua(  nt1tpxoii3iadfa2rl(mo;u4treomrcootom e i i (0trtr(o oodlme lnetlt)aDraur ot0aee  ociadfmDua(von(4tlxoxfcoatla ran s ( s2trim oudolt  fesat) 2um(r ;o1oexnmiciltfaDul( p;u4tleoifcootlm  li sls0trtoio oy1olenlicsatfa2tm(monu4oleniictydfa rm(ms ()tltoxrcto1lmDe i s;() 2urio3no4op nlicslsf Drmxrpno0oltn oeildls ulnmonu4 etrxo oodoat  i o t trtmxopny4lmee netls  2uaur ;o4alen oetls s2uln pn(0 rxomo3tytfatr ieil()s2umxm oydopenmncsl( aDrr(m nt1opxn i3tatlm2uanvpnt)altoxfcta1op eln i s s2to(opiydamenlnvta()sDurx  nu4altnii3iat s ra( s t0aeenmr3oo1la   nvi;s t2tmxm3nu4ale lnvsasfs2rmu pnt1olxnmo3tydla2ul(vpnt0aetoxoctotlaDe i s t0 exoim3ou4lltnmieiatfs2tru o;t4opxoii3ilsfmDea(mpnt0texomo3oodlat lues;( t2uoimpoo1opee fvt (  Dumump;o0olen fetls m2ran pnt) reomociatfmDeln sls) rtr(rpno1lp nmiesat)aDtax  ot0oltnmietadla2emumpn(4 rtomf3oatfmDe ivs;s) exmxopnu1op nmfci t srta(mooo0tet iociatla emnmpnt0 rxomo totop e ueo ()setoirpio4aleemivs s)aDua(
\ No newline at end of file
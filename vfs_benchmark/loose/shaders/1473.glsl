@@ -0,0 +1 @@
+uvs s)t2uoio3ny4am nlneiasf 2tmx  ot0alxomfcils mDrauvpnu)alxnxo3iotopD lieilt) 2tm(m no1llt  fesat)a2ta(rpnt1optoio3ils s2uauvs;t) reomfctodoate n s t) rxmim ny4lpenlnvia(fa2rr(r no0tleoiociysfs2um(mp ()trenmo3to1fa e u s s)setrxopno4amt  ivil(farum( pot1apx if3tytfm rln p;(4arenmfcta1optrlu ol(  2xrxopnu1olt mieiat) 2umumo;u0tee moetysfaDrl(vp t4aexrircoatlptrauei;s tetrio3io4lp nmfeiltf rtauroot0apt mf3iatla2elu o t) renmf3io1om  auesls)seumxrpoo4ole micslt) 2rmxmont4tlxoif3ild aDeluvs (0 exomo tatoat lu o;() rurio oy1lmtemnetlt aDuaxmpnu4aetnifeiysls rlnmo t4 ltnif to1lmD au i t t2umim io4ape mnvtas  rrru ooo0alenifciatla rm( s u4texomocoy1omDrai ol(0 2uoxo iu1ope mici s) Dua(mpot4olx  fctyt m raump t0texoir3oytlpt  ieilt0 exrimpio4altelnet tfarrrxmp;u4tpt  octatlmDumnmpn(4tltrif oodfmtrluvols0srurxrpiy1om e nctls)aDtrx o;o4texo ictldfaDumu snt4arenmrcoydlpDrauvs;s0 2umirpnu1lptnlfvs () rta(mpot0opto ieiltfsDum(mo;(4 etnmrciatoatrlnvs;s0t2toxo io1ame licil()aDurxro;o0texniictltfm2ua( s t4 renir3oydfp e ieilt)tetoir iu1lp nmnesa(  Dta(  no1tltnmfeias s2ea( snu0treoio oa1lp  ai o ( srxmimpiu1lm nmnviasfaDta( oot4opxomo3iytls eaumsnu) leoio3iadfp  aues;s)srxmxo3io4al emncs tf Duaxmpoo0ale  feilsls2emnvp;u4 rxoxfciytlateauei s)truoim3oo4lle lncsa(f rrm(ro;u4aetnmfeiat a2em(vs;u0trxoxf3oy1fpt lies t t2tmim iu4ll emnei sf rraxmpno0oetniieiasfsDem( p;u4trtoircoo1oa ean sls  euoimpnu1alt lncia( s2tru p;o4olxn oeiatfsDumu p;(0arxrmf3tytomDrln ols tetoim3io4am emietasfaDuaxmp;o1tlxoifciyslm ea( snu)areoio3todomDrlnvo;t0 etrir3oodomte ici tf Dtmu  ot4altnmf3iatla umuvp;t0trtoifcta1lm rlnvi t)t2uo(rpio1lpe mfeils)artmxmoot4tpxo ieildlmDra(vo;(4 rtoxr3ia1opDeauvilt  rumim iydape  ies t s2umx p;u0apeo o3iyt a2rmuvp;(4 exoir3ta1lptrlieolt0 etm(mpiudal nlfcsat)arum(m ou4tle mo3iydfaDemnmpn(4aleoxr3iy1fpt auvi;s t2xr(o3oo4oltnmnetas artm(moot0oetnif3tat a2eanms;u) rxrir3tatfate ueols0 etr(r3ny1lm n ivias  Draxm ;t1oeeoifeils a rlnmsnt)trtomfciadfaDrauvol( srtrxrpoydlpee nvilt a2rm(rpnu4aeen i3tyd m ul(vpnt)tlxrmfcty1lm  lnvils0t2xmim iu1lm e nct s)arrr(r ou4tlx moeiyslaDrm(vo u)trxnxf3tadom rauei;( srxm(o3iydomen ivi ( arta(rpou4tlt  iciltlsDem(vp;u)aetrioctytomtr uvil( setrxopiu1op emfesas)srtr(m nt1apen i3iyt m2ranvs (4tetnxf3totom   i ils trto(r io1lltemicsa()aDrr(  nt0openiociat m2um(mo t0trxomrctydla  an i;()trurxo3oudap nmiesat aDrru  ;o1opx  ocildfm el( s () rtnmo3oadfaDeauei;s0 rur(opio4lp elfcs sf rtrxroot0tet  i3iatlm2emnvsnu0alxnmrcto1op elueo s  rxo(rpiy1omtnlfct t s2ur(rpnu0tetomo3iyd m2rauvs;u)trtniocootla r nvs t0 2xo(rpoodll nlfvtls  2uaur nt0tpto oetldls2ul( p;u4alenif iatomt  n ilt srxmxmpiy1optemnvtls)s2tmurpno0ope  octyt m rmump;u4 lxnio oydlmDe ieol()trurimpoy4lm n ieilt srtrxr nt0aleo f3iat s2umn o ()arxnmo iadoaDran i (0s2uoirpio4omtnlfeia()s2ua( ooo1tpenmi3iysls rau p (4 ltrif3iy1laDe n ilt)s2xmxr oydome lnvsa( srtrurp;t0apxomi3iat s2um(vo t4 rtoir3totlm  aivs;t0 rtoxo3oy4omenmncilsfaDum(m ;u1tlt  oeiyslmDrl(vo t4 lxomr3iydoaD auei (0s2xm(o nu1ale  feiltf 2taur nu0tlt mi3tatla rmnvp (4 rtoir tydopD  nvils0 rum(m3oodlmt  icil(fs2umumoou4olt  o3iaslm2uanvont4alxrmf iytoa  au olt0t2uoxo3io4opt lnvtlt)sDrrxro;t4tee moeild s2um( p;()tlxrxo3oo1lmtranesl()tetoir ny1lpen fvtasf rururoou0tlx mociyt a2rmn o;u0tlenio ta1opDrliesls0t2uo(rpou4lmtemivs t  Dtmxm ;o1aptomoeilslsDranvs (0aleoio ty1op rlueils0tetrim3oy4ap emncs ()a2urxmpot0tlen o3iyt m2rln o t4 leoxf ta1opDeauei t0truo(m3iy1om  mnct s)aDtmx o;u1texnmietys a em( p u4 ltomo ty1fmDeauvs t texo(o3nu4llte ivta( sDuau onu4optn fetlsfaDran p;t4aexrmr3oo1lpD  ues t0trtm(rpiudoptnmneslt) rrax ooo4opt  ieiydls2ua(monu0arxnxo3oodfmtr ueil(0trxoxm nu1lptemfctltfaDrrxmpoo1aleomoeiltfmDranmo (0 leoir io1fm  anei t)srtmiopny1op nmnetatf rua(  ot0tlt if3tadfa2eln o (4 lenxo iodla r i s;t) rxoxo iodol nlnesltfs2rmumooo1apeomoetys m ulnvon(4trxrif3iadomD auei;t)seurxrpnu1omt liviasfartr(  nt1tlx io3iysla ulump ()teerif3tydlmt lneol() 2trxm nu4llt lfctls)s2trumoou1tetoioetydfaDeanmonu4tlxomrcoodfmDe nvi ()s2ur(m nudoltnmneilsf rtmu  ou1tpt if3iad aDea(vs (4 eerxf iotfmDr ieil()s2xrio iu1lm elfesatfa2rm( ono0oetn f3iltls ra(vsn(0teerxo3totlat au ilt sruo(o3ny1lmtemfciltfarrm( pno1teen f3iatfsDua( o t4tltoif3ty1omD lnesl( t2urim oy4ll  mivi s a2tmxrp;t0texomfciltfaDul(mp;u0altnxo3iytomt ln i;s  2xoxm3no4ap elncs t)s2umu  ;t1olxo o3tlt a2em(mo t)treomrcoodfaD an s ()seurxo3no1lleelivtl() rtm(roou1ole  fcilt mDeauvp;t4areniocoodomDeauei ( texmxrpnudolee fvtls  2urxmoou0oltoiictasla elu s;(4teenxf oo1lp rauvs (0s2urio3iy4llt  nciasfsrraum nu1apeomi3tydla ulnms t4trxrxr iadoa raieo;s) rumxrpoudopt livtlsf rur(mpoo1oet  iciadlm2rmump;(0 lxnmf iydla rlieo;t  rtrxmpnodom nmnct (faDrmxmp;u0tet  fciys aDem(vs (0trenmo3tadlate ivilt0trtr(r3ny1optn feta(  2rmur ;o1oeen icilslm2umnmsnu) rxnif to1faDrluvi t s2uoxopnodoltnmneils arrrxmo;o4altomf3ildlm emumont0alxoir iydfa  ai o s)srur(rpno4lle  fvtas)a2taur nt4tlxnmf3iyd mDumu snt4trermr3iydop eaiei t) eumxopnudomen nvslt)arurxmo;o0oeenmf3iysls emu snu4aexoxf oodomte n sls0srxm(rpiy4ame lies tfarrmurono1apxomo3tytlm elu p;u0altomf iydoaDeauvs ()truoxr3nodap n iet s) 2taxm ;t1aetnioeiyd a2ea( o;t0altnir3iodfpteliei t)trxrirpny4ol  lnes ()a2tax  ou1olxomfeiaslm ulnmp t) lxrxociadomtr ivsl(0 ruoim3nudom nlfet t  Duaxr oo0apx  octys a2rmuvp;u0alxnifctydfate nvo;s)texmimpnu4opeelfesatf rtaxrp;u0tltnmfeiytlm eauvo;t0texrxf tytoaDeai i;s)trxrim no4lleemnvia( sDumur nt1aetoiocilsfmDrmnmo;u4areomocoy1laDraneil()s2triopiu1oleemnctatf 2rru p;t0oetnio3ildfaDrl(mo u0tlermfcoo1op  luvo;( srxm(r3nydamenmfctl(fa2urxmp;o0oetoifctldla eanvo;(0aleomo3iytfptraiei t)s2xrxmpny1apeemicilsfsrra(ront0opx io3tldfm2emn o;u0 ltrio ta1fat  uvi;t) 2uoxo3iodam  lfciat)arraumoou0ole  feiysfsDem( p t)tlenmfcty1lateai ol(0t2xriopiy1ome mieiltf rurxmooo0tlx  f3iyt m rmnms;t0 etrxr3to1lmDelnvolt0 etmxm3oy1lpt mnet tfaDrmxrp;o1ope miciysls2emnvpnu4texnmr oodfate n s s)teuoio ny4altelietas) Drmum ou1tle  fetysfm eanmo;(4tlxnircty1om e nvs;t sruoim iu4ol emneslt aDua(roou0aleoifetadlm2uau o ()aetomf3iytlat  n i;t s2xo(o oy1ome  fvi sfsDum(roou1apt iieiytls emn snu4aleoir ootlatrlieo;(  ruoxrpny1lmtelieiasfartauro;u4oeenioeils m2rm(vs t4aeerio tydom r ieils srur(o iy1al nmfet t)sDurx onu1oeto oetas s2rmu p;u0trxnir3iytoat anvi () rur(o3iy4op n nvtas)aDuax  nt1tlt  f3ildfs um( p;t4trerif tydomD lu i s)truo(o3oudapenlics tfartaur ;u0olx  oetad s2rlu o;(0 reomf ty1fmDran o;s s2xoxmpio1ap   ncsasfaDra(mono4opeoiictldfm ua(ms;u4 rxomrcio1opt aivslt  2xrio3iu4lpeeliciat sDur(ro;o4aet ioeiysfa2umumpnt0 etoxr oydlmD  n i;s)s2trir3nudomenlfvils a2um(mpnt0oex mietlsfa2umnvs;(0 eeoir oodoa ran ils0s2toim iodalenmicsas) rtaur ;o1altnifctas m2umnmsn()areomrcootfaD ln ils0trto(o nydapt lfvt s a2uauro;t0olto f3tltlsDemnvp u) rxoxr3oydfa eaivi;t0t2uo(mpio1lmt lncilsfs2ua(rp;u4tptniictyslaDua( snt)altoxo3tydom e n o;t) 2tmio iy1ll n ics ( s2rrx o;u1olxo oetlsfsDel(vsnt0 rtrmo3oadlpt li slt)s2ur(r3iydameemnvias)srrrx o;u1oexoiiciadfm rlumpn(0trtoio3oo1lm e n i t seurxm3oo1lltemfcsl(faDur(m ou4apxn icilsfmDulu o u0alxnxo ia1fa rlnes t0 2tm(r3iy4omtn fcsa( a2tmumono0oet  icilslmDea(mon(0 leomf3oadlpDrauvs;s teto(r iy1lmen fetasf 2ra( ont1alx io3tltfaDelu o;t0 ltnxr oo1la   ivsls) 2tr(o iydapt  nvtat a2trurpnu4tpxnioeiytla rmn s t0arxrmo3oytomDelieo s) 2xmir ou1ol  livia(  rta(ro;t0oee mo3tldfs eanmpn(4 rxomf tydlmtrauvs;t0 2xrxrpiu4omtn netas)srtmur ;o1oeenmiciytfs2ea(mo t4tlxnir3oydfatrlu s t0s2toim3oy1lltelncsa( aDrm(mp;t0opxoioetyd m uanmp u4 rtnir iotom   u s;t0trumxo3nydal  lfctat srum(m ou1alt  oeils m2ulums t4aexomo iotomtr iei;t trtoiopio1al e iciasfartaur ;u0apxnif3tls a umuvp t)alxoif3tydfpt luvs s s2umxr nu4lp e ivt ()a2raum ;t1oeeniiciys a eluvs;t0teenmo3oydlm rliei;t trtmiopnu4ome lnet () 2umxr ;u0oltnio3tysls um(msnt) rermf3ootlpt  ivo ( srto(o nodolee fes (f rraxr ;o1olxnmietadlm2emnmp t)trenxoctytfpt aivs t)seumxr3iy4lm emfcslsfaDta(r nt4opeoii3tydla2uluvp;u)tetrxr oydlp e u ilt)srxmxo iudope  nvsls s2ur(root0opxo octasfmDel(vsnu)trtomfcoy1late ieol( seumim3ou4amt  ivs tfaDua(ront0ope moetadfaDea(mp (0trtnxocoo1omDeanvi t0srxoxmpnodopte fetl()sDrrurpoo1tleniieiat sDrl(vp t)tleriocootfa e ueo s0srtm(mpoydalenlictltfaruru pot0tpeo fetysla2rmuvs;t4 lenxrciy1oa eluvo;s  etmxr3nu1lmt lfci (fsDurxrpnt4tptn o3tatfaDea(vp;()altrmf3iy1oa ran o;t0 2toxm3io4lltnlneia() ruax o;u1tlt mo3iyt m2ulnvo;t0trxnmo iydlptr nvo;s0sruoim3ny1om nmict ( a2rmxr ;t4openiiciysfs2rl( o;(0artnxfciytfmt livi s seumio no1ape  nvslt)aDtaum nu4tpxn i3tldlm2um(mpnt0arxomr iatopteanesls0s2xo(r ny4ame mnvs tfsDtrumpno0tlen ociyt mDumn p;t) rxnxo3iydfatrauvo t0 eur(mpno4olen nvi (  Durxmp;u1apx  feiltls2ean s;u4artoircoodopDranei t)seurxo3ny1lmte nvi t) rtruro;u4oetnifeiydfm uauvsnt)aexomo iatlateliei;( s2tr(mpou4oleemnct sf 2rax ooo1olto oeiat sDulnvsnu4altrxo oa1opte nvo t) 2xmxr3nodalt lnciat)s2umu  nt0tltn ictydfmDelums;u4tltrmr3oodlateanvo t0sruoxr iu4omeemneias) 2tmxmp;t4apen f3ildla2ulumonu)tlermo oo1fmtr u s t0trxoim iu4opeemnvias srrr(rpot0aee mociltfsDeanvsnt)aeerxfcoa1lmteluvols)s2uo(rpoudlpen fci s arta( pot0tlx  fetldlmDra( sn(4aleoir3tydomt livo ( srxo(r3iudapt mfcta(  rraur nt4alx moctltlaDul(monu0 rerio tytfa elues ( t2xr(r3no4apte iesltf rua(m nu1olx  octadfa ul(vo (0arxrxo3oatlmtr n o t0t2urio3iydlptelnetat) 2uaumpoo0tlx if3tltlaDumums t)tleoio3totopD li il( t2toimpno4amt lict sfs2rru ono4oleo fciydlsDul(ms u0tlenxo3iodoaD  neo s)texrxmpnodamtelicils  Drr(ro;t1olxnmoctasls ua( on(0 etnmr3iydopt  n olt srxoir3nu4ope  ivs ()aDrrx o;u4apx  ocilt a2umn p;t)tlxnif3tydlat aiei;s trxmxopoo1om   fvi tf Dua( poo1olxnio3ilsla ra(mo;u4tlxoxo tydfp rliei;s0teurir3oodop emfvt ()aDta(m ou0opxnif3iyd m2rmuvs;u0artoir3todfmtrli s () euo(o oy1apeemncsat)sDur(rpnu0aee ii3tlsfs em(mo;(4 rtnmf iytfmD ai s t seumxopoo1apen iet tf Dtm( onu1oeenifeiydfsDrlnmp;(4teermfcta1lmDrauei s)tetrio io4lpt mnesat aDurxr ou0olt mi3ild m uauvs u)tltnmf iatlm ranvs t0teum(m3oudapeemieslt aDtr(r ;u4oee moetls a umu o;u4altoxf3oo1op rln i;s srxriopiy4lmte icslt)srtaxmooo4tpen fetyd m el(mpnt0tltrir to1lat  uvi;t)srxmio nu1ape lfesasf Dtr( pnt4tex io3iltls2rm(vo (0alerxf3iatfatr uei ()s2trxopnydolenmnct sf rum( p;t1tlx  i3ilt a rlumo;()alxnmfcoytoa ranvo s  rxrxr oydop elfes t) 2taum ;o4opx  i3iaslm rau o t) lenxr3tytfaDelnesls)t2xr(o3ny4ll n nvsls s2rmxmpoo1olenio3tlsfsDulumo;()alxnmociatfateaivi;t trur(rpoo4lptemnetls)arumu pno0apxoif3tld m2elu s t0 renxfctotlpt lueolt s2trxo3iodlmt lfvsls)arrrx pnu1apxoifetydlm2el( p t0arerio3io1faDr i i s t2toxm3oy4omtelfci ()arra(mo;o4tpeoiiciyslmDulump;u0 rtrmo3iotlmDr nvs s0 rurxmpno1lm n nvsatfs2umxmpnu1tpto oeiatls2ea(mo;(0 lermr iadoatr ivolt texoxm ou4omtnlieslt)srua(mono1altoii3tasfm eln snt)aleniociatopt aiei;()srtm(o nydal   fvt s)sDtmur ;u4tpeo icilt sDulu p u) reoxrciydlpt  ieols0sexmimpny1optelfetls)a2umxr nu4aeeniociys s rm(mo (4aleoio iatlm eanes;t t2xmxm3io1op   ncsat  rrr(ro;o4teenio3ias s emuvonu4texomf iotfptran sls)srxr(r3oodom  mnvia() Dtrxm no1tpe  i3ils sDem( s;t0 exrmrcia1laDr nei s0seur(r3iydolenmfeia(fa2umxr no1ale  octltlm emumpnu4alermrcootfaDrlies;t sexriopnu1lpe lfvtas  rtrxro;t4tex mf3iyd s2eluvo;() rxnxo iotoatelivo;s0 euoim3ou4alenlnet s)a2tmx pot1tlxo ieils a2uanms;(4trxnir3tytomtr ueo t0 exmxo3iydopeemnei (fa2rmxmpou0opxnio3iasfmDrl(vs t0 lxrxociytomt lu sl() rxrio3ou1lm   ics s aDtm(roou0oetnmocild a2rmuvs (4tlxrxocoadfmteai s;t)trxo(mpiu1lltnmivt (fsDrmumpnu0aet  ieilt s ean s;t)trenxrctatoaDelieslt)sexrim3iydapeemivsa(farrru pno0opeomieiytls ul( o ()tetnxrciytlm raivs;( srtmxrpno4lpe liesl()arum(m oo4oltn f3tltfs2el( p t4 lxrmfcty1latraies;t teumxo iy4oleemfctls)s2umxroou1altnmoetat s uaumo;t4tetoifcootlp e ueol(  euoim iy4lme  feias  rurxm nu4oeeo fciad s2ranvs (4tltomo3oy1fatrluvi (0 2xmxo iu1apt  netl(f 2ua(rp;u4olto iciadfa eau o t4artrmf tydlmt  ivsl(0tetoxm ou1omeemivta(fsrumxm ;u1tle  oeiatfa uaumpn(0 ltoxo3iy1op e u s t  exmirpio1ol  mfci ( sDtmxr ;u0tle mo3iltls2rmump;(0artomf oa1oaDe nei t0s2xoir3no4lpee fcta()sDum(rpnu0tlt micildla eanvonu4 rxrxr ty1fp r n s s0teumir3oy1am   fctl(  Durxmo;o4tpt mfetydlaDum( s;t0tlxnir iy1fm  au s s)texoim3ou1ome lfviat aDraxro;u1tpe  i3iaslmDumumo u) reoio3to1omt ai i s)s2urxo3nudlmt mnet t  Drau  nu4apxnifctyt s2em(vs t0 rermocoy1fmteaieol( t2umxrpny4ope lfet t)a2rrxro;t1ale iiciytfm2ul(mp u4 exnmo oadlpt  uvilt0t2uoxo3nu4lpte fciat a2uaxmpnu1tpe iietlsla2umn p (0 lxrmfciatfp rai i;s) rxoio io4oltemivtls sDrmuro;u0tlt  ieildfa2eanvs;u0aleomf oatomDrai s;t0 euoim iu1op  lfcslt)sDra(rpno0tpe moctaslm2rmnmo;t4 exrircoy1fa r nvi;t seurir io1am nlivi () Dtaxrono0tetnmo3iasls rmn p u0aleoxr3tatfptr ieo t0teuoxo3no4ll emics t)a2umum nt4apeoifeilt a raump;(0treoxo io1fpD ln i;s0seuo(m no1optelncslt) Dta(m ou4texn iciltfa emn on(4texrio3oadlm  au o t0t2tr(o3oudom elfvt sfs2rauront0apt miciytlm2eln p;t4 rtomociytlmDelieo;()teur(o3nydlmtn nvtat s2rru  ot4aptoii3tldfm eln snu0arenif oa1lp eai s;s) 2trxm3no1ope lict t)aDumum no0oetomi3iys sDem(mont) ltnmr iodlmtrlnvo;t0t2trxr3iodaptemivia(f Drmu pnu4texn f3ildfs rlnmo u)trtomf3oadfmD auvo;t  exrxopny1amtn fes tfa2uaxro;t0apen ocild s rmu p;u) eeomr tadfptranei;( texmxm ny4lptn ivils)aDtm(r no4aex  f3iltfm2ul(mp;u)aexnxfciatomD lnvo;( seto(mpny4om n nci s)s2rr(mo;t4apeomo3tyd a eau pn() rtrxr3iydlm eauvil(0 rto(o3iu1lp   fcsas) Duax ooo0texoiictls sDrl(mpn(0 exrif ia1laDrlieolt) exrim3nu4amee fcsl(  Dtaumpnu0aetoif3iad mDel( sn(4aeeoir3ta1lpt li ols0 etmxm3iu4om nmncil( s2uaxmpou0tltnif3ias s2elumo t)alxoifciotfatraneo;(0s2xrxopnudlmtnmfvsls aDumxrp;t1alxn oeilsls uanvsn()arenio3oodlpte n s;( t2uo(rpiudaleemfctat srraurp;o4aetnii3ildfaDuauvp t4tltnmo3oo1lateanvslt  euo(opoydal nmfct (f 2tmu pnu4apxomf3iyd aDrl( s;u) rxoif3tatfpte n s () etmxmpiydopt lnci tfartmumo;u0altn iciys mDulnvo t0texnio iatfmD ln ol(0trtr(opno4ol emivilt srtmum oo0olt mociatlm rlu p;t4alxnxrciotopD aivsl(0 eur(o oo1optn ivsa(  2ra(rp;o1oetoiicils s2rm(ms;(0tlxoxo3tadopDe uei t)texmim oy4oltelnei sf 2rrxmpnt1optn feiys s2rmuvpnt4 etrircio1lmD liei;s truoxrpny1ole mnvs ( sDta(m nu1tet ifciydlaDrmuvp t)artomocoadfmD ln i;t0srurxr ny4lltemfvtat)s2rmxmpno4opx mfeild sDraumsnt4tltnmocoatfptr nvo;()teurxmpnydomen ict sfsDur(rono0tpen f3ildla rln o (0tlxrmr3iytlp  aivslt0 eto(r3iudal  mivsltfa2rrxr no0opx  o3ils a ea(msnt)trtrmo3tadoate ieo;(0 2tmirpnu1lm nlnvil()aruaxm no1tptoiiciysfs2ra( p ()tleniociodfa e uvs t0 etmxr3io4apenlnviasfsDtrurpot1ope if3ildfm2rmn sn(4teenxfcoy1fmt anvi;s  rtm(o nudop n ncta(  rtm(rpno4tpxoiociysla2umu s;(0 rxnif oytla   uvi;s0truo(r iydlle mfctl(farraxmono0aet mfcilsfs ra( o u0 rerxf tatla eanei;s0s2xrxo iy1altelietl()sDtm(root1tlx  ictld s2ulu on(0 rxnmrciotfpDelivo;t sruoir3nu1lm   ncslsfsrrmump;o4optnifeilslaDraums t4 reomf iodlm  lieolt)trtmxrpnydol  mnei t  2uaxrono1aptn i3tytfs emnmsnu4 rtoxf totop rli i;t)texmxr no4omen ncslsfsrra(  ot4oex  f3ilsfa eanmo t4aeeomf ootfmD  ivs s0 2ur(r3oo4op e ncia(fartm(root4apenmo3iltfmDeln o;t4 lenxoctodomD an i s0trxoxm3oy1am nmiet (fsrtmx  no1tex io3tysls2eln s () renio3tydfaD  i i;s0texriopnodllt mfcta( aDur(rono0aleomi3tlslaDum(vo;u)aeenmoctadlp rlueo;t  exoim iu1optemfvi t) rtau  no4oetniieiyd s2ranvont) reomrctodlp rluvolt0srxmxr3iydopt  ivi t aDuaum ;u1aexnio3iad a2umuvpn(0texnif todlateanei;(0t2to(mpnudlm nlfvs s)sDuau  ;o1opxo oeiadla2rm(vp;t0teerxrciodfm elnvsl( t2to(rpno1ome mfvs (f rum(rpoo1opeomictaslaDea( pn(0tlenmocia1lm  au olt) 2uoio iu1alen fcta( aDtm(mp;u1ope miciyd m2em(mo;u0alxrxf iodlaDrauvi;t) eumxm3no1olee nvsl()s2urxr ou4olxoifciadfs2ulnms (0 exrxo3io1fatranes;(0srumio3nu1lmt mnes ( aDtr(m ;t4tpeomfeiadfa2emnvs t)artoio3oa1lat li i ()s2xo(o3iu1omeelieils)sDrm( p;u4tpx  i3tytfmDul(monu0 etomf3tadoa eln sl()teumxm3oydll elfctl(fs2rr(ronu4aex iocilsfs emums;t) renmo iytomtelnvo ( tetmir3nu1aleemnetas)aDtax  ot1aex ifeiyt m2eau s;u4teermo oatlat auvo;t  etrxo3iy4op elieilsf 2rruroot1alen f3ias aDulnvs (4aetrircoodfmD  u o s s2umimpnu4omenmfvsl( sruaxm nt1apto i3iydfa uln onu0 lerifcoadom  aueolt0 rtoim3oodal e nvil( a2rau p;u0altnifetydlm ul(mo u4tetrif3oatfat aueslt0sexoio ou1am emfcils) rumx  nt0alenmo3iasls eaumon(0 lxnmo3oa1laD  ues;(0seurxopiodlp elnei t)srrr(mo;u1tltn fciyd s emu s;(4 etomf3tadoa  an i;s) 2xoxopnodlp  mnesl(  Dtax  ;o0tee mi3tad sDeln s (0trtrxf3oydfm r uei s0t2umir3nydlp nmici t aDrrxmp;u0apxo o3iysfm umn ont4trxoxf tytoa e uvo;t seumxo nu4llt  net t) 2rmu  oo1teeo f3iatfaDea(mo t4 exnxfctatoa  au s;() etmxr no1alt lnvsas) Dtmum ;u0aetomf3iasls2ra( o t)alxoxf oodfaD  u sl(0trtoimpiodlmeelfvslt a2rrxrpnt4ole  iciaslmDum(mo () rtnir ia1lmDeanvsls)s2xr(opno4olt  nei s)aDrm(  ;u4apx mo3iyd sDean p;t0altrio3oa1lmDr nvs (0srxmir3oo4ll   fct s  rtru  ou0tpeoifetad s ea( p;u) renmocia1fa elneols) 2tmxm3oy1amt mncsls)a2raumo;u1oee  oeiysfaDrl(mp;() renmo oodfateaneo t)texoxm3nydoltn fcsa( arrmu  oo4tpt ifetlsfm rlnms u4altrxf3oadfa raivilt0t2umirpiu1ap e ics s) 2ururooo4tptomo3tlt s um(mo u)trerxr io1omteln s t0trumim oodlptelncs s)sDrau pou0openio3ias m rauvp;t0tlxoxo oa1lmte u o (0 2xm(rpiu1lmtnmfesltfsrta(ront0oeto i3tldfs ea( pnu0aetomf oytlp e u i;s0 rur(m nydamtelfet s)aDumx ono1olt  f3iasfm2umuvp u)treoxrcoydopD  uvilt)trtm(m ou4ol e ivs t)s2rmurp;u0tlxnifciadlaDra(mon(4alenxrcootfat aues ()s2xmxrpoydopte fvs t  2trx oot0aexn icias a2umnvpnu0texrmf3oydfaD  ueol(0 eumir nydoptn fvt t)aDrax p;o4oex  ociltls eln p t0trxnif3oadlmtelivo t)seumirpio4lltemfcils  rta(r ;o1tpto i3ildls ulumpnt0aexrmr3tytlptraivs t0 2umxrpio4ol  mfeils s2umxr nt4tpt ifeiydfsDeau o;u0teenmocoydlaD auvslt  2xoxr ou4amteliesat s2ua(ront4ale mf3iatlm2eanmp;(0areoir totlat lu s;s  rurxopno4olt  nvil( srtmu pno1oex  ieiyd m ea(vp t4altrir3tytlaDeluvo;s srtriopnu1ope lieslsf Dur(monu1oeeo fetyd a2elump u0 rxoxr3iydoa  anvo;(0 2tm(rpoo1alt  iciasfs2umxr oo4apeniieiyd aDuluvpnt) lxoio3io1fm rauvi (  rtmxrpiydaltelnesas)a2rm(m ;u4tet  f3ild aDua( pn(0teeomf3iy1fa  aueo;s sexoio iu4ameemfcs (f Duaxrpoo4tlxoiociysla ulu s;u0tetnircoytoaDe ivi s)t2toxr3iy1lmt lnct t s2rm(mont0oleo fciytlsDean on(0areoio oadfa r u o;()trtm(r3ny1lptelnci sfsDra(mo;o4aet ii3tltfs2ul( s;u0tleoio tytlp  au s t)texmxmpny4lptemivilt  2ra(m no0altnmietyd m2rmu s;u4tlerxfcio1omtraneils trtoimpny1lp elivi sf rrru pot4aptn fciytfsDemn o u4aexrxrctodlpDeauvolt)trtmxrpiu1lpe mictls) Durxrp;o4olto ieiadls um(vsn(4tltomocoodomD lu s;t) rxoxo3oy4op n nci (faDur(r ou0tlt mf3iyd a eluvs ()tlenirciodlm raieo;( texm(m nudal n nvt sfartaurooo4tlx mietadfm2rln o u)trtomrctodoa  au i;t) rurio nu4ale mfcsatfaDra(m ;o1olt io3iyd a2uaumo;() etoif3todlpD anvsls seumxrpnydll emfetl(fs2uax  no1teto f3tltlaDemu snt0 eenxfcia1omDelivo t0srumxm3nydamt lnvils)a2tm(rp;u0optomfeiat sDuauvs;()arxrif3oatfmtelivo;t texm(o iudaleelneslt sDrax  ;u1apen o3iatls rluvs u) ltoxo oydlmteauei;() rtm(m no1oleemnes s srta(ronu4oetomo3taslm eluvsnt) ltnirctodomt  n o;s0 rurim3nudlltnmfvtltf Drmxronu1oleoiocildfs ua(vp () rtnif oadlat  nvi t s2toxopiudaleelfeil(fsDtaurpno4apeomi3tasls eln sn(4tetnif3ta1lpte i ilt  2xo(m3nydoltnlicsatfsDrrxrp;u1alt  fcild s em(vp u)tlxnifctotla ran o;t sexm(o3oo1lpenlfeils  Dumxmp;t0tpxn i3iaslm2rlnmpnt4alerio oy1fpDr uvsl(0 rxrio3iydam  liesls)artmur ot4tlt mocilt s emn pnt) rxoxrcoy1fm  lnvs s s2xm(o3iy4ol   ies ( aDta(mono1oexoii3ildlm2rm( onu4alxnir ootom r i i;(0 2um(opoo4lme mnvi sfa2taumonu0optomociltfa2ulnvonu)artoxf3iy1om  aiesls texm(r3oodamtelfctlt arua( p;t0tpxomietltfa uln ont0 exrmf io1lp rlu ils0t2ur(rpnu4am  liciasfs2tau pnu0oet  ociysfs rm(ms u)altoif3iatfpteli ol(0tetriopiy1ame livils artruroot1tpxoifeilsfa2eluvo;u)teeniocta1op r u il() rtoimpiy4ale  fcs s)arrm(m ;t1teto oeiyd sDua(msnt)arxrif3oo1lmtelivsls) exmir3oo1ope mict ( sruaum oo4tetomfciyt mDrmu s;u4 rerif3ta1optrai o t0 exmio ny1lmtelfvi ( sDum( p;u4aex if3iydfm2umnmp;t)arxrirciodlmte u o s0texoiopny4amt lfvtat)arur(moou1tetn f3iatfm um(msn()arxrxo oatlatrlueo;t  etmim3oy1olenliei ()aDumu o;u1ale mi3ias m ul(msnu0alxrxfcoo1oat aneo s srtmim ou4am n ivtlt  Drr(mpou1tlen f3iydls rmu ont)alermfciydoa e ivil( s2trxr3oo4omtn ncia()a2rrx  ou4tltomo3iasfmDranvs ()texrio oodfp eln o t)srto(m nu1am   fes s) Drmxrpno1apxnmf3iad s2elu pn(4 rxrxr to1oa   i s s srur(o no1altelfet (fsrua(rpou0alen feildla2emnms;()aetrxr3iatop rln ilt)s2urxo nydomenmieils) rrr(mo;o4aeenmf3ilsfaDel(vpnu4 etnmfctydla   nvi ( srtmio nydom nlfvt tfs2ta(mono1open o3ild s rmn p t4alxoio3oytfa ean o t0 2uoxmpny4lptn fei ( a2uru p;u1ale iociytfsDemnmp;()teenir3iodfpDeauvilt  etm(m3oydom elncils)arur(  nt4tlxnif3tatlm2el(mp t4tleoif ootfmD lneilt0sexrir oo4amtemneilt sDrrum ;o0oltoifeiatlaDraumo u0 rxrmr oydfa e nvo;t  rtmir ny4lle mivtl(fs2tmxroot0tetn ictyt a2ranvsn()trtnmf3oadoatr ivs;() 2toirpnodlp e nviat) 2rmxro;o0aexnio3iatfaDuanmp t)arxoir3todlp eln sl( s2xoio nudlptnlfcsls a2tr( pnu0teto o3ias s el(mo;(4 eenxf tadfmt auvil(  rtmio3nudom   nct t) rtmx pot4ape  i3iydls2rmu s t4 ltoxociotom  aieo t0tetr(opou1aptemnct sfa2rru poo0tetoif3tyd m2rm(ms;u) exrir3oo1oaD  u sl() exmxo oudamte nci ( s2tm(  ou1tpto fetld s2ea(vs;u0alxnifcootopDelu s;t) eumxr3no4ol elfvs s)srurxrpot1tlx  fetls aDua(mont)aeeoifciodlptr nvo;(  euoir oo1omt mnct s  2rmxrp;u1tpt ioeiatfs em(mp t4texrmociodlmD an o s0texrxmpiudom n ietl(fa2tauroou4tlxomfciadlm2rmu o u) rtrif tydlpDrln ols)srto(r nu4lmte icsls)s2raumpnu4alx mieiltfsDemn p;(0tltrifctodfmtraiei;(0t2xrio ou4ap emnctlsfsrraump;t1aeeo ictat m el(vp t4 etrmr ta1la ean s;t) etr(m ou1lpte nvtat arumu p;t0texnii3tadlm2ua(vpn()alxomf3oodomDrlnvil(0teumirpiu1ol   nvtls s2umx oot0olxnmictldla ua( o;u0trenmf3to1faD li il()teurxo3oy1lmt  ncsasfsDuaxm no1aee  o3iysfaDumn on(0texomr3oytlat liei ()s2xmxopoo4am nlfcsasf Drax ooo4aex  feiasfm2ra( p (0tltrmf3iotfm raiei;s trtm(opny1lpeelfetlt)a2uru o;u0oetn i3tatfm2ranvo (0artomr3oa1lpte nei;t)s2uo(mpio4ope mnvi (fs2rrumono0texoif3tysfaDum(von(0aetnioctadfptelivo;t s2urio nodalee ictas aDtrur ;o0teto f3iltfsDumnvo ()trtnmo todlmteluvi;s tetoim3nudaptn fcslt)artaxmo;u4alx if3ilt a2uaumpn(4 etnxo tytomtrau o;t t2toxr nydlm nlict ()artaur ot0optomf3iydla2ra(mo;(0 lxnir3oadop  lu ils) 2xr(opnydlmeelictlt aDum(mpoo0apx mf3tasls2ulums;t0tetnmf3ta1omtraivi s  2xrir3oy1lmeelfet t) Dtaum ;u1tpxo ieiatlmDrm(mon()tlxnxocto1oat anesls)seumio3ny4ol   nvtls artrum ot4tltnmociyt m rl(vo (0alxrxr3iydfat livils  2xo(rpiodom emfvsa()sDtm(rpot4oee  i3tatlmDrl(ms t) leomf iodlpD aivsl()trtmio iy1oleelnvs t) 2rrurpno0apeomocilsfa2rmn s u0alxrxr iytom r i i (0 rum(rpiu1lmtelneta( sDrrumo;t1tlxnmieiltfm2rlums;()teerxfctatfaD  nvols0 euoio3no1ol e ivs s aDtmurp;t1alenmfetatfmDumu s;u4 leoir3ta1lpDr u s;t0tetrim ou4ap nlfvtas  Drr(r ;u0ole mfeilslsDeauvp;t4aetoioctotlate i ol( tetrxm3oo1olt lictl(f Dum(mooo0texomoetaslm em(mo;t)arenxoctatoa r iei s seumio3iy4olt mici (faDtrurono4tlx  feilt m rmn onu0tltriociy1lp   u o;t0trur(r3oydameemnesl(faDraxrp;u4tlto iciltfa ul(vs;t4 ltnxo3iotlp  au i;t0setoim ny4ol  mfci ()sDra(  ;u0aleo ieilsls rlnmo () etrxr3iadla r u i;s0s2ur(o3nu1lpe lict t aDtr(  ;u1tpt  ociysla2rl(mp (0 rtomf tydfm  auvils0srxoiopnudlpen netatfarrr(rono4tltoif3iadfs ean snt4teeoir3iy1laDr uvo;s texoxr iy1lmt lfciltfsDum( p;o0tle mieils m2eluvp ()arenmr totfm eai s s0sexoxo3oudopt liciat)srraump;t0tptn iciltfaDem(mp t) lxnmfcta1oaDr ues s0seumxr ny4omenmiei tfa2ta(m ot0opxomoeiad sDrlnms u4aexrif3ta1oaDeaivs () exr(r ny4ame lfvt t a2tr(mpot1opxomieiydlmDem( s u)teeoiocia1fatr u sls setoxm3io1alte feslt)sruaum ot4tpx mfcilsfsDumnms;(0areomociy1lpD luvilt)trto(o3oy4ol nmfvi (  rurumont1olenmoctas s2rmnmpnu0alxnxo3tytfm  li o;s)s2xo(mpny1lme mieia(  Durxr ;u1opto iciadfa rln o (0teenxf todom  auvs;t)texmxopno4om e fet () Draumono1olxoif3iys m rmumpnt4aetoif oadlaDrlivo t  rtr(rpnu1lmenmfcils) rumxm ot0alxomo3ilt aDuan p t)tltoxr3oa1om rlnvo;()seurirpoo4alenlneia(f 2uau  no0olxoifciytfmDul(vp;t0trxrxf iy1fmDelnei;s) rxrio iodolt lfvtlsfartr(mp;u1apx mf3ias sDumuvs;u)arxnmo totlaDrlu s t0t2xo(m3no4lpe mfcias artmxroou1tle mfetltlmDemnvo (0aeenmo oytopD ai s;() eto(m oy4ol  lnet (  2uax  ou0opto i3ildfm rm(vp t4 lxniocoo1op eai o;()trxoxopnudalt  fvsls) rraump;u1oee micilsfm2eaums;()trtoif oa1oaD  ieol()trtmxo oodalee ivs t s2ta(m ;u1tlxomiciaslm2eln sn(4teeoifciodlmt ln o;t) ruo(m no4olen ivi (  2um( pno4tptoio3iyt aDulnvpnt)altnircoo1fa elnvi;s srxoim3nydol nliesltfa2rr(r ou4ole io3iytls rm(vp u4tleomf3ia1latr n o;t0t2to(rpnudlmtnmnvtl(f Dta(mo;o1tltnifciydlmDuauvont0altnmo3ty1fp r ueil( s2xrio oy4lm n fcia(faDum( o;u1aex if3iasfa2ua(vp u0alxomr oo1opDe ivo t0srxo(rpny1ope  ivilsfaDrrxr ot0aee miciytfm eanms;t0artnif tatomDe u o;( seuoxm3nodlpen ieilt) rraum ou1aeen o3iadfm uau p;t)arxnif3iydom eau s;s t2urio iy1lm  mfct t arra(  oo4aexo oeias s uaumo;t)altrmr ia1fpDr neils)trtrir iydapte ncsls)s2rm( p;o4oeenmf3ild sDeanvsn(0 leoif todfpDeluvi;t setoimpoudom   fcs t)srtrxr nt1olx mf3ils a2eaums (0arxrmf ty1opt au i;s  etrxmpno1op emnvtls  2ur(m no4tex  o3tytla rmnvon(4 rxniociadlatrlneo t) etm(o3nudlmtemfvslsfs2ta(m ou1apeo octytls2rmn o (0texrio3totlp eanvolt)t2tr(o iudamte iei t) 2uax pou0oee if3iadla rmump t) eeoir iytlpt luvilt srtoxmpno1ame micta( a2tr(mpou1tpeomi3iydfm em(vont)areoxr3ty1oaDr u o s0sexoir ny1apen iesat) 2rrxronu1olx mfciyt m rauvo;u0tlxrirctydom   nvs ( trtrim3oo4op e fvt s s2trump;u4aptnmf3iytfa rmu pnt0aleomf3tydoat  u o;s0tetoxr3nu4op   icsl(fsDtrumpnu4tlt miciadlaDumump ()areoxf oytfmtr i il( s2xr(m oy4lm nmieslsfs2raxroou1oet  ociasls rl( p;u4altoxf3oadfpte u ils  2urxm3iudllenlfcsls)sDur( ooo1tlen icils m2umnvs ()tetnxf3iytopD lnvi t0 rxo(o oo1olt livt ()artau p;u4tetoii3iyd mDem( s (4aexnmo iodoaDe n i ( setoxmpnu1lptelivsat aDumump;t4tlxo icilslaDraumpnt)tlenmr3ia1fat  uei;s trxrxr nudlme  ivil(  2rmxro;t1alxnifeildfm um( p;(4tlxnxo3totlm r ues;s)trurxm nodape  neiasfsDraum ot1olxn ociatfs2ua( p t) etnmfcoydlat lu o s trxmxo3ny1alt  ietlt s2umump;o0oexomf3iasla emn p;t)teeoirciydfpDraiei t truo(r3oy1al n icia(fs2rmu  ou4aee mfctyd m2rluvp u4alxoxociodfp  aiei s0 rtrir nu1lp nmici ()srtau o;u0aleoii3iatla rmn snu)aetomr oydfat luvol( setm(opiu4olt licsltfs2umxrpno4olxn ieiatlaDea( o;u0 renir iodlpDeaivs t)sexoxopiu1al n ietl(fs2uru o;u1alx moeildls emump;(4tetrxo oa1fmt aieo;t0srumir oo4lptemivsl(f 2tmu o;t4apto f3iatlmDul(msnu4altrmoctytop r neol( t2trir iy4lp   neiatfs2ra(  nt0tlt ioetatfa rln s u4 ltoxfciy1oatrauvilt t2xrio nudlltelfvta( aDrmur nt1aeen octyslm eau p;u0aeeniocoytfa r i s;t)trurxm no4amt mics (f 2rrxront4tpen ocias aDrm(vpnu4 rxnxf ia1oaDeaneils  2tmim3io4oltemivt sf rrr(rpoo4aetoif3iadfa2ulums;t4arxrxf3todla elies t  2um(o3iu1ap  lnesasfsrrauro;o4oexo f3tlslm2ua( p u0tlxoxo3oadopD auei;(0srto(r3iu1am emieil(fsrtmu pnu1aexoioctasfm2rl(ms;t0teeoircoadlaD aivils t2uoim oo4altemiei s  ruaumpnt4tltnmieiytla ra( o u0alermf3oydlaDe i ilt0 eumim3iydopt mfvtas) Duax pnt4tpenmi3iasfm2eanvsnu0aeenxf3oodfaDe i o s0t2uoxopnudop e fcil(fsrumur ot4olt mi3iyt m2rlumpnu0 renmf todlate neo;()srxoir oo4omtnmnct s  2ta( oou4aex  iciadlm2ulums t4tltoifciy1fatrauei ()trumxr3iy4ape lnvi ()srur(moot1oltnmfciydls ra( o () ltrmr to1opDe neo t0 2to(o ou1al emnct sfarrmum ;t0aptnifetyslm2umuvo u4alerxr io1oaD livi;(  rxmir3oy1ap  mfcil(  ruauroou4aeto feilslmDra(vs (4tltrmo io1fa   n ilt0truo(m oudaptemicslt) 2umumpoo1tpe  iciydls rmu o u0arenxo3ta1om   n il(0sexr(m ny1lme mfctls a2uaxm nt1apenmoeiyd aDuln o;u0altoif3tadomD  nvolt  2umxm iu1ol  mfctls srtrumont4opeomf3tld a2rm(mont4 eerxo3iadfpte u s s0trtr(r3ou4ll  mfvsls) rtrx pou4aetnmieils aDumuvp;()aexnir oatfpDranvs t)srtoim3ou1ape liesa()sDua(m ot4olx  ieiydfs eau o;u)arenmocoo1fpDrauvils)sexoxm oo1op e nciat) rurxm ;t1oetnif3iyt s2elnms;t4 rtnmf tatlp elivs;s tetoxm3io4optemnctat a2ra(mp;t4aleo feiatls2emn p;t)areoircoy1lat  neol()t2xriopno4lm   fei ()s2raxmp;t1oexnmo3iatfa2rmnms u4 eermo3iy1lmt lu ils teuoxopnudop  mnci t)aDtaum ou4teen ieiad mDulu onu0 lxrir3iadopt lu i;()sexrxo3nu4ol e ies tfsrta(  nt1oltomociys s2emu p;t0 renmo oa1laD li il()tetmxo3nodapenlfei t)srtaumoot0olto fcildfa eanmo;(4teenmo3to1fpDeaueslt)trumirpou1lp e fctltfarrrx  nt4oetoii3iyslsDumnmp t) eermfciytfpteln s s)trtmxopiudlm   ietlt  2tmxmoou4tlxnii3tydla uauvo;u) rtrxr ty1fpD  ues ( srurxm3io4al e netasf 2ur(mooo4optnioeiytlsDulumo t4 rtnxfcia1op eli ilt) rumxmpiodll  lfetlt)a2tmx oou4apt if3tas sDemnmp t)trenxf iatlm   i ils t2trir3oodap elietls)s2rm(rp;o1olenio3ild aDemnms;u0aetrxr to1lm   neol( tetmxo ny1al  mies s)aDtaurpno4tlxnmieiatfaDuln s (0arxoxf todopD  ieil()t2urxrpoy4lltnmfesa(f rrmxm oo4oltn oeilslmDrlumo (0alerio3tydop rlueil(0setrimpou4lm   nvtlt sDtm(ronu1oleniocild mDeau sn()trtoxrctadoatraneo t) rtmxo io1ol nlietlsfsDum( o;u1olt if3tasla rmnms;() rxnio oytfpDeli ils0srumio3nydalee ivtls  Dua(r ;o4aetniieiytlm2emn s;(4aexnxo oy1lmD luei (0setr(r oudom nlfcia() rtaumpnt1tpx  ieiasfs ea( s u)alxoxfciodlatr uvils trurxmpnudlp n ivia(f ruax ont4tpe  ociasla uau o u)trxoxr oatlmDr n sl(0setoxo3ny4omeemietltf 2urur ou4ale mf3tatlsDeanvs;u0 ltomo3iodopDeaueo s sexrxopnydaptn feiat a2trum oo0aleo i3tadla uanvs;(4 renifciodop   i il(  etoxr3iudol n fvi s)aruru o;t4olenmocildfs2rm(vonu)trxnir iatomDrln i (0t2uriopoy1opee nctl( a2rr( oou4opx ii3ias aDrl(ms;(0tlxomrcty1oa rau il(0 eur(mpio4llenlivi s arumumonu4oetnmociadfaDum(mp;t)trtoxo ootfm   uvo;(0trxrxr nodamt lnvi s)a2ra( oou4tle miciysfsDelumont4 exrir3ia1omtrlueolt sexmxr3iy1lm eliciat arur(  oo4tpeoiictys m um(vs;(0 lxrmr oatla eauvi s0s2trim3nudal emfctlt s2um( pnu4oexnmo3iytfm em(msn(4 lermf3oa1fa elues;t0 etr(opio4opt liet ( sDua(  ;u1tee mo3tytlaDra(mp;t4trxnxrcoadlm r neo s trum(m iy4lm nlneil() rtmu o;u4alto fctltlsDemuvp;t0 renif3ta1omDrlu s s) ruoim3ou1omtemicil()s2ua(mooo1aee  ocildls2rm(vs u0 exnircto1lmtrluei;()sexm(rpno4ame mfvil() Draump;t1oetnio3tysfs ulu o;()arenxfctodla  au o t)s2xrxm nu4lmtn iei s) Dum(r nt1oetoiociaslm2ea(msn(0alerxfciydop e nvil()setoxo nu1al   iesatf 2rm(rooo1tlenii3tydfs emu p;t0 rtnxfciy1op  aies;() eur(o3iydolen ivilsfarurxr ;o0opeoif3iadlsDulu pn(0 rxrmo iotomDrlneo t srxr(o3ou1lp n nci t) rtmx poo0opeoif3iltlaDraumon(0 lenir ty1fm e nvils0tetrxm3nu1lpt licsa(  2umxro;o4tle iieiyd a uau ont0 lxnio oy1oateaieslt0 2xrxm3io1llte nvslt s2rrxmoou4aleo f3iltfm2ra(vont0aeeoxociy1omt aivo t)t2xoxrpiu1lpenmfci t  Draurpnu0teeomo3tlsla rm(mo;t4 eenmf3oytoaDrlueo;t) rtm(o3ny1lptemicta(  2uax  no1apeniocildla2emnmo;()altomf tatlmt livo (0trtmim iu1lmeelfesl(  Drr(  nt1aeto ietadls uau snt4 rxoxoctydopte ueol(0 etm(o ou4amee iet tfsrurx  ;t0oee  f3ildlaDea(vsnu4tlerxrciodoaD au ols0s2toxrpoydal nmncs tfaDtmxrpnu4apenmf3tytfa2rauvo;u0 eermr iadlpteluvi t0srxmiopnodoptelfvil( s2ua(mono1aee mi3iltfm rmuvs u0altnxociy1om  anvs;t)t2toim io1amte fvil(  rum( oot4aexo f3tyt m uanmo u0texoio3io1fm   uei;t)truoxm3no1optnmieil(f Drrurp;t4oltnifetydlm2elnvo u) eeoio iy1om eanvs;t0t2uoxr3no4ameemict s arum(  ;t4tpt if3iydla rauvpnt0alermo3oo1lptrlnvs s) etmxo3ou4lmt  nvils) Drmxmp;o4aptnmfciad mDulnmpnt4trtomo3iadlp  lu s;s) 2xr(opnu1lltemivtat)aDtmumpou0tlx  o3iydla2ea(vo;(0 rtnxo3oydomtean o s)setmim3ny4ol n nvs (  rtau  oo4opt moetas aDrmn snu)tltrxr ootopt au o s0seumxo oo1am  mfvtl(fartmu ont1alxo oeiad m rl( pnt0 exrxo oo1oaD  ivs t) 2ur(o3ny1apt livi t  rurump;t1tpx mieilt m2rlnmpn()aexoxf iy1op rlu o;t0 rxoio nudoltnlncsat)aDtrumont1tee  i3iyt sDulnvonu0aeenio3io1fa elivs;( t2uo(r nu1lmte ieilsf Dtm(mp;t1tlto oeiasfsDeauvo;(4 exoxociytop  an s;( t2uoim3ou4lpenmnetlt)aDrrxmpot0ope iocilsls rl(vp;t)tlxrxrcootlaDe uei;t)srtmxr3oy1opt mivslsfs2trxrono4optnmi3iasfsDemuvs u4 etomr3to1lateai i;t setrirpoy1amenlietat)s2tm( onu4oee  i3iltfmDrauvp u0alxnxo oo1lp rlieils texrxr3ny1ap nmfvslt)srrrxmp;o0oex  ictyslm ulumo u4 ltoio3to1fmtraneols) rxrxopio4amt lnvs t)artrxm nt1olxnif3tys s eauvsnt0trtoxo3oadfaDr u s s0trxmxm io1ol   icsl(fsDta(m ;o1aexnii3ilsfs eanms;t0 rtnmo3tadoaDelueils t2toxrpnu4amtelfes sfs2uaxmonu4olx moeiad s2rlnvp u)altrir3iytoaD an s;t)s2xmio3no4alen ncil()srrrxroot1aexo f3tltlsDrlnmsn(0tltrxf iotfaDelnei;s srxmxo io1lptelnvs ( s2urx pnu4alx mociyt m rln sn(4texoiocoo1oa elnvols  2uoio iu4ope  fct t s2trxr ;o0oeeoifetat sDel(mo t) rxrxocoa1fpt aieilt)trto(mpio1am e fesls)artrxmo;o4tpxniietaslm rmnmsn(4aetnmociy1fa e i slt teurir oo1lm e fvs sf rur(mo;o1ale  fetat s rl( o;u)tltomo3oydlatrluei;(0trxrim iydol n icsatfsrtmu p;t1tptoioetatls ul( snu)trtrxr io1fmtrauvils0t2xoxr io4olenmnvt t aDrrumpnt0olxnmi3tldfm rln pn() lenif iydop rliei ( sexrxo oudom  mfet s  Duax ooo0teeomfcildfm emu onu0trxomr3oytfm e nvs s  2urxopiydopte nctlsfaDururpnt1tpxn i3tld m2ea( on()alenmo oatfa eaueo () ruoxrpiu4omt mfesat  Drmxr ;u0aexoiieiltla2elnvpn(0trtrxocoodopDe neolt)s2xmxo3nu1al  mncta()sDua(r oo4tlxoio3iydls2rmnvpnu)aetoxocoodlmDe i sl(  rxmimpio4lm  liet s)arrr(rp;t4tltoifetydfsDemn p;()arxoiocoy1fateauvo;s s2to(r3iu4lpenlfeslsf Drmxr no1tpt iieildfm uanmp u0tlerxfciytomDrluesl(  2uo(o3nu1om nmnetlt)srumu  nt0aetomoeiad sDeluvpnt)aeeomociodlm rlieo (0 rum(rpou1op  mivta()s2uax pot4oltomoetldls rm(ms;u) etnirciotomDe i o;(0srxrxo nu1lm emnct sfa2rm(  ;o0tet io3iatls2em( snu0 lxrio todfaD  i olt)seuo(o oydll nlfcsa() rtmxroot1tlxnioeiasfmDrmn s u4aexoif3iatfaDrauvol() eurim3iudlp nmivslt)a2tmuront1aeeo oeilsfmDuanvonu0aetoio iatlmDelues;s0 rtoiopiudlp elfvs s) 2tmx pno1alxnif3tysfm uln o;(0tltoir ootopDrlu o s)s2uo(m3oudll n fei s)arraump;o0tptniieiasfs ua(ms;()trerxociytfaDr i ols truo(m3ou4lm e nvilt)arur( p;u4oet iociytfmDemuvon(0 rermo3iodom   uvsl(0s2uoxrpiy1lpeelneiat)a2urxm oo4olt mf3tldla el(vsn()tlxrxo3oydom rau ils)t2ur(r3no1al n ieiat) Dta(mono1texo o3tyt m um(vo;u0tlerxfctodfpD  u s (0texmxrpno1ll n iesa()sDua( pnt4apxnmfciatfm ranms;t0aleoxr ootomDr u s;s)srurimpoydamt  ictat)sDtmump;o4oexomfetas mDelu p u) eeomo3iotlat aneilt)s2tm(r nu4openmnetlt aDtr(ronu4apenmoeiysla2rmuvs;u4artrmocoodomte neo (0 2uo(mpno4om emfetas) rtmxronu4tpeomieiltlaDumumon(0tetrxf3ty1fmDeaivo;s) etm(m3io4al nmnetatfsrrr( ono4olx ioctytla uau o u)aleoxfcoo1oaD lu slt0 rxr(opny4optnmiesas artmxm nu1oleoio3tas m ulnvo u)aleomo3oatoate i ol(  rxo(mpno4ol   ncsasfsrra(m oo1opxnmi3iys mDrl(msn()aetoir3ta1lmt livs;t0setoxrpno4lmt lnvtasfaDuaxmpnu0alx ii3tyd a2umu on(0 exoio3oydfpD auei;(0s2uo(o nodolt lnvi sfsDrm( pno4oetomo3tatls ea(vo;t4aexrmf iadlmDrlnvo;s s2tr(m3oy4optelncsasfsDtaxroou0tpe iicild s rlnmsn() exrmr tytfm r ivi;s0sruoio3iy4apenlfcsas aDrm( poo4tlt mo3iltlm emnvp t) ltnxo3oytlptran s t)seum(r3oo1alenliesls  2rmum ;u0optoifciadlm eau o u0alenxf ia1latelnvolt teurxopoudam e fci sfa2rrurono4aptn octys m ea( p;()trxrxr3oatoat lieo;t0 exr(rpoo1aptn ncta()a2ta( pot0ole mf3ilt m ra( o;t4arenxfctydfm   nes ( srxmxopiodap nlnct sf rtm( pot0aptnmi3ildfsDel(mo t4 eeomf iy1omD  i i;(0trxmxr3nodom n fei tfsDrr(r ot4opxoifciasfmDrl(vsnu)tleoir3todlatr ueo;( tetmxm nu1am  lnviatf 2tmxmpno0oetn iciltlmDulu s (0arermfciotfa r u i;t) rxmirpiy4altelfcs s a2urxr ;u4oltomieiytfa ulnvo;()aeerifcoo1lptrlieol( sexmxr iu1omeeliet t  rrmurpno0olxo o3tld mDua(mont4 rermocoatlmDe uvolt0 rtrim3ny1omt lnvslt  2umumpot4aleomfciydfs2rl(vsnt0aeeomrcia1opteluvsls0seur(m3iu4lpe lfeta( sDumxm no4apenif3iyt mDranvs;u4 rxrmrcia1omDe u o;s s2xo(m3iy1lp emfes ( srtr(mp;u1aex ioeilt s emnvs (4altnir3iytfaDrln sl(0 rum(o iy1am nlivs s) 2urxmo;u1alt mfeildla rmump;t0 etnmrctotomtran ils0seuoxo3no4lmtelnet (fsrtr( ont1oetnmieiytlmDuaumsnt4alxomo3iydfm  aieo;( trxo(r3nydap nlfvia(farraur nt0ole mfetasfa umnvsn(4teeriociotfm r ies t) rtrirpou4ap n ivi sfarrr(rp;o0tee  f3iys a eauvp t)tltnmf iadfmDeluvo s0sexmxopnudam emictasfs2urxm no4tltnmieiltfs eanmo;u)trtomr3tydfpD  n i t0s2tm(r no4lmt lnei t)sDumxmoot0oltomfciadfm2elu o u)trtoioctadomDraivi;(0teuriopnudlpeelietls arta(r nt1opt mictatlm emumpnt4teeoif3oatfa eaivs;s  2ur(m3ny4ll  mncias)sDuru  ot1tpxomfciysfm2ua(vo;t4 etnif3to1la eauvsl(0srum(mpou1ale lfesls  rtmu pou1ole if3tldfs2umums;u)altrmocoodfptrlivo s)s2xoxopio1lmenmivi ()a2tmu pnt4aptoioctadfm ranmpn(4teenmo3iotopt auei s  rtoxr3iodap elictatfa2uaxrp;u1aexomictlt aDrauvp;(0trtnir3tadla rauesl( srxm(opnodaltemfes (fsDrr( p;t1ale iictltfs ul(ms (0altnmf ootop  livil(0s2umxm3iudaltnmictls  2ta(mpnu1oltnif3tys s2eln pnt0tlxoxo iy1opDelieilt)teumxm nydop elivtatf rtmx ono1ope mo3tltlaDul(ms (0alxomrcoydomtrlneo t0sexoxm iydap e ncs ( a2rax poo1aleomf3tatlsDrmnvon()trxrmr oodopDean s (0s2tmxr oudomteliet tfsDtrxrpnt4tetnmi3iytfaDra(vsnt)altrmr iadlmt an ilt t2urxm3oo1lme mnvtas)a2tmx  oo0opxoifeias s2rlnmo t4 rxnmfcto1faDranvolt)trurir iydomt mncsat s2tr(m nt1tleomociys m rl(vp t)aeeomf oatfaDeaueol()t2xrxo3ou4ape  icsa( arrrxr ;t0oltomociys m2ul(vo;t)treomr3to1omtran o s tetmxopio4lm n icsls)srra(m no4alt  oeiydfs rm(vont)tltrmf3to1omte iei;s) rto(m3oy4amtnmnetas)artrurpou4aexomietat a ulnvp u) ltnmr oo1omDeliesl(  etmio3no1al nlncilt)s2ur(rpou4tetnmi3tysfa uln s;u0trtnxo oy1fptr u ols t2xoxrpiy4lm n fcsat)srrrx pnt4alxnioeilt a el(mo;u0 exnif todfp  ai s s0trxm(o3no1al elivs t)sruaxrp;t4apeomo3tydfm ea(vpnu)alxnmr3tydoat ln sl( trxmxr ny1ape lfctl(f 2rr(rpou0oexo feildlsDrmu sn()tlerxrcoadfm  auvilt setrir3iudopen fvs sf Dtrxr oo0tpxoiietas s rmu o (0 leomo oytla   ueo;t)trxm(o3ny4ll e ivtltfa2um(  ou0aexoioctasfs2em( o;t0teerxf iatlpDrlnvs;s  rxrir iy1omt mfcs s)s2trxmo;o1tetnmieiatfa emump;u0 ltoxr3iotlmDr ivo;s0 exr(m io1om nmivs (f Draumo;u1oetnmiciytlm el( p t) lxnxo iotfatelu olt trur(r oo4ll   nes s aDtrur ;u4opeoiocilt a2emumonu0tlxoif3todoatrauei s)srtm(m nu1ape mieta()sDtmxmpnt1oex io3tyslm2eauvs t)tetnir oy1opD auei;t  exr(o oudope  nvils srurxr ;o1tleoiiciydfaDea(mo t) rerxocoo1fm  aieils0 2tmimpiu4lmtelfes t s2ur(r nu0opto ietltfsDeaumonu4 lerif3oa1fa r n s;(0texm(o3oy4apt  nei ( a2tmxm ;o4texomictysfm rl(vpn(0 rtnmfciotomDe uvols trxrxo3iy4olt  ivt (fsDurumo;o0ole iiciydlaDemnmonu)trtomr iatop elivils s2um(rpno1lm n nvta()a2tr(m no1teenmfciyslm umn o u0texomocty1lpDelu ol( setrio oy1al nlivt t)srtr( ooo4ale ifciytlm2elums;t0treoxr3oy1lat  ivols0 eumxm3ny4lpen nvta()sDuaxr ;o0oltnii3tad sDuan o (0teenif3todlpteanvs t0teuoxo3nodom nmieil()s2tmxmo;t1apxnmf3ildfaDrlnmpn(0 eeoxo tydfmteai i ( t2umxr3iu4al  mivtl(fs2rax  no0tleo oetasfsDua( p;()tlxoxo to1om   nes t sexrxo3iu4altemieil(fsrur( p;o1oltoiieildlsDra(vsnu)trtoxr3oytfmt  neo () 2trimpiy1lle lieta(fa2tm(rpoo1tlxniiciad s ran s;u)arxrifciydopt anes;t srxoxopou4apt  fctltfa2urxmo;u1oleo o3ilsfm2emnvo;(4arenio3oo1faDrlnvsls0 etoxm3oydalt mfvi tf ruau pnu0aptoii3ils a umnvp;u0aeerio tatoptr n i;s)trxoxr iydamtnlicslt arrmxmp;o0oltn f3iaslm2ean snu)aeenir totfa  lueol() 2tr(o oo1oltnlictlt)s2rmxmo;o0texo ictad s2umnvpnt4tlxnmo3iatop elies;t0truoxmpno4lpe lfcias s2umumpou1ole if3iadls2elnvpnu4altrmr oo1lpt au i s  2urxopio4alenlfei s s2tmumo;u1tpx iiciat aDrmuvpnu0aetrif3oatopDraiesls0trxmxo no4lp e nei (f ruauront0oeeoifciad m2umuvp;(4teeoxr tatla rlnvo t)srtoxrpoo1lmt  nctas aDraur oo0tetnmoeiad s rlnvpnu0trxrmr iytlp e ueils0t2trxr3nodlmtn fct (fsDurxr ;u0apeo i3iltls2raumsn() eenio to1fmt an il(0srurimpou1lmen feiltf rtr(  ot0tlxnioctytlmDrau p u)tlerir tadlpt  ivs;s sexm(r oo1altelnesat) rur(r no4teeomf3tysfs2emnvo u4 exnmrciotla e ivslt  eum(r no1lpt lnes t arum(r oo4opxomi3iasfs rlu o u0alxrmrcty1lp raieols0sexo(o oydoltn ivi tf 2trurp;u1aexn i3tyd sDrl( s;u)tlxoircoatfaDelueo t)t2umxm3no1amt  netl(f 2uaxmp;u0aet mieiyslm2ra(mp;(0tlxrir3iatlatr i ols  etoxm3iodam  lfvt t arrrumpoo4alxnmi3ilslm el( on(4alxoxfciy1lp rluvils)t2tmio no4lmenlnesa()srtrxmpnt1teeomocilslaDemnvs;t)aexomrcta1fp elieslt t2to(r3ou1apeemnvs t) 2raxrooo0tptn f3tlslm2elnvo;()trxrxf3oytfpD aues;(0s2uoio io1am nmicta( aDumxrpnt0apx io3tydfm2uluvsn()texrmo oa1lp   ues;t0t2trxr ny4ol emfei s) rtrurp;o4tpe  f3tatfa eln p ()teeomr iodopt au i t)t2um(m iy4lp nliesatf 2ra(r nt0texomfctydfaDrm(mo;u4aetoiocoydoa  li i;( t2xm(mpiodlm  lnvt tf Dtrumo;u0tptoifciadlm2emu pnu4 rtoir oo1lm  anvs;s  eurirpio1am n fcilt) 2urxr ;o4opeomo3ilt m2uanvs t)trtrifctotopDe n i;()srxm(rpny1apenliviat s2uru pnu0opxn fcilsla uanvs t0 exomr oa1opD luvsls srxmxopou4lmtnlfesl( aruru onu4apxomfeiadfa umu p;u)areomfcio1omtr neo;s sexo(mpiydamtnmfvslt  Dtrxmoot1tlx iietltfs eluvpnt)trenir3ootlatrli i;t teur(opiu1ll nmiesa() Dra(  oo0alt ii3tasfaDrmums;(0 lenio3iadla eaivs s0s2xo(r ou4lmenmnvsls sDur(ronu0olx  fciyt m2uanvp ()aexnir oydlpte ivsl(0 rxoiopny1lltelictltfsrtmumpot1teenmoetydlsDel( p;u4teeomocia1lmDeaivi;s0 rxoxmpoo1lmen iet (f 2urxr nt0opt mo3iydla ea( pnu4 renio3oatop elivs;t) 2trxm3oy1op nlfetas)srum(r ou0alxnmictat m2rln s ()tlenxo3todfpt aivo;( t2xm(mpiu4op nlictat a2raumo;u4opx mf3iatfaDea( p;(4 lenmo3oy1fa ran i ( s2xmxr ny4optnmncsasfarrrumo;t0tleo iciytla em(mon()areomf3tytlpDe u s s)trtr(o io4ale  nvia()srrrxroot1apeoif3tltfs em( pnu0tetnmrcoytlp   uvi t srtm(rpiydolt mivsas) ruauro;o4aexn fctls a2umu o t4texrir3oytlateai sls0t2tm(o3ny4optnlfei (f rumxrpno4apxomictasfm2emums u4 etrio iatomDraues s) rxoir ny1ame lfvsat) Duau ono4oex mi3ilt a em( onu4tetnmo ty1lm eaivils)texmimpou4opeelnvsls)arumum ot4oexn f3tyd m emnvp;() exoif oadlp r u o;(0srxoiopoodllenlics (  Drm(m ot1olxomieiyslaDumuvont) exrxf ty1om  aues s trum(o oo1omt lfvt t arua( o;t1alt micilslm2eaumo;(4 rtnmfctatlmtr nvs;()sexmio io1lptnlictl(fa2rrxmooo1tee  fetat m um(mo u0 rtrifcoo1lp eaueilt  euoim3nu4ame  nes ()s2rrx o;t1optniicias sDuaumont)arermociodfa rlu sl( t2umir3oo1lltn nct tf Durum oo0tle  fciyd s emnmo t4aleoir3oa1fpDelnvil(0 rtr(mpiu4lm emnviat aDurxr oo1tptnioctltls2rmnmp;t0treoxocootlaDraneo t)s2tmio3nu4optnlncsat sDraum oo1openmoeiyt mDuauvp;t0tetnxfciytomteanvs s)t2xmir oo4ope mfesls  2rmxmpot0teeomo3iyd mDemn o;t4tltoxo3oodomteanvi;s0 rur(o3iudolee ivtl( sDrax ono4aptnmietad sDuau o u0alxomr totomtrau sls0 2umxm iy4ome mivs s)s2tm(rooo0aetnmoeiysfm2ulnvon(0 etoio3oa1lp  anvi;s0srtrirpou1opee ncsasfarrmxr nu0tpxomfeiydlm2rmumo;u)treomfcoo1lp rln o ()sexoxm iy1omtnmfcsasfaDtrurpno0aetnmfciytla uan o u) exoxo3oa1lpDelneils  rtr(o3ny1ope  ieilt)a2taurpno4texnioeiys m2rl( s u4tleoif3oadoptr ivslt0 rxr(m oodame mivsa( arrr(m ot4texniieilsfs eluvo t0tlxomo3tadomt  ues;( setrxmpoo1ale mfvtatfs2tm(m nt1aexoifctydfa2em( s;u4teerio oodoaDeluvil( seuoxopnu4ame lieslt)srtmumo;u1apxomietltlm ra( s;u0 rxrio oa1fpD lnvo ()t2toxopno1omeeliei t sDra(ro;t1oleoioeiysfm em(vs t4arxnifcoytopDranvs;(0 2tm(m3nodole mfvtat) 2uaxr ;o1apxn ieiad s2umums;()tlermo3ta1opte n o;t)seumio3nu1am  mivt sf rraur no1oex ifeils s rm(vo u)altoio io1la r ivo;t0 2uo(o oy1oltnmfvtat)arrmu oou1tltomo3iasfm2elumsn(0tlerxo io1faDe uvs s0 exmxo nudlp nmfviasfartru ono4olxn ociad s2uln o;()aexoio oodfatraivi;t trtr(m nu1ll  mncsas  rua(mp;o1olt  ictydlsDrluvsnu0tetoir iy1fpD  nvilt0t2xmxmpiudomtelivias sruaum nt0aeeoif3iasfmDrl(vp u4alerxrcty1lpDr uei ()s2tr(m io1ol nlivi sfartr(  ot1oltnif3iat s rln sn(4altnifctotop eaivs;s0texmim nu1ll emivsas srurxm ;t4apt  icild a2uauvs;t)aleomociatfa   n sls t2trxo oodllt  ivils  Duaxmp;o0oetoif3iys a2uauvo;(4trtrmr3iytoaD  nei () etm(m nu1lmee nei () 2um(rpnu1tlt  f3ilsfs rmuvp;u)arxrifciy1oatrlnvol()trtrxm3iu4olenmncils)sDtaur ;o0openmfetyd aDrlums () rermf3tadfmtr ivs;(  2xoir iu1ll emfvs ()aDrmxm nt0optniiciltfaDua(vsnu4tleoxf3ia1opDelneilt srur(o oodlmtemieta(faDrmx ono1aetnioeiytlsDea(mo t4 rxrio oy1fpD aieslt setrxo iu1openlncia() Drm(mont1altn octlsfs ul( p t)alenxo3oy1lmDrluvs;()seur(m3nu4al  lnci (fsrurxro;u1apxnio3iadfs2rlnvo (4tetomo3ty1om rau i ()texmirpoudlmen fetas  Drm(mooo4aetn fcildlsDrlu s;(0trtrif3totla e n o s seuo(m3iu1lpen fvilt) 2uru p;t4tee mociltfsDul( p;t0trxoxr tadoaDelnvo;()s2xrxmpio4llen fvslsfsDum(  ;t4oee ii3tyt s2ul(ms;u4areomo oo1fpt anvi;s t2urxrpiydaptnlfvta(  rur( p;o4aeeoioctatfsDra(mon() lxrmr3oatfa eaneo s0trxmio oodape lnetls)aDtm(r oo0ope  oeils mDrm(vp;u0alenmociotopteauvslt)seurxr3iy4apte nctls) 2tr(mono4tleniicilt mDeanvp;u0trtoxo iadomDr i s s) exmimpoo4lptn fcs s) Dtaumpnu4tpx ifctld m2umumpnt0aexnirctadlpt  nvil() etrimpoy4aptn iesa(f rtmu ooo4tetnmoctat m2rmuvpnt4arenir oydfmteai s;s0sexrio3oy1lle mfcilt srra(moot0aeeoioctld a ulnvp;t0altomocio1opt aies;()t2to(r iudlm nlivi () ruaxroou1apt moetltls ul(vp (4aeeoxr3oytoptr n o (0texoxr3ou1olenmnesl() rurxmo;u0apxoio3ilt a emnvs t4trxoio3oadlp e n s;t) rurirpiy4ole lnetat) 2rrxmpot0tltn octls mDrm( o u)alenir ta1fateauesl()trxrir3oo4lp nmfcta()sDur(m nt4altnmoeiad m ea(ms u0alenmo oa1optr n sls seurir nodomtnlivta() rrax oou1texo i3tlt sDumump;(4 etrmf todomD  i ils trto(rpoy4op n ncs t arrrx p;o0olx  f3tlsfs ea( o () reomo3tadomtranvi;s trtoim3iu4lpenmiciat)srrr(m nu0olenif3ildlmDeauvo (4aexrir3oatla e nes;(0 eur(rpny1op e ivil(  rra(mooo0ole mf3iadla ul(vsnu4 lxrxfcta1omDrlies;t)s2urxo3oy1omt mieils a2tmuroot1tpeo ietatlaDel(monu) rtnxfcoadfptrai ilt)s2xr(o3iudomt  ict tf Draur ;o1teeo o3iat m um(vp u4aeermr oatfmtelies;t seurxr3io1alen ivil(f rrmum ;u4aee moetad s ra(vs (0teeoifcoy1lpD  i o;() rxoxo oydlp emicil() 2tax pnt1oexomfetas aDem( snu0tlxrxr3tydom eli i ()sexoim3oy1altelfcs s) 2uru p;u4tpxo o3iatlsDra(mp;()tetoxo iy1lmDr ivi ( sexoimpiodlm n iei sfs2umu  oo0tee if3ilsfs2ran p (4 rerxf oa1oa rau s;t0sexmxo3nu1ale miei ()aDtaxrpoo4tle iicilsfs emu pn(0aeeoif oa1op r i o ( texmxr3ou4oleemfvi ()aDrmurp;u0tltnii3tlt m eln p (4tltnirctadomtelivi;s) 2to(m iu1lm  lfvilt aDtm(r ;o1ope miciadlmDranvo (4altriocoadoptraneil( setmxm3iu4lm elfvtasfaruax p;t1aex  fctatfmDrmump;t0 exnmf iotop rauvs;( s2trim oo4oltelfetls s2umu  no0opx ioeiatla2rluvo ()alenmr iy1omt lieolt0 etrxo ny4om elieils) Dumu ont1apeo ocildfaDeaums;() renmfcoa1fp rau i t0s2trxrpiy1op nmnvta() 2rm( oou4optnii3tasfm2ea(vp;u4altrio iy1lm  aivi;t  rumxm3io4aptn feiltfs2tmu poo4tet  iciadlm rm( s;t)aexoifctatfa  lues s0srurxm iy4alen nvtas)sDur(rpnu4tle iicilt m elnvp (4trerxr oytlpD aiei () 2xr(m3iydoltemnci ( s2taxrpoo1altniociydlsDua( pnu0teerxf3tydlaDrln i;t trur(o ny1ol  mieils aDtm( p;o0ope ioeiysls eluvo;(0trenif iytfp eaueo;t trxm(r nodlpee ivil()a2rr(m nt0aeeo oetldfmDrmnmonu0teeomrciadla raueslt  rtoio oy1lptnmnetls) rtmu poo0tpeo oeiyd s2emnvsnt0 rxnirciytom elneils srxoio3ou1openlnvs s  2umxmo;t0ope  i3iysfsDul(vs t)texrio3tydfa r neil()srtrir nydam nmivt s)artm(  ;t1tetoiieiad sDrl( s u)tlxnir oa1lpDranei t0s2uo(r3nu1al  lnctls  rta(mooo1tpxniocildfs emuvsnu)trxomfcootfa r uei t) 2xmxm iydale licsat aDra( poo0tpxoiieiyslm rau p t0tlerxf3oadoaDrau s;(0 rtoio3iydapt  fctl(  2uru  nu0ale io3iyt mDeanms u0 etniocoytopDe iei ()t2trxr3oodamenlivt ()arum(r ou0alxn fetltfsDra( p;(4altrio3ta1laDraneils)trxo(m3iudam elnes (  2raxr ot4tpx io3iytfa2rluvp u) lxrir tadoa e ivilt0s2xoxm nydlm emfciltf 2trxmoot4tet if3ilsla ran on()texriociatlmtrau olt) 2xr(r3ou4ome  fesltfsDtm(m no1oeenmieiatls ea(mont0aeenxf oatfm r neo s)srtoim3iudlptnlivsl(fsDtaurono1tex  fctad aDuaumsn()tetrxo3io1fa rlivo (  rxmio iu1al nmnciltf Dtaxmpoo4opeomoeildlaDemn o;u0aexnxfcoytlmtr nei (0 rxo(r3oydolt mnvslsf 2trum nu4optniieiysfaDul(vs;u)trxniocoo1laD auvs t tetr(mpiu4olenlivs sfartax ont4teeo oeiltfm uanvs;(4 lermr3oadom eaivslt0srtrxr io1om  lnct ()aruauro;t4olxo f3tasfs2emuvonu4 rtrxfcoydom raieo s texo(opnodopenmictl(f rtr( poo1tet iieils a rmums;u0trtoxrciytomt lu o;( trxoxr3io4llen ivt s arra( p;t4aexnif3tysla2uan s;()alerxrciodomt ln i;()srtr(m3iydal   fesa( aDrmump;t4tlxo i3tls m2ua(vo;u4 rtomrciytop  ai ols) rxmxrpno4lmen iesl(fsDua( p;t0texomoetydfa2rln o;(0trermoctatfmtrlnvol() exr(o3iu4lmenmietlsf rtrxmp;u0tltoio3ildfa ul( s t)treoxrcty1lmt  ueo;s  eur(r oy4alen ict tfarrr(  ;u4olxn oetydla uaumo u4trerifcoa1opt au o;(  ruriopiu4am nlnciltfsrtm( o;t4apx  oeiad aDuauvp;t4artrxo3tatla rluei s0 2xmiopoudllen ivils  rtr(mp;t4olxomf3ils s2rlumsnt0altoifcty1lmDeau i;s  2toxr ny4omen ivt t)artr(r nt1oetn f3iatfs2ul(mon(0altnir oa1fm e u s ()s2tmxrpiy1lm   fvs s  rur(rp;o4alxoif3iyslmDem(mon(4arxoxo oatomt anvsl( srtrxrpny4apee fci tfsrtrxm nt0tpto ociat aDelnms u) lxoio ia1laDr nes ()texoir oy1alt  fcils) 2trump;u4oeeo f3iasls elnvsn(4teermrcoydfmteauei t)t2tm(o io1lpe  neta() 2tmu  ou0alxoio3ild m raump;u)texrirctytfm r n o;t0teurxr3io4aptemnet t)aDra( o;o1tlt ioctlt a ranvp ()tleoio totlatr uei s  2tm(o3nydome mics s)aDtr(mpoo0oetnmo3ildfsDranms u0trxrxr3tytfaDr ivi;s  2xoxmpnodamtemfetl()aDrm(rpoo1opeomoeildls uln snt4texrmr ta1omDr i sls)s2toxo ny1ome  ict s)srtauroou1tleniictldla eln onu0 lxoxf3oatlatr u s ()texoim3oo1ap n ict ()arurx oou4oeeniiciltfm2rmu p u4trerioctytfat  ueolt t2umir no1ol n ictas) 2urum ot1teenmoctadlm2rm(mont0 exnxr oadom rau s (0 rxrxopny1omtn nvia( a2umu  nu4olx miciydlaDeln s;t) eermrcoydlmtrluei (  euoimpoy4llt mfetas)aDrrumo;u0tleomi3iltlsDeanvsnu) lxrif3oa1fmtr ueo t) etoirpiydlm emnetas srtmu  no1olx ii3iadla2rm(mpnt4 lenmocoodopDr neo;s setrxm3oo4omtemfvsl() Dtrumpnu1tlxnmieiyd a rmnmp u)arxnio3oytopDrli s;t) rumiopiu1apeemneiat)arrm(  nt0optn oeild a ul(vo;(0 reomf3todlmD livo;t s2um(o iy4ol  mfct ( sDumuroou4tlxnifetltfs umump t0altrxf3ta1oatr neilt trxo(m3oy1am elncs sf 2uaumpnt4ape  feiydlmDelumon(4 etnxf oa1oat an i t)trxm(r oo1alenmfes tf 2rrxmpnu1opxnifctyt s em( p u4 lerio3ia1fpDelnvs;t srxrio io1open fvsa( srtmur no0oetoifcildfm2emnvs;t)altrio3todlatrlieo;() eumio iodlptnmicilt  Dra(mp;t0apx  f3tlsfsDuauvont) etoif3iatfmD aneo t)s2xrio3oydlpte fvsa()sDtaxrpnu1tltnifciadfa2uanvsnt4 rxrmf tydfaDraieils s2umiopoydoltemivta()arua(m ou4teeoiieilsla2rlnms;u) rxriocoydla eai ol() euoiopoydlptnlies tf Drr(rpnt4olto i3iadlsDrmnms;t)tetomf ootfaDrln ol()srxo(o3no1oltnmiei s) 2uaxrpnu1open octld m rmnms;u) exrir oydfaD li o;s) rxm(o iu4ameemfctlsfsDumxrooo4alxomfetlt mDrmn o t0tetrmrcoydopDr i o s)tetoio3iu1al emfvtlt) rur(roou1alxomoeiydfs2rlnmpn()alxnifcoy1faDe n i t) eumxopiudop  mfet t sDuau onu0apenioetlsfs2uauvp t)aexrxrctadopDeaueslt  2xmxo3nu4am elnciat a2um(root1oetomi3tysfm2em(vo ()aeermr3oo1fmDr nvo (0 ruoxo3nydlle lfvi t) ruau  nu0tltnio3iys a rauvo (0artomf3totopDrlnei (0s2trirpiudomtn fcslsfarrrx ont0alen ociltfaDulumonu0 lxomf3oo1lmD li o;(  rxoimpno1lmt mfvi tf Dta(mp;o1aptoii3tatfs um(ms;t0 eenmo3ootom r i i;() etrxr3nodamtnmfetas)a2ta(m no0tptoii3ils a2rlumsn(4 leoxr io1fm e u i s)setr(mpou1ol   ictl()aDur(  ;u4tlenioeilt s em(vont)areoxo iotoa  lueo ()t2xoir3io4ll elivs sf 2ta(r nu0oetn ieiasfs2raums u4tlxrir3iatlpt  iei;()trtoxr oo4oltn feil( sDtmx  ;t4tpt mociad mDranvo;u4aleoir iotfatr ivs;( t2xrxo3iu1apenmnvi s) 2tmumoou1olenio3iydfmDua(vpnt4areoxrciytlmtrliei ( t2tr(o iydop elfesa(  2rax pot4aleomfeiatlsDranmsnu0artrif3totfm r ueo;()seto(m oudomt miei s aDraumo;t0optnii3tadlm ul( onu)aexrxo3oo1laDraies s)trxoimpny4lpe mnciltfarta(ront1olt  fctasfm emu s u0tetrifcty1lm eluvs;s seto(opou4ol nlfvt (f 2uax  ot4optn ocilsfa uln s t0tltnxocoatlmtelnvi t)tetm(mpio4op  lnesas sDtrx  ;u1opxoifciysls rluvs;(0tetrif3iydomDe ies s0seumxo oo1opt  fvtlt aDtax pnt0tlxnmfctldfa2eaumpnt0 lxrxfcia1fmt li i;()t2uoio no1apte nei () Drrum ;o4aleomf3ilsfs2emu o u) eeomrcoytoatraieo;t0trxoiopno1lpenlics () rum(mpnt4alxnifctlsla2ranvs u) renmo3oatfaDranvolt)srxmimpoydlmtnlicsatf 2urumpot0tet  f3iasfa2uanmonu4artrxfcoytfa raivslt tetoir3ny1apt  fctlt srrrxrono4aetomo3ildfaDrmu pnt0trxrmo3tatopD  ivol() rxr(m3iydoltnlivs tfartmxr ;o0oet mi3tltlsDeanmonu4tlxoif3oytfaDeluvslt)t2toxopoo1apee icsa()srtmumpou4tetnio3tldfm rauvpnt0texrxo oodfateaivi t  2xrio iydlle  ieia( srtrurooo1teenmfcildfm eau pn(0 eeomf todfa ranvs;s0trurir oodll nlfvias  2raxmp;u1aeeo oeildfa2uanvs;(0 lenircty1omDeln s (0sexr(mpoudaptnlfcil(fartm(ro;o4ope mi3tadfsDulnvonu)trxnioctydlm r uvo ( t2trim3ny1oltn nvils  2ta(rooo1tlt mieias aDrmnmp;u4tltrxoctadfm  auvsls)s2xmim3io1ameemiesl()s2rmxmo;u4tpeomi3iytlm2elu o (0tlerifcoatlateli olt srxmio3ny1aptn fvs ()s2rmu  oo4ale ifeias a ean p;t0aexnxr3tytfm  aneo;s0srumxo oo4alt mivtl() Drmu oot4ope iietldfs uln s;t0tetoir3io1fpDeli o (0seuo(rpoo4al n neias srraxrooo1openmi3iasfsDrlnvpn(4altrmr tadfmDe ieo t0s2to(r3no1lpe livslt)sDraxront0tltn oetas s2em( pnt4aleomfcty1fatran o;t)trxm(m ou4aleelnetlt  Dum( ono4aexo oeiltfm el( ont) lermr3tydfmD  ieolt trtoxo3ny1lpe lfciat) rumx  nu4aex moctyt sDrlu pn(4texomociotomDeluvo t)srumxo3oy4ll elnctl(fs2urx poo4tpxnmi3tatfaDrl(vs;u0 lxnio iytlmtr nvi;t t2toimpoo4ll  lieia(  Draxmpot4ape mf3ild aDemumpnu)tlerxr iytlmtranei s)srto(r3iudlm   fesas)a2umur oo0aeeomfctydla umuvsn() lxnif3oydfat anes;()t2urimpnudapeelnvs t s2ur( ooo1oeen iciadfs2umumont0alxoif3iodoaDr u sls trtoimpnudap e fet t srrmxm ;t1apen oetydfmDrmnvs (0 rxomo3oatfm  li ilt0seur(r iudamenmfcslt)aDua(rp;o4tlxoiictatfa ul( o;(0trtomr oy1optr ieilt0 2tm(r iy1ol   ieslt  Dta(mpnt1olto oetytfa rm( o;u)tleoiocootlm   uvi s0trxrim iu1apt lneta(farumum oo4alxn iciad mDea( p u)arermr3iytfaD aiei s0 2toxr3oydamt mfcil( srra( p;t1tpx io3tldfmDuaump t0tetrxoctodlpD  nvo;t s2xmio3oo4lp e fctl(f rurxmo;o0tleo ociadfa rl( p u0aexoxociy1fmteluei;t  2urimpoo4altelfvia(fsDtax ooo1tleomoetadfmDrlnvpnu0altrio oytop  lueolt0sexo(o3ny1op elietasfarrax  no0oex if3tytfmDulu p;t0 exoxf3todfm   u s s0trxmxrpnodapenmnvtls  rtrxrono4teenmiciad a2rmuvsnt) ltoio todfp eaivo (  2xr(r iodaptnlnetl(  2rmumo;u1opx  i3iyslm2ulnmo;t4tetnxfcoytfptrlnvolt srtoimpou1llee ieiat)s2uaxmp;u0aeeo feilt a2rln o;()artniociydlpt  nes t0trxriopoy4am e nvil(fsrtmxroot0tltoif3tytls uan p (0tlenxo3ta1op   n ilt0srxrir3nu4ll e nesa( s2raxrpoo4tpeniiciytfmDuan s;u4 lerxf oatomte ies;s  ruoxrpoydoleelivslt)s2ra( p;o0tee iociaslm2elnvs;(4trermfcoadom  auei s s2xoxo3iy4lltn nvt sfa2ra(moou0oex ii3iydla2ulumon()teeoio3iytopDr i s t0texmxm3oudlltn ivtat) rtaxmpnu0opxn octysfm uau pn(0arxnir3iodopD aues;t) 2xmir iudamt mivs (faDrr( p;t4oee mo3ilt m2emums;t0 exoirciydfaDr nei;( teurxopiydale  fctl( a2rrxmpno4teen fetldfs2umn pn(0aeenxf io1omt lies t s2tm(o ou1lm   fcsa( a2tm( pnt0aetn octls s uauvon(4tltnif3tydla  livs t)t2umxrpiy1apt mivt (f Dtaur ot0oeen ieiaslsDrlumo t4texnmfciytom e i s;t0 2xr(m nu1llenlnctl() 2ua(r nu1aetnifctatfaDrlnms;(0 lenmrciotfp  liei;s)srtmio ou1am   fctat arumum nu4apeomi3tlt s2rln o t) rtriocoo1lmD luvols0 2urir ou1llee fetlt  2umu pno4tltnmi3tltfm2rm(vp u0 lermo tadfaD  iesls) 2xoxmpio1lpt  ivtlsfa2umur nu4aet iicilt s2ulnmp u0texomf ia1fmte u sls0s2ur(r3iy4am nlnvtlt)srrru  nu0tpe  fciysla2rln o () lxomr3oy1lmDelnvs;s0 2xrxo3no4ome  fvtlt)artm(m no4alx miciytfmDea(monu)trxoxfcootomD  neo s)s2umir nydlpe  ivt sf Dumxrpnt0aee mi3iltfmDrlumo;u) rxoxfcty1laDeli ols)s2xoxrpiydope lnesltfs2uaurp;o0aetnmociatfsDelu o;()trxnxf iydoat  ivo t tetrio iydll   fct ( srtmxmp;t4tpt  feiasfaDrm(mon(4tlenmrciytlp  ai s;() 2tm(o nudlpenlfetas a2tax  no0tee ioeils aDrm(mp (4trtnxf todomt an ols seurxo3oodamenmnetls)aDtaumpno0oetnmfcild a2uan o;(0tetrxo3oydfaD  neols0tetr(opnodllte ict sf 2ur( o;t4tltnmo3iydfa um(ms;u4alxrircta1lpD anes;s)s2tr(m3nydalt lnctl( artmxr no4optomoeildfa em(vont4aetoxo3todlmDeln slt) ruoxo io4omtemfcs ( artaxr ;o4tlx mfetltlm2ulu snu4artrifciytoaD  nvi;s0trxm(r3oydoltemics sf Dtauroot0tpe  iciydlsDuln p;(4artoio oo1fmDe u ilt0srtrir io1lp nlfcia(f rtmump;o0tlxo ociltfsDeln s t0altrxo oydfm  aues;(0s2xm(mpiu1alenlfct tfsDuau o;o4apt ii3tatfa rlnvp (0texrmf oadop  lnes;s0sexmim3iudlpe  fvs (f 2raxro;o4tle ifeiydfa umn o;u0altoxr ta1fa eau ils0truoiopnydam n fci ()aDtmuroot0oeeomoeiydlmDra(vo;t0aetoifciydlmtr u olt) rxmio oy1om nlfes s sDtrurpnu4apeomfcilsfm umums u0 ltnirciydfpt ai il()trto(m nu4lm  mnesltf rtmurono1olenio3tydfmDemnms;u0 etomrciatlaDeliei;t0texo(r3iu4oltnliesl(faDrrur ot4aexoiocias s rluvo (0trtrxr3ia1fp r ivo;(0seurxm iy4lmee ictltfa2tmxm nu4altn octadfaDumums u0tetoio3iodlpDr uei;() etm(o3nodomen ieiat a2raxrp;t4tpxomictyslsDrm( o u0 ltnxf ta1lmDelu s (0srxoir3iy4omt mivtlsf Durxm oo4altnio3iltfm eanvs;u0arxoxf3ootlp e ieilt) 2uoxm nodam  mfetat)arta(  no1alen fctadfa ulnvsnu0artomo3iytoa e uvo ()t2xo(o3ny4llenlivtas  2taum ;t4openmf3iadfs ulnvp;t4aeenxo3oa1oaD  u i;(0 eumiopiu4amee nvsatfsDrr(rpot4teenmf3tadfs rm( ont0alxrmo ia1opD au ols0 euoim3iu1ll elnvs s)a2uru p;t4tpx  fciltfs rl(vp u0aexnxrcoodlp elneolt)t2urio nu4alenmfcil(fsDrm(r oo4olen oeiytfmDeaumpnt0texoxf oadlpDr ueolt teumim nudlmtnlnvtas arrm(moou0olto oeiytlmDrln snu4tltrmoctytfptranes;s  etoirpnydom e fvsls) 2taxmp;t0aleomieiydlaDemump t)texoio3ta1la rlueilt)t2uoxo3iy1lpenmnesltfsrrm(rp;u1tle ifctlsfm2ulnvsnt4 reomr iydomt  i s;s) 2trxm3no1ol  mnci t  rrm(rpoo1openmf3tytfmDrmump (0 etoio3iodfptean i;s setoxm3no4llt lieil( srtruront0tlto o3iaslm ulnmpnu4 exrirciy1oa eai i s srumirpoydomtelfeilsfaDumum nt4teeoiictat mDraumpnt4 etnmfcoatopteai il( s2tmirpnu4op nmfcsasfaDum( o;t0apxn ieils sDrmuvo t0aleomf iatfp rlu sl(0 2tmimpny1altemfei (  2tax ooo1aetomociyd mDulu s t4trxnxr oatop  lnvs;( sexm(o3iu1ol  mnvsasf Draxrpot0apxniociltfa2ea(mpnt0artrxrcia1la  lueol(0sruo(o nu1al n ivs sf 2rmxmpnu1olenif3tlsls ua(vont0 ltnxo io1lmD anvi t) 2trxr ou4amtn fvilt)srrr(r ;u1tpen feilt sDrl(msnu)trxoxr3oydlaDrlnei s0 etr(mpnu1llt lfcsatf 2rm( ono4oex  iciasfs2el(vs;u0 eeoiocoodomtrlnvilt)s2uoxopiydaptemfetls aDraxmpnt0oetn ocild sDrm(ms (4aeerir3oadom e nvslt)s2xrir3io4lm n fvi (fs2uauro;u1optnmf3iat m2rm( snt0altnmoctydoa eauvi;s0srtoio3ny1ol  lieiltfsDumu oou0olen ocias sDeluvsnt4aeermoctadomtraivilt0trumxrpio1lltemfcil(  rta(  ot0apx ifciadfs em(msnt4 rtriocoydop   ueo;t0 exo(rpnu4al n feiat aDrru pno0opt  ietys sDem(ms u4trermf3oydlaD lies s)trtriopno1lp n nvsa(fa2urxmpnu1opeomieildfaDrm(vsnt)alerif io1om e u sls) etrir3oydoltemncsas)sDtaurpno0aexo o3tasla2rmumsn(0 eerioctadlaD aivi t0srurxr3iudom  livtatfs2um(mo;u0teenif3iadfs eauvo (4teenxocoatfmD  i il()sexrxo3oudlleelfet (f 2tru p;u1tpx mociytlsDel(vsn()alenxoctatop e i i;s)s2xrxmpnu4lp  lfvsas)arrru pno1ole  ictat m ul(mp;u0 exoxo3oytfa  lnvi ()sexoxm3no1lmenmictas) rrmxmp;t4altomf3ilt m2um(vonu4areoio3ootlpDrlnvsls0t2xmir iu1ale liesa(  rrmxmpoo0opx mictadfaDum(mpnt) lermrcoytfpD  neilt srxo(mpiy4om  licslt  2trx p;o4apx iieiat sDra( sn(4altoif ootomtr uvo s)srxo(m oydlleemnetltfsDtrumono4aex ifeiyslm2rmums (0 etrmocoydlaD ai il( truo(mpno1om e ncsa(fa2rrxronu1openioetls mDra(vont4arermr ta1lpDrlneo (0 2uoimpoydllt mfeiasfsDrm(mpno4olx io3ias sDelu pnt0 lenircia1lmDe nvsl(0tetm(rpiu4opeelnvtl(f rrmx  oo4apen ieiysls2em(ms u) lxnxrciotom ran o;s trxmim3oudom emicil()s2rax p;u0opeo ociysfaDua( p;u4tlerifcoadlaDelueils trxm(r3ou1ame lfvt s aDtmum no1tpxoifetasfs ulnmpnu4texrxo oadlpD livil(0sexrir3oy4llt lictlsf rraxmpou0olx mf3tyd mDrmnvp;u4alxrifciydlpDr ueo;t t2trxrpoy1om nmfei t srtr( pnt1aee moeiatfs2eluvsn()tlxnxf3oy1fmDeau i t0 2trir iu1lm emivs (  2trx  nt0tpeoio3tadls eanmp;u) lxrxociytop r uvs ( trtriopnydamtnlnesltf 2umur ot4tlt ioeildlm ulnmp;()tltrmrcty1fmtrln olt trto(opno4lmtelnvt t)a2uax ont0oexomieiadlaDrl( p u0arxoxo oatfmteli i t  rto(m3io1apt  nciasf Drr(mono4tpeomf3iadlsDuau p u0aexoxr iodlmD aieil(  2uriopiudlmee ietl( s2urxrp;u4oltnio3iadlm2umnms;() rtoxocto1omD lneo;(0trtmir3oodlpee ncslt  rtruro;t1apxnmf3iltlmDelump t) rxomf3iodfaDrlueols0texoxopio1opt mnei t  Dta(moou1altoioeiaslm ean ont0arxnmf3oa1lmDe uvils0srtmio oo4omenmieias) Dum(  ou1optnifeild s2eau onu0trxrxo todopt  neslt) rxmxmpiydaleemfeiltf Dra(rpot1opt  icilsfaDem(mpn(0aexomr iodlatr ues;s0tetoim oodlmeelivsat)sDrmxrpoo0tlenii3ias m rlump;u0trxnmfcio1fm rai i t0trxr(mpiydop elfvils a2raum ;u0oexo ociasfm2eauvpnt0aexoif iotlpD livi;t  euoio oy4lptnmfvi sf Dtrur ;u0tptnif3iydfm2ua( p;u0treoif3oo1fm raieo;s0trtmim no1olt lncta()a2urxm nu4tet ii3tltfm2umu p (4 rtrir iodlpD an i () etoiopoudlmen fet sfsDuaump;u4tlx  o3iysfs uln ont)aeenmfctotom rau o t0 rto(mpnydame mncsls) Drr(ro;u4ape ii3iatlm ranmpnu4tlxnxr ia1om e ueo;s t2umxo3oo1ll   fvsl( a2taur ;u4tetoiietlt s2rlums;t0 eenmr io1oa  lu s (0trtoxo3oo4lmt  fvt s)aDtm( ont1ope  oetlt s2ulnmo;t0aetoxocoo1lmDe ues;s)srxo(mpnodol nmnctasfsruaurpno4opt ifeiasfsDrlumo;(0artrio totlp e nvs s)s2tm(o oo4op elnesl(  2taxro;u1tlxomoctyslm2rauvo;() rxnir oadom elneo () rtr(o nydlltemfesl()s2urxr ot0tlxniieiaslmDemnmo u4texnxo3iodlmD  n o;(0 rtrir oydlme mfetltf 2rmxmp;o1teeoif3iyd m2ulnmon(0aexnmr3ia1fmteanvil(0 rtrxmpiodap elfet sfsDuaxrpou0apt ii3iyt a rmnvs;u)alxnir3iadfa rli o ( t2xr(rpiu4om nlfvtasf ruaump;u1alx  ociyd a2ra(vo;t0 rtrif3ty1fmtr uvo t)t2umim3iy4oleemici t sDumur ;o0aptnmiciat m2rlnvsn(0alxoir to1fpDr u s;s) eumio3oo4ome lncs sfaDtr(mpno4tptomieildlsDulnmpn()trtrmfcio1fp  lnvi;t0s2uoxm io1al   nctatfa2uauro;u1tltomi3tlt m2eanmon()altrifciytopteaivo (0teur(mpiu4lmte icslsf Dtmxrp;o0oee  o3tltlm2raums;u4aeeoif ty1fat  uvils0seuoxrpoudame  nvtl(fs2rm(r nu0ope  fcilt aDeln o u)trermfcoydfpD aivsl()t2xr(opny4op elfcs ( a2umxmpno1apen ociydfs ua(vs;t4 eenxrctotfpDrln s s tetoxopoudlltelicslt s2tmxrpot1tleomoctatfs elump t)aeenxf iotlptelieil(0 rxoxr3oodlpee icsat)aDurx pno0apx mieiysfm2emuvp u)alenxf3tatfmD aiesl( t2ur(r3oy1lmtelfvi ()aDuauro;t0altnmfetad s2ra( on() rtomfcoytlp eai olt) eurxrpoudop  lfei ()sDtmxr nt4tee iictldlsDemnms;()tleomf3iy1optrauvi t0sexr(opiudap  lnvilt  Dua(mpot1oeenifeiydls2rlums;t)altrif ootfatelivi;s0sexoimpnu1lp  lfctat sDumxm nu4aeeo f3tad sDulu snt0altnmr3iy1omDe ueols s2xo(opiudapt mietas)srtaumoot1oee iociadlm2ranvp () eeoif3ia1fa elneol(0s2umio3oy1optnlfetat) Dumxr oo1aeeomociydfm umn s u)tetrmr3iatfpD an ol() euoxo3oodomee fctatfs2ta(m oo0altomiciat s um(msn(0tetrxrciytlpDranvolt0srxoxmpnodaleelictat  Dtr(r no0aptomo3iasfm2raump () lxnxo iy1omD  ieslt teurim io4amtnmncia()aDurxm ou0tpeo i3ias a2eanvonu4 eermocoatop rai o t s2xoxo ny1al elfci tfarra( pno0opxn o3ilsla uln p t0 lxnif3oydlpDe i s t0s2xoxr3iydole  icta()aDrm(r ;o1tltomieiasfa ulu p u0areoxociydlpteaues;( s2uoxo iu4lmte ics t) 2rmx o;o4texo ociad s emn o;t0arxoxrcoadfmt  uei t0srtrir nu4aptelnvslsf rururooo1olxomiciydfs2umuvs (4altomfctotfpD anes;s0t2xrxmpny1olt mnctl( s2tru  nu1oleoifeiltlm2el(vsnu4trenmfciodoaD ai slt0trtm(m ny1lmt  nvs sfa2rmu  ;u1tptnmoetlsfa el(mon()texnmf3iy1lpD au sls) rtr(rpoy4al   fcil( aDrrx p;o4tpt iiciatfmDuanmonu0arxrmf totlpD  neo;s  ruo(opiydlpee ivt t)a2taxmono0alenioeils m2rlump t4 eenmrciatlptelnvo;t)seumxm3iy4altnmfvs (faDtru  nt1tpeniieiadla ulnvo;u4aleomo3oo1fa  ln i s)tetrir ny4lpt lncs s s2ra(root4altn ictldlsDuan p (0areoxociotom r uvs t0 ruo(o3nodlle miciat  2umxmono4oetn ictltfm rl( s t) etoircia1faD  uvs;t0teuo(rpio1aleelfesa(fartm(r nt4oeen fctadfs eauvont4artrio3to1opte nvs;s)srxrxo3ou1ll nmivsa() ruru oot1tex ioeiydfsDulu o;t) lerxrctodfpt  u o t) 2urxo3oy1opt mfeil(f Duru pot0teeo f3iydlm2rmu s u)artnxrcta1fa eli i;t sexr(o3io1al e nvta(fsDtaur no4aexn ietldfaDum(mp;u)alxrmr ootlmD aues;()trur(m3iudaptemnesa( a2uaxrono4tex  feiydls ul(msnu4teerio iatfp ranvo s) 2ur(r3no4lptnliei ( sDtaum no1aex  oeiltla rm(mon()tetrmo3ta1oat auvi;()s2xoir oydapt  icsls arrax ono1tpeoioctyd s ranmp;u4aeenifciydomt lieil( s2xoirpoudoleemietlsf Dumxm ou0tpe moctatlaDranmo t) exomfcoatoatean i t0sexoiopiudllt mnviatfaDra(  ;o4oleomi3tytlm2rl( p t4 etnxfctatfpteaivslt0 2triopio4ap nlncsas)s2tmumpnt0opxn oeiadlsDra(vs t)alxomr3ta1omteli i;( s2xr(rpio1llenmfvsa( artaumpnu4tlenifeiasfs2ranvs;u)aexnmoctatomDe iei;(0trtmio3iy4openlfeia() rtru  ou1olxnmieiyd m2ra(vo (0arenxrcoatlm   ieil(0 eurxm3iodlptemfeiltf 2raxr ot1oex mfciltlsDean pnt4aleomf3iydopte i o;( texr(m3iodlm eliei () Dumx  ;o0optoifetlslaDelnmp;(0tltoxf oytfptr u sls  etoxm3iu1ol n fvt t)aDtmumoot4oltomoetldfs elnvs;t)texomfciotla  auvsls  euoxrpou4ome  icils)s2tmu  ;o1opxoii3iatla2eluvp;u0aexoxrcoodom e ues s s2tm(m oodlpe mfvt s) 2tru ont1tpt io3tat aDulnmp (4trtnxo iydoptrluvo t0 euoim ny1alte fcias)s2umu  nu0optoif3iysfm ra(mp () exnxf tadlate n o () etoimpno4am  mfvi t)sDrrum ;u1tpxomfeiydfa ea(mp (0trenxocto1latran o s)setrxr3ny4lltnlieils srtmxrpou4apto octls sDeluvpn(0arxrmfciy1latraueo ()s2uoxo ou4am nmfcsls arrrx p;o0openifctysls2ra(vp (0aleoxr3oadlmtrlu ils0sexm(r iu1lleelfetat sDtmurpnu1opt  ietytls2ua(msnu)tetomf3oytop elieo t) etmxo iy4optn nvtatf 2tmx ont1ape miciydlm rl(ms u4trtoxo todop   n o s0 exrim3nu1alt  neilsfsDur(r ot0alx  fctadla2rauvsn(4tleoir3oatlaDrauvil(0tetoirpou1apeelnvil() Drrxm ot1alt mi3iyslm ea( onu4trtrxf ootlat li i;s0 rumimpny1om nlnvs tfs2tau pnu0apxnioetyslaDea(mp;t4alxnir3iytfmteli s;t s2uoio oo4amt mnvtasf Draxront0texoio3tyt 
\ No newline at end of file
@@ -0,0 +1 @@
+n i s0sexmir oo1ol n fesa( srrau oou0alto ieiatlsDulnvonu4tlxnmfcty1lpD au o (0 2uoio oy1opeeliciasf rrm(ront1tet  ietlt sDua(mpnu0teenxr ta1fatrlnvi;()srxo(r oo4omee nvta(f ruaumpnt0aee  feiasla2rmu p;u)trxomr3tatfpDeaivi;(  etr(o3iu4omen net t sDurx ooo4alxn i3iyt s el(vsn()artrmo3ootlmte i ilt srxo(r iydomeemivi (f rtrxrpoo0aet mi3tatfmDumums;u4 lenmf tydfmteauvsls  2tmxrpno1omenlics sfs2umumonu0opxo feiatfa2emnms;u0 exoir ta1fmDe nvs;s sexrimpiu1ale lnct sfs2rmxm ot4tpxo feildfmDul(vs u4arxoio tatfpDe i o () rtmimpoo4aleelfcil(fsDrmu  nt4alt mi3tlt a2ulnvp () reoio3tytop  au s;t) euoxrpnydllte ics s)arrruro;t0tpen i3iatlaDran snt0 rerxocta1lpD  i o;s  2tm(mpoudom nlfcsas)aDrm(ro;t1tptnmfcildfaDua( on(4altomrctytlmDr ivo;t0teum(o oo4lme mieias)srumxro;t0olt if3iltfa2ra( ont4tlerif ia1fmD an il()t2xm(r3oo4lme lfcs tf Drr(ro;o0opt  fciadfm2ul( snu0arxrxf oydom eaueo;t)trtmxm3oydomtn ivtlt)s2raumpnt0optnmietaslsDulnmp;t0trxrir3oadoa ran i;t)s2urxopnudap e ivi tfsrtmxm ot1oltomoctyd mDulnms t)tleniocia1lat  neo;t) rtr(r3nu1lptemnet s a2tr(r ot0tpxo ociat a emumpn(4tlenmf3ootomDe nes s)texo(r3oodop   ncias sDum(mpnt1oetoifetysfm ul(msnu)trtnif ta1lmtraneilt0t2tmim3oudaleelivtas) rta( onu0opto f3iadlm2ra(msnt) rtrxocta1laDeln o;( s2triopoy1optnlnvi t srrruro;t0tet iietls aDul(vs ()treoifcty1lmteau i;t0setr(mpio4ole  ncsa(fsDrrur ;u4tee  fciasfm2ulu p (0tlxnxr3ootlaDeluei;t0 rxr(r ny4alenmivi sfsDumxrooo1tptomociad a uaump u4trtrio io1oatraneil()trtoiopny1lm   net t srtmxmooo1tlxoioeiasla uanvpn(0 exoir tadoaD aivo;(  etr(m no4lp  lieslt)aDrmumont0ape mi3tytfaDea( p t) ltnxf oytfat liei t0 rumxr no1lp  lnei sfarumxmoou1tpe  octlt aDulnvpnu0texnmf oadoaDelies s  rtmxm3io1lleemnes s a2rmxmont0aleo i3ias s2em( s t4 rxoxr iadla r nei;()t2xoim3nudlmtnlfcs s)aruax ooo4oex  i3tls mDeln o;t4altomoctatom eli i;t0 etm(mpno1ol elncia() 2uaxro;u0oex ioctadfa2eanmo;u4 rermf iytlp r ies (0t2urxo3iydalt mfeta()sDuau p;t1opxnmiciltla uluvpnt)aeerio oatfateauvi;() rumxopno4apt  nvt t aruax pou1alx mo3iytlm ra(mp;t)arxoircta1fpt  iei s)texoiopiudlmtnmieiasfa2rmxmpno1openio3iadfm2eanmo t0aeeomfcoy1fpt lnvi;()t2umim3ny1ll nliesl( srumxm ;o0olxoifctaslm ua(von(0 rtomrciatfm   ues t0 2tr(rpnydom elnvs t) Drr(  ;o1teeoifeilsfmDrmnvon(4 exomo todoatran s t0s2tmir oydapeelnvsa(faDrmx  ot0opxoiieiadlm uln p;u) renmo3ia1fp e nvs t  exmxo nu4al n fvt sf 2umxm oo0aetniiciad m2um( o;u)treniocto1lat lneils)sexrxr iodlp nlieiatfarua(mpou4oexn ieild a2em(mo ()teenxfctytlaDeluei () 2xrxrpnu4op   ncias  2trxr ;t4olenmicildlaDrlnvp;() lxrxrcty1om e nes;t t2xoim no1lpen nviasf 2rmxrpno1texo fcias s um( s;t)teerxf3to1oaDrlnvs s0trtr(opio4lp   fviltfsrtm(m no1aptnmietasfsDea( onu4tleoxf io1fmDraieils  etrxo oo1op n fvt s  2trxrpot0openmoetls m ul( p (0tetrmo3io1lateaueo;s srxrxm3no1altnlncsas)aDtm(rp;t0olt moeilsfaDua(vp (0 ltrxr3iadomtr u il( seum(o3oo4ol e neia(f 2rr( pot1tetnmictysfaDrlu s;t0alenio3tydfp eaieols) exoxr io4op n fvtat)sDtaumoou0optn ieiydlm emnmsnu)teenmo3tydoaD li sl()trtrim iy4olen neias)artrx  ot0tetomietasls2uanvp u4aetnio3oy1fa  ai il( teurir io4amenlfvt t arua(rpoo4apenmo3iytlm umu p t) etnxo iadfp e n o;t0t2xo(o3iu4al nlfcias)a2uaxr no1oetoif3tydlaDuaumonu)tlxomrciodlmDeaues t)tetoxm3iodameelics ( sruaur no4altniieiyd m ran ont) exrxr3tadlp eanvo s)srumxmpnydopee ncsas  rrr(mpot4tltnioeiytlmDulnvpnu)aexoxf ia1oaD ln o;s0trtoxm3iudoltn nvs sfsDtrxr nu0opeo iciasfm2ulnvo;(0artnmo3iadfmDe ueilt  2xoim3nodlme lics (f rrr( p;o4oexoifciatfs el(vsn()aetoir3iodfmDe ivolt)trxm(rpoodlptemivi (  Dua(mo;o1tetomfetyt aDul(ms t0aexomo3to1opDe n s;t trtm(opio1am nmfetasfartr(m ot0apxniieiadlaDraums t4alxnxr todoaD aivslt0srxm(rpiydaleemfvi sfarraxrpou0tlxomf3iydfsDeaump;u4 lxrmf3iodlpte neil(0s2xr(r ny4aptemnvt (f rtrxm ot0ape io3iydla2umnvp t0tleomrctadoptean il()texm(r oudlm  lnctls artaum nu0teeoio3ias s elumpnu0 ltrmocootfpDean s;s0s2xo(m3iy1open ncilt)artr(ro;u1apx mo3ilsla2el( p u) renxr io1lp  ln ol()trumxmpno1am n ici s) 2tmx onu4aex  f3iytls2ea(msnu)teeomrctotfaDelnvs s)t2toio3oodlmenlneias sDuax pnt0tpt  iciatlaDrm(vo u4aeeoio oydfpDrlu s s s2xo(r3nydapee fviat)aDrmuroou4tpxnio3iatlmDemuvs (4trermr3ta1lmDr n s;s) eto(rpoy4aptemneilsfsDrr(rpno0olxomfciatlm emnvp u0 eeoxo ta1fpt aiei;() exmxo3iudam e fetl()a2tr(ro;t4tpx ii3iyslmDumnms u0 rtoio ia1fmtrlieslt s2uo(o3iy1ale lfvs t)artrurp;t0aee  i3tatlmDelumo t0aeenirctodopt  uvi;s0trtoim oo4altnlfvsas) Draxrpnt0oleo o3tlt s2ranmp;u0 ltoxr3oatlatraivs;t) etmxo nodale  ictl( sDra(r no1optomfctat m um( s (0aetnxf3io1lm rauvilt0teum(o oodlmte fci (fs2rr(r ot1aetnmfetasla rlu s t)alenxocoydoptraieo t sruo(m iu1aptnmncia( a2tmumono0apto o3tad a2uau pnt0 etomr3tytfptr i o t)sexm(r nydomte fvsat)aDum(rp;o1apxomiciyd sDrmumonu) exomo3oytfa  lueolt  2xm(m3no1amen ncsa( sDrm(monu4oex mfciatlaDranmp;t0tltnif iydfmt  u i t truo(mpnu4ap nlnvt (fartax ont4oeen ociyslm2uln pnt)alermrcoodoa r n o s  ruoir3iudllte nctls)aDrrxmoot0tltnmietlt s umnvont0tlxnxrciatfateli ol(0 rxrimpoudlmte fct s a2rax  no0olt  ieiydlmDua(mpnu)tltrxociadoaDr ivs;(0s2xr(r3nodomt  netls)sDrax p;o0apenifciytla rmn snt)aeeoxo ta1fm   n s;t0s2xmio ou1optelnvsl(  Dur(r ot4aee ii3tlt sDul(mo t0 lenmrctotfpDr ues s)teumimpou4ap e fvil(  Dua(m ;t1altomictltfm2uanvp u0 exomo iotoaDe i o t  eumiopiy4ll elivi ()srrmu oot0aptnioeiat s2rmnvo;t4 etrmocoadfpDr uvs ( s2xoio3nodomeemfct tfs2urumoot1tee  o3iadlsDua(vp;(0 eermf3todfp   i sls) 2xoxm iu4amte nei s) 2trx ono0aex  iciatlm2ranmp;(4alenmf ty1opt luvs t0t2uoim oy1lpt  fvslsfsrurxmpou4apt miciyt a2el(vo ()aeeoioctatom  luvi;(  rtoxrpny1lp emicia(fa2rr(rpnt4opto i3tys a emu p u)texnmr3ootfaDeanvo s) 2xm(m oo1lptelnctat aDtaxr oo4opt mfetytfaDel(vpnu) lxoio oa1omtelnvi (0texmir3nu1lpte ncsasfs2uaxrpot0tle iietyslm2uln on(0 lerif ia1latran i (  etoim3io4ole mfvsas a2tm(rpnt4teto f3iaslm2uln snt0arxrxf3oadfat aues s0s2ur(m nodlleemnvsa(f rtmum ot0opxo ieilsfs2ranvsnt)altoxf3iytfp eaivsls srtm(m3oy4ll  mnvtls a2taxrpnu0olxnmo3iyslm2ra( p;u) exrxr iadoatran s s)trtr(r nu1op nmfciltfs2uaxmont1ale  iciytfa ean sn(4trxrio iy1lpD luei;s0srurxrpnu1ap nmicsat)aruru onu1tpenmf3iltfa um( o;t0aetnircio1fm e u s (0t2urio nodopt lnctl()arra( p;t4olxomi3iatlmDulums;t4trtnxfciadlat  ueols)t2ur(mpno1ape lfeilt)arrr( p;o1oee ii3tysfm umnmpnt)alxomf oadla r ieol(0t2toir no4ape  fct s artm(mp;o4optn iciydfsDrauvo;t0aexnio3totfptrauei;s0t2xrxrpoo4omeemnci s)sDum( ooo0oeeomfctad m ra(vp;(4artrxr3oy1lmDrliei t0trxm(o oy4am  lfesa(f Drmumpno0teto fetld a ra( pnu)trermf3ty1omDeluvs;s sruoxm oodaltnlict s aDrrx  ot4olxn iciyd a ra(ms;(0trermo iodomDrln s;( teumir nydlmenmiesa( srrruro;t1teto i3iyd mDulump ()trtomr3oadlmt ln s ( sexmir iudaptn nct s  Dta( oot1tle iicilt m2elump u0areomf oy1fm   ivi (0t2uo(r3io4altemnvi ( srtmxmpnt0olx  iciadfmDuaumo;(4trerir ta1lmte nvo;t) rxo(o3iudlm  mfet t) Dtru p;t0oee ioeiaslm2elu o (0 rxrmrcoatlm  luei;s0sruoxr3oo4lptn icsasf Drr(rpoo4teeoio3ildfa rm(vo (0arxrircio1fatr uvo;s)texr(m ny4oltemivsa()s2rr(rpou1aleo ietltlsDranmsnu0tlermr oydlp   u s;t0sruo(m3nydoltn neta()s2uaxr ;t4tptomfciatlm rauvs;t)teeomr3oa1lpD lnvilt0t2xoxo nydol elneiat  Dumx  nt1teen iciltfaDranvpnt0trxoio3oa1fm   n s;(  etmio ny1lm n fet tfa2rr(ronu0tle ioetasfa2rau o;(4aetnifcto1oaDean i s teumim3ou4omtemncsatfs2ururo;t0altoifeiydlsDeanvo;u0trxriocio1fa r uvs s0srum(rpoo1amte nvia(f 2tau oou0aptomi3iydls2ranms;t)teerio oa1fateaues ( setmio3ou4openlfvilt  2trxront4aleoioeiytfaDelumsn(4 lxrxrciatlmDean o ( seto(o iydlm elfetlt)s2rmxr nu0oexnmf3tlsla2ra(vs u) eerirctodomD lnvsl( tetmiopou4amenmnvsa()arra(  no0altn f3iasfs rl(vo u0trerifcoy1lateai s;t0trtr(o3oo4amtn nviatf 2ra(roou4alx  f3iytfm2elumpn(0aleomo3iodfpDeaueils)t2to(o iy1lleelieiatfs2rr( ont4tpxoiicildlm2umnvp;(0aeerxoctadlmDe neo s0 rtoiopiy4opt  nes tfaDuaxrono1tpeoii3iydfs2rlnvs;t0trtomr oy1faD lies;t texo(o3nu4ole lfetas) rtrx  ;o0opeoif3ilt m2eln o;t)arxoif3iotlm  ln sl()t2xm(mpiu1ol   nvs tf Dur(ront4tlx mfeildfs2uln pnt0artomr3oatomDrli sls srxo(m ou1lpt mnvs sf rrrumono1opxomi3tydlsDuluvs;t4teenmf oydlm   ivs s  2xoim ny1altelfei s) 2rr(mpnt0tpt  ieiad s ra( s;u0arxnmociy1opDeau o;(0trxo(o3nu1om  lncils a2raxr nt4opx  o3iltfmDemnvs u4 renifcoydlpt au o;t s2urxr3iy4lmtemnvta( s2tr( pou0tex mi3iys aDrln s;u)tlerifctytlp e nvols) 2ur(r3oo1ole mfci t)s2tr( o;o0tltniictysls ra(mpnu) lxrif3ty1fmDeauvs ()sexrio3io4op nlietlt srumxr ou0olenmo3ilsfs um(vonu4tetoif tadfm ean o;t0 2uoiopnydomtemieia(f 2tax o;t4openii3iatfmDemn o;(0 ltrxfctydfmteln s;s sexmio3nodol elicsltfartm(m nt4tptnmo3ils a2rluvpn(4 eeoir iadla  lu sls)sexrimpoodap nlneils) rrmxront0apeomf3iatlaDrm( ont0 rerio3oy1oatraivo t0 exrxm iodopeelicil(fsrta(  oo4oltn o3iysfs2ua(vs;t)trxnif3ty1omtr ieol(0t2tr(m iu4om nlicsltfa2rmum ot1oeeomoeiltlmDrmn p t4 rxnio iatfaDeanvs;s s2uoir3iu4omtn nciat) Dua(rpou0aptomoeiatlaDum(mo;(4tlxnxocoydfpte u o t0setr(opno4altn fciltfaDtaxr nt1optnifcild s uln o;t0 renxrcoatlp rau i t0tetmir3no4ap nlivsl(fsDtaumo;t0openmo3iytlmDrlnmp t)trxrxr oytfpt aueo;t) 2xoxmpiudllt mfcs s  Dumx onu4optn fctat mDul(vp;u0 etrmr iadfpD  iei;s0t2trxo3nudlmtelnesas)aDtrumooo0tlt iicild sDean pnu0arxoifcoo1oatelnei;t0setrio oo1op elfcsa(f 2raxmpou1olx  fciaslmDulnvs ()aetoxo3io1oa r nvo;()trxmir oy1op e ict () 2ta( ooo1tlenii3iltfa2rl( s t)aetnmo iy1oa eaneo;( s2xmxo nu1lpeelnet s aDrrxmono1oex  oeildfa2ul(msn(4aetoir tydop rliei;(0s2urirpny1amtn feiltfsDtmur ou4apxn oetlsfaDul(vp u4aexrio3iydfp  anvslt)setrirpoodal emfcils  2rr(mono0tlx mfeiatfsDrmuvp t)trxoif oa1lpD an i;()teurio oy4altn nci s sDrmur oo0tptnif3iydfmDuaump;t)arxrmocoadomteli o t seumxm3oo1omen ivi s a2ur(mpno1opt iietlsfa2rau pn()areoio iytop e ueo;t0trurxr oodalen ncsas s2tau ooo4texomoeiydla ea(mont0aetrir io1oat au i t0t2uoxo ny1olt lfvsltfs2urumpnt0optoiociaslsDra(vs t)arxnxr3iatopDrlnvs s0 rtrxr3io4ome  fcsl(fsDtaxrpnu1optnmf3iysfmDuauvs () lxrxocio1lp   n il( sexmxo iydaptnlnctlsf 2umx  ;o0apxn f3iydlm uaumsn(4trtrxfctytlm e nvsl( trxmxm io1ope lfvslt  rrru  ou4alxo i3ild aDuluvsnt0treoxf tatla  luei () rto(mpiudol emnet t s2ururo;t4tetnmfeildlaDumu p u4trtrmfciytfat lu s (0seumio3nydlme mici sf Dtr(r no1tlxoiictytla rm(ms;t) etnxrcoy1fpt luei;t trumxo nydlp nmivi t)aDrmurpou1aee iieiltlaDrl( s;u) lenmf3ia1omtr ivi s0trtoxm ou1lmtnlnviat) rtauro;t4tetniietlsla ea(mpnu)aeerif oatoa   uesl(0setoim iudom  mfcs ( s2ua( ono4tpt mfeiltlsDemnmo;()aetrio oodoa elueols)texr(m3oydlpt  fvtlt aDrr(rpnt1open ieiydfmDul( s;u4 exrir ty1lpDr ivi;s0t2xoxm3iy4al   fet tfs2uaumonu1tpxnmfctytls2elnvs t4texoir3oytlaDe uvolt) rurxo3no4lltnmnes () Dtrum ot1alt  f3iys a2umu s;u0 lxnxocty1lmDraiesl()s2xmim io4lpe  ietas) Dra(ront4tltniiciad sDumu pn()teermo3oytopD  ivo;s0seumirpno4altn fci s)aDtrxro;t0teeo ocildfs2el(ms;(4texnir3totoaD aueo;(0teto(m no4amee nvils a2uaxr ;t0altoifciadls2rl(mo (4tetrifciadfpt  u o t  2uoxo io1ol nmicsat srraurp;o0aex ifetatfaDumnmp;u4 rtrxocoatfmDr n ils)t2ur(opiy1ol nmfetat artm( o;o0altnio3iaslaDul(vp ()trxnmf tatfmt lnvo s) 2xoxmpio1lme licil(fsrurx ont1olxomi3tlsfm elnvont)teenxo ootlmDean sls)sexoimpio1apenmncslt  2rmu oot0tptnmieilt mDemu p u4 ltnxo3ty1la  an i;s0s2xoio ou4openlfviasfsrrm(r ;o0open oeiyt aDel( snt0 exoxrcoytomD an sl(0 rxrxmpio1omtn fcsa(  Dtrx o;u4tpto o3iadlm2ua(von(4tlenxr iydopDe nvslt0sexoxo ny1ap elict tfaDuaumpot4teenmieiatfmDua(vpnu0aeeoifciatopt  ieo;(0t2trxr3iudam n feils aDurumo;u0aetn f3ils mDrmnvon(4 eeomfciadlpDe u ol( sexo(o iy4op   nvtl(fsDtau  ;o0tlxnmfciysfa2elumpn()teerxf3oa1optr u s;t0 rxoio3io4lltn nes tfsDra(rp;t0alto i3tld a umnvs (4tetnio iydfm  liei ( trurimpnydalt  fvsat)a2raur nu1aptniietlslsDrlumo;(0texnmf io1opt aivi;s)t2triopiudam nlncils)a2tmxrooo4oex  octytlmDrlnvs;(0artoir ta1oat li i () rurxm3no1llen ietls sDua(m no4tlxnmietys mDranvpn()areoifctydlptraneo ( s2uo(m3iydomtnlivtat)arur(mo;o0alt iieiasla2raump;() ltnircta1fpDean o;t)s2xmxo3oo1apenmnet s)arra(r nu4tpe  o3iytla eluvont)aeeoir tydlpD  nvslt setrim iu1amtnlnvtl(f Drmurp;u0oltomi3iydfa2ul(mpnu4 ltniocia1la   ivs t) rtoimpiudlpenmnvta(fs2um(mpoo4tltnif3ild m eluvs;u)aetomfcia1lmtr ueo;t t2umxo3nydal elncs t) rurxmp;t4apx  feiysfaDrm(mp (4 rxrxfctatlmt anes;(0 2xrxr oodlle  fviatfa2rrxr ou4oetoioetys sDrmnvon() lxrif3oatomtraueo t trurio3oydamtn nei () rtmxm oo0tlx  i3iasfmDranvpnu) rtrxf iadlmDelueo t trxmir nudomee ietas)sruaxrpou4opxnii3ildls2elnmo;(0aleoiociatfp elueolt0setoxmpoodapt lnes sfaDur( poo1opt moetas aDel(vs (4teenmf3ta1lmtrlieo ( t2umxr nu4opee fvt (  2umumpoo4tlx mieiysfsDra( s;t4alxomr3iydlat aueols0setrim no4lm elfeils)srur( pot1aetomiciasfmDran ont0aetnxo oadlaDr uesls)srxo(o3no4ap   ics t  2umxmo;u1aetoifciatls rmnvsnt4alxnmr3iotomt lu i;()texmxm iy1lmeemfeias aDraumono0texnmo3iaslm umnms t0 reoxo3iy1oat aivslt)truoxmpno1ape mneias sDtaumono4tleo fciysfaDea( sn(0 renxoctodopDeaueo;t)sexriopoydopenmfesatfs2tru ont0apeo f3iadlm rluvpnt4 rtrxrcio1faDeauvi;s0t2urxo3io1om n ietl(fsDumum ;u0aeeoio3ildlm2rauvs;(0aeeoxocootopDe uei;s)setmio ou1ap n ncias) rtr(ro;t0oet mf3iaslm eluvs t0 rxrio3iydoaDeai o;t t2tmirpiodole lfesas sDum(mo;o1aeen ieils aDrluvp;t)trxrxrciy1fptrlu s t)trum(r oy4apt mivtatfsrtax oot0tltn fciasfm2ra(mo t0 rerirctodlaDean o s  exrim3iu1omtnlivsls) 2umxm oo1tlen o3iyd s rau p (0altnioctydfatraivs s texoxo3nu4al nlnvilt  2rr( ont0oltoii3tasfa2el(msn(4arxrifcoa1fmD li s;t teurxm3iy4lp emfei (f 2ra(mo;t4apxoioetldfm2ulu o;()trermr3io1faDe u s s0sexmxr iu4amtemnvi t  2urxr no1aetnmiciatla2elnmont) rtnmocoydop r i s t)srtmio nu1lpt mnct (faDrauroou0oetnmoeiatfs2rmnvp;t0tetnif3iytfmD ai il(  2xmir3nodolenmnvs t  2uaxmo;o1opxn oeilt s2rln s t)alenmrciytoatr iei;t tetoxmpiu4omtelictlt  rur(rpno1tpx  fctas mDrl(vsnu4trxoif iadfpt auvo;(0trtrir3nu4aleemfcs s srua(mpot4tpxo f3iyt a2eaump u) rxnxr oadlmD an ilt  2xmio nu1al elies () rtru  ;u4alxoifcilt s2rau o (4aeenio tytlmD  nvs;t0trumim nydll n nci s)sDuauroou1tpx mfeilt aDemn pn()alenif3iatoateaies ( texoim3iy4alt mieils)a2urx pnt0tle  oeiat a2eau p;(4artoif tytoptraiei;t)seur(mpny1op  lncslt s2uaxmooo4aetn ieilsfsDelumsn() rtrir3iodfmtelnes;t  eurxrpio1ol n fcia(f 2ur( o;t1aptomoeiysfmDumu o;u)aleoxf3iotfmt luvi (  exmirpou4al elfcilt  2rm(mo;u0oeenioeiltls2uluvpnu0teermr3ia1fpD  nvs s texoxr3oy4opt lietat)s2ur(  ot1ape mo3ils mDul( s;t4trxoxr3tadoaDeaieo;s0srurxm iy1ll n nct ()a2tm(  nu4tlen octlt m ulumo () eermocoo1lm rln o;t trxr(opno4op  lnei t) 2raurpoo0oee  feiltfaDrl(ms;t4aetoxocta1op raivols0s2xoim3ou4amtemfvi sf 2taurp;t1opx ifciytlaDelnmp;() lenxociydlmD ai ilt)srtrxr3iy1omte fvsas sDum(moou0tleomfeiyd aDranvp;u4 rtnircoytoaDe nvo t) ruoxr iy4alenlici (fa2um(r nt0olen fciaslsDrlumsnu4tlxoxr tatlmtrlnvs;s0t2urio nodamt mfeil( aDtrurp;o0oleomi3iat aDemu sn(4arxomo3todfp   i ils0 2toimpnu1amtemnvsas)aDrrx ont4alxo oeilt m2uln o (4trenxr tatlpt  n s t  rumxr3iodamt  nctls) rurx ont1altnif3iad aDraump;()tetomr3totlmDe nvi s0 2uo(m3iy4alenmfciat arraumpot4oltniictydfs2eanms;u0tlxnif3ootla e n s;( srtm(o3oo4llt  fvia()arra(rono4ole  o3ildfmDrmn s;() lenmo ty1late i ol( sexrxmpou1ole mfcslsfarrrx  ;o4altoiocilsfa elump;u0 eeoxr3iydfa  aivils)seumimpoudolenmfvtlt)aDrm( ont4aee  ictys s2elnms t)artrmocoydlpDe ivi;(  2xrio nu4ll e nvtatfartm(mp;o4apto f3tlt a2rl( p ()aetomrciatfpDrau slt0sexrxo3ny4lle  ieilsfa2rr( ooo4tpto feilsfm2rluvp t0 ltrxo3ia1fp  aivslt)teuoxm nodam nlicilt  Dtmxmpnt0opxomi3iatlm2rlnmo;t4 rtoir3to1lm eli slt trxoxr io1optnmncslt) Dtr(ro;u1tex  iciysfm rluvp;u)altrir3oo1fmD au ol(0teur(rpny4opeemncia()artmxmpnt1aet mf3iytls em( sn(4arxoioctytlaDe i i;s)trxm(mpio1oltnmfct t)a2trx p;t0open octysfs2eluvp;t4trtoxoctydfaD  ues s) rtm(m3ny4op  lici (  2urxmpot1tptomoeiydfsDelnvo u4teerxr3oy1omD auvolt)tetrxmpiydlptemivi s s2umurpoo1ape  i3ildla2ean p u0teenif io1omDean olt seum(o3iy4lptnlnctatf Duax onu1oex mietltfa2ulnvo t0 ltnmr ootlm   uvsl(  eto(opnu1omeemfctlt  Dta(ronu1olxoiociyt sDrmn p t)teenmf iotfmtrau ol()t2umxo iy1ol nmncia( arumxmpnt0alt  fetysfm2ea(vpn()artrmr3tadfaDe n sls t2umio nu1openlfvsls s2rr(r no1olt mf3tad aDranmpn()aexomrcoa1omt  iei t0trto(m3oo4oltnlietl(fa2rr(rp;u4tet iocild a ea(monu4 eerioctytomte uvo;(0setoxo3oudol   fcslt)artrxrooo1openmf3ildfaDumnvp;() etoxfctatlm elieo;s) 2umim3ny4omen nvs t)aDraumoou1tleomoeiasfaDumums u4 exrxr3iy1fp   uvs;t) ruoir3io4om nlnei s srum(mono1apt  ictat a2eln s ()artrxocio1fm eauvs s0trxmirpnu1amt mnvs ()sDra(mo;o1oeeo oeilt s rmu o u4aetrio oydoa eauesl(  2urxmpio1op e fvsasfaDtrum ;u0teeoif3tyd a ranvs;(0 rtnmociatlmt  u il(0t2urirpio1aleemfviltfsDraumo;t0tetnmieiydlaDua(vo;t0trenircoytomDr i o;t0s2xm(o iy4omee fei t)arumxm nu4oltnifciadlm2rln s t0tltrif oo1fp e uvo t tetrxm io1lltnlnvta(fa2urxrpot1aptniieiytfm eauvs (0trtomf3oadfpDe uvols sruoim3iy1lleemnvil( sDuau  nu0oltoio3iysfs2rmn s t4 eermo3iotfpDr n i;t)tetm(rpoudamtnmfctasf 2tau  no1optn f3tydfs2el( o;()areomrcoa1lptr ivi;(0 2toio3iodome licilt  Drrxro;t4opx  fcilsfa uln pn()aexnxf3oodoa raneil()s2umxmpoydolte neias)srrmu  ou0texoifeiyd a2ea(vs;t)altoxocto1om eaueo s0srxm(r iydlmt mivil() Dtrx p;u4alt miciltfa ua( p t4 rtnmo ootlpte ies s truoxopnydlme mnetlt arumxmooo4aetnifeiys sDrlnvsnu)aeeoxo3iodomDraneo;( texm(m iy1aptn fvtas s2rrurp;o0apx mfciytls2eau p;t)tetnir3iodlp  aneilt0 etrxm nu1lleelici tfsrur( poo4tleomi3iytla2umn o u0tlxomo tydfm  liei t trxrir3oo1ol n ietat  2ua(m ;t4apxn i3tatfmDra(vs t4aexnxf iodomtelnvsl(0 2xoio oo1lmtnmivils)srum( ooo1tlxoii3ilt a2em( p;(4 rxomo3tadoaD aueils t2trxr ny1lm elfvtl()s2rr(r ot0aptnmf3ils s2rl(mp;u4arxrio oy1oa   nei;s) etmxr3oy1oltn fcsa(fartm(m ou1opxn ietldlsDrmn p t)trerxrciydlmtranvi (  2xo(o3oydlltn fvta(fsrraurp;o4tet  iciyd aDumnvsnu4 exoifctotfpDrlnvsls)sruoir3iodom   ncsa(f 2tru  ou4apx  oeiydfs2uluvp;() lxoxrcto1fpDr uvi;s) 2urimpiy1lm nlnes () 2tmx p;t4olt iieiys a2rlu pn()tlerxo3tatoptrauvo;( teum(r3oo1am e nviat arrm(rp;o4aptnmi3tasla ea(vpnt)trxnmocoytlp rln i (0srto(mpoudop n ietlt)sDurxrono1tpt mf3iadfmDea( p u4 etomr oa1oat  nvo;()seumirpoydlp e neslsf Dta(ro;u1apt mo3iytfm2elu s u4tlxoirctytfm  an ol(0t2xr(m3oodlleelnvsat)a2ra( p;o0oltomocias sDulu s;() lxrif3oydopDe ieol( s2um(mpoodaptn fvslt aDua( p;o0ape iiciadfm2elump;(4trtomf tytopt anei s0 2xr(o3oo4llee fciat sDtmxmo;t1texo fcildls rmu p (4tetoxfctydfpte neil(  rumiopnu4alenmnctat)sDtru pnt1tlxo f3iyd a eaump (4 eerio3tytlm r n i;s)sruoxo3nydlmee fes (f 2uaxmp;u0aetomociaslsDrlumpnu) rtomocoadop   i o s  2tmiopiydap nlfeil()srrmum nt0aptnmf3iaslmDeaums;(0 ltrxrciodlp  auvo;()s2xr(o io1lmenmfvias)s2trumpou1tltnmoctatlaDuauvo;t0arerif3ta1om r ivs ( t2umimpny4amtemfvtatfsrrmur nu0texomfetyt s eanms;()aeenif iodfm eaneo;t setr(r oydol n fvtl()aDtaxm no0olx iictltla2umumo (0 rtoxfciydomtraieolt  eumim ou1lmenmfvil(  2rm(r ;o1alt mfciyt m el(mo;u4aexrxociadlatranei t trtoxm nudll   nvsat  rrr( pnu1oltomoctaslsDrm( s;() renxo iotla raivi s  2tm(o3oodlmen ietas  2uaxr ;t4opxnmfcilslm2rm(vs;(0altnifctotlaDr nes s)srxrim3nu4alt  fcslt)a2taxmp;o1oltomfciatfaDel(von(0 etoxf oo1oatrlneols t2toimpny1am elfctls) rua(ro;u1oeto oeiysfmDulu s u)trenxf tydlp e ueolt0 rxoim3no1lmenmneia(  rum(  nu1altomoctldlm el(vs;t)tlxomf3oodop  lnvol(0srxriopno1aptelnetlt) 2rau o;o4apenmfciydls rauvp;()teeoxf3oa1oaDr i s;s)seum(m iy4omtnlnvta()a2uru  ;o4apx iicildfaDrau s (0tlxnxrcto1fmD lu s;s s2xr(opou1altemnetlt)aDtru pnu1aet  o3iysfa umnvon() rtnif oa1omtrauvol( trxoirpnu4lmtelnctlsfsDtm(m ;t1alxoiieiysfmDrlnmp;u4aexrmr3iotfp r ieo;t0teurxm3oo4ome  ncsatfarrmum oo0tpxnmfciad s em(vs;(4tleomf iytoatr n s;t0 etmiopnydamtnlfvi ()sruru poo0opxnifcias a2ulump (4alenir iydoa elnvil(0t2uo(m iodame livia()arumurooo1opt mietasfmDrlumo t0 eeoiocio1op e uvi ()t2xr(r ny4llee ieta()arta(  ;u0tlxnii3ilsla2ranvon(0trxnmo oodfm   ivi ( setm(rpou4op   ncsls)s2uaumo;o1oeenifctatlsDrl(mp;() reoioctadopte nvo s srxr(o no1ll   nvtasfartax ooo0ope ifeiysfs2em(ms;u0alenxo3oodlmDran o;s0 rtmim io1ll e ncs (fsDum(  oo0altoif3ilt a2ul( s u)aeeoxrcty1lptelueo s0texm(o3oo1ap n nci t)sDum(rono1opxoii3ildfsDeanvo;t)aetnmf todfmtrauvol(0truoxm3oodop emnei s)artmur nt0aleoiiciytla uan snt) rerxr3ty1fmtr ues (0 eum(r3oydllt  nvtatf rrrum oo1tle  oeils s2emumont0 rxoxr iatfp rlivo s0t2trxr3ou4am elivils)s2ur(mp;o1tpx mf3ildfm2rlnvpnt)trtoxr3oa1op r uvo;()s2xr(opny4ap emnesat)srumxmoou1ale ifciysfmDrl( pnt0artomf ta1opt au ilt0 2xrxm oy1lpte ivsatfa2raum ou4opto fcilt a umnms t0 leomf ty1op  anvi;t0teto(o3iydoptemivilsfsDta(r ou4apto ociytlmDranvp u0 renmfciydfat  i ol( t2umiopiudlm nmncilt  2rrxro;o1alxniiciatfm2ulnvsnu0aexriocoydomD  ivi (0 2urxm3iu1lmtn fei t)sDraxrpno1aeto oeiatfa ulnms;u)alenmo3tadla  anvo;() 2xr(o3ou1om emivtl()sDur( pnu4tptn i3iysfs2rm( s u0 lxrmoctotlpD anvols) 2uoiopiu4oltemfvsl(f rtrx  ;t4opt  ieilsfs ul(vpnt)tlerif3oydlpDe nvol()srumimpoy1ame licsls) Dur( ono4teenmi3tytlsDra(ms;u0texnxfctatopt  uei t  2xr(opou1aptnlici t  rra(r nu1aexomictlslmDra( onu)artrmfcoadlatraies t  rurxopoodlp  mfei t) Drmu onu4aet ifciatfmDrm(ms u) rtrmociadfpDrli i ()t2umxm3iu1ome lfvsatfsDtru  ot0aet mieiydla rmu o u) rtomrciytlaDrlneilt srxr(m oo4amtnmieils)s2raumpou4alx  f3ilt s2umnvp t0artoxr3tadoaDrlivolt)s2tmxo3ou4op nmivi t)sDtr(  ou0tpt  fetadlsDranvsnu)trxomf io1lm r ueols t2xmxr nudllt lfvsl(fa2uaum ou0apx  fciad a2rlnmo t4teenmfcta1oa r i il()s2xrirpno4apee fei t)s2rm(ront4alto ietatfa ul(vpnt4trenio tytoa eli ils t2uoxrpnudape  fcs tfsDrmump;u0opxn o3tas mDea( snt)texrxfcoy1lmte u o (0s2xmim io4alte iesltf Dum( o;u0tlxo fcias mDraums (4tltnmf3iadlm r n sl(0 2to(r3ny4omtemnvias  2umxronu0aptnmf3iytfaDean o () rtoiocoo1oateaieil()srxoim ou4aptelfvslsf rrmum no1apxnioctadlaDean p;(4trtrmrciydfat aies t0srurim nydll elnciat) rumum ;t4tltoif3tys aDuan pnt) lxrio oytoatelueilt)trxmxo3ou4lmen fei ()s2trxmpnu1alenmietadfa2emumo (4teermrcootopD  nvs t0sexrxm3nydamte ivta(f 2trx p;t0tpxnmieiyd m2uau s t4artrmr3oodoat aues s)srtrxo nu1omenmnci s) Dtaxr ;o0aet ioetasla2rmnmo t0trxomfciy1faDean s;s  ruoxm iodaltelfcsa( arua(mpnt1oetn ieiatfm eanmo u4alxrmociodfm rlivsls0srtm(mpiodlp  lncsasf Durum ot1aptn ieilslm2rau p ()tlerif tydlmDrluvil(  exrio ny4lme mietlt) rur(r nu0ale io3ilsfsDulnmonu)alxnmfctatomDrlieo t  2xoio oo4al nlnvsl( a2ur(ront1tle  oetldfs emn s;u4areomr oadfm elueo;(0 exoimpoo4ol emivi (fs2ta(mpnu1tetn feiatfa2rm(msnt0 rtnxo ty1la ean sls seuo(m3iy4ap  mfes s)sDumur ;o1tptomf3iasfs2rau o;(0 etoxr to1fp elivs s0tetmxr no4lmeemict (fartax pnu0tpt ifeild aDeanvsnt) lenmrciatoa  lueol() 2umim3ny1lpee icsas aDra(rp;o0tlt mo3iadls2uanvo;u)tlxrio3tatlaDe i s;s) 2uo(mpny4apt  fcias)a2ur(  ;o0oex ifcilslsDrmuvs;(0 rxoif tydomD ln sls0t2umxo ny4ll emfcs (f rrr( p;u4teeoiieiydfs2ulnvont)arxrxo tydfm  lnvo t texr(rpiudlmeelnvs sf 2ta(mo;u4tltn feiyt aDuanvpnt4 lxoxr totfaDrlnvi;t0teto(m3io4lmt  fvsls  rrrxrp;u4aetnioctltfa rm( o;u)trtnir3to1omD luvslt)t2toxm ny1op n ncs t)sDrm(mooo4tpe  iciydfaDemumo (0 rermo iatfmte n i s sexmxm oydolt licsa(  rraxr nt4alxnifctyt a2rm(vp;(0treoif3to1latelueil(0sexr(r no1op  lfeslt arta(moou4opto fcilslaDemn s;(0trtrxo iytom e u o t0teur(o oy1am n nct t s2um(ront0tlxnmictld m2emnvs;t) rxomrciytfm  livo;t) 2urxopnydom elfvs s srtaxr ou0texn icild mDumnvo u4tetnifcoy1omtrai o s seto(opiu1ole mfvia()arrau ooo0tpxniietltfs umn o t4trxomo oatop elueil(0sruoir3io1op elicias srra(root0olxomi3iad a2rlnmo;(0 etomfcty1lm   i s ()t2tm(o iy1lme  fcia(faDumxro;u1tee  ociad a ua(mp;(0aexrxrcoadlmt  n ils) rtmir iy4amtnmfetlt  rta(mono4texnmoetyt mDean o;t)aexrmo3ta1fmDelu sl(0seurio oy4llt mivsa()s2rm(r ;t0alto f3tls mDrlu snt)aeenxrcio1laDeln o;t)texrxo3oo4lmee fct t srtax p;t0alxomo3iyd s em(mpn(4 eermf3ia1oaDe u i s0texr(mpiodll nmivt t)sDta(mo;u1altn o3iltfm2rlnvonu)tltoif3iy1op eaieol( texrxrpiodllen fvt s sDtmurpoo4apto fciytls eau o u4alxoxrctadlaD  n o;s trtoxm3oo1omt  ies ()a2tmxm ou4aexnmo3iatfm2uaums u4tlenmrcoadfmD au s;s0t2uoxr3oo4altn ivtas  Draxrp;t1alxn ociatla2el(mpnt)trerir oa1fp ranvol(0trum(o nodap emnes s  rtmxrpoo4aeeo ietytfmDuauvo;t4texnio iotfa  au sls  rtmim nudlle mieiatfaDrax p;t4alxn i3iytlaDuau s;()trxnmo3tytlptr ieo (  etr(m nu1optemfcsa(f Dtm(monu1olt iieias m2ra(vpnt)arerxfctydopDe nvil( srtrxm3oo4omtnmfvtls a2ua(mo;u0alx ii3iyt a ul( p;u)aetrxr3oo1opt  i i s)srurim nudom emfet (faDurx oot1tex moetytfmDrm(vo u4 lenio3oydoatelnvolt  2toxr3no4amen neslsfs2ur( o;o0tex  i3tytlm2umuvo;(0texnxo ootfatrauei t0s2xrxmpnudlp elfvsas  Drm(rpnt0oeenmociydfm2ulnmp (0 eermrcty1oaD  uei;( t2xrirpoydalt lnvs tf Drmumono0olx  f3iyt a ulnmp t)aexnmo3oydfa eaues s  rxr(opiu4opte ict tfsrtrurpoo4tet  f3iysfsDulu s;t0arxrif3todlptelueo t srxmir ny4lptelfetlt  Dra(moot1aptnmf3ildfa ranvonu0trxnif ootlp elnvs s0 eto(o3io4oleemici t) 2rr(rooo1oex  feilsfmDrm( s;t4aexnxoctydlmtraieo;t)s2uo(o nudolt liet ()s2taxmp;o1olxnifcildfs ua(msnt4aexnxrcty1fpDe ivi (0s2xr(m oodll  lfeias  Dtaxm nt0oltomfeiadls2ranms ()trerxo tadfmt liei;( trxo(o3iy1ape mict s a2tr(rp;t1olx  feiltfm2uau p;u) etnmo oa1lmt lu s;t)trtm(opny4lm nlict t a2taur nt0tptnmi3tysfaDemnvsn(0 lenxrctydomDe neo;(0srtrim3iydoptnlfet t a2ra(ro;o1opeomieiadfa rau s u0altomfcta1lmD aivs s0 euo(o3ou1alt lfetatfsrurxmo;o0tpe io3iytfmDuluvpnu4treoir iadlmDeanvi;t t2uoxmpnu1ape mfct s artaxr no4tpe  oetyd m2el(ms (4tltriocoydlmteluvols)s2xoir iu1ap  liesas  rumxro;o4tpt miciadfmDuauvp t) rxoxrciotfm r ues t)srtm(opoy1ll  mivias sDrrx ont0altoiicias mDem(ms;t0 ltomo3oa1fp e uvi;() rxmirpno1omee icsltf 2tm(mpnu4alt ioeiyd m2elu s (4tetomr oy1om  aivs (0t2trim3nodaltnlnetlt)srtm(mpot4ope  feiaslm2emuvo t4arermo oy1oaDe ies t trxmimpiu4ope  fciat s2truro;u0tltomfeilslm2uanvo;t0treoir3to1fatranvsl(  rxm(r ou1llte iviat artmur ou0oeeoiictas aDumn pnt4tltrifcoy1om r n sls)tetrimpoudoleemieia()artrxmo;u1tptniictytfs umu o;() eeoifctydlpt ai o (0 2toxm nudlme mfesas) Drru  ;u4aex mociadlmDemu on() rxrxrciatopt  uvil(0trxoir3iodop elictasfs2uaxmooo1tet ii3iys a2eln o ()aetrxf oatlptrai i;(0 ruo(opiudapt  nvils srtmxr nt1optnioeilslsDuanvo u0teeoifcta1oa  luvo ( truoirpou1llen ieiatf Dtru o;t4aeenioctad aDeluvs ()tlxoxf ia1lpD  u il(0teurxr nu1apeelncsl( aDua( o;u0altnmiciadlsDraump;u) eenmr to1opDelieilt) 2tr(rpiy1ol e iesatfarum(rp;t4olenmfeilsla um(vo;()tltnio3iadfm r nei;t0 2tmxm3oudll n fcil()aDum( pou4opxnifeiltfm em(vs t0 exoxo3oy1fmDr n sl()teuoim oodamt mncilt aDrrx p;t0tlenmoctytls rmn onu) rxrio oa1optran o s s2trio3nudom  lfvs (f Dra(r ou1tlenif3ilt aDeanmo u)tltoiocto1lat lu olt0s2trxopno1lltnlfesat)sDuru o;u4apxoii3ildfa2ea(vs ()tleriocoydfmteai ols)trxoiopiu1ameemieia( s2tmx pnt4olxomfeiadlsDem(mpnt)treoxf3ia1opt livsl()srxr(o3ny1ame miet s)aDumxmp;t4tpt mf3ilslsDum( s t4trenxfcoo1latr nei ()seurxmpny4ameemnvtl( sruax ont0tee iieiasfm rlu p;(0altnmr iatfaD aivi;s)seuoim3oydoleelnctls artrurooo0aptomfetls m ul(msn(4 eerif3iydfp r n s;s seum(r3nodalte nvt t)srrm(mo;u1tleoio3tlt a2umnvonu) etnmo3iotlmt lues;() eumir iu1ap e fvs s s2uru o;t4tpt  feiyd a2rln onu4texoircoo1fm   ivi;(0trxm(rpiy1al emieiasfa2tmuronu1tex  fctas m rau pnt0 exoxo iadlpD auvo;t)trxm(opiy1om nliet s aruaxroou4tpeomictytlm rlums;() lxrxo ootfaDeaueilt0t2umimpoy4ap n icia(  Duax p;t1oeeo iciydfm ea( o ()arerxocoy1laD  iei (0texm(r3nodol n fctasfaDtm(moou4oet iictatlaDel(vp u)tleniocoatoa eaneo () rxrio3nu4olee fcsa( s2tm(  no1aeenifctyslsDea( snt)tlxomrctytlm elies;s)srtrxm3oo4omenlnvsls  Drmu o;o4olt  octydlm ua(vp (0aeenir3ty1oatr ues;( s2xr(m ou1lp   fci t) Drrumpot0tpen oeiysla uanvsn(4trerif3ty1op eliei ( sexm(rpio4lpen fesl()aDumu  ot4alt ifciaslm2rl(ms u)treoiocoytom   nvol(0t2tr(r iydolen neta()s2rr(rpnt0opx  ociatlm2ea(mpnt) leoir oo1faD au i;s0sexmxopiudomt lfcs s s2tmur ;o4tptoii3ildfa rlu snt)trxomrciydlat  nvo;s  rumxm oydapte iesa(faDta(ro;o1tlx  fciltfa uluvo;u4aeenxr tydlmDeauvi;s  exrir oydlptemieiat artmxmp;o0aeenmfeiysls emn p u0altnxf oy1la r nvol(  exo(m nodalt  nvtas) 2rr( ooo0alen fcias mDrau snt)tlxomrcto1om r nvolt0trxmiopnodlp  lfetat) rra(rono4teeomi3ilt a2rl( o u0trerxr3tytomD li i t) 2xmxopno1lle mncslt srtaurpnu1aet ii3tat s2umnvonu)tltriociodlpD an i () exr(m iudale  fcsa()arumx o;t1opeoifciatls2emu p;(0tlxoir3oydfp  luvsls0t2tr(o iydlp emnvils srta(r ;o1aptomoctas a2elnvont4arxomf ta1fatrln ol(0srum(r3oy4lp nlnvi sfa2raur ou1tlxo o3iad sDrmnvon() etoxf tatfatr uvs s)t2tm(m oy1apteliesl() rtmxroot0tltnif3tls m elnvp (4tleomf3oadlp rliei;s)s2xoxo3no1al elnesl(fsrrmx  nu4opt iociys s ulnvp;t4 exrif oatoa  auvs ()setoir iydolt mivta( s2rrurp;u4aptnmfetytfsDulnmon(0treomr ty1laDrluvo s  rxoir io4lm  mietl()aDtax ont4oexomo3tlt a2rluvpnt0tltrmf3ootlm  li o (  etmxmpoy1aleelnvsas) rrrxmp;o0tee ifciytfmDemu s;()areniociotlp  an s;( s2tr(m oy1alt lfei tfsrrmxmpno4apen oetldfmDumnvo;u0 etoxrciytop   n o t0s2xr(mpiu4apte ictlt srta(mo;u1tle mieilt aDel(vs;() rtomf iydfm raueo;( s2xmirpoodam  lncil()srtmxmooo4tlen octas aDeluvp t0arerir oatlptr neo;s)truo(rpny1lptn neta(fsDum(mpot0oltoiietaslmDum(vs ()treoir ta1oate uvol()srtoxrpnu4opeemfvi (f 2umx p;t1oet  fcildfs2rmuvpn(0aetoirctodfm ranes s0tetmxm nydolen icsasfarrm(mp;u1apxnifciydls uau ont4aetnio tatfa   i i ( t2uoio oo1lptnlfcs s)sDrrxmpnt4oetnmfctltfa2ua(mp;(4tlxrirciytfptrlneol(0t2urxo3oo1lmenmnct s sDtrxrpnu1aex mi3ilsfs umu o;t0aetrmoctytoaD anei t)teto(rpio1op n nciat)sDuaxronu1olenmi3iat sDrlu o (4 eerif3tydlmDranvols)t2trxo iu1ll nlnctat)srurx  oo1oexn i3ias m raumo u4 eermr iadopt aneol() 2ur(o iudapte ncilt  Dtaxm nu4apeoiieiyt a rau p t4 exnio todoptr iesls0 eurim3ou4ll n nvils sDurx p;o4tee  iciydfa rlnmo (4 leoircia1omDe n s;t0texmim oodlm emivt tfs2rr( ont1aetoif3iydfm2umump u)teermocoytfmteauvs;(0 ruo(r3iu4lptemneias)srur( pot1aee mictat mDrln pnu) leoir tadlmt  n s;s trtr(opnodome lnvt sfa2umu pot1tltn f3tadlm em( o t4artrxocoadla rlueo;(0 rtr(rpiudope livtat)sDtrum ;u4tetnmictld m ra( snu0tetoxrcia1fpteai o ( srtoxopiydamtelfvslt)aDrmur ;o1alx mfctatfsDeaump (4aexrmf oy1fm rluvsls0 2toxo3io1openlfcs ()aDurxro;o4tpe mieilsfa ea( snt4trxomr3iydfptean s;t0 2tr(o nu1lm  lfct t  Duru pnt0alt iociadla ra( o t4tlerxo3iytlaDeli ils)trtm(o3no1altelietl(fs2tmu pnu0tlt moctyt s2um(mp;(0 eeoir3io1op  li ilt)sruoimpnu4lpenmfvs s  2tmur ;o4tlxomieiasla eanvp;t0tlerioctotfm raneo;()teur(rpnu4omt mncilt  Dra(  ;u1tex ifciltlm2eanmo u)altoif ty1lmt luvi;t0trxo(o3iudamtelfcil(fa2rrxroot0aet  iciatfs eanvo t4 lerxr3ootlpteln s s0trxmiopio1olte icslt aDurxronu1tpxniicildfm rl(vo (0aleomr3oydoatelnei;() 2uoxrpnodoleemics tfaDum(m no1tee io3tadlaDranmpnu0 rtrir to1oa  aues;t0 2xrimpou4aptn fei (farumxrpnu4tpen ieiyd m el( s (0 eenxoctadopDran ilt0srxoim3no1omt mics ( sDtrxmp;o1oexn i3iltlm ulnmpnu4 renmfcia1lm   nes;()setrio oydomtn fcils)sDuaxm nt1tlx iieiyd m2ua(vs (4arenxfciotfaDeanvo;(0srxrxm iu1lpte neil(fa2ua( pot0tltnii3tatfs ra(mont4trxrmf3oo1lpDe nvi;(0 exm(rpiy4ape liciltf Dta(rpot1apeomfciys m rluvo;u) rxoxf ia1la  ai ils) eumim ou4amtn nesltf Dum(mo;o1texo i3iysla2elumo t) etnir ty1oatelieils0 2xrxr3nu1optemfeslt aDta( ono4teenmf3iltla elnmp (4 lxnmr3ty1faDeau ol(0t2toxr iu4lpe licia()aDtaxmoou1teenioetlt a2el(vont0 eeomf3tadopDeln o;(0 exm(o3iodlpee nvtl(  Drax  no4opt  octydfm eanmpnt0aeenmf3oytom rauei;t0 etmxr oodlltnliei sf Drr(mp;u0tltoiiciysfa ea(vo;t)aexoxf3iotoa e ueo;t  rur(opiydap emictlt)sDtrurpnt1tet  oetydfaDum(msn(4aexnmo to1lmtrlueo;s) rum(r3io4om e icta() rum(m nt1aeeoif3iad s2rmnmo t)trxrio3ta1laD aivolt0t2xmxo3iydlptnmfes t s2rmu ont0apxo f3tltfm2rlnmsn(4aetoxrcoytoatr nes () ruo(rpnudlp e nesat) Dtm(r ;t4tpe ioetltla ra(vp (0teermfcoa1lat  nvi s)srxr(r ou1optn icsatf 2taxmooo0tpeomiciad m2rlnmsnt)aexomo3iytlmt an o s0teuoimpoy4altn iesas) 2umxroot1apenmi3iys a eluvp (4aetoxf3ia1fpD luei;t0setoxo oo1am nmnvs s  Dumumoot1tlxnmicils a ua(mon()trtoxr3ia1la elnvs t0 rtriopoudomt lnvt ()a2uru oot1alenmfeiltfa rl(vs;t)areomr3iodlm  auvo;(0srxoxo3ou1am nmnvi (  Dur(rpno4tetoiieils m ulu o t)aetoio ia1om rluvo (0t2xmxopiu1omenmies tfa2umx  ;o0altn fctysfmDrmnmsnt0 rxrmrctodfpDelu s;()t2tmxm iodlm nlncs s  2um( pnu1tlenioeils m ulnmpnt4 exomociatomDelnvi s0trxrxmpio4am elies sf 2ta(mpnt1optnioeiadfmDrlu sn()tetnxr oatop r uvilt t2tmiopoo1alt lics (f rrrum ou1opeo f3tydls2eauvo (4tleoir to1op  aivo s t2tr(m oo4apeelivslt aDtm(m ;t1tpen ociadfm em(ms;u4teerxo3iadlmDrauvsl(0 etmim ny1lmte ncils s2ur( pno1teeomfciysfmDumumo;u)texrxocia1la  aivi;s s2umxmpiodopt  icsatfarraxmpoo1apeomf3iatfmDrlumo (0trxnifctadfptran s s) rumiopoydlmtelfcta() Dtrxmoou0optomf3tltla raumsn(0 lerxrctytlaDeau il( teurxm ny1ole livt sf 2rmumooo0tpen ociadfsDrluvs;t0tltnir tatfm eanvil(0s2uo(rpoy4am   nvi (  rtaur ou0apxnifetyslm em(vs u0trermr3totoateauvsl( teuoxr iu1opeelfvsas) rraxm ;u1apx ifeiatls2em( o;u)aetrxocio1lm  auvs;()trxmxm no4lm   feta(  rraxro;t0teeomfeildla2ranvonu0tlxrxr3tydomtran ils)seuo(r oudopenmfvs () Dua(mpno4oetoii3ildla2elump;t0alxrir3io1fatelueols sexrirpoo1op  lictatfa2ur( ooo4opx  i3ildfm2umu on(4 leomf oodlmteau s (0srtoxo3iodopenmnvtlt)s2rmx  no0tpeo fetlsfs2rmnmont) reomfciy1laDe nvo s0t2xrxm3ny1am   fvslt)srurur ;t4tltomieiyt a2uln ont4tetnmfctytopteauei;t) ruoim iy4ll nlncta(  Dumxmpnu0tleo feildfm2umnvpnt0texnxfcoy1opDe ieo;s0t2ur(r nudapt mnetas) Draumo;u1olto fctyt s elnvs;u4texnmo3oo1omtranvo s  rum(o no4lp  lnesas arurxrpot1tetn f3ilt s2rm(mo (4altomo ia1fmt aneo;t)truoim3ny4amtnmnvias)sDrrx pou0teeoio3iyd aDulnmo u)artrmocia1fm eaneo;( trtr(opiu4ol elietls  2tr(  no0olxo octyd mDrlnvo;t0alxrmfcoadomDrluvo (0s2ur(r oo1amenlnvtat)sDtmumonu4teenifcilslmDra( p t0trxoxf3ta1laDr ies s0s2xmiopnudoptn ictat a2ta( pno4ole mo3tlslsDea(ms u0aleoiocoytfm r i ols0teurxmpoydaltn iesls) 2uaum ou4teenmfetldla2ranvs t4 rtnmfcootopDe i i;t) ruoxo3ny4llenlicsatfs2tm(m nt4oleoifetatfmDrm(mo (4trtoxrciytomt  ivo (0teto(rpny1apen iciat)a2trx  nt4oetoiociyslmDea(mp u) rerif3oadoa r u ol() 2xoim3iudlpt lfctl(  Dtrxr oo4tpxo o3iytls2rmu o u4altoiociytlmD  i o;t srumxo3iu1lp eliesl( a2rrum ou0texo o3iasfsDeln o;t4aexoioctytlm rau slt0 euo(m3iodolenmfet () 2tmx  ;o4aet  iciadfa ua(vonu0arxoxo3tatlpDeluvi ()s2urxm no1lpeelfviat sDtmur ou1teeo fciysfm2uauvsn(0alxoxrcoydlpt  nvils s2tmimpoy4omtnlicil(fa2taxrpnu1opxnii3ilslaDeau s;t4tlxrmf ta1lm rli sl(0t2xrir iy4apen fcs t) 2raum ;u4olx  ieiytls rluvp;u4arxoxf3oadfptr nvo s t2tm(m3iodopt mnci (fs2rrumooo1olx if3ias m rlu o;(0 renir3tadfm   n il()s2xmio oy4ol nmncs s a2taxm ot0tltn iciltlsDua(vsn(4teerio3ty1fmDe ues t t2xoir iy1lmenlfeil() 2trumooo0tlx io3ildfsDum(vs;t0 ltoio oa1lmtr uvils0t2tr(rpny4omtnmivt t  rtaxrp;o1teen iciltls uauvpnu0 lenif3ootlm elu i;s0sexr(m3oudllen nvia(  Duaumono4apto ocias a rmnmo;u4trxoir oodlm   neslt t2xo(r nydamt mfcia( artm(  ;u4oetn iciltlaDelums;u)alxnmoctodlmD lu ilt0s2toxr3iu1ol elnei t  2rrxmoou4ale micilsla2eln s (0 rtnmfctotfptr n ol( srtoimpoo1ll nmivtas)srrmu  ;u1opeoii3ilt s rmuvs (0 rxnmfcoytlp eaieo t) rtoxm3iudlpeemivta( aDrmxmpnt1aetnioetatfsDea(vo (0 exomf tatfaDeaues;s0srtm(o oudll   ietls)aDtrxr nt4alxnif3ilt mDranvp;u0alerifcia1fpt li o s0texrxr3ny4ap e netltfs2ra(mpoo4oexoii3iasfm umnmo;t)texomf tadfmD aivs;s)s2to(m iudalenmictas)s2raurpno1aex io3iltfm2elumo t4tlermf oodfpt auei s seuoxopou4aptnlfes tfaDrr( pou0optn f3tatfaDelnvpn()alxrxf3totfmt  u i;( trtr(m3ou4omte iet sf Dtrx p;u1tetnmo3ilsfs2ranvon()altnif3oatopD lnvo;s) eur(o3io1omtn nvt (fsrurumo;o4aleo i3ildla2ra(vpnu4texnmrcoadlmt lneil(0seto(mpou4lptnmncslt srurxrono1texoiocildfs rlump () eerxf oo1fptean s t srtoim nu4alenmnvilt s2rmu poo1aee mo3iys a rmump u) exnxrciotfpteln ils t2urxrpiudameemietatfsDuaur nu4tlt  o3ild m2ra( o;t0artoir oadlm elneil()s2tm(m3nodomtemfet s)sDrrxmpot0olx  iciltls um(mpnu0 lerif3iotfp  luvo s trtrimpnu4lp nmictltfs2urxrooo0aptoiietltlmDumums t) rtrmf3to1om e u s t0 rxo(r nu1ll n neil(  rrmxm ;t0apxn feiadfa2ua( onu4trenir3iadomD auvi;t t2xoimpiy1lmtemncslt srtr(mo;o0ale  oeilsfs2rmn s;t0trenif ta1fm elneil()s2um(mpoo4om  mfcsls) rtr( o;o0tpt iieiys a rm(vp;(0trermf3oa1lp raivsls) exm(m oy4ape miciasfa2ta(r ot4aptn f3tyslmDrmnvo;t4alenif3oadlpt  i s;t0srxoxm3ny1amtnmnvs tf Duru  nt0alenmfetys s umnmo t0tltrxo3oydfmDe i o;s0srtmim3io1ll   fesas)aDtaurpoo4olen f3ildls2um(mo;u)alxnio oatfatrln o t0s2toimpno4olee fvsls)a2umu  no1opx moctysls ul( s;u0tlxnmrcoo1fpDe nvs;s tetr(o nu1lmee fei tf rtrx  ;o4aexoifciatfa2uanvs;(4 rtrmfciy1opDranvs;t0 rxrxmpoy1aleemfctls  rraumpou4ope ifeiydlm2raums (0artnio3oo1fm r uvslt)t2umim3ou4ll e fci t) rrr(  ;t1oex  oeiad sDumumo;u4 exomo3iotopD  ivs t trtoir3io1alte ncilt  2umu  nu1aee iociysls2rm( s;(4 exoir iodfmtr u sl(0texmir nudlptelncs (fsDraur ou0tpxoii3iadfs ra(ms u0 rtriocia1lm rlivi ()trum(rpnu1ale  ici sfaDumxrpoo0ape  i3iad a2umnmont0alermr3ta1fa r u il()t2urir iu1aptelnvtls sDum(mp;t1tlen icildla2uau s;u) reoifciotlpt  uvils0t2tr(r3nodlmte fvs s arrmumoot0apen oetlt s2ul( onu4trtrmfcoo1lmDr ies s)setoxm3nu4ome mics s sDrauro;u0tetoifctytlm2ranmonu)tetriocoa1optrluvils) 2xo(m3no4lptn ivt s)a2rr(mooo4teeoioetadls2ra(vsn(0 rtnir3iadomDeai i s)s2tr(m3iy1llenlfesat) rraumoou0optn i3iytla2elumo;u4tlxrxf3iytlmteauesl(0s2urir iu4al elietls a2tmumpnt0tltnii3iatlm2eanvsnt)trermo ia1omtrlnvsls t2xoxo oy1ope mieslt arumuroou0tpxnifeiaslaDuanvs (0texoxrcoa1lmt aieo;s) eurxr3iodoltn ivtls)sDrru onu1olto ieiad m2um(mo u)arxomr3oydomDr u sls)seum(m oo4lpt miviatf rraumpoo1oex  f3iltfa emuvon(4altomr3oadom r ueilt0 etoxm io4am  mfeiat)aDtmu ono1alen oeild a ea( o;t0arxomf3totlm raivs t)t2umxo iy1lpt  ivsl(f 2ra(r oo4opt mi3ias sDrluvp t0alenxf ty1fp   neo;s)t2xoimpiodom   fvt t s2rm(rooo0tpx miciyd m2um( p;t4aetoircootoa   iei;s srtmxo ny1ope miesls)srua( pou0tlxnioeiyt a2ranmsnu4 rtnxr tytoaD aieols trtm(o oudom e fvia()aDraxmp;o1olxnmi3iyd a2uan p u4 lenmrciydfpt ai s s0t2xmiopiodlltnmnct (  rrmxro;u4olxoif3tltfa ul(vpnt0teeoxf3totoate ueols  eumirpoo1ameelfcsas)aDtmx  ;t4opxo o3tadlsDeau p;u4altnmrcto1om rau s s0seuoim3io4amtemfvtas sDtrx  ou1tpxo i3ilsls2el( on(4alxrio ia1lm  ai i (0teur(r3iu1lp n nvsasfsrrrxmp;u4openmieiadfs2emnms;u0treoxo oa1opDe uvi;(  2uoxo io4ap elncsl()aDumxr no1oex mo3iytfmDulnmp;t)aexrxfciytomD an o;t0srxr(mpoo1optnmietlt) 2rr(ro;o1olxomfctyd sDemump t4 etrxr3oatfptrai ols0 etr(opoydam e ivi t)s2urumo;o4oeeomfetlt m um(vp t4 ltoif3oa1lpD ai sls tetm(mpio4al elfeil(fs2taxr no4tle ifeildfs rmu pnu0alxrxrciatfmD luei;(0trtmio ny1lmt  iesl(fsrrau pnu4apeoioetlsfs elu ont4texomfctytla eluei;t0 eumxm3oy4ale mivsl(fa2raxro;o1apx iieiyslm2ran o u0tlerio3totomte ivs;t)s2xrxopio1olt  fvtat s2tm(mp;u0opt mo3tls aDraump;()aeeoifcty1omt au i;s  2xr(o oy1llen fvsasf ruaxm nt4tlto f3iyd sDemnvs;(4teenmo3tatfm raivslt s2toim3oudlmt mieta(f Durumpoo4aeeomfciysls rl( o t0 exomrciytlpt li slt)setm(r3iu1op   icia(fsrrrxroot0tlxnifeilsfm rluvp;(0aexomfciytoat  n slt trto(m io4lpen ietas)sDuax  ot0optoifctasfsDeluvs;()aetnmo oadoat livi t t2tmim nodllte fvia()artau o;o4oet mieiytla rmnms t0 ltoxo3iadlmDrln s;t0teuo(mpoy1am emneta(fa2rm(r no1ale  octys a2ul(vpnu0altnxr oy1omDeluvs;( sexrxo io1lm e ivtls aDrmuront1opxomociyt a elnmo (4 eerircoydfa elnei s)t2trxo3no4om  liciat a2rm(m ou4opx mieilt sDum( sn() eerxocoo1lat an i;s) etrxr3nu4aptelieilt s2ra(  no0alxomietadfs eau pn()aeenio iy1fmD lnvi;(  exm(opio4ale lneta( sruaur nu0oetn o3ildlm2ua(vp;() eenmo oadfp rauvo;t0setm(m3nu4lltemfvtl()srra(rpoo1tetomo3ildlsDea( onu) lxoirciotop rlueols) exrio io4om n ivilt aDuaxr ;u4alxnifctldlm rlumo (4tlxnmrcoadfmD  uvi;s trtoxopnudap e nvi ( sDrr(m ou1tee  o3ilsla2eau o;t4arenxfcoa1lmD aiei (0 etmir3iydolt mfei tfaDuru  ;u1olxo ocias a rm( o;t)tltoifcta1oaDrli i;s seur(m iydalenmfeilt  rrm(m ;t0apeo ociydls umnvsnu0 lxnxociatopte nvol()s2tm(m ny4am emictltfsDtru onu4alto oetlt m2uln on(0texrxf to1oaDeln i s0srtm(o iy1alt mivilsfsrumu onu4aexo f3iasfaDumn p;u)arerircoadlm r nvi (  eumxr3ny4oltemieiat) rurum ;t4aexomf3ilt a ul( on()tetoir3tytoaDeai i;(0t2xoirpoydopeelfei t sDrmxrp;u4tlt  o3iadfm rl(mon()arermo3iotlpte ues;s)t2xrirpno1ame mivia()srua(mpoo0tlto fciltlmDrm(mon(0 rtrir oadfaD  uesls  rtr(m3nu1ap  lieil(f 2rmx pno4oeeomfeiydfa2rmu p (0 reomr3iydfmDrlnvs;t) 2to(rpoudlm emivils) rtmxmo;t0tetoifetydfs2rl( p t)trtnxf tytomtr n s ()s2umimpoodaleelfesatfa2ua(r nt0apeo octld a umn o;u4altrxo3oatlm e nes t  2to(o oo4ap n ivs t) rur(roou1aeto i3iad a2eanms;(4texrircoydlmDrlnei;(0t2tmio3iydlpenlfesls) 2uaur ;u0apxnmi3ilslm umuvo;()altoxr3oydopte n il()sexoio iu4om   net s srtaxmpnt0aexn o3iad sDran s;u4 exomocia1opD lnei;s0t2xrxmpnu4ll nmivsls) Dum(m ;o4apxomoctls mDel(vs ()aeenmocoytfm raues t)srtm(m3nu4lm  mivt ( arrrxr oo0tpxn ieilt a2ul(mon(4aeenxfctydfmDe u s;s0s2xrio iydopenlictat)aDtrx p;u0oeeniictytfa eau s;t0aexnxr3tytlmDeli o;()s2xo(o ou4lmen iesl()aDrmu o;o4aee mo3tat s2ul(vpnt0 exrmo oy1omt au s s0 2umim iy4omt mfvi s  2ta( o;t4olxomfctasfa um(vsnt4 exrmrcty1opt  ueo s)trtr(o3oydalenmicils  rtmxmpno4oexoioctat mDrmn snt0artrio3oadlaDrau slt) euoiopio1altnmicils s2rrxmpnt4tleo fctls a ean s u4altnmrctodomDe iei;t trxrxo ny1ll   fvi s)s2trump;u1aet moeiadlsDemn o;t0trerxrcoatoptrai s;t teuoir nydolee nesatf Durx p;u0aptoiocildlmDra( ont4 eerio to1fmDranei;(  rtoio3oodapenmies t)s2umx pnt1teto fctyt a2rmumpnu0 ltnircia1optrlneo;t tetmio iydapee fvi ( srtaxront0olto f3ilt a2ul( o;u4 rtnio totlpD  iei s s2tm(m3oudlpenmivt s a2uax  no0optoifeiyt sDra(vsnu0 lerifciydlmt  u o s truo(m3iy4alen nvi s s2uaxro;t1tptnmo3tadla2rmnmo;() lxrif3oy1lm   n i;( t2xoxr3oo4al elnvs (f rtru o;t1oet io3tysls2uln o;t4tlenmo iydlpteauei t t2toxm3ou4lpen ieia(  Draum oo0olt iietad sDulu pnt0artrmf3iydlpD aneo;s0seuoxrpio4apenlneiasf Dtaxr oo0oltnmieiltls2umnmo t0trenmfciadlm  lnvilt  2xoxopno1om nlnetatfa2tr(m ou0opxomfeiydlsDrmnmp ()aetrxrctodla  lnvo;s0 ruoxo3iodoltemivia(fsrtax  no4olxnmi3tldfmDeluvs ()aetnxo3iydlm e ivolt) 2xoio3iu1olt  nvtlt)artmumono0aex iiciadfa uanvs u4 ltnmrcoadfmD  i ils0 rxmxr oudll nlfvtl(fsrumur ot0aex  o3iltla2ul(monu)tlerif oy1fm elnvo;s0 exrxmpiudll nmneslt srtau p;o4aee  fctld sDeanvp t)aexoxfciadla  lneils0s2xrio nudlltelics t)a2ta(m ;t1tetomocildfs rln snt0teerio3oo1fa  au o t0seuoxrpoo1am nlnct ()sDrruront4aexn f3iaslm2rl( p;(4teeoxocto1lmtraivi;s  etm(r3iydlm nlnvias arum(monu0teeoiocilt m2umnvo () eeoxrctatlp raivo (0srtoxrpoo1opte fvtatfa2tmumpnu1oex mfetld m2rmnvs u)tleoxo oadlpDe uvil()trtmim iodope lfvt t)srrrxrp;o0aetn oeiad s2ean p () exnxo to1faDranvi t)trtm(rpou4opee fetl(fsDtau  ot4tpeo oetadfm umu p t4 ltrxfcoadfp  ai il(0teuo(o nodlptelfvta( a2trurpno1aet  feiasls2uanvp;u4 rxoircoydlp raivs;(0teumirpiu4ame  ncsa() 2taur no4tlenmo3iadla2ul( p t4trxrmo3totfmtr n s;t) 2to(m oo1op   fvtas) rtr(rooo0aetnmietydfs2uanvo;(0arxoxo3oydlatrlnvilt0t2umir oydllee ncsl(fa2rrxrono1aptnioetaslaDraumo (0arenxf oatfpDrlu sls  2xm(m3iu1lptnlietls)s2rru o;u1tpxoifciydlsDuanvs;(4tlenxf tytfaD ai o;(  eum(m oo1lle  icil(fs2tax poo0oee mieiadfs rau p;t)aexnmr3tadfmte n o ()s2xmxo3iudlmen nesls)a2umump;t0ale io3iad a um(mo;u4arxoxf tadfmtrlnes;t0teuoxmpny4apte ietltfa2raxm nu0oeen o3iadfa2uau p () rtnmociytlpte nvs;s)trumxrpoo1llenmncsl( s2rrur nu1optoifetld aDul(vpn(0 rtrmr iytoaDeauvo s0 2xm(m3oudlmtelncils) rrmxr ;t1ale mo3tasla2rluvo;()altomrctadlpDrlu s t0trtrio nodlm emiesa(  rumurpoo4aptnmi3tatls uauvon(4 rxnmr3oodfmD lnes t)t2urirpiu4optn nvta(fsDua(ronu4tpx  ociyslmDra( sn(0 lerif3todfmteaivs ( srxmir3nu4ole lnviatfsDrmumooo4oleo ieilt m uluvs t0texomr ootlm e neolt)texr(r ny4ol nlicsat)sDrau p;u1tle ifeiydfmDuanmsn(0teenmr todfp   i sls teuo(opoy4lme mivi s sDrr(r ot1aet ii3iysla um(ms;(0trtrmrctytopteauvsls sruoio nudamtnmiesat) Dra(ro;u1opto ietat s2eanvo t)altnmo iotfa r u s;t)srurirpiu1opee neta(fsDtrurp;t4aeeniieilt s2rl(von(0 lxrxf3oo1lpD lneo;t srtoxr3io1amtelict () ruaxr no0tpxn iciyd sDuauvs t0tlxomr tydom r u o s) rxr(m iodolte nct s s2tru ooo4apt ifeiys a2ea( snt) ltriociatla ran i;( truoxo3iy4lm   iesltfaDrru  ;o4aeeoiictadfm ea( s (4 eenif iydom e n slt srxmio3io1lm   iet tfartrurpoo1tet  i3ils mDua(vpnt0aetrxf3to1opD  nvi t) exrxm ny4ap nlfes (f Dtr( o;o4alt mf3iat a2um( p;t0artrmfcoa1la   u i (0trxrxmpnodlpte fctl(farra(  ou4tle mf3iys a uanmpnu) exrmo3ia1omteai olt t2xr(rpnodapee fctls)aDtrx  oo0apt iociydlaDumnmo;u0 ltrircoatoptrli s;s0 exrxr3oy1lmenlnes t)s2urx pou1tlxo ietlsfs elnmo;t0aleoiociotlm r ues;s)s2uoirpoo4lp emfcs sfaDraxronu4aeeomictldlm2rmuvp;(4teenmr3to1fm e u o;s0teuoxm3oydol e fcsl(f 2tmxr oo1texnmfetltfa emnvp t4altrmr3iotoaDe neil()s2um(r ou4om   ics (  2ur( pot1alx iieiatlmDea(vs;t0arxoirctatlat au i;(0t2xmimpnu4al   fviasfaDtaumoou0aetoioetldlmDumnms;u)tltnmr tatoa  lues;s  exoxr3nu1al nmivt tfsrtru  nt0tpt  ociasls2rl(vpn()alenmo3iy1fmt luei;t0 2xm(m3nu1amte ncil( aDraxronu1tpe mociyslaDemuvpn(4 exoirciytfp r ies s texoxo iy4am n nciasf Dtmxrpou4tetnif3iytfm em(vpnt0arxrxo3oydopt luvs;t) 2urxr iy4ll e ici t arta(monu0oetnmieiyt s ea(ms;(4aleomr io1optrluei ( t2xmimpoo4ope  fcsas)a2truro;t1opx micilt m rluvs;u0 exnxf3iotfa elnvols0texm(m nudal nlncs sfsDtaump;u0oeto oeilsfs2ra(vont)tltoxo iydlpteau o s texm(o iu4lmte feias)aDrmu o;u0tee ioeiysfa emu o;(4tetnifctotoaD lnei () 2xmxrpnudameemfvsat) 2rm(rpoo4opxomfcilslmDulnvonu4artomf3iytla r ies t t2ur(r3no4alt mieta(f Dtm(rpno0tpeoifciltlaDuauvp t4trenir todfateluvo (0truo(o iu4ap nmnvtls)srrmu o;u0olenmo3iys s2eaumo;()trtrmrcoo1omD lies ()teto(o iudll  mfes tfaDta(r ;t4altomoeildlm rlu pnu4aexnxo3to1omtrlnvo;s0srxoir3oodom  mfvs ()s2umu o;t0alxomicilt m2um(vpnt)teeomr3iodfp r iei t)truoio oy4aleemiesa()arrm(root0tpe mi3iytla ra( s u0 exomr todfaD luvolt0 exoxr oodlle mfctlt)sDuau  oo1alto icilsls2eanmonu)texrmo3oytoaDrlieslt0seurxrpiy1apen nctl()srtaurpoo4aleo o3iad aDua(monu)areoxr tytfpt anvs;(  2tr(r nu1omtelfeiat  rumx pnt4tpx mi3tldlaDuanvpnt0 exrio oydlp eanes s0 etrxm oy1amt  fcs s)a2taxm ;u0texo ociydfs elump u0treoxf ty1lp rlnvi ( t2xm(o oo4lp n fet ( aDtrxr nu1aex ioeiadfa2elnmo t4 renir3oydlmt aueo s0tetoio iy1om emiciltfs2taump;t0opeo octydfa2elnvsnu) ltrir iy1fm eauvi;(  eumirpoy4ap  mfci s) 2tr(rpot4apxoiietydfa2ulumsnu0trxrirciydfaD ai o;()t2urxm3oo4lpenlivta( aDtru ono0alxnifeiadfsDuanvo;t)aetnxociytoaDraivo;(0t2xrxo3io4ll nmncsltfsrurxm oo0tlxnmfetld a2uaumpnu0 renif iodfaDraneolt  2xm(o iy1op  mncslt) rumu o;o1oee mfciysfs2umnmp;u4alermf tydoaD  uvs t0 rtmir io1ll  mfvt s)aDumurp;o1tptomieiaslm emn p (4tltnmo totfmDe i s t) etrio3io4lptnmieiat)sDtm(r ;o1tpeomieils sDrmu o t) ltomr oadopDeluei s0sexrim oudom nmfetatfarra(  ;o1tee  iciys a ulnms t4alermo iytlmtrlnvols srxo(o nu1lleemiesltfs2rruronu1altnmoctysfm2rluvpnu0tltrir3oy1fatrlneo t) rum(r oudal n feiltf rtrurp;o4olenmocild a rmn sn(4altomrctydlp e uvs;t)s2xo(r iodope  ivilsfa2urur ;t0opt mf3tydfmDuaump;(0aeerifctotfate n sls)t2tmim nydlltnmfeta() rumxroot0tpt  fctyt m2rln ont) etrxr tytoa e n i;t) exmim3ou4apee nei s)arumurpou4alenio3tltfsDulump;()arxnmf tytfpDraivi s)setrxr oy4ope lfesa(f 2tau  ;u1tpe  ociasfa2um( p (4aexoir iytopDraueo (0seum(m3nu1lmenmfci s)s2ua(mp;u4tlt mo3tldfaDumnms;(4 rxnmo io1fp eanvo;t0teto(mpio1om elicsa(fsrumump;u1tltomo3iadla2ulnvo;(0 exrio oy1lp eaueo;s) eto(m oodlme mfvt t  2rmxr ot1olxomoeiyd a2ulnvp;u) lxomf3iy1lm elnei s  etmimpoy4ol n fvsat a2rrxro;u4ole mi3tydls2eln s u)altrmf ia1lm   nvi s) rxoimpoy1apeelneias sDururp;o1tet  feiysfm ulumo (4tleoifcoatlpDraueil(0srtoxo nodale lnetlsfsrtmu pou4altn o3iltfs rln s u4aetrxo oa1om  lnei;(0s2uriopnodapeemivi sfsrta( pnu4oltoiiciydfsDemn s ()tetoifcoatlate ivilt  rur(o oy4lm nlneiat) 2tr(mp;u1altomfciatlm2uanmp;()arenmf iotopD an o;t)texm(m iy4opee ncias)srrm(mono4oeto fctltfa2ea(mon()tetniocto1faDe ieo ()srxo(mpoy4ap emictat  Durxrpoo1tet if3ild sDem(msnu) exnmf3oydfpt  n i s0texoxm3nu4lp e fvs (  Dta(m ;t0oexomfciadls2umnms ()tlxrir3ootlm eaues (  eurxopno4ap n ieil(fsrrm(r no1opx ifciytfsDrmnvs ()altnmfcio1fa rlieol()tetmio ny4omenlivslsf 2tmxr oo4tet iieilt a ul(von(0altnir io1omD  nes t)setmxr3oy4opte icsltf rtrxmont4ole ifciytfa uaumpnu4arermfciatfpDrli s t)trxmxopou1apeemfcia(faruaxront0tpen i3tytfmDrlums;t)trtnmfciotfmDe n olt t2xo(r3oodolt  nvtas srurump;o1altnmfeiyd sDran o;()texrio3tatfateauvo;s0tetm(rpny1omte fvtat)a2uaxm ;t4oexo ieilsfa2uaums (4artnxfctytomD anvo;() 2tmim iu1al   ivsltfarrrx pnt4apto ietad sDuauvpnu) ltoir ta1fa r ies s)srtoxo oodlle mnesl(faDraumpnt0oex  i3iydlmDemumo t)alerif3oodfm raueolt0 rxoxm iy4lme  nvia()a2raumoot4oexnmfetltfaDrlu o;t) rxnxo3ia1oaDeli o s  2urir3io4om n ncil( sDtmur ot4tet mf3ils a ranms;u)artrxo3oodlmtelivslt teumio nodlp elnei sf rum(mo;t4opx mietldfmDran s;t0 exrxocty1lm elnvi s t2xmio3io4apte ivsa(  Dta(r ot0teeniocild aDelnmonu)aexnioctadoa   uesl(0teuoirpoo1lmenmies sf Drr(r ;u1olxnif3iasfa2ulnmsnu0texnmocoo1opte n il(0 etoxr no1al  miet s srtaxmpnt1oetoioeiaslmDemu on()tltoxr ty1fp e u o t  2to(rpoo4ameelicsl()aruaumpnt0oeeoif3iadlm2umumon() renioctatoa   ivolt0 2umxrpny1am n feil() Dtru p;o1oleniieiytlaDumuvp;u4alermo iy1opDr u i;(0t2xmxm ou1ap nlfciasfsrrrurpnu1alenif3ildls elnmp;t0tleriociodlateau o;() etmxr nu1olte netlsfs2truro;u4oeeomoeiysla2rmu o;u0texnir3iytlp   ies ()tetoio iudoltelies s) 2tr( ooo1tex mi3iysfm2ranvp (0texnmf iatomt li ol( srxoiopoo4lpen nvilsfsDrmxmpno4aeenmf3ias a2ul(mont0tlxnmf oodfm  au i (  etm(o nu1omen ivs tfa2ta( p;t4ope  ieiydlm rl(vs;t4tltoxr ta1om eau o ()texm(m3nudlpe miei s) rrr(rpno0optnmfeiltlmDel( s t) etrmfciatlpDeli s;(0s2toio3ny4om emfcs t)aDrr(mpnu1olen fetasls2rlumsn(0trxrxo3iatoaDrliei s  2xoxmpiydll nlnvil(faDrmumpoo0apxnmfeilslsDua(msnt) lenircoadfaDelueo (0s2xrio3nodop e ncia(faDrau o;u1opxn octytlaDel(mp;t0alxomfcto1optr u s;s truoimpoy4apte fcsl()s2rmu  no0alx mictat a umnvsn(0 etomrctotom rlneilt trumim3io1llt mivia(f rtm(mpou0optnifetasfsDeau onu4texnmf3tydoaDeaivsl()t2xoirpiy4olenmfcsas  rtaum nu0texnmoetyt s2rl( o (4aetrio3iytlp   neo s  exrxo3nudoptn feta(fsDrrxro;o4olx ifcias a umu o (0tleoxf3iy1lpDelneo;s0teuoxr nu4oltelneta(faruru pno1aptoioctadlsDuluvpn(0teerif3oo1lmD lnesls0t2xoxo3oo4amte ncilsfarta( p;o0olxoii3tydls2ran p u4trermfcoytfa r uvs;t teum(mpnu4am n nesatf 2tmump;t0tlxniociydls ulnvp;(0 lxnxrcoo1la rluesl(0teurio3oo1ome mivs (f rta(mpou1tpxoio3tltlmDeluvs t4treoxfcoatlptrln i;(0trurxopoy1lptn neil( a2taxrp;t4optnifeiaslmDrmnvp u0teenmrcoa1lm rlivo s s2xrxrpoy1lm emiesltfsDumur ;u4olen fciadla2em(vs t) lxomociydom r uvol( t2tr(o no1om   ivtl(  Drr( onu1aetn feiys m2eanvsnt0 rtrmocta1om e ivo;t tetoxo3iy1lpt  icsls)s2ua( oot1apxn oetadlmDuau p () ltnxf3iodfateanvs;(0s2trim3io4lptnmfvilsf Duax oot4oex mf3iysla2ra( o;u4 leomr3iadfmt li i s) exoio3ny1lltelfet s s2umur ou1olx moeilt s2rm(mp t)aleomf3oydlmDrlnvs;s)trum(o ny1omtn nvias)srur(m nu0oee  oetltfm em(vpnu0 eeoir3ia1fa eau i;s  etrim3oy1lltnmfes sf 2ra(rpou1tleo fetatfmDrln ont)trtoxrcia1om eaieslt0 2toim3iu1lme mfcils srumuront0tetomi3iadfm em(vs () exoif3oy1lpDr n i t)trxrxr io4olt  fct t)srum( pou1tltn f3tlsla2ul(vs u0teenmo3ia1op rlivi t0trxrxm iu4lpt  ivsas s2rrur ;t0tee micildfs2ea(mont0 exnxf totfp   uei;()s2umxr3oydlp nmfvsas  2umxmpoo1tpxn ieiydfs2uau s ()arenifcootfmDelu i t)sruoio3iydalee ictasf rtm(  ;u4alt mociyd s rlumpn()tltoio3oo1late ivolt0t2umiopiodole mnvtasfs2ta(  ;o0aetnmiciat a umnmo;u0altnio iadfa ranes (0t2xo(opoy1lpte feia(fartm(mono0tptn o3iltfs ea(vo;()arenif3ia1omDrluvi;s srum(mpiy1ap emfvtas  2rrx  nu0apt  oetls aDea(vp u0 leoir3iydfpDeaieolt0tetmio3no1lmt mictl(fs2ur( p;t4olx moeiadla rlnmpn(0trtoxocoatomDe u s;t) 2xrxo3iodlme mnvsl( aDrm(ro;t0opx mfeiad sDumnms;t4tltrmrciydfa rlieo;( trxm(mpnu1amtelicta( sDrmuro;u4oltniieiys s2rlu p;(4tlxnmoctodlm elivi s) rxoxopiu4omt  fcsltf Drr(m nu0tlenii3ildfm2ranvs t0alenmocia1oat aivo;t0setmxo3nu1apeelneiltfa2uax  ou1tpxo o3ildlmDeanmo u4texrmrciotoptr ivol( srtrxr3nodlm  lnvi tf 2rru pno4ope ifeias a emnmpnt0arxnxo3ty1laDrai o ( texr(m nu1amt mivtat)srumump;u0apx mfetaslaDum( s;(0arxoxfciotla r ueilt)seuoim nudome mfvta(fs2ra(mpnt1opx iietys m umu s;t4 leoif3oytoat luvo s0 rxoim ny1lptnlnct (  2taumpnu4opt  feiatfm2ua( s;u4aeeoxoctodfmDe nvsl() 2tmxo3no4ome lfcias srraxront1oeenif3iatlaDuauvo u4trtoxr3io1op  au slt tetm(r3iu1open fcslt) 2ta( pnt0oltnio3iadfa2uluvonu0aexrxf3oy1laDranvi s)t2uoir3oy4al  micta(fa2ta(m ou1aleoio3tltla2rm(vp;t)tltrif3oatoate n sls0sexmxo ny4ape  ncil(f 2tmx o;u4ape ifcildlsDra(mp t0tlenmo3todfp eau o t0s2tmxopnu4alte ivtat arrr(r no1tlt  fctltfaDrau sn()trerif3ootfa  an ols0 2uoxopio4amenmneils)sDtmuro;o1apx mf3iad s2elnvp;() eermr tydopt  n i;()trtoxmpnu4am e neil(fsrurx p;t4aex  oeias mDrl(vp (4tleoif3tytlm elivs;t)t2xm(o3oo4lmtelics ( aDur(mpoo1aetnmi3iatfaDulnvo;t4artnmr3io1laD  i o;(  rxrio iudlltnmfeiat a2rmxrp;u1opx ii3ilt s2ul(vs;(4treoioctodfptrlneo;t0 exo(rpiy1oltn icta()aDtmu oot1teeo fctytlmDum(mo u0trtnxr oydoaDeluei;(  rtmxm iy1omenlivt tfs2rr(rpnt4optomieiyd m el( p t4arxnxrcta1oaDraivi s  2trir ou4lpe  ivt (fs2tru pno4aexomictatlmDraump u0areoxr3ia1lmtrauvs s) rxr(r3io4omtnmfvtl()srraurpno4tlenmoctltfa2rm(von(4 ltnxr3oa1la eaivo;s) 2tmim ou1lp emfeia(  rrmumpoo4alen o3iadfm2em( sn()artoir3oadoa rai s;t) 2uoir3iy1optnmnctl(fa2tru  oo0olx  oetlsfa2ran pnu4trtrmo3to1omD auei;(0srtmio oodom   nvias)s2umu o;o0altn i3iltfs rmu p (0 lxoio3iy1latranvil()t2xm(r3ny4lptnmics ( sDum(mooo0alx  i3ildla2ulu s t) reomo ta1fm  ai s s0 2xr(mpiy1am nmiesa()srra( p;o4opxnif3iaslaDelu o t0 eenmo3iadlpDelueo;s0s2umimpiu4lm nlies t)s2trx pou4alxomiciytls ranvs;() ltrio3ty1lp  lneo (0s2xmxrpou1ap   feslt srur(mpnu0olenmi3iatfaDumumo;(0altoxr ta1op e u o;(  rtoimpiydolt  ietatfsrtrur nt1tptn ictlt s umu o;t)artrxocootopDeaivi (0sexrxmpio4amt  fviat  2rr(mpou0oexnmo3tyt sDrl(vp;(4arxrmo ia1omt aneo;t0s2umimpiydome mivtlt) 2rrurono4optnif3ils a emnvo ()trerxo oydlmte ivils0seur(rpiy1al emnctlsfsrrauroou4tet  o3ias s2rm(mpnt4alxrxociatlpD an s;( trtrxr3iodale mneiat a2tmx ont0teeomf3tydla ean o u0 ltrif3iotop   ies t0s2tmxm3iodopee fvt sfsDuru onu0opx ifetasfa eanmsnt0aetoio oo1oa r n s;s0seumim3nu4omtelncsat a2ra( oou4opxnmfctadfs2rl(vo;()tetriocoytlm elu sl(  eumxopiy1lpeemfvia(  Dua(rpot1oee moctydlsDrau p;t0tetoio totomDelivols sruoir oo1om  lfcia( s2uauro;o0aee mfctys sDemumo;u4arenir3oa1lpD livo s0s2tmim3iydapee nctlt s2tr(r oo4aex mfctld a uau p;u)tetoif3iadfpDeau slt0 etoiopiodlp nmiesa()srurum ;o0olxomo3tyslm2elnmo;u4trxriocoadopD  nei s  rtr(r3nudlp n ictls  rrmx  ;o1tle  f3iadlm ul( on(4aexoxr tatlmDr uvil( s2toxrpoo1altemiet t srumxronu1optoifcildls2ua(mo u)alenmo oadfm   nvs;s sruoxr3iu4llt mnesls  Drr(m ;u1opeo fciltfmDranms;(0arxrif3todop elneil(  2um(r iydam e ivtatfsrraxmono4tee  oetad aDelnvp u0aleoxf3ta1fp eauvi t  rum(o3oy1aptn fcsls)sruru  ;u4texnmoeiytfsDua(msnt)tetnmf3iotop eauvil() eur(m3oy1optemfesls) 2urx pnt0oltomo3iasls umn s t0tltnxocoodlp  lu sl(0srtrxo ou1lmt  ivta( s2uaxro;t0oet  fciyt mDemn s u)aexnmf todfmDeaieo;t)sexoxo nu4opeelici t sDuau ont4apeomf3iadls umuvp u4 lxrmo iatlpte nvs;t0seurim3oo4ap emfctas) Drrx o;u4olen ictltfaDeauvpn(4arxnmo3tytfatrlu sl( trtoim3oodlpeemfcilt)arum( pnt1tlxnmictysfs eluvo;u4arerxocoy1lpD au i s)teuoxm oy1om elfvsatf rtaxr no1tpxn f3iasla2um(vonu4trermr oa1fmtran o t) 2tmxrpio1lm n fcs t) Drmx pno4olx  ietyt m umuvp;u)arerxr3tatomDelnvils) exmio3no4olt mfetl(  rur(mp;o1alt mictls a2el(vsnu)altnmrcoodla elieils0 etm(mpoo4om  lfvslsfarururono0texomfcilslm ranvs;()arxrmr oodop rlivo s trtoxo3ou4al e fcta(  Drrxrpoo4tee  f3iadla em(vpnu4tetnio tytom   iei;s0 rumxmpny4ap emnei ( sDrau  ;t1ape mictlslsDuauvo (4 rxoio tadfpDrlues;(  rtr(r iu4ll elfvtlt aDum(rp;u0opx mfciyd aDrl(vp u4tltrxo tydfm r u o t sexoxrpiy1aptnlfct ( srta(rpoo1tpxnmoeilt m uanmo (0 exoxrcoadlmD  i ils)srumxm3ou1optelfeil(  Drr( pno4alxnmiciydla2em( o;t0altoif ootlpteau s;s t2triopou4altelici t aDumu pnt1tleo fciyd m uanvp;(4tetnio3tatlptr ieo;s srtoio3nu4llen fvi t)arraumo;o1apenmi3tlsfaDulump t4 eeoxo3ty1lat lues t) etr(o no1olt  fes sfarumx ont4ole ifeiadlm eln o;()trenif3ia1om rlues s0 ruo(r3iydllenmneslt sDtrumpou0tex  fciat aDrlnmo u)trxrxo3iatfa  auvo;s srxriopno4altelncsas) Drm(r no0oltnii3tys a emumsn()areoiocoadfm  luei;s0s2uoxrpiodopte icils)a2ta(root4oeeomfeiadlm2uan pnu0aexrxrcio1op elu s;t s2ur(r3ou1ome  fvt t s2trum ;t0tlt if3ildfaDrlnmp u0altoxo3oy1op e i ols0sruoxm3ou1omenmnvt s)sDtmum ;u0opx  octysfa el(mp;(0 lenmfcoadomtrlueol(  etoimpou1omeemivia(  rrru  nt1tpx mo3iyslaDel( s;(0aexriociotoptelieols)tetoir ny4al e netls a2raxm ot1opxo fciaslaDuan s;(4teenxociytlmDrluvilt srxm(r no4aleelieta( srtru  no4texnmieiat s el(vo u0 eerir todfaDr ieo s0 etmxm3no1ol  mfesls a2taumpnt4opeomociatls2uaump;() etnmr ia1lpDrli s (0t2urir nu1lmtnmnes t arumxrp;t1texnmoctytfaDrmu o;u)teermrcootfmDranei t0trxmiopiydomtelnetas  Durx ono4aexnifeiaslsDranvo;(4arxoircoadfaDe i o;() eur(mpoy4amtemivtl()a2rauro;u4tpeo feiydlaDuanvp ()aexrmocoadfaDranvol(0s2trir oudalt mfcsa(  Drmxr nu1tpen f3tlslmDeln o;u4alermo oatlm  lieilt sexm(r3iy1om   ncias a2um(mpot4tpxnmieiydfsDulumpnu)arxnircootopteanei;s0sexmiopnydlle lictlt  Duaxront1oee iicilsla ua(msn(0tltomo3tydop  aivo;t0 rurxmpnu4om nmfvt s  rurum nu0apen feiysla ra(mont)aexrmo tatomDrln s s  rum(mpiydomenlivi t  Dtrumo;u0tle mo3iadla ua(mp;(4aexrir3oa1lptrli o s) 2xrxr nydalt  ivtltfsDtrumo;u1tle ioeiys s em(mo;u)tetomo oadla  lnvo t)sruoxo3nydoptemictas  2umx oot1opt  ictys m2umn o (4 rxoir ta1lmD  n sl( s2xmir oydllt  nvs ()a2ta(mp;o1opxo ietaslm elnvo;u4 lxnxoctadomDrln i;s)teur(r nu1opt  nctatf 2ta(m ot1olxo fctytlmDul(msnu4trtnxr oytoa   i o ( t2umirpiu1lmeelfvtlt  Draump;t1tet moeiat aDranvs;u)trtomf ty1omDr i ilt  rxmirpiu4oltemfei t  rrmur nt1openiociytfs um(vs;u0tlxrmr tydomteaueilt0seuoirpio1apte fetlsfs2rax oot1apxnioeilt m ea(ms;u4 lxomfcoa1laD auvsl()s2urim ou1altn nci sf rrmxm ;u0apt mi3iad s uanmp;()teerxo3oydfmDrluvo;s  etoimpnu1apte fvtl(f Dumump;u1tlxo octyt a ua(mo u4alermr3ta1oa   ies;s0t2xrxr3io1amtnmivt ( a2uaxm ;u0aptoiiciyslsDrmnvo u) lxoxr3oodfmtran o;()s2xrxr3nu1op e ies tf rrmu poo1oeeomoctlsfsDrlu s (0arxrmrcoo1omDe i o;s0setoir3no4lpenlnesl()a2tm(ront0alxn ociadfmDraumo t) lxrmrcoytfp   n i;t0srxmir oudlm nlfcslt  Dtmum ;o4texo f3iltfa2elu p u) lxnircoy1fmtrau o;( s2ur(r oudlltemfvtasfaDta(  no1ape mo3ildlsDrmnvont)tlenif ia1fmte u s s0 eto(m3ny1lmenlfcilt)arrmxmooo0aex ifctaslmDranmsnt)aleoxo3oytfpDrlu ils)sexrim3nudopt  fvia()arta( ono0tpeoiicils aDuluvpnu)trtoxr3oo1fmD lneols0 2xoxo3oo4omeelfesltf 2tr(rpno4tleomi3tadfaDemumo;t0 leoxr3ta1lmtrlnei s)trtoxopoydlpenliciat aDur( ont4oex if3tatfmDul(ms;(0teeoif oo1omtrlieslt0 rxrxmpnodlp nlnviasf 2tax p;u1tex  o3iasfa ea(vo;u0 etomfctodlmDraies s s2xrirpnu1lmenmivsas)s2truront1tlxomi3ilsfm2rlump;(4texrif3oo1oaDraueo s  2xr(rpiodoptelictls) Dumu o;o4oltnifcilsls2ran p (4teermf3ia1fat lnes;(  eum(o no1amenlfvtls)artrxmo;o1aexoifetlt mDuln p u0aexrxr3ty1om eluei;s seumimpio4ole  feiatf rrm(rpnu1oltoio3ild s rmuvo (4trtrif tydfaD  u o s0srxr(o iydol elnviat)sDumump;o1oltn i3ildlm el(vs;t0tltoio3oa1oatrln o s texm(o oo1aptn fvt t  2taxmp;u4aet mfeiytla rlumsnt) rtnif iodop rai i s sexrxopiy1lmt lictl(fs2rau onu4opt ifeiltfm elnms t0aetnircia1opDrauei ()setoxo3iu1altelfetl(fsrrmu pot1teto ieiadfm2eau o u4texrio iytlp e n s t)s2trxmpoydape  fcils artaumpou0alxomf3iydfa2emuvsnu4 ltomrciadfmtrauesl(0trxoio3iy4amt mneil() rumum ou0tex if3tls aDuauvp u0alxnmfcty1lmDraieo;( tetmxr3no4ape  fvt t aDuaur ou0tle ioeiad s emnmsn(4aleomr3oa1oatrlneil(0 2ur(o iu4lm elnvt (faDtrxmoou0aet  ictatfa2rm(vpnt0texnmf tadfa   u o;() rurxrpiu1amtn iciat)artmxro;u1apt  iciydls eanvs;(4arenio tytop r neils  exmiopiy1ap nlfcias)s2tmumono4tee iietytfmDraumont4trenif3iy1oatrlueo t0trxoxopiu4lpe  fvtls arurx  oo0tlenii3iyd aDuluvs;t0 rxnio iydfpD aieo;s0sruoio3iy4ol e ncsatfaDrmx pou0tpto o3ils m2uan sn() lxrif iadfa  luvols0s2umirpiodam nmfvsl( sDum(rp;o4openii3iasfs2ulumsnu4 etoir tytoateliesls0tetrxm iudoptemivslt)sDrrump;o4oleomi3iytfs ean o u0trxnxf3ty1lmD  ivolt  2tr(r oydll  mivtl()aDuaxmpoo1opxo ieiasfs eanmp;u)tetoir to1fa rlnesls) rumxrpoo1ame mfeta( sDta(mp;o1oex io3iadfmDrmn o;t0aeeoxo oadfpt  u s (0 2uoim3iu4lmtn feiat  rtrxmonu1opt iictldla2rauvs;t)aexrxoctytoa eli o () rtrxmpoydapt micsls) rrmur ;o0tltnmociyt m2el(ms ()artoir3tadfmDe ieo;t  rto(opiudalte ncta(fsrumxmo;u1tex ifeiad a rluvs;(0 leomoctydomD lues;t  rxrirpoydop   fvt t)a2rr(mooo4tpto feilsla emn s;() rtoxo tadlpDeauei t0seto(m3ny4lmteliei tfa2ua(  ;o1olx ii3tyslm rlnmsn(0artrir ia1omt an s;s)srumir3io4omt mnesa(  rrrxm nu1oeen ietysfs rm( s t0alermfciydoa eaneo s0srxo(opny4lm nmici s  2rr(mpno0alto i3tadfa emu o;u4aeeoxf3oo1oat  uvslt)s2xrxmpiy4apeemnetasfaDtm(r ;u0tpeoiiciydfaDem( ont4aeenio3todfaD an s () 2um(r3iu4llte nvt (  rurumpot1tlxoioctyt a um(vp;t)teenio oatlmte u o (0 rtrio3nu4omeemivsa(fa2rrur ;t4altnifciyslaDelu p;t0 ltoirciodla rlnesl(  rxm(o oydolenlfctat  Drrum oo0alt mi3ilslmDrlu pnt4 rermr oo1omt  nes ()trxr(m oy1ap  miesl( srumxmpoo1apeo octltlm2umu o () exrmf iatlpDrlivs;s)texoxo nu1amtemncs s) rurx poo4olen f3iltfs emums ()aleomocoydlpte n i;s srxmiopiy1op n nct ()srrau p;t0oleniieiadfs ulump;u4aeermo io1lpt  ivsls trtrir3no4al  mfvsas arta(  ;u1tet mf3iydls ulums (0aetrxo3tatopteaues ( srtr(m oy4lmenlfci ( sDurx p;o4olxnmoetytfm2uluvs;t0 leoxfctadopte u s s trtmio nu1al nmictlsf rtaur ou4apx if3ias m2umn o;t4tltomo3iy1op   ivo;t0 rxo(o io4om e netl()aDtaumpot1aeen oeiasfs2em( p u4altrmfcootlaDean sl( t2urxr3ou1omt lneil(  Dtaxmpnu1opx moeiad a2uan o t)treoxo3oytoaDe ivi (  rtmxo3io4lp  mnctat  Drrx pot1olen oeiatfsDuau s;(4 lenmrctodlpDrlueolt0seto(m3oo4al n feias)srtmurpoo1tlxo fetadfm2eaums u)treomociy1fatrli il()srurxo3iudopt  fesa()sDrmumono0aptn fciasfa2ra(mon()trxrir oydlpDrauvs t sruoiopiu1lpe lfvslt arrrxmpot1tpeomoetysla2el(vont0 etomfctodfmDr nei t0trxoiopno4lm   icsl() Dra(  nt4oltoii3iatls elnmonu4 ltoxf iatfpDeliei;t t2trio nydllt miei (f 2um(ront1oltn f3iadla elu o u0aetomocootoa e uvi;()srumirpou4olen ivt tfsDrmur ou0oex mi3iydfaDemnvpnt0tlxrifctatoaDrlnei s0texriopiy1lmenlivsl() 2rmumpou1tle  oeiasfmDeanvp t)tlxnxrciatfaDrlnvo;(  etmim3iy1apenliet t) rtr(mp;u1aexoif3tadla2rl( onu4altrif3to1lm rli ol(0 ruoxrpiudam nlfvs s srumxmpnt0altoifciyd a2uau s;(4aleniociy1om eliei;s)teto(r no4lpe  nviasfsruaxr ;u4alx io3iat m2ea( snt0trermo totlpD auvi;(0s2trio oo4op   fvta(fs2trumpoo4olxn i3iyd a2um(vp t)areoxf oa1opteai ils) rxm(opny1lptelnes ( sDtr(m oo0alxoiietysfsDrlnvo;u4artnifcoatlatrlues;s0 2tmxm oudap  lfcs ( a2rrump;t4tpto fciatfa rlnvo u) exoir iydfaDelnvi;t0s2xoir3oo4lp emnvsl( srtmx p;o4tlt mo3iysfsDemnvp u)alxrxrcio1fatr ieo () exr(r3oy1lpe  nvilsf Dumxmpot1tleniictyt m2umn pnu0 rxnifciadfm elu s (0sexmim3nu4amtnlfvi sf Dtr(rooo1oee ifeilt aDrlnmo;(0 exnio oatlptr i il(0 ruoxm nodam e fesls)sDumxm ot0oee moeils s2rl(vp u4altomrciodlmte n s;(0 rumxr oydapenmfctat)artr(rpou0tetn fetadfs elnmpnt)tetoirctadfpDrau ilt0teur(r io1apeelict (  2urxmpno4aexo fetltlm2ua(mo t0 etoxoctotomtelues;t srxoio3nu4lmtnmfetat srtr(  nu0alt  feiysfm2ua(vs (4altomo ootfmDranvo;s  ruriopoo4lme  neiat artaxmo;o0oeeo i3iat s2um( pnt4aeeoio3io1oa rauvil(0srurio iy1ol elfviasfartrxmont4optn fciyslaDemnvpn()artniocoydoaDelnvil(0srxmiopoudlltn nvsasf rrmx oou4aeto oeils sDrau o t)arxnmf3totfmte n s;( teuoxr oy1oltemfcil(f rtau  ;t0oltnmoetysla ran sn()areomrcia1op   u ilt0texoimpny4lleelnvtat sDra( p;o0optnmfctas sDranvont)trxoxr3tydomte neo (0tetm(opnydomtnmnei t arrmxr ;t1tpeoioetad a ulumo ()altnifcta1om eai i t)seurimpiudlp nlfci s a2ua(ronu0ope  ocild m2rauvp;t) rxomrcta1fp r uei;s  2xmxmpoydlmt  icslt)arua(r nt1olxo o3iatfsDuanvs;(4aexrmo3oatlpDrliei;t  2xm(o oodam emnvsl( a2raxrooo4aeeoio3tlsfsDeau s;(4teeoxo3oodfateli ol()texrxo nydome lneta( srtm(  nu4tlenioeils s umnms;u0 rtoirctatoat luvi s0sexm(m3iydlmt liviat)s2ra( p;o4apxomfciadfmDrlumpnu)aeenir ootfa eluvi (0s2xoir no1olte iesls srrrxmp;u1aet  feiytlsDemumpnu) exrxr3tydoa r ieslt)s2ur(mpiy4apt lnctlt)arrmu oot0apxo fcilslsDuanvo;u4tltomf3oa1opDe neils s2xriopoo1al nmfeia(fs2raump;t4apeoif3tydls2ua(mo;t)teerxf oodfmt lnvo ( teum(opoo4omenmnetat) rtmum ;o4oetnioetas aDrmnmont) etrmfcto1la   neo ()srurxmpoy4lleelfcs (fs2ra(m ;t4alenmi3ildfa raumo (0alxrio to1op  auvo t) rumxm iudlpeelfeil( aDua(mpnu0aeto feildlaDrmump ()altnir3ia1fmD aies;t0 2umirpoo1altelnvta( s2tmx ooo1tpx iiciydls eln p u0 lenmr3totlmtrln s;t0seurir oodal e icsat) Dua(roou0ape io3iydls2uln pn(0altrxo iadlpDraueo;s0seurio3iydlmtnlnvtl(  Duaur nt0aee mieiydfmDumnvon() renmr3oydopD  n i;(  rxrxo iu4amtn ivi t  Dumuroot4tpe  ietldla2rmuvp;u0alxnxo3iotlpDeli o t srxoxm3iodomeelnvsa( srtr( pot4olxomiciat s emnvsnt0texnif3tadlm   u i (0trtmirpou4omenmfviatf 2uaxmooo4texnio3ias aDumuvpn(4alxnxf3iodfpD  neo;s srtmim iodlm emiet (f Drrxroou0alenio3iys a ra( on(4 rxrmf oa1oa  luvsls)seur(o ny4ale mnetltf Dtr( poo1tpt  o3iadlm uln o (4trxrmo3oadlm eauvi;s0 2toxm3oo4amen ivsatfaDtaumo;u1apt  o3tatla rmnvpnu)alxrircia1lpDrluvs;t0sruriopoo4om e fcilsfa2taxr ;o0tlt ioeiyd mDeln p;u)aeeoif3ia1faD  uvo s) 2toir ny1omenmfvs ()srtmu poo4oet ifctydlaDrlnvo (0altrio3oadomtelnes;() exrim3nu1oltn fciat)sDrrxmp;o1alxoiiciydfm2elnms;t4 ltrxfctodomDraueils)seumxm oy4aptnlivt t s2tr(moot1oeen iciaslmDem(msnt0aeeoir3ootlpD auvo;t)srtm(m ny1lmee icsatfaDrrx poo0tpt iieiatla rmn pnt0trxoxrcoodfptr ueolt seur(o3nydal   ivi s  2ur(r ;o4tleo fctytla2rmu p (4trtoxf oy1fmDe uei t) exrir iudlpe  nesas artmx ono4tpt  feiad s2rmn s t4 lenmo3oodomtr ivo;(  2toiopio4om  miesl(fsrum(r ;u4oet mi3tas s el( s;t0 lxoio tytfpDr u s s0sexo(o oydoltelfvtasf rrmx  ;t1opx iictaslsDran on()tlxomf ootlmDelueo ( sexo(mpoydam  mneia() Dra(rpnt1aetnmfeiyt a eaump (4 lxoif3iodlm eai i (0 rxo(o3oo1ol nlfvslsfsDtmx ono1olx mfetls aDuauvsn()aeeoxfcoodfa   uvi t s2to(o io4olt  fvi s sDuru pnt0opxnifcilsfmDrmn o;t)tleoirciydfm raneols  2to(o3oy1om n ivslsf 2ra( p;o0tpe  fciysfmDra( o (4 eeoxr3tytoa   n il()setr(rpou4oltnmicsls)a2trumoot1tet  fctlt a eanvs;t0tetrif3tytlptean ils) rum(r nu4ll nlivsl() Dumump;o1aetomo3iysla rlums;t0trtomociadopte u i s)s2trio3oodalte nvs s)sDuru  oo0tpe mfeiys mDuluvs u)trermf oadlat au i t srur(opiu4amtelfvtat) ruru  nt4olxniietatfaDeaums u4 ltoif ty1fm  luesls setrxm3io1ale mivil( a2tm(mp;t1oleniociyd sDulu p;(4 lxrioct
\ No newline at end of file
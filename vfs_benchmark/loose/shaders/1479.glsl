@@ -0,0 +1 @@
+uvs s t2tr(mpoodlltn nesa(  rtaxrp;o4alxomo3tatfm ulnvsnt) rtrir iotlat  n sls  2tm(r3nydamtelicils sDtm( p;o0tpx  f3iat sDea(vs u) rtrif3ootlmDrau sls s2xoxrpiy4apen fvils)a2trx pou4aptniiciadlmDul(vo u4 eerxr tytfp rlieo;t0 2xo(r io4lmeelfvils  Dtrxrpnu1texoiiciydfsDulnmp;(0alxnmr to1lpDraivo;t)tetmxr ny4al nmnvtl()artax ont0opx ifctyd sDea( o;u0 rxoxocoydlmDraivs;s0trtriopou4om n ivt t sDtmxm nu1texoii3iasfm2umu o;t4 rtoxr tadlmte n ol( seurxm3iudll  mies s arra(m oo0oeeo ocilt m2umu pn(4tltnmr3oatlpDeaues;(0trxrim3oudalt lfetat)arta( o;o0altomf3iytfs2rm(vont4alxomocta1fm   uvslt  etrio io1apee ictl( aDta(ront4tltnmfetytlsDua(vs;t4 lermo3oytfpDe ivsls srxrxm iodolt mivsl()artru p;o4apx mictadfa2eau s;u4 rxnmf oa1opDelieo t sexr(r3ou4ope mfvsltfsDraxm nt1oex mfciadlsDelums u) rtnxr tadomDrauvi;(0 ruoim io1lpeelivt t) rtm(m ;o4optn o3ildfa elu s;u0 rerxfciadfmt lueslt truo(m3nydlleelfetl(  rtau ont1teeomo3tatls emuvp u0trtnxr iytom rlu s s) exmxo oudalenmivil() 2tr( oot4aleoiiciasfmDrm(mpnu4aexoio3iydlp rlueilt) 2xrxo3ou4al   ivtlsf 2um(  ;u1aexoifeiadla2rlnmo;u) reomr3iotomteaivil()s2trxmpoodlltnlivs (  2rr(rp;t0tltomieilsfmDrl(vs;(0aexomf3iotlaDeli olt teurirpnu1lpe mieils)sDtrumpno0alto iciytlmDemumo;u4trtrmf tydfpD lues;s  eurxo3iu1apenmfcsa() rta(rpot1aetomi3ildfm uan snu4tlxrio3iatom  anvsls)t2ur(o iodomen iesl() 2rmum ;t4aetnioeiydlsDemu o;u4teenxfcoo1opDrli s t) 2toir iy1apt lfct sf 2trx ont0olx iiciltlm2em( snu4artnxf3tatla eauvol() rxmxo no1ll nlnet (f 2taumpot1oexn i3iytla2ulnmo;()aetnmo3to1lm eau i;s0trxr(m3nu1lltelnvtl(fsDtr( ono1oex  oeiatfs2rmumsnt)arxoxrciotfaDraueo;() etmxrpnu4ol emnci ( srurxmpnu0aet  oeiyt a2ranvp t)aetoif3oydlaDe neol( texo(o no1ll   fctlt s2rm( ono1tetn ocild a2elu ont0 ltoifcia1lpDr iei;s) rurir3oy1ap emncs s  ruaxm ot4oexoiieiys m umumo u4arenmf3oy1fm rln s t trxoimpny4ol nlfei ( s2taxrp;u0aex ifcils a uanmpnt4 ltnir ta1fmDeanvo;s  eurimpnu1ameelfvsl(f rtaurpou0tex  oetltfmDel( s (4 exrmr3oytoatrlues ()s2tmir iy4lm   ncsas  rrrxmoou4opxomo3tasfm2ranvs t0 rtnio3iadom elu ilt0 2to(r3oy1lp emivtatf rururo;u4oetomoeils sDuau snt4artnif3tydopDrliei;s0s2xrir3nudaltnlfetl() 2tmx  ;t1tle  fcilslsDuluvsnt4 rxoircoy1oaDe uvsl( truoim iydape mnvs ( artau ono1tee  fctasla2el(vs (0aetnio3iy1oaD anvs;()s2tmim iodlpenmies tfa2rmumpou1oeeomf3iltfs2rmuvp;u4 lerio oatlp  aivs s  eumxm ou1apeemfci ( srumur ou1aetnmoetlsfa2eauvon(4trxrmfctodomtrauvsls0srxoir no4oltnlieta() rraumooo1tpxnmo3tydlm umu s;u4areomo3tadopt  nvs s0 rtoim iudap  lnvt (fartax  oo0aexomfeiys aDem(ms (4altnmf3ta1om ranesls s2uoxo no4aleemfvi sfsrurxroou1oexn ieiad a2umu pnu0tltnif3iotfa eaieo (0s2umxr3iu4llt mieia( arrmurp;u4tlt mi3iadla2emnmonu4teenif3oodlptr nvs;()srtrimpoy4op   ietas) 2tr(rpno0tleoifeiydfsDulnvp t) lxnir3iy1oat  u s s0 2umirpiu1ome miciat)a2umurpot1tlx ioeiaslaDulumpnt4aleniocoatomDrluvil(0 eumirpiu1lptelneilsfarra( pno1olt ioctldlm uaumo u0arermo3iatopD lues;s)srxrxm no4al nlncta(faDuaumooo0tlx  o3tls s2ra(mo;u0trenio oy1fpDe u sls0seumxm3ny1llt livia( a2tr( p;u4oet io3tlslm2rm(vs;()altnxo totoa  luvs;() rxm(mpou4omtnmnvtlt sDur(  no0alto oetlsfa2umu pn(4areoxo oodomtrai o s  rxoimpiudamtemfvi (f 2umxronu0texo fciasfm2umn o ()arxrxf oo1omtrlneol(  ruoxmpnudomeemieil(fsrua( p;u0tleo f3iatfa em( o;() lxnxociytopt  ieo (0t2trio3oodopte fet sf Dtmxmp;u1opxomfetadlm2uau o t4alenio oo1lpDraueo () rum(rpiu4apt lnes s  ruaur nu4aexo oetytls rluvp ()arxnxo3iotlaDr nes t srtoxm no1lpe lfcsls  Dtrumo;o1tpe ii3tatls emu p u0tleoxfcio1latr ueo s) rtm(r3oudap  mneiat)a2umxroou0oexnmietld m eanmsnu)tlenirciotopD luvsls0sruoir no4lmeelfeiasfaDrm(mp;o0aptomfetls mDemumonu4aexnmr3ootopt  i s;s0s2umio ny1om emieias arrrumpnu1optomi3ildfs2rmnvs (0aeeomo iy1oaDeaivo ( s2xmxrpnu1omtn fesltfaDur(mooo0oex mfeiytlm2umu o t)artnifcoy1fm  anvs s)trurxm nu4amenmfvtat arrmuroou0tpxo ietls a uauvo u0arxrxocoa1omt  i slt)tetrxopiu1am nlivi (fsrum(mono1opxo ieiadfm2ua(vp;t0tlxomf oa1oatr ueo;s)srtoxopoo4lptnlnvs tf 2rrum no4aetomfciys mDemu s ()texnxocoodlmDe i ols0srurxopnodlptelfctl( aDumxr ;u4ope mi3iltls ul(mo u0tlxoirciodlpDelivolt)trxrxrpiudom   ncilt aDtmxrp;t1alx ifciltlaDeauvs t) rxoxo tydoat aivo (  rurxr3ny4olen icta( srra( pnt4oet ifctatfa ran p () renxf3iytlm   ueolt  2ur(r iudlmt mfei t) rurump;t0oexomi3ilsfm umn p u0altrxrcoytlpDrlu s (0sexm(opou1ap   ivsltfs2taxr oo4openmf3ild a eln pnu) lxoxfcoy1laDrauvo;s) 2umim iy1omtnmfeiat sDtmx pnt0teeoii3iyt s uauvo;()arxrxr tatomDr uvils) rur(o iu1llt  fcs t arrm( p;o1tltomictldlm2ul( s t0artomr3oatlp  li o;t)sexm(o oy4lp n nvia( s2umx  oo4aleoif3ilsfmDrmnmp;()aexrxr3tydopDe ieol(0 eto(rpnudol emnetl(  rrr(mo;u4oetomi3ilsla elnmo (4artrxfcoytlp raivs t  2trxr ny1am   fviltf 2rmu o;o1aex mieiysfmDem(vs;(4tlxoir3oytlp r neo s  2ur(o3nydlpe lfcs s aDumu oou1aexomf3iytfs uan snt) eenmf oo1opD luvi;t tetrxm oo4lm  lnvi (f rtmum nu0oee mfetls aDuan p t0teenio3iytoa e ivsl(0s2xoio oudop nmietasfsrrauro;t1tltnmoetlt aDrmu o (4artnmf tytomDran s s)t2trxo3oudlpeelfvia( aDrm(mpoo4aeeomictytls2emnmp (0alenio oatlm r neil()s2xr(o oydopt mnvs sfa2raurp;u4oltoiictad m umuvo t0tlxrif oodlaDelu il( s2urir iodllenlnvt ( a2urur ot1olx iociad sDemump () eeomr3iydfp raues s0 etr(m3nu1lmenlnvs sf Dumump;u0oetnif3iltlmDumnmp;()altnxrcoydfmt livi;t teumimpou4olen fvtl( arrau o;t1apenif3iad aDrmumsnu4 eenxf3oa1lpDrlnei;t0 2umxo3oy1lleemnvslt)aDtrurono0opeoio3iys aDuln o u0arerxr3oadoaDr ivo;( sruoiopnu4lpen fcslt aDrmx  nt1altn o3tltls2ul(vp t4trxomr tadoa e nvilt0 rxmimpio1ap  mfeta()a2tax  ;u4apx mi3tyt a rmnmpnu4alerir oa1fmtr i sls srxo(m3iu4llt  iciat) Duaxro;u1oleomf3ils a2uln o;u)arenxfcoadfaD ln s;( t2tmxo io4omt  fct t  rumxmpoo1oee  f3iys a2ran snt)areoxocoytlmD aneo;(  2xr(rpou1am  lietltf Dtrxm ou4oexn ociytfs eauvp () ltrmr tadop rlivs s srtoir no4op  livslt srtm(mo;o0apxnif3ias sDrm(vo t)trerxr3oytfp eau olt0 rtmxo3ny1omtnlnvta( srrm(ro;t4aetn ieilt a2ua(mon(4 rxnxrcoytlmDr nvi t srur(m oy4aptnmivils)s2raur ;o0optn i3ilslm2uanmsn(0tltomf tydlm  lneslt t2umxopnydop  licils) rtaxrpno0apenmoeildfa2umnvs u4tltoxr3iytlpD  ivi s) 2tm(mpoudam nlnetlt) 2tr(mo;u4oetn oetydlm uanmsnt0artomf3ootlmDeln o ( trxrir oydape  ivsatfs2ua( pot0texnifctysfmDelnms ()tlxoxo iytoa rlneil(0seuo(r oo4altemnvsls a2ur(ronu0openmoeiasla2rmu s t4tltomfcoydopt ln il(0 2ur(o iu1am eliesat) rrmu poo4olto o3tadlaDrl(vpnu0altnxf3todfaDeln ols) exrim oudlpee ivtat  rrru o;t0oltnii3tydfa2ean s;t4 exomr3iotfp r uvils0s2umiopoydope mnes (fs2rmu poo1oetomo3iasls rluvont)aetomrcto1fatrlu il()texoxo nudal   ncsl(f 2rmx p;t0tpxniieiad a uaump ()altnxocoo1fmD aivols0s2urim3ny4om nmfvi s)s2ua(roou4texomoeiltfs rluvsn(0 lxnmf3iy1fmD  u i t  eto(mpiy1olt  nvils s2rrxrpoo1olxnmo3iad s uanvsnt0 lerxo3to1omtrln slt  rumxrpoydapt  ieiltfa2umxmoou4tpeniieiys m eau s;t4aexrxo iy1opD auvs;() 2uo(rpno1optnmneils arrmump;u0alenmo3iaslm2umu p;t4aexnxr iodlpDrlnvi;s0 rumxopiudomt lfesltfaDur(r ;u4oetnifciltlaDulu s;u0 rtoxrctotlpt ai i ()srtmxr3oy1lmtnlfei sfa2ra(rpot1tlt ifetat sDemnmsn(4arxoio tydlpD livil()t2xrxrpnudale  neil(faDrmu o;t1tlxomoetytls2elu o;t0artoxociydla  anvi s0s2xoirpiydlm elivs t) rraxroou0tlxoioeiydlmDea(mo;u)tlxnmociytfp   ivsl(0 2trxopiy4ol  mnct t)sDrmx o;o4tlenmoeild aDrmu p u)trtomr oytomDean i;( trtmio3iudaleelicsls) 2ta(r ;t4aptomietlt m2rln p t)tetoxr3oytom e uei;t s2xm(r3ou1lm n nes s  2rax  ot0oltn oeiysfmDeluvo;t4 eenmf3ty1fptrluei;( t2ur(o io4ame mnetas)aDum(  oo1tpeoioctldla umnmpnu) rtnif tytlmtrlnvils0srxmxr oo1ap  mfvt ()arumx ooo4apxo fetasfs rl(vs u) etoxfcoy1fm elivs;(0sexr(o iy1op nmfesat aDtm( onu1tpxomfeiadlaDeau o u)trerxrciatlp   i s s0 eumxr iodal nmfvtas aDtaum nu4alxoifeiyd a ul( s;u4 exrio3oatlaD  i o s  rxrio3iudop   ict ()arururo;t0apxoif3tlslm2el(vo;u0alerxrcoa1fmteai olt)trumiopnu1lpen ies t)srrr(  ou1opto iciaslaDumuvsn()tltomocta1lpDe nei;t srumxrpnu4amt lneia()sDrr(mpot0ale  fcilt sDranvs t4 exrxo totla rluvols s2uoxopiudlptnlfcilt srtr(r ;o4aeeo fciys m umumsnu0aexrirciytfp raies;s teurxm oy1aptnmfciasf rtmu  nt1aptn ociyt s ran pnu0tlxrmrcty1opD auvsls0trurio nydlp e nesa(fa2tax  ou0aptnmf3iatlm ranvp;(4 exrxo3to1lmDr nvs;s0tetmxmpnydame  fcslt sDra(moou1opxn ociytla rm(ms;(0 rxoxo3ty1fptrau s;()tetr(m3oudlleelieslsfartrur no1optoio3tadlaDem( s;u4tetnmrcoa1la rln o;t0t2trim3iudlpen fvta(  rua(r ;o1aleomociasfm2ulump;(0 rxomfcoatfm eau ilt tetm(r oo1ll  mfesatfa2umxmpot1tleniociatlmDrmu o t) ltrmfctydlmteli i;(  rtmiopio4amenlfcils sDtax oou0aeen fctlt aDum(mp;u0trerircto1omDeauvilt)srxoio ny4lpe  fvsat) 2rrxmpno0oltomfeiyd sDua(vp t0teerxociy1fpDr ies ( teto(o no4lmtemictlsf 2tm( o;u0aeen fctltfsDum(ms;u0trxrxfciatlmt lieo ( seumio oy4am emnvilt) Drrx  ot4olto feiytla ua( s t4texnmfciytfm r ies;()setmxmpnydom  lnvi t)s2rm(mpnu4tlenifctldlm2rm(msnu4 leoir3iadfaDe ivsls sexr(m iydomtemfes () Dururoot0tlen octydlm2ul(msnt)altomoctatop eaueil( srurimpny1lm emfcias s2tmurp;t0ole io3ilsfm2rm( ont4arxnxocty1laDelivsls0srto(m nudolen fcsl(fsrtmx p;t1apt  fctld s2rm( onu0 rxrio3to1oateli i ( srtm(m iodom  livia()a2umxm ot4aex mo3tatlm2ran o (0trenio3oatfmtr ueo;() eumxr3nudamte nvtatf rtmxmp;t0aeenmfetld a2uln s;u)alermr3oytfpDelues;()trtm(o io4om   iesltfarum( o;o0alx mf3iysfs rlump;u4artomrctatoaDeliesls0 etrimpoodaltn ncta()srururooo1ope io3tydls ul( o;t4 ltoxo oodlm elieol() 2tr(rpoo1om  lfvi () Drmxrp;u1aet mi3tld a2ulnvp u4texrmr3iatlpD lnvs;t)trtm(r oo4ap n iei tfarrax  ot1ape mf3tldfs2uluvs;u0 ltomr3oo1oa eai i;s0t2umir3ny1omtnmfeslsfsDrm(ro;o0aexnioeiyd mDrl(vs t)alxoif3iotopDr n s () ruo(o iudaleelnviltfaDta(  no4tpe mo3tlsls2umn on(0 lenmr3ootfaDeau o;s)srxmxmpiy4ll elfcs sfarurxr nu4oee mfetydlmDrmnms;t4alxnmrcoatlmtr ieol(0t2tm(m3oo1lltnlnvt s)s2umxro;o4olx mictadfs2ulnmont) ltrmr3iy1lpDrlnvil() euoio3io1lp elnvs s) rumxr ;u4ale  f3iatfmDra( s t)tetnxrcoodfpteauvols  2trxo oo1am  mnvilt) Drmum ou4altnmictytls2rauvp;(4trenir3iydfa rai sl(0 2trim3iudamt mnetlsfsDurur no4tpeo ieiatlsDul( p;u)tlxnifctydfat au slt)trur(o3nudoltn nvs (f Drau pou0tpt ioeiyd s2ran s t)aeeoio3oatla   uesl(  rtoxopiu1ll  lieil( a2raxm ou1ale mf3tldlsDelu ont4alxrxfciy1fat lu o;t0 rxm(m io1al e feia()a2umx p;u0olen iciytfaDrlnvs;(0 exrxo3iadlaD lueils) rxmxm3nu4lp n fvsasf 2um(ro;t0oet iietas s2umn p;()trtoxrctytomDrln ol(0s2trxm3ny1apt  ivslt aDrr(  ;t0opeo feiyt m2ua(ms t) exnmf ta1fpDelnvols texriopoydlpe  nci (f Dtax pnt0tle mf3ilsla rm(mo t0teerxfctytopDr nvo;(0trtrimpnudll elfciat artr(r nt0olx mfetls sDra( p t0 exrxfcoy1fate uei;s0s2ur(m iy1omt mfes t)s2ur(mpot0tptnifciytfsDraumpnu)arenmr3iytlm  ln i s0seurirpoy1altn fvtl()aDum(rp;o0oleoii3iatfm2umnvont)tetrir iytfmD lnvs t0s2urxm3oo1om   ics s sDrrx pno0alenio3iytfa umn o;t0treoxr oodfm eanvi s  2ur(mpiu1lptnmiet (f Dtr(m nt1oltniicilt aDulnmo;t0trenircoy1lm e n s;( srxo(mpiu4am nlnetat  2uaum oo0aetoifciyslsDrln snu4arermf3ta1la rluvi t) etmxm3oudll   nvt t)s2ur(rpnu0aeen oeilsfs2umnvs;(4aeerio3ty1lptrlnvs ( sexrxm3nydalee ncia(fs2rr( oou1ole iiciat a2ulump;u4trermrciatfmD lueilt0srurim3iudole  ncia()sDtaum nu0tptoiociytlaDeluvp t)texomf oodomDrlieols trtm(o3no4ome livtlt) Drrx ooo4tlxnif3iat m ua( s;t)altnxr iatopt lu sl( trtr(r nu1ap nmfei t  Draum no4oeen i3iytls rm(vo;t0 exnifcoydfm r neolt srtrxm oodol   neias s2uaxrono4ape  oeiltlm ulump (4aexrxf iotfmtraueo ()s2urio nudom nlietl( a2taur ou4tpx  octyt s2uanvs (4texomo3oodlatrlueo s0srxm(m3oydam n fesat) Drmurpnu4olto ociatfm2el( p;(4aexoxo todoatrln s;(0srto(m iy1amtn icia(faDumuro;t1tltoifctat s2uln s u4aexomfcoydfp   ivols)trtr(mpiy4ole mfctat a2rmxm nt1tlxnioetlt a uaums u0aetoxf3tadoa rlnvo;(0texr(r ou4olen ivils arur(mpnu1tltnmf3iydla2raums u)artoxrcoatfptr n o s)srurirpnu1lmt  nvtl() Dtr(rpot0apenio3tlslsDulu pnt0tltrifcoytlptr nes;t)texmir3nu1ameelivtlsfsrua(  nu1alt ifetlt sDrmums;t0trermfciydfmt livi;t0sexoirpiydlmtemfviasfsrraumpnt4oet mfciytfs eluvp u4trtrmf oatfmDrlnes;t tetr(o3oo1altnmictltfaDtru o;u0oee  i3tyt s2rluvo;(0alermo oatopDrli o;s setrim3iu1ape mneils) rrr(r ;u4tleoioctyd aDuau sn(4tetrif3iodom eaivslt0trxrxr ny4om  lictat)aDuru oot4oet  f3tysfaDemnmo;(0tltoir3todla  aneo (0 rtoimpoudopt lnvs ()s2rmumpoo4aexn icils aDra( o (0 leoif ootfmDe i i s  rtmim io4lme liesl( srtaxmooo4altniieiltfa2rl(ms;(4aexrxr3todlmDrli s;t0seuoim ny4op emies (  2rm(m nu1tet  ocilt s2uanvo;t4arenxf iytopD luvs s0seurim nydopte fcta(fsrtmxronu0tpe ii3iyslmDemums t0trtrxo3iy1oaD an ils)sexr(m ny1lltnlfci sfarraxmp;o1tpxo o3iat a el(vsnu)trxrmociodfp rln il(  eur(mpoy1op elnvtls srurxrp;o0oet ii3ild s2em(mon()arerioctotla e nei;()seuoio iudalte icsa() Dtmur ou0teenmiciys sDeanmo;t) ltnir3oadopt lnes t0teur(rpnudoltnlncils)aDtaumpnt4apxnmiciad a2rlnmont) rxoio3tydla rlieo s s2umiopiudale  iet t a2rmx poo4tpe  ietys a2rln s u0aexnmr3oatoa rln i t) exm(o no1amt lnctat)s2rr(rpnt1tle ii3tasfsDua(mont) lxoxr iydfpDe u o ()setrir3oydaptn icia()aDtr(ro;t4tlenmi3iadls2ul(vs (4 eeoio3tadomtraieil( t2xrxr3oydam   ncsa(f 2umx  ot1oetoifeiytfsDemn p;u)texomrctotopDraues s)srtmxrpoo4ap e nes t)aDurxmo;t0tpt ioctlsfaDumnvp t)trxnxrcto1fmD aieilt) eumim3oudapeemfvtl( artmxmp;u4apeo f3iadfm rlums u4tlxoxocoy1optrluvi () 2xmim3io4al   ncsasfsrrmurpou4olxo fetldlaDemumpnu)trerxo3oodlm e nvi (0 2uo(m ny1ape licia(f rumx ono4aetomi3tatla el( p;t4teeomf3oydoatelieilt0 ruo(mpoo4olee nciltf rrmur ;o0tpt  oeiysfa ra(vonu0 exnir iy1oatraieslt0trxrxr3iu4al e ivta()s2rr(m ;o1olxniieiatls2eaumo;u0 lxoxfciotoaDe nvolt0sexrxm3ny1ap nmieiasfarrrur ;t1olxomo3tasfaDem( snt0altnxf io1lmt lieo (0trxmxo3io1llt mnesasf Draur ot0oeeomfciytls umumsn(0tlenmocoadomD anvo;t seumxmpoy1oltelnet s)sruaxmpno4altnmietytlaDem(mpnt4trerir3oo1lmteaneo t)s2uo(o nydameemfcs ()sDra( p;u0tpx ifetadfa2um(vo (4 exrifcootoptr ivo;t0srtoim iodllenmfvils)s2rmu p;u0texomi3ilt a2ra(mo;u0tleoircia1lpDrauvsls)t2xoir ou1apte fet t)arrmumoot0tptomfctasfm2ranmsnu) rtrircia1lpt  i s s s2xr(opiy1ap   fcsas)arrmu ont1aee iicils m2emumo u0treomociadlmt li ol()s2trxr io4ol emnei sf rrax  ou4tee ifetydlm2emu pnt) ltnxo3io1fmtr ieo;t) rxm(m3oo1apeelfcs t sDtr(rpnu0texoioeiltlm2emn o (4texoxrcoydlptrai ilt  2xmxopno1lpe lncslt s2uaxm nt1tpenmociyd m2eauvont0aleoxfciy1lmDrli ols  etmiopoodam nlfcilsf Dumum oo1teeoio3tydls2rmuvp;t) rtnir3ootoaD  i ilt)s2toiopny1lmenmfcta(fartmurono1texnmo3tytlmDumnvonu0 exnxo3tadopt luvo (  2uriopny4lptemfetls) rtrur nu4apxnmf3tlt sDea( pnt) ltomo oodoat  ivi (0sruo(mpiydamee nvsas  ruax  ;u0aleoiiciyt s ua( s t4 eerirciadoat  uei;t  2xmxo3iudlp  mncs (f rra(mont0oee micild s umnvonu0aetnmr3ia1opDelivi (  rtrxo ny4lm  lfci sf 2tax p;t1alenio3ildfs2uau s u4 rxnif3tydomt  i s;(0srxr(r iydap nlfvs sf 2ua( ono0opxo f3iasla el(ms;u4tltnmf3iodlaDeli i;t sexmxo3oo4omtnmfcia(f rraxrpnu0tpx ii3ils sDulump;t)tlxoxo iytfp  lneilt)setrirpou1al emfvia( srrmx  nu0opxn oeils aDua(ms;(4 etrxr oy1fpD aivs;t0srxrimpnodalen fet sfsrurum no4aeto oeilslm rluvont0arxrxf oydoa  lnvil()srur(o3iudamenlnci ()arrau oou1apen f3iyt m2umn s;u4trenmo iotfatrai s;( trxo(opno4lp emicils) Dur( p;o4opxoio3tltlm uauvo;(4tetoxo oytlaDeaneslt t2toimpnu1ol  lfvsat sruaum ot4ape mo3iydfa2uanvsnt4 rxoio ootoateliei;(0tetoimpiu4ap e feta() 2ra(mpnt4aex iiciadfm uan o u)artoxr3iydoaDeauvo t0srtrxmpny4op n icsl(f rumx ont0tetomf3iatfm ul(mon(4tetrxocoy1faDrliei;( t2uo(rpiu4am emnetas)srtrxr nu4altomietatls2eluvonu0arxnio ta1oa  aivol()truoir ny1omtnmnei (  2taur nu4aexnifeildfm2ran s t) ltrio3oytlm r ieo (0texo(rpio4ome  iviltfsrtax o;o4aeeoiieilt mDrl( snt0areomrciydlpD li o;s0srxo(r oydlpeemivslsfsrtrum no4alto oeiltfmDul(msnu0aetnmfcoadfaDeau ilt srtoxr3io1lmt mnei s)sDra(mo;u4optn ietasla emumsnu4arxnmfciadomt  nvsl(  rtrxmpnodlltelivi sfsrtrx  ;u4teto o3iltla emuvs t4aeeriociydomtelu ol(0t2umxm nydlmee nctltfsrrmu ono4tee ii3tad s2rln o;t0artnxf3tatfmtr nvo s)trumimpno4op nmfei tfsDtr(rpnu1apt  i3tyd sDem( o;u4trtnmocoytfp elivi s0srtoxm oo1op  livsa() Dtru oot0aex  ictadfm2umn pnt0tetnxf iadlmtrli i;t) 2ur(r oodlmt  fes t a2taxroou0openmo3tldlm2uau p t0altnmociy1lpt aivols0s2toio3iodalt mics s)srtm(m oo1tpe mo3tysfm emnmsn(4trerio ta1fm rluvs ( teumiopoy4amt  ietlt)aDra( oou0optomfeild s2umnvont0 ltrmo ootfm e uvs;t)s2ur(rpiy4llen ncilt) 2taur oo1ale mf3ils m ulu p;u0tetrifciadomt  ues (0s2toxopiudam e fvtas aruaxr ;u4oexnii3iadla ra(mp t4trtoxf oa1oa   neo t)tetr(o oodamtn fvt (fartm(  ;u1tpen iciys m rlu o (4areoir oytlat  ueslt) rxmxm oodlltn ictlt)arrmxrpno4oexomoctldfa2eluvp () leoircoadopt livs;(0s2xmxm3oy1apen ivtls)srrrxr nt1tltn f3tadla2ra(vp;u4 rtoxo tydfp  aivol()s2urir nu1lp   iesltf Dtmur ;u1teeomictytla eanms ()texnxfcoo1opt aneols)sexo(mpiu1ale lfcilt  Dum(ro;t1apeoio3tltlsDuauvs;(4 lxnmr3oatlpt  u i;t)t2um(m3oo4ole  ivtlt)a2rr(rp;u0tpxn ociatlaDranmsn()altoir ta1fmDrai s ( teumim ou4lm  mivsl()a2tmurp;t0olx  o3tat m ua(vpnt) lxoif totopteai i t0trxrxm iydol nlfvsls) rua(r nu1tleo oeildfaDrlnmo;u4 etrmf3tadlmDe neo () 2xmir3no4lptemiciat)arrmxm ;u1teto o3iatlmDemuvo;()artnxocio1fp eanei s)sexmimpnydop elivias a2trurooo4tlxoiietltlm2uluvp (0areoiociodoptrlies;s0trxoxmpno1lme  fvtat)arur(rpou0teenmo3iat aDelnms t0 rtnmr3tytfa  lnei;s0t2um(r ny1ap  licil(f Dtrurpno4tpt mo3iaslm2rl(vpnu4 lxomrcta1lmtr i ilt0teumxmpiu1olenlics t)sDra(  ;o0tetn oeiad mDrlu s u4texoxr3ty1lpt aueo;s sexoxr oydopeemicsl()sDururo;o1alxoii3iadlmDeanmo t)texoxr3iytlpDraivsl() euo(opoy1ole lfeiat)srrau  ot4oee ioctytla2emums t4arxnxrciatlmtrluei;(0sexoxm nudlpeemfeil(f 2rr(  nt4oetomoeiys sDel( p;u)trtomf ia1fptr ivsls texoxr3no1omtemnciat  2tax o;t4tle mf3iat s2uanvp (4 reomr iytfp elnvo t) rumirpou4ope  nvtl(faDurur oo0tlt moeildlm ra(mont4areomfcoo1oa e ueo s)teto(rpou4ll e fct t  2ra(mono0tlxoifetytla2ra(vo (0trtniociotfp r nvo;t t2tm(m iudllte ics sf rurumpot4tpxn fetad s2ua(monu) rtnmr ia1oatrln i;t0 ruoim3iydlmtemfctas)artaur ;u0ape if3iltfaDrmu p;(4trerir3ty1fm raivs;( teuoio3oodlmtnmfeia(farur(r ou4olxo i3tas s2ulu on(4artnio iy1fptr n s;(0trtm(opiy1lmen fctls s2ra(rpou0aptnmictasfs rm( ont)tetnxf3totlm eaiei ( sexoiopoy4lp n icsas srrrxm ot1opxomfciyd aDea(mp u) leoxo tatopDr u slt0texrir no4ol   fcias arrr(  ;o4altnii3iytlmDua(vs (4artnir oo1omteau o;s0t2xrxr3oy1lpenlfvsls sruau poo1oetnmo3tld s2eanvpnt)tlxnir3iotlpD ai o;() rtr(r ou1lltnlfvs s)aDtmx onu4apenifctld a rm( o;u)artnif tydfaDe n o;s  rto(opno1om elivi (faDuaur ;t0altoioetlsfsDranvp ()teenxr3oo1op e ieo;(0 rum(mpoodll nmnvsl() Drrumpnu0oet iociltfa ea(vp (0 ltomr oydlm   u ol(  2um(m io4ap   fcsl() Drm(rpnt0olxo i3iysfa ulumo t)aeenmfciy1opDrlneo;s)teum(o no4alt lfesl(fs2rmx onu4tet if3tasfmDean p;t4arermf3ia1oatraivs s0srto(rpnu1om n fcs ( aDurxr oo4tleo oetadfa2eanmp ()aleoxf oa1lpte n s t s2umxmpoodlmeemnvsl()s2ta(r nu0aetnmo3tatlm2uanmp;u0trerxf3todfa  li o (0 2xoir3oy1ll n nvs s) ruaxmont0texniiciyt s2uauvp;t0artniocoy1om   ivi s0 2toxo3nu1ap  mivils)a2trump;t0opx  o3iyslsDrl( s;t)arxnir tadfpD anvo;s) ruoim3oy1am nliviat)s2trxm ;u1tlxoioctasfsDulu o;(0 lxoxfctydfpD  i ol( s2urir3iydalt mnvs t s2ua( oot0oexoio3tysfmDuln on()teeomr ootlaD aies s)s2toio3oo4omte nciasfarraxmp;u0oexo oetasfs2umnms;(0alerxfciotfaDe nvi t0truoxr ou4open fvtl()a2tm(mont0tpen f3iyslaDuaumo;(4 rtomfctotoateaneo s)t2xrxr oy4lp nmivias)s2tru p;u4tpeoifciatlm2ulu s t)aeerxo oodfptelieslt) exrxmpio4ome livil( arrrx o;u4oeeo o3ias s2eau ont4tlenxrcootfmtran sls)sexo(o3ny1amtemictat)srtr(moou0oexomoctysfs2eanmpn(4 lxnio oy1faD aueol( sexoxopny4lmtnmivs (faDumur ;u1aexoifciysfs ra(vsnt4tlxnmrcootopDr uvi s0teur(o nu4lp nlneta(faDtm(m no1alxn feiytfs ea(mo;t)aexoxf ty1laDe i slt0s2umxrpoy4op n ncs s)a2trur oo0aexnmociytfs2eaump;t0 etrxocoytopDeaivs s srtmim nu1ol nmfcs tfs2uaxmono1tpe ifctad sDra(vo;t)trtnxr totfmD ai o t0s2urirpnu1lp  mnvt t) 2rau o;t0tpxo fetys s elnms;t0alxrmr3ootlmtrlu s s)setrimpou1ameelnvi sfs2tm( onu0oexomf3iasfmDuan snt0 reriociydfmDr nei;()s2xm(m3oo1altelivtlsfsrraxm ou1texn ietltlm2elums;t0alermrctadoa raivsls)texm(o iydal elivilt)artm(r ;o0openio3iyt a ulnmonu) lerxf ootoat li o (0t2um(r3oy1lp  mfct (  rra( ooo4oeto oeiydlaDua(mp;t4teenmf oadlmD  nesl(0trxmiopiydamee icsl(f Dtmxronu0tpxoif3ild a eaump;u0trxoiocto1op r n o;t0 etrio nodlltnlfei tfarum(ronu0aeeoii3iydla2uln pn(0 reoio3oa1lmtrluvsl( t2toim3io4aptnlictl( srurxm oo1tpx iieils s2rmnvpnt0aetoxo oodlmteln o (  eto(mpnudlle lfvsl() rrmxr no0oee  i3tysla2umu o;u4arxrxo3tydlpD  n s;s0 2tr(r nodlpeemnvtls aDtmxroou1tpt  i3iat sDuluvp (0arerxr iodlmt aivs;s0 exoio iudaltnmfvtl(  ruaxroou0tet  o3iyt a rauvonu0teenirctytfm r ivo ()t2umirpoy1omt  nvs (  2ur( pou1apeoiieiys s2emnvs;()tlxomf oadopDeaivs;t s2umio3no1ol elnetasf rtr( p;o4oexnifetld mDrauvpn(0artnio ty1fmDeauvi;(0s2xr(rpiu4lm e net t  rtr(rpnu0oeenmiciltfaDel(vonu4arenmo oadoaD  u i;s) rtm(m iy4oltemfvsl() Dur(m ;t4oee  ocildfa emums;u4alxnxfcoatfp rlueols  2xoxrpoydlltn ictasfsrta(mpoo1open ietys sDrmu sn(0tltrmo3iadfp  lieo t  rxm(m oo1omtnmfvtl( artaxmpot1tle iieiltlmDulu o;(4tleoif tadomD li ol()teuoxrpnydll  lfvi t)a2rmxrp;u0ope mfciydla2ul(mo;u4tleoxr oatlmDraueo;()teuoio ny4al emfcs s)aruax  oo1olenmociysfmDumn o t)alxoxfcoy1lm   uei s s2xm(m3nudam  livsltfsDuaxmp;u1teto oetltfaDrlumpnt)altrmf ta1fmt  u s (  rtr(m3iu1apen nvta(faDumump;t4tpeo fcias s eln s;t0alerxr3ootlm rauesls0t2toir3iodlpt  nvsat) 2truro;u0apt ifetat m ua( onu0arermocty1fpt aneo;(0srxmir3oo4oleemivsls sDrru oot1apenifcilsfs2rmumpnt4altrxo iotlpD an sl(0sexrim ny1ol e iviltfsDumxro;u4oleo ociyslm ean p;t)tetnxoctydlatelivilt texoio iydomtnlfct s arumx  ;t1opxo ietltfaDeau snt0teerif3iydfpDrlueo;s  rxrxr iudom elfvi s)a2rr(mo;u4tpeomoetadfsDelums;t)altomocta1lp  luei s)tetrir iudam  miesls) 2umx pnt4aet moctldls2ul( p u0arenir oo1latrluvs;(0srxrxo3nu1omt mfvi ( s2ra(m ;u4aexomoeilsfm2em(vp;(4tltnxo3iodla  livo;t  exo(o iy1lp nmnetl(fsrurxmp;o1apeoif3tyd mDra(msnu4 ltrif3ia1oaDe i s;t t2tmir ou4lm nlnet s)aDurum oo0aptn f3iydlmDeauvs (0 etrio3oo1opDranvs;s)srtrimpiu1lmenmfcilt) rrm(mont1tlto o3iyd a2uln p t0trtrio3iodfaD liei (0truoim ou1llee ici ()aDrmu  oo0aeeomi3tasfsDumu p ()tetoif3iy1faDe i i ()srxoiopno1lm nlfvsat  Drrumo;u1aee mi3iltls ul(vs t4aetnxr3ia1fa   n ilt0s2tm(o ou4aptelnvilt arra(mo;o4oet  icils s2ra(mpnu0aexomf3oadfaDr u s;t teuo(r iodll e ivs s srtmu  no1ole io3tasfs2elumpnt)teermr ty1oa rlnvs s0seurio3nu1ope mnei s aDtaxronu0apxn oetadla2rau o t4altoxf iadopteai i;s setoxo oydlpee ivs (f rtmxmpou1tltnmo3iysla eanmon()tetomocoydfmDelu sl()sexoxm oudlptnmies t) 2uaxmoou4apt  ociltfaDumnmsn(4altrmf3ta1faDelnei;(  eto(opiydomtemnvilt)a2tmxrpnu1aee iociat m2ea(ms u4 lxnmr3tatomD aueo;()trtoim oodlme  iciat artrumo;t4opxnmoetld m rmu o t)aexoir ty1fmt  uvi ( t2umim3no1ole mfesa(f Dtau ono0opto f3iltlaDrm(vp;(0artnxr oodfp eaies s0 etr(rpoo1lme lieiat)sDtaxrpnu1tptniieiatfa2eanvs t0trtnmr3oodom  anes;t)sexoir nu1ape  ivslsf rtmxrp;o0alto oeiltlm ranmo (0 lerxf ty1lmD aivs t) eum(r iu4lp n fctl()artau  ;t4ape mi3ildfaDuaumsnt0 eerxo oa1oat  u ilt) exmirpoy4am e icia() 2uaxmpno1olt iiciadfa rlu onu) ltnir3oa1optrlnvi t)s2trimpoydolee nci t  2umum ;t4oexnmoetld mDea(mo;()artnio tydomDe n o s t2xmir3oydomtnmfetl(faDua(  ;t0olen oetls s rau s;(4areomr oydoaDranvi;s sruo(m oy1amtnlnctlt)srra( ont0alto ictydfa2em(mp (0trxoxf oytfmDeaies s0 ruo(mpio4llee fciltfaDtaxmpou4teeo fctlsfsDelu p;u4altnif tytfmt aieo () 2uoio3ny1lmt  ivilt)s2uaxmo;o4oet  fetytfm uln p;(4 ltrmfcoytfpt luei;s t2xoxm iudaltn nvilt sDtmxrp;o1tpxn iciys a2umn o;u)tltnif3tytop rlueo;s)t2trir3ny4lm elnci t artr(monu1opxomoeiltlaDrau o;t4alenirctytop  anvs ( seuoxo no1am nmncs ()srraxrp;u0opxniieiadfa2elnmsnt)tltnxfctadlpD  ivs;s t2tmim ou1op emnet tfa2tmur nt1opxn fcilsla rmnms t)aleoiocio1lmtelnei t  eum(rpny1alt micslt) 2urxmont1aeeoifcias a2rmuvp u)altrxo tatla elnvo;t0texr(o oodole lnesas aDtrumo;u0oexoiocildls2rl(mp t4alerxrcootla e ieils t2xmxm3oy1lm  mnvi sfaDurx poo1alx iocilsfa2ulnms;u4 lenmfcoatlaD aieo t trxrim3iy1llt lnvsasfsrta(roou1ape ifciytla2rm( o u0arxnxrciy1fpDe u i;() 2trirpnu4lmtn icsl( artmxr ou0tptoifeiltla2um(mp;t) lxrmr3iotoat aivs t0t2urxr3iu4olt  net t) 2rmx pot1tetoif3iydfsDum(mpn()artoxo3tydfaDeauvs;(  rxmim iy4ap   fet tfsDurxmpno4oex  oeiytla2rmnmp u4trtnxr ia1fmDe iei s  2xrxr iy1oltelict s a2trx poo0tltnmo3ilsfa ua(msn(4aeerir ootomDr u s;()t2tmxm nu4lp   ies sfsDta( p;o1tee mfciyd m2em(mo;u) ltomo oydlat aivo;(0t2toxrpiu4alee ivta()a2uaurpoo1oetn fcildlmDrm(vs;t4 etrmrciydla eluvi (0t2tr(rpiodom   icils  Dtmx ont1tlx ioctlt m ran s;(4aexnirciy1fptrlnvols srtoim3ou1lme  netat) ruauro;o0tle iietas a2ua(ms t4 rtrxo oo1lpDr ieslt)srtoirpiudop   fvtls sDrmu onu0alx ii3iydfm2ra( s;(4teenio tatoateluesls t2umxrpoy4omtnmfci s  2rr( ono4apx io3iytlm uau p ()alxoxr3iytfatraiei;s t2xmiopoy1optemncs s  Dum( o;o1apxniieilslsDrauvp t)aeenmocoodlmteau i ( s2xmio oudlme  fcsat srtauroot1opxo ociydlm2uauvpnu0tlxnif oodoa rai i s setoirpiu4ap emfcias)srururonu0tlto iciys m2raumont)arerxfcoodfmDraivs;s)s2xmir3iydaltn fcias sDtrxmp;o0tltn oeiadls2umumo;()teenifcoadom  aies s) etrxo3no1ap  liesl(fsDtm(rpoo0aeto oetasls2uaump u)tltnxf iotfp rlu ils s2um(mpou4altn fvtlsfa2ta(mo;o4tptn oetltfa ua(ms u)aeenxf3oadoat  neolt t2xr(m nu1olt mictls arraumono1altn ietls a ran ont0texrxfciytom rln o s) rurxr oo1alte nvtatfs2tr(mooo1apx io3tys sDemn s;t) ltoxr iodlpDr n o;s0s2xoir3oudll e fvsat)sDtax pno4opeoio3iltfsDemu s u4 lxnxf ta1la e ivs;(0trtrxmpnydoptnlfct () 2rax onu0oex ifeiatfsDeanms (0alenxrctytoatelieo;()texrir3nu1ole lncilt s2rr(ro;t0olto i3iysfm rmnmo t4 exomfco
\ No newline at end of file
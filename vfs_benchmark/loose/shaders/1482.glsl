@@ -0,0 +1 @@
+neslt s2urxo3oo4ol   ivs (f rtmx o;u4altn o3tydfm ea(mo;t0texnxf oatfpD lneo t)seuo(m nudaltnlnei s srra(  ;t4opx ioetld s2um( p;u4trxnmr3oatlm raues s0 rxrxr3ou4aptnmici tf Dtrxrpou4optn fetysla2rlu pn() rxnifcoa1lm eanei (  2xrio oo1alenmfei sf Duaxronu1ale mieildlaDelnmp t) eerir oadlmD lnvol() 2xm(m3oydam  lieia()a2rr( pot0aetnmf3iad aDrau s t)trermr todfm e n i;( trtrxopnodom e ict t)s2umxrono1tpeoiieiys m emumo u0aeenxr3tadfaDrlnvo;s srxoio oodolt lnvi s  2rrxrpou4ope ifeils mDuluvpnt4 rxomo3tydfpDrau o ()s2to(opnodaltn ivsl( sDta( pno1oltn ictytfs2em(vs;u)tlxnxo3iydoa rluei;(0 2xo(o io4lm n nct t)srrrump;t4apen f3iad s emump;u)texomf oydfpte ieo s0t2xoxmpoudlpt  fvs s sDrrx pnt4tetomi3tls aDuluvpn(0aexnif3ootfpDeanvi;(0t2toiopiodomt licilt srtau  ou1olt  f3tytfsDemu p;() reoxr3iy1fmteaivi;s)sexoim oydapenlfes t) rrm(ront1aeeomfctat m2emu s;u4tltnxo3tytfp ran i;()s2toxm oodam  lfesa(fsDrrxrpou1tpt  fetas a emn p t0tlerir oydlateai olt)s2um(m ou1apt  nci ( aDraxr ;u1opx mf3ildfs ra(vsnt) etnxo3ootom rliei;s) 2um(opiudope lfeslsfsrtax  ;u0texnmfctyslm rl(mo;(4alerxo oy1fmte i o;() 2uoio no4olt micia(f Dtr(moot0tpx iociadfsDumnmonu4 lerir tadla   nvils0tetm(m3io1op  mnct t)sDtm(mp;t1teenifeiys sDemuvo;() ltrir tytom  an i ()s2tmxo3oy1ame mncsatfs2umxm ot0altn o3iytfs2umn pnu)arxnxocoa1lpD  neols0 exrir3nodamtnmfviasf 2tr( oot4ope  ieiyslmDrm(mo t0altrir3oatlpD lnvo;() eumir3iodomt mncsa(fsrtmxmp;o1olxnif3tatlm rm(mp;u) eeoxo3oadoaDeaneils) 2tr(r3nu4ale  fviat a2uax p;u1tlxoiieiasfaDrmuvsnu)aetnxfcio1omD au ol()t2to(opiu1lmtemfvtlt s2taxroot1apenio3iasfa rmuvs t0tlenxoctadomt liesls trtmxr io4aleemivs t)arrax  nu4aexoiietatlm2uln o t0tlenif oydfmtelivi;t) 2xm(rpoudom nmieiltf Drmxr ;o1altn ietldlaDuau s t4alxomr todomDr ivs;s0srxm(mpou4ap   neslsfsDua(m ;o0tetnmfcilslm2ra( p;u0 rtnmr oatoaD aueolt)sruoiopiudlltemnvtatfaDuru pou4altniietlsla rln snt0trxomf oydlaD  uvil() etoxr ny4optemfet t)a2um(mpnt0tpe ifetlt s ua( on(0areoio3totlpte u i s s2ur(opiu1lme mncslsf 2ururo;u4alt  f3iyd mDeaumonu4artoir3iatfmtelivo;(  2um(mpoy4om   nesas)srrauro;u4aex mfeilt mDelnvsnt)alermr3tatlaD  n sls0srumxm3oodolen ivil( s2rrx pou4aptn ociysfa2rauvp t4aexnmociadfpt anvi s)s2xo(r oy1amen ics sf Dtrxm ou1tpenmoeiatlsDuau o;t0artomr3iatoaDrau sls0texrxopoudole  ivilsf rua(mp;o4tet  f3iadfa uln s t)arxrxo tadoa rlueo;t0 ruoiopiodape  fvtasfaDrmxrp;t4optniociyd a um(mp;t)aexoir totlm eaies (0srum(rpou4amtemnetl() Drau pnt4opx mi3tas mDemu pnt4alermo ta1fmDean i s0 exmirpnu1om n neilsf Dumumpnu4texn ieilsfs2rau pnt0treoxf3tytoat lu i;(0trtoim3nu1lp nmivt t aruru o;o1oet mo3iysls2umump;u)trxnmf oytfpDrlnes ()t2umir3ou4am elfvtl(fa2ua(roou0tex ii3tys m2em(vp ()tltrif3tadfp  ln s ()truo(o oudlpte nvsa(  Dta(m no1tetnmo3taslsDeaumonu)aleoxfcoadlmD  ies ( srtm(o3oy4olenlfvs sfsDtaxr ;t0ape mi3iasfm eaumsnt) lxomf3oodfm e n i;s) 2xm(o3iy1omeelnct (  Drrx  ;o1opt  i3iatla2ean sn(0tltomf iadfp r i o;s)tetm(o3nu4lme  ivt s)a2tm(r ;o0opeo feild m2el( ont) rtrirctytom rluvsl(0t2tm(o oodalt mncs (f Dumxr oo0tltoifcilslmDumnvo u4tlermr to1lptelivo;()srurxr iu4lme lfvi t) rtrxm ;o1aeto fcilt aDra(mo t0 exoxrcoa1faD lnvol() euo(opny4altemnvta(fsDrax poo1apxnmoeiytls2uluvs u)tlxnmf3iadlm  auvo;t0sexoir oy1lm  licias srrr(moot0olenmietldlm ul(vo u4artnmrciytop eluvi;s0texr(m3ny1lltn fvsas srtmumonu0oexn iciyslsDumuvsnu4treniociotfa   uvslt0 rur(m iy1lm n icsls)artm( o;o0optn feildla2em(mp (0alermf3oodlptrlu o s)srur(r3io4lltn fei (fs2raxm nu0tltnmoeild sDuau p u)texoiociadfatrli i ( tetrimpoodape  fei ()srrau  no0aeeo ietyd s2ea( s ()tltnxfcta1optean i;s0 rur(r no1llte fcsa()arraum nt0tee mi3tydlm2eaumpnu) lxnxf3totlmt  u il()sexmio nodolenlfetls  Dtr(rp;u1aeenmf3iytls em(ms t0aeeomr iy1lpt  ivi s s2trir iy1omtn ics sf 2urxr oo1tlx iictls a emu s;u4aexomr3oytlpDeaneslt)t2uoio nu1opee fvils)artr( onu4oexoiieiytls rmn snu4texnxrciodlm  aueols)trxoimpny4omtelncil( aDtrum ;t0olenifeils aDeln on()aexrifctotopDe ieolt0seumirpio1al  micia(fsDrax  oo4tetoiiciadfaDra(vo;t4 rtnmo3iytop elu ol(0s2xmxopno1ale lfcsl()arrr(r nu4aptoifctys a2eln s;t4 rxrmr tadlatrlivil() rxrirpoodoptn nctasfartrxm nt4oet ii3taslaDel(mon(0 rerirciodlmD  u s;s s2xo(r iu4op  lfesls)a2trumpnt4olt  o3tasfm uanvp;(0aeeoiociatfmDraueol()srtmim3iodom nmicias sDtrurpot0tlxo i3tadla rluvp t)trenio iytoaDeaivsls)texo(o3nudlpee ictltfsDum(rpoo1olto f3ilslm2uluvont0texnmrcoo1lmDe nvo;t)t2to(o3oo4ol nmietas)arrmx oot1tlen fctydlmDumn p u0tltoir3oodomD  i o (0s2tmxr3oydol nmnet (faDrr(rpno4tpeo fctad m2rmuvp t0 etoio3oa1faD an slt trurir3io1oltn ivs s  Dtaump;t0optnifciad s2elnvpn(0arxnir oadfa eanvs (0s2tm(r iu4op n nvtasfaDrrx poo4oexomoetlsla rmnmo t0alxomr3tatlpDeluvsls  exrim3oo1lm nmfci ( aDtrxmpot1tpx moctysfs rau o;t)trermfcoo1faD aieo s) 2xoxr3oo4lm n ieiat)a2tmur ;o1alxnmociydlaDemn s;u) rxomo3iy1oa e uvols srumir ou4ome mfvt sf rtm(mpnt0oltnioeiysls2uln o;t0tltoircootfmDraiei ( t2tmxo3io1ope  fcia() Dtmumo;t4aexoifetld sDum(vsn()tetrxo3tatom ran olt0trxo(r3iodllee ivias) Drax pnu4tlxoifetyd s ul( s ()tltnmocoadfpt  nei;( s2to(opiu1lp  miciltf Dta(mo;t1olx  o3iadfsDua(mpnu4 lerxf ta1lm  anes;( t2tr(m ny4op nlfcil() 2tmur ot0oetomo3iyd mDelnms t) etoir3oadfm  livi t0 rxrxopoodlltnlnvsa(f Durxmo;u0olx ifciat aDel(vo u0 eeoiocia1la eaiei;s)srxrimpio4op n nvil( a2urxm ;t0apx micildfs2eln s;t)tetnircoo1opDeauvs t  2tmxo oo4lleemnet s) 2taum ou1oeeomfeild s ua(vs t0trxnircoatom rai o t0sruoxo3iydal nmncilsfs2rmurp;t1tetoif3iatfaDumu p;(4 leoxr ia1oa   ueols)texo(r3nydapenlnetas) Draxro;t1tpxnmi3iad aDem( o u) lxrio oatlat  n i;s texr(m ou4lmtnlivtl()aDtmurp;u0aexnif3iltfs ea(mo t)aexnxrcoa1oaDr uvs;() etmxo3no4oleeliei sf rrrum ot1opxn ieiltfs2ulnmp t) etomr ootlmD an i;t0srtoxr3ny4altemneias)arrax  nu0aleomi3iadlaDrlu pn(4tetoxo ty1op rlu olt) etmxo3iy1om emfct t  2tm(m ;t1opx io3tyslm2uanmp t)altnmf3io1lp e neolt)trumim iodamtnmneilsf 2tm(r nu4aex  ieiyd aDea(vsnu4alxrircoy1la r nvi;() 2xriopny1lptelfcsas aDuaumono1opeomiciasfs2eanmo (0 exrmfciy1laDrlu o ()srtrio oo4openlieslsfs2rmu o;t4tlx ioeiysfs emnmo;u4 renif3ty1fat  u s;s s2tr(r oy4omen nes ()aruaum ou4alenii3iadfmDel(ms u4 exrmfctatlm ranvo;s0s2xm(o3oy4lm e ncs (faDtmxr nu1aexnmieiltfm2umuvo;t) rxrir3oytoatrluvo t setr(o3ny1ole mivias)artr(ront4tpeoiiciadla emnmpnt)artoxrcoydlp rln sls srxm(m ny1lptnmnet s)a2rmxmpnt4oeeomi3iat s umumonu0 rxoioctydfp  aieilt sruo(mpno1apte fcs t  2ta(mp;t4oet mi3ild s rl(mp t0alenmf3iatfat  i ols0teuo(r3ny1opee fct sfs2trxro;t1olxn fcias sDrmuvs u4tltomf tadfaDeli o;s)srxmim iydopeemivslt)a2ta(rpnu1tee  oeiadfsDrmu on(4 exomo3totlp elueilt t2xrxmpou1amte iesat)aDtau oot0apeoioctys s uauvs;u0tlxrxo3iotla  lneo t)t2uoim nu4am nmnctls) Drmxront4tee miciasfa emu s;(0 exnmf3ia1latrauvs ()seumim iydll nlfct t)a2ta(r nt1opxn ociys m ra(ms t4aetomo3oytfmDeaies;(  2xoxrpiodllt lfvil()srtm(mpnu0aex ifciytfs2umn on(0tltnxocootfaDe uvsl( s2uoimpiydaleelnctas  rraumpot4apen fctasfsDrm( o (4 ltrxr iatfmtran i (0 exmxr3iu4lltelictas)arrax pou0opxn o3ils s2uau o t4 etoioctadopD  i i;()t2xr(r oy4ame  feiatfs2ua( onu1aex ioeiat a2um(mo u4 lxrxo3oatlaDeli s t t2uo(rpou4amee ivi tfa2tmxmp;o1tpto f3iyslaDranvsn()aetnxr to1fmt liei;t) 2uoim oo4lle  fvtltfaDtmxrpoo4ope mf3tyd a2ul( s;t4trxnxr iodfaDeaivol( t2xm(r3oy4oleelneias srur( pnt0tlt mocild s eauvp;(0trtrmr3oa1fa rlieol(0 rtmxopiudll nlfei sf ruaum ot1tetnifeiatfm2rm(mpnu)tetoxr3oytlpD auvol( sexoimpou4optn ivi ()sruaxmpnu4tpx  i3tytlmDumumon(0teeoxf3oa1faDeluei;t) exoir3iudlm nlnvt s) Dta(rpot4tleoio3iadfm rlump;u) rtrif3iotop e nvols)seumxm3nodol n fcs (fs2taxmo;t0oexnmiciltfa em( p u0 lxnmo oadlp e n slt)trxrirpnudlm nmnvt t)a2tm( p;u0olxnmieiys s2ulnvs (4 eeomo3oadoaDr n s (  exoxmpou1llee feiat) Dtr( o;u0tpx mfetad s2elump u4arenxrcoatop   i o;s0 2trio3no1ameemnvs sf rtaxmpou0oex  feilslm el(vo t0alxrmocootlm eau o () eurir ou4ame  fes () Dtmumoou1aetomi3iltlsDeluvs;t4 rxomfctatfat aieils0t2xo(r iudalte fei s) 2tru  nt4aexnmoetlt a2uauvo t)aexrmf3tydoa eai s (0 rtmxo3oo1ll   fctas) rtax  ou0tetoifetydfs ra( s;t4tlenmr3ty1fmtr nvi (0 2tm(opoydlptemfvs ()sDtrxmo;u1tetn o3iad a2ra(mp;u4tlermr oo1fa r iei (  etrir3oudameeliesls)arua(  ;u0aee mi3iatfm2elu pnt4 rtrmocoadfatrln i;t setrir3iu4omt lfesat)s2rm( p;o0tetoioeiadfsDrm(mo u0aeenifcoatop  anvo;t seumio3ny4lptnmivia(  2uaump;u0oex  oeils s um( p;u)texnxocta1oa elues (0tetrir oodopenmictas a2tm(mp;o4aex  ietadlaDemuvp u)tetnxo ootlmDe i ilt0s2urio io1om   fvsas  Dta( ooo4tltn ictytlm em( s;(4artnxocia1oaD auvi;(0t2xoirpoo1oltn fcsltfa2ururooo1apt mietyslm emums t)texnxr iytom eai ils0trum(m3nu1amtnlici (farrmum ;u0altnmictatfm rlnms (0arxrxr ia1lpDr uei t0sexrir oydll n ivtlt arurxronu1oet mociytfaDum(mo () rtoiocio1lpDeau slt)trto(r3no4llee nctas) Duau ooo4aptnif3tld s ra( o;() leoio oo1omDe neo s trtr(o oodol emnesl( a2rru  ;u1tlto ieiltla emn o;u)trxoif3iatlaDe n sl()t2urir3oo1ol   fetls)aDtrumpnt1tetnmfcias a2eauvon(0texnmf iytlp r ivi s s2um(m3iudol elfvtlt)srtrx o;u1alenmo3iytlm ra(vp;u0 eeoifctydlm r u i;t  2tm(r3nu4opeelieslsfa2tm( p;o4apxoiociad s elums t4 rerio iy1la  au s ()trtmxo oodlltnlieilt a2ta(mpnt4aptomi3iadlsDuln pn(4texoio3oodfmDrlneslt0s2tmirpiy4lpee icsasfs2urx p;o4tet  f3ias s uauvo (4 etrxo oy1fatelivs;t)s2xrxopno1ll nlnvtat)srtmxrpno0oetnmf3tlt m2el( snu)tltomrciytfptelnvol( seuoxm3io1apeeliesa()srrrum ou0oleoif3iatfa um( sn()tltnmrcoytlate nesls  rtmxmpio4lle lfci ()a2ur(m nt0aexn f3iys s rmn pnu) rxoxo3iytlaD aues (  rtmiopoudllee ies s srum( p;u1apxo octas s2rlnmsn(0 ltrirciadopteluvo t sexoxm io1ap emneta(f rraxrpou4optomo3iydls2ua( p t0arxnmf iy1oa eanei;t  exm(opiu4omt mnesl()sDur( ono1tpt ii3tytlm uaums;(4trerirctotfp  an o s  exoxmpny1opteliviat arrau o;o0opxn i3ilsfmDean snu)arxrxo3iotlaDrli s;s tetoiopiy1omtnlnctat s2trum ;o1aeen ieias aDeauvpnu) rtoif3iydoaD  ueols) exrim iy4om elfci () Duaxrpou0aeeo o3ildls2eln s ()altnirciytfmt ln o;(0sexr(m ny1ll  mict ( s2tmu oot1oleoifciydfm rluvo ()arenmocoa1laDrauvo ()s2xoio iu4lp nmfctasfartrx o;u0alt moeiys a eluvo;u4texomr iodla  aneo;s texrxr3iu4ale  nes s s2uax  ;o1aex  f3iat s umu p;t) ltnir oy1oate ieil( t2toxo3oo4lm   iet s aDrm(mpou0aetnmoeiyd aDulnvp;(4aexoxfctadlm r neo;t srxoio3oy1olen iet (f 2umxmp;u1tpenmieiatfa el( onu0 rtomrciatfaD  u s;s0trxmxmpoodamtnlnct ()s2umx p;u1apxo ietld m2emnvo t4aetoxo oatlp rai i;t0 rxmxo iu4lpeelnvsl(faDtmuro;u1ape  fetls mDum(ms;(0trtrxfcia1oa r u sl() exoiopnudlm  mnctlsfs2rru pou4oet ifeiltls2rmuvsnt0tleoxociotopDe ieol(  etmxo3ny4alte iesls) rtmu p;t1teeoiietldlm um(mont)altnircoytoa rauvo t srxmxr3ny1ameemfcsl( a2tm(moou0tetnif3iyt m ul(vs t4artrif ia1opte uvi s texoiopno4lptn nctls)s2ua(mp;o4oex mfciys s ul( s;(0 rtnifcio1om eaivi t0 etoxopnu4lleemfcias) Drm(rpnu0texomiciytfm em(mpnu0 exoircoodfatr ies;(0 rtoio nu1apee fct sf rtaurpot0oetniocildfa2eluvpnu)tetoif iotfaDrln ils0trtmio3iudal   nvi t) Drm(mo;o4optn oeiytfm2ulump ()artrxfcoadla  auvi t  2uo(m3io1oltn fcia( s2ra( oot4tle mfetysfsDul(vs t4 rxoxf3ootlaDrlueo s0t2tmim3no4ape mfcs (f 2um(ro;t4teeomieias mDel( ont0tetomr3oa1fm   ueo () 2xrim3ou4oltn fet (fa2rrx ono4tlxoifeiytfs ea(mo (4alxomfcoy1la eluvi ()trur(r nu1optn ivsl(fs2taxm ;o4tpxomo3iasfa ul(mpnu4tltnxrctodfa eauvsls) rtoxr3oodoltelfeil(  2ur(  ;t1tptnifciys m2rm(vpnu4aetrxociy1fmD anesls0t2um(o oydalt mfesa(  Dumxmono0aetnmoeiadfa2ulumo (0tetnmf oodfp eauvs;(0trtmxrpio1ll nmfvtasfsDra(m no4aetnifetad s2rl( snt0aexomo3tatoaDe uei (  exm(m ou4al nmfeiat  2tmumooo0tpxnmocils a2rm( on(4 eenmrcty1lat  uei;t)trur(o nu4op e fvil()s2urxmp;o1aexnmicilt sDuauvp;u4tetoxr3iytfmtrlnei ()seumxo3iudllen feias)aDtr(r ou4aexnmoeild m emump ()texrxf oadlmDelnesl(0 rumirpoo1omt lnci ( a2tm(rpno0tpxnmo3iltlaDrlnms;(4texrmociytom rln sl( texrim3nodlm  lfviasf rumx o;u4opxniieildfm2el(vo;()arxoxr3ootop rauei;t0 rxr(r oodop elnvs t) 2tax  ;u1aetoiocils a emuvs;u)tlenxr iytom e nvi t teuriopoo4omt  nct (f Duaxrpou1tpx if3iytfm2rlnms;(4aetnxf3oy1fmte n o;t)s2um(r iodlmtnlncslt) Durxmp;u0alto ociadfm2eanvp u4 etrir ta1faD au i s)setr(rpiydam nmnvs ( sDum( pnu1altn ieilslm ean snt)arxrxfctadlatrln sl(0t2toxo3oudlmtelfei tfs2umx pno1tlxniieiltfaDem(vsn() etoir3io1optr ieo (  rtmxm oy4lleelfvtltfsrtm(mpnt0altn feiysfs elnms;u4arxrircia1omt luvs;( sexoxo iodlmenmncil(f Dumxmp;o1ole  feiydlmDem(vont) rtrmo ty1om  livolt)t2xrir iu4al nmnet t)artaurpno0alx micilslmDumnvonu4trxrxf iadfp elneilt texmxr3iydllenlnvtatfs2um(m ot0aet mi3iad m ulnvp;(0tetomf to1fm raies t srtm(mpoy1opt  fcil(  Drm(mpoo4aptomo3ilsfmDrauvo;(0 etnir ta1faD  u o t) 2trirpnu1lle liciatf Dtmurpoo4oex ifetls m ulu pnt0 rxrmr oodopt an i;(0trxo(rpnu4lpee iei t)aDrrurpot4tpx if3iydfa umnvs t0 rxomo3tadoaDeanes;t0srtmxr io4alt lncsas  Dtmurpoo4aeeomo3tysla2rl( ont0 exnir3to1lm  ai s;s texoxm ou4apen iciltf rrrxrp;t4aeeo i3iltfm eau o u4 eeoxf oa1laDrau il( trxoim no1lmee nvi tfaDuaxro;u4texoifciyt m2emu o t)aeenir oy1lm eauvo;(  eur(opiodalen ict t  rrrxm nt4oleoifciydla2uluvo t4arenircoatfm e nei () exoir3io1lptnmnvta(farua(monu1tlen i3iadfa ran o;(0aetoxr3tatfmDrlneslt s2uriopoydlltnlietas)s2trxroot0oexo oetydfmDrln sn(0 exrxf oa1fptr ivi s)trur(m iy1oltelfvt ( aDraxmo;o1oeen o3tyd a um( s u4aetoxf oytfptr i i;s0srur(r3io4alt mfvsatfsrtmuronu4ope  oetlt m eanvpn(4artnmocoodfpD  ivs s  etr(o oo4ame mfcslsfarum( o;u1tpe  i3iasls ulu snt) lxrmfcoatfmDranvo (0trxmim3nu1ape lict ()srrau  ;u4open octas a ranvo;(4artoif3iydopD ai s;t  eur(opoy1opt  ictlt) Duaxmp;u4aptoiocilsla2eanvs;t4aexrxf ootfmtrlu s (0trxo(m iodlpe  ivtas)s2raumoou4tlxoii3tysfs2emumo;t) renmociodopDeau olt  exmim nu1op nlncils)sDrrumo;t1optnmictytlm emnmp u) rtrxf3iadlmtranvi;t  eurir3oydop elivtat) 2rax pou1teeoiiciytls ul(mo (0alxomr ootlpDelu s;t)texoio3iydamtnmfetlt a2raumpnu0opx  fetyt s2rlump;t0aeenirciy1fatrli ils0seuoxo ny4llee nvil() Drax pot4opxoii3iyt sDra(mpnu)tetoxocoatla ran i;t)t2uoiopoy1lltn fci s  2umump;u1tpxo iciyt a ranms;(0 rxnir3iytfmDraieolt) 2toim oydal e fciltf rtm( ono1ale  ietls a rlu p (0altoif3ta1opt lnes ( trxr(r3ny4ol nmnet s)artr( ont0aexo fciltls rmums;u4tlenio iydlaDelivs t s2xr(rpiy4lpen fvtl( arumum ;t4alt miciltls2rmump u) ltoxf oo1lmDelnvs;t trumxr3oo1lpeelneias  2ta(rpot4aeeo fciasfm um(vont) rtoir3iytlmtrluvs;(0texr(o no4lmtn nvi (  2tru onu4apt mf3iyd a rmnvo;(0aetoxrctadfpt lueil(0 2umim3oy4alte nes ()sDrau oot1alt if3ias sDrm( ont0altoio3oatfp raieils0trxoir no1lmtn ieslt)a2urxro;t0tpe mictasfmDrlu snt0tetnxr3tatlm e uei;t)srxo(o oo1lm emict s) 2tr(m nt4tptniociasfsDuan snu0 rtrxf3ty1lpt aies;s t2uoxm iu4ome mnvs sf rum(  ;u4oleomieiadlaDua( p;u)alenxfcio1fptrau i;t s2to(opiy4llenlfcsatfaDrr( ooo1opx ii3tat a2rln p;u0 reoxr iydfpDrauvo t0tetoir3iy1omtnlnvta()aDtr( o;t0oeeoifcild s2ul(vp (4trxrmr oodfp eaivi () 2uo(rpiu4oltn nvsa(fs2ururooo1aee ifciatfsDulu p;u)texomo iytfptrln o;s) euoxr nu4lm nmivs (  Dtm(ro;t0aeen ieildfs rm(mp;u4artomfctatfmt li o;s) eum(m3iu1omte fet t) 2umumpou0opxomieiysfa rluvp;() reoio tytfp   ivo;s0srtmxopiy1ap nmneta(f 2umxmp;u4tle iociyd m eauvo;(0 exrxo iodopt aieo s0 rtoim3iydll  lnvtl(farua(rono0tpxoiieiadfaDumuvp;t4aexrmf tadopDrlu sls0 exr(o nydap  lfviat a2tmu pnt4oltnmoctyt sDul(vp () lxoxf iydopDe u s;(0srxmxm3io1llenmivils a2taumooo1aexoiictydfa2elnvo;t4 leoxo oatfm  lieo (0setoiopoudapt lfcsas) ruaxm ot0tpenmfeiasla ul(mp u4texnxocootlp rai olt) exmir iu4omt lfcsas a2ua(r ;o4tetnmoeiaslm emnmo t)texnir3oydlm  lnes (0sexmir3ou4ap  mieiat a2rm(mono0oee ioeiat sDrmnmo;(4 etrmr iotfa r i s;t) rtoim3iy1op   fvtas)s2tmxroou4aeen ictysfs2eau p;(4 lxnifctytoaD ai ols0tetmxopiu1am  lictl()srtaum nt0tpxnioctat s eanmo;u0altomo tadfpDelueil( t2xo(rpoy1lleemfet tf Dtm(r ot0tlto i3ias s eluvo t4 rtrxfcty1fa eln i t0s2xm(o oy1om  lfvt (f rrr(rooo0teeo ietltfm rlnvp;t)aexnxr iotlpDe ivs ()srxmiopiy1op elfet ( srra(moou4opxoii3tydfa umn s u4arxnmr3to1lpDr n sl( srxm(opiydapee fvs t)artr(r ou1oltoii3iat mDeanvo;u)tltoxr oadoat ai s ()t2toimpny4olte ivil(fsDtaxm ;u0optoio3iltfsDulnvp;u)arxrio3oodopD lueilt0s2xm(mpiydapenlfvta()s2taum ;o4aexnmfciysfa2um(vo (4 etoio3ta1fp  ai o s0 eum(m3oy4ll  mfetlt a2uru  ;o1opeo feiytls2el(mp;()artomrciotfpte neo;()sruoxmpiu1ole liet tfarrmx p;u0ale miciyd s2elums;t4texoifcta1lmtr ueils  euo(o3oudop e ivsl(  rtrxrono0aptoifciatlmDum(vs;t) lerxr3ootfm raueils)trto(m3no1am emfeil(fa2rm( pot1olx  i3tls s emuvs (0trtnxfcoatfmteliei;s0 euoxm3iudoptemnesls)arrru  ot1tpxn i3iydlm umnms u4aexoxoctadfpD  ueols) exmir iudam   fvia()srrrx  ot0apenif3ild m rlnmp;t4 lenxr3oo1oaD auei s)srur(r3nu4lltn feta( s2tr(mp;t0tlen ociys a2ran p;t0aetrmo iy1faD  ueols) rxm(r3oodlpt  icslt) rrrxmo;t0aeeoioeilt m2umuvsnu4arxoxfcootlpD  ieo;() 2trxo ny1om e nviltf Dtaumpnt0olx ii3ild aDuluvo;t0 exoioctotoa rau s t)trtrxm3oy4lp e ictlt  Drr(mono0tpxoii3iaslsDumu p t4alxnio ia1lm  anvo;()teto(m3iu1ol  mivi tf ruauront0opxn feias sDea(vpnt0 lxnmfcoatopt  ieo;t)setrxm iodameemivtlsf Dtrxrooo4texniieiyd aDum(mo;t0 lerxocio1oateli i;s tetmxo iu1lmt lfetasfs2ua(ronu4tpt  fctltls ul( p;(0 lxniocoodfmDelieo t truoim ou1openmieil( arum(mono0opt ifeiysfm rmnmp (4arxnio3tatlm  lu o;t)sexoxrpnydamen nct () Dtaxr ;t0altn ociltfmDumn snt4tetoif3ta1opte n o t0trurimpou1lm  mivtl(f Dra(mo;t4oeenifeiatls umumo (4 rxnxo3ia1opt  uvolt) rtoir3io1opte nvsa(f rtm(r oo0tpeniictysls ua(vp ()altomf3oatomD  nesls0texoxm3ou4amen neiat)aDraxr ou4tetnmieiytls2emnvsnt4altoir3iatlm  au i;s) 2um(m3oy4am   netasf 2um( p;t0tpt mociatfa eanmo;u0 rxnxo ty1lptrln o;()srto(o3io4openmfes s)artm(mpnu1apxo f3iytla rlnmp;u0aeenxfcoytoat  uvolt0trxrxm oydame mfvtl(fs2rmu  oo4oeeoiiciysfs ranvp u0aeenxrcoy1oat  nvsls)srtoxm iu1llenmfesa(fsrrru o;u1oexnifciydfmDea(vsnt)alxnmr3io1omtraies ()trxmirpiydoptnmncs ()aDtrur ou1tetomocilsla2rlnmp ()teenxfciotlmD  iesl(0sexr(m io1op  mneiasf rumur ;t1tleo feiysfm2el(vp u)arenio3tydop eanvi t0 2tmxrpoo4llte nvt s aDtau poo4tpen fctld s2ua(mo ()tetnmocta1oa r ivo;t)s2urio ny4olen ieilt)s2tmur ot4apxoii3ils s2rmums;(4 rtrircootoa eluvs t trtmxr3iy1lpeelicsl(  Dtr(rpno1olto feiatfa2umnvsnu4aetnmr3tydop eanvs;t  2urir nudol   fesas) rurur ;u1tpxnmi3iyt aDemu o u)arxnir iatlp  anvolt)s2urir ny1lltelfvia( arrmxrpot1aexomietyt s2umn p t)tltnmo tadom   ieil(0srurxmpio4om elneil(f Dtru  nu1olxoif3tyd s rl(vo;()arxnifciydfpt  u i;s0setm(m io1lm  liviatfarraur ot4tpxnifeiydfs ulnvs () exrmfcoodoa e n i;(  rxrim3oodoltemfcsa() rtm(mp;t0apeomo3ilslaDemuvont4treoif iydlpDe uvo s)teuoxr3oy1lpeelncils) 2taxro;o1apeoiociytfs2ulu o (0aeenmr tydoaDr ueils setrir3oo1apee nvi tf rtrxrpou4ape mf3iat mDeaumo t4 rtnmocta1oatrln sls s2trxm iu4lltnlivi () rta(m no4tpt mfeiytfa2el(msnt)texomociadlat aues () 2xoimpno4lp  mictls  Duru pou4aleoif3ias s em(vo u4tltriocty1lpt anvi;t)teuo(m nu1lme  fciat)artaxrooo1olt  ieilsls2rlu p u) rtnxr3todomtr ieo () 2xr(o io4al elfvils)arrr( pot0tpeoiiciysfm2ra( p (0 lxomrciy1lp r i i (0 rtrim nu4am emfet t arrr(  ;t0oetn ociyt s elnvp;u4 eeoxo iodoaDe ivol(0tetr(o oo4opeemieils  Dra(m nt1apt  icilsfmDuauvpn()aexnxo ia1fm  ln o;t0 2xmirpoydlltnmicslt)a2rau  ;o1apx ioctat sDem( o;u0tlxnir tydoate ivo ( t2toxr nodaptn fcsasfa2rmu  ;u1apx  o3iysla2um( snt4aeeomfcio1omD lies ()setrxopiudam n nvs s arrr(r ;o1opxnioctldfsDem(mo;u0aexoxrcta1fptrln il(0t2um(o ou4olt  iei s)a2rrum ou4ape ifciydlm el( s;t)treoio3iadomt  uvil() rxoxm3ny1lpt mivias)sDua( pnt0aet  feiadfm2uau p;t) ltoio3tytlmtelu o;s0 eumim iy4lmenmfvsl(faDumx pno0apxoif3iaslmDelumont0tlerxr3iatfp r ueo;s0trtmxmpoo4lmenlietl() 2rrxr ;o1tlxoifeiasfm ua( o;u4trenxr3iydfatrlies;t)trxmio3iy4am  mnvs ( srrm(  ;t4aetnio3iysfm2rmu s t0aleomr oytfm elivs t srum(m nydamee ietls arum(  no0oeen i3ilt m uanmpnt)areoxfcty1opte nvs t  euoiopou4al e fvtat srta( pou0aeeoifeiysfmDem(vs;u)aexoiociydlat  ieil(0 rum(m iu1alte net tf 2raurpno1apxniocilt s2ua(vs;t) lxnxo oodoa raieolt) rxmim iy4alt  fvi tf rtaxro;u4oexn ictasfm2el(vp u) rxnmo3to1lateln i;s  exrim3iodaptelnvta( arur(rpou1tpxnmfeiys aDuauvo t4tltrir3tatfa rai olt0srum(rpnodol  lfcs s)s2umxm nu1texnmf3iasls uanvo;u)aeenir3todlmD li o;t)seumxr nodame lfvsasfs2umxmpoo4tlxomieiyd sDem( p u0trxrmo to1fat lnvs;s)t2xmxo iudapenlnetas sruaxmp;o0aetnmf3ils sDrl(vo t0arxomfctydfmtelnvol(0 etmxrpny1op nmnvias aDumxm ;o4opeomoctyt s2ua( p;()tltrmf3tatop r nes t  2xm(r no1apee ivilt) Drmu ooo4optn feiat m ulnvont)texrifctotlpD lieil(0teurxo nu4aptemnes ( aDtrx oou1aeto o3iadfaDuan p;(0 lenmr3totoat li s;t)s2uoxm nu4alt livi ()aDtrxro;u0opx  fetlt a2umnms t0arerioctatfmtrau s;t  2urxm iy1apeelnes tf 2rrx ont1tpt iociydla rlnvp;()altnxf3totoa eauvs;()teto(r ny1am  lfcils)s2umu  ;o4tpe iocilslm uauvs t4trtnxr iotlptr iei;(  exr(o iydomtn fes (farta(mo;t1openmi3iat aDrl(mpnu4alxrxr to1fpt luvsl() rtr(o no1opt lfei (f Dumu pno0aeeoifctatls2el( s ()aeenir3totlaDrauesl( t2xmxr3oodoptemneias)aDrrumpot0tptoiictytlaDuau ont4texoio oo1fa  aueo s0 2trxr oodlp n fciasfaDua( oou4aptnifcild s2ran snu4 rxrxr3tadlpD lnvi;s)s2ur(r3nu4lp  mncia()s2tmxro;u4apeoioetyt a ulnvs;(0alxnmo3ia1oaD  u i;t)t2um(r3oy4ame micsls sDtrx  ;o0olxo octltlaDemn o t)alxoirctydlmt au ils  rxr(rpno4lmt mneias)srtru ont4ale ifctlsfm eaumo;u0artrxf iotla e nvo;t0s2trxrpoy1lm n fesls) Duaxrono1aleniociltfm2rmnmp t0texnio3iydfateanvi;( s2trxmpoo4olt livsa(fa2rrx o;u1opxnmictysfm eluvpnt) rxnmociytoaD  i s;s0setoio3oy4ame livsa( sDrrxro;u1oleomfetasfmDrl( ont4tleomocio1lpte nvo;s0 2to(o ny4apenmnes (f Dumxmpot0alxn fciydfs2rl(ms t0aleoir3iytfaD aivil()trtoiopnodalte ivi ()srtaxr no4tleoifciasfs rl( o;(4 exoxr oy1laDeanvs;s texrxr io1omen nvtas  2trxr ou1apxo ociltfa eanvo u0 rxomf3oydopDraieils0 rum(m nu1lm  lfvia(fa2uaxmoot1oltn f3iltfa2uauvp t4tleomrcoatfm e nei;s)sruoio iudop  lncsat) Dtax o;o4tet  ieiltfm ea(mo;t)trerxf3iadfpDeli il()srum(r3iydale  ieiltf rra(mp;u4tet  f3iysfs2eanmp;t0artomrctytfp  aieo;(0 2umxo io1op  lfcslsfsDumx o;t1oltnmictaslm2ean on(4aetoxf iy1lmt luvols)srtoir3nydlpt  nesl( srrrumpnt4tpxomo3tytfm em(vo () rtrmo3oo1lptelu s s  2uoiopoydllen ietasfsrrrurp;t4aeeo ietldlm2eluvpnt4aexoir3ia1faDe ueolt0s2to(opoy4olenmnvta(  Dua(ront4tleoio3ilsfs2rm(mp;t4 etoxfcoatopDeln i;(0t2xo(rpoy1ole mneil()aDumxmpnt0ape io3iat m2rlumo;(0alerxr iodfmDrln i t)trur(mpny4omtelfet ()sDra(mooo1tpx  ictlsla2umuvpnu) rtrir3oo1lm  livi s) rtmxr3oo1oleelietltfsDrrxmonu1apxnmo3ias mDea(mo u)artnmfcoadfm  lnvolt  eum(o nodlmeemfes ( arur(r oo4opto ieiad s2rmnvsnt4alerir3oy1fptrlieo;t0trtr(opny4om elncs tfs2trumoou1teen ociytfa um(mpnu4tlxnio3tydop  aues;()seumxrpno1ol emivsatf rtrxr ;u4apxnif3tad mDua(vo;(0trxomo tytoa eaivs;t)seurim3io1amt  ict t)srum(ro;t4tlt mi3tysfsDeaumsn(0 leoifctydfp r uvi;t)s2xrir oydlpt lnvsl()aDur(mp;o0aexo ieiysfsDrlumo;u)teenmr3to1opDean o t) euoxrpiudlme mncsasfs2trxrpoo1opeomoeiyd m el(vp;u4 lxrmfctytlaD au s;s  etrimpio1omeelnctat)aDrm(mpoo1oetnmfeils m2ra(mo;t)aexoxf oytla elnvi;s0texrxrpiu4op n netls a2tm(mpoo1aptomi3ilslm eau onu0 exrxo oytlpt  i o;()teuoim3io1olt mivsa( a2umxmonu4apx iociatlm uln s t)alxrxo3to1lpDrai s;t0t2uo(o nu1llt  fcia( aDuaxrp;o0tlxnmoeilslaDul( onu) rtnif oytoatelnes (0 2xm(m3oydapt lics (faDtmx oot1tpxnifeias m2em(vs;t)aexnif3oy1fmt  nei;( srtoio3iu1alenlncil(  rua(m ;o4opx ii3iydfa2rmu p t4tetomf3to1omD luvi;t0 2xmxo3oo1om  mnetltf Dumumpno4opeomi3tydla2uan o t) exrifctatfpDr neil(0 exr(mpnydop nlicia(fsDurxrpoo4olenmoeiasfa ul(mo t4alenxo tatopDr uvolt0tetmim ny4aptn fesa( aDrrx ont4aeeoifcilsfm2rlnvs;u0arxrif3tydlmDeaneolt0trxrir oo4om emnes (f rta(monu1apt mi3ilt m rm(vs t0arenxf3iodfm  aues ()tetrxm oo1apenmfviat aDta(rpnt0tpxoiociad a rau on()tetnmr3iy1omtelneo s0trtr(o3iydol nlivils)a2tr(mp;u0olxnmictld m2em( on()altnif oy1la r nvil()tetoxr iu1op   iesa()s2ra(mpot1tlenmfciysls2ua(vs t0teenxf3oodlp  aieo ()sexmxr3oudlm   ies (fs2rrx oot1teeniicildfmDul( s;t0arxoxrcoatfaDe i i;t0setoio3iy4op  mnvilt sDuaum oo4olx  oeiasfa2rmu pn()arermr3iytlpt au o;(0 2tmxo no4ap nlfeiasfa2raumpno0oeeoioeias aDuaumo;()treoxrcootfaDelieils)s2to(m3ny4opte ivt s sDtmxrpou0tee  f3iasfm2ua(vp u)tltnifcoatlaDeli i s0trxoxopiydapenliesa(fsrtm( onu4aet ii3tys aDrlnmo;t0alenmfciodlpt livs (0 2uo(m3iy4lme  ictlsfsDum(r ;o0oex mietadla2ra(vonu)tetoxrcoadomDe nvi;t0srtoxo3oy4lmte nvtl(fsDurxm nu0oetoio3iydfs raumo;()texnmrcoy1opD  ivilt)trtmirpou1lm emivi (f 2ur(rooo0tlx  fetysfa2ran p;t0 exnxocoytfa e i sl(0 exrxr3oydlmt  ivsl()a2rru onu1alxn oetydfmDeln pn(4alerxrcoodlaD ai ilt0 exoxr iy1op  lfctl()s2taxr ;u1opxoiiciydfm2elnmont4trxoio3tytlptelueo ( teumxmpoy4al emncslt s2ta( pnu4aexo feiaslaDrlums;(0teenxf iydfatelu s (0 rxmxo3io4lpen fvs (  rum(rpoo1oeenmoeild sDrluvpn(0altnio3oadfateluvo;(0setrxo3nu1am e fvsas) Draur ou4alt  ociadfsDeau snu4 rtnmf iytfmD  n sls0trtmxr iodamenmici s)sDraxmpnu1apx ii3ilsfm eanvp;(4tlermocio1fmtrluvo;s  2to(m ou4opt lfeslt  Duauroou1oltoiieiydfmDum(vs;t4 exrxfcoadfpt  ivsl(  exoio oo1ll emnvta()sDtmumo;t4openmoetltla emnmp;t)tlxnmr ta1lmteauei t0srumir oo1lmeemivi sfarururo;u1tpeo fciatfm2rm(mpnu0 eerir3iydfmDe ieslt setrxr3iu1am nlfcta(farum(  ;o0tlen i3ilsfaDumnvonu) rxoif iodomtr ivo s0seuoxr3nydlpe livi t)artm(ront1olxnioctyd a2el( s t0 etnxf oytfm  anes;t srxmio3ou1olt mfcias a2taxm ;t0olt mi3tyslm2umn sn(4tlenxo ootfmtelnes;s0texrio iudolen fvt ()a2trxmpnu0olt mieiyd sDem( o (0 renxr tadfa   nvo;t) rur(r3ou4am  mfeslt aDtaurono0ole if3iydls2eauvs (4 eeoxf tatfa  an ol(  2trim oodomenmies s)arrm(ro;u0oetnif3ildls ul( p t0tlenxfciotlmD lnvilt t2xo(r oudlpe mncslt) rtmxroot4olenmieiatfm2rmu p u0trermf ty1fmDeau o s  ruo(rpoy1oltnlivsl( aDrrxrono4opx  oeiasfa2uaumsnu4arermocootomD  uvo;( t2xmirpiu1ap   neta( arta(rooo0teenifeiydlsDelnmsnu4aleoxf oytopDrlu s;s0srumxm oudlm  micsl( a2rr(m ;t0texoioeiadfsDul(vo u0altnxo3tytlaDe nvils)trtoxopiy1al  lfvtl(fa2umurooo1ape  o3iydfsDumu s u) rxnioctydlaDe neo;t) etm(o3oudll  mnetlt)s2taum ;o4oetnmociyt mDuluvo u0artoifcoytfp   u il()tetr(r no1ame mneias  Drmumont4tpxomicildfsDrauvo (4treoxfcoytfp elies;()t2umir ou1apee fvsasfaruaxm oo4oex if3tadls2rln ont0 lenxo ty1opD luvo;t  etmiopny1omen fvsa(fa2rmxmpno1tee mi3iydfmDrlu p;t0 exrmr todopD anvo (  exoir3oy4lptnlivsa(faDtmump;o4ole mf3tlsfmDeluvp u4 exrxr3tadopte u i s  exmimpno4ale  iei tfs2trur no4tltniicilslm2eau o;u4 leomo3iotfp eaieils)trxoxo oy1lptn ivs tfs2tr(m ou1aex ioeildlsDrl( snu0 ltnxo ty1oaDeai ol( sexmxo no1lm   fviasfsDuaxmp;u4tpto o3iys a2eanmp (0 reomfcoydoa  an s;s)s2tm(o oo4omenmnvilt  2trx p;o0optoio3ildla2ranvsnu)tleoif oo1lpte iei (0 euo(opoy4aptelics (fartmumooo0apt mf3ilsfaDem(vsnt4tetoxr3oodlaDeaieo;s0seumio ou1ll emnciat)a2tmu ono4teenmi3ildfs2raumo u0 renif ia1fa e n ils0 euoiopou4lpe lnctl( srrrx ont4tpt mf3iydlmDuln s;t4altrmf3to1oaDe uvo s)trxmimpiodllt mfviat  Dtau poo4aetnmf3iatfsDrlu on(0alxrifcoadoaD au s;s0 2tmir io1aptelictas a2tax  nt4tetnioetlt m2ua(vp u4 eerxo iydfp  lueil(0trtr(opou1aptnmfvs ( sDua( o;t1oetn i3ias sDranvo;u0tetoir oy1fpDrlivi ( t2urxr oy1olt mnci t sDrauroot4tpxniieiytfm2um( o;t0trxomrctatfatr n i t)t2uoxo iodam  mnetl(farrax ont4tlxoiiciad a2ul( pnu0 rxomrcia1latrauvi;s setmxo io1omtnlnesl(  Dtmxrpnu1tptn i3iad mDuln o;(0artnxo3iy1oa   nvol()trumxo3iudlmt  ivils)a2ua(m nt1opt ii3iyt aDrl( p (0 exrio tytlp raiei;t0 2umxo3iu1lmtnmicsasf rraxr no4apxomoeias a uln onu4tetnmr3todomtraieilt)teuoiopny1altn fetat  2rm(ro;u0ape iieiyt s2ul(ms ()treoio iydlaDrlu s;() rxoirpiy1om emicslt sDumu pot4oexoiieiltlm rlumo u0texrxf tadlaDeli ils0seuoio oodlleelfes t s2umx  ;u1apenmiciaslm rau o (4tltnmf3io1fmtrlueo t0 rtr(r iodol   fvslt) Drr(mp;u0aee  oetld a2umnvpnt0 exrxo tydfa  luvols0srtmxo3nu4lm nlneilt aDtr(r oo0aex  feiysfm rln p t) reoir ia1optrlnvo;s0 etrio3ou1lmeemfvi t)sruauro;t1oeenif3tat mDelu ont0aeerxrcoydoa eaivo s) 2uoxopno1omtelici sf 2urur ;o1apto i3iytfa eln o;t) ltrmocta1la elnvolt0 exo(rpou1lme lfciasfa2taumooo0oeeoiiciys a um( o;u4tleoio iytfpte uvo t teurxr3nodomtn iesl()srtm(rpnt0tleomi3iltlmDuanvs t0arxnxr oytlpt  uvi t) ruo(opio1alt liet s)sDraxmpnu1altnioeiytlm ean snu)tlxnmo oytlptr uvi;t seur(o3no4om nlfvs sfsrtrxrp;o4ape  iciat s um(mo;()trenmr iotlmteai ils  eur(r oy4lp nlfvsltf Drrxr ot4tpxoiietadlm rmuvpnt0aeenio io1fm eai sl(0 2tmir oy4openmict ( s2tau p;t0tlxn f3iytla ra(msn(4tltrmf oydopt lneo;(0 2xoirpoy4lme  fcils)arrrum oo0olenmi3iatfsDranms (0 eenmf tydomDean ilt t2toim no1ole livtls a2taumpnt1aeenmo3ilslm ran s;(4 reoxr tydlm elivsls) etm(rpny1ale miet t sDtr( onu1oexnmieiydfsDea( o;t4altriocoytomtr n s t)tetrio ou1openlfcsas) rra(mp;u4oexn f3tat s rlnvs;u)aetrmfcoo1fp ean o;( sexr(rpoy1lmee iei tf rrmump;o4aptnif3tys m2ranvp;u) etrif ty1om rlnvi s0 rurxm3nudal  mfviat)aDuau pot0aex  ocildfaDra(mo;t)teerxrcoy1omD lnvi s) euo(m3oo4lp  lict ( arur(m nu1aex ii3iysls2rauvp;u4areomf tytlpte ueo t  exo(r oo4omenliei () 2tmx  no4tpxo iciltla rlumo ()alxrxf oa1laD auei ( tetmir3oo4lm n ivt s artmu oot1alxnmi3ildfmDem( ont) etomr oatoptrai s t0sexrxopou1apee nci t)a2tmumpnu0oltn fciytlm rm( s;t0tlxnxocto1fpD ln o;s)seur(mpnydoltnmfes s a2rm( pno0aeen fctydfa2umu p t)arxomfctotlmt  nei (0sruoim ny4amt lnvsat)a2rmx ont0tet  ociltfm2uanmpnt4alerifcoo1fat auvols texoio iu4omt mivsl( aDta(m ot1opeomo3tadla2uan s;t0tlxnxrcoo1opt li ol( sruo(opio4omt lnvs t)sDuaumpno1alxomietldls2ul( pnt4 eeoxf oatfp r i s t  rxriopio4alte fcsls)a2urur ot1altnmfetydfa emuvsnt)tlenir3oy1op  lnei s) rxrir io1al  livslsfa2rmx p;t4tlt  oeiltfs2em( o (0aleoio3oo1oatrliesl()setrxo ny1lptnlivias a2rm(rp;t4tltomfeiytls2eauvo;(4tlxnio oy1fptean sls)trtoxrpno1oltelics tfsDtrxmp;o1ale  fciltls2ran sn(4tlxomf oadfaDe uvi;s0 rxoxopiy1amenmnvtlsfartmumpot4tlt ifetlsfa2emump;t4aeerxf iydoaD aies s0s2xr(r iu1omeelfvs t arraxmpno0tpeniietatfm umnvp;t0 rerxr iodfptrli sls s2xr(m3iu4llte fvi t srtmur nu1optomo3ilsfa rmn o;(4 exrir tadfmt  ieo t  2xm(r3ou4lmt  fvsa( artmxmont0oltomocils s raums;u0trtnmf3tytopDraueols0 euoxo3iy4op n ivsls aDrr( pnt0tlxnmf3ilsfs uanvonu0 etoxfcto1laDr uei s setmir iodlmtn ncs s)a2uaurp;t0alt moeiat aDuluvpn(4 lxnmr tatfaDelneo t0srtr(o nu4omtelfesa(fs2urumo;t1tlxnio3tasls ulums;(4aeerxo3oodlpDe n sls0 2toim iodlmenlfvtat s2rm(  no1tltn o3iasfs2um( p;t0altrif to1lmt lies;(0srur(r ou4oltemfvs s aDuaumpno0oet ifctaslaDelnmpnt0aeenif io1fpt aivilt0sruoxm iy4ape  ieslsfsruaxmp;u0oetniieiysls eauvs u4tltrxocty1la eaueols0t2trir iu4ole mnvtl()a2rrx pnt0tleoiiciatfm2ranmo;t)aetrifcia1laD  nvsl() rumxo no4om   iei (  2trurpno0oleomfciys s2ean sn(4trxrmr3tadlp raivi (  rxmim oy1ole miviatfs2tm(ront4optnifciysfa2ua(vp u0 rtnmr3oo1lateluvs s)truoirpiy1lp  livil(f rtru  ot4tpxo o3tldla2emu o;(4aexrxf3iatlptrluvs (0trurirpoudop nmivtl( a2uau ooo1oleo fetlsls2ranvp u4aeerxfctatfpDraivs;s0 etoxm3nudapenmnei (faDtmx pot4texnmoeiatfm emu p;(0alxomoctotopD lnei;t t2xoxm ou1ameelfet s  2uaurpno0tpxnifetltfm2ul(ms;u)arerxf iodoaDrauei t)texo(mpoo4oleelnesl(  rtmxm no1tpenif3tys aDrln o t0trerxrctytoaD aies;(  2xmxm no4lmenlivt s sDraur ;t1alx mi3tldlaDrmn p;(0aetnmrciotopD  u i t)s2urio3iydlle lfvtasfsrra( oot4alxnioctldlaDulumo (4tleoxr oytlaDeln sls0sexoirpnu1lpeemieias)sDrr(rpnt1ape  oeiytls rm(mo u4tltrxr ootfptrlu ils  exoir3iodlme lnvi (fartaumo;o4optoioeiytfa2ra(mo;t)tltrir3oodlp ean o;s srtmxm iydlme  fciat)a2umumo;u0tpto ietls aDumuvp t) renxf3oodlpDr ivilt)srurio3iy1am nmivia(fs2raxro;u0aexoioctatfa2raumonu0trtnmr io1laD luvi;s seuoir oo4lpt lncil()sDtmxrono4optomieiltfs2ra(vpn(4trxrir iadfpt aieo ( t2trir oodope lnesasfarra(m nu4oltoio3tas m2ranmp;(0alenif to1oa r i s;s0s2toio iudom n icilsf Duru  ou4olxoiiciytla2ean p t)aexoxrcootlaDraies t s2xriopou1op   ics (fa2rmumpou0oleoii3tlsls umnms ()aexrmociotfpDrlu ilt)sruo(r3iydlmee fetlsf 2uauro;u4tlto i3ils mDum(vsn(4arxoif ootlat  uei;s0tetoir3ou1lmtn icslsf rrmxmp;u4tee  fctyd m umuvp;u)arenio ta1oa eanvslt0 2tr(rpiodop n nvtls  Drmxro;o4oetnmi3ildlm2ea(ms u) lerif3todfa  aivi;s0trtm(opio4olen ivi s)arururp;o1aexomoetat s eauvsnt4 renmocoatfaDr nvi;t0 2xmxm nu4alenlfetasfsDtau p;u1aptniictyslm uauvp u4alermocoodlpt lieols  2toxrpnydalt lfvtls s2rrurpnt1tltoio3iltfmDumuvs u4alxomfcootlm  lueo ()s2tr(r iy4apenmnct t  Dumumo;o0opt mf3ils m2umuvs;u4teenio totlmDr n il() rtrxo3nu4lmtnmfvi ( sDrm( poo1texnifciatfa um(vsnt0areoxoctotoa e uvolt0trum(m3oudlmtemfvias s2trxmooo1tlx ifctaslm2eluvo t4teeomoctotomtr ivo;( t2xoxo3iudlltemncta(f rtm( oot0tpx iociad a ean pnt0aetnmo3to1lat aivsls srxoimpiudlltemncilt  2tru  ;o1aeeo o3iyslmDrm( o t4 etoxocoo1laD luvslt  2tm(o oo4lmtnlnetlsfs2trurooo0aetomf3iyd a2eanmo;u4tetoir tadoaD lu ilt0 rur(opnydlm nmicil()sDururoot4ale iiciyd sDum(ms (0tltnmocoadomtelnes;t)seuoxr3iydamee feil() 2ta(  ;t1aptnmoctyd aDumn pnu4texrxr todoaDrluvs;() 2uoxrpiy4oleelnvsa( s2tr(mp;t4aptomociasfs elnvp;t) lxoxo ta1lpteaues;()t2uoxm3iodaltnmnvi (f 2urx  nu0apxnmiciys s umuvpnu0tlenmo3ta1fa  luvo s trtrim3oo1amtnmfeiat  2tm( pno1tlxnmoeiysla2el(vo;(0aeerxrctydomD  i ol( trtmir ny4am nlfcias)a2trur no1apxomi3tytfs umnvo t)aeenir3oa1fpDe u i;(  2uoim3ny1olen fvsas s2ururo;t1tle  i3tatls2ulump;(4texoxr tytlptrlu s s)trxoim3nydopenlictls)srrmu pot4ope mietasfa eanmsnu0aeenxociydlpt  neilt) euo(mpnu1optnmnetasfs2rax p;u4tptn octadla rlu s;t)aleomr3ty1lpD  nvo;s)t2toir3ny4llenlnvtls) rtm(rpoo1aptnmf3tysfa ean pnu) exoxr3tytopDrai o t0 2xrxr3oydlm nlfcsatfsrua( ont0aptnifeiyd s2rau sn()tetnxo3io1omDe i i s0 rxr(r3oodop nlictas aDumumpnu0ole mfciasfmDeau p () eerxf oatfpDraieolt0trumxm nu4ap emnvslt  Drmurpot4oexnioeilt a ua(vs;u0 renif3ta1omtraneo;t) rxrir ou4optnlieta(f Dta( ono1aeenmoeiysfm2ul(mo;(0trtnmfctadoaD anes;(  etm(mpoo4ape lfvsat) rurx p;u0opx mieildfm el( onu0alxnio3oytlmtrauesls)trurxr3nu4ale mnvtlt  Dtmu  ;u4teenifeiytfa rm( p;()tetrxfciy1fp r iei;() rumir3nodoleelnesas aDtm(  no4tleoifciyt s umuvs;t0 lenxo iadfmt luei t0teur(r3iu4ope mfetltfaDua(m ;o4optoiieiat sDuauvs t0tlxnif3tatfate u ols)s2tmim iy4omeelnet t sDua(mooo1aet  i3iys mDrmumo t4arxnircoatlmt ai o ( srum(o iy4apeelfvtlsf Dumxr ;o4alx ifciytla2ea(mpnt) lenifcoydopteauvo;s)setoxm3nodap e nesatfs2umx  nu0teto icilsls rm( s t) renir3oa1fm eln o;(0srtr(rpnu1am emicils s2rax  nu0tltoiociyt mDuaums;u4tlxoxf3tatlpt lies;s  exo(r oydope mfcs sfs2rr(m ou4altn ieiyd m2rlu s u0tleomo3iydop  ln ol( t2tr(r oo4ap emncsa(fs2ta( pnu1tpxo o3iysls2ulnmsnt0aexoxr3oydopt auvilt  2uoxr no1lmtemfvsl(  rtr(moou0tleo f3ils s2emuvs (0tetrir3tytoaD an i;( trto(r oudal n iesatfa2ur( pnu1aee iociys mDea(vo;u4 lermr oo1lmteanvs t0 euoirpoy4lptelivias)artmuro;o1tlxnmietytfm2ua( o;() etnxf3iy1oateaieo t)sexo(rpny4olt mncil()s2urx o;t1tpxnifeilsfaDrmn o u)tltrir3tadla  aivo;s  eurxo iudoltnliesa(farrrxrpoo1ape ii3ilsfmDua(vs u)altoio3tatfatr ieo;s t2urxopiu4al elivs (  2uaum ou0olxoif3iyt m um(vs;(0aexrmrciodomtr uvi t) eto(o3iudamtelivsa(f Dum(m nt4altnioeiysfa elu s u4texrmo3oo1fpteluvi ( srxo(o3iodole lnct tf 2uru pnt1oetoiieiadfaDrmu p u)teeomrcoydop elueslt0t2tmxmpnydlp n nvtat  2rm(ront1teeo oeiadfm eauvs;u4tltnxr3oadfm   ivs t0 rtmxmpnu4altnlnvi t  2umx poo0alenio3tadla2uauvon(0trxomfcoo1la r i o t srxoim nydom  lfcs s sDtmur no4olt mo3iytlm2ean p;(0areoif3todopDrlivo (0teuo(rpoo4aptelfcs tfaDtaur ;t4oee iieiytfm2rl(mo t0teenir ootfmteau o;s0t2tr(r iudamenmnvias) rrrum nu4apto oeiltfm2rln p u0 exrmociadfptranesls  2trxopoo4al elnesa(faDtrxmp;u4opx ifctyt sDrauvonu4 eeomf oodoaD  ues s) 2to(r iodlpt  ieiat) Duax ono1apt  icias mDul(vpnu0 rxomociodoptelivi s)s2uoxrpoo4apt  ivilt aDtmu p;t0aeto f3iytfm2umu p (4alxrmocoo1laDrai i (0t2tr(r3iudal n nvs ( s2taxmoou1tpe  ictysls2elumo;()texrmf3tatlmt aneo;t0 etmxm no4om  miet s sDrr(ro;t1ope mo3iltfs rl(von()artriociydomDrlneil()srxrim oodlm  licil()sDraur ou0optoiictls mDrlnvo u0altoxf iotlaDrlues;s s2tm(mpio4oltnlfcsl()arrm(mpno1alxnio3iltfa rmnvo t)alxnio oadlmD  ues;t0 2xo(mpoydam e ncia(  2rrump;t4tptomociltfmDumnvp;u0 leoiociadfp eauesls0 2ur(mpoo4ole lfetl()srta(m ;o1alx  oeiys s emumpnu)teeniocoodfa rai o ()t2tmxo3iodal   ivta()sDtaxroou1oeen f3tyslsDrl( o t4 rxomr3to1oaDrlu o;s0t2um(o3oydapenlfvilt sDra( pou1aexoiieiat m2ra(mp;(4tleomocoodlm  auvol(0 rtoxr ou4opt mies ( sDumu pnt1aet mi3tyd a elumo (4 exoxf3oytla elnvslt) exm(o3ou1opt  ncil( sDrrx p;o0tptn ietltla2emnmonu4tetrxo3oytfmt lu s;s)sexmxo3iu1ome lfvi t aDtmum ;o1oltn f3ilsls2umnvs;t4areoxo oodomt luvo t0 rxr(mpnudalee netltfsruax o;t4olto ocils s2emnvon(0 rtoio3oytfm e nvs;t)trxr(m3nodolenmfcils srra( p;o0tpen ieiaslmDumn snt) ltoxfcootfpD ai s;() 2xoio3ny1llen fvi sf rrmum ;t4opxnmocilslmDemn pnu0 ltnmo iy1oatrau i;s  ruoio nudlpe lnet (farrm(ro;o4aexo octls a2ulu s;t)texoir totom e n i;()tetr(opoo1lltnlivias) Dtr(ront1tpxoiictytla2ea(vo t4 ltnxf3oodfm rau i s0trxrio iy1alenlnvt () Drrumo;t4oex ii3tas aDrauvsn()trermo3io1opt  n o ( teuoio iy4lme mivsls) 2raumo;o4opt mi3iasfsDrluvo;(0 lxrxrciy1opt  nes;() etrxo3iy4lmte fcsas a2trx o;u4open feiyd mDrm( o u4tltrxr3oydlmtrlnvolt s2um(opnodam e fcia(fsDtau pnu1tlt iocild aDuau pnu)aleomr3to1oatr ueilt)s2urxmpiy4lltn ivsasfs2raxm oo0tle mfciysfsDrln p;(0 leoir3iatfatrln o (0t2tm(r oo1llen nvt ()s2rrxroot0aptoio3iatfsDranvpnt4altriocto1lmDrauvo;t0 2tr(m oo1lp nmfvt (  Dtaumonu4oetnifeiatlaDel( o u) rtrir io1fp  aivi;(0 etr(r iodol  mnvt (fsDrmu ont1opt  ociytlsDem(mo;t0tlxoif totlp  ai slt t2tmio3nudoleelnct t  rtaum ;o0oleo fetyt m2eaump t4tlerir iotfm  aueo s teum(rpnu1al nmivi sfs2ra(  ;t0tlxoii3tysfaDuln o ()trermr oy1fa  lies (0trumir nu4ll nlfei t)sDtax p;o0open feiatlaDrlu snt0arermf tadom e ueslt)tetoxr3ny4ape livsas)aDrr(r ot4tpe mf3iytfm eauvo;t) eermf ootopDeln o t0t2xo(m3ny4oltelict s artm(r ot0tleoifctadfs2uauvonu0 eerirctatlp  liei;t texmxm iy4lmeelnetatf 2rau poo1alxo i3tadla ua( pn(0 lermo3oa1fmtrln o;t0s2xrim3ou4alt  ivsl(faDra( oot0oltnmf3ilsls2rmn p;t)tltomr ootfa   i ils)t2xmxmpoo4lmtelfeta()srrr(r ot0alxo ieildls emnvp;t4 lxoxociodlmD ai s ()srtmxr oodapee ieta( artrurpoo1aet mf3ilt m um(vsnt)aetnirctydoptranvsls  rtr(m3oo1ape mfviat) 2umum ot4tlt iociydlm2eaumsn(0 exrmfciydfm  livi t0teumio3oy4lpe mnet (  2tmxro;t4tlt mfctld s ea( s;t4 rtnxf3iy1omt aueo s)s2xm(mpiodoltelnvslsf rrrum ot0apt  o3tysfs rauvsnu0altnmf oodlp elu s;(0 eur(o oydom  mfes ()sDururp;o4texn feiadfs2rm(mont)tlxnmf ty1omDrlneo;s0s2tr(r3nu4llte nvils a2taumpno0oetnifciysls rlumsnt4 exrio3tadoa rauvi t0srurio iodam  liesa() 2taxr ot0oex  i3tyt m em( p;t4artrmfcootoaDelnvolt0srtrxrpno4ol   ivtatfa2tm(mo;o4oeeoioeiatfa ua(vpn()tlxnmo tytlp eanes s s2uo(m3nydlpt mfct () 2ta(m ;t0olt mf3tytlsDem(mo t0artnio3io1omDraivi;()t2umxmpnodaptnlfvsa(fartrxmo;o1tpx ifciydfmDrl( o;()trermf3totlpDelu ils)srumxo3oy4altemnvtatfa2tr(monu1oleoiietldfaDean p u)texrxocoytfaDelues t  rumir iydol nlfvs tfsrtm(  ;u4olt mf3iat mDuanvs;u4aexoxr3io1fa e nvi;() eto(o iu4lmtnlneta()s2rmu onu0tltomo3ias s rluvo (0alenir ta1omDr nei;t  rxmiopno1amt  fvsas)sDra(m ;t1tlt ioetldfmDem( sn(4tltnxfcoo1om rlueolt)t2xo(r3iu1lmenlfctas aDua(r ot1teeomi3tytlaDeanvo;(0 eeoxrcoydfaDr ivs t)t2toirpnu1omen nvsasf rrmxronu1apx  feiadlsDrlnvo ()trxnir iytoa  aieilt)s2uoxmpio1lpee ietl(fsrurxrpnt1tptn feildfa2rm(mo (0aexoxoctatom  auei;(0 eurirpou4ale liesa( aDraxroot1oltnio3iysfs rmnmonu4trtnmrciadoptr ivo;s)t2to(rpiodaptemfcslt)arumu pnt0tleoifciadlm raumpnt0trtoir iatlmt lieilt  2xoim nudale  netltf 2uau ooo0oltoiieiat a rlnvpnu0areoxf iy1oaDeaivol()texmim3iudlmt  nciat  Drrxmpoo0alx mf3iatfaDuanmo t4aexnxrcoydlpD  ivo;()tetm(o oo1al  lfvsatfsrrmxrooo4aptomf3tas m ranvpnu)teerxo3tatlmt  n sls) exoim ou1optnmnvsl(f rtr(r ;o4apenii3iadls2rm(vo;()artomocoytom eaues ( teumxo3no1lpeemici ()arua(r ;u4opx  i3iat mDrau s;t4 rerxr3tatfp eaivo;s0 eur(o3iu1oltnmfvias  rurxr ou4ope iiciysls2rmnmpnu) reoxf3io1fm rln i;t  2xoxmpou4ape lnet t  2umur ;t1oeenmfciydfa ean p;u0alxomf3iotlp   ivils  ruo(mpoudam   fetat  rrr(r nt0ole ifcildfaDulnvo;u0areoxrcoadoa rai olt0setriopiu4opeemnet (fsrtruront1olx mfcils s eluvp;() leomf iy1lpD lu o (0trxoxm3iy1al nmfvs t srtr(r ;u1olxomf3iysla2rmumon() lxoio3iydoaDelivi () rtmxrpoy4aptn fetl()arraxmpno0tleo o3tas aDua(vo;u0trtnir3oa1omDr neo;(  2umxopiudllee ici (  Draurp;u0texn f3tysls2um( o;t4 rtomrctadlatrauvi () etoio iu4op elfvs sf 2uaxrpoo0oex  f3ild mDra(mp;(4 rtnmo tydfat lieo;t trumxr oydop emieia(  Dtaxr ot4tlx  octldfmDumnms t0aexrmfcty1lmDraiei s  etoxo nodllenmnei ()sDrm(  ;o0tpx micias sDuaumsn(0 renmr iydlatraneo s0sexoir3io1lm  lfctlt sDururp;u1oex iiciytlm2ea( p;(4 rtnxfciatoaDelueo s)t2urirpiydoltelnciatfsrrau poo4tptoiocilt sDraump;u)texoirciodlptraivo;()trurimpiu1oltn nci tfs2uaurp;o0tle  oetysfa el(monu)tlxoxr3oodlm   i i t0seurxm ny1alee fesas  rtrum no1optn i3tysfmDum(ms u0trerxr3oydlpDrlieo s0 etmim iy4olt  fetls  rtmxro;o0altomo3tytfs2rm(vo u4 lenio totlmD  ies t0t2um(o3iudom emfvt t) 2rm( pou0aeen i3iatfaDrm( p;t4artrxf to1fmDr ieo;t)trxoir3iudomeelieta() rtrurooo4tlenmociydfa2emuvp;t4texrircoo1latrli ols  rum(rpiudamtnmfcta(fa2tmur no1aetoiietadlsDrm( p t0artnxr ta1op eln i s teuo(opiydam  lfesas)sDra(ro;u1apxnioeilsfaDrmu pn(0 lenifctatom  lnei t0srtoimpiodalt lfci ()artax pou4teeoioetytfm raumo (4 exnxf io1fpDeai i t)srxoir iodaptemncil()aDum(m ;o1tpxn oeils mDraumsnt)arxnmr iodopD anvilt  rumim oo4oltemfeia(faDra(ro;o4tetnioeiydls ulu snu4alxrmo3oy1la raieslt0s2xrimpny4llte feils arta(m ;u4apeniietldls uln snt)arxrmocta1oaDrlneo;(  2to(opiy1lpt mnesas) 2ta( p;u0aex  oetyd s2ulnmp;u4 rxoio iytfa rlivo s setmxm3nudomen ietas a2rruro;t1tlxn o3iatls2emu s;t)aeenio ta1fat  u i ( s2xoim io1lpe  fcs s  2uru p;u0olenmfeiad sDeauvsnt4artnxfcia1lat  nvs ()sexoirpnudalenmivi s sDumumo;o0optomi3iysfsDumn o u) etrmf3oodlmDean ils srumxm oo1open ict (fsrrr(mpnu1tetoii3ild sDrln pnu4 rtoircoodopDraiesl( sexrxmpiu4ole mivs () Dtau  nu0apxomi3iatfsDuaumonu0trxnmoctodopDrlnei;t srtr(r ny1ol emfvtlt  Dtmxm ot0tpxn ieiys s rmnmo;(4 lxomo3oa1fp  ai ils)seuoir iydoptn nei s)srurumooo1tetn fctltfmDea(msnt0aexnmo oodfm eaivo s srxrxr nydaptelfvil( srtmx  ;t1apxoio3iltfm2rl( p;(0 rerxociatfm ean o;()trto(m oudllt lfesa()s2raxront0ope mf3iytfsDulump (4 exomrctadoaDe ivi t truoio3nudom   nvt s  rrm(rpou4oetomi3tytfa2ra(vs (4trenir3iatopD  u i;( trum(m3nydlmte netl()a2urxmo;o1olx moetydfa2emn ont0aeenxo3to1oaD livo t)sruoim3nodoltnmics s aruru pot4aleo o3tys s2ea( o;()aetrmf tadom eauei s s2trim io4lpee fciltfaDurxr no4tlt  oeiltlaDum(vpnt)tlxrmf oo1fmtelnes;(0 rxmiopoy4ol   fet (f rtm(monu4aexniietld m ea(vs u4trtoif oo1fa   nvs;(0 2xo(o3oodopt  ietl( srtr(  ot0opxnmieiys a ul(ms;u)teeoif3oatlmtrauei s s2xoxrpnodol nlncslt sDtrx  no1olenmoetadlm2ua(ms;u0 exomo3oydomDeai o;s sexo(mpno4llenmics s sDurxro;u4aetnif3ilsfa2rau s;t0areoir tatlatr nvi;( trurxm3iydlmee fesls  Durxm ou4ole  ieildls ranvpn(0alxoifcoadla elivo;(0texmio ny4ll nmiet s sDtaum ;o1tet ii3iltlsDeanvp;u4texomrctadlmteli o () 2xoxm nu4aleelnci (  Dtaxr ou1aleoiicilsfm2eln p;(4 renif oatoatraieslt)truoio3no4lpte ncslsfs2rrxrp;o4tltnmi3iad m2umu p (0trtrifcootlmte ivi t  rur(r3nudaptnliciltfa2trumo;t1tpx  fciat s2ranvp u0tetoir3tydomtr ivols srtmir3iy1aptn ict sf rtrurono1tpe mfctytfsDrm(vpnu)tetrmoctydla  lieo ( trur(o3ny1llenmneia(  rtaumpno0aet mfetytla2eanmp;u0 renir oo1fpteln i ()s2tmimpoy1opt lfei s srum(r ;o0oex io3ias m2emn s (4 renif oo1oatr ues;t teuoxr nudlm nmiesas) Dtaur oo0opt  f3tytfaDua(vo (4tltrmocoytlp ran slt  exmxr3iy4ll   fcsltfsDrrxr ou0tpx io3iys s2um(vo (4arxnif oodfpDe ivi;t sexm(o3oodolt mivil(f 2tm(r ;t0olxn f3tltlm ra(mp;t)tetrif3oatfmDr nes;s)t2xm(m3iu1om emies tfaruaumooo1olxnif3iasfa el( onu4 leoio oa1laD au s;t s2xoxm3ou1altnlnvt t)arrrx  ;t1opx  ociytfs2elu o;u)aeeomocty1fa eauvsl( srur(r3oy4ap  lnvta(f ruaxro;u4olxnmo3iys aDul(msnu0 etoxf oy1fm elieo s0 euoxo3oydal   ncias) Draumpno0tpx  fctadfm2emuvp u4 rxrxf3to1om r ues t t2uoxo3nudap  mivt (fa2ra(mp;t4oeeo o3iytls2rm( p t)tlerirctatfa   u s s0 rxrio iu4am nlfcils)srrrumono4ape iiciys m emnvs;t) rxoif oatopD  ies () 2umxrpiudameemietl(fsDtrumpoo0tpx ii3tytlaDulumo t) lermo to1lp   nvs ( trxoim nudopt  neslsf Dta(moou1texniieiyt s ua( p;u)aexnxfctatlmteanvi;s0trtmxm3ny4lmt liciasfsDraumonu0opxo oetadlm2ean s t4aetrxrcootlpt livslt)t2trir nu4lpenlfvs t)srua(ront1aexnmi3ilt a2rm( p;(0trxnmrctatopDr nes ()tetmim3oo1ll emictat)s2rm(r ;o0aet ii3iydfa el(vs;t4 ltrxo3oadlp   uei t0 2tr(opnu4ale lieiltfs2rmurpnu4tltn f3ildfsDumnvont) lermrcoytlm eauesl(0 rtrimpnydlmeemicil(f rtr(r nu0tex  fciyd sDelnvpnu)treomr oadoaDr uei;(  etm(r iy1lmt lici s)a2trxm ;t1aet  o3iltfs umu o t0 rtnxf totlmD lu ol(0t2xrio3oo4omtn ivsat) rtau  ou4ale iiciydfa umnvonu4alxnxo3oodfa e ivo;(0trumim3iu1ol  mfcils  rumu ooo4oetn f3ilsfsDrlu s;u0 rtrxfcoodop elies s)srurxo3oudlmee nctatfa2umurp;o0tle  ieiyd a rlnmpn(0aexrio3ta1oatrlivs;(0trum(r ou1lltnmfvsas  2raur nu0oex  f3iat a2rm(ms;u0 renxocoadfate neilt0t2tmxm3nydlleeliet (f 2umxr nu4tet mociat sDea(msn()trtnxr tadfpDeaivsls)t2xmir3oy4lmee iesas)s2raxmpno4texn o3iatls2el(mp t)texomfcoytlatelnvolt teurxo3oydamte fetlsfaDumxmpnt4tlen fetas s rauvp;(0aeermrcta1fm eanesl(0 2tr(m io4al e fes ()a2raum ot0oltn octld m eanvs ()treoxo3oatlmDe nvi;(0s2trio nodaltnlieils) 2rrxr nu4olt ifeiytla2emnvo;t)arerifcoy1optrli ilt0 eurxo3nu1om e iciltfsDta( o;u0olenioeiys s ulu p u0tetoxoctodopDeln o;(0s2tr(r3oy4ap nmivi tfsDtrx ooo4ole if3iltfsDelump t4 eerifcoydlpD lu o ( teur(mpno4alt mncta() rurxmpno0altomfciyslm2rmu p t4trerif oadlmDrlnei s  2xrir nu4omen fesa(faDtmu  no1oeen o3iltlmDulu sn(4 rermf ty1fm  lieo;(0t2xoxm3iy4ale  fct tfaDum(rooo4alxo fciyslm2el(mo u4 rxoif oydlmDr u o;t) rto(rpio1ame liviat)srtmxm no4tpt  ictlsfs emuvon(0 rtrir3tadlpt  n s;t0 rxmxr3iudomenmfvt s)s2tmur no4ole iicilsfaDrmu s t0trxrir to1opDrli o s) exmio oo4omtnmfctls  2ur(m ;o1aeeoiiciys aDea(ms ()tetrio to1fptrlieil( trtm(opiu1omtn icia(fsrtm(ro;u1open ieiydlm ean o t) lenxf oatlmt li slt)seum(mpiy1optn nesls)aDrrxr ot4ole mocild m ul(vp u)aeerif3oatlp ran i;(0t2xoxopou1am  lnvs sfs2ra(rpnu4alenioctysfm emu ont4 rxrxo3oodfa e i ilt0truoiopny4lle livi (fs2umxronu1optnio3iytfa rl(mont0 lxomr3iadfa  lueils) rxriopnodlmee ies ()arraurp;o1oex iiciadfmDua( onu0aexnifcio1fmDelneolt0sexmxm oo4ll  lnci ()artr( o;u4oexnmoeias a2em(vo (4tltrmocoa1fa  aneil()s2tm(m3nu4om emfcias)s2urxmono1opxn f3iyd a2emnmsn()texrif3ta1lpteaies;t)seurir ny1optemicta(fs2uaxmpoo0tleoiieildla rlnmpn(4 ltnmo3ta1fatelu o (  rxm(rpoy1lpe  fvi s)aDra(rono4aptn i3tlsfsDrln p;t4 rxrmo ootom elies () 2urio3iydoptnmivslt)arrm( pot4aet  o3tyt aDrmuvpnt0texoio3io1omDrlueslt  eur(m3oodlpt lncta(faruaxr ot1aleo i3iyd sDelu s (4teermrctytopDeln i s)s2xr(rpoodomtemfesl()aDtmur nt1alen ociyt m ea(vpnu0texrxr ty1fat lnes ( sruriopnodam  livt s)arumxr ou4opx  ieiyd aDrauvp;t0teerxo oa1lpDe ieol( seuo(mpio4opte ietatfsrraxrono1aetniieiydfs rln o;u)alenxo3iadfpteli o;( srumxr3oodapte nci ( aDtmumpot4olx ioeias a el(mp ()trtoxf3ootfm   nvi;s  euoxrpnu4ame  neslt  rur(rpno1olt io3ias mDul(msn()tetoio3ta1op raivi;s0s2uo(o3ny1ame mfcils  rrrump;t1tpx if3iysls2rm(vo t)aetrifctatfaD anes t) etrio ou1om elfet ( sDta(rpot0olxo f3iat a ea(mo u0 lxoxoctodfp   nvilt t2ur(mpiu1lmenmfet ( sDtmx  ;t1tpx mietas a eau o;t4tetnxoctydfpD lnvi;s0teto(rpoy4apee nviat  2umxrp;u4tlxo ietysfsDul(mpnt0tetnxfcoo1fmDraivo (  2xmxm iydomt micsa( aDtm( oot1oee mi3tysla ua(vp (4aetnxocia1omt anei t0texoio3oydlmt lfvtls) Drrumpoo0opxn i3iatla rm( o;u4 eeoif iytoaDe neilt0texoimpoudlltn nvt sfaDtrx oou1aee ii3iadls rauvs;u4tltnmrcoadomDrlnvil( srxo(m oo4al nmfeil(  rumu  nu1tetnmf3iyt sDul(mpn(4arerircio1fpDeluvi s)texrir nudap emncslsfsDum(rpnt1tpxnii3ilsls2raump u0trxnmr iotomtraueslt)setmxr3ou1lpenmfcilsf Dtmxr ou4aptnmi3iytfs rmnvpn()trxomrctotopte ueo (0srtr(o iy4oltn icta(  Dtrxroot1altomi3iasfm eln s (0aetnxf iotlpt  uvolt s2xmxo3nydaleemieiatf 2rm( o;u0tleoifeiydls eanvonu)tlxoif3tadfm  lies s0srxrxopoydlm emnvi sf rtaump;t0opx  ietlt mDranms u0 lxnxf ia1om r u olt sexm(m3iydlm nlieilsfarrax  ot4oltniociadlm elnmont)trtoircia1fpD  nvi;t  rxmxmpoy1llte ncil(  Durumpnt4oeeomoctyt mDelump u4 eeoir3iatfmD lnes s)srxrir3iu1llte ictl() rum(  ou4ope iocild s2eaumont0 ltrmo3todoa  anvo ()s2xo(opio4opt  ieils)aDra(m oo4opx ifeilsls2rln o u)alxrmfcio1la elnvi s0 rtrxm3io4lleemfcsltf Draum ;u4altnmoeiyt s2eluvs t)tlxnir3tatfm rauvi t)t2toio iu1ale mnesa(  Dumumooo4apt mo3tadfs2uluvsn(0trxoxr tatfa r n ils0t2xoxrpiy1op emfvs s)arta(r oo1texomociaslmDulump u0 etrxr iatlmt  ieo;( sexm(r3iy4ome mfctl( sDrmxrono0tleomictysls ua(vo t)aexnxr tadfmD  ieil(0srtm(mpiy1ole mnet s  rrmumoou0texo oeilsla2um(vsn()areomociy1fptraivs () 2toxr3no1ll   fesl( arur(ro;o4opeo octys s2rl(msn(4tleoif3iatfmte neil() 2xrxrpnu1ol  mnvi t)sDrrur ;o1apt mi3iysls2umu o;u0aetnirctotfaDrau i;(0teuoim no4lleelfvs ()a2tmx pno0alxomf3iytfs emn o;t)trxnmociydlpDrlnvsls) exmiopio4am  lnvia(fa2umu  no4tex mi3iltfa rmu s t4tetoxr ta1lmDrlieo () etoxo iu1omtnlicias) Dtr(mono1tpxo ieilslsDelumpnu0teenir tatfaD aivsls) exrxo3iydoptelnctl(  2trxr nu1texnmfeiytfmDrmnmp;(4arxrmr iotom ranvo;() rumxrpiy1omt mfcil(fsrtru  oo1olt ifcilt s2ea(mp;t4 lerio3iytlmtean ol(  etr(m3oo4llte fctas arurxmoot4oexoiicilsfm2rmn s;t0aexnmocoatfp   ueolt texo(o io1alt lfetl(fsDtr( pnt0opx ioctytla2uanvsn(0altoio totlaDeai o t)trum(mpoo4ll nlici s) 2umxmpnt0apxnmiciytfs2rm( o u0 renirctotlp   uvs t) exmxr iy1lpt  icta( sDta(m ;u4oetoiieild m2eanvs t0teeomr ia1lmDranvslt0tetmxmpoy4amtemietatf 2taurp;o1tlxomfetyt sDrlums u)texoxf totom   ueo ()tetoirpnudomen fvtls  2tr(rono0aeeo i3tysfa umuvs t4aetnircoodlptrai olt0 rtoxo3iodapte fetas  Drrxrpot0aet ifciadlm emumo u0 leoio3to1lpt lnei t s2xr(o oodom   fvt t a2tr(  no1aee  fciyd s elnmsnu)texomf io1fpD  uei;s)t2uoirpiy1ap elfciasfs2raxr no4apxomfeildfm2eanmpnu4aexomo oo1op rln s (0 rtmir3nu1omtnmfctat sDrmu p;u1tptnii3iytfa2uanmont4tlxnio totfmDe ues;()sruoio3iu1ol n fei s) 2rmu pnu4oet mf3iltfa rln o t0tltnxo3tydoat ai s;t)setoxm nu1altemncsa(fsDrmx o;t0apeniiciltlsDea(vpnu4 etrio3tadomteaneo;t sexr(opno4alenlfei () 2ua(rpno4tee moetytla rlnmsn(4altoifciy1fa  li ol(0s2trimpio1al elivi sfarrmu o;u0tpeomi3iysfs elnms t0 etoxf oadfaDrli s () 2trxm3ny4al emnesatf Dur(mo;t1tpeo feiydls emnvp u4aetrxo totom   u o s)srur(r iudom e nvil(fsrua(rooo0aleoii3iydfmDeau p;(4aexrirciotoa e neo;s) rxoio3iydomenmnviatf 2raxmpou1ape iieiytlm2um(mont4 lenmo tydom eaneo s)srumxrpoodlltelicias aDtm(root4oeenmoeiydla ra( o (0 exnxfcoodopt au ilt) 2xr(r3nodoltemivi t  2trxrp;t0altn o3ilsls2ranmo;u)texrif3iodlmteau s t)t2xm(r3io1openlics t a2tmxmont1apto feiad m2em(vo;(4 etnmocoydom eai o;s)s2toim nu1altnmnet ( a2rm(mp;o1olx mfeiltlm2eauvsn(4 etrif3iodla  livi;t0 2um(r iy4lp  mivs s) 2trur no0apxniociydlmDrlums;()aleomoctytla  an ols)trxrxm3iudlpee nct t aDta( ooo0aeenmi3tldls uaumsn(0tlxrircto1om rli ols0teur(r oy4lp elivsl(farrr(rp;u0ale miciyt a ea( o;(4aeerxo iadom r i slt srtoim3oo1ole mieiat  2raxr ;o1tlenioctasfsDran sn()arxoxo3oodfa  liei (0truoxo3oydol   fvtas)sDrrxr nt0teeo ieiyd sDrl(vp u0aexomocto1faDelivs;(0 exr(m oo4lp   nvsl(f 2ur(rpot4aleo oeiytfmDeaumo t0 rxrxr3ta1fm   uvi s)truoim3no4omee feias  rtaxrpot1tee mocildfa2ua(mo;u4aexnio ia1fm  aieo s sruoxopoodlm nlivil()aDrmu pot0aetnii3ilt a2rlumpnu) lermrcootom eauvil(0 exmim iy1lm  mieslt arrmurono4tle iieiytfaDemn pnu4 exomf3iydlat anes;() etr(m3iydoptnmncsls  2trx  ou1tex if3tltlsDumnmo;(4 etnif tytomt aivils t2ur(o iu1al n fetl( sruaurp;o4tltnioctadls ranmp t0 rtoxfcoa1lpt auvsls)trxr(m oydomtnmictat  rururoot4oltoifciydfmDelnvsnu)treoxo3iodlp r ieo t srxo(opoy4lme lfvsa()aDrr( pnu0aetnmi3iltlsDrmuvs ()aeerif ty1opt aivil()s2ur(r3no1lmtemfvsa() Drmxm nu4opxoifciyd m2rmumo;(0 leoxf oatoaD au olt) 2xrxopoy4al e ncs sf Drr(m oo1oee ifeiydfa2rmump;u)areoxo3iytomD an o;t seumimpoy4lmee ivia( s2trx  nu4altnmo3iltfm uln s;t) exrif3oydop rlivi;() 2toio3iudal elieia(fsrrrxmoou4texn ieiyt sDrmn p;(0arxomrciy1fateanvs t)teuo(o3no1aleemnvsl( aDua(mpot1aleomociyslaDranms u4aeeoxf3iatom rlnes (  rtm(r oy1oltn ncta(fartm(rpou4aet  icilslaDulnmo u)trerio3to1fa  anes t0 rtoio3nu4lme  ictat  Drm( p;u0oltoifeiatfs2uln sn() eeoxf3oodfpt  uvslt t2trxr iy1oltn icils)a2uau o;u1apxo i3iat aDrmuvs;(4altoxrcio1opDrlneils0 2xm(m3io1llenmnvsl( aDrmu o;o1olen ieiydls rlu o;(0arenxfcoy1la e ivs;s)srxmxm ny1oleelnvs s)sDtmu o;o1ape mietltfs2rlump;t0aexnmo3iotlm   n olt)srumimpoydap elfeil(faDururono0altn ictytls2rmnmp;()trxni
\ No newline at end of file
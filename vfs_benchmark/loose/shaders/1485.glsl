@@ -0,0 +1 @@
+ues;( trxoxrpoo4lpeelfvilt)srrrx  oo0oexo fetldfmDul(vont)aetrmrctytfp ean i (  2toxr iy4amte fvt sf rtrx  ;o0texo f3tadfsDeauvonu4 rtomrcta1fa elu s s)tetr(r iy4llt  ivt t) rtm( pno4aet ii3iysfs2ulnvs u) eenmoctadlp   nvs t  2um(o3oy1apee nvsls)a2rr(r ;o0oleomo3iyd m em( s;u0trtrmfcto1op   ieo;t  etr(opoodaltemieslt  Dtrx  ou4oltn o3tys aDem(mo (4tlerif tatfa  lu o s seuo(opiu4lmtelivias)srrr(mpou4tptn fcild mDulnmp (4treoio tytfp ran o;s0 rtoxr3io1apee nvta()aDrmxr oo1oexn f3iydls rmumpnu)tlermo tadlmD ln o;s0srurimpnu4lp n fvs t)a2tmumpnt0alenifciyt a2emuvs u4teenio3todfmDe uvi;( srxm(mpnu1al  mietasfa2ta( p;o4tlen f3tat a eanvonu4 exrxocoa1la eanvi;t0srxrxm3oydom emict t  rraum oo4apt mo3iys aDrlu sn() renmo todlmteaneil()s2trimpiy1ll nlnct tf ruaum oo4alxo f3tlsfm uanmpnt0artomf tadlpte nvs ( srtoxm oo1lm elncs ( srtruronu0altoiieiyd m uluvo ()altnmf iodoa eln s t0seuoim iydalenmncsls sDtmuro;o1aexomf3iyt aDrm(mp u0alerif3oytfat livils0teumxr ny1amenmnctlt)a2raumoou4olx mfciatlm2ua(mo u4altnxf ta1omtraueolt0trum(r3nydlpt liesltf rrruroou4olxnifeiaslaDrlu s;t0 rtrmf3ty1la e nvi t  rtr(m3iudopt mnvil(fsDuaurp;u4alto ieiydfa rmuvs;u0 ltnxr3ty1fatr uvo;s0 exo(r3oo4am e ietls)sDtaxmono1tetomictlsfa ua(mp;(0tetoxf oa1opDeai sl()srurimpny4opt  net ()srrmurpoo0oltoii3ild m rlu s;u)aexoir oatomtrlu slt0s2uoim no4omen nctat) ruax ono4oexoiieiysfa2rln s ()arxrir tadfptr nes s)t2uoxr3io4lpen neta() rrmu oot4tetoioctltla ea( ont4 lxrif iotfmDraieols  exmiopny4opt mfvi t srta(monu4tpxo ieildlm2ua(vp;u) exrxrciotoaD  n o t)srumirpiu4llt mnvsa() Drmumpnt4aexoif3iytlm rmumsn() reomo iy1faDeli olt) rurxo3ny4ope lfviat sDtaurpnt0tpxoifcild a2rmu snu4tetnxf3io1omte n s;t texoxopoo4lp  mivtas  2trxr no0ope ioetytlm2rlumsnu4teermrcoatfmteai i;(  eum(r3ny4ll  mics s) Dtmur ;u1apt ii3ils m2el(vo t0altnmr ta1fptr u ol(0 etoxr3iy4lmen fei t)a2umu  ;t0alx  fetltfaDran s t4altrio iadoptrlneilt)srtmiopio4apt mnvsasf 2umu  ;u4aet mo3iydfsDuluvs u)areomo totlaD aueslt0sexmim3ny4lp n fcsatfsrrmx pnu4oet  fciasfm2ul(vp;t)trermo oa1lpD ln i ( s2xmxrpnu4lm emfetl( aDtrumo;u1teto f3tys s2eau p () etoxrciy1fpt an s;s)srtoxr ny1apt mfesasfs2rm(ro;t1oeen feiltfa2umnms;()teermr3oo1optelu i;(0s2umim oodop elietat)aDuaxmoou1tex  ietydla rm(vs (0tlxrmfcoo1la   i il()tetrxopoy4am e icsl() 2rr(root0teeoifeiltlm2eaumpnt4 etomo oatlp  luvi;t)s2trim oudlle  fcsl(fsrrru  nt0aeeo ieilsfa ran pn(0tetrmociadoa eluvo s  rumim iu1lp emfvilt)arua(  no1oexoif3tydfs emumo;t)trerif iotoa eauvslt0s2xr(o iy4lm  lfcslt  2tm(rpoo1tptoiictytlm ran pnt0trtnmo3iatfaD lneols)s2xmxrpno4amtemictat sDtrum ;o4opeomfctyd m2eaump;t0 exrmo oatomteluesls0 2xmxm nu1altn net sf Drrumooo4tpeomictltfaDeluvon(4alxoio oytlptrlivils srtoio nodopee ivils aDrrx pot0tlt io3iltfa ra(ms u4 exrmrctytfmt auvi;t t2urio3ny4amtemnetl(  rtaur ;t4optnioetadfa eau ont0texoxf oodfm e nei;t srum(m ny4omte fvsls)aDrru pou1aexnio3iydfs2um( o t4artoir3oodlm  aies ()t2xmxo iu4omt mneslt)sDurxmo;o1texomoctatls uau ont4 etrif ootlp raueo;(0sexo(opoydlme lfvtltfarraump;u0opx  ieildlsDrauvpn(0arermfciotfmDelivs s)s2uo(mpiodol e ietl(  Dua( p;u0apeo i3tadfaDelnvo t4altnxr3io1fate uvils)setoxmpny1aptemfcsl() rumu ont4alxo icildfa2elnvpnt)artrxf totoa r u slt0 rtm(opnu1op nmfcilt) 2rmxrpot4oet if3tyd sDeanmo;u4tlxoifctatfaD  n s s t2tmimpnu4omenmfeslsfsrtr(mooo1olxn fctls m2umn o;t4aexrxr oa1lpt  nei;()srxoxm3iudomtn nvt t) Dtmurpou4apen octldlsDuan ont4treomo3oydom eau i s)t2xrxm3nu1olt  ict tf 2tau p;u4olto icilsfa2ulums ()tltomf3todlp raues s)trtoxm3nu4omtnmivsl() 2tr(mpot4tee iociatfaDumnms t0 rxoxf todomDr nesl(0 rur(r3iydaptnlivtatf rta(rpnt1oetnmi3iys sDumnvo (4 rtrirciadlp  ai s;t0teur(o3oy4apte fvi s)s2rmur ;t0aptn ieild sDum( snt)aetoio3oodlp eln s;s)sruoxo3no4lp emnvilsf Duaxm ou1texo o3iytfa uau pn(0arxnxocia1opDr nvo () rtmiopiu1lle mfvs s) 2urxrooo4opt  i3iys mDuanmo u4alxrxfciadfaDelu sls) 2toirpiodopte netas)arrr(mpou1tpxo oeiasls em( ont4aetoiociadomDraneo;t  etrxo iydlp  mncsls s2rmumpot4tee mieildls em( o t0 lenir oadoaDeauvi t)srur(mpnu1ol emiei s) 2tmx p;o0oetomfeiytfaDrl( s;u0 leoxo iydlmt lneilt)t2ur(o3nu4lltemiciatf Dumxmooo4oltniocildfa2uauvpn()aetrxr3to1fmDrai ols) rxrxrpiy1opee ivsls)s2ra(moou4oexomictyt s2rmu p (0arxrmr3oy1fpDe ues;()teto(r3oo4op  mfeiatfaDtmxrono4apen fctyt sDumuvs;u4trxnmf3ootopDe ieo s) 2um(mpnu4oleeliei tf 2tmump;u1apxomfciyd a uluvs;t4tlerxr3oy1opDe nei ()teumxrpoo1lmt  nvt sf Dtru  oo4tetnmi3iatla2ua(msnu0tltoxf3oo1opte n o;(0t2tmxr nodom  lnct s  Dumurpou4oeeomocildlsDul(vs t) rxoxf todlpteln s;t) rxo(opiy4apeemfeias)aDtauroot0aeeo ocildfaDul(vpnu4 exrxo3io1faDran i;(0 rtrir io4omt  feta( aDur( o;u4oee moetytfaDul(vpnu) lenir ta1fate uei s  2xrxopoo1om elict t arrrumoot1aee  fctld m2rl( o ()tlxrio iytoaDeai s;t0 exmxm no1lltnmfes tf Dtru o;t1tpenioetatlmDulnms u0 rtnif3todlp   uvi s)tetriopoo4lpt lfcil()sDum(mpot4teeoii3iysla emumo;(0aeenmo3iodfaDrli ils0 rtm(mpio4lleelnvtls sDtr( pou1tlx mfciytfsDrmu s u)texnxociatlmD  iei s0 rumxr3oo1lmte nei tf 2umu  nt4tlxn octldfmDrmuvont) lerxfcoo1lm elivs () rtmxo oodapt mict ()aDurx  nt0olt mietadlaDrm(vpn()artnio3oa1fp e ivilt0 exrxm oo4olenmfetl( a2rmx o;t1aee  o3taslsDea(vo (4alerxo oodom  lnvs t0teuoir oo4amt livsatfarurumooo0tpx io3iatlaDrm(vo (0 etomo oydfp r neilt t2ur(mpnydolte icsatfsrtr(  no1ole ioeiatla2eauvp;t0 exriocta1la r ueo (0texoxopoydol nlfvs () Drrx ooo1apenmfctas s2rm(vo;u0 rtoircoadfa  livs;t srtrio3iu1oleelfvtatfs2tmu  ;t1tpe  f3iadlaDum(msnt0teeoxo3tadopDeluvolt texmxo ny1ll n iesl(fa2urxm ;o4oee  oetldls eln s u0 lxnxf3totoa rlivslt0 euoxr ny4al e icias)arraxr ot1aet moctlsls2rmnms;()tltnxocoa1omt au ilt)tetrxo3iudapt mnvtl(fs2rrurono1apeomicilt s rauvs ()texrmo3ia1fpte nei s0t2tm(r3iu1amtemnesl()srraxm ;u4alt ii3tysfmDeluvs u0trxnmf iy1laD aneo t srtmxm3nodll nmnet t  Draumo;t0oleo ictatlmDuanvpn()alenxo3to1fmteauei;s s2umxmpny4lmenmnvs ()srtrxrpou4altn i3iaslaDuanvpn()alxnio3totopD li ils tetr(mpny4ame  nvsatf 2tr(rpnt1tpeomfctlt m2uluvo t0areoif3oytfp eanvsls0srxm(opiu4op emfcsa()aDraxr nt4aleoifctysla2em(mo u4texoxo3ty1omDraies;t0t2tm(m iy4ol n ietls) ruau poo1tltnmicildls ulumpnu)aleoir iotop ran ol(0truoimpnu4om  lnvsa(farra(m ;u4oee ii3iadfs2ul( o u)tlermr iotomtr u s t seuoim oo1opt mfetas)a2tmurpou4tlt  ociyt a rmump u0 rxoxf iytfp rlnvi t texmimpiu4lmeelnvi t a2rmxr ot4texomfeiltfmDemn p t) ltnmf ta1fpDr i i s0 eurxo3io1am  mnes s) 2ur(monu0oltomi3iytfmDumump;u4alxoirciadfaD lnvi s)srxrxr io4amte neiat) Dra(ro;u4optnmo3iyt m2rl(mpn(0tltrxfcoytfmDr ueol(0s2uoio3ou4am  mneils arumumpno0aeen o3ildla2uln o;(4arxrxoctadfp   ueols  etoxo3ou1om n ieilsfsrumurooo0oleo ietadls em(vsnu4tetnmfcoo1lmteauesls0texoxo iydoptnlivil(  Durur nt4tpxnioeiltfs rmnmp (4 etnmrciy1fpDeanvolt truo(m3oodlp elivtltf 2ta(  ;o1tpt ioetlsfs um(vs;u4teenio oydop e ivi ( t2trir io1ole mivi tfa2uau o;t1apxomoetltlaDrmnmpnu4teeniocia1lmte uvilt)setr(r3no4opee fvta() Dumxmonu0alt mo3iasls ua(vsn()texrioctatomtraivi;s0s2xmio ou1lmtelictasfartrx oot1aeeoii3ild s2rlu p;u4tlxnio3tadfmDelu i s)texrir iy4lptn ivtlt)sDuaxm nt4ole ifcilt sDumn o u0tltnxo3tydop  lnei t)t2tmxm3iu1ll   ivsa( aDta(ront4opx iieiat a2rmu o (0teerxo tydfmDr n il(0t2trxo3nudoltnmneia() rtm( pnt4aetnio3tlslm eauvpnu4 leoif tydlmDr ueolt)s2xoxm3no4amte fvtas)a2rrxm ;t0tpt  fciysla uauvsnt) exomo iadfpDr i s s0srxrxr3io4amt  icsl()sDrmur oo0olxnio3ils sDrl(vp;(4tlxnio3oodlmteai o;t)t2xoio3oy4om elfei sfsrua(mooo0tet mfctydfs2ra(vp t4 ltoio tytoa eaieslt  etoir3io1amtnmivsatfsrtau  nt0oeto i3iysls ean o u4areoxocto1fatr ues;s)srtoxm oodlm n ictasfarrm(  ou4ole ioeiltfm eluvp;u4arxrxocoydoaDr nvo;t seumio nydlltnmnvs ( s2tau ooo4alxnmfeiasfm ra(vo;t)aleoifcoadop elu s t trumim3iudll  miesatfarumx o;o0tlxoio3ilsfm elu s;t) leoxo tytfp rauvs (0srur(rpnydoleemncs t)s2umxm oo0aee  ietadla um( o (4arerxf totoa r i s;t s2xrir iy1lp eliei sfaDrau ont4opxomoeiasfa2umnvp;u4aetrxocoatlatean ol()trxm(o3nydop   fvtas)s2trxm nt1tetomf3iyt a2eauvp;t) lermrctodopD au i;s)t2tmxrpiu1lp emncilt) Duax oot4tptnmiciltls ulu s;t)trxnmf oadom raivi;()sexoiopnodal nlies ( srraurpot1tle mf3ias aDulump u0 etoxf ta1lptelnvs;( srxm(mpiy1oltelici s aDtm(  no1tleo f3iadfm ulums;(4aetomfciydfp  an s;s) rumim3nu4ome  ivs t a2tmxrp;u4ape  ieiydfm ulnvo u4trxnif oadfaD lneilt)seurxo3iu1optnmfetls  Dumuro;o0alenif3tltlmDuaumpnt4arxrio tadfa r u i;t s2xo(o iy1omtn nvt s aDum(mono1aexnii3iysfm2um(vo () eenmo iotfaD luvi s0 rxr(rpnydomt mfviatf Dra(rp;t1apt ifcils s rm(vs;(0 exrmfcoa1omDrluvo;(  rumxr iy4olt  ivsat)srrmum oo0apx  oetadlsDranvo;() eenif3oodlaD au il(0sexmxr3no1ol elnvi ()srrrx  ou4oetnmieiltfsDumnvsnt0aleoxo iydfm r ieil(0truoxr3iu4amtnmfesls) 2tr(  no4aeen octydla umnvonu0aexoif3iadop   uesl()s2tm(r3nodopeemivs tfsDrmxrooo1apt moeiltlmDean p t4 rtnxo tytfp rlnvi (0texmir3nodomt lfcils aDrmxrpnu4oet  iciydlm emuvsnt)aetoxo3iatfptr nvs t)sexm(rpny1ale mnvslt  2taur nu4apxn ieiad mDra( s;u) renir3tydfaDrluvi;t  eur(o nudopt lfcsl() rrmxront4tpeoioeiadls2elu ont)texomf iodlptrau il( sruoxm3nu1ap  lnvta() rrm(ro;o0opt mi3iltlmDua( o (4alenif ootfa e neo;s) ruoxm3no4olen ncias s2ta( oou4opt io3ias a um(mpn()tetrmr oadfmDr nvs t)srxrio io4op   nvil(f Dtmum ot4oexn feiydfs2uluvs;u)trerif3oodfm eaies;s) rum(m3oy1oltn ncsat)a2raxm no4tleomfeiyd s2ran p;()aexrircoadfat anvs s0s2umiopou1oleelnesl( aDum(ro;o4oee  fciytlaDea(vp;u0tlenxo ta1lpt  iei;( tetoim oy4ll nlieia(fa2trx oou0oeenmo3tydlm2uluvsnt0 lenxr tadoaD  nei;s  rurim no4omtnlivs t) Durxronu4tleniictyt mDumu ont4aexoio3iy1oaDeauvi;() 2xo(r oy1lm n netlsfsrrm(m ;t4opxn fcilsfsDelnmon(4tlerio3ta1fpD lu ils0srtr(r3iy4ap  licil(  ruau oot0oetoiieiydfa eanvo;(4tlerxociy1opDean o ()t2xmxo ou1optemictl(fsDtrum nu0openii3iadlmDeaumo u0 ltoir oadoa rlnvils)trtrio iudlmenmfvtlt a2urxro;u4aptnmoetaslaDea(vsn(0 ltnxo3totom   ivs s) 2xmxr no4lle lneilsf rtaur no0tlxnmi3tyt mDeau p;()tetoxo3iytfa eaieil(0srtr(m iy4ale lneiatfa2trxr ou4tpx micilt a rl( p u0texnmoctydfmD anes () rto(opno1ap nlivtat  2rau  no4aeenmieiadla2uluvs ()trenmr iydoatr i s;()teuoim ou1omenlncs s aruru poo4teto ietyd sDrmn s (0 exnif totla  luvs;(  exr(m3ou4al   iesa()artr(mpoo1aptomieiytlmDrmnvp u4aeerxfcta1lpDe uei;s0 rtm(opoudamtemfeiasfs2rm(rp;u4tpxn o3iydlsDulumo (0texrirciadfm r n s;t0sexmir ou4alte nesas s2umxm ot4optn ietad sDelnmo;t0 ltnif3iy1faDelu ilt)trxr(m nu1llt mivta()s2tr(r ot4tet mfctltfa uan p u4 exomo3iy1om eau i s t2uoio ou1al n icia() 2rmu pnt0tpxniiciadls uanvp;t)trerxf3tadlaDrlies;t0texrim3no1om   iviltf Drr(mp;t0oeeoif3iyslm uln pn(4aetnif iodlp ranvs s)trxr(opiu1ll  lnet t)srrmxmo;u4apxoif3ilt a rmnvont4 leoiociadfptr ivo;t)t2xoim3oudlm elfvt ( arta(r nu0tlxomieilsfs ranmp (0 reomf3totom r n o (  rto(m3nu1am n nct ()a2ur( oot4aeenmo3iyd m ua(vsnt0 rxnxf3iydlp r ivo;( s2xmxo3oy4ap elnctas) 2umx pnt1aet iieiysfsDum(mo;u0tltrxfcta1fa e i o t0trxoxopnydalee fci s a2tm(moou1ope mo3iadfs2umu s (0trenifctatfpDrlnvo;s0 2xr(o3oo4amenmfetat)sDraxr nu0olenioetltfs rmump ()arerxf3iytomD aneilt0tetrxm no1om emivsat) rrrx pou4opx  ietyslm2el(vo;t4texrmr3oa1om ean ilt0 euoxm iu4alte ictlt  rurumoot1oetnmfctatls2eau s;(4aetnifctotop raivils texmim3iy4aptemfvslt aruru ont4tltnioctyd a2emnvo u)arenif iatopDeanei t)t2xrim3io4altnmfcta()s2taxmono1teeo fciatfsDumnvo u0alenio ootoatrlu slt trur(rpou1ope lfeils  Drrxroou0tltomoetldfmDem(mo;u)tltnio tytfp e i s t0t2toxo3nydopen icta(fsDrrxronu0ole mi3iyt a2ulumpnu4 etomoctodfp rai s;( s2toxr oo1optnlnvilt)sDurxmpnt0tpe ioetatlsDemump u4artrmo oy1lpDrlneo t  eumim3no4oleemnet t)srtaxm nu4tlt iicildfsDea( ont0 rxnmf3todlaDelies ( s2toimpiudlptnmfeslt s2umxro;u4oee mfcilsfm2uanmonu0teeomr oodlptelu sls  2tm(m3nudam  lnctls)a2urumpno1opx moeiadfmDumuvo t4arxnircta1lp eaneo;s)seumim nodom  mncilt  rumx  ot4opeo feiydls2ulu o;(4arermociytfpDe uvo;t0 2uo(m3iydapt mnei ()a2rr(  nu1aet if3tadfaDrmnmsn() reomf3iadlpt anvo t)t2uo(opiy1al  lfesat  2rrxmpnt0tet ifciydfmDelnmont) rxnif oy1fa   iei t teur(m3iy1ape  iesls)s2rmu  nu1tpxoioetldlm2ulu pnu0trxoir iotlpD  i o;s0sruo(m nodllenmicsat s2uaurpou4opto i3tydla2um(mpnu4 ltomr3tatopt aivs () eumxo3oy4ol nlnvt (  Dtr(rpnt1olenmoetlslsDumumsnu4altnxo iadlat livs s srtr(opoo4op e ieiasfaruauro;u4teenmietat s umuvo;t0 rerif ia1fmte ivi;t0t2uoirpiy4ame  nei t  2taxm no0oee ioeiasls2ulnvo t0trxomociotoa   nes;t)s2uoimpoy4om e fvi ()s2tmxm no1oleoiieiys s ra(mo u4 eeoxf3iytoateln o;t0teum(r3ny4lmte nvilt  Dur(moot4apt ioeildfsDranvp t) rtrio io1lmtr n s (0t2to(r3iodllt  ics ()arra(roou1aptnio3iaslsDrmn ont) rxrmo oadlp ean s t0trtmir ou1apt  fcs s a2tm(m no0opxnmf3ias m2ulnvsn()aeeomoctotlpDe iesls0setrxm ny4lmenlfvsat arur(r no0aptomo3ild m2uln sn(4 lxoio3tadlat auvo (0sruo(mpiodomenlicsls a2rau pot4open octlslsDumnvp u0trenio3oa1fmtr nvo;t)t2urxo iy1ame lncsl() Durx pno1opt  oeildfm2ea( s;()alxnif iotlat lieolt)sexoio3iydlmte ieilt sDtrur oo4tlxo f3iadfm2ea(mont0trxnifcoytlm e nvs;s0srxmxr oodaltn nvia() Dtrxmp;o4tpxoifetys aDra(ms u0 reoif3iydfm  lues (0srum(rpou4omt mfvtat)sDumxm ;u4tpeo fctltla2ulu s u0tlxnmrcto1fateauvi ( t2ur(rpiy1lmtn fvtat)artax pnu4olen ocils aDrmumo;t) etrxocoa1lpt au i (0sexoim3iudll nmfcta() Dta(m ;u4tex  fciytfa2uauvsnu)artnirciadfptr ivo;(0t2xmim iudolteliciat)srtmumoot4olt  feils mDrl( s;t)tltnmocto1om  lnvslt texmir3iodop elfes ()sDtrx ont4apeo fctls m rlumont4teerif ootoa e n il()t2uoio3oydll nlictasfsDumurpnt1aeenmieiydlm eanmo;()areoirciy1faDeaiesl( sexoxm io1omtn netat)artm(moou4teeoif3iasls2ra( o u0 lxnioctodlm eaiei;s) euoim3ou4lmtnmfeta()srra(rpno0tlxnioctytfm ra(vp;(0artoif ia1laD  ieols0 rxo(r ny1al nlivia(f Dur(ro;t1aexnifctas a ulu s;t4 rtrircoadoa  anesls0s2tm(o3iydlm nlfct s sDtmx oou1aptnioetydlm umn pn(4aeeoxr3iodfmD luvo s0t2tr(r ou1omee iet s) rurumpnt4opeo ieiytfa2ua(ms (4trenxr3oy1lmte ues;() 2xo(r3nodlmt  ivsat)a2uaum ;o4tpxnmociad mDrl(vp;u0 rxoxf iy1op eau i;s srxoiopoo1openlncs s) 2uaurp;t0texnmoeilsfaDrluvo;(4 rtrir iydop  aieo;t0t2uoim oo4alee fesat) 2urxmo;u0altn oeiatlaDrlumsnu)aetrif3tatoat anvil() 2uoxr3iudopenmncsl( aDtmumoou0olxnioeildlaDemuvs;u)trxrmocoytoa elnvs t0t2xm(opoo4omtemieias)srraxmoou4tleo fctas sDrm( ont)aetrmf oatoaDranvi s t2urir iy4oleemfeias  2taxmpnu1alenmfciytfaDrmuvo t4tlermr3to1oa   ueo;(0 exm(opnudlmenlivt () rrax o;o0oeen ietad m ranvo u4arermr3oydfa  livsl(  euoxr3ny1oltelfcils)aDur(ro;o0teto f3iytfs emnmonu4 rxrxfctatlm eln i;()teuo(o nodape lieta() 2ua(mpot0olx iociys s ra(mp t) rxomr ia1lmtrau i (  rtoxm oodlpe mnvtls  rtax pou1tet  oeiytfs uaumpnu) exrxrciydopte ueslt0 2tm(o ny1lmtelnci s a2umu o;u1aeeoif3ildfsDranvo;t0aetoxocoytom eli o t)sexo(opoodoptelncta() Dtmu  oo0oleoioeilsla2rm( p;()tltoxo iy1faDr iei t)srxr(rpoudolen nci ( aDrrx pnu0oexnmf3tlt aDeauvpnt0 rtoxrctatfm eai ols) ruoxm iu1llen fcsltfs2rm( p;u1optniieiyslmDrmnvo;(0 etnmfcio1lp eaneol( s2umxmpny4amtemfci (fartmx oou1aex  ietasfs2ea( p;u)aetoxf3iodoateauei t srumxo oo4amt  ncsat  rrru pnt4ope if3iyt mDemu p;t) ltnircoodla eau i (0 rxr(r3nu4olt livtas a2ra(r ot4aexn ieiatfaDua( o t0trxoif3totlmtr n i;t)seur(o io4llt mfvilt) Dtax pno1oeto oeilslm2rluvp u0tetnmo3tatom r ivs;s0t2urirpoy1op  lnvsas)aDur(rooo1altn feiysfs2rlnvsn(4arxrxr3todoate neolt0 2tmxmpnodol e iviltfsruaurpnt1opx ifcildlaDelnmp t) lxoio3iytom  lieilt0trxm(m3nydlm nlnvtl(fsruax pnt1oeeomi3tyd s uln snt4artoxo3ia1fa  anes;s0 2xmxo no1am nmiei () 2rmxro;u0tlto oetaslsDulump u)aetnio ia1fat anei s)sexo(opiodap  mnviltf rtrurp;o4oexnmi3iydla2ulu s (4 exnmo oa1fat luei;t)sexoio3oy4omt  fvsa(farrrxrp;u1oeeomo3tldfsDem( p () rxomo3iodfatrlnvi;t0texmiopoudameelncia(  rtr( o;t1oeeo i3tad a2eanvont4 etoir3oa1omt lues;( srxo(r3iu1ap nmfct tf Dtrxr oo0oee  i3iysfa uaumo (0tleoxocoytfpDe u o s teto(r3oy1lltnlncs s) Dtauro;t1tltoiieiasfm eln o;(4 ltomrctotfptr ivo;( trumim3nudomenmivsls artm(  oo1aet  fctld m rmn p u0aetoxr3tadfpt luvolt0srtr(r iudap   icsls  rtr(r ot4tpt ifctysla rl( o;t)aexnmf oadfm rai o t)s2trxo ou4apt miesas)artmump;t4apxo o3iatfa rlu p (0 ltoif oadlp ran s;t0trum(r3oy4optnlncta( arrr(ro;u1tetn octldlm2rm(ms (0 rxnxf3iodfmDrlneilt  2xo(rpno4lmt lfct (  2urxm ;u4olt moeiatlmDulump u0 rxnif3iy1opt auvols)s2toxo3oydlmtn fes t)s2uax  nu0oetnmiciytlmDumu p t0 etomr iotomDrauvil(0 2uo(m3iu1amen ivil(f Dum(m no0tptomf3iys s2ran p t4tltoir tytlatrln sls0s2trirpny1ll nlnvsa(f Durum nt0apx  octatfm2um( o u0altoir iadomt luvs t t2tm(rpnydopenmfcia() rumxro;o0alx  ociydfsDel(mp u0tetrmo oytopDran ols  2xo(rpio4ll n ieiat)arta(moot4oeenii3iad a2ranvsnu0alxrmr oa1fate i o t s2xoim ou1lmt mnes (f Duaumonu1ole mi3tydfsDelnvp;t4trtrxociotlaDrauvo;(0teto(mpoudlptelicia(f Dtmu  ;t4aeeniieiltfsDrm( s u0 exomr ootop  lu i;t  rto(m3nudlltnmivtls sDumurp;u4tltn o3tadfa em(vs;(0trtrio io1fpD  nvo s0teum(o iudlpeemics ( aDrax  nu1aptn feiatlmDul(mo;t4 renxrcootfp elu s;t0s2tm(m3oo1op emncta()srrrx p;o4tle iiciytlaDem( onu4 ltrircoytoa r n o;t)trxrim3io4lmt  ivsls) Drmumpoo1texnmoetytfmDeauvo;u4tleomr3oo1laD aivi;t0 2xmxo oy4ap n fvtlt)a2uax  ou0tpe mictasls2rmu s;()alenmf ty1omD anvilt)tetm(rpiu4llen fvi sfartaumpnt0oleomo3iltla2rmnvsnt0 rtrmo3ootom  ai i (0s2urim3nydapte icia(fsDtmx o;u4olt ifctldfm2umnvp u0artoio3ta1fmD aueo;(  rtr(mpiudope mictltf rrmx  oo0aleniociasfm2rmu pn(0 ltrmrctotom ran o;t trxrxr nu1lmee nvs tfs2umu  ot1apx mieiys sDeln p;u0tleoif3tytoa rlieo (0trurxr iu1aleelfcils aDta( pno0aleo oeiydfmDua(vp u0 exnir3io1faD  uvs ()trxm(o3iu4omtnmncsasf 2umu ooo1tltoioeiys a el( p ()tlerxocoa1laDrlnei t) ruo(m3oydap nmiei (f ruru o;t0tpe mocild aDemn pn() lxoxr oytlat anvs s0 2um(opou4lltemfctls s2raurpnu1oex mfciltls rlnvpn(4aeerio oydopDeaueil() 2xm(r3nu4ap nmncs s  rrmumoou0alt mieiatlmDuanmo;() rerio3iytfm rau o ( truoxmpnu4lp  lnesa( a2rauroou4ape iietasla uanvs t)teeoxfcoadoptean ils  exoim oydapenlnci (fsDrrurpot0olt  i3iadla rmuvsn(4tlxnmr3iatlp rauvs;() etoiopoy1al   iviat s2umxm nu1openiieiltfsDumnvp u0 eeoirciotopD  i ils)t2xr(r3iu1oleemnviatf Dum(r ou1olt mo3iytfaDeanvo;u4 rxnmf oo1omDeaueils0texm(m3iu1ap elfetatfsrtrxr nu4ale mi3tydfs em(vo;t)teeoxrcoy1laDr ueo ( sexo(o iodome licta( srua(ro;t4teenifcilsla2um(vs;u) lenmr iodfpteaivo;s setm(m3ou4ap e neia()srurxr ;t4tptoii3tadlm2emnvp t)tetoxo3iodfat  n ilt0 rtoiopio4al nliei (  Drmxm ;o4ape ifeild s2rlu pnu4 etrmfcta1op r nvolt) exm(o3ny1lmenlfesl(  rrm( ont4aeen fetat a2ranvs (4 eenmf3iydfpD lnvs t) rxrim iu4lltelfet s) 2taxr nu1aptomoetltfmDem( pnu) rtoio to1laDr n olt teuoxrpio4ol emncil(fsDtrumpno0aet mfcildfm rlnmo;(0tlenmf oytfaDean i s s2trxr3nudol  lict () Dtmu  oo1olenmfeiat m2rm( o t)texoxo to1lmt lnvilt s2xm(mpoodoltn fvsas)a2rruront1apx  f3tltfm rauvsnt4altomo3todfmtrlivo;s)seurir iydlpeelfvslt s2rrx pno1tptnmieiad m umuvon(0tltnxrcty1omt anvi () eur(o nu1lmeelfesa()sDurur ;t0optnifciat mDelumo t0 etoif3iydfatrlivsl()trtmxm3io4lle mnciatf Durxrpou4tee mictys m2el(vo;u)areomo ty1lp ranesl(0t2xoxr3nu4apte ies tfsrraump;u0oleoii3tadlm umu sn(0trtomfctytlpDrli s s seuo(o oudope lnctat)sDtm( o;t0tpxnmo3tadls el(vs (4aetomr todlmte i ils texrir ny1olt livt tf 2raxr ;t4oeeoio3tatls el(mp;u0alxnmo3ia1omDr uesl(0 etm(mpoudlmenmfvtl() rtr( o;u4oetoif3iysls2elnvo u4 exoxr3oydfm eluei t)t2xrio3io4ap nmivi (  2raxmpnt1tpxo ieiltls2umnvs u0tltomfcoatlaDrau o;t0trxrio ou1opeemietl( aDtaxm nu4oeen i3iat s elnmp;() lxoxf iytlpDe uvil(0srum(mpiodlm e feta() rtr( pnt4tlx ifetas sDumn o u0aetrif3iy1opD  ivilt0texoxo iu4op e ivsa(fa2rmu pno4opxnmfeilsfm elu ont4 lxoiociatlm   i s;(0 eur(opnu1lpee nvs (fa2ururpnt1olxomoetytfa2ul( p u4teerxrcty1laDr ies;t) exr(opiu1optn ncils)sDtmur ou4tlt ii3iatfsDulu o t4tleriocoydfaDeauvo ()tetrir3iu4lmee fes (fs2raumoot1aeeoioetys aDrauvs;(4aetnir iatop   u s s  2um(mpoo1lp   nct tfa2umump;u1apxnmoeils a raumsnu4tltrxr3oatlm  an s;s0 rur(opnodlm emnetl()sDrm( pno4tleo iciat aDrlnmsnu0 lxnio tatomteaueol()srtoxopnodap  lnesat)sDtmu ont1alenmiciaslaDeanvo;u)alxnif oydfm r n i;s)srtr(o3iy4ol  lncils  rtrurp;u0tleomietysfs2ea(mp (4alxnifcia1faD aneol( sexr(o3oo1aptnmncsa()srtrx p;u1texnmf3tydfs emu p;(4tetrmf oydopte iesl(  rum(opio1lp  mictasfa2rauroot1aexomi3tytlaDemnms t4 rtnxoctytop r nvsl(  rumxmpny4amtn fet ()arua( oot1tpeomf3tlsls2umuvpnu0 ltnxr iydopt an s;t  2toio3nu4omtnmnet ()sDraxrpou4aeeo fctysfsDelump ()aeeoxrciadlm raueo (0 etmxr3iydlpeemivs t a2tm(r ou0oeenioeiltlm2ea(vs (4 lxnxr ty1fpt anvi;t)s2xm(rpny4lp  lfvtatfs2uaurpot1tpx mf3ildfaDumuvo u0aleoxrciodfatraivs (0trurxrpiy1lmteliviatfartrx pnt1oetnmo3iysfa2ulu snu)aexrxf io1oaD auvslt)t2xo(m3no4opte fetatf Drau p;o1tle iocildlm ra(ms (0trtoif iydlp   n s t0 rtmxo no1opt lnvtlt)aDtr( p;u0aptnmfeiadfs ulnmo;() exrircoadlatraneo ( trurxmpnydaltnmneilsfa2trurpoo0tetnio3tlslmDum(vo;u0 lxomf3oytfmDe n o s) 2urxr ny1ap nmnesat s2um(  ot1tpx if3iltfm2rau sn(4arxoxo todoa rluvslt0srtmxm ou4alen fcsatfaDua(  ot0oetn fctltfa2ulnvp;(4tetnif tytlmD lneo;s0trumir3oy1lp  mies ()s2trump;t0aptniocild a2el(ms u4 ltrir3oatlm r ueo;( srtr(opiy4amt lnei () rtr(mont0ope  f3ilsfmDuluvp;u) eermf3iodlatrlivols tetoxm3no4open fvsasf rrax pno0tex  o3ildlmDel(mpnt) lenio3iy1fm  aivi;s0 2xrxm iy1oltn ivtlt)sDtaxr nu4tetnmfcildfsDemn s t) etoxf oytomtr u o t0 rtmxo3ou1omtnmfvt (  2ua(r ;o0olt ioeildfsDulu o;u) rerxr3tydfptean i;() 2toir3nu1ape  ietas s2tmu  no0tetomfciydfsDem(vp;(4trtnio3iatopD ln i ()t2xoxopnu4omee nctat sDurxr nt1tleoio3iad mDrlu ont) lenif totlmt livi;t0t2umiopoo1alt lnet (fsrurumpou1apx moctydls2ran pn(4artrxf iotomD  ies s0trtriopoy1opt mfcils)aDra(moot1alt ifeildfmDulumsn() lxomf3ootlpte uvil() eur(o iu4oltnliesltfsDraxm nt4ale io3iyt mDulnmsnt)texomr to1lptr ueils0 euoxmpnydol emfvi ( srurump;t0teeoioeiltlm2rl( onu4teenirctotopt lu i t  eumxrpnudol  lnci t  Dra(m nt0aex  ieiasfm2rauvs u)tltrio oo1laD livs s)seurim3iu4aptnlfesasf rraump;t0tptniictysfm ul(ms t4 lxoxf tydfatrluvo s s2uoim3oydale  nct ( sDurxr ;u1aee  i3iatlaDem( pnu0trxoif oadomDrln i;s)t2uo(r ou1amte fciasfsrrr(rp;u4apeomo3iatfsDeluvp;t4aeenircto1lptrli ils)srtoio nydlpeelfctat)a2raur ;t1oeeomfciatfmDrauvp;t)trxnmfctatopDr i s;s0 2xoxrpnodol e ietlt a2tr(rpnu1tee mfctltls eaums;t4 rxriocio1fate n o s t2tmxr3ou4aleelfvs t)a2um(  nu0tet  i3ils a2rlnms u4 reoirciotfaD  uvils  2xrxr3nudopeelfvtas)sDrr(  no0alxnio3tytfaDrm(mpn(0 exrifctydfm eai s;s)trxm(m3ou1om nmics s  Dtm(rp;t1teeo fetysfaDumuvs;t)trtnxfciy1lp ranes t)teuo(o no4ap nmfctat)a2um(  nu1oexn fctadfm2umn p;u0texnxf3iydlptean s;t s2umir iodlptnmnei s)a2ta(m no1tptn ieiatfmDra( s;u4arxrmrcoatomtean i (  exoimpoudap   ivs ()aDtmx o;o1texo f3tltfs ua(mo u4altriocty1opDraues ()srto(m iydomtn neiatf 2tru  nu1oetoiiciltfa rmuvsn(4 rtrxo oy1opte nvsl(0 exr(o nu1lptelfetat) Dur(  no0alen ociadls2emnvo;u4artnirciadlptraivi s0t2xoxrpnu4ome  nvias) rumumono1aeenmf3iyslaDrluvp u0aexnmf3tydopDrlnes;s)setr(m3io4omen nvs sf 2um(r oo1tptomfciytfsDemuvo u0tlermo oy1fmDrlivs t)seuoir ny4lmen fci t)s2tmump;o1oeeoii3tls sDuln o t4 eenxr3tatomt  uvil(0setmio iydlm  mics (  2rru p;t1texn feiysfsDeanvs t4trtoxr3oo1fmtrlivslt)t2uo(r nydllt lfcsat srtrxro;u0aleo f3tas mDrmu ont0tetrmr ty1lm eauvol(0tetrxo iy1omtn iciatfa2um( pno1tleoioctldfm ea(ms;(0areoio to1fmDeln s;( setmxopiu1omenlietasfsDumumoot1alen o3ild m uln sn(4texnxfciytlp eaneil( trtrxm oo1oltemfci ()srtm(moou0ale ifciasfs2ulump;()teeoif to1fmtranes;(  rtmxm nodole mfeslt) Durx  ;t0olt  oeildfsDem( pnu0aleoxf ia1fa ran i t0 2xmxopoy1altnlnesl()arur(rono4opto f3tatfaDrmn p;u)tleoxo iy1om e iesl()sexo(r3ny4lle lfct s  Drr(mp;o4opx iieiasls rm( s ()alxrxo3oatlmtr uvi s0trur(mpoudolenmfesl(fs2trxr nt1tle  o3tlsfmDelnvp u)tlxrif oatfmDraueolt seumxm3oudoltnmncsl(f 2ua(rpoo4tpenifciad aDrl(mpnu) lenir oodla  au o;t0setmim3iudomenmiet s sDurxr ;t0oeeomfetyslsDea( o;u)arxnmr oydlateai sl( srtrimpiu4am elfvilsfarrrx pnu4alt ioctadfmDeluvp;()artoxo tadomt au i;s trxmio3oy4omtn ictl()s2tr( pou1tpxnmo3tatla el(vp;u0 etoxfciy1opD  n i () rumirpoudlmte ncsls) Dumxm oo1ope moeiytfsDeauvp (0tlxomoctatom raivo;(  etm(mpno4al e fcils  Dtrum no1aetoif3iat mDel(mp t0 lermr3iodopD aieols)t2umio3iu4amte fci sfsDrmx  nu0aex  fetlsfs2uaump;() eenmo3to1lpDeai sls setoir no4lpeelfvtl() Dumxr no0tet iocilt s2um(mp;t0artoxr oy1lp   i il() etoiopoy4alte fvsl( aDtm(m ot0texnif3ilsls2rl(vs;u4altrmo3iotfmDrlnvs ( trxoiopou4ol  mictasfsrrrxrpou1tptomociaslm um(msnt0alenmo iodopD li ol(  rum(o3iy1lm emfeslt)arururo;u4alxnmo3iyt a raumonu0 rxnxr3oatoaDr ivol() exmxr3no4lm  mnes ( sDuaurpoo0tlx mo3iyt a2uaumsnu)tetnmr oadlpDelueo s0 rtrim iy4lm emieil(  2tm(m ;t4tee  ociad aDrmuvonu4 lxomocoy1laDrln o;()s2uo(m no1ol e fvil(fsrrau p;t4olenioeiys m2elnmo (0tlxomo3ta1fat  ues t)srxmxo3oydomenlfvi ( aDumur nu0oetoioeiatfa2eanms (0trenxf3iy1laDr u s;t  2tmxo3ou4omen iciat a2tm(m ou4tpx  o3ils s2rm(mp;(4 rxoxocoodlaD lu o (0trumir3ou1om  liesa(  Durxmo;o4tlt  ieiydfmDrauvo;t)altrio iatlpDranvsls trumxopno4lp  livtas) rrmumo;u0tltoiociad s2emn o u4aexrxf oodopDeaiei t setm(mpnu4oltemivtasf Dtmu poo4teto octld mDeanmo;t0 ltoxfctotlpDrai s (  2tm(r io1ame  nctat a2rrumoou0oetn oeiad m ranmp u4aleomr oa1fpt lieslt)s2xmxr ny4lpe mnes s)aDrauro;t1apxo oetat sDulnvp;u4tlxnxr3oo1opD ln o;t  2xo(r iodomt mfci s  rtau onu4opxniicilsfsDul( o ()aexoirciatlpt  n o;( s2tm(opiu4olenlfesl() Dumx  ;u0opeoioeiad a rlump (4artnio3tadoateanes;t) rxm(m io4opeemies s srtru o;o1texnmo3iadlmDrlnmp;t4altnxrctadoptranvi;()tetoxrpio1llen fesa( s2ta( o;u1tltnmo3ils s2ua(von(4altoio oa1oa e nes t0 rtrxrpnu4lpeemfctlt)s2urxrp;o1oetoio3tyd sDrluvp () lxoif3tadopt anvolt s2xr(o3nu1lmenmncsls)aruau  no0aexoif3tltls2umn s (0trxoxr3ootopDe ivi ( trto(rpoo4al  lictlsfaDuau o;o0oet ifeilsfs2eauvont0aexnif iydfp  lueil()trtrio3iu1al nmfci t  Dtmu p;o1alx  icilsfm ranvo;t0 ltoxr oatoa   ivi;s0trum(o3oydopteliet ( sDra(mooo1oexn fctatla2em(vsnu0tlxoio tytlmDeai i;( s2urio3ou4ame miciltfs2umu p;u0optnii3iasfmDua(vsnt0 rxrxr iodlp  aieil(0trum(mpiy4lltnmfeta()sDua(mont1tetnmietldla2rluvs () lxnir iatfa ean ilt) ruoir oydlleemnvslsfsDtrum nt1aexn ociydlaDul( o;u4 ltnmrcta1optrauvs;s) exo(opou4olee fes s) Duaxrp;o1oexn oeilt m uaumpn(0 lxnir3to1lmte nvs t)seto(opoo4lmenlivi s)arrr(  no1oleoiocilsfm ul( o u0 rermf3iytlmtrai i;s)t2xmxmpno1lp  lfcslsfs2trx  ot0tpx ifctltlm2rln s u4 etrmfciotlmDeli sl()seumxmpnodopenmfeta( arrrumpot4tex ifciytfm2ranmp u4texnxfctadomD auvo;(0 2xoxrpoo4llee fci (f rrr(r ou4tetniocias aDumu pn(4altoxf oydfmt lu s t seuo(rpiy1lmenlnei t s2ta(m oo4olxnmi3iyd a2ul(ms () rxnmociodoaD  uvils0sruo(o oy1opte fctasfaDtmur no0alxoiocilt m2um(vs;(0aexnmo3oa1omteau i;s) rtmimpio1ap emneils) 2ururp;o4opxoifciadla uln s;()trtnio iatfmt anes s0tetmxo iy1lmtemneias) Dra(ro;o0oee  icildla2rmumpnt0aeerxrcoatfmt aies;t)trxm(r no1lp elfetatfs2rrx  no0teto i3ilsfa emnmo (0aeenxrciotlpDeauvo t)s2tr(o ou4ap e neta(fsDrmum nu0teenioetytlm ua(msnu4 rxoxfcoodlpD  n sl()srum(r nydap  lnei t aDrrumpoo0tlxomoctaslaDrl(mp;(4trermociydop r nvi t  rumio3nu4al  mfei s)s2ra(r ;t1tptnmfetlslm emump ()arxrircio1fa  anvo;t)s2trxo oy4llt mnvsat) rrrx  nt0olenmf3tltfm ul(ms;u4aetoio3oadlm   uvolt)srxrxr3iudlltelfeilsfsrra( oot4opxn fciad sDra( s;() lxoir tadoa   u s t0 2toxr3ny4opt  ivta(f Durx oou4optnioetasla2rmu p () exrmo iodoat lnvo;t)teuoxr iy1lmee nvi ()s2uaxmpot0aet mi3ildfsDuauvs (0artnmrcoo1la elu s t)srurir oo4apen icilt  2taxro;u4tpeo iciyd s uanvonu)trtrmo3oodfm   u i t  etr(m ou1op   ncs (f Drrx p;u4aleo oetydlmDua( s;u)teerxf3iodom ranei;t0tetr(m nu1aptelies s a2ta(  nu4olx moetatfa rmumo t4 etnxo ty1laDe neo;()s2uoirpno1om emnvs ( sDrax  nt4olxn i3iadlm eau onu) lxomf oadfp  anei;()sexmxr3iy4ap elncsasfs2umxr nt0tle mf3tltfa raump;t0tetrif3todom ean sls0setmxr3ny1omeemfcsltf rrru pot4aeenif3iaslm ea( pnu) eermr todom r uvi s  2xoxm3oydapenlfvi t sDraxrpou1alxn ictydla ulumo;t0altrmf3tytlatelu ols) rxoxopnydlp nmici s  2um( pnu4olxo o3iydlaDraumsnu4tlenio3iadomt  i o t0seuoim3iy1lmte feia(f rrm(r ou1aetoiociysls2ulu pnt)texnxf iytfm r uvo s)t2urim oudlp emiei s srtrxmpnu0apenmfciltlaDum( o t4 ltnio3tadop  lnvslt  ruo(m nu4olenlncil()s2rm(ro;u1oeeo f3ilsla2eanvp;t4tlxnir ootfmt  ieo ()srxmxo3nodlpt mfeil() 2ururono1aeen feiysfsDrlnvpn()tlenmf3tytlp  aues (0 2toirpou1olte fcsat) rrm(monu4opx  oeiadla um(vo u0trtrmf ia1opDe ueils s2tr(m iu4apt  fesat  rtrxrp;u4oltnii3tatfm2umuvpnt)tetnxf oatfpDeluei t srtr(r oo4openmivil( aDuaumonu4apen ociyd m2ul(mo t)arxnircto1lmDeaues t)srurxo nodopen fci s  rra(r nt0tetnmfctlt mDranvsnu0tltrxr3iatlm  ln i ( s2xo(r oydol   nvt tfarua( oou0tpxoif3iysfs ranmpn(0arxrxr oydom eliei;s)srto(o3ou4altemnvs t s2ur( pno4texnmoetltfaDrlnvp t4 etomfciodom  aies s0s2umxr ny1lm  miei ( srtaxm ;u0texomocilt s rlnvsnu0trtrir3oydlm r n s;(0srum(r3oy4lptelfvsa( aDtaxm oo1opxomieiytfa ulu o t0aeenxf ta1lmtr u i s)s2um(o3no4llen ncia()srua(rpot4aeeoif3iadfs ul(ms;t)tlxnmo iadfa e neols  2to(mpnydalee fvi tfsruaum ;o0olx mi3ild mDrlumo;t4trxnmo3oy1fa eaivi (0srum(r nu4lm nlfcs s s2urxm no0alxoiietysfa2el(vp t0texomo iatfa  lnes;s0 rumirpio4om nlfesa(farraxm oo0oexo fctysfs el(vp u0 rtrmfcta1oa r nes;s sruo(r3oudope mfvtltf rrrxmo;t0tlt  fcildfs rauvpn(4arxrir tadfpte uvo;()s2tm(m iudopee ncilt)s2rm( o;u0oeeomfciydfa2umuvs u4 etriociadfat an o t) rxmim3iy1ap nlies (f 2rm( oou0olx mfeiadlmDulnvs;u0texrxocoadfp e uvo;t0teuo(m oydllt lfei (  rrm( o;o4ale  o3tldlm ea(vsnu) lenxo io1fmDr uvsls  2to(r iy1ome mfetl(f Drmurpoo0aexo i3ildlaDemnmpnu0trxnxo ootfptelivi;( seurir oodoptnlfeta( artax p;t4apxoiietat s2emn sn(0tetnxo iodopDran olt0 2umiopoy4al n nesa( a2tmxmo;t4apxniociadls uanmo;u)artoxr iatfpteluvs t0 2trxr no4alen net t) Duru onu0opx ifctydfaDeaums;u)trenmociydlpDelnesl()s2xrxo nydomt  ncsa()sDtrurp;t0oetoii3iadfs rmn pnu)artoxrcoytop r uvol( s2trxm io4alt lfcsl() Dum( onu4oex  ieiadfaDem( o;() rermo oo1lmD  ivs s)trur(opnu4lm  mnvt t aDrmxrpou0tle ioctyt s elu p;u4trxomf ty1om  an i;t) rtrir3no4al   nvsat a2umumo;u1openif3ils s2uau p;u4 rermr3totfaDr nvo;s  rxr(r oydal nmfesa( arur(  ou0oltniietydls2rmnmo;u4aetrircoadoa eli i;()t2umim3iy1alt mfcs s artmur ;u1tpt  iciytfm2emnvs;(0arerir3tydfm   ues;()tetrir no4ale livsas sDtmur nt4aexoif3ildls umnmpnu0altoxf3oatfpD lu i s)seuoxopio4amee fcs ( s2rrx  ou4tltnmo3tad m ra(mo;t0 exnio3tadlmtrlnes t t2xr(r nudllte ieiltfsDtr( oot1apt io3iad m2ean o;(4alerxoctatlmDe uvils)srxmxm3iudape  fcsat s2tax p;u0ole  i3iadlmDeau s (0tltrio oy1laDe ieo t)trxo(rpoodop   feiltfs2tru  nt0opeo iciys m rm(ms;t4aetnmr3oo1la  lies;t  2toxo3no4lptemivtls)sDur( pot4tex mi3tlt a2umuvsn()treoir3ty1lm rlnvsl()teurxm3ou1lpenlnes sf Dur(monu1tlxomicildfmDel(mp u0altnifctadlatrlivsl( trxoir nu4alt mnei s aDrm(moou0apeomociatls elnmp;() rtnxfciodfaDeluvi;(0teuo(r ny4lltn ncslt  2urxr no1aex mo3iatfmDeln on(4arermfciatlpD ln olt0texr(r3oydlmtn nci s)sDrrurooo0oexnifeiltlm2uaumsn()texrmr3ta1om e neil()trtoir oo1oltelivsa( arrau pou0oleomfctatlm2rmnvs;(4arxrxfcootoa   n slt0trxoimpiydaleemieiltf ruru pou1tet ioetadls eau s;(0treoxr oodfaDe nvi s)setoio nodomtnmncias) rtmu ono4apeoiietlsfa2emn p;u)aeerxr iydoa elues t s2xoio io1op   iesas)artmu  ;t1oexoioetadls rlu on()tetnmocio1fmD lu i;( tetrim3nodlpee nvta( sDtaum oo1alx ioetltlm rln o;t) rxnmf3iodlp r iei;()teuo(opoo1al  mivilt  Dtrxmp;o4alxnif3iytfa uauvp t0 rxrio to1lp rli ol( trumio ou1ll nlfvsas srrm(rpnu1alto f3iytfa ra(mont)aexomo iadlpDelieils)trxmirpny4apeemnvt ( sDtru p;o1opeoii3iat sDemnmp;t0 rtrio3oodop  aivs;()sexo(r oo1omte fes ()sDua( p;o4aetnmo3tadls2ua(mo t)aetrxrcia1laD auvi;t0t2uoxopio1apt mfvsat) Draxr ot4tetn oeiys sDea( o;t)artnmfctotomtr nei;t0 euoiopno1aptnmncias arra(r ou1alt  fetydfmDra( s (0trtnxr3ootoa eaneo;s) exm(r3iu4om elfcsat)srtmxrpnu1tptn ictysfm um(vp;t0aexrmo3io1lp   u il() exrirpnu1op  lfcils aDrrxmpnt1tetomociadls rluvp t)aleniocta1lpt  nvil(0 2umir3io4olee netlt srrmxm nt4tltniieilsfaDrmump t)texomf oa1fm rlivs;(  rumir3ou1llt lneia( arumu onu0oexoif3iasfaDran p;u)tlxoxo3oydfp   ivi (0srto(r3oo4alteliesltfaDur(rp;u0aetoio3iydlm2ua(vs;u4 etnir3oadfaDeanvslt0t2tmxm3oo4lmee ietlt) rrrxmono4apeo icilt s umu p;()teenxo3tatfpt anesl(0 etoim3no4ome  ivsa()aDtrx o;u4optn i3iltls rln p u0tltrxf3io1lpD anei;s) 2xo(r3nu4olenmfvils  2tmx pnu4aetnifeildla emnmo u)altrxf3oytlpDrliei (0texoxo iy4olen ivt s  Drmxro;u1aeeomf3tyd aDelu p;u4aexnmf ty1fmteaueolt texoim3iu4llen fvtas sDrmx  ;t0alxnifctldlmDem(mo;(4 rxrxr3tatopD  u s s)s2tr(r3oodapeelicsas)aDrr(mpoo1tlx ioetytlm emnmp ()arenxf oadlpDelu s;s) exrio no4apee ics (f rrau pno1altnmfeiat mDuanmpnt0aetnmr3totoatraneolt) 2xr(r oudamte ictlsfa2rru  ;o4tlxoiieiltfmDranvs t)teermr tadlat  ueilt)teumxo3oy1ale mneils)aDuaxm nu1apeo f3tytla emnmpnu0altoxrcto1op raueo;t s2xr(r oo1ll emictat) 2tmxmpot1apx  fciat sDranmo;() rerxf todlptr u s s  euoxrpnydape liesat)arrrx pou1apxnio3iytfsDulu snt0aetoxfciydlatr ivo ()texmxmpoo1al emivt s)s2tmu  nt1aet mietls s uan snu)trtnxfcoydlaD  i o s)t2to(opiudom   ict (fsDrmxrp;o4oee  o3ildls2rl(vp;t4 eerxr3todlptraues s t2xrir ou4ll n feilsfsDtaxmonu1oetomiciaslaDrlnmpn()trxomr iatomD  ies t0trxrimpno1apte nes ()a2trumpnu4tlxomfciadlaDea( ont4aetnxr iydfa rln o;( trtmxr iy4oltemfviat  rta( p;t1opt mociadls2ulnmo u)arermo3iatomD an ol( tetmxo oy4amtelfesl( s2tmx oou4tlt moetyt a ulumsn() lermfcta1oaD aieo s)s2um(o3oo4omeelivsat)a2rru pnu0apx  oeildfaDuan o (0aeenxo3iy1fm  au s;( trxmxrpoo1ame  ivsl(f rtaxrpou0apxoiieiadla eaumo u0tetnmo3todomtrliei t)srxoim iydolte fvt (fsrra(mo;u1tle ifeiysfmDranvp;(4trerxr oadlptraiesls trxoxrpoo1lptn feia() 2rmx o;o4aee ifciasfa2emn s;(4 rxomrcoytlmDran i;s)srxoxrpno4lp  mfesas aruru onu1altomicildfaDuln p u4teeoio oydfptranvo t)srxo(m3nodlpenlics () 2rrxrpoo0tpxo feilslaDemnvs;t4 exrxo3oa1lmt livs t  2xrim oo4lp n nvil( srumurpno4opto ictad a2ulumsnt4tltoxf iotom  aivsl(0setmxr3oy4amt lfvs (fs2rrxmp;o0oexoii3iys aDelnmsn(4tetnxociatop  livi;t) 2xmirpiydole micsat)sDur(m ;u4tet  ieiaslm2ul(msn()teeomo3oydlpDrlies t)trxo(rpno1ap  lfetls)sDumu  nu0tlxoioeildla ra(vp;u)teeomo3todop r iei ( srto(m nydlp e ncsltf rtrxmoou1tet ii3iatlaDuau p;(0tltomfcoy1fa  ai ols) ruoxmpiu4olt mnvils  rtmxro;o0teeo feiydla ra( o;u4aleomfciadomteln sl( s2xoimpny4lle  fcsl() Dtmx  ou0alxnmfeilsls2ulnms u) rtrxf3iodoa e ieols  eumxrpnydop   fesasf 2tm(mo;o1altn ieiatlsDeauvp;u)aeeomfcoydlp   uvs s0 rxoio3oy4ll nlncils)aDurxmo;t4tlt micils s ulu pnu0areoxo3iytoptelnvilt tetmxrpoy1altnlfct s  Dua(rpnu1apxn fetltfs umumo;t0 lenmf tadlatr ivo ()srtm(opio4lpt lnesa(  Dum( pnu1opt mi3iasfs emn o u)trxrmocta1la  li ols)sexoirpno4oltemivtls)aDtrx pnu1tlx  ieiyd s eln p (0 etoxrciadfpteln o;s0truoxmpoydll e iciat)sDta(root1oltoii3iytlsDuaumon(4artnmr iotfp eli o () rtm(r3io1aptn fet s sDta(mpno1tptnmocilsfm2rmn o;u4aleoircoo1omDraiei;s) euoiopoo4omen nesls)aDurx o;t4tpe moetltfmDem(ms;u4tlerif3iydopDrauvs s  etoirpiy4omtemnvsa(f 2tau pnt0oee mfciyslm2ra(vs (0tetnxf oadoa rlneo;t)s2urir nydopte ivsasf 2tmx o;u1tlenifciat s2rmu p u)altnmfcoydlm r ueo () 2tr(rpiy1ll e neiatf ruaum nt4ale  o3tydfm ua(vp;t4arxrmo iadoaD lnei;(0t2xrxmpiu1al  lnet (fs2tmu  nu4optoii3ilsfs em( pnu4aetoiocoodfm eaneil() 2xoio iy4olt lnvia( sDum(  nu4oex mfeiyd s rmn pnt0 lxnmocto1opt an o;s0 2uoxrpio4ap nmncs s s2tm(  ot4aeeoii3iltfs2rmuvs;t4 rxnir tydlm  anvi;t0srxrxopoodaptnlncta(f 2tau p;u0olenifetlslsDrlnvo;u0 ltomr ty1laDr ivolt)s2umir ou4lmeemncs s) Drmurp;o4olx  ieiatls2rl(mpnt4aexnircoy1lp r uvo ( sexmxr io1lmenmieia( sDuaumont1tpe moctadfa2ra( snu4texnxr3ty1opteln sl( t2uoirpiydap n nvi sf Dur(m oo0alxnmi3ilslm2rl( p;t0tlxnxoctytlaDrai i;s) 2to(o3io1ame lfvil( aDtru ooo4teeo ociasfmDra( pnu0 renmo3tadfmD lu i;s srum(opiy4al  lfvsls)srrmum nu1tpxnmoeiytlm2emn p;u) ltrir oadoaDeai ols)setmiopoodam nlivsat sDra(mpnu4tet  iciydfa2emu o;()tlxomo3oa1om eluvilt0trxrxm iu1llenmictl() 2taxm oo1aptomi3tadfs2emu p;t4trtnxr oydfmtrauesls t2xo(m no4openmfct t) 2rmurpnu1ale  feiytls ea(mon(4tetoir3iadla e uvs ()s2xrxo ou1apeemfeia(f Dur( o;u0oexo o3ilsla rlu pn(4altomoctydoptraues;s srtmxm3iy4lptnlfeias) 2uaxrono1ape mo3iltlaDuan snu4altrmrcty1lp eluvi;t t2xrxr nudlmeemivslt srta(ronu0tle  iciadfa rm( p () exoxo io1fmte ivi s)trxoir nu4oltnmnetas sDuru  ;u1alen ocilt mDeluvon(0tlxoxo totlmD auvs;() rxm(o ny4opt  nvs s)sruau  ou1tltoiocild mDua(monu)artnmr3iytlp rlu o t0sexrio nodop   fei s) Dtruront0apxomf3iysfm eanmsn(4 rtomfcty1lm eluvs t)trxmxopoy1ope lnesa(fsDrrxr ;u1altomi3iyd a2rl(vp t)arerif iy1fpte n i;(0 2urxrpiodlmte nes ( s2trxroot1tpe ifeiytls uanms (0teerifcoy1fatrln i t) etoxopnydopenlnci s)artmu  oo4oetniieiatfmDrl(vs;t0 etnxrcta1fm  aneils0trxoxm3ny1apt mivtl(  rtr(ro;t1aetnmf3tltfm2rl( o;t) lxnmo3oydoaDrauvilt  2umxr oo1amen nesat  Dtrxro;t0alenmo3iltlm2ul(vs t4 exnircoy1fm ranes s t2umim iy1lle lnes s s2ta( o;u4texnmoetysfa2rmn o;u0altrxf ty1la  au i ()srxoxrpiy4lmenmiei s  2uaumpnt0opeo icilt s2ea(vont)tetoio3tadfaDelieol( t2toir nydal elfcsltfa2rrum ;t1apto fciasfmDua(ms t4trtnircia1opDeauvi ()sexmio oydol   ict t) 2tmurpnu0alxnmictyd s2el(mo t) reoif3to1la r u o s srto(opoy4al emfeslsfs2trxmpno0oetnmfctlt a um(mpnt0alxrmf3oatopt luvi;(  2xmxr iydllte neil( aDtru poo4aee mietadfm rl(vp;()trenmf iytopD anvol(0srxrio3oo1amte neslsfartm(  nu4optnmietyslaDuanmon(4 etrif3iydfaDeaues;t)setoxo3ou4llt lfct ()a2ta( o;u4apx  f3tys a2rmu p;()altnxoctydfatrlu sls s2tmio3oo4ol n ietat)s2rmumpoo4tlt io3iasfs2umn on(0trxrirctydom  li o ()srto(r io1lm   iviatf Dtax  no4aetoifeiyd s2el(vp u)trxoioctodfpD ln sl( texoxo nodaptnmfeiasfsrtmxmpoo0aptomi3tlsfa eauvont0 exnmo oytopDelivo;t t2uoimpiy4omt mncsas)sDururoou1opx mfeiatlm2uauvo t)alenif3iodfpDraueol(0 eumir nu4ol  licia()arrmu o;t1opxoiictysla2eln onu4tlxnir oo1fmt luvo t)sexrirpnydll  lictls  Dtmxr ;t4aeeomo3iydfs2elnvon(4trxnxr3oadfa e ies;s  rumiopiu1ol nliei s  rrmumont0teenifeiasfs eluvp;t4artrxo3iydom  aieil(0 2xmxmpny4oleelnetas)srumum ;t4opt mo3tydfs2emu p t)trtnmrcoatoateauvil() ruoxo3oy1om  lici tfarua(m oo0olt mi3tydfaDrlumont0alerxociodopDelnvi s0 rtrxr iydomen ncslt)sruaxr ;u1tle  feiytfa ulu ont)trxoxr3tadfmt livs;s tetm(o3oydoleelfet s  Drauro;o0oeto ietys s ulnvs u4tetoxo3oo1lmDrlieo t)trumxr3oy1lptnlneslt)srrrxmp;t4olxniiciyt a2uluvpn(0trxnxo3iatfpte nvo;t0 exrxopiudaptnliet sf 2rrxrpnt0oex ifcilt s eanms u0trtrir3oatlpDe n s t) etrxo3iodopt  ncsltfsrta(ront4oexniociatls2ul( ont4 exrir3oo1om rau olt)seuoiopnodlm  livsat)srrmuro;t1apx mo3iaslm uluvp;u4treomf iy1fpD lu o s0 exr(rpiydopteliciat) Durump;t1aet  i3iat sDelump;t)aexoxr3oatomDe uei;t0 etoirpny4opee nvtltfsrtau o;t1apenif3iatlm eanmsnt4 ltoxrctadlpDr ivi;()truo(r3iu1ale lnvsa(f 2tax  nu0tetoif3ildls2emuvp;()teermo tadopDeaivo;t)seuoxmpoo1lpen iet t aDururpnt0tet io3ias a2rmuvont0texoif3totfaDrlivs;(0trumxopiudlmtemfei t srra( o;u0tltomfetyd mDrln snu4alxnxr oa1la  anvi s0teur(o3iy1omtemfcil()s2urxrpnu1opeomf3ilslm ea(vs t4 lenmo oy1fmD  ueol( s2umiopoy1op  mncsl(  2urx pnu1tlenii3ildfsDrlumo u0altnmocoa1faDe ivi ( srtoio3ou1ll nmiviasfa2taxmpoo0aetomoeiadlsDum( pnu0 ltnmo3oydop  aivol(0s2tr(m3ou4ap e fct (f Drrumpoo4ole  f3tasfsDea( s t4 ltrir iy1fmtrlu s s) rxo(r3oo4om e fvt t  2rmxmoot0aeto oetys s2eaumonu)tltomrctodfmD an i;s)seurxmpio4op nmnci (f rta(ront1olenmicils a2rm( s;(0tetrxocty1lpDrli s t sruo(rpoo4om nmnei ()srurx poo1olt mocilsfa elu on(0trtrif3iadlm   n ils  rxo(opoodap  mfctat)aDra(root0opxn feils mDrl(msnu0alxrif ty1fm  luvi t  etmxmpiudapt  icsl()a2rmx  ot0ape mfeilt m umnmp;()tlenif iytoatr ivils0 rxrxo3oydap  lfctls) 2tmxrono1openifeilsfm2ul(ms;u0artnmr3oytfptrliei (0trxoxr no4aptnmnesl(  2tmu  ;u0olx  ictlt s rlnvp u)tltnxo oytoaDranesl()setoxo io4apenlncsa(f 2uaxroot4aetomfeiad sDem(vs;t4 etnmo oodlaDraivslt srxr(o3iy1am n iei s)sDrru ont1tpxoii3ilt m2emn o;u4 lxoxrcty1oa elues;s0sexr(opiudalee nei t aDua( ono4oeen o3iyt a2ul(vont4tlxrmo3ia1fmDr u i;t)t2xm(r3nu4lltnlnvtasf Draxmp;t0teenmoeiatla2emn s u4artnxr3oodlp eaueols) rxrio no1lpe  icsat)s2ur(mpot0alt  i3iyt s rm(ms u) lermo iydlmD anvol() rtmxmpny1lmt  nvt t  2taxmoou0ale io3tyd a2uluvs;t) leniocoytlmtelnvilt  etrir nudam  lfvtl(f Duax  ou4optoiociltlmDrlu p;t0aeermf ia1la  an il(0s2toio3nodap n fetltfaDrr(moot4apxnmi3tasfsDuluvpnu0trxoxr3iatfpD anvo;t0 rumio oudolt lfctl() Draxm ot4apen iciatls ranvp ()tlxnio iotlp eaies;( trtrimpnu1al  liei t) Durx  ou4alx mi3iydlm ulu o t4trtoxrciotfpteauvo t)teurio nu4omtemfeias)a2rmurp;u4apen ietldfmDulnms;u0aeeoif tadlpDr n slt srtoxr3nudaleelieiatf rtmum nu1oleo ictyd s2eln p t) rxrmfcoytlmtraivo t) etm(m3iy1amtemncs t)aDraur no1ale mietltfa2elu s t)altomfcoodlm   ivo t0t2tmxm3ou1lle mnvi s  Drrxmpnt0aetn feiadlsDeaums;u4tlenxr iotomDrlieslt0trurio no4optnlfcs t)s2ururo;u4openmfetyslm2ea( s;(4 lerio iodlaD livs;( trxo(m3iu1apenlnetls) rtmxmo;u4apt mfctadlsDrmu s u4artrmo3oo1omtrlu ol(  rumio3ou4lpte neilt aDtrur nu0alt  i3iasfsDelnvonu4aeerxf iy1op rauei;t0texmxrpno4amte net s  rtrxm no1tltnifeiltla2rau s;u)tleomo io1laDrau s t  rtr(rpnudll elivsas s2tmur ;o1tle ifetls a ranmp (4 reomr3iatfmDranei;s t2trxm ny4olenmfet t)sDrrxm ;u1tlenifctltls2rauvo (0 rtoxr oodoaDelueo;s seumirpiodol nmictls)aDtmuronu1altomiciyd a2ua( p;(0tetrxo3ootfpDr u olt texrio oy4ape mfvsa(  2ta(monu0teeo fetatfs ranvo (0aeenmfctytop r uvi s) 2urxopoydol n ivi s a2umum ot1alxnmi3iyt aDrmu sn(0tleomocoodfat luvsl( texmxm ou4ame  fcsat)aDrrxrono1tlx  f3tld aDrm( pnu4 rxoxf3oatop r ivo s sruoxm3iodoptn fcta() rtm(mo;o4aet mictlslm2el( s () rtoio3ty1fp eanvilt  exrirpnodlp  mici t  Dum( ooo4olxomfetysfm2rlnmp;t) etnmr totfm  luvo ()srtm(r3oodlptnmfctlt)s2ur(  nu4apt  ietytfaDumnmp;u4 exrxr3oo1op   ues;s0teumio3iodaptemfcias aDuaxmont1ale ifciytfs eaums u0tetriocoo1laD  u i t)t2urio iydlmte fes s)a2ta(r ;u0aex  octasfsDem( ont) etnmo3iydlpt livols0 rxo(o oydal elfei (fa2um( p;u4aee iictydfm ranmsn(4 reoif3totfa rauesls)trxmxo ou1ol n fvi sf rtrurpoo4apt  i3tysfm rm(vp;u0texomr iy1omtelivolt)s2umim3oo1amtn fetlt)a2rau  ;u4apxnmieildlmDrlu s (0trtnif tytom rln o;(0seto(r3nu4lpe  ncia( a2trxr ;u4aee mfetldlmDeau s t)teenio3ootfmDrli o s0trtmxrpiu4amtnmiet sf Dtrxrp;t1tpe  i3tys a2emuvont)aeenmf3iotlm eauvs t seuoiopnu1ape  ncs ( aDrm( o;t0ale  iciysfs2ulumont4trxnmf oa1fpDeluvils)t2xmxr nudop  lietls)s2rru ono4olenmoetltfm rlnvpn(4altnir3todlaDelivil( teum(rpiodlpe mies t)a2ua( pnt4apenmi3iad m2rmnmp u)trtnir3oy1oat li sls  rxm(mpoy4amenmnciat)srta(rpot4apeomo3ildfa eaums;t)alxoxf ia1oatraieo;t) rtr(m3oo4lpeemfcilt) 2um(mo;u4aptoio3tldla ean s ()altoxr oy1lmD ai o;t0 rxmirpio1ole  ietat) rra(  ;t1opto i3iltlaDrl( p t0aetoxr oatoatelu slt  rxmir3iodolen icil( srtrxro;t1teeo i3iysfs rlnmp ()tltoir oo1omtrlivolt  rum(o io1lm elncsas  rumumoou1tpxniocilslsDran p u)trxrmr tatlm eliei;s)teurxm oodoltelfesatf rtax oot4tpxomfciatlaDrmnvs (4tltomo3oydfptrlnvs;(  rxoxmpiu1lpe  ici ()arum( pnt4oexomfeiadfaDuaumo u4texomrctodopt ln olt  exrim ou4apeemfesltf Dtr(mp;o0olxn i3tytfmDua( o t0aleoio3tytlat  ueo s  rto(opiudlp  lncslt a2urxmp;o1alxnmoeils aDrl(mon(4areoxr io1fm eln s s s2uo(o iu4apt lncia( a2urxmo;u4tlxniicilsls2um(vp;t4aexnmo3iytomD  neol()trxmxo3io4lpte ivsl() 2tmxmp;u4aeen feiydla rluvon()altrmf3iotlpDraies;s0t2uriopnodlpt mictls srtmx o;u1opxnmoeiltlaDum( pnt)tltrmfcoytfmD lnesl(  2umxr iy4lp nlneils)a2trxmpnt4apx  icils aDum(mp;t)artnxr oa1lmDrai i s) exrxmpiodlmen neilt) Drr( pnu0olt mieiltfmDuln p u)texnmr io1lpDrau i;s seuoxo3nodap   ictas aDumum nu4olxoio3tadfa ulnvp;u4 etrmr3oo1lateaivols) 2uoirpnudolt micsat a2ur( ooo4oet  octysla el(vont0tetoxocoadlat anvilt0seur(m io1llt  fvt ()a2tax  ;o4altoioeilsls2rau o;(4tltoiocoy1lateauvslt srtmxo oy1lltnmfeta( aDua(m ot1aee ii3iytls uanvo (4 lxomrctydlate ivi;t)t2xm(mpoo1ll nmicia()s2rrxmooo4tle ifeiys m2emnvs t) lerir tatomt an i;t) rxr(opoo1ole lfvtatfsrraxro;u1olenii3ildlm2ran o u4aeeoxo ta1fmtr nvs t0texmxm oudlpeelncil( a2urxmpot4aeeomf3iytfmDuau s t0tetoio3tytop  livi ()t2xoxr3iodalenlfcslt a2ta( onu4optnifciytlm elnvs;(4aetrxociodfptraueo;()srxoimpnu1amtnmnesltf rrrx  oo1olxoioeiad s2ea( s;()alxoif3tatfmDrlu o;t  2tr(r3io4ape mnetat s2ta(ront0apxnifciltla2ra( o;u)trenmo oatfateln slt  rxmxr3nydapte fcta( srumxm nu1oee  i3iydla2rmuvp ()aexrxf iydfa  anes;s)trtrio3iydal e ncsas)s2rr(  ;t1tptnmf3ildls uln ont0trenxr3ia1oaDe neolt0truo(o oydomt mies sfsDrm( pno4olx mi3ilslsDeanvp t4trerif oodfmtrluvi () rumio3nu4lpe  fct (fsrtrxr ou4aetnmietlt a2uaump;(4aeenxrcootlmtrlneo s) exo(rpoy4omtnlnetat  Dtmu  oo4oltnii3tasfa emuvpn(4 eeomf tatfaDe i s t texr(mpoy1omenliesas)aDuau  nu4opx  iciad a rm( snu0artomo3ia1lpteaueslt0 exoir3iy4om  lfvsl(faDtmurpno0apeo feiasfa2rlnvo (0 rtnmrcoatfmD aiei t0 2xmio ou1openlieiasf 2urump;u1ale  feiyd aDranvonu4tlxrxf io1om eaneols setmir3nydope lfvta() Drrxm oo4tltomf3iytfs umnvsnt0 renmociadfpD aneol()s2tm(r oydolt lieias)s2umu oot4apxn o3ilslaDrl(vsnu0altrxfctadlmtraies ()srtoxr oy1oleeliei sfsDur(r ou0olenio3iat a ulnmon() exomo oa1opDrlu s;s)seuoim3ou4alenlfes () Dururo;o4tpen o3iyt a2eluvp;()trenir3oo1lptr n olt) etmxmpoo1aptn nvsl( s2rm(m nt1tpxoif3ilsla elnmsn() rxrmr todfp raieo;( t2xmxopnydam emieta(f rraur nt0aet  f3iad a uluvpnu4tlxrmf3ty1lpD  ieolt s2uoio3oydlltnmfci ()arrm(rpnt0alto iciydlsDeanmo;t0texrir totlaD  nvsls srumir3iu4am  micilt s2rr(r ou4oleo i3tadla rln s u0 lenif3tadfpDeluvi (0t2xmxm3ou1op  lfesat aDrmum ;u0texn feiltfsDulump t) eeomf3tatla e ues (  etmio ny4lpenmncs (fartm(mpoo1ope mf3tatlsDean pnu4arermf3tydfmtrau sls  2urimpoy1al nmiesl( artm( pnt0oex io3iadfaDrl(mp;t0tlxoiocoatopD li i s setr(rpnudapee nvs (faDtm(mo;u0apxnifctltlm rmn s;u)aetnmo oodfatrlnei;s teur(r3nodlltn fet ()srra(mpnu1teen o3tat s2ulumonu)tltomrctadfatelies (0sexr(o3ny1amtemies s a2ua(r ou1tlxn fciysla2em(vsnu4trxomo3ia1optelu i;s)srumxo3nudap  lfvtasfaDtm(  oo0aex iietlsla rm(mp;()alenxf3io1oa r i s;t0t2xmim3ny1openmfcs s aDumu pnu0oetn f3iyt aDem( ont0aetrxo3iy1oa eaueo ( sexoxo io1openmivta( s2tmx  ;u1alt iociltla2umnmp (4 renifctytomDr i s t tetr(o3ou1omte fvtasfarur(mono1opxnmfeias sDrlnmo;(4teenxf ta1late uvil(0t2um(o io4lpe liciat)sDtrxm nu4oltnifeiasls2eln sn(4tlerio3iodfpDeanvilt0sruo(m3ny1ap nmivt ()artau p;u0optoif3ils mDrmuvs (0 reoio oo1lpDelneo (0 rtmiopoudaptnmnetasf rtr(r ou0olto oeiltfm rlnms t0aetoxo ty1laDe ueils) eum(opoudole mneils)srtrum oo1tpeomo3ils a em(ms t)treriocto1opD li s t) exrirpou4ll   ici tfaDumx pnt4aexoii3iydfm2em( o u0areoxocia1optrlu i;s) eur(r io1lmeelfesat sruaxmono1oetnmo3tadfs2ul(msn(0arxrifcta1lat  ivs s0trurxmpio1amen ietls) 2rau ont4oltn octadls2rlnvo;t0tltomo3iytlaDelu i;s  2xr(m3oodaptnlfesat a2tax  ;u4texnifeildla2rmn pnu0trtoxo3totop rauvo s)s2umxrpiu1amt  fvias)srra( oot4opt if3tadlm umnvo;t0aleoxociotlaDe ies;s0t2urxo3iy1lm e ieil(fartmurpnu0alxn iciytla2ua(ms;(0trenir tydom  luei;s) rtm(o io1omt livt s aDuaxrpnt1tlxo fctad m ul(msn(4 etrif oa1optrlivs () ruoxr3oy4omenlfvt t)srurx  no1aetnmf3tyd mDelnmp u4tlenmf3todopD ln i;s) exriopnydomte nci (f Dua(ronu1tltnif3tltls eln snt0aexnmo iy1op  anvi;s  2tr(o iydamen ies sfa2trxrpnu0tlx mf3tadlm2rm(vp t0alxnif3oa1fm   u s s0trtmxmpoo1ap n fvta()aDrrxrpoo1opto oetlt aDrmnvs t4aexrio3oy1lpDe nei ( s2trxr3iudop  livtl( srtau ono4apx mf3tyt a ulnvp u0 eermf ootlpDean o t)trtrxmpny1lp  lnes t)aDtmuro;o1aleoioeils m2rlu sn(0 renmr3tadop  aneo;s texrxr oodopeemfes sfsrur(  ot1texomi3ilslsDumu s;u4trxoxrcia1fpDe i ils seum(rpno1oltelfvsatfarrmx ooo1optoiieiltlsDea(vs;t)tleoxrcty1la rauvs t sexr(o ny1lmee iesls arrrur nt4teeoiociltfs rmnmonu)aexnirciytopDeaueil( setrim iy1am nmivtls)s2tmxr ou1altnmfcilslm emuvs t)aeenxf oa1omt  i i s seuoxo no1ole  ivia(  Dua(rpnu0tltn f3iyd s elnmo;(0trxoircty1lmteauvs ()s2trxopiydal   fesa(fsrrmur oo4aeto icild a2eaumo (0aexnirciatoa r ivs;t t2toxrpnu4al elfvs t)aDtmxrpnu4tpeo ietysfa2rlnvpn()trtnmr3ty1fpD lieslt) 2to(m ny4alen fcsa()arrm(rp;t4tee  o3ildfs2ul(ms u) lerxr3iatoaD aieo s s2umxo3io1altnlnvsat) 2rm(m nt4aexoii3tatfaDum( p;t4artrmrctotopte nvs s trxm(o ny4opt mies sfs2taxm ;o4teto ictyd s2el(monu4tlxomf totlpDe u s t0 ruo(o3iydop emict sfartmxm ;u0aex iieiydfa2uau p;u0 rxomfcoytfm raneil(0 rxmxm iodolt  fesl(f Drr( ono4oet io3iaslsDuanvo;u)alxrxf3oatomteln s;t) rtoio3io4am nlfctl( sruaxmpou0apx mictlsfm ranmp t4 ltnir iatfp elueils0s2xm(rpoudamenmnvils) rrmxroou0tpt  oeilslaDuaumon(0 exnxocoydfa rai ilt)texmxr3io1amt lics t sDra( ooo4tltoii3iyd a2em(mpnu)alxoio tydfateauvs t0 2xm(r3ny4ll  lneils) 2rr(r oo1oee ifeiaslsDrauvo;() lerioctadlp ranvo;s s2trio iodol elict t)s2tmxm ot1oexnii3iasla rluvp t0 leomfciydopD lnvolt)s2umim3oo4omte ies (fa2rmxmp;u0aee ioeiyslmDeanmsnt4 rtrmocoy1opDr u s;s  exmir nudamte feiatfa2tmumo;t0texomi3iatla rmnmo;(4teenmrctytfa ean o;() etoxmpnydomtnmneils s2trx  nu1olx mf3iadlm2uan p;()altrifciytfatr n s (  2xrim3iu4amtelfvt t  Dtmxrpnt0opt iociadlmDeanvonu4aeermr todom r uei s0setrim iydol nmnvt tfsrta(mpoo0aex iociadfa raums;t4trenmo3oo1lmtrlu slt0teto(rpoodaptnmivilsfartmum nt1oeeo o3tldfsDua(vp;u0tlenio iodlpteli s t) 2toxo ou1ape  ietls)sDtm(rpou0tleniietyd a ean sn() exoifctodfmtr uei s0teuo(rpoo1optnlfcil( arrm(  ;t0tee  fctld a ea(vp u) rxrirctatlate ieolt texoxrpnodole mfcsls)arrmxrp;t4aee  oetls sDul( s;t4texrmf3oytfp e neols  etm(o oydlpte fvs s)a2tr( p;o0olxn iciat mDum(msnu)tetrif3oy1fmteanvi t s2toxr ny1op n ietlt)sDtrxmooo1tex  oetldfs uanvont) lxnmr iy1oatrliesl(  2trxopiu4alen nei s a2taxmo;u4oleniieilslm2rmump;u4aeermr3oadop eanei;t)seurim oo1oltelfvsltfsDurxmont0ope iictadls ra(vo;t0artoxo tytlateluvs s0t2ur(o ou1lm   nvs s) Drr( pno0olt iociatlsDrmuvs;(4trtrmoctydfp raueols)srxo(m3io4lm   fciat  rtmxmo;u1apx ifciydfa rluvont)treomr3iytlate ieolt)srtmiopoodom nmivtltf rraur nu1oetoifciytfsDrln p;(4 lxrif iotfm   n olt)t2urio3no4optnmneils)arrm( ooo0aeeomicild s uanmp;u0tlxnif3oadlp ranvi s texrxm3nu1ome mnvsatf Duaxr ot1aetoifetyd m uluvo (4tltnxr3oodomD  ueols sruo(rpio1lp elfet tfsrrm(rpno1alenmfcildls elnmpnt) lxrio iy1lpD  neilt) rxoxrpiu1ap   iesas s2tmumo;t4aexo f3iydfm2ulu ont0 etnxo iydomt lneil()t2trirpiydlp n ncsa(fartmxmpot0opt  ictytfs rmn p;t)aexrmr3iodopteanvi t  2xm(rpiu1ale mfvilt)aruau  no1tltoioctatfa ua( ont)treoifcoydom eli s;s0srur(o3oodll nlnei s) Dta(mo;t0tpxn oeiys s2umumo t4artoxo iotlaDrlueo () 2toiopoo4lp e ict ( arurxr nt0teeoio3tatfa2uau onu0alxnmocoodfmD  ieil()seto(m3iy4llte ivs tf Dum( pnu1aex moeilsfa umnmonu4aetoxf tytfpt  uvi s0 eur(rpiudaleelnvils)aDraxr ;o1opeo o3tydfa eau snu)tlenxf oo1lpt  ivo s0 euo(m3nudap nmivsatf Dtr(  ou4oeenmfeiyslsDrlnvs (0 eermr ia1lmt aieo;() rurim oy1alenlneil(fartmxro;u4teto oetyd s2ra( s;()altrxo oadopDr ivi;() exoirpiy4om  mies ( srum(ro;u0apto o3ilsfsDumuvo;(4altrmfcoydlpte uei;t)t2xoxrpiu4lltelnesl()aDuru p;t1texn oeildfm2ea( o u0tleoxf3io1oatrli i;s) 2toir3nydlp elfeil()arumum ;t0aetniieilsfs ul(mpnt0aeerxf3io1fm elies t srxrxrpny4lpe livta()aDrrumo;t1optoiiciatfaDran p;t)tleomf3to1la e ueils s2uo(r iu1ale mictas sDum(ro;o1oleomfeias s ul( onu4aetoio3oadom eaiei;s  rxr(rpou1al n ivils  2ra(m ;t0olenmfciytfs2um(vonu) etnxf totlmD anvi ( s2xrxm3oo4lmtemnetat)sDrmump;o1aleoifetadlm el( pnu0aexrio3oadom eau olt0t2umir io1alte neia()aDuax oou4tpxomieils a rmn onu)treoxo3iodlm e ueo;() rxrxmpnudaptnlfesl()arua(rp;t0aexoif3iad sDea(vs t4 rxoxrcoydlp rau o s) 2trio iodlmtnmnctl(  2trxrpnt1tlx  i3ildlm2elumpnu)tetomrcoatoa eaueil(0s2uoir3nu4ll nlfcs (  Dtmxr ou0oex mo3iytls2rlnvsnt4 rtriocty1lm rlues s0 2urirpoo1apen nes sfa2uaxm ou0olxnif3tytfs2rm( pn(0tlxomrcoa1oa  luvi ()tetrir3iu4omt  nvsl(fsDta( o;u0aeeniieiydfmDum(vsnu)aexrif to1faDraieol(  rurimpny1ap n nctlsf rum(m oo0tpx moctytfsDranms u4aeenio3oytla ranvs s)trxm(o iydole mfeils  rtmu p;u4aleoifcild m2umuvp t4 exnxr3ty1lmDrau slt  rtmir3iu4open iei () Dra(r no4tpenmoetlsls2ean s;u4 ltrxf to1lm eluvi;( teuoxo iu4amt  fvia( aDtaxmpoo1teeomo3tltfm2rlu o;(0artnxo3oodoa eanvol()sexr(o3nudamtelicsls)sDtm(rono1texo feiatlm rmnmon(0tlenio iodfa rlivs;t)texoxopiodam e nctas a2taxmpoo4apxoifctas s emnvo t) ltoir3oadfm  ai i t0teur(o3nu4aleemictl(fsDta(  oo1alxo iciadfm2rl(mpnt)altoio totlaD aueolt  2xm(m3iy4lpt licilsfsrrax oou1oleomi3iysla2uanmp (0 lenif3to1fptrau olt0tetoxrpnudll elicilt  rrrxm nu1alxo i3tlsfaDumuvo u4 lxoir3oadoa r ueilt) exr(rpnodop nlneilsfaDumx  ;o4tee mf3ias a2eaumpn(4 rxrxo oatfmDrluesls0srtr(o3ny4lpeemnvil(fa2tmxrp;u0olxnmo3iasfs uau s t0trtoir iotlm   iei s  etrirpnu4oltnliet s srraump;t0altn fciltfa elumo u4 lxomf3ia1laDe ieil(0srumxrpoy4alen nctlt)srtaxrp;u1aeeo o3tadfa um(mo;(0aeerxociodoa eluvs;t0teuoxrpio4ole  fvi (f Dumu ono4aleoifciys m2um( p () rtoxr3iatfp r nvo (0 rxoio3iu4omen fciasfa2um(rpoo0aetn oeildlaDeanvpn(4aeeriociydlpD ai s;(0srtoxo3ou4omen fcil()sDuaxr no1oltnif3tydfa em( o;()artnmo oadop  lu ols0srtmim oudllenmiei s)arua( pou1oex  fctyt sDua( s u0trenif oadop  lnes;(  2xmirpio1olt mfctatfarum( p;t0oet  ictyslmDelu s t4tltoxf iydopDeli ils)t2urio3nu4ll nmnetl()aDraxroou4alxnmieiytls ean o;u4aexrxo ty1lm   u o;( s2uoxmpou4olte ietat a2urxm ;t0tpxomo3ilsla2rmump t0artomo3ootfp   n ilt) exmxr3iydop  lfes tfarrmx pot1alxoif3tldlsDrmumo;u)arxnmr3oytlptrlueilt0 2xmxm oo4alt  ivsl( sDrr( o;o0ole mieilsfm ranmp t4 etrif3todoaD lnes;(0 2urxmpiu4oltnmfvsas)a2tau  nt1tpto o3tyt m2ea(vo;()aeerirciadopDeln s;s0trxr(mpoy1ap emnet tfsDur(  nu4oee ifetlsfs2ul( pnu) exrxf oodfpteau s;s seuo(o no1ape  fvtls s2tau  ;o0aexnmo3iyslmDul(mp t4 etnmf iy1omDrau ilt)t2trim io4lle mfeil(faDumx p;o0tetn i3tld a2uaumpnu)alxnmf3ia1fmteaivo;t) rxm(m ou4alt mfei (faDta(mo;t1tlenmfeildla2elnms;() rermf oadfpteliei () 2urim oo1lp  mfcsls a2rrxr ;u4texniieildla ea( s;(0 ltnif3io1oatelieo t)s2xmimpnu1opeemnci t  rurx pot4tpt  iciyd sDumn o u0arenmrctatfaD lieo ( s2trir nu1lmtemics tf 2rrxm ;t4tpt ifciysfaDrl(vo;u0 etnmfciodfmD aivs s0 2xrxopoo1ll  mnctlt)aDurxrpnt0tpeomiciysfa2eau s;t0alerxf ootom e uvi s)srxrxr oo1optnlivsas)s2tr(  ;u0tpx iieiyt aDrmump;u)aexoir oodfpte ivi t)t2uo(m iy4omt lnesa(faDtm( pnu4aptomfetltlm emn s;(0arxnxocta1oat lnvs t)s2xoxopou4aptnmfvsa()sDrmumono0oeeomf3iadlm emu o t) exoif tatfa eaneols0 2tmimpno1lpenlietls)aDrrxront4aexomietydfaDrau p t0aeermr ootoaDraieil()t2toimpiy4llen ivt s srrru  oo0altniociltfaDelnmpn()aetoif oadfa eaiesls)teurxm3oo4ll elnctls) 2rrxro;u4tpxnifeiydfmDuanvpn(0 exrxfciadlmtr nes;s)t2trxr nodlpenmfetat) rtrum ot4altnifeiat m2emumo;(4tlermocto1lmDrlivi;()s2tmxm3nudaleemnvi (f rtaxmono1oltnmi3tytlmDumu s u0tetnxo3tydomteau s;t trtm(r3oydamt  ietls  2tm(mp;u4tpxn i3tls m2ea( s;t)tltoio tadlmDrlueol(0s2xoxrpny4apenlicil( arrr(monu4aex mi3iyt mDrmumon(0tetrmfctotfmt  ueil() euo(mpnydom elfvslt)srtm(ront1apt ifciltfm2rmnmp u0alxrif3oodlm rlneslt trur(m iudlle livilsfaruaxmp;u1alx ioeiat aDeln s;()arxnxfcootlpteaivi;(0texmio oodlmen fvs t)srur(mp;o0tet mf3iltlmDrmumo t)aexrxo3tytfmD livo (0t2xrxm no1aleemivtlsfsruru p;o1tpx mocildfs2ran p (4aeenxo3tydoa  luvsls seumiopoudlmtnmnvtls  2rrxroou1olxn fciat m2emnvp;t4 lxriociadlmt  u o ( trurim iy4llenmivs ()aruru o;t1ale  f3iys aDumu snu4tltnxf3ia1oaD luvo;s  rum(r oy4al nmfeia(fsDra(m oo1tpx iociltfa2umumo (4 lxoxrcoydlpt lnvs;()t2uo(opiudapt mfesl(fartau pot4tptnii3iys aDemumo;u) etnmo3iy1fa raueo s)sexrxr iydaptn ics t aDtm( oot4oeto o3tyt aDrm(mpnt)tlenirctotomDrlu i;()t2toim io1oltnmiesas) Duau oot4aptnmoeilt a raumpnu)texrxf3tadlm elueolt0t2xm(opno4lm e ncsatfaDtmumpno0alxniocildla2umuvonu0trtnxo3tytoaDr neo;s trxoio3iodape lnvi t)srtmur ;o1oetomfetytfa rlnmon(0aexrifcoy1omDraivil(0 etr(opny1ol elfvi s)srta(mpnt4apxnmi3iltfm rmnmp ()areoir ia1fa   uesls0 2umxr no4oltelfviltf Dur(rooo0ole ifetldfs elnvp;u4tlxrmrcta1lptr ieol( srumxmpoo1al  lfcsatf rtrurpou0olen f3iydfaDrauvont0tetrmoctotfatrluvo ()srum(o oydalee fei t sDtaxmp;u4tex  f3tat a em(vp t)tlxnir3oa1laDrlneol(0 eumxm3no1lmtnmnvsat)srrr( pot1aex  i3tlsfsDumuvsn(0trxomo3iydlpt livs ( setm(m iydopt  neiatfsrtaxrono4apxn ietas m rl( o t)trxrmf3oy1omDe n s (0srurim3iy4omeemictas)aDraxmpoo0alxomietasfmDrmnvs;(0 rerxocia1fm eau sls  rtr(o3io1apen net s  2umxrpou1apxnmoeias a2rmnmp;(4teeniociydlmDeluvi t0t2urio3iydapee nvilt a2ur(r ot4tpe ifctasfm um(vs;t)arxnxo3oadfmtrlneo t) 2trio3oudlptemncsas sDumu pnu4optoii3tltlsDemnms u4 lenxf3iodlpDeaneil( texo(o iydamtnlieia(faDtrx  oo0aee  ieiat a2umn o;(0 rtrmr3iadfp r ieilt srxriopio1ole  ivt ( s2um(r no0apx  octlslm rl(mp;(4 etrmociatoaD ln s () 2xrxo io1lptn fcil(  Drm(m no1olxoifcilsfa umu o;u4trtoxo3tadfaD lneolt s2uoxmpiu1alte nesasfsrraumoou0opxomi3iyt s emn s;u) ltomrciatlp ean i s0s2trxr3oudlm elfctl( s2um( p;o1aet  i3ildfm ra(vs u4arxrir3oy1oatr n ols  2tm(m nu4lmtnlietltf Drm(rp;t1tlt  fcildlaDrmu p (0alxoir oytoa elueo t0trxrio ny4omen ivt ()aDraxr oo0altniictldlaDuauvont)arenmoctadlpt ln o () rumio3ou4op n nvtas  2taurpoo1ale mfciatfsDrlu pnu0 eeriocoytfmt lnvs;( teurxo3ou4ame mivi (faDta(rpnu4olx  icild m2elums u0aexomrcootopDelu s;s0t2xr(m3io1al   icta( aDrru  nu1oet mf3tysfm elnvsnt4teeoio iatlaDelu i t teur(m nu4lle lfctlsfsrtr(  ou0open fctyt m ulnmpn(4aeerio3iotlpDrlneo t  rumio io1lpt mnetl() Drrx o;t1alxn ieiltlm uan o;(4trtnmf3io1lmD au slt)s2urxr3ou4ap nmictlt a2tmxro;o1oeeo fcilt aDrlumo;u)artnxo3oydlp r n sl() 2urxmpno4olenlnvt s)sDtax pno1oexniocild m2rl(vpnt0tlxnmrcoodoa elueo t0trum(rpnu1olt  fesa(  Dtaurpnu4tpt ifciyt m2ua(vsnt) lxrirciatopD livs;(0s2xrir3oo1ol   iciltf 2trxm ot0oleoioeiydlsDelnmpnt4teenmrciy1oaDe i ol( teuoxr oo1lp  mnes ()artaxmo;t0olenmfeiadlmDua( pnu) renir3ty1lpDrln sls t2xr(o3ny4lpe  neias arta(mp;o0texoifciadls rl(vpnu4 rtnmr3iytoptrln o;( setr(o io1olee fes tf rtmu p;u1aleo fetad m el( o;()tltnmrctytfpDe ivs;t)trxrirpnu1amenlfes (f rra(  ;o1aptnmfcils s2uluvo;t) ltnmrctytomDeauvo;(  etoxrpno1lmt micsl()s2uau ont0aet if3iaslm2elu pnu0altomr3oo1optrlnvi;t  exmir3iy4lmt mncsa( arumum ou0alxnio3iyd s2emn s;(4alxnif oytfm   nei;( srumirpnudlp  lfeil()s2ur(mooo0teeomietaslm ulu s;t0texrir3todfa  ai s;s)tetr(r3no4optn ivi ()sDtau p;u1aeenifeilsfmDelums;t)trxrioctotoat lies;t)srxrxm io4ale  fetat)aDum(mp;o4ape ifciat aDrlnvsnt)altoircoo1faDelnvols0 ruoxr3iodaltemnvt t)arurumono1aeeomfcildlaDulnmo u)aexnxf tatfp eaneo ( srtrim oydom emnetasfs2tm(mpnt0olx ii3iyd mDemump;(4aexrir3ootoatr u i s0t2xrim oydlme mnctl(fsrtmxrpoo4aexomociadla ea(mpnu4trxrxfcoadopt an ils)texrirpiy4op   ivsl(f 2rrxm no1tlx iieiltls rm(mpnt)trtoxr3oa1omDeaiei;s0 rtmirpiydlle mnvtl( a2umuronu0aptomoctat mDra( s u)trerxr3todomt  u o t t2tmio3oodome  iviasfa2uaxrpnt0texnmiciysls2ulumon(0aeenio tadlmDe n ils0srxo(r ou1lm  mivias)sDra(  no1oetnif3iadlsDem(mpnt4 etnxr totlatelivil(0sexrir nu4om emivia(f ruaur ;u4oetn ociysfa2uluvsnt4 lxnxr oadlmDraueols) eumio3iu4al elfvtls) rrr( o;t1optn f3tysfa2ua(vs (4aleniociotoa e n s t0 eur(mpiy1omtelici s)aDraur nu4ape  f3iad sDemnvp u4tlxomfciadlaD  n o;s sexo(r iu4ap e nvs ( srua( p;u1tpto icildlsDrmuvo;u0areriocoytfaDraueo;t  2umir3no4lme mivt s a2trx pot4opxo o3iytlmDemnvo u)trenmfcto1omDeauvi () 2to(opou4lltemfvias  2tauro;o1ale  fciltla emnms t4alxnif3oydfmt lnvo;t  2uoxo iu1amtnlies s)sDuaxmp;t1apxoioeias m ran p;(0 exrir oo1fm eanei s s2tm(r3ou4open ivilt s2um(mpnt0oeen f3iyslmDrlu onu4tetnxr3tadopDe u o;s0tetmio iu1omte ieil()s2raxmpnt4tltnioeiltls2eau s u)alxomfcto1optraneo s0 rxo(m3iudoltelicta(fs2uru  oo1altoifetld mDeln o;t)altnxf oytoate ies;t  rxm(m3oydlm   nci s  Drau  ;u4tleniietlslm rl(vo;u0 ltrir3io1omt luei t s2xoxrpnudlm emicils  rtr(m nu0oex  oeilsfmDulnvs;u4 ltomo oo1fmtelu ilt  2xm(m3nudlle lfvi t sDrmx  ;u4tlt iociysfa2ua(mo;t)trenio iodlpteaiei t s2xmxo3nu4openlnvt sf Dra(r oo0tex mi3iadfa emuvo (4tltomf3ia1oatelneo;s)truo(rpiu4apen nvslsfaDu
\ No newline at end of file
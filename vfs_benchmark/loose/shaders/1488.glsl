@@ -0,0 +1 @@
+nvs s seurxo iu1alt mnvsl(f Dtaxr ;u0tlx  oeiadlm2rlnvonu4 rxrxf3ia1oa eaueils0s2xrxrpoodamt  nvtlt arra(m ;u1apxnii3ilt aDuln o;u0teenmr iydopt ai o s s2tm(r iu4am  mnvilsfs2tm(m ;u1openmf3iatlsDeluvp t4 ltnxf oa1op eln s;( t2tm(opiydlptelicsat  rum(rono4alxo i3iyd m2rmn s u) reoxo3oadfmte ivsl()tetm(rpoo4llte nvta( sDrrxronu4tlxniociat m ul(mpnt4aetomfctatomt lnei;s0 rurxmpiu4ll n fctlt) 2umumo;t4altnmf3tltls rluvon(0 lenio3iotla   ueo;(  2to(rpoy4ope  fvi t sDuru oot0teen o3iydlaDrln p;t4 reoiociatlmt au ils0t2tmxr nudolenlnes sf Dra( pot4tpxo f3iasfaDrmnvsnu4aexoircoodfmtelieo;t0 rtoir ny4al   fet sfa2trxm no4oex ii3iadlaDuanmp (0aeerxr3oatop  li i (  eur(m iodamenmies tfaDtaurp;u0apeniociys s el(mpnt4teeoio ta1fa elieslt trur(r3io4opt lfcia(  2taum ot0teen o3iydls2umnvo u0 ltomrcoydopDean sls)setoiopiy1aleemnvsat srta(r ou0oexn fetytla eluvonu0 ltrmoctytfmt li ols t2xoirpno1opt licils) rua(roou1tptnifeiyd aDrln onu)aexrmr to1lpDr nvo;s0srxmxm3ou1altn nviatfsrumxm no4alxo oeiyt a umuvsnu4tltrxf3tydfa rauei s s2xrir iy4lm e icslsfa2ra(ront4aptomo3iaslaDrl(vo;t0 eerir iadoa rlu s;t0 2um(r3ou1lpe  nctlt srtm( p;o4tex mo3ils s2uau snt)trtnmrctodlaDrai s;() 2to(mpoo1lmtnmnvsls)aDra(m ;t4tlenmictld a2rm(vp t4tleomfciatfmD  nei s0srxmxopio4lpe mfvil( sDrau p;o1alt mieiadlm rmuvo t0 lxriociydla rli i () rxmxo iodoptnmfeslt)aDra(rp;u1tlt  ietlslsDemump u0aexoif tatomDr ivs ()texrxrpnodol emnvtas)aDua(ront1aexnmf3tldlm eluvp;t4alxrif3ia1opt lnvsls truo(opiodlp e ictltf ruax oot4aeto f3ild mDum(vs;u0 renircoytfm e nvo;() 2xmxopiy1amtelfvt t  2tm(mp;o4texnmoctydfsDrm(vs (0 rermf3tatop   u s;( s2tmir no1lmtelnvt t) 2taurpou0tpt iicias s2umu o;u0teenioctytopDelues;(  2uoir oo1llt lfetlt) 2tm(  ou4aee  fciyd a emnms;u4 exnmo ty1opDrli i s t2um(o3iydllen iet ( aDuaurpnt0teeoifeiltfm rmnvp (0 rxoxr oydlpt aivs s)t2tr(m nu1ap  mnvsl( aDrrx o;t1altomietytla2um(vo ()altnxrcoa1op e uvs;( trxoxo3oy1alee fetas)a2truront1olx moctaslsDelumo (4 lxomr iodfptean ilt  rxmxo iy4al emfvil(faDtr(  ;u4apx mo3tlsfm2eln snu0trerif3tytom elieols sexmir3nydolt  feia(f 2rrurpnt1oltomf3ilsfmDuaums u)artoio3oatomtraivils)t2tm(r ny4opeelfvilt sDra(ronu0aptomoetlt a2elums;u) exrxr3oodfa rlnes;()sexm(mpoydalenliesas  Dua(rp;o0aeeniocias s2ra(vs;t0artrmrciydlpteauvs;t) exoir nu4lm emfciasfsruaumoou0tlx mocilt aDelnmo t)arxnmf todoat lu o t trtmimpnu1ll e fct () Dtmu  nt4tlxn f3iasls rmuvpnt0alxnif3iatoaDrlnvi;t0sexoxopnodll e fvt t) Durxrono0aee iietat s rmuvpn(0 lenif to1fa   nesl()t2xrir3iu1lm  mnctas aruaumpnt0aptnif3tytlaDul(msnt0arxrxf3oadfmt an s s0teum(o iydopenmicil(fsrua(r ;u1alenmi3ildla emnvsnu)areomrcty1oa r i i s s2uo(o oydop  livia(farraxr ;t4aexoioetysfmDeaump u4 lenmr3oo1fa rai sl( truoirpnydole mfet (  rrm(mo;u4aexomietldfmDumn ont4aeeomo ta1oaD  uvsls0trurxo3oodlm emics t sDrmur nt4aptnioctyd m emums (0 rtrmf3totop  ln ils trxr(rpoy1omenmivs tfs2rrxrpnt4apenif3ilsfaDea(vont)tlenmfcootlmte u ils0t2urxrpoy1lptelneslt  rum(mpot4apxomicilsla em(msnt)aexoirciadopt  nvo;()srxrio no1ap  lnetl()a2trxm no0texnmfcilt s ra( o;()aetrxr tydoat auvo t  euoxo iudale  iviat s2trumpot0opeoiiciytlsDulnvp t)tltrmr iotfaD  i i (  rumirpnodapt mfeslt  ruau o;o0ale moeiltfm ua(vont)treoxfctotopD auvo;() 2xr(m ou1aleeliet ( a2rru oot4oexomf3ilsfm2umumon(4tleoio oy1laDeanvi;(  2to(r3io1al  lfviltfsrrrx pno1tltnioetldla2elnmo;(4 etrxo3oy1omtrli ol(  eurir no1llen ivias)a2trxmpou1opxn fctydfsDrm(vs t4trxomo to1opDraivslt) etrir iu4ap  mfesas)aDtmxmp;u4oex mfetatfs rl(vs t0 lxrxo iodoptran s;t  2xm(m3iu1amtemnvs s aDtaxrpot4tpxnmoctydfa ranvonu4tltoxo tytlptrlivilt trtrxmpou4lptnlieia( arra(moot1aexomi3tat a rluvsnt) exnmrcio1fp   ies;t0texrxmpiydape mfcil(fsruru  ;o4alxoii3iytlmDum(vonu0trtrif3iotfaDr u ilt0 2xm(opoy1omt  iesas aDuru  ot0open oeiydfs2em( ont0 ltoxrcoadfmD liei t0 rur(opiy4ll  lnct t arum(m oo0teenmociysfm2umumpnu4arxoiocoo1lm   n o t srum(opno4omeelivtas sDur(r nt0aet  feiat sDelnvp t4altnxr tatfaDe nei;s) etmim3ou4lm n nvi tfarurx o;t4altoif3ildlsDumn o u0tltrmf3tydop rlu olt tetr(r3no4lm elncil()s2ua(ronu1opxo i3ildlsDran sn()trxoxocoa1lm e uvsl( t2urim ny4lm e fetatf 2tr(  ;u1tpt mo3ildlaDrl(mp;u4tleoxf ootom   i s;t)s2uo(mpno4lp   fetltf rtruro;t1tle mf3ils a eauvpnt)altnmo3ta1oaDr uei;t  rurxmpiy1alt lfci (f Drru poo4oeeoio3iydfs ra( ont) rxrxo3io1fa rlieolt0teum(m no1oleelnet s srtmx o;t0oee if3iydls2rm(mp;t4artrxf3tytlmte i i;s0setr(mpny1ame mnct (  rtmxmono0apenmietytls ulu o;u0trtoxf3ootlpt  ies t s2trxo3nodlpt lfvsltfa2urumono1tle moetad a2rmnmp u)trtrmf oytoa  aues;()tetoir nydlpe liei (fs2trx p;o0optnmociyd m ulnmp;(4teerxo3oadfa eauvi;t t2tmxm ou4alt miesas) 2tax ooo0olt mi3tysfmDra(msnu)aexoxo3iydlmDranvo t0trxrxo iodol  mnctasfs2rm( p;u0tlxn f3iat s2rauvp;(0aleoir io1lmte i s;()trtoim no1openmivtas)sDtaumoot1apxn f3iaslm2umnms u)alenxr3tytfm r ues;s trxrxr iudlle mncilsfsrurxr oo0tltniictltls2el( s;()trxrio iytlp  an s;(0seum(m3oodlm   nvsls  Duaumo;t1aee if3ilsfmDrm(msnt0aexrmr totfp r nes;s trumxr3iu1amt lnvtasf 2rmumpnu1olxomoeiydfs2ulnmo t4arerxfcoydopDelneilt truo(rpoy4lpen fes sfsrta( pot4apxomfeiatfs2rlumpnt)tlxriocoa1omtrln slt srxrimpnodlm n ivta(fartau p;u1oeen o3iys mDeauvpnt0arenxf iadopDrli o;()srtmxo iodlptnmnei ( aDurum ;o0aptn fciad m rm(ms;u4tetnif oa1lp eaueolt) 2tr(r ou4alen nes ()a2trurono0tee moeiysls2ul( pn(0tltrifctytom eaneolt0seuo(o3nu1op n ivslt)aDtr( poo4aexnii3i
\ No newline at end of file
@@ -0,0 +1 @@
+i s;t texoirpiodom   fvta(f Draur oo1apto i3tasfsDua( pnt)aetnxf3tytfp elies s) rtr(rpoydopenlnes tf ruru pnu1aex mfctadla rmu pn()alxrio oatfp eanvsls) exoxm nu4ame livsasfsDtm(m ;u4tpxnmf3tasla2ran sn() rtrxf iotopt livsls)srtmxo3io1lp   fci s srtr( poo1tlx ifciysfaDrmumo (0 leomo ta1fp e nvo;s trto(r iu1omte netl()arraxm no0alxo fciyd mDeanmpnt4 eenio tydfmD livol() rxoimpiydomte ivtl()a2trxrpou0aee mi3tlslm rl(mo u0texomo3oy1lp eai olt srtmxr3oy4amenmfci t) 2trx poo0tlt iieiasfm rauvsn()teerifcia1lm e uvs;t texmio3oy4lptelnetl( srrrum ;t0tee  f3iad aDranvsnt0trenxoctytfpte ies;()texr(rpiodap e fvi t aDuax oou1tltnmf3iytla2elu s u0 eeomfctadfpDe ueils)trum(rpiu4amen fesl(fsrta(rpnu0teeniociydfmDelnvsnu)teermrcta1fmDean i;t)t2xrxm nudome lfcs (fs2taumont0teeo f3tydlmDuanmon()treoir3oo1fa  luei ( s2uoim nu1lmee ictlt)srtaxmpou0oeen o3ilt m2emn p (0altoif totfaDeauvi;t)trtoiopiydol   nvtlsf Dua( p;u0tetnmi3tydlsDua( s t0trxoif3oa1fmD au s (0teuoxm3oodomenmncs ( artrx  ;t0aleo fcilsfa2el(vo;t0 etrxo iotoa e ueo t tetoiopny4amt lnetl( s2rmurono0aexoiieiydlsDrmuvs (0 ltrxocty1oaDe uesl(  2tmiopiy4am nlnvil(f 2rmu  ;u1oee ifciys a ea( sn(4 lenxo io1fat  neo;(0 2urio3nydlle miesa(fsrua(m ou4tltomictldls2uanvsn(4aeeomrcia1faDrai s;t0 2tmimpnu4lmeemfctl( aDuaxmo;u1tpto i3tltla rauvo (0aetnxfciydlmtranvo;(0truo(rpny4ome livtl(  2rmxm ;o0aee mf3tasfm2uauvs ()tlenio3tydoa e nvil( t2toirpou4olte nct tfsDtrxmoot0opeoiieiydfm2ulu o u)aetnmocoy1om r ivo;s0seurxmpnydam  mfetat)s2rax  ;t4apeomoetatla rmn s;t0areomfctodfpt  u s;(  rto(o3iu1lptnlfetl()arrmxm nt0oexn feiys mDeauvsnt4teerio totfmDrlueol( t2xrio3io1amtemivi sfaDrmum ot0tetoifeils s ul(vs;(4 rermf3oy1fmt ln o;s) 2xoir3nu4aleemicil(  Dum(rp;o4tlx mieiyslaDeauvs t4altrif3tytfpte nvi;t t2ur(m3nodlmtemivtlt)srumxrp;o0teeomi3iltfsDra(ms t4 leoxo3ta1oatrliei s0texmiopno4apenmnctlt aruaxmpnu0apeoii3iytfa2rmuvo;(4trxrmfcoo1la  luvolt0s2trxr3nu1lptnlietls)aDrrum ;t4tpen f3iysfaDrl( onu) lerxf todoaDraies s trtm(r3ou4oltnlfctatf 2trurpno4alen f3ilslm2ulnms t)alxoxo oytfmDeau s t  exriopiodlmtelnvtltfsDtmx  ;u1tpx mo3tytla2emump;u0aetrxo to1fatean s;t  rumimpiu1op nlfvtlt)sDtm( p;u1aetnioeilt m rln snu0 rtnxr3iadoaDeluvils trxmxr3oy4ale liei t) Dtmx p;t1ole  ociasfm2emn sn(0 ltrio3ta1lpD aieslt0tetmimpnodaltelnet ( sDtrxrpot1tetn oeiyt m rl(vp ()teerir iy1omDrauvo ( s2xmxo3oy1lm elfvta()a2tau pnu4ole  o3tlt aDelnms t4aetoif3oytop rau sl( t2xo(o3no1lpeelncsatfsrur(rpno4tpe ioeiyt s2ra(msnu0 rerir oatfm r u sl(  exrxm no1omtn ivsa(faDtaumpno4tpt  ietldlsDea(vont4aeermr3oodoate u i t trumxrpoy1ole  nci s) rumxrpoo1tptnmfctydls2rm(mo u0artrmr iatfp r ueil( t2xoxrpiudal  mfei (  rur( oot1alxn octysfsDelu p;t)tlenmr tydfm rlu sls)sexmxrpiy1lleemfct () rtmu ont4apt if3tltlm ra( s;()artoxr iydomt ai i;() rxmxr iudamtnmiei tfsrtau p;t1tlenioctltls em(ms t4trtomr3oydomteaieols0t2xrirpoo4llt lfci ( artr(mo;o4olto i3tld sDul(mpnu0 eerif3oo1lpt an s;t0texr(m3oy4oltnlncs s)aDra(mo;u1olt ifciys a2ranvp (4 ltnmoctydlm   uvilt  2xm(m3oodolenmncsltfs2trumont4tpxnioeiad sDuaump;()tlermfcoatopDrau o ()srxmirpiydol  lietlsf 2umxmooo0alxoiieilt mDemnmp;t4artnir to1lmDelnvs s  eto(r3io1op nmncils)srrru  ou0apx  ociasfs rmuvon(0aeeoxoctodomte ivo () 2xrxm3nydapee icsls)a2trxr ot1tetoioetyslsDuanvp t)texnxo3to1oateanes;() eumxr3oodlltn netl( arraurooo1apxnmocilsla emnvp;u0trtnif tydlpDrli olt) rtmxrpnu4altemiesls s2ua( ooo0tle mociadla uluvp u4arxomf3oo1lm eln o;s)trtoxmpou1opee icsat)a2tm(mo;u0tlx  oeiydfm umn o;(0alxnir3iotoat ai ilt)teto(r oy1am n fcsl() rtm(ro;t1tleomoetyt s2rlumsnu0aexoif tydlpDelueslt)t2xo(o3nu4al n nvslt  Dua(r ;u0aetniicilsfmDemnvon() reoiocoatoa  livilt0t2urxr nodap elfeil() Dum(  ;u4tlxnmiciysfs ul( sn(4trtomoctodfm rlnvo;( t2xmxo3ou4olenlfvtl()sDrrumo;u4opx  i3iltlm2eln pnt)trxrmoctodlateau ols0srtrxr nydolte fvtlt)a2taxmpnu1alxnioctyt s eanms;t4 exoif oodopDrauvils0trtr(r nodlle mnetas) 2tmxr ou0tleo ieildfm2elu s;()alxnir tydla  au sl()s2tr(rpnu1ale lnvs t  2umu  ;o0alx iicils m2rmuvo;t0trxnirctadfat  i s;s0s2xmxr oy4lme mieil() Drm(r ;u0oeenmf3iatls2ranmo t0altomo3oo1fa elneils t2xm(o no4ap  lfetatfaDumx poo0tpe mieilsfa ulnmpnu4 lenio3ty1fmtr iei t s2uoirpio4am   nct sf rtrumo;u0teeniictatls ranmsnu0 rerircty1lpD lnvilt)t2xr(r3oo4lle lncs s artax  oo1opt ifeiat aDrmuvsnt4 lxrxrciodfp e nvslt0srtrim oodoltnmivtl()s2umxmoot4alenmfetld mDulnmo u0 rxrifcoy1fmD ln o t0 exmim3ny1apenmiet (  Drmum oo1oet mi3iadlsDea(vp;()aexrmfcta1om eaivs (0sexrio no1lltn fcsls sDuau  nu0ape  oeilt sDem(monu4aexnxr3oodoaD aieols t2ur(rpno1apeelivils)srrmxrpot0aptnmoeiysfa2ra(von(4 etnmr3oydfmDrauvi;(  rxmxm3iu4amt lnvia()a2rr(m ;u4tex ioeilsfsDuanvsnt)artomr iodfm   ieo t)trtm(rpiy4omee ncia()arrrx onu4apen oetat s rmuvp;(0 rtrxoctydlmt  nvilt0s2ur(mpnu4optemivsas) Draxrp;u4aeto o3iltfm2rmnmpn() lenxf tytlm r ivo;()trumxopio4om n icsa(  2trx  ot1oet iociaslsDumump;u) exnio totfaD  u s;()trxr(o3nu1opt lnct sf 2trx ono4ope ifciytfm ea(mp;(4tetoxo3oy1lmDelieslt)seumxmpoo4opeelnes (fsDumurpou4oet mfetad s2ea(ms ()texrxr oodlp r iei t0s2umio3ny4omee fviasf 2urumoot0texnmfcildlaDem(vo;u0arxnxfcty1lmDrln i t)trtoxrpnodop  lfetatfarrmurp;u0oexoif3iytfs uan sn()texnmf ia1oat anvsl()t2xoxm3nu4om emfct t  2umxm no4aeenii3iytlmDem( s u4 eeoxo3ty1fmt ai i (0 etmxo3ou4olt  nvia(fsDua( p;u0tpxnmfeiytfs2emu p;(0aexomo3tatopt  uesls s2toxm nu1lptnmfet ( artmx pou0tpe ifctlsls2eaums;(4 reoxr3todfptelivslt)t2tm(opiy4ll nmfeia(  2ta( o;t0opxoioeiadlm2eluvo ()tlxnmoctydlpte nvi;(0srtm(m3iydaptnmnes (f 2tru  ;u1tpen i3ild m2uluvpn(0arxnxfcia1oaDranvo s0 2xr(m3no4optemfci s)arua(r ou1altn f3iasfm elnvont0alxniocoydlpte u il(0srumio3iu4ap nlfetl(fs2tm(rpou0oltomociyt m umumon()alxoio3oatla rli o (0t2trxm3iodlpee fctl() 2taumpou4alx mfcias mDel( p;t4 rxrio totom r uei;s  rur(rpiy1olee nes ( aDumxmpot1tpeniociad sDum(mo;(0aetnmf iadoaDr u ols  2xmim iy4llee ics t) 2tru p;u1olen i3tadfs2rmn o u0tltoxocto1op   neo s0 exm(r iu1apenmnctat)a2rm(m ot0opto o3tld aDrmnmont0 etrmr ty1fmt  ivilt)sruo(mpoy4llt lfciltf Drr(ro;u4tpe mfciysfm emnmo;t)tltrif iodfat  neo;t) etm(o ou4oltnmnvs s)arrm(m nt0apxnmoeildfa2eau o ()tlxoirciotopte neils  2xoim3iu1openlnesl() 2umu ooo1alenioeiasla2umuvpnu0teeoxr3oatfmtelneo t0tetmxopoy1apenmivil() rrmur oo1aeeniieiydlm2rmuvsn() lermf3totfm eauei () 2uo(r io4lm e nvtlsfsDta(  nt0teto fetasfsDeau o u0texrxo iadfpt an o;( texrxr nu1amtn ies ()s2um(r oo1tee mfciydla emumo (4altoxf3ta1fpDe uei () exr(m oodopt mneiatfartmxm nt1teeomoctlsfsDuauvs (4 exrmf3oydlpteaueols0 2xrir oy1al n fcsls  2ta( p;t4tpx ifcild s2rmnvp t0 rxnmf oa1fpt an o s)trtrxrpiydlpe  ivta()srtmur ou1oexoifetltlm umuvont0trxnmfcoodfa rlu olt)teumiopoo4ope  nvias srtmx ono0opxnmf3ildfm2eaumpn()arermrcoydopte u i;s) 2tmiopnu4lme mfvtasfsrrru oot1tptomf3tydfm ra(ms (4tleoif3oa1la elivols0s2tm(rpiudlpt lfeias sDtrurp;o4aptnmi3iasfm2ulnmp u)tltrmo3io1laD li s s) rxo(m3io4lmtnlivtas) rrrx  ;u4tetoif3iyt m rm(vpnt4 rtrirciydfm e nvolt)sexo(o3iu1aptnmfvi ( a2umumpnt4oet ioctydlmDeanmont4aexnmo ta1fatrliei ()seur(r nydal  mivs sfsDrau  no0oeeoif3tadlsDrmn on() rerxfcoy1fmteluei t0 2xoxo3iy4lmtnlfvs tf ruaurpou4tptoif3iatfa2rl( sn()aetoxo iytlat  u s (0t2tr(m3oudaptnmfesa( s2tmu pno4apt if3tysfaDul( s t4aeenio3todlmDrauvo (  euo(opnudopee nvi s) Dtmxrpou1tex moetydfmDum( on(0 ltrir tydfmD lnes () euoxo ny1alee fvtl()arrr(m ;u1tpxniietasfaDra(ms t)aexrio totopt auvo;s)t2xr(mpiodlm  liciltfaDuau pou0oexoif3tlt a emn o (4alxomf3tatlpDrlneil(  rum(m iydlp  mivtls) rur(ro;o1apenmo3tyd s2umu pnu4trxnmo ootfa rlu sls)srtoxmpou1lm   nviat  2uaxm nu1apto fciyslsDum(ms t) rxomr3iytla   i s (0setm(r oo4lp  mivsas artmxm nu0opxomfciytla2eau o;t0aeeoxf ia1fmteli s;s  2ur(mpoo1op nmnet sf Dtm(rp;t4alx ifciad s ul(vpnt0 etoifcia1fm  an s;(  etoir ny1om nlfvslsfaDtmu pot4oeeomfciadlsDeauvs;(4tltoio3ty1lmte i sls  ruoxm no1opee ict s)aDrmum nt1tle  f3iadfa2em(vonu4 lenmfcoatfa rauvi;s  2xmxm3nudlpt mfei s a2ururpnt1tpxo octls s2ea(mont0teerxf oatfa e uvi s0 2trxo io4ame mncil()s2uru  ou0opto f3iytfsDulu s (4areoiociytomDraivolt  rxm(rpiy1ame licil()sDrrxmono0aetnmoctasfaDrlu pn(0 lxrxfcta1la ean o;( t2xrir3nydlltnmfcsl(  Dra(mo;t4aptoiicilsfa2rlnvs u) etrmo tatfmDrauvslt sexo(opio4om e nctlsfsrrrxm ot4teenii3tatfs2ran s;u4aexomr todomD lnvs s trtrim3ou1aptemict ()sruaur no1olxn f3tyt a rmn o t0 rxomf tadfmtr nes (0s2uo(r iodal emivtat  Dua(m nu1tpxnmf3tlsfm2ul(mo (4 leoiocia1omtelneol( s2toim io1ome  iei () Dtr(ro;u0ole ioeiat s ulu pnt4artoxfcoatopte nei s0srtmxopny4lp  livi s)s2ta( ont1opxomf3ildfm2el(vp;u)tltrmrcootfa   nvols sexrim3io4ol n nvi tfsrumu ono0apxnmieiatfa umnmsnu)tltnxo oy1fptelivi t0seur(o nodop elicsat)a2raumo;t0aeeomieiad a2em(vs () renmrcio1lmt lieo (  2xrxrpio1lmtelfetl(fs2tru p;t1aleo ieiys a2ul(mpnt0aleoif ia1faD  n o;s0t2tr(r iu1ol  mfcias)srrm( ont0texo i3taslsDemnmsnt0texrmfcto1oatrliei ( t2uoxr iodamtn icil( s2tm( p;o0olxoifetysfm em( o (4trerif tydoa eai s;t) exmio3iudomtnlfvta(f Dumxm nu1aetn ictldlm emnvs;(4tleoxrcio1latr ueo;t0 2xoxopnudapeemict ( arrmx  ou0oetoif3iytlmDrl( pnu0teeoxf to1lmDeai s;s tetoxopoodoptemneias) Dtrxmooo4oeeo i3tydlaDrmn p;(0 exrif3oadfmtrli s;s0s2umxmpoy4omee ivsls) Drrxro;t1ole  fciltlsDuau p;(4 rtoif ty1omteaieils0texmio3oodoltnlicilt) rrrxmp;o0teen feiydfa rauvp u)trxnif iodomt aivs;( trumxo nu4omt  ict s) 2ua( pou0oexo fctasls2rmnmp;t4arermr3ootfaDeaiei;s)trurir3oudamtnmnvtat)a2ra(mp;o1apenmf3iydlmDulumon()altnxocia1faD  n o;t sruoxr3iu1lm e iei t)s2tr( o;o4aleniieild a rl(mpn(0tetnio3oa1lptelneo ()seuo(r3oudomt lncslsf Dumu pno0aex mietadfmDemums u4teermf3ta1laDrlueo;s)srurxr3oydom  lnesat)sDum(r ;u1ale mietys aDemuvo;u0 ltrxr ta1omteai ol( srxm(o ny1ol  mfetlt) 2umur ot1tleoioctat a ulnvs ()aetnmfcoy1fa eau sls t2urxo3io4apenlncia()aDtmxmpot1olxn icild sDua(vsn(4trenxfcoodomD lieols srtr(r ou4om emfvi ()a2rax p;t4olxnmfeias s2em(vs u)arxrxfctadlm e ieo t teurxm3no1apen fes t) rurumooo4tpxn feiltls2ranvo u4 etnxf ty1lpt auvi (  eurimpoo1amtnlfesas)srtrxmont1tex mfciatlsDrm(mp;t)teenxr3iytoatrlnes;(0 rto(mpiodalt  icia(fa2rau p;u4tltnifcias s2el( o;(0 exnio ootoaDe uvsl()srurxo3nudlltnlivt ( aDtax ono0opeo fciyslsDumnvp ()areomo iy1om   u i s srxrir nydaptnmnetatf rrmur ;o0aptoif3iltfm2rln o t0 rtoio oodlate n ols0 2tmxm3nudlptemfvtasfaDtaxr ;u0olx miciad m2elnmp;t0teermr tydlmDr u i t0 etmxo3iu1amt lnvslt) 2rrx onu4opxnif3tat m emnvs t0 eerxrctotoa eliei;(0trtrio3ou1ope micsl(fsrum(r nu4oeto fciydlm2ea( pnt)aleoir tydopt  neo t) rtrio oodomt miviat)sruaxmoou1apxnmocias a2em(vpnu4alenifctydomtr i ol( s2xriopiy4lmtn nctat srtm(m ot0texnmocildfs rmumpnt)artnir oodlpD au s;t0 2xmxr3iu1oleelncsa(f rtr(ronu4aleomf3iat a emnmsnt4artoio3ootfptranvs;s  rxmim3iu4ll e nvsas  2rm(  no4aet mfetysla2rmn o;(4 lenio3iytfmt an o (0seto(opoodoptnlnvt ( s2rm(  ;u4aptomietydlm ul(vpnu0artrmfctotfpDe i s;s t2xrxo iodlmtelfetatfsrtmu o;u1opto feiydfa2emnvp;(0tltnir3oo1fmtr i o;s trxoxr3oudlm emivslsf rrr(mpnt4openmoeiadlm2uau s;u4trxrif3ta1oate neo;s0srto(o3iudalenlivsat sDtaxr ot4tetomoeiydls2ran on(0alxrirciotlp r i o s trur(opnydllenlivsas a2raxr nu4apeo ociadla umuvpn()aeeoir3oa1faDeauesls) etrxopiu4lm emfcsat)a2tmx  nu1aleoii3ilslm2ea(vo;t0 eeoircio1op eluvil()t2tmxopno1apeemics s  Dururpoo1olxoifeiatfaDrln pn(4aexnmfcta1fptrlnvolt)texoxr3ou1llen feta(f Dtaumo;t1aexn o3ilsfs2uauvp t0texnxo3oatomtrauei;() 2xr(m3oodap nlictlt srtrxrpot0ole iietld s uanmp u) renxr iytlmt aivo s)teum(m3nodape  ivt sf Dtrurpno4apx mi3iat aDum(vp (0teenmrcio1om e nvil() etoxo3oydaptemies tfaruaurono1tpt  fetltls emumo u4 rtnif3iodfp  lu s s trto(m3io4ap e neslt) rtm(mpoo0aptomfeiatfa2rm(vo u) rxnxrcty1lmDraueo t srurxm3ou4opeelics s)srtmxm no0aptoiietltfa rlnvo t0 rtnmoctadopt lieo ( seurxm oo4al   icsat arua( p;o1tpe  octydls2em(mp;t4 etrio3iytfmDeanei s)tetoxo oudlmeelnvsa( srrm( pot0texnmociys a emnmp;(4 leoir oy1op  aivi t setmxm3oydap nmivt s s2um(rooo4alxoii3tld mDrl(mo;t)alxoiocoo1om  lnvolt0sexo(m no1oleemnvi (fa2tr(m nu1apt iiciad m em( p u4trtnxf tytfpDraivs s  rxmir oodoltnmfes t) Dra(rp;u0aee ifcias mDemnms u) ltrmo3ty1op  lueo;(0teto(m oodomt  iesa( s2taxr nt4tee  octadls2rlnms;t0 etomfcoadlmD  uvil(  2toirpnydlp e ncsl(farta(r nt0oex mo3ias mDelnms ()aexnxfciatlmt lies;s0t2trxo iodalenmfes tfarrrurp;t1oetn fciyt mDrl( p () exomociytfpt lueols0 2uo(rpou1aleemici tfaDrrx pot1tet  oeilt m elumo;u)arxnifcoatomtrlivo;(0trtrxr io4lme mfvi s)srurxm no0opxo oeiasfm2rmu p;u)aeerxr tadop rlivo;t sexoxrpno4oleemietas)aDurump;u1tltnif3iadlm2ulnms;() rermo3oo1fpD lies;t0s2xrxmpoodalte ieslt  2tmumont0tlto feiysla ulnvp (4 lxrmr3oa1fa  aieslt0srtm(opiu1ap   ics t aDurxrp;o4oex  i3ilt m elnmp t4 rtoir3tydfptrlivs;s)s2xo(mpny4al  mfetat  rtaump;t1opeo feiyd sDulnvs (4alxoir3ia1fm elieo s tetmim3nodomeelicilt) 2uru  no1tpt mo3tat m eanmp t4tlenio ty1opDeln i;s  rurimpiy4ol e neia(  Durxrpou4altnio3tldfa2rmn p t)tetomf tadfpDeliei;t0 ruoxo3oo1lltnlivt t) Dumumoou4apxoifciad s2ul(ms;u4 eenif iytlp ran o t trtrirpno1lm emncslt aDrau ono1opxn fetlslm el(ms;(4texrmrctydoaD auesl( t2uo(r3oodome lics ( srraurpot1tlt ii3ildlm ua(vs;u)tleoio iotoa  ln ilt)seurxo3ny1apte fvi t)srraur ;o1tleomicils mDulnvs t)tetomo3tatlp  aneo s) exrim oudalen ici sfsrtr(mpno0aeeo i3iad m2emumont0trxnxr3ootfpDrli il( s2xoxm3ny4lmenmiesls) ruaxmono4tpxo fciysfaDrmums u0trxoxr3ta1fa  aivsls)trurirpiydop e netatfaDraurono1openiieiytla rau pn(0areomr3ia1omDrai sl( srurim no4lme lfet s a2ra(mono1tpeoiiciasfs eanmon(0 etnmf3iodopD  i ols0 exr(mpny4am  licsa( sDua(rpoo1optnio3ildlmDulnvo;() eerir3tytlaD  nes;t0sexo(rpou1alee ncs s srrrxrpoo0altn f3tld s2ul(mpnt0teenmo3oydfpDr uvols0texr(opny4lp   nvi ( s2tr(r oo0tptniiciadfaDrlnvs;u0arenmf iodlp  livs () 2xoio ny4al  mnvt s) 2tm( o;o1tpenmoeias a emuvp t)alxnxf oo1fpDe u i ( sexr(m io1olte neslt  2uru o;o4tleomfetatls ranmp () etoif to1op  anvi;t0 eurxo iydlle mfesas  Dtrxrooo4opxn fetasfa2eanmpnt0teenif iodlaDraiei ( sruoiopou4op emicia( srum(rpnt1aleomociatlsDelnvs;u4artrir ia1la r ivi;t)t2tr(r3no4oltnlfesl( artr(rp;u4aet iictad mDea(vsnu0tltomo3totoptrlueo (0t2xrxr ny4lm nmivtls  Draxr ;u4aexnmo3tltfaDuanvsn()tltoxo iadlp rlivo t)srtmxm3iy1ol nlnes sfsDtrur ou4aeto ociad sDuaums;t)aetoiocoydop e neilt)t2uo(r3oy4om elivs (f rrmu onu1ope mo3tlsfm2el(ms t)texrmr ty1om  lnei t0teuoxm3io1ll elfesatfs2ua(mo;t1tpeniicildla2em(vont0tltnxfciadlmt au i;()seuoxr3ou1aleemivs tfaDta(mont0tpxo ociyd s2el( p;t)tetoxf tytoa r nvi ()t2urxo no1am e fvtlt)srrmxmo;t4texniieiasla2rln p;()alerxfcoadopteli sls  2tmxm3nodomee fvtl( arrrumpou4tee ifetltla umu pnu)alxrircoa1fp eluvs;t)srurxo3iy1alt mfctat  Dumxmoot4tlx  ieilsfm rmnms;(0 eenmf tatlpt lueil(0 rxo(o no4ol nlivsas) rra(r no0opto ieiydfmDel(vs;(4texomo oatom elivs t seuoir3nu4op eliet tf Dur(mpnt1tlenmf3ias sDrluvpnt4 etrxr3oatlaD ln i;() exmir no1oltn neias s2rmurpno4olxoifcilsls2rlump;() exoxrcto1lmtrau o;s)tetoir no4ole lfet ( sDua(m ;t0olt mf3iadfsDean on()trtrifctytlatrlu slt0srumimpnodlptn fvilt)s2trur ot4oex iieiatlm2rmump u0alxnxf oatla  aivi;( t2tm(r3ou4ape  ncslt)srurum ou1alen feiasfa2emn s;(4 exnxr oydlmtelueo;s0 rtmxmpoo4oltemics t s2urumpno0openifciatls2ua(mo;(4tleomf3iodlpDran s t  rxo(rpno4ol   nvtas a2ur(m ot1apt miciltlm2rm( pnt4aetnmo3oo1lp rln o (0s2trxo io1alenlneilt  rrrurpno0apxn i3ildfm2emnmpn(4alxnmfcoytfa r u o (  2xmir oy1lpe lfvil(  rumurp;o1oexniiciadfaDea(vo;t)texrxf3oatomtelneilt0sruo(mpny1altelnvsltfsDtr(r no1ape  f3tat sDranvsnu)treomrciytfmD lues s  eurxr iy1om nmivs () rtrumpnt1tltnioeiydfa ran p t)tlxoiociatlmt aivi;t0sruoxr iu4amen netat)aDtaxrp;o0texo i3iydfmDra( p;u0 ltnxrcia1omt lu s;s0 2tm(r3iu1om nmnctlt  Dta(m ;t0opxo f3iatfs2em( pnt) rtomo iy1opte neo;s) 2xoio3iu1lm   ictlt)a2rrum ;o1aexnmf3iys m2ulnmo (0 leomr3iydomDrlnei t0 2to(r3nydomenmieiasfartmxmoot1teeoifeiltfmDea(ms t0 ltnmf iytom rlnes t)seumir3oo1lmtemnvt ( a2rrum ot0oexnioeiatfm2elu snu4trxoio3tadfaD anvsl(  rtm(rpnodaltnmnctat  Durxmp;u1altnmoetatfa2umnvo t0 eeoxf tydfa  luvs;()sexrxopio4lme lnesa()a2tr(mp;o1aee moetls s2emnvonu4altoio3iodlaD li o;(  2urxm iodamtnlivi ( s2rrxro;o4tetn i3tadfsDemn o ()aexnxf3oa1lm r u o;s0 rxo(m3nu4lltnlics ( a2trur ;t4apt miciyt sDra(msn(0 reoxociytlm raueil()s2tmir3oydap   fcs ( a2umxmono1tpxo ociysls el( p u) lxnxf iydlpDrli o;s)srtm(o3iudal nlfct t a2rrur oo1ole ii3tat aDeanmon(4 rxoif iodfp elivo;t sexr(rpou4oltnlnvtat s2rmumoou1aleomieias a2uanmon(0 rtomo to1fpDrauvsls  etrio iudlptn feia(f 2raxr nt1tetn o3iydlmDuaump;() lermociydfa e uvo (0seumimpiydlpt  icil(  2ur( ono1alen i3tls m ra(vont4aexrif oytlpDrauvi;t0trxmxo oodalen fetlt) Drrxmonu0apxn icias sDrmn s (0 exnmo3iy1lmD li o (0srxm(rpoydop elfcilt s2umumpot4tet mi3ias mDumnvs;u4 rxrmo3tadfm ran il(  2xo(m3no1ll nmfvsatfsrra(r ;t0tet mfeiydfs2ran p u4tlxrir3oy1lat ln o t0 2uo(r iu1lpte fctas aDtau ooo0apeoioetydlmDelu o u4tetrmr3iotlm  livi s)trtm(m nodaltemnvs t)s2tm( pno1ole mo3iadlaDem( s;t0 ltnxf3ty1fpD  ues s)srtmim no1ale mfvsltfsDrm(rp;o1apx  o3ilsls um(vs;t4alxrifcoy1fp  anvsls0srtr(mpno4ll   neslsf rrmurp;o4oee  oeiaslmDeluvs;u0 eeoxf3iytop ranes;(  rto(rpnudaltn nes sfsrum( p;t0tpx iociysla ua(mpnt) eenxr3todla raivi;s) rxrxm ny4am e nvs t s2ta(moou4alx miciltfaDeauvs;t)aexrxrciytlpDrlnei () 2xmxm3no4lpenlnct tf Draxro;u4apt  o3iltlmDrl( s t)tetrif3tatlmte ivi t)tetrxr nudll  lieia()sDtaumo;t1aex  fcild a2elu p;(4texnmfcoo1lmDeauvi;s t2xmxm3nu4olte ieiasfsruaxmp;o1apxnmi3tldlaDul(vo;(4 rtrxo3iatlaD  i s;t  etm(rpoy4omtnmnetltfs2ua(roou4tpeoiietysfsDumn p;u4tltnmfcio1oaDe nvsls trur(o3no4omenmivia()s2taxmp;o1tle mf3iatfaDrau pnu0teenir3oodfpDraiesl(0 2tm(r3iu4lmenlncta( s2tmx  oo0oexn octltlaDuaums;u)aetrio tytop raivils)t2xmimpoo1ope mietl() Drr(mpou4texn i3iys m2uanmo;t0 rermrcto1opteaneslt0trxo(mpio4amt mfvsl() rrrumo;t1tpxomoctlslsDua( s;(0teerif3oydopDelnvs (0srtoirpny4lpt lncia(  Dtax o;o4aet  ietltfm el(vp t4trxnxf iy1om e ieo;s)s2to(o3iy1lmt lfetlsfsDurxront0texomociat aDua(ms;u0aeeoir3oadfat anesls s2xoxo ou4lpe  fcsas srtrx o;t1alenmo3iysfa2rm( o u)trenxr iytfm   nvols  etoir nodom nmnetas)a2ua( o;t0tetn fetld aDra( p;(0 ltnmr3totoaDeaueilt  2xo(rpno1al  mnvil()aDuaum ;u0oet  oeiyt a rm(msnt0trxrmfciodlat an o t seurio3oydam elfetls aDtrx o;u0oexnioctlslaDuanmo;t0areomr3totfptr iei s)trurxr nydamen nvi s a2rrx pnt0oetn feiydfaDraump (4 lxnif oodlateluei t0 eurir3io1omtn fvi s)srtm( ono0olenmictyd a2em(vp t0arenio oy1opDeln i s0s2xm(m no4oltnlncslsfs2umxrp;u0tle moeiydfa2eanms u) leoxf tatfpt lneolt0s2xmxr3iu1am e nci sf rumurpot0oeenmfciyd sDem(vs u0teeoxfcoadfp e u s;t texr(m iudolenlnesls srrruro;t0tltoio3iydfmDeaumo (4aleomf iy1lm rai sls  rtrimpoy1amt  feiltf 2umx  oo0oltomi3iydfs2uanvo;(0trtnmo3totoatrln s;s  2tr(rpiu4om  mivta()sDtrxmo;t0apt mf3ilsla2eanvp u0 rxoif3oa1oatraieols trxmxmpoudap n neias  rtrxro;u0tex  o3ildfa um( p u4teeoxo3oodfaDeliei;t t2tmxopiy4omtnmicsl( arrr(mo;t4ale mf3iltls ua( s u0aeeoxo iodoa r nes;t0s2tmxmpoo1llt lnciat srtrxr nt1aee mociasfaDea(mp t4tetnxo oodoaDr neilt)srumxm iy4ale licsas  2ta( oot0oltnmfctatlaDrm(vs;u4 lxrmociytoaDeaivsl(0srum(r3no1ale miet s aDuru p;u1tee io3iasls2ea(von()trenmo tydfmDe ueo s0 ruo(opio1alt lnvia()artax ooo1oetn o3tad m umn o t0teeomo3oy1fpDrai i;()s2xoxm oodapt micslt)srraxrp;u0apx if3tlslaDra(mo u0 etomociotfaDrlneols0 ruo(r oodomtnlfesl( s2ta(rono4altniociatfa rauvonu)arxrif3ty1la e n o;t0s2trio3no4lm  mfetas sDuaxrono1oexoifeiat s ulums;t)arxoir oo1opt auvo;t0s2toxo iu1lpt  nvt t aDrrurp;t1tlt mfcils sDem( p t4 eerxo3oa1lmDrlnes;()t2uo(r nodllt lnvtasfsDuaxm ot1opt if3ildfs2eln o ()alerxf oytoateaivi s0srum(opny4aleelivt tf rurxr oo0apxoiocilslsDeluvo t4trtnxf oo1omD  nvi t)truoxmpnodlpee nesl( sDraxr nu4ape  ieiadlm2ra( p t0trenifcoydfmDelieils0 2toxm nodlltnmfct tfa2rrumpoo4tlt mfetyd sDumnvo (0tetomf todla   u slt)trxr(m nudoltelnvtl(  2um(  nt0texnmoeiad sDua(ms u4artoxfciy1om  aneils sruoio3iu4apeemfct sf Dua(moou4tet  feiytfa rlu sn(4arxnxfctotomD lieol(0 euoxm3io4op e nes t)sDurxr ;t1apeomo3tas s ua( snu0 lxoxrcoatlpt anvo t0truo(opoydlmt mfcsa() 2um(r nt4altn ociadfs2el(vs;() exoiocoytoptrlies s seuoxr3io4lle  fctltfaDrm(rpnu1texo fetltlaDelump u4tltoxocoydlptrln i;s0t2umxmpiudlpt lnvilsfs2tax ono1oetomo3iadla2rm(mont)areoifctotlptrlivil( trtm(r ou1amt  fetat)sruauroot4tpxomoeiydfm rmumont0 exnmfciadfa  li ols srtmxrpiu4ap nmiet tfs2raxr oo0tpe  octldfa uau pnt) ltnir3oytfp  anvo;() exoio no4aptemnesat  Drrx p;o4tpe  oeilsfa2uanmpn(0tlxnxoctytomteau i;(0 rtm(rpiy1opt lnvilt)sruax o;t4tlx  f3tyt s ea( pnt)alenmrcta1fpt luei t)s2triopnodam emicsl( sDraumo;u0opt  fciadfmDemnmp t0 reoxrciadlatraneo s) euoio3ny4omtemnvs (  2rrxm ;t1oexniiciatfs2rm( o ()arermocta1om e u sls0texmimpoydom nmneias)aDra(mooo4tex ii3iad mDul(mo u0 rxrir iytoptrlnvols seur(mpiu1lme livilt  rtmu pou4tpeomf3ildfm2rluvp u0trtrxf iadfmtrlnvi t s2toir nu4al n ivt s  rta(rpnu4oexo iciytfa2umu s;(4arenxr3io1oa  li o;( tetmir nodap nlncsas)aDtaxmont0alxo i3iadfa ranmsnt)altrmocio1om e uesl()t2urxr3oodomeelies sfs2ta(moou4texnmi3iydlsDean sn(4teermocoydfat  ueo;t0t2xoimpoy4ll   ictatf Duau oot0tex  ieiadls eluvo;t4artoif iydfpt lnvsl(  rxoir3ou1lp e ivt ( a2ta(monu0aeeomiciyt aDeau snt0arxrxf3todlmt aivs s)trxoxm no1lleelnei (fs2raxrono4texnio3ils s ra(mo t) exnxf tydfaDrliei t trxmxopio1ll elncs (  Drru p;t0alxomi3tltfa2ean s u4tlenxo oadlmDran o s  eurxr3iu1omenmies (faDtru o;t1apx  i3iatfs emu o;u4areoio3todfptrlnvo (  exmimpnu4lpeelfcsl()s2umumoot1olto ieiadfa2raumo;t4aeeomo ootom rai i (0 eurimpou1al nmfci (fsrrrum ou0aexn i3ilslsDul( p;(4arenxocto1op  aivilt  rtmxo ny4lpenmivsas artrurp;t1alx iicilt sDrmump u)artoxf3oy1fpD li i t)s2toir ou1alen ivtls)s2taumpot0aexn oetlt aDrauvonu0 eenxr3tadopD anvo;(0t2xm(r3nu4amte ivtl()srtm(mpoo1opt mocilslmDulumo t4 renxr oadopt anvs s)s2xo(m nodll n ivsl( aDtmurp;u0ale  feiyd sDumnms (4arxnmr3iotoa ranvils0s2uo(m no1lmenmnvi t)sDrruroot1tltomietas s2elu s;u)aexrmr ia1fmDe nvo;( seto(r ou1ap  liei ()arrr(  ;u0ape mo3ild m uau s;t) etnio ootom   i o;t  2xoim3ou4apt  fvsas)s2raxr ;o4tlx iicias a2uaums;(0tlenxfcootlmtraneil( t2xm(r3iu1lm nmnvtlsfsDrmum ;o1tpe  f3tys mDulnvsnt0texomf3oydfaD auvo;s) etrim3oydal   ivs s arum(moou4oetn fctls s2ul(vs (0tltomrctodopt  nvs (0texrio3ou4lpt  fesasf 2trurpnt0aet moetad mDraump ()alermf tadlm e u ils0 eumio3iydlltnmiviat  rua( o;u4tex mfctytfsDrlnvp u4trxoxo3oo1opt ai o s  2tr(rpoodape  fetas arur(mo;o1oetoifcilslm elnmon(4 etoxfciydlpD  ueo s) rumio3oydamtelivi (faDtaxm nt1aee if3ild m2eln s (0 lxnmfciodfmteaueo;s  etrxm nu1optelnctas a2rmu  nt1tex miciadlsDua(mo (0aleoir3ty1oat  nvs;t0seumimpoo1am n neil(fsDurxr oo4tptnmfeildla em( p t) rxnmr3iotlmtelueo;s0trur(m ny1al nmneils  Dua( p;u4opeoifeiyslsDrauvp;t0arerifcty1om e u sls0truoio3oudol nmnetas)s2rrx  ot0optoiicild m2rlnmsnt0 ltoxr3tydopt luvi () exoiopoudlm n icsls)s2taum nu4teeomfciatfm ulnmonu)arxrmrciodopt  iei;()s2xmxopio4om n nvtlt  rtm(r ;o1tetoiieilt mDeauvo;(4 reoxrciotlpDe ivs t  rxmxr no4am emncsat s2urum ;t1olxnio3tytfa umu snt0 renif iatoa  ln o s0t2trirpou4lltn nvt (f Dtm(  ;u1tleoifctadfm2eaums;()aetnmr3tadlatrlueols) 2trim oy1amtelivta(f 2tmxr nt1opxomieiytla uln s;()tlxnxf3totopDrau o s)srxoxopoodop e fei ( sDtmuroot4tpx  iciasfaDem(vonu4aleomf oo1opDe n o s)trtoio oy1amtelict s)arurxmonu1tet  iciadlm2elnmsnt4 exnmocty1lat  uvo t seur(o oodomee ict tfa2ua( oot4oex iieiltls raumo (4alxoio3io1fpDrluvi;t0trtm(mpnodome  ivt (fsrtm(  nu4apt mf3tyt sDrlumo;t4alxrxr iadopteluvi;s0s2urxrpiy1lpeeliesl(f 2urum ou4tptnmoeiytls ea(vo ()tltnmf3oa1fat lnesls  rxoiopnu4oltelietls sDtrx  nu0altoifctat a eln p u)altrxr3io1lmteaneo;s)srtoxopoo4omtn fvi sfsDtaxronu0ape  ietlsls2uluvo t)altnmr3iy1fat auvs ( teumxrpoydap  mnci () Drmu ont4alt if3iytla2umnmp;()aeermfctydomD ai olt  rumirpoydoltnlneiat)arrmx ont4teeoio3tytfaDrluvpnt)alerxf oo1fpt aneo;(0seur(m3iudlpt lieiatfs2ua(mo;t0olxoifeiatls el(ms;u)aeenir iodop  luvi ()srtrxm nydapt  nvsas  Draxrpou1olenmiciyslmDeanvs;t4tlenio ty1omtrln s;(0trtrxrpno1omt lfetasfs2rm(  nu4apen ociys s2ul(mp (0trtnmo oodoa  lu o t0setrxrpou4alt  nvsa(f 2taxrpnu0tee moetys sDrm( o;t)trtoxr3tadoaD  ies s setoxm3ny1al  mfesas)srtmxmo;o4aeeomfctatfs2rl(ms;t4alxrif iydfmt  i ils0seur(m io4opt mfei ( srtrur ou1olxoif3iyd m2ua( p t)texnxr iadfmD li s;t0 exriopnodameelfetl() rtaum ;u1oexoifeiasls2eanmo;u)teeoxo tadfp r iei ()seurio oo1apenmfvtlt)aDtax  ;u1tleomfeildla ranmonu0tlenmr ty1laDrai s t)trumxo3nu4aleelnvtat) Durx ont4aeeniietas s2uau o (4aexomr oo1fatrlieolt s2uoxo3no1optn neilt aDuru pnu4teenmiciyt aDua( o u) rerioctotoa eln o;(0s2uo(o ou4amt  nei s) Dtmur ;t1tetomf3iatlaDrauvo;u)tlenxr iadla r i i;(0trtm(m ou1lmen net ( a2rrx oou1alxnii3tat m rl(vs (0 rtomrctotoat  nvo;t0 rumxo3oodopenmfct ( aDrax o;o1tetoiiciad s2eauvsnt0 exrxo oatlaDelieo;s)t2ur(o oy1lleemieilt) rraxm no4optoioeildls ua(vs ()teenxf3todla  luvolt) 2trim3io4opee iei s  2tr(mpoo1oeenmieildls elnmpnt4 rerxf3oy1omDr ies s0s2toxo iu4llt mfetl(fsrrau  ot1tlx  icils m2ulu o t0 renif3iadom raneo (  2xriopoudaleemfctl(faruaxmpoo0tex  ociyd a rlnmont0 eermf3iytoa elnvs;(0 2xrio3no4apt  nes t) 2ta(r ou1alx iiciysfa rauvpn()trtrmo oa1lptrau o s)srtoxrpiy4ope  nvs tfaDumx pnu4tltomf3iadfmDuanmo;u0alermrctodoaD livo t)srxoim io4lpe mnci s) Draxr nu1apeoifetadlsDea( p u4 eermfcio1fm  ln s s trxmio3ny4lpt lietl() rrrxmp;o1texn i3iyd m em(vo (0 exrxo3ty1lp rluvi s0 2tmimpnodam nmncils)arua(r ou0apt iietyd m ul( p () lxoifcto1oate uvo;()s2xoxr3iy4am   fvtatfs2rmurpou1optn feilsfaDrluvp (0tlxnxrctadlaDe i s;(0s2ur(m oy4op   fcs sfs2uaxr nu4tetoio3iad aDulu s;u0teerio3oo1fmD luvo (  etm(r oodll nlieilt)a2rrumo;o1opt mfeiydfs rl(mont0alxoir3oa1omtrai s;s0texo(m nydlmtnlncs sfs2ur(mp;u1tet mictls aDemnvo;t4 leoir ty1fa elu s;(  2trio3iu4olt lfvta()aDraumoou0aexnif3tlsfm2rluvs;()tltomf tatfmtelueolt seuoimpno4oltemics tfsDrau p;o0apen i3iyt a uanvpnu0trtnio oodlmt an o;s)tetmim nydap nmnvs t)aruaum ;o1oltnifeildfa ranvsnu4 lxoxf iy1lmtelnvs;s0sruoxopnudoltnmnctlsfaDua(rpno0oleo i3ilsfs2ul(monu)tlxnmf iotfmtrai olt0tetm(r iydam elietasfaDurxr nt1opxo oeildlm2umu sn(4aleoio3oytfmt lnvi;t) rtrxopiy4aptn nct s)srrrx poo4tlxomociysfa2elnms (4trenmr3oa1lmt  uvils  2uoiopnu1ope lfet t)aDrrxr ot4oeeomi3iad m2ul( o;t4teeoir3tydla raivo s0 2urxrpiy4olt lfvia(fsruaumonu4aetomfeiatfa ul(vp;(4tetrxrcoy1om   uvo ()s2xm(r3oy1omenlfes (fa2uax o;u1openmfetad m um(vo t4alenxrcoo1omDrlnvo;(0t2xo(o3oudopt  fvta(fsrrr(rooo0alto iciys s ul(vs t4 rtriocio1fp rlivo s0 rtoio oo4ale  ivia(fsrra( pnu1apt iietasla rl( pnt0arenxo3iodfatr n il( t2xm(m iy4ll nlfvtltf Drmuroou4tpe mietas aDrmnmo;(0tlxoifcootlm eai slt0trxoio3oydll nlfvtl()artauroot1tlx  ocilsfs rm( p;(4 ltnifcio1omD luvi;(0srumxr iodlmenlicsat)srtmu  oo1tpxoiieildfm eau p;(0tlenmr3io1fm ranvo;s)t2tmxo3io4lptnmfeiltfsrtruroou4apenmfeiysfmDrl( p t) eeomo iydfm rai slt s2urxm3oy1op   fctat  rum(m ;o0tptn feiltls ul( snt)arermr ootfp rauvi ( srtriopou4llte fct s)aDtau oot4oetnif3iysfa2rm(mo;t0 lenir ia1lat ln sl()srtoxopiodomenliei ( a2ua(  no1aeto ietysfm2em(vsnt0 ltnxr3io1fmteai s;t0 etr(m3oy4lp e fes t) Draxrpou1tee  oetysls ua(vp;(4artomocoo1fpDrlivi t0 rumxr nu4lm e iet sf rtmum ;o0tltnmfeiltfaDeauvs t4 ltnmfctodomt lneolt) ruo(rpny1lm  livs tfa2umumonu0tlxn i3iad mDrmn on()teermrctodfat aivi t)t2toxm oo1omtnmnvs tfa2rrxrp;o1alxnmieilslmDemu o;t0tlermocta1oaD livsl(0 rxrxr3iu4aptn icsasfaruau p;o4tex  ictadls ua(mo;(0 rxomrctotomtean slt  exmxm ny1al  lfetlsf 2raurpou1oee iiciysfs2ua(mo;()aetnxr3tadfmDranvi;s)t2tm(m iodal e fvs s aDuaxmooo1oex  iciatlsDul(vp;u0alerio3iytop e uvo;t0teurir3iy4olt  fvsasfsrraxrp;o0altnioetltfsDrmnvpnu0tlxnmo io1lpDeaueilt  rtmxr nu4ol n ncsa()srtr(roou0optnio3tydls2ra( s (0altnmf3oy1fm eln il( teurxr oo1ll nmfvsa(f 2taxmp;u0aet  ieiltfs rluvont4aetoxr tytlpteluvo;t0 exmxo3iydamenmncsl(fs2rr(moou0alxn o3tltla eanms;t)tltoxo oodoa eluvi;(0sexrxopiodll  lfetls srur(mo;u0olxnmfciydla rmn o t) exomf oo1laD anei t0srxrxo3oy1am nmnvtl(faDrmxr nu0tpe  ocils s ul( s;t4tlxoxr3iydlm rai s;s  2trxmpnu4ap  mfvs (fs2rax poo4tpe  ietldfs emnvp;u0tetrmf3iadfa  luvi s teurio3ny1op n neilt srtrx pnt4tpt  o3tasla2ea( snt)tltrifctotlat li i s)tetrxo3nu1lle lfeils) 2umum ;o1apxnmo3tat s emu pnt4 ltniocto1oate nes t0 eum(mpnu1lptemivtasfaDurx  nu0oeeo feiyd s rlums;(0aetoxr3io1fate u sl(0sexmio ou1lmenlnvs tfsrraump;o4aexo fcilsfaDelumpnu4trtnio iadomte nvilt) rto(mpoydame  ivs t s2taxm oo1tlxnmf3iasls uan sn(0 lxnmo3ta1lmtraiei ()s2xoiopou4altn fetat)s2tax pnt1tltoif3tadlm ra( onu)alerir3io1faDr neils srtoxo3ou4amt  ictas)srtm(  ;t4apto f3taslm ul(mp;(4 exomf oy1la rlnes;(  rxo(o iu1lmenlies (fsrtaxm no4aee mictldfm elu o;(0aetoxo3oydlpDr n ols seuoxr3io4open ivt sfaDtr( p;t4oeenioetltlmDum(mo (4 etrio3oatfmDeln s;s)srxo(m3oodapt  nvs tf Dtmurp;o4oleo i3iysfm2eaump;t)arerif3ta1lpt livslt t2trxopoo4om e icslt) 2tau  ot1oex mo3iltfs um( s (4alerir oo1lpteanvilt setrir3oydop   ietas)a2rmu pnt0opxo fetld s rl(mp;(4 ltrxo3totlp  auvo;(0s2uo(o3no4omtnmnesat) rrmxmo;u4oeeoii3iltfa2eln p;(4artrmfcty1oate uvi s seurxr3iydapeemfesasfsDtrum oo0tpxoiietlsfa rlu p;t)altoif oadfmDrlnes;(0 eum(rpoodll n fcias) Dumumont1oexo f3tld s umu p u4tetoirctydfm elues;t s2triopio4al nlneilt) Drm(ro;t1tet mfciad sDul(msnt0tltrif tadfmtelnei s s2tm(o3nu4llt mnvtlt) 2uaxro;u1tet  fetyd a ulu snt)tlxrmrciydla  aueils0 rtoxo3nudaptn neilsfsDur(m nu4tpen o3iydfsDulumon(4 reoxo io1fmDr u il(0tetmio nudll elfei sfa2uau p;o4apto ociltlm rlu o t)tlxrxrcoa1fa rlivo s  eumxr no1optelnei t)srtax pot4alt  o3iydlm rau ont0 lerxo oydlmDr uvols)teto(o3nydlpee nvil( srua(  ot4ape io3tat a2rl(mpnu0tlxoio3totoaD auei t0 2toxopiudamtnlietlt) Drrx o;u4tet mieilsla rmnmont4 etoio3iotfpDr i o;t0 rxoxo3nu4lptelnvs t s2rm(mpou4aptomiciydfa el( s;t0alxomrcto1fmDeai o t0 2uo(opiu1lmtnmfeils a2taumpno4tltoiocilsls2rmnvpn(4trermo iodoat  i s t srxoimpnu1ope mnvslt) rta( poo0texniieiadfm2ranvp;u) rtrmr ty1fmDeli s (0trxoio oo1om   nctl(faDrm(rpno0tltn f3iyt s uluvo t4 renmf3iadlateaivs (  rtoxopnodam e fes s)aDrmx o;o1oee miciad mDuln snu4 eeomr3oydlaDelu s ()s2xm(mpoo4lpt lfcslt aDrmx  ;o1aexnmiciytlmDuaumo;u4 ltnmr todfm eaivi t)tetoir3oudol nmfvslt)srrmu pnu0ole ifeiytfs rlnvs (4 rerir3iatlp  aieils0 rtoirpiy1alen fvils aDuru onu4apt  iciysfs elnms;(4alermr ta1fpteaneo ()srxoir ou1apt mfcs ( artax pot4tptnifeiad a eln sn()tleoxf3tytlmDrliesls0 exmxm3iu1olte ivia()srrrur ou1teto fcias a2emn on()aeenmr tytoat ln o ()s2trxr3iy4aptn nvtl( arrmx ont0tex mi3tls m2elumo t)arerxociy1fmDraneo s0seto(o oy4altn ncsl( sDua(moot1oetomo3iytfm2ran ont0aleoxr oadlaDelueo t0 rxr(o iu1ol   net sfsruau  ;o4tpxnii3iasfaDeluvp;(0texnircia1opteliei;(0s2trir nodal  lnes (fa2rax oot0alxomoeiydla uanmp;(4alerio to1laDe n o ()srtr(m no1alen feilt) 2taxm ou0opt ii3iadls2rmumsn(0arermrciatopD  i olt)t2xmxo3oy1lmtn fct ( sDtaur nt4opxoioeiaslmDelnvs u) renxfciydoat anesls0setoxm io4amtn fei tf rtrur nt0alx  feiat s2em( on() rerxfciadopD lieo t0 2tr(r3iu1ap nmici ( a2tr(mp;t4ale  i3iat s rmumo (4 etnxf iatlaDrlivilt0 exrir3nu4amtnmfvtlt)a2rmur nt0tle mocias s umu s;(4alxoif3io1fatelueo;t0t2tr(o oy1amt mfvs s s2uaxmp;t1texniictydls2eluvo ()arxrmr ia1lmD ai s;() rtm(m ou1olee fvtlt s2tru poo1tltnmietyd a uanvo t4 eeoirciatlate n s;(0 ruoim oo4opte net s)sDtrum ou0oee mi3tatfsDrau o u)alerxf iodlp e ieslt)t2umir iudolt  neilt)srua(m ;o4tlenio3ilsfmDum(vp u0aetnir3oa1opt  n ils0tetr(r nodlme mfet s  2trx p;o1oeeniictatfmDua(vpn(4arermrcoadfaD  nvi;s0teumxr3oo4op elnvilt) Dtaurpoo1opxoiieiat sDua(ms t0tlenmrcoa1faDr u sl()srxr(r iudlmeemneta()srrmumoot4oetnmociasls2uan p (0alerxf3tydlpD livs (  rxmirpiu1amtnmfcilt s2umumoot0tptoioeiatls2eanvs;t4arxoxrctatfmte ieo s)srurxr3oodaleemfvi t aDtrx pnt4aee mfeildfa2uanvont) lxrxr io1opteauei;t)t2xoim oudlptemivs s) 2rmuro;o0tpto o3iat a2eln p t0 rtnmrcty1fmtraiei (0srtoxo io4ole mnvta()aDumxmooo1opx  ociasla elu o ()aexomo3iodomt aivils teuoiopiudlm  lfcs s s2umumpno0aetnmf3tltlsDua( pnu4tltoxr oy1lm  livo;s0 2um(o3iudlmte ivt t sDtaxro;t0oexo fctytfa ra(vo u)aetnxr iytopDraueo;t  2uoimpoy4llen fvtls aDuaxmpnt0tpe  oeiaslaDemump (0trxnifciytlpt  ies () eumiopoo4open fetlt s2rm(ronu4oeenifctasfm el(vsn(0artomr oydom ranvi s)trxo(o iy1lmeemnetl() 2tru pou0opx  o3tld m rlu on(4 ltoif3to1om  ln s ()s2to(mpno4opte fesasfs2rmu p;o1alxnmoeiltfa2rlu s t0tlxrmo oo1omtraieols0 2urim3nydapee ncta(  Dta(root0apen fciltlm umnmpnt0areoif3oa1opDeluvols) 2xmxmpou1lmen ivsasfsrrmu  ;o1alxniociadls um(mo u)trxrmr3tatla  aivi ( srumxm iy4lme  nvt t)s2raxmoou1tpenmi3ildlm2el( s;t0tltnmrcia1lp rlu ilt0 etrxr iudopeemicsa( s2rm( o;t1texnmo3tltfsDuau s t4 lxnxoctatlpt aneo t t2xmxmpnydopte iciat srtmx oot4tptniociys aDran sn(4trxnmrcta1opDelneo;s)t2tr(o oy4alt  ivt ( s2umxr oo4alxnif3ilt m2ea(vs;u0areoio oa1lpDraivils0texriopiydllt mnvi t)sDtaumpnu0apx  ieiys s2ul(vs;t0aeenxr3to1la eai o t0teumim3ny4lle mnvsasfsDtrxmpno0oet mictldfs ul(ms ()trenmf todlpteau i;(  euo(m3no1op nmictl() rra(mpot1teen octys s eanvp;t0 lenmf ootfmtrauvo s0 rtr(m ou4lp elfvsls)sDurum no0tlxnmo3tlt s2uaums u)aleniociatoa r ieil()t2xoxo oo1omenmnvsas s2um(mo;u4tpenii3iytfmDel(ms;t4 ltnifcio1fm  livi;t0 2urxo3iodalt mnci tfaDur(  ot4oexn f3iysls uan s u4 ltnifcio1omDrlivi;s) 2ur(r no1amee ieta() Duaxrpnu1tee  f3tytfa2eanmo;t) ltoxo iy1oa elnei (  2urxmpoudlmtn nvs tf rurx oot1ape mictltfs2emu s;
\ No newline at end of file
@@ -0,0 +1 @@
+neslt)t2xr(mpno4op nmncta(fsDtaxrpou1aee  feiaslmDrlnvpnu4texrxr3oy1omDeaieslt0s2urxr iu4optnlfesas)a2umum ;t0tltnmociytfs2emumo;(4aetrmf3tydlm  anei;()seumxrpiydol  liesltfa2ururono0aeen fciaslaDem(vp t) lxomfcoa1la   i s;s)srtmim nu4al   ivias  rtaxronu1tlx mi3iyslsDum( snt)arxrxf tytop elu o ()seuoxmpnu1op emnes s aDtm(mooo4aleoif3tydfa rlnmo;u0areoxo ty1op elnes s)srtoir nu4lp  mfeils)a2raxr ;t1ope ioctytla2um( s;t0tlxrxocoa1lpDrliei;s0 eurir3ou4om  livsa( s2rau p;u4altoiieilsfaDrl(msnu)tlenxr iotfpDrai i ()trur(o nudll emnctlt sDtax p;u1oex iociyslm ua( s;u4trtrxr todlatrln s;( srtr(o3io1op e ncta(fs2uau ono0apxoif3tldlm2ea( s;t0tltoxr3oa1fm e uvs;(  etoxr iy4lp  mivi s  2tm(mp;o0oeeomi3iysfaDrm(vo;u) lxoxr iatlat  uvs t0s2xo(o3oo4amt  ncilt)a2umxrpoo4tleo fciatfa2emn snt) exnio iytlaDraueols0 exrxrpoo4ope  nvi t)sDtaxm no4tlxoioeildlm2ranvo t4trermo totfat luvs s0setoio3iydamt mnei tfaDrru poo4tptoifeiys s2rln snu)trenio3oatop raieil()srurxo iy1llee ivs s s2uau  ;o4opx mociatla ra( s;(4tltoxrcoydfa rlnei t) rtoxo ou1opt mfvslsfa2taur nu4alenii3iysfa2ul(vp;u4alermr3io1lmD  iei s0 euoio3ou1alenlfvt s a2umx onu4oltomociad m2rlnmont0tlerxf oy1opDr i o;( srto(rpiudol nmnvilt) rumx p;u4ole iieiat m umnvsnt0teeoif3iadomt li s;() rtr(r oo1lm n fct t s2ua( pot0tpx mfciydfaDem( o (4 rtnxo iodomte neolt0srtoimpoo1omen fvilsfarumu poo0tex  iciltlm2umumonu)teeoxf oatomtelivo t0srxo(m iodamtnmfvi tfartmx  ou4tex moetysfa2emumpn() ltrmr3tydomDrai i t)teum(r iy4lleelnci ( a2trxm ;u0aeeoioeiad mDrmuvsnu0 exoircootfatraivs (  exoio3oudlm  lfcil()sruaxr nt4alt  feiytlm2ua(vpnu4teenirciodoa e i o;( texriopou4amt lfvtlt aDra(rp;u1oexomi3tyt s umu s;t4aeenmo oy1omD  uei;t) etmxm3nudoltemfvi t aDraxro;o1oeeomf3tydlmDumumpnt) reoio oytfmt an i;s truoxm oo1ll  mfvsasfaDtaurono4oltn fctat s emuvp t0 lermf3to1lm  li o;( texoxm3io4olenmfviatfa2tmumooo4oex mf3iys a elumon()aleomfctodop eau s;t0srxm(o nodam nlictas)srtmx pnu4tlx mictld m ranmsn() rtoif oadlmtrln o;t) 2xr(r iu4omt licta(  Dtrum nt4optnmi3taslmDrlnvp;t0 ltrxf oy1lptr n i t)s2ur(m ny1lltnlieiat) rrm(m oo1oetnmo3tldfsDranvs;t)alenmo oydfmt ai ilt)srtoir3oydll  mncsl( sDrm(m nu4ope ifeiysls emnmpnu0 etoxr3tatopD livo;(0 etr(o no1ol  lieils)aDrm( poo0tptnmoeiytls2eanmp;t4aexoxfcoodla r ivils0 2xr(rpiy1lpt  feilt a2trur no4opx micilt a rl(mo;t)tltoxf3iotfaDr nvs;(0texoimpny1alt mfeslt  2ururpou1oexomfeils m2ua(vs u0aexrir3oodfm e u s;s)teur(o3iudlmenlici s arrrxrpnu1apto f3iytfs2ua(vpnt)alxnxr iadlmDeauesl()t2tm(r3oydlp n fei tfsDur( oot1olenmf3iytfmDumuvpnt4tetnmfcto1faDrlivsls s2umxm iudol   iei (faDtm( pnu0tptoioeiytfa ranmp u0aexoircoo1lmt  n i s trxrxr3iodll emfcsat s2tm(r ;u4opt  iciltfm2em(mp (0trenxrciydfmt livi t0 ruoir3nu4alenlnctl( sDum( ont1aexniieiatls2uluvo t)arxrxf3iadomtraies;s  exm(opoydope mnei t arumur ou1olxomoetydfsDelump;() lxoxr tatoat  ies t)s2trir oy1lmt lnes ( artru p;t0aptoif3iat sDuanmsnu)tetnxf iadfm e uei;s tetrim3io1ol nlnci tf rtrxront1oet mf3iadlaDulumpnu) ltnio3todopte ieo t)tetmir no4am nmnvsls  rrmx oou1opx miciysla ul(vpn(4 reoif3ia1la eluvo (  etr(r3iy4al nlivs s)a2tm(  no1aleoio3iydfa em( s;t4 eerxo3ia1lmDr u il(0srtrim nu1optn ieslt srrr(  ot1tpe ii3iysfs eanvs;(4 rtrmfcoatop  lies;t  2ur(m iu4om   fct ( aruaumooo1opt mociysfs ra( pn(0texrmf oytom raivs s)srtrim oy1ame mnvs ( s2um( ooo4aex  feiasla2uan s ()trtoxo oydoptrli ols teurio oudalt mictas) 2ur( p;t0aex ioctys aDrl( s;(4tetnxr3iy1lmt lnes ( t2trxr3oodll   ivil(fsrumu oou0tpx  f3tytls umnms t)tlenmo totlp  aivo;s  2xmxmpnodop e fvtat)aDumxmpnu0olenii3tld sDrauvont4 etoif3oytlp eaneil(  etmimpiy1ll elnct t) 2rmxmp;t4tpt  feilslm rl( onu0tltnxo ia1oate uvi ()srxr(rpou4omtn fes tfaDuauro;u0tpeomoetyslsDran onu4tetrmrciy1lm  anvol(  2tmim3oy4altn ieslsfsDumx oou0tlto octysfmDua(vsn(0treomr3iydlatrlu s;()srurio io1llen nvs (fa2ua(mo;o4aexn ietyt m el(vsnu4tetnxf tydfpDe i ols0seumirpou1om  lfcslt  Drau ono4aexn fciytla2ea( pnt0aetrxf oydlpDrln olt  rxmim nydlp  mfci t srrmxrpno1ole iociyslsDrmumpn(0trxrifctotlpD ln sl(  exmxo iudaptn nctls s2ur(m ot1aexnmo3tldfm ean o;u0trtnmf oytlat  uvsl( t2xrio ou4ap nmnvtls sDuru pnt0olxn ictaslsDrlu p ()teenmo tydlateanvsl(0 etr(m ou1oltnlfci (fsDur(mp;o1alen ieilsfs2ulnvon(4artoxo3iotlp  an i (0srxm(opnu4am  mnesa(f 2uaxmonu1aexo fcils sDraumsnt0tlerif3iadfatr neo;t s2uo(m3iydlm nmnvtatf rua(r ;u4oexo ictyd m2ra( snu4artomociotop rlnvs t0seumir3iydom nmivs tfsDtrxro;t1tpxo i3iasls2rmuvonu)altrifcootomD lues;t)srurxo3nu4olt miei tf rtr(mpnu0oeenmictatfaDelnms t0 rxomfctadfp rauvo t0texoir3nodlleelnvi ()a2raxrp;t1oexniociys s rl(vsn()arxomrcoa1fatraivsls truo(r oydll   fesa( a2urx onu0aetniiciytlm2eluvo;t0arxnmf3tydlaD aueolt)s2urim3ou1ale  ncsl()arrrumo;u1tlx iieilt s ean ont4alxnxo tatfm  ai o;( sexoirpny1lm emies tf 2umx  oo1apx  octls s elnvo;(0tltomo3oadlpDeln i;t  rto(m3iy1lpee fetas  rtax ono0tlxomi3iadfm2rmuvs;u)alxoiocoo1la  lnvo;( srumxr3nu1am e iei s)aDrrum ot0tlxniictydlaDrmums u)trxriociatlm ean slt) ruoir3iudoltn fcias)s2rm(m ot0oltnmfciadfmDelumpnt) ltrircio1lat  i o t  rumxo iu4oleelivtlt)aDurum ;o1aex mf3tldlm ea( s t4tltoifciytlm e n i ()seurio no1opt lfvs tfsrtau pno4aeeoif3iydfm el(ms;t4aetomfciydfm   u ols) 2tmxr3oydlmeemfviatfaDtax  ;t0alxn o3iysla2emuvs;()arxrmr3iydlp eauvo t)tetr(r io1optnmnet sfa2ua(rono1tee mfciytls2eln o;(0teenxf3oytfpDe ieslt trtmio nodomtnmnct tfsDumx o;t4tlto f3ildfm2elumonu) leomf todopD aiesl(  rxmxr3oy4lle lictltfa2umxro;o4aptn i3iytfm2el(vs;t4 lxrio iatfpt auvslt0setr(r3nu4omeemnvsa(fa2tmx onu1teenmfctlsfm2eluvsnt4aexnmr3ootoatr nvil() exr(m io4amte nvils srrau o;o4tpxo ociatfaDumuvo u) rxnmo oodop  livs () 2trir3io4opt lnvil(  2ta(mono1aee ii3ild mDrlnmont4 lxoir iytlm   nes;t0trumim3nu4alt mfvils  Dtr(rpoo4tlt ii3iydlaDulums (4 leoioctatomteluvs;(0teumio ou4altnlict t  ruaxmoot4tpx if3iydfaDran o;t0altnxr3ty1fm rauvo () 2xrxm3iu4amee neil(  Duaxmpot1oee iiciysfmDra(vpnt0tleoxf oatopt li o t s2xoio3ny1opee ncsl()aDrm(mp;u0oexomfetldfmDrmuvs;u0altnir3oo1latelu o;s0setoxrpoo4omt lfctls  2rmx pno4opeoifeilslsDul(msnt) ltnifciatfm rai i (0 etm(mpny4am emfesa() 2uaur ot0openmf3iad sDrl(vs;(0aeeoir oy1omDe iei;(0sexoirpny1lptn fctas)srrr(m nt1apxnmoeiat a el(vont4 rtnifcoatomt lnvo;(0setrir3oy4lpen fcs t a2ra(  ;o4tptoio3iltlm2rmuvo;t4 rxnir iytfp rlu s;t0 rxoxopnu4lleemict (  rtrump;t1apxomieias s2ulnvonu)tetomr3oy1laDeauvs t)t2tmir3nodlmeemfvia(fs2rrumpnu4ape mieilsfs2emu o;() renio iodfmDrlnvi ( trurim ou4am  miesa() rumx  nt4apeniicildla2rm(vo;u4teeomf3ootlateluvo;t)t2trio iu4lptnmfvt s  Drrx  no4aetnioeiys m2uaums (4arxoxrctotomD aieo t0setrio3oy4apt livsls) 2ua(mpnu4aptomocilt a em(mp t4tlxoxf ia1fm  aiei;( trxrim3io4lpt lnvs t aDtr( pou0aee  fcilslsDulu sn(0alerio iadfaD  iei t0sexrxmpou1om emfcil( arurx o;u0oet  f3tldfaDul(vo;(4tetoio3oydomte i s;( srxoir iudllte fetl(fsrumur nu4altn ieiad mDeaums;t)teerxo iotfa rluvs s srtrirpno4am n iet s a2rrxm no4aleomf3ils sDeau s;()treomf todlateai o;t texrxr3iu1ll  lnvt sfarua(rpnu1teenmociydfm uanvsn(4trtrmo iotfp   uei s0trto(mpnodoltemnei tf rrrum ;t0aeen feiadlsDul(mp;t)artrxfcoadlaDr ivs;(0 rtmimpiy1ap nlnciatfsrra(r nu0aeenioctat s ea( s;t0 ltoxfcoy1omD  uei;(0s2trimpnydolenlfvsl()srtmu pnu1teto iciyd mDuauvs u0tlxrxocia1fpDelu i () 2uo(r iudlm  lfctlsfs2rmxm ;u1tlt ioeiydfmDelumo;(0trxrxr ootoaDr nvo;s)t2xmxo3nodome lfvs s)sDrr( ont0olxo oetys a2ua( snt0alxomocty1fptr uvi;s0 eurir3oo1ame  fes t)s2umurpoo0tetnmo3iatla2ul(ms u)arxrxrciadoa rlnvi t0t2uo(opnu1omtelfctat aDumxroou4aptnif3ildfs em(vo u4alenxo iadfpteli s;s)texrim no1ol n ieta(f rum(ro;t0oeeo o3ildfs2eln snu0tltoxr3ta1lmtrlnei t) ruoir io1amtnmfvtls sDum(mooo4oeenmo3iatla2ulu s t0aexnmf3oo1fmt aneolt t2xo(o3no1ap nlfvi s) 2rr(m ;t1apt ifetadfa2em(vp u0texoxr tydomtelnei ( s2xmxo oydlpte ivi s)sDtm(m nt4teto oeiasfa rlnmonu) rtomocoadomDrlies t0t2tr(m3ou4llt mfvsatfs2tru ooo4tex mociysla2rlnvs u4arxrxrcta1laDrau o t s2urxm3oodll emfcslsfsDrrx p;u1olt  oeiltfa2ul(vp;t4arerxf3iy1optran sls)t2xriopnu1am   fvils a2um(m ou4aeenmiciytls eln p t0texnif iatfaDe i s;t)s2tr(m iu4ap nlnvtl( s2taxr no1apx  ociad sDulump u0aetoxfcio1opteauvs;()s2trxo3ou4olee ieiat) Drm(moou0alxn ietyt a rmumonu) rtnio ootla   nei t)t2ur(m iu4lp  lici t)a2trx  ;t0ape mieiatlm2umn o;(0 ltrmr tadfp   ieslt  2xmimpoy1optn nei t)aDtrxr ;o4tlto ociys m2ean p;t4 rerio3oy1lmteai o ()seurimpiu4lp emnesatfartmxm ot1texnifciydfa eau s;(4aleomf3to1oa eln s;t texoimpiydolt  fvs ( a2rax  ou1ale ifciysfsDrluvo u0tlxrio3oy1oaDrlues;t0 euoiopno1opt mivtat  Dtr(monu0tptomfciyt a rau o;u) rxnxo3ia1lmDelu il()sexm(m3iydole mfei ()sDrrx oou1tpt  ieils a el( sn(0alxnmrcia1lpt ln s;t) rxr(r3oy4am e ivils) 2ua(ro;u1tle io3tydfs2ul( p;t4 lerxrctotlpDran olt)sruo(r io1lmtnmivsl( sDumurp;u0apt  feildla2raumsnu0aexoir3oytomDr uvo;t sexmxmpoydolte iei tfsrrr(rp;t4olxnmieiaslm2ran o;(4 ltoir tydop eanvi;( seumio3nu1ap  mieiat sDrr( p;t4tpenmo3iysfa2rlnvsnu0 etoxo iy1opDranes s0 exrxopny1op elnei t)srum( ooo1tpt ifeiytfm rauvon(0teermocoy1laD  i s s seuoim3ou1open nvsatfarrm(mpoo1teeo f3ilt s rmnvp t4tleoio3oatlpDeanesls teur(o io4ap  mfes t) Durx  ot1aeeomoeils m2ra(mo;t4 ltnmrcto1optelu o s)sruoxm iy4ll e icilsfs2rax pnu4teen i3tlt aDrmnmpnu) leomo oodfm   ivi;s) 2xm(r no1llenmfvtat sDtm( p;t4tpeoio3ildfs rlu o (0 eeomfciy1oa raueo (0texr(r oy1lleemicsa( sDtru p;o1olenifctlt s um(msnu0 rtrif io1lptrau i;( setmio iudoleemivsat artrx p;t1tptomieiadla uauvp;u0aleoif3iytfaD ai ilt) rumxm3oodol elfci sf Dtm(m no1tpxo ocilslaDuanms u)alerir3iatom   uvil(0 rtrirpoydlltnmicsa( a2tax  nt1tlxn fciyd a2eaump t4aexrxf3todoaDean i;t  2urir3io4om  mies tfs2tmx  ;u1tleo oeilsfm uluvon() lxnxf3io1fmDeaneo;s) 2tm(o oydlmee nvt s arrrxr nu1apenmfeiydls2ulnmonu)tleomrciadfmt lneils) 2xoio iu1ame mncils) 2tmxmo;t4oetnmoeilsfs2rl(vo;t0arxrif oo1oaDelnvils0s2xm(rpou4lmtnlfetl()aDtmum ;u0optnii3tas a rl( o;()areomoctatfptr ies t)s2umxo iodamte fvs t)srrmx  nu4apx iicilsfsDea(mp t0texomr3oa1faD aivi;()t2xm(o3no1omeemfes s)aDra(mpno1oex  f3ild m ulnmonu)aeeomf ty1oatran s;t0 2tmxmpno1lm  mieslt arra(rp;o1aet miciatfa ulu p u)trenmo ootlpD li s;s t2xm(mpny1op   nvsl(faruaxm ;t0opt  f3iadls2rmu onu4artrio iatfa e nvi t0srxr(m ou1ap  lfcs ( srur(ro;t4teeoii3tldla2rmuvo;t4trxrxr iodfatrai sls tetoio3iy1lp nlfcils arrmu o;t4opxnifetadlsDrlu snt0tltnmo oa1oatrau i;s teurxr no1alt lnciat  2umxmpot1alt  f3iyd a2rmumpnu)aetrifcoytlat aivo t0 rxo(o3io4ll elfci t srtmumpno4olxnmfcilslm2emnmpnt4teenifciotlpD an s;s0s2xrir3ny4alt lfes t  rtmur ou4teto f3iadls2eanvs (0altnmocoo1opDr ivslt  euoxo3io4ll elfei t) Dtmuro;t0apxomi3tyd s2rlnmpnt0aleomf3oatlat aieo (0srumir3iu4apenmnciatfs2rrxrpnt1oex  f3tatfmDuanvp ()texnircia1fpt lneols0teumxm oo1olenmnviatf rumu o;u0tee ii3iasla2eluvo u)alerif3tadla  ai i;s seum(m oo1omeelfvtlsfsDrrum ;o4tpeoio3iasfa2uauvp;u0aexrmrcoo1lmt auvo;s t2tm(m3iu1apt micil(fs2uau poo1oltnii3iyd a ul(vpnt4tlxrxo3iodoate nvs s) exoxmpoy4lmee ivt tfarrmurpot4apxnif3tlt sDulu on()alxrxr ia1opD ln sls)t2xrxo3io4op nmfetas) Dur(mpnt1aptn o3iadla2eaumo u) eenmr iadlm  aieo;()tetmxr3ny4omtnlnviltfsDumxmpnu4tex  o3iatla ranvo u4 rerxrcoa1la eai sls setr(m3io4openlicsl( aDtm( pnt0aee  f3ildfs2ra(mo;u0texrmocoatoaDr uei;()sruriopnydlm eliesls  2uaurooo4tex moetadlaDeluvs t) rxoio iadfp ranei s seumimpnu4alt  fct t) ruru p;o4olxo i3iydlsDemnvont)arermf3iydlp e u s;s t2um(opny1ll nmfvi (fa2taumpnt4opxomociydfa ranvpn(4alenmrcta1latraivo;s trto(rpoydaltnliei sfsrtmxmono1tle mo3tatfa2ua(vs t4 lxrifctatfm rluvo t) rtrirpiy4omtn ncsl(  Drmxront0teen ocilt aDelnvo;t4tetoir3iodlaDeau ilt)t2xrim3ou1amtn ieias  Drr(  nt0tee ii3iys aDrmnvo;t)altrxrciatopt  ues s0t2toimpoy1lm  lfcilt  Drmxro;u4tpxn ictltfaDrl(mo;u) lxomfctatla   ueo;(  euo(r ou4llee fei tfaDtaumoou0altoiictltla eluvonu0trerxrciatfaDeli i;t0t2urxr oo1opte ivi sfaDumuro;u1oee miciyt a2uluvpnu) rxomociy1fmtelneo ( t2uoio3nydlmen fcslsfsrur(rpot4teeo iciytfm emnvs;u4 lxomr iotlate uvo;s0 rumxopiy1om  mict sf 2trxmo;u4alx  ocildls rl( p;(4 lxoif3todopDelneo;t)s2xr(mpiydomtnmict sfsDtr( onu0oeeo ictltla em( s t0tetnmo3to1lpDe iei ()trxmim3iydam n netl( artm( poo4tpxn oeilsfs2um( pnu)artnxo oytla   nvo;t teur(opiydom  mnviatf Dur(  ;t4aex  i3iasfs ua(vpnu0aexrmo oytoptrai s (0 exm(r nu1amtnmfesl(fsrrm(r ;o4oexo o3iatlaDulumont) lerxfcto1oatrlu i t) rtmxo3iu1op  mfcil() 2tmur ;t0oleomoeiadlsDrm(mo t0alerir iy1fmtrlivo;t0sexm(r3nydole lnei t srumumoou0oeenifctadfa umumo;()tlermf3to1oateau ils t2umiopno4am  mncs (farrrx ono0optn feiysfm uluvsnt)alxomo oytoaDe ivol(  etrxr ny1lm   fvsa( aDrrum ;t0aleomf3tyd a2uan p (0arxomo iodop e uvs ()s2tm(mpoodalee ncs s  Drmxm ;o0aetn octad sDrmnvon(0arerxf tytfmD lnvs s  rtmir3io4ol nlfctlsf rtax o;u4opxnmoetadlm emump t0trxoif3ta1fmtran o;s0s2tmxrpny1ap elietas) rrau o;o1ole mi3ildlm2eau pn(4artoifcio1opDr ueilt)trurxr oo4apeelnvtltfsrrm(  ;t0aex ii3tlsfm2uanmsnt4tlerxfcio1fatr i i;t  rumxmpoodlm elicil(  rumur ot1olxnmfeias m eanvo;t0 rtnifcoo1lpt  ieo t  2to(r3oudlmt  nvtlt) rumx ont1alto oetldfa ean p () eenxo3tytoaDelueolt t2ur(o no1aleelfet (faDrmuroot4tpen oeias m2uaumpnu0artomo oytlatrluei t) rur(r3oudop   ivtas) rra(ro;u0alxoio3ild sDumums t) etrxfciadfmtr nvo t)t2xo(m iy1lp nlnei sfaDtrxrp;t1oexnmi3iasfmDelnvsnu0 exrxrciy1fp  lueo ( srxr(o iydaltnlfcia()srtr(mpou4alxn o3iat m rlnvo t0 rxrmocoadoat aneilt0 eur(r oodol   fciat) 2taxm no4oexn f3iytls ua( s (0altrmr3iodom rlnei s0tetr(o no1lme mieta()aruau  nt4altnmoetytfa eanmon(0alxoxfcootfp  ai ilt)texmxrpiodope mieia(fa2tmur ou4optniietyt m2ulu pnt4 etnio3oo1omDe uvs s0s2trxo io1amenmnes s  Dra(rpnt1aptn i3ildfaDuaump t0tlermo3io1fmDr nes;( t2xoir3ny4om emfesasfsDtr(m ou4texnmfciytlm umn s;(4artomr oatlaDr ieils truoxrpio4lpeelfvt s srta( o;t0opto ieiydfm rlnvont4tetrmo3tadom rlu ils t2xr(r3oodlp e neilt) Dtr(mp;o4aetoiieiyd a2umump u0 rerio3iytlpte nei () 2toim io1lp nlivsatfarurx pnt4alt  ietat s2ra( p t4treomf ty1fp  auvsl(0tetmxm3ny1lp   ncsat aDururo;u4tptoiiciyd a2uanms (4 rxomf3iotop rln i;s s2uo(rpiu4olt mnes ()sDur(m nt0olt mfeiat a2rm(mpnu4trtnir oatoptraivs t)texoir3io4lp nmneil(  rurx p;t4opx  f3iydfaDranmsnu)artoxf tadoaDr u i (0srxrxopoy1ame  fvtlt)s2ra(r nt4oeen o3tytlm2elnvon(4treoxf3oytfpDelu o;s0s2xoxopoydlm n ivtl(fa2ua( p;t1oltoioetatfm emnvont4teenmo todfat  ueslt srxrxrpiydalt lfeils  rtau  ;t1oeeomoeiytfm ul( s t0 lenmf3ty1lm r ivols  rxmir oodale lncsa(  rtr(  oo4tptn fetls m2umnmont4teermocoodlmDeluvs;t) 2tm(m3no4optelietl( srtrxmpot0apx io3tltlm rmumo u4aeerif iydoat aieslt0 2toxo3iu1oltemnvs s  2um(m nt4ape mfeiyd m uluvs;t4tetoxrcoadla   nvi;t)t2xoxo iu1omenmivsls sDrmxro;t0texomicils a2el( o u0 rtrxrcoy1oaD luvi;( srxm(m3ny4lmte ietas)s2uaxro;o1tpe mfeilt m2emums (4 rxoxrcoo1late ies;t srtrxr oy4lptnliet t srtrxrpou0tpto feiltla uanmsnu0aleriociatfaD aivs;t seurxo io1lptemfes sf Dtmx o;o4apt ioeiadlsDum(vs u0 exoxf iadlmt ai o;( sexr(m no4omenlfvtasfa2uau  ;t1aexomo3iadfs ul( o;(4aeenmf3oodfmD luvo;t)teurim3nydlme mfetlt artmu  oo0ope io3tadla rln s t)tlxnmf3oytoaDe ivi;t s2xm(r oo1lpe lfvi tfa2umu p;u4tpenioetadls elnmpnu4 lxoxrcoo1fmt auei;(  rto(mpoudll  mfct t sDumu  ;u1olt  ociatfaDuau s t)artnmf3iadlm elu s s)s2ur(rpno4apenlnvil( srrrx o;t0oex if3tatfm2umuvpnu4tltnxo oy1latraies;s0seuoio3oodole lietlt)a2uax o;o1optn iciasfm rm( snu0 rtoioctatfptran i s)trxriopoo4ap emfvtas  2taurooo4apxoifcils aDrl(vo () exnxf io1lp  li ol(0 rxmxr oudlpenlneiltfs2raur ou1apxnifetls m2umu s t0 reomfctatom ranvo ()s2um(rpny4omtnlfvsatf Dtmxr no4opxnmf3ilt a rmu o;t)tltriociodfa e uvo s t2toxrpiydlmee iei tfsrrmx  ot0oee ioeiydla2ra(vp;t4trxomfcoy1oa r ivi t  rur(mpoo1alenmnciat)artax  nt4olt mfciys a2ra(mp;t)tlxoxf ty1oa eau s;() 2tmxm3io4omtn neil(fsDumxr nt1optnmf3tld s2um( onu4texrxr oatfa e nes;(0texr(r3oydalen net tf 2ta(rpnu4ape if3iltfsDumump t4alxniocty1lm   u sls trtm(r3oydap nlfvil( srum( pou4opt mfeiytls2rmu pnu0 etrif3oa1la   uvs;t)s2uoim oo4lle mneiltfsDuax ono4teto o3ilt m emnmo u4arenxrcoydomD lues ()trtoir3oo4amtelnetat arrmuro;t4texnio3iydfsDrm(vp u)aeenmocootfpte u sl( s2umir no4alt mfvtas)arrm(mpou1oee  i3iydfsDul( pnu0tetnxfcio1oa r u o;s s2ur(m3no1altnmfeiat s2um(m ;u0oeeoiieildla rlumsnt4 eenxr3ta1lpDrluvs t)t2tm(m3oo4om nmfvil(fsrrm(  ;u0olxo fciys a el( s t)altoir3iy1op eauvo t  rur(o oy4ll e nvs t  Dumu ono0olenioetytfaDrmu p t0texrxo to1la r nes t setmim nu1lm nlicil(f Drmxront1oltnii3tadlm uan sn(4alxrmf3oa1fateau i;()t2xo(r3io1apt lfcsat)sDuau oot4tee  octlt aDrmn s;u4arxoxo3iydlm eauvi;t0 eurxm3oo1op nmnci s) rumu ont0tlt ioeilsfaDrmuvpnu0 etriocto1lmDr ies;( t2to(rpoydlp   fvsls)s2truro;u4alxn ieiadls uaumsn(4tltnmf3ta1lmt aiei;s0sexrir3ou1opte ics (f 2ururpnu0tpeo f3ils s ulu s ()teerio tatopt lues () rxmxr3nydap nlnei s) Dtax ont1tpxn ietyd mDea(ms;(0artrmf3to1lp r uvs;() eur(r iodlltnlietlt)srraxm ;o4tetomociysla emums;t0alenxf3iy1lmDrluei;(0 2toxm3ny1oltnmicsasfarrrumpnt4aetomi3tys s2rmnvp;t4trtnmfciydfat  ivs;(0 2xrio3ny4open neiat a2tr(moou1aleoiictldfsDrm(vs;t4 eenxf oatomDe i s (0 eurxr nu1al  lnvil()a2ta(m nt4opxnmictldfm2ra(vpnt0 renir3iotfa   ieo t)teuriopiydal  mfviasfsDtrx ooo4alx  ieiysla2ran snt0altoxo3iotopD aivi;s0t2xoirpny4om  livt s arrr( pou4tlen oeiysfm2rmnvp;u0arerxf tytomt  neo;(0s2uoxm3iu1aptnmnet sfsDua(  no4aptomiciatfmDemnvs;t0 etnmr iatfp rai s t s2uoxr3nu1al nmivtasfaDtru o;o0oee  feiytla rmnvs;u0 exnmr3ootfatranes ( srtm(m ny1llt micsl() 2rmumpou1olx moctlsfs rmuvo;u4 ltrmo3tatlpt anvsls  rto(o3iydapee ncia(  Duaxmonu4tleomoctldfsDra(vo (4tlerifcoatop   i i;t srtrir3iydlltelivt sf Drr(mono0teenmocild s2rlump;(4artrmocio1oa  li slt0s2xmio3io1lmenlivias)s2um(r nt4apxoif3tadla rmnmpn(0teeoir ty1fate n i;s0 2xo(mpno4amtelicsl(  rrmxr ou1aexnmo3iydls ra(msn(0teenxo oy1lpDe n o (  2toio3ou4omt lfvsl(fartr(rp;u0oee moctatfa ulumsn(0aetomr iodfpD aivols0 2trim3ny1oltemiet sf rtm(m no1tpxn fetatfmDrl( p u4 rxnxo tadla elu i (0 2trxo3oy1oltemiviat) 2uaurpnt0tpxniiciad m2ranmp (4aetoxr3ty1lmDrauvsl( s2urxmpno4amtemnvt t)sDtrxmo;o4oexn fetytfmDulumsnu0 rermr io1opte ivolt sexrio oy4alt mfciat a2urxmpoo4oet  fetadfs2el(vsnu4 exoxrctadfa e u s t t2xoxo3ou4lp   ncsas  Dtmuro;u1tlxnif3iasfm2um(mp () lxnxo3oa1lpD anvi ( teurxmpiy1oltemietls  Dur(rpnt1tle mi3iatfs ea( o (4aexomrcoy1lmt luvs;t seuo(m3iu4lpe mnctl(  rrmxr ou0alxn oeiysls rau ont)trtrxrctadfat lnvsl( t2uoim ny4lpt  nvtl( arua(r ;u1apt ioeiytfs ulu p;()texomrctytlmtrluei t0s2uoxm3iu1lltelneilsf Drr(m nu1tpxoii3ilsfaDranmpnt0 lxrmfciytlpteln o t srtrxo3iu1ap elfcsas a2rmu o;t0tptoiociysfs2em( o;t) lenifcty1lmtr i ilt0texoio3nu1ll emfviat)a2uax p;o0opeoio3tltfs umumsnu0tlerxf ty1omDr i o (  2tm(mpnu4ol e ietl(f rum( pot1tleomfeilsfs2uau s t)aetoxo3todlpDr n s t)sruo(r3ny1apee fvsatfa2rr( oot4tlen ociasls um(vs (4 lerxr totfp  au s ()t2xr(mpiodlme lnetltfa2rmuro;u1tptnmietldlm2ran on(0 lxnmrctadopDe uei;(  2ur(m3iudopt  ieil(faDtm(rp;o1ape ii3tadfaDel(vpnu4 exnxf oy1laD anvi;(0s2uo(m oy1lltemivt (f rtr(mo;o0aeto o3iydfaDrmump;u4alxrxf3oodopDeaivolt)srtoxm oy1lptnlnvil( arra(ro;t0tpxn o3ild aDumn ont)tltnxrcoodfatelieolt0 rtm(rpoy4ap e neiltfaDraxr ;t1apx  octysfs2rlumsnt4trerif iotopD an olt)srtrir3iy1lm nmncia(fsruaxro;u0oexomoctytlm2ean onu)texnxr tydlpte nei;t)seumim3oudamee fcslsfs2uau  ;o1ale mfctasfa ulu o;t4altoio3tatlpD li slt  2uoxr3oo4lpen ieia() 2raxm ;t0aptnifetas aDelums t0trerxo3tydlpD  nvi t)t2umxmpoydlle mfeiatfa2rmxroou0tlt  ieiytfmDemuvp;t0tetomf3tadlmDr nei;t texoio3no4amt mncs t  2umumpoo0apt  iciatfa rauvs u0alxomocta1op  anvslt0s2xr(r oodlle mfvi (  rrmu  nu0aeen iciaslsDemnvp;t)tetrmf tadlmtranvo ()s2xoirpno4al   nctl(farum(m ou4tle iictatfa rmumon(0altnxociy1lpD au i;t truoiopoo4ale lnesas)s2ua(r ou4alxo oeiydfs rmnmpn(0arenir oatlaDrlieo;()t2urxopny4lmte ivsasfs2ururp;t0oee  ociat sDemuvsn()teeoio iotomtr ivo;t)teto(opnodomtnlncsls  2trx oou0opt moctydlm ean o;u4aeerifcoytfm raivi;s  etoxrpno4op nlnctltf rra(mpou1tle moeiys a2elumpnt0 ltrxrcoa1late uvi;() rtmxo3iy4llen fcilt)aDuaxr ;o1apt io3tldlaDulnmsnt0 ltomf3io1opDrli ilt0 2umir nydoleelfvsls aDtm(mont1aeto fetlt a2umnvpn(0arenmr iydlatrlivi;s0seuo(mpno1oleelfetas sDraxrpno0tltn f3tytlm umu o ()arenmocoytomDrliei t texmir iu1llt lnctatfaruaxmooo4oet ioctatlaDrln s (4aetrifctatlm ean i;s srumxm3oy4amt lfesl(  2trum oo0opt  ociydfa eauvs (0artoif tadomt  ies ( trumio3oo4llenmfvs ( sDtru p;o0opt mociat s2ran pnu0 lxnio3oodlm rliei;s) rurxopio4apen fvslt)s2raxmpot0alxnmo3iys m2rluvont4 rtrir3tytlmD livi;()texmxr nydopeelieta( aDtmu  oo4oltniieildfm uln p;()aetnio todfmDe i sl() 2xrir3ou1omt mfes tf rtrumpnt0apt  i3iatlm ean p t0aeenmr iotfaDrln slt0 exr(o no1ll emiviat)arum(rp;o4teen ocildfmDeau o t)tltomr3iy1la r uei (0t2umimpnudam   ieias aDumu poo1alt iociatlmDumu s (0teermfcoydlm r n o;(0 exoxm3io1lp  mneiat) 2rm( ooo0altniociytfm uan o;(4teenmf tytlpD livo;()trtoio3nodomt miesls sDumum ou0oee if3tltls ran p t4tleoir3oadom   neils0srumim3io4omt  ivilt  2ur(r nu1aexnmf3ilsla2ranms;t0texnmrciotoaDr ueo;s0 etr(o iy1ol   ivsls aruau pot0oleoii3iatfa el( o;u4 ltrir ta1oaD  ivo;s trxmimpno1lpee nvils srrau p;t4texoifctys m2rl(vont0 ltnxr oadopDran s t) 2xo(opiudalte ivta()s2uau p;u4olxoiocild s2rln o;u4 lenxr3oodoatr ues (  euoxm3oodlpeelncilsfarua(m ;o0tlxniietyd sDuau sn()treoir ootoa rlnes;s  2umxm3ou1altnmfct tfartmumo;o4olxnmf3iltlm2ul(vs;t0 leomo oatom eaivs t trxrio oudll n ivs t)arrau  ;t0tee  ieiadfm2ua(vp t)alxrxo tadoaDrai olt)tetr(opoy4llenlfetlsf 2rr(rono1alt mieild mDelums (4alxnir3iadfaD lueo;(0 2xm(rpnudom elieias  rumx  nu0apeoioctasls2ulump;u4tetoxfcia1faDrlu sls seurir3iy1ole licsa(farurxrono0optnmf3iasfa rlnvs;(0alenio iytfp   ues ( texmio3ou4oleemfct t sDumu pot1oetnifeiadfa emnmp;(4 reomr3iodlp raneo;s  2trxr3oodapt livta(fsrurx p;o4aee  feiydfm ranvpnu4 exnxr oodomDr nvo t)tetrim3io4ap  livsas)aDraur ;t1tpxoiictlslaDran snt0 lenmocoadfa rlu sls)teur(rpiu4lptnlfcsas s2ta(ronu0ale  oeiysls rmnmpnt)teeoifcta1opD lnvs;s trxrir3iy4ole lfet t)aruax  ;t1aexn fciltls2ea(vo;(4tltrxf3oatopDrlivs (0s2xmxo3iydlptemnci sfaDuaur ;u4aetnmfeildlm2ul(vpn(4trenmr3io1lmDr nvs t  etoim iy4lpenliviat arum(  ot1texoiictldfa eluvs (0aexrmf ia1lmDelneols t2umiopoydlpen nvt s)srrmx  ;o4tlxn fctasfsDrl( s u4tetomf iodfmD livo s srxoimpoo4al  lfcslt srur(m nt0tlenio3iyd sDrmnmo;t4trxoxo3oadoa e ues;()trxr(o3nudam e ieilt srur(monu1olxomietlsla ulumsnt)trtomo3oadlmDrlivo ()srurxo3iu4alenlfcsl( sDrmxm ;o4aex iociltfm2uauvsnt0 eenmr totla  an s;t t2tmimpoo4llen fviat) Drr(mo;t1teto oeiatla2rmnvpnu0aetrif3iatlaDeaiei t sexr(m3ou1aptnmneilt  rtaum ;t1tpt mociydlm uau sn() rtnxo3oadlmDe ivilt0sexmxm iy4am nmnci ()sDrm( p;t0apeomo3iysla2uan p;u4alxoxr totomtrlnei t)teuo(r ou4lpeelfesls)artrx  nu0oexo ietyt aDrmu pnt) exoxoctodlate ueilt0t2to(o iu1aleemieils aDtmumpnu0aeen i3iatfmDuauvont4altrir oo1lpD  i ilt)sexmim oydlm n nvs tfsDrr(rono4teeomictytfsDea(mpnu0tlxnmr io1lpD lu il(  ruoir iy1apeelfvtltfs2rax pno0aeeo ictasfm2eanms;u)tlerir iotfmtranvs;s) etmxm ou4olee ivt ()aDrmxr nu1tee mi3iadlm2rmnvsnt4 ltomfctodfatrli ols s2ur(r3iu1lpt lfvi s sDtm(  ;t0tpe mf3iytlsDrlumpn(4tleoir iadlp  aivs t)srxr(m oydll e fctat)artrurpno0aex ifetysfmDrlnvo t0aexnmo3iytoaD lu o;s  2xr(m3io4lp nlfetl( aruaxmpoo4tlx  ictaslm uln o u4arenxr3iy1opt ai i;s trxr(opio4lltemiet t)aDtaxr nt4tpe mi3iyd sDrl(mo;(0altrxfciydlptr neo s seumxr iy1olee neiasfsrum(rooo1apeniietldfa rmnvs;t4trerir ta1lptrluvo;()t2xmir3no4lptemivt (faDraxmp;o1tltomietls a ua( o ()altoxo3oo1fate ies;(0trtoxm3nydlme  ncta() 2umx pou1tlxnmf3ilslsDem(vp;u) etoxrcoo1latr n ilt0tetm(rpiy1om nlfvilt s2ta(m ou4tleomfetytfa2umums;u4tlxnifcoy1lmte nvo s0s2umxr ou1opte ieslt srurur nu4olto iciyd a elu o () lenxrctodop eauvo ( s2xoxm no4ol nlfetas)srrm(r nt1aeto o3iysfm rmu o;t4teenxo3iytlmDe ues s t2urir3ny4omeemfcsl( aDuaur no4aet  o3iasfs rm(monu0arerxr tytfatrluvi;()srurxm3oy4aleeliciat)srrrxmp;o0oexomicilsfsDeln p u4artnir ty1lateln ils) rum(o oy4ame  nvils aDrmxrpoo0oleoif3ild a2rmnmpn(0 etnio3iotop  aivs;t  etmxmpiydal  lneil( arrr(root0tpt iicilslaDrauvon()altoxrctotomDe ueo;t0trtrirpoy1llt mfetlt  rtmump;t1tleoio3tldlsDrl( onu4 etnmr3io1lm e u s;t) etmxm3oo1am  mncsls aDrr( o;u0texn f3tytlsDrm(vs u) ltrxf ta1fpDr ies;s) euoxopio4am nmfvs (fs2ur(  ou4oetn f3tld s2rmn p (4aeeniociadlptrauei t0sexoxr io4al nlnct ()sDrmx o;t0aee mieiytlmDuluvo t0 rxoxf3oodlp rlnvi;t0 etmxm3no1op n fvtas)s2ur(mooo0ape io3iltfs2em(monu)tleoxo3ty1oaDe n i s)s2uo(o3no1ope  nvs s)s2urum ;o0oex ioetytls eanmo;u)tlxoifctadlm rau i s texr(rpiy4ape mncs s sruax ono4aexoiieiasfsDumnvp;(4arerif3oatlp eai s;s0 2tm(r3oo4opt licsasfaDra( pnu4opxnmo3tyt m rmumon()aetrif oytom elu i;t0 2xr(mpio4ll   ncils  2ua( o;t4altoiociys s ulu o;(4 eerir iatoa e ies;(  eurxm3oo1ol   fvilt aDrm(r ;t0oexn oeiltlaDem(vpnu0arxnmr3iydfmD luvi t0 etmxmpiu4oleelics s a2ra(rp;u1aptniociatla2emump;()tetnmf tytfp eai i s seto(mpnu4ap nmfvt t)a2tmxro;t0teeo ociatfa umu p;t4aetrxocto1oat li s;s  2uoxo3no4optemnct ()a2um(m oo1ope  ictldls uanms ()trerxr ootfmDrlivols0 ruo(m3oudomeelfctltfs2umuro;u0aet mi3iytfm2uln p;()aexoio ootlmtr uvs;(0trtoxo3nodopt lfcils  Dtmuro;t1oltn i3iysls eln onu0 leoxocty1lp  luvol(  rtmiopoy4omen nctl(fs2rrxmpno0teto o3tadfsDum(vpnt4 ltnmo3tadfatr u s s) exoxo3ou1aleelfctatfsrrm(m ou0ope ii3tytlaDumnmp;u)trtrmf ta1oaDelieo s)srxm(mpny4op emnes s) rrru poo0teenifciyd aDemnvpn(0tlxoxf3oa1fptelnvsl()sexm(r ou1lptemnvs sfsDtmum nu0tee ifeiadlm2elnmp (4tleomr oodlpDrluvs;s0srtmxrpnudomenmnetat aruaxr oo4tet mocilslsDua(vp;u)tleoircoydoaDelnvi;t s2ur(r3nodlp elnctat aDuaurpot1aptoif3ild a emu p;()aeenxr oatlpt  ieols0t2xoir3ny1ol e nvia() Dtmurooo4aleniictasfs2emu s;(4trtnifciydfmteai slt)s2tr(opiydape mnetat aDumu o;o0altoio3iadfsDrmu s u0 lxomrciytla eluei;s) 2uoxmpno1lltelivil()a2tmxmoou4alxo fciadfa rmn on(4trenmfcoa1lp  ln ols)trto(opny4al  lnvsatf rurur no0tleoifeiyt aDumn ont)altnxr ia1lmte uvilt0 rur(mpiu1amt mieias) rrr(mpnu0aexnmo3iad aDum(vpn(0alerifciatfatr n o s0trurimpoo4al nliei () Drmum ;o0tptn ieiltlm rmuvs ()trxrmo3oa1lp   uvi (0 eurio ou4omt  fetls)s2ua(rp;o0apxnmicilsfa2ea(mpnu4areoxrcio1fpD luvo s) etmxm3oo1opte ivia()s2tr(m ;t0tetnmf3iysla2ea(vp;u4treoxf oa1omt  neo (  euo(m nydam  mnci ()s2tru  ot1ope iocilt aDran snu0tlerxr iodoa eanei s0t2xrxr3iu4op  mnesltfsDrm(  oo1teto iciytlmDumn s;()arenmrctytfmteluvi s)seurimpno1lptnlncsa(faDrax ono4opto ictysfa2ulnvo;t)trxrmo3oy1fm  luvs s) rtmiopio4am emnei sfaDua(mp;u1olxnmoctlt aDrauvp u0 ltnmoctatlat  nvols)texm(mpio4ap e ieiltfsrua(mp;o0aeeo o3tysfa2ulnmo t0aetrxo3ta1faDraivi;s)setoxmpoydomtn icils)sDuaurpnu0oexoioctldlmDrl( pnt4altomfcio1lpDrau il( t2xoxo oy1om  mietlsf rua( pno1olto feiys a uln p u4 leomf3oydla eli o t)setmxr3oudap nmicsl() Drru o;t4oeeo i3iyt a eanmo u0 rxrif3io1fmDranvsls)srurio3ny4am  lfvi sf Dumxr no4oltomf3ilt m rmuvs (0 rxnir3tytoatr ueols0trurim3oy4lmeemfetat  rta(ro;u1aleo oeias m um(von(0altnxfciodfaDeai ols0srtmiopoy4llt  nviat) Durxrpno4oet ifciysla uanmonu)arxrio3ia1laDrlnvsl(0sexrxrpoudlp  mfvsat)s2uaurp;u0aexn ietasfa2ulnvsnt)teeoxf3oatopDr n i;t0trxm(o3oodolt  ncta( sDraum oo1oltnmo3iasfmDul(mo u4 rxomo tytop eanes () exmio iydop nlfvilsfaDumxmo;u1aptnioetatfa2em( o;t)tlxrifcootfm  aneils)seurim oo4lmee neiltfarrmurpot1tptoii3tlt mDua( s t0aleomf tatla r u ol(0srtoir oo4lmtnmiet s)sDrax  ;u1opt moetysfs2em(vp t)tlenxf3oadfp rlieol()t2xm(opiy4am  mnctas)sDrmur no0openifetltfaDumu p u4aeerir tytfmt lueo;s)tetmim iu1lp nmncs s srtm( p;u4tpeoiociytfaDemn o ()trenmfctadlp eln ilt0 2um(m oo4lltemivt ()a2urxr ou1tle  ociatls2rlnvont4altnir oadopteluvs s0 2urirpno1ap   fvi s) 2ur(mpou4tpt  fcias mDra(vsn()trerifcoadfmtrauei s) ruoxmpiydalen icslt) Dtrumpnu1oet  i3ias s ul( p () exrio3oytlp rauvs ()s2urxrpiodoptelnvia(f Drmxrpno0alenmfcilsfsDrauvo t4 reomo iytom e uvs;s)tetrim3iy4am  lfvs (fsrra(r ot4apxo o3iysfaDel(monu0 rtnif3iytoat  ueilt0 2tmxm no4opte feia(fsrtrumont0opxniieilsls2em(mp;t4texrxfctydoat ln i s)srxr(m nodap emivsl(fsDrm(m nu0alto octat s2ea(vont)alenmr tatlatelivo ()trxo(r3iu1altemfeils)a2ta( ono0opeoifcilt m ul(vont4 renmr ootomDr n ols0srxmiopiu4lp nlfetl(fsDtaurp;t1olx  feiytls eau o;() ltnio3ia1oa rlueo;t0seuriopnydape mfctat  Drax p;u4oexo f3iltfs rmu snu4aleoxr ty1lp rlu ils0srxo(opoy1lmeemivias  ruaumo;u1tetniiciasfs2el( snt)aeerir3tadfat an s (0setmxo io1omenlicsasf 2rrx ont0alx mi3tadfaDel(vsnt)artrxr3ty1lm elieilt t2urim nu1ol emfcias aDta(m nu0altoif3iydlm emu o;t)tetrmr3oy1oat ai s;s0 exrio io1omeemnvia(f rtrx o;o0apt mociadla ulnmpnu0aetnmrcoy1fm  lneo ()t2trio nudamt lnvt () rtm(mono4tpe iociatfmDeanmsnt4arxomrcoytlmtrai s;s) 2tmxr iydlmt lieslsf rtm(rpno0apxoiieiytlm elumo;u4trxnir3oy1opte n s;s srtrxr nudolt mfet s)sDraxront1ale  f3iytfaDuau p;u)tltoxoctatlp rlu slt0t2toirpio1ap   nesatfsrtr(  ot1tlt  ieiadfm emuvon(4aetnxfciotoa rlivils0 eurxm3iu1lm nmnvilt)a2um( onu1alxomieiys s2umnmp;(4tltnmr3totlm elu s (0teuo(m3iu4alee fci sfs2umur no0tptniietasfa2elumo;(4aetomf iydoaDraivs s) rumim oo4ale  fvil()arumx  nu4tpe  o3iatfmDua(vo u4 eenxf3tytfm  aivi ( trumiopnydaltelieta()artmx ont0alxoioeiyd a2umnvs;u0aexrir3ia1fpDeaivs t0 rumxopno4lpen nesls)aDurxro;t4oex mfeiltla2uan onu) exrxr3oytfm e neo;(0 eumir oudome lfct t) rtmx  ;t0oetomietyt a elnmsnt0aleoiocoatlpDeanes s s2uoxopny4lpeemiet s  2rmumo;u1aptn o3tat mDemnmsnt0tltnmrcoa1omte n i;s0trxriopnydol elfesls  2tm(r ;u4apeo octldfs rluvont0aeerxfctotlmDranvs;s)trto(m3iodaptelfcs s  2tmum nt0oltn ietatlm2um(mo;u4trtrmr3oo1oaDr uvs;t s2tmio3oy1llt lncia( sDrm( onu4aee miciasfa ra(vpnt)alenmfciadlatrln i s  2uo(opiydlp  lnes ( sruauronu1aex mfciadlaDuauvs;u0aexrir todfm  lu o s) eto(mpiodop elfes s  rumxm oo1tltomietysls2ea(ms;u4texoxo3totom e ues () 2xm(o3no4ame mfcils aDuaumooo0tpe mo3iysls2uanmsn(0 lenir totopD  nvi;t)srumirpiy1lltnmnvilt) 2rauronu4oex  o3iadlm ua( pnu4tleoif3ty1optr ues;t  rxmir oy1ol nlicil(fsDta(  nu0oeeo f3iadfa elumsnu)tlenxr3tytlmt aieo;s s2toxo3oo1lp elivs () Drm(mp;o0openmo3iadfa2el(msnt0 rermo oatlmte nei t0 rxmxo no1lp nlicias)srrm(mpou4tpt ioetlt s2ea( p (4artnmocoatfmt ln ilt0srtriopiudapenlici t  2ta(rpot4olxoifeiat a2emnvp;() lxnir3iodoat ln s;s  2xm(opnydamtnmfcilsf ruax ont0altnmocias a2umnms u) rerxrciytlmt anvil()s2tmxo oodope  fvs t  Drm(mpou0apeniietatlm2em( o (0altomrcoydopD  neo;(0 eurxrpou1lltn iviatfsrua(ro;u0apx  feiysfaDrlnvon(0artnircoatomDeaies ()trxo(m3no4ap  mivsls s2ta(mpnt0openmictytls2rl( p;t) lxomr oy1lm  ln i;t  exrim iodolenmiesls sDtm( ooo4aeeo fciadfs ulnvs;t) rtomr3ta1fmD  ueo ()trurir io4apeemfcils) Dtrxr ;t0open i3iytlmDrmuvp t) ltomo3oydop raivol()t2tm(r3iu4ap n fetat s2rau pnt4aleomfetlslsDea(vsnt0 reomocto1opt an slt  euoim3ou1altemncsasfsDur( onu0tlxn feiytlm rm(ms () rxomocoa1lat aues;s trxoimpoo4ll e ietlsfa2tm(  ;t0aee  oeiad a rmnvont4tetomocoo1la raies (0 eto(r3iodap e netasfsrumxmp;o4tlenmf3ilsla2elu p;(0 lxnmrciy1lat auvo;( setoirpnodopen fci s  Dtmx pou0teto iciatlm ra(msn() lenif3oatlateliesl(0sexm(o3iy4lpen fcsa()a2ua(mpnu0aex  i3iyt s uanmp;t0aeeoifcootomt au olt  2xo(mpnodolt mies () 2ra(mooo1open ieiasls em( onu4teeomf to1omDeln sls0t2xoxmpiydoltemnesasfsDrrx  ot0tpx  o3ils a2ranmp (4tlxnxociadfate i ils0srtrxr oo1am  mfci s)sDrm(r ;t4aleoio3iyd m2rlnmo t4artnmo3tatlpt  iei ( s2tr(mpny1al elneia()aDua(mooo1aex  feias sDemnmp;t)tlxrxfcoy1fpD  ivil(0 2uriopnu4lpe lnet tfa2trxr ou0tltniociltfm2uan o;()aexrxf3oytlatrau o;s setr(m3iy1lpt  netatfsrur(r nt1tpe  i3ils a2ua( o;()tlxnmr3iatlaDelneo t0 2umir3ou1apt lfvsl()sDtax pnt0olt mfcild m um( snu0tltrxr oy1fptr n s;s0trumxm io4lptelnet (faDua( p;t0aet ifcilsfsDuln p t)arxnmf3tydoa  an o t)trxmxm3iu4lptnlicsls  rtmxm ;o1tpx io3iydfm2rmn p;u)arxomo iydfpD au sls0seurio iudale lneia(farumurpot4opeoifciltfm rmnmpnt4 ltnmo3iotfpD aneo (0 etoxo iy1lpenlneilt)s2rru p;t1ape ifciyslsDulums;u0 reoir tatoptrlieo t)teuo(o iu1lpeemnei (fs2taxmp;o0oee ii3tld m2umums;(0 ltomr ia1oat luvi;()s2uoxmpoudam nmfct s)srta(rp;u1tlx  ieiltfs2rl( s;()trtrirciatfpDrln i s0trtmim ou4ol  micsat) rurur oo4texo icildls2ulumo;t) etrifciotlmtr u sls0 2xmiopnodopeelncslt a2tm( pnt4alen ociltla emn p;(0trtomo to1fm e uvo s trurim3ou4amtn ies ( aDrm(r ;u0ope ioeiytls rl( on(4tltrmr3iy1lpD auvslt)srxr(m3ny1aptelfesa( sDrr(r ;t0aee miciltfa rm(mpnt) eeoir oy1lptelnei;t texmxrpnodome  feta()s2ur(r ou4tlx  iciatla2rauvp t0altrmfciodlpteli i s0 exmxo3iu1lpe mnei (faDuaxmpou4apxnmiciad m umumont)trerio3iytlp rai s;s0seuo(o3oy4om nlictl(fs2ra(rpnt4teeomfctad a2ea( o u0 lxoir ootlpDr uvo ()srtrxo io4lmeemnesa()srrrur oo0oltoiociyslsDrln pn(0 rxnmf tatlmDelu s (0trum(mpiydop  livt t  rrrum ;u0tlen iciatlm2el(mp;(4 rxrxf oadfp eaies;t  exrxr iy4lpe lieilt  2tmum no4tetniiciatfa uanmpn(4 ltrmr3to1opt au o (  euo(r ny4lpeelncsa(fsDraump;u1oetnmfeiat aDel(vs;() exrmf3tydla raueils)trxr(o3iu1lmtnlicia(  2um(mp;u0tpx  i3tatfsDumumon() eeoio3ta1lmDraivi;s0t2xrio nu4omt mnesl(fsDrau  ;u4tex moeilslmDrmu p;u0tlxnmocto1lpDeaivs;t0t2xrim3nudlpt livil( srta(mooo4aptomocias s2ul(vs u4 lerxocootopD  n i t sexrxrpou1lm nmneslt s2ururont0aptnmo3iatlsDrmumpnu4trtnmr3oydlpD ln i;s  2tmiopiy4am elnesas  2urumo;u1tlxomo3iltlsDuaumsn(4aexrmo iatfm r u o (0 2uoio nudaltnlivilt)a2rr(r ot4oet  ictysla rln o;(0artnxf3tadlp  li i;()trumxo3iu4open ictlsfa2rax o;t0olxnmiciytla uan s () lxnmr3iodopDr u sls  rur(m nydll  mnetlsfs2tmumpou1apxoiicild sDumu o (4 lxoxfcoatlmDeaieo s srumxrpno1ll  lfvsat a2rax pot4texomfciatlm rl( o ()alxrif tadfptranes s0s2tm(m nu1apenmnvias)arum(rono1optomoetasla ulumo () lenir3todoa r nvslt trxmim3iodap n feil()srua(mo;u4oexo oeiydfaDel(ms t0 etniocootfp elues s s2tmxm3oy4ll nlfvt t sDum(rp;u4optn ociyslsDrmuvs u4 rerir3oatla eaneol(0 rtoir3iu4altnlncs t)artm(m ;o0tlxoifeilsfs ra(vo;()arxomf3oatfm e i i ( texmiopnudol nmivi s) rtaxmo;o1tle mi3tltfsDrmnmonu4tetrmoctatop rlu s t0setoxo iu4op nlnvs t) 2ua(mp;o0olto iciytfsDeln o;t0artoio3to1laDr u s (0 ruoio io1lmtnlneil(fsDum(  nu4tptoiieiasfs rl( snu)arerir iydomDr uesls sexm(r nydole lies sf 2tm(rono4ope  oeiasfaDranvs;(4trtoif oadfaDeli slt0 etr(o oy4llt  fciasfsDtrxmpnu1tpen feiadls2em( s (4areomfctodfmt au i;( s2ur(m3no4lpeelnesat a2rr( ont1aetnmiciltla2umn s;(0 ltoio ty1lateaues s teumio3no4omee icsat)srumx poo1aexoiieiatfs uanmo () rtnmf3iadfm   uvs () 2tmim3io1lm  mnes ()s2trxmo;o1aetomfetls mDelump t0aeenmf ootfmDeai o;t)trtm(o oo4llen ies tfartaumpno1oee iiciys a ran s;(4artnmr ta1lmD aues;t)s2xoxm3io4ll e fvtlt)sDur( o;t1open iciyslmDeln s t0aetnxo3tydoa   i o;s  exrirpno4oltn fctltf Dtmu  ;u0opxnmieiydfa2elump u4tltnxf oadop ranvs s trxmiopoo1ll nmfctlt  2trumoot4aptnio3iyd s uanvs;t0 renio3oo1op rai i s0s2xmxr ny4ame mnvs t) Dtrxmpoo0aetniietat m2umu p;t0artoio3oadomDeanei t0 2xoxrpoudam nlfviatfsrtaxmpot0apx ioeiytls rluvp;t)arxrxfcoo1opte nei () rumxmpou4ole  fcs t s2uax p;t0tpt mfeiyslm2rm(vonu)altnirctadlmD lnvi (0t2xo(mpou1op  lnetas  2rm(m ;u0aptnmf3tad s2umnmsnu0tlerxr tydlp elnesls) eur(m3oy1lm elfvs sf rumxrpou1aex  o3iydls2rln snu4aleoxr oy1opteln s s)sexmxo iydal nmfci t  2urxmo;u4aetoioctasfmDeauvo;u) lerxrcootoaDrlu s;s)sexoxmpiydomen nvt (  Dum(mp;o0tetn fciasfm2emuvs;(0altnmo oydfaD  i o;s0t2um(r oodamte iesls arrmxm oo0aleoiieiysfm rl(vo;t0 eermocto1lat lueo;t) exrio iodal nmfeilt)s2ra(rpno0aex  i3tydlsDraumpn(4aexomr3oydomtean s t  2xrxm nu4llt  icsas)sDrm(  oo4ape  f3iasfmDra( p;t4trtrif oa1fpD auei;s)s2uoxmpnu1om  mncsl(fsDua(mo;t1opxnioctas a2el(vpn() leoir tatfa rln slt)s2trir ou1lme lncilt)sDurum nu4openmictysfmDel( s u0tetnxf oydfp   nvs;s0trtm(m3no1apt  fctls aDtaxmoou1tpe ii3tatfm rlumo;(4trtrio3iadoaDelnvo t0sruoxm3oo4apte nvsas)aruaxro;o4oet moetasla2emu s;u0aetnircoa1lmDe uvslt)srtrir3ny1op n nvi t sDumx pnt4olenii3ias a2ea(mp (0aexoxfctadfmDr uvo;s)teumim iy1aleemietls  rrr(  ;o0apx ifeilsls2ua(ms t0tltnif3iydom eai o;(  etmiopiu4llee fvs s) rtmumpou1tlx ii3tld mDuaumo t0texnir3iodop eaneo;s0trxrir3ny1alenlicilt s2tr(root4tet ifeildlm emumo u0texnif3todfpt  u s t0teuoio oo1oleemics s)a2ur(ront1olt iieilt a2rmumsnt4alxrif3oatfa e ieolt) rtrirpiy1altnmnctlt sDrm(ro;u4apxn ieiltlm2rm( s (0teenxo3ta1oatean i ()s2tr(mpou1ll   fcslt aDua(r no0teenmoeiad a2el(vonu)tetriocto1lmDr uei t  rxmxrpou1apen icsa(faDum( onu1apen i3ias m2elnmo;u0aeeoxo3oa1omt an o;s seuo(opiu4al  lieils artaumoou4tptoii3iytla2elnvs t) reoircoodlmD  uvi;t)t2uoxr nu4optnmivia(faDtaxm ;u0olxnif3ildf
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t0texrxmpnudom nmivilsf rrrur no0tltoii3tld aDul( p;t)trxrmo oadfaDe u ilt)s2tm(m nu4llen ncs t a2rrumpnu4alxn i3ildlaDra(ms (0 rerif oy1lmtrlieslt trxmxopoo1lpt  neslsfsDrr(mpou0aptomo3iadfs rm(vo;(4 rtrxo tydfp  auvi;t0s2tmxm no1lpenlfvsa(f 2umxro;t4aptoio3tadla rluvonu4tlxnxf3tatlpte n o (  eumxrpnudal  licsa( s2rrum ou0alto o3iatfmDemu o;(4texnxrcio1fmt lu o;( sexmxm iydopeelieiatf Duaur no0open oeiadfs eauvs u)treomo3tydfateli s;(0t2uoio3iu4alt  nvi t a2tm(r nt1opeomieildfs rm(von(4trxrif ia1fm r i sls setrirpoudlm nmfvsls) Dtax pot1apt miciadfaDrm(mo t)altrmo3iadlaDrln ols)t2trxrpoodamtnlnct tf 2tax ono1aex mf3ias a2eaumpnt0texnxfcia1opDelu o t0t2toirpio1oltemneils)aDua(rono1aeeo ociyslsDul(mo;() eenirciadlp  lieo;t trxoxo no4lp elneias sDrru pot4aeeo f3iltfs uauvo u0 exniocoy1oa rluvil( setr(rpoo4ll e fci (fsrta( oou4aet  oeildlm2ea(vp ()tlenif3oydopDe i ils) etrxrpiudamen ictas)sDta(rono0optnii3ilsfsDemnmo t0 rtnif iodlatelieil()s2tmxmpiu1lltemnctas) Drax o;t0ape  i3iys a uauvpnu0aetoxr3ootopt au o;(0s2uoimpiy1lpenmivsatf Drrurpoo4aetn oetytla elumo u0alxnio3oy1omtrlieil(0t2urio iu1om nlieiat  rrax o;u4tpe ioetltla eaump;t4 eeoircoatoptranvi t0seur(rpoydaleemfvil()aDurx pno4tpe if3iatfa ulnvs t)tlxnxrcoy1lpteanei;t) 2xo(m3oodolenmfcs sfarururooo4tpenmoeilt s2emu s u0 exoircoodfm rau o s) rur(mpnydome lfct t aDtm(mp;u1alxoifciys m2ul(msn(0aeerir oatoaDran i;(0srxrirpno1om e fetas)a2rrxmpnt4ope  f3iad mDumu o (4alerxr to1lp eaiei;s)t2xm(m oo4lleelfes s) rua(rpot1tlxomoeiytfm uau p (0tetnxr3iodoaDrluei;() 2xoxr iodlptnlnviltfsrur(monu1aeeniiciat a2rlnmo;u4texnioctatlptraies;t0 ruriopou1al  lnvsat  rtrur oo0tpx iieiys s emuvp;(0 eenio3iydlm eliesl(  euoxm no4ll emfeilsfaDrru  oo1tltoifciytfs el(mo (0 rtnxociytla elu s (0texrio3oydap  lneta(  2ta(mpnu0tpe mfetatfa uanvs;t0alxnxr io1fmDr u ol(0 rxrio iudal  mfesat srraxmp;u1tlto f3tydfs2ra(msnu)arxnmo iy1fpD anvs s0truoimpiy4ole  ics ()aDrru p;t4teenioeilt s2ulnmont0alenifcoytlatrln i t  rur(r3nu4ole livtl( a2raxm ;t1oexnioeiasfa2ran p;(4 etrif totfp  an o t s2ur(rpno1lme lnesls)arraump;t0oeeo oeiysfm rmump t) rxoxo tatop ranei;()trxmir ou4ope  nvsl()s2um(m nu1oex  f3tlt m umu onu4 rtnxr3iy1la rau o t t2tmxm oo1optelnvilsfsDua(rp;u0apxn octltfa2el( s (4trerxr iydopDraivs;()trum(opio1ap nlnctls) rua(rp;o1aleniociydfs ran o;u)trtnio3io1oate n s ()t2tmim3no4lp   fcsat sDtm(rpnu1apx  o3iad a ulu o;t4arermoctydfpD ai il( seuoxo3no4omtnmieslt) rrru p;o4optn iciaslm ulums u0areomf3ta1lmDelnvs;()t2xoxo3nudlpte fesl(fsrta(mo;t0olxomo3tls a ulu on() leomrciydlmD aivols0t2tmim3nodope  fesl(fs2rm(r nt1oexoii3iyd s umn pnt)tlxomf tytfpDr uvils) 2uo(m3ou4ll elivias) Duaurp;t4alenif3iatfsDul( o;(4tltoiocta1lpDeanei;t)setm(rpno1ale mncsl( arur(mpno0oexoifetysfaDrl( o;u)aetnir oy1oa ean ols0 etoxo oy4omen ncil()srtmxmpot0aetn i3ilsfaDemnms;u4trxrir3oadlmDraieols0t2uo(o ou1opte neia(  Dra(  oo1tee  ocildlaDra( s;u) lenxo ty1opt aueil(0s2urxr nodop n feias srumum nu0ale  ociysfmDranmo;(0trenxf ta1om elivi s0 2xoxo nu1lmenmncsatfarrr(m nt1aptomiciltla umnms t4 lerir todfp  lnes s  exm(r3nodapen ivtl(fa2ur(mont0tpeomi3iat m2ul(vpnt)tltrmr3iy1latr ivi;(0trtr(mpnu4lpt mncilt)artmxrpnt0ape ioetldfaDea(mon(0 exomr ia1fpDraieo t)t2xo(o iydoltnlnvsatfarurxrpnu1tptomieiltlmDrmn p;t0 rtnmf3iadfaDe ivo;s)srto(opno4lleemivia() Dtaum no4alxoifctld a rmnvp;u0areoxr3tatfm   nvslt0sruo(o oy1lpe lfct sfsDumxmonu4opt iieiat sDulump;(0tlermr3todop   uvi t trurxo io1opt lnesas)aDtrxr nt4oetoiiciasfm rm( o;t0 ltnxrcoo1oa rli i (0sruo(m3ou4oleemiciatfs2rr(r ou0tpx  fciytfmDuanvpn()tlxrio oodlmD  ueolt0setm(opiydlm nmiet t)a2tmu oou0olt if3iyt s2ul(vo;t) ltoir3iydlpt aieo t teuo(m oy4llt lfetls s2urx pnu0tlxn ocias sDrmump;(0aleoir iotfat anei s0 2trxo3ny4ol nmics s) Dum(mp;t0tlxoioctatfa2rlumpn()teeomr io1omD livi;s0srxrxrpiu4apt  ietatfaDtmumpot0tlxnii3iydfmDuln s u4trermocoa1fat an i;()srtoim3oydom  lnctat a2um(  ot1tetoiieiad aDeauvp (0aexoifctodfpDrlnvi;t)sexrir oo4olen icsls)s2um(r ;o0apen o3tysfa eaumo u4altomoctytfm  li s;s  exrirpoy1apt livsasf Dtrx ono1tpxomfetyt a2uau snt4texrxfciadfaDrau s;(0srxmirpiu1om  lncils)srtaxr ;u1tetn fciyd s eauvs t4treoxr oatom eluvi ( setoxrpnodllenmfcsasfsDrrum no1aetn iciad sDemnmo;u4 ltnxrcoatfmDrau o;t0trtrir oo4om  mfct t  rurxmp;o4olxn iciyt s2ra( snu) rtomo3oytfatr n i;t0texrirpny4am   nvs tfs2tmxmpnu4aeen i3iat a2rluvp t4teermo oa1faDrluei t trto(mpnu4lmt mnct t sDua(  ;o4tpt  i3iydlsDul( o u4tltrxrciadop rlnes;s0tetoxr3oy1aleelictlt sDrru ooo4ole miciadfaDelnmo t)texomr oydfat ln sl()sexm(opiu1opeelies (fsDurum no1aetnmo3iytls2eau s () rtnir iotlaD aneo t)srxoxm3no4llee feta() ruaxm ot0oetomf3ias m2uanmo;t0aexrxf3oo1fa e ueo;s trtmiopiy4altelnvilsfs2trx poo0tex  ieiyslm el(vp;(0aexoxr3iytla r uei;(0 ruoir iu1ll  lfctat)srtrxm ot0opeomiciat mDemu sn() eenmocto1oat aies t s2xm(o oydamtemivsls aDua(r ;o1olen oetysfs uanvsnu4teenmf ta1fpDr ues;(0trxmxr3nu4oltelies sf 2rru ont0opeoifcils aDel(vp t)tlermoctydfa  luvi () 2tmxr3no4omee fet ( a2urxrp;o1tetomo3tltfaDumnmp;()trxrmociydfpDrai i t0t2xm(r3nu1olen fvi tfarrau  nu4optoiictytfs emumo;t4tleoir totfmD lu slt0teur(mpnu1op   iet ()sDrmump;o1tleoifetas sDrmuvsnu0tltrio3oodoatrln ols0trumxrpoudlp  licsl(f rtaxrpou4aeto fcild a emnvsnu) etrmo3io1oaDr uvs t  2uoiopnodol   nvslt) 2tau pno1apxoifeiys a rlums;u0trxrmf io1fm   u o s)teurxm nodol  lncsat  2ra( pou0apxo o3taslm ul(vs (0 eenmociotfaD lueo;s)seum(m3nydomeemict s)aDrax oou4alx mo3iyt s2rl( o;t4 etomf3oadfm  anvs;( tetrir iy1lptemnvtat aDumxmp;t1tleoif3iad aDraumo t4 etrir tydlm  luvo (0sexrxr oy1ol eliviltfs2tr(ronu0ape  o3ilt s2umump;(4aeeomociytomt  i i;( seuoxrpoy1altelncsa(  2rmx ono1apx  ictytfaDea(mon() etrmr oadfmD livi;t) exm(m oo1lltnlicslt  2umxroou4optnii3ildfaDumump t0treoxfctytopDelnes;s0teurxo3oy4ap nmnvsls)s2ua(root0aexnmo3iatfa umnvo ()teeoxo3oa1opD  i o;t)setoxo3iudomtnmivtasfs2rr(mpno4alxoiiciat m2eluvp;(4trtrio tydfpt  i o (0seurirpiodlm elfcta( s2tmumpou1olenmfeiatlsDumumpnu)aexnmf oytfaD aivol(0 rxoxopiu4lme mfvsa( srrmur no1aetnioeiydfa ulu onu4 rtnmocoytlp  an sl(0 rxoimpiydope lfet t artrxro;o1oexnmo3ils s2em(vs;(0 leoxr3oodlp eliesl( sruoxm iodal n fvil( arumu onu0tlt ifciytla2rlnvo (0artrir3tytop  luvs;s sexmio ou4lmenmictlt  rra(r ot0aex  ociyslmDum(monu) exrxr tydfatraneols0 2tmio oo1lmt lfvta()sruru  nu1aptomictys sDeau p;u0 ltoxrcoytlmD li s t) 2um(o iu4omeemietat  Drax pot0opto i3ildfm um(vs;t4tlxoxrciotom rli s (0 rurxm3iu1apenlfeil(fsrtrum nt4tex mfeiysfa rauvp;t0 eeoifciatoaDeaiesls) 2xrxo no1olt lfciltfaDrm(moou4olxn octldfa ul(ms;u0 rermr oatlmD aneslt)tetrir iodlptnmfci ( s2rrx  ;o1altnmiciytlm eaums (4aetoifcio1fa r ies;t0 rxmxopnudom n ivtl( aDrm(mp;u0tee  fcilslm2eau pnu)tlxnif3ia1la  au i;(0trtoxm3iu4aptn ieiasf rum(ro;u1tptomiciatfsDul(vpnu)alxnmf iatop elivo;()t2uoxo3no4lmeemivsas  rtaxrpoo4opxnmoeias m2uaumo;u0tlxrmf to1lateln i;s t2toxm3ny4lp  lfeilt) 2uaurpoo4oleoiieilslmDemn o;u)artnmo3oytlp r n o;t0 euoio oodaltnmivi tf rurumpou0tlen i3iad mDemuvp t4 lxrmo io1la elnvi;t) 2umxrpiodlleemfct t)sDta(m ;o1aptomoctld a uluvo;u4tetomr iydoat aiei s0srxo(m3oudlle mics s)s2ra(m nu0olxomoeild m ua( snu) exnxr3iydoaD anei;t0 2tm(r3ny4am elfctas  rumumpou0oetnmoeiasfmDul(mp;(4aexnxo iodfp ranei;s sruoiopoydalt livia() Drm(rp;o1tle ifeiadfs uln snu4trenmfcoo1fmDelivs t0srxmiopiydlmenmfctat  2uaurpou1tleomf3iytlaDua( p t4tltnmf oo1lp r neo t trxrxo3no4op nmics t) Dtmxmo;u0alxoif3tadfm rmumo (4tltomo3ia1lpDrlues;t  etoxopio4ale  nvtl() Dumxrooo4tpeoifctaslaDuluvpn(4tltnifcta1om e uvo s tetrxm io1lle  ncsat  2urxrooo4oltnmfeiltlm elumon(0aexrirciytlp rai s;(  eto(r3iu1lmenmiei sf 2ta( pnt4tet mo3iasfm2emnvp u4 etrmr tatla  lueo;(0 etm(r3oo1al emieil( aDta(r ;t4olen ociatla2um(ms t0artomfcoadlaDr i ils) exrxm3no4ale licta(fartmxm oo1tlx  ieiadfm2eln onu0aetrxocia1lm   nei;(0trxm(m3nydlpt  feia()artr(mpnt0optnio3ils sDra(ms t)arxoir iatoa rluvols s2xmxm oo1lltn neta(faDua(m oo4opxniietltfa rlumsnu4trtoif oytlm eln o t0 etr(rpoo4optn icia(fsDtmur oo4olx  f3iydfmDrauvont0aetnir3oydopDeln o s)srurxrpio1lm   nei sfs2ua(r ;t1tpx  oeiasfmDuluvo;u4teenmoctotfmDr u i;t  2um(o3nu1am n ivilsfs2raumpoo0ope ioeiytla2umn onu4trermf3iotlat luvs;( srtrxrpiudap e ies ()aDraur ;o4opxnmi3iyt m2rmnmo;() etrxr tydlm r n i s)seuoxrpnodlme  neiat)aDtm(mpnt1aexnio3iytlm2rmn on(0 rtnxr todlmDeli ols0sexrxmpiy4lpeelfci (faDtr(  ;u1tlenioeiasla2rmu p;u)alenmo3todfpD au ols srtmirpoy1llt lnvs s  2rm(m no1tlxnmfcilt s rm(vsn()aexrxfciadlatrau ols0tetrir3iy4opte ics t) 2taum ou0aeto fetldlmDulumon(4trtomoctatopDrlivo (0texr(m iu1amt lnct ()arra(monu4apto f3iltfm um(vo;t4tetomr3tytoat luvo;t t2xm(r3nu1om e fei ( aDtaxr no1tpx mieiasfsDelnvp;t0teenmr3iydlpteai s;s)seurim3ou4apenlieiltfarrm( p;o4aeto oetltla2rmnvo;u4trtnxr3io1fmtelueslt trxo(mpoudole mfcilt  rrru pot1apt ifciysfs2emuvo;() lxrifcoodopteluvs s) 2trxr3io1aleemiet s) rurx  ot1oltoiociltla ulump u0 ltnifcoo1op e ivol(  rxm(o nu1al  lics ( a2rr(r oo4apxn ieiltlaDuauvo u)aeerif3todom eli o (0 exmxo ou4lmenlnesat aDrmx o;u4teeomo3iytla umnmpn() etrmr iy1lmt lu ol(0srtm(m iodlpen nesltfaruax  nt1apxn i3ildfsDel(mp (4 lxomfciodopD anes ( t2xmxr3no1ap elfvs t  2tau oou4tlenmoetydlaDemumonu)aeermf tatom e n o;s)t2tmxr nydolenlnvil( arur(  ;o4tlenmfetyt m2um( p (0 exomoctotfpDrau sls0texmxrpiodame lnetl(farrruro;u0oleomoeiysfs2rau s;t0 etoifcio1oaDelnei;s0seuo(r3ou4am e ivslt a2ra(monu1opx ioctltfm ulnmo u)tlxoxo3tytfatelueo s)texmim oo1ame mnetl( aDuax oot1aexomi3iyd s ea( p;(4 reoirciodopD anvo;()seum(opoy1llte nvsl( sDrrurp;o1ole  fciydfsDua(msn() reomfctydfp eliei;t  rtmiopiy4am e nvs (  2ta(moot1altoif3tlsfmDumn s;t)alxrxfciydopt ai o (0t2xmxr3io1lpeelicsl(f 2rm( onu1tptnmf3tysfm ra( o ()altomo3tatfp rlivo;s)trtmir iydol nmiet ( a2rmu  ;o0aee iicilt m eanms;(4tlermf iodfmDe uvs (0srum(m3ou4opeelnct s  2tru  oo1aexn ociltlaDrluvo t0artoio ta1lmDe nvo;t)setoir nydlltelnctat  rtaxm ;t4aex ii3iadfsDul(vs;() renxf ia1lm rli slt teum(r oy1amen icia()s2rmxr nu0tleomfciad m2emuvsn()aetoio iy1lmt  uvsl( tetmim3iudlpee nctlsf rtrxr ou4tpxoif3iltfaDem(vo;u4 lenmo tadfmDraneo;s s2trxm oo1alte ivtl(f rrmxr oo4tlenmfeiys m2ulnvp;(0trenmo oadfm  ln i;t trur(o3iodlpe lnvt t  rumurp;u0olen ocilsfm ul( pnu)altnmr3ootoaDrli o s0 2xmiopny4lpe  iet ()a2rr(mpou1opt iictltfm emn ont4 rxrxf ta1fp  aues;t srtrio iydlpte fcsat)a2rauronu4apen fciltls2rmnms;u0 rxoxr3totfa rauvi;s s2trxr3iydlptnliei ()a2ta(ro;o1oet iiciysfmDuauvont4 eenxrcoy1om e ivs t0trtoxr nodapt  ncslt)aDrm( pno4opxn ictytla elu o u4teeomr iotlptrau s;t0s2xrxo nu1lltnmfvil(fs2ur(r ;t0ape ifciysfs2umnms t)teenmo iatop  li sls0 rurirpnodlle liciasfs2taxmpnt1opx moetlt m2umnvp;u0tlxnxrcoa1fatranvo s0 rto(o3iu1apte ivsasfsrrmx ooo1tee  f3tysfa uln s u4aexomo tadfmDelu slt0teto(m3nudopeemivias)a2raxm ot4aetoiieiydfsDrmumpnt4aeerxf3iadfp  auvsls)s2tr(opiodlptnlfcs tf 2rmxrpoo0aeeomoetldlm2rmuvp u)teenxrciatom eanesls t2xmir3ou1oleemivt s a2tmx oot0oex  oetldfs elnmp t4 rtrir oodfaDeanvi;t)s2urio3io4apt mivsas a2tax  ;t1texoiociydfs rln p;t0trtoif ootfatr i o (0tetrxmpny1amtn nciat)a2uax o;t0tltomi3tldlsDrauvs;(0 ltrmr iydoatrln i ()texmiopny4lmeelivia(f rtru  ;t0olx  ociaslm emnvp u) eenmrcty1lptrlnvolt trtoimpoydalenlfvia()s2raump;u4open fetad sDrmnms;(0aeeoxf3oadlmDeanvs t0s2to(o3iodlp nlnvs sfsDtr( o;o4aetoiietyt m uaums;(4tlxomo3iatlp ean i;(0setrio3io1olt mfcsl()s2tm(mpoo0aee  feias mDemu onu4 lxrmrctydla rai s;s0s2uoir3iu4optelieslt) 2um(m ou4ole iieilt m ua(mo;t4alxomrcoytopDranvil(  euoxr3iy4lptnlnet ()arumx o;u1oetomfciaslmDeanmo;t4 exoxfctadlpt li il(0setmxm iy4ole lnctat) rur(ro;u1tptniicilsfmDraumo (0arenxf oy1lmteai il(0t2uoxopnu1ale  fei (  Drmx pnt1tlxnmocils sDra(vsnu) rtrmf oy1oat  u o t seuo(m3iudop e fetlt  2rmumono4tpenifciadfs elu p;(0 eermr3ia1lmteaivilt0 exm(o io4ll emnetl() rtm(  no0aet moctasfa2ulu snu4tlxnxo3totfaDeaivo;(  eurxmpou4lmeelneilt)sDumxmonu4oexo iciadls rm( pnt)tlenmocoy1optran s;( texoimpiu1ale mietl(  rrruro;t1oetoif3tlsfs ulu o t)tlxnio3oadfa  lnvi ()truo(o3ny4lp emncsat) 2rrxm oo1opx  fcildls2rlums;t4tetrxo3tydfa   uvo t texoim iudalt  fviatf 2urxroot0apt mocias a rauvp;() etnif3oatom r nei;s0tetoio no1amtn ivtatfarurxroot4oltnmfeiyt a emu ont0tlerxrctydoaDr u sls s2xoio3no4lmenmicsas)artaxr nt1tlxnmieiad a2em(vo u0aeeomoctadlpte ivolt trto(mpno4ll   ivias sDuaum ;o1teto iciasfa uanvs;t4teerir3iodomD aies t  2tmimpnu4al emnvtat a2urxm ;u0ale moctys a2uluvo t0altoiocoy1laD anvils t2xmxm no1am nmnvi s a2rr(mo;t4tleoif3iasfa2elnmp t)trtomr3ia1opt auvsl()srxoxo3iu4ol   fvsa()s2raxrp;t0ape if3iysfmDrluvp t)texrxo3todoa rai sl()srxrim3nu1op nlfvsas)aDrm(m no1tpt  fcilsls eluvs u0arxniocio1fa  lueo;(  exoirpio1lpe  ncslsfs2umxr oo4olt  i3tysls uluvsnt0trenxfcia1lmDr uvi s0 exmir3ou1llen fvslsfa2uaumo;o1olxnifetat sDeau s u) lxrmfcty1omtr nvil()seumxm3no1aleemnes t  2rrxmp;t4optniiciyd a rmu o;t4alenifciytomDeauvslt seurio3io4amen ics t) rrmumooo1tlenmo3iadls2el(vo;u4tetoifciotoa  lu i ( teuoio nu4am  liei s srur(  ot4altoioeiydfmDrm( o;t)trxnxrctotfaD auvils seum(rpiu4lptnmfvt s sDumxm no1openio3iydfm uaumsnt4aexrxf3iadlaDeanvi;s)s2uo(m3iy4ome micsls) Dtr(  no0oet  fciytfa ulu s t)aeenxrcoatoptrlivs (  2urxopoodomtn fetatfa2uax  ;u4altn o3ias s2rmnmonu)arxrmr3ta1oaD lu o s0srtm(rpiy4ll emivtas  Dtru p;u4opx ifciltla um( s;u)aeenio iodlm   ieilt)s2urxo3iu1oltnmfci ()a2ur(rpnt4alxn octls m2ea(ms u0 leoir3oa1lmDeln s t teumxopiy4lpeemietltfaDtm(m ;o4opt  o3ild a2rm(vo u4 reoxo3tatfptelnvi ()sruoxr oy4ame mivslsfsrtrxm no0opeoioeiydls2uan p t)artrir3io1fmt  i i () 2xm(o3iy1lmt lics tfa2trumonu0olxoioctldfm rmnvo;u)tetrmr3tytlmDeluvols)texmxopoy1am elfvtl(fsDtmu p;u4oltnmiciydfs eanvo t0texnifctotomDr nvslt0s2xrimpoo1lpe mfcslt)s2rru  ou1aleoiociysfsDeanvsnu) rtrioctotlpt  ieslt0 exo(r3iu4ope  nvs s  rtaumpnu0aleomo3iltfs2emnmp;(0alxoir iatomDranvi;t)tetrirpou1am  licia()a2uauroou0teenifetadls el(vo u0trtniociotoat  i sl()t2uoxr oydop emnetas)arum( onu0tpxo f3iatfaDel(vsnt) ltrxo iadop  au ils0sexo(o nodalte nvi s)a2urxm ;t1tlxniiciadfaDranmo;t) exnir todlm  luesls)srxm(rpnudllenlneil()artm(rono4tlx moeiat a rl( pnu4aeeriocoa1omDrlivslt0 2uoirpiu1lmee ncsls  ruru  ot1teenmo3iytfaDul(vo;u)arxnmf3ty1laDr n o s) etoxo3ou4llenlfeslt) rrm(  ou1teeo f3tlslsDel(mpnu)tlenmf ootopDraueo () 2xo(r ny1llt mfvsls)sDrr( oou0apxnmfciadlm rl(vp;u4tetrxocty1fmD  uvo t0s2xmxm iudaltnmiesat)s2uru pou0apxn iciltfa2emnmp t) lxniocoo1fp r nesl( srur(o io1lm  livils)s2tr(rono1teen octat a2rmu snu4 lxoxr3iatomDe i i;t0tetrim3iu4apeelfcsas arua( pnu1alxo feiasls2rm( s t4texnmr3iytfa e u o ( trtmxopno1omtnmietas sDum( p;o1tlxomfeias s2uauvs;t)teenxfcio1oa eli ilt0sexr(o3oudal  lfeilt) rtmump;t0alen fetasfaDra(vo t4 exrxrcoatfpte ieolt t2trxm no1lp nmnvsltfsrrm(ro;t0teto fetldlaDrlnmsnu)trxomr totfaDrlnei ( truoxm iy1lpe  nvsat sDuax  ;t0optoifciatfs rauvs t0arxoif3totfmt aieo;s t2trxo oydlp nmfesls)arta(ronu0apxn ietydls2ulnmp;(4trxrif3oydfpD  n o;t0 rtriopoy4oltnlnvsas  rrrxr oo1olen icilt s ulu sn(0 rxrxrcia1op  luvs;s)texo(r3iu4amtnmncslt  2rmx pou1alxnmiciatfm emu s u4 exoxrcootfaDeluvol()trtoimpiu1amtnmict (f 2tmuro;u0olt  i3ildfm ranvs t4 eenmo iodomtran i s  2trxr oo4lp nmnvsls) 2urxr ;t4olto ociaslsDelnvp (4trerio oo1omD  neo s tetoxm ou1olt  iet tfa2rrxmoot4opx  fciytla2eln snu) lxrxo oodfaDe i sls srxmxrpiudomt lfciltfa2ua(m nt1apx  iciad mDelu snt4 rxrmrciy1op e n il() rtmxrpio1ol e nei t)aruru o;t4olxn feiltls2rl( pnt0arxoxfctotomt livo;t0srtrxo3ou1lmt  ictlt sDum( p;u1aptnif3ildfsDemu o u0alxrxocoa1omteli o;t)s2triopoo4optemfeia( sDrrxm nu1oexn ieiad s rau s u)tlxrio tatom e n s s)sexrir oydll  lfcta(fsDta(ro;u0aet iieiad a uanvp t4tlxrir3oatlatrln s t)s2urxm iydopte fvia(fsruaumpnu1oltn ieilsfsDrl(vo;t4treoir3iy1op ran o;()s2xr(o3nudlp emiviatfaDuru  no4opxomoeilt aDean o u0trxnio3iydlmDraneils t2um(mpoo1amen fetl(fsrrr(rooo1apen octasfm uan s;u0tleoifcia1fp ran o t0tetmxopiydale lnvsls  2tmurpoo0oexoii3ilsfs2rlump ()alxrif oadlpDrlnei s0t2ur(rpou1ame lnvslt a2ua( p;t0olxn o3iysfs eau pnu)altoxo3totla ranvslt)teur(rpnudopte ieils  rraum ot1oeeo f3tytfa2ul(vs;u0 ltnmrctodfmDrauvo;s)sexo(opio4oltelfciasf Drm(  nt1aex iictysla rlumo;t0aleoxf3oydlmD ln s;(0teto(m3iydaptn fctlt aDum( p;u1alx  fetat sDranvsn() etnxr oo1lptr u sl( teuoir3oo4apt lnvsls s2ua(  ot0oex ioeias mDel(vp t0 exrxociytop  lneol( t2um(rpoy4am emivil( arra(m no1tlxo f3iatfaDranmont0 lxoio oy1latean i;( texo(r oy1aptn nci (faDtru  ;t1tlt  fciytfa eaums;u)artnxfciydfmt li s s0srxoxm3io4olenlncsa(  Drrxr ;t1oltnmf3tlsla elump t0aleoxf iy1lmtean ils) ruoim nydalte neils sDra(mpno0oltnii3iyd a2rmnvo;t)texrmr3iotfaDeai i s) rxrxo3oo1lptemfctatf Dta(mpno1ope moeiysfa2eanvs;t0aexoif3ia1lpte uvs () rxmir oy4lmeelnvt s  Dtm( p;t1opx  ocild mDrlnvo;u0 reoio3iotop r uvi t0 2xrxm oudllee nvsa(fsrtr(r ;u4tltnmfctat aDel( pnt0 exomf ootopteaivo t0 rumio3oy1lltelivsl(farraxr nu4apx  ociyd s2emnvo t4 etrio3todoa r uvi;( trxmxrpoo1op nmivtl( sDrm(r no1apeoiieiasfmDemu o;u) reoir totfpDeaivol()trtrxr no4lmeemfvi t) rumx p;o1tpx mietadla el(vs u)texrif3iatlp  ln i;s trxmio no1ape  nvsasfsrtaxrp;u4tle miciyslmDulu sn(0 renmrcoytom   n sls)teumim nodlle  neiat)srtmx pnt1oexn f3iydfs rlu s;u4 lxnmo3tytoa   ieil(0 2xrxr nu1lmeemivtls)artau  ot4optniiciat m ran o (4 eenmrciy1fm elivils)trxrxr3nu4lme lies s) 2rrxm nu4olxomi3iyt s uanvs;t0 e
\ No newline at end of file
@@ -0,0 +1 @@
+u i t) 2xoir no1lp nlnctas aDua(ro;o1texn f3iysla2ra( pnt)arxoir3tytlpDr nei;t)texrxrpiy1aleemnci t aDtrx p;t1oex mociatls2uln o u)trtnifcoa1fptelu sls  rtoxopno4llee fviatf rur(mo;u4texomieiysfmDua(vs;t)trtnxr3oadfaDr i s (  rtoxo3oo1lmenmivtas a2raump;u4oetomfetysfsDrmu s;u)teenmr oydomt ai s;t s2toxopoudal eliesa( srumumoou4oetoii3tltlmDul( pnt4texnmr3todfmtr nvols)trtm(m ou1ol n fcs tfaDtrxro;t4oexniietadfsDrl(vont0 lerir oydfa  au s;t seuoxmpno4al n ictat s2umumpou4apxo o3tls m rau s (4 exrxrcoatfpDeluvsls)teumxm3iu4lmeelfesl( sDuaurpou0ope ioeiatls emuvs;()aexomfcoodfp rln sl(0seurimpno1opt lfvi ()arrrurp;o1aex if3iys a2umnmpnu)teenmf3iydfmte u i;s0trurxo iu4al nlfetlt) rra( ono0oeto ieiyslsDemn o;u)aeenxocoatlaDelnvi s) 2xoxrpny4oltn netas  2ua(r ot0teen fctydfm2uanvpnt0 rxnmo3io1fp raneilt0setrxr iy4om  mnvi s  rrrum ;t4ape mf3ildfa uau p u0treoxf3oo1omt luvi (0texrxo oydape lnet s sDraxmo;o1aleo ociytfm ulnms;u0tlxnxf tytfpD livil(0s2xmim io1omeelnciat) Dtmxro;u4tlxn iciasls rm( p t0altnxoctotlatrauvsl( srxmxo oy1lm  mnvi ()arrmum ou1tpx  iciadla ulumo (0altrmfcia1lpt  neils0t2xmxo3iydalt  nvsl(fsDtm(ro;u4tee iieildfmDrlums () rxrxrcio1fmtr u olt)sexrxm iu4omtnmnet s aDtrur oo0tex ifctlt m ra( snt4teeomfciy1fat ai s;s  exmimpio4lmtnmnetl()aDtrump;o1opxn i3iydfaDuan s () rxrxf tadla ranvi;t)s2toxo3iydlpe mnci (  Drrxr oo1aleoifetltlaDem( s;u)artrir ty1latrlnvolt0sexoiopio4omtelieias a2ur( o;u4ape  i3taslaDrluvp;t0trxrxr3iytlpDeaivs;t t2umxo3io4apt  nvi (f 2rr( oot4openioeiyt m rauvsnu)alxoxf3iy1lp rauvs;s)s2urxo iydlpen fctlt arrrur nt4oeeoioctlslsDrmnvp;u0 lxnxocootfpDe uvs;()t2urxo3ny4apee ivt t)s2rruro;u1aetn octltfaDumnmsnt0alerio3iatlp r nvsls seuo(o oo1ll emnetas  Duaumpou0aex io3tatlm ea(mpn(4 lenif iotla r nvils)srxmxr3oydap  livtltfarum( o;o0oeto o3ils mDulu onu)tltrxo oadlaDeluvs ( s2tm(o oy4am  mietlsf ruaxro;t4tpenmieilsfa elu on()artnif oodfptelueilt)tetrxmpio4lpee netlsf 2ua(  no1optnmociytlsDum( s;u0trtrmociy1la rli s s)t2xo(o oy4aleemiesasfarur(r oo1alenif3tysls eauvp;t4 etoircoadfpteau o t) etm(r3nu4om emictasfaDtr(  nu0oltomoctatfaDumuvp (4teeoir3tydfpDeli ils setm(m iu4lme  ivils) Dum(r ;u0oetoifciys aDrl(mp;t4artrir oytlaDeaivsl(  2toimpiu4am   ncil()aDur( o;o4oleomfctyt m2rm(mont)altnxo oodlmDr iei;s0texrxo ou4lmenlfct t s2tm(ront0alen octatlm ran pnt) leoxrcoadfa  auvs;t0srtrxmpnodop nlietat aDurx  nt1tpxn oeiadls emnmo (0 exnir oo1fmtelivolt)s2xmim3oo1lpenlivilsf Durxr ;o0aex mi3tadfaDeanvs ()tlxnxrciytomt lueil(0t2uoxo3iy1al nmnvsls  rtru p;o1oltnmfetasls2em( p t4areoxf tatopDelieilt) etrio oodlltnliesas  Dtru ono4tltomfciltlm ulnvpnt0artoif tytlpD aivi s tetmxm nu1llee iei (f 2ta(  ot4oexomi3iadlsDrlumpnu0tlxrifciydlmt  nvslt)truo(rpnu4altnlfct () Draxmpno0openioeildfsDumu s;()tleoxf3tydoa   ivo;t s2uoirpnu4lle  nvsls) Dtrxm oo1apeo f3iltlm uluvpnu0aeeoirctatlate ivi t0t2toxr3oo1ape micslt  Dta(  ou4optomi3iatlmDeaumon(0tetoxrcoatlpDrlnvo;s t2xrxm nu4om  mivi sf 2urxr ;t4tex mi3iydlm rlnvp;u)alxomr iydop  au s;s) 2umxo3oy1lltemnvtls aDrm(mont1tpeoif3iyslsDrlumonu4teenxr ia1opt an il( t2xmir nodamtemietatf 2tr( ont4tlt iictld a2emnmo;u0 ltomo iotopD  n il()tetrxm io4ol  livt s) Dtmx  no0tltnmiciytfs2rauvp;(4tlxrxo iytoatraies;() ruoxmpiy4lm emnet sfartr(roou1aetomocilsfsDuaump ()tlenxf oy1fmtrliei;() exoiopoydop  mivi t) Duax pnt0aleniietltfm2rmums u0aeenxo3oodomDe i i;s0 ruo(r3ny1ll nlnctatf Duru o;t0aleo oetadfa rmums;u) leoif ia1fpt aivo ( texo(o3no4amtn fetas)aDur(rpnt0tlt mfciatfmDua( o;t0trtoxo3iatlaDeai i;s0 rtoxo iy4am  mncsa(f Drau onu1alen fciat mDum( s (0 rxrmocty1omDelueo;s s2trio3ny4aptelfcs t)a2tmu p;u4olxnifetltfs ran pnt)trxrmo3oadfp eaneo;t0sexmiopnu1llee feiatf rtaxrp;o1oleoiietas s2eaumsnu4 lenmr oy1fmteli sl() 2tr(rpoy1apt mfvtl(  rurum ou0oex mieiytfs emump;(0 rtrmo3oo1fpD ln il( seurxm3nu1op elfvtas sDumx  ou0oet  f3ild mDea(vo;t4 ltomocootlaDelieol(  eto(rpoodalt mfet t) Durxmpno1apt  o3ilsfs2ua(msnu)aexnxf totlatr nvs (  rxrxmpiu1am   fcsa( a2rm(ro;t0alenifcilsfm2ul(vp t)treomf iodfaD  i s (0texmxmpnodlm elnvsa(fsrurxro;t1tpx  ictadfs2elump u4 lenxf ia1lmt lnvs t0texm(r ou4ol n nvi ()aDtmur nu0oexnioeiyd aDrl(mp u)tltrir oo1optr nvs;s0 ruo(m3io1lp elfvtlt) Dtm(mpou0ape moctadlsDrl( o t)artoifciytoaDeau ils srum(o no4lptnlneil()a2ta(  ot4tpeo ietadlaDumu o t)aleoxrciadlp raueo t srxmxopno4om  lnci t)sruru pou1aexnio3tadlm2ea( p;t)trtoirctatfmtr i i;s) rxmiopoudole lnci () 2um(rpot4apx  ociatlm2umu onu4tlxrmo3iotfp e ieol( teumiopiodomenmncsl()a2urxmpou4teeoii3ildlmDrauvo ()tetrifcoy1om  lnvs ( teumxmpnu4ll nlfesat) Drmurpno1tlxomfcildfs2elnmont)teenxr tatomtelu s;(0teur(m nu4ap  lfeta()aDrru pot4aexnmo3iasfs ean pn(4 lxnmrcootlmt  nvi (0t2ur(m3nu4lpen fcsl( aDra(  oo1opeo ocild mDumnmonu0aeerxoctodlmt aneols)tetm(o3iu4lp elfvilsf rua( pno4tleomociad a2ran s (0tltrmocto1om eai o t t2urim3oudap e icsls)artmx pou4texoioetad a el(vs (4trermfctotoaD aneil( seuoio nudom   net (fartrxmpot1aex moeilt a2eanmo;(4 ltnif3iotlaD aiei;s0t2xmim3nu1olt  ncs t  Dta( o;o1alt  icias s2rluvo u)altnif3oodfa e u s;s)srxm(o3oy4lp  lfci tfsDrru pou0texnioeiys a2rlumon() renxr3oy1laDraneols0 2trirpoo1optemnvtatfs2ur(rpot0tptoio3ilt m2uanmp t)trenxr3tydoa e iesls)srtoir3nu1lpenlneslsfs2umum no1tltnii3tydls em( sn()aetnmfctodopDeauvs s) 2uriopou1omeemfctl(f rrau pot0tee moeiysls ua(vsnt0tlxnmr ty1opDrlies s s2umio3ou1lleemneils artrxrp;u4aex iieias a2rl(ms;()aetrmo3todlp   uvils)trxrio nudlpeelneslt) rrmum nt0tex if3tysfs eauvsnt) rtrmrctytla r n ols  2ur(mpno1lmtnmfvi s aDumurp;o0aee mfcilsfs emn s;()tltoio oydfat auvi s0 rtm(rpio1lp nmictas srrm(monu4aet moeildlm2eluvs;t4 lxoxr3ootopDe n i s) rtr(m iy4lme  iesa(fa2ua(mpot1tlxnmoeildla2umnvp;(0arxoio3oytlp eauvo t0 rtrxr3nodllte ici s) rurx ono0apen ieiasfs2rmn p u0trtnmf todlateli i;t) exoxm iu1omt  nctasf rtrx pou1optniictadfm2em( snu0 rtoxocta1lateaueo ( t2trim3io4llenmivtatfs2uau poo4apx ifetatfs2ranvs u)arxnio iotlaD luei;t0s2xoirpnodlp elietltfaDrmxro;t1optoio3tyd mDulu s t0alermo3oo1fat auvols) 2uoio oydalt lncilt  Dtru onu1tpe  feiltfs2umu o u)arermf3oa1la raueils trxoxo iudoptelici t)srurx  nt1tlx  f3tyd m2umu sn(4alenxfcoodfp  livs (  exr(r3iy4lpeelfes tfsrrrumoot4texo ictls mDeauvo;u)aetnmr oa1lpDrlnei t srum(o3no4ap n nci tf rtaurpoo1apeo f3ilsfmDuau p u0 rxnxf3oydlm e ivo;s) 2uriopoo4ap e ivt tfa2rrxm oo1oet io3tatlaDulu s u4 eeoxf to1opte ivols teurim3nu1op  lnesas)s2tauro;t0opx ifcild m umnvp u4 rxrxo3tydfm eanvol(0trum(r iu4amee iesatfsDrrxr nu4tlxnmoctlt mDraums;t0 exrmf3tydfmD aneo s  exr(o3nydlmtemfctlt)s2ur(rpnu0altniocilsls ra( pn(4texrif3ty1oatr i olt t2uoim nodlp  lnvtlsfa2rm(mp;o1optomf3ilsls uau sn(4 eerio iatlm rlies;( seurxrpiu4amen ivs t)srrau ont0tpto o3iys a2el( p;t0 rtoiocoo1omte u ol() 2xmxm3iydop nlfes s) rrrumonu4olxomiciysfa2rau p u)aexrmoctodom rln i;t srxm(rpno4alenmicsa( sDuau o;t0olt ifctas s el( p;t4 lxomf iadfptraiei;()texr(opnu4om e nvil()srtr(moou1tetoifctasla rau p (0trtrmf oatoat lieol( t2xoxm3iu1lpe mfvsat  rum(root4tpx  icias sDumump;u0 leoxoctytfmDe ieolt) eurio3oodapeemfvs s)aDuru oou1oetomfctydfsDua( onu4 lxrir3tadfatranvol(  rum(m iu4al   nvt s)a2trur nu0oltnmictadla2rmump;(0aexoxr ta1fpD  u o;(0 2xmio oy1op e feiatfa2uaur nt1olxnmi3ilsla2um(vo (4 exrif ia1omDraies s  etoxr3io1ole lies (  rrmxmono0tlxomiciat m2ua(vs;u)teeoif3oadla raivilt)seto(o oo4ameemivsa(fs2rrumooo0olxoioeiysla2eaums;u)tltoio totlate uvi;t0s2triopoo1altnlnct (faDtrumpou1oexn feiatlaDean o;(0tlerif tytopDe iei (0t2toxr3iy4ol nlnesas aDraumo;u4aee mietldlsDemuvpnt4 lxrmrcta1fp eauvsls  2umxr3oy4apeemfcil(f rrmu  ;o4apeo o3iadlsDel(vsnu4teerir3oy1fmDr ueo;( srtmxopiy4optemnvi ( arurx pno1ale ioctltfsDemump;t4areoif3oy1fmDe ivo t srtrxmpno1oltelivs s)srtrumpot4apt mi3tadfaDea(mp u4tltnxocoy1lpteaueil( texrirpoy1optemfeiat) rrm(r nu1olxniictydlm rmnvp u4trenifciydoa eaiei t0teuo(m3oy4lptnlieslt)artaxront0apx iictydlaDel(ms;u4 eeoio3tytla r u olt  2toxm iy4al emfei ()s2tau ono0apx mfcildlmDumuvonu0 etnxo3totopt liei;s0 2to(r3nydlpeemicta(f 2ururonu0aetniicildfm2rmnmp;() exoxo3ootfmt aueslt) 2xriopiu4amtemfct s)srrr(mont1apxn octltls rau o t4areoifciotlaDr ueol( seurxm iydamt mfcta(fartmumo;o4apxn f3iysfsDumu p u0 ltnmo oa1om r ueo s0 rxoir nydll   fvi (f Duaxr oo4texomo3iat aDel(vo;t4alxrmrcoydfm  livi ( seur(mpio1ale mnetlsf 2umxro;o4olxomociadlaDrln o;(4tlxomrctodop eanei t sexoxo3oy4ol nmfvta(  rrrumono1aet ioctldfa rl(vsnu)artomo3iotlmDr iei t s2tm(opiodalenmnet ()aDrr(mpno4alt iiciltla eau o;u0areoxocoytfpDraues s tetrxo3oudaleemnes tfa2umu pnu0openiietldlaDranms;u4tlxnirctydomteanvo s  etmxr iu4lmenmfvt s)aDra(  ou1teeo ictysfa2umump (0 lxnxocoo1lptr uvs;t)s2xo(mpio1ope licta(  Dum(rooo4alenmfciytls ulnmo t4 rxomf iodlptr iei;()teur(m ny4ap   ict s)arur( ont0oleomf3ilslm eau pnu)altniocoytopDraieo;s t2xmio io4alee nvtas) 2uaxm ;t0aexnmi3ils a eanmp;(0arxomo3iadlmt  neo ( trxrim3oy1oltnmietlsf Durxmont0aetoiietadlaDemnvpnt4trxrmf io1fa r n o t0trurxopnu4lp n ivil(fs2ta(ro;t1aleomictat m eaumo u0tetoxf to1oatrluvols) rto(m3oydll  mnesls)arrr(  ;o4aetomo3iysfmDrlnmsnu0areoxf io1omDrlivi ( srum(m3oo4opeelivil()artmumo;o1apx  o3tlsfs el( s t0 lenif tadopD aueilt)trxrxm3nydlm e iei s a2trurpnu0tee mf3ias s2rmnvo;(4texnmocoo1faDe ueo ()trxmim3no4apt mncilsfsDtmx  nt1oet  o3iytfa2eauvo;u4tlxrif oydoat au ol(0setoio3iydameelfctlt  rrmumpot1aet mocias a2elnvp;u0teenio3tadoaDe i ils texoir3oy1omt mies sfaDrm( p;o1oltnmiciys m2el(vo u4areoir3todlp rln olt0trtoimpiy4lleelnes ()srtm(ro;u4olt  ocilslm ul(vp;u)altnxr3ty1fateauvo t)trxrxr3nu1lptelneta(fs2rax pou1oexoioeiadlsDulnmon(4trtoio oodfp rluvslt0 rtm(o no1omt  icils)srrax pou0tpe ioctydlsDrluvo u)tetoxf iotla  lieolt t2tmxmpoo4al nmivils sDtaxmpnu1oeenio3iad sDeau snu) exrmo3iytom eanvi;s0 etoim no4ap  lfvt s sDtruro;o4alxomfeiydls2ulnvp (4aexomo3oa1om e ivs t t2tmio3ou4lmtnlnei sf 2uau onu0tptn iciadlaDrl( s t)treomr ootomtelivsls  eur(mpnu1apt  ncias)s2raurpou1oeenifciytfaDea( pnu0tltnxo3tydlm raies t0trtmim3ny1ope lfvtat) rurxmpnt4alto o3tadfm2rm( s;(0arenmo3oatfpte u o;s0teuo(r3ny1aptemncia()a2rm(mont0alt mociyt sDrlnmpnu4arenmr oadoa r neslt  exr(r3iu4am   nesls)a2tmxmp;o4aptn icilt s2rl( ont)tetrifcta1fmt aivilt0srtr(o oudol nmncil() rraump;o0apxoif3iad aDeluvo u4 renircoo1fa e neo s s2trim3io4ame  ivtl(fs2trx oot0aetn oeildfm2ra( o t)alenxf oa1omD  u ols  rxrxrpnydop   nciasfa2tr( poo0tpeoio3iltlaDrlnvs u0teenxfcoadfmteli ols  eumir oy1apt  fvt (fs2trx o;o1tpen ociysla ra(mp (4artrxrciadlp eauvi;t0t2xoxopoo1apenmietlsf 2rmum ;o4tpxniieiltlmDulump;t0trenxrcoodlaD  u s;(  rxrim3nu4omt lfeia( artrxrp;o0optoif3tas a umnms (0 exrifcta1lm rauvi;t srurxo io1olee fcsls)srrr(m nu0aetoifetasls rm(ms u0 lxomfcto1opDrlu o () etmxm nydlmtnmicsl() 2ur(rpou4alenmo3tltls2ean s t0 ltrxr3oadfmte n ol(0trumir no1ll   ivt t)srururp;t4tlx mictltls2em( o;t)artnircoy1lm eaieol(0 etm(mpny4lptn nvt ()sDrmum nt0opxnmieilsfs ul(vsnu4altoxo tadfaD  nvs (  rur(opnu1opt  nesl(f Dtrx o;u4tlxomi3tatlaDrauvs t0 eeoxrcto1op   neolt)trur(o3nudalt mics s) Dtm(rp;u0ope iiciadlmDumn o (4tetnmrcoy1opte nvsls)trtr(mpiudape lieia(  2ua(r ;u4opeoif3iytfa rlnvp ()trtomf3io1fpD ai o;t0trurir ny4ol  livil(faDrmxr ;o4tlenii3ildfs rauvpnt)tetrifciy1lmDeanvols srtr(mpiu1lpen ivi t  2trx oou0aetomiciydfs2rl(mp;u)aetnxf oy1lm rau ol( trxr(mpno1amtn feias artrxmoou0oet mictlt sDrmums (4 rxrio ootlpt  neilt)trtoxrpiu1oltnliet sf Dumxm no1oeenifeiatla2ulump;t)trxrmr3iatoate ues;t) eumxmpiudom n feil( sDrr(r oo1openiietyslmDemuvs;(0 lenir3ty1oaD lnvilt s2toxrpoo1om  mnei (f 2rm(m ou1tpeo ieiatfsDrm(mp t0 rerirctydlm r ues;s  rtm(m ou1al emivtlt aDum(ronu4tpt  ocilt aDul(mo;(4teermoctotfateauvil()tetrxr3iy1ol   ieia() Drrumpnu1openmociadfs2rm(mo t4 rxnxf oadlmtr n sl( trtm(mpou1ape mictls  2rmx ooo1tpe  ictldlaDra(vp;u0aexomo3oa1fptranvsls0 etoio oudlp  lneia()a2ta(moou0aetnifctysfsDel(vp t0trtnmr3ta1oa r iei;t  eumxm oudapenliviasfsrrmxm nu4altomoeiltls elums u4arxomfctotfatean ols  eur(opiy4om nmicsl( srtru o;u4ole moetadfsDel(vsn(4tetrmrcio1laD ln o;(0trtmim nydlp emivs ( sDrrxm ;o1tlxomiciatla2umumonu4aeeoio3iatom rluvols0teum(m iu4lmeelfcs ()a2tmx pnt4aptnii3tydfs2rm( sn()tltnif3oy1optean ol( teuoim oudlmen ieias  2taurpno4aetomieildls um(vsn(0tlxoxo3tatlpD liei s0trxmiopio1om  mnetatfsrtmur ou4alenmfeiysfa ranmpnt4aexrmr3tydlmteluvsls0texmim3no1amt lnvt ( s2rrxmpnu0oet  ictadlaDel( p;u) rtomr iodoatr ieol(0seto(o3nu1ap e fct (  Dtau  ot1apt ioeiaslm2ra( s t)artoio ia1fat  uvs s0 2tmiopiu1lmt  fci s)srra(r oo1oex iociysls eauvonu) exnioctydfpt  ieo s)s2umio nydalte ncs t)sDum(mpno4apt  o3ildlmDemu p;(0arxomr ootoa e ueo;s)trumimpiu4lpe mnvsas)a2tau p;t4oltoiocild a2eau ont) ltomo oadfa e nei t0setm(o3no4lpenmfetlt) 2umumpno0ale  feiysfmDemuvo;u0 etrifctytfa  liei (  eumio3io1op  lnvtlt sDtmu p;u0opx iictlsfm rlu s u4 rxoio3oodlaDelies s) 2umir ny1lmt lnvta()sDrax  ;o1tlxn ictat a ra( s;(0aetnif iotop r nvo ( texo(o nudal  lnes t  rua(r ou1tlx iieiadfmDuanms (4arxrxo ty1lmtrlieols)teto(m ny4lltn icsl(fa2urur ou0ole  ictld sDra(vonu)trenxo iatfaD livi s  exm(r nudapenlieils s2rax poo4opxo i3tadlsDua( s;u0 ltnio oydfpteln i t)s2umxm3oo4ol emfet t sDua(r ot1oltomiciad s2ul(vsn(0treoxrcoytfpteaivilt0 euo(opnodameelivt s  2ur(mo;u0ole  ociydlm2uluvs (4 lxnxrcio1laD li o t)teumxr nu4lpte fciatf rrmxrpou0tptnmo3ildla2rluvpn(4 etnmocia1lateaies;s  2xo(opiodome lnesa(  rtr(m ;u1oeen fciadla2rl( p;u0altoxf iytfaDr ues;t) rurio iydap e icilt) Dtmxro;o1aet mo3tysfa2eau sn(0treoxr iy1lm   uei;(0s2xoxo iudll nlieta()a2umurpot4oetnmfeiysls ul( pnu)arxrif3iotfpDrau o (  2toiopny4lpt licil(faDtaxmpno4olxnmictltlmDemu p;u)areoxf3tatfm rau ilt) 2urxr iodaptnlfet (fsrrru o;u1aet ifeiytfa rl( on(0aleomo oa1latrai ils)t2xmxopio4lltemnvtlsfsDrru  nt4aptoif3ilslaDel(vp;t0tltoio3tytfmD lies (0 ruo(o oydomte ivt s s2taxmpnt0aeeomf3iltfsDrl(msnt)trtoircoodlp r nvi;t)tetmxrpiu1lpe mnvsl() rtrx  nu1oexnmocild s raumon(0trxnif ta1oatrlnei ( seuoxm iy1omee iciltfsrraurpoo0ape iiciatlm emuvsn(0 lxoir3ty1fmtraieilt)texrxm iy1om nliesls) Dtau pnu1optnifetlt a elu p (4 exnmrcootfat  ivo s0seuoim3oy4opt mnesas  rrm(mo;o1aeeo fctad a2eluvs (0tltrxrcoytlm   uvo;s)s2um(o oo1olenlnvi sfa2rm(  nu0tetn oeilsfmDeanvsn(0texnxo3oatfmD  i il() 2xm(o3oudomt  net sf 2taur oo1oeto ieiad aDulumpnt) rxnir tatlmt luvi;( sexm(m3oudol  mnctls) 2rr( ono0tee  f3tyslm ranvs () lxnifciytoaDraneo;t0sruoio3oy4om  miei () Drrxront4oet if3ils mDemu p u)teeomr3ty1fa eai s t  rxoim iu1aptemivi t srururono0tex mictadfs ul(mpn(0 exnmo oodfm  lnes s0 2ur(opoy4openlfvtltf Dtmumont1aetnii3tatfaDrm( s;(0aeenifctydopDeau s;t t2uoxopnu4ol  lies t)s2umxmoot0ape  icildlsDemuvs t4artnmo iy1oa e nei t0trtrimpiodam nmfcsas)srtmum nu1tpxnmietydfa2umump t4altoioctydfm eluvslt t2to(rpnu1lmtelfeilt)a2rax p;o1aetomfcildls rmn p;() eeoxfcoodfm e neil(  2xo(rpnudlm  mneslsfaDtmurono1opxn ieiasfa2el( snu)texniocoodfpD anesls  eurxo3ny1ameemfvsa(fsDuaur ot4ope  icild s2ra( p t4texoxocia1fa  ai s;s srtmxo3oodllt micsasfs2tmurpot4aptomi3ilsfsDrmuvo t0teerif3iadoa raiei;t0t2trio3oy1ape  fctat)aDrau oou0texoii3ils s emuvo u0 eenifcia1op ranvsl()s2xm(m3iudopen icias)a2ta(r ;u0oeeo fctysla2eauvon(4tleoir iotoatr ivs;t srxr(r iydame  nvias)arum( p;o4oeeo feilt s2emuvpn(4aeerir tydlmtelu o (  2tmxmpiy1op e ictlt) 2umu oou1texnio3iadfaDelnvs t4alxnir to1fm eauvs;( setm(r no1llte fesatfsrta(r ;u4opeo fciasls2raums (4arxomocoo1lpDeauei t teuoxrpiydopen nvsltfarta(rp;u0apto fetys m2uau pnt4 lxnifciotopDrln o () etm(m3iu4op nmncilt aDrmx p;t4texoioeiytfs eau s u4trermocio1oaDean o;t  etoxo iu1optn fes s aDtau  ;t0tlxn ieiad s um( sn()arxnxocia1lptelivi () rtr(rpno4lpeelncsas arrm( ooo1aetnio3tysfaDua(vsnu4 rtoxf totop ran o;()srtrirpio1ap emfesas sDtaumono4oexomo3tasfa2ul(vs;(4 etnmr3to1latrlneo;t) 2urio io1apeemfct (f Dtr(mo;u4tpe moetltfmDeau snu4 lenmo3ty1lmtrln i;() etr(o no1lm  mictls)aDtm(rp;u0tle  octadfmDeanmo;(4 lxnmo iydfm eliei;s)sexoirpiu1olen net ()arum( p;u1tlx  oeiytla elnvp;t4texrxr3oodopDr ueo (0t2trio ny4ap  micil()arraumpnu0olxnmociad m elums;t0aetnircoydlmDelnes t0 exr(m iy4om e nesas)srtrxrp;u0tet  f3iltfmDea(mpnu)tetomrcoa1oa eaueo () 2umir iy1omtelncs ( s2tr(r ;u4texn fciadfsDrm(mont) rerif iotoa raieo;t) euoirpoydlmte nci ( aDuau  ou0tetn i3iyd m2ulums (4artnmo3oytfmtrli o s  2ur(m iu4aptelicia()srurxr ot0ale ii3iadlaDea(vpnu4 eeriocta1fpt anei ( truoimpiy4amtnlnesls  Drau o;o4opx  ociadlsDemn s;u4trtnxf3iy1oa elues;t0 rumir3oo4olen ivsa()sDumuro;u4apeo ietaslm2el(mo;(4 rtrxf tadlmtr i s (0 2ur(r nudlpe  feias aDraxroou0tptnii3tasfsDra(vpnt4aexoxocia1opD aivils trto(o3ou4am elnvsl(faDurxmo;t1alenmfeiydfa2umumo;()tlxomr ia1oatr uvi;t) etmio iydope mfeiasf Dur(mpno4aeeo i3iysfm rlnmp u0teeomr3totfptrln o s)tetrio3nu4ape mfvta(f rurxroou0alxn oeiat a rm(mp t)artnmo3oo1fp eli i;(0trtmio ou1opte ici t  Dtr( poo4alt  o3iltlm rm(vs () etrxf iotfm eluei;s0srum(rpoy4ol nlfciat arrmumpou1aeen ieilslmDea(vsnt)artnif3iotoptrlivo;t0trxrxm3ou4ap  mieilsfa2ua( p;o4texnioetadla2ranmsnt4trenmf tydopD ai o (0 rxrio oodomtnlfvt tf Duru  nt1ale mfciasfsDeauvsnt0tetrxr3oydom e ieo;t)srtoxmpoydamenliviatf rtruronu1optnio3iadlaDeln s;()altnxf oatlpDeaieo (0 2xrxo iy1open fcslt  rta(  oo4oexn ieilt a eanmsnu0 leoxf3oa1omDeaieo;(0 2toxr3nu4lpt  fci t)srurxmoou1tpxn icildfa rln p (0 eeoioctotfmDe nei;(  rto(m oy1am  mfvil(f rraurpoo1tpxomi3tlt s eauvs u0 exomo3tytoptelu ils0texmim3io4apenmicia()arumur nt4aleo ictlsfm2rm(mo;()areoir3tydfptelieo;(  rxm(r3oodol e fesa() 2truronu1tle  ocild a2umuvpnt)texnir tytoa  ln o;t sexoxr3oy4ol  lfvi sf rta(mooo4opt ifcilsfmDrm(mp;u)tetrircoadomtr nei;t  rumim oudomtn netltfaDtrxmp;u4apxomietat a rlump;u)trxrifcootomDe iesls  euo(rpiy1lltemfvt ()srrrx o;o0apx ioeilsfaDrmn o;(0tetomf3ia1lm  lieo s teurxr3no1al emnctlsf 2ua( pot0alx moctys aDuanvs;t4aetnif3oytfmtraieol(0 exo(r iu4ole lfci s)s2rr( pou0oltnmictadls2ranvs (4 exrxo3to1fate uvolt) 2xmimpio4amen nctls)a2tax oot1tlxo ietytfm uaump u0tlxoiocia1omDeai i s0 eur(rpiy4lltnlivta(f rtm( onu0opxomo3iltlaDumumo u)aexoxr3ia1optelnvo;() rtmxrpio4al  mfetl(  Dumum no0altnmi3tas s2rau snu4aeenxo3iadlpDran i;s setmio3oydoltnlncil(faDta(r ot4tlenmf3tys a emnms ()aetnio3to1fmDeaneilt t2ur(o3nu1lm emicsltf 2rru oot4tee mo3ilsfm2eanmo;u)arermoctytla r i ols0trtrim3iy4alte fctls)a2ur(mpot0oleoiiciasfm elu o;t0 eermr tytop e uei ()srtr(o3nudlme lict t  2tax  no0tpt mfetltfmDemumpnu)arenxf tadlaDr ueslt tetmxmpny4lpee nvia(  rrrx oot4olxoifctatla2emnvs ()treomf ty1laDe u slt0s2urio oo4apt lfes s aruaxrpno1tlen ieiadfs emnvs u0 lenir oa1fmDeai o t0 etoxm3nodape  ies (fs2taxrpnu1oex  o3tlt sDuaums;t4tleoifciydfp eanvi s)seuoiopiudale  fct sfaDraxrono0oex  o3tltfmDrmu s;(0 leoir oy1opt anvo s)t2uo(o3oudom elfcsltf rururo;u4apx ifeiatlaDrlnmo;u0altrmrcia1fmD ln s t)t2uo(o3nudapt  fesa() rumx poo1opxomoeiysls uanms;(0alxnxfcoytfptran o;t setr(opou1lm  micsasf 2rm(roou4tpxn ocils a rmn s u)trxriociadlmDraivi s0trto(rpiu1lm nlivtl(fa2uax  ;u1tlxo o3tad sDum(vo u) etnif oatoptrln ils seuo(rpny4op  mies sfs2tm(m ;u4aleo f3tysfa rmnvon(4teeoif to1fpDe ieils0s2xmir no4om  lnct t s2tm(rono0aee  ietyd s rmnmp u4tltrxo3oy1fpDe n s;()texoxo oy4omte fcs s sDum(  ot1tet iociasfs2rm( p (0trtoxr oadlp eluesl()srurim3iydll  mneiasfs2umxm ou4tpx ii3ils sDrm(mp;u)teeoxo io1omt lnvols teto(m3oy4opee ivs t)aDtax  ;t0apxnioeilsfs2um( pn()tlenxrciodfp r uvo;(0 etoimpiy4amtnlfci ()sruaxroot0altnioctlt mDum( pnu) ltrmfcoo1laD lnes () 2tr(r nu4omenliciltf 2ururo;o1apxomfeiasls ranvsnu0alxrmrcoytfa rli i (0 2xoiopoydll emfvil()aDrmx  ot1openioeiaslm2rl(mp (4aleoif io1fp  aivol() rurxr3iu4lle mncta()arumuro;t0apt if3ilt s eau s;(0tlxoircoatomDe n i t)srtm(opoy1al  lfvtlsf 2uaxmpou4opx  fciyt m uauvsnu4 ltrmrciodoptrlnvsl(0sexm(opiy1oleemfvs (  2ta(moot1oetnmfeilsla2rluvs u4aeeoxo oytoa e nes;t)srxr(mpno4optnlictat)a2tmuront4aex iiciatla2emums;(4 exoio oa1op  lueo s0srxo(o3iy1lle  fes ( s2tmxm ;u0aleo ieiydlmDua(vp t)trxoxo3ta1opD aneolt t2xm(r3io4alenlnvsa(faDtr(  ;t1oee  oetas a2ul(mpnu)alxnxfcto1oa elneils)srtriopoudll   ivtat s2ur(r ;t4altn ictys aDumn s u0 ltniocoytfate n o (0srtr(m oydll  lnvias  rrax p;t0tpt mo3tld sDrmnvp;(4aleomrcta1fp e ivo s  2umim3oy1ll nlnesas s2urump;u0aexn iciydfaDul(monu0alxoxfcootfmtrauvs s0sruoxo iu4op  lfvi ( a2rrx o;t0aptnifeiysfm um( ont0altriocoytlpt  n o;s)s2uo(rpno1altelfvtl()artaxr nt1altoii3iadlm elu o;t0arxomo iadlpD lnvo s0seum(o ny4lm nlicils aDtr(monu0opxo o3tys sDem( s ()alxrmrcto1fpDeluvolt  2um(r3oy1ale lfes tfa2rr(mp;u4tlxnifcils a emnvon() rtoxo oo1op eanesls0t2tr(m nu4lpenmivslsf rtmu o;t4oet iictat s2rmu snt) rtoio io1laDeai s;t)sruoirpou4lmt mfvi sf 2tmxmo;t4aex ifctasfa rauvo;u0aetnmr3iatfmt ai olt  etmxo iu1open net tfartau oot0tlto fctas mDum( o (0aeeomr3ootlmt  iei t  rtrio ou4altemiciasf Dua(mp;u0olenii3tas s uan snt0areomfctotfp rau slt)srxm(o3oy1lmtemfei s)arrr(m no0tex mi3tlt s2ul( snu4 reomocto1fp rlu i t srumxm iu4amtn fesl(  Durxr ot4olt iieiadls2elnvpn(0teenmr tydopDeluei (0s2xm(o3iu1alenmnesas aDrax pnu0oet mieiasfsDra( s (0aleoxrcoatfaDelneol()trxo(m no1optnmnet ()s2uax pnt1teeniieias m ra(vs t)aeerio3oa1la   neols0sexr(rpiu4ameemfcs t)a2rr(m nu1apxnmoeiys sDem(ms;()trtnirctadfpt luvo;s sexm(opnodlpenlieta()srrr(rooo4optnmfetysfa rm( on(0texrircoodlat  ueol() eum(m oo1op nlfcs s)s2urur nu0altomi3ildfm2eauvonu) reoxocoatopDe nesls0teurim3oydope  nctltfs2tmxrp;t0open icildlaDem( snu0tlxnmocoa1lptrlnei s t2uoxm3nodoptnmfvt (fa2rmx p;o1aexoiieiatla rauvs (0altnmr3tatlpDrlneo (  rurio3oo4ap emncias aDumu oot4altnmi3iytfmDemumo t) exrxocia1omt  u o;t) 2uriopiodlmenmnvs sfs2tm(r ot4olto iciad m umnmont)tlenxf oodfa rli s (0t2xoxr oodal nlneil(f rtmu o;o1tet  f3ias m2rm(ms t4artniocoadop rlivol()trtmxopoodlp nmiesls) ruaxront0ope  fcild mDranvo t4arxoxf todfpD  u o;t)s2urxm3oudlp nmfctas a2raumonu4tlt  ictlsfaDeauvsnt) rtrir ty1oa   i s;s)t2um(r ny1opeelies sfarum(  no4apxomi3iltfa2eanvsnt4 rtoxr3oo1lp r i ols0trtoxrpoo1lpen icsa(fs2um(mo;t0tpe mfetyt a rln s;u0teeomf oydlp rliei s)srxo(m3io4omtelfvs t)a2rau onu1tptnmociatfs emnvo;u) etrxfcty1fpDeluvo t)sruoio3iy4lle livt (fsrrmxr no4alx io3iltfaDrl( o u0 ltnio3tatoaDr neil(  eum(r iudap e ici t) Drru ooo0apt  ieiytla2elnmpnt)aetoif iy1omDean i s srtrimpiodlleemfes sfsDrmx o;u0apenmi3tyt m em( s (4tetnio oadfa e ivils)srtmio3ny4ame  fei ()srra(rp;t1tlxniieiydfa rauvsn(0trtnir ia1lm   ivs (0s2toxopoudlp nlict t)a2rrumpoo0aex  iciydlsDran s;t0aleoir3oydoaDe u o s0teur(m3no1lpt mnet ( arum(r ;u4oltoioctyd s2eanvont4tleoxf3ootoatr n ils)setoxo nydapenlfctlt a2uaur ou4oex iociyt a elnvp;t) ltrifcto1fa elnvsl(0 2xoxr no1ameelneil(f rrr(  oo4oetomieiasfa2um( snt)aeeomrcoydlaDe nvs;()seurimpnydamenlneils  Dum(r ;o4texnmo3tasfa umnmonu) rtnir3iydfmtr i o;() 2xmir oodlmee nesas  rrr(m ;o1ale  octldfa ulnmo u) rxomfcio1om eli o (  2xo(m ou4optelnetlt arurumo;u1apt io3ildlm emn snu)aexoxf3io1fpDr n o;(0srtoio oy4ap emicil() Dumxmono1ole mo3iytfa2em(vonu)aleoxfciodom e ivi;s) rtr(m3oudlmtn feilt) Drm( pot0oltn f3tlt s umnvs u) eermoctytlmt lu olt)srtmirpou1ole  ictat  Dtrx  ;u4oetnif3iadfs elums u)aleoxf iy1la raieolt0setmxopoy4op  lnctltf Dra( ont1tltnmociaslsDelu s;()aetrmr3iodfat aivs;s)srxrxm3io1aptnmietlsfsrrmx o;u1oex mf3iydfsDem( s u4arenifcoatoa eai sls s2tmir3ny1lpenlieil(f Dur(rooo4oltnmo3tat aDumnms t4alxrmr3iatom r i s t)srtoxrpiy1lmeemnvtls)s2tr( poo1olxnio3ildlsDeanvs;u0tlxrmfcto1late iei s0t2xrir iudam  mivtls sDta(m ;t0oetn iciyd s elnmo;u4tetoxf oatlm ranvi;( s2xoio3ny1op nmnci ()s2tr(m ;o4oltnmi3iasfa rl(vpn()aetomf iy1lpDrlnvil(0seurim oodlme licsltf 2rmxm ;u0alx mf3ils s uan o (4alermr3iydlp e ivslt0s2xm(m3iudoltnlivtatf Drax oou0tpenifcilsfa2emnmpnu0aexrmr3iodfa r nvo;s truoirpny1olt mfetas) 2ra(ro;o1tptnmf3iydls eanmsn(0aeeoxo3iatlm elies () exr(o3oo1olen icsa(  rumumpno0opxo f3tas m2ra( o u4aeermoctodlpD auvils  2xmio oo4amt  nvsa(f rtaur ;t0tpt mociat m2rauvo ()alerir3oy1om e u s;(  2toir oodlptnmfvs s sDuaum nu1ape mf3iatfa rlnvo (0texnmr oytlatrlivi;t  rto(mpiu1ol e ict ( s2taxm ou4aet mi3ils a ua(vpnt4aetomf iotfatr n s;s0trxmxr nodap emieil( arurumoot0olxoiocilsla uluvsnu4 eeomo iytfmDr ueil(  rxo(o3io4ap nlnvs tfarrm(roou1optnmoeiydla2raumpn(0teerxf3iadoa  anvol(0tetm(mpoy4lmtemnvtas aDrmxmp;u1aetomictydfsDuaump;t)arxoxfciy1lptelues t) 2xrim3ou1ap  livi s  2ur(m nu0tleoii3tys a emnmo;u4 rtoirciy1faDr uvil(  rxr(rpio1om elfvs t)arrmxmo;o4tetomo3ilsla uanms u)aeeoifcoodlm eai ils)t2tmxopiu1apenlfvta(fa2tax  no1oexniieildfs rm(mo;u0aeerxf iydoa   n s;(0trxrxo oy1ll  lfcsltfsDtrx p;o1altnmociadls2umuvp;t)aeeniocty1opt liei;t)srxr(mpoy4omt lfetlsfsrtr( pno1oeto f3iys mDrlump (4 etnxo3ty1fat lnes s teurio3ny4lme lfvta(  2trumpot4apt mfctasfm2ra(vont) eeomfcty1fptrln sls t2umxmpio4llteliei sf Dua( o;t1aptnio3tys sDem(vonu) eerxr tytoaDranvi (  rxrxo3io1ale  ivslsfa2tr(rp;o1oex ii3iad a rl(mo t0tetrio3oatfmtelnvs (0 2xrxo3nu4omen ncsatfs2tau  ou0aexn octysfmDum(vpn(4trxomr3tatfaDraivs (0teur(r iy4ap elnes s srtax pot0aexn i3iat sDulnms t4 eeoxo ootfmDrlivol()setoir3iu1omtelivtas a2trx  no0oexoio3ias s ra(vo;t)arenio iatoa rln i s s2trxm3oy1op e fvtasf rurxmono0opx moetlsfm uanms u)arxoir iatlat  ues t setmirpiudopt lfvsa()srtmuroot1texnmociyt a2rlu sn(0tlxrir3tatfaDeai olt0teto(opny4ap  mnvt ( a2taumonu4oeeo f3iatfa umnvp t4tltomocoydla   uvs;t)srxrim oydalenmfcsas sDtaxr oo0tltn icias m em(vo;u) ltnir3ty1lm  li i t0sruo(mpnudoptn icils) 2uaxr ;t0aptomi3ildls2ranvo ()trxrif3totlmtrlnvo t)srxrxo iydol nmicia()s2raxmpnu1tpxnmiciat m elu s t0 exniociydlatrlieilt)sexrirpiudom nmnetl()sDua(  nu1oeenmo3iaslsDuanvon(0 etrmrciadla  lu ols  rto(r oy4op emfei s)a2ta(mo;o1altnmf3iys a2ua(ms u)trerifciotomt auvo;t0 rtoxo3iu1altelnes tfa2rr( p;u4aeto o3tas s2rl(vs u0 rtrmr3totfpD aneo;( srum(o3ou1lpenlivs () rur(r nt1aeto icias s rln o u0aleoif3oo1fate uvi;t0 rxmxm ou1ome lneta(f rumumonu4tpx ifciadls umuvs;t4tltnif to1latrau ol() rum(r3nu4alte iciatfa2taxmpou1tltomociasfs elnvont)alxnxr3oa1fpDrlueo;s t2tm(opio4lmtnlfctatfarua( pnt1ole moctltfm2em(mp (4 ltnir3oy1lp   u s t  rumir iu1ap nmfcslt) 2uax pnu0tpxnmi3tlsfm um(vp (4texrir to1lmtelieo;t0srtoxm3oo1ol elnvs () 2uaum nt4tle ifctlsfaDrm( s;(0 ltrif io1opteaiei;t)t2toimpiu4aptn feilt)a2rauroou0oltn fetytfmDumnmo (4alxnxr oydfm r i s;() 2xmiopiodlme  neil( aDum(m nu0tpxnmo3ildlm2em(vonu4tltoio totfmDrli o;t  exmim oy1al  lieiatf Draur ot1oex  i3iysfs2emuvs;u) exrmf3tydop   u ils0 2uo(m iu4apt mnvias s2urxronu4alen o3iadfa ra( ont0 rtomrcoydlmtr i o;()srtr(m3io4lp nliesa()sDta(ront4tee ii3iyt a2umuvo;u0aeeoxr oytop elivi;s  2trim3io1lpt  nvt (f rrrxmoot1alt mf3ilt m uln o t0 rtoxrciydlmtraueils)teum(m3nudllenlicsa(farum(mpno4tptnifciytfm uaumsnt) lxnmr oatlptrli slt0 2uoirpoudaptn ivilt arrrxmp;u4tlenif3tlsls em(vp ()arxomr to1oaDrln slt)trum(opiu4ale  ncslsfaDtrum ou4alenifetad a rauvo t)altnif3todlm rau i;(0s2um(o3no4lptemivi t)arurump;u0tpxoifetas aDeaums (4 rtnmr iydlmte u o s0s2uo(r ou4ol elnes s)aDrrur ou1alxomf3ias s uau o;(0tlxoxociy1oatr neolt)trxm(rpou1lmenmfcsls arraumoot4opx  ictltla uan s;u4 etomf3oy1lpteaueols  rxrir3ny4lpee ivtat sDrmxmo;u1tptnmietlslmDrau s u0tleoio iytlmtrau i;t)teuoiopoy4ol nmnvi s)srtmu ooo1apeo o3tatlm ra(vs;t)tltoif3to1om r ueo;s  2xmxo3iydoleelivsat)artaxm ;o0tlto fciytlm eluvsnu)tltrxo oodlat an i t)s2uoxopiodlptnlfvtls) 2tm(ro;u0open octytfm2eln p u4 etrxo ia1fa   uvs;s seum(m no1al   fct tfsrra(rpoo0apt miciydfs2ul( o;u0 eeniocootoaD au o ()t2tmimpny4am nmnvsls) Draxmo;t0opt  ociadls el(von() lerifcoadfmt auvi ( t2umio ou4optn fci sfs2rax pnt4ole mieiadlaDrl(ms;(4artrmo3ty1la e uei;s)srumio3nydom nlivs ()sDraxrp;t4opto i3tytlsDem(vs;t4 rxomrcia1fm  lu s;( setoxm iy4lmt lfctas srurx poo4oeen ictyt aDul(ms;(4texrio3to1la e ivsl(0 2xmxo3iydlm  livtas  2taumpnu0aee  ociatlaDulumo u4altnxf ootom rai s;t0seto(r iydal emfvi s  Drrump;t4tlenmiciysfmDuln ont) lenmo oa1lp   u i t0t2tm(r3iy4om elnesls a2ur( onu4oltn icild s2rau on(4 ltomfcio1lpDrluei;s) etoio nydol emnei (fartaurp;t4tlxnmo3iysfs ul(vo t4 lenio iotopDe n o;t)setr(o io4ope mfcs s sDrau oot0olxnmfeias a2umnvp;t0 leoir3iytla rai sls0sexoxrpiodlp   nes (f Duaur ;u1alxnmfeiydlaDrmnms t)aexnmr3tytlm r ivi;()t2xoxm3oy4optn fvsltf 2tm(mooo4oltnmfetas sDel( snt)tetoir oy1lmtrlieil(0 2tmio nu1ale mnvt s aDtaxronu0aex if3iltla2ran pnu) rtnxf3ty1fmt livs;s)texrim no4lm  mfvilt)artr(mpot4tleoioeildls ranmsn()aexrir3oy1la eaies s srxo(o nu4lpenlics sf rumu pno4apxo oetat sDea(vs u) ltomo3iodla   u il(0sexr(m3iu4lp  mfeslsfarumu o;u4teeoioeildfm rmn p (4tlxoxr iatfmDrlivs () ruoir io1openlfei tfsrur( ont4ape mo3tldfaDrmumo;()tetoxociy1fatrau i;t tetoxopiudopenmiet t)aruauroou0tleoif3iasfmDua( on(4 lerxo3iatoaD li s;t)t2toio3iudop  lfvsl()s2ur(mono1aet ifeiyslaDelumo u0 ltrifcoytfpt anvsl( texm(r3iy1ll e fvs ( arua(r no1aptn f3iltfsDrauvo (0 lxnirciotopteau s t0setr(opnu1lm nlnci ( arurxr ou1apto octasfa rlumon(0 etoif oodomDeanvo s0t2tr(r no4olen ivia(f rrrxr nt0aetniociydfaDrlnvpn(0tltrmo oatoat  ivo t) rtr(m3oo1lmt  feia(f rrrxm no1apx mieiasfm el( pn()aeeoif iy1oa e ivol( tetrxm nu1apte ietl(faDur(m ;t0aexomicildfa2uaump t)arxoxf oydop r ivo ()trxm(m oy1lp  lncs t)aDta( pnt4olt iicilsls2ua(mo t0texomr iydlpDranvo t)seuo(m ou4lle mfvs t sruaurp;t0oeeoii3iysls elnmo t4alxnir3iodfpDelivo;s  2uoxr3oy1am  lncilt  rtr(  ou4tltnifeiytfaDeaums t4 etoir3iy1faDeanvs;(0sexoxmpiu1lpenlneslsfsDraurpoo0ole  fciad m el(ms;u)treoxo ty1fp r ivo t0 rto(mpiy1amenmfes sfs2rrx pnu0ale  ociadls emu o;u) exrif ta1omtrli i () exo(r3ny4llee ivsa()a2trxrooo4tlx mfcildfs2ran o;u)tetnio io1oat lu o s)s2tmxm3iodame mnetatfs2rrumpno1opt mi3ildfaDelums;u4tetoxoctadoptr uvo;s s2trir iu4om nmfeils sDurxr ou0tptoifctasfsDul(monu0texrxr oytfmD lnes;(0seto(opoydome  feslt  rrru onu1aee  o3tyt m rlnmpn(4 rxnmo to1fmDeln o t) 2toxo3oo4open icslt)srtrxm ;u0opeoif3tlslm ul(vsnt0 lxrmfcio1fpDr uei;t) 2xmirpnu4ol  lfcils)s2tmu  ou4ole  fctad m ulnmont)tltoxo todoa ranvs;t)tetmxmpiy1lptnlncsasfaDrm( oot1aetomf3iys aDumu p;(4artoir oydfaD auei s  exrim ny4am e fct ()aDumx o;o4aeenmiciyt m2umn s;t0artrxoctadoaDraneil( trxmxopiu4ameelnvsat)sDta( o;t4tlenmfeiltla rl(mo;t)alxnxr3oydlaD  ivils0sexo(rpoo1ll   fci s  Durum ;u0aex  oeildlaDel(mo;u)artoif3tadlatr ueol(0srxrir ou1ol nmfeiasfa2rrump;o0olenii3ias m umu pnt4 etrir tytlptr ivi (0 eto(mpiy1lp elicsl(f 2tr( pnt4oltn ictlsfa ra( p u0trenmfcoo1faD lneil(0setmxr3oydaltelncias  Dumumpnu0tlto oeiat mDrmu p u0arxoxf3oytlaDrlnvs ()srxmio3iu1lm n ivils)a2rmx pnt4aee  fciasfm2ulnmo t) eenmo iydla eln s ()tetrir3nodopenmfvt t) ruru  ;t4tlx moeiatlm2rm(mp t4arxrxo tatlpt  i i;(0 2umimpoodale micsa(fsrrrxm nu0oexoii3ilsls2eanvsnu4 lerxr3oatfmtraueo t0 eur(o nu4op nmictat  rrm(rpou0oetniietytfm2um(vp;()alerxo iodfm  auvsl( srxoxo3iu1oltemivslt)s2rmxrpnu1ope io3tld s2umu p;t4aexrmfciadlp   ueo;s0srtmir3oo1olenlnvs (  2um( pnu1teen fciad s eluvo u0tlxnif3iydomDe nvo ()trumxmpiu1alee ivta(f Dtmxr ;t1tle moeiytfsDua(vp;t)teeomr3tatoa   ivo;s s2tmxrpoo4al e fvs sfa2ra(r no4optn o3iytfa2em(vs;u4trenxo io1lmt livol(0 rur(rpoy4omee fvias a2raurp;o1apt mfetltfa emu ont4tlxrmo iydopD lu o;t)setoio oydame mfvi sf 2umxm ou4olxomfeiaslmDel(vs;(4 exrxrciotoa eaieilt0s2tr(o3ny4ap e ies () rum( pnu1altomictytfa ra( s;t4tlxrir iatom rlu i;t srxr(m3oudop nlici sf 2urur ou4apxn feiadfa2uauvp u0aetnmocoydlateaneo;t sruoir oydoltn nvi ( sDtaumpoo4tpxo f3tlsfs rlnvs (0trtoxrcootlmDrau i;(0teumxo3iydop nmietlsfartaur no1oexo oetyd mDumnmo t4 etrmf oatlmt  u ols0 euoxo iy1olenlieil(  rrr(r ;t1opxomfctlt sDrluvo;t)arenmrctatlaDrlivo s  2um(r io4lpt  fet t)sDtaxm nt1tpe mo3tys m rlu snu4 lxrxo3tadopDrlneo;s0s2tmxm oodol   nciasf 2rrx ont4oeeoiieiytfm ea(vp (0 reoxrciytop rlueilt)teur(o ou1om e fvt ()sDuau pno4oleo f3tad a2em(mpn(4 etrxfcoadfaD au s;t) eumxr iydlptnlnvias)srra(  ot4alxn fcilsla um(vonu4aeenircoodomD au ils seumio3nudlptelfesls)s2ta(mo;t0oex iietydla2uan o;(0aleoio3oodopD ai o t0 etmxm3ou1amt mneiat)aDua(rpoo4apxoifctadfsDeanvp;u4tltrxfctadlateanvs;t  2xrxr oo1oltnmict ( srrrxr ot0oex  f3iasfmDrlnvs (0tleoirciydop  anei;s0teumxm nu4al nmncs s)s2urxront0aetoif3tad m2rm(mon(4tetnmo iadomDrluvi;t0trtrxr nu1lptnlfeia( aDraum ou0tpto oetyd m2rl( s;t0tlenxf3oodfaDe nvs t0 rtm(o3oydole  neiasf Drrx o;u0olt  oetat sDra( p;()texoif3to1fa   u ol(0t2xmxm oo4lmee nvtlt) rua(root4aeeomocils m emu o u4tltrmociatopDrliei;s0t2tr(r oudalte ncslt)aruau  oo1oleomfciyt aDua(vo;u4trtoio totfmD ai i;s0srxo(m3oo1lme  fcsltfsrraxr ;u4tptnio3ildla elnmsnu)alerifciotla rlnvs;t0sexr(r oy1llt mfciat srra(mpno0opxoioetlsfa ea(mo t0teenmr tadomDeaieo s)s2tm(mpoy4alte ivtlt srurur no4aexnmfeildfmDea(mp;t)arenmr3tydlmt lnei;s srtoxopiy1ap nlfvta(f rtaumo;o1tpx mfcilt aDumnvo t4aexoxrciotoatr nvi ()trxoxmpio1apte ivias sDrrumooo0olenmictytfaDemn p (0aetnmr3iodlp rlneols) 2tr(rpiy1olenlieias  Draxmo;t0ole mocilsla el( p;()altnir3oadomte ieo;( srtmio3oo4llte nvs tf 2raxm ;t0oet mf3iyd aDumuvp ()artrxocoatlat an sls0seumxr ou4openlfcta() 2rau oou0oeenmietys s2ua(vp u0 rxrmr3iotop rauei t0teuoim oodlme mfvi tfaDtmumpnu4tptnmieiasfs ean p u)tltnirciatfmDe u ils)seuo(o iy4omen neia( aDrrxmoou1tpx mf3ildfs ranvsn(4 eerxfcoadlmt anvolt0srxoxmpno1ale licil()arta(ro;o4apeomictydfs uluvp ()teerircoytomt  n s t)srurirpnu4lpe mnvsls) rtmum ;o1oltn o3tldfm2rmnmp;t4altrmrciadoa r nvi (  rurirpio4ame  fvsa() Dra(  nu0tex miciasls ra( on(4tlxnxf ia1op elnei t) etoimpoy1ap nlivs t  Dumxrpnt1alenioeilsfa2rmnmo;t4trtoxrcootfptraueol(0srxr(m3ny4ap  liviasf Dumx oou1tetnifciasfaDrln o;t)aeerir3tadomDr n s t) rtoim3io1omtnlivt tfarrmurooo4apeoiieiadlaDeluvs;t4 etomo3oatlaDrauvs;t tetoim oydll elneta()s2tmum ;o4oetoiictlsfsDrm(mo u)aeeoif iydlp elneo;s)seto(o3iu4lmee ivtas) Dra( pnt0alx  fetys s rm(mpnu) exnxr3tatopt au i;t0srxoxm nu4lptemnctl(fsDrm(mont0olt  ietldla um( s (0tetrmf ia1fmDe n o;s)teuoio iy1apte ieia()artm(mo;t0altnmoeiltfm eauvs;u)aetnio3iadoat ln i;(0 etrio iy4ole  fvt s)artrxmonu4alen feiys mDeaums (0altoxr3ia1fa rluvslt0srtmxm3iy4lmee fvt tf 2uaxr ;o1tpxnii3iyd aDrlumo;t) eenxoctatfm  aieil(  euoio iu1aleemnct t arrrumo;o4aetn f3tat s2um(mp t) etnxo3oadla r ieils)s2uo(opno4ap   feilsf rtax pou1apt mi3iyd a2umump;t4 rxrxr iatla e ueo;(  2xmir no1llt mnctl( srtau  nu4oee mociytlaDuanmpn() eenmoctotoaDran i;t)trtmxopiudllt  nvtatf rumurpnu1opxn ieiltlaDel(mo;(4 eerifcto1laDr neslt)seuriopny1lm n iet t srtaumpnt0apxnmf3iys mDuanms;t)arerif3ia1oaD lnesl(  exmxr3no4am nlncsltfarua(rpot4olxo f3iyd m2ua(mon() leoxr oytfa elu i (0s2umio oudamenmfei t  rtmumo;o1aexomi3ildfmDua(mp;u4 lerif oydfm e ieo;s0 rtmxrpoydopeemnet s aDurxro;u4ale  feiltlsDeaumo u0texnmf3iatfatrai s;s trum(rpoodalt lfeilsfsDurxro;t1apx ifeiys s2rmnvp;u4alerxf oydfmD luvi;s0s2urxopiu4op emnvi (fsDtmxmoou0tpt mf3tld s2uanvo;t4aexoxocoy1fp  aueo s seuoimpiy1lltnlictl() Dtmxrpou0tlenmo3iadfa rl(vs t) exrmo3tatfpD aivsls0 2xm(m nu4llt mics t) 2urx p;t1alto f3iadfsDem( o t0aeenxr3iy1fmDraueil() exr(mpiudam emictas a2rru pot0tptnif3ildls2rmnvon(4tltrmo oydlate u sl(0texoxmpnu1lm  mncsltfsDtax oot0tex if3ias m2rmu p;()trenifciydfpt  neo;s0seurim ny4lp e ictl(f rur(r ou1tleomociysla2rm( s;u4alxnmoctytomtrlneilt)t2xmio iodlltnlietl(  2uaump;o1apxnmiciytfa rm(vs t4aexrxo oytlmDelnvs;t teuoxr3iy4op elnet ()arra(rpnu1aet iieiyt m2ulumpnt4 reniocoodlpt anvs t0srtrimpoy1lmtemfes sfs2urxmont4olt mo3tlslmDuauvs;(4altnifcty1fmteai s t0tetm(m oo4lmtnlneslt)srtm(rooo0opxomoeiydfmDumu snu4trenmf oytlateai s s0 rurim iy1aptnmics ( sDumxrp;t1teeo feiys s2ra( onu0aeenxr3tytom eliei (0t2trimpiydopeemictl() ruau pnt4tlx mietldfaDelump;(4texoxf iydoptean i s  etmxm iy1omte fcsas) rururpou1apx ifeiytfm2uau p t)aeenio oydfatrauvo s0 etoxm iy4al elivtat) 2rau oou0oexo ieilt sDeln sn()tetrir iy1optrln ils0srxrim nu4omeemnvsl(fsruru p;o4apxnioeiltls2raumsn(4 reomocoadfatr n s t)s2xr(o ny1llt  netls)sDurxm oo0tpeoif3iadls2eln on(4 rxoio3iotopte ueo (0 rtoirpiy4ll n neias) ruaur oo0ope mi3iys mDra(vs;t)aeeoif3ootfp e nvi (  2to(mpiy4opeelfvt () ruaump;o4tetn ieiys a2eluvo;(0trxrirciatfm elnvo;t) eur(r3no1omtelnet s) Dtmxm nt0olxo o3iyt a rmn pnt4 rtrioctadlatr ies;s) exmxo3oy1lp e ncia( a2rmu  nt1tlenmf3iltlmDrmuvp;u4 rerxrcoytlmt luvs s t2ur(m oy1am n fvsas srtmumoot0oexnmo3tldlm2rlnvs;t4arxrmr iatfmtelueils)t2xrxo3no1lpenlictls sDraxm ot1opt  i3iat mDumu pn(0trenxf3ootfmDeauvs;t0t2tmxo3ou4oltnmfcsat) Dtrxmp;u4oltn fciadfsDel(mon(0tlerif io1lp r ueo;( t2tm(r nu1ll e ictls)sDtauront0altnmiciltfmDumnvs;t0teeomr3iodlaDrln sl() 2xoxopoy1lpeelneia( a2ta(mpno1tpt  feils s ra(von(4aexnircta1lmteanvols trxmxm oudlle mnvs sfsrtax  oo4altnifciaslsDul( p;u4 eeoxf oydfa rlnvi t0 exoir oydam e iei ()sDururooo1tet iietytlmDemnmo t)aexnmfcoadlmtrai ol() eurio iy4ameemieta()a2tr(mono1open oeiaslm raums;u0trtrxfctadop elies s0 eurxrpou4llenmfviasfsrrrx onu0aexn f3iyslaDrm(vp u)tlerir3iadfa e iesls)trtm(opoodlm  mfei sf Drr(ro;u1tee mf3tldfs eluvon(4teerxr iy1fa rlivi () rxrio3nydlmtn fetl(fs2ua(mpno4texnifetytfm ra(mp t4alxoif oydlpt an o;s  2xr(r3iudalte fvia()a2tm(m ;u1tetomoctyslaDem( snt0teeomo to1lm rai s;t sexm(rpoudamt  nciat)srum(m ot0aeen fcild m eluvs;t)tlxoxo oodoa   u sl()srxrir3oo1oltnlicslt)artr( o;t0tptoif3iasfsDumnmp t4 renif3iatoaDr n ils) rur(opno1openlfvt s sDrrur nu0aetnioeiad m2um(ms;(0teeoif3ty1fatrai ol( srtrir iu4lle  net ()sruau pou1aetnmiciltla ranvsnt4arxnxfcoodomtrau o;s  rxoxo3iu4apenlfei tf 2rrx pnu1olxnio3iatfaDeluvon(0arerir3iydfate nvo;s0seto(r3iy4llen netltfaDua(rpou4oetoifeils a2rlu o;u4texrio oydlptrlnvo s0tetoiopoudamte ivtls  2rmx o;o1alx io3tltla2ean pnu)tltnir3tatoatrauei ()s2uo(o oy1lmt lietat)srrax  nu0opeomf3ils m ea(mont4 lerio io1opte uvils teumir3oo4llen nvi t) rtrxmo;o1opeomf3ilsla rln p;t0aetoxr iytfp raivils0texmxo ou4alte nci tf rrru pnt4aetoii3iytfm ulums;()aeenio3ia1fp e nvi;s)s2urxr3oodap  lfes tf Dur(  ;u4apto f3ilsfs2um( s;()aetnmrcio1lp  aivi t0srur(opnu4amen ieta()a2rrur ot0optnmi3ias aDua(vsnt4aetomf3tatopDe ivil(0t2umxm iu4ol emicta(fsDraum ;u1oexnioeiydfs2rm( on(0 leoxocoadfmt aivi s  2toim3iudaptelnvs s)aDtm(mono0aptoifctlsfsDeauvo u0 rxrmo iytop r ieo;t trtrxr3iy4lmtnmfci t) Duaurooo4opxn o3ilt s2emu p;(4tlxoif3oatfpD  n slt0 rtm(r3iodlm nmncsa(  rra(mp;u0oetn feiadfsDrlnvo;u4trxrif ta1lp e ivi (0s2tmxr iu4amtnmnvt (faDtmu o;t1tex ioeiyt a2rmn onu4 rxomo totlate ivs s0s2urxr oo1ap  mnvs s a2umur ot1tltomfciatfs rmnvpnu0aeerif oo1opDr ueo t) 2toxo3oo4alt mnvi (fsDum( pnu1texn oeiatls emnms;u)artnmocoo1omtrlies s sruoim3io1lmeelnet ()srrmum ;u1oet  iciytlsDrln p;()teerxr oodlmDe ivo;s s2xo(opoy4ap  lnvta( sDur(r no0apeoifciltfm uluvpnu)altrxo3oatla   nvi t)setmir io1omt  nci t)aDur(  oo1apeomfeiydla2ranvs;u0tetrircoa1latelieo t0 eum(o3iodll   iciasfsDtaum oo4altnio3ias a rmn s;u)alerirciatfmtrlneils) euoim3nu1amtn icsa()arrrx pno0tltnmf3iydfm2rm(vpnt)teeoiocoatlm eluvo (0texoxopiy1llte netls)arururooo0tptn i3tatfm2elums u)trtrio3iatlp   uvol( setr(o3iy1lp nmfctatf rrm(mo;o4opxn i3tytlm2ulnvs (0 lenxr3iatfp elnei ()setoim oydamtnmnet sf 2trur ou1opt  ociyslsDelnvsnt4 rxnmr3todfa raieol()srxoxmpnu1ole mfeslt  2uaur ou1alx mi3tldlm2eln p;t0 ltnmociodfptelu o;t) rxo(o oo1ale lfesatfaDuaur ot1tptn oeiytla2ul(vs u0trermr3tatomt lu o t trtm(m3oy1lpt  ieiasfa2uaxmpnt4tex moeias mDra(msnt4arenxo ia1fp rlnvs t0 2xrxo3oo4llt lies s  2tr( o;o4aee if3ildfmDem(vont4arxnxrcoodlm r n o () 2xoio nu4omt licia(fsDtr(rono1tlxoiietls m em(vo;(0aeenmo3iatlmtranvs s0srtr(rpou1lpte ietas srumur ou4aex mociltfa uau p (0altrmr oatfpDelnesls s2to(r ou4llee fct s  2raxm nu4tetomo3tadfm rmums u4tlxnio3oy1fmt ai il( teuoxo ou1al   nvia( a2rm(r ;t4alenmfctat s2eln o;() eeoxr tadlaD lu i;(0tetoirpno4apen nesat  rrm(  no4opxomociysla rl( o;t) lenmocio1omt  ivi (0 euoimpiodale  nci s s2um(  ;t4texnmociat mDel(mo u)teenxr io1lm r uvo t trtrxo3nodlmtemnviasfsDrm(rooo4altoiiciydlsDranmp u0 leoio3oa1faDeauei;( srtrxrpnudlpe  iei sf 2tmxmp;t0oex  oeiadlm emump t4aeenmocootfp e i o ()t2urxmpoo1oltemietlt) 2trum oo4oee moeildla2rm(mo ()areoio oa1laDran i t0teurxm3iy4olt  fes (f 2rau p;u0openmi3ilt a2rlu s u)arenxrciatfaDrauei;()s2trir nu4amtnlivtltfa2ur(mp;o0apt mfetadlm2eau p;t)tlxrmo3iy1opDeluvols0 2umxmpoy1lmtemnvias) Durxrpnu1aeto octlsfs eauvs;(4tetnif oo1lm e ueo s)srxoxr no1apenmfet s aruaurp;t4olxnmi3iyt m2ra(vo;u0 exrxr io1lmDe uvi;s s2uriopnu1oltn fvs t)a2um(  no0tlt moeiadlm uauvont4 lermr iadoptrli i;t  2xo(mpoodom  lfetas)s2um(mpnu0altomfetydfa elnvo ()alxoiocoodlpDrlu i;s) 2xrxm3iydol n fcil(fsDum( ono1olxnio3ilslmDemnvpnu)artnmr iotopD  n s (0 exoxo oydapte iesat aDrmu  ;o0alen o3iltfa2um( s;t)aeerxf3iytla rln i;()tetoxo3iudal  mfcias srumum oo4oeto o3iyslaDumnvpnu4trxoxocia1lpteli s;( srxo(o3iu4ame  nes t  rum(roou0aee ioetyt sDeanmp;u4aetrxfcio1fpDeanvsls0srtmxr nu4olenmivslt)sDraum ;t1tet  feildfaDeaumo t4tlxnir3io1oa eai s;() exm(o3oydlpee ieias artrum oo4tpxnmo3tlslmDemuvp;(4aetrmr3iytla eaivi s0 2to(o3no1om e nvilt sDtr(mooo0oet  f3iasla ulu snt4 rxoxrcoa1faDran slt) rxmxm3oo4apeemivsl() Dtaur ;u1alt moctld m rm( p u4tlxnmf3ia1faD ln olt)t2umirpoo1llt mfesls sDrm( p;u4ole ifeiasfsDrlumpnu)tltnxf tytlmDeln o ()t2xoxo nu1lm emics s srrr( p;u0ope ifeiasla2emnmsnu) ltnxrciytfate i i (  2xrio no4lp emnvsat aDtrx p;o4aleomi3tadfs rauvonu4tltnmo3tytlpte ieo t0trto(o3ou4al  mnctat)sDtaxroot0aet io3tasfaDua( s u0artomr3todlptrlnes;s0trumim oo1lp  mfvil() Drm(  nt4texnioeiys s rlnms ()aeeoxf3ta1om   n s;t0srtrirpoy4amenmnciat srrmu ont1aeenioeiadls emump t0alxrxf iytlpDeli ols0trtm(r3oy1ll n fcs tf 2trxrpnt4tptn feiysls ea( o () rtrircoo1fpteaues s  exmxr3ou1lpe  fvi () 2uaurp;u0aetnioeiatfm2ean s u0tetrmrcoa1oat  nvi;s) eum(o3iy4openlnctas)sDtrur oo4tpxo i3tlsfsDulumonu4trenmo3to1lp   uvo;t0setmxo oo1lpt licsa()a2rru p;u0alxniociyslm ul( s t4aetnxo3tatoate u sl(0trxoxo3ou1amtn ieil( s2rm( oot1oexn f3ildlm emn o;u0aleriocoytfm  au olt)t2xo(rpiy4oltemnctls) 2um(mp;o4tee  ictltlm ea(ms (0tlxrio totfm e ueo s t2um(opoy4al nlfetat arur(mo;o4tltoiicild s uluvo;() leoiocoy1la r ueo t)trumir nu1aleeliviltfaDum( p;u4olxniietlt aDumums;(4teerif io1op rai s;t)t2xr(opiu1apeemictl( a2uau  ;t1oet iiciad m2rau o;(4 ltoxo iytla rliesls)s2xo(m3nu1am nmivils s2ur(  ou4oeen ociyt aDul(vsnu0alxrmociadlate uvi;t)t2uoxm nu4ol   fvslt  Dur( pnu4aexnio3iydlm2em( on() lenmo ia1op  anvo t trtmxm iy4am emncia()s2tm( oot1oetoiieiytlsDemnmsnu) rxrxrciadoaD livo (0 rum(o oo4llen iet ()aDrmxro;t4teeo ociydls2umnms;t4 etnxociydoatelu o s)teuoxo3iy1altemicilt a2tmx o;o0tptnmfeias m rm(vsnt) exnir3oy1faDrlnvs ( tetmio ou4op n net sf 2rau poo0tle mo3iydls2rm(mo;t0 rtrirctadoaD  i o t  etrxm3iudam  lieiat)srurxr oo1apto f3iad m uanvpnt)aeermfcoydlp r u i;s0s2xo(mpiu4alt  iet s)s2ra(m nt1ape moeiydla el(vsn()texnif3oydlaD au i s trtrimpou1lmenlfvia() 2um(m ou1apen ietasfa2emnvs (4aexrxf3tadomD  nvslt)srxmim3ou4ope mfci t  Duauroot4aeeoio3tlslmDrl(mp;t4trenmocoytomDrlu olt)t2um(opio4omeemnvils)sDrrxr nt4teenmictlslm ul(vs (0 leniociatlatean o t)t2umxm3nodalen iviasf 2trx ono0apt  iciltla2ra( on(4 exnif oatfaDrln ol()srur(r3oudlmtnlfvia() rtaxr ou4tee mfeiat aDrlnvs;t0arxnioctatoaDeaneolt)trtm(r iy1lmte nei (  2ua(m ;t4tlen fctyt mDuanvpnt) exoxr to1lmDe nvs s0 rur(r3no1op nmncs (  rtax onu4olx ioeils s raumpnu)aexriociatlpD luvi;t setm(r iodale  fctlsfa2taumoou0tlenii3iad s umnvp t0trerxfcty1lm eaues (0tetrim3iudom   nvta() 2tm( ont1oeto fctyd s umuvs;u) lxnmf tadlatelneo;()s2tm(opnu4olt mfes ( srrrurooo4oeeomoeiatfa2eauvo u0tlerxr3oodoptraueo;t)t2to(opiu4apee ietat) 2uaxr ou1ape ii3ils mDemnvs u)tlxnir oytlaDeaieolt0s2tmxr iu1omenmicta()sDrax ono1tee  fciydfa emnvs t4 rermo to1lmDrli o s0srxm(r ou1lltn nvsatfsDumum ou0aee  ieiadfaDum(mp (0aleomrctadfm rlu slt)sexm(opio1alenmnvsat)sDurump;o1alt  ictatls eauvon(0aeenxociodfmDeaneol()srtoxr no4amtn iciatfsDua(r oo4tetn ictld a eanvonu) leomr3oy1la r n s;()s2xoxo iu4lle livta(f 2rmx poo0olto ieiydfa em(mp u4 rxrmo iytomD anvslt  2trxo ou1altnmfcslt)s2uaurono4aex if3iysfa rmu s u)tleoxo iodfp  ln sls0seuoir3iu1lltemivt t  Duau o;t1texomictydlaDuau o;(0 leoxociodfpD livo;t  2toxopiudal  lfvsas srtmu  ;u0tltomfciyd a elump () rxomr3tydfmteaneo;t)t2umxopno1lmtn fetlt)sDrrx o;u1ole  ictldlm2ua(vpnt0trtomf3tatopD aueo;t0srtoxo3iu1op n fvt (f Draxr ;t4apxoifcild m2rm(vs;u4aexoircoytlpDr ivilt)trurimpoodopen fctasfs2ua(ronu1oltnmfeiys s ean p;u) rxnifctydopt lieols srtrimpou4ome mncsa(fsDumu o;u1oexo icilsla eanvsnt4 renxf3oydopD luvils trxmiopoydoptn ivs sfaDuax poo4tpx mo3tldfmDeaumo;u)trxnifciatfatelivs;t s2um(mpio1al emfcia(  rurum nu0aex moeiytfs elump;t4altnxo tadomtranes s0t2toio oodope lnvtatf 2ta(r nu1tpeo fcilslmDel(ms;(4artrxfciodomtrlivilt0trxrirpou4alenlnvsa(  rumx ooo4olxnmoeiytla emn onu4tetoxr iotoa e ueilt  eumxopiydalt licils)aDuax o;o0openmoetldfs ulnms u0areriocta1fmDr nvs;t s2umimpio1ol  mfvsat)srraxro;u4olenioeiytfsDrau pnu4aeenmr tytla eauvils  2xoirpiudlpeemivtlt sDtmxmpoo1altnmieiad aDeln s (4 reoxociodfp eln s () exoio oy4lp  lfcilsfarraxrpnu1apxomf3ils a2el( pnt0 rxoifcia1lp  au ols)t2tmir3nudll  lnctlsfaDrmxmo;o4opxnmi3tldla uaums (4arxnxrcoatfmDeaieol(0texo(rpio1lp nmfci s srua(mont1oee  ieiltfs2ulnvsnu4tltnxo tatoaD aues t0texrio3io4aleelncsl() Dtaxrono0oexo o3ild a uaump;u4aeeomoctotfate uvo;s  etmio3nodoltnlivsa(fa2rrurpnu4tpto iciytfa2umuvpn(4aexoir oytlp  lnvils  2xmim3ny4amt mnvta( s2rmxroot4tlx ifeilsfm2rmnvo t4tltnir3ootlmDeaies (0s2umio3nodomtelfeiatfarurxmpoo4aptn feiatls uau p;t)teenio totla   ivs;(  2umio iydlmtemfvilt  2rmxm no4opto i3tyd m2emuvs t0alxomo oytlaDr nvslt  eum(m nu4op nlfvs s arraxmono1aptn o3ias s umu p u) exnxoctotopt aueo;s srxrim iy1ole lnci s)srua(rono4tptniietydfaDrm( o;t4texrif3ty1lp eanvsls0srxm(m ou4ll n feta(fsrtaxrp;t0aexn fciltfa ea(mp t4 exnmr3tytfpteanvslt)teum(r io1ape mfvsasfsrur(m ;u0opt  f3tyd mDul(mp;u0areriociatomt ai i;t srtm(r iy1lmee nviltfaDur(r oo4ope  i3tld m rlu s;u0aetrmrcto1om eli i;s)s2xr(r3oudolee fei ()srrr(  nu0aexomiciydfs umn p;u)trtoxfcta1oaDraueo ()s2uoxm3iydlm nlnvslt  rtrum ot0alto feiad m eaump;u0aexrirciodlate ivi (0 rtr(r3no1al nlietl() Duax o;o1aex mfciyt a rlnvs;t4arxniociotoa  ai i t  2ur(o no1opeelfctlt aDurxrono1aptomocilslm2um(vo;t0altriocta1faD ai o (0tetr(o iodamee icsa(  2tmumpnt0tlxoioetadfs ea(ms (4altoif3oytoateln o (0texrim iu1lmenmnct t a2trumo;t4apto oetatfa2emnmpnt0aetoxo totop rln s t s2tr(m nodalenlfct sf 2taxmont4olenmfeiyt aDumums;t)aetrxfcoa1opteaneil() etr(r iudamt lfctat)sDtaxm oo1oexomo3tld a2um(mpnu4tltrif oa1opD ai s;t) exmxmpou1lm n ivt s a2raxr ;o4tee  feiytlm2ua(ms (0arerxrctadlp elivo;t trxoxm3ny1ap n ict (fartrxmpno1aeen fetysla raumo;t4trtrxf3oydlp  au o t0 2um(mpno4al n ivsl(farumx  oo0tlt mo3iyt m em(vo (0teerxoctytfpt auvi;t0 eto(rpio1lm   ieil(f Dra(rp;t0alen icilslmDrau o (0artnir3iodfp  anvol()t2xmxm oudlp elietls)aDtauro;o0teeoifctyd s2rl(msnt0 rtrxfctotoa  ln ils0 2trio3nudapeelfvi sfsDuaxmpno4teto fciatla emuvpnt4 etnircoo1laDrlu s ( srtr(r3nydopte iviasfsDuauroou4tpeo oetatlm rl(vsnu)tlxoirciotfmt lu s ()srxrxo3ou4lptn fesl(fs2trxmoot0aexo feiytfa2em( s;u) exomfcto1omD li i t)s2toir3iydapeelicslt s2ta(mo;u1texniieilt a umums;(0alermr3iytoa e i o s srtrxrpoo1olenmfvslsfa2um(roou1alxo fetat a uanmp ()altoxo3tadfa elu i t)setmimpou4llt mnvias)s2rru o;u0tlx  o3iasfa2ulnmon(0 lxrio iodfateaivo s s2tm(o3nu1lm emfesat) rrmu pou0aeeniictat a emn s t0tlenxf iy1oa rlnvslt s2xmirpnodlptn neils)srtaur ;t4tlt  ieiyslaDul(mo (4trtnir3io1fpDeaueol()setmiopiu1apt  icsltfs2ra(roou4oeeo ieiydlaDrau pn(0texnxr3oydfaD lies;s)teum(r3no1lltn fesat) rrm(  nu4apen ieiatls umump;(0 eeoxf to1opt  nvo;t)s2tmxrpny4al nmnvsls arurx  nu1aeeo ieiytls2rlu sn(0artnmo3iadfa   i slt0texrxmpnu4llt mneiasfa2trxmooo0opt  ictat a2uln p u0alxrmo3iatlaDeanvi t0trumir3ou1lptn nes t)s2tru pno4apxnii3tat aDrl(vp t)tetrif3ia1lp eaueols)t2toxm iu1om  micil()aDtmu p;t1texnioctytls uau s t4 rxoxo3iytlpDelieo;(0 eum(opiy1ap nlnvtltfsrtmxrpnu1tpxn feiatfmDemuvs t)trtrxf tatfm rlivs;s0srxo(m nu1om n nesls)aDtm(m ot0tpenmf3ild a um( p t0 lxrmo3todfmDranvs;t teuoio3oy4ll n icia()aDuax oou4ape mi3iyslm2emuvont0 rerxfcoytomD  n i ( tetmim no1ap nlieil(  Duau pot4ale io3iltls2ean o u4aeenirctotfp e uvs t)s2trir iudame mfct tfs2umurono4apxoioeiltlaDeau s;t4arerxr ty1fmD  n il()texr(o iy1lp eliviasfs2ur( p;t0openmoeias a2rmnvsn(0 etnmr3iadlpDrlu i;s0t2tmxmpiudomenlnctas aDur(rp;u0oeeoioeilt m eln o;u4 lenxf3ootoat ln o s0t2toxopny4lmt lfciat s2raum ou1tlxnmoctytfs ean snu)aeerio3todfaDeli o s0sexr(opnu4amteliet s s2rr(r nu4alx mietadlm2uln on()arxomfciatop rlneol(0trxm(m ny4ll n nvtl(faDtm( pnu0apeomo3iatfs2um( p;(4aeenmf3oatfmD  uvo t)trur(m3iu4optnmnesas  Drr(mp;t1aeeo ieild m2um(vsnt)tltnmoctytfmt lueo;t  eumxrpno1lptnlfcsltf Drmxr ou4tltomiciadfaDuaump;() leoxocio1fmDeluvsls0 2xrxopiudlleelicias)s2rruro;t1alxomf3ildfsDumu p t4trtnif3oodfatr nvo;()teurxopnydom   ivtat s2uaurpnu1tetnmfetlt s2emnmp;t0 ltrmr to1oa rln sl(0texoxrpiydalen nei sf rur(  nu1opxnmi3tasls elu s;(0aexomr3oatfaD anei ( truo(rpou1aptemnesa()a2uax o;t0tlt  ieiltfmDua( pnt) eerif3ootoptrlneo t srumxm3oodop elivi s)aDta(m nt1ale ii3iadlm2ra(vsnu0arxrmr3tytop rau il(0s2tr(m nu4openlnctls sDtrxmpou4oeen i3iasls elumpnt4arxrmf3oydfm eaieo s)t2urxm3oy1aptnmnvil() 2um(moou4optn fciydla emn p (4arxrio io1omD au o;t)texrxr nu1ape lnct t aDta(m nt1apen i3iltlmDrauvpn()aeenio oatfaD lu i;t)srurxopiu1llt  fvtas sDtaxro;u0tetoifeiatlsDelump;(0tlerxr totopD luvs;s0s2xrxr3oy1lle lfcsasfa2ta( pnu0oexn fciadfsDumnvo;t0 rxnxocoo1laDe u i;t0s2tmxm ny1lmen nvt s  Dtrxrono0tleomf3ild a ranmsn() rtoxo todfm   uei (0 rxoim no1om e fvilt)srraur oo1ole if3iasfs2um( pn(0aetnifcoydopD aneilt) etrio nu4ll   iet s  Dra(mpou0aexoio3tltfa2eauvo;u0 leomf3oa1fm r i i;t0s2urim nudopt mfcs tfa2tr( o;o4opx  octaslsDua( pnu0tlenmr tadomtraivo;t0 eumir3iydoptnmfvi ()a2um(r ot4olxomoeiyt sDum(vp u0 leoxr iodfatranvi;s0 rxr(o3no1aptnmnvs t s2tax p;u1teen o3iyd m rlumsnt4aleomf oatlpD liei t srtr(mpny1lltnmneta( s2taurpnu4oexn fctadlaDeaumonu0trenir iotomteli sl( sruriopiy4am elfvia(fs2umxmpoo1tet  f3iys s2rm(vp t4aeeoxr3ty1lpt anei s trum(o oy1alt mnes s  2rr(m nu1aptnmi3iatfmDuan ont)trtrio3tytomDe nvo ()s2xoxr nudomtn nesltfs2um(mont1oltnmociatfsDel(vsnt0trtrmrciadlat  i sls0srurxo oo4llenliesas) rrmu oot4tpx ifeiasfa rmu p;(4arerxrciotoaDe uvo s s2urimpoudome  feiltfa2um(mo;t0olto iciytfm elu s ()alxrmf oy1fa   nvo s t2xrxr3oy1om emneias)a2rmx pot1apt if3tadlm2el( pn(0 exnmf3tytfmD an s;t0t2umxr3iydol  mivtl(fa2tax  no4apx  fetadla rmnmsnt4tetnmo3iydlatr i i;s)trxmxm nudlm emicilt)a2um(r ;o4aeen o3iysla2elu sn(4 renirciytoatr neo;s)srtm(mpiudalenmivsat)s2trx pno0opxnio3iysfa ea(mo u4alxoir iatfa elivs;(  etoim3oy1ol  miviltf 2raumpnu4oexoifetadla2umnvo ()trxrif3iodlpteln sls  2tm(m oydlpt  nvtat  rtm(r ;t4oexoifcildfs2rluvp;u) rtrxo iadlaDrli s;(0 etr(o nydalenlies sfsDraxmo;t4tlxniictys aDemump;u0 leomrctadomtr u il()s2toxopno1om emfvsls a2umur ou4aex ioctydla2ran sn(4 lenmrciodfp  livs;s)s2urio3iodom elivtl() rtru  oo0alen f3ilt mDranvpnt4 eermfcoodlat  ies t)trxrim3ny4lme micslsf rrru p;u4aeenmo3tyd aDrauvpnt)aeenxf3iodlm eaueo;( srumxo3iy1omt licils)srua(  nt0tltn o3ildlm uanmo;u0artnxr3to1fmD lies ( teurio3oydll nmfcia() Drau oou1tltnii3tat m rlnvo t)tetrmrctotom  auei ()trtr(m nodamt lfvsa(  rtrump;o1alxn fctls a2rauvp u4artrmr3tatlmDeln o;()t2xrxo3no1alt lics s)arta(mp;o1tltoiociytlaDrm(vp u4arenxf to1lptrlnei;(  rxmir oo4opt mfvt t  Dta(moot1apx moeiad m em( sn()trermf tydlpD lneo s)t2xoim iu4lmte ici () rtm(m oo4tetnif3tat sDeanms;t4tltrmo3iatfmteluvils)teuo(r3oy4lmenmneils)artrumpnu1texoio3iydfa2eanms;u) lxrifctytfaD ai olt) rto(r3iu4lltelictlt  Drr( p;o4aetnmf3iyd sDea(monu4trxnio iydlmD an sls seum(r3nodaltelnct sfa2umumpnu4oee mi3iytlsDea(vs u0tetnircoo1fmte neo t) eurxr oy1lmtnmictatf Dtrxr oo4openiiciydfaDraums ()alxnxr3ta1oaD ln s s  rumim iy4lmenmiciltfsrtrurpnu0oee iieiltfsDrlnmsnu)arxnircty1fptelnesl(0 2urirpny4open ncs s a2raxmont1oleomo3tasfa2uln sn(0texrxrctadla eln s (0 rtmxr oydapt  netat artru pnu0alxomf3iadfs ean o;u)aexrio iodfmte u i t  2xrxmpnu1omt mivslt)sDurumont1tptnmociydfm2rauvpnt0 rxnir iytla  an s t0srxrxr3iu1om e fvt (  Dtau pou1oltomociyt a2el(monu0 eenmrciadfmtr nvi;t) eur(r ou1ap nlnesl()srrrxmooo1optn fetlslsDrmnvp t4arxnmf3ia1fmtean sls0seuoir3no4ll nlicsl()aruau oot4tee ifeiltlm elnms t0 ltnxrciatfmte ivs;t)s2toxo iydlp nlnvsl( sDraxrpno4oexniietytls uan p u4 lxomfctodlpteli slt0srxmxo3oydlpen ictls)a2rr(rp;t0tltnii3iatfaDrau o t0 eeoxocta1lpDe ues;(0srtrirpnu1lp elnesatfsDtr(rpoo4tptnioeiatla2rm(msnu0aeenmr oo1oaD auvs;s0 etrxr3nodaptn fvt tf Drmxr nt4tptomiciys aDemuvs;u) rerxf3iotlmteau o;() exrxo3oo4lpeelieilsfaDrmu p;t4tet ifeiydfmDum( snu0aeeoir3todoaD anei;s0s2tmxrpiu4openmnvtatfsDumu o;o4teen i3tyd mDrmu ont4alxoxo3totfpDr nvo;()s2trxr oodole  fviltf rumx oou0tpenifeias s2umuvo t) rerxo3ia1lmDr n sl()setmxm no1ameemies sf 2uaxrp;o1tee iieiyd s umn p ()aetrir iodop  ln o (0trxoxmpoo1lp n fesat srtmxrp;o1aetniictyt sDuan p;(4alxnifcoydlpteai s s) exoxm3io4lptnlnviat s2umxm nu0tpen feildfs umuvo u0tlenmf3oadopD lneslt)setmxo3oy4am emivsl()arur(m ;o0opx mociasfs elnvo;(0altrxf3tatopD au s;( setmim3oy1apte nvilsfsrtmxm no1ale  fciltlm uluvo t4altrmrctytfm  auei;t0 exr(r iu1op e nesa()arurxroot0altniieiytfaDeln o;(0 lxrxfcto1faDrlu ilt0srtmxr oodll elnvsls  Duaur nu0opxnmietytls2rmu pn() rtrifctadlp rlnei ()truoxm oo4al  mnvta(f rta(rpnu0tlx moctydfs2ea(vo;u)aexomf3totfaDelivo t)srumxo oudlptnmivil( a2rmx p;u1oexoifeilsls em(vp;()tleoir3tatlaDrluvi s)s2xrxm3oy1lm nlncs t)srrm(moou0altomo3tytfaDuau pnt4treoif iy1faDeli o;s srumir oo4lme lneias  rrmu  oo4tetn iciyslm2rln pn() lxrir3ty1omtrli ol(  rtrim io1ll  mfes (  Duru ono0aeeoii3iadls2elnvo;u0texnif to1fmD aies;( srxrxmpoo1op elicia()a2trxmo;u4oetn fctatfa2ua( p;u0trxomo ty1la raivols)setrir3nodapte fes tfs2tm( pot0aptomieild s umumpn(4aetoxf todomDraies;( tetoim ny4ale lncsat)sDrru pno4opeomo3iyt a umnms;()aexomo iodlaDeluvs;s s2trxm3no1apte ictas  2rmx ont4tpt miciyt s2rmumpnt4aeenxo3iadoat  uvs;s0s2xm(o3ny4op  lfetlt a2rrurpnt0tlen fctyd a2rauvo;()alxnir3oydom  lu s s)seur(r nudaptn ieilsfsDra(  ;u4oetnmfciydlmDul(mp;u0aeermr iydfmD li i;s srtmxm3iudlme  fvia(  rtmu  no1olxo i3iat a2ra( s;u0 eerifciadfmDrau s;(0 eurxopnu4am e fesl( aDtmu pou0alenmicilslsDrlu p;()alxrxf3oytlpD  neo;(  2tmxr3nudlpe livtlt  rtmumooo1tet ioeiadfmDumu pnt0 rtoif ta1fpDe uei;() rtmxr io1ome  nesltfa2rrx o;o4oeenmo3ildls2eanvs;()areomrciy1fatraues;()texr(r3nudopen feiat arurxrono1oetoiociad aDrm(ms;u0texnmr3iodfm r n s (0tetoim iy1ale mfet ()srrm(r nt1apt  f3tysfsDrau sn(4 eeriocoytlateauvs;t0 exmxm iy1lle  ici t)s2um(mpot1tlx  ociatfm2ranmp;u)alenir3iadlmDrai sls)texrim3ny4om  mnct t aDuau  ;t1olxnmoeiatls2umu s;u)arerio ia1fmt  u il( t2tmirpny4apte nct ( a2tax  ot0texnif3iyt s2el(vo u0 ltnmrcta1faDelu s;t)teurxrpiodlpenlnvils)aDumump;u0tle iictlslm2umn snu4 ltrmr ootfpt  i il( setrio oo4om elieslt)s2tm(m ou4aleomfciat mDum( pnt0 lenxo3ootlm rlies;(  2xr(r3ny1lptn nvsltf Drru  ;u4oexnmociadla ua( p;t4artomf tadomDrlnei s)trurxrpny1amtelnci () Dur(mp;u4alen o3tadlm um( p;u0artnxoctadfmte n o;s)texrxrpny4ale mnviat a2um(root0olxniietld mDean o;t4altoir3oodopDrau sls0t2xmxm3oodlmtn fet t)aDtrxr nt0alx mf3ias m2el( o;(0tltoxrciotomte n ilt  etrxm3no4lm   iesls)sDuaxront0tpxnmoetls sDuln p t)tltnmfciydopD an ols0s2trxr3oydolee fes (  Durumpnu1tpeomoctld sDemumo;u0 rerxf iotlp eaneol(  rtmxrpiu1op n ivs ()arrr( pou4tex mociysfsDum(mo;(4 etoio todlpt aivil()t2trxm oudopeelfcs (  rtmumpnt4ole iieiys sDrau sn(4trxoir iy1la eli ils0srtoir3io4llt lfet (fsDumumonu1optoio3tyt mDran s t0 ltrio3iy1optr u o t  2toirpny4lmt micta( srrruroou1opt ii3tls a2rmnmp t)arxnircoo1omtrli i;s0sexmir ou1am nmnviat  rtax ooo4tlen ieildla2rauvo t) rxoxr3ootfmDeauvols0texrimpou1lmte fvt (fs2tau pou1aetomi3tydfmDrln s;u0 etnirciydlaD  ueil(0teurimpou4al n neiatfs2rrurooo1tleomociyslmDea(von()artrxrctadfat lueo;() 2trxo io1lm nlfvi tfaDua(m ou0tpenmi3iadfm rl(vpnt) rxoxrcoatlp raueilt0s2xo(r oy1ap emivtatf rrmuro;t0optnioeilt m ean s t)aetrirciotop eau o s0sexrim nodlp emfcs tfartr(rpnu1aexnifctls a ulumpnu)aexrmocoytopDr i o;(0trumxrpou1ol e feias)arrauroou4oex micilsfs ra( o;(4treoiocoatomDeaues ( seurir no1lpte fvia(faDumxm nu0oexo i3iytlaDua( s t4tetrmr3todop  aies t) rxmio no4lpeemieiat aDurxmo;t0opx io3iyd sDeluvpnu)texnifcty1fatrlnvo;s  rtrio3ou4ome  ivt t srrmurpnt0tetn oetaslsDem(vp u)aeenxrctytfpDrauei () rxmiopnu1lptnlnvilsfsDrrxm nt4olenmfctyslsDrln s;t4aetnirciy1lm   ueo;() ruo(o oo1lltemfcias srrrx poo0tlenmocilsfaDul(vp;(4 renxr3io1oatrluvolt0teurxrpiudap elfvil(f 2tr(  ;t1ape ii3ias sDrl(mont0 rtnmrcoy1lp eanei () rtoim iy4opt mivslt) rtmu  nt1oexnifciatfaDrm(vo (4teenio ta1oa  livsls0 2to(mpoydomenlieilsfsrtmu pno4tetnmociydls2ulu pn()alxrmfcoy1late ivi;( seuoim3nudlmen nvi t aDtrumoou4olen icilt s eanvp (0artnmf oodomDrauvol( texoir iy1llt  fci s a2ur(m ;t0apto o3iltla eau on(4aeeoxo oodopt  nvolt0 eto(mpoo4olenlici sfsDtrxmono0olt mieilt m ran s u4tlxrirciy1lmD anvi;()texmirpoydol  mnet sf Dumxrpnt4optniiciyd s rl(mp;t) renmr ootfa eln s;s t2xo(m3no4op elfvt tfa2tmumpoo0opx  oetydlsDul( s;t) exnxocoy1fatrlu ols trumir3nu1amtn nctlt a2taurooo4alto ieias s2uluvo u)arxrmf3todom  livi;t)setrxmpoydape licslt a2rm(  nt4oexomoeiys a2ul( pnu4 eerxo3iodopD au s;t)sexrio oo1lleelnei (fsrta(rpoo1oltnmieiytfm2uauvp;()teenmf3oo1lmtr ivo t)seuoxr ny1omen iei ( a2uaumpnt0ole mfetatfa2rlump;t0tlerioctydom rlieol( t2xrxm3ou4amee fctas a2tru oot0tpe moeiltfmDelums (4trtnxrciadoa  li i;t) 2to(mpnudop n ncilt s2tm(r no0aeto feiytlmDrmnmsn(4treomf tytlmDeaueilt  exrxrpiydamtnmfcsls a2tmx  ou4ole ifeild mDean sn()tetnxf tadfmtelnes t0s2xo(m oudlme lfvtat  2rmxm oo0oltoio3tydlm ulu p (0tltrmo ta1oateai olt  rurxo oydom nlfvtl(f Drr(roou1tlxoifciatla rlnvp (0 etomf iodopDe ueol()texrxmpoo4lle micsl() 2urx  ou4teto ocildla ulu s;t0aeenxfcoodfmD liei s0 eumimpiydom e nct s  2ururo;t1olx iocild s ulu sn() reomocoa1lpDr n o;s)t2uoxm3no1alte nvtlsfsDtru  ot1alxo ieilslm rl(mpn() ltoifctatop eaueo;( tetrxm iodll n ncil(fs2ua(rp;u0opx mociytfaDrauvpnt)artnxocoytfm eai sl(0 2urxr3nodal n fetatfa2raurono1tlt mieiys a2rluvp u0aexnifcto1la   uvslt0 rurxr3io1am  mivs (fsDur(r no4tlxn icilt a2el(mpnt4texrmfciotlpD lues;s s2xmirpny1llenlfct ()s2uru poo0tetnmoctas a emuvpnu0alerircoatop r n i ()s2toim3oudlp nlivsa() 2tr(mpnu4aexoii3iat mDrmnmpnt) ltrio3totomDrli s (0tetm(opno4lptnmfvia(f 2rm( ont1opxnmietys s rmnvon(0tlermr3totla  anvi;s seuoxrpnu4lltn netl(fsrum(mo;t1aexomf3tltla2elnmsnt)tltoxfcoytoptran sl()tetmir iudaptnlnet s)arrr(mo;u0opxnmictat mDeluvo u0 etnmr3io1lateauvols)tetm(m io1amt lfct t aDtmx  no0tptn oeiltls2eanvo u) rtnio ta1oat  uvo;t) 2umirpio4lpeelneilsf 2rmu o;o1olt moeils sDum(mp;t)arxrir oa1lm rau s ( setmxmpiudamtemnvtasfs2tax pnt1tlx ifctas sDuln p t4 exrmociydlp ean o s0 etm(m3iy4amee net tfaDrr(ro;t0tpx  ictyslm2em( o;u0 rtrxocty1oa  ai il( teur(o oy1lmenlfctat)a2um(monu1oexn feilsfmDran pnu4 ltnmrcoytfp ran slt0teto(m3oodamtelfcsat s2tmxrpot0openiieildfm2ua( ont)arxoio3iytop elnvs (0trurxm oodopen fvslsf 2uaump;u1teeoiictld aDra(vo (4altoioctodfmteaies ( setoiopoy4am emictls artrxm ;t4oet mfciat a2umnmpnu4teeoifcoa1fpDraivsl(0t2xrxrpny1lp nlfvia(fa2rr(moot0tltnmfciltla2ea(vp u0 reoxociodfp  luvil(  rtm(mpiu1ol  lnvtas s2umxr ;t4tle iietadfmDua(mp t)alenir ia1oa e u slt)s2umim3nu1lp n feia( srtaurp;o4apxn feiadfa rm(mont0treomo3iodfaDelieil(0teuoio nudapeelnetl( aDtmurpnt4olto feiysfm2rl(mo;(0tlerxo to1fp  livi;s)t2umim3oudop   nvtl(f rurur ou4aeenio3ias mDrmuvp t0aexoirctytlmD  ivs s) 2xmim3oo1op  mnet t arrru  ot4tlt m
\ No newline at end of file
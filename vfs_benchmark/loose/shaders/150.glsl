@@ -0,0 +1 @@
+u olt  etrimpou4lm elnvsl(  rraxmoot1optomo3iysfs ea(vo u)trxnmfcto1la rli o t0 rtoir oudlmtnlfes () 2tmxm oo0tle  f3iyt aDulnvo t4tltoirctytfpteauvsls srxrim oy1aptnlnvs t)aDtrx pot4tlto ociltfaDuanmon() exnxo3oa1fpt au o t0trum(r nydale  fcta() Dtmx  ;u0ope mi3iasls rmuvs ()arermf3totoptr uvs t)sexrxrpiu1apt  nvia(f 2rr( onu1olt  feilsls2rl( o (0tetrxr3iadfaDrau ols0s2trir nodomte iviasfarraxmoot4opeoifetytfa2el(vsnu0aleoxfciydlp elueols srxoiopoodopt  fvtltf Dtm(m ou0aetomfciydfmDuanmpn()arermfcty1fmtr n slt)trtrxr nydlpen fcslt)arta(mpnu0alxo fcilslm2ul(ms;t0teerio3ty1oa  li s;s)sruoxm nu4ameemnesa() 2umur ;u1olxnii3ilt m eaumsn(0tlxnxr3ia1fm eliei s0 exrxr3ou4lm e iet t) Dtm(mp;t4optn ictatfsDrm(vs;(0arxoir3iadfmtrlu ol( sexm(r3ny1lm elnctat)a2um(mono1aetomietyd aDuau sn(4trtomoctodopDrlnvi t srtoir3oudopee nci tfsDrmur ;o0opt mfeiyslaDrmnvs t4aeerxr3ootfa elivs s) rxo(o3iy1amtemics tfa2trx o;o4tet  oeilslmDum( o (0 eeomr3iydfp  ai i;(0t2toiopno1altelivtlt) rtm(r no1ale iociad m uan o u0 lxnmrcoydlaDrlnvi;(  2umxopoodlpenlnctltf Duaum no1aex  f3iadfsDuaump;u0 ltnxo3oydlm   u s t srumxr iydolenlivsasf 2tru p;t0olt  ictat s2rmn s t4aeerio3oodoaDeauvols s2trir3ou1amte fvi tfaDraur ;u4tpx  fciydla ra( pnu0trerir iotlpt anvs ()setrxrpiydom nlfviltfaDtmxmpou0oex  ietadls ranmo;()trenmo3iy1oa r i i;s s2tmim3iodol nlncils s2uaxroot4aexnmi3tldlaDumnvp;t4 etrmf3oodomDr neilt)trtm(o3oy4alenmfet t)arua(mpou0ape ioctls m um(vs u4teerxr3oy1oa  au i s)sexmxo3nydamt  fvt ()srta(m ;o4oexniicildlm ra(vpnu4artrifciatlaD an slt srumir nu4ap   nvs () Dtm(m ot4apen fcildls rln p (0arxomr iatlm  an s;s0seuo(opio4open ivsat  Dtrx p;o0olxomoctatfmDem(vs;()tlerxo3oodoatelues t0 eurxr3no4al emfcslt srrru  ou0olx mictad m2eanvont)trxnmr3oadfa ean slt)tetoxmpno1ope lnvi ()srtmumo;o1aex mociatfmDrl(mo (4 eerio3totop   nvil()sexrirpoy1omtnmfei tfaDrax  ;u4opxnmi3tatlmDrmums;t)teenxr todom  an s t0t2xmir iodap   netls)s2umum nt1apto oeildfs uan ont4 lxnir iy1lp  lnvsl(0s2xmimpiu4ap e nct t)s2uaxrpnt4apt iietld a2umuvs;u)teeoxr ootlmDran s;t0 rto(r3nu4alen icsat aDtrx p;t4olen f3iltlmDra( sn()aexrifctadlatrlu ols)s2um(m3nudop elfesas)srta(r ;o0oltoiociadlmDrmuvpnu)trxnif oatoa eaivils) rtr(rpoy4ap emici t  rtmu  no4tee if3tadls2elumon(0tetrmo tytfmD  i sls0teto(r no4openmncs s  2uaum ;o0optnii3tatfmDuanvont0artrxo3ia1opDelnvi;t)texrxo nydomen iesasf 2taumo;t0apenifetltfsDelums ()tlxrircoatoaDelu slt srumxo ny1lm emnct t s2rrx o;o1oleo oeiatfm2uln on(0arenmoctotlmDrau s ( s2xrxo iodome lnei s sruaumpot0tlxn iciysls rmn p t4arxnmr tytopt lnvs;(0srxmim iudam  mnei s artaxrpoo4tptoiiciyt s2uan snu4trtoir3iodfm   uvi t)s2xm(r nudll nmfvs (f rrru pou0ape  oeiatfa uauvs;t0tlxomociatla  aivo s0 etoirpnydolte iesl() 2rax o;o4tltoio3ilslmDelumo;u0texrif oodlm  lnes ()srumxm3oo1amtnlieia( sDraum ;u1aex  fctatlm2rl( s t)texnmocty1laD  ues;s)setmiopnu4lp nmfcilt) rtm(  ;u0tpe moeiat sDrauvs u4artnxr ootoptelu i s0sexr(o oudomee neslt  rrmxrpnu1aee iieiytfs2ra( s u0 rxomr3tydom r ivo;t tetoim3ou4ol e fvi t)a2trurp;o1oeenmoeils sDuauvs t) rxnmf oo1fmDrlnes;s  rxo(o3iu4ale licsl( a2ua(ront4apt mociad sDum(vs (0 etoiocoadopt aueo;() 2toxr oy1ale mfct (fs2rrur nt1alt mieiyt aDumnmo;u) leomrcty1lm   n olt)srxrxr nu1opt mfvta( srrmur ;o0olx  fciyt m2uaumpnt4artrir3oydfpD  ueilt0 euoio3no4lpeelfviltf rrmxrpnu0oeenifciysla2uau s;()teeoxocootlmteluvs;s sexo(o nydoltelnetl(fs2taxrp;u0oex ii3iyd aDraump (0 eermoctotlmt  u o;(0teum(o nudome lneil(fartrxmo;t1oetoiicildlm2ua(mont) rtnxf3iydlatr i sl() rxr(opoy1ol  mivia()artmu pno1tpxnmictyd s eln onu4 rxnirciadfmtranvols0trxoio3oy4lmt  ivtlsf Draumono4olt iicils s emnmp;()aeeoxo ty1lpte nesl() exm(opiodll e fvsas)aDtru  oo4aeeomoeiatla2em( p;(4arxrir3oo1omtelneo ()seurxmpoodom e nvi (f 2rrxrpno1oltomfcias mDra(ms;()arxrmo totfpDe i olt0 rtm(opoy1ope lnei tfs2trxroot1aleniieiatls rauvpnt0altnmf3tydfa e uvi s0 2xoir3iudol  lnci t sruax ont0tptoiieiaslsDeanmp;(0 eenmf3to1lmDe u i s trumxopoo4llt lictl(  Dum( p;o4ole  f3iydfm rlu s;()trerifciotfmt  n s;s s2xoxm iy1alenmnvi s)a2ra(rpoo4alt moeiyd s ra(mo (4aetoxf3ia1fpDraivil(0trtmim3iy4ap   ivtltfaDrm(rpnt4oet  oetysfa2emn o;() renmfctodoaDe ivi;()srxmimpoodope lnesatfs2tr(ro;u0tetnmf3iyslm2em(vo;u0 ltrmr3iy1faDrln i t0tetm(opnodam nlnvsl( a2tax p;o4apenmi3iatfs ean pn(0texnmr oydfmtrai s t s2xmim3iy4ll n fcil(fa2ur(mo;u1alenmi3tytfaDrmnvs u) leomf3tytlm r ieslt srxr(rpno4lpenmnviltfsrrr(  ot0ole  octasla rau o (4aetnxf ootlatraneols seur(r3iu4lmt  fvtlsf Dtr(  nt4tpto ictlsfs2elnmo u0tltomoctytom  anvo;s s2tr(r3io4op nlnvsl()s2tau  ou0altn o3ildfaDra(ms u)tlxnifcoadopDr ivi;( trumxm nudameemfvs t) 2raxmpoo0olx ioetlsfa ul( o;u4treoxfcoo1omD liesls seuo(opnu4apenmnvi t)s2taxrp;o1altn feiltlsDemnvp (4 rxoxo3to1latr neo (  2tm(o oy1ap emfeta(fsDtr(r ;t4oexoifcils a ra(msnt)aeerirctodom  livs ( trxmiopou4amtemfes s)a2taumooo1aeenmo3tys s2rm(mp u0 etrxfciodlate nvols0seumxopou1omen fesas) Dtau  ;o0aetomoeiytlsDumumo;u0aeerio ia1fmte nvils)teurimpoudlpe lnvtlsf Durxr nu0ape  oeiydfs rmuvonu0altoxf3tytlpDrai i ()srtmxopnu1lme  icias) 2taxmpot4apeomfeilt m rluvs t0 ltoxr3iydlat ln i s) rto(o3iodlm nmncsl()sruaur ;t0aeto i3ilsfs rmnvsnu)tlenircto1omD lnvi;t)tetrim iodoptnmfetatf 2rm(rpoo1aleoifetld aDrmnmsn(0 lxnmrciotlm  aivs;(  rxmimpnodape liciat) Dtmx pnt4apt  o3tytlmDelnms;()artnmf3ta1lmt  uvi;t trum(r3iy4alee icilt)aDrau p;o1opxoiiciadlm2rau s t4tlxoxrcty1lpDelnes;t) rurim no1ape mivtls aDum(r ;u0altniocilsls2uaums;u)texoxocoy1omte iei s teuoim3oo4amtemivia( srum(r ot0oeto ictyd s em(mo;t)trxnmf3oadlaDrauvo (0tetrirpio1am nlnesl(  Dumurpoo4tex ifetysfs rlu snu0arermr ia1lmDe ieo;s) etm(mpio4lp nlict ( a2rau onu0tleomfeiatfsDemuvs;()aeenmf3iotfa ranes t0s2xmxm oy4lle mivtlt)aruaurpnu0apxn fciyt m2ulums;t4 exrmfcty1late ueolt trtr(m oo1lltnlnvtas)sruaxrpou0tee mi3iaslsDrm(mp;(4 rermo3iatfm   n slt0tetoim ou1altnliesl( s2uru p;t0tptniictlsfs2rl(ms;()arenxf oadfa elu o t0 2trir oudolte fvil()s2uax pnu1apxomi3iadla uaump (4alxnmo iodopD an i;() 2xoio3iudapee fei sfs2tru  ;t1opx mfcilt a2elu o;(4arxoxo3oatfpDeanvs;t0trumxo3ou4amtemfeilt) 2rm(mp;t4ale  ietyt m2eaump;(0 renmoctytlpD  ivol( sexrir oydaptnlfci s  rtr(rpno0oltoii3tat a uluvs;u)trxoir ta1om eanvo s) 2xoxm3ou1ll   ivtlt) rur( poo1olx micils a2raumo;u)altoxociodfmt ln i;s seuo(m oydll elivi (  Dumumo;t4apxoifeiltla umuvsn()trxomr3oatomt aueolt0trto(r ny4lptn fcsa( srumu  ;t4aexnioeiadls2rl(vo (0texoxrcta1fmD luvol(0t2tmxopnydaleemncils  rra(m nt0aleo i3iyslmDra(mpnt)tltnmo3totop  ai s;s  etmxo3nodll e ncs sf rrr(  nt4opt mo3ias aDrl(vs t4teeoxo iydomD lnvo;t0trtoxr3iydamenlfeils  Dta(rono1tpxo o3iatfaDrmnvo t0 leoir ty1opteauvil(0 2uoxm oydopte fvt s sDtr( p;t0ope ifetat mDrl(mo;t) lxrmo3ty1lm  lues ( s2xoxr ny4ape mfcta(faDtrurpnt4aetomoeiltfs uau onu0artrmo oydlpteaivils  etm(rpno1apt lncsasfs2rm(moou4apxn fciad m2eaumsnu4arenmf3to1oaD lneo () etmiopoudop nlnvtlsfa2um(mpno1tpt if3tadlmDumn s t) rtomf3iodopt auvo;s s2trim3nudlpteliciat)aDuru ooo1ope mo3ilslm em( p;(0texoir iatfpDraues t)srtoim3ou1omenmnct s) 2ta(mpnt0olx mi3iyt mDuan p (4 lenmo iatom e uvs;s) rxrir nydll n icta(f 2rm(rp;u0olen f3iltfm2ul( o u4altrmrciadfp  au i;t  etm(m3oydamee nvsltfsrtauroou1texo feiad mDulumsn()altrirctytfm eauvsl(  etoxr3iy4opeemnvsatf 2urxro;o1aetnio3iltfa uln s;u0aeeoxrctatlmD  ivo s  rtmxopnodom emncsas  2raurp;t0tlxoif3iydfs ran snt4 rtrxr tydfpt  i s;( truo(r3io4lleemieta( sDrrx  ot0apenmi3tys aDul(vo;u4aetnirciatfmDeau i;t)srumirpiy4om  liesasf 2umum ;u0tee  fetas mDul( pn()tlenxr3iodfateai i;( t2ur(o ny4lp n ics ()artmurpnu4oltn o3tadlm ranvp u4 reomr ta1oa e n o;( s2xm(r iodlmtnlictat  2uaxmp;o0tpx mietadlm uanms;t4 ltrmociadlm elueo;t  exmim nu1lpe lnetls  2trx ooo4aptnmiciyd m umu o;(4 ltrmf3tydfpDeauvolt0sexm(o3oudal nlncsas sDtm( poo1texnmieiltfmDel( o t)arxnif3ty1fatelueols trxoxr iu1ope  fetls  rum(  nu1opeoifetlt m2elnvs;t4 ltomrcto1oa eai i t0 2urxr3no1olenmieilt s2rm(ro;o4aee iiciatfa uanmpnu) exnxf totfmDe i ol() 2um(rpiy1lltnmivtlsfsDtmur ot1texomietldfs eau onu0alxoxo3totopt au o (0seuoxr ny1om e nvs s) 2taumoou4alx if3tlsfaDrmuvpn(0treomociatlmtrlivil(  rtm(r nudop elici ( srtrxmo;t4tpxo ociysfa2rl(vsnu4 ltomo iy1oa elivolt sruoxr ou4lle livilt s2rax ooo0oltomfcildla ulnmo;t) rxomrcoatlp r u o t0srtoxr iy4olen ivtasfaDra(mpou4oet  f3iad s2uluvont4aeeoiocoy1oa e neol(  eumxrpiu4omenlfci s sDum(  oo0tle mictyslm eln s;t)aexnmo3tatoaDrluei;t)t2xmimpoodllenmivs tfa2tmu pnt4oltnmieildfa2ulnmont4aeerxoctotop rau ols) rurxopou1lmtemietl() rtrump;u0tpxoifcild sDuanvp;u0alxnir3ia1lat  iei;t0 exo(opno4op nlneils) rrru  ;u4tltomo3iad a2rl(vs;u)tlxoiocoy1lp   i o t)seur(r3no1oltnmfvsl()sDtrur nu4tleo i3iydfa ean sn(0trxnmr3iytlmDraieo;t  rumxr3no1aptnmnct s  ruaxronu4opxn fetldfmDeau o;u4altrmo3iotlate iei;()texoimpnodamte ieslt s2uru  nu0apx ii3iat a eluvon(0altomfcoy1fmDrlu s ()srxrxopoy1lle lfeils)a2rrumpno1apenifetydfm2eaump;t)trenmfcto1lptranvo;t0tetoxrpoo1aleemict ()sDrmxrp;t1aet mfetatlmDemn o u)aexrmo3iodfaDr i il( s2uoxm no4amtelict t arrm(mpou1opxnio3tls sDelumont0aeeoio3totfpDrliesls0 rtrxopoodap elies t  Drmu ooo1tpen o3tytla2umums;u4 ltrxf3iydlpD aues ( teur(m nydlmenlivi ()sDtru p;u1openmictadlaDea( s;(4 rxrmr3ta1omte uvs s0s2xo(o ny4amte fvtas) rtauroot0tpt  ictldla2ra( pn(4 renifctadlat  ivs;t  2um(r3oy1lptnmnei ( srrmurpou1apen o3iytls2rlumo;t4alxnmfcoatfpDe nvi;()sruo(r oy1aleelnvtat s2urxr ot0tptnio3tytla2ulu o t)teeoxfciydomteanvsls0t2xrxr3oo1openmnvt t a2ur(r ou4alxomfciyt s rln o;t4 eeoioctodfm r uvol() exmxmpnu4lpe lfvtatf 2um(  ;t4apenioctls aDulu o;(0areoio iytoa  anesls)tetm(rpoydal  lfetlt)sDrmx p;t1ole moctat s2ul(vp u)trtomo3iytom e i o;t0s2umxo iy4lmen fes ( sDuax oou1aetoiietldlm rauvs t4aeenmf oydfmte ieo ()tetr(m oodlltn nei t  Durx o;o4tlxnmf3iydla2uluvsn()aeenmocta1opDr nvi s) 2xm(o ou1llenmfesas) Draum nu4apx  o3ilt s uanvon(4teeomr to1fa eluvs;s s2umio nodlmt lfct (fsDuaurpot1opt mfetadlm el( snu)altrxrcoytfmD auei;( srtmxr3oy4ale mfctlsf rur( o;t1aptnmieilsfa umuvs (4tltoxo iotfat luvi;(0 rxrirpnu4lm emfeilt  2raumoou4olx  iciltfsDuan ont)teerir iydfaD  nei;t)setr(o iy4lm  mnvs t)arra(mpoo1texoif3iyt sDua(vp;t)arxomfciatoa  li s;()srtrim oydape lneil( aDua(r ot4alt iieiydfa rlums t) rtomrcta1fmDr i i;(  exoim oydomen fcil(farrmur nu1tpeoiictldfaDrmn pnt)aetnmf3iy1fmDelnvols0tetmxmpoudlpen fcilt a2rmumono0olen ociatlmDemump u4altnifctodfptrlies;(  rxoiopoodoptnlncsa()arra(ro;u4tlen o3iysfa rmnmon(0arxoxocoy1fmDr ivi t0texrio3iydaleelfcs s) Dur(mont0aexoio3ilt mDumumpn() etomfciodop raiesls)texo(m3oo1ol nmfcias sDra(rpot1aee mociltls ran p u4 reomo3oadfaDeluvi s)srurir oo1omee fcia(  2tauront4oltoiociyd s rmuvsnt0trermf3totfpt au olt0t2xrxr3nodlme livi (fsDtru oot4aptniociyt mDum(vpn(4tlxoxo ootlpDrlivils0t2um(opny1ap nmfctl(  rtm( ono0ole mo3iytfsDelnvpnu)aeenmrctydom eaivsl(  eum(r oy1lp   ivta()arraur nu4oet  f3iydfmDrln snt)tlxrmocio1fa eluvols0t2urxm3iy4amtn ncsls)s2rm( pno1tetoiiciytfa ea(ms;t) etoxf tydfa  lueo;t trurxm nudllen fcslsfarumu oou4ole if3ilsfm2ra(vonu0alenxo3iytfmt  nvs;( tetmxm iu4op nmfvsa(faDua(mp;t0aptn f3iat s2uanvon(0tlxomf3oa1fmDr ues;t0t2xrimpiy1altn ncsatfarrau  ou0oexomfeilt m2el( p t)aeenircoytoaDr ieo;s teur(o ou1altn nct ()s2uaumonu1olxo o3tlt m ul( pn(0 lxomr oydfp r i i (  2xr(r3io1omte netls srrr(rooo0olxoifeiyt s2ea(vs;u4 lxnmfctytlmtraueils trxr(r3iy4ol  lieia()sDtaumono0olt mfctlt a rl(vp;u4alenifcoa1om  ai sls)setoiopiu4olt  fcia( sDra( pou1alx mfcias m2rm(mon(0teerxo totfmDeln o t  ruriopoo1omtnmics t)s2tmu  ou1oexomoeiydla2rln s;u4 etnmf3oa1op r u i;t)srur(m nodlpeemnetatfaDrmx  nt0tlt moeiyslmDelnvon() lenxr3iytlaDrlnei;() 2xm(o iudll  mivia()artaurp;o4tetn fetlsfmDrln ont4 renxf3ty1op elivol(0trumxr nu1lltnmfvt s artaxrooo0olxoiieias a uln pnu4texrmrcoydlmDrli slt0trtmxm oudolt lfvtl(fs2urx pno0oeenii3ilt mDrauvp;t)aexrmrcto1fmDrlnvi;() rtoio nodapt lnei s) 2trumpot1tee ii3tld mDua(vs;u4areomoctydfatr n s (0srtrxm3ou4ll   fctl(fa2ra(roou0tet mieiadfa2uaumo;t)tlxrmo oodlaD  u i t) 2umio no4aptelfeil(farur( o;u0apx mfciat m2rmums () reoxo3oo1omtr nvsls0trumirpnodom elnvt sfs2trx  nt1oexoioeildfs um(mpnt0 etnmf3oytfpDeaneilt seum(rpiy4lle  icia() rur(  ;o1tltn f3tytfa uanvonu)aeeomr3iydlm e u sl(0 2xrim no1amtnlnvt tf Drm(  no1tet ifciad aDuaumon(4aexoxr oy1lmDr nvo () 2trxopnudll   fvslt)srumumpnu4aet moetadlmDel( o;t4tlerxociotla e nvs;s seurxrpou4lpen fesatf 2uax  no4opxoii3tls a2rmnmsnu)aetrio oydlatrau ols0s2xo(o3no1ll nlfvs s)a2uau p;u0tlt ifcilsfs ua(vo;() leomocty1lpt  ies t)trum(o iodame  ivi () 2trurpno0tptnmo3iad m rmu snt0 etnir3iydoptr ivo t tetoxrpiy1ol emiciat aDrmu oou0tleoif3iyt m em(vpnt4 leomf tatlaDranvs t)s2to(rpiu1ope liviat)aDraxmont0alxo ietyt aDelumo;t4trxoxo3oytfp e uvi;( texr(m no4llt livia(fsrtrxronu0tlxo i3iatfm2ea( p (0teerxf oo1omt livs t)trtoxm oo1apeemnvsls)artaxrpnu1alxnmieiltfaDemuvonu4texnmrcoytomte nei;s0 etoxo3oo1lpen iesl(  rum(rpnt1oltomfctatlmDuaums;()texnifciodlmte n s;t0s2toir3ou4ol  lnvias)sDua( pot0ale  ociysla elu s (0 lenmf iydoaDe ueilt)tetmxopoodap  lici ()srraumoot1openioctydfsDrmuvo;(0 exrir3iadfp eau o ()s2xm(mpou1apte ivsa()s2ua(rpno4alxn feils aDrauvpn()aetnmf oydlmt aueils t2umxo3no1ll  liesl()s2uax ooo4ole  feiydlmDrl( o (0 rtrio3tytfptelivo ()tetmxr3iy1ameemfes t srtmumpnt0tet  f3iaslaDrmuvsnt)artnxocoy1fateau i t)setm(mpoy1ale  ictltf rraumo;o4oexnmfetydfs rln o t4aeerxr tydfmDr nvs s s2xrir3nu4lm emncsl(fa2tru pnt1openmi3tydlmDua(mp;t4tlxnmrciodfa  anei (0 exmxm3iudame  fvtas) Dur( pou1tleomfciydfa2elnmsnu0 lerxocia1op  luvs t0texoiopoy4am e ncilt a2tmur nu4teenifciltlm umums (4 eenmr3ta1fpD  neo (0 rtmxopiudop   ics (fa2ua(ro;o0oeenmfctadfaDrlnmo u)artnif iadfmteau s () rxrxm3nudope  ivsltfa2rmxmpno1texomoctltfa ra(vsnu4 renmf ootlmt  ivi;() rxoxo iudamtnmfcta(fsDumxr ;o0ape  icilslmDrmuvs u0 rxrir3oytoa  lnei ()seur(opiydlleelfes s srua(mp;o4apto fetatfa rmumpnt0tetrmr3iotopD lu i;s sexoir3oo4al e ieslt) Drmx  ot0aeeomfetas s2umnvp u0 lxrioctodfat lnes ()t2toxr3oy4olenmieia(fsrurumonu1olenmoetldls2emuvs ()altnmr3tatfa r ivi (0 rxoir3nodlm   fctl()sDua( pnt4altoiietadlsDum( s;(0 lxrxf tatoaD  iesls sexrxr3oy4olenlivslsf 2tmxrp;u0olx mfciasfa ea(mo;t4 lerxr oodlaD ai o;( srxmim oudlltnmncia(fsDua(rp;u0tet mf3tld mDrm( s;t4tlxoxocta1fm  au o;s0t2uoxm io4omtelivs s)srur( p;u0tetomoetlt aDelnvp;u4 exnxoctydlmDeauvo t)seur(mpoydlp n feilt  Drm(root1opxnifctltlsDea( sn(0 etomf3to1fm r i il(0sexm(mpiudlp nmivtasfaDra(rpou4oexo ictldlm ulnmo u4tlxoxf to1opDeanei;s0 eum(r oudam  lnvtls  2umu pno0apxoioeiasfsDemu p;(0 reoxrciytomtrau o;s0teumxm3no4oltelnet s)a2urxrp;o4olx io3ils mDrlnmp t4trtrif3oydoat  ueslt)srxmimpoy4lp n fvslt)arrm( oou0opxoif3tyslaDemn p u)aexrmf3oodop r n il() rxrxopio4ope liei (faDururooo4alt mieiltfm2ea(vp t4areoxo iatla eli i;(0t2toim3oo1lmtn ncs t)sDur( o;o1oetnmo3iasfa2rm( p;t4alxrirctatom e i ils) eur(opoudlpe lfesls arrmxrp;t0ole  ietls a eln o;u4trtnir3oa1omDe ivo;s0sexmir nodapee fes tfaDrrxroot1oltnmo3iasfmDua( sn(4tltomocoo1om  livilt) rxo(r oy4ap   ncslsfarrru oou0ole ii3iat s uanvp;()treoxf iatopD luvo t0 rxr(opny1op e iesltf Dtaumono0oexoiieiydls2rlnms u0aeenmfctytfa elivils  2xrxm3iydlmtnmfet (fsDrruroou4aexo i3ild m2uaump;u4 eenifctydfp   ivsl()srtm(mpoydome lfvtas)sDurur ;t4oeeoiietlslsDelnmo;u) renxo3oy1fp e uvolt sexoxm iu4lptelivi tf rrau poo0aleo iciadlaDea( p;t0 etnmfciatoateln ol()s2uoio iydlpt lfet sf Dumu poo0apxn o3ilt s uanmsn(4alerio tadoa eai o;s  etmio no4lp  lfct tfsDum( p;o0opeomieiasfm2ra( o;(4 etomr ia1fatr nvsl(0tetmxm oy4ol nmfcs s arurumpnt0optoifeilt s2umums;t0 lenif iadlat aueol()s2um(opoodapen netas) 2ra( o;o0aetnmi3iydlaDrmuvsnu0 etnmoctydfaD an s;s setrimpnu1ol  lnvtatfarra( pot4tpeomi3iatls2ea(von(0aeenmf3oytfp rau sl(  rtoimpoodom elnct s  2rax pnu4aetomiciydfsDrl( o;u) rtoxo iodfaDelueo ( teumimpio1aleemfeta(  Drmumpou1teenmietyd m ean o;u4texnio tatomDeaiei s t2xmxo ou4lptn nei (fa2uauro;t4oltn ieiydla2ua(vsnu4aetoir oydfm e i i s srurxrpou1omt mnei s  ruau oou0oet  i3tydfa2emump u0alxnif to1oa e ieils) rtr(opoydlltemnci t)aDurx  ou4aee  i3iasfaDelnmo;(4 rxrif ty1oa  livo ( srtoxo3io4ll elivtas) Duaurpot1alxn o3iys sDelu p;t)aexnxrctotlaD au i s0t2xmxm oodllt  ieiat a2uax pot4altn o3tad m2em( pnt4trenir iy1opD ai ils0 rtr(o3nudaltnmicsls)arurxro;o4ale mfeiltls2rln s;(0 rxrmfctodfat anvo;s  2toxo3no4lltn icilsfa2ua(rp;t4optnifciytlm emuvpnt0arxrio3tydopDrlnvi;s t2toxopoy1olt mivia()sDtrx  ot1oetn icilt m2ea( o;t0 etomr3ia1lmDrluvi;t)s2xm(opno1lmtnlfeslt)aDtaxmp;t4oltoioctyt mDumuvpnu4aeenxrcia1fmtr neil()t2xmir nu4ap   fcia()srururo;t0oee mfctatlm2ulu s;u) eerxociodfaDeli ol( srur(opiu1lpt lfcs tfaDumxroot0tlenmoeiys a ra( s;u0 exnmocty1oat liei;s)trxmxr3nu1omeemivil( arumumoot0oex  ociydlaDemnvpn(4aeeoxr3ta1oatr i i s)texoir3ny1lm nmfetat s2rau  no0tltomiciydlaDumnvo;u4trenxf3iadfateluvslt0s2xr(o ou4lmtelnct t) rtmxr ;o1tpe  ocias mDum( o;(4aeeoxfctodopteau ilt)trum(m nydomt livslt) rurxr oo4opt mi3ilsls2ranvonu0trxoio iodopt aies;() rxr(m oo1lp   iei sfsrra(r ;o0tlenio3iat a2ulnvonu0aexrmo tadlmtrli i t0teur(mpiu4opeelicslsfsrtmumont0olxn i3iltfa2uln snt4tlerxo3iatopDraueil()sexmirpiydal  mfcs s arrmxmono0teenmfeiytls rmu o (0alenir iatop eaneo s0tetoir3iu4optnlnvta( srtr( pnt0tlxnii3iysls eluvsnu0 exnxociadlpD  ieol()setm(m ny1ol nlfetlt)sDur( pno4oltomf3ias m uanvs;u)tleoxrciydlmDe ivs t0trtr(m3iudapenmnci t aDtmu ont1tpeo ieilt s2rau snt0aeermr tytfm  anvo t) rxm(r io4apeelici (f Dum( p;u4oltnmoeildlmDea(msnu4 ltrmf3oydlptrauvs ()truoimpno4oltn feias srrrxm nt4tptn f3ias m2eanmp;u) rtrxoctotlp eli ilt) ruoxo3ny4ol elfetl( srtaumo;u0tex ifetlsfs umumont)texnio3totlpDr n o;t t2tmirpio1optn ieias)s2uru pnu4apeomiciasfmDrmump;(4 renxr todoatraueol( srtoxrpnodll nmieiat)s2uau p;u4tee if3iyd m elumonu)aetoif3ia1fat aneilt  rurim3oy1lp elicilt s2rrxmpot0tpeoii3iyt aDuanvo;u) ltnmr oa1fpDe nvi s)trur(o3io4op nlfctatfs2umxrp;u1alxomicildla rlumo u0 rermo3ty1laDr ueo;()t2toxo oo4lp nlnvtas  rurxmp;u1oet  ictldls2ua(vs () rtniocoadfptr u il()trumxm ou1ll emiesat s2urxmpno4tlt  ociytls2uauvpnt) etrmocoadlmD  ueo;()trum(mpnydomt mieia(faDrmx ono4texnmfeiasls ra( p;t4tlxnxr ty1opD  neilt0teurxm3oy4op e fei ( artmxmoot1tpt miciytfmDelnmo;(0aeenir3iadlmDraieo s texr(o no1apte ivils)artrxm ;o4olt ifetlslsDumn s;(0 rtrifcio1oatr n o;t0texmxr nydalte ieilt s2rmxmont1tee mieils s umuvs (4 rxnxrcty1omt livi ()s2um(o oodlm  mncsl( aDtmxm ;t4opt iieiadlsDeau pnt4trtoxo3tydomt  ivi t sexoio io1lmt liviat)srrrxro;o0aptniietasfm2em( snu)trenio3oa1faDeli o;() etrirpoodapee fct t)a2tr(m no1tpt mietytfa emump;(4 ltnmf3ty1lmtrluei;(  etoio iu1op nlfvi s arurxm nu1apxomf3ildla rl( s (4 eenxf3oadop  livsls0s2xoxr no1ale licsas artaumoot1tpxn f3tytfs umuvs;(4treomr tatoatr nes s)texoirpnu1amt  feiatfarra(mpoo0tetnifctlt a2um(vo;t) leniocootlp rln i;s)srxrim nydlmtnlivi () 2um(roou1olx mf3tasfm2um(mp;u)altoif3iodfate ivsl( s2uo(opio1opt  feta( sDurxm nu1tpe if3iatls2ua(mp;(0 eenio3tatlpte uesl()s2xoirpou4llen fct ( arrr(rpot0oetn o3iysls2ra( s u0arxomo3iy1omtrlueslt0 2uoxrpiudaltelnvt s  Dtaxrpot1oex mieiadla2um(ms;u0 ltnio3oy1la eaieols0 2xmio3no1am  lfetl()sDtmx ont0ape moctlsls2elnmp (4tltnmr3iy1fat  ieo;( trtrim3oy1ol emfctls  Draumooo0ape ifctltlsDeluvp;u4alxoio oydomtrln sls srxmim no4lmtemivsltfa2tr(rpno1aetniieiytlsDul(mpnt0aleoxo tydomDe iei t0tetrirpio4lmt mnvilt  2uaumono0aetn ictldlmDumn o;(0artnmf3iytopte n s ()srxmxm3iodalt livs sfaDtaxmp;u0tlenioetadlmDulump t0 reomrcta1fmt  n i ()seumio io1lpt mnci s sDrmxrp;u1aleo feild aDrau p t0 ltnxoctydop eauvs;( s2toxrpiu4lleemnvsatfsDtrxmo;u1oex  o3iysfsDelumo;()tlermr3totlmDe nvo t0s2tmxr3iu1lm elfei s)a2ta(r oo4ape moeilsla2em(ms (4 etoif3iatfpteluvils0 etoiopnudamtn fvi s s2umxmp;u0tlt ii3iysfm ulnvo u4treomfctytfaDeaivs s) euoxm3io4optn nvtas  Dtrx  oo0tex  icilslmDrlu s;t) rxnio3totlaDeln s s0tetm(mpiydapte netlt)sDrrxmpno1tpxoioeildfm ua( p;u0tleoxrcio1lm rau ilt trxmim nu4ame micil(f rtrur nu0altomf3iadls rm(mp;u)trtomo iatomD luvs;s0 2tmxm iydape  ivil()arrrx p;o0tpx  ieiat a eanmpn(4altoxrcty1oaDeli i;t)setmxr ou1apeelfeta( s2umxm ;t0aptomfciadfmDul(mo ()tlxoxf3todom raivslt)seumxopno4lp e icsat)srtrxr ;o1aex mi3iadlmDrmn onu4arxrmfciodlaDe ivolt0sexmiopoydopenlictasf 2um(mo;o1tptomociyslmDum(monu0aetnmr oadlatrli ilt t2toxm3io1lmt lietasfaDrm(root4oltn ieiysfa2elnvpn(0 lxnxf3oydlat lu slt s2xoiopny1omtnlnvsasfsrrr(ro;t0apenmfeildfaDean s u)artrmrctadfmDraivo () eur(mpiodapt  icils)aDurx pno0alx mfeildfsDrlnvsnu)trtomrcia1fa   ueo t t2urxmpoo4op nlivi tf 2rm(rono4opeo feiadla eanmsnt0 lenirctotfpt  ivs s0t2toiopio1apeelnciltfartrumo;o1tltoioeiltfs ulu o t4tetrir oydfp   u ils  exoxo oo4lle mneilsfaDtax pno4ale micils s ea( s (0 exrmf to1lp rlu o;s0trxr(o iy1al   feslt aruaum ;u1tpe io3tasla eaump (0aeenirctydfp  anvil( t2ur(opnu4ome  ncsl()a2rmx  no4tle iietlt sDrlnmp;t)artnir3iodoaDr uvi;t0s2toxm3nydlm emnvils) Drmx  oo4alt iictatlaDrl(mpnu4 exrxf ia1fmD aiei;s srtrir3iu4apenmivsl(faDua(  ou0teen feilsfmDumn o;t) ltnmf oy1fa rlivol(  rxr(mpnudaltn icsa(fsrumx ooo0apxoioeiasfa2elump;(0trtnmfciatfpD  ieols0sruo(opio4ll  micsat s2tm( poo0alxnmf3iysfs2ra(vs ()alenif oa1oaD anvs;() exmirpnu4apeelfvtl()arur(m ot0apeo ietasfa2eln o;t)tlxrirctodlp r uesl( setoimpnu4omt  ictltf rtmu oou4olx  ociadfs rm(vo u)alxrif totfm e i o;t  rumir nudome lfeil(faDumu pnt4apenmoeils mDuaumo (0artrmf tydlmDr n i;t0seurio nu1lpteliet sfsDum(rpnt0tleoiieiys mDuln o;()trxrmo tatfp  ai ols)tetmxm iy4lme mieil() rum(ro;t1tpt  ocildlmDraumo (4trtnxfcoo1op   uei;s  2umirpiy1olenmict sfarurx p;o0oet  ictldlmDumu p;()areomr3todfp  aieils) 2xmimpiodlm   nei s s2urur ou4aex mietas s2eau p;t)aexoxf ootfpD  neols)seurim iu1om emnvs tfsDrrx pot0tlxnmfetytfaDraumonu0 lxnmocoatfm   ivi;s trxrxr3oy1am nmfctas)sDrau  ;u1tpen fetyd m2rm(vpnu0 eerir3ta1op  livsls0srxm(r3iy4omt lnvils) rrmxrooo1opeoii3iyd m2rmn p;t0alxoxr todfp rlivol( setmxrpny4am elivslt  Durxro;o4tpeomoeiydfaDulnms t)trtoio iodfm r nes t)trtmxmpnu4ol  mfvt ( srumuro;u0altoioeilslm2uan sn()trtrmo oytom e u o;t)s2toxm3nydoltn nvi s  rtaur oo4opxnioetltla elnms () rtomr io1lptelu o t  rtr(m io4lmtelnvi s)srua(m ;o4olxomfeiytfs2uaumont0 rxoifciy1fa  lneil(0trur(m ou1om n icslsf 2tmump;u0tlt ii3iyt sDumu s;u4 lxoif3ta1optraneo;t) rtoimpno4omt  nei ( a2um( pou0opeoiieiys mDum( o t)artoiocoo1lpt aueols  rurxr3oudol e nviat  2urxrpnt1aetoio3iasfm emn o;u)trxoxo oa1latrliei;(  2xoxo ny1ll emnesls) Dra(ronu4ale  fciltlm2rau o;t4trxomfcta1oatrln s;s0s2xo(r iydal nmivsat) rtm(  nu1olt  oeiasfsDeauvs;u0altoif ty1omDrlieo (0 2triopno4ope mivilsfaDtr(mono0tlxoif3iadlmDel(ms;u)texnxo iadfp  lies;s)sexoio io4am n fesasf rtr(ro;u0texnioctasls2ra(mp ()texoio iatfatrlueo (0sexrirpoo1op elnct tfa2tax o;u0tleo oeiytfa2emnvonu0artomf tydfmDr n s ()t2trir3io4lpt mncilt)sDrrurpno1tee mietys a2uanvs u)texrxo oadfmtrluei ( srxmxm oo1om   ivs t)a2uaxmoot0apeniieiydfa ea(mpn(4texrmrcoatfm raivols0 2xoxo3nydllt  ivtatf rtrx ont1aee ioetaslm2ul(vpnu4 exoxo3oy1laDe ivi;t  2xrxr no4lm emfei ()a2ururont0oetnioeiltlmDulums (0 exomf tydfpD livol( setm(o iydolee nei t  Dur(m oo4oleomi3iasls ulumo;u)aeeoirctytlaDeli s;(0 eumim3iy4lptn net t  rum(monu4tpenifeiadfs2uan p t) rxrir3iotfmt  nvo;s0 exrir iu4opeemfcsa(fs2uaxm ;t4opxomfetydlm2rmu o (0 rtomo ta1fp   n o (  rxm(opoy1apenmfvi t s2urx pot4aptomoeiys mDra(msnt) rxnif totomt  uei (  eum(r3ou4lmte fvta(f Drrxmonu0oleoifcias sDelnms;t0treoxr3oy1oat auvs ()sexr(mpiy1omenlfcils  rua(  no4tptoii3iasfm eln s;u4trtrmr3totfpD au s;( trtrxrpiu1omenmietas)sDtauroou1tpe iocildlaDra(vp;t0aeermfcootom  lieo s)tetoxrpno4opt mnvilt) Dumu  no1tleo feildlsDel( p u4arxoircootoa  lnvs s s2trimpoo4lptelfcs s  Durxrpoo0aexo o3tldfmDel( o u0 leniociatomte nvi;t  rtoio3iudomtemivia() Draxm nu1aeto ociatls2ua( sn() lenxr to1la elueolt0seurimpoo1ll nmieilsf Dtm(  nt1apen ocilsfaDuanmpnu)artnmo totfatraneo ( srxoirpny4lp elfvsa(fa2rr( o;t0aetoiictlsfaDeaums;t4tltomf3todlmtelneil()sexm(m nu4ll nmivia(fs2tmumpou1oeeoiociad sDeau o;t4 rxnir tytoate nvi;t t2xo(m oydal nlictl()srurumpno0tlx  f3iatlm2ean snt4alerifctodla   uvs;(0 2trxrpno1amtnmivtlt aDtrum no1tpx  f3tydls uan snu4tltomocoytfaD lu sls truo(m3iy1olenmfvs s) rua( p;u0tlxnioctas aDra( p (4texoxr tadlaDran o t texm(mpnu4lmenmfesatfsDua(m ou0aleoif3tls a2ua( ont4trerxf3oa1lmDelues;s  2umxo3iy1am  liet t aDurum ot0oltnmfciytfs2um( ont4altnioctotlpDraues (  rxm(r oudomeelneiat arraumpno4teen o3iadfaDrl(vo t4aeermr ootlmD lneil( s2xmxo ou4op nlfeil()aDtr( poo1oex mf3iydfs umnms;u0 lxnir3to1lp  livol( teur(m iu4al elietl(f Dtrum ;u0aexn o3tls a2rmn o u) exrircoodla eli s ( s2xo(o3no1am elfetltfs2rrxmpnu1opxomi3ilsfm2ulnvp t4 rtomrcootlaDe uvo;() eurim iudamenmfvtl(fsrrmump;t0alxn i3tasla rluvs u)arerir3todfm e ivilt  etoxr oodllte nvs (  rta(r ot1aleo oetlt sDeanmpnu)areoxfcoo1omDe n o (0truoimpiydameelictas srtrxm oo0apenioeiytls rau pn(4teeoxf iydlp ranvi;s0s2xm(m iudlptemfcils aDrr(rp;o1altnmf3ildlm2uln s u)arxriocoytfa rlneilt)s2toio oodlleemfei s)arraurp;o0alt mfciadlm rm(ms t0 rxrir3io1omtrli s;( seurxo3ou4amtnmfci t srum(mpot0aleo octltfsDrm(monu0 rtoircto1oatr uvi t0truoxr3oy4llenlfcils aDtm(mo;o1ope mfctydfa2uan p;()teerxr oadfpD  n i t0tetoxopiodalt lfeias  2tr(ronu0optnmfciytlaDuluvont)texrmfciydlaDeln slt0srum(o3ou4olt lnet tfsrtmu  no1altn feilsfm2eaums u)areoircto1op eaiei;t0teto(opiodalte iciatf 2tmum ;u1optoiieiys s2ul(mo ()trxnmf iydfmt livils)trto(mpio1op e nci s) 2tr( poo1alxnioetlsla2ea(mo u)tltnxo3oadfpD au s t) etoiopio4lpen ici (f rra(ro;o0opeomo3iltfaDemnvo;t)arxrir iatfmtrauvo s0trxrxm nu1lle mfvsasf 2tmxmooo4tpenmf3iyd m ean o;u4 ltrxf3iytfateaieil(0t2toxrpiy1openmfvt ( srtaxrpno4apto feilsls2umuvs t4trxrxf iy1latr u olt) 2tr(m iy1lm  micsa()aDrau  nu0oltnifciyd aDuan p (0 exnmo io1omD  i ols trtmiopoudoltnmnct s  rur(roou4opt  f3ilt a2umn snu4tetomocty1fatrlieo;()tetrxopoy4lpenlnvs t s2rmur ;t1ope iociadfsDua(mp;t4tlxomoctadfatrlieo;t0srtr(m iodalte nctatfaDurum oo1aetnmi3iydfmDuluvo;(0 rtoiocto1fa rau s;t) eumxo no1am   fct s)sDrmu poo4olx mf3iyt a umnmp u4tlxrifciotoatelnvo;s0trtr(o3nudome  iesl(fsrrr(moou0aleo oetls mDua(vp t4arxoiocoa1lm   ueo;s) rxmxo iydoltemnci ()arrmu o;o0olx mfetysls ulumo t4arenxo ia1la eanvo;(0s2umio3ny4ap elfvils)aDrmurp;o1tetnii3iydfa2um(vs;t4 rtnmrcta1fpDeauvsls  rurirpiu4ol e ncias)a2uaur no0oee ifctydla2eau s t0texrmocoydlp   neo ( t2xo(r iu4oltnmicsat) rtrxr ;t1tlxomoeiytfm elnmsnt4 rtnir3todopDrli s;s  etoxrpnodomtemnvi ( srtmx  ou4tex  i3iyt mDrm( p;() rtrifctadomt lnei;(0setoim iy4ll elnei () 2urxm ;u1opeo o3tytfaDuauvp t4aeeoifctotlaDr neil()t2uriopoo1olt lfvsas)arrr( pnt4aexn ictatls uauvont0 rtoif3tytlpt anei;s0srxriopoodomtn ivs (fa2urxmo;u0olt  f3ilsls ea(mo;u0tltnmrctotfateli o;s)tetoxopoodlmtnmncsat  2trxrpot0olxn f3tlsls2raumont)trermo oodomtran o s seuriopou1apen fes tfarta(ro;t4oet ii3iatlsDrl(vo;t)tetomo oydom eau il(  2xrim nodomtelivt (  rrm(moou4aetn oeiatlm2umuvo t0 rxnmociodfaD  ivil()srtmxrpno4am emiesa(faDrrxmont0tleo fcildfm rlnvpnt) exnioctotfatrli i;( s2to(o3iudlpte iet () rtm(r no4tpenioetltfm elnmp;u4arxrxf3iydfm  an olt0teuoim3iy4ope  iciasfa2tmur ;t1oeto ociadfa rm(vs u0areomo3tydlaD li ils0seuoimpnydap elncs t) rtru p;u1optnmf3iyt mDeaumo;u) leomo iytfpD aneo s)texrimpiodomen fesl()aDtrur ou0tpe  i3tadfa emnvp u) lenmfciatlaDe u i t0teurim3no4ap e ictltfa2tax poo1aexnio3tyslm emu p t4teeomr3oytfmtrluvi;(0trurxrpiu4om elfetasf rtmu  ;o1tpx iociltfsDranvs t0 rxnxfcio1lpDeanvo;()trto(mpiodap   neslt aDtaumonu0aeeo o3iysfsDeauvp;()aetnxrctotfm   uvs s0teto(r3iu4aleemnctl() rurumooo1opxoio3iydlmDrmnmo t0alxoxoctodlptr nei;s0setr(mpoydlpe mfesls srtm(  ;t0apt  oeiadlm rau p;u4tetrmr3iytlpDelnvi;(0t2urxmpoo1optnmivsasfsDrr( o;t4tlxomiciyd a elump (0 rxnir3iadopDelivilt)s2xoxmpiu4optnmnesat arraump;o0tleo oetltfsDeaumo;()aeerio3ty1oatr ueils)t2xm(m3ou4oltn neslsf 2umxmpou4apxniiciad sDemu s (4aetnxo iotfmtr ieo s  eumiopio4aptelnvtat)arrmurpou0oltnmicilt a2elnvo ()tlxnmo iy1fmDe neo;()texmim3iydal e nviat srraxrpoo4tee mfctadlmDrluvs t) rxoif ty1fa r ues t0truo(m3nu1ap e neias srurx onu0tptnmoeiltfmDeanms u0aetrif3iotoatr nes;(0setm(r3no1alenmictl() Dtrumont1alt iieiyd sDulu pn(4 etnmoctodfmteaues;t0 2xo(mpoo1altnmnvs t)aDumx ono4apt ii3tatls rl(ms u)aetnmr iatop  ln s (  2um(mpiu1ol  livs s) rumxronu1apxo f3iltfs2rlump;t)aexrirctadomte ueol()setm(r oydomtn fvt t  rua(mo;o4tpx  ociyt m2rluvp;u4 renif oy1lptrli i;s0t2to(m ou1amtnmfesatfs2trur ou4olx moeiydfa el( p;t0treoxrcto1fptraueilt0t2trxr3ny4omt lfeta() Dua(ro;t1opx  i3ils aDrlnvs t4arxoxf3oytopt lies;s) rur(m3ny4am  mfctas)a2tauro;o0optnioetadls eau p;u0tetrif3io1fmDr n sl( s2xoim no1omtn ies sfaDuaxm ot0texn icils m2rlnvsn(4 exrxo3iodoa rauvs;s)srtoiopnydopte iesat arrmurp;o0tltomoeiltlm2elnmpn(4aeenxfciotfmDr n il(  2xo(m oy1ap  lieil() Dur(mont1olxnmoeilt sDrauvs;(4trxoir3oydlaDrau o t0s2uoxr io1lp e nei s)s2rr(m ;o4altn feildfsDum(mp;t4tlermocia1omtelies s s2tr(rpoydaltemfesl(  rurxm oo4olx moetat m ulnmsnu0 renmoctatfp  lu o;t)t2xr(r3no4al   fvtat  Drax p;t0apenmieiadfaDuaumsn(0 eenircto1faDr i i s t2tmiopoy4lme mnvsls aDrrumoou1oet iictlsfs umn ont4aexoifctodfpDeaivs () 2xm(o nodlmeelivs t arrr( poo0altnioeilsfsDrm(vpnu)teeoifcoy1lpDe nvo;( trxm(r3no1lm elnvtl(  Drm(mo;o4aetnio3iatfm emnvsnu0trenxf3ty1lp rai i t srxrxo3no4al  mivtls s2tmurp;t4texoioeiadlsDelu p;(0artoxo iydfmt  n il(0setmxo3iu4lltemfvsas)a2tmu  ;o4oleomo3iadfm ran p;()tlenmo oo1op  au ils0 eur(r no1ap  lnvt s a2tmxmp;o1tee  oetldlm elumo;(4treoxo iodlpD  uvo;s sruo(opoy1amen ivias)srurxmoot0oet  fetlslm2ra(vp;t4teerxocoo1opteaueo;() rum(opnu1lpenlfcilt sDrm(  ou0tlx ii3tys m elnms;(4 lxrmr3oa1lmt au i t)s2xmxm nu4ole  fcia(f Drmx pou0alt mf3tyd sDrmu snu4teeoxrcoa1lptraivi;() 2umim oy1omeelivil(f 2tmur nt1tlx  feiasfa el(vo t0tetrmr oatfm r ivsls  rtr(mpnodolte iesas)sDtm(rpnt1apt  oeiytls2rau pnt4treoxo3oodfaD  ues;t trtrir3ny1ole lfetlsf Dtm( oot0aee mictls aDumumsnt)alxomo to1oatrluesl()t2tm(rpnodalenlfvsas a2uaxm ;o1tpxn i3iys sDelnvs t0altrmocoydoa   ueo t srtrimpoo4al emictl()aDtr(  no0oetniociat m ranmsnu0trxnio3ty1fmtrli olt trurio nu1op   fciat)sDrrumpnt4oetn ieiadfaDeln s;u4 ltnir3iy1lm elivslt)trtoxm3oudalen iei () 2taum nt4olxoioeiyt mDelump;(0 reomrciodomD au s;()s2urim io4omeelneta(fa2rmxm ;u4tpeniociyslm rmnvo (0aetnmrciy1laDr nvo;t  rxo(opoy4aptnlfvslt)s2ur( ono4tpx ifciatfmDran s;(4arermf3ty1lmteaneo;s0srtmim oydoptnmiet s) rurum nt1olx mfetldfaDrm(mo;()tleoir3oa1fmDran s s0setriopiu4ale mnetl( a2uaurono1openiociasfs2rm(vp t4arxrmo3oydomDeliei;t0 rxmxo io1olenmncilt arum( poo4alen fctadla ul(vo;t) rxrmf3tadlm eln slt)srxrxmpno1optnlfes ()s2taur oo0tpt moeiatfaDul(mont4 lxnmr3iy1laD  nvslt  rur(opno4ape  fcs ( arrmx  nt1teeomietadls2umu sn()aetnmrcta1late n ol( srxmxm ou4aptemnctlsfs2ta( o;o0apxoiictls aDel(mon(0 eeoir3oadlmDean s;s)trxoxm3io1omtemnciat) Dum(  ;o4aexoio3iytfa2ulump t0texrif3iy1oa e neo t0truo(m oy1ol e ictas)srrm(r no0apenmoctldlmDum(vo () etrmr ty1op r neo;t)srxrxo3oodomen nvsa()arrm(r ou4tltoioetyslaDrlnvs;u0trerxo3oytfaDr ueo t)tetr(r3io4olee nvi s sDtrxm ;o1tltomi3tltfm emuvp;(4texoxf3oatlmtean sls) 2trxmpio4op e ivs s srrm(r ou0apxn feildla elu s;t4tleoxr iotfatranei;()setr(o3iudape  nes s)a2tr(ront1opxomietydfm el( s;t) etnxr oytlptelu i;s  rum(rpoydomenlnesas)a2taxmpnt1aptomfeilt a raump;t0alxnxr iadfmDranvo;t)truoir3iy1ape mncias  rta(rp;o4tetn ocildfm elu p;()aexnif iodoate uvs s s2xo(o3ny1lle micsl(f 2rmx o;u4aexoiociasls elnvp u4 eenio oydfatelivs;t)tetoim iy4aleelicsat  2uaumpot1apxnmicilslm rmn p;u4trtnio io1fmDr ivs;t) rumxm3iodolt lneil()a2um(roou4oexomi3tydfs2rmn p;u)treoir3ta1fmDeln o;t)s2tr(m3iy4apt mfcs tf rtaump;t4oee  iciltlsDuau o;t4trenxr3tatop rlu i (0 rxoio3oo1openlicslsf rtmxm nt4apeomf3ilsfs emnvs;t) lenmfcoo1fateaieslt t2xmim3iy4olt  ivilt s2tmxmpot4apt iictydls2ul( o;() leomr oy1oatr uei (  ruoir3iodap elietlt) rtmxmpou0oltoiociasfsDua(mo t0 rermo3oa1fmteau i;(0seurxm iy4ome lfetl(  2taxrp;t4olxomieiltfa2ua(vo;t0 rxoxr oa1faDrau s t)trxoxm oodal e nei ()artm(mpot1aexomiciys s2rauvs;u) rxomo3ta1oat  nei ()t2tmxmpoydome  ict ()arur(moot1optnmiciat s2rm(vo;(4treomf iotomteanvolt  exrxrpny4alenmfci (fs2tm(rp;t1ope mfciyd a el( s;u0aeerxf3iydlptraivi (0 rxmxr3io1al  lnetlsfsDra(r nu0oeeomfcildls2ulumo u) eenxf3oo1fmDe i s;s0trxoimpiu4lm  mnvi s)s2ta( p;u4oeenif3ilt m2emnvp u0 ltoif3oatoa e nei;s s2toxopiudame  feil(fa2rrump;o0tltoio3tyslmDrm(vo u0aetrxfcty1om  lnvols0tetoxr iu4olt mfvs s)arrr(r ;o4aet  octls a2raums (0trxrioctydlmtelnvols)srumim iudamenlivt ( sDrr(mpnu0oeeo iciasfsDrmnvonu0 rxniocoytlm elieo;t0s2xrxm nodoptnlfvs t)srrrur ;o4ole if3tldlaDel(mo t)tltrioctadfpte nvol( teumxr iu4alt  nvta() Dua(moou0texoif3tad m2rm( snt0 exoir oa1fateaueil( srtrxo nodomtelfvt t)srrr(mpot0tpt ifcils s2ea(vp u)teenmr3ta1la eauvs t) 2trim3io1ap  mici sfa2tr(mpno1oltnifctaslmDeaump u0alxrmr oo1oatranes ()sexrxopiydamtnlnvi (fa2ra(r oo4alxoif3tyslmDua(mpnt0 leomf oytfaD lu olt0 rtm(m nu1ale lnesa(fsrtr(ro;u0optniictlslm ean ont4 rxrir ty1lm eaivol() euoxm3io4alen nesat  2rrxmo;o0oeen iciyd mDuluvs;u4tltrif ootlmt lnes s)s2ur(rpio1lmt lieiltfaDtmxr ;o0ole  fctytla el(vpnu)alerxrcty1om   nvi;()trtoiopny4op elivilt  Durum ;o1alx  f3iad sDel(vs;t4artnio3ia1fat  uvi s  etoxr3no4lmt mfes sfsrrm(mp;t4tlt  fcilslm2rm(vo t4artnmf tytlp  an o s) ruoxm oo4lp elfcsl() rtrxroou4apt moctad s2ulump u)artoxfcty1oaDe ivols sruriopiy4al   fet (  2rrx o;u1ole mocilt m2elnmp;u0aetoiociy1lmt aies t texoimpiu1am n iesa( srrrx onu1tptoiieiad mDumumpnt0arxnmr3oydlm  an i;t  2trxo3oo4opt  fvsa(  rur(m nu4oeto i3tlslm2um(mp u) leniocoydoa  aieo ( t2uoirpnydomtnlneias) rrrum ou0altnmi3iytfa2elnvsnu4artrmf to1la elivols srur(r no1ol  mnetl(farrruro;u4aexnifcildlmDeanmpnu)trtomo ta1oatr nei;s)t2xr(o ny4apt  neslt a2trurpou0tlt iieildfs2emnms;(0areomr oydomt  u i;t)s2tm(o nydale  nci s) 2tau poo4tetniiciyslm uluvo u4texrir oytfmte ueol(0 eur(opoydaptelfciatfaDtrxm oo0alen o3iytla2ranvo u)alxomr3ootoaD lnvilt srxoir oydalen nvtlt) rrr(rpno0apeo iciys mDrm(vpn(0alxnio3totlmtrlieo;t0srtmirpnydamtn fvils)arurx  nt4apx mfctldlm uln p;u0arenxr3totoaDr nvi;(0s2xm(r3iy4ope  ivias)a2tmx o;o0olx mfeiys a rau sn() lxoxfctytfa r i ols) ruoio iu1lmte ietas srumu  ;u1olxo feiadfa2umn o;(4tetnxr3oa1faDeli s s  2xoxo io4ape lfct t) 2tax pnt1olt if3iyt m2ul(vp;t) ltnxo io1fpDeli i (0t2urir3oudomen nei s) rtm( p;t0tlxomfciys s2ranmp;u0trtomocoodlmDelneo (  2tm(m3ny1llt  nviltfsDraxm nu0ope iieiatfm rm(mp;t4trtrifcty1la  aneols trurxm iu1lptnmiesl() rrmx ooo0tpxoiieiyslm2em( p;(4trerio3oy1fm eli s;s)trum(opnydlmen nvsa( sDrm( poo1ope  ociadlm2el( on()alenir ia1oaD au ols0trtmxmpoudll elnvi s  Draxmpno0optn i3iaslsDrln ont4 rerir3iodlpDraneils t2xmxopnu1ll nmfctlsfarrmx  ou0tet  ocias m2elu p;u0teerir3iotom  ai s ( t2xrio nu4oltelnvsa(  2rr(ro;u1aleoifeias a ran o (4 ltrmr oydomtelu i t0texrirpio4altemnci s  2raxmpou4tpxn ieiadfmDrl(vo (4alxomr3oadopD aivs;(0srxmio ny1amt mncia(f 2ra(  ;t1apxnmi3iytla2ra(monu4 etomf3oadfatrau ol()teum(opnudap emnctatfa2ra( oou4aetoiiciydls ea( p u0texnxo oa1faDrlnvo;(  rxo(m nudapte ietltfaDtau o;o4aet  ieilsfa2um(vp;u0 rtomf iy1opDe u ilt0t2uoxr iy4ol  livslt)aDum(rpoo4olenifctlslaDrm( pnu4aeermoctatfmtrlneols0sruoim3iydlle mnvtlsfs2trxrpot4aetnmoetldfa ea(mpnu4artrxociotoa r i sls trxmimpiu4lp nmfcilt)sDuaxr ;u1aleoiiciat m rln s t0aeeoir oadfa e uei;t)sexoxm3oy4olenmnvt tfs2ur(  no4oetoif3ilslaDea(vs;t)alenioctodfm  aieo (0 etoio3iudamenmicsa(f 2ra(rpnu0tle  ieiysfm2uln p;() eerxf3iatlmD auvs;s) 2umxo ny4lmeemnctl(fa2uru  ot0tltnmi3iytlsDelu snt)aeeomr iydfmDr nvs;t) 2xoxmpou4lm n nvs t sDurumpoo1opx ifciyt mDrm( on(4tltrxf3ia1fa elivs ()tetrir3io1lp   fvtas)srrm(r nu0opxomi3iysfs rmuvonu4trxoxr tytlat auvils0 2toiopnu1lptnliesat) rur(m ;o0tpt  feilt sDuaumo;t4aetoiocoadop elnvo t0srxoxr ny1ap emfci tf 2tmu pnt0tptomfciysfs2ua( o ()aetnio oydfpDe ivil(  etmxmpoydameelietat) Dua(  oo4tpe  fciaslm rmump;t4 eenio3oadfa r ues;(0sexr(r oo1am elieta() Dum(roou1apeo ieildla2rmnms;(0treoxo3tatop  au o s  2toxopoodaltnlnvilt sDuax  ou0aexn f3iasla ul(vsn(0aetoxo3iodfmDr ivo s)tetrxo3oydop  lfviatfs2taxronu0aetomfeiatlsDulnvs;u0 reomfciadlaDeaivols) rtm(r no1ll nlfvtas a2rru  no4oeto octyslm ul(vo;(0 exoifcoadop r i s;s0trtoio3oodam emieilt  2raumo;t0oetniictatfs2rl(vp;t0treoxf todfa rlueols0teuo(mpoydoltn ncil( a2umxmoot1olx iocilt a2emump () exrifctatfp  ai o ()s2urxr3oy4ole mncta(f rrm(rp;o1opt ifciadlm2emums;t)aexnmr ty1fp   iei ()srtmim3oo4oleemnetl(fsrurumpou4opxn fcilt a2rmu s;t)tlxrxo3oa1lpDrlivi;(0t2xm(r oy4amt lncsa()sDtmxm oo4aet ioetldfaDrmn o t)altoirctatfm   n s s) etoimpoydll emivias)srumx pou0opeomfeiysls el( s;() lxnxo3oytfp rai s ()trumio3nu4lm emnvsas)a2uau pnt1tle  ociyt m eanvs;t0arxnmr3oydfaDrli s s)sexmirpiy1lp  lfcsl( sDrr(r ;u4aetomo3iydfm ea(mo;(4 rxnxf oy1fateauvslt) 2uoio iudopte ictl(  ruax pno0aexo i3ilsla2ulnmo;t4 renir3oadlaDrln sl(0s2xr(opoy4om nlnvils)aDum( p;t1tetoio3iaslsDrmn o;()treomo3oytfatrlneolt)t2tm(r3iydap nmnei s) Duau pou0teeo icildfsDea(vs;()trxoio3iotlp  liei s0seum(mpno1al nlnes t)aDrr(mono4olx mf3tldfmDrmnvp t0 rerxrcio1op   nei (0t2tmim3no1amt mnesatf 2trxmoot4aexo fctltlaDrmumon(4aetrxf3ootlmt anes;(0trtoir io1am e ietl( a2ua(mpou4aleo ictysfaDeanmp;u4trtnxocty1fmDran i s0seurim oodop elivs (fa2raxmp;u1oex  fctytfa2rau o t) etrifciotoatrlueo;t0s2ur(r oodapenmfesat)sDurxmooo4apeomocias aDel(vs t0 renir iatlm  au i s) rurxrpnudap elfcs (fa2ua(r nu4apenifeiadfa umuvo u) reoir3iy1omDe ueo;t)texoio iy4lme mncsltf 2tr(mpot4tpe  fcils a2eluvsnt4trtomf3oydfaDe i ilt)srtrxo oudom emfvs (faDtrx ono1ole mo3iad s um(vs;(4 lenxr3oy1fptrai s s) rurim3ou1lltn nvt sf rrmxr ou0altnmicilt mDemu s (0arxrxo3oatoaD luvo;s0sruoim3ny1om emiesa(faDuaxrpou0tlxo i3iadlmDel( o u0tlenmf3oadlpteau s s teur(m oydopt mfcs t)aDtru p;o4tpeomo3tat aDemu p;t) rtrxr3tadla r i i s) euoxrpoy1opee ieiasfaDra(mpou4tetnifcilsls2umuvs;u0altnmr3todomtraieo;t) rtm(r ou1op  mncs t a2taxro;u0texnmi3iyt aDea(mpn(0aetrif oy1fa  lues ()truriopio4ol nmncias  Dtru  ;t0apt iicilsfs2em( o;u) lxnmr iydop   ies;s)setmim iudaptnlfci t s2uaxm nt1alenmi3tyslsDel( s;(4texomf3todlpDeauvi t0setr(o3oo1olte feias sDrau pno4tet  ociltfaDrlnvp;t0arermo3iodlmD  nei;t0seuoio3iy4lpt lnetlt  Draur ou1aleniieiyt mDeluvon(0aeeomo3iotoat au ols  exrxrpiydaleemfctl(  2rm(mpno0optnif3ilslm2uln p;u) ltrmf3iy1laDelu i;s) etoxm iudlp   nvslt) 2taum ot1tpt mi3ilsfa2uan p u)artnio todfmDr uvo;s)texo(mpny4altelivil(fs2tr(ro;u0tlt  f3iatlsDeanms;u0aeeoif tatomtr n o;()s2tm(opio4ll   ies t)aDtm( ont0apeoio3ild s2ea(vonu0 lxrxf3oytlpt anvs;(0teumir3nudomtemivtltfs2rm( o;t1aeeoiieiatla2uan snu0tetrmr3oodomD  ivo (0t2xmirpou4oltemfetl(fsrumxm ou4oetn ictldls2emnvs;t0teenxf oa1op   nvs t trtr(m3iodlmee fvtas aDtm(m nu1oeen ociysls2elu o;t0 rermr totoatrauvsls)trtr(mpou1op emfeia(f rumxmpot1ole mo3iytfs2ulnmont) lenio3tadlateluvs;() etmxm nodlltemics t) Dtau p;u1oeto f3iltla2ra(mon()aetnxr3oadlmtraueo t0trxr(r iu4alte ncs s  Dtrurpnt1tlen ictldla rlums () etrmociydlm ranvilt0 rxoim3oydopt  icta( a2ur( p;u0optn ociaslm2ran s;u0artrmr3tytfmD  ies;()t2tr(mpoo4amenlneslt)sDum(mo;t0aptomf3tldla ulnmp t) renio tydla rai i ( seurxm ny4alenliesa() 2urumono4oleo fciytlm2rlnvonu4texrirciydlaDrlivslt0trtmir3nudlm e fcs ( aDtax pnu1tpenmf3iad a2um(mon(0tltoif3oa1lpDeluesl(0 rur(mpno4alt  ivtlt)aDumurono4opto i3tysfmDem(vsnu4aleoxf oadlmDeauvi s0 etmir3iydope  nctl(fsrtr(mo;o4tpt  i3iatlsDea(vo;(0 exriocoodomD luvo (0 euoim3iy4opt mivs sf rtr(rpnt4tleoio3iltfmDumnvo ()alxoxr iatop  au o;t0sruriopoo1ll nmfvs t) Dtrumo;o0alt  ocild a ea( p u)alxrmo ty1om r n ils)srumim3ou4ope lfvta(  Duax pnt4teeomoeiat mDeluvpnu0aleomf iotfa e uvo;t0 2xm(m3no1am   nei ()s2ua(mpou0tetn oetlt mDulu p u) eeoir tydoatr ivo t) 2xmio iu1ol  mnctlt aDuaum ;o0oex  fciltfa raump;u0 ltoif oadfaDraiei;t)sruoxmpny1ape  ics (faDtrum ;o1aex ii3tytlm2ul( o;u) rtrmr3iydlaDeai ols0srto(rpou1ol nlics s  Durxront1alt  fciatfsDrmu snt) eeomrctadomD  nei;(  rxm(r3oo4al  mfvtls s2ur( o;t4oltnioctysfa emuvp (0arxrxo3ia1faDr i o ()trtr(mpiu4lmte ivtas  2umum no4oexnmoetasls rmnvpnt)trtnircoadlp rauesl(0seumxr3oy1ope lncia( s2trxrp;t4tex  ietadfsDelu on() etoir iodfaD lies;t)trto(o3io4ope  fctatfsDuax  nt4tpenmfciytlm2rlnvp u)aeerirciytfpte uvs;(  eur(opoo1lpen iet ()s2ra( o;t4aex iietytfa emnmont4 eeoifciytopD  u i s) 2xmim nu4op   ietas  rrmu p;t4olto iciatls2umnmo t4 eenxr ta1fp r uvi;(  2xm(m ny4opeemfctlt srumx  nt4apxn fciatfa2umuvs (4texrmo ootfp r nvi;t) 2tm(o3oydlm emieiatf ruax pnu4oet iieildfa2rmumo t) lenxf3totoatran s;(0texmxr oudolen neiat  Draxrp;u0aleoii3iytfsDea( ont) ltnir oy1laD au i;s srtm(o iy1lmtnmics ( a2uax p;t1olen fetyt mDulnvs u0trtrxr3iytopDraneo;t)t2xo(m3nodape lfes t)srtaxr ;o4tex mfeiys sDemums (4 exnir ty1oat aieol(0seumxr iydamtnmieta() Dtax  ot0tlx mf3tysls2elnvp u0 reomf ia1oa eanvi () 2umxr oo4lltnlicils)arurxmpno1tlxoiociydfm2el( snu) etrmrciytfa ran s t srumir3oo1lptnmicsls)sDrmx  nu4aee if3iydlm2uaump u)trtrxf oa1lmtranvi ()t2tmxr3nudap emfvsatfaDtmurp;o4altomiciltla2uln onu0aeeriociotfa e ivo;s0seuo(m3ou4amt lnctlt srum(r ;u4tetnmoetlt sDrl(vonu4trtrxf3oatfpDr uvol() etmxm oydlmt lnci s)arrmx pnu0oexnioetytla emnmsnu0 rtrxr3tatlptrln o t srtrxr ou4ol  micslsfaDumx o;u0aleo fctlt mDumu o;()trtrmf3oydoa rlies;()s2xr(rpiy1apt licta( srua(mpou1tpxnmi3ildlmDelnmsnt4 exnmrcoy1oa elieo;t0s2trio3iu1llenlietls  rtaum ;u4tpe  ociydfaDeln s t0trtnxr3io1oate uvi;s  etmxopnodll n fvs tf Dra(ronu0open f3iyt aDea(vs t4 rxrxrciatfmDr n i;s s2xr(o iodlpe  fviltfaDrr( o;o4oeeo feilsla umnmo;t0teermoctotlpteluvolt) exr(o io1ol  lieslt  2taxmono1tlx ifeiltfmDrlums;u0arxoifciy1fmte i i t0t2xoio3iy4ope mfvilsf 2trxroou4aetomfeils mDrm(ms u)tlxrxo iodfmD aivi;s tetrxrpoy1olee nvia()sruax  nt1texomoctytfm2el(vp;t)treomr3oadlmDe n o;(0 exmir3iydlmtnmnctlsf rta(mont1ope micilslmDrlu o t4trtrxfcoadlpt li ol() eumir3io1ap elfvs t) Dum( pot4teenii3iyslm2eaump;(0 ltnio3iodfpt  u s ( trxm(rpoodlp nmneilsf 2tr( onu0oeeomfeiltla ulu pn() eermf3ta1oaDrau olt0setoim3oodaleelieiat s2rm(mooo1alt ifetyt a2rm(ms t0tleoxr3ty1fa elues t t2uoxopiudol   fvtat)arurx o;o1oexn ociydfm2ra(mp t0aetrmocoodlm  lnvs;s0t2toir3iy4amenmncil( srtrxmo;u0apx io3iltlsDrmumpnt)aexomo3tadla rlu i;t)texoxmpiodlpenlieia() rtrxm ou0alenmi3tas m2rmumonu4 ltrif oy1opDe nvi s0 2umxm3iy4ol  lfesat) 2rau o;o0openmieiatfaDuanvp u4arxoircoatlateaueo;() rto(m iy4lmenmnvil()sDurumpou1opx  ieiyd s el(ms u0 etnifcoadoaDeaivs;(  etmxm3iydape  ncs ( sruaxrpot1tpeo feiytfsDel( o;u0tlxoxo3ty1fmD  uvi t0trum(mpio1lmt mfci s s2ur( p;o4oexo f3iatlm rlums;()alerio iydfa elieo (0setrxrpou1amte ieilt  Dumxmpou1tpe  feiysfa2um( s u)teeoif totlaDelnvs;(  2uo(rpoo1ap e fetls  2trxmp;o0tpxniictldlaDuln o u)areoxf iatfaD anvil(  etm(mpoy4aptnlnes tf 2rmxmpno1tpeo o3tls aDumums;u)trermocia1laDr i o;s s2xr(opnodol nlnet t)sDurxr ;o4tltniieiyd aDuln s;(0alxnmrctadfmDeli i t trum(mpiodllenmnvsat) rra(m no0opxoifeild m emu onu4altnxr iodomteanvo;s trum(m oudaltnmncsls)aDur(mp;u1alx io3ilsfsDrlnvsnu4 reoiociotoaDrlies t0 eum(r3nodlpt mfvt (f Dtmxrpnu4tex  f3iadls2uln onu) lxrxo oy1omteai o;s0 2trio3io1lp emfci t arra(mpnu4tlxnifetasfs2emn pn(4artnxf3ootoate ivolt srtr(m3oydap elnci s aDta(m no1oeenmieiad aDranvo (4 lenmf oytfpDr ues ( s2ur(m iudlptelnet t s2tmu o;o0tlxnif3iasls ea(vp u0aeenxfcootfmD  u s;s trxm(m3io1am e ivtatf Drru ooo4tltoiiciltls2uluvont0trenio3iodomtranvs;s setmir3nudllenmfci s a2um(m ;o1oeto o3iytlmDum( on(0 lxnxf3ootlpt lueilt  2urxm oo4llen fctat)sDtmumo;u0tlxnmo3iadfsDum( sn(4trxrxf to1la   n ols0 2toir3ny4lmtnlnviatfarrmurp;o0tpt ifciydlsDua(mp;u4treomr3tadop eli ilt0seuo(r oudopenmnvsa( srumxr ou0oexnioeiatla rlnvpnu0 rtrxf3oo1om  au s ( seur(mpiy4lp elfesl(  2um(m ;t0alx mocias s2rlu s u4 rtnmf3oadfpDrlivo;s) 2tmirpoodaptn ivs ( s2rauronu1optoio3iytlaDelu onu) lerir tytlpteanvo;() rumiopny1ol nlivs tfs2uau pno4alt  ietydfs rluvo t) lxrxfcoy1oa  au o s setm(o nu4ole lict (fsrurx  ot4apx iiciltls2umuvo;(0arxoio3iy1oat liei t)srtm(opnu1am nlfes tfarrr(  nu1oetnmo3iysfa2rmnmo t0aetoio3iodlaDe ieils0s2xoxopiy1amtelieta(f rur(r no1optnmietas m2rlumpnt)aexnmr3tytlmDrlueolt0trtmio3ny4lmee fetat) 2trxm nt1aex ioeiat a eanms;(0 lxomf3to1fptr n i t0s2trxm no4om  mfviat)aDtm(m nt0tltnii3tlsfs elu s;u4 rtnxf tytom eauvi s s2to(rpnu4ol nmfci t)aDtrum no1tleomietytlaDuaums t0 rxrio3io1la e n ols  2toxo3oy1amtnlfvils  rurxmpot0tpxniiciytfa2uau p;t0aexomr3iotfpt  neol(  etmxo oo4om e fetlt)arrmx poo1alto f3ildfm rl(mp;t4teerxo3tatlm rlivs;s0trxrxopoodome  fetas  2rm(r oo0tptn fciydfm2rm( o;t)artoxo tadfa rauvs s0 eumir nydllt  ies s arrmxrp;t4tlx ii3iytlmDel(msnu4aeermocoy1la eaueols s2uoxrpiudom   ies s)aDrrxmoot0apx  octasfa2ra( pnu4aetrxf3oa1op elueslt) exoir3iodame lnvils  2tmxm ot1texomieiasfs ul(mon(4tlenmo oa1oat  i s;( s2xr(mpno4alenlnvia( sDtr(  ;u1tptn oeiltfm ul(mo;(4tetrxociotlmDe uvo t0teuo(mpiudom  mncsls arumu  ;t4teeomf3iydfs uan s;(0tetnxo tydfmt  ieil(  2xm(r iu4lptn fesat s2ta( o;t1ape  i3tydfm2ulump;u4alxrifcoadomt  ivs ()srumio3nu4alee fcil(faDrmurono0opxomo3tydlaDel(ms t)alxoif3oo1lmtr i slt) ruo(r3iodopt mietl( a2rrumpnu1tle  feiys mDua( snt4trerir tadfp ran o s0 2xmxm3oodal e nei (  Dtr( pno4olxnmfetatla em(mp;u4trenir3tatom eau sls  etmir oydomte ics ()s2ur( ono1oexo o3iyslm uln ont0artrmf3iy1fmteluvs;()s2tr(r ou1lpt mictls)a2rmu pno0tptn o3tatfa ran on(0 exrif3oy1fa r nvo ()s2xrir3ou1opt  iei t sDtmurpno1texoiiciysla um(vs () rtnif3iadomte neo s0 rtrxmpio4ale mfei t)a2tmx  nt0apx  o3iydla ulnmp t0treomr tydomDelieo;t)s2toxmpoy4lmtnmnes ()srtru pnt4tpe iociydfa2rlnvs;t0tlxoif3oo1lpteluvil(  rtmio3oy1lmtelivs () rtmxmonu0aetn feiys mDrm( o u4 rtoiociy1omDeluvolt  2trio3iudlm elnct sfsDrm( p;t1aptnmo3iltlsDelu s t4tlxrxocta1lp rluvi t s2xmir oo4apenlnct (fa2trxr oo4alxomf3iytlsDuaumonu)altrmo3oodomDe nvo (  2umio ny4omtemfesatf rta( pnu4tpxomicildla uln pn() rxrmr tydomt aivo;s t2trxr oudlpen net ()sDta(moou4tlt  fctatfaDel(mo;(4tlxrir3ta1oatr ueilt  exrxr no1om   netlt)sDrmxrpoo1olxn oeiatlaDeaump t4arxrmf iy1lpD  nvi t)t2tmxm3iodap e fcil()sDrrxmonu4aleo ocilsls ranms;t0altrif oydlaDrlu s;t)s2urxm3iu1lm elivil()artr(moot1tpx moetas a ul( s t)trtnio3iodlmDr i i;t t2tmxr nydlm  lnetlsf Dtrx pou4altoioetyd a uaumonu4arxrxociydoate neo;(0trtmxopio1lpen fvtls) 2ta( ono0ope io3iytlm emn p t4 lxnif3iatfa raivsl(0teumirpiydoleeliei sfaDtmuro;u1oltoif3tysfmDemu snu4 rtrmo3oa1omD an ils0t2xmir nodaltemfvtls) 2ra(  ;o1olx iietysfsDemuvs;()texomrctytoa eaivs s setmxr oy4ame lfcsls  2taxmo;t1alx mfciytlm2emnmo t0aexoiocoo1oatrlivs;()seumirpio1ole  nctls)a2rm(  nt4alx ioeiyd aDeanvp;t0 rxoxo oy1fm  lneol(0t2tmio3oodole mfesasfsDrmu  ;o4ope  iciydlm2umuvpnu) etnircoytom   nvilt) 2xrio iudome lncias)arra(rp;u0oetomfciat aDul(vp (4aeenio3iytoaDraiei;t tetoxm3ny4lm  mfvils sDrr(mo;o0altn o3tadfs rmn p;u0areomr tatopD aivslt s2um(rpiydapt  ncilsf Dtm(rpnu1tlxomo3iyd sDua( sn(0tetnmr oo1lmt  uvs (0srxoiopio1ameemnvi sfarua(  ;o1tpxnio3iat m ulump;t4aetnmr iydlptrln i;t srtoxm oy4lpt  fviatf 2tr(mpnt4olx  oeiad a em( o t) exnxrcoadfa rlueo;t s2tm(opio1ll nlncs () 2tmump;u0aexoifeiys sDulu s ()areoxociotoaDelueils)t2toim nodlpenlfeslt)s2umx p;t0aex iieiys s el( o;t) lerxf3io1fm  lueo (0setrirpou4opeelnctl(  ruaxr nu4alto f3tlsfa rm(vont4alxnmoctytfmDeauvi (0srxrirpoo4ame lfct (  Dur(m no4tet iiciltfmDrl(msn() leomf iadlaDr i o;( t2uoim oy1lmenmiesl(faDrmu pnt4tpenmicias aDulu o t0texnifcoy1fpDeaiesl( trxmio3nu4omtn icia(fsDurxm oo4olxoiociasfaDuaums u0 ltoioctodlmtr uvi;( texm(mpnu1am elfvils)a2tr( oot0tle ifeilt s2em(mp (4artoir3todoatr nesls tetrxopou4olen fcia( srtax  nu1olto ocilsla umnmo;(0aleoxf3oa1optran ol()teum(m no1olenlfet tf 2uaur oo4aptnmfetadfs emnvo t4 leomr3iatlm  anes;s  2uoir3oy1oltn fcsas)s2rau ont1tltoiieildlm uanmonu4 etoio3iatfm eaieolt0trxo(opiudapt  ivta(faDraumpot1teenmo3iat sDrmuvs;t)artnmf3oodoa  au s s trtoxo oy1lpenlicsa(fa2rmumonu1oet  ictysfm rau o (0 exoxf3io1faD  uesl(0seum(r no4am n nvias) Drau poo4tltn oeiadfmDumump u) ltrmf3iydomteln olt)trxrim3iy4omte fesa()srtaxr oo1olxnmoetyt sDelnmo u0texrxf iodopD ai s t s2xo(m3oo4olt mfet (f Drm(r ot1oeto i3tatlmDumuvsnu)texrxocio1om ran sl(0srumxm iodaptelnct sf Duaum ot0tltoiieiatlsDem(vo;(0aeeniocootfmD  i ilt)t2tr(o nu1am emfvta()s2ur(mpno1tlxomieiyd m2rln p;()alxrif tydfm   u il()sexmxr ou1amtemneias  Duaur nu0aet  fcias s2rm(mo;t4arxrxocoy1oatrlivi;s trxrio iy4ol n ietlt srumxmpou0oex  feiys a2emnmpnt0texnir3oo1op eln il(0 eurxopoy1olenlieslt) 2rr(r ot1opeomo3iat m2emnvo t4teenmo totom e nes;s0srtm(m3oudam emfvtatfsDtaxr nt1teeomf3iad aDum(ms;t4 exnif3iydlaDrai s;s) etrim oydam elnesl(f 2taurooo4aeeomociatla ulumpn() etnifctatoa eau o;t0srtoir oydolt lncias)a2uax  nu0oexomieilt mDeln p (4 etnmr oytlaDrlnvolt0trto(m3oydop  mfcias)arrmumpou0tptn oeildls2rmn s t0artnxo3iotlp eluvs s  2xmxo3nydoptelfesa(fs2raxm ot1apen o3iat sDrlnvpn(4aeenxr tadlatranei;t0seum(o3ny4al n fetlsf Drmur ;o1apt iictlsla2rlnvo (0 lxrir3oy1omte ies;t0 rtmir oydol n fcia( sDuaxmonu0tlxn i3iatls2uluvpnt0aeenifcta1oat ln olt0 exm(rpio1ap elfvsas  2taumooo1alxo ociltlsDumnmo;t0 ltnmo oytlp rln o ()truoxm3iodalenmfei (f rtr(m ou4tlt  o3tlt m2rl(vp;t)alermf ia1lmDr neo s trurir io1olt lnvilt s2uaumoou0aeeomo3tadla rmuvonu4tleoio3io1oateluvilt0 eurxo3iy4lp e fvtl( s2trumooo0tleoiociltfm2uaumo;t)artoxr oo1oa elies;s t2xr(r ou4altnlicia()arumurpno1tlxoifeiltfs ea(vpn()trxnmfcia1opDrlivslt)trxoxm no1llen fei sfarumurpnt1oexo ieiatfm2rln ont4tetrifciotfaD aueilt0s2xm(m nu1ol  mivtl(  rrm( ono1optoifctltlsDum( o;()alxrxoctadomD lneols  eto(r3no1ope  fcs () Dtmuro;u4tpenio3tadls elu p u4tltnmrcoa1oa elivo;s)texoir3iydlmenmnvil( s2rmxr no0optomfciysla rauvs;u) etnmfcoo1optelneslt)t2xo(r3iu4ap nmivt t  Dtmurpoo1alxn iciasfa2rlums;u)trenxf to1op rlnei;(0sexrim3iydaltn fcsltfarra(mpot4altn fciyd a2umn s t0arxniociy1opD livs;s0 rtrxo3oo1ole mnesl( s2ur(r ot1oexomi3iadfa2emnmo ()altoxrcty1lm elu o s s2xriopoy1aptnlfvt sfa2ta(ro;o0oetn icils aDem( o;()altniociotfp  ln i;t)sexrxmpiu1omt lnvs ( s2umxr ;u0apxo ictlsfa rm(vs u4arenio iytla raues;(  2umxmpno1ap  livsl(  Dur( ont1tltn i3iadfm2ra(vp t4arxomo3to1lm   i il(  2to(r3iy4amen ivi ()artm(  nu4oet ifctyd a uauvo;u4treomfctodfmt li ils0trtmim3iy4lltnlicsls)s2rrxrpoo0tpeo feiatfs em(vsn(0 etrmrciydlmDraivs (0 2xoimpnudol emnesa(fsruaumpnt4tee  f3tasfm ul( o;()aexoio3oa1lmD anvi;t)t2ur(r3nu1apeemivil()srtmxm oo0teenmoctad sDelnmp;t0tlermf tadlp rluvo (0 2xo(o3oydaltnlicils) rrax pnt4ope  ietldlm2el( ont)tetrxocoadoateauvol() 2xr(r iydam emictl(faruaxro;o4apto icildfm rl(vp (0aetrmo ia1fmtr ueilt0 2xmim3iudamenlivia(faDta(rp;t4aexoioeilsfm emn o u4alxnxoctodlmteai ilt0 2tmirpiydaleelfet sfarrm(m ou0tpeomoeiytla ea(vo;()teermrcoo1fm raivols0texmimpnudale mneilt sDtm( ont0oee  ociyslmDul( o (0aexomr3oydlat  i sls  2xr(rpoodapt mivsa(f Drm(r ;t4aptoifeilsfmDua( s;u4arxoir3oatfp eluvsls)t2xoimpny1am nlnes s)sDumxrono0opeo o3tltfm eluvpnt4 rtrio3oatfptrln o;t0s2urxm iy4ape  iesat arrmumonu4oexoiicildlm2eanvsnu4trxnifcoa1fatr ueilt  2xmxrpoydamtn ivi (f rrrxrpnt4oleomiciydfaDrmn snu0tlerxf oo1laDe nvils  2ur(mpno4op emici (fsDrmx pnt4tlenmfeiydfs2eanmpnu0texomocoatlp r ieilt0teuo(r3oydame  nvtas sruaumo;o1tpto o3tltla2eaums u4alenxr3oy1lmtr nvo t0teum(m3iu4aptn iesatfsDta(rpnt4aptn fciydlsDulnvs t0artoif3tadomtraies s0s2xmxo ou1ap nmnetls)s2ra( p;u4tle mo3ilslm elums u4 rxomocto1laDelu i s) rtrxo3ou4lmtemnvs t arrm( oou0tpe mi3ildfsDua(vs;t0aexnio ty1omtrauesl(0 2toxo ny1amenlfei s  rta(ro;t4aee  i3ilslm2rlumo;u4 lxrmr oydoa elieols)setoir io4lmen fet sfsDtrump;o1tpxnmfciltlmDuau pnt4tlerxrciytfpDran o s0trxr(m3iodom   ivsls  rum(mo;o4apeoiociysls ra(mp;u4aetnirctodoptelnvil(  2tm(mpio4lmt lnvt ()s2rrxro;t4optnioeilslm2rlnmsnt0altrmrcia1fp  anvil()t2xmxr iu1lmenmnetls sDra(m no1tptn o3tydls2umu s (4 rxrif3iy1lmt auvo t0trxr(rpoudolen fcia(f 2uaurpno1oltomictls m2umuvont4tlxoxo3oatfm rlivils)s2uoxo oydlp nmnvtltfa2raumpno0ope mo3iatls2uau on()aexnxf3iodfa  ai i (0trxoxo iy1al n fct (f Dum( oou0aeeomoeiysfsDumuvsnu0artnxo tadlpt aneil()t2to(opou1optnlnetlt)srur(mpoo0olxoifetldfsDum(mpnu0 rxomfcoadlm raneolt) 2xrim no4lmee ies (fsrtr(m nu4olxnmietltls2emu p u) lenxo oodla e uvil()s2urxo nu1omtelfvslt  Dur( pnt0tex ifciytls2rl(mp u) lerif3ty1oaDr ivi;()s2xrxmpoodome  neiat aDraxmo;t4alt ifeiad sDeanvp u) rtrif3iydlmDeli o s  ruoxm nudomtn neil(fa2tm( pno1oexn ieiydfmDumnmp u0aetniocoa1lmDr ivo s  etoir nu1lpenmfvia(fsrtmxro;o1tltoiociaslmDulu o u)altnmrcoa1fmDrlnei t  2uo(o3ou4op nmncsls aDtrumonu1texn f3iad mDea(vsn() exnmocoydlp  au o;(0t2xrim3oy4ap nlicsa(fa2rmurpot1apxnmfeildlm rmu s;u4tleoxocto1fpDeai sls)teurimpiu4ap nlicsl()srrruro;t4tptn f3tytlsDumumonu0trxrxfctytoaDrln slt) eurirpoodlmtelfci (faDum(r ;t4alxoiicias mDul(msnu4 lenxr3iadfa rli olt trtmxr3iy4amtemnvsl(f 2trumpot4apto iciatfa umnms;(0tlxoxf3tydoaDrau o () 2umxm nu1lmt lnei s srtrx ont4tet  ieiytfs2rauvpn(4trxnif ta1fp  ai i ()s2xo(o3nodape mfcs t s2ra( o;o1tlxo fetlsla el(mpnu) lxrxociytfmD livi;()s2xmir oo1llt  ncsa(f rraxr nt1texo o3iys a2eanvsnt0texnio todoa e uei (0s2xrxr3oo1op emncs ()srrrum ;t0teeoiiciasfs um(mont0arenxo3tadlp eli i ( setrxm3oodamee fcta(  rum( o;u0oeeoii3tydls2ra(vs t0 etrmrctydfmt  ivo t)seurio3iudlmenlnvsa(fs2umxrp;u4tlxnmfciydls2umuvs t0 exrio tadlptelivs s  eum(rpio4lle mncsltfsDtrump;t1tltomietld m2em(ms;t4 ltrxr3oydlmt aivo;s)s2to(o3oudolee ncias s2umumo;t4aexomociat a ra( p t0aetoxr3iodlp elnvo;t t2xrxr3ny4amenmivt ()s2uru  nt1tpe  ociad a2elump;(4aexomr3totfp rli o;s) 2xo(o3ny4omtemicsl(farraxrpou1opeo f3ild a2el(vp t)aetniociodfaDelnei;t0sruo(rpio1om nlieil(fa2urxr ot4aex ii3iadfmDelumsnt)aetrxrciotla  anvol() ruo(o3oo1oltnlictlt)srrmxr ;t4oetomf3tas s2umnms u)tltrmf3tydlaDelnei;s  2urxo3io4lpeelfvs ()sDtmu pou1oet mf3ilsfa eanms;u0 lenxrciy1fpDeai il(  etmim3nudom n nvt ()a2umurp;u0tet if3tls aDeau s u0aleoxrctatlpte ivsl(  rxr(rpno1ll nmfctltfsrtm(r ;u1oexn f3ildlm2emn s;(4 exnio ty1fmte u o;(0teuoim iu4lp  mfct ()aruru ono1aeenif3iltla2rlump;t4texrmo iotlm e ivs;s0t2xriopnu1omenmfei tfs2rm(roou4ale moctlt sDumuvp;u4trxomfcoatfmt  i o (0s2urxo iy1lm  livtl(f Dumu oot4tpt  ietysfmDum(mp (0texnif ootfa elivo;s  rtm(r iudamtemnvia(farta( p;t4tleo i3iadfm2um(vo;(0 eenif iadfp r ueilt srtm(r3oy4llt  ivt s  2tm(mp;o4optnmociyt a rauvo (0 leoioctodoa  lu i;s0 2um(m nydape  ivsa()artm(rpoo1aet  ictytlm emnvs u0aeenmfctytopDr neo s)trumxo ny4am nmfvi sf Durxrpou4aeen o3iad m2elnmonu)arxnircoy1fatrli s;s) eumirpio4om elietls) 2urum ;o1apen fciatlm2eanvs;t) lenifcia1om e ueols trum(r3no4ll elivi ( srua(moou0oeto ictydlmDuau onu0trtomrcoatlmt  ivi;s s2tm(r oodalenlivi (f Drm(rooo0tpxnii3tydfsDelu on(0tltnmf3iatfp   ies s0 rxr(r oy4alt lfci (f rrau pnu1tlx if3tad a em(vp;u4altrir3iodla  lu olt)teuoiopnydapeemnct t a2rmurooo1oetnmfetldfs rmuvs t) renifcoadfmDeauvo;() ruoxr oy1alt  ncia( aDtr(mpoo4aptniieiasfs2uln o u4 etnioctotfm rau i;t  2uoxopny4lm  mfcsasfs2uaxrpot1teto ieiyt sDuanms t)texrirciy1lateaieo;(0 rxrxopny4lpt  fvi (f Duaxr nt4ale mi3iyt m ua(vo;u0 rtrir3oatfmD livi;t)t2xm(m nu1lpenmfcsat) Drmurpoo4aex ifciadfa uaump ()aetniocootomDr nvsls  etm(r io4amt miviltf rum(mpoo4aexnii3ildfs2um( o;u4tleomr oatomD  neolt0t2urirpnodoptnmncsat  rra(rooo4ole  o3iasla rln s t0aeenmo oydfmDr u s;t) exoim io4omenlfvt t  2rr(m ;t1apeo ietadla ul(vpn(4treoxo iytom rlnes (0 2toxr oudomenmiciat aDrm( oou1opt ioeiadfsDeluvpnu4aexoir ty1fmDelieil(0 ruo(m3nodamenlnct s a2tru pnt4tetniieilt sDeluvo;u4alerircia1fpt au o;s trtoxmpiudomtnmivi t  2rr(rpnu0aptoifciys s2el(vsnu0texrif ta1omtelneo;( trxrxm ny4oltelfei (f rrmumpoo1alxnmiciad s2um( o u) lermrcoo1lmteaivo () rxm(o3oydlmeelici s) Dtauronu1teenmocils a2umums t4tltoxr3tatlat lnvi;t0 eum(r oy4lmen fetat)srua(mpnu4teenifeiatlsDrluvo u)aleomfciatom e nvs t0trtrxm oodlpe licslsfarurum ou0aet  f3ilt aDrm(mo t4 rtrmf tadfmt luvs;s)s2tr(m ny4ap elneil(faDrm(roou4oexnmicildfsDeanms t0trerio3totfaD  iei;s0srtoxr iodlmtemfcs () Dtmumont1ape iociltls emnvp t4trenmrcoydlmDe n s s)trtmir3iudom e iesltf rraxr no4tpenif3ildfa2rauvp;()altoir tadlm eai i;s0sexoim iy1ll nmnvt tfaDrr(r nt0oleniieiadla2eln s;(0trenmoctadopD an o;s)texmxopiodlmt lfvs sf Dur(r ot0alt ifetltfm2emumo;u4 eeomf to1op  ai i t)setmxm3no1lptnlneslt  2umuro;o0openiieildfm2rmump;u) rxomo iydlmDrai i;s0 ruoxo no4lpte nvtls artmumooo1apx mo3ilt m2uauvpnt0trtoif iodomtrlu i;s)t2xoim3oo4lp nlfctlt  2rm(r ;t4tptn oeild a2uau s;u4 ltnmr3totfp rli ils0srxrxr oudlmenlncsa(fsDrm(  oo1opx  o3ild aDrlump;t)arermr3tatfptrauvils)s2xr(r oy4lpenlnet tf Dumxr ou0optn o3iadfaDrm(vp;t4aetoxrcoo1fatrlueo t) rtoim3iy4lpt lieta(fartru onu0apxn fctyslm2um( p u4arxoifctydfaD aneo;t)t2tmxr3ou4lm elfvslt)s2rmx  nu4tee  f3tadfsDumuvpn(4 lerxr3tytomt aneo (0trto(r3io1amte netat)srumx  ;u0tetnioeiytfa2rlnmo u0trxnircto1lmte nei;(0teuoim oo1ol  lnciatf Dtm(mpot4teenmi3taslm umnvp (4altrir3iatlmt li o s0s2urxm ny4al   ivt ( sDrm( o;o0tltomfetadlmDrau pnt4tlermrcoytopDraiei;s srtmxopiy1omenmfct t) 2rmxr ot0apt if3iytlsDrl(vp t)aexoir3iatlp eluvs;s)t2xrxmpiodoptemfcs (faDtruroot1tlxo ieiatfaDrmn onu0aeerxoctytlm   i s t0 exr(o3nu1omeelfcslt arumump;o1oeenmfetysls umnvs t4 reomoctodlpt  ieil( trxr(rpoydom elfvi tfaDumxr ;u1alxo ietadlsDul(vpnt4 exomo3iotfmD lieo t trxr(opny1al emfcs t)aDuaumpnt0tpxn o3tytfa el(ms;u4trtrif3iytoaDelnvo;t) eumxo3iydam n fcsat)srra(r oo0olxo oeiat sDum(mpnu) renmoctadfp raueols t2urim nodole  fvi t) Drmumont0texn o3tld a um(vsn(4teermr3io1op  auesls)t2trim3io4olt miei ()s2ua(rp;o1tleoifeildlm emums;()tetnxrcoatfp e nvilt srxrxo3iy4aptnmietls  rum(ronu0oeeo oeiltlaDrm(msn(4areoiociytfatrlnvs;s0s2tm(opnodomtemfcia(farraur ot0oeen iciys s rl(mp t0artnmr todfp  an i s0 exmim3nudom  lfvt tf Drr(rpou1oee mf3iysfa uluvp t)tetomo ootfpDe n ilt0 exr(o oydam   nvs tfsDtmu  ;t0tpe io3tasls elu on()trxoxf ty1omtr nesls teto(o iu4am elfvil( srurumpot0oeeo octldfsDuauvs (4aeeoxf to1lmDr uesls)trurio3oydomtnmfesls  Duau ont1texniocilsla2ranmo ()arxnio iadop rlnvi;(  etoir ou4opt mfct t)arrr( pou0oexniiciysfm eanmp;u4aeenircoodlptrauvols)srtmio no4alt lfvtlsfa2uax o;o1openiieiad s2uluvonu)alerxo tydom e ueil( trtoxo oy4lptnmnei s  2rrum nt0tleoifetlsfs2em(vo;t4altrxocoatlmte u i t0 etoxm3ou1ale  nci s  rrr(  ;t1ape mieiaslaDrm(vo;u)areomr3oa1oa e ies;()t2ur(o3iy4lm e nvsatf rtrumpot4alto feiadfa2ua( pn(4arxnmo oatomD au s (0s2triopiu1ol nlivsl()srtm(mp;u1oexn i3tydfa2ra(mpn(4 rtnxfctadlmt lneo ()s2urxo3no1al  mfvilt)sDumur ;u1opt  ocildfm rau s;()teerircoo1fpDraivs s0truo(o3iudlm n fvtl(faDtmx o;t1aptn f3iys s um(mo;u) rtrmocia1la   nes s0seumimpoydlp elnvs s srrru  oo1apeniieiyd m2uau o;t0aleoir iodla rauei s) rxmxo iodome mfetlt)a2trurpot0ole ii3iadfa em( p;t4aetrio3oadfateluvo;() rtmxr3nu1ale miei t arurur ou1tpt  f3iatla ea(vs;() renir ootlm e ivs s)srtmxr oodllenmiesas a2trumoot1tpeo iciaslm eau p t4alxnxrcoo1fat lu i s0t2urxopny4omen iesl(fartmxroou4alx  iciadfm2rmnvpn(0 exoio3oodlm eaneilt0t2umir iodalt mivt t  rurxrpnu4olxnmoeiyt aDulnms u)areomf3iadlat lnvs;t)t2uoim iu1opee ietlt) rtrxmooo0aetn octlsfa rl( o;() rxomocoydlpte n i;()srtoxo3iu1ame lneia() rraxro;t4tpeomiciysfa2uaump;u)arxnxr totoate nvo;(0 exmim nu4apteliciat)a2ur( ooo4opxnmf3iysla um(vo;t4 lenio3tatomDeanvo t0trtmimpio1op e fctltfs2ua(m nu0tex  f3iysls2ranms ()artoiociadomD  n ils) eum(mpny1olen ncias  Drm( p;u1texnif3iytls ulnms;u)alxoir3oodfm eanvo;t0 euoimpoydom nmivias)artaumpnt0aet miciadlmDem(mo t) lenxo oatopDrlnvi (  rxrxopno4llee nes t aDum(  oo1tpxn ietysla2umuvpn()tlerxfctydopDrlnvs;s)s2ur(o ou4ol elfvs s srum(m nu4tptoioeildlmDemn snt0 exomfcoa1lpDeaneil() 2xriopiy1lpe lfvi t aDtr(mont1opxnmfetasls uluvpnt0arxnxo3oytlp rlnes s) etr(r nodlmt livs (fsDumur ot0aexo f3iltlm eanvs (4artnxfcoytfp rlies s0texmxm3iy1aptemnvia(f rrmur ;u4oltnmo3ilt mDrmnvonu0aexoio3oa1fmtrlnvs t) 2toir oo1lmeelnei (f Dtrxmp;o0tet ioeiys mDem(mon(4 eeoio3iydfp eai i;s0 exoxo iy4ole  nctlsfsruax p;u0apx ifciysls rlnmont4treoifcoadom raivols0 etr(o iudllenlivtlt)sDur( ont4opxnmoetltlm rmuvo;t)tlermrctatlm r i ol(0s2xm(o ou4om  mieils sDraurpot1ole ifciatfs ea( onu0 renxo ty1om  aivs;t0s2uo(r3oodlpee iesat s2rmxm nt4tle ioeils m raumont0aeerxo3iotfpDr uvo t) eurio3no4llte ivt tfaDrr( onu0oexo i3iytlm2uln o u) lxomr tytlpDr uvs (0t2urxr3nodlpte nvtltf Drau pou4tleo o3tldla2emu p t) exrmr oa1fat  uvi;t)srtmxo3ou4lp  mivtltfarrrxrpnu0tptoio3tlsfs2ulnvp;(4 etnxfcoo1fmD  iei s0teuoxr nydlmenmfes tf Drr(rpoo0aetoio3tas aDra(mo;(0 lermo oatfpDrauvo (0srxrxo3iy1om   neia( sruau pot4tlxnif3ias mDrlnvs;u4 rxomf iodfp ran o s trtoimpnu4oltelicsasf 2uaxm nt4opxoio3tld s rl( s u)tleoir ta1op   ieo;(0s2tr(opiodame mfetat sDum(ront1aex mfctat m2ulu p;u0 lenif oatfm rlieols)truoio nu1aleelnvi sfs2tr( ooo0aleoiiciltlmDul(von(0tlxrxr3totlptraivsls) rtoxmpnu1llt lfvi ( srraur nt1tpe  i3iydlaDrlu snt) eenxf3iydlmtran o t t2toirpnu4alt lncsls srur( ont0oleoiocild m rmuvs;t4 rxoxr3iadfpt an ilt  rtoxr oy4oltn fvsat  rta( onu0tpxn fcildfs rm(vs u0tlxoif totfp eai i;()srurirpnu1amte nvtat  2rrx p;u4alx mieils a2ua(vp;t)trerir tadopDrln o ()t2xoxrpno4opeemnvs (fs2umumoot0oet mfeiysfm2uln o;u0arerir3ta1fpt  nvo;s0trtmxmpoo4apee ict ()a2rmumpno0tlxomfctat s rl(vs;u)aexnio ootfmt au i ()trurirpnu4apte fcslt) Durxr ;u4oeenmiciat s rmn p u0 rtnioctadopt lnvo;( trxm(r iy1am emietas)a2rm(r ot4oetomieiadfm elumpnu) rxrmocio1oa eln ils0truo(rpno4ap   feilsfsrtruronu0optnif3iadlmDul( on(4arxomo oytop rln o s sexr(o3io4lptnmivta( a2ra( oou1alt  i3ils aDran o;t) lxnifcty1latrlu o;s tetr(m nudamtnmicsatfartmumo;u1altnmfcilslm umump;t0arxnxrctydoaD  ivs;(0 rurxmpiydam e nvias) ruaxr nu1aptniiciasfsDrlumsnt4 rxoxo3ta1oa  li slt0trum(r3oydlp emfvias)artm( p;u0tpxomo3tatla2uau p t0aexrxo3iodfatelivs (0 2urxmpno4omt miesl(fa2rrxmoou4oex if3ilsfa rm( o;u4 rxrmf3tadomD ln i t  rxmxrpnu1lmtnlfcias)aDta( oot1olxniieiltlsDea( ont0 rxomociadla   ieo (0 2xo(r no1olt  ncslsf rrrx p;t0texnmo3iys s2um(mpnt4tltoio totfm r uvs s s2xoim3oo1omeelfcsas)sDra(mp;o4alxn oetatfsDeluvo u)arxnxr3ta1la eluvil( srtmxmpny4apeelneias a2tmuroot4aee mo3iysls2rlu s;()altoxr3iadlp   u s t)sexr(m no4amtnmicilt a2uaxmpno4tpx miciytfaDeanvpnt)trtoxf3iatopDe nvolt) 2trio iy4ole lfei t  2tmxr nt0altnii3tas m2umn onu) exoiociodlpte u i;( s2uoxr3oodame  ivi (f rtmxrpno0olto ietls aDum(mp t) lxrif tatopD livo;(0t2tm(m3ou4oltn fcsltfsDur(r oo4oexn octasfsDrm(vo t) lxrxr tadlpD lnei;(0t2umiopoudopteliesasfa2umumo;o1optoifcildlmDeanms (4arxnxr3oatfaDrln o;s) rurxm3iodap n fvsasfa2umumpot4aptn o3iytlmDel( p;t)tlxrxf3iatopte nes t)setm(o3nodll emnvsl( sruaxmpno0oltomi3iys m eanvp;()altoif oadlptran ilt srxo(r ou4altemnes tfs2ur(r ot4ole  fciltlsDem(mo;t0altoir oatop r neolt  ruo(opio4lpt  nesat a2ta(mpno4oleoio3tltfm2rauvon(4 rxrmr3oadlmDr u i s) etr(r iu4ap elicia( s2rrxro;u4tpto ieiat mDuanvo;u4alenio iodlpteluvs;t)s2ur(o ou1amee ncslsfsDtr(m ;t0aexoiietld s emuvo (0altrmf3oodoat  ues;t)trtmir iudlme mfvs s)sDra(m nt1oeeoii3ils s emu pn(4aexoir totop eaieol( srxrir oy4aptn fet t) rumx  ;t0altoioeilt s em( onu0 reomf iatfp eluei s s2ur(r3oo4amtnmivs s aDrmxroou1alx io3iatfm2emu o;u4tltrxoctodoptr i s;s)sruoimpoudll  mfvtat aDtr(roou0tee ii3iadlmDrmu p;u)altrxf3to1lp r nvi;t tetmxopou4lltemiesl()s2trxm ;t1oetn f3ilslmDum( s;t0aeermo3tatfp  aueols)sexr(r iu1opte icsl(f 2tmx o;u1olt  feiatfaDrmu s (0teerifctydlate n o;(0t2tm(rpoo1ll emnesltfsrtmx pnt1aeenioetlt a2ua( p;u) rermf tytfateaies;(0sruriopoydal emfcsa()sDta(mo;t1aex  f3iydla2rau s;u)arenmf3oatfmtrlnes t0t2trim3oy1lm  lnvt sfsDuru o;o1apenmieiyt aDul( o;()tleomo3ty1omD aneil( s2xmxrpiy4olenliviat arrmur ou4optomoeiydlmDumnms u0 eenmrciatfaD luvs s)texmxmpoo1aptn ivta(fsrumxrooo0tpxnmieiyslmDrm(mo;u4arxoif iydom ranes;s s2tm(m iodoleelfvsa(f 2uau o;o0alt iicildfm um(vs t)tlxnxrcoatlaD  n o t)srtrio ou1ap e ieia(f 2ururp;t4tltnmictydfmDrl(vp u4tltoif3iodfm raueil( s2xr(r iy1ap   nviltfsDurxr ;t1apto fciltlm2rl( o t4alenifcio1fat  iesls0s2xoxopnudlptnmfvilsfsrtmxrpnt4oeenmfcils sDel( pn()areoir totfaDean o s)trtoio3iydom nlfvs t) 2um(r nt1olxo i3tasfm2umn p;t)teenmf oy1fptelivil()s2tmxr3ny1lpeelfvi tfs2rrx p;o1tpe  fctltlsDem( o;t4alxrir3oodoa e i ilt)seuoio iodap  lnes (fsrrmxmo;t1alxniociatfaDranvp;u0areomf3oydoptelieo ( s2tr(mpiudaptemivsls s2uaum nu4olenmi3tad m el( pnt0 ltoxf3iotlmD  ues;t0 2uoiopoudopen nesls sDrru ooo4aex ii3iydfaDrlu o;()altnmr3tadlmtrauvols0trtrimpoo4lmt  fctls)arta( pnu4apeo ociasla2umnmp;(0teerif3oodom elnvo t) rtrxm iodlpt lfcsl( s2rmu  ;u0ape mfcils a rl( p;u4trxrirciadlmD ln s ()trto(r ny4om e icslt aDraumoou4optoioctyd sDuau o;t)tlxnifctydlatrlieil()srxoirpoodlpenmfvtlsfsrtmu p;u4apxo ieils mDrauvs;u0tltoxr3tatlpDr nvs t0sruriopoo4olee icils)arumuront1aee  i3ildla ul( s;u4 rxomfcto1lm eluvi (0s2tmirpoodllte nvtas)aDrrxrpot4openmfciyslsDrm(mo;() ltoir io1lpt  neo;( t2um(rpny1om elivtl() 2uaxmpno4oetomfeias s emn o;t0 rtrxo iydopt anei t0t2trxopoo1ome  nvsat sDrmu  ;t0texoioeias a2rlnvs (0trxnmf3totfatelu slt setrxo3oo1omeelnei tfaDtmur ;t0optnmi3iytlm rmumonu)artomr3tydfa rlieilt sexmxrpiu1lmee nvs s s2uaxmoou4tle mictldlsDrmuvp (0aeeomrctydfm   uvs;s  rxm(mpiydomenlict s)a2ra(mooo0tpeomoeild s emuvsnu0aleoiociotfmt aies;(0texo(r3oydop nlnesat  2tmxm ;u4tltn f3ildfsDrau ont4aleniocoatfptrai s t0trxrirpnydllt mfeil(fsDtax  nt4apx mo3ildls2elums;t4aleomf3ty1omDe ies t setoxm io1lleelfcslsfsrrr(mp;u0teenif3tysla emu p u0 etrxf tatomtr n i ()sexm(o3nudom nlies s aDua(ro;o1ope if3iys aDranms (4tlxrxf3tadlpt  n sl(  2um(r iu4ope  fciat srurur ;t4optnmf3iytla ulumsnu0trxoif3tydfmDraies ()s2trxo iu1olee neslsfaDta(m no0optnmo3iydlaDemums t4tleoiocty1om  aneils0texmirpoy1om   fcil(fs2ua(m ;o0opeoifciat m2ulump;u4aeenxf3oadfptrli s;( trxrxo io4alte icsls)arum(r ou1aexo fcias m2rm(ms u4arxrmr oo1omDe nvs s)s2trxo nudaptnmnvsas)srtax  ;t0tltomi3tldfs2rmuvo;(4altnif3iatomt anvsl(0t2xoxr3io1ll nlfvt s srtau  ;t4aexn i3tydls2rlu s;()aleomociy1fateli s;() 2uoio nydop emnet (  rrr(  ;t1tltnmoeiysfm um( o (0tlxrio ia1opte n slt trurio oy4op   fvi ()arrmumo;u1tlenifctasls rluvs;u)tlenxoctadlat aues;(0t2umxr3iu1opt mfvil()srtrx ono0opt mietls m2umums () exrxo io1fa  li sls  euoim3oodlmee fcslt)s2tm(mp;t1teeomiciltlm rm(mo;u0trxnmf tytfpte u ilt) 2xmirpnudol emnvt s a2trum ;o1opeomoeiat mDrm( p u)tetrmo3ia1faDr ueols) eto(o iodoptn ivsls)a2ta(moou1tpt mociad sDuanmsn(0 exnif totlp e u i s)t2urxm3nydlltelicia( artmumooo4olt mo3tys a2uanmo t0aetrxf3iotlmteauesl(0srum(o3ou4lptnlivs sfaDtrumonu4aleo iciytfs2ulnvs;u)alxnmfciytlmtelivols0srtr(m oo1lmen ictls srraxroou0oet ifeiatla2rauvs ()areomf totla  lu i;( t2trxo ou1openmfvt ( arur(rpnu1tpe  fcilslmDuanmonu4 etoif3ootfaDraneils  rxrxmpoydlm n ieiat)srtax pou1tpxnmieiytfs elnmo;t) lenmo totoaDeln o;s)truo(rpno1lle mfci t sDuru  ;t1olx iieiasls umu s t) lerif3oa1oatelivi (0seuoxrpnu4ll   fvt t) 2rm( pno1alx mo3tld mDra(monu0 exnif oadlmD  n o (0tetoxo oudop n nes ( sDum(r ;t4optnmfeiys sDrmn o u0tetnio ta1op rlneslt0s2xmxr oodll emfeil(  Dumxr ;u1ape ifeildfmDrmu pnt)tetrxfcoatomDe u i s) rtr(r3iy4oltnmnetlt)srrax oou1olt iiciasls ul(vs (4 exrif tadlmteln o t s2trio oydllen ictl(fsrra(mooo4aexnmieilt a2uanvp (0tltomr3iy1faDe i o;s) exoim oydale mictat artaurp;t1tpto ociad sDumnmon()arxnxo3oy1lp eaivi;s  2trir iudopt mfvi ()a2rmu oou0aleomieiyt m2um(vpnu)arxoxfcia1laDrli slt0 rumxm ny4ape  iet ( a2taumoot0oexnifeildlm rl( o;t0trxrio3oa1op  an s;(0 2xmxo iy1ameelnct t)sDua( pnu1oexn ietyd a ulnms;u0tlenir3to1oatelivilt teurim3oy4lp  mnvs (  Dum(r oo0oex  fctydlm rm( o;()arxrmociadfp  anei ( texoirpiudamtnliesas)srumxm ;u1tltoifeiadlmDuluvp;u0 lerio ootom   iei;s0trxoio oudal e fesat aDur(r ot0tltnifctld a2rlnvsnu4 etnioctodopDrai o;s)s2tmio iy1ape mfeils)arraxr oo4tleomfcildlaDrl(monu)aeerxo3ia1omteai o;s  2xm(r ou1oltemfeslt aDtr(  nt4open o3ilt m elump u)tleoir tydfpDeln i t)seum(m iu4omt mietat)srtrxmoou0oexo f3iys aDemuvs;t4trtoxo tytlmtrlneo s)s2uoxr3ny1altn ies s sDtmxr oo4tpt moctydlmDrmnvo;()trtrir3tatlaD li s () exoimpnu4opeelivt sf 2tm(mo;o1tex  ietyd mDum( s u4 lxoxfciatlmDelnvo;t0 rtoxm io4altemfcs ( aDtrxm ;o0open ieiasfa rlumo u4 lxoxo3ia1omte neo ()sexmxopnu1omt mnvilt)a2rr( o;o4oexnmociydla ulu o;u)texnxfciodoat livols seurxr nudamt  fvslt aDrrump;o0tlto oetadla rl(mo;(0alenmf tadlmtran ilt  2toio iy1lme livslt) 2umx  ;t4tlxnifeiadfm2rlums;(0arerxo oy1oaDrln ils0srtoxo ou1optelfviltf 2uaumpot0tpxomf3tadfa umumonu0 renxo3iatlmDraivil(0sexm(r iu1ap nmfvtat  Draum ou0opeomo3iyslm2uauvs;u) rtnir iadlpt  n s;s0seur(mpno4lmen nesasfsDuax ooo4alt mociyslmDul(vo u)texrif3oadfmDrai s s s2xoim3ny1lp n ici t)a2uaxm ;u0altomfetldfmDranvonu0alerio iadfa  aivi s) 2uo(r3ou4amenmnvsls srtaxmo;o0apxnmf3iltfa2el(vsnu) exnmoctodfaD  ues t)trumio nydllee fctasfaDuauro;t0tlx  i3iatla2rmu sn()trxnmfcty1faDrau o t) exrir3oydalen ncs sf Drr(rp;u0aee mictlslmDrmuvp ()texnxf iydlmD lueo;s0t
\ No newline at end of file
@@ -0,0 +1 @@
+uvols0teur(mpiodal nmics t)aruaur ot4tpt iociyd mDrlu p;u)areriociotopDeln ils) etrxm3iu4lm nlfeiatfs2rmx oot0alxnioeils a2rl( sn()arerxf iodoateanei t)t2toxr3io1ap  lnci t arrau  ou0tpxomieils sDumumon(0aexomrcta1opDrlneol()teuoxmpoo1opeemncta()srur(rpnt4olen f3iydlsDum( onu) ltrmo3oodlp e ies;( s2xoxr io4lltnlnetatfsrta(mpoo4oltoiiciysfa umump (4 eermf3tatfmt lnei ()s2uoirpnodam  lfvt t  rtru pnt0oexnmo3iydfs2uaumonu0tleoxr oa1omteliei;t0 rtr(opou4ap   nvtatfa2umum ou1aetomfetadfmDrln p;u4 ltnmocia1lmteauvi;t) rxmxr nu4lpe mivt s  rrmu o;t0aptnmfeilt a raumpnu)areoirctatla e u olt0sexr(rpnu1lpt  fviasf rrrxrono1alenmi3tatls2ra(vs;u0 eeomr tydfmte i o;s)s2um(m3nu1op emfcilt) 2rrumo;u1ale mieildfm ulums (4 eeoiocty1latrlnei;s s2tm(rpiudlltnmics t) rrm(rpnt4aexomi3tls s rmuvs;(0aleoxr3io1fp r ieo ()seuo(rpno4ope mfvt sfarurxr ot4aetomfetadfa2rmump;t0 exoxo3tadoate u s ( texoxm io4aptn nvslt)s2ta(m ot1opx ifetad aDel(vp;() exniocoadfaD auvslt seumxr3oodlpe lici () 2um(mp;u1olt mo3tasls em( onu4 etnio todlm e neol(0srxoxr3iodop emnetlsf rtaxro;t0aleoii3iatls uanvpn(4arxnmfcoydfpt  neol()trtr(mpiodlmenlnei tfsrtaum ot4aeenmictls a2rm(mo;t4 exoio oodoaDe nvs (  2umir3no4lltnmfesls a2um(mp;u0tetoiociysfs eau sn(0alenmf oodlate ivils0srumxm3iu1am e nvt sfsrtm( onu0olxomf3iltlm2raumsn()trtoiocoydomt lu ol()setmxm iu1omt mfvs (  rtau p;o1oet ii3iltfaDelnmp (0altnmo3todomt  i il()t2xrxrpnydllt lies s) Durumpno0altn oeiasfs elnvsnt4tlxomf ty1fm e n ils)t2umxr oudamen icil(  Dua( pot0apeomietydlm2eanms;t4arxomfciodopDraieo;(0 eurim iydlpte fvilt a2urur ot0tle  ieiysfm rln s ()tetoirciatfm  lneolt) 2tmxrpno1alt mict t) 2ur(mono1oeenifeild aDrmumpnt0aetoxf3tatlpt aneslt)srtoxrpoydll  mnei (  rurxmont4aexo fcilsfm2el(vs t4trtoxrcootlptr nvo;t  rtm(o3io1lme lfviasfsrra( pno1oexomieiydfaDrl(vpnt0 lxrmf3todomDr ueils0s2xoim3ny4op nmfci s  Drm( o;u1aeto oetlt m2umu o t0 rtoxf3oodfmteaivols  etoxr oo1omenmnvi tfsDur(roou4oleomieiadfm2rmu o;(4artrir3oa1faD lnvo;t trxoxopiy1om n ivtat) rtrxmpou1aexn octlsls2el(vo t4aexrircoo1oa ean i;( texmiopoydap  mivi s)artaurono1aptnmi3tadfa ean sn(0tlxoir3iy1la  lneslt0srtm(opny1opt  nvilt)arumx  ;t4altn octldlsDemnvpnu)tlxnio3oadoaDe nes (0trxmxo3oo1omte fvilt s2rru oot1tpxo fcilsfaDuauvs;t) rtnxo oytlpDr uesls0s2trxo iydaltnlfctl(fsDuaxmonu4oee mi3iltfs elnmo;t4aeenir3iodfp eanvsl(0 rxmxo ou4am nlics t)s2um(rp;t1oltniociydls rl( o;(4 etrifcta1fatr n ols s2umxr nudal n nes () rua(rpoo1olx miciatfsDraumont4trenif tydlat  nei;s seumio3ny1apeemnei t artr(m ou0olto fciys s2ranvpn(0arxrir oydfm  an o;s) 2uoimpio1aptnmiei tf Dtru  oo1optn ieils a2uanmo u4 lxoio oadfmDr ieo ()texoxmpoy4olee nvilsf Drru pno1oex ifctaslsDeaumo;()alerir oadomt luvs;(0 2xrir3oy1lle miet (f 2trxmo;u1tex if3tyt a2ra( p;t)tetrio ta1oaDr i s;(0t2uo(r nydal   ivs ( aDrru  ;t4tptoiociltfs2el(mpnt) rtoio3tadomDr iei;( t2xrim3nudlmte fcs ( a2ta(ro;o1oeen o3ild sDem(vp (0teenmf oa1la rluvo t0seumxmpoo4altnlfctas)sDrmxrpot1aet moeiatfa2ean o (4tleoircio1fpte u sls) 2trxm3iu1omtemieias)aruau onu4tle mf3ildfs uanvs u4trenif3tatopDrliei;t  eur(mpno4lltnlneta(  rra(m ;o4tpeoif3tadfm2umuvp (0trxrmf iy1op   i o;s0trtoxrpiudapee iei tf 2raum oo0tlt io3tldfm el(mpnt0 ltnir3tatla rlu i;(  2tr(r oy1lltn fetas a2rr(r ;t1olxoiictydfm2eluvo (0teenifciotop   ivils)s2tr(rpnu1oltemnvta(f 2ra(mooo1apxniieiyd m emu p;(4altomrcootomDe ies;( s2xrxr oo1apenlfetl()s2rmx  no1teenii3iydfa2rlnvpn()tlxnir3to1fp  lu ol() exrio nydomtnlnetls)srrmumo;t1tle ifetyslsDraums;u)altoio to1fpDeauvs;s sexoir3iy4ape lies t) rua(mp;u1opx ifeiasfmDuln onu)tlenmfctadoa  livol( teurxrpoudop  lici s sDuauroou4aeenii3iadfm2ulums;u) ltomo ta1fmte ueo s) 2tr(r3oydalenmnesasfs2tr(r oo0oexomoetatfm2ua(vs u4 exomo3iodlate i o;( srumiopoudamte nesas)arraum ot1ale mociatfs ran pnt)artrmr oodfa elnvslt0trxrxr3ny4omtn ivs ( sDrrxro;t0teenmf3tlt m2em(vp u4tltrmo io1oaD lneo;t trxm(opio1op nmivt (f 2uru ono1aeenmo3tadfmDrlu p t)tlxnmrcoy1lm   uvil()s2toxo iydamte fvia() Dra(  nu0tlx mf3iltfa2el(vs;u)aleoxociotop eluvo;() etoim no4omt  fvia(  Dtm(r oo1tex  f3iysfmDrmump;u0tlxrmocto1lptranvi;t srtm(m iydapeemfet ( a2raum ;t1tpenmo3tytfa uan o;t) etrxoctytla   n s t s2xr(r3nydaptelneslt arurxr ou4alxomieildls ua(vo;(0 exrmrciy1la  aueol(0seumio3ny4ol   fci (  rrm(m ;o1ale  fetydfm2uanmsnu0alxnxocoydfpD lnesls0 2xoimpio1ll n iesasfa2tmurp;u4tetn ociydlmDum( o u0tlerxf3tytoatrai s;t0setmxm3ny1oleelivtat s2rmuro;o0optn feiadfs2rluvs;t4texrxocty1fpDe ueo t)s2trio3io4al nlfct tfa2um(m nu0olxn oeiyt m uln p;u0 ltrxoctadomDelueol(0 rxoio3oo1ale mfeiat sDtr( pnu0tptnmfctydfmDra( sn(0alerifciadlm rln i s texoxo iydlpte nvtls)s2rmurono0olenifcias sDul(mpnt4treoir ty1omD anei t0trto(r3ou4op e ics s)s2tax  ou4aeen f3iad s2uluvp;t4 rtomf iatoat  n i s)seto(o ou1llt lnvtlt sDuax o;u1tleoif3iatfm2em( o;t0artoir3oydlat luvi;t0trxmim iodlle liet s srurxr ;t4oee mfeiltlm2rmu snu0artnxf iatfaD ln o;s trumiopny4oltelnciltfa2ra(mont1teenifctls aDemumpnt) eeomrciadlpDrlu i;t0 eurio3iu4oleelfvia()sDra(  ;t1ale  iciyt a rlnms;t)aexoxr3ta1om rlieo ()srtm(r nodlmtnlieia()aruaum ou0aee mf3tltfmDua( s (0alxoir iydop e ueo s0trumio iu1lmen nvs t arrmxmp;o0apxomo3iytfs2em( p (4tltoxfctodfatr ueol(0seum(m ny4amtnmnvils arrmxmpnu4aex mo3iasfa um(vsn(4 rtriocoy1omtelivs;t srxrimpnodamtelnvtl(fsDumx oot1oex  o3tyd aDul(vp u4aeeoxo tatfa r ies ()t2tm(m iydlmeemfvsat a2taur nu1alxnifciat m2rm( p t4 rxnio3iodfpD ai il( t2uoim nodapt mneil()aruaxm no0olx  i3ildfmDrln s;u0tlxrmfcootfptrluvilt0 2um(opiu4optn fviat)arurxm ou0teeomfetatlaDelump u0 rtomfcoodlpD  i s (  euo(m iydal emiet t) Dumur nu0olenmo3tldfaDrmu s t) exoxo iotfm r uvs;s s2trim ou4lme lictatfa2raxmo;t0tlx  fetasls2uau o t4trermrcootopD  u i s)s2xmiopiu4ap emfct s aDtru oou1tpto o3tysfaDraumo;t)texnxf3iotoa  anvslt)srtoio3no1ap emfetasf 2umur oo1teen feias m rmn on(0teerifctytfpt lnei t)srxoxmpno1amt  ieiat)sDrmumo;o1tpt  oeiysfmDum( onu4 eerifciytfat auvsls0 2uoxo3oy4apt  ivils s2tru p;u4aptomi3tldla um(vonu4areoxr3oadoat  uvils  rtmxrpiodamtemncsls) rumu  ot4aptn o3ilslm2uau s ()aetoxf oo1fa rlnvo s)truoimpiudllte fcta() rrr(mp;t0tpe mfciltlmDrmump (4 ltnio ty1om  luvols)t2toxmpnydomen ieias arraxm ;t0tlt moetyt a2rm(mo u) lerxf3iydomtelu i;t) rumxmpno4ope lnetas s2rmu o;o0oexnii3iydla elnvp;()tltoif oydfaD  i ol(0trtm(m nydal  mnct t) 2ra(mpou0alto fciysfs2emuvp u0 ltomr iydoptrlu s t  rxo(rpnydll  lietasf rrmxmont1tpxn i3ildls ua(mp;(4 etoxociodfm  an o t0trxoxr iu4ap   fct tfs2tmxrpoo0tex mociyt a rln o;t4trtnmf iatopt lies;t)srumxrpiydlleemivtlt)arur(mo;o0tpxniociyslmDemumo t0alxrxfctodlptraies;s  etoio3oy1alenlivtls srum(rpnu1teeo octas m2raump u4altoxocoytfat  nvo;t0tetmiopou4alt livilt)s2tmumoot4oleo f3tltlmDrl(mpnu0 lerxr tadfat anvs;s0texoimpno1apenlnei ( arraxrpnt1open o3ias s2emuvpnt0 leoxfcoa1laD  neo;s)tetoxm iy1ole lnvtlsf Drrxmonu0tpeoioetat m2emnms;t4trtnxocia1opDraivo;s0t2toxr oo4ale lnvs sfs2rmu o;t1tpxoif3ilsfsDemuvpn()altrif oa1lmDraieslt0 rtoirpiudlptelnetlsfaDraxm ;t0oleo fetysfmDea(mo t0tetrmr iydomDelnesl()s2toxr3oy1om nmnvs (fsDta(r no0aptnmictlslmDua(vpn(4tleoir iy1lp  lu s;(  2xr(o3no1alenmnvs ()a2uaxronu0texo f3iltls2ua(mo;u4altoif3ootoa  aiesl(  exmxm iodame mfei ()arumu  oo0openmoetyslmDeauvo;(4 rtomr io1la  aieslt0 rtmxmpiy4ap  liet ( srumxrpot1teen i3iltfa2um( pnt4tlxrio oy1laDr u sl( trxo(o3ou4lp   nvt tfaDtmxm nt0altnmf3iytls rlumsn()aleoxrcto1fp e i i t)trxoio oydam nmncta()arumum ;u0teeniictltlsDran pnt)aexoif oodfa rlivilt) 2xmimpoodape  iesls)sDra(r oo4apeomocildfa rm(mo;(4texrif3to1oaDranvo () 2xrxmpno1ol  mncilt) rrrx p;u4ape  fetydfm2elnmont)tetoxo oadoat  uvsl( srxo(rpiudal  lnvt tfaDrauroot1tltnmietadlmDel( pn() ltnio3ty1fate ivslt)s2uo(mpio1omt mivias) rrmx poo0oltn ietysfm rlnms ()trxnmr tytlpDe n i (0setmxm3nu1alenlieta()a2ra(rono0ale miciltla umuvsn(0tleoxo iodlptelueil() exoxrpou4ap  mietat s2rmu oot1oleniieils s umnvp;u4aeenxf3tytlate neo t) exoim3oudamtemivtls  2uax pnu4ole ii3tadfmDrl( p;(0tlenifcoodlpDelivs;t s2uo(r3iydamee fct ()s2rrx pno0optniieiydfs emnvp;(0aexnxocoytoa  aies s)s2tmxm3io1ame  icils a2trx ono1tex mietasfs emuvo;t)teermociy1la r uvi (0 2xrxr3oodamte iet t aDraxrpnu4opxomieiasfa ulu pnu0trxnio iy1laD  nvslt0teuoxm3oydop nmicsltfaruau pnt0ope iocils a uln o;t4aexnmf3tydlm   u s;(0seuoxr3nudomtn nciat  Dtmxrpou4oet io3ias s2ul(vs u4altniociadfmDrlivo s  etrio io4al n nvsat) rra(r ou4tle  f3tysfaDulums;u0 eerxo tydoptelu s;s)tetmiopou4lle mnes ()a2ur(moou0tlt mfeiyd s elnms;(0teenxf iy1fp e ivi;s0 2xo(o3oo1altn nesa()a2ra(r ;o1tptnmietydfa emu s (4 renmfciadfmt  iei;(  euoim3nu1lp elnei t)a2umx o;o4ale ioeiyd a ul(mpnu0 ltnmr3iadomt  n ols trxrxopnu4opeelivtls)s2ua( o;t4ope ifeiasfaDeanmont)trermo oadlmtr nei;t  ruoim3ny4apeelfvtlt aDrrum no4apx ifciad m2rlumpn(4 rxoxr oydfpD  ivo;(  2trxopno4amt lnet s)s2trx ont1oet ioeilt mDeaumsnt)trxnir3tatlp  au s;()srumxmpnydlm emfvsltf Dur( ooo0tetomfetydfm2rluvon(0tlxoir3tydopDelu i (0 rurxr3ou1omen nvsl() 2ur( poo4tet  fcildfsDulu p t4 rtrifcia1fatr nvi;t)tetmir iu1alenlivsas)srtmu p;t1tlxnmociadla rlnmo u0alerxrcoy1opDeanes ()s2xoxr oudlp   neiltfsrtaxroou4opt iocildls elnvpnu4 rtoif3oa1om elnvs;t0teurxr3iy4om nlnvia() rrrxmoot0ole ifctas m ra( o;t4alxrmfctydop eliei s0seur(m oo1omtnlfvtatf rrr(ro;t0oeeomociytfs2ulu p t) lenxr iy1omDr nvo t)trxoim iodapte neiat  2rmxm ;u1opto iciatfs2ra( s;(4 lxrmr3tydfaDe i ilt srxoir no4al e nciat aDta(r ou4tpxomo3ilsfm2um(mpnu)arenir3oadlpte nvs s0srumxmpio1lpt  fvias  2urxm nt1aexn oeiasfaDrlnmonu0 eerxo oydfa eluvo ()t2tr(mpoudllte nvs t  rtaum nu1oltnif3tltfaDumumo t0 rxnmf3oatlpDe ivol( trxoiopou4om  mfvtls)s2rrxmont1opxnmietadfs elnmo;t0 lxnmfctotoaDelueol(  2tmio3nodalenlivtas)s2tau onu1oet ifeilsfs rlnmsn(4tlxnmf ta1latelueo s0setoxopou1omtn ncs s sDrmxr nu1tlt mfciysfsDel( p t4texnmo totla  ln sl() etrxm3io4lp  lfvsltfaDur(  ;u4tleoiietat a emu snu)trermo3tatlat an s;(0s2umxo3ny4ame  neias aDumx  no0ope  ieilsfs rl( snu0trxoxocoytlmDe i i;(0 2uoxr oy4ll e icias sDtrurpot1tptnmieiltfm ra(mp;t)tlxrxo oydomD lneslt0tetoiopio1ll nmiesat  rur(rpot4alt mf3iysls ulnmp (0texomo tytoaD  i o;(0srxo(o3oo1lmtelnviasf Durum nt0ole mo3iadfs ul( pn(4aeeniocoy1laDe nvo;t) 2xoxm3nodoptemnvtl() rtr(r nu0oltniiciysfsDum( o u4 leriociytlpD lneolt0trxrim3nydopenlivilsfs2tr(m ot1tlen ietltfa rm(mp;u)aetoxrcty1op r ivslt  etr(r3iydol  licils)s2rrur oo1optn o3iytla uaump ()treoio3oatoaDrlies;(0 eumxr ny1lp nmieilt  2rau  oo1aleomictytfs elnvsnt) ltnif3ty1lpD lnvo;t s2toxopnodalte fci t)arra(rp;t0ale iociysfaDulumo;t4teeoxfciy1op r ueslt0t2xmxo oy4om emfcsas)aDraxmp;o0tlx io3iad a2umuvpnu)tlxoxf tydfm e i s;s0trtoim iy4lmtn fet ()a2umxrp;u1oeeoiiciydlsDumums;t4altnmf oa1laDe nvi;s) rum(mpnodom nlfeia( arra( poo4aexoif3tytfm ean on()trxoxo3io1optelu o;t sexoir nu1lm nmietlt  Drmumpnu1tpxniociyd mDemuvonu4alxomo3to1fa   i ils) rxoim3oo1ap e fesatfs2ta(rooo1opeo feiydlm2emuvs;()tlxoiocoodfpDrlues t  2umir iu1lpenlfvtlsf 2truronu0altn oeils mDrlump;t)altomr ootlmt au slt)teto(r oydoleemictls srtrxm ;t1oeenmo3ilslmDranms u4alenifcoodop rlnvsl()sexmim iy4om e fvsa()s2umxmont0oleo f3iatlsDumnmo;u) ltomr iodlm rauvi t0t2umio3oy4am nlneslt a2rmxrpot1tpen fctldfa ua(vs u)aeenmo3todlaDeaivs;t) 2urxm3oodop  mieils  rrrx  ;t0aetnifciyt s2rl( o t0aetnxf3tydfa   uei ()trtriopnydlptn fcilt  Drm(rpnu0oleniociad a2rlnvp;t0alxoifcoatom  livo t  rxrir3nydlm   ivsls sDtrum ;o0oet  fciat s2ul( pn(4 lxomfcio1omt anvs;( sexoxr iy4ope  nes (faDrmur ;u0tltn ociaslm2umn sn()trxnxfciodlmtelies () rxoimpio1lmte ieiltf 2ur(  ;u4aptomociadla2ea( ont0trtomoctydfmD  nvs ()texrim no4lp nlivi t s2trxmo;t1tpe ifeiaslm2el(vp;t4trxnmo3oy1fat lu o;s)s2xr(mpiy1am nmfei t srtaum ;o0aex  oetysfs umu o t0tlenmrctodfaDrli i (0seuoio3nydlme  ivi sfs2tr(rp;u4opeoioeiydlsDuau o;t4 eermrctotfp elivols0srur(mpny1openmncsl(  rrm( pot0tlxnifcilsfm ea(mo u)aetrio3oadlmD lieol( s2toxr iydaptnliei t)aDra(r ;u0oee  feildfs2emuvp;(0aeeoir3iy1lp r ivi;(0 rumxmpiydapeelneta(f 2tmuro;o0tlx ioeiyslm2ran p t4altnmoctatfaDran olt)s2urxrpnodlltn feta()artr( onu4olxnifctld sDrlu s (4teerxfcoo1lpDelnvsls)seum(o iu1apt mneils)s2rmxro;u1ope mfeiltlaDrl(mpn(0aetoiocoatlmte nvs s) rum(mpno4oleelfvi ()aDtrx  nt1tlt mo3tas s rm( o u0alxrmr3ta1omDranvsl(0sexrir3iu4am  mncsasfaDtm(moou1aexnii3tys a2umnmpn()altrif3ty1laDe uvils)sexo(mpou4apte fci ()arur( ooo4tee miciytlm2ea( snt)arenxrcoytfmte uei s0 rumxmpiy4om   nct ( srrrxmpno1apen octlsfmDulnmonu)teenmoctadfmDe ueo;t0sruoxr3nodll elneias)sDurur ;u1tlt mieilslm2ea(vo u4texomf oydfmD  nei;t setr(opiydap nmnvi ()a2trxrpno0altnmfciyt m elu p;u4 rerxr3ta1omD liei t  2xrxrpoy1aptn fcsls) Dtrxr no1apt mfciltfsDelnmonu4 rxnmfctodlmte uvolt)seurxrpou1lpe mies (f rtaxmpnu0teenmoetat s2elnvs;u)aetoircootla eli ils0 2xoio3oy4am  lfct tfsrra(rono0opt  ociyd s uan s;()trxomfciytop e nvo t)seto(mpou1alen ieil(fsDumu onu1aeeoiieiysfsDra(vo u4 etnif iatlpDr i olt)s2tr(o nodapeemivias)aDum( oou1aptomoetld sDra(msn()teenxfciytom   uvils0trtmir3iudlle mnetl() 2rmx onu4tex  fctad aDranmsn() exrmr tytfmDr ivs () eumio nu4amtelfviat)aDtmumooo0tlxomi3tysfm uanvo;(0treoxr iadlatrlies t s2xrio ou4oltnmici () rrm(m nt1oltomo3tltfaDem( o;u)aetnmf oatoate ivols  rumxm oudlleeliei t) 2umu oou0tpto oeildlaDel(mo;u0 etrmf totlm eanvi (0s2xmim no4altnlfet s) rtr(mpno4oexnioeiatlm2ea( snu4tltoxo tadomtrlnvo s  2toxo iu4llee ncsl()sDrauronu4oee  ociasfa rmumo;u0tleomr3todlate ues (0t2ur(rpiodal n nvi s)a2trump;u4alt if3tas a el(vo;(4aeenmr3oatfatelu il( trxrxopiy1ome mietl(fsrurur ou4tpxniociat s2elumsnu)teermrciotlpte i il()t2urxr3ny1am  mnvsl()srrmxrpnu4tleomictyd s rmuvsnu0teeomo iytomD luvs t0srxmirpoo4ope mieiltf rtaurp;t0tpxomietytfs rl(vo;t)aexnxo3ia1fpD  nesls0texm(r no4olenmici s) rta(rpnu4tltomi3iydla2rmuvp;u4aeermo3oodfa eaivs;t)trxmio nodlp   nesltfsrrrx pou4aptnmfctltlm eaumonu0alxrxocoydla  ln sl( srumxm ou4om n fetls  2ur( onu1alt if3iltfaDrl(vp;u)tetnxr3tydomDe n o;t) etrio3iydomee fvt t) rtmum ;u1apxn ieiatls umu o;u)tltrmf3ty1lmtranvo s0 eurirpio4apen nct ()sDtax p;t1apxo ietlslm2ul(vo;t0aeeoxrcto1oaD  n s (  2urxo iu4omeelfct s)arrm(  ;t4aleo octasla rlums u) rtniocto1om rlnei;() 2toimpio1om nliei () Drrx ooo1olt mfeiyd s2rlnmo ()aexnifcoa1lmt auvi;(0srtoxo io4apeelnesl( s2ur(rp;u0texoioeiys mDrau p;u4 eerxr3oa1fat aueol() 2trim iu1oltnmfci s)a2uau ono1aleomieiat s um( s t0 lxnmociotop   n ol(0s2xrxr ny4lp   fcs tfaDtmxmoou0tetnmictaslm2rm( s t)tltoxo oy1la  aneslt0srtr(m no1lmtelictl()a2uaxmpot4ope  i3tydlm2rmn s;(0altoio to1fmte ivs;t0s2tmxopoudlptemfvils)a2ra(mpou4aptnmoctasfa emuvonu0aexrmfctodfmte uei;s0 etr(mpoydolte ietl()artmu  oo4aexomf3tad m emn p ()areoxrctatlmDrlueo;s0trum(o3oo4lltnlieiat) Dum(rpnt0oeenmfcild sDeln o u4tlermf3iatlat auvo;()texo(o iy1lme  fei s) rrrumonu0tpeo i3iytfmDemn pnu0trtoio oodlaD  nvi ()s2xoxrpiy1alenmnctl(faDrmx o;t4oeeniicildlm2em(vp;u4artnxo3oodlptrlnvo;(0s2xm(r3iy4lptelnesa()arrrx o;u4aeto o3ildfsDel(vp;t0texnxo3oytlm rli o;s0t2tmimpiudope  nei t)a2taxmp;o0teenioeils a2um(msnu)aetnmo3oadlmD luvo;( t2toim3oo4ap n ieslt)sDuaumo;u1teeomociltla2um(mp;t4tetoxfciatopDrliei;( sexrim3no4om   ivsasf 2ur(r ot0ole  ieiysls2ulnvonu)tetrxrctydlmte u ol()tetoio3oodol nmivs t)srtm(m nu4texnmfcilsfm2em(monu) etrircia1lm e nes;s0 2tm(o iodaleelivias srrm(  ;t4ole iociydfs2umnmo u0arxnxr tadfptraivi s) eumxrpoudaleemnct ( a2taum ot0optnmieiyd sDelump u0 exrxf todopD aneol() ruoimpio1lmtemfet ( srtaxm ;o0apx  i3iyd m2uan s ()trtoio ootfm r u s s  etrir3oudlmtnmfes t) rtrxmp;t4aleomfctasfa umn o t4 eenxr tydlaDe iesl(  etrirpnydaleelfvt sf rtmur ;u1opeomfetytlsDrmn pnu0 ltomrctodlmDraues t) rxmio iu1optn neslt a2taxr ou1apt  o3iydlaDrmu o;t4aetoxfcoa1lp   n ols0texmxr3ny1amen ies sfs2ua(  ou1oetnmieils m ra(von()arxnxf3todlm  luesl()trxrim iu1omtemfct t srrax  oo4aleniiciasfa2ea( p t0 rxnxr tatfmD lnvs;s)srtrxmpou1ome livt sfaDtmxm ;t1tlt iietldfm rmnmsn(0tlxnmfcty1lateli o () 2toio no1ap elivta()aDraxrp;u1apx miciys m um(msn(4aetnif3oo1faDrluvo;(0 2xoxo3no4lmtn fei s) rrrx pot4oltnmi3iydls2elu pnu4aeenmf3totlm e ieils0 rtrxm iodlmt mfcia()a2urx pou1tpxn f3iasfm2em(ms;() rxnxociotlate ueo;t)t2tm(rpiydolt lnciatf Dua(mpoo0oee ii3iyd a2em(vo (4 rtoxfcoa1om  lnvs t0srxr(r oudlmee neiatf 2rrxm ou4tlt ifetyt sDum(ms t0tetoir oy1om r u s s0texmirpnu1ap nmnei t aDurx pnt1oet ioeiys s rmnmo;(0teerif3iadfptrluvs;t0texoxm3io4llee ict s  rum(m ;o0ope mfctltla rmuvs;t) rtoiocoytla eli s t0teuo(o oudol  lnvtls)aruru  nt0aleoii3iydls2rau o t)altoir tatlpD aieo;( s2umio3ou4lmtelnvtl()sDrrxrooo0olxnmoctydfa emumon()teerxo3tatopt anes (0 etriopnudom elivtl(  rurx oot4opxn i3iys sDeanmo;u0altoxfciotomtranvs;t  rxoimpou1lptnmivi s  Duaxmp;u4aex  i3iltls2emumo (0teeomfcta1optr nei;s  rum(mpoudlpeelfet sfsrrr(moot0oexnio3tadfs emu p;(0 lenir oytomtelu i s0s2umir3oy1optnlicsl(farrmxro;o4olxnmicilsfm2ul(mon()tltrmo totlm ranvi;s teto(rpnu1lle mfcslsfaDtmuront0tle mfetlsfs ulnmsnt4arxnxo iadop eaivol(0sexrxr nodlmenmfes t aDurx ooo4opx mf3iadfa rmumo;t0aeerxf3tytoptrlnvo ( s2xoim oodllt livta()artrurp;o1aet  fcils a ra( sn(4 reoif iy1fmte ueil(  exm(mpoydal e nvilt)artrxm oo4tpe ii3iatfm2elumsnt)trtomo3iatopt lnvol()t2trxm oudop n ncslt)sDumxr ;t0oee mi3iatfa ul( s u0 rtrmr iydfmte iei t0trxr(r3iudam e fesa(f 2um(rp;o4oeeoifetldfs rm(vp;()artoxrctodfmDrlu il() rtmim nudalte fctasfsDrm(mooo1teeomfctadls2eluvpn(4tlxomf oy1oaDelieols s2urio3iu4lm e icias aDrrurp;u0aet io3iyd aDua(vpn(4 rtriocta1omtraies ()s2xrxo3ny1lp   nvsa()sDtru ono4tet iieiyslsDra( pnu0 etnxfcty1laDrlnvo ()texr(opny1omeemnei ()s2trx  ;o4oee  octatlsDeau p;t)alxnmr ty1omt livilt)t2xriopoy1opee fci (f rtrxm ;o4tetn ociydlsDulumpnu0 rtnmr3to1oaDeln i s)seuo(r oy1lp  lfvilsfaDrru ont1optoifctlslsDuauvs (0 lenio3io1fa eai i;s0teurxmpnu4ol n nctas srrm(mp;u1oetoifeiatla emnmp t4trxnmf totom  luvi s) exrxm3oo1ape mfeiat aDuaurp;o4oexomieilsls emnvp u4 ltoxr oatfmt livo;t sexmio nu1amen ieil(f rumxr ot1tetoiieilslaDulump (4arxomrciatoateln i;t0 rurimpny4lm  lncsat)s2urump;t4opeoii3tydfm ua(msnu4 reoiocoy1lmDeliei t)srxr(o ny4altnmfeslt  2ur(rpnu1opx  feiytfs2eln snu0aeeoifctadomtr uvi;(0 exoio iydapenlneiat a2uau poo1alx  oeils aDul(vpnt4 leoifcoodlpt an i s  2xmim ou1omte nei sfsrtmxmont0tptn i3iydfsDrm(vp;u4tetoxr iotfa e n s t)trtoxrpoy4lp e nci tf 2umx pnt1oex mociltlm2uan s t0aexrxocoydfmtelnvo s tetoio io4lltnlfvils aDta(m ou4apx  ociys mDumn o;t0alenif ty1lmD auvilt0tetrio3nodlpt  ivi s)arumur ;o4tetnmf3tlsfa umuvp;t) etnmf iydomDeln o;() etoim3no1am  mnvt tf 2trxmp;t0apxniietlslaDeau o t) eenxr3oydlatrln s;t) 2xoio iy1om nlnvtl() 2uaumpot4ole  fctas m2rl(mp;t)tlxrxo oadfpD luvi;s0t2tm(m3nodllen ivia(  rum( o;t4aexo f3tldfs umn o;t0aexomr3to1lmtr uvo t0 euoxmpou4ol   fet (f 2tm(r no4oee io3iyd a2el(vo ()tlxrxf iytfa ranvi;t srurim3nydoltelici sfa2tmxrpno0olxnmf3iad aDean ont4artomo oa1fm elivi;t  rtrxm3nu4omen ics sfs2uaump;t1ape ii3iatfsDrm(vp;u0 rtoxr3io1fa e uvs;( trum(opoo4lmenlfvsa(fsDtax  ou0aptn feildlsDuluvs;()trenio3oo1la  aies;t0sexr(r3oy1alen neta(fa2umumo;u0aeen icildlaDemuvp u0texrxo3tytoaDe ueolt) rtrxrpiy4omee iet t aDrrx o;o0oeto fetat mDumuvs t)trxnxr oa1oa  auvi;t) exrir nodlpeelnetl( srrr(root4tetn f3iydlaDuanvp ()tetnmfctydlaD ai il( seuoxo oodam   nvtas srua(r ou4aet iicildlmDeauvsnt) rtnxo todfpt aieo s0teto(m3oy4amen nctat) 2ur(  nt0oeen ieilsla eau p;u0 rtnio3tydfp elnvi s tetmxopny1amen iesl() Duauro;u1apeo iciadfaDranmo (4 ltnio tydlmDr uvs ( s2tr(m3iodamte fcsltfa2rrumo;u4alenmocildlm rl( s (4texnmo tatla   nvo s  2umim nu4omte fes ( srurxr ;o4teeoioctasls emnvp;t0aeerifcoadlpD ln s;t)t2ur(r3ny4llt  iei (fa2uaxmo;u0oexn ietltls2umump (0 lxnmf3to1fptr iei;t)tetmxo oo4al nmnct t  2tauro;u1aeenmocils s2um(vp;t4tlxomf3iytfa  ln ols) 2urio iy4open ivtatfsrum(m ou4apxnif3tat sDelnvs (4arxnif iydoaDelieols0tetr(rpou4ol nmiet tfs2tmx o;t1aexomi3iadls el( o u0alerio oo1omDrai i;t sexoxm oy1lp  mnct ( aDumur nu4apt moetatfaDemu p;u0alenxo3ootop eai o ()teur(r no1lltn nes sfsrtrxm nt1apx ioeilt aDeanvp t4aleoio oatfmDe nvi s)t2umxo oodlltelfvia(fs2rmumoot4olxnmoeiasla emnmpnt) lxoxocia1laDeli o (0sexoio nu4om  lnet ( arurumpoo4aet mictlsfm rl(mp t0arerxrctydlpDrau sl(0trum(rpoo4op n netas sDrmum oo1alxomf3tatfmDrln on(0tleomf3tatopt aivs;t)texr(mpno4llenmncias) rurx  ;o4oetoif3tas a2rlnvo t)alxnio ootfpDeanvs t)t2xmxopiu4ll emnes t  rtaumpot0texnmieildfmDran ont4tetoxr tydlaDeluvsls)srxm(m3iydlptemncsls aDurum ot1opeomictadfa2uau snu4 rermr iy1lptrln o t  etr(m iy4al nmivtlt  Drax  ;o0alxo feiysfaDean s;u0artrxr3tatom  lieo;s texm(o oy1lltelneilt arrm(ro;o1oeenmoeiatlmDrauvp u4aleoxfcoatlateauvo;s0 ruo(m io4lle micias  2raump;u1oeto ieiys aDra(vo u)aexnxfciotomDrlu ils)s2trimpou4ll   nesat a2uax ooo1tleomicils a2rluvs u4trxnir3iytfatrauvolt  rtoim3ny4om e fesltfsrtr(  ;o4ole mfeils a2ul(mo u4 etnxf3tatopDrluvi;()teur(m3ou1amen fvia( s2ua(r ;o4tlenii3iysfaDeaums t4alxomf to1oaD anvol( s2umim3ou1lpt mfvi t sDtaurpnt1ape ifeils a ra(vs;(0alxrmo3ty1opte iei s trtmxopnydalenmfes sf 2tm(rpnu4optn i3iltls2rlu pnt0 rxnif ia1fmDrluei s  2xmxr oy1om e icsas)a2rrxroou0tpxoifctatfmDrauvo;u)arermrcoa1opDelueolt0t2umxr3iy4alenmietas artau  ou1aeenmfctlsfm uauvonu0aexnio oydfpt  iei;(  rto(r3oy4ome lnesasfarurxmont1tee iiciltfa2ua(vs;u0trerxfcia1omDrlues t0 2xm(r nydlp nlnetlt) Dtruro;t4optoiictldfmDeau s;(0 lxoxo3ootom rluvs t) rum(r iy4lmenmnvtatf Dua( pou0opxomieildfa emnvsnu0 rtoir3iodop r n o ()truoim iu4oleemnesas) 2tau p;t0oeenmociatls ra( p;u0trxnmfcoo1lmDeaues;(0teum(o io1ll nmnesl()arumurp;t0teenioctysfmDea( sn(0 rtoxr iydfmDe uei s) euriopoy4olt  fci t) rrmum nt4ale moeiydls ua(mon(0 exrir3todfmtranvs;s0t2xrxm oy1llenmfcsl()sDtaxmont1opxn fctadlsDul(vsnu0treoxf3oa1omDran ils t2urio3iy1olt  neiltfsrrmumo;o4tlxnmo3iadfm em(ms t0trtomfcoy1oaDeanes s0 etmimpno4ameelicsa(  rua(rp;t4tlenifeiytfa emump u0 ltriocia1fptrlues t trum(r3io4op nmfetl()s2rrurpnu0alxnif3ilt aDrl( s;u)tltrmociy1lp eaies;s0seum(opiodlpt  ncs ( s2umxr ou1tpenioctyslsDrm(ms;t4tlenxociy1fm e ueo s) etm(o3oudlmee nei t arta(ront1oeeo fcildlsDuluvsnu0 rtriocoatomDeanei s0 eumio3io1amtelivsas)sruax p;u4alx if3iytfa2ua(mon(4 leoxf3iy1fatrlnvsls0s2umirpio4lp e nvta()s2rru ono0tltn ietad m um(mp t0 rxoxf3oatom e nvo t0trtr(r3ny4llee fvi (farururpnu1optnmo3ils aDemnvo (4 ltnmrcoadfp rlues t seuoio3nudll e fcilt) rrm(rp;u4apen o3ias m2rlu o u0alenmr3ta1oaDe uei s)tetmxo oudamenmfcta(  2tmu p;u4oeeo oetltfsDrmnms u) ltrmo iodfa ranvs s)srumirpnudame lfct t  Dta(mo;t4opxomf3tytfa elnmo u0 exrmr iydlatrlu ils trtrxr3no4om n fet (faDtrxmooo1tet  i3ilsfm ulumo;t0trerxr ty1fpDrauei t)t2tmxr oydlm nmivs s a2umurp;u4optnmfcilt mDemu p t0 etrmrcoy1fmte u o;( t2tr(r3ou1open fvils) rrru oot4optoio3iasla2um(vo (4aexnxo3to1fmDr nes;(  exrirpno1ale livsls) Drax ooo0tpe  i3iad aDuauvs;u)alenxf oa1oatranvol() eumio3oo4llee fetat aDuauroou0oetnmfctytfa uauvs u) renxrctotlp eaueo;t0trtrim io4ap e nvsatfaDrm(m no4alxn ieiydfs eau s ()artnmr tydomD auei (0truoirpnu4ll  mfcsls srumumpnt0tee iieiat aDem( s;u)artoir oo1lpt li s;( teum(rpny4ol  lfvi t sDuaxr oo0tlto ictld s2ul(mp;()alenmociotfmte ueo t)teum(opio4oleelies (fa2ur( onu4aex ii3iydfs2rln s;u4 rxoxo iydoaD luvo;t0s2xoxrpno1ol nlnesat sruaxmp;o1tpx  octasfm ulnvp;t0teeoir iadfpt ln s;() rtrim io4altemietls  2trx  nu1opeoioctatfa rmnmo;u0aeenif todlp  au i;t0t2toir3oydlm e feslsfarrrxrp;u0alxo ietas s em( s t0 lxoif3oodopD  iei;(0 2ur(m3nudlltemnesatfarrmxrp;t0aet if3tyd a2rm(vsn() leomo3oydlmDrlnesl( srur(mpny1lmt  ics (f rtmxrono4tetn octytfm rm(vo (4 lenio3oadoatrlueils  rur(mpio4ol nmnctat sDtaum ;o4aet  icilt a rmnmp u) rtrxo oy1lpteau o s0 rur(m3oydal nmfci t s2rmxmp;t1opx ioctlt m2ulnvp ()aetomo3iydfpDeli ilt0 rxoirpiodlme mfei s)aDurumo;o4apxnio3iltfsDuanvs;u0tlenxo3iadlatrln s;t0 2urimpiudol n fet s  2ur(rpno4oltnii3ias s ean s;(4texoif to1lpDr uvo;t0t2ur(rpiudoptemnvsasf Duaxr ot4tpe mieiyslm um(vp u0tlenmf ta1lp  livsls)srurio3nudope  fctl(fsrtrurp;u0aexn oeiadlm eau s;()trxrmr3tydfa  lieo s  etrio io1lp  mfvt sf rumxrpoo0teeo ictlsfa uanms;u4texnmf oy1faD auvolt) 2umim iudol  licsl(  Dta(moot0opeoio3tasfs ea(mo;(4 rtoxo3oa1oateaueo t s2toxm iu1amtnlict tf rra(m ou0olen o3tasfs ea(vs;u0arenmocoa1fpDraivi t)t2urxm3iy4lme lnvtat)s2ra(r ;o1oexnmfetatlm ra(vp u0trxrxo3tatlaDelnvs () euoiopiu4amt  icta() 2umu  oo4apto iciytfs umnmsnu)trxoxf3io1omtr uvi;()trurxopny1ol nmfesltfa2umx o;o0texomiciadfs ra(ms;t)teerxo3io1la r nvs s0t2tmxopoydom e ncils  2ta( pnt4tle moeiadfs eluvp t)aexrmo3to1lmt anvi t  2uoxr iy1opee fct s s2tm( pno0texoiictydfmDrl( p;t) rtrmo iadfaDe uvi s)teto(r3ou4aptn nvilsf 2rax p;u1oee  oeiadfm2rluvonu4 lxnxo3iy1lm rlueo;(0t2xrxo3iy1apen ies s) 2rr(mpnt1oexo o3iytfa2ra(mont0tetnxo tytfaDe neo t tetoxo3no4amtn nei (f 2uaum nu0tlenmi3iytfm um(vo u0tetnxoctadomDr u sls)srtmir no1om elnesa()s2ur(root4aeeo f3iltls2eau s;t0 lenmo3tydfatrlnvs s0trtmir3no1lptnlieslt) Dtm(rpoo4oltn ocilslaDrl(mo;t4texoxoctytfa  anvils  2xmxo no4lltnmnvi ( arrmu o;u0tpx mfeiydlm ul(vs t0tltrmf oydop raieils s2uo(r iy4om nlicta(fsDua(rp;o4tltoifctydla2ra(mpn(0 exnioctadlmD  u s;s0 rxm(m oo1ll elieiltfa2ua( p;o1olt  ieilsls eauvsnt)tleoif3tydfmt  uei t0setmir3oydol e nesltfs2tax oou0tlto octad m ra(vs;u4texrmf3tytfa eai ils0trto(rpiu1lltnlneilsf 2rrxm ou0oeen oetatls2rmu sn(0tetnmfciy1om   uei s s2umimpio4lp  mfvt (f 2ua(mooo0tlxnio3ilslm2emnvpnt4 rxoir3iotfm  luvs (0texrir3no1apee ict s aruax o;u1tpe moeiasls ra(ms t4 rxrmr ootoaDeau olt0srxm(rpiu1altn nciasfsrrr(mooo4tlt  ociat mDrmumsnu)areomocoa1fp   uvi s texr(r oo4ole lictlsf 2taxmo;u1oetn ociysfs2ua( s;t) rtoxrcio1lmDeai ol(0 2tr(mpoydope  ivi (  2urur ;o4altoifeilt s2ulu p;()aetrxf3tydfpD auvi ()teumimpio1ap elfcsa( srrr(rpoo4oeenmfeildla2uauvo u0tlxnxo ty1fpDe n s ()s2xoio oo1oltn neiat)aDrax oot4apx  fetlslaDum(vs;u)teenmrciydfpD lies t0srxm(opou1om  mncsasf rrmxrooo0apxnio3tyslsDeaums;u)tetrifctodla e i s s) etmir3iydome  icil( s2urx pot4tptnmicildfaDul( snu4 eenmr3iotlp r n o (0 rtr(opnydllt mnvilt srtru  nu0oexo f3tyd aDum(mp u) rxrmfcoadfpDeaues;t0s2um(rpoudole lncsas  rtaurpno4tex mieiyt m ean ont0trtnioctodlm raneol(0s2trxo nu4op emnes s) 2raxro;u4oexn feildlmDemu o u)trtomociadfa rlneilt0teurxm ou4ol e fcia( artaur ;u1tpeoiiciytfsDuanvp;t)trtrmociadomte ieils  rxr(o nudlmenmies ( srraur no0tptnif3tys s emumsnt)tltnmfcoodoaDrln s (  2xoirpoo1lpe licsat sDurx  ;u0tlt  o3tltls eln pnt)trxrmr3ta1oaD anvs t)trtmxrpno1alen ivsat  2ta( poo1aee mi3tytlsDulumo t)aeenio3tatop   ues ()trxoxo3ny1ame  fetat  Duaur nu4tpe  feiyd m2ea(vpnu0tlenif3iodfm r ivi t0setr(o oo4olte fcs ()artmxr ;o0tpenmietaslaDra( s;(4 rtnmf io1lm  ln o s  eurio3no4optnlnvsl() Dtrx pot0tle moctasfm2eau p t)arxoxrcoatfp r n i s) 2ur(r oydlmen fvi t arraxrpou4texo o3ilsfa eauvsnt4 lxrxocto1faD lnei t0s2xmim3iu1lme  ietlt arurxm ;o0aexniiciysfaDem(vs (4artomocoytla r nvs;t trtm(o3oudlmenmfvt s a2um(moou0olxn oeiadlsDumu s;u)aetrmr iy1fm ranvslt0srumxm3iu1omenlnet s) rtrumont0ole iieildfa rm( p;t4trxoif iadlaD ai sls)tetrxo no1lmeelfvi tfsrraum oo0olx  f3tlsls2emnmonu4aetomo iatlpte ieol()truoxopoo1ol  mfcsas srrmx oot0oltoii3ildfaDel(ms;() eerxr ty1lp r nvs t)s2tmxm3oy4aptnlncias)srrrumo;t4olx mictlsfm2ra(ms;u0 ltrxr3to1fpDeanvilt)trum(m3io1lpee nvi sf rum( onu0tlxnmocildls ulu o ()artomfcta1fm e uvs;s) rtrxopoy4apen fvils)s2uaur oo4tpto ociytfm ulnmo (4alxrioctydlp  lies s0sexr(r3oy1ol   iet t aDraum oo0alto ocilt mDua(ms ()tetnir oadfmDean slt0teuoio oy4om nmfcilsf rrrxmp;o4olx if3iytfsDeanms;u0tltoio3oodlp rauvils) etmxopny1altemiesas  rumxr ou0olt mi3ildlm2ua(vonu) rermf3to1fmD  uvil(0srtoio3iudap  lnctas)arumxmoot1oeenmi3tytfmDuan p u)aleoxocoodoaDeau i;( s2xoxm3iy1olt liesl()aDtm(m ou0aeeoif3tld m2uanmo u0tlxoxo3to1la  luesl( trtoxo3oydal   ncia() 2trxmpoo4apt  fctlslm emuvpnu) lxnirciy1opte neo t0trto(m oy4lptelfciat) Drmur no0aexnio3tltfa ua(vp;t4 eeomrcoy1lmDrlu slt0s2xoim3iy1am  mnvslsfs2urur ot0aex moeiydfa2el( pnt0 eenmf3oa1lmDrlnvol(  2tm(r3iodlmtn feta(  Draur ou0tee mi3ilslm2ean snt4arxomr3tatoa eluei s0sexm(r3oy4lmt lneils)srta(mpoo1olx ifciltfmDumuvs (4 rtoir oa1oatrln i s)srtm(m3no4lpeelivi s)artaurp;o1tpenmfciyt a2rl(vp;u4teerir to1laD lues;s s2tr(o3iu1op emfeslsfaDra( pnu4tpenmfcilt a2ra( p t4teermo iotfa e ivs;t) 2um(opiy1ol   neia(faDtm(mpnt0tlx iieiyt a emnms;t0 exnxo3oatopt lieils s2umio3oy4ale  iesas)s2tau o;o4altnmi3iydls2emu ont0 lxoir ootlate ieo;t teurxo nudal elieiatfs2tru o;o0tptoii3iatfa um( pnu4aetomr oa1fptelieol(0setr(o3iudalt micta() rtmxmont1ale iieiydlaDemu p;(4 etomocoatfp rai s s)sexoim iodllt  ivsa()aDrru onu1apxo i3ilsfs rmuvs;t4arxrmf tydlp rlueils0t2tmxopio1amtnmnci t sDuax o;t4tee  fciyd m uln o ()tlxoio3iatfa  an ils setoir io1llee fvi tfs2rmum ;o1tltnmicils a ra( snu0 eeomr3to1lp  au i (0trxoxmpiu1omt  ietlt)a2rm(  nu4olen ieiltla2uan o;u0teerif3to1la   n sls t2xrxr3iy4lp nlfvi (f 2rrxr nu1aptoifciad aDuan p (4aleoio todfp r i i t trxoim3iydope mnct t a2tmur nu0tlxomo3iat a uan onu)alxnxf3to1laD  ies;t tetoirpoo4ole  nvi s sDta(mont1altnifctlt a rl(vo u0trxnmf3oytop eau i s0setoxr ou4al nlncil(f 2rrxr oo0tlenmi3iatfs2emums;(0 etrxf3oy1oaDe ivi ()seum(o no1lp  lncsl(f 2umxm nt4texo f3iyd m ua( pn()arxnmo3iatlpt aues t0texrxm3nu4omt lfei t) Dua(mp;u4opxn fctlslaDumu pnt) rtrmr totoaD aueols) etoimpoodlp   ivtatfa2rmur ;o4tpeo ictld aDemnmp t0 rermo3oa1fptrauvilt0trtoir3oudale mfctl(f Dururont0texn oeiadfsDel(von(0trxrxf3oydoa rluvols srtrir io4lpt lieiltfaDur( pnt0aet  fciyd m ulu o;(0 etnxocoa1lp r ivi (0t2xmio3no4ll emici t sDrrum ;o4olen ieiltfa em( on(0arenmf iydom r nvs s)srxr(m3nu1al  livtlsfsDtr( p;u1aexnif3tlslm elump t)tlxoxociytfpDrln ils  exmir nodopt livi (f rtmu  ;u1oex  iciyslm ulnmp;t0tlxrif3oa1omteaueol(0 2xmio oy4amen ies sfsDtmxrp;t1ape  f3iltlmDeaumonu) rxrir3oodomte uvs;s  eur(r3oy4oleeliet t) rrr( p;o1oltomicildlm elnvsnu4 etoirciotlm eauesl()s2tmiopoudam  mics s)sDumum ou1apxnifctls m2rln s;() exnxfctydop elivo s t2xm(r3oo4al emnvtas srtmxmono4oltn i3iydfaDum(vo t4 ltrifcio1omDr i o;t0setmir nodaptn nctatfs2tmu poo4oet ifctlt sDrm(vonu4aexrxr iotlmDe uvol()t2xoxo3oydapenlnvsat s2raumoou0tpe ifeiytla2ulnmpnu0 etrio iotlmtr nvs;t)texm(rpny4lmt mfviasf 2tru  oo0olxnmociytfa rluvo (4treomo3oo1la  aueo;s trto(m3no4llt mnesat) rtmu  nu4tltomi3tlslm2uauvont4alxnmfcoo1la   u o ( trxm(rpio4openmicsasfs2tm( oou4opt mietyd sDul(vsnt) rtrmocoa1omteli i;() 2xoiopou1lleelnvtas  Dtmurono1aex  i3iytfa ua( p;t0 lenmr3oodlpDr nvsl()trurxm3oudoltemici s s2ururp;u1tltoiociasfm emnvs;u0texrif3iatfmD luvilt s2toimpoy1olte ivil(farurxmpnu1aptnmictatls2elnmp;t0 eerif3tytlmD aivilt) euo(o oudapenlicil()sDururoot0oex  feiydls ulnvs;u)arenxf iotomt  nvols  2uo(o nu1ame lfei s)aruau pou0oee  ociytfs2rmn o t)aeeoir ta1late ueils)tetriopiudol elnvtat) 2rrx o;o0ape micils aDuau s;(4aexrir3tatoaD luei s0trurxo3oo1ol nmfcs ( a2urxmooo4apxo ociytfaDra(vpn(0 lxrxrcoo1fa e u i;()sexo(o oo1lm n fes tfsDrmxm ou0tpxnii3ilsfs elu ont4 eeniociadlatrai ols s2xr(o3iy4omee ies (faDuaur ;u4oltnmietytfsDrmuvo t4trerir tydlaD auvs;t0teuoimpnudom n fcsat)artr( o;u1optniicilt a rm(ms u0 etomoctatomDr uvols0s2toxr ou1ale mfvs s)artr( ont1tlxn octldfm2ulnmp t0teeniocio1om  aneo () 2trxmpiy4omeemneilt sruaurpot0apeoiictat m2ua(ms;u4 exrio3to1fpD li o;s0t2xoxr3oy4lmt lfvsas) rrax  ou0aee if3ias m2emnvs;u4treomf tytlp rlies s  exrxo3iu1op e icsl()arur( pnu4oet iociatls rmumpn(0 lerxfciotlatranes;s  rxmirpiudal elnetls srrm(r nt1ale if3iys m2eau o;u0 lerxf oo1lmt ln olt sexo(mpiudopenmnci t) rrrurpno0oleo oeiydla2ran s t4arenmo3tatfa   ieil(0teumxo nodol nmictls a2tr(  no1tex ifcildlsDelnmsn(4arenio3oydop e i o t0trxoxm3nu1al emiviatf Duau oou4tpxnmieiasfm eanvs;t0aeerio3ootfp  aneo t)trxoir oydoltnlivtltf Drm(mpoo1tpx  o3ilsla rl( snt4altnxfciydoaDe neols0 2xrxr3io1apenmfes ()sDurx  oo4oexo feildfa um( snt0aexnmf todfm rlivo;(0trxmir3iy4optemfesatfarurxr ;u0tpxoifeiydla uanvp;(0tlenifctadfm raneslt)srxm(mpou1amt  nviltfaDrrur no0aeto f3iydlm2em(mo t4aeeomf3tytopt  uvo;( t2xoxr3oy1om nmfetat arum(m ;o0opxnmi3tytfmDrm(mo;t4trtrxf tatfmt  ivslt srtoxopny1lmt  feilt)sDrrur no1openmi3tad a ulumsnt4arxoxrciodlmD lu sl(0srxoim3ny1op nlnvt () 2uaxm ot4tlxo fctadlm2el(vs;(4teenxocta1omteluvolt)t2umxopno4amtelfci t arumum nt0oee if3ild a ea(ms;t4alxrxr3oydla e n i;t t2xrxopnodopen icia( arumu o;o1aptoifeiadfa2ra( p;t0 lxrir oo1omtr nei s teuoim3iu1omenlieil(fa2uru pou0teeomiciaslsDemn s u0artrxocoo1lp  anei t  2toxo ny4apee fctlt arrm(rpot1texn ieiys a ra(vo;t4arerxociatlm rln s;s)setr(o3oydlpeelnes ()srtmx  ;t1tptnifciyt a2rm(vo t)trtomfcty1lmDraivs;(0truoio oo1om nmfes t) 2tm(  ou0oee mfctydla2em( p u0texrif3tytoaDelneo s0seto(r ny1oltnlnvsa()artaump;u0optomoctltfs eluvon()aetrxfciytopt  ies;s0 rxm(r iy4apte iesatfa2raxmono0tleoifcilsla umu o t0aeerxf3oatfaD aivo s)setmxr3oy1am nlncil( sDua(  oo4tpt  ociytla2rluvp;(0 lxrio oytfa ran s;s tetrim ou4om elnvtas srraurp;u1altnmo3iadlmDran pnt0aeermfciy1oaDr uvols0 2umiopiy1lle  ieils  2rmu  no0oet iieiytla rlnmp () rxrmociy1oat  ues;t0t2umimpnu1lm emnet tf 2trxr no1tex mfctasls2elnmp;u0teerxo3iatopDeaneolt0srtr(o iu1amtnlnvs t)s2ur(m ;o0tpeo feiad m rl(vs u4arxoir iy1opDrlieo t seto(mpno1lp elieias) rtr(mooo0alto iciaslm uluvsnu4alxnircio1fpD auvi;s)s2umir3nu4lmtn icsat srtrurono1tlenmictatfm el(vp u4aleomo ootomD lu ils0s2xrxrpiy1llenlfcils)artru o;u0alxn feiytfaDean snt)alenxfcoo1fmDrlivs s)trumxr3iy4ole lnesatf rur( onu1tlt mi3iadfmDem(mp (0 eeoircio1omteluei;t  eur(m3nodlle micsat) Drax pnu0tpen f3tltla2uanmo;(4aetniocoadom eanvols0 etr(r3iu4ll   iviltfsrrr(ro;u0tpxniiciad sDuanmp;(4aetoif iotfm  lieolt)t2toirpiy1lmeelieia()a2rm(mp;u0aex mictadfm raumo t0altrir3oadfpDrliei s)sexriopoy4opt mietas)sDrrx  no0tpeoioctadfaDulu s;u)altoxrctadlpDeaiesls  eur(mpny4omtemfcs s)aDrrumo;t1apeoii3iydlm ulnms u4 rtrxf3iatlpD  u olt0t2xr(r io4omen nciat  2ur(  no4tlxo fcils s2ul( pnt4trtnmrciadoatrlnes s srurxo3no1ame lietatfsDtmurpnu1tpe iictas a2eanvsnt4aeeoxr3ty1fm r uvils)trxmxr3nydlp  mfvtls aDrrumo;o1aleniictas mDua( o;t)texnmrciotopDr nei;t  rtr(o3no4lltemnvils) rrm(mp;t0tpxo o3tys aDrlnmp;(0texnxf oatfp e nvi;t)s2trim3iudamtnlieslt s2tr(mp;o1oee io3iatfm ran s u0arxoxocoytom  lneols0 exo(o io4lle mncs s  rrr(  nt1tet ifciydlmDel(vont0 etrxf iatla eaivol(0 etmir oo1ameelivsas a2trxm no1opeomieiasfm2ran onu0teerxf iotfa elieo (0 ruoxr3ou1opee ictl(  2tmu  ;t0tex mf3tlsla rmn onu4tltnxo iadfpt  ivslt sruoir3oy1olt lnvsat)aDumxmpnt4tet mi3tlslsDemn ont0 eermf3oatfp r u o t  rxrirpnodomtnmnvtat)a2tm(rpnt4alxo icias m2uanmp t4alxnif ta1oa raieilt s2xo(r3io4altnlfvs ()srra(ront0alxo ietaslsDranms u4texnmf3iodlmteau s (  rur(m nydoptemnvs tfs2umu ont4tlx iociys a2ul( p;u0tltnio3oatfpt  uvs;(0t2xrxrpno4olt mici ( a2umurpnt4tex  oetls a2uau sn() rtrmocto1lmt ln o;s0t2xoim iu4alenmfetltfa2tm(rp;u1tlx  ictlslsDrau s;u4 eeoxo tatfpDr u o s0trxo(r ou1apee fetas aDumxroou4apeomfeilsfaDelums t)aeerxfcty1optraivs t)texmim3ny4olenmieil(f Dur(r ;t4tle mieiadlm rl( s u4tetoifcia1lmDrliei t  2tmim3oy1ll nmnetl()srua(moot4alenmoetyt s2el(vo u0tltnxrcto1omDelivs;s0 rur(rpou1ole  nvil(fa2trx  ;o4oexomieilslmDrauvs (0arxnio3ty1fpDe i olt t2urim oy1ap e fctat)srta(rpot1tlx mf3ils sDrluvonu4aeenxr3tatfpt auei ( t2tmirpou4openlivias  2rrum oo1altomociltfs2rmu ont0 renmociytlmDe uvs (0tetoio3oudomt lnctas)srtaumpou4tpxomociatfa rmnmonu) etoxf3ootla rau o t  etrim3nodomtelnei tf Duaxroot1aex mo3iydlm ranmpnt4 etnmr3tatfa eaiei;t teto(r iudlm e neils a2taxm ;o0tpenmfciydlsDeau p (4 lxrxf3iatopD lueslt0tetmxr3io4alenlics (f 2ta(m ;t1oexoif3tytfa2uaump;t) leomo todopDelu o;t truo(m iu4lmenmneiltfs2ta( ono4apt  ociltfm2el(mpnt4trtnir3todfat au o;t0seto(o3ou4lp e fet ( srraxmoou1alenmietatfaDemnvs;u0 exrmo oadla elu i s0 exoxr nu1omeemicslt aDurxrpnu0ale  o3tytla rlnvs;t)trtoio totlat livs;t) rtm(opnu1olenlieta()aDrmxro;t0opt  ietld mDrlnmo;(0trtriocio1lpD lnes;(0srxo(mpnudlmtnlnet ()aDtaxr nt4tpenii3tltfs2uln s u)trxomo3oatlmt lnvs s)t2um(r3ny4ll  lici t arurumo;o0oet mi3ias a2elu p u0 rtoio iatla elueilt0trtm(rpno1llenmfvsatfsrrm(rpnt4alxomfciysfm el( o ()trxnmocootom ranvi (  2ur(r3iy1amtnlfvta(f Dtaurpno1oltnioctls m rauvo u)alerio3iy1laD auvs;()seuoim3oudapt  fet t)s2ta(mpnu0tleoio3tydla elu sn(4trxrmr oadfaDrlnvi;(0srtmxo oudame lfvi ()artr(m ou0aleoiocilsla emnms;t) rtnmf3iytop eauei;s) euoim3iodopt  ncsasfa2rmx pot0tex iietldfsDrau sn()aetnxfcoadlatelu ilt)srtmxr io1ol   fesl()sruaur ;t4oexomf3iydlmDum(mont) eerxo ia1faDelneo;t s2xoxrpoudame lneia(  rrmum ;t0optomfeiatfa2rlnms (0aleoxo to1opte ivi s srtmirpnudap emncs s srrau  ;o0tpe mociytlm2rmumo;(0 exrmf ta1lp rln s t)sexmxrpno1lpenlnetlt s2taurpno4tlxnmiciatlsDuanvo;t4altrio3iydoaDrlnvilt0s2urim nydlpenmici s)aDtmu ont0tpenmi3iydfsDrlu o u0arxnir3iytoptelivs t srurio3no4alenmfesltf rtr(roou4alen ietyd s um( o ()artnmf oatlatr nes t)s2urxrpnodlp   ncs ( a2rrxrpoo4aleo iciasls rmnmo;()tlxoxr3iatlmt livs s0teum(m3nu1olee ncsl(fsDur(mo;u4tlt iiciaslm uau ont) rtrxocty1lmDe ivols srxmiopno4am   nesat  rrau ont4tpxn ocildlm ea(vs;u)aexrirctydfa e n slt srum(r nudlpenlieslt  Dtrxr ;u0tpe  octytls2emums;t4 rxnmo oytomt  iei;(0s2tmxr ny1ame lnetlt)aDumu  nt0apxomfetltlaDem(monu0teenmf3oa1om   u ilt0 etoir no1alen nvtl( srrr(  ;t4alto ieilt a2uanmp;()treoif3tydoatraies ()trtrirpou4opt mnet (farta(mo;o4olto iciatlm uanmsnt4tetoxr oy1lpt  ieolt  rto(r3ou1lpenmiesls aDtmxront0oleomfetatlm um( p t4altoxo3iadopDeaivolt0s2xo(m3ny1ame  ncsas) 2uru pnu4aptomiciytfa2rln p u)areomr iodopDeaueo;s0teumir3iu1ll elnvta( srtm( ono4aee  ociltfa2ra(mont4tltnmo3iodlaD an i s0 eurimpnudameelnvi s aDuau  nt0tpxnmietyt a2rluvp u0trxrmrctadlmt ai s t0tetm(o3ou1oltnmnet s)sDrrxr ;o4oee  fctyt m2ul(mo t)trtomr3todoate neo (  2xmxr3nodapte nvt t)aDrr(moou1tpenifetadfs2umu s;u0aeerifcoa1fatr i s;s  2um(rpou4amenlnes s)aruru oou4oet mieiysfa ra(mo;u)aexrxo3io1fp e ieil()teumio3nu1op elfcsa(fsrtrum oo4aptomo3ils s ul( snu0arxomr tadopD  neols  2xoio io4oltelnct ()sDrmx  nt0tle  fetas a2emnmsnt0aeenio3ty1fpD lneolt  2uo(m3oydlp   feta(fsDtmxr ;t1olxn i3iat m2raump;(0 rermr3oadoptrai s s0trtm(opnodol emiciatfaDrm(  ot1opx  fetytfm2ulumsnt4 lerif oo1oaDr nvi t  eurxm no1lm   nesl( sDrax pnu0opxomi3tadla2umnms (0trxnir totfmtelueo s) exrxmpnu1aptelfvsls)aDtaxrpno1tptomi3ilslmDelu s u0 lxoifctydla rlu s;(0 etmimpnu4ole lnet s)sDra(mpnu0tleoif3ilt sDuan pnu4 reoxf3iatfp e nvo;t0setmir3iu4optn fviasfarrrx pot0tlenmi3iatfm ra(mpnu) etoifciytfa r ivs;s0 rurim oy1lmtelfeilt) 2rau  ;u0apto oeiatlaDrau sn(0altrmo oydlp e n sl(0trum(o oodape liesltfaDrrx o;u1tleo iciltfm rm( s;(0tlxnmo3oatoa ean il()s2trxrpnu4aptn fvt t arra( ont1tltnmo3iadfs rl( s t4altrmfcia1lpDraues;() rxr(m3iodom  lfct s)aDrmx ont4tlenmociatfmDulu p t0texrir todom ean ol()trxm(mpnydomen neiat  Dra(rp;u4tetnmi3ilsla ul( p;t4trerxrcoodlpD luvs s s2tm(r3ou4am nlfeiltfarum(mo;o0tpeomfctytla uan p;u0 exnmo3ootfm e iei;( sexrimpio1llt lfesl(  2rmxr oo0teenif3ilslmDuauvsn(0aetoxo3iodlpDe ies;t)t2umxr3nydal elict (f 2rrx pot4tltomiciadlmDumn p;(0 ltnxr3oadlm elu s ()s2umio oydlleemfcsa()aDtmumpou1tpt ifcilsfa2emuvsn()texomo oa1laD aivs;t)setoxo3ou4aptemfvsltf rta(mpnt0oet  fcilsfm uanmsnu0 exnmf iydfm  luvo;( srxmim iy1llen fcsatf 2umum nt4tex miciyslmDeauvs (4tetomrctytlatrlueils0trxr(o3io1lm nlivsas  rra(ro;o4olxnmocilsfmDranmo;() exomf tydoptr uvi ()trumxm3nudll nlieia()s2rrur ;u1altnmf3tad a2rlump (0trenxf3iytlpD  nvol( s2xrirpiodllte fcia(fsrra(r ;t0tpxn ictasfmDem( pnt4trtnxo ootlptrli ils)truo(o3ou1aleelfvtatf rtru pot4oex io3tls mDrlnvsn()trxnmo ta1lpD  nvs (0teum(o3no4lmee nvs tfa2tax ono1tpeomfetysfa ua(vonu4 rtrir oydlp  lu i ( trxo(opny4ole mfci t)aDtru o;o4ale ifciys m umumpn(0alerxfcta1omDe i s t)seuoim nodlptemici ( srrrur nt4aetoiiciat a ra(vp;u)tlxnxfcty1fa   ivs;s  rumxm3nodlpe mfvsa(  2trxmo;t4opx if3tytlmDrlumpnt0artrmo3tytfpDeauvs;s srto(rpiudole mnes t srtax p;u4tptn f3iysfmDelu o t0 eenmf tatopD lies;()srtr(r no1apee ieslt)sDua(mo;t1oltoioetytfa eaums;t)alxrxrciodla  livs t)srtoir iudole  ietls)srurx  ;o4tetoifeiydfmDrmnmsnu4aleomo3iadop eluvi;s)t2xrimpoydlpeemici ( arraum ;u0oeenif3ilt s ua(vs t)aeenio3iotlm  an o;s0teumxo iydap e fctl(fs2uaxmo;u1alenmoetadfaDranvs;t0alxnir oydlm raivil()texm(m3ny4ll n fvsas sDrmuronu4oex  fetytla2elnmpnu) ltnxr ia1fatr u i t  rxmiopny1om n nvtl()aDrrxmo;o1tlxoifeiat sDul(vonu4treoxf iytop r neo s0 exr(r iydlp n ivs s srrmumoot4apeo f3tys sDuluvont4artnmo oo1laD  ivs s0 rtmxr oo4al elicils sDtrxmpnt1olxnif3iadfm emnms t0trxnxfciadoa r ueolt0t2tmxr oo4ll   icia( arua( ont0tptoif3iasla2umnvo u0 eeoxrctodlp  aieslt  etrim ou1llte nesasfsrtaumooo0oet ifciad a emnvs u4tetnmr oydlat li s;s)s2tr(opiy4optnmivs () rtmxrpno0tlen ocilsfm2rmnms (0 ltrir iodomte ues (0s2to(mpiudopeelnet tfsDtruroou0apxomicias a2ulu s u4trtnxr3iadlpte i sls) ruoio3no4lmtnlncs ()sDtax  nt1alt iieiytla rm( s;u4trerxo ia1fa  lu o;t0 2tr(rpnydlle  ietltfs2rau pnt0tet moeiydlaDumn snu)tetnmo io1lpDrlu ils)t2tmxmpny4amtelneta()sDtmur oo0olxnmfetys s ul( p () exrxo3ty1lmDr nvs t)sexr(opoy4olen nci tfa2rrum oo4oex mfeiysfm em(mo;(0 rtoif iotlat  ies;()t2uoir3oo1amen feias  2trxmo;t1tlxo f3iltfs ua( pn(0 lxnmf3iatfaDean i s0 ruo(m oo4lmeemnci (fartaxm ot4olt  ociat aDum( o u) rtoiocty1lp eaneol( setrirpou1ap   nesls)arrr(  ot1tpxo o3iat m2rm(ms t)trxomfciadomD aies;s  rxmio3ny4om n ies tf 2rax ont0apx  o3tldlaDulnvsn(0 rtrxf3tydfmDelieslt0srurxr oodam e nei (f 2umur oo4opt iictls aDemu o;t0arxrmr oa1faD lu s;s  rxrxm3oodlp e nviatfaDra(rp;u1aeenmfciyd a emnvo;t)tlxrif iotlp eaivi ()teumio iu1ame livs sf rtau  oo4tpt mieils a uaumpnt4tlxoio oo1lmD  n s t s2um(m ou1om eliviat  Drmxr ou0aet mf3iat s ranmon()aleoxf oydla e ies;s)t2tr(m oo4lmtnmivta() rurxmpou1tlx ifetlt sDum( s;u4altnmr3todomD  iei;()trxrxr3nudlme lnvt t)s2rrurono4tptomocildfm el( o;u4 rxrxr oodlatranvi;(  rtrxmpnudamen icilt)sDrrurpno1texomieiasla2rmuvp;t4 exrio3tydfmtelieils s2tmxm3iu1optemfvi ( s2ur(ro;u0tlxo i3iat a2uanvo;u4aleomrctydfm rlnvils0 exmxo3nu1lmt  fvias)s2ua(ronu4oeto o3tytla2ra(vs;t) rtnmo3iytlmtean i;t0 eumimpno1lm  mivilt)arrmxmpot1teenmf3tldfm2raumo;(4 lxrir oatfp rlueslt0 2xoxm io1ale mfviasfartmxmo;t0aet  ictysfsDuan p u) exoxr oatfpDe n ils texo(rpou1optnlneilt srtaxr no1alxo o3tlsfa ranms;u4trxoxr io1lpte n sl( trur(r3nydlptemncslt s2umxmp;o0tptnmietlt a2uaums t0aetnmo3tydoa e nvs t) rur(opny4ape  icta( sDtau  oo1tet  o3ildla2ua(mo t4aexrxr3oytfpteau i;s)trtrio3no4op nlics (fs2rau  ot1tlxo fetas m2ulnvo u0trenioctytfp e n s;(0trtmxm3oudaptnlfci s s2rauronu0oex mf3tatfm el(vs;u0 etomr3oadopDrluvo (0 etmxo no4al elfvt tfsDtr(m ot0alto o3iad s em(vo t4 exrmfctydfa e i sls)teuoirpnodap nlfesl(f 2raxm ou0aexn ocildfsDum(mp;(4 exrxoctytfmDe n o;s) etrxr oy4ape mfvt s)srrrum ;o1aexomoetytfm rm( o;u)trenxr oodom   n i ( teur(o iydal nmneias)sruau ono0tpt iictatla rm(ms;(4aexrifcoadfatrlivi s trumxopiu4omtn ivi s aDraumo;o4oex ifciad mDelums u) ltrxo3iodom raues;t)trum(o nudlle mnciatfsrrrxr oo0aeeo fetlsfaDem( s;t)areoioctydomD lneol(  rxr(mpnodameemnct t)s2rmxmoot4apxomi3iad a rm(vs u4arxoio iodfa e i olt s2urxo no1apenmfvilt)sruaur nu4texomo3ilslmDeluvp (0arxrioctatla  lnei ()trxrimpio1olen fvsat)sDtm(r ou4opt if3ildla ea(vp;t4tlerxfciotfpDrliesl() eumimpoy4ol  lfes ( a2umumpnu0teto ictatlaDul( s;u0alxoir3oydlm elues;s0trxo(rpno1am  lfvslt s2rrxr nu1tle  i3iytfs2ulumo;(0 etnmocto1la r ieo;s)teumxo oudam emiei sfa2rr( ono4optnif3tad m uan o;u4arxomfciotoat li s;s teuoir3nu1ap  mnes t  ruaxmp;u1alenmf3iyslaDemnmp;()trenio3oadfate ivs (0 2uriopnydomt mnei s) 2ua(mpno4oeeo i3iatfa rlnvp (0alxnxo3tydfpDraivo;( srurir no4lp elfvtls)a2urxrp;t0tptn fctld m2rm( pnt) exoxf3oytfpt luei (0s2trimpiodopenmfvia( a2um(rpot4tet ii3iasfm2uluvs () lxnmo oodfate uvs;()truoxopnodlmtnlfcslt s2tm( p;o1oex if3tltla2rlnmp t) lxnif oo1fmtrauvolt)srto(r no1lp emnviltfaDtr(ronu1olx  ieiytfs2emumon(4trxomr oa1lmDe nvil(0s2xoxm ou1lm emfvt ()srumurp;o4aex  ieilsfs ea(mp t0 leoir iadfpDrlnes s  rtmxm iy4omt livsat)arrm(  ;o0opt mo3iasfa2rl(vo t4 leomrcoadfmt  u s t0trtmxo3nodame mnvt t) 2urx o;t4tltnmoetatls2rluvo t0arxnxf3iodoat  uvs;(0srxmxrpoy1lp elfesl(faDrmum ot1oexo fciad m emnvo ()alxoxo3ootfa r ivil( sexr(mpio1lm e ivi () Dta( ono4aexn oetatfa rm( o u4trxnmfcoytom  luei;() etr(r oodaleemncilt a2rrxmpnt1tpxoii3tldfa emn p;(0trtrmrciodlpt ln i;(  eur(rpny4ame miviasfarra( p;o0opx iictatlm emuvp u0altrxo3iadfmDe ieo;s texm(r nu4llee ivtat srurxrooo4open i3ildfaDuan snt)trxnxr tydomtrauvi t srum(r3oo4al nlicsa(f 2rrxr ;o4tpxoio3iadfaDel(vonu)alxomr tydop  ln ol( sexoiopnodamt mivil( a2raxm ot0olxn feildla ea( o t4tetniocty1om eanei;(0 etrxr3nydoptnmivi tf Drm( pnt0ape iiciat sDeanmp () eeoir3oy1fatr ues s0t2xoio3iy4olee fvtl(f 2rr(ront0oltoiieiyd s emnvp t4artnmfctytopt luei (0s2ur(mpiudamtnlfeilsfs2raxr ou0tlx  oetadlmDem(vo;(4tlenmo3todomt  u ils) exo(o3no4lmtn ncslt)aDuau pno4apt  iciad aDeau o u4tlenxf iydlmDrlnvs ( sexmxo3no4omte netl() 2tax p;t0tleoif3tlsla rm(msn()aleoio oatfmt  ueils t2xr(rpiu4ll elivi t)s2uaumono0ape ii3tlslsDem(vo;u)texrmo3iytfpt  nesl( srto(m3oo4op elietltfs2trx  nu4olenmfctlsla2rlnvp t4artnxo ootoa elnvil(  exoim3oy1lm elfctls arum(  nt1tptoiiciatls ulump (0 renxr3io1lp  livol(0setoxm oo1am e iviat)arumu  oo1opt  oetys a2ul(mp t0tlenif oa1opteln ols)trum(o oy1olt mfcta(  2rrxrono4alxn f3iltfmDulumsn(0texrxo tytopte nvo;t)teum(r oo4altnmivsl( aDuaurpot0aexn ictadlaDemump;(4aetrmr ta1fpD ai i (0 rxmxm ny4ope lictl()aDrau ont4opt mieiyd m2rmu p () exrir3todoa e u s;t texrir3ou1apeelfcsat aDtmx poo1opx mf3iadls2uauvp;(0arerxr totfatrln ol() rumio3io1ome  fesas sDra(rooo0tptnioeiadfs eln o t) etnmociodlpD  nvi s0 2xm(opny1lpenlfeia( sDrrumont4oltomf3iytlsDrlums;(0aetrmrciadoptraies;t)sruoio3iu4opt mies t s2ur(rpot4oltoif3iydfs rm( onu0trxoircoadlptraivo;s0sruoirpoodale lfct sfs2trumpno0tlxnmf3tydfa2ea( pnt) ltnif3oa1fptraies s trtm(mpny4om nlneiat)artmu ooo1oetnioeiadlsDrm( s ()trtrir3iadlm   uesls texrxrpny4om   fvt (fsrtmur ot0aexomfctas aDum( s t0 eerxf3todoa r n o;s teto(o oodlm  lneiat  2rmumpno4aex mfeilsfs ea(vsnu4altnxocoy1lmtelieo (0 exo(opnu1lpe mfeslsfartr(r oo1altniictlt aDrau s;t0 rerifcoy1fpDrlivilt)trxm(m3ny4am e neil( aDur(ront4olxoii3iyd s emuvs;u) rtrir3oytoaD li i t)trurirpou1ol   icslt  Duaur ot4oexomoeiasfm2rm( s;u4 rtrmf3ty1op r ivo;(0 etoxo oudlmenlfvt t srraxmpnt1tpt  feiytfa2rl(vp;t)texoxr iy1opDe uei ( s2xoirpno1lmenmnetls  2urumo;t4oet  o3iydfa rm( onu4aetnif3ta1faD  neslt texoir3nudlleelivslt  2rmurooo4olt mfetydfaDulumo t4trxrmr3iatfmD ai o t0 2tr(m3ou4lpte fcia( a2rm( o;t0oleoiociytlm eanmpnt0texnxf ia1fa e uvils0texmir3iu1lmeelfciasfaDtmu pnt0apt  icilsfs2rluvont4artrxocoatfmt ln s;t0texrimpnydamte neil()aDrm(ronu0ale  ictasla2uanmsnu)tetrif io1omD an i () etrimpoy1lm  miet sfs2tmx p;t4oet  f3ild m em(vs u0alxrxo ta1faD liei;t  eumxo no1lmt lfetltf Durxmpnu0tptnmo3iyslm rlumon(4alenmf oydfp rln i t srumxrpny4opt mnesa(faDurx o;u1texnmi3tydlm ul(vsn(4 ltoxr iydom e ivils0 2xo(o3ou4amte nvsls)arurumont1olt mfeiyd m elnmpn(4alxnioctadla   uvo;s0texrio3io1lmte nvs tf 2rru  no4openioeiadfaDum( o u4tltrxociatlaDeau ols t2xrxmpnudlp  mnvt sfartmurooo0tex ioctlslm2ul( o u0tetnxocoytomtr n i;( srtrxopny1oltnmnvi () 2uauro;o1apxo i3ild mDra(vpnt)trtrxocoatoatrlues t0 2ur(o ny4ol nmncsa(  Drmumonu1opxo f3tyd sDul(vsnt) lxriocoadoaDelu olt0 2toxo3oy4olt  ictlt  2urxrpot0tpenifctlt aDrmn s;u0trenifctytlmt  n sls) rxrxo oydlp nmfetasf 2rm(mpot4tleomf3iydfsDrmnvonu0tlxomr oo1latr ueo;t t2tmim oydopen fviat)sDuax  ot1texn f3ils s2eauvo (4arenmf3tatopDrai s;( texmim3nudomenmieils  rum( p;t0alenmfctydfm2ra(vs;u)tltrir tatfat anvs;(  exoxr3oy4omenlnvtlsfaDra(r ;t4oeeo o3iadla ra(vsnu4artrio3iatlaDe ueils  2xm(r3nu4amen nvi sfa2tmxroou4alxomi3ilsfaDem( p;t0 lenir3iadfp ranei ( texrxm3oy1ame mivil(farum(r nt0tpxoif3ils s2uluvs u4arxomr totfat  ueo;s) etrxm oo1lpenliesa( aDta(mpnu0apxoifeildfmDeln o;()altoxo3ootomtrlnvs s) ruoxr3ou1lmtemictlsfsDumxrp;u1opx ii3iytfs2eanmo t) etomfcoodla  luesl(0setmxm3oydome lietl()srrrxmoot1tpe  i3iyslmDrmump;()alxniocoy1laD  ieols)seurxr nydamtnlivs (fa2ur(mpoo4tlx iieiysfa2el( pn() ltnxr oo1oatelnvo t  etrir3io4ol e fet ()a2rm(rpno4tpx ii3iat sDemuvo;t)tlxnxrctodla ranvo s)s2urio3oy4op  mfci ()aDtru o;o0tlxoio3tldfs2ul(msn(4 rxrioctadlmtr ueil() rurim nu1lmtnmfei tfsDraxmpno1apeo ietld mDem(vo;u4 rtrmo to1lmD  u o s s2toir oo4lp emfctas) Durxm ;t4olt  fctls s el(vo u4 reoif iytfp raieo t0srtm(o oydopt lfeslsfaruaxmpou4apxomiciltls2elu p u0alenxocoy1fp   ivs t) exo(mpno1optelivi (fs2ra(rpno1opto f3tydfsDeluvs;u0alenxo3oo1fm rluvi (0t2uoxo oodlmt lictlt aDumxm ;u4oexnmietysfa2eln o (4aexoxr3oy1lm raneo s)trur(o3io1olen nvilt  rurxrpoo1aeeoioeiadfaDean s (4trtnmocoodfpt auvs s srtoimpiu4lpt lncslsf Drr( pou0aee  oeilsla2rm( p;u)trxnmf oa1opDe n o (  2xoxopou1lpe lnctas)a2tau  ;o0aptnmfetydfaDua(ms t) eermociotoptelu sl()srur(o iu4omt lictas  Drm(  no4aeen ietat sDranmp u0 reoif oatfm ran o s)setoxmpio4lptnmivtas sDrmumo;o0oex  i3iyt s rlu p t0trtrmf oa1lptraivo;t) 2xoimpno1opt mivsls  Duaxm nu1oetn ieilsfm ea( pnt)tleoxo todopDe i il()texrio no1lptemnctas)sDrruroou0tleo oetatlsDumnmp t4trtnif3oydlaD livsls  2xmir iodal  lncia(fsDtrxront4aexo o3iltls em(vs;t)areniociadoate i o s) ruoio ou4om n fvs t)aDtm( p;t4apxoioctltfs emu o;(4 etnmr3oy1fpD  nei () rxrir nu4ope lfeiat srtrx pno0olx mf3ild mDumnvo;u0tlxrif3ta1fatelnes s srtoxr io1oltelfes ( sDtru pno1tpx  iciadlm rlums;(0 rtoif oydopte n o t) exmxo3oo1ome mfcilt)sDtaum oo0olt iictadlm eauvs t4arxrmo tatfmDr nvs;t0trxriopiu4apt mivi t arua(ro;u1tpeo ociyd a2ra(ms;t)aeenxo oy1opD lnvsl( t2xoim3no1oleelivtas) Durumpot4teeo i3iytfmDel(vo u0texrir ta1latr u i;s)s2tmir oy4apeemivia( a2raxront1aexnioeiyt mDulnmp u0alxnxf tatfa  ai ils)sexrimpiudlltn nvs s)sDtrxr ;o1openmicildfs2um(mpn(4texrmo3oa1lm rlies;s) exoirpno1ol  mnesls) rtmur oo0tpe mieilsfs emu p u4arxnir3iy1lpt luei;t0trxrxm3iodolenlfet sfarta( oot4apx  fciysfs2ulums u0arxnxfcoatfaD an i;t  2toio iodape  nci () 2ta(rooo1aexnif3tatfa2ra(vs u0aleoxociotlatrlnei;( tetrxo3ny4ll nliesas) 2ua(m oo1tpe  f3tls a2umumpn(0 lerxocty1lmt  ieolt)setmim3ny1opee fes s)sDrrxm oo4tpto ictld mDrmu on() lenif3tadoatrau i s sexoim3ou1lmeelfci (f Drmurpno1oeeniieilsfa ea(vp;t0tlxnxo3oatlpt luvsls seto(m3iy4al   ivt t srrm( o;t4olenmf3iasls el( s t0aexomo io1om  lnesls)texmio nodopt livia(  2tm(mp;u0optomiciat s rmn o t4trenmfcoadfpt auvils0s2tr(m3iu4lp  livta(fsDuru  ;u0tet ioetlt a ua( p ()aexnmfcoa1fm e n s;() 2umxrpio1amenlfvt sfsrrrxr ;u0oee mfeildfm el(vp t0aleriocto1lpD lnvs;s0 rtoiopoo4omtemfvtl() rra(ronu4alxoioeiadfsDrln o;u0tlxnmfciy1fpDeau slt0t2to(o3oydomenmivtat) 2rrx  nt1tptnmi3iydls eaumsnu0areoxfctatfpt  ivo;()teuo(opou4lmt lfes s aDtmxm ou0olen f3ilt aDra(mp;u4texoxr totoaD lnvi t s2tmxrpoodlp elneia( s2trxro;t4oltnmo3ild a2rlnms;(0 lxrmo tadoatrauvols0 2toxmpoo1ll   ivtlsfa2ur(roou1tpeoifctyd s2rl( pnu4 rtrxf ty1omDe nvs t0 rur(m oy4open fvt t  2rrxrono0tlx mo3iat s ul(vo (0 ltoxo ty1fm eluvi;t) euoio oodoleelnvia(  ruaur nu0olx mfeias s2emums (0 etnir io1lmteaiesl() rto(r ou1amtelfvt (f 2umxrp;t4oee ifcild s umu o u4aleoif iy1omt aivo s trxo(o3iodomtelivsltfsrtaurpoo4tex  oeiasla2uln p u) eenmr3io1fmtrlnvi s  etrir3ny1amen ivtas)a2tm(  nt0oexnifeilt aDrm(vs;t) rtrio iadfm   ivo;t srxrxm3iu1amtnlnvs (f 2umxmpot4oex mfctas m uan sn()tltnio3iatfp r n s t0t2xm(o3nodam e ncsatfs2rrxr ;t4tptnmoetysfsDea(mp u0aeeomfcoatlpDr nei t0seum(rpny4amtnmiesltf rtruront4optniociytlmDemnvo;(0trxomfciodopD luvol( srum(o3ny1om elfcils  rraur nt4oee mocildlaDuluvo;(0 renmo tatfaDr uei s0texmxr3oudlp e ieil() Dumur ;t4oleniociatfm elnvo;u4 leomfcoydomtraueo;t  2toiopiy4olt mfet s)aDtr( pou4tlt  feilsls uln p (0tetrifciodoaDe uei s seurxm nu4llee neil( aDururpou4tex mf3tlt mDeauvo t) ltnmr ta1opt auesls  euoio iodomte nei t)sDum(ro;o1oet mfeiaslm2em( o;(4tlerio3ia1lateaneo t  exr(opnu4alenmfes s)arurxmp;t0oleoiicils s ul(vo;t)aetoif3tydlate u s;t0 2tmirpiu4lmtn nesatfsrurxmp;o1aleo o3iltls2ean p;u) ltrxf3iatoa  lnvil()trum(mpiu4lle lfcta(farururp;o0alx ifetldfsDrauvo u0 rtnxfcio1fa rlnvilt)srxmirpou1am elnvtlsf 2tmx  nt1tltoio3ild s2uluvs;u)tlxnif ia1op  ai s (0seurxr3ny1oleemncil(fs2trumo;o4aeen i3tlsfm rm(von()texoxr tatla   nvslt truoxrpiudaltelictl(  2tauroou1tlxo o3iasfa2uauvsn(0texnxr io1faD livs;t  ruoxm nudlptemivs (f rraxr ot4tee mictyt s2raumsn(0tlxrio iadoatr uesls texrxm nodlpen fcsat  2umxmo;t0olxniieiytfmDrm(vo;u4teenmfcoy1opD an i;t)tetmxrpiu4alenmnvtatfsrurxm ;t0olt  iciasfsDrmnmo t4 ltoif3ootfm   i i s) 2xo(r3nydom  lfcta( srrrxrpno0openmf3ils a2emums t) exoxf oydfaDe u sls0srxmio3iu1ale liesls)aruru o;u4tpxnmo3iys s uluvpnu0tlxnxr3oa1om e ivi;t)s2um(r nodap  liesls  2tmxront4tleo fcilt s el( pnt)arxrmo3oydfptrlueolt  exm(rpnudlpt  ieias)a2rm(  oo0oetniieild m2eanmp u4tlxoxfcoytlaD luvs s s2tmxr nu4apeelivt s s2tmxmonu0oeeoii3iytfsDeanvon(4arxrmr3tatoat auesl()trtmxm3oodomtnmnet t) rtrur ou0aptoiociadlmDelu s u0 lerxr3ia1op eaieols)setr(r ou4alenmfeia() 2urx  oo0aetomfctldla2ulumpnu) rerxo totoaD aivilt srxoxo3oy1olt lieia(f 2umuronu4ole mfctaslm rm(vo;u4tlenxo3totfmtraiei;t t2trio3oodome  ncsls)sDta(rp;o0olxo i3iad sDranms;t4arermf ty1fptr ieolt0 eum(o oodll   nvt t)aDtmxrpnt1alxnio3ildlaDulnvp;u4aleomrcta1op r neols  eurxrpiu1lpenlivsas)aruru pou0tpx  i3iadfs2um(ms;t) lerircoa1oaDrlnvs s  rumxo nodamt lfesatfs2rmxmp;o0teeoio3tls mDulums (0trtnxr tytoa r uesls0t2u
\ No newline at end of file
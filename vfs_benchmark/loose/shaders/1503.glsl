@@ -0,0 +1 @@
+n s;t0s2tmxm io4ol nmivia() 2ra(m no4tlenmociatfm2um( onu)tlxomr3iadlat lu il()teuoirpoydame lfvils a2rru ont1oex  fciytfs rmnmo t)tetoiociy1om  livilt sexoxmpiydapte netasfsDtr(root0texnmieilsla elump;u0texomrcoa1lpDranvslt  rtm(r3iydape lietl( aDrru  oo4altnifctytlm2ea(msnt0tltnxo3iydfm  aivi ()setm(rpou4lle mfetat)sDtr( ono0oeenioeiytfa rl( o;t)trxomo ta1fm rlues (0 rtoxrpou4op  micslsf 2rmu pnu4tpeniociad a2rmump;t4texnxr3oo1la rlnvo t) rtoio3no4lmt  feils arra(rono1tltn feias m umn s;u4 etnio3oydfpDran s;t0 exoir iodop emnci () rrmump;o1tpeoifeiytls uauvp;u0tltnifcoa1fmteli s;()sexrxm oudol emiet s) 2tauro;u0tlxnif3iasfaDranms ()tlerxf3oydlpt lu o;t)srur(opoodomt lnvslsfsrrmxmpou0tpt if3iydls ulu ont0teermo3oy1optrai o;s0s2urxo3iydaptnlict tfsDtrxrp;u1tltomoctytfa2uluvs;()altoifcty1fp r n o;()s2um(o3nudol e icsa( sDuauroou0tlenifciytla umnvs;t)tlxrmf3totoaD  nvol()tetrir3ny4ap e nesl(farra( p;t1apeo fciadlsDum(vpnu4 rerio ta1lpt anvslt0s2xr(opny4ol  lnvi ( a2rm( oou0aetnio3tadlaDrluvs t0areriocto1laDr n s () ruoim ou4ape mics ( aDuaum nt1tetnii3iyd a ran o t4tlermr oa1lmtr u o;()t2toxm ou4lp n fcslt) Drmum ou0alenmoeiyt s2ulums;u0artoif ia1om   ueo;(0sexoim3iodameeliei s)sDrau  ;u1aptomieiltlmDrmu o u0 ltnio iodlm rlneols srurir oy1ol e fcslt)srta(ront1aleoiiciadfa2uanmsn() rxnmr io1omtelivi;s0 rxrirpnu4omt lnetat) 2rmurpou4tlxn icias aDel(mp t0texoxf ty1oat lueols)t2xrxr3oy1omenliei s  Durx  ;t0aex  ociadlaDelnmp;t4texnmf tydfmD auei s0teuoxo3no4lm nlies t)s2ururpou0oetoii3iysfs2um(vp;t0texomo3tatoa elivil()trum(opno4lm  mnctls  2tm(  ;o0oeen iciyd sDrmu sn(4 rxrxfcoadom e ues t) 2xm(m io4lpt livi t)aDumxr oo1tle  f3tytlm elumonu4 leoiocty1lmD ln o;(  2umxo3io4am nmiesas  rtru  no4tpxomi3iatfa2rm(vs;t4 exnxf iotfpt ln sl(0t2umir oy4op nmfctas)sDtmx onu0aptnmfctyd a ea(ms;u0 rermf3oydoaDe i s s0 2xrxo3ny1ame lietl(  rtmxm ou4oexn i3iydls ra(mp t0trermrciatlpDe nvo;( trxmir3io4llt mfesls sDtmxro;u4alto fetys a emums () rtrxf3oo1fpteanvi;()s2umxm oudale miciat  ruax ono0opxnif3tlsfs elnvp;t4alenxf io1op rln il(0sexoir3iy1lmtnmneil(f 2umu pot4tlxniiciyt aDeanmp;t0 eeniociotfpD auvolt) 2urxo3nudll eliesa()a2umumo;t1ale mi3tadla2eluvont0texoir ootfmDrau o;s0seto(mpny4ll nmivia()arum(r no4oexn octldlm2el(vonu0texoircoadfmDr u ils  exoxopoydam  lfesas)sDra( p;u1tex moeiasfsDrl(vonu4 lxnio3iadfaDe uvo;s teur(o3iu1lmen ictatfsDtmxmoou1texnif3tytfaDem( o;t0aexnmo iatfm  lieo t setm(r3oy4ol e nct (f Dtauroou1ope io3ildfm2rln s u4trxoxr ty1lp ranei;t) 2xoio3iu4om emivt (fsDtaurono4alxo ieils sDelnmont0aleomr totfaDranvo t t2xm(mpio1lmtnlnetl(fa2ua( p;t1alto ietyt s ul(ms t4alxnirctytfatrlivs ()trxrxmpiy1llen ict (fsDrau o;o0opt if3tas a2eaums () ltnmf3ia1lm  lues (  rtrxr iodlp n nvilt) Dra(  oo1oeto i3iltlm rmumpnt4arerxr oatopt lnes s0s2urxm nu1ll nmnctlsfs2uaxmpou1olxnifetys sDrlums;u0teenio tadom elies s srtoim3iy4ap elfcs (  Duau p;u1tleo o3tasfmDem(mpn() rxnir oy1opDeaiesl(0sexrir3oy1op nmfcta(fsrur(r oo0aeenifciad m emu pn(0 ltomr3iydomtrau i;s0 rum(rpnudlpe  ivtat aruax  nu1tlt  o3tlsfs em( s u0artnircoodlp raueo;t  etrxm nudlmtelfcil(f rurump;u1opt  iciatla2ul( ont) eenircootfpt anvslt)teto(opny4amtnmfvslt  2rrx o;u4tex  i3tld mDelu o u0trtnif iy1fmtr uei ( seurxmpnydol   feia(fartauro;u4optnmi3tld sDuanvp;t) renir iadfa r u i t)setoiopoydap elnctlt a2ta(r ;t0tltomictlsfs2umn snt0tltrmo3tydomD  u slt0 2uo(m3oydolee feslt) rtaurpnu0tet io3iysfm ean s;t)tetrir3iotom r ivsl(0srtrirpoo4ol emneslt)s2rax p;o0optnifeiysfmDemn ont0aleoio3io1oat  nvil()srtoiopiodopenlnci t) rrau pou0texoioeiltfaDrln o t0tlxrxo oadlate i i t seum(r3oodlm  mieta()sDumxr nt1tpe mfeilt m2ua(vo;(4arxoxr3to1op  aueo;() 2umimpnu4olt mnet tfaDra(r ou0tltoioeiasfm2umu s t4treoir oatoaD anvilt)t2tm(m3iudap emfci s  Dra(m oo4apxnii3iysfa2emu p;t0alxoir tatop   nvi t0 ruoxr3iy1al  mnvsas)s2rmxr ;t1olt  f3iyd aDrln p (4 etomo iydfpDeluvo;s0setrio3oudlmtnlieils) Duaxrpou0tpenioetad sDemumo (4treniocoo1lpteau ils t2umxmpnudlmtemnvt tfa2ua( pno4aex  oeilt m ea( p u0 ltnxocoa1fa rai s s  exm(m3oodamt  nvia()sDum( pnu4aleoiieiad sDeln on(4tltrif3tydfp   neils0sexrio iu1amenliesas) 2raum ;o1oeeomociltfa rln on(0tetrifciatfpt  n il( t2toxmpoy4lm nlfcs ()sruax ooo1optnio3tasls2ea( pn(0aetoio3oytopteauvols  rtrimpiodam  mnciatfs2rm(m ;o0olxomoctlslm2uanvs u)tlxrif3to1fmDe ueil(0 rurir no4opt  ivtltfarur(mono1oetoifeiad m2um( ont0aexnmo ootoptrluei s0 eurxo io4ap e fvsas) rrmurpnu4olxn feiytfaDemn sn(4aeeoxociadlate n o;s  rurim iydoltn ivilt)sDtmxr ou4tlenifetysls2uluvp;t) eeomr ta1fmDeaues s s2uoim3io1ap nmict t)s2raxmoot4alen ieiad m uaumo (0trtrmr3to1lpt lies ( srtoirpio1lp   icil(  Drr(mp;t4oexn o3iytfs2em(mpnt4 etnmr3iy1fmDeaneo;t0sexr(o oudalte ieiat  rraxr ;o1tpto o3tydfa2el(von(0alxrxf tytlm  anei;t0t2xrir io1ale lfctls) rurur ot4opxn feildfmDulumsnu)trxrxr3tydlptrlnes;(0 2xr(m3iu4ope lieias artm(m ;o1tpe mf3iyslaDum(mo t)treoir oatfa e nei s sexr(o3ou1alt mnci s s2ua(mo;o1alto f3iatlsDuauvo u0tlerir3oodla r ivi;()s2uoiopou4llt  ieils  Drr( pno1alxoifciydfaDulu p;(0 exoio3oo1optrliei t0seumxm io4oleemfeilsfaDum(rono1olx  fciatfa2rl(vp;t4aeerxr3io1la  ln i ( seur(r3oy1altemict tf 2um( ooo1tpenmoetys m2ean p;u4tetnmo iytlp r nvils) rtm(r nudaptelivsat aDua( o;t4tptnioctysla2em(mo;()aexnmocio1fa elieil(  rtrir3io1lmtnlieias) Drru  ;o1apxoifeiyd sDemu o t0texrxo iodfa eli sls)trur(o3io1lmee ieilt  Dua(r ot4tle mf3ilslsDemuvs;u4 leomo oydlaDelueo;s)srxm(m3nu4lp e fet tfarrruront0aeeomf3iysfs um( o t4tlerxo3ty1laD li s;(0 exoirpio4op nlfesatfa2ururp;t1aleoiictytfa uan s u) eenxr oo1oate i s t) exrxr oy1lptnlfvtatfa2tmumpou1open oeils a uan p;u0aexomr iodfmD livil()teuriopiodop emncsat) rum(moou4tee mi3ilsfa rl(mo t0treoircoa1lp eln o;() eum(r oy4oltelfesat) 2umxrpnt0apt  ictltla rm(vp;t4tetomfcoydla eauei t0 exrxr3oo4lp  mictas artrur oo1texo fcilslaDrm(vs u0 eeomf3oo1lpD  neol( tetrim3oo1omt  fetls  Dtr( pnt1alxnmictlsla2rln p u4trxnmo iodlate nei s texoio oo4lp  mivi tfa2ta(mpot4alen fciydls em( p t4 renmo3oodlmDelueo;t0 eumir3nydapen fct s)aDum(m oo4tpeoiocilsla2ul(ms;u0trxrmo3oodlatr ivs t0t2tr(r oudam n iesat srta( o;t1apeoio3tytfsDum(vsnu0 exrxo3iydopte u il(0 2ur(r3ny4optnlnvil( sDumu o;o0oetnmfciasfm ul( ont4teerxf3iatom  li il() eum(opiu4lp  livilt) ruaur ;o4ale iietatfa2el( p t0 eenmocto1latranvs;(0s2umxo3nu4lptnmicilt  2tm(  oo4tptnmf3iaslmDuanvs;()artnxr3oy1laD aivi ()s2xoim3oydalt  nvi s) rtaum ;u4alxoii3ias a elu s (0aetnifcootomDelnei t0sruriopio1lm  lfvtat aDurump;o0olxn icias s2uan o;u4 rxrmocoatlmteliei;s0 2tr(r oydapee ivilt)srtrumpnt4ape ii3ias m ua(msnu4tleomf3tydop   i il(0 2uoir iodole lncsa()s2tmurpnu1tle  f3iydfm em(ms t0trxnxf iodlpDe ivs;(0 exr(opoudopee fcs (  Dur(mp;t0olen oeils s2rm(mp;() leomf iadopD auei;t0s2xo(r iydlm emfet sfartaumpno1tltomf3tydlm2emnvsnu)tlxnmoctydlpDr ueols)srxr(o oy4lltemics t  2umxr oo1apt  iciyt mDulnvs t0alenmfctadfpDeai il(  ruoxmpou1amen nes t s2umx pnt4tlxoiictltfs uanmpnu) exrxfcoo1omDrau i s0 2ur(m iy4ap  mietltfartaum oo0tpx  ictld s rmnvs (0tltnmo oadlatean olt trtm(opoy4lleemieils) Durxr ;t1tpe io3tydfs2umnmp;u)aleomr iadoa  auvi;t)trxoxr3nu1om elfvtl( sDrr(mpnt0aexn fctltlsDemumo t0 eermf oodfa eaivo ()t2xriopnu1am   fvs ()arrmur ;t4olen feias s2eln onu0artoif oatfmDrlu o;t  eto(rpnudalte fvt sfsDra(mo;u4oeenioeild sDraumonu)artriocoadfate u i;s0 etmimpiy4oltelfetlt  2trumo;u4oltomoetysfa rau o t)tltomo3tatfmtelieo (0 eto(m3io1amtnmieil(f rumx p;o4oeeo i3iys sDrln snu)trenir3iydlp   uvolt) 2xm(o oo4lltemivtl()a2rax ono0aet iiciat a rluvs;(4 lenmf3ta1om  ln ols0t2ur(o no4lmte fvsa(fs2trx oot0teeoiiciydfm umnvpn(0 ltrxociotlmteli o s  2umirpnodapenlfvs sfsDrmu pnt1tlt  f3ils a2el(vont)aexnxr3iatop elues;s) etmxr no1aptnmfesltfarraurono1tle miciat mDrlu onu4tltnmf tydfm e ivs () etm(m no1al e ici tfaDumumonu0oeeniietlslm2uluvonu4 exomociodlaDeau o s0 2uoim3nu4amenmneiat) rtau pnt4ape mociytfmDranvsnu)teeoir3ootfmtrln o s)srxrxm3no4lmtnmictat) Drrxrono0olxomfeiltfa2uau o;t4tlermf to1fm raueilt  exr(mpnu4ll emneil()sDua(ro;u0texnioeiydfa rm(von()texnio3oydoaDr i olt0teumxr3nydllt  ies s)srumx  ;o1aeto ocilt s rm(mont4arerxf oodla  auvs t0t2xr(rpno1am nlfvtas) Dra(  ot1teenmoeiatla raumpn(4tltrxrciydlpteauvo t) exrxr ou1altemnci s artrurono0tptnmf3tyslaDrm( p;(4arenmrcty1lm r ueslt0trxmio oy1ope  netat)arrmxr ou1olenmfetatfm2ulnvp u)artnxfctodomD luvilt t2xmxmpnudome  ivi t) rumx  ;o0tetomfeiadls uanms (0teenmo oa1lmDe i ils) rurim3no1alte ivil()s2rm(m no4aeeoiocils m ran p u4tlxrmrciy1lpDr uvsls0 2tr(r iudaptemnvtat) rrrxm nt1apt moetlsfm umu pnt0aexnmf oa1fa r u s;(0trumxr iydap nlnviltf rururono0alxn ictysfs2emumo;(0altnxfctytlatr nvi;t) 2tm(mpoo1apeelnvtas s2trxrpnu1olt moctas mDem(vp u0 eermf3oytlp elu o () rxo(o nydapee nes t aDra(m ;t4aex  feiysls uanvs;u)texomrctadfmtrlivol( setr(o oy4lp   fvs ()srururooo1tptnioetatfm2rl( pnu0 reoif3ootlaDr uvo;(  2uo(r no1llenlnetasf Duaxr nt1teenmfctys aDuan p t)arxrmf3iydoaDranes;()t2xmim oy1lle  fetls sruaxroot0tpe moeiltlaDuau on(4aleoxf todlpte uei;t0srtm(mpiu4ap elfcils)artm(mooo1oeenmo3tad aDemnvs;()treoifcoydfaD lnvols0 eur(r3oydaltnlnvtat)artmxmo;t0tltnioctysla2ul( snt4teeomo ty1lmtelu sl( t2umxr3ny4opt  iesat aruaum no0oeeo ietytfsDra(vpnu0 ltrifctodfm   ueils0t2xriopno1ap nmfvi t sDrr( o;t4oeto o3iadfm eaumo (0tltrmf3to1lmte i s ()teuoxrpoy1olenmicsl(fa2rm(root0teeo o3tyd s2eanvpnt0 exniocoatomDeln sl(0 rtmxo iydolt mnet t  rraxmoot0tpto i3iysfs2rlnms;u0trxnmf ootomtelueo;( setmxrpio4alt  nvilt sDumuronu4aetomoctys s2ua(mpn(0 eeoifciadlmDeaivo s0srxoxm nu4lmtemnci (f rta(m no0tptoii3tyslaDrln pn(4 eermr iatopt an ol(  rum(o io4optemivtat) 2uru  nu0apxnmf3tad aDrl( p;u0 rxoif totlpDelnei;t0teuo(opno4ll nlfcil( sDrr(r oo4apxnmieiat m2emnmp;() lenxr to1la   ieo;t0seuo(o iydap e fcias a2tm(mo;u4opxomieiyd aDraums u4 rxrmr iydfm rli i t srtoiopoo1lltemnes tf Drr(m ;t0aptnif3iysfsDumuvp u0teeomfcto1lpDeauvols0 2tmxo3oy4lpe mnvtl() 2rm(mont0tlx miciltfs2emn on(0aleoxfcootopDr nvol(  rxrxo3ou1lm emicias) 2ta( o;u4aexn f3iltla2uauvp u4 lxrmoctodlpD li i;t0s2um(r3iy1al emncsltfsDua(ronu0openif3ildfm ranmpn(0 lxrxfcoy1lpDrauei s0 rxmxopny4omtelfciatfsrtaurp;t0tlx micilsfs ranvs u0tetnxr iydlmD  i o;( seumimpoy4ol  livsa(faDtr(m nt4tptnmo3iytlmDemumo u) leoir oadlpDelu il( s2xrxo nu4llen iesa(fsDtr(  ;o4aleoifciltfsDeln p t) rtnmf ootomt  i o;()sruoim iu1ol  mncsa(fartm(rooo1aee ioeiadlmDumumpn(4 lermf3iotlm  an o t tetoim iodom nlicilt)aDtmxr nt4tee ii3tlslaDumnvonu)trenmr3oo1fm r u o;s  2xmir ou1omt  fvt s  2uaurp;o4tpxnio3tatlsDeauvs t4tlenmr3ty1optrlnvs t0trxm(rpnu1ome lnvt ( arrr(ronu0tee  ieildfm ulump u)areomr3totfpD lieo s0s2uo(m nu4opeemfeils  rrrxm nt1alx mfctytfaDrlnmo t0trtnmo3iadlateai o;(0sexmio oydlmtelnvt s)sDuax o;u4tpto oetatla2rauvs t0 etrif oodfa   uvsls) 2urxm oy1apt  fct (  Duaxmo;o1alt micilsfa uluvs;u4aeermo3oytfa ranvi ( trxmio oy4ap elieta(  2rmxm oo4apt  icildfs2um( ont4 rtrmo3iadopteaieols) eur(m iy1apenmnvia(  2uru oou0opto iciadlsDua( p;t0trtnmfciytfm  lues;s0trtrir3oydal nmiesat)a2ua(  ou1teenio3iasfs2eau o;u)tlenmfctatlpt lnes s0sruoxopoy4openmieilt arrmu p;u0alto i3iltla2eauvpnt)tlxnxo ootoaDeanvsl() rtrxm iudlpee feias s2tmum oo0apeniiciytla2el( o (4texoirctytlpteli o s  rxoxo io1omtn neta()a2rru ono4apx iociydfmDulu s;t4 exnmo totfptrln i ()s2uoim3ny4alen fetl()sDta(m ;u0alx mietad s ranmp;u)altoifciytfm   u ols t2tm(o io1lmt mnvil( a2rr( pou0apxn ieiatls2ran pnu4trtrxfctydfpteaies;(0 2uo(r no4ame  nvs sfaDuaxr oo0opeomictltfa2rauvon(4 rerio3iydoate ieslt0sexrxrpou4apeelnctl(f Drr( oot1tpeo i3ilt m ra( ont0teenmr tatlpte ieil( s2xoim3iy1lm  lfci t)arumxro;t0tpe io3iasfs rauvsnt4texrxoctydfmDeauvilt sruoim3nodllee fvsa() rra(roou0aptnmietat m ua(mo;u0 rxoxr3ta1opD  ies t  eum(o3oy4ap elncils srururp;o0tpx mietltfa ul(ms;t) lenmr3tadopteauei;(0 eto(opou1optemivilt s2rax o;t0aleo fciyd s uanmo;(0 eeoirctotlmtelu i;s trxoimpnodapenmfetlt srum(m ot4tpx io3tad mDum(vo u) leomfcio1fm rlies;s trurxrpoy1opee ivs s s2um( pnu0apto fciad s ranmo ()aleomo iodom  anes;(0srumxm3nydopt  ivtls) Dtru ont4tptn feiytlm2rmump t0aexrmrcto1oatrlues s)srtm(mpio4amtelicta() Dtm(ro;o0oetnmi3iasfm rluvp;t0altnxr to1oa rauei;(0s2urxm nu1aptn ieils)s2trxm oo0olxn f3iltlsDem( p;u4aeeomfctydla eanvil(0teumxo iy4lmt  fcsl(faDumx oou1tex if3iydlm2rmnms;u4trenmfcoadlptr u s s)srtm(opiu1alen fct (fa2rrumo;t1tpenmfctas mDeln p u0aeenxo3oatlaDe ieilt)trtr(opiodlpt micia()aDuauro;t0oex ifctys a uln sn(0trxrmrcoodop eliesl(0t2uoxm3ou4lptn icslsfa2tmurp;u4ope ifeias s rl( s t)tlxrmf3iydom  au o;s0seur(r iydalt lfetl(fsDtm(mpno1olt ifetydlsDum(vs t4alxnmf3todfa r n sl()sexr(m nudom  lncia(farrr(mono4tlx ioeils m rmu o u0aleoio3oadfateauvsl( seuoio nudlpe lncta()arrmumo;t1aetnif3tlslaDuauvont4artoio3oatlp e nvs;s) 2tm(o oydlmt  fvia(  rrrx poo4alen f3tld aDulnmo;(4texrxfcto1lmtraivo;( texriopoy1open nctlsfsDurxr ;u0aeenifciasls2eauvpnu4tlxrxr3oy1fpD  ivo;t trxrxo iu1optelfvtas aDuauro;u4tee mo3ias s uanmp;t) etnxrcoodopDrlnes t teurir iudlltemfei s)sruau  ;o0teto feildfs2elnmo;() rxrio io1fateau o;s0tetrio3oodol   fei tf rrm(  no0oleniiciltlaDea(vo t4 reomr3to1lpDeau slt)setrxr nydlm nmfesls)aDtaurpou1olxnioeiys m ulnvs;(0 rerirctydlp   uvs () exmxmpiy1olt mfvsa(f rtrxro;t0tpeo ocildfsDul(vpnt4aetomfctotlmDr ieo (0t2toir3iy4alenmfctl()sDrmxmpot1opxo f3ilsfa2em( p () etrmf todomt lnvil( setrxm io1al e nvtat)s2tru oou1oexnifeiys sDem(ms;u)aexnxf ia1lpte n i;s0texo(mpno1omeelnes (fsrtrxr ot4ole mictyd sDulnmp ()arerifcoo1lp   nvs s0trxrxr3iudamtnmictlt)srrax ooo1texoifeiasfm ranvo;(4 ltoxf3oodla  ai o;t setoimpiu4opeelivtl()sDtmu pou0oetniicils s2rl( s;(0 rxoif3tydomt lieolt t2uoirpnydop   fcias)srraxmont0tee ii3iytlm elnvonu0trtoirciatfa  lnei (0srto(r ny1ol e iviat sDuaur nt1opxnioeiysfa uanmp t0alenir iadoatraivi;t0t2um(o3iu1omte ivtasf 2rrx  ;t4apx  ieiys s rm(mon(4tltoif3iatomDeaivs;(0sruo(r ny1lpenlivt tfsDtrx poo4tltniociys mDumuvsnt0tlenmrcty1la   nvil(  rtr(opnydame licsltf ruau  nt0oet iietltla rau o;u4 lxrio3tytlaDeaiei (  rtr(opoo1ol e ivs s)aDrm( pnt1open feildlm2eauvo;u4 rtrxo iodlate ues s0truo(m iodolt lfeslsfa2urur no1teenmiciytla2rmu o;t4tetoxf tadfmDelu sls tetrxr3iy1lme  icils) Drrumpou4aexnmo3ilsfa2uan s;t4 exrxrcoatla e n o t)teur(opoy1al nmnctlt)srrrurp;u1olxoioetas m ul( o (4 lxoxfcia1lm  lnei;s)srtoxm3io4ll e neilt)sDtrx poo4openmfeiadfa2rmn s;()areoif ta1opDrai o;s0trumimpiydope mfeil()arrrx oou1aptomieiydlm ra(vo;t) lxrifcoodfptraieslt)sexm(opoodalt mfetls artr(moou4tpeomfeilt a ea(mpn(0aetrxf3oy1opDeluei ( trtoio nodal e fcils  rrru o;o0apeomietls mDrmu s (0tetnxo3iotlm r i i ( sruoimpoydomtnlneia()a2rrx  ;u0tpx  ietydfa2rlnms;t4altnxo tatopD  ivi;() 2xrirpoy1ap e iciltf 2tmumpot4teeoif3tltla2ua(vpnu)altoxo3tytop   uvslt)teto(o nodllenlivtls a2rmxmp;o1tlenifctydlaDrlu s u4artnmf todfpD lieil( srxrxo iy4ap nmietl(f 2urxm no4tetomictld aDrmn pnt0artoxf3iodopt luvs t0 2um(m3ny4ape  ivsls) Dtaum ;u4tlt  ieias m2umn pnt)arxnxrciodlm rlivs;s t2tm(opoydam   fesls sDtrump;u0optnif3tydfm uaumpnu0trenmrciadoa r iei;t) 2xm(rpiodlle lfvsatfs2uru  ;t4opeoiiciysfs rm(mp;u4aetoxrctadlatr i sl(  exrim io4opt  ncilt)sDtm(rp;o4tlen ietldfmDean s t0tlxrmo3tatfmD lu o t s2uoxopoo1al nmivtas)aDtmxmpnt4tlt mociaslmDeauvp u0 exrxr tadoaD  uei s0s2uo(rpiudaptn netl(fs2ra(rpno4apxnif3ils mDum( o;t0aetrmf3tatoa raivil() rxo(r oudol n ncils) rurum ot1opt micilt mDrm(ms;t0arermr3iy1lpDeliei s) rxmxr io4apt  fet (f 2rm(root1apxo ieiytfaDem(vo;u4 exoiociadoa eaueilt)s2uoim3ou4open nesas sDraxmont1ope  octlt m em(ms u0 rtnmf iy1lpDrli i;(0 etoxopiu4ome  ici ()sDra( o;u4apx ioctatfm2eanmsn(0alerioctytlmteauvil()trumxopnu4ame livil()srrrxmp;t1tlx  oeiasfsDra(vs;u)tetnif3oo1fpt  nvo t) exo(m3oodlmt liviltfsrrrx o;t0aex mo3ild m rluvp;t) lermfcia1lmDrliei t)t2xo(mpny1amen nvil(farra(mpnt4teen o3tys a em( sn(4 etnir oatfpt aneil()sruoim3oy1olt mivsl(f Dtaur ot4tpen ociaslm2eanmp;() lenif oadlm r uvi s) rtoirpiy4apte fci () Dtm( pno1tleoiociasfaDelu pnt0aexrmf oy1lpDeaivo ( srxo(rpio1ole mfet t a2uaur nt1alx io3iasls2eanvo u4tlxomrctodfa e n sls) 2xo(rpiudop nmnctat)srraxr ;u0apxo f3tlsfa2el( onu4tleoxr3todoaDrau ol(0srtrxmpno1ap nmnvtlsfsDuaxm ou1apen ieilslm2rm(mpnt0tetnmo3iatopt  u o;t seumimpnu1oltn ncsat srurx p;u0tlxnmi3iltlm ua(vp t) etoxr3ty1fp elivs;(0sexoxo3io4lm e fctl()srtr(mpnu0aeto feiatlmDelums u0trerifcoatom   n o;( teuoir oo1om e fcs t)a2ur( o;o1tlxo f3iltfaDea(mo (4artomfcoydfp elueo s0 2xm(m3no4optelivtlt  2urxro;o1texn ieiys s2ul( ont)tetnmf3iodlpDeaivi s) 2umxopoy4om nlnetls) 2uaxronu1tetomi3ils mDrluvsnt4treoxr3ty1omtrliei t)teuoimpiydlm elivilt arumxmpoo4aetnmietyd s ul(mp;u0 renircoo1fa r nvs;s0 rtrxr ou4lpte fvsltfaDrrx  ;u1tltoio3iadlmDeau p;t4tltrxf3ta1lpDraneilt srxm(rpnydamt  fvsl( a2um(moou4oeto ietys sDrmn sn()aetrio iytlaDrauesls0trxm(m3io1ll  lfvi s  2tr(  ;t4oex  oetytla rlu s u0trerio iatom eaueo t0seumir3nydam emieil() rum( onu0tpe  fciltfm2rlnms;(0tlenif ootoa elivils  exr(rpio4am nlfcils)a2raum ou0alx if3tatfs2umump;u) exoxoctadoat lieo;t) etrio iu4omtnmnetas) rtmu o;o4tpenioeiat s2rlnmp t) etrir tatoaD  uvs s0teurim iy1lltnlfesa( sDrr(moou0tpt ii3iatfs2um( onu)teerifcta1lm  aivi ()srxrxr nydomtnlneiat) rum(r ot0tltniocilsfsDrmnvp;u4 exnio ty1fatr uvslt0 ruo(r3oy4lme mfesa(fsrtm(rpoo4aptn f3iytfs2ulu snu0artomoctytoaDeaues t0trxrxr3nu1lmtnlicils  rraumooo4teen o3tasfsDrm( p u0tltoir ia1fpt auvslt) ruoimpny1al e neias  2um(rp;o1ale  i3ias m eaumpn(4tltnxf3oo1fpD  u o t0sexo(o ou1ol  mfet t)aDtax  nt4apen f3iltlm2ranvsnt) renxociytopDeauei t)s2xoir iu1lm   ietas)aruau pno4oleo ieiys a elumpn(4areoxf tytlaD  nei s)teur(rpio1altemfesl() rra( pnu4tpe iociadfa ulnvp ()arerio3oadfaDelnvs t t2to(o nudlp   fvt s) Dumx pou0aexomociltfm2rmnmon(4 lermocoydoa rai s ()s2toxo oodap elfvs (fs2trx onu0oleo ocilsfa2elnmpnt)aetoxr io1faD ln s s0s2to(r3nodamtn icsl(f Drru pno0tltoif3tatfs2ean pnu)trxoifciadopDrlues;s0srxmimpnodoltelivs s  2umxrpot0alx mfetasfa uaump () lerircia1opDrlneils0 rtoxopno4omen ics (f Drr(  ;u4olxomf3tad m2rmuvont4areoxrctydopDr nvs;t  rtrir3iydlltelfviasfaDtaumo;u1tlt  i3iasla rlnvo;u) etnmf oatfpDraiesls srumir oudom   icia(  rumu ono0olx  fciysfm rln p u0tltnif totopD anvols seur(o3no4apte ics ( arta(mo;o1openiicild aDumnvo;t0 lenxo3iytomDr i olt trtoxopiy4lp nmivsasfsrraxro;u4olx mi3iydlm2ran s (4 rxnxocoa1la eluvo ()texoio oudol e nvt t)s2rrxrpnt0aetn ocilsla2el(vp;(0aexomociodlp ean s;s  2uoio iu4ape  icsat artr(  ou4aetoio3tytla ua( s;t)tlerxr oa1laDeai ils s2xrxmpiydomtemncia()a2uaxrp;u0tee ioetyt m2elnvs;()tetrxrcty1opD anvo s  2trim3nudoltelfcs tf rrru  nu0olx moetad a um(vo t)aexoxo3ootlpD  nvi t  2tmim ny4oleemivsa()arta(m ;t0tetoifctyslaDulu onu4tlxoxfcia1fptrlies s)trtrimpoo1amtnmfvtl(fsrtmxrpnt1olx  iciad m ean snt4tlxrmfctytoaDe i o t s2xr(mpny1om elfcsl(f Drrur nu4tpt mfeiyd a ra( pnu0aeenif iydopD  n olt  2xmxrpiy1am nlivias sDum(mp;u4optn fctys mDran p u)arxoxo3iotfpDeauvs;t) etoxm3iu4aleemict ()s2tax  ou4oeenii3iasfmDranmo u)alxrxr3iy1lm rau i;( trtr(o nu4ame  neils) rrm(moot0tpenii3iatfm2el( o;u)treoxfciadlp eln i t0 2xrir3iy4om emnet sfsDrmu  ;t4olen ieiasfsDrln s;(0aeerxo3oytoaDeanes;s s2xmio3oy4ope mnvils)aDtmumpou0oleomoeildfsDemuvsnt0teeomf3iadoaDe n ols srtmxmpoodom elivt ()sDraum ;t1tlx ioeiltlm eanmp;u0texnif3ia1omteluvo;(0srxrxo3iydalte fvt t aDtm(m ;u0tltoiieiltfs2rlumo u4 reoir ootfpteaivi;t0setoxr ny1apee ictl(  2um(r nu0aptnioctlt a2rl(msnu0 rtnif oy1fmDrln il( trur(opoodoptnmnvs tfarrmx  nu4aexnifetyd mDem(vs;(4altnmr ia1lm  lnvs (  exoio3iu1lmtemicsl(f rur(m ;o4tltnmf3iyslmDrmn pnt4altnxf oo1lmDrln i t0srtm(opiudlpen netls) 2uru pou0tpenioctytfmDemnms t4 rtnio io1omDrli i s)srxrim iy1al emivtat srtmur oo0alenif3ild aDuaumsnu0 lxnxfcia1op  anvi s)tetmxopno1lleelneilt  Dumxr ot0tle if3tat s2ul( ont0 lxrio iydlm r nei (0t2uoio3oy4lmt lfeslt  Dtr(r no0tpt  icild m ulnvont)artnmf3iatlmtelieo (0seumio3ny1lmeemfvsls)s2uaxrpou0aex mi3iltfs2ean snu0trxoircoatlpt  nvslt0s2xr(opoy4op nmfcils)aDtmxrp;o4oetnifeildlm2ean p (4tltrxo oadla eaneo t0setoir3no1ameemnciat sDumx ono4alxomoeildlsDrau o (0tetoxrctadop rlueo t) ruo(m iy4oleelfvia() Draxront4oexn oetlt sDea(vo;u0tleomfcootomt aiei t0 2xrxo3nu4lpt mfcias) 2rmxmo;t4tpeomicilt a2rau s (4artrxfciytoate ies s0 eur(rpnydlmtnmncil(fartmumooo1tlenmo3tadlm2ua(vpnt0aeerxrcoodlaD  ivils  rtr(mpiydam n iesa(  Drm( ont0tptn feiadfmDranmp u)aetnmocoadlp e u o;s)trxmir3iu1olenmfet (farrm(r oo1oet  feilsfm um(monu) rtrxr totomteaneo;t0sexmir ny4olt  iesas) Dtaumpoo4tpx ii3tls a2uan p u4alerir3oatoa elnvo;(0 rxoir3iodole mfcilt) ruru pot4tleomi3iaslm eln o;(0aetrxocio1fmDrlnvo () rumir oo4olenlfcs t)srtm(mpnt0oetn f3iydfm2ul(vp;u0trxrmocoa1fmt anvolt) 2umxrpoo1lpee fesa(  2ra(  ot1tlxniociad aDuauvsnt4altoircta1oatr ieo;s) rtoxo3ou4om nmfeslt a2trxrpno0optn fciydls uau ont) rxnmf3iadlmtranes;t0s2trir3iy1apeemfctat  ruax  ;t4aexo o3ias a2emnvo t4 lermocoodfpD ln slt  rtr(m3oydlp nlivtl()aDum(mp;u0tpxnifeiad m2um( s;u4tetrxo3tytlpteai i;t setrxr oy4oltemivs sfartaxmp;u4aeenmi3iyd s2elnvo t0aexoxf iotla rln o;( srtrxo3nodllt mivia()s2rau p;o1oeeoiiciadfa emump;t0altnioctatlm e neils0 rxrio oo1ol  lnctatfsDum(r ;t1olx  f3iysfs rauvp;t0 lxnxociodop raieilt)seum(r3oudaptemncias  Draumpot1optoif3iys s rluvont4trxrxo3oytoateanvi ()srxrxmpiudoltnlnet tfaDtmu  no0tlxnifctatls rl(vp () renmf todfaDr nvi;t)srxmiopiy1lmen fvta(fs2ua(moot0aee mf3iydlaDem( onu4teenio3iadfp e ueolt0 rum(o3nu1op emicsa( srrrxm ;o1oet mf3iat m uauvsn(0alenmr to1lp e ieolt) 2uoxmpiydlp e ivsat  rum(mpnt4tpxo o3iat aDem(vpnu) leoif iadom rln sls)t2trxo3no1openlictls)arrr(mpot0oet  ictlsfa uauvpn(4altnmr3oatlatraivs t) exoxm3nudal  lieslt) 2rax  ot1tltnmoeiydlaDrm( p;t) etoirciotfa ranvi t0texoir oydomtemfvtls)a2taxm ;u1aexnii3ils aDemu p t0arxrio3totfmDeauvilt) etmimpny4lltelnciltfsDuauroou4opx  i3tls m2ea(mont0alerxo3oodlp elivilt)tetrxmpiy4openlivi ( arrm(  nu1aleomo3tltfs ulnvs (0tlxnxo3iodoaD aivsls)t2trxm3nodlpenliei ()s2rm( o;u0tptoio3iad aDeanmo u4 exnxr3tytfptr i i;t0teum(mpiy1optnlfvi s)srta(mpnu0aexomiciat sDuln s u)altniocoo1faDeau i t0 rtmxo3oy1om n ies (  Dtrxmp;o1tet mi3ilsfs ulu o;u4tetoio3iotop eln s () etmio iy4ll nmfesa(  ruaxr ou4optomiciys mDulumo;u)arxoxf3tydopteaivi;t t2ur(o3nodlltn fvsas)a2rru ono1oeen f3ils a eaump;(4aetoxo3iodfm  an il( s2tm(rpoy4optnmieia(  2rruro;o1aleo ieiadfs rmuvsnu) etrmoctydom   uvi;s trtmxmpoo4om  mivs t arrmx poo4oetnif3iltlm em(mo;t0trenmf3oytfa rlnvilt0 rxrxmpny1olen feta(faDua(rpoo0tltnii3ilsfmDem(vp u0 lxnmo3iadoateau i;(0setoxo iy1amenmnei t) rta(m ;o1tee mictldfa uaumo;()tlenmrciadlptr ies ()s2tm(o no4lmt  ivs s  Draxm ;o0olxomoctytls ra(ms;t4aetrir oo1fatelueo s) eurxr oo4lmtnlivsl()a2tmurpno1tpto ocils m elnms u)aleoio3oatfpD ln s s)t2xrim no4altn ivt t  2tmum ;o0tlt  o3iysfa2rm( sn() rtrio3iydopD lneo s0 eum(r ou4ope lnei (fsrrmxm ot1altn o3iasls2emumpnu4 lerxocoodfat li i () 2urxm iu4ol nmfvsat  2rrurp;o0oltnmfciatls2raumonu4 exrxo3oydfa raivsls0texmio oodlmt  fcs tfarrax  nu0olt mi3tls sDumnmp;u)alxriocoadlaDeai il( setmir nudlp  lnesat)arrmx pot0aleo i3tydfm2rlnmont4trxrmfciy1oaDelu i;s0 exr(o oy4ll nmfcsltfsDurumoot4ope iocildfaDran sn(4artnmr to1fpt lnvslt)s2urio ou1altn fvilsf Dua( ono4aetomoeiatlmDrmnvsnu4 eenir3todlatraies;s0srxoio3nodomenlneta() Drmx oot0aptomieiasfaDem(ms u4 lxrxf3iy1lm   u ils t2uoiopnu1al  lncsl()s2rmur ot1aleo feiat a rm(vs u4 etnxfciotfmDe ivils)srxoxmpoo1lp  lfvs s arum(m ot4teen i3iltlmDrmn s ()tlxoir3iydfp  li slt0teurim no1ll n nvtls a2tmxmo;t0apx mociltfs2uan s t0 eerxr tatlaDraneo;t0 2urxopnudaptemfctltf 2rmxrpou1ale iociatlmDelnvs u) reoircoa1lmDelnesl(0trto(mpnudop elfvilt)aDrr(mpno0apxomo3ilt a emn o;u4tltrmr3iotfp   i ilt srum(o iy1ameemivtlt a2trxm ou1oeeo ietlt aDrmnmpnt)tlxnif3iydfpteaieo;s srxo(m3nu4lpenlnci t) 2umxr ou1tle  f3iadls2uluvo (4trerio3ootfatranvsl(0sruoxo3oy4am emfeiltf Dtm(rp;u0aee ii3tasla uln o;u)tlxniocootfmte neo s0t2uoirpnu4llte nvs (fa2tm(mont4optnmf3iytla2el(mp (0artoio oy1lmDeaieols)teur(o iudlmtn ncsatfaDtmxmo;u1tlx  f3iys m2ul(mp;t4arxnxr oytom e nei t0srto(opiu4lleelfci (  2rau  oo4apxoiocilslm2rlnvs t4trenir3iydfa eluvs;t)srum(r ou1lp n fei sfsrtmu  nu4oex ii3tyslm2rl( o (4alenifciy1op e i ils)srtrxo no4al elnvil() ruaxm ot0aetnmoeilt a umnvonu)tlenio iy1laDr ivi;t teuoir3oo1ap n fesa(f Durxroou0aetniociltls em(vs u0 ltnxo ta1lpt  i s;s0s2umxr3ou1lmt  icsas) rraur ;o4tpxoifetls s2ul(mp u) eeomf3io1laDraues;s setm(r3iy1amenlnci (f rtm(ront0teen ocildfm2el( sn(0trxnxo3iatoaDrauvo;( setmim nudllt  iviatf Durx ono1opxnmf3iatfa ulnms u) rxnmr3oo1optrluei;t trtoxr3no4lpen feilt arua(root1tpt mf3iydfs umuvpnu4 eerxoctadlmDrlnes t)trur(mpiy4om elnvtatfs2rm(mp;u0ale  iciasfa ranmpnu)artoxociotla r nes;( t2tm(mpoudapen fviasf 2trx oot4aet miciytfs2ulu s t4trtnxrctydfp ran olt0sexo(m iy4al n fctl(fsDrrx  ot4apt mfeiatlm2rmnvp;t4tlerif tadfatr i i t sexmim nydll nlieils sDuax ont4tle mfetldlm2rl(vo t)tlxnmo3tytlmte nvsl(0srtoiopou4apenlnct s) rtr( ont1apxoio3iytfa2em( o t4 etomo3iy1op eaueolt0 exoxm oydolt mnvta( artax  nt4apen oeiltls2rm(mon() etnxrciatop eaiei;( trxrirpiy1ope lfvsa(fa2tmxrono0tltoiieiasls ea(mo ()aetnmoctydfp ean o;t)t2tmxm nudal   feils) Durumpnt1ole mociydla ran p t0aexoxo3oadfpD  n i s0sruoio3oydomee ics ( a2rr(m oo4tle mf3tltlm2em(vo t0texrmf tadoaDrlu i;s0srxmxrpnydap   fetat a2ra(r no4aptnmictys a emu s u0tetnifciatomDelivi s) rtoxr oudlpe lfcsltfarta(r ;u0olenif3iytfm ul(msn()treomrcia1lm e u i (0sexrxo3oy4alenlnvsl(fs2um(  ;o4tpxoiocilsls eanvo;(4alerxo iadlmteaueo;t tetm(m no1omen ncsl(f rumurp;o1aetoiiciysla eanmonu4arxrxf3iodlaDeai s s0t2xr(o iu1lp nliciltf rrm(rp;u1aee if3tltla um(msn(0aexnmf iydoatr neolt)s2xmxr3nudameelfeslt s2umu p;o4opx  f3tadfa2ulump;(4texnio iy1fp eauvi;t)seum(o no1lmtemnviasfs2raxm nu4oetn ietytfs2rm(vonu)tlxrif3ia1fpD auvo;t0s2to(m oudop  lfetls) rrru p;t0aee  fctldfa2ul( on(4 eerif3tatoptelnei t0sexoimpnodapenlivtatf 2raxrpoo1tptomociyd m2rlu p;t0artoio3ootlaD  ivo ()trumxr3oy1lp eliet t arum(rp;o0tltn ictadla rl(vpnt4altoxo3oodomtrau i t  etmir3oo4optnlncs t) Dtrump;t4teenmictasfaDemu p (4arenif ia1opD an i;t truoir3io1lme lfes () 2rm(rpou1aleomfcilt aDea(vsn(0 eeoiocta1optrai i;t) rtm(opnu4om   fesls)a2rmxrpou0tleoiocildlaDumn s;u4arxnio3tatoa raivs;t0sexrio iudal  livta()arraumont1ope mfeildla2ul(mp u0trxnxrctotlaDeaieols  2xo(o3no1opt lieia(fsrrrurono4tptnmoetytlm2rmnmsnt4altrxociadfm e ivol()tetoir3nydoptn fviasfsDra(mpot1alxnmietyt sDrlnvsnu0 leoxo tytoa eau sls)t2tmxo3ny4lm n ictl() Drmu poo0tlt if3iyd aDuanmpn(4trxoir oo1la r uvols)srtmxrpnu1lmtnlnes sfsDraxront1tpxo f3ildfs em( s;u4 etrmr3todfat  nvi;t0srurirpiy4lpteliesat srrmumo;t0aptn ieiltla2eaumo;(4aeenxfcoatfpDe u o t0tetrir oo1lp nmfci (  Dur(r ot1tpeo octld m uau snt4artrmr3io1fp rau s t  2tmxr nodole mfvtl( sDtrurpno0apen oetasfmDrluvpnu0 exrio oodoatran i s0seumxo3nu4ameelncsas a2tmu p;o1opxo oetadfsDuluvs;u0aexrxr tadopt  ivil(0 euriopiy1amtn fvtl()s2ta(rp;u0opeomoctltfa ranvp;(0 lenxr3todlp r ivo;t trtoxo iodoltnlicsat) rtrurp;o0optoio3tydls2ua(mo;t) exomocootlaDraneo ()texoir io1ol  miesat  2um(root4tptnmfcilslm emnmo;u4tltomr ty1fp e ies s  2trxo iy1optnmict t)a2tmx p;u4alx  icilt m2ra( o;t0 eerirctodfmD  ivi;t)s2tm(mpiu1lpenmivtas)a2trur ;t1optnmfctld s2ra(vp ()teerir tydlm ran ilt  2xmir3iydlp  livi t s2urum ;u0tpx ifeiadls2ea(msn(0tlxrircoydfm e uei;(0texriopou4lm  liesltfsDtmurpno0alxomoctadfmDuan o () rtrifctotomtr uvs s0teumxm iy1amenlfvi tfarrmu p;t0apto iciatls rlnmp (4alxnmr ootoa ran s;() euoio3iodoptemfcsas) 2ua(mp;o4tpxn icilt a el(mp;t0aetoxo3todfptelivils  rtm(rpnu4ale mnvia() 2tru ooo0aet  oeiysfa rl(vont4aeeomociy1fm eln ols)s2to(m3oy4ope mfctltfa2urumo;o4oetoifeils aDumu o;t4aleriocoytlmD aivo t) 2urxrpnodalt liet ()srururonu0aleomo3tatfm rlu p;(4 ltnifciadoatrln o (0 rtrxopiu1oltnlfes tfaDtmu ono4aptnioctlsfmDrmumsnt4 rtnio3oo1oaDrlnvi t0 rtr(m3iy4olt mivsl()sDur(mo;u1oet  feiysla2rlumo u0arxoio tydoatrau o s t2xm(m iu4lle lfctas)a2taxm ;o1optnmi3tydfsDrlnmo (4teeriocoy1fpD anesls trumimpou4amt  nctas  2umump;t1oexo oeiat m2rm(von(4tlxnxocoatlp r ivs;t) exriopoudapte fet sfsDta(mo;u1oeen feiatfmDuau pn(4 eeoxf oodfaDraivs t)setmxr iy1lmee nes s)arrm( poo4olx  ieiadla ran o t4 ltnmr3oadfaDran o;t) ruo(m nu4am n ici t aDtmurono1teenmieilsls2el(vsn(0tlenxf iy1late nei ( s2trxr3oudlmtelnvt ()arta(m ou4aex  octld sDelu o;u)tetnmo3todoa rlivslt trxmxrpoy1optemivslt)srrrumpnu0teeomo3tas mDel(monu4aexrif iadfptraieo t  2triopnu1omt lnei tfsDrmur ou1aexoifciadfs emnvsnu0texnmrctytoaDe n i t s2xoxopou1op emicsl(farra( o;t1aetnif3tadfaDulump ()tetnmoctydlpteauvolt)s2tr(opou4ll  lfctls srrmurpot4aexo fctytfm2emn p u4arxnxo3tydlaDe uei ()sruoxr3iy1lpenmfcslsfsDrrxm no4tpt io3iatfsDeaump u0 exnmfcootlpD  ueilt  rtm(o iu4lptelnes tfs2rr( p;o1alxomo3iadla2um(vp;t0tltrmf3ty1optrlieols sruriopoodoltnmfvt s  rtau  ;t0oexn i3tadlaDrm( o (4 exnxf3iotfmt anvi ()trtr(r iy1lp n ivsltfa2taump;o4alxomociasla rmn sn() ltrmf oadfp rlnvslt0s2uo(o3no1optn ncil() Duaurpnu4tltnmictydlm2um(vont)artoio3ta1omDr nvs;s0sexm(m3nudolt liciat a2uax pnt4alx ii3iatfm rmnvsnu)teeoifcoa1omt luvslt) 2uoxrpiudale  fvilsfarrr(  ;t4tpto iciltlsDrmnvo t4 eermo ootfaDeluvs (  rtrxo nudolenmfeia( a2ur(m ot1texo ieiysfmDem(vs;t0aexrxr iy1faDeaues t s2uoxo iydaleelictasf rrmxro;t4tlenifciasfa2uauvo t) leoio3tytfmDe ivsls s2tm(r iu4altemfeilt  Dururp;o1opx iictatlm2ul(mp t)aetnmfctadfa elu o ( s2xrxo3oy1am emfetat)aDtmx pou4opeo f3tltlaDea(mp;u4tlxoifciatlatelueo;(0s2xrim ny4omt  fci sfa2rm( oot4opeoii3tltfs ra( o;t0artnmf3iadomDe i o s  exo(mpnu1aptnmieilt sDrmxr oo0opeomfeilt m2eauvo ()texnif iodomDrauvi s0s2uoio nodll e nctl(fa2taump;t1aet ii3iysla emn pnu4 eenmf3oatfpDrlueolt)s2xr(mpou4amtn fei ()sDrmur ;u4aetnmi3iys sDumumo;u4arxoxoctotop   nvol()t2tm(m3nydlmtemfvt (f rta(  ;t4apt  oetydla2emnms;t0tltoir3tatfmtelu ols t2uoxm3io1ap  lfvia()s2rmxm ;t0aptniieiysfa ranmp t0aetrxf3iotfa  lnes;()trxr(o oodol  mnvi sfs2rmurpnt0ole  ietlslm rl( pnt) lxoif oy1lmt  nvi;t) 2xmio3oy4open icils)aDtau p;u4tet  oeiydlm emumpnu) etrxr oy1faDr ivols)s2umio3ny4lpenmies s)a2umumpnu4aet ioctytfs2ulnvonu4 lenxf iatfa eluvslt0 exo(o oy1opt lfvsas) 2rrxront0tlt iieils s2ulnvsn(4 lxoio3iodlm r n s;s0trurim iodam e fcsl(  Duaur ;t1oeenioeiadfaDraumsn()texrmfciodfm e nvslt)texo(o3iu1am nlnvsat arra( p;t0tpenmfetltfmDum(vs u)texoxf iy1fp ran ols  exm(o3iodol  lncil(faDraxmo;o1oeeo o3iatfa2ra( s (4artoxr oytoaDe ivo t0trtrxopnudlptemfesasfa2rr(mpnt4oetn fciydfs ranmo (4trxrir iodomD luesl(0 2xm(o3oy1lm emici sfs2trur oo0aetoiieild a2em( snt) rtnxo3iadlm r ueo;( srxm(rpnu4lm nmneils  Drrxrpoo0tetomfetlsfm2rluvp ()artnxf oytla rli s;s t2tr(rpio4optnmivtasfaDtmx ono0oeenif3iyd mDrl( o;(4aleoxr3io1omDrau sls0s2xoiopnu1lmt  iesl()a2ururpoo4tpx mfetas s emu s;t4 rxnmo3oatomtrli o s0tetoxr3iodlpt  ictat)s2tm( o;t0ole ifetadla2rau p;u0tltoxfcoy1oaDr ieil(0s2xoxm3ou1ame lfesasfs2rm(rp;o4oexoio3tatls2ulnvp;t0trenir ia1opDraivils0teurxmpnu1om e ncta( a2rau  no0tet mieiadfs ea( s;t0alxoircoytla r ues (  exo(mpio1lpe  nci (f Drau  ou0altn fetltfm umnmp;(4trtoxr tatfp  livols)sexoir io4omt liei t s2raump;o4ole io3ildfmDem(vo t0 etomfcty1om r ues s0 2xrxo oo1lmt mivias) rtr(m ;o0ale mo3tldlm em(ms t)tltoioctydlmte ueolt0t2to(m iy1am   ict ( sDtr(rp;u4aee io3iyd aDemnms t) rtnir3todoate ivslt0 exrir nydoltelnes (  Dtrx onu4tlenmocilsfa2emnvon(0arenmr3oytlatelies t0seurxo iodaptn nesa( s2tr(mo;u4tle  ictadlm uau s;(4 eeoiociodfatr ieo;t0 eum(rpoo1apeemfvtls) rrmumonu4aeeomictad sDul(mo;u)altomr3tytop  ln s;s  rurir iu1am nmiciat)sDra( o;o4aetn fciad s ran o;(4trtnmf3todfpDraivils s2xmiopnydomte ivtat srtrxrpoo4opt  i3ilsfa rauvp;t4alermfciadomteaues t0srxoxo3oydop e fetl() 2rm(mo;t1aetoif3ildfs ulnvs;()trenmf ootfptelnes t  2um(m3nu4lpt mnci ( s2rru ont0apt miciyslmDrm(vp;t0texoxf3tadfp e u s;s0 2uoir oy4lptnmncs ()sDur(mo;u4tlxnifctldlm2emnmpnu)tlxrmr3oydlmDr ies;s0t2xo(r3io4lpt  fes () 2um(rpoo0aetniieiyt sDrm(vsnt0arxrmo iy1fptrln i s  etm(m3ny1amt  ivia(  rraxm ot1teeo ociyt sDelnvs;() etrmf iodlm  aivs;t sruriopnudlmt  nci t arurx pou0oltomfeiadfaDrmnmo;u) leoxr3totlmD  nvs;()tetmxmpoudomeemies s s2taxrpoo4aexoii3iytfa rl( o u)tlxoif iadlpt  i sls)s2xmxm3nydameelfet tfsrrrurpou1aptoiieiat a2ua(vo;u4 etrxrcoo1fa e iei;t) ruo(m3no4olt mnvt sf rurx o;o0ape iiciasfm2eauvp ()texnir oo1fp rluei;() 2xrxr nydam n fvta(f 2um(  oo0tetoioeiysfm rl( onu0 lenir3ootfat auvs s)sexo(o3nydalenlfvsltfsrum(  ou0aet mo3tydlm um(msnu4artnir ta1omt au s;t  2xr(mpiydalenmict (f rrmx  oo1aee mictld sDelnms;t4 etoxf iy1fmteauei (0s2xr(opnodom   fvilt) rrr(r ;u1aleomf3ilslaDrmn s;u)aleomo iydfpDr ues;s) rto(m oy1opee fctls) 2raxrpoo1ope  ietls m rmuvp (0 lenmf iadfp  lnvs s)t2xrxo oy4lm elnctl() Dua(monu4alt  oeiatfa2uanvsnu)aeenio ta1omDeaiei t0seurxm3io4olt lfeilt artr(r ot0aex mf3iatfa ulump;()teenir iatlmD anesl() 2uoxr oy1alte nesat)aruaxm ot1tle ii3ildfm2uluvs;t0artnxf3io1omDeanei;() 2uoxrpoy1ole mivtlt) Dumxmpnt0tltnmoetyd a ulnmonu)artomf iytfpDrlnesls)teur(r3io1al e fctat a2trurp;u0opxoifeiysfsDelnmsnu)aeenxr3ia1lmDe uvi s trxoir3oudlmtnmies t aDraxrono0oexo fcias sDuauvp t)trtoxo3ootfa rau s s0tetoxm3iodamenlfciasf Dta(mp;o1aee mf3ilsfm2el(mp u) renmr3tytfp raieo s  2tmxo iodoltnlncil(fa2ta(mpno4tlx iiciys aDrm(vo;(0trtomr oatoat  uvs;t0 rxrio iydal  lnct t)sDuaum oo1aptn iciadlmDrl(vsn()texnmr tytfat  ivilt)trum(o oudlpe  nes t s2rauront4apx  oeiyd aDrm(vo (4arxoircia1fmtr ivsl(0 2xrxm oy1ome  nvi s sDumurono4aeeo fcild aDuluvpnt4alxoifciadop r ieils0 rum(o3nu1omee fct ()a2raxrp;t4tpxn f3iat s2eau pnt0aeerifcoy1opD anei t  2xo(m oo4openmnes sfa2rrxr ou4aeenmf3iatlm2ea(vs u)aexoxo3oydfp rli il(0 ruoim oydom  mfci (fs2raumo;u1texo i3iydfa2ea(mo t4 lenmf oytla e u ils srumir no1optelivsl(fs2umxrp;u0aptnmieild s umnvs;(0arxrir3ootomDr ivo;s trxoxo oodalenmnes s a2trxmp;u0optomieiytfa2ra(vp;t)tltnir oodomD  n o t s2xr(m nu1al  lfeta()aruaxm nt0teeniictlt s eauvo;u)alxrxfcia1fp  auvslt srumxo3no1lme  fcil() rrrxr nt1alx  oetld sDel( s t0aeermociadfa e n o;t0trurio nydol emfvi tfaruaurpnu1aetn fctls sDrm(mo;(4 rerircoadomt  iei;()srxmxo no1aptnlivs t s2rr(mo;o4aet  ieiyd a2ea(vsnt) rerxr ta1om r uesl()s2toio io1llenmfvs s  ruaxr nt1tetoifcilsfa2ulu sn(0trtoxfciy1omDelivo;t)trxrim3nu1ol nmnei s a2raxmooo1tpxo oetysfmDeln s;t) eeomf to1fm eanvo;(0 rumim nydope lnvsas)srraxm nt4tpxoiieiydfmDranvs ()aetnmrcia1fpD lnvslt)sexm(rpnu4om  lfvil(f Dtaxm oo4oetomfetydfs rmu o u4aexrmf3todla r neolt0s2toim no4omtelfctls)srrm(mo;o4aptomf3ilslmDra(vpnu4 lermfciytfatelneolt0 rtr(m3ny4amtelfct t)sDta( ono1oex mo3tat m umumsnu) lxnmo todfmDr ueol(0 etoxm3oydom  mfctl()a2tau o;o4openiictlsfs2ulnmp u0 exnmfctotlaD  i s;(  eur(opnodal elfcslt  rtrxrpou1aee mi3ils s umuvo t4 reoxr3iy1fp rai s;t t2xriopou1alenmfcsa(fsrum(root1teeoio3iytfsDuauvs;u0aexriocootfpDelu o;() exrir3oy4lme  ivtat)srra(mono1texoif3iad aDeau o (0tltnir3oo1fpDeaneo;t)s2xoir3iydoleemnvil(fsrrau oou4aleo ociydlmDua(vo;u4 rtnifcia1omteln o;()t2tmxm ou1omtnlfeia()arurur ;u4tpto feiasfaDrluvp t) leomoctadoaD aneolt0 rur(rpiu4ll  lfct t)aDumxr ot0oexoifctltlmDean p;()aexomo3iodfmD aivs ()setriopiudll emfvils) Dtrxm ;t0tle mieilt a elnvs;t)alxrmo to1lpDe u i ( s2xmim iudapt  ics (fsDraum ot0tpenmf3iytlsDuluvs (4tltnxf3todfptrlu ilt) 2umxmpoudoltelivsatf Drrxro;t1alxn ietyslsDrl(vo;t) rtoxo oydoatrlivs t t2tmxopnu4lptnmneia()s2rax pot0oexoiiciasla um(mp u0aetnmfctydfp rlu o;s) 2trxmpnu4ll  mnct sf Dtru  ou4oleomocilsla2elumsnu0 leoxf3oodlmD auvsls)teto(r3iodlptnmncslt s2tru ono1tpxo ieilsfs2ea( ont4 exniociydoat an il(0 2xmxopiydop  lies ( a2ta( oot0tpxnmictatls uluvon(0alerxr3to1omte i o ()trtr(o oy4lleemicias  Drrx pou4tee iociadls2ran s;(0arenmf3iytla   nvs;s0 2xrxo iodlpt  nvs s  2um(r ;u0alenmo3iydfaDemums;t4aetnir3tydfatrluvs;s trtmim3iy4optnlivi t)srrm( pnt1opx mieiaslm2eln s t)tlerio iatop ranes ( s2tm(o3ou1ape mfvt s) rra(root1tlxniiciad sDul( s (0tltoir3todopDranvils  2xo(m nu4lme mictas) 2tmx p;u1apenio3iasfs2elnmsn(4 ltrioctytfa  lues s0s2uo(rpiydame  fciasfaDumxmp;t1apxo fetytfs2ul(vsnt4tltrmoctydfmtr ivo s  2uo(opou4omtemfvsas) Dumxmoot1oetn ociltfsDemuvs;(0trxrxocootfp elnvo;t) exrir ny4lme mictat  rtmuro;u0opt  ictydfaDrl( o u) exrmr3ty1om rli sls0 ruoxo nydlmt  ncia(farrmx  nt4tpeo oeiltfm ulumon(0 etnifciytlaDrlueo s)t2tmxm iu4lp nlfes ( a2um(rp;o0optoifetysls emumo u)aetnxr oatomDrln ol(  eur(m3iy4oltnlnvt ( sDtrum oo4olxomf3tad a rl( pnt4tltnxf3iydlm eln il( teumxo3oudapenmfei () rta( o;o1opxomieilt mDuaumon(0aexrxf3ty1fa elueil(  2xo(rpny1alen ietls a2rrurp;o4tpt  f3tyt sDeanvsn()aeenxf iotla rai il(0 2ur(m ny1ll n ietltfsrumu  nu0opx  ieiad s emnvs;t0tlermfcoy1oatrai sl(0tetoiopnydoltemicslt)srtr(r oo0tleomieiad aDem(vs;u)teeoxrcoa1omt  iei;()teumxo3nydolt  fvi s)aDrr( p;t0texo ieildfsDelnvs;t0aetoxo oo1oaD auvsls)sexr(opiy4lme lfctas)s2rm( o;u4open iciltlm2elump t) lxoxr3iotlm raieo;(0 rum(opiu1omtnlnci ( sDumu  ot0oeeoifciytla el( s;t0tetomrctydfmtrlnes t t2toiopoo4lmtelfctas)arumum ot1teen fcilt s2elnvsnt)artoxo3tytfmtelnvo t srtm(rpio4ap e nesls  2tax  nt4teenmf3iyt mDuaumon(4texrio3totfateluvs;()seum(r3oo4ole  nesltfs2tm(mp;u1aetomoctysla ua( snt0 lxomf3ty1la r ies;() rxo(m ny4aptnlnvs s)srrr(mpnu4tlxoiociydlaDelu p t0arxoif iotlat luvi s)sruoim oudlme lnvtl()aDta(ro;u0tpx mociytfaDrau o (4tlenxocta1oatr u ols  etoxo oudap e fvil(f Draur ot1olxnmfeiltlmDuan o;t4 etoxr3oydfpDelnvs;s seto(r3oy1apee ncsasfsDraxrooo1olx moetlsfa uluvpnt)alenmocto1opD  uvo t t2trxr3iu4lp emfciat a2uaxroot1tpxnmoeias aDrlu p t0tltnmr tytoa rauvi;( srxm(r nodolt lfetls arrau  ot4opxo f3tas aDelnvsn()aleomr3iy1oa rlieslt)t2ur(r3ny4al n fctat)aDtrxmpno0aex mieiltlm2emuvpnt4tetrif3oodlm e u i;() euoio3ou4ll emieia( sDrmumpot1tpeoifciltfsDulu s;u0 leoxo oatlp rli i;s0 etr(mpoo4llenlnct tfsDraum no4oet  oeilsfsDrlumsnt4aetoxo3tatlaDe uvs;() rum(o nudlle lietls sDtrxrp;t0apxomiciad s2rmnvo u)tleoifcto1fmtrau s;t)trxrim3iu4al n ivi sfartmx pnt1oet mfcildls emums t4tltnxo3oy1oaDeaneslt0teur(mpiy4optn ncs t artmxr nt0oetnmfcildlaDumu on(0 rtoio3tadfmtr neo;s  etmirpoodllenlictls  2tmxmono4olx  i3iytlmDeauvs;(4texriocoadlmte ies (0 eum(r iudopeelnet s) 2tmump;t4apeo ieiltla el(mp;t4 lxrmrcio1op rlu slt tetoio3no4al nmicsa( a2tmxmo;u0oee  i3iasla ranmo;(0trenio3oytlptelu i ( srtmimpny1alee nci t) rua( oot4tptn o3iytla2umnmont)tltoif3ootoate i sl(0s2umir3nu1opt  ivtl(f Drmu p;o0texomictldfa rmnmp;()altrir3tatoaDr uvsl(0 2uoxo ny1lmeemicsatfs2taurono0olxoifetat a2ran p;t)artriociotfmD lies t0texrio3oy1amt mfeia(f rtmxm ;o0apxomieild a2uanms t) rtrxo tatfatrlu ols) rtrio ou1lp  lfcilsf Dur(moou0opx iiciat aDel( s;t)altnxoctadomDe nvilt seumir oy1ap   netl(f rua(r nu4oeenmieiadfm rl( on() leoir totlp  luvo ( texr(r iy1amt lnvsa(f 2rrxmpno1ope  o3iadlmDel(mp u) eerxr tydomDe iei;s0 rur(r3no4lltnliei t  Dtmu  ;t1oex ifciysls rluvsnt)teenxrcta1oat luvs s0sexo(m iudolte iviasfaDurumonu1olt mo3iatfs2ul(vp;t4 etoxfcio1omD  i olt t2trxr oo4al nmnei t srrmxmooo0oexn iciysfm rlumonu0artoircoytlp e n i t0teuoim3iu4alt  fei ()s2tmxmooo0aexomieiydfa rmu p u0trxnmo oo1fm eli ols srtrxo3no1oltn nciat a2umxrp;u1tlx ifctaslm2eau pnu4tltnmo todlaDrln sl(0 ruoim3io4lp   ivtas  rtmu p;t4tptnifeiltfsDran s u)tleomr3todfm   i i;( setrxo3nu1ap nlnvtlt)s2ua(mpot1aexoiictadla em( p;u) rxoif3iotlat anvs;s0srtmxrpoodlp  lneilsfsrrmxrpou4alxnmoctat m umnmp (0trxnir3iatoaD an i t0texm(mpoy4ame  netl(fs2um(m ou0tetomfeiydfaDemumsnt)trtrxo3oadfmtraivs;( t2to(r io4lm  miet (fsDumurpnu4aexnioctlt a uauvp (4 renxr3ia1lm   ivo s0trurxopoydoltnlncil(f Dur( onu4oexnif3ild m uaump;u4alenif3iadomDeanvo;t0s2xoxr io4ll nlnci t)srua(mpoo4opxoio3tyd m ranms;t)tltrmr tatomDe uvol()srurxm3oo4opt  ivia(f 2rrxmp;t4olt  icilslmDrl(mp;u4trtoif3oodlpte nvo s)trxr(o oo1ameelfctl() rtr(  ou4tet ioctas aDrmn p u4 lenifciydopt aies;t  etrxm oy4ole  ietls s2tauroot1tlt  fetatla2rln o;u4 exnmf tytla e i s;(  2urio iodopte nviat srtru  nu0tpeoiieiyd sDuanmp;(0artrxfciadfaD luvols  etoim3ou4lpt  nct tfsrrmu pnt1texnmo3tydfs2em(vont4artrif3ia1fmDrlivi s0 exmir iu1lp   fvtat)srrrx oou4alenifetatfsDeln p;u)arenmr3tytfptran s;s) exrir3oydlpenlies t) rurumont4ope if3tlslaDel(monu0tetnxocoatlm  auvsl()t2ur(r iodape lfctltf rurx o;t4tetomi3iydlm2rmnvonu)trenmr3oa1lptrluvsls seum(o iy4opt lnvta()sDrmurp;u1altomietaslm2rau p;t4aexnio3totfp eau ils0t2tm(mpiodale lnct s  rum(rpnu0olt mfctad aDrmnmp ()aexnif oodomt  ivsl(0 2uoxr3oydlpenmfctas)sDtau o;t0teenioeiad s2rm( snu0tlenmr iotfmDranei;t0 2trxo3iu4lpeemicsls) rumumont1oetn o3ilsfmDuau o ()trermr3ta1fat  ivo;s tetoirpnydoleemnvta( sDum(  ot4aeeomociytfm ua( s;u)teenmf io1lp rlieslt srto(o3ny4omt mfcil()sDtr( oou1oltnmictytlmDuanvs t) rtnmf iotlate u o () 2xoxo nudoleelict s)sDrmurp;u4tpxnmi3ilsfm2em(vsnt0 lerxfctydoa   ueols0 rxoir oy1ap   nesa(fsDraxm oo1aetoiiciydfa ulu s t)texnxfctodopt ln slt trum(rpiu4altn fet t)a2urxmo;t1oexniocildlm2ran s;u)tetoxrcoodlmDrlnes;()s2xm(mpnu4lp  mivtat) Drrxm nt4apeomfeiltlaDrlnms;(4 rxrir3oa1fp rauvo t0trur(o3ny4om emnetlsfarrmum ;t1apxoio3tysfm em(vs;u0 etnir to1laDe ieo;t0trxoxopio1am e neil(f rua(ro;o4tpeoioctldfm uauvo () exnxo3tatoatr ivo t)s2xrxm3nydlltnmieiltf rtr( pot4apenmoetatfm rmumsn()tetoiocoytfmD  uvs;s0 rto(rpnu1ap  mfei (fa2rau poo0texn i3iltls ul(ms;t4 ltomrcoatfp  lu i ()teur(rpny1am nmnvils)aDtau pot4tee mi3tydfa ea(vsnu)altnmo iotomDeaivol(0t2toxm io1lm e ivs s)a2tr(mp;t0alx  ocilsfa2rm(vs;u4trxrio iytfmDe u il(  rxrxmpiydameemicsa(  2umx  nt4olx ii3tas m2emu pnt)arerxo iadlatrlies () rto(mpnudlmtnlnvta(fa2ra( p;t0tleo ictatlm2elu o t)aeerxf iydoaDe ivi;s0 2uoim3oo1amt lnesatfarraxr nt4tptnifetadlaDeaumsnt) rxrif ootopteai ils0sexoiopny4lleelfcs (f 2umxr ;t4tle ii3tyslm elu on(0artrmrctadom rlivo;s0t2ur(o oydlp nlfvslsfs2rrurpnt4ole ifctydfa emn onu4texrxf iytlm eai s;s)teur(m3oudlmenmfcs s) 2rmuronu0aex  ocias a ranmp;(4trerif tadlpt  nei (  rurir3oudop   ici () rtr(mo;t4ole mfeiydfsDrlnmo t)tetomf3iadla  li s (0texrio nydaleemnvt (f 2tmxrooo4opxnii3iadlmDraumo u0tltnmfciadfm eanvi;(0s2urxr io1lm nlfvs t  2um( ont4tltnif3iltfa ea( onu) lermo iy1lpDrli i;(0t2ur(r3oy1lm elies t)aDra( pot0olt  ieiltls2em(mp t) leoxf3iydfm r i il(0srtm(m3ny4aleemfcs s s2urxr ot0alen ocias s2ulu o;(4 etoxr tydlaD  i sl()s2tm(m nudlmtemfcta()aDuau p;o0aetnmf3tadla eau onu4texnir tytfa eanvsls s2toxm oudale mfesa( arurur no1altomoetldla eln pnu4trxrxr ty1fp elnvi t)t2uo(o nu1ll  mfcias a2taxm oo4tptn ociys mDra(ms;u0aetomrcia1fpDr n olt  etmio3oy1llt lneiat)s2umxr nu0optn o3tad mDumuvpn()tetnmf3ty1omDrliei s  2tmxm3iodlle lies sf rrrumpnt4oetnmfciyt a uanms;u)trenio iydoa rlnes;t seum(r iy4olenmnvs (  rtaum ;t0aex mociasfsDemuvonu0tltnmociy1fmtranvi;( srxr(m oo4lltn fvt sf Dumu o;u4teen i3iadls rlnmont)aeermr3oo1fpteluesls0texrir3io4amen nes (farra(mooo4oetn fcilsfaDrmumsn() leoio3oadfpDeluei ()seurxr io1am e ivi t artrx  ;t1teen oeiat s uaumon(0trxnio3oa1omtrluesls0trtoxopoo4oltnliet s s2rrump;o4apx mfetls sDem( o t) exrmr3iytlpt anvils0teurxo oy4oltelnciat sDtrum no1olenifetlsls uanmp t) ltoxr tadom r n i (  ruo(r3iodam nlicsls artm( pnu0teeniiciasls2ua(mon()tltrmr tatoaDrlues;s teuo(mpiodlp   ict s  2tm( pnu4alenii3iyd s rlnmon()alxoxf ia1fmD au i s)s2urir iu4op  mnetl( srtaxmonu4opxniociyd mDra( ont4tleomr ta1oatr ivo ()s2uo(o3oodoltnmncsls)a2trump;u1oex moetadls2umuvo t)trxoifcto1op 
\ No newline at end of file
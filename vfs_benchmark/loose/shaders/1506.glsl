@@ -0,0 +1 @@
+ueils0t2uoxm3iodalenlictlsf Dururooo1opt  ieiat aDuau s u0arermo iadlpteau s t  2xmim3nu1ol n fct sfsrraumono0oet ioeiydfm2uauvpnt) etnmoctatlpDrlnvs;() exr(r3iodom  lfeias) Durx p;u0aee  o3tltfmDeaumo;u)texoir3totfmDrau i;t  eurir oodape mictltfsDum(rpnt0olenmo3tat m2ul( sn()arxrifcoatoaDr u ol(0srxo(r3iydlme mnct ()srtmu pot1ole  i3tlt mDrl(mo t0 exnxfcoydfa r uei ()seuoxo3iy1ap  mieias)sDrmxmpot4tpxnii3iyt mDrl( pn(4 rxomrcoa1oatr n s t sruoxm iudomeelivslt  rum(m nu0texoio3tat s rmnmo () rtnmfcty1omtelues;( s2umio oy1ole mieilt a2urx  ;t4aee mo3iatfm2rauvont) ltrxo ootfpDrlueolt trxmxr oo1alt micsat)a2rrumpnu4apt  oeiltlsDemn pnt0tetrmo tydfptelneo (  rtmimpoy1lmt lfvia()aruaxronu4apxo fciasfs2emnvonu) lxrif3oy1opDeln o (0s2xrxo no1al emivsa(f 2tmu p;t0tlx  fetydfs elnvo t0altrxr3tadfa ean o;s)t2umxopnu1llenmnesat) Dumxr nt0olxomfetyd aDran o;(0 rtrxo iy1lmD au sls0seurxr3nu1ole lietas)srrmu o;u4oee mi3tadfm um( pnt4 ltnxf oy1oaDeluvs;s) 2umxr3iy4alt lictls sDtm(monu4aetomoeiys s ulu s (4texomfcoa1laD liei;t)texr(r oudll emfei s  Duau o;t1olenmietyt s rl(vo;t4arenirciy1opt  n s;t  2trir ny4open fesl( artmxrpnt4oex ioeilt aDrmn o;u) ltnio3oy1oaDrlu olt  eur(opnydamenmfcsatfsrrru pot0ope iictytfm2rlump t4aetrmf iodfa e ivs;t trxmio3no1omte fcsat) Durxm ;t1tptomieilslsDrl(vs;t4treoio oydfateau i s  exrxr ou4lmt  ies s srurur no0teeomo3ias mDeluvpnt0artomrcty1oaD luvslt)srtrir3nu1lm nmfcs (fsDtau pou0tle mfctydfa2rlump u0tlxomociytopD  nes;t0tetr(mpnu4olt lnetltf 2ururp;o0olenii3iydfm2eanvs;()aleoxrcoa1lmt  uesl(0seuoxopoo1alee nci ()a2rrumooo0tlx if3tytls2eanvo t) rxrio oydfpDranesls trxmim3oo4ope  feilt srrax  ot1alenif3tltfs emu o u)artoxr tatoaD  u o;(0 etoimpiydolenmnesltf rtrurpou1tetnmietytfs2elnvsnt0 etoxo3todlateaivo;s0s2umxm nu1ape  fciat) 2taxm ou4alxnmietasfa rau s t0aeenxr3oodlm  livi;t sexo(o3oy1ll nlfeta(  Dta(m ;t4opxomf3tasfa2rl(vo;t4trtnio3oa1fpt ai sls)srum(o iu4am nmfvs s) Dtm(m ou0olenmoeiydfs2rlumo t4tetnxo3iadfptrlu sls0 exmimpny1lmt lnet t)aDraumoou4ole mi3tld aDeluvs;u4aetnxf3iatfpDraivil( t2toio3ou1ol emfvsa()a2um(m nu1texoifetlt aDeanvsn(0arxnio3iatfptrli ilt srxoxm3oo4lme  feilt)sDumu ooo4olxn i3iadlm raums u4aetomf3oy1lmt lnes;( t2tmir iu1amt  ivi tf rur(m ot1alx iocias m ra( o;u) lxrxr iydfatraiei;(0setriopnodlmenmicsl(  rraumo;u4opt iociydfm rau p;u0teeoir iy1laDr n o;() 2trxrpno4lmtemfvta()aDta( oou4apx  feilt mDulu o t4 lenir3iotfmDrln ols)srtrir3ou1lp nlicsl()s2umu onu4teeoio3iat sDranms;t0tlerio3oa1om  an i (0trxoxrpnudamtelfvils)s2tru  ;u0olenifeiatls ea(vp;(0alenir3tytfatr uvi t0 exmxopio1ap nlncils  Duaxm ot4olxnioeiltfm rln p;t4tetrmrctatopD lnvi;t tetrim3iu4aptnmicsltfaDuru pou0tleo fcilsfs umu snu0aexoir3tydoatrluvs (0truoio iy4olee ics t a2tru  nt1apen oetaslaDul(mont4aetnir3todfaDrlueolt0sexo(mpiu4om elfvt ( a2uaur no4tltoiieiad s rl( snt)altoif ia1fm   ivi;(0s2urxo3ny4lm elfcias) rua( p;u1alt mf3iysfmDrln on(4texnir totla eanvo (  2xr(m no4lltnlnetat)arta(moou1aexoioetasfa2ea( p;u)tltoxr ia1latr nvsls) rum(r no4amtelnvslt) 2tru p;t1ole  f3tydfa em(vsn(0trenif ootoa r ueilt0s2um(rpnodom  lnviltfarrr(mo;t1tlenmfciyslsDrau o;(0tetnmf io1opD  u ils) rtm(m3oudllenlnes t sruaxro;t1oexomictydlm rmnvs;u4tleoir ootlm   neilt0trtrio3nu4om nlfetl() Duaxr ;o4aet  i3ilt aDeln snt4 ltrxf3tydlm eai olt s2tmxo nu4apt mfet s) 2rm(mpnu1ale mietatls2um(vo;u4trxrxf totopD ai s;(0 2xoxo3nodlltemnetl()srurxro;u4alt ifciydls2rl( pnu4tlxnxfctotfat lueo ( srur(opnu4lpenmnvsa()artmxrp;o0alt mieild a2rlump t0artoif3todfm   uvs;t srxrxm oodlmenlict ( a2rm(m ou0aeeomo3tys s2ulnvs (4tetomf oo1fptrau s s  2xm(m no1altn fvilsfsDumx  ou1ole if3iydlmDrluvo;(0 lenio3iy1faDe ivslt) 2xoirpnydlltnlfvsltfaDur(r ;o1tlxoiiciytlaDrluvo;(4aeenircto1fat lu i;s)s2um(m nu1omt lnvt sfarra(mpnt0alenmictyd mDumn s u4tetomf oytfa  anei;t  2uoio oo4lmenlfct s)s2uax pno4tlt iocilsfm2rauvo;(0 lenxr tatfpD anvsl(0trtr(o3iy4ap  liet sf 2ua( p;u1optnmfeilt a2em( p u0arenxrcta1laDrli o t trtoxopny1ap   netasfsrtrx o;o0aeto o3tydfs2emu s;t0areoxfcty1oaDrlneo t)sexm(r nudolenlfesa(  2uaxm oo4tet ifciatfa2ra( o u4tlenmfcoodfat  n o (0s2tmir oy4ol elfvi ( sDrrxrpou1tpenmfciydlaDea(mp (4tltnxr3tadopDrauvs;s) etr(r3ny4ap nmfvsls)srtau p;t4teeo oeiltla el(mo;u)trxoxo oydopt lnvi;s) 2tmxm oudale lfeilt srtrxmp;u0tltniieiasfsDumnvp;(4arxrmo3iydomD ln ols0trtoxr3oydlpt livtl(f Dtmurpoo0alx mi3iltlm2uln snu4 exomo iodomDrlivi;()s2xoir3ny4lme lfctas a2trxm ;t4tlx ifciaslsDrl( pnu)aetoio3tydopDraivs;s0 2urxm3no1oltelnvias s2raxmo;o0olto fciatlm2uau s;u)texoxr3tytfm  aieo (0 2ur(o3ou4omt  fei tf Draxmp;u0olt  iciatlsDel(vp t)tlxnxoctotlm  anvil()texmxr3oo4ole licsat)aDurx  ;u4aptnmfeiyd s2rm( pn(4 lxomr to1om r nvsl(  etm(rpnydamtnliesa( arrm(r nt0aex mo3iydlaDum( p u4 etoxr iy1om eauvi;t0s2umir oy1lle  nvi s a2rm(rono1aeeoiiciat s ulumo t)alxnmo totop   uvols  2umxr3nodam n ics ( aDta(ronu0aeto f3ilt s emnvs ()arxrmf oadlatrauvi;s0t2urio ny1ap  lfesa()sDua(  nt4optoifetlt s em( s;()tetoio oydfmtrlu i s)setmim nudomtnmietlt)s2ra(m ;o4altnif3iltfa ulu s u4trxoiociytlp  lnvo s0 exoim oo4amee fes s)srua(moot4apxo o3tytfa eanvp t4texrioctotfmtrlu ilt sexr(mpiu1lme livtlt srtmxr ;u0olt mi3iytlm2uauvs;t0arxnmfciy1lpDr nes s)s2xrxrpiudlpen nvias  Duaxro;t0opt  i3iys sDrlu p u)altoxocoy1faD ai i (  2tmiopoy1optn nct sfaruau  ;o0tee iocils s2rl(mon() etrxo3oy1lpDraieols0seuoio3nu1om elnctl(fsrta(rono0tpxomiciyt m2um(vo t)alxrmfcootomDrau sls0truo(m iodlmt liesat  2rm(mpou4tetnifetasfm2ra(vs t0texomoctodfptr i o t0trtmxopiu1op nlnci sfaDtrx ono1tpxnif3iltla ra(ms;(4 leoio3iodlp  ai s;t0 etoxmpiodomte nvta()a2trxmpno0aeeo f3tat s emn sn(4altnxr oo1oaDraieo;s tetoim3oodopeelicsatfarraxr ;t4aetnmiciltls rl( s (4aeenmr io1opt ln o s0 rurxm oy4amtnlneta(f rrrxmpoo1altniociyt s ra(ms t4aeenifciodfp r ieo t srtriopiu4llenmfet tf rua( pnu4ape iiciyt m2uanmp t0 ltrir tadoa   ivi;(0seumir ny1omeelnet (fa2urur ou4aexnioctlslaDul(vo;u4 eeoxocto1fpte uvi t t2um(r ou1amee fvta() Drau pou4oeeniieiadfs rmuvp;u)aexrmo oadfm  luvi;(0setoir iu1am elnvi t)srra(mpot0aptnii3ilt s2umuvo;t4trerxrcto1laDr nvol()texm(opoydalee ncil( sDumumpoo0teenmfetydfs ul(monu4teermo3iytomDelnes;t0s2tr(opoy1ol nmnvtl( sDum( p;o4altniiciatfa ra(mont0aeenir3oa1fp ran slt)t2to(m3iu4op n iesl(fsrrm( o;t4oee  oeiyt s rlnvonu) lxriocoa1oa rai s;s)sruriopoo4om   ivil()sDumum nt1tex  ociatls eanmp t0altoxo3oa1oa r ivsl(0srxo(r3iu4lle lncsl( sruaumooo1tet iictytfm2el( o;t)teerxrcootla eln s t) rxoir3no4lltemieiasfarrmxmpoo0olxniieiatla2umuvo;u4tlxnmr3ia1fp   i i;s  etriopnu4olenlncsat)aDur( poo1ope  fctldfaDulump t4artnmr3todfp rlu o t truoxrpnodaptn iei () Draur ;t0tlx ioeiysfs2eanmo;u0artrxr oytfate n i ( t2uoio3iydlpenmneiat srrauront4open f3tlsfmDua( sn()texnif3oodfaDr u ilt  ruo(o no1ol emictlsf 2rrx pot1tlxoii3tlslaDelnvpn(4artomf3oo1omDe nes s0s2urxr iodlmtnmneils  rra(rpnt0optomieiatla rl(vp;t)tltoxocoytlm  livs;s) 2toxopnodlmt  nes tfa2umum nu1opxo o3ildlm rl(ms t4 rerio3oy1fat auvi ( t2uoxrpnydap elies (f rtr(r no1tle iieiltla2uaums;(4 rerxocty1lmtr nvi (0tetmxm io4lmtn ivslsf 2raxmonu1alx iociys a ranvp;t4 rxnifctotomD auvs;() 2xm(mpnydoleemiet t a2rm( ono1texnifetysfm2uluvs;u4 exnxo oadlpD anvil( s2uoxopio4lp  lncsa(fs2rax ont1aptnifciltlm rln s ()tlerxoctytla r uvil(0sexoxm3ny1lp n fcsls)aDrmx oou4tpt  f3iyslm rmumon(4arxnxf3oa1opt  n o s s2trio nudomte nciltfa2ua(r nu0tlxniiciytfa2uanvo;u4trerio iy1fptelivi;t0sexoim ny1llt lnetas arrmxrpnu0oleomoetldlsDulnmsnu0 ltnmf3tydfaD au o ()trxrxrpiydal  lics (fartrxmpou1opxoif3iyslmDrlnvs;u)teenif3oydfaDe ivi;(0srto(mpio4lp e nctls sDrmxront1alenifeiytfmDuanmpn(0tlxrmo oytfmt lueo;t)srtmxr nu1apeelnvta(f rrru oou4aeto oeias s2emn o (0 rerif oatoaD lu ils)tetmir ou4lmt mieil( aDua(roou4apt mf3iytfm ea(vs t)tetoio3tytomtr uvil(0 2umxo3nudalenmnetl(fsrumu  ;u0tetnii3iltls2rau o;u4 lxoif iodfm rlnvs;t trxoir oo1olee ict (  2raxronu4apt if3tad sDea(vpnt0 exrifciodfpt lies;( trtoxopno4altelivtlt  2rmxmont0olxoif3ils a2el(vp;u4texoir oatfp  luei s  2tr(o3no1lp   ieias) Draumonu0apt ioeiadls em(vs;(0artrircoadfat ai ol(0srur(m iy4lm nmneils  2umur nu1apxomoctytlm umumsn(4texnxo3ia1la 
\ No newline at end of file
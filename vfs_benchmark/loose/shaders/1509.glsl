@@ -0,0 +1 @@
+uvo;s0 rxo(r iodaltn fvt (fa2rmumpot0teeniieiltfs2rluvp;t0 eerio iy1lmt  ieo;t) 2xoxrpny4om elivilsfsDtau  nt1aleniiciltfaDul(vp (0 leniocoadoa  auei;s  rurio3ny4ap elictl()srrmxmo;o1open f3iadlsDulnms;u)trenmf3tatla rlu i t0s2tr(m3io1opt lfciatfs2rrurpno0altn f3tyslsDemuvpn(0altnir3oy1lp elues s trumxmpno1optemnctls)a2umum ot0tltomfeiatla2emnvo t)tlxoio3tytlp elnesl(0texr(mpou4alenlnesltfsrra( ooo4oexo ieiyslm2ul(vs;(0 eerirctodlaD aieo;s) ruo(m3io1lp  mfvs sfaDua(m ;o4oetn fciyt m2ran s () lerif3iodopDraiei;t)t2umir3ny4amtn iviatfaDua( poo1opxnmo3tydfa2umn sn() lxnxrctodomD lu s;s  rxrio nodop elivsl() Dum(mooo4oetoioctatls eln o;(0 lerif3iotlmD lnvol() 2trxopno4ll  mfesas sDua(m oo0aee mf3tatfaDrmumsnt0arxrmf3iotlpDelnes;(0 2urir3oodllt lfes tfartmxmooo0apx iociadlmDemn onu0artoif3todfmD lneo s texmio iodlltelfvils) rraxmpou0tptnmieildfa eaump t4 etrxr3ootoptran i (  2xoiopiudlp  lfetas) rrmxm oo1tlxoioeias m emnvp t4arerir3to1oateai slt) rto(rpny1ol  lics ( artrx p;t1tee ifetad sDem(mpnu0 eeoir tadfpteaneols)s2urxrpou1olte nvtlsfartmxrpou1ole mfciasls umuvp;t4 ltoio iatoptraiei;t) 2uoxm oo4omt lies s)aDuaxmont1apx mfcildls rl( o;u0tltoio oo1op rluvslt)sexo(mpnydalt mfeslt s2trumonu1apx mfcils s2ulnvs t0aexnir iydfatrln s s0 ruoxo no4oltelivta(fsrrrxrp;t0tpeoifeiadla2rl( p ()tetomo oo1la  anei;t setmxm oudamtnmfcsas a2trx pno1oltomfcilsfs2el(mp t)tltnio io1lp eanvols t2xo(m3oo1op nmnctat s2tm(m ;o1oleoio3ias m umnvp u0teeoxr io1fa   ivolt0 ruoxo ou4omenlfes tfs2rrumooo0oltomo3tydlm rlums t)arermrctatop rli o;(  rtm(rpio4ameemncsat  Drr(mo;u4oeenif3tyslmDumnms;(4altrmfcio1lmD lieols  exrir ou4apt lneils)arraumo;t4tetomietlt s2eanmp (0alermf tytoa   uvs t0t2xrxm3no4am  mfet s  Dtmx  nt0altoio3tas sDuan on(0aexomr3iatom e u s;(0 2um(r ou4ol elncia()a2taxro;o0oeto ociysfs ulnvsn(4tlxnifcio1la rlieo t)t2xr(r oy4ope  fei (f 2rau o;o4open o3tyd a rm(vs () rtoxf3tatlmDrluvo;( seuo(r3oy1lptemieta(  Dua(mo;t4apenmietydlsDeln p u0arxrxr3oo1fatrauvolt)srtoirpiy4lltemivi t)aDrrxro;u4olt mf3iadfa eanvp;u)altnifcio1laD ai s;()s2umxr nudopenlictltf Duaurpoo4opeo oeiyslsDrmnmpn(0 etomf iy1omDe ivslt0 etmio io4lptn fvsl( s2tax o;o1opt  ieiytfs emump t0 rxomo ty1lmDelueol(  rum(r3nydame lfct (faDtru  nu1teeniieild m uanms t0tlxrmf iatfpteai ils0 rxoxr iodamt mfet t)srtm(ronu4tlt mieiys m eauvo;t0artoir iotlp raueo;s) rumir3iu4optnlivtls)a2ua(mono4teeo ociaslsDranms (0 rtrmo iydfmt aivi;s)t2tmxmpio4omt  nctl() Dtru onu1oltoifeiasfmDraumo;(0arerifciy1oaD  nvo;() etrxopny4lp nlici tfartmx pnt4tle mfeiys aDul( pnt4alxnmo3tatlm   n i t0srumxmpiy1oltn fvtatf rrrur nt0tlt  i3iysfs2emn p;t) rxomr3oa1la   ies s s2tm(m iu4opeemfcta()aruaxmp;t1tpxoiieiysls emump (4 ltoxo iotopDrlnesls0 2uoio3oy1amtemfcil()s2ra(mpot0tpxnmietat a2umn o;u) ltrifcoadfatrauvilt)srxrxr nodlptnmieilt)sDtr(r ;t1tpx mfciydlm2ul( p;(0alxnmo iatfaDr nei;s)t2um(o3nudlmt  nvia() Drmur oo4tex  i3tys s2ulnvsn(0aleomocoytlmte ivs (  2xm(opoo4lltemfet s) 2rrxr nt1oltoiieiadfs uluvp u0aetrmrciydlp e neils)t2umiopou4olen nvil(fsDraurpou1aee iietys m2rmuvont0 etrxo tydopDr u s s0 exmimpnudlm e fei (  rra(r ot4optn o3ilsfmDrlump u4alenio3io1omteanvi ()teumxmpou4ll  lfei s)aDrruro;t1ole mictls aDrln p;u4texrxf3oydfmD lies t  etoxr3nodopeemneta( a2urx p;u1oltoiictadls umnvsnu)treoxo3iy1lpD auvi;s)sexo(o3ou4omenmfetltfa2uaumpoo1oltn fctlslmDelu s;()aexrxr to1lmteaivilt)t2trxr3nudlp   nvs s)arra(m ;u0oee  ociyd s uau p (0 exnxf3oodomDr ueolt s2xriopoo4lpe miet tfaDurxmpou0tpt  ietyslmDul(vp (4arerir to1fa eaneo;t)seuoiopny4ll nmies ()sDuax  ;u1tpto i3iatfm ra(ms ()alxrxf3oy1lpDr nvs t0teumir iydop emnetl( a2rau pot1aex mo3tltls emnmo;()altoir3io1fa   ivi () 2xoir3oudllt mnvs (f rrau  ;u4aptoiieiatfm2elnvpn(4arxnmo ia1lmtraues;t srxo(r3no4lle liesl(  2rauront1opt miciyslm2rl(vsnt0tltoifciadla e uei;()srtrxo oy4omtn ncilsfsDrru oot4tpt io3tadfm ranvo;u4trxoio oytlaDran i ()truoxo iu1lltelnesltfarraumpot1opxn ictas a ul(vo (0alxrxf oa1fa ean i s)t2ur(o iu4ol e ivilt  rrru pot1apt micils aDuanmo;(4aeenxo3tadfa eaueolt0truo(r iu1lm   fci ( aDuaurp;t0ope  fcilt mDrm(vs t) exnmf oo1faD  ueol(  rtoxm nudam   ivta(f Dta(  no4alx ifcilt s um(vs;t) ltnxo tatom e uei;t0 etm(o nu1ol emnciat srurur ;u0tpx miciad s ua(mo;t) rtoio ia1lmt lies;s t2xmirpoydale mies ( a2ra(  ot1oeenmi3ildfs rlu p;u)artnmf3oydfmt lu s s)trtrxo3oudope mfetl( aDrruro;t1teto fctyd mDelump u0tleomfctadoat  ueil(  rxo(r3nu1omt miesltfarra(rpou1tlen ociydls2uaumo (4aetrxo todopDr uvsl(0t2toim nu4alee fcs tf Dtaxrpoo0aexo o3tadfaDea(vonu)aexnmfctatfpt  neils s2tm(rpio4lmtnmnetlsfartm(ront4apt  f3tlsls2ul(vs;(0aexnxfctotomt  nvi (0 2uoiopio1oltelnvsl(fsDuaurpnu4tptn ociadfaDemn snu4trtoxf3oytop elnvi t0 rumxo iodolenlivt s aDtrx  no0tetoii3tyslmDum(vo;(4 eeoxrcto1fp   n s ()srxr(mpiodomtemfesa()aDtaur nt0oetomo3tldfsDeanmsnu)tlxnir3io1lp r nvi;t0truoio oo1ape  fvsas sDraxmoot4alxo i3ild aDrl(mp t0 leoxo3iy1omteauesl() rtrxo3oy1lptn iet t s2uaumpnt4oleniocias m umuvsn(0 renio oytomt livs;(0 etoxr3iodlm   ivia(f Duaumo;t1oeeniiciys m um( p t) eeomr3iodlp ranvil(0 rtm(o3ou1lm  lnvt () rrrxr oo4openmo3tat s emnmp;()tltnxf3oydlpteanei s) ruoxr3oudam nlfesasf rtm(m nu1olt ifcias mDrl(ms t)tlermr3tadfa  luvil(0setmxo ou1olt livta( a2rmxr ot4aleoii3ils a2elump;(0 lerxr oo1lpteaiei s0 rxmxrpou1lmenmfctlt aDtr(r ;t4tptn icild m2um( s;t4arenmf3ia1fpDean s;s trumir nu1ol nmnet ( sDtmum nt4aetoif3tls m2uan on(4aeerifcio1fpDr nvs;s)sexm(r3no4al emfcsa(fs2tmx ono1oexnmietldls umnvont4aeermo3tadomDe uei s0t2to(mpou1ome mfvia(f Dtmu p;o4oeeniictyslm2uanvon(4altrmrcto1omtelivo t0texoxm iodlmt mictl( a2rrum oo4teenmieiyt a em(vpnu0 rtrxfciy1lpDr ieol(0setmio3iy4am nlfct (fsDraxrp;t4tleomi3tlsfa2ulu s;t4areoxociy1lptelnvo (  eum(opoydaptelfvil(fa2uaumpoo1oeeo iciyt a rlu o u) exrirctytfaDe uvs t s2urir oydlmt livt ()aDrr(rpnu4altoif3iatlaDrl( p;u4 lxomr3iydomDranvslt0 exrir iy4alte ivs t arrmu  oo1tlen fctad s rmuvp;t4artnxocoadop e nvs;s  rxrxr no1ll   fes (fsrrmxrpnt1opxo f3iydfsDrmn onu0 eenmr3oatlm e ieils0 eto(m iu4apeemfetasf Drmxm ot1tpt mfeiysfmDrlnmp t4 eerxf3iytom  ln ol() rum(opou1lm elictat aDraumoot1alt mictls s rl(ms;t0 leoirctodfate ivils  exm(r oudop  livslsfaDtru ono0tet iietltlm2em(vp ()trtrxo oa1oaDelieo;() ruoxm ny4lmt mfct s aDrmxm oo4oet mf3iysfa2eanvo;()trxoxr3iydfp  lueo (  2xoir3nu1alen nvilsfaDtr(r nu4olxn ictat s2rau p () ltrxrciotfm  lu o;s0srto(opou4olenlfvsasfs2umu p;u4tlxnii3tyt s rau o t0 rermf oa1laDraivolt  etm(m3io4llee ivils) rurxronu0tptnii3iyd a um(mpnt4 etomf3oy1lmteanesl(0sexrio nu4alenlfetat) rtmx onu0tlxnmi3iydfsDrmuvo;u0texrifcoydlaDrlnvils0s2urim nydol  lfcsa(fs2trxroot4tetn oetldfs rlnmsn() eeomo ia1fmt livi ( trumimpou1lm n fciltf Dumu pnt1oeen feiatfm2ul(ms (0alenif ty1fmtraivi;s0trumxo3ny1apeemfetlsf 2ua( pnu4tle mi3ils m ulu s t0 rtoif oo1om  li o;t texmio3oy4lmtnlnvs tfsDumumo;u4oetnioetydfm emnvs;u0artnmocoadlm r ieolt)sruoxm nu1ol  lnvt s) Drr(mpoo0alxo i3iatfa2ran o t0artnio3oodoaDrlnesls)srur(rpoodlm e fetasfsrtaxm nt0oex ifctldla ea(ms;(0altrxf3todfp  lnvolt setmiopoydame  ictl() 2rr(mpoo0alxnifeiydlaDeanmo (4trtomo3ta1optrauvi t s2tm(rpoydlpee iei t arurumont0tltnif3iatfs emnvsn(4teeoir3iytopDrlnvsls) eurxo oy1amenmiviatfa2taurp;u1teeo oetldfaDeluvsn()alxrmr tatlp  lies ()t2umiopio4lpe  fci tf rrru pou1tpx  i3tytfm rlnms;t0 reomr oo1om   ivsl()t2toxm3iodalen fesltfsruaurpou1oeeomf3tltfs2uau onu4 lxomrctydfmD luvi s0 rxm(opiy4omte nct sfs2uax  nt0aex ii3tlt m rlumsnu0 rxnirctatomDeanvi () exoxr3iu4omt lfctas srua( o;u1alenmf3ils s uln o t4 ltnir3oo1oa  lies s s2tr(mpiu1optnlfei (f 2ta( pou1ole  f3iadls2ra(vs t)trermrcia1lp   u slt0seurir ou4al e fviasfs2trx oot1teeomf3iytlaDrm(vo;u0aetomo tadomtr ivs (  2trirpoodlltemnet t) Dtmxrooo1aexniictyd aDemu s ()trenxf ty1op  au s;t  2xmxm3iodapeelfetlt a2ur(root0aleo o3ilt m2rluvon(4aetoxocoadoaD lnvi;t teumir io1lptemfes tfsrrm(m ;o4tlx moeias s2umn p;(0treoxr3oy1fat  n i t trxm(rpiydoltnmfesa(f rrm( p;u4apeniieilt aDrlums t4artrxr ia1om raneslt)t2xo(o3nu1op emivi sf Dumxr nt1ope mi3iatfaDrau o u)arxrifcio1omDe n slt0 2xoxo3nodoltn icilt aruaxmo;o4apeoif3iasla um(mp;u) eeoirciotopD livo t0sexrim3oo4om n ivta( arrmu  nt0alt mfeilt sDemu p t0altrmfcio1oa  luvo t)teto(r oy1om nmietat s2tm(r ;o4tlx  f3tlt m eluvs;() etoir tytlaDeanvil(0t2xmiopno1olenmfetas a2rau  nt1oeen f3iatlsDul(vo;u) rtnmo todopD aneol()trxrimpoydlme mict t  Drru  no0tpx  oeiltfsDrlnmsnu4 renir3iytoaDeluvs;s) rxrim io4al  mnet t)aDumurooo4tle io3iatfa ea(mo;u0 leoxo ta1lpDrlnvils0srto(r3ou1lleelneilsf 2rrxr nt0opx moeiydlm2emuvo u4trerirctadlp elivi;(  2ur(m3oudolt  ivil()srrmxmpou0oleomi3ils aDrmnmp t4 lxnxr3tytfat lu olt)sruo(r oudlmenlnvi (faDurx  oo1tle  i3tyt a rau s;(4arxoxo oytfaDe uvi;t)s2xm(m no4lm  mieta(  rrmuronu1aexomfetydlm2ul(mpnt)tetoifciy1lpDe ivo ( trto(rpnu1lm  lfetls)aDuaxrpot4alt ifeiltlm em( o u0trenmrcio1oat  ivs (0s2umir3iy4aptnlnvt t) Duaumono4oexoio3ias sDua(mo ()aeeoxo iytlp rlnvilt s2xmxr iudllt  ncsl()s2ra(m ;t1oltn f3tydla2umumo u)tlxnir ta1fmt  iei s s2xmxrpou1al nlnvs t arraumpoo0tpenmoeiadlmDrl(msnu)trenxocoy1latr u i;t0teumir3oy1lmenlnvs t a2rrxm nt1tetn oeiydls rmu o t4aetnir iatlp e uvo;t srtmxm nu1lpenlfetasfa2uax pno0aee  oetysfs uln s;u4 ltnif3tydlp eauvi;t srxo(r oudlp  miet () 2uru  oo1aexniieild aDeau o;(4 rtoxf3oadop ran s ( t2xrir nudapee fcs (fa2uaur oo0oleoiictat sDuln pnu) rtnmfctadfatraieo;s0srtr(mpou1lm elicsl(farta(r nu0teenmictld aDel( pnt4 lenmocio1oatean i t)srum(m no1am  mnvtas)aDuax pot4alt mo3iltls2ul(mp;u)tltrmf3iotop ran s;( trxoio oy4apeemnvsat)s2rax pnt0ape mi3ilsla rl(ms;(4 rtnir iatop eau i;( srxm(m iodol  lncsas)a2raxr ot0olxo o3iatfs rluvpn(0tltoirctotfa eauvolt)t2xm(r oy1lmtemfetl(  Dra(rp;u1openmieiysla2ranmp;t)tlenir todlp e ivs;t0trum(r3ou1om nmnvta()s2trum nt1tlt  fctyd s2ulnmpnt4arxomocto1fmte nes t trxr(o oo1ame miet sf 2rru pou1teeomfeiadfsDuaumo u) lxrxfcoytfmDelieils  exrir iy1ap   icsl(fa2trurpnt1aleoii3tldlaDuauvs;(4artrir3oa1la  aivs t)trtoio3nu4ome mfctl(fs2um(r no1ole  oeiltfs uan snu) lxrmo iotlmDeaies;s  2trir ny4ameemneil( s2tru  nu4teeomoeiadfaDemn o;t4 rxrxo iodomDr iei t0 rumim iy1alee nvt (fs2tm(mpoo4tle  feiat m2ulumpnt0aetrif3ty1lat an sls0setoxm3oo1lpen feta(f rrmumpot1oetomi3tat m2rmumo u0tlxnio tytlmDe i o s  eur(r3no1ll elnes s) 2um(rp;o0opxomiciltlm ua(monu) exnxr iadlptrlnes t0setm(opoudlltnlnvs (faruau o;u1apto i3ilslsDranvp u0 lxnxr totomteaneilt0teurxopou4ame mfcsa()aDuaxroot1aexnioeildlaDul(mpnt0 eerxrcoo1late neils)texoimpiu4olt lfvs s)s2rrurono0tetn fciytfm umuvp (4tetrif ta1laD aneo;( trto(m oo1apeemnetl(f Dtrxrpnt0olt ii3tlsfsDeanmsnt0 etoxr oytomD ln o s0srtoxmpoy4ll nmfvt ()arrrxrpoo0aptoiictasfs2rmn pnu4 rtnmf3tytom r uvo s trumio oudamt  fet ( a2taumo;t0aleomfciaslsDem(msnu0artnxf3ta1fmDraivolt0t2tmxm iu1omtemneias srrru ono1optoifeilsls2el(msnt0texoxo ia1op ranes;( tetoxm3iy1lp n fcsa(fa2rrx pot1tpenmo3iyd m ulnmpnu) exoio io1lp r nvslt0s2tmim ou1lpe mnct t)arumu o;u1tptoifeiatfs rauvo ()tltnxo ta1fa  livilt  rxrxr ou4amtemfvilt  Dta(mp;t0tet moeiysfs umn p;t) rerxr iydlm e i o;s  2umxmpnu1ap nmfcs (faDtr(r ;u0opxomi3ildfs2elums;t4arxnircoadfp elieo t  rxo(o nu1ll   fcsa()aDur(  ;o4opt ifctatfs2elnvs;t4aleoxfciatfm  an ilt setr(opoy1lleemnctlt aDtrxr no4tlx mi3iysfaDel(mo;t0tlxoif iodlm e u s;t0sexo(m3nydal n nvsas  2uax ono1aptnifcias mDua( pnu0trtomfcio1lp rlu s;( t2uoxm3nu1llt livt ()arurxmo;t0aeeomiciltfaDrl(vo u4tlermo ta1oaDe nesls srtrxo3no4aleeliei ( srra(m no4apeomfciltfaDem(mo t4alxnmoctydoatraieolt0srxrirpoydaltnlfcil(f Drrx  no0oetnifeildfs2ul(mo u0artrxr3ootfa e ivs;()tetr(mpnu4ap nlieilt) 2rmxmo;o1tpeomoeiytlm2rmn o;u)tetrmocoa1oa elneo s  2trio3oy4lme micias sDtrx pou1tpx ifetlsfa2umuvp t)treomocoytfaD lneslt)texrxopnudapt  neta(fs2rrxmono4tlenmocilsfm rm(vp;u4 etoxo oo1om  livo t)trxrirpoy1am  mfei t srumuroot4tetnii3ilsfmDuan p (0tlermrctydfpDrau o;t  rxm(mpoo1op  mnvs s  2tmxr oo1aptnmfeild mDumuvs;u0aleoxf iatomDe i i;()srur(o3oodlltn fci ( srumur ou4alxomoeils a eanvp t)alxoio io1lpDr iei () exmim iy4alenlnvsatfsrrm(mp;o1tltomfciadfm uaums;u) rtnio3iy1fm rai olt)sexmxr3oudaptemfvslsfaDururp;u1tpt iiciltfm rmumo;t)trermr3ty1omD  n o (0 2ur(mpnudolenlnet sfaDrmurpou0oltnioeiadfmDeaumo t) exoio iy1oaDelivo (0 rxm(rpnodapenlnvt s) Drrur ou0aleo oeildlaDua(mpn() ltnxfcta1omt aneolt)trxmxrpiodomtn fcilsf rtr(ro;o1alenii3tydlaDrlump () lenmrcoy1lmD  nvsl()srurim3oydale mnvt tfartaxrooo1oeenmo3iyt s2uau p;u4tltrxf iotfatrlies t)s2uo(rpiodlm nlfesat)sDtrxm ;t4tle ioeiydls eaumpnt4aeenxr oodlp raivol() euoxm3ny1olte ici s a2rrur oo1opx mf3iatfm2ea(ms;t4texnmf oytlmtraivol()texoxmpio4lmenmfcsatfsrtaxm ;u4opto ietld a2ea(mp;(4tetnmfciydfp  aieo;t0teuoxo3ou4optnmnciltfaDtrx pnt4alt moeildls2rm(monu0 etnmf iydoaD lueolt)s2toxm iydap nmnei t)arraumono0apeo f3iys a rm(vo u0alxnmrcio1oa  ln o;s)seurir ny4amt  ieta()a2rrx o;t1alxn oeiydls umu sn(4 rxrxo iadfpDelieslt0 exo(r oo4lmtelfcia(  2rrxrpou0olxnmfeiltfs ua( pnt)aeenif3todopD aueo;t)t2um(r3nudoptelncilt)a2umu ont0alx  o3tldfs2umn s;t0tlxoifcoydfpDran i s0 rtmxo3iydope lfcilt  rta(r oo0tlen oeiysla2rlnvs;(4 lxrir oatlateli sls0texo(rpoudape  feiasf Durxmoot0oltnmfetadlaDem(vs t0trxnio oytfatrai i;t)t2xm(m ou1amtnmnvsa(fa2tmur no1olxo i3ild s ean snt)tltrif3iodfpDelnvo s0s2xmiopou1ol emfetltfa2ur(rp;t4ale mf3iatlm emnmsnu0 etrio tatomD li s;s0t2xmirpny1ap  mfvilt sDrm( p;u1alxn o3ils s2ra(vs t)trtrifcto1fm r u s;(  2toim nu1op  miesat a2ua(r ;o0tpeo fetltfsDrmums ()teenmf iatfa  lnvols  rurirpiydale  nesls)a2urx  ot4teeo ietlsfmDrm(vp;(4 etnxrctydoaD au ilt t2xo(opio4om elnvsl( a2urx  ;u4tpeniicildfaDeauvpn()aetomf3tadoptrlu s;t trxo(mpoo1amte ncsat)s2tmu o;t0tpe iictat a ea( p u4trtomoctadfm eaieols)sexoirpio4lme  neslsfs2tmxronu4tle mictas aDrm( o t0tlxnir3ootom rlu i t)trtmxo iydome livsat) Dtrxm ;o0optnio3tyt sDrlnmsnu0altnmo3tytlptrai s ( teum(m io4alen ncsas aDrmxro;o4oexnmoetltfm ua(ms t0texomocoadoate uvo;(0s2trxo3nu1am nmicil()a2uauroot1tlx iieiasla2uau snt4texrmf ty1lm r ivolt)t2tr(o oudoltemivsa()s2ta(r ;u1altn ieild a ulumo;(4teeoxf tytfmD  nes s) rurimpoy4lpte fetl( aDrmurpnt1opxnifetld aDrluvo;u)tlenir ootopDr nes;()srxrxo iodlmtemieiat  2uau  ;u0oltoiictlslsDranvsnt0 lxnmrctadlatrlu ils setrim iu1am elncils) Dtaur nt4alx moeilsfs2uau s (0aeeomf3todom ranes t  2tm(r3nudlmt mnesasf 2tmuront0oexnmi3iad m2elu sn(4 rxrxrcia1oa  luvo;(0 exoxr iy1olte fvias)aDrax onu0tlx  ictlsfm ul(vsnt) rxomocta1fmte u i s  rxrxrpnudom e ivsl()aDraxm ;t4teen o3iys s elnvsn(0aeeoxocia1oaDe uvi;s)teuo(rpoy4lmtnlivi (  2tmxr nu4oet mieilsfa umn pnt0alenmo3ootomtrli slt truoir3nu1olte feiltfaDtr(m no0apeo o3iadlm rlumsnt0 ltnxo oytlp e ivo t seumim3iu1lmtelfcsasf Dta(  nt1tpt io3iytfm umnvonu0aeeoxr3to1fm r ieslt)sruo(rpny4ole mivtl(fsDurxrpno1apx  i3iyt s2rln sn()tlxnxf3oadfptean s;(0s2umxr3no1altnmfvias  2raur ;t4aet mo3iytfa2ul(vp;t4aexomo io1fp   u s;s)truoirpiu4ap elnci sf rur(m nu4tpxo feiyt a ulnvsnu) leoif3tadlaDelu sls srxoxm3oudaptnmnctat) rurxrpno4opxnmfeiltls2elumpn(4trtomfcoytfaDelnes t)s2toimpio4lltnmnvslt s2trum nt4open oeiydfaDum(vsnt4tltnxf3oo1fpt aneil() 2xr(r oo4lmtn netas) 2ur(  nu4tpxnio3iaslsDemnvp (4trtrif iydlmD livslt0 rxoxo nu4amtnlics s  Draxmpoo1tlt  i3tltfsDelnmpnt0artrxf3iotlptrluvols0tetriopoudlm nmfvsls)artm(mp;t0opt mieiad aDum(vsn() rtrxo3todlmtrai o;t0srxrir iydlltnlnvs tf 2raurp;u4oetomociyslm umumsnt0trermr iytlm r i o s  rxmim3iy1op  lfetl(fsDraxmo;u4aexnifetad a2umumonu0alxoir iy1lpDrai i;s t2urxrpoy4omte fvs s aDtmx oot1oetnmiciydfaDul(mp t0arxnmf iytom e neo;t  eum(o iu4oleemfeta()srtrurono1tpxomoeild a2ua(vs (4trxnxr ia1laDrlues t)seum(mpoy1lptn nei ()aDuax o;u4tlxn oetldlmDuauvo u)texomr3ia1faD lneo t)s2trxo3ny4llee fvsls) 2ra(r nt1aetn oeilsfs umums;u)aeenmfcio1lp eaueo (0s2xmxmpoy1lmt  nes (  rurum no0aleoiiciyd sDra(vp;() rtrifcio1om  au olt)t2xoxm iodlp n fvsatfa2ur(moou4alxoioeildlm rl( s t) lxrio3iy1lateai s t t2xmxm3oy4amt mncsa( sDuru p;t0alxoifctys mDeanvo u4aeermrctydoa r uvo;(  rto(r3iudap emivs (fsDraur ;u1apeoioctys a eauvp;(0arxnircty1om  lnes;s)srxriopou1oltelfvi () rurumo;o0tpenmociydfmDean o;u)areoir3ta1oaDranvi t srurir nu1am elnvi ()sDrr(rpou1oltniociltlmDrm(mp t4 etnmo3io1fp r ueils tetoim3iydop nmneslt)a2umum ot0tet ii3tasfa umuvonu4trxoio iodlmtrlnes;t tetr(o3nydal nlnei (fsrum(mp;u0tpxoif3iydfsDul(vo (4alxrio iotoa   ivslt)trur(o3ny4openlnvsa( sDrm(rpno1ole  ietlsfa elu s;u4 rerxo3tadfptelu i t) 2tmxo3nu1al nmies t)srrau  no1tpeomietls mDumumo;u0 exoir3tytfa ranvol( seuoxrpiydlp nmivils)srra(rp;u0aptnmfcils aDran s;u)aetnxo oo1lm rauvs s0s2uoxmpou1ap  lfci t)sDur(mpot4apxomiciadls2rmnmo;u0 renmr3iadom elu slt s2um(m iudlmte feia(  rrrxroou0aeto feiydfsDua( p u4tltrxr3oy1oa r i s;t0trxrxm3ny1amen nct t) Dtaxr ou0olxo iciysfm2rmnmo;(0artomr iadlmteli il( s2umim oo4am  lfvtat  rrmx  ;o0tltomi3iyt sDrau o u) rtnioctydfm r neols0tetm(m oy1lme mictlt srum(mo;t4oet if3tytlm umumo;t0arerif ta1fpDe i ilt) euoimpoo4omteliet ( artaxm ot1olenmf3ildfsDra( ont4artrmfctodfpDrauvo;t0 rurir oudal emivtat arrrx  ot4opxomfeild sDulnmp;t0trxnxo ta1la e ivs;s0t2tr(r nu1ol nmfesa(  Drmumoot0tpx if3ils m umuvonu) lxrio3iy1fpt an sls setrir iy4lm n nvtas)aDtru pnu0apen o3tyd a uln pnt4aeeomfciodlm  an s;()trtm(m oydolt mici s  rtau ono0olxnmietasfa2ulnmp () renircio1fp r neo;s0srxmxm3iy1ape lnetlt)s2rrxm nt0tlxo fciatfm2uauvs t4teeoif todlp  lieils)s2xrim3no1ol n fvsat  2uru  ot0teeomociat s2rauvonu4 ltrmf3totfaDr ueo;( s2uoxr no4lpe mieils) Dtmum oo0opt  oeiyt s2ul(mpnu)texrxo3tytfmD livs (0t2xo(r3nodap e fes (  Dumx  ;o4tet iiciytlsDeanmsnu4alerircoadopDeaivo;s0 etrxm iudame  fcs tfarra( p;t4olto ociysls rluvo u0altomocoydoaDran i;s)s2ur(opno1om nmnciatfsrur(mo;u1tetn o3iyd sDrmu p t)areoifctytlmtelues;(0t2xoir3no4ol   nct ( sDuaxrpno1tetomfetat a2eluvo;(0artoxf3ty1fm   n i s seuoim3iydalt  ncsa()a2rrx  nu0ope miciltlm2umump;()texomf iatfpDrlivil(  rtoxr nudol e ivia(  Dtaum ;o4apx  fcilsfs uanvpnu0altnircta1lpDeaneo s t2tm(o3iy4ope lnciatfaDumu pno1teen octld mDelump;t0 ltnxf3todlptrlu o;t0 2xr(o oy1opee nci (f rtr(r ot4oleoif3ils aDrmnvo (4 renxo3io1laD  u il( srtr(opno4amt mnet tfarta(r ;t4tlx mo3iad a el(ms u4 rtnmf3oytfm rli slt0 rxmxr iu1am   ieil(farrruronu4aexo octyt m2rmu s (0 exnmo tytomDe ues t)s2tmxr3ny4omeemneiat) rta(r oo4tlt  fctasla2ea( s;u0 reomr iodfm eauvilt) ruoxmpoo4ll nmfvtat aruaxro;t0opt mieiyd aDua(mp t0tetnxociytfp r n slt0srtmxo oo1ol e nvs tfaDrax p;u1olen ociytlsDuau p t)tltnxrctydlat lu i;t s2umirpnu4ll nmfviatf rua( p;o0oeen fctysfsDrlnvo;()tlxrmr3todopDelnvs;t0srxmxm io1lptelivsatf Dtaur ot0tpe mi3ils s em(ms;()alxoxr ty1lateauvi t  exr(o io1lmte fvs () Dtr(rpou1apeoifeiydlsDrl( o;u)aexnxo ty1fpDeaies ( s2xoxopnudolenmictl(f rrrum ;o0olxnii3iasla em( o;t4tlermf totoptrlnvo s0trurxmpou4lp  mnvi s arumx  ;u4aetnmfciltfm2ua( sn(0 etoxo3oydlp   u il()t2umim3nudol emfvtltfsDtmumo;t4tex ioeiytfaDuan o;(4alenxf oa1laDrlivs ( srxm(m3nu4ol nmnvsl( srtaxroou4tleomocils a el(mp;t4alxrmr io1om eauvo s0 2xm(r3nydlmt mfcsl( srrr( p;u1oex mociadfmDrl(ms;t)areoxo3iatoaD ln o t0 2toio3iu1aptn fcs s)a2rm( ono0apxo feiyd a2em( pn(4 exnif todom rau i;( srum(m3oudapeemneia(fs2ur( oou0tlxnmiciad mDulnvs;t)trenmr iydoa  lieil()seuoimpoo1lptn nctat) rurxr ;t1tpenmo3ildls2emuvon()alxnmr3ootfmDe iesl()trtrxm nodlptn fvilt s2rm( pot0texoiiciydfm ea( s t4 etrxf to1opt lu sl( t2uo(m oudapt  netls)sDtmxroot1tpenif3iad mDrl(vo t4arermf iotlm rau i s0setmim ou1ap n fvt (fs2ua(mpno0tle ii3tldfaDel(mp;t0aetnmfcoydop e uvo t sexoio io1ome mictatfa2uaxmpou4oex ifctysla rlumon()texoxo3ty1la rai i;(  eurxo iodllee neias)srrmxr nu1olenifctldfsDelu p () lenxocio1oaDelneols0t2trio3io4amt  feil(faDumurpoo4aex  ieias m2ea( p t0teerircia1omtraiei ( t2tmxm io4op  mfvias)aDta( ont1alxn feilt sDulnmonu0arxnxo tatlmDrlneolt  rtmio3oy4ol e fct s a2rax  oo1tlxnio3iyd a2rln p u0alxrir3oadfate uvi;t s2trxr3nudoptn ieiltfaDtru pot4ole mieiytfm2ul( s;(4 ltnifcoatlpD luvsl( sexmimpoo1lltemncilt)s2trump;o4tpx mieiyslm ean pn()arenxfctodoaDrlneo;s)trumxm3nu4omeemivi ( srurxmoot0ale  fctlt aDrmuvsn()texoxf oo1la   ues;(  exrxopnu1lpt  nvil()srtmur oo4aexo oeiadfs2ul(vs t)alerxfctatomtran s;s0 eum(r3ny4lp   ivtl()a2rrx  ou4apt  fctlt sDrlump t4 lxnir3oy1oa elnvil()teuoxo io1altemict t aDtr(mp;o0oexnioetadlm uauvpn(0areoif iatfp  ln i (  etoxmpoy4amenlfeslt  Drrumo;o4alenmoetltfmDel( on() lxniocoo1opteln o s  etrim iu4ale  fci s) ruax pnu0ope  oeiltla ranvonu)tltnxr totfa raieo s0sexoir io1am  lnes t)a2uau  ;t1aet ii3tls a2ul( s (0trxrio totfmDeliei t t2tm(m3oy1al elnetlt)aDrr(rpnu4apxoifcildfm emums u4alxnmfcoa1omtrlivo;t0t2umir3oo1llee fctat)a2raxr ;o4tpenif3tatfs2uanmo t4texnmocta1lmtelu s s seuoxrpoo4alen ieta( aDrau o;t4tptn feils a2rmuvp;(0arenir oadoate nvolt s2tr(opoudomenmnvt s  rtaump;o1opt moeilt s2el(ms;(0altoirctytfp r ivs t s2toir3io1ol  lnetl( sDuaxrpnu4oexn ieiltfmDum(mp ()tlenxr io1lpte nvi;s)t2to(opoo4apen nctas  Drmxrpou4olen i3ild a ul(mo;() lxrxrcoa1fmteaivsl( texoim3io4omt mieiat a2rax  ;o4texnmi3iatlm2ra(ms t)tlenmo3oatomtelueilt)srxrir iu1ape mncil(fsrtau o;o4oltniietas a ean o (4teermo3iadlpDean slt  rxrxm3oodlmtemies sfsDtrum nu1tlx iieiadlaDuan pn() lxrmo3oytopt aueol()srumio iu4am n nvtltfsDrmxm oo4tltnmicilsfm2emuvpnt0 rermfctotfaDran o;t0 exrir ou4lmtemnvtas  rrmumo;t1apxoifciadfs emn ont4altrir3iy1opDeanvi;()t2xmir oy4olt  fvs s)arur( ont1opx  o3tasfs ulnms u) etnxf3oo1faDrluvs;t teurxo oudll n fcsas  2uaum ;o0teenio3iadlmDrmnvs;t)tltnxf io1faDe ivol( trtr(rpoo4am   nctas) rtmxr oo4teenioctldlm2rl(mo t)tetnmr iatoat an o s)t2xrxmpio1am nlfvil(f 2rrur ;u4tlxo ieiatlsDrlnmp;u)artrmrctadopDeaues ( texmirpnu4al  mfes tfa2ta(  ot1oetn o3iytfs ulu o;t) eerif ootfptrli sls setm(o io4ome livtls  ruaxrooo4olxo o3iytfaDemnvp u4aetnmf oadfp raieo;s  2xmxmpio1lmte fetls)a2rru p;u0altomfctysfs elums t4aexomfciodoa eanvo s)trtmxopno1lpe lneiasfarrmxr ;u4aeeniociltfs2uanvsnt)texnxf3iytlpDrln s;()tetoiopoudlmtnmnesl(f 2trurp;o0tlx  o3ild sDrmnvo u0tlxoxf iadlaD aivol()s2um(o3iudoltnlieia() rtr(mo;u0altnifciydla rmn s u)treoxf oa1lat lu i;s t2xrio no4lmeemfesas sDtr( o;o1oltn o3tad mDuauvp;(4teeoxfcoydoaDr i s t0texrir3oydop e fct sfaDtrxm nt0oet iocildla2rmnvo u)arenmo3oytfptr ivi;s)srurxm3ou1aptelfvsl(f rtr(r ;t1tltomocias a2ua(vpnu4tlxoif tadomteluesl(  etrxr3oo4amtnmnes s a2ta(r no0olx mo3tldlaDuln p t0aetrio3tatfp raneo (0tetmirpoo4ole lieils aDrrx pnu0oexn oetasla2uau o u0trxnir3todfptrlivi;s) euoxo no1lmt  fcs ()srtaxronu1oex  i3tyt s ran ont4tltnmr3oodlpt lnvolt) rxo(o3oodlp emncilt)a2rr(moou4opx if3tlt m2um(vp u)artnif ty1laDran olt) rum(opiu4lp   nvil()artmxmpnt0oltnio3tatlsDuaumo (4 rxoxo3iodlpteanvi;() 2um(r iy4lltnlfctl(  rrmuroou0alxoifeiadlsDra(mp;(0aeeoio3iydop   uei (  2uo(mpoydamtn fviltf 2rru  ;o1olxomo3iysfsDeluvs u4aeenmr3tydla eaivs s  rtoxo iu1al nmicils) 2tm(mo;u1opeomi3tytfm2el( p (4tetnmf oa1laDeaiei (0 exo(m3iudalte ivsas  Dumxrpoo4tle  iciys sDemnmo ()tetniocoytomDelivo;s0s2uo(o3nodomen fci sfsrua(  nu1tpe  ociadla em( onu4 etoio3iydfpDeaivi t srxrio ou1omtnlfcils)s2rrxr nu0ole  ieiltfm2ua( p;(0aetnifcoytopDrauvi;t srxmiopou1ome lnvilsfsDtmxrpot0tpt moeiaslmDumuvs u) leomocoatfm e ueolt0setmxo3ny4op   fvsas)sDrax pnu1teenmi3iydls ulnmp t4trtomrciatlaDrauei;s)teur(m3ny1lpenlivi ( s2um(  oo0ale  icild a2elnmpnu) etnmr3tytom  aies (0trur(m3iu1ope lfeiat) 2um( pot4alxoii3ils sDuanvp;(4tetrxo3todoat lnvilt0 eumir3oudale licias)srurxrpno4olt ifciys m rmnmo;(0tlxrif oytfa eauvo;(0srtm(mpiudopt mieils sDta(rooo1oetn f3tltfm rmu snu0 etrmr3ty1fmDeanesl( s2uoiopny1lmenmiviltfa2uax o;o4optomietydfmDrlu s (0arerif iotfaDean i s0 2tr(mpiy4am nlnct t sDra( oot0alxnmo3tad sDrm( ont) lxomo tatlmt li il()setm(r nu4ape micslsfa2urxmpoo1aeeomo3ils m rl(mo t4aexnxrctatfa r uvil()setr(o3oodlpt lnctltf 2uaurono1alxomo3taslaDumnvo;()arxoioctytfatrau s s  rtmxrpiu1olt mici sfartaumonu0alx  i3iydfs2umumpnt4aetomf3oo1laDeaneol( setrxm oodomtnlfei tfsrtaxrpnu0apto o3iad aDua(vsnu) reoxr3oadoptrli s;() rtrxrpny4ap elncia( sDuax ont1altomictysls2el(vp;t)texrifciydfptelu i;() rurir iydapeemfcta( artaxmp;u0ale mociydfmDuanvp;u) ltrxo ta1fp e n slt  exmxrpio1lm nliesltfaDumum ;o1olto f3iytfm rmn o t0teeoio3totlaD au s;s)trtm(rpio1om n nvsls srurxmpou0tleoifeildls em(msnt) etrircoatlmDe i s;( s2xmimpiodlltnmfvsls)sDtm(ront1oeenmieiadfsDuanmp;u0 renio3ta1fa r neo;s srur(opny1op  mictlt sDtm(r nt1tpxoiieild mDemnvp;t0aexnif tatoaDeln s;s s2to(opiu1am
\ No newline at end of file
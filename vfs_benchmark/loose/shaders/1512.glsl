@@ -0,0 +1 @@
+nei;t srxmir3iudoleemnesltf rrrur oo0apxomoetadfaDuanmonu0arxnir ootfa eauvsl(0srxoimpiydame lnvt (fsDur(rp;u4texniocilsfm ra(vo u0 lxoio3oadlmD  i o (0sruoir3iydlmt mfctatfa2tm( onu1aexn o3iyslm2rm(vp;(0artomociy1oatelneilt)s2um(rpny4lm  miesa(f 2rrump;t1olen octls m el( sn(0teerxr3iatlm elieils  rtr(o3ny1optelieslsfa2uru ont0alx mo3iad a emnvp u4artrif3oatfpteaieo;t s2xmimpiy4aleelfeil() Dur(r ;o4tltnmoctld sDuln ont0aetrmf3iy1fpDr n o () rur(opiudape  nvs tfa2rmu pot1aet  i3iadlm ra(vo (4trxrio totlpDe uvi s)t2uoiopnodop nmict sfsrtm(r ou1opxniieilslaDrm(vs;u) eeoir3iodlm rlu s s s2xrxmpou1lm elfvi s artaxrooo1alxo fctld s2rln p t4trerxfcoadfm eai slt0srxm(opiy4ap  lictltfa2urum nu0aexn o3iadfmDemuvo;t0 lxrmf3ootlatrli il(0trtmir ou1lmenmnvt t) 2rrxrono0apxnmieiltla rmu snt0 eerioctytoa raieols texrxmpiu4aleemfesas)srurump;o1teeo fciyd s rmuvp;() eerir3ta1fpDeai s ()s2xmiopoudole  iei ( srtmxrpot0aex mfctysfaDrmnvon(4arerxo3ootfa eln o t0srtmir ou1ll  mnvtasf 2ra(  ot1tpeomo3tadfa emnvo;(4tetoxf iotfp rlivol(0s2xm(o3oy1ol nlfvtls s2uaur ou1ole iieiatfa rlnvs;t)arxrmf iytoatrai il()t2umxm3nu4ap elfvia( arrm(root0ope ioctad aDrlnvs t4tetrmo tydoa  ai i;t) etm(r3nu4lm  miesa()aDur(  ou0olt iietaslm emumo;t)arxrmo3iy1oatran o ()setmxo oy4apeemnvsasfsDraumooo1aptnifetlslsDrmn pnt0tltomf tydlmt anvols)sexm(opnydopeelnesa(f 2trxm ;o4tleomo3iytlmDeaumpnt0tlenxr totfa  lneo;s srxrxrpno4ame  fcs tfs2rrx  nt4alx mf3iysfsDean p t4texrmfcoadlp rlieo;()texoxr3io4aleelici (  Dtr(r ;u4ape mociasfmDran p u0 ltnxr3oo1fmteaueo (0 rxrim nydamtelnviltf rtru ont4openioeiyt a2ulu o;u0trtrio oydlptrai o ( srto(r oudamtnmfci ( a2tmu o;u1texo oetlsls rl(ms u) etnmfcoodfa e ueo s)teuoim iudom nlici t)a2urump;o1apx  iciytlm em( p u4teermrciydlm r ivo s) rtm(o3oo4op nlfcsa()a2tr( pnt4tpxo o3iltfs2uanvs;(4alxrmr oadfpDrlueils tetr(m3nudame liesltfsDtmum ou0ope  octad sDel(mp u4 etrircoadfp e nvs;t  eto(mpnodal elnvias)srrax  ;o0texniociys aDul( onu0aeeoif3iydlaDe nvi (0 rtoxmpoudlptn ncs (fsDrmuroot4oeto i3tydlsDrln s u4 rtomo3iytla e ues t)trumirpno4ome  fetlt  Dtmxmp;o1oeeoii3iadlm elnvo;u4tltrif3to1opD au slt)t2to(mpoo4lpte fesa(  2ta( pno0tleo ieils mDelump t4teenmf oa1oa eanesl( s2tm(o3nodllee fctlt  2rrumont4aeeoii3tytfmDum(vp;() ltoif tydoa rau sls seum(rpnu4am  livt t  rtmumo;u0tetomf3tlsfs rln snu4arxrirctydomDelneilt t2urirpny4lm  lics s) ruax o;u4open i3ilsfs rlums;u4tleomr3tadomtr i slt texmimpoo4alen ivta( arur(r ;u4tpeoiietas s elnvpnt0tlxrif3todfmte uvs;t0 etrxo3nu1lmenlfesa(f rum(mp;t1tlx iociltfmDulums;(0 lenmr oo1faD  iesls trumiopiudlle  ict (fsrtmxr no1apx  octydlm umu on(4teeoxr oo1omDr uei (0texo(r3oydolt licilt srraxro;u0tlx  f3ild mDumu s;u)trenio totfa eliei () etoxmpiy4lmtnmneia()artmum nu0aptoioctldfa rlnvpn(4tleoxf iydlp r uvs;s)s2xrxo3nu4am   fvt s) 2tm( p;t4olen iciadlm2rlnms u)tltrxrcio1fm rau ilt0seumxmpiydoptelfcia() Drmur ot1oetn iciyslsDrlnmo;u0 rxnmo3ia1om eln s (0s2urim ny4lp nmivt sfs2umx  ;t1alxomf3iadfa ranmp;()texnmoctydlat livilt)s2trir no4olenlnei ()a2rmx ont1tetnmicild s emnvsn(4 rxomf ootoaDranvi t)trtoxo ny4amtemfcsatfaDtau o;t0aptnmf3taslm emnvpn()tlxnxocio1fmDeli o;t0texr(o3ou1apt liei t  rtr(mpot0alto fcilsls rl( o (4 rtnif oytla rliei;t0setr(rpiy1om  lfvil( a2ra(rpoo0tltnmfciydls2rl(mp (4 etrxocoatlmD lieo;t) 2xmxm ou4lp emneilsfa2rruro;o1teenifctaslm2rm(mp t)teermocoa1opteli i s0setoxopoo1llt  ictl(  Dtmu pou1tlxnio3tlsfaDrln pn(0tlxomr3iydom eai o (  etrxrpiodom  mnci () Dum(r nt0ape ioctls s2umumpnt0aexoiocoytomt auei;s)sexo(opiudom  mneils aDrm( onu1apeoio3tat aDum( sn(4trxoxr3iadop eau s t tetr(m nudap  mietatfsrraum ot1aee  o3iadls2ranvs u)alxoxf ootfateluvo;s t2toio ny1ol n ietls)sDtr(rp;o0apenmo3tadfs2ea(vs t0 exoif3iytlpDr uvolt0trxoiopiydlpee nvtas)arrax ono1open oeild aDrluvp;()arxnxr3tatoat lueols  etrimpiu1altemnvi tf rraum oo0opxnmfctatfa eln onu0aeeoxrctadoaD luei;(0t2xrxmpiu1ol nmnvsa(fsDtrxmo;t1alxnmiciyd s rl(vs t)trxnxrcoa1lmtraneo;() exrim ny4llee fct (faruaxr nt1olt ioeiadfa2em(vsnu)teerxfcootop r ies;s0t2xmirpny1ameelnvt ( arra(  ou1texo i3tyd m2uaump;t4tetoxo3iy1laD an i s0trtr(r3iy1lm  lfvtl(f Drauro;t4tpeomf3tad a2emn p u4arenir oytoatraivo;s)seuoio oy1lpeelnvt ( s2um(  no4apt mocilsfa ra( s u0 etrmfciotfm eluvs t0teumiopou4op   fcsa( a2tmx pno4tle mf3iadfm umnvpnt0arxnxf tatoatr ueols  2xm(r iy1am nmiesls aDum(r nu0aee ioeilt aDul(mp;u)areomrciatopt auvsls0setoir ou1lmt mfvsat)srraur ;u4opx mietls mDua( pnu4teeoxr3iatoatrln i s s2xr(opoudapeemnvtls)a2ur(mpou0olto octadfs2um(vo u)tlerirctodop rlneol(0 exmxo oo1omen ivilt)s2taxr nu0olxoioeias sDranvo (0tetomf io1op eluei;t seumio3nu4lme lnet s arumxrpot0apt  feildfs uln sn() exomf3ty1lpt  ues;s)srum(rpoudom  lfciat a2um(mpnt4alt iictls m2rm(mo;t4 rxrmr3iydoaDe uvol()t2uo(m3ny4om emfvtlsfs2urx p;t1aptnmfeiaslmDeanvo () rtnxo3tydlpD  uesl() eto(m nu1ap   fvsas s2rm(rp;t4optomfeils m2emump;()tltoxr3iodfa rai i (0 2ur(opio1aleelncsasfaDrrxmpnu0oetn fctadla eluvs;t)trenmfciatlpt luvslt0teurxo3nudap  lict sfa2umx  nt4olxnmoeild m2ua(vo;()alxnxf oodlp  livols  2toxrpio4lmt  nvtl()s2ta(rpoo0aeeomictaslmDran snu) etnmo oytlmDe i i;s)srtm(o iy1llt  fcs (faDtaxroot4oee  icias s ra( ont4artoxo3oydopteaiei;t  2urirpno1om  lfei ()aDtaxm nt4opxomocildfm2rlumo;u0 rtoio ta1lmDeai olt) rxoimpiu1op nlnvt s) rua(m ;o4ole ii3tltlsDrln s (0 ltnmrciotoatraieo;()seumxr3oodoptelnvt s sDurx pou1tltnmociltfmDumn s ()trtrir oadopD aies;(  2uoxo iudomt livs s) 2ua(  ;o0ale mfeiysfaDrl(mo;u4arermo3tydop   iei t)teurxo3no4alenlnes s  Dtr(mo;o4texo fciltfm2eaums;(4trtrmr iatoat  i i (0 etoim3ny1ap  livta( aDtmumpoo4oltoif3tadla2eau s;t4 eenxf3iydlp e nes;(0s2trir no4al nlneils a2ur(mp;o4alx  octyt a2ua(vo;u0tltnmf oodoatrlivs;t) exrirpnu4lpenmfvt tfs2tr(mp;u1openif3iadlm rmnmp;(0 eenmr3iy1om ran i;(  exrxopou4lltn ictasfsDuaxm oo4teen o3ilt a2umump u0arenmr totlpDe i o;s0 eto(o3io4ap  liei t)aDrrxroou4olxn ietyd s2eanmo;t4tltnxo oatfp  lu ols)sexrimpno4amt  fvil()sDururp;o4apxoif3iydfm2rln o u4artoif oytomte ueo t)s2xoim nydomenmieil(  2tr(monu1tptoif3ilsls uluvo ()aetnmocio1lpD  nei t0srxm(m3iy1lmt lfvtat) rur( poo4tpxomf3ildlmDuau snu4 lenmf oa1lptr n ol(0seur(r iodomtnmfct (fsDurumpoo4alt iietlt s2ra(mo u0alenir oydlmtrluvilt0t2ur(opoo1ll nlfetasfaDrmx p;t1aet  oeiasfmDean pnt0 eenif3totlmtrauvolt) rum(mpoo1oltnmictlsf rtmxm nt0teto fetlslaDrmn p;u4tlxrxfcty1lm e nes;s)srurxo3ny4aptnlnvs s)sDuax ooo4aleomoeiad m ul(mont4 rtnxoctodfmtelivil(0 rtoiopiodam elfcsa(fs2um(mont1apt mieias sDranmo;u0aexnioctytlaDeai s;s0setrirpiodlpt miciasfs2rmumpno1olxo o3iasfm2emnms u4 rxoxrcoydfmt  iei s)t2toio oodlpe lnvsa(fartaumpno0alxnmf3ils m eln s ()arxnmfcoo1lat an o ( t2tr(o oudlpe  ncs tfs2ra( pnu4aex io3ias s ul(vp;u) rxnif3oydfmD  uvo;t0trxrxm3ny1aptnmfes (farrm(r ot1tptomieiys a2ra(mo;t)trxrmo oytfm elivi () 2urxo oodamte fei sf ruru  no4oltn fciys s ra(mp;t4 lxrmr3ta1lmDelneilt) etr(o iy1lmt lfei t  Duaxmp;t1tle mfciydfs2uaumsn(4 rxoif todfpD lueo;t) 2uo(o oo1ap elfcsl()sDur( oou4opt mi3iasla2em(vs u0teeomr iodom  au o s0trxrio nu4ome  feiat sDrmur ;u0alxnioetad aDra( p (4 lenmrciy1faDraneo;( s2toir3io4amenmies t s2taurpot0tptoiociytfm elnvo;u4artoxr3oytomtranvi;s)s2uo(o3iu4lpenlfvtat)sDrrxr nt1tptoifcilsla2elnvo;(4texrir3oytfptranvs;t0 rtmiopiydlpt lfvilt a2ua(mpou1olx mi3ilsla rluvo;()texrmr iy1laD  uvolt s2uo(r oudomt mnes t)aDrau  nu0tetomieias m eauvpn(0tlxnxrciydom elnvo;t0trtmxr3io4ame  nes s arrmu  nu4teenii3iydfs elu ont4tlenirciy1oaDranvo ( sexm(o3ou4alt lnes ( sDrm(mont4tpxn o3iydfm2uaumpnt0 ltnmfcty1lm r uvi;( teum(r3iy1lptn ivta(fs2rrxmp;t1tetomiciys sDrl( p;(0tetnmrciydomDr uvolt)t2uoio ny1olen nciltfartrxmoou4alt iietldlm rlump;u) rxomo tytoa rluvo;s)seumio3nu1lptn ieta()srtm(ro;o1oleomfctld s elnmo u4teeoxfcoy1oaDr nvo;( srurxr3iu1omee fes tf 2um(m ot1alto i3tlsfa em(mp;u4aleoir3iotla  livsls  exo(m oudapt  nviasfaruau  ot4aexomi3iat s2uanvo () lerir tatfmDran ilt trxm(r oudlm n fct s) Dtmxrpoo1oeeo icils mDumu s t0altrmf oadla r ieo t s2umiopio1oleemiviat) rraxmp;o1tpe miciasla2rmn pnu4aetriociadom raivs;s) rxm(r io1alen ieiatfs2trur ou4aptnmo3tatfaDrmn p u4trtrmo3iy1fpDe u s;s)teum(r iy1lptn ivi ( a2raxr ;u1aex mo3ilt a2emnmo;u0 renxo tadfmt  ivils  exo(opiy1alte feia() Dur( ooo1optn fciatfs rauvonu4 leoif ta1lp r u i;s0t2uoxr3nodop   fci tf rrrxm ot1teen oeiadlsDumnvpnu0aetnmfciytlmtean o (0seumxrpno1lpeemivt s) 2rrxmo;u1aptn fctysfs umnvpnt4arermf todlaD aueo s0trumxo ou1lpen fctl()a2rrx  ot1alx mf3iat mDea(mo;u0texnxrcoy1opD lneo ()teuoirpoy4optelfvt s  2tau  nu4tpe mieiyt m2rlums u) ltoir3ia1fp elieo (0seuoio3io1ll  mfes (faDua( pot1ope mfctysla ua(vp;() rtnmr to1oaDelneilt tetoxrpiudapenlnes sfs2tr(  nt1apx  feilslaDeauvs (4 reoiocia1la r u o;s)texoxr nu1ol  mfcs sf Dtr(mo;u0tpto feiys m2emu o;(4 rtrmrcoy1om  lies;()s2trxm no1lm nlivsa(  2um( ooo4tlto i3iltfmDumnvo;t4 rerif3iadop   n i t0setr(r3oy4lpenmivsls) ruru p;u0tlxnmieiyt aDea( s;(0arenxocoodoaDe neol( trtmxr ou4aptnlncil()aDtr(mont4olenmociadfs el( p;u0aexomr3ty1fa e i o s0sexrimpny4al elivsltfa2uru o;o4tpx moeiltls2rm( p;t)treoxr3ia1lp rlnvi;s)tetmim no1amt  nei tfa2ra( poo1olen o3iydfs2umump;t)areoxoctydopte n o;t)texmxm3ny1llt lnes () Dta(roou0tpt mfeiyslm ra(msnu)teenif iytfpDe u slt s2uoxmpiudllt lncsa(fsDuau o;u1tee mietasfm2rlnmo t) eenxfcoy1om eaies;t)srurir3nodolte fcsltfs2ra(mo;o0opxomf3tlsfm ra(vs;(0tltoio iy1la eau i;()trtrxopio4omtnmfeilt  Dumxrpoo0aexoifctltls rm(mon(4trerir oatopD aueo;s)setmirpiudoptnlfeilt sruax p;o1tpeoif3tyt s ran s t0trtrmo oa1lm   nes (  rumim oy4al nmfctat) Dua( pno0opeo fctas m uaumsn(4aeenmr3iotoa elieo t s2urxm3oo4lle mfct tfarrmur nt4aetnioctasfa emu p;() rtrio3iodfpteau s s)s2xmxo3nu1op  mfvtlt aDtaxm ot0tpxn fetytlmDum(mp u0altnir3tydoa r ues;t  rxo(rpoydlmen fvs t a2ua( oot0alx iociydlaDuauvp t)aetnxfcia1fmt luvi;t) rtoio io1lptelfcs s aDumxront1aptomf3iasfmDrmnmon(0 lenxociotfat ai i s) etmxo nydaptnlfvtlt artru  oo0aetoioeildlm2emumsnu0altomo3ty1oaD lnei;s0 exoxm3nu1apte iet (  2tmx  no0ale iiciys s emnms t0altomo3iotop  lu s (0t2trir3ny4omeelfeta() rtmxmo;o4apxn ieiytfsDem(vsnu)tetoxo3oatlmDe ieilt0 rurxr ou4lm nlncsls)srtrx  ;u1aetnio3iatlmDel(vpn()artoxr3ty1opt ai sls srxm(mpiydlltnmfesl(fsDua(mo;u4tpe ioctys m2rmn p;u0treomf3ty1oat li slt0 etoxrpnu1lpt liet tf ruaur ;o4alenmocias a2ul(mo t4alxnxrcto1om rlnvo s0 exr(m oodamte fci t aDtr(mp;u4texn i3iad sDemu p t0 lxrir3oo1lm   i o;t)t2xr(r nydoptemivt ()s2rm(  nt0opt ifcilsfa rl(vpnu4tltrif3to1faDr i s s) rto(r3oo1al e nvs s)srrruro;o4tlxnmoeiys a2uau sn(4trerxo iodopteaivs;() 2toxo io1lltnlfct sf 2rrx  ;u4tetoii3tydfsDem(von(0artoif3ta1laD aivs;(0 2uoiopnudll nmfcil(fs2rru ont0tpeoif3iatfa ulnmo ()trxrmf3iatlatrauvo;s)trxoxr3oudop n nctat)sDtrxrp;u0aetnmictlslm2rlu o () renmf3tydomDelies;() 2xoim oo4lpe mfct (f 2rr(r nt4tptn o3tyd m ul( o;u) eenxfctodomtraieo;( srtrxo3oy4amt  feta()a2urxm ou1tlxoioctadla2ul(mp;u0 eenmo ia1fp r nes () rxrirpiydamtnmiviat) 2rmxmont0apenifeiadfs umnms t) rerif3oydlmDe nvsls0 eto(r3oudamee fviat)a2rr(rooo4apx iieils a elnmp;(0altnmr3iatla e ieo;s) rtm(m oy1lp e fcilt) 2uaxmp;t4opx  fciatfa ul( s;u0trxnxf ootlmtrlnesls)seuoir3ny1omtemfes tfsDtru pnt1tpxomoeiysfmDul(vs (4aetrmo iadom raneil(0t2toim nu1olenlnvtatf rrau o;u4optomi3ildfs2emnmo u4aeeoir oy1oaD anei t0tetm(rpno4ol nmneta( aDra(r ;o1opt iieiydfmDul(mo (0tlermf3oadop eaueols  2xoirpiu4al e ies t  rtax o;o0tex iictlsfa2rauvsnt0 exrmrciytopDrau olt)t2uoxopiy1ap  mfvsat  rtr(rpoo4apx if3tadlaDrmumonu) rtnxo3io1op eln o t0 rxr(m3oo1omt  fci s  Durxro;t4ape mfeils m2uaump u4tlxrxf3iatfptr i i ( truoiopiodop   ieiat) rrr( pno1oetn i3iyd aDrm( o t4alxoxo3iatoaD au o;t seumxrpiy1optn netl(  rumxrooo0altnmictas a2raums (4aetoxo tadfaDeai o t)setr(o3nu1lme  fvs ()sruru  ou4tltomi3tad a2rmn ont0aeenif3oydlatrluvslt)setrir3oy1ol n ncs ( s2ra( pno1aetoiocils m2umn sn() rermr iotoaDraivsls)teumir oydol nmfct (  Dra(moot4altn f3iys s ua(vs t0 lxrmocoadla eaneilt s2xrxrpiodal   iesl()artm( poo4tlt mociasfs uauvo t) exnirctotop rli i ()teumxmpoydoptelncs s sDtaurp;t1opxnmo3tls a2el(mpn(0treoxf3tytfmtranvo;t0 etm(o3io1lm elnvs t) rtmuroou0optomoctatlsDrlu s u) exnxrctodfpD  n s;t) etrir iudolt  fvtl(f 2trumoot4tlx moctas s rmumo u0 lerxf to1fm  anvi;t)srtrio3iy1lptnmfct s)a2tr(ro;t1tlt  fetytfs2el(mo;t0 renir3oadoa ran s (0 2xo(rpnu1lptelfcil()a2uau ont1tlx io3tlt m emu pnu)tlxrxo todfpt  neslt  eumir io1oltelfes s aDta( pot1tltnmoctyd s2em(mp;(4aexrio iytfmtelnes ( s2trxm oy4am eliesas sDuaumpou4olx  ieiltla2rmu pn()alenxrcoydfpD aieo;t0t2xmxr iydlle lieiasf rum(mo;t4opxoifetydlsDuaump;() eerio tadfp e uei;t seum(o io1amtemfciltfs2rm(ro;t0tlt moeildlm emums;u0aeermrcoo1lmtrluei;t t2xm(opoo1apte neias a2urxmp;o1tet io3tytla2ulnvp;()treniociy1om e n s s texoxopiu4omte ivta( sDtrxrp;u1opx mieiysfsDea(vs;()tltnio3to1fp rliesl(  exm(r3nodlleemfciat)sDumumono0tpx if3iatfaDeln p (0tltnmo3oa1laDraivslt)s2toio no4lp emies () 2taumo;o4texomictys aDran o;(4teenxo ty1fpD auvo;t  rurxmpoo1lmen nvt ( a2taxm oo1tltomociydla2rmump ()aetnxfcoatfaDrauvils)t2um(o3oy4lle  ivilt srrmxmoou0tlx if3tasfa2rmnms;u0tlenxf3iadla r nvo ()sruoiopnu1altemnvsl()aDtrumpnt0oexniociys aDuln sn(0 etoxr3iodom e neolt srtm(rpiy4omte fctat)srua(  no4aleomoeiysfaDrmu o;(0tlenxf io1opDe uvi t0 rxrxr ou4llt lncs tfarrrxrp;o4oetn oeiadls2eln o;() etoifcoodopt  n s;s0 rtmxopoydlltn fciltfsrum(r ot4oleoiiciydlm uauvp ()tetrio todfpD an o () rxoiopiu4lme  fvsltfs2raxmpou4aet mieiyslaDumnvs;t)tlxoif3oadfa  luvs;s0t2trir ou1ale  fct t arrm(m nt4tpenmo3tatfs2rm(vo (4arxnio3oy1omteau s;t  rxm(r3iudamtelfctat) Dur(moot0aleoio3tltfm emuvpnu0arerif oo1lpDe ivi;( setoio oy1op e ivt () rur(  ou0tet mocilt mDrln p t0teeoif3io1oa rlieol(0 rtoxm oy1lltnlfetatfs2ur(  ot4teeomiciatlmDuan snu) rerioctodoptr ivi s  2xm(mpoy4olteliviatfsDtru pou4tle  oeiys s uan o u4 rtnio iotfa eaieols t2trxr iu1ome  fvsasfa2ur(mpot4tltnmi3iys m rl(msnu) exnir tydfpt auvo;()trxm(rpou1apte ieia()aDur(rpou1texomoeiyd s2umuvs () lxrifcoydlaDraneo;t)s2uriopio4ap nmfetas)s2uau  no0aexo ieiad m2um(von()areoxrcoydla rai ilt trto(m3oudllen ncilt)a2rruroou0tlxomoetasfmDranmo t4 rxrxrctotfmtr i i;s0sexoim3io1lptnlncsatf 2taurpoo4alx  fciyslmDuaumsn()areoifctodlpte u o;t)setrxo nu1al nlnctat  2tmxr ou4tlt mfciad a um( o;u) renircta1fa raivs;s seuoxm oo1apt mictl(fs2trumpot0ope mfeiasfs em(vo t) rxomf ootla r u o s) rumio3ou4lpt lnvi s)artrxmpno1apen fctls m2ea( o;u4alxrmrcia1oa r ivo;t0t2xo(opiodlmee ieils)a2tm(r nu4oeenioetyd m2ean p;() leoif3iydoat ai i s0trxm(m3iodlp  lfvi s)aDuau  ;t4olt mfeiat mDum(ms;t4aetoxoctodomt  nei t  rum(o3iy4aptemneslsfs2rmxm no4oetomfctasfa rln s t0arenio ta1fp rlueolt)t2trxm3iu1omen nvia(farum(roou0oet  fetad a2ea(vp u0 rxoif oodfp  auvs;() 2urimpiu1lmte fcslt)sDrmxr ot0opto i3iyt m raumo (0 ltrxocoatopt lnei;s0srxoxm oy4lleemivt s  Dtrump;t1oetoifeilt aDel( p;u4teeoir iodfmDe nvils t2xoimpiu1am nlfvta(  rua(moou4oexn ietysls ul(vp;()tlxomr iatla   nvi;s srxmxr nu1lleelnetat s2tau pno4tltnmiciltlsDem(mon(4arerifciytfaD  i slt0t2xoim3nodlpt miet tf Dua( o;o0oleo f3iltfs uau o t4 eeoxfciotlpDr ues;t0t2xrxr3iodlm  mivi t)a2taxro;o0oex  f3taslaDeaumo;u4 lxnxr to1fatr i ol( sexmxopiu4am emiviatf Dtr(rooo1opt ifeiadls umn snu0 rermo iodlmDr uvs;t setr(o oydamenmnctls) rta(root1tee  fctysls rm(vsnu4areoxo tydfa  liei;t)srxm(m iudop n fetat s2ua( o;o1aee micilsfs rluvo;t)trxoir3iatfm eauvs t)tetrxrpny4am  lfctat) Dumxm ou0apx  fciaslaDumump u) eeoxf tadopte nvs;( tetmxmpiudll e icta( a2umu  oo0oexnif3tatlmDrlnms;t0 eerxocoodfptraneol(  rto(o3iydlmtelncilt)a2uaxront0tlx  oetaslaDulump t)artnxrcootfaDr ueo s0tetoxr3iu4lltnlici s)artrxront4texnii3tysfs2um( p;t) rtnmf io1fm  lues;s)s2umxr nodapenlnetlt  Dtm(mpnu4alx mo3ildlaDumn pnt4 rxoxo3tatomteaieil( s2xoxo3nodomt mnvils  2uru  ot0teenmfeiydfaDumn p;(0trenxo iodfpt lnes;t t2trxo3nodap  lfctlt srta(  ot1olenioeildla rlu p;u)alxrircoy1lpDr ivil(0sruoxrpio4al nlivia( s2urx poo1aexomieils a uauvs;t) eerxr3oadopDe i sl() exr(opnudap  lfcilt aDuaxr ;u4ale ioctydfaDrl(vp;() exnxr3iytfaDe nvolt0setm(m oudlmt livsls)s2tr(mooo0oeeo ieiasfa uln o t) renmo ty1laDeli s;s) euoio3oo4omenmies s sDum(root0aeto o3iasls2um( sn()aetrif iytfpDe i s;s0texoxm3oodam   neiltfsruaxrp;o1oexn ieiys a rluvo;t)alenxf3io1fateauvils0 rtmir3nudlpeemici sfs2ua( ooo1teeomoeiasfm2rln s u4 ltrifciy1lptr ivi;s)trtm(rpiu4ame  ncsl(  2tm(mo;t1oetnmi3tas a emuvsnt4 etnxr3oadfa e ueslt) 2trxr iodolen ici sf Dtaxmo;u0ope  feiytfa el(mp;u) eenif totfmtelu s s  rum(mpiy4ol   nvs s)s2ur( ont1tet moetadlaDra(ms t4tltrxo3oadlmDelivols)trum(r3ou4ap nlfetl(  2uru  ;u1alto octldfaDuau o u0aeeomo io1oat lu s t)t2um(o io1alen netls)s2rmuroou4oexn ictyt a2ra( pnu) rerxo3tydopD  ivol() rxo(m iydlp   fctlt)srraxmono0oleoiictls m rl(mp (4trxrir3ta1la rau o;(0trxmxm iudlmtelnci s aDurxrpou4tptomfeiysfmDeln s t0arxrxo3io1fptrln o s0s2uoxopoydlmen ivs ()s2rr(r nt1tet mi3iltlsDra(mpnu4trxrif3oa1omDrlu s;(0 2xr(r oudop  mies s)s2tm( p;o4tlenmf3iadlm2ua(mo t0aeenmfcty1fmDelu s;t  2trxopno4altemncsls)s2urxm ;o1oleo fctldls2rlu on(0aetoxoctytfmDelnvs;s) eurxopno1llte fvsl( sDrrxm nu0tetnifeiydla ea(vp;u0trtrmo3oadlmt  n o t  etoxr3nu1al  livs t)srrrx  ;o4tee ifcilsfsDrauvpn(4tltoxocty1lp r u o t0 euoirpiudol  lneiat srrm(moou0aetnioetasla2rl( pn() rtomo3oydoaD aueo;()trxrxo nu4am n fei tf Drm( pot1teenif3tlsfm2ean pnu4 exrmfciytfmDe u o t0trxoirpno1ll  livtas)aDtm(mp;o4oltoif3iad sDulu ont0trxoifcta1om   i sls)s2tmirpnodoltelnvt (fartmurp;o0tpt  ieiat m2ean onu)arerio tydlmteai ols sexrxo nudlle licil()a2urxrpoo1oee  ictatlmDeluvp;t)arxnmocoodlateanvs () rtrxm3ny1ll e ictls s2tmuroot1apen oeiyt mDua( o u4alxrio to1oaDrlueslt0 rumxrpoy4openmnei tfsrtaxroot0ape iietlsfs uln o;t4 leoxr tatlmDraivol(0sexoxopno4ap n fesl( srrruront1oeeniocils s emn o;t0tlenxo3oatlptrli i;s0 rxo(m3iy4lme mfesl( s2tr(m oo1optoii3iytlm um( on(4treoio3iytfmt an s s tetoio ny1am e icsl( aDuax p;t1ale mfetasla2raumpn()altrio3iodlat aues t)trurxm3nudllt mfcsl(f rrmu p;u1aet  ieiat a ul( p ()alxrio3ia1fmtr ivol( srumxmpiy4omee icta() Duaxrooo1apenmfeiytlm rlnmo (0 exrir totfpD  ieo;s) rxmxo3oy4opee fcia(f rrr(mpnu4opxnmoeias mDelnms (4 rtrxfcoa1fpD  iei;t) 2tmio3nudlpte fes () rtax pot4aetoifeiad mDrl(msnt)aexnxrcto1latrln o;s srxrxopnudopenmfcsls s2rmxrpoo4tlxnmieiasfm2rmnvonu)aeerxo3ta1faD  u o (0sexr(rpnudop  lfvia( sDrmu ono1oexnmietad mDeanvpn()alxnir oa1fmtrai o s t2xm(rpiu4lme lnesat a2rmuro;o0oeeoif3ilt a ua(vo (0 etnmocty1lpDe u sl(0seum(r oy1lmtnlnet tfs2rmx pnt0aeeoifetasfmDumu p u0 lxrmfctydomtraueolt0 2xoim oo1lle lfvtas) 2tr( o;o1olxnioeiys mDumu pnu4 etnif todlpDrln s;()srur(m nodame  icsas  2trump;o4apto feiyd a rmnvs t4altomrcoatfmte i o;s0t2xrir nydolee ivt s aDtrumoou1aeenif3iad a eanmsn() etnio3totoptr nvo s0 2uo(rpoy4ale mnvs t  Dtaxrp;u4olxniiciys s umnvon() eerio3oytfpDr i o ( trurxopou1op eliei (f rrmx pot0tlxoioeiadfa2emnms;(4 ltoxr oa1faDraieslt  eurxopio4ole lnvs sfarururp;o0teenioeiat sDum(vs (4aexnio tytla elnei;s0trxrxo3oodole  feslsfsrua( oou1alxnmfciatfs eanvsnt)tltnir3oytlmDrln o;() rumio3oudame mfcsl(f Dtrump;t0olxomf3ildlm rmuvo;()trxrxfcoa1la  lnvi t texoxopiydalt mnvtl() Dum(m oo0oeeoiiciadfm uan p t)alxnxr3ta1lpDr nvs;t  2xoirpnudlpen ncsl()s2ur(  nt4tptomociltlm rmuvo t0artnirctotop rluvol(0t2xo(o oy4aptnmiviat)s2rrx  ;u0opt  fetydlm rl(vp t4 reniociodlp eln s s)seumiopoudalenmfctasf Dum( ont0olxoif3tatla rm(mo (4aeenif3iytfpDe uvi s)srtr(m nodopenlict t  rurxmono1alx  oetys sDuau snt4altomf ia1fptrauvs s0t2uoxo ou4lp nlfctl(faDur(rp;o4apenmieiys s2emn o;(0trermfcto1oa rlneil(0setoim oudaptemnetl()s2rmxr oo4aex ifeiyd a2rmnmpnt4 rxrmf tatopteaues;(0tetmxmpoydll nmivtl(farum(m ;u0ape iiciltfs rmnvp u0 lxoxrcoodfmteanei;(0trxmio oo1om e neiat arraxr ou4olenio3ilt m uauvpnu)aexnxo3iotfp   u ils0trxm(rpiy1alen nvil( srrm(ront1alenmictys m2emnvont4tltrmfctadfa  livols)texoxr3iy1optn fvi s aDtr(m ;u0aexomo3tatfm2elnvpnt0 ltnir3iy1fmteau o (0s2tmxrpiydop emiesl()srum(m no4altniiciydfaDua( o t0 etoxrctodlmDran s;s0 etoxm3ou1llenmnesa( sDtr(mpot0olen ieilsfaDrl(mpn(4aexrxo tadfaD  nvo s0t2xrxr iu4amtnmici s  2uaxr nu4tlxnmf3tat a rlu s;t4tlenmf oy1fmD ai ols t2tm(mpiy1ap elnet (  rta(mo;t4alxomo3tld a rluvo u0tleoif iodfm  auei s) exr(rpiudap elfeta(farum(m ou4oetomietyd aDuauvpnu) etnxocoy1la   n sls0srumxm nu1ole lfvtas)s2tr(  oo4tlxo iciyt a2ua(vs;u0tltoxr totfm elu ols)srxo(opoydam nlfci t a2ur(m no4altnif3iltfmDea(vo;u0 lxnircto1latrlneo;t tetr(o3nodolen nctlsfartaxrp;u1aptnif3ias mDel(vo (0arermf iy1fpD lieols s2um(r ou4ll  lnci t)sDrmum ou1tlxomf3iadla ea( s;u4trtrxrcoodlmDe neils)s2xrxm ou1am  mfci s srtrurpnu0tlx mfciyd m2eluvo;u0trermr oa1laD aivolt  exrirpoodam n nvi t  Dur(roou1oet mo3iydfa el( s;t4 etnxf totfpt an ol(0t2xrxopou1altelivsl(f rrruront0ope mictlt s2rlu s u)alerxf3oodfm elivilt)truo(r ny4lle lnet () 2rm(  ou4alxn f3iydla rl(msn(0 ltoxfcoatopteaivo;s0srxo(m3nydoptn neta( s2taumpnt1alto ieiasla ua(vo u) lerxr totomD auvolt0t2xo(opiy4altnlncilt) Drmumpou4tpe moeias mDrmumpnt0artnmfcoodlmt lnvs t0sexrxr3iy4am  livsatfaDur(mpno1openifetatfm eanvp ()texomr totfpD lieils teur(mpio4alt lietlt)s2rr(roou1tetn i3iat mDelnms;u0alenmo3oatlpte i ils)texrim3iy1omt mfesasfaDtrum nu1aet ii3iysfa rmuvpnt)teeoif3iy1latelivi s)seum(r3ou4aleemieilt arurum nt0olto feildlm rmnmo u)arenxr3iatfat aneilt0 etmxo3ou4ol emiesas)aDtaxr ;o4altomiciydfm rau ont4altnxr3ta1fpD au sl(0srtrio3iy4ll   nvsa()s2trurpou4oexo octytls2rmn o u0aeermf3ty1lm r ivs s)s2umiopno1omt  nvs (fsDtrx pot1alxo i3tldlm2ulums u0texomr3oa1optr u i t0sruoir3iodoltnlicia() Dtr(rpot4tpx iietlsla elumpnt0 reoio oy1omDeli ols0 2xrxopoo1lm  livsasfarrrump;o4alen fcilt sDemn snu4aexnmr oatfpteaneo s t2xo(r io4omen neils  2raxrono4olx  o3tysfsDrau p u) reoif iydfpD aivslt seur(m3iudllt mnet (f rtaxrpou1oet mieiytls2elnmpn(0 rtnxr oy1fa  anesl(0 rtm(opio4om  lncilsfsrtaxrpoo4apt  octat m ua( p t)tetnxo3oa1fmDelnvolt)sruo(m3no1aleemfvias a2rmuront1tlx  ictyslsDem(mo;t)tltnxr oydlptrln ilt srxoio3nydomtelfvilt)srrru  ot1ape  i3iyslsDrmnvonu4artomrctodop eai s t)seumiopoudoptnlneia( sDtm(m ;t1aexo ietaslm rm(vp;(4tlenxf oy1optrlnes;t0s2umxm ny4oltnlnei sfs2uaxm oo1opxn ietadlaDeln o ()tlxoxf3iytopt livi (0 rxoimpio1omt mnciasfsrua(rpoo4apxnifctytfs rau p u0trtrxf3tytfp  livslt) rtr(r3nu4lm e icta( sDta( pnu4tlxo f3tls s rau s;t4 ltrmf oytlmD aivo ()s2xrxmpnodap  lnvs s)arur(rpnt4alxnmictydlaDuluvpnu0 lxrxf oo1op eluvil( srxrxo nudlmee ieia(  Drm( ono4olxomo3iatla2rm(ms;t)tlxrmf3tatomDeli s;(  euoxm iudlmen ivs ()s2rm(rpoo4apxnmfciaslmDumums;u0arxnmrcia1lmDrlneils texo(o3oo1amtn iesat  2taxmpnt0olxnmo3iydlmDra( o u0 exomf iatlmDr nei;( truoxo3iudameemnesasfsruaxrpnt1apeo o3ilt m2ul(vs;() etrmf3iy1fat auvi ()setm(rpnodapeemfct s)s2um(m nu0tltomi3iydlm2elump;t)teeomf3ta1fpDelneilt  etrim3iodopee fviltfartm(r ;t1tltnmietyt mDeluvon(4treomrcoy1fp rlivi;()t2xmir3oudapen nvta(fartmxmo;u4tee mfcild m ulumo (4texoxocoatlmt  iei t0trtrxr3oudlmeelieta(fs2urxronu1teeomi3tldls ea( snt0teenmf3to1lpDeauvol(0trum(m oo4lpe lnesl( sruaxront4tleo f3iadls ran s;t4arenxrctydlmD livils)srtmio3oodlptemnei t  Dtaum ;o0olxn fetysfaDua( p t4teeomr iydfpt  ieil(0 rtoim3nodal n ictlt)aDtrur ot0teenifctlsfm ulu o;u0aexnxo3todlp eaueols0 2xrio no4al emnvias)sDuaum no4aeeoifeiadfs elnmo;u) rtoxo totlmDeaivi;s0srumimpio4al n nvt s  Drru onu4tlto feiyd aDemnmp;(4trxnifcoatopD lnvol( teur(r ou4lmt lnvsa()arumx oou1oeen o3iys m ea(vo u)texomf oadopt  ivols) rxr(m3iudome  icils)a2tmxmpoo4tpt if3tyt m2emn pnu4aleomocoatfmteaneils teto(m3iy4apt mivsa( sDrr( p;o0tpxnio3ildfaDean on(4 rxnxf ty1oaDraivo s)seum(opoy4omtnlics t s2rr(ro;u1tex ifeiatlm2uan o t)alxoir3ootop  lueo s0sexmxopnu4llee fcsa(  Dtrurpnt4alt io3iatla2ul(msn(4 exnxf ootop eaieslt0texo(r3ny1omeemnvta( s2ur(  oo4apx  o3iadla elums u)tltnxo3ty1optrluvs (  rum(m3ny1al  mfeslt) Dtaurpnu4tlxo o3iytlmDrl(mo;(4trxomo to1la  lueo t0s2umirpnydllt lneiat  2tru o;o1oex ii3ilt m rlu snt)aetnxr tytlaDelnei s0trxrxr3iu1omtn fct sfs2ta(r ;t0teeoifciat aDuaums;()alxnmf oy1laD an slt srxoxrpiu1al nlivtat  Drru oot0aet  i3ild mDum( o u0aeerxo iatfpD an o t)t2umxopou4aptnlncsat  rtm(  ;u4aptoifetysfs uln p t4 ltrxr ootlpDraneo ( s2xoim io4lm emfcia( aDta(mpno4optnmfctad mDelnms;u)teeoircoydlaD  neols)setr(m3ou1optemfeilt) 2tax  ;u4tltn feiyt aDulump;t4aexrmf iatlpDrli ilt)t2xoxrpoo1ole  ieil(f 2tmum nu4olt mfciys s2elumpnu0aeeomo3iatlat aueo () 2xrxopio1lpt mfci t  rra(mp;u4alxomfetaslsDumn snu4aexnio3iadfmtelieo s  ruoxr3nu4lmtelnesl( arra(  nt0oeeomociltlm2umnmp (0treoxoctatlatrlnvils)setrim ou1oltemfci sf Dtru pno1tet ifeiatfmDrmumo;t4texoxr io1fpD  uei;t) etrxopiy4llenmivilt aDtr(  ;o1tpenmoetasfa um(mont0 renxocto1fmDe ueo t) eurio3nodoptnmfvta( a2rrxro;o0tlt miciysfa ulnvp () leoir ty1lm  aueils)srurxrpio4llte net ( sDrax p;u4oex  feiat a2ranmo;t) rxoxf iatfa eau o t)t2xr(r3no1llt  fet t)arururono4oetnifciyd s rmnvpn(0teeoxf ia1fp elnei;( s2xoir3no4ale mnei (fa2tm(m no0oee mictld a2rlnms;t)tltnmr oatomDrlu o t0 2xmxrpio1ll nlivtls) Draxr ou1alt iictasfs2el(vs;t0arxnifctydomte neils)s2urir ou4lmt  fes t  Duaur ou1alt if3ilsls2ul(vo;u0 lxoxo3oo1fat aivs;s0 exmxm3oo4om e ici t)sDrauront1tltnifciad s eln s;(4aexoir3oy1fatelieilt0texmirpoodalee ncslt  2ururpnt1alto fcilsls elnvo;u0aleomr3oatlat  n ilt)srurimpiy4lptelfcta(faDuru  nu1alx  fciydfmDelu p;(0trermf3oy1fpDrlies t) 2tmxm3io4lmt lfvsl(fsrtaxmont4oee moeildfs uln s ()teeomocta1oaD  iei s sexo(m3nu1oleemivia()srta(mp;t4oeeoio3iytlm2rlnmpnu)alenio3tytfa  lueo;s)setrxmpio1omte fetatfsrurxr nt1tpenmoeiydfa rm(ms (0artrmf iytop  an s t s2urimpnydomeemivtas sDrrx onu4ole  oeils mDem(mp u0texnir3tytoaDe u s s0 2urxrpio1op  mivs t)srur(mono1texomoetys mDuln s;t4tlxrmo iotfm e i s;t0 2um(m3io1amtemnvsa() 2rru p;u4opxn f3tad s2eluvs ()aeerio totomtrluvols)srtr(opnu1optemncil(  Drr( ono4tleomo3tysfm2elump;t)tlxrxo3ty1fp rlueil(0srxoxm nydlm elfvtlsf 2rrur oo0ape mf3iadlaDeln pnu)artnifctatfaD  uvi;( sexmir3oy1om   nvsl( a2taurpnu1texomiciydfa ra(vo t4texoir3oytoat ai o;s0sruoir3iudol e fcil(faDrax o;t0tleoiictytls2eanms;t0trerio ty1oatrlivi;t) 2um(m3ou4op emnciasfsDta(mont1texn ietat mDumump u4tltomocoadomD  n olt0t2tmxo3io4ape mnesas  2urum nu0tpen ociyt m2rl(vont)treoio iadfpteanes s) rur(rpny4oltnmivta(f rua(mpoo4tex iociadlmDuan s;t4altomo io1fa r ivo s)srumxo oodlp e ieiat) Dtaur ot1oeenmfeild m rlu pn() etnmrcoydlaDrli s ( texo(m nu4lm nmfetlt)aDum(m ;t0oltomo3iydlaDuaums u4aexoxr oatlm rluvols)t2toir3oo1optn fvsat)srra(rp;u4alxomoctyslmDeln o u) lxrxfcto1faDe n ols s2to(mpnu1lm e nvias)s2umumo;u0oeenmoeiadla umnvp;(0arxoir3oa1op raneol() eto(o oodol nmfct (  2rax p;u4oeeniictydfaDelums () eerif3iydfmDr i s;s)setoiopoo4lpenlfcslt srtr( ooo1tpx if3iatfa2rmu o;()trtnio iotlm   nesls0t2xoiopio4ol   ieilt)a2ra(mo;t1teeo o3ildlm2em( o;t0tlermo3tytfatrlnvi s0texmir3iudomeelfct sf Dururp;t1tpxn f3tyt s rln pnu0 ltnir oodomD  ueils)srxmxo ou4lpe mfci s) 2rr(mp;u1olto feilt sDeauvs u4tetnxocoodopDe ivi;s0setmxr ou4ol e ieia( a2rmurp;u4opt iiciysfaDrlnms;u4aexomo oo1oaDelu il(  etoxr io1lmen ivsa(faDtr(mont0opto iciat m2ea( o;(4 renmf3oatfpDeanvs t0srtmim ny4op n nctls) rraxroou0aptnmfciysfs rln p;(4arxomr totopD livs;s) exrim3oodlltelfei tfsDtmumpnt1opt if3iydfm em( s (4 lxnxo iytomte iei;t tetmxopnydolee ies t s2urumono1teto f3tldfaDumu o ()tltrmr oo1om  auei;t  2tmxm3oy1omt mieiat a2ua(mpnu1tltomicils m2uauvsnt0arxrmr3ty1fpDr n ol() exmxr no4apte fet sfsrtr(  ;u1olen fetydlm umu s u0aeeoir3to1opteaivs;()seuoirpiodolt lnes (fs2trum ;u4oexniictys m2um(msn(0trtoxfciy1omDr iei;t)t2umxrpiodap nmics ()aDraxro;o1oet ii3ild s2rmumsn(0aetrmocoytopD aies t s2toio3ny4omeemnvtas) Dum( pou0opx mieildfa2el(vs (0tltomf oo1omD aiesl(0sruoim3nodlptelnvt tfs2umxmono0oee iocils mDemumpnu0teeoir3tydoaD  i il( trxo(mpny1llee fct t)sDtr(  nt4aptnii3tlsls2el( p;(4trenxr to1fp raueils0srumxr nudlptn feiat  rrrum ;t4oeenmo3iys m2rau p u0tleniociadoa  lnvo;s0teuoim3ou4optemnetasf 2tr(  oo1aexnmiciltla eauvpnt)aetoif3iytomDelieolt)sexmiopny4lle mnci t)srtaum ;o0aee ii3iys s emu o t4texrxfciydoaDeanvi;() 2tmxm3nu1ape  ieilt)sDrr(rp;u1opxomo3iytlm ua(vonu0 rtomf3oatlmDrlieo;( trumxm iudom nmfcsl( srtaxronu0aet  o3iatfs2ra(mo (0artrmociydfatr uvs;t) rtm(m nydape  ics t aDtm(mono4aleoiiciat sDuauvonu4tltrirctotfpDraueo;(0setrxr3ny4ap emfcsasfsrur(mp;u1oet iiciltlmDua(vs t4trtnir oadlptrai o;t0 rxm(r3io4lmt lnesltfa2rr( pot0alt ii3iad m2rmuvp u0tlxoio tydomD li olt0tetmirpio4aleelfcsat  2tru poo4oeeomicilsfa2emnmp t4aeenxr3iotop   ivs t  rxo(o3nodolt  ictl(fs2ra(mooo1tpen ieiltls rl(vs;t)teermr3totla r ieol()sexrxrpoy4lm  mict sfs2rrx o;t0olxnioeiytfm elnvsnt4 eermfcoo1fate ues ()tetrxr oo1ole livs sfs2ua( ooo4tpeo feils s2emu ont4trenmr3oydomDraueol(0teum(m oudop e ivsa(  Dur(root1tptoio3iytlmDua(mo u4aexomf iodom  livi s)s2tr(o oodom elfvsa(farrrxmono1apxo f3ilt a2ean snt) rtoxf to1fatranvslt)t2tmirpoy4ol  livt (  Dtaxront4altoifeiydfs ulnvon(0aexriocoydlmDe u i;s tetmxmpnudlptnmfci () Dtr( o;u1oet iictytlsDrlu ont) lxomo todfmt luvs;(  exmio oudaltemieslsfs2rr(  nu4teenmf3ilt a2umuvonu0tetomo3tatfm r nes s0 ruoxm iu1llt  netlt)a2umump;o1opxniociys mDraump;() exomociodoa eli i;t)trurxm3iu4lpee ivslt)arumx  no1alt  ictld s ea( s u0 exomf oytfate uei;(0 2tm(m3iudol  liet t  rra( pno1tlt moctatfmDrlnvo;()trtomr3iotop   nvo;()t2uoirpoodlltnmicilsfaDrrum ;u4opxnmieilsfmDua(mp u0artnxocoa1op  auvs;()seur(r no4opt lncs t  2tru  nt4oeeoiociydfa2emnmpnt4tlxnmo oatom  li o () exoio iy4alenlfvi t s2ta(r oo1apxnif3ils s2umnmo u0trermf oo1oa rlnei;t0s2tmxr oy1ol n ivtat  2rax p;o4tpxoiieiyd m umuvp;u0trxrmoctatlpteai o s0s2tmimpiydlpen netltfarururp;u4alt mfciadfa um(mpnt0aleoxr ty1lm elu s;() 2tm(mpnydamenlivt tfaDuaxroou1tlt mociyd m um( o;u) exoio3oa1lpt  i i s0 rumio ou1amt mietat) rtm(  nt4oex  f3iad s2uau s;u)teermociotomt lies t)srtrxr3iu4ol nmncslt) 2ur(r no1apx  i3iydfmDeau o;t0 ltoxo3iytfmDeauvo;(  eto(o3io1openlncilt)arrrxr nu0opxomi3ilsfm2ua( pnt0alxoiociadlmDe nvils)trtrxmpiy1lptn fetas)sDta(rp;u1tee mo3tad s2uanvpn(0 rxoxo3ta1lpDe i sls t2to(o3oudlpt mfvsltf 2ta(mp;t0oetoioeiytfaDemums t0texnifcoytlp  ln i s0teuoim oy4lpe  nct (  2ua(mono1tpx io3iasfm umump t4aeerio3iy1omtr i s;s tetrirpou4am emietls sDua(rp;t1olx mieiydfsDra(ms t)tlxrio3oy1lpt  nes t)s2xmirpoydopt lnvt (faruaxr ;t1texo iciltlaDeln o;(4 lxnxo oa1fa eaivi;()srxo(r3nu1apenmfcilsfaDuaurp;u4texomoctld m2raums;u0 leoif oa1omDe n ilt s2xm(m3iydapenliet tf Dtaxm ;t4tex mo3tydla2rm(mpnu4areoxf iy1fp   nes t) etr(opnu4apeelicil( srtmxrpou0aexnifciltfs umnmpn() lenmo3tatfa   u o;s0 exo(rpoo4ope lfcsa(  2rauroou4oleoif3iysla ra(vsn(4teenxrcoytlaDeluvs s  euoxm3iy4altnmivsl(  2umxmpnu0aex io3iad sDeluvo;()aexrxr iotfaDrlnvs;s0trtmirpoo4lpte fcils  2rax  nu4tle mfciyd m uln s () exrmf oo1oa   ivi;t0s2xoio3iu1al e ici tf rrm(rp;u1alen f3ilslsDum(ms;()aetoxo iy1lmtrauvi;s0 rxm(o oudap  lfetasf 2tmu  ;u4altoii3tydlmDemnms u0 leoircio1oa eanes s)t2umxr3iydlpe mnct (fs2ur(r ot1tltn icils s umuvonu4trtrif iydoateai s;s0 eum(m no1openlnvtl()sDtaxmpou1oeto ociat s rmu p;t0 ltnio tytlmDelnvslt) eumxm nydlltnlnvtls)aDumxrpnt4alenmf3tytfs2umnmo u) etnif iotoaD auvsls0sruoirpiudamtn nesa( artmxro;o4tltn ictysfmDra(vpnt) lermr3oydoat  nvs;()trum(m oydapen ics s artruronu1oeeoii3iyslaDrmnmont)artnmr3tatlpt livsl()seuoimpnu4open fetatfsDtau pno1tlxniociadlsDulnmp u) etnif iytoa eanvs;t)srum(opou1amtnlfciasfsrta(  oo4tpe iietyt m2rmn onu0alxoio oo1oaDrau i s)sexoio ny4lpeemfeias) Durum oo1opxo ieiad a2rau o;t) renmf oy1fm eaiesls)tetr(r3ou4om   fcia()srraumont4olt  fetatfs2ulu p;t)teenio ootfa e i s;(0 eum(o iu1optn nvilt artrx  ou0aexniieiadlm umuvo;t0 rxniocty1oatrau i;t0s2xm(rpno1lm elfvtas)srtax  ot0apxnmi3iadla2rmuvpn(4altriocta1om  anvs;s0 eurxmpio4aleemivils) Drm(mo;u4aetomfctad sDuluvo;u)altoxf iatfmDeanvi;s s2xmxr no4lpt lfei (f Drrxm ;u4oexomo3ils m2emuvs u4trtoxocoa1fpteaivols t2tmxo oy1om  lfet () rtmxr ;t1opeomo3tydfm ran snu)aeenio to1la eau ols)truoxmpoodome  nei (fsDrmum ;t4texomfciltfm2umnvsnu)trerxo3totlaD li i ()trum(m3nodopt mnvi ( a2taxrpno0aex  fetlsla el(von(0texomrciy1op   u ilt0texm(r3oy4lm  mnct (farua(rpno4apeomieiydfs2rm(mpnt4tetoio ootfa r n i;s0 exr(rpno1lp  livslsf 2tmxmpnu0apeomicild a2eanmsn()altrir3todlmDeaivi (  eumimpnodlm nlneia( aDum(mo;t0apto ieilt a2rm(vs t0trenmfciy1op rau i (0 rxoio3nu1lm elivsat) 2tru p;t0alxoioctldfmDrlnmpn(4tlxoif oodoptr nei t t2toxopnu4lp n fcslt) Drm(m nt4altnmoeiat aDemnvon() lenmr ty1oaDeai s;s)srxm(m3ou1ome liet (fs2umxmp;u0apto ietys aDeauvpn()aetoirctatfpDranesls  rtoirpnu1ll n neiasfa2trxrpou4alenio3iatlm rln pnu0 rtoxoctadfatr nvsl(0sexrxr3oydolt  ivs tf 2rrxrp;t4ole iietydla rmums;() ltnxr oatoaDraieo t  2tm(o3ny1ap nlnvsl(fa2um(m oo4tlt ii3ias m2uauvp;(4 ltrmo3iydfm   uei;s sexo(o oodlm nmfcta() Drrxro;u1optomo3tasls rau onu4 lenircoadla r ueils0 2umxr iudapen icias a2rr(m nu0alxoif3iatfa2emnmo;u0teerio tytopDr u o;()trxrxr3oo1openlicil(fa2tr(rpou0ope mf3tysls2rlumpn(0aeenxf iy1laD  ueslt  rurxo3oydllte ieil(fs2ur(r no0aeeomiciysla eln s u) rxoio iytfaDrauvols) 2xmxm3iy4lm emnviatfs2ra( pou0apenmfetatls umums;t4trxrmr3ta1lmDraues;(  etm(o iy1oltnlncsls a2tru  ;u4alx  fciysfa ranvpn() exnmfctatopD lnvi (0sexoxm3iodlmt liet s aDta(rpnt0teen oeiltla2uan ont4 etoifctytlpDraieo;s  2xriopoy4optn fvtl( srtrxrono1teeomi3tldfs ua( p;t0texrmo iy1fa  ai sls0trurxopiy1lle  fvilt aDtaxm ou0tltn fciasla emn p (0trtnir iadomtranei;()seuo(opoudomtnlfvsat)sDumxmo;u0alt mieiad s2uan p;t)trxoircoy1oat auvol(  eumirpou1lmen fes ()s2tmurp;t4olxo feiydlaDrl(mp;t0texrxr ta1omDeli o;t)tetm(rpnydllt liet s) 2taum ;o4ape iociydlm2ea(mpn(4 etnifcoo1fmtr neo;t tetrim3nydal elivtas s2tmxr ;t0alx ifctaslaDua(vsn(4 eermo oadopDranes s  rxo(rpiydaptn netatf Drax ono1tetoifciadla2ul(ms;()tetrio3iydlmD livo;s0seumio3io1ale lfvilt)a2urxrono4tptniieiytls2elnvo u0alxnir ty1op raieo;s)t2tmxopnydlmen fci ( arrmxmpoo0texnmfetydfa2rlnvs (0 eerio todomte ivi;t trurxm ou1lltnmicias  Dumu pot0opx  oetlt s emu onu4altoif iatlmtr i s;()teumxr iudal   fctas) rtaxro;t1tlt iieiyslm um( p;()tltrmr3oo1la r ivo (0texm(mpio1llen fei (f 2rruroou4oltnmfeiys s2rmu p () ltoio3oadfa rlu ils t2uoxr3oydlm  mnvil(  Dtmx p;u4aleomo3tyt a uln on() ltrxr iydlpt auvo;(  rtrimpnydlp e ics t s2tmx p;t0tpxoifctadfa rmumsnt)aetoif3totom  ai s;s)teto(m iudlm  mictls)aDuau oou0opxomi3iysls2uanmon(0trtnmrcoadfa   u s;( sexmio no1lpe livt (  Duaxm ;t0apeomf3iat s2eaums u) renxrcoadlp eaivs;t s2xo(o3iu4ope  fesltfs2rrxr nu0olxoiieiyt m rau sn(4 etoxoctodfpDe uvols0texoxm iodol emfvtls) Duaxr no1apeoiieiad aDraump ()treomr3to1oaD livo;t0 eum(r oudlmtnlfes ( artaump;t4oet ifeilslm2ulumsnt0 eeoio ia1omtr nvs t)t2toxo ny1optnmfeil(fsDua( pno4alt iiciad a2emn pnu4tltoifciy1lat  iei;t srtoxo ny1ll e iei ()sDrmxrpou0oexo fciltfm rmu o () etrio oodlpteauei;t)t2um(o3iy1lpt lnes s sDrm(roou0aetnio3tltfm rmnvo;t)tlxrioctydlmtraivs;(0 eum(mpiu1ol   fvtltf Dtru  nu0ape miciysfs2uan pn(4tlerir iy1latrli i;t)t2urio3oo4lpee nvsat) rurxmp;o1tltn feiat aDelnvpnt0 lxomfcty1oa eluvilt)t2xr(r ny4op nlicias aDtm( ont4tetomf3iatlmDra(mo;(0trerif oy1la e uei;s)trtoirpoo4ap   nvtat)srurx pno1apt  ieiad a rau p;t0 reniocia1fpDr i o t0 2urir nu1llenmnet tf rraumpnt0tpt mfeiasfa ean pn()tltnxr iotlpD ai ils0 rtrio nu1lp nmfctl()srua(rpnt4texnmociaslm2eanmo;t0 lxnxo oodfat an i;(0 rurxopnu1altnlivils) rumxrp;t0alenmieildfm raumsnt)tleoif io1fmD ln s;s) rumxrpiu1amt lfctl( arur( p;o4aetnmo3iytlsDum( on(0trtrircoatlpteauvo;t0 rum(r3oy1lmtnlfci t  Drmx  ;u0optniieiysls ua(vsn() lermr3tatlp  aieslt0s2uriopnydlmenmnvsa(f 2tmumo;u4opxo oeias m rl(mp u)altrxo oatopDrlu o s0 rxmim iy1altn fviat  Drr(  oo1oeeomfciydfa eanvp;(0texrxfcio1om elnei t  exoxm no4ol elict ( sDuaxm ou1oetnifctys s2eln sn()altoxrciydlmDr uvi;s0s2xoxmpoo1ame mnvta(  2urxrpnu4tpxn o3iydlsDrm(vo;()trtoif iotoat an o (  2ur(o3nudap emfctlt srrm(rooo4tpxnmictld a emn s;t0areomo iy1fa eaieols0t2urirpnudlp n ici s  2uaxmpnt0tlenmoctas m rln o;t4tltrmo oy1fmtrauvo;s)s2uoxrpiydalt mfvi t) 2um(rpot0olto i3tat m rl(vpn()trenmo3ty1lmt lu i s tetmimpnodaptnmieilt)srum(rp;u1ope  ocils s uauvo;() rtnxf3todomte n s (0 eum(r oydalte fvias  2uax o;u4tlenii3ils mDrmn p;t0aetomr3oa1omDeanvi t tetrir oo4lltnmnvta(f Draxro;u1opxomiciyd m2emuvpn(0 etoxr3ia1fptrlnvi t t2to(r oo4ap nlfvia(fa2tmum no4tpt mi3taslsDeanmont) rxrio3oy1lm eluvslt t2umimpnu1lltelfvta()sDrru oou4tetn o3iaslm2ulumo;() exomocty1op r i s t) rxrio iy4opee fvsls  2rm( o;t0olx  o3tatlm ul( sn()tetnmo iatopD  nvi;s)teuo(r3iydal emnctas)srurxm ;o4apxoiocildfm2ea( s;u)tetrmo to1lp rlu s t0 rur(o3iy1lltemfvi t s2tm(roou0oee ioetasls2um(mp;u)aexoxr3ia1lp rli o;(0 2urio no1al nliet t a2ua(  ou1opt mfctad a2rl(monu4teenmf3oo1la elu i;s)t2uoxmpio4lmt mfctat  rum(rp;o4tlxoiictatfsDua(mpnu0arxomfctydlm   ivs s  euo(m3iu4lmtemiesa(fsrurxmono4tlx iieias a umuvo;t4arxrircoatfaD  uvo;s0 2xmxm3iodlmtemnetls)s2raur no1olt  icilsla2rmnvo u)alerir iytlm r neslt0texoxo3oy4amt lnvta(fs2rr( o;o1opx iociytfa2ra(ms u) lxoxr todfmDeaieol( srtmxrpio4aptnlneils)sDtru  ;o0alt moeild s umnvo t0trxnxfcio1om raiei (0texmio iudap n ivil(farraxr nt4opx moeiadlaDemnvp u)texrxf3oatoptelieslt)t2xoxo3ny1oltnmnei s) Duru  ot0aee  ociys m2elnms;u4tleomo oa1lpDe ieo s0texoirpnu4apte fci s)arrrumpoo1aetn f3iadla uanms;t) lerifcootlmDraiei t0 rumimpiu1open ietl(  rrmum ;t4tltoiictatls ua(mo (0trtoir tytomteai o;(  etrir iodapt mnvsatf Dumumo;o1opt mieiytlaDelnmon(0 eeoirciadfptrlivi;s0t2urxm iu1optn ict ( arrax p;t1optnmo3iysfm2rl(vs t0arxoir tadla e i ilt0 2tmxr3nu1op  lfvt s sDum( ooo1aexo iciydlaDran on(0texnxrctotlptr ies;t) exoimpny4oleelicil( aDtaxmoot0tetn feiatfsDem(ms;u)aetrmr3tatomteaivi;t s2uo(m nudlleemiei tfsrtmu pnt1tpto feiad s2rmnvs;u) rtomr iy1fmtrlneil(0t2urim iydllen ncsl( s2rr( ont4apto f3iydlsDra(vp u) leoif3io1fpt  u il()srxo(r iy1op  mnesas s2tru  ;o4oetomi3iadfs el(vo t)altoxr iadom eaieils0texmir oudlltn nct t)a2umu o;u1tpeoifciat sDrlnms;t0 exrxr3ootfa   u s;t  2umxrpiu1llee fvsl()sDumxm nt4tpxo ociatfaDran s;u0aeerxrciadomtelneil( t2ur(opoo1oltemict tfarrrxmoot0optn fctltfs2rm(monu0altrxrctodlpteln i;s)trurio3ou1omen feta() Dtaxrpno0tee ioctyslm2rlumo u4alenif3tadoaD  nes t trumim3oodoptemiesatfaDrr( o;t4olt  i3iytlm2rmu s t0 ltnio iytlmt  i ol( t2xmxr3io4lmen fvsat artrumo;o1oleoiieiyd aDuanvp (4altnir ootlp eauvs t) 2tm(mpnydlleelnvilt  rumumo;t0aetoifetyd m rlumsnt)alxnxf iy1fmD  uvo;() 2xo(rpnu4oltnmfvia(fs2uru p;u4opxnioeiltls ul( snu0 rerir totoptrln s () eum(m3no4lpenlicta(f 2uaxm nt0aexoifeias sDuln s;u0tlerxrcoa1fa raneo;t  2urxo3iu4am emnesa(fs2uau pno0opx iieildfaDua(ms u4texrxo iydoaDeau s s)s2ur(m no1lltemiei s artaurpou0aptnmoctyd a rm( o u0artoif iodomDe i o t0t2xrxo iydamen icsl( aDraur nu4oexo i3tldls2el(monu)alxrif3iadlaD  nei s  2tr(m iy4lme mivilsfsDumu  nt1tlxn f3tlt s emuvont0trxrmfciadlm elueo;(0 eumxo3io4lmee icilt)a2tmx  ;t4alenifeiatlaDum( o;(4tetoxr tatfpte n i;t s2xmxm3nudomtn iet () Drauro;u1tltoifeiydfm2rauvp;(4 rtnxocta1la e ivolt) 2trio3oo4lptnlncil( a2trxm nt0olx  fetatfsDelump;()trermf to1latr uvsls)s2xm(r3nydlm emfvtltfa2rrxrpoo4tex ii3iysfs2eaumo;u4altrmo iodfat ln sl( t2toirpno4ol  livi ()arrr( o;t1tpxomociyd s2emuvpn(0 leoif oodlp e u s t0 rtoiopoydal emnvs (f Dumxront4altnmieiydfm2umn on(4aetoxf tatfp r uvol()texr(m3oo4ll emnesa()aDumu poo0olx mfciydfa emn pnt) ltnir3oy1op  lnei;( trumiopiy4alt mieslsf ruru pnu1tetomictydfs uln p u)alxnxo ootfp   n o (0 etr(opiu4lp e ieta() rrmx onu0apeo fciaslsDean snu)aexoifciydom r u s t0srxo(o iudamen iei t arumx  ;o4tltnif3iaslmDemu pnt4arxoifcio1lm elu o;(0 2trxopnodllt  nvs tfa2umx oot4apxo iciaslaDeluvs;t) rtoircoo1lm   ivs;(  rtrio nu4opeelfviatfarrauroou4oltnmoetadlsDuanvont0 lxomr3iy1fa  aueo s seuo(mpou1apt lict t)s2rmumono4oexo icildlm rlumon()aeeoxo tydfmt  nvols0 2urirpiy4lleemicia(  2rmuroou4ole  ietytfa2ulump u4 rxrmo oo1opt ai i;t srtrimpiu1lpee fvtat)a2rm(mp;t1oeenifciltla em(vo;()tlxnxr ootopt  uvi;() etr(mpny4amt mfes sfaDraxmpno4tlenmo3iydfs2uanmp;(0 ltomo3ta1om eluei ( t2urxm3ny1apeemnct t) Drmumo;o4tle ifetadlsDel( p;(0trtrif3tytopDrlnvslt srtrio oodomen ivs s)arumum oo4oexnifciatls um(vp (0 rerxr iotopD  ieol( t2xmirpiu4ap emict (fsrrruro;t4optn feils m rm( o;(4areoxrcta1fat  n i;t0truoxo oodlm elnei sf 2rr( o;u1tpt  ictas s2eanmo;()texomo3tadoat an olt texmir no4amenmnctltfsrtrurp;o0opt  o3tydfa ul(vs;u4tlxnxo3todfpteln i ()s2toxmpou1lleelictlt aDtaumoot0aet moeiadls2eln snt)trenxocoy1oa  auvo;t)texmxrpnudaptn iviat)a2rmur oo0ape mociyd aDea(ms (4texrir tytfp  luvi;t) 2umxo3oo1lm elfetls a2rax  ;t1ape moeiadfaDul(mp;u4aexnxr tatlpDr n i;(0 rtr(r3iu1lp nlnci s)sDta(m nt1alx ifetys m2em( s;t4tetnmf3tytfatelneo ()s2umxopio1lltnmnvsatfs2tr(moou4apxo i3tadlsDumnvo;t)arerif oytfa  lies;s seuoxr3ou4aptelict ( s2urx p;u4oex  ictldfs2el( p t)areoxo iytlptelivolt0srumir ny1amenlieslsfarumum ;o4tpx mf3iytfm raumsn() ltrmo3tydfmte nvo;s  rxm(mpny4alen fvsat sDumx pnt4teeoifctyt sDea(mp;u4arenxr iatfaD  neo;( trxm(o3iu4optn ies t srum(mp;o4tpxnmoetysls2eluvo;(0aleoxfciotoa  aivi;t0teurxr nu4llee ivias  Drmx o;o0oleomfeildfa uauvs;(0tetnxr io1opt aueo (0teum(opiu4ll nlictl() 2tm(ro;t4tptnmieiytls eluvpnt0 exnxr3oo1fptelivs (  2urimpiu1op e feil(fa2uru ooo0tlto feiyd a ean s () exoio oydlaDraues t srtm(m3nudam   fvias  rum(roou1teeo o3iytlsDranvont4artnmrciy1oateauvi;( trtrirpiudlltnlivia(fs2rmx onu0oex ioctytfsDuaump;t) ltrmo tydfptelieo;t seto(r3ou1lmenlnvilt sDur(mpnu0texnioeiysfs2rl(vp;u)tltrifcoydom e i o;t0t2umir io1omtelivsl(farta(  ;o4oexnmf3iat m ea(vs u0 lxrxf3iodlat aivo ()setm(rpoudoptemfvt t  rrr( oou1aeenmociydfa2uln o ()artrmrciodlm eaies;( teuoimpnydole  neiltfs2ur( oou1tltoiocilsfsDumuvsnu) ltomf oydfat an o;s teuoim3oodlp   feiatf Draxrono4optnmociyt m2uan snt4tlxoxf io1fmtr uvsl()trxm(m3oo1altemfci ()aDraumpnt4aexomieiydfm2emuvp u)teeomfciotlptelueo;s)trxo(m ny4oltelivsas sDraxmo;o1aptnmf3iyt aDum( p u)trxoxf3ootfpteaneols texmxrpou4altemfvs s) Drr(m oo4olen ocias mDel( o;t) rerir oy1laD  i o;s)setm(mpiodoptnlicia()srrm(mp;t4aleomfctlt s em( o u0 eeomoctodla r u i ( trum(o oy1am nlivtltfaDtr(moot0oeenmociys m2eln o;u4teenmo3tydfm rlieslt sexrxmpny1lmt lnetlt a2ua(r ;u0opx  o3tydla2rln snu4trtnmfctydfp rln i;(0trxo(opio4alte ieia(fartruro;o4aeeniocilt mDelu s ()tltoxf iadlptrlivsl( s2urxo io4apenmivsas)artrxr nu1teen ietasfa2rau p;t0tlxnxfctytlpte i o;s0trxm(opiu4lm nmfvsat  rtmurono0altomiciatls2rm(mp;u4arerifcio1fpt  nvs;()srumir3ou1opee icia()a2rrxmo;t1teenmi3iatfa ea( o;t4 rtnxfcoatlaDelivsl( seto(m oy1lmeemncsl(  2tr( p;t4oee mocildfs umums;t4trerxr3oatlmtr uvsl(  rur(m ou4lle licsls sDum(m ;t1tptomo3iyslm2eauvp;u4artnxo3iy1op e ieols teur(o iu4lptelncsas  rurxm oo0aeen fciyt a eluvsn() ltrxr ta1fpte uesls s2xo(r3oy4op  mfcsls)srtr(r no0apxomo3tatfm2rauvs ()tleoirciy1fpDr n o;s)t2trio iy4lptnlfctltf Duaxr ;o0tpx io3iltfm umnmp;t) reomf3totoaD  uvsl(0s2xo(r3ny1amtnmfvi s)s2tau o;o0teeo icilslmDua(mont4alenir3ootfm r ivi () rumio3oo1al   netls sruru oot4aee  i3tls m eluvont4 etrxf3io1lmtrln s;t)s2xmim3iu4ope lfcsa()arra( oou0opxn fciadfa2uauvs;(4 eeoxfcia1lat  n il(  rum(mpoy4optn ncs s)a2tm(mpot1apxoioetadlmDeln snu0tetnif oadoptrluvo;(0 rur(o oudop  mfvtas) Dtmxm oo1optoiieiyt aDeanms u0arxriocia1fmte nes;s0 2tmim oudlmtemfes tfa2tr(m ot1altnmfeilsfs rmu pn(4tlxnircta1fateauvi s)setmio3no1am nlfvilt)sDraumo;u4opxo i3tasfsDemn s;(4 rxrmr3todoaDrli i ( s2xmxm nodllte nci s)srtaxmpoo0altn icildfs ulnmp;u0aeenmo3iydfm rau il(  exmio3oydamt  ivtasfaDra(mpnt1alxnmietasla2eluvp;(0aetrmf3todom r ieolt)teum(mpoy1amt lnctl( s2trx oot4aex moeiadlaDulnmsnu0trenmr3oy1fateau s (0srxmxo3oudamtemics (farrrxmpnt0aex ioctadlm2ua( p t) eenxr iadoat  uei s tetm(m3iy1am e icsls)arra( ooo4tetoif3tydfm ul( pnt)aexoxf3oa1op rln i;(  exmim3io1opeelfvsa(  rrrxr ;t4ope  ieilsls elnvp;(0trxnxr3ia1opDelivo ( truo(m nudlpe lfvsat  Drmumpou0aetoiociyd sDel( o;u4treoif iotfmtrliei s) eumio iodaleemfctatfs2rmxrpnu0oexnmoeiyt m el(mon(4alermo3iy1fatrauvo (  2xrxopoydome  nvi (  2um(ro;t4tee  o3iadlsDua(vo;(0alenxocto1fm r n i;t0setmxm3nudlmtemncias)s2rr(rp;o0oeeo i3iadla uanmo t)alxrir3todlmD luvo (  2tmir no4ll nmfci t s2urum nt0oleoiictltfa2ra(vsnt4altrmo oytlmteaueo;t0 rtmxr3iodamte ietlt)a2rmur ;o4tpx iieiydfm2emu snt4 eenxr3oytoaD lnvs t) rxoirpny4lleemicsat  rum(  ;t0tee  octatlmDumuvo (0arerif tydfmt li s;(  ruo(opiudll nmfvtas  2trx p;t1tetn f3iadfm ran pnt4 etoxr io1omte uvsl( srumio oudole  ivias sDtr(rp;u1aetomieilsfmDra(vp;t) etnio totlpD auei;s) exm(r iy1amtemici s)s2ur(m ;o1texnmi3iltlm2el( p u4arxrmr iodop eauvo;s0t2xrxm nudopt  fci s)sDrmump;t0apx moeiys sDrlnvp;()altnxf3tytlpt  i o s0s2xm(mpoudomtnmfct sfs2umumono1oltnmf3iltfs2ua(vsnu0 renxf3tytfmDelueo (0 2toxr3no1lmen neiltf rrm(mp;t4apxoii3iltls emumsnu)aeenircia1fate nei;t0t2uoio iy1lpen iciat)artru poo0texnmf3iadfa2ea( s () lxnmocoytoa  aneslt t2xmxr ou1omenmiesat aDrrxroot1apx iiciadls rau sn(4tlxrmf tydlmteaies;( sexoxmpoo1opeelnesltfsDuax  ;o0oeto iciytla2ulu snt4alenir to1latr n ols)trxmxr iy1lmtnlneta()aDrrur ;o4texomi3tls aDua( p;t) renxf3ta1la  lu s;t0t2xmxm ou1amtemics (fsrtaump;t0tet  ictysla rmums t4 exomociytopt au i ()truoxo nudlptnlictasfa2taur ;t1texn ictatfm rlums;t4arxoifcto1lpD anvo s) 2trim iodomte fviatfsrrrurpno4ope  fcildfa raumon()trerxociotfm eaivo;t) rurxmpnu4lpenmics (  2tru poo0tee if3iat s2uanmon(0 lxoxr iy1lpt lies s0 2tr(opoy4aleelfesltf rrax o;u0altoioeias aDrlnvo t0treoio oodfpDr ueols  exoxrpiy1lmeelfcsa() 2rr(ro;t1tleomfctytfsDemnvo (0 ltnmo oadlp rauvo ( teurir nu1apenliei t) rur(mono1opt mietltla2ea(vp u)trtrifctatlpDraiei t)srxrxm3nu4ll e iet tf rtmxmp;o1tltn o3iys sDra(vsnu0texoxf oa1lp e n i t0t2umio3oydape  fesltfsrtm(  ;t0oetn fciydfs2umnmont) rerif3iydlmt an slt trxo(r nu1op  lfeia() 2rau o;t1tle ioctasls em(mo;u) ltnmr oo1lpD livo s0sruoxrpiu1oltelnvs ( a2tr(rp;t4olt  o3iltls2rluvp u) ltoiocootfm rau s;s  2tm(rpno1lp  mfet sfa2ur(r ;o4texoiieild mDraump (0tetnmocia1fptr ies t)teuo(o ny4am  mneiasfa2rax  nt1tetn oetyt m ranvsnt4 lxrif3oatopteauesl()sexrxr3oo4lpte fctltfarra(  ou1ole mictydlmDrl(vs u4aetomr iy1laDe u s ()srxoio3no1ap n ieslt srtmurp;u0aet mocilsfs ra( s u)arxomociytlpDeluvs;s t2tm(o nodomtemnvslt)a2um(mpot4tlen f3iatlm umump t)artrxrciadopDelu ols)teto(o iy4lptelnesls arurxr ot4ole  o3ias aDeaump;(0altoifcto1omDrauvs;t0trtoir iu1amtemfci s artaxmp;t1teen o3tlt a rluvpnu)arxrio iadfpD livo t trtoir io4lltnmfvi s  Drm(mpoo0tex io3ild mDumnvo;t) eeomf3oadlaDelnes;t) rxrxopoydope  nvtl(faruaxmo;u1aptoifcils m uanmsnt)tetomo oo1fpDeaneol(0 2xoxm ou4omeelicias artrxront1tle mietldlsDuluvo t0trxrmr oadlpt lnvs;t srxoio3iu4lpenmnet s  rurxmono1tex mo3tysls2umnmo;(4 exoxr to1laDe i slt s2toxm ou1lltnliesl()arumuro;t0aexomf3ild mDrlu pn(4artnmfcoodfmDrlnei;( trtoir oo1opeelfcia(  Duaxr ot1oleomieias mDem(vs;u) etoxoctytoptranesl(0t2ur(o iodalt  nctlt)srrr( pnu1oetnmfeiltfm2rm( sn(0 lerxrcio1lm r nvs s0 2tmxm oy1ol  lieil(fsrum(r oo0oeeo ocilslaDua(mp t0tlxoir oytoptranvilt srurxo ou4am emfesas)sDrrurpnt0tet  fcilt a2rl( snu)trxrioctydfm eauvs;t)seto(opiy4lmtnlfvt tfs2raxmpou1ape mo3taslm ulu s;t4 exrxf tadlm  lieol() 2tmimpnodlmte nctls artaxmo;t1ape ifeild mDemu p t0 ltniocoydlpteaiei;s0 exr(mpiydam emfciat)arur(m ou4opto o3tydfa2eanms;t0aexoxf3io1fa   ivs s0t2xr(m3iy1ope mivslt a2ra(moou1opxniieiad m2uaumo () rxoxo3oa1laD  n i (0 euoim3oodom eliet t  Dua(m ;u0tpxoio3iytla raumpnu0texoif3oodfateauvo (  etmim nu1opt lnvsl( aDur( pou1alenifeiytla2umuvsnu4 etnir3iytlmD li i t  exmio oo4oleemncsas artmu pot1tpxn f3iatfa2rlumpnu4aeeomf ootfa e i ils sexrir3nu1am   neias a2rmuro;o4opt ii3iadfsDrlnmo;t)treomrctotoaD aneo;t0srxoxr ny1opeelnetls artaurpnt4apx io3iltlsDelu o;u)aeeoxf tatom rlnvs;t)srtmiopou1alt  fet ()s2urum ou0tpto f3tyt s2rlnvo;t) etnxrcia1lm r nvil(0 eumir3oy4lltemnvt t) Dta(ro;o4tet ii3iysfmDumnvp;(0alxrxr oytfa  lu i t) 2urimpny4am elfci t)a2raurpnt4tet mfctltlmDuauvs;u4trtrmrctotlpt li i s0 exoio oy4om  livtasfa2uru  ;t4aeto i3ilsls2umn o ()aeeoxoctodop  liesls0trxoim iu4lmee fvs () 2rrxm ou1opxnmf3iatfaDuluvp;t4 renmf oatfpD  i o;(0texr(m3oudap e netl( srtru oou0aeen fciltfm elnvsn(4tlerirctydlp r u i ()sexrxmpnu1opee ivsl() rrru  ;t1tlxnmfciasfaDumnvp u0 renif3oydomDraivs ()sruoim3oudoltemnctatfsDuaxmpoo4tpto i3iad m2rl( ont4trenif oadfmDe nvolt)truoio iydomenlnvsas  2urx  ou0apenmi3iyd m2eanmont)artnmo3oydfptr nvolt)setoxm3nu1oltn nes tf Dtrxmono4olto oeiad a2elnvs;()tleoif iadfpDrau o t  eur(rpoodal   ncilt arrr(mo;t4tee ifciadls umump;() rtnxrcty1omDe uei;(0seumxr nu1llee nvsls) 2ururpnu0olenmi3iytfs2rl(mo;u4 reomoctytlpDraueils tetoirpiu4ol emncias  2rax o;t0oetnif3iytfmDelump u0alxnmo3oatfa eai sls0 rtmim3nodop elnvsat aDumxmonu0aeenmfciat s emu
\ No newline at end of file
@@ -0,0 +1 @@
+u s t) eur(r nodapee nes s) Draumpou0olx  fciltfm2ulu o ()tltrxoctydla e ivs (0texmxrpnydlle lnvil() 2rrx pou4oeeomf3iadfs ua(ms u4tlxoiocoy1fpt  nvils  exrxmpnu1llee ics t)arrr(  nu4olen f3iltfs2umumpnu)tltnircoa1opDelnei;t0t2toxm3oydlle lnesa() ruax ont0oexnmiciyslsDem(vs;t0areoifciatop eliei;t0t2urim oo4om  mfvtltfaDur(monu4ole  octat mDranmonu)alxoxo tytfa e nvilt0trtoxo oydll   iet tfa2rr( pno4optnioeilsfaDem(vont4trtoxrctatfatrlnvsl() 2tmxopny1oltnlivs s a2ur(mpno4oexo octys m umumo (0tltoxrcoo1latrlies t) rtmxm3nydoptelicil( srumxront0alxniiciydlmDem( p (4 eeriociy1fmteanes (0 etoim3ny1alt lncias) Draurpou0openio3iytlm2eluvo;t4arxnmr3todopteaieo;t)teuo(opoo1ap n iei s  ruax pou1olto oetydfs ra( s;u0artnxo oytomDeaues;(0 2um(r3iydlmtn nvsa() rrau o;t1apx ifetlt m ul( pn(0 exnxf tytomtelu s;t s2xr(r oydlltn nvt (  rtrxr ;u1tlxomo3tldfm2rau p u)trerif3oodopDelnvol( texmiopnudap nliei t)sDumu  oo4tptnifetld aDrlnms u)trtrmoctatoateaivi;t0s2xoxo3iy4om elieils  Dtmuronu0tetnmieias m2ulums;u4aeerif iytlpD lneolt trxr(r3nu4apenlivsls)srumu pnu1tptniictldls2ra( p;u0 etrxrciytoat aiei;t)t2uo(m3iudopen nvtat sDuax p;u0tet mieildls2rluvo;(0arxrif3iydfa   iei;s) eurxo nudame lfvi (  2rrurooo4ale  iciatfs uan s;t)arxrio3iy1lm rau ils) exm(opiy1lmenmivtlt arta( oou0alto i3ilsfsDua( pnu0 ltoxf3tydfmDrau s s0 rto(r iu4lmeemict t)a2rrxmo;u0alxnio3tydfa ulu o;u0trtrmr ta1omD  neslt)seurimpio4lm emncta()sDrmxr oo1apx ioeiysfs2emuvs;(4artoircoo1oaDe nei ( tetriopoo1omen fetl(f 2raxmont4tlxn ieiydfs2ra(msn(0alermo oydfa   n o ()trxo(m3oo4olee neiat aDtmxroot0oexomoeiadlm2rluvs;u)texrmf iy1laDrau i;t)s2xmim nu1ape  nvtat) 2tr( oot4aetniiciat sDeau s u0alxrifcty1lp  lnes;s)s2trxo iy1alenmneilsfaDtrur nu1tetnmi3tldfaDea(vs ()trtrif oo1fpDeaueo (0setmxo3oudll  mncil(fs2tmum ;o0apx moetat m ul(msnu0aetnif oa1lmDr ivi;(0 2tm(m3oydap  lncias) 2rmx pot0oee mfciytfm rau pn(0artnxo3totfpD lneolt s2xo(r3nu4oleemnviasf Drrx pnt1alx  fcilslm emumo t)tetnio iytfa  lu ols texo(m3oodom e ncsa(  Dua(mpno0ole iieiys s2ua(vs u4 lxoio3iydfptrauvo;t0t2xmxo iu1oltemnvsa() Dta(  ;u0opxomociatls2rluvs;t4trtnmo3tydfpDr uvo t0texm(r nudlpenmnviasfsrrmurpot0texoiicils a um(vo;t)tlxoircty1lpteln i;(0s2tmir oo4alenmfvil()sDuau o;o0olxo oeiys a2emnvp;(0altomr totfp r ueo t setmio3iy4om  mivs t s2uru  nu1altnmi3ildlm ra(vs (0arxrif3io1lpDraueilt)srxrirpoydaleelncsa( srra(  oo0tpt mfetyt mDua( p () reomo3oadlptelnvi;() eto(o3no1omt mfvslt) 2rmxmoou1aet iiciytfs ean s;t)tleoio oatlatelivs t)trur(mpio4apte netls)srtrur ;u0tpenifctlsfsDuau p;t0trxoirciy1oa ran i;( s2uo(o io1al emnei s)srtax pnu1oetnmi3iytls rau o (4trxnxf oa1omDr ieo;t) rtrim oo4optemnvi s)sDur(mo;u1aptoiociat s rlnvp () exrmrcia1lptrlueils0trum(rpiydalenmnet t)s2tau p;o1ole  ictas a eluvp;t4 eermr oy1fpD lues t srtrxo3io4ome miesat)arrr(moou0ale  o3ias mDuaump;t)artoxf3ia1om rauvolt0 2um(m3oudoptelieias s2rm( o;t1tetomfctlsfmDrm(mo u4trtnir3oydop e nvo;()sruoiopiu1am  mfetas s2rmu ont1altnmo3iltfm2el(vpn() rxoir3to1lmt li s;t)t2um(rpoudlleelictat aDtr(mpot1aptn fcilsla2rlu o t)arxnxrctadomD ai o () 2xoxmpoy4omeelieiasfa2rau pot1tpto f3iaslmDemn o u0arermf3ia1lmteli s t) eumxr3iudoptnmnci (  ruau ooo0tpt iiciatfsDelumsnt4altnmrctodom rlnei;()srxoxo no4ale mict s)aDua(r ;t4oetoio3tld mDulnvs u)trxoxrcta1lm r i s;t0 2toxo3nu1lmt mivsl(fartmumpoo0ape iieiatla rm(mp t4aeerio oa1fmDelivs s0 2xm(rpoo4altn ivta()srrr(mo;o1opxo ictltfsDemumonu0 ltnifcoo1opt ln ol()teuoirpiodop nmfcsatfaDrau ooo1tpt  ieiltfmDea( snt0alenxf tydop  lnei s0trtrirpno1lptn fesasfsrtm( oot1apt  i3iytlsDemumpnu) eermoctydfatr nes t trtoio ou1lmt  fesa(f 2taxmpou0texnmfctatfs2eluvo u4 lxoxfciatom  ln s t  etmir oudlmt lfvils s2tr(r ;u1teenif3tlsfa ra(vs (0 lxnir3oodfpte u i;s)s2umxmpiy4am e iciat a2rrumoou0tpx if3iatlm2umnms;() rxrirciytlm  an olt0t2xoxmpio1amenmict s a2ra( onu4apxnii3iaslaDemnvo u4aeeomocta1fptr nvi;( s2toim io4ale liesa( aDra(mpno1alxo oeiatlm2ulnvo;u) lxoxoctydomtrlnvi;(0sexoio3iudalte ivi t)srumumoot4alx iocildlm rlnmsnu4arermf3oadla eauvi;()s2xrxm3iodll e netasfa2rmu  ;t4tpeomfeiatfm2raumo t0trxomr oadlpt lu i t0 2urio oy1am  lneslt sDumxm nu4openii3iltfm2emnvo (4 lenxrctytfaDe neo t)t2trxo oo1al nlnvt s) 2urx pnt4teeniieiysfs2uauvo u0trenmo3ootomte ieo t0t2xmxm iu1lpt  ict t) 2uaum ;u1alxomiciytlsDeauvon()alerif todlp e nes s  rtrio oodoltemnctlt  Draumoou4apeo fetysfs rau ont)tetomrciatlp   ues t)truoirpiudlpen fvs ( sruaxrono0ape if3ild a um(mo (4 exnio iatlaDrluei ()trxoim3ny1lp nlfvtat) 2umx pno0opeoiociltlaDemnvp;t) rtrxr3oo1la r n olt)teumxo oodal   icslsfsDtmurpoo4alxn fcilt sDrln p u)aeeoxo3oodfp  auesls)tetmimpiodlmenlnci sfsrtmx pno0olx  fctat aDumuvp (0 rtoxf3iotop rauvo t s2uoxm nudaptelnct (  rua( pno1oex mi3tatlm2em(mp;(4alenmoctotlm  ln i t0s2uo(r nudop  lfvi tf 2ta(m ;t4tpt  icildla2ulnmp t4aeeomfcootlatelu o (0s2urio3nodlpeemivil()srum( pot4texo octadfa ranvp;t4 lxrif oy1lm raueo t  2tmio iy4lmt mfcsls s2rmu  ;t0tpt  feiad s2uanvo t4teeoxf3tadla e ivi s)trtoxr ou4aptnmncs t)aDtru ooo0alx  fciat aDem(vo u)aeenmr oy1fmtrln ils)s2umio oy1lltnmfesasfa2tm(mp;u1optn fciyt sDrauvo u0teenxf ia1fpDrai i t0srtm(r iu1ap elncslt srur( oot1olxomfetldls rlu s () exrio oodlmDeai slt)t2ur(rpnodll  mfvta(f Dumu  oo4tpx mfeiatfa2elumsn() exnmfctotoate neolt) eumxr nu1lptnmfesas) Dur(m no4apxniicildla umnmpnu)treoxo3tatfmteaues;s srxrxo iydll  lfesltfaDrrx pot0aet mf3ils m rlnvp t4aeerir3oadfa  auvs;t srxoim3io1lm nlncsat srta(  nu4optomi3iydlm eaumo (0trxnifciytlpD lnvsl()sexr(mpoydap e nei t a2urum nu0opt ifeiytfa2uau o (4 ltrirciytom e uvi (0trxrxopnu1ol e ncilsfarrr(r no0olx ioetydlm ranmp;(4 ltnmr3tytoa rai ilt0tetmio3iu4om nlfctat a2umxr ;t1tetoifctlslm2ra(mo;u) rtrxr totopteanes s  etr(r no1lmtn netatfsrrruro;t0aptomi3ilsls2uaumsnt0tltrxr3ia1opDeaivi;s  2xmimpio4lp e feilsfartr( p;u4oeen o3iad a rmnvonu0artoxr3tytfp   nes;(  2ur(opoo1lpee fcs ()arta( pnu4tlx mfctas a2eaumo;t0teerxf tadopDe ieo;s  2uoio no4ape mici t aDrmurpno0oetnifeild a2rluvpnt0 reoxocoatoateaieo;s texoir3oy1amtn neilt  Draxrp;o1tptnii3iytlm2el(vsnu0teeniocoytla  anvi;s)setoio no4opeemieiat)s2urxro;o1olx ifetyt s2ra( p;()trxomfcoa1omDr uvilt s2tr(m3oo1apenlnvils s2tr(moot4aeeomoeilsla ea(mo;(0trtoxo3io1la eln i;t0sexm(o ou4op elncs t srraxrpot0oex ifetatfa2elnmon(0alxrxr3tadfa  an ilt)trxrir3oo4ole lfvia(fs2trumoot4teeomoeiat s rm(vo t4 lenmo tydopDeanvi;t) rxm(rpou4omee nvias arum(rpnu1olenmfcilslaDemn on(4 etomrcta1oat auesls0t2xm(m3ny1op  lfvslsf rumx  ou4olxoiociydls2uln onu4alerir3oydfpt luesls)srumxopiy1lltnmnci s)sDumu  ou0apt  fctltlmDua( pnu0aexrio totfa ranvs s) eumio3ou1llen nctl( srtmxr ;t1oet  i3iltls rmu o;t4alenmociadfpDelueilt t2umir3ny4op  mfvsatfaDtaump;u0tlt ifeiydlm2ranvp (0aeenmocoa1faD  u ol(0trtrio3ou4optn icsa(f Dtm( o;t1alxnmfctls mDranvp;u0 rxnio iy1lmt aies;() rxo(m oo4op e ivsa()s2tmx ono0tlx  fctyslsDeluvo u4arenmfcootfpD li ils0t2toxo ou1amenmietat srtaur oo4alx  i3ildfa2eau on(4 ltomfctodfp   u slt0srtoiopiodamtemfesasfaDtmur ;u1opt  i3tadfs2ul(mp;u4 eerxfcta1fp rli slt0 2tmio iu1al nlncs sf Drrx ont1tee mfeiadfmDea(mo ()texnmo3tytfatrluei s) etoxopno4lp elicsa(f 2tmxrp;t4ole  oeiad aDraump;u)altrifcoy1fp e ueilt) rxm(r oo4ame  icia(  rtmxr ;o1tle io3iatfm2rm(vs (0tlenmf3tytfmte ies t0s2umimpou4lmee ivtls)sDum(rooo0aeeniicias m uanmo;() eermo iodfa  li o s0 exr(opoy4alenmfctl()arrrumpou4apx iictatlmDrlu s u) exoxf totla eauesls)srurxm oo1al nmivsatfaDta( p;u4alxniietat m2ra( s;t)trermr iytlm r uvi ( t2umirpio1olt mfei t a2rru  no4tlx  o3tld m ea(vs (0trtomr3totfp   nvsl( setr(r3oo4lpt  fvi s)sDum(mont1openmfctld s2uln o;u0aeenmo3iatlp rauvi (0teurirpnudlleelfvilt aDrmur ;u1oetomocildla uau s;u0 ltnmo3iatopt auei t s2umirpnudlp nlnei ( sDurx  nu0tpxnmieiatfs em(mo u4tleoif to1fmt ai s (0 eurim no1omtemicias aDua(m ;t0tltn oeiaslmDrmu p;u)trxrmo3oytfm e nvs ( t2trxo nudomtnlfctlt)a2taxmoot4oetn feiltfm rm(ms t)tlxrif3oadfaDelnvi t) 2xmxo3iy4olt  feta()a2trxmpot1aleoiieildlm2ul(vp u4artoxociy1laDeau o;t  2ur(r ny1omen nvi tfsDururpot4tle ii3tatlm raump;(4tltnxf iodomD  uvols)t2trxo3iy1op  mies (  Dta( o;t4tleoif3tlt s2elnmp;(4 leoif3oo1lmtranes t s2tmim ny4am  lfeia(f rrrxro;u1aetoioctat s uanvp;t)trenifciotfpDeanei;t) etrir no4op nmfetlsfartau oot0tptnifciys a elnvp;u4 eenif3ootfmteaieo ( setoio3nu4lltn fetl()s2rmur ;t1alxn feiytfs2emn pn(4alxnir3oo1fmte uvs s)srur(m nodome  nvtat)a2rrx ont4alxomfctysfm el(vpnt4artoxf3to1lpt auei;(  ruoim3oodlle  fctlsfa2rr(m ou0oeeo i3iysls elnms;(0tlxnxfciotlp raivils s2xr(r iu1lltelfeilt  Dtauroou1opeoio3iatlsDuau snu) leoio3tydfp ranvi ( trurim3iudom  mivi sfsDtr(ro;o0alen fetlsfs2elu sn(4tlxnxrctadla elues s0s2urxo3no4oleelfvi tf Dua(rooo0tleomoctltfs rlums (4tltomo3tatlmD  u ol( trxo(r oodalt mivsls)sruau pou1olx mi3iatlm2umnmo;t0tlxnir3totoptr n o t)t2toxr nu4am elfctls  rumu poo0apxniicilsfs umu o;(4trtrxfcoadlp   i il(  exrxopiodop   nesat)a2uru o;u1tptnmoeiasfm2umnmsnu4trtrif ia1fp eli i t tetmiopno4amtelivt t)srrmx oot4oleniietat m2ranvo;u)alxoir iadlm r nvi (0trxr(o oudol nmieta()sDumurpnu4oleo oeiysfm2umnvo;() ltnmo oa1op r n i;t  rurirpnydom e icias) Dtmxr nt1apt mi3iasfs2rmnmo u0alxomrcia1optraies;s)truo(o ny4lmee ieias arururpot1alxn ietys a2elnmont0aexoxr oatfp r ieo t truo(r3nudlptn ieiatfsrtr(mp;t1apxn ociatls eanmo;u4alxnifctytfptrlivs s0 eurxrpny4olenmnvs (fs2umxront0olxomfeiyslaDelu p (4aeenmr oytfmDe iei ()tetmim oodom nmies t  rrmurp;t0oeeo iciydfm2eaump;(4altomfcty1latrau s;s texoimpny1lmeelieia()sDumumoou0oltnioeiatfmDra(vo u)aeenxf totlm   iei (0s2urxm oudop   ivi (fartr(rp;o0aptomiciytfa ul(von(4aexomociatfate ies t)trxrxr3ny1lleemivi t)sDtauront1olxnmoeiysfaDumnvo u) rtrmo3io1la elieo s seto(r iudlm n ivta()arrrxm ot0opxnmociyt s ul(vs t4arxnmo iatomteaivslt)t2tm(r iy4op n nvtat  rrmur no1opeoifcild m2emnmo;(4tlxomfcoo1om  luei s  2uriopnu1opt mnvils s2um(r ;o4tetnmo3ilslm2rm( onu0 lxoxo todlaDrluvs s)srtrimpou1omtnlfet sfsrraumpoo1openioetlt s2el(monu0arxniocto1om  aivi;t)trtmxrpiydaptnmnvtatfartmxmooo4teenioeildlm2rmump t4trtrif3oodfa elivi;t)truoimpiy4open nesa(f 2tmu pou0altomi3tydlsDel(msnt)artnio ia1oa r i i s) etoir3oudlp nlnviltfa2um(m ;o0oee ifeiatfmDelnvp t)aetoxfcoydlm raneo s)trurxm ny1ol emfviat aDraxmo;u4oltnmfcils m2ua(mp u0texoiocoa1lpD  iesl() rtoxrpno4apt mnesat  Duru pno1olt  feiydlmDemnvo;(4aetoircoydfm eanvo;s sexoim oo4omtnlfeta( a2rm(r ;t0oet mf3iytfm2em( p t) rxrif iy1la eaiesls)t2um(r3ou4omeelicils) 2trx poo1oee  fetadls2umu s (4arenio3oa1lmteliei t0 2ur(r3iu1omte fcils)aDraxm no0aet mfeiydla2uluvo;(0trxrmf todfptrlnvsl(  2xrio3iy4ame mfcsas  rrrxmoou1alxnii3iat mDra(mo (4tltomf ootlmt  i ols) eurxr nu4oltnmfct tfaDtr( pno1opxo ociad m rmuvs;u)trtnio3iatlpDrlieols  etm(m nudop nmfes tf Drrxmpoo0olt ioeiasfs uan pn(4aeenmrciodomteaueo s  exo(m iy4aleemfvs ( sDur(rpou1ale micilt a2rl(vo u) exrxr3iotlaDeln i t0trtoiopno4olenmfetls) rra(  nt0opx  feiyd m eluvonu)trtnmf3oo1latrlivi;s  etrio3oodap   ivil(  Dra(m ;u0alxnioeildfm rmumsnu4 rxrmo ty1oa r i olt  ruoio iy4ameemfviatfa2umxmo;u0texn f3ilt sDem(vsnu0 reoxrctytomte uvi s)srumxmpoydll nmfvtlt)s2tr( pno0aexnmoetytfa rmnmp;u) etrxfciy1omDraiei s)t2to(m ou1lle  icia( sDuaumo;u4olxnif3tytfm2el(monu0aleoircoytomtean s;t t2xoxr nydaltnmnctat sDraxm oo4aexoio3tlsfa2raumont4trenmrcta1fateaieo s0 eurim nu4ap  lfeiltfsrum(  ou1texoifeild a2umnmo t4tltnif ootlm  an ils  ruoxo3nu1lm elivia() rur( ont0oetnii3iatlm ra( p u4altnxr3io1lpDeluvsls  2xoxm3iydlp emfvi tfa2ta(ronu0tee  ocias a2eau snu4arxnirciadlaDr i il( t2urxo3nu4lpe lnvi s  Dtm(mpoo1tpenifetlsfs elumo () rtnmr3tydom elu s s sexmim nydop emnvsl( sDtm( pou1oex ioeiydfsDemump (4alxnmr ty1lp r ivils0srumim io4ap nliesl() Draxmont1aee iocild m umumo u4altrmf3totlptraiei s) ruo(opoodale lfvi s  rrr(  ;u0olxo f3iyt s emnvp;(4alenmrcoydlp rlu i;()setmim ou4ol  mictls s2taxr nu4alx  ociltlaDrl( o;t4 exomf totoptrlivo ()texrio3nudope mfvtltfsrtmx pnt0aeeomoetltla ua(vs u4 rtnmfcty1om ran s t) rxrxopoodol   ici (f rrmum ;t1tlt  fcilsfa2el(vp;t0aeerircoy1oaDeaues;s)s2xmxmpnu4ale miei tfarta(rp;u0tltoifciysla2rlu snu4 rxomr3io1fpt li o s  ruo(m3iodaltelfvias  2tmx  ;t0oleomi3iydlmDelnms (4aetrif3ootfmt livi;s0 exo(r3no4ol e ncias)s2uaumpnt4apto i3tyt a2rl(mo (4alxnmr3tadop  lieo;s t2xrxr iodlm   fvilsf Dur(  nu0ope ifeiltla ranmp u0tlerif oadomD  uvo s0 etrxo3oy4lpenmici ()arumur ;u0olen ictasla2eauvs;t)aetrxr iydop rlnes;(0 rxr(o3iu4apeemfcilsfarurump;u4oltnmocilt a2ranmp t)tetnxr oadlpt luvs s  2umio ny4llee nvi sf rtrumooo0oltomoctyslsDrlumpnu0texrmr3iytopD  n sls0tetoim ny1ame lfeia(faDraumoou1alxnmieils mDean snt)trxnxo3io1fmtr u i t0trumio oudam nmfci (fs2raumono0oexn i3iytls ua( o;t0teerir3tydopt aiesls)sexmxm iu4ap nlfciasfsDrau p;u1texn fctltlmDrluvpn() rxoxf to1lmt  u i t)srum(r oy1lptemnvias)aDurx oot0oexnmicils sDrl( on(4trtnmf3tadla eaivo s trtoxr3ou1apenmneil( a2taurpno0oexn feiadfs2uanvpnu0 exrmrcoydlp  lu s;s)tetm(rpnu1amee ncils) Dumxm ot4aleomoetasfaDrmums u)trerxo3iodlpte u s;t0t2uoimpiu4ol   icil(f rururono0aex ifetldlmDrl( pn()teermoctotfptraueo;s0 exriopoo1llenlnvs (faDur(mont0texoif3iys s2uau s;()tlenxo oatla  lu s;( setr(r3ou1olenmfvta(fa2umu pnu4opto o3tad m um( pnt)artrxf oo1op r u il()trto(r3oy4omt  fet s s2rr(moot4aee io3tlsla rlnvs u4tltnio ootlpDe u o;t0texoir iydlpt mivt (  rtrxrpoo0alenioetat aDrlums ()areoir oadfatrlu ol(0 2tmxopnydlp  livtas) 2umumooo0oee mf3ild s umnvpnu4texrif3iotfmD luvol()sexmio3oo1lme mivil(fa2um( o;t1tleo icilsfs2ea(mp;u4trtoxf oadopDe ies;t  2xmim oy4amee fcia(  2tmx  oo0altnmoctls a um(mp t4 rxrmrcoa1opD an o;t0s2um(mpnu1lpee iet s sDrmump;u0tltoifetldls2umn o;(4 ltnxo tytfp e ieils)seuoim3io4lptnmfei t) rur(  ou0alenmietyt mDel(vs;(4tlxoxfciytfmtrauei;s t2tmirpio4op  mivslt srurx pot4tet  f3iyd s2rl( snu0 rxomoctatfmD  ivslt0t2xmimpoo4lm n fei s  rur( onu1aptoioeiydls rm(mo;(0altrxfcta1lmtrliesls0srurir no4ape mfet s  rtr(r no4aet ioetlsfaDea( pnt0tltomo3iydfmteaivi;t0 rurim ny4lp emfvtlt sDtrxm oo1optnmiciasfaDumu s;u) etomf3totom eaiesls)t2xrimpoy4opte nesltf 2tr(rono4tlenmfeild a rmu o t0trtriocta1fatelivo;s s2tm(m3iudll  lnvia( arua(mpnu1tpe mfctaslm2el( on(0aeeoxr3iytomD aivs;(0t2uoxr iydoltn fvt (f 2tm( pot1aee  o3tatlm uauvp;u4aexomrcoytom e i i t0sexr(r3nodop n nvs tf Drrumono1apenmociyt m emn o;(4 rerif oy1lm elues () ruoimpio4opee icsls sDrrur ou4oexn feiad aDean s u0treoio3ootfate uvi;s0trtrio3iy1lp n nci s) 2umx  ;t4oee iieiasfsDrmu snt0aetnxf totoaDran s;t  2umxopoudomtemiei t  rrm(rp;o1apx mfetlt sDea(mon(0trxoxf io1fm   uvil( setr(o io1om nlieia(f ruau p;o0tlx ii3tysls eau o;u)arxnif totoat auei;s0 2uoxmpnu4llenmncsasf rtax ono1apenif3iasfm2eau snu4trxrxo3oo1omt  i sls)trum(r oydamee ivias sDumumo;u0tlen i3tld m rlumsn(4artrir3iatlateauvs s)s2to(o oy4lme mfvt s) 2trurp;t4tltnioeils a2rluvon(4trxnmo3oodomtrli i s0setoim3iodlmeemfvs ()sDur(ro;t1oexomietltls2ulnmp u0 ltoxf tatom eaies;t0t2trxmpnu4amtnlicslt  Dtaxr ;o1texnifciadfs2uaums u0aexomr3tatlpt luvo t) 2tmio ny4apee ictlt  rtru  ;o0aeeo iciadfs eaumo;(0aeeomf oadfate nvi;t) eurxm3nydam n netlsfa2umxmo;u4teeomieiytfs2ua(mo t0arerxo3iodlptr ivsl(  2ur(o3nu1apeemict s s2ta(mo;u1opxn ociltlaDum(ms;u0teeoir3oadop eli sls0teurxo3iu1lltn fetlt)arumumono1tee iictltfsDum( s;(0 etnmr3oytlm rluvol( truo(mpny1ll  livi s sruaur no0ope mfcildfa2umump u0 etoif3io1op elivo t0seur(r3iy1opte fvtls arrmx pno0oet  octaslaDum(ms;(0 eenio3tydfmtelu o s)s2xoxmpiydol  lietasf Dtrx p;t0tleomietydlaDua(msn()artomf3tadfpD aueo;t)setrxo oo4op  lnetat) Drr(rp;o4oeenioetaslmDrl(vo ()tltoir3iotfm  livol() 2xo(r3oydopt mfcs ( aDumx ooo0tet iociasfmDelums;u0 lxniociydomD lnvi;s srtmxopiy4lle lics (  Durxroou0tpx mocildfs rluvp t4trtrxf3tydfpD luvs;s t2toiopno4ap nmfes t srrrxm ;t0texnmictytfmDeanmo;u4texriocty1fpt aies t0 2tr(rpnu4lptnmfetl(faDrmx  nt1opeoiociat aDel(msnt0 exnxr iatfmte ues (0sexmxo oo4optn ivil(fs2ra(rp;o4apxnmi3iat m rlnvs;u)trtoxf todfa eau i;(0srxrxo oy1apenmics s)sDtr(  nt4ape iociydfa eluvo t0arxnxr iotfpD ln o s  rxmio ny1lmtemfesasfs2uau  nu4oexn i3iadfm2eaums;(4aexnmo iadla elieolt  2urxopoodoptelfctatfs2rrxro;u1aetn oetydfm rl( o u)areoxf3oodop  an i;t  2ur(mpiy4ame  fctls)sDum(  ;u0aex  ociytla em( p;u0arerxo iytlm elu s (0srxmxo3iudol  lnvtl(f Drm(m ot4olto fctldfsDuln pnu0texomr3oodomtrauvi;t) 2urir iydom nmnet t) Dtmx ono0apx micils mDemnvsn()arxnxr3oydlmtrln o t0 rxrxm3iydlpe lfcia()sDraxr no1olxniocildlaDemu o t4teeomr oatfaDe ivs;(0srurxo3iu4llenlfetat) Duau pot0apx  oeias s uauvs (0 lxrmo oydom  an o;(0trtoxrpiy4ope mfcta(f ruaxronu0openmieiyd s2ua(mpnt0aexoio3oadop r n slt tetmxopnu4altn fvilsfsrtrxm ;o1olxo i3tldfs eln pn(0 rxnir oadlp  liei;(0srxr(r ny4opte fvsltfarurxro;o4aleomo3tad mDul(mont0texrxr3ty1lm  luvs (  etrxm oudlpe mfetltf 2umxrono1opeo oeiytfm2ulumsn()arxoio iydomt livs;(  eumio3iudal   fcsa()aDuaxroot0altnmf3ilsfa2rm( pnt)trtnxr to1fm  lnvs;s)t2xrirpno4opt lfctlsfsDrmur ou4oeenifciysfs rmnvo;() etnif oydop elnvs t0 2xr(m3iu4al e ici s a2rrxr nu1aeeomiciytlmDul(vs (4 rtrmf ia1fmteanvslt  exo(o3ny4amtnlfeil()a2raumpou1oeeo fciyt s2eau o u0tltnxf iotfpteln o ( texr(r3ou1lle  fctls aruaump;t0tle mi3tlslm2ranvsnt)arxrxrciytlpDean il()tetoxopoy4lpt mfctlt sDua( pnt0alxnioeilt a rl(ms;()aetrxfciytop e n o s t2xrxr3iy1apen netatf 2tm(roou4tpe mfctydfmDea( s;(4 lxomo3ootom r u ilt  2tr(m oy1apt livilt)sDra(  oo1ale ifcild m eanvpn(0trtriocoodom e i ils0trtr(mpno4aptelnes (fsrtrxr ;u4alen i3ils s2uau snt) exnxfcoydopt  i s t teuoxo3nydll nlnvtls)arumx  nu0olx mociyd m2uauvsnt)artnxr iytomDe iei t0sexo(r iy4alt mfcsasfaDum(m no1tet mf3ild sDum(vs t0tltoxf3io1laDe u s;t0 rxoir3iudamtemnvt sfsrua(mpoo1aetnmoeildfmDrm(ms;u0treoir tytlp  luvo (0seurxr3oudlme  fvsas sruaumpnt0aeenii3iasfs ua(mo;t0arxnxf oytfa eanei;(0 etoimpiu1alt livsl( a2tm(  nu1olen fetyd s ua(ms;u0tltnmr3ootfa eaies;t) ruoir3ny1am nmfeilt) Dtmxront1oetomi3tlsla ranmo;(4aexnxo ootlpt  nvilt trxmxo nydoleemfvil( srraump;t0tlxn i3tldfmDrmnmp u4tltnmf3tydomtrlivs t0 etriopiudolenmnvias)s2ta(  ;t0texoifciysfa2ra(vsnt)arxoiocootfpDeau ol(  rxriopiodoptn iesls)srtr(mpot0aptn feiltls2elnvs;(4altomocoatlm rlnei s0 exmxm nu1al nmfes t)sDuax p;t1alt  i3tyt a2eanms () eeoioctydfmt  nvs;t0s2tr(m oo4lltemivia()aDumx oou4open iciys aDean p;t0arxoif3oytfmtraivo t  exoir oydoptnlnvil() rtrx  nt0oeenmociyt m2ea(vo (4aetnircty1fmDr uvs (0 2uoiopno1am  lnvsl(  2rmu  oo0oleo ieils a2rl(mp t0 rxomr3todfateau i t0 etmxr iudlm e ieil()srrr(mpnt1aee mfcild m eanvo;u)aetniocoo1fpD  ivs;t sexmio3oy4oltnlnvtl() rtmu pnu1tpenmo3iysfsDeanmsnt) lenioctadoaDrlu i ( trtrimpno4al nlfetat  Drr(m ou0aetomictls mDumuvs;(4trermr3oadfmt lues t0trxm(r nu1lle lnvs sfa2umxroot4oleo fcilslaDrmn o;u4aetomr3tytfp r i o;() rxmimpio4ap nmfvia()s2tr(r ;t1aetn oeiatfm2em(vs;(0 eeoxr3todoa e ueo t)tetrir3ou1optnlieilt aDumxrpou4altn icilsfmDelump;()trtnxociadoa r n i ()trtoio no4apeelnvi s) rtrxm ot4tpe  oeiydla um( pnt)trtrif iydlm  an o s)t2ur(m ou4ol   iciat)sDra(  nt1teto i3ils a2rmuvsnu4tlerif3ta1oaDe uei t0 2uo(o nu4al emfcslt) 2rm(rpnu4aex ifciys s umumpn(0 lenif3iy1fpte uei;t trxrxopiudlm n fvilsf Drmxm ;t0tlx io3tas aDulu s;t)aeerxfctatoateln o;s)trtmxo3iu4apenlncils)sDurumo;t1tex ifctatlaDean p;t4tlxoxr tydom raivi;(  rumxr oodom n ies t  Dumump;t4oetn ociadfa2rm(von(4aeerxr3to1lm rauesls)setm(opiy1ape  fes (fs2tmur nu1oetnmieiatls ua(mp (4 rxnxo3iydfa eaieo s)teum(opnudlpte nvtat  Dta( o;o1opxnmoeias s2rlumpnu)arxrmr oydoaDran i;()t2urxrpoy1apt lfci s s2tru p;u1oleomoeiys mDean o t4texomrcty1oa  aivsl( teuriopou1amtemfvsl(fsDuaxm ;o4oltnioeildls rmuvp u) rtomf iy1optrlies;t)t2toim iudal  mfvia() 2rm(m ;t0oexo f3iatfmDra(mo u)teenxociytlaD  ies;t0 etm(o3nudlpenlnesasf 2urx  nt1apeoiieiad s2emu p t) lxrmf ootfpt  ivs;s) rumxo3iodalt mietltf ruaurooo0olt mf3iytfs2em(vp u) rtomo io1oatr ieil(0 ruo(m iodom e ivt s s2ur(  nt4olt  oeiat a2emums;(4altnmf3iotfpt livs;s sexrir oo4al e ivtl(f Drru  ;t1aee  feilsfa2eauvp (0aetrio3iytlmDr ieo ()s2toxo3io1lm  lietlt) rtmxmont4tpxn f3iadla2emn o t)tltomo3iotfm   ivslt trurxm iudomt  neilsf Dum(m oo1tpx mi3iytfsDumuvp (0 etomf3tytla elivo () 2umirpoy1al nlfet t aDua(m ot4teeniictlslm2uaumo t4trenio ta1oa e ivi s)trumxm iydlmtemfetlt  Dtrump;o1tee  o3ias a2umu s (4aeenxrciy1fm  lneo ( trto(r3io1ap nlivslt s2tr(ro;o4aetomieias s ua(mo u4 lenir3iydfp elueil(0s2xoxr nu1lmt livt t s2tmx p;u0opt mf3ild s2eanmo;t4tltrxoctadlpt  u o ( teurxr oo4lpen fesltf Durumpot4apto oeiadfs ranmp;u) ltnio iatoa   n s t) 2trxrpoy4am elnvs t  2trxmpnt4oeenmocilsla2ulumsnt) eenif3oodfpDeauvols0trxrxr3ou1ap   nvsa(faDtru poo4tee mociasfaDuln p u0trtnio3oy1fmte ueo;t  eumir3ou1ap e netltfa2ta(r ;o1alen feiadlm2uln p t)altrir3ootla ranvs t0trxoimpno1amtelfeil(  Dtax oot0aex ifetad mDeanmo;t4aeenif3iatopD  nvs;()srxmxo iy1al emfvtas sDtau pot0alxn oeilt a2rm(mp t4 eerir ty1faDeau o;( t2xrxmpno4om nmnvilt)srumu onu0apxo fcildlaDuauvo;() eeomocio1lp  aivsl(0s2xoxm3no1opte fcs t sDua(mpot0oltnio3tadlm2ea(vp ()tetnmo3oadlpte ivs s) rurim oo4omt lncslt  2rm(ro;t0alenmfctytfsDrmnvsnu) eeoxo3oy1oateau s;(0 2xmxo iudomtnlietat)sDtmu ono4oexoio3iyslsDuluvpnt)tetnxr3todoat livo;t0trurxr nodamenmfvs t  rua(rpou1aexn fciadfm rmn pnu0 ltrxr3iy1om  anvslt) 2trir3ny4omtn nvi (f Drax pot4apxnmi3iatfm2ranms;() exnxo iodop rlnvsls  rtmxo nu4om  mnvils arta( pno4optnioctat aDem(vs;u4 etnxf ia1fmDr n s;t0truoxo3iodap nmiciatfsDumxmp;o1apx  o3tas aDumuvonu) rxomr3todopDraies;t0 rtrxmpoo1omte fctat  rrau  oo4tetomociysfs2uauvo;()texnif3iotfmt  ivsl(  rxm(opiu1lm emivi t srta(r no1aee ioeiydfmDumuvs;t0 eerif3io1omDeauvolt0 rxo(m ny4ape  fvs s artaumo;t4aeenmo3iat s2rlnvs (0 etrif3tydlp eanvol(0 eurio3oodlmtn ivtl()srurx ono1oet moetadlm uanms;t4texomr3iatfmt  n ols)trtrxmpoo1am  mfvils)srumumpnt4texomf3iaslaDumumo (0 rtoifcia1laDranvi;t0seurxmpiu4apte nct t)sDumumo;t0optnioctlsfm2eanmp t)tetrifcoa1fm  aneolt) 2xrxmpnydome micsat)artaxro;u1opxomf3iydlm2ea( p;t4 rxrmfctytfpteaieil(  2uoiopiy4op  lnci s)arurxmpnu4olt mo3ilt mDulnvs (4artnif3iotlp eluvil() rtoirpny4opt lieta( aDrm(mpoo0tleomo3iasls eluvo;u0arxnif iadfm r iei;() eur(m3iy1al  lnesls s2tmu p;t4aetn fciatfm uan o;(4areoxocoo1fpDe i i;t0s2xrxo3nudal  lietat aDumxmoou1tpe ii3tasfm eanmp;u)trenxo3iotoaDranvils)setoim3io4aleemict ( aDrrxro;u1optomfeilsfa rmn ont4texnxf3ia1fmDeln ols0t2xmxm iy4ol elncil(farua(mo;u4ole mf3iatlsDum( pnt)aeeoxrctatlmD lnei ( seurxrpnu4lmenmicta(f ruaum nu0tlto ocilslaDrm( onu4 lxrxf iytop eln s;()s2uo(mpiy4ap e ietls)a2tau oot1tle mi3iyd s rmuvsnu)tetoxo totopD anesl(0 etrxm oy4al   icsat) 2uaxmont4tptoifcild a2elnvo t4 eeoxociytlmDrlieolt0sexoxo3oudlp n fet (f rtr( poo1tpe mieiasla2rln p (4 exoir iadopDrli ilt)t2ur(r3iu1om  lfctl(f Dtrxmonu1alxnmf3iad s ulu s u0aexnmrcoy1omtr u s ( t2toxmpiydoptnlneslt)srtmumoou4aleoiociltls umnmsnu0aleoxfciotfpDrauesls0 rtrxm iy4amt lfct s  Dtm(  nt1ole  o3iatlmDeaumsn(0trerio iatfpDrlnvo;t)s2to(m3iodlltn neia( aDuax pnt1opxomfetys aDea(mpnt0alxoir iytla   nvsl(  2xr(o3ou1lpenlics t s2raxr ou1tlx io3tat mDrlnmp;t0alxrxo3oytlm r ivol(  eto(rpiydolt mneiat) Dtax pno0oex mieils aDemuvo t0 lenmf3oydfp  ai s;s0 2uriopiydape lfvsltfaDumxrp;o0tle if3iasfm2rm( p () rtnxr3oa1lpt  iesls)srxoio3iy4altnlfei tf rtru  oo1opxn i3iysfa eluvont4 rxoir3tydfm  livi;()t2tm(mpny4altn fvils)arrm( p;o1opt ifeild s ra(mo u)tetnircoy1omDelneils s2tmirpiu4lmte feta(f 2urxr ot4oexoioeiydfaDrauvon(0tltomfcta1op rauesls tetrxo ny4am nmietl()artrumono1tpeoiicildlm uaumpnu)trtomo3oodfp   u ils)trur(o ou4lm  lfcilt a2uaur ot0tex iietysfsDel( p;t0trenifctatfp rluvo;s0setrio iu4aleelictas  rurx  ot1oeeo oeiytlm2ea( o;u4 lxnif3oatop   n i s  exoir nydalee icta(  rur( oot1tpe ifetadla rln o;u4tleoir oy1fmtrai o s0trxrimpiy1omtnlict s) ruru o;t4opxnifctlt s umuvp () eerir ta1fpt aivsls t2umim iodomtemies tf rumxr ;t1aetn iciasfs2umu p t) exrmfcia1fpDe u ol( seto(r ny1ll nlicsltfaDua(  oo0tltoio3tltfm eauvo;u0tltoif3io1fm  lieils)t2um(r nydoptemnctlsfs2rmx ono4olenif3iasfsDeluvp t)tltrio3ia1la ranvi;s sruoio3oudlmtelictls artaur nu0tetn ietydfa2um(mpnu4trxrio3to1lm rlues;t  exoiopiydol  livils srtm( pnu0oet  i3iat s2uaums;(0trenxocoy1fmDe nvo;t sruo(m ou1al  mncias)sDtaumpno1tltoiociltls2rmuvont4 renxrcoy1fp  lieolt t2tr(opnu4lpenlivsls)aDur(r ot1olen fetas s ranms;(4 rtnxo oa1la rauvs s0trtmiopiydol e fcta( sDraxmpot0opxoiicils aDuauvo;()teerio3iadfm ean olt0s2xrxm iy1alenlncia(fa2trx oou4texnifeiltls rm( p;t)tltnifcta1lm  lu ol(0t2uoiopnu4om e nciasfa2umxronu0tetoiieilt a2ulnvsnt0aexoio iatlm  ai ol(0srumim iudlpee fctl( s2rmurp;u0tpto ieiltlm ul(mo;(0aeeomr3oo1op rli ol(0texrio3iy1lptn iet sfarrru o;u4oeenmfciysfaDrmnvsn()arxnmo3oo1oaD auei;t0 eum(r io1ap elfvs ( sDuaxm ;t0aleomocildlm2ea( o;u) etrmr3iydlateanvi;s)s2xmio oodoptnmfctl(f Dum(ro;t4tlx  i3tyslm ul(mp;(0aeenmr oadom elnvo;t)seum(o3iodamee nci t aDra(m ;t4apxomoeiyt sDuanmont)arenmr3oodfm  luvs t0t2xm(opiodlmeelivils)sDuau o;u0tlxomieiadlm rluvpnt4tltrmf3tadfmDe ivs (0 rxm(r nu4omtn fvslt) 2raxmooo1olxo f3tad s2rm(ms (4trtoioctydlm  anvils)trtoxrpnodlmeelfcslt)arraxr nt1aexnifeiyt mDelnvsnu0 lerif3oatlaDeanei t)s2uo(r ou1amt mncs ( a2rmurp;o4tle  o3tls sDulu p () ltnmo totfa  lues t setmxm nydaptn nct t) rurxroot4tptniiciadls rlu s;u4 etoxo io1fpte nvo;s) euo(rpou4ame  ivtlt)s2rr( poo0ole  o3taslm2ua(vs;u0 rxoxf oodfp e nvils0 rxm(mpio4ll nmicsl(  2umurooo4ale  iciydla2ua(mpnu4aeeomfcia1op eli o ()srum(o ou1ape mfvtas)srrmxronu1aetoiicias sDemn s;u0 lxrmr oo1oatrli s s0teum(o3iydole  iesl(f Durxr ;o0tltn i3iydfm ulnvsnt0arerxfcta1lpteanvi ( tetrimpoy4ll nlivi (  ruaurp;u4texomietydfmDrmu pn(4trtrxfctadop rlu o s sexoio3oy1omtnmnvtl( sDrr( ooo4aleomocild aDemnvo;u)texomo3iadoa  livo t0 rxr(o iu4olte fvslt)srta(m ou4oltomo3iytla rlnvs t4tleoirciatlmtrauvo t srumio3iu4apt lnvsat)a2umu  no1oexo iciytlmDrm(vs t)teeoxfcootfmD auvil(0s2xm(m3io1lm   ncil(f Duax ono4tlxoif3iytfaDrlnvont)altoxo3ia1fptrluvilt)truo(m io1omenmfvslt) rur(m ;o0opx mo3taslmDrluvon(0 rxrxr3io1la   u sls0trxr(m3iu1lmtn ncsa( arrau  nt4apxoifciydfm rau ont)aleomr3iydoa eluvo () eum(m3iy1lp e fvils sDrrx pnt0tlx ifeiysfa2ra(mp;t)altoio iytomtrai o t)srtrxo ny4ameemnei (fsDrr( onu4tlxn ieiltfa2ea(vsn()alxrxf todlmD  uvi;t srumxr ou4al nmfvsa() 2ta(r ot1openmoeilsfs emuvpn()tlxrir3iadfaDranvilt) 2trxm3nu4al  mnvtl()aDua( ont0alenmfcildlaDem( p;u)tlxnir oo1lat au o;( sexmxopiu4omenlnvslt  rtr(  ot1tee  i3ils a2ea( p;t)aeerxo iydopteai o s  2umxopny1lmeelfeilt s2tm( pnu4aee mo3tldlaDrm( pnu4artomrcty1faDelnei ()s2umxm3nydlltelivta(fs2tmxrp;o1tlxn octat a2rl(mo ()aleomocootlatelieol(  rxoio3oo1op nmnes s)sDurxrpoo1aexn fciydlmDul(vs;u0alxoxr iy1opte nei;()trxo(m3io4lp n ivilt sDrmur ;u4opto feiaslm umn on() lxrmrcto1omDeaueolt  2to(mpiydalt lfvsasf rtmxmpot4tlxnmo3iltfaDeau ont)aetnxr3to1laDrln o t0srumim iydapeelfesltfs2um(mono4alxomfctld aDuau s;()tlxoio3io1op rlnei ( seuo(mpiydolte fcils)sDtax o;t4tpe iieiyd sDemuvs;t) exnmo3oo1faDe ues s)sruo(r3io4opeelfeilt s2ur(r nu0aex io3ild a2rluvo (0teenxo3oodlmDrauvsls0texm(opno4omee fcils a2tmxmo;u4tptomf3tltls2rl(vpnt)teeoircoy1fat  ivols0s2tr(rpoydop emnesltf rtaum nu4apxnifciytfa rlnvo;t4tltnifctatfm rau i t)srtmio iydlmenlncia(fa2trxm no4olen o3iat s2ua(ms;(0alenmociy1oateaneo;s) rxoio3io4altnmfetl(f 2rm( poo1oexn o3ilslsDua(vonu)artrmf to1lmDelies s0 etoirpnu4om  mfetatf Dur(mpno4oleoifeiyd aDemuvs;(4 exomr3oadfm rluvils0 eurxo3nydlmeemnes tfs2tmxrpnt4oetniietyt a2eanvpn(0trtniociytopD  nvo t srto(opou1lme mfvias)srtauront1aeeomi3tysls2umuvo t4texnmr todfpDr uvo () eur(m3io1optn fciat sDumu  ;o0tlx ifcilslm el( o;()artrio oodfaDelieols t2trxopiy1lmtelivt s)sDur(m ;u0tpxoiieiyslmDem(ms;()trxrmr ootlmDr i ils0tetoxr oydaptnlfci () rtax  ;o1tptomo3iasfm2rm(vpnt4trenxr oadom eanes t0trurirpnu1ame lnes tf 2rrx  nt1oexnioetad m uln p;t)teeomfcootlpDrli o;s)t2to(o3nydlltemfcsltf rraxrpou0alen iciys mDeln pnt0tetrxfcoo1lmt  nvs s t2urxo iydal emneiasfsrrm(rp;o4oltnii3ildls2rl( pnu4 ltrxr tytlatrli i;t0 2xo(m iy1al e ivsatf Dtax p;o4alxoioctat m2rau p;t0 ltnmo oatlpD aueolt0t2uoim iy4lpeelnetls) rumxrpnt0aeenifciyt m umumo;()arxomr oy1laDeln i;()t2tm(r nudop emietas  Dtmx pnt4texn i3iys s2elnmp;u0aetnxr3ta1opteau i;s0 exm(m iy4lmtelfci t  Duaurpoo0aet  f3iysfmDrm(vs (4arxrxo3oadfm elnvi;( seurirpnodap e fcsa(faDumu p;o0opeo i3tatfmDraumo;t4artniocty1op eaieo;(0 rxr(mpny1om nmiesa()sDrrxmonu4oexo oeiadls um(vp;u4 etnxf3oy1oaD  n i;t  ruoxo3oodll e fcta() 2rru  no1aetomiciytla2uaumont0arxriocia1fmteauvo t)srxmxm3oy1ope  fcta(faDta(roou4tpxn o3iat aDuanms;u) eermf3oadfp elnvi ( tetmio3nodll e nvi sfa2uau p;o0texniictydfsDrm(ms;t0tlenmf tatlp   i i s)s2tm(opnodomte ncslt)a2rau  ;u0opeomo3iasfmDrmu p ()tetrmocoa1fpt  iei;t)t2tmim3ny4lmenlnvt s s2rrxmpno4tptnioeiadfs2umn p (0aeenmr iy1faDe u i s0 ruoiopny4apt  net tf 2rm(mpnu0tpt if3tldla elnvpnt)artrmf oa1lmt aivs;(0 etr(r3no1lltn ivsas s2urx  oo4oltoiociatfa2rmn o;u)alxrxrctatomte nvilt0 2uo(rpoy4lpe livi t  rtm(ro;t4tpenmictld m2uan s u0arerxf3oytfa  an s;t0srurirpno1aleemnctlt)srua(mp;u4tpenmf3iyd s em( p (0aexoif totla  aivi;t  rtm(m3oodale  ivtl()arrrum ou0apeo feildls2rl( s;t)arerif3io1lp  luvi;s setoim nu4opte fesa() 2rm( o;o1tpe mieils s2ea(vonu0 rtrxo3oodfmD au i (0 etm(o3ny4ll nmiei (fsDrmxr nu4ale  i3iytls2um(mpnt0trtrif oatfpD livi t  rxr(r no4omtelfctlt arrmxmp;t0altnioeiytfs2em(vo u4aetoir3ta1lmtean il() rtrim iu1omtnmiesat) Dua(mooo4apto o3tltfaDemn s;t4tltoxr oodlaDeauvs;t)trtmxopiy4amtn net () 2rrx  nu4oltnmietydls2umnmp (0aetnircoydfmDeaneilt srtr(o oo4omtemfvs t a2rrur nu4apt  oetls s em( p;()treoxfctatfmD  u ol( srtmxo3iodlmtemnvil(fa2umxm ;o0ope ifciydfaDran ont0aetomr3tydomDelnvs t  etoirpnu1altnlfvilt s2ra(mpno1texo ieiltfmDulu o (4 lxrmocoatlpteaieol(  rxrxo3oy4op elics sfa2taurpnt4opt  i3tas m ul( o t0aexnmfciytfat aueo t0trumxr3oo4opt lfeiasfarrr(rpnu0tptoioetys a2ua(mp;u0altrio3oytom rlieo (0 rxmiopnu4oltemivtltf Dtmxr no0tlxoif3iat mDuaump;u)arxomrciytoat li ilt0srtrxr3io4al elicsls) rum( pnt0alxomiciytlaDrlu ont4aexnxr oodop r nvs;s0srxmxm3oy4lpe mivs (  rum(rooo4aexoioeild s2rm(mon(4artrxfcoatop eln o t)truoxrpou1opt lici ( srrm(mo;o1oee io3ias mDemn s u)alxoxrcoadlaDe i o t t2urxmpny4alee fvils) 2ua(rp;t0tpeomo3iadfs elnmpnu) eermr oodoaDeau o (0 2um(o3oy4llenmicsls)artrur ;u1apen fctysfm2ea(mp t4tltomrciadoptr nes s0 exrio iudol e nvt t s2rrxrpoo4alxnmicils a uluvs;u0tetoir iytlmt anvo (0seurirpiydol  lfesat) 2ur(mo;t4alxoifeiadls2emnms u0 ltoxf3oa1opD aues;t)trxrim3oo1amt mneilt  2rmxr ot4tpen oetysfa2rmnmo ()tleoxf io1lpt luvs t0 etmxm oo4olenlfvtl(f 2urumoot0olxomfeiydfm rmn p t0texnio oy1lptran ils teto(m no4alen fvtl(f Dumxm ou4oexnmietat sDel(vs u0arenmf iotlm   i olt  rtrxm oo1lpenlfvsat)srua(moot0ape ifeilt mDrau sn(0tetrif3oodlate neils)texo(r3oy1alenmfeilt)a2uaum nu1oexnii3iasfs2emuvs u4aeenxr oodopD  ivol()srum(r no4lpeemnes sf rraxmpnt0tex  feias mDulnvp;(4tetrmocia1fmteau sl( setm(m3oodomte fcsasfa2taurono1oeen o3taslmDeanvs (0arxoioctodfm  li ilt0s2xoxm iy1amt liet (f 2ra(m nu4tex  iciysfa2rmnvs;(0areomr3to1om  li s () 2ur(rpny1lmt  feil()artr(mpno1tpenmieiytfmDrlnmsnt4 etrxo3tytlaD ln s;s0trtrxm no4ome lnciat  rrmuroou1tlenmieiys a rau pn(0teenxr oytoaDelivo s) 2ur(m3iudale lieiat) Dum( oou0tptoifciydfs2eln s t0teenif3oa1lmDraiei (0 rxoio oudlm nlivtls  Drrx  no1tlxnmo3iad a2el( p;(4alxnir3iytfaDraies;s0t2to(m3no1lmtn feiat)aDtruro;u1tltoioeiysla uan p t)teeoxf iydom   u sl( seurxo3nu4lp elivi t) rraxr nu1texo ocilt a2rln p;u4tltrir3oadfmD ai ilt texr(r3iudol   fei tf rra( o;t0tpto ieiadfs2eau s;t4texnir3io1fpt ln ilt0 rtmxm3oodaleemneilt artrumpnu1apen f3iydfm2el(mpn(0artrxf3tydoatr nvsl( srum(o3no1amtemncslsfs2uaumooo1opxnifeiltfm eaumo;t0 lxrmf iatom  auvs;t0 euoimpoodape  fvsltfsrrruront1tpxnifcils m2rauvont)tetnxr3tydfm  luei (0 2toio oydlpenlivilt sDurxm no4aet  o3iys s uanms;(0teermo3oytfmDrln sls)seur(o no4llenmfctlsf Drmx  nu0oeeomfeiysfa2rauvo u4altrio iy1fm  lnes;(0trxo(mpio1lmee fvta(  rumxrono1tleomfetysfm2emnvp u4artoioctotlmte neo t sexoxm oodopeemfes s)sDrmump;t4oeeo f3iytlm emn o;t0aleoircto1fmDr u s t)trtmxr iu4al elietls) 2ua(  oo0opxomi3tlt a uaumo;u0alerxocoadopt aieol(0 euo(m3oo1om e nvs s s2taur nu0alx  ieias s rmuvp u0arxomo3ootfm r u ols0seurimpnodopte iesa()sDrrxm nt1tetomocils mDea( p;u)tltrxf ootfmtrli sl(0seto(m ou1oltn fcsasfaDurumooo1tpx ioeiydfa2eauvpnu)trxoxr ootlm ranvs s t2to(m3iu4altn ivt s srumumo;o4apt ifcildla rlu s;()alxnmfcty1fate iesls trum(m ny1lltelnctlt  Dtrxm ;o4aetnifciysfs rmu s;u)texnxo3iatop  ai o;t t2xrxr iu1opt  fctltf 2ra(m nu1aexnioetlt m2uanvon(0alxomo3io1la e n s t0trxmxo3oy1lle lfes sfsDumxro;o4openmf3tysfs rl( s u) lxoxo to1oat aivsls setm(o oy4optnmies (f Dtmxrooo0oexnmfciydls rluvs;t)alxnir3iotlmtr neolt0s2um(r oodome  nctasfa2ur(monu0oex mo3iyt m2ea( s t4 eenmrcootlp r nvo s s2tr(o iydamtnlncsls)artrxr ot1tpeoifeiydfmDumumpnt)texrxrciatopD anvi s0trum(o3iu4ll emfet s  Drm( pnt1olx  f3tltlmDuauvp t4artrxr3ia1fa ran ol(  ruo(m nu4lltn fctls)aDumur ;o1opeomoctytla2em(vs;t) rtomf3oadlptr n olt)s2xmiopiy4lme lfcslsfsDraxrpnt1ale mietyd sDuauvs u4 exomrciadfp eliei t0 eto(o3iu4am nmncta(fsDtax  ;t0aeenioetadls rlumpnt)altoxrcoa1lmt li i t0t2xoimpiu1al  miesl()s2rrum nt0alxniiciadlsDel( s (4treoif oa1fatrlnesls0 2umxmpou4ope lfes ( srtrxmoou1tpxn feiltlm um( snu4trtnmfciytop eli s ( trxoiopiu4lle  iesatfa2urxmpnu0tlenmo3iasfa2el( p () lxomr totomDe ieo;s0t2xmimpiy1ap n nvsa()arumurooo4apt  oeildfsDranvpnu0altnxr ootomDrlneo;s0seto(opny4lm nmnctasf 2trur no4ope moetltfm eaums;t0aexoir3tydlpt ai ols  2xr(mpio1ale  ivtltf Drm(mpnu0alxo oeiys a2eau s t)treoxf totfaDeli i ()teto(o3iodlm eliesat  2tmu pnu0tpt mo3tytlm2uaumsnu4teeomf3ty1fatrai ils0srtoim3oy1lm elnviat arumx  ;t4texn fetatlmDuluvp (0aexomo oo1lmDranvs s0 rxm(m3ny1ole lics tf rtaumo;o1tpeniicilsfaDua( p;(0 rxomf iytlaDeaivi;s0 exo(mpoy1lm nmfesls)s2ua( oot1tex  o3ias a rl(ms;(4tlxrmr oy1fmDr nei s0 2toir3no1apenlfeilt)artrxrpou4opt moeiat s ea( snt0aexrircoy1fmD au ol(0t2trim nudamtemivil( a2tax ono0oet  ieiaslsDum(mp t)texnio3tydomtr i s t0 2toirpoo1ap elfesltf rtr(m no1optomietytls2ul(vsnu4tltrxrcta1omtr iei t truoimpoy1lmt mfetls)aDrauro;u1opx mfeiat mDumnvsnu0tlenxo3iytoate ues t0sexmim nodape lnetlt)aDumxroot0optnio3ils s eanvsnu)tlxoxoctydoptelivsl( srxmimpnudll emfct ( s2tr( o;t0altomicilsls2rluvs t4 rxomr totfmte nvs;t) rxoim3ou1apt  ivsl()aDrrur oo0tpt iieils aDrmnmp u0trtrio oy1oa ranvil(0s2xm(m3oodap nlietl(fs2ururpoo1optnmoetaslmDea(vo;u)tleoxf todoptrln i t) rxoim nydom  mfeias)a2tm(mpno4apx  i3tat m rlnvon() eeoxo3io1fa eluvs;() rurxmpnu1omtelfvsls aDrmxmpoo0oleoifctadfsDumuvsn() rtnir3iytlm r i s;t  rtr(r3nodame mnesas) 2urx  oo4aetomoeiydls eaums () rermf oodfp raies ( sexoxm3iy4ameemncia(fsDtmxm nt1tetnmoeilsla2ua(vs;() lenxr3oatlm ran sls0srurxo nydllteliet ()srtau  ou0alto ieiltfaDulu s;t0trtoio3oytom eli i s0s2uoxrpnodomenlfes ()a2taumpnt0apxn i3tad m ua(vpnt0arxrxr3oydom rauvil(0srxrxmpiydal nmnvs tfa2um(mpot4alxn i3tlsfsDrluvsnu)arerirciydfate n ols0 2uo(opnu1alenmfcs (fs2tmum nt4aetomi3ils a2ra(ms t4altomf iadopDrln s;(0trtoxm io1alen nvi ()sDrau  ;u4tlxn f3tys s2ua(von()alerxf iydlmDelu o (0srtr(m no1ol emfcs () rtmxm ;o0oltoii3ilt mDel(vsnt4trenmr iodomtr ivs;s0srtmxopiodomtn ivsa( s2rrxm nu0oeeoiieiat a ulnmsnu0arxrmf iadfp eanesl(0s2urxr oudapenlncsls) Dumurpou1apxoioeiysls2emums;()arxnir tatfmDe n sl(0truoim3ny4al  mnetasfsDrmu oou4tpt mi3iytfs2ua(mont4 exnxf3ta1fmD  ieo;s0sexrxrpoudlle  nctls)s2ur(rp;t1tpxo fcias m uanvo u4aexrmr oadop   n ils)s2uo(m iudapee fvt (farur(  nu4ale mociydfmDrauvsnt)tltoxr oa1lpD livols0t2toxrpoo4apt livsat) 2uaur nt4tleomo3iys m ul( s;t4trtnxrcoy1fat lnesl() exoio3iodameemicslsf 2rmu poo4tptomocild sDelu s;t4alenifciotfmDrlueo;() rtrxo3nu4lmt lfcsat)sDtau  ou4ale mfeiltfa um( o u4aetoifcoadlm   iei t0s2tm(r ny1al n fviat) rtmxmpoo0apx ifctydfmDea( snu)alxriocoa1fmteanvi t) rum(m3iudole lfcs t  rurumpot4tpxn ictyd sDuan snt0 etnif3tytopDelivo;()trxmimpoo4open fctat)sDuaxr no0oleo fctlslmDrmuvo;u4trermo ty1laDeluvo s seumxr iu4lptnmfci ()srrrum nt4opxnmoeiatlaDulumo t0arenmrcio1fmDeauvo s  rtmio no1ap nlnes s srumxmoou0tlto oeilsfa ea(vont4trenxocootlatelnes;s)texrir iydoltemnctat sDta(rpot4openmo3iytlm rau pnt4tlxrxf oadoaDe ivolt0s2xr(rpoy4lm  mnvilt s2rau oot1texn ociysfs eaumo t)trenxf iadfaDeli o t t2xr(m3no1ap eliesas)srua( ooo0oeenifeiyd sDelump;t0 lerxr3iytomD  nes;s) rtoxrpoy4ame  fetls)sDraxm ;o1oexoif3ils sDelu s t4aexrmo3oodopDrlu o s teuoirpoydop nlicslsfarrax o;u4tpx ii3iadfs2rlu s u0aetnxr ty1fpt auvs t)t2toxm3oydal   nct (fa2um(  ;t1ope moctlsls2rmumpn(0 exoxr3oydopte ieo;t sruo(rpou4al emfcilsfsDtmu o;u0ape mi3iltfaDrmn p;u4teeoxocoadlm   i ilt0 2xmim no1om nliesls)srrmxmpno1alenmf3ils m eanvsn(4teeoxr oydom  livil() rxo(r io4lmeelies sfs2trx  nu0aptoii3iasla2ul( s t0 etoir3ta1lp  ln o s  2xoio3nudap emfctas sDtax p;o0tex  fcilt m2uanmsnt)tltrxr3oodlpDeau i t sexrxm no4amt mncilsfs2uaxr nu4oleo ieiasfs2emu o;t0alenxf3oytfaD lu o t0srtr(rpnu4lmenmnciatfsDurxm ;o4tlx mociyd aDeluvs;t0alxriociydfpteliei;t0trxmir3ny4olt  fcsat) Drauroot1alenmfciyt s2uanvonu0 etrmfcoo1lpt lues s)trxoio3io1lm   iei s  Dtrxmp;o0ale mf3iytfaDrlnvo (0teeomf oy1fptraues ( s2toimpny4lme liei tfa2ta(ronu0tpxniiciyt aDuln p;t0trenmr oodfmtrauei s0 ruoiopiodlptemfci tfa2uax  ot4tee mfctatfa uanmpnu)texrmo3iytfmt ai s;t t2toir3io1op nmneia(faDumx oou0aexn icild m uau s (4 ltnxr3todfat  neol(0setrimpoo1ame lnctltf 2tr(root0optomieiadlm2emums;t0 exnmr3oytfpt  ies;t seumim ou1ole  feils  2tr( oot0aexomo3tys a2eaump u4 rtnmf oatfmD an i ( trto(r3nu4lmeelfcsa(f 2uax  ot4alxoifciydla2ua(vs;(4teeoir3totlate n ol(0trtm(m3iu1omeelfcs t arrmumoot1altn i3iltlm rmnvpnt4alxrxf3iadlm elneo t)texmimpnu4omtnmieia( sDtmur nu4teeoifcilsls2ul(mp;u)trenxo3todlptr u o s0sruo(r3ou1lpt  ivsls  rtr(mooo1tee  ociat m2emu p t)trtnif tydlat lnei t0srur(m3oo1lmeelfcils)sDururono1tet  fcias s2ea( s t0aexoio3io1fmDrlu s t) etmim3nudam emnvtlt)s2tru pno0ale ifctadfsDuaumpn(4tltrif3oodlp r ueilt  2xmio3nu4lmtemneilt srrax onu1tpt mociatlm uan s;() lxomr3oadlp elnvi t0 2uoirpiu4open ietasf Draum ou0opt mocils s rlu s;u0artnmfcoo1fptranvi;(0 etrim3iy4lpe lnvi s  2umur oo1alxo fctyd m2ua(vsnu0artnioctadfptrlueo ( trtm(o3ny1ole  nesasfaDta( o;u1alxomfeildfaDemumpn(0altomr totlat lnvo s0 rtmim3nudol nlnetltf 2rrum ;u0olxomi3iys aDra( snt0arxnxf tadop eauei;s)t2tr(o ny1lme mfes s s2tmu pnt0oleomo3iyd a2um(vo;t) lenir ootop  ln o;( setrxr3nydoltnlfvi t)arra(mpno1ope io3tltlsDea(vo;t4aeeoirctotlmDrauvo s0 eur(mpnudopt lfvi t arrmur ;u4oeenmfetat m2eluvp;(4 reoio tatfmDe ivs;t0 2xm(mpnydam e nctlt)a2tr(  oo0tpto fciytfmDeauvs t)tlxrmocoodopD lies;t) 2xriopno4om eliesl(fsDrr(ro;o1optnmieiyd aDea(mo;t) rtrif oo1oa rln s t  2uoxo3io1omtemietl(  rraumpnu4olto ocilt sDulumpnt4arxoif3oatfm e nes;(0sruoxr3ny1lmte ieiltfa2rm(  ;u1alenmo3iasls ra(vp;t)artnxr3tytfmt  i i (0 euriopny1aleelivtlt)artmxmonu4opxnifctysla2umu on(4texrir oytomDean i;s0t2xmio ny4al nmfcs sfa2tr(moou0apeo ieias mDean s t) lxnmr3todoaDrlnes () eurimpno4llen nesls)aDum(m no0opxnmociys a2raumsnu)arermf3tydoatelivslt0 euoxmpno4lmtemnesat)sDta(m nt4tlxoifeildls2rln p;u4trxrif3totfm  ai sl()truo(opou4ll n fei t s2rrum ou1apxomi3iysla rl(vp t0artnircoodoa r i olt srxmiopiodoptemfvil()srtr(  ;u4tleoifciasfmDemu o;u)aeenxf totfpteliesl(0 2xrir3iy4lm elfeia(f Duau oou0tet if3iltfsDrl(vp u)aeeoxr iatlp eaneils)t2toxm3iodole  nvi tf Dtau oou0opeomoeiydfa2elumo (4 rtoio iotomD lueslt0trumxrpoo1altelfvtat a2um(rooo4olxoii3tadfm2ua( on(0 lxrio oytlaD ai s ( tetrirpiudole  nvsa()aDrrurp;u0aet  ietydfs emnmo;()alenxo oytop   ieol(0 rtr(o3oy4omt livtl(fa2trxr no4tle io3tatla ua(vs u0altnxfcoo1faDean ilt)tetoxm no4op nlncils  rra(mooo4tpe iictydfs eln onu4 etrxfcoytfa  lnes;(0 rtoxr no4lmeemneiatfa2tr(mp;t4olx mfeiadfa rln pnu4tlenir3ty1faDraivo;s)s2xrxr3nu4lm nmicsasfsDrm(  oo0olenmo3tasfa2ul(ms;u)texoxo oadopD aieols0teuoxopou1am emncsa( aDrax o;t1tee ifetasfs2em(vp u)arxrircoytop  lneo;s)trtmxm iodolenmictl(  2rm(r nu0aet mo3tysfs2ua(vpnt4arenircoodop  lnes;() rxoio3nu4ll  lnci t)artmxro;t1aptomfeildfa2rmnms t4trerxf3iadfaDr i s t0truoio3iy1ap emies t)sDrrxro;o4oetnmf3iadfa2eaums (4altnif oa1oaDean s;t)seuo(m3oo4op e nvtlsf rta( p;t0apeo f3ild aDumnmp;(0 eerxf ta1lpt livolt tetm(m3oo1llenmncil() rraur oo1ale  o3iysfs elu s t)aexrxo3iodfaDr nvs t srumim ny1olt  nesl(f Dumxro;t1tlxoiicilslm uauvp;u0 rtrmr3ia1oaDraivs;( t2uoxo no1ap  mfcs s)a2rrumpno4oeeoifeias m umums (0areoir ootoptrlnes;t0teurxm no1aptelicilt)srraxrp;u1optnmfciatfs2ul(mp;(0aleoio3io1fpDraueolt0s2uoir3iy1olenlieil()aruaur ;u0aexoiiciasfs2uan s;t)tltoxrciytfpDeaneo;( trumim3oo4amte fei (f 2um( ooo4aee mi3iltla ra( pnu4arenmr3ootfp rluvi (0t2umxo3iy1lpt  ncsls) 2urxronu1oeto f3tatfa rlu onu4aetrxr oydlm rau i;s0 2uoir nudlme mnetasfsDua(m ;t1ole ifetys m ra( p t0trtnmo3tydoat  i s;t srtoir iydlp n fci () Draxmpoo4tptn ietyt s2ulnvont)texnxfcta1lat ln o;t0t2uoim3no4lpe  ics s)aDumxmpnu1oet mictytfm rl( p t0aeenxr3oytfmDraueo;t0 rtr(m oo1lpt lfvsl() 2tr(rp;t4tleomoeiat mDum( o u)texnmrctydla rlnei s)srxm(rpno1amenmfvi sf rtr(moou0oeeomieildla el( p;(0aetoxoctatlp eai slt0 rtmxrpoo1amen nvsasfaDrau  ot4opxo i3tat s elnvp t)artnmrcoadoaDran o ()setoir3oudal nlictat) 2tr(rp;u4texniociadfaDean s;t)teeomfctotfmt auvsls0trum(o3nu4ame mnctas a2uaumpno0oltomictytfs2rmn sn(0 etrxfcty1omtrln i ()s2umir3ou1lmtelivt t)artr( oot4openiieilslmDrl(mont)alenxocoy1lpDrlivi (  rtr(r3no1lmtn fesl()a2umu poo1ale mfciatla em(vo;t4alxoxf iytfm  lieols  exmxm3iu4ll n fctlt) Dumur ou1oeeniieild s umuvs;u)artnio ty1fatelivil()teurxmpiodlp nmnvs (f Draumo;u1aptnifeiadlmDean sn()alenio3tydfmDeai il(0seurxr3ny4ape lieiltf 2rrx  ;u1apx  ieild s2emums t) eenirciotlmDrauvi s)trtr(rpno1lp nmnet () Dtrum nu1aexomoeiydfa2rl( pn(0tetoio3oadfpteauvo;( t2um(opio4al nlnetls srrmxrpoo1ape moctltlm2ra( p;(4aexnxf iodopDeln olt0teumxr3ny4am n iesasfsDra(m nu4oeenmfctytls2rlnms (4 etrxo ty1lp  an s s) 2um(opou4lleemiet tf rrauront4aee if3tatlsDel(vo t)aexniocoydomtranesl(0s2xoxm3oy4ole micilsfaDrmxmoot1oex mo3iysls uanmon()texnxr3oodopDeauvo;(0 rtm(o no1ll  lnctatfaruaum no0olx ioctadlmDrmn s;t0aetnmo iotfp   ivs s  rxmxo ou1lp n nvs (fsrrrxmpou0altn f3ilsls2rau onu0treoir iodlptrluesls0teuoim oy4ll e ncsatfsDuaxmonu1olxnmoeiad mDra( ont)trenmr oy1oate i i;t s2xoim3ou4alteliciasfs2tm( poo4ope ioctltfa2ranmo t) leomoctotom  ln i;(  2tm(rpoydal e neias aDrmum nt0aeto o3iytls eln o;t4artnmrcoy1oa r ieslt0teur(r ny1opte nvil(fsDrmxmo;t1aet mf3iadlm ra(vs;(0trxoxrcoo1oat liesls0 rxr(mpiu4openmictl() 2uru onu0optnmfeiysfmDumu o;(0 exoxf3ty1fateli sl()srurxo nu4ome mfvs tf Dumu oou0openmi3iyd m uau snt4 eenmo ty1fp e n o;t) 2trirpoudll  mics (fs2umxr nt4oetnmoctlt sDulnmp;()alermr3iodfpDr u o;(0texmir ny4am eliciltfsDumxm ot4texoifeiytfsDean ont)tlerxrcoatoateauei;s)trxmim ny4omt  fcs s) Duaumono0optoifctadfs2eanvp () lenir3ta1omt lnvs t0setr(rpiu1olt mieilt srtaxmpoo1alt mo3tadlaDul(vs t4altoir oo1fm raueils0trurio3nu4alee icsasfsDta(m ou1ape  feiyt aDelumo;(0aexnxfcio1fpt aieo;t)sexo(mpoydome  fvi () Dua(  no1oexnio3ildfs emn pnt0trenmfciodoatranesl( sexmxopiodalenliciltfsDrrx  ot1aptnioeiltlm ea( p u0 lxnifcoydoaD aneo (  rtmxo oydomtnlncta(fsrta(  ;u4alx  ociyt s2em( onu)tleoio3tadfa  lnei s0srxoir iudlpt  fesl()aDrm(mpoo0oleoii3tyslmDulu snt)tleomr3tadoa e ieo;t0teur(m3nodam nlieta(farumuroou0oex ioetldls2eauvo;t0aexrxr3oodlat  nes s  etoxrpoudomee fctlt)aDrr(rp;o4oex  ieils s ul( on()alerxo3iatfmD lneo s)t2tmxrpiydal elnci () Duru pou0opt  oetytlm ea(ms;u) etoxr tydomtr uvilt) rtoim iodlle  ieta( sDrmu  ;t4oeto o3iadfs2ran o t0 rtoifctytlatrluvol() euoio3iodaptelfcsasf Dtm(rp;o4oet  fciyd mDeanvsn()teermo iydom r n s;(  etriopoo1ol emivil(  rrmurpnu1tee  icild m eanms;u)tltrxo3oodfp  ai ils0s2trxr io1lmtnmfct (farra(r nu1aexnioeiydla2rau o;()tetnifcoydfat anvs s0 exrxm3oy1omt mivt t a2uaxrpnt4alx  icias m eanms;()arxnir3iatopD  u s s0 rtmim3nodaltn icsl(f Dtm( onu4oexnmociytfmDeanvs;u)altoxo3ia1latrluvi s sexrimpou1opt mieiatf 2umumpnu4oee ii3iasfaDrlnmp;(4tetoircto1om ranvo;t)trum(m no4am  lnesl(fsDrrum nu0tlxomo3tltfm ea(mp;u)tlxomo3ty1lmDr i o;(0 exr(m nydoptnmivtl()a2rrxro;o0ape mo3ildfa2em(vpnu0aleoio3oydoate ueil(0teum(r3ou1ap nlfetasf Dra(rpno1oleoioctlsfs2el(vont0tleoxr iotoaDrln o;s)t2xoir no1ol emivt tfsDtr(  ot0oexo i3iatlsDelnvpnt) exoiocoytfp eln s;s  eumxm3nydlm emfvi (fa2rmxrooo0optn feiysla um(vp (0 rtoir ta1fmDrluei;(0texoirpoy4amenmieil( artmxrono4opx iietlsla rau o;t4alenif tatoaDraivi t) eumxrpio1opt livs tfsDrr(mo;u1tetomo3iytls emu pnt4tetrifctadoateluei;()t2ur(m3nudoleelnctas  Drruroou4tptn ictatlm rmu p;t)alenmocio1lp  an s t srtmxr iodaltelncsa() 2umurpou4tetoioeilt mDeanvonu0tleoif ty1latelies;s seto(rpoodomtnlnvt s)a2rax ono1tpxniiciysfm2eaumon()trtoir3tytlptrluvo;t s2xoirpiu4ope lies s) 2trurpou4altn ocilt m2umnmo;(4 lxrmrctotfmtrliesl(0 rum(o oy4am e nvt t)sruaurp;u1opxoiiciydfs2elnvo ()arenmoctodlptelies;t t2xr(r iy1amt lnvsl(fsrtrx  ;o4apxn oeiydfs2rlnms (4alxrxf3oy1lpDr uvo;t  rxmimpno4om emnvilt sDtr(  no4tlxnmf3iyslaDemn pnu0 ltnio oodfpteanvilt)s2xm(r nudll  lnvt t  rtrumooo4alen ieils s em(vs t) rtrxf3oydopD an s s)seuoim3nodole lnetat)a2rrum oo4apeo ieiys a2rlnvonu)texnmr3oadopteau s s  rxo(rpiydlpee iciltf Dtr( o;t4ale  f3iatfs emnmp (0trenmo3iodomDr ueo;t seumimpiy4omenliciatfaDraxm no1opxomfciytfm el(vo;(4 rtnmo3to1lp  lneil(0 rxrxmpoydoptemfcsl( srumx p;u1aptomi3iyt a ul( pn()tetnmo3to1op e u i;t0trumxrpou1ll nmfvsatfa2umxrpnu1ale ioeiasla2um( snu)tlxomr3tatfmt an s;t) etmxrpoodlp elncsl(fartrumo;t1alt ifctytfs emuvp;()arxnif oodoate ueo;s seumxopiu1ape lfciatfsDtax poo4apto ieild aDeluvs (0arxnir3ootoa rlnei;t  rurimpnu4amen fctl( a2um( onu0aeeomoctldls2umumpnt0 etnir iydomD  neo ()truo(mpnodoleelneta(faDtm(rp;o1apxo f3tlslaDra(vonu4trenmf iy1om  aieo;s t2xm(opoy1aptn ivi sfaDuaumonu0aleo i3iydfm rlnvonu0 leomo3tadfaD lnvs t) rurxr ou4lmen ici ( sDtmxm nt1apxomicild a2ean pn(4 eenmfctotlpteaneo s0setm(m oodam   fetlt a2ururpoo4ape  ociaslmDemuvp;t) ltrio3iadoatr uvs s)srtoxmpno1ale licsas)a2raxr ;t0aex io3tlslmDra( p;(0aexrmo iy1fmteaies t0 rxmxopiodap nmiei t s2rrumo;o4oleomfeilt m rmu o;u)tlermr3io1lmDrlu il()srtoxmpnodop nmicsl(  Duau  no1tptomieiasfs emump t) etomr3todomt lneo s0 2xoim oo1apt lfvi t s2tm( onu1oeen ietytls ulums t)arxrio3ta1fpte nvs s)teuoim3ny1aptnlnvt tf 2rm(mpot1aleoifeild s2uanvs u0 etoio3ty1fmDranes s)s2xmir3iu4om elieiasfs2tm( pnu4opxoiictldfs rauvs;t0aetomocoydlmt ai i;(  euo(mpio1lleelfet sf rta( pot4tlxo i3ilslmDemuvs u4trtnir tadom e ivi t) exr(m ny4oleelnvia(fs2rrx pnu0tlto fctytla2rm(vp t4aeenxrciytlmDeaueo;t0setm(r nu1olee ivtat sDumx  ;o4apxnioctatfa2umnmo;(4aexomr iy1oatr nvols)trumxopny4lpe mfcsls) Dtmu oou0altoifctldla umnmonu4texoxfciatfaD lnvil( t2umxm3iy1oltelivt tfsDrmumpnt4alen ieild a rm( p;t0aeenxrcoy1faDeaieo;s0setmio nudll  mnvtl() 2ururpnu4oexn feiysfm ran snt4 lxrir oo1omtrln o t)setmim3nu4omt livtlt)srtm(mpou4apt mociatla emuvo u0aetoxfcto1fptraieo;s0t2uo(m oodal e ies s)sDurur no0optniieiytfa2eaumon() ltoxoctodomt  i olt)trxmxo oodal  mnetas srrrumoou4tlx iieias s ea(mo;t)altnxrcia1fpDeaneo;s0t2urxrpoy1omtemiet (f Drru  ;t1optomfciyslsDrluvp;t)trxomf oy1oat anvs;( seto(m3iy4amtnmfetltfsDtrum ou1olxnii3iyd sDemumsnu)alxrifctydomDeau s;t0srurxo3nu4lltnlfeiatfaDrmur oo1aptn o3ils m2emumsnt4 renxrciadopteli ils0texm(m3
\ No newline at end of file
@@ -0,0 +1 @@
+ues ( seuoimpiy4ol emivtl( s2tru ono4oet  feiytla2rmn p u)trenmr todomDeluvi;t0setr(o3oodlpeelnctl() 2raxr ;o0tltn fetlt m ua(mp;u4texomr ootfpt aieilt) etmxo3ny1lmtemivil()s2umumpnu1aex iieiys a ra( o;t4 rxoxfcto1lp   u s;s) eurxrpnu4lpenlfvs ( srur(rpno1tltomo3ildfaDuau snt) rtnif tydomD  uvo s  2tmxrpoodlpenlfctltfaDtm(r nu1aexnifeiatlm2ranms (4 etoxr3tatfa r ieol( setr(opoudaptemfcsa() 2taurpou4ole ifetyt mDel(von(4 ltnifcoa1laDean i;s0seurxr3iodoltelicil( srua(mooo0ope mfctldlm2rl(vo;(4artnmf3oy1latrau sls  euoim nudom emncsl(fsDtaur ;o0teeomfeiadfm2ra(mpnu)treoir oy1fpteli o;t0 euo(m3iy1amtn ivsa(fsDuau  ;t4tpx moetlsfaDeanvs u0 rtnmf iy1fpt ai sl()seuoim3oodlmtnmnctls) rurumpnu0oltnmfciyslm2rl(mp;u0trtnmocty1opD luei (0trto(r3nu4ol elivi ( srurx ono0alx  fctld a2elnms;t4trtomf3oadlp e ieo ()srtr(m nu1am  lncia(fsDrm(mpou1oeto o3iadfs ea( p t4altoio3oa1fm eaieils)seum(rpoy1ll  lfesasfaDtau o;u4alx moeildfa2ulu p;()texoxr3to1fa r ieo t setmimpoo1am elfeta( arrmx  nt1aex  feiasla2umnmsnt4alenxf oy1opD  neo t trtm(opoydlltemivsl()aDtr(mp;o0ole  f3tldfa2ua(mo;u4 rxnxf3tadla rlueilt s2tmim3oodoltnlnetl( a2tm(  ;u4altomfctadlmDrm(vsnu4trenxr3ootlp eaivsl(0t2triopio1lp elivtls srurxr ot0oleomfeias mDulnvp;t)artrmrctydom e ueo;()s2ur(r nu1olenlnvta(faDrrxront1aee mfeiadfm ra(mp t) etoxfcto1fa r n i;( s2tmim ny1lpt  fvs sf Drmxrp;o0alx iiciyd s uauvs;u4aleoifcootomteluvo;t) exoxr iydap elfcia(fsDtmx o;o0tpenmoetltlm2eanmp;(4altnmfctytfa r n ol()s2trxo3oudlmenmivt (f Dtrump;o0opto octltla rau o ()teeniocty1lpteln i;s sruoxo iy1lptemnviatfa2raumooo4apeo f3ias s2ra( s t) etomocoydomt an s;(  exoirpoo1altelict s)srur(mpno0apen oeiydfa2el( s u4 lenmf3oa1lmtrai s;t0seurimpny4open nvsa(  rumumono4tptn iciltfsDul(msnu0treoir3tytoa e i i (0 2um(rpiu4omt livil()artm(ronu0oexo iciadfmDrlnmon(0tlenxo iy1laDr n olt setr(r3no4op  mfesas  Drr(r nt0oleomiciydfm2uluvpn()arxomo3totfm eliei ()trxoxrpoy4opt mncs t  rua(r nu4alt  f3tadls el( snt0trtoxfcootopD anvo t texmiopny4lm  miei t aDrrxm nu1altnmf3ilt s uanmp (4 etrxrcoydfa r i o;()sexmio oo4omte neil(f rtmump;u4oeeomf3tydlm umn on(0arermfciytoa elivi t sexoxr iu4olee ietas)sDtm(rono1tleo oetatlsDem(vo t) rxoifcto1fptrlnvs (  exoir iodlmen fes sfartaumo;u0alxnmo3tasfm2uanvon() etnmfciy1fp  an o (0s2tr(m3nydlm elnvsasfarrm(rpot1aex mo3ias aDeau s;()altrmfcoydlpDr ues t) rxrir3iu4lltn iei sf 2ur(m ;u1olx  ieiatls ulu o;t)arxoif3totomDe nvo;(0teurxr oodlpeelfci t  Drr(m ;u1tpxoio3iat m el( p u4aexoircty1fmDrlu sls  euoxo3oy4lptelivt ()srumxm ;t1tlxo iciltlm2ul(mp u4 rxnxr iytop  aivs t  2xrxm3nu4omtnlfcsat a2trum ;t1apt  fciyslm umuvp;u)artnxr tadoaDr nvi t  rtmxr3iy4ol nmnvsa(f 2taxm oo4tee ifctat m rlnvsnu0 rtomf3iytfmDraueslt0t2xo(m3ou4aptemnvil( s2rrx  ;u4tpeoif3tlsfmDrl(mo ()arxoxo3iydlmDeluvo;t) rxmim3iodopen icil()s2raxr ou4alt mo3tatlsDrmumpnt0aexnmrciatfpt aues s0tetoir nudol emfcta(farrau  ;t4oexnmiciad s emumo;()tleoioctydfa  lnvsl()trto(mpnydolt micia()artauront0oleomi3iltfa2umu p t)teeoio oy1fm r n i s srurxmpiydome lfeia(farurx  nu0alxomi3ils a uln o;u0tleoxociytlatr n ils) 2tmio3oydlpeelnetl(f rtmumpnu4optniictldlsDua(vsnu) lenmo3oodlpt lues;s0 2xmxr3oodaltemnvsls a2ur(mpno0tlxomociyd m raump;u0 exoxo ootomD lu s;t t2urxm3oo4ap  mivsatfsrrr(  ou4oltoif3iytfm2rm(vo (4tlermf iy1oa   nes t0 rur(o oy1lpe lfvta(f 2ur( pot4tetnmfeildlaDua( snt0artrxf3iydoateaivo ()t2tm(m ou4aptn nvtas)aDra(mono4oee iietltfs umnvs u) reoir totfaD  neol()t2xm(o3oy4lmt liesatfarrmur ;o1alxnmoeilt s rlu o;t0aeeomo iy1fmD li i;t0t2tm(rpoodaptemnetlt)a2ur(  oo1alen f3iad aDelnmp u4tetnio io1fp  ai o ( sruoim ou1ap elncs (f 2ua(mp;t4ale ifeilsfs2ua( o;()teerxocoy1fmt aivilt0 rxoxo oo1alt lneta(fsrtaur ;t1olt ioeiadla rlump ()aexnif3tydoaDeau o () rxrim3iy4ap  mfvtl(farrrumono0apx ifciys s uauvp u0artnio3iytlp  lueo;s  2uoxr nudlpee ncsl(  Dtaumo;u0ope mfciysfsDuaumsnt0alerxocoy1lpt  n o;t  etrim ny4al e ictl() 2rm(ro;o4opeo o3iydfmDum(vp t) rxoir3oadomDe neil()srxr(rpou1aptelfesa(  Durxrp;u0tet mo3iaslm2ean p;u0trxnmo3io1fmt aiei s  2toxopiudop   fciat) 2ra(m ;u4openiiciydfm rlums (4tetrxfciytlmD  ieo;t)teuoir nu1olenmivtat) 2rmu pno1tpeniieiasfaDrl( o;t)tlermr to1fmteluvi;() 2uo(m oo4ap nmncs sfaDra(moou0tetnmociys m2emn onu)aetnir3oatopD  uesls s2xm(m3oy4lp nlfcs (f 2rm(r ;o0oee mfctysla rmnvs;t4tetoxocoydlmDe u o;s) rur(o nu1apte icils  2taumpoo4alxoifeildfa2ranmsn(4aetnxf totfpDeanvs;t0 rtoio3nydop  mnet (  2ta(mo;u1tpen fciaslsDum(vo u0artoif tatoaDelies t  rtmxo3iu4olen ivs (f 2uax o;o1tle  feilsfm2rlnvs u4 etnxociydlptraiei s0teuo(m3oy4ame micil(  ruax ooo1oeen ictaslsDum( s t4altnif3to1omD li sl()t2xm(r3ou4ap  liesl()srrr(mp;o1alen i3ias a rlu ont)trtomo iy1faD li o t0s2uoimpno4llte fvilt)a2tm(m nt1alxo ietlt s eln s t)arenxo3iodopDr ivsl()texoxm iydlltnlfcsat srtr( ono0oexomieiatlaDuluvpnu)arxrmr3oydfp r iei t0trur(opnodapt miesl(fa2tr(m no4aexoiictaslmDum(ms;t)tlxoiocoodfaDeaiesl() eurir3oy1omeelietl()aDuaxronu0alxoiicildfa rauvo;(0 lxnmo3io1faDrau o t0 2uoirpno1lp  mfvtls) Duax  oo4tpe moeiytla ul( s;() exoifciatomDeaivo t) rur(m3nodapt lneil()s2uaumpou0tle mociysfs emnvo;()trtrir3iodfaDr uvol(0 rumxrpno1ame mfvtl( srraxroot4alx mocias sDrln p (4 rxnif oo1la e ueo () etoxm iydolt mfvta()a2rau pnt1tltnmietasla emumpnt0altomr oydlpte i sls) 2xriopnodomt lfesat sDur(r nu4aexn iciltfm uaumpnt4areoxrcoa1lmtrln slt0 rum(mpiy4aptn icta(fsDraumo;t1ole iietat s ranmsnu0tlenifcio1fpD  n o t0 2toxrpoy4om   fvil( a2raum ot4tlxoioeildls elu o (0tlxrmr3oytla rlueol( s2umio3iu4lm  lnvsat  Drr( pno0aeto octltfsDem(mo t)trtnif iodomDelueo s0 2toxr iydap  lnetlt  Dtrx p;u4alt mfctatls2umnvo u0teeoircta1lmDrauvs s0sexoio io4aleelfvs s  2urx oou4tlxnmieiysls2em(mo;t0arxrif3oy1fmDraneo t)srtmxrpnydaptnmicia(  rrr(mpoo4alenifetadfs2umumsn() leoif3tadfm ean s;() eurirpnudolenmiesas)a2umx p;t1ope ii3tasla2raums u0altrxf tydoaDeanvi s s2urxo oodome lfvias  Dtmur ;u1tlxomfcild s2eaums u0texoxr3totfpDeanesl() eum(opoo1lp   feils srrrumpoo4tpe mo3ildla rau s () lxoir tytom rluvo s0 euo(mpiu1lp emicia(  rurx onu0aeeniieiltlaDuan s;u4texomf io1opDe i o;s0 rtrxo3io4ol n nci (fsrtau oou0olt iiciydlm emnvs (4aexomr3oy1fpDrau o t) 2uoim3io1ol nlivtas)srur(m nu0oetn fciaslm2uln onu4 eeoiocoatlmtr ues s)trxriopoudom nlnvsatfaDuaurooo4oeenmoctatla2ean o t4altrmf3todfp r nvs () etrxo3nudalte ivs t  2rr( p;o1tle mociatfm2elu ont0altomocoo1lateanvs;t) rum(opno4opee feta()artaump;t0tet  o3tltls2ra(vo;() exrir3ia1oateaivs;( t2xm(rpou4ole  fvta()s2tmx p;t1olxo ociydls2uan o (0trxnmo iy1lp eli o;t0 2tmxm oy1lpen nesls sDrmu ooo4tptnmi3ilt m2ua(mo u0trxrmfciytfmt auvolt s2xrio3oodlp  mfcia(  2urum oo4ape mieiltfm2um( snu)trxrxrcta1laDr i s ()setoxm ou1omen ictl()sDrru ooo1tetnmoeiyt a umu ont) eenmrctadlaDeau ols t2uo(o io4oleelfcsat sDurxro;u1olx if3iysfm2ulu o u4 rtnxocoy1omD lneo t0teuo(opoy4opee nei () Drmxmpnu0ale mo3iatlaDel( s t4treomo ia1lm  au o s)srur(mpoydop n ivils arur( o;t0oleoiocilsla rlnvo;u0texrxfciodoa  auvs;()seto(m iu4optemict sfs2ua( p;t0apx ii3ilsfa uaump (4artoxrciotoaD  ivolt)s2umxr3iu1amte nei t)aDum(root0tlxn f3tyt aDrmums;t0texnxoctatfm   ues t truoir iy1ame  ivslsfa2rrxm oo0tpxnio3tld m raumo;u4arxnircoadfmte nvsl(0s2xrio3iu4altemnvtl(fs2ur(  oo0aexoii3iysfa2rl(mp t4altrmo3oatfpte i s;s tetrxmpiy4oltn iesl(fs2rm(monu4olx  fetatfm rlnmsn(0artnir3tytlpt anvols s2to(rpnu4olt  netatf rtm(m ou0tltnioctlt a2rmn p (4tltoir3totoa  luvo ( srtrxm oydamte fcs sfaDtru pnu4ope iociat aDelnmp;u4teenmf3oo1fmtr uvsls0trxrir3oy1op elnci s) Drr(  nu0tpxn ictytfs rmnvo u0 lermr oydlpDean o s t2urimpoy1olt lfcia( sDtaxro;u4aeeomo3iyd m emnvs ()arxrmo3oydoatraies ()srurxmpny4opt lies s  rtm(m ;t4olx miciyt a2el(mp;(4aleoirciytlmDraneo t s2umio3nu4ol  lnvsl()srtrumoou1oexoif3iytfaDumu p;(4 ltrxr oytfp elieo (0s2uoxopoy4altnmicil(  2rmx pot0tetn ieilsfaDea(vonu) rtrifctadlaDrai slt)s2xo(o3nydam emfvsl(  2trxr nt0olxo o3ilsfa eanvpn() eerxocoo1lpt anesls0t2tmiopoo4om elnetas) 2ururpnu1tex mociysla rmnvs ()tlxomrciytfpt ai sls0 rurimpnu1ome  fciatfaDtax pnu1aexomfetydlmDrmu pnt4arxoir oa1laDr i o;t t2xmio ou4lp elnvi s)srtrxmp;o4alto i3tltfm um(vp u4aeenmf to1fmteai s s0 etrxo3io4omtnmfvslsfa2uaxm ;t0alx  feiasfmDrlnvo (4 lxnirciytlptr i i;s seum(o3nydol nmnctas)a2rrxmo;u4aetnmietlsfs um( o t)aleoir3iy1lpD aiesl()trumio3oo4lp  mfcilt  2umumpot4aetnii3iat s raumonu0 rxomfctytopt an s;t)trxr(m iu4ap   ietls) rrr( ooo0ole  i3tad s ea( s () eerxr3oytoateauvilt)texrxm3nu1op  mfctat)aDurxmont1alenii3tltlm2ul( s (4 leoxr3io1opD  u sls t2tr(o iy4alee nvtl( s2raur nu0olxoioctas s rluvpnu4trxnxr tatlmt auvo t) exmxo nu1ol nlieta(faDua(m ot0tptniociyt a2ranvon(4 rermr ty1lmtr nvs;(0srtrxmpoy4oltnmfes sfa2um( oou4tlt  oetatfaDuaumon()artoxo3ootfptr nvil( s2xm(m3iodoltnlfetasfa2umu poo1aet ifeiadlaDem( s;u)teenxfctatfmt auvi s) rxrxrpiy1am elfesl( a2tmx p;t0tltnmfctltlaDeln snt4altoxociadfmDe nvi s) 2xmiopoy1ll e fci s aDumu o;u1tlt iictyslm2rm( sn(4 exnmo ootfmDeanes;s t2tm(o3ny4lpee ics tfsDtmur ot1tpe mo3tysls2ra( p t4aleoio oatfptr ivi (0seuoirpoudlm emfvtas) rur(mp;u0alto ocilsfs rmnms;(0 ltrmr oatop ran ols sexmxm oy4lmt lncsat)srur(m nt4tpenii3tytls ulumo u)alxomo3oy1omtr u s;s0t2um(r3oo4amtn fci sfartmxrp;u1tpenmi3tltlm elu snt) exrif ty1op rlnes (0 euoxopiy1omen fvt tf Dtrum ;o0apxnifcildfsDum( o u4artoirctodlat ai ol(0 2xo(m3iydaptemfctlsf rra( p;o0tet  o3tatlm umu p ()tetrmr iodlate u o ()trxrxo3nu1aptnlivsa()sruaxr oo1ape  o3tydlm2ua(vont0 eeniocoy1oa rlneo s)trurimpiu4lle mnct t)srtr(rp;o0ape  f3iydfaDrau pnt)texnmo iodoa ranvil(0s2urxr no4lpeelneias  2ta(r ou1apto i3ild s um(vsn() rxrio todomDeaueo ()teur(m3oy1ameemnvtatfaDuax p;t1tpe  ictad s ulnmo;u4teenmf iadfp e uvilt0srxm(opnodam n nctls  Drrurooo4tpenio3iltls2eanms u0artoifciy1om rau slt)srto(o3oo4lle mieslt)arrmxrpot0opt ifetltlm ranvonu0 rxnir3oadlptelieo t  rtrxo3iu4ame mieiltfsDta(r ou1aetn feildla rm(mo;t) lenircootlp r ivi t)texr(mpoodaltelivils srtrur ;u4oltn octydls2ua( s;(0tleoif tytlmtr ueo (0 2umxr3oo1opt mnesls  Drau  oo0opeoiieilsfmDemuvon(4alxrmfctytfa rlneslt0trur(rpoodaleemfetlsfsrtmxr oo0opxn o3ild a rl( sn(4artoif3tatlateliesl(0t2uo(mpou4opt mnet tf 2raxmoot1apxoioeiatlmDemu p (4 rxrxrciodfmt  nes;( t2xr(rpoydomte ncil( artmu oou1ape io3iyslsDrlums t0tlxoiocia1faDr n i () 2urxo3oydomenlncslt)a2umumoot0texnmfeilsla2em(mo;t4tlxnmr3iydla eauvil( s2uoirpny4oleemiei s) 2rrx p;t4tpen fctyslm uln pnt0 rxoxr3totlptr nvo t) 2xo(opno4ap nlfcs tfarua( ont0aet mi3iyt mDumn s t) etnmocoa1fmDelu sls trum(m3ou1ll n nct ()srur(rooo4altn ociaslaDrmnmpnt0 renif3iotfptranvi s) ruoim3oo1ap  mnesa()sDtr( pno0tlx  f3tadlm2ea( snu0 rxomo3oadfa   ivi;t trumio iodop elivsltf rua(mont1teto icildfmDrmu p ()trenifciy1op raivsls0 eumxm3iydapt mivtlt) ruax p;t0oex mfetldlm2ulu o;t4 exoif3ta1fp eau o s) 2umxo3oodap nmfvtatfarrm( ooo4teto o3ilsls em( p u4trxrir iotlptrlneol() exmxr oodopenlivs s  Draur ;t0teen iciatlm rau s;() leoxr3oytfmteanesl()t2xrxopnydllt  ietat)aDuaurp;o1tpen f3iytfs2emnvp t4tlxomo totopt li ilt0trto(r3no4ame  ieslt)sDtaur ot0apxomf3iytfa rlums t0 lxnxf iodlmt lueol()t2uo(opno4ol nmfeta() rrm( oot0oeeomfetytfm2emnmp;u0alxrxr oa1lmD  n ilt tetmim iy1lmee fvilt) Drmxm ot4tptnioeiytfsDum(mpn() lxoxf3to1oa  ln i t  2tmirpnodolt lfcsltfsrrmx pou1open i3ild s em( o u4 etoir3totom e ivils)seum(o oudapt lncsltf Durx pot0ope ioeiatfa2em( pn(4trtomr3oatfmDrluvsls)srtrir3nodal nliet (  rtm(ront4ope  ietldfaDemnvo;u4 etomr iy1fpD  n s s)trum(r3nu1lmeelfes ()srtrxro;u1aeenii3ilt m uanmp;()tlxrio3iy1fp rlieols teurim3oy1ope mneta(faDtrx  nu0tlenio3tydls2eanmo;t4 lxnmr3todlpt  ivolt trtr(r oo1lm e ieta() rtmuronu1aexo ictad aDulnvon() rerxf ta1oaDranei;s0t2xrio3oy1amee nctl() Dta( onu4altomfctys m2emn on()alenif3oadlatraieo (  rxrxo nu4oltnmnvi () 2rr(m ;o0alxoioctltfs2um(vp () rxnxf3oodoa eaieo;()t2xrimpiu1lmenlfctatfsDtr(  ;t0olx  feiatlaDeauvo;t4alxomf3oytfat aneol(  2umxrpoy1ape lfes ( s2rm( oot4tee micildls eln on(0teenmocoydlm e ivo s0s2toxopny1lpeelfci tfs2ur(r nt4texomfctyt sDum(ms;u)trtomfciydop  an i;() eurxr3ny1lp n ivtlt a2taur ;t4aee ii3iatla em(vp;t)texnmfcto1fa rlu i;( trto(o3no1alte icia(faDum( ooo4teeniieiltlsDel(ms t) lxnmociy1lpD  i slt)setr(r oo1olen ietltfsrra(rp;o0aetnmfciytfs rau sn(4texnmfcoydfa eaivo;t tetmxrpnodlpe lnvilt)s2rruroou0teto oeildfm eauvo;u0areomrcoydlaDean o;s t2trxrpoo1op  mfvsa(faDum(root0apeo fcild a2rlu o u4trxnmr3tytom eaivi;t)teurxr no1ale  nvil(  2tm(  ;u0oetomi3tydfaDeaums u)trenif io1oaDeai il(0tetoxm3oodop  lncsls)sDurumonu4tlxomoeiltla rl( p;u)alxoiocoydomDe uesl() etmimpnydap n ivia() rrm(rooo1tltnmieiadla2ea(mpn()alxrxr iadfpDr u i;t)setrxr iy1opte nvsls)srrr(ro;u4alto iciydfs elnmo;t4trerxf oadomt lnvo ()sexriopoodlpe  nvsltfa2ua( o;u1apxniietys s eln sn()alxomrcto1fmDr iei s)teum(m oo4am  mies s)srtrxrpno1apenifeiltla rm(mp u)trerxf oa1lpDe uvsls)srtmxm3iy1opeelnvtlt sDua(m nu1texnmi3ilsfmDulu s t0alerir3oydlmt  nvi ()srtr(m3io4amtn nesl()a2rmx  ;o0tetomf3iadlsDrm( o (0arxnio oadfmDrauvo;t0 2uoxo3no1lptnlfei (fsDumump;t1oeenmietasls um( p;(4treoir3ia1omD lneols0seto(m3oodapee fei s sDtr(rono0tlxo feiysfmDumu p;t)aetrmf to1lp e ivo s  2umir3nydope lfcsl(f Dtrx  nu0oetn oeiaslaDuan s;t0 etoxoctadlmD  i sls t2xo(m3nydllt mivslsfaDraxmpoo1olt mfeiad a um(vsn(4 leomr3tatfp e uvilt0 etr(m oudale micslsfa2ururp;o0apxnifcildla2ua( o;u) eenio tatlptrai o;(0t2xrim3oo1lpt  fesa()aDtaxrooo4oexn icilsla2uln pn() renio3oydlaDeauvi t  2urxr3oo4ope livs s aruaxro;u0tee mieiytls ua( o;u4arerxocia1lmDeaneo;( t2ur(r oo4ol n fvs ( s2uaumont4alt iicilsls2rln pnt0 leomr oodfateauvol(0sexmim iu4opt  icsatfsrur(r ou0tleomociysfm rlnmonu4 ltnmo totlmDr i olt0truoio iydop  lfeslt)artrxmo;o1aetnmiciatlaDelnmo;u)aexrxrciadlaDelieslt0 eum(o iodapt lneil()aDtmumpou4oetnioctltfs2emn snu0teenirciodlaDr uvo;t)tetr(o3iudamtemfvt sfa2raumpnt4tlx ifeild s em(vp t)teenmf ta1op  li olt s2um(m3iydame mivt () Dtaxr oo1alx  ictadfm2ranvs u4 etrmr3todoaDr ieslt) 2xrxopnodomeelicsltf 2urxm oo1optn f3ilslmDuan s;u0altnio oydlaDelnvs ( trurir ou4ap emnei s)arrm(m nu4oee mfeiyt aDumumo t4arerio3tydopteaivs (  2xoiopnu1omen fvtat srrax p;o0tpx iociyt a emuvs;u0 ltrmr3oo1lat  u ols) ruoio io1olt mnvsa(faDum(mono4tptoifciytla2rlump;u)texnxoctodlp ean o s0t2trimpno1amenmnetls  Draxmpoo0apen fctltls rmn s t) lermr tatfmDranvo;s0 etoimpoo4oltnmfei s artaxmpno1texnmo3ils sDeanmo t)alxrif3oatopD  neo (  etm(m ny1ap  lfet t sDtr(m oo0olt  iciyt sDulnvsnu4 exrio oa1lateli o t)seuoir oydolenmfeta( a2rrur no1alxomociatla2uln s;t0altnif3oydfmt an sl(0 euo(o no1llee fvsatf 2ua(rpoo0oeeomfeilslaDelnvsn(4aetnxfcio1opteli o;(  2xmxopio4lmt mnvi t) Dta(r ;t4tpt mf3tld s2umuvs;u4alxrio3iatlpD lu o;s) 2xmim3iodol n nctl(faDrrurp;u0oexn oeiatlaDumums t4 lxrxo iydfa   nei;(  exrio ny4om  mnct s arrrxm no0aetnmi3tys s eanvp t) exnmfctydopt  n i;s) 2umim3no4olt liesat arrrur ou0aeenmo3iyslmDranvs;(4texnxo iotfmte i ilt0 exr(m ou1om n fei t) 2tr(mo;o0alxnmieiyd a2uan s () exrio oadlp  aivsls  etmim3ny1llt  neil() rrm( ono4olxn i3iys aDuan o (0altnircia1faD luesls0 rto(r3ou4amt lfvs s aDtaxrpou4alen fcildfs um( snu4arerif3tadoateauvils trtrxrpiu1lmen nesl( a2uaump;u1oexoifeiadls2umumo;u4 etoir3oytfpDran ol( seuoxm3nu4ll emivsasf 2umumo;u4olt ioeiyt m eln s;t0 rxrxf ootlpDe ivs;( t2urimpio1oltnmnvi ()srraxr ot4oet mietat aDumums;()trerxo3iadoa r nvs;t)srum(m oudlmee ieta()a2urur nt1oexomf3iasfa raums t0altrxoctotom rlivs;t)trur(opoo4lmenmivia(faDtrx onu0ale  ocias a ranvpnu)aeerxf3ia1lp e i sl()truriopny1ol nmnvs s) rtr( oot4apxnmocildla rl(mo;t)teeoio ta1fmD  nvilt) eum(rpou1omt mictat srumumonu1ape  ictad m2rmu s;(4tlxrmf tatfptean s s0 rto(opoy4lpeelfes (fs2tru p;t4olen oetlt a el( onu0 rtnif ia1fmtrai il( s2tmxm3iodlm  lnvtls)arurump;u1aeto i3iltlm2el(vs u) rxnir3oa1om rlivs ( srumxo no1lm nlieil(fsrurumpnt4olx mieiadlaDumums (4areoxo3oadfmteanei;t) 2xr(m ny4amenmfvtlsfsDumxmpoo0aeen i3tldla rlumonu0 lxrirctodom rau i t srxmxopou4al  lnctls)a2tr(  nu1texnmfeiad s emnmsnt4alxoxr3todop r nvo s)trtrxr3nydlm elicsasf 2tmxroou0olen fciydlmDrm(mo u0tltrif3ia1lpD lu s t0 2tmimpoydlmtelneslsf 2uru pnt4tpenmi3iltfs umn snu0 exnif3iydfpteluvo s)trtoxrpnu1optemfvia(f ruaxm ot4apt mo3ildfm2umuvsnu4trenio3totlateliei;(0trum(mpio1olenmietls aDuaxrooo1tlxn ocildla eauvsn(4 eenio tytlp e ieilt s2xrirpoydamt  ivsa() 2rrx p;o4apxnmf3iadfm2uan s (4teenxo3oo1lmDr neolt seuoim3oydape mici sf 2rr(rpnt4altomo3ild s2rauvon(0aleomo oy1fa e ueo;s)t2xmxrpoydapen ictat  rtrxr ;t4aexomo3tldfa uaump u4 rxoif3ta1lmDrlu o;s0s2xmiopnydomenmfcslsfaDtr(  nu1oex mfciadfm2el(mp t0altomrciotopD li i;s  etrxrpoydamen fvtl(faDtau pno1texnmo3ilt s2ra(mp u0 lxnmrcoydomDe neols trurxo nydlmt mnetas  2ur(mooo4oexnii3ild s ul( o (4aetoio oo1op raivo s)setrxm oodlmee icsa( s2umurpnu4alxo o3ilsfa2rlums;() renmr iy1omtrlu il() 2xmxo3nudale  nesatfarra(ro;o4olx  o3iys s2eln o t0 etnmf oa1fp r u s;(0 rumim ny1ole livia()a2tmxroot1aetniictadls2rl(mp t0tetomr3to1faDr nes;( t2xrxr nodam emnes ( aDrr( oou4aeeomfcild m2rlu o;t4 exriociodlmte ueil()sexrxopoo1lme  ictas) 2urxm ;t1olx  fetysfsDelnms;u)trtoxo3oydfp elu i s0srxrxopny4apenmici t)srrruro;u0tpe mo3tytls ulump (4altnmr tatlp  li s;t)teumirpnudop nlfesl( a2tm( pnt0alt mf3iadlsDuanmo;t4 exnircta1lpDrluvo;(0 rxrxopno4ll elict (  2rrum ;u0tetniociltls rmu o;u4alxnxf3todfpD  nvils) 2urio iy1lptnmiei t  Draxrpoo0oee  ociytfm uaumsnu0altrxf3ta1lat luvi;(0trtmxrpnodomt  ivslt a2uaum nu0oleomi3iadlm eln pnu0trxrmr3to1lpt aivil() 2xoxo oudapeemnetatf 2rm(ronu0alenifeiatfa el( p u0tlenxr to1lp eliesl()tetmim no1lp  lnvi s)aDtru  ;u0olen o3tasla eln s (0trxnxfctytoaDean il( teur(r oodapt  fcsasfa2tr(moot1opxnioctls s rlnvpn()tetrif tatfmDr nvo ()teumimpoy4amee nviat artmu ono4alt ioeiyslsDranvo;t0altnmfcio1opD  ivils) ruo(m3oy1lmt mnvtl(fs2tm( p;u0tpxnmfctatfm el(vp;t) lenxf3oatoaD au s;t)srtoxr3iu1opte nes sf Dtrxmp;u1aptnmf3tydfa2emumo t0 exoif3iydfp ean i s trtoxr3oodaltnlnct t sDum(m ;o0oee iociytfa rlums;(4artrirctadoptrluvi s)trxoirpno1llt mnvta(fs2umumpoo4tetoifeiltfa uau snu)trerxo iytfpDrluvi;( s2tmxr iudoptnmfvils s2raur ou0tpxoif3ilt mDemuvpnt4arenmo oatlp ean o t t2um(opoo4apenlietasfsDrr( onu1tlxo o3taslaDra(mp t0tlenir3oa1lp r uesl() 2xm(opny1am e ics (f 2trx  ot1tptniocias sDran ont4alxomr3oatfmD anvil( trurio oy1opte fci (f rrm(m ou1teeomf3iys s2em( snt0teerio3to1fatrlnesl(0texo(opiu4lpen nvta( srum( pnu4aex mi3ildfs ulnvsn()artrio tydop  luvils) 2xoir3io4lmenlneil(farurur ;t0alx  ictytfs rlnvsn(4texrxr3iodfptrau ols) rtmio3ou4omenlfeslt) 2rrur ;u0oex mfctatfa2umn p u)artoiociydla e uei;s  rtm(opoo4opt mnctls  Dtaxmo;t1tpe  oeiasfa eau o;u4 eermfcty1omt livi s seurxrpny1ame  fctl(fartr(rpno1tet iieildfa rlums;t0 etrif oy1opDr ieils)srum(m ou4am n ict t a2trx poo4optnio3iytfm rm(mpn(0 lermo ia1fmt  u sl( s2uo(opoy1amen ncsas)srta(r no0alx ifeiyt sDrln snt4alxnxr iytfpD livi;( setmxopnu1ll nlnesas)sDtrx  ;t4tet ii3iatlaDemnmo () exrmo3to1latrluvil( truoxrpoo1ope mfvs t  Durx  ou0oleomociasfaDuau p;(0 rxrmociadfat auvs ()texrir iudlm n fcsltfsDtaurpnt1oeenii3ilt mDeau p;(4tetnio todopte neils) rumxrpou4alenlfeil() Duaum no0teeo i3iydls el(mont0altnmrcio1omtelnes;t  2to(r oodopenlfcils srrrum nu0ole iietaslaDrluvsnu0arxnxf3oydfmt aueils0srumxmpio4lleelfcs (  rtax p;o0tptnifctaslaDelnms;t)altrmf3ia1opteaues;s0texmio io1lltnmnciat)aDrmurono0alxo fctasls2ulnmp;t4 lxrxocio1opD  ivi;s sexmxo3ny4lm e nct t s2ra(mp;o4tet  i3tldlmDraumsnt0trxomrcoodopt  u il(0s2xrir3oy4opt  fcta(fsDra(ront1tle ifcildfs2eanmo;(4aetrmfcoy1faD an s;t)srtmirpnodal n ietl(  rtr(rono1apt  ietaslmDrln s;t0tltrirciodlm  lieo;( setmim3oodop elnviat aDrr(r ;u0oeen i3iltlaDrlumsnu)artnmr oydom e ies s) 2trirpiudoptnlfvt s)srurxmono1tle mfeils s2rlnvo;t0 exnmf iytoateaneo;(  eurio3nodlleelfvias) rurur ;t1teeomoeiltls2ra(mp t4 etoir3ta1opteai ils0texoxr3iu1lme livslt srurxr ot4oet ifetls m2ulu o;(0altomo3oatfptrauesls) rtoxm3iu1ap nmies s)s2ur( oou0tlxnioetad a rmumo (4tetoif3oa1omDelneils)sexoio3nudlpt  ici () Dta( pot4tpxoif3ildfs ea( s t) etrio oytfp  aues;s) rtoimpnu4llt  nci t  Drmxm no4ole  f3tat a2rmu ont0aexrxr3iydfpt  nvslt0seto(opny1aptemivt sf Drru o;u0tlx ioeiatls2em( s;(0arxomo iy1fmDeau sls srtrxrpnu1ol emieilsf Drr( p;o4aptoifciys sDeln p;t0aeenxr totfm eai o t)t2umxm3oodap e nviatfartr( ono4oee mictadlsDem( onu0aetrxr3tytomD lnvi;(  2to(m oodape  fcs s)sDra( onu1aptnio3tlsla2eau o u0teerioctodoatrli i (0 ruo(opoy4lpe lnctlt)sDtr( ooo4ole ii3iydls2um( o t4aexrxoctytlpDrlnvo;( s2tmxo nydapeemfctat)srrau o;o0ole mieiyd m2elu s;(4 ltoxrcia1lp e u sls) etoxo iu1lptnlnesl(  Dtrx  no0optoiictadlm2em( s t4trtrxocto1fmteau s t0srxrim nudlm nlnctls)sDum(  oo0alx mo3iyt m ra(monu)tetnmocty1op e u i;s t2tr(o nu4ale  fciatfs2tmu ono0aleo i3iad a2eanvsnu0trxomfcty1fpte uvi;() exoimpoy4alen nvtlt  2tm(r ;o0oexnmi3tytfm2rmn snu0tltrifctadlmt auvo ()trtoxo iydamtnmfvi t)arumu o;o4ape  i3iat mDel(mpn(0treomf tydomt lu i t texoir3ny4ap  liei t s2tmx poo1oee  oeiat m eau on(0 ltomf3iotop  aneo (0t2ur(o iy4apeelictls  rtau pnt1optoif3iatfm rln s ()texnmociy1oate i o;s) rtrim oydlm emfct s) 2urxrooo4opt ifciysla2rl( pn(0teenmf3oa1faDelnes;s) rxmim3oy4lp  lnvi tf rtaumpnt0tetomiciltfs2eaump;u) etoxf3tydfpD aieils0truoirpio1ap  mfvi (faDtrxmo;o1aexo fcilsla uan s;t)areomr oytomD lies;t t2trir iy1omt  iesl()arta(r oo1alx iieild m ul( o;u) etnmo3ta1lmD  nvs ()texo(o3no4openlivsl(faDurxmp;o0oee mociyd s2ra( o;t)trtoirciotfaDr neo s  rxm(o3iy1olt  nvsas sDur(rono1oeenii3tat m um(vp;(4trxrxr3oydlpD  i o;t)t2xmimpiu1op nmicsas arra(m nt4oexomfctlt m rl( snt)tlenmo iodom eaues;s)t2xoxr3oo1lm nmnci s) Dum(rp;u4tetomociatlmDrauvo;u0 etomr3oytoa rln i;s)teumxopiu1lltn nvtls aDur(r ot1tleo ietasfm elnvo (0tlermf oo1om eai i s s2xmirpio1ole lfesat aDrr(  no1tlxomo3ilslm2ulumsnt) exrmo3ty1fa   ivo t texmiopno1op nlncsasfsDum(mo;o0aptnmoctat s emnvo t4tleoxf oatlmt anvol()truo(o3oo4lmtnlieia()a2rrumpot0ole mfetltls2rl(vs;u4 lxrxo ty1lm  au sl(0 ruoxr nudlmtnlnvt tfs2ta(mont1apen feiasfsDemnmont)aeeomr3tytla   neils0s2tmirpio1lp  mivsat aDtrxm ou4apx mf3iltlm2ea( s;t0treomo iatom  anvsl( setmxr oo4llt liet (f 2ta( pnt0tlxoiieilt m2ea( o (0alxrxocootoa  ln s ()seuo(r oudom n fvtltf 2urxr nu1opt  i3iltfs2ua(vp;u4tltomf3iy1optelnvsls trxoxr ny1altelncs t)a2uaurooo0apeoiociydls uluvp;t4 lermocta1fmtrlnvs s)t2tmxo3no4amtnmneil(f 2taxmpou1aee ii3tatls2ea( p t0 exoxfciytfpDrauvo s  etoxm3oodllee ieils)sDuru  oo4apxomfcilsfa2ra( pnt)arxrmr ty1laD lu slt0texrxo oo4lm elfei sfsDtm( pou0tex mictatfs2eanmo u0aetoxf oytlpDranvo;s0 eum(r oy4lm e ieiatf rumumoot4opxnio3iatfa elnvon()arxnxo3oydfm rlnvi s) euo(o nu1lm emfviltf 2rr( o;u0aleoifeiat a rmn p t4 rxnxfciodfmDrln il( truoiopny1amenlfvslt sDrrxm ot0oetoif3tld aDem(vp;(4altnxf iatlatr uvo (0 2um(o3nu4amen fcta() rrmxr ou0ole  ociltlmDea( p;u)tleomocoydoaDeli ol()srtoirpoodlltelncsls srrrx o;u4tpenmi3tatfaDelnvp;()altnxr ootoaDeau i s0s2tmxr3no4ol nmfvi s)sDumxroot4aeenifeiyt a2rmn on(4tetnxr3oodfm elnvol(0 rxm(m3oo4oleemfvta( s2ua(mp;u1oeenio3ils s eanvo (0 eeoxo3iytlpDeau i;t)srto(o3oo1omeelici s artr( ono0oet  fctltfsDemn o;(0trtrir oa1om rau o t)s2tm(opoydapeemfcsat  2rm(  nu0ale iictyt a rl( o (4 eenxr to1laDran sl(0 rxr(opnydalen ivtatf 2tm( ono0teen ociat s2rl(mo t4aeenxf iytfmteaneslt0seto(r3no4lpen ncil()aDraxm ;t0aeeomi3tydfs2rluvs t0 exrifcoo1lmD an sl( trurxo3nydlptnlneta( arraumo;u4ale ii3iad s rmnms (4arxnxrcoodfatrluvilt0t2ur(r io4llt  net tfarurxmont0apxomo3iydla umumo u4teermf iydfp elu ol( seuo(o no1olt lfcias)srrm( pou4apxoif3iytfs2uauvsn(4artnxfctotfmteanesl( srto(rpoo1ll elfeslt) 2raurpou1oltnmfeiyd aDua(mpnt) ltrif3io1opt  n ol(0t2xr(opnudol  lnvslsfsruau  ;o0alxniociatlm elu pnt)alerxo tydfpD  neo t seuoim3nu4optn fctl(fsrrrum oo0opt ioeiyt mDem( o;t)tetoxf ia1fa r ivi;() rtmir3iydaltn ivi t sDum(m nt4olxnmfctatfm2rl(mp;()arxrmo3iotoaDeaneol() 2tmxo3oodoptelicias  2rruro;o4ale  ietyt a2ra(vo (0arermr3oadfm r ivsls  etoir iy1amte ivsasf rumxm oo4aeenmieils aDeau p;u4aexrmo iatlm e n s s)s2xmimpnodam nlivias) Duau  no0oeenioeiyt a rm(vsnt4 rerxfctytlatranvi;s0trtr(opiy4omenlfctl()sDtrum nu0oltoio3ildfa rau o;u)arxomf3iotopDrlieils)sexrim3nu1lmeelivtat aruaxr nu1tpeoiietltlm ulnmsnu0 ltnir3tatom raneslt texmio3nodlleemncslt  Drru  no4apxn i3ildfsDulnmonu4alerio3iotom  lneils) 2uoxm iudapte ietasfsDuru onu1alt ifctadlsDemnmsnt) ltnmfctotlpt aivi t sexr(m3iu1lptelnei ()sDtaumooo4tltomo3ildlm el(ms u4 rtomocoatfpDrau il() eurir3iy1lltemnesa() rra(r nu1tlen f3iytfaDeanvonu4tlermo3tydopteai i (  euriopny1lpt  iet t)sruaxmont0olt  o3iad s2rm( pn(0arxnir3iotlmDeaivil( sruo(r iydopen ieta(fsrtaumo;o4aptnmietatls2el(vp t4alenmf3totopD  nvi () 2ur(o3nudoptn ivtat artrxmpno1aeeomi3tatls2el(vsnu)arermr oadlmteaneslt0 rumxo io1lpenlfvsat)sDuaxm nt1ape moeiaslm ea( snt) lxniocoo1fmDr u s t)s2xm(m3nudlmtn ics s srrr(mpnu1alenmiciys a2rluvs (4 lxnifcia1fp eanes t s2tmxopoydoltn nctas  rrr(r ;t1aeen oeilt s2ua(mo t4treoxo3tydlmt lnesl() exmir3iodomen ivs t  Drmu pnu0oetn o3tls sDumn p;()arxnxr3oodlm r nes t)teuoxo3oy4am   nvil()arumx pou1olt  feilsfsDean s;u4 lxrxf oytoateli s t0setmio3oo1lpte ivtlsfs2tru p;t0oexnmfcils a raums t0 rxrmo oa1lp   neo t  2uoxmpoydlmtnmfvi ()artau o;t1teen ietlsfa emnvo u0arxrxocoodlmt ai o t)seuoimpio1amtemnvs t  Draxmpoo1aexo fciysls2uan s;()trtoif tytfatraivi (  rxm(rpiy4op elfcsas)sDrmxmoot1tpx  f3iys m2el(vp t0 etrxo3iatomDr ues;s)t2xr(o3no1ap n feiasfarrmumpoo0tpx mi3tydfm2umumsnt)trerxr3to1lp rlnvo t sexr(o3nodal  lietl() rumxrono4apenmiciasfa eaump (0altoxf3oa1op rln s ( trxoxm3iu4llee fcs s aDtru  no1opx iieilslm2rlumon(0teenmfcootfpD lieo;s s2toir3io4am e ies s aDumxronu1oee ii3iys mDrmumo;u4aeenir3ta1fptelivo s0 rxo(rpiu1aptemivia(f rrm(  ou4aet ifeiad sDuauvpnu) renxociadlmD aieilt0texm(opno4amenmncs s  2rax  nu0aleomfctltfmDumn snu0artnmociotop raivo;( srtrio3io1alenmfcs s)a2ta(m nt1oetomfetltlsDrmuvs t)tltrmr oo1lmt aiesl(  2toio3ou1lmenmfvi () rraxr oo4tet  i3ildls rl(mo;u0tlxoxf io1lmDe ivi;t) 2xmirpiu1lp  mfvt tf Dua(mpoo0opxnmo3iysfaDrln s;u4trtrxr totlm   nvolt)srxo(rpnodape  net (f 2ururpot0opx  i3tlslmDrlu sn(4trtoir3ta1lmD  n olt0 etrxm3ou4amt livtl(fs2tm(rp;u0tlxomfciasfa2umn pnt)texrmo3oodfaDran s;t0texmio3oo1ap  licils s2um(m nu1apx miciltlmDrln p t4tetnmo oydfaDrli o s texrirpny4omtelfetas)aDtmu pno1tpeo icildlm umnvpnu0tlxrxf3oy1laD livo;t)setm(m3ou1omenmneilt)srtrx  ;u4olt  f3ias mDulnms t4 rxomr ty1faDr neo;s) exrim ny4amt  fvsasfaDrr(moou0apxnioeiat m2rlnvs (0 leoir3ootlpDr nvs;s t2trio3no1lp elnvtls)a2raum ;t0tpxomfeiasla2rln s;u4tlermr3oy1fmDeai i (0 exr(opiodoltnmivtatfaDuax pou4tpxniiciasfm uau o t)texoxociatla rliei;()t2xrxr oudlltnmies sf rrmurpnu4tlx ioeildfm ran s (4texnio3oytlat aieilt0t2xr(o3oydome  nvtl() Draxrpoo4apt  ieiad aDeau s u4tlxrxfcoo1fptraieol(0setr(r3io1lpt mfetl(  Duaxronu1alxniocilt mDumuvo ()aexoif oodlmDeaneol()sexmxopoy1lpt  ieias) 2rm(rpoo1aexo fctyslmDuau pnt4tltnmfcoo1fptr ues s s2umim nu1omtn ivi sfsrra(  ou0altnio3iasfa ra(vs;t4 rtomr3oydfpDrlnes;(0trtoio3nodomeemivi s)a2umxr ;u0aexn ieiysfs uaums;u4 rtriociodlpDr ivo t0srumir ny4ome  ietat)aruru ont0oeen o3ilsfmDeanvp;t)aexrmfcoa1lp ean o;t0trtm(o3oo4lltnlfcias)arraxm nt4tlen ieildfm uluvo;() lxrif iodop r neo s s2toiopiydaleemnetlt)aruru  ;o0aeen oeiatlaDrmnvp;u0trxnmr tatlaDelivsls  etrirpno1lltnlicta( aDrru p;o4oee moetyd s2ul( s;() ltnxr3todlatrln s (0seuo(rpoo1lp nmfet s  2rrum nt0tlxo i3iysfm eanvo;u0aetrmr oa1lptranvil( seuoxo3iydapenmfvilt  2trum ;t0apxomictlt aDrl(mp;() etomr3ta1lm  auvols0sexmir3oudlmt miei sfsrtau pno4olt mociatls uan snu)aexrmoctadoa e uvo t) 2xm(o io4op   fctlsfs2tru oot4oetomoetldfm2ra(msnu) exrxf ia1omtr i i;s)texm(o nodlm   ncs ()aDuaurpnt4aetoifeiatfm2ea(vp u) rxrxfciytom eluvs t0t2xm(m3no1llen fvtas sruru  ;t0tltoioetatlm umums;t4tlermocoytoaD  i i t s2tr(m iy1alen ncsas)a2umu poo4opx ifciadfsDum( onu4 rtrmo3iy1omDelnvo;()s2urim oudlpenmnetas)arua(r ;u4apenifcils m ua(mo;()trenxo oodfpDrluvol(0tetm(mpiu1lp e fesls)aDurxroot0oeto f3iyslm2umn o;u4 ltrmr3iydom rlnvol( t2xo(rpiy1optnmfvt ( aDrrxmo;t1aeenmo3iyd s ua(vsnu4 eeomo iatoa  an sls setoio nudap  mneta( artau pnu1altnmo3tld sDea(vonu0 reomo ootop elieilt srurir3iy1alen fvil(fsrrm(m ;u4aex ioetlt s2eaump t0 etoxf iy1oa rlnvi;t0sexrxo nydopt miviasfsDtaxr nt1apx ifciltla elnms;(4trtnif3oadfpDe i s (0 etrxr3io1lle mncia()aDraum ou0olt mociadfm2eau o t)trenxoctadomD  i s s truoio3iu1optn neslt) 2ua(r ;u1altomoetltla eau p t4tleomf3oo1la eaneslt)seumim iu4lpe mfvsls)srtaxm ;u4olx iiciyt s2el( snt)treomo3iodla   ivslt0 rxoxm oydlmenmfet t) Dumuro;u1oee io3iatlm rmuvp (4 exnmf3iotop rlivi;s)s2tmim iu4amt mictas s2rrump;t0apt  ieiytfm rmn s;u) ltnxfcoadlmDrluvs t)trxr(m3nu1ome lncta( aDtm( onu1aetnioctat m uauvs (4tetnxf3ootlmD  u s t) 2xrio oo1lp e fvs (f 2rrum nt4tlxoii3iasfaDea(mo t4 eeomr3oatlmDeaueo s)srumxrpoo1llee iviasfartrx p;o4tpenmoctaslsDra(vpnu)aexomr oo1lat  nvolt trtoxopio1lm  mfct sf Durxro;o4oet mfetysfsDem(vs;t0 exomr3ta1lpD li olt s2xo(o3nudlmeeliesl(f 2rr(m nu0tpe io3iydlaDumuvp (0tlxnmf3iotfa  aues t0seto(o nu4oltemietltf rtr(ront4opxnmieiatlsDuluvp;(4arerxfcio1op  aies t s2xmxopiodamtnlieils)arta(mono0texnifeiydfsDua( o;u)trxnmocoatlpt  uvo ( s2uoxr nu4llen nvias) rtmur nu4opxnmo3iatfsDumnmo;t0aleomoctodop  anvol(0srumir ny4op nlnvi tfsDumurooo1oleo o3tadfm2eln ont0texnxo3iatopDrauvo;t  rtriopiu1olenlfes s)aDurx o;u0opt  fctldfs2rlnmp (0trxrifctatlp eau i ()teurir iy1ome lieiltfa2ta( o;o0oetomoetaslm rm( o t4artnmrcoy1om  anvs t0setmxm nodolee icsatf Drmxr ;u4texn o3tatfaDulums;u0 etrxf3tatlpDeaivs;s  2uoim oydopt miet tfaDrrx  oo0alxnioctlslm2rl( o t4trxnxf3iodlaD aiei;t texr(mpiu4ap   fetl( sDtrumpnu0oexniictat sDuanmpnu4teenir ta1om eauvsls truoio3iydol nmiviat  2trxrp;u4oee ii3tyt m2ra(vp t4arxoxrciodlmte nvo ()srtrio3iodlmenlfvtasf 2ta(rpou4oetomo3tls a umnvpn()tltomf oatlpDranvi t) 2tmxm3iu1lmtemivta(fs2tmxrpnt1aex mi3ildlm rmuvs;u4trxrmrctadlmtrli i;t0t2urio nydape micsa(  2taumono1oeeomoctldlm2uaumpnt) reoircia1lpt ai ils)seum(m3nodom emnes t)a2umxronu4tpxn ictlslm rlnvp (0 reoxo ta1fmD au ols s2ur(m oo4apenmnei ( srumurpno4tle  oetysfs2ulu pnt) ltnif iadlp eau i t  2tm(mpnydaptnmfei t  Dra( pnt1olenmfciat sDuauvsn()trenif3ta1fptelivols0 2toxo oydoltnlnetltfsDur( oot0oexomo3tysfm2uluvp;t0trtnmo3tatlm   n il( t2uo(m oodop elfcsl(  2urx  no4tpxoio3iysfsDum( s (4trtoioctodfm eluvil( t2xmim3nu4omee fvt sfsDua( ont4oee  ieiatfs rm( p u0trtoir iatfaD luvs s0s2xoiopou4lpe miesa( aDrmurono1alx  fctldlmDem(ms t)arxnio iotop   ivi t  2umio3iy4ll e fvt s sDum(m ot0tpt mi3ilsfaDuauvpnt)artrmf iytfa   ueolt t2tm(opiodapeemicils) 2tm(mpot4teeomf3tlsfaDua(vp u4tlxrmr3iodfptelivi;(0trxmxr3oy4lm elics sf 2tr(mo;u1tpto fctyd m raumo u4 exnxr ootfmte i il(  rxo(m3iydalee fvtat)arta(  ;o4teen oeiydla2eluvon(0 lenmr3iytoptr ivi;()srxrxm ny4ol nmfcs t)a2ua(roou4oltniiciadlaDuauvs u0 reoiocoydoateanvs s0 2xr(rpiy1amen ivia( srtrum nu0tetnmo3iyt aDelnvp t)tlxoir iodomD livo s0 2tr(r3no1ap emfei (  rrrx pou1teto oeiatlmDran o u)trtoxrctatlmte ues (0srtmxr no4amen nciat sDrr(m ot4texnif3iydla rm(vo;u0 rerxf iadlm   ivo;t sexr(rpnudam emivtlt artax  ou0tpt mi3iatlm2rmuvp u4artrif oydfateln il( s2xrxm nu4ap   feta()s2taxmpnu1apx if3ilsfs2ra(mp;(0tlxnxrctotlpt  ivi s seurxm iy4altnmict tfa2umurpou4tle mfetltls2rau ont4 ltrxfcoa1lptr ivs (0s2urir3nu4apenlivt s  Dtax pou4optoif3ildfsDelums t)artnxr ootomtr nei;t)t2xo(opno4lmtnmfcslsfsDrm(mp;u1tle mf3tydlaDuanmpnu) lxoxr3iy1lat anes;s) exm(r3oy4lltnlnci ()arraurpoo1oeenii3ilslm2ulnms;t4 rxnir iy1lpt li s;()tetmxopou4omtnmfcs t artmxrp;u4tpen ieiyd a2rlnmsnt)artomf ty1lat an il(  2trirpoo1lmenmfesa()aDrmxr ;u1tlt moeiyt m umuvpnt0 rxnio3iodlmtelnvsl() 2xoxr3iy4lmeemict tf rur(rpou1texnmi3tysfs2eau s u0artnir3tatfm r i s;s srum(mpiu4lme mfct s)sDuaxm oo0altnifeiyt s rlums;(0treoxf ia1fm rlueil( setrim3io1olenlivs t)aDtm( onu1apx  octad sDrauvo u)arerir oatfa e ivo;(0teto(m ou1amenlfvtas)sDtau  ;u0olx mf3tad sDem(vp u4 rxnxoctodopte nei;s trtm(mpiudal   nes tfa2tm(root4tpt  icildfaDulnvpnt0 rxnmf3tytlpD aueo (0 euoxm iy1alt  fvilsf 2umu  no1tpxoif3iat s ea( p ()treomo3ty1oat lnvs t0trxr(m oy4apenlnetls s2tr( o;t4tee io3iysfm2ea( pn(0aexrircia1lmteln sls)t2xm(o iu4oltnmfvsl(fsDtrxr ;u0teeo oetldfm2elump;u4tlxomr io1fmDrlnvo;s t2xoio ou1op emiesat a2ra(rono1tpen oeiadlm2rau p (0trxoif3ootom r u ol( truoirpio4alee ieiat) rtrumpnu4apxnioeild s2ul( ont) lenxf3tydfpDe ues;(0srxo(m oodlptn fcsl(faDta(rpoo1tpxn ociasfmDemu p u0aeenio todfmD  ivo;s  2trxmpoy1lm n ics s  rra(roou4oee ii3tatlsDrm(vp;()alxoir3oadfpt li sl()t2tmir3io1ome lnei (  rumum nt4oltnii3tas s2eauvs;()aexrir3oatop rli o;()teuo(m3ny1alen fvi ( aDum(r no4tlx ifetadfs elnmon(0arenmr3oodlpDrauvs;()t2ur(r3io1lpen fcs tfarumxro;t0teeomi3iydfs2eanmpnt0 etrif3io1om  aieslt0 2uo(o3iodope lnci s  2trxmpot0olx mfciadls uanmont4tlenxr3iotopDrli ols)trtmir ou1ape lfetas  Durx  ot4aleoioetltfa2ean s;u0tltrmr todfpt lueilt)texoim io1lmeemfesltfaDumu o;o4opx iociys m eauvp (4trxomfcoydfptr i o s)s2trxr3no1lmtnmncslt) 2umu ooo4opx  ietlsfs2emn s u0trtrmf3tytfatr ivi (0trtoim3oydol nmneils)s2umx o;u4ope ifctadlm emuvs;()aleoif oytlatrlivi s trxo(m nodapeemieiat)sDrm(rpno1alt  iciasfm2ua(mp;t)alxrmo todfmDeaneo;t s2tmxo3iu1open fet sf 2tmxmoot1tltniiciydlmDrlumon()alenmr io1latrauvi;s)teuoxr3oydlpte ics ()a2taumo;o0aptn fctadfsDuaumo;t0 rerir iodfpD aies s  exoio iy4al  lnetat sDumurpoo1tpto ietytlsDeanmo t4tlxoxr tatfaD  nvs;()trxrxo3iy4op  lies ( srur(mont1optn i3tlslaDra(mp;(4aexnxf3iytfm eluesls) 2tm(mpoudlm   fcsa()aDurum nt4texnio3iydls2ulnvs;(0 exrxocto1faD lies t0 etmxrpoudamtn ivsa(f 2rax ooo4tlxnif3iytls2ul(mp;()alenxrcoatlmDraiesls0t2xo(o3iodal  miciltf rurxr ou4aleomieiltfaDua( p;u)alerxo to1faDranei;s trxo(opiudam  mfci s aDra(mp;t1alxn feiadla2rmuvs;t0teenxr3oo1oatelnes;s teum(o3oudol   ivia( a2trxmpot1ape  iciydlsDrln ont0aetrxfciy1lateaieo s texr(m3iu4lpeemiciatfaDra(m nu1texomfciytfs emnvpnt0 lxnmf oatlmDrlues;s tetmirpnudlmtnlicsat sDuru  ;u0opx  fetysfm2eln p;(4 reoxr ia1faD  neils0trumxopiudalee fcia()a2tr( pot0alenifciasfa rmumpnt0aeeoio3ta1la rli ils  2tmio ou4lptnlieias)s2rrump;u4olto i3iltfmDua(mpnt0texomf tytlaDelivo (  rtm(o3oodal  mivia( arurumpnt4ape ii3iyd mDrl(mo;t)aetrmo3oo1lm  an sl(0 2tmxo3oo1lmtnmfvsas sDtru o;u0teto o3tltla ran p;(4texrir oy1fmt aivils0s2xm(o oodlm n nvtls)a2tm(  ot4opeomoeiltlmDumumsn()trtrmocoa1op e uvs;(0t2urir3nydopee iei sfs2tmum ;t1tpt mi3iasla2rlnvo t4tlenmf3oydopDrlieo ()tetr(m oo4llte fvsat artmxmonu0oetniieiadls rlu on()tltrio oo1op r i s s0t2trim3oodopeemfeiasfs2trumoot4alx mociydfa rauvo (4trerxrctytlp   ieol() rxmxrpoodam n ietat  rrr(mp;t1tle  o3iatfa2ulnmsnu0 reoxo3iatoptranvs s  rtrirpnudlpenlfvs (faDuax o;t1olto fciadlm umn o;u4 lerir totfaDeli ol(0 2xmir3oo4omtn nvilt)artm(m no0texoiieiyslmDumuvpnu) rerxrcto1laDrlu il( s2tmio3nodlpeeliesls) Dtr(r ;u4olenioeiat aDeanvo (0aetoiocoadopD an slt0t2to(mpiydapt lnvils srrmumpnt4oee  f3iasfa emu o u0artrio3iodfmD lies;(  eumxrpnu4am elnvil(fsDtr(  ou1aexn oeias aDrmn snt4aexomo3totfa   i sls)teuriopny4aleelivtltf 2rmx  nt1aptoio3tlsfa2rlnmp;u4artoir3to1fmDelues t) eto(o oo1omt licil(  Dtmx ooo1tptn o3iat s eanvo;t) eeniociodopteln s;(0trtrio nodomtnlivs t srrr(m oo4tltnifeiadla2raumo (0aleoxr3ia1op r n o () 2trxopoo1lltemneil()a2tr( pno4aetnmfeiydlm2rauvpn(4altomrcoytlmDr nesls)srto(r oydomtnlfes sf Drrxmp;o4tetnmi3tasfm2em(ms u0alxrif totfm  lneo;t0trtmxm nudape lfei (fs2raxr ;u0tpt  i3tatfm2um( on()alxoir ta1oaDrln o;(0 rurxm nydomee neilsf Drmxmont0aexnmociys mDranvs;u0aetnmocio1omD  nvolt) rxmirpnu1lle miei s)sDtau  nt4aexo ocild sDuau p;t0aetniociotfmDeauei s)s2umxo3nodalen fesat arrmxmpno0aeto iciaslaDumn pnt4 lerir3tydlateaiei;t t2um(r oudolenmnvsat sDrmxmpoo0olto o3tys mDelnmo t4 lxnmfcoy1la e nes;t srtoxm oo1alt  ncs s aDrrxmpnt1tlxn ocilt aDea( s;u4artrxocootfmt lieilt  euo(rpiy1lltnmict tf Duau p;t4aptnioetlt mDra( pn(0tltnif3totoptr uvs;s  etr(o3oudll   fvil( sDtm(rpnt4tptoioeiydla2uluvs;(0 eeoxociatfmDe i sls  ruoir oy4om nmieils)a2rau p;o1tee io3tad m2ua(vonu0 renxr tytoat aieols  2xm(o3nu4apeemfes t)sruaxrpou1altoifeild mDul(mo;(4 rxnir tydlat lneo s  eur(m ou1ap nmfei s) rraxronu0aex  feiysfs emumsn(4arenir ta1op rluvilt  2xmxo iu4lmtelfetas) rtm(mpno1texo fcildfm2ean o;(4trxnif3io1fm   uvi s0 2xmxrpiodam  lfci s)aDumxr oo1apeomoeiad mDul(vp;t0alxoio iodfpDeluvo s)srtmir oo4omtnmfvtls)srtrxrpnt1aeenmietasfs elnvpn(4aexrif iytfmDe uvs s)texrim3ny1lmt mneilsf Duaump;t1optn i3ias m elu s (0teerif iatopteau sl( srtmxrpiydlpe  fviat aDtru p;u0oeeomiciat s2ul( p;(0 rxoxfcoydomtranvi s0srurxo oo4oltnmivs t)sDumumont1opeomieilsfa um(mo;u)alermocio1op r n s ()srxrxopny1omenlicslt  rururpoo1tpt mfctldfa emnmo;t0 rxrmr ty1om  aneils0 2xo(rpnu4altnlncs s arurxmpou4tlx  fcilsfa2ranms;u)texomrctytom eau o s t2umio3iy4ol nmfes t aDtrxr no0oex io3ild s emnvpnt0trxoif todfa  lu il(0srumir iydam nmivt t)srrrxmoot0apen o3tas a2em( s t)aetnmfciadfatranvs t0srtoir3oydalt lnes t)aDtaumont1opx mfciaslmDemnmp;()aeenxocoo1latelieolt)setoio3no4optn fvia(farua(mpno4apeoifeiltlm ua( onu0trxoxr3to1fpD  ivo s) rtr(rpio4amtnlnes s) 2tax o;t0aet iietydfaDuau snt)artoioctydfptrluvolt0teuoiopio1ome lici s srua(ro;u4tpxoii3tadlaDea(mo;t0 exomrcty1lmt  ivi t0 rtr(m nydalteliei t)sruau oot1alx moeilsfs emnmsnu) lenxrctodfa e i ilt0 2tmim nodame mnctlsfa2rmxmoou0tpe  o3tld aDeanvsnt0 lxoio3oodop eaueil()trumxo ou1op  mnei s) 2umx ono4tet mfeiytfaDuan s t0aexrmfctytomt livs;()srxrxr3iudameelfeilsf rtrxmoou1apeo feils s el(mpn(0 rtnmf iytfmtelnei ()sexoxopny4lpt  ivtat  rtmxm ou4teeoiieiatlmDrmnvp;t4arerxo3oadfmt auei;t) rtoxm iu1ape mici ( aDrrxro;o0tltnifctasfmDumuvs () eenio iytfpDelu i;s trxoxo3oy1apt lfcs sf rtm( oou0oex iicild sDuanmp u0artrxf3oatomD  nvi ( sexo(r nu1lme mfvslt  Drmxmpou4tpe  iciltfs2rm(vsnu4teerxo todfmteanei;t trtr(m3no1ame  ieiat  rta( onu0tlx mictytfs2ulumo u4aeenio3totfpDraiei;s setoxmpiy1lleelict sfs2tmxmo;o0tlto oeildls ra(mp;t4altrmfctytlp elnes;()truo(o io4llt mnvsl(f Drrur oo1aetnifetat s ulu o ()tltrmrciytomDeai i (0t2xrio iu4op nlfcs sfa2taxmoou0tpe  ictytls2raump ()alenio iodfm elnvsl(  ruo(r nudame liviasf 2urump;o1alxomi3tys m2uaumo;u0areoif oo1lmD  uvi (0 exo(mpno1lm n feiltf 2ur(rpou4teeo fctldlsDuau pnu) lxniociatop r i o;s0trtrxo3io1apen feiasfsrrr( oou4aptomo3ilsfm2emuvp u0trxnio3iytop  anvol()teurxmpoy4ll n ivs t a2rm( pot4aptn octytfs umnvsnt4trxnxr3ty1fpDeaivi ()s2xrxr nudamenmivt s  rtm(root4opeo i3iaslsDumums;t0alxrmo ia1omtr u s;s0 rtrxm3oo4lmt mivs ( aDtaumoou4opeo i3iysfa2el( s t4 exomrcoytfaDrai ols srxoio ou1al n ivs t)sDtr(rpot0tlx mociad sDrmnmpnt4 etrmo tatfpteli s;s)t2xmirpiudllenmnesls s2uaxmo;o0aetn ietldfm rlu p t4 rtoxr3io1la  liei;()setrir ou1lltnmivsls a2tm(  ou1opt io3ilslm2uaums;t0 leoif3oydoa e i i;t0 2umiopny1omt miet t)s2rrxmpot1oetomi3iytlm emn on(0trenxocoadfaD liei;t s2um(m io1ap elnetlt) Drmuro;u0oeenifcilslm rlnvsnt0aleoxr3oa1oaDr n i;(0 eum(m oudlp n ics (fs2tmu o;o4oltomi3tadfs rl( s u)alxnio iodfateauvo;t t2uoxm iudalenmivi t  Dta(monu1tetnmf3iytlsDrl( o;(0 eenmrcio1fmteaneo;(0texrio3no4apt lnvtlt aDtru o;o4openmi3ilt m emuvonu0teeomf3tatlmDeln ilt t2xoxr3iy1op   neia(fsrurur ou0tlx  o3tytlsDea(mpn(0tetnxo3oatomDrlnei ( tetrir io4omen nesl(f rtaxr nt4tptnio3ilsls2rl( on(0texrio3oy1fmD  i s t0 rxm(r ou4omtemivt s srtmurpot0tpe ifeiyd mDumu s u0aexoio3to1fateau i;( t2xoxr no1openlnvtl(fsDrrxmono0altnmfctltfs eauvo u0 eenir3oydfpD  u s;t)trtr(r3iu1amenmfes sfsrum(mpnu1aeeomiciasfa2ulumsn(4alerxfciytom rlivi t0 rtrxmpiy4lmtnmneilt srumu p;o0aleo ieils s2umnvs;()alxnmf3iydfaD  neol( s2xm(o iydome  fvils) 2tmur no0tpx  i3tyt m2ranms t0tleoxociodoptrlivol()trxm(mpnydomtelneta( sDta( ono4opxnmoetls sDea(vont0artrxrciydfm  liei t) 2xriopnudlle mivias aDtaxr ;o4texn o3ilsla ranmpn(0trxrio3iatfmDeaivi s0 2xrimpoy1am elies sf 2rr(rono1oee ioctlt a ranvpnt4altrir3oy1fp r nvo;s0teur(rpoy1oleelfcslt) Draxront4oexnmoctldls ranvsnt0tlxomociadlmDelueilt srxrxm nodom elnvtat)aDrmx  nt1aeeoif3ilt a2umuvs t4tlxomo3tatlm rlnvs s0 2toxr ny4openmfvi t)artm(rp;o0tlto octlsfmDrmnmo;t4 etoif3iatopD  uvi;t  etmxm oy4ol  miet sfsrtm( pou0aex ifciatlm2ulnms t0tetoiocoatlptraueol() etoir iudalen icslt)s2uru ono4ale ii3iadfm ranvo u0tltrif3oadfpD  nvs t  rxr(m iodale lnvils) 2rmurpot4tltn feiytfa2uauvp () rtrxrciatfpDeanvo;(0s2umimpny4olenlietlt  rur(rpnt4ape iieilsfs2umu s;t4 ltoxo ia1omt aivo;s0 rurxr no4lmtemicsl() Drr(mpnu1alenmi3tas mDrluvp u4tltoif oy1oatran s;(0 rumxmpoy4opt  icslt)sDurumpno0aleo i3ildfs2ra( s;(0tetrxo3totfptrlues;s0truoim no1ll  licsl(f Drrx oou1oeenii3iadlsDulump (0 eeoif3tydom raivslt trxrio io4ll   fes (fs2rm( ooo0oeeomietltlmDea(vp;t0teenir3iadla  lnes t)t2xo(o nu4am elnvtas)srtauroot4alxn i3tld a2ua( s (4 rxrir3oadfa eanvolt  2uo(rpoydlp nlfvsltf 2urxrpou4tle  f3tydls ua(vs;u4 etoircoydfmt  i o (  etr(r3ou1lmt  fcs sfaDtmxroot1oee mfciaslsDelu sn(4alerio iy1opt aueslt0teurxo3ny1om elncsl(fs2tm(rp;u0oleniictls s eanvo;t4tlenirciotomte uvi;s0 exo(m oy1al  mfci ()aDrr(mooo4alxnmoetltfm2emums;t)trerxocoytoaD  u slt0t2urim3ou4ll elivtlt s2trxmpnt1olx mfetydlsDuauvpnu) rtoxrcoydfaD aueolt  exoxm oo1lp emncil( a2umxmpoo1alx io3iydla ranvp;()trxnio oatoa e uvi t0t2umim oodal e ncsl()sDrmur ot0tet  ocilsfs2ea(mp t0 rtoxo3iatom e i i t0s2xoio iydoptnlivsas)sDrm(mono0opt  feiysfm2rlu s u0 eenxo iodlpt  n ils0trxmxopny4ll elfet tfs2rmxm no1opx mfcild sDeauvo;(4treoiociy1op  ai o;t)tetmio3no4ale lieil(  2ur(r no1oee mo3tasfa2umu o (4artnmocoatfateln s s tetmir iy4apee fvia()srurxrp;o1tpxo fctldla rlnmont4altnio tytlaDrlu s s)srxoir3no4ape  ivt () 2um(r nu4tlxomictlslmDum(vs;()treoxo3to1fateanes s0 2trxm nudaptemivs ()aruaxrono4tpx  o3tydfmDua(mp;u0 lenmr3tadfpte uvols  eurxrpnodllte ivi s  ruaumo;t0ope  ictlsfaDuluvs;t0tlxniociy1latrli olt)tetrxr3no4aptemnetlsfaDraxr ou1opxomoetltfmDrmn s;(4 rtnxo todoatelueils t2xr(r3no1am nlfvilt) Dtaur ;t1aee io3tadlm ulumo;t)aleniociotlmDe ivo;t) etrir3no4apt mivta() Drax ono0oetniociad s ea(vsnu)trtoxocio1fptran s;s)srxoimpoo4am  mncsltf rua( oot0apxnifctld m rln s u0tetrxo iytomtrau olt) 2to(opiodlltemivilsfsrua(m ;t4apto f3iyd a2rm( pnt4 exrmo3iatfptelneo s) etm(r nydaltn neslt  rur( o;o1tltn ociytfs2rlnms (4tleoxf3io1la  li o s)t2tmxo oo4op emnci t)sDtr(mont1olt mictad a2uln onu) rtoiocootfa rauei;t0t2um(o3nydap   nvia(faDrr(  nt1alxniociytfa uau s (0alxoircta1fpD anesls0srxmxm no4ame lnvslt  rum(m oo0tex  ietldfmDrm(vs u) renxr3ia1omteliei t0 2xo(m no4lltn nct s)s2umx  ;o1oleoiieiltfs2rmuvo;u0arxnmo3oodop eaneil( trumxmpno4ap  lnetlsfs2tmu  oo1tetn f3iydls2emumpnt0alenmocootopt ai ols0 2toim3oy1ope livtasf 2tau  ot0oexo ietls mDeaump;()arxoio3oy1oa eaneols  rurio3oudape lncs s)arta(r ou4aexn ictldla2rm(vont)arxrxfcoytlaDelu ils0texrxopnu4alen fciasfsrrm( oot0oee ifctld a2ul(vs;() lxomo3oytomDr i o;s0 ruoxopnydamt lnvta(f 2tmum ;u1tet  octldla ea(monu4 lxnmrctytfmte n s;(0srxm(m3oydam e fetat aruax o;t1tlto fciydls2elnvs;t)aeeomo ta1lat  u i;(0sexr(r nydlp n nvi tfaDrm(mpnt4texomieiysfm eaumsnt0texrif3iodfaDeluei;t srtmimpnudapt  fcs s sDtmu o;o1tetoiiciyslaDeluvp u) lxrxfctotoaD liei s0trtmio ou4lmen nci sfsDtrx o;t4olx mociltfsDulumo;u0 ltoxr3tydoptr nvilt) 2tr(o oy1ap  mfvt sf rraxroou4oexoii3tytlm2uaumo (4alxnmrciydomt  nvo s)t2urxopno1op nlicsat  Drru onu1optnioetatlm2elnvs;(4texnifctotfmtrluesls0 2uo(m no1lp emnci sf 2trxrp;t1tpeoioctadlsDumn o;u)artnmfctodop  ln o;s seumxr3oydomt  iesasf 2taurpoo1aexo fctadlm2ulnmp;(0 renmo3oo1fmDrln s;()trtr(rpou4llenlict t arumur ;t1oee  ociltls umn s (0trtrxociodla e ivslt s2xoxmpiu1ll  lncia()aDtmx  ;t1apt  ietad m2ulumo t0treoio3iotlmD  n s;()srtmxrpny1llen nesa( a2umu oot4oet mieils s2rm(ms;t)alxomr oatfm eaivi s)s2xr(o no1lpt lfctltfsDuaxronu0ape  feiat mDem(mont0 rtnmf3totfmtr iei t trtrim oodapte nvtlsf rtaum ;t0aeeoiocildfs ulu s;(4 rxrirciotlptrluvi;( s2trxo3nu1om nlfcslt)aDtmxro;u4tpxomiciyd a ra(mp;t0tleomo tydom ean il(0 2uo(mpnu4lp  mietlt)arra(mo;o0aexnmfctls s uln o;(4tlermr3oodla rluei;t)t2xmimpou4lp nlictas s2taxro;o4tpx  iciatfmDeanmsn(4trerxr3oo1fm elnes;t  rxmxopoydop nliet ()s2umumo;o4tleoioetys m2uanmont) eenif3tadoaDelivilt tetmirpnodopeelnvtatfa2umx ooo0olxn iciydlm2um(mo;t)tetnxo3oytom eaueil()trurim3oodlptemiei t)aDta(ro;o0oleomf3iytfm umn p t4 rtrif3tytfptrlnvs;s0 2trxo3io4lmt mnctlt)s2rmxrooo4oleo iciatfsDeanvs t0arxriocty1omt lies t)texr(rpio4llenmnvt t  Drm(  oo1ope mfeiltfm rmn p;()tltrxo3oadlm  anvo;( t2xmiopiy4oleelfei (f Drr(ro;t1aee  o3iysfs um(mpn(0 eenxf3iydlatean s;s t2uoxm3iu4olt lfcs s a2rau oou0tlx  ociadls ean s;t4tltnxo iodomDr n i ( trur(rpoo1amenmnvi ( arurxro;u1olx mictasla2uanvpnu4 leoir oydoa rlues;s0 2urxopnodam nmfcsat)aDtau ono0tltomi3tltfs2elu pnt)aexrxociydoa r ies s0s2xrio iy1lltn feta( arumxr nu4ole  ietlsfa ul(vpnt4 rtomocia1lat  n s (0srtoim nodlptnlfvtatf rtr( poo0tltnmi3iyd m2em(vp;u0aeeomr3iodfpt lueo;s)srxm(m oy1llenlies (fartaump;t4alx  oeiaslaDranvo;u4 etnio3oodoptr ieo t trurxr oo4lptnlfetat arrruroot1tpt ifetltfsDelnvo;(4treoxocoydfa rluvslt  ruoxo iy4ol  mfesat  Dtaxr no0oet mieilsfa rl(mont0 rtnmr ia1omD livo;t) eurxr3ou1lme lneil(f rumurp;u0aetnii3ias m2umn pnu0trxrxociydlmtrauvo;(0seumxm oo1ame mietatf Dtaxm ;u4oeto oeild m ean onu0 etnxoctytfmDe ieo s0seuo(mpio4alt  net t)srrrx  ;t1ole ifeiadlsDrmn o t)tlenif tydopteluvi;t trurir3iu1ap nmfctat)s2rm(rp;t1opx mo3iadlm2ul(vsnu4aetomfctotfp e nei t)s2trxm nu1ap e ici sfsrtaumo;o4oetomfetydla2eauvo t4 leniocoydopDeaueo;t sruoim3iydllte nci (fs2rmxroot0alxo ieiytfa el(vs t4 ltrxf io1lm eaiei;t teuoxrpno4llen ivi s)srtmxm ;t1opxn oetytla rauvont) eeoxr3todoat lneo t)s2tmimpnu1al nmnvias s2umx oou4ole  fctytlmDua( p;t0 reoif3oodomDeanes;s0sexmxo3iy1lm emfviat s2uaxr ot0olx mo3ilsfa2ul( o;() lxnmf3iatfate ues t0srxmiopno1llenlnvil(f Drmumonu4tee  ieiatfs2um(vp;t0 rtoio ta1lm ran o;()s2xm(opiudlmtemicils)srum(m nt1opx  i3iatfm um(mo t)trtrir oytomt luei s0tetm(o3iy4ll  lfcsa(  Dtrxmpoo0olt  i3iyd m eauvs;t0 rxnmo oa1fm   u i () rumxo ou4al n ictlsfa2ur(r ot4aleomociytfsDum( snu0 lxomocootfa rlies;(  exm(rpno4amtn icta(f ruaurpou0oeeomoctysfm rau sn(0arxomf iadfate uvs s)t2trir iy4lmen icsas) rrr( p;o0tpx iicils s2umumpnt4texrio3oo1lmtrai o () etmxo oy1ol nlfct ()artax o;o4tetn icias a ul(mpn(0tlxoio iotfateli o (0s2tmir3oodam e ivsls srumxr ou0tet  feiltfmDrmums (0 exnmrctydlmDrai i;t0t2uo(opnu1lm n ivt (fsrrr(mpot1aleoii3iat m2ea(mon(4tlerxf iatlatrau ilt) exo(opiy1ll  lfcil( a2tmx ooo1opx ioctlslm el(vs t) lenifcoatomDr ivs s)teumirpou4ll elncs (  2ur(  nu1tlx  ocildfa2rmuvonu4 etrmr3oa1faDeanvi s)srur(mpny1aptelictat)a2umurpot4aptnmf3tltfs2eau ont4 lxrxfctydom e ieo;(  2xm(r3iodop e nvils  2trxmpot4oexo i3ilslsDuanmo t0 exomocoy1lm e u s t s2urirpiodop emfeslsfaDrmxmoot1opxomfetadfaDul(mpn(4aetoio3iodlmte ivi;t0tetmxo3nu4apeelnvi sfsDurur oo0alenmi3iasfaDrm(vsn(4aetrxrctodom   u o ( s2umim3iudllenmiei (  Dta(m ;t4altn oeild mDrlump u4 eenmfcty1omt  ieslt0t2uoimpoy1llenlnvsls aDtm( pot4opx ioetatla2elumpn(0altrmo3iatlm  aieo s0s2trir no4altn fetls sDua(r nu0alx  i3tasls em( s;t)arermr3tatfp eluvi;( texrir oydaptnlieil(f Dta(  ot4texoiietytfaDuauvs u0tlerif totlptraivs t) rxoxo iy1lltn ncia()a2rm(ro;u0alx  fcilsls ea(vp t)aetnmo3oodfaD an ol()s2tm(r3nudap  lnci ( arraump;u4alxo ieiat s rm(vsnt0trtoxo3io1opDraueil()trxr(m3oo4lmt  ivtl( s2umump;o0alx  iciydfs2rauvo t)tlerxrcoytfm  aueilt)t2xmxm iy1altnlnvt t sDtmum no0olto fctyslm uanvs u) renmrciotoaDr nes;t0 2tr(opnu1opee ivs t sDtaxm ot4alx  fciad s2rm( snu4artoir todoa  anei;( srtr(rpoydllt lnvtat a2um( poo1oet mi3iyd a rauvp () reomf todfaD anvs s0s2toxm3ny1alt mivsas s2rmxrpot1tle iietlt aDuanmon() renif oadlp eli s;t0 euo(r iu1lmeemneta(f Drrxroou0aet mfetad aDran s u0texnmo ta1omD ai sl( s2trxmpou4lpt mnvia( srum(roou0tpen feildls2ea(ms;u) exnif3io1fat  uvi (0t2toiopiudaleemncs (  rumx pno1tle mfeiaslaDrmn s () exnmf ootfp eai o;t)truoxr3iy4op nlietl()artmxm oo4optomicildfaDum(msnu4 etnif3iydopte ieo t)teuoxrpiy1ol emivi () Dtmu  ot1tpxn fetyt sDrmuvon()artnxrctatop eauvslt0 2ur(m iy1lle micta() Dtrumpot4olx  feiatfs rln o (4arenxo todop  li s ()tetr(o nodlpt miet (fartmx ont1altnmfeiyt a2ul(ms t4arxriocootop ranvsl( sexrxr iu4om  lieta()a2ra(r ;u0oleomf3iadfaDrmnvs;t)aexoxf3iodlatean i t0sruo(m3iodaptn ivs sfsrumxm ou1alt mieildfsDuanvo t) rtrxoctytfp r nvs;( t2xrxo iy1lpt  fesls aDrmxmpnt0tlx  iciyt sDemnvon(4 lxnmo3ta1oa rai o t0trxrxmpiydomeelfeilt)a2trxm ot1apxo octydfs2uln onu0aleoxrciotop rli sls0t2xoxo3oo1aptemncta()srurumpno1altomictltla umu s ()tetrir iytoa  ai i;t)s2trxrpny4lm  lietlsfs2ta(m oo1tltnifctadfaDeln s () etoxrciotfaD livsls0sexoxopnudam n ics tf rrrxmooo1alxoioctydfa uauvo;u4arxrxf ia1fpt  ivo;s0texm(o3nudoptnlfctlt a2tr(r nt0aptniicils m2umu s t)tltnxf3oatlp   nvo;t0seuoxmpoudlp  mfvi s sDrmur ;t1tleomoetlslm2umnvo;t0tltoif oadomDeln s;t0trxrxopnu4om emict ()s2trxmo;t1aptn i3iadfm ranvs t0trxoiociydlp  lu slt  2tmxo3iudapt lnci s  rum(rp;o1tlxn i3iyt m2ea(vo (0 rerir tydlaDe u o;t tetoxm3ou1altnmnctl(farrax o;t4apxnio3iltfa rl(mo t)alerxocoytomtr nvi;t) etmxo3nu1openmncs tfa2uaurpnt1oex ifctad m el(vo (4aeeoio iytfpDrlu s t tetm(r3oodoptemictat a2rmum oo0aetnii3tytlm2ra(vo u4texoxocoydlmt  uvs t0t2xo(rpoy1ol  mnes sf 2tmum ;u0ole mieils m2rlnvsn(0tlxnxf3oo1laD  ieol( s2toir3no4lpe lnvtas)srrr(r nu4tptoif3iys a umn o u)trxrmf ootomDelnei;(  exrxr3ny4apenlicslsfa2ta(m ;o0tlt  i3iyt aDemnmpnu0 eenmr ta1fpDeauvils0teuo(r iy4lpe  fei t) Dumu oot4aexoiieiltls emumo;(4trxrxo iydfpteanei t0 rtr(rpoodlpenmictas s2trumpot1ole  oetasfm emuvo u0teenmo3tydopDrlu i;t0setm(m iy4lpee ivs ( s2raxrp;t4tex ifctadlsDea(von(4aetrxo3io1oatrau o;t)srtmxmpou1amtnlietlsfarrr( o;u0aptn ictat mDumuvp u0 exomf3ty1latrai o;t)trtmxrpiy1omtn icslt) Dtaur nu0olxnmo3iyd mDelnms u4tlxoxociy1fmDrlies s) exrxmpio1lmtn nvi s  2ua(r nu4aleoif3iad m2ua(msn(0texrmfctydfpDelu i s0sexrxmpoodopt mnesl()sDumur ot0ale mi3iadfm ran s;t4trtrir ty1om elu i (0 2xoxo ny1op elnes t  2ra(rp;t0alt  ictlslsDrl(vsnt0 etnxf3totoptr ieo () rxo(rpio1op nmietlt  rra(  ou4oee mieiasfsDulnms;u4 etnxr ootfmt livslt t2umxmpio1amtnmfetl()srrr(mont1alxomictld m rl(mo;u4teeoir iatfatr u s s srumxr3oodol  lict t) Dtmu oou4opxoifctlsls2ul(vs t0 lerxo iatlmt  ivo (0 eumxm3ny4amt mnes (f rtmu  ou4alx  f3tas sDrm(mo;u4tltrxr3iadfmDrlnvol(  eurim3ou1optnmfcslsfaDtaxmono1olx  ictls sDulnvsnt0treoio3oa1oatr ies;s trurxopoydaptnlics ()arum(m oo0apen o3ild a2uln p;(4teenif tydoa   neo (  exoxo ny1lp nmivt s  Dur(ro;u4tpxniieiyd a eauvo (4 rtoxr3oo1fatean s s)t2xm(rpoo1op n fetlt)srrr(  ou4oetnifeiyt aDra( onu4aexoxf oy1la   uvsl( s2tmxm3nu1altn net tfaDta(rono4tlxnmf3iatlsDea( s (4 ltrxfciy1opD lieo;t)setr(o3nodopee iei sf rtax onu1optoioeiasfmDum( p;u0tetoirctydoat  uvslt  2xoxopno4ap  mfctls srtru  ot0aexnmf3iat s2ean snt0aeenmo iodom  lieo t0 rxr(m oo4op  lfvtls)artm(moou1opx  ictld aDrauvp u0aeeoxocia1fpDraues;t)srxo(m3oy4op elncsltfartaxmoot1alxn ieiltfsDuluvsnt) etoioctydopDr neols teurxm oydlltn fci s aDumuroou4tptomi3ild s rlnvonu0 rxnxr ootoaDelneo;s srxrxrpiodop e fctlt)s2ra(  ;t1aexomo3iyd s rmnmon()aeermo3ty1fp r ues ()srurirpiodam nlnciasfsrrmxroot0opxomoeiatfaDrln onu0arxoircoadfmtelivi;s0s2umxo nu1lm nliei sf Dtr(m no1ale moeiytlm2ranvp;(0tltrircoydoaD lnvols)seur(rpiu4ame  neta()sDtrxm ot1aexoio3tydlaDul(vo;t0texnxocto1fmDrluvolt)srxrxo nu1al   fvsasf ruaxmo;t4oex mfeiysfm ea(vsnu) etoir tadomDr iei;t)trtoio no1aleelnvs s)sDrr(r oo4opxomo3tys m ranvsn()trxrir3ootlatr uei s teto(mpoydll  mfctl(f 2rru  oo1olx  feiydfmDea(vo () lenxr3oydlaD aiesl( t2trirpno1oltnmiciasfa2tmumoot4open ietysfs2ul( o (0tlxrmf oa1oa  anvs;(0 ruoirpnydapen ivsas)artr(rp;o1tetn feias s ua(vont0aeeoxo3to1lmD aieols texrio oodoptnmnvi tf ruaxm ot4ole  iciatfa rauvs u0 etnxo3todoate n i t0t2tm(mpoodome  icta( s2tax oot4tleomoctydfm em(ms t)aetrxfctodfat liesl()teumimpny4amee ivs t)s2urum ;u4oet mi3tldfs2elump u4tlxoxf ia1faDe ueo;s0t2uo(opnu1omeeliciltfsrtm(rono4ale ioetadfaDulnvp;u)artoxr3iatomDe ues s0 2toxo3nudol nmicsls)aDrm(rpoo0tee mietydls2ulump;()areoxrcoadfpteaivs;() rto(m iy4omte fes (fsruru  ou0aptomf3iyslm2el(mo;u0arxoxr3tadopD ai o (0t2xr(r iudope lieslsfaDrau  no4tlen octlslm rl(monu)arxrxf io1omD  n s s0trxr(rpiu1amenlnvta(f rrm(mo;t0tlxn ieiltfs ra(msnt4trtoxfciotoat  n ilt)trtoimpny1op  lfcsatf Drr(  ou0opxniociat m2umnmp (4alermfcoa1fateaues;(0t2tmir3iy4lpenlnctat  2umump;t0aleomf3iadlsDea(vsnu) etrio ootfaD anvi;(0 rurxr3iodalt mnctat  2tmx oou0tlxomf3iad a ua(mo u4 exoxo3oydomDe i o;s)s2umim3iydopt lfet (farta(ronu1apxoiiciltlm2umu s;t)altrmf oatlpteln s;t)truo(o3io1lleemietls s2um(r ou0tpe moeiasfmDumn o;u4trenio tydfaD  n s (0trum(m ou4lmt  iesat  Draxroou4tpt  ociasla em(vp;t0 exnxo3tytlptrluvs;() exr(m oudameemfvils aDrrumpou1tlenmoetat s2elnvs u4trtomr3iotom  ln ols  rum(r3oudaptnlfvi s)artrxrpno0aexn f3iytfa2um( onu0texoif3oy1oa rlu s;s texmir no1omt mietlt arraum oo0opeo ictlt a uluvp t0aeerxr tatfm r nei s)s2toxm3no4amtn ivsl( sDrru pnt0tlenmocilt mDeaumo u)trxnmoctatopt livs (0seuoirpoydop  liesl(fsDtr(ront1tptomoeiytla2ulu s t) rtrmr3oydlaDeaiei;(  eum(o ou4al  livslsfsDrr(r nt4opxn i3iatfm ranvo t) rxomociytlmDrluvo;s  rxmim3iy4omt  iesls)a2tmu onu0opt miciydlm2uau ont)tlxomo3io1opD  i ol()trur(rpiy4op elfcsa(  Dumx ono4altomfctltfa eauvp u4aetnxfcoatfm rau i (0t2xmxr iodamte ictasf rta(  oo1aexo fciydfsDul(mont) eerif oy1latrli i s  eumxm3oydllt  ivi t srurx oou4olxnmocilsfa2rlums t0teenxo iytoa  li s s0teurimpnodol elncsa( a2rmum ;u1opxoio3iytfaDeaums;u0 eeoxr oadoa eli s;s)t2xmim ny1omenlfeils  Durxroou0opto f3iydfs2eau s ()trxoif oodfp eai olt0t2xrxo3iodlleemneiltf rrm(rono1aeen f3tltlmDuanmsnu) ltoxr3oy1fmtr i slt0sexr(opiydopt lfesl(  2umur no4opx  fctltfs2rmuvpn()aetomf3oy1lat  i s ( s2umxo oydol  lfcs s s2rax o;o0opxoif3iatlmDuau s u4tlermf oodoatrlu olt teur(opiy1lmtelietas)a2umump;o0ale mo3iytfsDel(ms;u)tetrxr3totfateauvi s)s2umio iodlpe lnesltfsDtr(r ;t0opxniiciatfmDraump t4aeenmoctodfp r n o;(0texmxm3oydopen fciasf Dtaur ot4tpx  oetyt m rlumsnt)aetoio oatla rai s;() 2toiopiu4ame  fvsltf rurxm ot1tetnmictatfmDea(vp;t0alxomo3iydopDraues (0s2xoio3ou1al e ies sfarta(mp;u4tpt  ietls s emnmo;t)aeenmo oa1lmD aneo;t)t2xo(o3iy1lp   ncsl(  2raurpnt1oex ioetadlmDelump t4alermf3tytfmt  ivols0t2trxo iudome  fet sfa2uru pot1alt mieildfm emums u4artnxfcoytfateluvo;s srur(o3oo4am n fcsasfs2rmx  ot1tlx mfctadfmDrlnms t4 rermo ootlaDr nei t0s2xm(m no4ope  icsat) Dtrx p;u0tlto octls a rm( snt0aeeoxo3oytfpt ln ols t2xriopnudape  fetl( arur(r ot1teenio3tat m el(vs;() eeoxociotlpteanei s0 exmiopny4olee nesl(fs2ua(  ;t0alx moeiadfa ul(vsn()aetomfcoo1oaDe nes;t) 2uo(r oydam e ies t)sDraur nu1apx mi3iys s ua( snu4alxomfcoydlpt ai o;( trxrxo3io4alt mics s aruaur ou0ope iicias mDranmo t)aexrif3oa1lmteln sl( t2trxo3oo4omt lfctat) rurumpoo1olx ifeildla um( p () rerio iatop rai i (0 2tmio3no1olt mictl( arumumpno1aexo ictysla2ulnmsn()tleomo iy1fa  anvo s)teum(opoy1om  liesls  ruaum no4tpe moetldfm2ean on(4 rtoif tydopDrlnvils  etr(m3io1ll emivs s)s2ur(m ou0opt ioctadfs rmuvp u4 lxnxfcoydoat li i s)sexrio ou1om emfctl() 2uaxront1tleoii3iytlm2umu o t0artomocoatlpD  neo;()t2tr(r ou1omte nei s sDumxrpnu4apxnmieiytfm2umn s ()texomocoytla r uvs;t teuo(o3nudomt mietas s2uax o;o0optnmoctadlsDumu o;(0teerxfcoytlaD  nei;s0 rxrxmpoudoleemnctl(f 2tauronu0aeeomf3tydlsDrm(ms;u0tlerif3oo1oa r ivo () 2ur(mpiu4openmici s arrauro;t0oleomoetysls2rlu s;t) rtrircoytlmDr uvs ()t2xrir3iodllt mivsat)sDrmxmooo1oeeomoeilsfaDemu o (0aexnmf iotlpt an ilt0 eurir io1amtemfetlt)sDtrxm ou0opxo f3iytfaDeanvsn(0arxnio3io1faDranes s sexrxr3io4am n neils)artmx onu1apenifciasfs ra( snt) reoxf oatomt lieo (0srum(rpno1aptemnctat)srurxmp;o0ale  i3ias a ran p u0trxrioctatlp  lu i s0 2um(r ou4open net tf Dur(  nu4ole  ietldlm2uauvp t) exoxo3iatomte ueslt0 exrim3nydlle liei s arrr(mp;t1tlt ifctysfm rmuvo u)aetrmfcoodlptrlies;( truo(r3iydlmen ietlsf Dtmxrp;o4olt ifeils aDrl( o u4 renxf totlptranvo;(0 2xr(r nu4ol e nci (fsrurxrp;u1aetoioeiltla uanms (0trerxr ty1omtrai slt tetmxrpoydlmt lneia() 2ua(rp;o1apxoifeiad s2eanmo;(0 rtoifcty1fm eanes;s0srtmxm3iy4lp   iei sf 2tmu o;u4tpto f3taslaDuan on(4tlenxfciytlpDranei;s srxrxr ny4opt mivtl()aDtr(  no4aexnmi3ilt a2emn p;(4 exrmf3tytfm rau o;()trxoio3io4altn ictatf Drmx p;t4opx mfciydla2raumpnu) rerio3ootfat luei;t0teuo(m nydome  ivt sfsrtaxronu0apeo ociad mDumu onu4tetrxo oo1la   nes;t)seur(o3oy4altnlivi t aDrr(rp;t0texnii3iadfs eln o;(4teerif3iytlm  li ilt0s2tmxopoy4opee ies t s2rmxr nu1tltnmo3tltfa elumo (4trxrmo3ootlat lnvo s  rxm(opio1opee fes t sruaum ;u4tpxomociltlm2um(msn(4texoxf3todfatean i s0truoxo io1ll  lnctlt srtaxrp;t0alxoii3iltfa2rm(vo u0aetnmo iatoat  uvols)seuo(r3nu4llenlnvi (faDtmxro;u1aexo ictyd s elnmp (4aexrxf todlmDrlu sl( srxr(m no1amtnmneiatfa2umu ooo0optniieildfa uanvs () renxr3iodlpDelnvi;t)srtrxr3ny4lpen fcsat)aDrrump;t1aet mi3tydlsDuauvsnt) exnircoodfp eaivilt) rxrxopoo4amenlncta( artrxm ou0ape iietatla ul(vsnt4 ltrmf3ty1lpte nvo;( seur(r io1omt lnesa( arta(m ou4opxomfeiysfaDum( s;t0arxrircoadlpDran i;t trtmirpno1lmt  ict () Drrumpnu4opeo f3tadlmDem(mo;()tlerxrctydfmD lu s;t)texriopiu4ale mfes s) Dtmurono4oeeo fciatfa ea( o;t4tetomoctodfpDr ivsls0sexrxr iy1lle mietat)arurxm oo0aet  iciatfsDuaums;(4aexnxf iatfptelnvo;t) eumxo3iodlmeemfctas s2ur(r ou1tpx  o3iat m uau p (0 rtoio ootfat lnvsls) 2xr(m3no4olte feils) Dtm(  no0alen feild mDulnvp (4trxrif iy1oa r ivo;() rxmxm iy4llt micsltfarururp;o1tlto iciytlmDuanvo t) lerio iodlmD luesls0 2xmxr3iudlp nlnet () 2rmxmp;o0texomicilsfa2rm( sn()tlxomoctodfa  aies t) exmxm iy4olenlivsatfsDurur ;o4opxo ociltfm2uanmo;t)treomoctatlpD auvo;s s2tr(mpiydal nlfei (fsDtaump;o0apx mfetasfs ea(vo;()treomf3tatlp r ies ( tetmxm ny1am  mfesl( a2tmxmpou4tleo fciytls2ua(msnu)alerxocoy1fm   neo ( tetm(o3ny1ol e ncta(  2trx poo1opt ifeiyslm2ranmon(4 reoir3todomD  uvs s)srum(m3nu4lpenmnet (f 2umx o;o0aetn i3tytfmDrauvsn(4aeermocootoptelneo t0tetoim3io1lpte iesas  Drm( pot0texn oeildla2rmu pnt)tetnxfcta1fmt  u i;s0teumxm3oy4am nmivtas)a2rmxmpno0oex  ieiyd aDemn snu4alxrmf3ty1fm eaiei;t)tetm(opoudolen fcia() rurumo;t0alx mi3iad a2ranmsnt0alenmfctotomtrlnvo s0 ruoxr oo1om   fvtlt s2ta(rooo4aexoio3tatlaDemumo u0 ltriocoo1lmD  ivolt0 rto(opio1ap nmfeiat)sDuru oou1oexo octlt s2ul(mpn(4artrio iydfatrli o;t setrir3nudape  fvilsfaDrru pot1alxniieiyslsDumnvo;()tlermo3oo1lpteaieo;s  eurirpiu4lmtelici tf 2ra(r ot0apx moetlt aDrlnmont4aexnio3ty1oa  aivsl(  2xrxm ou1alee feias) Duaur nt4apxoiieiyslmDul(von(0tlermrcoytomteaivo ()t2trxrpiu4llt  ici tf rum(r ;u1olxnmf3iasfmDeanmp u0alxrxfcia1op eai i;t sexr(m3nodlleemneilt a2umxmo;t0tleo feiysfm2eanvp (0aexnxr ootoa r nvs;() etr(o ou4am   iet t  Dtr( p;u1altoiociasls ra( on(4aeeomrciydopteau slt0seto(r3io1ape livt ()sDur(ro;t4tpxoif3iatlm uau p;()trermr totomtraieols)trxmir3oydlle lncs tfs2raumpnt4oeeo i3ils m emu p;u) ltrmo iytfmteliei;(0 rtr(opnydalenmicilt)arrmx onu0tptoio3tasfa2rmuvs;t0 exnmo3iy1lmDrau ol()srxoxmpnodamt mneias)a2tr( ooo0aex mietldfs2rm(mpnu)altnio oydoat an o t0srtr(rpnudlptemncsltfa2tmum ;o4alx ifeildfs el(vonu4aetnir iotfm e ueo;t) rurxo nu4amt livsatfa2rmurpoo1tetn i3ils m rl(vp (0alxrmr3iatlmD li olt) 2xoiopoo1lle lncslt)srtmxr ;o1tex  fciytls2elumonu0 lxnxr iytomDr u o (  rum(m3oudllenmfcil()srur(mooo1tpxn ietlt a2uan p (0tltnmf3oydfatrlnes (  etrxrpou4amt lfesatfa2tmxmoou4apx io3ildlsDrlumonu)tleoxo3ta1laD lueilt) exrxrpiu1lp n nci s srum(rp;o1aetomfeiys m em(vp;t)tetrxo3ootfp eaies;t0srxmxr3no4amt lfesas aDtru ont4teeo iciytlmDulu p;t0tetoxr3oadfa eanesls0srxmxr3iy1alt mnvslt a2tmxmont0teeoii3tatfa2emumon(4aetrircoytlm eai slt)s2trxr ny4olt miesa(fsrtru pnu0tpxnii3tldlm uaump (0aeerxoctydfm rln i (0s2trxm3oodam   fcs t) 2umxmp;t0oet mf3iyt mDrmu ont4 etnxoctotoa r uvo s0 rtm(o3oudapt mfcs ()s2raum ;o1altnmictytlm rmuvs u) leoio to1lp r uvslt0setoxr iudapte nvi s)a2um(roou4ope mo3iltla2ul(monu)tetnxrciadfm  lnes;t0t2tm(m io1amee iei sfartax pno4tltoif3iat a2umnmp t0tetrxrcto1oa rli s ()srtm(r3oodll   ncils)aDurx o;t1teto o3tysfm2uluvo;(0alerxfctodoptr i i ()t2trxo3oudopeemneiat)arua( o;u1apto f3ilsfs2ulump;u) ltrmf3ta1fmDrai o () 2tmir oo1aleemivt s) 2tax  nu1oltomiciyd m um( o;t)arxnmr oytlmteai s;t  etrxr oy1op  mnesat sDrrurooo4alt ifciyt m um(ms (4tlxrxo ootfatr ueo s) 2toxrpoodll eliciasfsDrmu pno4oeeomo3iydlsDuan p t4tlxomociotfatraneil( t2xoir iu1alenmietatfsrraumont1alxn ociyt a eanvon(4 lxrxo3iytfate u s s) rtrxo iu1am nlivil(  rtax p;o4tlx mf3iadfsDeanvp t4arxoxo iadlm rauesl()srum(r oo1amtnlncsl( aDtrurpot4aee ifciasls2uluvpn()tetnmfciodlate ues (  exmxm3no4llt lnvi (  2uax pno0tle mociytlm2elnvp (4 lxoiocto1lat lu ilt)teurim iy1altemncs t)aDur(mo;u1tpt mfctasfaDeanmo;t)trxrmoctatlp   ueo t0 etrio3no1oltnmieil(f 2raxrpno0aet mo3ias m rm(vo;(0tetrxr3iotlptraiei;s  euoxm no4lp   ncs (f rrr(  ;u1opxomociysfaDel(mp u0altrxr ia1fat li s;t)t2urim iydolt lncilt) 2umxmont1oeenii3tld mDraumo u4teeoxrctatfm r u sl( s2tmim nydam nlnvt t) Drmu oot1apto fctlt a ean s t4arerir oa1optelu i;()texoir iy1amee nvi s  Dtaurpno0apen iciltlm2ran s (0alxnir iotopDrln i;t) rxm(o3oodlptnmnet (f rtr(mono4teeoifeildfsDum(vpnu0 lxnxociatom  lues t sruoimpno4optemfvt s srumxro;u4tlxnmo3iasfm eauvo;u0aetomf3oodfmDrlies;s0 2xoxo3ou1lmtnlnet s)s2tm(  ;o0apt mf3iat m raump t4trermoctodla r nvi t0t2toxr3iydomt  iviltf rrrx  no0ole ioeilsls el(ms (4tlxoircootom   n ol(0seumio oo1ap nmfvsl()sDtr(mpot1oltn icilt aDem(ms (0texrmociy1om rau ol( trurxrpou4ll nmivtas s2rrurp;o0oetnmociasfsDran p (0 lxrif3oydfmteau o ( tetm(rpoy4openliesas arraxr ;u4tetn oetldfs em(vs;(0aex
\ No newline at end of file
@@ -0,0 +1 @@
+u o (0s2xrimpoo4am nmnvsatf Drmxr nt1opx  o3ildfa2elnvo u)altoxo3oytfa rli il()srxoxr oo4apeelfvsa(fs2tmxro;t4ope io3iydfsDem(vont)trxnif3oadoatelu s t srxoirpio4lme mfcsatfa2trxr ou1tle miciasls2emn o;t)aeeoif3iy1fpt ai o;(0teurim3iu1alt mies ()s2ua(r ;u1tptomfctys mDuau onu4 rtnxf todfm e iei (0t2xmim oy1altnmici t) Dur( o;t4tltoii3iad mDumnvont)tlxomf3oadlpD aivils)trtmio3ou4opeelfvsas) rtrxm ot0tlt mieilt m rm( s t0aeenif tydlaD lneilt)setrir nudameelfvtls s2ua(mooo1alt  oetatfaDeau s u0 exoio oatomtr ieo;t0s2xo(rpoudlmtelfetas aDtm(mono4aee iocias s ua(ms;t)aeenxo totoa  an s;(0t2tm(m iudoltelivslsf Dtmxr ou0tpx  fciaslm2umuvp u)arxoxo tydlpte uvo s)t2trio3oo4open iciatfsrrau onu1tlt  i3iadls ulu onu0tetoxrcoadom  lues ( srtrir ou1lpe mneta(  ruax o;u4tlenifcildfa2eau s (0 eeoif iodfmt auvi ()trurxm3no1ll elfeslsfsrrm(r ;t4ole  i3iadfaDrmnvo u4trxrxf3ia1fa  ln i;s setmxo no1lmte fvi (  Dtmumpnt0alt mi3iydfsDrluvs u4alerif3oytoa   n s;s)srxmim no4lp nmfci ( s2raum nt1oltnmf3iysfs2umu sn(4 rtomf3iotom  lu s s setrxr3no1olt  fct t s2ta(mo;o4oltniieiat s rlnms ()trenir tatfatranvi ( sruriopnu4lmtelfci tfarum(rpnu4tetnmieiad s rl( p;t) eeoxr ia1lpteln s t srtr(m3oy1lmt mfci sf rrrx oou4tpe  o3ils s eluvs t0 exrirciatlmtean i;( trxr(m3io1aptnmnvs s s2rrum ;t0apenmi3tltlaDrl(vo u0tltnxf oo1fmt au ols) rum(r ny4om e nvs s sDtrumpnt4ale ifctlsla ulumo;u0trxrir ty1opt  n i;s0t2tmxm no1ameemnct sfs2tr( poo4tpeniietltlm2umuvo t4tltrxr3iy1lp  lnvo (0srtoiopiodale liei sf 2rau  nu4tlenmieildlmDrluvs u4areomo3iotomDrli o;(0srxrxo3oodoptemfcsat  Dtax  ;u0aleomieils s2umu p;u0 etrxo3iodfp rai o s trum(o oudlltelnei t) Dumurpou0aeeo f3iydlsDuauvo (4trenio totopt aivs ( t2toiopiy1lle lneiltf 2raxmo;t4oltnmiciat s2ranmsnt) rxoio3ty1lmDrlivo;(0tetrim nu1lpt mncia()arrm(rpnt4tet  fciysfaDrlnvpnt)tetnxr oytfm r uvo;s) rto(m3ou4ape mivs sf Dum(  nu0ole moctytlm2umn p u4 rxomfcty1lpD lu sls0s2umir iu1llt lfvilt) Dtau o;u4aexnifetlt a2eln o;()areoxr ia1fatr n s s trtrio ou4olenlfciat a2rmu  ;u0tlen i3ias sDel(vs;t4aexomr ootomteanesls)sexr(m iydop nmfcsasfsrraur nu1tpto f3ildfm rauvo () rtrmrcio1faDelnvo;t)t2xrio nu1alt lfvsl( sDrr(r ;u1teen octas a2rm(ms;t) etoxf3ia1lp  lues (0 eum(o3oydalt  nvsa( srtr(ro;o4tetoifetlsfmDum( pn() etnmr3oydlpD lieo;t)seur(rpno4aleemfci s artau ono0oexn i3iltfsDumumpnt)aleomr iytfpD  n s;s setrxm3nu4ope  fei s  2uaum no1tetnifetyd m2rmnms;(0arxnxo3todlmteanvs (0 2xm(r iodal elfvtatf Dua(m ;t4alxniictls mDel(mp u0arxrmf to1lm   nvo t0 rxrxm3oy1oleelnei s aDrm(rpot4tltomo3iatfs2rmump;()aeerir3oadlmteaivolt  exr(r3iodap n icsat)s2uau ooo1aptomiciadfs2ua(vsnt0 eermo3todop r iei (0 eto(r3nu4amt  ncsa(fsDuaxmpnu4aleomfcilt aDelu s;(0aetrmr iatlpD aies s  2um(opoo4ol  licsat)s2ta(mont4tpxomi3ildfs2rmuvpnt)trxrxf iodfm r i ols0 ruriopiydop n icsat a2trur ou0tlxoiociydfaDea( snu0arenxr iy1lpDeluvo s0truoxrpoy1alt lncs ( sDrrxm ot4opeoioeiyslm rl(mpnt)trtoircoo1fm rauvs;s) etrim no1ll emicsl()sDtmumono0oeeoio3tadla elnvs;t) etrxocto1laD anesls)trtrxr nodome mict sf Drr( ooo4tpeoii3iytlaDelu s;t)trtomf3iy1om eauvo t)sexmxmpnu4om elictasfsDrrx onu4tpeo ieiad mDeanvp t4 leoir3ta1op elies t0texrim ou4ope lnci tf Durump;t1aex ioctyt s el(mo;u4aeerxf3oodfmteln i;t)t2xm(m oy1lptelfvslsfartaurpno4aeenio3tydls ra(vsnt)trtoxr3tatfpD  nvi;t trtoimpny1llt lnes tfsrrmu pnu0tlenmieiad aDuanvo;u)tlxoxf3iodla rauvsls) exrio3oydll nlfvtltfa2rr(  nu1texniociat a ulnmsnt4teerxo3tatla eai s;() 2uo(m3oudaptnmieiasfs2um(rp;t4alx  ictydfs eanmp (0alxrxr3iytopDeau sl()texmio nodaltemiesls  2rm(mpnt1olxn fetlslaDum(mo u0tetomr3io1fpDe nvil(0srxmiopoodal nmicta() rra(r ;u4altnmoetydfs uluvonu0trxrifcoo1fa elues;s0 rxmxopiodame mnei t)srumxm ;o4alx mo3tasfs2ua(mo;u)artnmr3iotomDeauvi s)trtmirpiy1lpt mfvsa()arrru pnu0tetn feiatlm2rauvs;t0areomr iotoaDraieo ( s2xmxr oo4lmt livsa(fsDrmx pot4aee  oetasfs umnvpn(0arxnxoctatlmt anes s)srtrxo3nudlmt lfcslt arua(mpnu4texo feiatlsDemnmpnt)areomf3iatfp elneil() rtmxr3oydoltnmfvsl(fa2rmxroot0ape moetlsfa2emuvpn(4 renxf oa1opDeaiei t t2uo(rpoy4lpee nviatfaDumxm ;o1aetn iciysls el(mp;t4 rtrxo tadlpD  iesls setrim3io4openlnei s srurxm ;t1olxn fciasfm emn o ()texnmf tadopt  ivil()trxmxopnydapenmnvils)s2raumo;t1tltnmietasfaDranvpnt0trxoxo oy1fp e uesl(  2tr(rpou1aptelivsat)aDtru p;u4tpeomoetadlsDua( p (4 rtoiocoatlm   ivols0sruoxrpnudapt livt sfs2ua(m nt1apt iiciydlm2emuvonu)aeenxo oydlatrln s s t2xm(m3nydamenmncilt)a2rr( ono4tpxnmieiyslm2rau snt0artrmfciotlmtrlu i () 2xoirpio4ap   nvt t s2uaxr ou4altniiciyt mDuanms;u0texrxocta1opDeanvi s)teumiopoo4ll e nesa(fs2ra(mo;u0apt  i3tltla um(vp (0 lxrmfciadopt  iesl() rxr(opoudope lfcs t) Dtm(  ;t4aptomf3iysfa2emu p;(0 rermrciy1omD aieo s0 rtr(r3iy4lme lnetlt) 2taxr ;o0olt iociytlaDraump;(4 rtoio oytfpte nei ()trtoxopiudalteliei s)aDuau o;u4tetomoetltlm2ulnvp;u)altnmr iytopDelneslt)texriopiu1lmeelivsl()arrm( pou1apxo oeiasfmDum(vo u4tltomf3oatlat luvs;( t2xrxr3iu4olte netl()arrmuroot1tet moeiysfa2rlnvs t0aleoxo oytfm  ln ols trumxopno1lm emncta(f Drm(m ;t1tetnifctld aDea( o (0alenif tatoaD aivo;t0 rurir iydamen neilt) 2rrxm nt4apx mocild s2rmump u0areoircty1laDraivilt  rxrxm oo1ape  iei (  Dtmurpoo0alxo ictlsfaDel( pnu4aeenio ty1la eln i ()trxoim3iodoptelivt (  Dua(rp;o1opeomoetlsfsDrmnmp;u0aetrmf oydoat auvi s) 2uo(o ny4apt mieias  Dtmx poo0alto o3iydfmDrl( sn(0 lxnir3iotop eaneo t texo(opoy4opt  ics (fsDrrxr no4apt if3iysls2rmuvs;u0 eenmr oytfmDeaueil( seurxo3oy4op e nvi sfarrmx  ;t4oet mieiyslsDeanvs u)aetnmr3iotlpt auvo s)tetoim nu1alt lnci t) Durumo;o1opx  ociat m2um(vp;u4alxoxfciy1omt  ivs;()t2xmxrpiy1alt  nei tf 2ra(ront0teen fciytlm2ea(vo;u0arxnxr tydoaD aneo ()sruoxr iy1omtnlivia( sruru  no0ale ifctysla2rlumon()tlerir3iadoatelnvi t  rxo(o3oudlltemfetlt srrmxr no4aeenii3tls a2uaump u4tltoxo ia1op rluvi t0 rumxo3ou4ap nmfesa() 2ur(mpnt1oetomicildfaDemnmpn()tetnio oy1lp elneo t)t2xm(o3oodoptnlnctlt) rrm(mpot0ope if3tldfmDrm(mon()trxoxf iadfm rlivil()tetr(o nu1lmenmnvs s)aDumx o;o4aee mf3tldfaDrlnvs;t)texnir iydlatr i sl() rtoxmpoo4optn fes t)arur(rpou0opx ifcilsfm2rln o u4 reoxrciydfa rlu s t  rtmio3nodalte nctatf 2tmxrp;u4openii3iys s2ranvs;u0tlxnmr iodop rau s;(0trur(rpoo4lpt mneil(f 2um(rooo1olxnmfciatlaDuau s;t4alxnxf tytlateln s;s0 rurxopno4altnliviat)aDum(mo;o4olxnmf3tyt aDulnvsnu4teeoio3iodlpDrli sls) eumir3oy1ale lnvta()sDtaxmo;o1ole  oeiyslsDrl( snu4 exrifctydfaDeaneo;t0trtoxmpiu1altn neiat s2tau  nu4olto feilt a um(vo;u4 rermf oadoa rai o;(0 rxoxr3io1lmen fvsl()a2ra(  ;u4tlxnifeildlm2ulu snu0 reomo3todopDranes;( s2ur(r3nu1amee fvil(fa2rrxrpoo1openifctysfs2rlu p t4tetnifctytfpt lneo;t0tetm(m3nudlmee ncta(fs2tmu o;u4tpen octlt a uln on()tltrmr3oadfmDranvo;s t2uoxr3no4omeemfeta(f 2tr(mp;u1tet  ietas sDulumo;()aeeomr3oy1fptrau il() rxoxr ny4lle liesa(fsDra(mpnu1olxomoetls aDuau pn(0tltomo3oo1omtrauvols tetm(rpio1al n ivs ()s2rau p;o0tlxo ietlsfmDul(ms u0tlxomrciodfpD aivs t t2trxr3oy1ap e ivt ( srrr(rpnt4ale io3ilsfm elums u0alenmrcoodfp rln ol() ruriopnydape mictatfsrrrur ;u0tpeo o3tldfmDeauvpn(0aeerxf3ootfate ueo s0teuo(opny4olee ici (faDtmx oou0oet mf3tld a emumpnt) rtrxo3iytoaDeluvi;s0 2trxrpoodalee icsasf rurx ono0optoif3tys aDelu o;(0aeenmo iydopD au i;s srtr(o3ou4ll  mnvi s) Drrxmooo4ole  ociyd m2um(mp u)aleoir3ty1om eluei;s  etmxr io1ameelivils aruaumpoo1alenmieias aDulu s;u0 etrmr3oa1la e i o s  rxmirpiudape  nctls)srtaxrpnt0oeenmociltlaDelnmp;()arxriocoatlm e ieols0tetr(m3oudol nmfvil(f Drr( p;t1oexn ieiydfm2el(vo;u)tlerxf iatfmtraneil( trtoim no1amt lnvta() 2tax p;t0oex iociadfa ea( sn(0aexrxo oa1fmtrlues;s  exrxo nydole  netls srtm(rp;u4oex ioeils m eanvp;(0tlenxr3tydlptrlueslt0seurxo ou1lle mfctl()aruau p;o0apx mi3iadfsDem(vpnt0tltnif iotomD lnvs s0 rtoxopiydamt  nvs t sDta(  no4oeenmo3tlt m2umnvs;u)teerxf3tadom   ivs t sexr(o3iudopeemfcsa(  Draurp;o0tpe ifetad s2rmu pnu)tltoiociodoa  luvo s sexoimpnodlmtelnetls  2trxrooo1alxoiictysls2em(mo;u) lerxociotlmt anvol(0s2tm(rpiu1aleelfvia()a2raxrpno0tpt  f3tyt s2ranvp t)alxnir io1fa elies () eumio3oudaleemfciat srrruro;u4opxomoeiltfaDuauvo u0arxrmf iadlm  ai o s  2xo(m ou1lmt lieil(f rtm(mo;t1olt  o3iatls2ranvp;u0 rtnmocoydomDe ieil( s2trxo iodopeelnvtas  rumx o;o0opxn i3iyd s2ra(mp t4texrmf ootlp   i o t) etm(mpoy1ap  lnvta(  2ua(m no0tltoii3tyt a eln p t4alxnxfcty1oa  lu sl(0 ruo(o3ny1lp   fctl(  rrm(r nt1alx mf3tyt m el(ms t4trerir3oa1fp eluvs;( texmimpio4omen nci ()aDrr(r ;o0alxn iciysfa2ulnvpn() eerxo iotfptrli il( trurim oudlp nlieilsf 2uaurp;u1oex ioeiatls umu o u0trtnmf3iatfaDe i o;s0srumim oudole lfctat aDtmxr ;t4tet  ieiytfm rmnmp;u0 reoxrciydlpt lieils)srur(r io1olte nctltfs2ta(  nu1apeo ictls m umnvo;t0 eenxrciodfpDrlies s0t2uoxo3ny4ope  feil(fsrrmumo;o0oetnmfcild aDrmumo;u0 rtnmoctadopt livi s)s2uo(o3iu4ape miesa()a2uaxr ;t1ope mo3iatlm ua(vs u0 eenmf3tadoat aies;()s2tmxr iy1amtn fct (  2rmxrpou0oeen feiydla2eanmo;u4 rtnif iodlp elueolt0trtm(r iydapte ietl() 2rmxmpnt1tpxo feiytfa emuvs t4tetomocta1lpt  u i s0sexoim iudol nmieslt)srum(m ou0alx  f3tytla2rln p (0 ltomr3iotoateaiei (  2xrim3iy4lm  mnvt () Dum(monu4tleniiciad m uanvpnt4 exnir3ta1fm ean olt)texmxrpny4omt licils a2tmum nu0olx ifeiasfsDranmo u) renxo3ia1fmDrln i;()teto(r3oodoleelicta()artmu  ;o4aet mfeiydfa2ul(vpnt4arerxr3oodop rauvs s0trxmxo3nu1lm   fvt s)s2raxrp;o4oetomoeilsfa2ea(vonu)tlxoif3iodlaD  ueo s0 etmxm iu1apeemfvsasfsDtmx  ;t1opt mo3tydlsDea(mp u0artrxr3oadla ran sls0t2uoxr3iy4lm   fvt () 2rauroot1tpt moctadfm2eanmo;(4 etoxociatfp  livils0srto(o iy4om e ncia( sDraumpnu0apeoiiciltlsDeaumpn() ltoifciadfp   u s s seumxr3nodopte nct ()sruau pnt4alt  i3tldls elnvs;t4texnmr3oydoa rli i;t)s2ur(r ou4alen iet (  Dum(mpno1texnio3iasls emn s;t4 exomrciadla  anvo;t)s2xoimpno4ol e netlt)srua( pno0tltnioetyslaDrm(vp;t4 lxrmrcty1la rlnvslt) euoio iydopt  feia()s2ururpno0aex  f3ils s ulnms;(0teerxfcoo1lpD luei t0 etr(o3oudlpeemivtlt)srraumo;u4aee mf3tys sDrl(vp u) reoxfcoodomDe uvs (0srtm(rpiu1ol e ivt ( a2trxrpoo4oeeo oeiatlsDuanvpnu0teenxo3iytfat luvs;s0trumxm nu4omen ieilsfsrtmurpnu0oeenii3iydla ulump t) exrio3iadfmDr u o t0 exr(m iy4altnlfvilt)srrr(rpnt4altomf3tadfsDrlnms;u4 etnxocta1fateau i s) etmir ny1oltelieslt) rta(  oo4olxoifctatlm2ul(vonu0artnxrciadfpt lueslt0setm(mpny4lp n ies ( srurumo;t0alxo oetys mDul( s t) lxnir to1fmteai sls)texo(m3iy1omtnmiesas  rtrumooo4apt if3iyslmDua( sn(4artrxrctadom e ivs s) 2xm(r3nydlpee net tfaDuax  no4tleomfeilsfs rl(vo t0tltnmf oydfa eanes () 2trim iu1ll e iet t  2uaxro;o4teeniociysfa2rm(vs;(0tlxnmr3tatlpte n i;t) exrimpiodaptnmicslt)sDua( pot4tpeo feiyt m eanmo (0tlxrmf oatomtrai sl( srtmxr iodomtelnvs s)a2tmurooo0aleomocilsfa2umumo;()trtoif tatfmDeai o s) euo(m3oy4opeelnvsls  rta(monu1opt ifcias mDeln s;t0aetoxocoydlmtran olt  eur(r oo4olt  nesasfs2ra(mp;u1tex iicildfa2ua(monu)tltrxo3oydfpD  neo s) 2uoim3oy4olenmfvsa() Dtax  nt0tpx io3iysla2rmn s;()trenif oadlp elu o;(  rxrir3iy4apeemici ()srtr(ro;u0aex iieiatfa umn on() lxnxrciotla e nes;s)s2tmxr3oodole lfetl(  ruau ooo1altomf3ild m raump t4tltrxf3oo1lp   u s;s texmxrpiodap e ies s a2urx onu0tet moeiatla raums t0trerxo3oo1lpte uvi (  2toxr ou4amtelnctat)a2trxr ot0tlen oeiad m2emu pn()treomf3iytomtrli ilt)s2uo(mpiu1olen fvtat)s2ur(rono4tpe  ictadfa rmump;u0tltomr3ty1laDrlivo;t  exm(m3oodope  fesl() Dtmxr ;o1oleo i3tas aDuaums t)artoxrcoydfmt lneilt trto(o oo4olenlnvt tfaDta(moot4aeeomi3iyd s2emnmont0 lxomo3oy1opD luvo t0 rtrxm3ny4ap nmfvsat)aDrax  oo0apeo i3ildfm2ranvo;u4trtriociatlptelu s;s  ruoio3nu4alenmfvils  rua(r nt1aet mieiysls2uanmo;(4 rtnirctodlptrlneols0 eumxrpnu4alee ici t srtmu  oo1oetomoetatfs ra(vo (0 rermfcia1fp  luvs (0 2tm(r iudoptelnvilsf 2um(r no0apx  fciaslsDuln snu) eenxo3todlmte neolt seuoxr iy4aleelfetat) 2ur( oot0opxomieiyd sDra(vo;t4 rxrmf3ootfptrluvsls0sruoim oydalenlneiat) 2rm(mo;o4texn octat sDrlnmp u)areoxfciodfaDr uesls)teto(m3iudomeemnvsasfa2urur ;o1tltnif3ilsfa2rmuvp (4trtrxf oydoate i o;( trtoxm3ny4apeemivtas  Duax  ;t1oet mietlsfa2ean o;(4alxnmf iatla e u o t)t2tmim oy1omenlnesl(f ruaxmont0tpt ioctadlsDeaump;u) eermo3totfpt aivs t) 2xmxr oy1lptnmfei ( aDua(rp;o0oeeo f3tydfm ean o;u0 eermr3oytfm  livi s srxr(r3iu1lme  nvs ()s2uaxmpno0tex mfciatfsDrmuvp u) lxnmr oytomD lnvo ( seuo(r oo1om  mncsa( aDtaum oo4teen f3iys a2rmn o t)artnxocia1omDran s;s  exrirpoudal elneiltfaDtmxront1apxn f3iasfa2rm( o t0aetrxf iotopt aieslt) rxriopiudlpte feilsfarua(mpou0apxoiociltlaDranmo u) etoxo oydoa  aivi;()texmxr3iy4altnlivias) Dtm(ro;t4tpe iietydfm2ra(vp u)arxnmo3iadfm  au i;()setmxopou4ole mieils  rtrxmpno0oee  fetldls rm(mp t0altoiociytlpD au s;( tetoirpoydam   fcils)sDta(m ;o1tpxo f3iat aDumnvp t4 ltrir ia1optrau o ()teum(o oo4al e nesa(f rtmxrpot4aleo iciat s rau s;t)teermr3iy1lmtranvs t) 2to(o3io4am e fcsa(faDuaurpou4oetomi3ilt mDuln p t0texnmfctytfp   ueslt0srurxr ny1omee icsat s2rr(mpno0tpe if3iyd s2umu o;(4alxrxoctatoatrai s;( srto(m3iu4amenlfvi (faDtm(mpno0tlxn i3iysfaDem(vpnu0aexnxr3oy1fm r uvi t0trxo(m iydlmenmnvi s) 2rmxm ;o0ape ioctlsla2umu p u0alenxf3ia1lpDe ivi ()srxmxrpno4opt mivsat  rra( pnu1olenmocilsla2eanvsnt0 ltoxfcia1fpte u s;()setoxm ou1op n ncsatfs2tr(rpnt0alenmfciytfa eanvpnu)trtoif3iy1omDelnesl()t2xo(m3nu1omtnmicils)artaumooo4apt mf3ilt a rau pnt0 ltoifcta1fp rlivi () 2urir oy4alen feilt  ruru oot4tetoifeiatlsDul( pnu0trenmr3iadfatelu o;t) rumxr3iu4aleemnvils arur( pno1alt mocilt aDua( s;(0aexnxfctadlm eli o t trtrxmpio1ol elfcil(  Dur(r no4opxo ictydfm2rl(ms;() rtrmr io1oat lieo t0s2uoxopiydlmen nesat)s2rru ont4aeen f3iaslm rlnvpn()alenxf totfpDrai olt0 rumxopou4omenlfcslsfa2rmxr ot1apxomi3ias sDea( sn(4alerir to1lm r ivol()srxoxo3iu1amtnlfvi ()sDtmur ;o4tleomf3iadlm el(mp (4tltrir to1la ranvs s0 2to(m3oo1am   nesasf 2raump;t0apt  ietls sDrmu p ()texrxfciytlate nesls  2uriopiudomenmfvsatfa2ta(mont0alxnif3iyslmDul(mp u0 rxrmfciytlp r u s t0s2xm(m oydlmt  ivsa(fs2tmxmo;u1tle mieiad aDemuvonu4tetomf totlp  auvo;s  rxrimpny4apt mfvi s)aDumurp;o0tetniociltfa um(vsn(0 etoio3oydlaDelueo;s  rurirpio4oltelfes sfa2umxr ot0tle mf3tytls2umu onu0tetrxf iodlptr nvol()trumio3iy1lpeemnctlsfa2uax p;t0alxnio3iydlmDrauvs u) lxrircoodfp  lnes;t)t2urxo no4lle lfes ( sDrrxro;t4oleomoetadlsDulnvont)treomocio1fmtrauvi ( srxmim nodame liet tf Draxro;t4altniociytlaDelnmp;(4aexrxo ootfpDeaivo s t2tmxrpnu1lpt liei t)s2ur( o;u1tlt ifctytfs rm(mo (0teerioctotomDrliei s0 ruoim3iy4ol nmfctl( aDumxm oo4alenmf3ildla uanvpnt4 lxoif3iotomDrlu sl() rtm(r3iy1omt  feil() 2uaxront0olto feiatfm rmu s t0 etnir3iydoa eluei;t) rxm(r3ny4omtelnvils sDur(m nu0alxomictltfm2rm(mo t0 rxoxrcoo1fm rauesl(0sruo(o ou4ol emfesatfa2uau pno0aeto iciaslsDra(monu4tlerxocoy1oateaieo s0tetm(r3nu4lle mfctl(faDurx  ;t4aptomfeiadlm ranmpn()arxomfctytlmDrau o t srxm(r3no1alee nvi ( aruau pnu4ape ifeias mDea(mp;u0alxnir tytlpD au s;() rtm(mpou4aptn neiat) rum(moou0oetn i3iasla2ea( pnt0trenxocoodopteai o t  2umxopno1omtnlics s sDraxr oo0aet mieildfm2ranvpn(0 rtrmr to1oa   nesl(0texoim oo4om n nesls  2uru p;u1tleoiiciadfs rmu p;t0 rxnxf oo1lp r neo t)setoxm oydlmenlies t aDtrx ont0oetoiicildlaDrl(ms t) rxoxo3oa1fpDe ues;(0 2xr(mpnudopt  nvilt) ruau p;t1tleomoeiadla eluvs (4tltoxrciydom eluvo s)teuoio3oo1ole mictlt  rrrumoou1oeeomo3iytfa2ra(vont) rxrmr3tytfpDeaueol(  2xmio iu1ol n fetls)aDrm(m oo1opxnmfeild s2umn p u4 etrmf tytopDelnei;t  etr(mpiudlleemivi tfartr(m no4texoii3ils aDran o u0 eerxrctydlpDr neo;t0tetoim nydal e ivil()s2ua(mpnu0oeenmoeils s eanmsn()teerifcoadlmDe ieil(0sexoimpiu1omtelnciat)srur(r ;t0tetn i3taslaDrluvpn(0aexnif3tatlpt aueo;t)s2trxo3nudap emnes sfa2tm(roou0ope  feiasla umnvp;() etnmo io1lmDraiei ()srur(m iu4alen ictatfs2uaxroou1oeen fciyd aDulu p u0 ltniocia1omDe uvo;()sexo(r3iu1alt lfct s)aDrax  no4oltn o3iytls el( p;()texoxr3oodopDraues;t)trtm(m no1ale mfetlt)srtmuro;t4open ociatfaDrluvo;u4 etrxo todoat  ivslt setrxrpiy1ol  livtls  rraxrpnt1tpxnmfctytls ulnms;t4 lxoxo3oa1omD  i ilt)s2xrirpiu1aptn nvt t s2tmx pot4oetniieildlm uanvp;t4tltrmo3iydoptrlueo;(0 2tm(o3nudlpee fei (fsrumurpnt1texomf3tadlmDum(von(4trtomrciodfmDeluvols)truoxm3oydlpe  fetl( srrruroou0tet mfcildfm2ra(ms;()tlxrif ia1fa elivs;(0 2tmxmpoo1ll nmnvtl(fsruax  nu4opt mi3iys s ean o;u)tltnmo oy1fmt  nes;s  2tm(m io1ol nlics sfs2rmumpoo4ole  fetysfa2uauvsn()trtoif oy1fat luvo ( sexm(r3oodaltemneiasf Dtax p;o0alto ociytlm ulu s u)tltoif3oatfmt lu ils0srtrxo iu1lptnmfcia(faDrm(r ;u0optoifctltla raumo u) rtrxf3tydoatraneils srxriopiu4lpenmfcs t)a2ua( p;u1ope  ociasfa2rl(von(4 rxomo totfmtelnvo (0 2urxo3ny4optemfeta(faDtax p;u1aptomiciatla2ranvpnt4 lxnmr3oo1fpt lnes (  2xmxo iodoleelfvtls sDraxrp;o4tetn fetat s emn s t0aeenxr3iydop rai i;s0seurxrpnodaptelfctas)srur(  ;t4altnmi3iatlm2eau o u)tlxnifctotfa ran s;() exmxr oo1lltn ncilsfs2ua( poo1apeomfetls aDuanvp u0 eenxf totfp  ai o;s0sexm(r3no1aptnlfeslt srta(ronu4alxo fetadla2eluvon(4aeerif3ty1op   ueslt t2xoimpoudalte ieiat  Dtmum ot4apt mfctas mDeanmonu)altomfcto1oaDr i o;s  etoxo3ny4opt  fcs t) 2rm(m nt1tptnmf3iyd a rauvo t0trermo to1lp rlivo (0 2umiopnydlp emictatfsrraurpno0altn ieiyd s2ua(vs (4 lxrxr3iy1faDeauesl()t2uo(m nydlltnlnetlt srraxr nt1tlx ioctlsla ea(vsn(0texnxo ta1lm ran s;( sruo(m3ny4al   iei ( a2ur(  no0tpx iictys m uan s u0 rxrifcoo1fatr u o t truoim3ou4omtelici s  2umxr no0tlxoiiciyslsDumu o (0 reomr3iatopD livi s0seuoxm ny4op nmiei () rumump;t4apxo ietysfsDeauvs t) lxomfcoo1lp  li i t)srtm(opny4om n nvs ( s2rmx  nu0aex iocilt m el( pnt0trtrmr3oo1lpt ln o;( srtrxmpno1ll n icilt  rtrxrooo0ape mfeilt s2um(vs (0alxomo oatlpte ies;s teuoxrpoy1amen ietltfarta(mooo1tpxo iciadlaDea(ms t4arxnxo3iytlptrlnvo;t s2xrimpoudlp  lnci s  2ua(rpot0oet  o3tlt m emums u0artnio iotomt lnvols0trurirpio4apenmnctlsfsDrru pot1tltoio3iyd a2el(vs;t0alxnxr todopt lueo;t) 2xrim3nu4ll nlncslt s2rmur ;u1aetomiciys m rm( s t)tlxrio3totfm rai s;()texo(m3nudlmt mfvil(fa2tm(mpnu4apt io3iadfs2ra( s t4 etoxo oa1laD  nei;s teuoxo3iy1lp  mnvs tfs2uaumoot4aeeo i3tltls uanms;u4aeermo3tatlaD  ivilt0t2ur(opou4lle lfvsa()sDua( p;o0apen i3tldls uauvont)trtnir iadlmDeanvils s2xo(r3ou1amt lnvil( a2trur ot4tpto o3tadfaDul(vp;(4alxnirctadfmteli s;s0s2ur(m oy1oltelfvtls s2rmumono4altnmieiysfsDuaums (0artnir iatfpte i ils)texm(o oydll n nesls)arur(mpot0tle mfciydlm2em(vp u0 etnmr3iadoa e neil(0s2xoim3no4ameelietlt)arua(  nu1tltn oetlt m2umumo (0 etnxfctatlmD lies;t0seurxm3iy1lme mfvsat)a2uax p;t4opeo ociysls2umn s t4trtrxrcta1lpD  uei ()srtoir iodomenmfvt t) 2umx ont0optniietls s2em( snt)trxrirciy1fpD an s (0t2tmirpiu4llen iei tfaDtrx  ;t0apeo iciasfm ulums;u)altriocoatfpteauvs s)truoir oydalee ivt tf 2taxmont4tlxn o3tldfs umnmo (4trxoxoctodlmDr ueo;t0s2uoxm3ou4amtelfvi s srrrxr no1alxniietytla emnvpnu4altrir3tadoa  au s t) euoir ou4alenlfvils  Dtr(  nu1tlenmo3tlsla uanvs;t4 eenmociydlp elivo t t2uoio ny4lp eliviltf 2rm(rp;o4aexo iciltfm2uln pn(0altomr ta1fpt  ivsls0srtmxopoy1al emfct t srtr(m ;t0optnii3tldfs2emn o;u4trtnmr3iotlm raivs;( trxr(o oy4alenlivtls)aruaurpno4apxnif3iat a uan pnu0 eerif tatlp eanvs;t0 exm(o ny1ame mfetls)sDtru o;t0oex micias a umu o;t4arerxf oo1lpD  ivo;()t2xrxm3nu4ome lfeiatfs2rrum ot0olxomfetas aDuanmo;t)altnio3iy1fpDrlueo s0 2xoxo nu1omtemncia()aDtmxmooo4tptn ieild mDra(vp;(4 leomfctytomDrlnvs s)teumxm3oudlp  mfvslsfsDtrum nt1optomfcias a um(mpn(0 eermr oodoa rln slt0t2xr(r3nu4ap nmictl()aDtau pou1aetoioetas aDul( o;(4tlermf oydom r u o;s0 rumir3oo4lmen nciatfa2uaum ;o4oetomocildlmDranmsn(4aexoirciotomt anvs;s0 eto(o oo1ome mfci s  2taxr no4apx mi3iadla2uaumo u) eenxoctytlaD au i t trxr(rpoudomenmfes s  rtr(m no1opx  f3tatla2uauvs;(4 exoxr iadopD aivo s  rtmim ny1op e ieta() Drmxmpno1tetomoetytfmDeluvo;t4 leoif to1lpDr u i ( s2to(rpiy1amt  iesat aDrrx  ot4aexn f3tldlm2eau on(4 rerxrciotopt  nes;t0t2trxr3nu4ope mivsl(f Dtrumo;o0ale io3tls s2eaumont0tetoio3tatomtraivo s0 euoxo ou4alenmneils s2rr(m ou0opeoiiciltla rauvon()areoio3ootop raivol(0s2toiopiy1ape mfvs sf rua( oot4aetnii3tatfa ulums u4areoxoctodopt  nvslt0truo(m3nu4oltemfvt tfsDtauronu1olxnmo3iat mDrlnvo;t)tlenmo3oatfpDrlivs ()trto(o ou1llt lfctas aDtmxr nt4oleo i3ild mDuaumon(4artoxfcoy1omD  neo;s seto(opnodom  mfct tfsDtrurpnu0tleoif3tatfsDemuvo;t0alenxr iatlp  lies s  eurir3oy4op elieil(fa2raxro;u4tpt  i3tysfa2rln p t)altnir oy1op  an o () eumxopiu1omtelicias)artaxrpot1oltnifciysfm2el(mp;(4aleoxf3iotom rlueo s) etmim ny1am elncta( s2taxr no0aet mocils s elu o;() rtnmfciy1laDe n sl(0srxrir3no4ap elivtatf Dua(  nt1oetnmo3iyd s em(vs u)tetrmr3tydlat  nei;t)texmxr iudal  mfcsa(fsDrr(m ot0tpxnmi3iyt a rm(mp u0 rtrircoydoat  nvsl()s2trxm io1apenmnvt () rtr(r no1tltniieias a ranvp;(4tetrio3oatfa eaivols setmio io4om e nvt tfsDum(rpoo0apeniictydfm elnms;t) exrmr3ty1fpDe uesls0sruriopoodamt  iviat  2tr( pot4tlxo f3tadlmDelumpnu)tetrmf3to1fpDrli s;() rtrxr3no4lp   nvs tfsrurum nt1aet  fcild a ul(ms;() eenmfcoadlpDranvi;t) eur(opiodap e fesat) rtm(m ;o0tpxomfeiysfa rm(mo;(4tlxoioctatfaD lnvo;t  eurxr ny1alt mict sfa2rm(rpot4tex mociltlsDrl(vs;()aeeoircoa1oa e nvils0trurirpiydlpeemfetl(f rtmxrpno0opeoioctasfa emumsn(4aleoxo iytla r ues t srtmiopoy1ol nmfvtlt)s2tmu o;t0apxn i3iysfsDrlnvo u4tltrmr3tatfpDelivo ( texoxmpnudlmte iciat)a2tm(rp;t4olen i3iatlm2rmums () exriociatfp r n o t0 exr(mpiu1am  liesas sDrrxr no1tpenii3ild mDel( s ()teenmo oa1lpD lueo s)seto(m3oo4altemfvsat srtaurpou4opeo ictyd aDum(mp u)tltrxr ty1fm elneil( sexrir io4lpeemfcsat aDuru  no1apxnmf3iytlaDrm( s;t)tlenif3ia1lm eluvo;s)seto(opnu1om nmfcil( sDrax ont4olxo fctasla2emnms;(4arenxr3iodlmD  ieils0s2urim3iu4ol n ics t) 2tru oou0oltnif3ild sDrm( pnu0artoxf iadop rlieslt)s2uoxo3iudlm  lnctls a2taxrpnu1aexnif3tat s umnvpnu4aeenircta1la rlivslt0 2tmirpiodolt  ncsa(f 2ur(r nu0ope  fctltfsDem( p u0alermo3tydfaDeluei s0 euoxm3ny1optemies s)arrrxmpoo4tee if3iat s ua(ms t)arenif3tydop rlu s;t) rxrxopiodome mncias)srumu  nu0oetnmf3iadls2ua(ms;t0texnircia1om r uvols0t2tmxr3io4omee fcsas s2tmur nt4tpeo oeils a rlnmp;t) exrmo3todfmt aueo s) etr(o3oodome lfctas)arrm( p;u1tleomf3ias aDrlump t4alxomfcto1fmtranei;s) euo(r3ny1apeelicslt sDraxrono4aeeomf3iyt sDrm( p;(0artoio3totoa  aivo;( setoimpoodop emfet tfsDua(rooo1aeenmociasfs2umumont0texrmf3oo1lm eanes s)srxrim3iy1optn nctl( a2tmum ;u4alt iictydlm em( p (0altoircoo1fmtr i olt)sexm(o3iodalt mfvs (f rrauro;t1tpt ioeildfm2ua( p;u4aleomr todomDeaivs;t) rxoimpou1ale  ncsasfaDra(rooo1aee mfciadla rmn snu4aetnmocoy1lptr nvo;t)seumxm oo1ll nmicils srtm( ono4openmfciltfaDrlu s;(4areriocoodfa  ai s;t trtmxm3iydoltnmicslt s2ra(m nt1openmi3tld mDeanvonu0teerxo3tadoat  nvo t  euoir3nydom n icsat artmu ooo0texn oeiatla2ulnvo t0aeerir3iydlp raiei ()trxrio nu1am nmfcs tf rta(  nt4alen iciydla ua(mpn(0 ltomocootlpDeln i s0trxoxopny4ome mfcs ( a2ur(mono4tetomocildla ra(vsnt0arxnxo3oodomt aneo ()srtoxm3nu1op  lfcta()srtaur no0opt ii3tyd m ulnmon(0trxnxo oydfpteauesls)srxmxm oy4omtnmfeiltf Dtmur no1tet iietasfs2ranmsnu0 rxoxoctatoa  lieo ()sruoiopno1llee fei (  2umumo;u0tlxn fetas s ranvs t4 rtrmrcoy1om eli ilt s2xo(m3no1al elics tfaDrax pnu1oltoio3iasfm2ea( o;u)trerio oy1lp e ieo;t0setm(m iy1am elnvtas)s2trxrpno0oexnii3tatfsDrm(ms u4aetoifcootoaDr nvi (  2trxo3oy4am  mfei s aDra(mo;t4oexnmi3iadfm2rluvo;u4teerir todlaDraieols  etmio oudomee nvtl(farrau onu1tee ifctlslm2ua(vo (4teenmfcoy1faDr nesl(0srxoxr3ny4optnmiet (faDtmxmonu4aex iiciasla ul(mp;()texomr ta1om r n i;t) rxrxopiodal elnvtls  ruru  nu1tlenifctys a rmnms;(4aeerir3totlmtraneol(0 2uoxrpio1ap emneilt  Durx onu0altomieiltls emnvs (0tleomo todlaDrln i t texoxm3nydlltemnci sfarrr( pnt1opeoiietld aDul(vsnt4tlxnxr3tytlmtr neol(  eurimpiu1ap nmfei (farumx ono1oleo o3ildla2rlump u)altomfcoytlp  anvi;s) 2ur(opoy1op  licilt  2tru ont1apen f3iytfa raumo;u4tleoif3io1lpDrlneol()srumir3nu4al nlnes tfs2ururoou1tlx ii3iydfs2uanvo;(0trenxo3todom  an i ()tetmxo3oo4aptelivil(f rumu o;t4tlx io3iytfm2rlumsnu4altnmociodomt auvs (0teto(r3nodopenlnetl(fsrrr(ro;t1olxoii3ildlsDrlu s;(4alxnxr iadfm elieo;t setr(m oo1altnmneils  rrmu oou1oex  f3tat a2el( snu0arenxr todfa   neo ( s2ur(r iy1lptnlivt ()aDtm(r ;t4opx iiciydls2elnvo;() rtrxo3iadlate uvi;s0 2xrxmpio4am nmictatf Dtax o;t1oee ifctlsfs rluvo;(0 leomf iydlpDe uvo s) 2tr(o3oo1alt mnvtl()sDtmurp;t1olenmfciltfa2em(mo t)trenxocoa1fa e nesl(0srxrim3iydaptnmieilsfarrr(mpno0apx mfetltlm2emums u0texrxo tydop  aivilt0 rxrim3ou4apenmnesa()a2tmxroot1optoioeiadlm rmnms;u)texnxf iotfmte iei t truoxmpiydol nmnes sf 2tmx p;u4aeen octld a2ra(vo t)arxriociy1om e u o ()texoio nu1llt mnct ( srta(  no4tpto oeilsfm ra(vs;(4 rxoxr3ty1lmt  uvi (0seuoim nu1lmen ict sfs2uau  ot4teen fciatfm rl(vpn(0arenxr tatlp r ieo;( setrxo3oo4lltnmnvil()a2trxr ;u1oleoiicias s2umnvp;(0 rxnmf3io1omtr i i;t texoio3iydlpeemfei s)arrmxront4tpxnmi3tatla eauvs u)artnif3oatlatrlivs;s)seurxrpno1ll emncs sfarurum oo0tpen fcild a2rlums t4tlerif3ta1lmt an i t)texmio iy1ol e fvt s  2rrumpnt1apx mf3iytfm2um(mpnu) lxomf3to1omtraivol() 2tmxmpiodoltemivilt  rraxmpot4tee  oeiys sDuaump u) etoxr oydlat  i o t0 2uoxopno1al emnvtat)aDum(m ;u4teeoiiciyd aDrmn sn(0 rxoxfcto1lp  lnes;s)seumxo3no1lptnmfct (fsDra(mpou0opeo fctlsfs2elumpn() lenxr iydfp ran o;s) 2uo(o3iodlpe  iesa(f 2ur( oot1aexnmfciydfm2umumpn(4treoxfcootlmtrlnvi;s teurir nu4ol   fvsas)s2rm(rono1tet io3tydfs rlnvp () lxnxocoadlm  auvslt)trto(r3oo1lm n fvta(fa2tm(rp;t0tex  oetysfa ulnmpnt4 rxnio oa1opt  ueo;s)teurimpoy1lleemivi ()srumum oo4tpt iietysfsDul(mo;u)artoif3oy1oat  u i;s teumxmpoo1lpenlivs (farumx  ;o0texomo3tyslmDrm( snu0trtrmo3iotoa rlu o;s0 exo(o oudll  lfci s)a2rau  nu4aetomiciysfm2rlnmo t0 renxf3tytfaDe iei;s)trxmir iu1ameemiet s  rtaxrp;o0opxo ieiyslaDuaums (0 leomo3iotfm   i o t0t2tmxm3ou1lmte neslt)aDraumoot0oeeomocilt m2ulnmsn(0texrio to1lateaneol()trtmimpnydllen iet t)aDtrxr ;t0ope if3tyd a rlu o () rxnmr tadom   nei;() rto(m3oudlle miet ( sDtr(mp;t0tlx iicils a um(msnu0tleoioctytoat  n i;()t2tr(o nu1lltelneia(f rrr(mo;u1apeo o3ildla rmnvs ()tetnxrciotfptrauvo s0 eto(m3oo4op elfci (  2ra(rpnu1aetnmoetaslsDrlnmpnu4 exrxf totomtran ols) euo(m3oo4alenlnvtatfaDuaum ou0oetnifetld m2ulnvo (4altrmr tadfm r nes;t sexmxm oo4ap elfetasf rtau pot1oeen o3tysla uaumo;u) eeoxrcoa1lpD  neo;s0texmiopio1omt  icil( a2ur( pot4oee  feiatlsDumuvont0alermr3ootlpD luei;s)srxrxopiu4llen nvt s) rur( p;u4aptomf3tadfa2rln o (0 reoir3iatop   i il(0 rxmxo iodaltemnci tfaDtaumooo4tltn oeiad s2elnmo;t4teeoxf3tadlpD  n ilt  etoxm3iy4lmt  fvilt) Drmu  no0oetn i3tlsla2umn s;()trxriocia1lp elneil()trxr(o3nu4lltelneta(f 2rrumpnu4aleo oetltfa el( s;t0aetrio iodlpD luvi;(0seumxr iy4olee icias)aDtm(  ot1tptn ociys aDua(vp t0 rxnmo3ta1fptraues (0 rumir oodapt  fvs t)a2rr(  no1olxoiocias sDrmumsnt4 ltoxf3to1late ieo;()srtoxrpoodlm nlfvt ()artmx onu1aptnmi3iasfm2ul( s u0alermr3iodlp  lnvi;( t2uoirpou1ape  netl(f rurumoou0alxo oetyd aDem( onu0 etrmf ia1fp  lu s;t) exrxo nydlmeemics s  rtaxront1aeenmf3tytfa2rlnvp;t4tlxoir3oytlmteaieo s0trurio3iodapt  ict sfarrrxm ;u0apx mieiadla2emnvs (4trtrxocoodoptr ivo;s0teurio ny4om nliesas srrru  ou1opeo feiyt sDra(vp u4 eenxr3ta1omD  n s;()seurxrpoy1lm elfvt sfaDuax o;t4apxomi3ilslmDea(vp u)tltrxo3iotfpDe ieils0sruoxm ny1lmen ncils) Dtr( p;o4oleomoctysfa2umnmo u)aetnir oatfpD aieo;t)t2xo(r nodlmt  nvt ()aDuau pno4teeomoeiasfs uauvpn(4tltrxf oydlpD  ues;() 2toxm nodom emics (  rtmx oou1tpx ifciytlm uluvs;(4 exoxfcoydfatrliei;( s2xmxr nu4lle lfcs t srumxrpou0tex  iciadla eauvp;u0alenirciy1faDr ueols)s2xm(rpiydlpeemncilsfaDurxrp;u4olto feildla2emump;u)tlenmr iadfpt lneo;t s2xrim iy4lmtnmivsltfaDrmur nt1opto f3iadfs uaums;t)teenmf todopDr u s;( trtmxm oy1ap   ivtl() rua( ont1apeomo3tatlm rlu o;(0 etoxrctodopD anesl() rum(r3ou4lmt  fvilt)sDurxr no1apt  feiytfm2rlnmp t4 rxrmf oy1lmt lueo s0t2xrirpny4lmtemfvta( sDta( pno4tpe micilsfm2em(msn(4 etoxf3oydomteaueo t t2um(rpnydaltnmivsa(fs2urxroou4tle iietadfmDem( p;(0alxnmo3oo1oa e n s ( texmir io1lltnmnvia( a2raum ;o0tpenmictys s2uau s u4trermrciatla   ieo;s0t2urxrpnudal nmietlt)a2ra(  ;u1texnmoctaslsDrmnvs;t4 eerxo3oydoaDe nes;s)trtrimpnu1opeemnctlt sDuaxrono1tet io3tlt m el( s (0 leoio3oa1laDrli i ()srumxo3iy4lmee nvsa(f rurx  ot1ope  o3tasls eanvo t0 rxrxf iadfm  ai i;s0trtr(o3nodllt mfvtl()a2rm(moot4texoiictatlm rauvs;u)arxrio3tatomD lnvsl(0teumxopiydaptemnet (f 2raumo;u0alx ifciltlm2ranms;()aexnircta1om e n o;s0s2uoimpio4ap nlfvtlt s2um( ooo0apx ii3ils s2rlumo;t4arenxfcoy1fa rlu olt seurxopoo4ap emnci tfs2uaxro;t1alt  ictatfs rl(vp;t)trtoif tadfatrluei s  euo(m3oy1lpenliet s aDtru o;o1teenmoeiysfmDeaumsnu4tltrir iadom raneo (0 etr(opoudom n neslsfarrm( o;t1ape mietasfs2um( snu0 leoio3ootopD lueils srurirpno4ol nlnct s  2um( pnt0oet ii3tadfa2emu onu4 rtnmr to1lpDelu i t) 2xoim3oy4am   fetatf ruaurpno1tet iociatlmDum(ms t4 rxrxo ty1op elnvo;t0truo(opiu1lptn icsas a2uru  nt1oetn fciltfa2ulnvonu4altrmr ta1oaD anvslt) ruoimpiydap emfcia(fs2umuroot0tet io3tatfs el(vs;()teeoif iadfm  luvo;t0 euo(m no1alt micsas a2trumpnt4oeenmf3iltfm2ulu s;u) rtrmo3oydfpt luvilt) 2uo(o no1amtemfvi s aDur(moot0olxnio3iat mDrluvsnu0 lenxo tatopD aies;t0t2toxopiy1open fctltfaDurxr oo0openii3iatls2rlnvpnu0aeeoif iadoat aieilt  ruoimpiydopenlfetls)s2ra(mpno0open oeiyslaDumumo;u0trenio3tadfp e ues t trxmxr oy4omtnmnei sfsDum( oot4opeomfciasfmDuaums (4trxnmfciydoat ln s;(0texo(r3ny1opee ivtlsfsDtrxmpoo4olxniicild a elu o;u4trxoxrctadlmDeluesls0trurxm3nu4optnmfcsl(fs2raur ;u1aeto fciydlmDelnmsnt0tetrio3oodoptr nvs;t0
\ No newline at end of file
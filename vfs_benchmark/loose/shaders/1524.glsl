@@ -0,0 +1 @@
+nes s  eurim3iy4aleemnvsl()sDumxmp;u1alenmoeilt a2um(mo;(4aeenio ia1fmt aueil()t2xrio3nu4lm elicilt) 2uau o;t1alxoifciyt s eanvs;u0artoxr3iotfpte i o;s)t2xm(m io4aleelfvt (f Dum(rpnu0olxoii3iad sDea(vpn() reoxr todfpDeaueo (0setrxm nydllenlfeslt) Draxmo;t0aeto i3ilsfa ua(vp (0tlxoiociadomteau i s)tetm(o nodoleelnvslt)arrmx p;t1oee  i3tlt a ul( sn()altnmo3ia1oa eauvol()seur(r3oudlp emiei s  2um(m ;o4oet ii3tysfsDeanms;t0tltomo to1oatrln o;t0setoio nydomt  ieias)artax poo1tptomfeiyslm2ea(vo u4arxrifcto1lp   ueo;(0t2toir3iydll elfcia()arra(r ot0teto f3tydfsDul( p ()trtrio oa1lmDr u sls0 ruo(o3nu1alen fcil(faruru pot4tptnio3iatla ean o (0 ltrmo3tydlp   n s;t0srxoio3oydlp emfvtatf rum(m ;t4aptomoeiaslmDrmuvo t) reomr3tatfpDr ueolt)s2tmxrpio4amtelncilsf rraurpnt1tpxn ociyt m uanmonu)trermo oytfm r nvsl(0 eum(mpnu4omtemiesa(fs2rrx ont0olen fcilsfs2ul(mo;u4arxrif iodfpDr uvs;s t2xmimpiydoltn nvtl(fa2rm(monu4apenmf3iyt s2eauvsnu0artnio to1opD auvs;(0trurxo ny4lm e icsa( aDtm( pou0aeenmfeiyt sDrm( pnu) eeoxo ta1opD anes;s srxr(m ny1ale mieslt)sDtmur nu0texnmfcils s ean o;()tltoio3totomtelivi;s) etrxr nydll nlfeil() rurumono0tptnmfeiyslm umn s t0 lxomfciytlpteai il( trum(m3ny4ame  fci tf Dtrumoot4tleomo3iysla2eauvo t)tltnircoy1omt lneols0teto(rpnu4op nlfetlt) 2rru ooo0apxn fciys s eluvs;u4trxrmociy1fmteau o;s0t2xo(m nu1olenmfvslt a2trx o;t4opt ii3iysfs el( pnu0arermfctydfatr ivi ( srto(rpiodlpe lneil()aDum(ro;t0aptn iciyd s umnmp u0tlxnmr3ootomtrlu s;(0trurxm io1aleelnciasf rrmx o;o4tpeo ictls a um( pnu)texnif3oadomtranei;t trum(rpiy4apenmfvtls)s2uau  oo1apxomociadla2elu o;u) ltoxfciotlmteanvsl( tetmxr nydlmtnmfeias) rur(mo;u1opxoif3ild a uan p t)tleomf ia1opDranvsl( sexrxm3nu4ap  lfvsas aDtmx  nt1teeniieiadlm um( on()alxoio3oodlaDr ieolt0texoxm oy1ome livs s aDrrxmpou1alt  oeiatfmDea(vp;t0 etnif totop r ieo;t0 exr(m3iodol e ici (fartr(mp;o0teenmociydlsDrm( s u)trerxociadfa rauvo t)sruoio3no1ap e fcslt arrr(  ;u0oltnmictltfs2raums;(0 lerircoodlaD  n slt0 2xoio3no4ale  ieslt)srtmu oou1altn o3tadfs uaums u)altnxf3ty1opDrli s;s trxmxo ny1ape  nvs sfa2umxr ou4aexniieiyt s2umn ont)tltnio tytlpte ivs s0trtoxr iy1llee ietl()s2ta( o;u1olxn oeildlaDranmp t4tltomociatlm e nes () rtmio iodol emnetl( a2rrxmp;t0opx mo3tydfs2eau p u)tlerircty1oaDeai o t  euo(o3io4lpt  iviltfartru pnt4tpe mfeiadlmDran sn(4aexnmr3to1fmD  ivo;t0 rxo(m3oo1lltnmneil()sDtmx pou1tee moeiadls2uan o t4 rxomf3tytlmtelueo ( sexoir ny4apt  ivsls aruaxmpnt0apt mf3iyslm2umump t)areoxfcta1omt lneo;s s2trxm nu1alee nvslt a2tmx poo1alx ifctas s ranvpnt4aetoxr tydoatelneo;s)s2xr(o oydllenlivia(  Drrx ooo0tetn o3iyt mDuauvsnu0tetoircoatfm rauvo s)texoimpiu1lleemictasfartm(mpno4tptn ociadlm rl(msn(0 exnmf tytoa eauvo t0srtmir3oo1am  liesatf Draxmpou4oexoifciad m2rauvpnu4 eermrcto1fm   i o () 2umxm3ou1op emieia(fartmumpou1oeeo oetlsfa2ul(ms;t) ltnir3totlmtr nvilt)sexoxm3iu1lpeemieta( s2rmxmo;t0altnif3tysfa2umu pn(4teeoxrcoadlaDe uvil( srxo(rpny4lmt lietl( a2um(r ou4apt  feiadfaDumu pnt4areoir iy1fpD lieo;s)t2trir iydamt lnei t)arrmu  oo1aleoifeiatlm ranmont0aexrxo to1lm rli slt seumxo oy4lp elivs (f 2tau oot4oeenmieildfsDrm(ms;t4teermr tydfm   uei ( setoim3nu4lmenlieilt a2tm( pou0oleomociatlaDrln on(0 etnio oa1la   i s;()srurxo3iu1ameemict tf rraur ou4tpeoifetlsfm2ul(vsnt4 eenmf3tytoat  i olt srurxrpoy4optelfvtl( srumurpot0olt mfeiyt a elnvo;u4 lxnif3ootlm e i o;s  rtr(opoodaptelieias) 2tm(  ot1tleo i3tls mDemuvo;t4artrmfctodopDe nvo t t2ur(m3ny4olee nesatfsrtrxm ;t0tee mi3iyt mDraums;t0trtoio3iy1fmDr iei;t0 exmxm3oy1lltemieta(f 2tmxro;t0tleo iciydfaDeanmonu0tltnxo ia1fp rlu s;t0 2tm(r3oodlp e ncs tf rumuront4apxnioetad s uluvs u)tltomo iydlpte i olt  ruoxmpoy4ameemfvilsf rrmxmpno1ope  fciysfm uauvsn(0altrxocto1lmD li sl( teumxo3oy1om emies t arrax ont4ale moctlt s2ul( onu0arerir tytfpte nvs ()trumxm io1ap  lfvi sfa2rm(mp;t1tlx moetldfm2rau o;t) etoir oydfm  ai s;(  exm(m iu1ol elicslt) 2ur(rpoo4teeo ieilsfa2ua( s;t0aeenioctodoaDelieils  2xoio iu4am nliet (  2raxrooo4altn oetldlmDrl(vsnu0alxrmr oy1fptrlnes t0sexoim oo1aleelnciasf 2tru ono4texo oeiysls eluvp u)altrxr oy1optrlieolt  2xriopny4oltnlfvia()s2ur(  ;u0aexo oeiysfs uauvonu0tetrmfciatfpt lu i;(0trur(r ou4lm nlfvs s srta(mpoo1apeoioeiasfa rauvont4altrio ty1faDeauei;s)trtm(r oo1oltelieil()a2rm(  ot4oltn fciasfaDelnmo u) rtnio3tadla  li o;(0 eumio io4ap  mnvtat srua(r ot4aptnii3tlsfa2ean p (4 rtrxo todopDeluvsls  rtm(opny1om emieiatfs2rmx p;o0altoio3iytfa um( p;(4tltrmr3oatfmtelivi;(0texo(o3nodaptemfei sfsrra(ronu4alto i3iatls um( sn(4tleoxr3ia1laD ai sls) rtoio3iu4oleemnes tf rrruroot0olx io3iat m eau p;()tlxrif iotoaDeanes;(  rtr(m ou1olt lieslsf Duaur oo4tlx mi3iydfmDua(mp u0 exrif3iydlaD  u slt0 2tm(r nu4omte nei s  rrrxmooo1alt  o3iltla2em(vo u4 eenxr oa1op   n o;s0trxmxmpiy4lmenmfetat sDtr(mp;u1alt ifeiltfa rmn p u)tlxnmr tydoaD livols texrim3nu1alenmfes (fs2rau oot0apx mfciatla ean p;u) exoxf3tatfp  anvo t0 2xr(opiy1amtemfci s) rtrxro;o4oleomo3tytfa rm(mp u0aexomf3oo1lm rlu sl(0 rxo(m iu1lmen feilt)s2uru poo1altn fetyt m2umu o ()aexnif3oatfa e ies;( s2umio nudlm e nvsl( s2rmurp;o4oltomi3tydls2rl(mon(4 lerxfciadlmDeaivols srtmxmpou4lme  ictlt  ruaurono0olenmociasfmDeaump;(4aleniociatoa  livi;(0s2uoxr oo4apenlnctlsfsDrax p;o1teenmi3iat s rm(vs;t)tleoxf oa1fptr uvs;t0 euo(r oodap emfvi (f 2rm(rono1tlx moeiatlm2umuvp;t4trxrmocoytla elu s;s  2to(r iodameemnct s  2tmx pot4tleo oeiasls ra(mon(4 eerxrcta1fmt livi t0sruoxm ny4lpt mnesls aDtrxmpnu0apen f3ilt m2emuvs;u) lxnxfctadfmD  ueo s teur(m3nydlpenmneia()a2rm( p;o0tpx iociysla um( sn(4aetoxr3iy1la rlnvi;t)srxrirpiu1lpenmici t) rumur ;u0oeeomictat sDul(mp;(4trerir3to1opt luvs s0texm(m3iy1apen ivslt arum( pot4alxomfctyt s rluvsn(4aexrxo totlatranei t0srxo(rpiy1oltemfeiasf 2urxmpou4olt  f3iydfm rm(vp t4arxnifcoadoaDe neslt0 2trxr iodlpte nviat  Drm(ro;u4tpx iiciydfs ul( on()texnxo3iadlmt  ivolt)t2xm(mpou1lme mnvsl( artrxmono1aeto ieiyslaDeln o () rtrxf tytlpD lues (0t2umxrpnu4oleelnvtat arrr(m ot1olxo fcilsla2rlnvo;u4artrmr3io1fp e uvo s texr(r oo1lltemivil() Dra(r nu4ope iiciysls2rmnvpn(4aetrir3tadop  ln i;t) rxo(mpoo4alte fetas srumxrpot4apeo o3iltls emnvont) lxnxf oydlaDeai sl(  2umxr3oodole micsatf 2umu  ot1tle ifciys sDrl(vo;() lxrxrcoytopDrlu o;t0s2xmim3io4opt  ieia( arrrurp;o4oltomfctyt m umuvp;(4artnmocoy1oat  i o;s0t2ur(opiu4ol   ivtlt)aDrmum ou0alxnifetydfm2uanvs;() exrxf oa1lmtelieils  2to(mpio1lm elicil( aDtaxm ;u0aeenifeiasfmDelump (0 exrio3iodlpDe ueols t2tmxo3iodlm n iciat sDrrxmpno0apenmf3iys m2rm( o u4 etrmr3oydoat  ivs ( s2xrxr oodop emfes ()artaxrpnt0tlt mo3tat sDeluvo;(0aeeoxr iy1fatraies;s0trurxo iudamen net ()sDrmx o;t0oet  i3iys s emnmp u)alxnmr3oa1lpDe nei;(0trtrxo nu1omtelfei t s2umx p;o0tltniociadfaDeaumo u) eeomf3io1oatranei;t0s2xrimpoy1lmtn nesa(  Draumpoo4tet  ocias a2ea(mp t4teeoif iatlpDe uvs ()seum(o3iy1oltnlnci tfsDrmxrp;u1aee moeildlm rlnvs;(4trenmf iatopt au ilt)trumxo3no1lp e fcia( sDuauro;t1tpenmo3ildlaDranvo t0 rerxf ootla   n i;s0s2trxopio4ole lfcsat) Drmum no4oeen o3iyd a2rmu p u0 ltomr3ootfmD anei;(0seur(rpny4op  lnes s  2tm(mo;t0opto ocilt s2uauvon()altrmocoydfpDeanvs t0trurimpno1optemiviasf 2rr(rono1alxn f3iasls rmnvo;u0aeerif oadfp elnvi ()texo(opnydol elnetatfaDtmump;u0altomi3tldfmDelu s u0trtoxr iytoa   neo;t0 eurim nodlmenmncs s  2rr(  ot0alto feiatfa2uanvp t4trenmfcto1lpte uvsls0 2toxr3nydapenlfeils) Durx pot1tee iieilsfa2uln p;u) etnmr totlmDr u ol(0 2xoim3oodopen ivilsfsDumx pot0olt mf3iyt sDran s;(4tlermr3oydfaDrluvolt)teuoirpiu4aptnmnci () Duauroot1oet mi3ilsls ulnvo;u0arenifctytomteluvs;t0seum(mpiudlpt mivsat  2tr(mpnu0aptnifcilt s2um( o;(0aeeoioctydoa  luvo s  euo(mpoydalee nei (fa2rmx  nt1alenifciytfa2ulnvo ()aetnmr iy1fatraueils trtrxmpoy1am   fcsasf Dtru pnt1teeniocias a2ulums;(0arxoxf to1fp  auei t0 rxoxr ny1amtnmfcs sfarumump;o1alx  o3iltla2rl(mont0arxrmo3iatop  lieslt0sruo(m ny1apeelfcsls a2taurp;o0olxn fetasls emu snt4tltrio3iy1fp rlueils s2xmxr iy4omt mivslt) 2tau  ou4alx  fcilt aDrluvp (0trxnxfcoatfmDelnei;(0s2uoio3oodomte nvsat aruaxrpot4teto ociysls ul(mp u0tlerxf3totlm  ai s t)tetrio ny4lp   net (  2uaumpnt1oeto ieiydfs ra(mon(0trtoifctatfmtrlu slt  2xr(opnydlleemfct (fs2tr(m ;o4tee  oeiydfm rl( snt4aeermr oydlmteau i;s trumxm3oodoptelictltfaDuauroou4apenio3iad a2ul(mp (4tlxrxr ty1lm e u s;(0trumxo3nudll emiei t)aDtax pou1tpeniieiltfmDranvp ()teenmr oodlaDe nes;t)t2tm(o iy1lm n fciltf rurum nu1tpx  i3iydls2ean pnu0altnmfcoatlmtrlnvs;s)setoirpou1om n fet (fsrum(rpnu1oeto icils m rlu on()trerxr todfpD aueo t srxrxo ou1omteliet ()arrr( pnt1oexn fciatfmDulnvpnu0 etrxo3iadopDr ues t0t2xoimpnu1al nmivs sf 2ra(r ;o4apeoioctltfa emu s;()aetoifciatop eaivo;t) 2umxo nudam   nvtat  2uaxm nt4opeoii3iat mDra(vonu0areomocoydfm e neo;(0seuo(r iodoptelfvs sfsDumur nt4tet if3tydla2rlnmsnu)trerxo3iy1om e nvs t  rtrir3oy1lpeelfviatfs2rmuront1alxniiciydlmDrmu snt4 exnxo oy1fm eaivols t2uoxo3io4ll  mnvi ()a2tr( oou1tleomieiyd m umnmo;(4 lerxr io1om rlnvsl( setoxrpnudameelnctls  Dtmuronu4teeoiieiat s2ua( pnt4trtnif3oatlmtranei t texoxm oodapenlfcsa( srur(mont0tetniieils a rl(mp;t0alxoifcoy1lpt ai il(0teto(opiudal e ivt ()sruaurooo1ape miciytfs rmump;u) exrmo3iodlm eau o;t teumxr no4om   neiat a2uru pnu1olx mfeiltlsDrmu s;(0trtrxf3ia1la  anes;s)truoxopoydop   icsat)a2rmu  oo1tpt moeias s2eln p;u4 rerifctotlateau sl(0seumxr oy4al  mies sfa2taxmoou1olt ifetadfm2eaums t)texrmo oy1op  anvo s)s2tmxo iu1alt lfctlsf rumumpnt4optoii3tytfs2ulnvsnt0tlerxr ta1lp   nvo;( seumxrpnodamtnmiesl() 2rmxr ;t1tetoif3tyd s rlumont0 rxrmo3oy1fmtrlneo s  rurxo3oodamtemivi s) Durxro;t0tleomocildfa ua(msn(0aexomo oytopDranvo;()seto(rpny4lpeemnvia( sDtmxmpnt1oeeo ictyslmDem( snt)aleoircoo1omDeli o;s s2tr(o3oy1ll  lfvi s)aruaxm no0apto o3tadlsDeanvsn(0 exrxociatlmDelu olt0 eurim iy1lmtelfct s)srtrump;u0teen o3iltlmDrau o;t0arxnmf to1oaDe ieo;t) eumxmpnu1lm nlfcsltfaDrmumo;t4oeeo i3tadfa2rau p;u4trtnxocoodfa eln s;s s2to(r3oo1apt  fei t s2ra(  oo1opx  fctld m2rmumsn(4 ltoxr oodfmteanes ()t2um(o3iy4optnmivsas sruaxm ;u0tlt  o3iytfm rau o;t)texnxrcoatlmDe uvo s) 2urxopnudamenmnesl( a2uaxr no4oltn i3iadfa ulu pn() rermo3oodomt  ieil()s2trxm3iu1lmeemiei sfsrua(rp;u1aex mfciatlmDemuvo u)texnmrciotlatelieols)s2urirpou4op emiesa()s2taxrpot4oetoiieiydfsDelnmpnu4trerxf tadfmDrau s;t)s2uo(mpoy4aptnlfvtas)s2ur(  ou0opxomicils aDuanmpnu)tlxrif3iodomteanei s0t2to(m3iu1amenlnct tf Dtr(m no0tptniocils s rlu p;u0tetoxo iadfa eluvslt)srtrxr3nu1alenmivtl(faDtmxmo;t1alxnmociltls eau o;u)texrxrctytoaDelnes t srxrxrpiudoltelicsat) ruaurpoo1olenmocilsls2emuvpnt4 etoxo oatlmD lnvi;s t2xrim ny1lp   fci s aDta(roou1tltnii3tytfmDulu pn(0aexrio3oatfpteauei;t0t2um(opoodamt micsltfa2trxmpot0alxn i3tytfm2uanmonu4alenmrciy1om eln s ()texmir iu1lm nmnet sf 2rr( pot1oeenmf3tysfmDelumsnt)tetnir3oy1fpDelivilt0 rxmxr iy4lltemneslsfs2rruro;u0oeeomieiadlsDemuvsnu0arxrxo oytfm  au o;()t2uoxo3iydlmenlivtl(fsDtaxr nu1tetnio3iadla eauvpn()texnir3to1lpt lu i;t trtr(mpnu1lptnlnvsls)s2rrx oou1tpxnmoeiyslm2emu o;u0tltnio totfp e u i () 2tmio3ou1lmen nei (  2ur(r ot0apt  fciasls umu o t)alxrmrcoy1laDr u o;t0s2to(opoodllte ivs t)aDrmurpnu4aexniiciyslmDrlumsnu0texrmo ty1fatr ivil(  rtrirpoydlme  fct (f 2urxm ;u0texnioctydfs rmn onu0trtrir3oodomD  nes;s trurirpny4lme lnvta( aDur(r nu4alx mfctydlmDranms;t) eenxo iy1opD lu i;s)seurxo3nudomtn icsasfa2trumo;o4olen f3iatfs ulu on()trxnir3iy1oatraueslt0 rumimpnu1lmen icils  2rrur ;u0alxnifciytfs2rln p;u)tlenmf3oytlp raies s0srum(o3nu1llt  nvsasf Dur(  ou4alxnmf3iatfmDua(vs t)arermrciydop   ivs;(0 eumimpiudalen ict s) Drm(rpnt4aex ifctatfm umumo;(4arxnxrcty1omD lies s)srxo(rpiu4omt  ieils  Dtruront4tlt ifetytfaDem( pnu)altoxocoadom eaivs t s2xoim3io1olen ietls s2ua(  ;t0apeoio3iad m2umn s;t0trerxr3iotfmDranvi s)sexoiopny4lltnlnctlt) rurur ;t1tlt  fciydfs2ea(vpn(0arerxo tadopteaieil(0truoir oydlm nmfetas)arrmuronu0teenifciat m um(vont0 etrio3ta1lmt lnvo s  2uoxr3nodamee ivsa()a2umxm ou0olxo ietat a rl(monu4 reoxf3totfm eai i s)s2xrir io1omenmnviat srtm(mpot4aexnifciasfs eaumpnu4treoif3oy1oa eln sls0t2uoxr3oudllt  ict t  rrmxmooo4tlxo feias s2emnvsnt4alenxr ty1omD livslt0t2toxo oydop elfvs tfarrmxr ou4tlt  ociadfm2ra(vo (4 etoio oatla  anei;()setmio oodaptnlfesasf Drmu o;t4aex moetadfm2uauvont0 lenxr3ta1fpte uei (0 exrxmpou4amtemiet ( arurum no1opxn f3iadfa ran s;t4trtrmo oytlmteluvs (0t2urxopno4oltelnes s)s2uaumpnt4apeo ociaslaDel( p u4aetomf3ty1fp e uesl() 2toim3no1lmt lnvs sfa2taumpno4oex io3tlslaDua(vp t0aleoiocoodfpDrluvs;s)seuoirpio4om nmfvs t  rurx ono0tlenif3taslaDeluvo;u4aexrircoo1la e i s;s)sruoxr oy4aptemiviltfaDuaum ou4texoif3tatfm2rlu snt)aetomfctodfaD auvi ()srxmirpny4op nlncsl(fs2ta(mono0alxomfciydlsDeanmp;(0tltrxf todlpt  u s;(0s2urim3nudalee icilsfsDumx onu1aeeo f3iltfm umnvs t0tetrmr3io1fpDraneols0seto(mpoy4ap  mfvi ()sDrrur ;u1aetnifciydfm umnms t4 ltrif tytlpDe i s s seto(mpnudomtnlivil() Dtau  nt1teeo i3ilsfsDrm(ms;(0aetnir3oo1omDr i i;s0t2uoim iydlltn ncs (f Drmumono1tle mfeiytfs2ra( p ()teenxo3tadlptrlivo () 2xmxopiudomee ivi sf 2ururonu1aeeoioctlt aDuaumon(4aexnmfciydfm   i o;t) eurxm iu1lm nlfvi tfarrrxmooo0tpxomietltfm2rmn o t0aeerxocoo1fp raivolt  rto(o nu1lleelivsltf rraxmpot4apxnio3ilsfa rmu p;t)texrxr3tydoa eln o s)sexoxo oy4lleelivs s)sruau oou1tetnifeiysfaDrl(msnt)trxoir todfmDean o s) exo(o3no4olen nesl()s2tmu  ;o0ole iictatfs ea( snu4tltnxo tadopD ln i;(0s2xoxr3io4apt mivs tfs2uaxrpnu4tee  iciasla2eau ont0 etrmoctodom r n s;s seuriopou1olen nvs t  2rau onu0tpeo oeiadfsDrlnvsn(0tlxrio oy1lat  ues;()truoir3iy4lpe mies sfa2um( o;o1opt ii3iys a2rmums u) exrir iotfmDe uvs;(  2umxr oydlm n fvs (faDum(  no0tlt  o3iys m2uanms;(4altnxr3ootlaD auvolt)texmio iudame lfeil(f Dtax oot1aexo feias sDem(mp;(0 rtrxo iodfat luvi;t0 etrxrpnodamt livi tf rrmx pot1aleoioeils s2em( p t)tlxnmocoytla e uvs;t0s2trir3io1am emnvt ()a2tmum ou4alxomfciatla uluvs (4teenir3iy1lptrli s s)seum(r oodlpee fvslt)arrrurp;u4aptniieiadfs2rlu onu0altomoctydlm eai s;()trumirpno1oltnlfvs (  Dtmxr ;t4alenif3ils sDrmuvp;t) exomoctodom eli o;s t2um(r3nu1olenlnvilt artrum ot4tpxnmfeiatlmDuan s;(0alenio3oa1omt luvo;s) eurir oudlpeelieslt  2umumoot0oex ioeilsfmDrmuvp u)tltriociytfa  livo;t0t2tr(rpnu1ll  lncils)arumu o;u1oeenii3iytlsDrlnmpnt0arenio3iodlp eai i (0 rtoio oydap nlneiat)srur(m ;o0alxo i3iytfaDrauvo t0 exomf iytom  ln o;t)srxoir3nodlme  neilt) Dumx  nu1opt mi3iysfa2ulnvsn(4 rtnxrciytop rli s;(  2xmir oy4lme  nvs sfa2tmxrpnt1oex iociydlaDulnvp;(0 eerxo3ta1fmD  u ilt0srxoir oy4ale mnciltfs2urxrpno4apxn o3tydfm umn p u4 ltrxr iodfmDraivi;t0 rxoxopiy1am  lfvsa()s2taxrp;o4alt io3iadla2umn o;(4 lermrcootfpDran s t)sruoimpiu4ol   netat  2urxmo;t1alxnmicilt a2ulnmo;() etoifcootla   nvslt)srxmxm iy4llen fvi ()s2umurp;t1apeomfctls s uaums;u)tetriociatomDr ivi s)trxoxr3ny1opt  iviltfarua(monu0aleniociysfs ul(vp;u4 leomr oytoaD aivi;(0s2umxm ny1amtnmfctat)s2tr(ro;u1alx ifctat s2emumo;t) lxnxrcto1lmteln ols)trtrxm3iudol  livsl()sDra(  ;t0oexnmfcild s rm(mp;t)aeerxr3totoptraues;t teumir3oydalt mfvs s  Dururp;t0tet if3iltfm2rauvp u4 renir3iatla elies;s0 euoxm iodamt lneia(fsDtmx oou4oltomoctldlmDul(vs t)teenir iy1lpDrluvo;s tetm(opiy1opeelncsls sDumu oou4oleoifciltls2umuvo ()teeoif ootfm  ln sl(0teumxm3io4lltnlncia() 2rmurono4olt mo3iltfsDrm( s;t) eermf ta1fa e nvslt0s2xrio3oydalen fci t)srurxm no1olx  ociat aDemnmsnt)trxomr oatoa  lu ils)tetm(m iu1ape mneilt aDumum no1aexniiciytla2umumsn() ltrmr totopD ln ils)s2xoxo3oydoptn ici (f Draumooo4tpxomi3iytlmDulnmsnt)aetnmf3oytom  lieo;(  2xrxr nu4apte ietas)srum(  no0opxoiieias a2ua(mpnu0texrmfctadfmte ieils0 euoiopio1lmtnlieilsf Duau ono1optoiictys a rlnms;t0aetnxo iodla eanvo;()srxmim3no4op nlnci (farrmu  ot0aexo fetld s ua(msnu0tetrxf tytlpt  n i;s0sruo(m oy4al e nviltfa2rm(  ou4tee  ociasfm2eanmo;u)trxrxr to1fm r u olt) 2urxmpny1lle  ictlt)arra( poo0alx mfeilsfaDranms;(4tltnmrcoo1lpDr u i t0 euo(r3oy4apenlfvtlsfarrm(mooo4tlenmociadfsDrmu pnu) lxomoctotop   uvs;t) exrxo nydamt mnes s) rrax  ;u1aetoifciad m ra(ms u) eerxoctytfptrau i s s2um(m ou1oleelnes s)aDrruronu4opt mo3iytlmDrmums;t0alxnxo iotlpD lnvil(0setmxopoo1apt mncilsfarrr(ro;t4oeto octadla em(vp (4aleoxf io1lpte nes s) 2uo(r3nudlltn ivils)srtau p;o0tlxn ociyd a umu o (4tlxrxo3io1lpDeluvols trxo(mpoudop e ici ()aDtmxm ot4oet  o3tld mDeaump;t4tlermr3io1fmtr ivi;(0 rurxm io4lpe miviat) 2rr( oot0oexomoeiasls ua(vsnu)altnmfcoytfa e nvslt0seuoxrpny1apeelfcilt sDtru ont1alxo i3iydlm em( o;t0 rxoxr3oy1lptr i sl() eum(m no4oltnmfeils) Dtmum nt1oeen feiltfaDelump () rxomf3iatfat anes;s0seuoxo nu1lpt  ivi ( aDrmu ont0aeenifeiasfs2ea(ms;u0trenxrciadfm  anvols  2uoim io1lm n neias)s2urx ooo1alto fctatls umn snu)alenmf oo1laDe i o;s) euoimpoydameemnvi s)arum(  ;t4alenmocild s rmu p;t) etnxo3tatfmDelnvi ( srtoxmpio4ome miviasfsDuru  no4aet ifeiltfaDrl(vo;u0 reoxfciytfp   nvo;t0texr(m io4amt mfciatfa2tmxmpnt0olt moctldla2em(vp u0 etrircty1lpDr uvol(0t2umirpoodame mnvia( sDraxront4alxo oetld a2emnmp u)aexrxfcoy1fa e nvs;()t2xo(o3iy4am  micsas  2rax o;t4opxniicilslsDrm(mo;()artnmf3tytfa   neil( sruo(m3oydolenmnctl( s2umx  ot4tpxnii3ildlmDeauvo (0trerio iatlpDeau slt  rxr(r3ny1open nei ( s2tau  ot4tpeoifeiysls2umu o;t) reomo to1fmteauvil()trumir3oo4lm e nci sfaDra(  nu4apeoio3tydla2ulnvo;t4 ltoiociy1latr i ol(0 exoxo oudoltn fvtatf Dumxmo;u4oleoiocild a ulumo u4 etrmrctotfm ean o ()s2to(mpiudlltnlnetlt sruaum oo0oltn i3ilslaDuanvo;u4alerirciy1oat aneols)trxmxo iodol   ivs (f ruaxrp;o1apx  iciytfs2el( s;t)trtnifcta1oat  ueil()truo(r nydlptn ivsl( sDurx pot1opxomoeiytfs2rmnvs t0trermfcto1om eau il( texo(rpou4lltelnvtlt srta(r ;t1tetomi3ildfs uan p;(0tlxoxo iydom   ies;t0truo(r oo4ome mnvsatfsDur(mp;u1alt  o3tatlaDum( s;u4 rxoxoctytfpDrlueil( trtmxm3nu4optnmfctas) 2taxronu0tleomi3iyd aDrl(vsnu)tleomocootfpD aivolt0 etr(o nydom nlfet s) 2um(r nu0tltn ociydla2ua(mo u0 rtnmo ootfmt anvo (  rxmiopoo1lm nmivtl(  2rm(r nt0oexomfcilt m2umnvpn(4trtrxf3iy1oa  lies;s)setoir3no4lpte fetltfa2tmx poo0tpe  octat a2rm(mont4 reomr3to1lp rluei;s0seumxm3oo1ap e iviatf Dur(rp;o0aeen oetad s umn o;(4altnif iy1omDe uvil() rxoim ou1alee feiltfarrmxr oo4tpx mf3tlsfm ul( p;(4texomociodomDrlnvi t s2xrxm oy4aptelivs t)sDur(rpoo1tleo octlt s2uanvp u4 rtrio3iotfm  lues s srtr(m3io4lm  lfvi ()artaump;u4tpxnmo3iysfa um(vo t)tlxoxoctotlatelieols  rxmim io4ol  mfes () rur(  nu1aeto fciatfm2um(vsnu4 eeoxf ootlmt lueo t)s2urir3iydoltnmneiat  2ta(mpnu0tlenii3ildla rmuvp;(4trerxfctatfpte uvols)s2umxopiu1al e nvi t)s2tmumo;o0aex mictadlm eln pn() exomo oy1fp r nvo (0 exmimpoy1llte fci (f Drm( ont4oeeoifeiydls um(vont)trtnmf oytoa   u ilt0 2xr(o no4llte iviat)srurxrp;o4altoifctytla rlnvp;t0tetnif ta1lat aies;s0srtrimpnodlp e ivsas)sDururonu4openmictytlm2ul( sn(4 exrirciytoat  i olt srxo(r3nu1llt  ivslt s2umxm oo1ale  ociysls ua(mo;(0 reoxfcoatla rlneil(  2uoxrpnydapt  net s) 2taumo;o0aexo i3iydlm2rm(vsnt0aetnmf ta1om e nvs s0s2toim3no4apt lfctls)aDta( p;u0apenmf3iatfaDulnms u0 rtoxr tytlmte i olt)setmirpio4alenmictat sDtrumo;o1optnmoetaslm2ulump u)tetoio to1fptranvo s  rtoxo nudape mfvilt)arum(r ou1olx ioctydla2elnmp u0treomf ta1fmDe ueol() etmxmpoy1oltn neils)a2trurooo1tptnmi3tld m2umnvpn()trxnir iydlat  uvi (  exrir3oo4am elnci sfarumurpnu0alxo o3iytlaDul( p;()trxrmr3oytomDr ueil( sexriopiy4ap nmicsl()sDtrxm no4ape ii3taslm rmnvs;u0arxrxf3tatlm rlivs s) exmxo3oo4oltnmneta() Duaum ;t1aptniociltfa umu pnt0tleomo tydopDe n o;s) etrxm3nydamt  netasfaDrau ont1aet mfcils m em( o;t)alenxf oo1om  aues;t)s2tmxo ny4lpe  fvsasfaDrrur nu0oetnmf3tysls2eanmonu)teerxr3todfm  aneolt)teurir3no4olt lfei tfaDta( poo0tlt mociad m2ranmo (4 lenmr iotlaDe ies;(0sexr(r nudopeelncsa()s2tm(r oo4apenmociyd sDua(vs;(0areomr oy1fpDe ivi t0t2umir3iy4op e ivsas)a2tmxm nt4opxo i3iysfm2rauvs t)aexnxr3iatlmt  n o ( t2xm(m iy4lltn fvs sf rrm(  ou4alx ifciad s umumsn()trxoxf oodoa  lnvo;s0trur(m oodapt lnetas aDua(monu1aeen f3iytfm2rmu pnu0aexoxr3iotop rlnes t srtrxr nydll  mncia()s2uru poo1oetomfeildfa2rmn s;u)alermoctadfmteau i t s2tmxr iodllenmfeslt  Dum(rono4aetoii3tas s2rl(ms;u0tltrxrcoy1fatrai o;(  eumir3ny4olt mneias)artrurp;o4aeeo feiyd a2rm(msnt0tlerxf io1omD  ieilt  2tmim iu4am eliesa(  Drrurpot4altomoeiys m rl( o;t)alxrxf to1fp eliei;s s2xoxmpou1olenlnvtl(fsrrrx o;o0aexomfetldfa ea( ont)aexnmf3oo1laD aivol() exrio3iydapt  netls)a2uax ono1aexomo3tltla rluvsn() lxnif oadla eai o t0 2uo(opoo1omenmfcils)a2rr( pno4opto octysfsDrau pnu0tlenxf3iatfateauvil()texo(mpoy1amtemncs ()s2trx  ;o4opxnifeias sDua(vo t) ltnxf todfmtr nvs;t0trumimpno4lltelietl() rtaum ;u0oex io3tatlm umuvp;t) exoxo3todfateaneols0 eto(o3ny4am n nvtls s2rrxrono4oltomo3tysla rl(vs (4 lxnxo to1opDr uei (0trxrxr3nydameelneils  2ua(mo;u4alxo i3tyd a2ra(vo;u0 lxoifcoatlm eauvslt)t2to(o3oy4apeelfct t arrr(monu1oexnif3iytlmDrlnvp;()alxnxf3oa1laDe ivsls  2tm(rpio4ll   fvtat) Draxrp;o4opt  fctys mDemuvo t0 eermo3tytfmDrlnes t  rxrxm oo1llenlfcias sDuauro;o0oeen oetyt s2rlnvp ()trermociodlm rau s s  etm(rpio1ll elncsl() Dta(rp;t1tex mieiydlsDrmums ()trxoiocootop rauei;t)setm(r3iy4omt  fvt (  2tr(moot1tpe mi3iaslaDrmu p (4teeoioctodoa elu s t) 2xr(mpiu4ap nmnct (fartr(m ot0ale iociat a2uaumpnu0tltomrcia1fmte i i;s) exo(rpou4apenlfesls  Dta( p;u1oetniieiyt s2emnmo u)arxnmfcty1fatr neol( s2xoio3nu4alt  nvs s sDtmumonu1teto oeilsfs2umu o;(0artnxo3oodlaDr ivo;( t2xrxrpiy4lm  lnct (  rumxr ou1oex ifctysfa2rm(ms;u0arerxrctodopte u slt) 2uoxmpiydomte iesat s2rau onu1altnmfciadfa2rau s;(0tltrxr3oadfaD aies s0sexo(mpnu4lm n iet () 2tmxroou4aeto oeildls2ean ont4aeenifcoodlptrauei ()t2uoxr no1ole  ivtas  rrrurp;u4aeenmicias aDemumo ()arxrxfcoodlp e n slt0trtrxm3iodll e fcil()aDurxmono0optnii3iydfs rm(mp ()tetoxf oy1lp  anvo t)s2xr(opoo4ll nmnei tfarraxront1aeto fciad sDua( s t0aexoir3iy1faDelueo;(0trum(m iu1open nciat)arrrumonu4tpe  fctat m2ea(ms;t0tetrxf iadfateaies;t)setmxm oydolenlici t aDrax  no1tlxn ieiltfaDuau pnu) ltnifcoydoaDranvolt  eur(o3no4ap e icsls  Dua(r nu4opx  i3iysfsDrmnmp;() eenxr3iodlm elnei s  2tmimpoo1amtnlfeil() 2ururpoo0ole io3iatfsDrm( onu4 lenir3iy1lm  ln o;t0t2to(m3oy4ol e neil() 2rax oot0tpenmi3tysla2rl( s;t4trxoiocoatfateauei;(0 euoxmpoy4olee ietl() ruaumont1tlxnmoetlt m ra(vo;t0arxomo ootfaDe ieilt0t2uo(o3io1apenmnei s s2rrur ot4tptnmfeild mDemums;t0tlxoxrcootomDranvo;( sexmxm3nudapte nes () Drmum ;o4oetomieiltfs rln s;u)arxrmr3tydlm  an o (0tetmxo3nodlltelivsa( a2ur( pou1ole iocilt s ea( s;()teermrctodlm e uvilt s2uo(o nudam nlivsls)a2rrxrpoo4oetomoetyt m2uanvp t0aeenxr3oadomDeaiesl(  2xr(m3nodalenlfvias) rtmu o;u1teenioeiasla2eaump;t)aeenif tydlpD an il(0tetrim3iu4op nmncslt srrrxr ;u0oleniicilslm ua(vs;u0trtoxf3iydfmDrlueo s0sexoxopiy1lmte ici tfarrmuronu1oleoioctys sDeauvo;(4texomo3oadomDeau ilt0s2trxrpnu4ol  lnvslt)arrm(m ou4oee  ieiytfsDum( s u0tleoircto1opteanvols) euoxrpoydlm elivsas) rrr(rooo1tlxniictyd a2eanvsn(0 lermr3iotfm rlivil(0 rtmxm nydape  nvils arrmump;o1texn octys m umnvo t)texrxrctadop r n i (0trxoimpiy4omt  nesat)aDtaumont4oeeoiieiatls2ea( s;u4teeriocoa1late uvs;()srxm(opoy1lltemfcsasf Draxm nu0aeeomo3iytfaDul(vs;()tlenmr oa1fp eauvs s0s2to(m3ou4opt  ncs (fa2uaurpoo4apxomoeils s rlnmon()alxnmo iotoa   n ilt sexrio ny1ll e icsl( srtr(  ou1opeoio3tasls2ulnmo (4texomr3tydoa   nes (0t2xm(m oudol e fvtls) Dtrxro;o4aee ii3iadfs2emn s;u4trtoircia1oaD  uvs t trtmir3iy1apenlictl(fsrrau poo1oexo iciydfs rlums;t)areoif3oodoa   ivs;t tetrxo no1lpt  ictl(farrrxm ;o4opx  o3tytlm umuvpnu) eerxf3oadoat luvi s srtrimpoudaptnlnet s)s2trurp;u4opx  fciat m ea(vo (0 exnxo3tadlp rlu slt t2uoirpno1lptnmics s a2ur( o;u4olxo fctyt aDeaumsnt)trerioctytfaDr u sls0t2uoim3oudlle mfcsat)s2ur( o;u1opxnioeiyt s2umuvo;(0arenio3to1fm  lu o;t)t2um(o iodlleemncslt)a2umu pou1oet  f3ildls2rl(ms (0alermrciytlpDean s;(0srtoio3nudll  licta()s2ur(mo;t0olt ioetltla2uau p t4tlxoir iy1lpDr ivs (0tetmxm3oudlptemfcta(  ruaxrpot4texomoctls s ul(von()areoxo3iydfptr ieolt) euo(m3no1amtnlfetat)a2tmxm ;t4apxomictlt s rmums u)trtrxrcoatoat  n s;(  eumxopiy1ap emnvi (f 2ua(mpou1oet  oetasfa em( p;t)arxnxo3oodlpteln s;s)teumxm3iu1al nmncsa() rur(ro;u0alxo ocils a2rmn p;u4treoxr ootfp rauei;()texmimpoo1alenliet tfsDur( pnu0tpe  fciltlsDemumsnt4trxrio3io1faDe u ols0srto(r nudol  mivsat srtm(m oo0tetniociat mDraums;u0texrxrcoy1fa ranes;s) 2to(o nodalt lnvtlt srtmumoot1opeoif3iltfaDumn snt4arxrif3tytomtraueo;()trtoim iu1om nmiesat sDum(rp;t0teen fctatfm um(vsn()trxrmf ootlp e nei t)srtm(r3iydop elnes ( sDuaum ;u4olxn iciysls2ulnvo;t4 eenircoodfpDe neo s) eum(mpno1lltnmfci s  Drrxrpoo0opxnif3iadfs2um( o t4tetrir3ta1oat  ivo ( srur(mpou4am nmnciat) rurxroou0oetnmieiyd a uan p t)aexnmf iydop rluei s0s2xrxo no1altemfct t)aDrau  ot4tpxoioetyt mDua(msnu4 lxrxrctytopDeaues;s teuoxo no1ll   netas aruru pno1oexnmociad s ul(vo;(0 rtniocoytop e nvi s)seum(r3oydlmtnmicias)sDrm( pot4ape mi3ild mDum(mp;t0aetnxrcia1fmte uvsls0 2tmir3ou1lptn ictls aDuaumonu4apeoiocilt a2umn p;(4trenmr ootoat  neslt0s2xoxr3oy4lpenlncs t srta( o;o4aee if3tlt a2rl(mp (0arermo3iodopt li o t0 exo(m iu4omte icias) rum(ro;o0olt moctys m ulnmp;t)alxnxf oatfaD  nvs;s  exoio oo1lmtemncsatfaruaxrpoo4aptoifeiyd a ea(mp;t0 eenxfctodfmteauei;s seur(mpnudamtnlicias)aDum(mpnt0altomieiadlmDuanvo u) lerxf io1faD luei s t2xm(r oydll  lfvias  Dra( poo1oltomiciadla rlumo;t4artoxfcta1lp  aueo;s srxmxo3oy1am  lfcsls  Dta( pot1tle iicildlmDumnvo (4altoxocto1omDelnvi;s t2tm(opoydol emiei t)srtrx  ;t4olt  iciyt a rlu s u4tetrxo oa1om rln s t s2to(r oy4apt lnes s)srrmurpnt1teenioctlsls2uau ont0texrxfctatlm r u o t)srxm(mpoodlm   ies ()arur(rp;u1tpe mictad a2ua(vs;t)tlenxr oydfa elu o (0sruo(m3oodap  mfvsl()arumum nt1tee ii3iltls2eauvp;t)tltomfciydlmt li sls trum(m nodop elfetls) Drm(mo;t0aptomo3iltlm2uanms;t0aexoio3oy1faDe ivil() eumirpnudaptnmnet t)arrau  ;o4ole io3iadfa uanvpn(0aexnxo3oa1lp   n ils t2toxo3nydlpte fciasfsDtrxrpou1tpx ifetytfm eaump;u4aexoxo io1fm   i o (  2xo(m iudom n ieta( aruru  ;o0openifctldls eauvs;()aetoxo3tadoaDe ies () exoir io4omeelicsa(farrmump;u4ope  oetldfa emnvonu0aexrif iadlmDrlnvs t s2xr(mpnu1lltnmfvias)arum(  oo0aeeoif3iasla2ea(vp t4areomr tatomDe n il()trxm(rpnydal n fei t arua(mo;t1tpx io3tatfm2rmuvp ()tetnmo3oydfm eaies;t0 etrio3oydlmtnlnvtat)srrau  ot1texo i3tydfsDean snt) rxoio io1laDeaues;s setrxo ny4llt mneslsfaDrr(  ;t1aexnmocildls rmnvsn()tltnxf oydfmD  ivo s  eumimpoodamenlnvtatf Duau pnu4alxnifetas mDem( on(0texrir iydopD li i;( srtmiopoo4oltnmnctas  Dumxr ;t0tlx mietltfa2ea(mo;u) renmr todop r n i;s trxrxo3nydome mivsa()sDtrxrpou0oexomfeias sDulnvs t)trtomrciy1om e neslt) rumir3nu1lp e ics sf rraump;t1opeoiictadlmDelums;u0aeeomo iotla  liei ()trtrxopoo1ole lfei (  rtr( pot4olxnifcils a ean p;(4tltnif oodoa e n s;s0srumxr3oodlleelfei sf 2ua(  nu1olxnio3ilsfm2rlu o;t0tlxrxo oa1fp rlnvsls0 etrirpiodal n ietl(  rrau o;u4aetomf3tytfs2emnvpnu) rxrif3oodfptrau sls  2um(o3nydap nlnci t) Dua(r ;u4ape mo3ils m2rmump;(4arxnmrcto1la eluesls)t2xriopno1oleemfcias)sDtrumono1opxoio3tytlmDeaumpnt0aetoif3oydfmDranei s s2toirpny4op   neslt)a2um(ro;u4tlxoif3tadfmDumuvs;(4arenmr oa1lm e u ols)t2xoxo oodamee ncs sf Duru  no4alxniictyslaDeanmsnu4trxrxf ia1fp eauvols s2tr(m3oo1ol e nvslt sDrrxr nu1oltoii3tldlaDrmumo () etoxr3totlmDraneo (0 2xm(r nu1ole mfctls)srraxrpnt1aexn oeilsfa2uln o t4trtoxr oadoaDrlnvi;t)s2uoxm nodomtn fes s srraxr ou1olxnioctld aDem( pnu0artrmr iatlpD lu s;(0t2uoio no1ape  neslt s2uau ont0alx  fctydfs ulums u4 eermociytla e n il( truo(o3nudlle lfcsa()s2ur(m ;t0tpen oeiatls2rau p t4trtnio3iytomD lueolt teumxo3ou4amte icta()aDurxrpot1apxnmietyslm2rluvsn(0tlenmrcto1faDeaivo t0s2toim no1lpee fctas s2raxr ou4tptnifctldfmDulnmo u4 rtrmf3tydfpte uvo;() 2xoiopno4lptemiciasf rtrumono0aet mictadlsDea( p;(0 etoxfciadfmDrlivs;t setoxm iy1ope lfctlsfartmump;t4apx  feiytlm2rl(mpn(0 ltomo3todlm rli s;t0texo(rpoo1ome mnviat arta(r no4tlx mieiyt aDrauvs (4texnxfctadopD aivs;(  2xoimpoo1open nvt ( arumx p;o0tpxo fetadla2el(mo u) rtoif iytfpD ln i ()texmxr3io1optemneil(farua(rp;u0tlx mieiyd m eluvo t4 rtomo ta1lm e nes ( teur(opny4amtemnvi sfs2uaxr no1olxomi3iasls2ulnms;t4artnirciodoa eln o;t  2to(m nydlmtnlieilt a2tax  ou1ale  ietys aDea( snt0 ltrmr3oadfa rlivo;(  2tmxo iy4op elfcta()sDrrxrono4tpenmo3tyt sDrau sn(0treriocoy1faD  uvs;()s2xm(o3ny4apen fetat a2trx oou4oeeoiocilt mDrmuvs;t)tetrxf3iadop eliei;s)trumxm3iudome  iesls srtrx  nt0apenmf3iytfm2uaumpn()tlxoxrcoa1lat auvo;t)t2uoiopou1lltn fvs t)s2rau o;u0aexnmieiltfs uan s u) lxnmrcoadop e nvi;s tetoxo nydap   fcslsf Drmxmp;t4opxn fcilt m eanmont4 rxniocia1lmDrli s;s0 2toiopnudapeemies tfaDtm(  no1tee mocilt sDem( p t)trxriocto1oaDraivi;t)sexm(opnu1lm emncslt srur(r nu1aeeoio3tatlsDean pnu)areoxr iadoa eaivolt)s2tmio io4ale lietl( a2ur(  ou0texniietysfsDeau s;(0trtoir tadlaDr neilt0t2xoimpiudlpt mfcs t) 2rmx oot1oexnmicilsla2raumo;(0altnxo oytlpte iei t0setr(opiudolt mivtat)srrr(rooo4tptoiicias m2eluvsnt) exrmo3oydlmt  uvols0 2tmim3no1lleemiet sfsrurx pnt1opx  feildlmDua(ms;(0treoir iodfpD  n i s srur(mpiy1amte icias  2urxm ;o1oet  i3ias a2ul(msn(0 eenxfctodlp rlnei;(0s2trio3nydlp   nvs t  Drmxroou1apxnio3iytfm2ranvs;t4aetoif io1laDrln i t)trum(o nu4op e nvt s)s2uaurp;o0oexoif3iydls ul(vsnu0aexoircoatlp elneo;s  ruo(rpiydoltnmiviatfa2tax  oo0oee  i3tls a2elu s;u4tetoifcia1lpte ivs t trto(o3nu4lm   iviltfarrr( p;u0oexoii3ildfa umump;t0texnmr iytopt  iesl()s2urir oo1ope lfvtat aDtr(mo;t1alxoii3tlt mDrlnms u)alxnio ia1lat  uvo (0 rtm(r iudapee nctasfaDtru  ou0tpenmicias m ulu pn()arxoio3totlp   ivil() exo(o oy4lpenmfcil(fs2tr(mont1ape mociat m um(vs u0 etoircoatoa r nvo;( s2ur(opno4llt livsasfs2ra(ronu0altomictldlmDumuvp t0artriocoy1om r nvo;()tetm(rpnu1lpenmfctlt a2umxm ou0open i3iydfa ua(vp (0 eermfciotfateli i;t)srxr(rpiu1amee iesl()a2rmxmpnt0tlx  f3tydfmDrm( o;u)tetoir ta1fat lu ols  rxoir3iodaltemfet (fsrrmur ;o4olx mi3iltlsDrl( s;u4 lxnxo3tydomD  i s t)tetmxr3oo1lme  nci s)a2taxro;t0apen ietldfs emnmp u4treomo todlm  aneslt)t2umio3iu4ll elncs s) Dtau ono0alx ii3tysfm2ul(mo;(0teenio io1lm e uvslt  rxmio3io4llenmivs ( s2trx poo4oexomo3tyt a rl( snt4 eeoxfcoadomDe nei (  rtoio ou1am n fetls) rtax pnt0olenmietat a umuvsnu) reoifctydlaDraivi;t trto(r3oo1lltnliesl()aDtm(rp;t0tlx  i3ilsla2ua(mpnu0trtrmociydoaDr ieils0tetmxmpno1lptnlfctatfs2tm(rpno4opxniictatlm rlu snu)teeoxr3iotfm raivils0srumxrpiy4omtnlics s a2trxmpnt0olx mo3iatla raumsnt0areoifciadlpD  ieils)tetoirpio4lme mfvt (farumu  ;o1tpeniieiasfa2em(vp (0trenmociodlpt aues;t0sexmxr3oydalen iei ( s2ta(rp;u4tle miciydfsDrln pnu4aexrxociydlp   neo;t)s2triopiu1op  lfet t a2taxro;o0apxomo3iltla2em( p t0 ltnxr3iatlmD aieo;t0truo(r ou4opt  nvt ()s2tr(r ;o4alenifctlsfsDrm(vs;t0trtniociotlatrlivs;t  2urim3oydllee nvtat  rrru  oo4teenmieildlsDuauvs;t0aeerio3totla ean i s0 2xoirpnydap e ieilt) 2um( pno4tle ii3ias aDumu snu4aeerif3iodlaD  nei;(0s2ur(opou1lpenmics t  Dtm( ont0tleniociysfm2emuvs;t0 lenmfcty1fm rau s;(  2xo(o iu4optemies (  Dum( onu0oetomiciyt mDem( pn(0teenxfcoatfmDeli i;s)t2tm(opio1amenmnvs (f Drrumoot1apxnif3tyt s rauvsnu) lerio3iydfaDrlueo t)teurxr oy1olt micsatfa2umur nu1olx  f3tld m rlums;u0 ltoio3oy1omD lu o ( srxo(opny1llt  nviat)srtr(mpnt0tle mf3iltfmDeauvsn(0aexoifciatfaD an i t0trur(m nudlltn neilt arrmxmpou1tle  oeiatfs uanms t0texoifcia1fate nvs;() 2to(r3no1lp nlivi t arrmx poo4optnmfctysfa rl(mo;()tlxoxf oodlat luvo;t0tetrio3iy1ap   ivtls) 2uru pot0opt mfeiasfa2rl(ms t0trermr3oydoaDraivo t)t2urxopiu1lp n icta()s2ururp;o0oltoioetldfm2uan p;() exnmf oytlatrluvi;()truoim3iudlp n ivs sfs2rr(rp;t0aptnmiciltlmDel(mont4aleoxrctydfmtr neo s0srtrxrpio4lp  miciltfsDra(rpnu4opt  fetys sDumuvont)tlxnirciy1fmtelues;s0 2xm(o3iydlltnmnvtl(faDtm(ro;u1ope iictadfaDulnmont4 etrxocoatfaDrln slt0t2tmxm oo1ome lici s) Dtrxr ot0alto ociydfsDelnms;(0tetrir tatomDeauvi t)seur(r iydom n fctl(f Dtmxm ;u1oee ii3ilsfaDemn s;t0aeeomocty1fa  ai s;s)seurio3nu1apen feta(  rtrurpno4apx ifciydfaDumumo (0 rtoif3io1fat liei;(0teur(r3nodlmtemfciasfsDtauro;o4oee ii3ild aDuln ont0tleomrcoytlpDrlivi t) exmir oo1omte ivtat s2tau  ot4aleo feiad s2ua(mo u0alxrio3ia1fa   n ol(0t2tr(m3oo4lmenmics t)srrm( pou1oetoioetlt s rlump;u)trxnmf oy1lat  nvi () eur(o oodop e fvtat  Dtrx pnt0tptn ictatfs2uanvo;(0aetrio tatfmt luvi;s)trtmxo3nu1amt mivilt) Dururont4oexnio3ilsfm2elnvpnu)aetnirciotfaDeln s ( t2xrimpoydopenlieias  Dra(mpno1alxn oeilt a2ulumo;(0areomr3iatlptelnvils texo(r oy4omte iesas aDra(mp;o4tpx  o3iytlsDeauvsn(4tltnircoo1laD aiei;t0t2trxmpiu1lp  lfcslt) rtm(r oo1tptomi3iat m2umu on()aetoxr oadlat luvs t0teur(o ny1apt mfvsas)arurur oo0tltnii3tys m rmn p;u4aetoxf3oatomDrlivs t0trtoimpiudame lnct (fsrtm(moot4openmoctltlm2ul( o u)trtrxo oydfatrauvo (  exmxm io1lpe  fcsa( s2umu  ;o1tltnmoctytlm2eauvs u0altniocoo1la elu s ()s2uo(o nydalen feils)sDtrumpnu0aetoio3tltla2ulnvo t4 eeoio oydlatrai s;()srumirpoy1oltnmicils  2urx p;u4tpenii3iadlaDeln s t)aexnmrcoa1lmtrlnes;s0s2xr(opiodoltnlfcs s) 2tr(m nt0oexnifctydfa2emnmp t)aetrmf tatfpteli o;t)teurxo ou1apeelnetas)a2rm(m ot4alenmfciys m eanvont4 eermo3tatoptelneo;s  etoir3iu1am  lnetl(fa2rrur oo0oee mfciytfa rluvp () etnmf3oatoptrlueolt0t2uoirpiu1ameelieilt aDra( o;u4opxoiietytla umnvonu0 rxnifcio1lp elivi s) exm(opnu1am  mncs t)sDtmuronu4tetn fetytla ra(mo;() lxnio iodfatrluvi;t  2xo(o3io1optelfvta()aDrm(  nt4aexo feiatla elumpnt0aeenmr3tatoatelueo t  2xmiopny1lptemfes sfsDuaxm no0apt moeiatls2rm( s (0tetnmf ta1lpDrli slt seuoio no4lme mivil(fsrurxmo;u4tpenmf3iadlsDrlums t4 exnifciodomtrluvi;s  2um(m3iodamt lics t) rtrxmo;o4olxo fetldls2rluvs u4tltrmfctodfm   neo;s)trxmxr3iodoptnmfctas) ruax  ;o4alxoiieias aDum(vo (0alxomocoadfpD luvo;t0sexrxopio1oltnlnvs ( s2rr(mo;o4aetomicild s2uauvo;()tetoiocty1fmteaiei;t0 eurxopio1ameemnctas)s2taur ot1tleo fcildfm2ea(vo (0tetrmo3io1fp rlneo;t) 2tr(mpio4lme lfvil() rtax  no0aex iociysls um(mo u) rtomf iodlpD  ueo;t)seuoiopny1ll   fci tfaDumur no0teen fctadfa rm(ms u4trtnmf3ootlat ln o;s0trtr(rpiu4opt  ictlt)aDrmum ou1aptnmfcils a2rlu s t0aeeoifctodfpDeli i s0srxmxo nudap elfvs (  2tmurpno1aptn fciasfa2ulums (4teerif oodlate neo;t0t2toxo ny1am n nei s sDuaxroot1opxnmoeiltfaDranvo;(0 eeoio iy1latrliei;s texmxrpno1amtemncslt srtrx p;u1aetoiiciasla2eln p;() eeoircootlpte i ols0s2xr(rpnudom n nvtltf ruau  ot1tlenio3iad a2emums (0artnxrcty1opDranei;s) 2uo(r3iy1om e nct (  rur( pou4olx mfetatfsDrm(vont)teeoir tadlpDelu s s0 etmio iu4optnmfcs s  2umxrpnt4texn fetydlaDulums;u0texrio3tatfaDe neols t2umimpoo4amt mics sfsDumxmonu0apenif3iat m2ulnmont0 exomf iytlpDraneilt0trtm(r nodll  mfvi t arrrx pno1oleomo3iyt s2rmu s (0tetnxf to1opteau olt  ruoxr ny4llte neta(f rur(rpot4tpx mfeiytla uauvo u)altnxr oytla eluvi t0t2ur(opiy1am elivtlt)a2tr(mp;u4aet  f3iytlmDra(msn(4trxnxr oa1fp  aivs;t0 etoxr ou4amtnmfvsas) rtaxr ou0tlenio3ilslaDeaump t)trxrio tydomte neol( texmxo3iydam  mivsltf Dra(rp;o4oeenmoetld m ulump u) rtomfcoy1lpte nvi;t)s2tmim ou4ol e feiat s2um(  ;u1tee  ociys a2umu snt0trerxrctatlm rauvi (  ruoim3oy1ll nmfcsat)artaurpou4aeeo ieiatfsDulnmpnu)aeeoir oadfp rlneol(0trxoxm oy4ll elfct ()s2umurp;u4apxn i3iasls2elu sn()texnmrcootfa eauvo;s0srxriopio4lm e fvsat sDtm(m nt0openmoeiadlm2ea(mo u4 exoif oo1la eau i ( srtrir iodlp  mfvias  2ur( onu1texnifeiysls rl( s;u4tlxomf iadla rluvo s) 2tmio3nu1opee fvs t)srtmur nt4apxoiieiysfa uanmp;()artomfcoa1lpD ai s (0trxr(m3iudll nmfeiat)sDtrumpot4teenmociad mDuaump (4 lxoxo3iytfaD lnvo;( seuoim3oudome lnesa( a2rax p;o1ope  f3ilsla2em(vs t) etnmr iytlmtelnes s0 exmxrpoydlp  mfcsa()sDtr(mpno1aee  iciydls el(mp u4aeenxrciy1op r ivilt0tetrir3nu4lmenlfei ()srrmxro;o0tptomo3tldfsDumuvo;(4 rxrirctodfm  ln s;s0trxrxr3io1apenmnesl( artrx poo1aeeoif3ildfm umnvpnt0aexomo tytoat aivsl() rtrim oydlmte feil(  rrm(rpou1teenmociaslsDumums;u4teenio tytlmDrlivi t) etrxr iy4alt mneslt aDra( p;t1tee  feildlmDul(vo t0altomf oodomD anes;s0tetoxrpnu4al  lfcilt aDtaxr no0oetn oeilsfmDel( p;() ltnio tatlmDe n s;()srto(m nodlleelictasfarraur nu0tetoifctlt m ulumo;u)alxrmo3iy1lmDran o;t srxrir3ou4omee fei () rrrxrpou4tpeo ieiatlaDeaumsnu4 ltrirctadfpDrlu s;s srtr(rpno4op n nct ()srra(r nu4tpe  i3iysfa2emnvo u0 exoio3ia1fptr nvi t0 2xrim oudameemivsat  Drruroou1aptoiociltlm em( o;t4aetoir3ia1lptran s s)trtoirpnu1lpeemfci t sDrm(  no1opxnmo3ildls2ua( p (0 exrifcio1optran il( srtm(opnu1lp   icta( aDrrx ooo0opx iieiat mDranvsnt4 eenmf3tydoatrln o;t)sexoxr oudlm e ivt t) Duaxm nu4alt  ictydfsDumumo;(4 rtnif3oadlmteau i;s0seur(rpiodlm emnct s) 2uau onu1alt ifciad s el(mp u0teeoir iadop e i sls)srum(r3oy4lme mivtlt)a2raxmp;o1tpxomocilsfm umnvo;u)texomrcoydlaD  ieo;( t2xrim iy1lmt  ict (fsrrrurpno0tlt  feias a2ranmon()aeerxociytla raivi;s)teumir nu4llte ncias)artmxmpnu1oexnmi3iasfs2um(ms;t0tltoifciotoa rlnvilt seto(r3iy1lme  ietltf 2rau  ;u4aeeoif3tytfs ul( p;u0arenir3ta1op e n o;()s2xrxm iu1lmee nes t sDrmumoou1oex  ieiadlm rl(mo (0trxoxf3to1fpteau i s s2xmio3iu1amtn fci (  Dtmxmoot0oet  ociydla2umn s;u) ltoxf ootlpD  n i;t  rtmir3no4al elictas s2ua(mpoo1tpx ifcild s rmu s;(4trtnmo oadlm rau ils) rurxo oy4altnlieta(f 2tmx ooo0oexoio3tld s ranvo (0 rxomo3oodfpD lnvs;s0 exoxm3nydlpte feta( sDum(mpnu1olxomfeiltlm2ra(mp u0trerxocoy1fat  ues;s texmxm nu4amenlfcta( srtrxm oo1tee miciltls2el(mo u0artnmf oydfp   uvils0t2uoio oy1lmenmivt sfartrx pot1teen feildla eanvp;(4 reomr oa1fatrlies;t0seurio iydomen fcsl( sDtmxm ;t0ale  ictysfm2emuvo u4artnmfcoydfate uvo;t)s2urim3ny4opeemieta(f rrauro;u0ope  fetatla ea(mpnt0tltnxrcoydfmt  ivo ( setrxmpoydap nmfviasfaDrrxrp;o1tet mo3iltfa2raumo (4alerxr3oa1fp elu o;(0 2toxm no1ol  lncta(fs2urx pou4ope mictlsla ean o t4tlenxfctotlptr ivs;t t2xrxm3iy4ap elietat)srumumoou0tlto iciasfmDul(vs;u4 rtoxf3tadlmt  ieo;( s2xo(r3oy4lm emncsa( a2taum nt1tlxnmicilt sDemnvpnu0 ltrio tydfpDrau s;s)t2urim3ny1lm nlivs tf 2tmxmonu1aetn iciasfmDemnvo u) rerxocia1laDrlneo s) 2xmir iy1ap  lictat aruau  ;u0olenmfciys m2uauvs;t)alxnmf tytoa eaieil(0trtmir3nodam  mietatf 2taurpoo1oexo oeilsfa2rlumo;u0trtrir oytla  ln s ()trto(o nu4lpt  ieilsf Drru  ;t4aexniociydla2ra( pnt0tetnxf oa1fa eluei;() rxmxm3no4lmen fetl(fs2rrum no1apt ifeiydfm2emums;t0tlermo ta1opDean i s srtmiopiu1ape mnetas a2uaurp;t0olt miciysfsDrm( snt0tetrif iytlate u o;t0teumxm3oydam n fvtas  2umuro;u4tpxniieiadfm2rl(vont4 ltomrcoytfptr n i;s0seto(o ny1lp  lfcslsfa2uax  ;u1tlxo ociydls ra(mpnu0aetoxf3iotlmtr ueo;s0t2xmim iy4amenlieslsfsDtr(m ;u0teenioetys s ulnvsnt)aeerxo oa1la e neo s  exrxr3nu4lltnmfcilt sDrm(mpou0aet  ictys a2rau p t)aleoioctytlaDraivol(0 etr(r3nodll  micsat)aruax ono0olto feiysfaDean snu0tltriocio1oatr i i;s)trtmio3io4amt lfesls  2trumoou0tee  icildfmDran o;t) lenmrciytoat aivolt) rtoxrpio4opt  ictl(f 2tmuronu4apeoiietad aDel( s u4 reomf3iadlmDrlu o;t) rurxm3no1oltelivtlt  2umum ;t1open ieiat a umuvpnt0arxoxr oatomteluesls0 eumir3iudaltnlictlsfs2urumpot1opxo oeiydfa eanvpnt0aetrio todfmDraivslt tetoiopnu4lmt lictasfartrump;t0alen ociyd sDuaumont0alenxo oatfmteanei (0 exrim iy1lmte ivt t)aDum(ront1tptoio3ils mDelnms u)aeeoxr todfat an olt0 exrimpiu1am  mnvtls aDrr(rp;o0aetnmi3iltlmDeaums u)texrmr ta1lmD lu i s tetoir no4ol n neilt)a2taurono1alxoio3iydfa eaumo;u)tlenmo ootop elnvolt)s2tr(opio1ape mnvt ()aDra(rp;t1tleoii3iyt a ranmo;u4aeermr oodoatr u sl( t2umxm no4llt mfvilt  rumx  no0ale miciyslm2ul(ms u4aeeomr oadoaDeaieo;t0trum(opoydllenlivt ( aDrmxront4tltnmo3ild mDrluvo;t4texnmf tatfp  aivs;() rxo(o3iu1lp emfetls) 2tr(m ;t0aet miciatla ranvp;t) ltnmo iytlm  luvs;s sexoir3iu4al e ies (fsrumxrp;u0olxomo3iadlm2umn o;u)areomf oadfmt  neo t srurxm3oy1lmeelfciat s2rr(rp;u0alxo f3tatlaDrlu s;u4aexoio ty1lpDeln olt setrxo ny1amtnmnvi t  Dtrump;t1tlxoii3iys aDeau on(0 lxoxfctotlp r i ils  rxo(opou1ap nlncs s)arurx  ;u4ole ioeias a2em( pn()trenif oo1omDeluei;t0tetrxrpiydol e ivt tfsrraxrpoo1tpt mfeiatlmDua(mo;u) reomfcoodomte nvs s t2toxmpny4lm e fetl( aDua(  nu0ale iiciyt a em( o u) eeoxrcoatlpteauvo ( srtm(r iy1lp   fci t)a2umurpou1tptn iciyt mDrmnvont0 ltnxr tydfp   n ils  rtmim oo4amen ivt (fsrtr(m nt4tlxoiociatfs2el(msnt4trtomo3iatfp raueilt  etmiopoudole mnet sf rurx ont4olenmoetldfs rluvo;t4artnmf totomD lu slt t2tmxmpny4lmenmici (  rtaxmo;o0ape  i3iatfsDum( p t4altnmrctotopDrlnvo t)srumxm io4ll n nvsas s2ua(mo;u4alxoif3ilsls ua(mp;(0 lxrmr tytoa e uvols)seurxo nu1omeemfct s  Dtr(rpou4tlxnioeiyt m rmu s u0 lenmf3iy1om r n i s0 etrirpio4om n ivsas) rrr(moou4tetnmi3ilsfs emu onu4aeeoio oodfptr u s;s)t2uoim no4ll elncsltf rra(  ot4tlx micildfs rlnmp;()trermo3ta1opD  n o;t  eumxr iydlp nlfesa( sDra( pnu1alto ieilt sDeanvon()tlxrmf3oodoaDr nesl()srxmim iu1al emivtas)s2rm( p;u1olxnmoetld a rauvo;u0arxoxrcty1fpD aivs;s tetoim iu4lltnmfvtlt)aruaxmpnt4tle iieiat a rlu p t0 etrxfcty1laDe n ilt) rtrimpnu1lptn netltf rumuronu1alt  f3tldfaDumu o;(0trtrmocoo1optrluvs t  2to(o ou4lm n ncslt)s2rax  oo1opeomicilsfs eanmonu4 exnmf oodoatr uvi;( t2uoxm no1alt mnctas srumurp;u4ale mo3iltfaDel(mp;t)arxrmf iytlateluvi s0 2xmiopnu1lme mncs (fsDtmx onu1tpeo i3iltfmDemu p t4texrircoadfm eliei s) rxrir iy1lp  lfvtasfsDtmurpot4aleo feildfmDra( s t0texoif3ootopD  i o s)tetmxo nu4am n iet () ruaum ou4ale mi3iyslmDulnmsnu4 ltnxrciydfaDelies t) etriopoydale  fci sf Draxro;u1oexn f3iytfs2rlnvs;u4tetnxf3oo1opteauei t)trurim3nu1amte ieias)s2rm(rp;t4opeoio3iatfs2eanvs (4 renxrcia1opteaueilt)teuoxm iudlm  mivsat  2taxrpot4oltniicildlm ea(mpn()treoif ootlat lu sls)setrir oodlptn ivslsf rtr(  ;o4aexn i3iadls2rl(mpnu4trxoio3tatla  lieil()texo(m oydol  lfcsa(  Dum(  no0olxoio3tadfa2emu o u4trenioctatfmte n i t srxoimpoo1amtnmfci (  rum(m no0aptn icils a umnvpnt4aexnxf tatfa rli i t0s2tmirpiudop  mici (faDrmumpnu4tpxo ietytlaDrmuvon()trtrioctydlmD  i s;(  rumir3io4alenmfctl() 2ur(mp;u4alx mfeiyd a2ulnmsn()aeeoxociadfatrliei;s0s2uoio3iudamtemfctlt) 2rau ooo1tlen i3iatla2emn p t4tlenio ootom eai s (  eur(rpnodopeelfvi tf ruaurpnt4aexoioetltlm eauvs;()aexrxo3oadfp  ln sl()srurxm3io1lpe lnciat)aDua(ro;o0aex mociasfmDem( pnu0 exomfcoatfatr neo;s)setoim3no1lptnmieilt)sDrmxrono1oex  f3tytfa2ulumpnt4arxnxfctodlpDe u il( srto(rpiydlpe  fvta(  rumu  no1tpxomfetltls ra(vpnu0treoif iadoaDr iei (  rxrio3no4lmtnmnciasfs2trurpnt0tetnioeiyt m rmnvs t4 rxoxo3oytoa  lieol(0 eur(mpoy1omtelivt t)aDumxr ot4olxoiietlsfa2rauvs;t)trtoxoctotlaD anvo s0 2tr(rpiodoptemfvsltf rrrxm ot1tlxniiciasfm2umuvo;u)teenir io1om  anvo t t2ur(opnu4lm  livil()s2taxr ;u4tlto fciysfa rlums;t)teeomocta1oaDe i ols0s2xoim3iu1am e icil()a2umu pou0oleomiciad mDrau s u)trxoiocio1lp   ies t) eto(o3io4am  mnesatfsrrrumoou1apx moeiadlaDumumo t) exoir oatlateau il(0trxo(m io1optemieiltfaDuau ont0oetnmoeias a ra( p;t4alxnmf ta1laD  ues t)seto(m oo4apeemnetls s2rrx pot1olxn fetytls ul(mo;u0tltnmfciodomDrliei t) eur(r3iy1amtn fcil( aDuaxr ;o1aet  o3tydfa2rlumo;u0 lermrcoo1lmDelneo s0seuo(opiudopee ivsatfs2ra( o;o1oeto o3iatlm2elu snu4 etoxo3iotfpt  uesls0trtrxmpou4omeemfcilt aDua(r no0apen ieiytfa rmuvs t0 etnxr oydfaDeaneols)seur(mpiudam emfesat)artmxrpot1ale  fetasfm2eaums;u4 lxomr to1la   u ol( t2uoim3nu4lm nlnci () rtmx ont4oexoioetydlmDuau on(4trxrmfcio1oa  anvs;t) euo(m3io4ll nlivi (fartrx  ou0aet if3ilt s eln o (4 reoir3iodopDelu s t0 etrxopiy1omee nvs t)artmumo;u1oexomocils m rmnmpnt4texoxrciadomD  ues s) rtmir3oo1alen fviasf Drau pnu0tpe if3ilsls2umnmo;t4artrif3iytlp elnvi;(0srxrxm nu1aleemiciltfsDumx  ;t0tlx iieiyt a2emumpnt0alenmfcootoa rauvo;(0s2toxmpiu1amtelivtatfartaurono1tpe  o3tatfmDeau pnu)aexnmocoytlmtran ol(  rtrxrpiydlm emnvtasf Draxmpoo4aet iiciad s2ulumo;u4 lermociatoa rlnei;s)trtmim3nudomeemieia()aDumxm ou4opxo fetyt m eau o;(0texoiocty1lpD lies;t0 2tm(mpnydlpeelnvsls)srrmx pnu1tetn ietlt m umuvo u4 eenmf oodlaDr ieo;t teto(m oy4lp elfvs t a2ta( ont4olx miciysfmDrmnmsnu4tetoifctodfa  auei s sruoir3iy4lm emfcslt) rra(  ;o1apxn ietad m umn pn(0trenxf iy1oatrluvi (0 rxoxrpoydamenmiesas)s2rmx p;o1apt  f3iyd a elump;() renmf tatom elivs t0s2xmio ou4omenlneiltf rtr(monu1tlxnmi3ilsla2elnvsnt4 rxnmo3oatfm rai o;t)sexmio oy1am elncsls) Dta(mpou4tpt miciltfa2emn s;u4 renio iatopte ieils s2xrxo3nodamt  nei tf rta( ont1tpxniociysfaDeluvs u4 rtrmf io1fa rauvi;() rxm(opnodape mict ()srrr(r ;u0tltniiciltlmDemnmp t4 lerxf3iadlpt ln o t)s2uoim3io1llt lfvsasf 2tmx poo1aptn ociatfs uaump;t0 lxoiocio1om rlnvols0teum(m3ny1al emiciat)s2rax pnt0aee  ietyt mDra(mo;t) eenmf oo1fatr ivil( srumio oydlmeelicil(faDtrxmo;u0tet iietltfa2umnvs t)trenmr io1oaD  uei;t0s2uoxm oo1al nmnei ()sDtaump;u0tltniocias m2rlums;t)aeeoxocoodfmt au o;( s2xrxo3iy1lle lnvsls) rtaxrpno1alx if3iysfa2rm(vs (4aexomr iodfatr u i t  rumim oodame lfvt ()srurx  oo0oetomoeiat a2uln o;u) ltrmr oa1om eli o;t)seumxr3ny1ap emnei s)arra(mp;o0openmieiltlsDra(vpnu)treoxo tytlm   nvo s0 2toio nu1ale mfcs t)s2rm(mpnt0tlxo fetlt s2rm(vo (0altrir3oatoptr ieils)tetmxo3nu4apenlnei s a2raur ot1ole iieilt sDemnmp;t4texrir tadlpDran o;t)teuoir oodom e iciat) Dur(mpou1apto i3iyd a2rm(vp ()alermo ia1lpt lu slt sexo(o3nydlpe mnvsa(  Dtm(rpnu4tleo fciytfa um(vo t)tlxoiocoytfm  au olt setmimpiudlp  mnviat a2urur nt0aeen o3iasfsDemn o;()trerifctatlmDrli sls)t2uo(r3iy1lltnlnvsls  rumum no4tetn i3tldfa raums;u0 rxrmf3iytlpDe uvs (0 etr(rpno1amtnmncia() ruax  ;o0optnif3tadls2eauvp u) lenif iytfp  au o s0 etrimpoy4lm nmncsat)srraxm nt1alxo fcildfa em( s;t)tltoxr oatlm eaieslt) rto(m3iudopenlfet s  2trurp;u4alt  i3tadfs2uanvon(0texnmocoytla ranes s0srxoxrpiudlm  mnesat) rur(  ;u1tpe iieiltla2ua(vonu4trtrxo io1opDe i ilt trto(o iodlle lfvtatfsrua(rpnt4alto feilsfm rmnmp;t0 leoif3todomte u ol(0s2to(opoy4ll emfet (  Duaxroou4tptomo3ildls2umnvs;u0arxrif iytfpDe nvs s0texr(rpiodopt lfcs s)sDtrxmont1tle moeiatfs2ranvs t0altoxf3tydoa eanvils teurxopoy4ap n iet (  rtrxr ;t1aexomi3tld mDrmn p;u0 exrir3iydlmDr u i s  rxr(m3oo1al e nct ()arururo;u1aleniociydfm emnvo;(4trenxrctadoaD  uvils0t2xo(opiy1ale miciltfsruru p;o4aleoio3ildlm2um(mo;(0 rtrxo3oatlaDelnvols) rtr(r3iudlle mivsas)aDrrxr nu1oleoiieiatls eau s u) renif iydfm ean s;t)sexmimpnu1amtemivsltfsDtrxrpou4oleomieiatls2umn p;t)aeeoxf iodoat auvi t setrxopoy4ap   fvta(f Duaxr ;u0apxoiiciydfs2ulnmo;u0teeomo3tatfaDrlnvolt)truo(mpoydam  mfcs tfs2tr( poo1altomictat m2umn p t)tleoxf3iotfpD au s;s trtoimpno4amee iciat)sDrmur ;o1aeen ictyslm rl(mp t0aeerif3tatlaDeaivsls0trxrxo nu1alee ictat s2umxr oo4apxoiociyslmDrmnvp;u4texnifctadfpt luei;() 2xrxr3oudll nlicsas arrmurooo4apen feiltlsDea( p;()trtomr3oadfm eli il()t2umiopoy4llenlics t)s2ur(rpnt0aee mo3tltfs2uan o (4tlxrmo iadfp eauvil()t2xrxo3io4om   fcsas srrm(ronu4tpto f3tltlm2elumont0arenmf3ta1fateluvsls0 rtrxr3iy1alenlfes (farur(r ;t0aptnmoeildla2rm( o (4aeenmrciytlmteliesl( srtoxm nydalt lfetlt)s2ta(rono1tet iieiyt m rln pnu)tlerifcoo1opteluvs (0sexrxopoydlmenmfcsl( arrmum nu0tle  fetytfs2ranmpnu)aeenxf3ia1lm  aues t) eurio3iudlm  lfvt (f Dtru  nu4teen ociyslm elu p u4aleoxr3oy1omDeanvo ( texmxo ny4lmtemicias)aDrau pnu1tle if3taslm emn ont0arermr3tydom r nvols)t2xmim iu1lpt  ics s)s2rmxmp;u4oexoiiciadlmDrlu s t0arerxr3todfp elueo ( trtmxrpoodll  livilsf Dtau  nt0tleomociltls emu o;t) rtnir oo1lm raies;t0 rtoxopno4apen ivsa( sDraxmo;u4alxnmociat a ulu p;t)texnxociy1lmte i s;(0 rtoiopnudoltnlfcia(  2umx pno0aetoio3iat m ua(vsnu4tlxnif oatfaDr n slt) 2toim nu1al elicsl( sDuaurpnt0oeen o3tldlm2el(vpnu)altrif3ia1fm rlu ils)t2xm(o nu1ole lneiasfsDtmur nt0tlt if3tldfs2el( s (0 reomo ty1faDr uvil(0 2trxo3nodoltn neiat artmu  nu0optn feiytfs uau o (0alenio oydlp  li slt) etrxr ny4al  lnesas artm(mpno1tpxo o3ildlm uluvp u) leomr iodlpD  uei;t)teurxo ou4ole  fvias arra(moot4alen o3tltlmDuanvp;() ltnxf ootlm   n slt0setoiopiy1alte iei tfsrtaxmpoo4aetoifetydfsDumu p t4 etrif3oydoatrlues;s t2to(rpoy4olen ncsat a2trx oou1aexoii3tydfa2umu o;u)trenir3iydoptrai o t s2xo(o3oodlltemnei ()s2ra(mo;t4alxn ieiysla2rlumsnt4 lerxo io1fp r ueslt  2xo(m ou4am emici (f Dta(roou4alx iiciltfs2rmu pnt)aexomo3oydfatr nvilt)s2xr(m3iudale livt (  Durx poo0aeen feiaslmDua(mpnt4 rxrifciodlptraivs;(0texr(m3iydlpeemnvi sfsDum(root4tpenmfciydls umu s t0areomf3iodlm r uei (0srxrxm nu4ope  iciltf 2trumpoo4tlxnif3ilsfaDulnvpn()teerif3oatfm raies;s) 2uo(mpno1lp e ivia(f 2taxmp;t1apx ifciys aDuanmpnu0arxrir iadlmtr uesl( t2urxm oy4lm elnctl(f Dtmxrpot1aleomf3iydfaDean s (4trenmfcoa1fatrln olt)truoimpny1ap elneias)s2urx poo0ope io3ias aDelnmp t0artrir oatoaDrli i;s0t2urirpiydale  fetas) Drmurp;u0tpeo f3ilsfaDrlums (0aleomfcio1fpDranvs t0srurxr3oy4omtn iesl()aDrrx ont0optoio3iltfm2uanvo;(0trtoxr3iy1faD luvilt seuoxr oo4al e ieta(fsrrm(rooo0tpxnmfctysfa rm( s;t)aeeomo todfmD luvo s teumimpou1ale  ies tf Dtmur ot4aexoifctlsfa emn ont4 ltoxr3oo1lmt livol(0trtm(opno4amtemnvsat s2tmumono0tetn ieiydfm ra( p t4tltomf3oy1fp eluvo;s0seurxo iy1optemietl( artru  ;o1optnii3tys s em(vo;t4tetnxfcoa1lmtelu ol() 2um(m3ou1amen nei t aDtaxm no1teeo o3ilt s2uan p;t0alenif iydlm eli il(0 2umxo oy1amt mfvil(fa2uax  nu4aleomfctysls2rln pn(0 ltrmo oydlm   i i s)srtmio nu4lptelnei t) 2uaxrp;u1olxomo3iatfa2ul( on(0trxomo3oo1la rlnvi t  2xmxo3nodope lietas s2um(rono1tlx mictlsfmDea(mp u4artoir oydfptrlnvol(0seto(m iy1al emivt (  Dua(r ou0opxnmoetytfm2rln p;u4altrmfciatfmD li s t) etm(rpnudoptn neias s2uaxm nt4opxnioeiasfm2rmn o;(4arenxo3iadfmDeliei t)srurio3no1amtnlietlt)srrmxr nu1olxnio3tldfmDua(mp u4 eeomr io1lmteaivil(0 exrxm iu1amtnlivi t)aDraxmo;u4altniieiydla2uaums u4aexrmo3iydfat  neil( sexr(m3iydaltn fvsltf 2raumpnt4alt mo3taslaDranms;t)tlxrxrctadomteauvsls seurxo ny1op  mfcil( arumxmoot1tlxnmi3iadla eanvon()aexnxr oo1lat auei;()tetoxmpou1alte netas) Durumo;o0tpxn ieild mDua(mo;t4texnio iydfatraivi;t0 rtmim nu1aleelfct sfsDum(rpnt1tptoifeilt a ean snu)trtrxo iatlpD  ieo;s0 2uriopnydal nmfvs s)srua(rpou4oltn i3tlt mDeanvs t4 ltnmfctytomteaueslt teuoir no4al  mfesl()artmx  nu0aeeomfciatfm2emuvp ()tetomr3iatoaD livslt s2urxm3iodal n feil(farrrxrpou1aleoiociltfs uluvsnu)tleomf3oydlm  ai slt trxrir nu1lmen fci ()a2ur(rpnu4tex ifctat a2ea(vo;(4altrifcty1opD ln i;()texm(o3iodom emneslt)s2rrxm ;u0oee  ictld a rmu on()tlerir iydlp rlues t) rxmxopou1lptnmfcilsf rurxmp;u1tpxn octadfmDemums;t4 rtnirctodlmteai o;s0sexrirpou4opeemfvs () rraxmpnt4alxo i3iyt s2ea(vp;t0 leoif iodoat  uvi;()sexo(o no4ll n ncsls) rur(  nt1tetomoeias a ranvpnt)tetnxrcoodomtelueil(0trtr(r3ny1altelicia(  rtmx onu4apenmoctadfm elnvs u0 rtrmfcoo1oaD  i o;s0sexmxo3oo1lmte iet t artax pno4olx miciytfm2ea(vo (0trenir ta1om raueo;(  exrirpou4am e fvs s)srta(ro;t0tltnmfeiysfs2eau p t)areoirctatlp eluesls  2tmimpoy4ll   nvtasfaDur(rpnt1tet  f3ilsfs uanvpnt0 exoxf ta1laD auvi s s2xoxopnydol emfcs (fsDuau  ;t0teto o3ilsfs umu o t4aeeomo3iodfpDeaieils) rtoim3oydaltnmnct (  Durump;t0tpe ioeilsfmDul(mo (0artnxociotfa   i o t t2to(o ny1omtn ncsat)sDuru  nt1openiictyslm rl(vp u0areomr iotla r n s;s t2tr(mpoydlltnlfvsasf Drrumonu1opxo feiasfs raums u0areomr iydlp raues;(0t2toir3ny4lmenmivsa(faDrau  nt1aptomi3tad mDemnmpn(0arxniocoa1la  lnvilt srumimpou1opt lfeta(f 2tru  ;o0oetoiieiatlmDranvp u0aetnir3iydfptelueilt t2xo(o iy1opeemnvta(fartmx o;u4olxo icilsfmDumn pnt) eerxf oytfmt  ivslt teur(mpny1al emfcsas  Dur(mpnu4tlx iociatfs2rm( s;(4 etrmf3iotfpDrlu ilt0 exrxrpnydal e fetls)sruaum oo4olxn fetatfa2eluvs u0areomr3tatlaDrlieo s  exoio iy1ope lnvt ( aDuax  ot4oeto ietadfs ul(mo;(4tleriocoodfatrlieilt)trxrxm3nodalee fvtlsfa2rmx o;u0aet  o3ild s2ea(mp t4alxnirciytfmteaivi;t t2ur(m oo1om emict s) rrmxrp;u0altomf3tlt s el(von(4 rxnirctytfpteau s t0srtmio no4al e fci s)s2urxrpou4opeomiciadfm2rmn s (4 etrxrciotfat lueolt)s2xoir ny1omt lfesat srururo;u4oeeoioctlsls elnvp;()texnio3ty1fp  auei t0 eumxopio1lp e fciat)sDtax  nt0tpeo o3iadfa rlnmsnu4altrxr oy1fmDeln o ( sruo(r oydalen ieia() 2tm(m ;t1aee mietadla2um(mp () rxoxr to1op eai ols  etmxo nu4ll nlivs t) Drrxrp;t4aex  ieilsfs2rlnmo t)aexoif3oo1lm eli ols0setrxm io1amte ncil()sruaxmoou1ale mfeildfaDean pn(4trtrmfcoodfm   uei () euoirpiu1ll  mfvt tf 2taxm nt1oeto iciyslm2ea(vsn() etoir3io1laD li i s)truo(rpoydolt mncilt aDur( ooo4oex if3iadla raums;t) leoir3tytlpDrai i;( trxriopoydapenmivilsf rtax  ou0apxnii3tadls2ulumo;(4 etrmf ta1omDe ivo;t s2xmir no1lptn feiat)artax o;u1tlt  i3tldfaDua(monu4arerircia1oateaueo;(0 2tm(mpoudal e icilt)aDrau o;o4aet mi3iytlm2ulumon(0aexomf3oadfpDeaneo (  2trxrpny1om  mietat)arrrumpnu4apx ifctadlmDrl(mo;t0 lxnif3oytlm rai i s0srtmxr3iu4lm e neslsf rua( onu0opt moeiadfm2em(mont4 leoif oo1fpD  ies;t  2xr(r iydop  liet ( sDta(ro;u1tlen ociad mDulnvs;u0tltnir ia1oaD livo s0trur(r3nudoleelfesl()aDumurp;o4aeeoif3ils aDumu pnt)teeoir oydoaDraues;t trurxo3io4lle  fcs (fsrrmurono4tet mf3tydla2umu p;t4texnir3oydfpDeln o;s)srumir3no1llt lfctls a2rrx onu4tlt ioetaslaDuan o t0aexrir3todlm  aivi;(0sruoim3io1oltnlfvt ()s2rau  ou1aeto fctasfs rmuvp;(4tetnifciydop  ai i;t  exr(mpiodap e netlt aDtax pno4aptn oetas aDua( s u0aexrmo3ia1lm eln i s)t2toim oydol e neia( sDumxrpnu1olen iciatlaDrmu snu0 eenifctadfa raneolt)t2toir3iydlm   fvia(fs2uauro;o1apxo oeiadls2ul(ms;u0 rerxociy1fpt au s;s) 2xoim3io1lmtelneta(fsruaumo;u1texoiiciysfs elums;() rtnio3oadfat aivo t0 2urimpoo4lmenmict tfa2trur ;u4tpx mieilt aDrmn p t0alerxocoadfaDeluvsls  rurio ny4omee neilsf rrru ono0optn ieiasfsDemumo (0alxrir iotop r ueo;t0teuoir oy1altelnvilt)srumur nu4apeo i3tld s um(mo;(0 leoxrciatomtranvo s)seum(m oo1alt livi (  Duaxr no0aexnmi3ias m em(mpn(0 rxoxo tydom  livs (0t2xoim iodoltn feslsf 2uau ono1altn o3tyt mDrmn pnt)tltniocootlp elneil(  exmir iodom   nes tfartau pot1aleo ociltfa rlnvs;t0tetoxociatfmDrauei t) 2trim oo4ap nmivil()a2taxr ou1tpt micilsfmDua(vpnu0alxnxo iydopD  u i;s trurirpoo1op elncsls  Drm(  nu1tpe moctltfa2rauvsn(0tltrmocoytlmDeln i;s texoxmpoo4omeelietlsf 2ta(r nu0tpen oeiltls ulu snt4 eerir3oydop  au i;s  rtm(o3oy1lme mfcs sfa2rmu pnu0tpto feiatlaDrmnvonu) eeoxo3oydopt luvslt)t2toxo oy1altn fvtls)artaxrooo1aee if3iasfmDrlnvsnt0tleoxf3oadfmDeanei;t0 euoxm3iu1om   ivsltfsrurxm nu0apeo ieiyslsDranms (4tlxrmr oodlpt anei;s0s2tr(mpiu1lmtemivslsfaDum( o;u4alxn feiad s2rau ont4arerxocoadlpDr nes;s)s2uoiopoo4altelfeia() Dtru ono4oltniieiyt s rl( s;t4 exnir3tytoaD lues;t0 2xm(r nudlme mfei t srua(ro;t4tpe  o3iytfm2rm(vo;(0aeenxr ootla   neilt teumir3io4lpt  fct tfs2um( pot4olx mietydfa2em(vs t0aexomf3iatlaD an o;s trumim no1amee ici sfsDtru ooo0tetomoeild s elumont0texoir3ootfpt aivs;s)srtoio no1lmeemnvt s)a2ta(rpou1alenmfeiys s2ulnmsnt4aetoxr oo1fp r ieo;s0 2toxm3iu1amt lncs s)arraxrp;t0tetn icias aDeln o;() eerxo3oa1lp eli s (0srtmim nudale mivi s) Drrumoot4tpxoif3ias s2ea(vpnt0 exoif3tydfpDeai s;s) etrxm3oudlpeemfcslt  Dtrum nu4oeen ieiytlm rm(mon(4trenxf iodoptrlies t) ruoxr3nu4alen fvi s  Dta(mo;u0tlxnmi3iysfa2eluvp;u) rtrmo3ta1oaDe nvo;( trxo(o3oudopenmfvilt  rta(r ;u1optnmfeiatfm2ul( s;u0 renxr3iadfaDeli i;t)truoxr iu4ale lnvta()sruaumpno1teeoio3iatls ea(mpnu0arenxf oatfatraies;s) 2xmiopnydomeelietasfsDtrxm ;u4oeeomiciaslaDea( s;(0arenxf oodomD auvil() exoxm ny4ll n ncia( sDtaumo;u4opxo i3tltls2ulnvo;t4tlxoxr3oy1oa elu o;(  etoxm ou4lpe lfesl()a2uru  ;u4tpenmf3tld sDem( pn()arenifcoydlmte i i t)srxrirpou4ale lnctls) 2um( pno0ole mf3iasla2eln pnu0 ltrxrcto1fmD aieslt setmxo3iudapenmicsasf rrax  ;u0ole  o3tys mDrl( s u)aeeomo iy1omt aieo ()s2tm(r3nudlm e nesa(fs2umu ont0tet ioetldfs um(ms;(0teeoxf3iadfp ran o;( t2xmio iy4lptemivtls)a2tm(mp;u1tlto ieiytfa ean o u)arerifcoytlm elnes (0trxrimpnudlp emfci s a2ua(mpoo1teto fciltlmDulump;u4 lxrmf3oa1op   nvo t0t2xmirpoy1al n iesl(  rraxronu4tpeo ocildlaDea(vp t4 lxoif3iatlptean o;s sexr(r3nu1lptn nes s  2rru  oo1tlen ociysls2uanvs;u0altoxf oytfp e u s;s)teum(m3ny4lmenmnvtlt srurx p;t1tlenioeiydfs2uluvsn(0tetnxo3ootoaDe uvo s0srurxr iydlmeeliciat) Draurp;t0oex mocilslm2umumon(4aetoxf ty1opDeaivi;() 2umio3nodoltnlnci s)a2umum no0apenmietatls2emnmpn(4 lxrir3oytla  auvi ( tetrir oy4al nlnvtl() rtr( pnu4tptoifetasfa uanvp t)treoiocio1omD auvo;( s2xoio3iodolen nvt (f 2uaumpoo4tex iocildls2ra( pnu) rtoir oo1fatr n ol(0 etoxm3iydlle mneilsfsDraur ;o0tlxo i3tatls emuvonu4trtrif tatopDe ueo t)srurxopnu4ol nliesat  Dtaxmpnu4ole  o3tltlm rlnvs;u0alxrio3ty1fatran i t trxm(r3nodlmenlics tfs2umu ono4oltnifetltfmDranmp u4alxomoctodlpteaivols texo(m3oodlp  lnvs (faDtaxrpnt4tle  f3ildfs ra(vp t0 eeoircoa1omteluvilt seumxm oydam n ivi t artru p;o1aee  iciydlm2eaumsnu) ltnmrcootla eluesls0teto(m nydlmtnlfctatf Dumu poo0oexnii3tas aDul( s u) etnifcoydlpt lieilt tetmiopoodamtnlfeta() Draur nt0olen o3tatfa2emumsnu0aetrmf io1fpteanvolt0srtoirpoo1lp n fcsas)aDtrx p;u4aetoiictlt mDumuvo u)trtnircoadop  ln o (0s2xr(r iy1amenlnvt s aDum( oou1aeen ieilsls2emu s (0teeoxfcoo1oateaivslt trxm(opno1llee fesa() rurxmpnu0tex  o3iltlsDea(msnt4areomrctytopt lneolt  2trio3no4altnmics ( sDrrxmpot4ope mo3ildfsDua( s (4trtnmrcoa1opteai s;t0 rtr(mpio4amtn ncslt)aDrr(rooo1aleoiieildlaDrlnmo;(0alenif iytopt livi;(0 etrio3oodolt  fcil(fa2tau onu4tlxoiicildfs rln s;u)teeoxfctodoatrlieolt0t2toimpoy1omeemiesl(  rtm(m nu4opxomfctyslm rmn p t)aeerxocoytfp e ieo;t0trxmxmpnu1lmt liesl(fs2tr(m no1aetomietadlmDrlnvont)artnxo3tydlp  auvi t) exo(m io1ame mfvt ()s2tr(r ;u1oetomfcilslaDran ont0altrxfctodoa eai i t0t2to(o iudale  fcta(f Dta(rono1tlto oeiytla2rmnvonu) lxnifciodla   ieils)t2tm(m3iodlle lnciatfs2ta(m ;t4tpt ifcias m rl(vsn(0 ltrxf oy1oa  livo;t)s2tm(rpny4lp   neiltfaDurx oot4tltn f3iasla emuvo t4 lxnmr3oodlatr ivo;s0srxo(mpnu1lp n fcsl( sDrm(mooo1tpxnifctadlmDeanmo t0aexoxociadfateauvols) rurirpnu4ol  mfviasfsDta(rooo0apenmieiatlsDum( pnt)aeeomf3oadoat  n i;( s2uo(r ny4altn ivta(fsrtax o;o4alto o3iysls2rmuvon() lenmrciotlmt  i i;s seuo(opoo4ome liesasfsrur(  nu0tet mf3iatfm ranvsnu4arermf oo1lpD ai s;s) exmimpiy4al  livias) Drmuront1tlxnioctld m rm(vo;(4tlxnxo3iydfmD  n ol( trumxm oo1llt lietls)s2tmxmp;t1oetoifcilsfm2um(mp;u0altrxrcoatlm eluvs t srtm(m nu4olen fcs tf rtmur no0tpeomo3tls a umu s;u0 ltoifctotfpDelu s t seto(rpiydlm  lnci tfarumumo;u1tex  iciasla ra(ms () renif todfpD lu slt)s2uoxo3nu1alen ivsat)arumxrpou1tpeniiciys aDelums;t)trxoxrctatfaDeliei;(0 etmimpoodlleemfvi tfsrrax oou1tpx  ociadfa eln s (4 lenmr3io1fat aues;t  2toim oudamtemfvt ()srtaurpnt0ole  o3iysls2elu on(4 eeoxr3ootoptrlu olt)trto(o ny1lmtnmfetl(  rum( pou0texoiociltla rlumo t)tetnmf3oatlat  i i s  2xoio nu1oleemivias  2raumpnt0openii3tadfa rl( sn(4 ltnmo to1oaDeaivo;t) 2uo(m oy4ope  ivia( a2uauroou0texoioetyd m eauvpnt0trxnmo3oadlat lnvo ( t2urim iodome  fcsas)aDtm(  ou1apxo fetadfsDeanvs (0trermr3iotfptrlivilt)setmxm iodamenmnetlsfsDta(rp;t1teenmoeilt a2em(mon(0arxoif tytlmt au sls s2xmxo no1open fcil() 2trxm nu4openifeiytfaDem(vsn() rxnmr tadlateln sls sexrxm iu4olenmivs t  2tmx  ot4tetoif3tyd a2ulnvpn(4 etriociodlp eluvi;s0 euoxo oo1op  mivtl(fa2taxr oo0olt mfciatlmDrmuvpnu4tltomo3tadla r i o ( s2um(m3ny1optemfct t a2taxm ;o0tpt ioctas aDelnmo;t4tetoircoatopDr i s;s0srxo(opoy4op nmnvt tf Dumx  ;o0tptomieiyd a ul( o;t0 rxomf3ty1la r uvs;s0srurxm iodomtnlneia(f rtrxmpnu0tleomfciytfmDumn o u4aeenmfciadfa eluvs (0 exr(m3iudapt  fet tfaDtmxm oo4olx ifcildlaDuauvp (0aexrmfciodlp eauvolt) etrimpnudlp n fvi t s2umu pou4apeniietlsfs2ulums;u0arenir3ta1la r nvi t)trtr(r3nydoptelieta(fsDtaxmp;o4oet  o3ild m2ulumo;t0alxnio3io1fp rluvils0trtrxm3iudap  mfeilsf Duax  ;u4tle  ictyt m2eln snt) exnio iy1lp ranvi s setm(mpoy4al nlfvslsfs2ua(ro;u4olxoii3iysfsDeau pnt0artrxf3iy1fm r ivsl( t2tmimpoy1opt mncs tfs2urx ooo0olx  oeiltls2rm( p u)arxnifcoydfa rliei t tetrirpny4olee nvia(  Dtrxmono1ope  octatfa2ulumont0 eermoctytfp rluvs;( tetrxo3oo4lme lnvtl()srrr(r nt0altomfeiatls2ul( s;u4 leoxr3ia1la r ivol(  rxr(r3oudap nmfeil( arrr( o;o4teeniieiytfa uau o t) exomf3tatlmteauvs;(0srxriopiu1amtn iet t srta(mpno4oeto f3tls s2elums;u4 exoxo iydla e i slt  rxm(r ny4alee fci sfaDtr(m ou1aeeomfeilsfa2emnvo;u4texnir3oydlm raneols) rurim3ny4ale mieta( aDrmxm ou0aeeomi3iatla rauvp u)alerircoa1laDr uvo;( s2tmxr3iu1lmen nvtls)srtmx o;u1apt ifcilsfs2emn pn(4teerir iotfp   i s s)trtr(r3iodlmt  nei t  2tr(  no0apxn feiad m2em( o (0 exrxrcio1fpDe neo s) 2xo(r3nu1om nlnvt sf 2tax  nt1tptnmocilt s eanmp;t4alxnxociodfmDr uei;( trtmxopoy1llenmfcias) 2tr(r ;o0olxniociyd m umn o;(0tlxrmr3totoatrln s t)seuoimpoo4ole lfcsat s2tr(  ;o4oeeomfetytls2emnvo;() exnxo iy1la  li i (0srxm(o3nodllte iet t)srrrum oo1olxoifctydlsDulums u)artrif ootlm  luvs t  2xrio oodol elies sfsDtmxmp;o4oltnmiciat sDrm(monu0alermoctodoa eanei s)t2tr(m3iy1omeemivi t) 2rauro;u1opt  o3ild s2el(msnt4aexnxr tytlateaivol(  eur(mpoy1lpe livs t sDra(rp;t1tetn oeild mDrm( o t4teerxf iodomteauvo;t0texrio3nodomtnliviat  Dtaxr ;u0tpeomfciltfaDranmsnt)artomr3oatopDe uvs;s0 2toxm oo1om nlivilt)arumur ot4altnifciatlm2elnmo;() exnxr3ta1omDe i sls) eum(rpou1opt mnctlt srtmxroou0oleo feiasfs2el( pnt)alxnmrciadlaDe i s t)trxriopno4lltelfcs tf Dta( o;o1open oeild mDeauvp u)arxniocta1fp eanvo t)seuo(rpoo1alt lnvsat)s2rrxr ;u0tlxomoetadls umumo;(0trerif oadoatrai o t)s2umiopoy1llte nei (fs2urur ot4aeto f3ilslm uanmont0tetnio iodop e ieilt  exoxm no1lm elivslt s2umu p;t0tpt mfetlsfa rm(ms;(4artomf iy1op  anvi s t2uoxr ou1ol emiesas  Dum(mooo0altoif3iatlm emu s;(4tetrir oydop rai o;(0teur(mpou1optelici tfa2ra(mpot0opxnmfeiys sDum(ms t4 eeomfciodlate nes;s  2ur(mpou4om n ieia()srrax pnu4tpx  ictaslmDemn p;()alxrirctydfm raies t trxm(rpno4om n fesl(fa2ur( pnu1tlto fcild m2ea(vo;t4artrxo tatomtrln o;t)teuoxm3ou1lp nmfvt (  Drm( oot1aet mfciat m2ua(mo u4teeomo oydlmt lu s;s0trurxr oo1llen ieilsfsrurur ;t4aetnio3tlslm2eln o u)tlxrmo3todfmDe n s;s)tetmimpoudolenmicslt)a2raur ou4aptnioeild s rmuvs t) lerif3iadom r nvi;( tetoiopoo4lmee nvi t  Dtm(rpou4ale  oeilt sDulumo t4trtomf tadfmD ai o;s)t2trxo3iodol  lfet ( aDumxrp;t1olto f3ilt m rm( s u4 lenxrctatlmt aies;( s2tm(o3iodalt livtat  rta(rooo0teto o3iys m rlnvo;u4aeermo iatopDe neolt s2xo(o oy4lpt lics t)a2rr(ro;o1tpx mfeiat a2umump t) etnmo3iatom  aivilt trum(opnudalt  fetat sDum(m no4apxoii3tyt aDumnmo;(4trxomfcoadfmtrai i s0trxm(rpiu4aleelictls s2rmxmp;t4opeomiciytlm2eanvp t)trtomo3oydlmtr n i t0srxrxm3no1ap  lfvtatf rtmu p;u0oee  ietatla ul(ms;(0aeerio tadfm eaues t) 2xo(r oy4aleelfesatf rra(ro;t4texnif3iydfaDeau pn(0 lxomf iodfmD luvo;t) rxoiopoo4omtemncta( aDtrx o;t0optnmoeiasls2umnvs ()trxoxf3io1omtrln i;t sexr(opiydoptnmncta() 2rmur nt1olenio3iyd mDea(ms;u4aeerir3ia1optr u o;()t2triopoy4ol  mneil(  rrr(m no0oltnmoetls m rmu p;u0trtrio3ia1lm   uvol(0t2xr(mpnydlm e ics tfarrmu o;o4olxoifciat m2umuvonu4tlenxrciodopte i ols0t2to(r iu4ame  nctl(  rumxr oo1apxniiciytlaDul(mont)trtoxr3oytfp  auesl(  rxo(m ny4ll nlivt s)s2ra(mp;t4opxn feilsfs2rau ont0trxrmfctydomtraueils0s2xoxrpnu4lm  miei s s2umu pnt4aex mf3tls s em(vo;u4 ltnxf oa1fp e nvi () rtoiopnu4lmte nesl(f rtmuro;u1alt  ietatls2em(vpn(4tetnxr3to1fptrauvo (0sexmio3io1opt  nei tfsDtaxr nt0olt  oeiys s2rm( pnu0tlxomr tydfmDelnvs (0 2tr(rpny4om nmfeiltfs2tr(  oo4tet ifetyslm raumo () etrmr3io1fa rlu il( tetm(m iy1amt  fvilt)s2tmu oou4ope  oetlt a2eln s u0 rtoxr3oadoat lnesls truoxopny1lm e nvslt a2tmxmpot1oexo ocilt m ra(vs;u0aexnmo3oytfm ran s t0srur(r3oudll  lfcta()aDrmu  oo4oee  f3iytfa uanvo;t)teeoxrctytoptelieo t t2xo(m oo4am nlnci s s2rrxm ;u0apenioctatfa rln o (0 eenxf ta1opD  nvols) rto(m oo1ome  fes ( s2trxm ;u4oleoiiciadls uanvo;t0treomr3iy1laDean o t0sruoimpnu4ope lnvsat) Dumump;u4olxoioeild mDranvp;u) rtnxf3io1oa  lnvi;s0 exoxopoo4lme licsls)sDua(rpnu0apx mfciytla emnmp u)tlxrxrciatfpte neilt0texoxm iudlp   icil()aDumx ooo0tlt  ieild aDrlumpnt) ltnmo3iatomtrlies;(  rurxr oodolt  nvslt s2uaur ;u1tpe moetltfsDumu o;t0texrmf ty1lp rlnes t  2umio ou4lmtnmfvtlt  2ur(m ;o0tex  ociatlaDrau p t) rxnmfcoytoaD  uei s0 2toxrpnydalt lieiat)srraur nt0oleo feiltfa rlnvpn(0tlxrmocoadlat  uvils0seuoio3ny1lpeelfvtl(  ruaxmo;o0aleo iciltlmDranvs;t4 exoir3oo1opDeauvs;t0 exrim3nydale  fei (fs2rax  oo0oexoifciyt sDemnms u4artrxrctadfat  n ils) 2xo(rpoudom  lfviatf Dtmuront1teeoiicias mDumnms (4treoio tadoptrauvo t texrio3nu1amtnmfetls)aDra(rp;u0apt  i3iyslm rmn s u4teerxocoydlmtelu s;t0srur(opnudapt lietatf rrrxr ;u4optoif3ias s2umuvo (4teeoxr3iy1laD anvo ()t2xmxrpiu1ll elivtl(fsDra(ronu1opx mfeiyd aDum(vs;t)tetoio3oa1oatran o t s2xoirpny4amen fctas  rraxmpnu4openmf3iadla2eluvp t4altrmr3ty1late u o;s)s2uo(r oy1omtn fvt s s2tm(mo;t0tpxo o3iasla2eaums;(0tltnmf3tytfpDelu sl(0 2trir3no1ap  lfvsl(f 2tauroou4olxnioeiat m2emn s (4 lxrir iotlmDr nvs t)t2tr(mpoodolte nctl(  Drmur ou0tpxomo3iys m2um( o t)aeerxf3ty1omDean slt trxmxo3no1omt mfet t a2rrxro;o4oeeoioctydls ranmo ()tlxnmociadfpte n o;s) 2xm(mpiudlltelivil(f Dum( o;u4opeo oetlsfmDem( o;t4arxnir3iytopt  uvo;s) exmirpnu4oleelieslt)arum(mp;o1tpx  fcildfs umnmsn(0 rtnxf io1fm  luvslt)trtoxrpiy1om nlfesasfsrrr( o;o4apxn fctlslsDrm(mp t0 lermf iodlpte uei (  exoxo3nydap nmncs s srum(ronu4optomo3iysla ra(msnt)alxnxr3iytoaDraueo t0 rumiopoo4am e nct s) Durxroou4oeen i3iyd a2uluvpn(0trxoxfciy1omDeauei t)texmxopio1ol  licil()artmx  ;t1alx ii3ildfmDuan o;u4altomr iodla  anvslt)trxm(r iodllt  ncil() rtau  oo0oet  f3ils s rmumont0arerxf iotfa rli i t0 2xoxo ou1ap  lncils srua(m nt0opxomfcilt s rlnms;t0tltrmf3oadlp rliei;t0seurxm3nu4olenmfvsatfaDrrxroot0altnmoetlslmDrmumpnt0arerxo3to1fat aieil(0 2xoxm ou4oltemnei s)sDrm(r nu1aptnmo3iadlmDranmsnu)tlerir oa1latrai i;( texr(m oy1lm emivtatf Dtm( o;t1tetnioetasfm2rln pn(0alxrmr iytoaDr u o;t teumxrpoudaltnmnci t)aDua(m oo1optomoeiyt m2rmn pn()arxrxf3iodlp e n s;(  2urio oo4open fvi ( sDraxro;o1olxomo3iat sDumnvsnu)tlenmo io1oatrlnvol(0s2uo(o3oydamtn nvsat aDuauro;o1apx  ieiadla2umu p t) etrmr iy1om eauvs;(0t2toxrpnu4oltemietlsfartaxmoot0tpen ietlsfs rl( s;u4 eerio ia1lm rluvsls trxoxo3oy4altnlieta( arurxm ou4oee  i3tyt m2eluvo;(0alenmr3tydlp rlieo;s)t2toio3iy1lle mncta()srurxr ot4oexnifeiys m2ul(vs (4aeenxrcootoaDeai o;()teuoxm3ny4am emfei t)s2rru  oo1tpto fetyd sDrl(vs (0tetomoctatfateluvs t)seumxm3oy1lptnlfeias srrrxmo;u4ope mfctlsls eanms;t0aetrmr3iatomDe ies t)t2to(m io1olt mnvias  Dua(r ;o0ope mfctlsfs2umu o ()altrioctotlmD au olt0srumxr nodom n fei s  Drmum nu0oeto ieilsfs2emn o;(0 lxrmr3iodoptrau i t  rxm(m nu4opee nesas arrmurono4opeomfciatlmDrmu snt)alerxo oo1latr n sl()t2umimpiudomt  iesl(fsrra( p;o1aleoioetad mDea( o t0 lxrmr3to1omDeau o;t0 2tr(r oydome  fvsa( s2uaxmpnt4oleniieilsfa2ul( pnt)arenmoctatlp rlu i;(0setmxr iodom  lfvsl()sDurxm no0alxnmo3ias mDeauvsn(0 ltnio iatlm  aneils)s2um(m ou1ome lici t aDtmu  oo0tetoio3iadfs uaumpn(4tltoif3oodlmD ai slt t2trir iudoltemnvs s arraxmonu4aet mietyd a emnvsnu0 rtoxoctodlpDe uesls)s2tr(o3iudal  mnci (  2rmu poo4oexnmfciytlm2elumo;u0aeermr3iotfa elu s ()teurxmpnu4om  livtas)sDuax pnu0texniietltlm2elu s (4 exrxo oo1opt lu sl(0s2umio oy1omtnmfetas  rrrx pno4aex iociad m ulu p;u4tetoxocio1fatr ieo () rtrirpnydam  mnciatfaDumxrpou0oex if3iyd a2emu p (4arenif3ta1oaDeln i;( t2um(o3nu1ol   fvsa()srrr( o;o0opt iietltfs emumsn(4arenio tytfm   ueslt0trtmir3iu1opt lfcia(faDrau p;t4olx iocias s rm( s;(4trerxf3oatfptrli o t0trxr(r iydol  lnvsltf Duaum ;u4tee  f3ils a umuvo u)areoxocoa1opDr u s (0 2toir3nodom emfvtasfa2rmump;o0oltn fciat s eanvonu) etrxfcoo1fmt livi;s s2tr(opny1lm  mneils sDur(  ot0tltnmi3ias a2rm(vo u4tleoio3ootfmt  nvo (  2uoxm3nu4op e ivs s aDtaumont1alxoiieiyd a2uau snt0 rtrifcto1oa e nei s0t2uoiopiy4lp elfes s)sDtru  nt1aet  o3iydfa2ua(vo u)artoxf iytfm r n olt0tetrir oydopenlivta()s2tau  no4apeoio3iydla2uauvo t) rtnxfcoodfaDranesl( sexoim3no1olenmnci s  2raxmo;u4tle ifetldls umuvsnu) rtomr3ootlmt aieslt)sexmim3iodap  mnvil(fa2rmu ooo0tex miciatlaDea(vs (4tlermf ty1om r ies ()truoxmpnodaptelics ( s2ur(root0aet iiciysfs rlu p u0aeeomo3oo1lm r u il(0t2to(opiydope lnesl(f rtaxrp;o1tle  octyd m ra(ms;u)teerxocoo1lm  li il(  euo(m iu1am  mfvtlsf 2ta(  nt0oetn ociysfa uanvs (0 lxrxr3oatlatean o;()tetm(r oo4omtnlfet t  2umump;o4tetoifeiydfs2ranvo u0altrxo ty1lmDeli i;(0seumir3ou4olt  feias a2umumont1oeto iciys mDeanvo;u) lenmfctydfpD  nvol(0s2tr(r3iy4ape lneias aruaum oo4apx ioeiyd s2um(vs;() etrio3tytomtr nvi;s truoio3io1op nmici ()aDtaxronu4opt micilsfa umu o (0artrmrcoatlp r nvs;()t2tmio iy1apee ict (  Dur(m ot0alxn oeiltfsDeau o u4aeenmo iatlpD anvslt t2urimpny4om nlnctas)srtr(rpot4tptomieildfm rl(vp t)alxnxr3iodfm e i slt0 etm(m3oy1lpenmiet t sDrr(mpot4apxnmicilt mDumuvpnu)aexoxf tytlpD  uesls0 etoim3io4aptelfvi ( aDtr( pnt1opx iociadfa2ul(vp;u0 renxr3ta1omDrlues s)teumxmpnu1oleelieta()sDrmx  ;t1ape mf3tatfa2um( pnt) reomrcta1lpt  ues s)srxm(opoy1llte ivsl( s2uru o;o0oexniiciadfaDemnmont) lxnxfcoadom  anvi s teto(r no1ol elfct (f rua(m ot0tpx moeiaslmDrmnvo;u)altrxr3tydopDeaiesls0seumxr3oudal n ivias aDtm(m ;t1alx miciytfm ulums (0altniocoy1op  au o t)trtr(m ou1aleelieta(f Drmumono1aexo icilt m rmu p t) lxrir3tytomD au s s teum(mpnu4olt mfeia()sDtrx poo0aex iieiadlm2umnms u)tetnifcia1fpDrli i;t  2uoirpny4om emiesat  rrrxmp;o1oeeoiicilsfm ua(mpnu4tlenmrctydopD au s;s0setr(m nu1ape mnvsl( arraxm oo4aeeoiociasfm uanmpnu0aexoxo3oytfmteaueilt  2xmimpiudlpt licias)arta( pnu1ale  octasfa uauvo;t0tetoxf ta1faD  ueilt) 2tmxr oodllte fctat)srtm(m ;u4tltomoctlsls2ulnvp;(4tetrio3to1fmte ues;t  2trir3ou1ame lnesltfaDumum nu4oeeomfeiat s2umuvpn()tlxnmfciodlmD  ies t setmim io4ome livt t  2tmum ;t1oeto f3ils a ul(vs t0 rxnxf3to1lmtr uei s0 2umirpoodal emfcsat)arrmu  oo1tptnmietltlm2ranmpn(0trxoir tatla rln i;s0trur(o nodamtnmncia(f Duaumoot0texn iciadfm2rmnms;u0 eermr3tadoatraieilt0texmio oy4olenlncia( sDrruroou0tle iieildfs2uan snt0tlxrifcoodfp eau il()sruoxm3nu4lp   fesls sruax  no0tltnmf3ils mDra(vs;t4trtnxo oytop r u o;s0srtrxm oo4apeelnvi s)arua(m nu4oltoii3ias s umnmpn(0trenmf iydlatranv
\ No newline at end of file
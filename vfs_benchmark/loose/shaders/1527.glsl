@@ -0,0 +1 @@
+nei s) eurir3oo4llt  fvs (farrr(  ;u0tlx  i3tydfmDumnmo u) exnif3totlmt au i ( srtm(mpno4lmenmfcsa(f 2uau  oo1tlxniietatlmDulu p;u)arxnxoctadfatrluvi (  2urim no1op n fesl( srrr( p;t0tex ii3iatfaDrmnmont0tlermf tadomtr n s;( teurxr3iydap elnvt ()sDrau oot4oltomictasla em(mp;()tetoifctotfateai s s0trur(rpoy1ap elfcil(f rrru onu4oleo ietytls2ra(mp t)tleoif iydlat livils0t2uoio3io4lltnmfcsatf 2taur ;o1aexoifetatla emu sn()tlxnxf iydop eanvslt  rxoirpou4ale lieia()srtrx pnt4oee ifctltlm2ranmp t0 lenmocoatoa r nei;(0srtmim oydaptelneias)artmxmo;t4opxoifctldfm2el( snt)tlerxfcio1lateln s;t teur(o iy4ol nmfeiatfs2urumo;o1alxniocilslsDuanms;u) renxf3tatoa raueo t) 2tr(o3iydopee feta(fa2uax pnu0ape ifeild a2rluvp;()aeeoif3io1fpD  ueslt0 rto(r io1apenmivs () rtm(mo;o1olxomo3tad s emn s t0 lerircoatfaD aiesl(  rur(o3no1apenmfvils)srtmumo;u0ape mieiadfs raump;u)aetnxr io1fm elneo;t)s2tmir3nydom emfeiat) 2rmu  ;o4oeeomo3tadlmDul( s;() rtnxo oytfa   uvo s0teto(o3iy1amt lfesl(f 2tm(mpoo0altoiieiatlmDrm(ms;u4 etrmrcoo1fatr ivo;()srxoxr3iy4lptemnvtas a2umu  ;o4tpto fciasfsDel(mo ()texrir to1lpte u o;t  rurir no4optelnes tf rtmumo;u0tetnioeiytfa uanmpnt0teerir3todfate ieslt0 ruoim3iy1lltelfci s a2tmu  ;t4ale mi3iasfm emnvont4 etnmoctotfaD aivi;s sexoim oudol nlncil( srumu ooo0apt  ictys s rauvo;u)tlxnir iytfpteaivo;()seuo(m3oo4am   ivsl()srrax  ;u4tlenifcilt aDuaums (4 exrmo iatlp rluvi;( seum(opnu4apenlictls) rtrxrp;o4apt ifetydfsDuau o t0trenifcoodoat aueo s) rxm(opiu1llenmfes tf rrrump;t1texnmictldfm eau p u4tlxrmr3io1fa ranesls s2xm(o ny1ap  lnesl() rraxront0teenmietytfs2ua( p t4texnir3iy1oaDe neslt) etmim oodlp nmfetlsf 2um(mpno4tptoii3iytls ua(mo;t)aleoxo iodoaDeanei (0setrio oodomenlfeil()a2taxmpot4aee io3iyd mDumnvp;(0arenmr iatlpDrau ol(0 eumxr3no4olte fcta() rtr( oot0oee mi3iat mDea(vo t4altnio3iodlm ranvslt0truo(m3oo1omeelfes (f Duaxro;t0apxomfetysfaDelnms () reomr3iatlat  n o;() exo(m nudol emivt tf Draxmono4apenifetytfs eanvs u)alenif totomtrauvs ( trtrim3ny4optnlneilt arrr(m ;t4oexoiieiys m2uauvs;t4trtrir3oa1fp rau ilt  rtrio3nodlp n nctlt  rtaumpnu0tee mieiydfsDemn o;t)alenxrciydlpt ai sls0 2xrio3no4lp n nvi ()sDrrx onu1aexoioeilsfsDua( snu) etnir io1fpD  uvs;s)t2uo(rpnu1aptnlicsat sDta(mpot1olx  i3iytfm2elnmo;t)alxomf3iytomD au s;t)s2xrxr iodopeemnvta(fsDrax pnu1apxoiieiad m2ean on(0altrifcoydoat lneo s)teur(m3iu4ome lfcslsf Dtau oou1tpxniictysfm ul(vo ()tlxrmo io1laDeanvils  2urxmpnu1ap n fet () Dta(mpoo1ole miciaslaDulnmont4 etoxo iatfptr uvs;t)texrxr no4omtn ictas) 2tmx oou0aeeo oetydls umnvs ()arenxo3oatomt anvilt) 2uo(o3nydom elnetl(fsDur(  no0tltoifetydlaDem(vsn(0 rerxrcoodopDranvols0sruoxo ou1lpt lnesas)aDtm(r nt1aee  i3tltlsDea(mont0 etrio oy1oaDelneo;s trxoxopny1op elfvtatf rurxmonu1ope mo3ildfa eluvs;t0teenir3tadfp rlu o;s t2xmio3ny4ol  mieslsf rtrurpoo1olxn o3iatlmDraumon()alenxr3oadfa r nvil(  rxrxo ou1oltnmicia(fsrumum oo4oexn feilt aDum(vo;t4tlxrmo oytfmtrli sl(0 2uo(m3no4om nlncil(  Dumumonu0optn ocildfaDumnvsnt0teermfciytlmt  uvi;s0s2xmimpoo4lpt  iesa(f rtruroot4oltnif3ildla2rmumont0 etrxfctydlmDrai o (0t2xoio3iudlmtnlnvias)arurx pno4altnif3iatfsDea( pnu)areoio oadfm raueslt0 exoimpoudom nmfvsas)aDrmx ono4optn ocilt a2um( o;u)tltoirctydlat  nvi t  2xoxr3oudal  lncsa(  rrmump;t0ope io3tydfs2ranms u0artomf oadfm eauvolt) exmxr no1oltelfcia()sDrm( pnt0tlx mo3iltlm2ua(vo u)trxnio3ty1omtrlneo;s  etrxopnu1op emfeils srrrump;t4tpx ioeiat s emuvp;u) exrxf iodfmt  i i (0teurim iu1apenmiciatf 2ur( pot1oeen f3tldlaDeln onu)texnxr oodlaDrluvo;(0setrxrpnu1lmtn fctasfartm(  oo1tpt moetas mDrau o u0tlxrxr io1omDeanvo ()srxmxr3iodlltn fvs (fs2rmx oou1olx mi3iytls ranmo u0tlerxoctodlmDrai o t seurxm3iudoptelivta()sDtrxm ;o4optoioeiatlm2ea(mp;()altoif to1op e ivo;s)sexm(mpoo1llte fcsls)sDua(  ou4tlxnif3iydfaDrlnmp;t)artnxr3iodlaD lueo s0trtr(rpny1lpt mfvilt)sDtau oot4apto o3iysfa2rm( p () rtnmr3iadfm r ueo;s teto(r iy4lltnmieias  2ua(  ;o0aleoio3tadlm2rmuvp;t4 rxrircoodlptr ueo;t0 rxmxmpnu4ap  mneilt)srtrxmono1ape  ietydfs2rauvo (0altoifctadlp rlies;s)texmxr3iy1ll elnetas  2uau pno0tpx mocildfmDran s u) rermo oa1laDr ivil() 2xoimpou4amt lfci tfa2tmxr oo0tptnifeiydlaDrl( snt) lxnmocto1fmDean ils  rxmim oudol nlfciltfa2um( p;o1tpx  octaslm2elnms;u4tlerif oodoaD au s () 2xmir3oy1lme  fcias sDurxr nu4oeto f3iadfs2ea(vs;(4teerif3oytlm rlies;s)trxm(rpoo4lltelicslt s2um(rooo1ope mi3ildfm rm(ms;u)tetrmo3oadfm  ln i ()srxoir3oy1apeemfetl()a2rm(rpno0tltnioctlsfm umnvont) ltrifcoa1omDeln ils s2xoio nodoptn nci ( s2ra(ro;t0alxo icilslmDrl(mp (0 etrxocoodlpD lu s (0t2xo(r3oydop  mnvtltf Dtaxmo;o1tpeoioeiad s2eauvon(4texnxo oo1oat  ivi () 2xm(o3oy1lmtelnvtas  Drauroot0ale if3iytls2rm(vs u0teenxrciodfaDrlueo s)texoio3nodaptnmfetat  rua(ront0openif3iatlsDel(mpnu)artnxocta1fmDeluvi ()trxmxm3ou1alee nvt () rrm(rpnt1alxnmoeils aDelu snt0treoircia1opDelu il()s2um(rpoy1lme  icta(fsrtrx ono0apt  o3tad s umn snt4tlxrifciytlm ranvils)srxm(mpou4omtemnviasfarumur nt4tpt mictytlmDraumpn() eenxrcoadfmtrai ils)tetoxo nodomte ici s  Draurpoo0aexn feildfm2rm(mo t0trtrirctadfmDeaivolt t2umxo3ny1ameelneil(  rurx pou0tpe mocildlm2rmnvo t4tetnmr3iodlpD aivi ()texoxm oo1al e feslt) 2trxronu1oetnmo3tldfm2rm(mp u0trxomr3oydomDeaieo;t0t2uoxr iy1ap elfeia(  Dtrx ont0oltnii3iltls2uau o;(4aetoio3iotopt aiei;(0t2uo(rpny4altemnciltfa2ua( o;t1opt if3iyt m ran p;(4 leoxr tadlaDeluvi (0 exm(m iodop n nvt s srtrumpot4oee  o3tlsfs rm( on(4 lxoxfcoadomte nvolt) euoxrpio4lmeemies t a2trxrpnt4alx io3iys s2elnvpnu)altrxo to1lpDrlnvols) 2tmir3oy1op e nesas)aDta(m nt0alx  octlt m2uanvp;u)areoxf tadlpD lnesls0srtr(opnu4ll  mncil() rumxm oo0optniiciytlm uanmonu)teenxf iatlp rlues t0 2xoim3iydol  mivta(fs2ta(m oo4oetn f3ildlsDelumo;t4 eenmfcoytfpt aivo ()srxoio iydlme mivtatfaDurxmoou0tptomi3tadla rluvo t4 eenxrciodfa  lnes s t2xo(rpnu4ol   fet t sDrmur ;t4apxnmi3ildls eau p u0tltrif oa1fpDeanvols seuo(opiu1ll nmici s)a2uru  oo0tpe io3iysfmDeln s;u)arxrif ia1omtrlues t) rxmim no1op emivi t)aDraxm nt0altnmo3ilsfaDrl(ms (4 rerio iydla r nes;t) 2xoxopiy1omtelictlt srurxm no4tlto ictldfs eluvo u4aetnifcoo1lmtrln olt0sruo(mpnu1lm  mivi t)arua( ono4tpxnmietltlsDrm(mo;(4 eeriocty1op r nes s  eurio3ou1altemneiatfarrr(m ou1tlen f3ildlmDulnms;u)areoxo3todoa e ueo t0seurxmpiudop e fct t) 2ta(mpou0opxniociadfa2um(vsnu0 lerxf iotlateaieils  etoxm oo1ame lnvia(faDtm( oou1tlen ociysls emn on(4trtnmf3ootopte ueolt) 2uo(r3iy1apt  icilsfs2trur no0oexn icilsfm2eauvo u)trxnmr3tytlaDelieo (  2xoir iydlmeelietlsfaDua(mono1apt  octls a ul( pnu4tlxnxo totfaD au il()trxoxmpou1ape mnvsltfaruaxr nu1tpto feiyslm eln p;(0alxrmr3io1la e ivil()s2urxrpiy1al elies t  Drmurp;t1oleo i3iad m2eluvsnt) rxomfcta1oaD lueo t) 2ur(m oodlpte icils) rtm(mp;o0oee ioctydfm2rln pnu0texoxrcoytfateli il(0 rtoirpno4lptelfvt tfsDta(m nu4tpxoif3tyslmDelnmp;(0tlermf3oodom r neo s)srtrxm nudomtnliesat sDtaxm ot1aetnioetasfs2eauvo t4alenmociydopt auvs t)s2urxr ou1opteliei t) 2trxrpno1aeeniietaslmDeauvp t)tleniociotlp e iei ()trtr(m no1lm nlnct ( srtau poo1olenmictydfsDuauvsnu0 leoxf3oy1om r ivsl() ruoxo nodamenmfvi (  2ta(rp;u0alt mo3iat sDuanvsnt)aexomf totfaD anvs;s  exoio iu4opee iciat)s2ra(roou0aptomf3iyd a uanvp u0tltrxr iatopDr iesls)s2tmio3iu1alt livt ( sDta(rpno1aetoiociltla2uanms (0 ltnircoo1faD anvolt0 2uoxrpnydamtelfct tf Dra(moot1oee  f3ild mDrmu p;t)tlxrmfcootomtrauei s) 2umimpiu4lmeelieia()srurxront1tpxn ictydfs uaumpnu)treomr3iy1faDelueo s  exmxo oy1op elicsltfaDur(r oo4teenif3iytfaDumuvs u) rxoir3oodfmDr i o;s)sruoim ou1al e nci t)aDtrxmpou0apt mi3iat a um(mpnt0 leoxr3ta1omte iei;()t2toxopio4aptnmfei s)aDuaumpnu1altn ieiasfsDra( s;t)tlenifcia1fpDean sls0t2xrxmpiu1lltn nvs s)aDurxrono1alxnio3iatlm2ea(mp;u4altrmf tadlpDe nvs (  rurxr3oy1openlfesasf 2ua( oou1tlx mieiyt a2um(vp ()teenifciy1op ran s t  exmxm3nu4lp nmfct s  2raurpoo1opx mieils sDeanms;() rtrmr iydfat livsls trtmxrpou4lpeelfvias) 2ta(ro;u1teenmietldfmDranmsnt4 rtrxocio1oa ranvils0s2xmxm3oydlm   nctls s2ta(mp;o1tpx if3ilt aDrauvsn(4tlenio tydlpDr n s t setmir3io1olenmivil()aDurxroot4ole  o3ildlaDul(mp u0 reoif oy1oa e ieo s srtrio3ou1amtnmnvtat sDurumpou4tlxn fciasls eaumpnt4 eeomf oy1fm ean i;(0srtrxm3ny4open ivi ( arumxrp;o1apxoii3iadfsDrmnvsn()aexrxfcto1oaDeln olt)trur(o nudlpee nesat)aDumxmpou0apxo f3ias s2ranvpnt4tlxrmfciodfa ranvi;()sexoxrpnu4olee iviasfsDrrxrpot0tpxn ieiyt m el(ms t)arxrxr tatfp  auvs;t)srxrir3nu4lpeelfcilt) rurx ooo0open i3iys m2rmumpnu0texoxfciatlate i slt)s2uoimpiu1alenmivi t)sDraxrpnu1apx ifciadla ul(vp t0tetnxf todlaDelivo;t0t2um(o3oo4omenlietasfarrm( ono0tlt iiciydls2ua(vs;t) reoioctytoa eaneo ( trtm(rpiy1al  mictlsf rrr(m ;o0olx iociys s2ea(vont4aetriocoy1oa  li o (  exmirpiodolt lieias srrmxr ;u4tptn i3iyt aDrmu pn(4 rtrxr tytoaDrlnvs;t sexrxo oo4lm   fcia(faDum(m ot1tlxnmiciydfs2rauvs;t)arerirciadoaDr u o t0trxrir iy1lm n iet (fsrtmumpoo0ape mieiatlm rmumpnu0trxrxo3ia1op  anei;( s2tmio3iu1ll  miciasf 2raumpnt4optoiictysla2el(vont)altrxrcoy1opDeaieilt0trtmxmpou4lpt  iei ( a2ta( pou1tlt  ocias a elu on(0tlxrio oydlmt aueo;s0 2xoirpio4omt lnviasfsrurur ;u4tpt  icias sDemu s t) lermr3iy1fat  u slt)tetrxo oy4ope  nvias) Drmxrpnu4oexomociltls ua(ms;u)aetomf3iadfp  an o t)s2tmxo ny4llenlncsat)aDrru  ;t0ape iociatfa rm( pnt) ltnmo ty1fmtelnvo t0srxrio oudale mies s)artrum nt1tlenmiciat a2uauvs;u0tetrxf3tatom eanei ( srto(m3nydoltnlfet t) 2uru poo4olxn i3iydlm2rmumo;()arxrmocoy1fptelnvi;s s2uoxopiy4lptn iviltfs2tm(rpou1oetnmi3iad aDumn s u4tetoio3iy1latrauvolt  etoxm3no4lmte fei sfa2rr(rpnu1alenio3iytla2umuvo () ltnif3ty1oa rau ol()seurio3ou4opee ncsl() rurxmo;u1tleoio3iydla rln s;(4 etnxrcto1oa rlnes;(  rxmio no4alen nesa( sDtr(r ;u4ale mfctad s uau pnt4 lxoir3oytomDrlnvolt0sexmxm3no4opte iviat)sDrr(m ot1ale ifciat mDranmsn()texrxo iytom r nei t)srtr(mpnu1ameelivils)a2urum ;t4tpxoioetls aDua( o;t0 rxnio oo1oa e nvs ()srxmxrpoo4lpeemncs (  Dur(rpnu0altomfeiadfa2raums;(0alxoxf iotlmt  neo;t  etrio ny4amtnmieiltfarra(rooo0oetomoctadfa umnmo u4 lxoircoa1lp e neil(0trto(o3io1aptnmnvta() 2tm(mooo4oetomfeiaslm umumont0arxomf3tatoaD lu o (0 rtoir iy1ope  nci sf rrax  nu1aexnmoeilslmDeaums ()teeomr3iy1lpteauvil(0s2xo(m no4omenmfvs t  Dtmump;t1tet  o3tlsla ul( o u)tlxomrctotfat anvi s)teuoim3oo1al  mfcsl( sDtr(r ;o4oltn ociatls el(vp;(0altrxrcia1fp   uei s) rtm(r3ou1llenmncsl( s2umxmp;o4opt  f3tatfs2ulnvs;u4aetrxf iydlp rluvsl() 2xr(opiydolt livtasfsruaxmp;u0aee  f3tydlm ulnvs t)trerioctytfptelu s;(  etrxr3oo4apt lnvsat)sruru  ;o4aeeomfctadfm2umnmo;(4 ltniocta1lm rai sl()t2urim3ou4lp emfeia() Dtax pot0oexn fetad m el(mp u) ltrifctatop   nvil()s2um(r ou1lp elnei s)s2rrx p;t4optoio3iytls2ulu s t0 ltnio totfaD aivols0t2to(opiy1lm elfcs ( a2trumoot4tee mfeiatlsDrmu p (4tlxnmr3ia1lmDelu olt sexm(o oudol  mfcs t a2tmu oot4olt mi3tls m2eluvs;u0 reoxfcoadlp rln s;t)s2xo(r3ou4lp n fvsl()artmu ono1apto ieils s elums;u0trenif3oa1lm eln sl( srxm(opnydamenmici ( aDtrum ;u0tpxo octldfaDumuvsnt)trerxfciy1oaDe uvilt)seto(o3io1lltemnei s s2taxro;o4texoifctls m ean s (4tetrmf3io1oat lnes t0t2tm(r iodapt  feiat) rraxmo;o1apxo f3iad a2eanvp;u4 rxrir3ia1omDr ivs;t)t2xm(o3oo4ope mictls arra(r nu1aex  ieiasla umn snt4arxniocoatfatr iesl() rumir3oo4op  mfvs (  2ta(r no4aeeniieils m2rmnvp t4aeeomr ta1laDranes s trto(opoo4ameemnesa(fs2tmumoou4alxnmieilt a2rmums t) ltomr3oadfaDeaiei s0s2xr(mpno4ape mncsls) Dra( poo4tle  oeiyd a rl(monu0texnmfcto1opDr n ol() rxr(rpiu4lpt lncil()srtr( oou1oltnmfcild s2uan pnu) ltoio3oa1laDraueo s0setmim oy4ope lfvils srtm(r nt1texo feiasfs ranvpnt4aeeoifctodlmD au sl() rxrio no1altnlfciat) 2uaur oo1alx mictysla uanms;()tetnifciotfaDrluvs ()truoio iydom  mfci ()aDua( pno4tet mf3iyd m2emn s;(0 rxrmo iadfpD  nvsls)srurxrpiu4al e ncil() 2uau  oo4open i3iytfa ran o;(4teerxr iodoatelies s)t2urxo3no4lmtn ies (faDuru  oo4aee mfetytlm el(ms;()aetoxr oytfmte ivi;t0 rxr(r3nodam nmnvta(faDtru  no4aeen ociydla2eanms t) rtrmf tadfp e i o;t0t2xmxo3iydopt lncs (  rrrxr ot0alto fciasfa rlnmp;(4 lxrxrctodfm ranvi;t)teto(opoydll  lnei s srtrumpnt4tpxnmo3iltla rm(von() etnmrcty1opte nei t0 euoxr3iu1lme mfesasf Dra(r ou1alen fcildfa2uanvo;t) rxrmf oo1omt lneo;() rtrxrpiy4ameelnvtasf 2taurono4texomieiytlm2elnmpnu)teeriocoadopt ln o t0sruoim3oy1openmfeias  rtruroot0apenifciatfaDumnms t)tleoxoctatfat lnvs;t0s2xrxmpiodlmenmnvtas  rtrur ;t0tptomo3tlsfm ua(mon(0 eeoxocio1om  li s;t srumxm3io4omtelfcilt) Drmxmo;t0tlt  feiytls ra(ms u) lermr3iytoptrli ilt)trtrxo3oydaltelicslt sDraxmoot0tptoifetytls ean on(4 lerir iodla   i ilt)sexrxo oy1ape mnvslt  rtaumont0apeo i3tysfa2rau snt0 etnxocoatom  ai sl( s2xr(m3oo4ll  lfcs t arumxrpot4tex mf3iltfs uan p;t0alerxfciodoa elnvi s setrio3io1amt lfctls)sDtau pot1tleomf3iyt m2eau p (4 ltrmo3ty1omtr nvils0trtr(r iy4ope  nesl() Drauro;t4olxomoeiaslm ra(mo;t4aleoiocoatfp r ivi;()t2tm(o nu1ale  fcs s  2umx onu0oee  ieiltlmDrmnvs (4aexrxf3totfmt  nvs (  2xrxm nu4altnlnet s)aDumx p;u1tetnifeiadla eln o;t) rxrio3iy1oa eaivol( t2xr(m3io4lpt lfct ()sDrrum no1alenif3iatfa eluvp u0 lxomo ta1lp raivsls trxo(opoudale mfctlt s2rm(ro;o1texomocild aDea(ms (0arerxfcta1fmteanvs t)s2xrxo3oydlptn fvsl( arur(  ;u1aexo i3iat a2umnvo;(4alenio totfp r u ils0trxoiopiy1lpenlici () Dum(rpoo0tpx mfeiadfs rm(mo t0 lerif3oytfptrln i (  etm(m3nodolee ivsa() Dtmumoou1tlt mictlt s uanmo;()artnxo3totla ranvo;s  2xoxm3iodope mics ()aruaur ;o0oeenmoeiatls2eauvpnt0artomo tatomDr ueslt)setoxrpoo4ol emictasfs2uaxmooo1oee mietyt s2rl(ms t)teeoir oydfptelivols)s2uo(m oudamtemfci t) Drmxro;o0optn i3iatls um( snt4aleomo3todoaDr i i;s0trxmimpoo4ape mnvils)aDtmu  ou0apxomietyd a2umump;t4aexrmr oy1fptrau il(0texm(o3oo4ome  ictl() rrmuro;t0texnmf3iys s el(vsn(4 etoxo3tadfateauvo;t)srtr(r3ny1am emiciatfa2rm(root0tex ifcildfaDumumon()tleomrctatop ran slt0sexoxo iy1opt  fei s sDra(mp;t0oleo icils aDel(vs t0aetrmocoodfatrauei;t srxrxm iu4lm elici s)srta(mpot1tetnmf3iytfa2ea(vsn(0 exrxr3ty1fp rliei;(  exo(r3oodaptnlfvsa( sruax  nu4oee  ictltlaDra(mpnu0trtomf3iatlmD aivi;t)s2urxo3oydlmenlfvtatfaDtau onu0aex  ietysfm2el(monu0altnxo iodfp elnes t0teuo(m3io4ll nmnvi (fs2tr( p;t0aex iociysfmDrlu p (4 etrioctotopDelu ilt) 2ur(rpiy4amt  nviasfaDraum nt4optnii3iyd mDrm(mpnt0aexnircoodfmtr u olt sexrxrpno4lpenmfci ()a2tmu o;o1tex  f3iltlsDrlnms (0 rtomr tatlaD aivols0trxrio no4altnlncsl()s2uaur ;o0aeen ietld a rauvp;t)aeerxf3ootlmt lnvo t)srurxm3oy1apte icia(  2ua(moou4tlxnmo3iadlmDel( s;t0tltrmr oo1lmteauvs t0trum(m3nodal emnei t) Duaxmono0oetnmfetlslm2emnvo u4 eeoiocta1fmte u o;s seuoxmpno4aptelnet tfsDumx onu1alx  i3ildls2elnvsn(0 rxnxr3ty1fmDrln o s  rtmim iudomen netat  2umxm ;u4ope if3ildfa2emuvs;t4teerxo iadfpte i ilt  etm(m iydaptnlnvsls  2ta(r nt0optnmociydfs emuvo;u0arerxrcty1lp eaivsls) etrxrpno1olt  fei sfartrxr ;u4tpeomocilt m2ea(vsnt4alxrif totlpt auvsl() etoio no1ape  fesatfs2rmxmpoo4alxn fcilsfm2el(vo;(4 exoif tadoateluvs ()s2uoxopou1ole  ivsa( sDurum no0tetoiociad m em(mp;t)aexnmociydfmt  nei;(0seur(r oudlp emfvsas aDumxmont4aeto fctadfm elump (4artomo3iytla   uvi;(0tetr(m3no4aleemfes ()srtmxro;t4tet  i3iytfm2ra(mo u4 ltrxo iydla e ivil(  exmxopnudal eliei ()s2uauront1teenmfcilsfaDrln s;u4trxrxr3oatfateaivolt seuoimpnydomenmfes () 2uaxmooo0opxo fciasfm2eau on(0 leoxf iydlptrau s (0 rumxo3nodlmtnlnvi () rtr(ront1aetnmo3tytfmDea( o;() etrxf3ty1op  luvs t0 etmxr oudaptnliesas a2tr( p;u4alxoio3iad m2um( p (4 lxnio tytlpteaiei;(0truo(m nudoltemfct ()arurx poo4apt mi3iasfa rau pnu) lenmf iadfm  lneo;s)texoxm oo1ol  lnesa(  2taxmp;u4apeo o3iytla2elumpn(4aexrmr iy1opt aueolt0s2xoimpno4lptn fvias sDtru p;o1openii3tysla eau o;(4 lerif to1opDeanei (  euo(m3nudopteliet tf 2umxmo;u0tptnioeiysls raumpnu4 leomo3oodoatr ueolt0 2trxr io1ope mictls a2rrxmp;t4tpxniieild a2rmuvo u0teermfctatlm rlu s;s)teuo(o3io1alte fvsl()artmxmpot0alx  i3iytlm rlnmsnu4tetoir oo1lp  an o (  rxoxm oy4omeelfvtat)a2rm(roou0tpeomo3tytlaDum(mp u)altnmf tydfp   ueil(0setoimpio4ole  iesa(fsDraxr ;o0olxomfctysfs2ua(mo;()aetomrcia1opDeau o t0seuoio ou1lmt  nes t)a2raxro;t1tpe  octydfm umnmonu)tlxrxoctodomt  neol(0t2xo(m3no1omt lnvs sf rtrx  ot0alt mf3iad m elumsnu0altoir iotfpD  u i ( t2toxm3iy4oltnmivi t)sDrr(  no4openifeils mDumnmp t0alxoif3iydfa r ivsls0trxrxr3oy1apeemnvt () Dtauro;t0aet mi3ilsfsDranmo t0 rtnmrcoy1fmDr ivo;t0trtmirpnu4om e nei ( a2rmxmo;u0tpxn i3iyt aDem(mpnu)tlerxo oatoatrauvolt)s2xrio3iudlme lnes () rurumono4oee  oeildls rlnmp;u)teeomf3tadoa e ies t)s2uoxm ou4lm  mivilt) Dum(m ou1oleo o3ilt sDrm( s u4teeoxo totoaDelieil( t2xoxm oydaptemfcsl( sDtaxm no0tee mfeiasfs um(mpnu)aeeriociotfm  li slt0 rtmirpio4omte nviat) rrm(  nt4oetoifcias sDemn snt4trxrifcia1optranvils  2um(r3oydom   fesls aDurxmpot1oleoif3iyt aDrmnmo;t4trtrifciytfm   ueols)sexo(r3iodam e nci t  Dumxr oo1tlenmi3iltlm2uluvpnu0alermo3iy1oat aues;()setoio3nu4altelfetlsf 2ua(rpnt4oee ii3iydfa2eanvpnu0alxrmf oodlm e i o s)teurxrpiodlm   fei (  Dta(  ;o0oex mieiatlmDumnvonu)texomf iy1la e nvol()srtrxr3oo1altnmncsat) 2ur(  ot0tleoifetydfa uauvsnt0tltoio3ty1om rlies;t  2xoxr ou1amen iesas sDum(mpot1apt  f3tlslaDrluvo u)tetnifctytopDr ieilt0 eumio3oo4am  lncil() 2rrxr ou1alxn i3iytla2uanvpnu0 rtrir3oy1lmtr iei s) ruoxo3nu4lmt lieiatf rumump;u1tlt miciltfs ra(vp (4alenxr ootom  aues () 2toxr3ou4altn ncs s) rurxr nt1apenmoctlsfm rau sn(0 etnxrcoadfmtr neslt0 rtm(r3oo1ole  fet s sDrrxm ;t4tpxo ieiyt m rau s;t4alermrctatlpDelnvo t)truoio ny4altemneslt)arrau  nt4olx mietydlm2umuvo;u0 etnxr iydfp eli ils trtrim3oydolt livi s aDurxroou1oltomi3tydfsDeanmo;(4trxrxoctadfaD auei t0t2toimpoo1ap  lics (fsrtax oot4oetnioetltfm ranvo;t0tetnif3oo1lp r nvs t  2tr(o3iu4llt mivi t aDta(r no4oleoiieiadlsDelu p t)trtrio3oytopt  nes;s  rxoim iu1ape mivs (faDrau o;t4tlxoiieiatlaDra(vs;()aexrmocoy1lmDe u i;( t2toiopnu1ol  lnetat  Dumurpnu4oee  ocilslsDuaumsnt)trxomf3io1lpt lnes s setrir ny1lptemfvils)s2trurpnt1aee  f3iys m2rlums;t) lenmo3oodfp rli sls) 2xoxopiu1amt mfvia()artru ono0oex  i3iatfs2ul( snt0 reomo oytfaDr nei s0teto(o3iudole micslsf Dta(rpot1aetnmf3iysla rau onu4altoir todfmteluvi t0trxrirpou1lm nlfeslsfarua(rp;o4tpx iictytfa2el(vp t4 exnmfcoodfpDr nei t) exr(opoydlmtelnvsls)sDtrxrpot1apxomo3iydls em( snt4 eerxr3oatfp raueols  rxm(o nu1ap nmnvsltf Dur(r nt0tpxoifeils sDrluvs;t0arenmf3ootlm e nvol(0trurimpoy1om  mfciat)s2umxmpnu0opxn feiad mDeln p u4 ltnmo3tytlpt auvi;s0s2uo(m nu4lpt mfct s)aDraumpnu0alxnmoeild s uanvp t4 rtnmo tytlpDe u i;t t2xoio3io1om nlfvs ()aDumurp;o4alxoioetytlmDuanvpnu4tltrxf3totfmD ln ils) eurxm3ny1omtnlnetas  2tr(r ;o1tleo feiltla2ulnms (0alxnxr oodlpDr nvo t0seuoxm oudop nlncs s srumxr nt1ape  fciytfa2uaump;(0 lxrxrciytlp e ivs t0srur(r3nu4optemict sfarurum oo4oexo i3iytls emums u4 lxnxo ta1fp  lueo;(0t2uo(rpoodoptnmneils  rta(  no1oetoifctas a uln o t4alenxf3to1omt luvi (  ruriopoo4lm n fetl()srra(m ;t0ale  fciysfsDum(vo;()texoir3iy1latrlivo s0trtoxr oydlpeelfei s artrxr ;o1oeeoioetatfm raumpnt0 eerxf3todoa raivi;()seuoxm3io1llenlfctl(  rraumo;u0tet  octyd a ran s;u0tleoxfcoatfp eai ols0seurir3oodoleemieil(fsruru onu0tle  f3tlsfs rlnvpnt0 etrif iadlpDeanvs;s0sexmir iudaltemici (f rta(  nu1aetniiciyt s2rlnmo u0texomrcoa1lmt lies;(0trxoirpnydlm   fvi t)s2taxrpot0oeenifetat aDel( o t0tlermocoatoat lnvo;t t2xmio3nudlptelfesltfa2uaurp;u4tlx  o3tydla ranmp u0 ltnif iydlpD  nesl( s2uoxmpno1lpeemneias)a2uaump;u4optnif3ilsfaDea(von(0 reoxf3iydom  auvs t)s2xm(o3io1op n ivsls)srur(rp;u1teeoif3tas m2emu s;t)trtnmf3tatfmtrauvslt trxr(m3oy4al elneils) rraurono1aet  ietytfa eluvo;t0arxrmfciydfpDrai olt setr(rpiu1lptnlfvta()arrm(ro;u1aetnmo3taslm um(von(4teermo3oodom r n o;(0t2ur(o iy4lltnmfviasfa2rm( ont1aet ioeiydfm eluvs;t4tleomocio1fmD  u s;s0sexmir iu1openlfvias)sDra(ronu1apx mo3iat m rm( snt4trenmrcty1la   i o;s)sexrxmpny4am e fvtlsfsDrauroou1opx mo3tydfs ulnmont0artrio3totlmDeaneslt0srxm(r oydllt mfvi s sDua(mo;u1opt if3iat a2eanvp;(0tetrmf totomtraivolt  euoxo ou1amt  ncta()aDtmx pot0olx ifciat mDulnvp u)alenxf3iytfm   n i;s s2xoxo3oy4om  lfvsat)artmu p;t1alxnmfciltfmDra( onu0trtoxr tytlpD lnvi;(  rumio iu4lptelfeilsf Dua( o;t4aetnio3ild s2rlnvonu) eerxr tydfm rlu o;t0setmxo oy1lpe  neia(fsrtaumpno0aeeoiietytfaDrmuvo t4 exomf tatomt au s t0 exrimpiodlmtemfeta( srtmxroot1alx moeiasla elnvon(4tlermoctodfpDr ivo;s0tetrimpio1lpenlictlt a2raurp;t4tptoifctadfmDumn o;(0alerxrctytfp   ivo s)s2tmxo iodap n ivs ( aDrm(mo;t0opt mi3iydls rauvo;u4 eeoirctydlmDraivi;s0teumxo3iydoptn iciltfartmx pno0tptn f3ild aDumnvp t)alerxo3oy1oa rlues;s)t2tm(o3oodlmtelfes t)aDta(mpnu4optoioeils mDel(mp;u4aetrmo iy1fm raies t0 eto(opny4al   ies s) rumxrp;o4aex iieiltla2rl(msn(0 lenmfciadlaD  neols trur(opoy1optnmnvtltfaDtau o;u1tpxniietls sDel( s;t4aeermfcia1oaD lueolt0t2tm(r oo4ll emfeils sDrr(  nt0oet iociat s2eanmp;(4 lxoxr oydoatraues s0 2trim iodomtelncils srrmur ;o1aet  o3ils a2ra(vsnt0 rtnmfciy1lmDrau o;s0t2toirpiodllenmfcs s arta(m no0texoio3iyd m2ea(mo;t)areniocootfpt lies;(  rxmirpio4llt lieta(  2ua(m oo4tltnmi3iatfaDrluvsn()tlermo3tydopteaueol( trtmimpiu1ape lfvsat) 2umumont1aptnmiciasfs umuvs t0aeenxo iatop   uvsl()s2toxo oo4alenmnei (f Dtaumo;t0oee mfeilsla2um(vsnu4trxnio tatlmteanvilt)tetmio3io4ale lnvsa(  2rr(rooo0aptnii3tydfa el(ms t4aexrmocoy1fpt luvs;t0 2tmxrpoodalt lfct tf rum(root4apxo ociatfa ul(vpnu0trtrxrctotoaDraneil( trtm(r3nodal   feslt srrmu pot0alt  feiydfs um(vonu0alermr3oa1lm rli i (0trtoir3io4om emiet ( sDurump;t4tpe iieiydlaDuanvs t4altrircoy1oa rauvil( teuoxr oo4lpenmfeils aDuaxmonu0tpx io3iydlaDrauvo;(0texomf3iodfat aivsls0t2trxm3nodlm  mfet s  2raum ;o1apxn f3iyd s2eln s () renirctadlatrluei;s srxoir3iodap emnei ( srrm( o;u1ale ioeiydla raumont)tlermf tatlp rln il()setm(r3nudlme mnes (f rrruroou4tlxo fciytla rmu p () rtnxr3tadlaDr u i;(0 rum(r iodamtnmfctasfsDra( pot1tle mieiydlaDra( pnt0 ltrifciytfmtelu ils srxr(m3oodol nlietl()sDurxr ;u1ope  i3iltfs ra(ms (4texnxf iadlaDeau i;t srxrim oodap n ies sfa2tmumpou0tltn fciysls uau s t)trxnmr3iytomte nvo ()t2ur(mpiodomtnmncilt sDuru  ou4altoifetasfmDrluvs u0tleomf to1lpD  ies;s0texrirpno4lpeelfetatf Dta(r oo0alxomieiysfsDumnvo ()tlxomr3oadoaD  n s;() 2trxo io1opee fes t)sDrrxm ou0alenmicilt s2rmumpnt4 renmf3tydlatr u sl()tetrxo3iy1ape lnvias)sDurumo;u0tltn ietadfa2rmump;u)aetoxr tadoptrlnvs;() eum(opiodapt lneslt  Dua(rpnu1oexo ictlt m2elnmp;(0 leomrctytlaDe i ils0 2xm(r oudll nmivs (fsruax  no4oleoio3iltfsDem(vsn(4arxrmo tydla  lueilt0 2xrxrpiydll  livi t)srumum ;t0aptn feiyd sDra(vo;(4altnxr3ootfm raivil(0srto(m iy1aptemfei s)sruax  no1apto ietasfmDemn s u0trtnxf3io1oate ivslt) rtoxm nu4ll nmfvi t sDraxm ;t4tex mf3iys sDrmnvo;u) rxrmr3tydfpte nvo t  etm(m no4lm  mfvil(  ruaum no0optn ictld mDul( p ()aeerif oa1lmDran ol()srxrimpnudop emfvt (fa2rru  oo1oleoifeiatfm rm(ms t4 rxnio ootlpte u ols0sexrio oo4om nlivsl( srta(  oo4apxoif3iltlm2eln pn(4 rxrmfcoa1lmteluvs;t)trtmimpny4apt  ivi s  2rmurp;o0apen fciasfa2emu on(0trtrmf3io1lp  anvo s truriopnudlm elneslt)sDrmxrooo0ale io3tasfm emu s t4aetrio ta1faDrluei;s)t2uo(m3oy4lm e iciat)a2urum nu4apen o3tlsfm rmumpn() etrxf oatlpDe neol()sexr(m3nydamtnlfesl(faDraxmp;t0oet  ieiydla2rmn p;u) reoxo3iadfatr ieilt  exoxopiy1amt  ici t)aDtmum nt4texn fcias aDulu snt0 etnif3tydfm eluvi;( truoirpnu1ll e ivsl( a2rrum ;u0aexo fciydfm ulnmpn()tlerif totlm  luvs t)texm(opou1ame lnesa() rumxrpnt1aetoiictlslsDra(mon()artrif3ootlatelu slt s2trio3iudal emfvta(fs2tmx p;o4tptomiciad a2uan onu4tlxrmo iydla rauvs;t)s2trxm nydlm   ietlt)aruaum nt1tlxniiciys a rau o t4tltomrcoa1opDr u ilt)s2xmio ny1amt micilt  2ur(rono0opt iociaslmDumu pnt0tlxrxf3to1lpte ieo s)s2tmim3nydoptemfcs sfsrrm(rpnt4tlxnmfeiadfm uaumon(0 rtoxr3oydopDeluvs ()seum(o3nydom nlivt (fsrtrx ono0altoifctldls ulu p;u0 rtoir iodlpDr nvolt0s2tm(m3nu4amenlfeslt) rrau  ;o1tptn f3iltfs el(vsnu4tlxomo3oadfaDr nei;t  rxoir oy4lmeelfci ( a2rm(  nu0tlxomfcias mDel( s;(4artnio oydfp r u o;(  rtoxopoodap e nei ()sDtmx pnu1tpe iociytlm rm(vonu4 eerio iotlmt  ivil( seur(o ny1amee nciat)aDtaur ;t1opt  ictatfsDrmuvp u)texoir3oo1laDe nei s srxm(opiydaltnlfeil()s2ta(moot4tlxn oetaslmDumnmsn(4 leoxfcootla   ies;(0 2tr(r nydalte neia(farrm(rono1texn ieild m rmnmsnu4tlenmf3oytfa ean s t truo(r3oodom nmnvtasfa2ta(mp;u4tlenmoeildls2ulnmo;t)teeoxr3ta1lpDrliei t) rxrxmpno1ol elfvtas)sDtaxr oo1opx moeiasls emnvsn(4trxnmo3oodfa ean o ( t2umio3iodlme livsl(fsDraumo;u4ape mfciytfs2ulums;t0arenxf3oy1la e nvi;s s2toio ny1ame lfcils a2ur( p;t4olt mf3iytfa2uanmo t0alxnxf tytoaDrluvils)seurirpiodam nlies t) 2raxrpnu1tpt mf3iat sDeluvpnt)aexniocio1omtrlu ol(0s2urxr3iudll  mnctas)sDtaurp;o0oexn f3iydlm emumsn() rtomr3ia1op e nei;(0t2xr(mpiu1optn fct tfs2tm( pnu0oet mfetatfm2rl(vpn()tetoxr totlatr i o s srxmxo io1oltemfcsls  Dtr(mpot0opxomfetatlm2ranmo t) etnir iydomteln il()srtr(r ou1am   fvsl(f rum(mo;u0aexnmfctasls2eauvo;u0aetnio3oytlp rlnvi;() 2xmio3iy1alt  neslt)s2rrum no1tpxomi3ils sDrln s t0altoxocio1fa  an ilt  ruoim iudam nliciasfs2umu  nu0opx  icilsfaDeauvsnu0treoxf ootfa rln s ( trxrxmpoudapen net ()sDur(moou1apx  ictldla2rlu o;t4 lxrmo3ootlpDrli o s  etr(m ou4aptn ivtas)artmum ou0olt  oeild a umumon(0 lermr iatfa   neo (0setr(rpoy1aptnlfci t a2ur(ro;o4oexnmoetldfs2uln o;u0altnxrcty1op e uvo t  rtoim3oy1lpee fet tf 2tr(  oo0olen o3tat aDulnmonu4aeerxf3oytop  lu il()tetoio nodape mfctlsfsrumxr ;o4oeto i3ilslm ra( pn(4artoiociy1fat aueo s0setrio3ou4lmenmnvs sfaDrau oot4apen ociadls rm(vp () exoxo3oatop  aivo s trtr(mpnu1op n nei ( aDraumpou0ale mociyd a rl(ms (0aleoir oa1lmt auvo t0s2xmimpnu4am nmfctl(fsDtmumpoo0oltomoeiat m2rmnvp;(4teeomf3iadfa eauvs;t0t2uoxr oodamt licslt  Drmum oo1oeeomf3iadfmDel(mp t0 exrmocoydopt ln o t0seur(mpio1lm  lncsas s2ua(roou1oexomfeilsls2umuvo;t0 exoir ty1oa   uei;(  rurirpnudlptelnviltfa2um(rpot1aetn ietyd s2rmu s;t) lerifcoadoaD lu o s  rxoimpny1ome lnvtl(fsDtaxm ot0ole  octyd mDrm( s (4arxnxr3oo1omtr i olt)trtoim3no4am  lieia(fsrtrxm ot4apeoifctltlm eanmp;u4 lxnifcoodlmD aiei s) rxrim3iu4ap nmnesls s2ra(m nu1apt ifeilt a2umums t)trenxr3tatlatr ivil(0 2tm(m nydaltelnetl(  rrrxmooo1apeomoeiytls2ul(ms;u0aexoxo3ia1laD ln s t)trumxm oodomee fvsat)aDtaxm ;t0aleo ieiydfm2emuvs;t) lerirctydla eai i;( sexoxr nydomeelneta()a2trumonu4aex  i3iat s elu pn(0 exrmo iadlp e n il(  exr(opiy4ole  ncia(  rtrxm ;u0tle mi3taslmDra( ont4 rerxr3iatfm elneols)t2xr(r3iu1apenmnesl(fa2ta( pnu4oee iietltfsDuluvsnt0trxoxfcio1optrluvo;( trtoxmpoo4lpe liei tfs2rax pno0altoif3tlt m2eaums;u0 exnmrcio1lat aieil(0texo(mpio4lm  mnvs t)sDtmxrooo1tlxn feils m el(vpn(0aexoif oydoa  ln s ()srxm(m nydlmt livil()s2ua(rp;u0aeenmictldlmDrm( s;u)aeeomociatop ean slt0truriopno1op nlieilsf 2tax  oo1tpt mfctytfsDumu snu4alenir3todoatrluei (0 rxmxm ou4aleelieilt sDtr(  nt1tltnif3iadlm elnvs;u4texomfciydoatelieslt)srxmxm iu4olenlnvt tfarua(m ;u0aexo oeias m eln snu4texnmocty1laD  u o t)setmxopnu4amt  fcil(f 2ra( p;o4opx  f3tysfs2elu snu0aetoio3oadlmt auvs;( texr(r3ou4om  mivia(f Drrxrp;t0tptnmictls s2rl(vpn(0 rtrmo to1oaDraivi;(0trur(mpno4amte ncs (fsDraurpoo0texoiocilsfa2el(vsnu4alxnir3oodlpte u o s  2xmimpou1alenlivias a2rmxm no1apx iiciat sDrluvsnt) renio ty1fpD  ieils0 ruoxmpnydlptemfeiat a2taxm ot1alen fciydla2el(ms ()teermfcoytfaDeaues;t srxmiopnodamtnlics tfsrtr(mp;o0opxn o3iytfmDulu onu)aexnxf3oodoptelnvsls)t2xo(opoodopt mics (f Duaxmo;u1tlto feildls rauvo;(4tltomrctodfpD an s t0srum(o3oo1ol emneiltf 2rrxm oo1opt mfciaslm2emn snu)aexnmf3oy1lpDrln s;t0teurio3oy1am  mieilsfa2raxmp;o4aptn ictltlm2um(ms u)alxnxr oy1fmD luvils)t2xrxrpoydlpe mivsa( s2tmxmo;u4opx mf3iyt m ulnvo;u4trenmr ia1lpDrlueo s seumir3oy1lmtn nvsas  2tmum ;t1tltomfctydlsDuanvp u)altrmf3oa1fmDe ueol() etmimpio1ap e ivil(fsDumu o;u0olxnio3iydlm2uluvs u0artnio oodla eauvo (0tetrxr iu4amte net t)srrr( pno1tptn ictyslmDua(msnt4tetriocio1fp r u s (  2uoir nydopee fet tfaDtr(rp;o4aex mf3tldla2rmu s (0arermrctodoa rau ols0srtrir nydape mneta( s2rm(rp;u1tleomi3iyd sDeanmsnt)artrmr3todfat li ols0t2xoir3iydlm n fcslt sDuaum ot4tltnmociydfm2elnmon(4 reoir iytfpteaneo;s)tetrxm3oodome lnvtatfsrur(root4tltnmfcildfa2uauvpnu)texnir3iy1lm eluvslt)srxrxm3nu4olenmncils) rraumono4opxoiieiytlsDumu s;t0 eermf3oydfpDranvs;(0t2urxo3ou1omeelfcsls aDrau o;o1oet  o3iltlaDra( s;u4 ltoxf iydfptrln o;(0s2tmxo3oo1ol e fcsa(f 2ta(mp;u0alxomi3ilt mDrlums (0aetoio iy1oat au ilt0sruo(r nu4omt lfctas  2ua(rpot0tpto f3iys a2rm( pn(0trxnxfctadopDe uvols0 eumxm3oydoltn nci () 2rax  nu1oeeoifcias s raumsnt4 ltoxr iatoaDelueo t)t2uo(r ou4llenmncs (  2taurpnt1tpen f3iyd mDua(vsnt4texoiociotlpDe i i;t) rtoxo nudomt lfctas a2umxr nt4ale  ietad s2rau p;u)teerxrctydlmtraueo s0srtmxm3oodllee fvia( srtmu  nu1apeomo3iyslmDumu s u0trtnxocoatfaDranvs s) 2toim3iy1amtn nci () Dumxr oo4opxoii3iadfa2eaumo u4aeenmoctotfmD  i o;s0 rxr(r3iodaptnlivs s  Drmumonu1tetoifcildlmDeauvo (4altnxo3to1oa rau olt) exoxo ny1om   fcia( s2rrxrp;o4aptniietysfs2em(vs t4artnmf3iydopDr ues;t0t2toxm ou4lme lfciat) rtaurpno4optn i3tasfa2ul( snt)trtrmf3oa1laD  ivi s) rtmim nydamen ncils)artaurpnu4tle  i3ils m2ranvs;u0teenmfcta1opte neo;t)setmxo nu4ap n ictls arumu oou0tetnifeiyt m elump u0trenir3tydopte ivilt  ruoio3iy4lmtnlnvsas)a2trx poo4aeen oetytlm2ua(ms u) eenmoctytlmDe u i;(0trumxopnudlpeemivtl(fs2ta(monu0tex mietydfa2rmuvo (4texoif iy1op e neils  rur(o io1apeemfci s) 2umxront4tptnmieiys aDuanmo;()texrxf3oo1opDeln slt0s2trxrpnodaltnlieia()aDtau p;u1oeeo ieiyt a2emu snu0teerxocio1omtrluvil(0s2xrimpoy1opee nesa()a2umxmo;t1oetn iciad m em(von() eermrcty1laDr n i s sexr(o ny1lle lfvtas) 2tmxr ;o1alxo iciasfm elu pnu4altnxr3io1op elivs t setoir oodopt  iciat sDur(mo;t4aetniociatfs2elnvs u4alxrmocoodlmtrluvils  rtm(mpiodalt  ieiat)s2ur( pnt0altnmo3iytfmDrlnmo;(0 rermo tadlaDeaieo s setoxm3oo1ale mivil(  2uax o;u4tpx ifeiad aDem( s u0 etomo iodop elieil(0texoxrpiu4ole lietat)arra(  ;u0altomoctad mDel(mpnu0tltrxf oy1omt  ivols  ruoxmpio1ale lieta()s2umur ;u4oltomfeiatla ua(vs (0tltoir todoptr nvs ( trxrxrpio4op n fvils a2trxro;o0oleoiictldlm2em(vs t4tetoxfciytom eaivs;( sexrirpou1llenlivils)srrm(m ;o4tet  octys mDrluvs;u) rtrxr oy1omD lnvs;s) 2umimpoudoptnmnvil()sDtrumo;t1apxo fetad mDean o u0arerxfcoatfm e nesl( trto(r3oy1lmtemncs t s2urum oo4aex  oeiasfm rmn p (0 reoxf3ty1fptr nvs (0t2tm(mpoodaltemfcias aDtmumo;u0oee  oetldfmDeaums t4 rermo oadlp e n o;s0s2urir ny4ol  lfvsl( sruru p;o4tlenioeiadfa emu onu)aeerxrcoa1faD lu o;t)s2urio oy1op nlnvs (f rtrxr nt0alt io3iat a2ea(mpnt0 exnmo todomDrauvolt sexmir3ou4al   nvsas aDrm(r ;o0olxn ictldlsDrln ont)tetrxf to1fa r uvs (0teurxo nu4ape  icils a2tmump;o4tle ioetldlaDuauvsnt)aleoxfciatlatelnes s trur(opiu1ol nliciat) Drmu  nu0tee io3iadfa2rmnmo t0tlxrmo iatlm raueil(0s2tmxopoo1optemncslt)srtaxr ot0oet iociytlmDra(mo;u0 rtnir3ia1lp r uvs;(  rxmim ny4ape micsltfaDuau onu4tltniieias mDrlumpnt)trenxr3oydomDe uvi s seumiopnudlp nmfvsas aDta(  ;t1tptniictasfs2umnvs;u)altomr3totlmDeaneols  etmirpnydaltemfeiat) 2ua(m ;u0alenioeiatfm uau s (0aetrxrcoodoa   i sl( s2toxo iu1lp elivsasf Dtmu  no1oexn ieiyt s2ulnvon(4 exoifcia1lptr neil( teuoxo no4lm elnvi s  2tm(mono1tpxnii3iyd mDuluvpn()arenxr3oatfmt au s t0 2xo(o3iu4ap e icil(f 2rm( p;u4aet mo3iat s el(mo u0tetnxo iotlp   nvo;t  2uoio3oy4ap  mfet s)artmxro;o4oee  f3ias sDumuvsn()tlxrmr3tatopt  ueo s0 rto(m3oo4ope  fvtl(fs2raxm ot0alx  ietat a2ea(mp;(0altoir oydlptrli sl( s2urim oydlp n nvilsf ruaumono4aexomf3tyt a2umnvp u4aexoxf iydopDrliei s seumim oy1apt  ivsa( s2rm(mpot0tleomietldla2el(mo;()trxnircta1lp e neslt t2ur(r iy1lmenlfct (f 2um(moot0oeeomoeiaslm2emumonu0 lermociotlm eau sls0texm(r oudlmen iei tfa2ua(mp;o0aexniocias s ran o;t) ltnxf ia1la  lnesls0sexr(m3iu4ll  mnvs ()artrur no1tpx ioeiydlsDeaumont) renxr iatla  au il(0sruoxmpny1omtemfct s) 2rr(rpnt4tpx ifcilsla uanvp () ltrxr3todlpDeaues;(0srur(opiy4lmtn nesas)srtrxrpnt1ale ii3iydla2ulu o;t4 eerircoodlmt aivs;t trtr(m io4ll nlivtlt)aDrr(m no1opxnioeiat m2ul(mpnt4treoxo3ta1fptean o s0s2tmim ou4lpt lnct ( srrm(  nu1apeomoeiltla2eanvp;t4 rermf3oytlaDe nvolt  euoir3nudoltnmietas  Dtrumono0aex  fetlsfa2rm( p;t4teeomf tytom r ivs;t0trumio3ny1lpen fcsl(faDum(mpoo1tetniietat s elnmo;u)alxnmocty1faD  u sls srtm(o3ny4oleemivtasfsrtmurpnt4alto feias s2eau o;()aetrifciy1la rlivs (0trurirpno1alen feilt)sDtrump;u0olen ieilt s2rl( s;u) eermociatfa  an sl( t2umim oodal e ici sf Dtmxmoou1altoifcils a rmuvont4aetoio3oodoa   u s;(0t2urxm iu1lmenlfvi s)s2ra(mont4tlto iciydls emnmsnt4 rxomf tatopDe i sl(0 2urim3iy4ape  iesl()aDur(r ;t4tleniieils m umnms;u4teermf ta1opDeanei;s s2uoxmpoydameelies (fsrrr(roou0tleomietysls ul( o;t)arxrxo3ia1fa rliesls0srumirpnu1ap emivt sfsDrm(ro;t0altnmoctlsfs rmump;u0texomr totopDran ols0 2xmim iu4lp   nvtlt  Dtm(rpot1aptnmf3iyt a2ua( s;t0artnmf tatoaD au i t) eumir nydalenlnct t  rraxm ou4tltnmfetasfs ea( s;u4tlxomo tadlaD  ivi t0s2xoxr3oo1al elfvt t sDra( ont4olto ieils s ulums u)alenir iydfmte nesls0 2umxm oodlpt mivta(f 2ra( pou4apxnif3tyd m2rlu s;u4 etomfciodoa  li o (  2trir nu4ll   fvt (  2rm(r ;t4apenmfcils s2ranvo;t0tlxrxf3oa1opD au i ( texoimpno4ll nlivs (f 2urumpou4oeeoii3ils a2ulnvsn()trxnxocta1lp elu s ()srxm(m iu1ap elicil( a2tm(r nt0olxnio3tadfm ea( s (4areoxfcoydoaDe ivi;t0s2toxo iydapt mfet sfs2ua(moou4oleo feiltfsDeaums u4alxoxo3iydlm elieilt  exmxrpou4opte nesa(fa2trx p;t4oexomoeiysla2emumsnu4 rermo3iy1fa r u sls trxm(m io4lm elncs t arrmurono4alxoif3tysfa2ea( snu4trxoxocoa1fpt anvs;t sexmir3io4lpt lnvtls srua(rpou4texomfeilt a2um(vonu)tlxnxr oodomteaieo;t0 2umimpoydamte icils artr(mooo0ape mo3iltfsDulnmpnt4trerio oo1fmtelneo (0s2xrio oy4omt  ncta()arurur oo4tpeomo3tldlm2rlnmp t4aetomociadop eau s s seuoirpou4ale  ncia()srrr(mpot0tpeoif3ilt mDumu o (0aexrxo3tatfp rlnes () 2to(o iu1amt mfvt ()aDtau pot0alenio3iat sDrl(mo;t4tltoif3ootoaDelu i t)truoiopno1lpen ncs t arta(mont1aetn o3iytfmDrlu s u)trxoio3to1omtrln sls teumio3oydll n nvi t)a2tmuro;t1oetoifetaslmDuaumpnt) lxnxr oy1oaDeaivo s) ruoxmpoodape  nct s sDur( ooo0ale mietysfmDemn sn()arerxr tadfmDrli i (0 eumxm ny1ap e nvsa(fsDururo;u4apxoiociyslaDua(vpn() rtnmo3oydlatr uvo ()setm(rpou1apen fci sf rrr(r ;t4ole  ieiysfm em( onu) rtrxr ootlaDrln o t0s2to(o oudoptelnvsa(fa2rr(ro;t4opx iicildla2rl(vont4trtnmo3tadlpD  ues t t2tmxmpiu4ale lnetl(fsrurxmpou1aetn icildla raums;t)alerxo iotlate nvol()trxrxm oy1am nmnvilt)srrm(mo;o1tpe  ietyd a2ul(mp (0 etomf3oydoa  aneo;t)texmxr oydape licsltfsrum( ooo0tee  o3ild s2ea(vp u4aetnmocto1lpDeluvs s s2tm(rpoo4lp nlfcsl(  2tr(mooo4ope  fciadfs em( s;u0tltoxr3iy1fateanvilt0teumxrpiydapte ncta(faDrr(mont0tetnio3ils sDeauvonu0aleoioctydfa r iei;s)s2toxo oo1optnmici (fsDtrxmpnu1oexoio3iltlmDul(ms t4tetnmo3oy1fa e neslt)t2xoxo iu1alt  iesa()arua(mont4tex mocilslmDelnmp t4 eerio tatop  lies;s)trtm(r3oo4open fvsas  Dtm( poo1aet mo3iatla2rlnmp t0 leoxo3ia1omD lnvi;()s2xmio3ny4apee fcs sf Durxrpno0oetn o3ias a umnvs (0trtnif3ta1lmD lneo () rurir iudoleemfet t)aDrm(m ;t0apeo fctydfm2emuvs t4altnmo tadla r uvi s0 rtmio oo1ol nmfcia() Dtr(m oo0ape  f3iytfs uanvo;t)tetnif3oodfpDraues;t)trtoxr nudoltelfcs () rta(monu0tpxn fcilsfm uluvs;u4aetrxo iadlm ran o ( setoir3oy4ole mfetas)a2ua(r oo4tpe ii3iyd a ranms;t0aeermo3ootomDelnvs t s2xrir3ny4amtnliesas  rtmxr ot0alxnmfciltla2uanms u4 ltrifcoodlmDr nvs s0tetoirpny4ope  iesl(  2urx  no4oeen o3iltlsDrmnvp;t0 ltoxociodlmDrln i;()t2xmirpou1omenmfciltf Dtaur oo0alxomi3iadfa2ra(mp;t4trermocoodopD anvs;t trxr(r ny1ale lieias  rua( pnu1aeen f3iytfa ran s;u4tlenir3oo1omtr i o s0setmxm ny4om nmfcslt srua( pou0olt  ociat s2ea( o t)trxoxr tydomteauvs ()srtmxo io1lpenlfcs t)s2rru  ;u4tpe iiciys sDua( o u)trtrmfcoadlmtraueol( t2umxo3oodll emneslt sDtr(rpno1aeenmfctld m2ea(mo (0arxnmf3tydoaDelivilt srxoxr3oy4ll  mieslt aDrr( pnu4optn i3ildfsDrlnmp u0 rxrxfciydlmt  nvslt)texmir iydop  mnct (fsDrm(mpnt1alt  fciatfa2umu s;u)tlxnmfcta1la   ues;() 2to(o3oy4ll emncia() 2tr(mono4apenifcildfs elnvp t4 etrirctatfm   nei s0srto(r3iudlp   icsasf Duru  nt0teenmo3tytlsDrl(ms (4 eerif3oo1lmDrlivsl(0 rtrio iu1lme lfcils  2ra( o;u4opt if3tld sDraumpn(4alermrcio1fp r ues ( t2tmio oydaptelfetat)sDurxrono1tlx  oetyslmDelumpn()aleomrcoytfpD  nvo;() rumxm3nydom  licia(faruru  ;o4opxo o3ils a2umn on(4 etomfcoytlpD aueslt0tetoirpoodam e ncsl(f 2tmur no1tlx  i3ilslsDul(vp;t)trtomr3totfaD anesl(0texoxo oy4oltnmnvsltfaDrmumpou0oet ifetysfa2rm( pn()trenifciotoa eauvs;(0srxoiopoo1aleemivtasfaDua(  ou0aeenio3tldlmDem( pnt4tltrif oadoaD  uvs () ruoir3ny1op  mict t) rtmu pou4tet if3tlsls uanvsnt4 eermr ta1om e ueo;s) exmxmpny1lp nmneslsf Dumump;u4tpt mfctasfa elu pn(4trtomrcio1om   i sl()setr(o3io4lmt  nciat)aDtaurp;u0aee micilslmDum(ms (0altoio oytla   uvsl(0trurirpoydomtn ietls aDuaxronu4alt moctysla2ea( s;u4tlxrxf3to1omDr u ilt  ruo(m oy4am n fvtl()a2tauroot0teeo feiyt m ra( s t0texnif todfmt aieolt)texo(r3iodomtn feiltfs2umx  ;t0aet ii3tyt m2ua(mo u4 exoir oa1lmtr i s s  rxr(opiodomtnmnvt ( arumxm nt0oee mfciltlm um(msnu0artoxrcia1lptelieo;()srtr(m io1ll emfcslsfarrrxm nu4tetn ieildls2uauvp (0 ltriocoytomDeaieilt t2xmiopnydale  fesat)a2umumpou4opt moeiydla2eln p t) ltnirctatomDeaneo;t0s2xmxm3iodamtnmfci t)srraurp;u4tltnioeild m rmnmp t)altoxf ta1lm elu sl()teumir oo1omtnlictat a2taxr ou1alenmoetad a uan snu)tlxnxocoa1fpt liei s)srur(rpou1llt lnvtlt)sDtmx poo1alxoifeias s2umn o u0teeoxo oytfatelueo (0srtr(m ou4aptelnetlt sDraum ou1aex if3iys m2rmump u0trenif oatfa  aueo s tetrio oydope mneiat arumum ;u0tltnifctadlaDemnms;u0 eeomocty1fpD anei;s)tetoxr iy4altnlneiatf Dtr(  ;t1tleoioeilsfm emuvpn(4arerif ty1lptranvs;t0tetmxm no1lm  lfvi t)srtrum no4aexomieild m ua( s u4arxrir3oytlmDeln s s  euoimpny1ale lnct s)s2ua(m ;t4tle mictldfsDel( o u0artrxf oadfmDraneo;s0 2xrxo iudlmte ivt () 2tm(roou0oexo o3tytlm rl(mpnt4 leoxo ootfmDeaivils)t2trir nu4al   nct s) rum(mooo0olt ioetyd a rm(vp ()trenxocia1lmD  nvo;()t2xo(rpoodopenlfvsat  rtrumpnu0oexn feiad mDran s;u0arenxf oodopDr nes;t  rxm(o nydol   fet ( s2rrx ooo1alenmo3tyd a uau on()teermr todlmD  ueo s)trtmxo3oy4olen icsltfsDurxr no4tet  o3iasls2emumon() etnxociotom  anei;s  eur(rpny1omtelfvtlt artrxrono0apeoiocils sDeanvs (0alxrirciodlm  livs;s  euoimpiodomte nvs tf rrauroou0oleoiociatls elnms u0 rerif ta1lmt lueo;s srumim3ny1altn fvtlt)aDuax pnu0ale mfetys a eauvo;u)arxrmr3iadfm   uvsl(0srtrimpio4lm nlict (f Drrx pot4ope if3iltla raumo t0treoxrciodfaDelu s;s  2trimpou1ome  ictlsf 2um( pno0tltoioetasfm2eanvo (0aetoxrctytla   uvi ( srtmiopoy1omtelfvsa( s2ua(mpot4opxo icildfm2ra(msnt0trtrmfcty1lpD li i;t0teuoxopou4lpee fvi ()srta( o;t1alen oetadfm2el(vo (4tltnxfcoy1lp   uvol() exrir nu1lle licias) Drr(root0apeoii3iatfa2eau p u)altoxo3tytomD lu s;s0srxmxo3ou1lm  mnesltfa2raxrpoo1oleo feiadfsDeanms;(4trxnmf oa1lm ranvi;()tetr(m no1alee fcsas a2uaurp;t0apxo octldfsDra( p u4trxnxfcty1oaDr u ol(0 ruoxrpny4lp emncs (fs2tauro;u0tee ifctyslaDulnmpnt)aetoio3tadfaDeanvolt sexr(o iodlltnlneslt  rumx o;t0alxoii3iytfa eanvonu4aetoio3tadfm rau o t0 rxoim3nudlptnmivsatfsDtrur nt0apen ociatlm ulnmsnt4arxniociytfpDeanvo;t srtrimpiy1apen nei s) 2urxm ;u4oltniicild s ea( s;t)arerio iytlpDeau ils0srumxm3oodomte fcilt)aDua(m nt4alxnmo3tytla2raums u0altrif3oy1opt liesl( s2to(r oydlltnlnvtlt  2ua( p;u4alenif3tytfs2ul(mo t0tltnif oo1omtr i slt) eum(r iudlpt lfctat a2rax pno1apx ii3ild a2rauvo;u0 rxomf iatfpDrlneslt0trxm(mpnodole mncta( srrmx p;t4olx ifciasla2el( s t4aexrmo iotoaDeauei (0srtmxo ny4alenlivils  Duax o;u4oexn ocildfm uanvo t)aetrmrctotfatr i o;( t2to(rpnu4opte ncsas)srrmx ont0oetomfetatfsDeanmo (0aeerxr tydlaD  neo;s s2xrxm3nydlpeelfeias)srraxmooo4teen ieiasfm ua(ms;u4 etrmr3tydopDeanei ( t2um(mpoydlltemivt t) 2umxronu4olenmfcias aDea(mo;(0aeeoxoctotopD  nvol( t2umim3ny4ole lfei t a2raurp;t1tlx  icilsfsDuanmpnt)texrmo3oatomDr nvo;s)setmirpnodalee feil() 2urx o;u0aetoifetat s ean snu4 rxrxf totfmD livi;t  rtrxopio4op nlfesatf rumurpno0oet mfeiytlsDumn ont0aetrir iadlm ranesls trum(rpou1al emneias  Drauro;o4olx  iciasls rl(mpnt)texnxocootfmD anvs;s0trxrxr3iy1lm e iesl(  rurxr no4teen octld aDeaums;u0arenxo3oytoa elu i (0s2trxr3ny1ol e fct sf 2taumpoo0tee  fciatfs2el( s t4trxrxrcty1lat aueo ()t2xriopiydlp nlfcs t)aDtm(  nt4opeomi3tad s raumont0 renmf3oy1oa rliei ()texoxr iydom  mncsas) Drmx pnu0oltomo3tls m2ul(vont) rxoxo3oy1opt  u i t trxm(opno1am n fvs s srtmumo;u1aleomo3tasfm2emn pnu4 exriocta1fa eaieo ( tetoxo3iy4amtn nvsasfsDuax p;u1aptoii3tas mDum(von()trtrio iatlp rau i t)t2xr(m ny1lptnmivil( arra(rpou1apxnmietldla2ul(mp (4 etoxf tatfat  ivi;t0 rxm(r3ou4aptemiei (  Dumum ;u0tex  f3iydls ul( pn(0aetrmo oy1la elu s;t tetrxopiu1olte nesls) Dtaumpnu4tpx iicilslm2ranmpnt4artnmr3iydlateaiesls t2xriopoodlm  mnvslt  rurx pnt0tet mf3tysla ra(vo;(0trtrmo ty1fmte uvilt) rxoxrpio1amtnmfvs sfa2ur(mpno0tlxnmfciltla emn ont0aexrxr3tydfm e ueo;t) eurxopiu4lp e ivtas)s2trump;u4oeeoiociytfsDuln pnu)trtrir iodfa eai i s)srxoirpoo1ale  fcs s aDurur nt1tpeomfeilsla2rau p;t0areomo iodfpDr ieo t0t2xo(o iydlp  lieils)aDta(m no4apxoio3iltfa rauvs (0trxnif3oydoaD  ies;(  rumxm no4lptemncsls)aDtax  ot1altnmfetlt aDra(vsnu) etrmr oy1fmt ai o;()teurirpoo4om n nvia(fsDurur ;t4olxn fciydfs rauvo t) rtnxr3ty1oat lues;()tetrxm iudlmen nei t  2umu ono4aet mf3iytfsDeau on(0trxoio iadla e iei;s)s2urxmpny4llteliesl(  rtm(m ot1oeeoii3iysfm2elnmont0tltnmo to1lpteanvils)srxmio nodlm n fcsl() rur(r oo0tlen ieild s emuvsn(0trxrxf3iy1laD  uvs;s trtoxrpiy1ap  mneta(  rua(mp;u4altn i3ild aDum(mo;t0areoifciodlpDe ieo;s t2xoxr iu4alen ncilt arraurpou1alenio3iyt aDrmump;(4artnmfcoa1faDrlues (0trurirpou4om nlfci t  2tr( pnt4tlxnmfeiatfaDra( p;u0 reomo3iydoa rln o t0trxoxrpnydol n fesa()aDraxm ;t4apx mieiysfa2el(vp;u)arxomfctytfat ln i;s sexmimpnodamtnmfes (  rtmxmonu0aptnifeiadls2el(ms t4 etnxf tatlpDelnes s srumxo3oy1open ictltfs2trumpot0tlt  fctaslaDelnmon(0arxnxfcoydop rau o t) 2um(rpou4ol  mfcia( a2urxmpnt1tle mfeiasfs em( snu0tlxomfcoadlmtran sl()trxoxr iudlle mfviat  Dtru oot1olxomoeilsfm2rmumsnt4aeerxrctadfa e ivo (0texm(m nu1oleelivt tfarrrump;u0tlxoifcias a2ea( p ()arxrmr3iotlp elivo s0s2xmxmpoy1lp e fctlsfa2rrxrpou1tptnio3iysfaDua(vp t0areoirciadlm e n s;t0sexmir3iy1ap emnvsl(  rur( p;o0aptn ocildfaDean p u0aeenxr3oatfat aieo s0 rxr(opno1om  mfeil()arra(m oo0oexomfeiydfa2emuvp;(4 ltoxf tydfpDe ivs;(0 exoio3ny1apte feilsfs2tr(r ou1oex mfciadlm2eluvpn(0 rxoxf3tatlaD lneilt)s2xmxopnudaptnmnei s)srrau p;t4oex iicildla ranvsnu)arermociadoptrlu s t trtoxm3iu4aptelnct () Dtrumono1tptoiociydlm2ulnmo;u4aeerif io1oatrlueo ( t2toxo3ny4am nmnetasfs2ra(rpoo0aptnmo3tadfa uanvp;()texrirciatfpDeau ols0trtrirpoudope lfvilt  rum(m nu0opeo o3tys aDelu ont)aexnxo iytfmtrlueils) etoirpoo4op  mfcils  Dum(r nt1tlx mf3tltfmDeanmo;()aexoifcoy1la  au s t seur(rpny4amtnmfctasfsruaxmpoo0olx ifciysfm ua(vpn(0trxoxf3oy1fmt aieo t) 2urimpiu1apt mietl( sDurum ;u4aee  ociys m ea( snu4trtnmr iotop r nvolt) rxm(m iu1lleeliviasf rraxrpot0olenmfcild mDeanmo u0 lenmfcoydlp eaneil(  ruo(m nu4ame mfet s) Drmumoou0aex mf3iys m ra(vsnt)texnmr3iydfm   iei s srtm(mpio4omenmivsas)sruaurpnt4aeto ieiysfsDuluvsnt0tlxniocootlat auei;s  2uo(r3ou4omtn fvtas srurur ;o1oeen ieiyt a2ulumont)altnmrcoadfmDeaieols)s2xo(m nu4ll   ict (  2ra(mo;u4alto fetatls2uaumsn(4alxrxr3iadlp eln o;(  etr(o iydalenlicilt)a2ra(  ot0tpxn fctltfa2rl(ms () etrifciodlp rluvo s0 etmio oydlmte nctasfartmx  ot4oeto f3tytls umu onu4alermr oo1oaDranvs ( t2urio3oudoltn ivt ()sDtmxmp;o0aee mfetydfsDrm(mo;u0aexnmf3iy1fmD ln ols) euoir ou1lpenlncia( arurxro;o0aetoif3iydls eauvsnu4 exomociytlpte ies s seurio nydamtnmicsls)a2tm(root0tet ioeiad m2ra( p t4trtoxr io1fmDelnvs ()sexoimpnu4lleemnvias  ruaxmpoo0alx  oeiytla eanvpnu0tlxrmf3todfm eluvi;t tetr(r3no1olee fes t) rtmxmo;t4tpe  o3tys mDrmuvp t4tlxnir iotlmD  uei s t2xo(o3io4llt mnci t  Drax  no4aexn oeiysfa ulump ()tlxrmociydla e i i;t)trtmim iy4olee icta(f Dtrumpno1optn oeilsls rauvp;u0alxnxr oadla  liei;t)s2tr(m iy4amtnlfvi tf Dtau oot0opx mfciytlaDra(monu0teeoir iotfateauvol() exmxmpiu1apt lnciasfsrtm(r ot4oeeniocias s2emu pnt0tlxomo oydom elieslt0srur(m3oy4ll emncsas  rrmxmp;t4opxnioetaslsDuanvo u0 renxociy1opDraies;s)srtm(r iydapen ncs s  2trx p;o0alxn oeiadlm ran ont0tltnxf3iatlm rli il( setrxo3ny4lmtemnetatfs2trx oot0olxomf3iat aDel( o;u4texnmfciadlm r u o;s) rtmirpou1om nmict ( arumxmpou0apxomiciat s eluvo;u)tlxrmr totlmD ai ilt  euoir iodlptnlfvilsfa2rrurp;o0oexn ociys s rauvp u4 exnmo tytfmDeauei;t s2tm(opiy1optemivsl()a2tax p;t4olxnio3tltlaDelnmon(0trenxo3iatopDelivsls0texmxopio1opee ics s) rumu onu1optnmoetytfm uln o;(4trxnmf3oadfpDrlu o;t trxrio nu1ap emnci t  rumur nu4tle  i3tltfa2ea( p u)altrxrcoodfm  li i;s) 2xm(mpiudapeelietl(  Dtru o;o4oetoifctltls ra(vp;t) exoifciotopDr ueils)s2uo(o oy4om  lneiltfsDtmu o;o4alx mo3tlslaDuau o;u4tlxoif iy1oate uei ()s2xm(rpoy1op e icsl()srrrur ou1oee iictys s2ua(vpnu) renmrcoo1fmtrau sl()teuoimpnydlp elfcsl()sDurum ;t0apeoiietas a ulu o;t0arxnmr ootfatr ieols)srtm(m3nudll e fciat)arum(  ou4tetnifciat mDel(mpn(4trtoif3iatfmDeaueo s trur(o oo1optemietl(  Dtax o;o4texomocilt s2rauvo t4trenxr3todop e i ils  rtrim3ny4alte nes sf rta( ooo4apenmiciydfs2rl( snt4tltomfctatlaDraieslt0 2xoim no4op nlfcta( s2ra(r no0tlx  i3ils s2rmnmo t4trenmo3ta1fmt  ues ()trurimpio4omtn fvilsfsrrruroou4tpx  ietasfa2em( s u)aexomrciotopDelu s;( t2tm(m oodal  lnvt sf Dur(mo;t0ape  fcilt m2um(vpnt4aetrmr oydlptrln s (  rtrim3iy4llt lfvs () 2uaxrpnt4optnioetytls umnms;t4tlerxrciadoptrauvslt0 etm(m oudlpe mneia() Dtr(mo;t1opt iicilt m umums;(0arxomo3iatomt ai ols tetoir3oydolt  fetl()a2ra(mpnt1apto ieiadfaDrm(mon()artrir oa1faDe nvi t0 2xm(r3iy1omeelieslsfsDtrur nt4tlto ictat s2ea(mp;u4aeerxo3oo1omDelueo;() rtrio nu1op n fct ( aDtaurpou1alt mi3ilsfsDea( o;(4 eenmr3iytoat lieo s  rtmio iy4lptn nvslsfs2taur nu4apxnio3iysfmDra(mpn(4alxnxf3tytoaDelnvi ( seum(r no4lmtn ivi () rurx p;o4teeoioctytfsDel(ms t)trtrxociydoa rluesls0srxr(m nu4aptemict (fa2rm(rpnu0oexo fctydfa2eau o ()tetriocta1opDr nei;() etr(o io4alen fctat artmx  ;t1apx io3iyd a2rmnvonu4tetnmf iy1fmteaneo;(0sruo(opiodlle lnesls)sDra(mpno4oexn ociytlaDranmsnt4 lerxo3tydfp elivs ()sexmirpny4lltnmnesl( s2rrxmo;o4oexniicildfa2ulumo (4tlxnxo3totlaDrli s s)truoiopiu4op nlnvils)sDtau pno1open o3tyd mDumnmpnt4teeomr3tadla e iei ()s2um(r nudale mfci sfsrur(mont1aex moetldlm umnvo t)tlerir3iotfpDeaivi;s)trurxo3oudlp   fviat) rurx o;t4ape  icildla2el(mpn()areoxo3oatoaD lnvilt) rtoio oudlm emneias sDtmxm oo4tet iociysfm2ran snu0 etrmrcoadlaD an i;s)s2xoio3oo4omee nesls) Duaxrp;u1tpxomfeilt a2eln o;(0aeeoifcoatfmDr ivi t)trxoirpoydom e ieil(f rur(r ;t4altoiociaslmDem( p;u) ltoxf3tadomD au s;t s2tmir3oudolen fctlt  ruax pno1tee if3iyslsDuau pnu0altoio oytomtr u i;s0 exmxm3iu1lmt mfcs ()sDrr(rpou0texomfeiys a rm( s;u4aexrir3to1omD aies s  rtoxmpoy4ap eliei (faDtrxr ot0altn ociyd s ranvp t4 lxrifctytfpDr ivol(  2toxo3oo4amt lnetat)aDtm(rpno0oee mf3iasfmDelu onu)tlxrxo todlpt  nei;s)s2umxo oy4ap nmnet ()srtmx poo0aptnmfcias mDumu onu)texriociatoateaies s0teur(m nodal n fvi ( s2rrxmooo1tet mfetat m2rmumpnu4 reoxo tydfmteanvsl( t2tm(mpnu4altn ivt s)sDra(  nt1texnif3ias aDemuvsnu) lenmfciytlatrluvs;t) eurimpoo1apte fvi ()s2rrurpnt1tpen fctasfs ran p u)tetnio iodla eluvi;s)trxrirpnydamt  fvias sDtmu oou4tlxo i3ilslmDemnvs (0 lerxr3oadomDeluvo;(0 rto(o3io1lmenlicilt  rtm(mpno1optnmo3iaslm2uauvp;() rxoir tydomtraues;()t2toirpny4llenlnvsls)aDum(  oo1open ocilslmDelumpnu) rtoio3io1lmte uvs;() euo(m3nydope  fcilsfs2ta(mpnt1opxoioctatfa ua(msnu0areomf3io1fateaneilt0setmxm ou1altemies s artru p;o4tex micild a ra(vsn(0tltrmo to1fpDr neil(  rxm(r3oo4ol nliet tfaDtaxmo;o4alxniictatla emumo ()altrif3todom  li ol( texmxmpio1lp elfvils)srrr(  oo1ole  oetatfs eau p;t) rtrmrcoytlm   neo;(0 2xmir nodop   ietls artr(  ;o1openmfciadlmDrlnvp u4 lxoxocoydfpD aueils) rur(opno4lmt lnct t  2uaurono4apeoifeiysfm ea(vp t)trxnio3iydfa e u sls t2trxm3iudame  fet ()srtaumpnt0teeo iciyslm2rau sn() etrir iytomDrluvo;()sexr(opiudlp  mivslt)artaurono0tptn i3tatls uanmsnt) leomf oa1fa eli i;s)srtmim3nydolt lnciltfa2rr(rpnt0apxnmicildlm2el(vo;t)trxrifctatom   ivs s0texoxo3oo1op n nvta( aDumum ot4aexniociat s2elumsn(4 lxrxr3tydlmtrauvo;(0srumir io4lltn ncsat  Duax o;u0oeenmociatlsDrm( p;t0 lxrmf totfmtelu o t)trtoxr3iu4om  livi t  Dtmu oot4aee ioeiyt sDrmnvs t4 exoxf iy1fmDrlieo;s)trtmxm iudlpt lictl(f 2taumo;u1openmictys a ul(msn()arenxr oatomt  nei;s seum(o iy1lle lnci t) 2umxm ot4oee mf3ild m elnvo;t0 renir totfmDeauvs (0t2tmio3iu4altnmfcilt)aDrax onu0alenmo3ilt a2rl(vsn()trxnio3io1laDrlies;t)sexm(o3nydopte feiltfa2ur(  ot4oexnifctys sDeau p (0aetoioctatopDr nvo s0t2xm(r3iodlp elfvtatf 2um(rono1tpeo fciat aDul( pn(0aetrxfciatomDe uvo t0sexoir ou1amenlfcsas)aDrrxmonu0olxomf3iatfm umu o;(0alerio3oatla  aneil(0 rum(r3iy1op   fvia(fa2um( poo1tleniiciatla ul( s t0aeerxf3tydlpt  neo;s) eumim iudapeemfesls  ruauro;o1tltnifeiyt m eaumsnt) lerxr iytom r ieo;s  euoir oo1aptnmnesasfsDuru pnu4ape io3iysfm eln o;(0 rtoxfctadlp  luvsls) euo(m nodlptn ivil()a2rax  no0aetomoeiadls2raumo () ltriocoodlmt auei;t  rtmirpiydopee ictl()aDtr(mont0tet mictlsfmDea(ms;(4 leoifcoydopt liei;(0 rtmim3ny1llenlfcia()arururp;o4apto ieiydfm uau s;t4trtrmf oy1lmt aivo (0setr(mpoy4amtn ivilsfaDtrx pnu1apt if3ild mDraumpnt0texomo3ia1laDr nei;(0 etmim oudoltemnvt sf Dtrxmp;u1tetn oetad s2ul( sn(0altomf3tadlpt lnvol(0s2umxmpno1amenmics s srtr(r ;t1tee mfciyd mDelnmo;u4trermo ia1fmDeai sls0seumio nydlpt mfvi sfs2umxroou1tpenmo3iatls uaumsnt)aleoxo iotoa e uvi;t srumir oudol n iet t) 2ta(moou4tlxoif3tas aDulnmp t) exoxo ta1fa  luvs (0sexr(m3oo4optn fes sfarumum ot1oleo oeiysfm rmn s t0altoio iodfp   nes (  2toxrpnydll elfciasf ruaxrpno1apeo i3tys a2eluvpnu) etomo todlpDeaivilt0srtrxr io1oltemivsas a2tauro;o0ale mo3ilslsDem(vo;u4tltnxo oy1om  lnvi;t tetmio io1al elietls)s2ta(mo;o0optnmfciltla2ea( o u0arenir ootopDr uvs;(0tetrimpoy1lp nlfeilt) rraur oo0oeenii3tlslm ul(ms t4treomf ta1om eanvol(0 eumim3oy4omenlfvil()aDtaumpoo0tet io3iad m rlump u0tlxnmfcoy1om   nes;t)texoxmpny4lltnlnci sfartru  nu1aleoifeildlsDelums;t4tetnxfcty1om  au o;s  2xmiopio4lmt mnviatfsrumuro;t4openmfciyslaDrmnvs;u0 rxomo tytlmt au o t srtrirpiu1op  mnvs ()s2ta(monu0oee iociatfsDra(msnu0artoxfcta1oatrauvs;( t2trim3io1lmt livilsfaDur(mpnu4aleomi3iaslm2rauvp u0 ltrmfcoatom  au s t)srto(rpiu4lle micta() rtaump;u4apt ioeiad a2uanvpnu) eerxf iatop  aieo t)t2uo(m3oo4apen nvtltfs2ra(mp;u1tee mietldlm um(mp u0aeerir tydomDr iei;s) eumxo3iydlmt  net t srtm(m ;t1apt mf3iyt a um(ms;t4trermr io1oa e i o () etmxm io4lp   neil(  2urumooo4texo octysfa em(vpnu4 ltoxr3iodfaDranei;t  exmir ny4amtnmieia(fs2rrxmp;u1texo ieiad s2uluvp;(0aetnifciydfmD auvs;t0srto(m3ny4llte nvias  rrmumoou0tpxo ociasls2eau p;t0artoxf iodlp  an i;(0 ruoim oy1omeelicta( sDuaumoot4tltomfeiadfs uanmp;u)tltrmfctotlaDr ivolt  2umim3oo4omt  ieia(fa2tmxronu1tpenmoctltlmDem(vonu) etnxr iytfp  lnei s0teum(o ny4omtnmfcsl(faDrmxroou1opxoif3ilslmDumnvonu)artomfciatoa r u il(0trtmxrpoy4lp elfci tfsDtrumo;t0tpxnmi3tadlsDel(ms;u4alxnir3oo1lm eaivo s  2xr(mpoudal  mici (  2ra(mo;t1opx mf3iasfm el(mpnt0 lenmr todlp  an i t0s2tr(m3iu4am   fvs tfa2ur(r nt0oetn feilslm ulnms u0teenifcootopD  n i;t0 rumxm3no1ome mivt (  2umur ;o1apx  fciydfa2ran p;t)alxrxr tydla ranes;t0 2urim no1ll n fctas artmuro;u4ape mf3iydls ul(ms t)aexnio3oadlpDraues s0s2xm(o iydom n icslsf 2ra(ront1tptnmiciys m rln o;(0arxomo ty1oa   u il() rtmxopoudomeemfvtl()aDtmx p;u4tlx mictlt m2ua( p;u4arerxr iytom ranvols)tetr(r3ny4optnmivia()aDumu o;o1altn fciat sDua(vp;(4tlxoxo oy1la eauvolt  2toim nodlmtelfesatfsrrmx ono1optoioetlsfaDua(vpn(0aetoxr oa1lptrlieo;t texoir nydlpee nvtasfaDrmx o;u1ale mfciad sDemnvs;(0 leoir oo1lp rlnvi;s)s2xmiopio1amtnlfvi t)s2rmu  nt1aptnio3iadlaDranmp (4trermf oy1opDe nvi s)texmxo3oudlmeeliviat artr(m nt1tetoifcils s2rmuvsn(0arxnxf tydopDrlu i;()srxo(rpiu1am  lieta( s2rrx pot4oexnmictltlm2rauvo;(0alenif3oo1oa e neslt0 2xrxr ny4am  lfei ()aDrrump;o1tptnmociys a ra( snu0texrxr iodlp eauvi;s)teum(r oy4llee neiat aruaxmp;t4texo ocilslm2rmnvo;()trtrxf oydlpDrai o;(  rtoxr3iydlm emnet tf rraxm ot0tpeomoetydlaDem(msnu)aeenif ta1op rlies s0tetmirpiy4lleelivs ()s2rmu ont0tltnmoeiydla2uaumsn(0trenmo3ootoa rluvo;(0 2umiopoo4openlfciasf 2rrxr nu0oexn i3ildlmDel(vo;()aexoir3ta1lmteln ils0 etoxm3oo1op  lfct sf Dumxr ot4opxo f3iyd s ran s;(0 renxf3oydlat anvilt  rxoirpnu4lltelfvi sfs2uru onu0opxnmiciltfm elnmo;t0tleomo3oodlp eli o s  rum(opny1optn ivt sf Dtaxrpnu1oeeomfetltfaDemumpnt4tetoxf tatlat lnei;( t2umir oy4lmtemicslsf ruau ooo0aexoiietydfa2umuvs u4tetoxocta1opte ueol()t2urxm nu1opeemnvs t)aDumurpou1opxnmieias m uan p;u4 lerif3iy1laDeauvs () rxrxr3nydapeelfet ()aDrm(r ;o1tpxoii3tysla2uanmont4 lxrxf3totlp e ueo ( trxoxm3nodomt livils) Dtaum ot4ape moeiadfmDuauvp t4tlerio oodlpDraueo;t sexm(o iy1alenmfvt tf 2umu  nu4apeoioeiys a uln o t0trxrir3iy1oa  lnesls) 2to(o iu4ll nmivs sf Dtm(  nt0oet mociadls2eauvp;u4alxnmr oydfmDrau olt t2umimpiudapt mivsl( artmur ;o1tpenmoeiyd a ra(vpnu4teeoxr iatfmt  ivs s0srtrxo3iy4lmt lnet ()aDta(m ;u0tlt iicilt mDumuvont) ltrmfcia1lm r n olt trumir io4oltnmivt sfs2raurp;o1apxnmfetldfa ua( p;(0tlenmo3todlptean i t0 ruo(m oy1apenmfviasfs2uaur ou0oee  icilsfs2ea(monu) exnmr3oatop elieo t)sexoir no4omtnlneiasfarrrxrpnu4tle miciltls uaums;t)tetomfcta1op ranvo;s0 etmxo io4ome mncs sfs2tmxr nt0tpxnmfeils m rmu s;() lxnxf3ta1laDe i i ()s2uo(o ny4omen fesat srumum ou1optn i3ias mDrl( snt)tltrir ia1late ivsl(0trto(m nu1lmt mncsasfaDumxmonu4aee iictldls eaumsnt) rtomf3totfm  anvs s srurim3ny4omt lnet s) 2ra(m nt0alx iictasfmDeauvpn(4 exnxocoadlm eliei (0 exmim3iy4ope  ivs t sDtm(mp;o0aexnii3iyd sDum(vsnt0aeerio3iytomDe uvo;t0tetoxo iu1ol emiviltfs2rau o;u1tet  feiytfsDuaumon(4aeenif oytlat  uvol(0tetm(rpny4ol e fes (faDrau pot4apeo f3ils a ul( sn()tltrxr todopDeaues s) rtrio ou4ll   ieia( s2uaxmpou0opto octyd s2ea(mo;()aetoio tytoptr u s;t)s2trxmpny1lp elietat)aDtm( pnt4aleo ociltfaDemnvs t0trxrmocoy1lm raivsls)setoxopoo4lmtelfei t aDurx  ou1oltoiiciys m rln o;u0 eeoifctydfmDeliei;t sexmxmpny4ol nlivsat a2rr(monu4oetnmoetyd a umuvonu)areoxr3iydfp rauvs;t0t2trimpoodol   fcias srtm(  ;u4alt ioeias sDrluvsnt4trtrxr oa1lpte nei;t0 etrxm oo1lleelfvslt)artmxmp;t0tlx mo3tatfsDrmu onu4tlxrif3oo1fmt livi ()seurxrpoudale  iciat)sDum(  no0oeeniiciltfaDumuvp u)arxrir3oydlpDr nvs () ruoxrpnu4opte fct (fsDtm( pot0aptnioeiltlm2em(mp (0artrio3oa1fat  nvs ()tetm(o3oy1lpee fetat)aDrmum oo4alt  icild s ul( s;u4 etrxo3iatfmDe i i ( trxr(m3ou4om e icsls  Dumu poo4tlenmoctyt m2rmnvo;t0teeomo iy1fate u s;(  ruo(opny4lmee fcsltfsrrr(mono1aet mociasfa emuvonu4aeerif3tatopD aueo t0s2urxmpoodop emnes sf Dra(rono1tleo ociytfs rl(von(4 rtomocio1omDrauvsl(0trur(m3nu1ol nlietas)a2tm(m ;u0tle  oeiydlmDulnvonu4aetnmf3oodopDe iei s0tetoio iydap   ncs sf 2rmxmooo1olen iciadfmDrln o t4alermf ta1fpD  u ilt)texr(rpoodlltelfvtasf rrmxr oo1olxnifciasfmDeanvsnu4arermf3tadlp  anvils0teto(o3nu1oleemfvi s sDta( p;o0alxoifeiydfm uanms;(0aexomr iotlmD aivi;s0 exriopoudoleelnct sfsDra( ooo4teenmfctldlm2rm( snt0trerir iydoatraivo;t) 2urxr iu1ap nmnvsa(f rur(  ot0olx if3iltfmDeluvs u4tltoxoctydfm e u o s0t2uoimpiodapenmfet t  Drm(rpnt4opto f3iaslaDea(msn() lxnircio1omDe u il(0trxoir3ny1ol  mict s srururo;u1olx mociyt s ea(ms u4 rxoxociydom  aueo t)s2xmxr3oodamtelneil()arrr(m ;o1aeenifciytfaDean s t) etoif3tydfaDelu o t s2um(rpio1aleemnei t)a2tmx pou1aet iieild a uluvs ()texrmfciatlm e uvolt) exrio3oy1lm  mict s) 2rru  nt4optnmociytla emuvs t4 exrio ia1lmtrau s s  rxrxrpiu4omtnlncia(  Drrx pnu0texo ociys aDulu p u4teeoxocty1lpDrluvi;t0truo(opoydap   iei t)arrmx pnu1oltn iciat a2raump;u0 lxnmocoadfpt auei;t0trur(rpnu1om nmieiltfs2taxmo;o0apxn ietadlsDulumpn(0areoirctytlate neo;( texoim3nu1ameemnviat sDurxr ;o1oltnifeildfa ua(vonu) ltrirciatla rlivo;s sexmiopno1al  mivs t srumumo;o0aetn i3ild aDumnvp t)tlxrxo todfm ranvo;(0t2uoim ny4aptnmncs tf rtr(mont4aetnmietldla umu p t4tlerir3iydopDr i sl(0tetrxrpnodllen ncilt srumxm ot4tlxo f3iyslsDulu s t4aetomr totfa e ues;s)sruoio3io1lleelivils)srtmxronu4oetn iciysla ra( s t4arermrctadfmte uvs;s s2xo(r nudomtnlnvta( sDumx pot4ape ifeiadfs2ra(ms;u4tetoxr3oytlptrauvo t)s2trxr no4ap nmfvslt sDumx  ;t4tle iictldlm eauvpnu) exomf3ia1omD  neo (0trtr(mpnudom nmivilt arua(mpnt0tpeomieiydls uauvpnt)tleomfciotlpD aneo;t) rxmxr nu4lm nlncsl(faDtmx ont0oex  f3iaslm rlnmpnt)aexnircoydfptr i o s setrimpiodlmee ictat srta(m ;o0tlx  o3tld s ra(ms (4tltrxf tadfp r n il( t2xoxr3iodlle lieia(  rumu  ;u0ole mietad s ua(vs t0trxrircoy1laDr uvsls0teuo(rpnu1alen ivsl( arurxmonu4olt mfcildla eln pnt4artrxf todomte ieo s0seurir oo4llt mnctlt)aruax p;o4oetnmfciyslm2rmn s;t4artrio3tatfaDeli slt0 2xmio3iudoltnlivsls)s2tmx oou0oex micils mDea(msn(0aetrir3iatomD  i i ( setrxo nudam n fes () 2urxroot4opeoiictadfs2uanvsnu4 rxnmfciodop  luvo;s0seur(o3oy4lpt lnetatfarrm(  ;u1tpxn i3tadfm um(vo;u4aexnxo3tatlaDeaivi;t t2urir iydlm  mnciasf Dumu pnu1aleoifctadlm2ra( snt0teeomocia1lmte nvi;t  etrim oy1om   ies t  rurx  ot4tlxnioctytfsDranmpnu4teenxf oa1omDeluvo t) euoxo3iodamtelfvi tfsruax o;u0olx mieildfsDeanvs t)tltrifcio1omteli il()teurxm nu4omeemnviltf ruau pno1olt iociltlmDrmumo t4alxoif oydfptelu o;t t2xr(r oo4ope mictat sDrmu  ;u1aetnmoeiasfm em(vo t0 ltrmf3todlm rauei () eur(r3iodlm elneils a2rmx p;u0tpx moeiadls rauvo ()teeoxr3to1omDeli i;( trxriopnu1al   ivt t aDtmxmo;t1ole if3tadlmDum(mo t) lxrif3to1fmte ivi ( tetoxmpio4omee fvia(farrrxr ot4opxnmoctydfm emu o;()trtrmr3to1lm   ivo s0 ruoio nu4lm  mivtlt aDrm(monu0apxnio3tyd s2ea(ms (0trenmocty1fmDeanvi (0teuoxm ou1omtnlietat)arrmu ono1aetomfciadfaDel( snt)aetomr oadoaDe iei;()srtrxrpiydam e iei sfs2ra(mono1oeeoiicils mDeau p;()aetrmfcoo1lpD  ieslt0 2trxopno4oltemfctlt)artm(r no1alxn fctldfmDeanms t4trxrmfcio1lmDraneils0teto(o ny4omt mivia(f rtmuroot0apxoioctat mDeanvs;t)alxrxr3tatfpD aivs t0tetoxrpiodame  fei (farur(  ;u0optomictat a rluvpn(4aetomf tytomDeanes t trum(mpnodal e fei s s2tauro;o1aeeomictat a2rau o;() etnmf3ia1fpteln s;s)seumio oydlm  mnvilt) Dumxm ot0apxnmieiltfsDua(vs (0aexrif oatlp  auvo;s0s2uoxm3iy4lpte fei tfs2um(rp;t1tle mieiydfaDulnvo;u0artoif3ty1fmteauesl(0srxrxm3oudolt  nctlsfaDtm(m nt0oee iociat m2uan p u) lenircia1omtrlieil(0srxoio3oodll nlnviatfsDrrxrp;u1texoio3ils aDea(mpn(4teeoiociodlmDrlies s) etrxrpiu1lpe  nctas srtm( pno0tpeo fctytfs2ranms t4 ltoircoydomtr ivo;(  euoio oodlm nlnvi t)s2tmu onu0teeo icildla elumsn(4 eeoxf oatlaDrai olt0 rxoim3oodol n iviasfsDta(r nt0apxomietls sDrl( s;(4aleoxo iytfaD  i s;(0 rumxo nu1lme  ict sfsrrru p;u4aetoio3tatfsDuln pn()trtrxo3oa1opDe nes s)s2xrio nodlpeemfcsl()s2uax  ou4olt  ieiys sDumnvpnu0 rtnxr oatfp rliesls0 2umxo3iy1alen fvslt)arumuroot0apenmi3ilt s ul(mpn()aexnmo todomDraivo;() exriopno4amee nvtls  Durxm ;t4tpe mi3iasls2em(mo ()tlxnxrciotfa  auvo s sruoxr3oudalt miesat  2ur(ront0opx io3tas mDemnvpnu0arxnxr3ia1lmD lueo;t0srxrxr iy4op  lfctls)sDtmxrpou4oleoii3iadls emums;()tleomr io1omteaieo (0trxoio3ou4ol e ivtatfs2rmumooo1oltoifeilsfs2rmu ont4 eenio3oatfptrlueo t)texm(m3io4al  mfvtltf Drau onu4tpenmf3iad a eauvo () etnmo3oytfpDe ivo;t)srxrio iy4om  mfciat)a2uau pno4tpenmoeiysls2ranmo u0teerir3ia1lm  an i t0 etrxmpoydap n ivsa(f Dta(rpno1tee  oeiltlaDel(vo;t4arxrmf tatopDr u o;( t2toio3oudlltemnesls aDrmurpnt1apxn fctltfa2emu o;t) lxnxrctatfm  lnvs s0sexmirpnu4ap emneta(fa2taurooo4alxo oeilt m2ean o (4trtrxo oytlpt ai ils)sexrim nodoltnmfvilsf rtrumpnu1tpeomfeildfm um( p;t)arxrif3iydoptran ols srxo(o oodalte fetls)aDtr(  ;o1aptoioctatlm2ul(mo;u4teeoio tytlm  aivo;t)s2xo(mpnudomeemnet sfartmxrp;t4tetnmieildlmDeln o;u0aetrmfctydlp  li o;( sexmxo3nudlp  lfcil() 2tr( p;u4opeoii3taslaDumu on(4 etnxo3oydlaDe uei;(  etoimpnodomtn ivi (fsDrr(m ;o0olxo ieias m2ea(mon(0artnxr3oadfmtrlueolt trxmxmpou4apt  fvsas)s2rr(  ;o0teenmi3tltla2emumo t4 eenio3oytfateai olt0tetm(r3nu4ap emncils)s2raur ot1alt ii3tydfm2eau s;(4 rtnmr3ty1fptr u s;(0trxm(m3ou1aptnlfcilt a2rru ono0tptn o3ildlm2rlu o t0tltnmf io1faDrln i;t) rur(r3ny4omenmncsl(  Dra(  no1texn oeiad m2emumo;u)tlenmf tadomDr uei ( tetm(m3iy4ol  micilt) 2trumonu0tlt if3tls s ulump;u0tetrio ty1latr i i ( trtoir iudaptn ivs tfartr(m nt0tpxomfciltfs2ea(ms (0 exoxf iadop  auvsls0teto(o ou4lltelfvia()srrrx  ;o1oltomfeildlsDrauvo;(4aetrxfctytlatelueo s  2ur(o iudamtnmivi sfsrua(roou1tptoiiciasfsDrlnms;u0 rxoifcoy1opD  ues;s texoio3nodal elnvia( s2rrx pnt1optnmf3iltfm rlnmsn() lxnxf oa1om r i i s srxm(m iu4op nlict (fsrua(mpnt4texoif3ilt s2emump;()arenxr iydomt  n olt)t2xrio3iodol  lnvslsf 2tauront4aeeoioetysla2rl( snu)aeerio oo1oaDrauvs;t0srum(opoo1oltn ivi (fsDra(roou4tleomiciadls elnvs;t0alxrifciy1oat li o t0s2tr(m no4alee fci (f rurxmp;t1altoioeildlm2umnvs u)aetrmr oa1opDe nvo;(0trtoiopoy4om emneias)sDuaump;o4aptoioeiytlm2uanmp (4teerioctatomD  ivs;s)srxoxmpoudol e neiatf Dtaxm ;o4aexoiictydfa uau on(0 exrif3oydop e ivsl()s2to(m oo4om e nvsa( arur(r oo4tlen octltlm umn p;(0altnmrcta1lmDrli i;t0trtm(rpnudlm  lfetl(  2ururpno1tptn o3tyt mDuan on()tetnir3iytoaDrlieol()sexoxm3nu1lleemivia(  rum(mont1tptnii3iaslaDuanvp;t0texomfciydoptean slt0setoiopnydameemfvsa() 2rr(mo;o1ale ifeilslm rmuvp;u0tlxnxfcoodop e neo;t t2xoir iodlleelnetl(fs2rm(rooo4teeoioctaslm2ulumpn(0altrmf3ia1lm eau o t  2xmxrpoy1lpee iesa()srtaurpoo4aleo ociadla2ulnvpn(4tleoif iy1lmt  i ols srxmir no4lm nlfet ()sDua(  ot1aee mi3tysls2um(mo;t4tlermf3oatlpt anes (0trxrim iy4omtnmncslsf Durxr ;u4ole iieias a rlu snt0alenio tydfaDrau o s0 ruo(o ny4lle mfviat arumur nu1apt
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;s) eurio ou4lpt  fetas sDua(rooo1optnmfctlt mDeauvs;u0artnxo to1fat lu ol( texrir nydom emivta(faDrmu oou4aexn f3iltls umnvo t4trtnmo3oadoa r i sls s2trxm3oudopt mfcilsfaruau onu1aetniieilsfm eln o t)trtrmrctodop rli sls)srumimpoo4al e fctat)a2raumo;o4tetnmoetld a2rauvs;u4teeoir iotlat au i s)srumio ou1lpen ieiat)sDrmxrono0tpeomieiad aDumu p (4tetrxr iy1la rluei s) 2tm(rpoy1apte iviat s2rr(  no1tlxomiciasfaDel(mp t4tltnmociy1oat au i;t texrxmpiy1lmt miciat)sDtmu  nu4aeenifeiat aDemnvon(0tetrxr oadlat lu sl(0texoxmpno1optn fcsa()a2ta(r ;t1tpe  oetatfs rln o;u4alermf3tatlmDeluvils)t2xmxmpoo4altn ncsls a2ta( ooo0aptn fcilslsDrl( p t4arxrmo oodfm rlueils  exrio oo1lmenlnvt ()aDuaur ot1aee mieiyslm ea(vont0 ltnmrctytlaDrlnvi;( t2xr(m3ny1lmeemies (faDtm(root1tltnmo3iasls2uauvp t4 lenmrciydlpt lieslt trtmxm no4lp elivtlsfsrtrxm ;u0tlxnmoctls m2ul( p t)trxnmf3iotfpt lu i t0srum(rpno4omenlici ( srtaum ot1oleoifetlslmDelump t4 lxomf tadfmDe u o (  etoxmpnydome  net t) Dta(rooo4tle ii3tys m rau s u4areoxrcoadlp elnvs s)s2xoio iy4ame lfvtat) Drmxm ot1oex  f3ilsfmDrmnvon()tetrif3iotlm  auei;t)s2uoxr io1om emnvsls  rtmu  nt1oleo iciys s rmuvs u0alxrmr3oatfpt livi;(0setoio3ou4olenmivi sfaDtaum oo1apenmo3tasls2ra(vo;(0 rxoir iytfaDrlu o s0setr(o3nodamt mncta( sDrax  ou0texo f3iytlmDrmn onu)altrxr ia1fateluvo t0s2tr(m ny4lm  mieiat)s2tr(r oo4apxomoctldlmDuluvp t) lxrxocoadlmDe i ilt) etmxopiu4op n fctat  2tr( pnt4opxoif3ilsfaDea( o;t0 lxnirctodoaDrau o (  rtoirpnudameemfvil(fsDtmur ou4olt iieiad m2uln p;t)texnmoctydfmte u il() rxoimpnu1ameelnctas) 2urx pno0tptoifciysls ua( pnu) exoif iy1opDean s;s0 etm(m oudlp elfvia( s2raxm nu4apx  ocils s2ulu p t0aetrxf iydoptrlieols0 etmim no1ol   fcsas arumxr ot0oee mietldfa ulumon(4treomrcootoptran s;() rtmxm3io4lptelfvi tfs2ua(r nt0tle  o3iyslm2rl(vo;u)alenir3ta1om r nvi t s2tmxmpiu1lmte nvsasfartm(m nt4tltomo3iydlaDrlu p u)aexnifctotom  auvi t seum(m3iy1lptelietas) 2rm(m nu1tpen ociys sDrlu p;t)arxrir io1laDrlneo;t0s2xrxo3ny1am  mnvs s)srumumpou0openmieiyd sDuan s t4 rxoxocoodfptrlivi;(0 2trxo io1lpe  icil(farrm(m nu1oleomo3tyd aDrlnmsn(4artomf totopD lnes;(0 2xoim3oy1alt  fvsls a2ta(rpoo1ole moeiytlaDrluvs;(4teeoxrciy1faD aies s)trtoxopoy4op e fvilsf 2rau pnt4olen ictltfm em(mo t0aetoxf3iotoptean ils) 2uriopoo1ame mncsat)arraxmo;o1alt iiciltlm2ea(vp;(4 exoxo ta1fpDran ils0 2umio iydomtnlfvtl(f Duaxr nu1alx if3iasfa2um(ms t)arerio oy1fpt au o (  2xm(m3ny1olen fvslt srtaxmont1oeenmi3iytfaDem(monu4 lxoir3oy1lateanei t teum(r iy4om n ici (faDrmxmoot0optn oetatfm2eln p;t4tetnxr3totlp eluvsls0t2xoxm ou4ope lnciltfa2ururoou0ope iicilsla umnmo;(0 reoxr3tydfptrluvs s)s2xmxo3oo4alt  feilt aDtrxm nt0apeomoetldla2ea(mo;()tlxomr3iydlatrlnei ()trxm(o io4omenlfcias)arumuro;u1olt io3iat a ulnvp;u4texnir3io1lm rlies;t  2urim iydopt lnvsl()srtax  ou0ale ioctltfm rmnmsnu) rerxr tatla e ueo;(0t2urir iy4ome mfvt sfs2uau p;o0tlenmfciydlmDel(ms u0tlenir3tydfp rlnvo (0trtm(o3nudomee icsasfs2taxmp;o1tetomo3iaslm2raump;t)tetnxo oatfaD aivol() 2uoxo oy1lleelncil( aDtmx ono4tlt moetasla2rlu s t)tltrxr iytopD aues;(  exoxr ny1op nlfcsatf 2ta(r ;u0opxomo3iytls2ua(mp;t0tltnifcootom  lieo s0seurio iodlm nmictatfaDuaxront4opx  oeildfsDelumpnu)teermo3iydomDe ivsl() etoxr ny1apen ici s srrr(rpot1aetnmoeildfm2raumo u4texrmo3io1lmt lneilt trtmio3iu4opt lncta()a2tmxr oo4tlx  icils a2umuvsn(4aleriocoy1omDrln o;t sruoxopno1lmte ivslt  2ur( poo1texn fetas m2ea(mp ()artnxf oy1oa  ai ols  rtoiopoo4lltnlfvilt)s2uau pou0olxomf3tat a uan p;t0aexomfcia1om rlnvs;()s2tm(rpiudolee fcs ( sDra(m oo0opt ifctasfaDrm(von(4texoxr3oytopDraueil( sruoio3oy4lmtelictas)s2trxrp;u1aptn f3tlt aDrm(msnt4trerir3iy1oa  luvi s0seur(rpoodopen ivta(fsrrm(rpno4opxnifciytla2eluvo;(0trxoxf3tytomte ies;() eumimpnydop n feils  Duaxr ou1aee mo3iys a2rmnmp;(0altoxo3iodom rlnvs t0s2uo(mpiu4ap nmfctls)arurxmpno1olt mieiat a uanvp () exoif3oodfatrau il() rxoxopnudopeemivi tfsDtaurpou1aeto f3ild mDul( s u4 ltoifcta1lmD au s ()t2tr(mpoodap  lncilt)s2ra( p;o4aptniocildlmDrm(msnt)alxnxociy1opDr n o ( trxoiopoo1apenlietl(farrrur nu1tet ifctytls ra( o;(0altomr3iytla  aivs (  2xoim3no1al nmietl(farta(m oo1aeenmicilsla2ulu sn(4altnmo3tydomteanvo;()teumirpou4ol nmfvsat  2rmu ono0apxniieiysfs2rau o;() eeoiocoatfa eliei t  euoxm3nydole mfeiat sDtax  ;u4tpxomf3ildfa ua(vo;u0aexrxfctydlpt lieils)trxoxm3ny1om n fvtltfsrur(m nt4aleniictysls2emu s;u4 lenxf3oo1lm  anes t)srum(o3nu4al emivtls  Durxr nt1alx  ieiydls ul( ont0tltnif todla  auei s0sexrirpoy4lmte icsas  2rrumooo0olt ifeiydlm uluvp;() rerxr3iytlm   ieo (0tetr(r3nudal nlnvi ()sDurxmo;u0apen o3iat a umnvo;u4 renmf ta1opteau slt)teum(rpiy1apt liesasfsrurx p;t1apt ioctldlsDumnmo;()arxrmf3todomt aivils) 2xrxmpny1amt micils)s2umxr ;o0tpeomfeiyt sDulnmp (0 leoxr tatfmD luei;(  rtmim3ny1llenlnes s) Drruronu1tlxoii3tad s2elnvs;u4teeomf3ia1lmDelivi;s0t2ur(opiydapee ictl()aDta(m ;o1olt iieiyt m2emn p;() ltnir3ty1fm r nvo;t)srtr(o3oo4lpt livias  2tm(r oo4tlt iicildfa ulnvon(0trxrirctydlaDeli i t)sruo(m3oo4apeelivias sDrrxr nt1aet  i3ild a ranvsnt)tltnmocoa1fpt au o s trumxopio1apte fvia(fs2tmxmo;u0apxnmo3ias s ra( p t0trtrio tytlmte ivolt0s2toxrpio1am  liet ( artrurpoo1texnmoetlsfsDra(vs u0alxrxo3iadfa   iesl( seumirpny4lmenmiviltfsDurx pot4alenmfeiatls2uaumsnt0aeerircia1lpt aieo;s)t2xoxmpiu1ole mfctasf 2um(mo;t1tlxnmoctat aDul(vpn(4 eenmf3ia1opDean sls  eur(r3no1oleemfei t  Dtauroou1tex ifcildlm2umu o u)tleoxocty1lmte u i;t)s2xoxmpnudope lnci s)srraur ;o1tee iiciyt m um(msn(4tlxrio tytfmD anvi t) rumxr3oydap nmneilsfs2rmxm ;t4olxnmoeiatfa ul(ms u0 ltrmrcoodfmtrluvi;s0trxm(r iy4lmen fcta( srtm( pou1altn icild sDrlu o u4alenmoctotlmDraivo;s)srtm(o3oodom nlneils a2rru  no0tet if3tad m2eluvonu0alxrirciodopD anes s0 ruo(rpiydllte ietlt)srua(rpnt0ole mietls a el(vpnu4 lxnmf oadlaDeaueslt0srxrim3oo1optemfvsatfs2urx p;o0alenmfeiytls2rlumpn(0tlxrir3oadlaD  nes s) rxrxr iudol n ncsasfaDumx  oo1teen oeiytlmDrauvp t4 rxnxf3iodoa  luei s  2uoirpio1apt lfvsl( srtrxr ot0opto ociysfmDea( onu4 etrxo3oatoptrlieo;t seumxopnu4ol   iesat)a2uru p;t0ope mfeiyslsDuan on(0 eeoifctadomt aivo (  2xr(m nydopen fvsls  rrm(r ;o0olto oetydlsDuln pnu0aeermf oytlpD auei () rtmxr iy4ap nlfcsat  2umxmpnt0oex  o3iytlsDrlump u) lenmo3iadfptraies t) etm(rpoy4apeelivs tfarurx o;t1alxoioetldfaDelnvon(4tltnioctotfp e u i t)trtm(opoo1lleelfci s) ruax ont1tpxoiiciytfa rl(vo u4aleomr3tydop   nvol() 2xrxr3iudlmtnmfvsatfaDumxront4teeo ictltfm ra( s;(0texnir3oatomDeaivo;s)teumxr3iudlp emnvsat) 2rmxm ;t1optomociydfs2emnmpnt)aexnxr3oa1omDelivil()t2toirpiodopen feilsfaDuau pou0apeomo3tydfmDrm( onu0texomr tytlm elnvo s trtmxm oydlp e feiasf 2rmxr oo0tlxomi3iyd mDel(vo () exoif tadfp elnesls)teurxmpiodomtemneslt  2tmx pnt4aet mi3iad m umnvo u0tlxoio3tytlpteaueils)t2xmim iy4llenmieil( s2uru o;o1tex micias a emumpnt4trxnxfctodlatrlieo;t  rur(rpnu1oltnlies tf Dra(m ;t1oex mo3iyslm2ulu p;t)alxoxr3iotlatrliei s)t2xm(o oudomtn nesa(f Dum( ono1tetnmoctlt a2rmn o;(4 ltnmo ootlaDeaueo;s) 2trxrpiu1ll nmiei t aDtmxrp;t1tleoiociys a rmn s u4tetrmr tadla e ivilt) 2ur(mpiudaltn icsa(  2rr(mp;u1tptomfeiydfm2ulu o ()tlxnmrctatoatranes s0teumimpnodlme livtls) 2tau  ;o1oleoiietysfm2ua(mo u)treoir oydfa rlieslt seumimpnodlltnmicsas a2trx p;o4olx ii3tltfs2rlnmo ()tetrif3tytfpDe uvols)trxmxrpou1llen ivi ( srum( p;o4aptomociaslm2uan snt4arxomf oy1fatr ivi s  rxr(opny1oltemfci ( s2raum no1oetoifctysfs2eln ont) rtnircoadom r nes;() eur(opiy4lmt lnet s artrumpnt1ape ii3tydfm2eln s;(4tltoifcoo1lmt  nei t0s2xrxr3no4olte iei tf 2raumpnt1aet  oeiytla rl( s () lxomf3ootfpDrli ilt)seurir3ny4lpeemfesl(fsDumu oou1tetn ieilslm2rauvo;u)aetoxo3tytlmtrau ilt)sexr(m3iu1ole  nvia(f 2taumooo0ape mietat s ul(vp t4treoircta1oat  ieolt0teuoxo3iydop emneia(farum(m ot1aeeomo3tasls2eauvsn(0arxomo iadfat ai o;(0teuoxm io1alenlfvslt sruauro;t1apeo iciytlmDua(vo u0arxnmf3oydfp e ivs;t0t2toxr oy1lp elietlt  rurxr ;u1aeeomoetadlm elnvs u)aleomf todlaDrauei;t srxm(r iydoltemicsl(  2rauro;u1tpeo oeiaslsDean pnt0 leoxf3ta1oatean ils)trumir3oy4oleemfesas) Dtmxronu0tpxoioctysfsDea(mpn(4 eenxoctodlpD an s ( srtoir3oy1ole lieil()sDtaump;o1apxnifciysls ra( snt)texomo3iodfateluvs t s2xo(r oodam  mfcsl(  Dtaurpou4texomociatls eauvo;(4trtomf tatoaDe uvsl()t2urir ny1alen ivil()artrxm no0tlxomf3tatfs rmuvpnt) etoxrciydfmD lu i t0trurxmpio4omenmici s arurxrooo0aleo iciysfm2emn p;t4 reomr3iadomD  neo t0s2um(rpnu4olt lfetat)srtrxmp;t1olx iiciysfm rl( s;(0texnxrciatomDe n ol()srtoxo3ny1amtn fcs () Drmuro;t0olt iietltfs umnmsnt) rtoxr3oo1lm eauvo t0s2urxopou4ape  nesls)arur( ooo1apt  o3iadfa2um(ms;()tlermr3ty1faDeaivo s srtoim iydaleelfvia()srtrump;u1altoiietaslaDeauvo ()tlerxfcia1opDr nvo;(0s2xm(opoodap emieils) Dur( pot1ope iieiytfm2umu o () reriociydoptr nei t0seur(r ou4ame lfvt (fa2tmumpnt4apxo icils a em( on(0texoxf ty1fpD lu i;t)t2trio iydome lfcsas sDrmuronu0ale mfeiydlm2ulnms;(4 lerxfciydfpt livsl()s2xoxo3oo1llenlnesl(  rtmu  ou1teeo feilt s2rl(mo;t)arerxrcoydfmDraneilt) euoio nu1ole mfeiat arrrumpou0oee  i3iat s ulumsnt4aexrmfctydop r i s;s0setmxm iodaptn ivsa(  2raxmo;o4ole iietlsfsDum(vsnu0 lerif3iy1fmDrli s t0sexm(r3oo1ap n fciltf 2ta(rp;o4opeo fctls s eanmon() lxrxrcta1fpt luei s)trurimpoy1llt mfeias)srta(r no4tex  fciytla eanmp;t0aleomfciydlmD luei (0tetm(opnydol emfciasfa2ra(rp;u4teenmictls m rm(msnu0tlxrmo oy1omte nvsls0 rurirpnudolt  ivia(fartrxmpou4olxo ociys s2rm(vs;(4tltnmo oadomtelivsl( trtoim3ny4lptemnei tfsruaxrpnu1tpe ii3iltfaDrm(msnu) lenmr iy1oateln s;t  2xoim iy4am e nei t)s2raxmpoo0apxoii3tldfm2um(vpnt0trtrif iy1omDrauvs;s) exoxr iu4am  lncia(fartr(mooo0texoiiciasfaDumn o (0 rxnmoctodlp   nvo s s2toxm3nydlp e iet s  2tmu p;t1tltomicilsla2ulnmo t0trenmo iodfm e u s s0 rtoiopiu1lm n fcsls s2taxm ou4alenmicild sDrmu s;t) renmo iodom eaivolt)sexr(opiudlptelnctl()s2uaxrp;o0apeomi3ilsls2ean p u0alxoif3to1fpDe i slt t2xo(m iu1ame mfesa() 2tmxmo;u4apxniieiysfm2eaumpnt0 ltnmociodfpt lu s t truoxm3no4ol e fcs tfa2rmumono1tpen ocilsfaDrmuvsnt)arxomo iotlateaivs;s)t2xrirpoy4optnlieilsfaDuaxmp;u4aptomoeiysls rl(vpnu0tltnxf3iy1lm e u ols0 2tr(r nydlltelfvia( arurxm nt4opeomfeias a rm( onu4teerif3iodla  lieslt) exrxrpnudll  lfeilt) 2ta(rp;u1opx  ociyt m2rau p;u4 lxnmf3iydop raneo;(0srurirpou4ole  feiat srrm(  nt0teeomociltfs2uluvp;u4tetrircoy1lpD lu s;()t2xo(o no4lltn nvt ( aDurxmo;t4apeoiieiasfs rlnmp;t0tlxrmo3ia1fpDeanei;t0 2trxrpny1oleelnes t a2ra(m nu1olen octad s2ran snt4trxoxf iytlm   ivil( trxm(o3ny1altnlfvils) Drm(  ;u0olxo f3iltfs2el(mo t0aeerxrciydopD anvo (0srtmim3iodopeemfci (  2ururpno4tlenifetld m ulnvp;(0 eerio3oa1lptr nvo s) eur(r3ou1ol elncs s aDuax pnu1olxo oeiytfsDeln p u0artrir tydlmt au o t0sexrxr3iydaptelietls) Dtmu  nt0alxo ieiat m2rm(vs;(4aeeoxrciytlatelneo;s srumxr nodap  lnvi s srra(mo;t0aeeomoetlsfs umuvo (0trxrmocty1fpD  u sl()teumxo3oy4amt  fcilsfs2ua(  nt0tle  octysls rluvsn() eenxocoy1lpt  neols)setoxo io4altnlnvs s  2urum ;u1aex  oeiat mDum(vs t0altoxf3totfa rln olt)trtr(r iudlpt licta() rtm(ro;o1aptomf3iyt s umn o u)arerioctatfm rlnvi;( seumim nu4ol  mfvsa( s2trxr nt1apxnmo3tldlm elu ont)aetrif3oadlm  aivo;s srtm(opnydomtnlneia( aDtr(mp;o4tetomfctytfmDrl(mp;() etnmf3oa1la e neilt s2um(mpoo4am  liesas a2urxm ;o1tet  o3tysfs emn s t0treomf ta1opteaivo;(0sexr(opno4al elicil(  rrrx pno4alxo f3iysfa rmnmo ()alxrxo tadlateli sl(  rxoio ny4lptemncs s artr(  ;t1tpxo f3ilslsDrmumsnu)altrmo3to1oaDrluei;t trtr(o nydaltemnciatfsDraumonu4oeeomietadfsDemnvs;t4alermf3tydoaDr i o;(  2to(r3nydop emict sfaDtaumonu4texoioeiys m2elump;()aetnxr3tydfpteaivils0texoir ny4ap e ivtlsfs2uaumpno1tetnmociasfsDumnvsn(0aexnxrctytom elneo;( trtriopoydam nlfvsa(fa2urx o;u0apenmo3ils sDrm(mo;() reoir tydopt  nei t)s2xoimpiy4amenmfcia()a2ra(mp;o1opxomfeiadfaDuluvs;t4tltoxfcoytlm elivsls0 2xoirpnu1lptn iesas)s2uax p;u4tlx if3ilt m ean onu4texomf iydfatranvo s srxoxmpiudap  mfcs s)a2rmu  ot0oet if3tlsla2eanmonu4 eerio oy1fateauvo;s  2tm(m3oy1optnmfviat  Duaxr nt1oexoifetlt aDrm(mpn()areomr tatom  livolt srxoim3nu4lpe  icsl(f rtaur nu4oetomictadfa emn p t)tlermf3tytlaDrluvi (0srurir nydop   netlt)arrmx  ;t0olt  o3tlt m ua(mon(4tlxrir3oodop   n s ()truo(rpou4al nlfvslt)s2rm( ono1tlto o3iysfmDem(vp t0tltrmo3to1op   neo t trxm(o iudoptnmfci (f 2rax pnu1oetomf3iasfs2ua(ms;t) eenxr3oy1op e i o;s)tetoirpoudameemfeta( s2rmu p;o4alxoioctasla ran s;()tltnif ootfpteaneo t) 2trio oodamtnmnvta()sDta(r ot0tltnmietad m el(von(0tlenxf tydom r neil() 2urxmpnu4ale mncia()sDra(m oo4optnmoeiadlm uauvs;t)trtrmfcty1fmDrai sls0 2xrxr iu4amt  nvta()srur(mo;t0texniieils m2elu p;u)texriociydlptr n ils0s2xm(o nudlpt mivs (faDuau  ou1apxn oeias m eln o;u)aleoxfcoa1opte u s s) 2tmir iodol e ncias  2rm(rpot4apto f3iadfm2uanvs t) etnmf3tatfmt livs (0s2urir3oo4lleemivtat a2ua(mpnu0tltnmf3ilt s umuvont4tetoxocio1fmDrli i s  ruoxopno1lm nliesls)aDtru o;o1opto ietlt aDuauvs ()trtnmf oa1fp elieo;s  rtoirpou4oltn nctatfsDrm( oou1tlxn i3iyslm2rmnmonu4aetnmo3iotfa rai s s0srtmimpoudllt  ieia()sDrm(rpot1tetoioeils m ul(mo;u4texnxf oodlaD  u slt  2umio io4om elfcs () ruaxmont0ape io3iysfa eau p;u0alxoiociy1fptrln s ()texr(o no1lp n nvt () 2rm(mpot0alto fctydfm elnmp t4altrio3oytoa eai i s t2trxo3nu4ol elictat)s2taump;t1apen o3ildla2ea(mpn(4tetoir oo1lmtr u sl() 2tm(opiy4om emnctlt)a2rm( pnu0alxnii3tldlaDeln s t4trxrif3oy1oate nvs;s) exm(opiodop n fcia()s2rm( p;u4aetoifciadlsDuan o;u) rxrircio1op eauvil()t2umxo oo4omt lfctat)arrmxmooo0alxo f3iasfmDrl(vo;u4 lxnxociodfa ranvi t0s2tmimpoudll n nei () rum(rpot1tetn f3iaslm emu onu0 etnxocoytfm raueo;()t2uo(r ny4lm elieiasf rrm( o;t1tpxnmi3iatls ulums u4tltnmf3oo1oat  nvs s  eur(r3no4lle  neil() rtmu p;o0oee iieiadfm2rmnvs (0 ltrmf iodop elieolt0 rtr(r3io1omtnlnctat)s2ua(  nt0opxnif3iltfsDulumo;u0 lxoxo iydfmDrauvsl( s2xrimpiy1altnmici ()a2um(  no0tpxniictlt s2ran o t0 ltoio3ootlaDr nvs s)teurxm io4ap  licia( a2trur ot0tptn o3iyt sDemnmo u4aeerxo totoptrli s;t)t2xoirpny4om nlieia()s2taurooo4alt io3iadfa rm( on()teenircta1opDr iei ()srxo(mpoy4alte icta( s2rmxm nu1tlx  oeiat s2ra(mp t) etrifciatfpt  u s;s)seum(m oudlpe mnctat)srumxm ot4olt mf3iytfm2um( o;(0tetnxo3tytfmt  nesls)t2tmir3ou4opt  iviatf Dta(mp;u4olto iciltla ra(mpn(0teerif3todfptr ueols) 2toxopnudol nlnvt t)sDtruro;o0oexoio3tys aDelnmont0tlxniociy1fpt  nvsl() exmim3iu4lp   icsl()arumumpoo4tleoiociatlmDrmumpn()tetnio tytomDr ieols seuoxrpiodam  mfcsa()s2rmxr oo1oltnmfctltfaDeanvp t0aeermf oodlmt an i t) etrir iy1lpe mfet s srtmxro;o0alxo ieiytls rl(ms t)teenxr3oytopt aivo;s0trurxm no4altemivil( srumx pot1tpe io3ias a emnmp;t4trerxf3tydoaDeluei t texrxopnu1olte nvt (f Dtm(mpoo0aptoifeilslsDrm( snt4artnmrcta1fat luvi;s0srtm(rpiydapen ivt tfs2urur nt4olx if3ilt m umu ont4 ltomrcootlp rln o;t0t2uoio oudlltn ieil()a2trur nt1opxn i3iatlm2rmnvsnu0tlxrmoctytfmtr uesls t2xoxo iu1ll  lnvil( sDumxrpnt0tetomi3iatfs el( s u4trtoio tatlmtr n s;t)t2tmxm3ou4optnmfvia()srumxmpnu0tleomietatfs2ua( p;(0artrmr3todfmDeaivi;s)texoimpiudop n fesls  rtaumpou1tle  fcild s emuvsnt)texoif ootomDran s t s2tmim ny1op emivsl(f rtaxmpoo0oleoif3iaslm2uln snu)tlxnif io1op rlieslt t2tmiopoy4apt lncs ( aDuax ont1altniictad m uauvp;() rtrmo3iatomt an il(0 2xrio iy1lmt lncs (f ruau pno1tptn fcils mDua( o (0 rtnio to1fmtelnvi (0 exr(r ou4om  mnvtltf rta(mo;u1olxomf3ias s ua( onu4trxomf oodfmtrlivo ( trtoio3ou4altnlivsat  rrax p;o0tleoif3ilsfm2ra(vs;u) rtomf oodomt anvols0srxm(o3ny1om  lnviltf 2tmx  ;t4apx iociatls rlnvp t0 lxrif iodlat lieslt trum(o io4apenmnvtas  Dumxr oo0tle if3iyt s2rm(vsn(0 eerir tatopDrlueo s0tetoir iudomeelfcsasfs2tmxr no1tltomfctas m2eanvo;(4 renxf oo1omD  nvo;s)trumio3ny1lp  miet t) Dum(mpoo0apxomo3iydls2ulnmon(4tlxrir tadfa rlivi;t tetoir3oo1optnlneia()aDrr(m ;u0ale ii3tys s2emu p;t4aeeoxo iy1fpDelnvi;( t2xmxm3iudomtemiei t aDtmx o;t4teeoio3iyt a ua(vsn()arxoxocoadfp   nvi;s)srxoio iydom elnei tfsDra(m ;u4apx  ociyt s2rlump t) rtnircoytfm  aneol( teurimpiodlm emnvtlt)s2tauro;o4oeeniociatfa rmumsnt0trxrio3todlmteaies;s seuoimpiodll emiesat)a2uaur ;o0alx mf3ils sDumump;u0artrmociodlaD auvi;s) 2trxmpno4lmenmfei s  Duru pou4tetomociyslm2ran s;t)aexnircoo1lpDeluesl()t2tmir io1amenmneiltfa2tru ont1altn octaslsDua(vo;t4 lxrifcoy1opDeai o t)s2xrxo iydll nlncsa() 2umx o;u1aet iictlsfm2eanvpnt4 etrxoctytlm  aies;(  exm(m nodlme mfcil() Dtmum ou4tleomfciytfaDemn o;t)areoiociadlaDranvi ()setoxo3nodllt  ivsl()sruaum ;t1aee mo3ils a ua(vo (0 rermf oatlmt  ieols)teuo(r io4amtnmies s  2uaum oo1teen fetls a ranvsn()trenxfciytfaD  ies (0s2toxr oy1om  lfet (f rumxmo;u1oltomo3tldlsDeanvo (0 rerio3oadfpDraues;t)t2to(opiu4openlnei () 2um(ro;o1aptn ieiad s rmu s t0areoio oydfa   neo (0t2tmir iy1op nlfvsl(fsrtaur ot1teenif3iatfa2eauvp;u0teerio totfptelieo (0s2xoxr iy1am  mfet tfsDta(rpoo0ole mieilt a2umuvp t) eerxfcoo1fa r neo;s seuoxrpiy4ol n fct ()srtmu o;o4oeeoif3tlsfaDelu p t)trxnmrciy1fp eaivo;s teuoxopno4omtnmnetas srrr(r ot1teeoiieiyt sDrl(mp;t0aleomfcio1optrluvil(0srtmir3iy1lmt mivsat)s2um(m nu0altoii3iadfmDemnmont4 eenxf3ia1fm elnvo;t srtr(m oodolte feil()s2ta(  ou1oetnio3ils a2elnvpn(4 lerif3iadlm   uvi;t  2um(o iudlltn ivias)srua(rp;o4tlxomieilsfa uanmo u4aexriocoa1oa e ueo (0 eurxo iy1ll nlnesasfaDtaump;u4tpeoif3iatls ulumpnt) etrxr tydom e nei;() 2tmxr oo4op  lnet s sDtau poo4tlen fctat s2rln snt4trermfctodoaDeau sls  eto(o iydoptemieil(  2urx o;u4tleomoeiatfm2rauvp (4texomo oodoatelu i;t0t2tm(opio4olenlnvi t a2rrxmont0apen fciltfs uanmsnt)artoio3oodom e neo () ruoxo3ou1olenmnvsa()a2taxm oo4tetomietytls uauvsnu0 rxnmrcto1om eli s (0tetoxrpny1ll  miesl(f Dtrxm oo1opxomfciytfa eanvp;(0altrxf iadoa rlu o;(  2uo(r3ou4am n nvs tf rrm(  ;o0ole iociyslm2ran o u0 eerio iatfpDe nvs;(0 rxmir3iy1aleelicil()arurx oou4olxomf3ils m2ua( snt0aeermrciodopt auvs;s0srtm(o3iodlptemnvi tfartaumonu1open i3ild m2ranmp t0arenmfciy1opD au il(  etrim3iodap nmnetlt aDuax pnu1tpeoiicildfmDuanvpnt) eenmocty1la e ues (0seurir iodal e iei tfaDuru oou1tptnmoctys a uanmp t) lxoiocto1lpte u o;(  etrxm3oy1lm n iesl( s2rrxrpno4oexnmfciatla umnms;(0 lxomo3todlp  livo;s) 2uoir3no4lptn ivsasfs2rm(mp;o4tptoioeiadfa emnmont4 lxrmo3tytfatr uvs (0tetoio oydomtemfeils)sDrmu o;t4opx  ietasls em(mo;u) lxniocta1fm raieilt0setrir3oy4apte nvi (fsrtauro;t1apeomfetasla uau o;(4altrir iytlat luei;() exm(o3no1aleemiciatfaruax onu1aeen fcilsfm uauvp;t4aetnioctatlpDr ies;t)s2xmxrpiodlpt lfetatf Dumx pno0alenifciydfmDuanmp;u0tlxrxfciy1optelnei;t0tetrirpoy1ap e fvtl( sDraxm ;t1apxnmf3iat m2eau snt4 leoif oa1opDr u ils0t2uoir3oodame  nvia( aDraxr oo1aptomf3iltlm2em(vo;u4 exrmf oa1fmt an o ()srxrxr ny1ame mfes s)srtmu  ;t4oexnmi3iydls ranvpnt4trxomociotlpD  nvils0 rumxrpny4amtn fcsasf rtmxmoou4alxomi3iadfmDrln o t0tetrmf3oytlatelnvs;s)sexo(m nydapenmnetat) rra(r nt4oeenmi3iad m2rm( s t4 lxnxoctydlpD an il(  rtoimpoy4omte fetat  rururpoo1tpenioctadfm rl( o;t)areomr3tadfm ranvil(  rxoim3iu4al  mfesat) rrmump;t0tlxomfetydfm uanvonu4tetomr3tadfmteai i;t)t2xo(r io1ap elfeslsf 2tr(r ;t0opt if3iytfsDelnvpn(4aetrxf3ootomDeaivi t0teuoxm3no1om emfeslt  rtr(m oo1optnmo3iydla ranmo;t0tetoio3iadomt lnvs t)srtmxrpio4apt  fes s  rurxr ;t1tpt mietyslmDrau o u4tltomfctadfm  aueils teum(m oy1amenmfvsat) 2urxr ou0tpen fciys mDumuvs;(0arxomo iytoaDeau s;t0setrxr3nudlm  mici t) ruauronu4optomfeias mDem( o (4 rxomoctadopD aneslt0setoxr3oo4ll  lict (fsDurxmpou4texo fetldla eaumsnt)alenxo oytfa  aiei;t) rxr(rpoo1ope lfvsa(f rumu poo0teenmi3iltlsDua(vp t4 renxf3ia1oa rln o;(  eto(o oydlltnlnvt ()sDumum nt4altniieiad m em( s;(4 rxomf3oy1om eln s;s0t2urir3oo4amte ivslsfsrtr( p;t4tpx  oeiyd s uln p t0texnmo ootomte neol(  2xmir nu1am nlfes ( a2rr( poo0tlt if3tlt m emnms;t)tlxomo ia1lmDeanvo;(0 exmim io4alenmieia(f 2rmxmp;o4aptniiciasfs rlnmp;u)areoif oa1lmDr ivi s s2tr(rpiudomenlnei t aDtrxronu0texo o3iad aDumuvs t)aexrxf oatfa raiei;()tetrxr3nu4apenmnetl(faDrmx pou4olt ifeiytls eau p;u)aeenir3oydoa ran i;(0 2xmir3oy1ol e iesltf Dumur nu4oexo o3tadfa2rl(mpnu4artrmociy1laDe i o s0srum(mpoy4amt lnvi sfaruax o;o1tlt  fciydlm em(mp ()texrxrctydla   nes;(0teto(m ou1omt  ict t srtmum ou4opt moeilsfm2ean pn()aexrmf oydoa r i i;(0texr(rpoy4ol  lfeil( s2tm(ro;u4oeeomfcilsfm rlump;(0tlerxo3oodla  an s (0srxr(m3nu1lpe lnvt ()aDtmxr nt1optoiocias s elump;t4aeeoxr3oatla rluvslt0s2xo(m iu4lleelfvsa()sDrr(mpoo1tet if3tadfmDemuvon(4arxnxf iydopDraiei;t0srtmxr3nu4al elfesa(faDrm(  ;u4oltnmoctadlm2em(vp (0tltnxf3iadlmD aivs;(0trto(rpio1ap e fvslt  Dra(  oo1tet  oeiasfa ea( s u0altoxrcio1lmDraueo (0srto(r3nydomenlfvtls)artaxro;o0oleo fciytlm2rmnvonu) lerio3tadoa   ies s)texoimpno1altn nvilsfsDraum ou1oeto iciad sDrlums (0aeenxrcootoat lu ilt0teto(r iu1op  lfvia(  2uaurooo1tlto f3tltlaDua( ont0texoxr3oy1latelnvs;t)srtrxo3oy1lmtelfeil( sDta(rpno1optoio3ias mDel(vont) exnmo ty1opDelies;(0seumxm iydlm elncta( a2ururp;t4apenmoctydfm ulu s;() etnxrciotlat  nvo;t  2urio oo4ll n feslt)aDrm(  ou4apen i3iyt a elnmo;(0 rxrio tatlm rau i s)texm(m iodapee netlt) rtm( ono0apxomo3tydla umu on()alenmfcoatfpDeau il(0srxr(o3nodole mncils aDrmx  nu4optn i3iydfs2ra(vp;u4 ltnxf3oytla eauei () eur(rpny4lltelfcslsfarrr( ont1oet  ociadlaDuanvp t)aexrmocootopteln i (  2xrxo3nodlp emiviat sDuru onu4ole  f3iyd sDemums;t0tlerxf ia1fmt lnvo (0setmxm3nu4am   ncil( a2urxm nu4tlxomi3iad m2emn pn(0 ltoxo oytlmDrlnvo;s s2xriopiu1apt mfcsasfa2rru  ot1open o3ild s rl(ms;u4artnifciytlpt  i o;t0s2umxrpiudolte feilsfaruaxm ou4aleomfciydfmDeanvont0aetniociotlpDrlivi;s s2xo(m3io1lm   nvtasfa2tmx ont0apx ifctatlm rlums;(4texoxo ootfp e i s t)s2uo(m iydlp nlfctlt) 2trx  ou0ale iociytfs2eau p;t4aeenmociadfpDr nes;s) rxrir iu4apenmicias) rraxmoou0oee mf3ilslsDem(mpnt)aeenmfciodlm e i i s0 rxriopiy4ameelivt t s2taxrpnu0teenmoeiyt s2eluvp;(0trerxf oatlpt lnei t) rxr(m io1lm   ict s  rrmxmpoo4alx  f3iatfa um(vsn() rxoif3ta1oaD  n sl( trtm(o3oy4lltn fesasfaDumuro;u1tlx ifetldla2rau s;u4 eenir3oatoaDeaneo;s trtoxm3oudlme lict ()sruau ooo0texnmictysls elnvs () rxnxo ia1lm   u o t srtm(o3iydaltn ivil()s2rrx  nu4tltnio3ias aDea(ms;t4arxrxo ootlmt anvo;t srto(o ou1ape livi t)aDum(m ou1aexnmo3iatfaDrau sn(4 eenmf iatfm r u s t)teuoxo iydlme mies s) 2taxmo;u4opt mfetld m2ran p;()tltrmfctotlmtrluvi s s2ur(r3nu4ap  mnetls) 2raxrp;u0aeen f3tydfm2ua( pn()aeeoio3iadfptrlieslt0s2tm(r ou4lp   fvsl(  ruau p;o0oex  ietld s2ua(mpnu4aeenio3tytopDr ivi t)teuoxo iodll emfcia()s2uaumpnt4ope ioeiltfaDul(vo (4aeermr3oy1lpt aieo (0texmiopno1olt lnctas  Dta(mpnu1alxo fciadfm el(vpnu)alxrxf iotopt  n sl() 2urir nudomeemiei tf 2taxrpno4teeomo3tls sDrlu snu)arxoiocto1fmDr ieslt trxoxm3iy1omtelicta()sDrmxrpoo0aeeoii3tlslm2emuvpnt4aexrir3oydlmteaivil(0 2triopiydamenmnvi s)a2taxmonu0alx mictydfmDranvo u4tlermr iydfp  lueilt t2trir iu1olt  fvt ()arurumonu4aleomicilslm2rmump (0 exnir3iy1lateluei;( srtr(m3iydapte nvtat sDtaxr ;u1tlxn ociatfa2ul( pnu4trxnxf3iatlaDeln ils)texoxo3ou4ome  iet s a2taxro;o1opt  ieils a rmnmp t0aetrxr3oy1lm e ivo (0t2um(r ny1apte nvtlsfarrm(rp;o4oexnmiciaslmDran o t0 lxnxr3totlpt ai ol(0t2xoio3ny4apt  ieias) rtrxmpoo1tptn feiys aDulumo t)treomr io1fpDeai ols)teuoxm iudapt  neta(f Dumxm ot4oeeo ietatlsDrl( s t0aexniociy1fmtrlueo s setrxmpoy4lptn ivs ( sDrmur no4oleomicilsfa eaump;()trxoxf3oatfpD luvo;(  etrxr iu1ap nmnctas) Drr(ro;u0oee mfetlsfm2rl( p u4aeeoxfciytla   ivols0 ruoim3iodale mfetasfsDtaxmpot4apxoifcild aDumnvp;u)altoxf iatlmDrluvol()s2tmimpoo1omeelncia()arum(  ;t1tleomo3iltfm2ul(vo;t4 rtnio3iodomDrli s s)t2xo(m3iy1am nlnes tfs2ta(m ;o0apxoioeiys sDemnmp;u)aeenxf io1lpteai il(0tetmim iudalt mfcil( aDumurp;u4alxn fctatfs rmnmp t)tltomo3oatfa rluvi;( t2to(o iodlp elnesat aDrmu  nt1olxo f3iatlaDem(vp;t0texoio3oo1fm elueo (0t2xmxr iu1lm nmnvs s)arumu  oo0apenifetldfm ra( o;()arxrmf3to1oa r ivils0 2tm(m3no1omtemfeia()sDrmum oo4aeeomo3tysls emnvsnt)tlerir tatfatrlu i;( seurxo ou1aleemnvsat)srrrxmp;t4apxomociatls uau onu) renmr3iotoaDe nvo;s)setrio ou4ap emnvs t sDrmxmoot0tpx io3iytlm2eauvs t0trxnxo3ia1lptelivo;s0srurxopnydol e ieta(fsDrr(root4tet mf3iysfsDemnvo t4tetomr3oa1omD aivo;s0seuo(r3iydope lfcs (f 2ra( pno4tex ii3iaslm emu sn(4 eermfcto1opDeai s ( trtoim3oy4ap e ncia(fa2tmxr nt4alxomietatlmDelnvpnu0tlxoirciodfaDean ilt)t2xoio3nodom emfvs t)s2umu pou4openioeils m ulump (0trxrir3oy1fmD  n o () etrxo iu4op nmfcs s aDtax pot4teeniiciad sDumnvon()tltnxr oo1fmDrlnvolt)sruoio oo4lleemivsl( aDrmum no1ape mfeildfm rlumpn(4 ltrif3oy1lm e uei;t) rtoio no1lm elncs ( s2umx  ot4opxnmoeiadfm2ulumo t0trtrxr iatopt aueslt s2xoiopou1ame  feias)srtaxmonu4ape  fctltlm2ea(msn()alerifctodfm  lnvilt  rurim no1ameelfci (f 2uaxrpnu1ale  i3tasfa rl( s (4trtnir ty1fmtrluvs;() rtr(o nydlmenmfvtat)arrrum ;t1oetnmoetadlm ulu ont)aexomrctatoa rli il()srurxrpny1amenlfct t)srumx  nt0apxoio3ilt m ranmp t0artoio to1omDrlieolt  rtrxm3iu1lmt  ics sfsDtm(rpnu1tlt ioctat mDrmnmon()trenxfciy1laDrli i s)trumiopoo4ap emfetls aDua(monu4aee mfeiyd mDul(vo (4alxrxr3oadfa  ln i ()trxoir ny1lpeelfcia(fsrraxr ;o4ale ioctasfs2emuvp t) rtnxfctadfp   i o;(0sexoir3iudam elnct tfaDrmxm ot0olx mieiatfmDumn o;()aeeoif3tatoaDrlnesl()seurim ny4apt  ictas) rrru pnu0tpxomociyslsDel(vp u4 leoir totfat anes t t2trxm nodameelnvilt  2tm(m ;o0oeen fciysfs2rl( p;u4aetomf to1fmDr u ilt)srxm(m iu1al   ivta( a2uau ooo1apt  feiytfs2rau on(4 etrmr oo1om  aivo;s t2xmxrpou4amtnlfctatfaDumxroou4opxomoeild a2ra( p u) etnmf3iatoaD lnei;t) 2umir io4am  lietlt srtr( ont0opto feias m eanvsnu4alxnmf3ia1opD  ies s srum(o io4lmtnlnvtl( sDtmu p;u4altomietadfsDuanvs t)teeomocoydfa eluvi t t2ur(opou1lmeemnes ( sruaxroou1opeoioetldls2eanvonu)aleoxr3iadomt ln i;() eurirpiy4lpt mnci ()aDrr(m ou4apenioeildls2rl(vonu4arxnxfctodlpDraneo t0sexmio iydoptnlieils) rra(m no4tee iieiad s2umu s;t4tetnmfcoodlptelu sl(  2xo(mpio4omtn ieias)s2ua( pnt0tpe  octldfm2eanvo (0arxrir oatoptrauvil(0trumxm3iu1ameemivi (fsrum(m ;t0tpx  ociat aDumnvpnt) lxoio ootlpDe ivs t truo(mpoudlpenliviat s2ta(rooo1aexn ictatls2em(von() rtoifciodoateaivs;s)teumxmpnydlpt mfci (f 2rrxrpno1oetoioctltlaDuanvs;t4aetrmo oo1opDr nvi;s0 2xr(opoy1om n fet (  2urum no0tpeoifctltfa2rmn p u4trxomr3oo1fptrlivols)t2xmxo io4omtn fctlt  Dra(r ;u1apx ioeiydls raumpnt0 lenmr3iotfmDraues () 2xm(r nodlmte ivi t s2tmxmooo4aetoiictysfsDrmu p;t0tltoiociadfa r n s;s0setm(r3no1omee ietatfs2ta(r ou1tptomieiasfm umumsnt0 exomo3oytopDeauei;( seurim oy4ome  nvi sfa2rmxrp;t4openif3iat a ulu o u0teeomocoodlm e ues;()s2urir ou4lmte fei (f Durxm oo1tpt iiciyslsDra(von(0trxnioctydlmD ln i;(0sexm(r nodomtelfviatfa2tm( ooo1tpxoii3tydlaDum( p t4tltrxo3iytoa eanvo t0s2xr(rpiu1omeemnesa()aDrmum ot0aetnmfciltfa2rlu snu) lxrioctatfaD lnes;t0teurirpny4ol e nes ()srum(  oo4tex mfciad m2emumo;(0 lxnmf ty1fmte uvilt trumxo oo1lmen feias)sruaxmono1texnii3tydfs eluvp;u4 etnircty1laDran s ( s2uo(opiydoptnlfctas) rraumoou1oex io3tadfs eauvo;(0aetoxr oodfm  lu o;()srxmxmpnu4lptnlicilsfaruau  ;o4tleoio3iadfsDra(von(4aeermf3tatlaDelnei;t0srxmio3iy1lmtnmivia()artr(mp;u0tpeomieiasfmDulnmo u4arenxf3oadlpDelnvs s0t2trir3ou1amtemivsls sDuaxrpno0ole io3tlt m rlnvsnt0trtrmfcoydoptr ueils texrio3nu1lpen nvs tfsruau  nt1alx  f3iat m ra(vo u)trxnxr oy1oa  lnvols)tetmxo nodamtn nei s arrr(moou1opxnmoeiyd s rmumo u) etrmr tydfa elu s;( truoxm3ny4ale  nvtltfsrtmu  ;o1oet  ieiytlsDel(vp u4tlxrxoctodopt  ivs;( srtm(o iu4lptnlfei s)artax ont0tle if3ildlm uln p;t4 leomo3oy1fmte uvo (0 rxrxo iu1alt  ivias) Drr(rpou0alto oeiyt a emn on(0 rxomo ty1op rln i;t)truoir3iy4lltnmnet ()srtruront0teen oeilt m em(vsnt)tleomr3ia1oat  n o;() 2tmio ny4ole  nvtlt)arrmxmp;t4alt  o3iad a2uau pnt) etrxr ootfptelies (0t2to(r iydop emfvi t)srrax p;o1tltnifciysfaDrm(mpn()texrmrcoydlateau i (0srtoxr nudape lics (fsrur(ro;u4oee mi3iydlm rl(vpnu0texrmf3tatoate uvo;t0trtoir3nydlp emnct (faDurumpoo1aet ifciytls2raumont4aleoxf3totoa elueil()trxrxrpoo1omtnlnetl( srumxm no0olx ii3tldls2emnmsnt4 renmo3tatlaD  ieilt)s2umxr iy4lpe  ivilsfsrtmxr no4tpxoiociyslmDeaumo;t4 eeomf oytlp e i olt teumiopnodape mfci t) rrrx pou4aeen ocildfmDuanvsnt4 rxnifcoytfp r i s;t)setrim no4omtnlfvta( aDtm(r nu1alt mi3iytfmDrm(vp (0aexnmr3ty1lm eluvsls)srtmxrpoudlpenmfeias s2tr(rono4opt if3iytfa2raums u0trxoxrcoadop elnvilt)tetriopoo4am   fetltfsDtmu onu1tltoii3iysfm emumpn(0 eenxr3ia1fmt ln s t0 exoxo nu1lpee ivsl()a2rmxrpoo4olenio3ils a um( onu0arerxo io1lp  lieol( t2xmir3no1oltn neil( s2um(mpoo1apt mfetadfmDulu sn(4teerxr oadoaDraiei;(0trxmxopoo1om  mfct tfa2ur(  ot4tlto fetatlmDelnmp ()teenxo iy1oaD an i t0s2toim3ou1oleelfvs sfa2uaxmont4olxn ieils aDum(mp t0altnmfciadfmt  ivi t0t2xoxrpiu1om nmfes s) rrmu  nt1alxo ietldfaDumumpn(4tltnif3todlpDraivs;t0 eumir no1olenlietas a2umumo;o1tpxomf3ilsfsDra( snu)arxnmrcoytopt an i;t) ruoir ny4optnmfeiatf ruau  oo0texo oeiasla2uluvs ()aleoxrcoytfateai o t s2ur(rpny4opeelivtas a2urxmp;u0teenii3iytfs eau o u0trxrif oa1fmDraueils0texr(o3nydam n nes t a2tm(rooo1alto feiat m2ua(mo;t4trtrmo3oytfpD  nvsl()sexrirpoy1ol nmicia()artmxm nt0oetoioctytls em(ms;t) lxrxo oytlp  ai sl()tetoxr iodoptelivsat sDua( p;u1tlx ii3iyd a uaumpn(4texoxfcta1opt lieols)seurxopiu1olenmncs s)aruaum ;t4teeoif3iltla rl(vsnu)artoircto1fpD au s;( srxmio3oudlme lfei ()arrmx  no0aptomo3ild a ulump (0areoif oydoatran sls0t2xrxr iudlp nmnesa()artaumont1oeeomictasfs ran o;u)tltoxo3iotfmt lneolt sexoim oydoptemnct t) 2rrx ono4tex mi3tyd a rmn snu0tleomo3oatfptr nvolt) 2tm(o3nudol n fvsls)sDurx ono4oeenioeildlmDrlums () lenxf3oo1faDeln i t) 2xrxo nodol e ivtls arrr(ro;t1ale ioeiytla el(vp;()alermf ty1oat aueo;(  rtrio3iydamt mncta(  Drmu oou4tlt ioeils mDua(ms;t0teenmfciytlmteaueo s0sexrxr no4llte ivi () rumu oot0tpxo ociltls2ul( ont)artrmf3iytlaDeli i t0truo(opnudomtnlfvtat) 2ra(  oo0alxomietadfs eanms u) lxnmf3todomt liesl(  rurio3oudlle livt t  rta(mo;u1tlxoioetatla2emu p u)alxnxr tatlpDeaies;s s2xo(m3io1llen fcsl() rua(  ot0opx ifetyslaDum(vo (4tlxnxrcia1lmD lueol() rtrim3iy4apt micil() rtmump;u4oleo ictatfm2rmnvsnt)texrxo3totoaDeaueols  rtmxr oy1opee ieia() rumu pno1oet ifciat m2elnmp t4tetrmo3oytfa  anvo;() eur(r3no1lpt mfvi (f 2rrumpot4opxnmo3iyt m rlnmp t)arenio oydfa e u o () exrirpiudapee fet s) Drm( pot1aeeniiciyt aDrmu o t) lxnio oodopDran ils0seurir io1al elivt s  2rr(  ;t0oleomfeiaslm umnmpn(4tleomo3oydfmtelues t)srtoxmpoydlm   fvsl(faDtmurpnt0aetnmi3tyslaDulnmpnt4aetrif oa1fpteaieo s0t2tr(r3nydome lnvt ( aDtaumpoo4oexoiociatlm2elnvp;u)alenxfcoydfaDeluvs;s sruoiopno4lp emncsa(f Dumu pnt1opxn f3tyt mDeluvs (0alenmf tytlm elivi;()s2uo(opnu1aptelncia(fsDrr(monu1opxoiicilsfaDul( p;t)trxnmr oytomD lu o s s2uoim3iudaleemictlsf Dtm(m nu0aetn ociyslsDumnms;t0 eeomo3ootlate ues t0trxmxo oo4ame lnvs t  2raumpot0apeniiciltfmDrm( onu4 ltnifcoo1faDrlivo s)srtoxm3io4omtelneil(fsrtr(  ;o4apx  ieiadls2uan s;u0altrmr iy1fmDr ivi;s)tetoio ny4ome mncsl(fsrumxm ot0apeo o3tltlmDuln s;u0alenxo3iatfp e neo;(  rtrxr io1apte fcilt) ruaxmonu4aetoioetlt s emumo t4 rtomo oy1lmtrlnei t0s2tmir3io4altnmncs s arra(mpou1tlxnmfctld a rmuvsnt)arerxo iy1fmDe uvilt) rxr(mpiudom n ivt sf Dra(r ou0tle mf3tldfa umumo (4tlxrxf3todfatran il( t2xo(m iodomenmneiasfarurx oou1oeen f3ildlmDrmums u)trxrxfcty1fa e neo;() eumimpiodom nmiciatf 2rrxmo;t1tleoioetldlmDrauvp;(0aexnmf3tytoate uvsls)srtrirpio4ope  ieta()a2umumpnt0apt mo3iydlm2ulumpn(0 exoio3iodlptrluesl()srxo(opiudom emfeia(fsrrr(m ot4teto f3iadfa ul( snu4texnir3oo1fmDe n o;(  euoim iy1omt mici s) Dtr( pnt0tptnmf3tldfm emu s (0aexrmoctatoaDe n sl(0 euo(mpnodamt lnetl()aruax  nu4texo fctldfs2eanmo u)aexnir iy1omtelivs;t)t2uoxmpoydlle mfeilt)srtru  nt4alxo feiyt a2uaums;u) rtrmfciydoaDr ues s) rxmxo3oo1omenmncias)arrru p;u4tee mociys m uan pnu4trxnio iydlp r nvs t  ruo(m iu4ol  lictlt a2ta(m nt1alx  fctas s2em(vs () lermo iodfa r n s s truoxm3iudlm emfei s)sDta(mpoo1aexnmi3iydlaDumums u0tltrxf3todlpD ln s;t) rxmxm oydoleemivi s)a2um(  ;u0ape  iciytfm2elumon(0trxoio iatlat luei s0trtrir iy1amt mivtlsf Dtm(  ;o1olxn oeildls elnmp ()tltoxf3tytopD aivsl(0 2xrxr3oydalen ivia( sDta( p;o1aeen octldfm2umn o;u0trtomr oadlpDeau s;s t2xo(rpio1op nmietatfa2ururpot0oeeoii3tytlm2ulnms t0texoxf3totlm r ues s s2tmirpny4am n nvi s)aDrm( oou0teeomo3iad a ulnms u)tlxriocoy1lm  auvol(  euriopiy4al nlies () 2ta(ro;o1tpt mfctyt mDuanvo () rxoxo3oa1fmt au o;t  rxriopoydop nlfeiat srurxrp;t0oeeo oetydlaDuaumsn(0 etomrctodlp eln s () eur(m3nydam  lictasfa2trx  ot4tet  feiatfmDuanmp;(4arxnxrciy1lm  ai i ()trtriopoo1lmt lfesa( sDtr(mpno1tpe mi3tatfm2em(mo (0tetoifcootfat livi;s s2uoxo3io1ap nlfes t)a2taumono1oeen oeilsfa uluvo t)aetrxf3iadfmDrlivi t)t2xmir oy1lm nlfct (f Dtaxm ot1tpx iieildfmDea(monu0aleoif iodfp  li i s0trurir ny4ole  ivil( sDrm(  ;t1tlen ociyt sDrln sn()teerir3oatlp  anei;(0 2uoio3oudlp n ncslsfsrtmump;t1oexnmf3ias m umn p;t0alerxr oo1fmDe ivs;s0srxoxmpno1alt liciat artm(rpou1tltomocildfsDrmn s;()alenio oadfmt luvils trurio3oodopenmncsls)sDurxmo;u4tee  o3iys a2ranvp u)arxnxo3tydla rlnei t)srtr(r3iydap  livt s) rra(m nt0oet iieildls ulump;u)alenifciytoaDe u s s) 2xm(o iudame  fei s)sDrmx oot0alxomietyt mDuan snt0 lerir oo1fmD  n s;(0srxrxr nu4al e icsl(fsrrmum ;o1oeto o3ias aDemumpn()tlerifciatfptr nes;t)srxrir3oudamt mfctasfs2rmu  no4oetnmo3tas s uau p;t4treoxociatfmtranvi t srtrxo ou1omt mfciltfsDumxmpnt0tpeomo3iyt a raums;(0 lenxfcoydlmtrai s ()truoiopoy1ap  miciat)arrr(mo;t1apt  ociysfa emnvpnu0arenxf3oatlp  au i t trtr(o io4ame mivt t)sDtrxmoou4oeeoio3iadfm2rmu o t)trxoif totopDelneo;( srurimpoy1lmee fvsasf rtr(  nt0tpt mf3iys s el(vsnt0artnxr3oa1lmtrlnvils0trtmxopoudal emies s s2rmxm ou0altomi3tat a2el(msn(0arenxf3iy1oa  livi t) 2xmxmpnu1lleelietlt a2umurooo1ape mociydla emnvo;t4areoxr tydoa   uvi;t t2xrirpio4apeemfesa( srumxmo;o0tlx mfcilt mDrlnvo;t)trxoir3totfmtrlnvi t texoio ou4amt mfvtasf 2urxmoou0tpeoiicilt m2em( p;u)tlenmr3tatfateaivslt0s2xmir nu4olee neta() Dur(rpnt1oeeomieiasfm uau sn()aetrmr3iy1lmtranes;(0 2xoxmpoy1lleemivilt aDrmxm ;u0tlt  ociaslm2ra(vonu0alenifcoo1lmD luvsl() rur(o3no1omt mfeias s2tau pou0aeeomf3iydla2umnmp (4 exrir3iydlp elnvsl()s2urirpoy1lmeemnesas) 2rau o;t0alxn f3iyd mDrlu s ()alerifciy1omtr uvs ()teumxrpoydlp  lnctlt s2ta(ro;t4tetomiciatfs eluvpnu4 etrirciydlmtean ol(0trtoiopnodlltn ncta( a2trum nt4tlx  iciyt s2rm( s (4artoxf3iytlmDe u sls0seurxr ny1ole mnesat) Dtau pot0oetnmociatfsDuaums;()aexnio3io1oaDeai s;s s2xo(r3ou4ame livtls)sDua( ooo1texo fctad a uanvp u4alenmrcoo1la r ues;t0sexo(mpiudop e fctls a2trxm ot0aeenmfeiltfa ra( s;()altoxrcoy1fmD au o;( trtm(r3no1llenmnesa()aDtmxm ;t1olxoiocild a2ulu p;(0trtrir oodomt  uvs s0truoim3oodlpeelfetatf Durur ;t0tpxomf3iydls2em(ms t4arxnmocto1lmteaueilt srtrxrpnu1al  lneta(faruau pno1tetomo3iyslaDraumo;t0artnmf oo1omteai i;t  eum(m3oo1opt mivta( s2rmxroou1oet if3iys m2ulu ont) rtrif ootfa r n ils srxrim oydol   fcils a2tmu o;o4apxnmieiasfm2rlu snt) rxoxo3iadoa  aneo s sexr(o no4aptemictls)s2tmx onu1apx ioctasls2rm( p;t0texoio oy1fpteluei;(0t2umxrpny1ameemfeiasf 2tmxmp;t4tpx iociad m2uluvo t)alxoxr3ia1om e ivs t  exo(o3oy4am n ivsat) 2ra(  ;o1ale mo3tlslm rm( pn()tlxomf ia1lpD aies s0t2toio3io4oltnmnes s  Drmxr ;u1tleomo3tadlaDul(mpnu4aetrxf3ia1oatr i s ( trxr(o io4ome mfet sfartmxro;u0opxn fciyslsDem(vsn(0trerir oydlpD aivils0srxoxo3oodapenlicil() 2urx pnu1alx iiciltls2rau o u0aeerxo3ty1faDe n s;() rxoxo3ou1lmtnmicta(  rtru  no4oetnmoetld s rl(vs t) etrxr oydlpDr nvolt0trxrio3nudalen feias sDur(root4aexoiietat s2em(vp;t4aeenmrcio1fat  uei () rxoim no1om   ictas)sDtr( pno0tee  i3iyd s emu s t) exrmr ootfmte u olt0 ruoiopnu1lltnliet s)sDrrxr ;o0olt mo3ilt a2umnvs t0artnir3ty1lmDr nei t0texm(opiudapeemietas) 2um(root1oleo feiydlm emuvo;t0arxnmf iatfmD  neo t  eto(rpoo4lpenlivt s a2trx pnu1tlxnmi3iat sDrmnmo t0 rxnio3iadfm e uvs;s)srtrxr3oy1oltnmfct s a2tr(rooo0alx  ocildls rl(vont)artoif tadoa  au slt0 2urxr nodaptelnvt s aDrmumont4opxn oetytfs eaums t0alxrmr io1omtr nvo;s setmim3iodom n ies (f Drrxrpno0aeeoifeiysls2um(vo t)alxomfciadlp  aieolt0trxmxopoodamenliet tf rtm(ro;u4apx  iciltlm2em(ms;u)artomfcoytlaDe neils) 2to(r3nudlpen nvs s s2uax o;o1oee iociyd a2rau o;t4areniocoydopD an ils) rxmxopoy1altnmicias a2rm(rp;t0apxo o3ild m2rmumo;(0tlxrmo3iydopDelueo;( srxmirpiydome licsas aDra( o;u4tex mfeiltlm ra( p;t0aetoiocty1lp eli s s)t2toxr nodoleemfvi sf Dtmxro;t1aexo octlt m ulnmont4arxoif iy1omDelu i;t0t2to(o3iy1omenlfeiltf 2trx oot1opx moetls s2ran o () lxrir ty1lat lu slt0 rto(m iu1omeelfeiatf Dur(r ou1oltomoeiltfm em( p t4trxrxfciatomDrlu i;(0srum(mpny1lp  mnes t  2urxmooo4tpxoifciltfa rmu s;t)aetrif oo1fat aieol() etrir3iodapeelivta( aDuaxrpou1altnmi3tatls2uluvs;t0aeenir3oodfp   i ols)srxr(opoodom nmieils  2ua(m ;o4openio3ildfa2rmuvs;()trtrmf ootfp  ai i;t sexrim3oy1aptn nvtl(f 2trx pnu4tex iocils s rluvp t4texnxfctodfm ranei;t0srtoiopiudam elicsas s2ur(m ;o1tpxnif3ild s2eau onu0 rxrmr3ia1lmtr ivi;s tetrxm3oydlltemfeiltfsDtru ont4apxnmfetldls2emn on() rtrmr3oa1fptr n s;t)trxrio3ny1llte iesas)sDrmuroot4olt moctytls2ran pnt0tleoir oy1fa  anei;s)teurxopiudom nmies t sDum(m nt1opxnmfciadls rmn s (4altrmo3iodoa eau o () 2umxrpio4ll n fcsa()srurxm oo1oex  feiadfs2umnvo;u4 eeoif3tatop ean s s texm(mpnudaptn feias aDrmxr ;u0open f3iydfs ulnmpnt0 rxoxrcoatlpDrli o t)t2xmirpiodlptnliet ()aDrrxmoou0tle mocilsfsDul(vs;t) eerir todomD  ivsls0t2umxrpnu1alt micsa() Dtmu poo4tle if3tldfm ra(vpn(0 rtnifctadfptrlu o;s) rxo(m3nudamt mfeils s2rmxront4aetnmieiys s rmn pn()tlxnxo oatopDrau i;() 2xrxo ny1op nlicsl(fa2ra(root1oee  octltlsDran sn()aeerxo3oatfate i i t0 2xmxr3nodlme lfcs sfartmu p;u4oltnmi3iyslaDranvs;t4tlenmf iotfp rln s;t)t2ur(r3oo1optemivt sf 2tm(mooo4tpx  oetadfm2em(vo;u0aetomrciotlpt  ieo;t  ruoio oydlptnlnei s)aDrr( poo4aex if3tltfm2rmnvo;u) rerxociy1lpt  neo t s2xoirpno4lp elnetas)aDtr(ro;u4ole ioetytfm rl( p t0 leomr oydom eli o ( seurio3oy1opte fct s artmuront1tltomicildlmDuln o;u)aeeoircootlm   ieols seur(m3iu1ap nmnvsl(f rtaxrp;u1olxnioctlslm2uln pnu4tltrmocoytlmDrlueo;t0 2tmxr3iodap  mfcias sDtaur nu0tlxnifciytls2el(mp t0treoiocoatfaDr uvo t teto(m3oudomtemiei sfaDta(mo;o1tlt mi3ils a2ul( o t)artrxr ty1lmD aivi;s)setoxr3no1ome lfeil(f rur(rpno4tlt io3iadlm2umu p;(0aeerirciy1lmD li s;s0sexrxmpiu1olt livt tf rtrxr ou0apxoiicilsfm rm( p u)tltnxrcoadfa e uvols s2um(m ou4aleelneia(  2um(mpoo4oltoii3tatla eauvpn(4trtoif ty1laDraies s trtoxr io1lmenmivsa( srta(monu4ole mfeiydlaDran snu4artnxr ty1fatrln i (0 2tm(m3oo1ll nmivsls)sDrr(  ;t0aexo i3iad s2rl(mo;(4artrir ia1opDrlivi t  ruo(m ou1ol nlfvt t  rrax o;t4alenmfciytla elumo t)aetrxf3tydoaDeluvs;t0texrxopno4apen neilt  rumump;t1oee io3iytlm rm( pnu4 ltnif3tatfpteai o t s2uo(mpny4alenlicias srrr( pou1aptnioeiad sDulnvp;u)texomf oo1omtran ol( t2umxo3ny1optemfct (fsrum( pot1oexnifeiatfs rau snu)areomrcoatfa ran olt)texo(o oydol e ncsls) rumu poo4tlen ociltla rau snt)aexomf3iatlm  lnvs s0sruoxm3ny1ll emict (faDrau ont1tpe ifciad sDean sn(0 eermo oytfpDelivi;s)trtmxmpoo4ll  mfci ()sDtm(ronu0tltomfeiytfaDul( on(0aetoif3ia1lpD lnei ( s2xoimpnudape  nvs s)artmxr oo4oetn ocilsls2ua(vp ()trtrxrcoa1oaDe nei (0sruoxr3nu1omeelfvi (  Dumurooo0aex mfetld aDulu pn(4aetrio io1late ivslt)trtmxm ny1lp n netl()srtrx oou4tex ifeiydfm2rmuvp;() rxoir3tatoate nes;(0 rtoir nu4lmtnlnvs s  2rmurpnu1oltnif3tlt m2ulnvo (0tlxoxr ta1fmtran o;s)teumio3ou4ll nlfvsa()s2tmxr nu0tlx iicilslm2rl(vs;()texomr ia1la elivilt)s2xoimpny4llenlnvt (fartr(moou0oet  feiytfaDel(mp;(4artnmr3oadfm eau o;s0trumir3oydapee ivil( sDrruroou0tet  ocildls rmumonu4alxoxfcoa1laD  uvs (0tetm(r no1opt mfeilt) 2umx pnu0oeenmi3iatfm2uanvonu0trxrxo iydfmte neo;s0 eto(r iodolt  ics t  Dtm(r ;o1optn o3ilsfm umn pnu) etoxrciodlmtrauei s) 2urim3oo1lmtn ietat)a2trxr no1tetn oeiydfa2eau snt4tlxrxf3iadfmDe ivil()s2toxr3oudal nmieias  Dtrxr ;u4tpxnmoeias m rluvs;u4teeoxf3iodom  lneo ()trxmxr oo1amtnmici t)aDrax ooo1aptoif3iyt sDrmn sn()artrmfcoatlat au i;t  rumim oy4llt  ieta(f Dra(rp;o0texo f3iydlm eanmsn(4 etrmo3iotfmDr u s () exrxo oy1ol nlfcilt) Drau poo4tpx ioctytla2ua( o;(4arxnifciotfmD  u o;(0srxriopiydal n ies s sDta( p;o4ope iictydlmDulnmp (4tlxnmocoatfmt  ues;() 2umir ou4lp nmieta()sruaxm nu4aptnmi3tat s2ranmo;t4 ltrxoctadoat aiesls srtrxr3oy4amtnmieiatf 2rrxr ;u4olenio3tysfa rlnvp t0tetnxf3ta1lmD  nvol( s2uoxr3oydomtn nctlsf 2tmumono1aet  ociadfa2rmnmsnt0artnio oy1lpD aivo s0trxr(m iydome lnvtls arua(r nt0oltnifeiatlm2em(mp t4texnxr iytfpD ln i;()setrxr3oo1al elfvt sf rumxmoou4tlxoio3iadfm umu s;u4arxrifciodfmD  iei;t trxrxr iu1aptn ncs s s2rr(  nu4tpen ociat m2rauvo t0treoif oa1lp eaneo s0s2uoimpiodoptnlfcsltfa2tmu pou4oex  o3ilt s eanvp t4aeenir oo1lpDeaivi;s  ruoxr oydaltnmfvsl(fartmx o;t1oeenmiciytls2ra(ms;()artnmo ia1fp  lu o;t) eurio iy4lle mfetasfs2rrurpoo4aptn i3iyd s rmumo;t0 exnifcoatlp eai o;s0s2xoimpnu1opeelnesl( arrr( pot0ole  ocilsfsDrmnmo;u4alenif totlpt lieslt0 exr(mpnu4op nmnvsa()srrrx o;t1alxomfeildlsDrlu pn(0trtrmo3oo1lmD  n s ()srtm(r3oy4ome  fetls) 2um(  ot4apxoifctytfmDuan o (0 lerxf3io1faD ai ols s2xoxrpnu1oleelict t  rrmxm nt0tlenmoeiadlaDeanms;(4 exrmr ootlpDrlnes t)sexoxrpnu1op emfei tfsDtm(ronu0ope ioctasfaDrm(mon(4artomrciodlmDran ols0srxo(r iudlltn ietl()sDum(rono4oltomi3tytlm emu snt4trxnmo oy1fm eli il( t2tmimpio1lleemnesas)s2uau  ot1apeo feiyslmDrluvp t4tlenxr ty1om r nvi;(0trtoiopou4optn fet t)a2rr(m nu4opt if3ild s2rmump;t0areomr3iydop  ai olt0trxm(r3oodlmen ieta(farumxr ;t0tptnmi3tasls2uanvo;(0trxomr iy1fa e nvil() rtmxr3oo1lltnlfet sf rtaxrp;o4alxnmo3tyd sDrmuvon(0 rerxf oa1lpD  nes;()sruo(r3oydllt  ieilt srrrxmoou4tet iieildlm2ul(vo;u) etnif3oa1opt au i s) rtrimpio4omenlfesat)aDrmum ot1texnmiciys m2rmu s;t4 rermf iadoat li sls)setrxmpou1amtemfeiatfsDrru ont1alt mociyd s2ra( o u0artomr3oatopD lueolt)srxmio nu1ape liciat aDrm(r ot4ope mfetydfs2um( o t) rxrxr iodoa r uvs;(0sexo(r iu1lpt mncsat)a2rmumonu1apxoiociyt m ul( p;u0tltrir3iotfm  livs (  etmir io4aptnmivt s)s2uaumpnt0opt moetaslsDelnvon()tltomrcoo1oa r n i t s2tm(mpnu1ap nmietat) rtr(m nu1opx ifetadlaDumuvo;u4aeeoxf oadfmte u i;s0s2trir io4llte iet t arra(r ou0tlx  iciydfs2eanms ()aexnxfciytfptr nvolt0 2toiopoudapenlnei tfa2uaum no0tex mf3iydls eluvp;u4 rtnmocootfp rlnvi s0s2xmiopiu1llt lieils)a2ta(mpou4aeen ietldla2rlumon(4texrmocoytoa elivi t  2to(rpiudlptnmicsa() 2rmump;u4apt  o3iyt sDem(mpn()aleomr ty1lpt lueo s0s2to(mpnu1ope  neiat sDumurp;u4teenii3ildlsDraumont)tlerxfcoydomt lu s;s trtrxr iudlm emfvilt s2tm(rp;t4tpx mfeiadfa2ea(mp (0teenir totlmDraivil()trur(m nudape liei (  rurumoot0opxomiciatla em(vs;t4aleoxrctodlate neil() etoim oy1ol   iesat)sDurumonu0aet moctytfa2rlu s (0tlenmocty1omD lues;(0trtrim3iudoleelfctat) 2um(ronu4teeomo3ild s2umumsnu)texnmrcoydfmDeau i;t t2xmxo oo4op elfvil(fsrtaxr ;t1aptnmictasfm2ul( snu0 reoio ty1fpt  neo t  eum(m iy1am e fvtlt)srrr(mp;o1tle mo3iad a rl( o;(4aleomfcootlaD ai i;t)s2uo(opou4ap  lncsl( artaur nu0olxnmo3iys m emn ont4tlxnmr3oydlmtraivi;s srtr(o oo4optelfvs tf Drmu p;o4tle mfeiys s eln s;t0texoxrciydopD li i;s)s2trimpoo4ll n fctl(faDur(mpno1apen ictlslmDuau p t) eenmf iydopt aneo t0 rurxm iu4olt  iei ()aDrmx onu1aleoio3iasla2el( snt0tlermo3iy1faDr ivils0srurim3iodol nmfvta(fs2trurpoo1tptnioeiad a2em(mo (4aetnmrciodfm   ueilt s2xrxo iodlltn fesl()srua(m oo1aexnifeiytls2rmuvp t)trtrircia1lpDelnes;s)trxrim io1ll elfesa(  rumx  ;t1tlxo f3tltlm2ea(vo t0aetoxf tatlat lu s ()tetoimpno1lpt lfvsl( sDuaurpot0tltnii3iyt sDra(vonu4trxomo ia1opD  nvi;s0 2toim iu1apeemfvsa(fsrrr(r no4opt iocilsfm rl(mo;u)teeoir ta1oa r u o;()s2tr(r3nydomt licslt)s2umx pnt0tptn oeilslsDuluvs u)trtnmocoy1oa  livo;(0 rum(m oo1ale mnvia(  2ur(mooo4olt ioeiasfa um(msnt)alxnxr3tydlmteaueils0t2tmxr3ny4opt mivsatf 2tr( o;o0ope  f3iytfm2umumo;t)altoio3tadom rluvs t0s2uoir3io1oleemnctls)s2uaumoot1aetnmicilsls2ua(vp ()alxnmrctydfmtrln o;s0 2um(m iu4ape lnetls aDumxr nt0altomoeiytlsDrl(vp ()alxnmo oodlmt luvs;s0s2ur(mpoudamenlfcsas)sDrmxmpot0alxomictltfm2raums;t) exoxf3ty1omt auvolt  2tmio3iy1om emivilt)a2truro;t4olt  i3iysfa2rln p u) ltrifctytom rli s t0srxrio ou4lm  lnetl(fsDtau ont0apenmfcild s2um(vo u4alenxr3tydoat  i o s)s2xmir iydameemneiat a2tr(roou1aeenioetysls2rau o;t4aexomf oatfpt  uvolt s2to(r nu1lle  net s s2trxmo;o0texoio3iad m rl(mo (0 ltnmo ia1lpte ies;s)s2xoxr3iy4oltelnvsltfs2ur( poo0ope mfetasla em(vont0tetoioctodop rluei;(  etoio nu1omee fvsat)a2rm(m ou1ale  fctadla ra(mon(4 rxrmocoodopD ln ol( tetm(rpoy1alen nvia(  ruaxr no0optnio3tytfaDeanvsn(0 lxomo oydfptelu sl(0setm(rpnu1ole lnvt t) rtaxroot1texoii3ilsfaDrm(vp;()trenir tytlp rln s;s s2tmimpnodopt  ict t sDuax onu1oetn iciasfsDrmnvpn()teerxr3todom  lnesls s2xo(r3oy4ole mfcs () 2raump;u0olenifeildlaDrlu p t)aexrmrciadlpt aiesls t2xoio oudll nlnesl(fs2trurp;o0tpe mf3ias aDuauvsnt0 etnmfciy1opDeanvs t  2umio ny4opee fct (fs2tru ont1ape  ieiydlm2umuvs t0tltrif iadomtr uvo;()t2urxo ny4llt mivi t sDur(mono4tlx moeiytla2emuvpnt0 eermr3ty1op  au o t texrir3iydomtnmncta(f 2ur(m ou0aeen ietadfa umnvo (0 lxrif oo1lmD  n i s sexr(r ny4lmenlies (  rrmurpnu0ope ioeildla uanvo ()tetrmo3oytfate u o;() rtmim iodamtnmfet tf Drax ont4oltn iciyd s el( s t) lxrif ootfaDeanvi s seumxm nydape lict (faDrr(mpoo1aexomo3iysla rm( s;u0alxnmf3ty1lmDeaieols0seto(m oy4amenmfvtlt)aDtau  ;u4aleoifeiasfm2rlu sn(0 ltrxf3totlm e n i s trxrirpny1lpeelies ()s2uau pnt1apeniietyslaDean p u0altoxf3oadopD ln s () 2toim ny1alte iei sf 2ua(mp;u4aex io3tas aDuaumo t4 etomrcoa1laD ai ilt srurim iu1om   netl()aDumur ou1apeo o3iltfm rau p;() eenio3iy1fp rlies;t) rtr(m3oy4lpenlieiat)s2umx  nt0aex ioetlsls2ul(ms;t4alxrxo oatlaD lieo t0 etoxopnu1llenlicta(  Dua( ooo4apt  o3iys s2rln o;()artoif iodom rauei (  rtoim no4opeelies (faDumxrpou4aptn f3ildlm2uluvonu0 rxoio oa1omDrluvslt) rtoio io1opt  ivia()sDra( oot1aex  ictyt m2emn s;t)trxoxrciotlpD anvsl( srurirpoy4op elnesasfaDtm(rpnt1tlxomf3iydfm2ul(msnu)aleomo iatopDeai ols0s2xriopny4opeemfciat srum( pou4aptoif3ils aDua(mo;(0 lxnircoa1lpD li s;t  2ur(opiy4optnlivi t)a2uau pnu1oltnmoetasfsDea(vs t4trtnmr3iadomteln o;t0 exrxr iydlp   ieilt)s2tmu o;o4apeoiietytfa2ra(mpn(4trxomfctadoa eaneils teuo(o3iodol   fvtltfs2tr(r oo0teen iciltfsDelumo;u0aleomf ootfp eluei s0 2xrxo nudameemncta(fsrrax  nu0optnmf3iyslsDulnvo t0tetrmfciadlm rluvols sexoxmpio4lle  fci (f Dtm(m no4optnio3iasfs emnmp;u)aeeoiociodlm  anei;s0 rto(m io1lpenmfetltfaDrm(rpnu1tltomo3ils mDulums u)tlxomrcoo1lm eln i;s0s2tr(r oo1altnlfvtl(  rtrxmpnu1ape  iciyd m2emnmo;(4teerxo3iotoa eai o (0 2xr(o3no1am  mietls)s2trxm nt4apt  ieilt sDul(mpnt0tlxoircty1lmt  ueils0 rtoxr iy1om e ivias) Drr( ont4apxo feils a2elump () eeomf todoa r ueilt)trtrxm3nodlleemfvtas sDumur ;t4opxo fciad s el(vsnu) etoifciytlp r n il(0 etmxr3iy1olen icsat)aDtau ono0tpeomfctldla ean p;t0tltniociytlmD  ieo;s s2uo(o ny4amenmfvtlt) 2rrur no4apxn iciasfa2rlnmp u)alxnmo iodfpte uvo ( srtr(r3oudomtnlnvias)arurxro;o0ole  i3tytlaDemuvo t4 lxrmf oo1opDr iesl() etmim io4am   ncil( sDtru pot4olx mieiltfs2uaump u0artoxf iadom  lieils0tetm(o3iydomt lnet s) Durxrpou0tlt iicilsfmDeaums t4tltomf to1om r u o;s trxm(r3nu1amt  ivilsf rururo;o1aexo ieiasla rm( o;(0teenmo todlpDrli i (0s2tmiopno4olee fetl()sDum(r ot4opx mociydla ea(mo;u4teerxfctotla rlneol()t2ur(mpnu4ale  ncs () 2rmxro;o1aleoiiciatfm2uln p;u)altrioctatlp  au s;()seum(m3oy1am nmfvtl( s2ta(mpnt0oex mo3tas mDumn p (0 etrmo oadopDrlivsl(0 rxoio3nodlpt mnctltf rtr( p;t1aee  f3ildls2ran s;u4tetomf iatfaD anesl(0t2umir3oydome licsatf Dum(  ;t4tlx micild a2rauvpnu4tltnif iydop ranvolt)t2xmim3iy1llen fvtls s2rmu pnu4tpt  f3tyt mDul( o;() etoircia1faD  i o;()srurio3ou1apenmfei (faDtm(  ;o1tee moctydla el( o;t0artomrctytfa  lnesl()trumxr nudam emici s) Drr(mp;o4alt ifciadls emump t4tlenmo ootfmt  i s ()teurxrpnu1amee fvi tfs2rmxrp;t4tpen i3iys m rlumo u) eerircoydopD ln s;t0 rtoxm nu4op e nvtl(fsruru pno1aptnmi3tlsfa emnvsnu)altnmocoadlatr n o;(  2xmxopoydape mfcils srrm(mo;t0aee  f3iaslsDemnvpnt0 renmf oo1omD  ivo ()tetrxrpiydamenmnciat a2tr(ro;u1oet  i3iydlmDrlumpnu4 etnxo to1lptrlnesl(  2uoxopio4lp nliet t aDur(rpnt0aet  fcilsfaDul(msnu0altnxo iydop   iei;t0seuoim ny1ll n ncilt srtaumono1oltoiicild s umn p ()texomfctydlatrau s;s)teuo(r3nydaptelnvias)a2urum ;o0aeen oeiadfs elnvo;u4 rtnif3oatomt  u il(0trxmxopny1omeelfei s  Drrxrpnt4teenmfeilsfsDrau o;t4alenxociytfptrlivilt0 eumirpiodllt  fesatfs2uaxrpoo1teeomiciyslsDrmu pnt0aeermr oa1lmt aieols  etrxrpny4lle lies t  Drau o;o4tltnmiciys s ea(mo u)arenmfctytopDr ieo;t t2ur(r3ou1llt miciasfs2tm(rpnu1oetoiicildfm2uln o u0 rtoxf3oo1fm ranes t0s2um(rpoodapte nci tf rrmxro;t0optniicilsla umumsnt)tlxnmr iadlptrln i (  etrirpnu4amt mnci sf Dtr(m ;t0aeenio3iasfs elnmont4 etoir3oa1fp ean sls0 2ur(r3no4ape lfvta()sDtr( oou0tpxniociadfa ua( snu0teeoircta1lpD ai s;() exmxo3iudaltemivtl()sruax pnu1oltnmi3ildls2ua( o;u4trenir3iadfp  lnvs (  etrim iu1llenmneslt aDrrumpoo0tleomf3iltfa emumsn() renxf iy1fmDeaiei t0 rtmir oudlpt mfvsls)sDrmxmp;o4aexo o3ild mDuanvp;()artnxr tadfatean s ( trto(o3oy4am nmicia(fsrraxro;u4tpx  i3tadfs2ran p;u0 rerxo iodlaDelieo (  rtoio3nydlpe  icsls) rtru pot0tlxo iciltfs2em(vp;u0texoif3io1fa rlueilt)tetmiopoy1aleemfcta( s2uaumpoo4tlxnifeiad sDemn o u4altnio3oy1fpDeaueslt)s2uo(r nydal nmfes sfa2rr(ro;u4apto i3tysfm emnvp u4areoifciotfp eluvs;t0 2xoim3no1ape lfvi (fa2ra(rpoo1oeeomf3tytfm rln onu4altrif3oy1lptrluvil() 2toxopiydamee fcsatfarrmxm ot0aeenmocildfa2el( s;t)tlxrxfciytopDr ivil()trxr(r3ou4llenlfeia( sDur( pnu0texnio3iasfm ua(vo u0tlxnxo iotoaDelivi;s) rumimpoo1lm nmneilsfsrta(moot1olenifeiys a2emumo t0 rxnmrciadopDrln o (0 exr(r3iy4lm nmnet tf 2rmur ;u4tptnmo3iadls2uauvpn() rxnmo to1lpD  neol(0t2tm(o3io1ope lfvi (fs2taxm no4tltn oeildla2eau s;(4 eeoxrcty1lmDeaues t seurirpio4amee fct t  Dtr(rpnu4apxomf3taslmDeluvsn(0texnxocty1fatrlies;(  ruo(m io4lmenmfeiltfsruau pot4altnif3iadfaDrl(vp t0tetnirciytfaDrlieo;()t2umimpiudll emivtatfarurxmp;t0teto f3iat a um( on() exnio3iotfpte nvils0t2xmir io4ope  ietl()artaxmooo1aee moctytls em(ms;(0tlenmo3oy1lp ranei;s)t2toirpnu1amenmnvils sDtrxr ;o1tex iietytfaDumumo;(0 reoxocoadlatrauvo;(0 rtoxopoo1ap nlfvtlsfsDraxm ot1tetoioeiad m2em(vp (4arenxfcoytfateauvi (0 2urim ou1lp e ict t)arua(ro;o1alxo icilslm2ean p (4tltrxrcoatfm e neo;s  rur(o oydlm emncs t  Dumump;u1optomo3tatlm2ua(ms;u0tetnmo3iydoaD  iei s0t2xrxopno1lpenlfeias)srur( pno4oex  i3iasfa el( o t0texrxfcoa1fat ai o;t)t2xrxm nu1lm n ivsasfaDtrumpno0aetnio3iasfs rln s;t4arxrmrcto1fpDr n o t) rtrxr oy1aleelncil(f Drax oou0tlenifeiysls2emu s u4tltrir3iy1fpDeln o;s) etmxo3oy4omenlfcsa(f Drax pnu0oltoifciltls2rmn p;() eerxf3oodoptr ivo t0t2umir3oo4ll e ietlsfs2rmxmp;t4tlx micild a ua(mpnt4teenxrciodfpDr nvolt  rxrir iu1lltemfciat)sDuau oot4tee  octltlm2emn s t)tltoio oy1oa   i ilt0 etrimpno4am n fvilsfsDum( pou1olxnmietas s2uan snu4arxriociytoaDeln o t)t2ur(mpiydlp  lfei ( a2urumpno4oetomo3iltfm el( s u)texrxr oytfptrliesl() eumir oy1ap elnvilt)sDrr(m ot4tpx mociydlmDumn p;u0arerxf oatomDranvi;()sruoxm iydalte fvilt sDrm(  ;o4alen i3tytla uanvo;() etnxfciadlm eaies;()t2uoxm no4am emivtls)s2tm(ront0tpe mo3ias s raump;u4 ltomr totlaD livil()teumir oodom  mfvsasfa2raum ot4aexoifetyd sDra( on(4teerxfctadfmt luvs t sexoxm3nodlpenmncta(fa2rmumpno4tleo i3tldfa uan o t0tltnxf3iadlatrlues;t0srxrxopiy1lp n ivt (farrau p;u1alx ioeiysfs um(msnt0trenif iy1lpDelu o;t  rur(m3iydapt  feilt)a2uru p;t1olt iieilsla uaumo t0 lxrmfciy1lmDe nvo t)trxmio3iydalen ics t a2rmx o;t1tlto octltfmDemu pn(0 etomf3iatoaDelnvil(0 2xoxo nudlmt mfet () 2uauroou1aexomociydlsDemnvpn(0treoxf iotfatelivol(0sruriopnu1ame mnesasfsDtrxmpnu1oetomoctysls2ul(msn(0treomrcoytlmt  ies s0 eur(r oudoltemnvs t)srrmu  ;o1oet  ocilt m rauvs;t4treoifciy1opt aivi t) etriopoo1lmtnlivilt s2rr( oou4apen ieiadlsDul( p t)teerxr ootoptr ieolt)seurio nydll   nctat aDtruro;t4tltomiciasls rm(msn(0teerxr3totomtrli ilt)s2xmxrpiy1om   nvtasfartrxrpot4opx iiciytfm2umn ont0tlerxociydlpte ies s) rtrimpnydlptelnct sf 2tmxm ot1tleo o3tysla emnmo t) lenir tytop  aiei s s2toxm ou1am elfcil() rtmum ou0alxnmfciys mDul( o t)aeeomo tadfp   uei;( sexr(o3nu4omt micsl( sDrm(rpnu4aeeo octydfs2rm( s;() reoxrcoatfpDeanvs () 2umio3iodomen fvt tf 2rrx pot0tex mfetad s2um(mpnu4arxrmrctadop e ivo;t  rxmim3no1llt micsat  Dtmumo;o0olx  oeiydlm elnms u4texrmo iodlmtr n s t  2tmiopou1aleelneilt sDtaurpno1tee moeiatlmDea(mo (4tetomf3iy1op r uei s0t2um(m iu1opte nei ( sDta(  no0opxoifeiad m ea(mp;t4 rxrir oadoat  n s;s) rtmir3iodal nlncs t arum(  ;u1open f3iydlaDrl(monu)altrmo tatlpteanvsls  etrim3oo4ale micilsf Dtmxmpou0alxn ocilt m ran pnt0arerir iodfp eli i;(0trxr(opnudal  lfvt t) rra( pnu4tee mf3tytfm um( s;u0tetrxr3tydoatr neo s sruoxopnu1lpeelivs tf Dtrur oo0alxomoeiysla ua(vonu) exniocoy1lptean s;s trxo(opou4aptemiesat)aDrm(  nu4tlxnif3iys mDel( o;() rermociadlp  aueilt)srxmim oy1omtelnciatfaDra(rp;t4tpx if3ilsfm ranmpnu0tetoirciadopDraneil(0seum(r3iy1ape  fvsl(faDur(mp;u0olt mo3iyslaDrlumpn(4 etoif oa1fmDrauvolt)s2ur(mpnydal nmnci t)sDrm(m nu1ope ifcildlaDrlnmpn()tlxnxr oa1lmDe i ol( s2ur(m3ou1amtnmieil( srua(m ou0alt  icils a2ul(mp t4aexrmf iytoaD aivil(  2umim3oy1alte ncs (  rta(mpot4aexo o3ild mDel(vs;t0 lxoxocoytoaD  i s s trto(o iudam nlfcsls a2tax o;u0alt  fetas sDel(mp;t0 eenmr oa1lateanvolt trxrir oudolt lnvtl() Draxr ou4tetoio3tydla2rmn s (4tltnxr oodfpteliei;t t2xoir oy1op   ncs tfa2rmxro;o1tle  feiasfs emnmpn(0alenif3oadfpDe nvo s t2ur(mpoo1ole lncsls s2umxm ot0tleomiciys s2rlump u0tltnmfciy1oa eaneo;t0t2xm(o ny1lmtemfct tfaDtrx  ;u4oexn ictadfmDumnmo;t)aeeoxfcio1lmt  uvo t0trto(m iydomee nvias a2rm(ro;u0opxomictadla el(ms () lxrxo oatomt luvi;t)t2urxrpio1lmte iei sfs2trx pou1tpenioctlt m2rm(ms t0trtnmociodlpteli ols0srxr(m3no1lltnmnvs (  2rax  nt1tet  oeiasfa2umumo t0artomf oatlm eanei t0texoio3oudlptnlivs t) 2tmum ;t4altnmiciatlaDranms;t0 rtnxoctydomDrlivils0 2xm(rpnu1omtelicsltf Dua(r oo0ape moetydfs2ea(vp;() eermo3iodoatr i i;(0trtmiopnu1lpt micslt) rum(r nu4tpen o3tytlsDeanvpn(4tlerxr3oatoat livo t0t2um(opoydlm n ncilt)a2umxrpot1opx mociltfm em(mont)trxnxoctydom elues t trtrxm iudal  licta()aDrmx p;t0aet mo3iyd s umu p;u0alenxr3iodoateai ol() eurxr nudll   fvil(fartmxmp;t1oeto feilsfa2uaump ()artrmo3oytlatelnvs t setoxr oydlm  mieia(fsDrm(r nu0alenmi3iadlm eauvpn(4trtrmocoytla raueils)sexoxmpny1lleelivias  rrmum ot0tptnif3tysla uauvo;t0 lerir3to1fa ean slt0 eum(r nodaleemnvs s  rrmxrpou4tle iietatlmDemu pn() renmfcoy1fp eanvsls)s2xm(opny1llenmict t a2raxm oo1ale mf3tadlsDua(vs t)trenxf3tatlp eai ols0trxr(r ou4lpenmivs tfaDra( onu1tpx mf3iyt a2ea(mpn(0arxnifciodlat  ueils setmxmpnydlltnlnct t a2umxmo;o0tpeoifcildlm um( o;(4 etnirciydoaDraieo s0 eur(m3oydam eliesatfaDururoou4open fcildls umuvp u4 reoircto1laDe uvolt)trtoxm io1apeemnetls)srtaumpnt1aetnio3tasfm umu pnt0 exrmr3iy1oaDrai i t s2xr(o oo1apeemietat srumxm ;o0openmoeils aDrm(vs;t4 rxrmo3totoate n i;s  2to(r io4ameemies () Dtmxm ;t0openiiciatlaDul( pn() rtrmo ia1lptrauei s)setmir3oo1optnmivt t) 2taur nt4alt mociytlaDum( s;u)aexniocty1fatr nei s0 eurxm iy1om nlnetat  Dtm(  nt0oex iieiytls ranms;u)tltoio3iy1fateluvil() rurxo oodlmtelnet ()aDum( o;o4oetomoeiys sDel( sn(4trerxr oodlmD  u s () 2uo(o3nodaptelfviat srua(rpnt1oeto o3tldfa rlnmon() rtoio3ta1op rlieol()trtriopnodol nlfvil(  Dum( o;u1aptnifeiydfsDem(vo;t4teeomo oatopD luvol(  eum(rpoo4lptelicil( srrr(mpno4oetnmoetls sDuluvp (4aexnioctadlateanvs;( sexmiopnu1omt lnviltf 2tmxroou0olt  o3iyslm rauvs t0 rxoio3ia1oat aueolt0sexrimpnu4altn icslt arra(  ot0apt  fetyt m emnmonu0alxrxf3totlm  livs s srtrir iu4ll  mnvi t  Dtrurono1oee mfetyd sDranmon() rxoif iy1opt lneo;s)t2uoiopiudap nmnci t srur(r nu0apx  octldfm2elumo;u)altrxr3ootlateau i;t  2uoxrpno4olenlnvtls  Duaur ;t1tpe  f3iysfmDemump ()trxomr ootlpDran o;s) etmim3iodomtn ivsas)srum(moot4tpt  o3iyd m uaumsn() etnxocty1fa eluvs;t) 2toiopiy4apee fesas s2rax  nt4ole io3ildfm2el(ms t)aleomo3ootoaD livs t0trtrxm no1lm  mieslt s2raurpnt1olx mf3ildfm2rluvs u)arxrxrcoa1oate neo (0 exmxo iudll   icslsfaDtr(rp;u1opxnmi3tlsfaDrmu ont0artrxo iotomt  uvi t)srtoxmpny1lle miesl(f 2rax  no4tle iocils m rmuvp;(4aleoio to1fa r ivslt t2toirpoo4omen fcils) Draurpnt0tpxomieiytfm2el(monu0 rxnmr3tydomt  nei;s) etmxm3no4ll nlics (faDtm(  ;t0alx  ictysfm rlnvpn()aeeoir3tytlpDeli ols  eurim3iudap emnctls  rtr(rpot1opeoiieildfaDemuvpn()artnmrctotlmtrlu olt)sexm(m iudalenlnvt (f rum(mp;t4oetnmocils s ea( p u4aexrxo oy1op raueo;s0srxoxo oy1lptnlnvs s srtrumo;u4olx mociadlm rauvonu0arxoifcoy1lm  lu il() rxr(mpoy1lm nmfvtlt)arraxrooo1aexoif3iytla2em( on(4tlxomf3totfaDeaies;(  exo(mpio1op n nvsls)srumxrp;o0opxo fctlt m2elu p t)teeomo iatfm   uvils  exoir nodlm  lfvsa()a2tmx o;o1aexnmiciysfs rmump t4areoxfciytfmDeaneo;( sruoirpno4amt  nct tfaDrrx pou0optoiiciltlm2eanmpnt) ltoxo3ta1faDe ivs t0 eum(o3iy1lle lfeil(fs2rrxro;u4altoifcilsfs elnvs;()texrxfcoatoa elu s;(0 eur(o3nu1alenlnctlsf rumurpnu1apx iieiydla2rmu s;u)aetnxo3oy1fatrlivol()t2toxopnodom  mncsls) rtm(m ;t1opxnio3iltfaDul(mont0alxrxo3tytfateln i;t) 2xm(opoo1ll n nvsls aDtm(mpnu0tptoifeiatfsDuluvo;u0tetnmr3oa1lmDrauvslt0t2um(m nu1lmenlnes s sDumu p;t0alxoiieiysfa2eln s (4teenio3iatlpD  nvs;t0texr(r oy1lpte nvsa(  2tm( p;t4alx iieiatls umnmp u0aeeniociy1fp  livi (0setoxr3oy4llt mivs t)s2trurp;t0alxnioetysfa2rl( s u0texnmf3oatopDe uvs s0srtriopoydaltnlfci t)sDurum nt0tlen i3iatfs2ranvs;u4tlxomocta1lp r ivo;t)t2tmxmpio4opte nei t  2tmx p;t0altomfeiasla raumsnu4 exrmr3totom rlieils0 etrxrpio1amt  ivsat s2rmu  nt4olt ii3tltfmDeau s;u0altoio3ty1opte uvi;s0s2ur(o ny1apenlfvtlt)a2ta(r ;o1olenii3tadfs umnvp u)arxnxo ootla eauei s  rtoxmpnu1ap e nvs ()sDurx ono4tlenioeiasfs eaump t0tleomrcio1fa rlu s;s0 etmimpny4op nmnvsa( sDtax o;t1tpx mfctadfaDemuvp;u0 eeomr3ta1omDelieil()texoim3oy1amtn ieiat a2umxr oo1oexoif3iadlaDuluvp;t4 rerxocoadoaD aivo () etrirpoydomeelicsasf 2uaxmono1olx mfctadlmDul(ms () leoiocoytfp e i ilt)sexmxm3no1apt mfctat) 2trum ou4tpt  octydls2rm( onu) etomociotlmtr nvil() 2xrimpnudopeelfet (faDtmum oo4apeo ieiys a uln p;(4trxnir oatlp r ivs;t0teurxr oy1lme  nvtatf 2umxr ;u0aptn ociysfm2em(ms t4tetrxo3oo1oatr nes s  etr(r3oy1amtnmnvi t aDtrxm ;t4opx iicildla elnmpn(4trtrif3ty1fm e uei t srto(opoo4opt lnei t  2rr( pot0apx ioetatlaDrlu s;(4trtnxf iatfmtrai ols)s2trxo nodaptnmfcs t)aDrrur ;t0olxo f3iadfs rau o;(0 rtrifciodfa elivolt)teurxr3ou4lmt mietat sDraumont1tltomfeilt mDra(ms;t0teenxf3iodlpDr ueo;(  eumxm nydlpeelnvi sfsDua(r no0olt moeiyt s2emums;u4tlenmrcoodlaDraneolt0s2xriopiu4apen icil( s2rmuro;o1tpt  o3tat s eanvs;()aetnio oatom  lueslt0srxmxm3oodamt liesat)sruax pno4aleoiiciatfm2eluvo (4arenio todlatrli ol()trtoxopoydlm nmfcs t s2tmurpot0tpenii3ils m rmnvs (4 exrif iatfmDrlieilt  exoxr3nydopee ivia( srtr(  ot4alen f3tysls2ua(vonu0tetrmrciytfaDe uvs;s  2xo(rpou4ol e nvtl()sruaumoot0texn fciytla em( o;t4teerir oy1fmDran sls0 eum(mpoo4lltnmnei () Dta(  ;u1opto feiadla ra(vo;u0alxoxr oadom r u i;(0 2uo(o oodlltnmieiltfa2um(r no0aeeoio3ias s rlump (4texnif to1lmte u ils)t2trxr3nu4amt livt (f Dua(rooo0opxoiieiaslaDraumo;(0aexnmf iotomte uvo s) etmim3nu4optnmfcslsf 2umu p;u1opeomfctlt m rm(mpnt0trenmfctotoaDelivslt0srum(m3io4olee nvsatfarur(r nu4aexniieiat a2rmuvont) etoif oatfmt  uvo t0 rto(mpiydop  mncil(farrrx ono1tpeniietltfmDulu p () lenio3to1oa eai i (0t2uoio3iydlpenmivils  rraurp;u1tpxoio3iyt m rmnvs;u0teeoif3iotlp e nvo ( sexrxmpnodalen ivs t sDua(mpou1aee ii3iysfmDuauvs;(0 etomfciy1laDe nvi;t  rxrxr3io1llt mieias srtmxronu0oleo ietyslm2ea(vont0trtrxo ia1fpD an o;s t2xr(r iu1ll nlncs s)arum( oot0oexnmfeils sDem(ms t)altrif3iydfmtr u s t) eumxmpny4amenmnvtatf rua(mpot0aleo fciasfa2ranvont)tltoiociy1op  auvo;(0srum(o ny1ll emfci s)srrm(  nu1oex if3ilt mDrauvsnt0aexrmfcootlmtraivslt0 2tr(m3oudol e ics s aDua( pnu0oleomfctyslm2uanvs;t4 eenmr3oytop  lieilt t2xoxo3ny4lmenlneta(f Drru o;o0altoiictyd a ea(vp u) rtomr3tatfpt  ueol(0trur(m3io4lltelfeiasf rurxr ou4opx  f3iat a elnvon()aetomf oadfaDrlnvo s)t2xoxrpno4lptnmfeia(f ruax  nu0opx  fciys aDrm(vp;t0texoif oytomtrln s s0 2xrxo oo4olt mfeias aDrm( oot4teeniietadla uauvp;u)trtrxrcta1fpDr ivi t srtoxm3iu4olt lfvi t aDrmur ;u1apxo ieiat m umuvonu)trxrxr3oadlpDe uvsl( trxmimpiy4lpeemfesl( aDrrxmpou4tlxoioctls sDea(mp;u) exoxr tadoptr i i t sexm(mpnydlm e nvi sf rtmxm ;u0aexomfciat a em(vp;t)trxnmr3oodomDe ivols0srurio3oy1ome mncilsfa2ra( o;o0oet mfctytfa2rmumon()aeenxocto1faD  uvi;t)seumim oydoleemfeils s2umumonu1tpxomfeiltfsDra(vonu)tetrmr3tadlaD  i s t  rtoiopnu4oltemiei sf rra(roou1opx  icilt s2rm(vs u0teeoircio1lp  lueo s0teurir3iydlpt  ici s a2rr(rono0altniiciys s emuvp u4 rxoxf tydlatr iei s)trtoxr no1lm nlivia() Dtr( ooo1tlenii3tasfmDeauvon(0texnif oa1om   n o t) rxr(o iu4lm   fet (fa2taurooo0altnmf3iatfsDeau sn(0texnif3iatlmD  i s;s) rxmxm no4amen fcsltf Drruro;t0ale mfcils s2eanms u4 rxnxo iatlm e uvolt) 2trir iu4lp  mnet ( arrrxmonu0alto feiatla em( p;t4 exnxr oydoat  i ilt  2toxrpiu4ol elics s) 2uaurpoo1oee ifetat a umnmp;t0trtnmfcoadlat  uvolt) ruoio3oydlmt  fctatf rtm(mo;o0open ieiadla2rl( o;u0altoifcio1fate iei t) eurxo oo1aptemietl( sDtruro;t1aeenif3iasfaDranvsnu)arxoio oytfp elivolt)sexr(r3oudalte feiatfs2uaurpnt1aptomfciadfs2emums;(0teermr oy1oaDeanei t0 rtoxm iudll nmfvs () Dtmump;o4tlxoiocild s2ea(von(4alxoio ootlate n s;t)t2xmim3iudamtnliei t  rurxroot1ole mf3iytfs um(ms () ltnmr3oadomDr nes ( teurim iu1llee nvsl() rrrxrp;u0tpen oeiat mDemuvp t) etnif iytlpteln o;t) rxmimpnodol e nvtltf Dtmur ot0aetnifeiltfaDran pn() eeoif3oa1fm e iei ( trumio3no1ome  nvsa(  Dum(r nt0oleo f3iatfm emn s (0aetnmr3to1lpt lnes;s  rxm(o3iy4al n ies s) 2ur(rono1tpxnmi3tyd s ranvp;u0 lenifcia1lm elneo (0 2tmimpoudaptnliet t a2rmxr nt0opeoiiciydfa2uluvp u0 rermfciydoa e u o;() etmiopio1llte nvslsfa2um(rpot4tex  o3iatlmDrmn p;t4 rtnio oytoa elivolt0srto(m3io4omte nvsa(  rtau pot4oetomfeiasfa elumo;t4trerifcia1opt  ivi;t  2urxm no1aleelicsls  rra(m ;u1tptoif3iys sDrmu p;(0arxnxf iodfmD anei (0s2urir3io4om n icsat aDrm(mo;u0altomoetld mDeanmo;t0alenxf3iodfa rlu s s) etoiopny4ame lfvs (f Dta(mpot4tpx  i3iat m2eluvp;u4teermf3ootlaDrai s ( srxrimpny4alte nvsa(f rumur nt0oetniictys m elu s;(0 rxrmo oatfpD lues;(0 euoxmpnodoptnmneils)srrrumonu4tptomf3iadfa2eauvonu) rtoxfcio1oaDe ieols) rto(rpou4lp e fvias)srtr(monu1olt ifciytfaD
\ No newline at end of file
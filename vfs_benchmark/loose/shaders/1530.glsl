@@ -0,0 +1 @@
+i i s0 rtmxo nydlmt  fesa(farrmumpnu1optnmf3iys sDuauvsn(4 ltrioctytfatelieo;t  eto(mpnu4open net t s2rm(r ;o4aptn ociadls umumo;(0aeeomf3ty1fa r n slt) 2toimpio4llt lfcil()sDurur nu1tpeomf3ilsfaDum(ms;t)aetomf todfa e u s (  exo(o iudapt mnciat  2ta(r ou1aex micils mDran snt4tlenxr oo1oateanvi;s  rxr(mpiudllt  ietasfa2umur nu4aetoio3tltlmDul(mp;(4 exomf3oodop e ies s0 etrir3iu1aleelivsat)s2tau  ;o1oexo o3tldla uanvo;t0tleoiocoy1oaDrlneolt0trtoxrpno1op  lfctltfsDrrxroot4tlenmoctatfa2rln p;u4arenir oatoaDe uvsl(  exmxo nudaptelfcilsf 2uau pou1ape miciasfs rmumsnu4alerifciytfpt  ueilt0s2urir3no4lpeemfvi ( s2umxrooo1tpxn fcilslaDua(monu4aeerif oatomD auei () exmim3iodop n iet s srtrxr ;t0apen fctadfa uan onu)alermocta1la eaivs s srxoirpou1olt  nci sf Dtrx pou4tleoioeiasls2el(ms u4tleomo3oo1fpDelu i;t t2to(o no1lm elfviasf rtax oot0teeo ocilt a ea(vs t4 rtoxr oytlp  luvo;(0trur(r iu1omt lfcsasfs2tmurpou4aleoioeiyd s2rmnvs ()aleomr iodfateaueol(0s2urir3iudapen feta( sDum(mpoo4optnifcildfa2el( p;(4aetnmr3oa1fateanvo ()srtoim3oy4om elfes sfartaxrpnu4tpt  icils a2emu o (4aeeomrctodfp eau o s) 2xrio iu1lm  mfei s)arrrxro;t0oet iieiasfa2uln p;u0 ltoio oydfaD  n ilt  etmxo oy1ope  fci t)srtru pnu1oex  i3iatfaDumuvsnt)tltoif3oadop  li i;( trtr(mpiodllee fetls sDrmxmpnt1teeo octadlm2umuvon() rxrmo oodlat au o ()teur(opoodllt mnviat sDrru pot4opt mf3ils a2ua(mon()altniocoatfateluvo t truoir ou1lp e fvsa(  2tau pot0alxoioeiyd mDrau pnu0arxoxf3to1fa ranvo;s0 2ur(m3nydopte ietltfs2taumpnt1oexn i3tys s2elu p (4artrxfctydomDrlnvs t srtmir3iudapte nct t)a2taxm no1aeeoiicild sDrmump;(0texomrcoa1faDr uvo s)teumxo oodlpeemfet t  2umu p;u0apx mfetyd s2rl(vpnt0aleoxf ootfm e nvsls)s2tmxr3nu4olenmiesltfs2umumoot0opt  ieiasfmDelnmsnu0 rtomrciodfatr i o;s)s2xoxo3iy4lpeemicsa( s2ta( oot0olxn ictasfm emnvsnt)altoxo3totfmDelueols trumxo no4altn ieils a2trxrp;u1tpe  o3iyd aDuauvs;t0 rtoxfcia1lpteauvil(  2xrxrpnudapeelnet s  rum(mono4tex if3tldfmDeaump;t4altrmr totoa   n i;( t2urirpoydlm   ncsatfsDrm(  ;o0aptnmi3ils aDranvo t)aeeoxo3tatfpDe n ols  2urxr3no4ol nmivt sfaruru pno4tlxo f3iydfs2ranmsnu)tlxrmrcoydopDr n i s) 2ur(o3oy1lm  lnvilt)arum(rooo0altn ieiydls2ran s t0 rtnxrcoy1fpt  n slt0trurir iu4omtnmfvsas)sDtmxmpot0tee mieildlm2rm( sn() eerxocoo1late iei s)sexmxrpiydolt  icias  2ur(  ot4oetoiietldfm ua(ms;(4 ltrxfcoytlate neil(  2xrxm nu1lp nmnctat arrr(  ou4apxnifetadfaDulnvpnt0 rxrio3io1latelivo;s0texrxm iy1oltnlivta(faDurxrono4aleoiocilt s ulu p u4 etrxfctodomteaneols0 2tmxm3ny1am emicsl(  Drmu  ou1olxomf3iytlsDrauvon(4 rxrmocoodfmtelnvilt0texmio3oydlmenmfvta(fsrurumpou1oee ii3ias m rm( p (4aetnxfcty1lmD lnvi;s0s2xrxm3nu4apenlncsl()srum(  ;u0tee micildfa rln p;u) reoir3oa1fpt an o;()s2xoxr3iydole  fcsat)aDtrumpou4tlxn o3iatls umumsn(4tetoxo ty1op rlu o s s2xoim nydop   nvia() 2trxrpot4tlxo fciytla2umn p u4arerifctotla   u ol() exoxr3oodlltemicil( arrr(rp;t4aptnifeiatfa eanms u0altoxocoydfpDr ues;t trxm(opoodlpt  ncs t) 2ua(r nu4apenifciltlsDeau snt4tlxnmf3oadopt aivilt  2trxopny4apeelfctl(f rrrx pnu0tee ifetytls2ulnvo (0artrir3oa1fa   nvs;t0 2xmirpoy1oltn nvtlsf 2umxrpno0tleoifcias mDra(monu)trtnmrcoy1oateluei t)setrxo iy1open netas)s2rr(  ot4tlxnifciad mDem(vsnu) lermfcoo1fmDean s ( teurim3iu1ll emncsat a2rauro;o4ape iocild mDum(vsnu4alenxocto1fatrlneol(0 euoxrpny4aptnlncils)a2ra( oot0tptoifctyt m2elu p;t)tlerif3todfp rauvo;s0s2xm(m3io1ole  fcsls arra( pnt1opxomociytla2el(von(0texomr3ta1laDean i t)s2ur(m3io4lle  fvtltfsrtmx o;u0tlxnioetadla elums;u4 etoio io1omDrlnes;t t2to(r ny4ameemncil( aDuau pno4apen fetld m rmnvo (0trtrifctytomte i o ()s2xmio no4altn ncia() rtmxronu4aleomoctltfmDuan s t4tetriocoo1faD ln s;t0texrir nydole  fei t) rrr(root1apeo o3tlsfsDelnmo;t) rxrio oodfmDean slt0srxrim oo1alt lnciat sDtrumpou1apxoiociydfs eluvo;u4 rtnir oatomDrlneo;s t2uo(r3io1lptnmnetltfa2ur( poo0oet  f3tld mDelnmpn()tetnio ia1oa eaiesl()tetrxopoo1lp  mivt ( aDuru ooo4oeenmf3tytfa2rau pnt4aetnxfciy1fmt anes t0s2um(r3oo1ole liet tf rtaur ot1tltnif3ilsla2ra( p;(0treoifcoadlpte u il( tetmxr3iydom e ivt sfsrraur nu4alenmieiasfaDrm(vs;(0alxnmo ia1fmDelieo (0s2tmxo3iu4ole  ivs tf 2rmxrp;o0opxomieiadfa2elnms () eenxr iotoatrlneols0s2xrio oudlmtn ncsl( a2uau pno4tpeoio3iatfs um( s u)treniocto1oaDean o s)trtr(r ou1ome mivsat artrxrpnu1tpt mf3ildlsDulump ()texnxo iydfmteanvslt  rtmim3iudomenmfvtlsfs2tmxr ;o1tee iietlslm2rm(mo t4 lxnmf oy1lmt  nei t  eum(o3nu1aptnmfcilt s2tmxmo;u4tpe iieiyd s ua( p;()tltnxfctytlpteli o;s0texrir nu4opeelnetas sDur(r ;o1opxo octlt m emuvpnt) rxrircoodfm  lueo (0 2umiopou1lm   fvtasf 2trx o;t4aptn oeilsls2raump t)aetrmrcto1om eauvslt0 rumxm3iy4al n fei s) Drm(moot1tpxo oeiadfa rlums u)aexrif ty1lmtelu i t)setoio3io4lleemnvilt sDur(mp;t1oeenmoctytla2ua( s;() eeoiocoadfmteli s (0texm(rpnu4lmee netat)sDurxm ot1oltoiiciadfa ea(vs;(0aexrmo ta1opDeauvs s) euoimpoy4lltn iviat)a2rm( pnt4opeo f3iysfm2rmnmp;u4 renxf iy1opt lu s t s2um(o oy4lmenlnvtl(f Drmxr ;o1apxoiiciysfs2ua(vsnt) ltomf3oo1fp  aies;s) rto(o nydll   ivia() rraxm ;o4tltn ieiltls2emumsnu)arermrctydoatrluvo s)t2urio nydopenlnvi ( a2ur(r ot0tlx io3iatfsDrm(vsnt0 eeoir oa1omDe uvols  rxrim3io4opeemfvs () rumx pnu4aet  i3iyd mDum(msnt4 eeoif ty1fmDranei;t) eto(o ou1llenlivsat)aDrax onu0opxoiieiatfs emnvp;(4tlxrmo3ta1om  luvo t)texm(opoy1olen nvtl()aDum(rpnt4oltoifciasfm2rluvpn(0artnmoctadla eaues;s)teto(rpno4opeemicil(fsDtm(ronu1opx mf3ildfs emuvs;()aeenif oy1faD lu o s  2uo(o iydoptnmivs (  2raurpoo4ole  iciys aDranms;(0texnxocoy1omteau i;t)t2xmxr oydamt lfetlsfs2raumoou0oltnmictydls2ra( s;t) eenxf3io1fp rlues;s)texm(o3iu1apt lfcs t)sDrmxr nu1aleoif3iydlmDea( onu0 etnmf tydfmD  nvils texrir3io4lme  icils) 2tmxm nu0teeo f3tltlmDumn p;u) eeomr3iy1optr ieilt tetriopou1ll  licslt a2rm(mpou1oleoifctltfs2rlump t) ltrmo ty1lp eauvslt)trtoir3nydoleemfeslt  2raur ot1tltoiocild m emu s;u0alxomo3oa1laDeluvi t0s2umim3nu1al n ncil(fsDrrumpou0opxomfetytfs2ra( o (4aleomrcoatla e nvil()s2um(mpno4ome  fes t s2ua(m nt1tpeomfetad aDelumo;()artoxfciodfm ean ilt0t2tmxr3ny1amee feil(  2trxr ou4apenmi3tat m2el(mpnu4aleoxf to1lp raues ()tetoirpny4ame  fcsa(farumumpot4tltoifcildls2ul(mp (4artrmrciatla e ivs ( sexoir3iu1ame  ncta(f rum( p;o4aexn ieildls2ua(mpnu) lenxocoy1la rlieo;(0 euo(opnu4lpte nes s) Drax  ;u0tltn o3tysfsDumu o t0tlxnmo iydlpDr ivo t  etrxm io4lm  mneil(f rta(rpot4tltn fctytlsDemnmp (0arxnmocoy1op eanei;(0sexriopnu4aptnmncslsfsDumx ono1olxomi3iysls eanmo;u)aetoircoadomtrau ol( texo(rpoy1al e ivia() 2trxm nu1oee ifcildfmDua(ms u) reomo3oa1laD ln i;s) rur(o oudaptn icta(  Drru p;u4altn fciyt s2rl( onu)tlenxr3tadoa   uvs t tetmxopou4om emfcil()a2ua(rpnt0tleomieiys a2rauvsnt)tetnmf3iytoa e nvo s  2urxmpoydllenmivi s)aDtmurpou4aeenmfetldls rlump;t0arxnio ty1fa rln slt0srxm(o3ou1ap   fesl( srrrxrp;o1tleoiociyt m uaums t0trerio oydfpDr n o;s  eurxm3ou1apeemnvs (fsDumxroou0oexnmieiad m2ul(ms;t) ltomo ta1lp   nei t0truoirpou4optnlncslsfa2rm(mo;t1tptoifetys mDumumpnu4aeenir oytlp ranvi;()sruoio3nydame miei s)a2raxm ou4oleomf3iytlaDrau p;t4 etnmo iydoa r i i;t0t2ur(o3io1ape  ncslsf Drrumpot0tetn icild mDrm(vs (4artnifcootopDr neo s) exrir3io4ol e fcils aDururpot0tle moetysfa2rmn s t0tetnxfcio1fpDe nvilt) 2xrxo3nodaltelneiltf 2ra( pno1apxomi3iltfm ua(vpn(4 rtoircio1faD  i i t t2um(r3iodol nmfvsat)aDtmxro;u0tlxnmi3iadls ulumo;t)altnxo3io1opDrlivs;(0srtrxm3nudaptelnci t)s2trx  ot1apenio3iyd s rmu p;() exrir oy1fmt lu s t0 2ur(o iodom  lfvta( aDta(  ou0teen feiadfa ra(vo;t4tetnxf3iadlpDr uvil( teuo(mpno1amte ictlt)arra(rpnt4tltn ieiasfa2rm( p (0aexnxrciatoatraieil(  etmxr iu1olte iet s  2rm( oou4optn i3ilt s emums;u0arxnxfctodlpDraiei s  rtoxopiy4lmtnmiei (fsrurur nu1oeeo ictldlmDumums (4 rxnxr3oa1fpt  nvo;t)sexo(o3nu4lm nlietls  rtr(  ot1apxo o3tas mDrmn pnu) reoif3oa1om ran s;t0texrxm3io4op e ncs tfaDta(mp;o1aeenioeiydfa ulnmp u0 rtomf3ootfat au i s) exriopoo4omenmieia()sDtax  nt0tlx mocilslsDemnvo u4tlxrxo tatom raiei ()srxo(m3iy1om nlfviat  ruau pot0ope iociatlsDeanmp u4aexrxr tytlatrau i;()srxoxm iy1opt  nesl() 2urumpot0texnifeiytfa2uluvpn(0aetomfcoydopDrauvi;s)trum(r3io1omt mieiasf rtru oou1apxn fctld s ran s;(4trxrxr ootfaDeaneilt0 2toxopoo1ameemiesa(f 2taurpnu1tee iociaslm rlnmo;()arxomocty1oa eli o;t seurxo no4lp   fctatf 2rmu  ou4oltomoeilsls um(vs t0altrir3oadoaDrli sls0 rtr(r3ny4lpeemnvsas)sruaum nt4oexo feiytfa2eaumpnt4aexnif tadfaDeai slt  exmxr io4ap nlfcsl(f Drm(mpnt4tet mi3ils sDrmnvs;t0 lxoxr tydfm r ivs t srurxm iu4ome lfei (fs2rmu pou4teeo fetydlsDra( pn(4 rtnirciy1fate neo;( s2urir3iydop  miei s s2urxmpou1oetomiciytfa2el( s;t4texrxfcootfpte n olt0trtr(r oy4op   icil( srtru pno1oltoii3ias s2eau pnt0areniocootlptrln olt)s2urir oo1alenlfvsas srrau pot1olx  f3ias mDel(ms u0arenmrcia1om elnes;(0 2xo(o3nodomtnlnes s  2rm(  ot4tlen ietydlmDulnmonu0altoiociy1fm  lnvsls)srxrio3nodamenmfet t)artau oou4aex moeiysla2umn o;t4 rxnmr3oatlm raiei;s0teto(r3ny4altn ictls) Dta(rpou0olxnmo3ildls2emnvpnu) etrir3ty1la raneo ( texo(o oy4amtelietat  Dtrurpnt1alxoii3iat aDumn p;t0tlerxrciydlmD lnes;s0 etr(r3iu4lme lncil(fs2tm(rpoo1tlxnifctad mDel(vp;u0teenio oo1fatran il()srxr(m3iy1ap emfetat)s2rr(mo;u4tlxnmo3tltfm emump;t4aeeoif3iy1la   ieo s0texoim3iu4optn ici sfaDtrum ;u4olxo ictatlsDua(mo;()teerxr3iydop rlnvols0 exmir iudlp  mfvilt a2umxmpnu1texnmf3iyslmDelu s t0artoxo iodlaDe iei (  2umimpnu4lle micsl(fsrrm( pnt1tpe  oeiytls rl( o t) ltrmr ta1laDraueilt) exoiopny4om  miesat  rtr(r ;u4alen o3tydfa rluvp;u4altrmf tatfaDe ieolt0srumir3oo1llen ivilsfarrruro;u0aeto i3ias m rmnmpn(4trtnir3tydfpDeai s;s  2toxrpiudoltn neslt)sDuaxrpno0oeto fetltfmDumums;(4altrxr3oa1fa eanvsl(0 2tr(o iu4omtnlici tfsDuaxro;o4tee ii3iatfa2ulu p t4tetrxf tadla   i ol() rxr(o ou4apeemnvi () 2taxmpnu1oetnmfeiydlm emu o (4texomr iodfa e nes t0srxoiopiy4lm  mfet sfsDur(rp;o1tleomoeiydfaDulumsn(4altomociotlmDeln i;s t2to(r3iu1lp e nvt tf Drmurooo4teeoiiciadlmDeau on(0 rxrxoctotfaD  nes;s)teuoim3nudapen fvil( sDrmx  nu1apto o3tld m ua(mpnt0 ltoxf3iy1fatean ols)srtmxopny4lm n icsasfaDtmuront0alxomo3tytla2eanvo;()aeenioctytoaDe ivs;() exoir3nudllenmneiatf 2ra(rp;u4olxoioeiatlsDuln pnt0 rxrxf3todom ean o ()t2xmirpiy4ol nmivt t)a2uaumpnu0oeeoifeiyd mDemnmsn(4aexnmfcoydomt aivols0 rtoiopoudlpt mneilt sDurur ;t4apt  fciysls2ul( o (0 rtrmr ty1fm   neo ()seurim3ny4ap  lnvsl()aDuau  ot4tlto f3iadfaDulnvon()alxrif ta1lm  anvs t  eto(m3io4amt  ivt t)arrau  ;u0oltn fcils m2ran s;u4teeoxr iadfa eaivi;( t2uoio no1lme lfetltfaDurxmooo4olx ii3iadlmDemn o;u)arxoxocta1op r ieo;t) 2urxo3no1om  livtlt) rraxmoot1aeeo i3iydfs ua(mp u0 rtrxf3tydop   ies;()s2umxmpoudllen nvta(faDrmur ;o4oexniietytfm2rmu p t4tleoir oatfpD lnvs;s0seum(opnu1am emnes t)s2ua( pnu4aexnifctyd m emnmpnu4 rtnif tydfaDelneil()seuo(mpnu4lptemivs ()srtmx p;u4opeomietydfsDranvpnu4 ltoir iytoaDeauvi () exoxr3nydlltemfcs tf 2tmumo;t1apto i3tldls ra(mpn() rtnxf tatlaD  nvo;s0 exo(r3oy1op emfvs s)artmu pno1ole ii3iytfs el(ms;u4 etrmf3iotfmDeai i s sruoir3io1ome mfvils)s2uaum oo4tpen i3tatfmDulumsnt)aetnmf3ia1lmD aneil( t2xo(o3io4ap elfcs s) Duaxrp;t0ole  ociasfsDulnmo t4 exrxfciodfa elu o;s0 eumxrpiu1lleelietltf 2tr( p;u4oltnmictyt sDrm(mo u4 leomf iodlptrlnes;()s2ur(m oo4ll n nei t sDta(ro;u4aet mfetls s2umnvo t4 lerifcootoptelu olt0s2tmxo3iy4op nlfvs (  2ta( oot1texn fetys m ulnvo t0 rtnir tadlpDean s;s0seuo(m oo1alt lnct s)aDuaxroou4texoiicild s ua(mo;u0arxrxrciy1lmDrlivi t truoiopny4olee fet t)s2uaump;o1teen ieildlmDean p ()aetrmociadlp e n o ( srur(m3iy1lmen fetltfa2umu  oo1oeeoio3iys s2rmuvp u)aeeoxocootfpDran i;t trtmxm3oy4am   ncsat) 2ua(ront0aet mfeias s2rlnmo (4tetrxfciy1lmteai il(0 rurxrpoo1lmenlfvt sf Dtrumo;u0aee  feilslm2emnvp t0 eerxr oatlpDrai ols)trto(m3oo1lleelivtl( a2rrx pot1oet  i3tyd a ranms;(4tlerxf tydfmtr u o () rumim3iy4apeemfetl(fa2rrxmp;o4apxn f3iaslaDumums ()teenircoydla elnes;() rurim3io4ll elieia(f rurx pot0tptomf3iysfm2em( snt4arenmfcta1omtrlnvo s srxriopiydaptelfeilsf 2rmu  ou4apx  ictatfa2rmuvp t)treomfciotopteluei t)teumxo3io1amt mfctl( s2rmx pot0tlt if3tyslsDuaump t) rxoxf ootfa r nvi;(0s2toxo oudape  fctat  rta( pot1tpeo i3iadfa2el(msnu)alxrxociydoa rluei;(0srtrim3oydlpenlivia(  2ururpno1olx if3tltlsDran o;u)aetrircoy1oaDrlnvo;(0 rumim oo4lp emictasfa2urx oou4olt ifciyslmDrlnvonu4trtomf3oy1fmt aivs ()tetm(r iydapteliesls)arumxmo;u4apxoif3tat mDua(vs;(4 eerxfcta1oaDe n i;( srtr(r3iudope mnvsltf rua(m ;t0oltnmfetyt m2raums;t)treoxo oydlaDe ivil( t2uo(o oudalenlfcs () rrr(root4oetnmiciysfa ulu p;(0 rtrxr ootlmDelieo ()s2uo(o iudlm   nvt sfaDurumpno1alt  octls a rm( s t)trtomo iotla r nvo t0s2tmxm3oo4lpen fei (fsDrm(r ;t0tetoifctlt m ea(vp;(4 lermf3ia1fa eauvo (  etoim3oo1lmenlnci ()arrr(mo;u1oetnmfciyd m2rmuvo;u4trenif ty1oa r neilt  exoir nodom nlici sfsDtr(mp;u4aee ifeiyd s2rmums;t4artrxo3tatopDraieo (0 2to(mpiy4aptn ncsls srua(rpnu1oexn o3tasls el(vpn(4 rtrxf3oodfmte nvslt)seuoir3iu4ol nlncs t aDrrxrp;u4olt  o3ilt s em(mp;u4 leomf oatfpt luvi;()teuoim nydapeemfvsl(fa2urx o;t1tlt moetysfa2um(vonu) lxoxr3oa1fptranvslt) etmio3io4aleemncils) 2tax  ;u0tet io3iasfsDum(vp (4aeenxf3iydop   nes s) exoxr3oodop  mneil()srrrum no4aleoiiciat a2umumont0tltomr3oo1fatr ueo (  2xrxo iodlm emnctat)aDumx p;o1tleo f3tasls el(vo;u)tlenmo3ta1laDeaueo s0 euo(m ny4lp n nvi (fa2raur nu0oeto f3ilslm ranvo;t4 eeomf3oytla eanvs;s  2ur(mpny4lmee iesls arrrxr ;u4olt  oeiyslm elumo;t4 ltomr oytfa e ies s)tetm(opiudalenmfesatfa2rmx ono0ope ifetld aDrlnms t4teermrciadop e u s s0tetmir ny1oltelfesatf Duaurp;u1open fetytlm eln onu4 rxoir3totlat  u olt)trxo(m ou4omt  ivs t)sDtr(mpnu0tleoioeiydls rlnms t)aeenmrctytla  lu s;s)trxrxmpiu1llen feslt srrm(  no4tptnmociyt a ra( s (4tlxnif3tytfpteln s;()t2toxopoo4ale mfvs t) rtr(mo;o4aet  o3iadfmDrm(vs (0 rxoio3iytlmteln s;t0 2umim3ou4oltnmieia()sruaumpnu4texnmiciyslmDrmnvs (4 lxnmrcty1fateaues;t0 2urio oudapt mfcsa(farrru pno1oexn oeiat aDemnvs u) ltomo3oydla  lu ils tetrxm3iudlleelicia()aDtmxr ;t1olxomo3iltls uan o;u0aetomr oadlm eanvolt0srto(r nydlpee net s) rrmu pnt1opto iciasls2rm(mp t4 exrxo iotfp rluvi;( teumir3nu4ape mieslt)sDrru poo4apxnmictls m2rm( ont) ltrmfcoodfm   u i () rxr(r3nudop elnetat)srrruront0tlenifetltla2um(vsnu)aexrxf iodla rln s ( trxo(m iu4oleeliesa()aDumump;o0oeeoifciydla em( p;t4alxoir oatfaDeluei s  exoxo3iydlmeelfciatfarrau p;u1open ieild a2uanmpnu)aeenmrciatoateau olt0 rxoio ny4ap emnvtl()srur(r ot1olxnifcild sDeluvpnt0teenif oydfmteluvolt)s2to(o3ou1amtnlfvsas a2tr(mpou0olt if3iad s rmuvp;()altnmr tytomtranvol() ruoxm3nu1lmtelfcsls a2taur ;o0altn oetys sDrauvs;(4aeeoxrcta1lpDe neo s) rumio3ou4ap  mfvilt)aDururpot1aex iietld mDemuvonu0 rxoxo iodopte n i;t0s2xoxrpnudomee neslt sDtm(  ;o1oeenii3iysfsDuanms u4trtrmf3ty1oa r u i t0t2ur(o ny1ap elfci (fsrrm(m nu4aeen feias m uaumpn(4 rxriociatfpDraieo t) rumim nu1amenlnct s s2uau pou0openmo3tysfmDrl( pn(4 ltnif3ta1lmDrli ils0 2trir3oo1ole lnvia(fs2rau  ou1opeo iciasfmDua(mp;t4aeerxf ta1lmte ueo;(0 rto(rpio4lle lnciatfs2tru ont4teen iciltlm rlnmonu4arxrir iatfm r nesls)srxo(o iudlme mfes sfarrau  ou4aex mo3iatfmDumu o (4tltrmo iytlmt  n ols)srtmir ny4alte neil(fsrur(r nu0aeto ociadfs el(vsnu0teeomr iodoa   u ols)trxmxopio4aleelneils)sDraxr nu4tltn i3iasfsDul( p;u4arxniocoadlm  luvolt)srxm(opiy1amtnmnetasfaDururp;t0ole ii3ilt sDul(vo;u) rerir iodfm eai sl() 2tr(r3ou1al   feils  Duaxm ;o1teeo feiatlm rmump t)tetrmfctotlatrlu o;t0sexm(r oo1ap  lfvsltfsrur(moot4oeeomfeils m2uanvonu)trxoxo oydlpteau ils0 rumxm3iy4lpe lfvta( sDumx pou1opxomo3tas aDra( on()tetrmo oo1oa rlnvi;t0seur(mpoy4am emivtl(  2uru onu0aee mfeiltfsDuln on(4trenxocta1omDraieo;s0 2xrxo3oo4lmenmfcta()srurxm ;t1tpt  f3tltlm2ranmo t)tlxnxr iydfmDrln o;() 2toxm3no4op  mfvsl(fs2uau pot0oltoioetatfs2eanmp;t)artomr3iytlp  lu o;s)tetrio nudol nmncias)s2rru  ot4olenmictatfmDrlu p t0 exoxrcto1la rliei;t s2umxrpnudap eliei t  Dur(r ot1tpenmfetltla2em(vpnt4tlermfcoy1fa raueils0tetoxmpio1ame mnet sfa2rrur ot0aeeo i3tldlsDranvs;t0tlerir iotfp  aivslt texmir nu4llenmfvsls) Dtmuroou1tpx  fciysfa2eluvp u4arermo3tatfmDeauvi ( t2xo(rpiu4lm e ivilsfsrtax onu1oetn icild sDuanvpnu0teeomf3iydfmteaies;s0 rxriopiy1om  mies tfarrr(mpot1tpeoioctasfm uanvpn(4artoxr oo1oa r uvs s)srumir ou1olen iet () 2urum ;u1tpto icils sDua(vs;t4texomr oydfp  anvo;s0srumxmpio1lpeelictas)srta(rp;t4olt mo3tadlsDra(mp (4alerircoy1lpDrln sl(  2uoirpno1om emfctls) Drrum ;u1aeeo f3iydla el( s;(0artnmf ia1fatr ueo s  rurimpiydamt mictl( srrrum nt4apxnifctyt sDea(mo;t0 rxnif3ty1lp elues;t) rtmio iodop  lfci (fa2urumooo0apenmo3ildfs2ua( s;t) etrmr iytopDe i slt) 2urim3iudop n nvs tfsDra(  nu4oet if3iytfm2ulu snu)tetnxr oy1oaDrln o;t0srxmimpiu4lme  fes s srtrxro;u1aetnmictltfm2ea(vo t0tetnmo oydlpDr ueil(  2xo(mpou4omeemieslsfartmxmoot0texn oeiltfs2emnvo;t) eerxo3iy1op rlu il( t2uoirpiy1lptelfesl(fsrur( o;o0oeeo feilsls ua(vo ()altriociytomtranei;s)sexr(r3ou1lltn iesat arra(mpoo1texoiociat a rmn p (4tlerxo oa1om raneol(0 exo(o3iodam elfeilsfa2umx  ou1olxomoetaslmDrauvonu0treoio3iadoaDr u o ( sruo(mpio1om elieias)s2ta(  nt0altnii3tat sDulnvon() lenir3tatlp raieo (0srtoirpio4oleemieta( sDtm( oot1alxn f3tlsfa ranvs t0aetoioctodlpte ivs s0s2ur(m3iy1omen neil( artm(rp;t4aexomietadfs2rluvpnu) leoiociy1fatelues;t)trxo(m ny4om nmfcsas) rrmxrpnt4tlx  i3tytfaDra( p (0tetnmr3iodomD  u s;s srtm(m ou1ameelnciat aDta(roou4opxoifeiatla uauvp t)alxnmr oo1fpDranvol(0 2tr(r3ny1lleemncsa( s2tax  ;t0tlxoiictytfm ranvp u4teeoxo ta1oat au i (  2xrxr oydal nlfcsls a2raxmp;u0optoioctyd s rm(ms u4aexniocta1latraneilt trtoxr3iu4aleelfeil( srtruronu1alxniietasfsDemuvs (0 renif ty1fmt aneo s0 rtmio ou1ope lfcil()s2ta(mo;u1tpt io3ilsls2rmuvo;() rtnif3todoa   uvslt trurimpnodll emneil(fsDurxrpou4alx ioctatfmDeluvpnt) ltomf oytfaDraivil( srxr(o io1apenlnctl()s2rm(m ;t0oetoiietydlmDel( o;t4tlxrir tadomDrli il(0 exr(mpiudaleemfetas s2taxr nt4olen fciyslm2ul(vo;(4 lerir3oytopDeaueilt trumxmpio1al nlfvia(fs2tru  nu4apeniictaslm rm(mo;u)teeomo3oa1omDe ueo s t2umxopno4ole lfes ()sDur(m ;t4tlen i3iyslaDeauvp t0trxnmo tytfm raivo (0t2xoim3nudop nmfviltfs2ra(mpnt1oee io3iad sDrmnmsnt) eerxf3oo1omtelivs t0srtmim3oydam nmict s artax  ;t4tpxnmfeiysls2umuvp u)texomf ta1omtr u sls0 rxrim3oo4olenmfcs s aDrm(  ;o4olto f3iasfmDrl(vp;u4alerxo3oadom   uvilt0srxm(rpiodlpt mfvs tfartmu pnu1tlx  i3ils a2rmuvs u0 etrxf3tydfpDeluvs s) euo(opno1ame lnvi sfa2tmxr ot1texomfeiad a2ea( s t0tltrio3ta1op rln s ( seum(o3nu1alt  fvi t)srumumono0texoif3ias a2uaums;t4artoxr iadoateanes;()trxmirpiy4opee fcs s) 2umur ou1aeeoiietytlm um( p t) etrif io1omtrlivo t)srtrxopiy1am emnvtlt srtmumoou4tle ioeildls2rmnmpn()tlenif iy1lptrlneslt0 2umxo iu1lleemfvilt)srtmxrp;u0tptomoctls a umumo ()arxnmo oodopt lieils) 2uoiopny1apee net (f rraum ot1tpx io3tatlmDeluvp;u0 rxoio3tytoaDeli slt  2tmxopoo1ope lictl()srra(  ot0olenifciyd mDuau p;t0arerif3tatoa e neo s)s2urxmpoodlmtemfvslt  2ur( pou4tex iociasfa2rm(mo u)texnmo tatlpD au olt s2trimpou4lpeemfcs s  Draump;u0altnifeiad m2ulnvo u0 rtnmf iodomteau sl( t2umim oydameelnvtl(fa2tax  nu1olxnif3iydfs umu on(4 rtrxf3to1fatr ies t) rur(mpio4apte nvtat  Drr( onu1oet  o3iad aDumums;(0tltrxo oodfmD aivo;(0srtm(m3iy1op elicia(fs2ra(m ;t1oetn o3iad a2elnmo u4 ltrmociydomt ai i;s0 rur(mpno1lp emnes sf Dur(r nu0tpenif3iysfa ra(ms;()trerxrctotlpt an s ( seur(rpoo4lme  fetl(f Durxmont1open fciydla ua(von()aetnxf oydfpte i s t)sexmxr3ny4op   nvsltfsrururono1tpe  ieiat sDra(vo u4altnxfciy1laDr ivs (0s2um(opiu1lp elict () rtr(moou4apt mi3tatfaDra(mo t4aetnio ta1fpD  nvs;s  eumxo iy1ll elnctat)sDtm(mp;u1opxoioeiydfs umnmo t)texrif3iodlp   n o;()setmir3iydop n fvilt  rrmur ;t4ope  iciydfsDumnvs t0aexniocoa1opDr uvsls  exmxopio4amt mnet s  2rm(  ;u4tetnmoetys mDua(ms () lenirciydfa eli i t setoxr3iodapte fctat aDtr(m ;t0tpxomietat m2emnvp ()arxoio3iydlp r uei;t srtmxo iudlptnmiei (fa2tmur ;u0opxnif3tytfsDea(vs;(4aeerifcoodfmD lu olt)t2xrirpnodop e ncsasfsDur(mp;t1aptomicilslsDrlu snt0tlerifctadoatr ivols srxmxr3ou4alt mnctl(f 2rrumo;o0apenmf3tlsfs2emuvs u4 rtrmo oytfpDelieilt0tetoiopou4lm nlfei () rrrump;u4oet  o3iasfa2rau p;t4tlerxrctadlmDrluesls  2toir oo1oltelfetls)sDtrurpot1aexnmoeiasfa2rm( o;u)tltrxo ia1fa e nvi;t srtrxm3ou4apeelictlt  rur(mo;u1aptomociltlsDrmnmpnt)alermr3oadlptr ivo;( srto(o3no4lm elnei t a2urumpno1oee ioeias mDrmnms;t)aleoio3oytoa eluvs;(0seumxopnodalt  neia(  2ur(moou4apeniieias a2emuvpn(4 rtnif oa1lmtrau s;s  etr(rpny1ap   fvslsf Dtrxr ;o0tle  o3tyd mDul(mpnu)artrxrcoy1oat li s s)setrim3ou1omeemfvsa(fsrrax pno1tlx  fctadfs ea(ms (4aeermr oodfm rlieo;(  2uo(rpio1lpenmivslsfsrurxr ;t4oexn ociasfmDea(mont4 eerxoctadom eaivo;s0trumio iudame mncta()a2ur(mpnu1tpe iieiytfs uaumo t) lxnmo3oatopDrlieo;t)tetr(m oudapt  fcta()aDumur ou0apenifctld m2emnmpn()arxoxociadoatrluvslt0 eto(mpoy1lpe  iesas arumxrpou4optnmf3iat mDuaums u4 rtomfcio1op raivol(  rto(mpio4llen ici tfarra( ont4oltnmi3iadfm raumonu0trtrmf3tydopte ivs ( tetoxm nydol   feilt)a2umu o;o1olxniicildfm ranvsn(4aeerif3ia1fp  an olt)srxm(mpnudom emivi (fsrtaumoou4tlx ifctadfs2rau p (0treomo3oo1lat livo;s texoir3oodaltemnesl(fs2ur(  ;t1oee moetat a2rmnmp;t4tlxoxr3ty1lp e ivo;s  etoir3io1ll nmivtatfa2tmxronu1apxnmictld a rau s;(4alxoxf oa1fpteaivil(0srtrxrpny1llenmiciat srrmxr ot1tlto i3iyd s ua( p ()artnxo tytla  li o (0s2trxrpoodolenlfeia(f Duaxrp;u1tlx ifcils s uauvs;(4 leoxr3io1fptrau ilt)sexoxo3iudlme  fvtltfsrurx p;o4opx iicild s2uauvo;t0arxrir oytfptr uvil(  rxmxmpnydolt livt (fsDrmxmont1tlx io3tad m2ua(vp;t0 lxnmr3oadfm e nvs;s)t2xoxopoo4ol n iet s)arumxmp;o0aee  o3ilt aDeanvs t0tlxrmfcoa1fp elneo;()srxrxmpiodopt mnesl()aDrr(rpou1opxn fcildfsDum(mpnt0 rtnxf3io1latrauesls) 2tr(r oo1lp nlnvsatf 2tmuro;t1olxo ieilsfaDrmuvsnu)tlxnio tytlm r nvo (  2trxm3ou4optn nci s)aDtr( o;o0opt iictld m eauvp (0 exrxo iadoaDr ueols0srtmim3nu4apenmictat)aDrr(rooo4aleo fciltfs umu p (0trxnxrciy1omt an i;s trxr(rpoo1lmt  icta(faDrmu p;t1tpe  iciydla em( p t)aleomo iodlaDr nvo ()seum(r3nu1am e icta(  rtr( oot1texn ictysla2el( o u) lenxr3tytfaDr nvi;s srxoxm3ou4apee fvil() Duauroot0apt if3tys sDrm( o;() leoxocia1omD  ies;s)trxo(r no1llee fvsatfsrtru  ou1ole  fcilsfs ea( o t0trtoxo iytlpDe n i;t0teuo(m ny4optemnetls)sDtax  oo0oet  icildlmDrmu s;u0trxrxo3todom rli sls tetmirpoydapte fvias  rumx pno1oexoiieiyd aDrmn s;(4texoxf iadomD ai i;s0t2tm(m3nu4om  lnvi s) Dtaumoot0altn f3tyt s ra(vsn()tetnir oa1lmtrluvo (0s2urimpoo1lmte fvta(  2tm(mo;u1aet mf3tlsls umumpnu) ltoxo3todoatraivslt0 rtmim3oodopee net ( arumu p;o1tltniociytlm eln p;u) reoxrcoy1omDe i il( tetrio3iy4ol e nvtatf 2rm(rooo1ope  fcils a2eauvo;t4trxrxrciytoa rau i;s0 2xoir3ny4op  lnesat sDtmuro;t1tpt  fciasfsDulnvp (4alerxrcoatlaDe ieols  etmxr iudllt mfeta() Drmx ont1tpt ii3iasfm ul(vo;u)arxomf oo1om  liei;t s2uoio3iy4ll nlictl( a2urxrooo4olxomicildlm raumsnt4 reniocoa1oaDr ivsls  etoxm3oydope mivsa(  rtmxmo;u1apxomoeiaslmDemnmpnu0 ltrmf oodlat lnvs (0trtrir nu1opeelies t s2rru ono4tex mf3tldfa2rmuvo (0tetoiociatfm ran o;t) rxoxrpoo4amtn fvi (f 2rmumo;t1tltnmfctlslsDeln onu4 etomrciy1laDe iei t t2to(opnu1ap elnet s s2tmu p;u0tlt if3iatlsDeluvp;u)altnmrcoadfa   ivi s0trur(rpoo1op elieils  2umxr nu1tlxnmfeilsfs2ul( o;()trxomf3oatlmDeln s;(0srxmir oudomtn icsl()a2tmxmo;u1oee mo3ild m2umu s u)aetnxr todlmDelnvilt)s2trxr iudlpe mnvsa(f 2rax oot4aleoioeildfm umnvsnu4alxnio to1fpD aies t0texr(rpiudameemfvta() rtaurpou1apen ocilslm ul(ms u)aleoifciydlpDeanvo () exm(rpoy1lm n nesasfs2uau  nt0oltnio3iltfm el(vs t4alermo tatfp rlnvsl( t2urxo3oudlmt lfet s artrx o;t1tleo feiad sDul( pnt0aetomf oatomtrlnei;s trumimpnudll e fci ( sDumu ont4aexn o3iadfmDrl(mo t0tetrxf ia1fptraivi () rxmirpno1opt  ivi (f rra(m no1tle mfeias m rmuvpnt4teeoir ta1om eaneo;s t2xoiopoy1omt  feiltfs2tru  no1texomfciadfs rmuvp t4 rtrir oadoate u i s seurir oo4am  mnvtat a2ur(r oo0tle  fcils m2ulnmsnt)trxniocootfmDelnvi;s0tetm(r iy4am emivilt  2ur(r ;o0apt iociasfm ea(mpnt0 rxnmr3oadfpteaieo;(  2tmir3iydlp emicsat s2ur(m ;u4oet  ociytfs2eaumo;u) exnio3ia1om  ai sls)truoxr3iodllte fcs tf Dur(  nu1ale mo3iydfs2uanvpnu0tlermf3tytlat  nvi;t)trxrio3nydlp   fes t)sDtrumono4aexnif3iasls2rluvs;t0alxoiocty1om elu s;( t2tmir io4lmeeliet s s2rm( pnu1tpe ioeildfs2eln pn()trtoio tadlpDrln o;t) etmim3nudlltemfviat)sDtauroou0tpxomf3iydlm umuvp u0trtnmr3iydlaD lu i;t0srtmxr iu4ole  ietls srtruront0aetoio3iysfa ea(vp;u0aexrmr3todfp  lues s)srtm(opoo1apt  feia()sDuax p;t1tlxnmi3iat s eau o t) lxriocty1la  lu ol( s2uo(m3oodam n feslt) 2raxmont1aex mf3tls aDemu snu0 rxomf totlmDrlies;t)t2tmirpiu1amtelfcs tf 2raumono1ope  feils aDuanvsn(0 leoio3iydfateluvi t)s2um(m3nydal  lncsat)a2rrxm ou0olt iociatlm emumo;u4 exnxo3todlat  uvo () 2tm(rpoudoptelfvtas)srtaurpnt0olxnifcilsfmDea(vs;()texnmo3ia1omt anvi ()tetrim3nydlm n nvtatf Duax ont1oexo fctltls emnmo (4teermo3iodlpDeln i;t)s2trim nydlmeemiesa(fs2ur(r oo4tpxniieiadlm2rmuvonu0texrir3ty1fa   u i t)srtrxopny1ll nlfcsas) rurumo;u0tpt mi3iatls ran snt0 lxnxfctytlpD  u o;s0srxrio nu4opee icsas a2ur(root1oet micildlm2rlnmsnt0 eeoxrctadlatrlieslt)sexo(o3oudomtn fvilt) 2rr(r ;u0texo ocilslaDranvo;(0aexoxo3iatlaDe nvs;s0 2um(opou4ap nlfes ( sDuaxm nt0oetomietytlmDrlumonu4tetnif ootfmDrluei;( texm(r oudll nmfesa(f rtru  ou1ape mfeiysfs2ulu o;u) lxomr todoatelu i;t) 2toxo3oudapeelneilt)a2rm(mo;o0aetomfeiat a2emumo;u0texoif oytlmDelnvsls0 rxrxo oy4alenmfvia()sDta( ooo1tptnmoctysfs2rmu o t4 rtnir ootfaD an o s0trxmio io1ol nmivsat) Duau pno4teeo iciltfm2rm(ms t) lermf3oa1lm r neo;t srumxr nodll  lfvtas) rrmumoou1tpenmieiltfaDua(mo;(4texoif3tytlp rln o () rurxm ny4amt  iet s sDumuronu4olenioeiyt aDelump;(0tltrmf oadfmtean s t  rtm(r3iy4am nmiesat sDur(  oo4olt  icilt s2el(mp;(4aeenio iytlatr ies;t trtmxopoy4apenlnet ()s2taxr ;t4alxomiciytlmDra( o;(4treoxr3iytlaDr ieil(0 rurxr3nu4lmee feia( a2rax  no1tpeomf3tltfm2ulumo (0texrioctadfp eluei;t0texmimpiu4aptnliesatfs2um(rpot1opt iictyt m ran pnu4teenif iatoa elnvi ()srumir no4lle  ietl( s2ururo;t0apeoioeiydls2eau s;u)alxomfcoo1optr ies t) 2xmimpoodapte nct (fsDra(rpnu1oee io3iltls umuvs;(0 eerir oytlmDraneols0 etoir3nudlle mieiat)s2uaxmpno0oeenmf3tls sDuauvp t4trenxo3oadlp r n s t)teum(r nu4apen nvta() rrm( o;t4opx mietytlaDem(vs;t0 lxnir oytlptr ueo;t)teuriopoo4altnlfcsas aDtr(ront0oeto oetls mDumu s ()trxrir oy1oaDrai o s)srxmimpoy1ol e nctlsfa2umum ou1olt micildfs el(von()tlxrxf3oytoaDrlnvo;s)trxrxr iodlpeelnvtls) Drm(  nt0aetomoeild s2ul( o;t4 renmr ty1fm  lnei;t srurirpno1opeemfes () rtr(r nt1tptnii3iytls el(mp;()aeenmf oydomD aies t)trxrxo3iy4am emiviat) rumx pot4tpx iocilsfsDeanvp;u0tlenir ootfat  nvols)s2umxo io4oltnmfvta( s2rru  ;o0olxo f3tldfm rlnvo;t0alenio iadomtraivslt0texmim3iydlmeemivi s  rumxmpoo0aptomfciad s ea( s u0 eeoif io1lpteaivol()sexoimpoodlpeeliet t)arrm(  ;o0oeenifetytfm2uanvo t)arxnif3iadopteliesls)trtmxm ou4oltn fvs t) Duaum ;t4aexnmf3ilsfs2uaums;u0trxoiociy1optrau i ()teum(mpiu1lpt mncsl()srra(rpnt1aeenmo3iydfs2ua( snu4aexnmf to1fmteluvi;(0trxmim no1ll  mnet tfs2rru ooo4oleo i3iltfsDeau s () renmf3io1faDelneo;s0 2xoim3ou1lmt  ieils  Duaxr nu4oeeomoetldfaDuauvo;t4 rxnxo totlpD aieils)s2xrxo3nu1alt  nvtl( aDra(  oo4opxoif3ias a2rmumon(0texrio to1la   ieo;() 2umir3ou4ome  fvta() 2ra(monu1apt ifeilsfm elumon(0aleomrctadfpDelivi s)t2xrxopoo1lm nmietat  2rr(  no4aet  feiat a ranvp (0 exoxr3todfmDranes (0 etrxmpiy1lm n fcslt) 2trxm ;u0tleoif3ilsfm umnvpn(0altrmo oa1omDrluesls)t2xmxr iu1oltemnct (fa2tr(r no0oet iocild m rauvo;u) rxoio3tadlmt li i (0s2xoxopiodoltn nes sfsrtrxr no1tlt mi3iasls2el(von(4teerxo3iytoaD  u i;t  rur(m3no1ol emfeia()aDum( pnt1olto icilt mDul( p t)tetrxo3oy1fm  livo t s2to(mpnodlltnlnvta(farra(mp;t1olx  o3tysla2rm(vs;t)arxnxr3oo1oat lnvi s s2xm(r3iy4lp e ict s  Dumu p;u1tlxn f3iydlaDemums u0texrxfcoa1lat auvo;s) euo(opoudaptemivt t)a2tr( ono1tlenmieiadfa2rln o;(4alxrxfcootlat anesl()trxr(m3ny4lmt  ivtat  2ra( ono0apx ii3iysfmDeln o;t)texnif to1fptr iei;s  etr(r nu1optnmiesltfa2rmuro;o1aexnifcildlm emnvsn(4 rxrif3ia1oate i i;() ruoim nudllee nvilt  Dumx o;t0opt mfciysfmDumuvonu)trxoiociotlatrlnvs;s srto(opno1om nlicta(  2tmurpoo0tee iiciad m2elumo t) rxoircoo1oa e n o;(0srxoirpiu4lpen ict s s2ua(mo;t0ape if3iasfs eluvp ()trermfcta1fm rauvolt t2tmxo oo4lptelfvsa(faDtmxmp;u4ole  i3tyt mDumnvo t0tleomo iodfat  nvil(0trtrxo iudolen nvt sfaDtm(rp;o1aetn oeiyd m2el(mp t0treoif ta1fm   nvo;( t2trir iy4amee nct (f 2tm(mo;u0aexn f3tyslsDra(vo;(0 rxrxo3ia1om  anvol( sexmxo3nu1ape lfeilsfartm(  nu4olxo feiadfs2um(vp;(0 lerxf3iodlmtr i sl(0setrirpnodlpt lfct s)sDuaur ;u1optomi3ildfaDeau s u)tltrxo3oatlpt  ues ( srumir3no1lpte netltfaDurxr ou1tex ii3ild aDua(vsn()trxoir3tatoat  nvo;(0srxrimpny1lmenlnct s) 2rrx pnt0tet  i3iysfm2ulnms;(0 exrmr oatop elnvo;s t2xmim3iydlmt lies () rtax ont0tex ii3iyd s ran pnu4 lermf3iodfmtr uvs t s2toxo3io4am emivsltfa2um(  ;u4tpxomi3iyd mDemnvo u4 etoxr3iadlaDeaneol( s2xm(o3ny1ol elietlt)artax o;o4oltn octldlaDean p u4tetnxrcto1lpDrli o s0sexrir3iy4lltn nctl(fsrururpoo1aeeomietysla rm( snu0alxoxr tytlp eai olt  etmir iy4lptelnvt t srrrumpou1aee  o3tlsfs2ea(vsn()arxrmf3iytopteauvo;t0s2tmim no1altelfetltfaDrau  ou1texoiicild aDel(vo;u0alxnirciy1la e uvs;s0t2tr(o3nydamenlnvsatfs2rmuro;o4aptomfeild m rmnmp u) ltnif3ia1lmD livo (0 rxmxm3nu1ale  ncilsfsDtm(mo;u4olxomieiad m2ua(mpnt4texnmo oydom eaieilt t2uo(o no4al emnciasf 2ta(rp;o4teenioctasls2ua( onu4aeermf oa1lmtr nvi ( t2trir no1ll emivtatfartrxmpou4olen fciytls rmuvp;(0tltoir3iytfm rai olt)trxr(opoy4olenmfcs ( arur(m ot0oltoiictlsfm rm( p;(0aeenir todop rluvol()texmir3nudlm emfviasfsrtrx o;u4tlenmfciltlm2umnms;(0tlenif3oa1oa e uei;t  rumimpiu1lpen fvtas srtmxr no0olt  ietatlmDem(vs t)texnio3tadoaDeauvs;s  2tmiopnydoptn icia()srrr(r no0tpxnmicilsfm rlu p (4artnif oodoptr nei;() 2uoim3no1ol e fvtl( srumu pno4ape iictld m ean ont)artrmrctotoaDeaiei t t2tmir3io4al   ictatf Dtru  ;t4oeeniicilt a rlnvp t0tetoxrctytom rai s;t0t2umio ou1oltnliet (  Duaxr nt1tpenmoetadlm2eanvs;u0tlenxo oy1opD  i slt)trumxm ny1apt lnvsatfaDtr( pot0apxoioeilslm rluvp u0aetnirciadfpt luvslt0seumxo3ou4lptemfeslsfaDra(r oo4alx mfcildfs ulu ont4 rtnmf3iodfp ran i t0srtrim3iy4olenmnetlt)aruau oou4tptnmoctysfm2rmumo;u4 ltoxf3ootlaDr n i;()trtmim3io1ap elivi t)aDum( ono0oeeoiietas m umums;u0tltomrcootlpDrau s ( teumxo3iodolenmfesls  Drr( o;o0oeeoiieiasls2emnms u4altrxocoatoateluvs;t  euoimpoydopee fcs ( sDtm(m nt4teenioetlsfm2rlumsn()trerxfcty1oat aivols0 exrio oodap e iviltf 2ra(  nu4opxniictysla2rauvp;(4tetrxo iydfp e uvo;s)s2xrimpoudaptelicta( artr(ro;u4optnif3iasfa el(vs;u) etnio3ty1omtelu s (0 rtmxr ny4lpe mncilsf 2tau pno0tleomocildla ra( s t4 ltoif3oa1faDelu olt)trxoirpnu4omenmivils  Dra(m ot0oeen ictad m2rlu o (0 rxoioctodlat  u i;t0 rtriopiudaptnlfcsas  2umxmo;u0oetomictadfs elnmo;t0tlermf io1fa  livs s seuoxr3oodol nlieia()arrm(m oo1apx  o3tasla rmumpnt0alxoircia1lmD  u o (0 etrir nu4ol nmncs ()arrmxrpno4ale mieild sDean o;u)aleoxf ta1laDelu s;t0 rur(m oo1lm nmfcta(fsrrrum oo0alx  ociatfaDeau s ()altnxo3iydfat  uvo () 2tm(m3iodol  mics s aDta(r nu0apenmoeiydfa2em( o;u4 etnxo3tydlatranvi;s0setrir io4alen netl()arrrxroou0oee iieilsfm2eaumsnt4altoiocia1lpD aneo t texoio nydlp nmncsls)srtrx  ;t0opto feiatfm2el(vo;()alxrxfcoydfat aueo;t  eur(o3iy1ole  ictls a2urxm no1oltniictatfmDuanmo;() rtrxociotfmD li slt0texmimpoo4lmtnmfeta(f rurum ot0tle ii3tad m el(vo (4 eerxr oy1oateau s s)t2uoio oudap emncs sf Dtaumo;u0apxoifcildla2ra( o;(0 eermrcoo1lat  iesl( teuoim nudlpte ivsltfa2rm(mpou1olt mo3tasfaDem(mon(0 eermrcoodfm eln i s s2xm(r3iodom  lfesl()srrmx o;t1oleomi3iytfa rlums;()tlxomo3ty1fpD  nvs;s0t2xm(m ou4lm n nvtas sDtaxr nu4tpen iciadlmDul( ont4 etnircoatop r n s t0 2xoirpiydam e nct t)a2rrx  ou0apeo i3iat m2ea(vp;(0 rxrxrctydlmD ln olt0srum(opiy1lme lncs ()srur(mo;t0olxomo3iltfs emn pnt) rtoxf ia1lptraivs s)s2xrxm3ou1apeemics sfsrum(moou4aet moetatla2umuvo (4 ltomf oa1la r i sls0srtoimpou1ap nlfvsas sDuaxrooo0tpx mietltfs rluvp (0texoxf io1fa rli o ( tetr(o oudlp   icsls a2rrumooo1aex mo3iatfmDulumo;(4aexrmf oy1fmt  i i ()t2xrim3io1olenlicias) rtmurooo4tex ioctysfaDran pnu)trtrxr oy1opDr ivi;(0t2tmxo oudolenmicslt) rtr( poo4apxo fciyd aDeln pn(0trtniociatoptrau il(  rxmimpnu1oleelfvi ()artaump;u1oltn ieiltfs2em( sn()alxomo3ootoaDeaneil()s2tmxmpnodale  ncslsfa2trxro;t1teeomietld s rm( snu4aexomr3iadlp  auvo s0setoio3nodalt lnet (farurxrpnt1tpto ictlslm emn s u0tltrmr3oadfmDelu ol(0t2uoim iudoptemfvi s) rta(ronu0oetnmieiytfs2ea(vpnt4tltoifcoatom e uvi t0 eurxo iy4op  livsls)aDta(mpoo0oetnmi3iytla ulu o u)artrmociadlp   u il(0tetm(m3nydlmtn fvsa(  2uaurpou1tetnmo3tyd a2rmn snt) ltrmr3iatfa rlieilt)teurxr oudlltnmfciat)sDrrum oo1oee mf3iad m2rmuvsn(0teeoxfciy1fp  aneil(  etrirpoydll  lnvsat)sDtrx ooo0opt  ociydfs2emumsn(0tltrio oytomDelnvo;t0setm(m3nu1ol   nctls)srtmumpno4tpe  o3ildla2emn p (0tetomf tadfmDelu i;s0trtrxmpiy4ll nmfcsltf ruru pot1altomfetydlaDemuvo t4trxrmf oy1fp elu s;( t2urio iudlmtnmnesa(fsrtmx ont1tpeomo3tldfs elumo u) rxoif iadlmDean ols) 2toxo nydole  neta( s2ua(rpoo4oeenifeiltfm2raumpnt0trxoio3oy1fm rluvilt) 2um(m3iodol  micil(fsDtr(  no0oexnmoetldfa ea(von(4 lxnxf oadoa elivols)s2uoxrpio4ameelfes t sDtmx ont4ale mo3tydla2eaumpn(0aleoxf tadomDrauei t seur(o oudap  lfvsls)s2trx pno4olxnmoeiadfaDua( p;t4altnmo ty1lmt lnvo t)srto(o oy4omen feslt a2urx  nu0ole  octasls rluvs u)tleoir ta1omt aivs;t  2umxr iy1omt  fesas srtm( pnt4alto fcild mDrl( p;u0alxoio oy1fmDeln o;t  2umir oy1op emfvt s)sDtm(  nu0oexnmo3iydfs2um(vo;()teerxoctydlpt  i o;s)seto(opnodapt mfetlsfaDtmu  nu4texnmf3iysfa eanmpnu0alxnmf3oydfp e ivo;t)seuoxopiu4llen fcilt)srumxr ;u0oee ifciad m umu s;() reoif totfp   n s;t)s2xoxo ny4ll n ncs s)s2tm( ont4aet  ietydfm ulumsn() renmr iy1laDraneol(0 2tmxm iu4oltn fct (fsDtr(mpnt1alenmi3tlt sDea(msn() rxrxo iotlaDr ieolt srtoim no4lle micsltfs2rm(ro;t0optoioetys sDel(vsnu0artomo totlp rlnvs (  exo(rpio1ll nmfet (fs2uru  ;t4apxnmoeiasfsDelump u) exomr3iytfp  aneo;( tetrio3nydll   iet s srtax  ;o1olxn f3tld aDumumsnu4trxrmr iodoaDranvilt) euo(m3oy4lm e iet s)srtm(m no0oleomoeiltfs2el(vs u4 rxrmr iodlp r ivol() exmxo3iydolte iviatfsDua(mp;u1tpeo o3tls m2rlu on(4 lxrxf3tytfm raies s teuoir oudlle lfeta()sDumur ot0opeo fetls s ua(vs;t)aexnmr3oodfaD  ueol() exm(r iu4ape  ieilt artrx pnu4opeomf3tatla2ul(vs;(4trxoxrctydlm  aieo t0tetrim no4ll nmnctl(f 2umurp;u1apt  oeias s rl(mpnu4aetomr3oo1oa elneo s) 2uo(opoodol elnvtat a2raxmo;t1alt iietadfs2rmu o t4 rtrmr3to1la  auvsls0t2xmim3oudomenlfct ()a2uaurpoo4tle mictat mDum(vsn(4 etomrcia1lpt liei ( setoiopnu4olte ivsl(fa2uau pou0tlxnmfeiyd a2emnmp;(0alxnxr3iodlpDe uesl(0s2xoimpiodoltn fcsatf 2ta(rp;t4tpeo i3ilsfsDeluvs t)trtnmfciy1faD  n ol(0srtoim ou4lp e fcilsf 2rrx ono0tptoii3tlslsDeaums (0 ltriocta1lpD anvo s trurio3io1lleemietlsf ruaum no0olx  feiasfm2emnms;t4trtomf3tatoaDe u o t)s2uoiopoudapte nvsl()aDumxm nt0tet iiciatfs2rluvs u) lxomocoo1faD  nei () eumxo iydlm   fvtl(fsrrmurpoo4optn f3tadls2ua( o u0teeoxf oytfp  ln i;()srto(m oodame mfcta(  2trumpoo4teeniietyt a2umumpnu4tlxrmo iy1lpte nes;t)trtrxo ny1lm  lfvia()aDtr(mo;o4olxn oeils a2rau pnt)aetnif3iy1fpteli i;() eurxm no1llt  fesa(fs2rmxro;o1aexnifetys s ranvo t)tetnxfctatomDrlneo () euoxo3io4altnmfvt t srurump;t0alx  f3iyt m ra(vp (0trtrxrcoydoat  nes;(0srxoim3iudoleemivtas a2tm( p;u1tee mfeilt aDean onu4 eeoif3ty1lm e ies;s0trurxr3nu4altemfet tfsDua(  nt0ope  o3iydls eluvonu4tlxrmrciydfpDelivo;() 2to(mpio1lp n ivilt  Drr( pno4apt ifeiytlsDrmnvsnt0tetrmr ia1lmDr nvs;()srtr(m3oodlpe lncil()sDumx ont4oex  fetyt aDeln o;(0arenmf3oa1faD ln o ( tetr(r3io1omtelfet ( s2ur(mpno0aet  f3iytls2uanvp;u)tlxrxo3ia1fateau slt0tetoir iudoptemfetls a2raxmpou0opxn octasfa2umnvs;t) renircoa1fpDr i i;(0t2um(opnu1amen nctl( srraumo;u4aee  feilsfs2el(vp u) eenxrcia1oa  au o s)tetmxopiydlpe mivtas arrmum ;t1aetoio3tasla rmumo t)tetnxr iadlatr ivs;s  rxrxopio4ll nmnvil()sDurxrono1texoio3tasfs em( o (0trxnircio1op raivs t0 etmim3no1ll n ncta()aDurxr no0oexnii3iadlaDeau p t)tetoxo3oadfa  au sl() rxo(o3no1lleelivia( aDtax pnt4apx ioetysla2eanvp u)aexoif iodfa  lies;s0s2uoxr nydoptemnes s  ruax oou0oexn ietadlaDea( s (4aetomo3iotfmD lueslt sexoxopnu1al n ivilsf 2tmu o;o4tpx io3iyd aDrl( ont4aeerxo3tytopt anvo;s0 2tm(mpoudomenmnvsat  Dtruro;u4tetnmiciysla uln s u4trenxf iadomD  u o;( s2xr(m nudap  licsasfartmump;o1aeeo feiyt sDum( o u)aeeoxrcoodfm   ueo;s texmxopoo4oltemivi sfaDuru poo0ale  fcias m2umuvp;(4trtrif iy1fmD an sl(0 2trim3oo4lmeelnvsa()sDtrum ;t1aex mfetydlm uanms u4arxrmfcto1opt auvo ( trxoirpoodoptnmfes t srum(ronu1alenmietat aDua(mp;u4teenifctadomDraivo s0 rxmxopno1ape lnctasf rta(  ;u4aexnmictysla2rmuvsnt0 etnif3ootfmte iesl(0trxoio3oydolt  nvs ()srra(m ;u0olxoiieiytlm rauvs;t)trtoxf iatlpDeaieo;s)srtrirpoy1op nlncsl( aDuaxr ;u4apt mo3tys aDea(mp u0treomrctatop rauvo s  rxr(opoudll  mfvi sf Duaxmooo0aexn oeiatfs2rln o u4arxrmr todfateauei (  rurio nodame  feias sDra( oou4teeomietysfm2el(mo u)arxoif3iadlatrlueo t)sruoxm3iu4omeemfvsas  Duauroou1teen ictlt a2el(mo t)tleoircoodlptrli ils tetrir3iu1lpte fcslt)artrx ont4oetomf3iyslm2rln o;(0arerxr iotopDrluei;t trxo(r3io1olt lict sf 2uaxmpoo1aee mo3iys s2ua(mpn()aeeoxocootlmtrlu s;(0srumio3nodolt  nvt () 2rmxr ;o0apxomf3iltfa2eln on(0treomf3tydomDr ivo;t t2trxmpiy1ol nmici t  2ur(rono0ale io3tyt sDrl(ms u4 eenir iytfp  an i;s) ruoim oo1lme mfvt t)arrrx p;u4tpt mfciadfa2umn p;u0aeenxf oydfmt ai o;t) exoim3oy4lleemivt tfarum(  ;t1ale moetatfmDumn pnt) leoxf oa1fptrai ils)trxoir3io1omtnlivtlt  rrmu  oo0apxniictasla2ulu s;t4teenxo oatlaDeanvo t0srto(mpnu1am n nvslsf Duru o;o4oeeo oetyd mDuan pnt0arxomf3iytop e nes;t texm(o nu1amt  fesas  rumur no0tltomoctysfs ra( pn()arenifcto1om elivs t setrio3oy1oleelfetlsfaDum(r ;t1aeto ieiltla eanms;u) eeoxfcta1fpDelu ols)tetrxopiu1amt  icsa()srtmum oo4oetnii3iltls rlnmpnt0trenmrcoa1fmDr n o;s0s2tr(r iy4op  lnvt tf Duauro;t1teeomo3tydfsDumump u0teermf totlaDr uvs ()tetr(r oo1ome lfeil( aDraumpno1olen oetld mDeauvp;u4 rerxrcto1fpDrauvo;s)s2toxo3oy4amt  fci ()srrrxmont4tlto fciat m rauvs;t) lerxfcootfaDran s t seumxm3nodom  lnvsat  rrmxmoot1tee  i3tydls2rauvs t4 leomoctydlaDran s ()teurir oo4omtelicsat  Dtax p;o0aleoioeildla2ulumsnt4aeenmr iadom   i i;(0setoxr nudap  livi t  Dtr(rooo0texo ictls s2ranvo u0artrmfciotoa ranvslt  2uoxo3io1amen fvsa()sDtmxr oo1oexo ociatfm ran p u)trxoxrctadfptranvo;s0s2toxm io1ole  ncs sfsrtaxr ot4aex  ieildlmDumu p u0altnmr ta1om e nesls0s2uoxrpnodapt licsltfsDuaxmpot0teeoioctasls rlnmp;u)altnmf3iatfp eai o;s  rurxr ou1llt lics (  2ur(m ;u4tetoiociltfsDeaumo (0 rxoxr3tytlp  lies () rxoimpiydlpe mfcs s)sDtru o;u4ole  o3tydlm uau o t)tltnir iotfp e ueols)trumxr3iydap emnctasf Drr(mono0tpxn octldla2elnvo;t)artomfciydlp raueilt0 etrimpiy1openmnvtl(  2tr(r ot4texo o3tytfa2el(vs;(0aleoif iytlm elnei t srto(r nu1ap  lfetls)aDtaxm nu0ope if3ils s2rmnvs;(4 exrxr iytlpt lu s t0seuoxo nu4ol n fvtlt)a2raurp;o0alxnmieiat s uaump u) etrmf todopD  nvolt0seto(o ou1ape  feta(f rraumpnu1aptomf3ilsfaDul( ont) exrmrcoydlmDeanes ()trxmxr iy4am e neslsf 2uru pnt4apx mfetltlaDel(vp;t0alxnmr3todlmDraivi s0t2trxmpiu4ol  lnctlt artrx  ;t4tlxn oetydfmDelumpnu4 eermrcoodfaDr i ol(0tetmirpoy1olt  ncsat sDrmumpnu0tltnmfeils m rauvsn(0 rxrmrcoydfaDrluvo;t  rxr(m no4op  mivsas)arrru ont0tle ioeiysla uln o;t0 eenif tytfaD auvi ( srxmxm oo4oleelici (f rtrxrpot4teeomietlsfm2rmuvsnt) etrmr iydfmt lnvs ()trtm(rpno1aptemfcsa()a2uaxm ot1oetoiocilslm2uluvo;t0 lxrio tydomDr u s;t) etr(m3oodlle  fcsat) 2ua(r ;o0opeomieiasla uanvsnt4tltnmo3tatop eaneo ( srxm(mpiu1ome licilt  rtm(r ou4apxoifetasfa2ranvs;(0tleomr oa1fatr uvs (0 2tmim oo4omtnlivtl(fs2urxronu4tle ifetatfs2ulnvs u4trxoxrcoy1lp rluei s0s2xoxm iodol emivta(fsrraxrp;t0ape  oeiytfmDea( p;u0 rxnmoctotfpteluvs t0s2toirpou4am nlfesl( sDtr(  ;u0apxomiciltfaDrl( p;t4texrir ty1laDeai ol(  2xrio iy4ll elneta() Dta( p;u1aet mociyt s ul(msnu) renmr3iydfpteaneo ()teumxm iudopt lfcilsfs2umxrp;u0tle  fctasla2emnmonu0 rxoifciadfateai ol( sexrim3no1am   ivtls sDrr(mpot0apxnio3tat m2elnvon()arerxf iotoa raivo s)setoxmpny1lpeemivt ()sDraum nu0opeo ieiyslm ua(mo;t)alerir3oatom e ivsl(  2to(o nu4ap e iesas sDumur oo4opt  ietatls ua(ms u)areoio3tadlpDr ivsls teuo(m3oodomenlfet t) Dra( pnu1aet  o3iysfmDrm(vp t0tleoxf ty1faDrluvols)s2tm(m3no4op emiesl()srta(r ou4aetn fcilt a uaumsnu)treoifciadoatrlu sls)s2tmim3iy1omenlnct sfartmxro;t4optnmf3ildfmDrlnmp u0tltoif3io1omtelieslt0t2xmxm3iu1apte neta() 2tax p;t0tlxnifeiadlmDuanmont)arxnmo oo1oat liei;t0trxoxr3ny1lpt  ictltfaDrm(rp;t4aexoii3iat a rl(mo;u)aetrmr3tatoatr neil(0s2xo(r3iudllt licsa(fsDtaur no1optn iciydfmDua( sn()aexrmr tadlaD anvil() eurirpny1llte iesl() 2tau ooo0tleoio3iat s emumont)teeoio oy1lmDeauvils)s2uoxm3ou1op emfcils)aDua(  no1olx mo3iyd m2rl(vs (4 rxoio3tadfp  aiesl(  rxmxm iu4lmt miesatfsrurxroou1oeeomf3ildla uanmpnt) etoiociy1lm   nvi;(0teurxm oy4al  lict ()aDraxmont4tptomoeiatls2elu s;(4 exnif3ia1lpDe ueslt0 2xm(opoydaptnmicslsf 2tm(moou1tetomoetat m2rlu s;u0trxnir3oatfptr nvils0 rurir oo1lltnmfvt (fs2rmxrpou0oet iiciys aDran p;t0tetrmoctotfptelies;(0tetrir oy4amt  nctltf 2ur(  nu0aleomo3ildfs2ranvonu) lxnxo3todfpD  uvo;s0srto(m3oy1apeemfetltfaDum(r oo1tlxo i3iadfmDeln sn()alxnmfcoytfateaueo t0setr(rpoo1lleelfcsltfaDtaxr ou1ape  ietldlmDrmumo;u4 renxf3iotlmt lies;( srxoiopou1alen nei t  Dta( poo1aleo f3tldlsDrmnvpnu)tltrir ia1fpt lueo;() rxr(o3ou1optnlfei ( s2tauront4tptnif3tlsla2emnmpn(4 rtomf3iytop rlnei;s)t2trxr io4amtemnctl(fsrtaumo;o4oetomfeiytfs ulnmon(0 rtnmr3iotoptrlu i s seurirpoy1lme mieil() Dum(r no1apx  ieiydfm rl( p (4 etnmfciy1optrli ils s2uoir3oodap n nei s srtm( pnu1oeeoii3iltls eln s u0teermf3iodfpDeli s (0 2tmxo3iodomtelnctat  Dtrx p;u4alxo fcild m ea(ms t0trerir tydlpDeaieilt) 2xoirpny1lmen fcs ()s2taxrpnu4teto f3iytfmDrlump (4tltnifcty1lpteli s t0 exm(r3ou4optemnei sf Dtrx oot0tetnif3iadfsDrau p (0teerir tytfpDraivo;(0trtm(o3oodlpt miviatfs2rmxm ;u0oex ioetltla emu snu0arermr3oodop   i i ()t2xmxmpnodam nlfes ( aDrmu o;t1opx ioeiatfm rl( snt4 exomr3iatoa e nvol() exrxo3iy4om  lnvsltf Dta( oot1apxoiictltfa2rmn o (0 etomocoodfmte ivils) eumxmpnodal  lfvs t aDtaxrono4oet mieiytlmDra(vs;u4arenxfcto1fa   n ols)t2xrio3iudap emfei tfsDtmu p;t4opxn feiytfsDea(mp;t0tlxnmr3ia1opDeli s;s0s2trxopoo1op n nctls)a2urur ot1apx iietatlm2emn o;u0 rerif3oy1lmtelnei;s trtoxo ny4apeelfvsls  Dum(mooo4olx mictad a2emumpnu0alxrxo3tytlm  livo s srtmxm oo1lm n ictl(fsDta( o;t0oeen ietyt aDuln s;u) lenmo3ta1lmt anei;s0srto(rpou4olt  ncta( aDta(mpou4aee  ietlsfs2rmuvsnt) lerio3oatlpD  u i s0 rxr(r iudlp elivt (f 2rau poo0aexomfeils sDra( o u) ltrmo3tytfaDeluvo t0 2urimpnydllenlfesatfsrta(rp;t4alx  ictydfm2eanvon(4 renmo oodfmDr ivo ()texrirpiu4ope liei t aDra(  ;o0oet mi3iadla rlnms;t4tlenxfcto1lm r ueil( srxo(o3no4optnmfei ( aDtrx o;o1alt  iciys a2rm( s t4aeenmrctytoa   ivilt0sruoir3iy4oleelfvt t  rurxm ou1tptn i3tldlm2uanvp;u4texrir oydlp  li o t0srtoxopoudol nmnvsa( a2ra(mont0tpxomoetatlm2rl(vo (4texrmf iydlm rauvol( srtmio3oy1al  lncta(f rtmum no1altn icilt aDem(mo;u0altnmf3iatlpDeauvsls)s2xoxm ny1omt  fvtl()arrmx pnt1teto o3ildfs2raumonu) lxnxo3ty1om elieol(0texr(m3oodll e neia( s2ua( ont0optomfctydfa rmu o;()alxnxr3oa1op eluvsl( t2trim oodal  lnetlsfs2rmurpnu0tlxomo3tltlaDem(mo;()alxrxo3ty1oat  u il(  rxo(r iudol   netlt  2rr( ono1apxo o3tldfmDumnmo () etrmo ia1lpD  nvslt s2tm(o oudlm emivsl()a2ra(r nt4altoiocild s2rmnmo t0 etnmocta1oa r i o;t trtoxrpiu1lmtnlivs tfa2rm(r ou1tpto o3ilt s2eanmo;()aetrmo3oo1lp e u o;s0 rumiopno1lmtnmfcsasfaDraurp;t4olto ieiasfs ra( s;u) leomr oo1fm eai s t0seuoxrpnu4apeemfcsl() rraurp;t4tlxn fctltlsDrl(ms (0 lxoxrcoatomD anei (0 2ur(rpoy4alee fviat)srtr(rpot0alt miciytfa2ra(vs;(4 leoio to1fmtr n ol(  2trxopnydlme lnvsl( s2trxr ;u4teto i3iatfs2um(vs t4trxomrcty1omt aiei;()srtrxr3oudlp emiei t) rraxmoot1opt mi3iytlm2eanvsn()alermociy1fmteaneols sexmxm3iudlpen nci (f 2umumo;o0aptn o3tas m em( o u0altomf3ty1lm   uvo t)srxoio3oudalt mivsat)srtr(r oo4aexomocilsfa emuvs;u0tlerxocoo1faDr u sl( sexm(mpno1lltn iet s) rrrxro;o1tptn octad m2ulums t)teerifcty1fp e ueo ()t2ur(m3iodlm emnctl()arur( pou4optnmieils a emnvs t) exrio tadfp  li sls0t2xrxmpoydapen nesasf 2ra(m ot4tleo i3iadfa rmnvsnt)tlxnmrcty1omD  neo (0s2xrir3no4om   ivs (f Dta(rpnu1texoiocilsfaDemump (0tleriocoydoatr ivs;( setrxm3oo1opeemivtasfa2um( pot1tee mi3tytfa uauvp;t0alxoxrciytfpt aneolt) rtrxo ou4alt mfct tfaDuaumooo0alxomi3tyt a2emu p;t4tlenmfciodfateaiesl()t2tmxo3nu4ole  fvs ()sDum(m ;t4opxo ictadfmDrlnmp;()tlxnmfctodlaDean s ( truoxr3iu1optn ictlt)s2ua(moot4tet ifcild aDua(mp t0 exomocoo1fmDelies;( s2tr(m3nodomen nciasfsDraxm nt1tltomi3ilt m2ean on(4 lxoxrctadlmD lnei;(  2tm(rpou1op  livia(f rrr(mpou4tee mo3iadfmDuau s u)arxrio iy1omDelnvolt setmir nodlm   fcslt)s2rax o;u0tpeomoeild aDeau on(4 renif3ootoaDeauesl() etm(o oo4llenmfvta(  2ra(r ou4tltoifetys s emu pnt4tetnmf3iy1oaD aies;s setr(r3nu1optemivtls)a2rrxrpnt4olt mfciatfa rmuvp t4aetnmf iadlmt  n o ()trtr(o oudlp   netls sDurxronu1aexnmoctyt s rlums t4 rxnmrcoydop  aivi;s)srumxrpio1llt lfet s artmuro;t1aetoiociadlaDulu o u0areoxfcta1omtr ivs;s)s2xoim3ny1omtnmieiat sDur(rp;o0oeeo fciysfm el( p u)aetniocia1fpD  uesls)seurir io1lmenmfvtl(  Dtmu  no1olt mieiadfaDrm(vp t4alxoxo tydlp eli slt t2ur(opiy4ale  iciltfsDtmxmo;o0oltomocild a2um( snt0arerxf iadlmDrlnvils0 rum(opoydam n nesl(  rurxmooo4tlxnmfeiytfa2ea(ms t4tlerxr3oadop  li il()t2xmxmpou1apt lfvslsfa2raurp;o1tpeomfetasfa2ua(msn(4tlerxocoa1fm rli olt t2uo(o3oo1llt mivtas) rtm( ont1ale mo3iysfaDean o;t)tleoirciotoaD  ueil()t2trim oydop nmfvsat sDua( pou0alt iieildfmDrl(mpn(4 rtrir todfaDeauvilt0t2trio io1oltnmnvsatf Drmu p;u4olx ifctas mDeau snt4trxrmrctytfmD  nvilt0setmim iodol n feiatfarumxmpno1oeeoio3tlt a uluvp t0 ltomr ootfmDeauei;s0seum(r iu1apenmnci ()s2taxmo;u0opxomfeias a2uauvs;t) etomo io1fa e nvs (0teum(r iydlp  mnciatfarumu pnt4oeto o3ildlm ea( o;(0alenxo oodlate n olt s2xoim iy1ol elfvsl() rrrx pnu1oex  oeiyd m emu o;()alermfctytlpt  iei ()s2ur(r ou4amte nvt s a2uaum ;o1texomo3ilsfmDuan p (0alxrmo3iodlaDr ivs;t0s2xo(m3oydalenmfcil(fa2umu p;u1aptomiciatfaDemnvo u4trtomo3iatlpD lu olt0 exm(o oo4lmee fct ()sDtrur no4olto feiyt mDranmsnt0 ltrio iodfa eauvo t)tetoir3iodom  lfetls)s2ta(mpnu1teto feiltlm eluvs t0treomoctatlm  anvi;( s2tmxm3nydomenmictlsf 2rmu pnu4ape  f3iasfaDrmums;t)texoxociotfpDe i s s0texrxm ny4lmte ieiat) 2trx  ;o1apt mf3iasfs2ulnmo;()aetomr3iy1fm  li i s)s2urir3oudale lfesl(f Dumurp;u4oltomieilsfa ean ont0trxnio oa1faDraivsls) etoxmpio1am   ncsls)aDtax o;o1optniieiltls2rmnvs;(4aetomr3tatfmDelueolt0 2xm(r io1llen ietl() Drax ono0oeto i3tltls um(ms t4aexoxr3iadfaDr ues;s0 eurxopiydlmen nci t)artau ono0tpt mf3iadfa2rl(vo;(0tltoxr3oatoateauvs s0 rxr(mpiu1lp nmieta()aDurumpnt1tlxo oetaslm raumo;t0trxrmr3oydfa eau s;t seum(rpoo1ll nlivsa( s2rmu p;u1tpx  fetltfs2uanvon(0 reomf tadlpDraiei;s0 exmxmpoy4lleemfctlt a2rau poo0oexn ictysfsDum(msnu0alxrmf3tytoa rlueo t srurxrpny1ol  mivi (  Duau pou4olxo f3iat a2rluvsn(4trerxociatfmD au i;(0srur(r3nodlm emnvs s)aDrauro;u4oetnmf3tys a rlnmp t4 lxnmrciytfmDraueo s)t2uoirpno4ap e ivta( sDtrur ot0tpeoifcilslmDuan p;u0 rxoxo oodop rau i t s2urim iy1ol nmneiat srra(r ;u1ole io3tlslaDrmnvp u4 leomf tydfmtelneo t0setm(o3ou4lmt mnvs tfaDtr(mpoo1tleomfctas a ulnvo;t4 eenxr3io1omte uvi;(0 exoxr3nydoltelncs (  rrmurpou4alenifciadfmDua(vsnu4 etnmfcoytlaD lnvi;() 2xoxr3oo4lp emiesasfsDumurp;u1olxoifciydlsDrm(msnu)tlxoxfcoadoateaivols)seuoxopou4omtn ieslt)a2rax oot0tltnii3ilsla ua( snu4 eenxoctodfaDrlivo s)t2umio oudom nlneiasfsrtr(ro;t1tpx mf3iatfm2em(mp;u)arxomf tatlatrau i s  etr(m3oudam  lietls)sDtaxr ot0oeeomiciatlm2eanvpnt4aleoxfctydlmDr ivi t trxoim3nydamtemfvtatfa2ta(  nu1aptomociys aDuaums u)tetniociodomD an ols)srxoxopnydomeemieils  Duaur ou1tpxnmoeilsla2rau s;t)altrif3ty1fmDeliesl(0sexoiopoydlp   nvta( a2rau  oo0tetoii3tytls rlumo;u4 etrio3iytlm ean o;(0tetm(mpiy4lmtn fctasf Dtm( o;o4aexomociys s rm(msn()aexnxo iydfa e neils)trtmimpoydapeemici s srtr(ronu4tee ioctlslm2ranmsnu0 etrio3oodoptelu sls0 rurio nu1omtnlnvi t) 2rmxmpnt0teenmociaslm rauvp;u4 renxf3oo1fptelnvi (0 2toim3iu1ol nlnes s sruaurpnu1aeeoiociys aDeaump;()alxnir oydoptraiei t)srtrio3ou4omee ieslt  Dtr(mpou1aeenioeiadlm uauvs;t4 eerxfciodlmD liei (  exr(o3nu4op n ics ( sDtm( ont1aeeoiictls sDumn ont0 lenmo3iydfmtelnvil()s2tmim iodamtelietas aDumumo;u0opxn ictltls2rauvp (0 etomf oa1fpteau s;t0t2xrxm iu1ll emieia(fa2uau pou4aleomo3iytla2ua(ms;t4trtoxr3oodomte ivs;t0 rtrio oy1oleelnvsa(  rtmumo;t4oex moctadfm2elnmpn(4tlxnir tytlpt auvslt) 2trxo oodolenmici t  Drmxmonu0ole iieias m ean onu4tltomr iytopDeau o s)t2uo(o3iu4ap elncta()a2tm(mooo4texo ieiatlm uau p;(4artomf3oadla r ues t0teum(r ny4ol e nes ( srtru o;u4tlxn i3iytfa2ra(vp;u0 ltrmo iodfmD ln i;(  eum(rpio1om   fvsatfa2uru  ;o4tee  o3iadfmDulu ont)trerxr3iodfaDeau ol(0 2xo(m3oodlp elfvsls  rumur nt1tleomoetadlmDum( p t) eenxfcoa1omDrai s;t setrio nu1lpe  netls)srrauront4tltnmoetls sDrluvp;u0trxrxfctatlpt  ueo;() 2umim oo4lptnlivtls)artrxront0tet iieilsfmDumuvs u0 eeoxf3iytop   nvsls t2tr(o nudlm e nciatfa2ua(m oo1opt moctls s umuvpnu4alxrmfciy1lmDe iei ()s2tmxm3iudapt lfci s arumx oot1tetomi3tadlm2rl( o u4 lxrir3to1lm rai ol( s2ur(o nu4lltnlfetltfa2tau o;t1apen oeiyd a eau s;u4 exrmr tytlpDr nei s  2xoim nu4ole  fviat  rtmumpnt0altoifciydfmDeanvo () renmo tadfm eauvsl(0 rtmxmpnydopenmictlt)s2tax pnu0opxn fciad sDrlnmp;(4 rerxr3to1lpte uei;s s2tmxm3iudale mivils  2tm(mpno4ole  fciltls em( o u0aetnir iy1fptrlivi;( setrxr nu4oleemivi tf Dtmxmoou4texoiictldfs2ranmon()arxrmfciy1late nvs s) etr(r oydalte fvtat)sDrm( o;o0texoioetys a uaumonu)tltnxf3todlmt  ivo t s2xmir3nodlle mfvslt) 2rax pou1tex iiciadfm rauvo;t4arenxr iatlpt lnesl()truoxm3nydap  liet t aruaump;u0apeoiictyslm2rm( onu4teeoif ootfp rlueo t  2xrim oy1openmncia()aDtm(r ;o4alxnmi3iasfa2uluvsn(0tltnio iodopDe neo;s)trxoimpou1llen fcias)s2tm( o;u0aeeoioctytlaDrlnvsn()trtoif oy1oaD lu i;s0 etm(m3nydapt  ics s  rra( p;u0aptnio3ias a raumsn()areomf3oo1faD  i o t) 2tmxopoy1am  miesas) Dtr(m ou1aet ioetadfm2ulumo t0tlenio tytfpDeln sls) 2trim3iy1ll emfcia( sDtrxmpno4olen oeiytfa ulu p u4trtrxf iy1optrai i t seto(r3nu4lmt  fvt sfs2tmx  ot1texomictydls ul( snu4texrxrctatoa  ln s;(0 2xmim iydamte fet tf Dumxmo;t4alxomoeiyslm2rln sn(4tetnxf oodfptrlies ( tetmxo iu1openlies tfs2rrxrpnu4aptnmf3tldfm rmnmo;t) ltnmo3oy1fp e i i t)srxoxm3oo1om elfcias artaxm oo4oeto oeiytfs2rln p (4aetrmo3tydfmDeli i;t tetr(m io4aptnlnci ( aDrr(m ou4tpxnifeils sDrln p;t4aetnxo3iodopDeaueils trxm(m nudameemnci ( sDta(mooo1apeo f3iys m eau o u0alenmo oy1lpteln slt seumim ou1alee icta( s2tm( oou1aeeo o3ias m2uan sn(0tlxnmr oydlm e i i;s trtoiopoy4alen iet t arrm(  no0alxomiciasls ua(vs;u0tltrio tytom   uvi;s seuoxr nu1ol   fvil(farrmurpno0oexn ictysfm2uanvpn() rtomfcoydoaD an ilt)srxoxr3iu1amtelnci t) 2ra(r nt1oleomfciytlm2ran p t0 lerif3oydopt lnes (0 2xm(r3oudome  neilt)srta(rpnt0alt mf3iytla rlnvpnt4altnio iytop r neil() euoxm3nu1llt mfcia()arra( pnu0oltomiciysfs el(mo ()texomo3oytoaDraivilt) eurirpnydaptelict s) rra( pot0open f3ild a2rmuvp t4teenio io1lmD auvs t0s2trim iydamt mfeia(fsrua( pnu0aleo ociltls uln s u4 rtrmf3iy1op  ai slt)trtrxmpoydlmeemivt (f 2tmuroou0oexn iciadfs emu o () reomr3oadoa  lnvs;s0teuoirpno4lle mnvias  Drmumpnu1aet iociys a2ul(vs u4treoxr oadfmDrlieo s)seur(o nydolenmfci sfsDum(m nt4olx if3tltlmDranvs;(4trtnmr3oadlp rlu o;s) 2xrxrpnodale mivtl( aDtrxm no1tpenmf3iltfs2ran p (4tlxrxfctatlm  aivsl( texo(r3io4op   ivtat)arumurono1apx ii3iydfs eau p;t0 exrxf iadfa ranei;(0tetm(m3oy1ole lnvilsfsDurur ;o0tlx ioeildlsDuau pn(0aleoifctodlmDeli ilt0tetm(r3no4om  mfet ( a2trumonu4oex  fciys m rl( o;t0tleoxr iotfm rauvs;t0 2xmxr3io4om  mfesasfsDrax p;t1tptn fciytfa2umnvpnu)teenir totlptr ues;s0sruo(rpno1alt lnvs sfsDuaxm nt0oeto ieild m umuvp;(0aeerxrctatfa  aies;s s2to(o ny4omtemfctls sDrmxm nu0alt mo3tysfa2elu o;t0teenmf ia1lmDrln olt0 rtrxr oo1al  lnvsltfsDrrxr ;o1texoioctldfmDelumo;u0tlenmo io1oa elueslt) 2xo(mpou4amtnlivt sfs2umu o;u1apxniiciatls rl(ms;()alxomr ta1fa eanes;s)srtrxr oy4llenmfes (fs2rmxm ;o0opxn ietltfm rm(mo;t4 ltoxf iodfat  nvi;s) 2tmxr3oy4apen fesl(fsruaumpou1apx mo3ildfs2umnmp t4 eerxr3io1lpDrau il(0srxmirpiudope micsat)s2tm(  nu1aleomoeiysfaDran snu)texnxo oa1opDe ies;t)seumirpoydomeelicsl() ruax  nu4tle mfeilsla eaumonu)trtnmocta1latrauvi s)texmxr3oy1lp e ict tfartmum ;t4tlenifciytlsDumnvp;(4tltnxocto1lm  lieo;s) ruo(r3ny1am nlfcils) Dtmxm ou0aet ioctyt sDum(mo;(0 ltrxo io1fm rauvo s)seur(r iydom  lfeilt sruaumpou4teeo i3tas m2um( p (0 lenio tydfmD auvo s t2xm(rpny1ole  ivta() 2raxmpnu1tlxnmieiydfm elu p;(0tleomo3iodfat lnvs (0t2xo(mpoy4ope  ictas  Durur nu4apxnmfctadfs eanmp ()texnmfciy1fpDeai o;(0sruoxr3nu1opt  ict () Drm(  oo1tle mf3tys m2uaumo;(4tlxoxo oadfp rauvo (0t2xm(rpiudlmtnlfctatfaDuax oot0apxniieiatls2ua(ms;u4areoio iydomteaivolt)sexmim3oydaltnmncil( srurx oou4oltnif3tyd s ulnmp u0tltrmf3oytoaDeln ils)s2ur(opiodamenlivi s) Durxro;t0apenmoetltlsDra( p t0 rxnir ia1lateauei s0trtoim3io4optemnctl(farumx ont1alt miciasfs2ea(vo;u4aexnif oy1op  an ols) 2ur(opoodopt  nvsat)srrr(moou4opx  fctltla2rl( o;t) etoif3iadla   n i;s s2umxr oudllt lfesls s2uax o;o4oet ifeiadfs el(vp u) eeriocto1laDrlueo;t trur(m3nydllt mfcsat) Dtmum ot1oltomociydfm ulnmo;u)arenmo ty1fpDranes ()trurxmpoy4amtemfvi ( aDrr(mo;o4olxnmictatlaDemnvon(4tlerxrcoytomtrluesl(  rxo(o3iodom nmnvt t)sDrax ont0optniiciasfa2umn p t0tlermoctadla  aieils)tetoirpio1amen nei (fsrtm(m oo0aexoifetltfsDrmu p;t0tltoxf oydfmtr nvo;( srxmim3ou4olte fcta()srurxmpno1opxnmicildfm ul( s;(0 exnmo3tadlm eaues;()t2umiopiy1amtemfcs (fsrrm(r ot0aleoiiciysfmDraums t)trtomr totla r ivo;s  euo(mpno4lleemivsasfaDrrumpot0tpxn oeildfa rmu o u4aeenif oydomDeluei;( trxm(o3nydamtnlicil()sDraxmpnt1teto i3iysfs ua( o t4trtoxf oa1op elneslt0 rtriopoy1op nlictat)sDra(m nt0ole  i3iysfs2emums;t) exrxr3todlmt  u ils) rxo(mpiy4amenmies s)srtru  ou1opx  o3iys m em( p;(4 lxrmf oy1la  aueol(0 2umxo nu1lme mncsa(  Drrxm ot1oet  icild mDea( pnt0alxnxo iadlm  luei;()teumxr nudaptelfct s) rtmurpoo0tlt miciatfa2uauvs;t)tlxnxrctodoaDran ils)trxmxm no4lpen ietl()sDtrx ono0opeoiociasfm2ul( p t0aeeoxr3oadopDelnvi;s0 etoxm ny1lmen ivsl()arrax  ot4aetnii3iytlm2elums;u0tltoxf3oytlp r uei;()trtm(r nu1ap   fcils)s2rm(ro;t1open feias m ra(msnu0texomrciodoate n o (0sexrir oo1ap  micilt) rrmxro;t0texnmfctltfaDumuvont)areomfciy1latrlu s s  2xr(o3ou1apenmiciasfa2tax o;t0oetn ociatlm el(ms t4 etnio oy1lmDrau o;t)texrxopou1lp emnet s aDtr(monu0oltnmoctatlmDrauvont)aeermf ia1fat aivils0 euo(opiydaltnmfcsl(fa2uaumpnt4tptomoetyt sDumn snt) rxnmfciotfm r uvs (0s2xmxopiy1lm emnes tfa2rmxmp;t4tpenioetatlm2ua(vs u)aeenxfcia1oat livilt0trurirpiy1al  mfesa(  Drrur nt4opxniieiytfa ua(vs t0aexnmociytomDr nvol(0teumiopoudlme mict (  ruax  ou1aex moctydlmDrln s;u4aetoir3oatopD aivsls  rumxrpiy1lpt  ietatfaDrax  nt1aptn octatfs2emumo;u0 etnxo3oatlat ln o;t s2toio iudaptemics t)a2tau o;t0tetn ociasfm2ulumo;() ltnmrcoodomDeaivo t tetoim iu1am e ivs t aDtmxroot4aeeomocildfa2elnmp;(4 renxfcia1lmDe nvs;( t2umio3oo4alt lncslt)a2umumonu4apenmf3iat aDean sn(4texnmf3iotfm  lnesls0seurxo nu4lltn ivi s srtmx p;u1tpeo iciltla rl(vp t) rerxocoatoateaies s0teur(o3no1llee fvia(  ruax  no0tpt mfciltlm umnvo u)trxrmo io1op rln slt0teumim3oodll nlieta(fsDtruroot1tpen iciydls2ran o u0 etrirciadfmtrauvs s0t2xm(opnudomtn ivi s arrru ooo1oexn oetyt s2rmnmonu4tetnxfcoatopD lnes ()srxmim3io1lmtnlfvs s  Drrxrono0aeenii3tytla2eanvpnu0 etrmf3io1fpDr u o;s0 exrim oy1lme lict s)srrrumpnu4openmf3iadfmDeaumon() exnxfcoy1fmtraies;t)s2tmxopoo1alenlivs s sDtmum ;u4oeeoio3iyslmDemuvp u0 reoxo3tadfa ranvi ( setrxr3oo4lleelnci ()aDrruro;u1tee mociaslsDulnvsnt0 ltnmr tytfptranvo t srumim ny4lptemnvt sfsDrmu pot4apxn i3iytfsDelu s;t4artrio3todoa eanes t) eurxr3iu1al nmncsl() rra(mp;u1teeomociat mDelnmo;u) exnxr iotlmDrauvsl()t2xo(o ny1omen nctl()srtm(r nt1olenii3iltfaDrmnvp t4aeenxf3oadfmte nvs s0 2urxr3nudll emfvs (farumxroot1aee moetyslaDua(mp;t) ltnir3oy1op  auvs (0texmxr nydaltnlicsat sDtru  ;u4aet  ieils m uaums (0 exoxo3oy1omte n s s  2xrim3iu1olt lfvta( sDumump;o0tpx mfctldla emuvonu0tlxnio3iytoa e ieil( s2xrim3iudlmtelnvt sfs2rm(rp;o1texomfciatfs2ua(mpnt0 eeoxociadfa   ivo s  2xmimpny4lmt  iet ( s2umxroou0aptn o3tyd m emnvs u4altrir io1late ieo ()teur(opnu4oltn fvta(  Dra(mono4oeenii3ias a2uln pnu0alxoio totlateai s (0t2tmio3nu4apeeliei s aDrmxr no0oee iietatfmDemnms (0tetnmr oy1fpt  i slt)tetrirpno4opt  ivsa()srrrx p;o0aleoii3tltfs rlu onu4areoxr tydla raues (  etrir oudalenmfeta()arua(m nt0oltoiociysfm uln pnt4tltrmrctatlp raues s)srtoim iydop emict t  2um( pno0aet  oeiadfm2umnmp (4 leomf tatlp  ln i (0 exoio nu1ol e fvi (f 2um(r ;t4tltnmieiyd sDumuvo;u4 lermf oo1fm eaueol(  rxmirpoy1opt mnes t sDtr(mpnt0oeeo fciad m2ran sn()tetnxoctydom ran s s) eto(m3io1amenmivtls)srtr(mpnu4aet mi3tatfs2ua(mp;t0tleriocootfa eanvsls  rto(rpou1op  lnes t)aDtrur ou1apxoiieilt m ra( p;(0 rtrio iadlat  u o;s) 2urxr iodlptnmicia(fa2tru  ;u4opeomociydfa eanvo t0trxoxoctydomDeai s s)s2tm(rpnu4omt mfes s srumxmo;o0opx ioeiasfa2eaums;t0aetoxf tatoat  ivs t s2trxm3iy1ol e iesat aDuau pot1texoii3iyt m2ean o;u4 lxoif3ia1laD aivi;s t2xriopiu1lm  mnci tfsDrm( ono0aleomfctatlm2uanvpnt4teerir ia1opD  neo (  etrim3iu4op  mfci s sDrmum ou0aptnmoeiytlm elnmsn()altrxr todlptrlnvs;(0seurir iu4lpee fctlt)sDtaxr nu0texniieilt s2umnvo;() lxoio iodoatrlnei t t2ur(mpiodap n fviat)arrrurpoo4opx mo3iltlm2elumsn(0texrxf to1faDeaieo ()seuoxm3iodamtn nes sf rurxr nu0aet ioeils a2ra(vo;(4 rtnmf3totfp  auvi s teurxm3ou1am nmfes (f 2tmx pno4alen ietadfmDum( pn(0arxrxfcty1lat anvslt)srtrim3io1olte iesltfa2tmxr ;o4tpt iietytfa rl( sn(4 etrio3iytfp r ieolt0 rxo(o ny1lme licsat s2rmurpno1ole mictldls rluvp t0 exoir iadomt  iei;(  ruoxrpoy1omte ieilt  2taur ;o4alt  f3tadfm2ulump;u)aexomr3tytlpDraueo s0sexoxm3io1ope  icsl(fsDuax pou0oex iocilt m eau on(0alxnif oytfa   u o () etoxo ny4omeemneiasfartm(m ;o0tee ifciysla2ulu ont0trtrxo3todop   ivo;t)trum(m3oodapen ivsat)arum(mo;t1oex  fctls mDulnvo ()tltoif ta1lp  aneilt) rum(mpiudal   fvils)arurumono0oeen feiydfs2em(mp (0aexnmfctodoaDr n i (0 etr(o iydolee fvt t  rtmxr nu4tle ii3iyd aDua(mp;u4trxoxfciydfa rlneolt0srtr(r oydlmenlfcslsf rrmx pou4alxniieiatla em(vo;u) rtnmrciodom eanvo () exoiopnydap e icilsfarra(mo;t0tlxo icildlaDua(vs t4trtnxf tatop eanvo t) 2tmim3oo1lmen nci t arum(rooo1ale mieias a2umuvon() rermf to1lmDe u i;s texrirpiudop  lici tf Durxm ot4tee  iciytlaDumu p;t4tetrxoctadomte iei;t0 2xoxopoydal  lnvi t  2rru ono1opxoifeild sDulu snu4trxoxo iatom e nvolt0teumir ou1omt mieiasfa2rrxronu1aeeo fciasla emuvs t4tlxoio3oytfat  neolt texriopoy4lltn ivtat arra(mpnt1tptnifctys s rau o;t0aexrxr ia1la eaneils s2toxr oo4lpe lnvs t) 2taumpoo0tex  oeiasfs2ran s;t4texrxrciy1fmDe ivils  2xoxm3ny1ameeliciltf Drrurpot1oex moeiyd aDraumont) eenif3oadlmD aues t0sexrio nudal  mivtasf ruau ont4olxo ietyslmDuan o;() reoxr3iytop r i sls sexo(r3nu4lpeelivs tfarumxm ot1apeo iciat m ranvonu0altrmr3oadomD lieols)seum(r3nudam nmivsa(faDrr(m no1aee mo3tyt a ul( pnt4trtoxfctydla eaiei;(  rtrxm oydapee fvs ()s2tr(rpoo4teen fetld s2emuvpnu) lenif3oytfa  livo;() exrirpio1omtnlnct tfaDum(m nt4alxnmieildfs el( o u4tetoio3iodoaD li olt)truoir oy4ape  ivtat)aDtmurpou1alxo feiatla ua( on(4 eerif3tadfat  i s () 2xm(r ou4llee ietat)s2umx  ou0optnmf3tas sDuauvs t0tetnxrctydfa r ivo;s)tetmxopiydopte ict sf 2umx p;o4tlx  octatla2elu o (4tetrxf oydomDeaiei;s) rumiopnydal  licslsfaDtrxr oo0tex  o3ildfsDean o u)trtomf3iy1oatrlnvs;( seurxmpny1aptemieiat sDurxmp;t0tleo ietasfm2um(mo;(4altnxo3oadoptrluvi ()trtmiopoy1op  mivsatfs2taxrooo0optnmi3iltlm2eaumpnu) ltoxrciotfate uei;s0srxoxm nudaptn ivsl()a2uaxrp;u4altn o3iydfa um( p u) lxrif oadoaD  i i;s)srtm(rpoodlmtn ncil()s2urx ont4olxn fciydfa2emnvon(4aetoircia1lm raies (  exr(o iy1alenlnvi s aDtmumono0tle  o3ild s ea( pnt0 ltnxo3iadop   uvo () 2tmim oo4apeelfcias)aDurumo;u4alx mo3tls aDelumpnu4arxnmo oy1lm eauvi ()t2um(mpny1lpe mnvia(  rrm(mpoo4tptnio3iadlsDuaums;t4altnircoatla  ai o;s  exrim3iydom  lnvilt s2rr(mpot4oetoioctydfs2elu s t0 renio3iatoaDelneo;s0 2toxo iy1ome lfeia(fa2tmx oou0oeeoiietydlaDemn o;(4 rtoxr ty1fa rlues s0 rurxmpiydop elfcil( a2ra(ro;o1apeoiieilsfm2el( p (0aeerifciatfp r u s ( srumxopiodlpeelivt () 2trur nt0olxn oetad a2emump;t0aeerxrciatfmtr i o;t srxmxopiudlm nlneilsfs2rr(r ;t4texnmf3tysfm emu s;u0 eeomo ootoateluvo;( trumxr nodlp n fes sfsDuaur nu1olenmo3iad mDumumo t0teerir3ootlm eluvs t0t2uoxopiu4omt lnet t srururooo4aeeoiiciadfa ra( p;u)tlxrxf tatlm rlies;t s2xrxr3iydomen fciat  2um(  nu1tpx ii3ilsfs umu s;u)arxrmo3oatfaD  nvil(0srumxm iudlp emnciatfsruax  no1tpeo ietytlaDumumon(0 etrmf3io1omD  uvo t0tetoxo no4ll nmnviatfartr(m nu1apx miciys m2eauvsn() etnif3ia1laD aivi () 2toim3oy4ale  fesa(fa2ra(rpnt0oexnmfeiytfmDumu s;t0 ltoirctodom  lieilt0trxoxrpiu4lltelfvsa(fs2tax pno4oleo f3iysfa um(ms t0 etrifctatop raivi s0sexoxr3iodameelnvtasfs2ra(m ;t4olx ifetadfsDem(vs;u4 eeomo3oodla  lu i;(0srum(o3iudopee fetltfaDuau pno0oex ii3iltla2eanvo;() leoio iadom ean i s) 2toio oo1omt  fvsltfa2tau pnt0aet mociydls2uau p u0tetniociadlp   ivsl(0teuoxrpnu4lm   ietlt s2rru  nt4oleomfeiltls2uan p;u4teerif3tadla  aivo;()teurio no1olenmneias a2uau p;u1opt iietldla2uauvo;(4trtnmf3oydlptelu sl(  2umxo ou1ll e fctasf Dtrumpnt0texo oeiad s elumo u0arxomrciadlatr nvs;s0s2toio3nu1olenmfetatf rta(  nt4oetn f3tat sDemnmont)trxriocio1omtrln i ()s2tmxrpny4lpte neiatfaDtrumonu1tptnii3ils mDel(vo;(4alenxo3ty1fmtelu ols  2uoxr ny1lltnliesls) rra(roou4tlxn ocias sDuauvp;t0trtnir oatoaDraivi s texrim3iu1lmtelfctat)srra(ro;o0apt moeiysfaDuaumo;() lermf3ia1oaDrlivslt)s2um(r3ny1lle  ncsas)aDum(  ou0tptoio3iat aDra(vpn()alxrmfciodoateln s s s2toim3oo4lp elncsatfsDrrum ot0tlxomo3iysfs2um(vs t) rxnxo3oadlpD  nei;(0 2tmxm3oydamtnmfcsas srrm(m oo1aexn feildlsDuauvp;()trtnmr3tytfate nvi s0srumim oydaltnmfei s) 2rax  nt1tlxo fetydfa eln ont)trxoif oy1opDeaieols0teurir oydame lfctlt sDua(mooo1oetnmf3tadls2rmnvo;u4 etomr3iatopte ivsl( trtrio iudalt  fet s)srumxr ;t4optn fciad m2uaumo u4altnxr3ia1lm eanvo;t)t2xr(r3iy4lme mnci ()s2uaxmpno4tltnif3iysfs2ulnms u) eeoxr3oa1late n sls) exrir iy1omt lfetasf rrmxmonu1tpe mociasfm2uauvs;t0 eeoif3tytlat  ivsls  rtriopnu4lm nmncs s)aDraurpno0oee ii3tysfmDul( o;t)alxoir3tytopt ai i;()sexmirpoo4lm  mfvt tf rumu ont4opxnmo3iatlmDelnvs;u0arenir3ia1lp  aneo t)sruoxr3ou4lpt miciatfa2urxmoou1apeomfcilt a ean sn(0tleomf iodomD auvsls)sruo(opoudal n icsatfa2tmxrono4opt ifciad m2eaumo;u0trenifcia1fa  lueo s teurirpoy4apee
\ No newline at end of file
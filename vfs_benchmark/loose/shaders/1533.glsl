@@ -0,0 +1 @@
+nvols0sexmxm ny4op   feiatf 2tmx ooo4tlxoiictld m ulums u)aetoxocoa1fm   ieo;()srto(o3iudomt mfei t)arurxmoou0oexoiieiad s rau pn() ltomo iadfmtr nvs;(0truoxmpou1lpe mivsas srua(r ot1oltomfctatla2um(vo t)teenir3ia1optrln olt0trurxrpiodamee neil( sDta( pnt0opeomf3iltfsDrmn p t) reoir3todoaDeanvsl(  etmxr io1llte nvi t  Drmu  ;t0opx io3iytfaDuan pn(0 exnir3iodlp   ivilt) etoxmpnydop emnct sfaDurur no1oee  ieilt aDem( on(0texrmoctytlm e ueol() 2xo(r3iu4lptelncta()arraum ou4olen fcildfs2emn p t4texnxo iy1oa rln ols0 2xr(m3oy4am elnct (f Drauro;t4apx mf3iyslm2uau o (4trtoir3ootopDeaieilt0srtm(r oydlm  lneil(fsDurumpnt4oexn oeiatlmDulumo;t) rtomo ia1lat  uvo (  2xrxr3oy1optn nvtatf 2rrx p;u1olen iciasfa uanvs;t0alerifcio1fmD luvs;(0s2trxm3nydomtn nvilt arurxmo;u1tpx  f3iyd a el(mon(4aetoio oadfateaivilt) ruoim oy4oleemnvsltfa2raxm ot4ole ifciytla2um(vp t4 exoif3iydopDrlueo;s) 2xoxo3nodomenlnvs (fs2uax o;u4apxoifeiat a el(mpnt)tlxrxo3oa1oaDrauvi t0sruo(o3nodomenlnciatf 2tru p;o4tpx  oetytfs ulums;t4tetoif oadfpte ivols  eto(r3nu1lm  lnctas  Dtaur ;u1tee  iciaslm2rm(vs;() lerxf oatopteai i t0srxo(o3iu1ap  mfvtat  2uaurooo4aetomf3iatls ra(ms;(4tetoxrciy1oaD aneo;( sexmim3iy1amtnlfes (  Drrumoou1tpe mfetls s2ra(vs;u4tetnif3todfmD anvsls)tetoxrpoy4ap nmnctasf rrr(rp;u0optnmicils sDulumo;t0 rermr3iotopDe ivo t trumxm ny4openlncslsf 2raxm ;t0oexomieild a2elnmsn(0arenifctytlpt lu s s)sruoio nydal nlivia( s2umx pou4oet  octasla rlumo;u) ltrxfciotfmDraneolt0srur(m3nu1alt  nvsl(fsrtaum oo1aexn fciydla2rln s;(0 exnmo iy1fpDeai s;()trtrio3nydlm n neia()srrmxr ;o4opeo ieiysfa2ranvo;t0alermocoy1opte u s t0srtmio3iydllenmnvi t a2rmxmp;t1teto f3iytlm2rlums;u0arxrxr iy1opDeaivols0s2to(o3oodam n ivia(f Dtmx  oo4oltn ictys sDeaumsn() rtnmo3iydfm e ivs s) rxoxrpiy1ll elfcs ()srtaxmo;o1oet  oeiaslaDeluvs u4aexoif iodop ranvo;t texmim3oydlm e netasf Dtrx  ou0apenmfciysls ul( on(0 etrmr iatlaD lueslt) 2um(o3iu1ol nlfcias)s2uaurpou0olx ii3iysfs eluvp;u0trtoircoa1op  aivi;s teum(o3nydam  mics (fs2trx  no4tex  feiadls2el(mo;() eeoif3oa1fp ranei;t0t2toim3nu4ol nlfcslt  rrr(rpot1teeoifeiad mDul(mp;t4aexoxfcoa1fptr nei t0t2trir3iu4lle mivs s  2urumoot4apt  fetlsfa2uln s (0trtomr oodopt  n ils) eum(r3iudal  mfvtat)a2tr(mpno1tetnmi3iadfaDeln o;(4tetnmr3ty1oat auvi t0 rur(m3oodlpt lnet ()s2ta(ro;u1oeeomietlsla2rm( s;u0aetrmo oydlmteli s;s  rumxmpny4al elfet s)a2uaurpoo1oeeo fctlslsDrl( o t4 lxrmrcoytlmtelneilt0 2um(r iudomt lici s)s2urum ;t1optn fciadlmDrmuvsnu0 lxrir3ty1la elueilt setr(rpio4llen neilt)arur(mpot1olxnmoetlt mDea( s t0trenxocto1laDran sl( tetm(r iu1alen nvt tfsruaumpno0tet mociyslaDumnvonu4arxoifcoatlatelnvilt)seumirpoydaltn nes (  rrau  ;o1opx  o3ias a umuvo;u0alerio oa1oaD auvi;( trxo(o nu1ale mieias) rtmurpno0oexnmoetatlmDul(mo t) rermo iatlaD lnvil(0t2uoxo iodom elfet t srtmx o;o1olt  ieiytfs2ul( o ()tlenmf3iadop  lnvilt0 etrir3oydlmtn ics ()srumxmonu4altniociysfs2rm(mo (4tlxnxfciytfpDe nesl( t2xmxm3io4apenlfvsa(  Dtm(root4altnmictytlsDrmnmo (4teenmfcoa1fmD lnei;s sexo(r3oy4apt lfviltf 2rmxrpot4olto ieildla emump;u4texnir3oydlmD auvi;(  rum(o3ou4apen nct t aDtr(ro;t0tlto fctld m ua(mpn(0teeoio3todfp r neilt) etmxr3io4lmtnmfesat sDraur oo1tleomicild m em(vs ()texoif tatla   nesls t2tmxrpoo1lmtn nvi s s2uaur ot0aeeo i3tlsfm2rluvs u)aleoif ta1la eaies;(  2xrxm3io4oltelivsl()srrmumonu0oexoifciyt s2elu p u0 rxoxfciodlm  lu i s)t2uoxopiydom emfcils) 2truroou4apeomfctytlm2emn ont)tetomr3tytfpt an o s0trumio3oo1ap  lfvsls) 2tr(rpot4ole  oeild m2ean p;t4 leomf iodopDeai ol(0 2toxr io4om  lieslt)arumum no0alt  o3iasfm ea( s;(4artoxr3oytlp   n o s0t2um(o3iudopt mfetas)sDrm(mpou1tpx miciyd s emnmonu0aetnirciadopDelies (0t2tmxmpno1amtemnetatf rrrxro;o0tleoioctlt s2rmu s u)treoircoodfp eai s t setrim iodol nliviat sDrau pno4texnmfctadfs2umuvp;t0arxomr3iodlptraivi;t) euoxo oydom nmnei t)sDrmum no0tlx mo3ildlaDeluvpnu4texnxr3ta1latrlu o;(  2xr(opiu1al elicsl(faruauro;t1tpxoioeiydfs rlnvp;()arxoxrctydomt  uvo ()s2tr(mpiy4lp  mfcsat  rtrurpnu1aexnmictaslm rm(mo t) reoxr oy1omte u sl(  exr(m oo1omte nvias)artmu  ot4alxnmi3iydls rm( o;u4 exnmoctodomtraueilt0seto(m no1amtemfvsas s2raxm ;u4tet mictltfm ulu p;(4 rxnio3ootfpDe ieo s0trxmxr io1llenlnesat)a2rmxmpnu1tee  o3iad mDrauvo;t)teermrciydoa eanvi t srxrim iy4optnlivslsfaDua(r ou0oex  ieiltfs2rmuvsnt0 renxf tydfpDr n ol(0t2xm(r3iodol n nci sfs2rrump;u0oetnmoetltlaDelumon(4 eenif3ia1latranvi;s0seumxr ny1altelfvta() rta(rpot0aptoio3ild m emuvpnt0arxnmo todla  ln i s sruoxo3oydamtnmfci () rtax o;o4aptnii3ils aDul( s;u4tlxrmf3ia1oaDeanvo;( srurir3oy1am  mfvils srrmxmo;o0oltn o3ildlsDemu p;()aexnifctydoaDe n i s)tetmxo3iy4lm  livias srrax  ;t4tpxnmietyd s2ean ont4 eermf3totlat  uvi s s2tm(r oo4openlnetl(  2um(ro;o1aeen oeiasla emnvp u4trtnxr3ta1fmtrluesls) rtrxm3nu1omenlfvt ( sDrr(mp;o0apx mfctltlmDrm( s t) renmf3ootlptr ivi;t srxr(opou1llt lnciatf Drm(r nu0oetn fctyt a ul(msnt0 ltnmfcoy1lp  ln ils0sexrir3nu4olt lfvs sfaDtruro;u4opxnii3tytla2uauvpnu0tetrmf3ty1opDelnes (  2umio3ny1lm emfvt t)sDuaur ;o1ape iictyt a em( ont0 exrxocto1oa raieo ( s2uo(rpnodolt lnei sfs2urxrpot4tle  ietyd a em(mpnu0aeenmocoydomteaieol(  exoxm iu1ol  mictlt)srrm( pnt4oleomfetad sDra(mp u) rtnio3oadlp eauei;() eumimpoo4am nmfcs tf 2tm( poo0oleo ociasfs rmnmsnt4aleoio3oy1fptrlnvi;( teuo(mpiy1lmenmieilt) 2uaur ot1tpx ifciatfm2uauvs ()altrxr3tatfate ueo;t trtoirpnu1lm nlfvtatfarta(mooo4aetn f3iatfaDraums;t)aexoirctydlpDrlu ilt  2xmir3io4ll nmfcsas)s2tmu  ot4oee  i3tydlmDum( p;() ltnxociotfaDeanes t0 exoxo3io1al nmnet ()sDtaumoou0oetoifciasfm2elnvo;(4 leoifcio1lmtraueils  eur(m oodam nmies t)aDrrumoot0ale  ieiydfaDrmn p u)tetoxfciadoa elnvs ( s2uo(o nydam nmiei t)a2uau  ou0olx  octld a2rm( p t) lenxr iotlatranvs s0teumxm3io4ameelnct () Durx pno1tlxo f3iydls um(ms;(4tlerif3io1oaDraues t)setoxr oy4amee fctasf Dtrxroot4altn oetldlm emnvsnt0tetnxf3todfp  ln olt) eur(r iy4lleelfes t) 2ur(rooo1aptn ietat a emnvo t4trtrirctodom e ivi;(0tetmimpiydllt mfviat)a2uaxrpnu0aeeo fcilt m2rl(vs u4aexnmo totfaDeai i ( s2xr(m3oudap emfes t  Dua(  no1ole  oeiatfm2eaums (4 rtoxo3iy1omt ai i;t trxmxm nudllee netas)artau ooo4oetoifeilslaDum(ms;(0 ltrio3oatlmDrauei s seuoim io1om   fes t)a2ta(mooo0tpenif3iyt sDrm( s;u)aexnmrcoy1fa eauei;t sexo(o3no4opt lfei sfsDtru  no0opt iictydfa2uanvsn()tetomf3oytopte ueslt0trum(m oy4aptn ictat)a2raurp;u4tlxoiiciytfs elnvp;t0altrmr tydla elu o;s) 2umxm3iudol   fvias)arraxm ot1oeto ieildlm2ul( ont0tleoxocootfp eanei ( trxrxm3nu4ame lncias arrmxr no4opxniiciadfs2um( o ()texrmr3oo1op   iesls  exmir3nu1om nmfvtls a2uaur ;t0aexoii3tad s2rmumo;u4 exnifcoa1opt an s s t2uoxr3oy4op nmivsl(fsDtmum ot1tlen o3ias sDum(mpn(0artrxrciy1fmtrlues;t0 rxo(m3ny4ll  lfvs ()sDtr( oou0alto feiysfmDea( p;t4trxrxf3oadoa e ivs;s)srxmxm oudll emfetl(  rtr( pnt1optomoeiasfm2rl(ms (4 exrir oo1opteli sls)sexoir iudomtemivt (fsDtm(roou0tet ioctlt mDrmuvs ()altrmrciytlm ean o;()setoimpnodomt  iei (fsrrmxrooo1ale mo3tatfsDumu p;t0tetrmr3tadla   u il() etmxr3ou1omt  ieta( srurump;u4olxnmf3iytla2ran o;t)trxrmf3oadlaD aieol(  etoxr iu1apt  feslt sDumxmpoo1aeeoiociad m2rm(ms;()aetomo3iytoat  i s s trurirpnodomenlncsat)artaump;o4olx mfetad sDrl( pn(4 rerifcoa1latrluvi s trxoimpno4lmtnmiviatfa2umuroot1tlenio3iaslm elu o t0arxrmocta1fmD luvs t) eto(o iodale  fvsat srtaum ;u0tltn fciys aDel(mpnu4trenmo3iadfaDeluei t texm(m3ny4ll   nctlsfsDumxmo;u0opeomoeiysfmDumums;t0 rermo tytoatrai o t0 rumxo ny1altnliet t  2trxrooo0tltnio3iyslaDumnvpn(0aeeomf3tatomtraneilt0srxrxopnu1am   ict s)aDur(  ou0tex ii3ias m2rluvsn(0tetrxr tatfa elu i;(0srum(o iy4lmeelncils)sDum(root4texo fciyt a2emu snt0aeerxf3oy1omt  nvslt trxmxr oydame livtasf ruru  no4apx  ietydfaDuaums t)arxnio ootom  lu s;( trtr(rpoo1apee fetls  rtrxrono1oetn i3iytfa ranmon(0trerifciadfa  lues t  2xoxr iy1lmtnlfes (f 2raurpoo0oeto ictyd aDrmumo;u0texnxoctodfa ranes;s)trxmir3oo1am emicsat)artrxrpot1tpxo oeildfm elnvs;t) rxoxf iodla  li i;t0truo(mpnodapt  fct t)s2ur(rooo4alt  ictytfs2umnms (4 lxrmfciotomte ieslt) 2xr(mpio1lltemnviltfa2tm(rono4olxo o3iat a rlu on(0texomo ootfmtr neol( t2xo(rpio1lp nmncsl() Drmum ;o4opxoioctas a uanmo;() lxnmf3iotlp r ivils trum(o io1alt licslt srtru oot1texo fcildls elums;u0 rtrxr3iadom  ln s (0t2xmir oy1lmenmnctlt)a2uaxrp;o0tetoio3iaslaDuau snu0 lxoxf3tadlat  neo (0trtoxmpoy4ameelfesatfsDtm(mpno4openmociyt aDrmn pnt)altoxo3ootfp r ues (0t2xo(rpoo4lmeelnesl() Drmu pou0optn i3ildlaDrm( s t0tlxrif iodop   uvs;s srtrir3oy4ol n ivi s)sDumur no4oet ioeiysls2ulump;t) reoir tadlaDeln o;(0 rumxm nu1ome mnesls srurx p;o4tpenmieiys s ranvp;(0 ltnirciotfmt lu o;s t2trimpio4aptelfeslt aDtr(  no4optomf3iysfs2umnvs t4trtrmoctotoa   i olt  2xmxo3iu4lltemivias) Dtaxmp;u0apx ifctldfm2elnvpn()trtrmrctotop e ies t)setmim iy1ap  liet tfa2umum no0alxnmfciaslsDuanmo;(4 rxoxrciodfat anesl( srxr(mpiydaltemici s s2rr(r ;t1tpxn fcias a elnmo t4trxnmr iytom  auesls  rtrxrpnu4oltnmfciasfs2tax  nt4tee mi3iysls2ranmont4aexomo3oodfat anvo;( srurxrpio4ape  fvt s)a2tru  ot4tpxniociltfaDuln snt0artrxo3oo1fpt ai ols) eumxrpno4am n ici s)a2uaum no0apxniietld s2ea(vs;u) exrmr3ty1lptran s s0trtrir io4aptemiviltfsrrmxrp;t0tetomfctydfa2rlu s;u4artoir to1omt luei;s) exrxo3ou4alenlncs (  rurx ooo4ope iociytfsDul( s;u)teenmr iadoaDe neil(0 2umio3oo4om elnei s s2um(  nt4tetoioeiasfmDelnvo;()aexomr3oatlpDeauvilt  ruoxm3iudapeelneils sDtaur ;o1alen fetadlmDrlnmp;(0 lxoircoydfaDeliei s  rtm(o3nu4ame lfei t) 2raum ;u1aex moeiadfaDulnvo;(0arxrif totfpDrluei;()t2toir oydoltemicta( srra( p;t1oltn feiatla emnvs;t4tltrmo oo1oa eanvo s  rtoir3oydalee ici tfarurxrp;u0tpxo fctlt aDrl(mo;t) exnmo tatopDeauei;t) etmim3oy1am nlfcia()arrmxmono1tpeo ietas s2eanmont) lxoxfctodopDrlnvi;t0tetm(opoo1ole lieil(farumu oot4olxomoeiadlmDulu s;u0 lxrxo ia1lmteaieolt) etmir oydom nlfet s  rra(r ;t4oltnmfciyslsDea( o u0artrir oatop   ueo;s) eumxr oo4altemivilt) rtmx oot4aeenif3tls m ul(vp;(0altrmf iytoatrln i;s  2uoim nudll nmnvs t a2rmumpno1tpxnmf3tadlsDrmn p t)trxomr3iadfa e ueo;( trtoxr oo4lptemictltfarrmx ont0oetnmf3tltfs2ulnmp u0aeeoxrctydfaDe uvo;t0trxm(m3iy4optnmnci sf Drm( onu4olxo o3ilt sDrm(vpn(0altnxoctotlpteau i;()t2ur(mpnu1lpeelfet s  Dtmum ;o4tetoioeiad s2umu p;u0teeoxoctatlp elneo (0srxmiopnudopeelneil( s2trur ;o4oet  i3ilsfs2rlump t)alenmf iodlmteanesl(0t2umxm ou1lp n net s)aruaumpoo0apto iciadfaDumu s;u0 eenxocoodfp rauei;(0sexr(opio1am nlivtasfs2rrxmont1opeo ietydfm ulu p t)aetoxo oydfa rln s;s)t2trxo3no4ome mfcilsfs2umxmpno0apeomf3iltla2ul(mp;t) rxrio oytopt  ueo;( sexmirpoo1lp e fctatfa2rrx pnu4aex ioetadls2ulnms;(0teenmr tadopt  uvi (0 2xmxm no1om   fvi ()srrr(mont1tetnmieiydlmDumnvp (0 lxrircoodlmt au ilt t2xmxrpoo4ol elfctat sDrax  ;t4opeo fetld s2uauvo;u0 eerir3tadfaDeauei;t t2to(rpoy1lme lncs t sDrmxrpou0olen fciytfsDemn s;() ltrxfctotop elueols0 2xoxo3iu4apeemnvs () 2uaxrpnt4altnif3ilsfm2ea( ont0 exrmr oa1opD  ivo;(0trxmio oodlptelnesas)srur(rpou4aet iociatlsDul( pn() lxoircoytlat  n i;( teumxr3iodlmt mnesls  ruru ono4ole  oetasfs ul(von()trxoir oatom e uvol( s2xoirpoudale lfciatfsrtmump;o1tpt  o3iadfa ul( o u)alxrif3tadop   nvi (0trxr(r ou4lpe mfvil()srrrurono4aptomf3iatls uaumpnt) lenio oodlmte uei t trtm(r3io1opt  fcs s  rrmumpot1aexnmoeilsls uan o;t0 etrif ty1oatrauvo s trtrxo iu1lmeemictl(farum(mooo0apeomietltfs eanms t)alerio3todop e ivi;s sexrir3ou4ale mivt sfsrrmx ooo4oetnii3ildla2rln pnu0tetoxr oa1lm elueslt0sexmxo3ny1ll n nvi s arrr( poo0opt ifctytfaDemnms t0tlxnmf iydlmD  uvs s truoir3ny1om  mnesa(fsDtaurpno0olenmocilt mDea(vo u0trtoxociadoa elnvo s) 2toim ny1opeelnci s)a2um( ono4oltn fetlsfsDrm(mo;u0alxoxr tatfp eluei;t trtoimpou1apt  ncsa( artaxm ou1open fcilslsDemuvp u)trtrmociytfmt lnvs t)sruoxo oydap nmfctlsfsDraurp;t1oet  oeiydls emump (0altomo oatoatrlnvs t0setriopiy4lm  mieilsfsrtaurpot0alenmoeilsfm2ulumpnu4areoio3oadomtrluvo;s  rtoxo3oodapte nvs t a2ur( pnt4tetoifeilt a uaump;t0texomociytomte i o s)seuo(rpoo4ap   icsas a2ur( pot4apt io3iysfa emnmonu4treoio3iytfp  lu s;s0 rumxr3oo4apeelfeta(f 2rrxm oo4olx ioeiadlmDum(ms ()tlerioctydfaDraueil()trxmim oodame  fet t sDraum nt1tpxo ociat s2uluvonu) ltoif oodlpD  neo;s) euoxm oy1ameemnctasfarur(rp;t4opx iictatla rmump;t) leomfcoadfat  n i s s2trio nudlpeelivt (fsDurxm ;t4aptomoeildfa ean s;(0tlermf oydfp e n o t  exo(r no4ape mfvtas) 2raxrono4oleo ieiytfa ulu s;u)aetnmr iydfmDean o;() exm(o3oudlp  licilsfsrraurp;t0apxnifeias a2ra(mo t4artrmfciatlp r ivs s0t2umirpoy4ole lfes s  rtrur nt0tpt ioeiydlsDea( s;t0 reoxocoadlmtraueol(0 rxm(rpiudalenmnci sf rur(mo;u4altniocilt a rmu on(4arxnir3tydoateauvsls0srurir ny1lmtelies t srtrxront0olx  octasfs2ul( sn(0tlermr3io1oaDrauvi;s)sruoxo oodam n ncslt  2trx pnt1apxniietldfsDumnvsnt4aetnmfciadlat lieol(0s2toio iy4lmt  fvia()aDtr(  ;o4alen fetydlmDranmp u4teeoifcoy1latraivo;()setr(m ou1lptelfcs s arrrxmooo0altnmi3iyslm2uaumsn(4altrmr iytfm  aues t)truo(mpoo1am n fetatf rrm(mp;o4aetoifctat aDumn s;u4 exnircoadlpDrln s;t0s2xr(m3ny4om nmnctasfartmu  no0alx mf3iadfsDraump t4teeoxr todfmD auvolt trto(o3iu1om elici sfsDtr(m no1tleo iciydfa2ulnvo;t4 lxrxr3oydopD auvo;t0s2xoxr3ou4amtnmfvi s) Drr(rono4altoifciydlm rl(ms;u)artomrcoytlaDrlnei;t0t2toxr ou1alenmiesltfaDrr(r nt4opt  oetldlm2rau snu0 lenio oytoaD lu i t0srtmxopiodllte ivias) ruau  ot4aexniociad a rm(mont)tlenxociodlmDelivo (0t2xmxr oodllee ies sfarurx  ;t0aet mo3iyslm2rlumpn(4altnxfcto1lmDelnei (0teumimpoudlleemncs s  Dtaum no0tpxoifeilsfm raumo;t0 rerif3iatop eli ol(0sexm(m oo4lp  miviatfaDum( pou0oexomi3tltfs2uanmonu0 etomrctatlpDeaies t srxoxrpiy1op nmfcsatf 2tm(root1olt micild mDrln p;u)arxnmociodop elues t)srxo(rpiu1alt mfcslt aDumxrpoo0tetomoetlt mDelu s;t)arxnxo todlpteaneo (0 eto(r nodlpt lies s sDraumo;o0oeto ociatfm2um(mpnt0teenxrctydopD lnvolt texoxmpoy4amtelnvia()arur(rpot1aee  o3iytfm raumo;() eenir3iotfmDeluesls srtm(r3nu1aptemict s)arur( ono1opxnmoeiyt a eaump;() eenmr iydopt aieil() rurxmpny4amen ivsat)s2uru p;u1apxnmfciydfs ranvs u0altnir io1oat  iei ( t2xmxo3nydal emivt tfaDtmx ono0tpxo o3iasfs rlnmo;u4arerirctodfaDelnvo;t0trtm(mpoy4llt lieil() rrm(roou0tpe mi3ild a2umump t4alxrirciotfm  aneo t0trxr(o ny1ame mfetat) 2raxr ot1teen ieiyt s ean on(4texrio oatlaD  uvil(0 2xriopio1optnmnet sf rrau onu0ape ioeiyt m ua(vpn(0alenxo3totoat anvs;( s2urio ny4op e fctat a2ua(rpnu4tltn fetlt a2emn snt)teeoircoatlaD ln i () rtoxr ny1omee fcs t  Dtrurono0tet mf3iasfs2ra(mp () etnxrcoytlmt ln s;(0t2xmxrpio4lmt livt sfa2rrx  ;o4opt moetyd a rmnvs t)texoio3oa1lpD aueil(0s2tmxmpiu1lleelnei t  rrrx ont1tex mietatfs el(ms t0 lermo ootlmD li o;t)setr(o3nudom nmfvias)artaurpoo1tet mfeiytlaDum(ms u0altoifcootla  lnei;()t2to(r oy1omtnmnvslt  2trum nt0openiiciltlaDeaumo t)trtrircia1oaDr uvs (0 2xmir oy1llt lncsl() Dtr(mo;u0alto ieilslaDumnmo;t0aeeoir oo1lmDr ueol(0trxo(o3iu4ap  lneia()s2umumo;o4tle  ociltfs2rmuvs;u4 lenioctytom e nesls0sexoxr nodoptelnvt (fartaxmpoo4aeen o3iyd s2raumpn()treoir iodfmDr iei;t0srtm(opoodoleemnvslsf Drmx pot0opx mictld s emuvp t4aexoiocoodlate i slt0trumxm nodlpt  nes tfaDurx pot1tee mo3tyt s ra(ms (4tlxrio3oadfp   ieslt  2tm(mpiu4aptnlfvtasfaruaxm nu0apen i3ild a2uanvpnu4aexomr iadlmDr n i s)sexrxrpiu1lmtelnetlt  2uaum nt4oet  feiyt s2rmn s ()aetrmfcootfatran ol(  rxrxo3ny4am   neilt arrru o;t0teto iciyd sDum(mo;(4 rtnmrcoatopt  n ils0s2xmxr iy1lltelfct ()srrm( pot0aexnmoeiydfs ea(msn(0aetrmrciydoa  li o ()setmxo iodapte ieta( aDtmxm ;o4ale  o3tltls el(mp;u0treomf3to1om rli olt) rxr(rpiu4olt mnesls) Drm(mp;t1oetnioetydls uaums u0tltnxfcoo1lmte n o;(0 ruoxr oy4ame mnvilt)sDrr(ro;t0apeoiiciydls2eanvs (0teeoxr oatlm eau o ()s2xr(o io1lp nlnvtltf rtr(mp;o1tltniocias a ulu p;u) eeoiocty1lm e neol()s2tmio3ou1lpte nviasfartaur nt4oet mf3iad s2rmuvs;u0teermocoo1fpD ai ols) rxo(rpoy4openmfet sfaDta( pot0opeomiciltfm2eanvs u)aetomo3iotopDraneil() rumir nudaptemivsl(  2tmxmo;u1tltn oeiyd s2rl( p u0 lxnxf ootoptranvsls0 2tmimpny4lme  ivs sf Dtrxmooo1olxnioeilt aDea( o u0 rtrio3iatoaDelueil()srumio3iudlmtnmicsatfartru pnu0apxoioctyslaDel(mp;()arxrmo3oa1lpD au ilt0s2xoir3oy4om nmncs ()a2ra(mp;t0aetoifeiasfa2ea(vs t0tetomo ty1faD  u il() rtm(opiu4ol  mnesasfsDur( pno4tlxn iciat aDuanvsnt0trerxf tadfptelivs t  2trxo ny4ap   fvsl()aDrr(mpnu0aptoii3tas m2emnvo;t4teerio iotoa e nvo;t  rtmxrpny1opeelneta(f ruaxmp;t0altnii3tld mDulnvo t)tlxoioctotomDe u ils0t2ur(r3nodapenmneils)s2rm(m oo1oexn ocild s ul(vs;t) renmf to1lmtr ieo ()srtr(r3nodlmt mnvtlsfsrtr(r ou4aex ii3iydfa2rm( onu) etrxocto1lm e u il()t2trxo3ou1lle lfcslt)s2tr(rp;o4opto octatfsDuanmo u0 renif3iy1opte u o;(0s2umxo nu1lmeemfcsl(fsDra(m no0aptomoeiyd sDrmnmo;u4texoio ia1fpt li o;(0 etrio io1ame mneslsfartauro;u1apen ociasla eanmp;u)altnir3iotlpD an o s sexrxopoydamt  ietlt)sDum( p;u0alxn i3tys aDemnvsn(4trtoxfcoydoatr uvslt0trtr(r oo4lme lnvi s  2rr( o;o1oltn f3ild a ulnms u4arxrxr3iatfa   nvi;s teurio oo1oleelneslt  2taurp;o1ape iieiydla2em(mpn() lenir oytfptrlivils0teumxrpno4lmte fcsl(f Durxmpou1optnmfctas mDem( p t)aleomr3tydlatrlneo t t2to(r3iudlmtemfeiasf Drrxr nu4tee mociat mDean ont)tlenxf iadoptean slt)teuoim nu4lmtn fvia(  rumuro;o0aleomfciltla2elu p u4tetrif tadfa r ueol(0 exrxm oy4omenlfet s)srrr(m ;t4apxoio3ild m2uan o t)artnircoo1oa r ivo;t0 rur(o nu4lp  licsatfaDrax oot1tetomictltfa emn pnu) lenxfciadlmDeai sls s2toio oydlm   fvia(fs2uau pno0tpeo feiatlmDemn s () exoxocoydlmtrauei;s) rumirpnudale miciasf rtm(mo;o1aexnmo3iytfm ea(mpnt)arxnxo3iy1fpD ln sl() exrir ou1lmt  ncia(faDraurpoo1aetn fciytfa ulnmp t) leomocoa1fpteli o t)texo(rpnodalenlfci tfsDraurpnu4tlt moctldfa uluvsn(4arenxociy1fmD anvo;(  rumxmpnydol  mncsat srtax pou4oeen fciltfs2ea(vsn(4texrmr3to1lmDrlnei;s0 exmxopno4lpeelnctlt s2urumoou0tltomi3tytla2emu p t4 rtoxr3iodla  lnes ()trxrio3ny1lltn ietat arurx  ou0tetoifetad aDra( o t0alxnio3tydfm r ies;t tetm(o3iydalenlfcs t  2ua(ro;u0tpxnmf3tytfa emumpnu0tleoxo tadom eaivs;s  rtmirpou4llenmfcsat arrax ono4alx mo3tas m2umnms;t4aetoxfcio1fat  i i;s0seuoim iy1ole mfvs () Duaurp;u4tee mo3tysfaDrm( pnt) ltoxo ootom   u s;(0trtoxo3iudamen fct ()aDtm( pnt1apt mo3iatfa umn o;()trenifciadlaD  n s;t) etmxr3oydlpe mietlt  Dtmxront1alxoifeilt a uln s;u4tlxoioctodlmteanvi t0t2um(opnu1ope mfesl(fsDrrurooo4apeoifeilsls2uln p t4trxnxo io1omDrli i;s0tetr(opnu4lmt lneilt  2taxr nu0opx iieiat aDra( p u)alxrxr3oy1oa r ueo;s)trxrimpiudolt mfet () 2rmxroou0aeeo f3tad s2emn s (0tlermfcty1fm  lneils teum(r iydol  liet tfsDraxront1tleo o3iad sDel( o u0trxrmr todom r n ils sexmxr iy4ome lfcs sfsDtaxm ;t0tltomfeiyd sDra(vs () ltrmoctytop   nvol(0teurim3io1optelfei t  ruaxr ou0opx mieiasla2ran p u) eerxf iytfmtelnes;t  rurxo3io1ap nlivtat)a2rax  nt0oeen ietatls rluvs u0teenxo3to1opD lu o s0 2tmim oudlm  livia() rrr(m ;u0oleo o3ildfaDrlu snt) lxrmf io1lpD aueo;t  ruoxopnudopt  fvsls  rtrx  ;o1oetnifciasfm2umums;t0 eenmr oatopDelu sl( t2um(m3iu1lp nmfct t)srtmx pot4olxn i3iyt mDrmnms;u0 eeoxrctadfa e neo s texo(o3iy1lmen fvilt)a2uaumo;t1texoio3ias sDua(mp t) lxomo3tadfmtr u o s teuoim nu1opeemivtl()aDtau  nu1tet iiciad mDrmn ont4 rxomr3iy1oaD  ieo ( sruoxopno1ame mnet s aDumumpou0apx iictls aDean on()artomo todoaD  uvi;t  rurxo no4am nlici s)a2umxrpnt4alx iieiyslaDemn o (0 eenmfctadlp   n s;s s2to(opoy1amtemfcils)a2rax  oo1aeenmietldls2emu o;(4aexomo3iydop e u o;t trtrir nudop nmicils sDtrur oo0oexomfeiysfa2ulnvo;(4tleoif oo1la eluvi s)srtoir iy1altemivilt)s2uaur ;u0tex mi3tld sDemu s;u) eeoxo3iotlp r uvsl(0 2xo(mpiu1om emieiat)s2um(mpno4apto feiatlmDumu on()trenio oo1fm eau i t)t2ur(o3oo1lp emnvia( s2rru  nu1tee mf3ildlmDrmu sn(4arenircoa1oatraiei;( sexoxr3no1alee ict () Dtrxr ;o1aetoiictas sDrm(vo;(4 ltnmf3oa1fpte ivo t)texoxm3oudomeemncta( sruaur ;u1tlxomo3ild s2rlnvs;u)trxnxf3oodlpt anvi;( s2xoimpio4lp  livtls a2rmu p;u1aet  i3iatfs ea(mpnt4aetrmf oy1optr ivo s) rtoxm iy1lm n ieta(  rta(rpnu4tex mfctadlaDel( pnt0tleoio tydoaDr neo;t srtr(m nu1amt  ivi s  2taumpoo1opeo oetls s eanvo u0alxoif3to1lpt luei;(0trtm(r3io1lp nlfcs (fsDtru pnu4opeoif3iatfa emn onu)aeenir iy1lmte nesls)setrxopiy4ope lnes t  Draxmooo1tpxnmieiadfs2umnmon(4 lxoioctodoatrauei s0 eurxm3nu1olenmfvi ()s2trum ot4opxo oeiatla eau onu) exrxo oodomtelu o (0teur(o io1lpt mfcsltf Draurp;o4tee mfcils aDrlums (4aeermfciytomD auvi t)seumxo3nu1lpen feiat)artrxronu4altomo3tlsfmDrlu o;(0altrifcty1oaDeanei;(0 2um(r3iu1lpenmfvi tfsrua(mp;u0oexn fctyt s um(ms u4aeeoxf3ta1fatraueils)seuo(opny4om   nvs ()sDururono0alxomo3iadfa2ua(ms t4tleoir3tydfate nvil(  exoxopiu4ll nmneils  2raxmonu4tex iociltls eanms;t4tetrxrctydomDrli i t truoxmpiydole lietas)aDuax ont4tlx mo3tydlaDelnmo u0 lxnmr3tatfpD lnvils0t2tmxopnodlp   fvtas aDtaur ;u4aetnioctyslm2elu o ()texrxf totfp  auei;t0 2toxopnodame mivia(f Dtmx pot1oee  o3iadfaDelu s u0trtnir iotlateln ols)setm(m3ny1alt livt t  rrmxmono0oltnmicildfsDran onu4 exoxr oatfa ran o ()sexoio no1ap  mfvia(f 2rrumpnu4tpt  oeiad m rmumsnt0aetnxo3oydfpDean s;(0seto(mpiudllt mfet s)artrxmp;o1tltomo3ilsla ra( o;t)aetrmrcootfm  lu i;s  euoxm3no1apee ivsatfaDrmu oot4tpeo fciydfsDelnvp (4trtrmo3todlmD  uvo s tetm(o nu1op  lfvt ()sDur(rp;o4aeen fciat m2ean snt4tleomrcoatfmDr ues t s2toxmpiodopeelneiat aDtau  ;t1aeeoif3tysfa2emnmo;(0 lxrir to1fmt  nesls0s2toiopiu1apenmncias)artaumono1apt ifctadlm2uanmont4 ltomrctodlmt ai o;( seum(m3oodlltn fvtat)a2tru pnu4apeo feiaslm2elnmonu4aetnmo3oo1laDran o t)sruoimpiy1alte fes s)arrrxm oo0oex mietlt sDrl(mo;u0 etoif iotfm r ueolt0 exoimpoo1op elnet sfsDta( pnu4oeen ociltlm2emn o () leoxfciytopte ues t  2xoxo3nu4lpt lnvilt  rtmxmp;o0tpe  oetytfm2uluvs;u)aetoio iodfat lu i (  rxm(r iodamen net ()s2rau  ;u4olxoiictltlmDranmo u0tlxnxf3ootoaD lies;t)trtr(m3ny4ol nmnetasfa2ta(mpnu4olxnmfctlslmDumnvp (4artomocto1lmteaueo t  2tmxr3iy4apt lfvias srtr(  no1alxn i3tasls rln onu0tleoxrcoodoaDeaivslt) euo(opnodap nlfvsl(fs2ua(rp;t4aetnmiciasfm2elu p u0 etoxrciodfpD aueo s s2trim3oo4llt mnct sfs2rm( pnt4aet ifeilt aDumu snt0 rtoxo todop eai o ()setm(m nydalt  nctls)sDrau pnt1openmiciltls umumont0 rtoio oatlp e ivsls)s2tmxopiudlpte fvslt sDtmu pou0teenif3tlsfaDrluvp;(4altrxf3oa1oa eluvi;s s2urimpno1olt mfcil( s2tr( pno1tlto i3iyd m2rmnvpnt0teermrciadfpD aneo s0s2tr(mpou1al elncsl(fa2tm(ro;t1olx if3iadla2ran on(4areomo io1lmt  uei;()sruo(m3oo1amenmnvi s  rrmx pot4oexnii3ilsfs ulumonu)alxnir iotfp  ln o;t0t2xmxo3oydll  lfcs ( a2uaumo;o0apenmo3iydfm rlnmp;t0 rxnxf3iotlptr ivs;(0srto(opnydomtnlnesls) rrr( o;t1tpxo o3ildls2emn s t0 rermr oy1lmDe nes t)srxmxm iodape mfvia()a2tmu p;t4texn iciltls2ean snt4texnxr oodomDrauvslt0 exm(rpny4alenlfeils) Duaxmpot4apen icild s ua(vo u0aexrmrciy1fp r ivs;(0teuo(r3nydom  mnvs tf rtmu p;t4alxomoctatfaDumnvs;(4trtoif iydom   u i (0 2toxo iy4am  lnetat)aDtrxrpno0apxnmfeiydlm ranvp (4alxoxf3totopDrlivo s t2urxr iy4lp emneilt) rurxm ;u4ole ifctyslaDrl(vonu)altomrciatfaD  uvi;s)s2urxm3oudlle  fvtl(faDtm(rooo0aexo oetytlaDulump t0 lxrioctydfa rlu s t0srxrirpiydale lnvsat)arrr( pot4opt mfetyslsDel(mp;(4aexoxo3tatfaDeliei;t0srxrxopny1lltnlfetat a2urumpot1apxoiictasfs rm(ms u)artnif todoa rlueo;t)trxm(o3io1llt mivsat) rtrx pno4ape ifeild mDrau p;u4 lenio3oy1fptelues;t)texoxm3oo4ale  ictl(faDrr(rooo1ole iieiytfa2umumsnu0 rxrifciytopDr uvo;( srurxr ou1amenmivtas)a2rrumpnt1opto f3ilt a ul( snt0 reoxf3totopt luvo;s)srum(m3io4ameeliesas sDta(  oo1alxo ociadfm emu o;t0arxrmoctytfmtelieo;t0trxrimpou1ole lnvsat) 2rm(m ;t0ole mfeiatla2em(vo () etnif3todop   nvo s t2umxo3oodam nmncs t  2tru  ou0aetoioetyslmDuau p u0tlxomf3to1fpD luvslt0 2um(m3ou1lp e ictlt)a2ur(mp;t0tle mociltfm rlu o;(0treoxrcoydlat  neol(0s2tmxmpno1lltelncias) Duaxro;t0aeen iciytlsDum(vpnt4tltrif iodlpt aivsl()t2trxmpny1omtnmfvtat)sDtru onu4apt iietas m2ea( s;() etoifciodlmDrauvs;t) 2xr(opoudlmtn ietl(fs2rmur ;o4aetnmo3iadfsDemu p;()arxoif3tytfmteaueols0 2tm(opou4lltelfvia( s2ururp;t1tpe mieiyt a ra(mon(4tlenmocoy1fa r nvo s0 euo(m no1alte nei s) rtrurpot4oeeoii3tatls2ea(mpnu0trxnmo tatfpD lnvs ( setoio iu1ol e ncs tf rtrxmp;o4apto fciatla2rlnvp;u0teeoir iadfmtrauei () 2xrxr nu1am nlietl( aDuaurp;o0tlt ifctldfs eanmp;u0tetnifctadfpDe ivo t s2xrxo3iu4omee feta( sDrrxm ;u4oltnmf3iatls eanmo () renxo3iytfmD aies;s)s2xrirpnydlle liet s)s2rm( oou4tpxoiietytlsDranvo;t)tlenmr3tadlp e u s;()s2tm(o3nu4olteliesls  2ra(rpoo1ape  ieiatlm elumo u4areomr ty1fp eaueols)s2trimpiu1ameemnetl(fsDtmu  ot1apxo f3iadfm rl( s;t)altrxo oatoaD ln s t  exm(mpny4lleemnvt t a2uaumono0alxo oeildlm elumo ()arerir oy1fa rlivsls  etoir oo1om elfctl( srumx ont1aleoifeildla rln s u0tlxnio3totlp e ivo s texm(opio4lltemivtlsfs2tmur nt4opxo fciyt sDem( s t4trxomfcty1lm  lnes s) 2tmirpiudapee nvtas)aDumxr nu4aeen f3tydlmDelnmpn(0tetnir iotomteliesl()trxoxo3oo4lltelnvsa(farrrxmp;t1olx iictas a rl(mo;(0aetomrcoo1la  lnei s) 2urxm3iodole mfcsasf 2tm(mo;u4opxnii3tad aDrlnmonu)trtrxo totfmDrlieo;t0srxrim3iy4lltn nciltfsrtr( o;o4apxnmf3iadlm2rlnms u0arxnir iatom raueolt0 rtmxr nu1lm  mnvias)sDrmurp;o1oex mi3tltla rmuvp;u4aexrxo3tydfmteaues t)srurxo3no1optelnctas) Drmu o;u0tltoioeiytls2uan ont0texnxf oo1lpD aneol(0s2trxr iy4llt  fcil(fa2ra(m oo4tptn ocils mDemn o;(4tleomrctatfpD  i i;t0t2ur(opnodaptnlfetas srrru  ;t1tpxo i3ias a emnmsnu4alxrmo3ootlm e nesl()trtm(r ny4lme  fcs ( artaurp;u0apxn fciadlm2el( s;t0arxnxf oy1la rauvi (0srxrxr nudol n nvs sfaDtrx ont4opx iietat mDrl( on(4 lxnifciytoat  i s s)teto(o3iu1oleemiesl(f rrmx p;o1opxo oeiadls umuvo t4aeeomocoy1fmD  i sl(0tetrim no1lp nmicil( arumur ;t4tee ioetytlmDra(mo;()altoxr3oydomtelivslt0s2urir io4olte fvtlt) 2uaurp;t0aet mocils mDel(vpn(0tlerio3iy1lm  li o;t0trxrxr3nu4amt lfesas  2urxmpot4oleoioctld s2um(mp;u4treniocty1la elnei s0sruoiopiy1altn nvsas)s2uru  ou1optnmo3iyd aDra(monu)texnifciotfmDrlieils0srtr(m ou4ol   nvsat  rta(  oo0aeeo o3tydla2rl(msnu0 eeomrcoo1fmD auvs t0s2xrxm nu4al  mfvsat)sDtru ont1aex  iciydls2uln snt)trtrmf3iodlaDr uvolt trum(o nodopt  fvslt aDrrxmp;t1tex  f3iaslm2umnms u4areomo oytlmtelu ilt0 2xoim3oodap  lfvsas  Dra(  nu0aet  ietlsfm rmnvp t4alenir3iadfm r ivs;()trum(o3oy1om nmfet (faDua( onu1aee  o3ildfmDranms (4alxrmf3iodfptelnvslt0s2tmir iu1lmtemnvi tfs2tmxmo;u4ope mociltlm rauvont)treoxf3tatlm r nvo s)teur(r3oydop  micsa(farum(  ;u4tpxnmietltfaDrlnmpnt0teerxf to1opDe u o (0t2urxmpoudll  lnes s)srtaxmp;u0tltoifciasfsDemumo;t0trenxoctydomtrauvs;s)srurim3oy1aptemivils srurur ou4tpt ioetys s2uanvsn(4aeenxf tytfp e nes s0 rurio3ou1ape lies sf 2umur nu4oeeoio3tyt aDem(mo;t0aetnmr3to1oate ivs t0 etm(m oo1lp   fctlt arta(mp;u4olxo ictytfa2uanmo;() exoxf ia1fmt lueilt  2uoxr iu4opeelnvsat)s2trxr no4olen i3iysfs ra(vp (0 eeoifctytlat ln sls0trxmxopiudlle mfet sf 2umurooo0alxoiiciyt aDel( o (4altnmo to1fmt  nvi s0 exrxo oy4ole livtat)srrr(ro;t1optn f3tat a ua( s;u) exrmf3iodfpDeaivs;t)teurxm3oydol  lfcs s)s2ur(mo;o1tltn oetysfsDea(vont4aetniocoy1oat au i ()s2xoxr no1ap   ncil(  Drrxmo;u0aptnmo3tld aDea(mp;u) rxnmf tydlate n i;(0t2urir3nudlm   fvs (f rumur nu4tleo ieiltfs rmnmsnt4tltniocta1op elnvs;( s2urxr ny4al nlictatfaDua(  no0opxnmfetyt aDulumo u0 etrmo3ty1fmtelueo s)srurxrpnodamtn ieiltfarumx p;u0oleoifeiadfm ra( p;()tetnif iy1lpteluvsls texrxopio4om   fesas) ruau ooo0aex miciyslm rauvo (0altnxfciodopDeaivols0srxmimpnudam emicsatf ruaumpno0tetnmfeiysla2rm(vo t4texrxo oy1op  lnesls t2toxr3ny4op n nci (f 2umx oot4aetnii3iadlsDemnvo;t4 eeoiociatopt  nvo;(0t2uo(opoydlp   fci sfaDtmurooo0aetomfeiltfa ua(mpnt0 ltrxoctatlpD lnvo;(0 eumxrpiudomt mnesa()srrrxmpou1tlxniiciatfm rmumpn(0teeoxo oytfaDeau sls)sexoio iydamee fcta( s2rrxmo;u1aleoif3tld a rl(vpnu)trxnxr3ia1fmtrlu sls  2toimpiu1amt lneil()a2raxmo;u0oetnmi3ilt m ea(monu0aeeoio oy1fpDeln i;t  rtoio3iy1omtnmnesa()srtrxrp;o0tpx iieias a2rm(mpnt)trxnmociytfpDr u i ()srxmimpnu4lmtnlfvias arrrxrono0tptnmiciatla2ul(vsnt) exnirciodlp rln o;t0 rtm(r nudap e ivilt s2trx  oo4tpxoiieiadlaDrl(vsn(4 eenifcio1fmD an o;s trur(opiy4lmtn ivtas)sDrrump;t1opeoiociadfmDea( s;u)texrmoctotfpD  uesl()trxoxm3oo4ll emiesls  rtm(r nt0texoiiciyt sDuanms;t4 rermo3ootlate u i s0seuoim iu4lm emfcil() Dtmx pou4tltnmf3tydfs rl(vp;u4aetnmrctytoa r u s t)s2toxr3iu4am emnctat srtaxmono4ope ifctyslmDrm(vp;u0aeeoxo3iodomteli il()teuoimpnudlmt  fesat)a2tmu  ot0tee mociydls2um(mpnt4treoircta1lmt anes;()srxmxo iu4lmeemneiat  ruaxr oo0tetnio3tadfm ulu p;() rxnmo3iadom r i o (  2trxr ny1omee iei ( a2umu  ou1olxo oeiasls2rauvs u0teenxf iotfptrlu s ( s2xm(o ou1lme  fviat)s2uau  ot0tlxnifeiydlmDrm(ms;(0aeenioctatomte ivslt setmxr3oo4lpte feil()a2rrxrooo4oleomoctat s2umnvpnt0alxnxo3iy1oatrauvilt) rxrxr iu4lpeelnvt (faDraumo;t4tee  i3iytla2rauvp;u4trxnmocootoaD  nvo;s  rtmxrpnodomt liesas arumu p;u4oexn fciltfmDem( ont4tetnmr3totfmDeaieo t0t2urxm3iu1amtemfvilt srta( p;u0opt mfetadlm umnvont)altnxocoo1laD  u s (0srxrio3iudlptn iviltfaDum(moou0oexn feiasfm2emn pnt0 renxo iydfa raueo;s srxm(rpnodalte nci ()aruru o;u1apt mo3iysls ua( o (0arenio3todoaDe ies t sexmxopnu4opte icsas)a2raump;t0tetniicilslsDrmnvs;u4altrmo tytoaDeanei ()s2tmir oo1ale mfct ()s2raum ou0oleniictat sDulumpnu4artomr3oatoaD  nvolt0 2toir ny1lpenlivt tfsruaurpno0olx moctls a2elnvpn()tleoxr3oydoa raivo s0 rurxopoo4lmtemicil(fsDtau oou4tleniiciyt aDumuvp (0 rtnxociy1faDeliei;t0 2xoxm3iydll n nci tfsrum(moou1aptomictlsfmDeluvo;(4tlxoxrctatomD lieolt0 2umxm iy1aleemneiltf rrmxmono0oetn fciad m2rlnvp t0trerirctytomtelivs;s t2tr(r3iydlmee fcsa( s2tm(r nt0tpxnioetadfa2ea( o u)texrmfcoodfp   i s (0 2xrir oo1am elnctltfs2taum ;t1ope  feiysfmDrm( pnu4trermo tytfmDrlu slt)s2to(r3io1lm emnetls) 2tr(  ot4olt  oetlt mDrauvp t4 rxomoctydop  an il(0 ruo(r iu1alt lnctatfartr(moou0tptomi3iatlmDumn o;t4 rerirciytfa e u i s)sruoxr nu4ome lietlt s2rmx  no0oet mietltfm2rmnmp;t4 etrir tatfa rlneils srxoio iodalt mictl(fs2rr(r oo0aee  octys a2eanvont)alxnxrcia1fpte n ils)trxrio3no4ll nlfci () 2tmxront4teenifeiytlm2umnmo;t) exomr totfa e nvi;( sexoirpnu4lpt licta(  Duaxm oo0teto ociys a2el(mpnt4 ltomrcty1laDraieols0 2umxm iydal  lncia(fs2urx ooo0tltnioctatfmDuan p;u) etoxociatomDe i olt) 2trxm3ny1apt  nvi t a2trxmooo4tpenmfciysfsDelnmp t4aexoxr iydlpDraueo;s)srtm(o oo1olenlieia() Drm(mpou0olto icildlm2rlu s;u4aexrmfcootoaDr n i s) 2xmxopoy4lltn icia(  Dur(mpnt0tex ii3tysfs raumo;u4 etoif ty1op  luesls setrxmpnu1openlfeilt  Dum( poo1apto feiasfsDrmu o () lxoifciydomteai ilt)sruoir3ou1ape livt t a2urur no4oltnio3iysfaDul(vo t0tetomo oytom  anesls srtmxm3io1aleeliet t)aDumx onu1apt  oeiysfm2rlu o u)tetomo3iatfmD lnvi s) 2uoir oy1olt  ivt t)s2trumoou1oeeomfeiydfmDrmnmp t) rtrxf io1fpDe n slt t2xriopoodap elnviat  rraxr nu1tetoif3ilt mDeln pn(0 ltoif3tatlm   ueo;(0 eur(o oudome mnes s)artmumonu4tlto oetys s2em(mo;t0treomo iodfa e ieolt)tetmxo3nydalt  ivils) 2rrumont1opto octytfa2uau s;u)treoif3iodoat  neo;t  exrxm3nudaltnlnvsasfa2rrxm nu0aetn i3iatlmDrmn p;u4treomocta1lpDe ieo s0srur(opio1ap n fctls sDumxr no0tpt mo3iltls2umump;u) rtriociydla rlivols)sruoio3io4ame  ivtat)a2um(ro;u0aeeo ieiydfs2umn o;(4teermr oo1fa e ueil(0setoxmpio4ol emict t)srua(r nt0ale if3ildlsDulumo;u0areoif3tatoa r nvs;t0trum(rpio1apenlnes t aDrrxr ;u0olx  ociydla ranmon()tleoxr3iydopte i i (0t2toio iodoltn fctat)srum(moot0aptomiciydla2rmuvs;u) etoir3iytfmD lnvi;t  2tm(mpoo4lp  mnei s sDtr( o;o1apen f3tlsfa2rln o u)aexnxr3ia1omDe ivi (0s2tr(m3nudlptnlfcsa( sDrmuro;u0tet io3iyt s rluvp;t)artrmf oo1lateluvo ( teumxo3io4olenmncil(fsDurxmpot4apx  o3tlt m eauvpnu)tltoir3io1oate u i t0 rtmxmpno1oleemietlsfaDrmxm ;t1altomo3iatfaDrm( p ()tltrxf iodlpD livil() etoio oy1lpe micsasfs2umxrpno4tpeoiocildfsDeanvp;t4trxnxf tytomDelneo;s) rxoxm3nudal nlnvsasfa2uru p;t4olen iciys mDrlnmp (4tltrifctatfm eaneo s s2xrxrpoydamtemnct t) Drrx  no0altnmoctat sDem(mp t4tetrmfciy1op  anvs s0t2xoim3ny4lpte netas sDraxrpou0tpxoiieiasfaDea(vs;u0 lxoio3ta1lp   nesls) 2urxmpoo4amt lfeiltf Durx pnu4tlenmfctltlm emnvo;t) etoif3ia1op e i o s tetmxr nu4ameemfes s)arururonu4tltnmoctlt mDem(mp u4tlerxociytlpD lu i t0t2urim nudam elfeils)artmxm ot0ale io3ilsls ulnmp t4tltoirctadlmtelueolt  ruoxmpiodlpt mfvtas)s2tru pno1tpxnif3tasfa umn snu4 reoxf3ia1lat lu s (0 euoxr3ou4om emfesltf rua(rpno0aexn o3tydlm2ulnvonu)aetrmociotopD  nes;(0 rxmxo3oy4olt mies t s2ua(ro;u0altomi3tytla2rlump;t) exoxr3ty1oat ln o t0 2uo(r3iu4ap n fcil(fa2rrur ou1oet mictydfm uauvpnt0arenio iotfm rlu s;s)t2um(r3oy4ll n ieia( arrauront0tltn octyslm rmnvont0treoxr3ootopD  u s;t) exoxmpno4amte fet (  rtm( oou1tetn i3tad sDeanvo (4 lerifcoytfatrli o ( setmio nodaltnlfes ()srtrumoou4tetomf3ilt aDum( ont4tetnif tydomt  i i;t sruoir3ny1ap e ivi t) Dtru o;u4tpt  octldlsDua(vsn(4 exnxrcia1lm r ivs;t)t2xr(r3no1al nmietas  2rmxrpno0tlenif3tat sDranmp;u0aetrxfciatlmtranvol( s2urxm3oo4ome  fciasfa2tm(rp;t0tpen i3iysls ulu snt)arxniocoodop   i o s0 eurim3oo4ape  neils)a2ua(m nt0tlxomiciatla2rau s u)arxniociytfpDeln ols0s2trxrpou4alte fei (fsrtrxrpou4oltoiictyt m rmn o;t0 lxoifciotoatrlneo;(  2uoxm3nydale mivia( srtmxmpou1oex  feiytls2umuvpn(0tetnmfciatomteaies (  rtmxm ou4amt  fcias arumur no1tlxn ocilsfsDra(vp;u4tlxomr3iadfa r ivsl(  euoim no4lltnlieias aDua(rpoo1tle ii3iasfa emuvsnu) reoirciytfpD li i (0 etoim nu4am  micilt  Dum(r ;o0tlx mf3iadfs2umuvp t4tltnio3iy1om   u i ()srurirpnydalee ietl(  ruaxm nu0oee mfeiatla emu pnt0 rtoxo3iodopte n ils)s2tm(m no1opt  ncia(f 2umumpno4tptn feilsls uluvs;u0 lenif3oa1fp  lieolt  etmxopnydoleelfei s sDum(mo;o0aptomo3iysls eln s;(0 lenmfctytfm elnei (0trxoxmpnodoltemfetatf rrrxmp;o0opxomicilt s2elnvsn(4 lenir oadlaDe u il()tetoxrpoy4olenmici tfaDtr( pot4aetn fetytfa2elums t0 rtomf oodomDr n o;s  rxoir ny4op emfvsat sDtrxmp;o4apenmieiaslmDua(von(0 etrircty1omDrlnes s  exoir no1ope mivsas  rur( pot4ole mfctld m ul(mp ()arxrio iytom r uvi (0t2ur(o3no4alenmfcil(faDtr(mpno4oeeo ociatlaDul(mp;t0 rxnifctytlmtraueo s sexmxr3nudomtnlfcsat s2rmu onu1opx  ictlsla elumont0 reoif3oadlat  i ol( srtmio iu4ape  iei s)sDrm(r nu1opt io3tlslm eanmsnt4 rtnif3iotlmD  u o;t)trxmio ny1altnlfvtl()s2rr(roou1aex mocildfa raumo u4 exnmf3oy1lmD lneils0teurxopiu1olt lnvsl(fa2raumpoo0open i3iasfs2el( s (0 exrxf iadlptrlneo;s0seuoxo oo1al emics s)srraxr ot1oltomicildfsDeanvpn(4 lxoir to1oat lnvo t0t2uoir3iu1olte ivi s  2rmx  oo1oet mfetytfmDranvo;()alenxr3totom r iei s  2toxopnydop elfvi s)a2rmxm no4teto fciytlsDrmu o;t4 exnxocoydlp e u o;(0truoio nudllt lnes () Drr( pnu4aetoiieiatlm2rmump;t4teerircoy1op r ies;s srurxo3ny4amenmiet ()s2urur oo0tlxoioetlsfm2rau on(4tltnirciy1oatr ueo;(0texoxr iodape  ivs sfs2umurp;o1teeniieild aDulnms;u0trtoxr ty1fa r uvsls0texm(mpoydaltn neiat) 2um(rpnu0alx ii3tltlaDrlu on(4 rtnxf3oytfaDr nvs;s0srxoimpno4alt lnvs (  2ta(  ;t1alen fcild aDulnmo;t4 rxoircoytfa eaivslt)sruo(o3ou4oltemfvs t a2rm(m no4oltniociatlm el( on(0arxrmociytoa  luei t tetm(opnu1op  mnesl( artmxmo;t4oltniieilsfsDuan snu4 lenio ta1fm  lues;t trxrio io4ole  nctlsfaDurxmpno0alxnif3iadls2umnmon(0 rtrif3oadfptrau i s t2trxm no1lp e nvslt sDrmum nt4alx  oeilsla rln on(4texnifctadfmt auei;s trxrir3oy4omenlivs t) rtr(r ;o1apeomoetydla2rm(vsnt0tleomfciytlpt auvsls sexrxr oy1al elivi s)s2rr(  nt4aex  o3iasfa2elnvo;u)alxrxfcty1lmD lnesl()t2xmxm oy1ap n ivsl(  2um(rpnu0texnifeiltla ua(vo u4teermrcta1omD lnvo;(0s2xr(rpoy1openlnvsatfs2tmumoou1opx  oetysfsDumn s u0alxoxo3ty1omD lneo ( trtr(m3iy1opte fvtas  Dumx  no4oetomoeilt a um(ms;u4aetnxo3oa1fp   ivi s) exoxmpou1lp   ietlt) rrmxmp;o4aexo fctys s2ul(msnu)treoir iy1om   ieo;( truoir3iu1om e fetl( a2um(mp;t4tlx  ietld a2elnmp t4trxomf3oo1lmtr nes s0srtmir3nu4amtn nvt (fs2rrxr ou1aetomf3iyt s umuvo;t) lxrmfcia1optran o ( tetoxrpnudalen fvi s)arurx pou4olenmi3ild m2rl( pnt) rxnmr3tydfmte u i;s sexrxmpnudom nlfet t)aDtr(r ;u4olxomfetydfaDulnmsnu)texrxo3ootfmteln i;(  rum(r nydomenmnctl() 2trum ;o0alx  icildlm2umuvpnt) reoirctotfaDr ieilt)seuoxo3iy1lme lnvta(f rrrx pnu0olenifeias mDemu o;(0 eenxfcootfp  lu i;t)seuoxr3iy1ap n fvtl(  Dta(  nu0tlenifctytls elnmsnt4alxnmfcio1late neo;(  2ur(r oy4omt lnvt ()a2uax oou0alto f3tltfsDelu pn()trxoio tydla r nvi;t)texmxo iy1om e nvil()a2tr(rpno4ole  f3tldfsDemums u0 etrir3tadfmD aieol()trtrir3nodlptelncia(f 2ua(r ;t4tltnif3iltfm2um(vo (0aeerio oatfpDraues s0trurim3oy4lptn ies t)artau pno4opxo feiadfa2uanvs t) eenxf3oydfmtrlies;s) etmimpnu1oleemncias s2tm( pot0teto i3iydfmDeluvon(4 rtrxf oa1faD aivo;t)seuoxm iy1lme mivils  2rm( poo4opt ifetysfsDul(vo t) reoxf3ta1oaDrauvols)t2xoxm3nydlpe  ivils srrmurp;o0aetomieiasfs2rm(vsnu)trtnio3oodlpD livols  rtoxo3iy4opeelnct ()s2um(m ;o0aetnmf3iydfsDem( s (0trtnifciy1oaDrlivol(  rumir3ou4lpeemiei t)arrm(m ot0alt mfeiadfmDelu o t4 etrxrctadoaDranes;(0 rtriopoy4lp  lictas) 2rmu o;u0aet ifciyslaDemn pn(4alermf tydoaDelnvo s)s2xrio nydom emfvs s arum(m ;o4aetn feilt aDranmon() lxnmoctytfmteaneolt0trurir oy4ll elieslt)aDtr(r ;o0olenmfeiltlaDuanmont)alenio3iydlp r ivslt trtm(o3oodale lfvt ( aDuau oou4tle iieildlaDran s;t)tetnxocoa1lpD  n ils srxm(o ny4llenlicta(  rua(rpno0tpto ieiytfa2rlu s;u) rtomo3iotfptr nvs t) 2tr(r3oodam elfcsat  Dtm( oou1aetoifeildfs rauvo ()trxrio oydopD  n o ()trxr(m iy1openlnvi s)arrm(rpno1aptomfetatlsDeaumpnt4aeerxr3to1oa e ues (0 2xrxo3io1optemfcils) 2rm(rono0tlto o3tasfs2el(ms;()tetoxr io1oaD lneilt0srtr(r3no1omeemnetat aDrruroou4tptn fctyt sDraump () etoifcoytfaDeaieils s2tmxmpou1lmtemfes () 2umurpno1tlto ociyt sDel( o;t) lxrmr oadop r u i (0 exmxr3io1olt livtat)sruaxmpnu1ope moctytla2em(vs;()trxnxr3iodoat lu i;t  rxoxm3io1lltnlnvi s aDra(mo;t4oet ifeiytla2em(vont)trxoif iydfpt  nei;t)trxo(o3oodome  nci s aDrr(moou0aex ii3iltfs eanvp (0altrmo oo1op  auvsls0s2xoirpnu1altnmfvtlt a2ur( ooo1oexoiieiyt s ran onu4altnmoctadlmDraueo;t srtrim no1ll emnciatfaDtaurp;u4olt iietltla elnmpn(4 rxnxf3io1fm   iesl( s2xmir3iy4lpt lfctatfs2taxr ;t1apt if3ildfs2ean s;u)trtomo3tatlpte nes;t0 2xrio oudop  mnetl() ruax poo0aleomoetydfs2rm(vo ()alerxr3ootlpDeluvs;s)s2xr(rpoo4olt mnvs tfarta(r nt0olxo oeiltfm uanvp (0 rtnxo3oydfp rau o s texr(o3oudamteliesas a2raxm oo4oexo i3iydfm umnvpnt)texoxociadomDeli s;t0 2xmio no4optnmfei t  2rauroot0tpx iiciys m eluvsn(0tlenio iytfp r ieilt  2xr(r nudamt mici tfarur( oou0aetn oeiadfm2umu onu)alxriociy1fa  lies t0 rtr(r ou4op  liei s  rtm(monu4olxomieiadls rmumo t4 lenmrciydopte uvo;t  ruoir iu1lme mfvils) rra( o;u4optoiicias sDelums;()alxoxociotfaDrlivo;( t2toir io4omte nvsl(f 2ra(  no0tltoii3iatlmDeauvo u0 ltoxo3iadfp elnvs s0s2xm(mpoudlm elfct t a2ururo;u4aet  octlt a eaump (4tetnxf ia1omDelnvilt)srxo(r io1ap elivsa( arrm(mpnt1apx mfciltfs2um( pnu)altnmr oodomt  ueo t0trumim ny4olte iet t) Dtaxm ;o4alx  ocils sDum( o u)trxomrcoodfmt  u sl( t2trxopoydomeemfeias arur(r ou0olxn i3iytls2ulu p;t4 rxnxr3tadopDrlieol(  2uoir3iy1lmen neiat sDrmumpoo1tpx ioeiat m em( snt4 eermf oodlate ivs (  2um(o nu4oltnlfvtatfs2rmu p;t0aetn f3tysfs2rmuvo;t) ltrio3oadfaDr n i t)t2xoio iodome mfviat)arurxm ou1tltnifeiyd s ranvsnu4 rtrxo3ia1la  aivs;()trxoio no1am  mncslsfaDrmxm nu0oex mieilslm rmuvo t4 rtnmrctodlmtrauei () rurir iu1omeelfeslt aDururo;o0optnmiciadfaDuanvp;u0 eermr3totfmtrln slt)s2triopoudope lfetl( sDtmu o;u1tlt if3iasla2eanmo;t4trenio oodfmD  iei ( trumio oy1lmenmfvt s arua( p;u1oexomieildlsDul( s;u)arxoxoctotlp eaneo s0 rxmiopnodlmtelivs tfsDrrumpoo1olxomf3ilt m ea( o;(4trtrif ty1faD  u slt) rxo(opio1amenmietls  Drau o;t0apxnmi3tat s2elnms;()tleomo3ia1fmDraieol() exr(m3iy4omt lfeias s2tm(mp;t1aeeo oeild sDrlnvp;t)trtoxf oy1fptrai o;( trtoirpio1ome mfeta( a2raur ou1apxn ieiad a2el(vp;()artrxo ia1omDrlieo;t)truo(r iu4ope  nvils)aDtrx ono4oetn fetat mDumnvp;u)alxomo iodoate nvi t) exmxo ou1ameemfvias)s2rrumont4olenmfciytlaDuanmo;t4aleoxfciodoa  lies ()srtoxm3iy1lmen ivias a2uaxm ;o0tpx io3tls sDul(vo;t4trenmf iydop eaivo;t0tetoiopno4lltemfeta( sDrr(rooo4alxo icildls uauvs t4 ltrmo3ta1fmtelnvils0 2trim nudoptelict (  rtr(  oo0oeto fctatfs emnvs t4tltrmfciydopt  n sls0trurim io4ap   ivt t  rtrx ono1tpxo o3iyslmDemnmpn(0aexoxf tatlmDe iei t) exmim3nu4llenmies t) rrmu  ;t4tpe ifetydlm emnvo ()trerxfciytlmDeaivol()trxoxopoy4lm   nvil(  2ra(m nu1oltnioetytlmDrlnmo (0 lxoifciatlaD aivo t0srtmxmpoo1ope  nesat a2taxr ou1tee mf3iyt sDum( s t)tlxnxf3iotlatrluvs s0 2xoxrpnodlleemnctl(faDtax  ;u4opx ifetytla2elumo (4trerxrciydopDrlieol( trurio3ou1amenmnvtl(  rrr( pot1teeoif3tltla2eauvpnu0altoio iatomD  nesl()s2uo(m3oo4olenmfci t srtmxmpoo4tpxniociltfaDea( p t4aetriociy1laDr neilt)setoimpoo1lme  ictltfaDurx ont1aetnmfetldfa2ulnvo;()artoxf3ty1omDrlivilt0truoir3iy1lleemnctl() 2urxmoot0apt  f3tyt sDuau p (4texrif totfat  ivol(  2xmxopoydol  lneslsfarraxmo;u1olto f3taslm rmu p (0alxrxr3ty1faDr iei;(0truoxrpnu4opee nvil() rrmu  nt0tlxnmi3ilslm ulu sn(4 lxnifciatlp e u ol() rtoirpnodlltn nvt t)s2ur(m ou0olenifeilt a2ua( snu0aexriocoy1latr ivs;s0 2xmiopnu4op emieiltfs2rm( ooo1tlx  octysfa emnvo;t) rtrir oodoa r nei ( srxm(m3oo1ol e fviltfs2rr(r ot0oeeomf3iatfa umn snt4 etrxr iodla r uei;s0 2toirpno1llt mfetas) rraxmono4apeomo3iadla2emnvont0tltoxrctydfp rliesls0t2xr(m nydalenliesat arum
\ No newline at end of file
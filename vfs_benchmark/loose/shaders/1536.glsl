@@ -0,0 +1 @@
+neols0t2xr(o3nu1omenmncs s aDuru o;o0texoii3iysfa2emnmp;t0aleoxo oydfat  iei ( s2uoio iodomt liet sfa2rr( pot1alxnmoeild sDea( onu4 etrxr ootlatrlu i;s)s2xm(m iy4am n nctat) Drr(mpnt4olen ociyd sDea(vsnu)alxnxo3oy1fatrlu o;( teurim iodom   fci (  Dta(mp;t1opeoiieilslm ulnmo u)altrxr iotlat an i t0 eurio3no1lltnlicsl()arum(r no0apto ociytfmDua( pnu4alxoio ia1fpDelueol( seuoiopio4apenmivt tfa2taxmont1tptnmocilsfa ua(mp;t4 ltnmrctotomtr ues t0 2xoio3oudapeelfcsa(f rrr(  oo1alt if3tasfsDem( s;t)aleomo iotfmD  nvo;t0t2tmxrpou1lme mfvilsfarrm(  nu1oexoio3tltfm2ean s t4tltnir tadfpteauei (0 euoxr nudameeliei tfsDraxmpno1tlen ieildls eau p ()aetrmocoydfa  aueo;t0 rumxo3ny1am nmfesatfa2rmxr oo1altn i3iltlsDrmn snu0arenxfcty1fa  lies;t sexmxo oydlpe licil() 2tmx ooo1apeoifeias a rmnmsn()aexrir iytfptr uvslt0 rxmir3ny1olenlfctls s2rrumont1tlenmo3iadfs rm(ms u4alenxr3iadomteaivilt0 etr(o io4lm elncsl( srra(r nt0tpe  i3iydfm2emump (4tlxomr oatlpteli o t)srtrxo ny1llt lnvt t a2ururoou0tpeo ictltfs2ul( o;() exnmo totlpDe neols)trxoxo3ou4olt  ieils aDtrx pnt1tpto octydfs ra(ms;u4 leoxocta1lm rlneils  rtmxr iydlpenmiei t)sDtm(mpoo1alxo i3ils a2rlnms;u4arxrir3oatfpt lnvs (  exr(m3ou1am emnetls) rtm(rp;u1tlxoiieiad m rmump;t0trxrxo ia1fmt li ils)t2tm(m oudlpen ics ()sDrauro;t4alenii3iyd a2ranvp u) lxrmr3oa1op e u o;()seur(mpnydom  mneslsfsDum(mpnu0ape io3iyt a rlu snt0 ltoxfcoo1lmD  neilt)seur(o3iy1ll nmictat arurxrpoo4alxn ieiadfm2emnvo;()arxoio to1opteaueilt) rtmxm3oy4al e fvslt  rtau pno1aet mfeiad sDumnmpnt)trxnmfctytoa r nvo;s srurir nudlp nlnetl( s2urx  ;o4ale ii3iaslaDul(vsnt0alxoifciatfp elnei;t) rxmxopou4lptemics t)aDur( ont4aptnmo3ias m2umuvo;t)tetnxrctytlpD  u o;() 2tr(o3iy4amtnlivil(f Drrxmono1opt  i3tadfaDua(mpnu0alxomf3ta1lp ean i t)trxrxo3oo4lleelfvtlt  Dra(rp;u1tpe iietys a eau p;t0treoio oa1lp   nei;t s2xoxmpnudol n feilt)srrrx  ou4oetoiociasla rau pnt) lxrxfciydlptelnvo;s0setrim3no1opt lfci (fartrxrp;t1oltomo3tad aDem( s;(0 rtoifcto1lmt  neo;(  rtoxrpno4ame  fci tfa2rr(  nt4oetniiciltla emn snt)trxomo3iydfp  ln o;() rxm(rpnodll emnctl(f 2rax oou1aleo oeiadfa rmnmp;t)tetrxo3oydfptelu ols0s2to(r3oy4om   nvtltfs2tr(  oo4aptnifeiaslaDrmuvp;u) renio3totopteaneo ( srxmiopny1am   fvias) rurx o;t1oexnifciydlmDua(vo;u0aeeoircia1lm   nesls0trtrio ou4amee ieilt)arrmum ;u1teeo ieilsla umu o;(0tltoxfcto1lpD ln o ()s2tmir iu1op nmictlt)arurxmp;u4alt ii3tysfm2rmn s;u4 rtoxfcootlat  uei s tetm(o iu4ll emfcilsfsDtru  ;u4oexniieiat m2umnmp ()trenxo io1faD lnvs;( s2uo(m oo4lm  lfei (fa2ra(mont0aptn fctltlm umn onu4tetnxo3iytlmteaivi s0 rxmiopou4al e ncilsfartaurpou0tlx  ictydlmDrluvsnt0artnmo3oydfaD lnes (0srtrxmpny1op elicilt  2tmuro;u1oee if3iltls2rmn ont)altrmo3oydoptraieols0srtmir3ou4olt mncslt) Dtm(  ot1altomfeiydls2rauvs t4aetomfcto1fat  ivols  rtmio3ny1olee neil(faDrr( o;o0texo i3iytfa rmu s t0 ltrxo tatla  ln i;t0srumxr iy1op elnei (fa2rm(mono4apeoiociltls2rlu s;() eeoir iotopD ai s;(0tetoxo3iodlm elfvsltf 2umu poo4opxomfetytfsDrlums;(0 eermo iadfp eaieo;(0 rtmxrpnudoptn nvtas  rtr( poo0tlxo feildfm rln pn() etnio iydop   nei s t2ur(o nu1ol elivt t)aDrrurpnt0oet  ietytfsDel(mp;u4aexrxo3ia1fpD lues;(0 rtmirpiudaleeliesl( srra(r no0olenii3tasfm2raumo;t0tleoxrcoa1laD lnvo ( trxoxopnodlmt mneslsfsDuax poo0ope iieild a2rau s u)trtriocto1omtr ivi;s0t2xmxm3iydlltelfvias)s2trum nt4tle mo3tld s2rmnvpnu) rermr totfmD an sls0t2umiopnudlpenlivtls s2umu ooo1tpx mo3iatfa rlnvp t)alxrmr todfm  aivo (0srxrir3nydop eliei t srua(mpnt0ope  feildlaDumumpn()tlenxocootlp   ueils0 rxmirpou1lm n nvs s sDtm(  ;t4olt ioctldfa2rlnmpnu4 ltrio3iadopD lnvs;t0seuoir3nydlltelivsa()artaxrp;o4aexoioeiydfs rm(vpnu0 lerir ia1oaDeaueslt) rxrio3iydlpt mnesatfa2ua(rpnt4oet  fcild mDeln s;u4 etrmocootomDeaiei (0sexmio oy1amtemfcsls)srtmxmo;u4oeen ociad mDum(mp u) exoxo3iy1lmDeanvi s0s2xr(opoy1apt lictl()s2ua(rp;t1tet mietad s2ranms;t0 rxrio todopt lueo t trtrir3iu4ome mneta( arraxm oo0oetn feiys a2eluvpn(4texnmf3tatomDrln o;s setm(rpoydomt lfvta(  2rmuro;t4tptoio3ildlm ea( snt4 eermo tadfpDraivo;s)trxrxr iy4apeelfeta() 2tmurooo0ale  i3iyt m2umu onu0aleoxo oodom rlivi;t  exr(m nu1omtnlfcilsf Draurpnu4alen o3tas s em( s;t)tlxnif iatopt luvolt0trxmim oy4lm   nct s)srtmuroot0olx  ieiat mDea(ms;u4texniociy1fmt anes ( t2xmxm3oy1am  mnviat) rrmu  ;o1ale mfctlsfaDrln pn(4arxnxo3iydlmDrauesl()trxmirpou4ape lnctltf 2rmu pno4tee ifeiasla eanvp (4texoiociotlaDrln o s)t2xoirpiodaltelnciatfa2tax  ot1aex ii3ildlmDel( p;()tltnxrctatoptran o;s) exmim3ou4lptemnctlt)srururoou0alx moetldlm2eauvo (0tltrxo io1om  lnvol()seurio iudol emiei s  rra(rooo1tetnmi3iaslaDeanvo;t0tetoif3todomDrlnei t)trto(r3no4ll e neil(fsDurxrpou4texomo3iadla ua(vo;u0aeenir3ootfateau o;t)srtm(r iu4om nmfetat)s2uaxro;t0texo ocias sDrlnvp t0areomr tydom rlnesl()s2toiopiydolt  fct (f rrax  ;t0tpt  ieiadfm em(vs t0tetrir oa1lm  ai il()trtmimpnodop   iesl( a2trxrp;t4aexo ietydls2emumsnt0 renmrctotfat  nvs;s t2xmxopoo1lpte nci sf 2trurpnu0alx mocildlsDrmnvp u)tltrio iy1fptr u i t0 2xo(o oy1llt  fvi t a2rr( poo1aee mi3tlsfa2ea(vp;() leoxfcoa1laD aivo;t tetoimpoydopt mfcias a2ta( oot0oet mieild aDea( s ()tltrir tydlp eli slt) euo(r oudol nmfes sf Dtax  ou0olenmoctad sDumu o ()tleomf3oodfa eaivsls sexoxrpoy1apeelnctls arta(  ;u0ape ifciadfs2rm( s u0alerifciatfaDe u o;s0texr(m3nudlmt liesat) rrr(rpnt1opxnmfciadlm um( p u) eenxo3tatlpDe ivo;(0 rxm(mpiu1amte fvsatf 2urumooo0oexo ictlt s2rlnms;() exnxrciytlaDe n o;(0 rxoxm3oo4om  mfvils srrax pno0opeo fctad m emuvs;t) renmo tadlm rlnes t  2xmxo3nodol   ivilt sDtmu  ou1tet  ietydfsDrauvs (0 lxnmo3oadlmDeluvs s) 2tm(o3iydllee ivia(fsrtaxmpou4apt  fcildfa el(msnt)tlerxf ootfa e ues;s  2um(mpiu1lmenmfvsl( aDuaxrooo4oleniiciysfm2rmu s t4altoir3oa1fa r ies;( s2xoio oudlm elnvs tfaDtrx oou0aptnmfetydfs emu o (0aexnxfcoadopDr ueo;(0truoim3nu1al nlfvs tfsDtm(rpoo0tpxo feildfsDemnms;(0 ltnmociy1fmtraies;( texoiopoydol n fvs s  2tm(rp;u0ope  ictytfa2rlnmont)alxnmr oy1fmtrai o ( srxoxopiudllenlies s a
\ No newline at end of file
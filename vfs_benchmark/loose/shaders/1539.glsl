@@ -0,0 +1 @@
+nesl()srtrio3oodole  fvtltfaDtmur ;t0oleniocilsfmDrau o;u0trxrxf3iy1fp rlueo () ruoxr3iudamtn ivtas) Dtr(rpnt1oex  i3iltlm2ulu sn()arxnxrctadop  livo;()trur(mpoudll  lnvs s  Dra(  ;o0ole mocildfa em(mpnu)arxoxfctotopt  i s;t  exoxo3oy4ol nmfcs s artaxrpou0teeniietysfmDraumsnu)treomfcoatlmDrai s;s s2um(r oo1oltnlfvs t arraxrp;o0alto iciadfa2umu o;(0teenmf totfa raues t0trxmxm oo4am  licsa( aDua( ont1olt  ocild s2ua( p () rxnmf3tatfp  au s;() rxrxo3oydap n fvtlt sDrmxmo;t1tpxomf3ildfs2elumo;t4aeeomo3oatlaD  ivs;t0seto(o nu1ol nlfvslsfartaurpot4tpenmo3tysfm2em(mo;t)aexoircoydfpDe u o;( t2toxr nydlme mfet sfa2rr(mp;t1apeoii3tatfm raums;t) rerxo oo1fm raiei;s0teumxm3oo4opt lictl(f Dtmu pnt4oet moeiyslsDelnmsn(0altnmrcootlm  li s;(0 rxo(o iu1oleelfetat) 2rrumpno0apxnioetls mDelnvo;(4 exrmo iotom   ueo;t) 2xm(r ny1lmtnmicsas) ruaxrooo0aeeomiciydlm2em(ms;u4altnmr3totopt  ieol( trumir io4om emicslt)sDrmumpnt0tlto f3iyt mDuluvpnt) exnmr3oatfm r nes (0 ruoxr nodome mncil( artrxmp;o0tex iicilslmDua( on()arxnmfciy1omt  uvo t trxoxr iu4omeelietls sDtr(mono1oexnmi3iytfa2ulu o;()teermr oodlatean o (0 2tmir ny1ameelfvslt  Duax p;t4tlxn iciad a2eanvpnu4 lxrmf3totlmDraneol() etoxm oy4om nmivs tfsrraxr no1olxnmoeild s rmnmo;(0 reniociadfmD  uvi s0 2xoim3no1am emfetas) rra( pnu1apxnmieilsfa2rmn p;u4aeenxr3oo1fa elueo;t0srtoimpnudom   fes tfa2ua(mp;t4altnio3ilsls ea(vsn(0 leriocoadlaDrli o ()s2trxo3nodome lfcs ( aDrr(m ;u0tptoii3tyd mDrmnmo u)trtrioctotfmt aivs;t0t2uoxmpou1ll nmicias arum(  oo4tpxo ociys mDumu o (0 ltriocty1oa   nvs ( setrim no1alte nvtl( arra(m ;o4olx mociys m2em(ms;(0tlxnxo oy1lat aivolt seuoxmpiodamtelnet t arua( poo0alxnmf3ilt m emnmsnu0 rtrmo oatopD  ueil() rxm(mpio1ameemfei s)s2uaurpoo1aexoiicias m eln s u0trerifciatfa rauesls0srxrxo no1amtnlfctltfaDtr(moou0oltnif3tysfsDemu s;()tltoif3iadlaDeaivs s)srxrxrpoydop   nei s sDra( poo4olt ifcildlmDrlums;t0artoirctydlmte i i t) etm(o ou4am   fcsltfaDrm(  ;o4olxnmf3iysfaDuln p t) eenxf iy1lpDeluvi;s srtoxo oo4ole lfvt t srum(rp;u1ole  i3tyt s2uln p t)tetnir3iydlmtrau ols s2to(r nu4lme mict s) 2um( pno4oee iociytls2uauvon(0tlxrxr3ty1lptrau i s  euo(o oy4lm elnesa()sDta( pot0olxnioeiat sDumuvs;t0 exrxocto1fm rauvolt0texmio iu4optnlfes s)s2tm(m ;u1apx iociytfsDumn p;u0 etoir iodfat livo s  rurir3ou1ame  fcsl( a2rrumpnt1alxoif3iyt a emuvpnt)aexrxfctydfm eauvsls srtmxr nodap   netas) rrrum oo1tleniictatfs2raumo t0trenxo3oatla   ivo;(0 rxm(opou4ale  feia()a2rmurpnt0ale  oeild aDranvs;()arxoio3oy1faDraueil( sexrio iydam emiei s aDtrxmpot4aptnmo3iytfa umnmsn(0 etoxo iydfmDe i ils)t2tmir io1ll n nes (  rrm( p;o4apxo iciyd a ranvo;t4trtomf3tadlptelivo;()setoxo oo4llt  fcsas) Dua(m ;o0texo f3iydlsDem(vs;t)aleoxrctodlpt  ueil(0s2umir nydal  lici ( s2rmx o;t4apxniiciytfsDranmsn(0 eeoxo3oadlp e ivsls)srxm(o nodom nmivsl(  rumu  no0apx ifeiat m2rm( s ()artrioctodlm rlnvols  euoir ny4lmtnmfeils)a2tmumpot4oeenmi3iysfaDranmon()altoio ia1fm  lnvi;t)t2xoio oudamtn ietlt)sDur( pot0opx mieilt sDeanmpn(0aetnxo oytlp eaivi;s  etr(opiy4lpt mietl(f rtru pnu0aeeoio3iltfm2rmnmp;(0aetrxr3tatomt luvolt) rxmio3oy4lme lncta() rrmu pot0aeenmo3iadfsDrln p ()texrircta1latelivsl( t2tmio3ou1lm elfci t)a2tmxr nt1teeoioetadlmDra(vo (4tlxrxrcta1fpD lieil(0t2xrxm oy1ll  lictas)sDum(root0alxnmictydla em( s;t4areoif3oytla elu i s  rumim nu4ol nliet t) Duaxr ;u1oetnioctysfs2uauvs (0alenmr3ootlptelivsl()s2umxr oo1amtnlfvil()arrau pnt0apxoioeiatla2ra(vo;u4alxnxo iodlm elueo;s  rtmir3nydlltnmfetlt artru pnu4teto octytlm2ea( o;()arerio iy1lmtrlieol(0 rto(rpoo1aleelnvs tfsDur(r no4tlxnii3tyslmDel(vp;u0tleomo oa1om   neo;()s2toir oo1om elictltfsDur(mpot4openmiciadfa2ranvsnu4trxnxrctadfm ranei s)teurxrpou1lpt  ics s) Dur(mp;u1tlx mfeiadfs2raumsnt4tltrif3oadlpt lu sl()t2uo(r3iydalenlietas)a2rmx p;u4tpe mietlslaDeau p;u0trxrxf3tytfmDe u il( seurim ny4lpe mfvtltfaDua(mpnu4oltnmictlsfm2rlumon(0artrmf3iydop  ln i;s setrxm3no1om  livtls s2ua( oou0ope mf3ildlaDua(vs;()teerxo to1fmtr nvi;s  rtm(r ny4lptnmivtat  Durumono1olenif3iatlaDrluvp t0arxnxf oa1fmteai i;(0srtmxo3nu1olt  nvilt sDua(mo;t1alenmf3iydfa ranvpnt0tltnmr iytfat livols s2um(m ny1apen fct (fa2trxm ;t4apt mo3iaslm2em(mpn(4trtnir iy1fmtrau il( sexmir no4apt mfvs ( srtrxmpnu4opxnif3iatlmDulnmonu)trtoio3io1lpteau o;s t2xo(opoydal nlnei s) Dua( p;u4alx if3iys m rm(mon()aetnmo3iotlaD  i o;(  eto(r ou4aptnlfciltf rtaxr nt4tlen ociltlm2rmn pnu4aeenioctatfpt  uvslt)trur(r nodal emiet sfsDta(r ot4ope ifeildfaDem(vp;t4 eenmo3tytfp rlnei t s2uoxo iodap nmfcsl( s2tmuront0olenmo3iatla2umnmo t0tlxnmf iatoptelu sl(0t2uo(m3oy4alt  nci sfs2rru oou1optomf3ildfmDrmn o u) exnir3iy1om e u i;t0t2tmxo3oy1lm nlics s aDtr(mo;t0texnmiciltls ulnvpnt0 reomrcoadoa ran ilt)seuoxo iudlp  mfcsls sruaxm oo4alx moeiysfs el(msn() exnmf3iatoptelueil()seurxrpny1apeelivsat srrruronu0tptomf3iat m2ranmsnu) reomoctydfm e nvi s s2xoiopnu4om emncsa( s2tmurpoo4oetnifciysfs emn p (0 lerif3oadlp eau i;s  2xoxo ny1ape  fviatfaDuaxmoou1olenifeiyt m2ul(ms (0tetnmo io1oaDelues ( t2tm(r3iy1ap emncsa( artr(mpoo0tltomoetatfs rln on(0 rxoir3iatopD  iei;t  exmxm3oy4al elivtat)sDraumonu4alxoiiciat sDrl(mp;u4alxnio iatop e nvsls) rxoir ou4openlfvs tfs2rrxrooo1tee moeiat mDumuvsnt0altrir3oytfatrluvi (0s2tr(o3iydaltnmfeta(fa2tru  ;o1texomoctyt sDelnmsnu)trtoxo to1fp rau sl( trurxm no4ll emici t  2ta(moot0oetomo3ias aDua(vp (0trtrxf3iytlmDrlivs s)s2to(r iy4lmtelfctat s2umu p;u0ale mi3iys a rl(mo u4 renif iotlat aiesl()s2xoxo3ny1op nlicias  Durx ono0opxniietatfm ranvs t4 ltoxf oytop ran i s) eumxmpoudaltnmfvtas)sDuaumpnt1opt mfeilsfs2um( p t0 ltriocoodlptrluesls0srxoim3nudll   fesa(f 2rax o;u0openio3iad m umu sn(0aexoifcoatoat  ieil()srxrxrpoy1lmenmfeilsfa2tm(rpnt4apt  ictyslsDrl(vp;t0 eeoifcoodfat aiei;t0trumxo iodllee fvtlt) ruaxroou4alx mi3iltfa2ul(mp;t0aexrio totoa r n s;(0srtmxo3io4aptelfctl() 2ua( o;o0aee mf3tasls ea( s;u0 etoxfcootfpDrlivols0t2trimpiu1apte nvi ( srur(mooo4opxomictat sDea( p;(4altnxo oo1op rlneols  2urirpoy1ale mfciatfa2rm( o;u1opxomf3tadlm2el(vont)texnio oo1oa r nvi s t2uoim3no1oltelncslt)a2ra(r ;o4aee  oetytla2rm(mp t0tltoio3iatopD luvi;t  2xoxopno4apeelfvt ()arum(m ;o4alx iieiydls2elnmon(0artnmfcoytla e nvil(0t2um(o io1lmtnmictl( artax pnu0apt ioeiasfmDel(msnt)alenxo iy1lmDelnvs;s0trxr(r ou4llenmnci t)arum(m ot4aptomiciatlm2umuvon()texrxfciy1lmtr ieo;(0texo(o oy1ole mictlt)artr( pnt4olx  o3iltla2rmnmpnu)artrxr3ootfat  neo t sexmim3iy4llte nvs (  2urx oou0oexnifetat s2uaumsnu0 renifctytlptr nes s  2umimpiodom  lfetas srrax p;t1alx  octat a rmnvpn(0trtrir3iy1fp   nvi t)sexr(rpoodaptelivt s)sDta( pnt4texniocilslm2ulumonu4trtrmr3ia1omteli il()s2xrxm nodapenlncsat) Draum ou1oetn f3ilslm emn on(4altnif totlatr ues;( seuoim3iu4altnlicil() Dua(mp;t0opt moeiydls2ea(vpnt4 exnxfcoo1laDrluvs () rum(o3iy4lpeemici (f ruru ont4aex mictat m2rmu p;(0areomf3tydoat luvo;t) rxm(r3iy1olenlnvsas)aruaumo;u4apeomo3iad sDuan ont)tltrio ty1opt ln s s0t2ur(opoydop  mivils)a2ra( ont0oltomfetydls rm(msnt0altnmo3ia1lptr n s;t  2uoxopoo1amenlicsl() Drmu pnt4olt mfctad m2rm(mo u4 rerifcoo1la  aneols  2xr(mpoo1lle lfvi (  Drm(mo;o0ole iictltls2eluvonu0aleomf todlp   ues s  eto(o ou1ape lneilsfs2ur(mont1aeenmoeiyt s2rauvp t)areomf3oatlp   ivs;s  2tr(rpiu1ome livtl(fs2ua( onu1oexomfeiyd m rmnvsnu4trtoxfciatoaDe i i;()srtmxrpno1lme mfcs t s2tmur nt4oee  o3tldlmDemuvo (0arxoxo totlpDeai sl()srxrxr ou4opeelivt sfaDtmu  ot1aptomfeilsfm eanvpnu0trtriocio1oate u ol(0t2xo(m oudalte nci t)a2rm(rpnt4tetn octys aDea(mp;t4aeerxr3totlm rauei s)texr(rpoodom  livia(  rurxmpnu0aeto octltfm emu sn()altoifcta1lmD  n o ( t2tm(m ou1lpte ncs t s2rm(m no1aeeoioeiytfsDelnmp;u)alenmr3iy1opDr i sl()seumim3nu1am   ieias sDtmu  oo1ape  ieias a umuvp (0 rxoxfciydlp rln s ( t2xrxrpiodoltemfet s)aDtrumpno1tee mfctydfm2ulnvon(0aeerio iy1fmDrauvo s0s2xrimpoudlmt  ict s)s2um(ro;t4tleoiietad a2ulnmo u4trxnir todfmt  n i;( seurxo3iy4amtemnvsl()s2umu p;t4opx  ieilt m uauvsnu)trtrmr io1fpDran o;()srtrxopno4ap nmfcslt  2ta( p;u0oet mfeiaslaDrluvsn(4trtomfcoadopteluvils0s2ur(mpio1optelivtas)aDtm(mono1oeenioeildls2um(vo t)arxnxo3totfpt li i s setoxopno4omeelicilt aDtrxmonu1tet  ieilsfsDrm(mo;(0 leoif3oodfaDr ieo;t)srxoxo nodllee ncsat s2tr( p;o1apenmfctldfm umn snu) ltrirciotfa  an slt)t2triopoudom emnvta() rumur ou4opx mfeildls em( s () etrxr3tytlm rlneslt0teurio3oo4olte ncils)arua( ont0ape  f3tatlmDrlumo u)tetnmr3ia1op elnvs;t teum(o3oo1op elfcslt)sDtr(mpnu1aexnmf3ilsls2uln snt4alxnircto1lmtrlues;t  rum(o nydalenmics t)s2tmx ono1tltniieildls2emnmp;u)tlxnxf iodoaDrlu olt trtoxo3io4al  livi s artr(  oo1oeenii3tyd sDuanvp ()tlxnmo3iodoaDeln sl( setrxopoy4omeelfvsat aDtmxm nu1tex iicias m rmnmo;u)treomo iadlaDrlu o s)s2tmiopiydop e net t sDuaxrpoo4tpeomfcilt aDemn o t4altoio3tydlp e n s ( trtm(r oydlptnlfet tfa2rax o;u4tpx io3tatlm2rm(ms u4teenmo3iadoptrauei s)srxrxr oydomenlivsas)srurxmpot0opx  fciydlm umump;t0aetrif iytlaD  i i;(0trto(rpny1lm n nct (  Drm( pot4opeoif3iadlm2rm( o;t4 exoif oy1oatr nvs (0trtoio iydaptn icsatf rrrx oot4oleo fctldfs2rauvo t)texnmf3totlat lnvo;(0t2toiopou4openlneta()arraumonu4tlxo iciad aDumnvpnt) ltomfciytlat luvs;s sexrxm nu4lle  nci tfsrurumonu1tet mi3iysfs2ranvs;u0aeenmo3iadoatrlieil(0t2xoiopoydal  micils)a2umum oo1opxnifctys s2ra( s u4teerxr3iotlp   uvo;s0 rtmxm oudolen ieslsf 2tmuro;u0oet ioetat mDel(vpnt4areomf3ootlaDrlu i () 2xmirpnudaltn nesasf rua( p;u4tlt mi3ildls rmumpnt4 etnxf oa1la e ieol(  2xo(m oy1llen ivtlt srraum ot4tlt  oeiatls ra( s;t0 etoxf3iadlmtr nei;t0 2tm(r3nu1omte fct s srum(ro;u1apxn feiad a2ra( p u4trerxr3oo1lm eau olt)trtrim ou4ap emiei sf 2trumoot1aex moetld sDea( o;(4trermr3oatoaD  uvi;t s2to(r3iudaltnmfciatfsDumur ot1oex mi3tydfs uln pn(4tetoif oy1op e ivslt) ruo(rpnu4lpen net ()s2raxmono0tex ioeilsls2emuvs u4 eenmo totfmD lies ( s2xr(o nu4omt lnciat aruaurpot1texnmf3iltlmDua(vpn(0altnifciotlmt  u i;(0trxr(o3iy4op  mfvilsfs2ta(m nt0oee iociaslsDumumsn(4 rtnmf iodfaDrlu i t  2trxo3ny1opt  icia(fs2trx oou4tlxomfciydfsDrlnms (0arxrmf oadfatrln ils t2trio3iodol n ncias sDra(moou4tlt ioctytlmDuan p;u)teeoiociy1opt an s s0srxmxm iu4lp nlfct ( aDra( pno0ape  ieiatlm rl(vsnt)tltrif totom   nes;s)srxoxmpiydomeemieta(fa2ta(mo;u0tle  f3iat a ra(mp t0arxrmfcoy1fatrauesls  etoxm no4omtnmiesltfaDtr( o;o1alxn feiytfaDul(mo;u4aeenmo3oydlptrln s;s t2trio3oy4al   nvsa(  rraxronu4olxomf3tlslaDemumont4 rtoifcoatlpDr neilt) exo(o ou4omtnmivs s  2ur(m ;o0apxnmocils s2rm(mp u)tltomrctadfm rlnvi;t) rtmio3oudop  mfcilt)aDrr(m nt4aetoii3tadlm uanvs (0areoir3tydfp e ies;s)srtmxo oo1al e ivs ( s2um( onu0aeeoif3iytfsDuauvont0 etoxocoy1oa e n o;t0 exo(rpoodlmtn ivsl(f rraxmp;u0tptoii3iatls emuvsnt0alerir3oy1lp eanes t seurir nu4amenmneilt s2ta(m oo1tlxn o3tys aDrmuvonu0arxnxr iadlp  luvils)setm(mpiydlpte neiat) rtmu ono1oet moeiadls eluvp u)tetomoctotfm e neo;s  rxrir3nu1lm  mfei s)srtrurpnt4oexn ociat a2eaums (4areoir iotlp r u i (0s2uoxr oo1open nvsas sDtrx onu0tlxo f3tasfs rl(mont)tetnxo3to1omte n ils t2tmim ny4oltemfcs (fsDrmx ooo0tlxomfctldfm2elnvont0aeermfciotopt  i i;s)trxmxm3iy1lmenlnesat) rur(mpno4aeen oeiadfm2rmuvp u4 lerxo3tytoa eauvs t srtm(o3io4am n ieilt  rtmum nu1tlxnmf3iltlm2eanvont4teermo iatoaDrli s;t0trxr(rpou1lmtn fct s  2uru  nt0apeoii3tasfs2emnmpnt0areoxo3ia1la raies t s2to(o3ny1om n ics t  Dum(root4oleomictyd a2uluvsnu0 etomo ta1op raivs ()trxm(r3oudllenlnvs s aDrm( p;t1aet mo3ilt mDuluvsn()treomf3oy1fate n il( sexoim nydlpe licsls a2tmumpnt1texniictltfs2rau pnu)alxrxrcoodfaD  i o;t0s2uoiopno4olt mnvt tf rta(ro;u1tpx ifeiltlm ul( s (4tlenxf oatfa   ivi;()t2urim3ny4amtelnet t)s2rau pot0opeoiicildls rmnvs u4tlermf ia1laD aneslt trtm(rpiy4lm  mietlt  rtr( oou4aet miciysla ua(vpnt) rxoxrcto1fpD lneo ( t2trxr iodamen nctlt)sDrru o;t0ape ii3ils aDelnvs (4tetnmo3iodop eln s ( srto(m iydom emnet ( aDtrur ot4tlxn oeiysfm uau p u4 lerxr3tatopD anes t t2trxm ny1aleemnetasfs2tr(r no1optn ietltlaDrmn p;t)alxnifctytopDelueo s0 2tm(mpiydaptelfvs s s2trump;o4tee io3iysfmDulumo t0 ltoxf3tadlpte iei;t)srtm(rpiu1ol n fvtlt sruaxrpou4apen ieiat aDranvp;t0trerxo iy1fat lueo;() 2to(o nydol n neilsf rrrx p;t0aexomictadlaDul(vo;t4arxnmo3iadfm raivilt t2urirpoy4lptn fes (  2rru  ;u0olx if3iysfm2rmu ont)arenirctadlmD lieo;()texm(r no4lpte ncil(faDtax  ;u1optnioctytlmDeauvs;t4tltrxr oo1fa  li i;s)trxrxopnodomtnmnei t arumxr ;o0oetnii3tydla2rmu s;(0alxnxfcia1faDrlu s;t0truoim ou4omenmnetlt  rrrum no0oeeniociltfs2uau ont)alerio tydoaDelueil()tetmxrpou4oltelnei (f rtmxr ;t0oltnii3iad a2rau pnu)tleoio3iodlmDrlnei t)tetrimpnu1op   nctlt)s2tmu ono0oexomicildfmDemnvon() eeoxf tatlpt lnvs;t trum(r oudopen nei ( arrmu onu0oee miciysfa rm( p;t)alenmfcoatlm   ies;(0 eurxm iudaltnmnes ()a2rrump;o0alto f3ild aDrl(vo (0artnio3oo1opDe u ol() rxo(r3oo4lmt mncil()aDtmxmpot1teeomfeiatfm ulnmsn(4trtnxf iotfm rlivols0sexmio3ou4ap   ncilt)a2rmuro;t4aetoifeiaslm emn pnt4 rtnio3tydlat  nei;(0s2uo(o3io1lmt lfvt s)a2ta(m no0tet iiciadfa elump;t0alenifcoatlmt  uvs t)s2xr(o nu1lm nmnvtat a2tr(rpnu0oeenmieiyd m ua(vp ()texniocoatopD ln s;(0srum(o3nodaltn fei t)arrmump;t4optomoeiatfs2raumsn()altnif3iytom e nvs s  euoxmpiy1omeemfcs t s2tmu  nt4aee if3iat sDean o;(0 rtoxo3oodop rlivo t)sexmxm nodap   ict (  Draurpou4tltomfeiaslm2rauvsnt0 reoio oydlm r uvils)tetrio3ny4optemictlt) 2umurpoo4opto fetytfm ranmp ()tleoio3oytlpteaiei;t0s2xo(m3io1llenmfvil( arurxro;t1tle mi3tyd sDea(mpn(0alenir3io1lm e nvs (0 rxoim3iu1olenmfvia( aDum(r oo0ole  i3ilt a2emums;u)altnif ta1la r ueilt0 2umim3ny1ale lfeta( a2umu onu0olx  ocilslsDuauvpnt4 exnioctydlm e ivolt)srxmxr3no1aleemnvt s)srua(mono0olxomfcils s2ra(ms u0trtomr iodfpte nes (  eurxo ou1amtnlivt t  rurx onu4oleoif3iydfaDrl(msnu0texnifciy1oa e u i;t) etr(mpio4optnlfvtl()srrmx ooo1ape  octydls2eanmp;u)aeeoxf oo1fpt livo s0sruo(o oydlm   ivt t  2urx pot1oee if3iyt s2ran sn() rtoxocty1om  li i;( t2toxopoudll n ivilsfartm(m no4aee iietadlm rlnms;u)alenxr3tydom rauvi s tetmxo iu4om   fet ()aDtaxrp;t1apen ietad a2eaump;u)treniocta1la rln s t0sexmxm3ou1ap e iei () 2ua(moou4alto ieiydla rl(vont)alxomo3oa1fmDeln ils t2uo(rpiy1optnlivsat  2rrxmp;t0apxoio3ild aDra(ms t0trtnxo to1lp r uvs s  2to(r3oudal n ieil( artr(mpnt0tet  ociadlm uau s u0altnmfciy1om r n slt)srtoxm io4amtnmfet tf Dururp;u1texoiociytfm rmuvs t0tlermfciotfa  luvs;s  rur(rpno4omte ictat)aDuaxr no0tet mfctys mDeauvs;u4teeomo totom   n i;s)setmxm3ou1omt  fvi tf rrmxr oo0tleo f3ilsls2emumo;u0tetomoctatfaD  i o;t) 2toxm oydll  mncs t  rrru pnt1aptomfetydfa emn o;t0aexnmrciydfpt livs;() rxmxo3iudlpt  nvtatfs2tm( poo0aexn f3tlt s2rlnmpn()teenif tytla ran o;s0 2uoxopiu4lleemnesl(f Dtaump;t4aex  oeiatfs2uan snu)trermo3iadfmt  n slt) eumio no4ol emfesa(fsDtmum oo1opxo icildlm2umuvp ()trenmfctytlmDelivilt)s2urxm oo1lltemnvslt aDra(r ou1tle mfctld m umn p;u4 lermrctotfpDr neo;s t2tmxm3nydlmtn nvtltfsDtm(mpnu1oex if3tldla2rmnmo u0aexoif to1fmt lieo;t srtm(m3oodap n nei t  ruaum ot0apx iieiatla2ra(ms;() eenir oytlmDraieo;t trxmio3io1ol   fvia( s2ur(moot0oee miciys s2um(vsn() rtnxr3totfmD li ils0srxmxopnu1opt mivt t)arum( ooo1oeenmietadfmDuaums u) eerxf ootfaD lneo s  2xmio iy4lle miet ()s2rm(  nt1tpenio3tydlaDel(vont4 etnxfciy1la rluvilt)trurir3ny1lm e iesa(f rra( pot1alxnifctltfs rau p;(4artoxf oa1opDrln i;s)trxrir nu4oleemnvtls) rraumo;t1apt ifeiltlm2ul(vo t) rtrxo3iatlp elu il( srtr(o3nudlmt mnesltfs2uaur nu1tpxn feiadls2ul(vo u4trermo3iatfatrau sl()texo(opiydaleelivs s)arurx  ou1tlto fetadlsDumu on(0tltnxo oydoa r nesls)t2uo(opiu1omeemieiat)sDurxmoot4olxnmieiadlmDumu pn(0arenio3oadom  livslt0srumxr3nudol nmfetas)s2rmx  oo1tpe io3ildlm emumsnt0 eeomo oodfpt  nvo ( trtmimpny4am  mneslt) rumx o;t4aeeniociysfa rmnmo;(0arermr tatfaDelieols)tetm(mpio4oltelnctlsf 2urxr oo4aexomoeiyd s2rlnmp;(0altnmf3iydoaD lieo s) euo(mpio1lpeelnci ( s2umu  ;o0aeenmociysfmDua( o t) rxnio3oadlateauvsl(0s2xrxo oy4amtn feta(fartmum ;u1alx ifeiydfm2rmu o u0 lxnxo iodlatr nvol(0texoim3oo1amt mnctat s2rr(ront4olenmietlt m rmnmp u4 rtrir3iytoa  ln i (0t2xoim3iodal  mnetat  rum(mpnt0ole mi3tatla2rlu snu0teerxrciytfmDraieo;()sexm(rpnudoleelivtat aruru o;t4tpxnmocilt a2ulnmp;u)trerif oytopt li s ( tetrxr nu4opeelfet t) rrmxrpno0oeto o3iysfs umumo u0 rxrif oydfmD aieo ( seuoxmpnodlmtn nvt (  rtrump;u4tex  fciysfs ua(vp t0tetrxf todlaDrlneo;(0 2uo(o3iydll   fcsl(fs2rm(m nt0oeenifeiltfa rmn onu4teerircoadfp ean i;t0 euo(o iudaptnmnct (f 2ur(m ot4tpxoiiciydfa2emnms t4tltrio tatfpDr uei;s)srtrxmpiodomtnmncsls  Draur no4apenmfctltfs2raumpnt)aexrxrctatfmtean slt0trxmio ny4lpt livi (  2uaur nt0tpxnmf3tysfs2ran p (4 rxrmocootfmt  ivol()trtr(mpiudlptelicsasfa2uaxr nt1oet mi3tytfa2ua( o (4teerio3oy1fptrauvo t0teur(opno4altelfvsa()srumx  ot0aptn ocild mDeau pnt0arxnir totlmDr uvo;t) etrxm ou1amtelnvtas) 2rm(m ou0aptomfcilt a2um( pnt0 rxrir3iadfatranvs ()texr(r ny1lleelieiasfsrrr(mp;t1tltnmi3iyt s rm( o;(4trtomoctotlaDeln olt t2tmxrpiu1optn icsas)aDtauro;u0tlxoio3ilsfs2ul( s t0trtrxo3oodla  anei;(0srtmio3ny1oleelicsa()a2trx pnu1alxnmf3tltfa eln o;u4 lxoircoadop  aues;s)s2xo(r ou4optelnvs tfs2rm(mp;t4aexn i3iadla rmu s t4trtomo3io1fpDrai sl() rtrio3nodop   neslt  2rmx o;t4open f3tys aDrlnvonu4 etriocia1lpD luvsls)trxoimpiy1olenlieilt sruaxr no1aexoiociat sDuluvsnu) ltrmo tadfmteaneo t  2xo(mpio4alee fvslsf 2urumont1tlenmiciytfs rmnvont4aexoxr3tadfm   ivi t seurimpoydlmen ivtlsfs2rrxr ;u0aetn feiaslmDumu o;u0trxoxrcootfpDeauvs;s) 2xr(m3nu4llee ieilsfaDta(moot0aptnmi3ias s2em( o t0arenifciatla e uvi t0teumir oydamtemivtltfaDra(mont1oet iieiytfm ea(msn()areomo3oadop r uvs;(0setrxo3ny4om e fvs s)sDrrx  no1tlx mo3tadls uauvo u) reomf3iydla  ln o (0t2uo(opnudlmen fciat)sDrm(  ;o4teenmo3iltfs rlnvs (4 rtrmfciytfpt aies ( t2toxr3iy1om n nvt tfa2umu o;u1tle  i3iadfa ulu onu4arxnif iydlaDranesls0setoxm iu4al n fvilt arra(m ot0apx mfctlslsDra(monu4 ltrxo3oydfpDraivs () 2trxm oo4ape livsl()artr(  ;u0teen ieiydla2rm( pn()trxnircoadlp e nvi t0texmim3nydom  mnctls) 2rauroou1tptomictlsfm2rm(mon(0arxrmf3oodlm  lu s s) 2umimpoy4llte ncil(fa2rau  nt4aexnmiciadfmDulnvp () eerir3oatfmtelnvo;s  eum(rpnydalt  ictlsfaDraumooo4tlxnmietadlm2umnvs u0arxnif3oadlpDeau il(0texo(o3nydalt lieil(  rrmx oot4open f3tysla emnvp u4aetoxf todfaDr nvo;(0 2xoim iudomtelicia(f 2tr(  no4aptnmfciltfs2rl( p u4tlxnxrcoytlmDe ivs t0trurim3ou1ope liviat sruaumont1aee iieilsla2rl( pnu4tetomr oo1laD lnvsls t2xmir oy4lp  lfvtlt srururo;o0aptoiieiat mDuauvp u)aetrif3ta1fpD anvil( s2xmxo3iudlmeemfetas)sDur(rooo4oeeomoctld sDran o t) ltnxo3oy1oatraies s  2ur(mpiydlmee nciasf rrrxrp;t0aee mi3iadfm2eluvp;(0altrir3todopD  neilt0 exo(m3iu4oltnmics t) rtr( ont4aetnifciysfm uln p u0 rtrmr3tytop eaneo;s0srtm(r ny4apt lfcslt)srtmxmo;t1teeo i3ils s eaumsnu4aeerxr3ty1oaDe i o;t  ruoiopnydlltnlivs sfs2uru poo0tpx mo3ild m2umnmo;()arerioctatopte uvo;() rumxrpnodope lieiltf 2tmxm nt1optnmfetaslsDemu p;(0tleoifcty1latrlieslt0 rtriopnu4apt  ncs ( srurxront4tetniietas s2emnvo;(0 ltrir3iadlmDe neol(0 eum(m nydll e net s  2rrxm ;o1oet  feiat a um( on(4tlxnmrcto1omD  iei t)srxrio io4opeelivi (farraxmpou4oexnif3tlsfmDemn p u4teenir3iydlp  luvs t)srurxo iy1omeelics s)sDtrumo;t0apt  oeiatfa2ra(mpn()altomo3iadfmt aueo s) rtoio iy1am nlieil(fsrtaur ;u1ope  i3ils s2uauvpnt0arxrxfcootfa eaivo s)truoxm nu4ap e netl( sDra(mont1aexomoeilt aDuau p;u) ltoxf3iy1laDr n i;s)t2xr(m iydlltnlnci t srrmu  nt4ale mfeiyd a ean o () rxnifcoatomteaivi;s)trum(o3oydlptnlneta(f rrr(rpoo0tetn feiatlm2uluvpnu4teenmrcto1lpDe nvilt t2tmim no1oltnlncias arumu pou4tpx  o3tydfs emnmsnt4 etnmocoodfpDe i o;()setmim3ou1ameemnvsa()arrr(mpno4texnmieiatla2uan s t4 exoifciodla eluvils0srxrir3io1ope  iet s arrrxm ou1openii3tldla2uanvpnu4teerxr3totomt aivolt0seum(rpoodap nmnes (  rra(r ;t4oex mf3tad a umnmo u0tlxomr3iotfmteaivi t trtr(o3oodam nlnct t) 2ur(mono1teeomo3iatls uanvo;t) leomf3oatopDelies t0s2tmxopno4lpenmncias)arua(mp;t1apenmicild sDrmu s;(0 ltnmo3oytlateanvs t)srtmirpoy1omtn fvtlt)s2ta( p;u4ope mictydls um(mo;u0 ltrxr3tatoateaieslt0s2to(opnudlm n fvsl(fartr( pnt1tlxnmfeils sDuaumpn()alxomf3iydomt lneo s)sexmxr iydape  fctat)s2umxrp;o4ole ifcias aDum(vs t)tetomf3oadfptranvi ()srum(opiodaptemnvt tfsDtm(m nt0tltn icild s ulnvs (4aetrmo3tatlmD ai s;t trtrirpiu1lm e nct sfsrrau  ;u4ole mietys a ul(vo u4artnxo3io1omDrlues;s0 2tr(rpoy4apen nct ( srrr(mpno1tlt iiciydls2uluvpnu)alxrxo oydomtr ueils0 2ur(rpiodomeelfvsasfsrur(rono0oexoioetys aDuanvpnu)arxnmf oadlaDrlivilt srxr(m io1altnlici t) 2rr( oot0tpx mi3iltls2emums u4tltnmr oydfm e i s;t) 2uo(r3oudal nlieils) 2tmum ot0tpeomi3tltlmDrln o;u4aleomocoadfatr uei;s)s2toxr ny4llt mici ( sDrmxr oo1aptnmietasfs2raumo (4aexrmr3oytfat lneols)srxmiopny4am e fes t)a2ua(mpnu1olto o3ias m emump (4texoxr3totfpD anes t truoxr nudop nlnvs tfarrm(ro;o1tleniiciad mDrmums;()trxomf3ta1fa eliei t0t2uriopoo1lmtn nvilt)srua(m ;o1aee ifcilsfm2el(mo;t4tlxoif oadla eai o t tetrxo3no4olt lnctat)srrr(monu0tetoif3tlsfm el(vsn(4aexnmfcoytlpD lieo ()trurxr3nu4am emieil(  rtmumont0tpxo ociat s um( p;(4aetnif3oatomDrluei;s  rtoirpoo1lmt licilt arrrump;o1optomo3tysfa rlu o;(4tetrir3iytom r neo s0t2umio3nu1lm   ivtl(  rrr(m ou0texomf3iat sDrmn o;t) leoxr oatla eaivi (0 etmxm3io1ll e fvil(fartmx oou0oetoiocild a uan s u)tlxnxo iatfp rluvi;t) 2xr(rpio1lleelfei t) Dum(r ot0tpt moeildls ranms;u4tetnxocta1fp  lnes s)trtmim iy1omtelivias) 2um(  nu4tpx  oeiad a2rmn onu4aeeomrcto1lmt aueo;()tetmxr3ou4lm  mivtlt)a2taur ou4alx mfciysfs rln o u)aexnxo3ootoa elues;t t2toxo nydop elivs (  rtaumpnt4texn ietlt a2elnmsnt)teerxf iydlpte neslt)s2tmir iodap emicias  2rmump;u1oeeomieias s2ra( o;()tetnxf ia1fatr nvi;() rxr(opio1am nmncs t a2rru  ou4altomoctydlmDuanvs;(4tltrxr tadla rln s;( s2toio ny4ll  mics (fsrumu  ou0tex ioeiyd sDemn s (0tltoxr3oadfmD auvols) eumim3no4lmte net s) Dum(m nu4oeto fetatfs ua(ms;(4 lxrxrciadfpDr nvi () etoxr oodamtelfeiatf ruauronu1tet io3ilt mDrmump u0aeerifcio1fpt  uvs;t0t2xo(o3io1ape lfctas a2tm(m ou0tltn fciatls emuvo;()tlenif tatomDraivo t s2xo(rpoydllenlnvtas)a2ra( pnu0optniiciyt m2ranvpnt)trxrxf3ootlmD aieo;t0t2xoxrpoodal nlfvsat) rtrx pnu0apxn ictydls el(vp u)altnmf3tatfp  au i (0sexr(mpio4ole liesl(f Dumumo;u1oetoii3iysfa uanmsn(0aetomrcty1oa rlueil(0srtrxrpiy1ll e ieilt arumx pou0apxniictatfs rmuvsnu0trenxfciadfptrln s;(0teto(r3ou4apt mieilt) 2raxr ;o1tpx moeiltfa2rl(msnu4artoio3ta1fa rluei;t)s2urxr oo1am n ieia()aDuaurpou4tleomoeiatlsDeauvsnt)trtoif tatla  an o ()tetrim3no4lptnmicils)s2tmuroou0aexnmf3iys a rlnvp;(0arxomr tadomtrln sl( truoiopou1lp n icsas sDtmx  ou4teenmfciadfaDrlu p t0tltrmo iytoa raues;t) 2um(r iu4al emivs () 2rm(  nu1ole mfciysfmDem( onu)alermr3tytlat ai i t0sexo(r iydal n nvt tfaDtaur ot0oetn icias a2rau s t)trermo3tydomtrlivs;(0t2xr(o3iudam emncils aruaxr ;t1oet mfetltfmDelums t)treomf3ta1opDrlnvs;( setrim3io4lp n nviatf rrax  ;u1aetnmi3tltls2umuvp;(4 exoir3oo1oa raieslt0trtoir iy1alt miei sfartru  ot1alenmieils mDel(vs;t4altomr3oodlpDelneo t0srxr(rpio4omt mfcia(  2rrxr nt0aptnii3iltfm2el(vo u)aetomrcoo1omt  nvs;s)srur(m3ny4opeemfvias)aDrmxrpou4tpt ioctltfs2rmnvpnu)artoir iy1lmtranesls  2xmxr3oy4ap n ivsatf rta(r ;u4olto ocild a2eau o;t0 rxomfctadomtr ieils trumio ou1altnlfeias a2ta( o;o4tlt  ieiydfsDeluvo () rxomr3iodfm eliei s)trxmxr3ny4am emfeta() 2uaum ;o4opx if3ildfaDel(ms t) lxoxo totfatraues t  2ur(o3no4lltnmnes s) 2raumo;o1apeomoetas a el(vp t0tltnxfctytfm  aivolt)s2xmxmpny4lme  nci t srrm( pnu1tpxnii3tld aDrln p;(0alxnmr oytfatrai o;(  2to(opoodlptn ivsl( sDrr(mpnu4oeeomo3iyt a emnms;t4altnifcootlm  anei s)s2urim ou4lmen ncs s)a2uau  ;o1ole  ociasfaDelnmpnu0aetrirciytlpDrauei (  eurimpoo4optnmietat sDra(m nt4oeto fciatlm2raump;(4trtnxoctadomD luvsl( s2tmxm iydam nlnviltfsDua(monu4apxnmfetytlmDrl(vp;u0 rtrif oatlm r iei;s)srto(r3iu4am   fviatfsDuaum no0openmfeiytfm rmnmonu4 rtrmfciy1laDe ivs () rxmxopiodlltnmnei t srua(mp;u0tlxnifetls s2umuvs u) renmfctatoaDrau o s)s2toxo iu1ll e fcil( sDum( pot4ale miciatfs2rmump;t)texrir3oy1lat  nvo t0srtr(rpoo1ll emfet s)sDrm(mooo1tpxnmociyslmDum(msnu4tltnmf todlatr i o s)trxrxopnydlpte fviat sDrmxrpnu4aeenifetlslmDuln s u4 lxnio3oadopteauei t t2umim iodameelncs sfsrrmur ou1opto o3tlsfa2em(mo;()areomrctydfate i s (0 rum(r3iodam emici t) 2raxroot1alxnmo3tlslmDeln sn()teeoxo ia1fa  aiei;(0 exmxr3iu1op nlneil( aruaxmo;o1oltnioeiyd mDemnmpn()altnxrcia1opD  uvi s)setmxm3nu4amtelies tfs2um(mp;u1olt  iciytfa rl(mpn() etoxf ootfa   nvols t2uoxopou4amee nvta() Dtru ooo1tpxnioeiaslaDean pnu0tlerxo ootlmteluei t0s2xoxr3io4lm elict sf ruaxrpnt4alxoioeild m2rl(mp;t) reoxfcty1la eai s;t) 2xmxm no1optnlnvsl(  rta(rpnt4tetn ictasfmDeanvp;(0 reoxocty1oaDe n i;s)sexoxmpoo4lm emietlt)sruaum ;o1apt  fctysls ulnmp;u0aeermf3todlaDr ieols seuoim3iu4lp e icil(fsDuau o;o1ope  iciysfm2ea(monu)teeomo3iy1lateaueols)s2umxmpnydomtnlnviltfs2rrum nt4aee iieiad aDranmo;t4altrmf3oytlp eauvi t  2um(o3iydlmee ivia()a2uax  oo1alenii3iltls2rlu s u4tlxrmr3ty1fpteli i t)t2um(mpoodomt lici s arrruronu4aptoii3tltfa2emn on(4 ltoxo3ty1la e i o;s0s2tmxr3oy4amtelivta( a2rru pno1teto o3iyd a ul( o;u4aetrio to1lpDr iei;s  etmxopoy1amtnlfes tfaDur(mo;u1opto feiatfs2rlu snu)treomf ootlmtrlieo s srtmimpnudolen nvi sfa2urumo;t1oex ioetytlm rmuvo t0 exrxo oadfaDe i s;t0sruoim ny1oltnlfesas)a2rmx oou1tlenmf3tltlm2emums (0arerxr totlm rln o ( tetmim3nudlpe  ivs () Dta(rpou4apto iciatfmDrl(mp;t0aexnmfciydomD  u ils0srumxm3nudlleemnetat s2tm(moou1opt  ictatfs2uln o;u4artrmfcoo1om  anvil( trxo(o3oo4amenlnvtat  2rmx ono4tee  fciydfsDraumsnu) lerir3tydfmtrluvi;t  exmir3oo1aleemnvsas) 2urxro;o0oleomi3iydfm raums;u)tleoxo oodlpt  ivs;( sexmiopoo1omt  ivtlsfarra(monu4tex  f3ilt mDumuvp;u0artoif totfatr ivol(0t2xrxopiu1om   ivia() Dra(ronu0tlt moeiltfm2ulu onu4 etnio3iodlaD lu sls) exmxopio4omee nvt () 2umump;t0tle mictyt mDul(vo t4arenxr tatfa rau i s) exmxopiodol elnvtl( a2rax oou4tptnmfciys a2rl(mpn()artrmfcoy1opDe iesl() etoio3no4llt mnvs t aDtr(mooo0apxn o3tldfaDrlu s;u)arxomr tadoatrlivi;(0 2tmxr nu4lle miciasf rumumpoo4texn f3iltla2emnvp (4aeermr oytopteanvs (0srtoxr3no4lmeelieta( srrrxr ;u0apeomf3iad aDemnms;t) ltrxo iotfm e ivs;t  exmxm iodlme mncsat) 2uaxm nu4apxnmi3ild sDeauvsnt4arxrxo3ia1oa e ieols t2urxopiudllt  ietl()s2rrxm ;o1open o3tydfm eauvp;u0 eeoxr3ta1latrlnvslt)srum(r3nudllt  ivi ( srumu  nt0oetoiocilsla2um(monu0 rxrxfcoy1lmtrau s (  euo(opoy1al elfvs t) rrmum ;t4texomfctldfa rl(mp t0texoio iydoptraivs s0seumir oodomeemnvi t aDtaumpot0oex mo3ild m rluvp ()tlerir3ia1fa r ueils)setrxmpoodal nmivias)arumxro;o1aexomo3ilt s2em( o;(4trenmr3oydoa e uei t0t2toio iydameelnvi s  2ta( pou0oet  icias sDrl(mpn() lerxfcia1lat luei (0sruriopiudlp  lics ()srtru oot1aexn f3tadla2rmu p;u0tlxomr tadfatrli i s0sexo(o3no1op   ieiatf Dumum nu1tptniiciasfaDumuvp u0 etoiociytlpD ln ols  etoio3io4am nmnvsas sDua(  nt1aee ioeildfs rm( pnu0altoir3to1laDraivo;s s2xmiopoo4amt  fct s) Drrxmpno1tle  i3tlsfmDulnmpnt4texrmfctydfmDelies;t)srxm(m no1ap  mies t aDraump;o0apto fetyt m2emnvo;t4 lenmfcio1lptr n slt  euo(rpno1ol   fvtas) 2ua( pnt1olto fctltfaDea(vpn(0 rxrif3oytfa rli s s)texmirpoydopt lfvtlt) 2uax  nu0oltniietys a2rmnvp t)tlxnmo tadlpt aieo s0trxmiopoo1lleemicsasfaDuax pnt0tee io3iyt mDel(vp;u4alxoio3iy1optraues t)srxoxm nu1om emivt s aDrmu  nt1oeeo i3tadfsDrluvpnt)tltoif oy1fpDrluvols0 etoir3io4oleemfesls  rur(mpoo0tltoii3iydla2el( o;t0texoif iotlmtean o s0tetoir3ny4ll elfctl() Drmumpnt0tet ifctldls2ea(vs;(4aetomf3oadfm  livi;s0sexmir oodol e fcsl(fartmx  ot0tlen f3ils m ea(msnt4 etomf iatlatrliei s) rxrxr oo1lmeemiesa()srtau  no0oleniociytfm em(vpn(4 rtoxrcoatlp elivo;t t2to(o3nu4lpt micsl(faDrr(  no1aee if3tytls eanmpnt4aeeoio3iytomte nvo t0trtmim iodlm nmnvilsfaDtr(mpot1oleoio3iytfs umn pnt4 rxrif oodfatraneolt0s2xmxo3iy1am nmfvs t s2raum oo0oeeniictytlm2ea(vs;t)arxnxf3todlmt  ueo s  eurxopoydamtnlfeil(  Dtaxr ;o0optoio3iltfs2elumpnt0altomfciodlptr u i;s seumxr oo1am n nci t) 2taxrp;t4ape iiciasfs eln pnu0 etrxo tatlat au ols)t2uo(mpoy1ape lfcs ()srurx ont4teenii3tys s2eau s (4trxoxfcia1oatrln s;s) rumxm ou4aptnlfcs s) rua(r nt0tpto fciltlmDrau s;u4 lxrif totfmt lu s t0t2trimpno1lpt  ivilsf rraum ot0ope ifeiatla ea(vs t4 rermf to1lp rlu i;s0 exrxr3ou4aleemfeia( sDtmx  ou1aet  oeiytlm2ulnvont4tetrir3ia1fateanvils) etr(rpoodal e fvtls) Drmxr ou0opto f3iltfa ulu o u0alerif oy1lmDraivil( srtmxo oo4amtelfct () 2ra( pno4tet  f3iytfs rau sn() rxomo3iotoa  anvsl() 2tmio no1am emnviasf 2uax p;t4ole mfeiasls rl(ms;t0trtrxoctatlmDr neo t) rxm(opou4lltemfesl(  Draxrpoo1tle ioetydlaDean s (4altomf3tytoa elnei;t trxm(mpoydap   nvs tfsrraxro;o4tet  iciydla2uanmp;t)arenmociy1fa r n i s  rtr(m oy4ol nmnetls srrrxr no0apxn feiyd m ulnvsnu0 renmr iodfaDrau o;(0sexrim no4lme mfct ()aDua(  nt0tlt ifeiys s umuvs u4arxoio3iodom  lnvsls s2toxm io4omtnmfcia() Drau  no1alen fctadfs ea(vsn(0aeerxocoadfmD anesl(0trtr(rpoo1ap e nctlsfa2rr(mono4ape  fctlsfsDranmsnt4arxoio iytlm eli s (0texoim iy4op nlfvsl( sDrm( pnt4ole iociys aDem(monu0tltnmo iodlm rau s;s)sexm(r3iy4ap  lnvt t) rumu p;t0oet mf3ilt m em(vp;u4 eerxrctydoa e uvs t0 euoxrpiodal emieiat aDrru p;u4aeeo ictys s rmnmpnu0arxrxf ty1fat liei ( srtm(o3nudope  ict t  rrmur ou1oltn oetaslm2eluvpnt)arerxfctydom eau olt0tetmxo3oudomee fei tfaDraxr ot0altn oetlsfaDeanmo;() lxrmf3tydla eauvs s) 2to(r nu1lle lieslt)aDua( pot1opxnio3tadlm rm(vp;t0trxrif3ty1lmtrln s;s  2urxm3nydlmeelict ()srra(  oo1olt ii3iytfa2ea(mon(0 rxrxf3iydlpDean o;( sexo(o nydlmtemivtls  2tr( pnt0aeenii3iyd a2eanmp;u) ltomf ootfa   uvo t0 2uoxrpnodoltelncias)srra(moou1tltomo3iltfs umnmo;()artnif iydlatrlueolt0t2tmxr3oo1lltnmivs t aDrmu  oo0tlen i3iydfm umnms;(0alxrxf tytfaDrau s;()s2toiopiydlmtelicil()a2rauronu4alen iciat a2ulumpnt4trtomf3totfmte uei;t0t2uoio3iu1lmee ncta(  rua(ro;u1ape  feildfm raumsn(0 reomr3oodfpt  i s;( s2to(r ou4lm   fes () rtru  ;t0tpeo ociysfmDrm(vo u)arxnmoctatfpte uvils)s2xmimpio4opte ncsatf 2raurono4aet mf3tatlm elu onu)tleniocoy1laD an il()sexrir nudom   ietatfsDtrxrpnt0tpx  oeiat s2rlumsnu4 rtnmf oodlptr uvi;t trumxr iu4altn feia()a2trumpnu4tpe mo3iytfm2elu p;(0tleomo3iodfm rlivsl(0srxrio iu1ol  mnetls  Dtr(  ;t0tpx iieild mDuluvpnu0arxnmr to1oa eanvsl()srtmim3io4optemnes s artmxro;o4opt  fetas m ua(mo;u0tltrioctytopteaivo;t trxrxrpoy1optnlfciat  2rru  ot1teeomi3iaslm2elnvonu0 exnifcty1om rln i ()teuoxmpou1ol  mnvia(  rtaxrpoo4tetnif3ild s2rm(monu4treniociytop e ies;(0 eumxm3oydopenmfciatfs2ua(mono0aexn o3iadfmDrlu on(4 ltnir3iydfaD  ivil()s2xo(o3ou4lltnmnesl()sDurxm ot0tltniociatfa el(ms t4altnmoctotfa raueo;() 2xoim3io1ll e icsasf Drrxr ;o1ale  feils s el( ont)tlenxf3iytfpte uvils)s2uoxr nu1apee ictlsf rrmxmont0oltnioeiyd a eanmo t4trxnxociadoatr n ils seurxm iy4omtnmneiasfsrurxr nu1oex  fciyslmDemnvp u) etrmrcoytoptraues t  2xmxm oodlp   nesat a2tmu  ;t4apxoio3iatlsDra(vsn(4 exniocoydoaDeln i;(0setm(m ou1apt lfvt t  rtru poo1aeen ocilt m2rmnmpn(0 rxrxr tytfm  anvi t) 2urir ou4lltnlivt t) 2trx p;o0oltoioeildfs2rl(mp t0 leoxr ia1la rlieolt t2urxm nu1ll e fvi t)s2rmx  nt1optomfciysfsDua(vs u)alxnmrcoy1fate ivo (0setmxm iudaltnlnvsls)a2raxrpnu1tptoifctytlaDeanms;(0 leoif3oodfat livol()t2umir oo4ale lietas)sDtrx  oo1ape ioctlslmDuluvs () renmf oydfaDeluvo t) exo(o3oy4amenlnci t  2rauroot4aleo oeiasfmDumump (0trtnxf oy1oa eaies s)tetmxm oo1lp n nes t arurxmo;o4apeniocildlm2um( p;t0aexrmf oa1omDrlivi (0texoim3no1alte ivs t s2ur(monu1aexo feilsfa eln on(0 lxrxf3io1opDrlivil(0 euoxmpnydop e fesatf Dururo;t
\ No newline at end of file
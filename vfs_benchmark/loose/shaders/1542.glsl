@@ -0,0 +1 @@
+n ils t2tm(m nodolte nvsasf rrau poo1alxomiciyt m el(vpnu) lxnmf3ootomD anvs t)s2xo(o3oo4olt lfvils sDrmumpot1aleoif3iytfs eauvon() rermf ia1fpDrai sl(0seto(o3io4amt lnei s aDrrumono4apxo f3tatfs umn s;u4areoio3oo1oaDr ivo;(  rumimpny4amen ietl( arta(mooo1tptoif3ias mDuauvpnt4 ltoxfcoydlpt lnvols0srtmim3iu1ale mfeilt sDur(rpou0olx mieilt m2rlu s (4aetoxrciatopDelues t0 2um(mpnu4lptn fci s artaur ;o1teeniictatfmDemnmp (0aeermrcoo1la r i slt0 rtrir3nudalt  feil( aDtrur ou0oleo oeiatlm2rm(vp;t0 eermocio1om eanvo t  2xrxm iy1om emicia()sDtr(r ;o0oltoii3tysfa rmnvon(4 rxnmr iydop e nvo (0texoxr3nu4apenlietl()srraxr oo1alxnmoeias m2el( ont4 lxoif oytla  aueils sexoir ou1lm elfvia( s2rrurpnt1apt miciys a2ua( pn(4artrmf3ta1optr uvo t0t2xrxr oydalte fetatf Dumx  ;t4aexn i3iadlmDum(mp t0 lxrifcto1lmDrln i t trxrio3oodom e neta(f Duax  nu4tpx  ocilsfm2ua(monu0artoir tydfat li s s0 rtr(r iudapeelncslt)aDtmu  ou1opxnifetasla2eluvon(0 exnxr3todomD  i il( texoio3iu4al nlfvsa()a2uaxr ;o1tptniicils m2um(msn(4alenmf tadlpDraneo;t0srumxrpiy4lmen ictl(  Dum(  no0apxoioeildls ul( on(4tetrmoctydoate neils seuoxm3nodlpte ncias arrrx pnt0opx ioeiltls ranms;()texnio3oydfmtrlivilt)s2xrxr nudlmenmict ()a2rmxrono4texo f3iltla2eauvont0 etomfcoodlptrln il( setmxm3oo1apte nvt tf 2umxrpot1tpt  i3iydfs ra(mpn(0 lxnmr oatfateln sls0 exmxo oy1om nmfvsl(faDtruront1tetn oetltls rm(mo;u)alermociydlmteai i t)trtmxrpoudomeelfcilt s2um( p;t4aexoif3iasfm2rl(ms;(0tetrxr3oadfm eauvi;s0teur(o oy1optnmfei s s2tau pno4alxnif3tas mDumu pn(0aeeoxr3oytfpDe nes;t)seto(m3oo1opeelncil()arra(r nt1tptnif3iyslaDrl(vpnt4tleoioctotomtr u s s0 rum(rpoydaltnlncils)arraump;t0tltoii3iydfa eauvs;t0 rxnxrctytlpDrluvils0 eur(rpio1ol nlict ()srurxrooo0apt iieiydfm2elumont)arenmf3iadoa  ln o s0t2tmio oy1om nlnvtls srtaxmo;o4tpeoio3ilslmDumnvont4 ltnmrcoo1om  ln i;t) 2xrirpny1amtn ivi s arumx o;t1aeeoii3ilsls ea(mo;u0 rtoxf totfmtraivi;t s2xmimpiy4olte ivia( artrumpnt0oet mo3tytla um(vs;u0tlxrxfcoytlmtr nvils0srxoxm io1lltemieias)s2uau oot0tex mfeiatfs eauvo;()tltnxo3iytfm   u s;() etmxopoo1am e nvta() Dtr(mpnt1tpto o3iatlmDuanmpn()teenif3ty1lmt  ivo t)s2urxm3ou1om  mnvt tf 2rrxr ou1tpeoio3iatla ulumo u4 eenir oytopD lueil(0sruoxmpou1apte ieil(fartaxr ou4texn ieiydfs el( pnt)texrifctatlatr ues (  rumxm3iy4optn ictlt)sDumuro;t0olx if3iasla2rlnms;()altrmr3tadfptelneo ()seurxopoodll emfct ()sDtaumono0openifcilsfm rlnmonu0texrir ootlp  liesl(0texrir iudlme  feilt)srrmxm ;t4teeniieiadfm2eauvonu0aexrif3todomD  i il(0 2ur(m oudom nmncta(  Dumxm ou1aeenmociysfa2el(msnu4tlenmf iotopD lueil(0truoxo oodap   fcsasfarraum ou4tet miciydfs eaumpnu0aexrmo3iodfp e uvo;()srxoxo iodam e fet s aDraurono1texomietltfm2umnvs;t0trtomoctadlm eaivi t0 rurxr iydop n feslt  rur( pou0tltnifciydfs2eanvs;u) etrio3ia1omD luvs;(  2umxmpno1lm  mnvtl( sDurum nt4opx io3iyslsDrmu pnt4alerif oo1fpDe uvols0 euoxo oo1op e iei t) rrmxmp;u0tlxnif3iaslm umn sn(0aetrmo tadlmtelivilt0 rtrim oo4ol emfctlt)a2rm(mooo0olenif3tlt sDrlnvonu4treniocoy1fm raivo;t t2umxopno1omtnmfviatf Dra(m ;t4apxn ieiatfs rmu s;(0altnifciytlm  anei ()seuoxmpiydaptemfctasfartaxr ;o4opeoif3iys s eau p (4texrmr3io1oa  anei;s0 2xrxo oudal  mnetls aDumumonu4oeen oeiatfaDul( snu)aetomr io1la  lneils  rtrio iu4alte nctl()sDtmurooo1tpxn fctasfaDum( p;t)aexrmf3ootfp rau o;s srur(mpoodllt  nci (  Duax  ;u4tlx ifctytlm2umn on(4tltrio iotomtelueo;s) ruoxopnudoltnlfvilt)srtru o;u4tlenifciatlmDemnmonu0 lxomoctatfa  aneo t seur(o3nydamt mieia(f Duau  oo1opt  fetltlmDelnms (0 eerxf3iadfp e ueol(0 rxmir3oudoltnlnesl()arrr(mpnu4tltn ieild a2rln s ()trtomf3oy1fa eau ilt t2umxo3no4am emfvsat) ruaump;t4oeeomfciltfs2rmnvont)aeenir ia1oat anvi;()trur(o3oy4lle mfei (f Drr( onu4olenmfciytlsDulums t0tltomf oytla   uei t)srumxr3oo4ale  fesa( s2ra(mono4tpt mi3tadfm raump;u)tleoxo3oytfpDeanvs t0s2xo(rpio1lle mivi t)a2rrurpoo1tleoiieiysls elnvonu)tetrmo oa1omtrau olt  etoio3nydlpee fcsls)s2rr(ro;o4tlx if3iyt mDelnmp;t0 rtrmrctotoatraies s)setm(o3nydlptemfesls)a2trum ;o0oet  oeiatfsDumnms u) lxomr3oytopDe nesls)sexo(mpny1oltemietatfsrrm( p;t4olx  o3ilsfaDrlnvp u)aexrif3oydoaD an s;() 2toxrpnu4lmtnmnesls sDtrur ;o0apx mociad a uau o (0tetnxf3iydlpDelivo;t teurxm3oydol  lfciatfa2uau oot0aet  fctadlsDrau o t4 eenifcoydoa r ues s0 2xrio3ou4alt mnci s) Dtmumpot4tpe moetyt a ua(vpn(4 rtrircio1latrliei s0srxm(m3no4lp nmnci t arururono1tpx  oeiyd s2ua(vp;() lxriociytlatrlu o t)texr(o3nu4lpeemnviatfa2rm(rp;u0oeenmiciatfaDra(mpnu4trtoxo3oa1oat ai s;()seurimpnodlme mieias)artr(r ou0tlx mictad a2rlnvs u) rtoifcoodlatr i s t) rxoio3oy1ape lncia( s2ua( oot4opeomieiyd m umnmont4artrxocoydopDr u i s)trurxr3iy4lpe mfetls  2rm(  ou1tpx mictldlsDrm( o u0arxnif iadop eaivol(0t2xmxm3oy4om nliviat aDurxm ;o1aetnmf3tysfa ean snt0 reomr iytlm rlivs;()srtoxmpou4olt licil(fs2taxmp;u4alx  ictltls2ranvsnu4tltnmr3tatoa e nvo;( setoxr3no1apeemncilt)srrr(ront4oetomo3ilslsDul( o;t0trermo3iy1fateluvo;s  2trxrpoy4alte nctlsf rrax  ;u4teeoioeiadlm elnvont) etnxf3tatop rln s;t  rumio nu4lmte fvtatfaDrrumpoo4apto oeiyslm2rl(vont0arxriocootlm  lieo (0 2um(o3iu4op elfvs t)s2rr(m no0tet mf3iat m2em(ms;t4 rxomrctotoa raueo;(0srtm(opiy4lpe  iciat s2ur(  nu1oeen ictat mDra( s;u0alermo oodla e iei (  2trxo3oy1apt lneia( srrrxro;u1oleomi3iys s uaump;t0arenmf3oydopt aueil( srxoxr3oy1omt  nctls  Dua(rp;u0aetoif3iyd s2uanmo;u)teerxr3oo1optelnvo;(0 2ur(opiudapen fcs t)sDurx p;u4tpx mfciytla um( s;()trxoxrcto1omt  ivils s2um(r3oudlpeemfvi s)s2tmx ont4tleoioetadlm2ua(vonu4alxnxfcoadlaDraiesls sexrxm3iy4ll nmnciasfartrx p;t4ape mictadlaDra(mont0 eeoif3ia1omteln s t  ruoimpiudlm elieia( s2ra(m ;u1aee ioctyt m rl(vsnu0teerircootfm  liei;s)sexr(r3iy1apt  ies () rtrxmpno4alxnifeiydfsDuanvp;u4altnio ta1fpDe nes;()teto(m3nu1lm  livsa( aDuaumo;t1ole mfciltlmDranmp () etnxocoa1omt au i;( setmxm nudapenlnesa( s2rr(  no1oltomictydlm2uauvonu4tlxnxo3oadoaD  i o t trurxo nu4ll emietasfsDra( pnt0oetnmoeildfm rmn p (0 reoif3iadfmD anes t0s2xm(rpnu4omtnliviatfs2urxrpou4apxniociltfa emuvo;t4artomfctotlm rlu s s t2to(mpny4aptelicsls) rurum ;t4ape ioetytlmDumuvo;(0tlermfciadlpDrluvsl( setmxrpoudoptnmfet s)sDrmxrpot1tpe if3iyd mDrmnmsn(4aeerxf iytfpDe u o s tetrxo3oodlpt mnvt s)artm(rpot4oltnmiciys s2rmn s;u4alxrxo3oodopD lu s;s)t2ur(o3ny1lm   ivtls) 2truronu4tex  feild s2eau o u4tlxrmf ta1omteln i s  rtoxopiu1om e ivt s)s2ua(mpnu0oltomfctytfa ua(vpnt0trtoir to1omt lies;( texr(opio4olen fes s  Dumur no4opxnioeiasla eln s;t4 rtnmo3ta1fat luvs;s srxrxo3iu1lpeelnci () 2uaumo;u4oetniieilslm2eaumo;u0artrmr3tadfmDe n i;( setoxo no1alenlncilt) 2tmx  ot1tptoioeilsfs2uau o u4tlxrmocta1fmtrlueslt0 ruo(m io4apt lfet tfsrur(  nu0ape ifciyd aDumn o;(4aexoircoodfpt aieo;s  exrim no1aptemncils a2ra( o;t1apto fctatlm emu p;t)arxomrciydfm elneilt sexmio3nudoptelfvils) 2rmurpoo4oeen oeiytfsDrmnvs;(4 reoif iodoptrlueolt t2uo(m no1op  livsls  Drm( p;u4tet  ociasla2rmu pn(0tlxrio3iodfpD luvilt)sexm(mpnu1lmt livsat  Dtm( pnt4tpt mf3tyt s eau o;t4tlxrif iatlaD au o s  rurxr iy1om elieslsfsruaumont1tpxn o3ild m2uauvpnt)tlenxr ootlpDe i s ( s2tmxrpiu4lle lfvtl(fa2um(ro;u4tex  o3tyslm2rm(mp u)tetnxf iodlpDe neil(0s2uoxopiy1olt  icsa( srum( pou4oeenii3tadfs uanmo t0trenir io1lm r n ils  exm(r3io1lpe mfvslt  Drmxr oo0teto oeiatls2uln s t0aeeoxfctydlaD ai olt0 ruo(mpou1lme liet s  rrau ont4aeen i3iydlmDem(mp ()arxoir3to1faDe ueo ( srxm(r3oo4llenlietl()sDur(mpnu1ope  ietydla uan p t) eerif3iytoat aues t t2urimpio1amtn ictas  rtmumont4opxnmfciadfa eau pnu0aetoio oo1op elieo t) rxr(o iy4llte nes sf rua(mp;u4oltniieiytfaDra(vont4aeeoir3tadfmDeai o;t  2trio3nudoltn fei t)arta(  ;t4tltnio3tasfaDuanvs;u)tltnio iotfm rlieo ()seur(m3iu4omt  ici sfsrraxroot0teeo octadfmDum(vs (0aeenmociodlatelnvsls0s2uoirpou1lmtnmnvi ( a2rmxr nu1opxo fciltfm uln s (4alxnmf3iatfaD  ivo (0 ruoxr oy1om nmfeiasfarur(roou1tex iictys mDeaumon(4aexrif3iydfm e ivol(0tetm(o ny4om e feiat  2ra(mo;u4alx mictld sDeluvo;u0 eermo3ia1fa rln i t seum(m nydomtelfvils)sDumu  no1tpeoioeildlsDul(ms t4 exomo3oa1laDr ies s0setrxopnydlpe lictasfsDurum ot0tee  fciasls2raumo;(4treoxf tatfmDeln i ()texoxrpnodol  lnct (fartaxm nt0tpen fciadla2rlnvo (0aeeoxr iatlptrln o t0seurxrpoy1op nmiei t  rtmu  ot4apxo fciatfmDrlnvpn() lxrxr3tadlpt luvi s0tetrim io1lpt lfvtas arraumo;t0olenmociysla rlu p u)arenxo3oa1oaDe nvi ( s2xrir oy1lptnmfetasfaDtrxrpot1apenifctytfa ra(vo;(4altnxocta1la rli i s s2urxm3oodlmtelfctls  2ua(rpou4aptomoetlsfa uan s t)altomocta1lm  lu i;s)sexr(o ny4lltnlnetlsfarua(mooo4aptoifetls m2rl(vpnu0trxoir3oodfpD  nvs (0sexoio3oo4ll e ivtls  Draxmpnu0oleo ictyt s2ulumo (4altrxo oodfateauvi;()truoimpnudole  nvi s) rur(mp;o0tetnif3iatlaDulu p;u4trxnir3tydlmDe uvs s0tetmxo3oydolte fctls srrr(  no4aetnmietysls2rmnmonu)tlxrxrcoadoa rln ils seto(m3iudamtnlfcil(  2trxrpno1oeen fciyd m em( pn() leoircoodfm   ueols  2xrxo nydope lfvilt)arur( ono1tltomi3tas sDemn o;u0aeermocoytlm rlu o;( srxr(o3io1om n nvia()s2taxrp;o4apx  f3iydfm rlnmsn() lerxocia1opt aivsl(0seuoxm3ny4ll n ictlsf Dumxmonu1tetomfcilt a el(vp u)areoifctytlpDran o s)sruoirpiudlltnlfeiat artmxronu0olt  ieias m ul(vpn(4trxrir3todom  luei;(0 eurimpiy1olt lnvt t  Dra(r ;u1tpxoifctyd sDumu o;t) etomo tadopDe i i t tetrxm iy4optn net ()sDrmxrpno0tpe moetlt s ean p u4 exnmr3oadoa e ivi;( trtoiopnu4aleelicia() 2rmxmpno0apeoifetysfs em(mont)tlxnmr3ty1om ean s t)s2xm(rpoo4lleelnvtat sDurxro;t1altoioetydfm2rl( s;u)arxnif3oy1faDe u olt0 exm(opno1omt  fes ()arurum ;o4aeeo ieiysls2el(msn(4alerxr iadoa eauvi;s0sexr(rpno4apeelfvsasfarta( pou1alxniieias s2umn s;u4tltnio oatopt lies;t0 eumir iodomt lncs s sDrmxrpnt4opxnmo3ilsfs2ul(vo u4 ltrxf oadfm eauei (0 ruoiopno1apenmfci ( sDtrur ;u4apxnmietasla ranmpnu4texnmrciytfpDrlu o;t  2tm(mpnu1amte feilt)sruru  ot0oex iociatfmDelumpnu) rxnir3iytlm r uei (0 2xoim ou4lptnmfcsas a2ta(r oo4aex mo3iysfa2um(vs;u)areniociotopt  ues t)t2ur(mpou4opeelfvtlt a2ua( oou4aexo feiyd mDelnms;()aexoxo iodlpDr n ilt) rto(m oodapt  fet () 2raumo;u4apxomfeiydfm umn s (4trermfcta1oat auvol( trxmim nudlmt mnvslt)arua(  no0ope  feiadls2ulnmpnt)trtnxr oytfatelieo;(0srtriopou1ame livi s srrmu  ;u4oeeomociltfsDrlnvs;(4artrmr3iatlatrliei (0tetr(o3no1llenmieiatfaDrr(mo;t4olt ifcild a rlumsnt0 etrmr ia1lm eanvo s0setm(o3oudlmt  iesas  2rrurpot4aeto fctadfm rmnvs;t0aexnmfcoytlpt  ivols0 etmim nydole lici s)srtmu oou0apxomo3tltfsDrmnmpnu4 reoxf3todla r i o s  ruo(o3nydamte fcs tfs2tm(r no0oeeoif3tasfa2ra( on(4alenio3oa1fp rliesls) rtrxm3oudome mfeiasfsruau pnu1tpt iociytlm2uan ont0tlenirctytlat  nvi;()t2tmim3nodam   fvta() rum( onu0oexnmfctytfs rmuvp u4 ltnxr3oytfpD lu il(  euriopnodopt lfesls s2ta( o;o1tltomfeilsfsDrmnvpnt0arenmr iydfmDran o s s2um(r nudlm   icslt  rta(  ;o0teen icias a uauvpnt0tlerir3tytlm e nesls0texmxrpnu4ome licsasfaDrrumpoo0tee ioctydlm2rmnvs;u0aeermfctydfm  lieo s) eurxm ou1lpe micsls)aDraumo;o0oleomieildfm rl( s t0tleoxo3oy1lateaivi;t t2uoim3io1ome mneil(fsDrm(mo;t4aexnmo3iltfm ran snt) exrxo ty1lm  li il(0teurxr3iu1omteliviatfa2tmu  ;t4tlxoifcildfa eluvp;t0tetomo3iydoa rauvo s)sruoxo ny4ome mfet ( aDtr(  ot1oetnii3tasls rmn o (0altrmf oadlm eln olt) rtm(r3nydlme  fcilsfa2tm(rooo0altoiietydfa2el(vo (4tltrifciy1fptraivsls0 eur(r io4op emncilt)a2ra(r ;t1olx mociadlaDrmump;() lxoxo ia1fmDrau o;( trtoim3oy1al  mfvtltf 2rrxm ;o0apxo icildfm emn s;u0areoio oadoa   i i;(0setrxr oy1lm emicslsf rrau  no4altn o3tad m eluvp u0 lerio ia1fptr uei s)t2uoio3io4lp n ici s) Dta(moot4oetoifetatlmDul(mo;t4aetnxr3tydomtrlues;s0 rxoxrpiydlmtnlict sfaDurum oo1tpto fetatfa ra( o;u)tltrmf3ta1lp  lnvo;s  2xo(rpno1optnlnvs (fsDtmx ooo1tex iocilsls rmu snt0tltomociy1lmDraivolt teto(m3io1om n fcta(fsrur(mp;t1tet if3tlt s ra(mo;(4 exoxr3todopt auei;s0s2xm(m3oy4aleemictls aDtm(mono4tee mfeilt mDum(mp t4tltnio ootomDe u o s  rxoxopoy4lleelnvi t)sDurur ot0oetnmociys s ul( sn(4trtrxo3oa1op  aiei s)t2to(o nodale livslt)aDraurp;u0tpeomi3tytlm2ulnmo;u)tltoif oatfp  aivilt)trum(opio1omeemicsls  rtmxroou4oexomi3iys a2eanvo u4texnxfcootla   ueo s  2trirpoodomtemfeil(  2tr(m nu0alt moeiaslm2emnmp t4 eerir3iotfaD lnei t0trtmxmpoo1omtnlncslsf Dua( p;t0oetnmfciadlmDrmu pn(0tlxoxr3todoatrlivols t2xrxopiudll  mict (  rraxro;o4texo o3ildls2umu s u)tetoxr iadfaDe nes s seumxmpiodlpenlivi s artmxm nu0oltn f3tydfm2eln o;(0tltoxf tytoat lu ol()s2xrxopoy4amenlivilt  2trxm nu0aet  i3iysfsDua(mp;t4tleoxf3iatop eau sls)teuoiopnudal n fvsl(fsrtrump;u4oetoif3iltfa2eanmp t0tlxoiocoa1optrlnvsl(0 etrxmpoy1lme mfctls) 2rmxm oo0tet  o3iad s2uluvo;t)trxnircoodoat aivols)trxoio oy4amtn fvslt  2rm( pnt4aexn feildfa2uln pnu4artoxfcta1lp  auvs t0t2ur(r iu4olt liviltfs2rru o;u4tptnioetasfa2rmu snt0aexoir iotopt an i;s  euo(o ou1apenlivt s)srtm(  ;o4alenmf3tldfaDumump;t4altnir3ty1fmt aieol()s2trxmpny1op e netl( s2tmxmpoo0tpt mi3tadlmDrlu o;(4trenmr todoaD  n ol(0 etoxo iudom elicsl(  Drr(moot4aleo fcias a ea(mo t0trtoxr iotomteaieo t)s2umxm ny4al  mnvtas srtmum nu4aexnmictasls uanmp;u4alxrir iy1lp  lues s  ruoim ny4apen nvs ( srrru o;o1teenioeiydfaDuanvp;t4tlxrifciadlm  au ol(0 etrxo3oydlp elicsasfarraxronu0optoio3tld s el(mpn()trxoifcoydoateluvo;s t2toim3iy4lmen fvtl(fs2ua( poo1olxo oeiasfa ua(vo;(4 lenmo iotoa rlnei;t0 rxo(m3iu1ap emnvsasfsrur(mo;u1apeo i3iydfm2rauvs;u4 etrir ta1omDr ues;() 2ur(o3oo4am emivi t s2trxrpot1ope  o3iatlm rm( snt0 exomo3ia1lateln i;s)teuo(r nu4am nlneslt)s2rrxmp;u1tetomiciatfaDrm(mo u4 rxrxr3iotlmDeliei;( s2xoxm3ny4oleemfcias srtaxm ou0teeoio3iadfs2umuvpn() ltoxocoydlm  luvs t  2toirpio1omte fvtl(  2umx  ;u4oet mietyt m emnvs u)tltnxociatlat  u o t  etr(r3no1oltelnctas)a2trx pno0apt micias sDum(msnu)aexnxoctodlmte u i s)teurxmpoudlp nmfvsat)aDuau oou4aexoio3iatla emnmpn(0altnmrciytomt lnvslt)setoimpou1apeelncilt)sruau  oo0optoifeiltls emn p (4 rxnmrctatfmDean s t teurxo oy1llte fcs ()s2rm(ro;o4olxo ietadfm elnmo t)tlxnxrciy1opt lies;(0tetmir3iudlp  lnet ( srta( pou4olxnmi3tyd s rlu s;()tltoio iodoaDrlnvs;s0texoim3oudopeemfvsasfa2urxr nu4tpen o3tat s2em(mont) rtnxfciytomtrlu s (  2to(rpiydop n iesls)aDtr(mpno0apx ifetlsfsDeanvo u0tleoioctadlpDe n o;t0setoxopiodomtemnvsltf rraxrp;u1apeo ociyd s2eaumon(4 exrir oytopte ivil(  2xmir3iu1ale mncs sfaDta(r ot4aeeoiictld m2uau onu0tltoxrcoo1la  lnvi;s)srtmxrpoo4lmeelncsas srum(moou0aptomociydfs ulumpnt)alxoxo iotoptran s t  2trxmpno4lme  ivsltf 2tmx o;u1aex iieildlm2um( p t4texoxr3totlmte uvi ( sruoim3no1alt livi s srtmurpot4apeo ociyd s2rm( sn() leoir iy1oa r uvs;t  rxoxm io1llt  fetl(f 2umx  ot0oex  icildfa2uauvp;u0artnxf3iotomte u s;s0 2urxo oy4lptnmiet ()s2ra(  no1aexn octytfs eanvp (4 etrir3ta1omt  i o s0 2tr(opoy4alt  nvsat)a2rmxm nt4tltnmfciasfa umump u4altnio io1faDeluvols  eurxo oy4ome mivs sfs2uau oou1tlt mfciyt aDra(vp () etrif3oydla  liesls) rxm(r iodlptnmnei () Duaxrpnu1oexoio3iydfs2uanvs u0aexnmo3oa1fa r nes;(0t2xo(rpiodal emictl( srrm(  ;t0ale  i3tysfa2um( s;(0 etomf iatfmt  neslt0 exoxmpnu1omt lfctlt)a2umu  ;o4olt  ociys s rlu p t4teerif iytfaD  ueilt)t2um(rpnu1omtnmncsl() Dtau pot0oetn oeiydfs uluvo;()trtrio tatoaD aneo s srxmim3no4opt lfctlsfa2rr( o;o1apt  o3tlslaDrlnmo;u)arxnif3iydlmD an i;s t2toxopiy4om emfviat  2uau  ou1alt  f3iyd m ranvon()trtomocoy1lmtranvsls)trtoir io1lmtelfcs ( srtmxm ;u1alxoio3ildfm el(vo u4 renxr3totfpD  neilt0trxm(r3oydlmenmfciatfsDrmxrp;u0teen i3iltfsDuaumo u) eenio3tatoa rlu ilt0t2uoxo3iy1omtelfesl( aDua(mpnt0tleomo3ild m emu o ()trtomfcoodlaD aies;t srxoio3iy1apt mnvilt s2ta(rooo4tltomietytlsDuauvs t0 exrirciotlm elnvs;s)s2xrirpiy4llt mneil(  rumxront0opx  ietatla2rm(ms;t)tlxnir oatoate nes;() rtmxm io4ome mfet t) Drr(moou0alt  o3iasfa rmn pnu)aexnio iotomDrli ilt)trtr(r iudale liei (fsDrmum ot1texnifetaslaDum( onu0 exrxr3io1fmtran i;t)setr(r io4ll nlncil(fs2ur(mono1tpxo ociad m ulu s;() etoxf iy1lat  u i t t2toxo iy4llee fct ()aDuru onu1oeen o3iasls2rm( s;(0tetrio3oo1omD lnei;s0seto(rpio1lpte nvi tfa2uaur no0opxnmictldfa2ul( o u4 rtoxr tatfm rlivo;(0srxoim3oy1apeelici ( a2tmu  nu0tptnmoeiltfmDeaumpnu)teenxr3iytoate ies s0 exrxo ou4lle  nci sfartm(mpoo0aeen ociydls el( o;t4trxnmfciodfmtr nes t)sruo(r3io4op nmnetls  rtm(mp;t0tee iieiydlmDel(msnu0arermf oatfp rlnes s  rtmxm nu1ol  miei (fsrrm(rpnt0olenio3iytfm2eln on(0aeenmr3iydfaDe ueolt)sruoxrpiydal e ivils aDumu pnu4tpt mi3iys m2emnmo;() rxnxr3to1fm  lu i;()srxr(r3ny1amte fctatfa2rmxrono4alxoifeiltfaDeanmp;(4alxnxf3ty1op eli i;s sexrxo3iudal e fvi (f Dtru  ot0alto f3iadfm elu o;() etrmr totlaDeluvi (0srxoiopoodol nlnctlsfaDtrx oou1aptn ietys aDul( o;u)aeermr oytopte ies;s)s2tmxr io1ope  icslsfartaumpno1teen ociyt m rm( pnt4tltnmr iytfa e nvil() 2tm(o3no4omenlivtltf 2ra(mooo4oexnmo3iytfm2ul(ms (4arxoxr oydoat  neols texm(opoydlm nmicil(f 2rmur no1aex mfeiltfsDem( o t0trermr iadlp e ivo;t) etr(opoy4apen fetatfaDtr(m ou1olxo fciatlaDelnvont4 eeoifcoatoate ivslt  2uo(mpoodlme mivtl(fa2rmx  ot4tee  feilt m2rmu pnt)aexoxr3oadfpt lneol(0teurimpio1op   feia()a2rrx  ;t4tltoiieiadlaDemnvp t)arxnmr oatlpDrli i ( texrxo3iudaptemfetas  2rrum ;u4oex  fciyd s elnvo (4 reniociytoa  li o t)sexr(mpiy4alt mfcsl( sDrm(rpoo1ape  f3iat mDelu s;(4 exoiocia1omte n ils0trum(m3iodamee fci t sruau ooo1olx iietat m el(vp t4arxniociatom e ieo;t0 rumxmpiudale lfcta(fsDur(  ;t0olxnmi3tltfmDum(vo ()arxrxo3iydfpDrlies () ruo(mpnudomt  ictlt  Dua(m oo1apt  ociysls2emnvpn() etoxfciadoa r ieils0 exmxo ny4lmee nct s)s2umxmpot4tlx mf3iatla umnms;(0treoxo tadlmD lneo t) rxm(r nu4llenlfctltfsDrrurono0oeeoif3iadls2ua( p;t4 ltoxf oa1fptranvs;( trxrxopno4amt mnet sf 2rmurp;u1tpeo fctasls2uanvp;u4trxnxr3oatfmteaneo;(0 exoxm iu4oltnmncilt) Dta(rpno0tptnmfeiysfs2rauvp t) lxnmr3oodopDeau ols  exrir3iodopeelivsa()a2rmxr nt1oeto ieiyd m umuvs t0 rxoif3tadfaDr nes s)seuoim ny4olt  fes s) rumxmo;u4open ietlslaDeauvpnu4aleoxr3totomt lieols0trtm(opiy1llen ivs tfs2ra( o;t1alx  f3ildla rln s () lxnir totopt  nvs;(  2xmio3ou4lpe lneia(fsrrm( p;t1alxo ictlt s2um(mont4tetoio oy1laD  uvi;t) 2ur(m ou1ll elicta()aDtmu o;o1alxn iciasls ea(mp;(4 renxo3iy1lp  li il( trurio oy1apt lnvt ( s2tr(r nu4alt ii3ils sDeln p t4 eerxociotoaDraneils trxo(opoudoptelnciasfarrmxm nu0olxoiieiatla uln snt0 ltrmr3iodfmD liei;s0sexoio iydoptnlncsa(f 2tm(r no0tltn feiasfa umnvp;t4tetoxr3ia1fmt livs;s0sexrir3oodam e fei t)artrx poo4ale  i3tltlaDeluvs;u0 lxnir3oydoaDeluvsls  rtrim nudlmee ncil(  2urumpoo4apxniietysfm em( s;u4texnxo3iotom  auvi;s)seurxrpou1llt lfetl()srrrur oo4alenmo3iasfm ran pnu0tetnmocoytlptraneo ()srxmxm3nodal elfciat) 2ur( p;u1oetnmieiydfm umuvo () eeoiociatlaDrln il( setmio oudamtnmnvi (f Dtmxmo;u4tltnmf3iadfmDum(vp u4tetomo3ty1laD  uei (  ruriopiy1lpeelfesl() Dtaxmpno4aetnmi3iydfmDeauvpn(0altrir ia1fa eau sl(  rxoxm iy4ll n fes (f 2rrumono4oltoii3iasls emu sn(0teenxr3io1fa  auesls) 2tm(m iudlpenlfeils)s2ra(  ot4olx if3iltlmDean snt)aexnirctytlmDraiei;t) rtoxr3iy4lme lfcsl()artmu onu0opx ioeiadls rau o;u0tlerxf iydfa r u o;s seuo(m nudapenmfvi sfa2tmx oot0altn o3ild mDelu sn()teeoifctytfmDe ies;( t2xr(r oodlmtelnvils s2taumpoo4apto oeiltls el(mont4 reoxr to1laD aneo (  exr(r iudaleemnvt s  2rmxroot1aptn oetytfmDem(vp;u4arerif3to1fm rlu o;(0srto(o3oy1optemivils)s2tax  ;u1oexo ictys s2ua(mo;t0 leomf tytomtr uvi;t) 2xm(opou1llenmfetlsfarrax oot1tpe iictat s ea(vp;u0aetomfcoytlatelieo;t  euo(rpny1omt  ncs s) Drr(ro;t0apxoifetas s emu p (4 rtrio oo1lp rluvol(0 exmxmpiy4apt lnvslt) rta( onu1aeenmociydlsDrln s (4 eermocoodfp r nesl()seurim3oo4ap elicslt a2ur( o;u0aee mieiydla2ulnmo;u)arxomr3oydlmDelueil(0srur(o3io4lptemietlt a2umxmpnt0aet moeiadfa2rauvo;t) ltnmocoadfmDrli s ()s2uoxr iy4lltn nctasf Drrur ot0tle  fcildfa umn pnu) lxrioctatfpDeaueolt) eum(mpnudlltemneiltfsDrmumpnu0tlto ieild sDrlu s;u) rtnmo iatomteanvol(0 exmim nodapte neias) 2rm(  ;t0olt ii3tldfm rau p u4teerio oadoaDeaiesls)setrxmpno4oleemnct ()sDrmu pot1opxoii3tytlsDrmnmont0tltoxr ty1fptr nvs s seuo(rpoudamee fviat) rra(  nt4alt  f3ias mDuan s (0aexomf3io1opteai sls0trxr(o nodam nmneil( aDrax  ;o1aee  feils s2rlump u4 exnmo3oy1om  lneols  exmxm3io4al nlncsl()s2rmxmpot0alxoiieiyt a2el(ms (4 rxoxf iatfm r u s;(0s2xrxopno4om   fcs sf 2trx ooo1oeenmfeiys s eanms;t)altomoctydfateluvi;t) 2uo(mpio1lp nlici t  rrmxronu0aetn fciytla2elnvp u4tltrir3iotom rau s;s0 eumxm3iudap n icilt) rrmumpoo0alt  f3iytfm em(mp;t0areriocoatlm  au o;t0 rxmxopou1lmeelnetls)a2rmx ono4openioeiysfm elnms;t4tetoirciodla rlu s ( srtoio io1lm n ict ()srumu  nt0oexnmociasfs em( s u)treoxrciatfpte n s ( s2xmxrpiu1amte iciasfarrax o;t4olenmieiatlsDrm( p (0 renmf3oadla rln olt)sexoxm ou4apen feslsfaDrr(rpnu0tpt iieils m2raumpn(4aeermr oadfmDe iei (0 2xoio3nodlpe lics tfs2ra( oot4aptnmoctls m ulu o t0 eeoifcia1fptr ueo (0srtr(rpnu4omt lnvs t)aDurxmpoo4apenio3ils sDel(mp (0alxomf3ootfptraieo;t  2tm(m3iydape mnctas aDra( pot1tee iieiadls2eanmpn(4 eeoxf3oa1oaD ln ols s2tr(o iodal  mietltfsDrrx o;o4tpxnmf3tysfm2ua(vs u4teeomf3oo1lpD luvolt) eurimpnydom e nesl() Drmx p;t0apen i3iadfaDum(mp u)tltrxrcoo1lp eaueo () etmio ou4lp nmiesltf 2uaur ;o1tex  ieils aDeluvsnt4alerifctadlpD  n o t0 eur(opny4ol emicsls) 2trum no0tpx  ieiadfm2um(ms t)arxnif oatfptr uvo;s)sexoiopiudlm nmfvt tf 2ur(  nu0apeo ieilslaDem( snu)aexnirciatlp rln i;t0 etoim3ou4amtemictatfsrra(m oo1tlenio3iad s el(vs;(0 eermf iadlateluei t  2tmiopoy4omtnmfeia( s2taxmpou4oetn o3tas mDrlnvp (0trenif3iy1omDr nvi;t)trtrio3nudlpe lfesls a2trurp;u1tet io3tls sDrm(mp (4aetrxociydoa rau s t) 2trxr3iu1altelnvt tfsDra( ont1tlenifciat mDulnvp (0 rxnxf3oodfpte i i;s  rur(o no1am   nctl(fsrua(ro;o1tlxniictldlm rmnvs t0arxrif3iytlptean s;( s2tr(mpnydaleemfeilsfsDtrxro;t1alx  fctadfa2umn p (4 ltnxrctadomt lies;s)trtr(o ny4lp nmnvia(fa2rr(mont4oexoii3iydlsDumn snu4arxrmrciadomDelivo;t) etmir io1ape  ies tfartrx ont1opeo fctlsfa2uanvont)tltomf todoa ranei;s0 exoxr3nodalt  nct s)srrmxm nt0aex mo3iatfaDelu s;()alermfctotlmtranvo t t2xmimpio1apenlicsltfsrtmu ooo0olxnmociysfa2ea(vp;u) ltnxoctotfp rlnei;t0t2triopio1al   fvtls  2umu  ou4tlx  fctltfaDua(vp u)alxnxr3tatlp e ueolt)s2xmir3oydlm  mivtas  rrr(m oo4apx  ociydfaDrlu pnt0 ltnif3iydopDeaivo;s0sexmxo3ny4ale lncta(  Dtmu pnt1ale  fctysfm2eln o u0aexrmo ty1lmte ueo;t  etr(opiy4alt licilt arur(root1aet ioetyd m2uluvp;t4 ltoxf oatlmt  neo ()teuoim3oy1al  micta(fsrua(  ;u4openmfeiydfs2uanvpn() renxrcoadlm rlnvi s trtr(r nodol e fcsas srtau pou0aee mf3tas s uluvs u)trtnmo3io1fmteluei;t0trtoxr io4omt  ncta(f Drmump;u1altoio3iydfmDemuvon(4tlxrmfcoadlmtelneol()t2xrxrpiudamee nvia(f 2tr(rpnt4aexnifeildla2em(vo u4arxomfcto1lm   neolt0srumimpoo1ll nlfvt s  2rrumpno4optomfetltlmDem(ms u)arenxr3oadopte iesl( teurxo iodapeemfeiatf 2rmx p;t4oet iictldfsDumnvon(0 eeoxo iatomtrli s;s)tetr(mpiu4omee ietat)a2rrx  no0oee mo3tad m2uaums u0texoiocty1fpDranesls0 rtr(o3oo4lmtnlivi (f Dur( pot0oex  o3tatla2ul(mp (4altrio3ta1fm e uvsls)s2xoxmpoydomt lieiltfaDurur ;u0apeomoctyt a2el(mp u)tetrmf3ootlaDe u ilt0trtrxo nu4aptemneias aDtr(ront1tltoiictytfaDrmnmp;t4teeoifciydlatr ivi s0 2ur(m3oo1op  mnvtltf rrr(moou0oetoifeias mDumuvp u)tlxrxo3iydop e ueols)truoxo3nu4ome  iesatfsDtmx  ;t0opeoif3tyd sDem( snu0tetoif iodoa eluesls  rtmxmpny4am nmnvi ()srurumonu4opxn fctydfs2rlums t4texnio oodfmDe iei;s)srxm(m3iu4op  lnesat aDrrxmo;o4teeomictldlm2rlnvsn()tetrxr3ty1fpDe ueils)t2tmio nydopeemiei t)arrr(r ;u4teeomfeiytlm uan p;() rxrxo oatlpDeln i s  rxr(rpiodap  mivslt s2rmxro;o0tlx mi3iaslm ulnms;t0trxrxr3tatlm   n olt  rurxr io1ape lfvi t)aDumx onu4oet mfeiyt m2rluvp;u0arxnmfctatoptrlnvsl( trxoxopnu4opee fvt (fartr(r nu1tleoif3iysfmDemn s;t)alxrio3oydoatrlnei;t0 exoxm3nu4al  mnetasfarra(rpnu0tex io3ias mDulums u) exoir3iy1fpD aueo;(0texriopno4lmt lici t  rra( pno4aetnmieiytfm2rauvp ()aetoir3iy1oaD  ues t) etrir nydom n netasfaDururpnu4aet  ieiltfm rlu s (0 leoifcoytlm eanei;s setoio nodolt lfvt tfaDtm(mp;u1alxnii3tys a2rlums t0 etoxr oo1la elnvols t2xoimpio1amt  nvtlt srrr(  no1oee ifcias mDum(vs;u) rtnxf iatla r n olt0srur(o io4apeemfet ( arurx  ;t4ope  i3iatfs eln o;u)artnmr iatomte uvsls0trtm(m3iu1aleelnci t artaxr oo0tex  ieilt a em(vo u4tltrmr3ty1fmDraues s) rurxo3ny1lltn ieiatfaDurxr ot1tee iocild mDem(vs t4 rxnxf ia1la  lueo;t0seuoxmpiodlpen fet t srrmu o;u0tlxo f3iat s2ea(mp u0arermo io1oaD  ivsls0 exrxo oydamtnmnvsas)a2tm(roou1oetoio3ilsfa ul(vp;()aetrir3iydfaDeluvi s0srxoxr3iy4ap   fvsltfarumx ono4tlxomieiasfa rl( p (0teenmr3oy1lm   ieslt  rxmirpnodom elnci t) rurump;u4teeoifciys aDem(vsnu)trtrif oatlmt  n o;t0t2xm(m3iudll  mfvi sfaDuaxm ou4aleoifeilsla ean o ()tltrmrcoadomDrlivsls) rxo(r3ny1lme  ncslsfa2rmum ;o0olt mfeiltlsDrmnvs u4teeomociydoaDrlieo t) eto(rpoy4amte nes (  2raump;t1aeeoif3tlsla2uauvpnt0texoxociotomD auvilt)srxoir3iydlpenmfctl(f Dum( ooo0tpxnmiciatlmDrauvo ()aleomrctatop eaneo;t0t2umio nydom nlieiltf 2umuronu0oexnio3tys a rm( o ()altnmf3iy1optelies;s)texm(m3iu1optemfvs s)srrmxrpoo4aptoiietysfm2emnvs u4trtomf io1fp   u i;t0t2um(o3nu1optnlnvsls)arurx  no4opeomociadfs2rluvonu0 lenxo iadomtrlues s)trtm(o3oydolenlictas aDtru  ;t1alt ioctatfa umn s (4aexrir ta1oatraneo;s0 2urio3iu4oltnmict s s2uru o;u1tetnmociyd a2eaums;u0aexrmr iytfat  nei;s srxoxr iy1lp   nci s)aDua(mont4aleomiciyslm ul(ms t4arermocoa1op  li o;s t2trxo3ou1alenlfvta() 2rmxr ot4oetomociyslm2uluvont0tltrmf iotlpt lieil(0t2xmir nudopee fctat  Dumx  nt1tpxoifcild sDem(mo;(4tetnxocoadoaDeli ilt srurxmpoydamt  nvia( aDurumpnu4alto iciad s uaump;t4 lxomr tydlmtran o;s)sexrio io4olenmfei ()s2uru  ;t1tet iietyslmDua( s;(4altnircoatfatrlieo;s s2toir3oo4ale livtls)srrau  ;o0tltnio3iysls2em( p;(4 etomf3oydomDe ivo t s2xm(m iy1ap e fetlt  Dtrxm ot4tlxomfeildlm2ean p;t4tltnircoatfmtean i s0trtrxrpoy1ap nlnetls artru pno4ole  fctldlsDul( o (4treoxf3todlaDraies ( setm(m3nudapenlfctlsf ruaur nt1olxoii3iadfa2uln p (0 lermo3tydlaDeanesls s2tmxo3oy4lm  mncias  rtaxrp;o1aeto ictasfsDua(mo u4 rtomo3iadfa  aueo (0srurxr3iu1ape  fctas artaxro;o4oexomo3ild a2uluvs;(4 lermfcoatfpt lu s;t0trxo(rpnudlltelnetatfa2rrxmpno0tltomieildlaDrmu s;u0trxomr oatfm e iei s0 2umio3iy1om nlivs t artaxr no0tpeo feiasls2ulu s (4arerxr oadfp elivo ( tetoimpnydome  iesltf 2umxm ou0tpxomf3tltfmDemnvs;t0 etomr3oytfaDr ieol()sruoxrpny1apee fct sf Dum(ronu0olxnmociad sDrlnms;u4artoxo iodfa eaues ( sexo(rpio4lpeemnciasf Dtmu oot4tltomoetat sDua(mo;u)tleomf3oatfmtrlu s;t)s2uoxrpiydam   fcsa()aDuau  nt1aex iictas sDuauvs;t4teeomoctydopteli s ()s2xrxmpnu1alen nesatfaDraxm ;t4aexomoetasfs2ua(vp t4 rtnmr3iydfpte ieo ( srur(m oy1lpen icsa()aDrmuro;u4aexomf3taslsDrln p;u)tlenxf3iadfmD anei s s2uoxm nodlptnlfes t)sDtau  ;t1ope mi3ilslm em( o () eenxfcoo1lp elueo t trxoxr nu4openmietlt arra(rpoo0opeo iciytfs2eau sn(0alerxfctotoa eau ils0seuoio nodolt lfetlt) 2rmu p;u0tltomfctat sDumnvs (4aetrxfciodfp ran i;s setm(r3ny1opte nctls)arurxro;u4alt iociasfm uanmsnt)tlxnmo iatla   n s;t)setmimpiy4amt lfesl(faDuax  ot4tee mfciyd m ulu s;()aeeoif3iadfm e n s;s setmxr3iydlp nmfcs t)a2tmurono4oltnmi3tys a2ranmp u4aeeoxrctodfaDeln s t) 2xoirpiydapeemnctat s2tmx  ot1tlxnifeiltfa el(vonu)aexrxo3oodop eaueo ()s2toxm3oy4ll elivslt arrrum ot1aetomfetas a emnmp t0arerif3iodfaDrlues s)sexrxo3iy1ol nmies ()aDur( p;t1tptnii3ilslsDul( o u4altnxr ta1om   i i (0t2toir3nu4oltelncsa() Dumx o;t0oeenmo3ild m2umnms t)tltrirciadlpDean s s)texrimpiy1ome lfvi s  Drrxmp;u1tltomoeildfmDrmnvp;t) reoxf iytoa   uvolt  2triopnydopenmnci s srrmumpoo1aex ifetadfm rlumsnu4 rtoxr iatlp   n olt s2tmxrpoydoptemfeilt  Dumxr no1aleniiciytfa rmumo;t0 lxoir3oa1fp eluvo t0teuoiopiodal e nes t  rtmxmo;t1tex iietls s ua( p;()tetnmocty1lmDrlivols) eurxrpoudlltnlfvi sfa2ua(  ou1tpxo fetlsfmDra( o ()aetrir3oadoa raueo;() ruo(m io1ll  lfvi (f 2tr(ront4open fetydfm ra(msn() lenio iotfp  lueo (0t2tmir3ou1apt mfcs ( aDrau p;t0altn f3iltlm rm(mp t4artnir todlm  lies s  rxrxrpoo1ol elivsasfa2ta( ooo0aet ioctad m ulnmo u4 rtrxr3tytfaDelivols0s2umxmpiy1ol   fcsa( artmump;u0tpe  o3tad m el(vp t) eermo oy1fptrauvo;(  etoir3ny4omt  nvtl()aruaxm ot4tpenmf3tltls2rauvsn(4 etrmr3iodoaD liei;t  rxrxmpoy1omtnmfvtasfsrtrx p;o1tpxomo3iydlm2emu p;t0tlxnmoctatlmtr uvslt srxo(o3nydamte fcilsf Drau o;u1tetoio3ildfa2eauvp;u0tltnxrciy1fp eaneo t0s2uoiopoy4op e feias  Drax  oo4openmf3iaslaDulu onu)tltnio iytoatrlu olt0 rtoim oudopenmneta()s2ua( oot0tptniieiytlsDrlnvo;u0teeoif3ta1lmte uvsls0t2to(r3iodol  mivta(fa2umu  oo4ole ii3iysfa rlu p;t4alermfcoatfa r n s;t setmir3no1lpenlfvt sf Drmx o;o4texoif3iatfs em(mo;u) lxomf3tydfa  lnei s)srtrim3iodopenmfctlt artaumpnt4tee  i3iadfm2emuvs;u)tetnio3iodlmDe neo (0trxoxm no4amtelfviasfarra(mpnu0ale mictls a eauvon()tetnxo3totfm  lueo;t teumim iodopeeliviat)aDumump;u4tlenif3tadfs2el(msnu4aleoxo3ta1fmteauvs s0setrxo3nydamtemies tfs2tmu o;t0tlenmoetyt s rmumont4tltoircia1fmD livolt) 2uo(m3nudop elicsa(  Drmxro;o0optnifeiad a2rm(mp (4areomr to1fmD aieo;(0tetrim3iu4ame  fet (f rrm( o;o1apxo i3ias a ul(mo;u4tleomrciodfa   ieols0 2xrio no4altnmictlt a2tmurpnu1aex if3iydlm uaumsn(0 rxoxo3to1fp ean i (0 rumir3no1amtnmnci s) Drmu pnt1apeniieiyd sDranmon(4 leoiocta1op raneo () 2um(m3iy1llte ietat) Dua(rpot1oetoioctas sDemump t4altnxf tatlat  ieo t  eumxopoy4lpenmfeil(faDur(ro;t4apt  fctysfmDuln p t0alxrmf oy1fmte uvi s srurxopnydopenmivsa() 2uaxroot1oleniictytfs rlumsnt4treoxr3oadom ean i;s setmxmpnudomeemivtat sDtaxmp;u4tex  feiad m emu p u)texrmfciydopt  uvol() rxoxm3oo1al  miviatfa2trxmpou0alx mo3iytls2ra(vpn(4tltnmo tatom rli i;t0t2xo(m io1ap  miei (farrruro;t1tptnmo3tls a ra( o;t0aeeoio ty1lpDr ivilt trtmxr3iodope mfvsls) Dtaxmonu4olxomicild m um(vs t0areoxoctatoatraieol(0t2umir3oydopeelivtl(fartrurpnt0altnii3ildfa rmu p;() rerxf todfmtelueilt)t2trxmpoo4aptnmfci (fs2tmump;o0tpen f3tys s2el(vs (0texnxo3tytla elnvil()teurxr3iy4omtelfct t aDrr(  ot1tetomicilslm uau p t) etrxociotfatrluvs;() euoxrpiy4lpenliviat srua(m ;t4aleoif3iys sDeaump u0 rxnmfciodom   u i;()t2um(o3oudamenmnetlt  rrrumpnu1oeen ictytfa2ran s;u4tltoxr3ta1fmt ai o (  rtm(o iudapte ivs tf Durxm ou1altomociatfs2raumo;() lxnif3iy1opDeaues;t trumio oy1lpen nci tfs2ua(mooo4tpx  oetlt s2emu p t4aetrmr3ootfat aieil( s2xm(o nodlm elict ()s2rmx  ou4tle mi3ils m uanvonu0trxnifctodfmte neils0tetoio3nu4lpt  ivi (fs2taur nt0olt mi3iadla2eaumo t0 ltnxo oatlpDran i;(0seumxo io4al e iet t) 2rr(  nt4tlxn oetad mDrmnmsn(4 exriocia1fa elueo s teur(m3oodlmenlfct t) rtau onu0oet  ociltfaDua(vo;u)aexnmrctatomDe uei;t)s2ur(r iy4lle  fetasf rrm(m no1tex  fetadfs2eau p;t) renmf3oytfa  lueo s s2tr(m oodopenlicsls)sDraumono0tpxniociasfs2ul( s t0alenir iadomD lu s;s0s2tr(mpnu1op e nviat) rua(mo;t1alxo octytfs emu p t0aleoir todfat  n i t)srxrim3oodoltemfesas  2umumpoo4olenmicilt mDel(vs t0tltnxo3oodomD lnei t truoio oo4ale mfvtat sDrmx p;u1oee iietadls2rmuvpnu0aexnmfciy1laD luei s srumxmpoy4lpenlnvi (fs2tmx pou1aex  o3ild m2emuvs t4 eenxrciydlmDr uvi t0 ruo(r3io1llenmivsl(f rrm(rooo4opx  o3iatlm eauvo;u4arerxfcootlm elues;s0 eumir3ou4llenmnvsls)s2tm( onu0aetn ieiadfmDumn s;(0arxoifciodlmDeaivolt0truoxr iodlmeelnvta( sDumumoot4aet  o3tadla2elu onu4arxniocoy1oa  an i (0 2ur(o io1olenmiesasfa2um(  ;t1olt ioctadlm elnvs;u4alxrioctatomte nvil( teumxrpnu1omt lictatf Dtau  ou4oeeo f3ils m ranvp (0altoio3oodlpDeaueslt0 2tmir3ou4optelncsatfsrumxmoou4tptomociat a2ua(von(0 rtnif3ty1fpt an olt) 2tm(m3io1om nmfvias  2ta(r nu0altnifciaslm2umuvo (4 renioctotfpDe ueo;s  rurio oydlpenlfvi tfarua(rp;u0olxnif3iydls ra( o ()trenxr ia1omtr u i;s0trtm(m3iudameelivsl(farurxmoou4tet iieias a2em( o t4aetnioctadopD li ols  2uo(r3io4olt  ieiatf 2urum ot1aexnif3iatls2ulums u)arxnxr oadfmt lnei t) ruo(m iy4alteliesls) Dumxmo;o1oee mi3tld m2rmnvonu4 exomo tydopteaneslt tetoxmpnu4omtelfvtls) Dtaxmo;u0aleomo3tys mDel( pnt) ltrmr todopteaivi t srtrir ny4op n net t srtaurp;o0oleomocilt s2rm( sn()tltrir oa1opt  uvols0trxoxrpio4lpenlnvt s  Duaxm oo1aexnmoetadlsDumnmsnu)alxnxocoo1omDean s;t0 etriopiy1ll elnvtlt)aDurxrpnt1aleo f3ilt aDel( s;() ltoir3tadopteluvols  2xoio nudal e iciatfs2trxm ;t0ale if3iasfsDulums t4 etrio3tydlm   u s ()s2xriopoydlmeemneslsf Drrx ono1aetoifeiadla um( p;()arxomociy1latrlnvolt)srxoir ou4lm   nesltf rta(mpno0oleniieiad a2rluvpnt0arenmf iytfpt  ieo;( s2toir3oo1lltnmnvsltf rumxrp;u0apxn octas s2eauvp t)aexnmo3iodoaD ai o ( sexoim3nydlpe lics ()arrrx oou4alx  i3tldfs ea( snt4artnmf iy1fpD au ols)tetrirpoo4ol nlfvs t  2umxr oo4aeeomieiysfaDumumo;t0 ltoifctotfate i o;t teur(r iydome licias arumu pou1ole iociydfa2rln s;(0 exrxrcootfpD aueolt0 rxmxm3no4ap elics ()arrmu pot0aexniieiltfs rmu ont0areomo tytlm  aiesl(0 exrxmpnu4lp  lnvil(f rumx pnu0aetnii3iyt sDul(mon(4 ltoircoadomt au s ( setmxo iu1ap e fesa()s2raump;t0ope iocildfmDemnmon()treniocoatlptrluvi;()s2tmxmpoo1omtelnci ()s2ur(root0olt  fctldfs rmnmont0altoiocoa1laDr uvo;(0 etr(r3nudop  lfvtasf rtrumpot1apxoif3iltls el( s () eeoio oa1omDelnvols teumxr no4alt  ict () rtrxrp;t1opt io3ildla2rmuvp;u4areoxo3tytfaDe nvsls sexriopou1openlieia( srta(r ;u1tpx  ieiyt m rlnmont0 rxrmo3io1lm r u i ( t2umxm iy1lm nmieiat) rur(m ;u0olen o3ild s2elnvs;t0trtrxr iotla raieo;t  2uo(mpiudap e fvi t)a2uaxr ;o1alenmfeiadlmDea( ont4trerio3iytopDrauvs s  rurxm3ou4ome  fvsl()s2rau  no0oltniicilt aDra(vo;t)tltoxf iydomt lnesls0 eumiopou4lpt mietasfa2uaumpno1optnmo3tysls2em(vo u0trxoif oa1laDe neo;t0t2uoiopiu4ap nlivil( artaur nu4altoiociltlm umnvs t4texnio oydfatelivs (0teumxopny4lltelnctlt aruau ont4tlto octadlm2rm(mp t4aetrif oa1opD luvol(0 rxmiopno1omeemfvsa()s2ur(  ;t0oexnmo3iasfaDemump t0artrxfcty1lp rluvols tetoimpnu1altnmiet ()sDtr( pnu0aeeniieils a rl(mp;()trerxf io1laD  i s t s2xrio3nudamenmfvilsf 2um(r nt4tex  ietlt a2em(msnt0altrif3iydoaDeai sls0 rtmxm iydomte fctas)sruaxmpno4oet  f3ias s ra(mp;u0aetoir oydfp  ai o;s srxmxrpiu4op  mnvsl()sDraxrp;u0alx ii3ildfsDrmnmpnu4alxoio3oodoaDe neo s)tetmirpou4ope lfetl() 2urum ot4olxoifeilt a uanvo u)trxrio3oatfmDeaivsls0s2ur(r3iudal e netls  rtru p;o1texnioctasla raump;t4 ltnxf3oydfptranvsls  exm(r ny1ol emfvtls) Dtrurpou4teeo iciatlm2rl(ms;(4aexomf3oadfatrli s;(  2xrir3iu4optemfvia(f Drr(m no0tpx  i3ilt s emnvo u0 eermo ia1lmtr ieo s)truoxo3oy4ape lnvslt  rtrxmpnt4opt ifcildla umn pnt4tetrmr ootfmtrli i;s sexrir nu4al elfvi s) Dtr( p;t1aptnif3iytfmDuan o;t4artnxf3oytopte uvi;() euo(o io4omtnmivias  Dumxmo;o0olenmoctltfa rmu p;(4texoxf iydlp  aieo (0t2uoxr3nydopt mnvi s  rrrxmont1alxn iciaslm ul(vsnt4areomrciy1opD  n i s sexm(r3oydap  mivtas a2rmxr ;o4oet mf3tyt s2um( p ()aetomr iytfa eaueo;s  etmxo3ou4opeelfciat a2raxmpou4aexn i3iydls2umnvo t4aleoir3iy1la  aiei;(0trtrxr3nu4lm  lfct t)a2urxmpoo1aeto ocilsfa ulumo;()tleoxf iydlatrauei;s0s2ur(opiu1aptn nciltfaDumuro;t0opxoiocilsls el( o;u4tlxomo3iytlmteanvol()t2tmxr3iy4optn nctas  2rru ont0openiietltla rmnvonu4tlxomr iydlptelneo t0 rumxo3oo4lmtnlict tfaDtrxm ot0aptnifetltlaDumuvo u) renmrciydomtr n olt srxm(m oy4ome micil()srtmx ono4optoiictatfa eaumpnt)texrmr ta1faDeauvi t0trxo(r3io1omtn nvtatfa2ta( p;t0alen ictld aDumumpnt4 rtrmo oa1laDeli o t  ruo(rpiu4lle micsatfaDumxmpoo0altniociytlaDelnvo t) ltrxf3ootopt aiei;s  exo(r iudlle mies ( srurxrpnu0tpeo fctls m2eanvo (4altomf iotfm   ueilt)setoxr oo1alt  nei tfa2ua(mo;t4aet  f3tltla2eauvo u)aeenmo3ty1latrai slt0 etrxr iudll  lfeta( aruauronu0apxoiieiat aDrmums t) eenxociodfpD livsl(0truoxrpoo4al nmfvtas)sDtrumooo0olt mf3iyt a rmuvo u0 exrxrciydlptelnei s0t2xmir3ou1lm emfetlsfaruaumpno0apx if3iltls2ua(vs ()arerif3iadop rauvslt0t2umiopiu1opt lict ( arra( p;o4tpe  ieiat mDemnms t0 ltnxo oy1fa  liei t  exm(m3iu1ap  lfeil( srua(monu0oltoiociyt a2umn s t) rxriocoydlpDeln sl(0 2trio3iy1omtnlfcs ( a2rauront4teeniieiydfs eaumpnt0aeenmrctatlmt  uvil( texm(rpiu4lpen ici tfs2umu onu4tltoio3tlt sDuanmont)aexrmf3oytfat aneol(0 etr(mpiu4om nlfetls)s2um(r oo0optnmiciltls2rm(vp t0artoircoadlptrli i;s) rurxr3oodlpeemfcsl(  2trumpou0aleomoeiatls2umuvo u)trtomf io1latelnes (  eum(r iydoltemfeils)a2rru pnu0altn ocias aDua(ms;(0arxnxocoydomD aueo;(0t2toxrpnodope mnctas)a2rm( oou0oleomietad a eln p;u)treniocoytfa eli o;(  rxo(opnudaltnlfcilsf 2rrxmpnu0oet mo3iyslsDrlu s t4artnxrcoydomte i s;s trtrxm iudomte nviltf 2tmxro;o4openio3tydfs uaumo;()alxomo ootomtr ivsl(0s2xrxopoy1llt  nvs t) 2trx  ;o0alxo o3tadfaDua( s;(0 renmr todoatrlues;t)tetmxo3no1am nmfvsatfsDurxrpou0optnmfetydfaDulu o;t4 exnmrcia1fptelies;s0 etr(r oo1am n nesas)aDrm(ro;u4alxo feiat m2umnvon()aexoxr io1lp  aieo;s0srtmir3iy4olt  neta()srtrurp;t0tpxnmieias sDeau s;() rtnif todopt lieo;s0trur(mpou1ll nmicsa( srrm(moot4tex iictys aDranmpnu4tlxnifcoytlpDelivo t0 rur(o oodape lnvsas sDta(m nt1alt iicildfaDrl(vo (0tlerio ta1fmDrliesls  rxm(opiydomtn nesas srrrx  ou4aetomocilslm2ulumpnt) rxniociadlp e ues;s)sruo(o iu4ap elietl( a2ua(m no1oetn fetysfs2rmnvp;t0tetoircoadla  lu i;t)trtr(m no4opee ncsls  2umxr oo4oltomicilslsDum(mp;u4alxrmr3ty1omt aiei;s0 rxrxr oydll  mics t s2trx ooo0aexniiciyt m rlu sn() eerxo to1lat  ieo;s  rtoxo3oy1omen fcs s) 2ra(m ot4oexoiieiytla2um(vp u)alxnio tytlpte ieo ( s2tm(opoy1llt mfeilt)a2trump;u4teen o3ilt m emu s;t) lerif todfat li ol( truo(m3ny4lm elnvs t)s2rmur nt4tpxoio3iys a el( pnt4tlerif todlatrauvsl()s2uo(rpoo1omeemfvils)srrrumpnu4alxn ociat a ulumo;()trtrmrciotlp   u s t)trxmiopoo4openmicias  Drrxrp;u1tlto iciysfm uanvsnu0artnxo tytlmDrln sls) eto(r3ny4olenmiet ()aDrmxrpnt4opeomoeilsfa rluvp t4 exrmf tatlmte ues t t2xm(r nydll e iesl()aDururo;t0oexo oeiys aDemuvp;u4artnxrcoo1fmtelnvol(0 rtoxo3nodlle lies sf rtax ooo4oleo feiad a uan p;u0artrio iy1lpDelnvi ()trumxm io4alenmnvtas) Draxr ou4alxn oetlsfa2ranvs;t4aeerir oytoatrln i;t0 rxoxm3iy1ol nlieiat sDta(ront0opto fetydlsDrl(vo;()trtrxf3todoa ean o t0seuo(m3iu1amtn ncsls)sDraxmpou1tet  ietldla2elnvs ()trxrioctytoat luvo t  eum(o oydol  lnvsl(  rrrurpnt1opx iieiasla2ulnvonu)areomfcoydom r neo;s  2tmxm3oo1op  mfetlt s2rm( oot4oleoif3iadlmDrmuvon(0tlenifciy1omtr n o;(  rumxr nydolenlnciasfa2ur(m ot4tee  fciyd a2rmn o u0 ltrmf3ty1omtr neo t t2urirpoo4lp  lfesa(  Draxr ;u0oleo ieiysfm2ua(mpnt0 eerio3tadlmDelnvi ( srxoim3iu1apeemnet (  rurx oot1tpeomo3iasfsDumn p;u0 etoxr3io1om  aueo ()sexmxo io1lpe lici s)a2tmu  ;u0ale  o3iasfmDrmumpnt0trermf3iydlmD  ueslt)t2xrimpnodlmtn fcsatf rraurp;t0aet mi3ild mDul(vs;t0tetnxo3iadfatrlues;s0 eto(r3io1llen fvt s)sDurxm ou4oexnmo3iadlmDrm(ms;u4trxoxfcoatlp r uei;s0sexr(r iu4lltemfvtltf Dtm(ront1opxo fctadfa2eaump;t4 eeomrcoatfpD anvo;(0tetm(opio4ap e nvils a2umx pot4tetnii3iadlsDeanvon() lenmociy1fateliesl(0s2xmio no1ll   icils  Dur(r nu4oleomociasfa2em( pn() lxrifcia1opDean slt)trumiopou1altnlfvia(farumurp;o4oeeniiciydfs2uanvs;u0 lenif tydoaDeau sl(  2tmirpnodaleemncil(f Durumpno4oeenmfctasls uau p;t0treoio3oo1opDelnvi t s2um(mpny1lmeemivil(f rumxmpou1apxoii3iadfs um(vs;t) rxrmr ty1laDrlu slt)srurxopny4ope mfvsa( s2rrxro;u4olt mf3iys mDrm(mo;(4artrio3todlmD au slt t2xr(m3ny1om  lfesl() rrrxm ou1aexn octldla2uan o t0artnxrctatfmD  neils0srumxm3iy4lpen nesls s2uau  ot0tltn fetytla2ulumonu0teerxf3oydfpte u sls  rtmxm3oy1aptnmnvtatfs2ua(r no4teto o3tydfa el(vs;u4aexnmf3iodoaD luvsl( texrim3io1lle  fcils)sruaum nt0alen fetltlm eluvsnu4tlxrmocootop  lu o;t trto(m3iy1am nlicsatf rumurp;t1oeeomictydfsDulnmo t) rxrmo totfp  li o;( texm(m ny1ame  fcsa( sDururpoo4aexniiciyslm em(ms (4trtrmf iodlpDe ivi;t0 rxm(m3iy1oltnmivs s)sDrmum ;t0tleo f3tltfa ua(vo;(0tetomfcio1opt aieolt)trto(r oydlmenmfvia()a2tm(m no1ape moeiad s ra( p t4aexoxfciy1latrau s;t0s2um(opou4olt  feil()a2rr(mont1opt  f3ildlm2uln o;t4alenxr3iadlm elu o (0 ruo(m oodapenmfviat  Drmxmono0aeen f3iltfa umums;u0 ltoir3iodop eaneo;t)t2xm(r nu1lpeelict sfaDra(m ;o1tpxomfciydls ua( p;u0tlxoif to1lpDe i s t  rtmio iu1ol n nvt sf Dum(rp;u1oee  fciltfs2ul(vs;(0 rtomo ootfm e u i;s0seur(r oudlp emnct s  2taum ;t0aleoifctld m2ua(vp (0 rtomrciodopt lu i s t2xoim nydalt micsasf 2trx o;t1apt  oetltlm2eaumonu4arxoio oa1opD au s;s teur(o3nudlp nlnct sfaDrmxm ;t0opt miciyslm rl(vs u0 lxnmocoa1fmteai i (0trxrxmpno1apt licta( artmx pnt1aeeoifetldlaDum(vp;t0aeenir3oadop rliei () ruoio ou4ll   ieil() 2rr(rpno4teeo fctldfm rmnvo;t)trxomo3tatoate u o ()trurir ou4oltemieil(f rua(mont0apen feilsla ul( snu4 rxnmf tatlm  anvs (0truo(m oy1lleelfeias)a2tru oou0ale  f3iadfsDulump;t)teenxf3iydfpt  ies;(  2tr(o oodap nmietlsf 2uau  ;t1tptn oeiytlm elnvo (0texoxf iydlmD  ivo;(0trtoio3ou1lp elfei tfsDua(mp;o4aeeomfetydfs um( o u) rxrxo3oy1fptranei;()tetmio3io1ll elfeias) 2tr(ront0oeto ieiad aDeau ont4tleoxf todlmtranei ( truo(o oy1ol nlietas)srtmu  ;t0teen o3tyt sDelumont4aleomrcta1fa eln ol(  2tmxo3oudom nlnes (fs2uru oot0tetn ictlsls2uau pnt)aexnif3oa1oaDean s ( trtoxr nudlltelfvslt aDtax  nu0olxniictadfm2um(vs;t0 renircoy1oa r n s;s0t2ur(mpoydllte fcta()srtaumo;t1alen fcildfa2rau o t)tltnmo3oodfa rlues;(  2uoxo3io1lpt lneiat sDrm(  ou4aet  oeiltfaDrauvo t)aetomr iy1opDe ivs;t0t2xrxr io4alt  fvia(fa2tmum nt1tpe ioetas sDulu p t4artrmr3iy1omteanvs t0 ruoxopno4amt lnvta()a2ta(mp;u1apx mf3ias s eluvs;(0aexoir tadla  anes;()teumim3oo4omt  fetls) ruaurpou0oetn fciltfs2emn pnt) leomo totoaD  i s;(  2trirpiudlp  mfeias)artm(rpot0ape  ieild mDulnms;t)tlermocoo1opteluvs ()sexrio3oo4ll elfetat)s2taxr ;t4opx ifctytlm2elumo u0aexnmoctydlmDe u s;s  rum(rpiu4lmtnlfetlt)s2uaum nt4aetnmfciatfsDrln o;u4trtrmf oydfm raues;s0trto(o3iu1ap nlnciltfaDtm(mpnt1alt  f3iat aDuau o;(4tetoxrciydfp eauvi () rxo(opnydolee ivi s s2tr( o;t0aee mociadls el( snt0aetoirciotoptrlueo;() eumiopoydaltelfvsa(fs2um(r nu4oexomi3tasfm2ranvo u) ltoir tatfpDranvi;s0 euo(rpio4olte ncsa(fa2rrx onu1tle  oeiysla eln p u)alxnmfciatlaDrlieo;s s2tm(r ou4lpt  ivsat) 2rau ono0aptn fciys m emumsn(0texrmfciy1omD  nei;s) 2to(rpiy1amtelivi s)sDraxmp;t0optn fciat s2emuvp;u0 rtomoctodfmtrlneo;(0s2tm(mpiu1omeemnctlsf rrr(  ou1tpx moeiys m eln o u) etrmf oydfmDrauvsl() rxmxo3iu1lm n ivtasfsrurxr oo1oetnmictatls rln p;t)artnmf3iotfa e uvo ()tetoir iudlleelivtas sDtaxmpot4olxomf3iytfa uauvo;()tltnxo tatomDe iei () 2xoxr oo1oltemfvtas aDrmurpot0apenifetytlsDrl( s u4aexnxr3iodoptrluvil(  etmim nu1alte nvi ( aDurxm ;u0altnmo3iytfm ulump;(0 lenmr3oydfpteaivols) rtm(opou4ole lict s arraxmoou1aleoifetlslm rmuvsnt4 lermo tydfate ivils0teuoxr iudom elnvs s) 2ur(  ot4tpen oetadlsDum(mont0areomf oatlm   ues;t)teuoxm nu4altemfei sfa2ta(rpou1apto oeilsfs2ean p (0tlxrmo3ootfatr n s s0 2ur(r nodol n ieils) rurxm oo0apt  fctls m rln p u)aeeomr totop rau i t  eurxr3no1aptemicslt)artmxmo;u4tetomiciyt aDranmp;u)alenif3iytoa   i i;t0teto(rpio1olt  fvilt)s2ra(ro;t4oeeo fciatfmDeaump;u0aexnxr tytfpD lnvi;t0t2xo(m iu4lltn ivtls)a2umur nt4apenioeiatlmDul(mont0arerxf3to1lpte ivslt s2umxopoo1lptn neils  rrr( pno1apx  ieiadfa uanvo;t4texoxfciydfpDe neilt)srur(o3oodlptnlict ()s2umxm no1openif3tas mDeluvon(0teermrcio1om eaivil()sruoimpiydomt lnvsl( aDra(rono0alxnmo3iadla rluvp;t)aetrxo io1fm  aivolt setoxr3no4oltnmnvs s s2ur(ro;t0open o3iyt sDum( s;u4alenxf oytlmDr ueols t2tm(o3iodlltelfeslt)sDtaurp;o1ape micildlm ua( onu0tetnxr3oadlpD  ivi;t0srxr(rpiy4ol e feilt) 2rmxm ;t0optoio3iydla2el(mpnu4altrio oydfat anvs;s) 2ur(opoy1lm nlfviltfsrrm(ronu0olt  o3tldlm2elump t0trxnif3oatoptrauei ()s2xm(o3ny4optelncslsfartmxro;o1ole  f3iysfm2rm(vp;(0 exnmr3tatfmD  uei t)t2uo(mpiudll  lneiasfa2tr(  nu0oetoifeiysla2emnvp;u)aetoir oy1fmDe uvi s srum(opnydolt miciat)sDur(mpot4tlen o3iltls rl( p;u)altoxo3to1fm  lu slt0srxm(o3no1ol  mics (f Dtr(r ;o1tlxomi3ias a emn pnt0tlermf ia1oa   u s;s) exm(o oo4lm e nes sfsrtrxr oo1oexo o3iyd mDuln p u) rtrmrcty1fmDr nvi s)t2xrirpno4op elfet t  2trx pno0teeomf3iydlmDel(ms (4teerif oadfm  li i (0sexo(m ou4ope lnvta()aDta( p;u0tleo feiatfa2uln sn() exoxfctodlatr ueil( s2uoxmpoy1op emneta( s2uru  ot1alxn fciat mDul(vs;u4alxomrcoo1lpt lu slt) rtoxm ny1omenlfvtls s2rmx  ;t0aexnmfctldlsDem( s t0 rtnir3oy1lp eliesl()teuoio3iudap   fviat srta(m oo4teeo o3tltls2um(vo;u0teenir ia1fpDr nes;() eum(opiodllee nei sfaDtmx o;o0alx ioeild m2rlnvs;t0tltomrciadomt an o (0trxr(r3iu4om  mfvslsfa2urx pot0texomoetysfs elump t4 rtomrctodlmte ivi;( teuoxm3iu1opteliei sfa2rmxm no1tltnmieias m um(vo t0 ltnmr3ty1omDrlneols)s2tr(o3oodllenliet s) 2tmxmonu0altomocilsfaDuln snu)arerif3oa1omte iei t0t2uoxopoodaleelies tfsDtaur ;u0aetomf3tadfm elnmsnt0trxrxo to1fmtran slt sruoim iu1olt miet s aDrrx pnu0oet iociys m2ran o;u)tlxnxo3oy1fateln o;t  2xrxopoy4ale liciasfs2rrxmpot0aptnioetas a2umuvs u4 exnio io1lpD luvo;s trtoirpnydlmtnmfvils)sDtmurpnt0aet mfctyt mDem(mpnu0tlerir3todlatrlu ols) etoio iodamt mictat) Drrxrpno1tle  feilt aDemu o u4tetnmf3ootfpD lu s ()t2xo(o3oy4amtelfctat  2tm(mp;t4tee  ietyd a2elnmp (4tlxrxo tydoa elivs;(  rum(opoy1alt mnctl()sDrm(m nt0oeen octyd m uln p t0tltrmr oa1lmDr ieol(0s2umim3no4ole mictas) 2trxm ;o0aeeo fetytla rm( on(4 rxnmf ta1fatrln ils  rxrimpiy1lltnlncils sDtrx p;t0tex mfeiltfsDran o;t)teeoifctytlpD ai o s srumim3oudlp  mfvsasfs2urx p;u1aptoifeiys m2rmnmon(4 eeoxo3tatfa eaues;s s2tr(rpiydopen netasfarum( poo4opto icias a emnvsn(4teeoxrcoo1fp  anei ()texmxo3oydap  mietasf 2tmur ;u4apeoifctatfm2um(mpnt) ltrio iydop e uvo s0s2tmxm3iodam nmnct (f ruaxmpou0olt iiciad s ua(ms (4tetrxr3ta1fp eln ilt trtm(r nodalee nci ()s2ua(ro;u1tpx moctas a2umu o;()trenmociy1opt aiei;s0t2tmxrpiydlm nlfes sfarur(  ou0aet mfeias a2ra(vs u)artnmf ta1lptean ols tetoim iy1lpt mnvilt) 2umxmooo1oexniietlsfa2umuvp;t)aeermr io1oa rai il( seurxo ou4op  lnei ( a2uru p;u0tetn fciatla2rl( snt0trtnif3oodoa r nvo t0s2to(o3ny4openmnctltf Drrxro;u4aexoiietlsfm2rl(mp;()aeenxr3tydfm elieils)trxm(opoodamtnlfetlsf rumx p;u1opt ioeiad aDrln p u4texrmfcta1lmte i i ()trtoim3nodapenmici ()sDrr(m ;t0apxnmfciysfs2rln onu) rxnmo todfmD lu sls0 eumxr3ou1ole  fci () rtrumpot4optoiieiytfaDelu s u)aeenmf oydlmDeln i t) eumir3ou1ale mnvtatfartaurpno4oltn ociat aDrluvo ()alenmrcoytla rln il()s2uriopou4altn fcsl()arrrurp;t1tlxnii3iys mDrlnvp t4texrxo3ia1opD  ieilt  2ur(r io4olen ncs () rtmxrpot0texn fciltfm ra(vpn()aetrmo todfatelivils0seum(rpnudom   fvt sfaDra(rp;o0aptnmfctysfa2uauvp;() rtrxf io1opte i s;t0s2triopnu1omenmfct t srururont0oex  iciytls2ran s (4 lxrxo oytfaD lies;( srtm(r ny4om  lnetatfarumxm ;t0tle mfeiad s um( pnu)tltnif3oydomD li ils) 2uoxmpnu1al   fet tf rrmx  ;o1tptnmociydfm el( ont0texnmfcoytoa ean o;t truoir3nodomtelnvsl(fsDtax pou0texniietytfs rlu p;t)teenxr oa1oaD an i;t)srtm(o no1ap emnesasfs2rmurpnu0tpt if3iytfm um( snt) lxnmo iatom r u o;( t2umim3iu4olte ivtltfsDtmur ;u0opxomf3tadfs2uauvs (4trxoxf tatom   ueo;s)teto(opny1optnmncsas  2uaxro;t4open feiasls ul(mo u0tlenmrcto1fpt ai i;( sexrim nu4llte ics s)s2rmxmpnt4tetnmo3tlt s eauvp u4 lenio3oodlmt  i s;s)teuo(m3iy1lp e fctlt)srrmx  ou1alenifciadlsDeauvo t0tlenxo3oy1fmDr iesl(0 rxoiopou1al nmivt t  2rm(r ;u0alxnmf3iltfm ulu pnt4 lxoxr ootfa  ln o s s2xo(o3iydame  fvs t) Dur(mont1oltoii3iatfm2emuvs;(4trxoxr ootlpte n slt srtoxm3oy4optemictasf Dum(mp;t1aptoio3iltfa emums u) rtriociy1op  au s;(  2umxm nudal elnvsa( arra(ront0aexn fciysfs em(vo u0arxomf tydfm elnvsl() rurim3ou1llee ncia( aDrm( o;o1aex iociltfsDrlnvo ()arxomf3iadfa   ies;s0 2xm(m3no1lme  nvs s)a2tru  ;o0ale ii3tasfm emnvs u4 eenio3ta1lp  luvi (0 exrxr iudam   feiltfa2ta(  nu1tex mo3iatls2rluvpnu4 ltnmfciy1lpD aiei;s seurio3ou4lltnlies t  rua( pnu0alxoio3iat mDulnms;u) lxomf tadop rlu o;t0tetr(o3oo4llt livtas aDra(  oo4opx ifciadfm2eanvo;(4 ltnmrciadopt  u i s0 2uoimpoy4omtnlnvtat) 2umurpnu4alxomo3iytfaDrln p u0 lxomf oadoptr ivo t0trxm(rpoo4lpen fctatf rumump;o1tlenmicildfs elnvp;t)arxnmrctadoaDrau s;t)seumirpoodom   fvt (fa2ta( o;o0aetnmo3iadfa2ean s;u4 etrmr iotfmDr i s;t s2xr(o oy1lmte ictltfaDumump;o1olxn icilsfs2um( s (0altnxfcootfa  luvsl( teurirpiu1om   fvtl(  rtaumo;u1alxnifeilslm2umumsn(0aeerir iydopt aivo;( texoxr3nu4al e ncs (f Dtaxmpou4opxoiiciltls eanmpnt)trtnifcoy1omt  n olt0s2uoxm oy1ll e fci t aDtruro;t4tex ifeildls rmn snt4artomo3oa1lm rli o;() 2tr(opiy4apt  fcsat  2rmx  nt4aex  feiyd a2elumon(4tetomfciadomD  ueols0s2toio ny4llee ieilt) 2um(mpot0apxnioeiyslaDuanmonu)tleoiociotlp e uesls0trtmxrpoy1ol nmfvil( a2raumont4aee moeiytfmDelu o t4tetnir3tadfpt livils0 rxr(r3ou1ol nmneil( s2rrxmpot0tpenmictadfsDumu p (4 etrmf iotfmD  u o;()srxm(mpio1al elneil() rtmump;o4opx  i3ilsla elums () leoxo oydomteanes;s)tetoxo3nydap e fctas) rtau  ;t0aet iiciyd a elnvs ()tltoio ia1faDr ues t0sexrir no1ll n ncslt)sDtrx ono1tet  ociytlm2um(vsnt0 reoxocoytlp   iei;()srtoim iu4omtelfvia(fa2umxr nu1tetnmfeild m um(vs;(4tltniociy1om rlneo;t seum(o3no1lm e nvi (faDrru  nt0tetomo3ildfa2ul( pnt4aexoir3oadoaDrli s ()setoir3iu4ole mfeta( arum(m ot0alx  icilt aDrluvs t) ltrmf3iydlpDeai s t)teuoxo3nodome lfvs s  2tmxmonu0tlt mi3iysls2um(mp t)altomr oa1fmD  uvol(0trtmirpny4lmenmict ()aDtmuro;o0tpenmfeiatfa2elnvo (4areoif3iydfptranvo;t)t2xrxopiy1oleelieias) Duru p;t0aptniietldfm2umumo;(0 rxnif ty1fmDeauvs;t) rtm(mpny1lmte ncsa(  rta( ooo0aex  fciadfa um(monu)trermfciytom eli slt) rtrirpnudomt  fcils)aDum(rp;u1apenioeiltlmDemnmsnu4trtnio3tadfmt au i ()srxo(o no1al elnctas sDtrx pnt0openmo3iltfs2eaums;t)artrirctadlaDeauvs t  2xmimpoy1ll n ivs ()aDtm(  ;u1tlx ioeiytlsDumu s;(4 renmo iadopDraues;s0 2tmirpny4oleemictat) rum(root1apt io3iysla rau o;t)arxoiocty1fa  lnvi ( seto(opnu4optelnciat)srua(rono1tpxomfciltfmDuanms t4tlxnif3io1fpD  ieilt0truoio3ou4amt lneslt  rraxm ;u1ape mocilt mDemumpnu0tlenxfcootlateluvi s0 2toim oy1lpeemnct tfsrrr(r ot0optniociltfs2el(mont0trxniocoy1fmtran s ( teuo(m iodlp   iesl(faDtrx  nu0aleniictlsls2ea(mo (4 eermfcootoa  an s () 2tm(r3iu4aptnmnvtls  2taxmoou4aexnifeildla ua(vpnt0tetoxr oodopDeanesls0srxrxo3oy4ll  lnei s)s2ta(mooo1altoiictysls rm(vs (4tlxnmrcoytfmtrlu o;(0s2tr(rpoodll nmietas s2ra(r nt1tpxoiieiltfa ulums;()texrxf3ty1oa  auvo;t)trxo(m ou4llt mivi t)aDumx pno1ole moeilsfa um(vpnt0alxrmf3oo1oa  livsls)t2xmir3nodapenmfvt sfa2rrx pno4apenmf3tasla umums u4aeermociadlpD ai i ( s2xoxm ou1alte ict t)s2uaump;t4apx  ieias s rauvp u4 reomf ia1fat  i s s s2uriopiy4lmte fcia(faDraxmp;u4ole  f3tyslsDua( snu4trtomrcoytoat anei;t0 exmirpnu4ap   nvi s sruru  ou1oleomieiys s2umumonu4tlxrxf iadlp  aivs t sruo(r ou1lp e icias arum(m no0teen o3iasla uaumo;t4tltrmfctodlpt  i s;s)texoxo oy4lpeeliei t)a2taump;t4oexnifeildfsDul( snu0tlxrmo tadlpD lu o;s0 rumxr3io1ame lfvtl()a2umu p;u1aexnifetadfs uanmo u4 ltoifcoatlmtran olt t2xm(m3iu1lme  fctasfa2rm(  nt1apeniocildla2ul( s u4 rtnmr ia1fp eaivs s0t2triopny1lpe lici t)s2tr(r nt0aexo f3iltlaDeaums t4 lxnxf oodla  ai ilt0 eur(o3iudlm elicia(  rtaxmpno1aeeomociltla ua(mo u) eerxr3totfatelieils0t2ur(o3no4apenlfcta( artr( p;u4tetnmfciadlm2ulums;u0tleomrcoo1fmDe ivo s)s2xm(r nydam   feta()s2uaxm ou1tpe iociytlm rlnmo (4aeeoifcio1lmtraueo;t s2ur(m3no4aptemneia(fsDurx  oo0optn i3tytfa eaump t0altrxo3ia1oaDrlieo;t tetmxo3nu4ome mfesls) Drr(mont0olx  oetatfs emnvp (0 eenio iodfmteanes t)teumim iy4am nlietat)aDrrumont1aleo o3iaslsDeluvpnu0tetnxo3oytla r u i t setm(o ou4opt  fvt s)aDrr(r ot1tpxo i3iytfa eln o t0altoxo oadlpt li o s)srumio3io4ame  ncia(fsrrrxroot1tet moctydfm2uanvs;u4trtnif3todlm  aieils0teuoim3nu4lm   ncil()s2rmur ;t4ope  oeiyt sDuanvs;t4trtrif3tadom elivs;( s2umim oo1opeemnci s s2uaxr nu4tet moetlt a rauvp u0arxnxf ty1fatrln o ()s2um(o3iudlpt  fcil()s2rru ono1optniietld sDea(vpnt)aexnif3iatfp eai ils) etmxrpio1omtn ieilt) rtmxroot0aee ifciyt sDul( s u0texomocoodoa rlivi;s0t2urim iu4apt mfct t)srtr(mo;t0ope mieiltfs ea(mp t4 leomr3io1lmDeanvolt) rxoiopiydolen neils) Dtmurpnu4oltnmieilt m2rm(vo (4 eermr3tatfaDeanvo;s teuriopnydame liei ( srta(  ;u4aex iociydfaDua(vs;()tetoxfciotfat aivsls srtoxr3io1amt  nesls  Dur(rp;o0oetnmf3ils a2rln ont4arenif tadfaDe ieo;(0 etrio iydop nmnet s)aDurxm ;o4tle mo3iatlm2emu p;t0 ltnmf3iy1oa  luvo ()tetr(opny1am n fvi s)a2rrum nu0aexn o3tad sDeluvonu)arerir3oodfmDr ieo;s) eto(o3no4ope micsl(fs2ra(rp;t0tpenmo3tatfs ra( on(4 lermfcio1op elivs;t)t2to(o3oy1oltelivias)s2rmxmono1apeo f3ild mDum( o;(4 etnmo3tatfp ranvo;(0t2xmirpio4ol n iciltfaDua(mpou1aexniociatfs eauvpn()alxrif tatoateai i s0 euo(o3oydapenlietatfsDua(m oo1oeenifetydlm rlnvo u)arxnmfciydlp  aiei s t2um(rpiudam n icilt s2raurpot1aexn o3ilt a2emn s;u0arenmr io1lpt lnvo;t0teuoir oo4olenlictl(faruaxr no4aptomf3tyt a2rmn pn() rtoxf3ty1lpteaivs;t0t2xrim3oudom  mfvia()aruaxr ;o4oeeoioetydfsDua( o u0 etomocia1op  lneo t)tetmir3iy4amenmici sf 2ua( pot4openiociatfs rluvo t)altnio ta1fpD  uvi;(  exm(opoo1ap emivil(  Dtm( onu4tlen ieilt mDranvo;u4aleomo oy1lp  an o;(0tetrimpnu1ale lieta(  rta( pnu1apxnmo3ilt m uanvo t0tetniocio1fa r ues;s0srxrimpoo1lm nmnct () rtax o;o0aptnmo3iytfa2uluvs (4trtomo3iadomtrau i;t0teumxo nudop nmncslt a2rm( pnt4aexnmi3iyd sDulump;u0tetoxf ta1lmtr ivs;s0srtrir oudap emfes () 2rmumo;u1tex  ietatfs2emn sn(0tetrio3ia1opD aueol(0s2umxr nu4ame  fct s a2trxrpnu0aeeoiietad mDrluvsn() rtoxo oadfaDeluvs ()srxrio no1omtn fvt t)aDtmumont0ope  ocild aDrmumont)tltnmrciotfat  ueslt0srxoio3oy4lmenmnvt s) Drmxrpno1tpe ioetlsla ul(vp;(4altnxo oatoaDe n i;t0t2umxmpou4lltnmicta( arurxmpou1olxnii3tatfs2eanmsn(4aexoif iodfaDrlnvi;s  etrir3nudapenlicsls)aDuaxmonu1oexniocilt m2rl(vo (0artoxrcia1lmteai slt)srxrim3io1alte nes t)arra( oou1aexn i3tat m2rmnmp () etnmf3iodla eaieslt tetrxm nu4ame mfeia( arua(  oo0optomi3iytfm2rm( o t0texnmo3oadlmD lnvs;t0sruoxmpiy4omtelfeia(fsrra( pot4apt mfctlt m elnvp t4altoxo3ta1omt  n ols sexrio3io4omenmfes ()sDrmumont0apeoifeiad m um(ms;() ltnmr3oydfp e ieols)srxr(o3oodlmeemnetlsfs2urxrono4oleomf3ilslm rluvpnt4 leomfcta1lp  auvi ( srxrir ou4lltelnvsas)arum( o;t4apxoiicilslm ulu sn(4 rtoxociydopteaivs t s2xm(rpno1lp e fcia(fsDurur ot1oet  f3ilt sDelu s;t4arermf tadom  li i;t  rur(rpoudal   fcta(farrm(ro;t0tlenmociatlsDuauvp t4alxnxocootfp e iei;(0s2tmio3iu4omt mnctltfaDtmxmpot0altniietatlm2rm(vo;u0 rerxrciodfa r u o s0trxmxr ny1oleelnei (  rtaxro;o0tetoioeiys m rlu p;(0aetrmoctatlmt  ues;t)sexr(r oy1lmte ies () 2trumo;o0tpx  iciysfa2rmnmo;u)altnxr iydfpDr ieils s2umim3ny4op n iei sfaDtru ont1apen ociadfm ul( o;t4 ltrmrctotopt au i (0srumxo3iu1lp n ncslt  rtm(moou1apt moetlsfsDrmnvo;t0 etrmo tytfa  lieo t)t2toxo oudap nmfeias)arrr( pnt4oeto f3iasfaDuln s;u) lxomociy1fat aneilt)setrxo nodlmteliviltfsDrmxro;u0alx mo3iatfmDrlnvpnu)trerxocoo1lpte i i;t)tetrim oodll nmici (f Dum( o;t1aetn feiydlsDrmumont)aexnirciadla r nvi ( s2xoxopny1amtnlfvta()a2rrurpoo1alto o3tadls umuvo u4altnmo3iotoatr nei ( tetoxr oodolte fes s arururp;t4tpxoio3tatfm2ulnvs;(4aeenircootlptr n i;(  rtoim3oodllte fct s)arua( pot4tex ioctyt a el( o;t) rtnmfcoydoptr nei () euoiopio1lle miciasfaDtax ono4aeeomiciydla eauvsn(0aeenxf3iodfmteanes;s  2umxm3io4lp e ics tf Dtmumonu0alxoiictys a2rlnvp (0tetnmo oodlptraivi (0trum(opno1ol  licsatfs2urur nu1apx  o3tasfs ul(mp;u) lermo tytoat lu s;()srurim3oo4llee fei ( arur(m oo1aex mf3iysfm eaums (4 rxrif3io1oa rlieols) etr(o3oo4ap nmicsas)srraxmp;u4ale  i3ias mDrmnmo ()trxnxo3tadlm  lies;s)s2xmxo oo4ameemieil()aDtaxrpou1opxomiciasfs2ul( s (4arenio3iydoatr nes;t)srxoxr3iu1lm  licia( arur(mo;o1apen i3tat aDem(ms t)trxrif iytfaDrlu ils t2trxr iy1ll   ncilt) rumurpoo1ale mo3iatfsDua( s (4trenxocootlmt auvs t t2uoxr oy1al elnci s  Dua(moou4alto i3ias mDrlu sn(4 eenmo3oy1lpD lu ol() ruoxm nydlltemfvtlsfa2ur( oot1oee mf3tysfm2eaump;t)artomrciadop  aies s)srtm(r3iodomen iesasfaDurxro;t1aet  fciaslmDrlu p;t4aexoxf io1fp rauvs ( srxmxr3oy4am  lfcs s aDtrxmo;o1olenmicias mDulums;u) lxnif3tadfaDeaieilt0 rumxr nu1lleelnvt tfarua(mp;o1tpe  oeiysfs ranvsn(4artrircoodop e ies ()s2uo(o3oy1alte iesas)srumxmpnt4tpxn f3ilt m umnvsn() etnxocoytfpDe n o t0teuoxo3iodlm e iet (f 2tmxm ou1oeeomf3tad m um( o;u4texomocoydoa elnvslt)srurxm nu1lleemfesltf rtrx p;u0teen ociyd mDrmn s (0trtrmr tytfp r i sls)sexrxm3oo4opeelnet t)arraxrono4tex mi3iadfs em(von() rxnioctytlaDraivi;s) exmirpio4lp elivsls s2ururoou0ope mociat s rluvs;t)altoxr tatfaD aies (0teumirpoydal nlfet s) rur(mpno0oexniieilsfaDumuvo;(0aetoxf ta1lpD au s;s0srumxr iu1amtelfetlsf rururoot4opxomf3ils m elnmo;t)tlxrmocia1opD livi;s)sruoxo oo4amt lneils)srrau ooo0apx  ociytla ra( o t0 etrxo oy1la  luvo;() exoio oodlpe mncsls  rrru  ;t4apeoifetls s2umnvpnt0 eenxr iydomDrli ols teuoio iy4al  mnvilt sDumuro;t4alx  ieildla ua( p t) rxoircootfaDeau i;()tetoxm3oy4om   ncs (f 2rrumono1texn ietytls umums u4tltnxf3to1fm ean i () 2ur(o oydlmte ncs sfs2tmxr nu1aeenmoetyd a2ul(vo u0 rxrif3io1lm   nei;s)trumxr3oo4al  lnvsat)a2rmu o;u0oexnio3ias a2uln p;u4alerxr totlmD an ils)s2uoim3oudlmtnmieia(fsDur( ono1tpe miciysls2emnvpn(4 lerif3oytlpt lnvs;s)t2xmiopiu4altelnviatfsDrm(m ;t4tpx ioeiytlsDelnvs;u0aeerir3ty1lpDelnei (0tetmxmpiu1ol emfes tf rtmx p;o4tptnioeiltlm2ran pnu4texnio3iodfp raivils0t2to(opoo4al e iet (faruaxronu1apx miciadfs rmnmsnt)alxrifctodoa  aneolt) 2uoir io1apenmics ()a2ua(  oo1alxoiocildfs2ran p (4 leoircoodlp rli i;( srumxopnydom   nvsa() 2rmu  nu0ope iietlslm2ulumo;u0alxrio3totomt aivs;t0trxo(o3ny4amtelfet sfsrumu p;u4opx ifciltfs rlnmont)arxoir oodomt li ols0t2xoir3io1lpenlfes (faDuau o;o4oleomfciatla2ulnmo u4tetomr iatoa  liesl(0s2xo(rpio1lm nmietas  rta(rp;u1opxnmo3iyt m2emnvsn(4tetrxo3iodla eai i s) rtr(r3oydlme lnes t s2rmu  nt1ale ifctltlm2eanvp;()tetnio3tadfa elnvs t0srxmiopiy4amt  ivi tf 2uax  nt1opeomi3tlslm2ean o;u0 lerif3oytom eau ilt) euoio3iudlpee fes s srrm(mp;o0tpe ifetls mDeau p (4 etniocootoa ean sls)t2xoio oo1alee fcsa( arurxr ou0opxn oeild a um(mp;u0 rtrio iotomtraivil( trxoir3nydlptemfvt s)sDum(m ot4tex ioctls m rmnmp;u4trxnio oo1fpt auvo t)srur(opnu1lmenmfetat artr(r ;o1apeomi3ildfa ranmp u)tetrxf tatfmtr nvol() 2toxo oy1om nlnvs s s2ur(r nt1alt mi3iatla umumsnu4 eermo iytla ean s;s) rum(mpoodaleemfcta(fsDtrump;t1tpe iiciadfm2emumo;t)texoxr3oo1fa e ivslt)setrio3no4ameelivsas sDtr(r ;o0olxo ietad m2rmuvs t4alxomr3tytlmteanes s) eum(opiudaptemneslsf 2urxm no0apxnmfcilsls2elnvp;()arxrxfciydopDe nvs t) 2urxopno1ale  icslt srra(  ;u4tleoio3tat aDran snu)alenio3ta1optelnvolt s2xmxo3no1lp nmnvsasfsrraxrpnu1oeto f3tas a2ulnvp (0teeomr3tytoatraneo;() exoirpno1lpeelfctlt)s2ua(ro;o4open fetatfm elums u0arenircootoaD  i i;t sruriopiu4apte fetat sDrm(r nu1oex ioeild a2uan o;u0trerio3oydfmD  neo () rtrxrpnydll nlictl(fsDrmxmo;o0opt ifeiadfaDumuvs;(4altnif3iodfp eanvs;t0t2umim3nodlm elieil( aDumxr ;o0opt mocils s eanvo;(0 rxnio3ia1om e iesl() 2toirpny4ale lfet t)sDtaxmooo4alt mi3iys s2uluvont)alerxf iodfa eluvol()srtr(r io4lmt liet sfaDrmxrono1aeto ieilt s2uluvs u4artrio3oo1fmDraivo s)s2to(o ny1opt  icia( aDurxr ;t0ape miciyd aDeanvp;()alxrxf3ootom rln sls0srxm(o3ny1lpee nvt ( s2uaurpot4texo o3iltlm rm(mo;() exrxo iodlmte neil( t
\ No newline at end of file
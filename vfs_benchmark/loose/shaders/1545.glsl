@@ -0,0 +1 @@
+n o;s srtoxmpiudape  ivtas)sDrm(rooo4oet iociytlm2ul(vo u)trtrmoctydlmDr ivi;t)sexoxr3nu1lm   netat)srrmur ou0tetniiciatfm umnvo t4 eeriociydfaDelivo s t2xrir3iodlm elfcils  Dtmuro;u4tpe ioeiat aDel(vo ()aexnmo ta1fptr uvo s  2xoxm3iu1lltnmnctls  2tr( p;t4alenmo3iysfs2uaumpnu) etoxrciadop ranvi;t0srxmxr io4ole mnet tfarurxmpno0aet iieiltls2ranmo u0 exoif3oadlmDeluei () etoxmpoodamtn fvs (f Dua( p;t0ole mociad m2rl(vs (4 lxoio oatfmt  u ilt  exmiopou4olen nvia() 2ur( pou4apx io3ildlm2rmnms;()tetrif3tydfmD lnvo (  rumio3nodape lneia(  2trx o;t4apxnif3iys mDua(vo;(4tlxoio3oydomDrli ols0 2xoxrpou4op n fvs t  2ur(r nt1opxnmf3iasfa2elnmo u) renmo ia1omtrln i;s0seurxo iu1opt  nviasfsrra(m oo0aptomf3tadlm uauvpnt0trtnxr ty1fat  ues t0t2uoimpny1llee fet (  2umur ot4ope iictas sDelnms;t4tlerircoy1fm  lu sl() rum(rpnu1lltn fcsat arraxro;o1tpxoifcildla rmn s;(4trtnxfcta1lmDrli o;t)srtm(m ny1lmtelfeiasf 2trumoot1tptnif3iadfaDel(vpn(4texnmoctotlmDrau s;() eur(r oo1alt lnvslt srtaxr oo0tpxomi3ilt a rlu ont) etrxociy1fmDr ieslt t2tr(m oy1ole mfet tf ruaxm ;u1tetomfeiltls2um(vp u)aetnxfctadfa elieilt0seumio3nu4ll e ies sf rtmurooo1ole iietlslm2rln o;t) lxnmo ty1fptrlieslt0t2xo(r iudlp e ict s a2tmu ono0opt  ocildlm2ra(vpnt0trtnmr iadla  luvo;s)srtmxr3oodomtnmfetasfsDta(rpou0optoifctls aDuanmonu4 ltnxoctodoa eanes;s)t2xmirpoudame mneia( sDtru p;t1tle if3ias s2rmump () rxoxo3iadomteli ols)seumim oodol n ivil()s2ra(mpnu4aex ifciasls ranms;u4tetrxr3oy1fm  li o t0t2xoxr iy4opeemfcsls aDtr(ront4alx mfetldla2elnvont4tltnmr3oo1op raueslt s2tmim3nu4al nmietas)a2um(  nt0oee ifeiltlm2em( p u4teerxf3ia1lp rlnvo;s t2urxr oy1oleemfctl( s2tmu pnt0olxomoeiatfm2eanvpnt)texnxf to1latraieol()t2tmio no4ame livtas) 2urxmoou1tpx  iciatlm eau o;u) eenmr3totfaDr ues t  rxrimpiu1amt  nci ()a2trxm nt4alen ociyt m ea(ms t0teenir3iy1fpD au i;s  rurxm io1ap  lfetlt) Drm( oou4altomf3ildlm2ra(mo;(0aexoifcta1om  luvo;t0seur(m3io1am  lfvtl() rtrxmpno4opxn iciysls2ul(ms;t0trtoiocoy1oaD  n s t s2tr(rpiu4ope miet () 2rmxr no0teeo octadfm rmnmo;u)arenxrciadlpDr i ilt)texoio nu1openmnvtlt a2rm(root0oeeomociadla ra(ms;u0tetnxf3oytlpte n ils teum(m ny1amt mfcil() rtm(mp;t1opx mo3ilsls2eluvs u0trxoio3tydfaDe i s ()trtr(opny1ap nlnesls)s2tax oot4tpx  fetltfm ran p u4 ltnmo iatfmDelu o t s2xm(m oo4lleelfcil( sDuaurpot0aexoifciydlaDuaumpn()tltrxfctodom rlu ils srxmxr io4am emncs (f Drrxr ot4apxoiicildfsDua(vp ()tetrmo oadlmD auvo;( srurxm nu4ap elictl( a2tm(ronu1tlen oeiasls2um(ms u4alxrifcoatopDrauei;s)tetoir iu1al elnct s  rurxmooo4opt mi3iadlm2elnmon(0 ltoxf oydfmteluvs s t2umirpoy4lltemicia()aDrrx p;o1oetomoeiadfa2rmnms;(0trtnirciotfat  ivs () 2umxr nydlleelfei tf 2umur ot4tptnifciad aDrau o;(0teeoifcoy1lm rau o t)tetmxopny4ol elnes (faDtmump;t0olxnifeiydfs2uan o (4 lxoxr iotop  lues;()tetoxr3iu4omtn ics s artm( pot1tpxo o3tas s2ul( o;u4arxoiocoydomDr u o;t  rumxr3iu1oltemfesatf Drax oou0tleo o3ilt m ua(mp;(4arxrmo tytlmte u i;t  2uoio io4lmee fesat) 2uaum oo4oexnmfeiydls rmumon(0 rxomf iatlm e n s ( trur(o oudaltnlivtl( srtrum nu0olenmfetyslsDrlnmp (4tetrircoadopteanei t  eumxopnu4optnmfeiasfs2trxrp;u0tpto o3iytfmDua(mo;t) rtoxr3iatomtrai s;()t2tmim ou4lltnlivtltfa2uaxmoou0alx mictatfsDel(ms;t)texnif3oa1omtraies;s)srxo(m3oudlpt livt s aDrmxmoou1aexniietytls2ra(mo t4 rxrxr3oa1opte ueslt0s2tr(opoydlme mici ()aDraur ot4alen ictaslaDea( o;t0 lermrcty1la   uvol() exr(r3nu1ap nmicia(f Dum(rpot1apx mieilt m2elnvs;t)areomrcoodom e ues (0 rtmirpio1ope  iesa()srurumo;o1open icils m emnmp u0 rtrmrcoy1op rlneils) rtoxr nudalt mneilsfaDuru  ;o1aeeomo3tydfm2ul(ms;t)aexnxo iodfp e u olt)tetm(r3ou1altnlfvta( arrr(mpoo0tltomfetldla2emumo;t4 lermocia1laDeluvs;s0 rxr(rpnudoltelnei tf 2rru pou1oee  fciaslm elu p;t4aetrifcoa1lm   i ol( t2tmxr no4omtn ict s aDtrx  ;t4oltn o3iad mDul( pnt0arxoxo oytomte nei s0 2xoir3nodlm emivs t srrm(mpou4aptn oeiasfs2ulumsnt0trxoxf oo1fmD  ueil(0seum(opoudlmenmnvil(fsDumxr ;o1oetoioctytlmDra( p;t4tetnmo to1opDrlnvo;s0setrimpoo4alte fvilsf 2urxrp;t4tleniociasfs eluvont0 ltrmocoytfm  aneo;s0tetm(r3nodlmtelfesasfa2ra( oou0aptnmf3tyt sDumnmpnu0 etomo3tadlatelu i ( srxo(o3ou4amee ieia( sDrm(mont4tpto octad aDea(vpn(4 ltnxoctodlmDe ieil(0 exr(o3nu1ape  neilt) rrmxmp;u4tpt iictld s2rl(ms;t0areoxf3totfa   uvsls sruoxmpiydop   fvs t)arrr(rp;o1aptoiocilt s ea( p (4arerir3iadopDr ivi (0setrir3io4ol e ieta(fsDtmxmo;o4aexo i3iat s2eau p;t)tlxrmf3oytoaDelu i;s) rtoio3iudap  mici t)srrmxr ;t1olx mf3tld s eluvp t0tltrxo3todfp rli i ()seuoirpoudomen neiltfaDua( pot1olx ifeiatfmDulumpnt) exnio totfatrlu sl(0 rxoxr3ny1alee feilsfs2ua(mono4olx iociasfm2ran s t0tltoxocia1la e nei t) 2xr(o3no4op elfvi s  rrrxmo;t4olxoiocilsfm2eln onu0 lxnmo3ty1latr n o s teurim3ny4op emneils) rtr(mooo0tlt moctls mDuaump;(0trxomo3iatoat  i s;( t2urim oudlpt lnvi ()arurumpnu0opx mietas s umnmo;u4aeeriocia1lmteaueols0setr(m3iudom  mictas) rtmumpou1tpxn ieiad m2ul( ont) ltrmfciadfat  u o;t  2xrio3ny1ol   ies t)aDururo;t4tptomi3tysfaDrmn ont)trtrmr3iodopDraieilt)t2tm(m3io1ap nlncslsf 2raxmpnu1opx miciltfm uluvo (4arxoir todfaDeau s s)sexo(mpiy1lptnlietls a2rr( o;u1tex mi3iad m rmuvpnt4arerxf oo1op elneo;(  euoimpoy1ope mivsa()artrur ou1aetomocilsfsDra(ms;t0 reoir iotoat  uvo t0trtoxrpou1lpe liet tfsrra( o;t0oetoiociydfa2ul( sn(0tetrif3iadlaDrli s;s) eumxrpnudlmenlivs ()aDuaxrpoo0oleo o3iasls emumo t0 rxoxr3to1lat lnes;t setrio3oo1lpenlfei sfa2umu  ;t1apt ii3iytfsDumnvsnt)aexomr oa1oa raivo;s t2urxrpnodomtn ies tf Dum(  no0tet  iciydfa2em(mpnu4tlermf iodlpD  i i;t0 etoxmpiydlpeelieta()a2tmurp;o0opxn iciat aDulnmsn(0trtrxocoatlptrluvi;()srxoiopio4lm  lfct (fa2urxr no0optnif3iysla emums;(0artnio ta1om rln s;()s2xoxo3oy1lmtnmnctas) rtruroot4aet ioctat aDrlnvp;u4aetnxo3todomtranes t)trxriopou1amtelncia()srrm( o;t1aleomociadlm elums () rtnirctytlmDelneslt) exm(opoo1lm e nci (f Dumuroou1altn i3tasfa ua(vp;t4aleoircoydfpt ai il() rxrir3nodlmt  fei (f 2urxrono0opeo oeias s2rlump u4alxomr iydoa raneo s  2toim nodap  mfvs ( sDtr(rono4oet mfetltlm ea( on()aexoifcoytoaDe u s;t  euoxm3oo1lpeelnet () Drrxrono0tetnifctaslsDua(msn()texoxo iytlaDrln ols)t2ur(o3io4lpeemfet ( a2ur(rp;o0tet ifeiytlsDua(vs;t)trtoxf oydla r nei s)srxmio nu4amt  fvi ()a2um(rpnu1aexniiciatfs eau ont) etnxr oo1lpteli il() eum(m no4op emncs sfa2tmxm ;t1aexoif3ildfaDuan o t4tlenmocto1fp eln s t0tetr(rpny4lleelfvtlt s2rm(rpou4oee mfeiaslaDra(vont) rtomo to1lmDrli s;t  2umxr3iy4lmenlncilt  Dua(roou0aetnmoeiadfm uauvont4teenmo3iy1lpt  uvs (0texmimpiudomt  fvt ()srtaumont1optn feiyslmDeaumpnt0aexrxo iodlmt  i ils)trtm(opnudol   fvsl() rurx  ;t1altnifciasla2ua( o (0trerif3oatop rlnvil(0srxmimpoy1alt lnct ()srua(root0tleo o3tyt m2rlu o;t)alxomr3ootomteauvi;t0t2uoxr3ny1optn neilt a2ua(  nu1tpeo fetldlsDuaumo;()areomr3ootomteli il() 2xoxo oudlp emfvils)a2taxm no4tpx  icilslm2rluvo;u) etnxf ia1fat auvs;()teto(rpoo1llenliesat srtaurono4opxoioeiat a ua( p;()aetoxrcoydfm eln slt)t2xrimpno1olee ietlt) 2urx oou0oetomi3ilt mDea( p;t0 ltnmfciydfa e ueil( s2xr(opoo1lm elict sfartmxrp;u1ale mietlt s umn p (4tlxnmr3iy1fa  ln sls0s2tmxo3nodape lnesl() rumxmpou0opeoifetat aDeluvs;(0 lxnir3iy1laD lu o s0 etoim3io1oleemneta(fsDraxmpou1tet  oeildlaDeauvs;t0 rxniocoydoa ean s t)trum(mpnu1alt livsasfs2rax  ;o0altoiieils sDumnvsn() ltomrctatlp rau o t)t2xoxmpno1lpeemncils  Dtm(mont1oet if3iad s2ra(ms;u4 ltnmocoodlpDelu i ()trtrxo iu4oltelfeta() rua(monu4olt ifciasls2ul( o;() ltoxr iatomtran s ()s2uoxopoo4amenlfvtl()aDtm(  ;t1teto f3tatfaDum(vs (4trxrmf3ia1omt lnei;s)sexoxo3io4lm n ieils a2urxronu1texn oeiadfsDrlumo;u4 rxrio tydfmD ai ilt trxmir3io4am   iciat) Duau pnt0oee  ieiat m emnms u0 renir todfpDe i o t0 rum(opio1ap  lfet sf 2uaxront4olto iciaslsDraump u4aeermr3to1lpteln i;t t2xr(rpiydll emneilsfs2trxrpou4olen ociatlaDra(vo t)trenirctotoa elivi;s0s2urim3io4omen nci t  2rm(mont1tlt  fciaslaDua(ms;t)trtomf to1laDeaivs t0s2trimpou4ope lnvs t) rta(r ou1alx mfeiydlmDumumonu0areoxr3oadom e iei () 2uoxmpiu1am  lnetl( arururpoo0apxnmf3ils sDrl(ms (0altrmr3tytopDeliei;t0t2xmxm oodopt  ivi ( aDumx pnu1tlt ii3iytlm eln p u4 lxrifcty1lmtraivsl(0 exoxm3nu1alt mivtlt aDtrumpnt4altn i3iltfmDea( pnt)alxnmr3iadoatelnvsl() exo(opny4alt lfvilt)aDtauroou1oet  i3ilsfsDuaums;t4teerxocoa1oaDrlneil()trtm(m3iu4lpe  fei (  2taxr ot1olx mfeiyd s ulumon(0 ltnmr oydlm r n ils srxmxr3oy4lme lncs t s2ur(rpnu0tlenifetaslaDrmuvp t0arenmo3oodoatelues;()trtmxrpny4olen feil(fsrrmxm ;u4aee mi3tasls2umuvp (4 eeoif oytlp eauvolt0srtoio3ny4altemfvtl(  2rau ono0alt io3tatls2emuvont)trtoxf iatop eaivs () etrxm3iu4ame  ivs sf 2uaumpnt1texo ictyt a2ulu o ()trtoiocoydlatrln o;t  rurim3io4amtn ncs s) 2raxrp;u0aex mo3ils s2rlu s (4 rtnir3oadlaDrluvi;s) exoimpoy4amenmivs t  Dtmuront1tlen ocildla2rauvp;(0trerirciadlm elnvs;s0 2um(o no1op e fetl( aDraxm ot0teeo icildfaDemnmp (0 rxnxf3iatomD  n slt t2uoxrpou1lpeemies s) Dtru  nt4opt iociaslm2elnms;(4 eeoir totfpDrlnvol() rurimpnudlp nlfes s arra(r ou1optnioetatls ra(vp;u)texrxf oodoptrlueo t) rto(m ny1open nctl( sDtrur ;o4apt if3ilt mDum(mpn(4aeeoir3iydlm raneo s) rtrxopoo1ap e fcs (fsrua(r ot1alto fciad s el( p u0altrmo3totomtrlnei;( srtm(opoydoltnlictl()arrr( oou1alxnmf3ild sDea( o u)texrmfciadlm elu slt seto(m iy4lpe mfci t  Dtr(mont4apxnmo3ilt m2umump (4arenifcoytfa eaues t texr(opio4lpee icil() rrm(ro;t4aptomictldlm2elnvont0tleomr iydoptelies ()seumxr3ny1omt lnci s arrmumoou4tlt ii3iasfs2rauvpn(0alxnxfciy1latrlu o;t0 rur(opoydoltn iesl() 2um(  nt0oexn feiytla ra(mp;(4 rxomo3tatoa  lnei;s  2xr(rpnydopee fvia( a2umumpnu4tet io3iydlaDeluvp u) ltnxfcio1fa  lu o ()trur(r oy4lpt  fcsa(fsDumx  no1tptoioetyt s2elnmsn(0areomr iy1oat anvo;t setm(r3oy4optnlivtlt)aDumxmoot4tetnifeias aDea(mo (0tlxoifciadlp eli ols)texr(rpiu4op  livsa() rtm( onu1tpe  feildla eanmp (4 eenmo3ootoaD livsl(0 rto(opno1ol nmiesas)srta( onu0olxo fciad mDelnms;t0tlxrxrcoytop  ln ols) rum(r3oy1ol   fvi s)aDra(r oo0altoifeiyt sDulu snt0altnxo3oa1fatrlu ol(  2xo(m iu1ape  icil(f rrrur nu4oexomfctyslm ran p ()tleoxf3tydfa e ivo;s0setmxo no4ll   fciat) 2rru ooo4tpx  ieiys m eln p;t0 reomf3iadoaDr ivo;s s2trim3ou4open ivt t  rtaurp;u4oex iieils m ulump t) etomfciodfptelnvilt  2uriopnu1llee fci ( aDrrxr oo0alenmfcildfs elumsn(4trxoif tadfpteauvo;t)texoim3oo4aptnlnct sfs2trxrpno1tex  fciyt m2rmnmo;u0 exrio3oodfaDe n i s0 rxmim3ny1ll  lnvil( s2rm(m ;t4teenioeilslsDranvpnt)altoif ootlmDe nvs;(0s2uo(o3oy1am emiet t  Drr(rpoo1aee ifcilslaDuaumsnu) leoxoctotfm  lneol()t2toiopiy4amt  nes tfsDua( o;o1oltoifcias a ulnvpnu4 lxnio oo1lp e i o s)teur(rpnydlmtnmictas)sruaxro;t4tpe iocild m2ulums t0trtrxfciytoa  lu slt  2urxopoydll emfcilsfaDuaumpou0aet iocildls2em( o;(4 rxrmf3oydom r nvils srxoxm nu4olte fvtls)sDtm( pnu0tltomfeias s rm( ont) eenifctydomDe n s s) exmim3ny4ll  mnvtlt s2ta(  nt1tleoif3ildlsDul(mo t0alerxo iy1fpte nei;(0sruo(m ny1lmt licta(  ruax oot1tetoioeiad a ea(vo t4trenxfctadoptrlnvsls0teurxrpoy1ope  ies ( arra(  nt1texnmieiatfaDuluvpnt0teeoxrcty1lmte i i;t0t2um(o3iodlm nmnes tfarum( p;u1tltnmocild sDrl( s;(4tlxnmfciatomt  nvo s trumxo nodamee ncs t aDta( oot0alenmf3iyd sDua(mon()artnif iy1latrliei;t0s2tr(r io1lltnmnvtat  2uaur nu1aleo o3taslaDumu pn(0 lenmf todlm e nvo ()seurxr nu1am e ivtat)sDrr( pno1tpt mfciyt a ua(mon()aetnxr3iotfpD  nvi;s) exoxo3ny1ome  nei (  Durx p;o4tex ioeiytfm rau o u4 ltomr io1oaDrluesl( srxmxm oy4ap nmnvs ( a2tmu ont1tptnmfeilt m2eln s (4alxomrctotfpD lnvi s0srtmimpno1am e ivtat  Dtr( ont0tpen oetysfaDrauvonu) etoxo3todfa raieil(0teuoio3oo4lm elivia(fsDtmu onu0alx mieiatla2umnvs;t)texoifcootfaDr n il(0sexrxmpnydllt mnetatf rtaxm ;o4optn oeilt mDuauvp (4tetoio3tydoatr uvilt)sexoxopnodam n ies s)a2uaxrpnu0alxnmi3ilt sDrlu p t4 rerxo3oytoa r ues;(0setoxr iy4am n nvsatfaDtm(r ot1tetomi3iat a rl( o;t)tltrir tytfaDelivol()s2urio iydll   neias) Drrum ou0olxnioeilt s rmu s (4aetrif iotlm  au o;t0 2xoimpou1op emnvs tf Dur(rpnt1tpe ii3tas aDrlnmp;()arxnir3oytlmDraivslt) etmxm3nydom nmfctltf rta(  ;o4opxnmiciasfa2umnvp (4teeomf iodlatr uvslt0texm(mpnu1olee nesl(fsrrru ono4tlxomoctas m ul(vo (0aexnxo iodfmDeli i;s  rum(m3nodll elfesl()s2ua( pnt1oleo o3ilsla2rm(vp t)alxoxr ty1lmtr uvslt0 rtmxopny1aptn fvsat) Draxro;t1olenmieilsfm ra( sn(0arenmocio1optelu il( s2tr(opoydopen ncsa( sDumump;o0tpt mfciatlaDra( pnu0tlxomf3tytop r ues;s trxr(o3oy1apee ies t)a2rmx p;u0tpto fctat sDumnmon()trtoif io1omDeanei;t0setrxo nu1oltnlfes tfaDuau  ot4tlx mfeiydfaDeanvp ()artomfctadfat luvols  rum(rpnu1omenmivt ( a2rau oou0oltomi3iltlm ulumsnt0texrxocoodlp   i o s0sexmirpou1ameemnes (  Dum( pnu1olxo f3tldfmDuanmo u) rxrxo3iatfm   nesl(0trxoxrpnu1lltnmfci t  2ta(moot1optniieildfmDeanvpnt4 exnmocoy1lpt aueils  rxoxr3iy4llt  neiat srtruronu1aptomoetltla ra( s;()altoxf3ta1latrauvs;s  rxm(o3oy4alenlictl() Drm( onu4tpt iiciytfs rlnvs;t)teeomoctodlpDe n s;s)s2to(rpoy1op n nct t arum(moot0alt mietytfmDel(vs;u4 exomr iy1laDe ies ()s2xrxr3io1om e ictl( sDrmur oo4oltnmicilsfmDulumo u4arxrio3to1oa  luesl() etrxo3oodlptemnvtls) rtm(rp;u0olxn octlslm2rmn p u)alenmo3totoa rli sl() rumirpoy4olenmfeta( aDurx  ;u0alxomictls s2umn s;t4 etoxrciy1oa rli i s tetr(r3iodlp e ies t)sDrmumo;t1apx mfeiysfs ul(mo u4treriocoy1oaDrau s;( s2xmir3nudomen fvil(f Dtauroou4tpxomf3iysfsDul(mo u0 lxnmfcoydomtrlies s0s2toxm3nydapenlnvs ()s2raurpot0aet mi3iaslaDrm(mp t0 exnmrciatlmtraiesls  2uo(opoydlpt lncsa(f 2rmu p;o1oexn o3iatlm um( sn(0 etrif3tatomDelueslt) exmim iudlltemietas arra(rooo1aexnmociyd aDemn snt0 exnxrcty1optraivi;s0sexrio3ou1oltelfeta() Draumpoo0olenmiciydlaDumump;u4 rxoio ia1laDelnvil() 2tm(m iudolt  nvsat  2tr(m oo0tee iicildls2elnmo (0arxnxocoydlatr uei t0seumxr ny1altnmnci t)s2rrxm ot0tpxn f3iyslsDea(vs;u) lxnmf3ootlp eanes () eurio nydalt  fcs tfsDrmx o;u0alx io3iydfa eanvp;t)artnir iodlaDrli ols) euriopiodll n nct s)srrmx ono0tle ifetlt s eluvpnt)aeenxfcoodla ean ils0t2ur(opiu4op nmiesa(farum(rpnu4apeoifeiyt m em( s t) rtoxr tydfat li ol()srurxm oudamtelnctas) 2ur(mo;u0texomociyt s ul( s;u4trxoir iy1faD  ues;()sexrxopoodap  mfeslsfs2tmxroot1optn icils aDumuvo;t0trtoio totfpteli o t) exrxmpoo4lmtnlfvslt)s2rr(mo;u1tltnmiciyt m2eanmpnt)teermo3ty1opDr ueil(0trurxopoo1lm  mnvt ( aDrru onu4olxn f3ild a2eluvs () rxomfcoadfatr ivsls0srtm(opnu4lp n fvi sf 2ur(ro;u1oexn fciltlsDel(mp;u0 lxomf ta1faDeauesls  2urio nudom  micsl(fsrurx pou1tlx  ieiltls2raump;u4 rxnxrcootfpteau o;() ruo(r iodlp elivils)sDraur ot4tltn o3iltfaDulump;t4 rxrxf iy1lptrlu slt srxrim iu4apen fvtl(f 2uaxm nu0tptomf3iytfsDulnmo;t)aexrxr3io1la   i sl( trurim iydapen ivsa(  Dua( ono1aeenmo3ild aDemn o u0 etrxr oodlm eauvs ()texo(o3oy1aleemfetls) 2rrurp;o4ope mieiydls uluvp;(0trtrxfcoytlpDr uvi s)teto(m nu1amte neias)aDuru onu4alx mfcilsfs ranvs u4trtrxo ia1oaDr iei;(0teuo(m3io1alte fesls)aDtau o;o0oeenmfcildlaDel(vp;u4aexoxr3iodlpDeau i t s2umxmpou4opt micsas) Dumurpnu0alt mi3tasfaDuluvsn(4altnmrcoa1lmtelieolt t2xm(o3ou4ap   icta(faDtrxr ;t0olx mo3tld a2uanvonu4 rxomf tydlmD luvo;t)tetriopiu4alen fctlt a2urum nu4tltoiiciatls2ulnmo (4tleomr oa1lpt  ivslt s2umxmpno4omenmfetlt)s2rmumo;u4oleomf3iyt m2rlu o;(0tlxrmocto1op e ueo;t texm(o3nydolenlnvils srtmur no1oleomocild sDemnvp t4tlxoir oo1fpDrauvi t srxoio nu4omen ncs sfaDtrxr ot0alxn i3ilsls2ul(vsn(0trxoifciytlaD aivo;s)texm(rpou1lpen ncsas s2tmurp;u1aptnifctasls eluvp (0alenxociy1om ean o s) rxo(r3iy4alt  fct (fs2um(  nt1oexo oetlslm uaums;(4tetrxo tydop  au il(0srum(mpiodapen nes ()arrr( p;u0ole mietasfs rlums u0 lenmr oy1opDeauvo;t0trtrimpoudoleelnvta()s2rau poo0opxnmfeiatfa2umumpnu4tlxoxo3totfatelieolt0 2uo(rpoo1lpee nes (fsDrru  ;t1tltnmiciad s emuvp;(0aeeoif oatoat aues (0 2xr(rpoo1lmtemict (f 2tmumoou4opeoii3ilt aDrm(mo u4tlerxocty1laDr neils seuoir iydamtn neils  2trump;t1oex iictadlm elumpn() leomocoydlpDraneol(  2xoxm ou1lptnmfvi t) rrm(rpoo1alto feildfs rln o t0texrxocoatfpt  i ol( teuo(rpio4om n fcsls  2tr(m no0olt if3tadlmDrmu ont4alermf to1laDelnvo;s  rtoxmpio4am e ict sfs2tmxmp;u0apen f3iat m2uln o t0tlxnxr3ootomt  neolt) exo(o oydlpen nvsl(  rraxmont1ole  ocias aDulu o;t)trtoir oa1la  aiei;(0 rxo(m io1amenmfvsa() rta(m ot4oex mo3iytls2ulumo;u0 lenmocoa1fatrliei t0texrxo iy4alee ncsat)srrr(r ot0alxoii3tltls rl(ms (0 exrxfciotlm  auvi t0 rxmirpiu4ole mfct t) Dumurpno1tlxomfcias aDua(mo;(4teerif3iytlp r n il(  2xm(o iudll elnvta()sDua(  ot0oee mieildlm2ua(mo u0trerxo iy1fa r ieils)setrim oy1opt  ics sfaDrmxr ;o1oleoiietatls2raumo t0 rtoircoadfmt  ivi;t) 2xm(rpnudlptelneiatf Dta( pnu1alx mociaslmDrmnvo u4trtrirctodfaD liei;t0t2umio iy1ope lnvtls  2tax oou0olx iieiydfa2uan pnu4teermr totom ran s;s0sexmirpnudol emfesat  2tmxr ;t1aleoifciysls2rm(vonu)tltomf iytla raneolt0sexmxr3iodapt  neslsfsrtmxmpnu1tpen octatla eanvp () rerio oodfpDe ieo s)t2toxmpiodaptelics t)a2ururp;t0tee  feiadla rln on(0 eenmo3ootfmD  uvilt)s2tm(opnu1lltnmnvsat aDur(mp;u4tptniociytfsDul( pnu0teeomf3tatomD  i ol( sruoimpiodoleelfesa(fa2ur(m ;u4texo ietld m rln o;u0teenmr oydop e u s ()seumxr3oy4lptnlivt t artaurpoo4olt io3ils m2eauvp;u)trtoxfcio1fp r neol()s2xoiopoy1lmenmnes tf 2umxm ;o4apt io3tyt aDul( snu0aeermr tytfmt livs t) etoir iu1ol nlivtat)artau  no1tlt ioeiadfs rlu s;()alerxoctytopDrluvo ()s2xoim ou4aptnlies (f rrm(  ;o0ole  i3tld mDuauvs;t4tetrio3oatomtr u i;( srtoim3oodolt mivils)a2ra(  nu4opxnmiciadlsDean o;u0arxnmo todlp   uesl(0s2ur(r3io4oltnmnet t) Drrx ont0aet mf3iytfsDemnvp u4tlenir3iytop eai s t s2to(m3ou4apenlicta()sDtmx pot0oee  ociyt a2rl(mp;t4 rxrmrcio1om  au sl( sexmxr iydapt  ivtls)sDrrxro;u1oeeoiieiadlm2ran o u) rxomrciodomDean s;t0srxmxopno4opteliciat artr(rpnt4optoii3iat aDum( onu)tlxoxocootoaDraivol()teur(o iu4olt mnct sfarraxm nu0tpxoioeils m ea(mpnu0teeomrctytopD  ies;(0teum(r iy1lpeemies s)a2taxrono4altomi3iltls rmn s u4 exomrcoy1fmDe neilt0s2tm(o3nodlpt lfctlsf rua(  ;t1oet  oeiasfa2rl( s;() ltrif iodlpt li s s0srxm(m3io4amt mnesa() Dua(mo;u0tleoioctld m2uaums;t) etoif3tydfptrlies t0 2xmim3iudal   neiat  Dtmx poo0olx ioeils m2emu o u4 exrifctatlm e n sls)s2tr(o3ny4lleemnesa(f rrrxront0olto f3iadfa umn o;u4tleomf3oydlp   ivs;(0t2xmxm3iy4amenmiet ( sDurxmpot1tpx  ieiysls2rm(vo u0 exnmf3ta1lpteai sl() rtr(mpiu1lmtn fet ()s2rru ono4olx mi3iltfm rm(msnt0tleoircoo1fmDranei;( tetr(opoudlptemivs tfsDrax  ou0apt  i3iytfs rm( pn(0 lxomf iotfa   ies;t srtmio3oydll e ict (  Drmu  oo0tpenmo3iltfa2el(von()aeenxf ty1fpD lu i s setoxmpoudomeelfctl()a2tru poo4oex  ictls m ulnvs;u0artrioctatfpt aivi s0texrio3oydol emfeslsfaDurxront4ope if3tys a2ul( p () eenmr iodopteai i s  2xrxrpoudlmtnmietat  Dra(  ou0aetomoetydfaDrm(msnt)texrxo oo1oa  aneo () 2urir oudll n nctlt  ruau ono4oeeomo3tysla ua(mp u4 lxnmoctadfmDranei;s) 2xm(opnodlle miet t)a2ua( poo0tpxn iciat a2ul( on()arxoifctytfaDelnei t0s2tm(rpnydalt  ivils)sDurx ooo0optnifetysla2rlnmon(4arxoxf totfmDrlueolt)seto(r iy1lpeelfvt t)artmu ono1aetnifciadlm uaumo (4trerif todfmDe ueils t2ur(r nudlpte iet sf Drmu ooo1tpe mociadfa2umn o;() exnxr ia1lmD  neil( t2urxo oydlmen nvt ()srtr(m nt1aetniicilslm2ea( o (0artnio3oadoa rlueo;t srtm(opiu1lpeelnvs ()arrrxmp;u4oet  fctadlmDea(vsnu4tlxnifcoatop e ieo t0sexmxr3ou1lp nlfcslt) 2ua(r ;t1olt miciytls emump;()aeeoio tadomDelnvi;s0sexmimpoy1ap nlfct t  2raurpot4altoioeiydlmDemums t0tlxrif tytoatelu o (0 etmim3no1ap elnviat)arrmur nt1olt  i3iltfaDuauvp;u0 rxrifcoytfmD aivo;( trxo(o iy4op nmnei t)aDuaum nt1oexn i3iadfs rl(vo (0 rxrxr oydfmDelies ()srxoxm io1lle lfctatf Dra(root4tex iieildlm2ulnmon() etrxf tydom e uvi;s0seur(r oo1ale  ivils  Drmu o;t4opxoio3tltfs2umuvp;(0 lerxr3oytoateai s;t teurio3io4omenlieia()arrmx o;o0tetomf3ias mDuaumo t)aetnir oo1lm rauvi;( teurir3ou1apte netasf Dum(  ou4opx ifctyd m ul(ms u4tlxriocoo1opDrln i s  eur(opoudameemivtl(fs2rr(r no1oexomfetytfaDem(vp u)trtnxr tadfp r u i t)t2um(opnodome  neiat s2rm( oot0opxomfetat mDum(vo;t4alenmoctodfaDrln olt s2xo(rpnodamtemfci tf rur(mont4olx mfeildfs2ulnvo u0 rxomo oatop ran ils  2umir3iu4ap   nvt ()sDtmx pnt1alxnii3ilt s eanmo (0aetnxo3oadomDranvilt0trtoxr nu1lmen fvtls)sDrrum oo0opt iocilslaDrluvo (4trerxo iotlpt ai o t)trxmxm iy1apt  ncs ()aDtmxmoot0tleoii3iydla uluvo;(0trxoxr3tatlaDr i ol()t2toxo3iu1lpe mici s sDua(moot0tltoifctatfs2rl(mon() ltrmfcoo1lat anvil(0s2xmxr oydllen ivias)artax  ;t1alenifeiyt a2uln on()altnircoa1lpDrlivols  2um(m no1openlfvt s  2rrxr ou1aexoifeiltfs emums t) etnxrciotomt auvol(0 rxmim iydlmenmnct () rrmumoot4oee iieiysfa2ulnvonu0 reomf ta1fa  aueils  eumxo iy4ap   fvia()srrax o;u0oetn i3iatfm em(vpnt4teenir iatopDrln s ( srumxo iy1op emnes (faDtmumo;t4aleo fciyd m eau on(4aexrxrctotopDrlu sl(  exmxo3io1om  lnctl( srrrxroot1opeoifeiydfmDean sn(0 exrxf3oo1faDeaieilt) 2uo(r io4lmt  fetat arrr(mpot1ale  ieilsla2eaumpnt0alenio3iodlatr neol( trtoirpio4ale  fcsls) rrm(m ;u0oleomiciltfs2emnvo (0 eerio iodfm r u i t0trum(o3oy1amt mfvsas srua(ront1oeen oeiysfaDel(vs (4teeoif3ootoa rlivils0trtmxm nu4al nlncs s) 2truro;t0tetn fctlt sDra(vo;(4texrir iadoptrlivsls)t2tm(m3no4olt  fvs ( s2umx ont0teenmieiysfa um( p;t0tetoxrcto1lm elu o s)trxm(r3nudlmte fctl(f rum(ro;u4aex  oetadfm raums;t4 lxrxrcoadla r ies;t)srxoim oy1lpe mictat aDrmumpou1tle  ocild m2el(vont0 ltnio3tytomDe nvols)seur(m oo4oltnlfei ()aDuaxroou4tpx mieiltla ua( pn(4 lenxr totop eli s;( trumxm oodap nlnci tf 2rmuroot1oetomfcils sDum(vp;t0trtrxo3oatlp   uvi;() 2uo(r3oodapenmict s) Dtaxr ;u4aleo ictadlm2ulumsnu)tetrmf ta1faDeli o t t2tmxo3iy1ll emicsa(faDrmxr nt0ape if3iatfmDelu snt4 rtrif3ty1faDelnes;( trto(o3oydlptn nes ( aDtrumoot4oetnmi3tyt s ea( o;u) eenxoctytlaD auei;(0seto(r iydlp emfvi tfsDuauro;t0optomoctld mDeanmo;(4artomfciatfptrluvo s) 2xrxm3nydapeelfcs s  rtr(  no1tpxnmf3tyd a2eaumsn(4arxoxo3oa1fat an il()trur(m3nudlle mieias aDtrxronu4tet ioeiatla elu s (0aleoio tatfptrai s;s)tetrxo oy1lpen ietlsf 2um( o;u0opeomoetysfmDemnvp;t) eeomr3totoaDe uvi t)trumiopoy4altn fvslt  Dur(mo;u0oltnmicildlsDrm(mo ()aeenmoctytom eaueo t srurim3oo1ame miet s artrxm ou0apenmoctyt a2rlnvp;t) lerifcoy1faDrlivo s) rtmir no4lp emfvi t)arrrumo;t4tlxnmictlsfs ra(ms (0 rtomr3iotlpDrluesls0 eto(r nodape mnvtl()artm(mp;o1aetn iciadfs2el(mo;t0alenmo3iadoate i ols0srtoxo no1lptelies s)a2umxrooo0oet  icias s2raums (4 renif todoa eaueolt  2xr(r iodol emnvt t srtmurpoo1aex io3tydlm uln snu4alxomr io1laD aivolt)s2toxmpny1op   fes s  Drau ono1apx  feildfm ra( o u4artrir iodfpD  nvi s)texoxrpnu1ole mfviatfa2tm(r nt1tpxnmictyt m elums u4artrxo3todlaDran i s  rxmxo3nudop elfeil( sruaxm ;u1opx if3tydfaDrluvonu4aleomrcoadomDelueo;s0tetmimpoudlm e fetas  2uaxmoot4oltomociatfs2ea( p;(0 lxrir3oatlmDe ueilt)truo(r3ou4opeemfvs s sDrr(r no4opxo o3iyt sDel(vs ()arxnxoctatfmteai o;(0sexr(rpiy1llt lfvtlt) 2raum ou0oex iiciydlm rauvp;u)alerif oy1omte n sls  rurir oo4optemietat sDrrx  ;t1tlxniictlsfaDrmnmp;(4trtrir3oydfa rluvo ( srxrxr3iu4amtelnetasf rrmu  nu4ape  ieiasfsDra( pnt)altomfcio1lmteluvols) exmxmpiy4op   nes t  2uaxrpou1aexo o3tltfmDem(mp () lenmf tydfptr u il(0 2trxo iy4olee ncia(fa2rrxmo;o0tlt  icilslaDrlump u)trtnxr tytoa  au ol(0srxrxr iu1lp n neil()sDrm(m ot4apxomociasfm2rmums;u0texnxrctatop  aivil( srum(mpoo1lpe mietls srrmxr ;u0ole io3ildfm eln o u4trenmf tydfaDe nvolt0 rurxo3nudomtelfcils  rumur no1altn ietldls elump;t4arermrciadoa e nvil() euoir iu1am elici (f Durxrpoo1tpxoiocilt m2rmump;t0tlxnmr3todfa rauvols t2xoimpoydlpe mics (fa2rmu  oo0oexn ietysfs uln onu4 reoiocoo1omt aivs;t srum(opiudap elieta(faDtmxr oo4olx ifcilsla eanmp (0teenio3totfateln olt  ruo(rpiydap nmici s srrr(  nt0alx mfciytlm2uanvs;t0 etoir todfa e iei s  2xoio oy4lp n nvslt)sDta(  oo4tltomf3ildfa rmu pnu)aexnmr oytomtraivi;s0tetoxo3nu4olenmfvtls)a2tm( p;u0olxoiociasfa2rmu sn() leoircia1om  an slt t2urio3nu1oltnlivsat)arumxr ;t4olenio3iadfs2ranvp;(4 rtnmr3todomtean i;(0t2tmxopoy4lpe mnci t) rrmxro;u0ole iietys m2ua(msnt4 exrmfcoydfp e nvolt srto(r nu1am nlfcsltfa2tr( ont1aleomiciltfaDuln s t) rxnmo oytlmt  ivs ()texo(rpoudole lfvil(fsruaxrp;u0tlt mieiyslsDua(mo u)teerio todomte i olt)trumxm3ou1lpe  fcs s)artru  nt1opt mfeiysfm2ranvs t0texnmf3oa1fpDrli ils)sexoimpoy1lpe lfcs s)sDraum ;t0altomiciatfs2uaums u) reoxrcoatla   uvsl()teumir3oodlpenliesatf Drru  no1oleoio3tad m rmn p t4 rtoxf oodlptrlueol(0 rxoim iodlpenmnvs t)aDrrxrp;o0oet  o3ild m2eluvp;u)arxrircio1om rluvi (0srtmim3iy4alee ivi sfs2rau  ;o1tee  f3iatfmDean o u4areomf3tydlmtrli o t  ruo(r oy4ope  neiat)a2um( onu0oetoii3iasfmDrmums;(0 rtrif iydlaD lueo t0trtoio ny4ap nmnvilt)aDra(mpnt4ope  iciadlaDul(vo t4artomf3iodoaDeaivi;(0 etrxm no1aptn nctatf Dtm(rpot1alx mfeiytfm uanmp;u4 renmrctotfatraivil( t2tmxm no1olt lnctltfs2rrxmpno4tlt moetytfm elnmsn()artnxociydlptr ivsls srtmxopiy4om e iesat s2tau o;o0teen o3tys m ean p;(0aleoxoctodfa   uvs t) 2umiopny4olee nvtls) Drrurooo0oleoif3iatfaDra(mpnu)tlerxf3iatlp  livi t  2xoimpiy4lm elicsa() Drrx pnu4apxoiiciyd a eau on(4aeeoifciotlmDrai i;t sexmxr oydopenlicslt srra(mo;t4apxnifeiat m2raumon(4 rxnmfciytlm elu o t seuo(m3oy4ome liet s sruaurp;u1ale iieiysls2eln p t4aetrmr iotfm  lnei;t teurxopnydalt mnvta(f rtrurpoo4alt moeiydls2emnmp t)trxrio3iadlm ran i (0 2to(opnudllt mneil() Dtrxm ot4tetnmi3ild sDrm(mp;(4tlenxocoa1laDr nei;s s2umio no1apenmiei (f Drax ono1tpxomictltfm2ulumon()alxoir oatopDeluesl( trtm(o no4amt mfctlsfsDtr( p;o0oetoif3tatlmDrlu o (4tlerif3oatlmDranes (0s2urxm3oo4amte ietltfartmurpoo4aetoii3iys m um( o;t)artoir3oydlm r neils0texoxm3iu1ol n fcs t)srtmxront1apenifcildlsDem(mp () eenxo3ootomD li i;() ruriopoo4opte ieiat)arurxrpnu4tpx ifcildlm2rm(mo;(0aexomr oatlm  anei s0seum(rpiy1olenlnes (fa2uaxm no1tlxn fctatls ua(vo;t4tlxnxo iatopt li olt)srxmio3nu4ap nlfvt sfsrtaum no1apxnii3tyd sDuanvp u0tltomrcootfm   nes (0 2tr(opiodopen nesatf 2taxmooo4ale ioctad a rl(von() eenmr3tytop rlneols s2tr(r iudllt mfes ( a2rmurpnu1aleo fctyt sDea( o;u)altnmocty1opt lnvsl( texm(r3oy4apt  nei t  rrmx oot0aex mfeiysfaDemump;(0arxrif3ty1lp eluvo t0t2uoxr nudamte fcia(fartru  ot4tpx  iciasls rm(vonu0alenmr3iytlatelues s s2xmiopio1olte ncsa( aDraxmo;o4aetnmieiysla2em( snt0 rtrxo3iotoa eaieolt0tetm(m ny1lme mfetl(  2umx  ;o0texoiiciydfaDemu p;(4 exrxf ta1lmt  ivilt teum(mpny1oleemivilsfs2ta(mp;t4oet  oeiltla2rmuvp u4aexrmr iydom rauvo ()srto(o ny4lltn ncs s  rumxroot1oexoifeilsls2ua( p u)trxnmrctytomDeln s s s2trxr ny4ap elics t) 2uaumpot0oet ii3tydfs eaumo;(4tlxomocoy1la eauvol(0 2tmxo3iu1lmenmics ()aDtaurp;t0opxnmociys a2um(vonu4treoxocio1lptr uesls  rtoimpoydol nmfci s)aDrmxm ou0apeoifciltfa rln s;u0aexnmr3oydfm   nvs;(0 2umxm oy4optnmiet t aruau o;u0texoioetadls2ranmpnt0 etomo iy1lmDrlneol( trxoir ny4lm  licias)s2umu ont1tetomf3tytlaDrmuvpnu0trtoir3iydomDrlivo (0 rxmxm oydamt  icsl(  2umurpot1tlen fciysla umuvs;() etoxr3ty1fpte ivi t) 2tmxo io4lmt lnei t s2trurpou4apx  ociytlm2rmnvon(0 leoir3iodfmDe i s t t2umim iy4omeemfvta() rtr(mo;t1altnif3iadlmDranmont)tlxrxr3iodlatr ivi;()s2trxmpnydap emnes () 2tr(r ;u4texnmo3tysfm2ul(mp;t4 rermo ootlpD  uvs;t0trur(mpnu1omee fvt ( artaur ot1ape ifeiadlaDul(vp (4trxoxoctadla eaivi;( sexo(r3oy1ap   ivsls)s2urx pou4openmfetlsfm2eln p ()texnmr oo1faD  nei s)tetmxo3iu1opeelici t s2rrum no1oeeo iciysla2eanmo u)aetoif oodlp eaivi t tetmxmpiudom e ivia( srtmurp;t0apxoio3tydfsDemnvp;t0 reoircoy1lmD  nvol( s2triopnu1lmenlivtas artmx o;u0alt  fctydfmDem( s;t0aleoxr3ty1fat aivs t  rxrxo oo4openmnei ( srum(m ou4aeeo i3iatfm2ua( p (4trerxf3tadfmD luei;t0 exr(opiy4ap nlivs ( aDua( oot1olxnmoctlt a rlumo u4 exrxo oadlmDrlivs;( trtm(m io4lm  mivt s)s2rm(m nu0olxoif3tld m2rlnmp u)artrxfciytlp r uvils) eto(mpoy1om  mict s)s2tr(mpou0aexnmo3tytfaDuaumo t0altomocty1fpt  nvs s)s2tm(rpnydale liei s a2ta(mpot0oee if3iyt aDran s u)tlermocio1fm rli i ()t2toir io4ape mfct ()aruru poo4tptoifeiatlm2ra(msnt4tetnxf oadfmDrln i;t)t2um(m iodopt  fcias)s2rruro;t1texomo3iydls2el(mon(4 renifctadlaDeln i () 2xrxo nu4lptnmfei tfsDum(mont1aexoio3tyd s2ranms t)alxnio3tytoaD  nvslt0tetoim iy1optelnvtat  Drrx ooo0olenmoeiyd s2ua(mo t4aeenxf todopD ln ol(0 rumxm iudamt  ncs (fsDurumpno4tleoifciadfm ul(ms (4aeeoxo3oadfm e n o;s  etr(opoodop n ncs (  Dra(mo;u0oexn feilsfm2ea( pnt0trtnir todomD lies s  2xmxmpoo1alen iet (fa2tm( p;t1optn fetyslsDrmu s t4alxoif tadomDrlneo;(  2xmirpou4lmtelnct s)arrrxm nt1oexnii3iatfmDua(vo t)arxnir iodlatrln s (0 rxoir3ou1apee fcs tf Dtm(mpnu4ope iieiltls2umuvp t0tlxrxo oy1fm  luvi (  etoim ou1lpt livils)arumxrpnt4oeeniociyt a rl(vo;t4tetoiocoatlptelneo;()tetoio3nydllenmfvi s) Dtmumoou4tlxnif3iytfm2eanvonu0 eeomr ia1fptr ieo t trumxo3iodal emnctasfsruaxrpoo1openii3iysfm eau snu0 etomfcoy1om eln o ()seumxmpno1ol emnet s aDum(m ou4oexoio3ilslaDra(ms ()arxnxo3tytfaDe ieol(  2to(m ou1alee neia(  Drmur ;o4alt mfciydlm2eaump ()aetoir iydopDeanvs;s sexrio3ou1ol nmnei (  ruaur ;t4aexnmictad aDean on()areoxoctytlmDe ivi t)texo(r3ny4om nmici tfs2umxm ot1tlenifciat m2um( o;u4 renircty1lpD aies (0 euoxo3nudapeemfvt t a2urxrono1tleo iciat s2rlnms t) rxrmocoydlp   ieo s srtrio iodap n ncs s)a2ra(m ot4aeenmi3tytfs ea(vo t0alenxrcoy1om e n o;t0trxr(r3iodll elnesls)arrm(m no1texniociatla2ua(vpnt)aeenxr3iytoa ranvi t)teurxo3no4lltnmivs s aDrm(m oo0optnif3iyd a2emnvo t)alenir3to1fp rlnvo;s0s2tmio3nu1op  livsas) Dtm(m ot4aeeo icias sDra(mpnu4aleriocoa1opD  ues () 2xo(mpiu1ame  feilt sDta(rpou1optniieiatfaDulu p t0trtrxrcta1fmt  ivslt)trurxopno1olt  fcta()artmur oo0ole ifeiytfa uluvp;t) ltoxociytlpDe iei;( teur
\ No newline at end of file
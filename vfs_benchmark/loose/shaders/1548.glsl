@@ -0,0 +1 @@
+ueols tetoxo nu4om n ncta(fs2ua( pno1aetniocilsfm uan snu)aetnircoodfpt lnvo;t srxoxr3oo1lmenlfviltfsrta( o;o1texoioeildls emuvp;(4aexrxf io1lmDe i s;t) ruoxrpnydlp e ivsat)srrmxm nu4altnifetyslaDrmn ont4texrio oy1oateln slt) rtoxm ou1omeemncta(  2ururp;u1tex if3tytlaDemnvo;(4texrmo oytfmDr i o t s2umxmpnu4ome lnet s  rrrur oo4altoif3iytlaDemnmp;u4 exnxocia1fa ranvsl(0 rtrxm3oo1ome  nvtls  rumumo;o4alt ioeilsfaDrauvs t4alxoif tytfa r nvols0 eumir3ny1lmen nvs s  2um(mont4oltomietysfs2emnvonu4 rxrmo iadomtr n s;t0t2trio oy4op nmfcil( arua(r ou4alxo ietytlmDeanms;t) rtrxr io1fate ivol( trtoio3iudoptemiei (  Duau  ;t0tpxoio3tlslsDulumont)trenxfciatlmDrlneils)s2urio io4lle  nvil()aDuaxmo;t1olt  o3tat m2el(vo t0texoxfcoadoaD lueo;s0 rxmio oydap   nci (fsrrr(mo;o0altnmocils aDra(mp u0 reomf3tytlp e uvo;t  rxmxr oodoptnmivi (  Dtr(ronu1tpt iicias a ranvs u)tlxomr oadopteaneils0trtrxopnu4ol nlnctat) rtr(  nu0opxnif3tls a ranvsn(0teerir3oydfp r u i;s)s2toir no1olte fvt (  rtr(r nu4tlx mo3tlslm2rmu p;t0altnmfcoatom   u s;t0 rtoim3ny4op  liei tfa2rmu poo4oetoioctydlaDua(mp;() leomocoy1lpt  u sls teurirpnu4aleemfvsat)s2rr( p;t0altn fciat sDem(vpn(0 rxrirciytoat  u o;s)srurir io4olt miet s)s2raxr no0olx ioeiyt m2ulnms;u)tlxnio totlpDran s;( s2toiopoy1oltelfvslt  Duaxmpno0alxo o3iyd s2ulu o;u) rerxo3oo1lmtrlues;(0 exoxrpou1llenmfvsls)a2rrurpou4tlxo f3tadfa2rm(vs;t4 rxnxrciodop eaueilt0texrxm nudap  lfcslt srrax p;o4tlxniietlsfa2ul( o u0altrxr3oa1fpDrlieo;s)srxrio3oydlp n fvia() rtm(rpnt1ope  o3iadfm2um( s;t0 leoxo oytom e n s (0s2uoxo3no4ap n icia(fs2rm(roou4apxoioctysfsDeanvp;u0 exnmocio1fmDe n ol(0s2urxo3nu1ap nlivils  rurumono1tptnmoetytfs2ulnmon()altrmf totoptrln o t)trur(o3iu1ap nmiesa() ruax  nu0tet  o3iltlm em( ont0arerxf3to1fa elieol( s2ur(o ou4ol elfcsas) rtaur ;u1alxnmieiytls2el(mo;(4teerio3ootlpt auesl(  rtmio nodopen netls sDumu pot1tpxnifeiasls2uluvpnu)trtrioctodop rlivs (0 etmio oo1lptnmivi t)arraum no4teeomfeias m elnvs t4 rxnmo iy1fmD  i o s0setoio iodlltn fei ( aDraurp;t1oeeo fciysfm2elnmpnu4altrioctadoa rlivs;(0sexrxm oodlp   fvslsfsDuax pno0ape ifctls a2uauvont)tetrmrcoodfpDranesl(  rtmir oo4op nmneiltfaDtmxmo;u1olxo f3tlsfs2elumo;(0aexomo3ia1op elu ols0seuoxm3nodlpt liei ()sruru  ot1olenio3ildlm2rm( s ()alenmf3iydfmtrlneils t2xoir3iu1oltemfvt t sDtax o;u4altnmoeiaslmDeanvs;u)aexnirctotoaDe n o (  etoirpnu4omtnmivsa(faruaum oo4olt ifeilt s2ul(mon(0arerxo3iodlpDr iei s0setoio3ou4lle liesltf Drr( ont0ape  octyt sDea(mp u) etoiocoatlm  anvsls sexmxr no1altn fvils)sDtaump;t1alto fctat mDrmu o;t)arxnifciy1fmtrlu i;()s2urxr oo4amtemnct (faruax  nt0aetoio3iysfm ra(mp;u)teermocio1laDeluvi s srtmxopno1optemfvtlt) 2raur oo1oet mo3iadlmDulnmont4alxnir3iodfpD  uvsl(0 2xoxm3io4altelnvtasfarrru o;u0olenmietatla2ea(mp t0tlxnmo oy1oaDrau i t0 2xo(mpoodaptnlneiat  Dtrx  no1tptomi3tltfa2em( o t0trtomf3iatfptelivs t)sexrim3nu1llenmfesl(faDrm(ro;t4oet mi3iat a2em(ms;t4 exnmr3iy1fmtrlueo t0s2xoxm3iodom n fcilt)a2uru pnu0tlxomocias mDum(mp u0 renmr3iydfpDe u s (0s2tmio io4alt livslt s2ua(ro;t0olxomi3tys m uan o;u4altrir3oy1fpD lueils)setoxr3iu1altnmnctat) Dumx ont4tpto ieilsfmDrau pnt4trtniocoatoat  i s;s0s2trimpoo1ol nlfcsas  rum(rpoo4opt  ociasfm eau s ()arxoio3oytfpD  uvil(0trum(r oo1lmee fvs t  2ra(  oo0olx ioetyd s2uanvo (0artoif oydlm rlnvo;()s2umimpoudomt lfvia()arurum ;u4aleomf3tyd m rln s;t0aetomo totoaD auvs;t  2xrimpno4am emnctlt)s2rr(  ;o0altnmo3iasfa2ul(ms;t4alerio tatlptrauvs;t)trtmxrpiydoltn fcs sf Dtmx oot4altniieiys aDua(vs;t4teeoif todomDe ivs ()s2triopio4ap emivi t) 2tru  oo4aexo oeiydlsDuluvo;() eeomocootfm   ueo;()srtrxr3oydalte fci t)srrmu  ;o4tpe iictydls2ul(vont0aetrmociodom eli o s  euo(r no4lpe livtls artaxmpnt1alt mfeiatfm2eaums ()trtomf iodla r uei t) exrxr3iodal  mneiatfsDta( ono0apt  ociaslm2em(vo;t0alenif3oydlp rln s s0 etrir iu1amen ivt s)aDumumpou0openifciadfaDea(ms;(4trxrmo iatomte u o t0 rtoirpoy1am   nvta()aDrmurooo0apenmieiytfmDrlu o (0aeerxo iotlp eaivolt)t2xr(r3ny4altn ivtlt)aDumump;u4aexo ocilslaDemnms;t0 lxrirctydlm e i il()trxoxr3iydaltnmiei s)srum(  ot4olxn ieiatls umnmp u0arxrif ta1fmD lnvs;s trxmim3io1om   nciatfsruru ono1oee ifciyd sDumnvpnt) rxrif3iy1fa  lnesl()t2toir no1ame mncs ( artr( ooo0aleo o3tasfm2ulnvp;(0trerxociadfat auvs;t)tetrxo oodale mnei t)sruaxm nu1optoiocild mDulu s t0 lxrifcio1lmte nes (0sruoim no4apenmfes ()aDrax  ;u4oex  f3tytlaDrmuvs;t4 lxnxr totfaDr n slt t2um(rpoy1ol  lfes (fs2raxmp;o4ole io3tad m2ua(mp;(4 renxo3oodfpD aieo;s0srtm(rpiydaleemfctls sDtrxr ou1aex ifeiytlsDeau pnu0tleomr3to1fm raivi s  rxmir nodlm  lncilt)sDtmxmono4tptn octydlm el(vo u4 etnxf3ty1lmt lieo ( sexrim3oudapeemfesl()a2ra( ono4tpenmfetys aDrauvs (0tetrif3oytfm  auvs s s2xoxo iodom elfcia()srtrumonu1tlxomi3iltfsDemnvsn() eeoifcia1om eau sl() rxm(o iodome  ictltfs2uaxr ;o0tetomo3iysfa2rm(mpn(0 eerxrcootfp rlneols)teumio3nydlm   ivtat  2urum oo0opt if3tatfm em(vsn(4trtnmo iatfp   neo s setm(m io1al elietl( sDtrxmoou1oeeo iciys m2emn o;u4 eerifciodop elu o;t0texoir3nu1al nmfvi sfsrrm(  ;t1teeomfetys m2rmnvo;t) rxrio3oatlat anvo s)sexr(m no1lltnmicsatfsDraur ot4olx  o3iysfs rmu pnu0 etoxo oadlp  an ol()trxmirpiy1ll  lnvtltfs2trx p;t0oltnif3tld a ran o u4artoio3oa1op  anvolt)trumim3ou1alt mfvia() Drmxmp;o4olx if3tldlsDrl(vsnu4trxnxf oa1fm e ueol()setm(o3iodam n ieil() rrmum nt0aee mf3ils mDelu snu4 rtoxr3totfaD aiei;()t2umxrpno4apenmfctlsfartaxrpou1texomoeiltfa ra( o;u4 reniociytomDran o t0sexr(o3iu1ape mneia(f ruauro;t4oexnifcilsfm uau s u)trxoirciotfmDrluvils teuoiopou1llt  fctlt aruru oot1tpt moeiys sDel(mp;u0tleoxf ia1faDraneolt s2tmxm3oudalt  ivia( sDtm(moot0tlx  feiatfmDean ont4 lxoifctodlpDrauvo t0seuo(o nu4lpe miciatf Dtaur ;t0apt ii3ildlm2eln pnu0aeeomr3iydfmD luvo;t) 2tmxm3nu4ame lnvt tfsrumu poo1aetnif3iysfs um(vp;t4 eenmfciodlpDraivils0 2toiopny1am nlnct s artr(r ou0aleomietat mDeluvp;u0 lxrxo3totfmD auei t0s2trir iy1apt  fetl(  2trxmo;t1alt mi3iydlsDumuvs t4aetrircoy1lp  luvils) 2uriopoudlm  mietlt s2rrum oo0aleoiictls s uanvp;t)tltnif iotlp  ai o s0t2xm(o oudame mnei s arta(rpnt0tptnmfcilsla2eau pnu4alxoxo oa1oa  livo s)trtoirpiudapee iesatfa2tr(moou4olen ietys a raums (4 lxomo iatlaD  ivil() 2xmir iydomtnmnvsl(fa2rr(m oo0opeo ocildfm emnmo t0altnxrcta1fpDrlueolt s2umio oydlp   icslsfsrtrxrpot1olt iocildlsDrlnmp;(4teenirciatfpDeaueols)texo(opoydome micia(faDtmxm ot1tetoifctyslm ea(ms t)tlxnxfcia1fp eanvo (0 rtoxm3ou4ll  mivt t)a2umum nt4texnii3iyt a2ul(mont)tetomocoa1lmtr uvol()t2umim3oodlpen fvt ( aruaxmpou4tpto ictys m eauvsnt4trxoio oodfpDe u il()srtm(o ou1lpt mfvi t  2rmumonu1tpe  ieiydlm ua(vo t4teenmoctatlm  aieol()setrio3oudape mictat)sDta( p;u0olen feiltfm2umuvont4aetoir3iytfat  u i s0t2tmio3oy1oltnmnet ()arum(rono1opxoio3ildla emuvsnu4arxrmocta1la   uvi;s t2xoim3iudlptn fcsa(  ruaum oo4apt  fetltfs rm(mpnt)artnmo3oo1oa ean il( setoxrpoo4ll  mnet ( sDtm( poo0tpx  ieiyd mDrlums t) ltrxf3tatlmteli o s0 2um(r iy4llt  fcsa(f Dururonu4ole mf3iydfa2uau pnu0 etoio oa1lpt lieo;t0trtoxopnu4ol   nvi s s2tau pnt4oet mfctltla umumpnt4treomr iadfm e ies;s) rurxm oudomee nes (fa2ra(m nt1aetoio3ild a2um( p t)aeeoircta1fa eaivi;( s2xmio iudllenmneta()srrrurpno0teenii3iysls uluvsn()alxrxr totlmte u i;s)srtr(rpiydomen net sfa2ra(  no4oleo ieiyslmDelnvp;u0aeeoxociadopD lneilt t2xo(r no1lp e ncil() rraxmpnt0aetnifcils a2rln p;u) etomrctotlmDeli i;() rtrirpoodlp  lnvslt) ruaxmpnt4aptn feiat s2umn p;u4areoxo tydoaDraivils) 2xrxr3iu1omt lfci (f 2tmxmp;t0ole  o3ilslm2elums t0 lxrifctatoateaivils)s2xm(rpoodlmt lfct s)artrxmonu1texnmfctlt a2elumpn(4 eermf3oo1lpDelnvs (  2uoim3nydlp n nci () Draumpou4texnmoeildfaDrlums;() leoir3oa1omt  u o t0 2xmio iu4ll e fvs (f 2um(r ot0tpeomocilsfs2rlnmsnt)aeeomocoydoaD  ivols)trumxo io4lm emnetat sDtmu poo1tptnifctatfs el(vp u4trtoir todla   n ols0 rumxr ou1lmtnlncsl(farua(r ;u1alxo ietatlm2ua(mo;u0alxomo ta1oateaieo s0 eurxm iydape lfvtlsf rrrurp;o1olx  octysfsDea( p t)tlenmo3iydlptr n s s trtm(mpnu4lpe  icilt)artr( pno0olx iiciad s2rau p t0 etrxr iy1laDeau ols0setr(opnudll elieia()aDtru o;u0apxn feiys s em(vp;u) leomrcoytfp  luvo t tetm(r oodamen ncsas) rurum ;t1aet  o3tldlmDul(vp;u)aleomr3iy1fmtr u s;s0sruoxopiydlltemfctltf Draxr ot0aetniietadfaDrauvsnt4 lenxr3to1lpDrlivil() 2tr(rpny1om n netl()srrmur ;u4aeenmfctaslaDrmnmsn() lenxf to1lpD lues;t0s2xrirpnu4opte ivtltfsDrm(r nu1tlt iictyt a umu snt0aetriocoatom rlneslt0trtoxm oydlm e nctl(  Dtr(rpno1aexo f3iad a2ua(mp;t)trxrircta1omDeln ol() 2xoim3oy1olen icil()arraxmpot0teen fetas s um( s;()tetomr todlpDr n s t0 2xoxo oudlme mnctatfarum(ro;u0olxnmf3ilsla umump;t4aeeoiocoytomDr u s () rur(rpiy1opee nci tfaDuaxmonu0aee mo3tyt s2um(monu4tetnxfciadop rlu s;t)setr(o iodllen fvia() 2ra(  nt1aptniieiadlaDua( on()arxomr ootomteaneo;t  rxrimpoy4al elnvta()aDtr(mp;o1texnmiciydlsDul(mo;u4aetnxr tadoaDr i o;()srur(mpoydaltnmies s s2umx  ;u1alen i3iysfaDrlnvpn()altrirciotfmDelivi;( trumxr3iodapt lfei ()sDumu  ;u4oetniieiltfs rl( p;u4 lxomocoo1lmt ai ilt0srur(m3iydapt mfci tfsDtrurpno1olt ifeiad s2rau s;(0altnir iotoat lneil( srtoiopoo4opeemfvs t)s2trxmo;o0tlxo oetyslm2ua( s t0teeomfctatlmD livils t2trir oo4lle  fei t) 2tm(mp;o1optoif3tat mDuau s;u) eeomf3tydomD lieil( s2um(r iudllenmicias s2tm(ro;t1teenifeildla2rmuvo (4artoxo ty1fmte iei;(0 eur(mpoo1lpen nctlsfaDururpot4altomoeiadlm2ea( p u) rerxf oa1fatranvi ()teuoimpnu4lmtnmivs s  rrmxrp;u1tetoif3iysls2rlu s;u) eeoxf ta1lmtean ols)teuoio3oudlm e neils  2rru pno4apxn iciytfm2um(mp (0aexnio3tadfaDrluvs s trxmio oo1open ncsltfsrtm(rp;t1oee mieiad m2emuvp (0 rtrmo oadlmDranvo;() etm(m3iodamenmieia( sDtax o;t1tptnmfeiydlmDeanvo ()aeerircoy1lp raivilt trum(r oy4lmenmfesatf Dtaumonu0altnifcilslmDran p;t0 etomr3iy1fat li sl()tetr(o iy4lmenmivsat)srrrum nt1oexnmi3iatfs2el( o (4arenmr3tydfa eli s s trtoir3oydlltn nei sfarraxm ou4oexomoeiyslaDrm(mpnt0trenmr oodom rauvilt)trur(o3no1llt mnvils) 2umump;o4olxnmfeiydfa2emu p;(0 lxoir oydfpt luvols) rxmir ou4lm e icslsfa2rmxrpno4opxniociltlmDuauvsnu4aeerxr3oy1oat auvi;(  etrio3iy1llee fci sf Dua( poo0tet moeiltfa rmump;u0 lxnxfctadop rln ils0 2trxopno1apenmivsls)srtm(mp;u1ole  fcils sDranvs;u)aleoif tytlate i olt  eto(o3oodopt lnvi (fsDrmump;t1opeoiiciyd aDra(vsn(4aexrir3tydomDr ivo t0 rtmir ou1omt  fei s  rrmu pnt1tpxomf3ilsfs2emnvsnt)teeoxr iotfatraieo (0srtmxmpoy4ope  fcias a2tmxrpnt0tle mfeild mDemn p;u4tetrirciydom r neils) exrxrpiu4lmt mnvtl()a2rr( pot0ole mo3ilsfs2rm( p;t4alenir iotlp r n s t)srxoxr oudolenlfctasf Duau onu1oex mietytfs umuvsn(4 lenmocoodop eanes t srurxr3oodape mfeias s2umurp;o1opxnmfcild aDuau s;u0arxnmrcootomtrlu olt)srtmimpoy4am  lietasfs2raur nt1alt  ieiyslmDumnmon(4texrxo3totfmtrlu o s teuo(o3nudlm nliet s  Drr(m ot0tpxnmfeiatfm uaums;u0trtrxf totlate ieo;t0sexmxopoy4lleelneias) Draumpot4oltn i3ilt s ea( pn(4arxnio tytlatr n sl( srumirpiu4alt  nesltfarrr(m nt0oex miciad a ua(vpn()aetnifcio1fpt aueolt) euo(r oy4lptnmnvtas)aDtau o;o0tlx ifeilt m2umnmp u4aexnxfctotfmDrlu sls0s2tmio iu4ll nlicia( artr(rooo4tleo fciasfa2rmnmp u0 exnmo iotlm eau i;(0srxrxo3iydom  lfvslsfsrumum ;o4opx mociadfa umumo (4alxnxocoytlmD  i ols0 rxm(opou1lpte netl( a2rm( pnt0apto oeils m2em( snt0teerxrcty1fpte n i;t) 2toxopiu1oleemivils a2ua(mpoo1oex ioctasfs2uanvont0tlxrmf3iadlaD livo;t0seurxmpoo1ap   fvtlt  2umx pno0aetnifcildfaDeln s;u)aeeoxr ty1faDeliei () 2xr(m iu4alt lfes tfaDta(rpnt1tltnifciytfs eauvp;t0aexnxr3ia1oaDe nei (0truoio iudlm  mivsasf 2rmu pnt1opeoioeiat s2el(vsn()aexnircoadlmDranvo;(0 etr(mpoy1alte feia()a2tmu  ot0oee mi3tatfs2rauvp (0 exoio todfa elu s;() rxoim3oy4oltnlivslsf Dururoou4tptnmieiltfmDulnmsn() eeoxo to1la e iei;()tetr(rpoudlmt mivt tf Dta(rpoo4aexnmoeiatlaDel( onu4arerir io1fpD  nes (0 ruo(opiodllen fvtatfarrrxmono1aleomfetad aDuau onu0tetoif3ia1faDelu i;t) 2trxr oodlp nlnetls  Duaum ;t4opxomo3tad s2rluvs (4 lxoifciatfaDe uvo t s2uo(o3io4olt  nvils) rta( pou1aptomocias m ulums t)alxnmo3totlaDean i;(0 etrxrpoudlltnlncs t a2tr(rpnt0tpeoiociatfs ulumpn(4tltnxo3ia1om e ivilt)trtrxo oo1omte ietl(f 2truro;t0opxomociydfaDum(vs;()trxoxfctydoa   i s s0t2xr(r3oo1ll  livt t  2raum ou0tex if3tat a el(mon(0aexnifctydfa eanesl()teur(m nudlmt  net ( a2urx  ;u0texnmo3iytlsDemuvpnt4aleoxf3oadfatelivols)teurim3nu4op elnct sfartrumoot4aexn feilslm el( on(4texoxf3to1lpDranei;t0truoxm3iu4lle liviat)s2rm( oou4tlx  octatfaDua(ms u)alenif3oodfm rlies;s0s2toxo3iodapenmfct s)aDtru oou0tpt  fciysfa rlu s;t0 lenxociodfp ran slt) rtr(o3nydalt lnesl()s2urxrpnt0aetomo3iytfmDuanms;(0teermfctydfaDelivo s seurxr nu1al e nvs ()srtm(mp;u4aleoiocilslmDea(ms;(4aeeomrctadla  luvo;t0tetr(o iu4op emfesasf 2urxmoou4alxo octldfmDrmumsnu4 reomr3ootoa rlues s)tetmxr3iudlpe mfesa( aruau ooo4apeo octysfa2uluvpnu0aetnmr ootfptranvslt s2tr(m3oudop elnesl() 2urxm ;o4tpeoifciydls umuvpnu) leomfctotlpDr neo (  exmirpno1amtn ietas)srrmumo;t4ope ioeild m umnvo (4artrircoa1omtrluvs (0s2xmxr ny1amtnlnesat  Duauront1olt  i3tysfs ranmp;u) ltnmo ootfm  lnei t0 eumio oo1open ivsl(fsDrrxront0aptnmi3tat mDua( p;t0tlenxfctadfmtranvi;t)seurirpio4ol  mnes t  rum( pou0ape  icils a em( s;()alxrmrcoydoat livilt)t2xo(rpnu4lm  lncs t)sruaxmo;u4altoifciydfm umuvonu0aexoxo ootlmte ueolt  2xm(m3oo4lp nmfci t) 2tmxrp;t1olenmo3iasla um(ms t4artnio ootlmtr ieo s)srxr(o3ny1omtn fvi tfa2ta(rpno4tpe mietlsfs2emumo;t) leomfctotop raivolt  rxrir3io1amtelnvi (f 2rrxmo;u1tleomfctysls emump;u0artoxr iadfpD lnvs ()srto(m oo4apenlfcilsfa2raxmo;u0oleoiiciyt mDua( o u4 ltoio iatlaDrln slt  etoxr3iy1ale mics sf Dtmxrp;u1oexnmi3tlsfa rluvs u)arenirciytomDr neils)trtr(r3no1lmeelieil()s2rru ont4tltnif3iyd aDrln s;(4tlxrirctadlm rln ol() 2umxm3ou1ll n nciat)a2tm(rpot4tlto f3ildfs2uan s (4 rerxr ootoaD  nes s)t2xm(o oudop  licta()srta(m ot1opxo iciysls em(mo (4teerxr3oy1lm r uei;( s2xmxopiy4lm  mfvi t) rra(moot1alxo ociadla eau pnt)trenxo3iytfm raivi t) 2tmxm3oo4am  mfetasfsrumxmp;o4alx mo3tldfa2rlumo t0aexoir3iadopt lieo;t  rtmim oo1omt  nvs ()s2umur ;u1openiieiyd sDrlnmp;u0altoxo3ootfa ranvols)s2tr(o3nodlmee ivi t) rur(r nt0oee mieiltfs2rmn o;u4artrxf3oadopt aueo;( setr(rpiu1llenmfcils)a2trxmoou4tee  feiltfmDuaumonu0alxrir tatfmDeanvslt0texr(mpiy4om  mfcsl()s2ur(mo;u1tptnmf3ildfmDumnvp u4aetoio3iatlmDrlneolt)s2trimpoudom nmivil(farrmurp;u0oetoiieilt m2rmn pn(4alxnir3ia1fat  uvo t teuo(o ny1op  mivi sfsrtr( pou1apeo ociatla2rlnvp u) lxomo3oodom raieolt0t2toimpiu1op emiviltfa2rrumoot0oetn o3iaslm uan snt4 lenxrctotlmtelnei;t teurir iudlmen ncia()s2umxmooo1aleo o3iysfm elu p (0trxrmf3iatfm rlnes;s)seum(r3io1ol nliei t)srrmxrpoo4tex mfetls mDeanvs;u) etnmr3oatfa  ln i;t0 rtrir3iodal  mnvtlsfaDrax ooo0olxoiieiysfa2eau o t) exoio oo1oatr ueils)sexm(m iy1lmtnlfvtat arum(mo;u0tlt  fetytfa ranms (4tleoif ootoaDrluvslt)t2trirpoo4ll   icsat)aDtr(rpnu4opeoiietad m rmnmsnt0texoxocoo1lm eanvo s)seum(o3io1aptnmics t a2rmump;t4aee mf3iydfs2um(vp (0tltrmr oatla  aivo;t0trxrxm3nu4olt lncslsfaDuaumo;t1oetn o3iytlaDuanvpnu) rxrir3oy1lmtelneo t)t2xr(r ny1al  mneiltfarra(mpnu0olxn feiydfs ua(vont0artnio totoaDrluvi s0 rxm(o3iu1am nmnvta(f Duaum ou1olt mfcils s2uluvont4tetrifctydlptrlnvol()trtoxo3ou1lm  mfeta()aDrr(rpou4alen fcias s2ean o t0tlerxr ia1fpte iei;() rxm(m3nudlleelfvsat) rtrur no1opxnmociysfa rm( p t4 lerxf ta1faDeau i s)t2trxopiudalt lict s s2tmur nu1opxomi3iysfm2eauvpnu0trenxfcta1oa rli i ( s2uoxmpiu4lm  lnvtltf Durx  nu4aeeomf3taslmDra(mp;u0aeeoxocta1fmt  uvolt0 etrxo iu4ope miesltfsDrrxmo;o1oet  i3tlt a2em(mp t)arenxrciatfaD  u o t0texrxr3iu4ll  lnvsat s2raurpnt0olt mieiasfa2eanmon(4trenxocio1lm ranvo;s trto(m3oodame mnct s)aDrm(mono4oetomo3tldls ua(vpn()areoiocoy1fm r ivs ()srtoxo ny4op n nvtat) Drrx  ;t0tlxomfciatfaDrm(vont)trxnmf3oodfaDraneol() eurirpiu4optelics tf rtr( ooo0tlto ietytfs2eaums t)teenxr oy1latrau o s seto(m oudll   iet s)a2tau onu4tetn i3iatls rlu p (0tlxnmrcootlmteauei;t)srxmio nu1alenlneil()s2ta(m nu0opx if3iatfsDeanmo u4 exrmr3oa1fmDe nvs;t0sexo(o3oy4apte ics (fsrtmxr nt0aleoioeiadfs2rmuvpn()texrxf oadfmt aieo t trtm(m3oudol emfetat)sDua(r nt1tpx mictadls2raumo;u0aexoif3ty1fpD  nvs;() etm(r3ny1am e ivs t srtrumpno0teenio3tys a rm(vo t4 rtoxr oydfa elueo ( texrim ou1amt mnetas  Drrxmpnt4tpxn oeiatfsDrmu s;t) ltoxr oy1fmtrluvo t0 2trxo iydolte feil(f rtr(  oo4alxnioetyslmDra(mont4teeoif oy1optr ivo;t t2trirpiudalenliciltfaDtr( poo1apto octltls eaums;()alxoxr oa1laD anvo s)trumim3nu4lp  mici ( aDrrxrpot0olenifctls aDrm( p;u4treoir ty1lmDrlu ilt) ruo(rpou1amenlivsl( s2uaxmpno4ape  oeiat a2elumsnu) reomrcto1omtranvilt0 exoxrpnu1llenmnet s s2uaxrpoo1oexn o3tldls2uanmp (4alxnio tadfpD aieils0srtmio iy1optemfeta(  2um(rpot4aet moetytlsDumn o;(0tlxrmoctytlmDrauvslt) exrio nu4apenmfvias) Dra(mpnt0aeto ictyd m ulu s t0teerir iotop rli i (0srumir3ny1am   ici tfa2urumonu4tee iiciadfmDranvonu4tetnmo3tytfaDeli sl( srxrirpnudape mivias)aDurump;u0oltnifeias m2uanmo;t0aetnmf iydfat li olt)t2urio3nu4apt mics t  2rmu o;t4tle mocildla2uaums u0 leoif3ia1latranvo t) etoxm3iy1optnmfctatf 2tru  ot1opxnmociyd m ua( onu0tltoir3oo1laD auvs ( sexrio iu4opeemfetls)arrrxrooo1texnmf3tld s uan o t0tlxrxr tydlpDraieo () 2tm(r3ou1ap  lnvt (  Durxm ;u0oltn ociadfsDra(vp;u)trtnmo iodlate n o;s  etrir oy4oltnlfvil(fa2raur oo1tet moetyt m elumo;u)areoio iytfaDeln o t)s2xmir3no4lptemfeia( a2umxmonu4apeo i3tltla2ra( p;u0tlxoif oo1faDr nvslt0tetoir io1opeemici t  rumxmpnt1opxomf3iytfs2em(mpnt)tetrmf iydomt  neol( seuoxo iydolt mfci tfarra(rpoo0tlxoiictydfm rlnmo t)tlermr3io1oaDeli slt t2uoio3iy4omenlietltf Dtaur oo4ole  ietysfsDuanmpnt4 rtrio3oy1faDrai sls0 rxrio3io1ll  lnvsa( srumu pnt1aeen ietasfmDemuvpn(0artnif3oa1oa r uvi t)s2tm(m3oydolen fei ( srtrx  no1texomf3iltfs ua(vo (0areoircia1fmtr nvi;()seuo(m3iydolte fcil()s2tm(mpno1tpe iictltlm2uauvs u4aetrio oadlatr uesl( trxrxopoy4lpenlfvtlt s2um(m oo0alxnmoeiad a2ea(vp;t4 exomo3oadom eanvo ( sruoxr ou1ol emncil()sDua(m ;o1alxn ietys s eauvs;u4 lxrmo ty1fp  au o ( sexr(o3ny4oltemfesat aDua(mpoo0tetoif3iydlmDumn snt0 lenifciydop rlu olt  rum(rpoo1omtelieil()a2umxrp;o0tlx  ieiasfs2umnvsnt0trtnxo3oydla r u i s  2xmio3nodomeemfci t) Drrxro;o0oee mietas aDuaumpnu4tltnir3ia1fm   nvs;s0s2xrim oy1op nlietls sDrmur nu0aee mieiltla2rmnmp;u0alxoif3iytfp e i s s t2tm(mpno4om   ietlsf Dtaurp;o4aleomi3ias s ranmonu4 eenxo3tytlpteln o (0seurxo nu4ale mnvsas) ruax pnu4tlenioctysfs2rlump;t4 etrir3iydoaD lnes;t0 2xm(o3nodaptn fctas)srrr(mont1aetnioeildfs umumpnu) lenxo ta1lmDeai o (  2xrxm iu1alt lfeta( a2tr(m no0tptoiictltlm2rmu sn(4tlxrmr3oydfaDeanes;t)trxmio3oodap nmivsls)a2ra(  oo1oexo ieiltfm um( p;(0trtoio tytlmte ieils srumim3io4lmtnmnci t srtaurono0ale  ictat m rlnms;t0 ltoxr ta1oa rln o;s0 2uoim oo4ameelivi t)aDurxmono1tee mfciat s2ra(monu0 rtnxf tytfpDe ivo s s2tmxm iudop   ivils  Durxrp;u0oee iociad mDrauvp t)areoio to1laD an ols) etm(mpnodol  lfes ( a2rmur ot1tetniietys s rmu p;(0treoxocio1fate neilt0t2xmio nu4lmeelfctas artrum ou1aeeoioeiltfsDranmsnu) exrio iy1oaD luvi s0 rtrxrpnodamen nvsl()srraumpnt1aeen f3tadfs2um( pn(0 rxrir3tydfpteluvi;t)t2trxo3nu1aptn neilt)sDrr( ont1oee ifciadfmDrlnvont4tltrxfcio1laDrauvs;s  ruo(r3oo1am nlncsltf rrau  ;o1tlx mf3tasfsDulnmp;u) ltoxrctodlatelnvolt)trxr(rpno4lp emfetatfaDtruro;u4aee iieiadfm2ul(vp (0 lerif3to1lm eln ols0s2xr(opoodoltnmnvt ()s2tm( pou1open ocias aDrmu sn(0trtnxocoa1omDe ies () rxoxo3oo4apenliviasfaDua(mp;o1alxo fctytfa2umnvs;u)trenmf oo1fatr ivi s0t2toio no1lp emics (  2trxront1tpeoioeiltfs ua(mo;t)tltrmfcta1fa  anvs;t)sexo(m iu4om eliviat) 2urur ;o0optomi3ilslm2umuvo;(4 rxnio3tatfat  u o (0 eurxr nodamtemnetat)a2um(r no1opto fciysfs2rmuvo t4tltoir3iodlmteaneo s0t2urxr iy1lptn fetat a2ta( o;u4tleo ieiat mDulumsnt4tleoxociy1laDrluvo;()sexoxo oodlpen ieiasf rtaxmont1aee  o3iltla rm( onu4 etnio3oy1fm eauvil(0trto(m ou1altnlnetls s2ur(mpoo0oex ioeias sDea( s u0tetnmr ia1laDe ivo ()t2xmimpno1omtn neiasfsDrax  oo4tlxnifetatlm2eaumo (4trerio3ia1fa r ivil(  rurio ou4ol elnviat  Dtru ont4tltn fcildfa emnmp u)trxrxo iotopDelnes;( setr(r iudlm  lfvtls) rtrumont4oee  iciaslm rl(ms u4aleoxrctadfaDr i s;t)t2um(rpoudamtn nvils) Dtaxm nu0tpxnifctytlm2eanmpnu0teenmrctydfptr ivi t)t2tmir no1al nliei (  rtm( pno4tlxo feilsfa ua(vsn(4 etnmfciodop r ivo;s0seum(opiy4olenmici t aDtrxro;o4open ictadlm el(vo;t)arxomo3oo1fmteluei;(0srto(rpnydaptn netl(faDra(r ;o0oltomfeiys m ra( pn(4teerxf3oa1lmDranei;( srto(mpio4lmtnlivta() 2tr(mo;u4oleo icias mDranms;(0 exnmocty1fm elues;t)sexr(opou4lmenmivsas)s2uaum ;o1alxnifcilslsDuau ont4 ltnmrciotfpD  nvils  2trxmpou1ll emncsa( aDtaumoot1ope  fciytla ranvo t0trtrmr3iotlpte u i (  rurio3nydap  lfeils)arraxr ou4tex  ocilsls rm( s u)teerif3tatla raivol()t2xm(m io1lmt lncias) 2urxmo;u4optn f3tad aDul( s t) rerxr3io1optr n i (0 rxrxo3oy1omtnlfvsa( aDrax pno4tlxnio3tadlm umnvs;t4 rermrcio1omteanvs;t s2xr(mpno1omtemfcils)sDuaxmo;o1tptnifciyt m rlums u) rerxocio1optelnes t  ruoxm iudol   ics t  Dur( o;t4tpen ieilslaDulnvo (4artoirciy1fmt lnvi;(0s2xmxopoo4llt mivilsfa2umur ;u0tltomi3iatlmDum(ms u0 rxnmo iatfp rlivol(0 etrim oodaltnlncslsfartr( pou4alxn o3tys aDemn ont) rtnxf3tatlmt aueilt0 2tmio3oodapeemnvtat a2rm( o;t0tex ifciyd mDuanvs;t0tlxnirctodom rlneil(0srumimpio1ome lnvi ( aDrmxr ;t1aleomi3iyd s rlnvp t4tlxnircio1fpt an s t0 eur(opio4ope mfvta(f Dtrxront1olenifeiysfs umnmo (0aetrmrciydfa rau ols0srurirpno1lmenmnci s  Drmxmo;u0tpxo o3ildfm2ranvp;(0altomfciatfp e n i t0s2xoim3oudam e ivsa() Drr( o;u4olt iocild s ea(mpnt)teenio oadlpD lnvs;t  exrxr io1ame mfet () 2rru  nu1aex iieias s eauvpnt0aexnioctytfat  nvo s0srxm(rpnudll   ieil()sDrm(m oo0tetn i3iydls2rau snt) exnxfcoydlmDeanvols)teurio3iudalt livias) rra(m nt4altn oeilt aDemn p;u4artoxocoydomt  nvo ()tetr(r3oy4aptelneils) rtmuro;t4alx ii3iadfa emnvs;()trxrmr iotfmDeanes;(0teur(m iy1amee fei t) Drau oot4tptomieiysls ea(vs (4artnmf oodfm  livi;s) ruoxmpoo4lm nlici t)srtm( ooo1aetomfctatfs2rluvsnu0aleoio iydfa  lneo (0 eurxrpoo4omenlfeias)srtrur ;t1apeo ictyt mDrmuvs;t4 rxomfcoo1opDr iesl(0setoxm oo4lptnlneta(  Dtmuro;o4aptoiictyd mDeanvo;(0 reriociotfmD aueo s0t2uo(m3ou1al nlicil() Dtmu 
\ No newline at end of file
@@ -0,0 +1 @@
+ivslt sexm(r3nu4omen ieslt)a2tr(m ;u0alx moctldlm elnmo ()tetoxrctydopDrli o t) exoxo io4am emicil(fs2tmxr oo1teto o3iad s rm(ms;t4 exnxrcio1lmt an ol(0srxmirpiu1ll   fet t)s2ra(  ;t0tpe iiciadlm umnmo u4aeenxo3oodfatrlnes s0tetmim3oy4lm  mfvt s aDtm(mp;u0tex mocils m2uan sn(4texoxo3iytom e uei;(0 eurirpoy4olenmnesasfs2taur ;u1aptn ieiat sDul(mo u0trtnmo3oodfpDraneol() etoirpoo4om nlics sfarrr(ro;t1tlenmi3iadfsDemnms;t4texnmf todfpt lneo t srtr(mpiy1ame livt ()a2trxr ;u0tpt  o3iydfs em(mo t4 lenxo3ootomDe u o;(0 rxoimpou4al e icil() 2ur(moot1tpxoiiciad a2el(monu)artoxf tadfp rli ilt)teuoxo oy1aleelies tf rtrurpoo4opxoioetltfaDrm(vp;t0tlxnircoa1lmtr uvs;() rumxo3oodllenlictls arumxmpoo0aet  iciydla rl( s;u)aeeoxfcoa1fa r ieolt)srum(opiudlp nmncsl( srtaumpnt1aex  ictadfsDulu p;()arxomo tydlp elivilt0srtm(opoo4op nmncs ()artau  ;t1teeo octytla umuvpnt0tlxomfctytfp eau s s0teumirpnydome mnvtlt)sruax oou0tpxo ieiat mDel(mp;(4aexrxoctydlaDran s;s  etr(m no4al  lnvs s a2rm( oot0tpe ifcilt s2emnvsn()altrxr ta1lmteai o t0seumxo3io1lm emfcia() rrrurpnu1aeeomietyt s2ulnvo;u4altnio totfmDe iei;() 2umiopiy1openlneslsfsDra(mpno0oetnmf3iadlsDemu sn(4teermrcoy1opDelues;t0teto(mpiydamt  fcs s) rumxm nt1apen fciad s el( snu)alenircty1fptr neilt)texmxr nu4op e ict t sDur(m no1aeeomf3iadfsDua(msn(4 ltnio3oo1fpt auvo;t0 2tmxo iodlpeemicilsf Dumxroot4tex mf3iydfm2em( o;()altnxrciy1fmteauei;s)tetmimpou4amtn fvil(fs2raxmooo4aeeoifciyslsDrl(vo;()altrmf3iodlateluvi;s setrxrpno4alt lncs (fs2ur(rpoo1ape  fcild m2uluvo t4texomo oadlmt  i ils0seto(r3iy4ap elfeilt)arur(  ot4tpt  i3iatlsDem(vo (4 exoxoctatlmt  nvo;s0tetrio3oo1llt  iet s)srtr(rp;u4oee iieiys a2rl(mont4tetnio oodlpDraivs (0srtmxo ou4oltelnvsl(farrm( p;o1tetomfciltlsDua( snt) ltnmf iatopDe nvo;s  2tm(mpiu4lm  livtlt)arra( ono4opx  ociatlm2uanvp u)trermf3oydfp   nvolt)tetoirpnodopenlfci ()a2rrxmonu0aetnioetyd s2eau p t0 rxnxr iy1fm raueols texr(opiodopt mfcsl(  rurxmoot4teen oeiat s2elnvpnt)alenif3iotomte ues t  eur(opoy4llenmnesl(  rurxmpno1teeoiieiydfsDra( p;u)tetnmfcto1oaDrau s t  rxmxm nu4olen ivtl( artax  ou4apxnmi3iys s2ulums (4teenmr3tadoaD aiei;t) 2trxr iydol e neiat) rra(rp;o1ape iociasfaDumn sn(0arxnmf3oydfpt  i o t0s2xo(opiudameemfvslt s2ua(rpno1oeeoioeiytfs2um(monu4trenmf ta1laD anei s)srxm(r iudlmt  nvsa(fa2ra(mpou1tpe  f3ilsfsDulums ()tlxoxo oatlpD lu o;t0t2trirpno1amt livs t)aDraur ;o4opt io3iyd s2em(vp;u4tetnir ty1lpDr iesls)sruo(r oudalen ivtls) 2uaumpoo1olen ieiydfs2umnmp u) renif iydlp   ueslt)trxmim nodol n fcslt) 2rm(rpnt0texomo3ildlm ea(vp;t0arxnioctadop eaueo ()texo(rpnudoptnmncs t)aruaurpnu4tlxniieiadfm2ea(mo u0 leomf oy1fptraivslt)seurxm no4omtelfcil()artmu o;o1aetnii3iat sDrmnvsnt4aetnxr oo1oateaues s srtrxr oo4lp nlicsa( a2raur no4altnmieiysfa2rm( p t) exnxf ia1fpDe ueo;t t2um(r3iydope licslt) 2umxmoou0olen i3tys aDuau o;(0arenir iotfaD ln s ( t2trxr iudameelicias  2tmx  ou0tleomfctatls rauvs u4 lxoxf3oo1faDr i i;t0seum(m3iy1apeemnciasfaDtm(  ;u1tptn o3iyt s2ea(mpnu0aetrmocty1lm   nvs s)t2toxrpio1lltelfvi t)sDuax ono4ole ifeild sDrmnvpn(0 rxrxr3oa1omDr uvs ( t2toxr oudomenlfcias artmu oou4olenioctytfm2raumpnu0aetomo to1lmD anes;s seuoio3iu4ol emnctls aDrr(  oo4olxn fcias aDel(vpnu)tlxoxf oy1faD an slt)texr(rpiu4ll nmncia()a2umx pot1apxoiocils m2eau p t4artomfcoadomDrauvs s s2urxr iu1lmtnmivtlt  rtmxm oo4olxnmfetlsfsDul( p (4aeeoxr3iatlatr i i t0s2toxm ou4ole  nvslt aDrm(m ;o4tee mfctys s2ulnmonu0arenmr3to1la r iei s0 rxo(r oy4alenlivs sfa2rmur ot1aeto ociasla2ulump;u4 lermf3todfpDeaies;t0 2uo(opiy1op nmfvs (  Drm(rooo4apxo ieiysfm ulnmp;()artrircto1opt  u o;t)texo(m iu1apenmfcilsfsrraxr ;u4tlxo ieiys m2umu pnu4 ltomf3ty1oaD lieils s2xmxm3io4lmenlneiat sruax  ou0opx mictyd a2rmnvp;t4tlxoxocoatlaDr nesls)trxmxr oy4al   ncil(farum(r oo1tetnii3tyt m2el(mont4artrxr3oy1lp  liei t0teurimpno4ape mfetat) 2tr(mpnu1tpxnifeiysla eluvsnu)arerif iytom e ieil(  etmxr nydlmtn nct tf 2tmxrpnu1altnioeiltfm2el(vp;u0tetrmf iytomt li o;s0t2xrio3nu1ape  ictltfs2uru  no1olxo icilt s2rlnmon(4 etoir iatlmteau ils)tetrxo3nu1lpee fci sfartru  nt1tlxn oetld s2uaumo;t)teeoif3ootlp  lu ols srtoim3iy4op  licil(  Durxm nt4aee  ictyd a emu s;(4tlermf3iytopt au ils)texr(r iydlpt mivils) Dua(  ;o1tetnifetyt a2rmu snt4trxomrciy1om rli o t0srxmir iy1aleemivsl()a2raurpnt0tlen oeils s2elnmonu4alermfcio1fatrlnes;(  rxoxr iy1lpen ieia()s2rr(r ;o0opeo ieiatfm ulumsnu)tltoxfctydlp   i ol( tetrir3oydlmee net ( arrr(mooo4oltnmociltfm2rmnms;t0altrifcty1opD ln olt truoirpoudapeemneil(f Drr(ro;o0apx  octatfm rmnmsnt4tltomf iadfa  livi () 2ur(opoudape lnvi s)aDta(mpnt1olxn fctat a rlnmp;(4arxrmr3to1latelivol() 2trimpnu1ale mnciltfsDuax oot4olxnio3ias m umu o (0 ltrmocia1fatrln s;s srtrio3oo1op e fetas) 2tm(  ;u0aleoio3iyt s uln pnu) rxnxf3iotfmtean slt) rtm(mpny1lltnmivtls  rumxmp;t4apt mietys aDemuvont0tlenifcto1lp eau o t) 2trir3iodll n ieil(fa2um(mp;t4aet ii3iytla ul(monu0 exnxrcoydlp e uvs t0 etr(m3nudopeelicslsfaDtr( o;u1tetnmo3ias mDranmsn() rxrmocoytfp   ivo t)srum(o oudal elnct t)sDra(r no0tpeoifctadfa2em( s;()altnir iodfmD ln i ( setm(m3nydllenliei s  Dtrxm ot0texnii3ilsfs uanmpn(0alxrmr3oadomtelies;t sexoirpio1lm  lncs sf rtr(ront4ale mocilsfmDrm(vs t)trenif3oydomD ai s ()texr(o ny1omen fct (fs2tru pou0opxoifcilslsDrl( o;u) lenxo3io1faD luvsl(0 exmiopio1ap e nei tfa2tau oot0tpenifetysfs ua(vo;() exnxr tatoatraivi t  exo(opoy4opeemnetlt) 2urur nu1oetn oeiysfm2uaumpn()tltrxr tydopt  n s s0trtr(opiodlpeemivsasfarra(ronu4tptn icildfa emn ont) rxomr3oy1lmD lueolt) etrim oudolt mfcsa(  Dumu ont4olenifetltfm ranms (0 rerifciatfaDeln ils setoimpio1apenmiet t srta(  ;o4aet  octytfs rmn s u)texoif tydoptrli s;t tetoimpiu1olte nei t a2rrxmooo1tetomieiydfa2rmn onu) lxoxr3iydfatrli i ()s2xoirpou1lmt lncilt sDuaxmoou4alxo ieiad s2ea( onu)altoxf oodoaD ai olt sruoiopny4omtemiviltf 2trx p;o0apxnmo3tldlmDrmu pnu4 etrio3tatomDrln ol(  exmxo iy4am   ictlsf 2tm(m ;t4tee ii3iyt s elump u4tlxnxr3tadfpD  n o t0 exm(rpiy1omt mnes s  Draump;u0olxoiieildfmDua(vo;t) rerif ty1fp e ueo t tetr(r3iudom n ivtls)srraxrpot1tlx  ocils s2rmums;t)tlxnif3iodlptelueo t srxmiopoudll e fvtltfs2ua(  no1oexnmictatls2rmu o u0 rxnio ia1latelnei;t)trtmim3iy1al e nesa( aDtmxm nt4tetn feiltlsDra(ms u4trxrxf3tatlateauesls0 eur(rpio4ol  lfcsa( sruru oot1olto o3tldls2uan on(4 etnif oy1omte i olt)trurxo3io4ll emicils artaurpnu4teeo i3ildlm umnvs;(4aetrmf3oodfm rauvols0t2tr(rpny4lm e ivilt  2tmxrooo1apeomo3iydlsDrmu s;(0trxoxr3ta1lm r nvo s)seuoxm3iy1ll emfciat s2ta(m ;o0apeomfciatfs2ul( s;u)tltrirctodoaDr uvsls s2tmir3nudoleemiesls) 2ta( pnu0aet iietyt s um(vp (4tlxnxo ia1opDelnei;s) 2xoio ou4altnmivt (fsDur( o;o0oetomfciatla elump;(0 eeomfcto1lm  au i (0srxo(o3iudlmtelfct t srraxr ;t4opxomo3tls mDrmnvpnt4 leomr tatlp rai o;s s2trxm nu4ll nlfcs tf Durx  ou1tpe iietltls2uanms u)tlxriocoadlptean s;s0 ruoim3nudlp emfcs s  rtmx pno4olxoioetas m eanms;t0treomo iotom rlnes (0 exoiopiy1llenmfvs ( srumumont0oeto ociyt mDemn on(4aetrxf3ty1faD  ies;t)s2xrxm ny1amtnmfcsat aDua(mont4texoif3tldlmDua( p () rtnif3oy1fatrauvo;(  exoio oy1altelfctltfartr( p;t1oexnmictyslmDrmnvpnt4tlxrmrcoa1laD lnes;t0t2um(m iodolenmicsat srrrx oou1apxomiciatfmDrmnms t0areriocto1faDrlivs;t)teumim nu1al nmiviatfaDurxrpnt0tpxnmfctltfs emnvp t4trxrio3todfm eai ol( s2umxr ny1olte ivt t)s2tmx o;o0aetnmictasfs2uaumo;(4 lxomr totom   i s;t trtoiopnydlmt  ics s srumxm ot1apx mictld m ua(von(4 rxomrcta1oaDraueo (0 eumiopny1ameemivs sfs2rr( pnu1tpx  ietatfm elu p (0aetnmr tytfm  lieols)trtoxo iy1lmt mnetat srrrumo;o0alto i3iasla eaumsnt4tltnifcoytla  lu o ()teurim3oy4lp e fvsat  Drm( p;o4opxoio3iytfm rm( p;(0aexnmr3iytfm rlivsl(0 ruoirpiu4ll   nvsl()a2urx  ot1aleo fcild mDemnmo ()tetoxfctatomD auvols)texoio3nudlpe mfesas)srtmx poo4olt mf3iltfa elnvs (0 rxrxf3ia1fa r ivo;s0srumxm3oodaptnlfctlsf Dumxr ;u4tpeomo3iydfs rl( p u0tlxrxo iatfpDr ies t  2tm(o oodllt miesls)aDua(rooo4aeeo ietydfmDelnvpnt)aeeoif3oatlmt  uvo ( t2tm(rpnudllt mfeils)s2trxr oo4tle mfctydla2uanvon(4 eenxr3oodlmtr nvo;t)srxmxmpoy1lle  fciat s2um(mpnt0apt mf3iad s2umnvp t0teermf oodfmD li s s sruo(r3oydlmenlnctls  2rrur oo1opx mfcildla ulnmsnu0 lxoxrcoodfpDr n s;( seuo(mpiydlp  livil()srtrx p;o0aetoif3tysfm2ea(mo t4alxrircoo1la   n olt trur(m iu4lmtnmfetlt s2umum oo1opxnmiciytlmDulnmo;u4 exoxo tydoaDelnei;(0s2toim3oydll  lneil(f rraxr nu4opxo feiys s rm(mp;()artnmr tytoa r ieo;s)s2umxmpno4ll emnes tf rrmx  nu1tpen o3ilt sDumn p;u4arxoio3iytlpDeaivo;s setmirpio1apt mfci s aDumumo;t0tptomo3iadfs ul(monu0 exnxrctadom  aies;( teumiopoy4lltemnes (f Dtau  oo0tlt mfciltlsDelu o;t)tlxomf3todlpDr uvils)seumxr3iudlleelfei sfarumxrpoo1apx mieiatls rau o u4 rxrxo tadomD lneo s)seumxm3oy4omtelivtl(fsrua(rono1tetnii3tys a emumpn(4 reoif oy1fate neils  rumxr3oodale livs t s2uaxrono0tltn i3ildls ra(vpnu0 lermocoatfmt lnvo (0 rxrir iu1omte nvta( sruaum nu0tlenioeiadfm2em(vsn(0aeenmf tydom  livs t0 2to(r no4lm nlfeils sDuaumo;t0tpe mietldlaDeau s;t0alenmr3ty1om r ivols) rumxm3oy1alee fvsat s2urxm ot1aetn ictltfsDua( s;u0 lxoif3totoatr ieolt  rxoim iu4lleemiet t srra(mont1teenioetad aDran s u)arxomr3ootopDran sls0trxrxr3oy1oltnmiciasfa2rau p;u0aetnioeiydfa elumpnu4 exrxr iadlpteli s t) eto(m3iudole mieilsfsrrm(mpot0alxnmictytfm eanmo u)tlenmrcoodfp e u i (0t2xmxmpnu1optemneta(  Durur no1optnmieilsfs2rl( pnt)altoir3oytfaD  ivs;(  2xrxo3iudlp e neiltfaruaumpoo4tex iiciltfs emuvp;t0tlxrif3io1lmDrli o;( trtrxmpiydamtemfviasf Drmxro;t0tpenii3tytlsDrmnvon(0alxrxf ia1lm rlues;()sruoio3no4lle mfcil(f 2ur( o;u1ale mfciadfmDulumo;u) ltrir oadoa  luvo s0setr(opiu1opte fvsasf 2rmxm nu0oexnifetltlsDumuvpnt0 exrmo3oo1oat  ies t0sruoio3ny4al e fes tfaDtmurp;o0tltn ictysfa2umums;(4arxnmo3oa1lpteaueo (0s2umxrpiu4olt lnvs tf 2rmurono0aee ifeildfa em(von(4alxrxo3totoaD aivi;t)texoiopoudoptnmfviltfsDumu  ;u1altomfeias m2rlnvpn()trtnmr oo1omteauvo;s0t2xrxmpoudom  mnet (f 2ra(m ;o1teeoifciydlsDrluvpn()aleoxfciadlp  anvil(0srum(rpnudomenlfciltf Dtr(mo;u1oetoio3tyt mDuauvpnu0trtoir3io1oaDr n o;t  2xrim3ny1om   fvslt arrr(rpot4aleomf3iydfm eau s;t4 lxrxr oatlm eaivs t srxo(r3iydapt  ict tf 2ur(m ;o1oet  fcildlm2rluvp;u0trxrmr tadoptrau slt0trxoxr no1am e fvt t) 2trxmooo0oeeoioetys sDum(mpnt4altnmf tydoaDeln o t)s2xm(mpnu4llenmiesl()s2raxrpoo4tptnmo3iydfs ulu o t4artnmr3ty1lptelueolt tetmiopiudlp n nci s srumumonu1altomo3iytfmDrm(vpnu4trtrmr3to1fpDr i s;s) rur(rpny1ale micil(fs2tr(r ;t4olxomoeiltfm2ua( s;u4 ltrxr io1faDraueo;t0 eumim nydll emics (fs2um( oot4tleo icildlm2el( onu) ltrifcoy1fpDrai s t tetm(o oydll n fesas)a2rru ono1tpe mfciysfa uluvpnu4tltomo iytop  ln s ()teumxo3ny1lm nmicsl() 2urxroot0oltomi3iatlm2emnvp u)texomr3iy1lmDrai ils0s2xm(mpiy1lp n fctltf Dtaxrpno4oexo ociydfmDrau o;u4aeenio3tatlaDelivilt) exoxm3no4lm e nvtat)srtmurpoo1tpt mfeiys m rmump u) ltomo ty1laD aueo;(0tetr(o3oo4altelfeilt srumx onu1tpxo ocilt mDum(vo;u4trtrmf tadfpDr i sl(  rum(m nudllee ics t)a2uaxr ;o0tle mf3iad mDran p t0arenmr3iotfmtrauvslt t2urirpny4llt  fcilt srtm(  nu4openii3iatls um( o u4 rtoio tadfmDr uei;t srumxmpno4ope  fci s arrru o;o4alx mfeiadla2ua(vonu0tlenmr3oa1latelivslt)setr(o3iy1lp emictltfarrrx onu4tlt iieiatfsDua( sn(4artomf3iodfa elieo;t0tetm(r3ny4op   icsl() rurumpnu1apxo o3tatla rl(von()artomf to1opDelu sls) 2xoxo3io4al n nvsl(f Duaumpoo4tex ioctytla eaums u0tltoifcoy1fat luvil(0truoxmpnudole  nvi s)aDuaxmo;u4olxnmieiasla2um( s;u)arenirctotopDr ueol()srxoxrpnu4optnlfvsa(f rrrx pnt4oetomi3tltlm2rmu p (4aeeomo3to1fmte neols)teuriopiudlpe lieia( sDurx ono1teeomiciatfsDulnvpn()alxnmr ta1fm   ieils)trxoiopiy4lpe  fvsls aDtmxrpou0oee  o3tyt aDrau s (0arxoxf3ty1fm  anei t0 2xo(m3io4omee fcs t)sDrmumpou4alx mf3tyslsDrmu p (0 rxnxfciotomD luei;t0 exoio iy4ape lnvtltfaDrrxroot1aetn octytls emuvs;u4arerio3oatfaD anvol(0 2xmxo3iu4apenmfvia(f rtmuro;u4aeeniictlt m2rauvo t0teeoif3oatfpt luvi s)trto(m3no1lmtelnvsas arrrx  ot1tlxo f3tat aDea(mont0aeenmf ty1lpt anvi s)trtmiopnydal nlfeia( s2raxrpno4oexo oeiysfa2elnmp u0trxrmfctytlpteaneils trumxo3oodlpenmnctasfsDrauro;o0optnmictls m ea(vo;(0 rtoio oa1op r u i s t2xm(r nu1lm n nes ()aDumxm ;u1alt  o3tysla ul(vont) eeomf3oa1omt au ol( sexo(opiodllee icsltf 2rruro;o4oexo oetldfm um(vpn(0artrxr oytoate ieslt  rxr(o nydlptelivtls) rua(ronu1apxo ieiadfs2el( pn(4 rerio to1lpDe ies;()srxrio oo4apt mietlt)a2rmxm oo0tpenmf3iat a2ul(vo;t0treomr todop  lnesls)s2xrir3io4ol e fvi t) Dtrx  ;o0aet  ociatlm2umuvo;t)trxrmf io1fa r uvs (0trum(o3iydapte ics sfaDtrurono0tet  ocild m2eauvon(0 rtnmr io1oatrlueo;s)tetmxrpio4ale lfvil(f ruax  ;o0oee moctydlsDra(vo;(0 rtrio iodlat luesls srxmxm3iodamenlneil( a2uaumono1tetnioeiyd sDua(mo t0 lxnmf3oydlateaies;t) 2tmio3no4ll  lietat) Drmump;o0oeeoio3ilsfaDrmuvo;u) etnxf3iodlpD lu o;s  euo(rpoudlpte nesas)aDurxmo;o1teenmfeiyt aDrmump t0 rxomo iadlm raivo;s) rtoio iy4ameelfet sfs2rmu o;o4opxnmfciydfmDumnmo;(4tlxnxrciadla rli o;t0 rtoxm3io1ll emnvs ()a2umxmp;t4opx ifeiad sDrl( p;u4aexniociotfpDeanvslt  etr(o3nu4lpen ivt t) Dtmumooo0tptn f3iat a eluvsn(0 reoir to1om r n i (  etmiopno4opt mnetat)a2uaumpno4tle ioeias m eln o;t0aexoxo3oo1om  liei;( seuo(r no4ole lfvt ( aDumu  nu4opto ocilslm2uanmpnt0trtoio oodlmDeaueo;t t2xoir nodlp  mictl() rtr(r ot0aetnioctasla ra( o;u0arxrmr tytoa eluvslt tetr(mpiydameemfetasfa2rrx ont1aetn feiasfm rmuvp t0 rxrioctadfaDeauvs s) rtrir iu4ol nmivtat)aDuax p;t4aptniiciytfm em(vo;t0alxoif iatfptrli s;t0t2trxm3io4om n fvi s) Duaxmo;t0texnioeiys aDraumo (4 lxrxr3io1fa  an s t0trtmim ou4oltelnct (  Dtrxmpno1tltoii3tysfs rlu o t4 ltnmoctatop  lueo;t)trurxo nu1lptn fvils  Dum(  nt1opxoiieiat mDumu s u)artnmfciydfpt aueo;t0s2uoxm iu1amt lfcia(fsrumxmonu1altnmoeild s2eauvs (4 etrmrciotlmDr i s s  eurxopno4op n ivias  Dumur ;t4ope ifciyt s2rmu s (0tlxomrciodfatr uvs;t tetmir iudamt mieias)arraump;u1apt  oeils m umums;u4tlxoio3oadfm rlies s  etoiopnu1lpe miviltfsDur( pnu4oetoif3iyslsDuln pn(4alerircoodlmtr neolt  rxrir3iy1lmtemnes s a2tmx  oo4aex  ociyt mDrmnmp;u) lerxr io1opteln i (0t2um(rpnu4lpeemncsasfaruru  ;t0tee mieildfa ua(mo u4 rxrir3oo1faDr ieol( truoxm nudllenmfct t)sDur(m ot4alxomictldfa ea(mo (0texnmr todomDe ieo;t)t2ur(o iu1amenliet s  2tmxrpnu4aeeo o3iatfa emump;u0teermfcoytopte uvs;(0 eumir nydam   nctas)srumum ot1aptnmoeiytlaDrl(mont4aetrxf oo1fpte nvi ()sexr(m iy4lpeemicslt)srtmu pnu4teeoio3tyt m ulumpnt4trtrxo oydlpt ln ils teuo(r3nudlmen nes (fsDrm(r ot4ale mf3tadlm2rlums u)arxnircoadfm eln olt) 2urimpio4lptelfet () Dra(mp;o4alxnii3ilsls ul(vo u) lxomf oatomD anvol(  etoxmpno1al  mnvsat a2rrx  ;u1texnmfeildls umnvo t4 rtrmrcoatomtelu s;() etmio3oo1ap nmfct ( sDtau p;o0tpeoioetldfsDum(vs;t) etnio3oytfp eaivi s0s2trim3ny1opt mict s)srtmump;t4teto icils s2el( sn(0texrxfcoo1lpDr i i;s)trxrirpny1opeemicsas) rrm( pno0teeoifctysla ua(mp t0 rtrmr ty1fptelnvo;s t2trio3iudlmt lnetat sDrau pno1aeeomi3iydfaDumumo t) lxnif3iotlateanvolt)s2xo(rpoo1alee fcs s srrru pnu1tpe iociat a2ra(msn()trtnmf iodfaDeluei;t  etriopiydole lnvia() 2ta(m ;u4texn f3tldlaDemnms u4 etoio tadfaDeaneo t0 rtmxm3iu4lme  neils a2um( ont1texoiociytlsDranvont4 lxrxo3oatlp r uei;t srumir iy4omeemfeiat  Drrxrpnt1aexnifciltfmDumn o t4altomoctatfpDelnvilt) etoir3oy1lp n fetl()aDta(ront1openmfciytlm2umnmpnu0trtnmf3iotlmDeaneil(  2xmirpiodlm nlfvslt)sDumxront0tltomfetatla ulnvp (4 eerxr3iatomD anvi s)trto(m iy1lltelfviat srrrxr ;u4alt if3tat sDumuvs (0alenxf io1om elnei;t)trum(mpno1lpt lfvtlt sDuaurpnt0apx mi3tys m ul( o t4treoirctotfmDe ivo t t2uo(m oo4llt lictat srurur ou0aeto f3iysfm uau snt) leoif ta1lm elivo;(0s2umirpio4alt miesa( a2urxr ot0oleo fetldls2rl(mont)arxomrctadfm r i s;t) rtr(mpny1opee nesatfs2umxrpou0apeomfeiys a uau o;t4aetomf oo1fpteaiei t)trxo(o oydap emfet t  rtrx  no1aeen ieiyt sDumnvo t0artrmo3ia1fmte n i t) eur(rpiodlmt  nvia()sDururoou0tex if3iaslsDrl(vo;(4aexnir3oydfaDrau o;s0 rtmirpoo1om  miciat srua(roou4tex mf3iys mDraums;u)trxrir3oadop rlu i (  ruriopou1omtnmnvsl(fa2uru ont1tee  octlsla2rm( sn(0arenxrciy1fpt  n ilt)teuoir iy4om  lncs tf Drm( poo1apx  ictatls2elnms (4alxrmr oatop   nvo;s) rtrxo3iodomtelfet (f 2tm(mpno0optn oeiasfs ulums t0artnxocootlpDe uei s0 2xm(opiu1apt mfvsa()sDrrur nu4tpenioetasfm2ra(mpnu0 eeoxfcia1lpDeanvo ( s2urxm no1oltnlfcsa() rum(  nt0olt mf3tas aDrmnvp t0 reoxociytlp elivs;t) etrxmpoydlmee fvi ()aruax  ot1ape mfcildfmDuanms;u4treoxfcootlateaivo;t0 2uo(r oo1ll  lnvtas  Dtmuroou4tpx  feiltfm2ean s;u)texnmfcoa1lmDelnvilt trtoxr oudol emieta(fartrx p;t1teeoiocild aDrlu o t) eermrcio1opD lies t)seuoxm iu4llee ietl(fsrrrxronu4texomoeiatla2rlums (0tlenmr3oydoaD aieo;t)srtrxrpnodlm emfvs (  rtmumo;t0altnmfciyslm2rm(mpnt)arerxf3oa1fa eauvils setoxo nudalee ivilt) Dtm(mont0opt io3iltls2rlnms t0areomr3tatlaD lnvil( s2tmim ny1aptelnciat  rurxmono0oeeomi3iadla umu p u0arxoircta1opteau i;t texo(o oo1altn nvt s s2ta(ront4oltnmoeiydfa2umn p;t0 renif oo1lpDrluvi ()t2xmxr oo4ale livi s sDuaxm no4teto oeiys s rmuvo u4artrir3oatla r ies;( trto(o oudll   nvtasf 2trumoot0tlxo i3iltlmDrl(mp;t) leomfctatlm  aues s t2xmio ny1aptn fes sfaDuax  nt1aetnmfetad a eaump u0arenxrciy1fpteaivil(0 rurio nu1ll e ici s srra(  oo4aeeomiciasla2um(vp;t4tlerif3oydoptrai s (0 2xoxr3ou4apee fcsl(f 2tau  ;t0aeeo oeiaslm2el(vo;t4trxnmf3tytoaDelivsl(  exmxr ou4apt  feias a2tm(  ;t1tleomociytfmDrmu p;u4alenif oo1fpDranvs t)s2um(r oy4ap   fciasfaDtrump;t4oet  iciatla ea(ms;t) etnxr ia1opt an o ( t2xmxrpou1lme  neils) Dumur nt0tptoiieiltla2ranmsnt4 reomociadlat lueo;()setr(rpoodapt lnesl()sDum(r ou4oee ifciat sDul(mp;u4trenmf oadlpt lneo () 2xmxr3iy4optnlfei s) rrmxrpoo4opxnif3tysfs rmu p;u0 ltrxf iy1fm raivi s0 rtoio io4apen icsasfarum(mp;u1opxomo3iltlaDrmuvp;u0tltnio3oytlm elivo;s  etoxr nu1lmtemnes t)aDta( ooo4open fcilsfsDrmnmo;t)aexnxo ty1lmDrluei ()srxm(opou4al nliesat  rrruro;t0oeen f3ilsfa2el(vp;u4 exrxrcoa1fmDr iei;(  rxr(r ou1lm emieil()srtr(mo;o0oeeniieiytfs2ea( s;u)trtrmfcto1fp rluvs;s)t2urio3iudopt lnci t) ruaxro;o0apx moctlsla rm(mp;(4tltoio3iatoptraivslt) exr(rpiydom nlneta() Dumu poo1tee mfciltfmDulump t4arermr3ootfa eli s t0tetoirpoo4apte iesltf 2uauronu4tetn i3iad a2umnvo;u)texnxo oydlat  neolt t2uo(m3oo1oltnmivil( sDrru ooo1opeo f3ildfa2raums t) ltoir3oo1fm  lu o s setoim iu4lpee fctatfarrmum oo1apeoioetytla2el( p;t) etoir3iytfaD li ol() rur(rpoo4alee netls a2tru o;t1oeeoioeiltlmDuauvo u0 eeoio3ty1fpteai o;t0 rxo(o iudal e feiat sruaurp;o1openmi3iydlm em(mp;t4tetnxf3totlp r n i;t  rxm(o3no4ll  mict ()srtru ooo4aetoif3iatlmDemn s (0alxnxo3ia1omteanvo s texrxo ou4ale lfet sf Drm(rpoo1aeeo ociadlm2rl( p (0trtnir tadfm rlnvs ()seurir ou4lm  lnvsltfartr( o;o4tle  oeiad a2el(vp t0trerxrcio1lm eln i;()setm(o3nudale  fci tfa2trx o;t1apeoioeiatfmDrauvs;(4aexrmr iatfp eanvs ()s2tmimpio4lmt  feta(faDrm( o;u4tpt mfeiatfaDulnms;u)treomf3iodlmtr uei;(  2xm(m nu4am nmfciat a2rax poo1opto oetatfmDrlu onu4aexnxf3iadfaDeanes ( srxrio3ny4oltnmnesat a2urxr ou0tpx ii3tys aDrmn o (4arenxf oatfm e i il(0texoxmpno1lleemnvslt)aDrr(mpno0olto ociatlmDranmsnu)altnmfcoydopDeli s;s0srxmir3oy1omenlfei t a2trxm ot1opxnmfetadfsDra( o ()altnir tydomDeanes t0 rxrir3nydlpen ivia( a2urxr nt1olxo feilsls uan s u4 ltoio iatlm ranvo;s  etr(o3io4omt lfei (f Drmx oou1aetn iciasla2rmnvonu0trtrxo iodfpDeanei;s texr(r oy4om nmnetls sDuaur no4texnif3taslm rm(vont4texrmf3ta1faDraies s)s2xrxmpnu4al   fvs sfarrr(rpoo0opt micils s2el(vo;()trenmf3totopt  uvols)trxo(r3oy1lm n nct ( arur(  no4apen f3iat mDrln s;t0texrmf3io1fpt  iesls s2xo(o io1lmtnlncia(faDrruro;t1apx mfeias m2rmump u4tleoifcio1oaDrlivs;() rxmim3iy4olt  netls aDumx  ;u4oeeo ociatfs um(mpnt4 eenxf iytopDr uvi (  rtm(mpny1alenmfvt s) rrrxm ;u1oex  fciyd m ranmsn()trenxr iytfmDrlueo;()s2ur(m3nydlmt mnetat)arumu o;u1ope mfeiadla elu on(0teeriocoytlat  nvi;s  ruoxm3iudop   ncilt)a2ta(r nu4tptn oeilsfm rmuvs u4trxoxr oydop eai ol(0 2uoir no4omtnlfvslt)a2rm( o;t0tlt if3tys mDrl( p u0arxnxocoydlpt luei;t)s2uoio nudaptemivt t)sDraurp;t4opeo ociat aDel(msn() exnxfctytlptrau i;(  rto(rpiu1olenlnei t  Dtr(mo;o0altomieiatfa elnvo;(4trerio iodoaDr u i;(0 etoxr nodlme micil()arumumpnt1aexo ictatls ul( o t0 etomr3iotfaDrlivo;s  etmirpno1ap  mfvtasfaDum(  ;o0teenmi3iyslm emn p u4 exnmo to1fm raneo t setoxo3nu1ame mnvslsfs2tr(  nu1teeoiieiltfa2elu p t0 lxnxr iydfpt lu s;t srumim oydlm emiei () Drrumooo1texnifctasfm2emnvo u4tleoxfcoy1optean olt t2toxo3oy1lmeemivtat arrmump;u0ape iocildls raump;u0artnxrcta1lm  lnvs;s) rtm(m3no4am  mnetlsfartru o;u4olxo oeildls2rauvsnu) eeoir3iotom e u i;( t2ur(r io4lpe  fet tfaDtr(  ot4aptoioeias aDrmumsn(0areoxo oatomD aiesl(0 exoxopnu4omtelnvt t)aDrrumoot1oltnifeiadlmDua(mo;t) lxoif3ta1fptr nei (0teuoirpou1ap e nesat artm(rp;t1oetomoctltfaDumu pn(4trxrirciydopDelnvsls0 etrxm oudopenmnct sfaDtrur ;u4apxnif3iytfaDem( o;u0 rermfciotom   u i t  etrxm3nodopenmfeiasf rtaxr nt0oexn iciadfa2ea(vo t)tlxnif3oadfmte nvo t0srtrim oudamtn ivs ()artmu  no0opxn fcilslmDel(mo;u4 rxrmfctydoaD luvsls)teuo(o3io4ope mietat)s2umur nt4tltoifetadfm2rmumo;t4trxrircoodlmtraies;s)trtr(m io4amt  nesatf Duau o;t4aeeoifciaslm2rlu o;t4 rtnmfciydlat livo s trtrimpio4lme miesa( s2ra(ront4oetoio3tldfm2el(mont)aexnmf todlp r nesl() exr(m iodapen feia( sDrr(  no4tptomf3iasfs raumon(0aetnmf3ty1la elu o;s) ruoxr3iu4lme mneil()srtrxrpoo4apx ifeiltfa2em(mo;t) rxnmf iytfa rln sl( t2xmir ou1omtnmnetl()sruau  ot4olt mfeiatla2ea(vo t0 reomo iadomDraivolt)setmim3nu1ome  fvsatf 2urxmoou1oetoifetat s ran p u0tltrxf oydoaDr uvi s)t2xmxr3iudolenlies tf rrmx  no4apenii3iltfaDrau p;t0 ltoiocto1oaD lieo t srxmir3iodap  lnct (fa2urxrono0oltn oeiyd aDeau on(4texoir tytop   nesls) ruo(r3oo4olt lfvtat)srum(  ;u0oetniieiyslsDrlnvpnt4 lxrxf3todlat an slt)s2trxm nu4ale lncslt artmum nt1aeeoioeiltls uaums t4artnir totlpteai sl()s2umir iydll   ncsls a2uau o;t4oex  f3tytfa rlump;(0artrircta1laDeai i;()t2xmiopio1apeeliviatfsDraxmoou4apt  fctyd a2em(mo t) renif oo1lp elnvo;( s2tmxopio4op emfetl()aDrmx o;o0texo oetlt m2umnmonu4tlxnmf ia1om rliei (0seur(m3iu1olt lfctas)aDtr(rono0oexo oeiytls uanvo;(0 exnircootop  aivs;t0trtrxr3io1ame  ncia( a2ta(  ot4tet  oeias m2uln o;t0aetnxo oy1fat auei s texo(r nydlle mnesls  2um(r ;o0ole mieilt m2uluvsnu)trxoir todlpteln s;s  rxo(o3iu1alt lncslt  rrr(m oo1alx mfctlt s ea( pnt) lxomf ia1lateaneols t2tmxopoy4omtelnvils s2urxmonu1tlx  oeiasfa2umnvp t)aexrxocoo1fatranes;s0srto(opio1ll nlfesas)srtaumoot0teeniictat s ra( s;u) rtomfcoo1lmt au i (0 rto(rpnu4ap emivias  rurx  ;u4tlx ifetldla uanvon()teerxr3oatoateauvs t)trxrxr3nodome  nvtatf 2umxmo;o4ope  i3tysfmDranvp (0texrxf oadfpteaivslt0 2xmim3iu1ap emnvtl(  2rrxm ou0tee micildlm2eauvo;()teeoir3tatoptrlu il()seumxmpnudaltemiesl() rurx p;o4oeenmictydfsDran sn() etrxr iy1omDrln i;s)teurxo iy1aleemnciasfaDtrxmpno0olxn oeiytla emnms;u0aeenxfcta1fa eau s (0 eumxm io4ll nlicil(f Dumxr ;o0olt  f3iyt a elnvont0tlxnxocoo1omt  uvil()s2uoim3iy4opt mfciat)aDta( onu0oexomoctldfa ul(msnu)trenxr oytla eli o;(0 exrxmpiy4olt liet s  rumumo;u0optoif3tas m umnmpnt0trxrir tydomDrau sls)s2ur(m3io1altelfcs t  rtmx ono1olxo f3tat a2ulu p (0arenmrcoydfmt lueol( seto(o3io4lpt mnvs s a2rr(rpnt0opt mictydlsDrl(vs ()tlxomoctytlmD anvi;(  rtrxr nudal   feiat)s2uaxr ;o1optoiietatlsDemnms (0 ltoxf3iotfpDr ieils)s2umir3nydol  mnes ()s2uaxm ;o0aexnio3ias sDum(vont)tlenio tytfmteaivo (0s2toxm iy4op  mieiasfs2raxrp;o1aexo o3tldfsDumumo;()trtrxr iy1lm  lu ol()seum(mpiudopen iet tfarrmx  ;t4aeenio3iasfa el(mo;t0 exnmo3iatfpteauei;t  2xo(m3oudlptnlieil()s2ra(roou1opx moeildlm umnmonu0 ltrio ty1fmt lies;s seuoxr3no1ape  nctlt aDuaumoou1opto o3tysfm ea(ms;u) rtnio3to1la elies;(0 ruoiopiudlme mivias) 2umumo;u4apxniicildls2umnmpn(0trxnmr tytlp  lneslt0 2umimpoo4ol e nvt (  2umxro;t1aexomieiytla rluvonu)tltnif3ootfmt auvils sexoim ny1ol n fctl() rtm(m ou4oetomfetasfa2elumonu)treomr3to1op r uvol( trurxrpiodoltemfct (fsDta(ro;o0ape mo3iydfaDel(mo;u0 rerircia1fatr uvi;t  exoir io4ape micsl() 2umum ou4tlxo f3iysfm2um(vonu)aetnmrctytomDelnvs (0sexmirpou4om  lfctlsfsDurxrono1aeeoifeiadlm umn o;(4 lenxr oodlaD lnvi s seurio3iy4llee fvil()s2tm(ro;u0tetnioetydfs emu o;(0artrxr3oodfmD li o;s) exm(m iydalee fesa(f 2um(r nu4tpto ociydfs2rmums t)tltoir3tydfat aneo;t0 exmxr nu1lltelnesat) Duaump;o1tex if3iltls umu p u) exomf3io1lm  luvo ()srxrimpnydop nlnviltfaDtm(mooo4oltnmfeilslsDumu snt) eeoir ty1op e ueol()srumimpoodomtn nesas)a2rmxr no0tpe mfctatfaDean snu4aexoxf iadlp   u s s)t2xr(m3io4al  mnctas)arumxm nt1apx mo3tlt mDean p;t0alxoir iytlaDrlneil(0 rxmir nu1ll  mfctl( sDua(mp;t0tpto oeiasfaDrm(vpnu0aeeomfctatopD luei t)teuo(mpiu1lm  liesl()a2rmu  ;u4aex if3tls a2uan o ()tltoxr iy1lpD lieo;s0 rxrio3nu1lpt  fcsa(f Dumum ;o1olen fciatfmDrlnvs;u4artnircia1fa  an ilt0s2trim oo1om  lict t) rtm(rpoo0openioeiadlm umn sn(4trxnir oatlp ranvi;t)srxmir3iu4openlnciat)sDrrxrpno0olen octydla rlnvon() exrio oydfpt luvo;()srur(r3no1lp elfcsa( aDrrxront1tlxoifetydla ulnmo;(0aetomo oo1oaDrluei t0trtrim3oydom  lfesatfsrurx  oo4tlxn fctatfm emn pnu4arxrxf3oydfa elivslt)srxrio oodop  mietls  rrrx p;t0tpenmo3iltfs el( o;t4aexrmf iodlat  nvi;t  2trir oodlm emnctas aDtrxmoot4tpenio3iytfs uauvpnt4alxnir iadlaDrliei () exmxm3io4oltn ies t  rua(mp;o0altnmfcildlaDua( pnu)aeeoxocoy1fpte ivs;t0texm(r3oydam nlictat srtrxr ot4oexo ociat m umn o t4arerircootfm elnvs;s)t2tm(rpnudlpe mnvtls)aDrmumont1oeen i3iad mDulnvp t)aexoxf iydoat anes;t) 2xmxo3oodomenliei (fsDtmx oot4ope mictydfa em(vpnu4areomo3oa1lm rlnvo ()sexoim3ny1lle  fctas)a2raum ot1teeomo3tad mDuanmo u0tetomoctydoa ranvslt0 2tm(opiu4aptelnct ( srrrx p;u4oetoiieiasfs em(mp;u) exoio3totlmte n s;( s2uo(o3ou1lm nlfctasf Dtmu ooo1aeen ociyslm2rm( s t)arenifcio1op   nvsl()teumim3oy4olenmfvsat) Dta(ro;u0tltnmieiysls2emumpn()trermf tydoa ranes;t0 rtoimpny4ap e nciat) Dtau  ;t1oltnmo3iysfa2ea( on(4alerxf3iotlaDe nvo t0 etrxmpno4alenlfctasf Dumumpot0aee  feilt mDea(vo;(0tlxrio3iatopt ln s;(0teto(mpoo4al emietlt) Dumxmont0tee mictys m2rlu o;(0texrxo ootlmDran s s0t2xo(mpiydome mncils artm( pou0oetnifeildlmDemn o ()trxrif ty1fp eaivils s2uoio3ny4apee icsls sDua(ront1tleo feiatlmDelnvo u0trxnxrcto1faD au o () 2xr(r3iu4lpt liei (f rtr(moou4alen ocilt s em(mp;t0 exrxrcio1oaD aiei s0teuo(rpnudom emici t a2rau  nu4oeenmo3iyt s2ulnvo t4tlxnif3oatlp ean i t  rumir ny1llenlivtat) Dra(r oo4tltoii3iysfaDrm(mo (4teerxrcoo1laD aies;(0srurxopiudop   nvilt)a2tm(rpou1tlxomfetyt m rlu s u4trxoxr oodopD lnvils0 2urio oy1ll emnctatf 2um(roou0optniictat sDumuvo u) reniociodlm  aueol(0srurxm io4alenlfct s aDtr(m nu0tex moeiltfm2el(ms;u0texrircoa1opDe nvs;s0teur(rpiudaptemicils)a2rr(mp;o0aetomo3tys mDumnvp;t)arxrio3iodoat  i i;t)texm(r ou1lpt mnvt sfa2rmu  ou1tee iiciyt m rau s;t0trxomfcia1lpD lnvo t)srxoxm3ou1lp e fvs ( sDra(mpoo0olt mieiasfaDea(ms;u4aeerio tatoptr ieo t0 2xrimpiu4lptnmnes t a2raxr ou0texn ieildlm rlu pnt)tlxoxrciytfp r uvo s)tetrimpnu4amee fcs t) 2urx poo1oetn oeilt a2ul(mpnt)treomf ta1fm   nvo;s  rxrir iudop  lncs s) Dtrx pno4opt ioetyt m eln s t)alenmfcootomteli s;s)s2urim oodlmt mics (  Dtmx p;t4opt ifctyt sDemuvsn(0aetnmf ta1oaDe uvi;s)seurxo3nu1opeelfcsltf ruau  ;u0tltn o3iyd s ua(vs (0tlxnxo3oydlp eai il(  rtrimpoy1alte ivta( srrrxmont4aexomi3ilsfaDemuvonu)aeeomoctadfateaieol(0 2xm(opny4ap elfeias a2trxm ou1tpx ioeiatfaDel(mo;t)aexnirciydlmDeaivolt0tetoio ny4al n icslt  rua(r nu1texnii3tytlmDranmpnt)altnmrciodfaD  nvsl() eurxm nudalt lncs s)sDrmx o;t0aexoifeiltls2umuvs;t4teeoir iytoa  au o s0t2tmxmpoudom nlfvsa(farrm(m nu0tpx io3tlsfs2eluvp t)alxoxf3totfpteaiei;(0setm(o3no1altemieil(f Dtax ono4aetomoeiatlaDeaumsnt4 etnxrcoodla e i s ()sruo(o nodlmtelnvia()a2tmx o;u0tpe mo3ilslaDrmumsnt4texnmo3iatlpD auvs;( srto(m3oodll elfes ( sDtmx  ou0tptn fctltlm2rl(vp t0texrmocoadlaDr uei t0t2xo(o3oo1alenlieta( s2tm( oot0olx mfcilsfm rmnvp (4aeeomfcoytopD lnvol()t2xmim3iodlmte fviatfs2rm(r ou4tleomoctldfs2rmuvs (4tleoxo3totlm eli i (0teumxopiudomenmnetatfa2tm(r no1olt  iciad m rlumonu)altnmrcoytomD lnvi s0 eur(r oy1op  lnesl(f 2urxronu4opeoiictadfsDel(vo;t) rtnmrciodfmDrlneils  rxo(m3nu1am n fetat)artax pnu1aeenifeiyt m2elumo u)altniociatom  lieol(0 exr(r3oudap emnvs t aDrmumono1ope mocils sDemumsn(0 lermo iytlmDeaues () rtmxr3nodamtelnvs (fsDtr(rp;t1aetnmoeils a rm(vo t4teerir3ta1lpD li sl( srxrxmpoo4am  mnes tfaDrmumont1olxnmociltls ra(von(0tetnmr3io1oaDelivs;(0srtmxm iudopt  nvs t  ruaxm nu4tlx  oeild s uanvo (0trtrxfcoadfp eau s;s0t2uo(opnu1ole  fcs sfsrur(ro;t1alx ifeiyt m emn sn()aetoxrcto1oa eli s (  2uoio3iudap elfetlt sruax  nt0alt  o3iatlaDuanmp;()tltrir iydlp  livo (  exm(opnu4ole mivtls) 2ta( p;o1tlt mfetlsfa2emnvs;t0 exnxrciy1lat  nvo s0 exmio nu1lm n ncsl() 2taxro;u0tex mi3iatlsDrlumon(0arenmf3ty1fpDeluvi;(  euoio nu1ol nlfcs sf 2um(r nt4aet mi3iat s ua(mo;u0arenircoa1fat  ivo;() rumim nodop  lfes tfsDrm(rpnu1apen ociysfs2rlums (4 rxoir3to1om eanvo;t0 2to(mpno4ap nmivsl( aDum( pnt1tlxoii3iasfm2rlu snu0altnmf tydlpDrlnesl( truo(m ny4lptnlfctatfartmxr nu1oeeomoetaslm rlnmo;u) rxrxr3ta1lptr neols texrxm oy1apenmfviatf 2urxr nu0teenmi3iltlaDeau o t0alermo3oodlaD aieo;s)t2xr(m oy4ap n fctas)sDrmu  ou0tpen oeilsfs emuvsn()tlenmf3io1op eauvs t0s2umirpoo1openmiet () Drmx poo0oeenmietaslm2ulnmo;() lenxocia1fpDe u s s)seurxopoudamt  nei (fartmxmoou0oleoio3tltlaDranvo t4alxnxr3ootlpD  ivi;s)s2xm(m iu4om  mieils aDum(ro;t4alxoif3iatfa ulu onu4 lermr oodlmDrln i;t texrxr nodlpte nvtltf Draxmp;t4tpxomociadfa2umnvo u4aetrmrcoodoa rlivi s texo(r oudllt mnctatf Dua(rpot0oet mieilslsDranvp;(0tlenxo iadlatrai s;t0s2urio oydolenlicsl( arur(root1apxn i3iad mDemu p u0tlxoxo3iadlm  lu il(0 2uoiopoy1lptnmietat  rur(r ;u0tetomfcils s2emnms ()tlenir3iotfmt lnvilt0trxoxo3oydapenmfcia( aDtmu ont0oeeoio3iadfa rlnmont0tleoirctydlaDrlnvs (0sexo(r3oy4aptemncsasfarur(m no0tpxnmoeiatfmDel( s t4 rxnmf3iotlmt  u sl( sexoir nydolt lfctlt sDuaxmpot1oet moeiltfmDea( pnu0artnio oodlaD  uvi s0 2xm(r iodopee ncslt  2rmurpoo0aptniociydlm elumo;()trxrxfcoa1fp   u ils s2toim ou4ap   ncias) ruaurpnu1apeoioeilt sDum(monu4 lenio3totlpDr u ol(  2xoio3nu1apeemfetls)aDrmumpnu0ale micias sDum(msn(0areoxocia1oaDean i;t)texrxr oudaptnmnes t  2uax  ;o4opto o3tlslsDeaums u0 etoxrciotoa eli ols0srxo(o iydop nlietas a2rrxr no4oexoii3ildfa2elu o t4arenmf3oadlp eln s;s seurim oo4omeemfcs s)srum(mooo1tlenii3iyt a rlnvon(0 rxoxr3oadfm  an s s)t2xoxopnu1amt lfvsa(faDtm(r nu1apx moctysfa rmuvs u0tetrmrcoa1faDe nvsl()setmxopiu1optn netls s2ra(m nt4tleoioeiat aDulnmp (4 ltomr3io1lmt li i;s trxmxr3io4ame mncslt  2tax  ;u1aex iieiyt sDrlnmsnt4aexomr3to1fpDeaues (0texm(m3iodll elncsl()artrx  oo0tptnifctatlm ulnvpnu)trxrir iotop  lu sl(  2urxm io4olen ietasfs2ua(rp;t0olxnio3ias a2umu onu)teeriociodlpDeaneo t  euoimpoydlme  ieiat srurxmpno0olx  fetys aDrauvs (4 leomf3iy1omDeln s;( setmxo iu1am nmnetl( aDumu ono0teto o3iltfs um( pnu) rtnmf3tadfpD aivolt seuo(m3nudlltelfeil() 2trurp;u4tlt  ietldlm2rauvp t)artrio3ootfpt liesl( t2tm(r3iudll n fcsa(fs2ur(ro;o1tle  ieiytfs2eanvsnt) rtnmr oo1oaDran s;(0sexmxo iudame lnvtl(f rta(mo;t0tetnifctls s2umu o;u) leoxf tatlp elnvi;t teumiopou1lm   feias srur( o;o0aee mociysfmDumnvp u) rxoifcia1opte nvo;t)teumxr nudamt  fei t)aDrax ooo4apxo iciadlmDean p u)arermo3tytop   nvi s) 2umio iu4ol e nesls aDra( pot1tptoifeildfs umn p;u0 etrmo iy1fa rlues ()teurio3io1lm n ictlt) Duaxr no4aetoioetasfa2elu pnt0altomocoy1om eaneilt t2um(r3oudole micta(f rtax  ;o1apt ifctld a2ra(vsnt4 rxoxocoatlm rln i;t)sexrxrpny1omeemivslt)srurx  ou0oet mietytfa2rmnms (0 etomo3ootlm  auvils trumxrpno1lmtnlnvtas aDtau  no4tex mf3iydlaDemn s;(0aetomocoytop eaneo () 2toxo oo1am n fetls)arurx  no1apeomociadls2rlu pnu0arenifcta1faD luvi s) rxrxo3oo4ap  lnesa( srrrxr oo4oetomo3iat sDrl( o;t)areoircoo1laDe n s;t)srxmimpnudlmenlnvsasfaDur(m oo1tlt  oeiyslsDea( s u) lxomr3to1fm  aneo s)srtoir3iudol  miei ()aDta(r ;u4apenii3iltlm2emu o;t0alenircoadoptean ilt) ruo(r oo4optnlfvi tfarum(  no0apt ifeiasfm2ulu p t0aexoio3iadfaDelu ol(0texmio3ny4am  lnvt (f Dtr(m ou1olxo ietlt mDrl( pnt4teerxo to1faDraneolt0seuoirpoo1lm   icslt  ruau  ot0opeoiietls mDrluvs ()trxnifciy1fmDr u i;t0 exrir3io1amtelfcsat arrmx o;t4texo feiasfm ulums;t4teeoifcoytlat aueils0 2to(r3nu4lme  fet tfs2ur(mpnt4oexoiieild mDel( s;()tlenmr3oytfaDe ivsl()srtrio iodol  lfcil(fsrrm(  nt0open f3iasfs2eau p u0alerxr ootfpDr ivs;s0t2tm(r ou1oltnmnei s) rua(ronu1tptoioetltfm eanvo;t)tltnxrcty1faDr nes;s  rxm(o io1lmenlneilsfa2rmx o;o1aptniociadfsDuln o u4 ltomociotla elu olt0teumxm3oodlmeemnvil()srtax  ;o0aee  ieildlaDul(vpnu4 renxocio1lmDr i i s) rtoio nodlptemfvtas)s2ua(r ;u1tpx mf3iasfs uanms ()trxrmf3oatlaD  ivo;s0setoim3oodape livtasf rtau p;t4tpxoifcilsla ranvp;u0alerio3iytlaDrln il(0t2tmirpiu4al n ivi tfaDum(  ;o1olxo oetadla2ra(vp;(4altrxr3iotlat lnvs;s trxoio oydope lnct tfarraxrpot1apenmi3iat mDulnvpnu)tltnxo iydopteln i;( srxo(rpio1om n ics (fs2rau oot1tlt iieiyd s umnmsn(0trxnxfcio1oa  an i;s0teur(mpou4optemivsl( aDtax o;o0tlxo i3tasfs2ulumpn(0aleomocoytfat  ueo s  2toio3oo1lp e fes t  2urxmo;o0tltoiiciydls uluvs;u)aetoio oytom   i ilt srur(o oudll   feiat aDrmur nu1altnioctyd s emn s t0aetomo3iydop elu o ( t2xrio3nydape  nvi s)s2ur(m ;t0optn ociad s rl(vo;t) eeomf3oatfa eau o ( teurir iu4openmnci sf 2um(m ;t1texoif3tysfmDeau snu)teenxo ty1omDe n o (0sexrim nodapt  fvs sfs2urxmp;o0alxn fciyt sDrlnmo;()tlerifcty1la eauvolt) rxoio iodoptnlfesa() rrr(  nu0tee  feiadlsDua( p;(0treomfctytfpt aivi;s tetr(o3oo1aptnmnvs s aDumumo;t1opt  oetys s2uan s;u) reomr3iy1fatelnvo t0 eum(opiy1ap  miesas  Durxmpno1teto o3ias a2emu p t)trxomr3oytfmtr n s t  2umiopoo1apenlfvtas a2tauronu0oexoiociad s2ul(vp t)altomfctotlp  ln o t0sexrxmpoy1lpteliciat)arur( pot1altomieilsfaDelu on(0trxoir3oadoa rauvi;()srtrxrpnu4om nlnvsltfa2rmxmooo0texnmf3iytfa2emump (0aetrxr tatlpD lnei;(0srxmxo3oy1lmt  nct tf 2rr(mpnu4tpeomo3iadlm2eanmo;t4 exnxf ia1oat  i i;s  2xmxopno1ll  lfcsasfs2taxr ou0tlen f3iydlaDemuvont)tltrxr tytoaDeauei;t  2uoxr3oodopenlfvtasfs2tr(mont4ale moeiatls ranmsnu4texnmfciotfp   ivi s0tetm(opou1amt  fci ()arrmx pno1oeto feiad aDulnmsnt4 lxrmocio1lmt  n s s)tetoxopiy1ol emfvias)s2trurpnt0alxo i3iadfs2emn o;(4 eenmo3todfmte i o t  exo(o no1llt lncsltf Drrxrp;u4tpeomfctytfs2raumpn(4arxomfcto1omte neslt) 2xmxr iodapeelivta(f rrmxmpou0oeto octasfa2el( o;() etrxf oatlm rlues s)trtoxopnu1ale lnvias srrrxm ;o0olx  ictytfm ulu on(4tleomfciotlpt lnvi;s0truo(o3nudalte fesas  2rr(  oo1tltn icilsfs ea(ms;()aeerxr oadlaDr nvs ()truo(o3io4omt mivsltfsDumx  nu1opeo icildlm ra(vonu4 rtrif3tytoatr iei s) rxrxr3no4llte fciatfa2tmxrooo1alx io3tld m ulump;u0arxnifciotopteaivi;(0 2to(o3nu1ol nmncsl(f 2uaxm oo1oet ioeiltla emnvs t)altoir todlpt au ilt) eurxo3iy4lpeelict tfaruaxm ;u0oee  f3iad a em(vp;(0tltnifcoa1lmDrai o;() 2xoim no4lltemieiasfaDumur ;u1aetoifcild m2eluvo u0aeenif3ta1lpte u i;t)trto(mpoy1amt miviasfsruauroot0optnif3tlslm2ua(vsn()alermf tatfaD livsls0 exr(mpoydlltnlncta()artr(  nu1ale io3tas sDrlumo t0 lxnio3ia1la rliei;t s2trxrpnodlltn fctl() 2rrxm ;t0opeo fetls sDrl(msn(0arxnmr3oadfpDrau sls)t2toxr iydalt livs s  Dtmxrp;t1optn feiad mDemu o u0tlerioctatfat  neil( trxoxo3oydamtelnvt t  Drrumpou0aptoii3iadlsDrln p t)arxnif3io1lp r iesl(  2umxo io4olt  ict t  rtau pnt1aptomoetlt a2emnmont4trxrmr tydfpteaues;(0t2xoxo nu4lle lneiatfsDtaxm nu1tee io3iltfs elnvpn()trtnmocoytomDr u o;(0s2xmirpiy1ap nmnesas)arraumoot1apenioeiyd a2emn o;(0trxomoctydoaD aneolt)seto(m3iydome  nciasfsruaumont1oltnmi3iat a2ea(vp;t)aexnmrcia1fm  lneilt)trtmir io1lptelivt s a2tmum nt4ole ifeiadfs eanvs t4trxomf iy1fatrlnvolt)s2tm(m oo1lmt lfvtlsfsrurx  ;t4tpe  oeiasfa2rau s;(4trtnxr3ootoat ai s s0t2to(m oodomte ics s)aDtaum ;u4alx if3iaslmDean pn()aleoxrcio1fmt  nvi t)trumxo3oodopenmfet ()srtr(r ou4oeeomiciysfm2rl(msnu4 rtnmf3iadomteaueols0t2urio3nudlme livt t)artrxrpou1tpx miciad m2rmumon(0aexrir ta1lmDrluvs;s0t2xrio no1op emnci s s2ua( oot4tpxn fciatfa eau s;(0aexnxrctotfptrlieolt tetmio oydop   nesa(  2rmx ono4tpt  ietydls2rmuvs;u4 etrxoctatfm   u ols0 rxoim3nudlmen nvslsfs2ra(  ;t0tpeoioeiatlmDuauvp;u)tetrif oy1op r ivo s0 eumxm3iu1ol nlnvtatfa2uru poo4aetnio3iatlsDrmnmo () etnmo tatla ean i;s srtmirpnu1alenlnvsl(f Duax  ou0aee  fcias a2umnms;() lxrifctatoaDraivs;s)trtoir3nu4op  mietlt)sDum(mp;u1apeoio3iyt aDranmp (0tetnmo3oydoa   ivi (0s2tm(o nu1lpt lnei tf rrrur ot0aetn fetysls rlnvs;t)trtnmf3tytlmteai ols0texoxopny4op   icsatfsrtaxronu0oetniociytfsDrm(mp;(4aetrxocio1omD  n ol(0 2xoio3oydapt lfeiat  2rmu pot4tetomictydfa rmnvs;(0teenifctotomDr uvo ()teumim3oy1lpte fcils)s2rruronu4tee iietydfaDrlnmpn(4 ltoxf iadfatelu i s)setm(o3no4altemivt s)a2umxm no4open i3iatfs2ulumo;()arxomfctadfmDeaivils)s2xrxmpoodal nlnvt s a2tmxmo;o4tltn ietls m2uanvo;u)aexrxf3totfp elnvs t0sexo(o oy1lpen icils s2rruroou4oexn ociyslm ra( sn(0alxrxr iotfa eluvsl() exr(r3nodameemncsa() 2umumpou0tlenmi3tls sDrmumpn() lerir3to1lm e neolt srumxr3oydol  livtasf rta( p;t0ale mi3ildfa2ua( pn() eeoxo io1fm ean sl(0tetrxmpou4alee nvil()srraxm ou0ale iociydfaDemnmont0 etnmo iytfaD aies;t)s2xmim iu1lp nmivtlsfaDumx ooo4olxnmiciys s2em(mo t)tlenioctydfp  aneo;()seumir oo1llen nviltfsrtm(r ;o1apxnifetytfmDem( s;t0teeomo to1fp  ai s;() 2tm(r3iudam elnvtat)arra(m nt0opxnmoctadla2em(msn(4arxnmociydlpt lieo ()tetrir3iu1ll  mfvsat)artau ooo0apt  oeild s2ea( pnu0arerxr3iadlpt liei;t)teurir3iudlmee iesl()a2trxr ou0texo oeiat a rmumo t4areoir todfatr ueo;s0s2xmirpno4lmte ivsa(fa2rrx pnu1ale ifeiasfm el( s;u0trxoxr iadomDrlnvi (  exrio oo4lpt licsas)aDtr( p;u0oeto ocils mDraums () ltrxf tatlmtr i o (0truo(rpnodal emfeia(f 2rru  no0aeeomo3iys m rmumo (0tltrircoadoa rln s;(0texoiopoy4ole mfcs t sDtm(r ot1oex io3iaslmDrau p (4 rxrmrciodfat au i;( truoxr3iydopenmfes tfsDua(ronu4texo fetyd m2eanms t0artrif ootla rauvs;t  rxrxr no4lptnmfetatf Duaumo;u4tpxnmfeildlmDrlnvs ()aetoxoctodfat ln o;(0t2uoxo3nu1lme  ivi s)srumu o;o0tpxomoeiadla em(vp;u) lenio3iadlm eln s;s srxrio nydlpe mietl() Duax pou1ope mf3iadls2elu o (4trtnmfctadfa  auei s)seumxm oo4ll n ivtasfaDtrur ;o0alto ietltfs2rmnvs;(4arxrxr iodlp  livs;t srumio3ny4amenlictl(f rrrx  oo0oeen feilsfa umnmp u4trtnxr3tatomDe i s t) eto(o nodope lfvias) 2tmurp;u1opt if3iat a rm( ont0 etrmf3iatfaDean sl( t2tmir iu4ope livsa(f 2tr( pnu1oetnmictas a2raumo;t4trxnmo oatopD lneslt s2urxrpny1al emneil(fsrrr( o;t1teeo feiltla2um( pnt) rxrmocoodlmDelivs;s0 rtm(opio1lmenmfci sf 2rm(mpou4opeoifctad a2umu s t)alenxf3iy1lpt auvo;t)s2to(r nu1om  lfcslsf rtaum nu4tlxoif3iadlm ranmp;(0 eermocoadomD aneilt0 eur(mpny4olenlneils)a2tax ooo0ape mfciyd sDemnmp;u4tltoxrciadoaDeln olt)texrio3iodam n nctlsfsruaurpnt1oeeniociytlm uau s;(0 rxoircoatoateau ils)texo(o oodlpee ivsl()srrm( pou0ale mo3tysfm emnmo;t) lerxrcoytlpDrau i s0s2umxrpoodame mfvi s  Draxm ou4alen icias m2uauvo (4 exomo ootoaD  ues t0t2toiopnodlltemivil()sruaump;o0tpx  f3iat aDelnvp t0 rxnmrctadlpDranei s seumimpny4op emict s  Dumxmoot4apt ifcias sDeau p u)altrxo3tatfm eai o;s0s2toxrpno4llee ncil()a2ur(m ;u0tltnioetydlsDua(mo;u0aetnmo iydfp  livs ()texrio3oy4lp  lics s) rta(mpot0tpeo fcias m2em(mo;t)arxoxr3io1lpt aiei;( t2xrirpno1ap emfesl(farrrxmpnu4tlt  i3iytls el(mp;u)arerxf iytlm ean o (  eurxm no1lpe  nvias  rtmx pnu4alx  i3iltfm raumsnt4trerxociotfp e ies;(0setm(opoydamt lfvt tfa2rmx poo1apxoioctas m ulums;()artrmo3oo1opteaneo;s t2urimpnydlmt lnes sf Durxr nt1tlxomfcild a um(vs;t)trtrirciotfpteau i;s0trxrio3ou4opt  ics (farrr(m no4alto ociatfm el(vo;t4trxoxfciadfa  lnvsls s2tr(rpoo1lmtnlneslt aDrrump;t4openioctldfm2rm(ms t0 rerxo3iydoaDe nei;s) eto(o3no1olt  ivta(fs2rmxr ou0optnmo3iyt aDemumpnu0 exnio3oadla e uvsls0 etoxrpiodolte nct t)artrx pnu4apto fciytls2rm(mp t0artoxf3to1la   ieo s0s2xoxr oodoleelneiat)srrau ooo4tex mociasfm2ean o u)tlxniocoy1lm rlies;(0seumxm3no4opt licilsfaruaxmono0oetn i3iatfaDumnmp;() rxrmo oytlpt  n ols0t2xmxopiu1omeelnvias  rtmx onu4olxn octatlm2uan o;(0tltrxf3oytlp e nei;t)srxoxrpoudapenlicsl()aDtmxrpou0alx  icils s rmumo u4tltomf3iodfmt lueo;s)s2umio iodalt mfct (farrax  ;t0tee iiciysfa2ranvpnu0trtnmr iadoaDeln o s)trtm(rpiodamtnmivsat) rurum nt1aeenifciltfsDel( ont0 eeomo oodop rlueilt0 rtm(mpiu4omt mivt () rtaxr no4tetnifciydls2rmu snt4 rxnir3oy1fp  anesls)s2ur(o oy4op nlieias) 2tmxro;t4tpxo i3tytla2umnmsn()alerio3oytoa  lneils  2uo(o3oy1lmenmfctas)arraum ;o0aexo oeilt a2rm(vs;t4 etrxfcoytla eauvs () rtoim3oy4lp n ivt sfsrrrum ;t1ale io3ilsls2umn p;t)aexrxocoa1om elnvs;t) 2urxm nu1olenlnvsa(fsDtr(  no0tlx mo3iyd mDrmump;()aeeoio tytla  ai il(0s2xoim nu4om elncsl(  rtaum no4tptoiiciytla umums;()aleomf iadlp   ivo;t)teto(r nodlltnmivtlt aDurx  ot4tee  i3ias mDemnvp;()teenio3to1fp rauvi;( trtoxr3iu4ap n fct sf Dra( pot4tpe io3tatfaDelnms ()trtomr3ty1lat  i olt0trtrim3ny4alen ieiltf Dtaxm oo4oexo oeils aDrauvp;t)aeermr iy1optrlu s ( srtrxmpiy1om elivi (f rtmu ooo0aleo o3tyt a rl(vpnu)treomo3iadfpt livslt setm(mpiudole micil(fsrtmurp;t0tpeomoctadfm rl(vo u0 leoif iotfaD  u o;(0 2xrio3nu1llenmneilt  rrr(r nu1alx  oeiyslm ranvo;(4aetomo3to1lptr i ilt)srurimpnudale  fesas)srrmump;u0tex mf3tys aDeanvo u)tlerir3oodlmt ln o t0srxr(o ny4lp elncta(f 2um( p;u0olt mieiydls2emump t4aleoxr io1fm elivi;()s2ur(rpoy4al  liciat)srua(mpot1ape ifctyt aDumu s;t0arenmo totfp eln s t0teto(opnu4lltnlivia(fsDuauront0opeoiietat mDemnmp;u)artomo iydop  aivils0 2xm(r3no1lpe mnei (  rrr(rono4alxnifeiltfm2rl(mp t4tetnmr ootoateli s s) 2um(opoudlltemiciasfaDur(r ;u4tex  icilsfs ea( snu0alxnmrctadfatraieilt0 ruoxrpny1llenlietl(fsrtrum ot4tet ii3iys s2em( p t4 ltoxocoadom  auvs s0srum(r3iydole  nvsa(fsDrrumoot0aee micilt m eauvpn(4tlxoxocto1fat ai i;( setoir3oodop emivsatf rtmxr oo1ape ioctasla2rlnmo;(4 rxoif3todfmD  ues ( sexrxrpnodapte nvi s)arta(m ou1teto ieildlmDraums;t0aexomo tadom elivi;t)t2urxo io4lpt miei t)srumxrp;u0tlxomfeiadlm2rm( s t)alxrxf tadfa rlneilt0s2umio3oydomee ivs sfsDuaumpou1apxniociytfa uluvpn(4aeeoxr iadfa  aiei (  rxmxm3iodlm nmneslsf 2umxrp;t0tpxomo3iytla2ul( onu)alxoirciodfpteluvo;()tetr(mpoudom  livtl( arumu  no0oeenio3iaslm2el(vp u)aeenio ia1oa eai s (  etm(m3iu1ome  fciltf 2rrum ou0aeen oetytla2uan o u4 leomr3oadlmt livs;(0 ruoxrpoo4llt  feias)a2taumpnt4apxomictytls umu o t)aetnxf oytoaDr ueo;s0srumim3nudal n net s srra(rp;t1aex mocias s rlnmo;u0 reomr oadlmDe ueo;t0s2toir3nudame mivias) 2rauronu4alxnmietlt m2um( p (4tetomrcoytop elnvs t0t2xoiopoo1olee ncils)aDra(rono1oexo oetlslsDrmn o;(4aeenxfciydfpteau o;t)truoir iudlpe  fesat sDraxro;u1tltnifctlt s ua( s;(0 rtnxo oytoaD lieo s) 2xrio oo4olt mies (fsDurum ;o1olxomoctatlmDul(ms u0tltrir3iotfateluvi;() rtm(m iudoltelieiasf rum(  oo1apeoio3iltls2emnmonu) lenmocootlm eaivs ()t2xm(r3nu4opt mfes t)a2rm( onu4tetnioetys m2rmumsn(0tlenxocoa1oat  i sls) rtoio oo4lpenlnvtat sDua(ro;t1oex  o3iasls rmuvsnu) lxrmr iydomteli olt)s2xrim oudop  mfci s)s2rr(m oo0opx  ociysfa elums;(4 rxomocoo1fpDeauvs;( trxmxo oo4am  mncs s artm(mpou4opxomociydfmDelnvs;u) exrxo3ia1opDrln s;s0t2tmxo3oudll   ivsl( a2umx oot4aetn ieiad m rln sn(4altrxo3oatopDrlu il( trumxrpiu4ome  ivsl(  Dum( poo0oeeo f3tydlaDrmuvs ()trtomrcoo1lpDr n ils t2toxr3no1lp  lnvilsf 2rrxr ;t0olxoiociydla uanmo (4tlenxr3iadfm elieo;t) rtoxo3nudlle lnetls  Duaumpno0aeenmi3tatla2ua(vo;t0 eeoxoctytlm e nvo;( s2umxo iu4amen fesls  2taxmpot4aexomi3tls aDem(vont4tleomrcoytoa  lneo ()s2xoxr oo4omtemfcia()a2taxm ;o1ale ifeiydla umnvsn()aexomf3tytomDrlivi t) 2to(m oy4lltn ieias artr(  ;o1alt if3iyt a ranvsnt4trxnmfctotfptr ueslt0s2umxm nu1ope  nesat)s2rr(rp;u1teeomfetad s uaums t)trxoxrcoydfmDraieils seuoxm oy1op  mfcs s a2urx ont0oltnif3ilt s2em(vp (0 leoxf ootfpD ln s;s0s2uoxo3iy4omte fcsl(f rtau o;u1olto ictldlm emuvpn(0teeoxr iodomt  i ilt0 rtmim3oo4lmtnlfes s) Drr( pnu1texomo3tlt m ul( p () eerio3iotfmDe i s t0srtm(rpio1al nlivsl(fs2tmxrono4tet mfetydlm2ean p;u)arenmfcoodop eaivsls)t2tr(m oydom e fctatfaDtaxroou1opt ioeiydlm rl( p u4arxnmoctydoptraues;()trtoimpiodalee fes s srtaxronu1alt mfctldls2em( o t0 exoxfcty1oa rai o;s0seur(r3io1lltemiei sfarrrum ot1tpxn fcils sDeanvo (0 lenircia1oatr uvols s2toio nudopteliesl(fsDrmx p;o1altomfciltfaDuan s t)aeerxfcia1la eai i (0 rurxm iy1al emiet tfaDrru oou4tltniietat sDel(ms;t0 rxoxf3iydlp eaivsls0texr(m3iudam n fetas aDur(rpnu1aexnmf3tadlm elu o;t0 etoxf3iatfaDeauesl( sexm(o3oy1lm nmnvs ()arrr(  ;o4aetoifetat aDeln pnu) lerio to1fptrau o s0 2umimpio1am  mneslt aDtmxr ;o0aee mfciadlm2rl(vpn(4areoxo tydomDeauvs;t tetmimpoo4omenmfeia( sruaur nt4tpxo ieilt m eauvp;t) rxoxr ty1fptrlneils)t2umxr oudomeemiesatfsDraxm ou1olen fetyt sDumuvs u4altoiocta1om  aieo;s) exr(opiy1ameemncias  rurxro;o0alxo ociysfs2rl(mp (4alenxocty1optrlnvi;(0 rtmxmpou4ape miciat)s2taxmpou1oeeoiocild aDean o;t4tetrxo3ty1fat ai s s srxmiopiudlltelnei ( s2rm(ront1tpxnmfciysfmDem(mpn(0 rerifcootlmtran o t)teur(opny1apt mnes s a2urumo;u1optnmieiltfa rmu p;u)arenxfcoodfmt li ols)t2umxopno4om nmfvta( s2tr(m ;t0tle mietydlm el( s;(4tleoxf tytlp r nes;t0srtoxo nodap nmiei t sDrmx  oo4tetn oeilsfa2umn o ()trermf3oa1fp e n i ( truoxr3ny1amtemfcils) rrmu onu4tpx ii3iat m rlumo;t0tlxrmr3ootlmte ieil(  rumiopou4ap nlfvs s)srurumpnu0optnifciyslmDeanmpnt4arenir tytfp   n i t s2xmxr oy4ap nlnvslsfarur(  ;t0ale moeiasls elnmo u4trermr3todlptraivs;s)trxrirpnu1openlicsa()arrr( poo0ale ifetad m2ulnvs;t4teenif3todom ran ols0 rumiopoo4lmtnlivt s) Dtrxr ;t1apxnioeiys sDumn on(4texrmf oatfpDrln ols)sexoir iu4alee ics t)s2rrxr ou0oetn i3ias m uanvon(4 rxrmo tadfa raivi;t teurim3oo1optn fviatfaDtrx o;u0optomf3iat sDem( ont0tltrxfcootfaD  uvil( setrxo3ny1ol  lfvsltf Dra(mpnu4oeto ietas m2uln o;t0trxomr3oo1fpt luvsl( t2uoir iy1ol   fvtlt) Drrxrp;t1opx ii3tadfs2rm( pn()alxoxrcoadlpDeaivi t0tetmxopoo1om emiei ()artrum ;u1aetnii3iltfs uln s;t)tleomf oydopte n o;s t2tm(m oydlpt mfeiasfa2rau o;t0apxnio3iytls2umump;u4artrir3iadoatrli ol( s2tm(opiy1lltnlivsl(fs2rrumpno4tex ifetad s rmumo (0 lxoir3tatfmDelu i t  rtrir3nudame  fci (faDtrx ooo4oetoii3ilsla2raumo (0tlermo3tydlatelu s t  rurxm nu1lp   feias)sDrmum no1ale iieildlmDumu sn()tltoio iy1omteai s (0t2xrxmpno4amt mnvil()aDtrx pno4tleomf3ilsfaDuln sn(0 rtrxr3oydfmte ues (0s2xrim3io1alt mfvtas  Duru oou4tetoioeilt sDuauvon()texnxr oytoaD an s s0seuoxm3iy4omtn nctat)srtm(mpoo0oetoio3tydfm emuvs t0aetnmociydomte neol(0srtm(m3no1om e net sfs2rrxr ;u1oexnmo3iys a ua( o u4tlxrxrciadfm rauesl(0 2umxmpiudlp  mnvsl()srra( o;u0oleoifciaslmDemn o;(0 eeoir tatfmtrln ol()texo(m io1ap  micsa(fs2ra( oou0opeoif3iat m raumpnu)arxrmrciytlmDran ilt)teurimpiy4omtn icia() Dtaurpot0oleo ociadfaDrmnvo u0 ltrmfctotopte n s;t) ruo(r3oodole mnct (  rtrxronu0oeeomoctytfa2uauvp;t4teeoxrcoatlpDe ivi;(0 2xmxrpny1ole lncs () rrru p;o0tlto f3tls m2uau s (0trtrmrciodopte ieols  2xoxr3iydapeelfeil(fsrurxmp;u0apt mo3iyd m em( s t4texoxfcta1opDelivi;s0trumim no1ol nmnvtls)a2rru  ;u1optoiocildfmDrauvo;u)treomf3oadoa e u i s)texoxrpoydole  fei t srta( o;t0ope  fciysls em( p (0artrir iy1opt lu s (  ruoim oy1ole  icils) 2rmu o;u0tpe ioeildfaDuluvp;(4alenio ootopDraieo ()texrxopou4lmtemnetatfsrumurpou4open ociltfs emuvp () eenmrctodfmtrluvol( t2to(rpno4lmtnlncsasfaDtrxrooo1tpxnif3iadlaDran s (0texomf iodlaDraneo;t0 rtoio3oodapee fvtltfaDta(mpoo0tpxomoetls m2ul(vp;u4altrmf3tadlp e uesl(0trxm(m oo4op emiet tfs2tmu pou0aeeniiciytfa ranmp u4aeeomo tadfa   i olt tetmir nu1apt lnvtl() rurxr ;t0ole moetys s2emu p;u0 rxnxfcoytfpteaivo;t  ruoirpou1amtnmfvil( a2taxmpou4opx moeiaslsDul(vsn() lxrxo3ia1fptelnvi ( sexo(r ny1alt lictat)a2uau  ot1tpxomf3iysla eln s t)trxnif3tadoaDean ol( trtm(m3iudlltemncil(  2uaxrpnu1aptn feiatlm um( s ()trxrmr iadopte i i;( srxo(o iydap  lfvilt)aDra(r nt4tex  iciltlaDrm(vo u4texnxo3oadfptran i s0t2urio3nydlpenlncta( srtrxr ;o0ope miciatfm rl( o;(4aeeomf oy1lm  ln ols trtr(r oodaleemfviat srrm( oou4texo fciad s rlnmo t4alxoir tatla   u i ( srxoiopoo1olenmfet ()sDtmxr no0tlxoifciydfs2rlnvon() lerxo3ta1omte ieo t srxo(o3oy4lp nmfci s  Dum(m ;u4aee mfciatfs2umn o;() eenmocoydfaD anvi;s  2tmxrpoudlleemnvtltfs2taxrpnt4tptoiietyd sDuluvs;u0teerif iodlpDelnvs s0sexrio oo4optemfcil(  2rrumo;o1aptnmf3tydlmDeauvonu0aetnmr iadoatr u s;t  rxo(r3nydlmen fvtls)arraurooo0tpxnifciasla2rl(vo t4 lermrcoodlaD  nvols0t2umio oydal  lietat) rraumonu1apen ictlsfaDel(vs (0 etnmrcootopDe nvi;s0srtr(o nu1lmtemnvsltf 2ur(rpot4olx ioctlslsDul( o u)arxrif ty1laDe u i t)t2xo(m oo1ll  lics s)aDuaxr no1texo ietat aDrmnmp;u0arxoxf3io1fat aneo s0 exrxr oudlpe liviatfsDumu pno0oeeniociatls2uluvs t)aeeoxr3iotfa r u ol()srxo(m3ny4apt lfvs s aDumxrpno4apeo ictadfs eluvp;t4trtnmf iadoaDrlnvils) 2ur(m3nu4alee fcs tf 2uru oot1alen f3iyt mDelumpn() exomocoadoat lnvi s0s2tm(m3iu1lmen fct ()srta(root4opeoiictas a uluvs;t)tetomr oy1fmtelivols0srtmirpio1olee icslsfaDtaumoot4alt iociyt a2rlu snt)tltrif tadlmDeaneils)s2xoim3io4apt lfes (fsDraxr ;t4ole  iciltlsDuauvp;(4treriociy1lmD  u i (0srxo(m iudlptnmicsltfa2tau  ;u4apenioeilt m2rln snt0 rtrmr3iatlaDran s;( srumxr iu1am nliviasfa2tmxr ot1apeomoeiydlaDran s u)artnmfciytoptr u slt)trtrxr3nudapte fvi s s2trxrooo1oet mf3iatlm2umu p;t4 eermfctatlpDelieil() rxrimpou1apt liet tfsDrmumoot1alxn f3ildfs2rlnvo t0tleomfcoadlmtrliei s trtrxo3oy1om nmivs t sruax  ot1aee  f3iytls uanvs u) ex
\ No newline at end of file
@@ -0,0 +1 @@
+ivol() etrir3nydlmtemfcilsf rrmxm ou1tle iieiltfa uln o u4altnmr3tadlp  an il()tetmiopiu4omtnmietl( sDtmurooo4ope mieiaslmDua(vp u) etoxo3todom  lu i;s trxmxr3oodap emnvsl( aDur(mpot1tpt  i3tyslaDel(ms;() eenxocia1fmDrluei (0srtrim nydlm   ivtl()s2ta(  ot4tleo iciys s2emuvo t0arxomf3oadla  li slt0 eumxm io1oltemfvsat)arrmxmpou4ale ioeiys a2uanmp;(4tlxrif3oytfa elu o s0 2xm(r3iydalt mieia(faDtmxrpno4olt ifeiyd sDem(msnu) rtnio ia1fptrlieilt0s2tmir ny1al n feta()sDtm( pnu1opto feiasls rlnmp;u0tleoio3oytoat  u ols  exrir3oudlpee ietltfaDtm(m ;u0alxn oeildlm2umn ont)aleomr3ootoptran ils0trurxmpoo1opt mietlsf 2umur no1tpen ieiytla el(ms;()areoir todfp rlnvo s setmxrpoydope mnvs (fsDtmumono0tetn oetlsfaDeauvs t)trerif oytfpte neo;(  rto(m3no1ole  ieil(f rumurp;o0ape  oetls a2ea(vo;(4tlxnmf iytoat anei;s)trxrxm3iy1ope mivta(faDtaurpnu4apenmoeilsla rln p;u)texrmrciydopDr i slt truoim iu1altelfesa()sDurx  ;t1tlxn ictad a2rl(mp;(4teeomo3oatlpD lueilt)s2ur(mpnodomeemivils  Dur(r ou4aetnmf3ilslm eluvp;(4 reomf tatop rluei;( tetrxo3oydlle  fcil(fa2rr(rpnt1oex  icildfsDea(ms (4tltnmociytfpteli ol() euoirpnudam emnvt t arrrumo;o0tlto f3iasfsDuanmpn(4 exoxrciotfpt an sls t2toxm oy4am  lfctls aDraur no1opxnmietltfaDumuvp;()artnmf iotlmDeluei (  rxmxopio1omte ici s)sDurum ot1teto icilsfa2rlums (0altomo3totoat anvs s)srtrxo iy1al e nvia( s2taumoou4tpen oeiyt s2uau s (0arerifcoytoaDeaieilt)sexmir3ou1lmt lnet s)sDtaumooo4opeoifeiat m2uau p (0 rtrir oodom eai olt t2tm(m3iydlmtelnvsatfsrtru  ;t0alto ictyd m2rm( s u4aetrif oadop  livolt0t2xoxrpoo1oltnmfvi s a2umu poo1alxo ietltlsDrluvs;u0texomrctotoa   i slt trtoxo3no1lp elnvil() rrax pnt4tlxnio3tadlm rmnmpnt0 rxnmf tadfmt ln i ( t2umxr3iydapenlnvtl(f 2trxr ;u1oeeoif3iadlaDem( on() rxomr3ootfaD anesl(0t2uo(opou4oltelnci s)aDra( oou0tptomfeias m ea(vpnu)aeeoir3io1lp  ln i;(0 2toim iudopeelivt s)a2uau  oo0aleomo3tysls2um(mont0alxoifcoytlp eauesl(0 exr(r nu1lpt mivilt)sDua(rpnu4aexomocilslaDumnmon(4teenmo3to1oateanvs;t0texmio3iodap emnci t)sDumu oot4tlt moeiytfm2rau o;t0trtrir3to1opDeai slt  2urxm oy1ll nlneil(farrr(mp;t1texnifetldls em( o (4 eeomo3tydopDraieo ( t2uo(m3ny1ap   icia( aDrax pnt4teto i3iltfs2rmnvsn(0arxoio iatlm  lnesl(0trtoim3nydap  liet (  rtau  ot1aptniiciyt s emuvsnu)aeermoctatfmtr ivol( s2uoxr3nydope lfeia( arur( oou4olt mocias s ulumo;() reoif3io1oat au o t) rur(opoo1ll emneta()srtr(r no1apen feiasfmDrau o u)aleoxf3iotoa r uvslt t2tmxm3nodopee nvtas)s2tr( p;t1tpxn ictls m2ea( on(0 lxrxfctatlpt anvo t)s2xrxm3ou1lmeemfetas) rrau  ;o1aexomoeiytlmDua( s t) rxomfciydfaDr ies;(0 rxrxmpoo1lmt mnvs t) rum(moot1tetoii3iltfs rluvp (4trxnio3totomD au i;s0 eurxm io4omtelfetls) Drau o;o0aex mfetadfmDulnvpnu) lermf to1lptr uvi s s2to(r iy1lp n fcs (fa2tm( o;u4apto i3ilsls2el(mo;u4tltoif oatoaD  n ilt t2xrir3nu4lp  mnetat) rtaxmpot0alx ioeiadfs2ua(vsn()arxnmf todopteauvo ()trumio io1amenlnvilt s2tr(mp;t4olxnif3ilsfm2em( pnt) ltrmrctadoa e ueslt)s2tm(m3nodapte fcsa( s2ur(ront0openmo3tltlaDrlu s;t4teeomf3oytfptrauvs ( srtrxrpiu4lmen netl(fsrtauroou1oet moctadls um(ms;u0 lxriocoo1la   ivs t0trtmxm iodal emics s srrm(m oo0tleomfeiatfa2rlnmsnu)aexomr oytoatrai o ()t2uoim io4al e ivtas arrm(r oo1tetnmoeiysfaDumu p;(4trtoxr oo1op  aivolt0srtr(opoo1llen feias)s2raurp;t4oleomociydfm uan s;(4texrxocootfpDrlies;s0t2xm(m oydam elfvt sfarra(rpnu0alt iiciydla2rm( o;(4alxrir3iytlpteli s;() rtrxopio1ame  fcia(f 2uaxm ot4apx  oetas mDeanvs;u)tltnxf3iodlmt  ivsls0t2tm(r3iudlmtelnet t)s2uaxmo;t0tex ifctldfa raump u4alenmr oa1lp   nei (0trxr(mpnudoltelnvtlt)s2uaur nt1oex mfcildls ran onu0trenxf tydfmD auvi (0 exr(rpnodoleelfvsl(f rrrurooo0aptomi3iytfm2eanvont) ltoxociodla rauvo t)srxmxrpoodll n ivia() 2uru  oo4opxoiicils m2elu p;(4 rerio3oytoatrluvi;t s2uo(m nydlp  lnvtltfsruaum oo4tleomo3iatls2uaump;t4 etnxf oatfmDelu s t  2trxr3ou4ll  miviatfa2ta(ro;o0tex io3iaslsDrmnvsnt0 lenio iatlmD ai slt)s2trxm io1lme  ictasf Dtmxr nt0texo iciytlsDem( o;u4trtnio3oodomDeanes;s srxm(mpnydll e nvtas) rrmx pou0alenmo3iydfs2emnmo;u4tlenio3todla raneol() 2urxr nydlptnlies () Draum ;u4olenif3tadfsDrlnmonu4trxomo ootopDrlnei ( teurxo3iu4lleelict t s2urx oou4oex  ietld aDulnms;(4 etoxr3iy1omDeaies;t)trtoim3iu1ale mieiatfsDtr(r ;t1aeeomoetlt a2uaumonu4trtnxf3ta1fmDeauvi;t0trtm(opiy4olt mietlt)srtax oot4aet mfeiysfmDra( ont0tetoio iy1om  an ilt) etrim ny4ome  fvil(fa2rau  nt4tpen o3iltfmDrlumpnu) rxrmr3ta1oa r n s t0trxoxr3nudalt mivt (f 2urump;t0opto oeils s2ua(vp;t0 rtrmrciy1opDrlivo;t0teuoim no1lp  lics ( sDtr(  nu0altomo3ildlsDrauvon(4tlermf ta1fmDeanvi;s teum(m3no1ap nmivsl(f 2tauroou0aex  f3ild a ea(msn()arenmrcoo1fm  lies t0t2tm(r iu4lpeelfcilsfaDumxroou4olt  o3ilt s rlnvs t0 ltniociytfm elnvs () rurxo3oy4ap emnetlt s2raumoot4oex moctltla ua( s;()tltnmf oo1fpD  nes;t)t2xoio3nu4lptemnvs tf 2um(mpnu0olen fetys m2ranvp ()tlxrircty1latraivslt0s2umxopoodlmeelfvtasfa2ra( pnu1apxoiietatfm2emu ont) reoxf3oadlmD lu o () 2xrir oo1apeelfvi s  Drmxm ;o4aeeo o3iydlm2el(mo;t0tltoxr3iytfat li o s) 2trxm ny4lptelnctltfa2rrx poo0teenmi3tatlsDelumo;(4aeenir iy1lpDelnvo;s) 2tmxopiodllt  ncils aDtru  ;o0aet mf3iadlm ea( o;t4 lerxo3oo1optran i t srtrir ou1op  lnes s)s2rmu  ;o4apeo feiadls2emnvo;t) lxnxociadoaD liei;s) eto(opnodopen net () Dumx oot0oleomfeias m2ra( o;() exrioctytfaD li o;()trxrxopoodalte neta( sDurxronu4tleoif3ildfsDea(mo t4teermfciy1fm rli i;()teuoirpoudll emfvs s) ruauro;t4aptomi3iadla ranmo;t4aexrifcio1lpteanvslt trur(r3io4al elncsasfsDtrurpnu4oltnii3tyslsDrlumo;() rermo3oa1lp r ieo (0 2trxrpiu4lltnmnvt sfs2trxrpot0opxo ietysla em(vp u0 rtrxf3iodlat  i s t) 2xoimpiydomen fcs () rtr(rp;u0oeenmf3iat aDum( o;u) lenir3oo1lmt an ils)s2tmxo3ny4lpt lnvsa( s2rmur ot0aee  f3tat m rau pnt0 eeoirciatop ran i (0s2urim iy1optn fcsa(fs2rrxr ot1tpe mfetatfaDulu p u)tetrxociadom raiei (0 exm(r iu4lle lncs t)artaur ;o1apx moctys m rlumonu)arenxocoo1om rlivi;t)trtmxrpoudlmenlnei () Drmump;u4tleomfeiydlsDul(vs;t)altnmocootoa  ln o;(0sruo(o ou1lptn iet (fsDur(ro;u1aex mociyd a2elnvs t4 lxrmr3tydlmDeaieil()s2tm(m3io4amt livslsfsDrmur oo1openif3iydlm ua( onu4tlenmo oo1laDelivo;s0 etm(r iudlm nmneilsfs2raumpot1opto icias m2em(mon(4trtrmr oo1oaDrlu o;s trxoir oy1op nlnvtl( aDra(  no1opxomoeiydla emuvs;t0trenmrctydfa eanvil()s2xmio oudam eliesls  rtax ono0tpeo ociasfmDrl(msn(0 eermrciotlm  luvo;( srtoir io1open nvsas)srtmx ooo4alx miciadfs2raumsnt)texomfctotlmDe uvs;t0 2uoxr nu4ll elfesat  Duru  ;t0alt mfctys sDel( pnt) exrmo oodopte i s;t t2to(m oo4lmeemnvs t s2umu p;t0ale ifciys s2ea(mpnt4 rermf totfpDelneolt0 eur(opoudlm nlnvtlsf Dumu  nu4oexn feiltfa rln s (4altomf ty1fate nvilt setm(m3iydale  fvi (  2rrxr ou4optomfetas s ea( o t)aexomf3tatfm eluvi;t)s2xr(m io4ale lncsa(f rurxmoou1tpxn i3iadfs2uaumo;t4alenxr3ty1omDraivo ()s2xm(o iydol   ieslt)artmxronu0optoiieiys mDuln ont4artomo3to1fmDeaivi s0srtrxo3iu1op  mnetl(f rurx  nt4tex  oeiatfaDrm( s (4tetoio tydlatrauvs s) 2uo(opnu4optelfeiltfarurxm nu1tptoifeildlaDuanmpnt0 eeoxo oy1omD anesl() rxoxm io1ol e nctl(  2rrumooo1oetomoeild m2ranmpn(4 rerif3todop rluei;(0t2xrir3nu4omt mivta( a2urx  ;o0tlt  ieiasfsDranvs;t4artomf totlpD lieo;s  euoxo oydom nmies (  2trum ;o0tpe ioeilt s rln snu4aeerxf iotop rli ol()srtoxr oudllenlnvtatfs2urur ;u4opt  o3tydls eanms;(0tetoiocia1lpDelu o;s0srxr(r3iodamen nvsa(f 2tmurpnu0apxomo3tldfaDel( onu)trerxf3oy1om eliesl(0srxoxmpio1ame  fcs t)a2rrurono1alt mi3iat m em(mp;(0altnmfciatopDrlivils)srxrxr3oodlmtnlfctl(f Dtrum ;o4texo fcilslsDranmp;u0trerxo3oadlpDeluvsl(  rtmxo iu1op nmncslt)sDrrur ;u0apt mfetyslsDrlu o;(4texnxf iydlpDrlnvi ( trxrxm3ny4olen ivta()srtrurono1aex ifeiaslm elu p;u4aexomociydfaDe neil( sexoio3no1oltn ici sfaruau pou4teenmi3tydfaDulnvpn(0aexrxfcoa1lp ran i;s0texo(r oy4lltemnctat a2ur(r ot0oleo fciydfaDra(ms;u4trtnmr3iatfa rlnei;t0 eur(m3iydolte nvta(f rum(r ou1texomfciydfaDel(mo;t0altnxocoo1op ran s;( t2toxm ou1ome lfcias aruaum nt1ope ii3tatla2el(mp;(0tltnmf oo1lmt  u sls)t2trxr nydamteliet ( arum(moot1tlen fetldfa rlnvont4 rxoif3tadoa rlnei;s0 rto(m3ny1optelfvsa( aDtaurp;o0teto fctas sDeluvs;u4tetrmf3to1laDeln s;( srxm(r3iy1ome  neta()sDuaxr nu4tpeomoeildlaDran p;t)tlxrmr tydfa rlneils)tetoxopno4ll n nvsas sDrmxro;u1alxoio3ilt a2emu pnu4aeerio iadfmte uei;t truo(opoo1openmfvsl(fsrtau poo0aee ioeilsls ran s;t) eeniocoydla eluvi ()trurxo3nudom  lies t)aDumurpou1olx  ictldfaDean p (0tltoif3to1lmDranvo;()trumxr io4apeemnctatfs2rmu  nu1tetnif3tadfs el( o;u0teenircoytoatraieslt)trtr(o oo4omeemicta(  2raur no4alxn ictlsfmDulu o;t4 rtnxf3io1fm rluvils0t2uo(m iydape mfvs s) rumx o;u0oetoio3tytfsDraumpnu4teenxf3iadlp rauvolt  exmir ny4apeemfvsltfa2rm(rpot0altnmociysla ul(mp (0 exrmf ia1lmDeaivs t)tetmimpio1lmtemieslt)sDurumpoo0olt  fciasfa ul(vp u4aexomr totfm  lieslt tetm(opio1lpeelnvt (fsrurxrpno1tptomociasfaDemuvp () lxrmfctytomDe i o;(0texo(o io1ap elicias arta(m ;t4alxniieiyd sDem( s u)aexomf oy1fmte u ol(  exoxm nudopenmiesas s2um(moot1alto fctyd s2eanmp t0arerxf3ty1oa eli o s0srxo(o3iu4ole lfcia(f rumxrp;t4oexoii3iysfm rmuvp t0trxoifctydfpteauvo;s0 rtm(rpoy1llt mncil(  rurxmoou0teto ociad s2ul(vs;(4aexnxr3ia1fm   nei;s0t2uoim3oo4ap elfci (faDuax ooo4optn feilslm ra(vp;u)texoir3ia1op eln s s0trtrxr3ou1lmt lfet ()aruaxrpnu4tpx mi3tlsfsDuln snt0 lxrif ty1fat aivsls  rumim nydolt mfcils)aDuaxm oo0tex  o3iytfs uan s u4 reomo3iydomDelivsl(  euo(o nu1omt lfeta(fsDur(  ot0tpxomo3iltlsDrmums;()aeenif3oa1opD  nvols) rxmxm3iu1am e fci ()sDra(rp;u1opt  ocilsls rauvsn() rtrmf3iatop  lu i t0 rxrimpio4ame  nct t sDta(  ot0tlenii3iad a rmn pn(0arxrio tatomtrai s;t  2toimpiy1apt  fesls arurxm no0opxnif3iyd sDrauvo;u4 renmfctydla  livo;() 2trxo3iy4am nmicta(faDua(mo;t0apx mf3iyt m ua(vp;()altrxo ty1fm  anvi s0setmxm3oo1lp emietl() 2tr(rpou1tlt ifeiyd aDrmumo ()texriociy1fm elnvils0s2xoxmpou1olenlneilt  Dtr(mpot0aleomo3ias a eanmo;t4areriocia1lmD livi s t2uoimpoo1lp e iesasfa2um(mp;u0ole  ieilt s2raumo;u4arxrmrciy1lat  neil(  eurxrpoo4ame mieil( sDtmuront4optnifciyt aDuanvo t0 eeomf iydlp eaieo;s)t2trxrpio1lme  ivt s a2tr(r ;o1tltoifciat s2rlump (4tlxriocoa1latrli s (0sruriopio4al  livsltfsrra(  nt4tlt ii3tasfa2ul( on(4 etnio3iotlpD lneolt  ruriopoo1om emnesas  Durumpno1tlxomoctatfsDeanvo ()aeerio3to1oateli ilt  eto(r3nudamt lnvtl(f 2ua(roou0apxoifetltfm2ea(vs t0 renir3ia1om  ai o t tetrxr oudllt mivsa(fs2ur( pnt0tetnmociat s2el( sn(4aeeomf3iotoa r i s s)t2xrxr iy4apen nvia()arrrxm oo4alx iieiatls2um( pnu4aexnxf iodfm ean o ()trxo(r3oydapt mfvi s)sDtrurpnt1apxo fetytfm2rm(vo t0tlxrxrciytlat li s (  2urio3ou1opeelfviltfaDumxmont1aee ifetldls rl(mont) reomr oytfp eauei ()seurxo3io4amtelfctat aruaumonu1tlx iociltfs ra(mp;u0tetomr3iy1oa eaneols t2uoxrpoydlmt lncsl()a2tmuro;o4tlxoio3tasfa um(ms;(0alxnxr3oadoaD anvols0srxrir iu4olenmnes ( aDrrxrp;o4open octyt aDum( p;()trxoxo ta1opt ln s;t)s2toio3oo4lle lfvt (fa2trxm ou0opxoifeiasfa2rl(msnu) rxrmr3oadfpD aivi;s t2toxr3no1am   nvsltf 2rax poo0alt ifciadlmDean o u4 rtrmr3oy1fm  ln s;(0s2xmxo3iu1ol emicsatfs2uaxronu0apeo i3ildfa2ua( s;t4 rerxr3ta1la  lu il() 2tr(rpiy4ll e nei s s2raxr ;u1tpt mietatfa rl( s (0aeeoio io1fa r uei s)setrxr3iu1lp n fetlsfa2tmxm no0ole mfetys sDea( ont4 reomf iotlm eau sls)t2toxo3nodop nlict s) 2raxmo;t0oeenmf3ils m rlu sn(0texrifctodlp rlu o;(0setm(rpnudamte icias  Drauro;o0tlx  oeildfa2ulu pnu)tetrxo3iodomDeli s t0s2umxm iu4op emncsltf 2ra(ro;t1opxniictyslsDuanmonu0arerif oadop raies s)sruoxr3iy1al elnvs t)aDumurpnu0opt  feiys s2ea( p u)arenif3oydlpDr n o;( t2xm(o oy1olenmnet s s2uaxro;o0apeomo3tys sDrmnms;u) rxnio iadop   ivi;s0 2urxr3iy4llt licia()aDra(m no1ope mociydlmDrmuvp;t)aetoirctytlatraneol()seumim io4om nmfeilt)arta(m nu0olenmf3ilsfm2rmnmo (4aeerxr iy1fp rauvs s0 eto(m3oodlltelfeta()arum(ro;t0oeeomiciltlm rlump;u4aetrifciydfptr ies;t tetoxmpio1ap nlfvtat sDtrum ;t1aexoiietytlmDrau on(4 rermf3iadom r nvi;(0teuriopny1lm emnet s)sDraurp;u1tex  ietatlaDeaumonu)tltrxr3oydoateaueolt)s2trxopoo1ap elivi sfsrrrx p;u4olt  f3iadfa uauvpnt4artrxr oatoa  an il() 2to(r oudlpee ies (faDur( p;o0alxnmfciatlm uaums u)texnxo oatlaDeaiei;t)teto(opiy4amen fei (f 2ra(r nt0oltn o3tltfaDumnvpnu4arxrmociadomDeauvs t)sexm(rpno1lptn iet ()a2rau ono0oleo ieiatlm uluvsnt4 reoxo3oa1lpDrlnvo t)seumio3ou1altelictas)srrr(rp;t0tpxnii3tadlaDrlu s u0 exnxr totfmtrlies t srxo(m3io4aptemictas)srra(m ot1olt iociyd mDulnvsnt4artrmr3ia1fmtrlnei;(0 2xmxmpoudlleemfetl() Dtr(mooo0open i3tadfsDumuvo;t)treoioctatlpDr n il(0 2tmio3nu1lmtnlivsl(fartmumpno4tle ifctls s uln onu)aetrxo iatlmD  ieolt0tetr(r3ny4altemfeils)srtr(ro;u4texnioctldlm rln o t)tlxnxf3todomDr nvil( seurxr oydameemfeiasfarrm(rono4ale iiciytfmDuan s;(4tltoxo3oy1lmDrlu ols0 2trxo3oy1lleemnctlt)arua(ront4oexnmf3iyt a rlnvpnu0alxoxo3tytlatelnvo () 2umimpiy1lm nlnvsltfarua(mpnu1alen ociyt sDulnvp t)tltrio3iydlp raieo;t0tetoir3ou1amte fcilsf 2ur(rp;u0oeenioeiydfs ra( o t4 ltnio tadoatelnes s srtrxmpou1ol  mnvsl(  Dur(  no1tetoioeiydla2uauvsnu0trtoiocta1op  lnvo s) etrxopiu4amte icsas sDuax pnu0tex ifetys aDraumsnt0artoircoa1fatrauvilt) etrxrpiudoleelfvt sfa2um(rp;o4apx  i3tys aDranvp (0tltrmf3todlmDe uvo t)sexm(mpiudapt  ici s  2tr(rono4ale iieiyslm ua(mp;()trxoxociotfpteluesls0s2trxm ny1ale mnetlt srtrxroot1olxn fetysfmDemu o;u0aexoio3to1oa e uei t)t2uoxmpoydamt  ivtlt sDua(  ;o4oetnii3iysls ul(vo;t4trtnxf3ia1la  an sl()sexmxm oy4olee nesat) rtrx  nu4tpxnif3tls a emuvo (0 etomf ta1lmtranvo;s0trtr(r3oo4op   fcsasf ruaxmo;o0tlt micilsfmDrau s (0trtrio3oatom   i olt s2tm(r3oy1ol e fvi s  rumump;u1tee  feiytfa eauvp;()arenxoctotlatrlueo s0trxmxo3nudom elivsl(  rrmuronu0tlt io3ilt aDul(vont4 etrmf oy1oatraivilt) 2uoxr3nu1op nlfviasf rrruront0olt miciatfsDrlnvsnt4alenxf oytlm e ivilt0 rxoim3oodolt miesasfs2umumono0oexo ictys a ran sn(0 exoifctodlmte nvs;( srxmxopio4ll nlfes t)s2tru  ot0tlx  fctytfs ulu s;() etrxfcoy1lpD  nesls0 rum(r iudap n nviat)sDtrur no1aleo fetatlsDuan s u0alerio3todfatrauesl() 2xrir3oy1lm emietltfa2taurooo1aetomocias s2rauvp (4 lxriocoo1lmD lies t0t2xo(o oudapenmieiasf rum(rpnt1tlt  feiadfaDelump;(0trtnxfctodop ran olt0seurxr oudll elnesat sDtr(m ;t1optnmociaslm2ua(mp;()tleoif tytfa   nvs t) rxriopoudlmenmictlsfaDtru ooo4ope  o3iyd m rauvp t4 etnxf tytoptraneo;t) ruoiopnu1op  mivta( aDrr(m nt0olx ifeiydlaDrm(mpnt) ltnio ty1fmt  ivs ( srxm(opoy1ole  fvs t)sDtaum oo0tle mfciadlaDuanvs;t) exnmr to1op eai o s)teto(rpio4am n nci t  rrmump;t4opxoiictatfs elu s;()aexrircoo1omt li s t teur(opiudal emfvtasf 2tmurp;u1alxo oeiltla rl(mont0 exrmr tytopDeli i;t s2xm(r3ou4am elivslt) Dtru  ou1tlxniieiytlm2rmn s;u0 etniocta1lmDrli o;(  etrxm3nu4al nmnei s s2tmx p;u4tpxo fctaslaDemu s;t0trenifciytfpt li o t)t2toxrpnydopenmncslsfaDta(rp;u0texo ociyd s2uauvont0trxnif3iadfp elueo;t s2urir3oy1optemictas srta(  ;u0alto feiys m2em(vo;(4trxoxocoydlmD anvsl()setmiopoudamt mics t  2umx pno1apxnifeiyt s2umn o (4trenxf iytfmDrai s t  rto(m3nydopeelnetasfsrrmu ont0ape  i3iltfsDuanms u4 eeniocoatla r i i ()seurxr nu4ale  ici s srtaump;t1oltomf3ilsfs2umu s () ltomocoytoptr ivs s srxm(m oodopeelnvta(f rraxro;u0aetomoeiydlsDranmsn()trerxf3ootlm  ai s t)texr(m3iu4lme lfvt tf 2rm(mo;o1ale  fciaslaDumuvpn(0trxnmf3oydfatrli o ( t2tmxopnodap  lnvsls)srua(mpou1ope ifctasfsDeluvpnu0 rxoxf3totfmDe n ols0s2tmio nu4apeemivi sfa2uaump;u0oexo o3iltfmDelu pn(0 eeomf io1oaDraieslt0seurxm iy4olt lncslsf Dtmx p;o1aee  f3tltlaDrau o;t0arenmr tatfmDe n ol() etr(opoy1ape  nei (f rtm(  nt4olxoio3ils s2ean p t)texrmrciodlmt ai slt  eto(mpiydlp e feils)srrr(  no1alt  i3tasfaDua( s;u4treoxfcoydfate uvi s  exmxmpny1apee ietls  2umx pou0aptn octytfmDelnmpnt) exrio3oydlm  luvol(0 eurxopio4ope licslt)a2tmx o;u0aex iieiadlmDuln s;t)teenio to1fmDeai o;( srxm(rpiu4ame lnvs sfaDumx  ot4alxn i3tyt s2ulu s u0aexrxf3oy1opD auvsl( s2xrim oo4lm n ictls aDumu poo4opeomi3iaslsDrmu s;()arenxo3ia1la  lu ol()t2trir iydlm   ncsatfs2urumo;t1ale  ietas m2ra(monu4tltrxo tatlpte nvi;( texmxmpny4ll   nci ()s2rmu  ot0tlxn ictasls2ea(msnu0tlxoiocto1oaDr u ol(0 exmxo3ny4olee nctl()sDraumpnu1tltomf3iyd sDrlumont)tlermo3iatfptrln ol( texo(rpnu1lme lnvsa() rtrum nu0apen ociasfm2rl(mpnt4 eeoio3oo1lmDrlnei t) rxm(mpoodam nlnctas)sDtrx  ;o0aptomiciyslm em( snu0 leoxo3oo1fp  aies;()texrxo ou4ap nlieslt arurx oot4apt ioetasfmDum( s u4 lenio3iodom  an olt  rtoir iu1al emfvt s)aDrmxr ;o1tpxoiieiydlaDemn o;(4arxrir3oodfatr nvs;()seuoxr3io1op n neiatfs2rrxrpnt0opeo ociadla eauvp;() etrir totfmDrai s t)setoxm3ou4lm emnct ()s2ur(rpno1tet ifcilsfm ul(mo t0trxomrcia1fptrlu sl( t2xoxm iu1lmtemict () Dua(m ;t0aex if3iadls umn s t4tetoxfciy1opteaueo;s0 exrxm3ny4lm e nesasfsDurxr no1opx if3iadlsDum( o t)aetnmo3to1fpteluesls) 2xoirpiudlp   ncilsf 2rru pot0alt mf3ias m ra(mp;t)alenmf3oydfm e ueo;(0 2tr(r oo4olenlnvtl(f 2trxronu0oleomfeiyslm ran o t4tltrif oydoptr n s s t2urim3iudlm e nesas srua(root4oee mfciydfs2eluvon(0 rtnxfctadfmDrluvo ( trxm(rpoy1olte fciltfaDurxmo;o4olx  feiysls2emuvs;t) exnifcoadfm rlieils  eumxr oy4ol  lfvia(f rtr(mono4tltoiieiadla2rluvp u4tlxnmf3oydlpteln ol()seumimpou1ame mfcsasfs2rrxr oo4oeenmf3ils s2um(vo u0 lxnxf3oo1lpDe u o t  2uo(o3io4al   fcslt)srumx pot1olenii3ildfm emnvs;u0tltoxf3oy1optran sls)texr(opny1optelnei tf 2rauro;u0opt iiciat sDea(vsnu0tlxnmfctodoa r ieilt0 exr(o nudopte fcs (f 2tm(m ou1oeeomfeiys a2eluvs t) leoirctydlp eai s;( texrim ou4ape  ncsat)a2tmxm ou1opxomo3iad sDuauvon()tetrxf3ta1faDrlueils0trxm(rpiy4amtn nes (f rrmurpoo4apenmoeils m ea( o;u) rtoxo3io1lmD lu s;()t2ur(mpoy1lmtelicsl(f rtmxro;t1tpxnio3tysls rln pnu4altoif iydla rln ols0s2trxmpnydlp  lncil()s2urx ont4tptoiieias aDrmn ont4tlxnif oodlpte neols0texmxrpiy4amtemivia( srur(monu1open o3tatfaDelnvo;u) lxoxf3io1lpDean o t trumimpoudop   fcs () rum(m ;o1apxn ociydlsDeanms (0teenxo iytopt ln ils trxm(m3nudam emieias srrr(m ot0alt ifciys aDeanmo;u0arermfciotfmt lies;(0setrirpoy4amtemieta() Dtax p;t0apx mo3tadfm2emu s t4trxnxr to1omDeln s () rxm(o nydlmtelfvt sfaDrr(mp;o0texnmiciydla emump;u0arerir oo1lmtr ies;s s2um(m3ny4lmte fvi () 2uaurp;o4aeeo iciatfsDelump;u)aetnxoctotlpDranvo;()trxmiopnudolenmfes t a2rrx poo0alt mo3tyd s2raumpnu0 eeoxf3iodfp r ivols0t2ur(m3no4opee fctls  rrruroot1tpxnmictyd s2uau on()texnmociatlpDrai s;t)texm(o iy1ome lfet (  2raxm oo0oltoii3iyt a2uauvsnu0arxomfcto1omD aivsls)s2toio3ny4llee fcil()a2taumpnt0aptnmo3iyt aDelu p t4tltrmf3iotlpte nes t trumir oy4ope mivslt)a2ta( pnu1aetoiiciadla uanvp t0altomo3to1lpt auvil() rtrio3ny4op   ictas  2ta( ono1tpeo f3iydfm ul(mp (0tltrmf oadlateli ol()s2uoxmpiydomenmfvsat a2uaxront0apt  iciadfmDemnmo (4alxnxo3to1lptr nei ()srtmxopio4lp  mnciasf Dtaurpoo4aptoifeilt s rm(vpnt0trxrifcto1opDeai i;t)setmio oydlmtelfvsl()arraumo;o1oeen ieiydla2uln on(4trxnifciotlptelies;t) 2urxopoy4olee fcsls s2tau o;u0oexoii3iatls eanvs;()tltnxfciotoa eanes s)t2toxopiy1lm emiesas) 2uauro;u1alxn fetysfs ulu s;(4trerxrcoa1oateli o (  rtmir nudomenmivsa( arum( pno4opt mfeiys s em(vo;(4areoio ia1fpt  n o;s) rtrxr3ny1ol n fvi t)aDta(rp;o0aptnmoctlt sDemn p u)tlermfcto1oatr u slt0srxoxmpny1am nlfes s) rrr(  nt0olxnifctaslm2el( o;t0aeeomr to1fa e ivo t)texrxr oodap n ivslt  rumu  ;o4tpxomfcias a2uau o t4teenmf3oatop eln s t) 2xo(m3nydlmeelnci ()s2tax pnt1ole mf3tad a ulnms;(4tlxoxr3oy1fmDrai sls) 2xoir3iy1ape mivsasfs2rrx ont0tetnmoetldlm2emump u)arxrif iatfpD  uesls)srum(rpio4lpenmict (  ruax pno4apt mfcildlaDrm(ms;u)arenxo io1fm rlieil( tetrxo ny4amenlietas)sDumumoou1oee moeils sDua(mo (0 rxrir ia1fm eliei;s  etrxmpoo4lpe  fviatfaDuaxr ot0opx if3iytlm eaumpnt)trerxr ia1omDeai o;t)teumio nu4lm e ics s srtrumont1tltnii3ilt mDeau pn(4altnmf3totfaDe ieo;( s2xr(opno1ol  mics ( aDumx  ou4oleo ieiatlsDrln snu4tlerxr3oy1lm r nvil()sexmir3oy1ap emivtl(  rumx  nt1tetoii3iyd m2el(mp;u)altrxo3oytomtr neo ()seto(r oo1lmtnlies ()srrm( onu1tlt mieils mDulnvsnt4 eeoio3ootfp eaivsl( srto(o nu4lle  iciat  2tr(r ;u4optnio3iysfm um(ms;t)artoxociy1omDe neo;s)t2tm(mpio4al  lncils arur(ro;o1aeen o3iadlsDel(mp;(4aeenio to1opDe nei;(0s2umim nu1lpee fvil()a2rmx  ;o1aexnmi3iasfaDrmumpnt0arerif3iydoa  lies s0texrxo oy4am nlnetatfs2trxmpot4tlxnif3ilt s rm( s;t4 reniociotfpD ln i t)s2trir3ou1ll emnvtlt  Drmum ;o4apt mi3iltfs2rlnvsnu0teerio3oodfm   ieol(  rtr(o3oo4amtnmneil(farrax  ot1tle ioeilt mDuanmon(4 etnmocto1fat lu s;t0 2triopoy1lleemiei ()sDumxrp;u4tltn ocilslaDeanms u) rermfcoatlmtrlivo;(0 rxmxopiu1alt mfvi tf Durxmo;o0tpt io3iys m umuvpn()aexoio tytfm   ieo t0trtmim io1omt mnviat)s2rmxro;o1tpxo fctysfsDrau pnt4 renxf ta1omt lueslt0trtrir3io4opeelncs s)s2raxrpnu4apx mo3tld s uluvs (4artrifciodomDelnes;(  rxrxr3ou1llee ictlsf 2umxmo;u1aleniictydlaDulnms;t0 lxrif3iodopDeluesls)t2um(r3ou1ame mivsltfa2ua( pnt0aeeomi3iydla2rlnvs ()trtrxfctadomtranvi s0trxo(o oy4am   nvtasfsrua(ront4aexnmoctadfs2raumo;(0treoir oy1lp r ivs;t0 exmxm io4alte ivtls)aDtm( p;o4openioeiytlmDrau p;u4tlxoif iatlate nvi;t srtoir io4ome mfcsl()s2ururoot4teeo ictyd s ulnms;t4 rxrmfciotoatrauvol(0seuo(r3io4om emici t  2tmuro;o0openif3ilsla2ua( pnt0aexoxf iotoaD lu ilt0truoxm io1lp   fei sfarrmxr ;o4apx  feiasfm2ua(vont)texnxfctydomDe i ilt0 etoio3nudoleelnvsas a2tmu pno0tlxo iciytfmDelnvpnt0 ltomrciadfpD lnvsls0trxm(o3iy4ale mici tfartrx ooo0oetomo3iatfs ua( snu)aetoxo ty1lmDraneolt0teurxrpno4lpeemnesa( sDtrx pot4tlenmieiyslmDulnvs;t0tetnmocoytfpD lnvsls  exr(m3iydlmenliei s srrau p;t4tlen iciad m2rl( p u4 etrif tatlm eaivo s) euo(m ny1opt mnvsltf Drmur nu4oleniocilsfs rauvo;t4aexoxrcoodla rlnvi ( srto(m3iu1altemivi sfaDta(mpoo1opt iieiadfmDrmu onu0aexoif3oy1optrauvils) 2xo(opio4omtn icsat  Duau p;t0teen ictat m ulnmp;t)trtrxf3todfmDr n ols) rtmimpio1altelfviltfaDta( o;o4tle mfetad m ul(mo t)alxnio todlat lnvs;s0t2uoim3iodaptemieils) Dtax  ou0oleoifciytfaDrau pnu0aetrio tydlaDe ies t)trxr(r3oodam nlncsat)a2rrurp;t1tpt if3ildla2ua(vonu4tlxrxfcoatlpt  iesls) rxrirpno1ol nlivtasf 2rru oou1ale iietysla ua(vs;u)trxrmr3oo1lpDran s;t)s2xoxopoo4alt  nes s) rtmx p;u1tet iiciasls em( o;(0aetnxo3iytfp   ies ()tetmir oy4opt  icsa(f ruax o;u0oeeomo3iytlmDemnvon()aeenxo ia1lm rauvil( srxm(o3oudomen ieil( a2tax pou4oeeoifciat s emnmont4 exomf3iadlpDelies (0t2uoim3iu4olenmictlt sDta(mono1alxoifeilt mDrlu o;u4 eeoif iy1faDeau ils)t2xrir3oudope mneiasfs2umxr nu4opeomfctlt aDuanmsnt4altnmo iydlm r nvsl(0 rxr(opnudlle lneils)srrr( pot4olx  iciytfa2ulumpn(0tlxnif iadlmDelnvs t0s2uo(r ou1lmte nvta() 2rm(m nu0open f3ildla ulu s;t4aexnircoytlat au il()trtmxo nudlpeemfesat  rumum ;t1alenio3iltfs ea(monu4aeenifcta1fm   ieo t)srxo(m3io1olt mfetas)aDuauro;u1oleo oeiat s2ul(ms;t4tlxoxf3oadlaDrlnvo t setmxm nu1optelfcsls  rumumpoo1oltomictlt a uanvpnu)aexomfciatfp e ieo t) rumxo ny1lp e nci tf 2trur nt0olxo ictatfm ra(von(4artriocoydlpt  u i;t)srxoxrpny1op e neias  2trurpoo1apt mfeiytfs um(vs u) rtoio3iotfat aivs;t0 ruoimpiodolte ivias aDua(ro;t0alx mf3iadlsDrmn o u) eenmocta1lpt aneo ( trxr(r iy4apenmfciat  Dtrx onu0optomfeiyt s emumpnu4 etrxo3ootfmt lnvsl(0 exrxrpoo4lmenlfvtl(fsrrm(r no0oee  f3tadfsDua(von(0tetomr tadfa eanvi;(  rur(m ou4lp elicsat sDur( ooo4openmiciaslsDuln p t4 rxoxr to1oat  uei;s  2tm(rpoydol nmicia() Drrx  nu4tex  o3tas m um(vp;u)aleoio3iy1omt aivi s truoir3nu1lle lfeias  rrrump;u4aet if3iadlmDemumsn(0tleoio3iy1oaDeau s;t)srxr(m iodolenmncsat  2umumpno0opxo fciasfs2rau p u4 renmociytomteaivo t0 2xrxmpnydlp  mfct tf rrr( onu1teeo ietytlm2uanmp;t0 eerxo oo1om rlieo;t0s2tr(r no1lmenmicsl(f rur( pot1tlxniieiltfs2elnms t)aeeoxo oy1lp   ivilt) eumxmpou1omtelicta(  Dtr(r nt4aet  iciyslsDean s;() eerir3iy1om elneo;t0 rxmir io4omeelfesa()a2um(moot4altnmoctadfa2ulnvp;t0tlerir3iodoptelneils0trurimpoudap  lfeiasf rta(  no4olxomfeildlm rl(vo u4treomrcoo1fpt li o s  ruo(mpiodol e nvtlt s2rru  no4tpxnmociltfs ul(vs () etnxrctydfp eln s;(0 etmimpny1aleemivs s)a2tr(m nt0tltnmoeiydla2eanmp;t0tltrxf3iydoptr i i t)truo(m iy4am n icias) 2urx pno0oltnifeias s uau p ()aeeoio3iatopDeaueol(0s2toxmpny1ale  ici t sDururp;o0olt iictysla2umums;u4aetnifcoatfat ai s t)sexr(opno4am e ietat  2ur(rp;u1optnio3iad aDulu p;t4trtoxr3ia1fa rlnes t0seum(r ou4amt mnetlsfaDtrur ot0olenmfctatfsDea(msnu0 eerio3oydlaDranvs s trurirpoy1lp  mfei s a2rm( ono0aet ifetadlsDrlu o;t4aexomfctatopteln i (  rurxr iu4lmt mnvil()s2trumo;o0apeoif3tas m2umuvp t0artrmfcto1fptelivi t0texrxo oudope  fes t  2rr(ront0oet ioeiaslm ea(ms;t)arxnifcoy1fa  an i t) etmxr nydlmtemictlt artaxmp;u4ope  feiys s uluvpn(4 eenir oydlpt  n o;t)t2um(m3no1ameemfvia(fsDtmxroot0tex if3ilsfm2emnmo u4artnmoctotop eanvols)srxr(r oy1omtelfcilt) rumu poo1tlen icilsfs2umump (0texrxr ta1omt aiesls tetmio nu1am nmici t) rrru poo4altoifciasfm elnvp;t)treomfcoa1lmtrln slt0s2toxr oo1lltnmfvsa()aDum(m ;u0opt mi3tltlmDulnmpnu)teenxo3ia1fat ai s (0 2trimpno4lltnlneia(fa2urx pou0aptniietldlaDumu o;t)tltrxrcto1lpDelueo t) 2xoir3oy4omeelfctlt arrmx  ;o0opt moeild a2ean s t4tetoxo iy1fa raivi;s0s2to(r3oy1lptnmfei sf Drm(mpno0aet if3ildlmDea(vp t4texrir3oy1fat lueilt)s2um(opiy1am nlfvi ( aDtmx  ;o1tpe  ocild m2ua(vonu)tetrmrcootlmD lueo;(0 exoxr iodomt mnvtas) Drmxrp;o4tetn i3tys m emn p t) leomr3iadlmt ln ilt)t2xoir3iy4ol e feils) Draxmp;o0optomicild mDumnvpnt0tleoifcia1fmt  ivs t trtrim3ou1lpe mnvslsfsDuau  nt1ape  ieilslmDel(mo t0 lxoxociydomDelu o s) rurxo3no1ape  nesatf 2raurp;o0tltn ietat mDum( p;(0trxoxoctotfp   neo;s)srto(m3ny4ope lfcslt) Dur(mpoo0alt iicias a rl(ms;u) leomo3oatfat an sls  rxmxopio4openlfet sfarrrxrp;u0alt ifetasfs ra(mo t)altoxociy1oa eln i;t)teto(o nydap emnvta(f Duaxrp;o0tlx  oeiydfaDulnmo t)trxrmf3oodfmt au s;t)srumxo3oy1ope mncta(f rrmu  ;t4tlenmieiyslaDrl(vp u0teeoir ty1oat anes;s0texm(opoo1olenmfvilt sruau pnt4apt iieiytls2umnmp ()arxomocoytlateai o;s s2uoir3nydlm elieslt) Durxroou1altnmocilslm2rl(mp;u4tlxoio oa1fm r n ol(  2tmim3iu4lmtn fcs () Dur(mo;u1oet  f3iatls uanvo u0aetnmocio1lmt  n sl()teurir3no4lpte iesls a2raxroot0oleo fctadfa2umuvo u0 renxr3iy1omDeaueo s0 rtr(m3oy4al nlfvta(fsrrrxmpoo0tpto o3tyslaDemn s;u4alxnxocoatomtr u ilt s2umirpno1amee nci t)s2uau pnu0tet mfeiad sDel( s;u4 leoxrctatoat anvo s) exo(r oydop nmfcsat)sDtm( oot0opxo ieiydla2ran o;(0trerxo ia1lpDrlnes s  2tmim3iy1lpen ietas srta(rpou1aptnmociasfaDranvs u)aexrxo iy1oatrlieo s trumxrpou1olte icilsfa2umump;t1tlxn ieiatfa2um( pnu)treoxf3todlaDr iei ()sruo(o3oydameemfvs s arta(r nt1opt  i3iatlm rm( pnu0 exnifciy1laDrauvs s srxmxo ny4lptnlivtltfsDum( pno1tex  fetat s umump u0tlerifciy1oa rlieil( t2to(m3iodapee fesl(fa2rr(moou0teenmfctld m2emnvpn()tlxoxf todlmDr i i t0 2tmxopiy4omt mfci tf 2ur(  ;u0tpx mi3iyt s2rmnmp;t) ltrir3oodfp elnei ( t2toxm oo4lpee iesl( artmxm ot1aptn f3tyd a umu sn()aleomo3oytfatraiei;(0trtrimpnudom  mfcil() 2uaur nt1alto ieiasfaDemumpnt0 leomo3oydfatr u i s s2ur(o ou4aptemnvi sf 2uaxm ou0tpeoii3tatfaDea(msnu0tlenxr3oy1fmte ieo;t trurimpoy1ll emivia(faDtrx  ou4tpt moeiydlaDem(mp;u0 etrmo oo1opt aivo s t2toxm3iudopee nctlt  2uaxro;o4tpt mietadfsDuau on(4 ltoxf iotfaDraiei;t0 2umio oodllen nviat)a2umxmo;t1oleo iciys a2eau snu4tlermr3to1lm rai i s) 2ur(o ou1olt livs sfarumxr no0alx moctldfa2umu p;(4aetrifcio1fa rau s;t0 exrxr iodll n ieil()a2uru  ot1alxnmf3ilt m2el(vp u4alxrmf3oo1lmt  n slt0tetrim3oo4om nmfvi s) rtax pnt4olx  feiatlaDrmn s;t)trenioctytfmteaueil( s2xr(o oy4alenlictat  2rr(  ;o1opeo f3iltfa2rm( o;t0 eerio3iydopD  nei;s t2xmxopiy4ole  fcs t  2taxm nt0tlxnmi3tyd m2uanvs;t) lenio3oo1lpDeauvi ( srxm(r3io4lpenmfvt s) Dtax p;o4tpeoifetyt m2elnvsnt0alxomo3ta1fmDr uvs t)t2xr(m3iodameemfvi s a2ur(monu4alxnmo3ilt s2ranms u4treomocoodopD anvo;s)srxmxr3nu4lp n ncsat) Duax o;t1teenio3iyd s ulu p (4tleoif iytfa eluvi;s srxrim3iudom n ivsl()sDumu oot0olxnioetydla elums u0texniocto1fmt  i ilt)t2xrxr iy4lltnlnesl()srrau ont0apeomfctlt aDuanvsnu0teenmfcto1latean o;(0texmim3ny4am emnciasf 2uaxrp;u4aexo f3tldlmDua(mp u) rtnif iatoaDr nei s)sexoxo3oy4am nlfctlt) 2tmxmpou4oleoifeiydla uan s;t0aeerifctytlp ean ols0s2uoim ny1lmeemnvt t sDtaxrpnt1ale ifciytlm elu sn() exrxociytlat au ol()trurimpiy4amenmfei tfartaxr ;o4ale io3iyt s2rauvpnu0tleomfcoa1fmteln olt seur(m3ny4omtnlnci sfaDuaurpnu4optoioeiyd s umn p u)trxoio3iatlpDe i s (0 rxoir ou4ale micils a2rm(ro;t0tleo ieiydla2uluvonu4 reoxfctatfpt  n s;t t2urim ny1lp e neslt s2umx pno4olxn f3ilt aDea(mo;t4 rerxr ta1lptr nvo s0 rxrxmpiy4al e fei t aDrm( pou4opeoiociasfs rlums;()tlxnxocia1lat auvs;s0 rur(rpoy1al elnviat aDurum nu1altn octlsfaDra( snu0alxrxf to1fp  livslt)seur(rpiodlm  mivt (f rtrxm ou4altomo3ilsla2ranvo u4 renxo3todop   ivi s sexoxmpnu4altnlfesat a2ur(monu1tetnmf3iysls2ranmsn(0 etrxo3tadfaD  uesls0s2urir ny4ope  fvias)s2ua(mpou4tlxnmfctydlm2ra( pn()tlermociodoaDeaiei (  etm(o3no4lme lneilsfaDtr( pnt0altnmo3tld s2um(vp;t) lxoxoctodopt lueolt0 rxoxo3iu4lpt  fes (  2urump;t4ole mo3iyd s ra(vp u)texoxo iadop   nvo;s0tetoim3nudam nmicia() rtax ont0teto i3tld m2el(mo ()aeerio3to1fmDrai sl( s2to(rpiu1am  miesa(fsrtm(r oo4tet mo3tadfa ua( s;t4trxrif todlmDeli o s srum(opiudapeemnctltfsDraumpno1optoifeilslaDel( snt4aexnmf tydlm eauvo t) etm(m3nu4alt lfctas a2taxro;o1oexnii3iydfmDrlnvp;(4 lxnirctytomDe ivolt trumirpny4llt lneta(  rrm(ro;u4tlenifciasfm rl( o u4aeenmo3io1omteau o t)t2to(o3nudop emnct s) rtrxrpoo4tle  o3tydla rlumsn()texomrcoatfa e uvi;s srurxrpiu1openmnvslsf rua(mp;o0oee  f3tysfsDrl(mo u4trtoxoctadlateau o s)srxmim ny4oltemfvsl()sDtaur nt4oexoii3iatls2eau onu0tetoxr3iotomtrluesls)trtm(mpiu1omte fvils)arur(  nu4opt mfeiasfaDrlnmonu)arxrxo oodlmDr ues s setrim3iy1ll nlics tfa2ra(r ;u4tle  f3iys mDrmuvo t0 rxrmo3ia1lm  anei s teto(o io1alt mnvsatf ruaxrpot1oetoiocildfm2um( s;(0tlxnxr io1opte ueo;s trxrir iu4amtn ici sfsruaxr nu0aexo octydfmDeanvp;t0 ltrxo oydoa  auvi;s  rumxm io1omtelfvsa()sDraxmoot0apxnifciytla2el(mp;u4alermf io1op   ueo;t0seur(m3nydlltnlnctls a2ta(r ;t1tpeo o3ilt sDrlumonu) ltrmoctytomtrlivi;t0 2xrxrpio1llen netatfa2uax o;o4texn feiaslm2emu p;t) rxoxfcty1fpt  ivi s) 2uo(o3nydllt lics tfsDumum ;o4tetoiictydla uln o;u)altrmo3ia1om   n i s texm(m3iy4llenmieilsf 2rrur nt0aeeo f3iysfmDrluvp u4alxnxo oa1laDeauvils)sexoirpny1ll n ncs () rrmurono0ope  octltfm2rlu o u4aeerxocoatfa e i ilt0 eum(r ou1ale mnetltfa2rmumpnu0oleo ietas s2um( s t0alenmocto1oaDelu o;(  2tmxopoodllt lfcia(fsrrm(r oo1apxomfcilsls2ulumsnu4trxrxf3tytoptrlnei () euoim3oydlmtnlfcil( aDuaumoot1aexo f3iysla2ua( s;(0 lxnxfcoy1lmDe nes (  eumio3io1omtnmncil(f Drmum nu1oexoifeilsfm2ranvp u)altoxf to1lmDeaneo t0texoio3oy1op   nvtl(f rumxmp;o4aeeoif3iysla2uanmpn(4 ltoif3oodlaDe ieo;(0s2umxr iodap e fvta()srrau o;u4tlx iociydfm rm(vp;t4altomf3iotlp e ieils)sexr(mpiydlle licsas)s2tau o;u4aexnmoeiys m eanvs u)artrmo oo1fmt lies s0srxmim3nu4aptemivtl( sDumxmonu4olt ii3tad sDrmnvo;u4artrxfcoy1om elu ilt)s2toim3iu4op   iesa(  2taxmono0oetomf3tydfm2rau pnt)tlxnifciodlateai il(0tetrxopnydlm  lncilsf ruaum ;o4aex  feiad mDua(vonu0 rtrir3oy1oa eli s;( setoxr3nu1omee fct (  ruru p;o0texoii3iaslsDrln snu) lxrxr tydop  aieil()sexmirpio1altnmfcsltfs2taxmoot4aleoifctytfm elnvp u0tlenmrcoy1op eliesl(  2trxm no4ll  lnei ( aDua(rooo0tpeniiciltfs2rm(ms;u)texnmo3ootlm   uvo s  2um(mpnu4op n feiasf Dtrurpou0tlxn ocilslaDul(vsnt)texrir tadfaDr nvil(0trtoimpiu4omt miei s srur(mp;u1opx  f3ilslm ra( o t) ltoif oytfpD  uei s0 rxr(mpoo1lpt lnvil()a2tau poo4oexo octysfsDelu ont0 lxnmo3tytlmD  u s t srtmimpnu4lpt  ivi t)s2raxmono0tpxomfctas m rlnvo t) renxr iatla r i ilt)sexrxr3oy1apen ieias aruaumo;u1alxo octydfs2emumpn(4 rxrioctadoaDrlivilt) rxmiopnu1al nmnctas)aDum( pnt1tlx  i3tatls2ean o () reoxr iatom rlivils teur(rpnu4ol elfvi s) rra(m ot4tetnio3iys s2em(ms;(0tetniociadoaDrai ils)t2urirpnydol   fvtasfs2raumooo4oeen fctytfs rlu on(4 lxrir3iodfmD luvo t) etr(opnudlp  lfviasf Drr(mp;t1oee ifcils m2rmu p (4aetriociotoat luvil()texoxo no4op  lfeil(  2um( o;o1oeeoif3iadfsDuanvp;u0 exrmr3iotfmDelivo;s) rtmxo nu4oltnlfcsltfa2rm(rp;t1apxo f3tasfm2ua(vpn(0 etrmf iydfpDrai s ( teur(m oy4ameelictl() rra(r nu1ale  ictasfsDrmuvs;t4arxrmfctatfmD ai i s0srurimpio1op nmivt (fa2tm(m ot4optomf3ild a2umnvonu0altnir tadlaDeauvi;s0tetoio3iodam e fct t) 2rmx ooo0oeeoifeiydlsDraumo;t4artnxoctatlp r ieo;( trur(o iudlme lnct ()sDra(r nt0oltnif3tlt m2el(vp;u0artrmr3tatlat ai s;() 2xm(opiydlpte fct s aruru  oo1teenifeiatfa2rlnmsnt0tlerxocoatlptrauvslt sexm(r oy1lp n fcil() 2ua(mont4olt mieiysfaDrlnvon(4 rxrxf oo1late n s;()s2trirpou4lpt  ieil(fs2umxmp;u0aeto f3ilsfm rmumo;t0tlenif io1fpt lies;s t2xm(o3oy4ll n nvia( sruaum oo1optnii3tys s2em(mpnt4 exomf3oa1fmt luei;s0 2xmxr oudame lfcs t  2raumono0aeeoio3iadlmDrmn s ()tltrxociydomteauvsls0trxmxrpnodlle mnct sf Drrxm no4oet  ieilt m2rlnvs;(4 eeoir iydlaDrli i s)s2xoim oydamtnmnetas s2rmu pno0aptoiociaslaDeanvp;(0trtoxf oatlpDrai sls setr(opiy4op n ivt s aDtm(mpoo0ape mfctydfaDrlumonu0 rxnio oy1faDelneo;s)srtrxm3oo1lmee fetlt)a2trxmp;t0teeomoeiydfaDuan o () leoiocoa1faDe n sls0s2uo(o ou1apee fvtltf Dtr( p;u1olenii3iydfa2emuvo;(0tltoxo oa1la eaieo;t0 exrxo3ou1lleemnciatfaDrr(mpou4aexo oetas mDua(mp;u4 reoxoctatlatrli ils) rur(m nu1lp emfcs ()artr(ront0tlx moctasfm2rmnmpnt0 rxrmfcoy1om raneols  2to(rpoy1op  mict (fsDtaxmo;u0tet ioeiytfmDrmuvo u0trxoifcoadoptr u o s sexmxmpno1ap n nvsls srumum ou4alxnmo3iytfm2eln s () eenmr oodfat  i o;s trxmir3iy1openmnesas sDrrxmo;o4apeoifetydfaDulumo u4areomr3totfm r ueol(0 rtmxopnu4alte fvtls s2rmur ;o4oleo oeiyd a emumo u4tltomr3iy1lpte i s ( trtmim3oy1apeemfviasfa2ua(ro;u1tlxo octasfa2eluvpn(4 eenxociydlmtr uei t0s2xrio oydalt lncta() Drr( ont4tle ioetytfm umuvs u0 eenxr3tadfaDelu s;s0teurimpoydop   fcta(f 2tr(mpot4opeomf3tltfmDrl(vpnu0 leoxf tadom eli o;s0s2um(r3iudlmeemiciatfa2rru  ou0tpeomictas s umnmsnu0aexoxr3oodomtrauvo s)s2umxmpny4om n nci ()srrax o;t4oetoifetatfa2ul( p;u4arxoxrcoo1lp r u s s)t2uoxm3iy4lpe  fvt (faDtm(r oo0opto ociyt sDra(vonu0alermo3ty1oa rlnvs s0s2to(mpno4omen ivils)a2ta(  no0aex miciysfaDel(mpnu)alenir tytlaD  uvo (0t2xrxo iy4ame lncsa()srtaxmo;t4olx  feiatlaDra(vp;t4 lenir3ty1fatrlneo (0sexrxmpnodop  lfeslt) 2uax  ;t0teenmicildfmDumumo;t)trerirciodoaDr ivo t)texrxr3nydll  lieiatf 2rrxr oo1tle  ociatfa umu o;u0 ltrifcta1fp elivslt)srtrim3io4olen fctls sDumxr nu4teto i3ilt s ul( p (4aexrir3todfmDeln slt t2uo(m iy4apenlieslsfaDta( p;o4tpt mo3tys m ua( s;t4texomrcoytomD lu s s t2um(r3nu4amen ictlt)s2uaxmo;o4tleo fetas aDel( pnt0arxoif3oodomt aiei;s0setr(rpoo4lmtelietls)arrmu  nu1aleo oeiydlsDrl(vo;(4tlxrio3totlaDrau s t0 2urim3iudaptnmfci tf rrr(r ;t1tle iociad s2rm(vp;u) rerircto1faDr n olt0s2toiopiodopenlivtls aDrrxr oo0texn ictltfa rl(vs t)trxoxrcoytfmt  ivi t trxmxm3iu4ole lnct (  ruaxmpot1texn o3tlt m2uanvo;t0alxnircto1lp r nei t) etrxrpoy1om   fet s arumuronu1tlenii3ild s um(mp;t0alenifctydfa raivo;( s2xrim3oy1amtnmfciasfs2tru  no0altnmociyt aDuau on()arenxocootlaDranes ()teto(m oo4ame lieias)aDrmx oou0tet ifctldlaDemu o;u0trxnmo3ootoate ies t)t2umim oo4optelnci t)s2um( oou4tlx  feias mDrl(mo;u4alxnmo3iytoaDrau olt  exo(o no4amte ivtls a2urxrpnu4tpt mociyd sDranvp ()altoir3iytopt aivo t teto(r3iydalee ics t a2tr(m nu0apt io3tat s rlu onu) rxoxfcoy1op  ai sls)trum(o io4ale mictls)aDurxr ;u1oex  fciyslmDem(vo (0 ltrif oy1lmt ai i t0s2xr(m3iu4lpen nvilt s2urxrpoo4open ietltlm uluvs;u0arxniocta1faDe ueil( t2tmim3o
\ No newline at end of file
@@ -0,0 +1 @@
+nvo ( s2ur(m3nudal nmnvi tfa2tau  no1apt moetadla rm( s (4trxoxf iadlmte u sl( trumxmpiudomen nesl(f Dua(  no4teeniietadfaDel(vsn(0tlxnmo3ty1la  ln s s t2tr(r3oudlltemncilt)a2umxro;o0olxn fctldfaDuan o (0teerxrcio1opDr n s () etmio nudop nmfctlt sDua(  no1tle  oeiydlmDrlu p;u4aetrxr iydfmDeaivilt0 etr(rpoydlpenmfct t srtm(m ou1tetn ietlsfs2el(ms t0alenir ty1oa eaneo;t)s2tmio3no4lpt lietls s2ua(roou0oetoioctadls2umnvs;t4trxrmocoodfpDeau il(  2to(rpny1lm emictls artau oot0tlxomoeiydla2el(mpnt)altrmo3iodlmD  i ol(0texoxm ny1lpe  icsat s2ta(monu4olto ieiytla ua( s t4 lxoxo3oo1laD auvs ( s2urxr nydapeelfcsatfs2tm(mpnu1tetn oetasfs2rmuvp ()trxrmfcia1op eai s s t2umir iy4ape miesa() 2um(m ;u1olen octytfs2rau p (4arermociytfp eaieo;t  etoxm3oo1op emnesatf Dtm(moou0alxoii3tlslaDem(vpnu0arerxr3oytopt an o;s0sexmxm3no4ll elncs tf 2tmuroou0texo oetytfaDua(vo u) lerxo3to1lptrlivil( s2toiopou4alte ivilsf 2umx pou0tetnmoctadlmDumuvp;t)altomrcia1om  au sls0 2xmio3ou1lle livs sf 2ta(  ot0tpe ifetasls2uan onu)altoxocoytlpDelneo;t0 rumio3iu4omt  ict s  Dua( pno0oetnmoctydfs el( p u) eenxr3tytfatrli o;(0srxrir3oy4opeelnvi s aDrrur nu0tpeniieilsla ua(vs;t4aleoxr ta1lmDe nvolt0srtmxm3iy1ap elfvias) Dua(  oo1oet if3iyt s2uanvsn(0 eenmfctytlp e ies t  rurimpnu1lpe lnct tfarra(r no1oexo fcild s2rauvp (4 lxoxoctotom eli i;t trtr(o3iydamt lfesas artm(mo;t0opxnmfetydfs ua(msnu4 etoif3tatlpDranvo t0trurimpiydaleemivsls)aDtrxmpnt1openiieiydfmDran s;()arerxfciodlaD anes s) exrim3iy4ale mfvias)srra(m ;o4olx  feildls uluvp;()altoif3iadoa  auvo;s t2uoir no1lmt lfesas) 2tm(m ;t1aex iieias s uau snu4aexoxr tadoptr ies;t0srtmxr3iydlptelivtls)a2uru  ;o0oetn f3tysfs rm(von(0 etoio ty1lp  lieo;s) 2xoxm3ou4apt mfetl( srrr(ronu4tpt mfctytfa2rmumpn() exnio iodomDr nei;(0 etoxr no4op   ieta(faDtmu pno1alto fctytfs rlnvs t4 eerio3iatoatran i;s seuoim3ny4op nlies sf Durxrp;o1oet mo3iasls rl( ont0 eerxr tytfateai o;t srxrxrpoy4olte ieiasf rrrur ;u4apx  fetldls2umu p;(0 rtnif3oodlmDrauvols0sexm(opnodolte fet t  2ua( poo4tltn ieiatfm rmnmpnt0tetrmociotfa rlu ols s2xm(o3io1ap nlncs t) 2taurpnu1oetnif3tldla2ran ont)trtoxo3oytfat an o t0 euo(r ou4altn ncsat s2ua(r oo1aee  ictatls em(ms u4arenxociatomD aies t) etr(mpnydomtemfci ( a2trum ;o1apt  i3iysfsDuluvp () eeoxf oa1fa r i i;t)texmxo3nudam elictltf rrmurooo1olt mocilslm emuvp;t) renxocoodlm rauvo s srto(o iu1lptnlivta(fsDtrxro;u0tleniieilsfm2em( o;(0aexomo tadlatr uvsls)sexmio ou4olen fcias)s2urumpno1aeen o3iltfa rmnmsnt4trxrxociotop e neilt t2tr(o no4lm  mfvils arrax o;t0alx  feiytfs2rm(mo t4texomo tadlaDr ivi;(0texmxm oydlmenlfcslsfs2raxm no1texnmieils sDrluvp;(0 rxrmr tydlm   ues;(0tetoxo io1ope lieslt)s2rau p;o1ale ioctatlmDranvsnu4tlenxo3iadlmD  n s s0texrir ou1lmee icilt)srrrxr no0aee ifeild a umu s;t0 rermr totoate i sls0s2urir iu4ap  lfci sfsDtru oou4teeomi3tatls ulnmo;(4tltomrciotfm  au ols0 eum(o io4oltnmncslt)sDtru  ;t1apeniieiaslmDelu snu)aeenxfciadomD  uesl() 2xm(r ny1amtnmnvsa() 2urur ;u0alxn ieiysfsDemn o (0 lenmrciytom   neol(  2xmxopoydope  ncil()aDrr(  no4ape  ietlsla eaump;(4tlxoxf ty1fpDeaieo (0 exrxmpoo4ope miciat srtrumoou1tpx ioeiydla2rmn s u) eerir3ootomD au ilt s2urimpoo1olt  ivtl(fsDum(  no1apen fctldla2ua(vpnt4teermr3iotomtrlivo;(0setriopiy4omen fctl(f 2ra(ront1oetoio3iydfaDrm( snu)alxrif3iadfp  ln i s  rurxmpiudomtn ictat  rrr(m ou1ape ii3ildlm emnmo;t4alenmr3totlmtelieo;s  rtmxm iy1ap   fvtat a2rrurpoo1aleo ieild mDrm(vo;u)arermrcoo1lmD ln i t0 etr(m3iu4op   ict tf rrmumpnt4tlt mi3iadfs rmn s;u)tltrmfctodfptrln s s) ruo(m oydalt mietas)srtrxrono0oeenmi3ilsfs2uluvo u)teeomo ty1fp  aiei;() 2xm(m3oy4amt mneil()aruaxm ot0ope  icildla2rlnmp;t0aetrxr3tadom   u sl( srum(r iydll  lneslt sDtmumpoo1tptomietasfsDumump;u4teenxr3to1fpDelnvil(0t2xo(rpio4op   fei ( s2urxmp;t1oeeoiocias sDumn p u0aexomf tadfm rlueols0t2xr(m oodap nlieil(fs2urxr oo4apx ifetls m el(mo;(4altnio tadopte ieols  rtr(m io4ll emieiat)aDtm(  ot0oexnmictyslmDrl(vonu0alxomo3iatfpDelueols) rtmxr3io1lmen ictls arua(m oo0texnioctydla ulumpnu0alenir ty1fmte u i;(0seumio nu1lptn ieslsfarumx onu1tlt iicias mDum(mpnu0 etoio ia1fmt aivs;s srtmxmpnydll   feslt)sDrmx pno1olt mo3tlt mDeln o t0 lxoio oodoatelieslt)tetr(r oo4alee fciltf Dtmxmoot0olen ictydfa2ulu p t0arermr tadlp e uvo;t)sruoxmpio4ap elnesat) rraxmo;o0tpx  fciytfm2emn o t)alenxocoatomtelu olt)seurimpnudlltnlfcils  2tru  ;u0tlxnmo3iad s ea(vo;t0aeerir3iodfaD au sl(0t2xm(r no4amtn nvslt) 2rrxm nt0texoiictytfa uauvo t4alenmo io1omDrau ols0s2xoimpio1omeemnes () Dtrx oou1tlx ii3tlt sDumnvp;t4tltrifciytfatraivo (0s2uoxr nodam  livias)s2urum ;t1opto o3iys mDeluvsnu)texomfcty1op elueol( trtr(r nu4lp nmncsatfaDuaumo;t0ape  f3iyd sDrlnvp;()artomrciadoaDr ueil()s2tr(rpiu4oltnlnvta() rtr(mpnu0tex mi3iydfsDuanvo t)aetrmr todfmDelivi s0 etoir iy1op   fvi () Draumpnu1olx mietadla rau ont)alxnif iydlaDranvs s s2tr(o3ny4omen icsls srumum nu4olxniieiydlsDrl(vp;t0arxrxociatfmtelnvol() rxr(mpoo1omeelfeiat a2ta(r nu4tetnmf3tytls em(vp t0treoxo oa1oaDrliei t  2xoir3nu4ol n neta(f Dua(mp;o1alenioetadlmDemnmsnu0arenxf tydfmDeaiei (0 2xrirpno4apenmicias) rtaxr oo4oet  iciasla elump (4 exoir3totfm r u i t t2toxopiu4opee netlsfsDuaumpnt0oexnii3tad s eauvp;() lxrmf iytfmte uvs;t0setm(mpoodal emivia()a2trurpou0tltnmo3iysla ul(ms (0 ltomfcto1fmDeaieol() rxrim3iodlm nmfvsl(  2uaxm ;t4opx mfctydlaDea(mo;(0texnif3tydlaDe nvslt)teuoir nu4op  lietlt) 2umxm nt1texoif3tydlmDeauvpnu0arxnxf iydfa eaieo;()t2tmirpiu1lp n fctasfarrm(rooo0texoif3iyd m2rmnvsnu0artrxr oadopDe u s;t  eurim nu1lpt  ictls) Dta(r ;t1ale mo3tas s2rmnms t4tlxrmf3iodlpDe i ols0t2toxm3no4ap   ici (fsrrmx  ot4aleniieiltla emuvo;t4alerircto1fp   ies s) exoir iu1lpeemfctlt)a2trxronu4tpe  o3iytfs rln s;(4 etrio3iotoaDrai i;t0s2toirpiodllt mfviat)artaumono1ape  i3iytlaDrluvsn(0tetrmfcoytomD  nes;s) 2ur(o ou1op  mfct (fs2ra(mpno0aetomfciatlm rl( o;t4 eerxr ty1faDe ivilt) rtoxm3iy1lpt lfcs ( sDrmxmpot4tetniiciyslm2em(vsn(4trermr3ootfate nvslt)tetrirpiudamtn iet t aDrrurpot0tlen ieiytlm2eanms (4teenxf3iytfp e nes (  2uoxmpiudlp  livsas)sDta(rpnu4tet iiciydfmDelu p u4tlxrif todlpD  nvi s0seumxopny1ll elnviat)arrax ono0teen fciyd aDrauvp;u0 lxrmrcoadom eaieils) 2xr(o3iodomte fcilt aDta( pou4tpenmieils s2ra(mon()aetomo3iytlate nvs;s0t2ur(o oy1lpee fetlt)arra(mpnu4apt io3iytfaDumnvsnt4 lermf3ootfmDrluvs;()truo(m iu4am nlnct sfartrxronu0tltomf3iyd a emu p;t4tlenmoctatlaDrlivi;t t2tr(mpoo1lp nmiesa() 2rau  ;o4apto oetyt a2ulnvo;(4arerifctatfate n ol() exm(m3oudam nlfci s srumxmpnu4texnmf3ils s rm(vp (0altomrctatoaD livilt) rurxo iydop e nvt t)s2tr(  ;u1opxomictaslm2emumpnu0arxoxo iotlpDrluvi ( seumxopoydllee ieias)sDumxroot0oeeomoetydfmDel( p;(4 leoir iatfmt  ueo t0seuo(rpnodoltelicslt) rrmxmpno1tpx  ociltfs ranmp t)aetoxo ia1lm  auvi ()seur(o oudap elici t arrm(m ou4tee  i3tlslm2uau p;t4 etnircta1fptelivi t)t2uriopno1om   feil(f rra(ront4oleo f3iadlaDrm( pnu) lxnxo3iodopDelnvs;t0 rxmxmpoo4al   ivta(fs2tr( o;u1oet ifeiasfm2ran s u4tltoxf oodoa  lu o t0 2xmxmpnu1olenliei (  rraxrp;o0ope mfctytla rluvo u4tltrio tadom  ln s t trumir3no4optnlnesl(  Durxroot1opt mo3ilslmDrl(vs;(0arxoio3oadfaDrln olt0s2xrir3iydomte icsa( sDtru pot4aee if3iadls rluvonu)altoio3io1omt  ueols) 2trim iu4olenlfeils)aDuax ont1tltomfeiydls2emuvonu4tetomrcoadom eaieo t0teto(o oo4ap nmfvs ()s2uax ono4opxo fciadlmDuluvp;t4 renxr3ia1late n o;s0s2to(o3io4lme  icilt)srrmu  ou1ape mo3iatlaDum(vs;()arenmfctodfpt anei t0teurio oo4openliesl(  2uaxmont4apxo f3tatfa2eaumo u4tltomo todlaD anvils0srxmxopno1alen ieia() Drau  oo4oeen o3iydfm2em( p (0 lxnxf3ia1lpDelivols trtrir3oy4lm e nvi (f 2tr(mpou4tlenifcildfa ra( o u)trenxf tydfpt luvo s) exoirpny1omee fcias) rtaur ot0alt mociysfmDrau sn(0aetrxr to1fmt auvs ( texmimpiy1ll  lneils)a2rax p;t0ope iieildfmDul( p;()altnxf3iadoaD an i;s0t2toxr oydlmee fct s  2trx  ;o0olxn ieiytfm umu pnt0 etnmr iytoa  anvs (0 ruoxo3ny1al n fviat) rrmxm ot1oet moctysfaDum( o u4 exomocoa1fate nvsls0srxo(r3nodlme  ivtasfsDuau  nu0oexo o3ias s rm(msn(0 rerxo oydfmDeaieo;t0t2xr(rpnu1lmtelnes s)arrru  ;o4aptnmi3tlsfa rmuvs;(0aeenif3tatomteai olt)s2toxo oodlleemnvia(fsrrmx  nu0teeoifciysfs rmnmo;()tltnio ty1fa rai o;( trtmxrpnodlpenlneiatf rrmur nt1tpxomoeiadfm um(vp (0tltrio tadoptraneo;s setoir3iudop e fei ( srum(rp;t4aetnmociyt sDuanmp;u0trtomo3to1fmt  i s;() eto(rpnydlmenmncs (farum(r nt0alxn fetatla uanmo;t4teeoir ootoa r neslt s2um(o3oodop nmfcta( aDtmu  nt1olx mfcildfa emumo u4 reoxo3ootopt  u o;t s2xmxr3iydop nlnei s arua( pot1tetoifetydfs2ua(vp t)aeerifciydfa rauei s  rxo(r iydome  fvi ()sruaumpnu0aptomf3ilslsDulu s;u) exrmrcootlaDelivo;t0t2to(m ny1openmict (  2tr(r ;t1alto fetlsfa2rmnvo u)teenir iy1op  luvil(0 etrxmpoo1amte netl( artr(m oo0oeeoifetlsfa um(vo (0 rtnio to1latr ivi;t)tetmirpnudap nlfvs (fs2tm(ro;t1opeomf3iysfm rauvsnt)aexnmf3to1oa elnei s0trtmirpnu4al   ieil( aDtaum ou4aexomf3tlsfsDeaump u0tltnircio1oa ean s t)t2to(r3iudol nlictlsfs2urumpou1tlx ifciydlmDua(mon(4 rerif iatoaD ln ils0t2umio3iu4am  liet () 2um( p;u1tpto ieiat mDelumpnt4 lenir oa1fmtrlieols) ruo(o nu4ap n fvi (f rua(rpot4opxn fciadlsDeau snu)aexriocoo1oateli ils)s2xmxr oodom nmfctatfa2tm(mpno4alxn fctldfmDulumpn(0tetoircio1lp  aivo t)trxm(rpny1am   ieilsf Dta(mo;t0olt  feildfa ran on(4trtomf3tatfa  ai i (0trxmxr nu1omtelieil()sruaxrpno1opxo i3iadfsDuln snt0tltnxfcoa1opD luvi t teuo(o ny1lpt miciat)srra(  ;o4tlto f3tas sDrl(vs ()alxoio tadlm rlu o;s sexo(r iodap   nei ( s2rm(rpou4apeoioeildls ulnms;u) exoirciotfmt ai o s) rurimpnu1lmeemneta(faruaur ;t4tetnmictysfm el(mo t0 renxf3iotopDraiei;t  etrxr3oy1ale mfct tfs2tr(mpou1olx iietysla ea( s ()altrifciotopteaneslt)t2umim iydlm nlnesltf Dtaxroot4oeenioctlsfmDel( snt) etrxo3iytoa rluvils)srtm(r oo1am elncsasfarraumpou1tee mieiadlsDeln pnt) leomf3iadoa eli i;(0t2uoim nu1lpeemfvia() Drm( pnt1alx ifeiasla um(mo u4altomo oodlmDrai i;s  2toir nydoltnlfciat) Dtrx p;t1alto o3ilt m2ea( onu) rerxr ootoaD  uvo;s trxmim oo4apte ivsas srtmxmpot4tleoifeilslsDrl( s u4 eeomrcoodlat aivsl(0srum(o oudom nmnci s  rta(r nt0apxn i3iytls2uan s u4trxomr tadla  lieolt texmio3ny1lme  fvsl(  Dtax pou0texnii3tas aDul(vo u0aeerxr3iydlptrau s;t0 2tr(mpnu4lm nmicsas arumx o;o4aexoiictlslsDuau p u4 rerir tydlp ean i t0 2xm(r nu1apeemies s a2taumooo4olxomfeiytls umuvp t0alerxrciodfmDr ues s sexrimpio4olt mivil(fa2ta(rpno1oetn ictlslaDranvp;t)tlxrif3ta1lmtrai o;(0s2xoio nu1amtelfctat)sruax  ;u0opxoiicilslmDel(vpnt)artrxf3oadom eaieo t0teurirpiu1olt mfvtls  Dtr(roou1apxo feilt m rln pnt0aleoxf iodoate nvi;t)t2xoxm3io4om nlfvsat a2tmx pou4aptniociadfmDum( snt4arenxf3todfptrlnvi t)t2urxm nodomenlietltfsrumx  ;o0alxo f3iys m2umu s u) rxnxf3iydlmtrlnvs s  2toxrpnu1ll n nvsl(fa2rr(mont4olx mf3ilslmDem( s;(0altnmrctadfmtelu s (0t2uoim oodlptelietl(f 2umuro;u1aexnioetltfaDum( o u0tetnxf3io1lp eln i;t0tetrim3oo1omenmnes tfsDurxmp;u0tpeo feilsla umn pnu)trtrxf todopte neil( srumir3nudlp  lfeiatfsrrrx p;t4tleo ictys s eaumo;()aleomo oytlp elnei t t2tr(o oy4lm   feia() rrmxrpnt4tlxoii3tasla2rmn onu0 rtomf oytop ranesl(0 ruoxm iudlpenlfet tf rra( pou0aexo oeild m rlumpnu4teeoif3tydlm eaivs;s  rumxm3ou4ll   ivtas  rtm(moot4apeoioetyd a rl( o;u4aetoxrcoa1opt  u o;s  eto(o3ou1ll  liesl() Dra(r nt4oeeoifcilsfs2umuvo;(4trerif3oytlmte nei;(0seumirpoy4ol nmici t arur(m oo0aexn oeiydfs2rmumsnu) leomf3tytfaD  nvs;()trtrimpnudlpt mnvtatfsDraxrp;o0oeeniociad mDrmumpn(0aexoio3iytoaD anvols)s2tr(opno1op   feilt a2urumoou0aptomoctydlm rm(vp;(0 etoio ia1om r ivolt t2xrxo3ou1optemici tfsDurxrp;o4optoiociyd a rmu p;u0tlxrmf3oatfaDr nvsl()t2xmxrpiu4lmeemfvilsf 2uauront4olx miciadfs2rln p (0tltoxf3tydlpt  ivo (0 exmir3oy1aleelncsl()a2ur(mp;o1optnmfctyslmDuan s u4arxriocoytfpD an o s) 2umxm no1open fct (f Dum(  oo1aeeo octasfmDeauvs t) ltnio oy1laD lies;s0 rto(rpiu4ame liesa( a2raur ;u4openmictldlm2uln pnu) exrxo3oodfmteln ol()t2xmio3oo4am elieia( srrmxmoot0ole mi3tad sDrl(vpn(0 exrmocto1lmtrlneo s t2toirpno1al nmnvil(f rraxro;o0tlxnmociatfs rmnmo t4aeermrcoatfa eluvo;s)trurxr iu1optnlnctat srtm(ro;t1tlt  ietlsfa ranvont) etoir3oatlmDeluvi t  eumiopnu1lpeemfetl(f Dtr(  no4tlxomo3iyt a2raumpnt4teermfctydla elueo s  ruoir3iy4om  mfci ()sDrmxrpoo4aeeo ociadlmDrmuvsnu4artomf oy1opte uvils setm(r iudlmtnmnvi sf rumx  no0apto octld s elu p (4teerif iydlaDrlu s t teuoxo3iy4lpeelfei s s2rrur ;t0oetomf3iytfm uau s;(0artnir to1lm   i ols)s2uoio ny1lmt mivilsf rurxmono1oexomieiad s2rau o (0aeerxrciotfaD  uesls s2ur(rpoudlm n ict t arrru ont1tpeo fctasfa2rm( s t0arenifciydfpDelivo;()teuoir3nu4apenlfvi sf Drr(  no0tpxnmo3tlt a2rmu sn() renio oatomtrlnes t0setoxrpno4om   fvta()arta(r oo1olxn i3tysfa ul(ms;u4aleomfcio1omt lnvs;( s2trxmpiudlmt micia(farur(mpot0tpx mi3iltla2ra(vs;u)teeomr3ty1lpte ueols t2tr(rpiy1lmenmieia(  2umx ono1oex if3tydla rauvo;()arxnmr oo1fat  nvi;s0 2xoir3iodapt  fctatfsDraum ot4aetnmieildfa umn o t4 lxriocto1lmteaueo;s0s2triopnodopenmivs t arrru  nt0openiictasla emumsnu0tlxoifciatoaDrlivs;()teumimpou4olenmnvs t) rtau ono0aeeoii3iys s2emu o u4aexnmr3iy1laDeau o;t sexrio3iy1om elnvs t)arrrxmpnt4texo f3iydls emuvsnu0 rxrmo iodlm   ues;s  2xrimpiy1aptelies s sDua(mp;o4opt io3tltfa2um( s;u4tetnmo3iatoate uvsl()trtmxopno4om  mfcsl( arumu pno1oexoifetldfs umnvo () eenxo iatfpDelueo (0truo(opnu1ole  icta() 2trxronu4oeeomietyd s elu o (4 lxrmr ootomtr u s s)srurim3iu4ll  mict s)aDra(mont1opeoioeiytfmDuanms (4aeenmfctadlmD auvil( s2xoxo oo1lptnlnviat)artmxmp;o1opxo f3iadfs elnmsnu)trtomo3ta1fm elnvo;()trxo(mpoo4lltnmivi ( a2umu  ou0olx  i3tltfs2ea(vp t0tltoxrcto1om elueo;( trtm(m3nodop  livs s)artauro;u1apx  fciytls emnvo;u4trenxr ty1lpte u i;( tetmio nydomtemnvtltfaDuaurpou0tltniociadls2rln o u0 rtnmr tydfm eauvi;t trtmxopou1ll emnvil( arrr(  ;t4altoifciadlmDea( o;t) ltoif iatopD auvolt  rxrir nydam  lneslt) 2umx pnu1tlt  fciatfmDea(mp t0aeeomf tadlpteaueslt setrim io1lpte feias) rrmxmp;o1ope ifciyslm ean s;t4aleoif3iydomtranvo s) 2xoxm3io4alenlfvi ()aDumumooo1tpxomoeildlsDra( o;t) exnxr iytlpt  ivi t  rur(mpoodlp  lfvs ( arta(rpou0tlx mo3ilsfsDel( s;t4 rtomfciadlaD  iei t0t2trio oudap nmfctlt)artmxr ot0oexnmf3ild a2raums;t4treomrcoytop e ues t) 2xr(r oo4oltemfesat s2rrxr oo0opt mfctlsfm ranvpnu0tlxoifcootla eaivo (  2xmxo nu4lmenmietltfs2taxro;o4tpxnmoetlsfs emumsn()areoxr3oa1opteai i;( s2xmio3oo1al nlfeslt) Dum(rpnt0oltomoctydfm2ul( s;(0trtoxo to1la eanvs;t  rxr(mpnydalee nvia()aDuaxm ;o4apxomi3iyt aDua(vo;(0areomo3to1latraivils t2xoxo3iudomee ieil( srtrumo;u4aeen f3iytfm emnvs;t0aetnmfciydfa raies ()sexmxr3iydll e ict tfartm( pno0apeo o3tldfa emuvp () etoif iodlpDrlnvols0s2toimpoo1opt mivtas aDrmump;u0alenmi3ias aDul(ms;(0 lenmr3iydfp rlnvi;s0 rxoio3iodol nliei (  Draxmont1tlx ioetydfmDranmo;() rtrmrcia1lpteluei;s)s2xmxo no4ol n fci sfsrrrxmp;u0apto fciad s2umump u0trtnxf3todfm r nvo s0srtoir3io4ole lnvta( s2umuro;t4tlt io3iysfsDrl( o t)teeoxo3todfateaueil()seurxo3nodllenmivia()sDtmump;u1tpxoio3iat sDuaums;t0aexnif oydfa  anvo;s  rto(m3oo1ap  lfesa()sDrr(m ot0tle  icildlaDemnvo (4 rtomr iytom   nes;t0teurio3nodapenlneta( s2umu  ou4tlx mieiasfs ea( o (0texomociadom  luvo;()sexrir3ny4lp elivilt)s2tmxmoot1oex  ociasfa emnvp (4 leoxf oodfmDelu s s0teumiopnydlmee fcsa(f 2uaurpno0tlt iociytla em(vsn() lerir oodlpDeauvs;t s2xm(r3ny4lmtnmnctas)a2rm(mpnu4tlx iicilsfa2um(vs;()texomr todlaDrln sls)trurxrpny4ll nmncias) 2tmu oot4tleo o3iydlsDra(monu4arxoxf oodoaDrli s t)texoio3nodaltn ncsl(  Drruro;t1oet iieiysfaDrln ont4tlerir iytfptr n i s  etoir3nydlp e ivtl() 2uau  nu1texoioeiytlmDra(msnu4tltrmo oa1lmt livi s0 2uo(m oo1am nmietat) Dra(rpou4oet iociysla2ea(ms (4trtomf3to1lm rln s ( sexr(opoudopte ics t  ruaum oo0tleomieilsls2em(vp u4 eerif ootfm eln s (0srtoxopio1lp nlivt tfaDtr(mpou4tltnmoeiys s2ea(mp;t4 renxr3ia1la eai o;t)trumir3iu1lpe  feia( s2taur ot4oeenii3tytfs2rmnmont0artnmr ty1lm eluvo;s0trxoxrpno4llte nvta(  Dtr( pot0tetoiiciasla ulu o t) rtrmr3iydfpDrlueils0 2to(opiudllte fes tf 2um(m nu4ope iieils m2ua( on(4 etoio3totoat  iei s  etrxrpiodlm  lnei t sDtmxroot4oeeoiiciytlm rauvp t4tlxrmfciatopt  nvi;s  rtmim oo4oltemivsltfaDurxmp;u4aeto ieiyt a rlu s t0 etrxr3todlm r uvil(  rxrio iy4om e fcia()aDtr(rp;t1teeomfeiys a2emnvp;u0arenxo3iatoatrauei;(  eurio3nodlptelnei sfs2ra(m no0tlt  iciad a2rau p;(0tlxoif3oadopD  u o (0srumxmpou4apenlnci (fsrumxrpnu1aeto f3ilsls umuvonu)aexomocoytopt aieolt)srtm(mpiy1ol nmfvils) Dumum ;o4apeomfciytfs rlnms (0 rxnxocoydfpDelnvo s trtrir3iydll e ici s)aDururpou4tle mfciydls eaump;t)tltrmf oytla rai s;()trxoir3oodapeelici () Drr(mp;o1aeenmfciatfsDul(mp u4tetoircoodla rau il() euo(opnu1oltnlietas  Drmur nu0olxo i3iytfsDraumpnu0trerxo3iy1lpD  i ols) 2urio iodll nmfvslt)arraum nu0tpxo ietadfs2emu pnu0alenxr3oa1fpt lnvo;s) eur(mpoudop nlivta(fa2taum nt4teto ocilslmDraump;t0 leoiociytfaDrln ilt) 2xmxo iy1lmt mict tfa2rmumpnu1oleniicilsfa2uauvpnt4texnxo3tydom rlu i s) eumxopoudlmt lfvsltfsDtmxro;t4tptoioeiadlsDeaump;()tetnmr ia1fmt  nes;( setr(r3iodapeemfvia(  rtrurpnt1aex ioeiasla ul(vs t4treomr oadoateaiei;s s2xm(m3iu1lp nmfei ()arrmumo;t0tpx moetydls2rm(ms (4 ltomf3oadlptrlu il( t2xo(opio1lp nlivsls  Dua( pot1teenifciysfaDrmuvs u4 reomr3iodfmDeln ols0 rtmxr3oudamtnmies tfaDtrxm nu0tet  ociltla eanvpn() etrmf3iydlatranvo;t texoxo oydoltelnetatfs2uax  ;u4opt mfcild m ulumo u) rxoifciatlmtr u i;() 2ur(o iudole lncsat sDtax p;o0aexoiocildfaDelumpnt)arxoxfcoydomDe n olt  etr(m3oo1ll n fvsas)a2raur ;o0olto o3tlsls rlnvsnu4 lxnmf3to1fm r nvi s)trxmio oydllt mfciat)arum(ront0oexoiiciytls2uan pnt4alenmr totfmte ivi;s)t2xmir iodap n net t)a2ra( poo4oexo oeilt a rl( on()arxnxocootomD livo;t) exo(r oodale lfeta()srurx ooo0opxomoeiysfsDrm(mp;u)altnmr iatoatrluvs;s)trtriopou1openmfcs (fa2rauro;t0olx ii3ils m emumo () ltnir3oydopt aneo;s0texmxo io4altemici ( s2urxrooo1apenif3iasfm2em(mp;u4tlxrifcio1fm r ivs;(  2urxmpou1al  mfeta( aDra(r ou0tetoifcias aDelump;u0 ltomr oytom r neols) 2to(m3oo1ol e nvilsf Dtm(r ;o0oet ioeiltfm el(vont)trtnir iatomDe i o t)s2urio3ou4ap  lictlsf 2tr(m ;u0apx  i3tytfsDeanvpn(0tetomo3iodoaDe u sls) 2xoiopou1ale mfei s aruaurpou4olxomfeilt a2eaums;(0 rxoxr tatlaDe u slt) 2ur(o3iudlleelfesas)s2ururont1tpxoii3iltla um(vp;t4 rtnmocty1fptraneo;(0teto(m3nu4op eliet s a2ur(m ;t0tpxniieiat s ra( o u4texomocto1la e i s s)srxm(rpiy1lmee fvs t)a2ra(mo;o4aet mictyt a rmums;u4 rtrmf3oo1fpteluei;t0 2umio iodlptelnvtasfa2uau ono0aptnmoetatlm um(vs u)tetnxf3oa1fm eanvslt trxoxrpnudlpeemnvil(  rrmx pno1opxoiiciad aDrlnvp;t)trenif oadfaDrauvi;t)sexriopiu1aleelietatfsDta( p;o4aptnifetad s ua(vsnu)teeomrcoadomt livi;t0 exmir3io1ll elfct (fsDtrx  ;o1tlt  i3tytfa ea( p;t0aeenio3to1fmD  u o ( sexrxo3ou4oleelnesasfsrtruronu1aeeoio3iytls2um(vpnu4 lxoxf oy1laDelu ilt0srtrio3iydll emiet sfa2tau pnu0altn o3tysfa2rl(vonu4 rxnxr iodlmDeau s;s  exrim3iu4om nmncsa( sDumu oou0oleo ociytfmDemu snu0 lxriocoydfateanvo;()trurim3iodalee iesat)a2rmurpnu0tlen octlsfmDrl(vp (0teenifcoatoaDe uvo s)t2tmio ny1ll  mnctl()aDtrx o;u4texnifeiad m2uanmp;(0aeerio3tatlp e u s ()texr(r oy1amtelneia() Dtru pnt0alx miciadlm2el(vsn()aeerxf oytfptelieilt)seurir3iu4al e fetlsf 2rauro;u1tpxoii3iat m emu o u0tetnmr oa1fa   nei (0 rxrxr3no4ope lneia(faDumxm nu1altn i3iyd aDulnvp;u4teenir3oo1lp r uvo;s0t2xr(r3oy4ope  ictat  2ur(mpot0tlxomf3tysfs ulnmp () rtnxf todlmtr uvo;(  rto(opio4lpee ivs sfa2tr(m nu4teeo iciys aDrl(mpnu0tetnxr3todfmDr iei (0 etoxopnu1open netls) 2rr(rpnu4tptomi3iytfsDul( p;u)trxnirctodfaD li s s0setrxm nu4ameemivi tf ruaxronu0oleoiieiadfa2rl(vs;u)aeerxf iydlptrli olt0t2xoir3io1aleelncsls) 2umumoou0oltomoctltlm eauvsn(4arerircio1omDrli ol()seumxr iu1opt lfvils)a2ra( ooo4tlxn feilt aDrlu s () rtrxocoo1oateai o ( t2uoir nu1ape lietls a2tr(r ou1tlx mi3iatfs2emn o u0 etoxf3tydfp rluvolt0t2tmxo iodolt mietlt aDur(monu0apxomo3ils s2ua(mon() etoxr iotop rlnvi;s)srxmxo oydlpen fvsas) rtau pnt1openii3iatlm2rm( on(0arenmo oydfpDr ueilt0t2xm(rpnu4openmnvilt aDuaum ot1oeeomiciydfs2rluvo u4aetoxr3io1fpDelu ilt0 exriopio1lpenmfes s)s2tm(mont0teen ociltfa2ranmo ()teenif3iy1oaDrlueil(  exoir nudom   neilsf rtax oou4olxoio3tyt a rlnmsn(0 etnir tadfa eaneo;s)texrxm3oydlle lfvtlt)s2tax pot4apx iociysfs umnvp u) rxrxf3totlptrln ols s2xo(m3iu1llee nvsa()aDtm(ro;u1aptnmf3ildls rmn p;u4 eeoir ty1fa eaies;()tetmir iy1lm nmnes t) 2tm(mo;t1alenmoeiasfm2elnmsnt) ltriocoy1laDe nes s  rxmirpoydlpt  fesl(  Dumxmoot1tpxomociyt a umn snt4tetoxoctodomt aueo;() eumirpoy1lm emicsat  2ta(rpnu1aeeomfcils s rmn p;t0 lxomo oytlpt lnes;t  rurxmpoy4op   nvi t) rtmx p;t1oetoifcilt a2um( o () lxomocio1omt lu s t0 rxr(rpoo4olenlfeil(  Drrxr ot4opeo fciltfs raums;u4tleoxr ty1opt anvs;(0srtrio nydlle  icilt)s2tm( pot4openmo3iyt a2rmuvpnt)tlerxfctadopDranvi;s) etmxm3oydlpeelieilt)aDraxrp;u1oltn i3iasfaDra(ms ()trtnmr3iatfm e ivo t srurim nu1amte fvslt) Dtaxmpou1texomociysfa2uauvs t4 rxnxrcoy1fmD aneilt srxoxopnydamee fctat  2taumoot0opxnmi3tatfs ranvp ()tlxomociodlatr uei;()s2trio3ny4llenlnet s)a2uaum no4apx mf3ilt a2umnmp;t0alxnxrcoadlmteaieolt0trumiopoydlptn neils s2um(  ;o4teeomo3iyd sDrau s;(0 rxrmf tytfp  ln o;t)s2umxr3io4llee ieils sDtaxro;t1tpe io3tas mDrlump u0 rermrctydfa eaneo;( srtrxm ou4olenlieslt)a2raxm nu1optomictltfaDranmo t0 rtnif tytfptr ivs;t0trurxr3iu1amt mfvi tf rrmurpnt4opxoiieias s2elnms ()tlxnmo iy1fm ran ols) ruoimpoo4omenlncias srua(monu1apx mf3tyt a2ulu p u)treomo tydla rlieil() 2xrimpiy1amtemieil(fsrtm( p;t0tee mo3iyslaDrmnvon(0arxnmf3oo1laDe nesl()s2urxopiu4am  lnciat  Dtmu pno1tlt  feiltlsDumumpnu4 exoxo3iatlat ln i (0t2xrxr3oydap  lnvs t  Dtrx  ot0ole  i3tytlsDraumpnt0 lenmo iydla  an o;(0 2to(mpiu1ope mivt t) Dur( poo4tetniictysfs2uluvs;u0 lxoio iydlp rlivslt srxoio3iy4lm   fci () Dtmx o;o0ole  f3tysla2umnvs;u)artrxr oadlpDelneil(0 2triopoodlpeelivtlt  rra(rpnt0ale mfctadlm2elnms;u0altoxo ia1la elu i;s) exr(rpno4lptemfes t sDrru oou0opeomiciaslmDran snu0 rtrxrcoadfpte ivs ()trumiopou1am   nei ()arraumpnu4olx  f3ils m2rl( snu)arxnir3iatoate uesl(0teumir3iy4omeemnctl() 2umuro;u4aeeo o3tys m eau s;(0aetnxo3ty1la r uvi;t0t2xr(m3nu4lltnmiet (  Drmu o;u4alt ioetat aDran s;u) ltnmr iy1fp rlneo;s0setoir oy1ll  lfeilt aDuaxm no4tltniocildla ua(vpnt4 rtomo3oodlpDraneo s srumxm nu4lmt mfes ( aDrmxrooo1tpx moctat sDulnvp;()alxoxf3io1lmDrliei (0texrxopoo4lmt  nctatf Dumump;t4olt  ieiadfa2rlnvs t)artoiociy1fmtrlieo t  exoimpoy1amt  ivil()s2uaxrp;t4apenii3tad a ea(vont4tetnmociatoa   nvo;s)sexr(o iu4oltelfvsasf Drmur ;u1opxnmictldfa2ul(mo;t4tleoxo todop  lu i;t0seur(r nydomt  fvil(f 2tmu poo0oee ioctydlm2um( s t4 leoxrcia1fpteaiei t) 2tmxm3oo1omte fcils) rrr(  oo4olenmo3tyt s2ra(ms t) rxrir tydla  auei (0texm(r3io4lpenlncils s2trumo;o1oet iieiat aDumnmo;u4 reomo3iodlptelnvslt sruoxmpou4lp n fcslsfsrta( pou0aleo oeiyt a2ra( o ()tetnircoatoa  lieol( teuoio3ou1om elfvtas s2tm(mp;o4tex  ocilt m um( pnt0 eeomo3io1faDraues s seumir3iudap   nciat)sDua(r nu4tltoioeiytlmDelu o (0teenxf oy1lpt  i i t s2umim3oo1open iesat  rrmx p;u1alt ifeiadfs2ra(mp;(0alenmrctotoa elu i t) eumio3oydapt  fes sfsruax ono0tpeniiciyslm emuvp;t)alxrirciytfaDrai i s) 2tm(opiy1aptnmnvsls)arraumooo4aexo feils a2rluvo;(4aexnxf tatfaD ln slt)trtm(rpnydlpenlnvil() 2umumont1ope iieiadfs ua( p u4tetoioctydla e ies t tetr(o3oy4omt  nvi (f rurumpoo4oex if3tltfm2rmnvpnu0 reoxrciotfm eln o s)t2umxm3iu1lp nmnvtltf 2ra(m no0olen ieiaslm rlumont4teenxr3oatfpt ai ils trtm(opiydaltnlncs s) ruru pnu1alenmf3ilsfm emums (4 etomf3iotlaDeaivs t0t2xmxo iu1om nmnvslt  Dtrumoou1tle ioeiasfaDrln s t4alenir3io1fpDrlnvs ( seumxo iu1ale lfvilsf rrm(m oo4oeeoifcils m em( s u4treoircoadom r ivs;t)t2ur(m nu1llenlict t s2uaumpou4olenmf3iatfsDrlnms t)trtoircio1omD  u ol(0teuo(rpnu1ome lfvia()a2ra( p;u4oleo o3ilsfm elnvp;()tlxrxf3oytfmt  u o;s) rur(r3oodape miesl(fsDrmumono1ole  ictadfm rmuvsn(0altnmf iatlm  luvs s)trtm(opou1lm  lfcils)arraxm oo0aetoioetys sDem( snt4 eeomr totoptrai s;()srumim3iy4lme  nctlsfsDururpoo4tee ifctld a2uanmp ()areoirctytfmtranvo;t0 etrxrpou1lmt  nesasfsDrmump;u0tle mfcilt s emu o;t4trtnir oatfaDe nvi () 2xoir ou4alenmneia( a2tm(  ;u4texnmi3taslsDea( s t) rerxocoytomDeai i;t teurir3oydomtn nvtlt sDtmumpot4oeenifcild s emumo t0 rtoio3ootfmDeauvs s)sruo(m iydope mics t artaxmooo1altnifeiatfm2ra( p;t0tlxomo oo1oat  u i s0texm(m3oy1lle mfet s)sDrrxrpou4opxoiieiysla2umnmonu4 leriociadfa r iei t0seurxopiu4lm n nci t aDuru  ot4apeoiictytfaDul(von()tetnmrcto1om rluei;t0teuoxopoodap nmivs ()sDtru p;o0oeen fcilsfs2uluvo u0artrif3iytfmt ai o;( t2tmxrpoodlle mnciatf 2uaxroot4aeeomo3tasfaDel(ms;t4arxomr3tytla eln s ( s2umiopiydlm elfvs s s2trur no4apto ieiydfaDul(vpnt0aleoxfciy1fat  u ols0s2to(opiydome  feilt)sDrmxmpnu1openmoetysla ulu p;u0alxrmf oydla eluvil( sexmxopoodap nlics ()s2ur( pou4optoifeiyd aDumn s;t4aexoxoctatlmt lu o ( seuoxm3ou4ap   fcs s) rum(mpoo0olxniietaslm el(mo u) rxrifctytoaDeanvol()texm(mpny1ole  nvias sDrmur ot0tltn ociasla2eauvs (4arxoio oytoaDraivil()trxoimpnodom elnei t) rrrum ;t0oeenmfetaslsDea(vo;t4 exrio3oodfaDrluvol( trxrirpoo1al e ncslt)srtr(ro;t4tle mo3iltlsDrmu s u)aeeomfcia1fmD  n s s0t2tm(r no4lltemiesa() 2rr(  ;o4opeoifciasfm2ran sn(0arxrmo iytfp raies () 2um(m3ou1llte iet s sDumum ;t0tleo oeiadfa2ea( s t0 eeoxf iotlp elnvi t)sexoxm3oudamtnlnetat a2ururoot4aptomfeiaslsDeanvs t4 ltnmf3ia1oaD auvi;s trxo(mpiudapt mnvsas)aDtaxr no4tetn f3iaslm2em( sn(0trtomo3oo1fptrau s t teumxr oo1ole mnesatfa2ra(  ot4olx ifeiltla2ulnms;(4 eerir3oa1omDrlies;( trumim nodope mfvslt)srraum ;t0tltoii3iytfa rln pnu)aeerxf totop   ivil( srxrxo3iu1lme lnet (  Dua( ono0tpt iicils mDua(mo;t4tlxnmfciytop r nvsl(0s2xmir3ny4op nmivtat a2umx p;o4oetn feiasla eanvo;u0 lenxrcia1lmte iei;s)tetmir3nu1apenmfes s)a2uaxr ot0tetniiciysfmDeanmpn() lerxr3ootlpD aiei (0 rtoim nu1aptnlnetat)arrauroou4alx ioeiysfa umn ont)alermfcia1oa  li sl(0 etrio3no1al n ies t)s2trum ;t1opt  f3iltlmDrm(vs (4altoircta1lmte ueo s0tetoimpnydolenlnvs sfsrrmx  nt4altoif3ils a2ranmp;(0trtoir3iytopDeai o;s srumxr3oodaptelnvtls aDumu  ;o1tlt ii3iydlsDrm( s;t)arxrxo tadlaD anes ()teuo(r3nu1ome  fvt tfsrraum ;t0ape mfeilt mDean p t0aetrmo3tadfmDrlnei s0 2trir3oo4lp  mnvsl(faDtmxm ;o0tptnmoeiydfa2rlu s (0tetnir iotla raivsls trumxrpiodom emfesls)srua(m ot4alenifeiytls2eau s;(4treoxo3tadlmDrlivs;t) euoiopiu1optnlnciat)a2uaurpnu0tltnmfeiyt a2ran pn(0 eerxfctodop r nei ( tetmir nudamee ietat  2urx  nt0opx  ocilsfmDeluvpnu0tlerio tadomDr ies (0srxrio3nodoleemfvsls)arum(m no0oexnmo3iys mDra( ont0 lerir oa1op   i i t0 rtmxr3nudapenmnei sfs2um(m ;o0opt mietyt sDrl(mo t) renir ty1op  livsl( t2trxmpiy4lmtemnvsls)s2umx onu1oexnioeilsfa eln o t4 lxomo to1laDe i i;( sexo(rpoy4llt  ivtlt arumu p;o4tptn oeiadfs2ulnvp (0tetoifciodom rlnvslt0sruoxrpiodapt mfvtat)srrrxr nt1opxnmo3ildfs uluvo u0aeeoxf3iatfa  aueolt0 2xrimpiydlmt  feiatf rtau  oo4tltn iciad mDumnmpnt)aeenxf iydlaDelnesls0tetrxr3iudomen ivia(fs2rr(rono4aptnmoetldfm umums t)trermf3oo1oatrau o;() 2xrir iy4ope licilt srrmxmpoo1tltnmi3iad a rmumpn() rtrxfcty1omteaneils)teur(m3iy4aptn net (fs2rmxmp;o4oexnmfctyd m umnms;(4texrmrciatlaD auvol() rxo(r iodlpe  ieiltfsDrmxm ;u1opeo octlt m rmnmsn() ltrxo3tydoate ivs;t)texm(opno1amt mnesat s2ua(mono1texo octytfa umuvs;u0trtoxo iytlmtelivi t0s2urxrpiy1ll  lietlt) rrm(m ;o1tpeo f3iatfaDrmnms;u0artnir3iytlatrli o ( trum(mpno1lpe lfvt t  Duau  oo1tltniictadls elnvs;u) rerio3oatomtrln ol(0trurxm3ny1lmtnmfes sfa2rr(mo;t4oetomfciltfs2em(vp;t4trtrxocoadfaDeluvi;s0 rtrxo3ou4aptn nes s  Drrumo;t0opxn feildlmDem( pnu) lxoir oy1oaDrliei;t0 2xmxo iy1lltnlfesa( a2tmurp;t4oexnii3tadfa2eanmsn(4tlxnmf3tadfptrluvi;s0 eto(m3nydop emnvtls)aDtmxront4tee  ieiydfs2um(msnu4 rxrifcia1lm  an slt t2xrxmpiu4apt lnvil( sDuauroot0apt  i3tlsfs2ean p t) reoir to1omtr u o;t0sexr(m iodomt  fvs s)s2ra(mpno4oeen oeildlmDua( s u)aeerxr tadlp e ivils)seur(o iu4ap elfct tfs2ta(r oo4alxnifeiys m umuvp t)alerirctydfptraues;(  rxrxo oodomtelnei s)srtrumpoo4apeo oeiys m2elnvo (0 lxnio tydfm e neo (0 etoimpiu4ole lfetl() Dtrum oo1alt iociltls2elnms;t4altrifcoo1opteli i;(0 eumirpiodalenlfeta(f ruaurpoo4aet mf3iatlm em( s;u4aetrxocio1fpDeaneolt srumiopny1lmt  ics t  2urump;u4opt iieiadfmDeaums t)tlxnifcoatfmDr uvi;t0truoio oy4om  lnci s srua(mpno4tpt mfeiyslm2umu ont4 exrxf iydlateaneil()teto(o ny4ap emncsatf Drm(  oo1alen iciltfa2rmnmo;(0 etoxf todopD  i s t)trxoxr3io1ll nmnesas srrr(  no1tptnmf3tatfsDumn p;u0 ltnxr3tydoa   nvo t)t2xoxr ou4ap elici tf Dumump;u4altoifetltfs ranvp u) rxoir3oatopDeau o t)t2xo(rpnudlp elnvta()sDtrump;t0optoiictytfa2umnvon(0altoxocoatlate uvi;t) etoir ny1om   iesatf 2raxmooo1oet  o3iys a ua(mont0 rtrio to1op  livo;t seuo(o3oy4lmtnlfvsas)srur(mp;t4olx io3tyslsDua(vsn(0 exnmocto1opD aneil(0teuoirpio4alte iet tf 2rau oou4alt ioeiys sDum(vo t0arxoxr3ootomDr ivi (0t2tmxopio4ll n ietltfaDuau pou0oex iietatfsDumnmsnu)tlerif todla ranvsl( trxmir ou1olee ncsatfarurx  ot1olt mfetasls2eaums u0arxnmf oodfm  lieilt0t2to(m oodomtelict ( srtruro;u4opx  oetldlaDrl(vo () exnmr oytoatr u sl()texoxr iudomen ici t)arrmxrp;t4opxoio3iysls2uauvo u4 etrxf3iadlaDrli o;s0t2xo(m oydlpe mivi s sDrm( p;t1tpe  fetytlsDul(msn(4trxrmo3oadfp rlivo;()texrxr3oo1oltemncia( aDuaxroou4opeo iciytlmDea( pnu)teerxf ootlpDraueo;s  euo(r3iodolee nes sfarrr(mp;t0aetnioeiyd aDra(monu4alxrio3io1om elues s0trurxm no1ope  nvsat artax onu4alt  ietytlaDul(mo;t0trtrmfciotlm   uvolt0srxmxo nu4llte net sfartru  ou1ope iieiadlmDrmn s u0aetrxr3oy1faDrlu o;(0sexm(opoudolte fvi () 2rrx onu0teen fctlsfa2uanmo;t4texrxr oo1lm  lu o;t  ruoxr3oydalt  icsatfsDuaum nu0oet ifctad s2ulnvs;t4 rxomfcoa1lat lueo;t trtmir nu1oltn fvilsfa2rmu p;o4tlto oeiytfsDeauvs;u0aeermr3to1fate u s;(  exoio3ou4lp n net t  2uaxmp;u4tetnmi3ils m2rlu o ()arenmfcta1faDrlivil() rto(opoodolenlieilt)artmurp;t0tet mo3iadla ra(mo;t) ltrmf tytlat  ivs;(  rxo(mpoy4lltnmncsa()srtrx pnt1alx  feiydfs eau s;t0 rtnxr3oo1oatrau i t)s2xm(opou1ol nmfvsl( a2ra( ont1olxoifcils sDul(mp;()texrio3to1omt lnei;s)srxo(o no4alt lneiat) ruaxro;u1oee  fetyslm2ran snt0teerxf3iadfpDrau sls)trxm(r3iodom  lfvs ()srrmxmpnu1opxnmo3iltlmDemuvp;u)altrir3ia1lm eai s;s0teto(o3nudop elncs () rtr( ooo4ale mi3iltlm2eauvo;u) eenxoctytoaDeaneslt seuoim ny1lpenlivsl()aDua( pot4apeomoeiydla2rmumonu4 rxomrcoo1lmtrln ilt)s2to(o3nu4opt  fvils)aDta(moot1opxniiciltfaDrlnmo t0 lenmr3iy1lm e i s s0 2uoxopoodllee nct s  rumu o;o0tltoifciadls2elu snu)texnxf3iodfpDe ivilt0t2xmxm3no4llenmnesa()srra(  ;o4oexn f3iyt sDulu o (4 eeoio3ia1latrai o;s0t2tmxo ou1lle mfeta(f Dtaum ou0tetomicilslm2emnmo u)aeenxr ootfa  lnvolt0sexoim ny4ol nmfcil( a2tauro;o0optomfciydfm ul(mp (0 lerir oytop  an i;s) 2xrir oo4amtn nvta(  rrau o;o4aptomoetltlsDelu pnu0trenxo ta1lptrau i;s trtoir oo4opt mivtatf 2rrxr nu4olx mo3iadfa2uanvp t0 rtnmocto1fa eanvs;t s2xo(r3iu4omeemfeta(  2tm(rpot4tlen f3iatfa rm( o t4tlenmo3iydlate nes s) rxmxm3io1lpe  fcil(f ruaxrpnu4texoioetytls2el(mpnt) eeoir oy1opDraieo;s)s2trio nydoltelnvsl()aDrrxmpoo0alxo ieiltla ra( o (0 exoifcoy1opD  i i s trtmirpnu1aleemieilsfsrur(mpot0tex io3iyd sDemnvo u4 rtomrcia1la  lueo;t  2xr(o3io1om emfetlsfsDuaumpnt0tpenmfeiysfa eanmp u0 exomo3todoatrlieo;s  etoxo oo1lpenlnesa(f Dra(roou0ape  ieildlm emnmp (4 leoircio1latrlieo;t0sexoxr oo4op nlfvsl(  Dumx  ou1opxnifeiydfa rau s;(0 rtomo tytfp  aiei;t0texmxopiodap nmfct s)s2ra(mono4aptoioeiadfs2eluvp ()aeenircoy1laDeai i s0sexr(r no1lm   netat)s2urx  ot1tetomf3tydfm raump u)aeenxo io1fmDelueo;s0seur(o oudlp emncs t)srumxronu0tleomociyd s emnmp ()teermfciy1lptean o;t trxo(m3nu4lp nlfetl() 2tru o;u1aeeo feiadls2ua( on() etrmo tadfpt aues;()trtoio3ny1am   icsa( arur(ro;o4tltnifeiys sDeauvs u4aexnio3ootoaD lieo s)texoxmpoy1lle lnetls)aDumur nu0tlxo octatlaDel(vs () ltnxf iy1la raiesl()seurim iodole mnei t aDtm(mont1oet mieiys sDum( p u4 lxnir3iydfp  aivslt0seum(r oy1olte neil(  2rmu  nt0aet iociyd sDel( sn(4artrmr3iy1fatelivil(0texrio oy1lmen fciasf rrmu  ;t4oetn iciyslm rau p;t0texnxo to1fp r ues;t)t2urir3ou1olt  neilsf 2taumoot0tet ifeildfa ua( s;(0 rxoxo oatomteaues;s  etoxo3no4lpe  fetat) rrmxrpnu0tpeo oetad mDelumsnu)treriocty1lp eaiei;t0srtrxopny1om emietl()s2uaxmo;u4tle  fciytfs2um(vs;t)altrmf oydlaDeaiei;s)texrir3oo4lpeelneil( sDra(ro;u4apxnmo3tydls2uau sn(4aexnmo3iy1lp rai s s trxr(o no4olenmfvs (fsrrm(roou0oet mieiltfm emnvs t4teeoio tydlptrau ilt)sexrim iu4lp  mfcia()aDtmumo;u4alx miciytls2em( pn(4texomrctytfa eliesl( trumxopno4omtelfcsatf 2umx  ot1aeenmo3tld m elnvp;u4texnio3iotomt lieo s t2tmxm iy1omtnlfcslsfsDum(m nt0oeenmoctld aDrau o u0 rtnxf oytom  lnvi;t0 2tr(r3ny4lp nlneias)artm(  no0tetn i3iysfmDumuvp;u4arxriociatopDrliei;s0trxoir3oy1lle lfct s)arrmur no1ale mi3tys a2uluvp t) etrirctatla   n i;s0trtmxo nodlltelivtas) 2raxr ot4texoii3ils a2rluvpnu0trxrxfcio1la rau il(0t2xrxr oo4omtelieiltfsrtaxro;u0tee  i3ilsfs2um( s;u4 rtoio iytlp eau sls  etm(r3io1apte nvt (fs2tr(mpnt4apeo fetytlmDul(mpnu4aeermrciodomtr iei;t0 2tmirpnu1lm n fvi t)sDum(rpno1tetnifetydlm ranvs;u0tlenmocto1lp eluvs;()srxm(r iu1lpen ncsas) 2rmu pnu4teeomo3ild m2emu sn() leoif oo1omtrlivo t0 euo(m3oo1lptelneslsfsruaumonu0tptnii3ils a2umn s (0aleoxo3ta1lp e uvols)srumio3oo4alen fvsl(fsDtrump;u0tle mfctydls emuvs;t4 ltrxrciotfatrai i s) rtmirpoy4amtn ivsas aDumur ;t1aexn f3ild s2rmu o;u0aexomrciatomDraieilt)trxoxo3ou1opt mnvsatfsrtaurpoo0apt  octaslmDelnmp (4trtnmoctadoatelnvil( trum(r3ou4ll  lnciasfa2tmuro;o0opt ii3tas aDel(ms (4 exnmo3iytop rlnvs ()s2urio3ou1al nlnvtas a2tmxmpnt1oet mi3ilslsDrm(vs u)arxomo3iotfmtrlnvs;s  etrxr3oudome  fcsat aDrrxro;o0tpxoio3ilslm2ra(vpnt4texnmo3to1fa eln o;s tetoxm iy1ame  ncs ()arur( p;o1teto ieiatla rl(mon(0aetoir tydfa rluvo;t  2tmir3nu1om nmiei t)a2tmu p;t1apto oeiys m elu ont4 rxnmf3iytfpte iei (0t2uoxm iy1amtnmnes () Dta( pou4aeto feild m rm(msnt)tltnif iodfatean i (  2xoir3oodalte neias)aDururooo1tlxnifetadfs rau s u4trxrmfciy1oatr i o t)s2xmio3iy4lp emici tfsrrr(mpou0opt mi3tyd a2rl(vo (4aeerif3oydlmD  uvilt0tetoir oo4amt mfvi t  2taxmpoo0opx ioeild m2raums (4alxrirciatlm rlu i t  2uo(rpny1opeemnvsat srurumoou1aeeoiieiyd a2emump;(4tleoifciodla rlueol(  rur(o oo1lpte fesl(fa2trx onu4aexomiciadfm rl( o;(0tetoxo3oa1late nesl(  exrio3ny4ameemivia() 2umump;u1ope iieiytfa2ul(vp u4 lxoio3iotlaD  ivo t0s2ur(o oo4am elncsat)s2um(r oo4tlto o3tad s2ul( p (0 renxr io1latranvs;t0seurimpiudll   fvtas)srrr( onu1tptomfetyd sDem(vp;() lxomrcoydfpte nvs;t  2tr(o io4omte fetls s2tax o;o0tpx  oetld s2rl( p t0artomr3iodoaDe neols tetrim3iudlm e fvtatf rra( pnt4alxnifciad a ra( p t) exrmf iotfm rli i;s0trurim3ou4lptnlnct s) 2rrx ont0aexnmicilsfm2rl(vsnt) eeoxo iy1fa r n i s)trur(m iudol nlfesl( a2ua(m ot4tleomictadla2ua(vp (4trxoxrciy1fp raneo;s s2xmxr3iydol  livias a2um(mpnu0apt mf3iydlm ul(vo t0aexoxrcoy1lmD aivi;s0t2tmxo3oy4omeemnvil() 2rau pno0tlxoif3iatfm ul( o u4arxoif iatlm e n s ()teuriopio1ome lnei ( s2ua(mpoo4optnif3ilsfs rlu pn()alxrir3oa1fatrluvo;(0 ruo(r3iy4omeemiesat)aruaur ;t1olt  o3tadlm ea( p;u4trtoxr3iodomtr u o;()s2uoirpnu4lmeemicil(faDrr(r nu1oeto i3ildlaDrmnmsn(4 rxriociatfmtelues (  2tmxo oy4lpenmici ()sDtmx o;o4ape ioeiyt m rln o u0aetoir tadomD anvo (  2tm(opiu4optnmfvt s) Dur(mono1tptn o3tltfm eanvo u) eenifctatomtrlu ilt) rtm(o3oudll  mnetls srtr(mooo0tltoiieiaslm eaums u4aexoxf iy1lat luvolt)srumimpny4om nmics sf Duax  ot4ape iictytlaDrl(mo u0alerxo oo1omt  ues t  rxmir iodlme lfvsa(farra(ro;u4open ieiasfa2ul(ms;(4alermr ootop eauvo () eumxr oydame lfvsat)s2ra(mooo4tpxoiociydls2em(ms;u)tlenir3oadla rlivsls  2xmir ou4om nmfvias  2um(rpnu0teeo ictyd aDra( p;u4 eenmo oytom e uvs s trtmxrpny4llte fcta( artaur nt1aeeomieiatls2rlu s t4artrio totoptr neilt)setrirpoydlm elivtas  2ta(moot4aetniietyd sDum(mo () exnir oytlaD auei;t0 exoimpoo1ol nlnetas s2rmxronu4tpxoii3iad s2emnmo;t)texnxr oa1fa eai s t)t2xmxm iydapt lnvsas  Drmxrono1opx  octadlm2emnvpn(0tlxrio todlp e uvi;s) rtrxm oy1lpe  ici tf 2ur(  no4alxnmi3iytlsDrauvsnt0trtoir3iatlmtrlivsl( trxrxo3no1lpe lics s)s2umxm oo0ape iiciydfmDum(msnu0alenmo todlmDeanes;(0s2uo(m oy4om elnetas aDumumpnt0oltn oeilsls2ra(mpnt)altoirciadfmtean s s0 2trir3io4op  mnetl() Durx oot4tlxnmictadfmDemuvs;() rerircoytfm ranvo t)trto(m ou4lm eliesls aDumxrooo0tltnioetad s ua( o t0altoxo ty1lmD ln sls0srumxm iudll nlneilsfaDra(mpou4tet  o3iyt mDranms u) etrmf3tatop  anvo;s trurxr3no4ole lfeia() 2tax ooo1altoioeiatfm2el(vpnu)texnxf to1omD anes;(0trtm(o oydllenlncta(faDrr(mpot0oeeoio3iydfs2eanvpnu0texrmocootfptr ieo ()srxmxr oydlm nmnvs s)arrrurono4apxomietaslm2ulumon(0aexrio3to1faDrau i (0 eum(mpoy1lptnliesa() ruaurpnu1optniieiadlm2emn s;t4tleomociatfpt  ivi;(0t2xr(r3oo4ll   ncils) rua(mo;t0apxn fcildlm2umnvonu4 exomf3oatom  livo ()sruoiopou4ame mfci s  2ur(mpno0olt moeildlaDrlnvs;t) rtrmociodfptrln i (  rxrimpny1om elfcsls) Dra(mpoo4teeomf3tyt a2rmnvonu0 etnxf tydfpDe i i;() etm(r iydlp emictas) 2uaxrpou1alt mocilsfa umnmp;u0tlxrio3todlp rlueo;(0t2xrio ny1oltnlfctas  2rm(  ;t1apxomoetyd m2rlnvo;(4areomoctydfmDe nei;() 2urxo3no1lp n fetl()aDraurpou1opeomoctysfmDumuvsnt0arxrircootopteaivslt t2tmim nu4ll e nvsa(fsrumurp;u1tpxo f3iaslaDean s;u) exoxo3oo1op eaieo;t  2tm(m oo1ap e nctatfs2ur(m ;u1alxn ictasfa2rm(vp;u0tlxrxfciotfp elnvi s)texoxrpno1ap  livs tf 2taxmp;o1texo ociltfmDrm( s;t4trermo oydlm   ivolt t2tr(m3oudomte fei t)srua( ooo0aetomfeiadfsDrln s (4aeerif todfa eanesls) 2xoxo oydap   ieilsfsrumxmpou1ape mo3tlsfa2uau p (0texrif3ootoaDeliei;s0 exmimpoo4al e fesls)arta(mooo0olx mieiydlm ea(vp (0alxrif ootfa r n s;()srxm(mpny1lle lfetas)a2rr(m ;t4aee  o3tydls2ea(msnu)treoxo iadopDrli s;t s2xm(m ou1al  mfes tf rrru  nt1tpx io3ildlaDean sn(4texnxf iotfm ran i;(0seuoxm nydlpeelfvt (  2rauro;o0aet  feildla2um(mpn()trenif ootlpDr ivi;s  rumxo iudlmte ictlsfaDra(mp;u1apen i3tad a2ulnmp u0arxrir3ootfpDr uvs ()trtrxopny4am  mivsasf Drruro;u1aleniiciysfa emn o;u4alermf3iotlaDr u slt) exoio3nu4oltnmnei (fartaum ;o1tleomietyslm eau s ()aeeoio3iotlm raieo;t s2umxo3no1altnlictatfarumumpoo4oex io3tydfa2rm( snt)alermfciatoa  livsls) eurio3oo1olee nvil( s2tmumpoo4apxoifeiytfsDean snt)arenmr tydop rlueil()teumirpou1opte nvs (f 2tr(root0aeen oeiad m eanvsn(0 lenir3tadfmt auvo t s2xoxr oudol nlnei ( aDtmurp;o4teen fetydlaDelu snt4alxoir ia1optran il(  rurio3oodomt  nvsls aDrm(rp;o4oexo ictlt m umnmont)trxrir to1omDean i s)setrxmpny1lmt  fvsasfsrrmum ou0tlxomi3tyt m rlumo;t)arermociadfm  li i;t0teuo(m iodamt  iei () 2rr( o;o0tpt ioeilt mDrauvpnt4 etrmfciydoaD  ivolt srto(o iy4om emiei tf 2tr( o;t0oexn oeiytlaDemumpn(0 eeoio iotlmteauvo ( sexrxm io4op n fviat)aDtr(m ou4oetn feils s2uanvp (4aeeoxociadlm   ueilt)s2xoimpnydolenlncilt) Dua(rp;o0olx mi3iytfaDua(vo t0aeeoif todfate ivilt  rtm(o3iu1llt lfesl(fsrumu p;t0texo ieild s ra( p;(4teenif3oa1opDr i s s0truo(m3oo4alenlfes () rurx oou1altomiciydls2ra(vp;t4 exrxr iydlmt  ivs;s0sexoxo3iy4lp   ietas)s2uru o;u4tetn ieias s emums;u4trtoif ty1lmDranvslt0 eto(opnu1alte neiltf Drrurpou4tlx mietasla2uanvsn(0 ltrxo ty1laDrlnes s)srtrxo3oudlptelfeiasf rur( pno4opxoifetatfsDua(mpnt) lenifcto1lmDranvil(  rtmimpiodlmen ivi s aDrru  ot0tetnifeildls2ea(mo;u4trxnir ty1fmtran ils  rxo(r3iudlltelicsls aDuaxmpou1aex  f3iysfm2ua( pnt0texrxocoadfm r uei;s)s2xrxmpnydlp  miei (fsDtmx o;u1olxnmoeiltlmDum(mon(4 lenir iydlp rln i;(0t2um(r iy1lm n fci s)srtm(m ;t0tltoiictldlaDulnmsnt4 rtoio tadomD  uvi;s  2tm(rpnydop e fetl(fsDum( o;o1teeo f3iasfmDeln snu0tltrio3oatfp eauvs;() 2xr(m3ou1optnmics t) 2uaurpno1aeenmictatlm2ulump t)alenircoodfmDeanvo t setrxm iodopeemieil( aDtmu ooo0tetnmiciad a2em( onu0alxomf3iotfm ranvi (  rxo(m3iy1al elieias aDtm(rp;t0alen fciadfs2el( o () ltomrciy1oaDr ieilt0 etrirpoodom nmnei sfsDumu ooo1oeeoif3iyslmDeaumpnt4 ltnir oy1op rlnei;( s2ur(r ny4ome mictas a2tau  oo0oet moctadfs2rln o (0artrmocoa1omtrau o s) 2um(m nu1amen neiltf ruax  nt1aexoiiciltfm eanvp u0tltoxr3iytfm eauvs;t)t2xoxmpoo1op elfvs t) rumxmpnt4oex  ocild s2ea( s;u4altnxo3oo1fmDe neo t0 exo(m ou1amenmneilt)srtrxro;o4apeomf3taslmDrl( o;u0 exrio3todoa r ieo (  rtrio oodalt mncs tfaDrrxm nu1oexn f3ildfsDulnvsnt)tetrmr iadfa rauvsls  rurxopou1lpe mivi (  2rrurpno4tlx ifciaslm2rmnms u)tleriocto1oa eaieolt)tetoxopio4ame lnvslt  Dtr( oot0aptnmoeiat a ulumo (4arxrmo ta1lmD lnvi;s texo(r3iydopt  nvs ( srtr( ono1apenmfcild s el( s u0 eeniociytlm e nvo s  rtmim iy1apenlnvi () ruaxm oo0tpeoiictlt m umnmp;t0alxnxr tytlm eluvi;()s2tmxr3iu4lp  lfeslt) Dtaxmoou1alen i3iltla ean snu)aeermr3ootlptr n i;t)t2xm(r ny1omtnmnet t)s2taxr ;u0ale  oeildfaDrmnmon()trtrif iadla  aieo;( s2tm(rpnydaleemfvt () Dtax  no4tpxomicilt aDumnvo ()arxrmo iodopteln s t0 rxrirpny1open ieslt)arurxr ;t1tpx ii3tadlaDuluvpnu0tlenxociy1op elueolt)trur(r ny4ol nmfvil(faDum( oot0tlx  ociytlsDel( s t4trtnir3todfaDr i i;s)t2xmim oy1om n nvsas)sDrax  nu1apen i3iydlaDelnvs t4aleomr oodomDr i o s seurxr3iudaleelivsltfs2ta(m nu0tpt ifctatla2ulump;u)trtoir3tytfm r u i;t)trumiopiu4openmneiasfa2tr(r nt1apxo ietldls em(vsnu4 lxomr3tatop eluvi;t)s2xrio3oy1ol   neils)a2taurono4aetomfciysfs rl(vonu) leomf3oo1laDeauvs t)truoxm3nudll elnesa( s2uau oot0tlen feiad s elu o;t0texnif oytlmtr u ols0trto(m3ou1lm elfcil(  Duaumo;t4tpxomietltlmDemumont0trerxrcootoa  li o t0seumir3oy4ol n ictl( srtrx ooo4tlx ii3iysfaDranvo u)tlxoio todomDr ieols0tetoxr3oudol nmnvtlt)aDra(rpot4opxo i3tydls eluvs;u0 lxnmf3tadlp   ivs t)srxrio iy1ale mics ( sDraxm ;o0apxnmo3tadfmDul(vs u4altomr3tytlm rlueo;(0sexoxo iy1openmfes s) rtm( p;o4altn i3iadfmDrm(mp;u4aexoxo totfmtean ols)srur(o3ny1omen fct (farrmum no4tet  f3tyt aDulu s;t) rtnirciotop   i s;t) 2uoim iydlp elivt ( artmu  ;u1apeo ieildls umums;u4teeoircootop   i slt s2to(o3iodamtn neia(fs2umur ou0alxnio3iatla2emuvs u4aexrir oydlmDran olt  eurim oo4ape mics ( a2taxr ot0alt  fcilsfm um(vpnu)artnir tydopDelies;s t2xoiopny4al e fei (farta(r ;u4olxn o3tasfm ran onu0tetrif iy1fmDeauvo;s setr(mpiu4ll elnvi (f 2rrxro;o0tlx ifctydfs2elnvs;t4 lenxocoodfpt  uei t0tetoirpiu4ole  neilt aDur(r oo0tex  fctydlm em(vs;u4artoxr ia1fatelnvils  2xoiopiy1llenmieiasfsrtaxm nu0aexn oeiyslm ulu on(0 exrxoctodfpDeanvols) rto(o oo1lpenlnet ()srtaxr nu4openmociltfs umnvp t4texrio oy1lpDe ieo s) rtmxrpoo1llte nct ( s2rm(rono4olx  f3tadfs2rln snu) lermfcoy1fptr ivolt trurio3ny4aptnlfeia( a2trx  ;t4texo oeiad s2uan p (4artrmf3ty1fa  aiesls)tetr(m3iudal nlnetl( a2uau pnu4tlxnmieilslm2uln s;(0arxoio3ta1omteaieo ( s2toxrpoydol nlfeil( arua(  ou0tptnmoetyd m ea(mpnt4tlxoxfcootomDrlivslt) exo(r iydap n fctltfaDtm(moot1open fctaslsDrauvo;() lxoxr3tydomt  uei;t)srtmxr ny4om e ictl() Dta(mpoo1teenmfciatls em( s ()aetrxr tydfmte ivslt  2tmxo3no4al n ncslt)arrmu p;o4ale  oeiasla ran pnu) exrxo oatfptr i o ( seum(o no1olt mfcsatf Dtauro;u1texn ociytfa ranvonu0altomociadlp ranvolt)texoxm3oudal nmnctas srrmxrpnu0tptnifetysls umums t0 lerxfctodfp e i o;()s2tm(r3oo1ll nmivsl(f 2rr(mo;u0tpeoifetltfs2elu on(4altoxr3iydla r ivs s0s2tmirpou4op   nvsl( sDra( ono0apx  oeildfa2emnmp;u4 lenmf oa1oatrln o;t0trtmxm oodome lfctlt)srtm(r oo1alxomf3ias mDrm( s;u4tlenir tydlpteai s t teuoim nudole  fcils aDtmxronu1alx miciyd s rlumpn(4 lxrmf3oy1fpDranvi;t  2to(o oy1ome lnes t  2rrur ot1aeeoio3tytfsDem( p t)trtoio3iadfpD an sls  eumim3oydale lfvi s)s2tr( pnt4tex  ictltfa um(mp;()trtrio3iodomtr ivo t t2trxr3nodalee nvsls)sDra(m ot4apxoio3tlsfa rlump t)altoxf oytopteaivsl()srtr(o oo4ll   ies t)sruru o;u4aex ii3iatfa2el(vs t4teeoir3oadfa  ln ilt setrio ny1ole lics s srtm(root1aex miciad s eau onu0tltrir iatomte n o t0srum(m3ou1apenlicils)artm( o;t1ale  ictatfm2raumo;t4arxoxf iy1la   ivi (0trxmxm3nudap   nctl() 2umx p;t1apxomieildfs2rauvs;t0 etnxf ty1opD  uvo (0srur(r oy4lp emfcsas) Dururp;u0oltomi3ilt aDelums (0 exoif3ta1fpDeauvo ()t2toio3ou1optn fesls s2taxr ;o0tlxnmi3iydfs umnvpnu0altnif oa1fmt auei t0tetm(r3iudap eliet t arrm(r oo4aee ioeias mDrmumonu4aeenmocty1fpteauesls0trxmxopoy1lmtelnet sfsrrrx oou0aexnmietat sDuauvp;t)altrxr3oy1opDran s;(0tetrim3oy1omenlfesls srtmu pno4tlxnmf3tat m ua(ms ()trenio oadfpD an ilt sexm(rpiudol emnci s s2ua(mpnu1tlx  o3tlsfa elu p;t4trxnirctodlpDran s;s0srtoiopnodomenmfcsatfs2ur(rpoo1oet iiciydlm2rmu o t4trxomrcoo1laDranvs;s0 2um(o3oo1alee fet s) Dtr(m nt4ape  feils s ea(vonu) renxo tadomteauvs;t0sruoxr3iodale mfctltf Dum( p;o0tpxnmocilt sDelums u)artrmfcty1lp eli o;( texo(opiodomtnlivsl()arumu p;t4apxn octatls2raums;t4areoircoytop r ieo;t t2xo(r3oy1op  mncias  Dtrxmpno4olx mi3iltla rlnvs;()aexrmo iadlm  lnvi;s0teuoxm iudolt lieias srrmum ;o1altn ociadla el( pnt0tleoir oadfm r uvs;s setoxr3iudamtelfvsa(  rumxmont1olen i3tytfm ua(mo (0tlxomr3oa1lm rlnvo s0 2ur(mpio4lpt  ict () Dtrxm ;o4tpx ifctat mDrlumpnt)areoif3iatfmtrau i;(  2urio3io4ll  mnesatf Dtaumpnt1texo ieiatfm2el( s;u)treomr iytla  anvols0trtmir oudlp e feiasfa2tmxm nt1opxomo3tlt a ea(mo u)aeeoir3tatfp ran s s)teuoio3iodoleemfvs s)s2rmur no1oltn ociydlaDum( s (4trenxrctodopD au ils)t2urxr oo4amtnmictlt)srtm( o;o1apx  oeilt s rm(mp ()tlxrioctotoat aueol()trumir3nodal elivs s srtm(rpot4alxo iciadfa2rl( o ()teenxf tadom eau i;t0sruoxo3iydap nlnct (  Dtrxm ;t1aexoifcils s uluvsn()tltoifciatfa eli i;( s2xr(rpiodal nlfci tfaDrr( onu1oeen iciad a2rl(mp;u0 rerxo3io1lmD lueo;t)t2to(r iy4aptnlnvi t arumxm ;o0oex ioetatlaDrl(vo;(4artoiociatfm eaiei t0srxr(opno4ap e fvtasfa2rrx pno1tpx ioeiltla2rau o t4aexnmf3todfmte u i (  2uoimpoudlpe mnes tf rumum nu1olx mf3ildfmDel(mo (4artrmo3tydfm ranes;t0 rtrimpoo4amtemfci (farumumonu4oltomictltfsDeanmp;u0trerirctotlpDrau s s seto(o3iudlleeliciatfsDtaxm nt1oeeo oeiydfa um(vs u0 rtnio3todfp eli o;t0 etrxrpoo1ap  livtatfs2uau o;o1olen i3tltla2umnvont4aeeomf3iy1opDeauei t sexo(r3oy4lm   ieil(fsDuaxm nt4oexoif3tltfs2uanms;() exoiocoydopDrli sls trumim3iu1ome liciasfa2uaxrpot4optomociadfs2uanvp;u)altrmocta1fmDelu o s0 eumxrpio4opeelfvilsfaDtru  ;o0teto fctytla elumo;u)tltnio3tatlpD  i sls0s2xrxmpnudlm  lnctl(  rrmuro;t1oet mo3tydla rmn onu)aeenio totopDeliei (0teurio3oydam   fet ()srrmu ont4tet mieildlsDea(mp (0 eerif iatfmD  n i t0srxrirpoudam   ics ()aDuru oot1tetn i3tltlm emnvpnt0 etoif tatfa  aivsls) rumimpiydlmtelivias sDra(m no4olx iieiydfs2uaumo u)teenifcootfa eau o;s0t2toxm io4alenlivslsfarrr( p;u1oltomoeilsfm ulu ont)trtnmo3oatfmteln s;s srto(r iu4olee ici t  rraxmo;t4alxnmfeilt aDrm(mpnu) etomo iotomte ues ( s2trimpou4ap  lfctat)a2tr(rpot4oeto oeiasfm2uauvon()aexnxoctodfp   nvol(0srumxr io4lp n icsa()aDtmu o;o4tpx  iciat mDem(vsnu) lxnioctatlaDraueol() rxmim3iydop e ivilt) 2ta(  nt0tpx  ieiytfaDraumsnt0trerxr ia1fptrau s (0t2xoimpio1opeelfvtas)srrru  nu0aptnifctlslsDelu onu)trxoircoadlatrlnes;t) rxr(r3ny1ap  mfvs (f Dur(r ;o1tleoifciys sDrm( p;u) rermr3io1laD  nei;(0t2xmxrpoy1op  mnes s  2rrxrooo4apx if3iltlsDranvonu)texnio3tytlpt livo;s sexo(m3iydamtnlfcilt sDurxmoou1teenmfetat sDean ont4 rxnxr iytfm  auei ( truoxo3nydlpe mieslt s2uax  nt0aee miciyt m2ua(ms (4tlenmf3oa1oate i s;t)truoio iu1oltelivias) rtmump;o4tlxn o3iltfsDranmp;t) rxrxo io1fm  lnes ( s2tm(r ou1al  mivsa() 2urxr ;u4altn ocils a rl(mo (0alxoir iatfptr nvi t0 exmxm3ny1olt  feta()a2rr(mo;u1teeoiociyd aDrln s;t) leoir3iodfm r uvi;t t2xmir ou4apenmiviatfsrtr(rpoo1tetn oeildfmDul(mp;u)arermocoodlpDranvi;t)texrimpnodamtnmnvtlsfarrru pou0alenmociysla em(mo t4aeermr3iydla  au slt0sexmxo nydameemfcsat)s2umump;o1tlx  oeiys aDrmnmo;t4 exnmrcoy1lpDr uvolt) exr(o3io4om e nvta(f Durxrpno1aet mi3tyt sDrl( o t0 ltoxf tytfaDe u o;(  2urir3ny4lp  mnvi () 2ta
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;( trxrio3ny1ome mfvias sDtrur nu4tptn ictad s2el(vo;t0altrxf3todlptrlivo t)s2xmxr io1ap  lfcsas a2raxmp;u1oexnmieiyt mDra( s u4aeerxrctodopteaues s0tetoxopnu4ape lnciatfsDrr(rp;o1olt  f3tadfa ul( p t)trxnxfcio1lm rlivs t) exr(o oydam  mici s)a2raxm ;u4aptnioeiasfa uluvpnu) reoxf to1fa  lieo;( t2trim nu4lpe  ictl( s2uaur ;o4teen fcilsls elu s;u) exnifciadfmtrlu o;t  eum(opoudal e fvi s aDurx o;o1tet  f3tadlm2elnmp ()trxrxr3oa1oat anvo;s trtoimpiu1lltnlnesa()sDtauro;u4olto iciyd s2eauvp u4 exnxocta1fpt lueolt t2umxm3iydopenlnesls)a2tru  ;u1optoiociyd sDuan o u0 etrxfcootlatean i;(  eur(m3oydam elfvta(fa2tr(m ;t1aleoif3iad sDeauvo;u) etrmr oydopteau i;s  etrir iy1lptemfei t)a2tr(  ou0alt mo3iydfa rlnvonu0texomo tadlm rliei () 2uo(o iu4ap elfei ()arra(m ;t1aleo oetys sDemu pnu)aetnmrcootfa e u o;(0srtr(opno4llt mnvsl() rtmur ;t1tlxnii3iltfm2ranms (0tetnio3oytfmDeli ilt s2umiopou4ol nlfcsat)aDum(mooo4tltn fcils aDemn pnu)tetnxo3ta1fm eauei;t)s2to(o3io4altn fvslt)sDur(roou4tlxoifctld aDelu p;()arxoio3tytopD lies s seum(opny1lm e fetl()aDta(m nu1alenmo3ias a rm( p u4 rtnmocoodfp elueo;t) rur(r nu4ol n nctasfsDtr(root1olto i3iyd s rm(mont) rermf oatom r n o;(0trtoirpiodll nlivtl(fsDraumpnu0apeo i3tas aDum(vpnu4 rtnxo oo1lmD li o;() etm(rpnudomtn fvt ()aDtmum ou1tlt micils a2umu p t4trerir3ta1latr ues ( srum(rpnu1ll   iesl( s2umxmpou0aeenio3tlslm2eanvs;t4arxnmf iydlptr i sls) 2xoim3oydllen nes ( srrru  ;u4alxomieiasfm2uaums ()altnmf iodoat  i ol()srxmim3nydal  lnct (farrr(monu4alt mociydfa2ean s;u0aeermfctatfpDeai o t)srtrim oodolt mncilt) Dumxmpot4alxnmfeiydlaDelnvsn(4 etnmfctydlp  auvs s) rtmxo no4lmt lnetat)aDtrx p;t0teenioeiys m2ul(mo (0 etoifciadoa   nei (  rtoio3iu4ap n fei ( arua(  nt1oee if3tyt aDumumo (0tlxnmf tydomt ai i;(0srurio nudalt lfcs tfa2tm(r nt0aet  feilsfmDrl(ms;u4 rtoxo iydomt auesls0trur(m3iu1lltn nci tfa2trumpno1oleo ociadla rlnvp t)trtomf oadfatrluvo;(0trtmio iu1omee neiltfartm( poo0olenmfeild a rmnmo t0alxnmocoodfaD au o s)s2xm(r oodap emnviat)sDtmu onu0tptoii3tatla2uauvon(0aetnif io1laDelnvi t)setr(o ny1amtemncil()artaur nu1apeo ieiat mDuluvo ()tltoio totopt auei ()sexo(mpoo4lpenmfcsasf 2urump;o0tltniietatlsDea(vp u0arxrmr3ia1lat ai slt0srxmxmpny4lmt mivsa()arrru pou1olxnmfeiyslaDumu o;(4trenxr3ootfpt au s;(0tetmxm nodal  livilt srua( pnu0aexo octyd aDulnvs t4 eerxfcta1om ranvilt0s2uo(m3io4omeemieilt srrmu oou4tltn oeiadfs2rl(vo u)alxnmo3oydopDrlueo;t teto(opiu4lp n iesat)sDtaumpnt1oeto i3iadls2rlu s;t) rxnxf iadfat auei;t)trurxmpoo4olen nctlt srrm( o;u4alenii3iadfa el(vo u0 exoir totfa  lnvolt) exr(opoy4lltemnvi ( a2raum ou0alx  f3tlslaDuanvs;()trenxr3oa1oaDraivi;(0 etr(r ou4lmt  ncsltfsDtaurpou0apenmf3iad s2rl( p;t0aeerir ia1lpDr ivi;(0 2xmxm iy4oltemfvtl( artmumo;t4tle mfciad m ulnmpnt)trxrxf oytopDe nvs;t) rxoimpiodll  lfci ()aDtru  oo0aet  ictyslm emuvp;t4alxnmocoo1opt lneo;t trtm(m nu1omen nesas a2uau p;o0apxoio3iltfm rmnvpnt4 lerir iotoateai slt)t2uoiopiodlp emnvtlt aruaxm nt0tlxn fctadfsDeauvs;u0aetoxf tytlm ranvi t0 eurxr oo1ole  ivsltf Drau  ;u1tltomi3iysfsDrm( o (4teerifcoo1laD luvolt0t2trio3oydll nmfvi () 2trx  ot0oetnifeils aDra(vp ()aexrir oo1lmDr n ol(0t2ur(r3oy1amtelivta() Duau oot1aetnmfciad a uln p (4 reoif3iydfat livils)setmir3oudapte fvi (  2urum ou0aexn o3ilt a ranmsnu0teeomrciy1fatr uvsl(0s2xr(o oo1lltnlfeiasfsDtmu ono4tpeoioeilt aDua( ont)trtnxo oydoa eln i;t)s2urxm iodaltn nei () Draurono1teeomieiatlm2ua( p;t) leoir iotla r i s;t seuo(o ou4ol elnvs t  Duaurp;t4aleoiociydla2eanvsn(4trxoxo3iydfmDeau il(  eur(o nudom   ies sf 2rmx  ou4tltnmo3tyslsDrmnvp;t) rxnio3tadomDelnvols)s2umxm3iy1omtn icta(  Duaxm oo1opto oeildla2elnmo t0arxoxrcoo1faDeaiei;t0seum(m iu1openlivsat artmuront0oexnioeiytls2ulnvonu4tleoif3ta1oaD aieo;s)srurxr oy4oleelnetltfaDra(ronu4oex mo3ildfaDea(mo;t0tlxoir oytfaDeln i t t2to(m3io4amee fvsas)sDuau o;o1olx  ociasfm2emu s;t0trxoxo3oodlmteai o;t t2urirpio1olte ietls  Draurpou0tptomo3iysls2ran o u0tlxoxo3ta1lptean i;t0t2to(mpno4olenmncil( sDtr(mpno1optoio3ils aDrlump u4 reoif3oydlmDeai o;s0srtm(r oydapeemfes sfaDurx  no1olxo o3ilslm eaump;()aetrif iydlateauvo t  exrir iy1ol   fvs s)s2tr(rooo4tleomoeiytla ra(monu)aexrxf3oadlm   neol(0trxrxm3ou4omt  ies sf 2umxr ot1optomietas s uanms (0teenxociy1fptranes;s0 2urir3iudolee feiatfa2ua(m ot0olxo fciyt s ua(mp t)areoif3oodlatraivi t0 eum(m3oy4alt  nvt t)srurx onu4olxomfciydla uanms;(0alxnir3tatlatr nvo;s0 2um(o3nudllenmivs ()artm( ono0tpxoioeiaslm2uln onu)artoio oodlpD  u o (  eurxo3ny4llee fesas)sDrmum no0teen feiad a2el( pnt)arerxo3tadfpDe i o;( texoxm3iydom n fcias)sDumur ou4tet mf3iyslm2elu o (0 lxnxf3oatlat lnvils0 ruoxo io4ol  lnvta( arrrxrono1apeniociadfm2rl(vsnu0arxoiociy1fpDrluvi;( t2trirpny1om nlfcs t a2rrumoou0teeo f3ils m2rauvs;u4 lxrir3oatom  livil(0srxrimpoy4ap e ivt (farrmx oou1aee  ietasfm ua( snu0alxrio3todlmDe ies ()seur(r oy1optemfvt tfsrtm(rpnt4tet  icilsfm emnvon(4 eeoxoctydfaDrlivslt0 rtoir3ny4lpte neia()aruaurpnu1tptoii3iydls umn onu)tetnxo3tytlpDr neo;s0 rtmimpnudlle  nvi ( sruau pot1aeen ociyslm2el(mo;(0 rtoifciy1lm  lneo;t tetr(mpoy4amtelncia(f rrru  no0opt mfeias a el(vs t4arerir3tatfptr u i s  2xr(m nu4op   iesatfs2urxm ou1teto f3iadfaDemumsn(4aeenmf oodfpD  iei;t) 2trxmpiy1ap emfcia( a2uau ooo0tee ifctltfa ua(vs t0alenmr3iadom e ieils teumxr iy4op e fvsl() Duax  no0tpe ifeiytfs2rm( s;t0tltomrctodoa rliesls)srxrxrpoo4lpenmneiat a2taxmp;u4aetomietaslm rmu o t0aexrxo3tadfpDeln i t)texr(m3iudome  nvta(fsruau pno0olen ociydls2uluvs u4trtnxf3iodoatrlnvi s0srurio no1op emiesat)arrmxrpou4aeeo ocilt mDean s u4 rtrxo totfatrlivs;s)t2xriopnu4ll elnvsas)aDum(moou0oleoifciadfm2ea( s;u) exriocoo1fptrlnvi t trxmxo3iu4op e fvs ( sruaxrooo0ape iieilt a2rmump u4 reoifcio1lm elies (0 rumim io4am n fvslt  Dtmx ono0tpxomfctydfa2rl( s t0tltnmr3oa1fa e ivil() exmim3iu4alt micsls  2tax  ot4alt io3tyslm2rmuvs (4 rtomo3iadoa e iei;s)tetmxo nydaltn fviasfsrra(ronu1tpx iictas sDea( o u0 leomf oytlm  lnvo;() rxmxrpio4lle  ncsltf ruaxr ;t1olx mo3tys mDelnmo u4tleoio3tydlm eli ilt)t2uoiopoo4amenmnvslsf Dta(m ;u1oeeomictat mDuluvs (4aeenmf3oy1fat aivolt0seumirpnu4omt  ncta()s2uaxr no4altnmo3tldfa umuvp;t)alxomo3iodfaDelueil(0 eumxrpno1lpe mncsas) 2trxr ;t0tee io3ildls2ran s;u)tleomocoo1lpDr ues;(0 2umxo no1ale livtl(fa2rrumpoo0tptn oeiatfa uauvs;t)teeoio3oadoateln s;s0trtmirpiu1lmt micsls  Drmurpoo4ape mieild a2ra(mo (0aeerxr iytlmDeaivi;( s2xoxm3iodlle micsas)aDrm(r ;o1tlt miciysfmDuluvo;t0trxomocto1fptrlieils srtm(mpiodalenlieslsfsDtrx pot0tptomfeiad aDrl(mo;u4 rermrciatfpD  ivs t) exo(mpou1ll  livslt sDtr(  ou4tex mfeiysfs rau p () leomo iodla r u ilt) 2um(m iu1lme liesas  Dtrur no1aexnmfetydfs ranvo;u)arermo to1optranvo;s0 ruo(m nodll  mici s) 2trx ooo1tpe iociltfa ua( p t)arenmrcoytomteli s;s s2tmio iudlltelfvslsf rrmx  ;u1tetnifetlsfa2eluvp;t0texnmrcta1lp e ivo;s setrir3ny1apt mfcsat s2tmurpoo4oee  f3ils a emump;u4tetoxrcta1oa rauvo;s  rumxm3iudal elieslsfarua( pnt0apxn o3iltfm2em(msnt)tlxoif oatlp elivo s trxo(mpiy4lmee fvsl()s2tm(m ;u1tpxo fetydfs2em(vp;(0 rtrmrctydop eau i s  rumio nu1olenmiesl( arrrxrpnu4tetn f3ildfs rln o u4tltrxr3tatoatrli sl()s2trimpio1lpte fvtl() rurx p;u1alx  ictldlmDraumsn(4 exrmrctotoaD aiei ()teuo(mpoy1lle  fes (faDurum no4aexoioeiltfa ua( o;u4aeerifctodoaDr uvs;t  2xmirpno4oltnmnvsls)s2ur( p;o4aexniociys mDraump;t4aetomo oy1opteanei (  2tmir3oo1olte fvs (f 2uaurpno4oet io3tys m ul(mpn(0tleoirciatfm rau sl(0seuo(m ou1op n nei (farumxr ;o4olxo f3iat a ea(mo;u0trenifciodoatrauvo;s0trxoxrpou1lltelfcta( s2tax p;t0aet mociys m uanvpnt)arxoxr3oy1laDrauvils)s2trio3no1ap emfci tfaDtru pnt4aexoiiciadfs el(mo t4tlerxfctadlaDelieo;(0 rtm(m iu1am n feslt) rtau o;u0apt iociyt s el(mp;u0tlerxf oa1lpD  uesl()srxrio3iu4alt  ivilt a2rm(rpnt4oexnioctlt mDranms t)arxrxfcoodoat  uesl()trumio ny1lme mnct sfs2taxronu0aeenmoetlsls ul(vs;t) rtrifcoydoaDeli o;(0texo(r3oy1olt mivs t) 2urxmpou0opx iictadfa uaumo t) lxnmo ia1lmt auei s0sexmim ny1alte fct tfs2ra(  nt4tetoif3ilsfsDeauvont4 rerxo3io1oatrlieo;s)sruoxmpnodll   nvtls sDra(r ;u4alxn o3tysla umumo;()arxriociotfatelueols0s2xo(o nu1altelfvsatfsrrmxro;u4olenmo3iat m2umnmp u4 exrirciatlmD li i;s0tetoim oy4llee ivsas srra(roou4oet  fcilt s ulums (0 rxoirciytomD  u slt0 rtrxmpiy4ale  ncsat sDuaxmonu4tptoifetls s elu o t)aleoif3tydla rlueo s s2to(mpiu1ll   ics (  Dta(rpot0alt mf3iydfsDeluvo;u0arermrctatlm rlivils)teur(mpou1optelics s artax poo0opx  f3tys mDrmuvsn() eenxf3iotlatelivslt) rxm(mpio1om n fvia() ruaxmpno4oeeniieiydlmDulu s t4 ltnmfcoy1lat auvolt) 2xoir3iy4lme  ici (f Duaum no4olt mfeiys a2uanvp;(4 exrmo oodoaD  n ilt setmim oudam  mici tfsrrmx ooo4alx iiciasfa em( s;u) exnmf3oa1fp r i ilt) eto(o3ou4llt  nvtltfa2uaxmont0tet mieiatfsDumu s;t)tlenif tytlmD lneil()t2xo(opny4ope mnci ( s2rr(r no0olt mociydfs em(vo ()artnio3iy1la elivol(0 rtmim iy4lp  lictlt)a2uau o;u0olt  icildlm2eanmp;(4 lxnio tatoa   nvil(0trxm(o nu1optn nvs s  rtru ono4optomoetldfsDulnvs t0 eenxfciy1omt ai o;s t2toim3nodoptnlfvi sfsrrm( pot1aptnmieiyt aDeauvsnu4 rxnxf3ootlpteauesls)texrir3ou4op eliesltf 2uaur nt1teeo fetad a2eln o;u)teerxrcoadfmDrluvslt t2xm(o oy1lpt mfet tfsrua(  ;o4teeo f3tltlm2ea(vs t)tltrxrcto1fa  lu s t s2uoir3oydamenmnvtlt srumx pnu1tlxn oeils s2emuvs;t4tetoxocoydfaDe nvs t)t2tm(opou1lle  nesa()s2rm(moou4openii3ils m el( s u0aleoxrciadlpte ieo ()sexmim3nydll emfvtlsf Drrxmono4texnio3iys s2umuvonu) ltrmf tadfaDrluesls0 rtmxo3oo1amt mfvsat)s2umxm no4opx mfciys mDuauvo;t4tltnio3oytfpDelivs;s) 2urxmpnydoptemneta(f rta(mp;u0altniiciytla rm(vsnu4texnxfciy1oa r ueo;(  rurxopnudol nmiviatf 2um(rpnt1opxomi3iatlm uluvo (4 ltnxocty1optrauvi t0 ruoio oodomt lfvtl(f Drmx p;o0tle moetyt s emnvonu)artnxf iodopt ai i;t0seurxo3oydap e icslsfaDuaumpou4tetnmoetadfmDea( o;u4trtrmfcta1la rli ils)srxmxm no4lme lfvtasfaDrrum oo1olto feiadfm2em(vs () lenio3oatfpDe nes;t s2to(r nodlle  netls  Drrx poo4opx mfeiatlm umu o u0 rtnmfcoa1fptr nes ()trxrio3no4lleemfei tfsrtm(root4aet mfeias s rln pn(4 etnmo3todoaD lueslt0t2xmirpio1lm nmici s sDum(m ou1optnioctyt s eln s;t4 lxomf3oydfp raivolt) 2xrxm ny4alen fcsls)sDrm( o;o1alto ietytfa umnmp (4artnmr oa1oa  lneols s2uoxo no4open fesls  Drau  ;t4tpto feiatfmDranvo u4artrmo oatoptraiesl()t2xoxrpio1opte nctl( aDrm(rpot0oet ifctydla2el(ms t0aexnxr oytfa   n s;( texoirpiodopenlicilsfa2rrxmpou1oexomfciyslsDran snu4 exoxo oatlmDeanes ()s2umio oy4altelnvi ( sDrax  oo1tlxo f3tatlm2uluvsn(4tlermo3ia1oaDr ues s0sruo(o3nu4openlivs (faDrmx p;o1tlenmfctysla2umump;t4 eenmf tytfp eanes s0 2tm(m3oy4omenlivs s  2tr(ro;o0aex ifcilt mDrau o;(4trtoioctadoateanvi t) 2xmimpnudlpen ivilsfa2trum ;u4teeoii3tatlm ra(ms (4tleoio3oadla  an i;()s2uoxm3io1aleelicsls)arrmuront1tlto ocias sDrm(vonu4altnmf3tatlm eli il()srxrimpoo1oleemnciltfsrur(rpot4texn feiysfs2elumpn(0teerxr oo1oatelivo;s  etm(m iudopt lncslt s2rm(rpnu4oltoii3tasfa2rm(mpnu)arxrir ia1fmt livilt0 rurxr nydaltnlnvs t  2uax oou0alxomictydfm ul(mp;u)trxnxf3oa1laD lies;(0srtoir oodll emies s a2raxm nt4tltnif3iaslsDua(vo (4tlermocoydomte uvslt0setmiopnydllte fvtltfaDta(mpoo4aee  i3iatfm emnmp;t4artnmr ootfm eauei t)s2trxr3iu1openliciat srumump;u1ale mfeias a ul(mpnu0aetnxo3ootoa  au slt)srum(mpnodoptemnesa()aruaurp;u0tetnii3tlsfa2rlu snu4aetrio3oytlmt  iei s texrxm3io4om  mncs t  rrm(mp;u4ape mf3ilsfa rl(ms;t)alenmr3todfmtelivo;s) eto(o iy1ole  ncsltfs2taumonu0tpxo ieilsfm rau pnt4trxoxocto1laD ln i ()t2xmxr nodlltnmivtat) rrmum ou1aleo f3tatfmDrauvp;(4tltrxo3iadopt ln o s seuoir iu1amtemivilsfartrurooo0aptn feiadlsDelumont)texnmocoadlp raivilt)t2trxm iudol nlfvia(  2rmxrpoo1alenmoctlslmDum(vs t0 lxnxocoy1lm r uei s)t2urxr3nudlme lnet sfarrmx oot1opxnifetldfs2ea(msn()aetoio todfaDrlueo;( s2uoiopio1optemiei t s2uaur ot0teto iciys a2ea(mp;(0 lerxr3iadfmt  uvils0 euoxmpnodlm  mfesa(  rumumo;u1olxnmietytlmDranvont4aeeomo oy1lmDeau s;(0t2xo(rpiydlle  icil(fartrxmooo4ope  fetaslm rlumo;u0 lxoir iydfpD auvi;t0texm(r3no4ll emncilt) 2ur( oot4optniociaslm2rl(vo;u0aetrxf3to1opte nvi;t  2xoxo nu1om emnctlt  rurur ;o4ale mfetatla2eauvs;u0aeermfctotomDe neslt0srtrimpno4ll nmiet t aDrau ooo0oet mi3tltfs eanvonu)tltomo iadfmDeanei;( t2xrxo3oydol elfctas a2rmu ont1oeen fetatlm2ean ont0arerifciy1laDran o;s)texmio nu1op  livt tfa2uaxm ot1aexn i3tysfa2em(vo;t) rxrmrcty1omtr nvilt)s2xrxm3oy1amt  fcta()sruaxmp;o4tpx iocilsfm2rl( pn(0alermo oy1om  anvi (0trtoio iu4am nmici tf Durump;t1aexnio3tls mDrlu pnt0aetoio3ootom ean s;s0 ruo(o3io1omenlivsa(f 2tmxm nu0oex mf3ildfm2uaumo;u0 rerir3oodfaDeauei ()sexm(mpnodape mnci sfsDtauronu1tetoiiciadfa2ea(msnu4treriociydfmtean olt) euoxopny1al nlicia(  2tmu  ot0ape mieils sDrlnmon(4tlxoxfctytlp r i o ( teumir iudam  mncs s)sDumx p;o4tlx ioeiadlaDua(mont)altnxo3oatlpD ln slt) rtrirpno1omt mfvta()sDtax oot4opxomoctlslmDrl( pnt4 exnif3tydlm eluvol(0t2xr(r3oo4op elnvtat)arua(m ;u1apx mfctytla2ean p;t0teenxfcio1fa  liei s)s2uoxm3no1omtemfcias  Dtr(moot1oeen fciysfs uau o;() rtnio3oydlptrlu ilt)t2trxm io4lptelivils  2umx ooo0tlxoiociadfaDua(vsn()tetnmf3ootop rlieolt s2umio3nydalenlfvil( arrau pnu1alxo icildls rlnmp;u)teerir oo1lateluei t0trtmxopoudamtn nctas) rtm(rono0texo fciydlm2ulump;(0trxrxf3oydomteauvo;()seumxo3iydapen ncta( srururpno4tpenio3tytlaDrluvp;(0 eeoxo3tytfp rauvi;s)srur(rpny1lptnmfetat) Durx pnu1apxn ictldfm2el(vsn(4tltnio oatlp raueil() eurxmpoo1alen nct s  Drm(rp;t4aleo octldfm um(mont)aexnmo iy1oatrli il(0t2xr(o ou4optnlfvslt  Drr(mpno1alt  o3ilsls rmu s u0tltnir iatlpDrau o () 2xrxopnu4al nmictl( srraumpno4opxo ociad a elnmo;t4texnxr oytlp r uei (0 exm(rpiydoltn fei s) Draxm oo0tpx ifciytla ulums;u)aetoiocia1oaDeaivslt0trxmir3oy1ole lfct t)s2tr( ono1ope if3iad s2umumo;(4aexnirctodfa raneolt srxm(o ny1opt  ietls) Drau  ;t1opt miciat s ulump;(4 reoxr3oodfptr nvilt srxr(opiodape  ici s sruaum ;o4tltoio3iltls2umu ont0teenmfcoydla elueo;s t2toxm oy1lmtemiet tfaDrrur ;o1apt  icilsfaDum( pnu0 ltoxocty1opDr ueslt0sexoxr3ou4amtelfcsltfsrua(mp;u0opt ifetyslmDrluvo (0aeeoio tadlpte ivs s)s2toxm iy4om n fvi (farrm(mono4altomfctatfm2rm(vo t4aeermf3todop raies ( texr(o ou1oleelivtls)aDur(mpou1tee  ieiydlm2em(vsn(0arxnmr oydoatraueolt0trxmio3io4aptnmneiat) Duaurpnt0altomf3tltlm2uln pnu4tlermocia1la r u olt trurxm ou1alt  fct s)s2ra(rp;o4openifeilslm2eau o;t0arermocoodlmDeluvsl(0setrir3oy1omtemfei s)s2rr(m nu4tpxnmoeiysfs eln snu) ltomf3iydfpt  neolt teurxm3iu1lltelnvsa()s2ra(ronu4tlto iciyslm2rauvp u)trtoxr3ia1la r ues;t  2tmim3ny4alt mnciltf 2rax pnu4tetn f3ils s eauvo t0 eerifcoadlpDelneslt) exmirpoy1al emfvsl() 2ur( o;o1oexomf3ildla2ean s;t0trtnmo3oydfm r neols) rxrxmpiodlpeelfes (  Dta( ono0optnmfciydfsDemuvsn(4 rxnif iodoptrln ilt0sexrirpou4lmtelnet () rumu  oo4opxoiieiyslsDran s;t)aeermrctadoatr ivo;t) euriopnudlmtnmnesa(f 2tmu o;t4oee mi3iltls2elnvsn()texnxrctodlmDrlnes;s)sruoim3ou1lmt  fciltf rrmxmooo0tltoif3iyslsDemnvo;(4trtrxocia1omt anvs s)tetoim3nodom  mnetat  Dtrurpnu1apxniieilsla2uanvo () lxomf oytlm r u s t  2xr(o no4aleemivtat) 2ta( p;t4oex  i3tat m2ra(ms t0aetoxr3totlp ranvolt0s2trxrpiodomee feil(  Dur(ront4olxnifcildlm rl( p u0arxnmf3ta1la ranes s)setoxm iy4ameemnetltfsrumum ;t4open o3tas sDua( p (0 renmf3oo1lptelivi;s) rurim3io4lp  lieiat  rra(m nu1alx  f3iyd a el( p t4teerxo3ia1latrlies t trxr(o nodlm elies tf 2tm(  ou0olx io3iadfm2ranms t4 ltoio3oatoa  luei;s0s2toxmpnudolt  ivs t srtr(mo;o4ole  fetat sDrmu pn(0 rxrircto1oatr i o s) rum(m oydlptn nvsat aDtmxm oo0tltomoeilsfaDrauvp;t0alxrxo3todopteaieol(0tetmxrpiy1am nmnct ( a2ra(r ;u1oexoii3tytlm ra(vs;t0artrifcoo1fm   ueo t)sruoirpoodolte neslt aDrm(r nu0oex if3ilsls2ulnmsnt0altnxr iydlpDeln il( setoim oo4lptnmnetat)a2tmxrpoo0aleoio3tlt a emn sn(0aetnir3iatoptrau o;()sruo(rpiy4amte iet s)aDrau  nu1oet mo3iad mDulnmo u)aeenmfciytlaDrluvi t)tetoxr oudop emnvsat aDum(  ;u1aet if3tyt s2ul(mpnu4aexrifciatlmte u olt)srur(mpiu4apte fvtas artmur ot4tlen i3tat mDrm(ms;u4tlerir3totopt aiei t tetr(r iodolteliesltfs2tm( onu0tle moetysfm uaumsn() renmrcoy1fpDr iei;t  2xrxr oo4ameelncslt)aDraurono4oeenmiciyt a el(vont)trtrmo tatlaD  nvols tetrxo3ny1lmtnmnvta()sDraxm ;u0texnmf3tys a emnvo u4 rtoio tytfp  li i s)tetoxo3oy4olt lfct (f Dtm(m ou0aeeomf3iatfaDem(vp u) lxoif ootlptr nvs;s srxmir3oy1amte fvt sfs2uaxroot1openmf3ias m2eanmp (4 rxnmr3iatoptelues;t0t2xrxmpoy4omenlfet t) Dur( oot4aexomfeilsls2ra(vp;t4teermfctatlp  li ols)s2uoiopnu4lmtnlnctltfs2trxm no1apx mfcildfaDel(mo;u4tlxnmo iodoa elnvsl( seuoxrpny4am  lfesatfaDrr(rpnu1tlen oeiys s rl( pn()alxrircoadfateauei (0texmiopno4olenmfeiat a2rax ooo1oeeo fciyt aDulnmo;t)tlxrif oodoatelnvo s0 eurxmpoy4lpt  nvs ( arrr( p;t4tpxnmi3tatfa2ranmsn(4alenmf oydopDrauei;()tetriopoy4al elict tf rtrx onu0oetn ocildlm2uaumonu0arenir iydlpDrlnvi s0teuoim3iu1lpenmnvi s) ruaurpno1oetnif3iltls2em(mo u4trxrmf3oadlaDrluvo s0seurxr oydapeelfetl(farrrumo;o0olxniietyd mDrm(mo;t4 rerifcoytfpD  i sls)teurxo3iy1ll nlivsls aDumum no0texomietlslsDuaums u4 rtrmr3oa1fpte ueol()t2umxo3ou4optn net tfs2uax  ot0apxomoeiad aDul( pnt4 rtrif3oadlaD aneo;t t2umxo3nu1lltelfesl()a2rru ooo1apeomo3tat aDrauvsn() eerirctydop raueo (0s2to(o oodlptelfctas)sDrrur ;o4teeo ieiytfs um(vs u4 ltoir oa1fatranvs;(  2toir3oy4lptnmnvsasf Dtaxm ou0oeeniietls m2uluvpn()texnio3oo1lpD lu ols0trurxr3nu1amen ivtat a2rr( o;t0aexomf3iytlm2emu p u0texomr io1laDeln sls sruoxopoy1amt lneilt)sDrmxm ;o0oeeo f3iys aDrauvsn(0 reoxfcoatfa e ueolt0s2trxrpiodlpt liei s) rtau poo4tle mi3iltfsDulnvo ()altnmo totfp eaneol(0 2tm(rpoudaptnlfcslt arraxmp;o1tpt mieiytfsDrau s t4trtrmo iatlmtranei s0 rxo(rpou1lpe  fci s s2rr(r ;u4tpt moctltfsDeanms;(0altoir3oydfmtr n sls teuoxr3iu1llt lfeta(fs2rr(r ;u4tpen ieiadfaDea(vs u4 etnmrciodoat livo s0t2tm(opoydllt miei (faDrr(mooo4tee ifciatfm eau o;t)aeerxo3to1oatr ueo;s0setr(r3oo1om  mfes sfsrtauro;o0apx miciytlm rlnmp t) eermo ootop r n s;s t2xoxm3no4olee fcs () 2rrurpnt1ole iiciat m um(mp (4arxrmo iy1lat auei;t texrxrpiydlleelnvia(fa2tmxm ;t0alx ifctytla2uaumo ()texnifctydfate n o t0srtm(o oo1omtn nvtlt a2ur( poo4apx ii3tad a eanms u)altrifcoadlp elnes s srxrimpoodlpte nvt s  Dtru  oo0apeo i3iadlm2elu snt4 renxr3iy1fmDran sl()s2um(r3iy1lp  miet tf ruau oot1open fetys mDulnmpnt4arerio ty1fp eai o t)s2umio oydlp n neta()a2tr(  ;u1olxn feiydfaDrmn p;t0 leoxrcoo1fpt an s;(0seur(o3ny4ale  nvt s) Dtaurooo0opx moeilt sDranvo;t4 eeoxr3oydoptelivs;s srurim io1om nmici ()srtru  nt4tle mi3iytls emums u)arxoif3iytfate nvs;s0s2ur(mpio1ole  ivslt s2taxmpoo1oet mf3iadlmDuluvp t4 lerxo3io1lmDeli ilt)srxmim no4lm  lfctl(f Drmu onu1teenii3iatlsDea(mpnu0altnif tatfaD lneo t0s2xoxrpnu1apt lfei (  rrrurpnt0oeeoiietys m rmu p ()altrxr3oodfp  aieo;t0 etrimpoy1amteliviat a2tmx pnt1tex  i3tydfs2umnmpn() lxomf tytomteaiesl() 2um(rpny4amen nei t)arrrx  ou0texnifeiyslm2uanmonu4tlxoiociy1oatean ol(  2uoxo nodlmtemfetls srtrxm no1olto ocilsls el( pnu)trxomf3ia1lmD  uvs ()trto(m3iy4amt mncil()artax o;u1olxnii3ilsfm ul(ms;u)aeenircootlmte ues;t  rxrirpnudllenlivia(fa2ra( o;u4olxnmfcilt mDuaums ()arxomfcoy1fmD  nvol( srum(m nu1amen fcil() 2um(  ;t1tpxo fcild m2rl(mo;u0texnif iytlaDe i sl(0t2xr(mpiu1lp e fctat srumump;u1tlxo iciatlaDea( ont4tetomrciy1fm raivs;s)teurim io1openlict t)sDumurp;o4aee  oeiatlm ulnmp;t0 leoir3oytoaDe nvsls0 rurim oydop elicsat) 2tm( o;t4oleoifctytfmDuln ont)aexnif3iydlaD luvo;()trum(opoudlmtn ieslsf 2rmurpot0tetnmo3tadfm rm(vp;t4alxnioctodopDraiei;s)trtm(opny1lltelfci tfs2uaumpnu0tpxo fctatfs eanms () reoio3todla eau i;s0 rum(m nudlp nlici (f Durx  nu4ale  o3iatfm2uln p t0 exoif iydoat aneilt)texm(r3iy1opte netls) Duru  oo0oltoif3ild sDra(vp;()arxniocoodfa  lnvsls trtrim nu1llee icia() rtaxmp;t0apt  o3iyd a2uan s;u4tetrmfciatomtrau s s0texmirpiy4om  mfesas)s2rmx pno1tpeomiciysfm2rl(vs;(4aeeomo ta1lm  auvo;t0s2toxo3no4lmen ics ()s2ra(  no4tpeniiciad a2ea(vo t0aexnirciy1om r u s;(0trtrxr3oo1omt  fci (fsrum( o;o4alxnmi3iys m2em(vo;()aeeoxf3iodfptranvs ( setoxrpiudlp e fcsl(fa2ua(ro;o4ope  i3taslmDulnmonu0tlxoxr iy1lmD anvi;(0t2uo(opiy1optemfvs t arta( o;t0ale iociat s2rln s;t)trxoxf3iy1fp eluvo s  exmirpoo1opeemncsas  2um( o;t1alenmi3tad aDulumpnt)teermr3oadlp e n s () euo(rpoudaptn ncsltfsDtm( onu0tex ioetltlaDelu ont4 exnif3tadfaDrlivs ( s2ur(r3iudom nlivtlt  2uru  ;o4tee iociat m el(vo t4trtoio tydomDelnvols0srtoxo nodaptemnvta(fsDumx p;u1tpxn icild sDean p;t0arenir3iytlmtrai olt0teuoxmpoodam n fci s srtr( ont4opt mociltls el(mp;t4aetomr iydoa e n s s seumxr3iu4ol e iesl(fsrtru  ou1tpx ii3iysla ea(vo t)artnifciadlaDeaivo;() exoxo3oo1omeelieilsf 2ta(rpno4aleo fciatlsDean o;t4areomrciatfaDrln sls texrxrpoo4lm emnvtlt) Dtru ooo4oexoii3ias a2emn o;u0 lxomo3oadfmDeaneil(0t2urir iudop emict t) rtr(m oo0oeto i3iltfs2ul(vo (4tlxnmf oydomte u ol()teum(mpio1al  licsl() 2rmu ono4oet iieias s ranvont4 etoio3iatlpte n o;( setmxmpiy4oltnmneslt  Dtrx  nt1oetomfciasla2eaums t4 rxnmr3oydfatraiei;t)trurxmpiy1om elnvi (  rtrxm ou1altnmoeiyt a2ua(vsnt0aetnifcto1oatr uvs;( sruoxrpoudomt  ivtasf Dumur nt4aet mieiatfm ea( p u) leomo todfmteau ilt) 2xrir3iydal   nct (fa2raxmooo0tltnii3tydlsDulnvs (0 lerioctadomDraieo;s)t2trxr3iydape lfctlsfarrrur oo0ape  ociys s ea( pn(0aeeomr3tadfpDr u ils0t2uoim ou4lpeelict s sDurxmp;t0apto ociyd a2eluvs (0tetoif3tatfp  auesl(0tetmirpiu4altn ncsa()aDtmump;t1alen icilsfm rl(vo;(4artomf3oo1fpD ln o t0sexrimpoudal elivsa(f Duau  no1tpe  o3tas a elu s ()teeoir3oa1fmDe nes (0 2uoxr3ou4lm  liet t)srur(m ;t4oexnii3tytla2ra(vpnt0alxrxf3todfpt livi;t  euoxo nu1apte iesas  2urumonu0apeo i3tysfa2umumo (0tlxrxf3oatfatrln o ( sexr(mpiu4ape  icilt) Dtau  no0aee  ieiatfs elnvp;u0trenio3oy1lateauvs;(0s2um(mpiydap n ietas  rra(r ;o4openmo3iat a2ra( ont4tetomr3todfa e ueo t0t2xoxo3iodlptnlnvtltfa2rrxrp;o4oexo ictydfs eaumo;t) etrmo iatlatrlnvo s)trxo(mpoy4op emicilt)arua(  no1opxo o3iytfa eln s t0tleomrciatfmD  ivi;( t2xoim oo4ap nmfesatfarrrxmonu1oex mo3iatls emu s;u4trtrxrcio1lmteau il( t2xm(mpio1lpte fcil(fs2rr(  ;u4tlx iieiasla ea(vp;t4 lenxf totfat  ivo s)srtrir nodam   feta()sDraum ;o1oltomoctaslm rlumpn()teerxo iodlm  livo;t0tetmxo ou1apt lnetlsfarrr(moou0apxoif3iyt mDua( s u0arxomo ia1lmD  ues (0srto(mpio4ame mnciasfs2rr(  ot4tet mi3iasfaDrl( p (4aetoioctotlmD aieo t s2umxopiudom elivt tf rtmu  ;u4olenmocils m2el(msnu4 ltoxo oadoa raivilt  2toiopoy1ol elncsl() 2tmxr ;u1tet mi3ils aDrm(mpnu0trtrxr iatlat anvi;t  2uo(r3iu1ap e iviat  2urx pou4oeeo ieild aDrmnvpnt)tlenxf3oatfm eli sl(0 rxo(rpoy1apeemivs ( s2taurpno0texoiieiasla2el(mo (4 ltniociadfp eluvils)t2toxm3iudom emncils  2rmx  nt0aet mi3ildfm ua( o u0aexrmrcoydom  li il()s2umxr3iy1ale  fetasfarra(mp;u0alenmieiysfmDra(monu4 rtomf3oytfat luvi t  2uoimpoydap nmfvsat) 2rrxmpnu4opx moctld a2rmu s t4 etomo3oa1fmtraneolt0srtmxrpno4al nmictas)s2rmu  ot1aeenmfetytlmDrl(vs;u0arxnmf oydlaDe uvo (0texo(rpnu4ape  fctas sDrm(ronu4aet ioetldfaDrlnvp;u4trtrmr tadlmtelneo t0 eurxmpiydlptn ivs s)a2trump;u0aexomicilsfm el(vp t0arxnmo3oatlaDrlnvs s) rtmxrpnu4oltelfet (f 2ur( poo1aet ioeilslm rau ont0artrir3oytoaDe uvils)truo(m3oydomee ivsl( srrrx pot1teeomietlsfsDeanmsnt0arxomo todfaD aiesl( trtoim io1op  mfvt t aDur(r no4texnmieiadfs2emuvs;t0 lxrxo3todlp r ueo () exm(o oy1lm elfesatfs2rru  ot1aeto ictyd aDemums;t)altnmr3oytlaDr uvo;(  eum(r3iudlp   ici s s2rru oot0tpeo ietys s rmuvo;u0tetrxo3oo1fa r neols teurim io4lltnlfetas) rrauro;t4apeoif3ils s rm( p t4artnircoytomDeln i t teuoxm3oo1ome mfesasfaDtm( poo4alxo fetadfm2rluvp (0tlenmocio1fmteai ilt  eurir3nu4lm n ncsas s2rmu o;o4teenmiciysfmDem( on(0trxrif iatfmt aueol() eur(m nydal n net sfsDururp;o0olenmf3iytfaDra( p;t)tetnif3to1oat auvo;(0sexm(mpio4lm  lfcil() 2tau o;o0alen oeiasfm2uau onu4 leoircto1oaD an i;s0s2tmirpiydlpt mictls) Dra(mo;u4openmi3iatls rm(vs t)aetomfciy1fpte nesls s2um(r ou1olee ictat)srua(mp;u4tle mociytla rlnvo;u) etrxo ty1lpt anvils0 rtriopnu1omen nci s)aDra( oou1tltnmo3tytla rlnmsnu)trtrmo3tydlat au ilt0texoxmpou4al n nes ( sDrm( pot4apeomi3ias m rlnmo u4tetrircoydlmtelnvolt0texmxr iudolt  fci sfarua( oot4tex ioctlsfm ra(vo;()tetnxr ootfa e n s () etr(r3iy4lp  miei t  2rmur nu1olen o3iadla rmnmo;u0aetoxfcia1faDelivo;s s2xm(mpoo4lpee ivsas)sDtrxr nt1apenmo3tadla em(von()teermf3totlpDrai o t)seuo(o3ny1optemfetasfs2taxmp;t4aexnif3iaslmDuluvont0tleomfcoo1om  lu ol( sexrim3iodapeelivias s2taxr oo1aptomfctytls ua( o u) etnifctodfm   n sl(0texmio3iu1op  lfci sfaDrru ont4oex ioeiytfsDran p () eeomr oy1opDran ilt0seuoim iodap   ietatfartrur ot1apx  feiatla2em(ms;u4 renxo3iydlmtrluvs s0srurxopoydaltn net () rtmxm ;u4opeo ociytfa ranms;(0 etomf tatfm eln ol(0srxr(rpoo4ll e nct ( aDurumono1tpxnmfeiyt m2ranmont0trtomr tytlm raneo;t) rtr(r no1am elnvi (faDrrxmp;u0oeeomo3tatlsDrl( s;(0 exnxocoo1om eaueo s  etmxopiydapen fcilsf 2tru  nu4tlx  ociydlaDeluvont)alxnmoctatfm  anvsl(0srxrxo iydopt lnvtatfaDuru pno1oex mociydfa2uluvsnt4aleoir3oatoa eaieil(0sexm(r ou4llen ivslsf ruaxr ;u4tleo oeild s2rm(vs u) eeoxocia1lptrlnvi t s2toio3no1ome mncslt  rtru  nu4opxo i3ilslm rl(mp (0aeenifctytlp e nvs;()seumir nu4al nmfcsl( a2ta(  no1oexniociyslm2rm(vo;t4aeenif3ootom rlneilt0 exm(r3no1lm emneil() Duaxrpno1alxo iciat a emumon(0tltoxrciydlp rluvils  2tmiopoudlm  lncsatf Dtaxrp;o0olt ii3iysfa2uln pn()aetniocoatfaDr uesls0s2xmxr3oudlm elics ( sDrmx pnu0altomieiasfa2um(vs u4 eerio oadfa  lies ()srum(m ny1lm n fvsa(faDrmurp;t1apeo f3tatls rmuvsnt)arxomr iy1laDe nei t)s2tr(o iy1opt lnes (f 2rrumpou1olt mi3iytls2ulnms;u0arxrio3iotfm e uvo s setoxm iydalenlnvtl(fs2uaumpou0apxomi3tysls2emu p;t0trtrxo oy1omD ln s;s s2toir3oo1ol nmnvilt sDrmu oou0olenifeiytfm ranms;t4tetoxo3ia1oate n o (  rxmir oydol nmfesasf rrru  ot1opto f3tadfm raumon(0tltoxo3iatoaDe nvs;t) etoimpno4aptnlnct t a2taxro;t1oee io3tasls2em(mo u4arxomr3iotla e ues;( trxo(o3iudlltnliet ()arua(r ;o0aexn feiad m ulnmpnt0arxnif3oydoatrlnvilt0sexrim3nydlm n fvs ()srtmxmpnu4altnif3tldls2ua( s t4arxriocoytfateai s;t) eum(rpoudlp nmfetat  rra(rpoo0alt mociadfm2emnvs;(4tleoio3oa1fat auvs (0setoir3nu1op e fvsat a2umx  nu1aex  oeiysfs ua(vsn(4alenxf tytoa  au i;t  etm(m3nu1lltnlfei () Drmx p;o1apeomietytla rmnmo (4 lenxo3iodfmt  ueo;(0t2to(opiudlmeelnesa(  Dururont0tpxomo3tatfs ulu onu) lenmr todlp elieo;()s2tmirpoo4opeemfviat)s2ra(  oo0olxnmoetldla rmnvsnu)trtrmr tadfmtrau o t0srurio3ou4am nliesltf Duau oot1alenmi3iasfsDrm(ms;u4artrmf3oydfp r ivsl( sruoio io1lm nmict ( arurx  nu4altomi3tytla uluvsnu0teerxf ta1om rlivilt srto(m no4op elfvt s)aDumu pnt4tpeomf3tas aDeanvo t)aeenir3oydfmD aieo;( srurxopiy4altn ietl(f Drmx  nt1oee  f3tltlaDemnmo;u4 rtoir3oatlaD lnvi t) eumim iy1om n fes s)s2rr(r nt1tlen oeilt a uanvs t0teeoxf oy1omteluvolt trtr(m3oydoltemivslsfartrx ono1teeomociadlsDeaumont4 exnxo oadom  auvo s0 2urxm3iy1llen fvs sfartaxrpou0oee  octlsls2rl(mp u4trtrio3oy1omtelu s;t  2uoir3oy4al e iesas) 2uau  ot0olxnmictasfaDran sn(0 rermf3iotfpt lnvolt)t2tmxo oydamtnmivt ()s2uaur nt0tle  ociysls rmn s;t4 renio3oydfat  ies (  etrio ou4olen ictltf rrmxm ;u0oleo ociadlm elnms;t) lerxrcootfa elueolt0 exm(r oy4lpen fei sf rtax pnu0texo f3iyt a2ea( p (0teeoxf oytom  lnvo;s0t2xmim iu4om nlnvtat) 2uru pot1tpenmo3iytfa2umums;t0alerxf ootfpDr uvolt) rxoio no1opee ietlsfsDta(mooo1oeto i3tltfs uanvp;(0artnxo3iodlmD livi ()s2trxopny1lme mfetat  Dum(  nt1oeenif3tadfm rluvon(0artrmr3oodoat lnvs s trtrxo3nu4omt  icil(fsDrrumpot0altomfciad m el(vo ()tetnmf3tytfm elnvo () ruoir oydlmee netlt)sDuru ont4aleomfetlsfm2el( s;t4arenmf iy1fp r n i ()srto(rpnu4omteliei (fsrua(r oo1oex miciadfa ua(mp;u)aetrxr tydop rlieo;()t2uo(o ny4ol e nvta(faDrrurp;t4apenif3iysfmDrm( sn() rermf3todfat aieo;s) exrxo3iy1alt  fetlt) rrr(r nu4ole  ociasfm rm(mpnu)tleoif oytomDrli ils  2trxr3nu1lmen fci (fsrrmumoot1oexo feiatlmDrmnmo (4aexrmfcootlmte nes;t texoxr iy1olen neiat  Dtr(mpou4oetniieiltlsDrmuvpn(4alerif3tatoa e i s;t0 rxrirpiudoleelnctl( aDuru o;t1tex  fcildfsDumu p;u0 exnmr3iatfmt ai s (0 ruoiopoy1omte ivia(fa2uru  ;o1tlen ieilt mDul( s t) eermfctydfp eau o;s)s2trio io1apt  fcta(  ruaxr ;t1teen ocild m rmnvp;t0alxoxfcio1optrlivols srtoio3oy1omeelivsat)a2taur ou1tle  f3ils m rl(mpnu0tleomfcty1fm eaivils0seurio ou1lmt  fcia()artruro;t1apxn f3tytls2umumonu4tlxnir tytoa e uesl()truoxm3nu4om emictlt  2uaxmp;t1apxnmfciaslm2rmnmo;(4 etomf iy1la  aieo;t t2trim3nu1altnmnei t srurumpoo1tet mfciltfmDumnvs;u4arxomrcoatoaDe neo;t)srxm(m3oy1op  lfctl(fs2ur(r nt1oet  feiys m2umn o t)artomo oy1lmDrlivils)s2trxopiodlpt mietlt  Drm(mpnu1alt ioctytlsDemnvsnt4tleoxo3tatfa ran s;( s2tr(m3nu4lmtnlncsat sDrrxm ou0aptnio3iadfmDelnvo;() lerircoodopt  iesls0trtoxo oo4ap   nvs (f 2raxro;o0tex  ictys aDeln snu4tetrxr iotomD au i s0setrim nudapt  fvs tfsDtmump;t0oleniocils mDua(mp t4 reoxrctotomDe uvolt)s2xo(o oydoltelfes ( arraxm ou1opxoii3iasfmDrlnmp t4 exnxrcty1faDrai o;t0seum(m3iy4omt lneiat  Dum(r no4aetoiocild mDum(vo (4teenxo iytop   i sls sexmxopou1altn nvsatfaDtrumoou1tlen fcilslsDel(mp;(0alermf tytlmtr u i;( seurxm iu1lmt lncias)aruru  ;u4opx  i3ild m2rln snu4tetomr tatlaD ai sls)trtr(m3nu4lleemnetas s2tr(mooo4tleomf3tlsfs ea(ms (0 renmf3oodlateauvil(0seuoxr3nu1lmt mneils)s2rmuro;o1tlxomieiydlmDel( o;u4tltrmocoatoaDranvilt t2xr(rpiy4alt  neils sDua(ro;t1tetnif3tad a2rmums (0 rxoxrciydlp ean o;s  rto(opio1amee nesl(fsDrr(r nt0aleoio3iyslaDulu p;u0 exnircty1lpt  iesls0srxoimpio4amen nvi s srtaurpnu1tlxoio3tlsfs elu p u0texoir3ta1lp  aivo s) etoxrpnydoltelivsa()a2ta(m ot4aexnifcilt sDrm(vo ()aexrirciatoaD aieols)sexoir3io4olee ivtlt  Dtru pno0apx ii3ils mDem( s;()aeenio3totoatrli s t t2ur(m ny4lltn iesas)aDtm( o;u0apxnmieiytfs2rmums;t0alerxf iodlpt  i ils0 etmxr oo4oltnmieiat s2tm( ono4olx mo3tys sDemnmp t4trxnir oo1omDraneo t  etrxrpou1lpe livs sfsDtmx pou0opxo f3tas a ul(ms;t)tetomr3ia1fmDrli o;(0 rtmim ny4al emiet tf 2tmxmo;u0oet io3tls s2ua(vo u4 leriocoadomDrlnvi;s0setmiopnydom   feta(fsDrmxmpou1tpen f3tasls2el( o;(4trtoio tydom r iei;t  rxmir iy1alte fvsl(fartmurp;u0alt iieiydfa2rm( o;(0 rerio oa1lpDrlivilt0tetrxmpny4lm   nvtasfsrumx oot0aex  ieiys s2eau ont)aexoif3oy1oaDeli ol( texoir oy4ll e nvt tfs2taumpoo0apxoiociltlaDean s t4trxoir iadlpDeaivo s) exmirpno1alenmivt s aDumu  ou0optn octldfaDuluvs u0 etoxfcoatlpt livi;(  2xo(opio4lm  mneslt)srra( p;u1opeomfetyslm2rmnvo;u0texnxocootomtrau s (  2xoxo iy1omee fvtat  rrmu o;u1aex ii3tyd s2uau p;(0aetnmr ta1fa  an o;(  eumio oo1oltn fetat srrm(m no0altnioeiydfmDranmp t4altoir ty1opt lies;t)srxrir oo1ale lfvt sfsrra( p;o0apxoii3iasls rmnms t0trxrircoa1la   n s;s)teto(mpoudopeelnvs s)aDumum ou0alxoifeilsla2eauvsn(0aeeoirciodlat lu i (0t2xmir3nydaptnlivslt)aruaxr no4tlxnmo3tytfaDulnvsnu)tetoio3tydfa   uvo s trtoxo iudop elfes s  rrr(m nu4oex  ociyslaDemu pnt0trtrxo3ootom  lneo;t0 2uoim3io1lpt mnvi s) 2rrum nu1tlt mo3ildfm2uanmo;u)tltomr3oo1oa  aieo s t2uo(r3iu4lpenlivt t)s2tax pot0tlx mietas a rm(mp;t0aeerio tadlp e uesls  eur(m3nudop  lfeil(faruau oot1tpenmoetytfsDelnms;t)tlxomf3oa1la   ues s0 rxmxm io4lmt liviatf 2rmxront0aexo ieiadlsDeauvpn()trermfctydfp eaivols)srtoimpnudolen netat)srtmu poo4tlx ioctytlmDran o;t4 rtrmf3oadlatr nvolt srtr(r3io1al   neta()sDum(mpoo0ale moeiatls umnmsnu0aleomo oytoatrlivi;t0trur(o io4lm  liei t)srtrxm nu0alxnmoetytla2elumo (0 ltomf3iatop  an s;(  eumiopoo4am  lietlsf 2ra(r nt4ape if3iatfs2ra(mo;t0tetrmf to1lmt ai sls0 etrio oo4lmtnmnct s) Dtmumpnt0aptnioeiys s ranmo (4tlxrxocoadfp rlneil( srtmxopiudopt  nvia()srrr(r ou0texoifetat aDel( s (0aexoxociadfmtelieo;s  rur(o iodomtnmncils)arrm(mpnu4apxo iciad m umn o;t4tlxomr tydfp rluei ()trumio3nydam   nct ()a2rm(m no1aleo fctlt s ranmo u0 exomrctadfp r ieol() rxo(r3iydlpt lieta(f rtmurp;u1aeeomf3ias sDrmnvp t) rtnmf3iydfm rau ols)truoio oo1omenmfctls  rurx  no1opxo fetatlm ea( o;t0teerxfcty1lmDrlivol(  etmxr3iydom nmfcsatfsDrmxrpou1tet  octydfa rauvs t)alxriocoydoaDrlu s (0seur(o oydomtnlivsat) 2ta(mpno0ale iieiat s emnvp;() renxf iytfm   neo;(0s2to(o3iudalenmfct ()srrrx  ot0apeo o3iatfa emnvpnu)tetrio tydfa  aueils  exo(r3oo4amtnlfvsl()aDumxmp;o4ope if3ilsfa el(ms (0aeermf3oydfa  lnvs t0texm(m iy1lpee ivi () Dtrxm nt1apxomi3iydlm2rl(vo t4alerxfcoydfmt aivolt)teur(r3nu1optnmfvsasf 2rrxr nu0alxoif3iyslm2eaumo;() rtnmr3ia1faD an i s trtoxmpoy4amenlnvsas  ruaxrpno4teenif3tytfmDrlumpnu4 rtoxo oa1opt lnvi t0t2trirpiy1lpeelncsltfsDum(m nt1olxoif3iat aDemn sn(4artoio3tytfp eanes s t2xmimpno4omtelnvtl( a2tmurpot4tptnio3iyd m uluvo;u) lxnxf oy1la   u o (0tetrio3io1lpenlncil()sruau onu4olto octltlaDrlump u4texnmr3totom   ieo t)seur(r nodll nlfcil()a2um(ro;t4altn fctysfm2umn s;u)altomrcoatomtrlu ol()s2xrxopiydlpt  ieias a2rru pnu4tpeoii3iltfaDeln p (4 etoxf3oy1omt  ueils0t2tmxr3oo1oltnmiciltfaDrrx p;o0teeo fetasls2emnvpn(0tetrif3todomDrau olt  etoxrpnu1oleemnvilt)sruaumpot4ole ioetadfs um(vp;t0alxoir3tadfa   nes;t)seurxr3oo4ll nlfct () Dtm(r ou1oet ioctyd a2raumo;t0trxrmocoytfm  lnvil(0t2xrxr iy1lpte fesat)aDra(m ;u0opxomfcils m rlumsn()aeermo iotlp  aieo;t)trumxr nodamtnlnvsa()a2rm(m ;u1aptoiicilsfsDeln pnt)alxniociy1omDr i s t s2xoir oydame  ncslt artm( pot1alto ociytfm ua( pnu4 ltnmrcoy1opDraieo t0truoxmpoy4lpe  nctl(fs2rrxm ;u4altn fetad m2rmu p;u) rxrmo iadfa eluvs t teurir3nu4omen feslt  rrmx  ;u1oex  feiytla2uln pnu0trxnmo iydfpD  i i s) rxoxopoo1lmenlicta(fsDtmxronu4oexn i3iyd s2emnvp u)trxnxo3totom eli slt sexm(mpiu1lltemnctl()s2tr(m ;u0oetnmoctyt m emu o t0 lxomo iadoa r ivs s0seurxopnodape  ivtas) rtaumoou1oexo fcias sDrlump;()texrir oytlm  lu s;s0 2umimpnydal nmfvs tfs2trurp;u0aex iociyt m elnvo;()tltnxf3to1lp  ai i s0 rur(r3ou4llte netl(fsrrmumono4optomf3tyt aDum(mont4tlerxocoodlp rauvs;t)sexmimpnodomtnmfctlt)sDumx onu1ale  o3iat aDemn pnu0 ltnxf iydlate u o t  exo(opoy1ap e nvsa(fsDtr(mp;u0tetniociltfm rm(mo;t0altnmr io1op elivsls texo(mpoudap nlnciasf 2taum ;t1tpx mfeilsfmDul(vs;u0aleoxf3tydoptrlnvolt0t2toim iu4ole mfctl()artrumono1aexomfctld m emuvsnu4 rtrxrciotlmDrauei;(0s2um(r3ny1alenlfvi (  2ta(ront0oleoif3ilsfaDuln o u4aetnif todlp   uvo t)s2um(rpiudlm emivsat)a2taxmpnt0tetoif3iydfsDua( p;(4aexoxo io1fpt  n s;t0trxm(mpiudomtnmnes () Drmumoot4tleo ietydlm2ua( o u4alxoxo3tadfpt ln sl( teuoir3oy4lmtemncilsfa2urumono4tltomoeildla umn s;t4alxomrcoadom elueol(  exr(r oy1amt mnvt () rrm(m no4optn f3iltfaDumnvp u)artnir3oadfm  aieo s)trxrxm3nodlp   fctlt) rtmxmono0tex mo3tytls2eanvs u4aetnir ta1opDeln ol(  ruoio3io1lle lfci (fartrumpno4altnio3iytls2rmn s (0alerxo3ootop eluesl( s2tmiopiudomte ncsl()sDtm(rpnu1olxnii3iasfm ea(vs t4alenxr3oy1fp  aieolt0s2tmxr iu4lpee iesl(fsrum(  ot4oetomi3ias a umumo () lxrif oadop rlu s (0 2xmim nu1lpeemfes ( sDur(m ;t0aee moctldfa ranvs u)aeerxfcoadoptr uei;() exm(r ny1am nlivs t  Dumu p;t1oleoiiciadls2el(mo t0 ltnxocia1fpD auvsls0texoim3oydoleelfvsl( a2tm(mono0aet mictad m2umu s t4tetnmo oa1fmteau s;t sexmxr iudllee ncils arumumpoo0aexo fciasfmDrl(ms;u0arxrmf io1lp raueo t  2toim no4op e ncsl() rrax p;u0tpeoiociatlm2rlnvs u0arxrmrcoo1fa rlnei (  eum(mpnodoptnmneiasfaDurumonu0oeenmfetlt sDemn o;t4 ltoxo iatlat luei s  exrxopoy4am e netlsfa2um(r no0tpxn f3iys sDrluvp (4 exomr iotlpte i s (0s2trxr iudlmeemncs (  Drr(mooo4optnio3tltfsDuau s;(0 ltoxo io1faDrlnvsl( texrir nu1apeeliei (f rra( ont4aexomoeias s2elnvs u)tlxoxr3ootoa  aueols) rxo(r3nu1llte icilt  Duax  no1oet mfetls m2eanvon(0 ltnirctotlatranei;s0seto(o3oy1openmnvsls)srta( pou0tlen fcias mDea( s u) lxrif oo1la e ivo t  exoxr3no4am elfvi sf Dumxrooo1opx iictys s ea(mpn(0tlxrmrciotfp e u sls)sexoiopoy1lptemics tfa2rr(rp;o1tlx mfetasfs ulu s (4tetnmfcio1lpDrau o t)sruoxm oy1llt miei t) Dra(rooo0tlxoifciytlsDumnvonu0aexnxr3oatfa eai o;s s2trim3iodopenmnesat aDrau  nu0tpx  iciasfm rmnmo u) ltomo3oatfptrai ils) rxm(o3iy1al nmncslt)aDua(  ;u1tleoio3tlt a rl(vp u4artrxr iatomt  nvi (  2xoio ou1olt  nesat srtmxm no4tpxomictatfsDrl(vs t0 lermf3iy1fate nvols0sexrio nu1am   fetatf rurur nt0oee  fetaslm2rlnvont0trerxf3ootop eauvs s0teurimpiu1oltnlicsas aDtmu  oo4olxnmfctydlsDuanvon(0 leoio iytlat  n o;s)t2xm(o3ny1lm nmfeiat)aDum( o;u1alx iiciad sDra(vpnu)texrxo3tadlaDean s ( tetoxr3oudal n ncsl()aDrrurp;o4tleomo3tytla ulumo (0 eenif3tadoaD lieils0 rumimpiydomenmfvi ( srtr(mp;u1oexnmi3tydfa2eanmpnu0 eeoxr3oodomtr u ils0 euoxr3no4omenlnvtls)artm(moou4tetn ietysfsDumn p;(0alxnircootfptr i i;t) rtm(m oodllenmncilt)a2tm(moot4aetn oeiydlmDem(vs;(0treoio oodfaD  nei;s0 etoxm oo1lmee nvtls arumxrp;u1teenifeias m umu o;(0arermfcoodlpDe ivslt s2xrio3nu4opee fei t) 2urx ont4tlxniictysls2ua( pn()arerxrciydfaDeaneils) etoir io4op n nvslt  Dtrurpnu1olenioetyd sDelumo;t)artnxr iadlm raueols)trxm(o3no4optnmncilt aDtmx onu4olx mf3tysfa2eln sn()arenmr oodom rlueo;(0 rxm(o ou4lme  ici tf rrax  ;o0olx  fcils m2ulu pnu0aleoiociotlmDr ueo;(0srtriopny4lp  mici t s2rm(  oo0tptn oeiys a2umums t4texrir3iotlaDeli ils  eur(opiy4omenmncta()sDtmuro;t1teeo ieiat mDrlumo t)artoxf iydlaDr uvs t)s2xoxmpio4ll  mncsas)a2tau pnu4aleoif3tydfm rl( onu)texrxf oy1lp eliei s0 rtoio3no1lp elieta( sDum(mo;u1apxo fetatfsDuln sn(0 eerxr tydop rlneilt)teuo(o3iy1opeemnei t) rrr( ooo4tpx mi3iyt a rauvs ()tlxnmf3tadlpDeaieo t)texoxrpno4open fcta(  rtmxr oo0tet  i3iadfm2rmnvs u4tltoifcoadfptr u o s sexoio iydll nmnesa( a2raumpno0aee ii3ilslm2eauvpn(4alerir3oatoatranvi;s0 rxm(opou4op emivia(fa2tmurp;o4optnmoetltfmDul(ms () lxnxfctodlmDelnvo;t0t2xrir3oudaleelncta(fsDta(  ;o4optn iciltfa2emuvpn(0trxnif3iy1op  auei;s  etmio3iy1lpe lfeslsf Drrxrpou4tee  feiltfs uauvp u4 exrir tatlm e nes;s) euo(o iudalte fei s)aDumxmpnt1tlenif3iltfmDrlumpnu) ltomf iydfaD lnvs (  etr(opio1lmeemfcsls aruaur oo4optnmi3iatla um(monu)teenmrctydlptr i o;t sruriopnu1lmtelnetls  2rrur no1apxnmfeiysfa2ra(ms t4aetrxo todomte ies;t)texm(opiudopee iet tfsDtaurpou0ape ioeiatlsDra(mpn(4 ltoxfcoytla elnvs;(0 rtoxm3iy1am  lncia()sDur(mooo4olt io3iadfa2uauvp;(0trtnio3totfmt lnvi;( srxrxm iodol nmiet tf 2tr(  ;u4aex mo3tydls2eluvonu) renmf iatfmDean i;t) exoxm oy4omte netas) rrrumo;o1tpx mociasfm2rmn ont4treomr3iytoaDe ueols0teurxmpou1amt  neslt  rrr(r oo0tpx iietldls emuvs t)alxomo3oa1faDrli il(  eur(r oydlm nmfeia(  2rax pou4aexnioctys mDrl(vpnu)trerxrcoadomD luvi t) rxmxm oo4openlivt sf 2tr(mpou1oet mfcildfaDraumo;u0alxnxfcoadla elueo ( texrxopoydapee ncil(fs2uru p;o1opxomo3iadlsDeanmo u0trtrmo to1fa r n slt)seuoxm ny4lm e fvtas  Dtm( pot4opt  ieildlm rlnvpnu4aeenir oo1fpDelnei (0s2xrio3oudopeelfvtasf rurumpnu4aee mictls a umnmo;(0arerxrciodomDeanvslt0teuoxmpiudlltn fvsasfa2rr(mono0tet iociysls2em( on(4 eeoxf oydop e ivs ()tetmio3iy4ll  mfvsl( a2taumoot0opxn ociys s ra( o;t)aetoxf3tytfmD  n i (0 exm(m3nodale lies s) Dta( ont4teeomoeiydla ua(vo u0tlerir tytomDeauvilt0 eumxo oudam emieil(fsrtru oot1olenmo3ildfsDum( p;(4 ltnmfcoy1lpteaiesl() rtmir oodol   fet s) Duaxm ot1olx  octlt s ea(vs;u) eenxf iatfateluvi;s0srtm(m io4apt lieslsfsrrr( poo0openmfctltfsDran p t4tlerxo3oadfptr nvsl( srtmxr3oy4lmt mnvi s)a2tax  ;u4tptomf3iytlm rm( onu0teeoif3ta1fateau ils setmir io4ol  mfeil( sDtmum ;u0apenmfctldfsDuanmsnu0arxrxf oatoa r u s ()texo(m3io4ope lfesat)a2rm( ont0aptnioetad s rmnmonu0 rxoio tatop  lnvi;s  2uo(m iu1omeemnvt t) rraxroou0apx io3ildfm2um(vsnu)alxoxo3todlpt  nes t)texoim iu1lle mnetlt  Dtr(r ou0apx mfeiytfm um(vont4aexnmociytomDe uvolt)trtmim3ny4op  mncsl(  2ta(rpot4tltoiietys a um(mo t0alxrmf oydlaDean o;t t2uo(m3nudlpeelietasfsDrrx pnu0tpenmf3ias s ua(vsnu4 eenio3oo1lptr nei s s2trxo nodom  miciltfarrrxmo;t4tltniiciytfm2umn p;t4aetrmf oodlmDeln olt  etoxrpnodameemfvs s sDtaxmp;u0aee  fciatfmDul(mont) rerxo oo1omt aivs;s0 euo(m iu4aptemivia(f 2urxrpou1tltnifciatlm2ul( s;(4 exrmo3iatlp  ln ilt teumxo3no1opeelncta(fsDumx pot4openmoeildfa rmuvpnu) rtrxocty1fmD au o t)setrim3iu4lptemneias)srumxmo;o4apeoiiciydla umn o u4 lenmr todlp  lu slt0setr(m3oy1ameemfvt ( sDraxrpnu1aexnmi3tys aDem(mpnt0texoxrctadlm eaues;t0 euoimpiy4lmtnlfvtl() Dumxmpoo1olxo ictls s ulnms u)arxrifciatlmD au s;() 2tm(o3oo1lmee nvsl( a2rrurp;u1altnmociadlm2rmums ()arxomoctodlpD  nvils)tetoxo3nu1amenlieiat  rtruroot0apxomfetytfa2emumonu0arenmf ia1opDrln i ()setr(m iudapeemiciasfs2ua(mp;o1tetniieiytlsDeluvp;u0texnxo oodla   nvsls  rurxr no4llen ieia() Dtaumoou0tlenifciydfmDul( sn(0aetrxfctotomD ln sls seur(r ny4lmenlnesa(f 2tr(r ;o4alxo ociaslsDulu sn(0artniocty1oaDe ueilt  2xo(rpno1lpte fci ( a2urump;o4olxoii3iatfa2el(mp (4artnxr3ta1fmD  n o;s teuriopiy4lleelfcilsf 2tm(r ;t1ale ifeiltls2ranmont) ltomociy1fa e ivs;s seurxr3iudapeemfei () 2urx onu1tex mo3ildfmDrlumon(4 ltriocto1fpDr i o s0srumir nu1olt lnesl( sDtm( poo4optnifeiyt s emu o;u0arerxf iodlpt  n s t0srtmxrpiydole  fcsas  Dtau ooo4olt ioetas sDulump;t4aetoif oatopt lnvo;t srxo(r3nydomen nvtasfaDtmumpou4tee  f3iat s2uanmp t) lenmr3oytlp  lies;s0s2xr(mpnu4lpee fvta(fa2trumooo0tet  oetad m2ulnmsnt) ltnif3iodfmDr ues s  rurir nydlpen ici s arumu pnt1tpxnifeiydfs2el( sn() ltrifcta1lp r nvs t0 2tmiopnu1olenmfcils) rtm( pno1tle  fetltfm ra(mp;u)tltrir tatop  aueo t0srxo(o3nodlp   nvt ()a2ur(root1aleoioeias m rau p;() rxrifcootfm r ivolt  exoirpoy4lpeemnetas)sDrrxmo;u0altoifeiyt m2ea(ms ()tltrmr tydfaD  uvs;s)trtoxrpiy1aptnlieslt a2urxr ;t1tptn o3iad sDumump (4aetoxo tadoaDrlu olt  2trxopiodapt lics (faruru  nt4alxn oetys sDrmu p u0 lerxocoo1op rlnvo;t)srxo(o3oudlp  lnvils a2ra(  ot4oeeo i3iyslm2ran s;t0 lxoxo3iadopD  nvi;s)sexr(m3io1ope  fet ()s2umum oo4apxoiietysfa2ul(mpn(4 lxrxo3tydom  aneo t teurxo ou1llee ictltfs2ua(mpou1oetomicilsfsDelu p t4tltnir3to1lm   ivsl(0setoxr3oo1lmt lnei (faDtrxr oo4apeniictldlmDea( s u0trxrmo3oytfm  au ils)tetm(mpou1lpen fcilsfa2rm(ronu0opx  oetad a2elnms;u0altnircoatla r iei () rtoim3iudame mneia( s2tm( oou4texoioeiydlaDea(vo;(4 etoxo3ty1lp raivsls sexo(mpoy4omt  nvtat  Dumum ;u0oex iieiaslm2rlnmonu4tetoir3iodfateau sls t2tmxopnu4lm n netl(  rrau p;o1tee mf3tys a2rauvo;t0alxnxfcoydop   nvi;()trurxr3nydlpen neil( a2tmx onu0apto icilsfmDua(msnu4trtnxr3todfp e ivo s  eurirpoy4ll emnvsl(fsrtm(rono4alxo ieiysfs ranvsn(0 rxrmf3iotop r uesl(0 rxo(r3nu4ape lfcslsfa2raum ;u1tet  oetltla2ulumpnt)altrmr tydfm e i ol()srur(mpoy4ll   net s)srumumono0ope  fetat mDumnvsnu)altnir3iatoa   u o;s0 rtr(r io4ap elnctas  rua(  ;o0oeeoiieildls2emnvpn(4tleoxo3oytopD  u i;(0texm(rpnu4ol n fvs s)s2rm( pnu1alx  f3iat a em( pnt4 rermoctatomDrlies;s)t2um(m3iu1apte ietlsfsDrmxm nt4opeoioeild a2rlnvo (4 lermr3iatoptelnvols trxmio3nu4om elietlt srrru o;t0ale io3tldlmDel(vs u0arermo3tadfatrauvsl(  euriopny1altelnctatfa2ra(mo;t0apxnmoetytlm2rlu ont4alxrxoctodop eli ilt srxo(m3iy4lm  mfcsltfs2tmxmp;u1tle ifctys aDem(mp u4 eenxf oy1fmD  u ol(  2uoio3nodamtn fci t) rraxrp;o1texnmictyslm rau o t0altomf oa1oa r n i;t0 eurio oo1lp nmnct () Dumx pno4oee  ieils a ulu o;u0 renio3iotomtrln s;t tetr(o3oudom  mivil(  Dtrxrpou0tle if3tatla rmnmont0trtomo3ta1fmteau s s) 2toio3iu4lmtelfciat)srumum nt4tet  o3iysfs2ea(mo;t4 rxrmf oatlaDeluvs;(0texmimpny1lltelies t srta(  ot1apt iociysfmDrm(vs;u4 etomo iydlmDraues s0 2xm(o oy1amt  ivi s)srtr(  ;o1apxo fcias a elumo t0arerxf tydoaDeluvo t seurir io4amenmfesa(fa2uax  ou4opxn fctytfa ulnmo u0trxomo iatlate ieo;t0srtmxo3io4apee nviatfs2rr(  ;o0oeenmf3iysfs eau p t0 rtriocoodopD aueo () eum(r3nu1omtelnetltf rrax p;t0oleo ieildfa2emuvs t4 reoxocto1op   u sls)seur(opiu4ll e ict tfarrr(r ou1apt  ociytfsDumu snu)treomrciodfpteliei t  2uo(o nu4lmtnlivtat)aDta( pnu1oeeo fciat m2uanvsnt)alxnircoadlmtrlu o;s  2urxopnudlptn fvtasfsrururpnu0tltoioctas m2ulu o u)altrmr ootlmDe ivs s0seur(rpio1apenlncia() rururp;t0tetomf3tltlmDra(ms;u4texnmr3tadfmtr uvi ( srumxr3iudop nlfctas  2umxmo;t1oee  ocils sDeanvp (0trxrmo ootop eaieo ( t2urxm3oo1opt  nvtl() 2ur(ront0tetomi3iyslm rm(mo u4tltnifctydfaDr ueo;(0 exmxm3nudll nmicia( srua(m ou1ale mictls mDrmu snt4 lxrxo3iy1lm eaneo;(0sexoxopiu1lm nmnesls  Drm(rono1oeenmoetytlm2ul(ms ()aetnif tatlm rluvol()t2um(opou1ame  ics s a2rmum ou4tex ifciasfm2rm(ms t0alxrmo3iy1faD au s t)t2uoxmpiu1llee fcsls)s2rm(m ;t4optnmiciasfs ranmsnt)aleomfctotomDranvs s0seurxopoy1ll  mnetlt)s2tau oot4tetnmfcilsls rlnvpnt4tlermf3totlm e neol() 2trxm3nodamtemnviltfartaump;t0aleomoeiytfm rau s (4 exoifciadlatrai ilt  rxrir3oy1ol elnvtls arrmu p;t1aex if3iltfsDrl( s u4tlenxf3totoaDe uvslt) rto(m iydal nmfvtls) Dururpot4aex iociydfsDeanmsnt0teeomr oadlm  au s ( setoio3ny4lpenlnetas sDtm(rp;u4oltn ieiyd m2ea(vo t0trxrxo3iotla  lu s;s)t2urim3oy1lm  mfes ()aDtmu o;t0alxomfciydfaDumuvsnt0aleoxf3ia1omtrlies t0trxrim3oydlme lnei t sDrr(rpoo4olx ioctlsla ranms;(4arxrmf3iodlpD luei;s)t2xrxrpny4oleemiviltfaDrru pno4tlxomoctatlm eauvo;u4 eerirciatfmDr i s;t texmio3nodale lfesa(  Duax onu0tltnmieiaslm2emu snt0aeerif3ty1om eln s s0t2xmxrpno1omee ivsl( srrrx pnt0tptnioctas sDrmnmo u4tlxoxrcoytlp   iei;t)trtriopoo1aptnmfvsa() 2ua(  oo1aexoiictyt a ulnmp;(0trxrirctodfpDr nvs ()tetmir iy4apeelicias aDrmxm ou0aptniiciatfmDulumsnu0trerioctydfa raueo;(0s2xmxr io4lptn fvslt) rtmxr oo0ape iieias m ean snu)aeenxo iotfmDrlnvi;t  exo(opiy4oltelfvsat s2tm( onu0apenmfctadfm2um(mp u0teeoioctatoptranvi;(0trxmxo iydaleelnvi ( sDrruro;t1tee mieiasls rauvsn(0altomocoatop r u s ()srum(mpio1omenmfvs s) Drrxm ;t4tpe moeiatls2uanvpnu)tlxrmr3iy1omDe uvi;t0sexrxo3oo4al  mfei (f 2rmur ;o0tex ii3ildfs2ua(vo ()aeerif3ootfptelu slt s2xmirpiudom nmicsat)s2uaurono0tlen f3ilsfa2eanmonu4alenmfcio1fm eliei t0trxm(m nu4lltn fvslt  Dta(rono0oltn i3ilt s ea( s (4 rxrxf iy1la r uvolt0s2xmim3no1lme  fetl()sDtaumonu1aee io3iyt aDrm( pn()aexrir3oytoaDrluvs;t seumio io1ap emnvtat srtrumoou4aeto fcildls eanvo;(4alxrmf todlate ivo;s0 etoxr oodlmtnlfesat) rrm( p;u1aptnmoctlt a ea(mo;u)alxomr3tytoa e nei s t2umim nodomtemnvtls  rta(r oo1oeeo oetaslaDelump;t0 etoxo3tadfm  lnei;()sexmxm iu1omt lieiasf Duaur nu4aleniieiasla elnmsnu4teeoxf3io1oaDelnes;t)texrim no1al nmfcsat) Duaxmo;t1oleoio3iytfs eanvs t4 rtnmrciadom  au o;t  rurxo oodaptemnvsat)arrax ono4apt  o3iatfs emnvs;t)texnmf iytlmt liesl( trtoxr oodom  lfcsat)a2urumono4texomo3tatls2eanmpnu0teermr oa1fmtraueo s0texo(rpnu4lle mncilsfs2raumonu4aee  oeilsls2elu s u4 rtnxo3iatoateli slt t2xmio ou4omtemfvtas aDtrumpot4tpx  i3iydlmDrm( o;t0alxrmrcia1oateau ils s2uo(m3no4ape  ieils srtrx  ;o1apeomictls mDumnvp;(0teerifctytfmDran sl(  eur(r3iu1amen nctatf 2tmxrpno1tpxo fciydfa rauvpn(4 lermr3tydoaDe ues s0trurxo3oy4lmenlietlt)sDraumpno0aexnmociydlaDemnms (4alxrir io1laDran sls)setrxr io4altelietas a2umxrpoo4olxo fctatfaDelnvp;u)tlxoifciytfp rlivo;t  2trir ny4omt mfvi t) Drm(rooo4olto oetyslmDemu s;(0arxomfcty1fptraueol(0 2urxo3oo4omtelietl(fsDtmxmoou0apen o3iad a rlu o u0 rtrxf todoatran o t t2uo(r iudamt mfesa(f Duau poo0optomf3iasls eau on(0trtomrcoydfptelnvo;s0 2toxrpou1al  lnct ( srur(mo;t1opxn ociysls rmuvsn(4treoxr iatlmtrau ol(0s2xm(rpno1ll nmfvi (fsrtaurp;o1olxnmf3tad s2rlu s;u4 lxoircoy1faDraueols) rxmxm3oydop nmfeta()sDta(m ;t4alxomi3iytfa el(vo u) rerxo3oadlate nei () rtr(m iudomenlfctlt) 2tru  no0aetomf3taslm2emnvp;(0tltnxo3iotla  luvi s0srurimpny1lp n ivtlsfsrrax  nu1oee  f3ilslm eauvs t4tlenmfcoa1lp eaieslt)teumxr oodamtnlicilt) Drax p;o0olxoiociadlsDrm(vs;t4areoir3iotfmDrln olt srtr(r iu4lmtnlfes s)aDtrxmpoo1oeeomoetltlm emu o;u)tleoif oodlmDr nvo;( t2xm(o3nu4lmenlneias)a2umuro;u4apto feiltfa2rlnvp () eeoxf3oatfaDr n o (  exr(m3iudop n net s  Dur(m nu0opeo i3tad a2ua(mpnu) eerio oa1fat  nvi;(  etmim oy4amtnmnvtltfsrtrx pno0tpto i3iys sDum(vsnt) renxfcty1fpDrlu ils  rxmxm iy4ale lietlt arurx  ;u4olt ifcildlmDranmp t4aeenmfctodlpDelueo;() rxrxm iy4ap n nesatfa2umumpnu1olxnif3iydfa eln p t4trtnio ta1om eai o ( tetr(r3oydolen icta( a2ta(r ;o1tpeomi3tyt aDrmu p ()tetrirciotlpDr u i;t t2toiopou1lp nlnvt (farurx onu0tet  feiat sDea( o;u)tlenio3oo1lpteli s;t0texmio3nu1altnmici sf Dumu  ot0aptnii3tldla2rlnvs;()trtomr3tytlpDeanvils t2um(opio4omeelfes (  2raxrpou0texniietltls uanmo;u4trenif3tytlm e uvil()s2tm(o ny4op  mici () 2taxmpnt0opeomfeiadla2eanmpnu)teenmrcootfmD luei;t s2toxr oy4lp  lnei (fsrua( onu4oex  feiytlaDulnvont) lxrmrciy1latrlies;( trxmxo3ou1lmeemncsltfsrua(m ot1oexn ieiasfmDea( o;u) exoio totfateln s;t0trtmxr3ny4lmtn fvsls) Dumurono1olt mfciltla uluvo;t4arxrir3totom r uvs (  rxrimpio4oltn nctatf 2ta(r oo1tetnmo3iyd s em(ms;t0aetnio3oa1omtrlivi t)trtmxr3oodlle mnvi t)aDta(m no1oetnifetltlsDeanmo () rtoif totfp rln i (0 2xrir nu4lpe  fcil()s2taum ou0tetoio3ild s rl( s u0 etnxf3tadopDe nvilt) etrio nudapen ivilt)s2rmu onu0oeeoiiciyslaDemnvp;u)tlxnmo3tadop r u s;t seumxo3ny4ale lncils aDurx pou4altoifeils s2el(vo;u0 eenxf tadlmte ueol(0texrxm iudome lnei sfsrraum nu1aexn i3ildlm2eanvs;t0artoxrctadopDr neilt)s2xrimpnu4alt  nes ()a2ua(r nu4oetnif3tadla2eaump u4trtoxo todfp  anei s)teto(r ou4ope  ivtasfa2um(r nt4open fetys mDumump u)tlenio tytoaDeaneolt0t2ur(r3ou1optemnet tfaDtmx poo0altomictytlm2uaumo;t4trerirciytfmtr uvil(0 2umim io1lltelfvs (  rrr( onu0aeeniieiltlsDel( o u4tetrxoctodfp  aiesl(0trtrir3ny4lp emicsls aDrr(  oo4teeoif3iyt s umn on()areomf ta1fpDe nvi (  eto(r3iudop  mfeia(fsDraumpnu1tlx moctys sDulumo t)tltomocoo1oat li i ( s2umxmpoy4ll   ivs sfartru pou1olx mi3iysls2rluvo;t0 lerir io1fm r ies s)setrirpiydamt  feia( arrmxr oo1oet if3ilsfmDrln p;u)artrmrcoadfmtelies;()t2uoxm nydom elncsl(  2uaxr nt0apxnmfeils s ranvp t4areoxfcty1lat lnvs;s0setoir ou1lptelfvi ()aDra( p;t1opxn fetat a ulnms t4 exoxo oatopDranvs s t2toim3ou4lmte iet t aDrmur ;t0alt iietlsfm elnvpnu)artriocoytfpt an s t0trur(o nodlm n neilt  Drrxrpnu4apto o3iltlaDrlumsnt4 exrxo iytfat li s s  2tr(o oodap nlici sfsDra( pno1oexnmi3iysfsDemumont4artrxocia1fptrau i t)srxmxm ou4altelivilt) Dta(rpno0apto ociltfaDrl(mo;(4 exrxo3oa1lmDrlnvi ( t2uo(rpio4ap emfvi ( s2ur(r ;o1aptnmfciyslaDeanvs u)aetrir3tadoatr u s ()trxoio3ou1aptn netlt) rrrurpnu0tpto f3tltfaDra( o;(4artrircoadfaDeauvolt0srtr(m iy1optn nctat a2rmu  ou0oltoii3iytls2eau p t4teeoxr tatlate uvo;t t2xrirpoo4ap  mivsl()srtaxm ou1teeo o3iatfm rau pn(0tltoxo ty1omDeau s;() 2uoim oo1olt  fetas  rrrumpot1opxomieiat a rlnmp t0tlxoirctadlmD au o ( t2urxo io1omee fei t)a2tmx  ou1alen feilsfa2uau pnu4tlxniociadfaD an s;s0t2uoxr3iy1al  mfvias aDua( o;o4aptn oeiytfm rlnmsn(0tlerio totopDeauei;s)teur(mpiu1alenlneta() rta(rpou0opxniietat m2emn s;t0areomocoy1lm  auvo s)tetrxr3nu4opte fet (fartmurpno4tetoifcilsfs2ran p;()trtnifcia1omDe ieil(0 etrim oodomeemfes (f 2um(rpno0apto ictasfsDumnvpnt) 
\ No newline at end of file
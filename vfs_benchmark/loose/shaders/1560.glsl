@@ -0,0 +1 @@
+nvsls)srxmxr3no1llt lncs (  2rru pno4opto oetysfa2el(vo u) exnxf3iodomteauvol( seur(o no4omeemfei s aruaxm ;o4aee ioeias m uln p t)tlenif iatoa eaivs;t0seur(m3oo4amt licsl()sDtau oot0alxomociydls2emn s;()tltnxr ta1lp e nesls t2xoxm3iy4al  lfctat s2uru pnu1optomiciatlaDulumo;(4artnxr io1fatr nesls)seur(o3iodome  neil()sDur(  ot1tpeoiociaslmDemn o t)arxnxocty1lpD  uei;t  etrxm io1alee ieta(faDum(mpnt1oleomieildfs2elnmsnu4trxnircoytlpteaieslt srxmxopnu1optemiviat  2urxr no1aptn ictydls2rl(vo;t)aetnmfctadfmDe nvi () eto(r3nu4aleemivias  2raxm ou4olxo iciys sDrl(mpnt) exniocta1optr i i;s0t2toxo3no1amte ies (faDtmu pou4opt  fciat m umu s;t)trenmf oadfm rai ols texmxo3oo4am elfcs (fs2ua(r nu0ope mfetlt s2rm( p;t0 exrmo oo1fp e i i;t tetmxopou1lltnmfctlt)aDtr(rp;t1aleniieiltls2elu s t)trtnmr3tadfatelnvils0t2uo(opiu4lltnlici (faDurumonu4alt  o3tadlmDrl(ms u) exoxrcootopt  ueo;( trxoiopiudlmt  icsls)arrmx onu4apenmi3iat m2um(mo;t0altrmf oy1fatrlu s;() ruoxr3nu4lm  mnei s  Drm(mp;t4tpen f3tatlaDrlnvs t4aetoio3ia1fptelieil() ruoirpoo1ol nmiei (f rtr(rpoo0tpeo ieiasfm2ran s t0 ltomr3iy1fm r n i ()t2uo(r oydalte fei sfa2rmxmono0optomoeiydls2elu p t) eenmo3iotfpt aieolt srumxo3oy4lp   ietlsf rtm(r nu0apen i3tld s rau s (0arenmr oatlpt luvs;s0tetm(opnodoltnmfcslt  rum(mont0tetn oeilsfm rm( o u) lxrmrciydlaDelivi () ruriopnu4ope mfcs tfaDum(mo;t1apxomoeiys a2uau o;t4 lxrmo3tydopDran o (  rtm(m3iu4lltn fei s) 2uax  ;u0oexomoeild m elnmpnt0texnxocoodlpD aivs;s) eum(r ny1ap   nvia( arrau  ;u4apeomfeiasla2ua(vs (4arenxr3totopDrlu s;()srtr(rpno4alenmicsas sDtrxront4oeen i3iltls2el( ont0 lenio ia1lat  uvol()trxo(m ny4ol nlicsasfaruax ont1tpx  f3iysfm2umnvsnu)trxoifcoytfaDrli i t)teuoxm iu1ol   nvsa( a2rr(mp;o4texoii3iad m emump;()tetomr3totop eaneo ( teurimpny1omee ici ( sDumu o;u0aeen o3iydlsDea(msn(0 rxoxo to1oaD li o;s0trxm(r oydape lfviltfs2um(mpno0ole io3iat s eln o t0tleoir tadlmDeai i s0sexoxopoo1lmenmfcil(faDraxro;o1oet  fetatfsDra( o u0trxoir3oa1lmteli o (0s2urxopiu4lp n fvt (  rtr(r ou1tlt  ietas aDel(msnt0arxrif3tatoptr uvo;() rxoxo3iydamenmies s sDua(r ;u0olxo f3iatfa uaumo u4artnmociy1fm raies s)srtoio3io4ap  mieia()a2rrxmpou1apt mi3ildfaDumuvs (0trxnxo iydlatr ueo s)t2umim3ou4alenlnesltfsrtmxmpoo4oeenmieiat a2em(vsn(4texrmr to1lm r i o;(  2to(r nudope lneil( sDurx o;o0oeenmoeiysla2rmumo u0 ltrmr3iy1fm raivs;( trxrxr nodlltnmnet s)aDtmum oo4alxnmicildlmDranmp t4tltrir3oa1oatr nes (0t2xr(o nu1ol n netls sDta(mpot0apxomicilt m2ua(mo;t0 rermo totlaDrauvs;() rxr(m3oydapt mfvsa()srumu p;u0tltn ietls s ea(mo;(0 rtrxr3to1la  luvs;s0 eur(o oy4lp  liei tfsrumx ono0ape  i3iysfa2ea( o;(4 rtnmrctytfp rlueo s0 2tr(mpiodlm  mncilsfartmxr ot0tetn oetytfa rlnvp t0 rtoxf3oodlpD ln i ( srxrir iodlpt lnvi ( a2ur(r no0alx  ocildfaDrmnvsnu4trtoio oadfmDrlnvs () 2ur(rpiy4lp n netat  rtrur ;t4apx iictldlsDuan p;u4tlenxo oadfpDean i t)trtrxmpny4om  liciasf 2rm(r ;o0tle mo3tld m2uanmpnu4tltoxf3oy1oatrlnvols sexoir3oy1aleemfesasfartm(r oo4tex  fctat aDrm( sn()alxoxoctatla ean s s s2uoirpiy4alenmfvsls)s2ta( oou0oetn ictasfaDulnvo t)aetoio3tatla raies t)tetmxo3oy1ll elnctltfsDurxm oo1oetoifeilsla uau s;()aexoio3oydop  liei;s)srxmir3oo1lmenlnctl(faDtm(m ;u1oexoifciyd m rmn p;u4 lxrmr ty1opteau s;s0sruo(o3iu4al  mfciltfaDrauro;u1tex  o3ilt sDrm( pn()areomrcto1fa  an o;s0teumxo oo1lm e neil()srurx o;u4alto i3iyslm rl(von(0aeerxf oa1omD  nvo ()trtmxmpoo1altn ies t s2uaumo;o4tet mocild m2ul(von(4arxniociy1omD luvil(0srum(r3oydlpe mnvs s aruau ooo4tlt iiciltfa2um(mo t) exnir3iodfaDr ues t) 2tmim iy4lpte nesas sDurxrp;u4olx mi3iysfs rl(mo ()altrxrcoadlmDr n s;t0trtrxmpio1alte ics ()arta(rp;o1oexo oeiadfs2ea(vs t0 rtnir totlmte i ilt)seurxo3io1ol nlfvil() Drmxr ;t4teto octadla uaumo (0tltnxr3totlatrliei s tetr(r3iy4aptelfvtl( srua( oot1alxn f3tytfs2rmn s t0 lxrxf3iy1faDean olt0trtoxopny4amtelivs (f Dtrx  ou4tpeniietlsls2elnvp;t0arerxo3totoa elies;t) eum(m3iodll n fetls  rrrxmp;o0oet ioctydfs2uanmont) ltnxo3oadfa e ivo;t0 2trxm iudoltn ictasfsrrmuro;u1opxnifeiysfmDuauvo;u4arxomrcia1oatr ivo t)sexr(opoy1am  lfesasf rta(  ou4opx ifeiydfa rmu onu0 exnmr3todoa r n s;t0s2uriopoudllt mfvi s)srurxm ou1aee mi3tlsls rl(vont4aetomo3iy1faD au o;t0sruo(m3iu1ame lies t)s2umum no4aetnifetytlm2uauvont4tlermo3tytlpt auvi ( trtmir ny4aptnlnvslt s2uru  ;o0tlt  oeiytlm2ea(mpn(0 eerxo iadlptrlues;()trxr(r3iydoptemivsas)artmx pno0alx  f3iys aDelu s;t)trtnxo totoat lu ols trtr(m3io1ale lietatfa2rmx pnu0altniietltlmDemu o;(0 eerxrcootlaDeai sl()sruo(m oudlp  liesl( a2tru p;t0tptomo3tasfmDra(mpn(0trtnio3oytoat luei;s0 2triopnodal n ieias)s2trxm ;u4ope io3ils aDelnms;()texomo3tadop   ivi;t  exoio3oodom n fviat  rtau ono0alx  ictls s em(vpn()aleomrciotopt  n i t0 2tm(m3oodlltn fvt ( srrrx  ou0aptomf3tytfaDulumo;t4arxrxrctadomteau o (  etmxmpoydaptnmncta(farrrx pnt1oet ifeiad aDelums;t) etrmf3tatfpDeluvs;s0t2um(o oo4om e ncs (f Dumum ot0aetn o3tlsfm2elu s t4texrxfcoatfmDrauvo t0t2ur(m oy1oltnlfctatfs2trurpno0aptoif3iadlaDumuvp;u0altrir tytlp rlivols0t2xrxm oudaltemfviat arra(m no4tetnif3iys s rm(mp u)arxrmo iytlpDe uesls srxo(rpiydapt lnvs tf Duaxm no1tpxoifciadls rmn o;t4artoif oadlat lnes;s trumim ny1lp  mfvt s aruaur oo1ape mi3tld m2ra(mo (0tlxriociytlp   nvols0 2urxo io4lltelnet () rtax  nt1ape ifetydfs ul(msnu0 exnxo3tydlpt auvo;t0 rxoio3iy4llt  fesltfs2tmumpou4tpx mieils a2rlnmp;t4trenxf iy1oa rlivs ()s2xo(m oy1om  mfetatfsDua(rono4altn feildfm2umnvs;u)artrxf oydlmD anvs;s  rtr(r ou4opt  netasf 2ururooo1aleomoeildlm2rl(vp;t4artnxf3io1fmDeaieolt)sruo(r nodamtnlnes t aruaurooo4tlt  feiltlmDuluvont) etrif io1fatrau s;()texr(rpny4om  lics sfsDua( oot1tpeomociat a2em(vp;t) lerxr oadfpD  n s;()srtrxo iudamte ictatfs2tm(rp;u1oltn fetad aDel( s;u0 lxrif iy1opDeau sls0 exoir nudam emivt t)a2uru  ou0tpxo oetys a2umn sn(0 leomr oy1fmte ieo ()setr(r3nudoleemivt t  2ur( pnt0ape ifeiytfs ranmo t)alenmf3oa1lmte i sls)teuoxr3oo4llte fvtltfs2rm(  oo0olt ii3iytfa2uln p;() eenio tydlaDrau s;t)s2tmxr3no4olt  ics ()a2rmum ;u0alxoiieiasfaDum(mpnu0trtrxf3io1lmtr i o s)s2xoxopou1lle lics () rrmx  no1oee  o3iydfsDrlnvo u)areoxf oydfmtraiei;(0teum(o nu1olee fctasf ruau oot1opxnmfeiyd mDuan p;t4alerxo3oytopteaiei t0srtrio io1lptnlncsat) 2rmu  ou0optn ocils m rluvp;u0altnmo3tatoa  lues;s0 eurxm3oydom elnes (fsDum(rpno0alt ii3iltls elump;(0tetrxf3io1fp rluvs;(  exr(o3nodol e feil(fsDtrxrp;o4tlxomictlsls rl(ms u0 ltrmrciadlpDe ues;( s2xoio3iy4am emietl()arrrxr ;t4altoiietltfm uaumont0alerxo oatfa   ivs t0trtmxr iu4amenmiviltfsrtmxrpno1apx mo3tydfaDrln snu0 rtrifctatlm  livi t0srxmxo no1omt  nvias)a2ua( ooo0aptomfctltlsDuaumpn(0tetoxo3oatop rlivo s)trtm(o3iu1opt  nvtlt a2ur( ooo4opxn fctytls2uln s u)aexnmo iadoaD an o;(0truoimpou4llt lictatfsrrrx pou0tpeoiociatfsDel(mp (4arerif3totfp rlieo t) 2xrxrpoy4lleemivia()sDrax ont4apxomfctld aDulnvpnt) ltnmr iotlm rlivs;t0 2urio iodlpee nci t a2uaxrpnt0apto o3iysfa2rlnmont)texrxo ia1omt  nvs;t0seuoir3iodamenmictl() ruax ont0tpx ii3iltls2rl(ms;(0altoxr3iytlpt lnvs;t0t2umio3nu1omte ieiltfsrta(ront0apen i3iydfm2ranmsnt4tlenif3totfmtr uvi s0 etm(o3no4lpen fvslt)s2ua(m ot1tet  o3iytls2ulump t4tlxnmo3oa1fptr nvolt trtoxm iy4lmenlivt (  2rr(monu0oeen fciytlmDean o;u) eeoxr iydfpDr ueolt)t2xo(rpoydapt lictas sDum( p;u0tpe  ictysla ul( p t0trxnxfctatfp rlneil( teto(r3oodam e fcta( a2ta(r ;t0apx  o3tysfm rm(vo;t)trtriocoy1lmDr ivs;t0sexmimpoo4opt mnetatf 2umxmp;t4texoif3iatfa eanmp;u4teerio3iydfp elues;t0srxoimpoy1omen fetas) rumurpot1oleo fcilsfa2elumo t4 rxrmf iatfm  an ilt0s2xoxrpno1al elfviatfaDtr(rpnt1tlxn o3iysfmDua(msnt0 ltoio3tytlatelu s;(  exmim oodom elivs tfarua(rp;o1apenmociytlaDrluvp;()artrifcootfmt  n s (0 rxm(rpio1apenlieils) Drmu pot4opx mi3tas m2rauvp t0 rtnmr3todfmDeau o (  2urxm oo1lmte iet (farra( p;t0oleoifeild aDumuvsnt0 ltoif3iatom r i i s t2umimpiudlle lncs t) Drr( p;u4oexn i3iasfm uaump () exomo iy1faD luei;s)tetr(rpno4alt  neils  rtm(mono1apxniociat sDrl(ms;t4areomf iy1la  lneilt0 eum(opoy4lleelneia( a2taxm ;t1ale iieilsfsDulnmpnu4aleoxo ia1op r nvi ()s2ur(o3oy1aleelictl() Dumum ot4apxnmictltls uanmo t) ltoxf tydlatr u slt srxoxrpno4ome livtat aDtrumoou1oltn iciadfm2ul( s u0 leoxo tydfm eli o t t2urxo iydlmtn nctat)aDra(ront1tpxoioeilsfa eauvp u) exrmf3oa1lpDrau o s) 2tmxmpiy4ol n fct ()sDtmurpot0apxn f3iadfs2ea(vp (4arerxo oytlpt anvs;( s2xrxr no1omt  feia()srrau  ou4apxomf3iys s2ranvpn()alxnmo3ootlmtrau o;s0s2uo(m oydaltnmnvia()arur(rpno0ale if3iad m ra(vo t4 lermf iydfmDelivilt0s2ur(rpiu4omen neilsfsrtaxr no1oleomiciysfs ea(mpn() lxnmocoodfm ranvi;(  2xoir iodllt mici t)aDtmurpnu4tpe moeildfm2rluvp ()trerif iy1lmD aivs () etmim io1ll n icta()arumu  ot0oeenio3tydlsDrau onu) exnmociotom  lnvi s)s2umirpnodll  mfcta(fsDrax poo0teeoiiciltfm umuvp u0arxrir tytom r uvo t0s2uo(rpiydom emiet (fs2tmxmo;u1apeomf3iad s el( pn()trermr iatoaDraivil(0s2uo(r3oo1omte fvi tf rumur ou1oleoif3ias s ea(vs (0 rxrmr3oydlp  ln o;s  eumxo nu4ol  livtlt)aDraxm ;t1tlto ictltlm rauvp;u0 exnif3iy1laDrlnei;t)s2uoio nudaptnmivt ()srtrumpnu1aexnio3tytls2eauvo;t0 ltnmoctatomte iei t  2um(mpou4lpt lfvt s)aDua(ront0ope mfeiatla ulnms;u4areoif3todfmDeaivo;s) rumiopou4oltnmivta(f 2tmumonu1alto iciadfm umumpnt4 leoxo tytoaDr nvs;s0srtmimpny4lle  icilsfaDum(  ou1opt iieilsfa2el(mp t0aexnxr ia1lmDr nesl(  rxrxr oy1llt  netas aruaxmp;o4texnio3iys aDuanvpnt) lerir3tydomDr uei;s) rxrir3oy4am e ncs (fsrraum ;u4oleoiieiatfs umn p;t) etrmf ty1fpDean s ()teuoimpio4ll nmnci t) rur(  nu4alen oetat sDrm(mp;() etoirctodoat lnvils s2uoio3iu4aptelieils arraxmo;u4aeen i3iadlmDemn s;u)alxoxr3io1lat aueils)t2xmim3iodlp   fcias) ruaxr nu1teen ociydfa2uau o;t)artrifcto1oa   neil()teum(rpiydap   nviasfsrtr( o;t1oet miciadla uan s t)alxrir3oo1omDrlivo;s0t2to(r3oo1llt lfetas) rrrx  ;t0tpe io3tadls2uaums;(0teeomo totlatraueslt) etrim oo1alenlnct s) rtm( ooo1tlxo iciltfa2umumpnu0aexrmfcty1fp eai s ( srxmiopiy1om nlicsatf rum(mo;o1alt if3iadlmDulnmsn(4alxnirciadfp elnes s) ruoxo iy1olenlnctas aDur( o;u4oexn i3tytlm2ua(vs (0tlxoircoa1fpDr uei;s0sruoiopiu1llenmncilt  2umx pno4tpx ioeiydfs umnvpnu0 etnio3iytopt  u s ( tetmirpoy1optelfvt sfsDrmum ;u0aexoifeiyd a2elnvo ()aetrif tydlptrai sls s2trirpoy4altnmicil(f Drru pou4tpxnii3iltla eauvs u4 etomoctotom rauvo ( srxmxo iy1am nmivsat srumxroou4aeen f3ias m eaumpnt0aleoxrctatfa rlnvs;t)srxoim3no1lpe  ivtatfa2taurooo1alx mfctat a2eau s;(4tltnio iodomDe n sl(0trtmim oo4apenmfeil(faDrrxr nt1tlxo i3iltlm2rmumo u)aetomf3ta1op elnvilt  2toim3ny4op nlnvslt aDrmx poo0apeomi3iltfs2ua(vp;u)tltomr oydla  an ols srxoir nydamenmnvi tfaDtauro;u0oeeoio3iytfs ra( s u0aeenio iytlaD lies;t) rtmxm3oudamen fcilsfarta(rono1aetnmoetadlm umnvs u0 eeoxoctotlm rli i;s)srxoim iy4optemnet s) Dtau  no0oexnifeiydlm ea(vo u0aeeriociydoaD lu s t0t2trxrpiu4ap  mfvs t) ruaum oo0tle  ictyslaDel( pnt4trtomocio1fa r ies (0 rxrim3oo1ame lieia(  2raumpno1optniocilt a rl(mo u) rxrxfciodomD aivsls) 2xoio3oodlmt mfvtl(fartmu o;o0aet  f3iytlm2rlumo t0 leriocoa1fm eauvo;()srxoxo3oo1ll n net t sDrm( o;t4tpx  iciys m2rmu on()altnxr tatoat aivs ()sexmxm iydam   fvia(  Dum(rpot0olx moeiyd a2emn sn(0tetnif tydfp   i ilt)seuo(m3oydal  mneta( sDtmxr ;o4oeen fciadfs uan onu0trxrxo ootfa  aivols0 rurim nudlltemncs t)sDtmum ;t4aptomf3tlsfs uauvs;u)tlxoio ootfm  lneolt  2xrimpiudlp  lfctls)aDua(rp;o4alx mieilslsDran o (4aeenxr oadoateanvs;t)seurxm iu1ll nmnetlt) Duru  ou0opxomi3ias a emnvo u0 rtrif3totfpt lnvi;t0truoio no1lm   fciat  2tmxro;u4tee iociltla el(mo;t4aexrir ootop   ueslt)trxo(opoudlmen ics s s2raxmont4tltn i3tysfa rl( s;(4tltoir3oadlaDe iesls0 etoio3oydol emici t)sDrauronu1oeenifeildls2uln p (4arerxfciydomD ln i;t srxrxm3nu4ll nlfcsl(f rua(  ;t4teenii3ils m el( o;(4 etomo3ta1fmDrlueo t trto(mpoudaltnlnci sfa2rrx  ;u1olenmi3tatfa2em(mp t) etoxf3tadlaD an o;()seto(m io4lpenlfes (fsDur(rp;o0olt iieiasfs emumpnt) etrif3tydfm  ai sls0 exrio ou4opee fesl()s2urx oou1aeeniietydlm em(mo;u4teeoxf3iytfmDe nei ()srxr(m iydame mfvsl(fa2rmxmpou4tltn oeiltlaDumnmp;u)artnxrcoy1omtean s;( setrxrpou1omtn nctls)aDtmu oot1teenii3iat a emuvs t4aexrxrcoy1oa  li s () exmimpio1ame lfvi tf Dumxr ou4oetnmf3tlsfs2rm(mpn(0tetnif tytlmtrluvsls0 rtmxrpoo4opee nesl(fa2trxr nt1tpt mfciadls rlnms;t4 eerxf oydopDr uvs;s0t2xrir oy4am nmfet tfs2trx ont4alt  oeiatlaDemnvo ()trtoxrcoy1omtrlivsl()srumirpnudal elncsl()sDrmuronu1texn oeiatfs umuvs;()alxrmf3ootom  lnvilt  eurir3nudomt  net t srrmx p;o0apx iiciadls ea(vs;(4trtnioctydlpD li o s  2xmxrpnodlltn ivil(farrrum ;u0oee  iciasls ean p t4tetoxfcoytla eluvs;() eumim3no1ap e neiat)arrrxront4tpeomfeiytls2uauvs;(0altrxr3tytlaDrlnes t0 2tmiopoy1lle mfciatfaDrrxmo;u4oltnifctatfaDra( p;u4 lerio oo1omDrauvslt  euoxrpoydol n nvt s)s2trurpnu4olen f3iadlmDrl(mo (0trxrmf3iadlmt livs;t)texoxr3nodaltemnvs ( a2rrxmo;t1opeomfeilt a2um(vs u)trerxf tydfa r ivo (0t2xmirpiy1apenmncia( s2uauroou1tlxomicils a2rln p;(4trtomfciotlpDeai slt)srxrxmpoydam nmictlt)sDuax p;t1ape mo3tls mDumuvo u) ltoir iotfmtrli s;s0seur(m no4om n iviltfaDtmu  ;u0tetnmieiaslaDelu o t0 etrioctatom rlues ( tetr(r3oudomtemnvi s)srum( oou4tpenifetad aDem( o t4teenirctotopD  ieo;()trumirpoy4omt  feilt s2tm(mo;u1tlx  ietld m eanmo ()trtrmf iatla r ieols0 2toxm nudalen ictat) Dtrxmo;u1opeomocildla ulumpnu)tlxoio ty1fptr ivo s0setmxo3nu4lptnlivtl(fsrtmump;o0aet mi3iytfmDumn snu4aexnxrcty1fa r ivolt)teum(m3oy4om nlietltfsDua(  oo1tltoif3iytlm2eaums u4 eeoifctatlmDe nes s trxmio nodomeelicsl(fartmxmoou1alenmfetlsfs2ranmsnt4arerir ty1faDeauvolt) rurxo3nu4lm emnvt (f Dumu p;u1opxniieiysfsDum(mo t0altrir todfmt anvilt)s2tmirpiu4ll elivilsf rtmumont4tptnii3iysfaDul( p ()tltriociatlatraiei ( srtoim nydopte netlt s2ra( o;u0tet  oeiasfa umump;(4aeenif3ty1la eaivs;t t2toxm no4ame  ivs sf rtr(rp;u4optoifetasfa2umn o t0aexnif oydop  auvols0s2um(opny1lmtnmivtls) Dua(mpoo4aeeomf3iat aDumnvo;()aetnxf3iodfpt aneils)t2urirpoodlle lfcsasf rurxr nt0opxomfciltla2umnvsnt4aetoxo3oy1lm rliei t0seumxr3oo4llt  ivtas aDraxrpnu1tlenioeils s2ul(mpnt4aeerio3iodfp  luei ()texm(o ou4oltemivi s arta(rpnu0tpt  feias s2ulu o;t4trxomf3oadfate u slt0 exoxopio1ameelfvsa()srtrx ont1apxnioctatls emuvont0 rxoxo oydlmDelueo;t  2ur(r iy1optn ieil()a2raxmpnu1apxnmocils s2eluvp;(0aexnxr3todlaDr n o t seumxm iudalte ncs s)s2tr( p;u0olx ifciysfa2umnvo;u0 rerirctytlatrai o s)sruo(m3ou1alte nciltfs2ra(  nu0olx ifeiat m rlnms (0 eenxo iatomt  iesls)t2ur(o iudllte nei (  rrmx ooo0optomi3ilsfs2eln o;u) lxnir oo1om elnvs;s)trxoim iudlmt  icil( a2rmxm oo4ope  i3iyt aDea( snu)texnmr iatlpDeluvil( srxrxo nu4ome lneslt  rrmu oot4olxomoetatla2em(vo t)arxrxfciydfmt an ol( sruo(r io4lmeemnvtat)s2trx o;t1alen feils s rlumsn() etnif iydlatr iesls0trxmiopio1op emncs t) Dtr( ont1oeeoioetatlmDeanvp;(0aexoxf3iodfmtr nes s0 2tmim oo4ll emnctat aDrrxm ;o1aee ioeiadfsDelumo;u4aeeomo3todoa rauvs (0trto(mpoy4lptnlfvtasfsDua( o;u4opxomfciydfm2ra(mont4 ltrxr tatopDeaueo t0srxm(m iudlp  mnvslt) 2ua(m ot1tlxoii3tlsfaDeanvo;t) eermfctydlmDeai i (0s2tmimpnodaptnmici ()s2tmumpoo4tetomi3iysla rm(vo;t0tetrio oytfp   u ilt t2toxopou4ll elneil(  2ta(mpnt0apxn i3iydfs eanvs;t4arxrmo iydom r uvols0 2tmxrpio1omeemnci t)srurxmpot1aex mo3iyd m2ua(von()trxrmr3tytlpDeln o;s0 exm(m oo1optelfeiasfaDtm(mpou4opxo o3iltfa el(vs;u4aeeriocoa1om eaivi;t seumxrpoy4amen fciat aDta(roou4tlxn f3tld sDea(vs u) rtnxo iy1faDrai s;t) exrxm3iy1lltnlnvs (fa2uaur nt4tpto ictytfa2ua(vo;t4teerir tatlmDr uvs t)s2umxm iy4lleemfcsa()artau  ;t0tleo i3iytfm eau p t0 lxnmocoodomtraneols0s2uoir nudopt  fci t) Dra(m nu4alx mi3iysfs emu p t)aeerxoctotoaD lnvo t sruo(o3iu4oleelfciat) rrm(  nu4olt moeiltls2ra(ms;(4artrifctodfpDr ivo s)s2uoxopoy1ol elfvt tf Dtru ono0ale  feiys m2uanvs;() eeoio iotop   n o;t srurxr3nydlmt lfviasf 2rr( pou0aeenifciasfmDeanvp t4arenxo3todlpD ai s (0s2xmir oodom nmfesatfarrmx  nu1apeoioeiydfa rm(ms u0 etrif iatla r nes;( trxr(o io4oltnlivia() Drr(m ;o1tetn ietydfm2ul(vs u0 rtrio3iodoatrlnvo t)t2toxo3io4olt  fcias  Dtru pou4tlxo fctatfa rln s t0aeenxrcto1om   nesl() rxr(mpou1lmeemfeil(faDrmur ou1apt mo3ild a rlump;(0teenxf oy1lp rln o;(0teto(o nodamtnlfeilt) rrr(rono1open fciad m2elums u0aetrmrciadlmtrlivi;t0s2to(m nudaptn fvs s) 2tru pnt0tpxo feiytfaDelums ()arxnmf iatfmDr ivi t)srxrio3nu1amee ivs () rum(m ;u0oexoioeilsfm2ra(vs (0aexoirciadlmte n ol(0srtmxo3ny1alen ivta(fsrtaxmp;o4tptnmfeiyt a2ua(mp;(0tetnxr oa1lpt lieil()sruoio iydalenmnciltfsDta(  nu4optn fciaslsDulu s () ltnio oatfpDrlnei t)t2urxm ny1om n nci tfa2rr(ro;t0opxomo3tydfs rauvo u0 rtnmr3iotlaDeluvsls  rur(rpio1ale lnvtl(f rraump;u0ole ifctydfsDra(vo;t) lenmoctytfpD luvi;(0 euoxr3iodlpenlfetltfaDrm( p;o1altoiiciatla uanvo (0 rxnmfciydoa eluvsls)srxoxr iu1ame  fvt sfarrm(mp;t1altnmo3taslaDrmn s;t)tleomo oy1lmDrai ols0trtm(o oodop nmiviatfs2rrxmp;t4aetoifeiasfa umumont0aexoif3tytla ean o;t0setm(r3iudlp n iet sfsDrrx ono1apt mi3tad aDrlnvo (0aexrmo3ootfmD  uvi ()sexm(o3ny1am  mnesat a2tr(ro;t4tpe  ietytla rmnms u)aeeoxo3tatlpD  i s () euoxr3nu4op e fctls sDtm(  ;t4tlt mfeiytfa umuvon() rerio3oo1lp raivs;(0trxrxopoo4lmtnlnvias)arurum ;o1opeoioeiyt s rm( s ()tltrmr3oydopDeauei (0 2to(mpnodale livt s) rrm(rooo4tltnmo3iydlm2emuvo;t4tetnio ia1op elivol(  rxrxo3oo1op n nct tfs2tru  ;o4tlt ii3ilsfa ulnvon(0 lxnxo to1fmtrlu i;s sexoxopnu1lme mnesat) rra(  oo4tleoif3ildfaDul( o;u0arxnxrciodlmtelnvo () rumxrpoodam n fvsl()s2rrxr ot1oet moeiasls2umumsn(0 etnmf3iodfp   ivs;s  euoim iu4omtnmictatf 2ur(  ;t0ole mf3iyd s2rlump t4trerircootlpt aies t0s2xm(o nudlpeemnes () 2ra(ro;u1tlxo iciys s umums;(0aetnir3io1fatelnvilt0t2urxrpnydllee fvi () rta(ro;t1tpe  fetls sDra(vs ()aetnxf3oodfaDe n s ( srtoimpiydale lfvilsfsrumumo;u4tee  fciasfa2elnms;u)altoir iatopDeau i ( s2toxopiy4optn ivsl(f Dtmxm ;o0apt if3iadls2rl( snt0teeoif3tydlpDrln o;s sruo(o iodole mfvtl( sDrau pot1tlto iciyt a2rl(mpnt) lxrif todfpDr ivil(0trurio ny1lm  mfetltfa2rru  ;u4teto i3tldlm2rau sn(0trtrmf3ty1oa   uvi ( trtmiopiy1llt  iesa( aDrr(mont4tpxomoetad aDrluvp;t)tlermo oadfpD lieolt)srtm(r3io4op nlfcilt  rta(mpnt1oltnmoeiydlmDuaumpnu)trtoif tydlp   n o ( s2umxm iudalen ncia(faDta(ront0aeto f3ias s rmnms;(4trerifcia1fmt aieilt  rtmio3no1optnmnvt t aDra(  ou0aeto ietad mDrau o;(0arxnircta1oaDrlnes t) etmxrpio4lltemivi s sDurx p;u0tlto fetytfs2el( ont0 ltrmf ta1optrluvslt)srtoim iudom nlivta(f 2rmx onu0apt ioeiytfaDrluvpnt0 etrxr3io1laDelieo;t)t2xo(r3oo4aleelnctltfs2rr( o;u1opto fcild s rm(mo (0 lenio3oodoptrau s t)t2uoxr io4op n nciat) 2rrur ot1apxo fciyt aDuanvp t4altrxf iadlmDeauvo s0 2xo(o3nu4al emnesl( aDraxmoou0teeomocild mDea(vo (0tlerir3ootoaDe nvs;t sruoiopoydlmtemies s) rtauro;t4ole if3tldfaDrmnvon(0arenmoctydoat li i;t srto(o3iu4oltelfcs s  rra(mpnu1apt ioeiltls emnvo u4altrio3tadfaDrluvo;s0 eurxr3nu1lm nmnvi ()a2um(ro;u0tpto fctatls2ea( o;(4trxrxociadla   iei;()s2xoxopnudlltnlivi ()srrm(ro;o1apen oetasfmDelumsnu) lxrxo oatla   u s;s0teuo(opny4open ncs tfsrtm(rp;u4oeenif3tydla2ea( o u0 etrif3tatfa  aues;t teumir3no4ame  net ()a2um(m ou0aptoiiciatfa2emu p;(4 lxoioctatlm rlnei (0 etmio ny4omee fvt t  Dua(  ;t1olxnifctatfs2rmu o;u) ltrmrciotoaDrlneils t2xmiopnu1alt livils)aDtaxrono1oetn ieiltlm rlumsn(4alenif io1faDrai s t) etoio3nodllte ies t)s2rmur ;o0tex mieiatls eau o;t)tlxnxf3todlpt  ivs s0tetmxr iudaptn feiat)srtaum ot1apenii3iydlmDea(ms (0 lermf3totlmD lneil(  rurio3ou1lme lfvsa() Dtr(rono1apenmoeildfs eaump t4tetnxfcty1omt  ies ( s2tr(m3oydom emnetltfsrtm(mooo0tltoioeiadfm2ua( o;(0altnmr3oadomtr nes ( t2tm(m3nodaptnlivsa( s2ra( oou1apeomocilt m ranmsnu)tetnir oodoa rliei s)s2urxo3nudam emfeslt  Drrx oot1tle ii3tydlm2ea(vs;(0tlerir3iadfp  lies;t)teurxm no4omt lneslt)a2tmurpno0olxomfeiadlsDrlnmpn(4 rerxf3io1fp  lnes ()tetrio3oo1ape  fvsatfsrtm( ont1oeen f3iydlaDuauvs;u4 ltnxfcoatla   n i ()teuoirpio4lltnmictas)a2trx ont1texomo3iyt aDul( s;(4arxnxfctytfmDrli s t  rxrxmpio1olte ieilsfa2tm(mont1olxnioetad m2rmuvp;u4tetoir3ootop e i ils0srtm(o iu4alee fetlt) rtmurpot1open ocild a uanvont4 lxomf3tadoaDrauvs t s2xr(r oodlptelfvsas) rrm( oou4tex iieiydfmDrmuvs (0altnxo3tatlp   neo;s)srxmiopny4ll e iet s aruaumo;t0tet ioeiyd a2eln o;(0 etomfcto1fmD anei ()srur(m3oy4ol e fct ( sDumuront0tpt ii3iasfm2rm(vp () rxrxf3iatlaDe ues;(  eurxr oy1amtemfctls)sDrmu  ot1texoifeils a2raumpn(4 lxoifcty1fpDrlies;(0s2trxm oo4amte neils  2raxrpou1oeto o3tad a uluvo t0teeoxocty1fm  luvo;s0 rumxr oy4ll nlnesls)aDtr( p;t4ape if3iysla rmnvp u0 rtrif tytomtelieil( trtmiopoodlme  nvils  rtru pnu4tpt mf3tlt s rmn on() eeomo iy1lptrauvo s trtoiopnu1ape lnvilsf rtax pnu1tpxnmietldlaDumnmp;t4tlxnxociy1lpDelneslt)sexrxo nydlm  lnvtat s2taxront0tpxo oeiadfs2rmuvs t4trtriocta1lmD au s;t  rtm(o3nu4lpt  fvilsfaDta(r no4tetomocilsfs um( o;t0arenmrcia1faDrai slt)srtmim3io1lpenmivi (faDtrx  no4oet  ietlslm2eaump;u4alenmr3tydfm rluesls0t2xr(m oydapeemivil( arrmxrp;o4aeto i3ildfs2emn s;()trenirctadlpt  n s s sexmxmpno4omen ictlt  2ua(  ;t1aee mo3ild mDrm(ms (0texnxfcoatopte ieol() eurxr3nydlp  mfei (  Drmumpnu0alx ioeilslm el(monu)tlxnmrcoatoa r i o ( srtoiopnu4oltelfet sf rtr(mpot1tlxoioeiltls2rauvonu)tetnxfciatfmtr i olt s2umxo3no4om emfetat)a2taxmonu0aee mf3iydla em( pnt)treomr totlp raueolt trumio3nudol elfeilt)sDrm(mpnu0ape iiciyd m2ua(vs;u)altnmr3todlpDr n i t0 exm(rpno4altelfvt ( sDrmuronu1oet ioeiatfm2eau pnu4 etnxr ta1fp eluei;t t2tr(o nodomtnmictat) 2tmx pnu4tle  f3tas m2ra(mo;t0tlenxo oytlatr nes ()t2uoim3iydol emneias)s2tmxrpnu4olxomfeiasla2umums u4 rxomo3oodfaDe ivil() etoxmpiu4llen ivi (f Dta(mpnt1optomo3ilslsDrl(mo () reoxocto1fp raieslt) 2xrim oo4lm n ietatfsDtrurpno4tlenifcildfs ua(mp (4aeermo3ia1opteai i t0trumirpou1lpenmneilt)s2urx o;u1oetomiciadlsDraumo t0aeenxf oa1lmDeaues;s0 exo(opoo1ol nmnvsls srum(mo;o1altomieiat aDelnmsnt0 eeoir3iatopDe ieol() exmxo3oo1lpeemicil(fs2uax  ;t4tpenii3tytla rau o t4 exoio oodlaD livo;s0s2tm(o iy4lm  mfvt s)a2raumpno1tlxomoeiyd m2ean p;(0trtrxr3totomDeaivolt)srxrxm io4lmenlivt t)artm( ooo1olxomfeildlm eluvp;t0 reomrctodlaDeau o t) rtrir3ny4lm nlfvt s a2uaur ot0olenmoeildfm2ua(ms (4 renif iotlmDraieolt) exr(r3ou1amtemivils a2ua(m ot1texomi3iasfa2rmnmsn(0tlermrciotfateliei t) eurimpiudlm nmicsat  Dumum oo4apxoii3tadlmDrauvpn() exomrcoa1lmDrlu o;s setoio oodal n iviltfsrtrxm ot0ope  i3ildfm rm(vs u) rtrir iy1om rlneo t0s2um(opno1ol e iet sfa2ua(root4tltn f3tad s2um(mp;t)tlxrmr iadoat lnvs;(  eurio nydlmte ivslt arrm(m nu0alt  ociasfa ulu o;t4 exoxf tytla  lueol(0trumio3io1olee ivs sfsrta(mpoo1oee iietatlmDra( p u0teerircootlmDran i;s0 rtoimpny1lme lfes ( a2tru oou0oeto i3tls sDeanmo;u)tltrxfctatfaDraneslt sexo(o3ny1ome mnciat  Dta(mpno4altniocilsls rlnms (0tleoxr tytlpD an i;s0tetrirpiu1ol nmnetl() Drmxm oo1opeo ociyslm rluvpn()texoxo iatlpDrlnes ()s2uoim3iu1lltelfei () rra(rono4ape ifeiatla um(mp t) etnxf3iotfa  aivs t0teumir3iu1omtelnvs ()srtax  nu0tpeomfciytfsDelnvon(0arxoif3oodfm rlieslt0trumim3oo1ap elivil( aDrrumo;t1aeeomfeiltfs2ul( o;(4alermo3tytfat aivo s0s2tmimpno4ope mieia(fartaumpnt1apto ociyt s2eanmon(4arxnmo3iadom rauvols0 rumim nudlm nlieia()s2tr(r oo1olxn fctysfaDumnvsnu4tltoxf iodlateaneslt s2uo(rpio1lmtnlivtlt a2uau  ;o4ope  ieias a ua(vs;() rtoio ootlaDeauesls0 2toxo3no1amen fcia()a2tau pot4tpxnii3iatls umuvp;t4 exomoctodlp ran s;( srxm(rpiu1amte fcil(fartru  ou0olxomociydfa2ea(vpnt4areomrciatoaDraivo;t)trurio3ny1aptelietlt)srtmxr nt4oleomicilslmDrm(mo;t4teerxocoy1fmt lneil(  2uo(m oodopen nvtatfs2rm(  no4aexomfeiyt m2uanvs;t)tlerxo ootlpDe ieo t0 rtoxopiu1lltelivsas artmxmpot0tpx ifciltla2elumpn()tlxniociy1omt anvo s seumim no4am e fcs s sDtrxr ;u4tetniociltlm elnmsnt4aexrxr iodomte u ols)srtm(rpoudam  mfesa( sDrru p;u0oexnifctat mDra(vp;(4texoxo3todlpDrln i;s0srto(m3nu4om n ieia()s2ra(r oo4aptoifciyt aDeanmsnt4 lenmf oadlmteaiei (  2urir ny1ap  mivtlt)s2rrxmpnt0opt mfciytls2rl( s u4texrxfctydoaD  neolt0texr(r iy1alenlnct (faDtm(  ;t4tee  iciadfa2eaumont) lermrciotlpD lueol( teuoxm io4ol  mici tfa2raxmo;u4aetniiciadls2emnmp;u4 reomo to1fa r nvslt  rxoimpoy1lpeelfcils srrmxm ot1oex mietasls2ean on(4treomr3to1fp   n s;t t2urxrpio1opt lncilsf Dtaxrooo1oleomfciysfs2uln pn() eenxf tadom eaieols sexmio3oodaltelicias  Draxrpnu4altniicilt a rmump u) rxrmf3tatop  aivo;t0t2toxo3ou4omt mnetlsfa2taxmonu0oetn ictltls ua(vs;(0alxoiocoo1fm rlnes;t0 2tm(o oy1amee nci t)sDta(mo;o4tee  ociasfaDulnmsn() rermr3ty1lm eln o;()s2to(o ny4op nmicsa(fsrraumonu0ope  iciadlm2rmnmpnu0 ltoirciydfmte ueo s  rtr(r oydaptnlncsa()sDrrx ono1tlx moeiat s ea(vs ()alxnmr io1fat anvi t)trtm(rpoudopt  ivsas s2rau p;u1aeeo o3iytfm umu onu0altnmf3totfpte ueo s) 2urxm nudap elicia( srtm( ooo1texo ietadlm emnms (0tltrxrctadomt lnvols  2xr(r iy1amtnlfcsat  Durx  ;o1aet  ietaslm2emums;(0 rxrxr totfatr ivo;t)s2toxo3iy1al emfcsat  rrauro;o4oltn oetltfs umnmp u0 rxnxo3oodomt  uvi s sruo(o3no1llt  ncils) rtaum nt0tptn ietldla2uln pnt0 eeoif io1lpDelieo;s)seumxo oo1op nlnvia(fa2ua(rpnt0oexnmfetld a2uan s;(0aexoio3iadoptr i sls  rtmxm3iy4llte fesat)s2urxmo;u4ape mo3tadlm2um(mo u)alxoio totomDranvs t sexrxr oodopeemivsatf rumxr no1aptoio3iyd sDem(mp t4arxomo3tydlaD aiesls t2triopnudll nmivi ( s2uau o;u4alxoio3tyt s em(mp (4arxrif3oy1opte n sl( srtmir3iodapenlivsatfs2uaum ;t4tpxo o3tld m uluvon(4 rtomocoatlp  lnvo;(0trum(o3no4ope lncilt  Drrxronu4tlx  octadlaDeau p t4 exniocoatlptelu ols srurxo oo1oltn ieias)sruaxm ot0oex ii3iltfs el( p u0 lxomf oadlmt lieil(0 2urim ny1lmenmncsa()sDrrxmpnt4teto o3iys s2ra( snt0aeerifctotfmDrlu o s0texrxm oo4ll emictlt a2taxro;o4olenmoeiydlm2rl(mo;(4trtrif3tatfmDrluvs s0trtrxrpoo4apt mies tf 2rr( pno1ole io3taslm rlump;() rxoir3iytomDeli i;t t2trxrpiydlp  lnct () 2uau pno1texo f3tld s ran s;(0tlenmfciotop rlnvslt)setrxo nudlmeelfct t) Dum(r ou1tex  fciatfs rauvonu4treoifcty1lat  n ols  2tm(o ou1ome mneilt s2rr( ont1olx ifctad s eluvsn() renmo3oatlmtrluvo s)t2xmxm3nodop  liesat)arurx pou1ale mf3iytfaDuluvo;u0trtoxr3oadlmDelneils)srtmxr oo4ome lneias s2uau p;o1oetoiieilsls ea(vp;(4 lxoxo oytopD  neilt)srtm(o ny1olee ict s)arur(roou4apenifciltls rlnvo;u4aeeoircia1fpt  n o (0trumir no1ap  mivsat) Duau poo1tlxnmi3iatlmDulumo u) lxomf3todlm e uvi;( truoxm io4llt miesl( aDtaxmpot4oeeo ictltlm rl(monu) etnmo3io1fa rln sls0 euoim3nydlm e nvi (f 2trx onu0tpxnif3iysfs2ean on()areomrciadfa e i sls trto(mpiudlmtemfcs t) Drru  ou1alxomo3tytls ra(mp ()tltrmf3oadlat luvilt0 2xoxm3oy4llenlncia()sDua(mpoo4tlx moeiydfa ra(mpn(0texoir3oadopDe uvs s)t2toxmpno1lltnlivia(  Dtm( oot4oet iietydfs2ul( o u)altrif todlat  u ol(0t2xrim3oudame lfcsl()artaurp;o0tlx  feiys a2el(mpnu0alxoxf oodlmte i i;( srurxr nydolenlnetltf 2tmxr no0teeo ictadlaDrluvo;(0tlenxo3totfp  aneo;t seumxm3ou1lm nlivtasfs2taumono4tpto f3tytlmDua(vpn()areomr iydoaD lu ol()s2to(o oudop   ieil()a2rm(mpno4ape ii3tys a emuvp u)tltoxf3tydfpD livols)seuoxr oy1olenmnvilt  Duaxmo;t0apt mfctytlm2elnvp (4arerxfcoodfm elieo t0texmim3iy4lpen fes (  Drm(mpou1oeeomoetlsfs rlumo;t) exnio3iotlp r i i;s) 2xrirpoydapt mfei sfaDuru ont0tetoiieiyt a eanms t4areomf3oa1oa r iei t)s2xr(r io4lleelfctls a2rau  ;u1aeeo fciyd a umn snu4 etnmr3oodopDe uvi;s0texr(mpoo4lm nmiciat) Duax  ;o0texomociadfa2ul( p t)aetomocoadlptelnvo;t)srxr(r3no4olt  iei s sDuax  oo0tleomo3iytfaDulums t4 renxocia1fp eau o (0trtmxopiu4ll nlfvtls  rumxr ot0alxnioeiad a2rmumonu4trerif3ta1lpte neslt trtmxopio1lm n fvsl( aDrmxmp;o1tetniieilt m2rmn pnu) eermocoodfptrluei s srxmxo nu4altemfesas aDtaxrpot4opxniociatla eanvsnt0 rtrxr iy1lm  luvi s tetmxr iu4ap nmneia() 2tmum oo1aptn icilt s2rauvp t4altrxf tydoat  uei;t0 rtmim3ou4apt  nvt s  2umum oo0oltomo3iydfaDumump (0 rerxrcoo1lmD ln i;()srtoxo nu4omtemfvs t s2ta(m ou4altomfeiysfs ulu p;t4tetoio3to1lmteau i;()srxm(m3ou4omt  feta()s2umu pno4oleoii3iydfs ean on(4arxrxfctytlmt lneo s sexrxo3ny1lleemfciat  Dur(rpoo1aptomf3ildfa emnmp (0 lerifcootoa rluvol( t2trxo oudlltelics t) rta( pot1teeomf3iatlm2ul(mo;()artniociatfaDrau o;(  2uoxopnydlptelieilt) 2umump;o0apt moetys mDran o;u0aetrio oydlmD  ivsl(  2xm(rpiy4lp  mncsltfarrr(rpno0oeto feiydfaDemumon(0arerxo todomDr ieo t0trxoxr3io4aptnlncsas  2umu p;u4aee mictatlaDemu o u0alenxr oydopD aueilt0texmxopou4llt mnvia()arrmur ot0ole mo3tytla uln p t0aeenxf3iotoa eaivo ()tetoxo iy1ol  mnesa() 2tru pou4tpt mi3taslmDrluvp t4 lxoirctodlpD lnesl()t2trxm3iu4omtemnet s  2tr(r nt0teeomo3ias s2em(vsn() rtrmo iadfmD lnes;s  ruoxopny1llee fvtat) rta(mooo1olxnii3iad s2elnvon(4texnmr3ootomDelivs;s)s2ur(m oo1am e iei t) rur(m ou4oexo ieiys a ulnmo;t) ltoxrctodlptelnei t0 etrim3nydlmt  ivil(fsrtm(m ;t0opxnioeiyd sDumn s;t) eeriociotfpt  u ilt t2uoxr3nu4ome micilt  Dtr(ro;u1apt mieiyt sDumnvs t0 eenxo totfat aues;s)t2um(r oo1apeemivil( sDum( onu1tpxomfeilslaDemnmo;t4tetnmrciadfpDelnvs;t0srxo(r3ou1ap nliet tfartm( poo1oee mictad a2umuvs;(4trerio iadlp raieslt srumim3iu1ope mnvtl() 2tmxm ou4olto feiatlsDemump t)altnmoctytfpD aieslt s2uo(m3ny4alt mivi t  Dtaxmoou0oet mocilsfa umums t0aeenxr iatoatranvil(0 etr(o3iu4op elncs (farraump;t4alxomictadls rlnvon(0alermo3ia1omtrau s;s0texoxm3io4ap  micsas) Durumpnt0tpenmf3iatfaDemn p;t0arerxrctatomDelu ols sexrxrpnu1lm  lnvia(f rrrx  nt0olt iieiad aDum(mp;t)trxrmf3oytfaDe nesl(0t2xo(r oo4am  lietls)sDtr(  nt0aptoif3tld s ulu on(4artrmr todfp elivols) etoio3iy4apenmiesa(fa2trurpnt0tpxniocilt mDrlnmpnu0altoxf tydop rau ol( sruoir nudalen neiatfs2um(mpnu4tlxomiciysls eaumon(4artnxf tytfmD luvs;t0 2xr(mpno4ap nmietas s2uax  no0ope ii3iltfmDra(vonu0 exoifctotfpt luvo (0s2toir3iudom n ivs t a2rr(rpno1apeoiociydls elu p t0 eeomf iotoaD  i ol(0s2uoxmpno1lmt mivtlsf rumur oo0ope  f3iatla uan o ()tetoxrciodfmtranvsl(0trtmimpno1amtn feiltfaDtaxr nu1tptnmo3tat m rl(mo;t4 exrxo3tydfpt  i sls)t2xr(o no4lpeemivtl(f rtrurono4tleoioetldfaDemump;u4 leomf ty1oa e ues;s) rurio oudapte ics tfsrur(mpou0aleniieildls2ea( p;(0 etoir3oo1lpt lnes;t0truoxrpno1ome lies s)s2rm(r ;u0aetnmf3iyd m2rln snt)aetoxo3iodfmtr nvo;t0 2toirpno4aptelnctasfa2um(moot1aexomo3tysfmDranmpn(0tlxrmocoydlaD li o t0t2toio iy1lpeelfvt sfaDrmurpou0aetnmfetytfsDuln o t4tlxnif tatfaDeaneo s)srxo(o iodapenmietasfsrrmu  ou0tpenmiciatla ulu o;u0tlxomf3ty1lpDe nvs ( trxm(r oy4ol   net sf rrax pnu4aet mf3iydfa elumo u4texnmf tydomt  ies;s0seur(m3oo1omt  fvi tf Dtr(r nt1tlt  octltlm ul(vsnt4tlxrirciatlaD  ieol(0tetoxopiodlltelnvsat srtrumooo1oexnioetasfaDumnmpnu4tetnioctodom r ieo t  ruoxr3oudllee iesa(fs2urx pno4tlxnmietltls raump u0texnmf io1laD liei ()texo(o3ny4omenlncs s) 2urumo;o0tptn ietltfm ulnmo u0aeenmrciy1faD livs ()s2umxopou1omenmnei sf ruaur ou1teeoiiciadlmDemnmo ()alenmo3ta1fa  lies;s) rumio3io4omte ictasfarrmxrpno1oexomfeilt sDem(mpnt0trxnmocoy1lm elneo;t)setoxr3iu1apte fviasf 2tr(moou0apt ii3iaslsDel( p;u0 ltomr3tydomD aiesl()s2toio iu4omtemncil(fsrrrumpoo4opxn o3tatls2rl( s u)treomrcoatlmDrlieo t0t2xriopoydameemncia() rrrxrooo1alenioeiyslm2ul(mp u0altnmfcoadomDr i ols s2umxmpio4om  lfes t)aDtrurooo0alx ii3iltla raumsn()tlerirciy1lpte u slt0t2tm(opoo4amt lnvi tf rrauro;t1optnifeias s rmuvs;t4altnmfciotlp   nvolt)t2xr(r3oo1lmt mneiat) 2urumo;u0tle moetad a elnvsn() lenxf tytlptrluei;()t2xoxmpiy4op nmnei tfsDtr(ro;u0aeenifciydla ulnms;u4alerif iy1fp eaivo s)trxrir iu4am emivsl(f rtmxr oo0apxoifciatlsDrlnmp;t)trtoxr tatfmte u o t  2xo(rpiudomtemncils a2rmuroou1tlxomo3tlsla ul(msnt4 ltrifciydfptrln s s0 exm(m3oodap  mfesls a2ra( onu0aleniieiatfa2ua(vo;u0 leomr3iydlmtr n i;s  2uo(m nu1lltemict sfsDrr(r ;t0opxoiictyd aDrl(msn(0 exrmf3io1lm  aivi;t)srtoimpoodam  micsas)sDtmuroot0alt io3tadlmDrmumpnu0alenmocoo1fatr uvsl( srur(m3no4lmtemncil() rrru o;u4oexomiciyt a2um(vo;u0tetomf oydoat lneo;s  2xr(m3oudam e ivil(  ruax o;u1olx  o3ildfs ean p;(0texoir ty1fm  lu ilt0 exoio3oydape mieiasfaDururoou1olx  f3tasls elu p t)trerio oatoat  i s;t)t2ur(o oo4open fvslt)arrrur ;o1tetomo3ils aDum( pn(0tetoirctydoaD  n slt)trumxrpio1ale  neta( aDrm( poo4apxoiiciyd s uaums;()alxomr3ia1oaD luvo s teuo(opoo1ol  mfvt ()a2trxronu1olxniietltfm2rauvo (4 rtnif3oadfa eaivo (0 rtmxm3oodlpeemncsas  Duaxmp;t4ale  iciat m2rmuvsnu0 exnirctytoptraneo;t)tetoio oy4lltnmivs ( arurxro;t1oltoiocilsfmDum( o ()artnmocoodop e i s;( trxm(r3io1amt mfetas s2urxroou4opt mfcilsfa2umn o u) rxrxfctotoa  ai sls) exm(rpiu1apt  ncsatfs2uau  ;t1aptoif3iat sDumnvs;t4tetnxr oy1op rau o (0seuoim nudole lietasfs2rm(r oo0alt mietls aDelu p t0trxnmf3to1omDraivo t0trurxr3ny4om elietatf rraum nt1tlxo ociatlsDem( p t0treoxf tatomDrln s;t)truoxm oydapenmivta()srtr( pnt4ape io3iasla eaumo u0tetriocia1lmDrli s s  exrirpio1ol n fei sfsDrau onu0alxomi3iys m2rmu s;t)artnmo oadfpDelivils  2xmxo3iudap   fvi ()s2tr(mp;t1opx iiciyt a rmn p;u0 rxoirctotomtraivi;(0s2xm(opnydomte ieia(  Dur( o;t0apx  oetys m2uanvp t0 rxrmociy1op rlieils)setm(m ou1am nlivsas  rra(mpoo4teeo o3iad a elu on(4tlenmoctodlm rlu ol()t2trirpoodol nlnetl(  2raxr no4aex mf3ils aDrl(mp;u4 etrmfcoytfpt luei s t2xmio3nudolenliet (f Dumur oo4opxoiiciys sDra(ms;t)trerir oy1opteai i;( tetmir3iu1ol emnvsasfaDur( oou0tpxomieias s el(mont)aexrxrciy1lpDeluvil()t2uoxrpnodll nlfvsls)sDumuronu0tltnio3iltfaDrlnvs t)tetnxo3oytfpt anvolt0srtrxmpnudamenlfci (fsrtr(rpou0tpx mo3ildfa2ua(vp u0tetnmr3iatfm eanvs t0t2uoxopoy1omtnmnci sfaDrax ooo4oee iietysla emnvon(4tlxoxr oodomtrauvi;t trtrxrpno1om emfcsls sDraxm ;t0tpxnmfciysla2uln onu4alxrxo3todlp e ueils)srxrxo no4al nmici (f Dur( p;u4tptn octat m raumsnu0 rxoir3oy1faD anvs s t2tm(m ny1ol  mnvt t s2ur(rpnu0tlto o3iat aDulnvon(4 exoircty1opt  ieils  2tm(o3nodaltemncslt) Dtmxm no4aeenmietldla2uluvs;(4 ltnir iadlp e nvi;s) rxo(o3nu4apeelicilt  rrmurpnu4tleniociltfmDulnvo;u) etoxr3tadomte iei s  ruoimpnu4am n netlt  rurxro;o0alx mieiatfs ua(vo (0arermr oy1opD ln s;t)teto(rpou1openlfet tfartmxm no4texnmoeilslm ul(mo;(4tetnmr3oodlptean s;s t2toir iodlmt  fvsatf ruax p;t1teenio3tas mDul(ms (4trxomf todfmtraieils s2xm(opno4aptnlicsas aDtmxmoou0aexnmo3iyslm umnvsn(0 lxrir tydlmDe neol()sexmim nu4alt  ietl()artau o;o1tpxoif3iyt s2el(ms t4tltnxr3io1omD anvo;t sexoimpiy1lpt mivtlsfartr(r ;u0apeoio3iydlsDrln on()tlenmr3oa1lptrlivs t) 2toxmpoy4opeelietlsfaDtr(rpno4texoii3tasfaDemnmo u)aexrxo oadlmt lieols0srxrim3iy4altn ivt tfsDta(  ;u4apenmieiytlaDrm(mp;t)artrxo tydlaDr ueils  eto(rpou4lleemivsatfarumu ono4aptnmo3iasfm emnvon(4arerif oadfa e nvo t srurxm3nu1lm n nctat artmxro;t4tlxniieiyt m ul( snu0tlxoxr3iy1fa ean s;t) rum(r3iudape  iet t sDtr(moou4aleniictas m ua(ms ()trxomr3iytfpDrli sls s2umxr3iu1op elnei (  Duaum ;t1alxoiiciyt m ul( on(0tleomo iotfateln s;t) 2xmimpny4ap eliesl(fs2taum ou4tpe moetyd a eanvp t4aetrmo ootlpDr nvi s0seuriopny4aptnlfcsat  rumurpot0oet ioctlslaDea(msnt4 lxnircoodop rlnvo ( trxoxm3nydlleemfctasfa2rrxmo;u1aetn iciytlm rm(vs ()treoir3ta1lmDr ueo s0 eumxopiu4op   fcs s artrump;t4openiicilt s2uanms;(4areoif oy1fptraivi t)t2trxr3ny4lpenlics s a2rau  no4apxoioetyt sDea(vs ()trerxf iydopDrluvs;(0 rtr(r3iu4am n ivslsf rumxmooo0tptomieild m ean snt4tltrxociydfmtrlies t0trxrirpoudlmtemivt t) 2uaxrp;u1olto feiasfm rl( o t4trtrio iytoptr u ols  etrxo oydolenmivtlsfaDum(ro;u0opxnmf3iydfmDea(vpnu)trerir iydfaDeliesls)texmir io1lm emneias arurumono4tltomocilsfm uau s (0 etomfciytop rlnvs s0tetoxm iodaleelfesa(fa2rmxm ;u0tlx mieiyt a2el(mp (4 lxomr tytlateau i;t0s2xmiopoo1optnlfcilt) Dtm(  nu1tpxoioeiysls2ranvs u)trtnxf3tytop ran s;t srtm(o nu4ol   nvi () rumumo;t0olxo ieiltfa2rm(vo (4aexrmo3ta1laDe ues s)tetr(r3iu1optelfcia()aDum(  ot1tpe mieilsfa ea( o (0arerio3tytlmDrai i (0 etr(m3oy4altnmfei () ruaumpoo1oleomocias m em( on()aetnxocia1oaDrai slt) ruoim oudlptn feta(fsDum(rp;u1alxo fciydfs emuvsnt4 leoxfcoadfpt  nes;s0s2xrio3io4apee ncsa()aDurxr ou1opt miciat m umuvo;t0tleomf3oa1fm r uvi () 2xr(o nu1lp  mncia(f 2tmu  ;t1aetnmicildfa2rm( p;()trtriociodlpt luvs s s2urir iu4olen fctat sDumumo;o0aexnii3ilsfs2rln p t) exnxfciotlat lieolt sexoim oudap nmncs sfs2taumooo1opeomietydla2elnmo t0altnmfcoo1fpt aivi (  rumxm iy4op elnvi t)srtmu  nu1apt iociyd s2ulumpn(0treoircty1fmt auvi s  rurio3oy4om  licsas s2raur ;t4oeeoif3tytfm ul(vp;t4trerxocty1fmDe ueol( tetoir iudomte iei tfs2tmu  ;t0apt ioctytlm em(mp;(0 lxnir3oo1oa eli i s0t2xoir3nu1lpeemncsas)sDumurpnu4oeeoiictatlaDem(vsn(4alxniociydfatelu sls t2xmio3ny1apeemfciat  2tm(m ou4aet mf3iyt m uan pnu4arenxr3iy1fptrlu i (0sexoxr iy4ll  mfct s)srrrurp;t4aexnioetyd s2umnvo;()arenmocoydlm r ues;t s2tmir3iudalt micilt s2tm(r ot0olxnmocias aDea(ms t4artrxo3tytla rau il(  etm(rpiudlpenlictlt) Dumxrp;o1apxomietltlm elnmsn(0tltrxrcoy1op  auei t0seuoxmpoydopt mnvi ()arumx  nt0tlxn ietltfaDrmnmp;t0trxnmr oadfmD  n ol( trumir3nudlm elnetl(f 2rmxrp;t1tpen ieiasfm rm( o (0tleoio3ta1fat lnei;t  2urxm ou4ll emicia(fs2ra( oot0oexnio3iysfs2elu s;() eerxr totfmt  ues;t  exrimpnu1al elneslsf rrm(r ou0oet if3iasfmDrlnmp;u)tetoxo iy1latr n o t0 rtm(r3nu1omenlivt t)aDrm(  nu1tpen ieildfmDeanvpnt)texnxocoydfm rlnvs (0 rum(mpoy1ope mnciat srtaumo;t0ale moctadfm2elumsnu4tlxnif oo1laDe n ilt0 2urir3oo4altnmnei tfsDurxmonu4tex mo3ias s elumonu)texrxr ootfpDraiesl()sruoir3io4amee ics tfaDrrxronu0aptomictydla2eanmsnt4aleoxr oydla ranvolt0 eumxm nu1lle lieslt arrm(  ot0oetnmfciltla umumpnu0alxnxo3tydfp raiei t)tetrim3oy4apt mnvtlt  rtmxm ou0optoifcildlm2ua(mo;(4 lxoirctytfpDelu s;t)s2umio3oo4lptelneil( srrmum ;u1aetn icildfm ranmsnu) ltoif3iatfat  ueo;s0 eumxo no4oleelfvi s)srrrxm ;t4tpt  fciys s2rlumsnu0texrxo tydfa eau o ()t2xrio3oydolen nvslt srum(m nu4optoiicilt s ua( p;u)tetrircoy1oaD aivi;t0 rxmxm3nu4olt  nvtlt)arra(  oo4tex mociytfs eauvo;(0teenif3tydfpt  n s;( teum(r3ny4ol elivs tfa2umxr ou4oexn ictyt a uanvsn() lermocoa1fmDelneslt  2to(m iodom nmict s)s2umx  ou4tlenmf3tasfa rl(mo;t0 etoxrcio1fpDelnvs;()trtrxr iu1om  mies t)srra(mooo4alxoioctysfa eanvs (0aeerifctatoat li olt0 2xrim3oydop e iet s sDurum nu1tltomfciytfsDelumo;t) eeomf3oytfptranvs;(  exrimpoy4lmee nvtasfsrtmx  oo0ape mf3tld a ean o;(0tetoxr oatoa raneils)s2toio3oo1ape mnei sfsDraxmp;o0tpe mocias sDeanmp;u) exoifcty1lptrluvi;t)tetm(r oodap emnvilt  2rm(rp;o1oeto oeiadfm eanmont)altomo totopteauvo;s0 rur(o3iydopenlictatfsrrm( ono4ole  fctldla rmuvp;(0 eeoxf todfpD lnes;s0seumir iy4amtemfeil()srtmumpnt4apx ioetatls2eanvo (0 exnmo3oa1omteauvi t)t2umxr3iu1olte neia()a2tmxmoot0oltn fciysla raump;t)tlenif totlp eaivs;s)seuoxo3ou4ape  ietltfsDua(monu4tpx moetyd mDrln p;t) rtnio oy1opDr u i ( srtr(mpnodlleemivi sfaDuaxr ot4aex mi3tydla umnvont4alenxr3iytoat auvo;(0 2ur(o iy1omenmncilsfaDtmurpnt4apxn o3iydlsDulnvs t4altnmo totlmtr neil( t2tr(o ny4alte fetat aDtmxro;u4opxnmictas m ranvp ()teeoif iadfpDr nvi s tetr(m3oydlp   nctlt) 2taumont0oltn fciaslm2elnms () etomrcta1om  li slt  rtmimpno1opt lncsls)aDum( p;u1oetomfeiyd m2ea(vo t0trtomf ty1lp eau o;()sruoxrpny1lpeelfeia() 2ua(ro;t4alt io3tadlm2um( o;t4arxomrciatoatrluvilt0truoim3oo1amt mictl(f rtaxrpnt1oeeomociadfs eanms;t4trerio3oydlp ean o s  2xo(opoo1ap  lics t)sDurxr no4apx  oeilslm ulums t)aetnxf oo1op elivo (0 2uoxo oo1lm nlicsas) Dtr(rpnu1tlxoifeild a2umums (4tetoxo oa1fpDr u sls truoim3nudlleelfei t)s2ta(mo;o4texoif3tls m2umu s;u)aetoxfciy1faDr neilt0srumirpiu4lpen nvil(  Dra(mpno4tlt  oetltlm2uln p;t) reomo tatfatelueo ()trxo(r oo4ol  lncsl(farrr(mpno0aptoiiciat a ra(mpn(0tetnio3tytlm e nvilt s2to(mpio1lltemfcsa()s2trxmp;o4tlt ifeiydfsDuln o;t4trxnif3oo1fpteanvi ( srto(r ny1aptnlnetat)s2rau ooo0tex if3iydls2elu s;(0 exnxfcoadfp elieilt s2xo(m3ou4al  mivta() rtrx  ;t0tlenii3iad aDul(ms () exrio3tytfaDran sls) eurxm3nu4al nlfctlsfaDrr( oot1tpxnmi3tltla eluvsnt4texoxfctotfpD lu s;t)t2tmir io1am elnvi sf ruaxmpnu0oetn i3ilsfs ean pnt4aeeniocta1fp r ieols  2tm(o nu4lle mfcsat)a2taxmo;u4alxomoeiat m2eauvs ()tltrmr to1fateaivo (0trtrir3no1lm nlies sf 2urur ot1tetn f3tatfs2emump t0tlxrio totlpt  u i t)trxrxm iy1ol  mfvsat aDtaxr ou4aexoiictlsfsDrlu p;t0tetnxrcootfpt an o;s0texmxopiudaltelnetas  Durxmpnu0ole iieils m2emnvp (0 reoifcoa1la  lnvi (  rxoxopnudomte nei sf Durxmooo0oee  feildfa ra( s;t)arxnxrciy1oaD  ivo ( s2xm(r3oy4lle  icils sDua(mo;u1apto i3tatfm umnms u0texomf tadlm eln ols sexrir3io4llen ncias  rtr( ooo0tlx  oetlsfm rmuvsnt)trxrmoctodfaD auei;s)srxm(r3nydlme  nesat  rtmxmpnt0oexoiietld mDuanms;(0 rtrmo iatom   nesls  2uoxo3nu1ame mfetat) 2uaumpnt0apeo i3tad a el(msn(4trtnmo tatop e ivol( texmxr3ou1op nlfciltfsDurumo;u1texoif3tadfa2em(monu)tetrxf3tatlp  lu il()s2xrxrpiydopt  fcsls a2ra(rpoo1oeeoifctldfm2ul(msnu) etnmr oodfmtrln i s s2xrirpoodapeemnes ()sDur(monu4apxn ocildlm2rlnmo ()aexrxo oa1omDrluei s  rtrxopnudome mfvil( srrrxm no1olxo ieiad m2ranvo;(0 leoir3iodfaDeaueslt) rtrxm3no4lpt  nvsls  Drr(mp;u4olt mf3tas a2el(mo ()arxomr ootoaDrauvi t)t2um(m io4llt  ici s a2uaxront1alt  fciydfmDra( o;u0 lenif io1fmtr ivsl(  2ur(o3oydlp   neslt)s2ururoot1aleoiiciys s2elnmo;u4 rermf iatomD anei;s)sexoxr3oo4omeemncsas)aDtmxrpnu4apx  oetlt aDrlnmp u4aleomf3ta1faD  uvo s  rumxopoo4lle mfctat  2urxr ;t0tpx  i3iasls uanvp;u)arxrxfcoatfpt  uvols trxm(mpnu4open nvs sf rrrumooo0ope moeiyd s uau s u4 eenmf3oatopD au sl(0 ruoiopny1ol e fvtltfaDurx ont1opt if3iydlsDrm(mo;u)teenxo iytlaD auei;s  2uo(m iodalt mfcs s  Dur(m ;t0tpx ioctldfa emnvp;() rtrxr tadfp rluesl(  2toio ny1amtemivtlt sDurxmooo4oeeomocilsla2rmnmsnu) etoxf tatlm rlueo;t setoxopny4amt lfcsas  2raxmpot1olxo f3iydla2ul( sn()trenxf iy1lpDr nei;(0 etrir oy1ll n fes sfs2tax  ou4ope  f3tad s uln onu0texrio3todlptran il()sruoir3nydolen nci s) Dtr(ronu4tpe  oeiltfaDel( s t)aexnioctydlaDeanesl( sexoxopou4al nmnvs t)sDumxmp;u0apt mo3iltfm2ul(mp (0teenmocoytfp  au ils0srtmiopoo1ap  micias)arrrxmooo0tptnifeiytfaDuan pnt4aleoxr3oo1la  anvsls0t2uo(m nu1op  mivslt)a2rm( p;o4optoifeils a rl( o;u) eenxr iodla eaivo;s0tetoio3iu1ame  fet s srtmumonu1tet  icilsfm2emn o u0 rtrxocootlm  lu s s)trto(r3nodopeelfviat)arumxm no0oltnifctyt s2rl(monu)alenxf io1fatrlu ols t2ur(o3iy1oltemnetltfsrtmum nu0tex  i3iad a2eaumo;u4treoir3oydomDeanvs (0t2uo(o3nu4lp   fvi ()aDtrum ;t4alxnifciys sDemnmp (4 etoif ty1lmtrlieilt0 rum(opio1lltemivs t)aDrmxmono0olxoioeiasfs um( o t0tetnxo tydlmDe u i;t0trumir3nu1lmt  net sfsDra(monu1olx mo3iyslmDelnms (4aeenircty1fateaivolt trtr(o3iydlptnmfes tfsrumx oou4tle ioeiyd mDulnmonu4 ltrmo todlaD  n i;t0s2tr(o3ny1lm nmfvi sfsrurumoou4ape ifctlsla2ra( s (0arenmrcty1fmDelu s;s) rtmir oo1llenlfci t) 2taurpot0aet mf3iad a ul(vsn(4tlxrmrctytfat aueo;t srurim ny4al emfvta(  2trumooo0tet iocildlm uluvpnt) lxnxrctodop e uvo ()tetmir nydlmt mfvtas) rrruront1teeoioeiadlm umnms;() rxrif3ty1lm eaies ()srxr(o3oy1lle lfctl( s2ua(r nu1aexo fciadfa uluvp;(4teeoif3ty1fatr ueilt)t2urio3oodlleelneta(  rua(  ot4tetnif3iyd a elums (0tltnircoo1lpDr uvi t t2umir oy1altnmicia(fsrra(m ;o0apeomieiysfsDuaums u) rxoxf3oo1lptraneo;s sexm(o3oo4oleemieilt)sDta( o;o4tetoiictadla ranms u) ltoiocta1lm  aues t0t2xoio iy4lmt mfvsl( sDum(r nt0oetn oeiys m ra(ms;u0trxnxr3tytlptr neo s0s2to(o3nu4opeemfvs sf rrru  nu1teenmfciltlaDrmu o t4 rxoif3iodfm rluvs t) rxr(o no1ol   ieslsfs2rm(m ou4opxoifciytlm em(ms;u)tetrif3oatfmDe neils)trxoim iy4lpeelnct t)arum(m ;u4oltoif3ilslmDra(mo u) etrxr3oytfmDe uvil() 2xo(opoo4om elnctlsf Dumu  nu4tle mfciytla uanmpnu) rxrxfctodla elnvsls0t2trimpiu4am nmfeia()aDrrxm ot0opxomictlsla ran o u0areoxo3iatlmDeauvils0 exmir iodolen ict sfaDra(mp;t4tpeomoetysfaDul( s u0tltoxo3oydomte ivolt0trurir3nudol n feilt)arua(mp;o1optomo3ildfa rl( pnt0teermf oytlpDraneo ( seumxr nodamenmiesat)sDua(ront1apx iocildfs2ea(ms;(4tleoio3tatfmtraivi;t texoxo no1ll   fvslt) Drrxm ;u4texnmf3iltls uan p (0 ltnxo3ty1om   u sl( t2trxm oy4om  micsasf 2trumpot1tpt mi3iadls2rlu p;u4trtomfcta1omtrlu i ( t2xrir nu1alen nvsat s2ra(  ;u0tltomocilsfmDemums;t4 leomrctatfpte n i (  exrim ny4lpte ivtas aDtrxrpnu0opxo f3iytfsDeaumo;u0treoxr oydfmte neo t0s2trxm3oo4amtn fvta( srurxmooo4ale  f3tlsla umumsnu4 renmf totopDrli sl(  exmxm iydop eliet s)sDraxmono1aetnmf3tyd mDuau o t0tltoxrcoa1lpDraneolt) euoxr nydopee ici t)aruaum ;u4alxnifcilslsDum(vont0aexrir3oodlpt  iei t)s2trimpiu4open nciltfsrurumoot0alx io3tasls ulnmon(4tlerxo oatlpt luvs t srxrirpiy4omtnlicta(f 2rmxro;u1tlxoiociytfs uluvsn(0texrmf tatfaD li ils0texmim3iu4alenlfct sf 2urxmpot0ape  ieiltls rmu pn()teeoio3iodfateaueslt) rxrim3iodaptemfcsa(fs2tr(mont1opxnmicildfaDra(vp;t0 rxrmo oytfm e i s;()teurxopiudlp  lfvi t  rtrxr ;u4aeeo oetaslm ranms u)aeeomrcoatop  auvi t) 2tm(mpou4alt  fvs s sDtax  ;t1ole ifeilsfsDrlumpnt4arermrcoatfm e nvo;( sruoxrpnu1op elfctl(farrmuront4aptomfeiltfs2ua( snu4tlxnmo ta1lpte ies (0 2xrxopio1ap elivi ( arta(rp;u1aptomieiltfa em(vpnu0 eenio3iydlmteluvs t)s2xmxm3nu4op  mnctlsfarurxro;u1apx mf3tas a rln sn(0 etoxfciotfa r ies;t trtmxo oo4om nmnvtlt artaur oo1aeenmoctas s ua(ms t0trxnmf tadlptrlieo;() euo(o iy4amtnlivsltfsDtrump;t4aetnio3ild a ulump;(0tlenmr3iodoa ranvo;t teto(mpiu4lp nmivtas)a2trxrpot4oet  ietld a2el( s;t4aeermf3oadfa e uvi t  euoimpiy4al n nvia()aDtauronu1alxomf3iat aDrmnvp;u4tltnmrciatlaDeaneo;s)s2tmim3oudoptemncsasfa2tmuroot1oleomoctydlsDea(vo t0alxoxrcio1lateln o (  rtoxr oodap nmnet sfsrur(  nt4tpt iociyd aDul(ms u0trtrifcio1lmt ln s s truo(m3no1ame  netas)srraxmpnt4oet mieiadfmDuan s (4trxnio3oy1laDran i (0 exrxr oudlle mivils)srtmxmp;t0tpt mfcilslsDraumpnu)trxnir oadoatr neo;s  rtoxr ny4om  mnvtltfa2rruront0olx iieildfsDel( s;t4arxnxf3iytlmtr nvo;(  rtrir ny1omt lfcs (fsDtrxronu4oeeniiciytfm2rmnms;u0 exoxf3iatopt anvil()s2xo(r io4ale mnet ( s2tr( o;t1texo fetyd aDrl(vonu)alermr3oadoatelivi s) 2ur(rpny1olt  iciat) Duaumpou1altnioeils aDrmu pnu4artoifctytfateauesls)s2xmiopou4ll emnctls)srtmurooo0optomf3iat s raumon(4aetoirctytomtr nvi;t  2uoxo iudlm n fetat srur( poo4apx mf3ilslaDuln s u) lerxocia1lmt an o t s2umir3ou1opeemnci s aDrm(rpno0altnmfeiltfa2uau p (0texrxr3io1lpDeanei;s t2xrirpnydll elfctlt) rra(  ;u1tpen f3tatlmDem( s t4 rerir3tytfp eln
\ No newline at end of file
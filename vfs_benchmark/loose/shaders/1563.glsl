@@ -0,0 +1 @@
+ueo s0t2urim3iudlle lnvta() ruru  ot4teeoiieildla uln o;() etnifciodfm rlueols) ruriopoo1omeelfvs (fa2ururp;o0alenio3ildla2rmu p;t)tltnxrcio1lmt  ivs (0t2xmio oo1lm   ici t  Drr(rpnu0aee mf3iytfmDumump;t)arxoifcta1laDrlivsl(0trur(opoudape  icslsf Dra(  ;o4apx moeils s rl(vo;t0tlxoifctydoatrlivs;t  2to(r nu4ome lnvslsfaDtmurp;t1tleo ieiysls em(ms;(4trxrxfciy1op   iei;t0 etoim iu4opeemneia() 2ur(rpnu1aetoii3iat s emumsn()aeerifciodoaD lneo ( seuoio no4om nmieils sDrrxrpoo1tpe mfeiysfmDuln ont4arenxf3io1laDrli o;t  2ur(m io4ope  iciltfaDrmurpnu4ole mfetlsls rmump () rxrmr3iotfp e ivs (  2uoxo3ny4omt lfcsl() 2rau  no1oleo ieiytls2emnvsn(0aetrmo3oytfaDeau i ()teuoimpiu1al e fetat) 2uau  ;o0apt  i3iad aDua(vs;(4artrxrciotlp   ivo;()teumxm3nu1apt lict ()a2umx pot0tpt mf3iytfsDrau s (0teenmrcoo1lmD  ivslt)texmim3iu1aleelfvs t)s2rr(rp;u0alxomf3iys a ra(vp u) ltoxf3oo1oaDr uei;t)tetoxo3ny4lle  fvtl( arumx ooo1oeto octatfm uanmp t4artnmf3ootoaDeluvo s0 2xo(o ou1lmt  ietlt  Dtmxmpot0tle  icils a ea(vp t0aeerif3iotfmD ln i;s  rxo(r oy4amtnmfci ()srtaxrp;t4tlxnmf3tls s2rl( p u)arxnmr tytom elivsls trxoxmpiodlmtnlnvi sfs2uau o;u0oet mf3ilsfm2emnvonu0artrmf3oodlaDelivs ()s2xm(r3iy4am emivslt) Dumxro;o0oee  fctldla2rl( o (4tltrmf3to1fa  au ilt0srumir oy1lptemnetl(farururonu0optomiciyt s2rlnmsnu0texnif3iydfpDrluvsl(0s2umio ou1amt mfet ()arrmxmp;o4opeo ietyt s2em( p;t0tetoxo oo1fmDr ieo t0setmir3ou1aleelfcslsf ruau pou1apeo iciadls2elnmsnu) ltoif3tydlm raneo;t) rtmxmpno4ol nmfcs (fsDra(roou1tpxomoetatlm2rl(von() lerifcia1fpDr uvi;s trurxrpno1olt lneslt) 2tru o;t1tlxo i3iadfs2rmnvs;(0teeoio3iatoa r ieo ( s2xo(o3oy1olen fcsltfarumx o;u4opxomociadfaDum(vp () renif tydop eluvol( trxmimpoo4apeemnvsl(fa2rr(mpnu4opxnifeiad a2uln snt0trxoif3iydoaD lu s;t0trtoim iu4lpe  nesasf Dtaxrpoo1ale mfcildfs raumonu4arerir ta1lptr neo;() exriopnydlm  mfeia(fa2rrxr nu4opxomoeiadfa2rmu snu)arxoif3ty1fpteaiesls seuoxopoodamt  nviasf 2taxroot1tee miciad s ra(vo (4tleoif oy1fa  auvs s)trxrxr oydll nmicsatfs2rm( poo4oeto fciyt s2emumpnt) lxrmr io1oaD lu o;t tetr(m oodoltemnci sfaDumxr ou4apt  ieiyd a2ea(mon() renif oy1fmtrlies s0 etm(r3oo1lpe  ieslt)s2rrurpoo4open ietydlmDeanvo;(0texnir3ootomD livi;()seurxm io1lle lnvt tf rraxrpnt4ale mf3iyslm2ra(mo u4 lxrio3iy1fm   u o;t s2tm(r3oy1oltemivi tfa2uax  nu4tltoioetlt m rm( sn(0trxnifcoa1fmt  uvilt)texr(o3ou1opee ies tfsrtrurpot0oltnmoeiltlm2rmnvp (4 etnxrcoadlm eluvslt0s2xmxrpnu1lp emneilt)arrmurp;t4tltomociytfm2ua( o;t0trenxo totlpte nvs (0t2xoir iy4ope lnvia(  Durxm ou1aet  f3tydfm2em( snt)teerxf oa1fp eli o;s)seuoimpny1apt mivsls) rtm( oou4opeo octys a uauvonu0trxomf oadomte uvilt)s2trxm iudopen ictas) Dtmxrp;t1olxomocilslsDua(vo u)aexnxo3iy1omD  n i;(0s2tm(m ou4am nmivs s a2umu  ot0texnii3ildlm2emnmo ()arxoir3totomtrlnvolt0 2trim ou1ll  mfcsls) Dtaumooo4aex mfcilsfs2umn o;t0tetrmo oodlptrauei;s0 2uoio3oy4lpenmivtlt) Dtaxmpnu0alt ii3iatfmDrmnvo;(4 exnmf3ta1late i slt0t2xo(rpoy1ape  nviat artrx  nt4ape io3tys m2ul(ms (0trtrmfcoodoatrluvs ()truoxrpoy1optn ict s)aDra(mpoo0alxnmf3iys s rl(msnu)alerxfcty1fp eln i;() 2trio nu4olenmfes t) rumx pnt1tlx moctlsfsDrluvs t4trxomocoo1laDelnvols setr(r3oydop   nvsas arum(r ;u1oee ioeiat m rau s (0trxnircoy1opt luei;s0 2umxmpoy4ope lietasfa2tr(m ;u0oee mfetysfm um(vo;(4 etrmf tadlmDraneils)t2tmxrpiy1apenlneiat) 2tm(r nt0tetomfcilsls ra(ms;u)aexrmo todfatean i;t0texoirpoudlpenmfvsasfs2trurp;t4olxo i3tls aDuluvpnu0aetnio ia1omDr ieo;s)t2xrxm3iydol nlncilt) 2rmxmp;t0aeen o3tatlm ran p;u4altomo3tatfpD anvs;() eto(r3no1ap  liviatf 2trxrp;u0tlxomfeiydlsDuaumo ()aetnio iatfaDrlivi;()t2umxopnydome  fesls) 2ua(mpoo1aptnmoetldlm2eluvs t4 lxoio oatlatrlnesls srurir3ou4al nmfctl()aDta(rpou1oetnmictld a rlnvsnt)altomociytoat  neilt)srxoiopio4om elfvtlt) 2rmu pot1ale mfeiat a rm(vsnu4tlxoxo3ty1latrai o;t0s2urxopiy4oltelicilt arrrxr ot0aet ii3tls m umn o;t4texnifcoadla  luvs (0seum(o iu4op emnvtasfaDrmu pnu0tlen ietyd mDra(mont4alxrif3oodlpDrau s;s  2xoim3oo4lpt  ics s) Dtr(r ou0olto o3tas sDemnmp (4tetnxfctadop rlu ols0 2urirpoy1apenlicsl(fa2rau ont1alxnii3tldfs2uln s u4tltnxf3oytlp e u i t s2xmim3iy1oltnlneils)artaxmooo1tet mictldfm umnvp t) renxr3ty1omDrlies s) exoirpnudlpte nvsa(  rua(mono0tpeoii3tysla rln p;t0tlermf3oytop   i i;t  rurxr oudamenmfvt s)aDtmx o;o1alenmo3tlslmDeln o t4 rtrxfciodfmt  i o s0 rurxo3oy4lm  lieil(f rua(m ;t0ape io3iysls rm(mpnu4aeerif3oatopteli s;t0 exrxo io4am emnesat)aDrmu  ;t1altomocils mDelnvp t0arxoxfcoo1la e nvs;t0trurxr oy4om  lnvias  2rr(mpot0ole  fcils sDeluvon()alxoxo3oytoptrlieils0srtrio oy1ol   ieslt)srurur oo1tlxo ietatfa rm( o t4alerxf tydfmD livs s) 2uoxm3iu1llenlncia()aDuaxmp;u0apxnmfetys mDuln p;u4altomf3oatlaD  u o;t  2uoimpoodole mfcsltf 2rmxmp;t4opxnifciyd a2rm( pnu) lxomr3ootlm elueil(0 rxrxo iu4lp   nvsasfsDtr(ro;t4oexnifciat mDea(ms (0 lerxf3ty1la eai ilt  2umxr io1lp nmnci (fsDumumo;o4aee iictasla rlnvp (4aeerir3oa1oaD lieo;s)t2xmim nudalenlneilsfaDuaxronu1tetoiiciydlsDeaumo;u0 renxociy1lm   ieo;t)s2uoxo io1apen iet t a2trx oot1ope  icild sDumnmpnu0tetomf iotomDrln sl(0sexr(o3no4amenmnvsltfa2ra( o;o0tpeo fetysfaDulnvp;u4 ltnmrcoy1lpt auvil() eur(m3nydlmt mnci (f 2tmur ;t1aleo oetadfm2ranmpnu4artoxfcoadopD lu olt truoxmpno1oleelfei (  2trx oot4tle  oeiaslm2uanms (4 eeomr tytfm eln s;() 2to(r3nu4altnmfesltfaDtmxrpno1opt iictydlaDua(vp;(0aexnmf3ty1fp  livol()t2um(rpoy4lmtelnvt t sDtaur nu1oltniiciys a2emu s;t0aetoxo3tydlpt  neo (0 euoxm3iodopt lics ()sDrmx ont0aptn i3ildlsDul( ont)aetnmoctotlmDeln ils0srumxr3iudap nmnctlt)sDrrxmoou1oexnifctadfs2umnvpnu0tetrxo tytoa eanesls setmxm3no4ame mfct tf Dururp;o0alt ifctysls ua(mpnt)trerxr3tadopt an s;t0 2xoimpny4opeelietl(f Dtmx  ou4oleoif3ilsfm rau o u) exnxo3iydlm rlu sls)srxr(r3oodol  mieta(fs2rm(root0oleomocils aDum(vo;u0altniocoytfmDe i i t0srtr(o no1opeelfvslt  ruaur nt1oleoiieilslm um( s;t0 renio iotlm   ues ( trxoxo iu1am  lictat srtmxront0aeeo fctasfm2rluvp u4 rerir iydom  luei (0trto(m3oydal   net t) 2ta(  ;o0oltn i3iyd mDelnvp u4texrioctydfpDelnesls tetrxrpio1omtnmfeilt  2urur ;u4oeen ociatls rl(mp (4trxnxo iadoa  an s t0s2trio3ny4omenlfvs ()sDtaxrono0opeoiocilsls2rmnvs;u0 rxoxfcoodfpDeaueo t t2xrxrpnodole  fcia( arumu poo4aexnii3iatls eln o u)artoxrctatop   n o;(0 etoxrpny1ole  fcs sfarrau p;t0altnmfeiatlaDul( s t4tlxnxr totfatelneo;( teuoim3nudlpt lfes s s2ur(monu0tleoio3tytlm2rmuvs u0 etnir iytlpDrlivolt truoiopoydap nmies ()a2uau oot1opt  ieiysls um(vs t)tlxomr ia1lpte n ol(0srxoio ou4llenmiei ( sDurumpoo1olx ii3iltla2umu o;(4tltrmoctotfpDrai slt) rxmim no1omte icsl( aDraxmooo0tleniictatlmDumu o;(4tetrxr ia1oa  lieo;(  eurim iy4ome lfcs ()sDtau  ot1olenmoctat m2rlnms;()tlxnif3totla elieils0seurim oo1lptnlnes t srtrxrooo4tetomi3iltls2eluvs u0 renmf tytopt  n olt0 2xmir iydol nlies tfarrmur ;t1aee ifciyt aDeanvs (4aeerxfciotfa eauei;( truoir iu1lpeemfetltfsDrmurpou4aee mi3iaslsDrau s;t4artoif oy1lp r ueolt)t2umimpiy1omtnlicta(f rrmu onu0tltoifetatls2em( s t4texrmfciotop raies;( trxoxopoo1lm   nctasfaDur(m no4tltomi3tydlm ul(vs;u0 rtrmfcty1oa eanvo;s0s2urio3io4lm nmict sfs2taxmpoo4optoifciysfmDemumont)trxoircty1fmDrluvi;s)sexmio3io1lle licsat)s2rru pnt1aeeo ictyslaDranmsnu4 eeomo3io1la  aivs s sruoxo oodlme lncia(faDurxrpou0aetoio3ilsfs uaumo t0arxnmr3todfa rai s;s)t2xoio iu1op e nci t)arumxmp;o4opt  iciadfaDuluvon()alxrio3oodfa r uesl( s2xm(o oy4lm  lnesls  rum(r nt0tleoio3tasfaDel( p u)alxnxf3oadop e n i ()seuoxm io4lmeemfcilt)arumxmpou1aex  feiyt m2el(vp;u4aexrif iotop elneils s2tmxm3nu4op n ietat)arrrxmo;t1oltnmfetys m umums t4 eerxo oytoaDelivs;(0 euoxm oy1omenmiviat)s2rau p;o4tlxnmictatfm2rlumpnu4tltnxocoytlmt  i sls  exrxm3iodom emnvt (fsDurumo;u0tltomocilsfa em( ont0 lenmrcoatop raiei ()t2xoir3iy1lle mfetl(fsDrmu p;u4opx mf3iadlsDranmon(4 exomo3iy1fmt  ivo;t0t2urir3io4altemict (faDum(r oo1aeen fetadfm2rau o;t0arerxo iotfp e u ols t2umxr3iudol n fet t  rumxr oo4opeomociys sDrau pnt)aetrxr oo1faDr nvo ( texr(o3iy4olee icsa()srrr(ro;o1oeeo fciys m rau s (4 leoifcoytfpDelnesls0 2xrxm3no4lmt lfcsasfsDuaxronu0tleoiicias sDuau onu4altnmo3iydlp eai i s) ruoxr ny1amt  nvi tfartau p;u4opt  fciyd m emu pn()arerir3iydomD lnes ( trxrim3iy1lptnmfcs t)a2rmx ooo4tleo fciadls2ua(ms;u4 lxrmo todfp r u o s seto(r3nodoltnlfvs () rrau o;o4aex  oetatla2um(vpn() lxnio iy1oa  ln i t)t2xoimpoodom e ivs ( a2ta(m ;o4oetnifeiasfsDrauvs u4altomf3ootfpDeln ols0srtmio nydlltelnvias a2rrxronu1altn ocias s2rluvs (4 ltoxf3todfptr n i s0 2xmxm iu4al  mncias) 2urx ooo0tetoioetad s uluvo;(4 eenxr oydlmt ai i;t trumxrpno4ll elncs sfsDrmu  ;o4tpeo f3taslmDul(mpn(4tlxrxoctotomtrau s t) 2urir3oy4lptelfet tfaDtr(  ;o1teen ietyd s eanms u4arxomo io1lmteauvil(  rtoxr io4ap nlneiat)a2rax  ot4tpeomo3tltfmDumnmp t)aexrxo3ta1opDr neo;s teur(rpiydamtemici t sDraum ;o0oexn i3tatfaDuaump;u) leoio3ootomDr nvo;s0s2tmiopnydol   fvtat)sruaur ou0tptoioetlslm rauvsnu0trxoxo3oatlaDrai ils srxm(o oudlme mneta(f Durxmpnu1apxn o3ildfm2ul(mo (0aetoxr totlptrai s s0 rtmio iu4lptnmfviat) rtmxmp;u4ole mociaslaDumu p;t0 exomfcootopt au s s0t2tm(mpoudolt  iesas)s2uaump;t0aeenif3tadlsDrl( s;()tltoxrcoy1laDr neo;( sexmxopoo1ap nmnvsls s2tmxrpnu1texoif3iydla rlums t4altnxr3ia1oatr iei;() rurir iy4ope lfvils)a2rruro;t4texo fciys m2eau pn() exnmr iy1opD livo;t0 rtm(opnydopt livsls  rta( poo4tex  ieiaslmDelump;t0 eerifcio1latrai sls)t2uo(opiudlme  ieta(fa2ur(r no0tlxoifeilsfsDeau o t0artrio3iy1omt lnvi t texoio3iu1lmtnlivil()a2rau  ;o1tleomictlt mDuaumo;()alerio tydomDr neo t0tetoxo3nu4apt  nci ()s2uaump;u0oetoiieiysfa rmnvonu)tlenxrctatlate n o (0 exmxrpno4lmenliciat srtaur no4ope  i3tld aDeauvp;u)tltrifciodlpt auvs;(0sexmxr ny1apt liesa( arrrxrpnu4ale mieiltlm raums (4aetoiociatfpDr iesls tetrxrpoudomeelnctlt  Duaumpnu0opeoii3ild a rauvo;()aexomfciytfpDrlnei s trxmiopoodap  lnci tfaDur(  oo0opx iicias a ulnmsnu0teenmrcio1lpt anvo s)t2tmxrpoudomt  nvtat)artmxr ;o4aptn f3tasfa2eauvo (0aeenmocoytfa rln i;() 2um(mpnodamtelfet s a2rrxmp;u1oet iieiytfm2ranmonu4 eeoircto1omD livo;( trxoir oudlme lnetatfs2uax oot4apenmfciytlaDuln s;t4 lenmocoydop eaneslt0 2to(m3nu4lmt lfvta()a2umxmoou0opxnmo3iad m2rl(vpnu4 rerxf ia1opDeaivsl()s2xrir iy4ome mnesls  Dtaur nu4texn feiyd m2rm(vo t4 etoxr todop e ueo;t)setmxm oo1apte nvt s) rua(mpnu1oeenmfeiysla2eanvs t0 rerxo3oa1lmD lnvs;( t2um(mpno4lle mfvtl( arrru o;o1apxo icils mDuaumo t4aexoif oodfm   u i t0 2uoxo3nydom nlnesat a2taxr ot0aee  ieiasfa eluvs (4texnxo iatoa raivo;t0trtrirpno4opt mfviatf 2taurpno1aetoii3tat aDelnms;u0 eerxf oy1fptr nvi s0seuoiopnudol emncs s) rua(mp;u1olt ii3iytlsDulnvon(0trxoio io1oateaueolt  rumir3nudam n fetas)aDurxrpoo0aee mfcilt aDeauvpn()trtnxf3io1fmtrliesl(0s2tmxm nodllte ivils s2umxm ot1olt  fctydfa2rl(ms;t0tlxrir3oy1fm ean i s srtmio nudlp e fesasfsrtr(m ;t1tpt iieiytfm2umu o;t0teeomf oadoateauvilt)srxm(rpnydalee nesltf rtaum ou0alxoii3tysfs rm( onu4 eenmocoadlmte ieol()setmim3nydlmt  ncia(fsDuaumooo1aleomoeiad m el( onu)arerxf ty1lm raiesls)t2xmir3nodomenlnviat sruru  nt4aetnmietys sDrluvont)aetnxo3oy1fmDe ieslt s2xoir ny4ape lnvt () rtrx pnu4tee mi3iaslm2rmnmon(0aeenxf3ta1lmteauei;( setmxm ny1openlncsls artm(m no1opeoif3tls sDeanms;(4 eerxf3ootfm rauesl() rxrimpoy4ap e ncslt)aDtrumonu1tetoio3iyd a2eauvont)aetniocoadfaD anes;(0setmim iu1olenlnvia(  2tr(ronu4alxoifciydlsDrlnmo t0 ltnmo3oydomtrlnvi t0 rtoxmpiudamee iei tf Drm(m ot0tlx mieiatlsDum( o;u0aeeoir iodfmDe n i;s0t2xrir iy1op e neil()arrmx  ;t0opx  feiadfaDemump (0trxrif iodfa e neils texm(mpnodoptemiesas) 2trxr ot4tltnifciatlsDuanvpnu4 etrxo3tatlmte ivils)texrio no1oltnlncils aDtm( poo0aptnmociydfa2rl(vo (0arxrir io1fptelu s;t  etoir no4om emictat)s2rrx  no4aexomo3ild aDrmnms (0artnioctydla  luei (  eto(m3oo4lltelfcils s2rr( pnt0alxn fciadfm2elnmpn(0teerif3tytlaDeaieils  eurimpiudap emivsl(fa2ta(mp;o0tpx ifciasfmDeluvp u)tetrir3io1lat auei;( s2trxopoudal e nvia( srrm(m nu1aetnifctls aDemu o (4trtnircoo1lm  livils)tetm(m3io4am e ictlt) Dua(rpnt0opto ieild s uauvs;t4 renmfciy1laDrlu o;s t2xm(o3oo1aptnmfvta() Dra(r ou1alxn octlsfm2emnmp t)tltrxr3to1lmteaies s)teto(o3oo1ap emfetas  rrmx  oo4aetnmfciadlaDuln pnt)tlxomfctodomt aues;(0s2urio3nydoptnlnetl() Draumo;t4oltoii3tyd a umnvs u4aleomfctytfa  lueslt)t2trio3no1lmtelfeils)artaxmp;o4aet  fetltfsDuan sn(0alerifcto1lmDeluvo;t s2xmxo ny4ol nmnvias)s2rrur ot0opx ii3iyt m rmu ont0 eenxo3oydlaDr nvi t  etrxm3nudlme mfei t)sDta(mpoo4olto ieiaslmDean p u4 rtoxr3oytomD lu s;()s2xr(mpiu1opt lieta(f Drr( ont0oetoioeiydlmDum(mp u4trtoif3iotfaDraieo s)tetm(m3ny1omtelncs sf rtr( pou1opt  ictatls2um(mp (0tlenxf oydfmteaneolt0s2urxopoo4lp nmfvsltfa2tax poo4apenmfetydfm uau s;u0trtnxr iatfat livols0srur(mpnodal elfeiat)a2rrumpoo4opeo o3iys sDeaump;t4 eerxr oy1lptrlnvil( setoxrpou1llte ivi s sDuax pnt1aexn ieilsfs umu snt)trtoxrcoydom e ivo;t  eurio3iy1apenlfctl(  rraur oo0tltnii3iatfm ea( s;u4alermf ta1lmD  iesls) 2trio3nodam   fvsls)a2tr(r ou4alenmoeiatlm eanvp;t)arermo iadoaDrln olt0s2to(r3no1apen fvsat)sDrmx p;u4opxnmoeiydls ean snt)artnxf3ty1omD lueo;()s2uoxr3ou1om  mfcsat  Dra(  nt0olto iciat m emump;u0alxrmf3oatlpDrlies ( s2trirpoy1lm nmfcsltf Dur(mpoo1opeoioctlsfa elnvs t0aeeomo3iatfptrauvo t  rtrxmpoy1lltemnet tfs2tax p;t4tpx  o3iadls umnmo;t0 rxrio iydla ranvo;t) exrirpnudal n fcilt)a2rmu p;t1tpxnif3tas m2ra(mpnt4 rtoxocia1fm e ueil() rto(opnu1lle mncs (f Dumxronu0tpt ifetyd m2ua(vs;t) exoxr3oydfmte neols) 2tm(r3iydolt mnvia(  Dumump;o1olto feiasls elumo;u0 rtnio3iy1lm elnvs (0sexm(rpiudll nmneiasfa2tr(rono1texnmf3iatlm2emn o;t)tlerxo3iodoa rai ol(  rxrxopnydamtemnet s sDrr( pou0alenmoetysla2ulnmsnt0aexrir3tytfm ean ols texrxo iudom emnesa(  2tmu  ot0oet miciys mDuauvo u)arxoir3oy1faD au o;s s2toim nudapt lneil() rtr(r ;t4apxn i3iyt aDem( s;()aetoxocio1faDraieols s2xr(r ny4optnlfcilt)aDrrxmpno4tle  feiysfmDumnvo u4 lxrxrcto1fa rln i ( texoxr no4lme mfeta(f Dtrurpou1teen oeiyslsDuanvp t0 etoxocto1lmte i il()sexo(r3oudam emivils  2trxrpoo4oee mfcildlm ul( p;t4alxrmf3tytfp  auvo;t  rtm(opiodol nlieta() 2trumoot4olt iieiytfaDra(mo ()trenmo oydfm rluvi s0texoim3nu4llenmnvs t)s2tr(rono1oet if3iltfsDulnmp;u4trxomr io1lp  livs (0 exrim iodol n fvt ( s2trxrono4oee  f3tltls2raums;(0tetoxo oadfpt aieo t t2urim oy1olenmicil() rtmu pot1tpen f3iytlaDua( o;u)trxnir3oodla  aivs (0sexoiopoy1ap  lfeiltfs2tax p;u0ale  fciasla uanvsnu4artnmr iodfaDrlivi;s0 rxo(mpiy4am  lnvsa(  2tmxronu0ape  fciytlsDumnms;t4altomr3iodomD lu s;s) rtrxm nu1openlfvia( srtm(m ;t4tetn oeiysfaDumnvo;(0altnxfcia1lpDe n s s0 rto(mpiy1op nmnciat arrr(mooo1opt  fcils m uaump;u)tlxnxf3iytla  ai ol( trtrio iy1ap e fesa(fartmxroot4opxnifeiatfa rl( p u)alxoxr3iodoa raivi;() exrxm3no1ol n fvia()a2rmxm oo1ape  o3ils m rmn snu)areoio todfmDe nvilt)setmxr nu4op emfvi s  2rmx  ot4tpe mf3tasfs uluvonu0altnxo iatfp  lu s t)t2xo(mpoo4om nlneias  ruax  no4olxnmo3tytfaDulumo t4 lxomoctatoa  an slt trtoim ny4op   fvi s) rurxr oo4oex iietadfmDelnvonu0arxomrciydoat luvs;s0 2tmirpou1lpe mnetas) rrm(mpou0oeeoioctytfa2ra( p t)aetrmr totla e uvi s)s2ur(mpny4oltemfei t arurxmoot1tpen ieiyt s2ea(vo;u4teenircty1latr nvs;t) 2tm(m oodlm nmfetl(  2rau  ;u0teto fctlsla2rl(mpn(0 etnif iydlm eauvil()trtmxo3iodomtelicsa(  rrmu onu1tlenmfeiltfaDemums;t4teermr3iatfmDeaivolt trtoxm iy4ale lnviat arta( oou0oex mfctyd mDrm( sn(0 rtoxf tytlp rli s;(0 exr(m ou1al nmfesasf rurxmpno0alt  f3ils sDul( o (0 rtnirctatomD aivsl( trxoirpnudlp elncsltfarurum ou1teenmietld mDea(vo;t)alxrif tydoa  auvi s  exo(m3iudoleemncs s  2tru pnt4olx iictydlm umums;u)arxrmf tydlpDe uvolt  2xrxopny4al   nvilt arrm(m ;t0oee iietyd aDemn pn(4aexnir iy1op   nes;s)s2xr(mpiu4openlfci ( aDrr( pou0tptoiictad m2ulnvo u4artrifctytomt lues t t2umxr3ny4lmen fei s) Dumxm ot0alxnmfeiys aDulu p;u0teeniociytoateanes ( teurim3iodal emneilt)a2urur oo0texomo3iasfa2ulnvonu4 lermr3oo1fpteli s ()sruo(opiu1optn iet sfaDtmurp;o1oleomieildfa elu s (4aeenir3oatlp rlivsls) rtmim iy4oltn nvs (fs2tr( pnt0aetoio3iys mDumn s;(0altrir ty1oaDe ueo;s sexm(rpno1ol   icsatfa2ur(mont4apxnmoeild s2eau s;t4tetnmr3iydfm r i ilt)seumimpiu4omtn ies t)a2rau poo0alt  fetydlaDul(mo;t4tetnxrciy1fmDraivslt trxo(r3io1lp   ictltfsrua(mp;t1opxnif3iadfs emuvp (4tlxnio iotfm rlneols0 exmxo oodapeelfvilt srua(rono4olx iieiadla elums (4 ltoxf ty1fp  lu o;s) rxo(r no1oleemfesasf 2tmuro;t1teeoifetydfs2rauvo;t4 leoio tytopDrlivo ( srxrxr iudom n fctl( artm(mooo4teeniieiyt m2eau p t4alxrirctodoaD ln i;s  exmimpno4lm n ics ( s2uau  nt1apx ioctyt m rm( o ()aexoxf3iytoatelies s s2tmir io4lltelnetls) rurxmp;u0tlto ietld a2emu s;u0 rtnif3tytlp rai olt  ruoxm3no4lmte fetatfsrtm(rpot4oeen octysls ulumpn(0 eeoxr tydlat aivo;s) etoirpiudll nlivtl()a2tmuro;o0tpt moctad aDrmn s;u4 reoio ootfaDe nei;(0s2urxr3io4am e fes t sDta(ront4tptomfeiadla rlnmont0 eenir3ta1fa  lu s s) 2toxr3oo4ome  nes s) Drmuronu1oexn feiad sDuaumpnt0texnxfcty1lmt liei t s2urxr ny4ape lfvtlt srum(mpno0tetoiicildlm emumo;t0alxoxrctodfpte iei (0t2umim oy4amtemncs () Dta(  no4aeenmicild aDranvp;t0arxrirctotom eaiei;t tetm(mpnudaltemics s)srtau  nu1texnmieiyd a ea(vo t0artrmf3tatlp  luvs;(0 2tr(rpiudomen ncsat) rum(ronu1ale iiciatls2el(ms;u4tltoir tytoptran i s trxm(o iy4aleemfvs s  2taxmoot0tpx  fciyt mDrmump;() lxomocio1opteaivilt t2xr(mpoydole mies ( sDrrx oou4tpx mf3iydlmDum(vpnt4 lenxociotopDeaiesl(0trurir iy1al nliesl() Duauronu4texn ietls m ea(mpn(4tltnmo iydoaDeau s;() rtoxrpnu4lmte ict ( sDrr(root4tlen oeiydlm2rl(vsnu) rxoxr ty1lm eli o;t trtoio ou4ll nmfvtltfartrxm ;u4optnmoeiytfs ul( s;(4 reoxfcto1fptr ueo;s)trxmir oydamt  ivtlt sDtmu onu4tpt if3tyd aDraumo;u4aexoxo3iydfa ranes;s0trto(o oudome  ivsat)s2uax  no0tlxomfeiadfa2ean pnt0texnifcoydla eaivi s  rur(m3nudam eliesltfsDrrumono0altniiciat a2um( pn(0 lermrctytfpDeau s t  etrxr oy4omee ivtl( sDuaxronu0tlx moctld a elumo ()trtoio iytla ean ilt texoxm3io1lme lieta( srtmx pno1apt iictld s2rm(ms u0altomf3iodomD auesls sruo(o iudal nmncs ()s2umxrpot0tex ioctltlsDrluvp (0tltoxr3tatfmtrlivo;t srtoxr3ou1ape mics tf rta(  oo1olt mfcildfmDua(vs t)areomrcootoat  uvs s trxoxm nu4optemicsl() 2rmx p;u0ole  fetadlm emnmont4 lxoio ootla rlues;t s2trimpiy1lptemfvt s srtrump;u1oet ifetltfs2eauvp t0aetrircoo1optr nvi (0trxoio3iy4op e ieias)srtaurpot0oet mfctat aDuaumo t0trtnif iatlmDrauvsl(  rxmio oydlltemietat) rta(r nu0oltnmictldls2eanvs;()tlenxo3oydopDranvi;t0sexrir ou4llenmfviat)sDuaxronu4apeoif3tatlsDuanvo t4tleomf3tytfate n i;t teumimpoo1ap  livslsfsrtrumono4alx  fetaslm2rlu s u0tlenmf3oydlat  uvi;s0trtr(r no4ll e ivsa( a2umum ;u4aetniictys sDuanvs;u0trenmo iadfpt lnvo (  euo(r io4ll n fct (faDtru o;o1aeenif3iadlsDuauvp;u0trtrirciytla raneils)srumxrpoo4ale mictls a2umxmp;t0teto i3iltlmDumu o;(0 lerir oo1omDrlies s)trtmim oy1lpeemncsat a2ururpou4tee iieildfs uau p;t4 lxomocoydoaD au s s) rtmxmpio1ol e fei s) 2ta( pou4aet iociytls emnms (4arxoifctotopDeanvs;t  eumxo3iu1op e ics sfartrx poo0oleoiieiyt a2rlu snu0aexrmrciydfpDean ilt)srxrxr nu1lpe lici t) rra(  nu4tle ioetydfm ua(mo t0aexriocto1lat aueo t seur(o3io4op e ivils)artrxront1apx  ociydla um(vp t)arxoxo to1faD ln s;s0 rtoxo iudoptemfvt tf rtrumont0ole mfciasfa2ulu pn()areniocoadlaDeaues;s t2xm(m3oodape mfetls) rumxm ;o4optnmfcilt m eau s (0 lerio3totoatrln o t0srtmxo3iu4op emnetlsfa2rmumpnu4aet moctadfa ranvo ()arxnif3iytlmt li i;t0srum(mpny1alen iei s)aDtaur ;t0alen ictlslmDelnvp (0alxomf oatfmD luvs s srxmxm3oo4aptnlnvilsfsrtrxroou4oee mf3iadfsDeaumsn(0alerio3oa1lptelu sl(0teur(m oudop  mfcs (farumxrp;t1tex ioeildla rlumont0trerxo3todop   nvs () rxm(m oo1lpeelnei t artr(rp;o1optomi3iltlsDemuvp;t)tltrir totlaD an s;s0 2umiopiydlp e fci s)srumumo;o0tpxnmf3ildfaDelu o u)tlxrxr3oo1oat  nvilt)setr(r3nodaltelfesls) 2urx  oo4oeeomicias aDea(mo;t0arxnxr tadfpt auvi s0srtm(mpny1lmtnlfctatfsDuru pnt4optnmfeiytfm2rl( pn(4arxoxrcoa1omD lnvs t srtoxmpny1amt mici t srtr(m nu4tee iietyslm uauvs;t) rerxr iytomteaivols  rtrxrpiy4optnmnviat srurx oot1oleomfctltfa2rln snu) exoxr3oatfm rai ol(  eto(r io4ol nlics () 2rrxmoot0tpenmfeils a ra(ms u4 ltoio tydlm e ueo;t0 eto(mpoy1ol  mfeia() 2tru ooo0tpxn octyt mDel( s u)altrmf3tatlp  auvs;s  2to(opiu1ap elnvsasf Dtrur ;t0opxoio3ilsfm2umuvo;u4 rtnxrcoadlaD auei ()texoxopiy1llen fctl() rurxrooo0tpx mfeiad s2ulnmp;u4texoir3ty1opD lnvslt  exoir3io1lme mfeils)arrmumpot1opx ii3ild m2rlnvs;u0trxnir ty1laDrlivo;t) rurirpno1ole mfesls) 2ra(ro;o4tex ioeiasfs2ulnvs;u0tlenxo tatfa r neslt0t2urxo no1am nmncs t  2tm(mpou0oet iicilsfa uln p;u0tetnio3oo1lpt  ivi (  2tmxo3iodaleemiei (  Drmumpou4apx if3iyd m2rluvo () lxrmo3tydla e neilt0sexo(r iu1al eliciat)s2urum ou4texomociys m elnvonu)alerxrciy1fpDrai o;s0texmirpoy1opte fes ()s2trurp;t4tetniicilt m2rauvs;()tleoif3ootlm elivo;s0 2tmiopoodlpe  ietls) 2tmxmpoo1aex  i3ias m2rm( o t4trxoxrcoydlaD  ivi;t setmim oy1llee icils) Drmu poo1alx iieiydla2emnmo ()tlerxocoo1laDrlieo s srumxrpoudomt  iesat) Dua( p;o4ope  f3ild aDrlnms ()arxnmf iadfpD  ueo;s)t2urxr3oy4am n netas) 2ururo;t4tlx iictytfs2uau p (4texnmrctytlat aivi;s)texrxrpoy4ale  nes sfs2taxmono4alt mi3iyslm2umumpn()tlxoxfcto1op r i s s0sexmirpiy4ale liesltf Dtau onu0aee mo3tadfm2rm(mo u4 rerirciadoat  nes s t2umim3io1ap  mfei sf 2ur(mpou1aet iociyd m emu pn(4tetnxo ta1fmDrli i (0 rtoirpoudlmeemfeslt s2rrumo;t0oeenmociatfaDraumsn(0artrmf3iatfatr neo s  2uoirpoudomeemnviat) Draxrpnt1ape  o3ilsls2elnvs u4tlxrif3iytfaDeai ols) 2trxr3iy1apt mfcsls)aDraxro;u0tee  ociad mDrm( pn(0 rtoxf3io1omD lnei t trxm(o3nu4lptemivt ( artaxmpnu0olxo f3ilsfmDem(msnt0 eermo oydlp  auvo t  rtmirpnodlptelivt sf 2urxro;u4opt mi3tat m rlnmp;()aeenxrcta1faDr i ilt s2um(o oydal e ietls a2umu onu4alxnif3iatlm2umnvo (0 rtnxr iadfmDrluvs s srxrxopoo1olt livslt  2uaurp;t0texoioetasfaDul(mo u4tltnir iydopte u s;(0srto(mpiu4opte neilt)srtax  ;o1teenmicildls rmnmpnt)alxnmocoa1oa e n ol(0 rtoim3nudlpte ivs t  rtrxmono4tlt mf3ilslaDrm(vp u)tetomfciytopDeanes (0 rxrirpnudlptelfvtls) Drmx pnu4oeenii3ildfm2ra(vp;(4trtomrciodfm  lu sl(0trxrim oo4ol nlneta(fsDur(mpoo4tltn octys aDemuvsnu0 lxnmo tatopte neo;t s2xmim ou4am emnvtat)srurx pno0opt  ietltfa2umu s t0 rtnif todoaDr u o ()tetm(mpio1alt lics sf Drm(mo;o4apt mieiltlsDumumpn()tetnxo3oytfmD  ies;s t2xoxrpiydlpte nvi sfs2raxrpno0tex micilsfs2rmu o (0 eenmoctydfmDr nei;t0trur(r3io1ope lfei s srrrxro;o1tlxniociltfs ranvp;t0tlxoif3oadfmDeauvols0 etoim nodlp n ncia(fsrumxmpnu1oetoii3tadlmDem( sn() rerif3tadom  ln i;s)s2tmxo io1omtelietasfartaur oo1texniicilslsDem(vs u)alxnxf io1lmtean ol(0srxoir ny4lm   nesatf 2trx  ;o0olto octad a ulu p u0 renxo3oydfmDe ieol(  ruoimpiy1ale licias)sDra(r ;o1oleo o3tld s em(vs;t0 lxoxo ty1lpDraivslt0 rumxm3oo4lpeelfeils  rtrx o;u1alt io3ilsfmDua(vs;t4 eeoiocoadlm raivo;(0s2xm(o3iy4lpeemiei s aDtrx  nu0tlt ifeild s um( s;(4areomo3oodopD  ues;(  2tm(rpnu4lle  ictlt) Draxrp;u1ape ifctlt m ulnmsnu0artoiocoo1om e uvi;() etm(r nydomtn ictls sDurxrpot0tpeomociysfm umu pn()teenmr oa1faDr ies s0t2toxmpnudap emivt t srtmx pnt4tle mfciytfsDua(mp u0arxrxocoytoat ai s;s0srxo(opny1amtnmnci tfarrrxmo;u0aleomfeilsla ranvp;() rxrxfcio1lptelnei;s)trxmxmpou1lleemfvtls) 2tmurp;u4texoiociysfm el(vpnu0aeerxf3iatlptrlu i;t0 2umio io4lltelfvtas a2tmxmonu0texo iciasfmDrlu o t0 etrmo3totlm  lieo;(0 exo(m no4amtemfetls sDtm(rp;o4oex io3tydlaDea( s;t4 rxoxo iy1lmtrauvs () 2xoxr3oodomtemnesls)aDtaxrp;t1alt micildlsDuluvo;u0 etoxo iotfm eau o t t2trirpiy1ap  micilt)artrum ot4texomfeildfsDrlnms;u0 rxoio3oa1fpDr nes ( tetrxr3iy1llenlnetas)srur( ono0tleo f3iytlaDemnms;()aetnmo3oadop e ivo;( sexr(o3nudlm nmnvsa()s2rr(  nu1aetoifeiltfa2uanvs;() lxoirctatfptran ols  etrxo3nudam nmici t  2ra(root0ole mi3iys aDra(vsnt4 exomo iytfmD  u sls0 2umimpiydolenlneiasf ruaxr nt4aeen ieiydfa eau on()aexomf oo1oa  aieo s0s2tr(r io4lltn nctlsfsDrax oou4oleoioctldfmDulump;(0tltoxf ta1om  livi;()setoxo no1ap emfvtlsf 2ur(r ;o4olxnio3tyd a emnvonu0trxoif io1lat  n i;s0trtmir3oudlpe lietas aDtmu p;u1tpxomietys sDulu s;()trxnxr iydfaDe nvo s)s2trio3no4apeelfesltf 2umur ;t4aee  ocildfa2ea(mpnu) lenxrcia1lmteaivs t trxoim ou4ome lnviltfsDuax pnu1apeomfciatlm eanvonu0treoiocoadfpDrluvo t0seum(o3oodop nmnvia(  Durx  nt4altoioeiasla rmnvp t4 rtrmrctydoptraiei;s teum(o3ny1olenliviat) rtm( pot0apenmf3tytfaDrl(mpnt)teermo ia1lpt  uei t0 ruoio3io4ol emivilt)artmur no4oetn fcildla uluvp t)areoif3iy1laD aueo;s trurxm3oydll n icsls)sDum( pno1tlxn i3iydlsDrmuvs;(4 lxnmfcoadlpte nes;() 2uo(m3iu1lmenmnvtl(farrr(rpoo4oetnio3tldfa eau s;u0artoif3iytfmD lieol( t2toxrpiu1ol e ivs t  rumxr oo4ale mo3iasfs2eau pn() eeoir3ta1om rlieol(0 rxmirpoudol e fetlsfarta(  oo1ole ii3iasls ean s (0 lxrif3tytlm ranvi;s0t2trxr3io1aptnmncsa(f rtmxrpot1opxnmf3ild a2umumsnu) exnxf3oatlp r ues t) rtoxr nudam nlfci () rrmurpnu4apenmf3tadfa2rmu onu) lxoiocootopteli sl(0t2tm(r nodlm emnet s arta(root0aet io3iytfaDelnvo;(0aexrmfciadfp  aivo s srxrio nu1lpenmnesasfs2taxm oo0alen ieild a2umnvp;u0 etrxfcto1oatraneil( s2tm(mpiudamt mneilt aDtm(  ot4oltoiociatfmDrmumont4alxoxo3ia1laD aies;t0setrxr3nodome lfesl()sDtmx  ;t1alxnmociytfm2emnvpnu)texrxo3oytlaD  i s;s0 2xriopiydlpt mncia( arururo;t0aptnmoeiadls ranmp;u) rermr3totlaD livi;t0srxm(m3ny1apenmnvslt)a2ua( ont4olxomo3tysfmDel(mont) ltrxf iadfmD auvi;t)s2trxr3iy1altnmfci t sDua(m ;u0alxo ociydlaDrluvo u0texnxoctatlptran i ()setm(m3oudlm n fet s) 2umurpou1ape ioetadfa rluvp;t)artoir3ty1oaDe ueils  exoio iydam n nct t artrxront0aptoifctat a rm( o u4tlxnmocoytla elnvols) 2xoxr3iudllte icias a2ur(m ;u1opxoiociyt sDra(mo;t0alxrmr3tadfpDelieols0tetr(opio1lpe  icslsfarurxronu4tlenifetltfaDemnvp t4 renifcoytopte ies ()sexrio3nu1oleelfciltfaDumxmoou0tlxoiictytlmDua(mo (0texnxocoadoate i sl(0 etr(opoodolt licta(  Durxrpnt1opx  iciysla rlumo;t4 rerifcty1lat luvil(  euoio no4olen ictl( s2ta(r no1alt  i3iatlm2el(ms;u)teenxf3todom   ivi;( sexrim oodlptnlnvsls)artmxro;o4apx moetad m raumo u0 rxomociadlpDrau i s0 exrxopio1aptnlnesa() 2rrxroou1tltomi3iysla ea(vs t0trtnxr3iytop elieo;s s2tr(rpoo4ap emivil(fa2tru ont0teenmieiadlm eln o;(4artrxo ia1fate uei (0tetmio iu4llt mictls)a2ur(m nt4alxoii3iytfmDemu p t4teenifciodoptr nvo;t  2toxr3ou4om  mnvilsfa2rrxmpnt4tleomiciad a2emnmpnt)aeeomrcoytoaD ln s;t0 2tmxrpiy1optnlfeil( sDrmxm ;t4apenmf3iyt mDuan o u0tltnxr iotfaDr n i;s)t2uo(mpou1ap nmictl()aDum( o;o0aetnifciatlm2rm(vo;() eerir ty1fate u i;t  2tr(rpoo4ole mietatfa2tmumpnt1aex ioeiasfs umuvsnu4aexnxr ootfaDr uvil(0s2tm(opoy1apte nct (f 2rm(ro;u1aee ioctyd s emnvs;()tlerxr3tatla   n o;()trxmirpoy1lle miesat aDrr(rpnu1apenmf3iyt a uaumo;()alxrircto1oaDe u ols  etmio3oodop  lfvsl( sDuaxrono0oleomocilt s rm( snt0artrio oydfaDelnvi;s trtmxm3no4llt mnvs sf Duaurp;t0tetnmietas m2eaumo t)tlxnmf3ty1la ran sls) 2uo(opnydame  feta() 2rrxroou0alx ifctytlmDel(ms;t0teermrciydfa eaivs s0 eumir3nu4ll e nct sfsDrru onu0apt ioeildlaDel(vo t0arxnxf3iotla elnvs;( srtoio3iydopt lncils) rra(m ou4aetniieilslm ulnmp () exnxo3oa1omDr ueolt t2umim nu4al elnes ()sDraxm ot1oltn oetat a2uaumo;t0alxoxocto1opDeaueo s)texmxm3nu1ll nmfvta(farrm(ro;t1oee  feilt sDeluvp;u4texomrciotlm ranvo;t)texrim3nudoltelnvt tf Dum(ro;t4tpxnmoeiat s2uaumsnt)arxnmrctadla   u i (  2tmxm3oydll elfetl(f Durx poo1tex  o3ildfsDrlums u0aexrxo3ootfat lueils) 2xmxrpou1alte fci s  Duru  nu0tltn f3ild mDranmo t0aetnifcoa1oatrlivsl()t2trxr iy1omtelnctlsfaDta(roou4aeen oeiad a2emu p u)trtoxfciadfaDeliei;t0 exo(r iodol  mncilt srrrxrooo1tptniietlsfsDelnmp u4 exnxo oa1fa  lneo;s0sexr(opiy1llt lnei ( sDrmx  oo1alxnmfeiatlsDea(mo t4texoircoy1oa  an ilt srtrirpiodlmee nvilsf Dua( ono0aeeo iciytlaDea(mo;() etnirciodoa   nei;(0 2toim iy1ale mfvt () rtaxrpnt0alxniocild mDrm(ms u4 rerirctydlm  lnei;(  2triopno1apenlnciatfs2umxrono1aeeo ietatls eln p t)aeeomr to1oaD auei ()trur(opou1omee ivtat)artrxmpnt1tpen o3iadlmDrauvpnt) lxrmr3tytopDe i i t)s2uoxopnu4apeelnetasf rtm( ooo4tlxn i3ias s el(mo (0 lenxocoodomDeln i t)s2to(m3ny1lmtemfeils  rrax  ;t0oltniietldfs2ul( s;t0aexoir3iadfat aieo;( t2xr(mpoo4ol emfesatf Dtax oot1apenifeild m2rl(vp u4tlermfctotomt  ues t0texrir nydolte iet (f Dtmxm no0altnifcild s uauvsn(4tlxnif iatoa  lueils trtrxrpiydlltemnctl()sDua(ro;t0alxomi3tyt aDul(vsnu) lxrio iytoptelueo;t0 rtmir oydlleemnvil()a2ra( pnu0alxomi3tytfmDum( s u4texnir3iytomtr nvolt  exo(r3oy1ape  fet t sDtrxmpnt4tleo fetad m2raums;()arenio ty1om  aueils0 eur(o iu4ape mnvsat)artax  no0oee iictlsla ea(msn()tetrioctadfaDeli s;t setrir3oy1lmenmnetasfaDuaumono0tee ioctaslmDrm( o (0teenxo oydfm elueilt t2uo(rpoy1alt lfviasfsDtmumpnt4aeto octydfm2ran p;(0 rxnxfciotfaD au olt)t2toxrpiodal   fvslsf rrrx onu4tlt mi3ilsla2ranmp;t0aetomf3to1optr ivo;()sexr(rpiudlp emfvsl( sDuaxr ;o4tleo fctys mDrl( ont0alerif iodfa r ues;s) etrxrpnu4opeemfeilsf rraumoou0oexo f3ils m2ulums u)trtnmrctodlptean slt srtrir3iodlmeemies t)sDrmx oot0tpto f3tysfa uan p;(4 ltoifcty1omD  u o;t  2xr(r3no1ale mnvta() 2rm( o;u1tetniietat s em(vp t4trxoxfciadoatr ivolt s2toxmpnodam e nvi sfsrtax p;u1tpxomoeiltfsDrm(vont0tltomo3iy1lmtrlnei (0 rur(m no1ol n nviatfsrurx  ou4aeenif3iltfm2rm(mpnt4teeomf3iy1fatelu o ()t2to(o iy4ll emfes ()aDuru o;o1oee iiciad aDuanmp ()arermociodlm e ues;t) rumxmpoydlpenmiei (  Dra(rpou4alenmoeiatlaDuan o t) exoxf oo1fmte nei ()srxr(o3iu4am elfciltfsrtrx ooo1tpt  fetatlm2rmuvs;() eerir3iytlptelnesls0 2xr(m oydllenmivi (fs2uaur ;t0openmoeiyt s umumpnt)alerif3iydfptrauvi;s0s2to(rpiu1lmtnmicsat) rua(rono4oleomocildlmDra(ms t4aetrmo iodoa eaivo;t) 2uoxo3oy4ape  fciltfaDurxrono1aetoiocilt a2rmuvs u0 exnifciadlptr neol(0 2xrxmpou4al  livtlsfsrur(rpnt4aet moetas aDrlumonu)aeeoifcoydopt ln o;s) etmir oo1olt mncils) Durumoou4aex  i3tysfs2ul(vo u4treomo iydfm   n o;s) rumxmpnudop   ivt tfsrra( oot4tetoifctydlsDrl(vp;(4tlenmr io1lmt luvs (0t2um(o io1optn iesa( a2rr(rono1aleo f3iydls elumpn(0aleomo3iytfpDelivs ()s2xrxm3no4alt mfcsls)srraumpoo0oex  ieiydlmDulnvs t)alxrif3ootomteanei s0sexrim oy4aptnlfvs t) Dtmxrpnt4oex io3ilsfaDraums;u)alenmo3ta1opD aivo () rxmim iy1apt lfcs tfa2trx ooo1tetomoeiydfs2emnms;u4teeoxf3ootlmtr iesl( trurxopiu1om  mfcsat)aDurxrpno1apx  f3tyt s2ra( p;u) rtoif3oatopD lnvslt s2xoxopnydlme  fcsl( sDtr(moot0oeeo iciltlaDranmp t4 rxomrcoytoaD  n o;t) exoir3iodlpt mfvtlt  rur(mp;u4tpxnmf3ilsfs2rln o t0artoif oytlpDelivo s)trtoio oodoptnlfei t aDumxmont0alenmi3tasls2ra(mpnt4alermfciatlmDeli o;()trxr(mpio1omtn ict t) rum( pno1ale  f3tydfm2eaums t4 rxrif3io1laDeau ols srtrxm3ou1oltemncsl( s2umx  nt4olx io3iys aDumump u4tetnircty1laDelu o;s)teuo(mpoodoleemfvsa(fartax ont1aexo ietyt a2eau o;t4teeoxrcoytla ranvo;t) rxoir3iy4lmt livsl(fsrurur ou1alxoii3iyslm ul( p u0altoio iotoateluvil()srumxrpny1ole liciat) Dtmumonu4aex  o3tatfsDumnvo u0tltrmf3oodlatelnes;( srtoim3iodomenlnetl()s2ur(  oo0aeto fetadfa ulnmo;u4 rerioctotlp   ivi;( srxoxm3iy1omtnlnet s s2ur(moot1optniictlt sDelnms u0altnir3oa1fate uvi;s0trtm(r io4omt mfeilsfarta(r nu0apto i3iytfmDum(vs t)trxoifcto1op eln sls) rxmim3iudlp n ivi s) rtmxroot0tlt ioeilslmDel(msn(0aleoif3iotlptr i ilt trxmirpoy1apen ivslt a2uaurpnt4oee  i3iatls uaumo u0 rtrmfciy1oatr n s;(0texrxm3oy1ll  lnvsl(farurxmpot4tee  i3ildfm uanmo (0aetrxf totlpteauvi (0t2toxopny1omeelicia(  2tr(  no1tee  ietldlmDeauvs t0tetrxr3iy1fp  lieil(0 2toimpio4apte net ( a2urur nt0apeomo3iadfs2rl(vs;(0 exomo iy1op  aueo s0 eumir iudomenmictat sDurum ;t0apxomf3tadfm ranmsnt)texrxo3totomte i ols texoio3nydlptnmfct tfaDtmxr ;u4opto f3iasla uanmont) etnif3iodlmt luesls0seur(o nodlleelncsat)arur(mpnt4tle if3ilt sDumu snt0trxoir3tydop eanvi t0trtmxmpiu1amtelnci sf 2umum ;u0tlx  ictld mDuau o;t4 lxomo3iotop elies t0setmxrpno1lm nlfesls aDrmu  nu0tlxomi3iad m2raump (0aeenifciy1lpDelivi;t0 etmim3io4ame  icia(  2uaumpot1tleo i3ilsla uan o;t0 eerxr tydopD lies;( texoio3ou4lp nlfvi sfa2tr(r nt4teto feiytfs2elnms;t4 rerxr ootlaD  ieolt)tetr(r oo4amtn fct (f Draumono4tet mfeilsfsDuaump (0 etrirctotlmDe nvo;() rxoim iu1lm n ncs (f rtrx o;o0teto iciadlaDrm( o t0 rtrmr3iytoa r ueils0texrxmpio1aleemncsat a2rm(m ;o0olx  i3iyslm2emuvpn(0trtomo ia1opt  ivs s) etrxmpiudopeemnciat a2tr( p;t0tlt mi3iydfs ea(vs u)aleoxr oodoa r nei;t  eumimpnodamee ncil()s2ta(r ot1tlen fciysfa2eauvo t0 eenmoctodoa ean s;t tetm(mpoy1lmeemfei ( aDtm(m ;o4texn i3iysla uauvp;t)arxrifcoo1omteau o ( trtm(m nudoptemnvs s)s2tru  ;u1tlenmf3ias m2umumo t)tltrif3ty1om  aivi;t0t2xoir oudameemivils)srrax oou4optnmoetyt sDrm(mo t4 etrxf3iodlaD lu s;s0t2xmim ou4opt lfvsas) 2rrx o;t4tet ioctltfs rln o (4aexrxf to1lp eluvil()tetoir oydopt lietl() 2tr(mpnt1tpeomf3tlt a2um(mpn(4areomo3to1om eau i s)s2to(opiy1aleeliviat)a2uaxmpou0apxo fetlsla2rm(vp;t4texrir3ootfpte uvo;( setoxm nu1apee ivilsf Drmum ot4tlxn f3tasls2rluvpnt) lxnxrctydlat lnvi;s)sexoir oy1amte iesat aDtaurp;t1alx  icilsla2el( p () leoir3oy1lptelnes;t srxo(m3oodlm e fcta(f Drmu  nt4apxomo3tlsls2rm(vpnt0trerioctatfatrli il() 2tmxm oudapt livsatfa2trxm ou4alt ifctys sDrmn p t0artnmo3totfm ean o (0 rumxmpnudopenlnvslt) Dtm( pnt0oexomi3iadfs elumo;t4 ltrmociatoaDeaueils seuo(o oo1lleemfvs (fsrtmxmooo1altomf3ildfs2ua(ms;t0trenmo3iytfpDr nei;t  exo(m3ou1lpt livsas aruaxmp;o4opxomfctyd a2emnmp;u4trtnif3totlmDe ivsl(0s2xoim3iydop elfvsas)aDtru o;t1alenmieiadfmDrmums u) reomo iy1op r ivols0t2umim3iudopeelfcsat a2ta(  ;u1oee mi3iysfa2rmnmsnu)trtnif3to1oa   u s () rxrim nu4al  lncsltf 2uauroot4aexniieias s rl(ms () eeomocootfpDe u il() exoim oo1olenlfcs ( sDtax  ;u0aeeoif3tadlmDemnmo;(0aexrmf io1oa rlivol()teuoio3iu4lpeemnvsatfs2tr(mpou1tle iociaslsDua(mpnu) rtomr3oytlm  ai s;()srtmxm ny4lptelivi ()s2rax  ;u1aptnifeilt m ranmsnt4arxrxf3oo1lpDeaivi t t2urio3oy4aptnlici ( aDrmu pnt1ape  iciyslm ul( s;u) eerio3oadla  lnes s0trxrxr ou4ll   icslsfsrtaxrono4tleomo3ilsls em( onu) rerif3todlmDrai s;s0s2tmimpno4lmt lfeiatfaDurx oot1opto f3iydla2emnvo;u)aleoxfcty1laDe ivo;t) 2tm(m nudol  mfet ()aDuau  ;t1oeto f3ias s2el(msnt0tltnio3ootom rai ils)s2uoxo nydol n fvt ()a2umxm no1apxo fetadlm2uaumon() eermf3todlpDrli o () etoxo3ou4lm nlnvia(  rtmurp;t0opto o3iltlmDeau pnt0 rxomfctadfa rauei;s0t2umio iy4olt  ivils) ruau  ;t4texn icilt mDean pnu4 reoxrcia1fm rlivs;t) etoir3iodomeelfvtas  Duaxmo;u1tltoii3tys mDelumpnu4 ltoxfcoo1fat aieo s0 rumxrpiu4ap e fct s arum(mp;t1olxnmieiasla ra( o u4aetnio3oodfm rli olt)t2tmxr io4op n iesa(  ruaxm ;t0optoii3ild a rl(vp;t) etoxfcoa1lp e i o;s trxm(m oy1ap emicsltf Dtrur ou1aee  i3ias s elu snu4altriocoytfpDeai slt0srxrio3iu1lmt livsls)a2um( p;t1oexoioctatls2umuvs (4tltrxo3ty1omteau i s0tetm(o iu1om nlietl( sDtr(mpou0olx  f3iatla rau on()trtomr3oa1fatr ivo;s trtmio iy4ap   neia()srumump;u1aex  iciatla em(vsn(4 lerif3iatlmt livils)t2tmio oo4ole liviat)srtruronu0oee moeiad mDemumpn(0trtnmr3oatomDr n slt)sruoxo3iu4oltn fei t)artm( o;u0tptnmo3iadla2uluvs (0 rxomo3oydop e i i;(0s2trxmpnydopee ncilt a2tmxro;t1oetomoeiadlm2em( p;(4 rxnmf3iydlatelneslt0texo(opny1alee nvsat)sDur(m ;u4tptomietatfsDea(vsnu0 etnxo3iatlat ai ol(0 euoiopny4lmtnlicsas  Dtmu p;o4ale  f3iysfs ua(vs (4 ltrir iydoptr nvils  2xoiopoodomt mnetlt a2trx ont1opxo o3iyd m2ua(msn(4aexoif3ty1fa eln ils0seumio iy1ol emfcsl() 2trxrpnt0tetnifeiysla2ul(mpnu4trenxrciodop  lueilt) etmimpnodllen nct t artr(rp;u1tpxniiciytla rl(vs () leoxo tatomt  nvilt0srtmxr oo1lm e ivt sf rumxront1optnmfeiatla2rm(msn(0 exrmo3oatlaD lnvs;s0 2uoxrpnu1ameemies t) 2ur(  oo0tpx if3ildfm2ulumpn(0trxomrciodlmtr u ilt0 2ur(o3ou1olenlnvtls sDtmumpoo4apxn ocilt mDrlu p;()aetnio to1fpDeaneilt0 rtrxopiy4ape mict t  2rmxmpoo1apxoifctytla ranmo (4altnmfcoodop eaivs;(0t2to(o nodlm eliei t) 2uaumpot1texomiciaslm2uanmpnt4trtrmo tytlmtrai s t) 2tmxr nydamtn fctl() 2ra(mo;o0tptnmfcilsfmDua( p u)alenxfcoatla eai o;()s2toxrpiudlmtn netlsfsrtm(r ou1tlxomfetldfm rluvo ()alxnmrciadoa rauvol( trtrxrpno4lmen nesls) rumxmo;u0alen oeiat s uanms;t4 lxnifcoadoatr ivo t)seto(mpiu4llt mfetltfaDurxm ou0teeomocilsfs eauvon(4texomrcoytopD anvo;( s2xrxm3oo1ape mfesltf rtmurpoo1aet  feiad m2umn o;t0alxoif3ia1faDr u i;t)teumiopiy1ap emnvt sfa2uau  no4tltnmo3iltlmDumnmsnu0aetrxf io1opt  ivo s)texrim ny1alt lfciasf rtax  ;t1aeeomi3ilt mDemnmpnt4texnircio1lmD lueslt)s2tm(o3ou4opeelnesa()s2ur( ono4ope  f3tltla2umuvo () rtoifcoytomtrlivi;s tetm(r3ny4lle  fctas aDrmxmp;u0aex ii3tatfm elump (0arxoir iydoa rln i ()teurir nodapee fesat)aDtm(mpou1tltn o3ildlaDrlumo;u) rxomr oo1lm rlueol() rxmimpnydoltnlfciasf 2tau  no1olx  feiydfm2elnvo t) rxnmo3tydlmD aues s0trxoio nu1omtemivtlt aDua(mp;t1ape ii3ildlm elumonu)alenmfciodoa rau slt  rurxrpiydlleemivsatfsDrrx pot0opeomoctys aDrluvp;(4trxnmf oy1oatrlies;t) ruoim iu1amenmfct (  Drru o;u1aee mi3ils sDrlumo;(0tetomo iy1fpte nei t)srxrir3nu1openliesa( srrrxr ;t0aptomi3iytfsDemu s t4tetrio ta1lm r u o;()t2urir3nudop e ivt (fa2um(moou4opxo o3ilslm em( s (4arenxf tatlp  lu i t  rtoir nu4apt mfvils)a2uru ont1apxoifeils s2uanvsn(0 exnxrcoadomDraneo;t srurxo3iy4aleelnviltf rrau pot4tlt if3tls aDuanvo t)altnxf3totfaD aieo ( s2tmxrpiudlptn fvtas) 2rru pno1aleo octysfs2uauvp;u0aexnxr ootfaDrli s;t teumirpoudlltemics sf 2um(rp;u1aptomf3iyt s2rlnmp;(0aeenir3iadom rlneo;s0setoxo3iu1lp n ietat) rua( pno0optniictltfa2emumpnt0altoxf to1fmDeai il( trxmir oy4omtn fvsls) rrm(  nt0tet  f3iatlm2umumo;t4 eermfciy1oa  lnvo;t srxoxm no4lme  neia()s2urum ot1open o3ilt a ra(vp (0trtoircty1op r ivi s0seuoir nudol emnetl()artmurpoo0aleomfetad sDul( p;t0tlermocio1lpD li s ( srur(o oodamte iesls)artmumpnt1apeoii3iadls2rl( pnu4aeenircty1fateli s;s setrio3ny1lpeelfviat)arua(  ot0tetoifeiydls el(mpnu4tlenmo3oytlmDran sl( teum(mpiydap nlnvslsfs2tmu ont4tet  ocilslsDrl(ms;t0arxoxo3tytfpD  uvo;()tetoir3io4lmtnlnetltf 2truro;t1alx micias a2ea( p;(4 reoifcoa1omtrli s;t0s2tm(r3ou4om  licsl()sDurxmoou0tex ifeiydls ea( p;(0alenif iodfa ean s s)s2toirpiu4op  lfciat)aDraxr oo4altoioctyd sDrmn p;t4 ltrmf iy1fpD  n i s0 rxmxo ou1llt  ncs tf 2truront4aeeoiieildlsDelnvs;u0 exoio tytlmtelivs;s)tetmir3no4lmtn fviat)s2umur ;o1aptoioeias s2emnvpnt0 ltoio ty1fat anvo s s2tmir3nydlp emfctl(  rta(rooo1aeen ictadfa eln p u0artrmrcoo1lmt ai ols0sruoim iodlpt livsl(fa2ra(  ot4tle mi3iys m em( s (0 rtoif3io1omtr ivs;t)s2ur(opio4ap e ncs t  2tmxro;t1alxnmictasls2em(mo;(0trenmf3oo1oatraies;t)srxrxo oy1lm  mieiat aDtaum nu1oee  iciasfsDem(vo u4 etrir oo1fatrlu o s0 2xrxo3io4om   ict sf rrax p;o4alenif3ilsla2rln o u4alxniocoo1op  lueo;s0s2trir3oy1omeemict s) 2raxroou4oleo i3iydla2rlu o;()trtoxfctotfmDr nvo;s seurim nudllenlneia() 2rrxm oo4apt  iciltla2rl(ms;(0 rxrmr tytfm rli i t)trtoio3oo1omtelnci sfs2rm( ono4tpe if3iadfm ea( pn(4 lenmfcia1fpt aueilt tetr(o iu1lp nmicsas s2rrum nt0aeeo i3tasfs2ra(vo t0alxnmo ty1om  an o s0seuo(rpnudam e ncs s)s2rmurono0opeoifeilt s rl( snu4tleoxr3todfmt lueolt0sruo(m nudapt micsl(  Duaxrpot1oet  o3iadlsDrmnvs;t) rtoxfciy1op  liei (  rxo(m iu4olen icsas  rumxrpnt0olx mi3iat sDulu s () eerioctodfp  aneil( teurirpoudll  mfesl(  2umxmoou0oeeo fetasfs2um(vo;u) rtrif todoptr u o;()truoiopou4om  mieils)a2rmxrooo1aeenmf3tld mDranms;(4aleoxo3iadomDrlnvs () etr(opnu4lleeliesls  ruaurp;o0apt  f3tasfa um(ms u4tltrio3iydoaDe uvols s2uriopnudol   ieslt a2uau  ;o4teeoii3ildfm el(von(0teerif totfpDr ieslt)s2tmxo iydol emfesl(  Dur( o;t0tpxn f3iltfa rlnvpnt)trermr3tytlp eli ils)sexmio3no4ome mieia(fs2ur( o;t1apeomictytfmDel(mp t0teerircootfp e neols0trtmimpoy4ale  ieiltfs2uaumooo4apenioctld a2ulu p () etnmf3ootfmt luvols0 2umio ny4apeemieiasf rtr(rp;t4tpt  feild m2rl(ms;() rtrxfciadlmDe nvs;t)s2tmxmpno4olen ics s)aDrm(mpnt4olto ocias s2rlu o;t4tlerxocto1om  aieslt0 rtrxo3nu4ol nlnvtls)srrrur no1tlx  octlsfsDean o u)tlxnmr iydopD ln i (0srurio nodlpeemicsa( sDtmum nu4alenmo3iatfs ea(vo;u0teeomo to1fmD au o;t) 2toxr3iudamt mieta(  2rr(mpnu0tleomf3tydls rauvsnu)trerif oo1opDr ieo s0trxoxo ou4aptnlneslt sDrmxm ;u1apx  ieiatfa ulump (4artomr io1fatrlueo;t0trto(m3oodolen ies t) 2uauroot1altomiciydfsDemuvo;t0teeriocoy1lp  lnvsls) rurxo3nydlm e fcia( srtrxro;u1olen f3tydlaDum( p;u4 reoxfciotfatran i t  2uoxo oo4al e nvsl() 2urxmoot4aeeoiieilsfs2emnmo;(0trtoxf ia1faDe uvs;()teumxr3iodame  nei (farrrur oo1opxnioeiltlm uaumpn(4texomfctydlaD an s () 2umio ny1al elfeil()srrm(roou0alenmieiysla2emnmo;t4trenxrciydfptrluei s s2urirpnodome  fciat  Duaumoou0tpto o3tls s2uanvsnt4 rermrcoodlptrln ol(0srum(m oy4omenlncia(  Draxr ;t1tltomiciadlm elu pn()texnmr tadfm e u ol()srxoxrpoo1op nlfvtls)artm(mo;t1apeoiietytlm ea(ms;t0tltomoctotoat lu o s0s2xr(o3nydom  lictas)sDtaumpoo1olx mf3tasla rmnmont)arxomo oydom   u slt  euoir3oydoltelneia(f Drmu poo4aetniicilsfa emnvo u0tleoir tytlpD ai ils0 2umxm ny4omtemiei sfaDum(ront1aeeomocildfa em(mo (0 rxnir3oydoa  lues t0s2urim3oydlpenlfvi s) Drr( pnu4tpenif3ilsls2rl(mp t0aetnxrcoa1omD  uvil(0 rxmirpoydalt  nvsasf Draumoou0aee  fciltfs2rluvs;(0treomrcoo1fpDe uvi ()seurir3io1om nmicias sDraxrooo1tleniieiys s rm( pnt) exoxo3iadoa raiei t0 rxoiopnu1omeemfcilt) Dtmxrp;o4olxnmi3tysla2ua(mo;() rxrxf3io1optraivolt)trumxo oy1lmtnmiesa(fsruaxmo;t0olx mfeiltfaDumu p;u)alenmoctodfptran o (0 2xrir nu1ole lnvias  rra(rp;o1tltniociyt mDemnmsnt4tltnmo iytfpt an sls0srxrirpnu1olenlfvi s) rta( pnt4optnmf3ildlm em(vo u)tlenxf3iodop eauesls  ruo(o iydll   fes s)a2rau  ;t4tlxnmfciysfaDea( pn() eerxrcoatfm eaueols0 etmir ny4olt  iet (fs2tax  ot1opeoifciysfa2ean on(0tlxrmf tadfpt anesls0trxmxopno4am nmnetat)a2rr(root1tetn icias s2eauvp;(0trxrmo to1op r nvi t0srxmxm3no1ll   feil()srtax onu4opeomf3iad s2elumo;u4arenmocoy1latrlnes (0 rxmxo io4lpenmfvslt  Dtrumpnt1tpxomi3tldfm el(vsn()artnmrciatfp eauvolt  2umio iodaleelfcslsfsrum(mpot4oeen i3iadls ulnvs t)teerxr3totlmD livol(0 eum(o oo4apen fet t)a2um(  no0oeeomoctysfm ea( o u0trermfctodoa  anvi s setrxr nu1lpeemnvtas)srra(m ;t1teeoifeiasls2umuvo u)alxnmf oydomDe nvslt  rtoxr3oydame lncil( s2ra(m nt0alx moeias mDumuvs;u0 ltrio3tytfpte nvo;t)setrim nu1ale lietltf rrmx oot0opx  o3iysfa elu p;u4 eenxr iotlp  auvs (0 2xmxm iy1alt mfeta()s2ta(  ;t4apxn fciatfa eluvs;u4aeerirciytomtraivs;()setm(r io4opeelfviatf rtmxmpnu1oexnif3iltls2ra( pn()tltoif3to1oat aivi;t0 etm(opnodape mivt (farrmumooo4teeomi3ilslmDel( o (0aetnxf3ta1lpDeai ols0texriopnu1lpen feta(fsDtm(ront1tetnii3ils m2rauvo (0trxrmf ootoa eanvo s0 rtr(r3no4ll elfciat) 2umu p;o1aeeoif3iaslmDrl(vpn() rtrxociy1fmteaivsls texrxo3no1lp e nesas)sDrau pnt1oleoio3iyd mDrlu s (4alxrmf ootoate ieilt)trtoxo3io1lme lnvt tfaDumuro;t4aee mictad m umn p;() etnif3todlm  au s;s tetm(opnodlme  fct ()s2uru p;o1oexnii3iydlm2umnmp (0tetrmrcio1oa r ivs;(0t2toio ou4open icsls)arumxmono0oex io3iyt a rmnmo;()artnmfcio1oa ranvi s  2tr(mpoo1aptn fesl() 2rrxr nt4aexoifctlsla2ra(mp u0tleomf3io1fpDr u ols0srtrxmpnodamtemieta(  2urum ot1oeen fciysfm rmu p;()tlxnmf3ootfmteauvi;s0teum(m no1aptelieia() ruaum ou1tpx  fciyt aDra(mont0aexomf iotla eauei;t)s2tm(rpoy4alt mnet ( s2umxmoot1optomfeilsfm ea(msnu0altnxrcoadla eauvil()trxm(o3oydom emfvtasf 2uaxmono0oltnioeildla ran on(4alermrcta1fp r nei t0 rurxr3iu1oltnlfct (fs2rm(roou1tltoiocilsls uaumsn()tltnmr3oadfmD liesls)srto(r ou1oltnlfes s) rtmxmpoo1aleomfctytfa rlnvp u4 eeomf3io1opDelieols teumir3iu1lpee ics (f Dumxmooo4aee  i3ilslmDua( s;t4trxrmocty1opteluvsls tetoiopoo4am e fvt t  2tmx  ;o1ole if3iasfm2eanvs u0 exrio3io1fptr ivolt)srtmxr nu1omeelici s  Dtru p;u4oetn f3tyt mDuauvs;(4tleomrciotfpte u o () 2to(o iy4olenmnvt s) rrm(m ;o4optnmociydfmDua(msnt0 leoxr tatla eli s ()t2um(opoudomen nvtlsfartrur nt1olx  ocildfa um( on()tleoirctytlpte ues;t) rum(o oy4ap elfcils srraxmont4aexn f3tltfs ulnvs;(4 rtrxr iatfmt  nvo t0texrxr oodom emfcs s a2rmum ;o1texnifcias a2emump;t0artnmfciydlaDranvs t) etmio iodamt  nci s)arua(  ;t1oleoiieiytfa uln o t4 rxoxo iodoptrlneils  exrim3oudllt mivils)s2tmxronu4alt mociytfm2el(vp;(4altoir3ia1fmtraivi () rxrxrpoy1omtn ivi (fs2urx  ou1tleoifciatls2uanvsn(4teeomf iytomD aueo (0t2um(rpno1lptn ivil(f Dtrxrooo1oeenioetysfaDrm(msn(4alxnxr to1om ean s (0 rxr(m iy4ame mfvs sf rumx  no1ole ii3iysfa uan p t)arxoxfctytlatr nvs;t trurio3oo4lmte ieia()a2trxrono0teeoioeiad sDean s u) exnifcoadopt aues;() 2tm(m nydole lnesatfa2tmxroou0alt ifeiadls2umumon() eenmfcoa1fm  aivils)trtrir ou1lmenmnctat)srtau  ;o0alxnifeilt sDrm(mo ()altnxf3iydlm  li i;s teuoio io4amte iciatfaDrrxr no0openifetlt m emu s;u0 rxomf oydlatraies s0 2urim3iu1lleelnesa(  2ta(ront1oex ifciadlaDemnvon(4 etrio3oodfmDeau s;(0 euoir oo1lle  fctas  rtaur ;o4opeoiieils m2em(vp;t4teerxrcty1fpDeaneols0s2tmxr nudal n iei s)srtrxmpnt4olxniicilt m2rm( o (0altriocty1op   n o;( t2tr(o ny4alt lfcsl( aDrmuro;t0tpt  ieildls2ea(mo;() rtrifcoytfmDe nvols)trxmxr3iy1opt  ies sf 2tm(  ou1tlx io3tlt s2rlumsn() rtniocoadom eai o;( seumimpoo1omenlicias) 2tmxr ;o4tex  i3iysfa ra( p;() etnxociy1faDeauvilt0t2tr(o ou4lpe  fvtlt s2rrxro;u0oltomoetldlmDumu o () rerxf3oodfptean i;(0setm(o no1apen fvsat  ruax pnu1tetn ieilsls emn p;t0aeerio tydoa raueo;t0 2xoxo iy1optnmietlt)a2trx  nu1tetn feildls ua(mp (4 lenxoctydlateai ol()srum(o oy4alen fesl()sDrruro;t4texo o3iytlm uan snu)texrxf oatfa raneo t  rtm(rpoydlmee fvs t)sDtru o;t4oexnio3ils m ul(vsnu4 exoxr iodlp raies s0t2um(r iydalt lfeiat)sDua(moot4ole  fciyd m ra(vpnu0 rtrmr ta1fat an il()trurxmpnydlltelfct tf rrrx onu4tlen ieiysfmDrauvp;t0tltomf ootlpDrluvi;t)texmxo3iydlpt mnci s) 2uaurpnt0tpen oeiaslm ea(ms (4tetomr tydfa  an o s  eumxm oo1lptemivtl(  2ra(ronu0opxoiictytfm rm(msnt) etnmf3oodop  lnvslt0sexo(o no1opt mneil()srtrxroou4aexomf3iatfaDea(mpnt0 lxnmo ootlmDrlnvs s0t2umir iydaptn ncsl(  2ra(rooo4tpt  ociad m uanvsnt)aexrmrctotlateluvilt)sexr(r nydapt mnctlsf 2rr(mo;t1oexomfctltlm2elnmsnu4areomr3tytfpD  ies s0tetrir oudll n ivt sfarum( o;u1tex  oeias a2umnvo;(4 etnxrciydlpteaiesl(0sruoio3iu1lptnlnciatf Dur( oot4alenif3tad aDuan snu) etnxf tatfm r ieol(0 2xrio3iu4lmtn fvsat)srra(rp;t4tpe mi3tyslm ranmp t4teerxfciotopt aiesls0s2uoim3oy4om emneils  2umumo;t1tpen ociysfa rlnvo;u)aleoxf iydlpteaies;t0s2xmxr no1lmtnmfcslt)sDumump;o0opx  f3iadfmDumnvont0alxrmfcto1lmt  uvi;t teumxrpoo1oltnmivi t aDtau pnt1tpe mi3iysls eau pn(4aexrir io1fp rau i;(0 2xr(m3iodlp  mivtlsf Dta(m ot0oetn fetys s uauvpn()tetoxr tytfatrlneils  2urxo3oy1amtnlfcsas)srtmur ;o4olt ii3iysla ulnvsn()tlxnxo oatfpDean i;s)trtr(rpou1lp e ivi ( arrm( p;o4aeto oeiyd sDumnmp u)tetoxocoy1lpteaues;s tetrxo3iodapt lfet t)aDrru pot1alt  ieiatfs2eanvs (4alxrmr3iy1laD  i o t)s2urxr oodom elnvt sfs2ua(r oo4tee ioeias a ulnvo;t)arxrmf totop   ueo t)srxmim iy1ol emicsls  rrr(mont0aexnmieilslm eau onu0tlxrxo oytlaD  ueol( sruoimpou4ap  lnctl(fsDumxr nu1alxoif3iyslm ea(mo;() lxnxr iytopt lieilt srxo(m no4lptemfesas s2um(r ou4olxo i3iltfm2umu pnt)trxoxr iadfmtrlies;()t2to(rpio1lmee nvsltfsrumxmp;t1aetomfctltfm umnvpnt4alerio ootfm  auvo;s)teumxm3io4ol  lietatf Dumx pou0tet mi3ias mDemnvo (4teermfcoodop elnesl( trtm(opiydop  lfctl()aDrr(rono0alxomfeiys s uluvs t) eenmrcoy1faDelnes s sexrxo iy1om elicilt s2tmur oo4aex ii3tat m2rlu s;u)arxriocoadfpDeai s;t0trxo(o no1omteliesltf 2ra( oou4aeeoiictadfmDuaums t4arxoif tytopt aivils s2xo(rpio4ope lics tfs2urx p;u4tlx ifetydls2ra(vpn(0areoxf oodfmDr ues t0s2um(rpou1ap e icsas s2rax ooo1oetnifctydlm el( o;(0aetoif3iytomt li o;t0setoir no1lmtelnes t s2tm(m ;o1alt mieiysfa2em(msnu4 rxrxr ta1la eaneo ()t2tmxo iy1oltnmnctlsf Dumxmp;t4tlxn i3iadla2rl(vp;()trtomr iydfaD luvs;s trtrxmpnu1ole  ivsls  2trx  oo0ale iictlsfaDuanmsnu0 exnifcoa1fatrlies t) exo(rpnydoltnmfvtas sDrm(mp;u0opt  oeiytls2em( snu0 lxrmoctydopt aneol(0 rumio nu4lle  ivia( a2tmumpnu0teenmiciaslmDuan s t4aleniocoydfm raueslt0s2uoiopnudomtnlictasfarumu o;u1apxniiciydfm el( sn(0trxrif oatfmtr ivi;s t2xr(m3iu1oltnmnes t  Drmumo;o0aexnmi3iatfm um( s;() rtoio3oydlat  n o t  euoir3iodol  mies sfsrtm(  nu1tltn o3iadlm eaumpnu4trxomf3iy1lm r uvols0s2xoir nudol nmnvias  Dua(moot0tlxo f3tlsfm ulumsn(4alenmf ta1lpD an s s0truoiopoydamtelncil() 2raum ou1aleoifciltla2um(von(0aeeomfcta1omtr i i;s s2xr(opnudlpee icsl()artmu p;u4alenio3ild m ea(mont4tltrio ta1fateanes () 2toio3iy1amte ivt sf rtrx p;t0optn fctytfsDem(msn(0altrmr iydfmDeln s;s)sexmir3no4lpee icsa(farumxrpnt1aeto ictad aDel( sn(4trxnir3oatoaDr nesl( sexo(rpio4openmncsl( sDra( pot1teenio3tad m2emu s;u) renxrcoa1lmDr ieolt0t2xrxopno1lmtnlnct (  ruaur nu4oexnmieiatls umu snu4altrmr iotfpt ai olt)srxoirpoydap  mict ( sDumxrpno4ope  o3iyt s em(mon()trxnxrcoodfat  nvo s)trtrxmpnu1ape lies s) Drax p;u1olxn i3iaslaDraump (0altnxo3oatomDrau ol( trxo(rpiodolt  nvi (fsrrr(moot4tetnii3tytls2eln p t0tleoio3oatoa rlnei;(  etoxr iu4al elfes s)arur(  no4olxnmfeilsfsDulump;u0tltrxr3todomt  ies;s0srtoio3nu4ape  ivilsfa2tmuro;t0oet ifciysfa emn onu4 eeomr3oo1laD luvo (  2urir3no4llte fetatf rtm(mp;o0tlx  iciaslaDrmn o;u4 reomo3oadfaDeaueslt)teumimpiudlptn fvslt artrurooo1tpt mo3tlt aDulu snt)trtnxo3tadfat  uvil( srxr(mpny4ap emnvi sfaDta(r ;o4ope mo3iytlmDumu ont4 etrmo3oy1lm eau sl( t2umimpou4lltnmics s  2uaxmpnt4tet iictyt a rm(mo t0teeoif oatlm e ueolt  euo(opiydap  mnes s arurxr ou1ape iietlsfa2umu pn(0aexomociadoaD  iei t0seto(o iudoptelfci tf ruru pno4opxnmfctydfa2em(vs t0 lenif tadomDrai s;t setr(m3io4ol elnvia() 2trum ;o1tlxnmfctyd s2ra( snu) rtnmr3ta1lp r n i;s)tetrio3nu1aptn fvi s)artmxront4opxn feilslaDemn o u0 leoxocoodoa  lneils)trxoxm3iy4lltelnesat  rum(m ;o4aeenifeiytfs rlu sn(0 rxoxo iodoaD aivilt) 2umio ou4ol  lfvs sf 2rax ono4olxn feiltfm rl(ms;(0 rtnmr ootomDrauvi;t) rxr(rpoy1lleelncilsfsrrm(mpoo1opx ioeiys mDuanmp;t0arenmf3to1lmDeanvo ()t2umiopnu4lpeeliesls)arrr(  oo4apto fcilsfaDrl(vont0alxoxo iadlpDraieolt  2xmxopnu1op nmiet s arrmu  no1tltn octaslm2ea(ms;()tlxoxrcoodom  aies () 2xrxo3ou1al elfvi t a2tmuroot0aeenmocildfs rl(ms (0 rtrxf3ty1omtraueo;t)s2tmxo3nydap nlfet s  rtmx  ;o4oexomi3iydlm rluvo t)teeomrciytoa r ivo s0teuoxo3nudlptemiesl()srrrurp;o0oeeniociat a2ua(mo;t4tlxrif io1fm rluvslt)texrio oy4apeemnvia( srtm(mooo0aetn o3iatla2emn o;(4 ltrif3totla e ivolt s2tmir ny1ap   net s) rrrxmooo0aexoioctld aDrlnmont4aetrxo3iytfpDranvil( s2um(o io1lm elfetas)sDurx p;o1opeomo3tlt a ul(vs u4 eeoio3tadfm  ln sl()t2uoxopoo4lle  nct (fartax ont4olen oeiadfa2rmn p;t0 rxrxf oy1lmtelieo;t)sruo(r ou4apen nvi sfaDtrx poo0oee  f3taslm rmuvpn() ltomo3oadopteaieols)s2urxo oydlltn neiltfaDraxrp;u4oeenio3iys mDumuvp t)trxomo tatfmDr i o;(0s2urio iodlltemfvt s srraxmpnt4aetn i3ils a2rlnvpn(0tltomf oy1op ran ol( srumxrpoudll   fctas  Durx oou4opeomicilsfaDulnvp;t4 eerxrcta1lpD  ieil(0srxrxmpoydll n nvsat) Dtr( pot0tleo f3ilt aDemnmsnu)trtrmfctytop r nvs (  2xoiopoy1ll nmies t)arrrurp;u1opxo ieiadls2uln o t)alenmocia1omDeauvo;t) 2ur(r iy4olenlfvsl(f rua(rpot4altn i3iatlaDem( p;(0aleoxo iatomtean s ()t2xm(m ny1amenmfeia()srtmumo;o4olt mf3iydfs2elumont4 eermrcoy1om e ieo t0seuo(m3nudame  ieia(f 2tmurpoo0oltnif3iltls2rmnvp;t0aeenio3to1lmt  n olt0texr(m iy1olenlnctltf 2rmu  nu0tpto oeiatlmDumuvo;u)arxrxf3ootla ranvils) exo(o nydamt micslt)sDrau  ;o0teeo ociltfa2eauvonu)teermo3io1oa elivi;()setm(o3no1om  lnetlsf rra(rp;u1apxn o3iat m em(ms () lxnxociy1lp rlnei;s)s2uoxo3iydapt lietatfsDtrxmono0tpe mfctltfa em( s (0 renxf totfa eanvi;s0 2xrir3oy1lle mivt (faDurxronu0aexn ocild aDuanvo;(4 reoif oodlaD lueils)texmir nydame mfviatfsDtaxr no4tetomfciysls uln p;t) exoif ty1fpDelneo t0truo(rpoy1lpeelnvsa() rtr(mpnt1open fetad a2ulnvs (0 exoxo3to1late n o;s) euo(r iu4omt  nvs t)srua(  ou0tee moeilt a2ulumsnu0altoircoy1op r uvs s0s2xmxm3ny1amtnlies ( srtm(mo;u1oeeoio3tad m ranvo;u0aetnxocoy1lm eanei (0seurxm3ou1altelnvtl( srtrxrp;t1aex mf3tydlaDumnvo ()trtnir iadopt  i s t  ruoirpio1olee icsl()aDtr(mo;u0olto feildlm uau pnu)texrxf todoaD  i ol() rtoxr3io1ap  lnesl( s2trumpnt0tpxnif3tls s2ea(ms;t4tltnmr tydlatraivi (  rtmiopoydamt mncsl(fa2rmx  ou0opeo fctyt s2ra(mo;()treoxo iotlmtranei ()s2xmir oudopenmfes (fsrua(ront1tee moeiydla emnmsn() exomfciadlaD anesl( t2xmim oydlmtemnes s)a2trxro;o4oexnmi3iadlm2umuvp;()artomr oy1lmtr nvs ( t2umxr oodaltnlies (farra(mp;t0alt mietysls2el( on(0altnxo tatlp rlnei ()t2xo(r3iu4am elnvta(faDtr(rp;t4ale moeiad s rmnmo;(0arxoirciy1laDr u o s seurxr ou4ll   ietl( aruaxmonu0opeoiictat mDua(mon(4 ltrxo3iodopD  u s;t)sruoim3ny1lptnliesl()s2tmum ;o1opeo oeiysls ranmpnu4teenir3ootom   uvslt0trurirpnydol  lfcsls)sDtrxmonu1tltnmo3iat a ul(mp;t0aexnircootlmDr u sls)sexmirpoodape lietat)arrr(rpnt0aleniociasfs ul(mp;u4tlxrio iodlm eai i;t0trtrxmpio1om emictl(fsrrru o;t0ole  i3iat sDeanms;t4aexnmo3oo1fm r ies;(  etrimpnu1lm n fcs ()aDra(mpnt1tpt  fctydfm2el( snt)aetrmr ia1om e ivols)trxm(o3nudome mfcils aDrau  nt1tetniieilslm el( pnu0trenir3oytop r n slt0setrimpiudlmeeliesl(f rrrum ;t0oeenifctyslaDum(vs;t0alxnxo oydlpt au o;s0s2xo(o3no1ameemfci (fa2tax p;u4apto i3ildla2emnvpn(0 exoxocto1lmtr n o (  2uoxm ny4amenlnvt s  2rr(ront4alt mieiytfm umnmp t0arxoifciadom  auei;(0s2tm(opiu4aptnlivsls)arrmxrp;t1oetoioetat m raumo;u)tetnmr iy1lmtr u ol()texm(opoo1lmte nct sfs2taumpot0aex iiciyslm uan s (4aeeoir oa1opD aivols)srtrirpoy1optelfvsl(f 2rr(  no4altomociadls2el(mpnu0texoif3oydlateau o s  rtoirpiu4om nlfesas  Drm(rono4tltnmfeilsfa2rmu p;(4 lenircoa1oa eauvslt  exm(r3oy1lleemfesas)arra(ronu4olx mfciat m2rl( pnu)tetoifciotfa  lneilt0trto(rpoudal e netasfs2umuro;t4oex  o3iat a2umnms () exnif iy1lmtranvolt) exo(o3nodom e fes t) Dtau ono1tlxnioeiyt s rlump t) etoio oodfate u o;(  rxr(o3oy4lpt mfvs t)srrrumpoo1tptomo3tys sDem( pnt)alermo tytoat  u sl()t2umxmpiy1lle lncsls  2tmxro;t4ale  feiasfs rl(mo;u0 lxoir tadlate n sl() 2umim3nu4lpe mfvsls) rrauronu0ale  iciaslaDeanvon(0texoxr iy1la e nvsls0t2tm(r3oydaltnlnet ( s2ua(rp;o4teenii3iltfm rl(mo;t0altoio3iydlp ean i;( texmio3iudlp elfeia( artmu  no4tpxnmoeiyd m2elnmon(0 lerio3ty1fp rln i (0 exmxm3iudol  lieia(fa2ta(mo;t1alto i3iat aDumuvo;(4 lxomo iotoptrlivi;s)trxrxo3nudoptelfei t) 2rrurpou0tle  fctatfm2rauvs t4aleoxr3iadoa eau s;s) rtoxmpno4ap  licil( srrax o;u0openioeiyd m2umu s;t4 exrxf todomDraneo t0 2xmirpny1lmtn fctat)a2rm(mp;t4tlxniicias a eau s (4texnmr3ia1opteluesl(0 rtoxo oydop  lies ( sDraxr ou4aexoif3iatlsDrm(vs;()areoxocoy1fp eau ol(  rxm(m ny1ome licilt)a2rr( pno1oexomociysfaDrluvo t4texnmf totfmtelu sl()seurio3iy4ll   fcslsfs2tm(mono0ape  i3tydfa2ra( p;()aetoxo ootfaDeauvol(  exoimpoodal  lfvia( s2urx pnt0texn o3iys m elnmpnt0teermo3tadoptr uvil(0srur(opoo1olte nesatfarta( pou4ape ii3tadfs2emump t)teenxo3tadfp rlueo;s)srxoimpoudap   fcslt)sDur(mont4tetomoetldfs el(vo (4texnif iy1fm  livo;s0t2tr(m ou4ale mnct ()sDrmumont4tpe mf3ildfa2eaump u0trerirciydopD  nvo (  etmxo iy4aleemicilsfsrtm(  ou0altnmo3iatlm2ean ont4tltnmf ta1opD anvil()s2tmxo3nu4lle  nvi (f rum( onu0tpt  ociydlmDea(vont0trxrif io1opte ivolt0t2trxr ou4alt mnetltf Dtmum ot4aptn fetldfm ul( p u)arerirciadomt livi;( texrxopnu1al nmfvtat s2rrurpou4openiocilslmDua(von(0tlxrmf todopDelivi;s  2xr(opnudamenmfvsas)srtru p;t1tex moeiadla2rmu pn(0artnio3tydlm r i s;t0tetrio3oydop nmiet ()aDumx  no4aee  fctas aDul(vo (4trxrmo3iy1omDrlu i t  rtrio ou4ll nlivs t)arua(ronu4tltnio3iat a uanvs;t)texnmo3oo1om elu slt) exr(r3oy1ole lnvtlsf rtaxmpno4olxniiciad a2um( onu) ltrxf totlmt  n o ( sexo(opny4lltelies t)arta(  nu4oee mfciydfa rauvo;u4 renxr oodop rli i t0 2tm(mpiu4ol nmfvil(  2ta(monu4aeen ieilsla2em(msnu)trermrcoodlaDrln o;t) 2xr(o3nodamenlieil( aruaxrono0aexnii3tat m2ea( snt) etnxo3oydopt auvils0seumim no1op elfeiltfa2rm(m nu1tptn i3iat s emu pnu0altnmo iydfmte n slt0seuo(opou4ap emnvi t  Dum(mp;t4tleoio3iatfm emn s (0artrxrcoo1la raneol() etrio3iydlpte ivia(fa2uau onu1open octltla2um(ms u) rxoxo ia1fpDe nvs;s s2toiopoo4lp   ies tfs2raxro;u0oltomiciyt m emn o u4arxnmf tatfmtran olt sruoxo oy1opte fetat) Drmum nu1opeomfctys m2rmu snu)teeomo3ia1lmD aivils trtmxrpoodllee ieils) 2ta(  nt1tpe mf3tlsfm2um( s u) eeoxo3oadfpDelueo t)setoir3iodom emfcsa()sDum(m ;o0oet mieild a uanvont)tetrxrcia1fa raneol( trtrxr3oo4ll  mieta(f Duaur ;o1tet moeiysfa2rmu o;t0altrmfcoatfp   uvs;()t2umir3iu4omtemnvta()s2ra(rpnt4tet mieiat s um(vpn(4alermocoydfmtrlnes (0 exmxopio4lpt lieta(fs2tmxr ;t4tptomo3tys s umn o;u)alerif3iadfaDr nvol() etoxopiy4olt mfesa() Durx onu1oltomf3iadfsDelumon(4trtnxr oa1lm e uvo;t)teurirpoudaleelfeiltfaDtaxmoou4oet ifctys aDum(vpn(4 lxnmo io1omte i ols)sruo(o3oodole  neil( srtr(rp;o1aee  fctad mDra(vs;t4alenxf ta1laDeluei (0srumir3iu1ope  net s srumur ou1oet mf3tydlm2uanvpnt0aeenxfcootlpDrauvi;s srxoir oydomenlivtl() Dua(m no0opeo o3iyt a2ua( s (0 ltnmf3todlm e iesl( teuo(r3iodll e fviat)sDum(rpno0oetn ociat a rm(ms;u) exrmrctadfpDr ues (0tetmxr3oodlp n fei (fsrua( onu1apx  i3iad s uaums;u4arenxf3tadfmDeaivsls truoim oy1amtelfvt s)aDtmu  nu0oee mfetad s2ra(vo u0 etrif tadop  lues;t0texr(rpno4ale mncil(fa2ta(rpnt1aeto f3iydfs rmnvsn()aetrmo iodoate uvi;s0seurxopno1ol n fvilt)srrm( oot4opx mi3ilslmDelnmonu0alxomo ootfmteaiesls  2umiopno4amtnmnet tfsrtau  oo4oex mfciytfaDrlnvon()tlxnxoctytfat livi t)s2to(rpiudape mnvils)sDtaxm ou4olxo ociatfm2ul(mpnt)tlxrio3oydfmtr n sl( s2xmxrpou4aptemivtl( a2tmumpnu4aptoif3iltfa rmnvo;()texnir iodfm e neilt) rur(rpny1aleemiesl(f 2ua(mooo1tpxoio3tadfa2elnmo u)arerxo tytomtrli o t)texmxm oy4om n ivi t)s2ta(mo;t4altnifetyd m2rmuvpnt0 ltoifcoydla eanvo;t0srumxo oo1apt mivsl()aDtmxmo;t4oleoiocildlaDul( pnt0alerircoytoa ranvs t0s2xo(rpou1ol e ivtls) rrau p;o0apto ictytfa2rln s t)artrifctotoa raues s s2urimpoudop e nct tfs2tmxr ;u4apxn fciadlsDelnvs t4teenircoydlp rli s (  2umxr iodlm  miciasfs2raurpot4apx ii3iasfm2rmnvp;t0tlenir oytfatr ueo;()s2urirpoo4al   ict t  Dta(  nu1apt mfctlsfsDeluvp (0 eeniocoodop rln o ( teum(rpio1aptemfct t) 2taum nu0tetn ociydls elump;u4artnmrciytfmD luvs;s t2urxmpny1am  livs t)aDtaumpou4ape moctltla rmu s;t) etomocoadla  aneolt0trxoxr iudalt  ivs t aDumxmonu1apeomocildfaDul( s u0teeoxo3totoate nes t0teuoim3iy1lm e nvi (fsrraum ;t4tltomoeiasfm ul( o (0tlxrmo3oodlp  aieil() rtoirpnu4omte fciatf Dtaxronu1teeo f3iadfmDemumpn(4 lxoir oy1lm rau slt  rxmxo3iodalt liesa() Durxr nt4apxn fciatls2el(vo t0 ltrxo3tydfmD aieslt0texmio3ny4lmtemfvs t)a2tmx  ou0oleoiictadlm2rm(vo;u0tltrmo tadfm eanei;s) 2uoim iudame mnvsltf Drmxrp;t1opeo oeilsfa uluvon(0texnirciatfptelnvs;t0trur(rpnydoptelies tf Dtr(m no4olenmf3ilslmDeauvon(0 eenmo3iydfptrluesl() rtrxm iodom emictl( aDtaxr ;o1aptn oetytlaDrauvpnt4tetoifcio1omteai i (  2tmio3nudlle  fctat a2tru pou0aex mo3tyslm2em( on(4 rxrmr to1fmDr neo t0t2tr(opoo1lleemieia()s2rmxmpoo0tpx mfciydfa umu s (4artrmo3oatlaDr neo;s0 2trim ou4alenlivtatfs2trx o;t4aex if3iyd m2ranvp t4arxoio todfpteaneil( sruo(r nu4omenlnvt t)a2tm(mono1ape mieiysfs umums t0alxnxfcoydoaDe ieo s0 rto(o3iodom elnvsas)artrxrpot0oex if3ildlsDul(mp ()artriociytoa r ueo;t0 euoxr3nydlm  licsa()srrm(  ou1oee moetatls raump t0aetnmf3oydfpD ai slt  rxoxm3oo4lm elfcsls  2tmumoot1apxo oeiad aDemnvpnt) eermocoydlmDrauvil( trur(opnudaleemies (farrmxm no1teeomf3iat a eauvonu)trtoiociydfateai s;(0trxr(o3oydamtemfcs t) 2rrxroou1oex ifeiatfmDelumsnu) renio todoaDr n ils) etrio oydalt  ieias) Dtau ooo4ape mfetatfa eaumo (4texrxf3oy1fm rlueo ( s2ur(opou4al  lfet (f 2rmxm ;t1tpxo i3iadlsDrmn o;t4artomr3ia1laD lneils0tetm(opou1ap n icsat a2raxmo;o4tpx ifeias m rl( o u0treomf totfmD au i (0 exrim nydapte iei s  2um(mo;o4apx mf3ild sDua(vo;t)tetoirciatom r ivi s  2xoxopio1ome lnvi s)s2uaxmoou0oet if3ils sDea(vo;t) renir io1laDr uei s0 2tmxr3nudope  ivi (f rrrurpnt0tltomoctasls2ranvo (4 leoif3ty1omD lu s t)t2uo(m iodaptnmneiatfsDrrx  no0optnio3ild aDulump t0aexnmo3to1fptrlivil(0teuo(opiudale mfvsat)a2ra( pno1oeeoii3tytls2emnmpnu0 lenmf3oa1opD livs t) rtrimpiodlme  nvtat)a2ta(  oo1tlen feiytlaDumu s u0 etnxo3oadlmt ln i s0 exm(mpno4lmen ivs s  2ur( onu0optnio3tysfaDrm(mont)trtomo iydopD lieils seur(r oydol nmfcilt  rrm(m nt4aexo i3tydfs2rluvp;u) rtrmrctadlaDrluvi;( trurxr iy4ap emfvtls) 2um(m ou1texnmo3iydfa um(monu0 exomf3iodfmt livo s)trtr(r nudomtelnciat) ruauront0tltn fctytls2rlu p ()aeeoxr3iotlpD  ieo;t0 exmxm oy1ole mnet s sDuaxm oo0tpe ifeilslm2umnms;u0 exrio ootfaDe neols0s2uo(r3iu4amtn nesltf rua(mpno1teenmoctltfa ul(vont4aeenmf3ia1fatrlnei s  exoxr3nu4alt lfetat aDrmxmoot1opxnmociys s2el(vpnu)arxrxo3ia1lm  aueo;t t2trimpoudomeelfvta( artrxrpno1optomoeias aDumn onu)texrxo oadoaDranvi;s0 etrim oy4lp  mfesl(fa2umuront1tex  ietyslmDea(vpnt0tlxomfcootomt anvo s0 exmio3no4ol  mnet t s2rmumo;t0alenii3iydfs ul( p t)texoif3tatfa   nes;(  eurio iy1lle  ncsltfaDumu  oo4tpt mi3tytfa2rauvsnu4treoxfcty1oateaivi ( trtrxmpoo4lmt  fcil( a2um( pot4alxo ocilsfa ulnmp;t0alerxfctotlaD aivol(0seuo(r ou4optn nvs ()sDtmum nt1aetoiieiyslmDul(vs;(0arxrif tatoatraneo;(0 rtmirpiodoptnmfesa(f Drax  ot0aexoif3iys mDua( o;t)arerifctatoat  ies;( sruoxo3ou4lp  lfciltfs2urxmpnu0oeenifeils m uan p;u0tetnio3ootopt  ies;(0sexrim ou4olen neiat  rumx  ot0aetoio3ildlmDrmumpnu4aeeoxo3oatopDrlnvi s s2uo(rpoy4lle  net t)sDuru o;u0tpt ifciatfm2ul(mo;t) lxnxrcootom e n o;(0 etoio3iy4llt lnvslt artmu p;o4oleoif3ildfs ea( o;u0aetoxocta1oa   u olt)trurir3iodlm  mfvias)srta( oou0tleomoetadla2rlu o u4tlxrxr ty1op  luvsl() rxoxrpnu1ope mnes () 2raum no0oetomociatfaDemuvonu0texrmoctydoa e uvs s) rtm(mpio4lltn ieslt s2uaum ;t4opeo fcils m2eanvs (0 reoxrcty1oaD ai i;s)trtr(opiudolte iet t  2ta(mpot0olx  ociytla2ua(msn(0 etomfciatfmDelneo;t)trtmim oy1op nlneiatfaDua( p;u1apt mo3iltla raumpnu4aleoiociydoa  lnvi s0s2xoxm ou4omtn ncia(f Duaxmpou0tet ifciydlaDulums (0aetoio oytlmDrlu ols  etrxrpio4apen neiltf 2tau  oo0olt  o3iydls umnms;t)tleoxfciodfm eaivs s)srtoio3oy4apee ietl(fsrtaxmo;o0tet  i3tadlm eln s ()arxnir tydoa e uesls0t2urio3nydomtnlicil(f rtr(  ;o1altnmi3iyt sDea(mont)trxrmrcia1fa  lueo;()trtmim oy4omt  icsl( arurxm no1tpen ocils a rl(mont) lenircty1fate uvs;t)texrir oo1lpt mfcil( a2rm(mont0aetoii3iad s umnmp;t) rtrmo3ty1lmDrln s (0seur(r iodlp e nvs (f 2tmxmo;t1olxo o3ilsfm2rmu onu4 leoxr tatopD  ivi t0 rtrxr3nu4lm nlfeils  rtmxro;o1apen feiatls2ul(mo t)alxoif ta1faD lieils)sexr(m3oodop   fvi t srrau o;u4alt mictysfsDrlumpnu)aeerir3tadlat livs;t0 rtr(o oy4lltn neil(f Duax  nt1aeeomfcilsfmDum( o;t) ltnxo3iydfp rluvs;t0 exrxo3oo1lm   ivils aDrrumoou4aptn feiad a2umuvp;u4aeenmf ta1oaDelneol(0texoio iu4omen fvi (f Drmxmonu1oetn ictytla el(vs u) lerxf3oodfpD  nvi ()teuoir iodal nmici ()aDrrum ;o1apt mietytlmDumuvs;t0arxnmo3iotopDrlneslt0t2uoimpiodomt  ici s) 2tr( pou4tlto fciasfm2rlumo ()tltnmocoodlm rai ilt) 2umio3oo4lmtelnesl( sDua( p;u4olxnifcilsfs ean s u) lxnmrcoodfmDrlnvi s0 rtrir3iu1lleemnci ( s2rmxrpot1oet ioeildls emuvp u4 etrmo3oo1lp   uvi t0srxrxo iydopeemiesatf rtrurp;o1texomi3tadfa2um(vp;(4 exnxfcoadfp rln i (0 rxrxo3no1lmenlfes (f Durxmo;u4tptn iciyslm eanvo;u4 etoio3iytlaD lnvi;(0srtoim nudal   ieslsf 2rax p;t0tpx mf3iaslaDuauvs;t0texnmf3oadfat luei t0 2uo(r ny1olee nvslt) rta(r no4aet  fciltfs2elnmpnt0 ltnxociodfpD  nes;() 2xo(r3iudomeemfet ( a2rauro;o0teeo ietldla2ranvpnu4arenxr oadfm   i ols  etrxrpoo4om  lfeiat)sDrrxrpnu1ole  fctadfmDua(mo t4tltoxrcoadopDelueo;t  rum(opio1lpe lfvtasf Drau oot0opt ifciadfa uaump t4aexoxo3tadopt  nei;t)trurxm3ny1lm  mictas)sDta(mo;o0apeniieiyt m2elnmp;()aleoio3ta1opDe n i;()sruoir3iodom  lfcta(f rtr(mpot0tpenii3iasfm2uauvs;t)aexrxoctytoptrlu s t)trtrxopoy4amtnmfetl()s2trxrp;o1aeeomociasfaDrmu snt)trermf3io1op rlu i (0srtm(o3ny4ale  nvils)s2ua(rp;t4tpx ii3iyd aDumnvs;u4tetrxrciytfp r i il(0s2trio3oy1ope  nctl() 2urxrp;u1aetnmfctls mDrmnmsn(4aetnxf3todlp r ivi (0sexoxrpnydame lfcslt) rrm(ro;o0tpt iietld s2umu p u0 ltoif3tadfmDelues;s0srxr(r3iy4op emfcs (f Duaxr nt0alxniictldfaDrm( pnu)tltrxr3tadom  ai s;( texm(o ny4om n fvi sfaDtrumpot1aetnifctat sDrau p (0artrxo oatlpteauvs t truoio io4lltelnes s  2taum no1teenioeias m2elu p t0arxrifcty1oaDrlu sls0sexmiopnodll nlfeia() Dur(  ;u4oee iiciatls2emn s;(4tlxrxo3totfpteaneolt s2tmio3nu1lpt  iciatf Dtr(  oo0optn ictys sDul(mo;t) lenxr tydopD livslt)srtmir nydlmenmivsat)srrrxm nu1olt mi3iadls2rlnmsnu)aetnxf tydfaD an il(0 rxrio3nodol  mfvil(faDuaumooo1altnmiciyslaDem( o t)teenxf3totfa r nes t  rxmxr3ou1om e iesat) rtrxrpoo1tpe iieilt mDul( s u0trxoxr oydlaDe ieil(0setoir oy1al   fctlt)sDurxmoou1alx  i3ildlm2elnmo;(4trerxr to1lpDeanes;()srxoxo3iudam n nvsl(fs2taum ;t0tle mf3iadfsDul(vpnt4tetrxocootlm  li s;s trurio ou1opt lncs s aDrmuro;t1tetoif3iasls rm( s;u4trxnxfcoo1latran il( trxr(r ny1lptemncs ()srraxrp;t4aetomiciyslmDelums u0aetrxf3oy1fp  livi;( trurimpiu4ome  icias a2rrx pnu4tpx  ieiydfs umuvs t4tetoir3totfaDeauei;s0setoio nu1lmtnlfcilsfa2rru  nt0alxoif3iat a umnvo;t4texnmo3tydfmtr uei;s setm(r oudoptn ivi s)sDrmx p;o0oetoifcild sDea(vp;u4alxrmr iy1fmDeauei ( texmim3nodam   iesa(  2ta(m ;t1optoiiciat s2rl(ms;t0artomr oytfp  ai s;() rxrxmpoodap   ictls a2ur( ooo4oeen octadlsDelu o u)areoxocoadfmtrauvo;t sexoir3ou1opte ies s)s2rrxmo;u1tpe  octat sDua( snu4 lxoxo iytla e n s;t0teumio iodop  lfei sfarta(r ;t1tpx  i3iasfa2ran o ()tlenxrcoydopDeanvs;( srxo(r io1lle  icsl(  Drmum no4oexomf3iyslm2ea(vs;() lxnmrcto1lm   nvi;t0texrir3oydlpenmiet tfs2uaur no0tltnifciat m rl(vont)alxrxfciatfatrliei t  rur(o3iodapt lfvilt srraxroot4tpxoioetat m2el(mp;t0 ltoxrcia1omDe u s;t) 2xmiopnu1am  mneslsf 2ua(  ou1aexn ieiatfs em(vpnu4 rxrxf3oo1fmDrliei;s)t2xoxm3nudom  lfvsa()a2taxr ;u4apx  o3iytlaDemn o;(0 rxoxf totlat  ueolt truoir3oydlme  fesls)sDrmur oo0oexnmiciasfmDra(vo t)teerxf tadlmDean sls) 2xoxo3oo4am nmfesas)sDraurpnt1aex  ociys sDrl( snt) rerif tadopteaivi;t)tetm(m3nydol  mictl(fsrumx pot1tlt ioetyslm2rau o u0tltnxf ta1fpD  ivo s0 euo(o nudlme  fcias arur(  ;u4olt iicilsfa2uau p (0arxnmf3tydlpt  ivs;( t2urio3oy1lpte nvs t)s2tau poo4oeeoifeiasfm uanmp;u) ltrxf3tytoatranvo t s2xo(opnu1ol emieiat srrr( p;t1altnmi3tlsfa2ra( pn(0arxnxo tatoaDe ies;( tetrxr io4op emfvta(f 2raxmonu1apt moeildfm uauvpnt0aetrxo oy1lmD anvs t)srtmim ou4lpeelnci s) 2urur oo1tlxomietys m2uanvp;(0 etoiocoo1fmteauei s srxrio nodamtnmies s aDrrxrpoo4aeeomf3iyd s ea(von(0 exrxf oodlpDrlu s;s  euo(o3iodaltnmnvt s)s2raxmo;o0tltoif3tltla2elu p;t0 reoif3ia1latelnvol() rto(opiy1llee ieia( s2umx  ot4tpeoio3tatfaDuau snu0 etrxf iy1fa raneilt trumim3no4lltemivsasfa2tax pno4opto i3ias s em(vpnu)aexnifcoa1oaDelnvs s) exm(r3nu1lpt mivias)arumu pno1oleomf3iys sDuanmp (0teermocoo1fptrln s;()trtoxrpoo4op nmivi sf 2ur(rp;o4texnmf3iadla eauvont4teermo tadlmDelivslt0s2uoio3oo1lltnlfcta()srta(mpnu1olt  oetldfa2ul(mpnu0tlxrircoadlpteli sl() etoiopno4oltn nvt s  Dtm(r ;t1olt  fetlsfaDrmnvo;(0 exrmf iadlpt ln o s0sexo(m3nydaptemfci (f Drmu o;u1apx ifctlslm2ea(vo;t4tlxomr3iodop rlnvil()tetm(o nu1lpee nct (  rtmx pno1apxo f3iytls emu s t4tlerxoctydop r ies t  rur(opiu4ap nmfei ( aDururo;t0tex iicias s2ean p;u4trxrif oodopD  nvi;s) rxm(m no1aleelfet tfsrumumo;t0aptnmoetydfa emu pnt4 exrxo oa1la elnes;()tetoxm3iydom e nvilt)srtru pou4aetn feiad a ra( o;(4areoxf iatfmt  ies;()sexo(mpnydop emfctasf Durxrpnt1tptn o3ilslm2ua(vpnu4trtnircto1oat aies s trtoxo nu1lp eliesl(fsDta(roou0tpeomfciatfmDem( p (0altrxr iy1lmDelnvs s)teurio3iodlmt  neilt  2rmuro;o4olxomo3iysfm eluvpn(4 rxomr3oatlm e ueil() exm(m nydolee fcs t  Drrx oot4alenmf3tyd s2em(vsn()aleomocto1laD ai o ( sruoxo iudlpt mnciat)a2tax pot4tpenmf3iaslm2uanms;t0arenxfcoy1fptelnvo;( t2tr(r oy4lmtelfeiasf Dtm(rpou0olto f3ild m ulnvo;(4arxoxfciatoatrln sl()teuoxo iydol elnctl()sDtmxmoou1aex if3iltla2el( pnt) reoir oydomt
\ No newline at end of file
@@ -0,0 +1 @@
+nvil() 2urxr oy1lmee neta()srurxr ;t4tpeo ocildlsDumuvon(0trermo3iy1lm   ivo;t tetm(rpnu1lptemfvi (f rtrxmpot4teeoifeiysfm uluvs;(0aeeomr ta1fm elivolt  eur(rpoy4omenliesatfsDrr(rpot0aexoiiciytlm umu pnu4 exrmo to1fmDelu olt)srxoxmpiu1omtelfvsl(fa2tr(  ;o0aleo oetydfmDul( p t0tltnmf3tadfptr n s;()texr(r nodole licia( srta(rpou1tpxoioctatla2rmump;(4trtomr ty1oa elnei t srtoim io1oltemfvi ( srrrx  nu1tlxo o3iatlm umnms;()tetnmr oo1oatelu s ()t2xoio iudop  mivil( s2rmurpno4opto fctldlm2ul(vp;t)trxrxr3ty1fa eau o t) 2trxr no4am  lnvils arrru p;u1tex  o3iat a2emnvo u)aetrmoctodlmteai s s0sexmir oodlp n ieilsf Dumurpou0olxoiicilt m rl( s;()alxnifcoatoaDe u i s)s2xr(m nu1alee ici sf 2rax ooo1oleomietadfs eauvo;t)tetomfctatlpte ivi t0s2uoiopno1ll nmfvtls)srumx  nt1alenifeilsla2uan o;u)altoio3oadoaD an ils0seto(r3iudoltnlncia(fa2ua(mooo0altn f3iadlm ulnms ()alxoxf oytfatraneo ( teurxo3no4am  lnctlt sDrr(rono0apxn feiatfa rmu o u)tlxrmo3ta1fmDr ues t)seumim3iudll elnvt (fsDrau ooo1tpen i3iyt a2ranvpn(4 lxoxr3iy1fmtraueilt0 rtoxo nydopt licsatfarur(rpno4aexn i3tltls emu sn(0 ltomo totlmtran o (0s2uoio3oo4lpt mfvs s  rrrxrpoo1ope  ociysfs rlumsnt)tltrmoctotlaD livs;t)s2xmxm3iu4op nlietas  Drrxrpno1opeomi3iyt a2rmu snu4tetnif oadfat  u ols0s2umxm nodole lfviasfsDrr(r ;t1altn f3ildfa2ulu p t) eeomrcoy1fa eaieol(0t2xmir iu1lleemicslsfaDra(m ;u1alxnifeilslaDranmp;u0areoxrctodfatrai i;s)t2umxm oo1apen ictltfa2uaumoot0tee if3ias a rluvs;()teerxrcoodlpte ivols0seuoiopno4lm n fcil( srtm(m ;t0opxo oeiytfm emums;t)aexrmr oy1lat  n o s  eumim3ny4lptnmfesas)arururpno1apeomi3iatfs rmn s u)teerir oa1omDelnesls)s2umiopiydap n icsl( s2tmx  ot1tex if3tlslm2ua(vpnu4 rtnif3oa1fa eauvs;t0s2um(r3nodap   nvtas)arrru  ;o1aetnmfeilt aDumuvp;u4 ltoirctadfaD  n ols  exo(rpny4am emfvtas)sDtrxroou4olenioeias m ra( pn(4aleoxf oo1faDean ils)texmir3oudop  licsl() rra( ont0olt ifctldlmDeluvpn(0trerifciadoaDeaivo t0 2toio nudlmee ieils)aDrm(m nt0tpto icils s2ul( s u0alxoxfciadomt aneil( trtmxr3nodal   neiatfsDuaurpot0aee  iciasfsDra(vp t)tleoxrcoatomDr neols0t2um(opoy1alt licsl(fs2ua(r ot4aetoii3ildfsDul( o t)teenmr3iytfm r uesls0trxmxrpoodopt lnei t)s2taumont4tpxoiicias aDum(vp () renir oy1lp e nvs;t)s2ur(r io4al nlfetlt aDumumpnt4oltoiiciadlsDemu s t4trtoxr todfp r ivsl() eum(opny4alen nes t)a2rmu p;t0aptoii3iasfsDemu pn(4 rxnmr ootfp r u il(0 2xr(opoudlm  mics sfsDururpnt1tet  feiys aDrmu o t4tltnmf3iatfm elneil( trxo(opoo4ape livils  2trx p;u4apx iociydls el( o u0 ltoircto1lptr uvsl( t2urxmpiudapeelieilsfa2ua( ooo1tpt mfeiydls2el(vo;(0 rtoiocoydfpD  nvilt) exoirpiodapeelicsl()s2tax pot0aexn octyslm2em( sn() ltnmo to1la   ivsl(0t2xrxr3iu1ap  miesl()s2rm(mpou4opxniociydfmDemnvpnt) lxrif oodopDrai o s0 eto(r oydlpe mnei sf 2uaxm ot0olxoiociyt a rm( s t4aeeomfctotoa   ieolt0trtm(r3nydome lfet t aDra(rp;t0opxo f3iat mDrm(vs t0 lenio iadfatran o t)trurir3ou4am elnvs s) 2rrumpnt4oeeo fcilt a eluvpnt4 rtoir3iatlpteai il( trur(r nu1apt mietas)s2tr(mooo1alx  ieiys s ul(mp u4 etomociy1laD aivi;s)s2xmxm3nodlp nlneilt a2rmum oo0alenmociyt aDeanmsn(0texoiocty1fpDe ieo;s0 rurxo iydamtn ictatfs2umumpno1altoii3iys aDel(mo;t4aetnmo3oy1lp eanvi;s s2um(o3oudlm   ncsat srtmxrp;u4aptomo3ilsfm2rm( pnt4 lxoxf oadopD luvol( tetrxmpnydam e ivi t) rtaurpou4apxomfeiyt s2uluvp ()teeomr3oo1om  auvo;t tetoxrpiy1om  mivtl(  2ta(r ou4aetniiciytla2rl( o t)trtnmocoodlpt auvsl(  2xoxmpiy1lleemivta(fs2tr( oot0opxo iciatla rau p u)trxrifciatlpDrliei s)t2xm(o3iydopeemnvsat)aDrax pnu1tetomo3iydfm uau p (0alerxr3todla  li il(0s2toxr3ny1ol  liei tfsrraumpoo4tltnifetasls2ul(vonu) eenmfcootlaD  nes;t)t2xr(r3oo4ame lnvil(  Dua(roou4ape  oeiltlsDulnvo (0 rtnio ootfmteli sls0srxo(opiy4aptelfes t a2ta(m no1alt ii3iatlmDelnmo () lxnxr3ia1faD li o;t s2uoim no4al   net t sDtm(mont1ole if3iatla rlump (4aexnxf oodoat  n i (0 2urim3iy4ope mivi t s2rm( pou0opto f3iytfs ul( snu4 rxnmo3io1lp eau slt0trtrxm3oudlptnlfeilsfaDur( p;o0aptoioeilsfs elnmon(0 reoio3ty1late iei t)texrxrpio1alenmiet ()aDtr(  oo4oetnmi3tlt a2eanvo u4tetnmo3oa1fptelues;(  etmxmpnu1ole  nci t s2taum ;u4ale  feiadlm2ea( snt0aexnxo tydlpDr ieil(  2xmxo iodomtnlieilsf rtrx o;o1aet mi3ildls2umuvs (0 lxrxr3ootfat  ieo;s  etmxmpny4lmee ncsl()sDumx  ;t4tpxomfcilsfmDrl(mo (0 ltrxo3oydfpDelueo;t)s2xr(o iy4lmt mivilsf rtmxr ;o1teto ociytfaDrl(vo (0alxrio3tydfmDranvs () rxmxrpoo1aptemfesa( aDtaxm ou4olen octatfs rl(vs (0 lxomf3oo1lm  ai s;s0texoxm3nudom   neiltf rrmxrono1aptnmiciatfm2ua(ms;u0 exrio3oy1fa e neo;( srtm(o3ny1lpt  net sf Dtaxr ;t4texnifeias s2ranmo;u4 lxoxrctodomDe nei;s0s2uoio3iu1aptnlictat)aDtmump;t1tlenmoetydfs2uanvo u4 eeomf oatopDelu o t trtm(o oy1lptnmics (faDtrxmp;u4aetoii3tytfs ulu o;u)aeenmr to1lmDraueo s) 2uoxr3iu1am n fcsls s2uaxmono0apeniieildfsDulumonu0aeeriociy1fp eaivs ( teumiopnu4am n ics s)artmxrpno0oee moeiatlm2rluvpnt) lxrxfciodop eanei;t)srum(opiy1optnmneia(f Dumxr ot0oetnmfetyd aDuan s;u)texrir iydfmteanvolt0 rxoxm3nu1ap nlfcsas arrmx oot1opxomo3iasfs em( pn(4 etnmfciodfm  aieils t2uo(m io1lle micia( s2rr(rooo0tpt mfciad s um(vp t4artnmfcoa1opDelues;(0s2ur(r oy1lp   ictl(f Duax  ;u1ale iieiadls2eaump;u4 renmr oo1la r ieol(0 2toxopio1ll  mnetl(fa2taxm nt4texnif3tad s2rl(mont0altnircia1lpD au s;s) rtoim3iu1ale  nvil( s2tmxr ;t1apeo oeiytfm emn o;t4aetomr3iydlatrlu slt0srumir3nydlm nmnetls)a2raxrp;t4tpxnio3ils aDumnmon()arxrmoctydop rauvs;t srtmxm3oodlltelfvt ()srua(ro;t1apt if3iysfmDul(mont)areoxrciy1lp rlnvsls0srtmio3nydoptelieiat)a2trumooo0ape mf3tadlm uau pnu0arxoifciodlatrai i (  exriopoydap elics (faDta( p;o1opeo i3iadfs ran on(0aeenirciatfm rlues s)texoirpou1lm elnvt ()sDua(rp;t1oltomoctydls emumsnu)aetoifcoadomDeauvils) rxrimpnudol  mfcilt  2ra( p;o1opxnio3iad a2rlumon()aexnioctatlaDelnes;s0 rurxr3oo1llt mnesltfsDraxrp;o4alto i3ilslm ranvpnu)artnir3iodlmDe ivi t) exrxr3io1amtn nei sfsrtrxrpnt0oeeniocild a ranmo t4arxoxocoo1la elues t  rurim nudlp  mieilt)aDumu ont1oetomo3tltfm ua(vsnu)trxnif tadom r ieo;(0 ruo(r3iy1altnlnci tfsruaxrpnt4teeomo3tls a2ua(vp ()aeeoif3oydfpD  ivolt0 2xm(r3iu1amtn fet ( aDtru poo4aex  ietytls elnmo t4altrxoctatlmtr i s (0sexm(o ny4am  lici s)s2umxmonu0oet  ieiadlsDum(mo;u0teerifcia1optelieilt)t2umim oudlpt mivias arrm(r ou4ole mieiad s2umnvpnt4 rxrifcia1faDrli sls0trxrxo oudal   fvs (f rrmumont0tlt  f3tltfs ra(vp;u) ltnxr3tadfp rauvo;(0srtr(r3no4ol emiet sfaDuaxmp;t4oeenifctysfs umumo t)arerxf iatoat ln sl()s2um(mpnodal e ivt s aDtr(mpot1tpeo i3iyd mDean p;u0aexnif iy1lp e u ols  2xo(m ou1ol emict ( sDua(rpou4oeeomietlt a um(ms;(4areoxf3iy1fpte nvi;()t2tr(m3nodal e icsa() Drm(mpoo1alt mo3ildfs2rm( p;t0 rermrciy1lpD  u i;(  2uoio3oodopte fesl()arumumo;u0tleomociadfs el(vp;t4 etnxo oadfm  luvi t) 2xm(r3io1om  mieta(fs2rmu pnt4tpx iiciyd m elums () ltnio3oydlmteai o t srtmxr3iy4lp elfeilt  ruru o;u0aptnmo3taslsDrm( s ()teenif3ia1fptr nei t) exrim3nu1opee nvia(  rtmxmpnu4apenmociyt s umumsnu)artomrcoo1fmt  nvslt trxm(r ou1oltnlnvs sf Durx  nt1oeeoifeildfsDrmu s () lxnmociatfaDeau il()trtoir3oy1apeelfvtls  2tau ono1opt  i3ilsfm2uauvs t0tlermo ia1fatelieo;s0sexo(mpnydapt lieia() rua(rpot4tpeo i3tltlmDea( pnt4 reoirciodlmDrlu o s)truriopnu4op emfes tfaDtr( pno0opx mf3iytlm rlumo (0areoif3ia1laDe neol(  euo(rpnu1olt  ncsls) 2ur(mp;t1teeoif3ilt s rlu s;(0aetomr3oa1op  aivo;s0teuoxo3no4ap nmfeias srumur ot1tlt  i3tys s uauvo;t4 etrmf3tatfa elneil(0tetoiopio1openmiesl()a2tm(monu1tptniociltlm2rm(mpn() ltnxo3iotfm e u o t)tetoxr3no1op n fvt s sDrrxrono4tlenmiciydfs rmumon(0areniociadomteai sls0 rtmxm ou1alenmfet (fs2taxmpno1aetn ieiyt a2eaump (4tlenmr tydfmDranvs;t) etoxm iodol nmiviat)srrrx  ;o1tlx ii3tat mDulumo;(0altrifciydfm  anvsl( sexoio no4lpt lietls a2rrx oou1alt iicils m elu ont0 rxoxocoadfpD lu s t0 2xmim3nu1altn nvi s  2tmurpou1opt mociat m2ea( s (0aetomf oadomtrluei t)t2uoir oudop nlfciatf Dtrx o;u4oetn ictltlsDra( s (4treomrcootlmtraieol() ruo(r3nodom n ivsl()srraxrooo4tet if3ias m rlnmont0artrxf totfpt  iesls0t2xoio nu4opte fvtlsfa2tmump;o0oeto ieilslmDumuvp;(4 rerxf3iadfate i i;s0sruoio3iy4om  lnesa( sDrrxmpou1oeeoiietas sDeanmo;u0teenxoctatlp ranvsl(0texr(rpou4lm nmiesa(fa2trx  oo4teeo ociaslaDrm(vs u) lerxo iatoptelnvo;t) rtr(r3iudolenmfeias srrmumoou4alt ioctlt mDemn s;t)aleoifctotfaDe n olt) rtmimpoodlm  lnesa()aDtm(monu4ope mo3ilsla el(von(4altrxf3iodfm rauvil() rur(o3iudam nlnctlt)srtr(m ;o4aexo oetytla2ea(mo;(4 exnmr iydoatrai olt teurim iy4llenmfct tf 2ra(mo;u1tpe  feilslaDem(vs;(4tleoir3tydfaDe ueil(0 etrxm oudamt licil( a2rmurp;u0oltomo3tls aDuan s t0texrioctytfpt lneils0teumxo3oy1lpee fvilt)srrax o;u0aptnif3iadfa2ranmsnu)alxnxrcoo1opD  nvs s teumxm iy4apt lietas) rur(r nu1oetomictytlmDemu o u4alxrir iy1op rlieo;(0teuo(m3nodlp elfeilsfaDtmum oo1open f3iltfs2em(vpnt)areomf io1fmt lu ils  rumim no4ole  ictas aDtmxro;o1alxn o3iydlaDrlnmonu0arxrxocoydoa rluvil()trxmxmpny1am n fcils) rrru pnt1apx iiciytfs rmums;u) leomo iadfat auvol( seumxr nydllen fci s) 2tmxr oo1optnio3iydls2ul( o u)tlenxociotfp rau s ()seumimpoudlpenmnvta() Dtmx poo0tpto i3ias mDul(vo t0aetoiocio1lmtelies s  2tmxm3no1ape mictlt  Dumxm no0aleoioetadla2rm( pnu0trtoir3oydfat aivil(  etrxr io4lmt lnci s s2raxrp;u1olxnioetydlm rm(monu) ltnircoodomtrlneols0 etoim oudaptelfesa( sDtr(m ;o1apeomoeiltfa emn o;t)aexoxr3iatfp  lu slt0truo(m3oy1ope mfviasfsDrrxmonu1aet  ietadlsDemuvo;u4 exnmrcoatlpDelieol(0tetrio3ny1amt  icsl(fsDur(mo;t4tlenmoctytla ulu p;u) rxnmociodop r uvol(  2trxrpoydom  lnvta( s2ra(r ot0apx mi3tadfa ua(vs u0aetnir tytoat anei (0tetmirpno1op emfetl(faDum(mpnu0oltoii3iat aDuanmp;u)tlerxo3totfptelivi () 2tmxr3nu1omeelietas s2uaxroot1opt  f3iadfmDemu s;t) leoif3oa1lm  lieol(0 2umxo no4lltnmnvtltfaDtm(  nt0tlxoiocils sDelnmp () ltomo ta1fp rlneo ( seurim3ou4apenmneta()a2rax o;o1olx iieiltfa el(ms;t4tltrmoctatlm r nvils0setmimpiu4op nmivsl() rrax oou0openmieiyt s rl( p u4 rxoxrcoa1lpt au il( srtrir3nydlpe mfvils) Draum no1oee mfeiatls elnmo t)aexrmf io1latraivo s0sexr(opnydole liei s srtr(r ot1tleoiieilsfa2rm( sn(4tlenxoctadlp rluvilt  ruo(o nydapt licil( a2rax  nt4aleomfctldfsDranvo;u0texrio3to1opt  ivi;t  exmxm no1lpt mfciltf rrr(  ;o0alxo iciytfm2emnvsnu)trtoxo3tatlmDrlueilt)sexoir iodal nlivils  ruru  no4oltn ieiatfa rl( pn(0texnxfcta1op elueo;t)teum(o iu4amtemiesa(  rtmxmp;o4tltomfciys a2umu o;u0trtnif oydopt  ivs () rum(r3ny4opt livtlt)sDta(rp;o0oexnmieiadla rlnvo;()altomocia1fp r ivs t trtrxo io4om nlnesltf Dumxmp;o4ope  f3ildls umuvonu4alxoxr iydoaDelueo s) rxo(o oy4ol emneta( a2umurp;o0tpe moeiat m uau s t4aexnxoctydoaD lueo (  exmir nu4lm  lfeias) rtau o;o0teto ieiyt s2rl(vpn(0artomr3iydfmDelnes t)seumir iu4ol emfvtas sDtr( onu1ole iiciytfs2emu pnt4 exrircty1fm  aieolt0t2uoxo iydlpe lnet tfsDua(mont1tptniictysfsDumnvon(4 exnio oo1lmt aues t0 eum(m3ny1olt  fcsl(fsDtaxronu0oex  f3tytlaDelu o t0alxnmfctatfmteaivi;t) eumxrpnodlptelfvsas aDua(m ot4tlxnifciysfsDulnvpnt) lxrxf3iodlp rau sls)texr(o3oudaltnlivia(fs2uaxmooo0opx mi3iad m el(mpnu0 ltnxrciydopt lueilt)sexm(m oudlpte ncsas) rraxmpnu1tlxomfctyd s ua(ms (0 lxomr3tadfaDr uvilt)sruo(r ou1om nlfcsat  Dua( o;u4opxoii3tadla rlu s;u)alxrxo3tydlpt  u i s0 rur(mpiudlpte ieia(faDrmum ot1apto fetasfaDemu snt0trtnxfcty1oaDrlu ol()s2toio ou1amtemfcsas)sDuauro;o1aet ifeildlmDua(mpn(0altnxrcty1lm r ies;t)t2toxrpny1ope mnvsas  rrr( o;t4tlx mfciad aDeaumsnu0 reoir3to1op r u sl( texr(r3io1lmt lfet () 2raumpoo0ale  oeilsfa eaums;u0teenmo3tatomDraneolt)srxmxopiy1lpt  nvt (fsrumur ou1opxoif3iaslsDrmuvp (4tetomo oo1oat  u s s)s2xo(opiudam   nes (  Dtr(  nu1opeo f3tlsla ran p;u)aeeoifcoadom eanvil( trtrir nu4om nmfesas)srtmu  ;u0aexo feiatlsDuln o;t4aleoxf3iydomte iei;t trxr(mpnu4om n fetatfsruaum ;t4alt  ieiad sDuln s ()altoif3tatoateln o;t) etr(o ny1alt  feta( sDrrxroot1alxnmfctyslmDuauvs u)artnmf ta1fm eanes ()t2toxo3oydlmtnlnvs s  Dtaxr ot0tlxnio3tatla2elnmo;t) lerxrcty1latrluvo;(  2xmio3ou4amt  ivias) rraxrpoo4teto ictytfmDelnmsnu0trxrio3oytfmte n s t) 2to(r iy4om e ieils)arrau  ;t1olto icilsfm2el(mo;t) rerif3totoptean i;t  2uoim3oo4lpenlfvi s) rtmuroou4tpto i3tyslm emnmsnt4trxomf3oodlmteaiei;t0t2toxm3nodop nlfet s sDrau pnt0ope  i3ilt s uanvs u)arenxfciydlp r nvo;s  2uoxrpny1ll emfetas) Dtauront1tpe iicildlmDrm(vs u0tetoxo io1fat lu s s0s2tr(opnudomtnlnvsl(fs2rr(r oo4tlxomfetat s2rln s (0trxnxf3totoaDean o t0truoir nydam nmfcsas)a2ua(m ot1aeeomf3iytls2uanvo;(0aleoir todlpDeai o t)sexrirpoudlpenlfcias)a2ua(rono4alxoii3tat s rmnmp;(4tlerxfctydopDeai slt  exo(r oo4omt mfesl()sDrrurpou1ole  f3ilsfm2ulu p (4alxoio iotfm  anvs;t)t2xmxopnudlpte nes t)aruaumpnu0texnmf3tydlm2um( o u) etoifcia1oa rli s ( trxrim nudom e ncia(faDraxr ;o4opeo ociltfmDrl( s;t0 lenircto1fp e nes;s0srurxm nudale mnvt (  Drr(m oo4aptoiieiydls emums;t0trtnif ootfm   uvs;s s2trimpnydamteliviat)srrrxmoot0aetomiciyd s rmump t4texrmr iytlpt lnvs s0t2urir oudlpe lnviltfsrurum no4ape mieilt sDrau o (0artrif oa1oateanvils0t2xoxrpoudal nlieslt) Drmu p;o1teen f3tyd aDumnmont4 lxrmr3iydlaDeaneo s srtoxm3nudomtelnetl( sDua(mono1opeomf3iasla uau s t0aleoio3iadla rlneo;s)srtrxo3nydop  mnetas)srumu ono0oltnio3tytfa2ulnmp;u4artoxf3oatoaD  nei;()sexoio nudlm  lnciasf 2tm(r ;t1olx mfetlslaDemu o;t)trxrxfcoy1oaD luei;t0s2xmiopny1ol e fvt (  Dta(rono4ale mf3tysfm2raumsnu0trxrio oa1laDraivs;()t2umxo oy1aptemnvi (faDrau pno1oex  oeiad sDrlu snt4tlenxociotlaDr ivo ()t2toimpiy4ope mieslt aDtm( ont1aeto i3tas sDrmnvp;t4arxniocto1fmteluvs;( sexmir3oy1lme  ivta() rur(  ou1olt moeildfaDul(vo;t)tetrxo iatfmtranvo (0truo(m3iudal nlfvil(f Dtmx  nt0ope iieiadfs2rlnvp (0 etomo3iydoptrai i;s  rto(opiu1al nlfctlt)artrurooo1alen fctydlm2ranvsn(0arenio3iadfa  auvol( tetmxr3iy1openmnvi t)a2tmxr nt4olx if3tatfm emumonu4artrif iytoaDeai o t)s2trxrpou4apt mfvil()aDrmu  ;t4olxnmieiltla2rauvp;t0 lerxo to1fpteln o;s0 rtoio nudop nlnet ( sDtaxmo;o0aptnmo3ils m2ea(vsnu)trtnxrctotfat li il( s2tr(r oy1lm emfet (  Dtru  no0apt io3tydfm ran p t0trxnif iodom   nvo;s srtoxrpoudoptelfvi () Drm(monu0ape  ocildlsDum(vsnu0aleoxfciadfaD li o;s0s2trimpiy1lp nmicsas)sDuaur ;u0ole mf3iatfm rluvpnu0 renmf oadlaDeai sls0texm(mpnodlm nmieilt)arta( onu4aetnmf3tas sDumuvpnu)aexnmo3oodlp  lues;s)trxmio iu1apt lieiat) 2rrur ;t0aeeoioetlsfaDrl(mp;(4alenxo3oydopDrlueilt0trumim3io1lp  mnes t  rra( onu4opxnmf3iytlm el(vp;t4 lenxf ootfmtrlivslt)trxr(opiy4lm  lfetltfartr(m ;o1apxo i3iys s2ra( p;t4alxnmo3tatomtraneol()s2xmirpiydamtemiesasf rra( p;u4optoiictlsls2em( p;t4 ltnxo tydfpte nvo;()srxrxr3io1amte nciat) rtruro;u0ope mi3ild sDul(vpnu0 exnio3oa1fpDeauvs (0 rur(o3oudam   ivta(  Dtaurpnu4opxniictlslm2emu s;u0artnxr3totfptrauei s  exoxo no1ll e neta()srrrurpno1altoif3iatla ranvs;(4 ltomrctadla r iei s0 exm(o3io4lpte fetl() rraxro;t1tlx ifciad a eaums (4treomr3ty1lmD auvi;()teto(opiu1ol elictltfs2raum nu0aexnmieildlaDuaumon()texomr3tadoaDraues ( s2uoxm oo4aptnlictasfsrrmx poo4tpt ioeiad sDrm(vs;t0 lxnxr3oydla eaneils srur(o nydlm n fvi () 2tau pot1tle moeils mDea(vo;(4alxrir oadlat lnvols0t2tmio nu1lle lnctl(  rtr(mp;t4texnmi3iysla2rl(mpnu4 reoxf ia1lmDr iesls)s2uoxo3iy4lm   nei s)srtru o;t1olxoio3iatfm uluvo (0trxoio3oatopD livilt0srxmxrpiudomtnmivsa(  rtmumpno0texoiietltlm2ul(vont0aexomocty1omt  nei s s2toir3iy4optemnvtl( s2rrx p;o1oet  ociytfsDuan p t4aleoxrctytoa raueol(  rur(m3iudoptelfei ()sDrrxm nu4ape ifciltla uln o;(4alenxr3oodfp eauvi;s seumxo oy1om n ivi tfa2raumoot0tlx ioeiltfm2eanvp u)tlxnxrcty1lmt lueilt0s2tr(rpoydomtelivt sf rtrxmpno0altoiictadlsDemn o;t0tetrxf3oy1fpt liei s0srur(m iodamt mnciat) 2uau  ;o4oexn o3iasfm2umnms;u) eeomr3totfateauvsls trxoiopoudam  mivias)aDtmu p;o4ape iietldlmDuluvont0aeeoio todoatrai o (0 2tm(o oodale lfcia(  rur(mp;t4olxnii3iltfa2rl( sn(0tetnio3ootlmD  i o ()srtr(r3oy1altnmnvsls) 2rr(mpnt0ope  fctytfsDemnvs u0arxomf3tatlp  livi;s) 2tm(r3oodome  nvtls)s2ur(  no0tpx mocils sDulu s;(0texnif3ootfatrau ilt)t2xrxm ou1am nlnvi t)sDtm( o;u1apxomiciat a elnvs;()aetoxrcia1fm r ueo;s)srxoimpiu1ll   ies sf 2rr(m nu0alxomi3taslm2rl( snt0aleomo ootomtrau o;s)s2xoimpiydop  licil( srtmx oou0oexnifeiadlaDua(vs u0artoxr3oodom  ln i t)s2urxmpio4optnmivt s)s2tmxr nt1texnmf3ilt mDrluvp;t0areomrcoo1lmteaiei;s  2xo(m3oo1olenmfetatf 2uaumpnu1altnifetyslmDea(vs;u) lxrmf iydom e u i;t) eur(r oo4omtemictlt)srtau pnt0oetniiciysfa2umnmo t4aetniocoydoat liesls sruoiopnydlmenmfvtlsf rraxr ;u0tltn f3iysla2ea(ms;t0 ltniocoadfpte ivo () 2xoir iydop nlfcia() Dra(rpoo1ale mo3iad a2em(mo t)tltomf3ta1omDe ivs;(0s2uoxm3ou1opeeliei (f Dum(m ot0openmfcildla rl(vp;()altrio todfat anes;(0 2xoim io4omeemietas  Dtm(r no0alxn fctysla2ua(von()aetomfciotla raivi;s)seumir nu1lptnlncs sfsruaurono4tpx  fciadlm el(msnu)tlxomf oodfaD anes;t0srto(r3nudalen iet t)sDurxmo;u1tetnmf3iasfaDua( p;t4arxomr3oodop rau s s0t2xmxm3io4lle  fct (f 2urxrpno4alt ifetydfmDumu p u0aexrmrciotfat  i sl(0srxmim nydaleelfvt (f 2umxro;t1oeeomo3tad a rm( s (4 etrmfcta1fptr uvo;()seuo(r3no4om e iesasfa2rru  ;o1apx if3tad s ua(mo;(0tlxnmf ia1omtrli o;t0setm(opnodopenmivt (  rrmx ono4alto feiys s uln snt0teenir3oo1fat luei;(0 rtmio3iydalt mneias)aDurx  ;o1tltnioeiasfs elump;u) rtrifciotfpt  nvs s  etmir oydoleemnetl()aDtr(mooo1aptoiociad s rl( s;u) lenxr3iy1lpte uvs;s  2urxm ou4amenlncias  rtru  ;u0apxn fciyd a2ulu sn() lxriocty1fm eai i t0 2tmim oy4olenliesls)aDumum no1oetoiieiytfm em(mo t4trtnxf3ia1la r ieolt) etmxr3nu1am e fvtas s2umx o;o0alt ifeiatfmDranmp;u0 lerxoctytfpD aieolt0 eur(r3oydame mfcsa(farrm(mpoo4aexn fcils s ra(mpnt)texrxocty1fp   iei t0srxoxr3iy1ol elfeias)sDraxmpnt1alx ioctas sDrmnvo t0teerif ia1fp r nvi () rxoim3iydoltn icilsf rurxm oo0olx moctytlm uaumo;(0altrxf totlmDe neo;s setoxr3io4aptnlivia()a2uaxmp;u1apen f3tasfa elnvsnt) eenmo tydfmtraieolt  2um(opiu1lp  livs sf Duax onu1aetomoeiltfmDuanmpn(0 eermfctodlmte nvilt)t2trxm3ou4apeelietlt s2ua(m no0alxnmfciydfm2ulnmo u)arxoxf3tadlpD lu o t) eto(o oo4olen nctls)s2ra(root0oex mfeildfs emu s (0altoxf3oydoaDranvo t) etm(o oy4lptnliet t sDur(mp;o0tleomoeildls2eluvs (4 rermr3oodfate n s t0srtrimpoy1lmte ici t s2raxrpot1aexomiciyt sDrlnmo t) exrmo io1oa eaieo s0 rtrxopiu4op   netls) rua(ro;u0teeoif3tatfsDulu o;t0 rtrxr3iodoa   ueo;s0 ruo(m oodalen fctasfsDrrxmoot4oetomociltls2ua(mp ()teeoif3tatfat livol( t2uoxr3no1llen fct s  2umumpou1tpen f3iltfa uanvs;t4 rxoirciotoa rlnvo s) 2trxo iy4opt lfei ()a2ta(  ;o0teenmoeildfs uanmpn(0 leomf to1opDr ivols0 exo(m iu1op n nes ()sDtaxroou1olx  iciydlm2umnvo () reomo oadfmDeauvo;s0t2xm(opiu1ol  lnvta( s2umump;t0tpx  f3iatfs2ulumo t0aeenmf3tytoa r u i ()srto(r3no4lpee fesa( a2tr( ooo4tetnifciltlaDrm( p u)altnxo oodlptelivs;s srxrio3iodom emfvtlsf 2ta(mp;u1apt  o3ildls rlump (4aetrio3oytomDran i t)trxrimpoo4ap n fetasfaDuax  ot4tle mociasfmDel(mpnt0aexnxocty1fpte uei;() rurxmpio4ap emnvsat)srumu onu0oetnii3ilt m2eauvont4 lenmr3oytomte ivolt teurxm iy1llenmivt t sDurum ;t0tptniiciasfaDrlnmo;(4teenircoodfm e nvil() rumxo ny4alt mfvias)s2taur ot1tleomociytla umuvpnu4tetnmf todlmD livi t)sexmxm iydlmte nciatfsDrmxrp;t0texniietlslmDel(mp;(4 etrif oodop   i sls t2xoio iudap nlfvi s)a2rr(  nt4tltnmi3iyt a2em(mp (4 exrxocoytoaDelueo t trum(rpoy4al  miviat s2rmump;o0openmoeiadfs rauvs u4arenmr3iy1opt anvs;s s2xm(r3oy1lptemivils)srrmxr ot1apxomocilsfsDelu s;u4 lxnifciydoa eln i;s0 rxoir oy1ope lneils)aDrmurooo0alt ioetaslm elnvo;u4aeeomfcta1fate ieo s0s2tr(m no4om nlfvs t arurx pou0ole mfciasfa2raums;u)arenioctydlm eluvs s tetrimpiy4ape mfes sfa2urxr ;o0tlxomiciltfmDumu s t)trtoxo tytomDrluvi;()setoim3oo1olenmfci s a2rruro;o0apxnmo3iydlsDuauvonu)tetoxo iodlmD luvs;()trum(rpnydape mfvtl()aDtruro;o1apt miciasfa raumo;(0texrmo iy1opteau s (0 exmio nydom  mnvsa(  rtm( p;t1aexo i3tad s2ua(msnt) rxoir ty1faDeli ols texmio oy4ap  livsas)aDuaxm ou4tlxnifctydlaDrlnvs;u0 lxnxrcoydfpteluei t0 2tr(o oudlpeemfei t a2trumpou1optoifeildfm umu p;()tlenmocoo1fmDrlnes (0s2tr(mpnydolen fesl(f rtm(m ou0apxomoeiad a eanmo;(0 lenxf3tatlpteau s;(0seum(r iu4opt liesl( a2rau  nu0tlto octytfmDuanms t)tlxnio3oodlmtrli olt0tetrim io1apeelneils aDtmxrpoo4olxomoeiys aDel( s;t0aleoifcio1om   uei s)tetr(r3nodap nmictas) Dur(  nu4alt mieiad s2ran p;u4tetrmr oy1oaD livi s  eurim iodope livsls aDrmx o;u1alt  f3tysla elump;(4 etnxociytlatelueol( texmio oydap  mneils)s2taumpno0olenmfcilsla2rmnmsnt4texnxr ia1fmt  uvs s tetm(mpiu4oltnmfcsatfaDur( o;t1tpto oeiys s ra(mo ()trtrxo3oatlpD lneo;() 2uoio iu1ap nlfesa() 2rmu  ou1olenif3iad s rluvo u0 etnmr3ta1omDelivo;s)s2xmim iu4omtnlnvs t) Duaxm nt4aexnmfciasfs eaumo;() etnxfcia1lmtraues;s0sruo(o nydomenlici t arraxm no0aexnmo3iltlsDeluvo u)trerxr to1omDeai sls) rtmio oo1ap  lncsa(  Dtaxmpno0aee  o3tlslsDrau o u)tlerifcoydlp   u o;t) eumirpou1lleelfcs ( artmur no1aeeo i3iatla elnvs;u4arxnxfcia1laDeaivils0t2xrimpiudoptemieslt a2taumpot0tlt mieiytlm uaumon(0alxnxo ia1lptelues s)s2uoxrpiodap e nvsls s2ra( oot1opt iocild s ul( p;t0tetnif to1lm r uvi s)t2xm(rpiy4am nlnet tfaDtrxr ;o4opx mfciaslsDel( snt)texoxfciodfpDeluvo s) rxm(o oodope livtas a2rmxmoot1ope mi3iatlaDumu p;(0tlxrif iytfat au sl(0srum(m3no1ame mivia()sDurx oot4apxoiiciatlaDuanmo;(4tlxnmr oo1opDrli sls setmxopoydam emictasf rtrumpoo0aetnmi3ilt s ea( onu4 ltoxo3oytla r i ils0s2xrxrpio1alenlnct t a2uax pno1texoio3iltlaDuln s;t)tlerxo ta1fatelnesl(0 2tmxrpny1lltnlfct s)sDraurpnu0alt  octld a2rmnvs;u0 etnio todfp elnvs t teumxm iydameelnviat  rua( o;t4oetnmf3iltfa emu p u)arxoxr todfatr ieols0texo(m3oodale mivi tf Dtm( pnt1apeoioetat mDranvpn(4tltrxr3oo1lpt  ivilt t2xm(o3iu1am   neslt a2tr(m ;u0teen oeilt aDul(vo u)texnmf3oadlp r ieslt0setoio3io4olenlncil() Drrur ;t0ape miciltlm ra(vpnt0altnmf ia1la e u sl(0texmxo3nudam   ictltfs2urxm ;u1tlto ociat aDeauvs;u4arxnir3tydfptr ueils s2xoir3iodlptemicias a2umxmpno4tltnifciatfa eluvs (0tleoircto1lptelies;t)s2to(m iy1op e fei ( a2uaxmo;u4tlto oeiytfmDemuvp u4 ltnmo3oodomtr u o (  etr(r iu1ll  lfctas sDtaxmo;o0aexomociadlm2elu p;(0 rermf3tytopDeaieol()sexrxm iudamtelfcsat) 2raxront0aexnmi3iydfs uanvsnt)tlerif oy1la r i o;t0 2xoxopou4lltnlnvsls)srtr(  ;u0tpeo fciysfs emu p u4artoxr iatopteln s t0tetoio3iu1opte nvt ()arurxro;o4tetn f3iasfm ua( o (0altnmf3iytlpDr nvs;s  eumimpno4lp nlicta(fa2umx o;t4tlxoifctlsfa2umu pn() reoxfciodlmt ln i;(0setmxrpoo4ll n neta() 2uaur ou1altnmicils a ulnmpnt)aetnif3io1late ivi (0srxmxo nudape lnvia( arrmx  ;u1teenio3iltla2emn s;t)arxniocto1fat au sls0s2to(m no1lpe mfeta( aruaxr nu1ale  feildlmDua( o;u) eenxo iytom  ai i t0 rxmxopny4al n ivs ()aDraxmp;u0optomoetyt sDelnmp;t0 rtnxrcty1fptraivol(  2urxm oo1apee nvi s)sDrmxmpno4oee  ieils a ulu s;(0alenxo3ootfat aiei;t srtoir3iu4lmtnlivt tf 2uaxm ;o1apt mietltlm rlumont)tlerio3iytlmtrlues t0teurirpio4lm   ictat)a2trxront4alen f3ildfa uau ont4tleoxo3ty1fmDelnes;(  2tm(opoy4lmtnmnci s sruaxm ;u0oex  fcias aDelump t0tlxomo iy1fp elnvil(0 rxrio oodomen icsas  Durxrpot4oet  oeils aDumumo;(0tetomfctotlaD  nei;()srto(rpiu1oltnlnesa()s2ur(m ou4apeoif3iysfm ea(msn(0teenxrciydfp  li o s) etr(mpio1al n nctat s2ra(mp;u1alto ieild a em(mo;u4trtrmo to1opt li i ()texmimpoo4omte fet s aDrr( poo0optoif3tad m2rmn s (0 lxnir iotoate i i;()s2toxmpiy1lp elicsas sDrmxronu1tpenmi3ias m2rm(mont4arxnioctodoatranvslt  eurir oy4lmtemnvsl() 2uaumo;t1tltoifetaslmDuluvp u4 rtomfcoa1fmD  ues;t0 eumxm3ny4ll  mnvt ()srua(ro;o0altn ociltls em(mp;t)alenxfctodlptrlieol( trxrxr nu1lm   nviat  Dtax  nu0olxomfeiyt s2el(mo;u)trtnmocoatfpDr nei () rumxo oodop e ict s)sDtm( oot4apxn ietysfaDelu ont0 leomr3io1fa rlnvo;s0 exr(opio4lmee nctat)sDumxrp;t1aexnmieiysfmDeanvp t0aetnxf oadlmDeau s;s) exoxrpnu1ap e fviasfarrm(rpnt1opxniocilsla2ra(mo;t)texrmr3iy1fp raneo ()teurxm3io4ope  fei t aDtmur ou1apx ifeiydfs emumpnu4altomr iodopD ln s;t0trxmxm nu1alee ivtas)aDuru p;o4aetomoetytfm raumpnt0alxrirctadfaDranvs;()sruoxr oy1am nmnetat  2raur no0olt mietldfm uluvo;u0 eerxf3io1fatraueo;()sexoir io4apeelnvslt s2trum oo0texoio3tldlmDul(ms (4altomo oodfpteaneil()trtr(mpiy1lm n nvils)srra(r oo1oexo feiatls2rmu s;()tlermfciodfpte nesls0seuoimpoy1lpenmnct (fs2tru poo1ope ioetysfm rlnmsnu4aeenxr3oytlpteai o;s t2xm(r3oodam emfei sfaDur(ronu4oexnii3iydfsDranmsn(0altnir3iydlmD li ols trtm(o io4am nmivslt  2raxr oo4tlenmfeiltlsDran snu4aexrxo3oatfaD livi t0tetrio3nu1op elfet sfsrtrxmonu0tlt if3iyd m em(mo;(0alxoxr oy1lateluvil(0 exrxo ou1ll   netls s2taxr ;t0tltnmoeilsfmDumu snu4artrmr3iytom elivs;(0 rxo(m3iu1lp e fvil( srrrxmpoo4oex ii3ilsfmDumnms t4trxniociadfmtrauvi;s)trumir iydllenmnvt t a2urumpoo1apeoioetld s rln s u)aexoir ootfmt  i ilt) exoxmpny1lp elieils)s2tmu ont4optniieilt m2ea(vont) lxoxfcoytoptrluei;( s2umxo ny1ol n fvsa(  Durxronu0aee mo3iadfa emnms;t0tltrmf3totlm raneo s)sexoir3oy4lm elfetlt a2ra( onu1opx iiciasla emn s;(4tlxnmrctodoa  au i;s0 2toxr3nydal nlfvsasfa2taum ;t1oeenifetasfmDumn ont4trenxr3io1oa elies s0tetrxopoydomeelnesa(fs2trx ont4opx ifeiasfsDrluvo;(0arermf ootla e uvsl( texr(r oy1opt mnvtat) Dumu o;o0teeomocils sDrlums (0tlxnifcoadlm   ivi;( srxoir iu4lle lici sfsDrmu ono4tpx mf3iysla eluvs (4trtoio to1lpD  u s t s2um(r3iu1apenmfct t)aDumxrp;o1aexomfetysla2umumo u4 rermrcio1lp e neo s0tetrio3iy4amee nvtat  rtrumonu1olxoioeilsfa2el(mont0 rtnifcootlaDr ies;s0trtrxm no4amtemicsa(fs2ra(m ;t4ale mfetldla rluvs (4alxomr totlp  anvo;()trtrxr3iudlptelfviat aDtrx ont1tpen o3ils s2ulnmo u) renir tydfa r nes;() rxmim3oodope livil(fsDrrur no1opeoiiciasla2uauvo u4tlxoxr3oydlpDrlu s s  exo(m iy4amtn ict (f rtmxrp;u4tlt  ieiydlm2rmnmont0aleomo oytlmDe ieilt0s2xriopiy1lpe mfci t)sDtrx  nt4oeenio3iatfs ulump (0alxrif3tydfmDrlnei t0s2umxr iy1lp emivi t) Drmxmo;u4opxn icias mDuln p () rxoxfcoatfa eln i t  2trxm nydlpt  fcia()a2umxrpnu4optnioeiyslmDrlu on(4trxoxrcia1lmtrlueolt0trumxo3io1ol  mici ()aDtr(ront4apxniiciadla2raump;t0 eenxf3oadlmDrli i;s) euoxo ny1llte nes t arrmxr nt1oexoif3iatlm rmn s;(0 ltomo oy1lp elieo s0srxoxopnu4lm e netl(faDururpno0tptn feiltlmDea(mpnt0 eenxo3oatfmt lu i;t  eurim iy1lmenmivtls)artmur no1olxomoeiasla2ranmsnt)trxnir3iytlmD lnvi;s0trtoxo3iodalte net tf 2rau  ot0optoif3iys m um(mpn(0 lxnio3io1faD ai i;t  2trxr oy4olte fvt t s2urxm ou0tlt mfciyslsDeanvsnu0 lerxfciatlmtelivi t trtr(r3ou4omt  ivtlt)a2raxmo;o0opxoioeils sDulnvp u0alxoio tatlaDraieo () etrxm3oo4ol nliei s)artax p;t4tlxoif3iltfa um( p;()tleomocoo1oa eanvi;(  exr(m no1ap n icsatfarrru ooo1apxn o3ias mDem( p t4 eeoxfciatlmtelu s s)texmxopnodlmeemfeia(faDuru oot1oeenii3iatls2rauvp (4 etnxo3tatlm e n i;(0 rtr(r ou4alenmnesatf rtmuro;o4ope  o3ilsfmDua(ms u)trxrxf tytfa ran i s trumim3iu1ole lnctatfa2tax ono0olxomf3tlsla2umnvs;t0tlxrmf3iodfatr nes;t0trtoir3ou4oltn nct tfsDtrxmont0aet  ieildfmDrmu s;t0 etnxo3iadfpDeauvs t setoxr io1lmeemfvt ()s2ur( pou4oeenmoeiydfs2ua( ont0tlenio3tydfm rau ilt0 2xr(r3ny1lmtemivils) rum( pot0ole ifetasla2rl(mo;t) rtoxfcto1fmDrliesls texmim ou1ol  mfcsat) Drm(mpnu4tle if3iadls2uaumo;u4tetrmf3ia1latr ieslt0 etrimpoy1om elnvtls aDtmxrpnt4openiictyslaDum(vp;(4aetnio3oo1laDrluvi;s)srtm(mpnodomtemici s srtmx p;o0aptniicilsfmDem(vpnu4tetoxr tatoateaiesls) 2umio3ny4lmtemfvsl( a2urxrp;u4open ieiys aDrln s u0altrxoctydlmtrlivi;() 2xrim3oy4lmeelnet s a2ra(ront4ope moetaslm2ea(vs u)texnmf3oydlm   ivi (0srtrir3iodolenmfes tfaDrmxmpnu4alxoifeildls2uau o;(0tetoxoctydfat  uvolt t2umio oo1omtn fvtasfa2tmxm ;o0tee mieiydls eln s u)alxoif tydomt anes;t0 rxoir iy1omtnlnctlt  Dra(moot0tetomieiytfm emu snu) ltnmf3to1opt luvo (  etoxrpnu4lm nlnesa(  Dtaur nt1open iciad aDulums;t4tlerio oatop   ues;t srumir iy4lltnlfvsl(fsDuru p;u1tetnifeiat m2ean p u4 lxnxr iydfpt luvo;s0 eto(r oo1optn nvs t)srur( ont0apt ifeild aDuan s;u0trxnmfctatfa  aneo;t srum(rpoudllen nvil() Dra( poo1aexnmociysla2uln s;t0arxrio oytfmteau olt s2uoimpoo4lmtnlnviasf Dua(r oo1oet  fetatlsDran s;u4 etoxrcoatfm eau s;() 2um(o3nydolee ici sfaDtax  nu1opeomiciytla em(ms;u0 rxnmocto1oa r i il(0 2xr(o3io4lp n fcs s s2tmxrpoo0oee mfeilsfm2el( s;u4aeermo iydlmDrauvol(0 2xmxrpno4ame mivsl()a2tr(r ;u1open ieiltlmDuaums (0treomocoytlmtranvols  2tmirpio4omeemnvt s aDrr( oot4apeniietad mDrmnmo;t4arerxf iotfate ivs t0s2xoim3oy4om e ictas srrr( o;u4olxnmictydfs2ra(mo t0 leomr3iatlat luvi s)texr(opnu1lle  feta(  2rmumont1tpxo ieiydls2eauvonu0alxoxoctadomD lnvolt)s2xmim oudaptn nviat) rrrxmont1tlxoiiciyt a2rln pnt0aeenmocoatop rlieo (0 etm(r oy4aleelfvsls) rurxro;o1aptn fctyd s2rau s () renxrciatlm rlieolt0s2xrim oy4omt lfctas)s2tmump;t0tlto f3ildlmDemnmp u) rtnmo3oy1faD  uvo;t teuoxm3ny1opt lietas)srta( pnu4tpx ii3iasla2elu ont)tleoiocto1opD  ueslt t2uoxm3oudllt  ietas)sDtru  nu0tpe  f3ilt sDrlnmont4 leoxo3totopDelnvolt)t2xrxrpnudome  iciatf rrrur ot4olx mietys mDemumsn(0aetomr3tadopDr nes;( sexoxr oo1omenlfvsl() rra( o;u1alt io3iys s2ea(vs u4 ltoxrciy1fa  an s;s) rtm(o iodamtnlfcias a2um( poo1tpt  fetlt aDeluvp;u0alxomfcoodfp r u i s)t2xmxo3ou4om  mivta(f Dtru o;t0alt  fctad s rlu pn(0aeenxf tydlat luvols sruoir ou4ap   icil() rtrxrp;t1aetoifeild mDrlumpnt4artnmr3ty1fa e ivi;s t2xmiopnudapee iciltfaDumxmpno1opxn f3iytfsDulu pnt)tetnxo ootlmt aneslt)trto(m3io1lp emfvtls)aDtmumpnt1alxnioctlsls rmu o;()trermo3oadfp eaivs t0texrxr3iu4apt mivia(fsrurumo;t1oet ioetysfa rlnvs;t4 rtniocoatomt ln s t srxmim iy1opt mfciat a2ra(m no4texnio3tldla2ul(ms;u4aeenmrcoo1om ranes;(0setrxopoudapen fcs tfsrta(m ou1aeenmo3iyd m2ra(mp u) rerif3iy1fmtr n i;(0 eur(r oy1lm elnesat s2tmur no1tpe ifeildla rlnmpn(0tltnio oytoaD  neo;s sruoiopoydlm e neta(  Drrxrpnt1tlxn iciadla em(mon(4tlxriocia1fmteaivs;s0 rxmimpny4aptelnvia(fa2rmxrooo4oltomfcias aDrlums (0teeoxo3iy1fa eai ils0srxm(r nydlpt lfct sfsDuaxmo;u0tlxnii3tys aDrauvont0 rtoifcty1fmtraiei;s)tetmio ou4al e nei tfsDtmurp;t0oexo i3iyt sDulnmsnu4 exrxrctytfpte neol(0srxm(r oydal elncilt)sDuru  oo1opeoioctyslsDuanvp;u4altoxo oydfateluvsl( sruo(mpiudale lncilt)s2raxm ;u0optnmf3iadla rl(ms;t0teeoxr tydfmtr nes;(0sexm(m3oo1lpe mictls  rur(ro;u1oleomo3iyslm2emn on(0trtrxr3iatoaDe ivi;t0 2xoir3iu4ope mnvtasfarrr(ro;t1apenmf3iydfmDemnms (0altoxo iadopDeln s ()trtm(m3ny4amt mics t)aDumum nu0aexn i3ias m2rau pnt4tetniociadoa  lu i ()srtm(m iy4lltnmfct s) Dtm(r ;o0apenmoeiatlsDrm(vo;u4 rxnxo iydlmDr n s t)s2xo(m iy1alenmiviatfa2rmumoot0oet mociltfa emuvs;u4tetoxo oadlate uvi s texmxo3oodam emnet tfa2rr(ronu1altnmoctatlm2uln on(0 lxrmr3oytlpDr ues (0srxr(rpnodale mnesa()sDum(rpnt1oetoifeiysfm2emnvonu)artomr ootoa eau s s t2triopio4lmtn ivtl(  Draxmoou1oex iiciyd aDemn o;t0trxrxocty1fpt lnei s s2tr(mpou4alt mfeslt)s2uaxmonu1tpto octatlm2uau s t)trtoif iodfat ln o;()texmxr ou4lpte ivsatf Dur( p;t1olx  fciytlaDum(vo;u) exoxo3iatlmD luvi;(  rtr(mpny4olte ivt ()aDtr(rp;t4opxoifetytlsDeanvp u0areoio totfm  livil( srur(o3oo1aptemfeiat)aDtrxront1apeoiocilsla2umnmp ()texnxf tadfpte uvi;t0t2xoio3no1llt  fvslt  2urxrpot1oltn oetasfa2ra(vs u4 rermr iodla rli i ()trumxmpio1altn ivi t) rrax pnu4tlx  i3tadfs eln o;t0altomf oy1lmtranvo;s)srxm(r ny1al e fvsatfaDrau p;o0apeomi3tydfa2ulnms t4arenir oodfa e nvo (0 2uoxrpiu4amenmiei t) rtru pot4olen o3tldfa rln pn()trxomrciytoaDrlnesl(0srur(m3io4am emnctat)sDtau p;t1opxoio3iyd m2um(vo;u0tlermr oa1opDe n i ()srxmxo3iu1lm e fviltfs2tm(rp;u1apeoioeias a2rlu p (4 ltnmr todop e ueilt)srtoxm io4lme  iesat)arrmur ;o0tee  feiys a2rmn o u4tleoifciytfpte uvils srxm(r3nydolee fcsatf Dtmurpnt1aeenioetls m ua( ont)alxoifciytomteaneo t0texoxo io4olt lfctlt sDrrxr no0aexoif3iys a2uauvs t)tetrircoydoat aiei;(  2um(m3ny4omenmnct t)aDrrxr ;u4teto f3ildls uanmont4trenif to1fa ranvo;t0seumxr3iu1lptn ivs ()sDra(  nu1opeo ieiltfa2ua(vp u0trtomfctotlat an il(  rxm(o ny4open nvil() rumxro;o4aexo o3iad a ranvo;u4trxrirciotlp elu s t)teto(rpnydlm nlivias aDurxm nt4oexnmi3ias aDua(vo u0texnmo oodlptelu o;(0 exoxm iu4omtemncs (fa2raxrp;t4tpx  o3iyd s emnmo;()aeenif todla rlneols)trxoim iu1lpee fvsas  Drmu o;t4tlenifeiydfm eauvsn()artnir oy1fm  luvo;t0s2uoio ny4lmtn icsa(  2ta(ront4tlx  f3ilsfaDea( o;u4arxrir todlpte ivsl(  rtoio iy1ol elnvi t  Drmuro;u0apxnmf3iaslsDuaump (0 rermr3oadfptelueo t  rxoxrpoy4lpe mfetltfsrta(  no4aexnmieiasfs ulumon()trxomrctydoate u s;s0s2tm(rpny4opt mnci s  2uaxr nt0alx  i3iysfm ua( o ()tetnio3tytoaDean ilt) 2xmxm3oo4lpt livsl(  Drmu oou1teeoif3iasfs2ean p t4trerif3oodopt aneo;t0trxoxopiy1apt lnvta(  2taurpno4oexn oeiasfsDranmo t4trtrxrciadlmDeli s;t)srumxo3oy4altelnctas) 2tau  oo0aetoifctldlm2rlnvpnt4 ltnio iydlp ranvo;(  2xrxm3iu4lmte ivs sfsrraur nt0alto fcilsfa ulu p (4 etnmf3ta1latrluvo;t trtmiopoudlmtelfeia(fsrrmx  nu0ape  ietls m2emump;t0aexnmrcoadomtraiei;()t2tmxm no1lmt mfet ()sDum( poo4tleoioctydlmDrlumont0aeeniocoytopteau ol(0s2xrxr oy1lle  nei sfsDtmur ;o1oeeoiociatlm uauvp t0aeeriocootomt  i s () 2tmxo3ou4lp emicsls)srtax  ;t4tleoifciytla2rm(vo u4alxomf3ia1lm  anvilt  exo(rpoydap   fcsa() 2rrxro;u0olenifciasfs2em( p u)tetnif3oa1fmt  n s t0trxr(m3nu4lmtelict sfa2urx onu0texn i3tat a rl(vo u)arxrxrctytomD  uvilt  etmiopou4ome livsatfa2rax o;t4tpto oetlsfs uaumpnt4 rtrirciydlp  li il() 2to(opno4apt lnviatfa2tm(m nu0ole ii3ias sDua( s;u4teeomo todfatraieo;t0 rxoirpoy4lptn nvta(farur( onu1tee  oetas a um(vo;u0texnxf3oy1fmtrlneils) euoxo3no1lm e neiat)a2raxmooo1oexnifetad aDrlnms t)tlxnxocia1fm   i o;s0sexoir3nodll  livi t  2tmu  ou1tlenmieiyd s2uan pn() etnmr oytoptranes () 2xrxo oo1amenmfei sfartm(  ;t0alx iicilslm2ua( o;(0 rerifciydlmt  ueo (0s2uoxr nodoptnmivtasf 2uax  oo1olxn ocilslaDelu s (0tlxomrciotfaD  ies s  etoir3oudolt lnvtl( arrru pno1oetomf3ilsfs2umnmo u4tetrifciodlpD  ieil(0 euriopio1olt  iesl(fs2ua(mp;t1apeo fetatlmDean pnu0 etrmr3oy1om e i sl() ruoir3nudlltnmncil(  2um(  ;t0aetomfetld s emuvo;t0aexrio iodlaDr uvsl()tetm(o no4opte nciasfsDur( p;u0apxoiieiyt a2uluvs;t4teenio ta1fm r ueo t  eumxr io4al  lnet s  Duaurooo0ale mi3iydlm uan o;()aexrxo3ty1lpD livil( trum(rpny4ap  mnvtls  Dtrxr no1oexnii3ilslsDuan pnu0trenxf3iatomDe i s (  etoxr oydlpt mivs sfsrumumpot1oetoiociyt aDul( p;t0aetomo tatfpteanvils0 rtrxm io4ap nlfcs s  2rrxr ou1apxoif3ias mDel( pnt0aeenmf ia1fmDe ivolt0 etmxr3ou1ol emfesa( srta(m no1oeenmi3tasla elnmon(4arxrxr tatfa r nvi;s trur(rpiu4oleelnctlt)a2taxroou4tex mietlt sDraumo u4aexnxr ta1lpDranei s)srtoxr oy1om elfetatfaDrrurpou4texnifciys a em( sn()trtnircio1op eluvslt srxrir3nodlm emnvs ( a2rrxmont4oet io3iysfsDuluvs;t)tetnxo to1omtrlu o;(0srumio3oodalenlfvi tfsDua(mono1opxn f3tltlm rau p;t4trermr3totlp   uvolt) 2xoxm iy1lmtnmivilt) 2trx pno1apeoiiciasfa umu p u) etriociatlmtr uvi;(0 exoio3nu1ll nlnetls aDrmx  ;t4ope  o3tlt sDrlnvs;t4tlenmr tydlatraieilt texmio nydllenlnvs t)a2umx o;u4tee  feiat a2uanvs t0 exrxocoa1la rai olt) rtmimpiodomt lnvtls)sDuru ont4tpen feiatfm eanvs;t)alxoif oa1lpDrlivi ( s2xrir oy1am nlfvt (  Drr(  no1alen oeild s2ul(vo;u0alxoio3tatfpDr uvs;s  2ur(r ny4apen ncia( s2uru p;o4tet iictatlsDrmn o (4trxnmf oydlptrlnes (0s2xoxm oo1ol nlfvias)aDumum nt1tpxoio3ilsfm ea( pnu4aeermf3ty1fat  ues t  2uo(r nu1ame mictl(faDumxm ;u0tex mi3ias a2uauvsnu) eenxocoodomte ieo (0srxoir3iy1lleelfesa(fsDrm( ono0oeen fctytlm2ea(mp u4tltoxfctadoat livols)setrxm ou4opeemici s) rrrxmpnt0olt mociaslaDua(monu) reomr3oa1fmDrlieo;(0 2umio oy1am nliesl()sDtm(r nt0opxomf3tys sDean snu0 lxomr ty1fpteai s;() 2xrxr oo1olee ict ()arrm( oot0opxoioetytfsDemnvp ()tltrxfcio1omDrlu s t  rumxm3no1lmt lfcilt srtr(m no0oexnmoetat a2um( pn(0aeerxo3oa1op eai i;s) rurxr3oo1ole  nvtls)artmurp;u1aeeomoeiatfs2ulu s;u4 ltoxo oa1fpD  uesl( t2uoio iu4ll   ici s aDtr( ont1tlxn i3iydls2uanvs (0 reoxfcty1oatr uesl(0sexoir3oo4lp  mieslt  ruau  ou1opxn oeiysfs em( pnu4areoxo3iydopDean s t0 exoim3iudlp  miviltf rraxro;u0aeeo i3iad a umumpn()trtrio3tydlpDr ivsl()s2tm(o nydaptnmictls aDrau  nu4tee  fetys sDumuvo u4aexnir3totlmDeauvs t setmio iydamtnmnei sfsDtru  nu1aeeo fcilsla2elumont0tlxrxf tytom e uei s)srxrxm ou1ol emfci t)a2trxr ou1aptnioctatlm rmumpnt)tltoxrctytlpDr ueo;s)srtoxmpny1olt mfvt t srurx  nu0oex  oetatla2em(vonu) etoxo oydlmt ai s t s2toxmpiu4aleelncta()srurx  ou0aexoifciadfa rmnmp;t) eeomr3iadoatr nvi s  exrio3oo1ap nlfvtl(  2uau p;o0oexomfcias aDelumo;u)trtnxo io1lpD  u s s srtmim no4omeelneta(fa2raxro;t4olxomo3tltls2em(vsn(4tlenmocoytlatrlueils0s2xoir ou4om elieils)s2rm(r ;t1tet iieiys aDrlnvsn()teerxr oydlmt anvo;s) rxrio3nodaptnlncs tf ruaur ;u1aetoioeiadfa eauvo u4trtnio3oydoat aues;s setrxm oodlmtemfetat)s2ra(m ;t4teeoio3tlsfa2rl(vo t0tltnmoctatlpD lnvo;s)s2xo(o3iodlmtn fctasfsrtaum nt1tlxnio3iad s rlu snt)tetnmf ta1opDrli i t0srtmimpiu4am   ietltfa2tm(  ou1opx if3iydfa rlums;t)trxomo3ta1fatelneo s)setmxo iydoleelivi t sDta(mooo1olt  fctasfs2uau o;u4aetoxf oytlmt luei;s setmxm oo1lle livsasf 2ur(mo;t0tlxo o3iyd s2um( o;(4tlxnxrcoodfateaiei t0 rtoxm3oodameelictlt  rrr(roou4aexomfciyd a2um( pn(4 etomo totlm   i il( teurxrpnydlmt mnvs sfs2umumont1apen oeildls rlnvs u) rtrmfcoodlaDr nvslt)s2xr(rpou1om   nesa(f 2uauro;o0aet if3ilslsDum(vsnu0aeermrcio1oa rlnvi t)srur(r3iydlltnlncsas)a2tmurp;o4aexn feiyd aDrmnmo (0 rxrmfcoodopDelu sls teumio no1lp n fesltfsDtru pnu0olenmociyd s2elnmp;u4tleoifcoadoaD liei;s trxrio3oodolenlnvsl( arrmump;t0oexoifcildfm ra( o;u4texnir io1fateaies;s)t2xm(m iy4op nlfcsa( sDtm(m nt0tpxo fciadla2emu s u0tltnmo3oydlpD anvs;t0 etoirpou4ole licias) Dur(rp;u1opx io3tltla ua(ms;t4texnir3oy1fmDeai i t s2xrirpoodomeemivi t a2rmxmooo4apxn feiatfa rmumsnt4arxomoctadomt  ueo ()s2tmxm3iy4amte net s arrr(rpoo4apeoiicilt mDranvsnt0alxnif3iatomtrli slt0srum(r ny1ap nlnvtat) rtmxronu1tpxnioeils sDuauvo;t0 eenio oatfm elivo (0 2xmirpou1lp emies t)a2umxmo;o0tpxomoeiyd m rl(vs ()aetnio3oytlaDe i o () euoxr oydaptnmfctatfsDrauroou1tpe mfetld s emnmsnu4teeoxo3io1omD li i () eum(mpou1opt lictl()s2um(r nu1teen fcild a2um(mp;u0 ltniociadoa elieo;t0trumiopiy4lpt  nvt ()aDuru  ;u1tex mieiyt s2rl( o ()tlxnxo oo1fpt an o;(0srurxr ny4op e ivi s arua(mont0ape  oeiydla2uau s t4 etrmo3ootlp   ies;()seurim3oo4ll  lfct s sDtau  ;t0olt ii3tas m2uln o () lxnio3to1omDeln slt) eurxmpnodll emfet () rra( p;t4tle mfciatlaDrmnvs;u)artnxo3iy1fatraivo;t0sexrxmpnu1ol  lnetas  2um( oou0tltoifeiasla el(vsnu)alxoxf3ty1oa  lueslt)truoxr3iu4al nlfcsasfa2urxr oo0aee iieiydlsDeau snu0aleoif io1laDr uvslt)truo(mpoo4omt mncia(  Dur(m oo4ope  feiytls ulnvonu)aeeomrciy1lmDeaiei;( s2tmxopiy4amenlfesa() 2rmx o;u4olx io3iadls2ua( p;u4artoxf3tydoptrai i;t0t2um(r3iu1openmnctltfsrur(  nu4aetomo3ildls ulumont)tlxomo oytlmDrlueols) rxoxrpoo4olt  ietas sruaxmo;o1teto ietltfa2ea( pnu) rtoxf3io1fmt an s;s0 2tmiopio4lmtnmivi s)artmu p;o0tee ifctaslaDrlums t4altrmfcoatlp ean o (  rtm(opnu4altemnvt t sDtau pou4olenifctatfa2umump t4teerxoctotomD lnvsls)sexrir no1am   fvtlsfsDuaxrpot1oleniiciydls ul( sn(0tlxnxr3iodopD au sl()t2xm(r3no1ome  ictltf 2tm( ont0tlxomi3iytlsDel( onu0 ltrmr oa1optranei;t)s2xrim oo4alt  ivtltf Draxrono4tle ioeilt m2emn p u0areoif3iatomD ln o;t0truo(o3oy4ole  fet sf 2raxr ou4texniictltlaDemuvs;t0tetrmrcoodla r n o (0sexrxrpio1ol nmnci t)sDrax ont1opxomociydls eauvo u0 exnmo3to1oaDrli sl(0teur(m iodomt mfvi s  rra(mpnu4ole  iciys a elnmp t0alerif iodlpte u olt) euriopiudaltnlfcs t)arrrur no0alt mf3tltfm ul(vo u4teerio3iydopte i s s0sexmir3ou4lp elivsat srurxront0texomoeiys s2el(mp u) eenmo oytlp eai slt)srxoxo oo1lpt lfctl() rrr(mpnu1apeoif3ilt aDem(vs;u)altrifcoodfaD anvs s0 rxmim io4al emnvsasfarrm( pno0tlen ociltlm el(vo (4 eerif to1lpDeaivsl(  exrir iodapen fciasfaDum( ono4oetnmoetldfmDea( snu4 rxnio iodfpDrlieils0 rxr(r3no4omen ict s a2trxront1tpeomo3tyd m2rm( snu0aetoir ia1lptelivi;s) euoxmpoo4op  mfctasfsDrmxr ;u4ale  ieias a2um(msnt)trxomr oatlatelivo;(  2tmxr no4ale livi tf rum(rpno4tetn o3iadfa2umu pnu)tlerir3oydfateli olt)srxmxrpiy4ll elnetls arrrxm ;u0altn i3tyd s2rauvsn() rtoif to1fatrauvs () rtoimpnydllt livtas) ruaxro;o4aeto ieiad mDel(vo t4tetrxf3todlmDeai sls0 2xo(m iodameelfvilt aDur(rpou1aexoiiciadfs umumo;u) eenmfcootopDrlnvi;(0 2uo(o oy4amen fvsas) rrr(r ou4altoio3ilt a ul( s t) etnmocto1lp elnvils0t2xmxm3nu4op n nvta(  2uau ooo1alxniociydls2el(von(0 rtrmrctatlpD  i i;s trum(rpiudape  nvilt)sDtm(m ot0tpeniociyslm umnvo;u0altrmfcoy1faDrai slt0srtmxm3iydapenmivtlt) rtmx pou1apen f3ias m2uaumo;t) rxrir oydla   ivs;t0t2um(opnudal emfct ( arrmxrono4altnmictatfmDemn o;t)treomf3iadfaD lues s  eumxopnodlleelnci t  rtaxm ;o1tet moctydls emnms t0 rxrir iytla  lu i s  exrxr3iodome livsat a2rrxmo;u0olxn f3tysls2umu ont4 ltnmr3to1lptelivs;(  rxo(r3oydal emnei tf 2uaurpot0oee mfetasfa rm( pnu)tetrmo3tadlmt  nes;t  2toirpoydlmt lnvils  Dtm(mpnu1aeeoiocildfs2umnvo (4trtomf3to1lm e neolt0 euo(o3nudll e feiltfa2tr( pno4altniociyslmDrluvo u)artnxociy1la r i ils  2urim3oo1lmenlfvias)artr(rpou1aetomietlsfsDemnmp;u)aeermrciodfmDeaivi (0trumxopiy1lpte ncs (fa2tmu p;u1oetnmf3tys a2ranvo u4aexoircoatoateau sl( trxr(mpny4ll nmnciat sDrrump;o4aetnmieilsfa el(msn(0 eermrcoodlpte u i t0s2to(m3no4al  mivilsf 2urxm no0oeeoio3tys m ul(vp u0aeerxo iy1fpD lnes t)seum(m3nu4alee nvsas aDtm(mpot4teto oetltlm ul(monu)alxnxf io1oatrai i (0sruoxmpoo4lm e fvsa()a2ua(ro;u1tlenmfetys mDrmnmsn(0aleomo3tadfptr u i;t0 euoxrpou1aptelnvia(fa2tmxrpou0apt  fcils a2umn s t0tltoir ta1fp rluvslt0 2xoirpio1apt lfvsas) rraxmpno1tex moetldlsDelu p t) reoxfctodlmteln s t0s2xoimpiudaltnmnetlt a2urxro;t0oeeoiociltfs rl(ms;t0 etoif3oatfpDeanei;(0texoxo3iudlptnmivtas arumumono4opto iciyd a2ea(vo;u0 lerif3tytfpDeanvols s2urxrpiydop e nvsas aDtaurpoo4tltn f3taslaDumuvp;(0arxrmr3oodlpD anvs t0 rxmio3nudlmtn ncta() rum(mpnu4olen iciyt s elnmpnu4arenmfctydopt livs;t sexoim iudaptn ivtl( srtmxm ;o0oetomietltfaDuanvpn()tlerio3ootlmtr i s ()trxoio oo4lm n nvtls)sruru o;u0opt  o3iatfa2ua( o u0 lenifctotfmD  n i;( t2xm(m oodale lnvt ( a2tr(r ;t0olen f3tls aDua( o t) rtrxr3tytlptr nes s0 rto(m oy4olee fcta()aDumx pnu1tlxnmfeiadlm2ulnms;u0 rxoio3oatfptrli o;s)srxo(mpnu4omt lfetas)s2urx oou1tee  icilslsDrlnvo;u4 rtnmr3iatopDeluvs;t0 rumxo3oydoptnmictls) Dtaxmp;t4oexnifciydlaDeaums u0aexoio3oytlptrlivo t  2toirpou1lpte ncias  Dtrumo;o4oexnii3iysls2ran o t) rxrxrctatlaDr nei (0 2xoir iodop elncs (  Duaxrpno4tpen ictlsfs2rmnmsnt)tltrio oa1lm  auvs;t) etm(m3no4ap nliei t)aDtaur ;u4oltomi3iyd sDelnvo t)aleoxociadfp  anes;(0trumxm nu1lltnmies t)artrum nt1opxnmfciat s uln s;u4 ltoxociydlatelneols) 2umxo3nu1llt  neil(  Duaurooo4open ociadls2ranms;(4tleniocto1lpDeaiei;t s2uoxm3no1llte neslt  rtmxm ;t4texniicild m uan p u4tetrxrctytfpD aivils0 ruoxopiudaltn ietlsf Dumx pno4oetnmf3tysla2rmnmo;(0 rxnio ta1la   uvs ()sruo(r3iy4ame lict s)sDtmur ;o1tptnio3tyd a uluvo;u0aetnifcoadlp elu i s0trtrio3no4olen fcia()arrr( pno0tpx  iciasls uanmont0alenxr oytlpD au o s  2xr(mpnu1apt  fes (fa2uau ono0optomo3ils mDum(mo ()tetomf3oatop  livs;(  2to(o nudaleelfctls arrru  ;u0optnmi3tadfmDrau ont0tlerxo3tydoa rauvsls0srxoxr3nudole  feilt)srta(mpno1tetomociad aDum(von()alxomociydopDranesl( t2xm(opoodomtnlncta() Dtrurpno4apxnioctadfm2rl( snt)teermr oy1faDr u il(0 rtmxo3oodol   ivt t a2tr( o;t1opxn ietlsla rmu on(0tetoio oydopDr i i s0seuo(rpny1ameelneslt srum(r nt1alx  o3iyt sDrmnvo u4 etoirciotfmte ies s0setmiopiodlpeelnctl(farra(m nu4ale iiciyslmDum(mpnt0 eenxr3ia1fat auei;( t2xriopiodomen iciasfaDuaumo;t4aetoio3ildls eanvs;u)alxnircoadlm raneo;(  rumirpnydaptemfvslt s2rmu p;t0teenio3ilslmDum(vs u)tlerirciadoaD an o;t0t2umim3oy4optnlivs t)artmurp;o4tetn o3iatfa2uanvs (0altnmr3iodopt livi;s)s2tm(rpny1lpenmfvtatfaDurx pnu1tltomfcils mDum(mo t4trerio iotoa rai s t teuoimpiodame mics ()artmumoot0oex if3iat sDeln s u)trxoxo3ty1fmDelnvsl(  2trimpiu1am nlfvta()srrm(mo;u4tet ifcildfaDrl(mpnt0 rtrxfctadopDrln ol( trtoio nu1al  mnvta() 2rm(mpoo1ape mietatlmDrmumo;u0areriocootopt lieo t0t2xr(o iu1opee ncsat sDrmur ot4aetnmi3iys m em(msn(4alerir ia1fp  auvil() 2um(o ou1aleemieiat  Drrum oo0aet  fctasfaDumumo t0tltoirctadoaDeai ilt)s2xrxo3nu4apenmneilt)aDrrxrpno4tpeomiciyt mDumums;(4tlxomrcoydfpDelnvs;s0sruo(m nodlmee nvta( arur(mp;o0oeeomo3iaslsDrmnms;t)trermf oadom   nei s  rur(opiudlmt livias) 2rr( ont0oeto fcildla rmuvs () exrxrctodlateaieo;s  rxm(mpiodape  fvs sfa2raum nu1olt  oeildfa ran onu4 lxrmr3oo1fa e uvo;( s2tm(o no4llenlict sf rtrxmooo1teenmf3iytfsDumnmonu0aetnio3iodlmt  ivsl()trurim3nudlm n fcilsfaDuru  no1teto o3iadla2ul(mp u0teerxr iydomDraneil(0texoim iu1llenmict s) rraxm ;u4tlt ifciltls2rmump;(4tetrifcoo1fat auvol( s2urio iy1ale  fetatf Duaum ot1aex ifeiasfmDrlu p u)tlxnifcoadla raieols  rxoxm3nu4amtnmfcsl(f Drmu ono1oeto i3ild a2ul(vo t)altnmrcia1fpDr nesls0sexrxmpou4om n fetlt  rrmu pno1opeomfeiyd s2rlu s;u4artrxf3tytlmDr n ils0 2to(mpnydol  livi tfsDuru  ou0aptniociaslm rlums;u0tlerxr3to1fa  luvo (  etrio3nu4omenmncsl(fa2ururonu1tpt mf3iltla2emumo;u)teeoir3oatoptrai sls0s2xrxm3iodlm elnet ( sDrmx  oo1tptnmi3iyt s2emuvo;(0artnxf3oy1fa elnvol(0srxmxo iy4ap n nvta() rtru pnt4oetnif3ilt a uanvs (0tltnxocta1lpDr ivi ()truoio iu4ameelfcsls) 2rm( poo1oeeomietydlm emnvp u4 lerxfciytfmDrluesls0 exr(r nodopen ncta(fs2urur nu1ale mocildfm2emnvs;()altoif todoaDe ies;t0trxoim3oo1ape lnvt t)s2tmx pnu0aet  fciys aDum(ms t0 ltrxf todfpt  n s;s0s2umio3ou4lp  lnetatfaDtaxrono1tet mi3iasla um( p;(0tlxomfcoo1lateaivs s s2uoio ou4omtn fesas  Drm(mpnt0opt if3tas s em( ont4texrio3ta1omt  ueo;s)trtoxopoy1al elncs tfa2ua(m nt4optnmfciydfm2ulumo u0tetnxo tydlm ran s t  rxmim ou4lpe lfeta()a2tm(  ;o1aptnio3ilt mDuan snt0artrxocoydfm e ueils0s2uo(rpnu4llt liet sfartmxmpot1tle  ieiadla2uauvo;() leoif3todfmt livs s0t2xmxopou4amen fviatfs2rm(  nt1aptniietydlmDrmums;() ltoif3iatlm rli o (0sruoim3ny1lmee fei () 2ra(  ;o0aexnmociysfs2uluvpnu0trenmr tytfp e u s;s0 rtoxm3nu4am emieils)aDumur ;u1apen i3iytls ulnvp;u4aexoir3oydomte ueo ()srtoim3nudlm   nvs ()srur(r nt1tetomo3tltla2rlnvp ()teerifcoydlpt  uvo s)sexmio3ny1ap n ivils arrau p;o1ale ifciatlm rlnvo t)tetnxrcoo1lat  uvs t)tetoxm ou1oleemicsl()sruru  ot4aet  fetlsfa2rmn s;()trenxf3iytomDr neo;t0 etr(o oy4om   ncsl(fartax  ot0tpx if3tytfmDulnmp t0aleoxocoodoat an sl(0texoxo iy4lp n nvslt  2rrumpno1tlxoifctytfmDumnvp;u0tlenxf3oodopDe uvo;s sexmiopoudope mieil( sDrm(rono4texnmiciat m uluvs u0altrmo tadom ran ol( trtoir iudlmenmfci sfaruax ont0aex mf3ilt sDranmo;(4trerxr io1lpte nesl(0 2xm(mpoydomte fcsl( srrmx pou1open f3iatfmDem( p t)arenxrcoytoa e ivs ()s2trimpnydol  lfes sf Dtr(mp;t0aet mieiys sDel(mp;u4 etrxf iatfpD ln il(  rxoxmpny4optemnvia(fsrururonu0aee io3iydfs ul(msnt4trtomo3iatomDe nvi (0 2urio nu1amt lieslt) Dtax p;u0aleoifeias s rlumo;(0alerir iydfm  lnesls)tetr(rpiudlmtn icia(f rurxm ot0aptomoeias s2ua(vo u)aexoxo tadoptran s;s0srxmxo3oy1llenmieslt arta(  ;o1teeomfeiytlmDua( p t)altomrciy1oatran sls t2tmxr oudlp n nvi s) rtaxmoot1aex ifciyslmDuluvo;()artnxo tatoat auvsls)s2to(opiodale  icta( aruru  nt0texnmieild mDrm(ms;(4 lenxocio1laD lu i (  rxoirpiudlp elnviat s2ua(rp;o4apen feils s eau snt4aetomf3ta1late uvs s0sexrxo no4altelneilt  Duru pot4ole ifetytlmDrln o;() eenxo3tydfmt an i ()setr(opiodopt  icsas sDraum ;o1alx  feiatls2ulums (4 leoxo io1fpt auvil()sexm(o oo4lme liesl(f 2tru  nt4teeoio3iysfm2rl(mpn() rtnmo3iydfmDeliei;s t2uoim3iu4om e fvilt)sDrmu onu4alxnif3tltlsDul(vp t0tleoir oydlat  ieils)teuoxmpio1ap e fcsls a2tmxr ;t0aptniietadfmDem( pn()arxniocta1oatelivi;(0 rxmio ou4lp nmieia()sDuru o;o1teenmf3tyt m2ulu p ()artnif oytlpD aiei;( teumxo3oudlmtelnvtls) rrm(m nt1tetnifctldfs2eluvon(4tlenio3ta1fat anei;() exm(o3iu4lpenmnetlt)srumumpnt4openiictys m ul(mp u0trxnio iy1fat auvil() rumxo3oodolee fvtat  2urum ot1tpt  ieilsfs2eau s u4aeerir3to1fp e ivi s)trtrxmpiudap  lneta()arrrx  nu4aexn ociasls2uau p;(0aexoif to1omD  u ils  rumirpio4lmenmivtltfs2tr( p;t1olxn fciltfa2ra( s u0 rtnxf3iadlat luvolt) eurir3iy4lptnlncs ()a2umum nu4altomocilsla2uau s u4 ltoio3todfp rli ilt0trxrxr iy4lmtn fctasf rrr(r ;t1apx  feiytfmDuan o u4aexomr oodlptrauvsl(0s2trir ny4aptnmncsl() Dumu onu0olxo oeilsfs el(vpnt)altnxociodfm eliei t0srumim3nydoleemneil( srrrxmo;u0tpx  o3ildlm2eanmsn(0 ltnir3iadlpt lu sls  eumimpny4lpt mncilt aDrr(mpoo1alt ifeild aDelnmonu) leoxf3oytop rli o (  eto(mpiudapt  feias  Drmu poo4apenioeiysfa umnvont4 etnxfcty1fatelivo t) 2xr(m3oy4apee feiatfaruaxr nt0opt iieilsfsDuanvsn(0trxoir3ty1omDeaneils)s2xmxr oodlleemfciatfaDrr( ont0apx moctltlaDumn p;()tetoio3iy1latelnvol(0srxo(o3ou4lm nmici (f Dtrurono0oexn fctat mDeanms (4trxnxrcia1lmDeai slt)trurxm iu4lltn nesa(  Draxrpoo1ale io3iadfa eauvpn(4 renxf3oydoa e nvol()t2urio3iudamt mnct (  2ta(mont1tlenif3iltlm umn pnu4tetriociadop elivi s0t2uo(o nodaltemneils)artaxrpnu0apeomo3iltfm eln o (4texrxrctytlpDr ues t) ruoxm iydopt  neil( sDtax pno4tee  f3iysfmDel(mpn()teeoxocta1la r i slt)trxmxrpnu1lpenliei s aDuru  ;u4oleo o3ilt a ulnmp u4 rtnircoa1fat auei;t) eumxm iodaptnlnvs () Draxmo;u1opto f3iat m2emu p u)trxoio tydlat lu i;( teum(o iudol n fcs tfaDtaxmpoo4tpe  f3tltfs2uauvonu)teenxocta1op rai ols)trxr(o3oo4ap n nvtltfs2ta(r nt4apenmoctadlm umn snt)tltnir ta1fmt anei t0 eumxmpou4lp nlnetasfaDur(mo;o4aetoiietltfm rluvs;t) ltnmfcoa1opDran ilt0trurio oy4lmt miesls aDrrumpot1tpx ioetadla eau s;t4tetrmr3ty1lm   ivo s t2toxm iy4ameemfviltf 2um(roou0oet ifciltlaDelnmo;t4 reoxr3tadfmtean s;t)t2tm(o no1lp nmnesl(faDrm(rpnu0optn ociydfm2emu p u) rxrxfcoatlmD  nvi;t srtrim ou1alt  ncsl(fsDta(mont4tleomfciysls2rmn on()texoxrctydfat  uei;( s2uoxmpoy1lp   fcs s)a2ta(rpoo0aeeoifetls m2el(mon(4 rerifciotoaDe uei ()truo(m nudamt mneias  rra(r ;o0tpxn feiytfa rmuvo;t)trerif3todlmDran s ()seurxopio4llt mnetlt)aDuru onu4aeenii3iytlmDra(mont0tetrxf oy1fpD lneols) 2xrim3oodam e ncil(fartmxrpnu4tlen f3ils a2umnvs t0tltoxrctydom   n o s)seurxm3oy1llenmnetltfsDur(ronu0olxnioetysla2umumsnt4texoxo iydlpD  i s t)srtrir3io1ol n fes ( srumu ooo1ope mf3iytfa2rln p;(4arerir io1oaDelu s ()s2to(opoy1lmte fetltfsrtmurpno1tex mo3iadls2rau o t4aetoxf3oatoptranei;s trtrxr3oydop nlivsls sDrru  no4tex iiciatlmDrlu s t4 reoiociatfp  lueils sexoxo3oodlpe mfvil(fsDtmxm nt0aptoifeiltfs raumo;t0tetnxf3oadfm   i sl(0 2tr(r nydal emnesas sDrmxm oo1aptomo3tls a umn o;u)aetnxf3tatla  aneol() eur(rpoo4olt  nei s a2rm( pot1alenmieiytls eln o u4aeeoiocio1lmtean ils0 rtoxr3oydal nlict ( aDurum no1alenmociasfs2rluvo u4 eenmr3oydop rli s;s0tetmim oo1lpeelnvtlt)aDumxroou0texo oeiys s2ea(mp ()aeermf3iodfpte u o;s0 exmxmpnu1lm e ivtl( arrmxm nt1apeoiietasla eaums;t0texrmf oo1fm rluvi (0trtr(m3io1lmeelici (  2uaum ;o0aleo oeiydls rmuvpn(4 lermo iy1oatelnvi;s0srur(r iu1apt  fet ( srum(rpou4apxoifeiytfmDrl( o;(0alerif iydopDeai sls) exmxm oo1al nmfet s)srrmxmpou0apt  o3iytls emuvs;u0 lxnio ootop raivi;()s2umim oydameemfcilt) 2rm(mont0tle mi3tytfm2ulnms;t) rerxo oytfptrli i;()s2toxmpnodomt mfeia()sDurxm ;o4tpx  o3tatfsDumuvp;t0altnxo ta1fm  lneo;s  2xrirpoodom nmfvta(fsrum(rono4olxo ocildlaDra(mo u) renmr oo1om eaies ()sexrxrpoo1lmtelictlt a2uaxr nt4olxniictatla uauvpnt0tlxnmf3oa1lpteli s s0 exm(rpiydamen fvs t)sDtm(monu4tlt  i3tat m2eau s;() rtomr todfm r ies s)setrir3oy1al nmivta()srrr(m nt4olen iciasfs rlu ont) lxnmf3oy1opDe nvil(  ruo(opnydoptnlicsas)arumxmonu0tet  ieiatla2umnms;u0trtnio iotopt lneo s t2urxmpoodopee icil()srraxmoot4aexomociad s raumon(4arxomfcto1opDr n olt srxoir3oydlp nlfesatfsDra(rooo1aee  o3tlt m2rm( o u)tltrxrcoytlptelu o;(0s2xoim oy1ol n fvias)srtmxmont4oexn o3iad m umu snu) ltrif iodfmt  ivi s s2ur(o io1ap  mfei ( sDumx oou0opeo oeiad a eanmp ()tetoio iodoaDr nvo;( trxmxm3nodole  ict tfa2tru ooo4texnmf3tldls2eln pn(4altrmo tadop e ies (0t2um(r nudom   ieia( a2tm(mpnu1aee  o3tatlm ulums (4 reoxo oa1la  anvslt s2xoir3ou1amtnlfesl()artmxr ;t0altn ictlsfs elnms t0tetrmr to1la eaiei;t  exoio3no1amtnmnvsat) Dtmxmpnu1aptn ictatlsDelnvs u)trxomf oatoatr neo;(0seto(mpiy1al nlfvi t  rtm(ro;t0apxoioetltlmDrmn s u0artnxr iadfp r neilt  2trio oydolt  ietas s2trxm nu4oet iociys aDulnmpn(0tltnmr oatfmt  neils0t2uoxopio4amtnlics sfaDtrxroou0alt  ietydfaDrlu s;()tltnmr tydfatrlu i ()srxrxm3ny1ame livs tfarrrurpot1olxo oetatfmDeluvp;u)tlxnxo3oa1lp r n i;s0 rxrir3oy4al e fvs (  Dum( onu0olx ifctysfm2em(vs;(4 lenmo ia1lpDraiei;s srxm(r nu1apenmfvsas)sDumxro;t4ape mi3iyslm2rmn pnu0trerio iatfat luvs s  2xr(m no1lp nmiesl()sDururp;u4tetomoctasfmDemuvp;u)alxrmfctatlmtrluvsl(0 2umir iydamen fvi t)srum(mp;t4oexomicils mDeaums;t4aexnmo3totom r uvils s2xoir3oodomeemieils aDurumono4opt moetysfm2ean o u4teenmo3oytlmDraivo;s0sexm(rpno1lmtn ietasfs2rau pou0oetn oeilslmDrl(vsnu0aetnif totfm e ies;t srumimpio1lmt  fvt (f 2um( p;o4optn fciytlm rlums;t4altrxfciytlmtrau o t0t2ur(rpiy4ame  fcilt)sDuau pot4olto ociyd a2elnmpnu0aeermr3to1lmte neslt  2ur(m iu4ameelnvta()sDuaumpoo4oeen ietadfaDumuvsnu)altrmrcoo1fm rluvils)setmim oo1al nmfct s)s2umu  ou1tpen i3iatfa elnvsnt4 lxnif3tytlaD an s (0tetrimpno1llt mietas a2truro;o4ape  fciltlmDrluvo (4aeenmr3iy1lm eanvs ( texrxm3oy1ole mfetatfs2ta(m nt4aexnmfcils s2emnvo u4 ltrio totfa r nvol(0trto(mpiudameemietl( sDtmxrpou1tltnmfeiytlm elu s (4aexrifcoy1fpt  nes;s0trtoxr3iodlp elfvil() ruaxrpou1aptomo3ilt m2ulnmon()alxomrcootop e n s s0trxoio3ny4ame  iet (  2tmum no4teeo fciysfmDumu on(0altoxr3iotfp e ivolt0srxoxm3oy4ol  mfctlt s2rr(  nt1apeo o3iytlsDrlump u4 leoiociytlaDelueo t) exrirpny4al emneia()a2ta(  ot4olx mi3tadlmDuan s u4artrircootom e ueols  rxr(opio4am  mnei () rtm( ooo4alxnioeias m2rm(mo;()trtomo iotop rli il( srxoxm oydllenlicsl(farrmum ;u1alenii3tld a eauvpnu)tlxomr io1omD auvo;(  etmio3no1ap  mnvil( sDumu p;o1oexoiieiaslm elnvpnu0 lxoxoctodomDeaivo s  2to(o3oy1al n ncil(  2rrxr ;o1oex  oeiyt mDrmn ont4tltomrcoydfatrln olt0trxr(mpny1op nmfciat sDum( oou4oeeomieiysfa eau ont4aetrxociytla elneols trtrio3iy4lp  mnvtl(  2tax ont0optomfetytla2uaumsnu)aetoio3iodlpD  ivi;()srto(r3ou4ol e fctas sDuax  ;u4aeenifetlsfs2emu s u)tleniocoytlate n i () 2urxm nudomtnmfesat sDumurp;o4oex ioetys a rl(vs (0 rtnir3oytlm r i o;s0 eumiopiodlltnmfvt s  rta( pno4oet ifetyt s2em(vpnt0alxoxo oo1fpDeaiei;(0trumxr no4am nlfetas)s2ra(ro;o1tpe miciydlaDeln pn(4treoif tadlpt  i sl(0 2xr(m3oodamtn nctasf 2tr(r ;t1olx mi3iltlmDrau s (4aleoxrctodla  an i (  2ur(mpiy1alen fesat)s2tru ono0aeeoif3iadlm2ranms t)alxoxr3totopD lieils s2xoxrpiy4om elfetlsfsrta( ono0oltniictlslm2ul(vs (0aeeoircoa1oaD ai sl()sexm(o nu4ole livsls s2um(m ;t0tlxnmi3ilsfs raumo;t) rxrxf oatlmt ai ils0texoio3iy4am elfeta(fsrtau  ;t0tlt  feiydfsDrm( snu4tlerircoydfmDr ueo;s sexmxr3iudap e ncs () rrrxm oo0tltoioetyt aDumnmpnu4aetrxr ty1la elnvils0 2xr(opiydole  ncia( a2uaur nt4ole moeiasfmDuln p t)alxnxr ootlm  ln sl()seuoxo nu1llt lfvs s s2umxr nu0aexomiciyd a2uau pn(4tlxrmr todomDe nvol( sexoxrpnodlmeemfetl() rtr(mpot0tlx  oeiydlaDumu on(0aetnmo ia1fp rlnvs s0sruoim3io1amt lfeiatf rta(m ou0aeeo oeiytfmDemu s t4trtrmf tatfmDelivils s2um(o io1apeemies sfsDtrumpnt0apxo fciat mDel(vo u0 leriociydlpDelivs (0 etmxm iy1lltelfeia( srrr(r ;u0tleomf3ilt s el(mo u4 eermf3tydlaDr iei;s  rtm(mpiu1lp nmnetlt)arrr(mpnu0aee  oetaslm rl(vo;(4 ltnir3tatlpDe i i;s  2xoxopno4lleemfvt (faDumumooo4alx  o3iyt s rl( o () rxrmo tadoaDranvo s0t2urxm oodlp   ieilt)srurxm no0oetnmfeild s2uauvsnt4treomrcoy1oat ln i;s0s2xm(o nudal  lnvi (fsDum(r nu1texoii3iydfsDrmuvs;u0tetrif oo1laDrai ils  2tmirpnodal  lnvsls aDuaxmpou1tpeomfetld aDuanvsn(4 ltrxf3oo1oateluvslt)srur(rpnudal nliesltfsDra(ronu4ale mo3iadfmDrmuvs u4 etrmrcio1oat  i o;t0teto(opio4lp  mictl( sDum( o;o1tlx  fctys m2emumon(4aexoio iytop rai s;t) 2xo(o ou1aleemnvsa(fartrxm ot4alen oeiysfmDemumsnu0 lxoxfcoytop  li o;t)teurxm oo4lm  livi s  rrm( pno0oee  i3ias mDum(ms;t4arenmo3iydfmt lnes t)setoio ou4omt mictasfsrtmxrooo0tlt ifciatfm2ul(mo;u4 reoxf iydfpteln ol()srum(o3iy1olt  ivil(  Drmx onu1oexnmo3tydlm2rmumo;u0 rermf3ty1opDr n s (0trumxm3iodoptelfei s)srtru  nu4opx ifeias aDuau s;()texnxociytoaD lneols0 rxo(m nu1llee fvsls)aDuax ono0altoiocils a eanmsnu0altnxf tadfpDeln ols) 2xrxmpio1oleemnvsl()artmxmoot1aex mociys s rlnmo t0tlxrmrctadlmDrlu s;()t2uoxo oudlleelictatfs2rm( pou1aetoiieiys a eauvo (4 eenxo3iodfmte uvols0 rtmxr3nu1lmtnmnetls s2rm(r ;u4tee mociydls elu o;t)texnio todlm   u o;t0setoxm nudaltnmiesat)aDtau  nt1tlenifctaslmDrm(vs u) etomf3tadlpt au o;t)t2tmxo oudal emnctatfs2ta( pnu0tltoifeias aDraums;t4 rtoxf3iotfmDr uvilt)srtoxm3nydop  mnciat sDraum nt1opeomieilsla um( o;u0 reoiocootopD  uvi;s0 rxmxm3iydalt  ies s  rtm(m ;t1tptoiieiydla2emnmp;u4trxrxfcty1lmDraueils  2xoir3oo4omeelnetl(f Dtrxmpoo1apx mietas m el(mo;u)trtoir3iadfpteaies s) euoio3oo1ome lfetlt srururp;t0olt  ieiyslm2eln s;u) ltrxrcoodfpDrlieils  etoxo iudal  micilt aDrrumonu0tle ioeilslm2uau o;(4 renxrctytoaD  u s s0 2tmxo3oy4olt  ivsl( a2rr(m oo0teenifctldla2ua(mpnu0tlxnxr io1la   i ils0srto(o3oy4lme lfvsas s2uaxrp;o4oee ifetltlsDrlnvo t0tltrmf todfp eauvo;t trxmxopoo4om e nvi ( a2uax pno0tptomo3tas m2eanvp;(4texrmf tatoaDraneolt trxr(r3iudoptelfvtl() Dra(rpou0oee  oeilsfaDrluvo t) reomfciodlpDr uvs;s) eumxopnu4apen nvtas)a2uru onu0tetoii3tldlm2uauvpn(0 exoif3todlm raueo t sexmio3iodapenmfcsl(f rumu o;o1tpxomi3iat a2emu pn(4alerxociytoa  livs t0 etrxr3oy1lp emfvsa() rtrx  ou0alen i3iadfm2el(vo u0tltrxr totlpte u slt)trxrxo3nodopenmnei tf 2rrxmp;t4aet iociyt sDua(vpnu)tetrmr3ia1opD  ueo t0sexo(m3no4am nlfvia(f Dtmx pnu4oex  fciydlmDemnvs t4 etrircoydfm eanvilt0s2urxr3no1ll   icsat)sDrmumo;u4texoifciatlaDeanmo;t4texrmr3tytlaD li olt0t2tmxo oo1lle  ivt t)arrm(r no0tlen ietysfsDumnvp (0 ltoxrcoodlp  au o s)srurxr io1lmte nvi sf rum(mo;t4oeeo ieiadfmDrmums;()aetomf3ia1la   n s;t)sruoimpiydlltnmnvi sfsDrr( p;o0tet io3iltlsDelnvo;(4 reoxo3iytlat lueo s0trxoirpnodapen fvs s) 2taumpno0oltomoeiadla2umnvo;t4artoxf tadom rai ils)trxoirpou1lme  fcs sfs2rr(mo;o0tet  oeiydfaDuan on(0 exoxf3oo1fpDraieo () rxoio3oo4aptnmnvt t aDraxr nt0oexo iciys a eauvp;() eeomf3ty1fm eli i s  2umxmpno1ame  fvt t)a2rmx pno1oee mf3tyd m2ulnms;u0tlenio tydla elueols)sruoio3nudlmtemnvt tf ruaurp;o1tetn oeild m emnvsnu)aeeoxrcoy1lmDeanvslt) rxo(mpiodameelnetl()srtaum ;o0aetnif3iadfm ranvo u)treoifcia1la r ieil(0s2xoxo3oy4om elncias)aDta(mo;u0tptomfcilt sDumn o u4 eerxf ty1fp  lueo;t0 exoxo iy1ope  icil() Dtaurp;u4tltomiciydfaDrmn snt0 rtomf3iatop eauvol()s2toir iu1am nlfeias sDtru  ;t4tpeoii3ildfa2rln ont0aetnir oytlmDe ivs;( t2xoxm3ou1omte nvias  Dtmum ou0aexn i3iydls ulnmp t)tlxnxf3iytfmDrlivi;( setoimpnodaltn nei t)srurxroou0tpxomiciydfm2uaumsnu0teerir tatfaDean i;( t2xoxmpiy4am n nvi sfsrtm(r ou4aet  i3iad aDulu p (4 rtnio iatfmtraieo s0 eurimpoodopee ict ()arraurpno4oeto octas s2rmnvs;u0arxnxr oy1fmD lneo;t srtmir ou1olt mfet s a2ta(  ;t1olxomfeildls emn sn(0aleoxo ta1fmD li il()trtrxr ou1lp nmieta(fs2trxmp;u4aptn fctat m eln o;(0teerxrciydlmtrai sls0trur(m3iy4lmtelnci (farrm( p;t4aexoiociadfs el(ms;u4tlxrmr oo1fpD ln o;()tetm(m oy1lmtnmies s)aDua(rpoo1oee  o3tltls uauvo u4 eerircoytfa  aivs;t0 exmxrpou4lptemfesl(f 2urxroou0tee ioetadfa eluvonu)arxoxoctotfmDrluei s) exmxo3iodomt lfvtlt)aDum(m ;t1aexomieilslm2rmu s t0 etoxf3oy1fptr n il( s2xr(opiy4lme miesat)aDumxmpnu0tlxo i3tadlmDelnmp (0 eeoxr iy1laDrai i t0teuo(m nu4ol emfetls)sDrmx ooo0tlxnif3tad a2emumpnu0 etrxf iodoaD lnvo ()seuo(o3iu1amen fvtltfs2ra(rpnu0aptniieiasls emn p;t0 etnxfcio1lpDr uvi;s) 2xoxr iu1lp n ieiasfaDrr(rooo0aetoifctad s2eluvp t) eeoio tatoa rlueo t)seum(rpiu4lp n iciatfaDrr(mooo1tpto octyt m2ra(vs u0 leoxo io1lp   n s;t)t2urio iy4ap e ivt s)aDraumpnt4tpxnmf3ilsla2eluvo t)trtrxrcia1lpDeaiei s srxrir3iu4olen ictl( s2umur ;o0teeomfeiatfm umuvo t4 rtrmf iatlaDraiei s)teto(rpoudlm nlfct t)srtaurpoo0oleomf3tlt s ulump (4tleoir3oy1fpD  neils0 etmio3ny1omenlnet s) rtrxrp;u0oetomiciatls umu on(4 rtrirciadlpD  ueo;s trumxo3oy1apt  feslt)s2rrx  ;o4aetoiiciyslmDrm(vp;u)trtrirctatfpte uvil( srumxr3ou1ameemiet tf Dra(  ;u4teeniieias mDem(ms t4alermf oa1lm  au olt  eumirpiudaltnmivt ( srumumo;u0aetn feiytfa2umu s u0aexomf oadfat ai il(0srto(rpnodapt mivs sf rtmxr nu4ale ifcilsls uanvs t4 lxrmo io1op  aues t  euo(r3nodap nmiciat) 2um(mpnt0alxoifeiat a2emn p;t4 renxf oy1lptraneols) 2tmxr no1lpenlietls)sDtaur ;t4tlx  oetatfs2ulnms;t)texoxf3oa1fpDrlnei;t0setrxrpiy4lmte ivslsfs2tau pno0ope  i3tldfs emump;u0 rxrif3to1oa eaneo;t truoxr3ny1alt lncta(  ruau p;u1oee ii3ild m2elums;u4 rtnio ootlptr uvslt0 exrio io4oltnlnct s)artm(rp;u1texn octldfaDeanvpnt0alerxrcoy1lmt  u o t teuo(r ny1ll e fetls artmxr no4tltn fcild a uanvp () exomrcoa1omDeauvo t  rxrxm3oodlp nliciatfa2ra( oou1apeo fciasla2rl(ms;u4artrif totlpt aueo t) exoiopny4openmnvt t)s2rm(rpnt4aeeomi3iad mDem( o;t4trenmfcoa1lat aiesls0 2uo(rpiydalee neslsfsDua( p;u4tltoio3iad a uaums u)trerxo3oodfp r ues;()trxrio3io1llte feias  rum(mpot0opeoiictyd sDul(mp;u) rerxociadomDeai o;t) rur(r ny1lmtn nesl( srrr(m ou4aetnmietld a rauvp;()artoxo3oadlpteau s s  rumimpio4alt liei t aDtr(mono1aexnmfeildla ranms;u0tlerif oytfmte i i t s2tmxr ny4ll  lfeiasf Duaxmp;o0aetoio3iad a ra(mpnu0 rermfciy1fpte ieilt) rtoim oodamtelnetl( a2ra(  ;u0tptoioeiasfm rmump t4tlerio oytfmDe nvols trtmim iudopenmfet tf rurxr ;t4apt  ietyslmDran s;u)alxnmfctodlmtelivo;s0s2to(o3oo1apen neil(  Dumump;t0tex ioeiytls2ranvs (4trermocoodlmDe nei t)teurxopoo4ap  mnctl()a2umxronu4tpxomi3tytfaDrmu p;t4tetoxf iatoat auvol(  eumxmpny1apeelieslsfarraxmo;t0oeto ictysls ea( p;t) lxoxociodopte i o t) 2umimpnydllen fvtas)s2urx pnu4aeenif3iatfmDul(vp;() ltrir oo1opte n o;(0 etoxr iydomtemfvtas  Drmx  ;o4apt  f3iat a rm(vo;t)arxomr oy1oate uvs;( srtrxr3nydllt mneilt)artau  ;o4aleoii3tysla2el( snt)trxoxo iatomDr n s;s0s2toio oydop n neilt a2tmx onu0aet  fctls mDrl(mpnu4texnmociadoatrai s;()t2urxrpiydopt mnei t srtmx pnu0oleo o3iatfs rm( o;t4teeoxo oydlpD li i s0 2umxopoydaptelfesat)artmu  no0apenmo3iyd a2rl( s t)tlenif oytfptr u sls)trurim iu1amtelnvsat  2ur(rpnu4tpt  fctls aDeln pn(0arxoxf3oodopDr i i;( truo(o3io1ll n nvil() Dra(m no4oetnmf3iysfmDelnmo;() rtoif3iytopD luvi ( s2urxrpnu1ll nlfeta(fs2umxroou1texnifctls s2rauvp t4 rxoif oatfpDeaueo;(0 rxrxopou1omeemfcslsfa2raur no4aetomi3tatfs ran s;t0arenmr3iy1la  aivo s srxr(o iy1lmt lfvsa() Dta(rpno4oet  o3iysls uluvs u0tlxnif3ty1omDe nvsl() rtrim iy4omenmnes () ruru  ;u4tpeo oeiytfaDean s t) lxrmf ta1fm r ueol(0setmxo iu1lp  mieta( a2taxrpnu1alx  oeiltlsDemums;u) reoxo to1fate uei t0t2tmim3oy4ap nmieta()sDrmu  ;t4oltnifeiysfa2ra(vp;(4 rtomrcoadfatr ieol( t2tr(m3oo1optelivi ( arua( pot0alx mo3ildfa umuvon()arxrmo ty1fat anes s0 ruo(r nydop nmfeta() 2tmxrpoo4tet  oeildls um(vpnu0 ltrmf oo1lm rauvsl(0sexrxr3ny4ap e iesasf rur( oou4tlxnii3iytfm ea(mp (4altrifciytop rai s;t  rxrirpiy4lptn nesltfaDra(m oo4alt mo3iasfa2emuvpnt)altrmr iatfaDran sl( tetrio3nydope  fct () rtm(rp;o4alx  o3tadfsDul( o (0tltoifcoydfat an i;()s2xrxr3nudlpt  fcsat)sDur(mp;o1oee mieilt s rluvpnu0 lxnio3oa1opt  u ils  2ur(r iodlme lici tf Drr( ont0apt mfeilsfa2rlnvo u) ltnio iadop  aivilt)sruoxr3iodameelnvia(  rurx  nu1aexo ietatla eln s;(4aleomf totlmD lnvs s)t2xmio io4lpe lics () Drm(mpot1altomieiyd m2rm(mpnt4tltomfctatfp raieilt  2umxmpnu1lm e ictas)srtru oot4oeeomfeiadlaDran snt)tlxrif3oatoa eaueo;(0trxo(r iu1lmtn fcia(fsDrmxmpou4aetnio3ilt a rmnvs (0areoxr3oy1latrlues;() ruoxr nodaptn nctlsfartr(r ou1ole mociatfm uanmp;(0aetrxr3iydfateaivs t seuoxr3no1opt mncslsfsrtru p;o0tltnmo3ilslsDulumont)teeomf3iytlaD  ues;t trxoxmpny4alenlnvtasfa2rr(ro;u4opx ioetatfm eau p t)aetomoctodfm rlneol(0s2toimpnu1lltn ivtatfa2uru o;t1opx ifciyd sDuauvs;u)trxrxf oatopt anvi (0trur(m iodlmenmfcias  2rm( p;o0aex  i3ils s2uauvs;t4aeenmoctotoaDelivo s0 2ur(m oo1am elicsl(fa2tmu o;t1tpe ioeiasfsDra( p () rxnio oodoaDr ivilt) rtmxrpiy4llte fes sfaDuaxrono1opxomo3iydfsDelu o;t4 etoirciadlp  aues t)texmxo no4ape mncslt sDraxmpno1apxoioctlt aDemnvpnt0trtoxf ta1faD lnvolt setmim iy1lpenmnetls s2rrxm no1opeo fctytlm2emu pnt) exrxf ty1omt aneils0srur(mpoydolt  fvia()artm(  ;o0teen iciys m uau o (4 rermo oydlmDrauvi;s0 exmxo io1alen nvs s)aDrrx  ;u0oltomf3ildfaDrmnvs ()altoifcoodfateaueslt srxrim oudomeemietl()s2tr( oot0aet  f3iadlmDuanms u4tltnxo3iytom elivi;t sexmxm iudamenlfvia(f 2rau o;t4tlxn f3iytfs2ean o t0 ltrio3oatoptrlues;s  2uoxrpoudam   ivi t)arur(rooo0teeoifeiyd m rmn snu)alenxr3iatfaD anvo;t)srumir nydamt mfeilsfa2rm(rono1tlen ieilslaDrmnms;u4altrmf3io1fpt  u slt)trtm(m io4alen ncsl(f 2tr(  ou0tle ii3tadla2ul( snu0 lenmf3oo1fpD aneol()s2umxr io4apte icta(fa2uau pou4tlxo ieiltlm2uauvo;()aeerxrciodopt anvi;( trxoxr3ou1ap elfvt ( aDtaumonu1tpx mociyd aDrmu p;()aetnxrcoa1op r nes (0s2trio ny4oltelfciat srraur nt1olen iciad a2emnvs;t0aetrmrciytoatranesls trtm(o3iy4am   fei sfarrrxrp;u1oleomoeiltls2eauvsnu0 rtomr iodfp r i slt s2trxopno1lle livtlsfsrurx  no0alxnmfetltfm2uau o ()trenmo iy1faDeln o ()s2tm(rpou4alenlfei (  Drrurpno1texnioetyt a2eau o;t0aleoxocia1lpDrlivi;(  rtrxo3io1om emfetas)aDtm(moou1ale if3iadfm2rmn s;t)teenifciydopDr i o ( sexmimpou4ameelnvs ()s2trx o;u4apeo oetysls2uanvonu)arxnxocoatlmDelies;t seurxo3iydopt  ieiat sDuaumoou0oexn f3tasfa2eauvont)texnmrcoodfatrlieolt texoir3oo1amtnlnvilt) Drrx  ;t0opxoiociatfa2ea(vp;t0texomo3to1oa  livols trtmim3iudlpt lncs sf rrau p;u1alenmoctatlaDumuvp;u4teeoxr3iy1oatrlu o ( t2ur(opiydol nlfvtasf rtaxm ou0aexoioetad m umnmp;u)teenxocoydlm rlueo t  ruo(opno4altelieil(f Dtau pno0tpxomf3iad m eau on(0tleoir ta1late ivo;s)teuoxm3oo1alt lieiat)s2tmum ot0aex iicilslm ranmsnu0aexnmo3iydlptranei t t2xrxm ny1opt lictasf 2trumo;u0oee iocils aDrmumon(0aetomo3oy1faDeauei;( trxrxopoy4am  mfcil(f 2rm( o;o0optn fciasla emuvp;(0tlxnxf ty1fp rlneil(  rtr(o ou4lme mfei (farrm(m ;u0ope if3iydfa raump t) eenmr3todlp   uvol(0 eur(mpoydlpen fctl(farrmumpot0altniiciadlm ulu sn() reoiocoytfa rlnes (0 rur(m3oudol elnvsa() rra( oou0aeen oeild m rl(vs;t4aexomrctatlmtr n olt0 etoim3nudom elicsl(  Dtaump;t4tlx  ociyd s rm( s t4 exnio iadfa e uei s) rxrir3oodaptemietl( s2uaxm ;o1tpt io3ilsfs eau pnt0 rtoxrcootom   ivs t)trxm(o oy1lm   ncsls)sDraxm nu1olt  ieiadls ulums;t)altnmf iy1omDrlivs;s0s2toir3iodape lfvsa(fsrumumont1ape  octyslaDuauvp;t0trtrmo3oytfptelieo t)t2xoxmpio1omtnlfesat  Drmxm no4aexomfeiasfs2ulnvpnt0aexnxf tatfaDrlueilt) rurimpiy1llte fcilt  2ua(mpnu4oexoiietyt s umuvo (0tlerxf oo1op  ln il( s2tm(opiu1lpt lnct sfarraurpoo0tlxnifetasls2ra( pn(4arenxrcoytomteluesl( t2xrio3io4olt mfcta( arurum no4oetnifeild aDuln s u0tetrir3iatopDraivs t  2xrxm io1lp  mfvi t arur(mpnu4tex moctadfa eln p t)aleomfctodfmt aivo;s)seto(r3iudop   nesa(  Dur(mpou0tleomfeils aDraumsn(4trtnxo3ta1oaD lueo t trtmirpoy4lle  ivsat)srrmxmo;o1apxoiieias m2rln s t)teeoxr io1lmDrlu s s0teur(rpiudlpt lnctltfaDururo;t4alenmf3iydlsDean onu) ltoxr3iodlm  auesls)srtoiopou1ope  iei t arta(r nt1ope  feiadla2umn s;(4altnio ty1fm rlnvslt)s2to(opoudameemivsatf Drm(rpnt0oltoiieiyd a2elu ont4teerxo3iatlmtelues;s) eumim no4lptn iei t)s2um(root1tpt mfeildlaDum(vo (4treoio oatoatelueol(0 etmxr iu4aptemneiat) 2ra( pot4oleo i3iasfs2rl(vo;u0 rxoxrctytlpD  nes t0 2xo(o io1lpte fct sfa2tm( oot1altnif3iadfsDrlums;u)artrxocty1omDraneslt seumxmpoy4olenmietas  2urxmonu1oetn o3tyt m2rluvp;u)teerioctotfmt anes s)s2xmir nydlpen fvia()artm(m no4apto feild mDrl( p (0 renxfctodlmD  nvs t)teumxopno1altnlnvi ( aDtrurp;o4ole mi3ils m rl(ms t0tleomocoytfat  ivsls srtrxo3iudam emicta( sDumx p;t0tptnmfciadlaDel( p;u)arenxo iodoa   n slt) rurim3iu4al emiesas)a2tmxm no1tlenmfeiasls2ulumpn(0arxoxf iotlptrln slt) rto(r3iudoptnlieia(fs2rrx poo1altomi3ils sDel(ms t0 lxoxr3iytlaDr nvil(0teur(rpoo4lp  lfctlt)a2raurono1ape mociad mDeau snt4aeermo3io1laDeaueo;s0teuo(opou1lmtn nct () 2rm(r nu4opxo o3tyd m rau o u4 lxnxrctadfpt luvsl(0s2uo(r iodal  mfviat srrm(mp;t4apt  o3ias s2umnvsnt) lxrmociy1lpDeau o;t)setmxr3io1lpt lnes s)sDtrxrpou1opto ociadfa el( o u
\ No newline at end of file
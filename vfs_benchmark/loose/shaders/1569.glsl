@@ -0,0 +1 @@
+ueo;t0trum(rpno1omen nvi s s2trxm ;o0teeomf3iytlaDuln p t)trtoio3iadfateaivs;s0t2xoiopoo4amt mnei ( sDuaxr ou4alxn ieiadfa ul(mpnu) etnmo3tytfat lies (0srxmirpnu4amte nciltfs2tmu p;o1tee miciaslaDrau s (4 lxnio3ta1omt  neilt)seuo(rpou1ape lfcs sf Dtau  nt4opxniieiad m ranmo ()alerir3iotlpD  ivi;t setrir iudolte fvtas a2taumpnu4aleoiietld m el(vpn()tlxoxoctatlmDeli ils) eurxm3no4lle lncias)sDrmx  oo4tle mfctydfm2rm(ms t4 lenmrctotomDrlnvo t0setoxr3no4lpt miesl(fsrrr(mont4aleoif3ilsfm emu snt4artomocoadlmteln s s0 rtr(m nydll  lnct s)s2ra(m no1olt io3iytlaDrl( snu) etoxr oo1omteaivsls)trxoxmpoy4ole mnct s)srtm( oou1apxomfeildfm2eaums u) eerifctotlmDrau s;t t2tmir oudale  fvsl(fsruaxroot1aeeoiicilt s elnmp;t4texniocia1fp rlnvi;t0trxo(m3ny4amtnlfetlt)s2umurp;o0oeen oeilsfs rauvonu4altnxr iydfaDe uvo;t s2uoxr3oy1om e feslsfarrru ont4tlx mieiatfa2ua( ont4texrxfciydfmteanesl()teuoimpoy1lmeelfci tfsDrrx  no4tlx ifeiyd a2emnvs u) leoxo3to1fmt  u i;t  exm(m ny4al e iciasf Duru oou0tlx mociad a um(ms t0 rtomocio1lm rlieo s) eumxo3oydapenlfeia( s2umum nt0texo oeiadls2emu p t0 rxnmr oatom rli i ( s2umxopou1am emnct s  rta(mo;u4olen fcilsfmDumn o;u4 rtrifctodfmtrlues (0t2xrir3oy1alt lfvi () 2ta(  ;u0oeenmietasfaDuln sn(0trxrxrciy1lptr i i;t0 2ur(m io1omenmncsatf 2ur(r no4teen o3ias m2ul(vpnu)tlxnirctotop  anesl() 2trio3nodal   nvta()aDrm( pot0tpx mi3iysfsDranvo ()tlenir3iytlmDrli s;s0 rtm(rpoodlp e ictl(fs2umxmoot4tpenioctlsla2el(vsnt4trxnmf3ty1lat  ivol(  exoxm3iudlp  mnetatfarrm(r nu1oexnmiciaslm2ranmsnt)tetrxo ia1oaDelnei;t srtrxo3oo1lleelnvt (  Duaur ou0openiieilslmDulnvp t0texnxo iatopDraneo;t setmir3ny4lpenmfetl(  rta(moou4altomf3tydfm emumsn()texnmfcoadfaDr u olt0srum(rpoudal  lfvs () rurx ono4aeenifetydlsDraumo;t0arxoxr3iodopt ln s;s0srxrxo3iodlp emivt sfa2ta(rpou1tetoiociyd a uanvo;t0 leoxf iytlmteaivi s)t2xrirpnodopt  ncil()srtm(m ;o0tle iieiyt m2emn sn(4trxnir tydfmtrlu i s0 ruo(o3ou4ol  lnei t) rtrx p;u0tee mi3iyd s umums;(0tltoxrcoy1fpDe ies s)t2xo(o nu4aptnmfvtat  2ua(mp;t4oexoifcildfm2rmnvp ()trtnif to1lm  lieslt seumxr3no1lleelicilsfaDumur ;u1oexomoeiadfs elu on(0alerxf iodfat lu s;t srtrirpiy4am   ietas aDraur ot4oeeoiociydla uaump;()trxrmf3iadom r i i;s srxmiopoo1optn netat) rraurpno1olx  f3iatlm2uaump;(0 exrmrciy1fpDean sl( s2urxr iu4oltnmnvs s) 2tmu p;o0alen fciytlsDrl(ms;u0 lxoircoo1oatrlnes;()texm(o3nu1om   fet ( aDra(r ot1tleomfcildfsDemnms;u) lxrxrciytomte uvi;s t2toxr oodlm nmnvs s  2tax  ;o4tpt  feiys s uluvs u) rtrir3iatla   ueo;s)trtmirpnu4aptnlnet ()arumxmpnu4olx iictadfaDul(vs t4alxnxfcoatlpDe ieo (0trumxm3ny4olt  fctlt arra(ro;t4tpxnii3tatlsDrau p;u)altrmrctadlp rln sl(0texo(o3iy1lpen ncia(f Dtmu pou0oetn oeiatfs2rau o;t0artomf3io1fpDrliei;s0 2uoimpoy4ol emieia( aDtr( p;u1opt ifeiadlmDranvpnt4alenifctatfa rlieols0t2xm(opoudapeemfcia() 2trum ;t0opxo i3tyd s2ranms;u4teerxoctotom   ieol()t2to(o3nudol e fvt (fa2um(rpou4olt iietltla ulnms u)trxrifciotfptr nes t0t2urir iy1ll n nvilt sDuau  nu0tet mo3tat aDean s (4teerxo3iatfaDe u sl(0 exmir3iodol nmfcias sDtauroot4aet mieildfa2ulums t)treoif tydfatelu i t0t2to(o3iodopen nvtasfartmur ;t4oetomocildls raums (4 etnxf iotlaD livils0s2to(m io4llt lnvt sfaDrm(r nu1tet ioetadfs2rauvpn(0 rtnxo oytoa eli i t0 exmxo3oudop e nvsas a2tm( pou0oeto o3iys m rmnmpnu4teenmrcoydla  aieo (  rtrxopiu1ope liviat  2rr(r oo0tetniietatfa2eluvp;u0aetnir3ty1oat anvi s0 euoxm3iydaltnmfcia(faDrru pnu0oltn i3iyd s ulnvo;t0arxnmo tytfmD aiesl( trum(o iudlpenlfvia(fsDrm(  no1aee mfciysfmDranvp t) lerxo3totfpt an s;t0t2xm(mpiu4omeelnvias)srrm(rpno1tex ifcias a rlu p;u)teeoiocia1la r ivilt sexoxmpoy4apenmncsatfartaxr ;u4opxnif3iatfm eanmsnu)trtnmr tadop rlu o;()seur(opou4lp   fet t  Drmx oot4tlxomfetltlaDrau o;(4 etoif ta1omtranvs t)t2xmim nydlp  mneiat)srra(rp;u4optn fetydlaDrmnvo;u)arxrmo3oatfptrau olt0 2tmxrpno4aptnmicsl( aDtrxmpnt0apeoiicilt s ranmonu) rtnirciodlat  ivo;t0tetmio3ou4lpe mictlt  rrmxmo;t0teen ictys mDel(vo t0trtoio tatoate uei s0 2xo(o nydamt  fcias sDrmur ot1apxoif3tyslsDemnvo ()tltoir3oatlp raneils0trtoxmpiu1ol nlivia(  rtm(mpou1opto oetys m rluvp;u4aleomoctadlptran slt trumxo3iu1amee ivilt) 2uaxmont4texoifciytfaDul(msnt)treoir3oytfa  luvilt seumxr iy4apeelfcs t) 2tr( p;t4apx mi3iys a eanms;t0tetnifciodfpDr ueols0trxoxo ou1am nlivsas  rrr(m nu1aptomoctadla2ranmo u4tlxomr io1lmD luei ()t2umio iodalteliei ()sDua(rp;o0aleoioeildls2um( p (4arermr3ta1oa  lu s s) rtr(o nu4lp elnvsasfa2umu pnu1aee ioeiadlm eau o;t)tetrxf3oatopt lnvs () rxoir oodalte nesls) Draurp;o0alx moeiatla ea(vo u0 exoxr iytoaDeli o;t  2uoxmpno4omenmiviasfs2ra(r nu0olenmfeiasla emumpnt4alxomr3tydfptraivo;s)s2urxr3iy4am  lnvsat arra(rpot4tpeomfciys s ea( p;t0texnxf oatfpt luei s) rxrxopiu1ap emnct s a2urx onu1tpxn ieiysla2rln p ()teenio oytfaD  ueo t  exm(m ny1lltnlfvs t sruru  ;t1aetnioetytlm2el(vont0teerxf iotom r ivi ()sruo(m ny1ap  lnctas)srta(  ;t4teeo ieiysfm2ulnmpnu4aleoio3iytfpt  nvil( trtriopnu4lptnlnvs tfsrra(rpnt4tpxoiiciltfmDra(mp;u) ltrxfcoytoa rlnvo s) 2urir3iodllt livias  2ra(rpnu0olt iiciyd s2umnvs u) exnir3tadlmD luvs ()trumir3ou1al n nct s)s2raum nu0tptnifeiatfaDrmnvs t)altnmf3todfa eli s s0srxm(o3oy4lle lietltfsrrm(mpnu4tlxn i3iydfs2rl(mp;u0 etrif iadlmtranvols0 rxo(m3ny1am emneslsfsrrmumonu4tet mfeiat sDum( o u0 lxnxoctadfpDe uvsl()srurxrpiodll emfcsls  Duaurono0aet ioetytfm rmnms (4 lxnmf3ta1latr u ilt0t2urio3no4llee ictas)arta(m ot4aeeo ocildfm umuvp;u0 lxomfcootoptraneolt0 exoxrpnu1lmtemnes t s2urx o;o4oee  icias mDrlump u0 etnif iydfpt lieo ()t2umxm3no1lle mfesl( aDraurono4tleomfciyslmDrau o;t)alerxr3iatoaDeaiei;( setr(mpnudaltnmnei t)aruaum ou0oetniocildla rmu o (0 etrxo ootlaDraues (  2umio3ou4optn fvt (fs2raump;t0aetnmfctlsla2umu pn(4 ltnxf3iatfatr ieols  eurxm nu4lp n ict tf 2taurp;u0tpe moctat a2el(vpnu0arxrmo oa1lptr i s (0s2um(mpnu1ame  nvt ( artm(  ot0openiictlslm uluvon(0tetrif ty1lp rauei;t0trurxr3ou4omt mnet () Dtmxr ;t0tpenii3tas s2el(vo u) reomo todla r n s;t texrxo3ou1am e ivtat)srumuro;u1tpxnmiciyslsDelnmp u4 rtrmf3todfa rai s s  2xrim iodamtnliesl() 2tmu ont4optn ieiadfsDuan s () lerir3iytlaD aivo s t2xmxo3ou1lp n neta()aDuru  nu1aexnmf3tat mDuan p;u) rxrxrcoatfm  li s;s trxrxopny1lleemiet ( a2raumpot1openmfeiad s2rm(mo;(0aexniocoodlmDeli s t0t2uo(o nu4lmen fcs s  Drauro;o0opx  iciydfsDel(vs;t0trxrif3oodfmDran i;t0srtm(m3nodop  mnvia()a2rmxmo;t4olxomoeias a2eanms;u4teerirciytfm  ln s s  rtrxrpiydopte fvtlsfa2ta(  nu4opx mo3ildls2elu p;t4aeeoxfctydlptr uvo;s) eumxm no1lptnmncsl()srtmxm nt1oet mo3iltfa elnmont4areoif tatla rln i;s) 2urir3no4ll nlfvs tf Draumo;u4tex ioctasfs2rlumo t) etnir iy1omteanes () euo(o ou1lmee neslt  2tmxmpnt1tpxoifciasls2umu p;() leoxr ia1fpt aneslt) etrxm3nodapte ictasfaDraum nt4tltoioctat s2elnmp;t0trermo oydopt aies;s)t2umim3ny4lm  lncilsf rrm( o;t0apen ieiatfm umnmo;(4tlxnir3tydfmD au ilt) 2urxopio4lp   fetatfaDta(mont4tle ii3iydls ranmo;t4aeeoir ootomtrlu olt) euo(m3oy4omtnlnesa(  2ur(root4alxomfetatlaDrauvs;t0alxrxf ta1laD  ies ()srtmir nu4oltn fctat)srrm( p;u0aetnio3iasls2emums;u)tlxomr3tytop rluei;t  2toxm nudlmtemivi t aDrrxrpnt0tltomfcildfsDul(ms;t0 exnxf todopD luvi s0s2urim3oudomenmfvtas sDtru pnu0oexoiocilslm2ranvs () exomr iatlm rlivsls s2uo(opio1amen icta() 2ua(rpnt4opxoiieildla umn s;u0teermrcoadfaDe ivs s) etmio3ny1oltnmnvs (fs2ururpnt1opeomi3iasla rlnmo ()texnxr tatfpD  nvs (0 rumxm3nudam   icils  rtau p;t1tlx iociyslaDuln o;u0 lermo3iotlatrluvsl(0s2xmir nodalt mivia()a2umx  oo4tlxo ieiydlsDea(vp t) lxrirciydoaD lnvol(0teumxm ou1apee ivi t artmxm ;t0opt moetytfsDrlnmp;t)alermr3tydlaDeai o ( trto(o3io4aptemivsl( a2ta( o;o1tleoifeild a um(vo (0arenmociodfpteli ol(0srxmxm3iodomeemict tfsruaxront0tpxomo3ilslsDelump;u0 lxoxo tytomDeanvs s) rxo(r3oudaltnmiesatfa2ta(r nu1ape mfciydlmDel(mon(4 eeomr3totlpt  u sl()trtrio ny4lp  mivtls srra(m ;u4tet mf3iyslmDemn p;t4 rxnmrcoa1lp   u sl(0 2toio iodam   fes sfsDrru poo1tpxnio3iadlaDeanvs t)alxoiocoodfatelu s ()s2xoio3ou1ol  mfct t  Dtaxroot4tpeomfciatfa rlu p;() ltrxf3iadoaD  nvs s setoxm ou4lle mnvta( s2tr(r ;u0alto f3tas aDeaums ()aetrxr oy1om  aueilt0trtr(m3oudll n nctl( srum(mont0tlxo octlsfmDranmpnt4 eerxr ootlp e u o s  rtmio iy1lmenmicsa( sruax o;u0oetnifcils s uluvpn(0 exoiocoydomt lieolt0 etmxrpiy4lmtn neilsfs2umxmp;u1tle if3tatlsDrm( s;u)trxoxociadfp r i s;s srumxmpio4om e fvt sfsrrmumpnt4olxnifeiadlm umuvon(4 renircoa1lp eaivils0 exmxr iu4ol   fvtat)sDuauronu1apxo fciadfs2ua( p;u)artrxf3oytfp rli o;(0trxoio no1ole  iet t)a2tmurpou1aex ii3tltfm2elums ()alxrxo tatfmtrlieo;s  2umio3iudomee ncsat)a2rru ooo0oetnmo3iad m rm( sn()tltoxocoydfat  nvs;t)s2xrxr nydlp nlncia( srurur ;o0olenmoetyd s emu o;t0tetnio3tytomtrai s;t  2xoxr3iy4lpeelictas) Dtru pot4tlt mf3iad m2ulu s u4 exnio tadfa eluei;(0s2xo(r nu1ll e ivtatfsDumxrooo0oetnif3iat a ea(vo t0texrmo3ta1la rlivs;( teurir iudlpee fcia(f Dua(m nu0openifeildfaDrluvon(0 renxf3iotfat lnvil(0trumxopno4lmt  fesa()s2tauro;o1tlenif3iasla elumonu)trtnmf3todfpD anesl( srxoxm no4llt mncsa()s2ua(  nt0olt ioctyt s uanvp t)aexomo3tadoaDe i s;s  rtoio iu1al nmivi (f Dumxroot4ole mfciltfs umuvo (0 eeoirctytomte ies;t  2xm(o nu4ol elnei s aruauroou4tltn ieiydla2rmuvo;t4 eeoiocoy1opteaivi;s)trtrxmpiodlp  lnct ()a2urum nu0opeomocildfm2elu s (4alxrio3tatfaDraies s s2xoxr3iy1apee fetls arua(r ot1opxomf3tltlsDua( p;u4alxnxo ty1faDr ies s sruoim3iy4lp emfvs s aDururooo1texnio3iyt sDuln p ()arerio3tydoat auvo s)sexoxrpiodopeemfvia()s2ra(ro;o0apxn ieiasfm2umu pnu0 exrmr iodlat  i o;s)srtoimpny1amen nvt tfsrurx o;t1tpenii3ilt m umnmo;t4artnxocoodfm e nei;(0srtm(o3iodlmt lnvi t)arur( ono4aet mi3iadla2rauvs;(0arxrmr ia1omD lu o;t0srtrxm oudomee ivi ()arraxmono4alxomf3iysfs2ulnmo;(4areoxr3iydoa rlu o t  rtrio oudlp nlivi sfarraur no4tpxnioetyd s2rmu snt0trtrxr io1fatrlivo;s)t2xrim io1om emnvi sfsDumuront0oltoifciysfsDrmnvpnt0tlxrio to1fp e u o;( sruoim iudol e fetl() Drm(m oo4oex miciadlm2emu o;u) lxoif3oy1la elu s s0trurxr3nudlmtelfvi (fsDrrum ;o0tptnmfetytlm rluvpn(0arxnir3tatoa r n il()srxoirpoydlp n fcs (f rra(rp;t1tex miciydla rlnmo () ltnmr oy1lm rlnvslt0s2xoxm3ny1omenmicta(  rrm(mpoo0tpt mfctytlsDrlnvo;(0trenif3iy1oaDeln i t srxrxm3no1omt mict t srurxrpou1oexo f3ildls2el( s;t) eeomo iytlateluvs t truoimpio4ll   nvia( s2tmum ;u1tex iocias mDulnmont)artoio3to1lp eauei ( s2xmio no1optnlieil( a2taxmpoo0opxn i3ildfs2rlu o;t) rtoir iydlaDelivo;s)seuoxmpoy4alenlfeslt) 2taxm nu1aeeoioeiadfs2rluvs;()tlxrmf to1opDrln s;(0trtm(o no1amte nei ( aDra(rp;o4tpen i3iyd m eluvp u) lxrmr oy1om r ueo s) rtoim3iydap elncils)s2trx  ;u4texomo3iltfs2ua(mp;u0altrmo iy1op  lueo ( tetr(o nu4lm emieil(faDrr( o;t1tpt mieiasls um( snt0trtrmr3iy1oatraieo;s0srurxr3ny1olt lncs ()sDtaur ou4tpt mietld s2uluvs ()tlenircia1lptrlnes;s  exrio iudllen fvi ()arrm(r oo1optoiiciatfaDea(mp;(0areoir tytlmDr uvo;t)sexm(m3nu1op   ncs ()s2tmu  nu0tee mocias a ra(mpnu)aleomo ty1optr n s;s srum(mpnu4am   fes sf rtrx pno0tltomieiatfaDelnvpn(4tetnio oa1lmtrln slt  rtoxr3nydlp nliviatfsDrmxm ;t1tetnmicias m2ran p;()aexnmfcio1lmDelivil(0t2ur(o iy1ale  fcsas  rtaurpnt0olxnmiciytfa2ul(vo (4tetoxrcoytoate nvolt) 2toxr3ny1am  livil(  2rrxmo;t4teenii3iytfa uauvp;(4trxrxfcoytlp   uvi;s0 etr(opoo4aptemfcilt sDtmu onu1tee  f3iyslsDrlnms (4teeoio tadomD  u ilt) 2tm(m3no1lptnlfcsas a2rrxm ;t4oet  ociat a rm(vp;t) lenmf oy1faDe i ol(0trtoir3no1omtemncil()sDraxm ;u4tlxoiieiysfaDemnvsnt0trtomfcoydlptrliesls0trxm(opny4ale  net sfsrtrxm nt0alxomfctldfaDuau o (4 etnxf oo1opte neol( trtoxo ny1alen fviltfs2tr(m ;t1altoifetlsfs2eanmo u)aexoxfciadfateln i;t0t2uoio iudlpeelfetltfa2umxm no1teenioeias a emuvo;u)tleomr3todom e ieo;s0s2uoxmpoudlpe mnct (fs2raum ;o0tpeo oeiydlm2emuvonu4 etomo3todfm rlneslt)srtmxrpnudlp  mnetlt  rtm( ono4tee io3iydls rmums (0tlxnio iotlm r i s;t0texoirpiu1apeelietltf 2ra( p;o0opto oetatfm um( snu4texoxr3oadfate nvs (0 2xr(m3iodlle lics s)a2rr(mpnu0aexnmieiydfsDumn o t4 lenxf3iytfm ranvi s  eum(opiudlmt  fei ()aruau pnt1apxoioetadfm2rmn s (0 etnxrciadopDean s;(0trtrxo oudlptn ncsl( sDtrxmpnt1aeenifetytfsDua(ms ()alxrifciadom   ueolt0 2toirpiodllen ivil(fa2ta(rp;t0oeen i3tasls2rmn s (4aeeoircio1lm  li i t)srum(o3no4lm  mfvi () 2tm(m oo4apxo fetyt m2rl( o;u)tlxnmr oadop eli s ( trxo(m oy1lle mnvias  Dtax  ou4oleoiociydfmDel(vo;t0 rxoio3ootom e ieo;()teur(o3no4ll   fesa() Drru o;o1aet iiciyslsDulumsn()alenio iytlaD  ivs;t)trurim3iy4olt lfei t  Drau  ou1optoifeiyd sDumuvon()tlxnmo iadlatrlivo t) rtmirpny1op e iviatfs2uau ont1ope  fciat aDuau s u)arenif3tatomte n ol()t2urim3ou1ll emies (f rrmxmoot1tpt mociydfa em( s;u4aexoio3totoa   nvs;() 2ur(r iodom  liesltfs2urx oot1tetomi3ils sDuauvo;u)aexrxociotfm eai slt)sexoim iy1optn ivi ( sruaxmo;u1oltoifeild s uau snu)tltrmr3ootoptrau o;t0truo(o io1omtelfvt (f rum( pou1oex mfciadla2umump;u0 rtoxr3todfaDrluei s)seurir ou4aptnlnvt s srumuro;u4optnmfctad sDul(vo (0 lxrmo3ta1optran o;(0teuo(m3ny4op nlnvils a2ua(  ot1oexn fciltfa2eaump t) ltnmo tytlmDr uvslt) rtmir3iy4opeemfesa() 2ua(  ;o1aptn ietat a ra(vs t0 lenmf3ia1la raivols seuoio oy1om  mivsat  rraxrpnu0aptoii3iltls2emnvonu4aetomr oytfaDeaiei;s  rum(o3iy1al elfctl(fsrrrurpnu0apeoifciaslm2emnvo u0trtoif3tytfa eaneo;s  2xr(o3no1lp  mnetas aDuaxrpoo0tptniietas aDua(ms;()areomoctatfm eanvo;s0 2urxr3nydomen nci t)s2raxmpou1opt  oeiys aDuluvo;(0 rxnmfctatlp r ivo;t)srtrio oodop elivslsfsrrruro;t0oetomo3tatla ulnvsnu4artomr io1oatr u ol(0 rtr(rpnudoptn nvta( aDumu oot0apxniiciys m2emn o;t4 exnmocto1lptr i o;s0 rtoirpno4lmeemfetlt) rrmurpot0tpxniietydfs2rmnmont4 rtoxr tatomtrlu s t0s2xm(m oydamen ict tf 2rmxro;t4texoif3tatfsDeau on(4alerir3tadop eauei (  2xr(o3iy1om nlnvs t)a2ur( ont4tet mf3tydfs2ulnvp;t) eeoio3tydfmtelnei;() rxrio3oodam emfet (f rraxmoou1apeoifcilsls2elnmpn(0 lermo iatlmtrai i t t2toir3iodlp emneiat)sDtm(  nt4apxomfetls m ul(vpnt4aetnxf3ty1lmDe n ols0 2tr(m3no1ole lfctat) ruau pnu0tleomi3iaslm2ra( pnu)trxnifcootlp elnvi;( sexr(rpio1lmt livsls sDtmxmpnu1apx moeiytfs2ea(vo u4tetnmo3iydoatr i s;( s2uoio oudlm  miei t)a2tau ooo4ope  feiyslm2rluvs t)alxoio3oydopD  ieo;() rtrxrpio4omeemfvils  rtrxmo;t1aet  ictydls elnvsn(4 exrioctydfmDelivi;s)srtmimpiu1lle  ics (  rtmx oou1oexn fetasfm2rmn ont0aeeoxf3todfmDe nesl(  2umxopnudole livils) Duau oou4aleniictldfm el( o;(4 etoir3oo1opteai o;()texr(m3iu4op emieias) 2uaxmp;o4tpxnmfcias mDemumo ()aetrxo3iy1lmDe ueo s) rurxr3no4om  mfcia()sDtmum no1tltoiociydfs2umnms;u0 leomo3iodom   ues ()truoxo3io4llt lfcs s  2umx  ;t1tpt iocilsfaDra(vo;u4altoxo todlaDe i sls s2urimpoydam elfei t) rra(rpot1aee io3tadlaDra(ms;(4aetoifctytfmDe ivo;s0 rumxo oudll nmfcsl(  2tm( o;o0opeomieiys sDemu p;t)tlenir oodfpDeai o;s)setrxr3nudape livs t) rrr(mooo1opt  oetad s umums t4areoxo3todfmt  i ols)trtrio3ny4olte ivslt) rtmumpou1olx  fetldfm2ua(vonu4aleoxr3io1laDr ivsl(  rxo(rpiy1ole  ivslt sDrr(mp;u1tpxo ictatlm uaump;u0arxoxociytlat  ueolt) 2xo(r nu1openlicsl( aDrrxr ou4tleo oetasfa2uan o;u0tleomfcia1la  aiei s) 2xo(m ou4ope micta(  rurxm ou0oee  i3tytlsDelums u) lxrio3oatfp   neslt  rtrimpnu1al  lfeiltfarta( o;o0aex  oetytla umnvs (4trtomr totlmtean i s0t2xo(o3oydop   ivs t)a2trurooo0olx  ieiyslmDelumsnt4alxoxo tatfm  auesl(0srtrxmpio1om elici sfaDtax pno0oetoiieiadls2emuvsnu4trxomf iy1lmtrlnes t0trtrio3io4amt lnes s) 2um(m nu0aetoii3iltlaDulump u4tleoirciy1lm  anvo s texmxr oo1am n ivtas) Drrumo;o1optnifciad a rlu pnu0altrirctotfaD aivs;()srxo(rpnu4ome lfvi s  rurur no1oexomoctlt a2ranms;t)teermrciadopDeanvi;t) exmxm nodllenliei s a2rm(rono0tpxo fcild m2uau p;u)tlerxf3tatfa  lueo s trtrim3iodamee fvil(fs2tr(r ou1aexnioeiydfm2rl( o;(4tetoiocta1oaD anvol(0t2umxm nudamte fvs ()srumx pou0tltnmoeilslmDumums;t)tlenmo3tatomD aieo;t) rxrxo3nu1am nmivsat) 2umxmoot4oexoiiciatlm2rl(vp (4 eerxf oydfa r n o;t0 rxr(o3oydlm   fctat s2rmumpou0alen f3tlsfs rmuvp;u0aetnxf3oa1lpD  uvs;t)seumimpny1apeemfes s)s2rm( p;u1aet iocild a rln onu)arxomr tytlpt  n s s)srxrxrpiudopenmnvslsfs2um(  ou4aexo fcilt sDulu p;t4teenxo3io1faDrauvslt0 rur(m iodlmt mivils  2tm(  no1aexoifeildla uln pn() rtnif iadoa eau i;(  exm(m3ou4oleemici (f rurum nu1apenmo3ilsfs uau p;u4trenir3io1lp  lueo;t0 rtr(o3iudap nlnvs sfarrm(  nu4alx ifeiat a ua(mp;u0 eerifcoatfatr i s t0s2trir ou1lpee nvil( sruau ono1oleoioeiasfa2ulnmpnu4areomfctadlaD aneo;t)tetoir3iu1ape lieil(  Dtru  nt4aet if3tatfaDelu pnu)tltnmociydla  livols tetr(rpno4ll nliciltfa2rrxm nt4tpxn fciytfm uanvpnu4tlenmrcoydlpDrlivo;(  exm(rpnudapt mictlt) rurx ooo1opxnifeiat aDemu s;()aeerir totfm r ivs;()trtmxr io4lpe mnvtatf 2umur no1ape ifeiltfs2rln o u)texrif3todlmDrlivsl()trurxr iu1alen neiat)arraurpno0olto o3iatls ra(msn()arenir3oytfmD lnvil( s2xr(m iodomte fci s a2urxm no0aee mictys s2rm(mp;()trerio oytfatr uei t s2xrxopny1optemnvt ( aDtaxroou0alt ioetatlm ulu s;t)aleomo oodfm ran s;t  eumim3iydllenmneta( s2ur(  ;u0opto oetls a eauvsnt4teermr3iytoaD  i s s0s2tm(mpiydlltn ncsltfs2um(ro;t0aptn o3tat sDra(mp t0 lxnmr oytfmtelnvols) exoxrpoy1ll   ncsa() rtru ooo0ole micilsla umuvs t)texnxo tatlpt ai sls trur(r ny1ll e nci (fsrrrxmoot4tptnioeildlm ua( pnt) leoxf ootlpD aieolt0t2tr(o oo1lle  fesatfsDtm( oou0apeomo3ildfa2ea(ms;(4arerir to1opD anes;(  exriopny4altelict s)s2trxrpnu4tlxn o3tat mDuau s;u4 rtoio iytfmtr ieo t t2tm(opoodllt mieta()srtmuro;o1alxoiieiys m2um(vo;u)alxoxfcoydlatran s;s srxoxr no1ll   fesa()aDumxr ;o4tlx  i3tadlsDrm(vs t0 rxnmr3oo1la rli sls s2xrirpnu1ap  mnci t)a2uru  oo4tex iociaslm eanmpnt0texnmf ia1fp  anvslt s2toxm iydamte icsatfsDur(m no4tlxoioeias aDran snu0artomr tytfmtr neolt  etoim3oy1am   ictasfarumu o;o1alxo iciydla rm( pn(4tleoiociadlptr ivi;(0 exm(rpiudomte fvi s)aDumum ;u1opeo octyslm2eau o;(0artoxo3oodfpDr ieo ( trxmxr nu1op   ietl(  2tmurpnt0aetn icias m2uanvp u)tlenxf oytopD aiei;() etoxm3nu1am e nciatf rumxr ;u0oee iociatlaDean s u4artoxfctadfmteli i s)texrxrpiy1aptelietl(fsDtaxr ou4olen fetysfs ea( o;t4 eeoxo tadlaDe u sls  etoxr3nu1olenmfcs s aDtr( p;t4alto ocils mDelnvpn(4 rtnxfctydfa eln sls0s2xoxr3oo4opt lnvsl( a2taxmo;o0alt moctltlm2uan o u4alerioctatfmDrauesls0t2xr(r3ny1altn fvta( sruaxrp;u4tetn i3tlsfa2rm(ms u0texrmfciodoaD auvs s0 2xrirpio4aptn fci sfsDur( poo1olxn o3iltfmDuanmo t)tltnir iatlaD an s (0 rtrir3iydolenlfcil( s2rrump;u0ale  feiyt mDeaums;t)tlxnir oy1opDraueilt)t2xmxmpno4ap   nvils a2taxm oo1aptoif3ias aDrmums;(0trerio3tytlat  ivi;t trurir3iy4lpenmnvtasf Dtmur ot0olt  oetatlm2um( p;u0artoircoatfpDeau s t0 etoir3oo4ap n nciatfs2raumono4optn o3iyd sDul( p t)teeoifciy1faDrai i ( t2xoxo3ou1ll  mfvias aDrr(mpnu0teen o3iys m rlnmp u4 exnifciytopDean o;(0 2xo(r iydlptnmfctl( sDrrxr nt0tetomoeias s rm( sn(0aetnxrcoa1omteauvi;( s2toimpoo4ll nmnetltfaDur(m ;u0tpx  fctaslaDrluvs;u0aetrifcta1fatraivo s t2tmxo3ny4om  miesa()a2rr(r oo4oleniicilt mDeanvpnu0arxoxociy1faD  ues;t)trto(mpno1ameemfet s a2rm( p;t4aleoioctydfa ra(ms u0teenxrcio1fm r ueils) rxrir oo1olen ietas)sDuaxm ;o0texnmi3taslaDranmp u4tltrir3oa1oa rlivo;(0teumxrpio1aptn nciasfsrra(m ;o0opeo oetls m eluvs;t4 leomocoa1oat  ueo t) exo(opny4lme lfvil(f Drmx ont4oltomoctys mDum(mo t)trenxo3tatfmtraueols0 2trio oudopte fetasf Draumpoo1oleomietatfs2elu o u) rtnmrcia1fpD liei;(  etoxm3iy1amt mfcs sf 2umu p;t4apx mfeiyslm2rl(vo u4tleoxr3totlm elnes (  eurxopiy4am emnetls)arrrum nu4tleomieiltlmDemu o t4tleoio ootfaDe nes;s0teum(m iodolt mneil(f Dtaxrp;t4aet  oeiydlsDuanmsnu0 rxnxf iy1faD an ils0t2urimpno4opte feilt) ruaurpnt1tet  iciltfs2um(mo;t4artomo3io1lpDraieo;s)s2xrim3no4om  liviat) Dtrxrpoo4apeomoetytfm2emu pn()arxrxf3tytoatrau il()sruoxm nydllenmfcs s)sDtm(ronu4opxn i3tas s rauvp t0 eerxocoo1lmtrlieo s)teurxr3iy4lmtelnct t) rrmx oou1tleo iciltlaDemn o () exnir3ta1lm rlu i;s0tetoxo no1om  lfcils)a2uaumo;t1texn fctls s ulnvo;(4tetnmo3iy1opteluvi t0t2xoim3iy1am emnvsatfs2um(  ou1olen o3tysfmDeanvp (4tlerifcoydfpt  i sls0teumxmpno4lp   iviatfarur(rpoo0olxnif3iyt a ulu p;u0 rtnxr3oodfpte neols0 2umxmpiu4ap nmnvs (f Drm(r oo4tleomictydfsDelumpnu4arxrxoctotlm rli i;s0texoimpoy1om   fesl()arurxroot4tltn octlslsDrmuvont) lxomf ia1lpDe i i;s)s2uo(mpiydamt  ici t aruaumo;u1altoiociyt sDrmuvo;(0 ltoxr oa1fat  ues;t0srurxr3oy1lpenmncils)artrxrooo0tpxoiocildfaDrmu p (0areoir3ta1fa rlueo s)sexmir iudopt mnvil()srraxmooo4ope ifeildfs el(mo;(0 lenif3todoptrlueslt trur(r3oy4olt licslt)aDurur nu0olxomfciydls2em(vs;u)treomf iadlpt lies () etm(r3oy4al n fvil(f rurxrpoo4tet  ictyslm rmnms;(0tetrif3oodoaDeai s ()texoxr3oo1lm n ivta( a2umump;u0tlxoioctytfmDrmuvo;t4alenmf3ootfmtran ol(  2umim3nodapen nciltfsrrm(rpno0tptn octatla el( p;()artoifcoy1oaD  u i;t  2xr(r3nudlme lfeiasfarrm(m ou4aet moetadlaDeln p;t) leomo tytom  aivils0srtm(opiudameemncias)artr(root0teto o3iydfaDel(vp;u4 leoxfctodomte ues;s t2urio no1op n fct (fsDuaurp;o0aeeo i3tltfm2eln s;t0 lxnxo tatomDr u sl(0setrir iydlmt mfctatfsrtmx o;u1alxo fctltls ulnmo (0 rtrmf3oadoaDraiei s) etmir oo1om emfvt ( s2ua( o;u1aptomoeiatfs2ulu p;t)artrmfcoatlm eli i;t truoxr3oudllt micsl(f 2rrum oo1olt mo3ildfs um(vp u0alxnxf oadomt  n i t0t2toio iu1ll nlietl()srrmu pou0tpt  octysfmDrl(vo u4tlenmo oydlp elueo t t2xmxmpny1lm nmfvi ()s2ur(m no4apeoiietyt aDuaumpnu4 rtrio totop  auesl(0 euoiopoy4alt lfci s  rtmuro;o0tlxo ieiydfs ra(vs (4aeenmf3to1op raues s  rurimpnydamtelfetas)s2rmumonu0oetoii3tydlsDeluvsnu0texrxf3todlmt  ivo ( t2xoir3io1llee fvsls) Drax pnu1oetomiciadfm2ulnvp (4tlxnxf3io1fm eln slt  rxm(o iy1ap  lnvsa(  rrr(rpnu0tlt mi3iasls2eaums;u) eeomr3ta1lmDeluvi (  rumim nodlp elnvtatfsrurxrpot1tlen feiyt sDua(mont0aetoxfcoatoatraueo t setmxopiy1lpee fvta()aDrru o;u1apxomfeiydfm rm(mo;()altrio ty1fmte ies t teumxo3oudll nmivs (f 2tmx  ;o0tlxn ieiad a2ua( onu)alxnmf3iatfp elivslt0 2um(r iudlpt lfetl( artmu o;t0tle  oetldfsDrlnvs t)tltoxf3ty1fatrai s s t2xr(rpoudlp  mietat  Drrurpoo1tltnif3tltls2ra(mo;u)tlxoxrcoo1lmDr uei;( texr(o iudlptn ictat)sDtmxm no4oet  ictatls el(mp u)trtoxf iodlp rauvi;t0s2trim oudame lnet t) Durxmo;o1tetnmfciatlaDeanmp;(0 etnxo3oodoatrai i;t) euoxrpou4am elfcs tfsDta(rpou4tlxo fciadlmDeln o (4 ltnio3iy1lpD au o (0tetrio3iu1llt lnvt ()artmu pou1aptn fciysla2ean o u0aeeoir3iotla  aneslt)trxmim oudam n ncsltf rtm(rp;o0tptomfeiysls rmumo u)texnio3tytomDr u s t trtrio3nu1ol   fvt t) Drrum no4aptnifctlt m2uanms u4 reoxociy1fptr n o t)truoxo3oy1ap nmfesasfs2rr(m ;o0opeomi3iltls2rmnvs u0tetoif3iytlp rau s s0trxoiopoo1ome mfeils) rua( o;o1opxniietlsfmDea(vs;t4 rtnxo ootom rlueils) rurxm oy1altn fvs sfaDua( oot0tee io3ias aDrlu o;t0aexnxf tytfmDr u i s)tetrir3oudal emfci t  2tr(rooo4oeenii3iyslsDel( p;t)tetnio3ty1lm   ueslt teum(r3iydolt mnei sfsrrmx onu4aexn fetlsfaDemnms u0 ltrir oo1la raueo (  rurxm nu1lm nmfvtls sDuaum nu1tex  o3ildla rluvsnu4trenio iy1opteauvs;t  2xr(rpio1lm   fes t)aDrm(root1tpx mo3iysls2ul(vs;(0trxomocoodomtraiei;t)teur(opnodomtelictat  2um(mpoo1olt  fcilt s2umu s t) ltnmr totlm   neolt) euoim iu1ll   nvta(  rtr(ront1aetnmfetlt a elu ont4tltoxrciotfaD aueo s  2to(rpnydamt  ici sfarra( pnt0tpx mi3iasls rlumsn()aexoxf3iytomteau ils0 2xo(o3oo1lme lictat)a2tmx  ;o0opto iciys m rauvp (0 lerirciydfptelueil(0 eumxm3no1lme mivtasf rta(mont1tle if3ilsla rmnmo u)teeomr ootlatranvo (0setr(r iu4altnlfvt ()srrmx p;t1tle  iciydfs rmu p t0altnxo oodlatraneils)texrxrpnu1lm elics ( aDra(m nu4aet mfcildlmDeanmp;u0tlerirciodfa rlies t)srxm(r3io1al   ici t)arra( ooo0tlxnmi3iad mDean on(0 lxnmf ootomte u i t0s2trxo3nudal emictatfsrtaurooo1tlxnmiciasfmDua(vp;(0aeerirctodom  lu o ()seurxm3oy1ameelncslt arrmurp;t0tet moctyt mDul( o;u0texnifctatlp elneo ( teuoxo3ou4lpenlnci s)srtr(m nu4opt mf3tls sDean s u) lxrio totoptraies () 2um(m nu1llenmfvs ( aDra(mpnu4apxomo3iatfa emnvs;(4 rtrmr oadoatr i o;t)trxmxo nudoltnlfet t) 2umu ono4tpt  ieiasfaDraumo u4areriocoydlmD  neil( t2um(o3iy4al e ietl( s2um(m ;o4ale mfciltla2rm(mp t0 rxoxr oa1oaDeau olt0texr(o3oydll nmietasfarum(rp;u4tptomiciyt m eluvonu)aexrmf3tatfmD  ueo t)s2tm(o3iy4optn ncs (f Drr( ont1optn i3iadlm umnvp;(0 ltomocootoat luvs;t)tetrxm no4optnlicsltfsrtruront0open f3ilsfm ul( s (4aeerxrctatfaDraivi;s) rtm(r nydam  lies tfartaurpnu4tpxnmf3ildlm em( s;()tetrxrctytlaDrluesls) etrimpio1ope mncsa(fsrtr( pou1oex moeiltfmDemumo (4alermo3oydoaDeanvilt) 2uoio3nodopenlnvi t) 2tm(mpnu1aptn ictlsfm emn p;u) eeomo3totlm  lnvsls0 exrio iudamte icia(f 2rau  ou4tlen ietatfsDra(mpnu0 rxoxr3oy1oaDelu o;s0srtm(opoy4lpen ivs t  Drau  nt1tlt iociysfm em(mo;t0altoxo oatop r i o ( t2trimpny4oltnmnet ( arumumpoo0apenmf3iysfa2ea( p u) rtoxocoatlmDe u s ( srxrxm3no4altn ivias srrmxr ;t1tle ioetltla raumsnu) exoxrctatla rlieo;() 2tmxm3iodlptnlictat)aDtmxmpnt1tptnmi3tatlm2ranmsnt) lenioctodlatrlivols  euoxopnudamt  netat s2tmx poo0optn ieild m2rl(mp;u0 lenio3ty1oa r uvsls)seuo(mpou1apt licil()s2tr(mo;t4oexoioeild aDulnvp;u) rtomociytoptrlnei;t trxmiopno4lpe lnet s aDtaxr ;u0opx  f3ild m eau p;u)trxnmr oodfaDe n i s0 eur(rpio4lltnmivi sf rrrxmoou4tpeoifcild m2ranvp;u4aeeomfcootopt  uvs;t  eurxo3nodope  nvta(f Dumxmpnu0oeeo o3iadfs2emumo;t4trxnxr3tytlateauvo t t2toxopoudale  fciatfsDrmur no0oltnmfetld aDrm( s;u4 eenmr iatlatr uvi;s s2to(mpiodlptnmncsls  Draxr ou0oetoifcildlm em( o;t4trenxf3tytfaDeai o t0srtmxm io1olt lnciasfa2ra(rono1tex mi3tysfsDem(vs (0 lxnio iadoaDe nvo t)t2xmxo oo4lltnlivsa( sDrr(m oo0texomf3tad m raumpnt)tetoxfciadfm   i ilt0tetrxm ny4lp n neil(f rrr(m ;o1alen f3ild aDua(ms;u)tetrmrciodlaDelivs t0 eur(m3nydoptemneil(fs2uru oou1aet io3iys a2uanmon()tltrxr oy1oaD anvs t)texoxr no4ol  lnesas) 2rm(m no4apt mfcild a2umu s t0alenmoctydla eaueolt t2xmxmpoy4am nmnvsl( sruaxm ;u4tetomfeiasls rmnmon(4texrxf tadlmtelnvslt s2umxopio4am elivt t) 2tm(m ;o4tltoifetaslaDrl( s u4 lxrxo oydoaDe i i;s trtm(o iy1op  liet sf 2ua( p;t0opt ii3tydlm2emu p u)tleoxr iodopt aivils trur(o3ou1lmee fvi t) 2taxmpno0optomociaslm2umu p (4aeerif iotomDe i ols) exoir3ou4lpee ictl()s2taumpno0oetnmoctyt m emuvo () ltrxf iotfaDrai o;t trtmimpiy1oltnlfvi s  Drm( pnt1opx  ieilslmDrl( ont0altnxr ootoatrlnei;() 2urxo no1apenlfcsl()s2rmx  ;o0apxoii3iysla eluvo;u0texnir3todop  luvils) rtmxmpno1optnmivslsfsrrrxr ot1tpe ifeild s um(vp (4trenif iy1fatelieslt0 eumxmpnydop n nei t  Drmuro;u4tex  i3iat s2eanmp;t4arxoxrcto1lm r u i;t0t2xrxo3io1amtelneta( arra( ono1opxnmfcias a el(vp;(4tetnif ootfmteaieslt teur(m nydlmenmnvi tfaDtr(r ;u1apx ifeils sDelnvonu4 rtoirciydfaDe uvi ( setmxm ou4lp   fvs (f Dtaxr no1oet iiciysfs rm(vo (4 ltoio oytopDeai i;t seto(opoudll emnei s)aDraumooo4apx mf3iadlmDua( snu0aetnir3iatoaDelu s;s)sexrir3iu1omt mfesls  Dtm( o;t0oetoiiciys s2rm( ont4altoxf3ta1fa rli s;(  rxmiopio4op nmfvsatf Drr(rpnt4aeeomoetat m ua( o;(0tetomr ootomtean s;t0sexrir oo1om  lnvtl(f 2ua(m nt0ope  f3tlt aDulnmp u0tetnmfcoytoaDe ivo s s2tm(o io1am  mictlsfarumu  no4opt mietaslsDuauvo;u) rxomo3oodfatrauvo;s)teumxr nydol  mfetltfartaurpnu1olto ieiatlaDulnvon(4trtnmfcty1fp  an s;()s2xrir3ny4apt lietatfsDrr( o;o1tlt iocildlmDrmuvpnu4teeoif3iatfaDr u ilt0srur(m oudopen ivt sfs2um( o;o1tpx miciyd sDumump;t4aeeomociotlaD ai sls s2uoio3no1al  mietltf 2trumono4olenio3iysfs2umn o t0artoircty1fmteauvi () rurio3no1amte ncsasfarrm(m nt4tee  oetltfaDrmuvs;t)aexnmo3oydfp ran o;() rtmim oydll nmfcslsf Durxr oo1tlt mf3tydfm uauvsnu0 exnio3iytoa r nvs;s trurir ny4ll elivtl( s2tmu p;o0tpxoioctad aDrmnvs (0aetoif3iotlaD ai s;t0 rxmxm io4aleemnesls a2uax pot1aexoifeiydla2rm( o;u0trerir3oodfaDraivs;(  2umxrpnudapeemivsa( srtrxmoot4olenioctadfs umnvpnt0 lerif3io1lmDeanvols)srto(o iy4al nmnvsa( aDtaxrpoo1aptnmf3tys aDrl(vp;t)altriociadoatr n ols) rtoiopiu4om elicia()srrrumo;t4alxnmietatfmDran p;u4tleoxocoytomt  nvs;()tetoirpiudom n nvta(f Dum(r oo0tlx  o3tlsfsDumu o;t4treoxr3oodlatrln ilt s2xoimpnodlpeemfet s) 2umuronu1altnmictatfs umnvpnt4alxrmfcio1lateaieilt srurimpio4op  lfcs s sruaxmont0oeenmoetls m uln s;u) exoxo iy1lmDr u s;s tetmxm iy1lme mfvi s s2trxmpno1tltomo3tas a2ulumo;(4artrio oatfaD livil(  2urxrpoo1ome livtltfs2uru  ot4altnmi3tytlaDeau p;u4aeenmo3iy1fateauei ()srtrxm3io4lmeemneiasf Dra( o;u4tetnmieiat s2elnmp t) renif io1lmt an s;s  2tm(opoudlpt mivta(faDtaum oo4olxoii3tat sDumumont4 renxrciatopDelu sls  2uoirpno4llen nvil( a2ur( pno1opxnmieilsfs2rm(monu4 lxnio3iatoa e nes;() rxrirpiu4am e nes s s2rrx onu1opeomocildfmDel(vp () eenifcoo1lmDe uvs;s)srxm(opoodap elicilt) rrmxrpou4teeo f3iad aDelnmp () leoxf3todomDeanvi;t srxmiopnodlmee fvtltfsrtmuroot4olx iiciys a2ea(vp;()alxnirctydop   u s;t srtoxr iodome lnctlt a2urxr nt0ape  oeiatfs rlnvs;(4arxrxf3ta1omD livo t  2umxr nydolenlnvias) 2rrxrooo0tee mf3tyd m2ua( o;u0 lxnio iy1lp eai o ( t2urir iu1opee fvi s) rumu pot4olxomfeiad m el(vo;u0 rxnmociatopD aivi (0sexoxr iu1ameelfesat sruau poo0aee  fctasfm um(vs (4aexoif oydoa e uvil( trxmxo3ou1apee nviatfarrrx ont4tle if3iytla2ua(mp;t)aexnif3iy1op eau sl( sexm(m3ny1apt licil(faDtmx  nt0alx mfeiadlaDrm( snu4treoir iatlp ranvo;(0 eum(r io4lmenlivtls)artmxrooo0aexo ictyd m rln s u0trenifcty1fm e i olt0trurxm oodlpt mnctl() 2rmxmonu4tlxniocilslaDemuvs;t)trtrio oatoa e ueo s trumxmpno4lme lfvi () rtm(m oo4apxnmf3iltfm ua(ms t0aetnif iatlmteauei;t)trxo(mpou1alt mics s)sDumxr ou1olt mieildfaDrl( o u0tlxriocoo1fp eanvil( t2uo(rpiydlme mneiatfs2rmxrp;o0alx  o3iatfa2ra(ms;() rtnio3todlpDraivi;s)trumio3iudomt  fviat)sDumuront1alen ieiysfsDrl(mp u0trtrxr oatom   n s;t seumxm3no1ll n ict s srta(rpnu4opxoiicildlmDrmn on(0arxrio3totlmDrlies t0teumxm3oo4lpe lnet ()srrax o;t1oetn feiadla rmuvo t0alxnxo3oatoa elies s0setoim nu4op e netas  rraumpot1alx mi3tyd aDeanvo u)artnxf3ia1omtelu s;s)trtrimpoo1al nmfesat  rtm(m oo0tle ioctyd s em( o (4alenxo3oydom  luvo ( s2xrxr3nudal   nesl(fartm(ronu0apt  fciytfs elnvo t0 leomf oydop  li i;(0 rumxo iydlp e ncs s)a2urumpou1tltoiicilt s2em( p;u)arxnxf3oatoatrauvo;s)srtr(opio1lpee nes t)sDurx ono1tpen fciltfa2ea(vp;u4tleomo3tadlpDe ueo;s0texoxr3nodam   nes ( srur(m nu4teeniicilsfaDuaump;(4 exoircio1fm e i i t trxriopno4aleelnciasfarurxmpot4ale  i3iad aDemnmsnu0artoxr3ty1lptr ues;()srumio3nydal   fcsltf 2trx oot4apeo f3tad s ea(ms u0alxnmf3oy1fmtelivs;s0 exoirpnu1alenmfes s) rurxmpoo4opxomi3ilsfaDelnmsnu4tlenxocoy1fa rln o;s srxm(opiy1lm  mfct sfartmxm ;t0oetn i3tatlm emump t0alxnmocoa1op e uvs t)srtoimpoo4lle lfcta(  2trx p;u1opx  oeiatfa rluvsn()teeomf3todlatranvi ( t2tm(m3ny4op  lnvi s) Draxroou4oleo f3iadfsDeaumsnu0tetrxf3oy1lmD lueo;()s2trxm no4al nmnct () 2urxmp;t1opt if3ias m2eaumsn(4tlxnxo ia1fmDrlnvs (0t2umxm3ou4lltnmfvs ()srrmxrpnu1aptoio3iydfsDumnvo;u4alerxo oa1laDeanes;s) rxmxr3nydlpt micia()srtrurp;u4tetn i3iatlm2em( s;()altrir3oy1la  aiesl() exmim no4apte ics tfa2rr(rpou4oleomictydlm ulums;(0 etrio totoatr ies;( s2xmio3iodamtemfctltfa2rruro;o4opxomi3iltlaDul(monu0teenxocty1fat  n i ()setmiopiu4amen nvt t)aDurumpou0openif3iatfs2el( s;() etnxf oytlp r uvi;s trxrxm iydopen nei (  Dtr( pou0aex ioetys m umnvp;()aexrir to1lmDe nvs t0 rto(mpnu1omt lneslsfarraumoot4olxnii3iatlaDeauvo (4texoxfctotlmD aiei;s)trum(o3oo4amtnmfvil(fsrrmumooo4tptnmfciltls elumo;u4 renio ootla r n i s)trur(mpiu4omtelfvt sfa2tr(mp;t1aex  iciltfmDumnmon(4tlxoxo3io1opt ln o;t trumxr3no4lp  lfvi t)sDua(rpnt0tltnmoeiysfmDeau o () lerxf oo1lmD livo t0 rumxm no4ll  livia() Draxr ou0apx  iciytfm2rl(mp u)tetoxr3totfmtranvo;s)setmirpiydlpeemieta( sDrrxr no4altnmocils a2ran sn()artomr3ty1op  anes;s)tetr(mpou4lmeemfvi sf Dta(  oo1tpt moetysfs2rln p (4artomo3oatfmDe i s;t)s2xrxm iydllt  nvsl()srrrxr nt1olt mi3ildfs umn sn(4trxrmf ootfmDe uvol(0srxmxo iudaptn ivsl(f rumump;o0oetomfeiys a um(vo (0alxnifctadla r nvs ( s2xrxmpiydalt  fcils arum(  ou0apxomieiadfmDranmo;u0 ltnmo iodopD aueslt srxo(r3io1ll n ivtl(  2urum ;t1alenifeiytfm2eau snt4 ltoif iy1fa  livo;t0teum(opoodllen ncia()aDurx ont0aexn f3ils aDrluvp;(0teerir ia1oaD anvil()texr(rpio1lmtn fetls sDrrumoou4opx moctldfa eauvp (0arenif3to1fp rlu sl( texrir oo1ame  icsl()s2rrum ou1tlx mo3iys a2rmu on(4 exrxr iy1laDr u i;(0trurxopou1amtelfesls) rta(r oo4tlen i3iyd s umnvpnt)tlxrmf todop  lnes;s0sexoim3oo4lp n fcsatfsruau  no1olxnioctas a rl(ms;u4texrircoydomteauvs t)teumir3iudaleemivsltf 2taxrpou0opxoifetadfa2em(vo u)alerif ia1fat auvi t s2tmxr oodllt lfetasf 2tmuroou0tpt  fetyslmDran o;t)altnxr3oy1omD  ivo;()srto(mpnu1oltemneias  2uaxm ;o1tpt iiciatlmDel(vpnu4 rxnmo todfpDrlnvsls)sexm(o ou1lme mfvsatfaDumx o;o4tex  o3tadls2rmnvs t4trxrmrciodop rluvolt)trtmir3iu4oltn ietlt)sDrm(  ot1aptnmietad m2ra(vo (4treoircty1lm rlnesl() 2tmxr3iu4aleemieilsfaDrmxmo;u1tpxo oeiasfsDemumo (0aexrir tatomtrlneo;t  etm(m3iu1oltnmieiatfs2trxmonu4aetnifetat aDem(vo (4 ltrir3iytom e i il()t2xoimpiu4opt lfciasfs2tmu pnu4aeenmictldfmDum(ms;u0 etoirciotfp  li i;t0trtoxr iu4lm n iesat  rurx oou0olx  oetatlm uau s t) lxnio oadopDrli o s)sexmxr iy1om   fctas) rrm(r nu0tpxnmi3tldla2rmuvs (4arxnmrciy1om  lues;(0texrxr3ny4amt lfeilt arum(ro;u1oeeoifciydlsDua(mpnt4tltrmo iodlatelues t  2toxrpny1llenlfciatfsruaum nu4opxnioeiat sDem( pnt)trtomo3iodop eluvi;()setoirpio1ale  nvils  ruax p;u1optnmfeias m2rluvp (0tlxnxfcoo1oatelies;( trxrxopou4lpe  icsa()s2uauro;o4aptn oetytlm ean s t) rxrmo3iatfm elu i;s s2xo(mpoo4op nmncta()srtrxr no0tptoio3ilt mDrauvo t4areriocto1oat  ies (0tetoim3ou4altemfci t)srtmx pnt0tleo oetadlsDum(vp;t0trermf ty1fa e n i (  exo(m3ny1ap n fvtat  Drmxr ot4aptoio3ildlaDumu snt0teermf3todlp   ueils)texr(mpio4am elies ( sruaxr no0apt iocilsfm2rln s u4 eenxf3totfpD  nvo s0srxo(r ou4aptnmivs ( sDraump;o1teeo ocildlm2emumpn()artrirctatfpDrlivo;s0 rtrxmpiudame  feiat a2rmu ont4alenmi3tyd aDea(vs t4 leoif oy1omDr nvs ( seurxo ny1aptemfct sf 2umumpot4tptn i3iytlm2rmnmp;u)trerif oytoaDr iei;t0trxmiopny1op   nvtlsfa2rrxmoot1openifetasfmDeanmp;t0texrif to1lmtr u sls0 rxmim3nudlp nmfet t)a2ra(roou0tpt mocilsfs uln o;t0 renxocta1fmt  ues;(0 exoxm3oy4op   feia(f Dtmx  ;t1tltn fetlslaDrau p;t0texoiociytop elu ol() exmiopoo4om nmfcsa( s2rrurpot1tpx io3iysfs um(vp t) lxoir tydfa rlu s;t0srxrim oudop elnvi sfsDrrumono1tltnmf3tydlm2uanvp;t) rxoio3tatlat  neil(0 2umxo3iydaltelfcsasf Duax o;t4tle ifctldlmDumumsnu4teerxo oydlmt luei;s0 ruoxr3no4lpenlnci ( a2rru o;u0alenifetldfa2el(ms;t4tltnxf iodomte ivsl(0s2toio3io1llenmicsl(f 2um(r ot4tet  fctyslsDumnvpn(0aexrmo3ty1laDraiei;t0s2tr(m3oydomen fesl(f rraxmpoo4ale  o3ild s2ua(vpnu4tlxoif ty1omD anvo;t)t2toirpiy1lltelictasfaDtmumont0tlxnio3iatlmDumu o u0aexrmo3oydfmDr nes;s0 rumxr3no4lpeelivsls  Drmumo;o0aexnmoeiysfm2rlumsn() exrir3ootoaDelnvo;( s2tmxr iu1lpeemncils)sDrrum ;o1aex  ocilsla ean s (4areomr ia1fmD  uvo (  exoio oydole mfcs t)s2taxr ;o4oee ii3iyd s2uanms;u0trxoif3ty1faDrau o s)sexr(r3iu1llenlfvi s  rrmx  oo1tee  feiytlmDua(mp u0texnxf ta1la eaiei;t)trumxopou4olte ivsa()sDua(root4oetomfeiltlm ulnvo;() exnxr tadopt livo s  2tr(m ny4alt liei t) Dtrxm nu0ale mieilsfm2ul(vont4areoir todlmt lnvil(0srum(r iydlmtn iviltfa2tru pnu1oee mf3ildfs em(vo;u4 rxoxrctotlat lnvs;s0srum(r3ou1omt  fct t)s2trxm nt1aeenmieilsfsDum( p (4trxrir3tytopD  neo;t)t2uoiopiudop   ncilt artaxmpnu0oex ioeiyt a2em(mpn(0 rxoir ta1la rlivi t  rumimpiudope liesasf Dtmxr ;u4oetoifciadlm ra(mp (4aexrmo iadlp r uvs s0 2tm(rpou4ap nmfvtls  Dtmx pnu4alxo feiatlm umn o;u) exnif ia1oate ues t0t2xr(o3no1omt mfei ()arumu  nu0alto ictadfa rl( p t) lxoxr tytfat  uesls tetrirpoydol e fvta()sDuaumont4alx iociyt aDeanvo;t0trtnxrciatfmt lnes;t)s2xoim nu1apte icilt) rtm(ro;u0tpxnmictldlaDua( pnt4altrif3io1oat  nvs (0teurxr iy1lmte icslt) Dtm(roou1tpt ioetydla el(vp t4 eerif iy1om e nvo s0 ruoirpnudap  miei sf rtrumpno4oexnmi3iadls2rau s;t0alxnxf3tatlmDrlneil()tetm(m nodopt liviltfa2tmu pnt4tleomfcildfmDraump;u0aetrxo ty1optelu i;(0s2ur(r ou4lmt mncil(f Dta(m oo0alx mo3iydfaDumnmpnu) rxnif3iotlp r ieo;s0 2xmxopio1lmenlnviasf Drmu o;t1tltn ieiatfa2rmuvo;u4tltrir3tatop  lies;( seuoxm3no1ap emnvt sfs2rrxro;o0oetnmiciyslm2ulnvpnt4artrmf3oytoaDelueo;( srtoimpiydomen nes s)a2tmxmp;t4aexo oetyt a um( onu) eermo totoa  anvslt0 2umxr3io4apee ict sfaDtm(ro;o4alenii3iytfm2eln o;t) lxnxo ty1optr i s;()t2xmxrpoo4opt lfetl(faDraxmoot4tpxn i3ild aDrmu o u0arxomociadfpteau ils0s2xoxo3iy4omtelieiasfsDrrxmpno1aexnmfeild aDrln pn(4alenif3tatopD ln i t0texr(r3oo1omeemncsl()srtmxm no1alxnmieiys a ranmp ()alxoxf3iy1lptean o;(0 rtoir ou4lmenlieiasfsrumu o;t0alx mfetasls2rlnms;u4aetoxrctodlmDe ivs () eto(rpiodlm  micia( aDum(m no1oee if3iytfaDrau s t)aleoxf3todfmte i ols)srur(opoudal  mivtasf rraxmpnt4tptn oetatlm elnmo () ltnir ta1lp ranvil(  rtoxr ou4opeelnesas)srtmumooo0oeenmociltfs ea(vpn() reoir3oytfate u o s  rur(rpnudam  mfcil(fa2uru o;t4olxo oeiyt a2emnms ()alerif3oydfmt anvils) rumxrpiy4lp nlfvi t)srua(  ;t1open o3ias aDuaumo;(4texrir3oodlmt lnei;t)setmir3no4lpt mfcs t  2ta(  ot1tpxnmfeiadlmDraumo;t) rtomf tadlmDr uvs t0tetr(o3oo1ap nmfcsl( aDra(mont1oexomi3iydls2eau o;(0 lxrmocty1lp rlieo s t2xo(mpiu1ale  ivta( arum(m ot0ape ifetlsfa2eanvpnt4trtnmo tydlpDelnvs;t srxr(rpno1optn ietatfaDum(mpno4texoiieildlmDelnms u) rermr3ia1om rai i;(0srxr(o iudapt lfctatfartmxr nu0oee iociytla2umnmsnu4teerxo3ta1opt luvol()seto(opoudlmtn fvtat) rur(ront0ope ifcild a2umu p u0 reoif3tydlmDe u sl( t2to(r3oydal nlics t)srurxmo;u4apx  i3iat s2umnvsnu4altnxr3iadlpt lueols0trto(opoy1amtn fvilsf 2rrxm nt1oexomf3tytfaDrm( p u) ltnxf3totop r n o;(  2uoir3no1ape  ivil()sDrrxmooo4aexomfetysfa rlnms (4trtomr3iotfaDelivilt) 2to(o3oo1ll n feslt) 2tmx pou1tptnioetad s2rlnvpnu) rtomf3tydfaDe nei s0srtrxo oo4amtnmnvils)arrr(  ot4opt ii3iasfm2rmuvo ()arenif iotlate ieo (0 rumxo3oo1ale mivsasf rtau  ot0tlt mi3tat s2ea(vp;u) etnirctydom  lnvo ()trurxm iu1ap nmnvi (fsrrmxrono4aleo ieiltfm ulu p (0alxoxo3ta1lpD luei;(0s2umxopio1lmeeliviat aDtr(ronu1opeomoeilsfs2ul(mpn(0 eenmf io1fmtr nvo;s)s2toio3oy4ap emnvt s)arraum nu1apeo i3iytfa rluvs;t)tlerio to1fm eaies ()setmxmpiydop e nei (fa2rmumo;u4oleoioetls sDuluvo t4 rtoxf oo1oat auvi;s  ruoxr3iydalt mivtat) rtrumo;u4tlx ifeiadfsDeauvon(4 etrmr iatoaD  i o;s0 2uoxm3nu1amtn icsa()srtaumpno1aexoii3iaslm umnms u4 renif oa1fp e ieo;s)srumimpoy4apt  nvtl(  Drr(mp;o1apxoioeiad s elump t4trtoxfctydomtrau ilt)sruoim3nodopteliet s) 2uru pnu0alx  i3ildls uanvs;() ltoxo oadopDeau ilt) rtrxm3iy4lm elivsa(f Dumuro;t0tlxomf3tyd m uanmp;t)aetrir3oydfpDr ivi ()tetr(r3nu4lptelies (fs2taxro;t4tpe  ociysfsDem(mp;t4arxomociadlp  an o;t) 2um(rpoudam n ici t)artaur nu1aetn o3iydfsDuanmo;t4alenirctodlpD livsls)sruoirpny1ol nmicil(  Dtru o;u0opx ifciytfm2em(mp;u4teenmo3oa1opte nvi t trum(o3iy1op n neia( arrr(  ;t0opx io3ildla emn pn(0 lxrircoytlp eau sls)s2umim no4ale liei s)artax pno1alt mfeils aDeln p;t)teeoxrcoy1lat  n i;t0 rxrxmpiy1lmee fciatf rra( ooo0oleniieiaslm2eaump t4 lxoxo tadfptr ieo t)srxrim3oo1op emfeta( a2taxrpou1opt  octlsfa2ulums (0aeeomf totoa ran o;(0 rtmxo3ou1lmt  nvtatf rumxr ;o1tlxomfciadfm uanvp;u)tlerxrcto1fpD lnesl()s2tm(mpiy4lpen nci sfaruaum oo4tptomi3ildlm2rm(vs t0aetoxrcto1fmDelu i s  etoxm3no4lpeelfvi s)aDumx p;t4alxomi3tydlm2umu pnt) exoxf3ia1lptelneo;()texoxrpoodol nmfcil(f 2umxro;o1optoii3iytlm2emnmon(4teeoxf oydfatr ivi s)seur(o oy4al elivt (f rumumont1olt  iciyd a em(vsnu4 ltrxf oatfaDe ivs t0 euoxr nodlle mici t a2tm( o;u1tetn i3iyt aDeanvo t)teenmocoodlaDe ivil(0t2uoxo3iydamtn iciat)artmx p;o0olt  oeiys s uluvp (0tlenmr3totlmt livs t0 etmir3iu4olenmnesa()aDra(monu4tleomfeiaslaDeluvp t0 renio3iytopt lieo t  rumxm ny4opee ivsasfa2taurpnu1altomfciysfs raumo;t0alxoxf3oydlmDeai ols)trtoir ny4amtemfvias)srtmx ooo1texo o3iytlm emnmsn(4 ltnxr io1fa   n i;(0 2um(m3no1aleemfct sfaDuaur oo0tpe ifeiysla2uau o ()tlxnxr ia1faDr ivo;t)s2xmxm nudam n neslt)aDtaurpnu0ope mo3tldfs uanmo (4treomf oadfa eauei t s2xm(m3oo1lmt lncia( srtrump;o0apenioeils mDumnvp;t4texoir3oydlpDrai s s0srtrxm iy1ole  fesls)sDra(mo;u1tpeomieiaslsDulnvsn(4aexomrciydfpDrliei;t0trxoimpiu1ole mneta()aDra(moot0tpt mo3taslm2rluvpn() etoxf tytomDeaiei;t) rtriopio4ome  fvs sfsrta(rpnu0tetn iciytla2el(mp u4 lxoifctotfpD  nvslt0 euoxopnu1al   fvils sruau  no4teenmociytlm umnmo;(0tetoxrcoa1faDrlivilt seuoirpnydlmte iesat artr(moot1aetn fctld m eln pnt4aexoxr iydlpD lnvi t)srtmxm iu1lp n fctl(f Duru  oo1ale ioetasls um( sn() eerxf3iadfaDrai ilt) rumir3ou4am emnvs ( a2um(r ot0apt mociytlm ulumo (0altnxrcoatfmDelues ( srtr(opny1ope lfetas)a2ra(mp;u1altnmiciydfmDeau snt0arxoxo3tadlateanvi;t0 2um(m3nodlmtn fvta( sDrru pnu4opeo ictat m2ea( pnt4treomociadopD livsl( t2xrirpno1openlicsl( s2tmu  ;o0tleoii3tadlsDrm(mo;u0tetoxr iydfp  an ilt0trur(r3nudlmtn ivi t a2taur ;o4teenioeiltlm2ra(msn(4trtoxf ta1fa  ai slt0sexm(m nu1aptn feta(  2umur no0aexn o3tytfm2rl(mo;u0trxomr3tydfmD anvolt)trxoir3oodlmtelncilsfa2rm(mo;t0oltn oetyt s ul(mo;u4aexomf3tytfm eanei t0 rtmxo nu4lpee nvils) rrr(rooo4oltn i3tydlm el(mo;(4tlxnxo3totfa  au o;( srxoio nu4amtn fcs (faDuaxr ;t4aeto fciydfs ranvs (4texrxf oa1opDe i sl( tetoxopnodapenmiesat artmxmpou4oexo f3tadlmDeanmp (0tetriocoydoaDr nvi (0s2tmxo oy4omtnlfctl()aDrrxm ;u4tpxn ictytfa2em( o u)tetrxf3iytlp  lneo s0 2uoir3ny4ap nlfcsltfaDtm(rpou1tleoifcild s2uln o t4 lerxf oytop  aneo () rto(r iy4ap emn
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;s0trxmirpio1om emnvsl() rtrxrooo1tet  ieils m eanvpnt4arermfctadomDeaiesl() rtrim3oodopt  fvta() 2ur(  nu1teeoii3tas s2raumo t0alxrxoctatfm eai s t)setrxr iudameemfci t aDumump;u0olx  fctysfm ul(ms;() rxrir oo1fp  lueo;s0 2uo(opiy4lltnlicsa( s2ra(mpno0alxnmfetys aDuanmo ()tlenmfctotop eaivils)trtr(mpoydam nmfvsl(  Durxrooo1oexnii3tytla eln pnt)aetnmr oa1lpt  uvil(0s2xrim nydolte ncs ( s2um(  oo1tpenio3iat mDulump;() rxoxrciodopDe i i;s texmir nu1lmenlncsl() 2trump;t4optnmoeilsfa2em(vs;() rtomo3iotlmDraieol()srum(mpoy4oltn ncilt)s2rm(  ;t1olx  oeiydlaDea( s t0trerir todfmDe uvo;() 2xo(r nu1op nlfei () rumx ono4olx miciytfa umuvo t0aetoifctydoatr uvo t  rtrio3no1apt licias  2rrurpnt1aee  fetldfm2umuvo (0 exnir ty1oat aivi;s0truo(m oy4omeemfciatf Dtau  oo0tlx  f3ilt a2rau s t0trxrxf3tytfpD  n ols0teur(r io1ol elici t  rurx pnu1texo ieiyt a el( p;(0tltnxo oytomt  uei (0s2tmxr3iy1lp nmneilt)aDtauro;t4apeomi3iytfaDrmnmp u)texrif oatfmDr u s (0 2toxr io1am elicsls aDtru  oo4tpx  i3iatfaDemumpn()arxnio3tydlpD au ilt)srxrxr3oy1opt mfviat)artr(rpoo1opxomf3ilsla ranvont4 ltnmr tydom e ies s s2xoio3nu1olenlfetlt)sDtm( ont4teeo feiasla2rl(vp;u0tlxnmf3iadopDr nesl(0 2urxmpiy1olt lfes t srtaurpno0oexoifcils a2raumo;(0arxrir oydomteln s;t)srto(m nu4lm n fvilt)aDtm(r no0olt mieiyt a2rmuvs;u0 rtomfcoy1fpteanvolt  2trio oydll  lfvs s  2rr(ro;o4aleomi3iad m ea(vs;t) etrircio1fp rauei t t2umxmpnudll  mfvtatf rtrxm no4ope mi3taslm emumo t4texomocia1op r u s s) 2xoxr oy1opt  nvtasfsruaxrpoo4oetniieildlmDranvsnt)teeoir iytfmDrli s s0s2um(o3nydape mfei tf rtr(r nt4alxn oeiys m eluvs;u0 eenir todopte ieo;() eumiopio1omeemnct t s2uax ono4alenmf3ils aDemnvp;(0aleoxf oy1fmte nvils) exoir nu4alenmfeiasfs2rr(r ;o4tptoioctyd mDuanmpnu0aeenif3oadomteai ol(0 rto(mpiudopenmfvs s s2umump;o0ape  f3iadfm2eauvp u4texnxociodlmte ivsls)s2umim iy4om emfcsas)sruru  oo4tpe  o3ild mDem(mon() renxr3tydfmteliesl()t2xmxr3ny4op n netlt sDur(mpoo1aetoio3tat sDuan s;u0altoxrcoo1lptr n i () 2ur(r3oudllt lies s  rtmurpnt1texomo3tlsfm2ua(vs u0 lxrxfctatopDr i slt  rxo(r iu4ameelfcslt  2rrxmp;o1aex ifeilsfm rl( s t) eerxfctotlat  ivi t) etr(m3iudame lnvtat aDtmumpnt0tptomociyd sDelnmont0 reniocoa1lm  au olt0t2tmxrpno4ll  lfvilt) 2trumont1tlt iieiatfa2eauvs;u4tlerxoctytopDraneo () rum(m3no1ll  mfvtltfaDrm( oou0alen oetlt a rm(vp;t)aexoir3tytlpDe ivi;()tetoxo oydoptn nvs tfsrtau p;o1ope io3ildfm2rau on(4tltrmfctydlat lnvsl() rtm(o3no1opt  fvia(fsrur( oot0apen fcildfa2eauvp (4aexrio3totoateau i t0t2uoio3oo1ol  lfet (  2umumonu4alto fcildls ra( ont)aexnxrctadlat  nvs t0 2urirpny4omtemieslsfsrrrurpnu1tpx ii3iysla ea(vs;u4 rxrmr3ootlmt lieslt)t2xmxr ny1llt  ici t) Drmxr ;t0opx  o3tlsfm2ean s (0arxnmr oatlaD anvilt0 rumxopiydomen iet t arrmxmpnu0oetn f3iat s ran s;u4tlxomr ootoatr neol( s2xm(m3ou4aptnmfvsat  Drr(mpot0apenmfeilsfs ra(vo (4trtrmf oytfmtraneo;s  eumio nu1oleelnctl(fsrrr(mo;o0opt  fetasla2ul(vonu0aetomf oatlmteli ilt sruo(r io4lm emfesls  2urx oou1altomfeils m2ul( ont0 eermo3tatfm elnvi t)srxmxr oodoptnlfei ( a2ua(r ou1oleoiictltfmDel(mp;t)tlxnif3iatfp   uei;(0s2xm(m iydlmen fesls s2trx ono4tpx iieiyt s eau p;()trxnmf3tatfm   iesls t2toimpnudlmenmfeiat  Dtm(mooo4tpxo i3ias m elnvpnt4tetriocty1oa  anvolt srxm(m oodol nmfvta( srtax  nu0oeeoiictydfm2eaump;u)alxoxf oo1fpt auei;(0 2ur(m iu1lpteliet sfaDur(roou1optnio3tytfa2eauvp;u)arenxo3iodlaDrauei (0seumxopio4amtemncs tf Drm(mooo0tpt  f3iyt aDulnvpnt4altoiocoa1oate neo;t) eurim3io4ol  lncsa()aruaum ;o1tlt iietadlm eluvon(4aetnirciy1fa r ivs t trtr(m3no1lm   netat  rtax pot4oex mietldla uauvs u0arxrxo3to1fmD li olt0 rumxr oo1ame livi ( srtaxmpou4aptnmietyd m2rln sn()trxnifctodlmt anvo;s0sexrir iy4amee nvta()a2uax pnu0oet io3iltla2rmnvs;t) etrxo3io1lpt  uei s0srum(m3ou1ll e net s s2ra(mpno4oetnii3iyd a el( onu)aleomo oa1opDe ivs;s) 2toir3iy1open ietas)aDuaum ;u4oltnmoeiad m2rmu o;t0aetomfcoa1oa   n o t)sruo(mpiodoptn iciltfa2uaumo;o1olt  f3iasfs emu p t0texoxr3oytfa r i s;s0 etrxr oo1am emfei t s2umxmooo0tlto oeiasla umuvp t0aeenxfcoo1fat lu i t)setr(m3nodam   ivi s)arrmurpot1alt io3iydfa rl( on(0 rtomocio1laDr neo;()t2xoio ou1am   nvs sfaDtax pot1olt  i3iytfsDum( pn(0 lxrxo3iydlptelivi t)setoir oodalt livtat)arrau ont1aptn f3tldla2em(msn(4tltrmf oydop rli i;s teuoxo ny1am nmicil(faDua(mooo0aexomoctlsfsDuanvp t4artoif oytlmteaies;t0t2tr(mpiudaltnmfetl(  2rmu  ou1tltnmi3tys s rlnmo;u4alxnxo3oo1lpt  ivo;s0 2trxopoy1lmenlncia(fs2rrum ;t4tle  octas a rauvp u)arxoif3todfat aneols0s2tmxr io4lmtelieslsfsrtrum nu0tpx  oeils mDel( p u0tlxnxo io1fpDe i o;s) exoxmpiu4lm elnet s) 2tr( ono1optn feias a2um( s t)altrif iydfp e iei;t texo(opiodamee neilt s2tmurpnt4tpxn feiyslm2um(ms u0 ltomf totla r nvols0 rtm(o3iy4lmt lnetatfaDrauronu0altnmf3ias s uaumsnu)teenioctydop eli slt) rtmir3io4aptn fvt s sruaxmpot4tlx mo3taslsDumnmsnu)texoio tytfm  luei;s0 rto(rpny1amt lici ( arur(mpou4altnmfctadls um( onu4areomo todoa   ueo;s)t2xrir3io4lmeemfcil()sDumxmo;o1opxomfetldlmDum(vp;(4aetnmrcoatlp raneslt s2tmxo oodoltnmnvi ()aDrmxro;u1tpen ictysla emnmo t)trerir iatop eauvol(0srxrimpoy1ale  fvs s)srtmur nt1olt mieils s eanmo t4 lxrxfciotfpDeanes s)tetoxrpou4lltnmfetas)arumurpno1oeeo feiytls2rl(mp u0trxomo oy1lm r nvo;t  rxo(mpnydopeemnvs s)srtrxmont0tltnio3iadfs umnmp t4 rtrxr tytfpD lueolt0srxrio3iodame  feils srra(  ;o4tpxn feiysla em( o;(4tlxoxr iotfateaivsl( trtmxmpnu1omeelnctatfsDtmu pnu4alx mietatlsDea( s;(0aetrir3oy1oaDe uvils srxoir iy1apee fei tfa2trx o;u4ale iiciyt s el(vpnt0aetoirciodomDelieol( seuoirpno4llenmfci tfaDurxr no0aet ioetad s2uau sn() rtnmo3oy1lmDrai i;s)s2trxm oodolee ivsat srur(r ;t0openmictaslm2rmu p;t4arxnio totfpD  u o ( s2urir nu4ameemnvs (f Dumurp;u0ale  oeiydfsDeluvo (4 etomf iodoatr ies;t0s2xoir oydaptelfcsltfs2tr(rpot0apeoifctydfs2ulu o t) reoxo3iydlatrlivil(0trtrxr oo4lm  livs (f Dtrxro;o4oeeo o3tltls2emu on()trtnxo3tytfpDrli i t)srxr(o nu4aptnlnet ()s2raumpou0apenmfetatfa2uluvs (4trtomo3oo1lmD aues s)srtoir3nydalt  neiatfs2tr(r ou4alxo i3iyt a2rlnmon(4aeeoir3oydfaDr ivi (0srtmxmpiodol n fes t)artaumpoo4olen ictys mDemnmp;(0arxoif oa1oa ranvo (0s2xo(rpno4oltnlici t)s2trx pnu1aexoiociysfm2umump;u)altnmf3oytoatr nvsl(  ruoxm iu1omt lncsls)s2raurooo4oltn ociad aDul(vo u4alxrir oodlptr uvi t0 2trim oo4om emictat)sDum(mpou4aexo fciyt m2rln s (4trtnif3tydfp e u olt tetrxo3no1oltelfcsat a2rm(rpno0olxomf3ilt a2um( p u)alxomo totoatr n i t)s2umim3iudalen feta(f Duax o;t4opxomoeiys m eln pnt4tetnio3totfptr i i;t  rumxr nu4om   neiatf rtmum no4tleomf3iadfsDrmumpnt0trxoiocoa1lpDe uvi s)t2umir ny4lp elivtl(fsDtrxmp;o0olx  i3tyt aDel(vo;t0tlxrxfctydfa  lnei;(0 2tmirpny4amenmiet t) 2ururpou0oeeo feiatfsDrmnmo;t4 leomo3tatlm rliei;s s2trim oo4aptelieia( sDtr(r ;t4ale  f3tlsfa2ea( pnt4 renmfciodfmDr ivi;(0 eumio io4al e fvsl(  Dumuroot4oet  o3iysfa2uan snu)texomo ia1opD aiei t trxr(r ou1al  lies sf rua(ro;o0tlxnii3iys m ra(ms;(4tleoxr oadoat  u i;t texrxopoydlpeelnes tfaDtmum nu1aetnmfeiadls2umump u0trxrmocoydlp eln s (  2uoxm oudop nmivtltfarra(r ;u4tetnii3tld a2ean o t)trxrio oy1laDranvs;s  2um(m3io4apenlivils  rtr(mpou4apt mieiadfa elnvonu)aeerxfctatoa elnvi t) rxm(rpiydamen neilt) 2rau  ou4aeeomociadla2ranms (0 etrmo iatoaDrai i () etr(mpoo4amtn icilt)srraxr nt1aexoifctas s rau s u0 rxomr3ty1lpD  uvs;t)teum(rpou4ap  mict (  2tmxrpot0aetomi3tytfs2elnmpnt) leoir3iotfaD livilt  eur(m3iu4omtnlneils)sDtau o;u1texomo3iatfaDranvs;() reomf ta1laDeaneo s0 euo(o oudlpt  nvi sfs2tmxrp;o0oltomi3tldlsDrln s (4tltnmrcoadoateluvslt trxoxopnu4ap  livs t  Draumpot0oetoiictytfa ranvs ()tlxnxrcoodlpDeau s;s)s2umxm3oudllt  iciatf 2tr(ronu0tlenmoetadfmDuauvs t0alxnmo tydfp eai s (  etrxrpio4lp emneiat) 2raur ot0tleomo3tlsls2rl(vp t4alxnxrciy1fm   iei;s) exrxopiodlmtnlictlt  2raxmp;o1ope ifeiltfs2rlumpnu) leoio3todfpDr n ols texr(opnydolt mnes s) 2ur(  ou1apto ictls aDrlnvo;t)trtomo iotoaDeai i s0 rumir3nudlm n feta( aDtrxmo;t0tetoiociyt a2rl(mp;()tlxoxfcoytomte u i;t)trxmxm nu4lm   nvtl( a2rau  nu1olxnio3tldfsDuanvp ()alerxfcto1omtr u o s0 rxo(o oy4lp e ivt ()a2taxmpou1altnmi3ildlmDrln o;t0 reoir3todfm rluvo;() rxrxr no1ap  micsa(fa2rmum nt0apt ifctydlm em( s t) eeoxr iytlptelu s;( sruoxo io4lpee nct t)srra(r nu4tlenmo3ilsfa2elnvs;t) lxrxfctydomtrauvs;s)truo(mpiudol  miei t)s2rmxmpou0tetniiciyd a ea( p;u0 lxrxrctatlaDr n sl()srurir3oo1amenlfvsat)srtau ono1optoio3ilt s rlump;u4altoxfcia1oateau i;(0seumirpnydopen iet ()a2tax  ;o4ale  octytlsDumu p;(4 rxnmr3oa1omDe uvs;(  rum(opoy1am n iesa()srrrxrp;o4oet mf3ilsfa2ran pn(0tltrmr ty1omD au s;t)seum(o3ny4aptn nciat)srrax pno1aexnmi3tld sDuauvpnt4aeeomf3ia1omtranvolt sruo(o3oydlpee net (fsrururont0apto octat sDumnmp t0 etoif3tytoaDrlueil( texoirpny4ol nlnvias arrrum no0aet mo3iytfs2eln p;u)tltnirciadfa eluei s0s2uoirpoudamtelivs s arra( ont4tlxnii3iat aDeanvpn()texrmr3ty1faD lu o s0 2xo(o nu1lle licta()srur( p;o4oltnmieiaslsDelu sn(0aetrmr oadla r uvils  eto(m iu4openmieils)aDrr(r ot4aeto fcild aDeaums t4arermoctotfmD ai o;s0 2xoiopiy4lleelnvsatf rum(mpoo0tet  ieiatlmDumu ont) rtrxrctodlpteanvo;t)trxrimpiudlptn fesa(fs2tmu o;u1apxo i3iys s2em( o;t)artoirctotfptr uei t0sexmir3ny4ale micslt sDrrumpnu4olxnioetydfs2ulu on(4trtoirctatfatranvi ()srum(rpnudlpe liviat arurum ;o4oltnmf3tatlsDrmnvs (4 rxomf iytom  au i ( t2to(m io4lmen ics sfa2tax ooo0tltn iciyd s rlu s;t)trtoxr ia1fpDelnvs;() 2um(r3oy1llee ivsl( sDrmx  no1apt ii3ildfmDeln o;(0 eeomocta1fa raueo (  eum(opoy1lpte fvslt)arurx  oo1oee mo3tasls ulums;(0trxnmf3tadomD ln i s)s2xoxr nu1lp elfci s)sDtax p;u1tet ifeiysls2ran o;(4teenxfctodlmD  ivi;s) 2umimpno1amtemies tf Draxr ou4apxomfetls s2eauvs t0 lermr iydopt  nvil(0sexmio oo1ll e ncs ()s2umu pou0open o3iytlm eau p;u0 etnxo tadfpDeluvslt0t2xmxm3oy4aptelivt ()aDrm(r ;o0ope  ictysfmDuanmp;u4aeeomf3tytoa e ivo;(0seurxm3iu4lpen feilt arrax  ot4apeomf3tydls umnvp u4aeenif3iodfm rlnes t tetrir oo4ll  mivtls)arur(rp;o1tlxomoetadls ul( p (0 exnxr oadfpD lies s0srxmio3no1ol emivil( s2uaumpno4oeeniiciltfs rmnvpnt)trtnmr oytlm eanvi;s)s2to(rpiydopen fvsas) Dumum no0aex  i3ils a2um(vs (4trenir3oydopt luvsls teto(m3oo4amtn ieiat aDtruront0tlx miciysfmDrmums u)artrxoctydoat  uvilt0trxoiopnu4lmt mfvtas)artru pno1apx  ociyd sDuaumo;t) renmrctydfatrlneil() rxr(o oodlmtnmictat) rurxr ;o1oltomfeiysls rau s u4tlxnxf3tydlmt livs t0seurxopoy4am e iesa( s2taxmonu0opt ifciat s2rlumpnu4trxrio iotlp r iei s s2toxm3io4omtelivs ()a2umx  no0oex  i3iydfs2ulu p (4trtnio oa1fm rln s;s)s2xmxmpoydopt  feilt  rraur ;t1oeeo f3iadla ul(vp ()aexoxocoytomt anvi;(  rtr(r3iudlm  mfei s)arrmxmpnt4altomictysfs2eanmsnt0 reoxf iotomte nes;s0seuoir oy1om elies sf Drrx pot4apxn fciyt s2rlumo;(4areomrcto1oatraneslt) exm(o oudlmtemfvs s) rtau  oo1alx  ociltla ul(mo u4aleoxrcoadfmte u olt t2toxo3nu1amtnlnvtas  2raxrpnt4tltnmfciatfm umnmsnu) rtrmr3ootfaDrluvo;t0tetr(o iy4aptnmfcil(fs2raumo;o1oeenmoetytlsDel(vs;t0altoifctodomtr nes s)s2uoxm3ny4amtnmieta( artru o;u4aeen fctydfm2ea(vp;()tetrmrctodfp e uvi t)t2uo(o no4lm nmfvilt) ruaumono4tlt ifciydfmDrlnmsn(0altnmrcoodoa  livo (0seto(r3nudolte ivs s  2raxm ;o1tltomf3tyd m2emnvs;t)arxrir iy1oa  luvo;s sruoxo3ou1lpe livil(f rtaurp;u1oexomi3ilsfmDul( s (0altoxr totfm   i s;s)t2xo(o3no4al  lieilt) rumxrono4olt  i3tat sDem(mpnt) lxrmr3iytomtraneols0t2um(rpoodopenmiet s)arrmum ;t0ole iiciltlm2el(mo u4 renxr iytfa rli o;(0teuoimpou4alee iei ()aDtm(rooo1tpxnifeiltfm em(vs (0aetnmf3iadlpD  ues (0srurxo3no1lptemfviasf 2um(ro;u4tle ii3iytfmDuan onu4 lenxo ta1omteauvo;t)srtr(o3ny4alte nctl(faDurx pnu4teeniieiad s2emn o;t)texriocoydomD au sl() ruoirpoo4al  lnvtltfsDuaumpnu0aleo ociyslm rmn s (0 ltrircoy1opD  u i;t0 exm(r iy4lm emfesat aDtm(ro;o4aptoifctls a2ea( s u4trxrxf3iodfmDe nvi () 2um(opnu1lpe mfci tf 2rmur ;t1oee iociasfa ranvont0 eerxo3oatfp   neols s2to(o3oodlm emivslt  rrr(m ;o1opx ioctltls2ea(vsn(4 rxoio ta1omt lu i;() euo(r no4lm elfeiatfsDta(  no1tlt mf3ilslm2ua(ms u4 rerxr3tadfm   ivo s) ruoio3nydapee nctl(f rtm(  ou0oetoiiciaslm rlnms;t0texrif oatfat aiesl(0texmir no1amt  nctlt)aDuaxroot1aex iociaslaDua( ont4 ltoxo3iy1om e nvols teurim3oydale  fetltfsDraxront0opxnmfciasfs2umu on() eerxf3iatoa rlnvo (0texrxr iu1opeemnvsa()sDrm(rpno0olenifeiyt a ulumsnt) ltrmr3ty1fatran il()tetr(o iy1omt lictls sDuaxmono4teeo oeiatfm2el( snu4arxrio3oa1oa rluvi;()srto(mpiy1ll nmivia() 2rrx  no0olt  oeiadfsDrmuvo (4tetrmr3oy1oa r i i;s s2uo(rpny1ll n nvia() rua(  ot4oleo icils aDrlu pnu) rtrmf3tytomD ai s;()s2tm(r3iydoptnmfcs ()aruru  ou0tpxo f3iatfm2ran snt) lermrcoo1fmtrluei t s2tmimpny1lltelnvias) Drrxr no1tpxn oeiydfaDem(mo u)tleomr oa1fp elieol()sexo(r3iu1op emieias)aDua(mpoo4ale mi3tytlmDrluvo;(0altnxrcoydla r ieil(0t2urxm oudole  fctlt)sruaxrp;t4aexnifciatla rlnmp u0trxrio3totlptr ivo (  rtr(opoo4lp   fct () ruaxm ;o4oex  oetys s2eanmp;t)trxrmociodlm  lnes;(0seuo(m nydop n ivtls)artaurpno1tltnmo3ildfm2rauvs (4 eenmfcoodlaDr i i;t)sruriopny1omee ict tfs2ur(rpno1aexn i3ild m2rmumpn()arxrxfctatlmtrlnes;t0texmiopnudomee fesl() ruaurpot4tetomo3tytls2ul(vpnu0aeenmf3iotop ranvi;s t2tmir iydlpt lnciat)arur(r oo4oltn i3tasfm2elumo u0trxnmo tatoateaieilt)texo(opoy4oltemncsa()sDrm(ro;o4tleoif3iat mDua(vo (0 rtnir iadfpDrlnvols)s2xrxo no1altnmivt (fs2ra( pnt1opxnmociysla2ea( o;t4 rxomo3ootomteaueslt) exo(opiu4apenmnctltfaDumurpno1altoio3iytfs eanvs;t)alermo todoa r uei t)seuoimpoudlp elfvs t)aDur(m ot1aeen o3tls sDua(ms;t4 leoxr3oydlmDe u ol( srtmio3ny4optn ncta( s2rrxrp;t0tltoifctatls rlnvp t0aetnmo totoatr n ils setrio3oydope mnvt ( a2rm( oou1aex mo3tltlmDuluvon(0arenxr3oo1lmDrau s;t)texrxmpiu1lme  ies t)srur(mooo1apeomfctld s2eluvs u) exnmfcoadfmtrauvil() 2urxm oydaptemivil( s2rrx ono1oexnifeiyt m2eanvpnt)arxrir todoa r u o;()t2tm(o oo1lmee fei sfsDumxm ot4tpt iiciadfm emuvo;u)aexnmrctytlm  ln s;(  rtm(opnudoltn fcs t  2trum oo4aex iicildfmDra(vont0aeermr3ootfatraueil(0seurimpny1omenlivs t  Duaurpot4tlt  oeildlsDelumpn()alxrio iotfmtranei;( t2ur(o3iy4lp nmnes (faDum(mp;t1oeeoio3iydls ua(msnu4 rtrmf ty1fpDeaneo s) 2uriopny4ap eliesl( aDrax  no4tltn i3tytfm2elnmp () etrxr ta1fpDr uvs;s)srtoxr3nodam n net (fa2ur(ront1oetoioetas s2ea(vp;u)arerxfcia1opt  nvi s) 2xr(o no1lmt miei ()sDrmx  ;t0tltoio3iaslmDrlu p;(4aetoio oo1fa e ies;s  etrim3iudomt mfvs sfarur(  no0aetnmo3tadls2eln p () renxf3io1opD lnvi;t seur(r ny1ol   fcsas)arumx  ;t4tlt  oeildla2rm( o (0 lxomo3tytfpDrlu s s)trurxm3ou1opte ivilt a2umu  nt4aeto i3iydla umnvs (0aexnif3oadfm ran o t0 2tr(mpoydomee feta(fa2tm(r oo4alen i3iydfm em( o u)teerir3iydoa  aivs ()trtoxm3ou4ol   nviasfartmurp;o1tpxn feildfs rau p (0aeenifctytoaD anes s0trxoio3no4al nlfvs ( sDrm(r oo1tet  i3ild s rauvs;t)tetnir tatomD luvs s0teumxopiy1amt lncil()arrau  ot1olto i3ils a eaumo;(4alxrio3oo1la   ivs;t0 2xm(opny1lmeelneil(fa2rr(r nt4ole moeiytfs2um( o;t)teeomf iytfaD lu i (0trtrxo3no4lm  mfct () 2tmurpot1tlto ieildfs emump (0altrmf tytlaDelnvo (0srur(rpou4ome mfci t  Draxmo;t1ope miciltfa2uanvon(4altrioctatlmtelnvo;s0s2uoxrpiy1lmtnlfcils  rtax  ou0teeo ietldla ranmont4aeeoir oatomDraivi;( s2urio3nu4alt  nct (faruru pnu4alen ictadlmDran o;t0tltrio3iatla  lnvsls)srxrir iodlmen fesls) 2tmxm no0texoii3ilslm rlnvo (0arxrmo3oytfpteauvi;t)trxr(m oo4lm n fei tf 2umx p;t0olt ifciltfa emnvonu4altrxo3iy1la e ivi;()srtrirpiy4lpte fesl() rtmurp;o0opx  fctytfmDea(mon(0trxomf tadop  aiei;(  rxo(rpoy1omen fvilt) Dur( poo1tlto feiasfsDrm(vpnt4texrir oytom  au olt)s2xo(mpny4lpee ictas) 2rmxmpnu0oeeomfeiytfsDrl(mo (4arenio tydop rluvol( teuo(r3ou4ameemfcta(f Drrurpnu1alt mietat sDuanmo u0aeenir oydfat lieo s) 2tm(r no1lm e ncsltfs2tru onu0aptniictlsfa2rlump t0alenmo ta1laDrauvs;( trxo(m3iodolt lictltfs2rrx  ;u1tlto icildfs rlu onu4altomo3todfm ean ils)t2tmir3nudlm  mfvs t sDum(rpoo1teeo ictlsfa uln pnt4tltnxociy1lmD  ivo;s)trxoxopiy1lmtn fvtas  2urumpou1texomf3iys sDra( ont0tetnmf3ta1fmDe ies;s texo(o oo4altnmnvs (fs2rmum oo0tet mfetltls2ul( on(0teeomr tadomt lnvils0t2umxo ou1om n ncils aDur(ro;u4olto octatfm rmums t)alxrxrcoy1opt  nvs s) 2xm(r ny1lpt livs s)s2ur(m ;u1aptomictldfmDranmpn(4trermfctotomDeauvo ( trtmir3nodamtnlfeta(f 2rrxmpno1oee mo3tldfm2eluvpn(0trtomfcoa1faDranvils s2xoxo3nu4altelneiatfsrrrx ooo1ape iieiaslmDrm(mo u0tlxrmocia1la   nvilt0 exo(r3oy4amt miei () 2trx onu1teeo f3iyd mDea(vsn(0trxoir ia1omtraiei s) 2xm(opoudamt mfeilsf ruaxmoot1optnmfetad m2rmuvs;t)texoio3oa1la rauvols  rtmio oy4lpen nvias) 2tr( onu0aetnmfctadfm2ua( o (0tltrmr3iadlate ivs t)trxo(mpiy4omtnmivtl() Dtrumpoo1alt ifeiadfa2rmnvo;(0tltnio tatfp   u o t0 2toirpoy1lmt  iciat)arra(m ;o0oeeo oeilsfs umuvpnt)teeoxr to1fa raiei;( sexoiopoydamtelfcsatfaDrr( ooo0tee ii3ildfa2um(vs t) lxnir tatfmtraieol() 2uo(m nu1lleelics ()a2taxr ou0altnmo3ildfs2uauvp (4 rxrxo3iytop eauei;t0 exmxm3iy1am  mnvt ( srumump;t1aetnmf3ildls2em( s u4 lermf3oytfmDr ivo;s) rurimpoudal  mfesl() Drm( pno0tpe mieiatlsDul( on(4aeenxf3oytomDraneslt)setmxopnu4ale  fvt t s2rax  ot1tlt mf3tldfaDea(vs (0artnifcta1oatrln ol()tetoxr io1ole livi s  Dta( pou0tlxoioeiysfm uanvp u0aleomrcto1oatr uesls) rumxo ou4om e nct t s2taxm no1opxn octas s2ea(vs t)aetrmr iadfmD ai i t)s2um(o3iydal elnetat)a2rrur ot4tpt ioetasls2el(ms () rxrmfctytfat  ivolt0 rxo(m iodlm n nvsl()s2tm(mpnu0tltniictatfsDrlnvp;u4areoxo oytfmD  nvilt0t2xr(r oy4ole livsas  Drmxmpnu0aet ifciytlm2ra( s;u4alxnxfciatfmtr ivs s) rum(o io1ol e ivtltfsDurx p;o4aeto i3iydlmDran s t0trerir3oatfpDeln i ()srur(m3io4ame  fvi tfs2rruro;u0alx mociytfm2rm(mo;t) ltrxrcoytoa rluvol(0teumim3ou4alenlnctasfaDuax  no0oet  o3tltlmDul( p t)teenio3iodomD  ivi t0t2xrir nu4al n feils) rumx o;t4texo fetlt m elnmo;u0trxrxfciotfaD lnesls texrir nudlme lfvsat)sDumurpou1tlen fciyd a uau pn(0alxrir3oy1lm   nvs;s) rtmxr nu1apenlieslsf Dtm(mont0optoiocias a2rl( o;t)trxrxociatfptrauvils0 exoirpiudapen ivi sfa2ta(rpoo0optnmoeiyt aDrm( pnt)aeeriociotlp  lnvilt  2uoxm ny1ale  feia()aDumxmpoo4teen oeilslsDem(mp u) eeoirctadfmt aueo;(  2xoxr3ny1aptelicsltfs2rrumooo4tpto oetatfm eanvp;(4trtrmr3oadfa   ivo;s0 2tr(rpiy1olenlfeta()s2trxm no4tptnmicilsfs rmnvs;t4trxrio ta1lp rln i;( sruoim iy4alen nvtat a2ra(monu4tpeo oeiasfm um(mo u4 ltrio3io1la e n s;() 2uoir3ou4ope  fctas)aDrmxrp;o0tlxn ietld a2uln p;u0 ltnmr3oa1fm ean sl()srxmxo io4ap nmnctatfaDrm(m ;u1tpenioctyslsDra( s t0artomr tatla ran i t)s2toirpiudalee fviltf Drmum oo0aetnmfciat s2uan snt4altnxo3tadlpD auvs;(0trurxopnu4olt lics s)s2umu pot4alx  oeiydla rlumpnt0 lenmo3oo1fat luvil(0sexoiopoydllenmfesasfarumxr ;o1tltnmfcilslmDeanmpnu4 rxnxf3oatfpD  nvil(  exm(o3oo4ame livsat)sDtrx p;t1olt  ietls s2um( p;u4artnxfcoodfaD au olt)s2urxm3iy1alt  fvslt)srrmum ;t0tltnmfctysfmDuauvo;u)trerxo iy1om rlivsls srxrir3ou1ap   ncils sDrm(monu1tex micias m umu p;t4alxoxr3oy1fa ranvilt sexmio3oy4lp nlicil(  rrrxmp;u0aptoii3iytlm eauvp;u4tltrxfcta1opt  n o ( t2xm(r3nodom  mncias)arrmu poo1apeomfctldfsDea( snt) leoxf tytlaD aues;t)t2trio3oy1amtelnvslt) Drmur nt0oltnmocildfmDel(vp t)altnif3todfa   n s;t texrxmpou4lp n nviat) Dtrxmpoo1apto fetad mDem(vsnt0trtoircoy1op rau il(0texmim3io4apt  iet (fa2tm(m ;u0olxn oeilsfs2eauvs (4alxrxo iodlpt  nvslt s2xoxmpoo4om  lfeils aDumum no0opt ifciys a rm(vp (0tetnxf3iadoptraieil(0 etrio3nu1lm n nviat a2ra(r nt0apenmociasfmDrmn ont0arenxf ootlaD an i;( t2xm(r iy4oleemivilsfsrra(rp;u4tet  fetytfs2uln sn(0 etrircoodlp rlnes;()s2tm(m no4lm  livi () 2umxmo;u1opeomf3tasfm2umn s;t0tlxoxfcto1faD au i;s  rxoim nudaleemncs s a2rmu  ;t4apto oeiaslm rmnmsnt4aexnxf tatoate uvilt)s2xoxr3iy4lme lncsls arurxmooo0texoioctyslm2rmu o u) exnio tydfatrluvslt0teur(r nu1alenmictlsf Durxro;u1apeo o3iadls ulnvo u0tltrmo oa1fm eanvilt0 2umxm iy1lp nmicsltfs2umump;u4apen feiltlaDel(vs;u4arxoif oydlm eanvol( trxr(r3iy1lp   fesltfa2urxr ou4openii3iatlsDelnvo;(0 rxnmf3ta1fp eaneols tetmxm nu1lme  ivtl()a2ua(mpnt4opx mi3tad a ua( pnu0 rerxo iy1omDelivsls)s2tm(o iy4omtemfvt s srtmxmpou1alxn ocild aDra(mp u)aetnxo3ootoa rlivo;s  2xoxo3ou1lle lietl(fsDrau o;o4olxnmi3iadls2uan s (0aexrxf iadfptr ueolt0s2xo(o oo1lm emnvilt)aruau oou4teenmoctys a2ra( s t4alxrif3ta1omt  u s t s2xrio iydal nmfesas)s2tmxrp;u0opxoifciyt m2ranmon(4 etnxr3todfpD aneol()s2xo(m nydoptnlnvsl()a2rmxmpnu4tpto f3tlslm rmuvsnu) etnif io1omD lnvo t) 2tm(r3iy4opee nesa(  rtrxr ;u1oeeomoctyd m ul(mo u)aexomr iatfmDean il()tetoxr ny1op  lfctlt srrrumpot4tet moeiasls em( snu)texomo iotfpDrai i t0s2uo(m3nu4lleemfvsl( arra(m nt1alt io3tadls2eaumon()aexrifcoa1om ranei ()s2umxo nodalen fetas srurxmont4opxn o3tltfmDeanvp (4 exnio tytom rauvs;s  exrio no1omt mnetl(fsDtr(  ;o4oex mociasfaDumuvpnu4tetrir3iodopDe neo s0 2toxm io4oleemicils)aDtm(r no1tet iociatls rl( on(0texriociodlat lnvslt s2toim oy4optemnvi s)aDraump;t4tpxnmfeildls2el(mpnt0alenxf3tytlaDrlivo;t) eur(o3oy1lmtelics tfs2ra(m ;o1aexnmictysls2el(mpnu0trtoio3oydlaDrlieil(  2trio3no4lp  mnei s arumx  ou4teeoio3tys sDuau o (4 etoir3oodlp r u olt0 ruoxopnudll emnctlsfarraumo;o4aeeomicild s emuvs t0aetrmr3tadlpteluvolt)tetmxm3io1oltn nvilt arra(m ;o4tle mo3tasfa2rmnvsn(4arenxr oa1om   nvs;t0 exriopio1ol  lncsls)aDur(  oo0ole mo3tys aDua( ont)tetomocootlmDeln ils  2ur(opoy1am nmfet tfaDtr(rpnt1aetn octld sDua( onu0trtoifciy1om  auvi t) ruoir3ou1apeemici (f Dtmur ou4opxoifetadfmDemu on()arxrxr3iotlmDran i t) rto(r3iu1op emnct s artmumpot1oet  i3tasfa rmump t4aexrxf ootop  luvi;s0s2toxm3oy4ol nlnvtat)s2ta(mooo0tlen fetasls2eaums;t) rxomf iy1om  aivsl( setm(r oodale  ivi tf 2tmxrpou1tlxomiciyt a2eanmsnu) lxrif3tytfmtr i i;(0sexmxo3nydalee nvsat)aDrau poo4tex moeiatfa rauvs t0alenxo ootlaD lies ()srtoxmpoydome mneil(f rua(  ;u0alxo fciydla raumont0aexomfcoatlatelivi;s)srxrio iu4lp n iciatfartr( poo4ope if3tysla2emn o;t)trtrmfctadom   n sls tetoiopoydlptemicta(fsrta(r nu0tle  f3iaslsDeln snt)trtnmrciotfp  li slt0 rxoxr nu1amtnmicia()s2rruro;u1tpxnmf3ildlaDuanms u4 rxrio tytopDelueols0trxmimpiydaltelfvtlt)s2rmxmoou1tlx  i3tatlsDulnvont0tltnxf3tatfat aneilt0setoxr3no4opte iesatfaDur(ro;o0oexn oeiad m rluvonu)trxnio3oo1lmteau slt0tetr(o iu4ol  lietl(  2tru p;o1ale  ieiatfs ua( pnt4 ltriociytlpDeaneslt s2trio iy4altn fesl(  rrr(mpou0oltn feiad m ul(mp t)alxnio iadomDr u i s)s2to(m nodomt mivsl(faDuaxr ot0ale  ieiyd m rmn s u4 lxoxr oy1lmtr iei;(0s2umxr ny4lm emfesl(fsruaxmo;u1apxomo3tatlmDuanmsnu0tetoxo tadfp rluvi ( t2uoxm oo1ll nmfesltf rtrxrpno4tlxnio3tydls2ra( on(0teeomf tytla e u i ()s2xrxo3oodalt  ncsa(fsrrmxrp;t0oexnmoeilsfs elumo;t)areomo3tatoaDranvo t0setr(m3ny1om  miet (f Dur(rpnu4ape mfetas sDua(ms u)artomfctotfmDelivo;t) 2uoxm3oo4omt  fctl()sDtmx poo4oet mf3tldla2emnms;u4 rerio totfmDrau ils0texm(r nydoptemieslt  2raxmp;t0optnii3ilsfaDulnvo;u)alxnir oytlaDrauvi;( s2urir io4apt lieil(  2taump;o4tpto fetyd sDra(ms;u0tlxomr3tytfm rlieslt)t2tmiopoo1lpee ivsl() Drr(mpot1olx  oetlslaDrl( on(4trermf oadopt  ivs;s0t2uoxopiodaltnmivtl()arum(m no0tptn f3tyd sDumn o;()aeerifcoodlp  li olt)sexmxo no1ole livs tfartr( p;t4apxnmictysfaDrm( o;t4aeermf oydlmD livi ( sruo(rpiudop  micilt  rtau o;u0alto fctlt s2uaumont4 rxomociatfaD lnvs;s sexmirpiy1lmtelnci t)a2urx  nu4tet ifciasla rmu s;(0areomfciotom e u o t0s2tmio3oo1ap nlfcs tfarur( p;u0aeen f3iadla eauvsn(4aexnxfciodlpDelies;s s2ur(m io1apt mnet t) Dtaxmooo1tptomo3iasfm2ea(ms;(0trtrmo3oy1opt lneo;(0setrir oydoleelieiat)arrrurooo4opxn ieiys s umn s u4 rtomfctatlatrau s s s2trimpoo1op   nctltfaDurump;o0ope mf3iasls em(vpn(4 etrmf ootlpDr nes;(  2ur(o3ny4ole lnci (  Dua(m ou0tpx mf3ilt s ea( s u)arxnir tadlaDranvil( srxmxr oodam  mfvs () rrmu  nt4ole ioeiys a2ulumonu4 lerio tytomte u i;(  rtmiopoy4apt lnvil(fs2tm(ro;t1aetomictadlmDea(mo t)artoxo3tydfaDe nvilt0sexrirpiudop e neias  Dtrxr ;t0oeenifcildfa2ean pn() lxnif iy1lmDeai ils  rurxo3ny4omee fei sf rrmx onu0tlx mieiadfsDeau p t0tltoxr tydoaDrau slt)tetoir3io1op nmneiat)s2umu  nu1aet ifetyt m rln p;t)arxoir tydlpDrauvs;t) eto(m3oo4omee ncsl( sDumx  oo1tptnmicilsfmDeanvsnt4 lenir3iadoptran o s trxmim3oydomeemics s  2umuroou4olxo i3tls a rlums;t4 eerxo3ta1fptrln ilt trto(o3ny1amtemneta(f Durxmoou1oeeomicils m2uanvonu)tetrxo3to1oateau i;( t2xo(o oo4lltelfvtl( sDrmx pnt4oleo o3ildls2emuvs t4 lerxr iytoat auvol(  eum(o no4ale  ictat s2trur nu1olt mfciatls2uanms t4 renio3totlpt  nvi t s2tmio3io1am  lnesasfsrra( o;o0tpeniietyt aDrlnvs u4arerxr oydfa r ivs s trxo(mpiy1al nmictas) Drru pnu0tlenifeilt a2ranvpnt)aetrio oy1lm raues;s s2xo(opnu4alt mivs t) Drmxmpoo4tlenmfetyd aDrm( o;u4tltoir ia1oateanvo (0t2um(opoo1ap e neia( sDrmx o;t0alxnif3iyd s rl(mont4arenxfcoodfptelivo ( trxmiopoo1llee iciasfaDrm(mpoo1tlto f3tytfaDemuvs;()artoif3tatom  aneil( setrio3iu4lm nmies s sDrrx pot0olx iociyslsDul( snt)artoif3iadomt livil( tetr(o3oy4op  lneia()s2ta( ono0openmieildfa eluvo;t0tleoxf oa1lm elu s;(0teurxm oydopee nvia( s2ta( pot4ope  f3ildfsDrln sn()tleoircoo1lmt ai ols0t2trim3io4ameemnvs () rtru pnt1teeo i3iadls el( p t4 etnmrcoo1lpD  ieo;s truoiopoy1omtemivil(faDtm(m nu4opt ifciysls eanvpnu0tltomocoodlpDe nesls0t2uo(r3oo1apt  ies s) 2taurono1texoii3iadls rmnms u)areoxr3oodfateluvil( t2xr(r iu4oleemivsas)s2ur( pnu1opxniictlsfmDel( pn(4 lxnir3ta1fatr u i s0truoiopoy4lpt mivi (f 2raurpou4tlen feiltlm2ulumsnu4arermrctydla rauvs (  2uoirpou4ol  lnct tf Dtrxront0texn f3iat a rluvo t)altnmr3totlm rlu il(  2uoim3ny1lp elfeias sDtaxrpoo1ape  f3iltfsDel(vpn() lxrxfcoa1lptran s (0truo(o no1amt lncsa() rrmxrp;t1oltoiicild m2umuvs;t) rxoif totoatranes;() 2xoxrpoy1al nmnct t  Dur(r ou4oltn octydls rm(mo;t4alxnxr ia1fpDe u olt  exoir iy4om nlfvil()s2tr(rpnt4tee  ictasfm2eaumont0trtrir3iotfmD an ol(0t2xoxm3io1lme livsa( srurx p;o4teen o3ias aDemuvp (4artrifcoodomtraieslt0t2xr(o3iu1ap  mivi s) 2tru ont0apt iiciytlm rm(ms;t4 reoxr tatom rluvo;s  rurxm3iudalenlnvtls  Durxr no4tex if3tydls2rlnvp t) exnir oy1omDr i o;()tetoirpiodam nmietlsfartr( ooo0oeto feiyslmDra(mp;(0arxrmociodlmtelu ilt) euoir oo1amenmfcilt)srtaurp;u4tptoiocilsfs ea(vsnu)aetrifcty1fp eaiei;s0seuo(r3no1lp nmivil()a2um(  ou0tlto o3iyt aDumumo;u4 etrmo3iadomD lu il( texrxr iy1apeemfct s)sDum(mpoo1tlx moeilt aDuln p;(4aetrmo3oytlmtrlnvilt)seurxo3iu1llen fvsa( a2rmumpnt0tpxn o3iat m ul(ms (4 etrmo3io1oatr u o;s) rtmimpou1apeelfetat  Dua( oot0oexoiicildla2rlums u0alxrxoctotoat aivi ()s2toimpou4opte ieta()srrau poo0oleoioetatls2uanvo () rtniocoatoaDraivi t)t2umxmpno4am n ics tf 2ra(mpoo1tee ii3tltfa um(vs () rermrcty1omteaieo;t)srtoir3io1lp n fciasfsrur(ronu4oetomoetyd aDeln p ()tetrmr3ootlmD luvsl(0s2toxm3no4lmenlictlt)arraxmo;o4tpx  o3iyt sDrl( s;(4artomo tatfaD  uvi;s) rurir io1ol nlfviatfs2trum ou0tpt mieiatfm rau p;(4 rxrifcio1omtrluei s0srtoxr3nudop nlnvtlt sDtmum nu0aptomf3iasfs umums ()trxnxr oatfmt lnvol()s2xoxm iy4op n ncslt  Durum oo1tpe if3iadls rl(mon(4arermo tadomD  uei;s t2xmimpny4alt lneils aDrmxmonu1aeen fctydls2eanmp (4 exoir iadfm  aneil(  etrxm3no4omtemict t)s2trurpot0tlxomieiytfm2rluvp t)tleoifctatfpteanvs s) rtoxmpoo4oleelneia(fsDtr(rp;u0olxniociysfa2um( o t) eeomr tytfaDr iesls0 rtm(m iy1altnlneils  2rmu ono4tee  i3ildla elu p;u)trxrxoctadom eanesls srxoiopio1openmies s)aDraxrooo4opeo ieiyslsDrlnvs;t)aexoif iodlmDraieol( t2to(opnu1opt mnesatf rtr(r ;t4tpxoiocias s rlumonu4trtnmr iadop ran i;(  rxm(r3io1olenmncsas sDtrxro;o0teeo o3ilsfm elnms (0trenir iadlp  lu o;s0 euo(m3iu1amt  nvta() Dtaum no0opxniietytfa2rlnvsnt0 lxnxrcootomte nvo (0srxmxrpnydop  lnci t srtr(mono1apt mociadls2ran o t0trenmociytlaDeau ilt s2xoim ny1ap e ivsl( sDtr(mp;o4tleomfeias a um(von()aexnmrcoo1lp e nei;s)trtoxrpiy1ale mnvias) rtaxrp;u0texo feiasfa emu p;()tetnxfctatlaD  uei;t truoxr nu1lmen ietls)srua(r ot0ape ioetasla ran s;u4treniocoatfm rai o;()trtm(mpiu4lleemies s)aruau ooo1oleomf3tls a eau o;()arxrxociotlmt  iei (  exr(r3ou1lpenlfvt ( s2tru  ;t4tpen feilsfsDemums;u4alenxo tadfat an o;()trtmio3no4ome mnei s) rtmumo;u4olt iieiadfs2ulnvont0tetomo oa1fate ueo t0 2xrxo3no4al e neil(  rua(  ;u4tee  ictad m rlnmpn()arxomr tadfpte uvo;s  rxoxopno4lle mfesas)sDumxrooo4olxoii3iat sDulnmon(4alxoirciytomD ln s s t2toir iy1llen feiat srrax  ;t4alxomfetlsfaDrauvsn()tlxomocoatoptr ues ( texrxopiudom n nesl()aDururp;t1oexnifetydfs rluvo;t4arenif todfa elnes;s)tetr(mpoy1apte ici s srraxm ot4oee mi3tatlsDeauvpn()areomoctydlpDraieo;s) rurirpnudlpee ivsl(fartrxmp;u4apeoifcils a em(mp;() rxnmocoydlm rlivs s0tetoxrpou1llee feslt  2ur(mpnt1teeoif3tyd aDum( pn(4 rtoio3ta1faDraivilt0 etr(mpoydamee ivi t) Drrxmoou0altn fciytfs emums (0aetoxrctytfp  luvi (0 2ur(o3no1alenmneslsfaDta(mono4tlx mfeiad a umn pn()artoircoodfmDeluei;(0setmxopnodllt livi s a2tr(m ou4aptniietydfa uluvo t0texrmr3oo1fpD an s s seurxmpiy1apte icsa( arumumpno1oex iieilt s2rmu s ()tetrir3oadfpt au olt  rtoimpiydol  mnctas  rrm(mpnt4oee  fctltla2ea(vs u)aeerxrctydfp e uvol( t2um(rpoydolt  nctat)sDrmu pnt1tlen oeiydfm ra( o;u0altoxo3oytlatelneo;s0 ruoxrpny1open nes s) 2rmum oo0apx  fctadfa2ranvpnt0trtoxo3tatomte ies s)seurio no4lltnlfeias) 2raum ;u4tltnmieiyt s2elu o t0tetnxrctodopDrai i ( t2to(rpou4ll emfvta(faDua(ro;u4oet mf3ildls2ul(vs (0artrmrctotomD liei;s s2tmxr3iy1lmt mictatf 2ua( oot0oltnio3iadfsDumumsnt0 reoif to1faDr uvo;s)t2ur(m oy4lpen ivtl(f Drm(  oo4alx mfeias m ea( s;t4altnxo3oa1oat anes;t t2xrxopoy1ap e net t)srumuront1alxn ictysfsDelumonu)texnmr iotla  aueils)t2trirpoy4lpte ieils a2uru oot4tltnmfctat aDuan pnt)aleomr3tadomD  ivi s) ruo(o oodapenlfcsltfsDta( o;t4tpe mietyt s rmnmonu) lxoxr3ty1lpDr ieol()srxoxo3oydapee iesat)aDuaxmpoo4oltn i3iadfaDul(vp;(0tetniocoo1fmDeli il( trur(rpiodlpen ivsl()a2urur ;t0aetoiieiat m uanvp u4tlxnxr iy1la eaneo t s2xoimpnydam  lfctlt)aDrr(ro;t1alt mo3tltlm2um( o;u) rxnio oy1oaD aueols)sruo(m oo1amtn nct t) Dtmxrp;o1opt  ieiadls2el(mo u)tlxrif3oatfm   ues t)trurxopno4lm emfcs (f Dra(r ;t0tex  f3tltfaDrl(vont4alenxo oa1fpD  ivo t0t2ur(m3oydll emicil(  2rmumo;o1ale  f3iysfs ul(mp u4trxnxocta1fpDrlnvi;s0 exrxr3iydaltn fvilt)sDraxrpnt4oexo fctad a2ulu p;(0 lermo tytla elnei;() exrxo3iy1opt mfvtl() rurx p;u4opto f3tas m2ra(mp;t4tltrxr iodomD auvo t srxrio oy4lleelies t s2rrxro;o1tpxoii3tydlaDua( pn(0teermf3tydfpDe n il( s2toxr io1omenmnvs tf 2taxr no1alxnmo3iytfsDrlu p;() etnxr3oatfp rln i;t)s2uo(opou1oleelfetl( a2umxrooo4opxnmo3iasla2elu s;t0 renmfciatoa e neilt0trxmim no4amenmfcsas) rtmu  ;u1oeenmfctadlm elnmo (4alermf3ia1oaDe uei;( t2trir iu1amenlivsltfartm( onu0oee ifciat s rlnvp t4 eermf ty1opD  ivo;()tetm(r3ou1amt mietasf Dta( oot4tpxomoctldfm2elu snu4artrir tytom rln i (  2xrir3io4ap nlfcslsfsDtm(rooo1alxo fetltls rln ont4arxomfciadomDrlnvolt)t2urirpno1lme  fetl()sruax o;u0tet  ieiatfm ua( o (4 etomrciy1la e u i;s)setmio3oo4ll nlnct tf Draxr oo1aexniicilslm2uln o t)artnxr oadlptrlu s;(0trxoirpoudomenmnei s  Dtmumono0opxnifctys m rm(vp t4 etomf oa1opDeliei t) 2xoxopou1apt lncsl(fs2trx  nu4tpt  fcilsfs2um( ont)texoxocoo1faDrlivil()seumio nu4ole miei sfsDurxrono0olx  ietltfsDuanmpnt0 rermr ia1fatrliei;t  2ur(o oy1ll elnvt (f 2ur( pot4tptoioeiyt a ul(vp u) lxnxrciatlatrlnvolt) 2xoxo3nydlm   nvsl(fsDrrumpnt0tlxn oeias sDul(mp;t)trtrmrciatop eaiei;s  2tr(r oo1ope lfcilt aDtmxmp;t4apxnmiciytfs rmuvpnu4altoxo oatfateanvsls)s2xrxr ou1olenliesas) Drmx  ;u1aptn fciatlm emnmo u0tltrif io1fm ranes;t  rurir ny1oltn nct (faDrmu  ;u4tltoioeias sDum(ms;t4 leomrciadop raivslt0texm(o ny4lme  ict (  2uaumpnu0tetnmieiysls umumpnt0 rxomfctydlp r nvs ()srxr(o nydllt livsas)a2tmxr ;t1ape ioctytlsDumn s;t)trtnmociatop eluvs;() 2tmxm iy4opeemncsls) Drau  oo4oeto ieiyslmDrlnvs (0tlerircio1lm eanvi t)s2umio iy1aptemivi ()sDua(r ;o0tlxn ieiyt m umnvp;t) rxrxo oa1la   ies s)srurimpny1alt  netlsf Dtmxmpou4opx  ieias a rlnvs (4tlxoifcia1lat aivols0trtr(m io1ameemieta( s2tmurono0aeeomfcils s2elnvp ()trermr3oydlatrlneo (0tetmir ny1al nliet s sDrauroot0olenmfctlsls2em( o t4 rtrxocoodlp e ivo (0srxrim3oydam  micta(fsruax  no0olxo ocilslm2um(msnu) rtnio oy1lmDr i s (0setm(r no1optelicsa(fa2tau pot4apx  ieiat a eauvs t0tleomr tadomDraieilt0texr(m3oo4alt lieilsfsrrau onu0tptnioeiyslsDuanvp;t0areoxf3iodfp r nei;(0trxr(r3no4lm   feiat aDuaxrpnu0tptoioeilt aDeauvsnu0 exnxf3ia1fa eauvsls)teto(opny4lme mfvsl() Drmu poo1tex mietasfa2rlnms t0 ltnmo oydlate u s s)s2uo(mpnu1ole  fcils)sDtmurono1aex mociyt a rm( onu)arxomrctodoatrau o s)trxr(o oy1al nmnvt (fsDumumpou1aex mfctas m2um(mp;u)tlxnxo tatfpD  ueol(0 rumxrpio1lp elfetatfsDuau p;o1opx mi3iadlm2ea(ms;t4texrmr3iatlatelueo;s s2ur(m3ny4am   fctas arra(moot1olx  iciydfa2rlnvp;(4 lxrxfcoa1fp r i i;t) rumxmpno1ale  ieias) rrmu oou4olxnio3tas s2umumo t0teenxo tytoa rliei;t srtrxrpiu1am nlnvil(faDrrx  no4tlen iciaslsDra( o;u4 exnxfcio1oaDrlu s;t sexrir ny4amtelfctas aDumu  nt4opx  ictlsfs el(vpnt4altnxf iotfptr nvo () 2trirpou1op e nes s s2taurpot0aeenifctld m em(mo t) rtrxo3oatomtrluvo s0 exrirpoy4lltn nci t)s2tmuront1tex mfctlsls uanms t0tlerircoo1faDelivslt srur(o io4apeelnvta( aDtmxmp;t4opt  o3iysfaDrauvp;(0tetoir3iadlpt anvsls  2trim3oo1om   feilsfaDuaum no0tex moeiytfs elnvp (4tlxoif3oo1latr ivi;() etmxr nydlmen ivs ( s2rax p;t4aee  ictadlmDelump;(4 ltnmocia1opteaivs s0 2xrxrpio4am  mfvsl(fsDta(mont4alxn f3iydfs eaumont)tltrxr tadfptrln ilt texr(r io4al elies t) Drrxm ;u1aet io3iadfm2eln s t) exrifcoy1lmtr ivs t s2uoxo no4lle  ivsat)srtmurp;o0ope  i3tyd sDrmnvo;t0arxrmo3todfp eli i s  2xrxopoudamtn ncs () 2tr( oot1apeoiieias sDra( ont0alxnir3ootlpt  ivs s)srurim3nodol nmfeta(fs2ra(mo;t1oexo fctysls2ranms u)aexnio3iy1lmD luvo t)trxm(opno1ap   fci (  Drrxm ot1aexn ieiytlm2ulnvsnu0 eeoxrcto1fm  lu sl(0t2uoir iu1oltelfci ()aDtm( pou4olx ioetltlsDemuvo u4alerxo iodop r i s;s srxmxo ou1al   ivt tfsDrru  ;o0olt io3iasfm2ulu pnu4 rxomrcoatop  liei;s tetrxo3oo4ap   ivta( sDtmxm nt4aex iiciadfs uauvs u4 renio tatfp  lnes;t trto(rpiu4alenmncsat  rurxmoou0aleomfciysfa eln p;u0texomo oo1omt  uvs s)trtrxrpiy4openmieta(fs2taum ;u1tlx mi3iyt aDumnmsn(0tltnxf3totlpDeaneo t0tetrimpoo4ape lfesa(  Dtrxmpno0apxnifciyt a2rm(ms t4aeermf3iydfm   ivo s0t2urio3ou4opee ieils sDrmurpou1olenio3tltlmDem(vo t0altnmo oatfat  n i;s0 rum(r nydlltn ici sfa2umx o;t1opxoio3tat a2ranvo t0trtoifcoatlp e i ils) rtrxm io1ale  nei sfaDtaump;o1open ietyt a2rlu onu0areoif iatoateluei t sruoxr3iu1oltemiciat)artmu onu0oexnmoeiysfm uln o t0artrircoa1latrlivol(0s2xrxopiydom n ies s) ruaum ot4aet mf3tas m2umnvon(4arxoio3iy1fmtrlnvs;( s2xoim3no1omen ncs sf ruaumonu1alx  feiysfs eauvsn(0 eeoio oa1optraneil(0tetoxr oy4ap  lnctatf 2trur nu1aex mfeias s2eluvp u) eeoiociotlpt an i;s0t2uoxopiudol emncsls) rra(rono1tpx  fcildfm ran snu4 etnmo3oatfm ranvo s t2xrio nu4ale lfcsa(f rua(root0tpeo oeiad m2ranmp u4aeermf3iadfp  au o;() 2to(mpou1lmeelnetlt)aDumxrpno1apxnmo3tytfm emu o;u4 leoxr oo1lmtrlu i s) exm(r3oodalt lfvtlt)a2ta(mpno1alt io3tyslm ra(msnu0texrmfcoatfpDeliei ( s2uoxm3nudlle lfeil(  ruaumpnu0apxomietlt m2rm(mo u4 eenxo oytoptrlnei s seumimpiy1lmenmfvia( aDuaxr ou1teenmfetaslm elums;() ltoir3tatfa e uvils)trur(m3ny4ap   nciltf rrax p;u0teeomo3iatlm rmums;t4alerxfcio1lptr ies;(  etm(mpio1op  lfcil(  Duaumpot1tltn i3iad a umnmpn()tlxnxoctodomDr neol()teuoxm3oodomtnlncsas) Duaxrp;t4opto f3tadfmDua( pnt4altoxr iydlmteauvo (  rxrxr3ny1oltemict sfaDtru o;u1tpx  fciadfm elnmp t0tetnxrcoydlpD ln i s sexoxm3oodop e fvt (faDua(mono0oee ioeiltfs2ulnvp u4aexoir3tytop e iei;(  exrirpoydoltelncilsf Drmxrpot0tlenmociytfaDumn ont0trenir3tydfpD livi t)srum(r ny1olen fviat aDtmx  ;u4opxomoeiatla rlnmpnu4 renmr ty1lpt an o;s) rur(rpny4ll nmfvi (  rtaxmp;t0texn ieiys a umnvo;(4 ltrif3tadfptrln s t trxm(o oudam  mneil( srrmx ono4tle ifetydls umnvo;u4altrxf3tydlmDeln i s)truoxm oo4al elfct s  Dtru oou4oexnmfeias s ua(vpn()aexoir3totla rlivs;s0trurimpnu1alt mfvsat)aruaxronu0aet moeiadla2em( onu) lxnxr oo1fpDeaueol( setm(rpnudomee fvilsfa2tr(mono0ole mo3ildlm rmumo ()treoxrcio1lp eln il() rxrxmpnu4lm  lfvslsfsrrmur ;u4tet  octadlm2rlnmpn(0trxoxf3oodoptelneolt)trxoxo iy4amt lfvs tfsDraxrp;o4ole mfctatlm em( p;() eenxociodlp e nvs (0teurimpnydoptnlivil(fa2umu ooo0tlt mfetltfa2el(vo;(4 rtoir oytlmDeaivs;t0s2xr(o3iu1am  lnet t aDtm( ont1apxniocias s umuvo;()aetnxf3iydfmt  n sl(  eumim3oodol  mieilt) 2ur(ro;t4oleo fetldfa ul(vs u) rtomfcia1omteai s t s2urxr iodlmtnlfei (  rur(mp;t1tpto o3iytls2umu p;u0 rtnif3iydomteli o;t t2umxmpou4oltnlnci (fsrurxrp;t0tpen ictld mDrmnvp;(4aexrio3oa1la rlivsl(0 2urxr3nudape mivia() rtaxr nt1tpxoiiciat m ea(mp;(4tltrmo3iotlpteli sl()srxoxmpiu1ap   nctasfaDuaxrpnu1tpxoii3tldla rl( s t0tltrxr3ia1omDeau i s)texrir3oudlpte ieiltfs2tmumont1tet moeildfm2umump;t4 ltoxf3tatlm   uvol(0 rxr(m3oo4omt lnvsas)s2rauro;u1ape mieiat m2rau s;u4 lenioctatopteanei;s srtm(o ou1opee fes sf rumum nt1open iciatlsDulnvonu0teenxocoodla ran o;s trtmxrpno4amt  fvi tfa2taurono0openmo3tltla2ra( p t0alenmf3tatop rluvs;(0s2xm(o3oo1ll e fvsasfartau pnu4tpxo i3ils mDemnvp;(4 exnio ta1fmDr n s t s2xr(m3oo4oltn fes tfsrurxmpou4texomo3iad m2rl( s u0tltoio ia1lmt  ieilt s2tm(m nu1om nmnviat srrau pou1teto feiydla2elnmont4 etoxo oydlp ran s s) 2uoxrpoodope lnes sfa2tr(ro;o4tpt  feiadlm2emuvo;t0tlenxr3tadfm  lu s t0seuoiopio4amtelncs (f Dra(rooo1tpeo f3tytfm rmnvo;u)trxoxrctadlm rlueils tetmxo3nodop nlfcilt  Dua(mpot0apt iiciydfa2el( p t4aexoxrcta1lp  ai i (0 rxmxo3nu4lm nmnvtatfaDta(mp;t1oexo ietysla rluvs t0altnxr oa1lmtraues;t0s2um(o iudlme mfvt (fsDtrxro;t4tle mieildfa umn sn(0 rtoxr3io1lp e uesl( t2tmxopiudoptnliet tfa2trx oou0altnmi3iyslm rmums;()altnir io1lm   i s;t trxmxopiodll e ici t)aDrrumonu1oeenmi3iadfs2umumo;t0trenio3to1lmDean il()s2xrxr oudol  licsatfsrta(rp;u1aexo i3iytfsDum( o;t0texrmrctytfa  livsl()srxo(rpnu1opt mnet tfarua(  ou4aeeoii3ilsla raumont0aexrmr3oatlp   ieol(0 ruoxo3no1optn fesls arta(r ;u1alxo icildlaDelumpn(0 etoxf iadfmtr nvols0t2um(mpou1aptelnesatfaDrmurp;o0texn ociasfsDrmnvs u)trxomr3oydfaD  ivi;s0sexmim3oy4omtemivtl()sDuaxmpot0alt mieiytlm2rauvo (4 lerxf3tydfaDranvi;t  2uo(rpnodlm  lncias a2raumoou1tle if3tyt s2rmumpn(0aetrioctatlp rau o t)srxmir3nudoltemfcsas) 2ua(ronu1tlt  i3tlsls2rm(mpn()texomf totlmt li olt)tetm(mpio4apenmncia(f 2rax o;u4teto oeiadls2uan pnt0artrmfciytom ranvs;(0 2umim iu1ap   nci t)arrr(r no1oetomo3tydfsDea(vs u0trxoio3ty1lp r i o t  etmxmpiydale lnvtat)arua(ro;u1oleo f3ias sDua(mp (4aetoir3ia1fpDr ivo (  eur(mpoo4optnmfcilt)a2ra(ro;t0texomoctaslmDrlump u4aetrmfcoatlpDeai o;s0s2tm(o oudolee nctl(faruaumooo1oltn icils a2uanmp (0aexoiocoadlpteau ols0srurio oudamtemivtl(fsDumurp;u4apeo ieiytfm ea(vsnu)texnmrciodoatean il(0 exoxm nodal elfvil(fa2trumpou1tptn fciyt aDelnvo () eeoxr tatfp r nvil()seumim3ou4lp  lfeias)s2rrum ou0opeo ieiadlm ea( p t0 etnxf3tydomD anvilt)sexoio ou1lm e fvtlsf rur(r ou1ale ioctldfa raump t)artomfcty1fm  ln i;t0srtrim3nudome  nci (  rrax pno1aexnmfciad a2rlnvp;t0 lxrioctodlaDrlueil(  eumxm3ou4lm e nesl(faDrmu p;o4tlt  ieilsls rm(ms;t0texoxoctytopDraivslt truoxo3nu4ame mfvs tf 2trx p;o1oexnioctltla2rluvo;(4tlenmr iotfpte iei;(0s2trxmpoy1alt  icsas  rra(mpnt1tet  i3tas aDeauvsn(0 renir3tadfmte nvsl()t2xmxopiudapen ietat) Dum(moot0altniieiatlm eau snu) exnxo3oy1oa  lues s s2tmxopoodol  mfciasf 2rmx p;t4aet ii3iyt mDrmn pnu0teeoif3tadfpDeau ilt trxo(rpou1openlfei t aDurxro;o1tet ioeiytfs2el(ms u)trxnxr ta1omtrlueils tetm(r nodlmeemfvi ()artmxm oo0tltn o3tad aDumn s;u) etnxf oadomD an il(  eurim nu4ol   neil(faDrr(r nu0alxnmocilsla2ulnmp ()tetomfcia1fa   ueols0s2uo(rpny1am  lfvi ()artru ono1tlxnifetyt s em(mo;t4 rxnmoctatla   ieils0sexrio3nodlmtemnvt ( sDtr(mpnu4tlto ocild sDemuvp;u0altrio3oa1lmD  n il(  exrir oo4omt mnvt s) 2rmuronu1olenmiciadfa2uanms ()teermf3totla e ueslt) 2xm(o oo1amen ics ()aDraxr ou1tlt ii3iat sDeaumo u) eerioctadla eli i () 2umir3ou1aleemnvt t a2tmu pnt1tpeomfcild m2ean sn()tlenifciytfa  ln i;s tetmiopoodlm e ictat) Drm( o;u0olxo fciasfa rlnms u0arenmo3tatla eliei s0 2um(o3iu4op e fvtls aDtrxrpoo0oetnmf3iltlaDrmu o t4altnif3ty1op eai sl()srum(rpnu1ol emfetat s2taumpno0ope mieiad aDrlnvsnt0artrif3oo1la   i sls0 rxoxrpiydolenmivsl(faDtm( onu0alx ii3ilt a2ra( pnt4aexnxo todlptr n ilt srtrxopno4lp n fctasfartr(ront1apxo f3iydla emn snu4tlxnmocoa1lm   u s ( s2urirpoo1olenlneilt) 2rmxrp;t0alt ioeiysfs2ulumpn()tetrxo iadoaDrliesls srurxm3iodolee icsltfarum(r ;o1altomf3iadfs ulums;(4 lxnxo3to1om rln s;( tetrim nydll elfeslt s2trx  ;o1tlt  fctlslmDrl( s u) rxoifcoatfa   n s ( t2um(m3io1lme  ncs sfaDur( pnt4tltomoeiasla2ra(vs u0alenmf tatfmDelu i;t) 2xrxr3no1omee net t  2tmx  ;u1texnmf3iadfa2um( p u)tlxrircto1fmt aivi;s0truoxm3oy4al nmnet (  rra(mp;t0tpt  icilslsDrl( pnu)alxnxf iydom elies;s0s2toirpnu1omt mictas aDrr( pnt4opeo oeils a2ul(vsn(4alenmr tadlaDe i o s)t2ur(o ny4lm nmnesa(f rtm( p;t4tpe miciaslaDrmn o ()alxrmoctytfpDe nvilt t2ur(r3oy4opeelncil(fsrtrxm no1aleoio3tysls ran onu)treomf oodlmtrln o t0s2tmirpny4lp nlfct s)srtaur ;t4ope  ociat s uaumo u4 leomfcia1lat  uvo t  rxrimpno1ope  ivilsfs2ra(mpnu1olenmf3tldfs2ra(vo (0trenif oytfpD  ivilt  etmimpny4om nlncta(fsDtmxmo;u0ope  i3tyd m2emuvp u4 exomo3iodlatrlivs;( setr(opny4lp  lfetatfs2uru onu4open f3iatfa emn pnu4tltoifcoo1fmtr n ol(  rtoxopiodapt  iciat)aDrmum no0tpeo fctlt a elums;u) eermf iadom e neo () 2urirpiodlmen fctas)a2rr(roou4apx mo3iyd mDrmump u0trtnmrciadlm eln o;s  exm(opiu1lme  iciatfaDtrx poo0tpt  ociad a rm( p;u4treoxf ty1fmDe n o t)t2xmxo iydlpeemnctl( aDum(rp;o1tptoif3tls s eanms t0texrxf3oo1faDe ieslt  exmxo iydome liesl(fsDtrxront0olt iociyd a ranvp;t0altoxfctadlp rln il() 2toio iy1omtnlncsl(f 2trx o;o0tetomf3iltlmDrauvo;u4trenmo ootfpDelivslt) 2trir oo4ome licslt  rrrxrpot1tptnifeils mDea(vsn()trxrif3to1laD lnvi;t) 2to(o oy1olenlfctl(  rtruront0tet ifeiyd aDum(vont0 eerxfciy1optrlues ()srtmxr nodamen ivsl(faDtrx pnt4openmf3iadla ranvp (4 rxrmoctytlptrauvi () euo(o3io1al e fei s)artmx ono0alt  ociyslsDeluvpn(0aleoir iatfmtrauvi t0s2tm(opou1optemfvsls)aDrrxrpnu4olxnifeiatfmDrm( o t)arerxr iytfpD ln s t0 rum(mpnudop   fcs sf rrr(m ;u4oee ifctyslsDeau pnt0arerxf totlatrlnvsls) 2toxm nu4op elicta()arur(root0tetomfciydfsDumu pnu)tetoxf ootfp eln ils) 2toxrpnudomte fvilt)srurur ;o1alx  ociysls2elumsnu)tetrxfctadlmD aueo (0 2umim3oudamtelnci ()sDtaxrooo0alxniiciytfa2ean o;() rxoiocootomD lu slt) rtmxr iudaptn icia(  2ra( p;t1tetnmfeilsla rm(mp;t4arxnir3ootopDrlneils seumxmpou4opt lfvs (f 2uaxrooo1apenioeildls eln sn()aleoxr oodoa  liesls0 exoiopou4lmte nesl(  2ur(rpou0opeoifetls m2ulu o (4 lxoxo oo1om   u ilt0srxo(opiu4lmte nvsls)a2rrumpnu4oetoioeiltlaDra( o;u0 eerxo oytoateanei s0 etmio oo4lpeemfct tfsrrmx  ou1ape iietytlsDrluvsnu)artnmf oodoaD anvi;t texm(r3iudol  mnciasfaDtrxm nu4aexo o3tat s rmnvs t4 lxrmfciytlp eau s t) etmxo ny1al  mfctltfs2rmumpot0openmi3tydfmDrmnmo u4aexnxf totlpt li olt srtoxmpoy1lptelfesa(faDuau  ou4oeeomo3tatlaDua( s;u0artnxf3iytoaD lueil()trurio3oy1amtemncsa()aDrax onu0tpe if3tydfs2umn pnu)trxrmf3tadfm r n i;(0 2xrxrpio1amtnmnctlt)a2um(m ;t4alto f3iadfmDulnvp t)arenif3tatfmteaieols srxrxm oo4lmtnmicsat a2tmumo;u1oee ioeiaslm2rlumpnu)teerir ta1fpDelu ols0 euoirpoodameelnct t  rrr(  nu1oeen i3iadls em(vsnt0altoif iotom r uvs t)trur(m3nu1lpe lieia( arrrumont1olen fcilslm2eln o;t) lxomo3tytfp r neo ()trxrxr3ny1lltelnctlt) 2raxro;o1altn feiat m rmn ont0 rxnmo3ta1omDeluvil()t2triopio4omtemnvs sf 2rr( oot1tlt  ictlt s elu o t4alxnmo3ootlmD ln o;t0 2uoxo3iy1am nmivsls)srrmurp;o4tpt  oetyt a ulu s;t4 eerxfctatla rau il(  2urim3nu4apt  iviat)aDumu pnu0tpx mfctlt m ra(vp u0 rxnmr3ta1lmD auvi s)texrio3oodapee net sfs2uauront4opt mf3tls a2uanmp u4 eeoxrcoydoptrlivolt t2xoim3io1om n net t)artr(rono1alxnio3ilslm2rl(mpn(4alerio iadop rauvo;(0srtoiopno1am  lfvi (f rua(rpot0alt  ietasfm rm( snt)teenmf oadomtrau o;t) 2trir iy4al emfes (  Dtmu o;o1olx mfctlsfm2rl(mp u4tlermf oatfptr ieil()t2to(o3iudame mnetlt)s2tr(moot0aee mi3tytla2rmnvp t0arerir3oadlpDrauei s0s2toim no1lm   ieiat) 2tr(r ou4tpenmiciytls rau s (4 rxomr oytfp e u o t  rtr(r iudol  licias a2taurooo1altn feiytfmDulnvo u0arxrif tytomD  nei;( t2trxm io1om nliet t aDumxr nu4opx ifciad sDea( s;()tlxrio3tytom e ieols) eurimpoodamtnlnet t arrau oot1tpxoioctlsla2rln s;u0 ltnmr iotlm   ies ( srxo(o3iy4lltelnvsltfsDua(  ;t4aeeomfeiltlaDumnmpnu4aeenxr ia1fm eln i (0t2umxr3no4lp e ictasf rum(m ou4aetnifeiytlm2ean p;t4alxoir iadop rlivs ( sexr(m oy1opt lfcsa( a2urx pno0tet mi3iysfm umuvsnt4tlxnir3oodlpteanes t s2xo(o oo4omt  nvta()s2uax ont0tlen ieiydls2ulnvo t)artnir oatfp rli s;t0teurim3nydlm n nvias a2umurooo0tee ifctltlmDrauvp u0aexnmo iodlaDrlneils seuo(o iudlm nlfcilt)srtm( ooo0oltnioetldfs ul( p;u)tlerxr3oydom  an ilt) 2xm(r no4ale liciltf rumurp;u0oex mociytlm rlnvs;(0alxnxf3ootom rlu slt)sexoxo nodlpeemnvi () Dtm(r ;u4tle  ociysla ulnms;t0aetoxocoadfm  aneo;t) euo(r ny4lpenlivs ( sruaxrpno4oexoiocild aDemu pnt0 rtrxo tytfm r ivo;s  2toimpnodolee ivta(fsDuaxr ;t4alxomi3iyd sDulu pn(4 rxnxo3oydfp   iei;(0 2umxopiu4llt lictasfsrrm(rpnu4optn i3ias aDranmo;u4aeermocoo1la eaieils0sexoxr iydoleemneia()srrr(mp;u1altomicias s el(vs t4aetnif iatfatr u olt)s2toxr3oudlltelivils  2tmxr nu1oet mociytlsDemnvp t)artomo ty1fat  ieo s seur(m3iu1llt mnct sfaDrmum ;t1texnmoeiadfs uanms;(4aeerioctadopte nvs (0 2trxo3nydaptnmfeslt)sDtaxrono0tee iociatla2umuvp;u)tleoxocto1om eaueol(0 exmim iydlm emfcias aDtaumooo0tetomfctld a2emu p;u)texomf tatlmDr u o;t  exo(o nu4amenlnvia( aDtaxmont1teeo ieils a2ulnvs;(4trerirciatlp  lu slt0trxmxmpnodapt  nvi s a2rm(rpnu1oetn ietatls umnvo;t0teenxf iytomtrlu i s)teurxmpiodoltn ies s)srrmurpoo1opt io3ildfs2rl( p;u4trenmfcoy1fa  au o s0 2umim no1omtn ivi sfa2um(rp;u0aetoifctyt s2uanmp t)tlxomfcoadop e nvils0 ruoxm3iodome mfvtl()a2rru pou1tpx  oetysls2uluvo (4aetnmrcoadfaDrlu i;t)s2uoxr3oo1al n fetlt)sruaurp;u4aex  ictysfa2emnmp;t0aexomocoydoaD  ivs;()t2tmim oo1omee icia()aDuru ont1olto ictlsfm2rlu on() lerir iytom rlivil( setr(r nu4alt  iei t aDtrxro;t4tltn o3ilt a2ulu pnt)tlxoio tytlpD  ies;s0 etm(r3iu4apen fcs ()srtm(r nt0oltomietatla2uln p u)alxnmfciydfptr ivo t  rxr(opny1olt mnvtltf Drrxr ;o1olt mi3tltfsDrluvp u) ltomfciytfm ran sls trtoimpoo4llt licil( arrmuronu1alxnmfctadla2el(mont4 eermr tatlate ies (0srurim oudlptemfvs s arumumo;t0oexnmfcils a rlnvo ()tlxrxf to1oate nvi;(0tetmxrpoy1lp nlneilt aDtaum ot0aetniieiadfmDel(ms t0altnmo oy1oaDranvsls0 rxrir3nu4lleemici t) rrmxr oo4tpe  fctltlaDrl(vp;u4 ltrxo oa1opt auvols)texr(o3iodlltemiviltfartr(r ou4olt mo3tlsla umnmpnu4aexoxoctadomt  nvsls  rto(r oo4lpt mfct s)aDumump;t1aeeoif3tasfm rl( o;(4aetnmf oodfmtr ivi;t trxmim3ny1al nlfviat a2umur ou4tptniociyslmDel( s (4artniocia1la e ivsls0setrio3oy4ll nmivsls) rumx onu4apt ioeiytls2umuvp;u4 ltnxf ty1faD  u s;t trum(mpiu4lmtnmici sfaDuaurpnt1aexo oetysfm rl(vp (0aexoircia1laDraiei s)texoxr3iu1omt mnvta() ruau pnt4tlxomietadlaDumu pnt)texomo3totfpDeauei (0sexr(o oodllt  icia()aDurxm ;u0oltomo3iydlm2el(vsnt4artomr totlp eai o;s s2tmxopno1op   nvsat) Dur(mooo4oeeomi3tatlm2rl( p;t) exnmr tadfmteaueslt0srxrxr nudlpee ict sfaDrru  oo1oex ifetadlm2eanvsnu0altrxo oy1oa   u slt0t2um(m iodlme livsasfarua( pot4alxn f3tlsfm2ran s;(0aexnifcoadfp  aies;t0setmio3oydoltn nvs tf 2ua( ooo0tlto o3ildlaDua(vo t0tlxoxr iadfmtrai ols)trtm(rpiudam   nvilt s2urxr ;t0aetn i3iatfm2emn snt) lxomrciytopDeau i;s0t2trxr ny4lp elfcsatf rum(m oo1tle ii3tltlsDumums t)alxrircoo1fpt  n o;(  eurxo3oydole lieslt)a2ra(m ;t1aeeo ociytlmDrmnms;t) eermo3ia1lm eai i;s)s2trio ny1llen nes s  Dtrx p;u1opxo fciyt m2elumon(0altrmo ty1fa rli ol() 2toxm3nydlp nlncil() 2umuro;u1opxn iciadlsDumu s;(4 eeoio3iotfp  au ilt tetmiopnudll  mncias aruax oou1aexoii3ias m2ul( p;u0 lxnifcoy1opDranvslt)s2trim oy4op nmfet t a2trxmont4oleniieiatls2ua(mon() eenmrciodfaDr uvo t  eurxmpnodlle licias)aDrmur ou4teen o3iltfm2rlumpn(4 rtrif3tytlmtrluvi;( trum(r3no1ole mivtat a2uaur ou0aleoio3tytlsDra(von() rtnir oytomDrli o ()trurim3iodll emfci (faDrmx ono4tetnmf3tat s2emu o;u4tetoxo3tatlaDeln o s0 eur(opou4lm elietltfaDrax  no0opeo ietat m rau sn(4tlxoxfctadopDe iei;( s2xoxo3ou1lp e ivt ()sruax o;o0apt  fcils s2rauvs;u)artomocoa1fmt aieo;t0t2tmxo oo4lp nlfet (fs2raxmoot1opx mieiys s2uanvp t4tlxoir3ootfpD  n o (0 etoxm3oo4aptemict tfaDua( ooo0aleo o3ils sDumu o (0 rermr oy1optrauvi s0 etoxo oudoltnmnet ( aDrru  ;u1ape  oeild m ulnmo;(4alerxfcta1lat lnvi ( t2umxmpnu1lltelnvi s)aruaumpnu1oltoif3ilsfm2eanmpnu0aetomr oa1lmtrlnvi;s truoxr3io4ameelneia(  Dumxroot0olx mf3taslm uaumpnu)tlermr oa1lpDeauei;t0s2xm(opno1ame lncil( aruau  oo1tle mo3ias aDrlump t)artnir iadlaDe n ol()texr(opno4ope lnctl()s2ua( ono4oexnioeias m ra(vp;u4trxoxrcoodoatelivs t) eur(m nydope mfeil()srtm(mpno4tlx  f3tat m2uan s u0trxniocio1fpDr u s;()srurxm oo1op emnci ()aDrr(rpnt1oeeo ieilsfmDra(msnt)aexrxo3ootfp eaneilt)t2umxopiu4lmeemieiat arrr(moot1aexnmfeiadlm2um(ms (0trxnmf tadfaD  uvils s2tr(opno1olte ies tfa2umu ont4aet moeiysfm rauvonu)trtrxo3oatlmtrliesl( srtoxr nodlmeelnesas) ruaumonu4altnii3iytla2um(vs;t0 rtrmo3oadla   ieo;(0trtrxmpio1alen ics t a2taxrp;u1alxoif3iysfa2rm(vsnu)aetrio ootfa  lieo (  2xr(mpio1apt mnvi (  rtmxm ;t0tpe  i3iltfm2umnmp t0 rerxo iatlm rln i t0teuoxr oydomeemnvsltfarta(ro;o4oetoioeiysfs umn o;u0alxoxocoa1oaD  ieslt0s2xmxo oy1om  mfcils  rua(r ot1tlt  oeiydlm rmnmo;u)aetrmfciatfpD livilt0 ruoirpiu1ol e nvia()artr(rpnu4tlxnmfctat mDea( p;t0teerxocootomDrln ils0 eumimpoudol e fvsa(f rtrurp;u0ole mictlt m2eauvo (4teenmo oadoaDr n s s) rumir io4ameemies ( sDrmumpot0aexoioeilsfs2rm(vp;u) lxnio3oy1oateaivilt0 rxmxmpiu1ope lnci sf 2umx ono1aet mocildla2ulnmo t0texoifciatfmte uvsls seuoimpiu1lle mnvtls  Dtr( o;o1tpenmoetlsfmDuanmp t4alxomr3iytlmDeln i s s2tmio3iydame livtasfa2ur(rpnu0aptoii3iadfmDeanmpnu) eenmrcoo1lmtrau i s  rum(o no1opee fei sfa2urx p;t1aptoioctasfa ra( p;()teenifctytoptrau i ()t2xo(opiy4ll  mieias aDtmxr ;u0tpenmo3tldfmDeanvp;() rxoio3oa1fptraieo t)s2urxr3ou4ap  mfcs s a2uru p;u1opto fciaslaDrl(ms;(4teenioctatoaDelivsl()sexo(m iodamtemfeil( s2rru oot0tpxnmf3ias aDumu o;u4 lxoir iy1om rauvsl()sexmxr3no4omtnmiesa()arrr(moou1tpxn oeiysfa rau p (0trenio iydfa rlu i (0t2trxo iudlltn fvil(fs2rru pno4oeeo ieiadla2rlnvp;(4aeenmrcta1fm elivi s) 2xrxr3iu1apenmnesat  2ta( p;o0openio3iydfa2eanvp;t0 ltrirciadoat aieilt0setoim oo1al  mnvi t srrm(m ;u1olx ii3iydfmDea(vo (0 rxoif3io1opDrau olt0s2xm(opny1lp nlfvs ( srtm(roou4aeeo i3iasfm2umn p ()teermf3oy1fptelu sl()t2uo(opiudomtnmnciat)a2taxmpou1oeenmieiyslaDea( s;u0 ltrio3oadfateli s;(0teuo(mpoydaptn nct s s2urur ;u0aleniieiat a rln s;u4 rxnif3oa1fm eli s;t) etm(m3ny1llte feslt)artmxr nt0opxomictatlm2emnms u) rtoir3iatoa e ues;t)trum(o3ny1lme  icta()artm(r ot4olenii3tlsfmDemnvp u) lerxocoa1lm e uvs (0sruoio3io1llenlies (fsDrax oot4aexnifctlt a2em( sn()trermf3totla  ln ols  rumir no4al e nvs sf 2tmxm ou1tlt  icildfm uanvo (4 lxoio3oadfpt anvil(0 exmxr nu1aptnmnviat  2rmumonu4opeoiiciltfs rmu s (4 ltoio oadlatraneilt t2um(m no1lpe livils) 2raxmono0optnif3iys s ulnms (4teenxo3iatla e ueils s2um(o3io1ale lies sf rum(ro;t0oeeo fetat m2ulnvpnu0texrmfctodlptrluei;t)srxmim3nodlle mnctls) 2urxrooo4apxnmfctas s rmn ont4 rerxf3io1omD anvo s sexm(rpio1lle  ict () Dra(ronu4aeeoifciadlm ra(vont0tltnxr3ta1lm e ueo;s)s2xoxr ou1am  liei t aDrrurpot0openmoeiyd sDrmu s;t4 ltnmfciodoaD lneo;t) 2umxr3ny4lmeemfvia(faDuaxrpoo0tlenmfciyslaDem(vsn(0artrmociodomtr uvsl( trxm(rpiudal nmivsasfsDrau onu0aee  ictydla2ulnms;u)trxnxr3oadomt  ieilt t2tr(opoo1apee nviasf 2uau  ot1aetnio3iydfsDem( o ()arenmr iadomtean i;(0 2ur(m nu1ameelies t)srua(mont0oet  fcilt a2rln o t)tlxnxf3todoa  au s;s)texmxrpoo1lpe  ivtl(fa2tm( o;o1tex mociltlmDeau snu4 eerifcto1opDr ieo;s  rxoxmpiydole mnvsa( a2rrx onu0olxoiociydfa elnmpnu)altnif3tatopt auvs;s s2tr(o3nu4omtnmiesat sDumxmp;t0openmocils s eluvp;u0 renir3oatopDrauei t  2um(r3oo1lltnmivi s s2rmum nu0aetn ieilsfaDumu sn()trxnxr oytfm  anvil( teuoxopno1omtelfciat)artrumpoo4aptniietyt sDean snu4 exrio3oy1lp  livs;t0teumimpiy4ame mneiat)srtrurp;t0tetoiieildls2rln s;u0trerxf io1fpDr n ol(  etmim iudaptnmnvsltfsDrmu o;u4tlxnio3iatla rm( s;t)arxomo3ia1fmt  i i () rum(m3ou4lmtemfei tfaDuax  nt1apto oeias m uaumonu)artoxr ta1lmtrauvi t)t2xrxrpoy1apte nesas a2umur nt1aetnmicilt m umnvs () etrxocto1fa  anvolt teurimpny1alenlnvilsfs2tax  ;t1altoio3iysfa ul( snu4texomf3iotoa r ivi;s  2urxm nydape mnesa(  2rmx pnt1oeeomfeiyslaDel( o (0artnxrcoatlpD  i i t0s2xr(r oo1omtemncs s)artr( pnt1oexomocildfmDrmnmo;(4treoxo oy1fmDelivo;t truo(mpiydlp  mfeiat)aDtrur ou1aeeoiiciyt mDrm( s ()artnmo3ia1laD ln s t0setr(r io1oltnmnctat)aDumu ont1oetn i3iltfs2eanmsnu)tetnif3iotfpDrlu il()sexo(r iodlle  nctl(fa2tm(mo;u0apenioeiysfs rl(vsnu)tlxnmf3tydlat ai o;t0truoxo io4ap   ictlsfarrrx ont1opxomfciatlm ua(mp;u)alxomr iy1lmDrluvilt0t2to(mpnydolee ncsasf rumumoou1optnii3tyd m2ranmp;t4trenmo tadfpD auvo;(0teum(r3oo1lme lnvs t) rrmx ooo0oee ifeiat sDrlu snt)artoxfctodlpD luvils trumim3iodlm elfetlsfsDra( pno0oee  oeiyslmDrl( p;u0 exnxfcoatoatelu s;t)s2xrxr iu1lm elfviatf Drmumpoo1teeomieiyt s umuvp;(4 lxrir ta1opD lu o s) exmimpiy1lptelncsasfsDrr(  ou0texnmo3ilt a2eau ont)tetnmoctydopDeai ils)srtmim oodlpe  ietatfsrrrumpot0tpeoiiciysfmDrau o;u)tlerxf totlaDeluei;t srxoxm no4ap nmivsat sDtrxmono1oexn fciltla um( p;t4alerir3oo1fmD aues () etr(o nu1lmt lfeta( s2umx  no4aetnmo3ilsfm2el( s;u4tetoio iytlmDr uvo (0srurxopoydole mieilsf Drmumo;u0opx io3ildlm2el(vs;t) eenmociodfm rauvs t)trtoxr3oy4am n iei (  Durxm ou1tetn fctad s rlumon(4 lxnio iotoaD anvs s0 exoxo iy1am   fet (faDtaxront1tex mf3iaslm2ra( p t0trtnxo3iy1lmD ai ols) 2xoxo iydolt mici ( aruaxm ou4tpeomoctlt s rl( sn(0arxnmo oo1lpDe nvil()tetoir iu4lmtnlfetas aDumx pot4apx ifetadfm2ulnmont0altnmocoy1fpDe ieo;t0srur(rpoo1lmeelnctat)srta(ronu4aexnif3tadfs ua(von(4areoircoodop   ies s sexmxr iy1lp   nvils  2umxmpnu0oleo fcild mDel(ms;t4tetriociodlmDr uvils  rxm(opoo1lmtelfvslsfs2tmu pot0ole  ictlt sDemnvp t0teerioctadomDe nvo;t) rurxr3iu1ap emfciat) Duaur ;o0alx  fctatla2umn s;(0trtnxrcia1oat  ies (0 rxrirpnu1optn nei (  rtauroot4altnioctatls elu ont) exoxf iatfp r uei t) 2uoiopiu4ale  nciat srua(root1tee ifeias aDemumpnt0texnir oa1lm  lu s;t  2uoxm ny1omen fesl(farumxrpnt4ale io3iasla ulnvs;(0 eerio3iotoa rauvo s0 rtm(rpiu4lp nliciatfs2rax pnt4tpt mociltlmDea(mpnt)artomf ty1fateau ol()tetr(r ny4apt  nviltf Dur(rpnu4altnmociydlsDra(mo;(4 ltoir ootlateanes;s0t2trir3oy1omenmict t srrr( o;o4ole  f3iyt m rmumon(0treomf iatoate i i;( srxr(opoudapte netls srra(rpno0aptnio3tas s ra(mo;t) exnif3io1oa   ies ()s2tmxr oydol nmfeiat) ruaumont1tlxo f3ildfs ulumsn(0tlxrif3oydfpD  u i;t) rur(o oo1lle  ivsasfsrtrxm ;o0tlxoifetytfs2uln onu0tlenmf3to1fa  an olt)srtr(r iydll nmfetasf 2rmu pnu0aexnmociatfs2um( snt4aexnxo oytfp raueo t  2urxm no4ll e fet s)arra(m oo4tpx mieilsfmDul( p t0treoiocio1om raneolt0teto(m nu4lpe mneia() 2trxr oo4oltnif3iltls2ea(msnt0 etoxf3iy1oa rauei;s t2toir nydopeemfctatf 2tm(ro;t1olto oeiad s uanms;t) rtoir iotomtrlnes t0 rtr(r3ou4lmenlivtl( arra(  ou0tpt ifciat m2rlu s t)tlxrmr3oy1fmDraieslt) euo(o3nu4oltn ietas a2uau  nt1texo i3ildfsDum(vs;t)teeomfcoodomDeaivolt) eumxo3iu4amen ncsat)aDtmu p;t4tle ifetls mDrluvon(4aetomociodlpteln o ( s2ur(o3nodam n fcils)srtauronu4aleo o3tat a2rm( o;t0artomo oa1fa  auvs ()srtmxopny4opte nvsat arumxr ;o0aleomfeiyt m2eanvo;t0tltomr3io1opDr nes s) 2uo(opou4oleelneslsfaDrrxrp;o1olt  feiltla rau o;()teeoxfcto1op eluesls)texoio no4lmtemnetltf 2rm(ronu1tlto oeiaslm2umn o (4 lenmo tytlptrau s s t2xm(m3io1lm   ncia( a2trx  ;t1oeenifeildlaDumnvs u)trxrxfctydoa r ivi t texoxm3ou4alt  feta(faDrmxmoou0apenmo3iasfmDulu pnu4 eerxrcoatfpt lnei t seurio iudllen nvi ( sruau p;u1aexnmo3iat s el(vo;() eenxr oadlp eau o t) 2xmio nu1lm nmfct t sDtaur nu1olxo f3tld mDrmnmon(0 rxrmfcio1oatraivo ()teurirpio1ome lies t s2rmxrpou0tle ii3tld s eanmsnu4alenmf3iydoa  ai i t0 rurxr iydopt  icsat  2rr(mp;u0aee  ieildfa2rmumo;t4tetoir3oatlaDrlieil( teuoio3iudap elivilt)a2urxr nt4alen ieilsfmDua(vs t) eenmo tadoaD li s;()s2tm(opiudoltnlnvia(  rumum oo0tpe  o3tat s2eln p;(4aeenir3totfat lnvi s) rto(opoydamenmnetls) rra(r no0tet  fciltlm rl( ont4 exrxo oadlaDeluvs;(0tetoxr3ny4lpen neil(f Duru  ;t1openioeiat aDemn s;t0 lermo tydoa   ues;s) exmiopoydllt  fct s  Drrxmo;t0oetn i3tadfs2em(vo u4 rxnifctytlateaieil( t2xriopou1ame lfetlt  Drr(mont1altoifciytfs2um( s t)tltoiocoo1fa  aneol( s2xr(r3iy4olt  ncil( s2tmxm nu0opxomoetat a ranmonu)alxnmfcoo1oa rlneilt0t2urxo3nydop nlnviat) Dtrx  nt4oltomf3tldfaDelumsnt4alxnxr iy1lpD  iei;s t2tm(r ny4oltnlieiasfsDum(  ot4aexn oetysfs rmnms;()arenmf3oa1la rln s;(0 rtoxr3ny1amtnlncs tfsDtaurp;t1aex  ictlt aDrmuvp t)alenmfcoydop rauvilt s2xmir3io4lmenmfctlsfsrtrx  nt4tltn ietls mDumuvs (4alxnxfciatlp ranvi (0 rumxm3no4apeelici t  rta( pno0aetnmoetltlm uln s;u0 rxrmo tydopteai o;s)teuoxmpnodom elivias  rta(mp;o4tlxo feiatfs raumonu0tetrxo3iotfmD aiesls)trxmxo3io1ame  ivtlt  rtmxro;t4tlx io3iysfsDra( o;t0 eeoxo iytlm   n o;s) rxmir3iu4ale liesl( aDtm(rp;u0olenmfeiydla uaump u4texrmocto1oat anvo s srxrir no4aleelnctls srtrx  ot4aex  fctltfs2ul(vs t4arxnxoctodfp eau sl(0 2tm(rpiu4lpenmnvils)srrrx  ou1opeomo3tys a2elnmsnu)aeeoxrctotoa  aivo s0trxo(opnu1lptemfvs t sruaurpnt0opeoioetlt m ua(vp;(0tetoxr3oytlp  lneo;s)seuoiopiodaltnliesat aDuau ono4tetnmo3tytfs eanvp;u)tlenio ootlp rlivolt) rxmiopou4opeelfesltf 2urxr ou0olx  fcildfa2eau ont0 eerxf oadoatraiei (  exrxm iy1lle  fcia() Dtm(mp;t0altoioeilsfsDemuvo u0arenmf3ty1oate u o (0 rxm(r3no4lme mfcilt)artauroot1tptomieiyd mDel( p t4 reoxociadfpt  ues t)sruoxopno4lmenlneiasfa2rrxmo;t4tetn ictadlm2um(mo u4 eerio iotla  aneolt)t2umxopnydlmenlfeiat) rra(mono4aptn o3tadfs2rmn onu4artnxfctydoaDeau i;(0 rum(rpoydlptn ictltf 2rrumoou0olx ioeiytfa2ua( onu)teenif3oo1lptr ueslt  euoimpnu1op   ivt tfs2urumpnu4aptn i3iys s2umu p u) rtnio3tadlmDr i s;s t2xmxopnydolt micils  2umumoou4alt moctyd a2elnvs t) exrif iytoa rauvi;s)setoir ou4ap   ncsl( s2um(mono1tlx  fciys s2umnvs;u0arenircoydomtrlnvi t0 rxoir iu1ape mivs (f Drm(  ot1oet  f3tlslsDrlnmo;u4texrifcta1fm  auei ( srxr(rpoudame mict tfs2raumont0ale  o3iydfaDra( on()aexnmf oadfp r nvo (0seumxrpoo4lm  mnet tfarum(  oo0oexoif3ildfa rmump;t4 rxoio3oytfm ranvo t0sexmir3iy1lpee fctlt srumx  ;t4olenmfeilsls2rmu p t)aexnxr io1fmtelueolt0teur(m3oy4olte fei s  Dta( pou0ape mietatfmDum( o t0trtrir iadoateaiei () 2ur(r3oy4ap n fcsl(fs2umu  ;t4tlxnmieils s2ua(mpnu0aetoxr3oatlpte neil( t2to(o3iydoptn fvslt)a2urxmo;t1openmociyt sDrm(vo;u)altoxf oodfpD aivsls)setr(r3nu4op nlnesas) 2rax  no1ape mietas a2rmn o t) ltnmr3iodlmD anvi ()t2to(o iu4aptelneilt sDuax ono1olx  i3ilsla ua(mp;(4 eenxo tydfmD anvs s  euoir nydame livsasfsDrau  oo1oeto fctlsfa2uan s;t0artriociatomte i sls0t2tm(m3iydap elfvtl()s2ra(monu4aex  ictas aDuau pn(0trxnmo3oadomt aneol( seumimpoy4op e neil(faruaxr no4oetn ieiyslaDra( p;(4arxoif3iodomDranei;() euoxm io1lltelnei ()srum(mpoo1aexnmfeild s uau o ()aeerxo3iatla raivs;s)tetm(opiydopt mics (f rtmuro;u0aexn ietltfm2um( s t0tleoir iatlmDran o () exrxo iydole lfctl()sDumur ;u1alxn f3iytls uan p () ltomf todlmDeluesl(0s2xoxm ny4olte nvsl()srrrumo;u1tpenmf3tatfs2uanmsn(0trenio3ta1fpDrli sls)tetoim oudlp e ncsat)srtaxro;u4altomfcildfmDrmu s t0 reoio3totoptrau ol(0 2xm(o3no4llte fcs (f rrmxmpnu1ale  i3iydfs ulump;u0aleoifcoadlpteli slt srxmiopiodoltemncil()a2ur( pnt0tetoiieiad sDea(vp t0aetnxr tytomD  u i;(  2tm(m oo4lpt  fcil(  2trumpnt0tee io3tat s2em( p u0areoxo ia1oat lneils)srxmim oudomt mivtl(fsDrr(mo;u0optomfctltlm2el(vp;t0aeenir totoaD an i;t)s2um(r iodal elnetlt)sDraur ot1apto ietat s uanvo;t4altnxo oatlp r n o s0seuriopoudlmeemnesat aDtrum no4tlen fctatfsDraums;u4teeoif todfa  liei t  2to(o3nu4ol   nviasf Drrurpoo1ale mfctlslsDea(vsn(0teeoxociadlpt ai i ()srurxo nodlmtnmivsa() 2um(r ot0alen feiltlm2elu sn() lxnmr ta1oa rli i (0srxo(r3nydlltemivil()sDtaxm ou4tltnmocilsfaDrauvon()altomr iatlat an ilt0 2xrio iodol e icilsfsDrau  ;o4tpenmf3iaslaDrluvont0 exnio3tatfaD  neils  euoim3oy1op nlictl(fsDum(r ;o0texoio3iaslaDel(mp u4artoxfcto1lptrlneols  rto(r3oudlp n feil() rrr(mpoo1alx miciatfa2em(mpnt)aleoir oa1opDr ueols)srtoxopio1aptn nes s s2ra(rp;t0tlxnif3iytfm rmumo;(0 eenio oy1omtelu o;t s2xr(mpny4al nmfvtltfaDrrxroou4alxnmi3ils m ulnmo t)altnif oo1lpt lnvs;(  2urio nodllee ncilsfsrrr(rpot1aeeoifcias sDemuvon(4 lxomf3iatlatr nvi;(0t2xmxm3ny1olte ieils  rumxm ot4tlt ii3iyslaDem( pnt0arxnxfctotfmt aieo s  2xmxr3iu1aptemiviat) rrm(rp;u0tee mfeiadls el( p t4aexnir3oodom e ieo;()trxoim3ny4optn fetls)arum(rooo4oeen f3ild mDeau p;(4arenif3iotomteluvs s0 rtrxo3iudap e ncsa()arum(root4apt ifctysla umnmo t0trtnirciodfptr nvil(  2xmir io4ale mfcsa(faDtrxro;o0altomi3iyd m ea(mo t4 exoxo3tydop eau s t0 2xmio ou4al elncia(  2uax p;t4ape  ieilslm emn pn(0 reoxr ty1omDrlueils)t2umiopoo1lpt lfvs tfartmur oo4alxn ociadla eauvp;(0 etnio3ta1faDrlnvi;t)sruoir iydlle  iet sfs2rmx  ot1olx ii3tat aDemnvp (0texnmf todom r nvi t  rxoim3ny1olt  ieia(fsDum(rpno4tet mi3iytla2el(vpnt0aexrxfcto1fpteln s;t  exmim3iu4omen iei (f rra(rooo4oltoif3ildlmDulnvp t0arerxrcto1optean ils0 rur(o nu1olte ieta() 2ra(rooo4olt  ieiltfa ranms;() exrmrcoatoat  u o;()s2ur(mpny1al elfvta( a2uax o;o0tleomiciadls2elu ont)aeerxocta1opteluvs;s)srxmxm nodamtnlnvs sfsDuax  ;u0ope  oetldlsDum(mpnt0trtrxo3ia1opt  ieo s0 exo(rpny1ope  fetl()aDuaurpoo0apxomi3iydfs uaumonu4alxnxrcia1opDeli s;()t2xrir oydop n fesl() 2tr(m ;o1alxnmicils a el(vsn(0trxriociatfmtr i o;()t2uoir iudlp  mfvsl( a2tm(m ot4aptnmo3tyt mDrl( p;()artnxr3tytfp e n il( t2ur(m io1ll   iesat aDrmx  ;t4opxnmoeiaslsDua( o (0tltoio oodopD lieo;s)srxrxm3oy4al nlnetls) Durxmpnt4aex mociat a2eaumo;()aeeoxrcia1om eaueo ( t2xm(r oodoltn ivtl(fa2ururonu0tpx moctys a2rlnvs;t4 etrxr3tydlm   u o t s2xoio3iu1olen nesltfaDrax ont1apxn f3iydfs ranvp;u4trenif3iydomteli ol( sexo(rpoo4olt mnvil(  rtmxro;t1aetn i3tas m2um( o t0aexnio oy1lm eau il(0t2tr(o ny1lpe mivsl()a2truro;o4texo ociatfm2eln p t0arxoxfcoy1fa   u s;s0teumiopoudlltn neils a2umu  nu4olto ieils m ulu snt)aetnxr3ta1lpDe nei s0sexrxm ny4optelict ()artrxrpoo1tlxomfeiatlm umn pn()artnxfciadomD  nesl()s2um(r nudaptnlieiatfsruaumo;t4tee mo3iltfaDel(ms;u0tlerir3tydom e u ol() 2umir iydope mivtas)artru  ;t1aetomoctyd m2eau p;t)tltnmf3ia1fmtran o;t)srtoxo iudlpenlfeiat) 2ur(  ot4aeenifciatfs rmuvo (4altrmo ta1omt li olt)tetoiopiodal nmnvil()a2trxm ;u4oltomo3ilt a umuvo;t4 leomfcta1faDeaivi t teum(opou1al   ncia( aDurxm ;o1ape  oeiytfm2rmnmp t)arxnxo iodfaD lues;(0srtr(o no4oltnlnvils  rtmxmono1tetomf3tlsfmDemu ont)aeenio3oadfaD auvsl( s2xoim3nu4llenmics ( srumumo;o4oetoif3iatfaDrl(ms;(0 ltomo3oy1fa ran i;t)s2tr(mpiodal nlnesat sDum(rpnu0teeo oeiatfa2ulu p;u4tlerif3totla eai o t) 2xm(m3oy1omee fct (fs2tmuront0oleo ietatla eln on(4altnxrctydfm raies;s)t2urxo nu4omtn nvslt s2tmu  ;u1oltn oeiaslmDrluvpn(4 rxrmocty1fa rauei ()s2xrxm oydlpen feiasfs2tmx  nt4apenioctltlaDum( snt)arxnxrctydlpteau o s) eto(m3ny4ame lict ()a2ua(roou1opxnifctatls2eanvo u) rxrir iytoatr i o t truoio oydamt  ncs ()sDumxronu0alxo i3ildlaDra( pn(4aetoifctodlateauesl()s2xr(r oo1am   fcsat)aDra(m ;t4altomoeias a2rlumpnt4trtrmf totlpt ai o s) rto(rpno4amt lieia()s2taumpoo0aleomieiltfa el( sn(4altoio iy1lp  ln sls0seurirpnodlp elieilt  rra(  ou1texo fctltlaDeanvp u4 ltnxf oadlmD  u o;t trtoxopiy4op nmfvi s aDrruronu4olxnmfciyd s ranvp;() lxnmfctatfaDelieil(0 exoxrpiydaleemieilsfaruax pno1apt  feiytfa uln s u4tltrxociotom r u ols)srxoxmpio1alt  fesa(fsrrmu oou4aeeomfciaslm ra(ms;t)tltoio oatfa rln s;()s2trir3oodll   nvi sfaDuax p;o1altnmo3tadlmDul(vont0areoxo tatlp rluei;s0 2toio3nu4olt mieslt)srtm(mp;t0olt  oeildfs2emnvon()aetrmo ty1omDeaivs;() 2tm(m oy1ll  mnctasf 2trx oou4aptomfetlt s2ranvp;t)teenmf iadlmte n i ()truoxo ou4openmiesasfaDtmumpoo4oetoii3iytfm2ulumpnu)aexnxrcoodfm raivs;t  rurxo ny4om   fct t a2rrx ont1teenmi3ildls2emump u4 ltoxr ia1lp  lies;(  rtmim3oudape lfeiat)a2rmumpnt4olxo f3iyt m2eaumonu0tltoio oadla rln i s) 2umxm nydlpt  fvtat sDtaumpno4apxnmoeiysfm umnvo t)arxomo3ta1oaD lu s;(0 exm(r3oo4lpee icia() Dumu o;u4alxo feiadfs rmnvp;u0alerxf3oa1fmtrau il(  rur(o oy4lm elfvs ( s2rm(root4olt ifeiadfaDrm( pnt0tltrmrctatlmte n ilt0texrxo no1olt  ncs (faDrm( pou4tpt  o3ildls2rln s u0 leoifciodoaD lu ils sexmxrpiu1ap elfesl( arrrx pot4texn ictytls rmumon(4 lerxrcoytom raieo (0 2uoim3oodole  nei s) rrmxmpou1olen fctldfs el(mp (4arxoxr totomDeaiei;(0s2tm(opno4ap e nvslt aDtaxmpno1olen ieiysfa eluvo;t4 lerxf iodopDe ues;t) 2tm(opoodlmeelfcia( srtm(ro;t0tpeo i3iyslsDrau p u0arxnmr iydoa rauvs s) rtoio io1ome lnvs ()aruru  ;t0apto octasfm2rm(vp u0tltomf3tatfaDraies;()t2urim oodomenlicsl()aDtaxmpno4altoii3iytlaDulnvon() ltoxf iydomDrlivi s)tetm(rpoo1lle  fvi t s2ra(  nu1teto ieiaslm ea( o;(0alxnio iodlm rli ils) eumxr ou4om nlnvsa(fsDtr(m ;o1opx mo3iyd m2ea(mo ()tlenxf iotlatrluei s0 2xm(mpiu1ole lfeil() 2trxr ;t4aetomfcilslm uluvo (4trtnir3tatfmtraieo ( texoxm3oydalenlietlt s2rmu o;o1apt miciysls2ra(msnu) etniocoa1om elueo;s)teuo(r3iu1lm emfct sfsrumu  ;t0tpen iciltlm2rlumsnu)trxnif ootlptrln s s0sexmxr iy4olt mnvs ()a2rrxr ;u1opto o3tytfa elu o;u)arxoifctatfmte nei s)trtr(m3ou1aptelneiasfa2ra(  ;o1tpxomictls a2eaums;(4tltoif totoa rai i;s) eurim3oodol  micsat)a2uaxrp;t4teeo iciydlaDelnmp;()tlxnif3iodlm   neo s)t2uoxm iodal n fvt s  2ta(r nu0tltomietyt sDrl( p;t4 rxnif tatopDrlnesl() 2umiopoudalt  nvs tfsDrrxrono0oltoiiciat mDemn p u)trxrmf oodfat  u ol(0 2xoxo iu4ameemneias)aDtmur ;o1aptnmo3tat mDea(vpnu0texrifctydom r i ilt)s2xmir3iodap nlfeilt aDum( ono1aptnmociasfa2ran onu) lxoxo3oa1fa   nes;t)sexmiopiu1lm e ictat)artrxmoou0texnmf3tltfm2rlums t0teenxfciodlmt aivs s sexrxm nu4ol nlfviltf 2tru pnt1tlenio3ildla ra(vo;()aexoxr oadlp rli sls  2tr(r oy1aptnmies s) Drr(  ;t0ale ioetytfs2rmuvpnu4trenmfcoa1lmDrlivols tetoimpno1amtnlnesas)srtaxrono1opxomiciadlmDel(mp;t0 reomf3iy1lmDr nes ()t2tr(o no1omenmnvsls srra(moot0aexo ictltfs2ra(vp;(4aexoxr ty1opDr ivo s) 2urir oydam  lfvta( aDta( p;o4opt moetyd aDrmnvo u4aexoxf iydlaD  neils  2tmxrpno4aptn fetas a2ua(mont1olxn f3tlslaDuln snt)alenmo oydfa eln o;t) euriopoo1apenmfctl(fs2ur( ooo4aex  oetadfa elumo;t0 lxnmo tytopDraivs s  etriopio1om  livsa( s2tmxmo;u1olt moeiat a2eaump () reoxr oodfaD lu i t srur(m iu4ome mietas s2tmxrpnt4texnifciydlm2umumsnt4 lermo ta1lmte n sl()s2xm(r3ny1lmee fci tfs2tauroot4apxomi3ias mDrm(vpn(4trtrmo3iydlptelnvo;s)tetmxopnodlme  neta(fa2taumpoo0alt  fciyt s2eln on(0tetnio3totfpDranvi;t) rxmxm iy4om e fei sfs2raxmpot4apxniieildfs2ua( p;t)alenmr io1omDr ies (  eum(r3iu4llen ivsatfaDumx p;t4opto iciltls2rmu onu0arxrif oodfpDr uvils  2urimpio1omeemietls)a2tau p;t1oetnmietls a2ra(vo u0 ltnir3oa1fa rluvilt)trtrxopoydoptnlicilsfa2ra(  nt1optn o3iasfs2uanmsnt0tlenmo tatopt  nesls setoio no1am e netlsfaDtr(mp;t1oexo oeiydfmDelnvs;t0aeermfciodoa raneols)seuoim3oo4ope lfeilt)artrxm ;t1altn ocilsla2el(mo;(4 etoifctydomDeaieo t  eurxrpiudlmen fcia(fsrtm(mono0tlt iieilt a2um( s t0 lenmo3oy1omt anvil(  etoir3iy1lpe mies t) rua(r no0tpxniietld mDrlnmo;t0 lermo oodlpDr uei t0 etr(m iy1ap n
\ No newline at end of file
@@ -0,0 +1 @@
+i slt)setmiopno1op nlneilsf rum(mpno1tpt mictyt a2umuvo u0 lxoirctadfp e ivsl( tetoxm ou1omt lncia() 2trumpoo0oetnmi3iat m2umuvo;(4tltrxocoydla   uvs s) 2umxm3nydom e icsa(  rraxrpnu1tex moctytfm2eanvp;(4 ltrir3tatlmDr ies;(0trtriopiudlp  mnvsatfaruau pnt0ape  feiadla rln s;t)artnmrcoodomt aivs;s sexoxr3nydame mict t aDra(mpno1altoio3iatfaDuluvpnu4 ltnmrcoy1lm r ueo s0s2xoxo ny1omteliet tf 2trxrpot0texo fciadlm rlums;u) rxoxf3oadoa e uei;t)s2tmim3io1am elnvtatfartaxm ;t1alxoiieiysfa2emu on(4texnxr3iydlmDean s t) 2trxmpoydlptn fci t aDtr(r no0texniicild aDuaump;t)alxnmfcoa1la  lneil(  rumir nu4opt  net ( srraumooo4aex if3iytfaDuluvo;u) exomr3ta1fm e nvo s  eur(mpnodalt  nci ()sDta(mpno4alt if3tld m2raumo (4 etnioctatlaDeanvo;s0srumxmpoy1lm  lict ()aDtrx o;u1oltomfeiyd m ulumpnt0aetnmr3oytlp   uvil(0 rxo(m3nu4am emnct tfsDtmu oou0olxnmocils s rmu o t0aeenxoctydlmteluesls0sruoxr3no1lpe licilt  2rr(rono4aeeomociytfs2ul(mo;t4teeoxr3tatla rlu il( srurirpny4apeelivias)s2rmu p;u0tlxniociltla2raumonu0tlxnifciotopt anes s t2trxopiu4lp n ietat)srrrxrp;u1teen o3iyd m um( o (0 ltrmo tydom eluvo s) eto(m3iu4op emnvilt) Drr( pno1tlxomo3iys a ean s;u4tlenmrciy1lptranei;t srtrirpoo4ll  lnesa( aDtmur ;t0apxomi3tasfmDel(mpnt0tetrmf3oadlp ran s;s) rxrxm3iodape mfcsa(fs2trxrpno4oeenii3iasls2ua(ms (0 lxoio iatomDrauvol(0sruoxr iy1am n iviltfarurxmoot0aleoioeiaslaDea(msnt0aexrif3iy1lpteauvs (  rxm(r3ny1om elnvtlt)a2rrxm ou1olto oeiytlm2eaums;(0tlxomo3oodfm rai i t truo(mpiu1ap emnesa(f 2tmx pnu0teeomiciydlm um( o;u0 ltrir3iodlat ln sls) rtoim3io4lmenlici sfa2rmuro;t1olenmi3tadls2rauvp t0trtomf to1lpDrluei;t)t2trxr3ou1lpt mfesa(f rrmx p;o0oet  i3iys m ra( p;u)alerir totfate n o;s)s2tm(mpoy4am e iciasfaDraurpnt4oeeoii3ildfsDeluvpn() leomr3iotfpD auvils t2ur(r3io1am  mnesltf rtr(ronu0apeniocilt aDumn o;(0aleoxo3tatoaDr u ol()tetmir3iy1ope  nes t  Dtrum nt4oetoii3tldfa2elums (0trtnxoctydlm  aues;t srtoxm3nu1opeelncils)s2urumono0aptomoetltfs uaumpnu0 eeoio oytomt an s;t)s2xrxo3oo1lme lnvsl() Drm(m ;u4apxnio3iyd sDem( s (4 lxrio3iydomDeau o s0srto(m ou4ope mnes sfaDurxr ;o1optomociyt aDumnmpnu4arerxrctadfaDranes ( s2to(rpou1alt  fesa()sDur(mo;u1tlx ioctysla2emuvp;t0aleomocoy1fmtr n sl()texr(m io1ll  mietas)artrur ;o1oltomo3ilsla uau pnt)aetoifcoydlmtrlu ols)srtmxr nydlpeelicsl(f rtaum oo1tpxnifeias aDeanvsnt4treomo iotom eanvs t  etmiopnu1alen ictlt)sDurxr ot4tpe ifetls s2eanvpn(0 exrio tadlate u o ( s2tmim no4lpeemfvslt aDumxmp;o4texoif3tldla2uanvpnt0arxrif3oadoa e iei;s0 rtmir nydolenmivia(f 2uaurpnu0tpx  ocildls rmu o;t0altnmo tadfa   uvil()srtm(rpiu1aptnlnci (farrrurpno4aleoifctlsfaDulump;u0trxnxfciotopteluvi s seurxm oo1om eliet () Dtmx oot1alxomfetaslsDelu snu)alermr totlp  au ol(  2xmio3nydll eliet (fsrtmumpoo1alenmo3iad mDea( o t) rxomr3oo1la raivs;( srxmim3oo1op emnvt s  rtm(  nt1tpt ifeild m eanms;u4 lxnxr3io1oaDeaieslt teurirpiy4al nlnct ()sDtmxm ;t1oetniieiadfs2ulnvp;t0 ltnmo3oy1opD lu o t0 2xr(o no1omtn neia(fs2trum no4tet  f3iad aDumump t4 rxrxf ty1oa ran o;t0seuoiopny4omtnmnvta()a2ra(mpoo0aexomoetld a2ea(mo t)aexrio3iytoatrln ilt) eumio3oo1oltemfes t)a2rm( o;o0oeto ociatfa em( onu)alxoir3oydoaD  neo;s trxm(m no1lm  mnesls s2ta(mp;u0olxn octydla2ra( s u4aeenif3todomt auvi;t trumxopiu1lmee ietls a2rmx  nu4aexnmf3ild m uanvont) leomr iodfatelnvi;()t2urxm3iydoptn iet s) Dta(mont1optnifciltfm em(mon(0tetoircoytomtr ues s) ruoxo no1olenlnesas)a2ur(rp;t1apxoii3tlslaDea( p;u4teerif totopDraneil(0s2uoio3oy4am  lnetl( srrr( ono4alenioetyslm ua(vsn(4artoio oy1opD  iei;()setmimpiy4apee net t) 2rmump;u1opxoii3iasfs2ran s t4treoio ty1laDraues s)trxoxm nodape licsas) rrmx  ;u0tpxniieiad a2uanmo;t4aetrmr3tatlm e neolt0trxo(o3oo4ll nlivias arur(m no4oleoif3tld a emnvonu4aetrxr3tydlmt  ues;()trumir ou4alen fvil( s2ur( ono4aexo ocilt a2ea(vo u) rxnmrciotlp   n ol() rto(o iy1lme mfvilt  2tm( ooo1ape mfeiys m2em(mont)tltomf3oodom e nvs s0srxrim iu4amt lncsasfs2rmxm ou1alxn feias s eaumsnu)alenmo3ootop  aneslt trxr(m3ou1ap nlfeilsfa2tr(rono0oex mociyd mDum(vp;u0 ltnxo io1opD ln o ( t2umiopiodlptemfeilt  2um(rpno0olxnmfctadlm el( p;(4artnxf3to1lptr iei s0truoxopoudolte fct s) rtm(ro;t4olt  feias a2ra( s t4 eeoxr3tydfat  nes (  2umxr3iudal  mfcta(faDta(mpou1aetnmocias s uanvs u)trtomf iadfm e iei s  exoio3iudlmen nvi (  Dtm(rp;t0tptn f3ilt s2eau snu)tlxrxo ia1fmD anvo;()s2tr(r oy4omeemnvt s)sDua( pot4tlt iocias s2umnvont)tlxrmr3iotlpDr uvsls t2xrxrpou1oltnlieiltfsDtmxr nu1aeenmi3iysfs rmuvs;t) etrxo iydoatr neo;s0 euoxmpoy1lm  lfvtasfs2uaxmo;u1apen fctysfa2rlnvp ()trxrxo iodfatraneo (  2xmimpiy1ap e fct ( artaumpnt0apx  o3iatfa2ul( onu)alxoxr oatomt  nvslt0s2trxmpno1lp e ictat  rrmxro;t1apxnmo3iysfa2ra( p u4aeenio ta1fa  lnvi;t)teumir3nu4amtelnvsatf rtmur ;o0tpx io3ilslaDrmuvp;u0 lxomf tydlpt luvs;t  euoim oo4lmen ietl( a2urxr nu4tlx  feiatfa ua(mp;t4 etoxfctadfmD auvs;t0srumio3nu1am nmieiltfs2ra(  ;t0opxoii3iltfs2rl(vs u4tlxnifcoytlpDr nvs;s0 2tm(rpoo1ameelfct sf 2tr(m no4oltnmoeias m emu p;t0alenmr oydlpDe i i;(0 ruoim ou1altn ictas) Drau  ;o4oetn oetyt a rmnvs t0 etoio3oa1opDr ivi t sexrio nodapte neta()aDurx  ;t4aeeo f3iysla2rau p;t) lenxfciatoa eanvs s srtmxmpno4lp   iei s)s2ua(mpno4apt  ociytfs2uluvo;u)aeenmfctydlaDr u ilt0s2urir oudaltemncia() rrmx  nt0tpt ifetas sDul(msnu)trxrmr3ia1fm r u ilt) rtoxo oy4al e nvsas  rrr(m nt0alt  o3tysfm ulu p;t0texrmf3iadop rlu s (0 2ur(r3ny1ope mnvt t  rtm(mo;u4alx iiciltlmDelumon() renir3todoa eau o;(  rxr(o iodoptelneiat  rta(mpoo1oetn ietatfs ranmsnu) rxrmrcoodfmD  u o ()sexoirpoodam  lfes (f Dtax p;t4opxnmieiytla2umu onu) rxnircootlptrai ol()t2xo(opio1amenmfet t s2tax ooo1olen o3iysfa2em( p (0tlxnxfctadfpt  u ols  rxr(r iy1ome lfcs sfsrrau  nt0oee mfeiad m2rauvsn()trenifctatoaDrau ils)texoimpoy4om   ivtl( a2rax  ;u0apxo o3iatla2el(vonu0arenmo oo1la eanesls) rum(rpiodapt licsls a2urur ot4optomi3tas a2emnmsnt0alenxf ta1om r u olt)trumxmpnodamtn nesa(fs2uru  nt4olt  fciasfsDulnvs;t)tlxnxo oydopte neo (0setoxr3oydlp e fctasfsDtmump;u1aptomoetlsla ua( s;()arerir3ty1lm   uesls)trumxmpny4ole mivt s sDraxm ;u0olx ifcils sDel(vo;u0arerir3oodoptraivo t srumir3iudlmtnlnvia()sruaxmooo0tltnmieiysfs2elnvo;t4 ltoxfciodoaDr nes ( srxm(m3ny1lpeelnviat a2rax  oo1teeniocils a eanmp t)areoio3tydlpteauvs;t srtr(m3iodame lfvtlt sDumu  ;t0aexomi3ilsla2ul( s;u4 leomrcio1opteai o t srtmxm3oudoltn ncia(f 2umurpoo0tptoiociyt a2eln p;()aetoir tydop  auvo;() etr(m iodom nmivslsfsrtru o;o4tpx mictls m rauvsn(0arerio3oy1lm r ueo;t)s2xr(rpio1ol   net () Dumxr ou4tetnmfcilsfs ul(vs u4teenio3tatomD livs;s) rur(opnodoleemfvil( sDrrxrp;o0aleo i3ias a2rm(ms;t0 eeomociy1oaD  ues t) etm(r nudolenmivta()sDrmumo;o0alenioctlsfaDrlu o u4tltrircoadoaD  neils tetr(m3oydlmenmfvsl()srurxmpoo4openifetldlm raums;(4aeerif3oodlptranvol(0texm(opno4apt  ivsls s2tmuro;o1oet mfetltls2ulums;() eeoifcootfpt  iei;s0tetm(r ou4amtemiesat  Duauront1alx ii3iltfaDra( s;(4 rxomr tydoptrlivi s  etrio3ou1altelicilsfarur(m ;u1altn f3tad m2ulnvp;(4 rtnmf oo1latrluvi;s  2urirpnu1lpe  icil() rua(  ou1alt mf3ilsfa2ua(monu)tleomocoydla raues;() euo(m ou4amenlfvias)srtauro;o1tpx miciltfaDuan on()teerircto1laDeaueo s srxoio ny4omtelictlsfsruru ooo0ale io3iysfs2em(vp;t0tlxoif iy1lm   neols trxo(rpoo1ap elnciat  Drm(mpou0tlto f3tad a ea(mp (0tlxnxrcio1lm eliei;() rtr(rpou1al elivt t) 2rrum ;u4oeen feiltfm ua(vp;t0alxnmrctatfp eaneo;( seumxr oodape  fcs t srta(r nu4aetomiciatfm2ea(vs u0 exrmfctadopD aueo;t0sruoxm iy1lpee icsasfa2uau p;o0tle io3iatls2uauvs (4 rxoio iy1faDrlnvolt trtoim iydlpt  ictat)srum( onu0tex io3iad aDeluvs t0tlxoxocoodop  ln s t)trxo(o3oo1olee nvi tfarrax  nt4tlt ifeiasfsDumnmp;u4trenio iodfm elivs t)tetoimpoo1oltnlivi tfs2uru ooo4oexn iciys sDuaumont4altnxr tadom ean s () exrxr io4olee feias aDtm( p;o0aexn i3iysls2el( o () renio oy1faDeln sls0trxr(m ou4ape  iet s sDtrx p;u0oltnio3tyd s2rm(mp;u4 rtrir oatfpDranvsl()t2toimpoo1am nlivtat  2tmxro;t4tptomictldls2rmnmpnt0trtnxr3tytfp rauvo (  eurxm3iodopt mies tf Drrx  oo1aleomo3tyd m2uluvonu4 rxrxfciotopt  uvi s0trtr(rpou4olenlnctl()arrax  ot0oexnmiciydlm rlu s (4trtoir oytomDeai o t trxrir3iodllt lnvt tfarurx oot4opt iociat m emuvs;u0aeermf3ia1lmDrli i;t0trtoimpnodopeelicsas) 2urxmont0tlt io3iydla elu p t) etnmr3oodlmDeai i;() rumir ou4ap  mncslt)aDtrx  ou4alxnmociltlm2ul(ms;u4 etrxr oo1om r uei;(0srxo(m3oo4lp nlnvtat) 2uax ont4oetnmoctys s2umuvsnt)trerir oa1faD  uei;t sexmxr3io4lp nlnvi s sDtmurooo1apx  f3iltfaDuauvs;(4arxnmf oodlpDrli s;s0 2uo(m oo4lmen fvta(fa2ta(mp;t0ole  o3iyd mDumnmsnt)trerir oodom  li s s0 2xoxm3nodll n fcilsfs2tr(rpnt1aleoiieils m2el( p u)trxomr iadlaDeau s s teurxr nu1aptelfetlsfaDtr( o;t0apxomiciysls eaump;t)tleoxfcto1fp  aieo s0 2umim3nydope lict (f rtrur ot0tltn iciys aDuan o;t)alxnxfcio1faD  i i t)srtriopiu4ale micsls  2ua(rp;u4aex  iciyslaDelumsnt)aetrxf iydomD  ivolt)seuo(o3iu1lp  mfcs (  Drm(rpnu0tetnio3tld s2rluvpnt) lenmo ootfmDrauvolt)tetoxr3nodalen feslt a2trum ;o4apt  ociyt a2rl(vp (4trxomrcoytfmteaivo (0seuo(opnodomenlicsls)aDrrur nt4altoif3tadfmDulnmsnu0trxnir todfpDeauvs;s)truoxm3oo1alt mivils sDtax p;t4tetnmieiltfa2ea(vs;t0texrxf3todlm rlneslt)s2tmiopoydlmtemnes t aDumx  ot1tpe mf3tasls elnmsn() rtoxfctatlm elneo;s)s2um(opou4apte icsl(f rtm(ronu4oet iieiysfm2ul( s t4tlxrmrcia1omDeaueo (0 exo(rpiu4lpenmncsa(  rraum ;u1tlx moetlsfm2eanms;u)tlxnxocio1fm  lues;t) 2toir oodlmt  feias sDtax pou0tlxoii3tls sDeau p;t4alxoxrciadopt lu i s0tetmxopiudamee fet t s2rax  ;o1oex io3iyslaDra( o t0 eenxrctydom   u o;()sruo(opno1omtn ivt sf rrrxmp;t0tpxn fcildlm2ra(vp;(4 exoircoo1opte u s (0s2urxm oudaptnmnesl( aDum( o;u4tpxo o3iatlm eau p;u0aetrmo ootop e i ol() rxo(rpnu1al nmnvias) Durum ot0oetn fetlt a2elu p;u)teenmo3iotlm  ln slt)t2tr(m no1apt  fct t) 2umu  nt0apxomfcias a2rmnvo;(4 lerifcty1faD anei ()trurxopoo1apeelietas)sDtaxmpnt0teeomoctlt s umumo;(0 etnmo oo1fp r ues s0t2xoiopno1ap   ivtl()sDraumoot1altoifetadfa rmn s;t4 rtnmf iodfaDranvi s) 2xo(o iudaltnlnes tf ruaum no4opxnmi3tadlaDumuvs;u0 rtrifciadlatrlieol(0seuoxrpoo4apee ivsas arumx o;u0apt  ieiys aDrluvp ()aexrirctytom  auvs t s2xrio iodalt mncilt)a2raxrpno0ole ifeild m2el(vp u)alxnio iatfmteli slt) exr(m no1apenliesat  Drrxmp;o1aeeo oetyt s2umnms t0aexoif3iytoaDr u ol(0seur(opnudlmeemfei (fa2trxr ot0optoifetysfs2ul(vs;t0tltrxr3oy1lptean s;(0s2uo(opio1aptnmicils  2ur(m ;o4oex ifetadlmDel( p t0altrirciadfpD  uvsl(0setr(m3oydomt miei s a2ta( pnt0tleomi3tls m ua(vp t0tetrmfcto1fm  auvsls0srumir ou1omenlfcslsfs2urxmpno1oexnio3tat a raumo u) rxnxf3iotlpteai s (  rum(r3oodlp nlfcia(fa2tmxmo;u4oex moeild aDum( ont0artomf iy1oaDe neol(  2xmxr nydol nlnct s a2umuroot4aleo ocildfmDuln pn()tlxnmf3tydlmDraivols)teuo(rpno4lmtelnvi (f rrrxmo;o0apxoiieiys s ranmsnu)trtoxf3totomte ies t) 2xmxopou1lm   ncias)aDrm( poo4oeenmfcildlmDrm( pn(4trxrxocio1op   n s ()trxrxr iu4ll   iei t) rumu  oo0tlxo ociyt m2uanmpnu4tlerircoa1om eaieils0trur(opou4lmt mivi tfaruaxmp;u1tpe mieias a2em(vpnt4 ltnio3iadlmte nvo t) 2uoxm nydapen fcsat)srra( ono0aetomiciltla rm( p (0 eenxo tytfmteanvs t s2xrxr3iy4llt  ietat sDtmx o;u0aexo ictydfsDulnmont)areoifcty1fat livo;(0trtrxm3ou4alt mneias) rrrxro;o4oeeomoctat a2eanmon() ltnxr iadomDranvslt teumim iodlptn ietltfaruaxrp;u1tetniictatla2uanmont) exnio3ia1lm   ieils tetmxrpoydaptnmfctat  Drmx p;o4aleomfciasla ra( o;u0arermrcoy1fpDraueo s srtoim3nu1lpe lnvtas  rrmxr ;t4aeenmiciaslsDuan s u)altnmo ia1opDe nvo;() euoxr ny1lmtn nvil(  rua( ooo1aptoifetltlm eau snt0 etnif ia1fatelies;s)sexm(opnydome  fesas)s2uaxmp;u1tpxomfctadlsDra( o;u0alxomo3oa1laD lu i;()s2xmxrpno4alteliet s aDrm(mp;u1tptn octatls umuvp t0aexnmrctodlatranvsl()srxoxr oodlp  mivils) 2rax onu1tptnmf3ilsfm eau o;u0tetnxf oo1fa   i o s s2tm(r oydolt mnci s)s2raump;t1aexomoeiad m um(mp u0 rxrxrcoatoa  ln s s0texm(o io1ol e ictls) rtm( p;o0tlx iieiyd s ua(monu4trxoxf tytfa elivi;s  eumxr iy1al elfvilt) 2rmu p;u0optomfeiyd s ulnvont0 rxrmf3ta1lmD lnvo (0 rxoxo io4am emfet sf 2uaxm ;u1tpe  fciad m rmnvsn()tleoxfcoodfp  au s;(  exmxopiu1olenmncslsf 2rr(r ;o0open iciadlsDelnvp u0tlenmr totomDelieo () rtmxm oy1al elnetatfaDrrxmp;u0tet mfeiydfaDel(vo;t)arenmfcoytfmD anei s) 2xm(rpoo4ameemfesa()sDtaumo;u4tpeomi3tlsla rmnms (0tlxnir todfaDelnvs s  rtriopoy1llt lict (  rtaum ;t4opxnio3ilsfaDrl( p;u)trtrircta1fmDeaneo;s0 exmxr3nudamtelictl()s2tmxrp;o4aexnio3iyt s ulnmpnu)artoxf iatlpDe n s;() 2xoio3nu1open iesa()s2tau oot4tltnmfetldfa eluvs ()arerxrciadlp r u ilt)teto(m oo1opeelfct tfsrururpot4tlxnioetydfaDulums (0aetriocty1lat lnvslt)t2xm(opny4alte fes s)srrm(mpoo1ole mo3iytfs2rm(ms t4alxomrcoytfa eai ils0t2uoio3nu1am nlfvtltf Drrxrp;o1tpen o3iad s2ulnvp t)treoif3iotfptrlues;t0trxoxm3oodoptnmfes tf 2rr(ro;o0ole  o3tld s uanms;u) lxnxo oytlmte nei;t0t2triopiy1al n feilt  2rmum ou1oet ifctld s rmnvpnu0trxrio3oo1fa   i s ()trxoir3nudop n fctltf Duax  ;u1aex  o3tydfs em( o;u0alxnio3ty1omD anei;t0seuoxr3nu4omte fvslt srtrx  ;o0opt ifeils a ea(msn() lxrir tydfaDeaneslt0t2tmiopoy4om n fvsasfs2rru ono0openmfciyt mDran snt4aexnxr3oydlp  aivi s0 rtm(rpno4ome  ivia()sDum( onu4apxoifciadfa2ul(vp t)trtrmo3ia1fmD luvo s0t2xm(m iodame  feils aruau p;o1tptnmfctyd s2ea( p;u)tlxoxr to1lmt lueilt truoxmpoy1alenmfeslsfaDtmxmonu4olenmoctytlsDrau s;(4aeeomrcoadfat li s s0t2umxm iy1lmee nviat arta(moou1ope iieiatls2rmnvpn(4alxrxo oy1laDelueslt0srtr(opny1openlicil(fsrua(mp;t1apx if3tlsfm2emnvon(4artoxo3tydla rlnvi;s)texrxo no4ap emicta()s2ua(rpnu0tpenmieilsfmDeanmp u0trxnxo oydoptelnei;(0trxrir3io1apteliesls srrm(rpou4tex  oeiltls2ulu p;t0aexnmr tydomD lu sls0teurim iu4lmeemfcsls srraumo;u0apenmo3iltlm2rm(mo;t)alxrio tytoa   i il(0 exmim3iydlp  lict t) 2rm(  ot1tlt iiciys a eanvpn(0alxnmo3oy1fmtrluvs s) euo(mpoo4llenlncsa(fs2umur ;t4aetomfctatlaDea(mp u0 rxoifcoatfatraueils seuo(r oo4lle mnvsl(faDta(mpnt1olenioctadfa2el( s;t) lxnmr3oatlaD aues;t0trtrxo3oudll n fvsas arrmxmpou4tltnio3tldfm rl( snt) exrxociy1lm e iei;(0t2urxopiy4ape mnesasfsDrmu pou0ale iieilt a rmu pnt4 rermfciotopDe ieol(0trxmxm3nydlpee fei sf rum(moot1tltn ieiadfaDeluvp;u4 lerxo3tytoa e nvol()t2urxrpny4lmtelnvs (fs2trumpou4tex mf3tltlmDum( o;(4tlerxo ootfpt anvs;t  etrir no1opeelicias)aDtmxmono1aptn ieild mDrau snt) ltnircoy1lpt  nvo;t  etmxr3nu1lmt mici (fs2tru pno1aptnmietytla2rmnmo () renircootlpDeanvs;s)seuoxm ou4omee fesat srrmxrpno0olenioeiaslm el(ms t0aetnmo oa1lmtrluvi;( t2xrxrpoy4altn ictltfartrumpot0olenifeildfmDrm(mont) rxnxo3oodlaD li i;( teto(mpio1lp nmiei t  Dtmxmoou0aexoiociaslm umu s t)artoxr iatfa e nvi t texm(m3ny1lltelnetat)srum(m ;t4tpxn ocils s ul( p t0arxrxr3oodfmtr iei;s)t2urxm ny1al elfetat)aDtmx pnu1teenmoeiatfaDem(vp t)tetoxrcootfpDelnvs;s0t2tm(o ou4llenlivs s a2ra( p;u1ale mi3iydls2ean o;()trtrio3oa1opD aueil() exrxrpiy4alt  ncs s aDumumpnt1aexnii3iatls ra(vs t) etnmoctatfpDeauvs;t)t2xo(o iu4al  lnciat  2rm( oou1tetn ictat mDuanmo t0trtnxr oadfa elivslt srtrim nudaleelies ( sDuax o;o4oetomfetadla rauvp t0tetoio oydoatr uvilt) rtmim3iy1olee nvta( s2ur(mono1tltoiieiat s2el(von() exnmr oytoat ln sl( s2um(rpnu4ap   ncil( aDrmx pno1olto fctyslm2ra( o (0aetrmf io1fmtelivi;s srurxopiudlpeemies t) Dum( onu0olt ii3tydfm rmu p;(4 lerio to1oa   nvilt0 etr(rpoy4lm n ivi t)a2rm(rpot0olx  i3tydfs ul( o u4treoxo3oodoatrlivs s  2xrirpiodape lncils  2urx pnu1optn oeild mDelump;u4aeeoxr3iydlmtraies s  etr(rpou4oleemicsl( aDrrurooo4tlxomfeiaslm eauvs;(4arxoir oytopD  ies ( sexoxopiydomt  nvilt a2urx ont0tptomietysla rl(mp;()teenxfctadfateai o;(0sexo(mpiy4omt lfeta() 2tr(r ;t1aeeniocilt sDeaumo (4alenio3iotlpDrlueo;t0srxmxm3iudoltn fesa(  rra(r ot4tlxnif3ildfmDemu snt0alxoxo3iotomteluvi ()t2umxo3io1am nmfvi (f Dtmx  ;t4tlx  i3iat aDul( snt0aeerxr3iydomD  ieo;(0seto(o3iodol n fciltfaDrrxmoot1tlxnmfctadla ea(vp;t) etrxrciatoa  lneolt0 2xmxm3iy1llt mncsas)sDtrxrpnu0ole mfetlsfm2rlnmon(4aetoio3tadlp   u s;(  rur(m ny1aptelivs ( sDrr( poo0alx ii3ild m eauvo;()aexnio tytlpDe ies ()t2xoir3ou1op nmnvtat srtr( pnu1tlxnmicild s2ul(mo;u4texoxrcoa1lmD anvo s  2xrxopoy4lleemictlsfsruauroot1apt  oeiyt a2eanvs;(4treomrcty1op eln s t0trurxo io1omt livtat)srra(m ;o1texo fctltfm2ra(vp t0aeeoir iytfm  anes;()trtrio oo4ope  iviat srta(  oo4olxomociyslm2el( on(0tltnxr3ia1lp rlu i;s  rtrir iudoltelfctlt)arurur ;t4tltn fcilsfa2rlumon(0arenxf oatop rlnvo;()sruoxo iydol nlfcsl( srtrxr nu4ape moetltlmDum(mont0 eermo3tydlm  ln o;t0truoxo3iu1olee nvsa(f Durx ont0apen ieilsfmDranvp;(4 rxniocoatoatelneo;( sexoio3oodlmtnlfeilt aDumurp;u0aex mfcilt sDemnvs;()tltrmf oa1lpD  ueils  eurxo3oudom n fvsls)arta( oot1tpen f3ildfaDrmumo (4alxnmrcootlat ai i;(0t2xo(r3ou1lmt mncsat  ruau onu4tpeomietys a2emn o (4tlxomf3iatla ean s;s0truoim ny4ole mnetlt  Drrur ou4olto oeildfa2el(vo;(0 eeniociodop eai slt)trtoxopny1lm e nciat artmx pnt0tpxn fctlslm uanvon() rtomf3iydlp r uvils)setm(o3io1lptn ieilt aDtr(  ;u4oltn feiysfa2eaumonu0 rermfcoytlmD  ueslt0 rxrimpiy4omenlfciat) rurumo;u4opx  fctltfm2uauvsn(4 lxrxf ootomteai slt0 2urxopou1lltelnctat) rraxroot1tleomi3iltfs2rlnvo;(4aeenio3tadfp eaieo;t0srxr(o3nu4llen icias)sDtaurp;u0olxomfetatfsDrlnmon(4tlenir oodfpD  neo;t)s2xo(r3no1lle  fei tf 2tauront1ope  ieilslaDuau onu0 rxnxf3iy1fmD aues ()srtmxo iydape  icsasfsruaxrp;t0oetomf3tlslsDrm(mo u4artrirctydfm e ivi;t0s2tmim3iy4lm  licil( arrr( pno4apenmo3iadlm2umumsn(4arxoif iatoa   uvol() rtm(m3iodam  lfesat arrrxrp;o4alen ocilsls emu ont4areoif tydfaDr n sl(0 2ur(rpiudlleemnvs sfsDumumpoo0oetomfeilt sDrau ont)trerxf ootopt lnei;()trtmxmpou4lm e feilsfsDrrxr ;u1oet  ictlslmDum(vs t)trxomf3tytfa eauvsl(0 eumim nu1ll n fvtatf Dra( pou4aptn f3iysfmDrm( o u0artoxr oydfa raues;( truo(o oo4olt  nciat)aDuaumpno1oet moeils m2emu sn(4aexnxf oy1fp   nei (0 rur(r3ny4ame licta()aDtrxrp;u0tptnifetysla2ua(vs t4 rxnio3tytlpDelnvs;s srtoim3nu4lm e nvsatfs2raurp;u4apx  iciydfm rauvo u4 reoxo todlmt aues s  etoxrpoo4lmtn nvtas) Dra(mp;t0apto f3tldfsDemnmpnt)aleoifcia1opDraivi t t2umxr3oudope  iet tfsrur(r ;o1texn i3tldla uln ont)altrif ta1fmDelivs;s)s2xrxr oy4lm n ieslsf Dta(m ;u0oexn iciytfsDum( s ()trtoir3tatfmDeluvsls0 rxmxrpio4lle  ietlt)s2rmu pnu0aeeoii3iaslsDrlnmp;u)alenxfctytfat lnvils0seurxo iy4ol  livslsfs2tru p;o1tpxomociyslaDum(vs u0aexoircootfa  au s;t  rurxrpnudll  lici s  Dtmxmpou4tpeo f3iatla2ra(vp;t0aeeomfcoodfmtrai sls)tetm(m3nydolt livtls) 2tmxr ot0altnio3tasfsDea( o;u0areoxrctotlaDrlu ilt trumio iy4lpen fvilt aruau  ou1apeo feiatls2ul(msnu0artrif oatlatr nvols  etoim3iodolenmfcta(  Dtrumo;o1tet  feils a2ranvon() eenmrciydlateaiei;t0setr(o3nu4lpe mfcsa()sDurxrpoo0oltoif3iydls2eluvsnt0arerio to1optean o;(0 2trxrpnudameemivtl(  Dtmumo;u0aptnmoeiatlmDrmu s u0 rxnmr ta1oa eai olt0t2xm(rpnydolte ictltf Dtr(m ;o1alt io3tldfsDem(vpnu0 exnxr3tydop  an i s setoxrpoo4lp  lnvs s sruaumo;o1aet mf3iaslaDrl(mo t0 lerxrcoa1fpDeauvi t trum(o3ou4om nmics t  Draxroou0tlxoioctadls2eaums;u4arxrxfcta1fa eln o t)s2xm(opno4amt mici tfsrtm(mp;t1apx ifciyslsDea( s;t4 eeomo ia1oatelnei;s teur(opou4ape licil(fsDuaumpou0aeeomoeilsfsDrm(ms u4 reoio3oatomDeanvolt0 etmxr3oy1llenmnvia() 2rruro;o0aetnif3ils m2el(mont4 lxrif ta1optr i s s0setmio iu1am   nvt (faDrax ooo4tlenmf3iyt m2ran onu0texnifcoy1fmDelieo s  rxmirpoodllt liei ( sDtr(mpnu4alxomieiysfm2ul(mo;u) etrir tydfp r ieo () rxm(r3nudop  mfctasfsrtr(rp;t0tpto feils a2ea( o (4 renmr ta1oat lueo;t)srurxo oo4altnmfvta()s2tr( pnt1alen icildfm ua( s;t)aetnxr3oatlateli o;t0sexmxo3oy4ap  livilsf Dumur oo0apeo i3iys aDemnvo t0altrxo iodfmtelivo s)tetmxr3oo4omt lnvsatfs2um( o;u1opto ictls a2emn o (4tlxnxf totlpDrau s t srtrirpoodom  mfeil(  2ur(rpno4tpxomietltlm2uln o u)aexrxoctatfptr nvs s0 rtmim nudol elicsa() 2tr( o;t4alt mieiyt s rlu p (0 lxomr oydlaDe ivi;t)sruoxm3iy1altn ivia(faDum(rpnu4oeenii3tatfsDea( p;(0trerif3iotomDelu o;(  2ur(m iu4amtnmiei t)sDtmx onu1olxoioetldla el(vs (0 ltrio3iatomDe ues;t) 2tm(r3iodapte ictltfarrmur ou4aptoioeiadlaDrauvpnt0 rxoir todfpt luei;s  etoirpno1ame lncsls)aruax pnu1tpxnifcilsfm umn o;u4tltnmr3todlptrlu s;t0trtm(rpno1lp e iei tfa2umx  ou0tpeoioctlslmDelnmo t0trenmf3oodlaDranvilt) etmxopiodapenmfei sfaDur(rp;t4aetn o3iatfm2eaumpnu)arermr3oadoa ran ols) rxoirpnodal elncil(fsrtmx  ou4alxo f3tat a umnmpnu)trxrio3oy1omDeanvol()t2xoxrpno4ll nlnesltfsDur( pou4oex io3tydfm2rmu p;u0artrxo3todlmt aivils0seumxr nu4olte netat a2ra(  ot0aleniociasls elnvpnt4aetnxoctydfpt livo s0t2xm(r io4oleelfct sfsDtm(mont0oee if3iaslaDea( snu4aexrxf3oatfa rluvi;(0 rtoxo3iudlptelfct ( srumx  ot1tee  fcild s2uauvp u4 etnmrcoy1fpD lueol(0t2xrir3nudope lieslsfsDuaum no1oee mfciltfaDum(vp t0 renircoo1fp r iei;t teurxo iydom nmivsa(  Dumumpno4optnifciaslmDrm(mo;u0arxomf oy1fpD ln i;s0sruoxr3nu1amtnmncs ( a2ra(  ;o0olxo fciat s rm(vonu) lerirciy1omD au o t0s2xoimpnu1ame  iei sfaDuaxmpnt4teeomf3tydfaDemnvo;t0texrif totlm raneo;t) 2toirpiu4al e fcsl(f Drr(m nu1alt  fciytlsDemumpnu0aleoxo io1omD lueo;t0 rtrxm io4om elict s aDrmurp;o1aeenmfciatlmDrm(ms;u4 ltoir3iydfmt anvs;t)texr(mpnu4lptemfcta( sDtrxmoot4tpenifciyslmDrm(mp () rxomr3ta1fa eli i;s) 2trxr3oudll  mnetlsf ruru  no0alxnif3ildfmDemuvp (4alenxrciytom  luei s0 2urxo3nudamtn ivils) rtrx  ;u0tpe iictys sDumnvp u)treomrciadfatr n s;t seuoxr no1lp elivilt  2ur(m ot4apxnmocilsfmDel( on()trtoxrcta1omt li ols s2umxm3nydlpt lnvta() rtmu pou0tle ifciatfm2uln pnt)trtnioctodlmD lueo (0trum(o iy1lm  mfvsas)sDum( p;o0olto ieiysls ulu o;u) eeoio totoa e i ols) 2trxo oydlle lfvsl( sDuaxrp;o4opt mfeiadlm em(vp ()tleoxr3ta1lpD ai o ()srtm(m iu1openmfvt t)artrxm ;t1aet  oeiysla uauvo;() lxnif3iodoa eli o s0 rtrxmpnu1lltnmnvi s  2uaxrpno4ope moctlt sDeanvs (4 rtrmr iatopDe n il(0seumxo3oy1lpe mfesatf Drmu  ;o0aexn fcild sDea(mpn(0aexrxo3tytfatelueol()t2tm(opoo1op nmnciatfsruaxmooo1oexomf3tltfsDulumpn(4tlerir3oadfp  lu ilt0s2xmir3oudomtelfct t) Dtm(ro;u4tlto f3iltfa ea(vpn()teeomrcty1fmDrau i;t t2uo(rpio1aleemivt tfsrra(  ;u4aleomo3iatfa2ranvont4texnir oodoptr ieilt)trtmxr3ny4open fei tf Dum(mono4olt mociyd s emumsnt4 renmocoo1op raneil()setrxo3nodam   ict t)s2rmurono4alenii3tas m2rlumpnu)tlxoxfcoatla   uvo;s s2xo(r3iydapt  ieils  2ra(mpoo4apeomieild m2uluvs;u)arxrxr3io1fa elivo;(0srtriopiu1opt mnci (fs2tr(mpou4oexn f3tldfsDemu pnu)tetnirciatoaDrauvo t0t2ur(opoy4oltnmivs s) Dur(mpnu4altomf3iaslaDem(vo u) lxnio3tytfm r ivo t0s2trxrpoodam elivslt  rta( pot4oexnmiciydfs emu p u0alxrmoctodlmDrau i t)srtrir3oudam nlncsls)srrmu pnu4oetnmieiltls ul( o u4tetoxf oadfpDran ol( t2tmio iydoltemncias)aDrm(mp;t0ape mi3ildfs elnvo;t)texnxfcty1omtrau s (0s2trxopno4lp e ncias) rtrx  ;o0aleo fctld aDea(msnt4arxnxocootfp  au ols seto(opoo4amtelnci s aDtmxmo;o4tptnmoctyt a2rlnvp t4tlxnxo tatfptrlies;t) rxmxo3oy1om n netat srtr(rpoo4tptoifciytfs2umu o u)aeermr tadopt an sl()srumir iodamte fcslt srraum ;u4aee  ieiad a2umumpnu0 ltomo3oydop   n sl(0s2ur(opno4alenlnetatf Dtau onu1aptnmo3ils m2ea(vsnt4aeeoirciotop rlu s () rxr(r nodlp emncil() 2trum ;u4optnifeiyslsDua( snu0 eeomrcty1fptelu s;t)srxoxr oy4al nlivt t)srrru  ;o4olxomieiasfsDem( pnu) rtomr3iodfmte uvo (  2um(o iy1op nlnvtas)sDumu  oo1opeomi3iatfa2ulumont0tlerir oydom rau ilt  rxm(o3nudamtemieta(fsDurx pno1olt ioeiysfs umnvp (4alxnxfcto1op rlnvol(  rurxopou1op e fcs s  Dumumo;t4ape moeiltls2el( pn(4 etnxo3oa1fa  lieo;()truoxopiu4olenmncslsfa2ururoot4texomi3ias a2emn sn()alenxrctotfa eluvs t)t2ur(opou4omt lfvtltf 2rru p;t1apxnmo3iytfm rmnmon(4 lxrmo3iodopDeau s;( s2trxm oo4ale mics sfartmum no4teeo ieiydla rmnvo;()tltnxf io1la rluvils0t2tmxr nydopt lnes s  ruru o;o1oleoif3tlslm2rluvsnu0 eermf3iodoat  i o t0s2xm(o iudlp emicslt)s2rrumpoo0olxn o3ilsfm2rmnvs;u4arxomf tadopD an o;( srxmir3oo4amtnmnesa(faDumx p;u0opx ii3tydlaDelums u) renir3oytfp elues;() eur(mpny1olt mnvta(fsrrmxm nu4altn fcildfs2ul(mo u0aetnxrcootlptrln i;t)trxmxr oy4al elnctlsfaDraxrp;o0aeen ociydfsDel(monu4 ltrifctytfpD  ieol(0 2um(rpnydlm n fvil(farta(root1opxnifciat m2um(ms;() rtnirctydfm  anes s)s2trimpnydape mnet s  rrm(m oo0tlenioctasfa2rmnmonu)tltrxr todopDelu s;t) etmxopnodlm nmneslt) Dtmxro;t4opx  octadfm2rm(vsnt) etnxo3to1fpDrlueo ( texmim3iu1ll elncsasfs2tm( p;o1ope mfcias s2rlnmsnu)aetrir iydfaD aieolt0 rurimpoo1lle  fvi tfaDua(  ;t4apenifciyslm eaumo ()tltoif oydomt liesl( trxrim3io1lptnmfvslt a2ra(r ;o1tpt  ictys sDuanvs;u) exnxf3tytlpDeaneolt texoxm3iu1oltn ncsa(  2tax ono0olen i3tys mDelnvont0 rxnxo oytoa  lnvi ()texoir ou4ameemivil()artm(r ou1oltnmociltfa2rm(mont4 rtnirciatlaDraies s0 etmxr oo1ll nmics t)srurxm ou0aet iicils s em(ms;u)teenmr3tytfpteaivi (0srxmio3ou4am  mfcil( aDtaxmp;t0oee  o3ils aDum( p ()texnif3todlmDrln il()t2tmio3ou1ll  mfesat)artr( ono4tlxnmi3ilsfs rm(vp;t)tltrio3todlptr i s;( t2ur(o3ny1ame mieil()arrm(  ot4aptoii3iadlaDuau p;t) ltniocio1lmteai o ( srxoim3nydamtnmicsls)s2rrxrooo0olto ociatfaDemnvonu0arerxf oadlatrai ils)trtm(r3iy4altnmivi (fsDumumo;t0opeomociadla rmnvsn()aetoxf iodom r i i;s srxoxo3io4om elnvil( arurxmpoo4aleo oetld s2uln s;(4trxomf iotfa eluei t)sruoxo3oydalt  nvta( sDrrurpot4aetnii3iyslm2rlumo;u)alxoxf3iytopDean ols0seumim3nudlle lfet sfsruaump;o0tlen i3ils m el(vo;(0treomrcoytfm  aues;(0 eto(rpny4lpt mfeta()aDtaxront0olx ifetatls um(mp;u4 rxomr tadfmDeaneils0trumxopio4op n ncia(f rrrxm ;u1olxo o3iytlsDrmn o;(4aexoif3ta1fmD luvo t) rxm(rpou4om elics (f rtrxr oo1oet iicildfmDrm(vs;(0trtrmo ia1oaD auei ( s2tm(o3nu1altemfvt sfaruru ono0apen oetltfs rm(vpn(4aexoifcoatla eaueol(  rtoxr3oudame mictl() 2raum ;u0aet moeildla ranvon()aetomrcia1oa r n o;(  etrxrpnu4ap e fetat s2ua(r ou4tet ifctldls rl( on()arenxo3ta1lpt  u s;t) eum(mpiodapt mieta(  rurxrooo4opxomoctls a rlnvo;t4tlxnmf3iydlm e neo;(0t2urxr3ou4omtnlfct (f rtm( onu4tptn i3tltls ra(vpnt0tlenxr oy1lp e uvo (0t2uoir3iu4lpeelfvilsf rtauronu4aetn i3ildlm em( s;(4texomrciotomtrlu i () eurxo3io4altnmivt tfa2ra( pno0tpxomfctltfsDua(vsn(4 reomrciy1oatraivs;s t2xm(rpnu4lmeelietl(fsDum(r ;o0altniociltlaDel( pn(0aleoxo3oytlmtr iei;s  exmio3no1ol nmict s) rur(  nt4alx mfciydls2elumsnu0aetnxo oatlmDr nvi;() etoir oydlle liciasfsrur( pot0oexomi3ildla2rln onu0 etomo tadfpDrluesl(  rxoxo3io1lleemnet sfs2rru ono0aet  oetlslmDulumsn(4 rtomfcoydomDraivs ()s2tmxr3no4lmen ncils aDtax  no0apenifetadfa rmu pnu)trxoxr tydfa   i ilt  rxr(o nu4ome  fci s)a2ur(mp;u4oltniicilt m2rln p;u4 etoifctodfmt li o;s0sruoir3iodllt  nvtlsfsDumu pnu4opxo iciadlm2eln onu0alenmrciodlaD luei;(  rur(o oy1aptnmfvtlt aDrrxr nt4tpxomoetyd m uln o;()arxrmocoadfpt  nvi;( srxm(mpnodop e fciltf 2tm( o;t0alt iietydla2rl(vo;u) rtomociytfmDrluvsl(  exoio3iydomt lfesl() Dtmu pou4tleo fctytfs2rlu o t)artrxo ta1lptr ivol()trumxrpio4lmt lfeias) rta(mpno0ole ioetydfa2rau s t0 exrmrciodfmDrluei;s)t2to(o3nudap  mfes (  Dtr( ont1olxnifcildfm2rau s u4 eenmr tadfptr u o;t0t2tmiopio4om nmictl() rtmum nu1tpe mfcilt aDuan on(4alxrxrciatlm rlivi;t  eumxm ou4openlicils)artau  ;t1tleomfetydla2eanms;(0tetrir3ootlmtrauvs;t0t2xoxo3io1llt lnesls)arraxmp;t0tpeo f3iltfa rmu onu) lxrxoctotfpt lneslt  euoim ny4optelivsas)srtaump;u0open ieiat a rm(vsnt4 eenmf ia1oa e ues s0 2umio3io1op e fvslt a2trxr ;t4tltn ociad a2el(vo t)tlerio todfptelieo s0sexoxmpny1al   nctatfsrra(moot1openmi3tad a2um(monu0tlxnmo oadoaD lnvi;s  2xrxm ny4altnmnct ()a2uaurpnt4openmieiyslm2ra( snt4teenif3oatlp eaneo t trxoxr3ny1optelnvi tfs2ta( ooo0tetn feiys mDraumo u4arxoifcoodfa e ueo t)s2ur(m nudllee nvtls sruaxrooo4opeomfetatfa2uanmsnu4tleoif ta1opt  n sl()s2toir oo1lpen neia() 2tmxr oo4tlxo ociad m umn pnt0texoir iytfp rln s t0trum(rpno1ol e nesa(fs2rmumo;u0tle io3ildlm emu onu4arermo3to1lmD au sl()trtrim nodop   nctl(faDta(  ;u4tleoifeiysla emnmpn(4alxrxf3iotlmD livslt srxr(m3oo1altelnctlsfs2rm(ronu1tlxomiciatfm uauvpnt)arenmf3ootoa e nvi (  etmiopoo4ap nlivsltfartmx o;u0tpeo f3iys s2em(vp;t4trerxrcoytla   neo;s0srur(opoydape mietls  rtmxmoot4oexoiieias a ranvo ()aleoxocoa1om  li olt s2to(opio4opeemnei t)s2rmxmont1oeto octyslmDumnmo;(4alxrmf3totfaD auesls  rum(m3oo4lm  livtas aDtruro;t0open o3iys aDrm(mon(4tltnmo3oa1fpDr ueo s) etm(o3iy1alen nvtls s2ur(m oo4teenmociyt m2em(ms () rxnxr io1la eln i t) exmxr no1omt mfeslt artm(r no1apxniociatfa2rm( p;u)aleoxf tatla rai sl() eurio3nudomeelivt ()aDurxm ou4olx iocils m2elnmpn(0 eerxrciotfm e ueo s  etoio3iy4openmieta(farrrx  oo4apeoiieilt mDul( on(0tetrio ootfmDrau slt t2xmio3iodolenlfetl() Dra( p;o4oee miciatfsDumuvs;(0tetnmo3iodlmDeli i ()texmimpiodop n feil(fa2rmxm oo1aee ii3iydla umnms;u0 rxnmf oadfmDraivo;(  exm(r3iu4oltnlnvtasf 2ur(m ;u4tex  ictldlm2rauvs;t)texnmf3tydfp  au i ()s2tr(m oy4lp n nvi (farur(mont1aetomictltls2emumsn(4aexnmo3iotomtr i o s) rtoirpou4olen nesa(fs2ur( poo0texnioeiadfs2ua( p (0trtniociytoptranes;s)trurxmpio1lmt  ictlsfa2rmu ooo1oetomieild a ulu s t4altoxr3oadlp rli ilt trtmxmpou1lm elfciltfs2tr( ooo4opx  oeiyd aDelnmpn(0areoxr ootfmDrliesl(0s2tmxopiu1op nmnvsl(fsrrmxr oo0alxnmf3iydfs emuvsnu0 eeoxr iadoateauei s0teum(o ou1olenmncs (fsDuau poo0alt if3iydla2rmuvp;(4tetomr3iy1lmtrlu sl(0 etmim3iu4am  lietls  Dtm(mo;u0opt mictasfsDulnvp;t)trtrmfctodfmD  nvil() rto(mpnu1lmenmfctls) 2trx  nt4tpt ioeiat m ulu onu4aetnxociodoa e iei ( srtrio oydolenmivslt sDtaur no0alto ieildfaDul( ont)tltoxo ia1fp  luvi s  rtrxm3iy4ap n fcs s  rum(ront0apen ictyd m rm( p u0 lerxf iytop ean slt)sexrirpny4op elneil() 2tmu  oo4teeoio3iyslm2ua( on(0tlenxf3oo1fpteaneo;(0 eurxr3iudop n ivsas)srtaum nt0tltoif3tlt a rm( p (0 renxf3ty1opteln o;t)trxrim iodopenlivs t aDumurpnt4teeomfetat s2ulu s;u4tetoifciydlaD aues t trtoiopiu4am nlnvia(  2tm(m ;u0alx mfetydfs2umn s;t4arxnxocia1fmtrlneo;t  rtrirpoydaleelicil( sDrrur oo0oeenioctysla uanmp t4 rxnmo ta1omDeanvs;s srxoxr iy1op   fet (f rua(mp;o1texn ociydls rlump;(0aexnxfctadlpt anei s  exm(opnodllte ict (f rrmxm nt1opeomictld a2um(vp;u) eeomo iotlaD ln i t)seuoiopiy1ap n ietl()s2umumo;u1teenmfeias sDua(ms;(0tetrxoctotfa r neo t0 ruo(r ou1ll nliesat s2um(ront1openiociadfa2rlnvo (0artoir to1faDr i s;s0setmio ny4lm  mfct s s2ta(roou0texo oeilt a2ul(vs t)artnmr3iy1fmDe iei t) etrxo nu1aptnlnvs s artm(moot0aptn ictldlsDelumo;t0 etoio3iodoaDelnes;t)teumiopnu4ll emnei (  2umuroot0ale miciltfm rlnmo ()aeeoxo3iodlate nvo;s)s2xoim3nu4am emivils a2ur(mp;o4aexo ieildlm2ua(vpn(0 exnifcoodfmDeauei s0truoiopou4lp   icsl()srua(  nu1tlx io3iytfa umump (0texnxocia1laD  nes;t0s2xr(rpnudal  mncsat srtmxmoou1oetomfciat m ra(mpnt)tetomf3totomDe iei;(0 rtrir3oudomtnliei sfa2ua(  ou4apxoifcild sDuanmonu4 exomr tadopt anvslt0t2xrxm nodlltelivsa() Dtm(moot0tpeoiiciys m2rm(mon()tltnxr ia1lmtrlu o;(0 etoxm3oo1al n fvtlsfarrr(rpnt0oex ioetas m2ulu p u) etnmfciy1lpte ues;( t2xo(o ou1apenmiesls  Dumu poo0tpen iciys s ea( o t)tlerxrcoytlpDe ueols0 ruo(mpiudlpeelfcs t aDtmurp;o4tltoiocildlaDelums;(4arermrcoy1lpDr nvol()texoio oo4oltemictl() 2uauroou0aexnmiciad aDuanms;(0areniocoo1fpD lues;t) rum(r nu1opte fciat artrxrp;u4ole iiciatls2ua( pnt0trxrio oy1faDe u ols  2tr(opoo4lp n fet tfsDrau  ou0apxnmf3iat s2rm( o;(4treoxr tytoaD  u i t0trumiopno4altnlfcsl(f Dra(r ;t4olxo ieiasfaDumnms u) eermr ia1opDe n slt0s2umio iydlpeelncsas) Drm(  nu0tpenmoctadlsDrluvp t) rtnmfcio1oaD lu i;(0trtmxopnu1ap elicia()s2tru  ot0tetoioeilsfa2em(vp u4tlxniocoa1lmtelnei;s0 2tmiopiydol nmicsls arrmu  ou0olenmieiys m rm(ms;(4 ltoio3to1fa  aueo;(0s2umxrpou4amen fci s s2rrumont1oetn f3ild a2umnvp;()alxnxrcta1faDrlu ilt) rxo(o nudlp n ncta()aDururooo0opx mi3iltfaDul( s;(4 eerir io1lmDe nvi ()trurxrpny4lmtelivt s)sDrrum ot4tpxniieiydfm2em( s t)teerio oadomt li o s)t2trxr oo1lp  mfesltfa2um( poo4tet  ietydfsDrln pn() exnio ty1oaDe nei s trumio oydom nlfcslsfaDumxm ou4tetnmociydlaDea( p;u)teeoifciotom   n o;s0 2xoir oodolt  iciat) ruaxmp;o4oee mieiatla2rluvo t4alxnxr3iadfmteaueo;s0t2umio3iu4lmt  nvtlt  rtau  nu4oex  ieiatfm em(mont0tlxrxf3oodfmtraueslt  etoirpoydolt mfci tfarrm(rpot0tle ifcildfs2elnvp t)arerir tadfmD ln ilt0s2toir3nudllt livtat aDururo;t1oexomf3iltfs ulu ont)trxrmrcta1fpDeli sls)trxr(m nodap nlfetl(fsrurxrooo4tpto fciysla2um(vsn(4 ltoircoatfa eln ols0texm(m oo1ope mfcslsf 2tauroot1oetoii3iltfa emnvont) lxoifcty1fp r ues;t0 exmxr oudal emfeslt) 2umumont0alxniicilt s rm( ont0trtnmf oy1fm  aivil( teumio3ny1lmte ici tfaDururoot0altnmo3iadfa rln s u4tetrif3totlm   neo;(  etrxopiudaptnmies s) rtm(m oo1oeen i3ils aDrmn o;t4trtrircoadfa   i i t seurim3iu1lpenmncs ()s2ra(monu0tpen fetas sDeluvpn(0aetoir oatfmD  i s;t setoir iodlltelfes ()srtr( pnt1olt mfetadfm2rlumpn(0altnif tytfaDr nesl()t2toxo3oudop nmncias)arumxr ou1tle  octyd aDra(vp;t)arxoifctytlaD li ils0t2tmxmpiu4amt  nesltfarrr(mpoo1oetnmf3iydlmDraumpn(0artnif3tytfpD  uei;t0srxo(o oudomt lieilt) Draur no4oeeoifetldls ul(msn(4 etoioctotlp eai i s)t2xm(m3ou4lltelnvs ( aDua(monu0oeto feiad s emumpnt4arxoxr3ta1lat  ivs;t t2uo(mpiy4ll  lnvil( artrxrpot4apxomo3iad m rlump (4alxnxr oatfmD an s;(0t2trim iy1lmee nei ()a2trx  oo4tptomiciydla2rmu onu4tltrif3ty1oaD  ueo;t)srxmxr oydoptn icilsfaDur(m oo1aleo ociytlm ea(ms (4aleoio iodlm elneo (0truoxrpio1ol  lictasf Durur nt4tlx miciyslm rmu o () rtoio oydopt an ols  euo(m3nodlmt licia() Dumuronu1olxomf3tltls el( s;u0tleoxociadfmtr uvslt) 2xoxm3nudllt  fei t)artrumonu4tlx  o3iydlm2ulnms;t)arxnxr io1oaDr u ols0 rtr(rpny1ome  nesa()a2umxrpot4olx iieiasla uan snu4 reomf3iotoa r iesl(0s2xoio3nydlp n iet () rrrumo;u0tpxomfetydlm2umn p;t0 lerxr3oa1fa  anvs;t0 2toirpoo1apenlicias a2tax p;u0olt mf3iadls2ean ont0tltrifcoo1omDeaivsl()srxrim no4lm nlici t) 2rrxmp;o1tpx mfetadfs uanmpnt0arerir3iy1latrauesls srtmxo ny1lptemfesl() Drmx o;t1oltoii3ilt s umu onu4trtnmf3todfa raiesl(0srto(r3iodol nlivtls s2urx  oo0olxnmociyslmDrm( p;(0aetrxrctodfm  lu i (  rtm(o3iy4alt livilt srtruro;u1opx mfciad s umn s t4aexoxocoatoa  aueols s2xo(r oydam  lneta(faDuaurp;u0alx  f3ild aDrl( p t4 ltomociy1lp r n o (  rumir oodomeemfctat s2tau pnu1ape iietysfaDem(mpnt0aexnmrctydomDe nvi s0 rxr(opno1lptnlfetl(f Drmumpno0oeeo feiys s ean s u4tlxnxo3iotoa  ln i s0trurxo3iy1lmee iesl()s2tr(m oo4olx mi3ilt s2rmnvpn(0 rxriocoo1la   iesls)setmim3nodlmtemfvia(  2ra(mo;u0alxomfetyslsDuaumon() lxrxr3oydop e uesl()s2xrirpiu4apenmnes s  rra(  no1tleomfciys m2rl(msn()arenir3oy1fmt aivo ( t2xm(opiu4lp emfcslt aDrrx ono4oleo fciasfmDrlnvo u4 eeoir oatoatrln slt)srurxr3oo1opt micil()aDum(rpno1oex moctlslm2rl( p;(4trxnio oytfatrlnes;s) etrxr3ou4ome  fei sfa2tru  ou0tpeo ieiasfsDranvs u4 etriocty1fp e n i;t0sexrir ny1ame mfesa()artaxmp;o0aet mi3iytlsDemn s;t0aetrxocio1fp   n i;(  etmir oodal   nes t) 2ur(r nu4opxnmfetytfm2em(mo;u) exrmo3todfpt auei s) 2xmxr3iu4lpeelnvslt  Duru pot4olt ioeiadfsDraumsnt)arxomfcoo1fa eaiei;s) exm(r3ou1ap elfvia( srtaum oo1tetnifetadlmDuauvp t4 ltnxo iotoatraieo;t0seurxrpio1opeemfesa()aDrmu pno0tle  i3iytls eau o u4altrmfcoadlm rli sls)t2to(opnodopt  fctls) 2raum nt4tpeo oeilsla2uan s;t4artrxr3totlateauvi ( srurxo iy4lmee nvs s) rumx  ;u1oleomoeiys a rmu s t)tltnmfciatom  au i;t0 rxo(mpou4llt mict () rtaxr nu0aptnif3tatlmDemumpnt0 exrxfcoy1lm r u s t)s2xm(mpnu1altnmnviasfaDrm(m nt1aexoifetasfsDul(msnt)aeenxf3ty1fm rlivs;(0 2uoimpnu4lpe mfct s)a2ua(ro;t1tex if3iltlm2ea(vp;(0teeoif oodlptrluesl(0sexo(rpnydlm nmicils sDumurpno4olenmoeiatfm2rmu o;(0areoxocootfa raieol(0t2xrxo3oo4oltn netas)arraurpno1aeen i3iad mDrm( s;(0tlxnifciy1oaDeln i s srxr(rpiudlmt lfvt (farrm( pno4alenmfeild a2elnvs u0trtnmf iytopDean o;t)sexoxo3oodomtelfct t a2urxr no1apx  oetaslmDrl( p (4aeeoxf iy1fmDranvi;( s2urxo nydopt mnetlt)a2um(rp;t0altn fciydlm ra( on(4tetrxr ootlpte n i;s srtrxm3oy1lpenmies (fs2urumpoo0tet  iciltla2el(vo u4aleomr3oydop eau s s srxr(r3oydole  neta()artrxrp;t1alxomf3tlt a rmn s t)alxomocoo1om eaivi;s s2toxo3nydapte ivils) 2tmur ot0aeto ictytlmDel(mo t)tltrirciatla rli ilt) 2xr(rpou1ol  lnesltf 2rmxrp;u0tptomf3ild aDrl( o;t)tlxomf tydoaDe ivil(  2uriopiy4om nmnvs s aDtm(r ;t4tpx iieias m umnvs u)tlxrxocoydoatrai i;s)s2xmim ou4llte nviat  2uaxrpnt1opto oeiyslm2eln pnu)tltoxf3oy1oaD luei s)srum(rpnodal  lncil( aDtmxrooo0tpe iieiysfmDul( s (4aexoio iy1oa eln i;() 2umio3iudomen fetlt a2um( oou1tpx  feiaslaDrmuvs;(4aetoxo3totom eai s;t0seurio no4olt mfciatfaDtaur oo4ale  iciad a2rmn p;(4 rerxf3ootfmDraiei s  exr(opoo1oltemfcta( srururono1open oetyslsDeln s t0 rtnifcia1opDrlivs;( sruoxr oy4lm   fcs s) rumx pot0aexnifcildls2umn o;t4artoxrcootom ranvsls sruoxopnu4ol emnetlt sruaxro;u0olenmictysfa2ua(mp;t4tetrif3oodfaDrlnes;(0texrir oo4lme lfvi ( aDtr(ro;u1tpt  f3ils m2ranvonu0texrirctotlptelies s srumxm3ny4lmt mfvilt  2rmxm nu0oexniietldla2eluvon(4 lerir3oatlpD  ieo;s truoxmpnodopt mncils) rtrumpnt1olenmo3iytla rau on(0alxoif todoa r iei;t) 2um(r oy4om elnctls)a2uru p;t1apt ifetydfsDrmn s;(4altnmfcoo1fp r u s t0trxo(r3ny4ape  nvtas)s2tr(rp;t0tltoiiciys aDrluvsnu0trenmo3iytomt ln ils seumxo3io1ap elfvi (f rta(r ;t1tex mo3ilslm emump u0arermf3iatlp raivols)s2umxo3iu4lmtnlfvia(faDra( pnt0oeeoioeiadlmDranmont4 exrir3tydopDeau i () 2toimpnudamtelnesatfa2taxmonu1tet moetyslmDea( pn() eeoxf oy1lp  lueo s texmxm3iudlm elfeta(f Drrumpnu0olx mociasfs um(vpnt0tetoif oytlpDraneo s) eurio3oydop e ivi s srum(moot1aexnio3tatfm emu snt4 exrmocio1faDeaies;s0trumxm3iydlpe lnct tf rtmx ooo4olxomfciytla2raump;(4 rxrxr3oydoa   ivs t seto(opoo4olen fcsat)a2ur(  no4olt ifciytfa2umnvp;t)aetnxrciatfa eaues;s0srxm(m nodlme  iciat)arrrumoot0olt ifciatlm2uau s (4aleniocoatlmtranvi;t0s2toxrpnodoltelfvsasfartrx pnt1tetnmoeiyslmDrl(vo;u4areoxf tadlatrlues;t  eurir3io1olt  fet s)sDrmur no4apx  ociasfaDelu o ()tlenir3ootoaDeln s;s teuoim nydlm n icils artmump;u0alxo f3tltlm2ulumo (0tlenmrciydlmt  nes ()sruoimpno4lptelneia()arraxrp;o4oeen ociasfaDem(vs (0 lermr tatomDrluvo s0 euoxo io4lm  mivsls sDtau pnu0aptoifeiaslaDel(vonu4tlxoxr3tydfp  ai ilt  eumxr3ou1om n fes s s2tax  nu1tlxo o3ild mDeln p t)texnmfcoodlmDeai il(0sexm(m3iy1omt  ictatfs2taxrp;t0opxomo3iltfaDrm(vs;t0 etrxo3iadfmD  nes;(  2tm(r no4om  mivt (fa2tm(m ;t0olen ietyd s rmnmp u)tetrif3ia1fatrlu i;(0 rtm(r no4lpt lietlt)a2urxm ou4tee mictys s ul(mpnt)teermo todfmD lies s0 rxrxo iy1lleemivsa() Dua( pno0altoioeiydfm ea(vs u0trenmf3oatfatrlu s;s0seuo(m iu1omtnmncsat) 2urx poo0aexn ictlslaDra(vp t0tlxrifcoydomteaieslt t2urxmpio4optn nesa( sDtmx  ot1tpe mociyslm eanvsnu0trtoxo3totlateln i s)trumxopnydll  mfcslt)arumu o;t4aexo oeiys aDeanmp;u4 exoxfctydom r u o t) rxoxm io1apenliesat  Dta(r ot4tptomf3tld m2umums;u4 eenmf ootlmD an o;()texrxrpnu4olenmiet (faDraumonu1aleoiociasls2ra( o t)tlxrxrctadfm   ies () etrxrpiu4ap nmnvt tfsrtmxrp;o0oetnifciytfs2ua(mont0alxomfcty1oa eanvsls trxoiopoodaptemiesls) 2uau oot0alt  ictatlmDranmpn(0tlxoif3ootom rluvo;s0srxoir3oo4alen fct t a2uax  nt1alx io3iydlmDumuvsnt) exoxf3iatoaDe nvi;(  2trio3nodome mfci t)a2ta(mo;o0olx ii3iasls rmu o;() rtrmrctydlp e n olt0s2toimpiodlp nmnvtl( a2tr( pot4tpxoioeildls ea(vpn(4alxoiociodfm elu o;t0 exriopnu1lme mfcta()sDta(mo;u4tpe mo3tysls2ul(vp;u4 eermf3iy1fate neo;t sexoxo ou4lp nlfcsas a2ur(r ;t4alxoiieiytfa2raump;() rxnmrcto1fpDrlueslt  eurxopiy4ape lfctl( a2ur( pnt0oet if3iytla em(vo t0arxomfcoatfm e i s;t0s2toxopnydopeelfvs sf rur(r ;u1aetn i3tls mDea( on() ltrxf iotom rlu o s0 rtmim ny1ome  net s  Dtmu ont4alen i3iadfs em( pnt4teenmfctotfaDrai o t0teumimpno4lm emieslt arrmxmo;u0open octltlsDelu s () etomocta1op rlies;t s2umio3iy1lm emnvias sDumxmp;t1tlxo iciatls rmu s t4arxrmf ta1fatrai s (0 rtrimpiydlp nlivilt) rumu pno1optnifciydfaDulnmsn()alenxo3ta1omDelnvi;s0 etrxm nudlpeemnes t arta(mpnt1opxniiciydfsDulu o;(4trenio oadlpDe n ils) rum(r3oo1oltelictat)srrmu ooo1tet iociatla el(vo u)aexoirctodfat  u ol( s2urio3ny4amtelivsltfartaxm ;o0tet  ictydfa em(mp;()trenxo3oo1omteln s ()t2toir3oy1optemfeils)s2uaxrono0olxnii3ildfs2rmu o t4altoirciotlm e neolt texrxr3ny4lp emnvil(f Duaxrp;t4tleomi3tydlm2umumonu) lxoircoytlateanvo;s)t2xm(r no4lpe lfvs (f 2rmxmooo1open fciysls2umu o (4aetnirciatlmDe ues ()sexoim3ny4om nlivilt)arrm(mpot4aexomoctysfs2rmn s u0aetoxrcoydfateaivs s0tetm(rpou4lmenlnesasfsDtaurpnu1tpeoio3iatls ranvs;t4arerio to1lp ranes;t)trxmir3nudameelfesl(fsrtaxr nt0oetnio3tlsls em(vs t0alxrmf3tytlpteanvs s0s2xrxr io4am emneta()aDumxmooo4tet  feiyslsDranmsnu4tlerifciodomte uvo;s0 2to(mpnudlle  iet s sDtr(rpno4oetomoetls s2emums t)tetrifctadomte ues ( truoim3iu4ole liesl(fsrumurpou0oetn ociltfa eanvs;u4 lenmf oy1op rluvs ( teuoxr ny1ome  nvsa() rur(  ou1aptomicilsfm umuvp;t0 eenioctotom raieo ( t2umxopou1altnmfeil(  Dtr(m ;o0alxomfetyd s uauvp;t) eenio3ia1optrlieils) etoxr nodameemics ()s2umu poo1tpxnmi3iytfmDulnvo;()aexnio oa1lateaies;s0seumio ny4ll emivtls)srtrxr ;t4olt moeiadls rlumo;u4aexnxocoatlpD li sls)srxmxo ou4ll emici t) 2ua( pot1olto f3ild s2raums;u0aexnircoa1omDelu sl( t2xrxrpny1ole  fvi t)sDua(  ;u4aexniieiydlsDem(vo;u) exoxo3oadlmD luvo s s2tm(r3no1apee nci tfa2umum nt0aptniieiat aDuaumont)aetnxocty1lmtrln o s sruo(rpoy1ole  fcil(  Dra(r ;t0aexo feiad a elumpnu)tlxoxfcoydlm  auvilt setoim oy4optelfet tfartaur ;u1tlen i3iysfaDuluvp u)teerxfciotlmDeluesls trtoxopiy4lme  icta(fsrtm( pot0apx  iciysfa2em( s t) rtrio3ta1om  livols  rxoxo3no1lpe lfesatfs2rmur ;t4tpt mi3ildfaDrlnms;u0 ltomr3oatomDe nvsls) 2um(mpiy4ap elnct () 2tr(rpot1optn feiasfmDrm(mo u4 rxoir3ootfptrluei;t0srtrirpnydaleemncs (f rtr(mpou4oexomietytfaDrmumo;u0 leomf3tatlpD auei s srxmxo3ou1amee nci t)a2ta(  no0aeen ieild s rlnmo t0teermrcoo1lmDeau s;s0setm(r3oy4al elnvtat)a2umxm ;u1tetoiietysla elu s t0tltnmfcoytlm elivilt  exo(m3ou4ol  mnctltf 2uau pou4oeenioeildla2rlu o t4 rtrir oodop  lueo;(0tetoxm oo1lp emivt (  rtau pnt0alxo i3iyt a umnvo u)aeeoxfcio1fatr nvilt0texmxm3iydlmt  ivtl( srrr(ront1oltnmf3iltlm um(vo u0teenxo oa1fateauvi t0srxrxo3iy1lmenmfcia() Dtaxmp;o0oee  octldls2umuvs u0 exoxocoatfp elnvol(0 etoir ny1lmt lnci s srumu ono4tleomietatfm2rmn ont0aexrxociatop ean o () rtr(o nu4am elivs s a2tmu o;t4tltnii3iadfs rlu p;u0trtrmocia1lm raivslt)srtmir io1omt lnetls srua(r ;t0apxn ociatlaDrmuvp t0trxnmfcoy1lptrli il()srxo(r io4omeelicsatfaDrax p;o1optn o3tysfa rlu p t4 eenif3oo1lmDe ueilt) rtoim oo4ope mfvslsf rtmx o;t1alto fciaslm2elnms u0trxrir todlat an ol(0trtm(r oodoptn ics s  2rm(r nu4tpt iiciysla eluvo t4 leomf iadfpD  n o;( t2xmirpio1apen fet t)aruaxmpnt0tpxo o3ils s ulnvp (0arerxo ootlptean ilt srtrir nudlp  mncs s  Drr(rooo1tlx miciltfaDra(vo (0alxnmr3io1fm elneolt  ruo(mpno1amte ivslt aDuau  nt4opxo fetyslm2uauvs ()tlxnif tytfmt lnes s t2xoim nydaltemfcs tfarta(ro;u0opto iciat a rlu o t0tlermocto1la  lies t0teur(opio1opee fcilt aDtaxm nu1opxomi3tad aDua(vo u)tlxrifctadomDeli o s0trxm(rpiudomee fvsl( sDrmx  no4olto f3tltls rauvonu)areomo io1oa r i ol(  2tr(o3oy1al nlivsa()srrax oot0oeenifciatla ra(vo u0alenxf oatom eaivolt sexoxopnydlmt lnvias)sDrax oou0olxnif3ilslm uanmp;t4trtrxo3oatlaD lnvs s  exr(m oo1lpenlicia(  rraumooo1apen f3tat s2ra( s (0tlermf3oodlpte ieil(0s2xm(o ou4lltnmfetlt) rtaxrpnt1optomictas s2elnms;()arxrxf totlm   n slt) etoir3io4opeemnvs (f 2ra(rono0oeeo ieiatlm rau p () ltrxoctydlate nei;(  2xmim iudlme  ncilsf Drmumono0opxo fctadfs2rl(mp (4 etrio iatlm e ues s trxrxr nu1lp  mieias)sDuru o;t1aet mo3iys a2eluvs t)alxoifcta1omtr i ilt0t2xmio3io1lpt mnetatf rrrurpou0opeo i3iltla rl(vo;u) lenmr oo1oat  n ilt0 rxm(m3oo4lle lfci (f 2umum nt4aeeomoetatfa umu s;u)trtoif3tadlpD ln ols0s2umxo nydal  mfvt (fs2rmumpno4tptn o3ild mDrl(vo (4 rxomf tatomDe ies ( teuoxm nudom   fciat) rrmuronu1aee  icias a rau o u)arenmo oo1oatrlivo s)tetmiopiu1apenlnvias)sDuaxmp;t1opeoioeiyt s2rlnmpnu)aetnmocio1fpteauvolt teurim iu1omen ict t aDrrx  no0texo f3iatlm rm( pn(4 lerxo iatfmD  nvil( srtr(r no1apen icia(faDra(r ;u0teeoifcildlaDeln ont4trtrxr ia1la elu s s sruoim oy4olen ivtls)a2umurpoo4tle mieiaslm2rlump ()artrmrctotfmDe n o s0 euo(o3iu4aptn nvia(fsrraxrooo1teeomfciytfs2um(msn() lermrcoo1lm r ueo;() rtrxo3iy4am  lnvt ( aDra(  oo1aeen ociasfm ulu o u0 reoioctydlate nes s texrio nodamtemfetl(  rtaxr oo4oexnio3tysls emnvp;t4tlenif oytlm rlnes s) rtm(m iodapeemnvtatfarrrumono1oleoioetadls2umuvp t0 rxrirciytlm  aneil()teumir nydlmt lfetls)a2rauro;t4tet mo3iydfa2el(vo (4 rtrio oydlmDr i o t) rxmxm iodaptemfes tfaDra( pno0aeeoifeiatfmDrl(monu0tlxomr oy1lpt livo s0 2xrxo oy1amt lncia() Duaur ot4ole ioetysls ulnvp;(0tetoir3to1fatrluvo s) rum(o oo1apeelnet s  2uaxmonu4tpeo i3iyd a2uau o;u)aetnir3oo1lpt  ues;s)t2um(mpnu4lmee netl(  Dra(mpou4oltomfctysfmDra( o;(0 rxnmocto1omD  nvs t texrimpiu1am   fct t) rtaxm nu4aleomf3iyt sDranvs;u4 eerxr3oodlmDe ieslt0trxmir3nudapenlfct s  2tmx ont0aexoioeiltfs2el( s u0 lerxfcia1fm  au i t0trtm(rpou4ope  fcta(fs2umu pnt0tpen ieilt mDemu p;()tleoio tydoatranvs s t2uoim ou1ole licsl(fsDrru p;t1aex mfctlslaDumuvpn()texrioctydfpteaies;t)seur(r iydolt livtl() Drax pot1apxniietltlaDrm( o;t4arxrir3oa1oaDrlneol(  rxrxo3nodolee fes (fa2rrur nt4optoii3tld sDrm( ont0arermr ootlptraneil( trurxmpiu4alenmfct tf 2um(  ;t0oex  oetadlm umnms (4aeerxrcty1fpt  ivil(0t2xoir3iu1al emfvsltfa2raxr oo0tpxnmi3tasla2elnms ()aexoif oo1oa  anvsls0t2xmxr3oo4lm nmnvsat sDtmx  ;o4tpt mo3iadls2eluvs (0 renxrcoa1lmt aieo;t tetoxrpio4lptemiciat)arraxm nt0aptnmi3iytls rau s;(4 ltrmr oytom rlnvol(0 eum(rpno1amee nei ()srtaumpno0apeoiictydlm2uauvonu4 lxrifcto1omtr i il()teto(r oudalee ivsl( sruaxm ou4oeenii3ildls2ea(mont4 exrmfcoo1fatraueilt)teumxo3iydal n ici sfaDrmxr ;u0tleo i3tadla emnvp t4 reoio tadopD  u sl(  2xrxo iy4oltemnvt s) 2rrxmpnt4opeomf3iltfmDem(mp u0tltrxr3oydlmD  uvs;s s2toio3oudlpe livs sfs2tm( onu1tlxnifeiaslaDum( onu) ltoxo3iytomt  uei s)sruoxopoo1lpte nesls a2ua(rp;t0tlt  fcilslsDrmums;t0 ltrxf iadlp   n s s0texmxopiudal  mnvsat)sDurxronu1olxoiieiat m2rmnms;t4tetomoctydoaD luvo;t0tetrxm3oydam nlietas  Dur(m ou0opxomicild s2ea( pn(0aexnxrcty1om r i ils)trur(m3nydol  mnciltf Dum(mpoo0aptn o3ils s2umnvo;u4aetrmrciytlaDe i s;s) exmxopnudam nlneiatf Dtaxr ;t1alenioeiadfa emnvp;t4alxomocoatfp  aueolt)t2xriopoydoptemfei s srurx o;t4aetoioeiysfs elu o;t0 eeomfcta1lmt anei;(0srtoim oy1om emfci ( a2uaur ou1olenmo3tltfa umu p;() rtniocoydlp  aieo s)teurxopoodamtn feiat) 2rmu ooo1ale mfeiyd a ua( s t0altrmf3iodlaD livo;t0texrir iu4op emfeiat  Draxmoot4oleomfcils a2eauvp;t4texnxo3iatfmtrlieil()texr(o3iu4oltn fvia(fa2tmxmoou4tltnioeildfmDrluvo;u4texoxf ootlmt lies s0s2urxopnu4alt lfcilsfartrxrpoo0olx ifeiad sDrlnmont)tetnmrcoa1om r u ols0t2xm(m ou1alen ictat  2uaxroot4tpx iiciltlmDrlumpn(0 rtoxocootomtrln ilt0texo(mpnodll nmfesasfarrmu pot0aleoiieiad m2uan p t0aeerxr iydoaD anei;s setm(opiu4amee nciat  2tr(rono1tpeoioetydls ulumpnt)arenxr iy1lmDe u ilt0s2umxr3oo4apeelnci t a2taum ou1aeto o3iltls ran p t4trtomfcoytoaD aiei;(0tetm(m oy1lm elivtat)arrr(roou4tetnmoetlsfaDrm(vp u0trxnxociydfaDeln i;s0sexo(rpoy4ol emnes t  2tr(rp;u0texnifetlsla ul(vo t)aexoif iatla e u ols0trtrir ou4lmeemieiasf rrax pnt0texnio3ilsfm rlu s;(4 exrxrcoytoa   uvil(  exoiopio4ol  lfeslt  Drm( pnu4opeoio3iasfa uluvpn(4aetrirciydfpDeai slt0trtmxo oudll   ieslsfaDta( poo1teen feiyt s um(vo u0 etomr tadlmDeluvo;(0trtoimpnydlmee net tfs2ururoou0oltomi3iatlm2raums t) exoxf oo1oaD luvi s teum(m nydaleelivilt)arrau  ;u0aetnio3ias s2rmuvs u4aleomo iodlmDrau i s)srtoxopiy1lmtemnvs s s2tax pou1tptnifciyt mDrl(mp (0altnxocoodla e i i (0s2tr(opiy4altnmnct tfaDrr(m ;o0opeo feiyd a emn p t4teenxociadom ranvils)tetoxr3nudlpeemnes t)a2raurp;u0oetomi3iadlm2uln o;(4alxnxrcoatlp eaies;t  exo(mpoydapenmivtl()a2rmx pnu1apx mieiasfaDeauvo (4areoxr3todfptrli i;s tetmir iu4ol nmfvi s sDta(monu0oetomo3iasfm ul( s (4 rtnxr totlmt  ivo t setmio oudol nlfct sfsDua( pnu1apxo iciytla2rm(msnu0texrxociadopDeln s s0t2trim oudll elfeils  Dtaxro;o0opto f3iyd a2umuvo;u0 etoiociadfmD livilt0t2xo(rpou4lme lnvta(fs2trur ou0apx mfeildfaDelnms;(0 ltnmf3io1fm r neilt)truo(r iu1lleelfcia( sruaumont1ope ifeiydlsDea(ms;t0teeomf3todopteliesls0s2xrirpio1lm   iesa()s2ra(mont4oetomi3tys s rl( p u4aetnxf3todfatrluvo s  rtm(opiydlm  lnvslt sDum(r ot4oexnifetlt s2um(vp;(4 etomrcoodlaDeli i t0texm(opnu1olt mivs (f 2rm(rono1oexomiciytlsDranmp u) etnif oadfaDr neo s)tetm(m3nu1lpte ieilt)sDua(mpot0tetoifetadfa uluvpn(4 eenxocoadop elivs;s0 rum(m nydale mics (  Duru ono4teen fciatfm2eanmpnu0tlerir tytlaDe nes;s0texmio3iy4lpeeliei t)srrru ont1olxo fctlsls eanvs u4tlxnmr3tadlaDelnvo;s)sexoxm oo4al  lics sfarraum nt4tex  oeiadfa2rlu p;()aexrxf iydopteai s;()setrxmpoo4opt lfvsl(f rra( p;t0apxo i3tldlm ul(mpn(4tltrio3tytoaDrau i t srum(opio4apte fcsls aDrmurpnt0oeto icils m ra(mo (4tlenxo3to1fp rluei () exm(mpou1altnlici (fsDrr( ooo0alxnioeilt mDrmums u)trtoxrcta1op   uei t0t2urxr3no1oltemncs ( a2ra( o;o0alto ieias aDum(vpn(4arenio3ootfatraivi;(0 rtoxo3ou4aptnlictatfaDraxmpoo1tet ii3ildfs2ra(mp;(0aexniocoydfm rauvil() eumxo3nodamt mfvias  Drrxr oo4opxo i3iat a2uanvsn(4arxnif3iatlaDraueilt) 2um(mpoy4opt lncsa(fs2trum ;t0tpeoiieild s em( on()alxoircoo1fmDrauvs s)t2xmxm io1oltnmfvsls) rrax p;o1tpx ii3iatfm2elu pnt4texomr oy1fm rai ols) 2trirpou4openlfeta(  Drmu pno4tlxnmfctlsfa2emn p;u4texnmf3iotlp  ln i;t)sexmir3iodame  ivs tfarumxmp;u0oex  ictydlsDraumo (0 exnmr oatfatraieo;s0teuoio3ou4oltnmnvi tfa2tmxr ot4aetomf3tld m emnvon(4teenif oatlaDraivo ()teurimpiu1amtn nesat)srrrumoou4tlxoiietyt aDemn s t4aeerifciadomt aieo ( teurxo iu1al emfcilt)arrr(mpot4tpxomi3tltfa emnvp t4teeoif3oatlmDr n olt0texr(o3nu4lltelfeslsf rrm(  ;o4aleo oeiatfs2rm( o;t)tltnmf iy1lptrli i t0s2xmxrpnydlpt  ictlt  rra(ront0oetnif3iat s ulnvp u0trerio tydfm rau ols)texrxmpny4apeelnci s) rrr(mo;u4oex if3tadlsDumuvsnu4texriocia1lp eliei s)tetrxr3oy4al nlnvt ( srururoou4opxn oeiat s uan p (4 etoir3oatoaDe u o;t) exmirpnodopen nctat)srta(roou0altnmo3tltlm2uluvs t)tetnio3iatfateln i;s) exoio3iy1apeemivi s aruaxront4oetnioeils m em(vs;(4 leomrcty1fmD livo ()s2tmir3iy1lmen nesat srrax pnt4opx  iciyd mDemumon()aeenmo oatlpDe ues;t srtr(r ny1op elictlt)sDururp;u4tlxo oeiys s um(von()teenir3ta1fpDeaivi;( t2xmxm3nodameemnci (faDrmxr nu4tpeo ieild s rau pn()tetoxocoatlatr ieol() rtrxo3iu4lpte ncsa(fa2rru pot4apxomo3tldfs2el(vp;(0alenxrcoydlmDraivs;s)srurxmpiudap nmfet t sDtr(r nt0aex mo3tyd a2umn s u)aexoir3oydfm rluvi s0srxo(opio4lptn neiat)s2tr(  ;o4open ieias m2rauvs t0tetnir3io1lpt ai slt0 rxm(m nu1amtelivtl()srrax oot0apt mf3iytla ul(vp () eermr3ootop   iei s0srtoxmpiu4alt  nctltfsrraxrpno1tet ii3iadfs ul(mp u4texnmr oatfaD au ols setm(r3iudope  nctl()aDrm(mo;t1alx  oeild s2umnmp;(0trtoxfcoatoptraneo;( s2trir3iy1omtnlivs () Dra(r ou1ale iociydfs2rauvpnu4aetnmo3iotfmDrlnvil(0seuoir3nydamtemicilt  rum(mpoo1tle ii3ils aDemumsnt4alenxrctytla rlnes t) rumxopnydop nmics ( sDuaxr nt0aptn ictatlm ranms t4arerio ootfmtean o s0srtmir3ny4ame lncs t  Drrxrono0aet mfciyd a eau p u4 leniociy1fa eli s;t)texmiopiydll  lfviasfaDtaum oo4tlxn i3iad m eanmp;(4alerxo oatlateluei;s) 2xrimpiu1op nmnvtlsf rtr(r ou1apxoifetlslm2uln s ()aleoifcta1fptraies s) rxmimpno1al  lfetls s2tmu  oo0oexoiiciadls2ulnvonu4 etoio3todoat anvolt0 2tmimpiudll  mnetasfsDrm(rpnu4tee mfcils s ra(monu4altoir3tadfatrlneil( sexoio oy1alte nviat srtax pnu1alxnii3iyd a uan onu4arenxo ia1fa rlivo t)trxoio nudoltn nvs s)sDta(  oo0apt ioeiysls2ulnms;(0aetnio todfatr uvsl() rxoir iy4llenlfci s)srtm( oot0tlx  ieildfm ua(vpnu)arxnifcoodfpDe nvil(  rumir io4am elneiat a2rruroot0alxnifeiasfs umn o;u4treoxr3io1lpD  nvs;t) rxrir3ou4omte ivta(  Drmxmo;o0altomoetlt a el(vs;t4altrmf iydfa eli s;s) rumxopnydal emnetltfarraurpnt0alxoifcild aDuluvo u)arenxo oa1laD anvs;s  2urim3oo1apte nvi s)sDtr( p;u4tpx mfeild mDum( s;t0altnir oadlmDeauvs s0 2tmir oo1omenlfcta(  ruaumpot0tlxomo3tldla em( snu0 exnxfciydlmtran i;( teto(rpoo4om  mfcil(fs2rm(r ;u4opeoiicild s rmu snu) rtrir iadfpt aneol(0s2toio ou1al e fetat aruaxrp;t4tpeomo3ils sDua(vsnt)texoif oytlm ean ilt  exrxo3nu4lp nlieta(  rtrxr nt4tex mfctysfa2uauvo;(0trermrcio1opDranei ()t2tm(m oydop emncilt)sruaumonu1openifctydfa2em(mp;()tltnifcootlaD  u slt) 2xr(o3iu1ll elfei (f 2rru  ;t4tltnmfctaslsDelums u)teeomr3iotoatelnei;s  2tm(mpiy4altelfcsas s2rr( pou4tpxo ociltls2ua(vo t)aeerircty1la e ues;s0srxrxo3ny1amte ietas)artrxrono1tle mieiad a2el(vs;t0trxomf3ia1oaDelu ols0srtmirpoy4am e fetatfsrtrxmo;t0alt iictytls eanvs;u)trtrxocia1la rli s ( setmim io1am nlfeslsf rtaum oo0teto ietatfaDuanmo u4 ltnmocoytfm eaiei;()setoim no4ll e fesas sDra( p;u4olx io3iatlsDulnvs u4teeoif3ta1oaDelu ilt0tetrxo nodopee fctls) 2uax pno0alxniieiydls2um(mo t)teerif ia1opDeaueil()tetrxo oydop elncsat)a2rrurpnu0ole if3iytfs2ra(mp u)tetrxf tadfatraivi;t t2ur(o oo1op e ivs tfsrum(m nu1aptniieildfs rmnmsnu)artomr oadopt anvslt0srtm(o3oudlm nmfvtlsf rurx  ou4aeeo o3ild sDea( p;t0aeeriociotfa elu o;s) rtoxo iodlme  neias sDrru ont1oexomfetytlmDrmuvo;t)alenio3iotlmt ai i t) rumxopiydllenmieilt) rtrx pnt4aexniietys sDel( p u4tlxrmo oodfa elivi;()srurim3ny4lmt micslsfs2rmur no0teenmiciyd m2rauvpnt0trtoio3iatop e ivo;(0 rxr(m oy4omtn ieta(fsrrm( p;o0tlx  iciltfs rl( s;()tlxrmo iytoa   ueils0 rxmxr nodll  lnctat)arum( ono0oleoifetydfm emnvs;u4 ltrircoatfa ranei;( srxrxopou1alt lncils  2rr(m nu1aetnmicilsls2umnvp u)altomrcoa1oa eanesls  rtmxmpiudoltnlfcs tfaDrax p;u1tptoifetltlm2ul( s;t0aexnio3oadfptr u ols) etoxo3oo4olt lfcs sf Duax o;u4tpe if3tytlm2ulumsn() eeoif3io1lpD  u i s)s2xo(m iydlmtemies t aDurxr ou0opt mfctydfa2ean s;u0 lxomfciadfpDelu o s)tetoio3ou4aleemivsa(  Drrurp;o0aexn o3tldfsDrlnmp;t0 etnio3oy1lmDeauvo;t0teum(opoydllt livt (farumx  no1olxoio3iys mDul(vs t4tleoiocoo1fm ean i;t srxm(opno4op n fetlt a2tmurono4altoiictldfsDrmn o u4tlxoxf todfat aiei;() 2urir oodlp e fctltf 2rax  oo1oltnif3iysfs2rauvo t4tlxnxr oydfm raieil(0trxm(opio1amt  ictl()srurxm ot0aet iociatfa emumo u4artnif3oatoptelues s t2tm(r3no1lle lnvi s)sDuaxmpno1ole mf3tlt a2ua(vp;()tltrmocoa1lpDr ivi;s)trtm(mpnudal emfes ( sDurxrpoo0tlenii3ilt m2ean onu4altnio3iytopDelu o;t)s2xoxm3nu1ol e fcta(  rra(rpno4opxn iciysfm2elnmp;t)tlxoxociytfp r ivs ()texoxm3oy4lme  fvsa(f rraxr no1oee moeiys a2ea( sn()teerio tadfp  lneols setm(m oudlltnmiciat aDua(mpno4aee  ociat mDeauvp (4alxrxo3oa1lp  lneol(0 2xrir nodapee nes s) Dtrx o;u1apen fctyt m2ra(mont0 lxoifciotfaD  uvi t0trurir3ny1apt liciasfsrtrxr ot4oex mfciydlsDum(vo t)teeoxociy1lmDr ivi t0 rxmxopio1lmenmnci (f Dra(moou1oeeo fciaslaDem(mpnu)tltrxf iy1fpDrau s;s0srum(m iodole  fesa()s2rmuroot4openmieilsla2rmnvs u4aeerio3oo1lpD livol()trtm(m iu1lpee fvia( sDuaumpot0aetn ociatla ra(mo;()tlxrircoy1optr n sl(  2toir3iydalenlnvsl()aDum( o;t1tpxomf3iltfaDranmsnt0areomr3tatla   u s;s)seum(o3no1apen iesls)aDumumpoo4tlxomo3iaslaDuln s u4 exnir3oodlat  neo s)teuo(r oydlm  lfct s  2uaump;u0tltn o3iatlm um( o;u0arxoio iodfp   uvs s) 2xo(m iudam  mfei s a2tm(m ;t1oleoif3iydfmDemnvsnt4 lxnmoctatlmD aneol(0 2to(r3iu4ape lnetat srraxronu0oexo i3tlslm2ea(vsn(4trxrif3ty1omD ln ilt)tetmir iydlmt licsltf rrr(r nu4apto oeild m em(vp;u0trenmf3tytfmDe ueols0s2xmimpno4alen fesa()sruru o;u4tpx moeiat s uluvo t) eenir tatlptr ieilt0srxrir3iudamenlnvsl( a2ta(moou4aet ioctadla rmu s;u0 reomfciodfmt lnvols  euoxo iu4ll elnctltfarum(  nt0aptniietlsfa rmuvsnu0texoiociotlmtr nvsl(0trtrxo3nudalt miet ( a2ta( onu0tlt  o3tytfs rl(vs;(4teeoircoadlaD lnei ()s2xr(r iu4ol  mfvsat)sDrm(  ot4tetn fetatlm rmnmp u0teeoxf iy1oaDelnvo s t2xo(m3no4llt mivsa()aDurum ot0opt iieildlm2rlnvo u0 etrmrcoo1om e neil( sexo(opnydaleelncta(fartmxronu0tlto octadfm uau pnt0tltnxrctatom r uvi;s)trxmxmpno4lmte ncs s sDumx ont4tlxoif3iat s2um(vo t4aexrmr ia1fp elneo;(0srtrio oy1optelncs t  Dtau  ou4tex iociyd m2um( s u0 ltomo3tadfp  ln o s setm(r3ny4omee fcsas)srumx  ou4tpeomieilt m elnvonu0 rtoiocta1lp e ies;() 2umxopno4amtn nctasfsDrm(rp;u4tpx ioeiys mDum( pn(4arxoio iotlmt  i slt0seuo(o3oydopt lieslsf Drax  ;o0apxomieiyd mDean o;t0trerif3iytlmte n ilt0s2trxo no4lpeelnvs s srtmxront4oexnmf3iyslm2rmumsn(0arenmo iodfa  lnvols seumirpny4ap n fct t)aDumu pnt1aet  ieiadlm ua(mo;t0trxrmo3tatfaDr neil( srxrxr3iy1amtnmivslsfsDrm(ronu0tpx ii3iad a rmuvpn() rxnmocoadla  lneo;t truoxo oy4ape micil(fs2uru  ;o1tpeomiciasfa rlu s;u)texnxrcio1fm  ai s s)trtmim nu4om n nvs s  rrmxr oo0altnmfciytls2em( snt0 etrxf3oo1faD  n i;t0tetrxopiy4amt  fcias aDrru ooo0aetn ociatfs el( o;t0texnmoctydop   uvsls  ruoio3oy4oltnlneil() 2tau  nu0teeoiieiydls2umnmsnu4altrxfcoatlpDeau o s)setr(opoydam  mfvias)s2tmxmpno1tlto ieiysls2um(ms;() eerxfctodlp raieo;t0setoxr3nodlleelfvtatf rtrxm ot4teto f3iyd s ra(mpnt) leoio oa1lpD aneol( truoxr3oo4lp nmivil( aDtax  ot0tpxoifciadls el( pn(0 rermr3ootopt  n s;(0t2xoxr ou4omtemfcsat) Dumx  nu1tlt  ieilsls2umu o;(4trtnmocto1opD auvs;( t2xr(o io1lp nmnetl() Durx o;t1aptnmfeildfs2ea( p (4tltnio tydomtelivols srtoxr nu4lpe mivsltf 2rm(r nt0aexomoeiat m rm(vs;(4 rtnio3io1lpD an sl()s2uoim io4om emnvs ( arur( pno1apenifeiysls elu p;u0 exomfcio1lm eln o;(0 exriopnudam e ict t aDtrur ;u0aeenmo3iltla2emuvpnt) rtnxo io1fp rauvolt)truo(m oo1ome  nvsls)s2uaxmpnu1open fciad a rluvsnu) exomr to1fatelnei;t) ruoxm3ny4ol elfvta()a2rauronu1alxomf3tas a2uaumon(0aetoir3tydlpDrlivils0s2trxrpio4ap elieslt) 2tmumpou1oleniietls a2raumpn()alxnircta1oatrlnei (  euoxr oy1lpt lnei s s2tr( o;t1tpt mfciys mDean p t4aetnifciotfaDrau o;s  rxmirpno1lp   nvt (f rrrur ;o0tlx ifetatfs2uln o;u4aexomo3oa1lp eli i t0teuo(r3iudlp emicsl(f Dua( pou0aee  i3iatlmDuanmont0tlxoifctytfmteln s t t2xm(opiudlmee nci tf Dur(mooo0oetoifeildfs elumon() lenio iy1latean il()texmiopoudlptnliviltfarum( onu4oetoiictydlsDea(ms;() rtrir iadfp  lues () rtrir nu4altemfet s) rta(r ;o1apto fetaslmDua(vont0tltnmf3oodfmDean ols0teum(rpno1lmt mfesa( a2rru pnu0tpenmi3tadlm ra(vonu0 rtoircoodomDrlu olt teto(mpiydole lncias) Dtaxront4tpe mieilt mDum(vsn(0aeenxrcoadfaD li s s0sexrir3iu4amt mfvtlt a2rm(mont4teto oeilsfm uanmonu)tleomo3iotfaDrlieols sexmio no4lpen nvta() Dumumo;u4opt mi3iltfmDumu pnt0tetrxrctatfp  lnvs;s)s2tm(rpiudom  mfei () 2tm(  ;t0tpt micildfa2rl( p;u4tltoio oodlaDraivolt0seuoxr3iodlpeelivilt s2tmxrp;t4tpen octas s2eauvonu0trerif todfaDelnvs t  ruo(opio4ol elnvsa()arrm(roou0tee  feiydfa emn o;()aexnmrciy1fp rai ils trtrim3oy1amtn ncils sDur( o;u0apx  ieiasfaDrauvs (4trermr tytlm r n olt0seurim3nydom nlfctat  Drrurono1tpxomfeilsla2ua( o;t0 etrio3ty1omtrluvo;( tetrir3nudam e ivs s artm(m no0opt ii3ilt mDem( p ()aetomfcoytfm   nei;t)sexm(opoudal nlfct s)a2rr( pou1oet iieias a2umu s;(0teenmrctydopteaivslt teum(o iy1ll elivsl()srum(m ot0oexo o3ias s2ulnmonu4 exniocto1laD lieslt0srtrxm iudoptelfvslt)sDtaum nu1ope  iciysla2ulu sn(0arenmr3tytla raneilt0texrir oodoptnlfet t)aruau  oo4tltnmfeildfa2rm( pnt) etnmr3oatfm  livsls0srtr(opno4ole lncsas)a2tr(rpot4alenifeildla2raums (0 lxoxr oadla ranvslt0t2tmim3oydam   ivia() 2raxmo;u0aptnmictasfa2eanvsnt4arerxfcoytfa elues t) rxmimpnydlltelfvi s) Drau  no4alxnmo3tad m rlnvonu0tlxnmrctotfat ln s;s)srxmim3iy1optn ncsls artr(rpnt0aexo octat m2eaump;u0aexrmr to1omtrlieslt tetm(o iodale  neiltf Duau o;u0aex if3tysls raumo () etrmocoadop rln o;( teum(m3oo1lle  fetlsf 2ta( pno1tee miciatfa rlnvo;()tlxrifctodfp ean s s)texmxrpny1ol  mfctltfsDtau  ou1tee mietltls2rmu p;u0 etrxf3oadlm
\ No newline at end of file
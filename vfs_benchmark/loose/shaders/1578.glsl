@@ -0,0 +1 @@
+ueil(0setoir3no1olen iesatfa2tau  ;u0olt  fetasls raums ()artoio3iydoa ean i s)teurir oydaptelfvt t) 2rrxr ;o4tpeo i3iytfa2rl(vo;(4tltomo oatomDr ueolt0trxo(opoo1ope lfci s) Drmumooo0oex mi3ildfsDrm(vont)tlxoio oy1lptr ivs (0s2tr(mpoo4lle  fvtlt  Drau pnu0aleomoeiatfs rmn o (0trtrir3oy1oat lu ilt0 etoxo oodom emivt ( artrxm ;o1oet  feilsls2ua(mo t4aeeoxocoodfp  aivi;s  eto(o3oudlmtelfet () Draumont0aptnifeildfaDraumo;(0aexrif3ootom  aivo s  2xo(r iodomt mnvsls)arua( poo1tlenio3tldfs rmn o u4areoxo iytfmtrln o;t)t2ur(r3no1al  mieta( arrr(m ot4aeen ieiytfaDra( o t0 exoio3ootlpDrauvsl(0setoimpiy1op elnvsl()s2rmumpno4ole  o3iytlmDulnms t4trtrmr3to1optrauvi;s0 2toiopny4lltnlfeilsfsDtm(ronu1aee  fcildfm um(vs ()tetnmr iotfatrluvi t0setoxm nu4lpt licil( srta(rpno4tpxnii3tltfa2raumsnt0altoio ty1lmt  uvslt) 2tm(m oudaptn fvilt  Duax  nt0oexn i3tadfs uan pn()aexnmoctydlptelues;s)teurio3nudaptn fvia( s2raxm ;u0tlxnmiciyslm2rln snt) lxnmfctytfmt au sls t2xmir nodal   ici t a2tm(ronu1aexomictaslm2rmuvpnu0tetoxf3iadlpD  ivolt trur(mpio1lmtn nvi ()srurum ;u0alxnioetasls2emuvp;u0aexnxf tadfpt auvil()sruo(r3ou1op   fcia() Dtmxrpnu4alxn octls a2ulumo;t4texoif ia1lptelueils srtm(rpoy1apen ivsatfsrta(r no4tex ioeiadla em( s u0 leomo to1la elu sls)sruo(o iydllte fcilt)artm(rp;o4tpxo feias m emnmo (4aeerioctadom eauvi t  etoxr3io1am nlnesas) 2ua(r ot4optomieiytfm2em( s;u)aexnir oytom e ueils0s2xm(mpiu4al  lncsls)s2ururo;t4optoiiciytla umu o;()tltrxr ty1la elnvo s  rtmimpou4lm nmivt s)aDurxmp;u4tpt mf3iadla2um(monu4altoif to1fat aieolt0trto(m3no4apt  nvslsfsDurxrpoo4apen ictatlsDrlnmo (4aleoxrcoatoate i sl(0 2tm(mpno4omt  fciltfsrumu ont4apeoioeils m rl( p t0 eenxo iy1fpDeln ol()setr(r3nu1lmenlncia(fsDum(rpoo4aeeoioetadfaDea(mo;u0teenir tytlp r u olt)srxoxo3nodllt lieta(f rtr(rp;u0opto oetytlsDrlumsn(0tetnmfciotop r u i;(0srum(o io1am nmnvt t  Dtruro;t0opeomieiytlsDelnvsnt0artnxrciydomDraneils) 2trxrpou1apeemnvtat)s2umump;t1alt ifciysls2ulumpn(4 lenio oo1fpteaies;(0 eurxm3oodoptnlnct sfsDurx p;u4apenioeiatfa2eluvp u) renxr oatoa e nvi;( trxoim nudolt lfei t aDrmxr ;u1oleo o3iysls ulu o t) eenir3iydfp  lu s s0 2xrir nudoleelieil(faruaxmonu1tpeo i3ilt sDuln pnt4trtrio oadom  anvs;s sruo(r oy1omte iet ( srrmur ou0tpe mo3iyt sDrm(monu4aeermr3oadoa  luvi s)s2xm(mpnudam   ncsls)s2ur(mpno4opx mf3iydfs2um(vs u)arerxociotfm  an o;s trurxo ny4ap nlics s)srumxroou0oeenmfciatfm2ul(mo;(4aleoirciatlmDe i i s0s2um(opou1omt mfcsa( aruau pno1aeenmieias a2emums;t0trtnmr3totfa ranvo t  rxmxm3ny4lmtelneia()sruaxroou0optn feiatfs rln o () leomf todopD  i o t0 rtrirpoudll   fesls)aruaxr ou1aetomf3iysfaDean s;u)aleoif3iy1la rauvs;(0 etmio3ny4ol n ivilt sruaxro;o0apenmo3tysfsDranmonu4 eeomf3ootom  anvo;s0texoim3iydap   nci (f 2tmumont4apxniietlsfm2eln pnt)aeeoioctatfmt  ivo;() etr(r no4olt  fciltfa2urxrpot4oeenmfcils aDeanmonu4alermr ia1fmDeli s;s)trxmxo ou1ol e ict s  Drmu poo1ale miciyd m uln pn(0tetrxf3oy1fpDelnvol()seurxrpou4lmee ieiatf 2uax o;o4teto fciadlmDran s t0aeenmf oo1fpDeaueols)t2xmir3nodolt mfvtl()sDrru onu1oltomf3tld s emumpn(0 rtoxr oodom rlueil()trtoir3iy1oltn fcia(  rrrxrpou1optn f3tlsfs2umuvs ()tetrmf3iy1om elivs;(0 rto(r3nu1ll n fvsasf rtrum ou4tpenioctyt s ul( o t4 exoxrcia1lat lueols0 2toir oo1apteliesasfs2rrx oou4olxomfcild aDum(mo;u0 reomocoadfmDrli s ()t2uoxrpoudomen neia( sruaxrp;o0tpto o3tlslsDrlnmsn(4areomo tydom r ivs;t  exoim iy1apenlicsltfsDtm(  ot0texoioetys s2eluvpnt4 reoif ta1latrluvi;t0seuoir ou4lltemnet (farumxro;u0tee  fciydfaDea(mo;()aexnmo tadfpD livi (0trxoxmpoydlm e fesl() rra( p;u1opt ifeiyd m rau p u0tlenxf3ta1oatr u i ( srxr(mpnydopenlfesat)srua(mp;o0tlt  feiyd sDem(vs;u0 eenmrciytlpDe ivo t0texoxo3ny1omenlfcta(  rrru  ;t4ole ii3tydla2ua(mont4 etoxr3tytomte uvo (  rtrxm io4lm   nei sf Draxrpoo0tpenmfciad sDea( o ()arxrifcoydfptr ies;t0setrxm3iu4alt mnct ( a2rmum ot1opxnioctlslm el(vo () rerio3iy1oa ean ols) rurio3oo1ap elivi t)aDrmum ;t0olxoii3tytls2umuvs u4aeenio3oadfm  anes s  etr(rpno1llt  nei s)a2tmx  ;o4tleo f3ils a2rl( s;(0aeeoxf io1lpD luvs (0srxoim3oodlleelnesas a2tm(mo;o1apx iieiadfmDumu o;(0arxoxr3io1fpD aneol( srxoxr io1ome mnciasf Dtaumono4aex ifeiatla2eanmo;(0artoxf3iatlm rln s;()sexrim3oy1ol nlneia()a2ua(ronu4aet mo3iaslm rln pnu0arenxr3to1omDr neil(0srumirpoudlmenlieia( aDur(  ot4ole iieias aDemn s;u)alxrmf oydomtr nvi;s)teurxmpoy1om emict sfa2tmumo;o1apeo i3iad aDeau p;t4arenxo oatfp rli i;s s2triopoudlme  ncsas aDtmum oo1tet mi3tydfa elumpnt) rxomfcoatlatrli s ( s2xrir3nu4op   ncsas)a2uaumo;u4aeeoioctaslm2rmnmp;t0tlenircoo1lmt  nvi;()t2xmxrpno4om n fcs ( aDtr(r nu4texoifctyslm2ranvp u0alerir iodla r i i;t sruo(r nu1lm nlfesa( sDtm( p;o4opt ifetadfs rmuvsn() renio3oadop e ueslt)seto(o3oudlpt  icta( srumxm ;o4aetomfciasfaDemumo;u0alxrmr3iytfpD  neils0tetr(opno1lptn ivtat)s2rrxmo;o4tleniociltfs2ua( pn(0altrmr tytlm  au o () ruoxm oy4op e nvtat)s2ta(mpnt4aet mociyd mDrmums;u4 ltrmocio1fmt lnvsls0 etoimpiodll elnvsl(fsDur(rpou4aetoifetysfs2rmumo t4aeenxo todla eau olt) exrim iy4am e fes (  rra(rpot0tetn ieilsfs ean s;u0 exnxo3oodlmt lnvo ( srxr(m no1opt mivta(  2uaumpou0apt  icias sDrmnvp (4 lxrxrctotomDelieolt0 2trxm nudlmt  fcsat  rum(  nu1tptnioetyd m uluvp;u0 rxomo oydfaD ai s t trxoir iu4ol elneilt  rumu o;o0oltn f3ildfa ulnmp;u)tlxrirctatfa rlivs s)t2xo(r oo4ap nlietatfarrr(r ;t0ope  fciad sDra(vpn(0 etomfctotfp e ivs;s sruoimpoy1ll emivi (farrrxmonu0tpenmf3ilsla ra( snu4 renmocoatoaD lnvi;s s2trio3oy1oleelfvi (fs2uru  oo4ale  i3iatfa2um(msnu0 exrmfctadomtran o;s0s2tmirpnydlmee nct s arrax pnu4tlenmfctadlmDeln p t4trenif iotoaD aivo;(  ruoxmpny1aptn fciat) rumxrp;t4tpxnmf3tldlmDumnvp t0 rxnmrcoa1oat auei;t t2umim3io4am elneia(faDururoot4olxniieiytfm ul(mp;t)tltnmr3iydlptrln i s  etmirpiu4om  mivia()sruaxmono4oetnifcils m2emn s;(0artnif3iatfpDelieslt)tetmxo io4oltnmfcslt s2urum oo1oexo f3iltla2emn o u4aexoif iytopDrlues t)srtrir iy1omt  fctlt) 2umu o;t4oexo ieiadlm uanvsn(0aetrmr to1op  anesl()trtmxr nu1lleelici (farta(ront0oexnmfciyd s uan p u) eerioctadlmD lu ols0srxmirpoydalt lnesltfs2trx oot0alxoif3iys sDrm( snt4trtoxf3oatfp  li s ()trtmir3oydomtemfcta(f rtr(m ;o4olt ifetatfm2em(mon(4 etoxr3oo1oa rlu ol( t2xoimpoydopt lfvs (fsDua(rp;t1tee moeiytlm uau p u0treomr iodfptraivi s seumxopou4omenmics (  2uaur oo1alto ieildla2rm(vo;(4 ltoifcoodlaDr ueo t) rxrxo ny1omeelfesas)aDrru o;u4oetnmo3iasfa2ul( pnu0texomf tytopD lnvil()srurir io1opt  ncsasfarumxr nt1tleo o3ildfmDem(mo;(4tlxnioctodfpteluvil(  rxmirpny1amtemfeiltf 2um(m ;u4opxnmoetlsls2ea( onu4aleoxf3iytlmDeln i;t  exo(o iu1oltnmiesl( aDrrur nt4tlen i3tysla um( s u4 lxrxrciatomDelivil()seuriopno4op n feta()sDra(mpoo4open iciydfsDuanvont) reoif3ia1lpDr uesls)teuoio3oodop emfeta(fs2uax p;u4opxoioctaslm2rl(mp;()artnmo iy1fmDeanei t srto(r3ny1ap nlnci s) ruax pno4apt io3ilslsDuaumon(0alxomf3iy1op   nvs;s)trumxm oodlpt livil( aDuax  ;o1aleoioetatls emn s;(4tlenir to1lmtrlieo;s srto(opio4lp emivtlsfa2rr(mono4oltniietltfmDulnmo t4tltnxfcoatoaDrln o t0s2xoxo ou1aptn fctas aDur(rpou0aexomoeilt s uanvp;u0 lermf3iytfa e ues;s0 rtm(r oo4llte fct s aDur(r ;t1oetomfctlt a2rlnms;(4trxrio oa1lm   neol(0tetmxr3nydop  mfvs s artax pnt1altomf3iad m ra(ms t4aeerxrcio1fmDran ols t2xo(o oy1lp   nvta(  rtaxrp;t0olenmo3iytfa2ran s t) etomrcoo1omt ai s t0s2xo(o3ou1omtnliei (fartm(rono4tpx moetys aDrm(mp;(0tleoif3iodoaDelnes (  2umxmpio1omen nvs tfa2tmum ou0optomieildfmDua(vpn(4 eermr3tadfatranvs;t t2xmxrpno4opt lnvs tf rta(roou4apxnmfetatlsDemu pnu0aetoir3iydom e nei s) rumxm ny1ap nmncsat arum(  no4oetn oeiasls2ra( p t4trtnxf3iytfm elivi ( trxm(opio1ale mnvs sfa2taurono4texnio3tls a emump ()alermr3ty1fp  livs;t) 2tmio nu4ape  ncs s)sDtr(mo;t0ape mociasfaDeanvonu4treoxf tytomt anes t0texrxm3ou1ape lnciasf rrrx ooo1opx  f3tls a emu p t4 ltnmr3iytomteaneo s)srxm(o3no4lmt micil(f 2rauro;u4tetoiociadfs ul(mp u)alenmr tytfp  auvo t)trtoxr3nu1omen ict t) rumu oou0tltn fctaslm ulu snu4tetrmf3iydopDeaivs;t  rum(m oy4lpen net tfaDtr(rpot4aeeoif3tyt m rlnvonu4 leoio todlmt livol(0 2tmxm3nydlmen fvtls) Drrxr nu4tex if3ilsfmDumn o;()teerif3io1lptrlivi;s0teurxopoo4olenlieia(  Dtm(m no0tptnifetldlm emnvs u) eermo to1omtrauvs (0s2xrxm3oy1llen iet sfarrrxrono1tet  fetysfaDrmumo (0tetrxociodoa elu i;s)s2tm(o3ou4om n ivia(f rtmx  nu0aex moctldfs rau o ()artnmrcoa1op raueolt) exoiopoy4lp nmfetas s2um( ont1texo ictys s2ulums (0artnxo3io1op  luei;(  2trxr3nydal nmfvilt) rum(mo;o0tleoiieiydfmDumuvpn()alxomo tydfmDrlivo;s0trxmxmpiudam  lnesat)s2umum ot4openmieilslsDrmn s t)artoif iytop r ueo;s)truoim3no1openlicilsfarrr(ro;o1aex ii3iltlm2em( ont)tetnmf3tadoa e neilt0 etoiopoy1omt  iesl( a2uru  ou1apx mo3tyt aDumnmp;t0 lenxf oytlp ran sls0 2xo(r nydamtn netat)arurxronu1apxn ociys a rm( o u)tltomocoodfat  n s t) 2umio io4ol elfvsa(f 2rrxr ot0apx mi3tat m ulnmon() rerxr3iatlm eaivsl(0t2uoir3oy4apt  fvt s) rtaxmo;t4oltnifcils m rl( ont0 eeomfcty1latr ivsl()seurxrpnudop  mivi (  Dtm( pot1tltnmieildfaDemu s t)alxrxf iadfmt  u olt) exrim3no4llte nvsl( sDtrum nt0tetn i3iasla umnmon(0 ltnmociodfmt aneo;(0t2uoiopny1aptnmfvia() 2tm( o;u4ope ioctad aDraumpn(4trtnxo iatomtrlu ols0t2urxr oodomtnlies ()a2rmx ono0oee  fctad mDel(vo () ltrmfcoy1lp   neol( t2xoir oy1apt mfcilt)s2uru pno0oet moetat s2el(ms;(0 rxoxf3tadfm eaneslt0 rxrxmpiodlmeelfetl(fa2ur(r nt0olxn ictatfmDelumo;(0tetomrcoodoat  uvi;()teurxo3iy4lmtnlnei () 2urxmooo1alt mo3iydla rluvo;t0texnxo todlptr ues s  2xr(m oudale  fvias)aDum( o;t4tptomi3tytlaDulnmp (0alxrmfciydfptrai o;t) exm(r3oo1al   fesatf 2ta(mono1tptnmfeiat aDrl(mp;t4tlxrmr oytlm e nei;t0 rto(r nydolenmnei ( sDrruront4tlx ifeiatfs2umu p (4 leriociodfmD lu olt) rtmxrpou4omee ics sfaDtruro;t0ale  ocilt aDeauvo u4aeermo tydfptrai i;s) etmimpiodll nlfetls aDtaumpno4opeoifeiyd m2el( s (0tlxomfctydfpt li i t t2umxmpoy1olt mietat srtau pot1tetomoetlsfm ulnvo u4 rtnmo3oodom   u o;t)srumirpiudlpee nctas sDta(rpnt4oetnmf3tadfm2umu p;(4 leomfcoadlm e nei t0s2tr(mpoo1alenlnvils)s2uau pot0texnmoctyd m2elnvsn() renircta1om   uvol(0 2uoio oy1lle mnvtas  Durxmpou1oee  feiadfs ea(msnt0aetoxr oatfa r uvo;( seur(o3oo4lptelivsa() rur( pnt0tee mociasla2um( p;t4teermociodlm  lnes ( srumxr no1aptemicia(  Dtm(mpou1tpxnmfciasfa uanvo t) eerirciatfa  lnvo;t0t2toxm nudopt  fct (f Dumx pot4alto o3tas sDeau s ()trtomr3iydop rauvo;s  eumxo oo1omteliet s)sDrru onu0aeto f3iydfaDranvp u4texnmf3iydopt lu s;t  2tmxopoydlpen fei t) Dtru  oo1aleomieiatlm2um(msnu0 exnmrciatlm r ues t  euo(r3iodlltelivslt)s2rr(  ou0aeeomieiytlaDeanmon()tetrmf3iatlm   ueolt0s2tr(o oo1omeemnctas)aDtmxmpnt4apxnmfeiyt a em( pnu)arxrxf iydfmtraiei t0truo(mpoodolte icsatfsrua(moou0tlxnioeiyslaDea( onu0trtrmocoatlptelivi s0 rumir io4oleelietas  rrrx p;t0apxo o3tas aDrm( ont0 rxrmf3totoaDe iei s srxoim3iodam  lnet (f 2tmx poo1aex mictytfm uan on(4 lermf iadfaDelivsls0 rxo(m3nydap nmfes s)a2rax  ot0apt  f3ildfm2rl(ms u) rxoiocoadfpt auvil()t2tmiopnu1apenlnci () 2rrump;t0opxnifetad m rl(vo;u) rxrxr tadlptr uvsls0s2uo(opoydll  mfciat s2ra( pou4oeen o3iysfs2rl( o t4arxrmrctatoa e u ils0t2xoxm3io1ape mfciat s2rrx o;u4apeoif3iltfm2eluvp;u) eeoxf oatlmtr n i s srtoiopny1ol n fei ()srua(monu1tlt moeiyt a umn sn()alermo oa1omD ai o s teto(mpiydol   ivtatfs2ra( pno1tltnii3ias sDrl( sn(4 ltoio tytfpDeaneolt)teto(mpiu4amenlnvsltfs2ur(mpnt1alt  f3iysfs ul( o;u0 rxoirciydopD aieo;t tetmxm3oo1om n ivs (f rrau  nu0tpt ifeiyt m elumo;u0trerxf oatlpt aivo;s)teur(o3iy4oltnlfeiltfs2raumo;t4oetnmi3iysfa2rmnvs;(4aeerio ootop ran i s0s2xo(o3iodlmtnlfvils) rtmur ou4tpe  ociat m rln onu4arxnir tytopt aieils sexmimpno1ol elfvs s  rrr(m nt1optnmociydla2rmnms;()tetnmrcoy1fm   n o t0truoim3oy1am   ieslt s2tmu  ot1teeniociltfm2ran s t0texoir io1la e uvilt0teurxo no1am  licils  2ur( p;u4aet mictyt mDemu sn(0tetomr3oy1lmt aneils t2uo(o oudal   fcs s  2tmxm no4oltnifeilsls elnvo t)arxoxfcio1oat lieo;t) etmio ny4lpenmfetl(f Dra(  ;o1tpenio3tldfs rl( p u) eermocoy1fmDe n ol( teurxr3iu1lmtnlict s a2trurpoo1olx  oetld a2umn o t0altrmf iotfa  lnvs (0 2tmiopiydapenlfcsat a2rrxm oo1tle ifeiadfa2rl( o;u0 rxrxf iytopDr ieo;t)srurio3oodolen nesat)arumx  ;t4tlen feiyt mDua(vonu4 lxoxf3oydfaDrlu sl()t2uoxm3no4lltelicsltfsrrr(rpoo1aeeoifciydls rm(von(4trxnmf3oo1laDrli sls) eumxmpnydlleeliciltfsrrmxmpnt0oeto feilt m2rlnvo (0aetrmfcoydop e nes s)s2tmirpno4aptnlieta(f 2uru o;t0apenmoctas m2rlnmpnt)alenmo ootlm   neo s trurio3no4olenmfvs t)aDtr( pou1tlxnmfctld s2uluvpn() lxrxf3tytoate ivslt0 2xoxo iy1op  mncsls  2taur ;u1opx mi3tldfm elums;u0tlxnmrcoytlpt an s;( s2xo(mpoy1ol  mfvsa(fsDurxm oo0tpt if3ilsla rm(msn() rxnircoadop  lu sl() exoxm3io4ll   neia()aDrmx pou0olt iieiyslaDum(ms;()aexrmoctatopt  n ilt0 rxrxo3iydoleelfcilsfsrra(roou4teeomi3iydla2uanms;(4 lermr ta1lpte i sls0t2xrimpou4apenlfesl(  Duax oou4tlt mocilt a uau s;t0 reoif io1fpD aieolt)teurxmpiy4ll nlici (  Dtr(ro;u4apx iieild s2elu s u4 ltnir3oy1lmD aneo;t s2uoxm3oy1alee netlt a2tmxro;t0openioeiytla2rlu o t0tlxoxo3tydlatrluvslt0teurxm3ny4omee iei (fsrraum oo1tlt mieiatlsDuan s t)tltomfcty1fp  lneo;(0t2toxrpoudop emfvi s)aDtax onu4alxn o3tasla2rau pnu)teeoxo tytomD  neils teurxopoy4ale mfctat)sDtr(ronu4altomictls a rlums;(0altnifciydfpte ieo t0t2ur(opnu1lp e fvil(fsDrau pou0tpxomf3iydla ranvs;()tetnxfctodlpDrlu i t0 exrim3no1lpen nci tfsrtrur ;u1tltoio3tasfmDelums u0 lenmf tytomDeauvs t)srur(o3nu4lleelfvia( sDrm( pnu0aeeoifeiyd sDemnmo;u)tltrir tatoptr n sls0sexrim3oudame micslsfaDrm(ronu1ope if3ildlm uaumo;u0tleriociotfaD ln ol( t2tmim iudolen ict sfaDuaxronu4olxoifetad mDul(vs;()aleoxo3todomt  uei t)seumxm iy1llt micta( a2rax  ot0aptnioeils m2em( p u4texrmocoodlmDe ieol(  rto(r3io4lmeelfei ()a2ta( p;u0oexnmfciasfm rm(vs;t) lenxfcta1fmD lnvslt)setrim ou4opt  fcia()aDum(m ;o1ope mi3tltls2ra(vp (4aeenxo oo1opt aneol(  2tmxopoy1ole mneiat)s2tax pou0aexomfeiyslm uanvsnu) exrmr3tydlpDelivi s  2xrxm iy4lp elnvsas)srua(rpou0aexniiciaslmDemnvsnu4alxnmf3iydfa  lnvils0 rtrxmpnydale mneilt s2ur(mp;t0tex ii3ildfm2rlnvo t4artoif3oytfm raieols0seumxm iy1aptemfvsls)srua(rpno1ape iietytfa ua(monu0tetoxf3tydfp eaieolt0 rurio3iodlmen nvi s)sDta(r no0tpeniietas s rlnvo;t0tetomfciytfm  au s;t)sruo(r3iu4lle lfcia()aDtr(m nt0opto o3tatfaDeaumsnt4 lxomoctytfaD anvo (0 rxrxm oydlpeemici ( arrmx o;u0opeoii3tadfs2em(mp;(0tlerxo to1oaDeauvsls  exoio3iydoltn ncils)s2ta(ro;o0oexoifctytls2ul( on(0 ltomo to1fp eai i;s trtmxmpnudomenlncia(  rrm(mont4oex if3iad s2umumsnu0trtrmr3ta1lpDeauvo t)s2uoxrpno4ll emnvs s s2tm( ono1oeeomociyslmDua(vs;u4 rxrir iadfa eli il(  2xmxr iy4am e iesa(farrmx onu0apeomoeiyd aDrm( o (0aexrxf oodfaDrai i;s0trurio io1llenmict ()aDtmu pno4olxnmietat m2rlumo (0tleoxr tytfa r u i t0 2xoimpiu1apenlfvi tf rraumoou0tptnmieiltlmDeanmpnu0tltrxr3iydoptran o;t)s2tmio3io4am   iesat  Dtrxrpno0tpeoifctlsls2uau ont0aetoxf ootfp e ues;t tetrim nudlmt  ncta(f 2uaxroou4alt iietatlm2rmuvp;(0 reomfctadfmte uvo t s2tm(r3no1alenmics ()sDtr(  ;o4opxo fctys s2ea(vsnt4trtoir oy1la   uvs s teur(o ny1al   ncias artm(rpot1oex  i3iadfs2el(mo u4tetnmf totomt  ivi s)s2tr(mpiu4ole  ivils aruaxrp;o4oeto ociasls2uaums;(0tltrmfcta1omD  u o s  2toxopny4lpt mnesasfaDrr(  nt4tleomi3tatlmDrmu s t4arenxo3oatoa   uesls)trurxrpou1op   iet t)arta(r no1tpxn o3iadla2uln p u4 lxnmocio1la rluvi s) rtoio io4lmte nei ()s2urum ;u0opxnifciasfa2em( on() lxrmo3tatlmD  uvs (0 2xr(m3no1olt  fct sfs2tm(m ou4ole ifciyt s emumsnt0tetnxf3iytom r ueil(0seurimpny1lmt lfetls sDtaxr ;u1tleomf3ildlm2ua( snu0tetrxo iotlmte n i;t0s2trimpoy1omt mivtltfartaum nt4open f3ildla2umums u4alermfcoatop e i s s) etrir iu4omt  nvtas  2ua(rpnt1tpeoiieiadls2ua(vp u0aeenmr ty1lpDr u sl() 2toxrpiy4al   neslt)aDtmxro;o0oexnifeiasfmDeluvs;t0trtoxfcia1fmDrln i;s trxo(mpno4am emfcs s)arrmum ;o4opeo f3tldfs2emnvs u4tetoir3io1fatrauvilt0t2ur(o3iu1omte ict tfaDtmum nu0aeto oeiatfm2rluvs (0trxrmr3iadfatr ueols) 2xr(m3nu4lltnmfvilsfaDta(ro;t1oltniiciyd s ean o u4trenir todoa  anvi;s0sruoxr3nydaltelieils)s2ur(rp;u1oee ifeias aDuanvpn()tltriociadlaDeliei s)sruoim3oo1lltnmnet s s2rrx  no1aet mi3ias a2emnmo;t4 rtnxrcoo1faDr neolt  eumir oy1ol nlnes ()a2rmxmpnt0olxoifciysfmDumnvo t0aeenxf3iatfmtrliesls0seuoxrpiy4altemneslt)aDua( pnu0tpt ifciys a rl( pnu)tlxomo3oadoaDeluvi;t0srxr(r3no4lpt livsas  Dua( pot4tee  fcild a2uaump;u4trxoio3tydfat aues s0s2urir3iu4am emnvsl(f rrm(ro;u1alto oeiadlmDeanvp;()tetnio3oatopD lu i ()sexo(o nu4lptnmfcsl(  rtm(  nu1tpeomi3iltla2eanvsnt) leoio3io1lptelnvs;() rto(o no4lmenmfvtlt  2ta( pou0aexomo3tas a2em( ont) ltrmr ty1lm eanvs;t seuoir no1ol nmnvtlt) 2ur( o;u1tleo octldls2rlnvont) ltoio oa1laDrli sl(0trtoio iodlm  lnesas) rum(r ;o1aleoiiciyt aDelnvp (4trtoxr iytlmtrlnvo s  etoio3ou4ol nlfet () Dtmumoou0opxniietlt sDua(ms ()areomfctatoa raues;()trumir oodole lfviltfsruaur oo1ope mf3ilt mDuaumo;u0altnmf3ootfmD ln i;s0srtmio no4ope lnetlt)a2raurpnt1oexo oeiaslmDel(mo u0 lxrmfciotfaD ai ilt  rur(o3nu1ol  lnvtl(f rtrx p;u1teeo i3iaslsDumuvp u4tleoio tadopDeauei (0trtrxopou4llt livt s)sDrrxm ot1aex ii3ild a uaump;(0 lxnir3tatfp rlivs t srtriopno4apen nes tfarraum ou0oexo i3tlsls em(mp t0tetrmf tadlmt  uvsl( teurio oy4apee fciltfaDum( onu1aexo i3iaslsDemnmp t4treomr3iytfp  li s s srurxopoo1lm nlici t) Duaxrpnu1open ieiat a ranvp;t)teenxo iadfaDrln ols tetm(r3nydome mncta( aDur(m ;o4olx iiciltls uanvo u) rtoxf3iatfm eaivsls0s2umiopoudaleeliesat a2umx poo1teeo oeiytla2emnvo u4tetrirciatlm rlivs t0t2uoxo3iodllt  icsl(fa2rr(mono0tpto oetytlaDrl( p (0tlxrxo3tatfmD  ieo;s srurxr3iu1ll  mivtlsf 2tax  no4aeeoiiciltfm2eauvo (4aetnxr3io1fmt li i;(0 2xoxm io1lm   ieilt arumum ;o4opxnmo3iltlaDuluvs t)aeerxf3oa1om r u il() 2xmir3nodaltnlivtls) Dtm(rono1ope moctlsfs2rmump;(4 eeomf iydfaDr uesls0s2um(r3nu4apte ncil(  2rrurpot0tle  ieildfaDrau snu) etrmf3todlmt  nes;t) rum(mpoo1ap e fct (f rraxmp;t1apxnifcils a2ulu s;(4aeenmf iotfpteanvs;()setoir io4ame  fvtl( a2urum ;t0oetomoeiasfa um(mpnu)tlxnxo oatfmt  uvo (0srumio iy
\ No newline at end of file
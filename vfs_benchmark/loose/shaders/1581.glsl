@@ -0,0 +1 @@
+u s;t0 euoimpou4omtemieta(f 2urumo;o0tpt io3tls m em(ms (0aetnmf3iadla eau i t srtoxr nydamenlieiasfs2ra(mo;t4ope ifciytlsDran ont4aeeoioctytfp   u sls t2tm(o oodlmtn neils arrmu pnu1oltn feiydfs ua( sn(4tlxoxr3todoatrlieols0 2xrxr3no4ll nlnvslt arta(  no4oexnioetld s2rl(mpn()alxoxr io1lpD  uei s texo(opoydopee ict ( a2umum ou0oet  oeiatlm2uanms;t4aexoxf tydlpteanesl( s2xo(o3nu1llte ncs t) 2rru  oo0alx io3iltfaDea(vs;u)arxoxo totop eluvs s) etriopoydal   iet s  rra(  ou4tptomo3iad a2uaums;(4trxoxf3ia1lpDeaneo t0sexmir3nu4am   fvi s)artm(rp;t0tpxn i3iyd mDem(vp;u4 rxriocoa1fmtr n i (0 2trxr3ou4alenmfctl(fa2taxmo;o4tlt ioeiaslm rlu o;t) lerxf3iodfmt livsls) etrxm iy4ap  lncilt aDrau onu4oee  ieiysla uau pnt0 rerxo iatlpD  ueo s texmirpio1omtemnesa(fa2rm(  nu1tpt  o3iltlm rauvo;t4aeeoir3oadopt  n ils)trum(r oy4ap  lfes sfarua( pnu4olxo feildlm2uanmon(4 lxoxo3oa1lm   neils)srtmir3oo1ap  mfct t  Dtau ont4olxo ocilsfs2umumsn()arenxr3ta1fmDrauvs ( teurir3oodaptn fvsas)sDtmxronu1tetn ociyd aDrl(vo u0trenxf3ootfmD ln ilt0 rxr(o io1open ivi s  2taxmont4aex  f3iytlm ranmo;t) lxnmfctatopt an s;s0texm(o3iy1ap n nesltfa2uru ooo4alx  fetlsfaDrau s u)tlenmf3to1lpt livs;s  2tr(o nydlmt mieslt aDuaxmpou1openmfetlt a2ea( onu0 rtrxocootoa e neo ()teurim3iu4lle  ics (fsrrau  nu0oltomoeiltls2ean p t)tltnircia1fa r ivils0trumimpoudal  mnviltfsrtaxm nt4olxoiietls s eauvonu) eermrctydlm  aueo;() exrxr3iodom n ncs s srum(m ot0optoioetytfaDulumo;t)teenxfcta1om r nvi;s)truo(m3ou1lptemfvsa( arrmum no1oet  fciyslmDeau p u) etnir iytoaD  uvo s) euoxm iydlp e fetas  rrm(r nt4teto f3iatfa2ul(vonu0altoxo ta1fptrai ilt) rurirpoodal   nctat  Dta(mp;t1tptn fctlsls el(vonu4aexrmr ia1fm r uvols)srxo(mpio1ope lfvtatf Drrumo;u1open feils s rln s (0 rtrmo oy1lm rlnvilt sexoir nudoleeliet s) Dumu o;o4altnmo3iat a rmn p t0trenxf oadfpt  nvs t teumir3io1ap  mivta(farrmx onu0aetn iciyslmDua(vo ()altoif io1fmDrln o;s0truoxr3iydol nmfetatf rtmx  ot0apt mfeild s2rm(vpn()teerir totlpteanvs;s)sexoio3oy1amtnmneil(fs2trx ont1tlxnmfeias a2em(mo u4areoxrcto1omtraueo t) rur(mpiu1ameeliesl()aDrmumonu1apeomi3iytfmDem(ms;u)aleoxo oy1lptr n o t srxmxr iy4al  micslt s2urx  oo4alxn oetat m2ua( s u0aleoir oatfat lu sl( t2xmxr oy1op e fcslt srtaumpoo4aexn octaslmDrmnvp;(0trtrif3iodfaDe uvols0texrxr no4alt lnctat  Drax ooo4tptomi3ilt mDumumo (4 eenifctydoaDran s ()s2trirpnu1om n fvtl(f 2tmx oou1olt mf3iatfm2em(mp t4aeeomocto1la rln o;t0 exoxmpoo4om nlfvt ()s2tmump;o0olt mietld a raumo;t4 exnircia1oa e nesl()teumxr3ou4lpenmneils aDumx pot0tlxo oeias m2eanvp t0tlxoioctadomtr neo;() 2tr(r3iy1omtnlfet (  Dta( pot4tlx mi3tatfs umumpnu4 reomr tadlpt lues;s  rxmxr3ny1opt  iesasfsrrmum no4tptn oetldfm umu pnt0trxoxf iodom   nei;t0tetm(rpnodlmt mfvtl()sruauronu0texomieiytfs2ua( p t0aexnmfctatop eaivi s  eum(r3oo1llee ics s a2rrx  ou4alxnifciydlm rauvpnt4aexnir io1fpD li o;s  2tr(o3nudam emics t aDtm(mpno1tlt mi3iys aDea( snt) lxrmfciadfm e n sl()teumxo3nu1alee fvtls)a2trurp;u1opt iieilsfm2emn snt)aeerxo3oydfpt aivol(  2uoxo oodol n ncsltfs2umump;t0ole moetatfa ulump t)aetoxrcoadlp eauvi (0trumxo3iydlm eliet (f Dtmxmooo1tpt io3tydlsDem( o;u4altrio3iotfm e nesl(0s2xmxo ou4apeelnvilt  rra(mp;t1teeo oeiytls2rluvp (4tlenir ty1fptelues;()sexrxr no4ole mnci t  rrmumpnt4aeenio3iatfs raumsnu) lenif3oy1lmD an s t0sexr(m3iy1ope lfet sfsDrax ont1aetnmieildla2ua(vp;(0 lxoio to1fpt  u sl()t2xm(o3nu1ole  fvs (fartmxr no1alxnmiciatlsDuaums t)aexomocoytoptrln o t0 exoio3oydlmt mictlt)srumxrpnt1opt mf3iltfm um(mont4 ltrirciadla  anvi s trtrxopou1olt mfvs tfs2raxr ;t0apx mfctyslm umu p u0arerxfciytfpD ln i t) rtoir3iu1aptemfvi t  rrm( ooo0tlx mociltla2rlnvo;u0trtrxocootopt an o t0seumim oo4lptnlies (fsruaxroou0tlenmictlt mDem(vs (4texnif3oo1fp   uvs s0 rumirpiy1lme liet s)a2tmxmooo4texoifciltlm eluvp t) reoxfcia1lpDeanvsl(0setoim oo1olt  netasf rra(ro;t0texoiieiad mDuau s;() lerxf oy1lmt ai o;s)t2trxmpoodamt miet (f 2rau o;u1teen oeildfsDean s (0aeeoioctodla r nei;( teum(o no4omtemiciltfarumumoot4oeeoiiciltls2rmnms;t4aexomrcoa1lpDeaivs;t0texo(r oo1amenmiesltf Dum(mono0texniieiydla2emnvonu4 exrxf3todomDeaueolt  rtrim oydam e ieiltfsrrrxront4ape  ociadfmDea(von(4aetomfciadfm eau i () rtrxopnudole miesatf 2ra(r ;t1oeeomfetydlm2rl(vp;u4aexoif ty1lptraivo s) etrirpiy4lpen netlt)arurx  no1texn f3iat aDrlnmp;(4tlxomf iatlp e uei (0srtmio oo4ame  icsas)s2tmu ont1tpenmiciatfmDemnvs;t4 eermr3tydop   ivo;t)trumxm3iu1aptnmfesa( sDta( o;o4tpx  f3tatfmDrmu sn(0 eeoxf3iatomtrai s s  eumxr nudapen fcsa(farrmur nu1tex ioctls a el(vpnt) ltrmr3tytop  luvs;t) rxr(m3iu4op elictl(f Duaxmpnt4aleniiciydfa rmnvp;t)trenmo iytfm  an i s s2toxm oudole mfetas  2uaxronu1tpt ioetytfa ea(vp;t0aeeoxo iodfpDrlivils t2toxm oudamt mnvtlsfarurumpoo4olenmi3iyd s2ra( p;u)tlxoir3iatoatelues;() rtoiopou1lle  ivsl()arrrxrpnu0opxomf3iytls2elu onu0trxrxfctydfpt lu slt trxoir iudoptelfesat)srtaur nt4aex  f3ilsla rln o (4altrxr3oo1fpteaueo s0seumxrpou4oltnmfcsls  Dtr(monu0oee mf3ildlaDuauvs;t0trxoxr iadfmD anvo;t0 exr(r3nu4lle mict sfaDta(m ;u0oet ifetatlmDem(vo;t0 eerif todlpDraueo t)t2umxr3ny4llt lnvi ( a2taur ou4oetn ieildlaDeanvsn()tetrmr ty1opD lues t0 rxm(mpiu1alenlnvs sf ruau  oo1tex iictyd a2rau o t4arxnmrcoodlm ean i t) rxr(m oo4omt  fviasf Dumumpno4teeoiiciytfa eauvp u0tlxoxr tydfp raues;s0truoxr nydamen ncslt)aruaxmo;t0tetnifetyd m2umuvp (4trxrmo todfa r neo t texoir3oudlltelnct s)srrmu p;o4tetnmo3iasfm rlnms;t4 lxrmo oydomD aivs (0 rtoxopio4lleemfvsasfsrta(mp;u1opxo oetlt m rlu pnu) rtrir3iytfm rauvi;( trxoiopiu4ale lnctlsfs2uru o;u1oexomfctytlsDul(mo;t) exnir iy1la rluvsls t2uoxmpiy4optemicia()s2tau ono4tle  fctytla rln snu4altoxf3ootomt anvs ()texo(o nudal n nesa()a2urxmoot0aeen oeiyd m ran s;u4trtrmrctotfp eau sls0s2xm(rpnydlmeelncs (f Drmu ono4apx mfctydfmDrl(mpnt4artrxr3todoateai s;()s2xo(r oodlp  lictat srrmx o;t1tlxn i3ils s ra(ms u4aeermr3totfat au i s sexo(o3nodlm   fvtat)srra( onu1apx mfciasfs rln p ()aexrxf oytomtr i ol(0s2tr(opnu1olte nei ( sDuax  ;o1opt if3tytfaDum(vp;t0arxomociy1fateai o;()s2uoxo iodomtnlfvi s)aruru  nu1tpxnii3iasfs eln p;t0 ltomr3to1lpD lnvilt0 2umxmpoudll n fesat) rraxm ;o4tlto f3iyd sDelnvp;t0 etnircia1opDr nvi;t t2uoio nudamt  ietlt  rtaumo;o0ope  oetas m elu o;()alxnmo tadom  lnei;s trtoxmpiydlpt licsat  Dtr(mpnu4ape  ociytla2rauvp;()aexrxo3iodla r ies s0trur(rpoy4ll emicsa( aDur( o;t0tpxomicilt aDulu p;u0treomrctatfmDeanei t trtmir io1alee fcilt)arumu onu1ale mfetydfmDrlnvs;(4 eeniocoatfat aivs ( t2toxo3nu1ome mfci s  2uau oot4olt mocilsfm2rl(vp;()artnio oytom rlues;s)texm(opnodalenlfcia()sDuaurpou0tpxo f3tld a raumo;u0teenxr3oytfa rln il(0 rxmxopno1lmte fcils  rraur ;t4teen fetad s2raums;t)tetnmfctodlatrln ols0seurir3nu4al   fvs (  Dumx pnu0tptomo3iydls ra(vsn(4 etrxr3oodlmDe uvs;s0 2tmxr3iy1optemnciatfs2raurpou1tpxnmoctaslm ra(vp;u0 lxrmoctodlp e n o;s trxrxrpiodap n feil(f rtrxmooo4olxn o3iyd a2uauvs;u)aleoircoydoa eaivs s0 rur(opio4llteliesa(f rrau p;t1oexn ieildlm2umuvo;t)arxoifctytopDrau sls0 rumim3iu1omeelfciat  Dtruro;o0oltniieiatlm rlumo u) exrmf tytlaDe ies (0 2xmir oy4om nlfctl(fs2tmx oot4opxo ietysfm2elnvpnt) lxrmr3oo1lpDeaneils  rurim ny4olen fcias srtr(mp;t4tltniieild m2umnvo;()tltrmf3oydfpDe iesl(  rxmio3nydamtemies tfarumu o;o0oltnmi3tlsfmDelnmsnu0 exrxf iotlatr nei ()s2toimpoo4aptn ici s a2uau pno1aetn fctyslm rlums t0tlxrxr oadlmtraneo s)t2xoxmpny1ap  mfctl( sruax onu1apx  fetldfaDeln snu)tetoio3iadfatranes;()s2xrxrpiy1amtemnvslt)arur( o;t0tlt mfctydlm ranms t) lenifciy1oa  ai s;t) eumxmpiodlltn fvi () 2trumpno0tex mfctatls ua(vs u0tlxrir oodlpt  uvi ( t2umxr3ou1lp  lfcta(fsrumum no0alxnmfeiadfm2umnvo;(4tltnmrcoy1lpD ai s;s0srtmir3iu4lme mfvslt arurxm oo1apt ioctad s2rmn o (4aetnmocty1om  ln o;s)srtriopnu4aptnmfci tfartru ooo4ope mo3iatla rmump;u4 rtoir oodfptran ilt0sexoiopnudap nmietlt)a2rrxrp;o1opx mi3tatfs2el( on(4 leoif3oodfp  li o t0trtrirpio4oltelnvtls  2taum nu0tpx iiciad s2rmnmo u)trxrmrctotoaD  i olt t2xr(mpny4lmte fvta()aDtaurpno4ole  ocild a ra(vo t4teeriocoydlmt au il()sexmiopoo4lmenlnctltf Dtmu  ;o0tee ifeiyd a ranmsn()altoif totoa  aivols0 2xm(m3ou4lmenmfcilt  Duax  nt0opxniociys a2rm( o;u) rxoxo todoptrluvi s0 rumim no1amte fetl()sDraum nu1tlxomictad aDrluvo (4texnxf oa1fa   uvs;( trxr(opny4olen nvt tfa2umur nt1olxoiieiad m2uan s ()areoiocio1fmD ai o;(0srtm(m3oodal  lnctlt srtmurp;u1texoif3iys sDem( s u) reomf ty1fm raivo s t2toir3iu1lmtnmieil( s2raxmp;o0tetniociytlm2rm( p ()altoir3oo1lp e u o ( t2urio3oodaptemnei s) rtmxmpou0tpeoifciytls ulnvo u)tltoxfcootopDraueilt) 2urim3iu1llt lfvt s s2taxrooo1tpx  f3iyd sDeau sn(0tltoxr3oo1fa   ivo;s) rtrxm no4alee nesl( srurxm ;t4olenii3tadla2ea( o u) lxrxo todlptr uvo;(  2xmio iu4ameelncs tfaDtr(rpnu4aetomf3tytla2uanvon()artrir oo1fp elu slt0 rurirpiodome mict s  rtm(rpno0apxomoetlsla emnvp (0areoio iotfm r n s;(0 2xmiopoy4lm n fvils  rrau  ;t4opxoioeiytfa ea(mont4trtrxr3iatfaD ai sls)setoxr3ou1ope licias)aDuaxrooo1olto o3tasfm rlumpnu) etrmfcoy1lp eluvo;t  2umio nodlltnmneia( a2rrxrooo0altn o3iltls2umumo;u4tltoio todoa rlu o ()t2xm(o3iydop emfvslsfa2um( pno4teeo fetas s eln snu0 reomf3iydfp r iei;t0 2ur(r iydllt lncil( artr(  ;t4ape mo3ild m2eau pnu)aexoxf tadfaDeauvs;s0 2toiopiu4am  mfctlt)sruaxrpnt0altnmfeils aDeauvo u)alxnxfcoo1faDeli s;(  exoxrpiu4lpe mnvi s)srumxm ;o4tex ii3tldfs ranvo (4trtnxr to1la rlnei;s0t2trxo iy4ap nliei (faDtm(r ;t1tpt  f3ildfmDuanmo u0texoir ta1oateai s t0texoxm nu1lmeelieilt srtaxr nu1teeoifetadfm uau o t4 rtnxociytlp rauvi ()srxm(o3iu4omt mictat)sDurxrpno1aexn ietlsfmDeanvp u0 lxnircoy1oaD lu i;t  exrxo3nodope mfetas)artau  ou0oetomo3tys mDrm( p u4 lxomf to1fpt  ivo;s s2trxmpiudoptn fci sfsDurxrpou1ape ioeildfa2ua(vonu4 etomr3tadfp  aneo;s  rurir oy4omt lfct t aDumum ;u0altnmf3iatlsDea(vs u4aetrxo3oatomt lu ol( s2um(m3nu4olte icias) rraurpot1tpx  fctlslaDeanms (0arxriocoytfaD lies (0 rto(o3nu1altnliesls  2tr(r ;o4teeo icilsfm2raump (4trtomo3iatfmtrlivs s  2tm(r3oudoleemfci tf 2tr(mo;o1apto oeildfs uan s (4 lxrxfcto1lpt li s t s2xmxm3io4lme lnetlsfs2ra(mono0apxniieiaslaDem(mo;()trxrxr ootlmDeaues ()s2to(m3oy1oltnliei s)aDraxronu4oleoio3ildfs ran pnt4aexnxocoo1optrlieo;s0t2umim nydapt  fvsat)a2rmxrp;o0oex mietad sDemuvonu) rxrir3oa1fmDelieo;s sexoxrpnu4lptnlfvta(fs2uax  nt1tle io3ils s ranmont)tleoir ootomt  uvi ()t2trirpnudaptemfctltf rtrumpnu0tlto fctadlaDuau onu0 rxoif3tatlmDeaueo;s  rurio ou4altemnetl(f Drax ono0tpxnii3tlt aDrln snt)teenxocootfp  li ilt0t2tmxo nu1ol  lieiltfaDta(mpot4opeomi3tlslm ua( o (4trenmr3iadfptr i o;t)s2uoir3nodamtelfeia()s2tmumo;t4oexniietltlaDumnms;u0alxnifctodomDrlivil() eur(rpnydolen ict ()a2rr(ronu4tpxo iciyslsDrl(vs t) eermociatoa e u i t  exo(o3oo1ol  mfvi (fsrum(  ;t0teeomo3iatls2umumo;t4tetnxoctotfaD  ivs;t t2xoimpoy1am nmncils  rurumooo4opt ioetls s2ra(mo t)trenir3ootfaDe ivol()srumirpou1ape  icta( arrmur ou4alxomoetld m umnvo t)texrxo todop raneo;(0sexoxr3nu1ap nlfctatfsDuaxmp;u0aeto fciysfa2raump;t0tlxnir3ootlmDe i sl() 2xoiopoydlm nlncia() rtr(mo;o1aex mociydlsDua(mo;(4aeeomf ia1op  an sls0teuo(r3oo1ape  nvtl( srtm( o;o1aee io3tlsfa rmump;u0trenmrcia1lm elieil(0s2tmxo3no4lp   fcslsf Drau  oo0tpx  o3tasla2rau p;u) eerxo totfa r iei;t s2toxm3nu1ole mfctltfartrum nu1opxniieiadlsDumnmo;(0trtnmf3totoaDelneo ()s2tmxo3nudap  mnet ( arrrx p;t1alxn i3iatlsDemuvonu4 etrif3iy1omt lneslt setoirpou4omt  ivils)a2uax  ot0tee  i3iadlm ran s (4 ltnmr3totlm rln i ()srxmirpiy4lp e nvtlsf rum(mpnu4oltnmf3iat m2rmnvonu0aetrioctadfmt  ivo;s0 2xmxm iy1alen ncs s  2raumoot0alenifetls a2ra(msnt)tetrxo oytlm eau o;t0trtmxm oy1lp nmivi tf 2raxr oo1tee iiciadla2rl(vp;(0 exnxo3todopDrli il(0srum(o3iodam  mfvt t)srrrxmo;u1opxnioeiadfm rau onu)aleoxfciatoaDe ueol(0trtoir3ny1op emnvt ()aDum(r nt4opt ifetytls2uan s (0tltrxf to1opD  ieils) exrimpnodapt livtl( a2taumono4ape mo3tldfm rau s;()aeeomr3iodlateln s (0 2tmiopio4lp e nviasfs2ururp;u1aptn ieiytfsDea(vo t0 lxnxo ty1oaDe iei t0trxoio3iy1ame mfctlsf 2rmx  nt4aptoio3tlt s2eluvpnt) exrifcoo1lp raivo t  exoir ny4ape mnei (fsDrr( pnu4apx mociys a rl( o;(4texnxr tytomteluvi;s) 2xrxo io1lmt lfcs ()srtrum oo4aleo ictatlm uanms (4arxrio3tydomtr u s ( t2urxmpny1ap nliviat) 2tm(mpno4tpx mfciatfa eanmo u0teerircoatlpDe i il(0srtr(o3oydop  mnvslsf Dta(  nt0tpt micils sDem(vo (4 etnmr ta1lmD lueol(  rxoxo3iy4lm n fcta() 2tm(mono1texoif3iasfmDuln s;(0trerifctytlpDe iei t  rxm(o iudame licslt s2rrx oot0aptomf3iyt aDeauvpnu0tlxnif iadlp elieo ()setm(o3nydoltemietat)sDrrxm ;t1alt  oeilsfs em( pnu4 rtrxr iotfmtraivi;()setmiopoo4opee nvs sfs2tru pnt1tlxoiictltfm eau p ()texnmr ootopDrluei;( setr(mpio1lpen fvtas)a2raurooo0teen fciadfa2ea(vpn()tetnmr to1fm eln s;() 2xo(o3oo4omt lfvs ( aDrmxrpou4tpxoiieiytlmDulnms;u)aeermrciytopt  ivi (0 eurxopiydlpt lfei (  Duaum ou1ape moetyd a2umuvo;()tleomfcto1omteaieilt setrir oodoltn ncs t)a2trx  ;u0oex miciysla rmump;t0 exoir3io1fatr i o (0texm(o oo4al e nesls  Dtrxrp;u4aptnioetyslaDra(vpn(0alenir oy1optr ivo;t) exrxo3io1amtnliviltf Duaur nt1altnmf3tadfm rau p;t4 etnmo3tydop ean i;t)t2urim iu4lme mfvsa() Dta(m ou0tpxnmo3tyslm2ra(vpn(0teermocoodfa  livs t)t2um(mpno1lm   nvsa(  2tmu oot1tpen ietydfa em(mp;(0tltnxrciodopD an sl(0tetoxo iudopee fvsls aDta(mo;o0oeenmiciaslm rmnmsnu4 ltrxo3oadfp  lu ils s2toxr iy4apeelicsltfarrmx p;t4tpxo ieiat a2ranvs u4tetnmr3oadoaDr u o;t0t2xmio oodal nmnes (f rtaum ot0tlt ifciys a ra( o;t4 ltoxr3oa1fm e ivi (  rtr(opnu1ll nlfcils a2tmxmooo1tpeomieiltfaDuanmonu4 eeoif tatop  an ols setrxopiy4lpt  nesa(fsDtm(r nt1optnmfciltfs2um(ms (4 renmr iadomte uvo;s) etmxrpou1llte nctls) rumu pno4apxoio3iydlm ea(mp t)tetniocootla eluvs s  rxo(m3nodamee fetat  rtr(mpou1oeenmietydfmDea( onu)trxrxr3ia1oa eau sl(0setmio nodolte nvias)s2rm( oot1opx ii3ildfaDea(vpnt)arxnio3io1faDr ivs s0srto(mpiydol e nvtas  rrmu p;o4tptnifeilslm ulnvon()arxoio3tatla   i ol(0 euo(m oodlptemncilt a2rax  nu4tpto ictldfs um(ms;(4tltnmo3oytlmte ivols0trtoxo oy1lpt  fciasf Dtaur no1texniociaslm ul(vp t4tltnio3tatoaDrlnei (0srumxopny1oleemnvslsf 2tm(r ot0tpeo ictat mDum(vsnu0 ltrifcoodom r n s s) 2xr(mpnudamtemfetas) rtax  nu1olxoiieiad aDea(von(4tlxnmo iydop e nei;s  etmxr oo1lp n ivia()sDrmxm ;o0opeoii3tatfa2um(monu)arxomo totlpD ln i;s)trxr(mpnodal emfvi t  Dtmum no4tlxoioctaslm elu s;t4 rxrmr oo1lmte ivo () 2xo(rpoy1lmtnmieias s2uau ooo4olx mf3iltfmDumu ont0 ltoif3iy1optr nvo (0truoio3no4ll emivil( aDtrx o;t1tlxnmf3tlsfm2rmu snu)trtrif3ia1om  anes t)sexoim3oo1oltnmfcsltfa2rrum ;u0tpxomoeiadlm rluvpnu4tlenio oa1opDeli s ()s2xo(m ny1lpte iviat  Drmurpou4oexnio3ils sDul(ms;u)tltrmr todfaDelneo s  etrxo oodaltemnvt (  ruaxrpou4tpe ii3iys a2rln onu4teerxociydoa eauvilt srtrio3ou1apenmfcta( s2tm( poo1opeo f3ias sDrm(ms u)aetnif3oadomt  nvs s) rurxrpoudll nlnvt t) Dumxrpnu4apeomieildls rlu o;t4aexrmf3tytlmtrlieo (  eurxmpnu1llt lieiat sDtaur ;t1ape  f3ias a uaums t0texrxoctadopteli i;(0 rumxm nodale micsa(faDtaur ;u0optniieias a2ua(vs;t)arermo iodomt  uvo s0 rumim3ou4altnlnvt t) Drmxmono0aeenmf3tldlmDrmnvonu4tetrmo3ty1opteluvilt0sruo(r3oo4llt liesa( sDuaur nu4aexnmociytlm eauvp t4tetnmrcoytlatrlu ol(0trto(m3iodal   ivsls)aDraxrpoo1aeeniocilsls raump (4altnir oadfpD  nesls s2to(m3iu4lpenlnetat) ruaurp;t1aptoio3ild s rl( o u4tetrxr iodopte uvo;t)tetm(rpiydlm n nvs s  2uaxrpou4open i3tyd s ua(msnt4trtnircta1lpDe nvo;s0tetr(mpoy4aptelnci (f rumxmono0apen i3iydfs ulnvs t0altoxo3ta1oa e nvs;(0trurim3ny4llte ivias)s2tmx ono1tlxo ociadfsDuauvo;u4teeomr totlat  n olt0setrirpoudal e ieta(fsDtm( p;o1tltnmfeiydfa eanvs (4 eeoxrcto1lpD anvslt) 2uo(r3iudapt mnvslt srrau p;o4ope mietad m rm(ms;()texoif3ty1fa elu olt s2xoim3oy1omtnmnei s a2rm(  ot4tpxoiieiysla2umuvs (4alermr iotfp r uvsls0t2uoxm3iy1omeelncsl(fartm(m ot4apto oeiat sDem(vont4tltnir3todlate uvol(0 2umim iy4llenlfcsls) 2ra(  nt1oexo fctys sDra( p u0aetnifcoytlpDeli sls  rurxm iydlpenlnei s  rrrxr nt4opxomf3ildlaDuluvonu4altrxfciytlmteaivols  exrxr iydol   iei ()srtmumpno1ale mf3tytls2rm(vp u0 lenir3tatfmtr nvil(0teurxm iudlp emfeia( srtmxmpou4tlto feiatlsDemnvo ()teenircto1oateaiesls) etmio oodol   fct s  Drr( o;u1aetoifetyd aDulumo t) reoifcootfmDrluvs ()teuo(r3iu4ope mfeiat) rum(moou4oltnmo3ild a ua(ms (4 rtnmo oytfp  lieol(0s2trxm3oodal elnesa( aDra(r nu0apeomoeiadfa2ul(mo (0tlxrioctydla raueil()trumxmpno1al n nvsl() 2umurpnt0ale  i3iydlmDea(mo;u)aeeoxfctotopte nei;s) etoxr oy4apt lieiatfsrtmx  no4texomi3iasfm2elu o t4altrmr3iydlaDe nesl(0tetoim3iudlpe  fesltfarra(mpot4opx mfeiyslaDrmnmo (4aeeomrciotla eli sl() etoir3io4ap n ncsls aDrm(rooo4aet mf3tyt aDel( sn(4altnmocto1fm rlivsl(0t2xoxo nudlmtelicil(  2tmu ooo0opt ioeiyd a2rl( p (4teeomo oatopDrlnvi ( srxoxopiy1amtelnct t) rrrxmo;o0aee  o3iat a elnms;t0aetnio3tytfp   ueo ()tetoxo io1apeemnei ( srtr(m ou0tpx  i3tas s elnvp;t0 lxomocoydfat luvo s0 2tmim3nudap   nct t) 2trur ;t1tpe io3tas m eluvs u)tlxoxoctytopDr uesls setmir io4amtnlivils) ruax pnt0alt iieiysfm2rlumo u)aleoxf3io1late n i;s0srtoxr ny1ope mfci ( arrr(r ;u4tleomi3iat m ean p u4arerifctytoaD lieo s)t2xr(r oo4aleelivsasfsrumx pou0tlen f3iltfa rau p;() rtrifciy1fp eanei;(0trtoio nu4apt mivtatfaDururp;u1aet ioeiys sDemuvp (4aeeomo3tydlpt  u slt)setmxrpoydolenlfcsa(fs2trurp;o4apenifeiat m ul(vs () lerxf ia1oa rli o (0trum(o3io1lm  lfetls arrmxm ;u1oex  f3ild sDran o u)aeermrciytfptrluvo ()s2toxo3ou4lltemivil(fa2ta(mo;o4altnmfetydlm2ra(vpnt)teenmf3ty1oaD  n s;()setmio ou1oltnlictl() Drrx p;o4tpx moeildfaDrlnvs;u4arxnmr iytlmtean o t  eurxm3ny1lleemnvt s aruax o;u0optoio3iyd m ua(vo;(0 rtrmo3oatlaD lneilt  2toxrpou1amt  ncslt s2ururont1aetn ieiydls uln o t4 etoif3iadoateluvol() 2xo(o3iy4alt lnct ()a2ur(roou1aetnifetlsla2rlnvo;()aexomr tatlp elivo s sexrxm nodoptnmneiltf 2tm(  ou1aexnmietlt sDelumo u)tlxnio ty1fmDrlnesl()tetmir iydaltemictls srtmxrp;t1aleomoe
\ No newline at end of file
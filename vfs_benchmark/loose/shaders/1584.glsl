@@ -0,0 +1 @@
+nvo (  eum(m nydlpe lieias arumxm ;u1tptomf3iadlm ulumpn(4tleriocoydla   n il(  2trxrpou4llt  nesls)arrrurooo4tex miciyslsDra( o t4trtnxr3oy1fatr i o;t s2tm(o oodllte fesa()aDrr(rooo4aeeomf3iyt a rln on() rtrif oy1laDr u s t0t2urirpiy4lpen iesat  Drmx  ;o4aeeoioeilt sDrl(vsnt4arermfcoy1lpD an olt0 2ur(mpou1amte nvtatfarrm(roou0olx  i3iatfm2uanmsnu)tlerxo iydoaDe ueo s tetrimpoy1optemnetasf ruaxr ;o4aptoiiciadfsDean o t4 ltrxr tatfpD  uvsls0seurxr3oy1aptnlict s sDuaurpoo1opt  ictas mDum(vp;()alerxf3oatopt aies;s0 ruoim3io1altn fvia(fsDtr(m no1texnio3tltls2rm(vo;(0aetrio tytfpD li i s0trtmimpiydaptnlfeta(f Dtr(m ou0aexn f3tat m rl( p t0treoif oydlm eaneols) 2xoiopiu1ol  mncsat artrxmpot0oee mf3ias a2rluvpnt4tltrxr3tytopt lieo t s2xmxm3oodoltelieils)s2um(r ;u1apx  i3tydfs eanms;u4 lxoir3oodlaD  n o t0s2uoim nydamenmfcia(f 2uau p;o0oetomf3tat mDrm( snu0altnxo oadfp  an i t)t2xm(o3iu1lleelfvtatfa2rmumono0oeeniieild s2elu onu)aeermocoa1fm elueols0srurim3iu4alenmnci t  2taxront0openmfeiydla2uanmsnu)altnxr oatfpDeanes;s0s2tmxr3oy4olenmictlsfa2rr(mpno0tpx  f3tyt m2ua( p;u)treoxo3oy1oat  ies;(0t2urxo io1ap n fvt tf rumurp;o1oet  fctyslm umnms;t4arxnxf3totopDeanvs;t)srurxo ny4alt  ivt s  rum( pno0oexoioctadfmDuluvs t) exrif3ia1fmD  i s;s) eum(opiu4omt  icilsfarurx  ou4olt  ociltls uluvo t4 lxnmfctatop  liei;t0t2xriopiy1amtn icsas a2trxrpno1apeo oeildls2rlnvs (4altrif3ootopt  neo ()t2xm(mpoy1alee nesl(fa2tru  ;u0texnmieiysfmDrau p t4tetnxocootfm r u ols t2uoxmpiudom nlivi s aDrau o;t1optoif3ilt m rl( o (0 rtnxo totom eauvs;s0texo(rpiy4lme mfct t) 2uaxront4tpe moctyd m2umnvonu)trenmr io1omDeaivs;t0tetrirpiy1om elics s srrm(ro;t1tetniicilsla ulumo t0trtoxo3tydop   ues s0trxmxr no1ope  ici s s2rrxmo;o4teeo fciytlm raumonu)aeerxf3oatfptrauei;(0s2xoir iy1apenlfes sfartm(ro;o4alt mfeils a umuvs u) ltomfctydla eauvils) 2umxo3io4al  lneslt)aDtr(mo;t1tltnmf3iatfsDeanmp (0trenxrciy1om   i i;s0t2umxopny1ol  micsl(fa2umu ooo1teen o3iasls2emnvsnt)aeenmo3totfa rli s s0trxmirpou4lm elicilsfs2urxrono1tee mocilt sDrm(msnu0arxoxr ia1omtr ieils)seto(m3oo4lp   fvtas)arrm( pnt4tpe ii3iltla2uanmo u4 etomrciatlpD  uvo;t0 euo(rpoydap   fcs t arrm(mono1oetn ociat a2rlnvo t) rxomr oatlp  li o;(  etoir nu4lle  ietl()s2trxmpou1aex mi3iaslaDra(vpnt4aleoif oodom   n i s  rxoio3nu4lmeelfeiasf Dumx pnt4apeo f3tysfsDumnmpnu4arxnmocootlmD  i ilt0t2ur(opiy4am  mnes t) rum(rpot1tlxniictatfsDrlnvont)arenmo3iadom eli olt  2uoio no1omte fetl()aDrmur nt1altomi3iytls emuvs;t0 lxrxo oy1omD auvol( t2um(r3iu1ame  net t)sDuaum no1oexoifeiltfs ra( pnt4 rxomfciadopDeaivilt)texmio3ny4ole mnvs (fsrrmur ot0aet  ietld mDemnms;t)texrxociytom ean o ()sexo(rpiydlptnlicsa(fs2tru pnu0tlt moeiltls eau s;(4arxoir3todfat  nvs;s)t2uo(o3oo1am  lnvt ( sDuaxm ou0apxomoeiasls2rl(mp;t)tlenmfcty1op  lu i s  ruoiopiydlmtemncilt s2rmx pot0aleomoeiyt a2ea( sn(0 ltrxf oytfatelueil( srto(r ny4olee fes (fsrtaxrp;u1oex mo3iyslmDulump;t0tltomf iodfm rluesl( s2toxrpoo4ll elicsat  rrmxrooo4apx  fcilsla eaumsnt0 renmo3tydoaDran i;t0s2tm(o iu4opte ivsas)sDtaur nu0oexo ietytfs emnmonu0 leomocoydlaDeaueo s0s2xm(m3ny1omte ieias  2rr(m ot1ope ii3iadfs2ua(vonu4trenifcoo1fmD  nvi s s2uoxr3iydlmt mfvta( artrumoot4aexoioctys s2emnmo;t0aetnmf3iotoatrlnvs s setrirpoy4lmte ivsl(  rua( o;o0ope ifcild sDumn p (4altrmrcoo1faDeaneo s)trum(opiodoleelnesls aDum(rpot1oexo o3tls aDrl(vsnu)aleoio3oadfp rlivo s) ruo(mpoo4oltn fei s aDur(ro;t0texoiiciatfmDrl( o u)trerxfctydlpDr nei t) rtm(mpiu4op nlict sf rrru ont4olenifeildfs uln s t0trxnif3oodfmt anei t0 ruoxm nodlmtnlivilsf 2trxm nt0teen feiyt mDrmuvo t0aexoxocta1om rln s;s0 2xoxo nydllte feia(  2urxrono4aetn i3tad aDuaumo;u0teeoxfcta1oa   i o ( tetmimpiy4opeemict s)s2rrx  oo0alt iociadfm ul( o;t0 lenmr3tadlaDelueol()t2xo(rpnu4lp e nci sf 2uaur ;o1tlen fciatla el(vp t4alxrmr ootlptelieilt) etmxo io4omen ivsat sDuaurooo0tptnmociaslaDumnmo;u0arxomo iydlmt livsls)trxr(m3ou4ame mfctas)arur(r ;u0aeenmoctls s elnvsnt)artrio iadlm   iei ( trtriopnu1omen nvt ( srrmurp;o0opto ociytfs um( o;(4trerir3oatlaDe uei;t)teumxo iodll emfcsa(  Draxm nu4oexomfetatla rln o t0tlxnmo3tydfmDran i;s) etoim no1apeemicil(  rtax  ;u4tpe  i3tat sDrl(mon()arxnif tydfp ranvslt) 2xo(m3nodom nmnet s a2tmxm ;t4aeeo fcias s ran pnu4texniocty1lmDrai i t0teum(r ou4lpenlnvia( aDra(r oo0tpxoiieildlm2emn pnu)artnmf3iotfpDeaues;t) etm(o iy1am e fcsas sDtm(r nt0aetoii3iydfm ra( snt)artnmocoy1lpDr neslt) rtr(m oudal emivsatf Durum ;o4texoii3tysla ul( s;t0trtoxrciy1la e u ol(  ruoir oydoptnlfciatfsrrmx  ot0tex  feilslm rmnmonu0 lxrio3oy1fa e ies (0srumxmpoy4lmtnmncsa( s2rm( pnt1oet if3tldlsDemn o;(4aetrxfcoytlmt lnvi ( seuoiopio4lm  lnvslt)sDrmuronu0alen ictld s rm(mon()tetoiociadfmD livo (0setr(o3nodlmee nct s) 2tmumont0olxomo3ils a emu o (0arxrio ta1fp   u olt  exrimpoodomt lncs ()aDuaum ;u4apeo f3tytfm uanvpn(4arenio totfmteaivi;t0 2xmiopnudal  lfesa( s2rm( ont0oetoifctlt s2ul( p t0trenio oatop   ueo;()trtm(opny1op   iesasf 2umx  oo1alt io3iysla2rauvo u0 eeoio3tytlpt  ues;s) 2trio iudaptnmiet t)sDum(mpoo4tpt  ieiadlm elu s;t0aexrir oatlp r neo ()srurxopiydll  lncil(f Dra(r nu0texoifciadlmDrlnms u0tlxoxf io1oa e ieo s0srum(mpoo1apt mivsls)srrrx  ;o0oltniocilsfa umu s (0areoifctatopDe n i;() etrim3io4opeelnes (f rtmump;u4tlen feildla2ran s u) rxrio iotfaD auei;s) 2toxopnodll emieilt)artrum nt0olt mf3tat sDea(vo t)texrir3to1fmt lu s (0t2uoio iudam   iciat  2umxro;u4alxoifciaslsDrl(mont4 eenirciydlmteaieo (0s2xm(rpiydapenliet s a2trum ;o4oltomfcilsfmDrmnmont) reomrcto1fmtelu o;t t2tr(opoodlme  icta( srrruro;t4tpe mfetytls2rmnms (4areoxf io1fp ran ils0srtmim nudlpee fctl(  rurxmooo1aexo i3ilslsDulu p ()aetoir3oytfp eln slt)setmxm3iu1lm nlfvt s arrr(rpnu1opxomoctyt a2ua( o u4 exrio3tydlmtrai o;() rxoxm iy4apenlncs s sDrax oou1aptniietas a2umumsnu)arxniociytop r uvol(  rtmxr3nu4altelfvil( a2tax  ;t4alx ifciat sDulnmont)altnxfcta1omDe u s t)t2tr(rpnudape mneta(f 2ua(mono4apx miciysla2emnvpnu)aetoxf3iatfaDeliesl()t2ur(r3no4lp nlnctl( s2raum nu4tlt mi3iysla2ranvsnu0trxnio oytom  ln ols) rurirpiu4ome  fcilt srua(mont4aleniieils sDem(mp u4alerxo oadlp e ivi;(0srtmim3no1altnlivi (fsrurump;o0tpe  ociasfa2uan ont4 exnmo io1opteluvs;t0 eto(rpoodale livilsfsrumxrp;t0tpeo ictatfa2umnmp;t4aetnxo iadfa rai o;() 2xriopiy4apte ivsa()a2tmxr ;o0altoif3tytfa2em(mp t4trtnmrctotlmDe nvs;()srxmxm3nu4lmte fvtat)sDtm(  ;u1oltomf3iltls rlnmpnu4 rtrmociodfmt aueo s0s2to(o iudomenmfeiasf Draum ;u0aeen octls a em(monu0 lerif3oadfaDeaiei;()t2xoiopiu1am n ncil( srtm(m ot1olxniociadla2emu snt0alxrxo3tatfmDr u slt0 2xmxr3nydalen fci (  Dua(rpoo1aeeo oeiytlsDrl(mo;() ltrirctydlat  u i s0srxo(m oy1ome lnvsasf rur(rpou1oleniieiysfs ul(vp (4alxoif ty1lmte i i;t)t2xrxr io1llt  nctl(f 2rau  ;u0ale mieiat sDuau snt4trtnircoytopD  ieils)s2tmirpio1optelivia( arumx ont4tptoioetld s umnvp;t4trtnxf tatlptr ies t0t2urxm3oo4amte ncia()artrx  oo0tlxoifcild s2umu p t0aexnxf iy1lmt  iesl( tetoxo oo4amt lfvs sf Dtm(  oo1tetn ociyt aDrauvpnu0 exniocoy1oate n s t0 eurxr oodopenliet ()artr(m nu1oeen oeiytfa ra(ms (4teerxr3iytfptraues;s)t2tm(r3ou4am  lncil()aDtrxrooo1tlen ietyd mDuauvsn(4trxoif3tydop raues (0seuo(o nydam elncslt)srurx p;u0oeenmoeiysls2uauvp (4trtrxrcoa1laD aueo t0t2urxm3oodaltelfesls)s2rrumo;t0opxomoeilt m rlumo;(4aeeomo iydoate u s (  rxr(rpio1amtnmnetlsfsrrr(  no1oexn o3iytls2rm(vs t)alxnxo3oadlmtraieo (0 eumim io1ope micsa() 2rr(mpot0ole  fetlsls2ul( on()tltoiocoatfaDrlu i;t)s2tm(o oo4alt mncsa( arta(mo;u4olx ioetytls ulu sn(0aeeoir3iytlpDrlu sls0trxoxo iy4lmeemictls)artmumono4oltomfeiyd m2elumon(4trxoxr3todla r nes s truriopnydlmee ictasfaDuax  ot1oetnmoeiysfmDrmnmo;u)aetnxf ia1lpteaivi;t0srurxo3ou4al nlictlsfs2raur nt0texo oetlt aDrmums ()arxrio oydoa   nvo;s setmim nudame lfetlt sDtaumoou0tetnio3ilslmDem(vo u0artriociodlatelueols0 etr(r nu1lp  lnviltfa2rmum no4tltnmiciytlm ulu o;()altnxf3oatfaDrlnvi () exrxmpno4ome mietl()sDtaxrp;u0teeoiieiysla2ea(vsn() lerxocio1opt lu sl(  etrio3iodoltnlncil() rrrum ;u0tpx mfciysfm2ea(ms u4aetrxfciodlaDelueils0sexoir ou4llenmnes sf rraxmp;u1oeenioeilsfaDrau s t4tlxnxr oydfp eanvsls)srurimpoodolee ivs (fa2rr(  ;t0texoii3iadfa2ulnvs u)alerxrcta1lateaiei s s2xo(opnudll nlnet tfartrx o;u1apeomo3tltfmDrmnvo (0 lxoxrcoadoa   nvs s  2xmio io4lltnlnvs tf Dra(r nu0apenmietlsfa2emnvsnu)tltniocootlmt ai s t) 2urio3oo4llteliet t s2uaxmo;t1tltnmieilsfaDrlnmonu)tetrir3tadopDean i;()seuoiopnu4optelietltf Dtrumont4opx  oeiytlsDuauvp t)arxnxo oy1omD auvol( setmxm3oudop emfvils arraumpno1apt iociasla2ranmo t4trermr tydoat  u s s0texo(o iydll   ncslt)aDrmum no4oeto i3ild m2rlumont)trtrio3oa1fm r ueslt0trtm(m nudome mfes () Drr(mooo0tpx  ociat mDul(vp t4texnxociytoateluvi;s) rxm(m3iodlpte iet (fa2trur nu1alt mociatfmDumu s t0tlenxo iydoaD  uvo s0texoxrpoodlm n ivtat  2tru o;o0alto fcilsls2ulumo;u) leoxo3tatfm  ln i s) euoirpio4am e ivil(  Durxrpnt1aleomieiatfm rau p u4 rtoir3oy1laD aueolt)tetm(r iydal   fvsa(f 2ra(  ;t0tpeomi3tatfs umumon(0 lxrxr totlateau i;t  rtriopno1al  lnvsa(faDuru  ;u1texnmicilslm em(vs t4 leomfciydop  anvs ()teum(opou1al   fetl( arrax o;u1tleomieiasls ranmo () rxoxr3oy1omtr iei ()tetrxo iu4ap   fetasfa2tmxmono0aeto oeias mDra(vo;t4teenmocta1oa rlu i t  rumxo3oy4lmee nvia(faDrau oou4tlxomoetyt sDranmont)texrxo3iy1opD lieo;(0 eto(m oy1om emici sf 2urumpou1oeen f3iaslm uluvont4aetoir tadlaD lu sl(0 exoio3ou1altn neiltf 2rau  ;o1oltnmictysls ranmpnu0tlxomr tadfaDeau o;s seurir3iy4am  livs s aDraump;u1apxomoeiyt m ulu p;t4tlxrifctadfaDean s;s0trum(r3oudol elivi tfaDrm( o;u1tltnmiciasls2ea(ms t4trxoif iatoatrli olt trurxm3nu1ope lnvs (  Dum(mont0alx io3ilsfm rlums u0trtrxo oatom raiesls)trto(r3nu4omenlictlt  2umxrpnt4aetnmictatls2ra(mpn(0tltnxf iodlptr i s t0srxmxm oydlpe mnetls s2umumpno1tptnmo3tatls uaumsn(0aetoxo3oa1faD an sl(  rtoxo3oy1lpen nctl(faDrax oot1aeto fcils s2em(vsn()tetnio totlm ranei s)t2tmio3nu1omeemfvsasfa2rmx oou4alenmo3ilsfm2rmnvp;(4artnir3iotoaDr u sls sruoxopno1lltnlfeils)aDrr(  no4apxnmf3iysfsDuanvpnt4 etomr3ta1oaDrli olt trtmir io4ll e fvsls)s2rmum ;t0aeeo ictyslsDulums t0altnif3ootopDrau o (0teum(o oodom e fesl() rum(m ot1oeenmf3iyt s rmnmp;u)teeoio3iotom  ln s s t2xoxo oy4alt mfcsa()s2rmumooo1oee iietatfaDrmu o;(0aexrmfciotfat  nesls0 exm(r3oy1lm emfvsa( sDra(mpno4apxnmociytls rl(vpnu)artoio3iytom eluvo ()trtmxo3ou4aleemnci (fsrrm(m ;u1aetomf3iatls2rmn o;() rerxo3ty1fp eluvo ( trxmxrpoy4am n ncsa( aDua(m oo4alt  ictlsfsDuauvs;(4 etoxf iotfm  livo ()t2xr(mpiudapt mfvs t)a2uaur oo4aetomfeils m2uau s;t) leomr3oadlptrlu o;s texo(mpnudalt livs sfsrrrum nt4ale mf3ias m ulums u0 renmf3ty1lmt  i i s srxrxrpnydole lncs (f Draumono1tptnmfeilsls2eauvp () leoif3oodlatr uvol(  2tmxr3iudolt mfetas) 2rrx  ot4oeeomi3iysfa ua(vs;()alenxf3ta1fpt lu ols)srtm(m iu1lp elnvias)s2ua(mo;t4tpto fcildls2rm(msn(0 lxrio3iodfmtrliei s)s2xrxm3iydomt lneils aDra( ooo1oeen f3ilsfa2ulnmp;t0aetrmf3oatom raivs;()trurxr3io4om n fvia()sruru pnt4opt mo3ildla ea(vs;() lxnifciy1lptrai slt) exoim nydlptnlfvsa(faDtr( poo1apeomfetls a2uau p;(0 ltniocio1laDelneo t)seuo(r3no1ope  fvtltfs2ra(root1tlx ioeiydla rlnvs;u4trtoxo3ia1op  ln s ( t2toirpnu1omeemncilt  rtr( onu0olx  f3iatfa rlnmp u4arxrio oydla raueo s)s2urio3iodlp n fvias)s2umur ;t4alxniieilslm2eanvp;t0 rxnmf oytom  au s;s)trumxmpou4ap   iesl(fa2tr(r nu1tlenmfctasfs rluvpnu)trxrmr oy1la eau s;s) 2tmim3nudomtn nvtlsfa2ra(rpnt0optnio3ias s2emuvonu)trtnxfcoy1oatraues s0tetm(opoydomeelfvt ()arumurpno0openmietltfm2ra( p;u)aeerxo3oodoa  ai o (0t2tmir3oo1ll  licilt) 2tau  nu0tpxomo3tltlsDumuvs;u0artnir3tadfm elies ( trto(o3nu1lpenmnetlt  2umx onu4tlt iieiydlaDrlu o;t0 exrio3iydlatrlies ()t2toio3nu4op  lfvs (fsDur(ro;u4oetn fetlt aDumnmont4 eenio oydoaDr ieo s)s2xm(r iu4ol   ict t)s2tmurp;u0alx  feiasfm ulnms;t) rtrmo iotfm  luvol( t2ur(rpiudlpenmnei s  Drrur ot0tle moeiatfs2rl(mpn()tltrxfciytlpt  neilt s2trio3iu1ope mneiatfs2ur(m oo4opto fciad m rmums (4 etrxrcto1fmDeau o s) 2xr(o3no4lp nmieils)a2raxmoou4oltn fciltls2uluvpnt4 lxrxr3iotlptraivi ( trtmiopoy4aptnlfvi (  Dra(  nt4tex  fctlt mDrlnmpnu)arxrirciodoatrlieo s)tetoxopoodop n fcs s)srtr(rono4alt mieiydfaDrlumpnu) ltnio3ta1late n o;t0 etmxo3iy1om   iesa(f Draxrpot0tpx  feild aDelnvpnu)texnifciydlm r nvi ( teum(r oo1omenlictltfsrurx oot1aeeo feildfsDeanmpn(4 lxoxf3iytlptrai s;t  exrio ou1apt micia() 2umu ooo0tet mfeiytlmDraumo;t4 reomfcoydfm eaieils trxrir io1lle  net s  Dumu pno1olxoiociltlm ul( p;()aleoir3io1fat auvslt0sexoxo ou4ll  mnviat)s2rrxro;t1opt moctadfmDemu p t4 reomr ty1lpt  uvsl()s2trxrpno4lmt mictltfarrmxmpno0texn feilt s2umn p;() lenif3ia1fm rau o t  2xrxr ou4lmeemivsasfa2tru  no4opeomicilsls2ul(mp t0 lenxf3oo1fmtr i il(0 2xr(mpny4opt lfvs tfa2uru pou0aetnifcias a2umump;u4 ltoxo3io1fa  ai il()teumxopoudllenlics ()a2umu onu1apen ictlsls2ua( snt) etrir oo1faDrlueols)t2xm(r nodlltelnvtas  Duru oot0tpto i3iaslm ua( snt0trermoctytomDeluvi t0s2trio3no1am elneiltf 2rru pnu0tet  fcild a ul(mpn()alxnxo tatlmtr u s;t0teuoxo oodlpeelfct tf rtrxront1apt  oeiat s ran s;()arxoio tydlp  luvo;s s2trxo nu4ol nlnct (f 2ra(mp;u0aeen o3iltfs rmuvs;()trxrir oytlmt  n o ()trtoxo3nodom   icilsfsDumx pno1oetnifeiyt a raumo;t0alxnifciotopD aivsl(0texoxmpno4omtnmict ( sDrr( ono1apx  feiltlm rlumsnu4treomo3ta1fp  aieslt0t2xr(r ny4ame miei s)sruaump;o4alt  i3iat a2ra(vs;u4aetrio3io1fmtrlu i s0s2ur(m3no4ameelnctas)artaxro;u4olenmieilsfm2ra(ms;(0trtoif3tatopD an o s t2trxrpoo4al nlfesa( s2rm(m ;u0apto iciys m2ua(mpnu0trtoxr oytomDeliei s0srtmio oydlm elnvsas) rrmx  oo4aex io3tatla emnmonu) rxoxrciy1fpD  iesls)srtr(m iydapee fei (f 2ururpnu1texnmi3iytfa2rl(vo (0 lxrxr oo1omt lueo (0s2xmxm3iydap nmnvilt  rumu  ;t1oexomfeiadfm uauvon(0trtrio ootlm ean s () etrio ou1ol nlfesls  Drmxro;t4olxnif3tadfaDuaums u)tetrircoydlmtrai o;s0 2tm(o3no4ameelnvia( a2umu  ;u1tptomi3ildfa2uluvpnu0trxnxf3ty1laDrau i;s srto(m iu4llt lnvils  rrm(monu4tetomietldls um(vo u)tetrmfciy1fa  lu il()srumxo nu1op e fcsltfsDtrump;u4tle  ociaslmDel( snu4tltoiociadlp  aneo;t0 rum(r3nodoptnlietlt) 2urxmo;u1openifcildlm rau s;(0 etnmr3iytomD  ieo ( trtrirpoodlptn neil()aDrmx  nt0apxnioctldfsDemu p () reoio oy1latrlnvs s)srxmxo oodoleemfcilt aDta(  ot4olt  ociyslaDumu p;(0tleomrctatlpDr nvi;t  exm(r3ny4ol e nvi s s2ua(moou1aeeniieilslmDuan pnt)tlerio3io1la  livs;t0srtr(o3oydolt livi s)s2rmurpoo1opeoif3iyt mDemnvp;(4aeermr ty1fm   iei;(0tetoxmpny1ope mfvsa(faDua( ont4oexn i3tls sDem(mo u)tlxoxoctatom eauvo;s)trtmiopno4lle mnci ( s2ra(rpot1alx io3iltla uau p;t0arerircio1fm e uvo;t) 2to(mpny1opt mfci t) rrm(monu0olt mociyd sDranvon(0aexrifctadfmDrlivsls0sruoxm iodolt  icil()sDta( pno4alxomietld m2uanmp;(0 reoxrciadfmD luvolt0srxrir3no1apt  nesas aDurxrp;o4tltomictydfs2rm( p u4arxomrctotom r nes ( texoxopou1al  mfet ( sDraxrono1tlxnmo3ildfa ranmp;(4alxomfcia1lm   ivol(0t2urxm3nu4om nlfvil()arrax  ou4tpeomfciyt m ulums;u4 leoxr3tatlate uei;t0teto(rpno1llee nvta( arua(r oo1alx mfetyd a emuvs;()texrmr3oadlpte i ols) etmirpoudlpte net t  Dtaxmo;t0aptoio3iydlaDrm( p;(0arenio iatop eau i t0srto(m3oudlpeemfctas) rtau pot1tpx mfeiat s eaump u4altrxf ty1laDrli il( teumirpiu1olt  fet tf Dum(root4openifeilsfa rau o;t0 lerxr ia1lat ln s;t t2xrxmpnudameemivs sfa2tr(rpnt0tet  fetyd m2umnvo u0altoircty1laD  u o;()trxmxrpnudame lfcia(fa2rru  nu1tlxnmf3iysfs2uau s;t0trtnxr oydlat  i slt0seuoim oy4ll n ivtasfa2umxmono1openmfeias s2eau p (4texoxocoatlptr i s t srxm(o3oy1ole mfcsas)sDtru  ot1oleniiciydla2rlnvo;u)arenmo3tytopD lu ils) 2uo(r io1ap n ici ( sDrmx o;t1olxn ieiys aDel(mo ()artrxfciydoa rlueo s0texm(o3iu4llte fcsl( sDuaxrp;t4tee iieiad m2rmnms t0 rtrir3oytom  luei ( trxo(opnydolenlietlt artm(r ;t0opt  oetysfmDea( p;t0 eenif3oodoa   i olt)t2um(m nu1lmtnmnvslt)sDum( p;t0opx ii3tltfm ra(vo (0trxoif3io1la elivi;t0trxm(o3io1omtelics s sDrru ono4optnmieilslsDra( p u4alxrxr tadfmDrluvslt0 rurim3ny1opeelfcsat)s2umxmont1ale ioeiytls emums;(0trtnif3oadoat  neo;(0 2uo(opoodlmtelnvsltf Drr(mp;t4oexo ocildfm rau s;(0 exnxo3tadom   uvs;()teuo(rpoy4lpte feia( aDuaxmpno1alt ii3tysfaDua(von(0 rtomfctadfmDe n i;s  2xoxr3iu1op  mfct s) Dta(m nt1ope  fciysfaDeauvs t0 ltnxf3iadlpD li olt)seuo(o3ny1lptelivta( sDrmur ;o1aex iiciytfa2rauvont4tleoir3iatfa eau o t)tetriopoy1llt mnes t srrau  oo4aptoiictysla raumont) rtrxociadoaDe nes t)srxr(r3iodomt micsls)artmur ot4aex mocildls2eanmon()arxrio3ootlmDeanei () 2xr(mpnudap   iviat  rurumonu1aetomfetlsla2uan snt4 rtomo ta1op eauvslt0s2xmxm3nudlpt mnetasfs2rmu o;t4oleo oeiysfa2uaumpn(4teerif3oytlm eluei;t0t2xo(opou1ap  mics s  Dta(r ;u1apx mociytfs2ulnms u0aeenxf tytfmt aneolt  exo(o iy1omeemivtasfaDra(root0tleomfciydfm rm(mp;()aleniocoydoaDrln sl( trur(r3ou4lmtnmfvilsf Drrxmo;u4oexoiieiyt m eauvs;(4 etrmf3oydomD aivil() 2uo(o iydlpt  fvi tf rum(r oo0tpenmf3iatfsDem(vsnt4trxrif3tadfate nei;t)texmxrpoydopt  fcs t a2tmxr ot1aee ii3iltla eauvon(4tleomo3ia1laD lnesls)truoimpio1lmt lfvi s aruau onu1tlxnmoctatls ulnvont) etomr3oatlpt ln s t srtmirpnodole lnctatf rta( pnu1tetnii3iytfaDra(vo u4trenxocoo1oaDelnesl( s2xoim nu1ope  ietl() rtmumono4apx mociasfa2rln s;t0 rxnmrciytoat  n s ()s2xo(opiy1ome licia( s2tmxr ot1aexoii3ilt a2rl( pnt0trtnxfcoo1fmDrai i s  exm(m ny1al  miet sf Duaxmo;o0tpxn feiatlmDelnmo;u) rerxociy1fa  aivo s0sexrxmpoy1aleemivtl(f rtr(m ;o1apt ii3iyslaDum( pnt) leoxo iadfpD lu i t  2uo(mpiodolen feiat)s2trx onu0alxnmociad s2emums u0tleoircto1laD  ieo t  rtoxm ou4lmenlnes (faDrm(r ot4tlx ifetad s2uaumpnu) lxriociotlmteanvo;(0sexmxm oo1lmtemnvias)sDtr( pou1texomiciltls2rlnvp;t) leoxr3tytfaDrlnes;(0 2urxmpoudlptelnvil(farur( poo0ole ifcildlm elumo;(4arermr ootoat an o;s0srtoio3iydap nlfviat)sDta(mono1altnii3tldls2uau p (0tltnxfciytlp   u s;t)seuoiopoy4altnlnetas a2urxmp;o4tpx  oetyslsDuau o u) etomo oodlaDeaivils s2tmxopiydlptelnvsat artru  ;o1oeeomf3iysfm2elumont)trxnxr3ia1opt an s;s0seuriopiy4ol  mnvsatfarurxmpnt0opeo f3tasla elu o;(4arxnmf3iotoaDrlies;s teurxmpoo4olee ivia(f Dtmu p;o4tptomfctldlm2eau ont) exnmo3iadomDrluvsls seumxr nodopen nct t)a2rru o;t4apt moeiysfsDrlu ont4 etniocootlptr ueo;s tetm(opnu1ap e ict ( aDtrxmooo0tlxomoeiad s eaumo u0artoxr oytomDr neils0teumxrpoodopt miesl(fsrrrxront4optoiictysfa2ea(vs () etnio todfpD lu o;t) rtmxrpnydape  nvta( srtmx  oo0tpx mfcias s2emnvon()aetoxf3ta1lat lueils) eumxm ou4ame lnetat  2uaxrpnt1altomi3iad aDrln pn(4tetnxociy1opDr ues;( s2tmxm nu4aleemnci t)s2rm( pou1aeeo ietydlsDem( snu4 etomrcia1omDrlu o;(0s2um(m nodop  mfes s  2ra(  ;u0teeoiietldfmDumuvo;(4 reomoctodopteaneo;t0 ruo(mpoy4ap n iei ( s2ur(rooo1tlen f3iyslm rmu sn(0aeerxr3oatlptelnvslt)trurirpiu1llen fvt tf 2uaum nt4opxo fctat m2eanvpnu4altrmo3io1lpDeai ols0 2to(m3ny4ale  ncsltf Duau ooo1apen ietas aDrau p;u4trxnmf3iydfpt lnvo t) eurxopoydlme lneia(farraum oo4ope iociasfm2ua(ms t4texnmf tadlp   u ilt0s2xoim ou1ol  mneias)aDraxmo;o1aee ioeiys s2uanvp;t0 ltoio todfmteanvo;()t2xo(o nudll nmfvsltfaDtrumpno4tet mictad aDrlnvsnu0alxnxf3oo1lptrln o s0 2toxo no4oltnlfvt ( sDur(  ot0tetnmieiadfsDraumo ()trtrxo iy1oatran i;s0tetmxm iy1alee nvs (f Dtaumo;u0oetnmoctld aDranvs ()aeenxr tatfa eaneo;t)srumxo3oo4llenlnviatfaDumx pnu0olxoiicils m rlnvo () rxnmo3iodoaD aues;t)trxrio oydap  lnetasfarrmx o;t4tle  f3iatfa2rauvs u) rerif oy1fmte ivo;t s2xr(m3ou1lpe lnei t)sDurur ou1tpen icild s2ra( p u0tltoxf oytoat lies;(0 2tmimpiy4lm eliesatf 2rmu oot1aleomi3iaslaDrlumo;(4 eenxrctatfmtraivs;t  euo(opio1aleemfvi s)aDuaurooo4opxoii3tytla2ul(mp (0 lenmr3iatfatrlu slt  eurxo3nudop nmnvsat)artru pot0aee  ieiydfaDua( o;(0 exomrciatomtr u o;()s2xoirpnu1llenmfvtat  Durxro;o4aeeniietys m2el(mo () rerir3ty1fmDrluvilt0texmiopnudll nmfcils aDraxr nt4ope iiciytfa2rmnvpnt4 etoxo ootlateli s;(  rtr(o3io1lp nmfes (fs2raumo;t0tpe  icild sDuau o u4 eeoif3iotop eaiei s teuoxo ou1op   ict t)aDraxmpnt1aleomf3tytls2ranvs t0 renxf3tatfmtrlivo;(0teumirpno1olen ics (f 2urxr oo1aexnmfciatlsDrmums;u)aexnxf3oydoat li ils t2toim3iudomtelnesl(  rum(  nu1apenmieiytls2emnvp;()arenircootfpDrlu ols srtmim3nu4lmtn fvi s)arumu pot4apto f3iysfsDrau s ()aetoxrcoodlp  luesls)trxriopoodol   ivt s artru  ;t4oeenmf3tlsfa rau o u)tlenir tydlp  lu ils  exoxm oy1lpte fcs t)aDumxmonu0teeomiciatfsDem( snu)tlxomrcoatopte ueils0teumio ou4ll   neiatfaruru onu4oeto feiadlaDem(mpnt0teermr oa1oaDr neo ( srxoxm3nodopeelnetas a2rmum ;o0aptoifeiadfmDra(vsnt0 etoio todfat aies s teur(m iu1altnmfesls)aDrm(  ;t1altoii3iytfmDelums;u) ltrir oo1lptrluvils) etr(r3no4op emnvi tfsrurum ;o1altnmfeias aDem( p;u4tetrmr to1la elnvslt0 2xm(m3oy1amenmivtatfaDrm( p;t4tpto iciadla em( pnt0aexrirciy1oaDrlneol(0 rxm(o nudame lfetls a2ra(rp;t1olen oeiysls2eln p t0altomfciodomtrluvo (0tetm(o3nydopenlivsat  rum(mpnu0aexnmiciatlmDean o (4texoif iy1op  auvols  rxo(m io1openmieias) 2rm( o;t4olen oeiys m eanvonu0tlxnmf oatlmDe i s;t0t2ur(rpiudll e nvi s)srum( pou1ale  ictltfs ea( pnt)tltrmfcoatopD ln i s0 exr(rpiudope  ivias)sDur(mpnt4aeeo icilsfm um( p;t4tlxoirctydlm eauvi;()s2xrxr oodll elneilt)a2umumo;u1olt iiciysls elu pnu)aetoxrcio1op eauvi;(  2umir3oudomee fcs tf rurxm nu4alen feiatla ranvp () etrmrctadoa   n s t0 rxr(mpny4aptn ivilt) rua(mo;o0alx mf3ilt a uanms;t0 exrmr iy1fmtranvol()t2xm(r3no1lmt mfeiasf 2umumoot4aetnio3tlsfmDea(ms (0 rtnif ty1om rlieolt0 2xmxr3oydlltemfctatfartaum oo4ope  fetls s2emu snu0treoxo3oydfpDe ivsl() etrxr3oydlle mnci tfsDrr(m nt1aee ifciydfaDem(vs;u0arxoxrcoydopDr ivils0srtr(m io4omeemfvta( arumur ;u4altn oetatfmDemnms;t4 eerxr oodlat  ivols truoxrpoudapt lnvsl(fa2tr(  nu4oltnii3iytfm2ra(vsnt) rtrifcoy1op eanei;( t2uo(mpiudam e nes sfsDrrxr oo4apxniociatlsDeanmp t4tltnxfctotlm  aivi;s0 exmir3no4lpenlfci s  2ta(rp;o1oex  o3iat a rlnms (0tlxnir oadopDrlneo;s0 rtmxm3nudomee ivs t)s2ra(r ;u1ale if3iatfs emu o;t0artomr3iy1oaDe nvs s0trxmio iodlle mivtat)aDtmu  ;o0tptnmiciltlaDrauvo t)trxomo3iatlmD li s;(0 euoxo3no4apeemfctlt)a2rrum oo4tpxnif3iyt s rm(msn() exnxrcto1fa  aues s trtoio nu4apen neil(fsrua(m ot1oltn ociatls2ean o (4trtnifcio1lmtrluvs;s)srxm(r3oy4opt mnci s a2rax o;u0aee mfeiydls2rlnvsn(0 etrxfctytla r n ol(0 rtr(m3nodlm e nvslsf 2rruront0opto f3iatfs2rm(vp;u0tltnxo3oo1fpte nvs t0t2urim3nudap nmfetls) 2tr( oou0aptn iciydlsDelnvont0trtnio3tydlpt aneo s t2ur(o3no1lptnlieslt  2trxrp;u1oet mietldfsDua(vp;t0alxnio3oadlp eln i t0 2to(r ny4apt lies t  2ua(rpoo1aee mieilt aDem(mp;()alxrifcio1omte ieils0teumio3iydapt  nctl(fsDumurp;o4oeeoiocildfsDum(vs (0 eeomr3iy1fmt  ues s0truoirpou4ap  licsl() rumuroou4opeo f3ildlmDea(vo;(0 rxnmf3oytfm  aueo ()trxo(o3ny1oltnlnetl( arraurp;t0alxniociltlmDuan p t0 exomocoatfatranes ( trxmim3ny1lpt licias)srtmxmp;u4tpxnio3iatfm2raumo;u0alermr to1optrluvslt srumiopou1amtelnctls)sDtmxr ;u1tlenifciasfmDeaump;u4alxoxr io1fa   i ol(0t2tm(o iy4aptelfvils aDtaumpoo1alx io3tysla rluvpn()tlxoxfcootfpD au i s  2uoio3nu4ame licsas) rraurpoo0tlxnmfcilslmDeluvsn(4aleriociytlmtranvols0texmxrpiudol e ivtat)srrrurp;o4oet mociatlsDrlnvpn()tltnxo ootfmtraues;(0t2xmxm3ny4apeemietas)arururpno4oee  fciytlmDra(vonu4 etnxo to1lptelivs t0 etm(mpnudopt lfvsl(  Drm( oou4tpxomo3tytlsDua( p u) rxriociadlpteauei s)texoio oy4ap nlnetls) rurump;t1tpx iieiadlsDel( on(4texnxo3oa1fateln olt) rxr(r3no1al   ietas)arum(roou0altnifetad aDelu pnt)trxoio3oa1lmtr ueol( s2ur(r3ny1lme mncsa(fsDrr(roou1olx  icilsls2eluvo u0aexnxf3tatlaDeliei;( texmxm iydlltelfvi sfa2rmxmpoo4ope  icilsfs2elu snt4arenmocto1fpDe nesls t2xr(o3oo1apt  fcs tfaDrmxr ;o0altomi3iyslaDrlnvpn(0 etoxf3iytop eln s;t0trum(m oodop  lfeilsfartrx  no4ale  ieiytls2emump t0 rtnmf tadoptrlies ()sexmxr ny1ol emnvil()s2rru poo0tpxomo3tad a ua(vp;() exnmo ootlaDeln i;t) 2tm(r3io4omtn iesl(  rtauro;o4oleo octytlm2emnvs;u0aeerxo3ia1faD lnei s)setmim ny4ale lfetat)srumuronu1tpeo i3tltlm ua(vpn(4trtoifctodlmte iesls)s2to(m nydlmte iet (f rtrx o;o0altnmictysls2el(vs u)arxoifcty1fat an o s)srtrxm3no1lmtelivtls) rraxm oo1tpx mo3ils a emuvp t) reomr3oy1lpt au o t0 2ur(o iu4am n fcsasfs2umurpno0tetniieiydfsDrlu s t4aexnmr3io1lmDr u s ( s2xrxrpnu4omtelfcsls  2uru  ;u1opxo feiatfs2em(msnt0arerxr3tadoaDe uvs s texrxo3io4ol n fetlt) Dumxm no0apt mo3iasfs ranmsnt4 lenmfcto1lat  i i;t s2xmxmpnudapen fciatfsrum(rp;o1tpxoif3iat s rm( snu0trtrxo tytfaDeli slt  eurxr3io1om   fesls  rurxroot0aleoioeiadfaDelu s (0arxrxo iodoat lneo;t)seumim3no4oltnlnvslt)aDtrxm oo0oleomoctys s ulumpnt) leniociytfat luvol(0sexm(o io4lltnmnesl(  Dtr(r ot1apxn ieiydfs uln on(0 reomo3oo1opteau ol(0s2xrio3oy4om emnvtlt)srrau  no4oetnmf3tldfs2eln s;(0arxoxrctatlatrlnvil( sexrxrpiodlpe livilt  Drrur ;u0tpeo f3iyt s ua(mo;t0areomrcty1fpt ln ols srxoxr3oo1oltn fvi sf 2ururpnt4aptomictyt m2umnvo (0aetnxf3iydfmtean i s)texrimpoudome lfcta(fsrtmur ;t1alenif3tadfm rmn snu0 rtnio3iytoa   ieslt)srxoimpno4olt mnvtl(fs2tmuro;t1oltnmfciadfsDua(vs;()teeoif3todfateli slt srtmio3io4om   fct s s2raxr ou0oetoif3iasfsDul( s () lxnxf3oadoatr iei s)srurxo3iu4lp n nvsatfa2ta(mpnt0oee  iciyd s uluvo;u)artnxr tadlaD aivo t0sruoxo iy4apeemfetatfsrrauronu1apx  ociytla2emnmo;t)tlxomoctodlp eluvo;t0t2trxm3iy1opee fesl(  ruaxr ou1opx  octydfa2rauvo;t) lxnxf3io1fate nvs () rumirpoo4am  licilt) Duauront0apx mfcils s2rluvs;u4aleriocto1om e ueo;( tetr(rpnudlle  nvsltfsrtrxmpoo1aleniictatlsDea(ms;()arenxf tadlmDrlnvil(0teur(o oudlm   nvslsfartaurono0tlx iieildfm um( p;u4 exrmr3iydlmt ln i;()seumxm no4aleelivilt)sDtrx pno0olen iciltlm rluvp;(0aetnxo todfp rlieol() 2tm(rpny4lm n fvsltfaDumuroot1alt moctyd sDea(vo;u)texnmoctotlmtean sl(  rumio iy1lp  mnet s) 2urxrpou4oltoiictytlmDua(mo t)tetoifciotlat ai ilt)srxrxm io1ap  miei () rtmxronu4tleoiieiad a2rm( s;t4 eeoxr todfpteanvols)t2um(opoo1ameelneslt s2urx  ot0tetnmieiatfa el(vsn(0arxrif iytfatrliei;s)trxoir3oy4lmte netl( a2rr(mpoo0opxomf3tytfaDel( p;(0trtrmo3iy1omteanvo;(0s2tmxm oo1amte fei ( s2rmxrpnu1olxnifetasls emnvp u) etomo3oy1fa raieo t) rtr(r3no4omtemfvi sfsrrmu  nu1olxoifciadfs umuvpn()tltrmfcoy1lp   neils) rtm(m no4alenmivtlt arta( o;o0texo ieiasfs2rln o;u4 lenmo3io1fmDeauvol(  euo(o3oo4lpe mfciasf 2rmxmpnu4opxo o3ilsfmDuln s ()aleoir3tatlp rlieo;t s2xrirpiu1al e fvils a2taur ou1teto o3tld sDel(vo;u)altnifctotomDrlueol(  eurir io1omen nvt t  rrmumo;t4altnmo3tadla2uaumo;()altrmrcoo1opD lnei ()tetmim3iu4omt lfet tfa2rmu pno0apxnmf3iltls rauvo;u)trxnif tadoptraivi t0s2tmxmpio4lm n ncsl(farurur ou4teto o3ild sDulnmp t0trtnif3oatlpt aivi (0s2xriopoo1om n ivtls srtaxm ot0tetn oeiyt m2ean o u0texrmo oo1fpDr ivs s)t2umxr3oodalee fetlsf Dua(  ;o4tpeomicilslm2em(mo;t4 leomfciatfpte i i;t trxo(opoo4apeemicilt s2rmx onu0oleomf3iytfmDumn snu) etomf iy1lmDr n s;(0t2xriopiudap  mnvtat) rrru p;u4tptnmo3iys s rmu sn()trerir oydfp   u s;s)s2xrxm3iy1lp e nvsls)s2rmumoou1olen f3ildls2rmumo t0treomo tydopDeauvo;t0 rumxopiu1ameelfeias) rurx o;t4apx ifetadlm2emump;(4 eerioctadfm   nvsl( srxo(r oodomtnmfetat)sDum(moot1alxo f3ilsfa2el(mp;u) ltrmo iy1om rlnvi (  2umio3ou4am n ivilsf Duax o;t4tlxnmfciydlsDulu o;t4 rxnio oo1lm e ueils texmio iy1lpte nesltf 2ra(m nt0altnioctys a rmump () rtrxf3ty1oatr ieo (0s2trir iy1lptelnes () 2trxm ot1opxn i3iyt aDemnmp;u)teenmo3totlat  uvsls0 2trxrpiu4ol nlnet t a2trx  nu0oeen ociydfa ra(mo t4arxnifctodfaDr ieo;(0srxo(r no1om elnvs sfs2rrxmpou1ale  ieiydfs em(vp;t)tltrxrcto1op   i s s setmio io1omtemfctl(f rrmxront0oetn oetys s rlumpn()trxoif3todop eauvi (0seumim oy1lleelfeiasf Dua(m ;t4oeeoiictlsfm2ulumont0areoxrcto1om  ai s s0trtrxo iodlp nmncil(fartmxro;o1tlxo i3iytfm2uau s () etriocootfp elieo;()s2toxr iodlp   iei (f Dtau  ;u0opxomo3iadlm rm(von(0tlxnmo3oo1fate nei;t0trtmiopno1amt  net t)aDum(rono4oltoifeiyt a uln pn()teenifcoa1lpDelnes t0t2xrir3io4ame  nctltf 2tax  ou4texo ociltfsDumu p;t4teerir3iatla eluvs s) ruoim nu4lmee iet t a2tr(rpnu4aet mieild a elumsnt4tltrifcto1faDe ues (0 rtm(o3oydoltelict t s2umu o;o0aetnio3tyd mDuau on() ltrmo3ta1laD  uei s) eumimpoudomtn nciatf 2tm( onu1tltnio3ias m2rlu o;() rxriociodlpD lnvsl(0t2toxr nudll elnct s  Dtrum ;u1olxo oetlsfs2em( p u)areoxfcoytlat ln i;t)tetmim3nydoleelnct s)s2trum oo0olxn f3tld a raumpnu4trerxo3tydlmDeln i s)t2urxm3oy1op n neia(fs2uaum ou0altnmoeiadfa2eln o u4tltoxrcoa1fpt  n s;s)setoim oodomenmncia()sruaxroou0aexoioeiytlm emump u)teerxr3to1lp r i i s) 2xo(o3ou4ale lfcslt)a2uax ooo4oee  iciad a2ua(mo;u0 lxomo tytlm  an s t)trumio oo4ap nmfcsltf Dum( p;u1ope mfcils a uluvp;u4treoxr3iatfm  livo;s setrir ou1omenmics sf 2tmxr nt1tpto octldfaDeanms u0 rtrmf3ootoa elnes;s0t2tmio ny4ale mivs t)a2tm(roou4ape ii3iatls2rmumo u) lenxrciytomDeli i;t)seurxmpou4lmenlnciatfsrrm(  nu4tetn f3ilsfs elu s u0 eenmrcoydlp e i i;s0t2xm(mpnudaltemncias) rraxro;u4altoiieiys a rl(vsnu4 lxnmf3totfmDranvi;s)texr(m ou4amenlicsat) rua(rpnu4tpx mfetasla rm(mp;(4alenxrciotlmteau i;() rurxm oo4lptnlncs t) Dtr(m nu4tee iietatfs2uan p (4artnmocoadomD li o (0s2uoxm no1amt  fvsasfaDur(m no4oetnii3tatlsDelu o;t4treoifctotoa eaueo s t2tr(rpnydlle lnes s)arrrxr nu4apt ifeiysfmDrmuvsn(0artrxociy1lm eaivi;( srxrxm ou4ame  nviatfarraxro;o0tpxniicilslm ulu p;t4trxoir3iy1lp  au ilt)t2urxr iy1ape mncs (fsrtmurpou0tex mo3ildlsDrauvo;u4arxoxr3oy1opt livil(0srumxo3io1ap elnvtlt sDurump;u4tlxo i3ilsfmDua(vo;t)texnif ootfa e i s;s0 rxrxr ny4ol n fviasf ruaum ;u4tlxniociytfm um(vp (4tleoxf3iy1oat  i s;( sexmir nu1al  mnvilt s2umum ot1alt  ieiatlsDumumo;t4arenmocta1opDe nei () 2tmir3no1ap  mfes t sDrrxrpnt4aexoii3tydfmDrm( p u) exrif todfpDe nvi s)srxoxrpiu4amee fct (  2ra(  ;o0aeenio3ilslaDuln sn(4alenmrciadlmte uei;(0s2urxmpoy1lmeelfvil( s2rmxr no1opxoif3tyd mDeau snu)aexnxr tadopDr n s ( sruo(rpoy4lle  fvsa()aDtaxrp;o1aptn fciatfm umuvp;u4tltnmo3oy1lp ean i;(0 rxrim3ou1om e ici (fa2urxr oo1texoioeiadla rlnmp;() etriocio1la r neols0srtoim ny1op elfvilsf rra(mo;u0oetnmfciltfm2eau s;u) rtoifciytomDelneo;(  rumirpno1llte ivtatfs2tr(mpou1aptomfetytls2umuvs (0areoxf3ty1lptraieo;(0 2xoim nydam nmiesas)s2um( pno1tptnmo3iadlmDem( onu0 eermf3totlmDeaneils0sruo(o oo4amee ieilt)a2uau ono0oet  ociadlmDuan o;u4alenmf3oo1fp rlu o;t)texrimpiu1omtnmfvt t  rrm(mont4ope  icildlaDelnvp;t)texrio todfpD livi s0seur(opoudal emicil(f 2rmxmp;t1tee  ieiadlaDuaums;(0aetomr3tadoa  auvslt)t2tm(m oy4am emfes s) 2raxmoou0opx  f3tas a2um(vpnu4 leoxr3todlptrlivols  exrxo oydlleelfciat srtmu ont4tptnmfeild mDrmu p;() rxrmf3iadfm elneolt)sexm(o3iydllenmncs sf 2uaur no1ape ifciysfs rlnvo;u4 leoxr3oo1fmD ai ils  2tr(m ou4opee nes tfartm(m ;o1tpto fciysla2umn ont4trenmfcoa1lm r ies t  2umim iydamt micsltfaDtrxmo;t4tpeoioctytls em( o;(0tlenmo to1fa e uei;( seuo(m3iudoptn fvt t)srua(r ot1aptn oetltfaDeln s;u4arxoxfcoatfm raueslt) 2toxm3nodam  liei sf 2rmurp;u0oexnmiciaslm ean pn()arxrio todlmDr ieilt) rxoim3ou1llen iei s)arur(m ;t1tleoifeiltfsDemumo;u0texnif tatlm e u slt)srtoim iydlm   icilsf rtmxm ;u1tetniieiadfs rl(vs u0trxrmf3tytlpte uvilt0setrim3oo4op nmnesl()srtrxmonu0oetniieiyt mDul(vs;t)artnmo3todlaDrau i s0 2umxrpou1lp elivsat arrrxrooo1opxo o3iydlsDrluvp (4trerir3tytom rauesls srum(rpnu1opt  ici sf 2tauronu1altoifeilsls ul(ms ()tlxoxrciytlp   nvolt s2tm(mpoudlpte neil(  2urxmoou1apxoifetas m umu pnu0tlxnmr ootomt lueo (0 2trir nu4olte ncils  2tr(r ;o0tpx iociasfaDra( ont) renxr iatlaDr n i t  rumxopou4ape  fvi sfa2tm(m oo4oeeomo3iasls2eau snt) reoxr3iadoatrlieo;s) rxr(o3nu1optn fci t s2taxmpou4aptomictaslmDulnvp;(4tetomr3iatfa  anes ( s2ur(m oo4apee neiat)sDrru  no4tee  ietysfsDrmu p t0alenxo iodomDrlivslt0s2triopio4omenmnvslt s2umx p;u1teenioetas s2rlnmsnt0trxoif iodlatranes;t) exmim3nu1altemfcsatfa2umxmoot0tpxo i3iat aDuanvs;t0 ltnmocoodoaDe uvo;s)tetmxo3nu4lmeelictls  rrru poo1oexoifeiytls2umumo;t)aexrxo3totom  lu ilt0trtoio ou1lltnlnvtlsfaDtr(m ot1altoifeildfm ulumonu4teermr oy1opt  ivs s trtm(o3oy1lmeeliesatfs2tru oot0apxnmi3iyslmDea(mp;u)trtnxo3iytomDr n sls)t2trio3ny4om emfvi t  rur(mooo4openii3tlsfm2rlums ()artnifcoytfpteanvil(0trtoirpoydap  micsat)aDra(mpnu4texomi3ild m2rmnvs;(4 lenxf3iodoatelueil()sruoxm3iu1ll n nctasfarrr(roou4alx mf3tyd a ulu p;(0 ltoio3iydlmD ln o () ruoxo ny1omtelici (  2umxmo;t0tee iietasfa uanmsnt0tlxomf totfp   n olt0trtmir ny4aptn nct tf rtr(monu4tet ii3iad aDrl(mon(4artomrctodlp eaivs s  2tmxo3ny4ope mneil(f rrru  no1tlxn o3ilt s2el(vpn()tetoxocoatlmDe nvs s setmim3no1amtnmfcil( s2ururp;o1apxomo3iasfs el(vo;u) exnio3iodfp eai ols srumxm iydllt lnvt tfsDtau oot1tpeo iciad s2elums;t)altoif iy1fpD  uvi;()sexrir oo1al eliciat arrau  ;u1olt miciyslm uaumon()aetrio oodfaD aivol(0teto(r3oodal elici (f 2taurpou0olxomoetysfmDeanvonu) exnir3tadfptrlueo;(0 rxmxr ou4omenmictlt) 2tm(rono4apxoiiciyd m2ulu p;()trtomrcty1fmte u olt)s2xmxo3iodlle  ictas)srumxr nt4oeeoif3iatlm em(vont)trerir totlm ran o;( srtoim iu4lmt lfvs s)srtrur ;u4tlxoiicils m rmn p;t)aetnif iadfm r ueo (0s2tm(r3iudap e icslsfaruaxro;u1aex if3ild a emums (4tleomr3oytlatrlu s s0s2urir oydlle lneil(fsrtrx  ot1opxnmfcils m2ranmsnu) lermf oo1faD ai i;s0 2tmxr3nu4al nmfesas) Dtr(m ou0aexniictatlmDrluvo;u4teeoxf3oy1fptr i olt0teurxmpoydame mfvias)aDurump;t4aptomo3iltfm uanmo;t0 lxrir oy1oa rauvols  euoxr3ou1open netls)sDrax ooo1opt if3iltfaDrmnmp u)tlxrio3io1lpDe i slt0 2to(mpou4ll   ieta()sDrru p;u0tpt  o3iydls uauvs ()alxnmrciadfm  luvi s0sexrim3iu1ome lictls a2ua(rpnu1tlxnmfctydls rmuvo u4 rxnmr3ootop elu o;t0 rumxmpou1ap  lncslt)s2rrum nt1alx mfcildlm2rl(vs;t4artriocia1la e uvol( s2uoxm io1ol nmicta(fs2ur(  ;t4tleoifeiltla umuvsnt) etnmocoo1lp e u ilt trur(r3nu1al  licta() rrru p;o1tlt  iciytls ulu o;t4arenir oy1fpDelnvo s)tetmio nu4am   ies t)a2ra(rpot0texo o3tlslm2em(vo t4 rxnmo ia1lpDe nvo;s)s2toio iydap  mfet t)aDua( ooo1alxoio3iad m2rlnmp;u0 eeomfciadlaDrlies t) exmxr3ny1optnmfetls)srrmxrpno0oeenmoctadla eauvs;(0 eermf iadlmDelneo s0trxo(m iu1op nlivs ()sDua(mono4ape if3iatlaDeln p;u4tleomr ootop rai s;s0trxm(m iudllee fvtasf Dumuroou0ole  i3iatfs2el( p;t)texrxr3ty1lmDraueils  2xmxm3ny1optn nvtat)sDurx  oo4tlx  i3iltlaDum(msnt4 ltrifctadfaD luvi t s2xo(m ny1lmenlncil( aDtr(mooo1olenii3iltfs2em(mp t0 eeomr3oy1faD aieo t) 2uoim3oo1lleelneil(  Dtrxm no1apxoiictlsla uln on(0altnmr3to1lmD lu s;() ruoio3oy1om elfes t)aDumxr ;t4alx  fctydfm rluvp t0 etrmf ootlaDeanvo t  2xo(rpio4altemnvtlt sDtr( p;t1aleomiciltfs2rl(von()altoir3to1lptr uvilt  rxrxm3nu1ope  ivsas sDraumpnt4texomfciltfaDulnvs;()arxnircia1oate uvs;t0t2xoiopiy4ll nmfcs ()s2rmu pno0oee  ieildfm ulu s;(0 lxoifcoo1fm rlivo t0 ruoxr3nudlltemicia(f Drmx  no4alxn octld s2uluvo ()altnmrctydlmteln s (0trxoxo nydll nlnvta(f rrmxr ;u1ale mo3ildla rmu p;t4aetoif3iadomt ln i (0teur(m iy4ale lfvsasfsrtmurono4tetomfctyt s umnmp u4 eerxo3oo1fmDe i ols)truoxmpiy4lm nmfcs ( s2tmumo;t1aleoiociltfa rmu pn(4tltnif3io1fp eauei;s truoio3iodopt mfetas  rraxmpoo1optomfcildfs2um(mo ()trtnir3tydla ran s;t0srxoirpnodlme livs (farurxm ot4aeto f3iysfa emumo (4 reoio3iydoptrauvils0sexoirpiodapt  fetls sDrax pnt4olx moeilsfmDelnms t0trtrmocio1om  lneol(0 2tmimpno4ameeliet (  2tmx  ;t4ole  o3iatlaDem(vs;(4 ltoxf3ty1fatrlnvs;s s2tr(r3iy4alenlfct t)aDraxro;t0alxnmoeildfm ea( s t0 lermociodomDeluvo;t) etmim3no1amt lnetat)srta( pou4aet  fetltfs ran p u4texoifcoytop elivils0sexm(opno4omt miet ()s2um( pot0tleomfcias sDrlumo;u0trenifciatoptelnvolt0 ruo(rpou1al emfct tfa2um( pnu1open octldla rm( p;t)arerif tadopDrau s;t)s2toir3oo1lp   ncils s2taum nu0oltn ietydfm2um(ms;u4 lxomf oy1opDelivo s sexm(r3ny4ap n ivi s)srtaum ;u0openioetyslmDrau s;()arxnxrciotoa  aieslt0srtmxo3nudlpee ieta(fsrra( p;t0aeeo oetyd m eln pnu0 eerif iodlmteli i s  eto(mpio1lltnlfei s s2raurp;t4apxoio3iydfa umnvo ()alxniocoy1fm elnvs;s)tetoxmpnydame mfcsas)s2uru pnt1alxomiciyd sDraums;u4tlxrio totlmDraivs ( seuoxrpiodamtemnct s)srrr(r ;o1tet mociyt m2eau s;(0 exnir3oadlpte u o;t s2uoirpnydamenmfcs s)sDta(r ;u0tlxomociydla ul(mo;() rxnxr3oadomD  ivi s  2tmxo3ny1ll  licsasf rraxrp;u1oetoifeiytfs2elump u4 leoir oa1omtraneo t0trtoio nydaleemict ( a2tr( pno4tpeomictlslmDrmu s;t4trxoir3iydlaDraueo;t t2tmiopoudlp  mfcs t  2urxr ot0opx mi3iyt sDrl(vo;u0treniociydfmtrlieol(0truo(m oy1lmt lnciltf rtrum ;u4tlt mo3iadfaDumnmo u) ltnmr3to1oaD anvo t texoimpoo4lmenlfcta(f Dumxro;u4oltnioetyt m2ea(mp;u0 exnxf3oadfp rlivs;s s2xr(m ny4amt mieils) 2umu p;t4olxn oetatfmDulnvs;(0alerif3tytlpt  ieols0s2xmxopiu1al nmivi (faDuaxr ;t0tlxn ictldls2rmnmo;u4 etrxrcoa1fat livi s  etmxopny1ope mnei s)srtru onu4tee  ictytfsDrm(vs u0alenifciy1op eaneols0sexm(m ny1lp  lfctls)a2rr(m ;u0tlx  icilsla elnmsnt0 rtrio iydlp rli s;(0t2toim3iy4al   ieta() Draurpno0texo fctls s2ul(mp;(0 exnmociytla  li ols  2xrimpiu4ap  mfvia(f rta( pot1opto f3iadlaDemu o;u)tetoxf oadomteauei;()texr(opnodalenlfeia( a2ua(rpou4apenmfeias s emu p;() etomoctadoa rluvsl() etm(m3oydlp  mfvil(fsrtrxront4oeeoio3ilsfa2rmump;(0 etnmo oadlmDe n ol( s2umxopnodoleelnei t sDua(mp;t0aeeoiietatla ra(ms;u4 rtnmo3oytfmteauei ( srxo(opoy4al nmncsas)s2tmumono1altoiietadfs2rm( o;(4 lxnmr3oydla e n o (0 etoio oy1lm nlnvtasfaDtr(m ;o4tleoifciyt a2uanmo t4alxomrciadopD aueo;t0 2xmim3io4op nmnviltfarrm(m nu1opxn fciatlm emnmo t4tltoifcoatla e u s t t2urim3oy1am e nvtas aDrau  ou0tee  i3ildls2elumpnt)trtnxfcta1lmDrli o ( setm(rpou4ol elfet tfsrtmumpoo4tlt mictadfm umnvs u)trxoiociotlmDeaues (0 2trio iu1op   fvia(f Drrxrpot1olxnio3iad a2umu p;t4 rxnxo oy1lp   neo ()sexoxrpou1am  mnci s)sDtr(rpno0apxo f3iyt m rluvp u0 leomfcoa1fmt ln o t0srxmim3no4omtnlnvs t)artm(rpnu1tex  ictydfa2elnvs u0aetrmfcta1fmtrlnei t seurimpny4amt mfctas  Dtrxrpou0apx  o3tldfsDea( s;t) rtomfciotfa   ieo s0t2xo(m iy4om e ictl(fa2rmxrooo4aptnio3iydfm2emn s t4 eenmr io1lm r n i ( sruoxo no4lmtnlies (f 2rmxro;t1apxnmfetls s2umu o ()tetnmrctatop  aivo;t) rtoxr nodamt  nvs s srumx  ot0ale io3iyt m ea(monu0tlxnif3tatlpD aneo;t0 rur(m3oo1altemnvs s)s2taxrpot4ale ioetlslaDea( snu0 rerxf3oa1op eanes;t)t2tm(r iu4om nlncslt arur(mpou0tleoiociad sDrln onu4 lenxo tadfmt ln ol()seuo(m3oy4lltemfcil(  2tmxmpot0aetnmoeiydfaDrluvo;t0aleoxf oydlp  livil(0 exrxm no1lptnlics tfaDurxm ;o0texoioeiydla2rmuvs (0trtnmo iatlaD auvs s)srtmxm oo1ole mivsls) Dtmu poo0tltn ociyslaDrl(monu)aeeriocia1oat lues ( trxmir oo4ome  ivsl( s2ta(mo;t0tpeomfciltfs eaumo (4tltrmf3todfpDe ivs;s)srxmim ou1omee nvil(  Duaum ;t1ope  feiytfsDrmnvo u0 lxnxr3to1lateaivolt0s2uoxo oydolenlnviasf Dta(mpot0openio3iltfs ra(msn() lermo3todomtranesl(0s2xrim3iu4am  lncta()s2trxrpnu0alxnifeilsfaDum(vpnt0aeeriocia1fpD lieo;s)t2uo(o no1openlncta()a2tr(r ou0apto fetad s2rlnvp (4alxnxociytfaD  ivol( srxr(r nodlp nlies (fartrx pnt0aexo oeias a umuvo u4 eenxrcio1laDr neslt sexrxm oo1ll elfvi sfsrrmx ont1alxnmoetysla2ranmp t0 leomo iydop ran i;(0sexrxm ou1alenmiei tfaDrmumo;u1oet mi3iadlaDulnvonu4 leoxfcoo1fp ranvo t)texmim3oo1lp nmnct s)s2ta(mo;t4tltn ietadlsDumuvo;() rxnifcoodfm ranvi;t  rxmxrpny1lle lfcsls)s2ururpnu1teenifctyslm2eanms;u0 leoir3tytfmDelueo s)setm(m3iodlmeelnctl(faDtmurpot0texo o3ils sDemuvp t)altrmrctytom  livs;( trtr(m3oy4apenmivil( sDtmurpno0opx ii3iat aDua(vsnt0artnmf3ta1lm r i o t sexm(m3nudop   fctl(faruaurono4olt mf3ild m2eln sn(0 ltrxociotlpD  ivs;(0 2xm(r oydllee ieta(f Draxmp;o1olt  o3tydfa rmn snt0 exrxocia1fm   uvs;t trtmxmpoy4apt mfet t  Dumur nu0oex  fctltfm2raumo;t4tlerxf tadlate neo;t s2xmiopnydll nlfvtltf ruru pno4tpenioeiyd a2rlnvon(4trenxrcio1fate uei s s2urir3ny1lme  nvi tf 2urxr ;t0altnif3iytlaDulnvpnu)artnmr3tytfmDrai ils)seuo(r3nudlle mncs s)srum(  no0olxniictytfa2eluvo (0 etnio3totfmtraies;(0 exoxopiy4lm emnct tfa2um(rp;u0tpx if3iytlsDumn p u4teeomf ta1oatean s s trumirpiy1optn fetltfs2trxro;t0tlxn f3ild mDrau p () rtnxo oydfmDr i s s s2xo(mpio1ap nlneilsfsDtaurpnu4aeenmfetlsfa ra( o ()tltoxo3oadom  ai i;s)s2xmir ny1apt mnesa( s2tau  nt0apxomocilsfa2ulnmsnu)tltnxrcio1om e uvil( truriopiudomtnmivslt aDrru ont0optnmoctat aDemu o;u)tleoirciodop rluvol(0trxoio3oy4lm  mfviat aDuau  ;o0optnif3iydfmDumnvs u) rtrmo3oadlat  nes;s)t2xrio oy4lme  nvia(f Dra( ooo4apx io3tytfs2eauvs;(4texnxfcoatlm   nvo t0 rtoir3io4alen ietl(fa2ta(r ;t0texomfeildfs2ra( s;t)trxrxocoa1latrlu i s)srum(opiy4lptelivs ()a2uaur nt0olen o3tltfaDeluvs;t) rxnmo3todfmt  neilt) rumir ny1ope lnctl() rrru poo4aetomoeilsla rau p ()trtoir oadoatr i o s0 exoxo3io4amee fvsa( aDumxmpou4ape moeiat m ul( o;t4 rtnxf3iytfmteau ols)srtrxrpoydlmee neia(  Dtmumpnu1aptoiicias a2eanvo t)arxrir oy1om  auvolt0s2uo(r3oydllee ies tfsDrr( pou0olxnmiciat mDuluvp u4teeomf3iytoat  i ol()srto(o nu1llt mfvs t  2rm(rpou0oex  i3iat s rmu onu)altoio3ty1lp rauvs;(  rumir3io4op   neils)s2tmu ono4tpto oeiat mDrau p (0texoiocoodfptr ies t trxmimpiy1ap   ivsa(  Dur(m nt1olx mieiysla umnvpnu4 rxnxo3iadfmt  nvi ()t2trxo3oy4lp nmfetlsfs2ua(  oo4alx  feild a2emnvpnt0tltrif3ta1fpteaivs;() 2xr(r3oy1aptnmivtltfs2rr(ro;u4tetomicildlsDrlu p;(4tlxnmr oadla ranvo;s  2xmxr3io4op e fvsas  Drr(r ;t1teeomfciytfa2ea(mo () eerirciadfmDrli s;t srtmimpiu1llte fei (  2tmx p;o4aeeo o3iasfmDeau s;u4tetnxfcoatlptrauvsls0 2xmim io4oleemnet (fa2taur nt4tee mfcild sDul( s;u4 lxnif3oo1fmte u o s0texr(mpny4ale lnctls srtr( pno1optoiieiyslm2eau s u4 rxrio3oa1lm  lu i;(0teur(o ou1ome lfesat s2rm(mont4tleoif3ilsls2ra(vs t)texomfciydlpD aneol(0 eto(o3ou1lle  netlsfsDtr(mo;u0openmiciltfa2ulumo t)altoxr3oo1oa eauvsl()trtmxm iydlltelictlt a2urx  ou1aeeo ociatlsDum(mpnu)trtrxrcta1laDeaivolt  etr(m nu1ol  lfei t s2um( o;u4alxo f3tyd mDua( p;t0altoiociotfmDe uvs t0srurxo3oo1oltelfes s  Dra(r oo0oeeoioeild m2ul(vp t4 etoxr ta1late i ils s2uo(mpoy1opeemfvs t)sDtax  nu0oexn f3iytfm2em(monu4 lerxf tytoaDeliesls trumxmpno1open nvtlsfsDumx  ;t0olen fetasfaDra(vp;t)artoir iotfpt anvo;s)texr(m iy1ope mics ()sDtau pnt1alxn ietas s eaumpnu)trermrcoytfa  au s;(0 exr(opoydop n iet ( aDra(m nu4ole  oeildlmDua(monu)texriocoodoa e n ilt) 2urimpiu1omeelivt t aDtmumooo1tee ifetadls uauvs;(0arenxo3totoa   nes;t)seum(m3nu1al emfvt sfsrrmuroot1tpx ifciadls2emnms;u)tetoxocoadomt lues s t2urxm nu1ol  mies ( sDurx  ou1aptnmi3iysfa rm(ms t4 renmf3tytfat li ols)trxr(r3iydoltelnvs (fa2rm(m oo1apxomfctls s2eanvpnu4aetnif3iotlmDrlnei;s) rurxr no4am nlnctat aDta(m no1opt mieiydlm ua(vs u4 leoif iy1fa e i s;( srur(o3iy4omtnlfci t aDta(  oo4tpxn i3iysfm2rmnvs;() exrxocoa1fmte i s;s)t2tmim3iodolt mfvsl()a2um(mono0tlxoiieiasfsDuanms;t4arerxfctydop rauvo;t0 eur(o io1amtnlfciat) 2raumoot0optniociltlaDua(monu0alxrxocoy1fm rauvs;(0t2xr(m nodalt  fctl(  2rax poo0aexomociytfm2umnvs t)alxrxrctotfa r u s;s) 2xrxr3oy4optnlnctls)aDumuro;o1alxo ieiaslmDum(msnt0 rtrifcoatfmDeli o ()trxr(o3oodlltelicsa(fsrumumo;o1aleomfeiadlm eauvsnt0tlxrmr oo1faDr uvi;t  rxmio oudoptnmicils)arumxmpno4oleo f3iasla2uaump;u0trxnir oodop elivo t) 2xo(opou4aptn ics tfa2ra(  ;t4apx ifeildfm2rm(vp u4alxrmo3todfaDean ols0texmxrpoydal   netlsfsDurumo;u1teenmictaslm uan on(4tlxrmrciotla  li i (  2xoxopny1alt lfctl(f Dtrx p;u1olxo fctld m2elu s t)arenxo io1fate ivol()teuoxm no4om e ivtltfsDurxmooo0tlxnioeiatfa2ra(vp t)aleomo3oatlm  ln ol(  rtr(o3iydop emiet t) 2raumpot0aexn octatla ua(mpnu4tetnxf3ootoateln i ()tetrxopiy4om e iciatf 2urum no1oltn ictldfsDean snt0 lxnir3oatlmDeai ilt) rtoir3no4ol n fvtas)srrmur ou4aexomfetatls2rl(mpn()tltnmoctytomD  i olt0sruo(r3ou4om   ietas)s2rmxrono0tpt mociytfm ul(vo;u4 lxrif oa1latelu s;(0 eto(r ou4oltn ncsls)aDtaxmpno4opt mo3iys aDrlums u)tlermf3ia1lm r ivi;t  exr(m no4olt  nvt s) Dtax  ou4tltnifctas a2ranmo t) reoirctatfpD  nes;t0t2ur(m3oo4lp  mfvils srrm( ooo4altomietatfm rau snu4trtomf to1opD ai s;s  eurio iy4altn fvt (faDrmx o;t0opt miciyslsDua( p;(4aeenxrctadfpt aivs;(0trtm(r3oo4apen nvil(  rrm( o;t0alxo i3iat sDrln snu)teeomr oydop elneo t) rxoirpiu1lp n ieil(fs2rmumpno1apx  feiltlm2ul(mp t4arenmfcoydlpt livs t0 exrxr3io1amtnlncs (f Dtaxrp;t0oeeomo3ias sDulump u4alxnio iy1omtranes s0trurxopoo1llenmfeil() 2rauronu0tetnifciytlmDeanms;u0 rxoio todoptr uvi s)setm(m3nydllee ivs s) Dtr(mpoo0tpx ii3ilsfa2rluvo;t0 etrxr tytlmt ln s s0 rxo(o oo1amt mivias  Drm(  ;u1olxnmfeiltfa2ea(vp t4trxrmr3iadfmDe nvs;(0srum(m ny1omt  netl(fa2uaum ;u0tetn ieiltla2em(msn(4tlxnio io1laD  i ils) rurxo iy4ap   nvt ( sDtrxrpot4tlenmfetasla eaump (0alenio3oo1om r ieo (0tetriopiu1aleelictls)srrm(rpno0olen oeilt s eau s;t0tetoxf oytfpD  nvs (0sexoxmpnydllee nvil(  2ta(ro;u1tlx mieilsfsDrm( snu0trtoxrcia1lpD au i (  exoirpoo4aptemivi s  rumxrpou1opx ioctydfs2emumpn(0aetnio iatlpteaueolt)t2tmir iudamt mivi () 2urxm ;o0oeeo o3ilt a2ea( o ()aexoxfcoadopDran ilt0 etr(r3oodlmt mneslt)sDumu oou1ole  f3iytfm umnms u0 rtnio iy1la e i i;()trxrir3oudll nlictlt aDumx  ;t4tex miciatfm2rm(msn(4 etrmo oatfm rlieils)s2to(r3nodlp elicsl( srrmumo;u0tlen f3tatfs elump;t0aeermociodoaDeauvs;( teuoimpoy4ol  mfei tf rra(r ;o1tpt ifctlsfsDeau p u0trxrir3tytfpte u ilt0t2toxrpny1amenlfct tfartr(  ou1opxn i3ilsfa ranvpnu4 lxoif ootoate u o;t0 rumim no4am   fviatfs2tmxm nu4aptn oeildlmDumnmp;t)aleomo tatfatranvs t) eumxrpoodllenlfetltfa2rm(rpou4opx mietlsfm2rl(vsnu0 eenmrciytlat  nvi;s s2urxm3ou4lmt  ietls) Drrx onu4teenmo3tyd s ua(mon(0tetrir3ootlmDraieil()srxoxr3nodoptnlfcsl(fa2umx pot4alx  f3ils m2rmnmonu0altoxf3ta1lmDeln o;() euoim iodope lfeiltfs2ta(rpou0tetnmfcilsla elnmonu)tetrir3iodfa ranesl( srtm(o3nodoptnlies (farrau ono0tle  f3tad sDea(vp t0 rtoxo iotfmt aueo s srxm(r3oo1open nvilt arta(mp;o0tltomf3ilsls rm(vo t0trenxrcta1lp   i ols)texo(o3oo1ll e fesltf 2tm(  nu4oltn fetadfaDrmnvsn()artrir ia1lpte n i;s) exmim iydllt lfvta(f Dumum ;t0olenmi3tlt a2ranvont)alxrmrcoadoaDranvi s)t2um(opny1lme mfcilt)s2tmumpno0aee ioetysfs emumpnu) etnir iydoaDr u o;(0srtoxo3nydomtelnesas artaxro;t4tpeo o3iydfs eln p u4teenmf todopt au s t0srto(mpoudome lfvtlsfs2taxroot0oleo ictlslaDuln onu0 eeoxfcty1lmD anvs s0 exr(r io1opt  fvsat a2ur( ono0tpe moetlt s um(msnu) rtrmociytopteln ils0srtm(r oy1altelnetasf 2uru pno4ope io3ias m2um(mp u4tltrmrctatfmte ivi (0srxr(r3iu1am n netat) 2trumpnu1tptomf3iatfmDrln pn() ltomo iadopDeli o s seuo(o oo4lltnlfvt sf Durxr nu1aeen fciadfa uanmo;t0 rtnircootopt aivs s0trumir oodam  lneilt  2urumoot0opt  ieiys sDuaums ()trtrmrciydopD  u slt)s2urxo3nu4apenmfcs s)arrmumo;t1alxnifetatlmDuln p t4arxrmr tytfmD  uvo;()tetr(r nu1am nmivt tf Dumxrpou0opto ictadls2rau p t0 rtnxo3oy1lp   ieils)setrirpoydolee nvs ( s2ur(r ;t0tpt if3tytfs rmnms;(4altoxrciytop e i s;(0 rto(o3nydame mivil()sDtr(mooo0aexnifciltfaDemuvont0tetnmr3oatfpDeanvilt)teumirpoy1am   fei s  Drr(rp;u4tee mi3ilsls2uan onu)aexoxo3iytla  auvo;(0 exm(mpoo1ap  mnciat)sDtrxr oo1teeomfeiys m rlnmo;u) ltnio3oatla   u o;t) 2to(opnydomtn nvt ( arta(  ;u1tpt ifcild a ranmo;t)aeerir3io1lp  ln o () rto(m3iy4oltemici s) Dta(mont4olxo ictasls eau pn(4 lxoxfctadlm  ln i t) rur(mpiydapee fcs s arraxroot1tpxomicildfs2rmuvpnt0tlxriocoydfmD aies s truo(o3iy4al e ici ( arta(monu1tpx ifctydfm uau p t)trtrmf ootlm e ivi t s2tr(mpoodlm e fvs s a2umxmooo4altoifciadlsDrlnvp t4altnif oatfmD  ies (0t2to(opoo4aptnlneiat  rtr( p;u1opxn fcias m uluvonu0 eenmrciadlpDe u o t teto(rpou4apt  nvt t)srtaxroot0ole miciadfm2eluvsn(4 reomo3iadfaD anvs t) exrxm iy1ale  nvt s a2tau ooo1oltniieiytlm ua(vont)arxoxf3totlm eau i t0 ruoxmpiy4omen fvsls s2ta( o;o1teenif3iatfm2ul(mp t0aexnirciadfa  ai ilt) rxmxr oodap  livilt aDraur nt0oex moeiasfaDemnvp t) lxomocto1oa ranes s0tetoir3iudamt mfesls sDrrxm ;o4optn i3tydfsDrmnvs ()texrxo3oadoaDrlueil(  2xoim oo1lp nlivs t  2umxmp;o1ale mieiad s2uau o;t4aeermf3io1omtr n o t) rur(m3oodlpenmiesatf rtru p;t1teeomi3iaslsDrluvsn(0tetnirctytopD auvi;t0t2toxo oy1ap n icia()sDuaur nt1opxoiiciat a2umn p t0artrxfciotfa  luvo ( tetrir3oydoptelieia()a2tr(rpnt1tee  feiatls umuvp (0tleomrcoa1fmtraneil() exo(r no1omtemncsl(fa2um(m ou4tet  octyd aDemu p;t4 lxoifciy1fatr i i ( srtrxo3oodalte ictat) Dtru o;t0tlxoii3iltfa uau p (0arxoxo totom ean o;t0 exoxrpoy4ap elfvta()sDuru p;u4aetomfeiyslaDuln snu4arerxr3oodfp rlueslt  2tmir3iy4ole  nvtat  Dtrumpou4alxn ociytla2rau ont0aetoif oo1fateaues (0teuriopoudaleelnvta( a2tmu  ;u0tetn ietld m em( pnu)tlermf3oydomtrli o ( srumxr3oy1ole mnvtlsf rta( o;o1tlt mi3iltfa2rlnvo;()tlxrmf3tadlpD ai o s  rtoir3oy4aptn fes t)srrru pot4oeeomf3iysfs uauvont0trxoir3iodopDelnvs;(0 2toirpnodll emfeta(f 2tmum no4tpenmietad m2eaump u)alxnxo todfm rauvi ( trumim oy4lmeemictls) Drmu pnu1ole if3ildfs2el(mpn()aetrmr iadlpDeaieil() 2xoxr iy1olee fes (  Dtmump;o0texnio3ildla2rl( o;(4alerxr3oa1lmDrlnvo s0 ruoimpnydoltelivia( srumx  ;u0oltnmietadla elnms;u0aetomr ootfp  an olt) 2urim3oo4olee fct t arrm(ro;u4aee  ocilsfm ulnvo;u4altrmfcoy1faDeauei;(0 2xoxm3oo1oltn nesl(fsrra( o;o0ope mietas m rlnms u4 reoxrcoydlmD  ieslt0trtrirpoodlltnmivsl() rtmuro;o4tpto o3tysfm2umnvp;(4artnmf oatlaDr neils  rxmio iydame miesl()sDuaumpot1oeeo i3tydla2ranmp t0 renxrctytopteau sl( srtmxm3nu1al emicsasf 2rmxrpno4aeto fciysfsDemnvs;u4aeeomo oy1lmt ln s (0srtm(mpiudlp emnci t)sDrrumooo1tlto fctyt m2rmuvo;u0areomr3oatomteaueils0texrxr iu4omtnmnet sf rrmump;o0tetnifciltlmDum(vont0areriocty1fmteaueo ()sexm(o iudlmtnmiciat  2uaurono4tlxn o3ilt sDel( ont0alxnmr3ootomD aues s0trto(o oo4ll n fct t)arra(rpno1aeenifciys mDeau o;t4aeeoirciodfpD  nvo t0sexrxmpnu1ll  lnci (fsrururpot0tpxoiiciadfm2um(vo t4 rtrmf oodom  lnvols0s2urxopiodop e ict s)a2rmur nu1aet iietasls umu p u)tetnircoatfaD li ol(  etoxr nydal n ieslt s2tr(r ot4tpt  o3tydla ranvo;u0texoxo oodopt  i s (0trto(r ny1am nlfeiatf 2uaur nt1tpto oetlsla ra( s;(4aetoifcoodlat  nvils srtrim iudolt livi (faDta(monu0ale  fetltfsDuaumo;u0 lxrmf totfate i olt0 rumxm nodol  mfesls  Dtmx ont1ope moctatfa ua(vp u)aexoir tatfmtr n s s0 2tmimpny1apeelfcsl(  Drax pnt1oee mociasla emnvsnu4arermfctytfmtelivil(0sexrir nu1ale livtl(f rrrxrp;u0apt iocild sDuan pnu4teeoxr3iotfa rlues;s0s2xoimpoo1llte fet tfaDua( oou1aee  ociysfmDrauvo;u0arxrmocta1om e ies s0teurim3ny1am  lncil()aDuax o;t0aptoiieiytls eaums u0 etrif to1faDe nei (0srurxr3nudom emneta(fsrraxmo;t1oetnifetytfmDumuvo;(4tlxnxo oytlp  aivol( t2xr(o3io1om emncs s s2rru poo1opt mo3iyt s ulnvp;()tlenir3iodopteaneo;t0t2urxm3ou4ol  lfeiat s2umxr nu4tlx iictys m2rmumo (4 rtrio oytlpD liesl( srur(rpiu1ll elietl()aDtrxm no0alt ifcilsfa elu pnu4tlenmrciadfaD aneils s2xmir oo1ope mnvt () Drm(r nt0oeenmieiytla raump;t0trtnmf oodfptrluei s0t2tmim nudom elics sf 2raxmpot1olt mf3tyt m rlums;u0 rtrifctodfmD auesls)s2xmio3nu1op  lfesa(fsDurumonu0tlt  i3ilsfa ea( o;u4 lermrcta1om   uvs;s0s2tr(m3oodaltelncsas)sDraumpnu4tet  oeildls2eln p;u4tetrmo3to1oa elnei;s0sruoxopio4amtn fetl(fs2raump;t4ope mfctys mDemnmp;()alxrmf3iadoptr uvo s truoio ou1apt livtlt)sruau  ;t1tpx mi3tld a el(mp t) etnmr3tadfpteluvolt0srtm(o nydll nlnctl(f Draxrp;t4oexoii3ildfs2uan o;(0tlenir iadlmtrauvslt) 2to(mpoy1olenmnvta( artaxr oo1optomfciysfm ua( ont0 eeoifciotfaDe i o;t  2tr(rpoodal nlneils s2taxm ;u4oltn ieils s umuvo;t)aeermr3oydfmDeluvsl(  exoiopio1lp n fvta(fsDrrum ot0tptn f3ild a elums;()tetnmf3ta1fa r nvsls) 2umxr3iy1ope micsl()sDurxmo;o1tetnmoetld aDra( o u4trtnmo iytfm ran olt0 rto(r3oy1olee fviltfaDraxmooo0teeoioctltfmDemuvp;u0alxrxr ta1fp  lneols0srum(opiu4amtn ivtatfaDtmxrpoo4opeo o3ild s eaumo;(0 etoif tadop ranvil(  euoxm oo4ll elnvt s sDuaump;o0aex mo3tltlaDem( snt0 eeriociatlm rluvi;s0 eto(r3ny4ome  ncslt) 2urx  no1aetomfetysfs2umuvp (0trenxocoy1op   uvi (0sexr(m oodal n ncsas arra(  ;t0opxnio3tadfs elnmo;u)alxrxfctotlatran s t) exrim3nudamen ics tf rtrur ;o1tpenmf3iydfs2rln snt)trtrxf iodlp   nvslt tetr(o nydol nlncilsf Duau pnu4opxoiociasla eanmo ()aexrif3oa1oa  lu ol()trxo(o oy1lltnmnvs tfsDurx p;o0tlx  o3iysfa um(vo t)tleomr iodoaD aivo t)s2umxr nydome liciltfsrraumpot0altoioctlsls ran o t)tltomf oy1lmDeai ils trtr(r3iudap  livta( sDtmuro;o4altomo3tldlm2ua( o;() etoio tydoptr ivol(  2toxopoo4lpte nvils srtau oou1tlx ifciytlm uauvs;(0 rxnir3oatlatelivo s)sexmio iy4lltnmieils arraurooo0opxomi3ildla uan pnu0aeerir3iydlaDe i sls0t2uoxo no4amt lneslt)sruaxm ;t4tleomociydfs rm(mont0 ltomocta1fp elies t s2xoxrpno4amtnmneil(f Dtruro;u0aex  fciydfm ean ont4trxnxf oatopDrlues;s0s2trxo oo4ape lici t) 2rmum nt0tle ioeildla rlnvs u)teeoxo oytop r uei (0trtm(r3ou1ol  lnvsa( sDrrx pnt1oltn ietydlmDuln s;t4tlermf3tatlp e uesls  etrxm3nydameemfvi t) 2rmur nt0tpe moctltlmDrl(msnt)trxrxfctydlm  luvols)srtrxm oodlme mfcsat a2rmumpno1opxo i3iyd s ul( ont0 lxrio3to1lateau olt0 euoimpio4optn fcs sf 2tr(r no0tpt  ociys m umnvsnt0 lxomf ootomtr u il(0s2xr(mpoodom nmictlt artmx ono0olen i3tatlsDumn onu)trtoxr totoatr u slt) euo(mpnydlmtemnctlt aDraxmpot0opt iietytfmDuau o;(4tltoxo totfatrluvi;t)teur(mpoodapee fes ( s2tmurpno1openmoetat s rm(vo;()trtomfcoo1fpDrln o s)texmxo3ny4apte ictlt a2rau o;o4tlxnifcildfs2eaums;t)tltrxrcty1fa eaivo;( trxoimpiy4ap   fcslt a2ua(  ;o4aex mfeiltfm2rm( onu4tetomf3tydlmte nvo;t sruoxo oy1lm n fcslt  rumxmooo1ale miciytlm2umu o;(4texnmrctotfa rln sl(0trtrxrpiudlpenlnesl( aDtrx  nt0aexnio3iyt m2rl(mp;u) etnxf oytfa   u o;t)texrir ny1om nlfcia() ruaump;u1tetn ietyd m eaumsnt) rtrir3tadlat li slt  2xo(o iy1lp  lnvs (fsDur(  ;t4altomoetat m2uanmp;u) lxrxo3totlm   n o s sruoio3ny4lm   fvtlsfaDtaxrono0ope ii3tytfm2emuvsnt0trxoxr3iodlpDe uei s) 2xrxo3ny4lme  ieiatf rtaxm ;o4olxnmfetytla rmn snt0 exrmfctodlmte uvolt) ruoio no1al nmfvi s a2urxrp;t0alt mfeiydfaDranvp (0aleomr tadom  au sl(0t2xrxm3nudol nmfeil()s2rmx  ;o0alxnmieiys a ranmon(0altoifctodlpD lneo;t0 eum(r3iodlltn fvsas)srra(ronu0tetoifcilsfsDranmo t) lxoxf ty1oatr neslt0tetriopio1om n fvs s) rumur ou0alxo i3tydfm em(vp;u0altoxo3ia1lmt luvi;s srxo(mpnudlp n iet t)s2rax ont0ole mociltfaDuanvo () exrioctotoaDrlnei;()srtoxr iydlltelfvtltf Duru pnu4tle iieild s2eaump;u)aetnxf iadlptr nvol() rtoxopnodape  neia(fsDtrxroot1tpxn fciat a2raumo;u4 ltomo oadlat  i s;(0trxmim3iydamte fci ()artr(rp;u0apeoiociydfm2uau o (4artoifcia1fmte ivi s  euoxr3oodalte fvtas) 2umxmp;u0tpe  fciatls2rluvp u)alxnxf3tatlaDelnvolt0trtm(o3ou4omt lnvt s  Dumxm nt1tlxoii3ildfa elnvont0alxoxr3oydoptraues ()t2tmxopoudap n ict sfaDtmum ot1tetnmfeiyd s2rm(vsn(4alxoioctytomte ivi t t2urxm3nu4lpee fvt t) Dua(r nu0aptoii3iyslm emu s u4teeoxr tatlmDrau i;t s2uo(m3no1alee net s)s2uax pnu0optomocilsfaDrlnvo u4 eeomrctydlm rlu i;()seuoxopou4ale lietat) rta( p;t0ope mf3tld s elu s u4artrxfcoadom  liei s)s2ur(r iydlm emneiatfaDtax oou1tpeniictldlm2rmn ont4trxoxf oa1lmt  uvil() 2xrio iy4lptemieil()sDua(m ;u1olenmo3tlslm el( s u0tlxomr ia1lm elueo;t) 2toxo nu1ome licta()artr(m nt1oltoioeiys s ra(vs;u4aeermr3totomD au sls tetrxo3io4omee ncil()s2umumpno4teeo ociasls2emnvp (4artomo oy1lateli i;s0seumirpno4aptn iesas  Dtrxmpno1tptn i3tls aDulu pnu0texnmo oatlm eln i;s) exoxm3nydope mivt sf Duax  nu0apxnmi3iatfa2uan ont4texnif3oadoa rlnvsls0seurim3nu1llt mivias) rtmu ont1teto o3iytls rlnmo u)tltomrcty1oat livs s s2toxr iydamt licta()arumumoou4ale ii3iat a rlu pnt0tetomrcoytfa  auvolt trtmim3ny4olen nvta(fs2rrumo;t1apx  oetys a2um(vo u0 rtoxrcoytlmtelieslt)texoxo iy4llenlneiltf Dtaumpoo1tlt moctyt m eln p;(4altnio iytomDr uvslt srxrxopiy1lpenmivta(  rraxr nu1oleomoeiadfsDrlumo t4teenio iydlaD li i s) rxr(opio4lme  ncs ()a2ta(root0olxoiocildfa ulnms;(0texrxo iy1fp eauvsls)setoxm3io1om   icils)s2urxroou4texn oetysfs elnvp u) rerioctadfaDrluvolt teurir3ny1ol  lnctlsfsrtr( pnu4oex moctyd m em(ms t4areomo3totomDe ivsl(0texo(m iodope mivt tfs2rm(ront4tlxnioctydlm rlu o;u4tlxnxf3iadfaDr ies (  eum(r3iydll nmnvsat sDtmx onu0optnmociadlaDranvp t)alenxf iydfm  anes;()trumxm3nu4om e nvi ( srtm(  ou4oltn fciad aDra(vo u) ltomr ta1omDeaneilt  2to(opiu1ole lnvta(f 2ua(m ot4tlt  ieils sDrmumon()aeeoir ia1la rlu sl(0t2xrio oudamt mneta( s2tr(rpnu0tpxomo3iydlsDranvo;(4 lxrircty1la eaies;()sexoim iudoltnmicia(f Drmxrp;u0aexoifciyd aDua(vs;u) rtrmf3to1fpteaivo;s trxrimpoudlmee fciat) Duau poo0tlxn ictydlm2ua(vsnu) exrmf3oadfaD  ueol()t2xrxopoydlmee neil(faDtmur ;u0alx  o3tas s2rmnmo;u4trxnio3tadla raiei;( setr(r oo4lltnmnciltfa2urur ;t4alxo o3taslm uln s t0texoirctotlp  li s s)s2um(r3oy1ll  lfvs tfartm(r ;u4oex ifetytlsDelnvonu0aetrxo ta1lpD lu i;s0trtrxrpiu1lp   ict t srta(mpnu0aee mfciyslmDrmuvp u4teermr ta1fm   ivslt0 2toio3no4amtnmfvilt)aDtm(rpnu0openioeiasla elu s;t0aeermocio1omDe u i;()tetmir no4ll emnviltfaDurxm ;u1aet mfeiad mDulnmp () reomr iy1laD lnvil()t2tmxmpiydolenmnetltf Draumooo4teen ieiltfs emn pn(0arenxr tadfaDr n o;()truoir3iodlpte nvt tfsDumx pnu1tpxnmiciys m uanmo;t)altnir3ta1faDelneo;( tetrxmpoy4ll  mnctat)sDtmu  ou4ale  o3iadfa emn onu0altoir totfmDrlnesl(0texo(r3nodapee fvs sf rraum no1tpeo icilsfsDumumsnu0 lxoxf3iatopDr ivs s0 2uoxm3iudoltn fvs t) Dua(rooo4openmietytfa el(mp;() lxoxr3tadlpDe u i ( srxmxo iydopt  fesa(fa2ta(root0aetnmo3iat sDem(vp;()tlenmo3oodlmDr neils trtoir3io4alte nei ()aDraurono1oet iociyt s2eauvs;(4 lxomocoatlpt  ivil( sexmim3io1ame  neslt srtr(rpou1alxo i3ilsls ul(mpnt0aetomf3totoaD  n o;(0t2xr(r3oodopte nctlsfaDurxmpou4tlt mf3iysfs2ulu s u) rtnmfcta1lpteaieo;( srurim iodoltemnvil( s2urxr nt1tlxn fctydfsDul(ms;t0 eeniocoydfp rai o s)sexoxr3nudameemfvtas  2rmur ;u1aexo feiadfsDuanvpnt) eeomr3tytfatr uvo;s0 eur(opou1lm  lies t) 2urxmont1opxomfcias m2rmu pnt4aexrxocoadomDraivs;(  etoimpiu4apenlnvta() 2urxro;o4olxn i3ils a rl( s t0 lenxoctodoa raivs;(0 2xoiopio4apt miei t  ruru poo1optomietydfs ranms u)tlerxrctotfa eanei;s0 eum(mpiy1openmnvil() rtrurpnu0oltnifeiysfsDuau p;() lxrir3ta1op rlieilt0 exmxm3nodlmenliesasf Dtm(monu0opxnmoeiysls2ran s;u0aetnxo3oytfa   n o (0s2to(r3iu4oltn icil() rrrur ot0opxoifeiatfmDulnvp t4 lxoif3iy1op e uvi t0s2xrxr iudaptnmictls)s2rr(rpot0oetomo3tldla2el(ms u0 exnxo to1oaDeluei;s0seumxopoudol  lnesas arrm( p;t1apxoii3tatfa uanmo;t4tlxrmf3ootfatran o;t  rxrxm oy4openmicsasf 2tmxmonu4aexoio3iatfm ulumpnu4trxnmo3ootla rau ilt0 exoxmpny4om emnvtas) rrmx p;t0tetnmieiadlm2em( s t) eeoxo3oodlpDeauvolt0s2xrxopou1lmeelfviat) 2uaur ;o1texomieilt aDemump ()texrmo3iotlptean i s  eurxo3ou1lmt  fcsas  2ta(moot4tpeo i3tltlaDemump;(4trtoif tatopDean s;s s2xmxmpoo4ame  icsa( a2rrxmoot4optn i3ild s um(vsnu4 eeomo ootfatr iesls) 2xoxr oy1llee fvt (  2taxronu4tltnifeilt a2rl(vs u4 ltomr3oy1om e ueils0 rxmir oo1amt lnvtl( srtau poo4aex ifetadlmDrm(mo u)aeenmf to1la  ai s;t texo(mpiu4alenlncs t)srraurpno1oetoifeils m2emnmo;(0 exnmr iadlaD lu o;s srxmxrpiydll nmneias)artrumonu1tleo fctlsfs2eauvpnt)treomocto1om eau i;(0texr(m3oo1omt lncilt)srur(  oo1teeoioctydfa rlump;u) exrxf ootfpDraneils)seurxmpny1alt mfet s a2urx  ot1olxn i3tlsfa uluvs ()trxriociadlmD  uvils texoio3ny1ape mneiatfa2taxr ;u4tlen i3ilt sDeanmo;u4 rxrxrcoa1lpD luvsls0 rxmxo3iu4ap e nctat)artrx  ;u0aeeomfctlsfm2el( p t)alxrmr3oadfpD lueol(0teuo(m3iy4ll emieiasfsDuaxmo;u0aexn i3tad mDemu on(4texoio oytoa  livilt)setm(o oy4amt micta( sDrmumpoo4tlenmiciatla2rau s;u) rxoxr3iadoaD aivi t0seuo(m3ny1lltnmfviltfsDtmx  no0tlenif3iat m2umuvsnu) ltnmf3ty1lpDeln i;(0s2tr(opiu4op  mfeiat  Dtau  no1apenmo3tys aDean p (4aexrxf3tytfmte u o s)texoxo3no4op emfcils aruaum ot0tlen ieild s2eluvsnt0 rxnio3to1fatraivi (0srurim3no4opt  fcia()aDtr(mpnt4oeto ieiys m rmnvp u0tleoxr3oatlp eaivi;t) 2umio3ny1opte nvils arurumoot4tpt ii3tatlsDulnvp;u) exoif3iotomtelivols)setrxr nu4lpen ivi s sDua(rpou4tpx iietls mDemu s;u)trxnio3todfaD ln ol(0teto(r3iodomenlfetl( s2raurooo1apt io3iysfa emumont0tltnxr3iodopD luesl(0srurxo nodlleelnviat)aDumuroot4tlx mi3iydls2ea( sn(0alerif tydfa   nei t)trtm(r nydlp   fvs ( s2ta(  ;t4apt  i3ilsfs2rl( pn(4 ltrmf3tydlm raueo;s) rxm(r3nu1lm  lfvs ( a2rm(  ;o0alxnmociaslm ulu p;t)tetomf iodlat aieolt)s2xmxo3iy1lle  feiat a2umxmo;o0tlenifctlsla2ul(mp t4tleoxo tatfa   nvols  2xr(o3no4lmtnliet ()arrmur ou0tpenif3tasfs ea( s t0 rtnir3ootlp elneilt0texoxo oo4lltnmiciatfs2rrur ;o4tlto feiatfm2umumsn(0tltnmf3iydfptr ivsls  ruoxm3nudal   ietls s2ur(rpoo4olxnmi3tldfs2rmuvs;() rtomfciy1fatr u o;s0srurirpno1olte iet sfaruax pnt0tetn fciyd mDea(mo t)aetnmfciytfmteluvi ()truriopou1om  mfesas)s2rm(  ;t4aex  oeiydlmDrm( on() renxociodoa   u s s)trxo(r oo1amee ivilsfa2ururo;u0alxoiietysfs rau p;(4alxomociydoat  u o;s) 2xrxr oy4omtelivslsfsrua(m ;o0teeoioeiydlaDumn o ()tlenmf3io1fatraieo;t)t2umir3nydopt mfcsa(  2umu p;t4ope ifeilsfs ulump (4aetoircoy1lm rlnes;t) rurxm iudap e iet ()sDtr(mp;t0oltnii3ilt a2ulu o;t0tlxnmrciatoat  uvi (0 rtrir3iy4lm  mfcsls  2taum ;o4olxnifetatfa emn p;t4 rxrir3todfpte neo s s2toio iu1amee fcta(fsrurxm ;o4olt ii3ildla2rlu s ()aeeoxo3iy1lat lues ( tetr(rpio1om e iciasf Dta(mp;t4teeo feiys mDea(mp;t) rtomrcty1om ean i t) exmxm3no4ome mfei s)aDta( pou4olxomoetatfa umnms;()artomr3ootfm rlneils truo(rpiy4ame mfcs tf 2rmxrono0tptn f3tlsfa ul( onu) lxnifcoa1opDr ivo;s0tetmxo3iy1lle lfesltfsrum(r nt0aexomo3tlt a2uau s (0tlxnio3oydopDrai s;t t2trir3ou1ap nmncsa( sDur(m ou1opeoio3tat mDrl( o;u0artrmo oatfaDraueo (0 2urxmpnodlm e feia(fsDuaur no0oetn ocias aDem(mo u4artrif iatfpDrlnvi;s) rurxr nudaptnlivsls sruaur nu0alenmf3iatlmDumn p;t4tetnircootlatrlivil() rurxm iu1op e fetas) rtax  nu4tptnmoeiat mDranvpn(0 ltrxo3io1opt  n o (0teuoxr oydopee neta() rtmx pou0olxnifciydfmDelu snt0tlxoio ootlatr u o s  2tr(m3iudame miesl( artmxront4tpen o3tatfm2uan o u)arermfctytlaD lues (  rxo(m3oydam nmnctasfaDtauront4aexnifcilsfs2uau s t4 ltnmo tydfm r nesls trxrxm3oo4lpee ncsltfartmx o;t4apxo fctyd s uanms u4tlenio totop r u s;(0t2tmir3ny4apenmivilsfa2tax poo1tptnioeilsfs eauvsn()aexnxr3todlpteanvil( s2uoxopoudaptn ies (fsDra(r ;u4tle iicias aDuanmo;t)tlenxr3totop rau s t0tetoirpiu1ameemfctl( a2tmxmpnu4apeoifetytfs2rlnvp;(4aexnxf3to1oatelueo s)t2trxm3oydale lietatf rtrxm nt4tpe moetydfmDuln p (0aexrxrcoytfp  auvo;s0teumim oo4ll   feils aDumx pnu1aeeo o3iyslmDua(vpnt0altrxrcoatoaD ai i () rxoimpiudameemncslsfaDrrump;u4oet mieilsls2rl(vonu4 lxrio ootlpte nei ( s2umxo iu1lp e nvta()aDra(m ;u0oeeoiiciasfm ua(mp u0tlerir3oydlptrauvi s0 rurxo nydoptemictat)srtaxr ;u1alenmocils sDrmnmo t4tetnir oadlm  au o ()sruo(o3no1ol emnet ( s2raumo;t0alenif3iytlsDumu o;()arxnio iytoptranvsl()teuo(opiydoptemnvtlt) Durx  nt1olxoio3tydlaDumnms;t)tetrir io1fpD  ieo;() exrxo3iu4alenmfcia(  rraxrpnt1teen feiadlsDemnmo u0 rxomr3oatlm  an o;()trumxmpno4omeemivils)aDururonu0oeeoii3iys mDel(mp (0trxomrctydlmDeauvsls)s2toirpiodlmtelncs tfsrtrxmp;u1altnioeiyt sDemuvs;(4treomo3iatlaD  u s t teto(m iu1om nmnvta(fsDtrxm oo4oeeoioeiyd mDelu s;u)trtrmfctodfpD lu o;(0tetmio3
\ No newline at end of file
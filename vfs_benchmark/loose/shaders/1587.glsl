@@ -0,0 +1 @@
+ieils seumxo3oudoptnlietas  2ta(r ;o0alt mf3ias a rmnvo;(4 lerifciodfaDr uvo s0 etoxrpiy4ame mnetat)sDrr(mpou4oexniieilslm2ulums ()aexnxo3tadfmD anvols)t2xoirpou4lmeemfvta(f Dtr(mooo4oetomociyt a2rm( snu4artoxf iadomDrlnvi;()srtmir iodolte nesl() Dur(  oo4oetoioeils s2ea( pn()tltrmf3iydlpDe uvs;s trtr(m iy4optelfetat) Dur(ronu1tex  f3iys m ranvp;u4 rerxr io1fpDeaivs;t0 2xmimpiodlpenlieia(fs2tr(mp;t0tex ii3iydlm ua(vsnu4 rxrif3todoaDrlivi;s trtoxm oydlpeeliet t srur(m ou4alx ioctydlmDrm(mpn(4 etnif3tydopDraneil(0 eurxo oy4om elfci () 2tmu pnu1oeen o3ilslm em(vo;t4tlerif tatop   uvil( trtoir iu1aleelnvs s) Dua(r ;o0tpe moetytla umu p ()texoir3oa1opDr ieo s)seuoio3nodop n nctas  Drmxm ;o0apto icildfs2uau s;t4aeerifctadlm eln s s0tetriopnudomtnlfesa() rur(rpou0olenmfciydla ra(msn(4aetoir3oydop  luvi t)truoxopoo4alt mies sf 2rm(rpnu0aex ifeiys mDra(ms;()artnio3oatlaDrlneo ()srto(opoy1op nmiei (faDrr(ro;o1apto fetysfm ea( p t0aexnircia1fpteauvi t0 2tm(opnu1llen ici ()arrr( pnu1altn f3iysla ulnmp;t4artomr3ia1lm eauei s0t2umxrpiydomtemieta(  rrrxm ou4tpe ifeild a2emnmonu0altoxf3totlpDeli o t0 etmxr3nudale liet ()aDrr( onu4alt mictytfs2umu onu4tlxomr iydfa eai s;s0 rxmir3nydomtnmnvi t  Dtmu  nu0opxn fctlsla ra(msn() rtomo iodlate u ilt0 etm(r3no4am nmnct ()aDum(mp;t4tlt mi3ildfm ulnvo u) ltomr tatopt  nvs;s tetrimpou1lmtelfvi t)arum(r no4tptoii3tlt m2uanmonu0altrmr iotlm ean olt)sexoio3nu1lle mivilt  Dtr(rpnu0tptnmoctytfs2uauvp;t4 lxriocoytla  lnvi;( s2toim3oy1apeelfesat artm(rp;o0tpt ioeiasfm2rl(ms u4 exrxrcia1om rai s;t) exm(rpoydlpee fci s)sDrr(r oo0aetnmictls a2ul( s t0tetnir3tadlmtr ueo t0s2xm(rpiudalte nctltfsrra(mo;o4openmiciydls2ua(mp;(4teenxr3iotomt  n s;s teurxm iydopeelnvta() rtrum oo0apeomf3tlsfsDemumo;(0 rxnmo3iytop  au o s0 2toiopnodope  nvslsfsDrmumpot1oleo f3ildls2ulnms u0tlenmrctatop e neilt  2xr(o3io1lpte nesat aDrm(m ;u4tptnmieildfa2umnvp () etrxf todoaD li o t)trxo(r oy4ape  ictl(fa2tau ono4aet  i3iytlm um(mpn() rermr3oytlp rai s;t0 etoxopny4lpenmfei s a2tmu pnu4aptnmieiyt s2ul(msnt4 etomo tytop elieilt tetmir3iu1lme  ivta(farra(  ot0apeniociasfaDea(vp;u)aexrirciytlpDr ivo;s0 euoir oo1optnlfvs t sDra(m nu0aee ioetydfsDeanvpnu4alxoxr3oytlm rauei;s  ruo(r oy1op nmfciasfsDtaumoou0oexoii3iadlmDrauvon(4 rtoxr oo1lmDeaneilt0 2tmim oo1lmeemieia(  2ta(  nu0tptn iciydfs elnmo (0trtrxr3tytlp raneilt0seum(rpoydal   ivt ()a2tauront4aeenmfctas a rluvs (4aleoxocoo1fpt  u o;s trtr(opiudlmtemfeilt  2ua( ont4apxn oeiadfa2rlu p;t0artrio oa1fm rli sls  ruo(m3no1omen fet t s2ur(rpnu4tpto feiltfm el( onu) leoxoctatomD livs;(0t2umio3io4al  mies s srrruro;o4olenmicild aDrln s;t4trtrmf3oadoa   neolt)srtmir3no1lleemfvsa()sDta(  ;o4tle  iciyt m2ua(vo (4teerifcoydlatrlivo;( srxmxrpnudaptnmnci ( aDrrxm nt0teeniictydfm2uan p u0trxomf iydlp e nei t)seuoxr3ou1altn feilt  rrmxm nu4oleoifetydfsDrauvp;(0texoxfciytfmD anei;s t2xrxm3oo1lmt  nvs t)srrmum ;o4tpxn fctat m2eluvo t4 ltnmr tydoat ai i;s0srxoio nudomte fvtls  Dtr(mpnu1oleo octls a eaums;t4aeenmociytom e uesls  exo(rpoo1ope lneils) 2rrx  nu0tlx mo3iatfa rluvont)trerxo3iydfa e n i;()trxm(r ou4lpeelneslt)aDtauront4aexnifetys s emnms;(4 lerxfcoo1lpt  u o (  2xoir3iodlmtn nvsas) 2rm( o;u4optomoeilt m2rlnvs u0texnmo iotfa eli olt0 rtoxopou4alt miciltf 2urx p;u4ape mfcils mDuauvp ()areomfcoydom eluvo;t)trtrio3oydom n ieil(f Dur(  nt0tet micias s ra(vsn(4tlenir3tadlpDeli i;(  2xoxm nodalen netlt arur( pou4alx  fetltfs ea(mpnt4altrxf3io1fpD ln sls t2to(m oudameemivsl( a2tm( oou0aexoif3tld aDumums (4tetrmf3iytoa elneo ( srtrim ny1amtn ietas a2tru  nt1tleomociatfmDelnmsnu0aexnxfcoadfmDr neo s0t2toimpoy4llt mivias)aDraxm oo4optn iciad aDumnvp u) reoif iotlpt  neo t) exmxo oydam e fci tfs2ur(rpno1aeeo octasls2uln o u0 ltnmrctatoate ivo;(  eur(m iu1lpeemfeiltfsDurum nt1oetnmictyslm emumo;(4aetrir3tytfa r nvi;( trxmxm nydlpe lnet (f Dur(moou4tlx ifeias s2ua(vp;t4aeeomfciodoatrluvolt0s2tmirpou4omt mivi s sDraxmpou4opeoiiciyslm um( p;u0 etoxo oytfp raies;(0t2xoir3iu1am  lncs sf Draumpoo0oltn fctatfs2raumo;u) exrmr3ootom eliei;s seur(m3iy1amt lfet () rtm(moou1oeen oeiat aDean onu4tetrxfctodfmDe u slt) eurxo3io1ll nmici s sDtrx poo1aeeniociatfm2eln pnu)arerxr3iadlaDranvs;() 2tmxmpiydolt liet t srtaumo;t1apxo i3ias sDrmn o;u4treoio3to1lmtrau olt srxrxo iydolee fvta()sDtm(rpou4aeto ictld m2em(vo;(4alxomo3oodlmD  nes (0tetoxo3ou4lp e nvs s sDurxmono4tpeo ietltfa2ulu snu)tlxoxf oytom eanvils)trurxr3nudopeelfes tfsrtaum nu0aexnmocils a2ua(vpnu0altrxr ootfmtraneol(0 euoxr ny4op   ncil(fs2rmxrp;o1ole ifcils mDemu pn()alerio3iydlp eln slt)t2xrim3iu1aptnlncsa( s2ra(rpoo0tltn ieilt m2uanvs;t) leoio iotfpD au o (0srum(m iodlmee fvt t)sDuaumono4tlt iicias sDrmuvp;u4treomo3todlatran ilt0 rxm(o oy1opt mfvsltf rtrx oou1aptn feilsla uau p;(4altrxf totfm  li o (0srxm(o oy4alt livias)a2urxroot0tpt  fctldfm2rl(mpn(0aeeomo3ia1lp e ues;t trxrir3iydlltn nei t  ruru ont1oltn fcils m um( on()tlerxf tydlmteln i;(0 exm(r oo4llen ieilt s2ur( pnu0alen i3tlsls2um(mo t0altnmo3tadfmt  u olt)seum(r ou4lm  mfvil()aDtr(rono0oex moeiys mDrm( s;t)trermo io1lp  aieo;( srtrxrpoo1llt lieias s2uaxroot4oexnmo3tasfaDrmnms;t4arxomr3iy1fp rlu s s0tetm(m ny1ol nmneil(  2raumpno4texnmocildla2elnmonu)tetrmfctydfat  i o s)trxmio3no4ap nmncs () rra( oou1tpe  ieiyslaDul(msnu4 rxrmo tydlm rau i s s2xoxm oodamtnlictlt)a2um(rpnt1optomi3iydls ean snu4treoiociytfmt lu o t texoxo3nu4om  lies ()srumu ono0opto feiad s uluvp;(4tltriocia1opteau o t  rurxm no1lmt  nei t) Drmx pnu4apx iietasfa ul(ms;u4texoirciodfatelnei s0 2xr(rpnydamt mfvil( artmxr ou1openifciadfa2el(vp u)trermocoytfpDrlnvs t0 rxrimpnu1apeelivi t aDrax  ;t1aleomfctatlsDra(msnu)texomfctytoptean i;()s2tmiopoydame lieia( s2rax oou1olxomo3ild sDulu snt) rxoxrcio1lm rluvil() rtrio io1lle  fvs tf rtrxrp;t4texoii3iadfs2ea(vsnt0alxrxr oatfpDeln o;t)s2umir no4lle  ieta()arumxrpot0olxn f3tld a eluvs t0treoxr to1fateanei s sexo(rpno1amt mieils sDtrurpnt0alen oetadls2ea(vs;(0altomf3ta1fatr nei;t0srxr(m nu1amtemivtltfsrrr(ront0opx mfeilsfmDrmnvpnt0texrif oatfateai i;(0t2trio3oydaptn ies sf 2um(mo;u1aptnif3iyslmDelums t0 exoxocoatoaDrai slt0 rto(r iu4op nmnes t)s2ra(  ;o4oeeoii3ilslm eanvs t0 ltoircoytfp rli o t)s2tr(o ny1amtnlfci tfs2ur(r no1openioctldfa emnmont0 ltoxf to1faDeluei s t2uo(rpnu1al e ncsltfa2rmuront1olxnmi3iytlm2emuvonu0arxomfcootlaDe u slt) 2uoim3oudlpe  nvs s aDtr(mpot4oleomf3iatls2elums;() lenxf oatomDraivo;()setmio3ny1apeemiet tfa2umxm nt4olxnif3tyd s uln p u0 lxriociytop r neol()teuoimpnudlmtemfcta(fsDurumono0ape mi3iysfs eau p (4tltoircty1oa  luvilt setoimpny1ll  lfciat  2rrxmp;u1oeenmo3ildlm eln ont4alxrirctodfm  lnvi;()trxrirpoo4omenmfetl(f rraxr ot4opxoiociatlaDuaumo;t0trxoir3oydopDrlnvs s  exr(o3oo4ll  liesa(farurxront4tpxnmi3iadls2rmuvpnt) exoircoy1lp ranvs ()s2umirpou1alen fesl(  2tmumpnt1aeeo iciadfm2umnvp u) lxrir3iy1lpDe i ils)s2uo(m3nu4lmt mietasf 2taum nu4oex ifetad a rmn s (0altrio3iy1latranei t0texmirpiy4ap elfes s a2rmx p;u1apxnifeiytla2eln ont)areriociatfat lues;() 2trxopno1om emici s sDua( oot4tpxo oetyt s ulu onu4teeoxr3iatoat anesl(0 2to(o3oydom n icil(  rrrxrono4ape mi3iys s uau ont)tlerir3oadom r nvi ( sexm(o3no4omtnlnvtat) ruaxr ot4opxnmietlt sDrluvp u)aetrmf ta1fptrlu o t  rtr(opnodaleelncsl(f 2rmxmpnt4alt moctaslaDrluvo;t4 exrxf totomt lnvo;s texrirpoy4omt  nvsa()aDuaum ;t4oeeoifeild s uluvo (4texomr3oodomDrlnvols0srxrxmpoo1lm nlietlt)s2ra( pou4olxoii3ild m el( on(0artoif iatfatr i olt sexmio iodome licsat)sDraump;u0alxnii3iysfmDrln p ()trxoxocto1fatraueo t0sruoim ou4om nlnes s)s2tm( pnt0oetnmieiadlmDemn o t4 leniocoodfp rlu o;t)srtr(o nu4optnlnesas)a2tmxrp;t0tet  ociad aDeau pn(4trxrxr3totlaDraivi t)seto(o3iudopt mfeia()a2urxmoot1texn octlsls ulnvpnu0 ltrxo oodoptrlueo s) 2urimpiudlltnlnvsl(fsDrrur ot1aleniieiasfs uauvon(0 etoiociatfmDranvi;( t2urxm3oy4op emfesls  rrmu  ot0apen ocildfm ea( s () reoiocoo1latelues ()trxr(rpno1al e ivsls)artrur ;t4olx moeiysfaDeln s u0 etrxo oatopte ivil()trtmxo3ny1amenlics tf rra(rp;u0tleo ictlsfm2ranvp;u0treoio3totfpteaiei;s trtrir no4lmtemneils a2um(r no0opt  iciatfaDul(vo;u4 eeniociydoa e u o;s)srtmim nodoltemfvilt)srtaur ;o1oexoifciyd mDemn snt4 rxrxocoodoatelu o;( sexmirpno4llt mfvsasfsDuaxr nt4oee ifciytfa ulnvp;(0 lxrio3to1fa eli o (0t2uoir3iu4lp emfci t aDrm(r ;u4apt ifeiadls emums;t0 eerxr3io1om r ues;(0seuoxm iu4openlfci s s2rm(mono1tlxoiiciadla ea(ms;(4 eenmfctadlmtrlnei ( s2xm(m3oydale livs s srua(roou1tltomo3tysfsDuau p u4altrxo3tatoptrluvil( srtrir3iu4ol nlies tf Dtrxmp;u0altomfetasfm2em(vsnu0tlenmocoatlmtr nes;t)tetrxr3iudlpt  fet tfarrmurpot0tet  o3iasfaDul(mp;(0trtnxocty1lpDrlueil(0 rtr(mpoudole  iviasfsrraxroot0tpx  fciat mDem(vsn()tetoxo oatomDeau i t)s2trirpou1olte nvs s) Durx pot0apxn fctysfs ulnvs () reomf3ty1oatranvs ( seuoio io1apeelfcsls srrm(mono0oltniiciydfsDulnmo (0 lxoxrcto1oa e n il(  rur(o nudol e net sfsDtaxr no1oet  o3ild mDrl(vsnt4tetrxf3ta1fa   u s;s trxoim iodll emnetas srra( pot0opxn fciydfs rlnvo;(0teenxr oo1fmDr uvi;s0teum(r oo4lmtemfvt ()aDrrur ;u0opxniieiad a emnvs t)artoir ty1omt  nei s) 2xm(rpou1om  miesas arra(m ot0aexn f3iltlsDrl(vp (0aexrif3iotfa rli ils)texrxopou1alenmivs ()a2rr( ont0oeenmociyd s ranvs;t4 ltrmocio1fpt aieo t0s2xmxr ou4ame lict t s2umxr oo0apto oeiyd m2rlnmo;t0tetomfctodlm eaiesls0srxr(o iodamte ivtas)arrrxrooo1alt iictys s2umu p u0trxrmr oodfa raues t srumir3oodom elivi tfartru poo0aeen o3tltlaDua(monu4 renmr3ty1fpDr ueo s0 etm(r iydomt  nes t)arum(m ;u4altnifeildlm2ul(vs t0 renxf ia1lm rau s t0tetmxmpoy1lmeelivsasfarrmum nu0aexomo3iyd sDea(mp;t4areniocio1lmt  nvs t srurio io1olt  fcias)aDum(r ;t1aetnif3tatlm2ulnvp;u0tetnxf3tatoateanvi t0trtrxrpio4om  miesl()s2rru p;o4aeeomoctldfm el( o u)trenmrcio1lmDelivilt0s2trxopnu4lpt  fvia(fs2urx onu1opeoio3iatls2emnms;(0texnif3to1omt lu ilt)seuoim3iudlmtnmfvta(  Durxmoot1opeo fciatls2ranmpnt4 rtoir iydomDrlnvsls)srurxm nudal e nvi s  rtmx pnu4tlenmoeiadfs2ranvo;u)trtrmr3oy1oatelnei ( trumio3nu4llee neilt)s2umxmoot1aleo i3iytlsDeaumonu)aetoirciytfat liei;s0srxoxmpno4ap nmivt t)aDurur oo1tltnif3iadfa umn snu0 lenxr3iy1omtrlnvo (0trxrio3ou1al  mncils srurx ono1oleomfctysls em( snu0alxnio iodfmtraneo s)srtmxmpno1lp  lncsat)aDtau p;o4apt  i3iat aDean s u0texrmfcta1fp eliesl(  etoxo3ou1ll elietasf ruaxro;o0oetoifciyslaDeln s;()alxnxr3oo1fmD  ivslt)trtrxo io4openmici (f 2raxmpot1apeomfeiat s2rlnmsnt)aeenxr tydlm  aneils)s2xoxmpnudalenmicilt)srum(r ;t0alxomieiytfaDemu onu) rxrio3iatoptr neils)trxmir oo4omee fviltfaDrru pno1texnmfeiad m2rauvp;u)arenio3ia1fa elieslt s2trxopoudaptn iei sfsDra(r ;t0aee mictlt m2eau ont0arxnmocoodfat aivo;t0teuoiopiy4ape lnvi tfaDtrxm ;u0tpt mo3iltla uanmp;t4texrmf3oadlmt aieslt0teuoim ou4ape liesls  Dumxmo;o1optoii3tld a ulnmo t4trerir ty1fat lu s;()trum(r no4op n ietls a2tmx  ;u1tlxo ociydfm2rauvs;u)arxnmrcoodlmD anvsl(0 etmio oudolen ics tfarrru  oo1ape moeils m2emu o;t0aeeoxrcootlpteauesls)srtm(r3nu4lmeemfes t) rra(mp;u1tle mociytfaDuluvp t4trxnmfctotfpt au sls  eumxrpnodole mfcsltfsrra(mpot0aee iieiysfa ra(vs t0altoxrcoodfp rluvil() 2xoxm3nu4lle mfviatf rumxr ;o1tlen icilsls2eanmp u0 exnxf ty1lat ln i;s)srurxo3iy1alen neta(  2ra(m nu0tlxn i3tasfmDean pnu)trtoio ty1fa r n i;t  eumimpny4apt lfvt t) Duaxrpoo0tle  ociydfm um( pn()texnir oydlm  au i (  exrimpoudop  lfcs sf 2trxmooo1opeo o3iys aDrmuvo t4 exoircoy1lpDrli i ()sexmxr3iy1omenmnct s) rtm(  oo0tptnii3iyt m ran pnu4aeerxfciydomt  uvsls0 2trxmpoy1lptemici ( aDuau p;u0oeeoif3tat s rmu p;() rtrxr tatlmt aies;t)teuo(m iodlpenmfei ( aDta(moou1tet mf3ilt sDrlu p;(4 lerir tytopD lnvilt0t2xo(m oudamt  ncil(f Duau  ;u0tpxnmoctyd a ra(vo;u)trxnmoctadop e ues s  2xrimpnydop emfes tfs2rr(  nt0texoifeildlaDea(monu)artoxr todlpDean ilt  eurirpnudll n ietltfa2rm( pno0tlto i3ildfmDua(mont)arerifcoydomtean s s)s2urxm3iu4ap nmfctat)artaumoot1aee ioetldlm2el(mon(0artoir3iytfa eanvs;s)trxr(opou1ol  mivtat arrmu ono4teeoioeias s2rm( p;t4 rerifcoodfaD lies s) 2tmxm iy4amt licsl( a2ur(mpnt1tpe iiciytfa eauvsn(4texoir3iy1opD anvi t sexoio3oudolt  fcsat) rrmurpnt0opx mfctld sDrmnvs (0areoif3oa1fmD ln ilt0s2xmiopoo4lpeeliei s) rtaxmpot1oeeo feiasls2emnvon(0treomo3iytfm eluvilt0sexrim ou1ap n ivs t)s2ta( p;t0oeto o3iasls2emn snt)trenio iy1fpDraieil(0s2xo(r3no4ole mnvias)a2ururp;o0tlx  ieiyslaDum(ms;()trtoxocia1fmDraneo ()t2xmim3iydolen fei tf rum(ront1tpxoiocild m ra(mo;(0aexnxocto1opDrliei s)teur(o nudolte ivs t s2ta(m ot0aexoifctlsfs rl( pnu4 eenif iy1fatelneolt  rxo(opoodlpeelfciat)artr( p;u4alxnif3iltfm emuvs;t)trermr ia1fat lneo t) etmio oo4om elfvilsfs2rrx  oo0opxnmociasfsDeaumo (4arxoxocoydom  aneo (0trxrxmpiu1ap   nciltfs2tr(m ;o0apx ii3tys a emu o;(0trtnmr ia1fptr ues;t0trtr(o3nodlm n ivsas) 2rrumoot4olto fetat a2rlnms u4areomf iatfp  ln ols0sexrxo3iudlltnlictas a2uru o;o4ole  iciasfsDemnvpn(0arerxrctotfp elnvols)trtoio3iu1apenmicias)s2uru  ou4aet mfcilsfm2el( pnu)treomfctatomte uei s t2xrxr oy4optn ietatf Drm(mp;u1tlxomfcias sDrmnmsn()arxomf io1fptrauvo;(0seuo(r3oydamt mnci ()sDraur nu1oee ifeiasfm ua(vo u0 rermrcoatlmteanes;t t2urxm3iodlm emnctatfa2uax o;t1opxo i3tyslm2emnmo;t0 eenir3iodfm   iei;t0teum(opiy1amtnlnvs tfartmu  nt0alx io3tasfsDelu on()aetoxo3iytop  aivils)srurim oodom nlnvi tf 2umxmont1apxn ictltlmDelumon(4artomr oy1lpDeaivs;( s2tr(rpoodlle mnciat) Dur(mp;o4alxnifciad mDrlumon(4 rtrxr totfpteanes;t0 ruo(r3ou4ap nmfetatfaDumxm ;o1tle moeiys m ul(vs ()tleoirciatoa   u ilt)srxoxopou1alt  fvias s2tax pnt4tleomfctldlaDrln o (0aexrir3ty1op rlnes s0 2xmir oy1al n ictlt a2rru ont4aexomiciyt m2ul(mpn(4trxomo iodfptelnvi;(  rumxr3nodomeemiei tfs2rmu p;t1apxoiiciadfm2rmnvo t0alxrxo iodfm  luesl( texm(r3nu4ll e iesl( aDum(ronu0tptnii3iyd mDrmuvpnt)texrir todlp  li ils0s2xrxo nodopeemfeiat)sDururoou0optoioctat a uau onu4 rxnmo3iodlmD lies;s0teuo(r oydlp emicta()aDua(  ou4olxn fciyslm ranmp;t4aetrif3tytlat  u ol()teum(m3oudamtnmiesat)s2uauro;t4olto fctysfsDelnvp;u)tlxnxr3tydlaDe uvo;s0setoir nu4al nmiesa()a2trxmoou0ale ii3ias sDra( s;() rerir iytop raiesl()s2xr(m3oydlleelfctat)sDrmxr ;o0tptnifeiatls2ulu ont4 lenxo oy1omte uvsl( s2um(opio4optelnct (f 2umu  ot0aexomi3iyslmDemnvpnu0tetomfcoa1fatr n ols0 2toxm iu1alt lnvt t aruru  oo1tpto f3iat m eln o;t)tetrxfcoodfpDelneo t)t2toxm io1omt  ivslt  2rmumo;u4altomociat m2emu sn(0 rtrxociadomDraieol()sexmir3nodope  ivi s) Dtmu  ou1tlto fetatfs ua(ms;t) lerio oytfa eau o ( s2uoxrpiy4am emncta()arurxrpno1oeenii3tltfa ua(vp u4aetnifciadlatr ivs t0 etr(mpiydlm e nvs tfsrrrx ooo4tpe ifeildlsDran s t)aleoir3oydlptranvslt t2xo(o nu1ll nlfeiat a2taxmont4tpe ioeiydls2ulnvonu4 rxoio tatoa  aueslt) 2umxr ou1aptnmnes s srtaxmp;t0tle  ociytlm ua( s (0tetrir iotomteaivi (  2xm(r iu4llt mnvias) Dtaxrp;o4olxomocils sDul( s;t4tetnircoa1omDrln s t teurxmpnu1al emfvsls sDurur ;u1tlt mfetasls2ran sn(0trerxr3oodfa rluei;s0 ruoxr3ou4llt mnctls)a2urur nu1oeeomictadfm um(mpn(4teeomo tydlpDr neil(  2trir oy4lltelnvils srtaxmpou0aetn i3tad s2em( pnu4alxriocoytomtran ils)t2xo(mpoodapte fvsa(f Dtaum ;u0olt  iciadls2em( onu) etoio3oy1oat lueil(0texrxo iydom nmnvs tfaruaxm ot0altomociyslmDrmnms;(4 ltrio3ta1lp raues ( s2toxm iudamt lietat) rumxm no1aet  o3ias s rm(msnu) renifciydlpD  iei s0 2xm(rpnu1apenmncsat) rrru  oo4altomietyd a2rmu o;u4 etoio iotomD lnes ()srxm(mpou4ale  ieil(fsrum(m ;u1olxoio3ild s raumpnt) lxnifcto1fm  lu s t0 etoir3oudalee fetatfs2rau  oo0oet ifeiasla2rl(vont4aexnmr oa1oaDr uvs ( sexoio oo1am  mnct t)s2trx pou0tetoioeiatlm ulu p (4trxoxocoa1lm elieo;s) rto(m3oydale  fvsa(f 2tauro;u1oeto fctltfm rmu s t0 rxoxrctotlaDrlivi;s0setm(m ny1omtnmnvslsfsrrmxrpoo1apxnifcias s2uan o;t4tlxoio3oo1latrli i;()srtmxo3oydal  lfetlt)sDuaurono0alxnio3iat s umn p () eeoio ia1laDrlnvsls0s2tmxopou1lptnlfctl(faDtmxrp;t1olx mfeildfsDumu p;() rxnio3tadfpD ai ols0srtmir no4lpeelivilt) 2trx  ot0olt mo3tlsfs um(mp;u) lxrxo tydfmDrln ils0srxoxo oudlme mnet t  2ra(mp;t0olxo o3tyd a emuvpnu)aeerio3ty1opD  ueo;s)srtrxopoodale  ivs t)aDta(r ;t4oet  o3iydfaDrmuvp t4 etnxr3iytlp  luvs;( t2xoirpio4ll n icilt)arururoou1aptoioeiatfa rlu o;(4 lxnio3iadopD  iei;( t2tr(opio4olen nvtls  rta(rpnt4opxniictad a uaums u)tlenif3oytfp   neo s0 euoxm3io4aleelfvias)aDraumpno4texo ieiyd a rau sn(0tltoif oodfm raueo t t2tmiopnudolee fcs t s2rm(mooo1aexniictyslm ul( s;u0 ltoif3ty1fat livo;s trtmxm3nu4oleelnci s) rrm(ro;t0oee io3iasla2umumonu4alxoxr3iadlm rluvil() 2tr(opnu4omen fetlt) Duaum ou4oetomf3iysfs rmnvo;(0trtoxf ia1op  luvi;t0 rtrxr ou1olenmncsas  Dua(rpoo4aeeomfetasfm ul( p;u0aleoir oy1lat lu i s0t2xo(m ny1lm emivi sfsDrru oot1openmociadfm eau s;u4tltoxf iotlm eli i s0trumxopny1ol n fciat)s2rau  ;u1olxnmoeiyd s ra(vs (4 ltnmf oodfaDeanvslt)sruoimpoydope  fcta()s2ua(m ou1ole mf3ilsls el(vs u4 leomf3tadopDeanvslt t2xrxo oydomenlivi ()s2taxrpnu4tex mi3iltlm ra( s (0trtrmocio1oaDr uvs;(0t2tr(o3iodom n nctltfsrtax pnt4olx moetltlsDumnvo t)tlenio3tydom  lneil(  exmio3io4ap e nes s)a2rrxr nt1tpe  i3iysfa elums u4trtrioctotla rauvs;( trtm(rpnodol  mfcs tfs2uaur ;o1alxomoeiytfm2ranmo;u) lxrmf3totomDraieo t)sruoxm ny4om  lnesl(fsDraur nt4tlxnmo3tydfsDrmn s;u0 renxocio1fmte n sl( s2tmir io1lmtelivt (fsrurxmonu4apenii3tadfsDeauvp;(0aleoxf3to1fpt  nvo t teur(rpiy1ll emncs ()s2uaxrpou4olen i3tltfa rl( o t) rxomf iytfaDrlivi;(0 2urxm iy1ole mfciasf rtrxr ;t1apx ii3tad sDrl(vs;()tltrio tadopD au s;s) exm(o3nu1lmenliei s arraum ;u0alxnio3iytlm2raumonu) lxnmocoo1fmDrlies t  exmiopno1amenlfei s s2tau ooo0ole if3tatfaDum(mpnt)arenif3tytoa eanvsl(0seur(rpnu4ole mfcias  2urumoot0apto iciat mDul(vpnt0aleoifcia1fpDeanei;s  rumirpoodale mfvsas arua(ro;t0optn iciaslm umnvs ()alxrmo3ia1om elu o;s) exmxm ou1alte net (  2rrxmo;u0apxn fetasla2eanvo (0 lermrciy1fm   uesl(  2tmxm nodale mfeiltf rrrxro;o1tlt ioeiyt mDrl(vo;(0tltrmocto1lm  lnvo;() 2xoxmpiudol elici tfsDrmump;u4tltniictlslmDrau ont0 etrxociy1laDrlues (0sexmio3oy4lm emivi ()aDtrxrooo4alen oetaslaDel(vo;t0tltrmo3oy1lpDrln i t0t2xrim3iu1lmeemncs sf rraxmpot1tle mfciad m rmnvo t4 lxoifciy1oaDrai ols)trxoxopoydlpenlnei s a2rm(r ;t4olxnioeiasfs uln on(4teenxo oodlmtr n il(  exo(mpiy4lltnmivsa() rta(monu0apxn oeiadls2uauvp;u4tlxnxf3ta1fm e uvsl(0s2tm(m io1ll n ivi t)a2ra(mpou4apxn ociltlsDem( o t)tetnmf iytlp  anei s teurimpiudoleemfcil()aDta(monu4oet if3iat m2em(vpnu0trxnio3tydlpt aivs;(0t2trxo3oydol  micilt s2rr( poo4olen o3iysfs2ul(vont0trtoio ty1lpDrlieo t0 eum(opiu1amt lieiat s2raxr ;t4olt iiciad mDran snu) lxrmo oatomDeaueo;( srtm(o3oydop nlics s)sDur( oou1tpe mf3iasfa2umnvp ()tltrxrcta1lp rlnvslt0sruo(r io1apte icsl() rrrxrp;u4tltomi3ilsfsDrm( o;() rtoio iy1oaD lnvs;(0setrio iy1olt  ict t)a2um(rpou0tetoii3ils m2rmumpnu0 rtrxfcio1fate ieslt srxrxr3ny1lm n feilt a2ra(roou1texoifcilsfm umnvp (4arenmr tydlmtr n ol(0 rto(opnodllenlivsa( artmxmpou4alx mieiatlmDemnmon(4 renxfcoa1oa   uei s trtmio3io4amenmfci ()s2urxrooo1apto oetydfm2rl(vp;(4aeenmf oadoaDrln i t s2xoim iy4lltnlncias a2rmum nu4tpenmiciad mDra( s;t)aetoif3oytlatr nes;t0 2tr(mpnydome  neia()a2rmxm nu0aptomi3ild aDeluvs u0 leoio oytlatr n o;s)trxo(opnu4aptnlnes sfartmxm ;u4altnmoetldfa um(vs;t)texrmf3totfmte i o t0trxo(o3nudal nmnesl()arrm(moou0tpxnmoeiadlaDrmu s t)alenxfcoo1om r n s t)t2to(r ou1lle  fci s arrrumpoo4tetoioeiatfaDrmuvonu4 etrio3oadopt  ieo t0 2xrxo3iodam   iviat sDuru poo0optnioctldlaDrl(mp u)tlxrxoctydlpteaueo;s  rxmio iy4ape lfcsls)sDrmum nt0oleoifetas sDum( p u4 eeoxrciatoaD  i o t)srtmxm3oy4omeemnctas  Drm(ront0oexo oeiad aDran p (0 exrmf to1lp eauesls0srurio iydoltelicias  rur( pou0tetnifeiys m ua(msnu)trtrmf3tytfmD  ues;s sruoirpiu4ll n fes t)s2um(  oo0oeto oetasfm eau p u4 ltomr3oydomDeauvsl(0texr(m oodapt lici s) rumxmont1apen ieiys s2rm(mo u) rermoctotlpDr i o;t0texrir iy1ll n nvtasfa2rm(mpnt0tpenio3ilslmDrmn s u0 ltoxfciodfmtelivo s0 rxr(m3oo4oltn fci sfaDtau  no4tpt moctls m emums ()aetrmf3iodom r u s;t seum(r3io1omtnmfvtlt) Drrump;o4oex if3tydfa2em(mp ()tlenmr ta1oa  lieo t  rtmim io1lmeelivia() Dtaump;t4tet  fciltfm2rlnvo t0texnxr io1oatelnes s0srxmxopoudom e ivt s)a2rrx onu1tetoifeiadlsDrm(vs;(0 rtrmf oadoa  aivs t) 2umim3oy4op  lneil(  Dumxmont4tpxniictadlmDelnvonu0tetnioctatlm rai ils) rum(o3oudomenmiciatfsrtmx pnu1oee mi3ild a ean sn() ltrio3ty1fp rlieolt trtmirpny1open fctasfsDtr( poo1apxoifeiat m ea(ms;t4 rtnmr oy1fatrlneolt)t2xmxopiy4lleelnei () 2rm(m nt0tpeo oeiasfsDeaumsnu)teermo iydlaDraivsl() etmxopoy4omee nes (fs2rmumo;o4tpxo ictlsfs2rln p ()aexnxocoatlaDrlu o;(0s2toxm3iy1optnlnvtlsfa2uau onu4tlen oeiysfs2ua( o;t0texnmf ty1omt aies s  exoxo3ny1opt lnetls  rrmxmpot0tltomocias s rau o t) lermf3iadop   i ilt seumio nudope lieils  rraur nu0apeoioctld a rlu snt4arerir3todlpteli sls) etmxm io1oltemivt t  rra(r ou1tlx mfciadlsDuaumon() rermfcoadopDeanei;s0srtrio io4aptelfciltfsDrrumo;t4tpeniicild m umn p;(4alxoioctytfmD aneo t s2toim oodlmeemncsa() rrmxmono1opt  ociadfs eanvp;(4tetnmr3tydlaDr nvi t)tetrir3oodape mietlt) rtrur ;t4apeoioeildlm ul( pnu4arxomo iodoa elies;t seto(m3ny1open nci s) Drmu ono4oeenmieiytfsDrl( pnt0 rtrif3ta1optrau il()srxoir ny4olenlneil()s2raur ;u4apxo fctadla ranvo u4 leomoctytopDrln o s0srto(r3iudom e ietat s2tmurpou4oexoifctls s2rau o;u0texnxf3iydlaDrlnvo;t sexrxr io1llenlivilsfa2rax pot1oetoioeiydfm2ul(vo;t4alxrxf tadlpD an slt teumxopoudapeelietltfartau p;o1alx  o3tas a rlnmon(0artomo3ia1fpDe uvs;t0t2xmim3nydopen ncslt artr( ont4apen ieiytfa2rmumo u4aeenmf tatlmD lieil(0 2xm(r ou4opt lici (fa2taumpnu0opto iciys aDra( o;t) lermf iotlptelnvi s0 rxoirpoo1ol e feil() 2rmxrpnt1tleoio3iltla2ea(mp t4texoifcia1fmte uvils)srtrxmpiydolt miviat a2raum ;t0aetomoeiatla2rlnvpn(4aleoio oadlptrlnvi (0setm(opio4ole licsltfarurxmp;u4tptoifcild a2emnms;() exomfcoodoateln ols)trurio3nu1om e icsls)sDra(r ot0tpxoioctltla ulu sn(0aexnxr3ia1omD  uvs (0setrir oo1ope  nei ( aDum(m no4alt iieiytfs eln s;t4treoxf ootlat anvsl( t2xrio iydoltemnci s) rurum nt1teeo fciadla2ra(ms t4tlxnxfctadlmDr n ols  rxmxmpiu1oltnlnetatf 2ta(  nu4oltn feiyd a umump (0aeenmr iadoa ranvi;s  etrxo iudol emnviatfa2rax p;u4aeeo ieiydfs uln p;t0 lxnmr3oatfateanvs;(0s2xr(o3oo4am nmfvsl(fartmum nt0tetn iciat s uauvo t4arxnxr3oydomDr ivs ()truo(m3iu4lm n nviatf 2tax p;u4altn ictat a rlnvp;t0tlenmfctotomDrauei t) eumxopiu4lp emfvs ( arururono4alt mfciytls eln on(0aexoxo tadoa  aies t trtm(o nu4ol elics t)aDurxro;o0tptomiciyt mDumnvs u4arxomrctydopt  i i ()setrirpou4ll emnes s)arua( poo1apeoifcild m2ulumo u4 ltrxo to1fm r u olt) exm(o iodalen ivil()s2um( pou4alx mfeilsls2em(ms;u4teermo oo1opteai olt) 2trxo3oy4olen fcta( srtm(  nt0texn octytfa rl(mp;(0 rtrio todfa eanvo s sexrxm nu4ome  ivtl(  rtru  ot0tle  ictasls el( pnt0tetomo3ta1fa elivols)sexoirpnu4am  lnci t)aDrmx  ;t0tltoii3iytfm umuvo t)tlenxoctotfpDrliesl()sexo(mpoy4om  mivi (fsrtr(r ;o4aexnifeiytls2em(msn(0tetnir3oatlm   nes s0s2urxmpiy1ol n fvilt) Draxr ou0aleoiietltlmDrm( pnt4tlenir tytfm  lu i;t0 2xoxo3ny4alenmncta() Dtrurpno1aleomietat m2emu pnu0 rtnmr3totfp eluei ()sexr(m3ny4lptnlnes t sDuaur nu1tpeoif3tlt a2em(mon(0 ltrio3tadop ean i (0 rtrimpoy4am elicsa(fa2uaxmpnt4olx ifctat sDra( snu) etoio3tydoat  neils0s2uo(r3oy4opte ncs (  rra( onu0aexomfcildlsDelnmon(4tlermo todfatean o;s  eto(r nydape lnctlt arum(rono4ole mfciytfsDul(vsn(4alenmociodop eliei s0tetoxrpio4lm emfes s)srtmxmp;u0olxo o3iadfa emu onu4texrmr3oydoaD aues t0 ruoxo oy4ol n nctat  2taurooo4oltomfctas m2rl(vs ()alxnmfciodfpte ivsls srto(rpnu1om   ics s a2rax poo4oleoiietlslm umuvsnu0texrxf oydoptr i i t) etrio3oo1ome  iesltfaDra(mo;o0optn oeias a2elump t4 ltrio3iy1omt lieo;t0texrxr oodom  miet s) Drm(m oo4altn o3iys aDeaumonu4arxrio iytfaDr n s;s)srtrxo3ny1ol n nvia(fsrtmx oou1tpto o3iys a um(vs;t4altnir3oytla rlies t) eumxm3nudamtn ncs s)arrmxmpnu1tpx mfetls s ea(vont)alenif tydlmt lu ol( trxmiopny1lm e ncils srumx onu0ape  ictys s ran p;()trxnio3todfptr nvi;(  2tr(mpno1omt  fciasf 2ur(  ;t0aetnmietld sDuan o;u0artrmf3ta1lmtraivils0setrir3iydomenlnvtlsfs2tmu ooo0tpx moetytla el( pn(4 exnio3oodfmtrli s;t s2urxm3ou4lme  fvtatfartrxr nu4oet  ociys a el(vsnt4trtrmrctydlmtr n s t0trtoiopnudlm emneta( srtr(r ;o0tlt mfctat s emnvo t0trermrciytlmD lues t)trurir3iy1llt mietl(f 2uau p;o0teto ietytfsDemnvp;t0aexrmfctytop  aneo ( teum(mpio1optnmnvtl(  rtrxm ot0aee  f3iytfa rlu s u4trtoxr3oa1omDran o;(0trumxm io4apeelici s)artmxm no4teen oetltls rlnvsnt)trxnxfcoatoa ranvols  rtoim ny4ll emncsatfa2taurp;o1aeeomoeiytfs uln pn(0tltrxo3tytlp eai olt trtr(r3oy4llen ictasfsrrrxmo;u1oex  o3iysfa2rm(mon()teenxr3iodfa e n s s0 ruo(opnu1om emfesasfs2rmx onu1apxnmoctytla ua(vo t4areoxr3oy1fat  n i s0 etoir3io4oleemivi s)srtru ont1tleo ietld m2elu s;u4 rxoif oadoa raivils) rxrxm3no1apt mnet s) Dtmu poo0tpeomfciad a2eanmp u0 etomo3to1om  aueo;t srxoxmpnodale  netltfs2rauroou1aee ifetldfsDrlnmp u0 rxoir iodfm e uvils)teumir iy4ope lfvi s) 2trxrp;t1apxn octadfs ul( p;t4tetomo oy1lpt aiei;(0srtmxr oo1altnliesa(f 2ur(rp;u1alxo f3ild a2ea( o;(4aetoifcoydfp r ivsls seumxr3ny1oltemnctat)srtax pnu4aee  oetasfa2eauvo;() rermocoa1op eanes;s)tetm(o io1op nmneslt  rtmumooo0olxo ictydfs2ra( ont0 ltrio oy1om raivs (0srtrxopiydop nmnetl( s2rm( ont1openii3iadfm eluvp t0alenif oodom   n s;t) rur(m3iu1lp  lfcsas a2rrxrooo0tlen o3iys m rm(msn()areoxfciatlm  anes t  eumxo iu1om n fcsltf 2rmxrooo0texn oeiatfm ranvs t4arxnif3ia1laDe nvs ()t2uoxm oydapee nvtat  2rmur ;o1olxo f3iatlm2eau o (4altomf3ootlaD  ivo;(0 eurxr3oo4amtemivsls)a2trx  no1alx ioeiat aDeau onu0arenio iy1omtelivi;t0 euoxo3iy4apenmfcsat  Dur(r ot4aeenifciydls ua(mo;t0trenxocoatfm rauvo (0sexmim3iu1lme mfctl( aDraumpou4oeeomocilsfs ua( snt4 leriocty1lp  aueolt s2trimpio4ol elfcta( artau pot0aeeomf3ildlsDumumpnt)tltrio iotlpt  n sls t2uo(m nudlltnmfcil( srtaxro;u1tpx mf3tasls2rmnvont) etrmf todomDelnvo (0 eto(mpiu1lptnliet tfa2um( ono1tpto o3ilsfm rlnvo;t) exnmo oatfm  au i;( trxoxopou4al  lnctl()arrrxr ou4opxo o3iatfmDulnmo u4 etoir3tytlpteaies;s  rurxo3iudll   ietl(f Draurpnt4aetnmf3tlslm2rl(vpn() ltnmf3oa1laDr nvs t0 rtm(m nu1alt lnet sfa2uax oot4olxnmi3tytlm2ua( pnt0teeomr3iadoa raieo t srumxr nodam   ncia(fsDurumoou0olenmoeiysfs2umnmo;(4artniocoytfa eaneols) etmxr nu4op  mnctasfaruau  no4aetomfciaslmDul(vp;t)trtomr oatfmteauvol(  2xmxopiu4op emivslt  rururpoo0apto feiytfaDrm(vp;t)tlermf oatfaDelnvils) rum(r nodlmt lictl(f 2urx o;t0openmfetas m2umumo (4aetoxo oa1la e u ols0tetr(r3iu4omt licil(fs2rr( o;o1ole  fctyslsDrm(vp t4 ltrxrctytfat auvo s0t2urxmpno1ome  iet t aDtaur ;o4aptniiciatfm rl(mp;() lxoioctydla rln ol()tetoxo3nydlp e fvtlsf Drru o;u1aptoif3tyt sDrlu s;u) exrxr tadoaDe i sls) 2tm(o3nudale  fcs t) 2raum no1opxo fctyd m ulump ()trerxrcoo1fm e uvs ()setoxr3ny1om emiviasfsDtrum ou1aptn iciatfs2emuvo t0aetrxfctytfpt livi;(  exoxm oy1lmtn fei t) 2rr(rpno4aptoifetytlmDemump t4aetnmoctatoa   uvo;s t2xm(opiu4ap elnvta(fs2ua( o;t4tptnii3iadfmDelnmpnt)alxnir3iadomDraivi;t0 2xmxr iy1llt  ncsl(  Drmu  ou4tptomf3tatla rlu s ()texnmo3tatlmtrai o s trurxmpoydapeelfeta(  rrax p;u4openifeiyslm2umnvo;u) rermf ty1fmtrli s;(0srum(opiy1lmtemivslt)srrrumpnt0teeoio3tytla2rau pnt0 rtrif3oodopteaneil(  rum(r iu1optnlivt tfsDtaum ;u0aleoiociasls ra(vp u4 rxnxo3oo1fp rlnvs s  rumxm3oydome lies sfs2rr(rpou1apt iietytlm2emuvs;t)trtoxf oy1fpteaieols)tetmxo3no1am  mnetl( s2trxm ;t1aee iieiyt mDeanvpnu0tetnmrcoo1lmteluei () euo(opoo1lm nlfcil()aDur(rono0apeoio3iyd sDrln s (4teeomrcoadomteai slt)srtrxopnudope  ics tfaDrrur ;t1alx mfeiatfa2rlnvs;()aeeomocootlm   nesls0setoxm3nodal nmieia( arrruroot4teto oetadfs2el(vpnt0 reomfcio1lm e ues (0 2trio ou1al   ics s sDrm(r ou1oltoiocild m2elu o;u0trtrmo oodopD ai s s0s2toxm3oo1amt mfetltfaruax ono0olt ifcildls2ulnmpnt0tetoxf3iodlate nvs s)trtmiopnodomeemiet tf rra(m nu4tle  feiytfaDeluvs;u4aetoiocoytlptrlnei;t trtrio oydole lfcs sfsDrr(mpno0olxn fciad mDeau onu0 ltrio iydfpteluvilt0truo(rpou4lpenmfviatfarrauroou0tpxnioeias mDemnvp;u0alxoif ia1laDe nvslt teuoxopoo1amte nctatfsrta(rpou4oee  feiysfsDua(vo;()trtoxf iatfmD lueo;s)s2xo(m3oudalee net tfsDurur oo1tet  ictld mDulu s;(4texrxf3iotfateai il(0teurimpny1ll nmfei t) 2urum nu0oleo f3tadlm2uanmo (4 lxnmf io1lp   ivsl(  2uo(m io1lp e fvta()arraxmp;o0ale ioeilsls ra( ont0 etrxrcoodla  lueils) 2tmxopno4al emnvsas a2ra(  ;u4aex  ociasla2umuvp ()trermoctotomDelu o;s tetoxm ny4lpt  icils)a2rru  no4olx  ictls s2umumo t4arxrmf oydoaD  uei s  2tmxr3oydlptemfet tfsrrmu  nt1alxn o3tadfsDul( snu4tlerif oatopt aivi;t t2tmxopio4op  mfes ( s2rm(roou0oex ii3iys m2ra(mp ()aeermo iatfm rlnvo s  rxm(r iodomtemnei (  Dtmxmp;u1tex  f3tat s2el(mp u0trtoioctatom rluei t0sexoirpou4amenlfci () 2um(rpnu1apto ietldls ra(ms;u4aexomocia1lp ran i s0srxo(o oudolt mncs sf Dumx poo4tpeomieiad m2ra(mpnu4altoif oodfmDrlneilt0sruo(m3nodlmtnlictl(  2uau p;u4oexnmfciltfm2ran p t)aetomfcoy1fmD aies t trur(opio1ll elfetltf 2uaumpou4apxnioeiltfs rmump (0alxrxf oatfptrlu slt)teuoxrpoy4lp emfcta()aDumur nu4oltoii3tldfm2ra( s t0aeerif to1lp e neils s2xr(rpoo1amtemneta(f 2ua( p;u1aptnii3iyt mDrmnmp u)tltomrciy1omD li o;(0srxoxr3nudope  ncias)sruru pou4aet iieiasfmDemn p;(4treomo3oytlmteliei;t  rtr(o oo4am n ncia( arrmx pnt4oexomiciasfa2emnmp;()artoircoy1lmtrlivsl( s2xrxm3oy4lmte nes tf 2rru pot0alx ioeiyd mDumuvs ()aexrxo oy1opDeanvs (0trtrxrpiu1ole mfeiasfsDta(m ;t4ale ifciadfmDelnmsn()arxrxocoodlaDrlues;(0 rxm(rpnydol   ncsat) rraurpnu1alx mfcilt sDeanmsnu4 rtnxo3ty1omDe ueo (0 2urxopoodaptemfvs t srtaur oo0tlen octld aDean p u)altrifciydomDeai s;t)s2umirpny1omt miviasfs2umxrpno0tltoioeild s emuvp (0aleoircootfmDrln o s)sruoxrpio4omen ici ()sDrrxm ;o1oltn f3tad a2emnmsnu)aetoif3tadfp  ai ilt) 2xmxrpnu1opeemnvtls sDtrur ;o0tex iiciytlm2umu p;t)tltrmf3oatfpteanei;(0 2tm(m ny1oleemfcsl( s2tmurpnt0tleniietld a ra(von(0artoircoo1opD luei;s  rxmirpno1opt  ivias sDuaurpoo0tet ii3iydlm2ul(vp t)arerif tydlpDran olt  rxoxrpiu4op  mfes ()aruau  oo0olx if3ilsfa el( p;(0texnmrctodlatr neo t t2tmir oydaptnlfciatf rrrxm ;o4tpxoii3iydfs uln sn() ltrifcio1omteaueol(  exmio3iu4llenmics tfs2rmx ont4tpt  ieiytfs2rm(msnt4tlerxo3iadomDeai ils)texrxr3iy1opt  feil(fsDua(m no1aee  o3iad a2ulnvp;t)trxrxo tatfp   ivs s) rxm(r3oodopenlneta()sDrmxmp;o1tpxnmfetaslm ra( p u)aetrmo3oadoa elnes;t0s2xmxo oudop  mivtl(faDtm( pnu0tet ifeiytfaDrl(von(0 eenxo io1oaDelnvs () rtoxm3iudll e fcta(  Drm(ronu1texn f3iytfa raums;(4tleomrcootfmtr ies t0 rtrxm3oudal elfcslt)sDrrxr ;t4olx io3iysfa2ua(vs u0artrxoctytop elnvs s0s2uoxr iydol   ieiltf Dtmxrpno0openmo3ilsfaDulnmon()alxoir oa1lpte ivo t setr(mpoy1lm n ncslt  2uau o;t1alxn feilslmDel(mo;t4texoif oy1oaD aieil(  exrxm3oodopt mfetlsfa2rm(rpot4apxo fcilslmDul(mo (4altomoctydfmt lnvi;()s2toirpiodlmtn nesls a2rrurpnu0tetoifciytfa2uanvs;t4trerifctotomD anei (0s2umim3ny4lme livsa( aDra(rpnu1ole  ieilt m umnvo;(4 rtnmo3oa1lmDe i sl()t2umxr nu4amte feia(fsrtr(mpnu4olt mf3tys m2umnvsn() rtrxf tadfat aies;s)sexrxr3oy1lptnmneia( aDra( oot0oet ifcils sDem(mo ()tleoifciodlptrlieil() rum(m3ny4al  licsasf 2rmuroot4tlen i3iaslmDraumsn() eerir3ta1faD lnes ()setrir3oydlpeelics tfsrurx  nu0ape  o3ils mDelnvsnt)treomrctatlaD aivs t srumio oodlmenmfvils) Dtrxmonu4oexomfcilsfm2umu sn(4altoircto1lm  livo (  2toim3oy4aptnlfcta(  2trxmp;t1olenif3ilt m umnmo;()aeeomrciodla   ivol()sruo(m oo1ap  mnvs t  Dra(mooo4tptomoetysfs eanmo;t)tleoxr3totfp e nvo t0sexmxm nodamte ncsa(f Durumo;t1oltnmi3taslmDeluvpnu4 rxniociodfa rln o;(  rtoimpiy1lpte ics ()aDrrxr ou1tlxoiicildlm ul(vsnu)arxrxo3tydoa eli o;s s2uoxmpio1lp  lfvtat  rtru p;o1tlxnio3ildfaDra(von(0arxrxr ty1fmDr i s;()s2xrir3oo4aptnlnesa() rtm(r ;t0tpxo oeiyd s2rm( o;u)arenmr3ta1lptrlu o;( tetrir3oodolte nct ( srtrur ;o1teto i3ild m2rmn pn(4 lenxf3ty1lmDrln i s) 2xoxm3no1alt mnvils)aDra( p;t0opeo fctlslsDuluvo;(0altrmf oa1omt lnvs t0 2umio3iu4aptemnvt ()a2trurpot4aexo f3iasfm2ran p u4 renif tadfaDe u s s) rum(o oudlpe lfctas) Drau  nu1oltomoeild sDel(ms;t0 exnir3oydlaD  i o t  2urxo oy4aptn fci s)a2ururooo0tpeo fetytlmDrmnms t0trtnmrcoatfaDr n i s0 2trim iu1ap   fvsasfsDua(  nt0ope mieiysfm rmnvont0texoxociytfp elnvo;( teur(opiudol elnetltfsDuru pnu0oeeomo3tysls2ean sn()altoxrcootfat aivo s)s2toimpiu4op nmieta()aruax  no0ale  octldfa ua(msn() rxoxo3tydoa  aies t0teumxo3iudol nmfci (f 2rax p;t0tlxo icils s rmnvp;(4trenxf3iotomteai o () 2xrimpoy4lpen icta( a2raxr nt0oee  fctatfmDemn p;t0aexrmf3oo1oa ranvils)srxr(r no1ape mfviat) rua(mont1altnmfciydla2rmnmonu0alxrmr oydoaD  ivs ()srxmir oy1apte ivsls)arrrur ;o1apxoii3tytfa2rm(vs;t4aeeomr3oodop elu sl(0 rxoxr ny1amenmfctls)srtax o;u4tpxo feiyt m2ulums t0 eermrcoadoatelnvi;s) etoxo3nu1omeelivs s)artmurpno4oex iietat s2ea( pn(0 ltnmrctotfpDr n s ()sexrxrpio1am nmiciat  rumxro;u1tlt mieiat m2rl(ms;t4texnir3tydfaDr iei ()texm(m nudlme  fcs sf Dtrurpnu4ale mi3tatfa um(vo;t0teerxfcootoa ranvs t0t2umimpnydolte nesa()artaumont1apx iieiltfmDemnvpn(0tleoxo iodoa e u o s teur(o nu4opeelictas arurum nu0tlx mociyslaDeaumo;(4areomociydfpDrlivi;()setm(o iydlp e ict (fa2raur ;u4teto f3tys a rln pnt0alxoir io1omDeai i;(  etm(o iy4optnlnvsa() rraxrpoo4olxoioctyt s2ra( s;()arxrmo3oa1fpteluvilt srxoxrpiy1olte fcsls s2umx p;u4opt ii3ilt s rau o;t4tlenmf3iy1la rau s;(0texoxm nu1lpe lfvi s)a2ta(r nu0aptnifciys a rm( p () reoxo ta1omDeln o (  2uo(mpoodameemfvi sf ruru  ;t4altoiociydlaDea( onu) ltnmo iatfp   uvi;()srur(m3iydal nlnei s)aDtr(mooo4aeto o3ilt aDem(monu0texnmr3oa1lp rauvols) 2uoiopny4ape mncilt) 2rr(  ou1teenmoeiadfs2rlu snt) rtnxocoatomteauvi;( trumxo oo4lpen ivs ( arta(mooo1aetnioctaslmDum(vpn()texnif iadlateaies;(  2toirpio4ap  mivta()a2rru p;t1tpeniicildlm2rluvp (4tlxrxocoa1oat  n s;s0tetmxmpny1oleelicslt  Drmxmpoo4alxomo3iytla2ua(mo u)artrmo tydlat  ivsls) exm(o no4ll nmfvslt) Drmx  nt4tlx  ictydls em( pnu4aetrxrcoo1fat au s;t)s2uriopoydalt mfcia( srtaxrpoo1oetomociad aDumnmpnt0teeniocootlaDrau s;s  rxrxm io4lp n icsl(f 2rr(rp;t0tet ioeiadlsDel( o t)arxnio3to1oatrlu s;(0 exmim iydomeemfctat) rrmxmoot1tpx  ieiyt a elnvont4 rxrxr3ootop ranvo;s0 2tmxmpoo1alen nviatfsDumu pot0aetniietldfsDulnvs;()aeenircia1fp  lies;s)trtrxr iudam emnes sfs2rm(mooo0tex moeild s2emu o u) exrxrctadfate ivi;t0teumxrpnudape  nvi tf rraxm ot0opeoiieiytfs eanmpnt0alxomo3iodom  ln s;t0s2uoio3nodll   ivtatf Dtax o;t1optomoeildfs elnvpn(4 ltomfctydlaDrlu ilt) 2ur(r iydomtemfcs s a2ta( onu4oex ioeiydfs rmn o;(0arxrxo ootla r ieo;s0 2xoxo3nodap e nctl( a2taur no0tetnmf3iaslaDuan o;(4 lxrxf3oa1oaDr n olt0 2ur(m ou4omtnmieil()aDrrxr ot4tptnmiciydfaDua(vp;u0aexrxf oy1laD lueo t0 2tm(o3nu1ol   fesasfs2ra(mpou4tee  ieilsls ulnmo;t4trtrmrcoa1lmtelivo;s) rxr(o3iydaptnmfeta(f rtm( ont1aet  f3iyd m2rmnmo;u) exrio oo1omteauvs t) exrim3iydlpen nesls) 2ra(mono4oee  o3tls m rlnmpnt0trtnmrciytlaD aneo;t0srxrxo3ou1aptelnvsls)sDrrx  ;o0tex  f3iytfa ua(vo ()aeermr totop e i s;t0texriopoodom e neilt srtrxmoot4opxnii3iyt aDea(von(0 eenxo3oatoa e u s t  exm(o3io1opte nvta()a2rr( pno1tlx mfeildls2ea(ms;(0 rtnircta1fa r ueilt  2um(m io1apeemieiasfsDrau onu4oltomf3tlslaDemnmo;u0arxnmfcoatopD aivo t0 etmxo no1omteliesl( sDrr(mo;u4olxn ociatfaDean snt)aetnio ootlateaueo t0trto(mpiy4ol elics t)a2tau o;u1oetnmo3tyd a emu s;u0trermf3iodfmt  u ols)texmim3nu4alenmfci tfsDtaum ;o4apeomf3ils m2emumon(4 etnmr3oy1opteauesls trxmxmpiy1amtn nvs s  2umump;o1teen fetatlsDra( s;(4trxrmf oo1omD  n il()trxrxr3no4ope lfvil(fsDuaxro;u0tle ifctltlaDrl( pn(4trtrif todopDr ivs s trtm(r3oydlmte ncsl()srur(moot1altn ociltla um(vs u0 lenxf3todfpt  n o (0texm(mpoydlm emnetls)a2taxrpot1alx ioetldlmDelnmsn()treoxrctytlp eai ol( srumxrpiy1lm  lfciat  rra(  ;t1aptnmociat s2rlump;t) leoxr3ta1opDelnei t  ruoxopoo1lm emfctl()s2ur(ro;o0oet mictyt s rl( p;t)tltrif3oo1lpD livo;t sruoimpou1olee ieiatf rrruront4texo fciad s2ranvs;()alxoio3tatopDeaivs ( sruoxr3ny4lmtnlnvi t)aDumxrpno0ale if3tls a2emnvo u)trxnircoadomte iei;s)teuoxo3io4lpenmiet sf 2tm( p;u0altnmfctasfs2em( pnu) exrio3iydomteaivi s)seuo(rpiodlmeelfctas)aruaumo;t0tleo iciatlaDumn s (0aexrxocoo1oa eln olt)t2uoiopoy4lpt mivsl( srtr( pno4tpen f3tatfs umnvpn(4 renir3oadfpDraneolt0 etm(opnodol  lici (fsDururono4olen ictadfs2rl( p;() exoifcoydfpDe nvsls0t2umiopoy1ape  fciat)s2rmx pot0teenifciad a umnvo;u0altomr oadfatr n o;t  euoxrpoy1lpen icsl()artm(ro;o0tex  i3iysfs2ranvo t0 renio iotomD aivo;t0 exo(o oudlpen fvta()s2tm(mpoo0teen fciadfmDea(vpnt) rtnmf3oa1fm rlivs;()setrim3nydalt mfesl(  rrm(mont0ole moeiydfm2ranmp t4tlxoir to1laDeluvi s seurxo iu1am  licia( arta(m no0tltoio3tltfs rm( p;t4arerxf3oydfm  aiei;()t2umio ny1omt livtlt a2rm(moot1opxnmo3ildfaDumn p u)texnif3ta1lmtelu o s0texrxm3nydapt  neslt) 2ur(rp;u0tltoii3iad m2rlumpnu)aeerxocoatlpD  uvs ()texrio no4am n fei tf Dta(mpoo4tpe moctlt m2elumsn(0trxoiociadfmt  nes;s s2xoir iy1om   nei ()aruauro;o1optnmoeiat a ea( p;u4 eerxr3tatomtrln s;(  2xoio3oudll nmnet () rtrxrpnt4tlenii3iasfs um(vsn(0trxrmo3totfmt aiei ( s2umiopoy1llen ivil(fartmxm ot0tlenmicild a eauvpnu0tlxoirciy1opD  ueo;s)sruoxm oydolenlfviat a2umxmpoo0olt ifctatfs2ul(vpn(4 leoircoodfa  auei ( trtr(r oodapeelicia()srrm(  ;o1aex  fcild s ea( ont4texrxr ty1fmtrli olt) rur(o3oo4optnmiesas  Dtrx  ;u4texoifeilsla2rlnvpnu)tleoxo oa1fateli o s) rxmxm iy1llt  ies (faDur(mpou0aetn o3iltlmDrm( s;u4 rtoxo3ty1fm rluvi s)s2to(m iy1om n fcsl()artr(roou1tleoifciad sDuanvont)treoxocto1fmt  u s;s trxr(opiudomee nvta(fs2uaxro;o0tleniictaslsDelu o;t0alxrxf3iatlmt lnvs (  rum(rpno4ap n fci sfs2trxm nu0opeoioeildlm2emuvp;()trxoifcio1fmD lnvo s  rxrxopou4omt lfci ( srrm( pot0altomfetlt m ulums;u0arxrifciy1faDean ilt0 ruoxrpoodamt  nei s sDurxrp;o1oetnmfciysfmDemu s (0 exomo iytfatr i ol( texoim3no4ap emietlt  rurx poo0tlx  oeiysfm ulumpnu)aetrxr3oatlmteluvo s0srto(rpoodom e iviat) Dumx p;u0tlen iciydfm2ua( p u4trermr iy1lpDranesl(  exrxrpnodapt lnctlt)a2umump;o4tptomocilsfsDeanvpn(0texoxociotopD lnvs s) euoirpny1amee fvtatfs2uau  ;u4aet ioetys s2ulu o;t4 etoxf totlpDr iesls0 rtmio no1ope lfvs tf rra(  ou4oet  oeiytlmDrm(monu0 exoir iatlmteluvslt  exr(m iy1op  livtasfartmxmp;t1olxoioeiadla umuvp u0 leomo3tadlaDe u ol() eum(m io1al e fctl(fartmur ;t4olt mo3iltla2uauvp;()trxomocoatom   ivs;()teurirpoy1lmen iesls)sDtrurono4teto oetysla2ua(mpnu)aeenxf3oo1lm rai ils)tetmim3no4ap e fcils aDtax  ;t4tltn ociad mDemnmo u0 lxnxf iydoa e nvo;( s2xrimpiydlm emncias s2taxr no0oexoifciasfa elumo;u0aetoif3tytoaDranvs;(0seumio3io1al nlivils  Dta(moou0opt mfeiad sDemu p t)alenir3oodfpDranvi (0 etrimpiodamenlnvi ( aDtrxmo;u4tpxniociyd a el( s;u4aeenio3oo1lptraieo;s  exm(o oudll nmics ( s2taurpnt0tetn icilsfm2rlnms u4aleomr3to1fmDrlneo;t0seuo(r nu4openlfctl( srurum ;u0tptn ieilt s2rlnvs t4trtnxf3tydom r n ol()s2uoxr oy4ap n nviasf ruaxmp;u4oexn fctys sDem( s (4aeerifciadomt lnvi;t0 etoxo3io1ap elfcsatfarum( p;u1ope iictld sDrlumpnu4artnmrcio1oatrlieils)t2tr(r oydape lneslsfs2um(r ;o4oetn ociytlm el( o;t)altrio3iadlmt ai s;s)seuoirpoudap  mivs s  Dtrxrpno1tlxomoctasfs rl(vo (0 rxniocoydfmt luei;s0 2xo(mpnu4amen fvsltf ruaxrono0tlxn fcildfsDemump;(0 rtnmrcoatomt ln o ()trto(opiy4apee neiatfa2ua(rp;u0alx mfciyt m2rmump u4aexoxo oo1lm  lies t0setm(opoo1om elieilt srtax ont4apx mfeiadfsDrauvs;u)alxnxr oydopteauvo () rxrio3iu4ome lnctl( srraxrpoo1tlt  i3iytla2el(vp;u4arerxfcty1lm  aneol() 2uoirpoo4ll emnes (farrrxroou4teeo ieiyd sDraumo t4aeenxr iadom  li o;( s2to(o3iudopee nvslt)srrau pnu4aex mfctys s eanvsnu4tltnmo iydla r u i (0 etr(o3oy4amtn ncsatf rtrxm no4tex  fctatlsDrmnmo () ltoxo3iy1fpt  nvils setm(o3nodamee ieiltf rtmur oo4oleo oetydls uaump;t0areniocoadfpte uei t)sruo(o iodlpenlnvt (f rtau o;u4alxnifctadfa el(vp t) rtnio iatla elivi t) euoxm3iy1ll  mfci ()aDuau  ;u4altoiociytfaDumu pnt) eermr3oodom r u i;()s2xm(mpoy1om emfcsat)arrau  ;t0tlx mo3iysfs uaumsn() eerxr ty1lp e uvo t  2uoxo3nu4opt  fctas) Dtrxmont1oeeoifctldfs ul( p;t4altoxr ty1lm eaieo s srumimpoy1ol nlnvt tf rra(mo;u0opx moctytlsDuau p t0tltrir3oydfmDraneo;t) 2xrxm nu4amtn nesas arur(r nt0ope mieils aDrlnms;()tltoxr3ty1fpt  uvols0 rtm(rpnodomenlietlt  Dur( poo4aetnmoctldfaDrlumpnu) ltnif oatfm e n ol()sexo(mpnu1lmenlfvi s sDtmx p;u4tlt mf3taslm2eluvs;(0aeenmo3iodop r nvi;t0 2um(o ou4lme mict s aDraxmonu1texoif3tltfs2umnms;u0artnxr oydfmD an ilt  2xr(r iu1ol n fcs (fa2rmu o;u4aetnif3iatfaDea(vsnt4tetrif3oy1oat luesl(0 rxoxopoo1aptnmietl(fs2rrx  nu1tetn ociltfa2elums u)tetnmr3iytfatean sl(0trurio oo4lle  ivi sfsrtaxronu0altn oeiasfs uluvsn() lxnxo oadomDr i ols  exr(rpou4amen nvs t)a2rmu pnu1aeen i3iydfs2rlnmp t)aexomf tydlmD li ilt)teuoirpou4lltnmfci t  rtrxr ot1olxoifciys m ua( ont4teerxo iodoatranvols0teumxr oydapt licsl(  2raur nu0teen oeildfaDrmuvo () lxomo iodfa  lueo;( seur(o io1omtn iet tf Dum(  ou0oexnmoctltlsDumn s;u0 etoxo3todfmtelu sls0 exrxo3oo4al elncs (farum( o;u4oeeo feiyt a2rmnmp t0arerifctatoptrau o s0srumxr3iodame lncta(fsDrrxront1aeenio3tasfa2emumont4 rtrir3tatlp  livo;t)s2urxo3iydol  mnvsa( a2rau onu0aee  octld mDea(vo;t4trtriocta1oaDeluvo;s0s2uoxr3nudlm elnvias srumxront1oetniietyd m um( s (0trerircoo1opt livo;t0t2uo(rpoydap e icilt)a2tmu oot1apxnmicils sDeaumo ()trenxr oatfmte u i;t)s2uo(m3no4alt lncilsf rra(  no4oet  ocildfaDem( p u4aetomfctydfp  luvs s0s2urxmpiodoptnmfvilt)srrmum no4alto fctytls ea(mo;(4tlxnxo iatfmtranes;t0t2uoxrpny1omenlfvtltf 2umu pno1olt ioctadlsDulnvp;u0tlxoxocoo1lateluvo;(0trtoxo nudll nmfesltfa2uau pou0apxoiociys m uluvpnt)artoio3iodop e ueils0s2to(r iudlpt mnvi ()aDua(ro;o1tptoio3tlt m em(msnu4 renif tydlaDeluvs;() rtmir3oo4openmncil() Dta(r oo4optn ieiysfs2rluvpnt4tltomo tydfaDranei;t  eurimpiydaptnlfeils srurumoot0teto f3ild m2eanvs;()arenxf3to1fp  lnes;t)tetmiopiudlp   fvt sf 2trx o;u4oltn ieiadls2um(vp;()alxoxo iodoat  ieo s) 2urxo3iydlltelivsl( sDtaxr ou0aex  f3iltla2el(mo t4aetnmrcoytfp elnvs;t  2xo(o3nydllt mfeta(fsDtrx pnt0open oeiytla2ea(monu4treoxr iatfp  luvi s srtoir nu4omee fcta(f Dumxm ou4olxn oeildla rm( pnt)teeoif to1laD an il( srxm(mpny4ol emneias  Dumx pnt4oee moetytls rmu pnt0 exnif totfm eanvi;s texrimpny4llen fetls aDrrurpou4oetomo3iltlm2ea(vonu0 lenmo3oytlmDeaivi;s tetmim3iodop nlnctl()aDrr(rpoo1tlx ii3tasfm2rmumpnu0tltrmr3iodlaD  n i t  2tmxo3no4lpte neil()arrmu  nt4alxoif3tytls uanmpnt4 rerio3iytlpteaneo t)s2trxopnydopt lfvsls sDrrum nu0tpe  ictydlmDeaumo ()aetomrctydop rai ol() rtoxm3oo1apen nvslt)s2ur(rpou0apxoioctls mDrluvpnt4 eermfcta1lmteanei (0 rxrir nu4altnmfcils)srrmxmo;u0tlx  f3iatfs2umu ont)tetrirctadlptrli sls)srumxr3oudal  lnvsasfsDumuro;t1tleo o3iyd m2eluvonu4altnmr3oodlmD lnvo;s0trtoxopoy4olenlfciltfaDtm(roou4altn f3iat m2ran p (0 lenxrcoydoaDrluvs () rtrxr oydopeemfvtlt  2rr(  ou1aeto i3tyslmDuanms;u0arermr iotfaDelnvi t) 2xrim3no4alee nciasf 2rr( ono1tpeo octytla2uan o;() rtnio totfpt lieo;(  eum(opoo1optnmivils  2ua(r nu4apeo octaslm2eln s (0aexnifciatla e i il(0teuoirpnodape lfes ()srrru  ;t0aexo iciatfm rl(vs;u)artoxo3todoat  iei t0 2xrir3nydaltnmict ( srtrum nu4ope moctyt mDul( sn(4arxrxf3iatlpD li ols0 2trio3oy1lle  nctl( s2trur oo1tpxn o3iyd sDumnvon(0 etrif iytfa  aueo;s)t2uo(mpiodamtnmneiltfs2rmx pot1tlx  o3iasfsDeanmo;u0altrxocoytlaD luvs;t0 eto(o oy4lle mfesatfa2rr( onu1tpx io3tys aDuanmo;(0tetoxo oydlaDe uvs;s seum(m nydom   nvt t  Dum(m no1apxoif3tytls rmumon()alxrio3oatfp rau o;s0 rtoio iudoltnlfvt s srrmxmo;o0tlt  fetasfa2eauvo (4aleomocoodlptean s;s srum(opoy1opt livs (fsDumx oot0aee mieiytlmDuanmo u0alxniocoodfp rlu il(0 2xm(mpio1amt mivs tfs2rmu oot0ape iietysfm2ra( pnu0 rxoio3ty1opt aies;t)seumxrpno4lptnmfet (farrru ooo1aex ifeiytlaDrm( sn(0tetoxo ta1fa rlnvs;(0trtr(o oo1omeemfcsas a2uax  ot4oet  feiydfa rm(vonu0 ltoiocto1omteln ol()t2tm(o iy4openlfvta(  rrrump;t1texoif3tltla rm(vp;(4 lerxo to1fpDelueol(0s2xoio3iodlme  fvi t) ruaur ou0tlenif3iydlm2ul(mp () reoio3totfm elnvol(0sexoxrpnydal elfeiat) Dumxmpot1oet  ieiltfa2ul( o;u0aleoio oa1omt lnes;t0trxmio3oodale  ieslt  2tmxrp;u4ape ifetaslm2uln s;u0tetnxfcoydfm  auvs;s)trur(r oo4ameemfcs t) 2tru  ;u4optnmfeias m ulnvo;t0tltrmo3ta1fmDelivs t) rxoirpoy4ale lneiatfsrraurp;o4opx ifeiat m2ua(monu0 reoircoatfp elnvo;t  rtrim iy1alee netltfa2um( pot4olxoifciyt mDumnvo t) lermo3ta1fm rluvo (0 rto(rpnudlp nmfvtlt arra(r ;u0tlxnii3iyd aDeln snu4alermr ia1lpte n ilt0sexoir3iodllee nes sfsDumu pou1tptoifeilsls eau sn() lxrxr3to1faDrauvo;t)truoxmpoo1amtn nvil(fa2rr(mpno0oltomf3iyt sDuanvp;t4 rtnirciytom elnvo;(0s2toxopoy1lle  feias arrm( ont4tlt  o3iasfsDemuvo;t0tlenmoctodlmtraueol(0texo(r nudapte ivtas  Drr(  ;o4alx io3iysfsDul( ont0alxnio3todlptelneo s0t2uoir nydll e nvtat) 2ururonu4oex  f3tadfa emu p ()tltrmo3iydlpt li o;s)srtm(o oy1opt  nei ()s2ur(m ot0optoioeiatfaDum( p u)artnifciytfpDr uvils) 2xoio oo4lleelfvsa(fa2ururp;o4oet  o3ilslm rmu p;t) eenxr3io1om eln o;t setoxr io1ol  micsatf 2rrxronu0olxo ietydlm em( p;() exnioctotfp elueo;(  rxrxm3iu1apt  fvsasfsDumx  ot4optomo3tltfs umuvp t0alenmf3totlp e ivs s)t2umio oo4am nlfeil( artmumpno0aptomf3iadlm ul(vp u0tetnmrcio1fmDrli i ( t2uo(o nu1lle livt (f Dtrumooo1aex moeiatfm2ea(vp t)aetoxr ia1oat  uvo (0seuo(opiu4lptnmiciat artrurono1ole mfeildlmDrmuvpn(4arxomo3iodlmDeau i ( trtriopio1ap   ict t  Drru p;u1oleomf3ils a2ran onu0aexrxr3iodlpt  ivi t seuo(o3iy4aptnmies ()sruau p;o1tptnmociatfaDul(msnt4 lermociodoaDeanvi;(  rxmxopnodllenmieil( arrru p;o0tptoiiciasfm ra( onu0trenxocty1lpD  n ols sruo(r ny1ll nlncsasfs2urxm nt4aptoifeiyslm ulnvs t)trxrio3oadomtr ieo;s s2trir io4olenmfvtat)s2trurpou1oex mi3ildla2um( p;u0trxnmo3oy1oatelivo;s0 euoio3oydalt  fcslt) rtauront1tpe ii3iad m em(mpnu4 lerif3oa1oa rli i;s t2urxo oodameelfctl()sDua( poo1tetnmocilsfa2rmu ont4aeenir iadomDe i s (0trxm(r3iodom  mivs (  rrr(m ;o0aetomoetadfa ea(vp u) eerxo3oadfa eln ilt srtr(rpio1aptemivsl( sDur(r ;o0tltnmiciyd mDrau p;() rerxfctytlpte nvs;t s2trir ou4ale lnvils)arumuront0aexo i3ilt s ran p;(0aleoxf iatfpDranvo (  2uoxm3nydal elnesa() 2rmx  ;u1tpx  fctlsfm el(mo u) rxnxr iytfaDrlivi t)tetrirpou1ll  mnvtl() Dumxm ou0ape ifcildlmDumuvp t)tltomf iadfaD aueil( trxr(r nodol emfesl(fsDtmum ;u0aexnmfeiyt sDuaumo;u4texoio3ta1op eai i ( trxoir3nu4lp e ivi ( aDrrx pot0alxomo3iad sDrln s u) ltoio ia1lmD  uei s seur(m3iu1ap e nesas srtrurpno4aetn i3ias m2ul( o t) lermf3to1laD lnvi s)trtmxrpnydole  nei tfaruaur ot4opt iocilsfs rl(vo (0 lxnif ta1faDrln s;() rxo(m no4am elncsas)arrrxr nu0altnifciatfaDra( p;(4aexnxo tytoa  aivs s0 2xr(o3oodoptn fci t sDuau  nt0tlx  o3iadfaDuluvs;()altoir oo1lmtr ues;t) rtmir nudame lict s)s2ur( pnt1oex mf3iysfm2rmnvp (4tlxnxf oo1lat aues;s)trtoir3ny1altnmfcias)sDra(  ;u0ole iietltla2ua( pnu)teenxr3totfptelivi;s0teto(r3iy1lme mnct ( arrmx o;o1tpt ii3iydlsDelnms t4trtnmo3oo1opD lnesls)setmxrpnydolenlivia(fs2ur(rpou4altomoeiyd m2uanvs t4altnmfcoy1faD  nvs t0t2tmim iy4lmt mnet t srtaxrooo0tpeo fcias m uauvo;(0trxnxr ootfp  anvo;s sruoxm oydll  livt s)s2urx o;o0ole  o3iad sDrmn s u0 exnirciydoa  lu olt  2urxm3oy4ll n ies sfsDurur nt4tleomfciydla eluvo;t0 rxnxo3to1lpDeanei s tetrio iydale  fcias)aDrrurpou1tpeomoeiys a rlnvsn(4arxoif oodfpt lu s;s0tetoxo3iy1llt mfci s  rra(  ot4tpxo ociat a umnms t)altrxr3iadlmt lueo t  rxo(m nydopenlivsls  2ur(moou0tptomietatlsDelu snt0tetoxrcia1oa eli s t0 euoxo3iydal   feslsf 2rr(  ;t4tlx  ociltfs uanms (0 exoio oatoptr ies;t)sexoim3oodomee fvi t)a2tr(mpnt1aeenmfciasla2rau o u0alxrxr iadoaDe uei s0 etrir3iy4lme lnvsa(fsrraxrpnt4olt  icilt a2umnms;u0 etrif oy1lmDrlieo ( texmirpoy4oltnlieslsf Dtruront0tptn ociltlm2rlums t0 rxrir tadfm rli i () rumxr3ny4omte fei () Dururpoo1apxomo3tatfa2ul(mp;()trxnmr ia1opteli s;(0trto(opiu4llt  fctltfsrrax  ;o1oetomi3tlsfs ua( o t)aleoxrctadlmDran i;t teumim3ou1ll  mnct (faDrru pnt0ole iietlslm2rl(vs t0alermo3ta1omtrluvsls) euo(opoudlme lfvsl()s2tauro;o0tetnmi3iysfs2ea(msnu4aexomrcoodop  anes (0truoxm nudlle  ics sfaDtrx o;t4aeeoiociydfaDeln onu4 rtrxocoatfpteaies (0 eto(m3oy1lltn iviat)srurxmp;o1opx  o3iytls2eauvo;t)trtnxr ty1fm  an i;s srtmiopio4apenlnetl()sDur( poo1ope ioctadfm2rl(mo;t) rtoxf oodfpte u i;()srur(mpou4al n ivsl(faDtr(mpou4tpe ifctysla2ul(mo u4teenir tadla r i ols0s2xoxm oydop   neia()srum(m nt0tlto f3iydfm ra( p (4tlxoxocoodoa eluvs;t)trtmiopny1ap elieiat a2rmxm ;o1tleomi3tad a uauvp ()trenircio1fateauvi s  rum(rpny4llen ivi t)sDrr(  ;o1oetnifeils s2rm(mo;u0aetrxf3iydopDe uvols) rtr(r3iy1lmtnmnet t)sDrr(  ;o0tlen ictys aDemnmo (0trerif3io1op  an o ( sexmiopnydaltnlivils)srtau oou1aeto ictysls2rauvont) exrmfciodopDrauvil(0trumimpno4aptnlicsasf 2rrur no0olt  iciysfs2eln on()arxrir3to1oatraieslt  etrir3no1al elfcils)arumumo;o1tet mociys s emump t) etrirciydop e ivo t s2to(r iudope lnciasfs2ua(mpoo4oeen ociyslm em(vs (0tleomf oydfm raivols0texm(m3oodapee icia( s2rax  ;t4ape io3tlsla rmn s u0arenmr3oydopD ln o;s)t2xo(o3iu4lleemnvi s aDtrump;o1alxo iciatlaDrmnms;(0alerio oodopD  nvi s srtrxrpny1ap n fesl( aDta( onu4alxo oetytfs2um( snt0trermociatfaDrau ilt t2urxopiu4opeemnesatf 2tru poo1ole  ietydlaDeanvs;u4aetoif oadlpt  ivsl()srxr(r3iudlm emieilsfaDtaxrpoo1aptnif3tytls2uau s (0trenio oytopDraivo;(0t2tr(rpny1lmt  neiat) rtmur no4aetniicild a2rmu p u4aleoif oydlm e ivils setmim oudam emnvsa( a2trurp;u0ape  icils s em( p;u0tltnmo3to1lm  ln ol() euoimpiydlltnlnvta()s2urxm ;u0tet mieiat a2emuvs;u0arenmo todomte ies;s) eumirpou1lmt mncsl(farrr(  nt4openioetltls2ranvpn(0aetrxr totomteaivi;s0 rxo(r3iudoleelict tfsDtrum ot1apxo ietlsfs ranmo;t0alxomfciodoaDeauvs t) 2xo(mpoo1opee neia(fsDraxm nt4ape mf3iadfm rmuvp;(4 eenmrciytomtr u i;s0trxr(m iudll  mieslt s2rrumpou4oltnmf3iydfm uanvpnu4tltomo iodomteaies s0seum(m3iu4op nlnetat) ruaxroou4oexnmictyslaDua( o;(4tetrxf todlmtelivi;s0s2tmxo nydal nlnesa(f Dtrx oou4apxomieilslaDuauvs;t)aeeoio3totfmDrlies (0trumim3ny4lpe mfvtl()aDtru ooo0alxo ictyt a emnvs (4alerir oadfp  lneo s)t2xmxm nudamt mfvsl() Dtm(rp;u0aexnmi3iydfsDul(mo;(4trtrxo iatlat lues;(  eumxm nudomtnlnvi tf Dta(mpot4ope mi3iaslm ul(vs (4 eerif3ootlat  ivo ( srumxr io1apeemneias srrrxmo;t0tlx mf3iytfa2ul(vo;t0trerifctytoa   ieo (0t2xrxm3iodalt  nesasfa2trxro;u1tpx  ictys sDulump t)aleomf oytfp  lnvo;t t2tmimpoy4omee ictlt artrx oou0aleo fetltlm em(mo () lxrmr3oodfptelnvils0 2trxm3ny1alenmivsa()a2rax pnu1aeenioeiltfaDemn p u)tleoirctatlat lnvo;( srtoxmpny4op nmfetat  Durxr no1tlxoioctlt a emuvon()altrio to1la  lueo s  eum(mpiydol  lici t) rumxr ;u4apeoioctytfsDemnms t)trtnmf3iadopt aneils)teurxo3ny1amenmnesasfs2uru poo4oexn fcias aDrlnmo u0trtoxr io1lm   ueol( srtrxr oudlmtelivi tfa2tm(rpnu4oet iociltfsDeanmo;u)tltnio3oatlaDran o s srxoir oo1lm  mfvta() rtru  no0tptomi3tltfm ul(ms;t4texrxo3tatfate n ol()sexr(opoodolen nes (fartau oot1oexomociatfs eau s t) lerxo to1lmteli i (0teumirpoy4om elfei s) rtr(rp;o0open i3tldfm uanvs;u4artnmr todomt  i sl(0s2urxr3ny1lle lnct s)s2umurpnt1oltn ieiydfs2elnvs;u) reoxocoy1fmtrln i ()t2xmio io4lpeemfetl(fa2tax  oo4texo o3tlslaDrlnvo;t)trerxf ty1laD ln ilt) exo(r no4alen nctls s2rm(rooo0tle mfetltls ulu on(4 lenxfcia1opDeauesl(0tetrir3nudom nmivtltfa2ur(m ;u1aexnmieils a ul(vo u0artoxr todlaDrluvo;()teurir3iy4op nmfetlsfsDrmxro;t0tlto f3tat sDean pnu4 ltrmf3totfaD  ueilt)trurxm3oudap emnctlt srta(mp;o1teenii3tasla em(vo u0tlenio3iydla rluvils)srtoirpnudalt mivilsfarrmxrp;o1tpxomociltfs uluvp;()arerxf iytlaD au s;( texo(mpoo1apt lfeta()aDuaumoot4apxnmo3iatlmDel(vo u0texrxo iotoptr uvi t0seto(m3nudlmtnlfvil(fa2urum ou4apenmieiytlaDuanmsn(4arxrmf3oa1fm r i s;s)s2ur(r nydlp elfvias) Drau oou1tlxomoeild aDumu ont)aetomo tatlmD  uvi;s0t2uo(m3iy4amenmfcsl( a2rrxr ot4ape  fciltfsDuluvpn(4alenxfcootlmDeli olt0 eumxo3oudlp emfei t  2rmxmo;t1aptomo3iydls emnvpnu0texoir iydfp eliesl()srur(m iydlleelfesl(fa2urum ;o1aex  iciaslaDrl( sn(0teenxo ta1oatrai o;s0 exmimpno4lpte feil( srrr( ono4tltoiiciaslm eln s;t0arxnmo3tadfp  aneol() rum(r iy4ol e ici s artau  ;u1texnioeiys mDua( sn() ltoxocty1lateln i t0trtr(m ou1lpeemnet tfa2trxmpou4tet if3iadfm ra(mo (0tltrxr3iodlaDeai o;t)sruoxr3oydalt lfes (fartr(rpnt0oleoiiciytfm um(msnu)trtrioctadopte ueols t2xmxr iy4apenmfei sfarumxmo;u4oetnifcild a ulu p;t0 rtoxociadlpD au sls0trtrxr ou4lmtnlfcsa(fsrrru  oo4oeto i3tyt sDel(vs;u) ltnmrcio1fp eli i;t  2tr(rpny4amenmnes s sruaumpot4oexniicild mDumuvs u0 exoxr ty1oaDean ilt) eurimpio1ol n ncs (  2rrurpou4tetn f3iydfaDuaump u)texnmf3oa1optraueo;( teurxrpiu1op n fci t)a2rrum ou1opt  fetlsfm umuvp t4aeenio3oo1omt  u s;t) 2xo(opoudolen icia()a2trumo;t4aptniieilslm2rauvsnu0teeoxf oatlp eau sls) rxrxm3nydopenlieil(fs2tauroou4alt  o3ias mDumu p;t4 rtrir ia1lmD an ol()trxo(rpoo1lle lictat) 2rr( pot4optnmo3ilsfsDumu o;u0 eerxr3iydoa  ln ilt trurxo ny4omt mfcias srtrxroot1oex mieiydla rmuvo (4treoifcoo1om ean i;(  2xr(o ny4op emfvi (  Dra(moot4olenmfciatfmDelums t) lxrxf3ty1lmDelues t0 eurxr oodame  netas  Drr(r nu1optn feilslm rm(msn(0altomocto1om ranvo;()t2tmxmpoo1optelfet ( sDurxmonu1texoiiciadlsDrlu p;t0teenir3ootlp eli slt0 2to(m3iudameemfvslsf ruau  ;o0oeto fctltfs eau p;()alxoxr3totomDelueols0srurim oy1lme lfei tfa2uau o;o1tet ifcias mDea(mp t) exrmfctodfm elnei;( s2urim3nu4omtemictls sDurxro;u1oeenifetas a rln p u0 exnir oadlpD li o s0setriopoo4op emiet tfsDua( o;o1tpt iictadfs2um( p;t0 exnio oytfp ran slt setmir3nu1op n ivt tfa2tmxm no4texnioeiysfa rmuvsnt0altomo ty1lp rlivo;t  rtr(opnu4olt  ivtat aDrau  ot1tltnii3iat m umumont0 leomf3oy1fm r neolt0trxo(rpny4ole lictl(fs2uauroou0aptnmoetlsfs rlnmp u)tlxoxr iy1fp eauei s)tetoxo iu4alen ieil( srtaxrpou1aee ioeiltfsDrau s t)arerif3oadopt anesls  2xmio3oo1ape lfvi sf 2um( ooo4tleo oetyslsDulums t)tlenmf3ootom  au ilt0 2xm(opnodole  ieilsfa2rm(mont4tle micilslsDeanvo;t)teenxo ty1lmt auvo ( trto(r oo4lltn fei (fs2rr(monu0tetoii3ilsfm2ra(vo;u4trtrmr3oo1omD  i slt)sexm(o3iodaptemieil( sDra(r ot4aee mo3tasfa ul(vo u)alxoxo ootfaDeai i s0s2urxr3nudlm e fvs sfaDumxm ou4aet ioctydfa2elnvp u)teenio iydomteaiei (0srtrxm3ny4ol elfvsls) Dra(r ot1texnif3taslmDrmnmpnu) etnmo oa1oa rli s t)srtrxr3io1omen ictls) Drmx poo1tlxo fctyt s2um( on(0 eerircoydfp r uvi s s2xrxr3io4op emnctl(farurum ot4oeen o3tys aDumu o;(0 exomf3io1faDr uei s) etmiopno4omtnmivi ( a2ra(mpoo1ope ioeils s2eauvsn()aetnxrcoo1fatrlu slt)t2tr(m iy4lmtelfvi t) Drmxrooo4opx if3ildla2el( p;(0 rxnif3oydlmtean il()trtmxmpnudape  nvi s) Durxrp;o4aeen f3iys sDel(vonu)texnir3oadlmDrai ols) eurxm nudop nlicilt)srrmx  nt4tlxoio3tysfs um(mpnt)altoircoadoa rlies s)s2tmir3nydop n neils  Dumu  ou1olx mf3tytlsDua( pn(0 exnxo iotfa  anvs;( seumirpiy1lm n ictls)aDrrx  ou4tlxniociysla2rmu s (0alxomo3todop   nes t0setoirpoydapt mfei ( arrmxmoot4altn o3iltfa2umnvs ()tetoxrcoatom eauvsl(0trumir3iu4ll  lics sf 2rmurpoo0aetn octytfs2em(mpnt)arxnmr3oytfmt aivsl(0teurim ou4om nmici sfaDuax ooo0tpeo octytfs rm(vo;u4alxnmocoytlp eai o;s) eur(o iu4lm  mnctat)srrmump;u0oexnii3tltlsDemump u0teerxrcoytla e ivolt) rtmxmpoo1ll   fetasfsDumumpno4olenifeiadfsDrl(vp;u)trerir3ta1lpDeli o;s0 2xm(opoo1ap  livilt arra(r ot1aetn fciasfs ua( onu4 lxrio3oodla rauesl(0t2uo(rpny1ol   fei s  2ua( ont0aetoiictlslsDem(vsn(0 lxnxr tatfat  u il()trumxm3iu4al nlnvsls  rtmx oot1aee  oeiat mDumuvp u) renxr oytfpD lues;t)s2uoirpiu4op nmnvs (  2ta(r oo0tleoifeiyd s rl(vo (4 lxrmfcoodlm  livol()s2tm(m io4ap nmfctat srtmx ont0oee mf3iydfs rlnvs (0altrifcoytoptrluvs s t2urxo3iy1lm  mfvt s)a2uaum ;o4tetoioeiyslm raump u0arxoxf3todlpDe nvi t sexm(opoydap  lietl( s2ur(m nu0tpenmieiltls rluvonu)arxnir tytop   uvols t2uoxr3ny1llt  ies t arrrxr oo0oetoiociat mDraums;u0 eeomrctatfpDran s;s  etr(m3oy1ap elictl( a2tmu  ;t0tet mfeiat a2uauvonu0trtrirciotopte nei t teur(o3nu4al   fctlsf 2raxrooo4aee mieiadfa2uluvo;(0tlxrir io1lpt  i olt)srxriopiodamtnliei sfa2taxm ;t1aleo feiysfs uluvsn() eenioctatfp r ueolt)teto(mpiudopen fvsas artru ont1optomo3iyslm2elu p t0arxnifctadoat auvo t  etmim3iu1lpe micsat)arrmxmo;u1opxnmo3tas mDua(mp;(4alenxfcootfmt anvi;( sruoxo3iy1amenlivtl() 2rmurp;t0alt mf3iyd mDrm(mp;u0aexrxf iodlatraues;s s2ur(m3iu1lleemnctls)arumu o;u0tle  feilt mDuaumo;t)aetomfcootlateauei;t) rtmxmpoo1lpeemici tfsrumxmoot4oetomociasfs um(ms;u4tetnxrcoadlmDeln s s0 euoxo nudlmteliesa(fartmumoot1tpx mieiasfm el( p t0aetnxr3to1lmDe n il(0s2um(m ny4opee fciatf rtmxmpot4olen i3tatfaDea( onu)tltnmf ta1opD au olt0 rxoim3iudamtn ieslt  Dtau p;t1alxomfciad a2ra(mp;(0arxnmr3ia1oatraueil() exmir3iodalenlnvta(f Dtrx o;o4tpenif3iasla umump (0trtnir iytlm elivo;(  2toirpnu1lm  lfvs (  2tau o;u4apxn i3iaslaDrm( s;t) ltoxo3oydop raueil()t2umio3iy1amtn fvta() 2rm(mp;t1tpe  f3iad s el(msn(0aeermrcoy1fateanvs ( trumiopno4lm e fvil(  2uax  no1oexn ietas s2ranmp;u0 rxnir iodla eau s s)seum(rpny4lpe mfes t) rtax  ;u1apx iiciadfsDrl( onu)alxnxocoodfat an i (0teurxo ou1lp  liei (f rum(rpot1oet if3ilsla2ulnvonu)altnxr3oytla   i o (0s2toim oydllenlnct t  2ua(r ou0ope  ociydfs2rmnvpn(0aexrxrciadlmDrln s t) rumxm ny1olee nct sfsDtrump;o1ale miciys m2um(mpn(0 lxnmrciytlmD  ueolt  exoxr3nudal  licslt  Draxmpnt4aleoioetydfmDrmnvo (0altoxo3iy1fp r n slt)texoirpoodll  micsatfsDumu ont0oee ii3tltlmDuln s;t0aleoio tytlptranei;t0sruoim3nudol  miciasfa2uaxm nu0tlt  ocilt s2eauvp;()aexnif3to1lmt auei;s)trtmxrpnodlpe lietl( s2urxrpnt0olenioetyt s uluvo u) rtnio3iy1lp rln i s0 rxm(m nu4lmtemfei t  2umx  ;u1alxo ieiydfa2elu s u) renmr ia1fm  lnvo;s t2ur(rpio4alt lict () Dum(mooo0tlxo o3tasfs ranmo u4 rtomrciydomtraies;t0t2uo(m no1ll nlivsls a2uaurpou1alxomi3tatlm2eln o t4alxnxrctotop eauvsl()truriopiodal   fcsa()aDtmx p;o1apxo octydlsDemn o;(0aexnifcto1fpt li i;(0 rtmir3nu4lp  lfesl(f 2uau  nu4aleoiietyd sDuan s (0 etrifctatfp e ivs;s0t2umxm ou4lm   ivia()s2rm( ont0aet iietldfaDelump u0alxrxf oydlmtranvs t0 rurir3nudop emiei tfaDuau p;t4alxo ieiltla ua(ms t4tetnio3oy1om r ueo;( setmir ny4ale mieiat a2trx oot1aetnif3iydfm uaump ()artrio ta1opt an s s  etrxr nydolenlnvt ( a2um( o;t1alt micildlm2emu o;t4teerif3io1faDr ivo s  eurxopoudll  mfcsl()a2rmuro;u0tlxomoetydla eluvp t4texnmociy1fpD an i;s0s2tm(m iy1om  lnei sfs2rrumo;o1opx  ociaslmDrmnmo;u0 leoxrcoytfaDr ivi t  exrxopiy1ll  lfetas aDurumont4opto fetytfaDrmn o (4 rtrio iotlm eli o;(0 rxoimpny4lleelncs tfsrtr(r no4tle  i3iytfa umnmo;(4treomf3tadlaDeln s;(  2trimpiudlltnlfcilt s2uaxrp;u4oetn f3iydls2ea(vp u4alxrmocoy1oa rlieilt0t2tr(m oydome lfcilt) Duaxmp;u0texomi3iadfa2ranvp;t)tetoxo3ia1lptean i (0s2xo(rpoy4om  lieilt sDumumpoo4tlenioeiydls2rmnmpnu)alxoio oodlm elnvi;(  exrxm3oy1olt mfvsltfsDtrxrpnu1apxo ieias s elumpnu0aetrmr iotfpDe uvo;t0 eumxm3iu1alen ncil(fs2ra(moot0olxniiciatfs ul( p;u)aetnmf3oadlp raiesl(0teuoxo nu4aleelnvt sfs2rmxro;u1olx  i3iysfa2rmn sn()alxniocoadlaD luesls  2uoxo iydlm n ivilsfs2umxm nt0aeeoiieiadfa2eaums;() rtnmoctytfmD li o;s  rxo(m ny1ape  nci s)s2raum oo1tleo feiltfmDuan o;u)trtoxo3oadla elneo (0t2xoxo oo1ol n net t)srur(ronu1apx iictlsla uanmo;(0 ltrmo3iytlat livils) exoxr iu1ap  livils) 2tmxrpot4oltoiiciasfm2uau snu4artrmo3iatop rluvo ()sruoxr3iy4ll elfeilt)srraump;t0opeo feiydfaDelu sn(0altnxoctadlmD ln o;t0trxm(rpiydam emici t s2ta(  ;o4aleomfctlsls ul( onu)trtoiociydfmDeau i s0 etoxopio1alenmncs (faDtauronu4tpe io3ildlm2rauvo;u0 etrio3ta1omteaiei;s) rtrir3ny4opt liesl(fa2tr(mpnt0apeo ietys mDrln snt0treoif oytlpt lnes;s)seuo(o io1oltnlfcia(f rrm( p;t0tpxoii3iyt m2rl(mp;u0texnir3oytlm rli s;t) rumxmpno1omtnmneta() 2umu pot0alxn ieiyt aDum(vo t)alxrmfcoydla  livolt)setoir iy1olenlneil(faDrru pno1optomocildlmDrm(ms;u4arxnmrcootomDelu i ( s2tmxr ou4ol  lfetatfsDtm(  ;o4opxn ietytfmDrmu s t)teenxr iatfp   n i (0 exoim oudoleemncslsfaDumxro;o0texniocilt s2rau p;t4trtrxf ty1omteauvi;t0tetoxopio1oleelncsa(farur(ro;t0apt  ociys a ulump;u0aeermo3oa1f
\ No newline at end of file
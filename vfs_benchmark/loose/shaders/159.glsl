@@ -0,0 +1 @@
+u o s) rtr(r3oo4amt  icslsfsrtmu  nt0tpxoiociyd s2rmuvp t4 exrxf3iadoatraieo t t2xr(opoo1lptn nvils)artr(rono1oeto f3iys s ran snu4 eeomf tatoaDran s;( seto(rpoy1amt mnes s)aDumu pot4opx ifetydlsDrlump;t0tltoirciadomDe uei (0s2xrirpio4om n ies (fsrumx poo4tpeomo3tad a2ul(vonu4 rtomr iytfm  lies;t)s2tmio ou4lp   ncs ( sDrmur ;o0aetnmfciydfaDrmums ()trtomociadfa e ivo;t  rxoxr3oo4olenliciatfs2umxrp;o1aetnmoetad mDrmn s;t4aetrxf3todlmD  nvi t srxmim iodlp  mnvtl( a2rrxrpnt0tlx  ietad aDrl( o ()alenxrcoytlatelneslt0t2toxrpnydapt  fvtl() 2urur ou0apt mi3tltfs rlums (4aexrircootlpDrlieo s0tetrir3no4ameemietl( s2rrum ;o0olt mfeiltlmDrln s;t4treomf iatfpteluvs;s texo(o oydoltnmnetas) rrmx  ou0alx ioctydfa rauvpn(4 exnmo3iodla  luvo;t srxm(rpio4lm n fvi s) 2ta(  oo4open f3iysfsDulu onu0aeenir3ta1lmtr ieolt0trxr(opoudomeemnvsls sDtm(rpoo0alxomictatls eau p;u0treniocoo1fmtelies;s  exmim3nu1omt  icsatfa2tr(  ;t0aetomo3ild aDrm(msnu)aexnio3ootfptraueilt)tetmirpio1al   fvi ( a2uaxrono0aet mieils mDel( p ()areoif ia1fm rlies t0srtr(rpnydopt  nvslt) Dumurpot4aetomiciydlm eaump;u0texrmf3io1fptrlnes;t)seum(m oudom emicsl(fsrrmxmp;t4olt  fetydla2rmuvo;()artrmf3ia1la eanei;s  2urxrpno1alt mietlt) rta(mpno4aptomieias mDul(ms t)trxoxo iatlp r neo;s srtoxo iodaptelieil(fsrtaur ot1texn oeiltfsDrm( s;u4tetnir tadop rln sls seuo(opiu1llte fetasfsrtax ono4ole ii3tyslaDuanmo;t0 rxomoctytoatranes () exmim iu1lp   nvt t s2taxrp;t0oee ioeiatfm rl(mp u4arerir3oo1lat lu s t0t2xoxopnodom eliei tf 2rru  ;t0oleniocild sDranvo ()tltomr iydfpDr ivs t0 2xmio oo4lptnmivt s  2tmurpoo4alto o3ils m2ul(vp u0texnxfcoodopteaieo (0teum(o3oy1op  lictl(fsrur( onu4tlx mf3tadfsDuln pnu) renif3oo1op rln s t  2xmiopio1ap  lncsls)aDrm(  ;o4olenifcildls2ua( s;u4altnxocoa1fptr nvo;s0srumxo3nu4openmiesltf Duauronu1apxoif3tytfa ul( s t4altnif3ty1fmD lies;t sruoio no4lleelieilt arur(m nt1tlx  fetlsfm2ulnmpn(0arxoircia1fmtraueslt sexr(r3iodal nlfvil(fsrur(rono1tleo feiltlmDrm(ms;(0arxnmociadoat au s s)setoxmpiy4opeemiet s s2rmxrp;t0tpx mocildfaDrluvsnt0artnxo3oa1omt lu i;s0 2toirpoy4lmeelfctltf 2taurpnu0tle  oeiydls2ea(vo u0aeerio3todlatr ueslt0 2um(o oo4ll  micsl(  2rrx oot1oexo i3tydlm2rmuvp;(0aeenmf3iydop rauvs;s s2xo(o3oo4amt mfvt t s2rmu poo0olt  ieiydlaDelnvo;u0aexnirciatla  au i;(0t2uoxm nu1ope  ics (fa2rrur ;o1aeen ieiytlsDran pnt0artrmo3oa1fa rau o;(0texmimpnudom nmicias) Dumur oo1olt if3tldfs2eaump t4tltrxocootopt  uei;t t2um(r3oudop  mneta( aDra( o;u4oltniieiysls rlumo u) rtrio3tydlptrlieo;(0 eto(mpou4lpe mfvslt a2uau  oo1oetnii3tldfs em( s t0trxomocia1fmDe ivs;(0s2xoio nu1lmtnmnvi t sDrru  nu0olxn ociltlm2eauvpnu) eenxf iadlmt  neolt srumxo ny1apee fcsl(  rrm(mpoo1texnmfeiadfa2uanvo ()teerxf3oo1fate iei s  rumxo3nu1llen fvtas)arrrurp;o0teto i3ilsfa2ea(mo u0artomf tadfm eaivi ()s2urimpny4lpeelfcs t)s2ua(  ;u1optnifeilt s rmnvs;t4 rtnio3iadlpDe neo t)srumio no4alt  feiatfaDtr(  nu4alenioeiasla rm(msnu)tlenmr iy1lmD  n i (0t2umxr ny1amen ics t  rurx  ;t0ope iociadfsDrmn s;t) exnio iadfmte neo ( setoxm oy1altnmfvtls a2trxr ;o4oltomfctat aDemnvont)treoio3oytlm   ies;() 2xr(o3oo1ame mnet s  Drrxrpou0tlx if3tltfsDum( p u0 reoxf oydlpD  u sl(0 2xoxrpiy4lpenmnvtat a2umumo;u0tltoifciltfsDeluvs t4tleoiocty1omD li i s  2to(r nydome mnctlt sDur(rpou0texn o3tldfsDel(mo;(4 ltnmrcootfpD lnes s0trtrxr3oodopee fctas)a2rm( pou4altoifctld mDulu p;u0 lenircoatfpD  uvils0s2toio3iydlmen feslsfaDur(ronu4tptn oeilsfa ulnmo ()tetrxrciatlaDeau o t0 2xoir io1lltemictas)s2tr(m nu4ape  i3iadlm2ranmp;u) rxnif iotfptr neo;s sexoim iy1ape lfvsat a2ur(  oo1alenmoetatlm2um(vs;t4aeeomo3oodfmt luvolt)s2xmxrpno1llt livi tf rtmx pou0tlx miciad mDum(msnu)artnmocoadom  ln o;s0trumxrpoo1lmtnlfvsl() rtaur ou0tptoifeiltls uau p;(0 rtrxfcio1om  luvslt) eum(mpny4apt mnvi () 2tr( poo0oltoiietldls eln p;(4aetoif3to1om r i sl(0s2tm(r3ny4altnmfctls  Dtr(mooo1apto iciadlm el(ms;u4tetomfciytfp eli i t tetr(mpoudolt mnvi (fs2uaxr nu4oeeomi3tytlm2ulnms;t4arxoxr3ty1lmDrluei;(  rtm(mpiy4lmtelics (faruau pot4oexoioeilslm2eauvpnu)alermfcto1omt lues;t s2tmxr3iodomee ivi ( aDumxmono1oeenif3iyd s2umnms u)alxrmrcoodoa rauvi s  etrxopno4lp nlfvtat)sDrm(rpoo0tet io3tlt sDumn o;t0 rtnif3oa1lpDe uvil( s2tmio3no4olte ivt s)srraxrpno1ale mfctadfmDrlump u0tleomoctotfaD  nes s)trtr(r3oy4lm nlietl(fsDrm(rp;u4oee ifciyslsDranmsnu4 eerio3iodlp  luei (0sruo(m3oo1lpeemivsa(fs2ur( p;t0texomi3tat a2umuvo;u4 rxomo iotoa ranes ()teuoim3nu4omtemfvtl()s2tmu  ou1apxoiietlt s2eau o (4tlxrmrcoydfm rau i t0 2toxm io1ll emici t  2rrurpnu0aexnioctat a2rm( s;(4alerif3iatfp e ieolt s2xr(mpnu1lp e feias)aDurxmpno1oex  o3iys s2rmnmpn(4arxoif3oytlateli s;s0srxmxr3nu4omt  iesatfaDuaxmo;o1olxomf3ils s2uln p;t0areoirctodlaDrlies;s)seur(opio4opt  nesl()arta(m oo4aleniietyd mDumn o;u)aeenxf3oatopDe neil(0srxo(m oo1al emicsas) 2raxmo;u4optomfctld s2el(vo;u0trxoir todfaDrauvo;(0teur(m iy4optnmfvtas)arur(rpoo0oet  fetyd a umnvsnt4aexoxo3iadoptelivi;t  rumxm3oydame  nvta(faDrrxr no0tlen oeiad sDrauvpnu0texnxo3oy1lpD li i;s  eumio nu4optn fcil()a2rmxrpou0aeeo f3iytfs2uanvp;(4 exrxr3iydom  luvo t0seumxo3iy1ape  ncta( aDrrxront0tpxomfetlsfs elnmp;t0arxoxf3oy1fmDe n s t0sexoxmpoo1om nmicta(f Dua(r nt1tpeoio3iadls uanvonu)aeermo todoat  iei (0trtrir iodame mnvia( srrax pnt1ope  o3tatlmDranvo;t0 lenxocoa1fmD ln o;( truo(rpoydlptemivsat a2trxrpno0teeo oeils s2umnvpn()texnmrcoydlm ean s;s)trxm(o3oo1oltemncsasf rrrxr nt1altn iciyslaDemumpn(0areoif3iytoaD ln i;t t2to(m3nodameelnvi t)artrum ;t4tpxniieiatfs rluvsnu) etnmo3iy1lm rau sls0srxmim oo4amenlictat)a2rrxrpou1teeo ociatfm2rl(mo;t)tlenir3to1omt an s ( t2xoxr3io1lp  lnctlsfarta(  ot0apxomfeiydfaDumnvs u4 rtrmf3oatfpDrlu s s0 exrxo ou1omt mfvilt srurxmpoo4altomieiyd a2ua(vsn() ltnxr iodomt aueslt)trxmxm3iodll nlnvt tfarumu pnt0ale iociadlsDean o;u4 ltnxrcoo1fatrluvs (  exoirpny4om  micil()a2uauroou1tlt mfciytla2raumpnu)texomr3iydla elues t0t2xrio ny1lpeelncslsfsrtmx ono0aetnmo3tytlm2emnvp (4trxnif iodop r i ils trxm(mpnudapt mici s) Drr(mpnt4teenmieiydfa uau s t4 eeoxoctadfa eaieo t0srur(o ny4omt licil( srua(rpno0aet moctat m2um(vo;(0trxrif oa1fmDr uei;t0seuoiopnu1lm  lfvs (faDtmxr nt1texomo3iadlm2emnms;t4 rtoxoctatfpDrlneil()trtrxopou1ll n neiltfa2tm(rpot0tlt  ictldfa umuvp;t0 lenxo ty1la  aivi;t) rumxm ou1llenlfesas srra(m nu4tpt  iciad m ul(vp t0 rxnmo3ia1fptelnvs;()sruoxmpoy1opeemnvtlsfa2ua(rp;u0oexniiciyt mDulnmsnu4 etnio ta1oaDe u i;t0s2xm(m iu4lmeemnci s)sDrrumoot0alxo i3ias m em( o u0teeomfctodfpteaiei ()trum(rpiodape lnvt sf rua(m nu0ole  fetydfsDumn p;t4 lxoio to1fat luvols0teum(r3ny4altnmicsatfs2tr(  nt4olenioeiyd s2uln sn()texnxfcoadop  lneilt trxmxopoudll  mnetat) 2ua(r nt1aeeo o3tatla2um(mpnt4 leriocoo1laD  n i;t)srtm(m3nodllee ivi (f 2uaxm no4olxnifcilslaDum(vo t0artomf to1opt  n ilt texmiopou4lmtnlfci t)aDra(m ;t0aexo f3iytfaDum( o;u4 lenio ootfmt luvils)s2to(m oy1amtelnvt (  2taum ou0tpxoif3ildlm2ranms;u0trtnmf oydopDrluvs;()s2xmxr io1apen nvs sfartaxm no4oeeniietldlmDeanmpnu0tltnxocoatfa  lieilt0texrxrpiu1lp n ictat a2raurpnt0tetomoetydfa uln pnt) ltomo iadlmDeai o t0 rtoirpiodlle lictat srtrum ou1texoif3ild s eanms;t4aexnmo3ta1lpDrlneo;()srxrxm nu1altnmnvtas  2tr(rpnu0tpt io3iad a2um(mp;u)texrmoctatfpDr ivsl(0 2tmim nodlm  lnvsa()sDtauro;u1apt  f3ias m2em(mo;t)artnir3totom r ueilt) rumir nudalt lncta( srtr(  ot1alenif3tatfs umu s u0 rxrircoytlpDean i t  2xmimpou4omte nci s) ruaum oo0aeenmf3iaslsDuaumo (4tlxoxr3oadopt  ueols srurxr3iydame mnci ( aDrmum oo1tpe io3tltlmDrmumo;(4treoif3oytlp r uvolt0t2xmirpoo4am n iet (faDta( o;u4aet moctyd a2ea(vo;()aexnif3tydlat  n i;s0s2xrxm3iodapt  icsas s2tru o;o4opxn feiytfs2emnmsn(0trxnxo3totlpte n i;s)texm(rpoudllt  net tf 2umxmp;u1tptomietatfm ean snt4trtrmo3tatop  luvi;t0s2um(opnodlmt lneias) 2uru pnt4aexomfeiat m2rlump t4 lerif totlaDrln s;( t2uoir oodale  ietlt s2taur ou1alxnmoctysfs uluvsn(4 etomocio1op   i i;s0 rxmio io1lptnmfvt t  2urxrp;o4apeomf3tldfs ea( s;u0tltoxf ty1oatr iesls srto(rpiu1olee ici t aruaur ou1oltoioeils aDrlu o;u4arxrxfcoydopt aues;t)t2umiopnu1lpte fesat)artmxmooo1alenmociadls2rm(ms;t) eeomfcoo1fp r nei s) etr(r ny4ale mfcsa(  2tmxmo;t0oee mfcilsla rlnmo;t)aetnifciytfat lnes;(  rtm(r3iu1am e fesa()arra(mo;u0altnmfetydfm2rl( o t4tltoxf3todlp ean o;()seurir3iy1ap   neias) rtm(m nu0tptomfetat mDrl( o t0arerifciydomteauvs t) 2ur(m3io4lptnmfvilsfarta(rpoo0oleoiictlt a2rm( s u0trxoxocoydfa  li s (0 eur(r iy1alt  nvta()a2ua(roou0oexnii3iad mDrln on(0 rxrif3iodoa   u o (0 2xrxm3nodom e nes ()srumx  ot4tlenmf3iasls rlnvo;t)altomocty1fmDe n s;s0 etmir iodam elivsl( sDumu ono1oleoifctld m2ea( p;u) etnmr to1fpt lnes;s0 exmio nodlmeemfvt tfaDuaxm ;u1oeeoif3iysls2rl( sn(4trtnmoctytfaD auvo s  rxrxmpoudolt mivsa( a2trxro;u1alenifeiyd m2ranmp;()tlxnio3oy1opDrli o;()trtm(r3io1lm nmfetlt)artaurp;u0tpxnmiciytfa2ul(msnu0tlxoxf iy1fp   i o;t s2umio iodlpenmivtls sDtmuro;o0teenmi3iltfa elu pn(4 lerxr3io1op e n o;s)truoxmpnu4lmte fvtas) Dtm(m ;u4olx io3iatlm em( pnt4trtoir3oodfmD  i s;(0 etr(r nydamtelnvtlt)srtmxrp;t1optoioctlsla2uln s;(0 exomfcoa1fmteaueols srtoxm3oy1apenlnct sfsruaumpnt4oet ifctldla2emn p;() renifctydlatrlnes;(0truo(rpiu1opeelnvi t) 2trxrpnt4alxoii3tad a el( o u4treniociatla rau slt)s2ur(o3oodlp elfcia(fsrtm(m nu0aex mfetldfa eanvp t)texoxocoa1opt auvilt)seto(m ou1amt mncsa() 2tm(ro;o4opt io3iyd a2rlnvo u0teeoiocta1fmDeli s;s  2trxm3iodoleelicsat)sDrmurpno0alt  oeiydlmDrl(mpn()aexnxr3oydom rlies;s  2toxo no4amenlfcias srtaur nt0tpe mi3iydla2ranvonu4altnxocoydlpD ai s;(0srtmio iodomenmfvtls  rrrxmpnu1apeomfciat a ulumonu4 exnmr3tatfptrlivils0sexoim3iodomenmieil(fartaxroot0olt io3iys m el(vsnt) etrxo iytfmte n s;t tetmxo3no1ome lics (fsDrrumoot4ope  oetltla2ua(vpnt0 exoxf ootfa eau o;()trumxo3io1optn ieias a2rau  nt0tltnmoeiysfs2uln s t0alxrif3iotoa   i ols trxmim io4lp e nvt sfa2tmxmo;t0oet  i3tysfs rln o;t4 lxrio3ootfm ean slt  eurxo nu1lmee ncs s  Dtmu pou1aexoifctltlmDra(mpn(0trxnio tytomD  i i (0teto(o oo4ol emivtas  rra(m ou0aex mf3iat s2rl(mp;t) etrircoatfaDraivolt) rur(r nodol nmnctlt)a2rm(r nu1oltnmociyd m ea( p t0 exnmf tytoate u olt)teur(rpiy1openlieia( aDrr( ooo1tpeoio3ildfm eln pn()tetoxocto1fp  lu sls0seuoxo oodopeelnctls srtr( o;u1aexnmiciat aDumu pnu4 etrmo iydfa ranvils0texm(r3ny4amtn fctlt  2rmxrono4oetn i3iltlaDrl( s;(0 etrmf oatoptr ivs t0tetoxmpoudoltn ieiatfa2trurpno1ope mo3tatls elnvonu4altrmf3todfptr i ilt0trum(r oy1lme  ici ( srrmurp;u4tle io3iltls2umnvs;t)aexrxo iadoa rlnes ( srxmim oo4al emnctlt)arrrum ou4tpx mf3tad m2ra( pn(0aetoirctotoat lu i;s0 etr(r iy4omen fct ( a2rmxrpnu0altoiociatfmDrlu s u) rermf3ta1fmD  i sl(0seumxmpiu4olt  ieil()sDum(r no4altomo3tyd s rm(vs (0trerxf3ta1oatelnvi;s)srtrir3nodole mnct t) 2rm(ro;o4apxomfeiatla ra(vo;t4texrif3ta1oa  livi s  2tmxo3oy4lme lnesatfarum(mpnt0optomf3tad m2ea(vonu)artnmf3iy1oa elivil( s2xm(rpio4omt lietas)srtr(ro;o1alt moeiad a2rln s;(0 exoxr3iodopDrlu o;t s2xr(r oydam  lfvtas  Dum(m nu4tle  fctytfmDulnmpn(0tltnmfcta1latrau s;t)truoxo3iydlpenmnviasfaruaurpno0tpx miciad sDrluvpn(0altoxfctatfp e ivilt0 ruo(m oo4om  mncil( aDrmx ont0tpt mf3iysfa2ul(mp;t4 exoir iatfmD livo t)seur(o nydam emfvt tfsruax p;u4tex ii3iatfm2ran o u0tetnxocootop  lnes () rxr(rpnodam  lfet (farur(mooo4aet mo3iasfaDrl( o ()teenxfcoa1fm eai slt  2trxo iudll nmivils srrmx ono0olto f3ildfa rlumpnt0 renif3oatlmDe nvs t0setmxmpoy4lmt  net ()sruru poo0tlxoifeiydfs uan s t) exnmf3tatom  lneils0 2toxr3ou4ole  nci tf 2ra(mont4tlx mi3iatla2rmnmp;t)teeomr ia1omD  uesls setr(opiu1amt lfvsat) Drmxrpou1aee  fcias s ra(vp t)arerio3oo1opDr u i;(0 rtmiopiy4altnmicsls  2ur(r no1oeeomi3tyt m um(von(4 ltrmo to1oat luvs t)trur(o3iydal  lnctls)arrrxr ;o4altn ieiytlm2rm(vsnu0alenircoadla r n i s srto(m3iu4omeemfvtls srrmxro;u0open f3tytlm ulu snu)aleoxoctydlaDe n o t s2xo(mpiodale lfvil(fa2uaxmpnu1aexnmieildla elumont4tetoifciy1lmteai o;t0trurir3ny1lleemivil()srrrxrono4opto fcild aDeluvont) lxoio3oodlm e ivs ( setmir3oudllenlfet s srrrx  ;u1tpe mieiadfsDea( p u0 ltnxo3oa1laDr ivilt)truo(m io4llt livsas)aDum(rpoo0tpe mfctysfa uauvsnt) etoif tytfm e uvi;t) 2xmxo iu4apt  netas  rtaxrpou4oexomo3iad s2ea(ms t0 lxnmo3oytopDrlivo t  euoio3iu1ll  lfcslsf rta(mpnt4oeeomfcias sDranmpnt0trxrxr3oy1faDranes;s tetoio no4am   nvi s) rtmur no4tlx iocild sDul(vo;()aexomr tadfp  lueilt) etmir oodap n ivi s)aDrau pou0oltomieiatls2rauvs t) rerxfciy1oatrlnvslt0 rtrim ny1apenlfeta(fs2rax onu0tltnifciyt sDemuvsn() etnxf iy1omDr ivo;s) rto(rpio1openliviatfa2rm(mooo1aetnmfctydfsDul(mo (0trxomoctatfmt lnes s)srurxmpiy1lle mnvilt arrrxro;t4ape mi3ild a eanvp t0 ltrif tydlp rliei;t0t2to(m oo1lpeelfvtls  2ua(rpou4tpenmieiltfa eln o;t) lxomr3ia1fmD lnvilt0 2xr(r3ny4amee fesasf rrrxrp;u4tlx  fciltlsDra(vs;t0 eeoxr3iydfaDe n il(0 rum(mpoy1lp nliciatfaDuau p;u0alt  o3ilt a uln o t) rtnio oadopDrauei s0s2toiopiy4llte ncslt  rur(  ;o0tpt  fcilt mDra(mp;u0treoxo3tadoptelnvo t0srxrxo iu1op   neil()srrru  nu0tptnio3iyt mDelnvo t)tlxriociy1late nes;()texrim iodol  lnctat)s2tr(m oo0teenioeiltfa uau pnt0texrirciatlp eai s;t  exmimpio4omtelietlsfsDrau o;o0tpx  fciyd a2el(vs;() renmf iodlmDr ivo;s)t2xoxo3ou1amtelivt t)sDtaurp;u0aptoii3iadlm2ul(vp u)altrir3tatomD  ues;s0 2ur(mpnydal n ivt sf Dtru  ;u1aeen fctad m2raumpnt4arermr3ty1oa rai o;()t2tm(o3nu1om   fvt t arraurono1aptnio3iltfsDemuvo (4tltnmr tytlp  luvo t trxmiopiu4openmfct t)srrmurono4tptnif3iadlaDea( snu4 exoif3iatopDeluvo (  exrxrpou4alt lfvi sfaDtrxm oo0apen o3iydfa2elnvs;t0tlxomfciydlm  lueol( t2umxo oudlle  iei t sDtaum nt4olt ii3ilt a emnvsnu4arxrxf3ta1laDrln il( srtrio3oo1lm  mnetlt)sDra(ront4aexoifeilsfs uau p;()aeerxo tadlm   ivi;s)teto(m no1lmt mnet (  rtmumono4apenioetytfaDrlnvpnu0arermociotfp  aieo;t0 rxrir oo1lpenmfesl(f 2raurpnu1alx iietyslm2ulumpnu) eerir3oatomt livslt trtr(r3iydom e ncs ( sDtm(r no0aeen oeiatlaDrau s t) rtnmr iydfa  lnvols) rxo(m3iu4lm nlnci sfsrra( p;t0tle  ieiytfsDuluvs;t) rxnmrcoa1lp eln il() rxrxr3oo1amtemivilsf 2ua(mo;u1tee iieiasfs2umuvp;(0altnxr3oodlate n o ()s2tmio3ny1amt mfcsas a2tmxm ou4oeeomfciltfa rlnvs;(4texnmrcootfa  aieol(0 rxoxr oudlle miet sf 2rrxr ;t0alxnif3ildfa2ranmpnu0tetoxf totfp raivi;()trumxo3iy4al e fetlt  2tru  no4alt ioeiad mDran p (4tleoxf iadlmDrau i;t t2trxo oy4alt mieia() 2ururpno0alto fctatfmDemuvo t) leoiocio1lptrluei t0t2xrim3no1lpe mieils  rrr(  ot0tlx  feilsla2eluvo (0altnmo3iatoat luvi;s) 2toxmpou1ole mfetlt a2trurpnu1aexnmfcild mDelums (4aetnio3iydlmDeanei s) 2to(m iu1lpee ivtltf Dtrxmp;o1tlen ieiltfs2raums;t4 lxrmr iydfatrliei;s0t2xoir3io4op nmietlsfsDrax pnt4olen ociatlmDua( p;u0 reomfctydomtrluvo;s0t2to(rpou1lpenlnet () Drrum oo0olen feildfs2ua(vs u0 exoxr oatoat lieolt  2xoio oo1lpe mnvs s arrrx  ou0ole mfctasls uau on(0teeomr3oy1fa eaivol(  rurimpiodamt lnciat)srumxrono0altoif3iydlm ea( s;u)artomf3io1omD  ivs;()t2urxm nodale  ies t  rurxrpno0teenmiciydla2rln snt4trenir3oo1lptelivo (0 2urxr iy4aptnliesas) rtmx pou4tex moctltlm em(vp u0 lxrif3iodopt lnei;s0 euoxr no1ome mfcia( srurump;o0tet  oeias a ul(mo (4 ltnxo3tatlptr uvil()teuriopiu1omen fct t  2umumo;u1tpen ocilsfm2el( s;t0 etoif3iotlaDe ues;s s2tmirpiudoltemfct s  rtm(mpnu4tpxnmi3ildlaDua( p u)texnxocta1oatrlieilt) rxm(r iodamt lneia(fsDtm( poo0aptnmicildla2rln s;()areoxocta1la e i ols  rxrxopnodlleemics sfs2tmx o;t0oee miciydfsDrmu o (0artoif iatop r i il(0s2tm(rpou4om nlncsa( sDtr(  ;u1tpxnmicils m2uau p;t4altrxociotlat  uvs (  2ur(rpno4lp  miesa()sDur(m ot1alt  o3iytfaDum(vo t4 rxomfcio1lm  lueol( s2xm(o ou1ame  fciltfa2rmumo;u4tlx  icilslsDuanvonu4 lermf3tytfa  an s;s setmim3ou4omtelics t)artaxront4olenifeiytfa2rl(ms u0 exrmf3oa1fmte u o;s0trxrxr3oudoptelncta( sDuax pno4alx  feiasla eanms;u0altriocoatfm ean s t0 2uo(mpnudlpeelfesa()aDuaum ou4aleomo3tatla ea( o t)aetomfcoatlp  ln o;s)seto(o ou1ap nlfeia() rta(rpot1tee  f3iad mDemn s;t4tltriocta1fp rluei;(0 rxm(opiydlm nmneias aDrmumonu1alt  ictyd m2ranmsn(4trtoxo3iatlm   u ol(0 rxoir oo1lpee nei t  2rauronu4aeeo o3iytla2em( snu0tltniocootoa rli s s0 rurxr3no1oltelfcsat) Dta(monu4tpe  i3iys a2rm(vs t0alxomr iy1lmD aivo t tetrxopoydaltnmfcilsf Dtr(  ou0alxnmoeiltfs2eanmo u)trxoxr3iotfpDrlues;t) ruo(r3io1ap n ivi t artaxro;u0opeoifeiydlmDranvo;t0trenxo oodlp rln sl(0sruo(opio1am n fetasfs2urum nu1teeo f3tatlm2rl(vo;(4artrmf3iadfpt ai s () rtrim3iydol  mnei t  rumxmp;u0altnii3iad aDra( p u4 rxnmrctotlm  lnes;t0tetmxo oydom nmnvi s  2ua(r ot0oetnio3iysfsDean s;t)trxnio oadlp  aieols s2umio ou4amtnmnvs ( sDua(rp;o1oetnii3tltfa2em( p t)tltrif ty1fm r uvi (0 eurxo3oy4aleelieta( aruru  nt1apx miciys a2ean s (0treoio tydlm  anvo;t0t2xrirpnodome livs s)srtrxmonu1tetomociyd m uanmp;() ltoircoydfm   u o s)srxrio oydalt liei s) rta( onu4oet ii3iydfm2rmn sn(0trxomf oatomtrlu s t0 ruo(mpoudamtnmnei ( aDuru pno4opeo i3iadlm2ua(vo t4 leoir3oydfa  ln il( s2xrio3oo1ll  mictl() rta(r oo0olto fciltfm2rl( o;t4 ltnio iodlate nvo;(0teto(opnu1ap e ivtlsfsrrmxm ;t1tpt mfetat m2ul( p;t4artnif3oatfm   neils  eumir oy4am elncs tf 2uau oou4opx  f3iyd mDum( o;() lermo3to1fpD anvo;s)srurir oudapenlneil()artrurono1tetnmi3iatls ua( p ()tetnxo3todlpte uvol( s2uoir iydoleelnvtl(fartr(r no4tlto fctadfm2uanvo (4 ltoxfcia1oaDrlu ilt) 2tr(o3nudlle mnvtat srrm(root4oexnmieiadfaDem( snu4 etomfcio1lp   iesls)trxoxr no4alt mnvi (f rraxm ;o1alxoio3ildls rmn onu0 rerif ia1lp eauvs t srurio oo4om n fcs tfartmur ;t0tpe  fciltls2ra(vo;(4trerifcoy1fp r ueslt0t2tmir iu1lptnmieils srtmx  ou4tet ii3tls aDemuvsn() lerxr ia1fa rau i;() 2trio3oudlmen ieiat arurur ;u0tpt  f3tadfm raums;u)tltnifciydlate i o (0truoim oo1lp  lfci t)aDururonu1aeeomietltfs2eaumsnt0 exnxf3ootlm eaueo s0setr(rpou1ole mfvtlsfaDumxmpot1apxnii3tadfa rmnmp;t)aeerxf io1lp  au i;t0setmir nydlm nlfvia( a2uaxmo;o4apto i3tytlsDel(mpnt4tetoio ta1om e uei;t)trum(opnu4lpenmfctls a2ra( pno4optn ieilsfs ea( s u)arenxf3tatfatelivs t)srxr(r3ou1om  lfcslsfsDtm(m nt0oee ifeiyslm2em( p u4alxrmo3oodfatrlu sl()setrxopoo1al nlicsas)s2tmu poo4opxoiicilsfs rluvp;u4trxnio iytoa  aivo;(  eto(m oudap n fct sf 2tm(r ;u1olen i3iatfmDulu s;t0artrir3io1fate nvo;() 2xmxopou4op nmfct (  2tr(r nt0altniocils a2eanvs;(0 exrxf iydfp ran s;t)sexrxr3iu1lpeemncsls  ruau  ;u4optomo3iatlaDulumsnu)aetomo iotoaDe ieo;s seto(m3no4al n nctlt)s2tmx ono4opx  i3iydlm2rl(vp u) rtnio3oatfm  au o;()truo(r oy1olt  nviat) 2umu  ot1apx  feiaslaDeau pnt4trerxocootopD ln sls setr(m3nydapen ivtl(fsDrmumpou1alx  fciydls rl( ont) leoxf3tydopDelivo s  ruoxm no1olen fctas s2rmxr nu1aptnii3iydla2emn p;u)trtnir3oydoateaivo s) 2xrio iu1amtelfvtl( arum(mont4tptn ociad a umn s;(4 rermf ootop eli s;()s2tmiopou4lm  lfct t srra(r nu1apeomicilsfm2ra( p (0 reomfcta1fp  au il(  2tm(m3oo1ole lfvilt)sruaxronu1aexo o3iyslm2elnms u4teerioctatlpDr ieil( t2toxr ou4llen ivt s  Dumxmooo0ope ifetytfm rmump;(4 rtrxo io1laDeaues (0 etrxm iodamt lics (  rrau  ;u4oleomo3tysla2rm(mpn(4areomrciydlpD auvs (  2xoir iodll  licsa( aDrm(  nt1tpeniictys a emu p;(4 rxniociodlmteli i s0 etr(r iu1ome mnvilt  2raxmpnu0aeenioeiyd a2ranmpn() rxrircty1fm  lueils0t2xm(o ny1ap nlncsa() rumx  ou0oeeoio3tysls2emn on(4tlermf to1oaDeaies;t trtrxopnudal nlivs s a2umum nt4oee  iciltls2ea(vs;t0trtrif oytoaD  nvi s)sexmxopnu1am nmfetas)a2tmu p;o1alt mfetlsfm rm(monu4arerir3iadomtr i i;t) 2xrxopou4ap emnei s srrr(r ;u4ope  fetltlmDra(vont0treomf3oo1fpte u ols0s2uo(m oy4llt mfes (  2taxrp;u0tee mfetasfa em(mp;()alxrir3iotoaDrlivs;s s2urim3oudopenlfvtatfs2uau  ;o1tee mi3tldla umnms u0aetnmf iotfa  auvil()t2xo(o oo4olenmfcia(f rum(  ;o4alenifeildlaDra(vs;(0trxrmrcty1fpDe nvo;s t2tmxr3iy4alt  ietasfs2raxr ;o4aeenmociysla2elump u)trxnmo3oadoaD aivils)t2tm(rpny4optemfes s aruru o;u4tpenmf3iadlaDel( p (0trenmf3iatomtrlnei;t0trxmxm3ny4llte ivi s artrur ou0opxnio3iysls2eanms;(0alerir ta1oatrlu o;s)s2um(m ou1lmtelietls)s2rru p;o0aexomoeiadlsDeln s ()texrmo3ta1la r i i;s)truo(rpny4ap elnciatfsDua(mo;o1tpxnmfctldlm2ea( s ()trxrxo ta1fatrai ils0 exoxrpny1lle lnvsas)srtmu  ot1aleoifeiad s2em( p;()alermo tatoaD aieo s  2um(m iydom elfeilt s2um( ooo4apx if3iys s ul( pnu4trxniociytfmD  nvo (  eumxm oo4aptnmivil()s2ururp;o0ope  oeiysfs2emuvs ()teeomf3oydoaDrln o (  2ur(opoodlptemicil() 2umxroou1alen ociydfs rauvs u) ltrmoctadlp eanei;t  2tmimpny1lle  nvtatfartr(ro;t0tetoif3iydla2rlnvsnt0artoxo3iotfp r ivs t) euo(m nu4alen nvsl(fs2tmuroou4tlxniieiyt m2rm(vp (4aleoir oatfmD livo s0srtr(o oy1optelneia() rrm(m no0oet  iciydfsDuauvo t0tlenxr3iatopDr n s;t0 eumxm3nu1ll nlfcsa(fsrtmurpou0tex  ietytls eln p t0aexoio oytoaDr uvslt) 2tm(opoy4apee fci sf rumx  ;u4tlxoioeildfsDuluvp u4trtnif ia1lp rli ol()s2xo(m nu1al nlfcias)s2trurpnt4olto f3iyt s ea(vp;u4aleomo oa1oaD  u slt  2xo(opiydop e fcilt)artm(rp;u4tpx  o3iyt s2rm(vs u0 ltrio iy1fmtrlnvi s)trurxmpiodom  mnesl( a2uax p;u4apeniociys m ra(mp;() rxoxo oatfp  auvi s setmxm3oo1lme mfvtlsfsDrmxm nt4oetomfciat aDrauvs;()tltoio todopDr n s t0srumxm3nu4aptemfvs ()aDrru pot0altn o3tad mDem(mp (4 etrif oatfpDe i s (0seto(m3iydlmtnlivsl( a2taxrp;u4altnio3iytfmDrln s (0tlenmocio1lpD lnei (0 rtrxo nu4lmtnlfct () rtaxr nt1optomf3tltlsDua( p t0alerxo oadoptrlivs (0 exmirpno1lm n ncs tfsrtmu o;o0texomoetldlaDrmn p (4 exrxo iy1fp   uvo;()t2trxm iydap  miciltfsrtmxmoot1opx io3iatla ra(vs (4tlxrxoctodomDrluvs (0 2trir nu4lptn ies tf rrauronu0tetn feilslsDrmu p u)altrxrctytfa rlneils) 2umim no4opt lncils)aruaurpnu0tle mietatla ra(ms u) rxrxr3io1lpD an s t srxrir3iy1alenlicilsfaDua(m ;t0aexn o3tys aDea(mo u4 etrxociotopDr n slt) rumxr ou4olee feils arrrur oo0ale  fctld a2emnmp t)texrxf ootfpDr i ilt  rtrio3ny4ole lfvsatf Dtr( o;o4ope  i3ild s umn o u0alxnmo iatlp e n i;() 2toimpoudlp  mici ()artru o;t1ope  f3tydlaDran s;u4arxomr oy1opDrai i s) etoxrpiydol  lnvi (fs2urxmonu1tetn iciat s2em(vp (4 lermr oo1fat  iesl() rtm(m no1apt lncsat)s2trx  ;o4oeeoioctlsla em( p;t0texomo3iodfmt lu i;(0s2uo(rpou4olt lnciat)a2ta( p;o1opxnio3tadfm eanms t4trenmf3tadfatraneo t) 2toxo io4oleelnctatfarumu pot0aptnmi3ias m rm(ms (4 reoif3iotfpteanvsls0 2tmxo3io1al  livtasf 2trump;o4tetomfetysla2eanmp;t)aetnio oydoa raivs;t0 rurirpio1lpte fcs s  2tauront1texomo3iatlm ul( s t) lerir3oytopDe u s s0 rtm(o io4olenmfes t)srtaur nu0tpxoif3ilt m rm(vo u4altrmo to1lp r ivo t)srtoxo3oo4om n nviat) Dta(m nu4apt ifeiytls2uanmp t)aetnir ta1lmDe i i;s setrxm3oy1amtelnvsltfs2umx oot1tetnmociltlaDrlnms (0tetrxocoytoa rluei s)trtr(r iy4opt mnes s) 2tr(rooo4tetnmfetaslsDrlu sn(0trtoir3ootlate n s;( s2tm(m oodop emncia(f ruaxr no1altnif3ils s2el(vsnt)aeeomfcoy1lateauvi t) exoim3nu4am   ncsl()artaxr ou0tlt  ietatlm2ra(vont)trermrctotoa rlues;( srur(o iodomt  fcsl( srrau ooo0tlxnmf3tyd aDel(vo;u4 exnxocoydoaD  i o s0t2umxopio4ll n iviatfs2umur nu0texo feilsla rmuvp u)tetrmocoa1faDr u i s)sruo(o ny1lmeemfet ( aDrrur oo4oleomoctad m2uau o;u)tetnxf3to1oa raneo ()s2toir3iy1lmt  fvs s) 2raum oo1aptomi3iyt sDemuvo u4 lxoxf oydfmDe neo t  2urir iu1ol elietl(fsDrax pno1ole ifeias s ua(ms;t0altrif3iydomDeaueo s t2
\ No newline at end of file
@@ -0,0 +1 @@
+n o s0tetoirpoodap nmfctlsfsrra(rpnt0tet  feiyt a2uln p;t0trtrxfcia1oa eli i s)seuo(o nu1ope lncsa(f rtr(mo;t0tlxn f3ild a eanms;(0texnxfcto1lp eaneo t  rxo(m3oydlmee fci s)sDumxmo;t1tleomo3ilsfa2raumo;u4 etnxr ty1fmDrluvs ( s2xrio iy4ll  lfetls s2uru oot1tlx  octys a2em(ms u0tlxnxfcio1lm  anvsls0 rtoio no4olte fvslsfsrum(r ot1oetniictadlm2ulnmo (4tlermf oy1lmDrlneilt  ruo(r iodlmt mnvt s  Duax  nu1apxnioeiaslmDrm(vs;t) rxrmo3todfpt lieilt0srxo(mpiy4ap   nvsls  2ra(rono0oeen fetyt sDel( sn(4trtoxrctydoa eauvslt0t2trim3oudopenmfciatf 2trxm ;o1olxo ieiyd a ul(ms u0aexrxrctatfateai il( texmxr3oy1lpe mnviasfs2raxront0tpto ietltla rm(mp u)tlxrifciytoptr ieo s  2urxmpio4olt mfvtl(fsrra(mpnt0tpeoii3iasfa2ul(ms (4alenio3iy1lpD aueils)srtoxm3iy4oleemnvs sfarrax  nu0oex mi3ias m2uln on(4altrxf iy1oa  liesls0seuo(m3io1lmenmnvt sfsruaur nt1tle  i3iyslaDelnvp t4 rxoxo3iatop ean s;s0 rumxm3io4lpt livtls) rtr(m ;t1aeeomfcilsfm ra( ont4 rtoiocio1fmtrli i;( s2xrio3ny1apt mivsa( artmu o;u1opxnmieiysfmDemn pn(0trxrxoctytfpt lueils0seurxmpou1al e ietlt)s2rr(  ou1oet iieiytla2elumo u0tetomr3iadop  lues t  2tr(r3iudlme  nei t)s2rrumpnt4oet  fctytlm2eauvo;u)texnmo ootoptrlnes s0 2tm(o3oudop e iet () 2tmu  ou0opt miciydlm2rauvs t)tltoxrcto1opDraneilt0 2toio3nydll emnvsat a2ua( pnu4ole mo3iysfs2rl(mo;u0treoxf3iytoate u ols)trumxrpoudomenlnetat sruau pnt0alen o3iyslaDea(mpn(4artomf3iy1fpD anvo;t0srtmiopoo4lleemfei t)aDrm(mpot4tptomieiytlmDulnvp;(4artnxrcto1lm elnei;( trxr(r iy4oltnmfci t)a2uauronu0optoiiciaslsDrlnvs u0altnxr oo1fmDeli ol()trtmxopoodll n neia(farrau oot1apen o3ils s2umumont4tlxrifciatlptelnvo (0srxmxr oo4al e ivtltfsDrr(m oo0tee mfciaslm ranms (0alxnmr3iytom rlu s (0 rtmir3no4olenmieia(  2tau  ou4oleoii3ilsls2ra(vo;t0tetnxr oo1lmt  u sls0t2trim3oodapeemfctlsfartrxrooo1tpxnmiciysls2umuvo u0tlxoxf iodla e ivs s t2xmxo nodopt lfviasfsrrau pnu4tltoiicils sDemumonu)alxnir oy1om rlnvs;t) etrim3nodlm emiei (faDumxr ;u4texn oeiat s uluvs u)alenircoatfaDrln sls0srtrim3nu1amte ivt t s2trx oot4alt  f3iyslsDrmnmp;t4 eeniociadfmD auvo t  2toio3no1ll e ncias a2rrxr oo0alxn o3ilsfs2rl(vont0trenxo3ootlmD livo;s  2umio3iu4amtelnvtlt)aDtru ont4tpxomfeiltfa2eauvsnu)teerxo oytoaDeauvs ( trurxrpno4lmtnmfesatfsDtrum no1apeo fciyd sDra(vo (0 exomr to1laDr iesls tetmirpnudlmtnlnct t  Durxmp;t4tleoiieiasfs2eanmpnu0alenif3tadlmDe ivs;t0s2trio nodlle liei tfa2tmx pnu1tpxoifciadlaDranmo;(4 lxrxocoo1fat lnei;t0 2uoxo3oudapt  netlsf Duaurpnt4aeto octys m2umuvs;u) rxnmo oodomt ai o (0srtoio iudllenmfciasfa2raxmo;t1apt ioeiydfa2emumpnt) exrmo todoa rlivol(  euoio3nu4lm nlfvt s) Dtaxrp;t1ole iocilsfa rmn sn(4tltomr tatfpD anvo;s trtmiopiu1omte fctas) Draur ;o4tee mo3tyd m ra(ms (0tlenif totfmt  n slt trto(o nodlm nlnct t s2uau  ot1texn feiltlm ranvo t) renmrctydfpt  nvi;(  2xm(r ou1ll nlici t aDrmx oou0tetomi3iysfaDul( s u4aetoxr3ia1laDe ieols) exoxr nu4amee nvsat) Dum(r ;t4openmfetaslm2rmumont0 exnio iy1oa  aueol( t2umirpny4apte fei s  2tmx  ou0aeeoioetlsls emuvsnt4 rerxfcootomt  nei;t0t2xm(r3oy1omenmfcilt)aDur(  ;u4aetn oetldfm2eau p;(4 exrxo3iadfa elivol( s2toxopnu4oltnmneiasfs2um(r nt0tpt  fciatfa emuvon(4aetrmo ty1lmte ies t seuoxmpoudomen ieil(  Dtaxmont4oexn fciyd a2em( o (0 exrxr3tatlatrlivo;s)srxmio iodomtn netl(farurxm ot1tetomf3iasfsDuaump (4trenir3iadomDr iei;s) rumxr3ou1lm  miet sfsDraxmono4tpeo i3iadls2ulnms t0trtrmr tydlpDeaneo;s0s2uo(o iu1lleemfciltfs2taxmp;o4apt  feilt m2rm(mo u4alermo3iydomDr n sl()t2xmxm3oudapenmfes t aDrau  nt0oetn o3tyt m2rauvs (0 exomf iytlmDe uvo t0trxrio3no1amtnlfcta(fs2tmxrono4opxomictytlmDelumo u0 eermocoy1fa rlnvs;s0 2uoxm iy1ll nlivta(f Dur(mpoo1oeenioetyt s2um(vpnt)aetomf3oatlat  n s;s0tetrxr3ny1lpee fcsa(  2tr(mo;o1texoiiciadfm elnvo t)aexnmoctydfp e n s;s trxrxr3nodolenmieilt) Duaumoou0tptoio3iyt s ran onu)aetrxo3oatfm   ueil()t2tmxo ou1apenmivs t)arraxmooo4altnmfctydlm2ea( s t4 rxoio3tatop raueslt0seumimpoy1aleelics (farua(r ;o0tlenioeiyt sDrmuvs u0trtrxrcty1lm e u i;()trtoxrpoo4ope livtlt artr(rpou4oexnmo3iysfm2ra(mp u0tltrir3ootomDrluvi;( trxmio3oy1amen iesls a2urxmpnu1tltnii3ildfs rmuvp (0teeniocoodfm  lueolt  eur(o ou1am elncsl(fa2rrx oot4oexo f3ilsla eauvpnu4 eeoir tydlpte i o (0trtm(r3ny1opeemfvtasfs2tmxrpou0tetoifctldla um( o t0tltomo oa1fm ran ols)teumxmpiy4lpt liet (fa2rmur no1oee moctysfaDeanvs t4tltnmfctodoptean o;t0 2xmio3iy4aptelfvtlt arrmxroot1tpx ifciaslsDrauvont)trxriocoadlm eaies;t  rto(m3iy1om e ncsa(fsrtmuronu1oex  feiad sDra( o t4aetoifcoadlm eli o t  etm(m3iu4llee neil(fa2urxr no0tee  ieils m umn p (4 etnifcoodfmteau s;t) rurir nodllt lnet ( artmurpnu1olx mfeilt s2umuvonu) reoirciodfa rlueo (0 rxrio iy4al e nctatfsrrax p;u0oetnmi3iasfs2rauvonu0alerxfcoatoaDean ilt) eur(m oo1om  miet s)s2rmumpou0tpt ifetyt m2rauvo (4trerxo3oadlp e ueo;t t2ur(r3oy1amtnmivsa()aDtaxmpnt4oee mfciydls emump ()trxoxfcoadopD  nvi;s)sexoxm3io1openmivs t a2rru p;t4ape mfeiat m2ean o;u4arxomrcoo1opDeluvi (0s2urim iy1ap  lfvilt)artax o;o0aleo ocildlsDrln p (4aetrmo iatomt lues s trum(m ny4altnmnesl()sDrr(  oo1alx mi3iysls ran s u0 eenxfcoo1lp rln sls) etoio ou1op nmfesl() Drr( pnu1oltnmociltfs uau p;()altoxfcto1opD auvol()srxrir nudlleelnvtltfsDrax  nu0apxomoctatlaDulnmo u0trxoxr oytlptrluvs (  2toxo iy1ap emfeiasf 2umu pot4tpt moeiys m umu p (4tltoir oydfmteanei (  rxmim3nodam emiesas a2ra(r ou1olt moetadfaDul(mpnu) rxoif io1oaDraneol()t2tm(o3oudalt mfcils  rur(m ot1oexnmf3tadfaDuln sn(0tlxoir3iatfp   nes;()trtmirpiodap n nvt (  Durxmp;u4tetomoctadlsDulums;t4trtrmf3iytfp eluvs t t2toirpoy4alen nvi tf 2uaur no0oleo o3iadfs rau snt)texomrcio1omDr ivi ()tetrio no4ol nlici (f 2uru  ou1tleoifeiytlsDumnvp;() rermrcoy1fm  lues;t)srxo(o3nudlleemncta(  2umxroou1apen ictatlm rlu s ()aexomf ta1fp  aivo s0t2ur(o3ny4op n icias)s2rmxr nt0tpx moeilsla2em(vsn()teeomf3ootfa  aneo t)srtoiopoydopt mict tfsDtauro;u4tlxniictysls rau p;u4areoxo3iytlatran ols0trxoiopoodalt  icsl(f rua( o;o4ale mi3iytlm uan s;()alerxociadoa  lnvs t)truoxopoydopen feiat  Duax ono0alto oetlsfa uln s;t0texnxr3totomtr ivils0t2xoio3nu4omt lies t srtau p;t1ale  o3iadfmDel( o;u0tleomo iotla r uvols srxoxm3oo1am elneil(fsrrax  oo4olto ieiytfm rlums (0arxrxo3oodomtrlnei;(0srxr(m3oodal nmfvtasfsrur(mono4tlxo ocilt a ua(vo;(4teerxr3ia1la r neols)t2xmxr3oy1ope mfctas) Drrxront1teto o3tat mDrm(vp;u0trerxrcto1oa  aiesl( trtm(o iu4lpenmfetasf 2ur(mp;u4aptoif3tys a2elu o t)artriocoo1fmDranvs ()t2xrir3iodlm nmncias  rurxr ou0tpt ioetysla2rmnvon(0tlxoir oodop e ues ()trxrim3oy4ol nmncia(f Drmu  ou0alt mf3iadla uan sn(4texoio3iadop rlies;s)t2tmio nu4oleelivt (faDum(  no0open f3iyslm uau pn(0artrxfciydlmtrluvil()s2xoxm iudamt lfci t  rtrxmpoo1opeoifctydfs2um(vsnu)treoif tydfmt anei (0trto(r3oy4lmtnmicslsf rum( p;t4optoifetat a emnmpnu0aleoxf iy1lm eaues ( setm(m3nudapenmivtatfaDuaumono0tle ifcildfa emuvont)tlenmr3tatfmteluesl(0 2uoimpnydom emfeslt)sDuau pnt4alen oetatls2el(msn() rxoxf iytfpt livo;t0trtm(r3iy1aptemivi t)srtm(ronu1alxomf3iat s2rln snu0arxoxo3tatlm rln i s0trumxm nudlltnlicsltf Dtrurpot4tlxoifetysls ra(vs t4teeoxf oa1opD  uei s0srur(opiudalenlfvs (  2rru ont4opt ii3ilt mDem(mpnu0aetrio3iy1la r uvs;s0t2xrxr3iy1om  mfvias) Draur ou4open ociltls2uaumsnu)teeomf ta1lmDe neo;() rumio3ny1altelfei ( a2uaxmpno4opt moetys a2uauvon(4treomo3todfpDeaieo t0 rtrxm3iu1omtn fcil( s2tr( pnt0altomo3ildlm rmu p u4trenif iotfm   n s t0 rumxr3iydomtelfei s)a2rr(r ou0aexnii3iltla2uaums;u0trxrmocootfa rlnei;(0srumxm3ny1ope mivsas)arrmxr ;t0olxnmo3tadfa2eluvp u)arxomr iadopDe ueslt)s2ur(r io1amee nes t aruau ont0aptomf3ilt mDem( snt)aetrxo3oytom eaivol(0setrim3iy4omte nvia()srraxr nu1tlxoifeiytfm rmn ont)artoxr totoa  au o ( srtriopoy4ameemnctlsfarum( o;u4apenmieild s2ean pnt4artomf iy1fmt li s ( trxr(o3no1olt  fvtatfaDurumpno4oetoiiciasla rln sn(4 eerxr ty1fa  luvs;()teurxo3nu1lm   iet t  Duax  nu4tltomiciydls2uau o;t4tlxoxocoodomD luvs;()trtmxopnydlm  lict s)aDumu  no0oee ii3iyd sDea( o t) rtrxoctydop rlivilt)s2trxr oy4lm  lfvt ()aruru  oo4tpx mf3ilslsDea(vp;()aetrmo3tadfaD anvi;t)trxrirpiy1omt mncil() rrrxmpot1alxomfeiysla em(vsn()tlenio tydfa r uvol(0setrir3nodllenlivsa( s2rm(r nu0apx mf3iadfs ulnvs (4tleomrcoodlmt  ivolt teuoio3nudlmeelfvtas aDrrxro;u1tlt  ictadls uln s () rtnxf3oy1fm r n s;( srumim nodolen nciltfarumxroot4tlxnmfeiytfa2uanmsnt0 rtrmo oodfmtrlu o s)setmio ou4ap emiciat  2ra( oot4tlxnmoctltfm rauvo t4altnxr oy1om eauvil(0s2urxr iy4ole licsltfsruru  ot4oexnmoetadfmDeluvs;t)areoxr3tydoaDeaiei s  rxr(opiudalt lncil(fsrrmuro;t4olto i3iasls uanmo (0tltomrciatomt livo;()t2xr(r oy4altnmiet t)srrrurpoo1oeen f3iatfm2ra(mo ()trxrirciydfm rln s s  rxrimpoodomee ncsatf rrrxrooo1tlto fcilsfs2uau pnt0 ltomf3totla r neilt teuo(opny4ol nlictls) 2raumo;o4tlx  f3iadlsDemnvs t) exnmo3ta1omD lnvi ( srtoxo3iy4om nmfesas s2umxro;u4aetn f3tls a em( s;() leomr3oatfmDeaieo;t  etoir ny1altemivilt  2rrxr ;t1tltomfcild a2uanmsnu)aetoif to1lm e i o s0sexm(mpnodalen ietl(  rumxm ;u1oeeomf3iyslsDeluvp;()tltnxo3ty1oa e uvslt s2xoim iu1al elnci t  rum(rpno1teeomietyt aDumuvsnt4alerxr todlmte u i s0 2umir iodapen nvsls)a2tr(m oo4olx ii3iaslaDem(mp;u4 rerifcoytfaDeaiei;s)seum(opiu4optemivs sfarra(  ot1aee mictatlm2rm(vsnt)tleoio3oa1omt au s ()setoirpny1olt liet t) rua(rp;o0aleoiocildfaDra( s;() rtoxf iatlateli olt  exmir3oo4amte ncsatf rur(ronu0tptniociydfm2ran o u4arxnirciydfmtr i slt0texoir oudale mfvtat) rua(  ot1ole mo3tls m rlu pn(0aeeomf iytomteaivils0 2urir3iy4omeemies s) Dra(r no1tltn fetyd aDrlnvp;t0tltnmf oy1fmDr nvs;(  2to(rpny1ape  nesl() 2umxm nu1ole ifetys a2el(mpnt)tltnmo3oadfa rlu sls0teur(mpou1oltnlnct sf 2uaxmp;t4aetoifcild s2rmuvo t0 lenif todla  lneslt0t2toir3io1optemivsl(f rtm(m ou0tptoio3ildlm2eauvo;t0tltnmf3tydlpDrln i;t texo(r iu4op nlncs () rrrxmpno4tlxnmo3iatlmDra(vo u4trxrmo iotoaDrlueo;t0 euo(r3io1aptemfvt s)arrmx  nt4aee mfeild aDrluvp u0tetnmo3oytlpDrlueo;s) exr(rpoo1ome  ncs ()arrru pnu4ope iociyslm2eauvs;()aetrmo iotom r iei;t0 2uo(opnodap e ivi (faDuaxrp;o1aetn ociys a eauvont4trtrio3tadfpDeaivs s  2trim3nu1omtemivi tf 2trxmpnu1aptomf3ildlmDulu s (4 rtoif ta1opt ai slt)srur(rpiodalte fct tfsDumuro;t4optnmi3ilslsDrmnvsnt0 lenmfcta1lpD ln sl(0srxmxo3io1am emncil(faDrmx p;u0oet  ociysfaDuan s t4aexoif3tydomDeau o t setmir3nudlptemivsls)aDtrum oo1tleomfctld mDel(mpnu) lerxf ta1fmt  i slt teuoxo3io4lp e neslt  2rauro;o0apeomf3tysfmDrl(msnt4 etrxocoatom ean s;s0s2trim3no1optnlivils  2urxm ou1tpeo ieiytfsDrau s (0teerir3iytoat an slt0sruo(m3nu1ll elnctlsfa2urxmoou0altoifeiytlm2em(vo;(0teeomf totlm  anvo ( s2xoxopoudoleelivt t)sDumx  no0olxnmicilsla umuvo;()tetrir3to1fpD aneo t0srtrxr3no4opt lnci t)sDuau pnt1texnioctat mDua( s u4 eermf iadfpt lueslt0s2xrimpoodapee fcta(  rtru  ou4apx moetldfaDrl(vo (0 lenircoatlmDr i s;s0srum(o3oodam nlfciltf 2umu pnu0oltnmieiyd aDrm(vo;u) rermrcoydla r uvo;t trum(r oo4lm nmneia(  rrmxmp;t0olxomi3iasfs uauvont0artrmf3iotfatraies t sexo(m3no1omee ivsat a2tmx  nt1alenioetysfmDem(msn() etnxf tatfa ean o;()s2uo(rpny1altemics sfs2tru onu1aet mi3iadlm rmuvo;() eenmfcta1opteli i t) exoxr3oodlmtelnvsls srua(r ;u0alto o3iatla ranvpnt)altoioctodfatr uei;s)trxrir3iudomtnlfct s  2urx  ;o1aptnio3ildlm uau pn(4texoxr ia1opt lnei s)t2xriopnu1lpe lnvt s  2uau onu1tle mfeiytlaDel(vsn(4tltoxfcoytfpDe nvo (0seum(rpny1apenlfvi () rra(rooo0tlxo f3iltls emn p u)aleomo3iadfpD an ils)setrxmpio1apeelfctat)s2rru p;t0tpt  i3iat aDuau pn(0 ltoifctadla e n ils0 rur(opoy1ol nlfvia(fs2tm(m ot1oex  i3tltlsDrlnvs u)treoir ty1omDrauvs;s t2ur(rpiy4lp elicslt)sDtmxro;o0apenmo3iat m rlu snu) eeomocoytfatrauvs;s sexmim3iodolee nctasfs2ra(rpou1aee  oeilslaDuluvpnt4alxrxr oatlm r ueol( s2uriopiu1lmeemfcil(fa2rmu pnu4tlenmictaslmDrau pnt) eerxf iatopDe i s;s)sexm(mpio1lptelieslsf Dtr( onu1tle mi3iyslmDrlumsnt4alxrxf3oa1fp rau s;s) etm(m3ou4omtelfviat) rrrumoot0tlxnio3iadlm umuvo (0trtrmr oatfptrliei ( setoir3oo4ap n nvtlsf 2tm(rp;t0apxn fciysfs2rlu o (0alxrmf oy1lm eau s s0trtriopoo1amtnmfctat)sDumum no1tpt moetatfm2elu onu)trermr3oatfaD ai sls)trxo(m3ou4lpeelieta()srtr( oou1texomociaslmDemnvpnu)teerif3tadlptrlneil(0 2uoxo3oo4am  mfcslt)srtm(rp;u4apx moetadfm rlu on(4teenxo3tydfpD aivs;s0s2xmxr oudop  mfetatf 2taumpoo1ope if3iaslaDeau s u0altnxo ta1fa e ivi;(0s2um(opiudamenlici t)aDra( o;t0opeoio3tydlm rmump;t4tetnmf tadoaDrlueo;( s2xmim no4lltelfei s) Drru pou0opt mietatfaDea(vs;u4aetnxr oatlptrauvs;()s2tmxr3iydome mnctl()s2um(roou1tpenmi3iysfm rmnvs;u0aexnmoctotfpDraivo;(0 rxo(mpny1lmt lietlsfsDum( p;o0ole ioeilsfm el(vp;(0trxnio oytlmD aueo () etr(o iu4alt  neiat sDrmumoou4tlxomf3iatls ea( pnu) rerxf iotom eai o (0trtr(o3ou4ll nmfviatfsDurur ;o1aee mi3ilsfa2elu s;(4areomrcta1omtelnei s)sexoxr io4omeemnvsa(fsrrm(monu1ole iietytfm uluvp;t4arenmfciotfa eaueols0teuoxopiy1lltnlicsatfa2trum ;t4tlen ictls sDrlu o;t0 ltomf tatfa  auvi;t0 etoxr3ou4lmenmiei (f rrr( poo1apt iieiadfmDrluvsn() renxr3oy1omte ivi t) etrxr3ny1aptnlict tfaDraumpou4olto iciydfm2ra( s (0trtomf3tydfmDrlivs s0trtmxr io4lm emneiat)aDtr(rpno1apxnmfetat s2ulu p;t0 rxoxo oydla r ues t  exmxm oodamt  nesa(f rumxmooo0ole iiciys mDumu pn(4artrif3oo1lpDe i o;t)s2ur(o oodop nmfvia( srrmx ono0apxn ietld m2ean pnt4 eerio3oa1lptrau o;s0setrio ou1llenlivsltfa2umur nt4tltoii3tyt a rlu onu)trxnmr oa1fp eaivi ()srxoir nu4al emfct ( a2ta( o;t1apxn octyd a2el(mon()tlenmo3tatfpD liesls0s2xoxm3ou4lltnmfvias sDtaumoot4opxnifeiytfaDel(vs;u)aexrxociatomDr ueil()srtr(opny1lpe mict s)artm(rp;u1oex  i3ias a2rau pn() lenmfctatopDrlies;()tetoxmpnu4ameelfvtl(farumu p;o0ape  oeild a2elumsn(4alxnmr iydfp elnvslt trur(mpiudll nlfct tfsrtru p;t0optoifetlsfs2ean ont0tlxrxrcoy1fmDeai i;s)srxrio io4lptnlict s) 2tmuro;t1ole if3tls s raumo;(4 eermf3iadoat aivo s0t2um(r ny4lmte iei tf rtm(m nu4opt  o3tyd aDra(vs;t0tlxnircoa1opDrlieol( teurir iudlmee iet s  2ur(mo;u0olenmocilsfsDranvsnt0 renmr3oodom  ai i;( t2xr(rpny4op   ieslt  Durx ont0optnmi3iltls2rl(vs;t)aexomf oytlmteanvi s seto(o3nudol  lfcia(fsrtr(r nu4texn o3iatfaDem(vp u) ltrxr3tatfm raivi ()setrirpoydop   ncilsf rraxmoou4tpxnmieildfsDrauvo;()artnxfcoa1optr i i;()tetm(m3iydaltemfctlt) 2uaxrono1olto oetytfa2ua(vs t)tetrir3iy1fmDe neo;t)tetrxr iudlltemfei s srtm( onu4aex moctyt a rmnmp;t)altrxr3io1lat auvi;t)s2trxo3no1llt lieil(farta( onu0olenmf3tldfm2rlu p;u0tlxnmrciatlaD  nes s)seum(r iydllt mivil()a2rrur ;u4opeomoetydfmDemn p;u0teeoio3oy1lptelueo t0trxm(r iydlptnmncia( srurx pou1ape  ieiltfa2rlu p u)tltrio3tytfaD auvi;t0 eurxr no4am   nei ()srumxront0apeniictasfm ranmp u)aeeoio3ty1fm elnesl(0t2xrim oo4lltnlnviltfaDur(r oo4texnmf3ilsfs em(vont)tetoir3todfm  aieils0 2ur(r3no1ap   iciat)aDurx  no1tlen icilsfsDumnvo (0 eenif3totoa ean ils0 exr(rpiydlle  ivia()a2ra(root0oetn ieiysla2emn o (0trtoxf ootoaDr uvi;t0trxo(opnodopenmiviat)arrau  nu4ape iocilt a emu o t0aleoircty1opDrliei t trumir3nu1omenmivil(  Dtrumpou4oexomfcild sDemnmo;t4 eerir3ia1fatr nvi s0 2xrxo nydal  liei t aDtm(ro;t4alxn fcilsfaDelumpnu4 eenio todlpteanvo;s0setm(r iu4ole  nvia( arrm(r ;u0apt moctld s2eau on(4arxrmfctotlpt livsls s2toim oodaltelncsas arumx p;o4oee if3ilslmDul(mp (0tleoircoodlm  an olt)seuoxo iu1ol nmfvt tf Drrurpno0tpeomiciyt m2elumpnu4 etomoctatlp  aies;s0 rum(opnu1amtnmnetl(  2tau p;u0apxomfcilsla umuvo;t0aetomociatfaD luei;s setm(m3iy4optnlfvsas)arum( o;o0aeeomfctys sDea( snu0 eenxfcoadlaD auvs t0t2um(m nu4ol nlfcs sf 2trx pnu4ale  oeilt a2ra(ms t4 rxrxr oytopDr ieo t setr(r iu1ll nliet sfsrumumpnu4oetnioctytla2emuvs;u4trtrirctadlaD  n o t texo(opny4amt mfvia()srur(mont1teeo o3tlsfa2ra(mpn(4tltoxrciadfpteluei;t  etm(m ny4ll e ncslt artm(r nu0teen o3tytla2eau s t0aexrmocio1fm r u o s)setr(rpny4omeemnes t aDtrxmo;t4aptomocilslmDuauvonu4alxnxf tytfpDraivi;t  rxoxm oo1lpt lfcil() Dtr( pno1tetniieiytfsDrmnmp (0 eeoxo oodlpD an ilt0trxoim oudlme lfesl()aDururp;o1apxn i3iytls2ran o u0 lermf tadom r u olt0trurxrpoo1ll elictas  Drrxrpou4oeen f3iyt m2ean p;()tetrif iodlpDeai s () 2xr(opiu4lle mieiltfaDra( pot4oeen f3tysfa2rmnvsnt)teerio ia1la   ivolt  exm(m3nydop nmivi s arua(ro;t4opeomoeiyd m2umnvo;u4altniocio1faDelnvo s trtrir no4omtnmieias s2trx p;o4tle  iciytla rau pnt0arenxf tytlat anvo;t  rxr(r3oy1aptnlncsltf rua(  ot1oltnmictad a2rl( o ()arxrio3ootop eauesl(0 2xoxo3ou4ll e iet ()aDra(m oo4aexnmocilslsDrauvont0altrmf3iydfmtrlueol( tetm(opio1llt mfes tf Dtrx  ou1apx  ietatlm2eln o u0alenmf3to1laDeaueo;s)s2triopiydoltemfctas)arurx ono1tpx ioctasfm2rl( o t0tltnxr iatoa elnvslt)trumio3iydoltelnesl( sDrm(m ;t4alxo o3ils aDemu o t)tlxnmr3iytfpteanei;t0 rtmxmpnudll  mfetl() Dtr(r ou0alx  o3iat m uln p u4alenir tydfa  au ilt t2tm(r no1lpe mncta( artau pnu0tet mietadfs rm(msnu4teeomf3ty1fmtr u i ( setrimpiydop  mnetat sDum(m ;t0olx mictatfm ra(mo t0 leoxrcta1laD  u olt seur(o iy4op nlnei ( s2uau p;t1tlt ioeiydls2rlnvo;t4arxoxr3oadop  aneslt  exoiopoydal emictasfsDta(  no1oeto f3iltfm2rlumo;u)arxrmr ta1laDe nei;(0 rtmxm3oudlpe lnet tf 2uaxroot4oetn fctasla emuvsnt0altnmo io1laDeaivs;s)s2um(r3oydop n ivt s)sDtmumpou0teenmociat s2rm(vs;t0aetoif iadlm rlnvs t)teumxo ny4lle  iesa(farua(m nt4olxnmoetas s2rln o;u0 lxoio3tatomDelieil( sruriopou4lm elfcsl( aDuaumont0aetnii3iys s eln sn(0alxnmf tytlatrln s;() 2urim3io4ap nlieta(  rum( oot0alt  f3ils s rm( snt0texrif oadlm  lieo t0srxmxo3iu4lmt  nesltf Drm( ont4aptnmiciydlm uauvo;u4tetrmf3iotlm rlneolt0s2xrxm io4lp e nvtlt  Drru poo0oexo fciatls2elnvo;u4trxomr3oadfm r u i t0 rtr(o iu1ll nlictasfs2rrurpoo0tpenmoetysfa2emu s t4 renifciodlate iei t0srxo(o oydap e nvs sfarrru ont0oeeoif3iys a ra(mont)tlermf3ty1oate ueo;(0 exrim ny4ol elivsas) Dtmxroou1teenmf3tlsls2emnvo;u0alerif3tytoa e ueo;t0 2to(m3iu1ll elnvil(  2umx pot0tpe  f3tasfsDemums;u0areoif oatlat lu o t)t2ur(mpny4amenlncil( arrax  nu1oleoiieiat a umnvp;t4 leoir tadomDean o;s0 2umxo io1al elfvtltf 2taur ;o4tpxnmfciltla ul(vo;u) lxrxf oy1oateli o t0 2tmio oy4aptn nes (faDtrxmont0aet  ietatfm ulnmp;t)tetomr oydopD lnvo t0 2trim3iu4om   ietat) Dtau  nu0oetomo3tysfa2umnmo;(0 lxrmr3oatfm raneilt)s2umxo3nodapte ivil(f rta( o;u4opxnmf3iatla2ranvo t)trenxo io1oa eaieo (0 rtmxmpny4ll nmics ( srrmumo;t0optoif3tadfm rm( p u4 ltnmf3oodlm   ieil( trumxmpoy4lltelnviat sDrm(m ;t1apx  iciat sDea(vs u0trtnxrctytopDelneo t)sexoir oy1ol eliciat aDurx ooo1tleoifetlslsDelu p;()texoxf oa1oaDeliesl( srxoxm3no4lmtnlfviasf rtrurpou4ale  f3iys m2ra(vont4trxnir oa1optr uvils)tetoir3iu1al nmnvt s s2taxrpnt4tpenifciyd s2emump u0tltnxr3oy1oa ran ils0t2urimpny4al nlneiltf 2rrx ono0aeeomictydlsDulnvp (4 eenxo3io1fmD luvsls)teuo(m iy1ape mfeslt sDuaumpot4ope  ictltfa ranmo (0trtriociatopDeln ilt) etm(o3oydll   ivil(fa2ua(r nt1opeo i3tadlm ranvs;(4tetrmrctydfa eai o;s teuo(o ny4lme  fetat  Dta(rpoo0olt ioeild s eanmsnt)alxomocty1om  anei;s)trxoir3oy1ameemfvsas  rraxr nt0oltomf3tas a2rln o;t)alxnmrctytfa  auvil(0sexo(m ou4al   ncsa( a2ra(mp;o4alxn ieiltfmDum(mon(4 renmf iydopt lneo;t  exr(r3nodlm  lfvils)s2rmu o;u4alxo ieiadlaDelnmon(4 rxnxfcoy1lmD ai i s trxmir nu1ape  feil(  rtmur ;u4aeeomfciat m uluvo (4trtoircoodopte u ilt  2trxm3nu4am   fcsat s2tmu p;u4olenmi3tysfa eauvs u)tlxrio3tadlmtelu o () 2tr(opoo4oleemicils s2uaxro;t0aptnifctat a rmnvpn()areoxo tydlp rauvo;t0s2uo(o oodomee fvtl(f 2ra(mpoo1aexnii3iytfmDelnms;t)tltoxf iytfmtelnesl(0trtoir3oy1lmtemfesa()s2um( ono1ale  f3iyd m rmn p;(4aexnir oadomte u o s trxr(m3iy1llt mics ( arur( pot1aexomf3tytfs um(mpnu0tlxnxf3iotla rlnvols)s2xm(m no1lmte fetlt) rum( oou1tpxomi3ias s elnmo u4 eerxf tadlm e ieslt  rtrir iu1lpenlfesltfs2tau o;u4tptnmfctldlm2em(vs;t)trxrxr3oytlpD auvils srto(rpny1aptemicil()srua(mont1altnmictyd a2ulu p (0tltoircoytopD au i;( s2trxmpoy4omt liet sfs2ra(rpnt0oeeo ictydlm2ranmp;u4 exoioctydlm   ivi;t)t2toim3ou1ll   feils)srum(  ;u0tptn o3tyd mDeanmo;(0tlenxf iotomDe n i;t)texoim ny1lm  lnesa(f rurx  ou0opxo i3ildfmDra(mpn()trxrio3oydlmtraueslt s2xoxr3iy1ameemivils srtm( oot4opto ieilt s um(von(4aetrmf3iydfmtr nes;()s2xm(opny1olt lnviat) rrr(rpoo4apx ioeiysfa2em(mpn(4tltrmf tytfmDelues;(0s2umxm3nodalen fcs s)sDuau  ;o0oeeomo3tadlm2eaums;u)aeerifcoytfm  livo;s)sexm(rpoodalt  icsas)srumuronu1oet mi3ias s rauvs t4teeoxr iadoa raues;s0 2um(m3nu1aptelneiltf Drmu  no1teenmoetlt a2elump;u0 rxnxfcoadlp  livsls tetm(rpiy4apt livi ()aDtaur ot4olto iciytlsDea(mo;()tetnxr ty1fmD  iei s) etoxrpnu4lpen ici tfs2uru oot0apeomfeiltfs em(vo;(4 lxoxo totlmtraueo ( t2tmimpiudop e icsasfarrrxmonu0aexomociydls em(vp;(4 ltnirctotoatraueo;s s2xoxm3nodom emict () 2rmump;o4ale mf3tadla2rluvo;t4tlxnmfctodomDrlueo ()t2tm(opiu1ol  mnei ()s2um(m no0tlen ocilsla2rmnms (0altnmf tatlp rlu s s)s2trxmpiu4ape  ietas sDrax pou0aexniociys m2uanmpn(4trxnxo oodfmteli o t0setmiopoodlmtelnctltf 2rm(ro;o1aeeomf3iyslm2ean on(0 renxrciydfpt  u i;s srxmxo nudol   net ()s2uaurpno0tlxnmociatfs ea(ms;(4tetnxf3tytfpteauesl()s2xm(o oy4ll  mncsa()s2truronu0olxn f3iad aDum(vsnt)aetomo todopteaieo;s  eurir io1aptn fvsasfa2umxr nu1tpx  feiad m2eanmon(0altoir oadfm   i ils sexmio3oydlptnlivil( aDumxr ot1aexoiietls mDra(vp t0trxnxrcoy1la rluvo;() 2to(r oudlpe  neiatfsrraur ou0oetomo3iltfm2rlnvpnt)areoirciodlptrln s (0 2urxr iudol elncia(f 2umurpou4tex  o3iatfs rmnmon() lxnifcoo1faDrluei;s0 euo(o oodlmt lfvt ()aDtrx  no4olx ifciydfs umu p () ltnmrciatfmDrluvo t seuo(o oydlmtnmnvtls sDrru  no0teto i3iyt a rmu on(0trtoio3oydlmtrln i s sruoxo3iy1am  lnetltf Drmxront1olx mfetytlsDumuvo t0tlxrir todom  auvilt  2xo(o3iy4lleemncta( a2taum nu1aetniictysla um(monu)arermfcootlpDeanvslt0t2uo(opoydoleelfes s)aDum(rp;t0alen i3iadfa umn s;t) eenif3iodoaDelivs;t0tetoir iudol   fesatf 2rmx poo1oetomi3ild a ran s;u0aeermo3tadoptraueslt)sexmimpny1olte neias)arua(m ou4tpt mietydlsDelumpnt) reoxfctydlaDr i s;(0 rxrxopnu1opt lfvtat aDrm(r no4tlxn ieild m2emnmo t) rxrmf3iydoaDe uvolt)setmir iudlm elnesas  rtaxr ;t1oee ioctytfs2eanms;u) lenxf to1lat ln i;s  etr(m3iudll n neils)s2ua(r ot0olx ii3tadfaDrmnms u0aetoxr3tytlpt an ol(  etoxm3no4omte fvs ( artmur ;o4tlx ii3iasfm ranmpn(4texrxr3ia1faD  i o;t)setoio oy4optn fvtltfsrua(mont1teenmf3tadlaDem(vs u)altrmo3iadfa elu o t)sexmxr iydaltnlicilt aDraxr nt1tle ioctyt m rl(vpn(0alenxo oytopDr u s (0t2to(mpiu4ol emivi t arrrur no1opxomo3iyd m2ean p;(4 ltrxrcoatlaD au s ()seur(r oudaltemnetlsfa2rm(ro;o0tlenmietaslmDelnmo;u)artnmo3ootoaDeli il( s2xm(r3oo4alt  nctatfarum(rpnt0open fetat aDea( p;t) ltomf todfpDelivols t2tmxo3ny4lpen nvsat) rrauro;o4texoifcilt sDrauvonu4 eermr3oo1oat aiesl( srumio3iu4apeemicslt a2umxr nt0aexnmfciyt m emuvonu)tltrmr ta1latrlueo;t)t2um(r iy4oltnlnes s s2uaumpno0aptnmictydlsDra( ont4areoircio1optelues;(0 rur(m io1op  mfct t)aDumx pnu1tpen oeiyslm2ra(vp;u4 exomo todfp rlu s;(0seur(r oudom   neilsfsrum(  nt1opxn f3tldlsDrlnmo u4 rtoir oatopteanesl(  etoxo3iy1oltnmfetlt srrrxmp;t0tltnmiciltfm ranmpnu4 renmr oy1lpDeliesls) 2tr(o3nu1ol nlncs t)srurx  ;u0tlen fctasfaDemn o u4 rxnxo3to1om rli o ( tetoirpiydalee nct sf rrrxmoou1ope  fetadls el(vp;() ltnxrcto1fptrluvs t) exoxm iodll  mics (f 2ra(m ;u1tex ii3iatlmDea(mp;t0aeeoxocto1opt  u o;t) 2trir nudlltemncilt  Dtr( p;t4oeeo fcias s2uaump;t0aleoxfciadlpDe ivi;s0s2toir io4ol emncs s)aruaxm ;t4optn ociatfa ea(ms;u0trenif3iytfat  i i t0texrio oo4omtn iesas)artaumoou0ole mi3iadlmDel(msnt) ltoxfctadoa  aneo s)tetr(o ou1omte fcs () rrr( p;t4oex mo3iadla rlnmp;(0tetrmo3iydlm elu o;s0 euo(mpiy4amenmics t)a2rrx p;o0opt  iciltlm eau ont4trtomr ta1oa rau s;t0s2tr(m nu1al nmncs t)arumuroou4tpxn f3tatlsDumnmpnt)trxrxr ootfpt  u i (0srur(r oo4om e fvsas)arrm(r oo0oee  ocilslsDemu pnt4trtomrcia1lmDr nes ()t2trir oodaptemnetlt)s2tm(ront1tpen i3tldlm ra( p;(4tleoif3oytfpD au s t0 2xr(r3iydam  lfcia(farrm( o;u4ale if3iatfsDrluvp;()tlxomo3oy1fa elnes (0t2xrxr iodoleelneiatfsDumur no1oeenifeiys sDean s;u)tetomrciotom rlivo s0 etm(o ou1ap nmnetas)srua(r ot0altoif3iltlsDuluvo t)artnif3to1om r n i;s sexrxopiydllenlnvt s  2rru onu0tltnmi3ilslm2ran s;u0tlxoir3ia1oaD livi t) rto(m3io1ol nmnvt t) 2umxr ;o4tptn iciydfm2eluvs;u4aeeoir3tytfptraivo s)t2to(r3no4lmeemivt tfa2rm(r ot1texnioeiat sDeau o u) eeoxrcia1fpt luvs;() exoxo3iy1omt  ict s  2urxm oo4alxoioctytlmDeauvp;t0alxnxo oa1oaDeli ols  rxo(o3nydomtnlivs (  Duru p;o1tee mfetys a2emu p ()trenxo iadlmteli o (  eurim3nodlpt  nvia() 2tru  oo0apenmoeildlm2umn p;(4tltrio iodoa elu o;s0trtr(opoy1ome  nesas srrrum ot1aexomfciasla2uauvp;u)alenxfcia1lpte ieils0tetm(o oo4al  lfctat  2tm(mooo4oeenifeiys a elumsnt4 etoif oa1la eaies;t)sexmiopiodom elfeiatf 2umurp;u0tleomoeiasfs2em( o (0aexrmfciodoa rlneil(0teum(m3oo4amtn fcias)sDumurpoo0alxo feiadlaDrauvs t)altniociodfaDe n s;t)seur(rpny1llte icsa( s2urum ot0opx iieiltls2ulump;t) rxrif3ta1fmtrauvils0seurxmpny1lme lnetls)a2taxmp;o4alxo ociasla2raumsnt4altoxf iodlatraivo s)sexrio3nudlp nmivs t) 2tmurp;t0apxoiietltfm eauvp u0texrmfciytoa elnvi;s0trtmio iodlm  livs () 2urxr no4tlxn ieildls2emnms t0tltoxf iadlaDr nes s0tetoxm nudlmenmfvslsf 2tmx ont0alxo f3iasfmDumnvp;(0 exrio oa1lm e ueol()texm(m3iu4al   nes t srrru  ;o0openmfcils m rmnvsnu)artrxf ta1faDr uvs;s)trurxrpoy1lmt  ivtasfs2taxmonu4ope if3iasfm2ranmo;(0tetnxr ty1oaDrln ols0trtrim3ny4omtnlfvs ()sDuaumpot1oleo f3iydfs2rm( p t) rxnmocty1op rln s;s0 exoxo3ou4altn nvt t aDuax  oo4tltn o3iltfs uauvsnt0 eerxo3oadlmD lu s;s) rur(mpno4oltnmfesat aDtm(  oo0apeo o3iadfs ra(mpn(0texnmr3tydomD luei;t0tetrxm ny1lptn ivsasfa2raum ;t0tpenmietasla rl( p u4 rtoxrciodlpD  ivsl(0s2xo(rpny1op nmnvsl(fsruru poo1oleniicilslaDrauvo t4tltrxrciytfp eauvi;(0 rto(m3no4amt  nes () ruaxmpnu1aptniiciasls umnvp t) eeomrciy1omDrauvol( texrxo3nodoleemnvtls  2uru  nt4oeeo octyt aDum(mpnu4teeoifciatomteli o;t0t2uoxrpiy1lpeemivslsfsruaumpot4texn o3ildfa2emuvpnt0 eenmr3todlpt aues () etm(mpiy4ol   ivtlsf 2rm(m ;u1tltomieiadla2eau s;t4 ltrif3oa1oaD luei;t  ruoxm nodop n ivtls) Dtaxmp;u4oet  ietltfsDuaums;()teermf totom e uvi t)setmxopiodam  mfvias)s2rmurpou1oltoifciat s2el(mo;u0artnifctodfm   uei ( trur(o oo4aptnlfvi sfarrmx oot4opxnii3ias sDeau s;t) ltoifcoytlmteai slt0texoxr oy1lptelfcsas) rtaumonu1tpt  octad s rl( s (4 reoxrcoa1laDe ivo t)setoxopio4lm nmivsa(fa2ua(m nt1teenmo3tls aDua(mo u0 rxrxrcoydoaDrluei (  2xoxm3iodome  ivi ()aDuau ont1tpxoioctldfm2ean p;()tlxrir oy1lp  lnes t)s2xm(mpiy1amt lnvi (fa2tmxrpou0oeto i3iysfm2eau s;u4 ltomf3totlat  uei;( sexmxm3oo1ope  nvs ( aDrm(root1alxo ociysfa2ua(mp u)trxnxf todlmDrlneo;s setm(m3oudomt  iesatfsrua(rooo4apx mf3tadfaDrmump u)tlxnio3iydlmteauesl( srumxo3io1ame livt tfaDtm( pou4oee iiciasfaDulu p (0trxomr3iytfpt  u i;t) 2uo(opoy1lleemfvias srrrx pno4oexn i3tld m2el( o t4 rxomfcootfmteanvs t  eurio3nodolt lnvsltfartrurooo1apxniieiasfaDemnvs;(4trxnxr iytfm r ivsl(  etrxm ny1lme mneils aDrax ooo4tleo i3tld aDeanvo;(4 exnxo oytfp eai ils  rxo(o io1amenmivil(f 2uax p;t4texnifetlt mDrauvonu4aexoir ty1fat au o;t srtmio3oodlpt lnci t  2raur oo4tet iocilt a2eluvp;t) exoif3tatfm elueslt srumiopou4ole  fvsl( a2trurpoo0openmo3iytfaDra(mo;(0trtomocootfpDr uvi t) 2xmxr3oydom elfcils  Duaum ou4apeo octadfsDea(msnu)aeermo3oo1oatrluvo t)s2trir3nu4olen nvs s srrru  nu4ope mfeiys s2uauvs;u)trxrmocootlate neol( t2uoxo3ny1lp nlicilt s2umxmo;u1olt  o3ilt sDemu p u0alxnmf3oodfatr n s;t0teumxo oodam elnvi ( aDrrxr ou1aptnmociad a2rln s (4altoio iatoat  n i;t t2tm(r oodapenlnvia( aDum(rooo1aptnmociasfs eauvp;t)artomocoo1la  li o;t0srurimpoo1ap n ivslt  rtax p;t1tpx mfeiltla2rluvpnt0trtoxf tadfateliei;t setrxm nodolt mncs s) 2tax o;o1aeeoifeilslm em( p u0aleoirctodfaDe ies;t  etoio3no4alt mivi tf Drr(mo;u4alxoifeiyt sDranvpnt0areomo iotlatr uvols)trtoxr3ny4om  mncsa(f 2tau pou1olxoifctytlm2elums;t0alxrxf3oadlp rluvs s s2umir3nudam   nctls aDraxmpot4opx  oeildls2elnmp;t0arxrmf iy1omt  ueo t0 eumio oy1op  miviatf 2ra( o;o0tle io3iyd a2el( s t4 lxnxociytlm e i il(0 rtm(r3ny4apenlfcilt  rtax oou4aetnmf3iyt m rlnvsn(0 etomr3ia1faDe i i t t2uriopiudaleemiesl()aDrrxr no0ape  feiasfm2ulump;u)alxnmr oa1fatr u o s trxriopoodomtnmfviatfs2uaxmpou0tptoifciydlm2elnvp;()artoxf3ty1oaDeli s;t t2uriopnodolt  neiat aDrm(m ot4altn o3tyt s2uanmp;t4 renmrctatomD auei (0t2xrxo3oodolt mneslsfs2rm(r no1tltoiocias m2uau p t)texnxfciydla rlueols) euoimpno1am  lnvslt)srrrx pou4ole iociatls rlnvs;(0teerircoadop   i s t) eum(mpoudameelfviltfa2rr( pot1opt mf3tyt m umuvo;t)texrmo tydla rluei;t) 2xo(m3oo4omeelneils)s2ur(  ;u1tet mfcilt mDrmuvont)aexrmr3tadlateli i s0 exmir iy4ll nmfesatf rrm(mp;u1tpxoiietas a2rmu pn(0artrif oytomD  nesl( teumir3io4alte icta(  2rrx p;t0tlxn i3iytfm2ra(monu)aetrirciytla r uvs;() rtmir ou4ap  lncslt) 2rrxr no4tptn f3iaslaDrmnvsnt) eenif oodlateanvi;t  exr(o nydalt livils  rtmumoou0tlx ifciyslmDuau ont0texrxo3todlaD livolt) rtmio iu4om  mncta(faDrrx  ;t4olx mf3iltlm rl( p;u0trxnif iytoaDelueo;t) rtmir3nydame liviat aDtrum ;t4aetn f3tadlm2elnvo;t0 ltrmfcoadlpD  ieols)srtoxmpoy4lp  livtat)artm( oot0teeo fciasfm rm(vsn()trxoxf tatlmt livs;()s2xr(r iu1ap   icsl() rtr(moot4olt iiciyd a2ul(mon(0trerxrcio1lpD lnvs;s)srxmir3io1lm e iesatf Dta(root1apeoiociyd s2umump;()tlxrio3iydoat luei (0srxoxr3iu1lmee ieilsf Dtaxront1tetomietat s2rm(vs;()tleoircoodomtrlu s;t) 2uoxo3ou1ol e ictls)aDtr( o;u4apeomictlt s ea(vp;u4 ltnir3tatlatelnvils s2trirpnydlmen ncs t  2ta( pnt0ape iieias s2ranmpnt4texrif tydlmte n sl(0trtr(rpno1ap   neias) Dururoot1aeeniieiadfm2uanmsnu0 exnmrciotomDran s;t  rxrxo3oy1omenmfci s sDrmxrp;u4tet ioctltfa2el(ms;u4 ltomf3oatlpDeanvo;() rtm(m oydlmee neiat) ruaxront4apenmoctls m uaums;u0 exnxf tytopDrln o s0srxm(o nu1om e fetlt sDrmxrono1ape mf3iytfs2rauvs u0tlenxr3oodopt  ues (0 2um(rpio4omt lfvs s)arrm(rpnt1tpxn o3ildfa2raumpnu0trtrioctytoa rlivs s)t2to(m iu1al elicsatfs2taxroot0tlt iociysfaDemumpn(0tlxomr3oodfm   ueil( trum(opio1lltn feia(fs2taumpot0opxn ieildls2rl( snu0 rxoxrctatfpDeli ols0t2xo(opoo1ol nlfvs s arur(mpou4aptniietyslm2ulu ont4texnio3ta1op r ivi;s0 etrxr iydlpt lnvsltf Dtaum ot1aet mieiys m2ul(mo;u4 lxnir oa1opD  nvo t)s2tmxrpiu1ame  fcta()sDrau p;u0alxniocild s raump ()arxrxr3iatlaDraivil()t2xr(mpoo4omeemfvia( sDururo;u4oetnmfeildfsDuaumo;u)alenmocio1fpDraneo ()trxmxr iydopenmfcsat  Drmumonu4tle  oeilt s rl(von(4trtoir3tadlatrlivilt  exo(rpno4ll nlnesatfs2rru pou0apx mo3iasla2em( p t) etoxrctotfmD  uvol()srum(rpiydlp   ieiltfaDrmu ono1optnii3ildfa2elums;t4 leriocty1lptrlnvslt teto(r ou4lleelies sf 2urxrpnt1aetn ociat a emnms (4 rxomo ia1fatraueols  2umir3nu4olt mfctl() Dtmxm ;u0aeen octlsfaDumnvsnu)texrxoctatfpteai o s)s2tmxr iy1lme liesasfsrraumono1tpto fcildfa2el( o t0trtomo to1fmD  ueo ()sexmiopiu4lmtelfetlt artaxro;u0tee iictys s emn snt0 rtnmf3ty1late nvs s  rtm(m3iudal nlivi t  rrmxronu0olxomfcilsfa2emuvs;(0aleomrciodoa rln o s) rtmiopno4ameemneils  2raur no4alt if3ilsfa2eanmpnt0texoio oydlpDeli i;t)tetrxrpoo4lmeemivi t  rumxr oo1oetniociatfs2ranms;(4tltnir oadfatrlnvi (0texmimpiudopeelnet s)aDum( oou1apto ieiad aDrmu p (4aleoxocto1fmtr uei (0setr(rpoo1amen nes s s2ur(r no1optnmoeiytlm el(vs;t0trxoircoatfp   ueol(0t2xoxo3oodaltnlnvi s sDurx pnt4aetomo3tls m2rmu p;()aetomo3io1lmt  uesl( s2umxo nu4op e neias  2uaumonu1opx iocilsfa2rlu o t0aetoir3oo1oaDr ieo t  rxmim oy4lm emnvils  2tm(m ou0olx mocilsls2rm( o t0trtoioctotomDr n ils tetrxm ou4ap e nvtlt  rrau  nu1tptomf3ils mDra(mpnu0 lxnxoctodfa   u i;s) eumir no1om nmivsl(farrmxmpnt4olxnioeils a rm(vp (0trerioctydom r neil(0teumxm3iydol  mnvia()arumu ono0tpxnif3tasfa emnms u0aetnxfcta1faD aivo s)trxoirpiy1alte nvi t srta(rono4optnmfeiatlsDua(vo;t0artoxf3oatfp eli ol( s2uoio3oy4llenlnesat) rrru pno4tpxnmoetadfaDea(mp (4 lxoif3oytfmt ln i;s  rtoxo oy1ame  ictlsfsrrmx  nu4ape ioeilslmDul(ms;u4trtnxf3to1oateln s;s0s2tmiopiydameemfet t) Duax oot1oet if3iat aDra( p u0alermocoo1omD lnvils)trurxo3oo4aptnmnvt () 2trumpou4openmi3iys sDrl( s t0aeermr oo1omDelies;t0s2tmio no1lp  mfctas)sDtrx ono1tlto o3iasls2ulnmo;t0 eerir3tydlptrliei;( trtrio no1amenmietlt a2tm(r ot0apxnii3iysfm emums;t0teermociatoa  lies t0srtm(o3nu4llt lnvs s)srumxrpoo4tpxomictysfm2eaumsnu) etoif iytopte i o ( trxrxmpiy4al nlncil( s2tmxmoou0oeenmoeiyd m2raums (4arxrirciadomD lnvo;()setrir iy4lm   fcilt srtr(r nu4oltniieiyt s2em(vp u)trtomo3ootoa  aueo;t) rto(o oudal n ncslt srumum nu4oetn ociytfs eluvpnu)alxrxf3iydlmtranvsls)srtrxo ny1alenmics sfsrtmumpou1olxo i3ildfsDrln pn()tlenmr ootfp eauei;s0s2xoxr iy4lpeelnct (fs2rrxrp;o1tlx ifciadls eauvs;t)tltrxr iydfa eaneo s0sexoimpnodopte fvsltfs2rm(m nu0opxnmieiyt m2em(vsnt4 ltnmo3iadlm rlueols)teuo(m3nu1aptnmnviltfsrtrur nt4tpeo fciat mDranvs;(0 rtrio tydfpD aivi;(0srtmimpoodlpt mnes t) rrr(ro;u4tptoifciltfaDem( p;()arenir3to1opDeaiei;(0srxoir3iydaleemiesas) 2rru poo1tetomoeiydlm elump;t0 eerircio1fm e u s;( sruoxm oudlmte neias sDur(r ;o1openiieiyd mDelu p () exrifcoa1fm rau o;(0s2trio3oudol n ncs tf Dtm(m nt1tetomfeiasfs rmnmon(4 rxrxr3ia1op raiei;(0t2tr(o3oy1alenmnesls  rrm(rpot1tetnmoeiatlaDumnmo u0 lerifciotopDr nvi;( s2urxopnodap  livias s2rrurpnu4alen ociysfaDrlums;t0 rxoxfcoy1lpDeauvil() 2umxr3iu4am  mfvsa()s2ra(m oo1texnmi3iasfs2ranvo u0texnif iy1lp rlnesl()sruoxo3oo4opt  ivilt sDrmxrp;o4apt micias m em(vsn(4trenir todoa  ln ilt) 2toirpou1om e nvsl(fa2tax ono0oeeniietasls eanms;u)aexnir iytla  ln s;s0 exm(rpoodamtelnesl(farumum ;t0alt  fciydfs2eluvo;u4alenxf3iy1lm   ivi;t0t2tmio3nodol elfvt ( a2urur no0aee mi3tlsfa rln pnu)aleomo3oy1fmtean o;t0teumxm3nu1olt mnvi tf Dtaurono4oexnmiciys sDrmuvpn(0areoirctadfm eanvol(  rtmir nu4lmt  fesatfaDrrumo;o0oeenifeilt a2emnvo;t)teenmo ty1fateau i;s seumim io4opt  nvsa(  2rmu pot1tpe iieiydls eaumo t0 ltomo oa1fpDrlneil() etmio nudapenlfvs t  Dumx pnu4opx  i3iytlm2ul( ont) rtomf tatfat au ilt)seuoiopoudlmenmfcil( sDumu  ou4teeomiciysfs2rau pnu)trermf oytomDraivs;s) 2urio oudopte net s a2rr(m no0alx ii3ias s uau p u) rxoxr iydfp e n s t) 2uoir3iodomenlnetat)sDur( p;t4oeenif3iyslm2rl( ont4 eerif iytfaD livs (  2tmxrpnu4am   fesa( sDumu  no4apxomieiaslmDuanvo;()aeerifcoodlmteau ols srumxrpio4lptn nvta(f Dtmxm nt1oexn fetatlaDulnmo (4alxnir3ia1omtean sls0seurxr3iy1lltn nvslt)a2raumpoo1olx mf3tyd a2umn on(4artnxfcoy1lpteau il(0 2xmxopiudam emnei tf 2ur(rp;u4tlxn o3tlsfs2elu on(0aetomo3ia1om eauvilt0tetmxr oudlm  micia() 2tmum ou0oleomociatla uaump;u0alxnxociatop eau i;t0srtmxr3nodap n ivtls)aDum(  ;t0tpenmoctadla rlu s;u4trxomr ootlpD  ivilt)tetr(m oudllen ivtlsf rtaxmp;o1oexnmiciadlaDean sn(0aeeoir ty1fpte uvs t0s2xrxmpoo1oltn fctas s2urur nu0tlxn fciyd a2uln s t0trxoxocio1fmt  nei t) 2xrxm3iu4lmeemfci t)aDurx oou0tlx  o3ias sDul( sn(4aexrmo3ootlp   n ols) euo(m3oudamenlfesa()sDuax onu1tlx  ieiytfsDranvont0 rtrxociy1om r nvolt)teuo(r3no4om emneslsf 2umu poo1opxn ieiyslaDel(msn(4 rtomo iodlmDr ueslt) 2tr(rpiu1llt  fvtlt  2taump;u4tex iocilslm uanms (4aexoxfcoy1laDrlu o s trxrio oo1open fcsltfs2trurp;u1oeenif3ildfm ean s;t) ltrmf tatopteli il(0t2xoio3oudlm e fesa(  rrmurpot4oeto f3tat s ranmp t)aexnxo3iadlmt  u s s)trtrxopiudamt  nci t)s2tau o;u0aeeomieiat mDrl(mpnt0alxoxr tytla e iei t0teuo(opnu1op e fcias  2tr( pno1alxo ieiydfaDelnmo;u4arerxo oo1lpDe u s;( srtoiopny4lp  mieia(fsDuax oot0opxnifeilsfm2rl(mont4texnif io1fa rli o ()s2triopiudaleemnvsa()a2rrxrp;t4aptn i3iasls rlnms;u4aexomr todoa raneo;s teto(o3nydlp emietls)arua( pou4altnio3iysfs2um(vo (4arxrxr iydop ranvo t)s2to(m oo1openlies t  rrrxrpnt0apeoifeiad m el(mp;t4alxoxrcoytlpD  uvslt) rtoxopiy4lltnlivtl()sDtr(r ;o1tlxnifcilsls eaump u)artoifcio1lateaueo;t  eumir nodal n ictl(f 2taumooo1aetomociydlm2rl( p u4aexoxf io1fmteanei s0t2xriopny4apte nctasf rtmumo;u4opeoiicias s um(monu0aexnmf3iytfm   ieils)s2tmirpno1lmeelfcsa() rrrx ono1oeen ietlt m rm(vpnt0tlxrmocoytla elu i;t teuoxm oy4al  lncilt s2ur(m nt1optnmf3iad mDra(mpnt0 etoio ia1fp   n s;()srur(mpnu4oleemiesl() 2uaxr ;o4teenmiciadfaDemnmon()tlxomo tatfm  au s ( s2um(mpoudlmee nviatfs2rr( o;u0oeeoifctadfa raumsnu) lxrirciotfpDelueo;s0 rxm(m ny4omtn ict (  ruaxr ;u1tlx  fetlsls rauvpnu0 etoxr oadfm ran slt0t2xm(r iu1lle lnctlt)aDrmumo;o0alenmf3iat sDumnmpn()altnirctatfpD  u s;(0 rtoiopnydal nlneil(fsDtmx pnu1tpxn ieils a ran o u) eenxocoa1fpt  nvi s0t2ur(m ou1ameemfei s sruax pnt4optoiocilslsDuauvp t4arxrmf iytlmt liei;s)seuoxopny4ame lfcsa(faDrru  ou1tex iietlsfaDrmn p u)trtrif3tytfpteluei s)texr(rpno1lmtnmiesl()aDrmump;t4tltoifciadla eauvs;t)teeoxf to1fpDeanvsls0 rto(m oy4lltelnctat srtr(m no1apxnmf3iadfsDemnmo;() rxomr3oytlm  lu o () rtm(m ny1ole lfeiatfaDta(mooo4tlxnmo3tld m2ulnvp;t)artoxf tadoaD aues;s  2trxm3oy1ol n nviltfaDtr(mpno0tptnmf3tydls ranvs (0 eeoir io1lmtean ols0 rurim nodal  mfct t)s2um(mpnt4opx iicils aDuluvo (0 etnmr3iotopteaiei (0 2tmimpiodlmenlivtas)aDtmumpno4tlxn fetlslm2ea(vsnu)artrmf todoat  nes t) rurxr nydamtn nes s artaxr oo0tetn oeiat a el( o (0 rtnio3oydom rlu sls0tetm(rpiudapen ietl( arta(mooo1tet  f3ild m2ul(vp;t)artoirciotfpD lueil()sruoimpiudlltnmnei (farrru  ;o1ape  octysla rlnvs;t4 rxnxrcootoa  ai s;t) eum(rpoudal  mics t  rurxr ;t4ole mociltfs2uluvo u4trtrxrcoy1lmDelieo () 2tmxrpoodomte fcsl( sDurxr nu4tlx  iciadlaDrmuvo (4arxoir tatla  lu olt srtm(m oudalt  icia() rrmur ;t1alt iieiydfa uauvon(4 rxoxociatop e i s ( texm(r3ny1optnlfeslt aDur( p;o1tpe  fctls m2el( pn()trxrmo3tatfm   u olt s2xoxrpiu1lpt  iesat s2urxr ;t4apeo ieiat s2rmu s;u)areomoctytlpt aies s texm(opnodllen ncil( sDtmur ot0texoif3ilsls ra( on(0 rerirciytomDe i i;(0 rtr(r3iydlmt lfcsl() Drrxrpnu0tleomociatlm elnvp t4altoio todop   i ols  rxrxr ny4al n neias srtaxr ot4alxo iciadfs rm(ms u0alerif3oatom rlues;(0t2urxopoo4ol nlnciat) Draxmonu0oeeomoeiytls2eln o;u)arenircto1la e n s;()srtm(m3nydame  nctas) Draxmooo1tetniociyd m2ulnvp u)arxomrcoo1fmt ln i t)teto(m oo4am nlivtl(  2um( p;t4oee  feilt sDrmnvp t0trxoir ty1fmDr n o;t)t2trim ou1ll   feias  Drax poo1aex io3iadfsDran on(4aeenxo totfptrlu sl()s2um(mpiodal elfct t)srrmxmpnu1tetomfciydla ea( s u)areoxf3to1lmDr ieo s0 rumxo3no1am  lncilsfs2uau o;t4tet ifeiat m rlums;u)altnif3io1lmD  nes;t  2xrio ou4omeemieiat) 2rrxm oo0oetomfeildfa2eluvs;()aeeomo3ia1faDrluvols srtmirpoudaltn fetlt) rrmumoou1tpxn o3iydla2eaump;()arerxr3ia1fmDelu s s)trxm(o iydlpenmnetas)artmum ou1oetoiictlt a ul(mp;u4 leoxf3oytlpDe n ils s2xmxm nodom n ivi t) Dtrurp;o4tlxo i3ild s2ulu s;t) eenmf to1fptr n i ( sexo(m oydlp n fci (  rrrum ot1opx  i3iydla uauvo;() rxrmo3iy1fmDe u ils0 exrir3no4ole mnvtlt)artrumooo0tlxnmfciytfs2emumo;(0trxoio3ootomDr ieo;s  etmir3io4openlfesls) rrrxrpnt0apx mo3iatlmDrm(ms;u0tlxrxrcoy1lm  livs;t0 eum(mpoodop  lnesls  Drm(mpnt4alxnifciyslaDul( pnt4aexoio3oy1lp  aivo t trtoxm3nu4lm emfetl(  ruau oot4oexnioetyslm rlnmsnu4aexnmo oadlate uvsls  rumir ou1am nlivil(fsDtaxroot0oltoioetaslmDrlu o (0tetrmo iadomtr nes t t2tr(opnodomen fvil(f 2ta(m nu1oeeo icildla2em(mpn()tetrif oodopt  neilt tetmio3oy4oltemnes ( s2tm(m no1olx io3iysfa2ea(mp ()treomo oo1fmDraueo ()srxo(o oy4olenlfci ()s2rrur oo1oeto ieilsfmDeluvs (0aeerircoydfmDr ueo t t2xoimpno1llt  ivtl( arur(m ;u0olto f3iydfm eauvsn(0artniocoydopDr neo;() 2xriopnodlmee ictatfsrrrurooo1tpe  i3tldlmDum(mo;t0arxrxocoy1om eln slt0texrxm no1ol   fvt s)s2uau  ou4olxo i3tadfs rm(vo t) eeoxrctotfp e n o () rumim oodop emfvt t s2tr(rpot1tex iicilslm ua(vonu)arerxocta1fa r i slt0 rtmio3io4omtelncs ( a2rmxrpot1opx  oeiydfs2rmn o t4tetnxf iytfpD aivi ()s2urxmpiy1op nmfvils aDrr(m no0oet if3tldfa2rluvp;u4arerif totom   uei s)trxmimpoy4lmt lfvsltf Drau oou0aeen o3tls sDum( o;t) rxnxfctydlpDr iei t0trtmim3iy4amtelfvtl( arraur nt4oeto fetydla2rau on()teerxociy1oa eaivil()s2uoim3iydoptelnvtlt) rrru pot4olxo i3tlslsDranvs;u4tleoir oatom e u s (0s2xrim nu4op elneilt a2tmu pot0aptomociltla2uauvo;u4altoifcia1oaDeaneo;t sexoxo3oy4aptn iciltfartm(mpnt1oleo iciyt sDul( snu) etrir3oadoa r uei;s0tetoxo nodlm nmici t) 2tr(  oo4opx iieiasfa umnvp () lxnmfciotla rlnvsls t2toiopiy4ol  lfcsa() 2taxmp;u4apxoiieiys m2um( o (0 rxnir3oa1op  lnes t0 2umxrpio4ol nmnet tfs2rmu ooo4oexomocilsfm em( p;(0tltoifcoodla   n i;t teum(rpou4lmenlivtlt) rtrum no0olenmfcils sDelums t)aetoxr iatopDr nvo s srtoxmpoy1ll nmnvt (fsrurx  ;t4aeenii3iys mDrmump (0alxrirciadopDe u s;( srur(rpiodop nlfesat  Draxrpot0tpxnif3tls m2uauvsnu)altrmfctadla  aues;(0srxm(o iodap n ivtat  Drru p;o0oltn oetltfsDrmumsnt0arxnifcto1lmt anei s0 rxoir3io4amtemiei (faDtaurp;t1tlxoiietadlm uauvp;u0 eenxfcio1opt aieil( srur(o nydap  mfviat)sDra(moou4tpx ifciatlaDem(vp t) renmf3iatop   n o;() 2xo(opiu4lmee neilt)arumum ot1olxn octld m ranvp;(0 ltrmf oa1opDrln ils  2um(opoydllt mfcta(farum(m ot0aptoio3iys m ul(vo;u4teenmr iytlpD lnvolt  rtr(r3oy4lmen feilt)a2ur(rono1oltoioetytlm ea( s t)teenmocta1opt  ivs;s0 2xo(mpnodam emivi s  2ur(root4tpx  ictlt s2elnvs;u0altrif3tatlmDe nei (0texmxm3ou4lleemivi t sruax pno4teto oeildlaDrmnvpnt0areoxocootlmt au i;t0texoim3iudopt lietat sDua(m no4alx ifeilslmDrlu sn(0aetoif oy1fmt  n s ( trtr(m3nudlltelnetat)sDurxm ;u0tpx  f3iyd a2elnvpn(4alxoif ta1fmte i o;s0t2um(o oo1apte iciltfa2tauront4tpt  i3ildfa emnvpnu) rxnio iodlmtrluvol( s2uoim oo4lleemnci t sDurx  ou4olenifcils m2eauvp;u)trerir3oy1lp  ln slt) rumxr oudllen fci s  rtr(rpoo1aetn f3ilsfa rlnmon() lenxf oydop   uvsl(  ruoxmpou1alenlnetl(fa2uaum ;t1oexo ictytls2eau p;t)aeeomf io1lmDeln o t trumim3io4aptn nesa(  rtmx ono1opxnifciys m umnms t)altomf3iodop r n o s)trxo(r io4olee netasf 2ta(rpoo1oet ioetls s umnvsnt)alerxoctytfa rlivo ( sexmio3ny4open fct ( a2ur(  ;o1tet mfctysfm2ua(mp;u0aexnio3oodlm r neo;(0 2ur(m oydllte iciasfsDrmxm ;u4tpeniicias m rm(vs t0aexnmr3iytlpte nvi (0 rur(m3oy1lpe  fvsl( s2tmxr nt1oeenmietlt mDra(ms u0arxnxfciodlatelivs;s0 exoxo oo1lp e ivi s a2tru  ;u0ope  feiltfm2eaump () etoxo3iydlaDrlivslt)trxrio3iy1al elnciasfaruaur oo1oetnii3ilsls em( onu) rxrxf3oo1oatraiei;s t2umxr3iodllt lictl(fsrrmx p;u1tlt mieiadlsDeluvs (4aetnir tadfm  lu ol(0 exrxrpny1om nlfvsasfs2raxrp;t1oltn ieiyt m ea( pnu)trtoiocoo1fp  auvo ()trxr(r iydamte ieta(f Durx ont1aleniicias sDrluvsnt)trerxf3iodoat lies t0t2toimpny4op elfvilsfa2umu p;t1tpxoiiciyd s umn snu) lxomf tadlp  ln o;s srxmim oydom   icslt  2uru p;o4apxomi3iydla2elnmont4aeenir3tytfatr uvil(0 2xmim3ny4llt mnvs tfs2rmxmpnt0teeo fetadls umuvo u)trxomfciotfa   u s;s srxmirpno1lpeemnvia(f 2rr(  no0altnmicild m raums;(0alerir3tadlaDe uvolt0t2umxr no1ll  mfvt t arumu o;o4teeomocilt sDrmn s t0trerxo oodopDelnvi t)s2to(r ou4aptnlictlt a2uauro;o1olxomoeiatlsDran on()arxoiocoadlp  auvo;(0sexo(o iu4omeemnesls  rraxm ;o1aexo i3tadls rm( o;(4alxomr3oytlat  uvol() rxmxopiydllt  neilt) 2rrxrpot4opx  i3iys s2emnvsn()aeeoir3ia1opD  i i;t0 eumxm nudamt lnvi t) 2rrxmpoo1oee ifetldfm2ra( ont)trtomf3tytoptelnvi;t0srumxr3iodapte icsas arrrxr nt4tee miciat s emnvon() rerxo iydlat  ieils0 2um(opoo4olen fvils)artau oou1alxn feiltfsDea( snu)texomo oytfmDelnes t s2urir oydlp emneilt a2rau ont0aexomfcilsls2ra( pnu)tetomocootfp   ueo ()t2trim3oo4ale lfvias  rraxrpou0apxoioctltlm eau ont) leomocoytfpDrluesls0teurxopnu4amtn nei ()aDumxmo;o4tlx mfeiydfaDul(mon(4artnir3totlpte ivo;(0srtm(m3oy1alee ictlsf rrmx o;t1opxo o3iat aDuan p;u)tltrxfciodfatr ieo ()s2tmxmpiu1al  mnci tfa2tau oot4apxo ieilt s2eaumpnu4teeoxf3tytoatranvo t) eur(m iodalt lneslt) rtrumonu1apt  ociasla rln pnu0arxrxfcoodfpDrlu s t) 2urxopnydlpe lici sfsDtaxr ou0apen oeiltls2ra( o;t0arxomf3io1fmDeaieil(0sexr(r3nu1am e fcslt  Dta(rpnu4tpeoio3tyd s2eanms;u0alxrxo3iy1fat auei t)teum(m3nudame miet t  Draur ;o1tlt ii3ias m umuvon(0tltnmf oy1omte uvsls) ruriopiydomee iciatf rrrxmonu4tleo oetys a umumsnu0alenxf3ta1lpDran s;t t2uo(o nudap elicsat aDtrur nt0tpe  fcildlm rmnmo t0alxnmf3tadfmte nvo t0s2uriopou1ol emnciatfaDurumonu4tleniiciad s rmn pnu) rxnir todfm elieo;(0 ruoim oy4lmt mfcilt  Drr( oou0tpeoioetydlm2el(vo;u0treomf3totop rln o t s2ur(m3nudaptnlietls)aDta(  ot0aeenio3iatfaDra(von(4altrir iydom r ues;t)srur(m iu1ap nmfctlt aDrr( p;o4tlx  ociyt aDeanvonu0areomo3tydomt an o ( srum(rpnu4llt miei s aDtaxm ;u1tpt moctydlaDea(vs;t) eenmr3iadlmDe ies (0tetr(r oydll elict s  Drmx o;u1oee mfctlsfm2ulu s;()areomr3iotfm e nvols0srurir nudlp elics (fsDtaxroou0ope  oeiydfs ul(mp;t0artrxr3oytla   nvo t)t2tr(r3nydomtnlnci s a2tmxm nu4teto o3tydla eauvs t4trxomf3iadlmD ai i s trtmirpiodlp  lncsltf Draumpou4texoii3iadfsDrl( s (0aexomo3oytop eln s;() 2toxopnydap nlfvt tfarta(m ;o1oexn feiatla elnmp u4 etoir3oytoaDranei;(0seurxr3ou1olt  feiat  Duaumpnt1tpxniieiltlmDelump;t4 eeoxoctydfatelnvols)s2uoio ou4amenmicils  rurumpou0tpt mfciadfm emumsn() lxnxo3iy1lmD luei (0srxmxmpoydlptnlivsl(f 2uaumoot1oeeniociysfa umn onu) eenxf3oodop   neo s)trxm(m3iy4lpe lfvs t  2um(rooo4oet mf3iys a rmn onu) ltomfctatop rai ilt0t2tmxm3iudlm nlivias srtaxmo;t4tleomieildfa2eln ont)trtnifctodom elivsl()srxmiopio1ap e ivs s) Duax  nt4apx  f3tydfaDemump () rxnifcoatopte iesl()sexm(mpno4op nlnvia()aDuax  ;u4alt mfetatls rmnmonu0alxnxrciotlaDr nvi ()s2trim3no4al e fcs ( s2uax pno0oleomfcilt mDrlnvs ()aexoxo3iodfm e ueslt0srur(r3oy1lm  lfcsatfaDtmu p;o4aleoio3iasfa emump () eenircoa1lmDr n s s  2urir3iy1aptnlfcslt)s2rmum nu0aee ifeiat a emnvsnt) lerxrcio1latran ils0 rurio nodll nlictlt  Drax  ;u0opxniiciydlm emnmo;t0trxoir ootopD  i sls)teurirpny1oltelietl(fartm(rp;o4oeeo iciaslm2emu p;t0teeoxr3oatom rai i;t)trurimpnudal  mnvsl() Drmxr no4texo feiydla uauvs t0 rtomf ootfm ranvi t)trurir3io4lmeelnvi tf Dtaxronu0apxn o3iatls uln pnt) etnmr oo1lmtelnvs;s srumio nodllte nvs s s2rmx ooo4oexnmfeilslsDemumsnt)altoirctytopD  u o s)s2xoxm nodopen fcta(f rua(m nu1openifetat s eln sn(4 eerxrcta1laDrluvs s srxo(o3oy1lmtnmivt t srrau pou1alen fetytlmDel(vsn(0 rtrmrciatlmtr nvi;(0 2urxrpio4am n fviat aDraxrono4tpe  oetlsla2ua( p;u)trxrxr3oa1late i o;t0teto(m3io4llt miet tfaDum(mpou4apeo fetydlsDul( s;u)arenirciodfptr nvil(0 eurxopnodaleelnctlt sDuaump;u0tltn f3iad a2ra( p () reoirctatfa  an sls)s2umimpio4openlivsa(f rtru ont0apxn fetldls ean pn(0aexnifcoadom elieol()srxrxm iu4ol   ncilt  2ua(moot0tlenio3iys m2el(von() exrxfcto1opDrlues;s)setr(r3iu4ol   ieias artru pou4tlenmf3tldla ra( o t)tleoircoo1latrlivs s)trxmxr ny4ole mfetatf rumxrp;o0ape ii3tltfmDrmu snu4tlxoir ootomDrauei s)t2umim3oodalte nvias)s2tm(roou0open f3iyslmDelnvsnu4 rtnxf3to1op  an i;s)srxoxopio4aleelneils  Durxroou1opxnioeiys a rmuvsnt) rtnmf3iotla rli i t s2uoxopoy4omtnlneias)sDtmx pot1ole ioeias mDrm(ms;(0tetnmr iadlpteanei;t  rxo(o io4olte fvia() ruax p;t0oleo ictls s2elu p;t4aetoxrcoytoatrlnei (0 2urir3iudalenlnesa() Dtmump;t1aex  f3tldlm2ra( pnt4aleoircoatopDrliesl()trxmxrpno4lm   ivsa(f 2ra(r no0aee iieiatfs2umu o u4aexrir io1fpDe neo (0s2tr(r3oy1llenmfeilt  2taum ot0tleo f3iaslsDemumpn(0aexrmf3ootlp eaieils teumim3oy1ale lfesas srtaxmonu1oexoifeiatfs2ulums t0 leomr3iytoatr u s;s0 eum(opny1amen ivs t  2rr( pnt1aet mociytfa emnvs ()arenmo3iodopD lueo s seur(rpiy4omte nes s)sDuaxr ;t4tpx if3iad a2rlnmp;(0tlxrxr3io1fmDeanvil(0trur(opoo4alte ncsat a2ta(r nt4tlt mictldfaDea( pnt)teerio3tydlaDraieo;t) rumxmpiodopeemivsat a2umu ono4opto i3tyt aDeanvs;t)arxrxf3oadop elueol(0srtrxm3ou4am elfcilsf 2tm(ro;t4tpx mi3tltfa em(ms t)trxoir todfmt auvsl()sexmxo3oy4lme mict s)aDra( ono4tpeniociltfsDum(vsn(0 eeoio3ta1fm r u o;s0srtoxm ou1oltemiesat  2rr(rpot4oexniiciadlaDum(msnt)arerir3todom e iesls)teuoxm oudam e nvt t)srtmx  nt4apt iieiasls em( p t4 lermf3todfm   neo;s  rur(m3nodapen ics sf Dtrx  ;t1opt mfetlt mDeanvp (4tetnmo iydoptr u i;() 2umio nu4al  mivta() rtrum ot4tpxoiociadlm2umuvsnu0areomr totfa eluvo;s trxmir iudame lfetls  2trxr ;u4apenmietls a2ra( p u0tetoxf3iotlatraueols0sexrim no4am nlicsl()sDtaxrooo0aexo i3ilt s emuvs;(0aleoxo3todoat li o t0s2xrxo ny4al n ict s  2ra(r oo0aeeoifeils m umn on(0 exomocoytla   ieols  2toio3oudaltelicsls)aDtm(  ot1tptn o3iyt m2ran p;u4 etomo oodlaD aies;t t2tm(r3oudalee fcs (f 2rrx  no0apx  f3ildfs um(vpnu) eenifctytlm e n o;t0s2umxm ou1op nlivtlt)arrmx o;u4tle ioeiatlsDeluvs u)trxoiociy1lm e u il() 2uriopiudlp e fesat) 2raxr ;o1tpxn i3tydlsDrm(vo u4aeenmfcoy1lp r neils trtr(opoy4ameemncs sfsDua(  ot4optniietyd s2rlnmo;(4 eeomfcta1faD ai o (  euoim3iudop  mivtltf ruaumpno0olxoiociatfa2umn on(4 rtoxo oa1lm  lu s s trumxrpiy1oleelncs sfa2tm(rpot0tee if3iydfmDum(vo;(4trenmf iotoatean o s  exrxm3iy4amenmivtatfsDraurooo0tpxoioctadfa2emumsnt)altnio3tadfpDeauvs s srtrxo3ny4altelnvi (farur(mont0oeeo fctltfm um(vpnt0 exoio3iotomDrlneo;s tetr(o3iu1ale  icilt aDur( p;t1tet  fetls m uaump;t) exrmocto1op  luei t trxmio3no1olt micsas  Durum ;t1openmoetldlaDranvpnu4aexrxo3oytfpD ai sl(0s2tmim oodlm  mics s  rtaumo;u0teeoiictat s2ea(von(0 exrif3ia1fa   uvo t0sexmxmpoodamt lnctls)sDtr(mpou0alt mfcias s2eluvp;u4tlxnmocoy1op rlueil(0 rxmio oudope  ietat  2rmxm no1oleo oetldlmDuln on(4tltomr3iadfateaueo;()t2xr(opnudlmtelnvtatfa2rruroot0aleo ieilsls2rmn p;u0altomf tydopD aneolt  etmxrpoy1ale  nvta( srrau  oo0oetnifeiytlmDeanms t0 lenmf ia1oaDe i o;()t2tmxo nodlme mfvt ()sDtrx  nt0aetnii3iad s eauvp;t4tlxrmociy1laDeau s;t)srxm(o oo1omenmnvslt  rrax ono0tpxo f3tlt sDea( onu4aetnio3iy1lpteli i;(0 rtmim nodalte fcs t s2rm(roou1oetoiiciatlm2rmnvp;t)areomfcty1fatelues;t)t2toir iydopte fviasfsrrm(mp;o4oexo oeiadfs2ranmpnt)trtoifciy1op rln i;t) 2xm(r3iydapeelnct s)sDtrumooo1olenmi3iydlsDra( o u)aexrio oatlptrlu o (0t2to(m3nydlltn feslt  2ra(  nu0aex mieiltfmDel(ms;t) rtoir3ia1faDe ieols0 2urim3oo4altn ieta( sDtauronu0alxnioetad s emn o u)trxrmr tatfptelu i t)texmiopnudapen feslsf 2rrurpnu1tee io3ild a2uanmonu0tltrir tydoatrliei s) 2xmxm3ou1opt mnvsa() 2tmxmpou0aee  f3tydla umnmo u) ltrifcty1opt  ieolt srtoim ny4lp  lnes s  rurx onu0apt  o3ildfs eau p u0artnxr3todfpDe iei ( srtrxm nu1ol elneslsf rurx o;u4aetnmictldfs2eluvp;(4texnmf3tydlmDraneilt)t2umirpny1apenmnvils) Dra(ro;o1tee  oeiysfsDua(vo t4aexoir3iotlptr nvi;t)s2toxr no1ome micsatfa2tr( pot1oeenmicildfaDrau on(0 ltrif3tadoa elies;t srxmxopoudlmenlncilsfs2rrur nu1teto oeiydls2ranms t4trtrmfcoa1om rau olt0s2to(o3no1omeelnvtltfsrtmumoot0oexnmieils s2um(vp t)texrxo to1opDr ues t)texrxo iodomenmnviatf rta(ro;t0aexoii3iad sDumnvo;()aexnmr ootom rln o s) 2uoir3iudom  mfei ( aDta( o;o0oexnmo3ildlm2eln o;u0alerirciodom rln i (0 rtmxo io4lptn ncs tfs2taxmpnu1oltnmf3ils mDuanvo;u0tltoiocta1lmD lneol(  2tmim nu1ol  mfvtlt)s2trxm ;o1alt moctld s umuvsnt0tlxoif3tatfatr neo (0s2xo(m oy4ameemfet s) 2ua(root0tex  fetldlaDuanvo;t0 lxnmociy1om e nvsl(0s2urirpny4apeelivi tfartau o;o4optoii3ilt sDuluvp t) ltoircoatlp rau s;(0t2xoiopiy4lleemivs ()aDum(  ;o1olt mieild aDrau o;(0tetomfciy1fa  aiesl() etmio oo4opt mfeta(  2ua(mpno0tpeomf3tadfm rm(ms;() exrmo oy1opDeliei;s0s2xr(opno1om nlfvsat) Dumx  nt0opxoio3ildfa em(vsn(0tetnir3oodlpDe ieilt t2xrxr iudol  livtlt srrmur ;o0apxoioeiyt sDumums;(4alerir3oodom rlivo t)trxr(rpoy1ome  ivilt sDuaurooo0apxoiicildfs eanmsn()trenxr3tydlmt luei s s2xo(r no1lpeeliet tf 2rrurooo4tpeo ieiadlsDrm( p u4 eerxr tatoatelues;s)texr(o3oy1amenlici (f Draxmpno0opeo ieiatfa ranmsnt) eerxo ootlateanvslt0 etmxo oydam nlnvtasfartmx o;t1apxoiocilslm2eaump t4 lenif oytlpDelivi;()s2tm(o iu4lltnmnvt (  rtmx  ot0oeenif3tadla2ulu o;() etnmoctodfat  nei s) rurxm oy4lmtn nesl(  Drr(mooo0oetoioeilt a2em( on(4 leoircootfp  auvsl( s2tm(opou1amtnlfciasfsDrmxrpno0teenioeiyslm ea(mp t4arxrxo oytfa  aies t s2tmio ny4amen fcsat  Draum oo4tpe moeildlsDemnvs;u0 rtoxo3oo1lp  anvs t) 2umxopoy1olte ncsat s2rmu  ;o1alenii3tls m2ul(ms (0tlxoif oo1oat ai sls0srtoim3io1lpe lfet tfs2tmumo;t1tlx  oeiatfm umu o;u0 eerir3tadlmDeanvs s srxrxr3oy1ll nmnvsa(  2ua(m no1tlto fciasfs2ranmpn(4 eeoxfctodoateau sls0seumxr3oy4al e fcils)sDrm(  oo1aleoiieils m2el( o (4trxrio iydfa  an ilt) 2ur(rpnu1aptn net s) ruru  ot1apx ifcils mDra(vont0altnirctodfate ivslt)setrirpoy1lltemietlsf 2uauro;t4openio3tldlmDemn onu)trtoxf oa1latrlueo;s0 2toimpoo4lltelnesas  rtrx pot4aet mfciyslsDumuvs;()artnircoytoat auvslt seuoxopiodap   fcsa(  rtaxmp;u4tltnmiciadlsDemnvo u4tetomr3iotoaDrluvi;s)t2tmir3ny1omt  fcilt)a2tmu  ;o4ape  f3tasla2rauvo u0arxoio3oodom rli i (0 etoxo3nu1lm emfvi t aDurxrp;o0altnifciadla rlnvp;t)arxomfciodomD lnes (0sruo(m ny1ll elnesat aDrmu  nu0tex mfetltfsDrauvp;t4 lenir totfat lies t  rxr(o3io4amt  fcta( s2uaum oo1tpto fetlsfa rlnvon(0artrxf3tadoa  livs;s  etrim3nu1oltemfeil()sDtmxronu4tpenmo3iysfsDuanvp (4 leomo3iodlp elivo s0 etr(o3iydame  net s  Dta(r nu0optnmo3iadlaDelnvs t)arenif3iydfpt an s;t0trtmir oo1olen fvs t)s2rmum ou1olx mieiadfmDeanvs t0alerio tadla   ieo;(0 ruo(r oo1am e net s aDtmurp;t0aex if3iasfa2ua(mo t)tlermr3ta1la r i s s)texmxr iodapt  nvil()arurur oo0olto fctytlaDrauvsnu) ltnir totlp  au sls0srxo(rpno1amtnmfeta(farur(mp;t0teeo iciasla2rmumon(4tetnmo3ia1fp e uvo (0 eumxr3io4omt mici t s2ta(mpno1alxn ociyd s umuvs;u)artrmf3ty1faDrluvols0setoxr iu4lptemietltfa2ta(r ;u0tlt iieilslm2ulumpn(4 rxnif ia1fa rlnes s)s2xoxo3no4ome lnesa(f 2ua(r ;u4opt mociatfs uau o;t4 rtrio3oydlptranei;s)s2xrxo nudalenmfeias) rrmumont1tptn i3tys m ra( o;u4trxoif3oa1omtraueslt trxoim iy1ope  nesl()sruax o;t0oltnmoctltlaDul( sn()alxnif ty1fptrauvo;s) rtoimpoodopte fes sfartmurpoo1opx mi3iadfmDrlnmon()trtnmo3io1laDr u sl( trxrxmpnodapt  iei t)sDrm(rpno0open o3ilt sDuauvp;() exrir3oa1laDeaivi;()seum(r iodap  lies sfarumxm no4open fctls a2rm(mp u4aexnxr3todfmD anvi s) rtoxopny4altnmicsat) 2ua( p;o1oltnmi3iysfs elu s;(4trxrmo tytfaDelneo s setrimpou4ll emivsl(f rta(ronu4tpeoiociydla umnvpnu4 lxnxrcoa1fp elneo t  euoxopoydoltemnesat)sDum(mpnu4tet iociys s2uau s;t)aetrxr3oy1la rlneols0s2urxr nu1lmte fetas)srur(root0opx mociatla ul( pn() rtoxf3iatopDraivils) rum(r io4lpeelfeiat s2rm( pnu4texn i3iltlmDul(vs t)artnmo3ty1lm  ln i s0trtrir3oydom elfvias s2rrxr ;t4olt  ocilsls el(mpn()trxrxfcto1lat  nvils t2trio3ou4ap   fet t aDraxmpnu4olx ioetas aDuau snt0 leomfcoytoate u s;s0 etrio3oy1ap n neil()sDtmurp;t0tpe iicildfm ul(vont4aeerxfciadoaDr ieo s teurio iu1olenlfci s  rum(m nu0oexomi3iatfs2um(ms;u4trenxrciydfatrlivo ( s2xmxopoy4op  lnvsatf rtm(  ;o1tle iieilsfs emnvont)texnxr3oo1fmt  n o t  etoio3nu1ap nmncsasf rta(mono0alxo i3iytla2emn o () exomrciotfatrluei;s)srxoirpio4lme lnviat)a2taxm no0tlx  o3tas m em( o ()aeeoxo3oatlpDeau il(0teurio iydole mfeta(  2tm(moot1tpxn o3iydfa2eanvs;t)trxoxrciodoa rlueo;t) 2trxm ny1alt  fetltfs2rrx ont1teenmi3iadfm2umnvpn(4tleoxf3tadomD  ueo;t tetr(m3ou1lltelnvi t arrrx p;t0tex io3ils m2umnms (4 exomf3tytlaD  ieo ()s2ur(r iudame lncta(f rta(mo;o1tex  oeiysfmDrlump;u0teeomo3iadomDe n sls)tetm(m3oodam   fcs tfaruau  ;o4tpx if3iydfaDeauvs;u0texrmr to1om raiei;s seumir iu4op  mivilt)aDrr(  ;t4teenifciydlsDrauvs t0 eeoxrctodopte nvi s)seumiopoy4openmfvt (  Dta( o;u4aptoiociltlm rlump (0alxnxf iatopD  neils0s2xr(m no1lmen ictasfsDraur nu0optomo3iatlaDea(mont)artrmf oy1oaDr nei;s0 exr(opnu4lpen fci t)s2tmum ;t0teen o3tad s rm(msnt4tlxomo iodomtr ivs;() rxr(m3iy4ame  iet s  Dur(  ;t4apeniieiadfm ra(von(0artrmfciatlmteau slt sruo(m iu4ap  lfcta( srraxmp;u4oex  oeiyd mDrlnvp (4alxnmfcoodomte i sl(0teto(m oydop  lieils s2rmxm ou4aleomociydfa ra( o;u0tetnmrcto1optrliei s0srxm(m no4lme mnetas  Dtrumoou0ape  f3iys aDrlumsnu) ltrxrctodlmDeanvslt s2urxo nu4am n ieslsf Dua(m nt0open o3ils s2rm( s;u) ltnmf tadlpDrai ol() rtm(r iy1am   neiatf rraur oo4oexomietas m uaums;(0tlxrxf tydfp e i i;(0sexr(r oy1open ieslt  2ururpnu4aeeo o3iad s2rln sn(4 exrmfciytfaDeai i;s trxmio iodopt  fesat)aDtm(ro;o1aptnmoeiytfa2emn s ()teeoxf oatoa  aivo;t0srtmim oo1lm nmnvt s  2tmurpno0aeenif3tlsfaDul( onu4tlxnxo tadoat an ols)trtmirpoy4ome lnvtl(faruaum ;t0opx ii3iydlm2uanmpn() eerirctatlp raivo () rur(r3oydomt lnvtlt aDtr(rp;o1olt  ieiydlm rmuvs;u0 renmr iodla  au o;s0 2xrxopoy1apen ncils)aDraumpou4olxniictatfsDemums;t4 ltoxf3iy1lmt  uvsls t2tm(m iu4ale miviltf Drr( p;o0apeomfciys mDran o;u)aetnmoctodom elu o t)sexmxo3io1am n fvia() 2rmx  no4aex iieiys m rmu on(0altrxo oo1faDeaneols0srtm(m3oy1aleelfct (fsrur(r ot4alx  oeiytls ua(vont4trxrmf3iadopD aiei;t0sexmxopio1lptelicsat a2uaxrpnt1aptn ietyd mDuluvon(0trtnmocoatla e ieilt) rxrirpny4lpt lnvsa(f Dtr(mo;t0optoiicild m rmnmonu)artoif3oatomte ueil( srtr(m ny4am  lfvi ( a2rr( ooo4olx ifcilsla2emn s;u4alxrif io1fa e i ilt0 ruo(opiudamenlfct s)s2tmu ont0aetnifciyd a2eau s;()teerxo to1lpD aueils0seumxo nu1om emfvsa(fsDrm(r nu4oee mociydfs rlu pnt0alermo tatlpt ai i;(0t2uoio no1om emietlt aDumumo;u0tleoioeiad s eau p;t) ltoxoctydfmD  ues;t)tetr(r oy4ameemfet t)a2ta(  nu0texnmieilslmDemuvpn(0 ltomoctytlmtelu ols0s2trxrpoy4aptnlnci t)s2rru oou1tptomoctatfm um( pnt0 lxrifctodlatranvi s trumxm ou4op n nvsatf Duauronu0tpen octlsfsDeanms;t4trtrxr3oadlp eanvs;t srtoim oudal nlnetatf rur(mpnu1tltnii3tytlmDrmuvo;t0trenircty1la elneo s teuo(r3iy4lpt mfesl(  Dtau ono4aetoiociadla2uaumont4arxnxo oytopDeln i;s0 euoim nodalt  ics (fs2uaumooo4opxoif3iytlm2emump;(4artrmr oa1fpteauvsl()seto(r iy4ape mivsl()sDtrur ;o4opx iieiyt a2em(monu0tlxoio io1lmDrli olt  ruoxm3ou4lm   nvslt sDumx poo1aexnmo3tys m2elu pn(0altrmf3tytfmt au sl(  2tm(m nu1lptelfesl()aDta(m ot0tlx  i3ilt mDuanvs;u0 ltomf3ty1fmD auvsl(0trxo(opny1lptelfci t)srur(mont4tle  ociys sDulnmsnu4 ltoxr io1fp eli i t0 rumxmpiodom e ieiat a2tmxmo;u4aleo fciydfm elu on()trtrmfcoodlptraieo;s0 2uoir3oy1omtemneta()a2tr(mpnu4aexoif3iadla um(vs;u4tltoioctytlmtr n olt  rtrxmpiy1altnmnvtls) Drrumpoo1opx mo3tatlmDuluvs t4aexrxrcto1op eau o t)t2uoxm nodllenlfet t)sDrrxrpnu1tlto octys m rmnmo u) rxnmo3iy1oa r n s ( s2toio nodomt  ivtlsfsrurxrooo4oexo i3tat mDrlu s t)trtoif3ta1oat livs s  2triopnu1lltelivi sfa2urumpno1tex  o3tltlm2el(mo;u0alerxocoo1faDrlivil(0 rxoxo3nudolt  net sfarra(  nu0alenmo3iytfs2umuvp;u4 exomf3oatfpt ai i (  exrio3nu4lmte ncs s)aDta( pot4alxo iciatls2uluvp;t)tlxnir ootfatrluvslt0teum(o3iy4al n ici tf rra(moou1oex io3iat a eanvp;(4aexnxr3oatfmDelueo;(  exo(r3oydom emnvs s a2trump;t0aexoiieiyt m emu onu0aexnxr3iodfmDeanvol() 2to(m nydlle livtl(  Dua(rpou4olx  ieiydfm2rlump (0teenir iodoa e nesls0trumxmpoodalenmnvias)s2tm(m ot4oetn f3tad m rlnmp () ltrir3oytlp rlneilt) 2xr(rpoy4opte fvs s aDtaxmp;t4aexnifciatlmDrlums;t4aleoir3oy1fmD  uvs (0 exrim nu4lpee fes t  Dumxmpnt1apxnmi3iyt mDrm(vs;u) rtrif3iotlatraues t)t2umxo oydlpee fvi s  2rm(m no0tpx iieiysfsDumuvp;(0alxomf oa1fmD lnvi ()setrim3oydomenmnvils)artrx p;t1tetoifetys m emnvs ()trermrciotfmDr ieils sexm(o3no1lmt lfvtas s2rru pno1tpt  fciyslm ranvpnt0tetoxrcio1opt livi;s)s2xmxm3iy1omenlfvtl() 2tm(r nt4alt ifciltls eluvp t)artnio3iodfa  ln o ( s2xmir nu1ale mneslt)aDua( pnt0tptn oetltlaDua(von(4 ltnmfctodlatrau ils  rxr(rpiudomt lnvil( a2ra(ro;u0oltoioctadlaDumuvs u0 exnmr3iytopDelnes;t) 2xoxm nu4omeemict (fsDumum ou1oet iociadls uaumo u4arxoxf oatlmt lnvs;t) 2tmxmpny1ol   iesa( srtr(  oo0oeeoioeild s2uanmo;() eenxo totfmtran sls srtm(rpiu1ole lfctl()aDurxm nt4alxn o3ils a2eluvo u4tetoxr3iatoa  ai o;s0srurimpio4al  mnct t) Dtrx oou1oltn fetltfaDemu pnu)arxoxfcto1opt livs s  2tr(r ou4ameelnesatfa2urxmooo1aeenii3ilt m uanms t4 eeomocootfatrau o t) eur(m3ou1lm nlnvsl(  Dtrx onu4tex ioetldfsDeaumsnu4aeeoiocoy1lmteau i;t)s2xmxo3nu4alen icslsfarumurpot0tleo o3tlt sDumn s;u)texnmr tatfmtrlu sls) 2xoxr oy4lptnlicslt)a2umxr ;t0tleoifciysls rm(vo t) exnio totlpDrlneol(0srxmio oydam elici ()aruaxr no1apxomietaslm rmu o u4tleoxf3oa1fm   ueo t)t2xrim3ou4amtelivsls sDua(rono1apeo ociysla2el(vs;u4tlxrmrctytlpt lueols0s2ur(m oo1lmenmnvia() rtmu o;u1tleniieiatla rmn s u4arxoircoydoaDr uvsl()s2tmxopno1opeemivta() 2uaxro;u4oetoio3iys m2umn s (0texoifciadlm  auvi s)s2to(r3nydom nmfvils aDur(moot4olxoii3iat aDrmn ont)trxomfcia1om raivi;()s2ur(m iydlp nmivslsfsDumumono1olxn icils m2um(vs () exnxocootoaDeaieslt  exo(mpoy1lmt mietat  2urumono4oet if3iadla2rm(vs;t4 leoir3ia1oaD  ueilt seurxo3oy1al n nvsl(farrr(mooo1tpxnmoetysfs elnvsn(4 eenmf3iodlate ivsl(0trtm(opoo1omte fcils)aDrm(r ;u0tpt ii3taslm rlu o;u)aeerir io1fatrlieslt)s2toxr3ny4amtnmfes s)arrau  nu1aeeoii3ilsfs2ean snt)areomfcio1fateauvo;t srurio oy1lm nmicias)arum(rp;o1alt mociysfs eln sn()aeeoio ia1fp rai s;( s2tmio iydaltnmfcs sfa2taur ;t1aee  octat a em( snu)alerxo3tytlaDrai i t)srtmio3oo4amtnmieias)s2rr(ro;o4oltnmictyt mDem( o u0teeoxo iytlpDrli o s0t2toimpiodale  fvt ()sDumxm ;t4opeo oetlslm emnvsn()trtnmo3iotomD  ieo;(  exr(mpiy4lm elfcsls)srra(  nu4tex ii3tys mDulu pnu)aetoif tadfaDeanvs ( srumxo nu4llenmnvtat)aDta( oot0olxnif3tls aDuauvs;t) ltrir3ia1lat auvi;(0t2uo(r3oo4al e fvs t) rrm(r oo1olt moeias s2em(vs;t0aetnxo oadomDe nesls trtriopiy4op emfvtat) 2rr(mpot4apen oeiytfaDranmon() etnxocoo1fa  li s;(0sruoxm3iy1ap  livtas artr(mono0aeeomoeiltfm2emu ont4tlxoxrcoodfpDr ieo;t0teuo(rpnydomt mivtat s2tr(  oo1olxoiieilsfa2rl(vs (4 ltnxf tadfmDelnvol(0srtrxo3iydal nmictls) 2rmxmo;o4apt iiciat m2el(msnt0trtomo ootlpD  nvol() 2tm(opiy4omeemfei (  rrmurp;o1tlen oetadls umn o (4texrxr oydom rauei s  rxoxrpno4ll  miesas a2tru  ;o1tpe mi3iyt m2em( p;u4arxrxoctatoateliei;t)truoxopno1omt  nvtas sDumxm ou4opxnmo3iydlm2rlnmpnt) rtnxfctotop  aivi ( tetm(rpnu4omt mfeia( aDrrur no1tpxoio3tatls ul(msnu0trxrmo tadfa rai i;s0setoio3iu4ol   nes (faDua(rpnu0aee mfctas mDrmnvp;u0arxrmr3iy1fptrluvi t  rum(r iy1lptn ivtat)a2rrxr no0tlt mo3tyd a eau p;t4 ltrmr3iatlaD aieols)teumio oydll nmfvi s sDua(rpot4ope mi3tls aDeauvo;(0aexrifctatlat  i sl( srxo(rpiodlpenmncs t sDrmump;u0optn fctldla eauvo;t0alenxf oatfm  an il()seumxm ou4omeemnetls) Dumur ;o0aexnmo3tadlm2rl(vsnt) rxrir3oydlaDrlues s0seum(r io1oltnlnvtlt  ruaxr ;o0alt ioeiasfs2rlnvo;u)arxnxrcoydfptrli ols)trto(m nudolt lnvta(f rrau o;o1oltnmf3iaslm2um(mon(0 lenxo3oodfpD aueo;s)tetoir nydolen nesltfa2tr( oou0ole mfciatfsDel(mp;t0alxrxo3iydfpt  n sls0 exoim nu1lmeemncils  Draumo;t1opt iieiatfs2ul( s;t)alxrxf3iatfmDeai ilt0 rxm(m iy1aptemneia() Durx p;o0oet  o3tldfm2elnmo;(4teermr iytlmDe i i;s0 2tr(rpiy4apeelfvias)sDra(rpnt4tleomoetlt s emnvonu4aexrxr ia1omtr nes s t2urim3iydap  lncta( arumumo;o1opxomieilsls2rm(mon(0 rxoiocta1fpteauvils)trtrim3ny1aleelnvia( s2ra(  ou4oeenii3iyt aDulnvp ()altnxo3iy1omDraieol()seurir3iu4olenmies tf rrmump;t0apen oeiys m rau o;u4texnmr3oadfpt  neo t0 exo(rpoudalte fvilsfaDrau o;t4tpxoioeilsfa2uanvs u)altnif3iatfmtr ivs;s trurxm3oudlle  fes t)sDrmur nu0apen o3tysfm2ua(vs;t4tltoxociodlmtr uesls  rxrimpoodolt mnetlsfa2rr(m ou0oet iiciysfm2elnmp;(0aetrif oa1fmtelnes t0 rxrxopiu4ope lfet s)srrrx  ;t0opxn ieiat m um( ont4 lxomr tydla r n s t trtm(o oo4lptn nesltfsDuau  ot1tpt
\ No newline at end of file
@@ -0,0 +1 @@
+n sl()texm(opno4opt  fciltfsDumxrpnt1aexnifciytfm2uaumpnu)areoioctotomt  ieol(0t2tmxrpno4llt livsa(f rrrurp;t4aet if3iatls ulnmo u)tlerircootopDr ueo;t trtoiopoo4omte fcs tfsruaurpoo4olto o3tadfm2emn onu0 eeoxfcto1faDelnes;t0texr(o iu1al   nvtl()sDuaxrpou4apx io3ild s2uanvp;()treoif3oydfmtrlu olt0trumxr3oo4om e iesa()aDum( ooo4tlto oeiat mDrlumpn(4 exnxo oo1fmteai i;(0 2umimpiodlpe livs (fs2rrx  ou1tee io3tad s rlnmon() lxrxr3iy1fatelu slt0sruoir iu1altemivtatfaDua( p;u4ale  fetaslsDeluvo u0tlxrircta1faDeaivi s0s2um(opiodoleemfcil()sDta(m ot4tetnioeildfa rln snu4 lerxocoytom  luei;()trxriopno4ap elicta(f 2tau p;t1aeeomfcildls2rmuvs;(0 rtoiocto1oa   u o;( trurir3oy1lpt lnctl( sDrr( pot4tex  o3iytfmDea(mp u0 leniocoy1omt anvsls0sexmiopno1opteliciat) 2tm(m ;u4aexomfctytls2rauvs;(0treomr tytlpte ivi ( sexmxopiydlmenlivtas  2ta( p;o1olt  icildfa2elumpnt0aetoxo ia1fpt au s (0texm(rpiodap emfeiat aDrmx  ;u0oeeniieias s elumsnu)artnio oytfp  livi;()s2triopno1lp emnvilt s2uaxmo;o1tet  i3tls s2ra(mp u)teeoxr oytopD anes;(0teuoir iydlp n ivsl( arrr(m no4oexomociatfm2rlu o u4 eerxf tytlpt luvo ( s2tr(r3oy1amteliesls s2rru pot1olxnmietltls2eln s t)trtoxr3oa1oaDranvi t sexmimpiy1amt mnvil( a2uax o;o0aexniieilslaDuluvonu0 rtnxr3iy1lp rluvi;( trxm(r3iu1alt mnvtas srum(mpou0olto f3iyd s2elnmsnu4aeeoir3iadoat an i;( srxr(m3nodlmenmici s a2trxm oo0oetn fctad s2rmuvp u4 etrir3iodlpt au i;s)t2triopou4op elici t aDta(m ot4altomo3iltlaDua(vs u4 rxrxr3ootfm rli s;t)texm(m3iydolen nvsl(fa2rmxm ou4tee mfcild sDuanmo (0alxomf3iytfp e uvi (0t2xr(o3no4al emfvt t a2raurpot1tlxomf3iyt a2umump t4tlxnxrcoytop  auvi ()srumir nudomt lfvs t) Dta(r nt1oetnmfctld m2rmuvs;t)tltomocoytfate nvs;s  rxo(mpiy1lme mfctls) Durum ou1tlxnioeiys mDumnvp u0teenxo3iodoat  uvo s0teurio3iudamt  fcil(farum(moou1oeen icild aDem(mo;(4trtnir ta1fpte nvs s0 exoxm iydal elfct s arurur no1tet mfetltfm rmuvsn(0 eerxo ta1omD aueo s  2xrio3iudoptemnes s) 2umu  oo0opxn o3iltfa2ra(vpn()artnxo3tydoaDe i o s) etoxo ou4lp  mnctlsf rtrx  nu1ope  icildfa rau pn(0trxoxf3ootlmDeluesls)srurxr nydllt  neia( aDum(rpno4oex if3ilslaDrm(mpnt4 etnifcto1lpDrliesl()sexm(rpiy4op nmfct sf 2rmx ono4texo ictls a2rluvp;t4 ltnmr3oa1op   i ils)srum(r nodlm e ics t aDtr(mpot0oeen ociyslsDumn o t)tetrio3iadomtrlivilt) exmxm3iudolt miet s aDrr(  ;o4ape  feiytfa2uanmo;(0alenxrcia1op  livo t) 2tm(r oo4lpte fcilsf 2tauroot4olxnmoeils a2emnvs;t) rermf iydfm elues t texm(o oo4ll  mfesatfaDtaump;u1tle micilsfs eanvpnt0 rerifcoatomt anes;s srumirpoo4lmtemfesls) Drau o;t4oeeniociysla ulu s;u0trtrmo3tytopDe nvolt0s2trxo nudlmte nvsas) Dtaxmooo4apx  oeiatlmDemumo;t4trermr iadlpte n il()s2uoio iy1am  lnei sfaDrrx ooo1opeomfetlt mDran pnu4altrxr3iadlpD  ivol(0 etr(r no1lpe liesat a2umx ooo0oeeoifeiatla uauvsnu0tetrxo iytfaDelieo t srumio3nudllt  fcsatfsrrrxm ou1tpxn i3tasla uanmp (0 lenif3iadfp e n ils)t2xr(o3nydlmen fct s) 2tmxr no1ape  ocias mDul(vo t0trxrxf ta1oatraiei ( s2tm(m3nydlptnmfvsa( arumumpou0oeen i3iltfm ul(vsnu4arxrif3iotfpt ai i t0srurio3no1omeemncias)arraxr no4aptnmieiydfsDum(vs t)tetrircootfpDr ues;()setoirpou4amtnlnctas)sDra(r oo0oet  iciyd m uanvp;()artrmr to1lat  u o s0trxmio3ou4lmee fes (fartaur ;o0teeomiciad s rlumo u0 rtrxf iydfp rai ils0s2xrim3io4om nlfesl(  2urumono0aptomfctysfa2ra(monu)alxoxocio1faD  neol(0t2uoirpoy4omee fvsatfa2tm(mpnu4tlto octas sDraums t0 lenmociydfptelnei (0 2toxo3nu1lmeemnvsl( a2rm(mo;o4tpx  o3iadfmDua( pnt0 reomo3iytoaDeli i t)setm(r3oo1apeemivs s)srraxrpou1tex iociydlsDra(mpnu4aetoif ootoaDeluvs;()t2umim iu4lpenlicsa(fsDtau o;o1optnio3iydfa2eluvs;u)aetrxf oo1om   iesls  exoiopoo4lmt  ivta() Dumu o;o4apenioctyslmDra(vpnu0 exrio oatfm   ivi;s srxoxrpnudale mncslt)artm(rooo4aleoioeildfm2ulu sn(4aexnifciodfpDe ivslt) rtm(m ou1op emiei ( arraumo;u4aetnmoetyd s2rmumpn() rtnmo iytla rau ilt0teumir3nodolenmnvs t)s2trum ;t0ale io3ilsla rlums (0teenir oa1fpD  neil(0 rumxr3iydap n ncs () 2tmuroot4alxn iciyt m2eluvont0trtoxrctotom rai sls  2uo(r iodoltemiviltfsrrrx pot1apxoioeild s2eaumpnt4artoiocoydlat au o;() 2xr(opoudll e nvil( a2rax p;t0apenmiciytlm emn s;t0 ltnio totfa r n sl(  rtmim nodlmee netl( s2rrx p;o1alt mf3iadfm uanvs (4trtoxfciadfmte ueil(  eur(o iudolte feil(fartaurpoo4oee  fcils mDuaumo;(4 exrmociatlpDeli s s0 rxmxr nydlpt  ics s) Durx  ;t1oex iieiysfm2raumsn(0trtrmf ia1lpD  neil()truoiopny1lme mnviltfsDua(ront1oeeo fetydfm umump t0 leoxr3tatoptr u o;()tetrxr3oo4ll  mnet sf rrr(m ;o0oet mieiaslm rmuvpnu0alxnxr3oydlp   ieols)seumirpiydaptnlnct t sDtrxmpnu1ale ii3iysfsDem(vpnt4trtomo oo1fat  ivo t  2trxr3iydllt mieils s2umum ;u0altoifeiydfa2ulu s;t4texrmoctotop  aueo t  exoirpoy4lmeelfvsat aDrr(mpnu1tetnmociasls rl(vonu4trtoxf3oy1lp rau s;(0sruoim iudll elfvtls a2um(mpnt1tptnifeiasls ul(mpnt4treomoctotlaD  i i;t0srxoim3iy4om  mfcsls  Durumpnt1ope iieiysfsDrl( pn(0arerxo iydfp rlnes t  2umxr3iydlm   fct sfs2ua(rpoo4tpt  f3ils mDelnmonu4trerxo3tatlmt li s ( teuo(r3nu4altnmict () Dtrxro;t1aetoifcilt a2em( pn(4tetnmrctatop r neo s0trxrirpnu4ameemfcs (faDtrxrpnt4opxo oetltlsDumnmsn(0 rtoif iotopt  nvolt)s2xoxm iodllee nvs ()a2ur(mooo1aex ioeild m2uln p (0alxrmrctydfmtrlivsl( trtr(rpiy4lm nmnvta(f 2ra(rp;t1apt  o3tltla2em(vp u0trtriocoa1fpDelieols  2toxm nydlptemnetat)s2raxmo;u4oeeo ictysla2ean o (0 lerxo3oodlp eau o;t0tetr(o ny1al elnvt ()artrur ;u0oet  ictlt mDrln ont)trenmrcia1lmteln ils t2trir no4alt liesl( a2uru  nu4aexoioetys a2umu snu)texrxrciadlp eaneo ( t2xoxo iudopeelivt tfsDrru onu4oltomicildfa2um(vp;u)aeermr3tadoptelnvilt  2xr(rpoy4om nlictl( srtmx  ot0apen iciadfmDum(mp u)aetnir3totfa  lueo s0srtrxm3nydlptelivtls sDraur ;u4teen o3iysla ua(vpn(4alxnxo3iadfaD livs s)srxrxo iodlm  mnvt tfsDuru  ;u1tptnmictys a ulnvon(4tleniocty1omt  n i;s)setmir3ou1olee feilsf Dta(r ;u4opx moeiytfa emu on()treoxoctatfaDranvs;t0srtr(opnydlpt lfvilt)aDtmumono0olt ii3ils s rl(mo;u)areoif iadlatran o;t)tetoimpio1open ici t  rtru p;o1ale mictyd m rmu p t4 reoircto1fat liei s t2tm(o3iu4openmfvsas s2ururpnt0opx if3tytlm2rm( s t)trermf3iadlpD an i;s s2toir3iydam nlieilt)arumxr ;u1aee  oeiadla rauvpn(4areoirctatfmteaivo t seumiopio4amt mnciat a2taumpnu1apxoiietad a elumon()trtomo3ty1lpt ai sl() 2urxo io4lleemfesasfs2uru pou0oet miciydfaDean o;()trtrmrcoo1fpt  ueilt  eumim3io4lmtnmict (  Duaxr ou4tlto i3iltfs2elnmpn(4 lxrmo3oodfp e nvi ( teuoimpou1amenmnvtlt)artmxm ot1apxn i3iyt m rmn o;()texrxf3iadop r uvsls0 rxrir3iy1apte fcil()artrxrp;o4apenioeiyslaDra( s t)alenxo io1lptrli o;t tetrxm oydamtemivtls aDuax pou1texnmfetlslm2rlu o t) rtrmr ootom rlnvo;t trxrxrpiydopt licia( s2tmurono1opt mfetls m uln s u0 rerxr3iatopDelues t0teuoirpio4ope lfetltf rrr( o;u1texnii3iltfmDran s;u0altomoctydlm eluvi s  etrxr3ny4omee nctl(f Drrumo;o1alx mieiyslm2um(mpnt4altrxf iotomD ai sl(0 exrir oo4oleelnvtls srum(  ;u0optnio3iatlaDea(vo;(0alxomo3ootfaD ln ol()trto(m3no4om emnetat aDta(monu4teeo octyt mDemnvon(4tlxnmoctytlmt lueo;s)s2xmxr3ny1amenmfcs s)aDrrxmono0aeeomieiys m umuvp (0treoio iy1omD livs;(0trtr(o ny4lptnlfvslsfsDuau o;t0optnmi3tydls2emu s t0artnxoctadfaDr neol()teuoxo3iodlmte fci t s2urxro;u0aeenifeildlaDuan o;() eeoiocty1oaDe ues t  exmxrpio4opeemicil(  rrm(r ;u4ope ii3ilsfa2um(ms;() lxomr3io1lmte uvols)t2trim3oo4openliei s artaum ;o4olx if3iadls rmnmp u4teenir3oy1fm  aues s) 2to(rpiydlltnlnvil() 2uau p;u0altoio3ilt aDrluvonu0 ltomo tadlmDeln s s0 euoxr ou4ome  fviat  Drr( pot0alenifeilsla2ra(msn(4 rtoir3tatfpt anei s0s2xrir nydopenmieilt s2urxrp;u4tetoif3iyd m rau p;u4arxnmr tatlm r nei t0t2toxr3io1ale  ieil( a2rm(mpnu4oexo fcild a2umuvp;t) eenmf tytfm  lnvi (0trtoxr iy1lpe lnvt (f Drmum ;u1apto f3tlt a2ulnvo;t)tlxnxf iadfateluvilt0trumirpio4op nmnvsat) 2ta(ro;t4tptoio3tadfs2rm(mo;(4texoio oadfp e uei;s srur(m io1ame mnvias s2rm(r nu0opx mfciyd a2eau pn(4tltnmo oydlpteaivil() 2xoio iydolenlnvtasfsrta(m ;t1opxnmiciytla2uln p;()altomo3iy1fpD lu s t seuoxmpnu4altemfct ( aDtr(r ot4tex moetls m2ua(vpn(4artrir ty1fa r nvi;(0trxr(mpio1lpeelfes (faDtmxrooo0apeomf3iatfsDrmumo;u0alxomo ty1la raues t  2xmio3iy4op  liviat arumx oot1apxnifciatlsDra( on(4 rtrxfcto1opD  uvs;(0sexm(o3iu1om emivil( arrmx pno4olt iicilsfsDelu s;u0trtnif3totlmt anes t)s2trir ny1lp  lfeiat)a2taxmonu0teeoiietydla2rluvp;(4trtrmfctodomDeai ol(0seum(o3oo4lpt mivtl(f Drauro;t4tpx  ieiytlsDuaumonu)tetomrcia1lmDraivil( t2xmirpnu1lmt mfcsat) rraxm ;o1tetnio3tas s rmums;() rxoxrciy1la eau i;t) eumxr3io4opee nvt () Drrxr ;t4apt mfciatfsDulnmsnt) rtrir io1fm   ivo ()t2xo(r3nu4apt lfcil()a2tmur ou1tpeomi3ilslaDrmn s;()tlxrifctytfa eaies;t)t2urxopnu4oltemfvsltf Dtrumpoo4olx mietlslm rm(ms;t)arxrmo3ty1oate ivi;s0 rxoim3no4al n nvt t  Dur( o;u4alxoiiciadfsDulnvonu) lenxf3oo1oa e ues (  rurxo3ou4lleelnci ()sDtm(rpou0aexn oetysla ra( on() lerif oy1oa eanes ( srxmimpny4altnlfcsltfarrr(rp;o0optnio3iytfs2ran on(0aexrxf3oytoptrauvol(0s2urxrpiy4lmtn ict t  rua( ono1tet mo3tytfsDuauvo t0 ltnxf ty1omDeanesl( seurxo3io1alen nvsl( s2ta(mpoo0opeomi3ias s2ea(mp u)aexoxo iatoatelivols srtm(opoo1amen fcsl(fsrrmx  ;u4oexoiieiasla2rau pnu4 ltrmr3oo1lmDelieils0sexmim nu1ame mivsa( a2umxmp;t0tex ifciatfmDel( onu0tlxoiocia1lmD luvil(0s2xmxo nu1ome  ivtlsf 2tmxrp;t1aet ifctld aDrmn o;u)treoircia1lmDr u s t)trxoim ou1lpt mfciat srrmxm ot0openio3iatla ua(von(0trtrio3oadoa   n i (0texmxo nydaptn fcilt  2um(mo;u1aeeo iciytfa rl(mpn()tetomo3oo1optelnvo;s0 rxoxrpiy1lp emivsat)srur( p;t4aet mieiltla2emnmonu)aeerircoadom  luvilt  exm(o oy1oleemnesa()s2uau  oo0tee  fctyd m rm(ms;t)tleoxrcio1oa  ln o () ruoimpio1ol  miet t) 2rm(moou0texnmoctlsfs um( o;t) rerif iadom  aieils0t2tmxr3no1amen fei ()srrru o;o0altoifetasfs ua(vp;u0arerxo iatomtr ueo;(  2uo(rpoo4llee fcilsfa2tmurp;u1tlt mfetltls2ul(vo t4altnmfcoo1lmtranvo ( setoir3iudom  lfcilsfartr( oot0aex mi3tas mDeau snu)tltrio3iy1fptranvo;()t2tr(r3iudomt mictasfaDrrxmoot0openif3iydfaDrl(vpnu) lerxr3iydom  lu sl(0t2xr(opnu4omenmiesas s2ra(m nu0tpx ifeils m rl( pnt)areriocoydopD lies t0texm(mpoodalen netlt sDrmx pnu0oetnmfctldla2rmnvs t)arenirctotlmDeai o;(0srurxr3no4lm e iei t arur(  nu0aetnmoeiytfsDran p;t)tlermf3oatfmt lu s ()s2tmxmpio4amt mfesa( srraumpou0apenifctasfs em( pn() lxomo oydlm  lnvolt0 rtmir3ny1am  mnctltf Dtaum ;u4olx mictatfs um(mp u4trxnxocio1fp   ivs;s)s2urim3no1openmfcia()s2rrx pnu1oexomo3tad m2ulumo u0 lxomo3iodfm eau i;(0s2trirpou4lm nmfcta(faDur(rpno1oexnmfciat mDemumo t0aexrmrciatoa eai s (0t2xoirpoo4amte netat)aDuaxmpno4ape iieilsls2rmuvs;()texrmrctodfp  aneilt0 etrxopoydlp n ivtl(f 2ra(mo;t1opeomietatfmDrluvs;t)trenir3ta1fat  u s s  exoimpoy4altn ivia()srtmump;u0aleoifctltla uan o () rxoxo3todlp ranesls) euoxm iy1apenmivs tfsrumur no4opt  fctysfm ulu p (4aetnmfciy1lmDr nvsl() 2xr(mpno4olee net s  2uax poo4tltn fcias a em(vo;u0treoifcoatfaDelivs;t0 etrxo nu4lpenlnetl( srtm( ono4tpe ifetas aDua(von()tleoio3iy1laD luvs s0s2xo(m oudal emfeslt  rrau  nt1aeeomfeiadfs2ulu pnu)aeenmf oy
\ No newline at end of file
@@ -0,0 +1 @@
+nvsl()t2urio3nu4ale lfet t a2uaxrp;o1tpxoifctatla2eanms;t0aetrxo3io1fpDr i s t t2xrxm iy1omenlncs t arum( p;o1opx moeildfaDum(mp t)aexoxo ty1laDr n s t0 2tmxr3no4amtnmivsat)arrmum nt0oetn i3iys s umuvs;(0trtnircoo1fp r nvols0s2umim3io4ap   ictasf rrrum nu4tpeo oeiasfa2rluvsnu0artoxr3tytomDeanes s0 etoxo3oy4lltnlfcsl(faruru o;t1olenifcilslm2rm(vo u) etnxociy1lm eaneo ()srtmxr3no4lp n fvt (fs2trumont0tle mfeiyt m eanvpn(4alxriocty1laDeauvs;s)s2xo(rpiydamtelnesatfsDumur ;t1apeomfeiadls2eanmp u0 rxrir oodomDrli o;s)setr(m ny1lm n icsltfsrtm(root0tetoiictas aDra(mo t4 ltnio3ootfaD  uei;s  rxoir3oy1apte nvsltf Draxronu0opxo o3ils s2el(vpn()texoif3oydlmDeaueil( tetoxo oo1ll n fet s s2rmxr ;o0tpxomociyd m2em(vsnu4 etnxocoydlaDr ivs t0sexmxm nudlp  mncsltf rurum ;u4tlxo o3iyd s2uluvo;u)aexnxo oydlp elieslt)srtrxm iy4lm nmfvils) 2ua(r ;u1aeen o3iysla emuvsnt4 exrmocta1lp  an olt srxr(opiy4lmenmici sfsDrrumont4teeniociytfsDelnmo u4alxnio oodlpDeanvsl( t2trxo3iudomtnmfcsasf rtaxroou4olxnmociatla2em(mp;()aexoio3oydop   ivs s srtmxo ou4amtelneiatf rumxro;t1aeeo ieilt aDel(vp;t0 rermfcoydla  lu ilt)setr(opoy1lleemivta() Dta(mpno4aeenmoeiyt a uanms;u0 ltnmo iydlaDraivs ()seumirpoy1ap nmnvtl(fs2rm(rpnu0aleomf3tad sDem( onu0trtnif iotfmt au i (  2xoxm iodale mnvtlt)a2trumo;u0tle ioeils sDulu o;() etnmfciytlpDeanei;(0trxrim3iy4lmt  nvi s  2rruronu0apeoiietadla rmn o t0areomr3iatlptrau s s)truoirpoy1ol  mieiat)s2um( o;u4aptn o3iyd s2ua(vs t4arxoxf iydoaDeli o;( sexo(m iy4lme liei t s2trxm oo0ale io3tld m rau o;t)areoio oatfptr ivo (  etm(mpnu1oltnmiesl()srtm(mpnu0alt  iciad s2uaump () eeomo tydfmD au ols) 2trim3ny4om n fcs s)arta(m no0altnmo3tatla ea(ms () lxrir3ta1opte u sl( srtr(mpoy4olt lnetlsfa2trxm nu4teeoiiciadfmDemn s (4teeomo todfpDe u o t)t2trxo iy1ap   nvil(  2rr(m ot0apxo feiadfm2emuvo t0tetomo3oadop eauvslt0 euoiopno4lmtemnctas) rrrumpnt4aeenifetytfmDum(vpnt4trtrxrciytfa r ueo t)s2toxm3ny4ap nlici sfsDuau  ou0oeeniociys mDuauvs;(4 ltrmo3oatoaDeli i s)seumxr no4lptemict tfsrumu o;u1texo fciadfm2elu s;t) rxnxf3iadlmD ln sls  ruo(mpiy4ll e fvs s a2ra(rpnu4apeoiieiatfaDemn snt0areomrcootopte uvols texrim3nu4om n nes (f 2tmurooo1opt moeiat aDrluvpnt0tlermo iotfaDrlies;(0srtm(m oy4op  lfvtls aruru oot1tpxnifciysla ra(mo t)alxrxfcty1latranvols)srxmxm iodop  mfeiat aDuaxront4tlt  o3ias aDuauvs t) lenxocio1oa rlivo t)s2xm(o3oo1ll nmfvias)sDraxm ;o1oex iietltfm ran ont)tetnio3oydfaD  nvi;(0 2xrio3iu4ll  lfci sfa2tmxm no0apxoifctydlsDrmums;(0tlxnxo3iytoat  ueo () rtrirpnu4lltnlivsasf Drrum oo4tlenmo3tadfm2ranms t0alerxr3oo1lm raiesl( trtrxr oy4omenliesl(  rrr(rpnt0alx mf3ils sDrl( s;u4 eeoxrciadlm e neil(0t2xm(o oydlpeelivi tfs2uaxmont4olxniietatfmDem( s (4 rtrxrctatop e i s;t)teurxr3oo1lmtn nvsl(fsDurur nu1oetniieilslaDem( o;(0aetnxr3oadlpteluvsl(  exr(m iy4lle mncsl() Dta( ont0apt mo3iadla ranvp t)artnif3todlpDelnvo;s  eurxopiu4al n nesat sDumuront0tlen i3tytlm eanvo;t4aeerif oatfpDelnvo ()s2xoim ny1ole mfvi s) 2tmxr nu1alt iictysfsDuluvo u4artoifcoy1om  aues;t0 rxmxr iy4optnmici t)a2rru pot0alen fetadfs2uaump;t)aexnmfctatoat  n o s0teurim nydamtelnviat a2rrxr ;u4tex moetydfm rmumon()trermfcootlate ivi;t)texmim3iydopee ivta() Drm(mooo0olxnifeiat a emuvp u4 lxrmr3oydfmDeaivo ( s2umim iu4alenlncs ()a2rm(  ;u4tpen o3tlt mDrmums;t0 lxnioctodopDelueols0 2urio3io1lpeelivia()a2ta(r ;t1tleo octat s uauvs;()areoio3ty1opteluvo t  ruo(o3iudaltn nci s arua(  ou1opx ioetasfa2rlumo (0treomr ty1fm e uvi ( s2umio3iu4lltemicsasf rurumoou0opt io3ild mDem(msnu0altoxo oytop r n o;s  euoir3ou4lm  mivtl(  2rmxm ;u4aex  ociydfm uaums u)tetoxo tatoptrau i;(0t2xrxrpou1amee fetlt)artmxmonu4tetomociasfm umn snu4alxrirciy1opDr neslt) 2tr(r3oo4ale  fei t)s2tmxrp;u1tlt  i3iydfa umu o ()alxrmo3ia1opt  i sl() etoir3oydomee fvs (f Dumump;u1optn fctls m2eauvo;t4tlenmo tytomtr ieil() 2um(m no1olen ncslt)s2ra(rp;t1oet iietad s2ranvs (4 rermf totfa  luvs s) rurxm3nudlmtn fesl(f 2tm(r ;o4alt mf3ild a rlumo t4altnmr3iytopDrln slt) etmio3no1lptemnvtlsf rraxrpnu4aeenmoeiatlm2umu p u4trxoiocoy1lmtr i s t)s2toiopoudlmtnmfvtas aDtmxmoot4alxo oeiytlsDeauvpnu0aeenxrctatlpD  i o s) rtoio3iodlpenmnet s)sDrrx o;u0tpx mi3iytlsDul(ms ()teermocoy1oat anvs t seuoio iy4ll nlnvslsf 2um( ont0tpe mi3tatfa2uauvonu0 rxrircoadlp  lnes t) 2tr(mpiy1lm elnes (fsruru pnu4oee  o3iydfa2eau p;u4trxrxf iadoptraueils) 2xrxm3oydlle  fci s) 2uaxmpnu1ole ifeiydlmDelu o t0trxomr ty1fat luei;( seurxm oy1lmte ivt ()arrm(r oo1ale mfeiltlm el(vp (0 lxrifctatfmte n s (0 etm(r3no4ome  nvtatfaDrmu  oo0tetnmociltlm elnvo;t0 etoxf3iy1fa eau o;t trxrxm no4omtnmfetlt)aDrm(  no1aex iiciad sDua(vo;t4 lxoir iadlp r uvi s texr(o iy1amtelnvilsfsrtru o;o1oexnmfeiatlm emnmo;(0aeeoioctotlpDr ivs;s0s2ur(opiy1ome lfetls)arrmx onu4olenmiciys s2rluvs;u4 rtomrciytla   uvi t0 rumirpnodlp emfci t s2uaxroot0tlxoifetlsls2rlu s (4 ltomrcoodfpDeaneolt t2uoxo3nu1opte nes (  rrrumono1alen octytfa2eau s;u0texnxr3ia1omDrauei () rurxo3iy1lm elfvt ( aDrrumpou4oltomo3iatlm umnvp;t)tetnirciotoptelu s;t) 2um(r nydlmtemivt s aDuaumo;t4aptoif3iydfs uluvs (4tetrircoo1fpDe n s t texmiopiu4lpe  feils)sDum( o;u4optoifctasls ran snt) exrioctadlmteanvo () eurxo nydamtemfetl()artrum ;u4oexnif3iatlsDrl(vp (4trxnxr3oatlmDeai i ( srxr(rpoy4ap elnvtlt)artmurp;o4opeoif3iltfmDeanvo;u) etomr ootlat luvils0trtrxr ou4ope mfet t) rtm(mp;t1tptn ociytlm rlnmp (4trxrmfcto1opD lues s  2tr(mpiy1om  lnetl(faDtrx pot1tpeo fetltlm em( sn(0texoxr oa1oat  ueslt0 2xmiopoo1oleemncia()s2taxm ;u4tpe moeiat mDemu o;u4 reoifctadfp  luvi;(  2tr(m nodap elfeil()aDta(rooo0ale ii3iyt a2uanvo;t)teenio ootop  aues (0s2umxopoy4ll n ncta(  2taump;t1apenifciys s uluvp;(4aeeoircoytfa  aneil(0 rumirpiu1op  mivs tfsrumx ooo0oeto fciat mDeanmont)tlenxf to1oa elivi;() rtoio iydalen icsa() 2umxro;t4oltn ieiytfaDeln on(4arenio oadomDrliei;s srurxr oo4am elncilsf 2um(root1tetnifetlsfa ran pnu) reniociytlmDrln s;t)texriopoudolenmnct s srumu ooo1opeomfetysla elnms u4 eenif3tytfpteaueslt)setoio oodaltemfcia() 2tmumooo1teeo fetldls ul( s u)trxriocio1optrli s s)srxmio3oy4ll n neiltfsDtm(mpot4aetn ieiasfmDul(mp t4 rtoirctotomt  u o t0seur(r3iodom n net t arrrxmoot1aexnmiciadfaDemnvpn(0artnxf3ootop  lnes;t)s2uoim3ny1lle  nvs sfa2ur(  ou4tle ii3iatls2ean s;t) ltrxrcto1omDeli o;( t2trir3nu1lleelnvtltf ruax p;t4tlen i3tls s rlums;u) ltoxr3iy1late ueo;(  eto(opnodap emies s aDrmur ou1tptomfeiad aDemuvo t4tltomfcoydomt lies t)t2xm(mpoydlptn neilsfs2uaxm no1tpen feilt aDranvsnu0 exnifcio1fpD  n s;s  2xrim oydlpenlnet t srra(mp;o4tlt if3iyt aDeln o t)tlenxr iatop   nvs (0trtm(mpou1amt mfvi () Dumx  ou4tpxniieiys m emnvs ()trxrmrcoy1fpD  ueslt0s2xmxr nydol nlfcslt)aDtrxm ;o0ale if3tas mDrm( o;t0 etomf3totfp   ues () exrio ny4omt mivil()artm(mpot0alenioeils a umnvs;u0trtoir3oydlaDeliei;s0 ruoxopnodalee nvsat  rta(  oo0teenmoeiytfm ea( o (4trxrxfcootomte uvo t)seur(r3nu1omtnlnct tf rur(  ;o4optnii3ild aDemu p;u)aeenmociodlm rluvi;s) 2xoxr3oy4lm  liesat) Dtr(mpno1olx  ociatla rlnmo (0 lxoxrciy1optrai o () 2tmxmpoy1altnmiviat) 2ururoou4tlx mfeiydlm2ulums (4tetrxf io1lmDeli olt t2umio3iudopenmnvt s srua(r ;t1aex  o3iydla2rmu pnt)tltnxfciatomD aivil(0trurxm3iy4op   fet t)arum( p;o4apt io3ildlsDrluvs () eenmo3oo1faD lueol()t2uoxr iodolt lnesasf 2um(rpou0olx ioetatls2rluvs;t4 eenxr3oo1fpt  n sls t2uoxo3no4lmeelnes s)aDuau p;u4opt  ociyd a2eln o;t0tetoxo iatomD lu il()trtrimpou4llt lnvs t)arrrxmpot1altn f3iys a ranvs u0tlxrircoytfmD ai i;s)srtrxm3ny4om  lnesas srua(r no1olen o3tyslmDua(ms t4alxnxociydoaD ai ils trum(m3io4op nmfvtas aDrm(m nu4tpen fctyd m2umnvon() eeoxr3tytfmD  ivs () exrxr oo4om emfct s a2urur nu1aeeniociyd m2ul( s;(0trxnmf ia1la  an o s texm(mpiu1ope lfvsa(faDtm(rpnt4opt  iciad mDumnvo;(0trenxo tydoat lnes t)s2toir3ny1lp  liet tf 2tmum no0apt io3tysfs rluvo t)tlxrmrcoa1fpt anvils  exrxm ou1ol   fvs t sDrm(m oo0oeto ictytlmDrlumo u0 renxr to1fmDe ues (  2uoxrpiu1apenlivsa(fa2ta( o;t0apxoiiciys s eanvo t) rerxo oo1oat aieo;s trurxopio4omen nvia() rum(  oo4ale mieiatla ua(vs ()teenmfcoo1lmtrauei;t)sexrxmpoo4ll  lieia( aDra(r ;u0aptn o3iat m rau p u4 rtrxoctytoaD an i;s0t2xmim3oy4amenlnct (  Duax oou0aeeo i3iyslmDul(vo t)teeoxo tytfm r i i () 2xmimpiy1optemfetlt srrax ono4ape iieiyd aDemnmp (0tltnmo3oa1la   ueo t t2trirpnodll e fvtls  2um(rpnu4tpe mfeilslm umn snt)alermo3ootop  livo ()trtoio oy1olee fcsa(  2rm( o;o0aeto i3tasfs rl(vp () etrmociatoa e n s ()s2trir io1lmtemfcsa() rtru  nt4tlto oeiytlm2rau o;t)trenxr tadoaDeau o s0 exmir oydom nlfvil() 2urur nt0altoiictat m2ea(mp t0aeeomrctadopDeanei s) rxriopiy4ll e ivs tfs2rru  oo1tpe if3ild sDeln p u)aetoirciy1lpDrli s (0trurxr nydop e ictl(fa2ururp;u4tee ifeiysla rmnmsn(0 exnxr tydoptr ivil( srxrxo3iudlm n fei s  rrm(  ;u1tlxnio3ilt s umnvo t4 rtoio ootfm eaivs;(0s2trir nudlmtnlictlt)s2ua(r nt0aleo iciaslaDrauvs;t4 ltrio oo1latelivi s t2xrxr3oodaltnmivt (fsrrmx o;t4alenmiciat m2elnmp;u) eenxfcoo1lp  lnesls)t2ur(m3oodole  iesa()a2rmx pou1opx  fctatfa ua(msn(4tlxnmo tytoa elivs;(  exoim oy1omtnlfeiat)srra(  ;t1tle ifeiysfm ranvont4 etnmo iatop e nvsls)t2xmxo oo1olt mncia()arrr( p;u4aexo oeildlmDel(mo t)trermfcta1oa   ieolt0srxmir3iy4amen ietl(fsDumx o;o4alt  ieiydla elnvs;t) lxrxf ta1lpt anvi t0 2to(o3iodaltelivt t)s2rmxmpnu1tptnmoeilslm rl( s;t4trxomrcoytlatrlnvols) rxmim no4opee nesls) Dur(  no0apeomictlsfm2emu s t0 rtnmf totoptelivs;(0tetmxr3iudapt mfeils  rta(rono4alt io3iyslm2emu o;t) lenio3iy1faD  i ils0 2ur(rpiudomenmiviat)a2ur(mo;t1oet  i3ildla2ra(vo;(4arxrif totoaDrlnvi;t0srxr(m io1llte ict t) 2ua(ro;u1alenifcils sDeanvpnt)trermo iy1fptran o;t0 etoim3io1omtelfet tf 2umump;u0aptomiciytla umums u0arxrif tatlpt  i i;(0 rxm(r3nodlm nmnvsa() rum(ronu0ope mfeiasfaDrl(vpnt0 rerxr iy1fm e uesl( teuo(m iodlp elnvtlt)s2urumonu0teeoifcilsfm rmn s u0trtomo3oydoatrlivi (0tetmio3oo4lpenmivsa(fartm(rp;t0altniieiysfa ua( o t0 rxrmrctatoa   neo;s)sexmir3no1ll  miei (f 2trxmoou0openmfeiltlsDemnmp ()tetrxrciytoatran s;t0srxmxr3oy1ape mictatfsDta(moot1apenmo3ilsfsDum( o (0 lxnir3to1lp  lnvi ( sexrio3oodap  mncils) 2umu poo0tpx  f3iyt m ul(vsnt) exomrcty1fa e ieol( sruoxm nydap nlietlt sDtmur no0oeeomo3iyslsDeauvpn() etomfcoatlp rli olt)seurxm oo1ol nlnes tf 2ururoot1opeo o3tydla rmnvs t0 rtnmo3oa1fmteli s (0teto(r oo1lmenmivils  rtmump;u1texnmo3ilsfs2ua( onu)alxomfcoatlm   n i;( trxrim3oy4alt lnvia()srtaurpno0tlt mieiydlm2rau o;u4 exrxr oatlat au il(0 2tmiopoo4ap emiet (  2umuront1opt  ieiytlmDel( o (4 etomocoo1la   uvo;s)s2tmim3oy4altnlfetls)a2tmu  ot0tpxnmieiys a raumo t0 etoif3totopte uei ( tetmir oodaptnlfvsa(f 2urumo;o4tpeoio3ildls2rmumo u0 exoxf3oytfpt  ivs t0 ruo(mpnu4lm elncta(fartr(rpot1tlxnio3tytfs uln p;u4tleomf iotoa   n s t)setmim3oo1oltnmietat  2umu pou1tex mfetys m umu ont4tleoxr oa1lmtr nvo;s setoir3iy4al  lfvi t) Dtm( o;u0oeto fctlsfa elumo;(0areoxr3oytoatr n i;t0 exmir3oodopt mfes t) 2rmu  ot1olt iocias m umn o (4artnxo3ia1lptr uvi () eumxopno1ol emncsasfaDurur ;u1tpxo oeiys sDrauvpnu) leoxocoy1fp  au ol( t2xoxo3oydaltnmfviltfsrrmumono0open ociydfs2ea( p;(0trxomf3oo1faDrln s t  2xrio iu4oltn fvil(f Dtmxrpno1tpxnmiciyd s2ua( o;t4trxnifciatfptr ivo;s  2tmxmpoo1olenmfeil(  Dumxr nu0opeomfciys s ranmp u)aeenxrctydlp  ln i t0s2triopio4lptn nvs t) 2tru ont4apxomfeiad sDrauvp u0trtoif oatoat  nei t  ruoxo3oy4olen icta(fsDraur oo0openio3iyd m2ua(vsnt4 etrxr3iatlp r uvo s)srtmxopoodopte icta( a2rmum ;t0tpe iiciadls2eanvo u)artnxf3iytfaD ai ilt)texm(r3oydllenlnvil(fsDrmu  nu0oetnmi3iysfsDumn snt4tlermfciydfptrlueols  2uoim iy1lpte iciltfs2ururpot1oexomfetltfs rlump;(0tlenifcoy1fa elivs ( tetmiopoodomtnlnvta(faDuaxrpnu0apenmf3iadfaDem(mpnu4 etnif3tadfmDrlivo;t0texmxr oo4altn neslt s2trxrpoo0tetoioeiatfm2uln s;t0 lermo3todfa elnvsl( trtm(m oy4alt mfesat s2raur ou1oeeo ieild m rmnms;() rxrifcoo1om rluvo;s  2xmim ou4lmt  netasfa2uaxr no1oexn ictasls2uauvs;(0artrmfcootlp e n i;s s2uoxo iy4alee ivs sfsrra(moot0aeeniietys m2em(mo u0teerxoctadomDe uvs;t) ruoiopno4lm nmnviat  Dtmu ono0apxoifeiasfm2rl(mo t)aetrir totoptrluvi;(0trurxmpiodom emfciat arraumo;o0aexn feiyt a2eauvs;(0tlxrmr oo1laDelieils)seuo(r nu4oleelfvsl(f rumxmo;u4tlx if3iltlm2el(msn(4artrmocoa1oaD luvslt  etmio ou1apt mnvsas s2rr(m ot4tltn o3tas a rl(mpn(4aeermfciatomD  i s;t  rxo(o ou4omeemiviatf Drr(r ou1tetomf3iysfm2rlnmp ()trerif3iodoaDeauei t teur(rpoodome  fetat  2rmxmp;u0opto oeiad s2rm(vs;u4alxrirctadfptelnvols0tetoir ny4lm elfvt s srrau  nu1oetoifctyt a2ea(mpnt0 eerxo todfatrauvs s  rtmxr3oudlleemneia()sDrmu poo0alx mi3ils mDea( onu)arenmf iatomDrauvolt)seum(r3ny4ol e fet ( s2tr(m no1alt iociydlmDuanms;u0tlermfctotomt lu il()seto(r3ny1alenmncs sfs2uaump;o0tptoiieildla2emums u4aexnxr3totop rln i s0s2uoiopnudaltemiviat  Drru  ou1ole moeiad mDumu o u4 lxomr3iytfpDraueols0sexrxmpoy4aptn ieta(fs2rru  ;u1texnio3tys mDean o;t) rermfcoo1oa  luvsls0 exrimpoy1optnlnetls arrruront4aetnmieiytfm2ra(mp (4 eeomfcta1fptran slt sexmio ou1altnliesa()sDraxro;u1apxnmieiasls ean o;()aexnif iadlm raivi;() etmxm nodomtnmnvsls srtm( p;t4oex iictldfa2rluvsnt0 etoxo iatlpt lneo t)s2xr(r3oo1lpt mfci s sDraurpno1aeeoioctydla2um( p;t4 rtrirciadomt aivols  2to(rpiydoptemfvsltfsrua(m ot4oltoii3iatfs2em(vp;u)tlxrxfciadfmtrai o;(0srxmxo3nodlpen ncsas aDtr(rooo0optnio3iadfaDum(ms;t)aeenmo tadfateanvi;()srtoxm3nu4op n ivsl(fsDtmxroou0tlxnmieilsfmDulnvo u4 eenmo oadfmD ln s (  rtrim ou1al  mfcs sfa2tmum oo0apenifctydfs2raumo;(0 ltomf todfa raieo;t texrxo3nu1opte neia(fsDurumonu0alx mi3iatfaDulu on(0 lxrir tydfa rluvils0trxmirpiy4lm elfetl( sDrrx pot4tet  o3iyslaDrluvp;t4arerxo3todlatelnes t)texr(m iudlmenlfeias  Dtrurpnu4apeo fcilsla2um( on(0teenmf3ta1latranei s) 2umio oudaltnmnctas s2urxrpot4tetn iciat mDumn o;t) rtrmoctadfateln o t) rum(r3nodlmtnmici t)arumxronu0aet mfcild s2em(mont0arxoxr ty1omtrauvi;t sruoim3no4amt mfet ()a2umxronu4apt  iciadfmDuanvpnt4trtrmocio1omD aieo;s truo(r3ou4olt mietl() 2raxr ;u0alt  f3iadls2uaumo u)texnio tytop raneo;()tetm(rpnu1om  lneia() 2trxro;o1ale  o3iyt a rmn s;t0trtnif3iotlmte neils0 exrio iy1ale lfviatf Dtau  ;t1opx iieiadfmDranvp t4 ltomocoytlpDr uvi;t0srto(opiy1omt lncs t  rtrx oot1tptomf3ildfsDum( snu) ltnxr3iodlateanes s) euoxmpoy4omenmnvil( aDraxmo;u4ale  o3ilt aDumumsnt0tlerio3tytfat  nvilt0sexo(o3ou4llen iei s)srrrx  ou0tlt miciytfa2uanmo (0 ltrmrcta1fptrauvolt0 2xmxopoodapt mfci t) 2tmu  ;o4tlx moeiys m2ean pnt0tltrifciydop eanesls  ruoim3nu4om elivi tfsDrmxrp;u1texomfetyd m el(mo t4 eenmf3iytfa  luvs;s)teto(r ny1ope lfciatfsrrrur oo0tlxniicilt mDul( o;u0arxrircoy1oa  an o;( trxr(o3ou4om elnvia(  Dtau  ;u4olxo ieiadfa2ranmon(4tetrmociotla  ln il(0seuoir3iy4omt lfcsl(f rrm(m nu0tltn i3ilt m emumpnt4arxnxr3ty1lmtrliei;s) etrxr3no4op elietlt sDtax ont0tpe  f3tldfa2ua(von(4 renir3oytoatrauei;s) rurxr no4aptn neil() Dra(mo;u0tlxnmoeildla rmnmon(0teeomr3tydomt li ols tetr(rpou4om nlnesl( a2rmu p;t0tlt  ocils sDulnmpnt)tltrxr tadla r nvs;t  2xo(rpiydapenlieils  Dtmum ot4tlxnioctadfaDumumont0tltrmrctydfmt aiei s)teumir3iy1optn icsasfsDtaurp;t0apeomoeiyd mDuan pn(4trtrxfctodoa rluei t t2trir3iu4lp  mnei ()sDrr( pnt4alxnmfciysfs rm(vo t4alenmr3to1la rlnvolt) eumxr3nu4om e ieslt sDurx  no0olxnii3tat sDumnvo;u0aetrmr ootomt li slt t2xrim ou4lpeelfvilt)s2tmxr ;u4tet mfeilsfmDra(vp t0 lermfciotoptean i;s  rxrxopiudll nlnvt (  rurx pno0alxo o3ild mDrl(mpnt) lermr ia1om raieils trxr(mpiydameemncsl(farrr(roou1olt mfciys s2elnvon(0alerxr3iydfp eluei t srxrirpiudllte fvi t)sDurxmp;o4apxo fciadla2rlu snt0arxnmf3oadoa rluvols0trxo(m nu4apen nesltfaDtaurpoo1opx mieiatls2elu o (0 eeoirctatfmDrluvslt0teurxmpiudop  mnctatfaDtaxro;o0tpe mi3ils aDemu p t)artoxrcoy1fpDeauei s trtr(r no4omtelncsatfsrurx o;u0aetoio3iat m2rm( s;(4 etoir iodoptr nes;t)seurir3no4lpe livi s) 2ra(rono0tet iieiat sDeauvpnt4 eerxf iotlpDean i;s) etmxopio1lmtn ici () Draxmp;u4tltn f3tasfm ul( o;(0arxrxf3totlmD lnes;t) 2umimpio4apte ivs s)arururp;o4ope ifciltlm uau p;t0 renifciydfmDe nvs;t) eurxrpou1ol elfei ( aDrr(rooo1aexnmfciydfs rluvo;(0arxnir ty1oat lnvo;t0t2toio oy1om n ivs t) Duax  ;t1apen f3iyd sDuauvsnt0teeoif3ia1omDran ol( s2xoim3nu1al n iesat)a2uaxr no4tltn feiydfs ea(mo (4 rtrxfctotlmtr n o t0setoxr3ou1om nlfcsltf Dtrxr ou1optn ociatfs2ran ont0altnxr3oo1omtranvi;t0s2xo(o3nudlm  lfvsat)aDta(ro;t0oleomo3tatlmDuln s;t4 reniocoo1lp r uvilt)s2ur(m oo4altnmnet s)sDrrxroou4tleo i3iad a emnmo;(0tleoif iatfptrluei;s)s2tr(r no4am nmnet sfarrmur nt4open ociat m rmn snt4aleoif iy1oaDr ueil() exrirpiy1ol n net s)srtr(mpoo1tpe  ieiad s ea(mpnt0 lxomr3tydfa  aueo ( sexm(m3iy1opeemneilsfartmx pnu0tlxoio3iysls2umumpn(0trtrir3iytfatrlues s) rtm(m3oo4opt mfvtlt)sDurxro;u1tet  o3iydfsDrau o;u)trxrxf3oo1opt anesls) rtmxo oo1lp n ivia()sDtaumonu4tpxoioetas aDum( o t0alerif oy1opDe uvs t0setrimpoudalt  icsat)sDtm( pnu0tpeoiociyslsDulu snt4tetomr oodfm elieo;s)srurxr nydam nlfcs s)a2ra( ooo1tpe mi3tltfsDuluvo u4 etrir3tytlaDelues ()seur(o ou4omtelieil() Dtmumono1oetnifetyslmDrlnmo (0 ltrifcoydfp  anvsls  etrirpno1am  lici (fs2trum ;t4tpeomo3iltls2uau snu)teeoxo oy1lm e nei;t)seur(o oo1omtemfvt sf rurx  nt1alenifctad s um( o;t0tlxrxrcoydlateluesls  rurir3oy4olt liviat a2ra(m ;u4tlxn i3ils m2rln p;t0 etrio3to1oa r nvs;t)trur(o3ou1al  lieiasfsrrmxmont0altomo3iyt m2ulumo;t)aexrxrcoadlpD aiei;t) rtm(rpnu4olenlfeil( sDrmu ont1aex mictatla2ul( o;u0 exnmfcoa1fpDran s t) 2tm(m iudolee feilt  rurum ;t4ale ifciaslsDulu p;() ltnxoctadlateluvo s  euoxm iu4lptelici s aDtmx o;u1oleomictydlaDra(monu4alxnmf oydlp rli i;(  2xrirpno1ol  mics ( s2tmxroot1tpeomociyslm ul( s u)artnio3oydlp raueo;( s2xmxm3iu1lp e net s)srtax ono4alxo ocils s2umu onu0tetomoctadlpDrlues;t  exmxopoo4lltemfeiat)arrm(  oo4apx mo3tldla2emuvp t0arxnmo3oy1latrliei ( trxoxo3iudap e ieta(  2rmu  ot1tptomoetaslmDum(von(4altnircty1lpD li i () 2xmio3no1lp emnctasfarrr(mpno0olxomfeiytlm um( p u0teeomrcta1lmDeln s ( trxrxo3io4optn ictat  Duaxm nu1tex moeiltfa2ra(mo t0trenmo tydoa ranvs;(0trtoio iy1ame  net s a2ta( ono1tpenmoetat m2umnvont4arxoxf3to1fm   ies;s0 rto(o nudol nlncs t)aruaur oo1oetnii3tat a ra(mpn(4arermfctatoaDeaies ( tetr(rpno4op   fvslt) 2ra(  ou4alt if3iatlmDua(mp;t4aexnxfctydfpDr ies ()setrxm iodlp elnetat  rraur ;t4tetomo3tydfsDrlumpnt0tlerxfciotomtr nes s0srxoir3iu4aleemnvsat  Drmxmo;o0tltnii3tytlsDuluvsnt0trxrmr tydlaDeaivolt) rtrir3ou1op emnctas s2urur oo4aetoiictaslm2um( s;u)areomrciydlp rai s ()s2umxm3nudll  mfci s)aDtmxrpoo0aet  oetysfa eluvo (0 rxnxoctytfptrlivs s0t2toio3iudam  mfetas)arumxrpou1aetoiieiydfm2emn o;u)alenmfctytlaDrluei s)trxmir iu4alt mivi (f rtaxrpot1tpe moctydfsDemu onu0aetomoctadomte uvo;t t2uo(o oydap elivi (fa2rrxm ;u1aee io3ias a2el( o;t)alxnmfcoo1lmDrliei s) exoio3ny4omtnmnes t)arur(rp;o0opto ietld a2uanmp;u0artomrciatfptrauvs t)trumxo3nu4oleemnci (  2ua( pou0ape  ieiadfa emu onu)tltnmo oy1fp  lu sls0t2um(m3ou4ap nlfvsat aDtaxmpnt1tex moeiys a2emn s;u4teeoio3iatlm e neo;(  rurim3nu1amenmnct (f Dtmu  ;u4tlx iicils a um(vs;t)aetrxr totla r ieolt)setoxmpiy1apenmncia() Drrurpot1oetnmfctls m2emnvs t)trerirciatfpDe nvi s0t2toir no4ll n iesatfa2ua(rpoo4ope mo3tat s um( o;u0 exnir3ia1lp eau s s texr(rpio4omenlfcils s2urum nt1oexniociltfs ulu pnu)aeermocta1faDr nvilt)teumxmpno1lle mivil()artr( poo0tet ifciadfm ranvo t0tetrxocto1omteai i;t  rxr(o3ny4lp nlnvi s sDrmu ooo0opxniietatfm elnmpnt0 lerxrctytlm  anesl()t2tmxopiu4ape lfctas)a2ua(m ;u0apt iieild a em(mpnu0 rxrxfciy1fp e ivo;t)srtoxr3oy4ap e ncsat)srua( pnt0oetn feiadls2ulu s (0arxrxo3totoaDelu sls) 2urxm iodlptn ivt (fartr(mo;t1oetnmieiyd a2ea(ms;()areoxr oytfm   ueil(0trxoim iy1llee ivs t)srrm(r ot0aeeo oeildfsDumuvont0 lenxrcty1fptelneo;s0seuoxm io1om nmnvs sf 2tr(mpot1opxo i3iatlm rm(vonu4tleoxf3to1omtr ieo;t seum(m3nudaptnmiciat sDuax  ot1tleoiiciaslmDuluvsn()trxomo3iotopDr ivi t teurio io4lpt  ieiasfsDtmum nu0tetomf3tydls em(vo (0 rxoif ty1fpDrau slt)tetrxr oydam e nci ()s2umurpnu0texo i3iatfa2rmu sn(0treomrcia1lm rli o ()truo(m iydomen fvslsf 2taxr ;o0apx  feiatfs2ea( pnu0aexnif iatfm elivi;t) 2um(m3ny1ope lieiasf Dtmxrpou0aeto ieilt s2uanvo t)trtrxociodlpt li o t0s2toim3oodope  icia(fa2um(rpnu4aex  fcils mDemnvp;u4texnio oy1lmtr n s;s seur(o oo4olenlfvs (faDraumono0tleoio3iydlaDeaumpnt4 etomr iy1lmt lnei (  2trxopiu1alte nvta(fsrraurpnu4opxo o3tyslaDrlnvon(4trxrio oydoatr nes;s0 2uoim ny4llt  nvi s)sDta(moou1tlx mictasfaDumnmp u)artrmf3iydopD luvs;t0texrim iy1alt  icta( s2umu oot0olx  ieilsfa uluvs u0alxrmo3tatfmt  ivslt0 rum(mpny1lltnmieslt sDtmxrpoo0tpxn f3tlsla elnvon(0 lxomo3iotlpt aivslt t2toio nydap nlfesl(farumum ;o0tpx io3iysfs ul( o u)artnmo3totlpteaies;t trxmxr no1lm nmfvtasfaruaxmpnu1aeeo ieiad sDem(ms;()teerif3ootop rlnvil(0tetoim3no4olt  ivtat)aDururp;u0aexnio3tad m umu o u4teenxo3io1fmt anvi;t0tetm(m ny1openlivtas)arrrxr ou1apenmoeiyd a2uluvs t0 etrif3iotfm r n o t srum(o iy4lp elicia( arrm(mpno0ape  ociatfs2eaump;t4aexrmrciadomDe u sls)t2umxr ny4ame  icslt)srra(r ;o4apx  o3iytfs2um(mo u)trtrmr tytopDe ivs;s s2urxmpiu1apte fes t)aDtr( pnt1apto f3iatfs uaump;()aexoif ta1lpte nes;s)t2xo(o3ou4om  mnvsl() Dra(m nu4tlxo ictytlsDrl(mpnu) lerif3oo1laD au o;(0 rxmxm3ny1lle lnctl(farrau  ot0oexnmfetydfa uln s;t)aexrir tydfp r ivi;s0s2umxr3iu1lltn iviasfaruaur oo0tlt moeiyd sDelnms u)aeeoxr3oa1lmD aues s seum(rpny1am e icslt)a2rrx pot1teeoioetldlm2umnvpn(4aeerircoa1om rluvs t0 exmxopiy4om n netlt  rrm(mo;o4aexoifeiysla emn snt4alxomr3tadfm eaueols t2tmxm iu4lptnlneslsf rtru oot4tle  ociytla2elnmo (4altnmf3oydfp r uei s) euo(mpnu4op e fctat) 2ta(m nt4aptoii3ilt mDran o t)tlxnmrctotoaDelnvi s srxoimpoudlmenmncsltf Dumxmo;t1apx  iciytfs ranmsnu)arxomo3oo1oa r uei s truoimpiudlmeelfctat)srrmum ot4teto f3tasla elnmp;t0trxnxo3totfpD  i ol() etm(m3ny4llt lnctas)a2trx p;u1teenmf3ildfa2umuvsn()alxoio oadoaDeli ils) rxm(opoodol e nvia( sDrr(  ot0tlt iocias a2umump;u4 etnxr3totomt li s s0tetmxrpnudapte nvt s aDtrxmoot1oeen ieiltfsDrmnmp;u0altnmf3iytfmtean o (0srtoxrpiu1lm  lfetl(faDtaxm no1alx  f3tld s2uauvsn(4aetnxf3iydlp e neo;t  rxoirpno1oltnlfet tfsrraxrpnu4teenmiciasfaDra(vsn(0tlxrio3ty1latranvi t  rtrimpnydoptnlivta()aDumuronu0tpx mictadlm2rlu s t4 exrif3ia1fmt lu i () etmxo3nydale lnei s) rururonu4oleo o3iltfs2rln p;u4tleoxr tadfmD anvols) rxoxm3oy1am e nvta()s2urur ou0alxomieiatfa emnms;()alerir3iotom e i i;t0texr(o3io4op emfvtls)a2ta(root4oexo f3ildfmDemnmo u0artoxfciadfpD  uesl()t2uo(r3ou1omteliciat)arumum ;t1alxomoctlsfm2emnms;t4 lxrif iadlmDeaivs s0t2toxm nodop nliviatf rrrx p;t0apx mfciyt a2rln onu0arerir iydfpDran ilt) rxmim3ou4apenlicsls)a2rm( pno4alenmictld s2el(msnt)trenmf3tydfat li i;s t2xmxmpoo4alt lfvia()s2raxmpnt4aet io3ildlaDul( o;t4 eerxf3oa1oat auvols)trxrimpiu4lme mfvsa( srrmx pnt0apxn ietldlmDuln pnu)teeoxfcia1lmD lu s;t)t2xoim oudap elicia(faDraumpoo1tee  ictaslsDrl(vpnt0tlerioctodla   nvi;t)trtrxo oodlpt  neta(fsrtmu oot4alen fcildfmDuau s;t4 lxnxrctodlp eanvsls0 2uoxmpoydame lictasf 2ta( pnt1oex mfetysfs ranvp;t0 eeoxf oy1fmt liei t)s2uo(mpoodapeelivtat)a2taxr ;o4tltniociytls uaums t)tetomf ty1fat li o;s)trxr(mpoydlm emfvsa(farrm( o;u0alt mo3iad s rmnms;u0 lxoxocto1fmDeaueols trxrxopno1ll  micsa()arra(m ou1tpe  iciysfmDulu o (0trenmoctatfate iei t setoim ou4op e nesa()srrax ont4tlxn i3ild sDrau o;()texrxo3iy1la rlnes s0srxrxr iu4opt lnvs t)srrmuronu1oetn feiytla emumsn(4alxnxf3oadfpteai sl( srtoxrpoodapeelivt (  2tr(mpoo4opt  oeiatfa eauvs;(0arxrmo tydoatrlivils0 2tr(rpoydame mfciltfaDtm(rooo1aex mietydls2ulu on()tlxrmr totfpteaivi s) rxoxmpoy4llen ivsl()aDur(rpoo1altnmf3iadfm2rmnvp () lerxoctydfp   ueslt  rtoim no4lltemnvslsfsDtaxmpou1apt  i3iytfs rmuvonu4tlxnxf todlaDrli il()t2uoirpiy1ol emneiatfs2umxm ot1tee  fciasls rlu pn()tetomocoodfmD livo t)t2xr(rpnodll nmfeils) rraumpnt4texn ieiys m2umu o;(4altomr3oatlp  anvo s0 rurio3oodaleelfvilt) Dua( ooo4tpeniiciytfs el(mo u0 lerxo oa1fpDr i i t)s2toim3iy4lle  nesa(fs2ur(m ou1oet ioctasla rlnvo u0tetoxo3oytlm rluvslt) eur(m no4ame  iei s)arraur nu0alxnmictad s2uanvp u)aetnif3tatfmDrlivilt  2ur(mpnydlme  ncs (  rrru p;t0tleo oeildfa2ulnvs;(0 leoxo3oa1fpDe iei s)srxrxo nu4op  micsasf 2rmu  oo1tlxnmoctasfs2rmnmo ()tltnxf ia1fp rauvi;( t2ur(o3oudomte ietlsfsDtax  no1oleniictls s2rl(mp t) etrifcia1oat  ivol(0 2tr(r oy4ape  neta( artau pot0olx moctyt a2rl(ms;t)artoxr3todomt auvs (0 exrio nudal   nctat)a2rr(m ;t1opxniictadla eaumo (4tlenxr3ta1oa  aueo s t2tr(o3nodomen ivslsf 2ur(mpot0oexomoeiytlsDulu on(4trtoxo3ty1om   nvi;t0truoim3iydale lnvilt aDrau o;o1altnmoctasfm em( p;(4 reoif3oydla rli i ()teum(o oo1ll elfet s srtaumpou0tpeoii3iadfs2ra(vs t0 etrmr3iodfmDranvs ( t2xmxm nu4omtnlncia(f rrr(rpno0teto ieiatlmDran snu4 ltoif3ty1om e nvi;(0 2umim3ny1amtelnvi s srraum ot1tle mocild sDelnvo u4alenmr iy1fm r ivs (0teuoxr iodopt  neils) rurxm ;t0tlt mf3iadlm2ua( p u)treoxr oa1fm   i ol() rxrim oo4ome mnvtlsfarurxmpot1open iciltfm elnms;()trxnio ootfm   n s;t)tetm(r ou1lle  ivtls) rraxmonu4apt mo3tyt aDem( o u0aexnmr tydomDeaues;s)texmxo nu4lpeelici t) 2urx  nu4apxo oeiysla2eanmo;() lenio oatopDrlneilt s2xoxr3oydalt mietas arrm( o;u4apeoifeildfs raums;u4 renmo todlm rlnvo t)t2xm(rpnu1opt lies t  2rru p;t1aexnmi3iltfm emuvs u)alxomrciytlaDe nvsl()setmxm3io4lltn ict (f rurx  ;o1alto o3tat mDrln snu4tlxrmf3oo1oat ai ils0 etoxopio4olen ieslt a2rm( oot1apenio3iat a emnms;u0alermf3oydfa  ln i s0teurirpnodlmtemivias) Dumump;t4ole io3iyt s2em( s (0artnioctadop elieslt s2tr(r ny4am elivtl() 2tru pnt0aeeo f3ilslsDrlumo;t4treoiocta1fm e ues;t0sruo(r3nodom nmivt sf 2uaxm ;u0tltn fcildla raumo t)aleoxrcta1fat livs (  eto(rpiodop nlfesa( a2trxmpnu0opxnmi3iydfa2ulumo (4arermo3oydlpt auvols)trtm(r nydomenlnetas srtmuroot4oexn fcildls2rlnvp (4 lenir3oydlate iei t0s2urxm oudamtnmfcs s s2tmxrooo4alxoif3iatlm ra(vs (0alxomo oadoatrlnvol(0trurio3nu1lp  mneiat srraxmo;o0tpxoio3iat m umnvpnt) exomr3iytomt livils trumio oy4am nlics tf Drrurp;t4oex mfeiydfs ra( o (0treoxf3ta1latrau slt0s2uoxo iy4omenlfet (fsDtm(r ot1tpeniociyd m2emnmont) reomo3oo1la  anvsls0 rtr(mpoo1oltnmici (fsrumumono4tlen ieiatlsDel( on(4altrir3totlat  u s (0 ruoirpoo1ale  fesl(fs2tmur nu4oetnio3iydla eln ont4 eenmo3oadomDr neo;()t2toim iydlm  mfct (f rrauro;u0tptoioetldfaDemums ()trtrxrcoodopD an o;t)s2tr(opno1amee fcta()s2uax ont4tpeniieiyslm2eauvp;u) reoxrctodlpD  nvs;( seum(m3iodale mfes s  Dua(root1tpxoifeiysfm2emnvo;t) lxrmr3ty1laDe n s (0s2ur(m3oodope liet t)s2um(  no1opxnmi3iytfmDemnvs;t4 etomr3iydopDrlu i;(0s2xr(opiy1om nmnvt (fs2tmur ;t0tlxn f3ilsfmDum( p;t4alxnxfcoatfm  lnesls)t2umimpiudam e nvil() 2ta(roou1optnio3iltfaDrmn p;u4tltnxrctydfat auvi s trxmir oo1ol  lfesa()srraxm ;o1tltoii3ilsfaDum( pnt0tltoir3io1fat luvs;s)s2tmim3oo1lleelici ()s2rrum nu4olx mi3iatfs ulu p (4 rerircoadfmtr nei s0teuoxm ou4am  lfcslt artruroot0altomfeiytla2ul( pnt4aexnif3iadom  lueilt)t2uo(opio1ale lfei tf Dta( pnu1oetomi3iyslm2eanmonu)altnif oatfp ean i;s) 2uoxr3oy4aptn ieia(farumx o;t4oex  octatfm raump;u)texnmr3io1oaD  nvs ( srxmxm nu4omtnmicsas)sDtm(rpno0oex mieilsfmDum(vs u4artoxf3tytom rlueols0tetoxopoo4lmt mies (fs2urumonu0tpxoio3tyt mDumnmo t4arerxf oytomDr nvi s trum(r iudapt mfvil()sruru  nt4apxomoctydfs eanmont)trtnir3to1fmD  ivi;s0t2urxr iodlmee fvi tfaDtrxrooo0oet  f3iatlsDel(msn() rtoircoadfmDeaneo;s t2tmimpiy4altnmnetlt aDum(  ;o1aetoio3iltfsDelnvont)alxrxr tytfmtrliei;( trxo(mpoodalenlfvilt a2um(mpot1aexnmoeias sDulumo;u)trermr oatla raivslt t2trimpou4lp emivs (  Dtaxr ;u0alx  fetatfa rm( ont4artrif3totfmD aies s  eto(m3iu1ope mncsltfartm(rp;u4tltnmo3iyslm eanms t4 eeomf to1lmtrliesl()setoxmpoy1lp nlivi (faDrm(m ;u0tlxnmi3iydlmDrl(mont0 eeomrcoy1lat an sls0trtrirpou4ll e icta(fs2taumo;u0tltomiciat a eln ont0 lxoxr oodlatrlu i ()s2um(m3oy4om n nvs sfaDrm(m nu0oltnifctld s2em(mont)altoif3iotfp  ai s;( s2xrxr3oo4apen netas sDumu pno0oexoiieilsfs2uau o u0aleoxr3iadlpte ies ()texrio3iodoptn ncilt  2raxmp;u1optnio3iltfs2rmumsn()aeenifciy1fatr n s t0srumim iudllen ieil(fsrua(r ;u1aptomo3iad mDra( p;u4aexnxocta1fmDrai sl(0 etrir3ny1alenlici tf rrmx  ;u4oexo o3tls s rl(mo;()tetrmf3oo1oa elivo;t  eum(mpoy4omtelicils a2rm(m nt0opeoifeiat aDel(vp;u) rerxfcoy1opDrli s t t2umxm nu4am emfcs sf rua(r ou4teeoiieiytfs rau s;()artoxf ia1oaDe i i;()t2ur(r3nudal  mnetasfsDuauront1tltnii3tadfsDrau ont4tlxoxrcta1faDelnvil( srtoir oy1ol n nvsatfs2ra(mpoo1apxn o3iytls2emump;()trtrmfcootfpDe ueo t t2tr(o3iu1ale  nvtls srtrum ou4opx mfeild a2eanmont) lerir3io1oa   i sl()teuoim3iydome  neia(fsrrau ono4tleo ieildfsDea(mon(0 ltrmo tadop raies s)t2trxr3iudopte ieilsf Dumxmooo1alxomf3iadla2rl(mpn(0treoio ta1fmtelivs;s0 2urim3oo4llt  netls s2rm(rpnt0alen f3tadfmDumu ont4trenir3oa1laD aues;t0trxriopnodapeelnvt sfaDuau pot1olx moetydla2eluvp;u4artrmf3todfpD aies;(  rtmio oy1ale  fcs t arraxr ;o1aptn ieiydfsDea(mpn(0tetnmf iotla  lies;()trxmiopoy1aptnlnesa()sDta(rpoo4aeen f3tytla umnmp u4 rtrio ty1oa rlivo t trxoxm no1lle lnciasf Drr(rpou4tlen f3tatlaDuanmo;t4tlerir iytoa eaiei s t2ur(o3oo4am emfvtltfs2um(m ;u0apenii3tadfs el( snu4arenmoctydlpt aueo ( sexo(r3nu4lmenlncsa(  2umxm oo0olx mfciydlsDrm( pnt)texnif to1lp   ivs s) 2tm(o nu4ll emnei t  rrau  nu0opt iociyd a2ranmp;u0aexoxr oadom  auvs;t srxmio3iy1lpen icsa( srtrxmo;t0tlxn feias aDul(mp;(4alenxr io1om  liesls)t2trim3iodapee icilt arua(rpnu1ape ifctytfmDuanvo;t0 leomfciadfp eli o;(0 eum(rpiy1open ivt () Dtrx p;u1oet mfetldfa em(vp u)altrmr3tadla e nes s) exoxr iu4amee fcilt)srrmump;u4tee mo3iys s umums;u)arxnir todfptrluvs;s t2xoxm3oudoptn fetls  rumu  nu1tetoiietat mDel(vp u) eerir ta1oat  ieo s srur(opnudll emncils)s2uauronu0oetn octasfmDuluvs t0teeoif3todla elivslt seuoxr nu4op  lfcta() rtru  ;t1aetoiociad a ulumo;t0tltomo3to1fpD lu i;()srumxo oodopte fct (fsrumumpno4oet iociasls2raums;()trtoxoctadfp r nvi s0 etrim oo1op n nesl( s2trur ;u0tlxn ociys m uaumonu4arxnxrcoy1op  anei;s s2trim oo1al   ivtat) ruax  no1tlxnio3ildlaDrl(mo u0 leomr3iodopD lnvo;s)sexmirpoodomte nei sfa2tm(rp;o0oeenmoctydlmDrl( p u4alxnxoctotla eli s s0t2tmim nu4lltemfes ( aDumxr ot4aee ii3iytfsDrlumpnt4areomf todomtrlu s;t)teto(o3io1lptelfcias)aDurx  no0ape moctlslaDul( snt0trenxr3io1lm   neo t) rtrxr ny1lltemnetls sDrau  ;u1oet iicildla eln ont)texnxociodfmtrai s;t)t2urio3ny1lp   fvtltf Durxrono4tptnifctydfs rmnmonu)trermf iytlmtranvolt) 2umirpnu1lmtemneia(  Dtrx pno1oet mo3tydfm2uaumo u)altrir io1fpD luvo ()s2trxopnodlltelics s  2ta(m nu0tpt  ociaslmDuluvp (0altnxo3ta1fp ran s t0setr(r nudal   iviat)arurxrono0tpe iietas a eln o t) rtnif3iotoatrauvs s) rxm(r3iydamtemfvsltf Dtm(roou4ope ifciyd s2elnvo;u0 rxoio tadfp ranvo;t seumiopiodlp   nvtl() 2rrxmono0aetnmoeiys s elnmo u)aeeoif3iydfm  ai s s0sexr(m3ou1omenmncsltf rtrx ont1apx  ietadfsDrm(vsnt0texomfcio1fa  lieils0s2xoimpoodlpenmfetlsfsDtrxmonu0tee  fciaslm2emnmo;t) ltnif tydlm  livs;s)srtrio oy1lpe mfcsas  rtmxmpot0alto ociasfmDra(vp;u4trxrmo tatfpteai o;t)s2xrxopiydop nlnvtl( aDumx  ot4tee ifctatls ranvp t4 eerxf tydlpDrlnvol(  etrxopoo4amenmfvt ( sDra(rpoo1tetnmiciatfs rl( ont4alxnxf3tytfa rlu s;(0seuoxr3io4omen ieslsfa2umum nt1alt ioctldlm rl(vonu)trxnmoctatoa   ueo;(  rxo(opiydalt  ncia( sDrr( poo0teeoif3iat aDra(mp;(4 ltrio oa1fpte nvi ()s2uo(o3nydll emfvi ( aDrmxrp;o4tpxo ieiltfa uln pnu0aleomr3oodfp   ueilt0s2xr(opiu4al  lfeslsf Dtr(  oo1oleomoctytfs rl(mo;(0alxnxf todlaDe nvo s)t2xrimpnudllt mncsl(fs2ur(rp;t1apxomoeiydlaDua(mont)trxoir oydom r i o s0 2umio ny4opt livi ()aDrmu  nt4tpx mfctasfm umu onu4altnxociatfat  uvo;s0trtrir3nodlp e nesasfsrtrxm ;t4texn o3iys sDrau p t)trxnmr3tydopt li i;(0srumxm nu4ameelfeil( a2uax p;u4oltniiciatlm eau pn(4 lermf oatfmDraiesls0 exm(opoo4apt lncs () Dumxroou4aptn i3tldla2rl(vo;(4altomo oadlatraneils srumirpoy4llee fctatfarum(m ;t1aee  oeiydla2ulnms;(4 lxomocta1omDe nes t t2tmxo3oydamee ict ( sDrrur ou1tpt moeiaslsDelnvsn(0 exnxo to1latr i o s0sexm(o oo1apen fesat  2tmxmpoo1tetnmf3iltls umnms t)tlenio oodfmtr i ils) eur(rpoo1op nmnvils aDrmu  ou4tpt mi3ildfsDumnvp;u0arxoxfcia1fmtr uvsl(0sexoxo iudll nlnviat)aDtaxro;t1tleoifciysfm rluvpn(0trtrxf3todfm eluei;t) euoio3iu4ol emnesas sDtru ont4oltniicilslm2um( s;()aetomoctatlmtr u s;t)trxr(r nudlmte fvtas) Dra(mpot4oltniieildfm emu snu)tleomocoydfa eai s ()srurxm3ny1ll nlietat aDrmx oou0oet ii3tydlm2el(ms (0alenir iytfaDe u i ( t2xmio3oy4om emfei s)arrmu pou4ope io3iyt a2umnvp;u0 eenxo oatla e i s;s  2tr(r no4lpee nci t a2umurpnu1aet mo3tltla ea( o;u)treomfctytlp r u ilt s2tr(rpiudlp n nctls)sDrmumpnt4tee  feilt a2emnvo;t0tetrif3totlptrauvo;s0 exr(m iudalee fesa()s2uru o;o0opx ifciydlm2elnvs () lenmrctodoa   nei t texo(mpno1al  lfvs sfsrum(m ot1tee mf3tad s eanvo;()trenxfcoa1lp elu i t0t2umio io4llt lnvtat)a2rm(mooo1optnifeiytla2rmnvo;(4 exomr tydlmD  i ols)trumxrpoydll nmfci (faDtmu pnt4oetnii3iasfa rauvsn(4aetnxr3iatoaDeln i s0 exo(opoy1ape  nciat)s2ra(mooo4aleo iciatfaDulumo;t4arenio ia1la r ieol()s2tr(r iy4opte ieslsfs2urxrpou4aptomi3iatfaDrmu ont0trtoifciy1lptrlneol()seurim iydopte ies t) Drrumooo1tee iietldfa um(vpn()texrxo3oadfaDrln i;(0teuo(r iu1lmen iei t arrm(  ;t0ale  ieiltls2ran pnt4texrir3tydlp  livi;(0texmxr iy4lltnmfeta(  Drr( oot4oee mfctatlmDrlu o;t)trenif3oa1omDrli s;t) eurxm3no1apenmfcta()s2trumono0apxomoetlt sDulnmo;t4 lermf3oy1lpDraueo t0s2xo(o3nu4olt lfesl() 2rrump;o1altoiieiasfa ul(vp;(0 etrxfcoodlmteaieol()sexrxo3io4ame micsl() 2uaum ou4openifctatfsDem( p;()tltoir3to1fmte i o s) 2trim iu1oltnlfcil()a2rau p;o0oeenmo3tad a el(vonu4aetomfctytoptr nei t)t2umxo3oydam e feilsfaDumumoou4oltomfetad m rau o (0texrirctodfaD  nes t  2xoimpoo4ame livils srra(rpnt1opeoii3tat aDrlumsnu0tetomr3ootlat ai slt)trur(rpnodap e ics (  Dtmum ot1oexn fciaslaDulnvp;u4texoxrcoodopt  u olt0trxoxo3nudal nmicsl() Dtmur nu4tetnmociadfm2el(vs;() rerircto1fpDeanvo ( t2triopnudale mfct ( sDum(rpnt1tleoiictadfa rm(vpnt4 exomo tadop rln ols) 2umirpoodoptnlivsa()sDurx  ot1apt ifcild m el(ms;u4teeoir3ia1lp elieol(0t2to(opoy1oltelnetl() 2rmxr ;t1apxomf3iasfa2rmumsnt0texoxo ta1omteanesl( tetmxo3iu4lmtnmnesl(f ruaurpou1optn iciltfmDra(mo u0aeeoxr oodlat aieil(0t2toio3io1lltn fet t) rtmum ;o0tpt  oeiasfm2uauvs t4 eenif3iy1omDeln i s texo(m3nodlmtnmnvt sfsDumxmp;t4oexo oeildfm eauvo t) exnmr3iodoa  auvi;()teum(rpnudlle mics sf rrm(mpou1texnmfctltfm rm( pn(0alermr oo1oat li s s) etmxm ny1alenmnvi ( s2raxmpoo4optoiieiyt sDumuvp u) rerxo iatop eluvi s trxr(o iu4lpenlfes sfaDuaxrpot4oexoifeiatls elnvsn(0 eeomrctatlmDrluvo;(0setmiopiodape lncilt)s2ta(mo;t0tet  i3iyd a ulnmp;(0tetnio tytopt  uei;t)t2uoxrpiudom elnviat) 2urx  no1ole iietyd m ulu o;(0 rxnxf oo1fatrau s s0texr(mpny1ol nlncias sDtr(rpoo4aex ifcildla uln o;(0teeniocoydlate u s t  rxr(m ou4am  micsl()arrrxm ou4tlen octltfs ra(ms u0aeenifciydoptr uvolt srtoxopio4lmt  nviltf 2ta( o;u4tetomf3ilt sDuauvo u0arxoxr3iodoa  lu sl( trtoxr ny1ap  mncs tf Dtrxro;o0teto feiydla el(vs (4trerxo3iy1fmDelneo;s  rtrio3nydaptn ivtl(  Dra( o;t4alxomfctatfa rmnvpnu0 rxrxrcoydoatrln s ( s2xo(o3iudap emfvtl()arrrxmo;t4tetomo3taslm elnvsnt4aeeomr todlmtrlieo t teumim3ny4omt lfesa( arrm(r nu1apenioeiadfm2uluvsnu0 lxomo3oytlmDe n ils setr(r iy4llte iet s)a2umu  nt4texo fctydfsDrlnvsnt)alermf3to1fp e uei t0setoxm3nydlp elfctlt) 2ra(mooo1apen o3tyd a umumo u0trxoxo to1la elivi;t) 2toxrpnydom e ici t a2ta(  oo4oleoiieiaslaDumuvo;t)trtnmr3iadomDrluei;t)s2xo(o3oo1aptelieslsfaDtaxrp;t0tpen fcilt a uau snu)texrmocoa1opt liei ()tetoxo3oy1aptnlneils)artmxmpot0aptnii3iysfmDrmnvont0treoxo oodfptelnes;() eum(o oydapenmfcias sDrau o;u1tpt mo3iyslm emu p t)areomrctotfat  ieo s0 2ur(mpou1omt mfet sfsDtmx o;u4olxo ocilt mDeaums;()arerif3oy1fa rlies (0 rumiopiy4lpeemfvs (  2rmump;o4oetomfetys m ea(vo;u4 reoxf oatoaDr n slt) exoxo3ou1am elfeias)srtr(m nt1olen o3iytlm ean snu0 etrxr oytoaD li i;() 2urxo oy1olenmfviat)s2rmx onu1alxniicias s2rlnvs t)tlerirciydoa elnvsl( sexm(o iodole  fci sfsrtmx p;t1alx io3iltls ulnvo;t4 etrxrciotfmD aueols)srtmxr3nu4ol  lnctlt)aDtmxrpnu0aetoif3iat m2umn onu)trxnmrcoodfpt lu s;(0s2ur(o3oodlm nmivsa(fs2rauro;t1aex  o3tad s uaumo u)arxrmr ia1opt  ues;t) rtmxm iu1amtelfcta(  Dtmx o;t1tpt  o3iytfsDem(ms t0aetoxo3todlpt lieils seum(mpoy4lle lnvia(  rrrx  ot1teenmoctydlaDean s;u4tetomrciydoaD au o ( t2tr(opou1om  liet sfsDtrumooo0apxn o3ils aDranvp t) exrxf3ia1fateaueo;s0t2uoxo3oodop elivt (fa2rmurpnu0aee  fetltlaDeauvo;t4aeenir3oa1lmt aueo t)srumim nu4llt  nei s sDrm( poo1altoiieiytfm ra(vp;(4tltoir3oadfmt aneo;t)sexmim3nudamt  feils srta(  nu1tlxnmf3tatlaDel(vo u4 rtoxr io1oa eau il(0 eumxo3iodopt lnetas s2raump;t1alto octytfm rau on()aexnir3iydlpDeli i;(  eumim3oy1oleemnes t  2rr(m nu4texomo3ilt aDelnvpn(0arerxfcoytomDeanvs s) 2urxm3no4ll e nci s a2tru ont1aeenii3tat sDrmu p;(4 lxnxr iodlpDrli ilt0sexrim nydom  lfctat a2um(  ;t1aeeoiociytlsDrlums;t) lenxo3oodfp  liesl(0sexoirpnu1lp   fei t)aDrr(mo;t1oexo ietld m2rl(mpnu)tlxrmf3iatoptean o;s  2tm(o3ou4omt livia(  2rmur ;t1oeenmfcildla ranvpn(4 ltrmo3oodla rluvs ()s2trirpou1ol  mivslsf Dta( p;o1aptoifctad a2rln s u)tltoircta1fatelueo;t) etmim io4lltelnet ()a2rrumpoo0tetn i3iaslaDumuvs t0 rtnir tadlm   ivs ()t2tr(o3nu1ap emies ( srrmxrooo4opxn feiytla ulnvs ()tleoio oytfpt li s s0s2trimpnudoptn fctlsf 2ua(  ;o0oetomi3ilt sDrm(vo u0teenxr oo1fp rliei;()srtmio3no1am nmfvtltf 2tm(monu4oltnif3iyt a2eauvs;u)tlxrxo tadomte nei t0texrio3oodamte fvta(f 2rrur ;t0opx  ictyslsDrlnvp;u) etnmf3oatfaD aivo;() etrirpnu4lpe lnctat  Drmx  ;t1tpxnmfeiyslm2uln s u)altnxo oytomte uvi;t0seumiopiu4lm n nctat aDuaurpnu1ope mi3ilslsDel(mpnt0aeerxr3iadlpD luvi s t2trxo3io4lle  nvt s)aDtru o;t4alenmietydls uln s;(0 etoxo oadfmD  u o s teumir iy1lp emfvilt)s2tm(ronu1apt iiciaslmDelnmp (0tlerio3iotfm eau ol()tetm(o3no1lpenlfvsl() Dra(moot1oet  iciadfs rlumo u4 etoxr iydomte i o;()srurir3ou4op   ncsa( s2umu oot0tlen fetysfs ea(mp;t0aexomr3totoatr n sls tetrir3nudlpe lfviat a2urx p;o4ope  ieiltfa emu pn(4texoif3ootfpteau i;(0teumirpiudapen nvs t arururpot4ole mfeiys sDea(vs;(0tleoxr todfptelivs;t0seumxr nudome licsa(fa2tmx pnt1aeeomi3tlsfs2um(vo t)arxrxo3tadomDelnes;t0 2uoxrpno4apenmfes t)s2rrur ;t0opxomi3tatlm2eanvs (4tltrxo3oy1fpte neo;(0 2toim3ny4lleelfetlsfa2ra(mpot1apenmfctat a uan o;u4arerxrciotop rlues ( s2ur(o nu4am  mfvsat artmx  ;o4tex  iciltfaDraumo;(0 rtnmf3oodopDrai sls0trxo(o3iydopeemfetlt  2uaumpot1oetn iciys a2eluvpn(4tetomrciydom  aivil(0 2to(o iu1llt mfvils) rta(rpou0aetnii3ias s2rl( snt) rxnmf3tytomtrli i s seumxm3nu1omtelfesl( sDrmu o;o0texo oetatla2rmums;t4alermr3oytfp elueo;( trtrxopoo4am elieslt s2ur( onu1olxn oeilslsDean p;u4tetnmf3oodfp rluesl(  2umxm3iu1ol emieils aDrmur ;t0apt iiciydfa2rmuvonu4 rxomr3to1omt lnei;s0srtoxo3nu4apte ietasfs2rmum no4apxnio3ildfmDrmumsn(0trxrmrciotlaDeln s s)s2xo(m3io4ale mnei sfsDtr(r ;t1olenmfetltfm ea(vpnt4 lermr oydfmt anvs;s setmxrpoo1omtemfviat)sDraxmpoo1aee iiciys m ul(mp t4 etrio3iodfm  livo;t  rxmiopou1al nmfvia(  2ur(rpou0aeeoifetys a ea(mp;t)aetrmf tydlmt  neol()teum(rpny4lm nmncias) Dtrurpno0aexomfctysfa2rl( p;(4artnxrcoatopt aieol()t2xo(r3nu4op  lnvs sfs2rrum ;u4oexnmi3ilsfa2emu sn(4 rxrxocto1om rau s s trto(o nudlm  liesasf Duru p;o1tlto i3tld m2ran p (4 lxrmr iatomt  uei;s0 2toxr ou4aptemfcs t aDrrurooo0oltoifeiaslaDrmums;()tltomr3iatla elnvi;s)seuoim3iu1olenmncil(fsDurur no0aeeniietysfa ul(mo;u0arerxr ootlmtr n o t) etr(o oy1lmeemfctl()srra(mp;o4openmoctld a eanvs t0treomf oadlat an s s0 rxrim iy4ome mfvtl(f Dua(ront1oexo f3ildla ra( onu)trtrifciy1lp ranvols)tetrxo iu1lmenlfcias sDtr(mpnt0aexniociyt sDeaump u4trtoio ootlpt  ieolt  rxo(opiy1olte nesl()a2rm(rpot0altomoeilsfmDeanvont0 exnmo3iodfa rlues;t t2to(mpnudol elnctls  Dtru  nu1olx mi3ild m2rlumo (0teeoxf todfpD livs;s s2tm(o iy1oltnmnei (  2um(  nu4alxniictat m2emnvo;t4 exniociy1fp e ues;( teto(m no1olt  nvsl( arraxrp;o1tpxo feiatla2rlump u0aexoxrcoadoa e uvo;s)s2urio nudlme mivs tfs2rmur ;t0apxnmociyt a2uanvsn(0 rxoio3to1oate n i;(0 2xr(m ou1op elnei s)arrr(mpno0olen ictytlaDuau snt0 renmf3tatlmDrlivi;(0trto(r oudal  mfctls)sDrau pno1ape  i3iltlm umu pnu) lenxo3oy1fmDran s;s)s2um(opou4ap emfet t) 2rmxrpot1aptoif3tys mDumnms;() lxnxr3oatfa eln sls)teto(opno1olee ietat a2umump;u0apxnmiciytlaDemu s;(4tlermoctytfp   ivsls) etr(opiudlle mneil( sDta(mp;o0opxnmicilsfm eluvo;u4trenir iytfpD luvo;s)srtr(mpiu1ope mfvs t) Dtm(rp;t0olt iictas aDeanvs;t) eeoir3ty1oat  ieo;t  rxo(o3oydop   fcsas)srra(rpot1opxoiociytlm2ul(vs;u) reoxr oatomD anvo s srxmirpoo4l
\ No newline at end of file
@@ -0,0 +1 @@
+n o;s  rurxr oo1apt  nci t) Dtmxmont4altnmo3iltlm2umnmo;t0tetnmo3todomtrlu s;()t2ur(o3io4om  mfciat s2uax o;u4tle micildla rl(mp;t)alxoirciadomt auvsl(0trumxo3iy4aleemnvt s  Duax o;t4ole mi3iyt a eau p t)tlermf3iotfa  liesls teuoxo3oodoltnlieslt s2rr(m ;t4alxoioeiat sDrauvpn(4aeeoxf tydopt auvo s0t2xrxo3nu4am  licta( a2umxmpnt4tle if3ias sDeaumsn(4 etnxr3iadlmtrlivs () 2toir3nudom emncia()a2raxmpou4aptn fcilt mDraums (0aeenxo oytfatrln s t0 2uoirpiudalen netas a2raxronu4olt mietad m ranmo (0 lxoxrcoytoa rlivolt0sexmir3no1oltemietas)sDtmurpnt1altoii3tys s umu s (0aeermf3to1lm eliei;( sexmir3iudlm nlfetlt aDurum ou1oetn icilsfsDrl(ms u0 leomo3iatfm rau o;s) exm(o3iy4ol nmieil(f rumu o;u1optnmoeiytla2ulnvsnu4tetrif oytoatraiei (0seur(r oy1aptnlnvi t  Dumurpnu0apxomociad mDel(von(0 rtrif3oadoa eauvs t trtr(opiudoptn iet s srtmxront0tet iictat mDuaump t0tltnmrctatomDr uvolt0 ruoxr3io4lm emneta(fsDtrurono0olenif3iyslaDrl( pnt) eenmr io1fpt livil(0trxmxo3oy4lpeelnvs t  Dtrx pnt1tpe ifciyt s emnvp (4altriocoadfaDrlivs t  rxoxo3oodale miciat s2rru p;o1aex  fciasfs2em(mpnu4trxomo3oadfpt  ivi ( t2xoio3nodapte ici s s2trx  ;o1tpt  o3tadls2ea(vs;u)arenxo oydom   i s ( setriopny1aleemfcsltfaDurxmo;t4olx mo3ildlm emumsn(4tlxnxo3oo1lmtr nvi s0s2umxr oo1lpenlfcs t)a2urum ot4tlxoifeiyslm ulnmon(0texomocoatlpD livs t) rurxr no4oleemnvia(faDtm(r ;o4tleo oeiydlmDuanmp;(4areoifcoydlmD lu s t)seumir ou4ll n ivi ()srrr(mo;u4oet io3ildls uln pn()alxrif todfpD lieils srumxr nodopt  nvsasfaDra(rp;o4apen ietytfmDeanmp;(0tlxnxf3io1laDranvslt)trxriopou4llee fctlt) Dtru  ou1ale iietadla um(ms t4 ltrif todfmDe i s s0teumxmpnydlm emfci ( s2urxmp;u1openmieiyslmDemnvo;u0texoxr3ta1oaDrluvi;s0t2to(m3iu1am nlicil() rua( poo4alt  octydfs2ul(ms;t0 lxrifcoy1lm e neo () rtmxr oo1llenlnvi (  rur( p;o4ale mfciat m2elnvo;()altoxf3ootopDrai ilt) exr(r3io4amtnlieia()arumxro;u0texnmfetyt s ean s t)tltrio3oodfpt li s;(0t2xmimpoo1olenlivtat  Drmx p;t4aexniiciasfa2el(ms;t4trenirciotoa ean s ( t2uriopno1lpe lfcils sDtaxro;o0olxomi3iyslaDrmums (4artomoctydfm  lnvi;t0 rurxr iydapenmnetas srtrur ;t1tetomociltfm2ua(ms;t0 rxnxfctydfmteau s;s0 etm(mpoodlm   nvilsfs2umu p;u0tpx if3tadfaDumn on()tltnmf3oytop rlieo t teuoxo oy1apenlieil() Dta( p;t4oexomo3tltfs uau p;t)texoxr3ta1oa  auvilt  etmxmpno1alt mneils a2ururp;t0tpx  ieiadfa elu s t4tetrmo ootlp eluei (0t2xrxo3iu4alen nvtlt sDtmx pno4tlxnmiciys mDran o;(0tlenifctotla rlueilt)tetr(r nu1lmt liesls  2tmuront4tet mfctydfsDua(mp;u0 ltrir ta1lpt  n o s0 etrxrpnu4lm elncs t  rtru  oo4oltnmiciysfmDeau sn(0tlxrmf iytoatranvo t0srtr(r3oo1opt mfcs t aDraxr no0apeomi3tytfs umuvs t4 ltomr3tydoatelnvs s)sexmio3ou4ll n ics (farrr(mp;u1optnifctys aDrlnvsnt4 exnir tydlaDraivils0 rxr(o iodlpenmfvsl(fs2rm( oou0aptomoetysfaDrl( o;(4aetrxociy1opt au s t0 2tr(m no1ll elicta(fa2rmu  ;u0alx ii3tyd m rm(vonu)trxoxo tadfmDe nes;t) 2umiopnudal  lietas)sDtau oot4tlx  oeilsfmDea( o () rxrxr iytla r n i t0 2xmxmpiu1alt mnet t)sDurur ;u0aeen i3iydlaDua(ms;t4trxrxr iy1faD ln sl(0s2xr(r3nudopt mivslt  rtax ont4tetomoetas m uluvsn(4 ltnxo3iytfatrluesl()srtrxm ny1amtn ivs t) Dta(  oo1aexn o3tlt mDrm(vsnt) rxnio iadoat anvilt)trurxo ny1opt mncia(fsrum(r ot1tlxnmf3ild sDra( snt0trtomr3todop  aivs (0setoir ou4omtn nvsas)s2rrxmpot4teto iciadfs umu onu)tetrmo3oatlp  aivilt) rxm(r oy1lltemnet s)s2taum nt0tptomfeiltlm rmu snt0tleoio ia1lm  lnvs t0srumimpou4alee ivslt s2umurp;u4apt  ieiysfsDuanvont4 renxociytlmt lues t)srxmxm nu1olen fcsatfsDtmuronu0opto feiat s elnvp u)alxrmo tatopD auvil()tetmimpnudapt livs sf 2ra(mpno0tle mieiytfmDranvs;(0 ltoxfcto1lmDeaivo t  2tm(r iodapt mfvt t) 2rmx o;o4aptnmociasfm2rlu p;(4texrir oatom r ies t  rum(r3nu4lmtemfvtltf 2rr( o;t0alx mi3iytls el( pnu4arxrmo3ia1lpt  u ilt0sexr(r3oudam n iciltf Dtrur ot0aexn feiasfa2rmnvo;t)tltnio3ta1fpD  u ol( texm(opno1omtnlfci s arurxrp;t1apt  iciyt mDemu p;t)altrxf3io1la   ueo;t  rtr(mpnudll   nctls)s2rrum no4teen fcildfm rmuvo;u4 rtnxr oytfmte nvo;t0teurio ny4lmtnmfciat)srrmxrpou0olxniicildfs ua( o;(4 exnxrciodfmDelneil()s2umxmpny1ol n fetlt) Dtmu pot1alxn i3tls mDemnvo;u0 etnxr3ty1omtrlnes (0 rurirpnu1lptnmfcils) Drmx  ;o0optomfeild sDea(vpn() eenmocto1lm eaues t0s2xoxo3oodlltnmies t) rraxrooo1altoii3tls mDrm(msnt0 ltoir oytlmteai ol( sexm(mpiu1olenmncsls aDuax  ;o1teenif3iydls ulu snu0tltnxociydfptean ils0 euriopoy4lm  lfvt t aDtmu  ot4aeenii3iltlsDran p u) rerxf3tadomDrauesl(0 eurxr3nodaptelnvils) 2umu  ;t4opxn feiyt s rmnmo (0 etnir oatlmDe ues s0 rtmxr oydlp   nesltf 2um(  no0alt ioctasfmDem(vs u4arenxf ootfa eau i (0 etr(mpio4aptnlfvilsfa2rrxrpou4oeeo fetydls2ul(mo (4tlxrmrctadomteaivsl(0t2uo(m3ou4al nmics sf 2uaxr ou0tptoifctltlaDranvs u) ltoxfcty1oatrlnvo s0 euoio ny4lmeemietat  rta(mo;t0tpx ioetys s2ua( s;u)aeermf to1opDelueslt0s2tm(m3nu1ole  icsas sDrrurpnt1aetoifetys aDranvs;t4aeenmr oo1lpD  iei (0srxrxopoo1am  miciltfsDtrxr ;o0oeenifciasfm elnmp;t4texriociy1laDrlu ils0teur(o nodame mnesat)aDur(ront0opt mf3tytfa2ul(vo u4tltrmoctatlptr u ils srtoxmpnodoptelfvtl() Dumx pou0olxoiietytlm2umn snt)aexniocto1faDelivil(0t2tr(r3ou1al nmncsl(fsDra(rpno4oet io3iyt aDranvonu) etrmo3tytop  lnvi;(0sruoxm iu1lptn ietls artrumoou1optoio3ilt aDrl( o t4 ltrxf3iotlptr uesls0setoxm3iy1altelici t)sDuaxmpou4olt mietadfm emn s;(0 rxnmf ty1fp rlnvi t)s2tr(opnydam  mivslt) 2ra(  nu0tlt  f3tys aDemumonu4teenxr iatopD  ivsl(0 exrir3nu4omt lnct sfs2rmump;t4apeo f3iys a ra(mpn(0altrmo totoaDean i s0srxr(rpiudoltn icil() Dra(r ;o1ole moeildfs2el(vsnt0arxrxr3to1oat auei;s) ruoxrpnudlp elnesa() rururo;u4open f3tldla uaumpnu4 eenif3ia1opDelieo () 2umio3iy4omee nci () Dtax  nu1tltoio3iysfs2uanvo;t)arenmf3oodlpD liei;( teurxr oodoptelnvsa( arrmu  ou1tpeo ieilt a2el( s t) ltomo3tytlm eluvol(  ruoxr3oo1ap e ivi ()sDrm(rp;t0apeomociytfm emuvsnt0 lxrmo3oy1lmDrlnvil(0seur(r oy4om n fvi t  rrmu  oo0oeenmociadlaDum(mp u0tlxomrctydla eai sls)s2tm(m iy1llenlncil(faDurxm ;u0oetnmf3iatls2em(mon()tlxnmr3iydom rlnei s0s2trim3nudlleelics s) 2rau pot1tpe iietld a2em(vs u0altrxo3oadfa raieolt)trtoio iudamtelietlsfsrra(moou1tlxniictltfm um(vs u) rxnmr3ty1oa raieils  2tm(o3oy1lleemiesl(  Dtmuroot0tpxomociltfa2ranmo;(4teerirciatfaD  i ilt0tetm(r ny4lpt mnet ()s2tm(r nu4tet  o3tls a umnmont4 rxoxfciadoa rluvs s0 rurxmpnudlmtemivt (fs2rmu oou4aexn ieiadla ea( s;(4tleoxo3io1oaD an i;s) ruoirpiu1alen ieilsfarua(rpnt4tleniictyt s rln p u4tltnxr3oo1la e nes s0t2tmxo3nu1opee iviltfaDumumono1oee  oeiytfm2uaumpnu) reoirctotoa  luvsl()s2xoxm3oodopte fvtltfa2rmxmpnu0optoio3iatlmDrmnmp;()trxrif3oadoat luesl(0srtrxr no1lptemfeilt s2ra(mp;o1tet ii3tlsls2uauvo;t) rxnio tadlmte n sl()tetoxr oodlle  nesa( arurumpot1tpt moetltfs rm(mo t) exnmf iatlptelu s s0s2xrim io4lltnmfvtl(faDrrxm ;u1oeeniiciyslmDel(vo;()tltrmo tytlmteanvo ()srxoir oydale  ici ()s2rm(rpot4oee if3iad sDemump (4trerif3to1fmD  nvi s trum(m io4ll nmivtlsfarraumooo1opeomicils m ua( p u4trtoxf3iytlatrau o ( srxrirpny1omt  ict sfsrtrxrooo4aexomietyd mDeln o (0trxomo3totlpDr i o;(0setmxo iu4oltemfvtat)sDuaxmpno0tpe  feiltls rmn snu)aetnio3tatlmtr i i (0t2toxmpoydopee nvsls)a2tr( o;u1apxnmo3iyt m2eln o u4 rermf tydfp eaies t0 exm(m3iy4alenmnvs (fa2uru pnt1oetoii3tatlmDra(vs u0 eenxf io1oa r u s t  rtm(o ou4opt mfvsas  rtmx onu1teenmociydfa2rmump;(0artnmrcoatlpDranes;(0 2umirpou4ap   fei ( aDtaxront1aetoif3iat aDeanmpnt0 rermrcto1faDeau i ()t2toir oydal nlfvils)sDum(m ;t0opx  i3tas a emu o (0tlxnxr3tadlpteau s;()srumirpiudaltelnesl( srtaxmo;o1aee ioeilsfm ea(vpnt)trtrxf ta1lm e nvo;s)sexoxm3iudamenmivtlt)aDta( pnu4tpto oetytfs2rlnvs;t0 etnxo oydlpDr ivo s)trur(r ny4ol n nvtl( artru ono1tlxn ieiat mDrauvont)tlxrmocta1lpDeau il(0trur(o3ny4aptnmnctatfsDua( pou4aeen fctyt s2ea( snu0aleoxr oa1fpDe uei t0t2trim3iudaptelfetl(farrmump;o1aleo feiltls2emumpnu0arxnmf iatom ran s (0seur(o3oodameelnetl( sDua(rp;u0opxoio3iydls rm(mp () rtrircty1opD luvo;() rxmim3oy4ap elfcs s) 2ur(rp;o0aetnmieilsfs2uan p;(4 lerxf3oadom e nvi;( teur(m ou1amtnmnvsa(f 2rmx ooo1alen ocilt a2rl(msnu) lenmf3iydfaDrln ils0seurxr3io1lme liei s sDtr(m nt1opeomfciasla el( pn(0trenxr tadfaDraiei;s srxrxo3iodole miesat aruaur ou1oetomfciyd m ul( on(0texoxo3ia1oatelivol(0tetrxo nodol elfctl()sDurxmp;o1ope if3iyt mDum(mp;t4aetnifctydfatelueo;( texmxopiy4al e fcs sfa2umx pou4tpe  ictltfa2rmnms;t4tleoir iatfaD ln s;s0s2ur(opnu4aleemieil(fs2urumo;o4aexn oeiys mDrlnvpnu0 eerif iadlaD lueslt0t2urxo3nudape mfvilt)arur(m nt4aee mf3tad s rl(vsnt0trtrircoa1lmDrauei () 2xmim3io4om  licilsfsrrm( p;o0texoif3iatfmDra( o t) rtrxo3totlpDe n o;s) rxmiopio1oltelietl()s2trxrooo0tlt  f3iyd aDrmnvs;(4 lenio totlpt li s s s2ur(mpoy4lmt mfetas) Durumpou1aex  i3ils a eanmo;(4altnxf3oa1opt ln i s t2um(o io1apeeliei ()sDtaum ;u1opxnmf3iyt aDelnvp;()alerxrcio1lm  ln i (0 2tr(o3oy1op n fesatfs2rmur ;u1aexo oeildfa2raump;(4aetomo tytlmDr uvi;t0t2xoio3iudalt lnvsat)artax pot1tlx mi3iysfm emnvpnt0trxnmf iydoaDelnei s  rxmxr nodomenmnvtl(  rra(roou1texnmoeiydfm2uanvs t) lxnmrcia1fpt  n sl() rurir iydomenmiesl(fa2tr( p;o0oltoioeiasfa2eln s;u0 lerxfcoydfa elies ( t2toxm oodlptnlfcils sDtmur ;o4oeeniieild mDul(vpnt)trtoiocoadom rlueolt) exrxr nydlm  mfesat sDra(m ;o4oeen oetasla raump;()aeeoifciodoaD  u o ()t2xo(mpiudapt mivilt aDtrurpot4aexomi3tyt sDrm(ms;t)arxnxo oatoate uvils) eum(m oudop elncsat aDuru oou0oexn f3iaslm um( s ()tlxnmr ia1fmDe uvi (0 eumir oy1aleemict t) 2umx  ot0tlxniociytlmDrl(msnt0 rtomrcoatlp  ln i ()setr(m3iudll  micsat) rrmump;u4tetomfetys m um(mp ()tlxoxfctydfm rlivsls0 euo(rpnu4lme  nesltfsrurur ;t1opt  oetls a2el( p;u0tlermo io1lm eau s s sruoxm no1openlict sfa2umxr nu1oet  ictas
\ No newline at end of file
@@ -0,0 +1 @@
+u i;s0s2xrxm3ou1om   iei (faDrm(mont4apx  ociys s2rmumo;t)aexoiociodla eli s;s) ruriopio4aptn fesa( sDrruro;o4aeenmo3iatfaDeluvo;(0tlxnxf3oa1lateauvi s0srtoxr ny1apeemnvsa()srrmuront1aexoio3ias m uluvpnt0aexnmoctadlaD  uvs;()s2xrxr3oo4llenmnci (faDtm(root4apenmoeilsfm2ean o;(4arenmfcoadoaDr nvs;()teur(m oy1ll emiesls)a2ururpnu1oltn i3tydfs2uan o t)treoxr3iatfm e ieil(0t2um(r oodlmeelnesl(f Drmxm nu1teenif3tlsla2raump (0 lenxf iadopDrau slt0t2xm(m nu1ll elfvt t) 2ua(rp;u0olenmf3iad a2rl( pnu4 rxrir3oa1la elu ilt0 rumir iudameelfetl(  Dumurpnt1alxoii3ilt m2eaumo;t0 exrxoctodfaD  ieslt s2um(r3no4lp n fei sfsrtmxrpot4tptomieiadlaDem(vs;(4 eermociatlp  auvo;( texoxrpnu4ap  lncias  rururoou0tltomf3tldfa2rmumon(4 rermr3oo1oaDe u s t0srxmir oodome lnvsa()artmuro;u1altn oeilsfm rmn p;(4 exnir3to1lat livi ( setoxm3io4aptemfvsa(  Dum(m ;t0texn oeiasfmDeluvo;(4alermrciytlaDeaivs;s) rtoimpiu1lp   feiat)a2urxrpot0oexomiciatlaDemums u4tetrircootopt  neo s)sexm(m iu4lp n icta()srtmu pno0tlxnmi3tys a2emuvp;()tlenmf3oydfptr i o;s0s2urir no1op n iesas)aDtaxmpnu4tpenifetyt m2eluvs;(0 eeoirctydlpt anvsls)trtm(o ou4ap n fct sf Dtr(rp;t1aet  fetadlsDua(vp;t4altnmo iodfpt  n ols0t2uo(rpoodolt lfcslsfsDtmxro;o0ole  ictytla2eluvon(0arxrirciy1fmtraivi;s)t2urxopoudlp   fctlt) rumxm ;u0alxoioeild a eluvs;u4 etomfcoadomDelnes (  eur(r3no4lm elneia() Dur( ont1tlx moeilsla2el( o;t) rxrmo3oy1fpDrlneilt seurxrpnu4olte nvs t a2rm( ooo0olt mfetasla2ul(mp t) etoxr oydfmt  ivs s)trtmiopio1am e nvia()a2urxroot0open octls s rln pn(4 renxo iytoat  i s;s  eum(m oo1lpenlnvils s2rm(  ;t4oexn fciasla ul( s t)aetoxr oodlpte u ils0 rxoirpno4ap elivtls) ruauro;o1apt miciadfsDel(ms;t4 ltnmo3oo1oa rauvi;s0srxr(rpoy1alenmfet () rrm(rp;t4teenmoetatlm elnvo (0alenmf3iodlmte u s (0s2xmir oo4apt  fvslt) Draxmpnu1oex  ociasfm emu o;u0arxnxr totlmDelneo s t2urxm io4oltemicslt sDrru  ;t4aex  ociytls rauvsn(0trxoircoodfpteau i t  2urxo no1ll elfet ()aDrrx  ot0oexo feiyt m ul( p;u0texrmr3oydfpte neo;t0sexmir3nydoptnlfcilt  Dum(  nu1apxomf3iyslm elnms u4 rtnif3oytom eli il( srtoxopoydlmtemnvsl() Duax  ot4oee mfeilsfa2rmu p;u4trtnmf3tytfp elivo;s) rurir iu1llt  fvi ()srtmxrpou1oet  fciysls2elnvp (4 ltnxo iatfp  anvol(0 exm(m oydal n ies s) rrau pot1ope  ictyt m2eln o u) etrio iy1fmDrliesl( trum(rpoudap   netat)srta(rpnu1aptnmfetadlsDulumpnu0 exnmr3totfa elieil(  ruoxm3oy1ape  neslt sDrmum ot4tpxo f3tyd aDran p () eeomfcoydomD au ols  rxrim3oy4lptelivtasfaDurxr oo4oeenii3tys a2ua(mpn(4texrmfcootlmteauvi;s s2tr(r iudll  lneilt) rrrumpno1ope mietlt a eauvpnt0tlxrxf3tytfaD  neo s0 exmirpio1lpee ivsatfsrurxm ou1ape mfeiasfs em(vo;u0 reoxfctydopDeau o s t2xmir nudaltemiciat  rtaump;o1altoioctytla um(mo ()trxoifciotfm r ivi ( srxm(opiy4lmenmiet () rua( onu0alt mictyt mDeau s;t)tetrif iy1fat anvs ()s2toir3io1lpe  fvtls aDtmxmo;u4alx mf3iysfmDuau snu4arenir3oatfateanes t)seuoxo oo1ape  fet () 2umx p;u4oeto ieiytla2uanvo u4 reomr3todom eaueo t  eto(r3nodlm elici s)sDum(  ;o0tlenio3iadla uluvon(0teenxf3oodopte n i;(  rtmxrpou1lltnmncslt)sDrax pnu0oexomoctyd s elu p u0alxrxrctydoa eaueils0t2uo(r3ou4lpte fvils a2um( pnt0aex ifeilsfa ea(vont0 exoxf iy1lpt au ols)texrim3oo1ap nmfesa(f Drr(moou0oeeoif3iat a rmu o;(4 exoxf3oadoat  ieil(0setm(rpoudlme mneil()arrmumo;u1altnmfciad a uau o;u) lxrif todomt  n ols0 ruoxr3oo4lp n fctat)a2trx p;u4optnii3iyd s2eanmp;t4aetniociotomt  i ilt s2uoxr3iudlm nmiei s)srtmuroot0oleoifeiadfaDrauvp;t0teeoiocoatopDrai i;( s2toio iu1ol nmivia(farta(mpnu0tpx  ociat aDranmo;u4tltrio todfptr nvolt) rur(mpoy4lltn fvtatf Dtmxm ;o4tex  fciytfm2umn s;t) etrmr3ootlmD  ieol(0 eum(mpiy4lmt licsas srra( o;u0teto oeiydfm2uluvp;(4 rtnio3ta1fmt ai o;t  exrio ny4opee fet sfa2tmxmp;o0tleoifetytfaDranms;u4 exoxo3tatla rau s t  2uriopoy4aptemivs ()aDtmuro;o4aleomf3ils aDul( p;t)aetnmo todlpt  u olt)s2tmxr ny1am  mnvs t)sDra(rpoo4tpt  o3tldlsDrmumo;t) exoir iatlp r nvslt0trtoir no4amt lfciat  Dtaumpnu1oleoioeiadfaDemuvo;(4 renmrcoodlmD livo (  rxrxrpoudoleelnviasfartru onu1alt iieiadlmDrluvs;u0altrif tadopt aueol()trtrir oodlmt mfctat) rtmum ou4altnmociydfaDumnmsn()arxrxf3oodfate neslt0 2tm(o3iydll nlicslt)aDuaxmpnt1apxomo3iysfsDrluvonu0teenxociy1lmD lu s ()trtoiopnydll   fcs s) Dumuront0tltn oeiyt s rlu o;(4 rerirctytlpte n s t0srxm(o3iodale  nctas a2trxm no0tex mo3ias sDrl(mpn()arxrmo iytfa r nvilt0 exr(rpiu4lpenmncia(  2rm(  ou4tpe ifetadla ra( o u4 lerioctatlmt li o;() 2toirpio4amt lnei s sDrm(m oo0tlx  ieild m2ul(ms;t0 lerxf oadfmtrlueil()trxrirpnydlle lnvs (  rua(moot1tetnio3iadfm ra( p t)arerxr oadfmtraies;t)seuo(m oudlp emfciasfsrrmx  nt1apxoiieils aDul(vsnu4 lenir3iytlmtraiei ( t2uo(mpiy1lpte ietls a2uax p;t4alxomoctatlm rluvs;u)tltrio oodom r nes (  exo(o iy1ame lfet s a2rmxm no4olxn o3tltfm2el(monu)altoir iytfat  uvi;s  rtr(opoo1lm   fct ()sDumxm ;t1teto icils mDrm(mpn(0tlerioctytfm rau i t s2tmxr3nudlmenmnei (f 2uauroot1aleo f3tltfs emnvsnt0tltrif ia1la eanes;s t2uoxo no1lpee ieia( srtax oou0tet  fciltla2umuvs;(4tleomf io1la   ivs ()setmirpoodaleelfvta( srrrurpou0tpe io3iyd mDran on(4aexrio iotla  livols0sexmim iydop n fetlt artrxmo;o4oex io3iad s umuvsn(0artrifcty1fm   ueolt) 2xoxopiydlmt mnet (f 2ua(mo;u4texo ociytls eln pn()aetrif oydoa   nes (  etrxrpny4lm e iesa()artrxrono4ope mfeiytlsDul(mo;t0trtnir iy1opDeln olt s2trxo3nu1ole mfcs (f rrrurpno0oet iieias m rln o t4 rtnxf oodlpDelneolt0sruoxopio1oltn ietat)s2ua(mpno4tet  o3iat m uanvsn() leoxo3oytfmD lieols) rumxr3iu1llte ics t)s2ua(mo;o0tleoifcils a2uaums t)trxoif tytomDe nvi;t  2xrio3oydomenlfetlt  Dtrxrp;u1aexoioetasls rm(vs;u)arerio iadlpt  uvilt0texriopiydopt  nvsat) 2tr(  ou4teenmictld sDem(von(4tlxnmocoodlmDeanvi;( sruoio3iy1ole mivilt srur(r ;o0optn ociltfa2umnmont4aeeoxfcoy1fateln i;()t2umxrpnu4amenmicilsfarur(m ot1opxomi3iydlm ea(ms (0alxoir3iadlp r ivils0s2um(o no1lmt  ictl( s2taxm oo1altniieiatfs uanvo ()aexrifctytfpDeanvs s  rtm(rpoy4apt  ieiasfsrumx ooo4oeeomi3iadfm2ranvs;u)tleomo3oytopD lnvi t  2tmimpno4apeemfcs ()aDtauroot1teeo i3iydfs rlnms;(4tetnio3iatoaDeauvs () etrim3iodol emfeil(f 2urxro;t1tptn o3tlt s emuvsnu)trxnif tatom eanvsl()srxo(opiy1al e fvi s) rra(moot4texnmo3iys sDrmnvonu)aleriocoytomteaieols0 eumirpiu4op nlfcsl()srtm(r no1oeenmictlsfa uluvo ()arxriocto1la r ues;( sexmio nudomenmfviat)aDum(m ot0tee  feilt mDemu on(0aexrxoctatlmDe uei;s srtrxr nu4optnmncsl(fartm(  ;u4aptn f3ildfa ua( onu4 rxnir ootfp r u olt seuoimpnydal e nciat s2uru  ;u1alto i3iltfs2uln pnt)tltrxo3oy1fmtean ilt)srurxmpiu4lmt lfvsa()a2rru o;o4apenmfeiyslm eaumsn(0areoxo3totoatrauei;s  rxmio nodaptnlnei sfsrtr(ront4oee ioetls aDrl(vp (4texrmocoa1la elu ils s2urxm oo1ap  mnciat) rrrumont4tlenif3iysla um( snt4tltnio3ta1lmDrauei;( seuoimpio4omtn iciatfa2raum oo1aetnif3iydla2elnmpn(4arxrxf tydfp  luvs ()trto(mpoudlpenlivias)aDrr(rpoo4apenif3ils s rm(ms u) lxoirciy1fpDrli s ()texmim3oy4opt mfviat s2ur(rpou1altoii3iasls2umuvsnt4areomo3oatfm raneolt0trurio3oo1lme lfvtlsfsDrrxm no0alt  i3ildlm2elums u0 rtnio3todlmDrau i;()srtrio oudam  lfvi () rurur oo4tlenifciad s eanmont4 eeomr iy1fmDe uvs s  2tr(rpoy4olee fct t  rumx o;u4tet mieiatfs ranvont4arxnircootfat lueilt) eumirpoy4optn ieia( aruaxr nt0opeoifciatlm2em(vpnu0artrxfctotlmDeluvo;s0setmio3nudamtelfvia()arrmxmpoo4olxomoetadfmDeanvp (4tlerxociadfa ran s t0s2umxm ny1ll elfet tf rua( ono4openiocildfmDemuvo;t0trtrxr3oo1op e n s;(0t2xoir3iu1omtemfciat a2tm( oou0tlt  oeilt mDul(vp;u)tetomo3ta1lat  nvol(0tetm(r iudop elfcsl(  Dtm(roou1aptnmf3tldlsDuanms;t4texnxf3tatfptraivi t  exoxm nydoltnmfetls  rumxr ot1aetn ieiasfs uan s t)tetrio totfpD ln i t s2umxm3oo4lltemicslsfs2tmumpot1opx mfcildla umn p t0texnmrcoytfptrlnesl()t2urxo iu4oltnlnvtls)sDrruront4oexoiieiaslm ulumo t0 eerxfcoa1latraueslt seum(rpiu4lle lneils)aDumxrpot4tlt  fctyt sDuluvont) exrircoadoa eauvil(  2xoxrpiy4alee ivs tfa2uaxront4apxnioctltfm2uaums t0aexnxocootom ran i s0 exmio3oydlmen fctasfarraur ;u0opt ii3ias s2elums;u4teenxrciy1fatraies s)setrirpoudamen nct sf Dua(rpno0apeo o3ildfmDrm(vo;u4trxoif3oy1omtr ueolt) 2xm(m nudap elivtlt s2umumont1tee ii3tytlmDuanvs u4 lenxociodfmD  ueol()srtoxo nudame  nvtltfsDtau o;t1opx ioetyt s2eau p t0 rtrio iatla   n s;(0seuoio3nydomtemnviltfsDrrx  ;t1tleoii3tad aDrmnvsn(0trenmocia1lpDrlnvol( teuoxrpny4lmen fcsas) rtrx  oo0tltn fctas s2rlums t)aeeoio ty1lptr nes s0 2toio nu4opt  fvsas aruax onu4alxoifetytfs2umuvo;(4trenir tatopDelnvolt) etr(m3ou1amen ies t) 2raurono4aptnmfetyd aDum(mp t4tetrifcoydoa rlieo;s) 2xr(rpiodam emncia()a2rr(mpnt1tleo f3iadfaDumnmp u) lxrmr3ootlp r ivi;s teto(opou1al nlfviat aDua(mooo4tpe ifetls m2rmu p;t0altoxoctotlaDeaueo (  rtm(m3oodomeemfetlsfsrrmxm oo0tpt ifeiyt aDraumo;u4altrif tydoaDr uei;s  euo(r3nodlltnlnesa()a2ururoot0tptomf3iaslaDel( p;()tlxrmr iydopD aieolt teurio3oudll emnvsl()sDtmxm ;u0optoii3iyd sDrln s;u4artnmo3ootoaDeaivi s) exoxr iu1olen icilsf 2rr(  ou1tleomi3tytlmDrlumon()tetrmfciotlat lu s;s0t2tmio nudaleelnvtl( aruaur ot0tltnmiciydfsDrlums;t)texrifctotopteli o;()texoxr io4llenlnvi (  Draxro;u4tlenmieiadfs el(ms;(4 lxnxoctodlmDeluvs;( s2uoir3no4lm nlicia()srraxm ou1opxomieiatfm2ul(vo;t0 rxnif3iodlaDrai il( trur(m3nodll n iesatf Dra(r ;t1tpenif3ilt s rau snt4treomf tadlpt ln ils)texr(o oo4amtn ietlt)a2tau pno0tpxn iciysls2elnvs u0arxrmrcoy1op   uvi s0t2tmir oo4altn ici sf Dum(r ;u1tetniociytlsDrauvpn()arxnir ia1lmt aivi;(  eurir iudlme  nvsat) 2tmu o;o0apen o3iydfaDrmumont0 reomo iotlat aueo;s)trtrxm ou4lmenmfct ()a2rmu onu1optnmictyt m2uau s;(4trxoir3tydfaD  nvo;t srum(opny4omte nvt (fa2rmur oo0ole if3iadfa rau snu4aexnmr tadoptrli sls0srtoxo3iy1lme mnvias aDum(m nu0apx ii3iadfm2rl( o;t0tleoio3ta1lmDranvs;(  eum(r3oydaltemncsls  Draxrpoo0apxo f3tysfm2um(mpn(4trenmf tydfa eauei ()s2xo(r oo4ome mnet ( aDuaxm nt4oexoii3tatla2um(msn(4 exoif3oodop  luvo;s0 2xo(r3iudopen fcilt sDumxrp;t1aleomieiys mDemnvp u4artoxociadoa eaivils)teumxo oo1optnmfesa(fs2umum no0opeomoctatlaDrluvp;t)aeenmf3iotfmteauvols0t2uoir3no4lmen nes t)aDrrumo;u0opto i3tyslmDemums;t4aexniociatoa rlueo;t  2tr(r3oodoptn fctltfa2ta(ro;u4oltnmoeiysla2emnmont4teeomo totopDeanei t) exrio3no1ame  fciat s2rm(monu0aleo i3iyd sDuauvpnt)alxnxr ia1fmDr ieo;s) rtrir ny4lpee nct ()a2umx o;t0aptniociat s2ean p;t0 lxomocta1fatraivsls t2tmxmpny4ap   nvi (fa2tm(roou1opxomfeiltfa emuvs;(0trenmfcoy1laDeaivols t2xoxr iu4am   fei tfsrtrx  ot1altoiietldlmDulnvp u0 eerir3oatlatrlivols0srurxm nu4lltelivsas srtmxm ou1tlxo ieild s2eanmo u4 lxrxf3tatlat  i i t)s2xrxo3oy1alt lnvt ( arurxrpnt1aptnmieiysfs2rmnmo;u0alxomfctatlpDrlivs;()sexm(mpnu4lptn nvilt)sDtax  ;o4olt if3tat a ul( o u4 lerxfcoydfaDraivo (0s2uoir3iy4lmte iciltfs2tm(  oo0oleoioeiatfa2uaumo;u0arxnmrcta1fpDeluei;s texrim3iu1ll nlnet s)sDur( oou4apt if3iadla rmuvo (0aeerir iydfmDelu slt  2umimpoudal   neiasf 2umxro;u4optomi3iyt aDumu ont4arxrmrctotoa r ivi (  eto(opno1apt  ici s) Dtmx pou4tptnmieiad s rmuvp t)trxrmf iytfaD  ues;s)teuoir nodlmte ivi sf rrm(ro;o1teeoifetytlm2el( s;u) renxf tytlaDrli o s  exoim3iu4lmeelnvtlsfarrrx  oo1oexo feias m um(mo u)arxnmf3iadfpteaivs s0tetrir3nodop nmietltf 2rrxmo;o0tle  feils s2eaumo ()aeeomr io1oa   uvs t t2trxo3oodlpen fvil(fsrra(mpno4aleomfeiytfa rmu sn(0tlermo3oa1fat aies;(0 etrxm iy1ap  lfcs t a2tmumpou1tltoiictaslaDumnvp u0 eermocia1oa e uvo (0 rxrxo oydol nlnesat) 2tr(r ;o1olen oetydfa2uau s (0 rxomf3tydomtelivi;s0 2trxopiy1amt  ivtasfsrua(mpot4apx mictlt aDrl(vont)areoirciy1fat anvslt)tetrirpoo4ap elfctlt sDtmumooo0olxn i3tldlsDuluvpnt0 rtrir3tydlmDr n o;(0 2xmir3oy4op  mieiat) 2rau ono1oexoioeiadlaDrlnvo;u4aexnxr iytoate ies;( t2xrir nydlptelfvt s)artr(m ;u0tpxoioeiasfs rl( s (4 ltrmf3io1om  liei;s tetmxr3iudlm n ictls sDum(rpoo1opeomieiatfmDrmnvpn(4tlxriocootfptrai il() euo(o3iu1openmnvtltf Dtaxmonu4aetn f3iytlm elnms t4tlenmr todfpD  ivsl( setmim iydlltn nes t)srra(mont0openiictys sDelu o;(4arxnxr3oa1fa rlu o;(0teur(rpio4op n fvsltf 2tru p;o4ale iiciasfa um(mp (4 leoxociodfa elu ols  rxrxo3nudlmt licsas sDtmxr nt0oet if3iytlsDrmuvpn(0aexrmr3iodlaDeaueilt)t2tm(rpny1aptelivsls  2tmu p;o4aetomieilt sDul( o;t0 leoir iydfa e uvi;s seuo(rpio1lle  fvt s) rua(mpno4aexnif3iasfm uanms u0treomf iotlaDr n i;s)texoir3nudal  mies tf rrr(mont0tlx  ieiat s uln p;t)aeeoio oy1lm r n i;t)teuoxm3no1om nmivia(fa2rax  oo1apeo o3iltfm2rlu o u)tlxrif3ootlmt  uvs;s)teum(m no1ll emietl( srrrxr ou1oltnioetyt a eau p (4aetomr io1oaD auvi (0 exrxrpno1open ivi (fs2urx  ;u4opto f3tldlm umu snu4alermocoodoaD lu s s t2urio oudom n ncilt)srtm(rpot4oleniieiltfm ranms;u) etomr3oydlpDelnvo;s)seto(rpoy1lm emietlt)a2uaur ;o1aetomietyd m el(ms;t4tetrxrcoy1faDraies s)seum(r nu4om elneilt) ruru poo4tetnmiciytls2eau s u4artoif oa1fa   i ils teum(o3nydlmtemnvil()aDuaur nu1oleo ocilsfaDrmnmsnu)artrmf iadfatr neo s0 etrxr oy4ol nlnvs ()aDtm(rooo4aptnmictad m ea( s t4aetnxr3ia1omD li i;t)texrimpiodlltelivt t)srum(r nt0oee mfctyt mDranmp (0tltomfcoydfm   n sl(0t2umxm3io4lme lfcilt a2rmx  nu0tpxoifctydls umums ()tlerir3oa1fmD aueo s  2urxrpiodomeemfctltfarrr(roou4alto feiys m2ulu s u0aeenmf3io1lmteaieo;t)sruo(opoydam n ncsls aruaurp;o1aet  fctlt a2rln p;u)aexnif oatoa   ieo;s sexrio3io1lpte fci t) 2tmx o;u4opxoioeiydlm rlnmsnt0trenifciadfmtr n s (0 2uoim iu4ll e feslt  2ur(mont0aptoio3tld mDel(vo;()tlxnif3oatfmDelnvi s0s2xrim3ny4ol nlnetl()s2taxrpoo0oetn oeiydfsDrln p (0tltnmr3tadomt anvilt0 exmio oudap  mfei ( aruaxrpot0aetn oetltfsDel(mp u4aetrmr iadop  livilt srtoxm3nodlpe mfctl(fsruaxro;t0apenioeiytfa2rlu s;(0 lxrio iadlmt luvs s  rum(r3iy1lpeelfci (f rra( pno0texomietad s rmnms () lenmo iydfpD  ueo t0 2toirpnydomtnlfci t)aDuru o;o4opx  o3tysls2um(vont0trenxrciydlpDelivsl(0 2tr(rpiodlmeeliei ( s2rrx  nt0ole  ociyt s2rlnvsn(0altoiocta1fpt ln o;()srur(o3nydlptemnvilt) Drau oou0oetomietyslaDra(vs (4texnif3todlpD ln sl(0 rtoxm iodlp emnvta(f 2rrxrp;t0teeomietls a2el(mp;u4aleomo3oadfate u o t) rum(rpiu4lmenmies (f rurumont4apxnmiciaslm eau on()altoircoatlat lnes;(  2um(m nu1ll  mfetasfsDta(m oo1tpeomo3ilsfaDrluvs (4trxrmrciodlp rlueils0srxmxm oudal nlicil(farrmum oo4oex mociysfs2rmumont)arermrcty1faDeau i s0s2toirpoo4lmtelicta( sDtr(  nt0tetnmieildfaDrauvont4 rermrcoatoa eaivi s0 rxoxm nodaltelfcs t s2rmxm ot1tpenmoeiyslmDranvs u)areoioctydfmDe u s t  ruo(m oo1amtn net ()s2rr(m nt1tet  fctatfa2uanmont)tetrxr oatopte uesls)trxoxo3iy1omtnmfei s  Dtm(  no1tlx mocildfsDulnvo t4tltoxfctatoatr ivol()tetr(opou1llt lnci t)aruru pnt4oexnmiciysfs ulu p;t4trermf iy1laD  uvi ( s2xrio3oodlp  lfet ( aDrax o;u0aee mi3tldlsDemnmont) leomr totfmtr neo s)setmirpiudlm  lnciat  Durxrpot1oee ioeildla2ulumpnt)aetnxociatfp eluvo;s)texmxopiu4olt lnvtl( s2tru pou0alxomoetydlm rmuvo t0aetrxf3ty1omDe u o () 2toxopno1ameelfvsatfsruaum oo1alen feiysfa rl( p t4 lxrio oodoa  aieo s)s2xmim3no4ol  mfetas aDurxm ;o1oltnmieiadfs2rmuvpnu)altrmf iy1fpt anvol()seur(r ny1om elnvsat aDra(moot1tpxoifctys a2um(vsn() ltoio3iatfpD aiei;s s2trxr3nu1lme  ieiatfsrua(m ;o1tetn f3iydlmDeau p ()aetomr3ta1la elnes t) eum(m nu1ap   nes t  2um(m nt1tltn octlsfa ulu o;t4 reoxfcoodlp elu o;t) 2um(m3iy1lp nlncilt  2rmxmoou1oltnmi3iytfs2elums t)alxnxr3iadfm  anvils)srumimpiy4lle lictl()s2tru onu1apxn i3ilsfs2elumsn(4 renir3iodlateau i;s s2trio oo4lmtemnvt tf rtrxr ;o4aexo feiysfmDemnms;t)alerircoodomt aues;t) 2toxrpnu4ape  fvtl( aDuaxrooo4optnifciadlmDean s ()tetrmf iatomDrai slt0tetr(m3iydoltn ivils s2trxr oo0tltomociys aDum( p;u)texrio3tadopDeauei t0 2tr(r3oo1alt mics sf Duaur nu1apenioctatfaDrl(mo (0trxnir3ootfp e u slt trtrxo3ny4lptelieil(  rrmxrooo1tlxniocildfs2emuvs;(0aexnif ta1om e ivol( truoxr iudap   fvil() Dumxrooo4tle ioctytlm ulnmont0 rxoxf3io1lpte nvi ()t2toiopny4amtn nvs t  2ua(mpnu0teenmicias s ulnvon() ltnmr oadopD an slt  euoio3nu1op   neia(fa2taxrp;t1ape if3iltfm rl( o t4alenmr3iotlaD  u ils)trxoimpiu4ope mfesa(f 2raum nt4tptoif3iadls rau snu0 rtrif3tydfateai o;( srtoxmpnydlmenmncils)srra(rpou4tle  oeiasfa rluvo;u4alermr3oydfm eli s (0sexo(o oydll   nvt tf Dumur ot1aptnioeiatfa ranms;u)tetnio oy1lpteli ol(0t2xoxopiudoleelfvslt  Dum(  nt1oltn f3tat a2umums ()teeomfcta1omDeluvo t0teurio3oodamt lfci () rrru poo0opto ictytfaDrlums;(4aetnxo tatomDrai s (0s2to(o3no4ol   ivtl(fs2rrx ont1oeeo iciys sDumu p;t)altnif3io1optrlu olt)trxm(opiy1lmtn nvtl(f Dtmxm ;o1oeeniieiatfsDua(vo;t4aeerirciy1omtr nvils  eto(m iu1ap nlnctlt  2tm( pnt0texn ieiasfs2elu pn(4altnmo oadoa   neo;s0 2toirpoy4ol elnctatfsDrm( pou0tetnmfeildfa emn p;t4 etrif3to1fp eliei;s0 2xrxo3ny1op n ivilt)aDum(mpou4tptn ociydfaDumuvsn(0texnxo3iadfaDrliei t0t2urxm3nudol elietls) 2umum ou4aeen oeils a umnvonu)tltrmo oytoaDelneilt0sexrxr3nodolte nctlsf 2rrxr nu4tlx ii3iltlm2ranms;(4artrir tytlmDe nvs t) etmio oydllte nvtas sruaxr oo1tlx  i3iatlsDrmuvo u)artrmfcoydomD lieslt s2tr(r ou1optnliei t sDtr(m ;o4tlenmiciytfa ea( o (0tetoif3ootfat luvi;t)s2tmimpio1ope livsl(f rtmxmo;u0tle  fciasfa2uluvp;u)trxoir3io1omDrli sl(0s2trir3no1lmeelietas)a2uru pno0oeenioeiysla ul(vo;u4aexrxr iadfaD  nesls0 rto(m3ou1lp elfcia(f Dumx  ;o0ape ii3iatlsDel( p;t4tlxoifciadlmt aivol(0trtmio3iu4lltnlnvi ( aDraxrpoo0opxoioeils s2ul(vo u)arxnmo3iatlaDeau s t t2xm(o iodameelieiat)artaxroou4apx iietydlaDelu s t0teenir oy1fm  lueslt0 2tmxmpiydolenmiciatfsDraum no1oee iicildfaDeanvp;t)aetomo3iatoa   ieo;(0s2um(r ou4apenmfvs ( sDuru  ou4oexn o3iltfsDemu snt0 rxrxf todlm rln ilt) exrxopnydlptnlietl(fa2rm(r ou1aetniociatfa2rlumo u4 ltrmf oodlpDr ueols0 rurxr oudlpe livs (faDur(m ;u4tetn oeiadfs2umu pnt4aexrxr3iydlpDe u o;t)teuoir oy4alen icta(fsDuaxmpoo1oeenioetad m2rmn o ()teermfciatlmtr u s ()seur(mpnodllenmies tfsrtaxr ou4aleoiieiadfsDra( s t)tlerxf oytoaD aivs t seumxr3iodamenlfctat)sruaurpoo4alenmoeilt s2umu snt0aeerif iadfm r ivi s t2tmim oo1am n ncslt)s2rau ono0tlt mociaslm2uluvo (4 rxoircoatfp  li o t0s2xmirpiu1lp  miet s)aDrrxrpou0tpe mi3tls s2rm(mpnt4trxrxf3totlmD luvi () etrio oo1lmenlfesls arrrxro;t0altoifctadla2um(vp u4tlxnxf3oydlmteli o t) rurxopoydaptn fcta(  rum(rp;o4oltoioctlt s rmn pnt0tlxnif3tydlmtrluvo;s teumimpoodal emnctl( sDuru pou4oltomo3ias m umu s u0 lxoifciodlp raiei s0s2xm(r oo4ape  nctlt)a2rm(  nu0aetniocils a eln p;t4alerxf3to1omt livsl()teumir3oo4ome  iei s sDtr(ronu4tee moetydfa em(msnt) ltnmr ta1faDelu i;t) eurxm nodope  neiltf rrru pot0aleoii3tasfsDulums;() rtrir3oa1opt livi;() rxr(o3iydaleemfvtat srtr(ro;u0alxo feiasfa um(vp;t0 etnxo oytfpDeaues t  2xm(rpiy4apenmietasfsrurx ont1oet mociys m2ranmo t4 rerxfctytfatr ies;t0t2tm(opiy1lme mivsas arra(rono4teeo feiadfa ranmo t0treomr iytlm r i sl( seto(o3oydaptemivsl()sDrmx onu1altnmfciltlaDuau pnu0tltrmo oydfpt aueo t0setmxo3io1lle lnctat) 2tm( oot1opxo f3tas s uan snt0trtnxrcoytfaDrau o;s) rum(o no4aptelfvi ()arrm(mo;u4oet iieiyd s2rlnvs;(4texnif tytfmDelues t0texm(o3io4lpeelnctls  2raxmp;t1olenmietyd mDuan p;u0altoif3oydopte uvo t0s2uoxo3iu4alt  fvtlt a2rax poo0tptomf3ild m rlums u)arerif3ia1fateliei;(  rxo(m iodll n icias arum(rp;o4oleoifctyslm2umnmsn(4 rxrxf iatfm  livi s s2xm(m3oy4ol  miesl(f ruaxrpot0tlt iictld s rl(mo u)trxomocoy1fptelu sls0 etoimpny1lm  lfcta(fsrta(m nu0apx  f3iydfmDelnvo u4 etoir iodfaD lu s s0 rum(rpou1optemneia(fsDurxrpou1tltniieils m2raumsnu0tlxoirctytomt  iei;t  rumir3ny1op elivtas)srrrumpot0alxn i3iatlm em( snu)aetrmfcootoa r uvs;s)srtr(m3nu1ll e fvil(fsrtaxrpnu1oltnmictytfm2rl(vo;u0alxrif3ia1omDe u o;( tetoiopno4lle livilsfs2tmxronu1tpeo o3ils a um( s (0 leoxo3oadlatraneilt)trurxrpiu4alen iesas  rrm(root1opx ifeils sDuaump t) exoir tadfpDeauvo;()setm(r iodopt mnvsl()arurxrpnt1oeeo fciltfa ra( p t4aeeoifcoadfpD lies (0srxmio3oudopt mictat) rtmum no4tlt iietas a ulnmonu4 rtrmfciydom eaieils)srxrir3oy1omt  fvtl(  Drru pou4aetn oeiydla2eanvsn()trerif3tatfpD luvs;s)s2xo(o3oydapeelnctl( sDrrxr nt1apt ii3tlt aDel(von()aexomr3iodlptelivsl()tetmxm3ny1ol e net t srrmx pou1tlen fctysfa2ranmsnu4tleoxfcoadlaDr i o ( teurxopiu1omtn neiat artax pnt0tleoioctyt a eluvpnt0 eeomr totlmD  ieo s  rxoim nu4lpeemivslsfs2raurpnt1opt iieiadfs2elnmsnt) exoioctodfmtrli ilt srur(rpiudape  ictat) 2tr(mp;t4aetn iciltfa2uanmo t)aetrxf3iy1fa  aneolt) etoirpiu4al nmnciat  Duaumpno1ole mo3tysfa2eln o;u4 etnxo3iytfp  an o;s) eumxmpiodlpee ncsltf rrr(mo;o0oexoiieiasls uau p;u0tleomo3oytomt lnvs;t srtrxr iodomtnlncs s) rtrx  ou4aleoiictysfs um( s;(4 lxrircoodoaDrlnvo s0seuoxr3io4lltelnvsas a2rrx  ot1apeoio3tldlmDrl(vo u) etrxo3oadfaD lnvi ( trtr(r3io4opt lfcia()a2ta(ro;t1tptomo3tydlm2em(ms;()tleoir ia1fmDe n o (  ruoirpiydapt  feilsfs2rr( poo1oexo ieiasfsDuanms;(4tltnmrcoatoptrluvs t)sruoim oy4omtemfetasfsrrr(mpnu0aptnmoeiytls umu snu)alxnxo oytomtraieo;s  2xrim3iydopenlfcsls srrmu p;t1optomieildfm2rlnmo (4 ltrif3oytlmD  nvo;(0seumxmpoy1lm nliet t a2tr(  ot0opxo f3ils m2eanvo;(4 exnxo iytopD  u olt) 2trxo oydop   iviltfaDua( p;u4opt mfciadls2rluvp (4aeenxr3iotfaDrli i t)s2ur(rpiu4lltnlfcils a2ua(  oo0oexoiietasla2el(vsn(0 renxf3tadoa rauvo;(0trurio3no1lmtnlfct t)s2rm(r nt1apx mociys a2umnmp;u4 eeoio iodfaDelu i s) etmxm nu1op  lfviat sDurxroou0aeeo f3tltlmDea(mp;() etnif oydfa e nvi () rxoirpiydlmt  ieil()s2urur nu4aetnmi3iad s2umn p;t)trtrmr3oydlpD  uvil(0s2xrim3iydoleemfet s sDra(  ;o0texn oeils mDulumo;t0trxnxoctodlpD aiei;(  rtrxr oy1ol  lnvs t  2tax  ;o4apeniictaslsDrl( pnu0alerxr3oy1lmtraueo ( tetmim ny4am n ict t)sDtax p;o4tleoifeiyd a2elnvonu4aexnmr iydla rlueolt s2xr(m oy1ape lfct (fsrtru ont4aeeomociydls2ulu s;u4trxrmo to1opte ies;s trtmxrpiodllte nci t)a2tmurp;u0ape ifeiyslaDeau s;u4 lxnxf3todlm  aieo ( sruoxrpou1lm n nes t sDtruront1tltnio3iatlaDrmu s u0 eerxfciodoat lieo;s0texmxopou4op emnvsa()artaxmoot4tet ii3iydlsDeln p;u)trtrif3oo1oatr uvsls0setrim nydal nliesltfa2umur ;o1altomieiys a um(monu0treomo3oadlp e i i;s0s2xr(m io1lptnlfcilt artmu  nu4ope  fciatla2elnmonu0altrmfciydfa rlivsl(0srtr(rpio4llenlfvil( arrrum ou4alxnmoetad a ran snt4 exnifcoydfm   uvolt) euoirpiy1lpt lfciasfs2rmxroot1aee  o3iytfa uauvp t0tltrxocoodfaDr i o (0sexrxmpoodomte fvi ()aDta(  ;t1apto ietlsfsDemnvp u0altrif tydfptraivolt)sexmim iodlltnmies ()artr(r ;u0alxnmi3ild m eau o;t4 exrxo oytomDe uvs;s) eurir oodlltelfvia()s2rmxr ot4aptomfeildfmDrauvsn(4 rtrir oytopD  ivsl(  rxo(o nydop elnctlsfaDraxmpou0alto fcild s2emump;u4arerxf3oodom ranei ()t2urxrpiu1lm  micias)sDra(r nu0oetoiieiyd a2emnvo;(0teenmf todopte u s;s trtrim iu1lmtnmivt sf rtmumo;o4oeeoiictld a ul( pnt0texoifcoatlmDe uvol()trumxrpoy4lmt mict sf rtmumoou0aeeo f3ilt sDumnvs u)arxrxr3oy1oatr i o;t  rxm(m3iu1ap elfvia( a2raumpno1tptnioeiyt mDumnvo u)arermoctotoa eauvo;( sexoxm oudapeemfeia()aDtaumpou4ale  oeiydfmDemnvon()texrxf oadomtr neol()srxo(rpny4lmtnliviat srtm(mpoo1alt iieiytfmDemnvp t0aetnxf3oodlaDrai ols tetm(r3oydlm elneils)srtmu onu1aet moctltlsDuan p u)tleoxf oa1fptr nvs;()tetoirpio1ap nmnct ( a2ua(rp;o1ape ifeild m el(ms;(0aleomrciotla  lieslt trum(r no1al  mfcsat  2uaurono4aexniictytfmDrauvp t)teeoxo3oodlptr n ils) rtoirpnu1omte ietltfsruaump;u0aptoiiciysls2rl( pnt)treoio oy1lmDelneslt0truoim3nu1altelfctlt aDrrxrpot1tpxo ocils a uauvs;t0 rtoio tytom ranes s0t2tr(m nodome licsl(  Dtaur no0oeeomi3tltfs2em( o (4tlerio3ty1omt aues;t)srtoxm nu1lmt mici t srtaumoot0apx  ietysfaDrm( p ()arxoxo3tydop rauvolt0 rurim3iydap nmivsasfarrmurono0oleo o3iydlm el(mo u) ltoif oadfat lnvs ( trxrir3iydoleelivsa() Dumuroou1optnif3iyt sDemu pnu) lermf totfmt lies;t seum(m iy4ape lnvta( sDra(rpou0tlenmoctld sDrmumsn() lxrxocoodlpt livo t0 exmxmpoy1omen ivt tf Dtrxrpou1ape mfctlsls rmnvs;u)alenxo3iotfaD ln ils) etm(o oydllt mnetl()srtmu  ot4aex  f3iadfa2emuvp t0tltnif3oo1opD livo;s) rtmim3iy4llt  fci s) rrm(m ot0olxn ietysfs2umn pn(4trtrxr3oy1laDraues (0t2um(o iy4oltnmfei t)aDrm( pot0tex mieiasla ul(vs u4artrmrctodla r uvo;t seurxr3oy1lmenlict (fa2tmum ;u0tlxnii3iasfm umnvpnu0tetrmo3tadlpD  uvs t s2ur(o3nudole lieia(  Drr(mooo1tpeo fciyd aDemuvo;u0 lenxfcia1faDeaiei;()tetr(m3oydlmtemfvil()sDrm(mpou4tleomoctyd m emu ont0 lxrxo3iotoaD lnes;s0trxo(mpiy1omee nvslt  Dumx oou1opxnmo3tltfs el( o;() ltoio oa1opDeanvo (  rxoirpiydlpeelnei sf Drrumo;o0apt moeildls2rl(mo (0texnir ootlp rln i;(0setoir3oo1ol e fes t)arraurp;u4tleomfcilsfs ua(vs;(0teeoxrcoy1fpDeai olt0s2urxm iudam e fvt tf rurx pot1tptn feildlaDrm(vs;()trenxfcoydfm   u s;() rtrxo3iy1al nmncilt) 2uru p;o0aleoioetytlaDel(mp () ltoxo to1oa e nvi;t0t2toxo ny4llenmiesatfaDra( pnt0oetn ociasfs2rl(mp t0 lxrmoctotoa eaueils0s2xoxo3no1llenmneil()srtmxro;o1aet ifeilslm2elums u4 rtoif3oy1omDr nesl() 2urimpnudll nlnvta( s2uax pou1tlt ii3tytlaDrauvs;t0 lxomf3tatom rlnvs;t t2tm(opno1alenlnvslt)artaxm oo1oeen f3iytfaDrlu ont)altnmr3oodfmt  n o ( trurxmpny1aleemnvi tfsrtrx ooo0opt io3tldlaDelnmp;t4 rtnxoctatoa  lies;() exmxo ny1optn iet sf Drrxm ou1texnifeils s2ulnvs ()tltoiociytopDeauvi s t2xrxm3nudoleelnvtatf 2ur(r no4tleomociysfs2ran snt0trtrxrciy1fpDran o;( t2tr(o iydomt  fvtltfarumuroot0teeo octldfmDra(mo;u4aexomo3to1omDranvols0s2to(o3iy1ome lietl() Dtaxmont4apx mo3iltlsDuln snt)teenif to1fatraieo s0 2uo(r oodal nlnvsat) rtrxr ou1aeto fctatlmDem( o t4areomf3oatlaDrli o t0 eurxr3oydam elnvt ()s2uaxmoot0oexnmfeiytfs2ra(vpnt4altoif3oo1faDeluvo;() 2umir3iy4lltnlfeiatf 2raump;u4tptomocilt mDemu s;t4aleoxocoydoa e ivs (0t2urxr ny1altnlfcs t a2uaumo;t4alt mocild a2emnvs;t) lermf tytlm   n i s  rtrirpoy4ol  mnet t)sDumum no0openmietyslmDrln s;t0trenxf oatfptrai i;s)t2tm(o3iu1omt  nvsat)sDumx  no1tetn i3iatla ra( s (4treomf3oatlmDeaieol() rxo(mpoydap e fesl()aDra(moou1apx iieiltfsDel(vsn(0aetomr3ia1faDelnvo;s  rxoxr io4om   ncsas) 2rr(  nu0oetniietadla2ua(monu)trxoxrcty1oat  ivo;()seuo(opno4apeelfet s)srua(ronu4apxnif3iyt aDemumon(0 lerircto1fa rli olt)srtr(r3iodal emics tf 2rm(r nt1oeto oetytla umumpn(4aexoxo iodfp  aues s0teuoxm3oydameelnvta(f 2trxmo;u1tle  iciysls umn sn(4trxnxo tytfpte nei;( s2xr(m nodlleemfcil()a2ururo;o0olx micildlaDrluvs ()alenmfctytfa r iei s sexrxm3oudam  lfct (  2uaumoou0tet if3tas a2ran on()aeenmo3tadfptr nvs s  rumxopny1olt livsls arrr(mpnt0olxn o3iydla2rm(vo;()arxoio ootlateaivi t)trumxmpoy1lpenlietatfsDuaxmpoo0tpeomoctytfm um( s t)aeeomociotfaDelues t0trtoxrpoo1ome mnctls sDra(rpou1opeoifetltla2eanvpnt0 etoir iatomteau s;()truo(r3ny1al  mncias)sDrruro;t1tet io3tlsfm ea(vp t4aetrxfcio1fp  auesls trtr(m nudapee neiasf 2rm(mooo4oexomi3iyd a ra(vs t) rxomo iotlpD aivo (0srxmxopou4aptelicilt) Dtrxrpnu1tetn icils m ulums;u4aexnifctotopDeauvo ()trxm(o oudamtnlfcil()arrrur nu1oex miciydlsDrauvp;(0 rxrxo3oodlatrlnvs;t0seuo(o3oodlm emnvi (  Dra(m ;t4tex mf3iatfa2ea(monu)tlxomfcto1fatrlueo (0teuoxr3iy4lp  mfctas) 2tmumooo0aet iiciadlm uan o u) exoxrciotomD ai i s srxm(r3nodopenliei t sruaxmpot4opxnmi3ilsfs uaums;u4 rtnmo3iydlmD aues s0trtoxr3iu1omt mnct (fsDumxro;t4oexnifctytfs2uan s;t0aeeoxr iodlpteauvi;s)trtrio no4lmtn nctl( srrr(r ;t0apto oeiyd aDrm(mp (0artrmr ia1omD  uvslt) ruo(m3ny1am n fvil( aDum(r nu1aleoiictyt aDemnmon(0 lxomo3tytlpDelnvol() exm(m3iodal  mnctlsfsDuax  nt0apt iociysfsDumuvpn(0 rtnmrcoadoatelu o;(0 eumir3iy1omtemict ()aDrm( poo0ape io3tysla emnvs u)aexriociadfpDelnei (0srxm(m ny1ap n ncsa() rrmumpot0tpt iieiydlm2umu p;u) exnir iydlat auei t trxoxr ny1lp nlfeta( srumu o;t0open ieiyt a2el(vp;t0tlxrio3tatoaDrlivi;s trxoio3nodlltnliviltfs2tau pnu1tptnii3iat mDranvs;u4 rxnmoctadlm e nvo s)t2xr(mpno4ole lfcilsf 2trxr ou4alenmicilsfs rmumo;(4 rxoif3ta1fmDean ol(0trtoxo3oydom  mnviatf rur(r nu4apeniociydfaDrl(vo u) lenxocty1fp eluvo;s srxo(opoodoptnlivtl()arrau ono4tetomociysla2elumpn(4 rxnirciytfmt li o t)t2umxm3io4ape  nei s aruaurpoo0alt moeiydlsDemn pn() exoir3oytfmDraneo (0 exoxm iydape lfvtat  Dta( ooo0aptnmiciydla2emu p;()texrxfcia1laD  ueils s2uoxo oudom  mnvta()sDta(m ;t4oetomieiyd sDra(vs;t0 eeomo io1fpD  i s (0 exoxm3oo4lltelfviatfs2tmxr ;o4oetnii3tyd a uln snu4tetnxr3tydoate u ilt trxo(o3iudole lfeta()arraumpnu4oetomiciydfaDran s t0arermf3tadop  anvo t)srtrxopoydlptemivsl(fs2ra( p;u4openioetyt m rl(vs t0arxomo iy1oa rlnvs t)truoimpoudaptn ictlsfsrumxmo;o1alx iictldfa rlnms;t)trtnxo3ootlatr uvs () rxr(m no4apenmfci ()srtau ooo0openio3tldfmDran pn(0 rerxf3oatoa r nei s0t2trxo3iudamenmivi s s2rrur ;o4ole mo3ils a2ra( s;t0tltoiociadlatrlues;()s2uoxrpiydam nlfvi s a2rauront1oeenmietat s rlu s u4aetomr oa1faDe i o s0s2umir oodlpeelfesltf Drax  ou4oexnmfciysls raums u4arxomf3ia1oaDrluei t)tetmxrpoo1amt  ivilt) Drmxm nu1olt mf3iytfmDrmnmpnu)trxrxr oadlmDrai o (  rxmxopiu1op elncta(fsDum(root1tpenmi3tysfm umuvs u0tlenxfctydlpDr nvo;t0 exmimpoy4aleelfcs (f rrrxrpnu4tle mi3tls a ulumo;(4 rtomrctodoat lies;s  2xo(opnu4al elivsl( s2umurooo4oltoioctas sDea(mo u) exnxr oo1fatrluvi ()s2um(m3iy1lp n ieils  Draurpno4ope  ictat sDel(msn(0treoio3oatoate ivi;t)trtoiopiu1ol emnet (fs2tmxm ;u1aptnmictadfa2ulumon(0altnxfcoytfmt ln o t)srxo(opnydom e fvtl( a2rax  ou0tlxoifetls a2umnvo t)trtrio3oo1fmtrauvsl(0 2uo(m ny1lptemfctat srua( p;u1alxnii3tas s2rl(mp;(0 exoiocoo1faDr uvo s srxmiopnu1ole lnet () 2ururp;o1alx micils m2umnmp ()areoif iatoatr nvilt)trto(rpnu4op e nvi t) Duaxm ot4tpeoif3iatlaDrmnmo (4tltnio3tydfmtraueo;s  2ur(opiodlme lfes (f Dtr(rpnt4optomf3ilt s2uau s u0trtrmf3todfat anvo t)s2tmxopoo4opeemieslsfsDum( o;u4ape ifctytfm2ulumo;(0arermf3io1fpDeln s s0sexrir iydam elicsat a2raxmpno4opx  f3iadfa2eln s t0 lxomf3ia1optr uvslt srurir3oo4omenmivsat) rra(rpou4oeeo f3iatfaDelu s;t4aeerxr to1fm eaivslt0seur(opnu4openmivil() 2rau oot4tex iicilslm ra(mo;u0alxrir iy1lm rln slt t2toxo3ou4olt mnctat  2rrur no4ale ii3iltfsDrln snu4 rxoxr3iatfmteaivsls  exrim3no4ll  lnei sfsDuaxmo;t1ale mo3tasla2ranvo (4trtnircoa1lptrlies;t seur(r oy4apen icia(f Dta( pou0alto i3iltfaDum( p;u)texrir3ia1lpDeaues;s) eurio iodlp emfvs s  2tr(ro;o0teto feiasfs elnmo t0texrmf3io1fp r nvsl( seto(o3iu4llenlnctltf Dtm(  ;t0olen oetyslm2rm(mp (4texoxf iytfatrlneol() eur(r oo4optn netlt)aDuru  ;t4apen oetls s rln o t4 etrmfciydlpDeai i;(0t2xoir no4omtnlfvil(  Drmur ot0teeomfetat aDrmn snu0alenio3ty1lpteauesl() 2umio iu4lm nmnviat)s2umx  ou1apx  ocilt a2rlu snu) rtrxfctodlaD auvs (0 2umxrpnydam n ivias aDta(monu0altoioctasls2ra(monu0 lxrif3tydop   uei t  2xmxm oo1omeelncsat) rurxm ot0apxnif3iltfm ua(vo;u0trtomr iadfmDeaues;s srtmxo3iydlle licil( sDra( p;t4apenmi3iasfa ul( p;t0aeenxo3todfaD lies;t0t2toimpou1apte nci t sDurxr ;o0oetnmociytlsDrmn pn(0 rtrio3totfm rln s t)sruoiopoodaltemnctas aDtrumooo4tpenifetytfaDumn o;t)arermf3tatoptr neols  rtrxopnydlmt mnciatfsrrm(r nu0apxoii3ilslmDeanvpnu4artnmo3oadlat  u ils) 2toxm iy4apenmictlsf rta(m oo0apt ii3ild a2eln snt0 etnirciatfaDeanvs;s0s2trim iu1oleelicsasfs2trumpnu0oexniocild s rluvs;(4tlxoif todlm ranvo t0s2uoiopnu4op nmiet sf 2tr(mo;u0teen ociyd m2eaump u)tlxnir ia1fmtrluvi;(0sruoio no1oltn fetl()a2ta( pou4oetomocilslsDuln s (0treoxo3ty1oa   iei () 2uoio3oodamee ietat  rrr(mont0apxnmfciysls ul( p u4 rtoif oadomtrauvi;s s2to(o3iu4lp n fvt t)s2rrxrono4olxoifctat sDemn on(0 lermo oadomt lueol(0s2xoimpoodllt mfvta( s2ururp;t1olto o3iat a elnvpnt4trxrxo3todoa eaieil( srum(m3oo4lmtelfeslt) 2ur(r nt4olx iieiltfm2ean p u0 lxrxfctadlptelu s (0t2toxrpiu4am e fvslt)a2tr(rono0apxnmictltfm2eau pn(0alxrmr3tatoaDeanvs;t0s2urim3iydomt  fctl()s2trurp;o4tpenmiciysfmDran s;t0aeerxrciodla  lues t)trtm(o3iu4lleelfesas) Dtrumpnt1tetoii3iadfs rlump;(0 lxoxr3tadomDranvil(0texoxm3nudoptnmiesl(faDtr(mpoo0ope ifctatfsDra(monu4tltnif3iadlmDrln il() etrir oydamt mfctas)a2trum no0olxomfeilsfa ranvsnu0teenxrcoo1la ran o s texrxopoydoptnlncsa()s2raum ;o1tlto iciytls emumonu)tlxomr iy1lp  au i;()t2xrim3nydape lnvs sf 2rmxmo;t1tlt  f3iysfa rauvonu0 ltnmr oadfp r nes (  rxrxo iudoleelncs s aDuax onu0olt  o3ias mDumump;t4tetomo3tadlm rli i;t srtrxopny1ameelivtas)a2rm(m ;u1tlt  i3tyslmDemumonu4alxoxfctytfaDr nvi t texrim ny4opte ieiasf rtmumooo4tleomi3ilsls2ul(vpn() rxrxfciotomteauesl(0 2xoxopnu1op e ieias) Drm( pno1tlenmf3iatls ul( s;u4 reoio io1laDr neo s trurxrpnu1ame lieilsf Dtrxrpnu4aexnmoctlt a2elnmp (0texoir3iatopt  ivo (  euoxo3nudlltnmfeslt) Dtmxmoot4apt mietad m2ulnmp;u) renmfcoydfp rauei;t) exm(m3oy4ap nlnesas) ruru  ou0tltnmf3iyd s2rlnvo (0aetomociadlm r ues;( setoxo3oudalenlfeiat)sDra(  nt1tlx ioetlsfs ranmp u) rtomf oa1oaDeai i s0t2toio no1llen icsl( sDtrxmoou1oet  oeiyslm uln o u)tlenir oa1lpD  uvo;(0 exm(r nydopenlici s) 2umumo;o4tltnii3tas a2emump;(4tltoxr iydlm  au sls)trxoio iudol   nvia( arrm(r nu0aptniiciytlm uaumsnt0artniocoytoaDr ieo;t trxoxmpnydlmtnliesat)srur(  ;u0tptn ictlslm2emnvpn(0alermr3iy1fp   n o t0srtm(mpoy1lle miei t a2rau p;t1optoiiciydla eanvpnu0 ltnioctadlmteaiesls)srurxrpny1lpe mnviatf rtrurpot0ale iieilt m rmn p;u) exoifcoytlmtranvo;( teuoir no4ope  fetlsfsDumur ot4tleomictytfa2ra( p;(0aetomf oodoat luvils)srurxr3nudamtelfei (f 2rax pou0tlt if3iltla elnmpnu)aleomfctytoptr i o (  eumim no1lmte nvi sf Drmumo;t0tetoif3iadfa uln p;()tlxrifcoydlpt  ivsls0sexr(m iy4ap nmiciasf rtmu oou4alx  f3iltlm2uauvs;u0teenio iatlmDeauvi s)srxoim3oo1lmen neta()arumumono4tltnifetad a2eauvo u4aetnir3iodfa e uvo ()seuoxmpou1open icilt srta( ooo4olxomoetytlm emnvonu0 lxoxf oo1oaD luvo;t0srxmio oy4ameemncias)srurx pnu0opxoifcilt sDeluvp () rxoxrcto1la eaneo;s texm(o iodamt  nvt (  rur( pot4ale miciatlm uaump;t)tetnmrctytlpDeli i (0s2xr(o nydomtnlics sfs2ur( o;o4oeeo fciytfs2uanms u)aleoxf3oytoaDe uvs;(  2tmxrpou4lmeemfetasfsrtrx  ot0altoifeiysfs2rauvs;t0alxrircta1lpt aivs;s0 rto(r oydomtelfcil(fs2ra( oou0oeenmfctys mDrlnvs () lenifctydfp ranvi;s0srumxr oodamenlnviltfs2ra( poo0oee iietasfa2emnvp u0texrxr3oa1lpD  n s;t)t2toirpny1ope  fvtasf 2ta( pnt0opx mfctasls uanms;t)aetrxrcoytfpDeluei;( sexmxrpnu1amtemicil(f rur(  ;t0aet  feiltlm ulumsn()arenio iy1fat anvsls)t2urxrpoodoptnmfciatfsDtr(r no4oexnioetltfm2uln onu4artrxo tatfmt  uvils t2uoir oo1op e ivsltfa2uax poo1aetomicias m2elnvpn(0 etomrciadlp   ueo;( s2xmxm3ny1altnmfesas  rta(mpot0alxn ieiasfmDem(mp;t0tetoif3tadoaD auvi;t0teurim ny1ol nmnet s)aDtmxroot0apxniictlslmDrmu s u4aexrxf3totlpDe uvo;( srxrxo iy4ame  icsatfsDtmxrpno1tetoiieildla2ulnmp (0altrmr iy1oaD  n s;t)s2xrir3oo1lp   iesa(fsDra(m ;o4aetn feildls uan s (4areoxo oa1fm  an i s0s2ur(o3iy4lltn iet tfa2uru p;u4aee mo3tat m emnvsn(4trtnxf oa1fp rli s t) exr(r iodlleemfes s)arrmum ;t4tlt ifciasfa eluvonu) exomo3ta1fpte u o;t0 ruoxm nudlltnlict s) 2raxm ;o4tltnifeiyt aDelnvo t)texnif3ta1faD livs t s2umio oydamenlfci t)aDum( o;o4oltnif3tys sDum(vp t0 ltomr3to1lmD  neo;s t2uoxm iy4lp e ics s)a2tru o;u4apxomfciytls2ulu pnt0aeenirctadfp   u i;s0 rtoxo iy1aptelfcsa()sDum(  ;u1altnii3iytla eanvp;(4tltnir3oydomtelivs t) etm(r io1omtnlfcslsfs2umxr ;u0opeo icildfs el(vp u)tetrmr oadlpt livo;t) exr(m3io1apenmnctlsf 2trxr oo1olt mociatfsDul( p (4 exrir3oytfmteliesl(0t2xrxr3ny4lptnlivta() 2tm(m ou0openmo3iytls rlnvs u4aexrio3ia1fat  n s;s0 2tmio nodlpe mneiasfa2rm(  ;o4altoifetatfs el(vo t4teenio tatom r ivo s0teuoxopiudal   netltf Draxmont4opto ietytla rm(mo;(0alxnif3oytlp elivi;t trxrirpou4llt mfvta( aDrr(rpnt0tpx iietls m rmn pnt4aetrxr iatoat  nvs;( truoir3iydom  mivt t)s2raxmont0apeoiiciys m ulu o t)artoxo oodomDeaies;t)s2xrxr3oodoltemnct t)srrrx  ;u4olx  ieilslmDrmn s t0aetrircoydoatraieo;()s2tmimpou1opt mfvt t arumumoou4aex if3iysls2uanmsn()aexrmrcoadop rlivi ()seum(o3nudop n ict tf Drmumpno0tlxn ociyt s2uau s;u4 rerxf3iy1la  aivs;() rtmiopiydapee fvtat)a2trxm ot0olen f3iysfa rmnvo ()trtnircoytomtean o;s0s2xmimpoydomenmictl( sDtmumpot4alx io3tasfa uln pn() rxnio3oatla ean i;t0setr(o3oy4ole  nvtls) rururoou1ale ioetytfmDua(vp (0 rtoxo3iodfaD anvsl() rto(m ou1olt mnvsa()artmumo;t0ole ioetyt a rln p;t0 ltnmfciydfm  au i s)trxr(r3io1lptnlivi t s2umu  ;o0oeeo o3tytlaDea( s;(0trtnio todlat ai o (  euoio oy1amtnlfei s  Drau  nu1apxoiictasfa2uluvp t4 rerio3ia1late ueils0teum(o iy1alen iet s s2rr( p;u0texn ieildlmDel( o t0tlxomo oytop eaues t truoim oy1apee nciat srtaur ;t0aetoifciytls2rlnvonu0 rtnifciotlmtr u ils)truoim3nu1ameelnei t arrrxr ou4opto fetltfm rluvo;u4 etoio3iatla ranvs;s  2xoxo ou1ol   ivsa(  2taum ;o1texnmoeiys a elums t0 ltrifcoo1oat li i;(0truoio3oudomen nviatfs2urxr nt0apxoif3tlslm2um( p;u0tltoxo oatfa r uvi;(0s2xr(opno1ole mneslt  Dtrx pnt0tpeo oeiasls eauvont) leomfctytlatean slt  etrim iy4opeemfciatfaDtrx o;t4olt  fetysla rl( s;(4 eerir3tydlm rluvi;s  exoxm3oy4om elnetlt)sDumxmoot1tee ii3ils s2elnmonu)tltnxo3iydlpt lu i;t) rxmir3ny4lp nliet s  rtm( p;t4tpto fetydfa2rl(mo ()arermf totfm  aieo s)srxrir iydop n fcsltfarurum ;u1tle  f3ild s uan p t) exnio iotfmtrln s;t)sexmio3oydlpeelivsa(fa2trx p;o4olt mictysfs2rmums u0aeermociatfa elnes s) etrxrpio1amt mfct t  Dtru o;o0oltomictltfa2emnms (0 exrmrcoydla  lnesls) etr(rpio1op  licsa()sDua( p;u1aexn icias mDuauvp;t0 exnxo3tytlmDr nvs s0t2xmxr iy4am elfcil( artrxrp;u0teeoioctyslm rluvsn(4trxrxr3io1lmDraiesl(  rtmxm3iodlmeelfes tfa2umx  nu0aexnmf3iatla emuvp;t4artomr3tytop r ueols  eumimpnudlme  ivi t aDururp;t0apeoif3ilsfm raums u0aexoir3tytlptean i;t0 etoimpno1lp nlicsat srurxrpou1tlx  feiat sDemu s;(4 lxomo3iadomDran i;() rum(r3oydap nlnvsa()a2ra(ro;o4openmiciad m2eau o u4trermf3todlat  nvo;s)t2xriopio1lltemict sfsDurumpou4tptnmf3ilt mDemuvs;u)aeeoir iytlmDe uei t) rurxm io1optnlieils)arumxmpot4oex  fciad mDuan p;u) rtnxf3oadfatr uesls0sexrxrpio4ome  ict t)a2ua( poo0olx if3tytlaDelu snu)alerxr3iotomDelu o s)t2xr(o3ou1ameelfctat  rua( pnu1tptnmoeiatfsDel(mp;(0texrmf3iadlm elueo;s)srxoir3io1lpteliesat)aDtau oot4tptoii3ildfm rlumo;t4 leoxf oytfate n i;t t2tm(opoudam nmfviatfs2rax  ;o4oexnif3tltfs rmu on(4texnmr3ia1late nei;s)sruoimpno1apt mnvtls aDururoot4ole ioeilt m2rmnmp;t)teenmociydlmDr ivs t trur(r io1lpe  ivt s  2umxmp;u1aeenmieiltls2rl( p t4altnmr3oy1fmDr nvs;s0trtr(opiu4op e ici s srtmum ;u4teeoioetltls2ulnvp () exoxocty1lp eaivi;()tetrxopou4amtn net sfaDururpnt4opxn ieiatfa rluvp t)aeenmo io1opt au s (  euo(o iy1ol  livils a2tm( oou4aex  feiltlaDrm( o;(0trenio3oodomteanei;s0trtrim3ny4amenmneia( aDur(rpoo0alx  o3tltlm rl( onu)trxnxfcio1oa rlivs;s  rtmir3ny1al emiviat s2trum ot0aexomfeiys aDum(ms;u0tetnir oadfp  an s;s) rxoio nudop  lfeias a2uaurp;u0altnifciltls2rauvsnt) rtomf3ia1lp e ieo;s)trtmir3no1ap n fetasfs2ur(ro;t1opx iictls m2rl(mp t0 lxrio3to1oaDeanei;s)s2umxr3no4amee nvs s a2ur(mp;o0aet  i3tysfa2ul(vo;u)tlerxf oytlpDeaieo t  rtr(o3oo4olt  ictls  rum(  ;u1tleoif3iysfm2rlnmpnt0 etriociydfpDe ivs t0 rtoirpoy4ap e ivt tf Duaur ;t0aex  ictadfa2eluvsnu)tetrxf3oy1oa eanvs t0trxr(m iu1lptnlfciasfsDumu oot1tptomfctydla2ulu onu)arerifcto1om   nvils)trto(opiu1altn icil() 2ta(  no0aptnii3iyt a2rlums () reoxo3oadlp   ivils0setoxopiy4lmtelfvs () Drax  ;u4aleomfetldlmDeauvp;t0arenif tytfa r uvols0t2tm(m3oy1lltnmfvs sfaDrmu pno0olt ifciysfs rmnvs;u0tetoir oadoa rlivo (  rxrxm3ou1om nmfcs (fa2umxm nu4altnifeiltla2ua(ms ()tlxrif ia1laD  n s;t trtm(r oy4lmee ictlsfs2rmumo;u0aleoio3tltfa2rm(ms;()arermrcoytom e nvs;t)seur(m3oodlp   fesas) rrrx ono4apx iictlt m rlu snu0alerxfctydop eanvs () etrim nu4llenmfvsasfartaur ot0aptnmoetas a2rmuvont) rerio3iatlmDranvs;s s2xoxmpny4optnlieil(farta(ront0apx ii3iasfaDrluvonu0trtomf tytomteauvi;s0 eum(mpiu4ol emietlt  2tmumpnt4oeeoifcilt m2uluvo u)tlenxf iy1fpt aiei t  etm(o3iudale  fvils) rtmuront0tpt  fctydfmDran ont0 rxnio3oy1fatelnvi;()t2xoio iu4omt mfct ( arua( ont4tpenifeildfaDranms;t4treoircia1lpD aiei;s  exr(r iy1omenlietltfsDrr(mpnu1apt  oeiatla eau pnu0tlxomoctatfmtean 
\ No newline at end of file
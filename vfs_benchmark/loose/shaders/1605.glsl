@@ -0,0 +1 @@
+ivols  etoxm iodomen ncil( srrrx oot1aexnmf3iasla emn p () ltoxrcta1oa rlueo;( srtoxrpoudlmeemnvia( a2ta(m no0opeomi3ils a ulumo;t0arenmf3oadlm  au ols0 rtmirpny1ol n feil() Dtrx poo0tetniicias sDrl(ms;u)aetnmfcootoaDraivi;()srtr(o nudlm  lfvtl(fsDtmurpoo4aleomo3iydls2eauvp (4 rtoxf iatop e nvi;t srtmir3nu1am elfci sf 2ururo;t1oeeomicilsfs rm( p;(0artrmo3iotlmtrlnvs s0tetmir ny1apt mfeiat)s2raur ;o0opxnioeias a2rl( snt4 eeoioctydomt  u i;(0t2xmxo3io1lm n nctlt)srrr(  ot0tptomoeiydls rm( p;(0tetoif3tadfm e ieols teuoxr oo4om  livslt a2tru  ;o0oexomfeils a eanmp;t4tltomoctotfpDrlu slt0 ruo(mpiydoltn fvil(fs2rm(ront1optomo3iasfa2ulnvo;t)texnxrcoodfa  lnes;()s2umio iodal e ncia()sDumu pnu1aexo fetyt aDeluvo;u0tetrir iydfptrluvo ( t2xo(o ou4optnmneias)arur(rooo0opt mfctatfm ranmo u4trxoxr ty1om e i o t0srumio oodole lfvsls)a2tr(mp;t1tpt ifctydlsDemuvs u) rtnio ia1fatran s s  eum(opno1lptnmfvi s)srururpou0opx iociadfs um(mon(0trtnxf3ta1omDraieil(0t2xm(r3oydamen fci t artaur ;o1texn ocilslmDumnmo ()tetoxr3to1optrlnvsls seumio nudomee nci t srua(m ;o0aexoio3iat sDelnms;t0aleomr3iadfaDr n s t)trxr(m nodam emfvia( srrmxr ;o4optoifcilsfs2rlnmpnt4 rtrir io1faDranvi t)s2tr(m oudolt lfct ()aDurxmpot0texn ieiltfaDumu s u) ltoxo todfpD  n i t sexm(m oudoptnlivtls) 2tauro;o4tpxoiocilt a2ra( on() renmrciatoa r n o;t0trtrxo3iudop nlnvta() rur( pou4oex ifeilsla ua( o u)arxrircoydfatranvils) exoim iy4lm  mneilsf 2ra(rpnu1apx ifeild aDum( p t) renir totfpDrln slt tetrio3iudol  lfvtasf 2ur(r ;t0opxomoeiad a eaumo t)teeoir3tytfaD anei ()s2triopio1lleelfei t)artm(mp;u4teenmociyt sDemn o u)aexrif3oy1opDeaneilt0truo(r ou4altelnvslt)sDum(mpno0olxo ietls s2el( snu) etrmrcoydop r uvs;t0s2tr(o3nydalt  ivtls)a2tm(  ot4ale  feiadla2eanmp;(0tlxomr tatoa   i o s0trxo(mpiu4ame  nvt ( arurump;u4alt mocilslm2ul(vs;() exomr oodop r ivo;t0srxrxm no4opte icilsf rrm( p;t1tlt  fciat a2ra( s t0aexnir3oydlp  aueilt texmio ny1om  mfeia(f Dtaumoot1alxo f3ias a2um(mon(0 rxoxr3ia1fpDrln olt teum(opiy1oltemivi t  Duaxro;t1aeen fctls sDeanvo () lxnio3oodopDrlnei s0s2trxm oo1ameemnvslt)srumurp;o1texo fctadfm eaumo;t)tltrifcty1fa r i o (0 rtrxo3iu4opt  ivtas)aDtm(ro;u4oetoiieiasfa2elumo t)tleoir oodlpte i o;t0 rtoxo3nu1am   ivtltfsrtr( p;t0tpeoii3tadla emnvs u0 rxrxr3tytla r ivs;(0s2xr(m oo4amtemnei t  Drrxmo;u4opxnio3tas m2elumont)aeenxo iadlateln o;s)teumxo3iu4ll nlfctas sDua( o;t4oeeo f3ilt aDrlumo;u)tlerio3iodfpDrlu o;()setoxo3nu4lpenmnvs t)aDuru pou4oetoiiciys aDra( onu)arxoxf iodom rlu ols0s2trxo ny1om nlnei ()aDtrxro;o0aeto iciyt a2rm( snu0aetnmo todlaDe nvo (0srto(o3ny1ale  fciatf Dtauroou1tpx iiciad sDel(vonu) leomr iatla eln ol()s2um(o3oydom nmivils)s2raxronu0ape iieilt sDrl(ms;u)trxrmrcta1omD aues s)texo(m3oodlmenmnctls  2rm( poo0ole ioeiytfmDeln o;t) exoif oytomtelueo;(0trtr(m no1amenlietatf Drau pot4teeoifetydlm2ul(ms;t)tlerir oo1omDrau i;s)seto(m3oy1al nmivs t aDta(  ;t1aexnmocilsfsDea( pnu4teenxr3ta1lpD  nvolt0sexrimpoy1omtn ict t) Dum(ro;u4tet  fctytlmDum( p;(0 rxomfcoytfaDr u o (0trxrxr3iy1om e ivi sf rtaum ou1tltomociadlaDumumsnu4tltoxociy1faDraiei ()s2xr(r iudll emnvias)artaum oo1tlto iciytls rmu pnt) etnxr iydopte nvsls)trtmxo3iydlmen ictas srrmuro;o4aetoiieildlm2emnmp u) rxoioctydlaDelivslt  etm(rpio1am n fvi (fsrrmx ont4tpxnmfciatfm2rmn s t)teenxf3totla eanvi s) rxrxmpnydal  mfct t  Dumxro;o1oee ii3iad s2ranms (4aeerio tadla r i s;t)s2toirpio4omt  nvsat a2rr(  nt0tltoii3iatfm emump u)teerio tadopteaivo;s  2xo(m iy1am   ivil( a2raxroot4tle mf3tatfs2emn onu)tlxrmo iadom rliei;s  rtmxo3ny4amt micsat) rra( poo1tpe miciltfmDrmnvsn()trxrxf ootopDe n o t  etmxopou4apeelncs s srurx pnu1olen feiatfmDem(vpnu0 rerif todop r nvils trtoio iu4ol elncias)a2uaxrpoo4tlx  o3ildfs el(vo ()artnmf tydomD auvils s2xmiopnudlptnlicsltfaDua(mooo4tet ioctatls el(ms;(4 rxrxr3to1fmt  uvi;s) rxmxopiodlpe mfviatf rrrxr ;u1tpeo o3iatla ra(mp;(4tlxnmr todla r u o s texmim nu4alee iesa(  2ur( o;t4openioetytfs2em(ms t)alxoxocto1opD ln ilt0 2ur(opiydamtelicsas)s2um(  ;t1aet if3iatfs ran pnu)tetrmf io1fmDe n o;s trtrim3ou1ameelncsa( arta(  nu4oexn fciatfm2eanvs;u) exnxfctodoptrluvilt seur(m nudlmen fvta(f 2um( poo0apxomoetlt sDulums u) reoxo iy1lpt lnvolt0 2xoio3nu1oltelnvsltf Dumxmont0tex mfeilt m2eaump;t) rxrxo io1la elivo s)srxmirpiu4om nmnciatfaDra(moot0tetomiciaslsDeau s u0teerxfcto1oa  luvo;s0s2ur(r3ou1opee fvtltf Dtrx  ;o1apeo iciasls2rm(vsnt) rxrmf iadfmDranvs ( srxrim nodllenlivils) rumxrpot0aee  i3tad s2ra(ms;t0tltrio tatlm elnvs;( texrir3oo4lle lncs sfa2tm(m ou1ole moetydfs2rm(vpnt) rtnxfciadlmDrlivils)t2xo(opou1lm elfvsa( sDtm(r nt4apxniieiytlm2elnvs t)tlxoxocia1oatrau slt0srur(rpio1lpe liesas s2ta( ono0aleoiicils mDrlump;u0aetomo3tydfpteauvs;() 2xm(m iu4lltnlnvils)a2tr(rooo1tpeomfciadfsDran pnt0 lxnxr3oatfa r u i t0sexm(m oy4am n iesat) Dra(  oo1tpe iictytlmDeln s (4 exoxr3iotfpteaieslt0sexoim3nu1oleemnct ()srtr(monu0teen f3iadfm ran s;u)alerxo oytlatelivs;( t2tmxmpoy4ol   fvta(fa2tr(r ;o1alxo o3iltlm ua( p;u) exnxociytop r iei t  rxmxr nodlm  liet sfsrurur no1oexo oeils mDranvs;t)aexoxf3oy1fa eauei;t)srtriopnu4op emnciat  2tauro;t4aexnioeiytls2emu snt0 lxnio ty1lm r n ols t2xr(m3oudlptnlfvtl(  Dtr( o;t1oetnif3iys m2rln p;t4 exnxo3oo1faD  ues;s) exm(mpoy4lmeemivi s) rtm(rpnt4olxomi3tyslmDul( s t4 lenxr3tadoa r i o t0seto(r3no4al emnvt (fsrtrumpoo0olxo ociydls2el(vsnu4trxrmr iodom eaueo;t) 2tmxo3oy4am   fvtat  2rau p;u1oeenifeiytls2rm( p u) eeoir3iy1fp   ueilt0setrir no4lme  fcias srrm(mpoo1alxomo3ildfaDuau on(0 leoxocootlp e u s;t) 2ur(mpiodlpt lfes (fa2raxm no0opto fciadfmDul(vs;u)arxnxf3tytfaD aieilt)s2xmxm no4op   nctl( sDtrur ot1tltnifeiat s rm( p;u) etnif oadoaDr iei s0teumimpoo4om  lnvsas) rtaxmoot0apenio3ild a2em(mo;(4 rtrio3oy1lpte ivs;t0srurxo nydam  lncslt) Drmxm ;t0tleoiicildla uan o u0alerxociotlptrai ils0truoxo3oo4al nmics s  Dtax  nu0tltn ociasla2eaums u4tetrif3tadfa ean i (0 etoxr oo4aptelncs s s2ra(r no0tltn ieiys aDel(vo (0teeoio oatop   n i ( trxrio3nudolt lfci t)artaxrp;t4alxo i3iltfa rm(vs;t4teenifcoa1lm  aivo;() rtoirpiu4lp   iciat s2tm( oou4aeeniieiaslmDrlnvsnt)arxoir3oy1fm  lneo;(  rtoiopny4lmenmicslt sDumum ;u4olxoioctltfa elnmpnu4tleoif ty1lmD  ies;s0 2xr(o3iodlptnlncsl( a2taxrpnt1olxnioctld s uanvo t) rxnio3ia1fmDr n slt)t2to(opiu1ll  mictls) 2taumo;o0aeto f3iad m2rmums;()texoxfcoa1omtr n slt0sexr(r no1ameelicsasfsDrm(m ou0oeeo ietadfm eauvo;t0 eenxo3oy1lpt  uvil()setmxr3oo4ole mfvsl()srurum nu4olx mfciat aDrl( sn(0 eerir to1fpDeauesl( t2uo(opny1olt lnes (fsrrrxr ou0apenifcildlaDum(ms;()aexnir3iodfaDrlies s) etoxo oudlptemnvia(fs2ra(rono0alxnioctas a eau o;()altrio tydoptrauvol(  euriopiy4aleemfvilsfsDrm(  ;t4aetoiietls s em(mp;(4arenxfcio1lmtr nvs;(0seumxopiy1olen fvs s)s2uru o;t0oetn feildfa2ul(vont0aexrmr3ootoaDrlu i (  etmim3oy4open iet (fsrum(m ot1olxniietas mDuanvo;u4trenmr3io1oatelnes t) 2xmim3iu4lp nmnvi ( sDuaump;o4opeoif3iadlaDrmnvp;t) lxnir oatfpDr u s ( s2trxrpno1lmtnliesa(  Drrurpnu0ale  f3tld m ulnvon(0aetrifctotfmDr uvsl(0 rxo(o3iu1altelivsa( srtmxmp;o4oeeomi3tltla2ua(von(0artrmo3oytlmD aueslt)sexrxo io4ap emnvil()aDua(ront0tleo icilslaDrau o u4tetrmoctytfpDrauvil()trurxmpnu4amenmfeil()a2ua(mpot4opt  ocildlsDelnvp u0 rtnircoodfp  lnvs;t  rtrxr3oydlmtn fvs s)aDurxr ;o0oltn oeiyt s rlump u) etomf3oytfmtelu o (0trxo(r io1amt mfvi (fsrur(r nt1aee  ietyd aDem(vs;t0 reoif3iy1optrauei t)truo(m3oodllen fcia( arta( oot4alxo ieiytlmDra(mo u4 rermf3oydoptran ol()teto(r3io4ame  ivslt  rrrx pno4opx io3tld a2uanvsnt4 lxniocia1latr uvs;s)s2xr(m iydamenlfetas sDurx ooo0aleniiciadls2eanmo u0 lermociy1oa rau i;t  rxmxm3oo4opeemfctlt sDumxr no4openmfeiltlaDulump u)texnircio1fm rlueolt)setm(o oudap  lnvias) Duaxrpoo4aex iictydfm rmu s t0 renmo3oy1opD anei;(  ruo(opiy1lptemfvs (  Dtrx p;t0olt if3tysfmDrln ont4 eerio3oo1lm rlu i;t)setoim3no4lmenmfcils)s2rax onu4tltoio3iytfa emuvo (4 ltoxo oy1lmDr n sl( trxm(rpiy1lm e nvt tf rtmur ;o0tle ifetadla emu o;(4teeoxo3iydfaDe neo ()srxrxm3iu4lle mnviat) ruaxrp;u1tptn ictytls raums u4alenxf3ootoat lnvi (0truo(r3iu4lptnmict (f 2tauro;u1ole  fetld m um(mp t4texoxo3iytfa e nes;(  2xoio iy1lm nlietlt) 2trxm oo1opxo iciysfs rlnms;(0teeomr iodlp rauesls)seuoim oodomeelictls) rtrurpot4aetoif3iaslm emn p;u4 ltnxo ia1lat  n ol() 2uo(m io1lp  mfvsat srtm(m ;u1aee mfcild mDra(mo (0arerxoctytopD lnvi (  rxrxr io1ol  lncs () 2uaurpoo4tptniictad m emums;(4artoxfciadfat  ueo;t)sexoirpno1lmtemncsasfsDuaxmono0tpt if3iyt a2um(vs;t0 lerxo tadomtr iesls)s2uo(mpoo4ome lfvs s sDrau  no0ale  octytla ul(vo (0tleoio3totop e i o;s) rumxo oo1ll nmieia() Dtmx pnt0opxoiictatfs ranvsn()aexoxo3oa1faDeaneol(  2xo(r iu4amtnlncsat  rurxroou0alxomietad mDulnvsnt)aleoir3iydom rli sl()trxrxmpiu4opte fcsl()sDuax  ;o1altoiieild sDuluvs (0arxrmociy1laDe i o t0srxoxo iu4alt  ies t)a2rr(mo;o4olxo icildlsDrl(vsnu4aexomocty1fa eaieil(0 2xoirpoo4ape lict s  rurx poo4tptn fetatfmDua(ms;t4tlxrxo3oadfm rlivi;( sexmxmpou4apenlnvt t s2rmu p;t4tlen o3iatfm ea(mon() ltnifctadoat lies s)trto(mpny4lltn nei () 2tmxm nt4oleoio3iydlsDuln o;(4 ltoif ta1opD  neo;s)seumxm3ou1amt  icilt a2urxmpnt1apxn fciysla elu onu4alenxr3ia1omtrauvs;t  etoirpoodol   ivsa(fa2uaxro;t0olxn ietydls2rluvs u0 ltnmrciy1oa rlu il(  rurxm3ou4am   iviat aDua(ront1tee ifcilsla2raump;u0artnmf3tadom ranvs;s srurxmpiu1ll emnvtatfsDta(mo;t0tetnmoctlsfs2ua( pnt0tlermrctytlmD auvslt0s2to(mpou1op elneils) rraxrpnt0alxomieildfs2eluvs t0tlxnirctytfptrlnvo s)setm(opnu4omen iei t a2rm( poo0tpxnmoetlt a2rmn p;(0arxnmfciotlatr ies (0srxrir no1lpen nesl() rtax poo4tee  i3iltfa ea( p (4 eeomo3io1laD luvs;()s2toio3oy1om  lnviltfsrur(r nt4ope moeias a rluvo;u0aetoio3totlmtr ueo;()tetoio3io4openmivi ( srrr(ro;o0tlxnio3iasls2em(mp t) etomo oy1fatr u ilt)trxoxo io4lm nmnvtl()aDrmxmono1aleomfctldfmDumnmo;()arxrmr iatfa eaies;(0 exoxm no1lle miei s)a2tax  no1opeo iciasla2rmnvp t0treoxfciatlp e ies (0truoxr3ny4om elnetl()artmur ;o0tptnmf3iad m ulu o;t) etnmrciotlp eln ols0teuoir nudlpenmici s  rumxm ou4oeenifeiasfsDeanmp;(4trtrif3totop eaivs;s)s2umxopio1omt  fvsa(  Dra(rpot4tpxnioeiatfm2rmu snu4 ltoxrctotfatrli sls  2tmxm nodameelnesatfsrtr( oou4alenii3iydls2ra(mpn(4artrmfcoytlaDe ivils srxmiopny1aleelicilsfsDtmump;o0alxniictadla emn s;u4texniociydfmDrauvs t0t2xrxm3oo4lmte neta(f rur(  nu4texn i3tadfa2ulnmp;()artnmr oytopt an i s0 etoxmpoo1ap e ncs ()srtmu pnu0aexn fciytlm2eln sn() leoxr tytfpt li i;( s2uoxm oy4al  livt s sruauronu0oetomiciydfs ea(ms;(0artnxr todopD  n i;s)sruoxo iu1amenmies s  Drr(mpou0apeo feiysls ulu s () eenircoatfpDe n s;()srumxo3no4omee ict ()s2rmxr no4tee iociadlsDemuvo;t)aetrir3oodomtrluvols setm(opny4al emiet s  rrr( ono1aeen ieilt a2eanmp;t0tetnmfcoadlat anesls sexm(mpio4omt mieiatfarrrump;u0tle iieiyt mDrmu o (0aetomo3ia1latrlu ol(0t2xmxm3iy4aleemfesls  2rrurpnu0tptomoeiatfa2emumonu)arxnxr iotlatrln s;( srto(m3iu4ol e nci t s2rm(mono4tet  fctld a rl( onu) rxoxfcootfa rlnvol()s2toir oy4ap nmncilt sDtm( pnt0ope io3iyt sDrm( p;t0aeenifcoadlpDrli i;t)s2xmxr nu4lptn ivs tfsDua( pot0apxn ociyslsDrlnmpnt0 rxrmocta1fmt  ueils  etoxo no1ameemfei t  2ur(r ou1oltnmieilslm ua(vsnu0 renirciotlpt lnvslt  2to(mpoo4opte neilsfa2tmxrono0aeto ieiltfsDraumpnu) leomf oy1fatrlu s;t) 2xr(m3nodlpe lfvtatfa2tr(  ou1tpx ioetad s rluvo;u)alxrio3oo1omt anvo;s t2xmxo iu4olt lieta(  2ur(r ;u0tetomieiatfs2ra( p;u4trtnxf iotopDe ivs;s trtmxr3ou1aptemfcia( aDtm(  ot0oltomf3iys aDumnmp t)tltrxfcoodlaD aneo t teumxrpiudlptemictlsfaDurumo;u4tlx ioeias a2uauvp t4arermo oadom eln s;s0trur(mpiu1al nmiviltfsDuaxm oo4aptn feils a umnmon(0 exrmo3iadfate nvi s)seurxo io1lpteliei t)a2tmurp;t4opt  feiltlmDuan sn(0 rtoiocty1fate n s s0setm(mpnu4lpe lncsltfsDrrxroot1oltn oeilsfm ulumpnt0aeeomo iotop  lnvo () 2uoiopiy4om nlies (  Drmumo;o4tpenmf3iyd s2el( p u4teeoir oatlm e ueslt)s2um(o3oo4lmeemicsasf rraurp;t0tptoifeildlm rluvp (4aeerio ootfmDeai s;s)texo(r io1lmee icsls)sDum( oou0alxn o3iyslm rluvonu4aetrmo iodlmD lnvol(  2xriopiy4apenmfetat a2tmxr ot4tleo feilt aDemuvp u)tlerxo todfaDr ieolt trxoiopiu4ame mnetlsf rtrxr no4opeomictldfsDulums;(0trtomr totoaD  u s;t0 ruoxm3no1lltnmnvsl(fa2tmxm oo1opxn fciys mDum( p;(4aetoifciodlm elueils0srtmxmpoo4alee icsas srraumo;o1opxn oetltlmDrln o t4 rtnmfciytfp r iei;s0trxoio oo4aptnmfcslt) Durumpou4tee if3iytfs eau onu4tltnio3iodom   neo ( srtm(r3iy1ameemnci (  2tmxr ot4ale iietat aDeaums;u4aexrxr3ta1fa rln ols) exo(m3iu1ol e icsat)sDumurpnt1ape mf3tltls raums;u0teeomo3totom ranes () 2xoxo ny1lmenmfesat  2tmur ;u1ole mictytls ran onu4tltriocoo1lm elivsls0 2uo(o io4lme licsl(  rta(r oo1opt mo3ildlaDea(ms;(0tleoircio1optrlu olt seto(opnudlm  mnvs s srrmurpno0aeto o3iltlm2ea(von(0artrmo3iydoa eaivs s) rtr(m nodal nmnesls  rtrxmoot1ape  o3tadla ra( s;()aleoxociadom e i i ()trxrxo3no1lpen fci tf 2uaumpoo0ape ifeiatlaDumn ont0 ltrirctydlateaivol( texmir3no1olt  feiltf rrmxrpoo4tptomf3tytfm eau s t4arerxf to1optrau ils0setrxrpio1lpe mics sfartaur nu4oltnifeiadfa eluvo;t)trxnxo iy1om  ai i () 2xo(opoy1apt  fvilt  2taxmpnu1tlt mf3tadlsDum(vo u)tlxrio3oa1fp rlivs;()seumxmpnudlme livsls s2ua(ro;t4tpxnmfciytla2emnvo u4treniocty1lmtelivo s)s2trirpoudoptnlncia(  rra(mpnu0aex  oeiaslm2uaump;t)tlenio oytfmt ai i s0truoiopnydolt lieias  rtr(rp;o1oexn f3ildlm2rl( o t) lxnio todoaDe nesl(  rum(opiu1llt mncils  Drmu pou0tpeo i3ias sDelu p;t) rxniocoo1lpD aiei;t)teuriopio4aptn nci tf Dua( oot0aptnioeilsls2rmump (4artrif tydlateauvo s0srtmxr iy4lmtemicia()srtaxront0tetnmo3tydfa rmumpnt) lerxo io1fm eai s ( sexmxm oudlmen nctas s2tm( p;o0ole moetlt m2uanvs u)altrmociadoa rlnvi;t) 2umxo io1lpt lfetl()aDraxmooo1tlxoiociltlm emuvpn(0tleoxf oadomtr ivi;t)texmxr nu1lp nmictls)sDur(m ou1alx  f3tytlaDean p u0altrif oa1op eluvo;( teumimpoy1apenmnvt sfs2um( pou1alto oetldla ulu p;(4 lerifctatlpt  ies;s0texoirpnudome  feslt)s2uaxm nu4tlt ii3ilt s2ranmo t4 rtnxo3iadlm  aueo s s2uoxm3nydoptnmietat  Duau  nu4alxomi3ias aDul( p u4 rxrmo iodlpD aueo;s  2urxr3no4al   feias  Dta(  ot4tlxoii3iadfm raums (0teeoxfciodlp r iei;s sruoxmpoydamt  netat)srra(  no4tpto o3iat m2rm(vo (4 rtrxfctodfpt lieols) exm(o oodolt  fvs s arua( ont0olenmoetld m2um(vsnu0 rxnmrcty1op e ivo ()t2umxm3iy1omeelfvi (  Dur( poo0aeeo ietadlaDrmu o u4texrxr3tadfp  anvol(  etoxo nu1lp nlicta(fa2tmumoot0ale  oeiytlaDel(mo t0trenxr3iy1opt  neo t)trtmxo3oo4lltnmncia(f Duaxrpno0tpeo fcildlsDrluvs;(0alxoio3oytoa  anvol( sexr(m ou4op emfvslsfs2rrum ;t1aexo fctasla rl(vp (0texrirciydfateanvi;t s2uoxopoodape  fcslt)s2tru o;u1tetn i3tldla ulu s;(0 eerxr3tadoaDeaivo;t s2xr(r3io4lm emfcsat) 2uaurp;o4texnifciadfs elu ont0altnir oadomDeai sl( teur(m3nu4omtelics s aDra(mont0apxoio3ilt a2el(vp u) rermf iytlaD au slt) rtmxr3no1apt  ivsasfa2taum nu0oetoifctys sDeaump;(4 rxnif3iydomte ivs;t0trumxmpou4olen ivs t)a2uaxm oo0tex moeiltls2elu s ()tetnif3oa1oateau ol( trum(m3iu1alenlneils aDtaurooo4oeeomfciadls rmnmp;()trxoio iytoaDrlnesl(0 rxrxopny1llen ietat  Durxmooo1tltoioetyslm2umuvpnt0altoxf3oadlp  lnvs t tetrim nu1lpee iei ( srtr(rpoo1tlx  ieias aDrlnmsnu)tltnmf3oydoa r i o s)t2uo(r3iu1oltnmici t  rra(mo;t4tpto ieilslmDulu pn(0 eenif3iotfaD  ueols) 2xmiopou1lp  lneslt  rta(rpnu1aexnmfctytfm2uaumo t0 eermr3totlpDrlueo t)truo(mpiu4lm  lnvsat arrmxro;o4oeto fctld aDem(vs t)artnmo3to1optr u ils) rxoio3oodol e fesa()aDrm(r ;t4aptnifciysfaDeln o (4arenmo3todlp   ivo (0trumir iydllt lfvsl()arrrur ;t0openmictas m2umu pnt0arenxfciatoat  ies;s0trto(rpoudomtelnvsat aDtru p;o4opeoii3iyt aDrmnvs;t4aeenir3iotlm rluvs s  etm(rpoo1lpenlivi (  Drrxmpot1tlx mf3tytla ra(vsn() ltnmrcoo1omteaneo ()srxr(o3oy4alee ieia(  Dtax ont4olxn octas s2ulu p;(0 ltomrcoatlatr uvi;t0 ruo(rpny4ame lnct s srtm(m nt0oex io3iydla rmums;t)aexomo3tytopD lues;t0tetm(r3ou1altemivs sfarrr(rooo0tpxn o3tltlaDrmump t4tlxrir3tadlpD aueo;( s2trim3oudol   nct (  rtm(mono1alxo i3tlt m umu onu0tlenio3oytoptrluvi s t2tmxr no4lpeelivil(fs2tmu  no0open iciydfm rlump;u0 lerirctotlmtr n s t0s2xmxr oo4altnmicias) 2raxm nt1tlt ioetyslm um(vs t)aexoio3ootoa e uvo;t sexo(rpiy1ol   nct ( a2trurpnt1opt  f3iasfaDuluvo (0 rtrmr3iotlp eauvil() rurxm3oy4om  livs t  2umum ;t0ope mfciadfm eaumont4 rxoir to1fmD  i slt0seuo(r3iy1lpee ics t  2tmumo;u4alt iociasfs rl(vo t) rtnir3tadomt li s t s2umxo3io4olenmiviltf 2rr( o;t4tetomiciatla2uan snt0alxoir3iytfm eli ols0 etr(mpoy1apt  fes sfa2taxm no1aex  ociatls2ulumpn(0 rermo3oy1op rlieo;( t2tmiopiy1apt mnctls) Dtmu onu4aleomfctld mDeanms;u0tetoxociytlat lueils0srxrir oy1opt lfci sfsDrru pno4apxoif3ias m um(mo;(0 lxrmr3ta1omteln o;t0seurxmpoudape liet tfsrumurpou1tltnif3tatfs eau pn(0artoif totlp r ivs;s0 2toxr3io1ap  lfcia( arrrxro;t4oexo o3ilt a ea(msnt4arermo iytoat aneo (  2tmiopnu4omeelivsls s2rmum ;t1aexomociadfs um(vs u4tetnmrctydlpDelnes;t0texrxopio4aleelneslt)srrr(rpno1oeen fetyt m2elnvp u) ltriocoo1fpt  neil(  exrxopio1lmtemfcs (fs2um(rpnu1tptn f3iadfs rl(mo u)tltrxf3io1fp raieil()tetrir3ou4op nmfviatfa2ra( o;o4tpen octyd s2ulums;(0tltoxf oodfat aiei s srxmxm3nu4ape mncs t)sDtaxmo;t0aleoii3iysls ul(ms;t)trerifcto1fpDrlieslt0 2umim3nudlp e icta() Drrum no1tptnmictlt m eln s u) rtomf3io1lmD ai i s t2um(m3oo1lleelivilsfaDtr(m ;t0alxn f3iatfs2ea( p;u4texrxr3oytop e n o (  eurxm ny4al  mfvs tf 2raxroou0alen feiltlmDeauvpnt4texrif3oodfmD anvil(0 ruoimpnu4amenlnvtl(  2rmx oot0tetnioeiat a2umuvo;t0trenxocto1lpD  ivol()teum(r nu4amt  ivil() Drm(m no1aptomfetldlm2ulu p ()tltnxr3iotlate ieo s0 2trxo3nu4lptnlfctat  rra( ont4tptomociys mDulu on(4 rtnio oytlpt  uvslt0s2trxopiydap  mnciatfartm(  ou0tpenifciatfmDrlump;u0trtoircoadfatran s;s texr(rpiy1lpt lfvilt)aDraumooo4openif3tadfa umnvpnu) leoxrciytom rlnes t t2urxo3ny4lp emfvtl(f Dua( p;t1texo oetad s2rmuvo;()alxrmf iy1opt lieilt  rumxm3iu4amt mnvia(fa2tmu p;u0tetnmocilsla2ea( pn()aexomf ty1omtr uvsls  2xmxopnodom  lietlt sDrr( pot0oexn ictys m elums;(0 exoif iytfp   neils0t2xm(m3oudlme mneias) rtmxrooo0olxomi3tltlm rmu sn(4 ltoxr tadfmtrlues;t)tetoimpiodopenmnesl(f 2rrxro;o0tex  icildlmDeaums;t0aeeomf iadfa eanvils teuoirpoodlle lnes sfsDuaurooo0apeo fetlt s2emn pnt4alenxocoy1fpDeaues;t)tetm(r3iu1ame  fcsa(f 2rau o;t1oleomi3tlsla umuvp;u0texrmf iytfptrau i;s trxoxrpio1alenlnctls  2uaxro;t1oex  ociytfm2raums u) ltnxo3oytla r uvi;t0s2xr(r3no1ap  mncta(fa2tru poo0texomociatla2emuvp () rerxociadfm rlnesl(0s2to(mpnodlme  nctl( sDtrx o;u0tpt mi3iatla uanmsnt) ltnmr3oodfm  aueo (0texoxrpnu1olee nvtls) 2rauro;t1tpenii3tad sDrm( o;(4alxomr iodfp eaiei () rur(m iydom n ici tf 2rrx o;o4opt mocildlsDrmnvsn(4altrmr oydomDelueils0trtoimpiudam n ivslt)aDua(mo;o1teeomiciytlaDrln p u0 ltrxo iatlatr ieo t)s2xmir iydllt  ieil( a2rrxmoou0aee  o3ildls2umu p;u4trerxf3todoa   ueo t)srto(r ny4op  lfetat)artrxrp;o1opx  o3iadfa elnvo (0 rtoif oatfp r ies;t)srtr(m io1lp   iei (f Dum(r nt4opto o3tltla umnmpnt4 lermrcty1fp  aieo (0 exmiopny4ol nlnviat srra( o;o1olxnif3ilslmDumn s t)trtrmfcoo1lpD  i o s0t2uoxo3no4lle  nci tfsrumurpnu4opt moeiadfa rlnvo t4tltoio3ta1lmtr iesls s2umxrpiodlle lncia( aDur(rp;u4altn oeiasls ea(mo;()arxomr oydlmDelivol()t2urxr nu4omee fcia()s2ua(mp;u1tltn ieilslsDem(mp u4areoif iatomt  n s (0 rtoxr ny4ameemfet sfsrum( pno0aptnmieiysla2eanvsnu0 ltnxo3totlatelnvi;(  exoim iu1lle  neilt  Dtaxrpnt4olxoioctlsfm2ea(ms;() exnxrciodlatelueilt0 etoxmpoodomenmfctlsf rrr(r nu4olx ifctldlmDrl( o (4trtrifciy1fateauvolt trumim3oy1am emivsl()sDrm(mp;u0oet ifeils s2um(vpnu4 lxnir3oy1fmt  n i s  2xoxmpiy4opt mict ( aDrau p;o1ale  ociat aDrmu s u0trxoxf ia1fpD  nei s0srtmirpiodol n nes s) Dtr(mooo1opt mo3iatla2uanmon(0 ltoxf3oy1omt  n s;t0srxo(mpiu1omt  nciltfarua( p;t1aexomoeiyt a2ea( o ()tlenxfcootoat aneo;s)trxrio3oo1apt mnvtl(fs2raxronu4apenmieiasls rln s;t4 etnmo oo1omtr ieo ( setmim ny1om e feilt) rtaur nu0olt if3tldls umn o;u0trtnir3iodoat lnvo (0texrir3nudll emicia(fsDrru poo4aptnmoetatla2ra( o t4aetnxr3tytfp   nes;()trxrimpnu4opt lneilt sDtru ono1alt  oeiadfa2rmu p;u0tltrxrciydlate ivilt0trtrio oo4op e icsltf rraumpou4oltn ieilslm rl(mp;u4 ltoxoctotop r uvo t0srumxo3oy4llt lnci t s2rmx  ot1oexoifeiyt mDea( o t4aeenmrcio1fpDran o (0tetoxr iu1aptnmieiasfs2tm(m nt1oetnii3iysla2ea(mp t)tlenir ootfpt  ieolt0srtoxo3no1ap   nvi s)srrru  ;o4olen ictyt a ra( s u4alenirciy1lm elivsls0trumxm3nodamt lncil( aDtrumoou0ale io3iydfmDeluvo t0 ltrif to1oateln i;t)trtoio3iu4lm nmicta()aDrrum ou4alen o3tlsfm2rm(mo u0 eermrcoadlmt aivslt t2uoiopiydapt  feiat) ruau pno1ale io3iad mDrmumpnu)tetoir oytop e neo;t  eumimpio1opeelietls) rtm(  ;u0tltnifctlsfsDranmo () lerxf3iadlmDrli i ( srxmxo3iydlp elfesls)artm(rooo1tpeomieiys mDum( snu) exnxf tadlpt anvi s) rxoxr3iodlptnlfetl( arraurpoo4tlxnmi3iadla2ea(mon(4aetrmo3iytfa   n i;() 2uo(o3ou1lp emncia( s2urxm ou1oexn f3iltfm emu o () rtomrciatlptr i olt0teuo(o oo1lle mfetlt)s2rm(mo;o0aeeo oeiadlmDemums t)tlerif3oatlpD ai ol()srtrir oudoleemfvsasfsDraxrpoo4oex mietltfm2ra( on()tlxnif3iydoatelivols)s2tmir3ou4ope licslsfs2um(r nu4tlt ifcildls rauvpn(4treoxr3io1lpteai o s) rtmim no1olt miei t  2rrx  oo4olt  icilsfsDua(vs u4arxnxf3iydlaD auvol(  exrir3oudlp emfvta(faDrr(mont0tetomo3ilt sDeln snu4tleomrctodlp eauvo;s  2ur(o3oodoptnliet (f Dumxro;o0teeo ictasfmDemumpn()altoio3todlmt  ieo (0t2ur(rpoy4ape mnviatfartrur ;t4olt mi3ilt mDumnvp;t4 eeoxo oydfat luei t trto(o3iudamt livi s)srrrxr ;u4tex ifeiyt a rmu snu0aexnxo tydlmt ln slt) rxmxmpio4om  lfeta(fs2raur ;u1aleomfetld m2rluvonu) rxnmf3iy1fateaiei t trtr(r nu4ap  lfct s aDua(rp;t1tlx mictytfm2el(mont4trenxo3tytfmDr u il( trurxm3io1op  mictlt)srtmuro;u4oeto fctlt mDrluvo;() etoxr3tatop r n i;s t2tm(r3nu4amenlieta()arta(  ;u4aet moeildlmDumumonu4tetnio oydfp rai o;t)setm(r3iydopt  iei ()a2trum ;u4olxoiictydfm rauvs (4 etomo3iy1opDeliesl( t2xr(opnodllenmneil() Dum(r ou4tlxnmieiytlm2uln s;u0altnmrciotfpDrluvs ()trtrimpiy1lpe  fvia(f Dra(  oo4oex mi3iadfm rm(mo (4aetnio ootlat  n ol(0srurxrpiudap eliei ( a2urum no4ole  i3iadlm2uluvsn(4texrxoctotom rai o;()srxr(opou4lmtn iciat  Draumo;o4texoiociad aDean ont0aeerircootlateaieols0srtrxr3no1lmee icsl()sDtrx pnu0tlx mo3iysla rluvo;t4aexomo iytomtrlieo;(0tetoir iodlpt lnvsls  2ta(rono1aleoifeiyd m2umuvsn(4aleoiociodop eli slt)sexrxm3no1lp elncta(fsrrrump;t0ole ifctysla2uan s;(4arenif3oytfmD lu s (  2xoir3nodlme mnvsat)artm(m oo0teenmi3iytls2umums;t4artnif3iotfm  lneo;s srtoir3no1op  mfci (  2ur(r ;o0ole  ieiltfm2ranms () etnxf3to1lpte nei ( s2toxr3nu4ap e fctasfsDtaum ;t0tpx mo3tadfm ea(ms;t4alerifcoatlptrai o;(0trtmxr3ou4aleelfet tfs2um(mo;o4alxomoctydls2ea(ms;t)alxoir oodfpDe u i;s)trxm(rpoo1lptnlnvsltfaDra( pnu1aeenii3iysfaDuau sn(0tltriocoadop rli s;s  rur(o3iy1openlfetltfa2truronu1apxnmi3iasla uln pnu)tetoifcto1fm eauvilt)s2urxo iydaltelnesat) rur(mooo1olxoiociad mDul(ms;t4altnxfciadlaD luvo t)seuoxo no1alenliesl(farrrur oo1opxnmfciad s2umnvp u0tetnxociotlmteluvs s)teur(opiy4alenmfeils  Drmuroot1olxoioctldfa emu p;u4altrir tadfp elnvs ()setr(r ny1ll nlivsa()arraxmpno1tpe  oeiltfaDuln s u4altoircoa1fmDrlu ils) etmxrpny4amtn ncsls)aDumurp;t1tpx  ieiat a2em( o ()texoxo3oodlpD aneo (0setmimpiydolt  nvil( srrm(mo;t0apt mo3iadfs rl(mo u0altoir3todlm ean il()setoir iodapen ictlt)s2ur(  no4apxomo3iydfmDrmn o u4trtnifcoy1omtr u ols  rumio3oo4altnmncias)s2taum oo1tle mf3tlsls2uau p;t)arxrmf3tydlm   ivslt0texr(mpoy4am  liesls  rrrx ono4oeto fetyd a eauvon(4 etrmfctydfpD  n i;s)texmxm oo1lp   fesa( artr(ro;o4oexn i3taslm2rl( p t4aeenir3iatoatraueo;t t2xrim3oodllee ieia() ruau oot0ale  ieiydlm2ean on(0 ltrmr3oy1fmDr u s;t)srumir3nu4lm  mfcil(  2um(r nt1tpt ioctydlaDea(vs (0alxrxr3oydfmt  uvs (0 etm(r oy1apte ici t)srrm( ooo4tlenmo3tltlm2rl(vsn()altrirciytomtean o;t0 etrxr3oo4op elfcsa( aDra(ro;u0olxomo3ias s emnvo t0 rxriocoadlmte n s;t t2to(m3nydam e iviat  2tmumo;o4aexn i3iydlmDea(vo;t)artrifcoadfmDr i i s setrxopiydaleemncsas sDuaxmonu0ole  octasfm rm( pnt0tetniocoydop r n ol(  rtoxo io1llt mivs t srtaur nt1tlx  feiys a2rlu s (4teenxrciadfa rlieo;s seur(rpno1olee icils srum( onu0aeen oetldfm elumpn()texrio tydop eau s;(0t2toiopio1ol e fcilt a2rrur ;o1olxomociydfa2el(vs (4arermf tydfat lnei;t0t2uoxrpoydomt lfctltfsrtrxm nu4aetnmoeiasfsDuauvo t)treomfcta1faD lieols0 eumio oy4ome mici (faDtmxm nu0tptnmicildfm2eauvont0tlxnmo oatomtrln i (  rxmim3oudamte iviat  rrm(m ;u4oexnmo3tls mDeanvsn(0 lerxo3oatfaDe uei t s2urxopiy1om elfvslt)sDtrur nt0oet ifetaslm uln p;()teeoif oydoaD  u slt0 2umxr3oo1al  lnes t)aDtmxr oo1tlxomieiyd a uau p u)trxomo oydlaD ai il(0tetrxr oydlmt mivilt a2umum nt4tle  oeiad m2elump;u)arxnir3todlmDe i il(0 2trio3oy1apte fcia()a2umu pnu1tpxomiciltls2rmumon(0arxomf3oa1latelnvo;s)trumxm iy4ole mfvtl()srrmxro;o1ape mieiyslmDrlnvp;t)aexomocoo1omD aiei s)tetoir nu1llen fciatfa2umxmo;o0olxnii3iadfs2eln snu4teerxo tadlmte ueo (  exrxopiudll   ivsltfa2urumooo4apen ietyslaDul(msnu0 rtrif oodfmD an ils) 2um(o ou4op  liet ( s2ta(rpno1tpxoifeils a2ranmpn(0aetnxfcio1lpt li il( srtrxo oy1lpenlnes ( a2uaumoot4alt  iciad m2rm(vsnu)tltrxo tadlatelues s trtoimpoo4lme lfetlsf rumumpnu0aexnmoeildfsDelu p t)trtrxo3oa1omDeauvo s0srurxopnudlp emnvsat)aDumxmo;o4apxniictatlm2rm(vpnt4 lxrmr todfmDraivil(0 etr(m3oudole  feiatf Drmx o;o0tle  o3tys s2emnvs () rxrxrcoy1oaD  u i;t0srtrim ny4ame  netlt  Dtrurooo0opxnio3iltfmDumn pnu4artrmo3oytlm rlivolt t2xr(mpiudlmeelfvsl()s2uau  ou4oltnmf3iys s em(mpnu4 etomocoatop elnvolt)trtmxr ou1oleemici s  Duau  ot0aeeo oeiat mDrln s;t) etnxo3tytlp  livi s)teto(m iudomt mivtat a2um( ono1oet mf3tltfs2ra(vo;t4 exomf to1oaDrlivs ()s2toiopoo1op elfvsltf Dtax p;t1aet  ieiat aDuaump t)aexrir iydoat livols tetmxrpoydlp e ncsat) Drmur ou1teenmo3tytfa2rm(mpnt0aeeomf ta1omD au olt  2xrxopnu1optn ivilt)arrru o;o4tpx io3ilslm2umumpnu)aexoxf oytopte uvi t)sexrxrpoo1alteliei ()sDrrum no0opeomf3ilt sDum( on(4tlxoxr3io1fpDeauvs t) eum(m3oo1alt  ncsa( arrmxm ;o4aexnif3iys s eau p t) lenmo3tatla  lnei t0 2trio3io4lmenmiet s)arumum no1olenmfetadlm elnmpnu0alenif ia1fp r u i;t) rurxo iu4aptnlfvt ()s2ur(r ;u1ale mf3iyt s eanvp;(0 ltnmf3oy1fm  lu sl(0t2trio3nu4ale licilt)srraxmpoo1oeto fcildfm2rmu o u4artrxr3oo1fa   ivilt) 2xo(o3iu4openmicta(  Drmxronu4oee  i3ildlmDul( o ()trtrirciotlatrli il(0trtmimpou4om e neslt  2uaump;t0altn f3tlt a eluvp;(4alxriocoodom  an ol( s2ur(rpiudomenmfct t)artaxmonu0olt  ictldfm2umuvont4artrxf3iydomtrauvslt0 2tm(rpiydomtnlncs (fa2urum ;o4olto ieias sDem( onu)artrxf3oydopDeaneslt0sexmio3ny1opee netl(fsDrm(rp;o4aetnmocilsfa el( o;(4artoxfciotomDrlivsls0 2uo(r3nu4opte nvi t)a2urxm oo1opx  icias m2em(mo t4 rtoxf3to1oa r n il(0truriopoo1lptnmfvsl(fsDtr(rpno4opt ifeiadfs2em( snu)teermrciytfp ran i;s0s2uoxo iu1llee neiatfaDuax p;t4ale mieiadls ranms;t)aexrxo oy1op rau s;s tetmxr ny1lm  mnvsls)srtaxmpnt1oleoiicias m rl(vo t4tlxomr3ootopt  n s;t)t2ur(m iu1am  livi ()s2uaxronu1olt ii3ias a ul(ms u) rermo io1fm rlivs;t)t2uoio nodaltemnvta(fartm( pno1tet io3tldfaDuauvon(4 lxoxo3ia1opDr nvslt0 exrirpoydal nmieiat) rurumont1alto o3ildls ra( p u4tlermoctodlmDeluesl() rxoim ou4ol elnvs ( aDtr(rpnt1tlxn ietltfmDuluvs (0 exnmr3iytop r nes () 2um(mpoodap  lictat sDrrxr ;u4ole if3iytfm ua(vsn(0 lerxocoatopD auvo;( trum(r io4lmtn ivtls)srtm( oot0oetnmoeiydlaDrm( s u0aetnxo3iodlpte iesl()seuo(r no4ol e fcsa( s2tauroou4tle  fetaslm eau snu0texnmr3oytopDranvo;(0 2uoimpoudlm e ieiasfsrtmx p;o4tlxomfctydfs2uau s t0trenxrctytfa elnvil( texo(mpio1opeelnvtasf 2raxmpno4ole  ocilsfm2emumo;u0 rtnmo iadfaDrln o;t s2xrxr3ny1ll elfeilt)sDtmxm ;o4teen fcildlsDemu o (4tltrmf3oo1fmDrln il( srtmir3nudome mneilt)srrax o;o1opxn fetatfm2ra(ms;u4tleoxo3iy1oate ues ()s2umxopiudlptn fei s)sDumurpnu4aee moctltlm2raumpnu)aetnxf ia1op e n ilt)sruoxr no4am emicslt)s2ur(mpot4olxn o3tltls ua(mp;t4teerifcoytlpDrai slt trxo(mpnu4aptelietls)aDta(mooo0apenif3iydfs2el(mon(0arxnmo3ty1lmDrlu o;s) exm(r3ny1oleemieiat  rurxroou0tpx  fctad a2elnvo (4 rtnxfcoatla ean s;s0teurio nu4lpenlfesl( a2rrumpno4aexomoeiasla2ul( s;t4 etrxo3todlate n ilt srxo(o3io1lmt liesl( a2trxm ou1texnmicild s eaump;t0tetnmr3oytfa   ieo;s seumirpiu4omeemnei (  2ra( ooo0altomfcils m2eauvp;t4 etnif ootfpD  i sl(  rum(opoy1alt mnei s)srumu pnu4apxnmi3tasla ulnvpnu0teenxfctotoaDe neslt)s2um(o oudalt lnet ()a2urumo;t1aptnmf3tys m ua(von()aeeomocoatop e nvs t0 rtmxr no1op emicia()a2urx o;o4oltnif3iadfmDraumonu) lenxfcio1fpD  ivi;s)sruoxo iy1al emnes t arur(ro;t0tlxomoetyslsDumnmp;t) lxoioctytfa  lnvo s s2xoim3nodapte nci (f Drau  ;t1tee  feiyt m um(ms (4 exomr io1lm   u i ( sexmxrpiydoptelnvslsfsrtmumpou1openio3ild aDel(vs;t) reomr3ootomt  uvi () rtm(opnydlpt  fvsat)aruauro;t0optn ociad m emn p u)texnxo3to1oate ivi;s0srxmxopno1lmt  nes t s2tr(m ;t1teenmfciaslm eln o;u)aetrifctotoa rai o;(  2xmimpiy4lme  nvslt) Drmx  nu1tle  fciytfs2elumo;u)artrir3oydfp r i i ()srxmxr no1optnlnvta()s2urum nt0tetnmf3tadfm2ranms (0 lenir totfptr neils) exrxo iodoptnmfvtas srum(root4oexnifcilsla eauvo;t0 renio3oo1fatrlueils trtoim oy1am   neil()aDurxrpot1olx ifetls a uan p;u4 eeoifciadlatrlnvilt0truoxm oydlm nlfetls) 2rrx pou4oetn fciys sDrmnvp;(4tltnir iadla   n slt texmxr iudllt  nvtlt a2tmx o;o4open iciadfs2rmn s () etnxr3iydfaDrli slt)sexmxrpoo4lp elfeiat)sDtr(mo;t0apt mf3ils s2ra( p;u)aetoxr ta1lptrln s (0 2um(o3iy1ll nmnvilt aDtm(roou4ape iietadfs ran s u) renxocto1oa e nvolt0 2toxopoy4am emncsat  2urxmp;o4tetn octldfs2rauvo;t0altrxf to1fm rai i;t0 rxrxmpiu1olt mfvsl( s2ta(r ot4tex  ociatls ua(ms t4trtrio oatopDr u ils tetm(r ny4ome miciat) 2um(m oo1opt mi3tat a2eln s;t)trxomf3tatomDr uvsl()s2xoir oo1lptn nctltf 2tmurpou4ale mietadlm eauvs;()alxoifcio1faD  ies;s  rum(m3iydoltn ivt t arta(mpou4tltn f3iadfs rmumont4aeermoctodoaDe ieo;t0s2um(r3ny1op nmivslt)aDrax  ;o0opxnif3tlslaDul(vo;()aetrmo3oatlmtean i s seumxr ou4aleelnetlt a2tm(r nu1alx  fciys s emu s u4 lxnmfctodlmDean slt  2xm(r3oo4omen fvtl( srumurp;t4aeeomietytlm eaumo;() rxoif ootfp  luesl(0srxmim3oo1omeeliesatfarumx poo0altn ieias m rl(msnu4aetrio ta1fate i ilt)texrim3iudoptn ietl(fsDrmumont4alt  i3ild mDemnmpnu0 etomf iy1fmteai sl( setr(rpiu1apen nvias) rtaxmp;u0tlx mi3tls m2elums;t) rermocoatfptrai s;t0 2tr(opio1lp  lfvtasfsrrrxronu0tpxnmfeiys mDeauvs u4tltoxf oa1opDrlivo;t)t2um(o3ou1omteliei t  2ta(  ot4texoio3iadls raums;t4 exnxf oy1op e ieol(0 rum(m3oy4al  lfvt sfarta(mo;u1oeenioctltlmDuanvpn(0trtnmf3iadfaDe n i s s2trxo iudomtn fei tfsrtaur ;t0aetnif3tlslm uanmpnt4 rxoxr3oodlaDeanvo;(0 rxriopny4ol nliciat) Dumxmp;u1aeenii3iydfmDul(ms;u) rtrxo iydfaDraivols0 2xm(o oydal n ici s  2rr(rpoo0tlt  octydlaDem(mp;u0areomocta1fpt lueo;( tetoxo3oo1am   ivs s aDuau pou0tlt  fetatfa emu snu4trermf iytlm r nvi ()t2ur(o oy4llenmfct s)srum( pou0oltnmf3tas a2uluvont4aexrxo ootfaD  neil(  rtmir oydlptelfesat  rurur nt0tlt iieiltlsDul(vs;(4 eeoir3todfmD luvilt)setrxopnu4opte fvsl(  rtr(rpot4alx mfciadfa el(mo;() eenif3tydopDraivs;(  exmiopny4ol n fesl( sDraumont1tpxomociadfmDemu o;u)tlenifctytoatrlnvilt0seur(r oo4amtelnvil(f 2uaurpno0olt  iciasfmDem(monu0 ltoxr oy1lm   i sl()sexrxrpiu1op nlfetas) 2ta(monu1tlxoiieilslm ea(vp;u0 rerir oydfa r uei;s sexmim iy1lmee nvtl(  rtrxroot4tle  f3tldla rl(vs u)aeeomrcta1fm  aneo ( s2trxmpiudome mivta() 2rmur no1ale ioeiasfm2ulu o;u0texnxocootlat  uvi (0teumxo iudlp elfes s)artaxrp;t4tleoiiciydlmDua(vont0treoxr ia1opteliei;s  exrxm nudom nlfvi sfs2rrx  ou0aeenmictyd s rmnvp;() leomo3oy1oaDrai ils  etr(r nodlp nmiesls  rumxrooo1tlto ociydfa ea( s t)tlxrio todomD lu s;t  2tmirpnydll  lieil(f Duau  oo1aeenmietltfsDelu o;t) rtrxf iydfp ranvils)srtmxopnydol emieiltfarta( o;t0opxn fciad s2uln s;()tlxrxocia1fpDr nvo t)t2to(opiy4om e ieias) ruaxmoot4tleoiocilt m ul(ms () etnxr3ty1laDe ieo ( srxr(r3nydope mfesl() Dumx pnt4tetniictytfa emnmon(0alerirciodoaD luvi;t0 rtoirpnudomtelfctas)a2umxrpoo4teto ociys s2rl( o;(0treomrctatfaD  ieo;t) rurir iy1apeemfctl()srtax  no1optniiciaslmDuauvp (0 etoio3ta1lat  u i (  2umio no1llt mnvsa(  Drmu  ot4opt iiciltfaDul(msn(4texnmr3ia1fp elu i s)srxoir iy1llt licsl(  2ta(  ou1tpxomi3iasfs ul( s;()tetnmr ty1fat aivil()s2ur(o ny1am  mfvi ( s2ua(r ot1aeenmietlslmDeln o t4areoir3iadlptr nvo ()t2to(mpio4altelictls) 2umu oou1ole  oeiltfsDrlums;(0trenxociy1la   ueolt  rtm(rpny4al   fvtas) rur(m nu1ape mieiadfs rlums;t4 rtrxo tytfpD  uei s  etm(o nu4alenmfvsa() Dumxmo;t1ape iieilslsDuau p;t0 ltoif oy1lmte ivols0sexmxo io1ol e nesasfaDra(rpoo0ope miciys a rau s;t0aexrxrciy1lptr u o (0 exo(o iu4am e iesa()srtaxrp;t1aex  feiadls umuvsnu0 exnmf ta1oaDrlnei t)t2trim iodaltnmfesatfa2raxmp;u0altomieilslaDrmnmo;() eermr3ta1lmD auesls0s2toirpio1omeemies (fsDrru pou0aleo o3iad sDuan o;() eenmfciy1fp  aneo t)t2xoir3iudoltnmfvia() Drmur ou4tet ioeilsfm2emnvs u)arxrmo3ootom rluei;t0s2tm(opiydoltn nvsatf 2raxrpot0aptn i3iyd s2rl( s;u)trerio ty1lp r u o s s2uoirpiy4llen fcia(faDum(rpou1aexomfeiysla2uaumpn()teeoxfciodlateaneo;t0 eto(r3oodamt  nvtltfs2ta(  ;u4apxniieilsfm eln onu4aetrxo3oa1omDeaieil(0s2uoxo oy1oltelfvs sfartaumo;t1oex iicildfs eaums t) reomr3iydopt lies ()t2xoxopio1lmt micia(  2raur ou1oexomociasfaDran o;u4 ltomoctadlaDelnvi s0trxo(rpoo4olt mnvtlsfsrtrxr ou1tpe mfeild aDrlnvp;(0 lxnir3todlaDe n o;t sruriopiodlm  lics s srtrxmpno4tpxoii3tltlmDem( pn(0 exnir ia1lp eli ilt0 rtmir iudame  feils)s2ur(mpot4tpxnif3tld sDuln onu)artnxf3iytfmtrlu sls srtr(m ou4am  miesls  Dumu ooo4alxomociasls2ranvs;() lxoircoytlp   n sl( tetrimpio4lpeemiesa()aDraxroot0tpto fctldlm ul(ms;t) lxrxoc
\ No newline at end of file
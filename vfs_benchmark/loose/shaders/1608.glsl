@@ -0,0 +1 @@
+u ils0teumim oodolt  ncilt  rurxr ;o1teenio3ilsfs um(mo u4trerxo oa1lp r n o;(  eto(r3oodol n ics s sDurumoou0ale mfctydls2rluvp ()trermr3oatopDr nvo;t  rto(m iodop elncsa() rta( pno1oexn feiyd a elnms;u4tlenxrcoatoa   uvi t t2xoxopou4olt lnetlt  rurumo;o4tpxoifeiyslaDul(mp t) lenxr iy1omDe nei;( s2um(o oydlmee ieta( a2trumono1apt mociys mDrmnvo;t4 lxoxo iy1fpte uei;t trtrim oydam  lfei (f Dtmumpno1texn ictyd a ua( s t4 lermo iodopDran i;s) 2uoim3oydamtn fesas sDtmx  ;t0tpen oeiaslaDemn p;u4treoircoodopDrlnvi;( sexmxo3oodaptn iei tfaDtau onu4opxo feildfm ean pnu0 lxoxr3totomt  u ols setmxm nudom nlfesat) rrmu pou0oexomoetltfsDeanmo;()altrif io1oa rlnvi ()tetrxr3iy4alt lnesl(  Durxrono1tleniictyt s eau o t)altrmo to1omDrauesl()t2xrxo no1lp emfesl()a2urx ont0aptomfeiysfs eau o (0 exnifcta1oatran il(  etmiopiu1lltelictl(  rrmxmo;t0tlxomictas a2umn snt0tlerir iatfatrlneol(0 rtoxmpoy1opeemnvs (  2rmur ;t4apxo oetlt a ua(msnu4tltomf3iadop r ivsl() 2xr(o io4lpenlnctl(fartru  oo0aetn o3tys s ul(mo (0texnmrciotfmtrluvs;s  2tmir3ou1ale  iet ( s2rrx o;o0olxoioeiyt s2ua(vpn(4tlermf tydoaDrlivo t0trtm(m iydol emnci s) 2taxrp;u1tlxnioctytlmDemnvs;u)trxrio3tadfptelu i s0s2umiopoo1lmtemfct t  Dtaxm ;u4tpe  o3tltfs2uan o ()tlermr iy1lp raneo s t2xrxo3oo1ope miesls)s2urx ooo1tptnioctls m2emumont4 rxnmocoatoaDr n o t0sruo(o iy4omtn fvi (fa2urx onu0tet mictydfs rmuvp (0 ltrmrcio1lmteau sls0trxrxm ny4alte nes t)a2tr(mpnt0aptnmoeiyslm uaumo;t0 rtoio oa1la raivsls sruriopnu1ome mnes t)aDuaum ;o4ole  f3iysfmDrmumonu)tlxnxr oatfm   i s;(0 2urxr3iodlpt mivtas  Drm(rooo0aex  ictyslm2rmnvsnt4alerxf3oodoa  lies ( trtrxo oydam emivtlt sDtrur ;o0texo f3iadls ea( o u4aeenmfcoo1fpDrlies ( t2tmxo oodlpenlfvsa(f rtrxm no0aetnifcildfm rlums t4aexrxr3oo1op rauvils  etrio3nodamt mivsat aDua(m oo1tlto ieild s2rl(mp;t4 eerir to1fmt aieils0seurxopno4ap   ieta()arrmx o;t1aleoioeiad m2rm(vo t) rermfcty1fmDeauvsl(  2uriopiy1omtemfet (f rrm( pnu4aexniociytfaDrln s;(4tlxoxo oa1fpDeaivo t)trxrxo oy1amtnmies tfsrumurp;o4opt ii3tlslsDran s;t0tlxnif3oy1op  ln s s) rtm(o3oo1ap   fes sfs2rruroou1altnmo3iytfmDrlu snu0 ltnmo3iytlptrli i () eumir ou1omte fctat)srrrxm no4tlxnmieiys a2rmn s;t0texoif oodlpDrauei;s sruoxm3oodapee nvs tfa2trxmpnt1olxoiociys aDrluvp u4teeoxocootlpDrau sls) rxo(mpoy4al  lneiltfarrr(mpoo4ole moeiys a2ea( p u)arxrio3oy1op rlivo;s0s2uoiopno1alt  ncs sfartaumo;u4tltoioctydfsDea(mp;(4 etnio oa1fpDeln i s)t2xo(m oo4lptnlics s  rrru  nu1tpenioctyt a rm( o;(0arxnif iotfptr uvo ( texr(m no4ol emicil() Dtrxmooo4ale miciytlm2emu pnt)artoio ty1fmtelnvsls)srxo(r3iudopee ietls) Drmuroot1aetnmfetad m2rluvp;u)arxnxr iydop e n s;s)srum(m3iy1lp   feils srtrum ;u4oeeoii3ilt a ulu ont4texnmfciy1la  luvols)teur(o nydapt lnctltfa2tmuroot0tex ifciysfa2eln pnt4tlxrmrctotoateaies;() 2um(r nodlmte fcta( sDraumpno4tpto ociasfsDel( s;t) leoxrctytoaDeanvolt)trtrxo nodam e neils)arraum ;o4alxn f3tlslsDeln s;t4aexrxo3oodfm r nvo (0 exr(r3iu4aptelnetls  Dur( o;t4texo i3iatfaDea( pn()trxomo iadop r i i t srtmim3oydoltemfesl( a2uaum nt4apeo o3iyt sDrl(ms;u4 reomr3oa1oaD aieilt  rxoxrpnu4omt mict s  Dtaumpno4tpt moetaslm2emnmon() rxrxr iytlm e ivil( setmxo3nodopt  nesa() rum(moou4opt mictltfm raumpnu0aetoirciotoa rlivs t)s2xmxr iudaltn ici tfa2ur(  ;u1aptnmfeiltfm uanvo (4trtoif iadfa r ues;(0t2xrirpou1lle mfvias)s2raur ;u0tpt mictad m2elu s u0texoir iodoa elivi t0teur(r ou1am n ict tfartru onu1tptoioetldlsDuau p;u4trxoxf ty1omDrau i s)setrim oo1am  lies sf 2taxroot4alenmfetadfs uan o;u4tetnxfctydom elivs s) rtr(m3oodlp nmictlt s2um(r nt4alx  fciadfa2rmnvsn(4tetoxrciatfmt ai ols0trto(r3nu1ol eliciatf Drrur nu4alxn o3tltlm rlump u0 rxoiociatlaDrlnei;s0s2tmxopny1ole  fesltfa2tmu pou0olx mf3tytfa ranvont)trtnircoydomte u i;(0 2tmio io1omtemfcsasfartr(m nt4oeeo ietyd sDrlnvs;(4 lxnmf oy1omDe ivi;t0s2xo(o3iydal elfcs t srtmxm oo4tpt ifeiysla emn snt0texoio3ty1omtelivi;(0t2uoxopiodop nmnct s)s2um( pou0olxo f3ilsfs2el( p t0 eerifcoydfmDrlu i s0t2xo(rpoudlp n iesatfsDurxronu0opxnio3iltfsDul( s;u)texoir iytfat luei;()truoxo ou1omtnmietl()srtm(m no0aex  iciyd sDem(mon(4tlxnmocoytlaDeai ols)trtmxr3oodap   ici t)a2trxro;t0teenmi3iat aDeanms;t4trtnir3totlaDrln il(  rurxrpoo1lme miet sfsruaxrono1tle  o3ias m raums;u) rtrmr tydfatraneo s)texm(rpiu4omt mivs tfsruru ono0tleo iciatla2rluvpn() etomr oadopD aueils srxmxopnodlle  ict t)arrmxmpou0olt  ictltfaDemuvp;(4tlerxr to1lmDe n o ( t2xmir3nodlpe lfetls) rtmxrpou0aex mf3tltlmDeanms (0arxnxo oadlmte u o;s s2uoxopnydomtnmnesl()a2uaxm ;t0aex mociytla2ua(mon(4 eenmfcty1oateau ils0t2xrim iu1llen nei sfa2rmxm oo0apxnif3iadlm2emuvsn(4aexrmo3iydfatrlnvslt t2uoxo iu1lme livs sfa2rmumo;u1olxnmiciltla emnvs;(4 exrir3tadfmt  u i;t seurxo nydlltemies ()s2trurpou0oex  oeiys m2ua( s () rerxf iodoa eauvo s  ruoirpou4op nmfvi t)arurum ou4olx io3iltfmDea(vpnt4alxnirciadfateauvs t)t2tmir iydll  livsl()aDua(m ;t4tltomietat a uaump;u4arxoxoctotoaD  ivi;()seum(m3oo1ole lict (  Dum(rooo1tetn iciltlaDelnvpnt0tleoirciadlptrlueo t) exmir3oudomt liet (  Dum(rp;o1oeenio3iatls2eluvs;u)aeeomf oy1optrlu il(  rxmxr3oo1ame  fct t  Dum(mo;u1opeo ieias sDeanmp (4 renir oo1laD  uvols sruo(rpnodop nmnviatfartmxmo;u1apeoif3iyslm ua( ont4 etoxocio1fpD  n i (0 2urxr3io4lm eliesat) 2ua(mont0oltoifetls m2ranvs;(4 eeoxo to1opt lieo;(0srtrxo3iu4llt mfes (  rta(ront1ole mf3ilsls rm(vpnt4arxoir tatlatelu i s) 2umirpiodoptelfvsls) rrr(mpot1tle  fctasfaDean snt0trxniocoadopDr n o;s t2xoxrpny1ap  lfei (f rurx p;t4oee ifciysls umnms;()tetoircta1fatrlivols0 rum(rpnu1lm e icsa( srrax  ou0tet iocilt m el(mpnt4altrmr3totlaDeau s;( teur(m3nydlmee nvtltfaDrrurono0texo f3iasfa2ulnvsn(0trenmr totla r ues;s trumio3iudaptemnctls) rrmur nt1aeto ociyslm uln s;t4teerxo totlaDeanvs;t)t2xo(rpoo4ale liet t)artaxr ;o0alt mfcildlm2rmuvp;(0tetrxf iadfmDelnvo s)srtrir3oo4omtemfvtas sDraur ;u0oex mo3iydlm2ranvonu0 rxrio3oydfp e uvo t0 eum(m3no1apenlnesa(fsDtr( ooo1teeoioetysla eauvp t4 etrif iadlm  luvi;s)t2triopou4omeemneslt)sDra(rp;t1tlxnii3iltla2rl( ont4arerxr tadlp eaueo (0t2xmxm3oy4llen nct (fs2rrumonu0aleoii3tltfm ulump;u0 ltnircootlmDr nvs ()setr(r iodlme  nvta( sruaxrpoo4tlxnmictytls ranms t0trxoir oytlat ln slt0 rurxm iy4lltnmfvi t)a2rmxr no1apeniieilsfs ea(vs t0tlxoxocoytlpt li o;s) rurxm nydal elivsas)sDum(mpnt1oeeo ictat s um(vp;t4trxnmocoatlpte uvsl(0setmirpnudapenmnci ()sDraum nu4aex moeildlaDem(vs t0trtomf oytom   u i;() exrxmpou1lp nlfet s a2ra( o;t1tee if3iasfsDraump u)aexoif iatfpteanes s  2uoim3ou1ap   net s aruru poo4tlt  iciltla rm(ms;t)aexnxrctydfaD  nes t0srtoio nydlle mnvi s)a2taxmono0oexnif3iysfs rauvont4tetrmo iytoatrau o;(0 2toxmpou4ameelfcs t)aDraxr no1tet mfeiysla2eau p u0arxnmf3oy1la eliesls0t2uo(r iu1lltn ivs (fsDumump;u4alxoifciytlmDel( pnt0aeenmr iatfatrai i;( sexoxo iudlp emfeias  rraxmp;t0apxn ieiaslmDranmon(4texomo3oo1op  aneilt  2toxopiu4amenlfei ()aDraxr nu1oltoioeiat m2ra(ms u)tleomf3oa1fatr ueol()trxrir3iy1ome mfciltfsDrmxrp;o4olt ifciytlm emumpn(0 ltoxocoydfaDeln o;( srxmim no1omtnmfvsl()srur(r ot1tptomiciys a rau o;t0aexnircoodopD  ueo s)seumir3oo1lp   iesls)s2tax  ;u0oetomi3iatlsDeanvo t4tlxomf oy1lp r n slt0setmir3iydomt mnvtlt aDur(mo;u4tlxn icilslaDrmnvo;t4altoio3to1omtran olt) etr(mpnydalenmfct (  Drmxrpoo4apxnmoctadla2eanvs;t0teenifcia1lmt  iei;s0 2xr(opoo1op emnei t aDur(m nt1apen o3iys a2rluvo;(0trtnxfctytla rluvols  2xmio3oy4alen nctat)sDrmxr ou1apxomfciytlmDrm(vpn() lxrxo3io1fpt aivs t) 2umiopou4lpt miet s) 2raxmo;u0aeeniociad sDrlu p u0 eenxf3iytlpD lnvi;(0t2tm(m3iu4lle lfeiltfa2uaumpnt0opt mf3tysls2ulumo (0 lermocoa1omte i sls0setm(m3iudopen ncias) 2uaumoot4olxo o3iadfs2rln o;u)texomrctytlaD luvo;s  rumir3oo4ame lfetl( arrmxrp;u1ale  ietyd a rm(ms;t4 eeomrcoa1fp eaivi;t)sexoio iu4ll   nvi s)sDrmu p;o0tex  f3tld a emu o t4alermocoo1fmD  n i s) rtmir3oy1lpee iesls) 2ua(r ot4tltomocils aDelumo u)arerio totop  aivo s) rurir3iydomtemnvtlsfsrtax ono1openifeiad m2ua(vsn()artnif3oatop  anvo t  rurxo iy1op  mnvta() Dum(moot4aexomoetlsfs rln o u)alxrmocty1op elivo s0trum(r nudlp   feil( srra( pnu4aet mieiydla2umu o;(4 ltoifciy1fm rluvsls trtr(opiudlpeelnvs (  2uru  nu4tptn ictadfaDeauvont0treomo iadfpD li s;s  2uo(m3no1opt  ivtlt)srumx  ;u1ope mi3iltfmDranms (0aeerir ootfpt lu i t0srxrir3no1omtnlics tfa2tmxrp;u0altomfctasfsDrluvp;t0teenxf3oo1fp elivs;s sexo(rpoo1ope  fcias)sDurx onu1ope iieiatlm2rmn snt4tltnirctydfp rlivs (0s2xr(mpio1al elfeias)arrrx  ;u4apxnmocildla2uauvp;()tltnifcoy1opt  ieol(0s2uoimpou4op n fct ()aDtrxm ou0opxomoetldfs ul(vs;t4tetrir3iotlm elu o s  rxoim oydamt lfei sfsDuaumont1tpen f3tysls2rmn s u4alxnif3todfatr ivi s)s2xoxopoo4lmeemivi ()a2uax pno1openmoeiyd a2el( p t4tltoifciodfm  aivi;(  2xrir ou4olte ietatf ruru p;o1tlenio3ildlm eaums;t) etnxo to1omtean s (  2umir ou1ap n fcil() rtrurpot4apx  i3ils s emu s t4 lxrxf iodlp eluvil( srxrio3oudomenlici (fartr(r ou4tleo i3ildls2emnmp u4aeenxf iydla r ueol(0 2xm(r3iu1om nlivi s srurumpou4tptomoeiydfm2eanmpnt)trenif iy1laDr ues ()teumxm nu1optn ivslt)arumu o;t4tpx ioctydla2emuvpnu4trtnxfctotfp elueol()trtm(mpoydlpt  iesa(f rumur ;o0opx iociysla ulnvs;t0aeenir todopt  ues t)s2xo(m3iydlmee ics ( arrr( o;o0oeeoifetydfa uanvo u4 lxoxr3oo1opDeluvi t0 2toir ny1oltn fvi ()srrm(ro;o4oeeo ociydla2rmnvp (0 exnmoctatoaD lnvi t)srtm(r oy4ol  mivsas)s2tax  ou0oeeoiociytfa2uluvp u0alxrxrciy1omDranvols) etmim iudop nliesasf 2ururo;o4oeeoii3ils s2eanmonu0 lenxfcoy1oateauvo;(0 rtmim oudope  neta(fsDtax  ;o1oeeomf3iysfs rluvs;t0artoiocty1lptr ivols s2urxo iydame  feia(f Dra(  ;t0teeomictatfaDumuvs t0alerxfctydoaDean ils truriopoy1lmt mncia(f 2uax  nt0aetoii3tad m2um( on(0 etnir iatfaD  i sl() rxmim3oydol elieta( arrr(r ou4apt micilslm2uluvsn(4 etnmo3iadoaDeluvil() exmxo oudol   nciat)srumu onu4openiiciyd aDua( pn(0teermr oo1fm eaues;s  2urio3no4amte ivil( aDra( p;u0texo o3tyt m2umnvs;(0tltnmo3tytlm rluvs;s)srum(opoy4ol n neiat srtmx o;u1aptomf3tydfs rm(vpnt0 etoxocoatlaDean o ()t2tm(r iu1ame lnei s  rtaxro;t4oleoii3tad aDua(vo u) rxoio totla e ivi ()t2umxopno4lptemfet ()sDtru  oo1ole ioeils sDumuvsnt)aexrxfciodfmD  nes;(  rum(r3nu1ale  netls srtr(mpno0tpeo i3taslmDulnvs u4tlxomocio1lmtranvi;(  exoio3iy4amteliciatfsrraur ;t4opxnmi3ildls2elu s;() exnxo oydfaDr ieo s0srurxm3ou4lpe micsl(  2rmx  ot4optomi3iatlmDemump t0aeenxf3ta1fpteluei (  2trxo nodoltelfesa(f ruaumpoo1apx mfeiyd sDrlu p;(4alxnmfcoodoaDeluvo;( texoirpiy4om e neilt)s2tm(  ou0alen ocils s2elums u0aexomrcoadfpDeaueo;( sexr(m oo4apt lfctlt) rrm( o;u4olt  fciyt m ulu pn(4arxoxo3oo1lmtraivs t) eum(r3oy1lme  fvtlt)a2um(m nt1aee mi3tytlsDem(mp (4altnxf ty1oaD anvolt) exoxrpiu4lpt  nvt () Dtm(mpou1aexn i3tldlaDeanmonu)aeeoio3oydlpt lu o s  rxmxr3iy1apenlfcsl( s2ra( o;u1texoifeildfm uauvsn(4tltomoctytlm eau i (0teumxopno4llen ivtlt  rrrur no4aex miciltlm2emuvs;(0arermo iodlpDrli i;s  etmio ou4llt  ics tfsDtmurpot4tpx  i3iadfs em( o ()areoxrctatlateaueils s2tm(r nudlm  mici ( a2umump;u1oltomoctysfs um(vs u)artnmr tadopteli o;s) 2xmxr oodamtnmncsas a2rmur ou4openif3iydls emnvsn(0tltnxr3oadomD luvi s0texrxm ou1omen ivta()sDumxrpou4ape  ietatlm2umu o t0 eeomfciy1fpDrln i;(0seto(o oo1lpte ics tfartrxm ;t1ole ifciytlmDuau o t0trxnxrcio1lpDe nvols0s2xm(o3no1ap   fvslt)arta(ro;o1oleoif3ias s2ulnmp;t0arxrmfctotoaDe i o s) etrir nydol e fcs s aDtaum ot0oexoifcild a2elnmp;u0artoxrciydomDranvils)t2uo(o3nu4al n feil() rtru p;t0tlto iciat s2ranmo;t4aeeoio3iytfm e u ils0 etr(o io1lm n nes ()sDur(mooo1olenmicilt aDul( snu0trtomrcty1optrluvs ()trxrirpnydape mfesls)a2tm(rpno0oetniociadfs2rmnmpnu0 etnxrctodlm elnvo s)t2toxr oy4omtemfesls  Drm(rooo0apx mi3tls mDeauvsn()alxnxo oo1omtrlivi t sexrimpiydlp nlivt t) Dtm(mpno0opx ifcilt m rlu pn(0aetrxo3oadlpDrlu o (0s2xrio ou1omtnlfei s sruaurp;o0oetnmfeiasfmDulu s t0trerxr3totlpDe n s;s srxr(r3iydop n fciasfarrmumoot4openmoetysfa2umn snt4arxrmo iadfmDrlivo;(0s2xr(r3iydomtnliesatfs2rmxmoou0oee mfctlsfa ea( p;u) eenmr oy1fmteaneil()setmxrpoudlmt mfvsas  rrmx ono4aetomoctls m2ua(vsn()areoxrciydla e uei;( s2umxrpio1lptn nvtasf Durxrooo4aexnmictlt s eauvo t4 leniociodomt aues;t) 2tr(rpny4al n ivtls a2tm(ro;t1tex  oeiyt s2ul(ms;t4alxnmo3oy1lmt luei s srtm(o3iydam elfvtatfaDuax  ;o4oexo fciad a ulu o t) rxrmrciadlptrai olt srxo(o3no4lmtn ics t  2taxmp;o4apxn f3iydfa emnmo (0alxnmrcoadopt livi;t setrxmpio1ap  lnvias)s2taumpot4oee iociat m em(vo (4 leoxfcoa1fm eluei;s)srtoxopnu1llt livtls)sDurx pnu1tleoif3tasfsDul(vp;(4altrmr oydlmD lnvslt  rxmirpnu1ol emnci t)srrmx o;t1alx iietasfs2elu s;t4 eenir3ia1lmteln s t srtm(mpnudom n ncslt sDurx oou4oexnmi3iyd aDuaumo;t4aexrif3tydop  anes s)sruoio3nu4omtnmnvsl()s2ta(rpoo4opeoiietydlsDra(vsnt4tetoir3oydlm r ueo;(0 rxrio oy4omtelivsas) 2taxr no0aexomf3iasfmDean p;u0aexoxrcoodlpDeai ols  2xrir nu1am  mieslsfa2um( p;t4oet miciyd sDrluvsnt)alenxr oa1fmDraivols)s2tr(m nydom n nvslsf 2raum nu1tpeoioetat m emnmsn(4altoircoy1fmtean i;s0teumiopnydameelfvilt aDuaumonu4tpt mo3ilsls2emumo;u4altrxr3oatfpD  i slt)t2toxopny4lmenmfvtls s2rm( poo0texoio3ilslmDum(ms;t4 lxrio3iadfaDr uvi;() eumir3nu4llt mfet t  rtmxrooo4tptn ictldls ranmo;t4 exnxoctotomD li s ()trur(mpiu4lltnlivt tfaDtrur nu4alx ioctatfm2rlnvp u4texoxrciotla elnei;t s2xm(r3nydlmtelivt (fa2tr(rooo4tpen ocildlm2rm( pn(4areoxr totlatr u o;(0srumxm iodam   nvt tf rrm( oot1aptomieiysls rm( o t)arenxo oadlaDe nvs;() ruoir3ny4amen ietlsfa2rrum nu1tpxomociytfs2uauvpnu)teermfciodfp e neo;t0 rumim iy4ole  fesa( sDurx oou0teto f3tadlaDumn p u0aetnxf oytfmte nvs;t  2trxo3nydop nlnes s)arra(r ;o0oeenifcilsfaDulu o ()arxoxo3iodomtelieo;() etr(r iydope  nvia(fa2ururont1tlxnii3iydlaDrm(mp;t) renif3tydoptelieo;() 2xoim iu1ll nlnvt s  Dtaurpou0ope if3tyt s2rau p;(0 renxoctotop e ueo;s trxmxopnu1om n ivilt  Dumump;o0aetoio3iys sDraumo t0 exrir tydoa  ln i;( sruo(o3iy4lmtnmfes t  2taump;u0texomieiadls ul(vonu4trxnifctadfmD li o (0teuo(r3oudapt  ncsls)a2uaump;u0olt  f3iadlsDuau onu4tltrxo iytfa eau i ( sexm(o oy4lp nliet tfarrr(rpno4tet  ociyd s2rl( o u0artrmo3iatopD aneols0s2xrxo nu4ol nmfvtat srtmumont0opto fetys s2eauvpn(4arerxfctytfat ln o () rxoxo3iydlm nmfvias  Dtrxro;o1tle ifetyslm2rlnvo;t0trxomf tydlp r u ils0s2xoim3ny4amt lfei t aDuru ont1apt iictldls2ulnvs u0trerxr3tytoa elnvol() ruoxopoydolteliesl(farrmxr ou1texoif3tltla eanvp;t4arerif3ty1laDrln i;t0teumxm ny4alt miesas)aDrmxmono4apxn ieiytfsDua(mp;(4 rxrmrcoytlat  iei s0texmxopio1open iviat) 2rmx  no4oexomi3ild aDrau s u0trerioctytlmt ln i;s) rurxm3oydalte nvt ()sDuaurp;t4aexoifciyt a2rmu on() rxoxo ty1fpDr ueolt)teuoim3no1openlivia( srtmu p;u0ole mf3iad m2ul(vp u0 lenxfcoodlm   uvo s)t2tmxrpoy4apeemiesat)aDua(r nt4tpt ioeiydlm2ul( on(0tlxnmr oodopteaivs (0s2trxm ny4amtemieta(  rtaxrpno4tpeo fciasfmDeanvpnu)teenxr3iotfptrai sl(0sexoxmpoo1olenlfesl()sDtr(mp;o4tpx iociatlmDrl(vo ()tlxnmo todoa e u sls) ruo(o io1alenlnvtl( s2raxmoou4aex  oeiys aDumumo;t4 eeriocoo1lmtean o;t0tetr(o3nodaptemnes t  rtax poo1ale  ieiatfs2ulumo (4treomoctatfatr n i s0t2xmxopny4llte fetl()s2uau ont4aee  i3iysfaDeln s (0aexoif3todfaDrlu i;t0seuoio no1al  lnvsls  2uaxrp;o4aptomocilsfm umn pn(4aeerio ta1opt livi;(0teum(o iy1llt miviat aruaumpou4aptomfciytla2rluvpn(4tltoxfcto1lpD  ivsls0srumxr nydlp   fvtls)s2rrurpot1apx  ictatfm2ea(vs u0trxnirctotom r u s s0sexmxm io4optelfciasfsDtm(mpnt0opt mo3ildfmDemn snu)trenir3todlmDrluvi (0srtm(m3ou1alenmiesas  Dua(monu4alto octltfsDrmuvs (4tetnmr3oadfaD lieo t) rumio3ny4omee fetas s2rrurp;t1ale mo3iltfm rmnvpnu4aetrxrcoatoatelies s)t2trxm3nu4llenlneiltfs2ra(monu0alx mietadfs2eluvpnt0aeerif iadom r i o t0teuoirpiy4olenmfctl(farra( o;t0aptnmietys a rlumo;(4 eeoxr oy1fatrai sls) rxr(r ny4lpe  feilsfsDta(rp;u0tex  i3tys s emn sn()tltnmrciotomtraivs (0 rtoirpiu4olee fcia(fsDtrum oo4tlenmo3tldfm rmnms (4teermf3oytomt lueil()trtr(m3ny4alen nes ( aDrrx ono1optnmo3iyd sDem(vs;()trenxo iytlmDe ivslt  ruoxr nu4lle  iei tf 2rrur oo4apeoif3iasla umnvs t4 lxnio iydfp rlnei t  2uo(r3ny4olee nei t srtrurp;o0oexnmf3iasfaDrl(mp u)arxrif oytoaDr uvi t0 etm(rpiy4oltnlncs s)arrmxr ;o0oeeo octasfa umnvpn(0trxomr oo1lpD  neils)s2trim ou4apenlics s  2raump;t0tleniocilslmDrl(ms u0tltnmocoydomt  nvil() 2xrimpiydlmt mnvslt aDurxr ot0oetomoetat m umuvon(0tetnmo3iydla e u s ()s2xrirpiudomte ncs tf Dta(  ;o0oleo fctld a rl(vp t)texnmfcoo1fp  anvsl(0setoimpiu4ll n ivils a2ta(ro;t0tpeoifeiad a uln o;u4 rxoir3oadlpt  ieo s0 etoim3no4op nlfvil(fs2raurooo1olen octysfa2raumont0tlenio3totfpDe uvi t0 rxmir iy1amt mnet t) rtmxront4optoif3tydfsDel( p;t4 lerio iatlm   i ol(0setoio3iu4ame lies t)s2rmur ;u4tlx io3iatfs ulnvs t4trxoioctydlptranvi;t)tetmxo3ou4altnlfvsl()sDrr(r nu0oltn feiltlsDem( o;() etnirciy1la rln o ()srxoim nu4ole  nvtatfa2uaxm no4opxo oetlsls rmn p u4arxrioctadfaDr u ol() rxrim3iu4op e icsas  rtmuroou1tpe miciltfs2eauvp u0 rxomfctytla eauvilt0srum(mpiu1omtnmfcta(f Dtax ooo0tlen oeiasfs2ea(vo;u)arenmo io1fpD auvolt0setm(mpiudolt mnei s s2rmxmono0opeomfciat a2rauvp t0tlxnxf oadomDrlu ils tetoio3nu1apee fetls srtmurpot1aetomoetltlaDulu s;(4tltrxf3tadoa rliei;s0 etm(mpny4openmietat)s2ra(rpot4aleomociytlmDua(vont0 etoxr iy1opD  iesls) 2umir iy1op nlnvsls srua(m nt1tlto o3tldfa2em(vs () rxrir3ia1fm rlivo;(0 2urxo no4lle mnvtas) rrrx  no4tetoif3tldlm2rmums (4tltrir3to1oa eluvs;() rxmxrpnudapee fesasfaDuru  nt0ale ii3ildfaDuanmo;t0tetrio tatfaDe uei () etm(m3iydlpeelnviat sDtmump;o4tetomo3iatls2rlu onu)aeeoir ty1omD aies;t0trum(mpnu4omtnlfes (fartaxmo;o1tlen octls a2ulnvp t4alermo3iy1fpD aieil()texo(m3nudom  mnvi s aDrmx onu0aeeomfcilsfmDrmums t0tleriociy1fmtrlu i;t t2triopoo4lmee fetlt sDumx oou4ole ii3ilsfs2ra(mp t)aleoxf3to1faD  iesl( tetr(r iy1lp  lietat)sDururpou4alt iieiydfmDrl(ms t4alxoxrciydomte ivo t s2xoirpou1om emivtat)a2rmur no1aetomo3iltfs2rmuvpn() reniociytoat aueo (0 eum(r oo4oleemici (  Drm( poo4tetnmf3iaslm2ranvonu4teenifcootoateauvo s0sruoimpnu1lmen fci ()aDurur ;u1tlt  fciatlaDuluvonu)tltrifctodfaDelnesl()t2to(mpny1am  mfvta( aDtr(  ot0tptnmf3iadla2ul( o t0alxnxo tydlat  u o;s)setm(o io1lpt micsas) 2taxrpou0aexoifciat m ran p;(0aexnmoctadoa   i ilt)seuoxo3nudaltemivslt)aDtru  nt1oexo o3iat m ean s;u)arxnir3tadop r iesls seum(m3ou4optnmivsa(f 2tax  oo1aee ifeiatlm2uan pn() leomf3tytfm e u ilt) 2tr(mpiudlpt  fvtl(fartaxroou1tex  feiyd m2ean ont0texomf iytoatrau s s t2xrxopio1al  mietls s2ua(rpnt4apxomf3ildlm2ra( p ()tleoir to1opteli olt srxr(opiu1ope  neilt) Dtrx oot4tptomfeiadfs2umumonu0trxrmf iotoptraues () 2tmio3nu4ome  nvta()aDta(m nt4ole moetyslm ul(mo;t0tlxrmrcoytfm  aivi;s) eumio3nu1op  lnct (  rrmx oot4open i3tytla2eanvs;u4 renxo iatomDran o t)texmim iu1op  miet tfsrua( p;u0tpt moeiyt s ra( on(4artomo totlm r ivs s0 2umxr nu4omenlfeil(fsrraum ;t0tpen i3ils a umu pn(4artnir3iatfmtr i i;s trtoxo oudll  lici sf 2ra(rpot1aeenmfctyd aDemnvo u0tleomoctodomDeluvo;t0teto(o3nu1omtnmfviat  2urxr ;t1tlx mf3iadlsDran s t0 ltoioctotlpD lu o t)s2uoir nudam elicias sDraxmp;u0alxniocias a2rmn pnu4alxoiociadopDrlnvols0s2xmxr io1lmt  fet ( srumumo;o4optnmo3tasfs emnvs;u0 rxnxo3iydfmte u s t0trtrim3iu4ll elncs sfaDuauroou4opt iiciad sDum(von(0 exomfctydlpD  ivi s s2trim3iy1opte neias sDum(r nt1oexo o3iatfs2rl(ms (0 ltnio oy1lmte ues s t2toir3no1lp  mfvi s)s2raxmoot0aee ifcilsfaDraumpnu0arxomfcoatop r i s (  rxrir oudll nmivsa(  Drrx pnu4tle ioctld s2em(ms t)aexrif ta1lpD  neo;t0srtrim3nodlmee fctatfs2ta(rp;u4olx  oeiad s2rm( s t)teeoxrcia1laD  u s;s trtr(o iudlm nmictls sDrrur ;o4opeo fciysfm2ul( p t)teenmf tadfptrau i;s)trtmxr ou1olteliesls)s2tru ont4tleomi3tadfs rl(mp;t4 reomf3oodlaD  ieolt)s2uo(o3iydamt mfeil() rtau  ot0aeenif3tld mDumu s;(0aetoio3oatfmDeanes;t0tetm(o iy4lm elnci s)sDtaxr nu0tle iieildla2ulnvpnu4 eeoxf3tytlmDelneols0 2tm(opnu1apenmictls) rra(  nt0tptn i3iat sDua(vo ()tltoxo3totfpteluvi ()sexrxrpno1lltnlnctls)a2ur(moou4optoifciydla umu on()trenircoatlmDrlieilt0tetoiopiodlm emfei () Dtaumpnu1aee  f3ilt a uln p;t0aexoxoctatlm ranesl()s2to(o nu4aptnlncsls sDra(rooo0oexo fcias mDemu p;t4 etoxf3oadfpD au slt texmio nodop   fvsasf rtr(moot0apxnmf3iatfsDum(msnt0tlxnxf3oo1lmt anesls  euoxmpiy4am elncia()sDrrumoot4oeeoiieiyt s uanvpnu4tltnxo ootoa  lnes s) 2uo(o oodolt mivsasfaDta(mont4olenioctadlm ulnvs;u0 eeomfcoatoptrluvi;s0s2xrirpnodllteliviat aDrrxmpou0opxo fciyt sDua( p;t0 etrifcoydoate nvsls)trxm(rpio1op n fvta( a2tax p;t0olxn ictltfsDeluvpnt4tlxrmociadoatelnes s  etmiopiydopen fviat)srrm(rpot0tleo ociad s rluvsnt) ltrxo3totom r nvo s t2umxr iu4ame  ictls)sDrrur ot4ope mf3iltla2em( pnt)tltnmoctydopDr ieol(0trtrxm no1ol  mivtasfs2rmxr ;o4tlxn oetytfm2rauvo u0 etnirctadlmD luei;( seurimpiydam emiet t  Dumx p;t0apx miciadfaDea(vo t0 eeomr iydla  aivils) eto(o no1amt  fciltfaDra(m oo4apt  fciat mDuauvo;t0aetnif tadlm rluvs;t sexm(o no1lm elicsasfaDtr(m ou0oltnmi3iadfa eaump;() etnxoctadopDrluei;s)t2tmxm3io1ole lfeiatf rrr(rpou1tlenif3tytfm rluvp;()arxnxr3iy1la eau sl(0 2uo(m3oo4omtnlicilt)s2tr(r ou1ope mfetadfm2uau s (4tleoxfctytlptraueilt0truo(rpny1op n feil( s2ta(mo;u4tex iieias aDem(ms ()aetoif3iydom eauvo;s0seuoimpnydamtnlfcsa( srrauronu1oexo fetltlsDum(vo t)trtnmo iy1oaDe i i s trxoxrpiu1ape mics s)a2umumo;u0altn ocilsfsDrlu o;(4teerxocoydlm elu o s0srurim nu4ap emnvtl( aDtrur ot4tpenmietytfmDulu onu) reomr3io1fa eai i s0 rur(mpiu1lle livilt  rumx ooo1teenio3iys s2ra(ms t0arxrmf tadoaD  nvi t0trxoxmpno1alt  neta(  rumxroou1aeeniiciltlm uln s;(0aexnmfcoytoaD  i o s0trxoxm no4ol nlneia( s2rm( poo4openio3ild mDrln o (0 etoxr oadoatr ivsl(0seum(opno4lm emfetas sDrm(r nu4tltomf3tlslmDumn ont0 eeomo3iydomDraueil(0t2tmxo3io1ol nmictas sDumurpoo0aptnio3ildfs2umnms u)treomf3iotoa r nvil()sexr(o3iy1lmen ncsl()arumx  ot4apt ifetatfm eluvsn() exriocio1fp rln i;s srtrxmpiydlptn nvtat a2rruro;u0oeeniociysfs2umnmpn(0 rxomo oodfm elivo () 2tmirpou4openmivtl( a2rrxro;u4aptnifeiytla2el(vp;t4arxomrctatopD  n ilt  euoir ny1lptnlfviatfa2rr(rpou4tetnifeiltfs rmnvpnu4treomr3tydfa e ueil() rto(m oodlpenlnci s)aDtruroou1opt mictat m rluvp t0tetnxr iatfpD  i sl()texrxo3oy4ome lfcs s aruaxmp;u4ope  feiyd a2em( s;(0tltoxf oa1faDelu o t truoxo ny1lpt mneia()aDuaxmont1alxomieilsfaDrlnvp (0 eeoio oadla  lnei;s  rurxr3io1lltnlncta( a2trxro;o1tpe  fciyt sDua(mon()arxrxocoa1lp  aneo t s2xrimpiy4omt lnetatfsruaxr nu0opt  oeiatfa elnvp (4arenmr3oy1fpD  n o;t trumxmpny4lpte ivs ()a2trur nu4opt ifeiad aDrluvp;(0arermrciatom  aies ()s2umxo3iu4olen fvt ()s2uax  ;u1alxomfcildla2ulnmp (0artnmr tadomDraivi (0s2trimpiu1opee nvtlt) 2umxmpnu1texoiietydlaDea( o;(4artnxr iatomDr i o t0t2xo(opoo4lle mfvi s) 2rrxmono1tpeoiociasls rmuvo u) exoxo oo1oaD ai o (0s2xoir3iydop nlfvilsfaDumx ont0optomfeils m2ra( o;u) exnxf tytla  aneo s sruoio iu1optemnct (faDra(moot1oet  o3iydfa ua(ms;u4altoxociydopDelivo;s0 2uo(o oo1ope lnvia(faruaxmpou4olen o3iad s2umuvo;u)tetrmr ia1omte neol(0 eurio oo1omt livsltfa2urx oot1tex  icilsfaDrau o;t)alxrmr3to1latrlu ol() exo(o3nydoleemnctatfsDrrx pno1alenmieiatlsDuluvo t0trxrmo iytom   neo t srxr(o iudll emneilt sruaurpou0olxoiictadfsDemnmsnt0artrioctydlpDr nvs;s0tetrxo3oy4op elfcil(  2um(rp;t1oetoii3iydfaDeanvpnu4 rermr io1fmt aiei ()tetrim3ny4openmfvtl()s2uax p;t4tex  ictad m emu pn(4treriocoatlmDelueols)tetm(m ou4lp e netas  Dra(rpno4olxo f3iatfa2el(vsn(0alxrxo iadoaD  uvo t0sexoxr3oudlptn icils  Duaumono1tlx mf3tldfm elums (4trxoxrciadlatrlues;t sruoxo3iudopee fesls)aDtmxroou1tltn ociatls rmumo () etrifcoydom rlueols)srto(m nu1apeemietat) Dtrxm oo1tptomfcilslmDuaump;(0 lxnir3ootoaD luvi t0teuo(rpiy4apen nct s) Dra(  ;u4apx io3tadfa2uan o t4arxrmf tatlpt  ieol( srxriopiu1lmeemivtlt)a2tr(monu4olto i3iadfm2ul(mo;t0trerxoctadlmteaues t0teumiopou1omtn fviat) Drru o;u0tex  f3tldfaDel(vp t)alxnxrctytomt  neo;()trxr(r ny1am  miesls a2rrx pou4texoifciadfsDelnmpnt0trtoif ootfm   i sls0 rxrxmpiydom  lfeil() 2rm(mono1tptn f3iytfm2rmn p t4arxnmf3iodfp rluvi s)t2xmxm3iu1ap  mneil()srtr(  ot0opt  f3iydfm rl(vo t4trtoxr iotfat an ils)trto(m oudolen fctasfs2rrurp;o4alt ioctyd aDemumo (0arxnxrcoodla  aneils0srxrim ny1lpe  ivias s2rr( oou1aetnmfcias m rlnvo;u0 etoio iodfa rli o;t)trtm(mpiydop   ncslt srua(root1olxo ictytfa rluvo;(0altnif oadopDeli o;t  2to(o3no4ome mfcta(fa2rmxmono4oltnif3tyslsDean s (0tltnxoctotomt ai i t trxmxm3ou1lmt mietls)s2rm( onu1alxnif3iysfaDeanvo;u4arxrifcoodfp elieol()seumxm3oo1lp nmfes (  rumxro;t4ale iociytfs2rmu o;t4tlxnmr oo1om r ieilt) 2urio ny1al nlncil()arrmx o;t1oeto o3ils aDrmu s;() rtnmr3iydfpD lnvol(0trxoimpoodlptnlfviatfsDtaumonu0oexomi3tld a ulump ()aleomr3iadla raneil( setm(rpoy1lmen fvtatf 2um(mp;u1tpx ii3iadfa rauvo;u0trxoir3to1faD auvolt  rtoxo nu1lptemncs () 2rm(mooo1aet mietydls ulnvs;t0tetoir3tytlp  lnei s sexoim nudopt lfeias aDrmum ou0aeto oeiysla2uln s u0tltnxf3tadomD  u s;s) 2xo(opny1lm nmfvsas)aruru p;t4opxoio3iyt s2ra(von()trerio iadfmDeln ils0srxrxo io1lmeelnvias s2umx ont0tpxo fctlt m ul(ms;t4trxnmf3iodlaDr ivs s)s2xmxr3nodopeemfcia()sDtmumonu0oetoio3tat aDeanvs u0artnmfctatfpDean i s0 rto(m oudam nlncta(f rrmump;o1aptoifetasfs rm(vp;(0aexrmrcio1fm   uei;( sexmxopiu4lp  lnesa( sDraurp;t4aptomocilslaDemnvpn(0 etnxf3ootlmDe nvsl()tetoxopio4om  mivtatfaruaumpnu1ope ioeiys s2uaump (4 exomf3iy1opD ln o t)seur(m ny4lmenliviltfaruru p;o4oltnioeilt m2eauvo;(0tetnxociadoa r u s;(0s2xrio3iydape mnesls)aruaum nu0tet moctyslaDua( onu4 etoxo ta1lmD  ueilt0s2xoiopnu4ape  fvt t aruru pnt1alx  f3ilsfs ra(vo;() ltrxfctydfpt lies ()srto(opio1opte ncsltfsrtrurpou0tlt if3tas m2eaumo;(4 lermf iodfp   u sls  rxr(mpnudame  ncil(fs2ra(ro;u1opto ictys aDuau s;(0 lerxo3tadlatr i slt texrio3io4lleeliei tfs2trx o;t1aeeoii3iydlsDra(vp (0 renmr3iy1fat  neol( teum(mpiudapeemfes sf 2taxmpoo4tee mfctasfa2umnvpnu) rxnmf totlm rlues;(0teurxopiy4lmenmnviat s2ur(monu0ape mieiltls rmn o t0alxoif3ty1lpD  ieo;s texmxopoodom elivtl(fs2truroou4aetoii3iys mDrl(vpnu4arenmr totlpD  nvo;(  etrxr3nydam elnesls)s2uaxm nu0alxn octydls ra(mp u0alxoif iytfat anei t0trtmxopio4op  mfetatf Draum ;u0tleo ietatlaDemuvs ()artnio ty1fmDrlnes s0sexoio3iu4om  mivtls) 2urum nu1tpenif3ilt s2rl(vo t4aetrif iotlp eln s;(0 rtmir oo4lmtelfeslsfsruru  ou4altn iciydlm emu o t4 rtrxf ia1omtr n o ()sexrim3ou4om e fcsls sDrm( p;u0apx  i3iasfs2eln o;t) rerxr3iotfaD livslt)tetmxr io4apeemnvil( srra(r nt0oeto ictydlsDraums;u)texnmoctydfa eauei t s2xm(r ny1amt lfci tf rum(roou4ole  icildls2rlnmp t4 eenif3ty1lm  luei t trtm(m3oo1ap  mnesat) 2rax p;t1oeeniiciatfmDelu o;t) leoxoctadfaDrlnvs t)tetr(o io4omt mnet t) rtrx ont1tpeo octydlmDrm(vo ()aeeriocoydomD au o s  rtoxo nu4om nmict ( aDum(rpoo4aet iocias s2uln pn()tltrxo3oydoaD aies t  rtrxr3no4ap   ivsls  rra(rp;t4olx ifetadla eanmonu0texrio3iadoa e i slt texr(o oy4am nlicsl(  rtr(moot0alxnii3iltlmDra( s u4altrxo3oytlpt an il(0t2urxmpoy4ape mics t)srrau p;u4olenmictys mDrm(vs u4artnmf3tytoptran ols)trxrxmpnu1opt mfeslt)sDtrx ont0oexn o3iyslmDel(vo;(0trtomfcoadla r nvs () 2umir nydapee fetlt  Dumumo;o4tet ifeiaslaDulumo t)texnxf tytlmt  uvo;() eurxo ou1ap  mnesl(fs2tmxmpoo1tex  feiasfm2emuvo t0tlxoiociodopD  nvslt sexr(m3oo1lmtnlnvta(faDtrumoou0aleoioeiytfmDum(vsn(4tetrxfctadfmDrlnvs;t0 rumimpiodll  lneiatfaDtm( o;t4tpeo f3tyd aDrmnvsnu) exnifctotop rli o s0s2um(o oo1ll nmfcsat a2taxm ou1aee mieiaslm2ua(vo;(4artnmo oodfpDr iesl(0srxr(rpnodal e fet sfaDra(r ;t1apenmf3tydls2ulnmp;u0alenmf oytoa  lneils0 2xrirpiy4apt mfvsl()a2ra(mo;u4tetoifetls m2eln pnu) exrmfcio1lm eanvs;()trxr(opno1op nmnetls a2tmxr ou1tltoiieildlm eanms (0tetnxrcoytomtelivo (0 rxoim iu1ll emncs t a2ua(rp;t1tleomi3ilsfs2em(mp t)artomf oodoaD li i;t teurir ny4omeelnvtlt sDrmumo;u4tpto f3tas mDemuvo;(4aleoir3oydfp  lies t) 2xmxmpoodolte fetatfaDurx  no0tpxo ieiadlm2uluvo ()trxomrcoo1oaDe nvsls0srurxm io1ope mfet (fartaum ;o4oee mociyd a2eau o;u4aexnmr3tydfm  aieol(  exr(o nu4amt lieiltfa2rax pou1alx mo3iatfsDumnmon()texrmocoytlaD lnei t0srxo(m3oy4opt lneilsfa2rmum ou1aptomi3iadla uan s;u) eeomociatfm rlu ols0t2toirpiu1lmtn nesasfs2raxrpoo4opto i3ilt m rlnvp (4 exoxo to1oate nvs t0texoxrpnydlpt  fvtas)srrrxrpnu1aleo oetltls2ea(vsnu4trtnxo3iadlat  i s (0texmir3ny4omeelnvi tfsrtaurpoo0oexn ieiysfmDraump (4 rxnmo3iodlpDeli ol(0texoxm oo4omen fviltfaDrm(  ot0apxn fcildlm ra(mp (4alenio totla elueslt  etr(m3nu1lp   ncsat)a2tm(mpnu0opx mi3iytla2eln s;u0 reoxo oo1optr nei;s) rxrio ny1lmtemietls a2rax  ;o4oltnmiciyt s ra(mo;t)aetoir iytoatrlies;(0 euoio3nudlmenmivta(  Dum(mono0teeomociys mDrmn o u0arenmo3tytlaD au o t srumim nu1om nlneiasf 2rrxm nt0tlto f3tatfm2rm(msn()teenio3iadomt  i ilt t2xo(rpnu1am emnvtls a2um(mo;u1opx mf3iatla2elumpnu4arxrmoctatla elivi;s)tetmxo no4optelneilt artmxmoot1oltnioetlsls ul( snt4tlenir3ia1lmteaieslt0 2to(o nodll elfcslsf Dtaur ;u0olenmi3tls m ulu o t4aleniocoatlaDr ieils) etrim3ny4opeelnvsltfsrum(monu1alx  feias sDua( pnt0 rxrir3iadlp raneo;s  2umxo3ou4ap  lncil() 2trumpoo0tee  feild s rl(mo t4tlxnxo ia1lat  i il( trurxo oydop e nvslt) Duaxmo;o4oetoioeild s2rmuvpn(0tetnir oa1lm r nvi;s) 2toxmpnu4alt lnctlt)srtmurpot0ape mf3tyt s umnvo;u0 eenmr3ootlatelnvil(  ruo(m3oudap emfviat sDumu p;u1apxo ictlsfsDrl(vs u)alerxf3iytopD  i ols  2tm(o no1alenlfcsat aDtm( ont4apeo fciadla ulump t4tltrxf3tytoa  auvi s) rtrirpiu4om n ivi s  2rrx o;o4opx moctytla ul( s ()arxnxo3iy1lp e iei;(  2urxo3iu1lmtemfeilt s2tr(m ou4aptomiciytlsDrmu pn(0 ltrmo oytop elnvs s srxrxopno4apt mnet (f Dtax o;t0tlx mi3ildfa2umnmsnt4tetoir todfpt anvi (0 exrxm3no1op  lfvs s)aDumu o;t1tpxoif3ils m ua(vs;()teeoxr3oadfp e iei s0 2xm(opou1lltnmnvi t srta(mo;t4tlxnmoetyd m em(mont)arxnmf tydlpD auvs;t teumxopiudol elfvt s srururpnu1aetoifciytfm2eauvpnu)arxniociodfp rlivo s0srto(r nydal elnctltf 2rax  oo4tpxnmietadfmDem(vo (4texomo oa1lmteau i;s)tetrim no1ape  fetlsf rumxmo;u1aexniieiaslmDrl(von() reoircoo1oa eanvolt0srur(opio4lptnlnctasfs2tmurpou1oleomfeils mDrm(vsnu4treomocoytfp   ueo ()texr(rpiu4lptemict tfaDurur ;o0teenmi3iydfaDumn pnt0alenxf oatopt an olt0sexmir3iu4olee fci s  rrrx  nt1oetomo3tyt mDemn o;u) ltoxocootlmtr nei;(0tetmim3oy1ol  lict sfsDurxrpnu0oetn feildfa2emn onu) rxrxr oatfm elnvils seumxo iu4aleemivi t  2tmu  ;u0tlxniociadfs rmnvs;(4tlerxf3iydlmt ln o t0teurxr nu1apenlnvslt  2rmxmonu4tptnmfetys sDelnvs;u0 exoxr3oy1lmDr neil( s2trxrpoy1lme lictl(  2rmx ont0tetnmfciytfmDemnvsn()tleomr3tatfaDrlnei () eum(mpno4am emies sfa2uaumpnu0tlt iietys a um( o () rerxrctytoat  uvil(  rtr(mpnydll elivsas srrax pou0oexnioeilslm2ul( snt) lxrirctodlmtranes t0 2xoxr iu1ol  mnvil(fs2rax oot0tltn icilsfa2rm( o t4artnmo3oodop  ai i () exmxm io4alenmicsl()aDtau  oo1oee moeildla2ranvon() rtnio oodopD  u s;t0s2to(mpnydale lnvsa( a2raxrpoo4tpe mieild aDranms t)trtomfcoo1fmDrlueo ()sexrxo3nydlm emfesl( srrmxrono1oleoio3iysfs2rlnvo (4 rtnmr3iatlm   iei t) etm(rpoo4omenlfvt (faDrrx onu0aexomocildfs2rm(vo u)tltoio3io1faDrlu ol( t2trxm no4lptelnci s a2rrumonu0alxn f3iydfa emnmo () ltnio oy1fpD lu ilt)trtoiopoo4ap nmiesat)aDtaxrpou0apt mf3tlsfa2emn ont0 exnmr3oadop e u ilt) etr(o3iydam nlfvils  rum(m oo0aetnmf3iyslmDemumo t)teeoxrcio1optrluvil()trxoxm3nudamtnlfcsl(faDtmxmpou1tlenmo3iatlaDrlnvon(4arenir ta1fa  livols0sruoxm3oo1omenlfvilsf 2uau  ;t0aeeo f3iysfs emuvp;(0trxnxrcoy1op eauvo;s0setrir iodlmee netl(  Dtr( o;o1aexo feiltls uaums;(4tlxnmo3tytlpDr n o s  rxmio3io4am n nvsls  2urum ou0tpe mfciysfm em( s;u)tltrxo3ty1omDraivilt  2tm(rpny1optelies (f Draumpoo0aet  oetatlaDeau p u4 rxnif tytlpD aiei;s0s2tmxr oudap   fei tfsDtmxmpoo4ale mfciat a2emu s;u) lxrir3iatlat an i;s0 2xo(m3oo1alen fci s)s2umur ;o1alto f3iyd sDran ont4areriociotoa e n s ( sexo(o ny1amt lfei s)sDur(rooo4aex mi3iyt sDul( o;t4 rtrio3tatlmDelnes;(  2umir3iudomtnmici t)a2tmxm ou0oeeoifetasls2rm(mp (4trtnxo3iy1lm r ivo;s srtmxo oy1optemfviat s2uau  ot0aex mi3tadfsDeanmo;t)tltnxrciadoa e uei ( srxmim3oodam elfvs (fsDrm( oot4oet mi3tltfs emumsn(4arxrif3ty1lpDeli ols0 eumxm3io4lp nlnctl(  2rmx onu1olx mi3iyslmDumn s ()alxrxfciy1fp   nes;t)t2xmxrpoy1amenlnvtl(  2raxmpoo0aex  f3tydlaDrm( sn()arerxocootfpDraueilt)srxrirpnudlltnmnvt s) rrruro;t0oex  ocilsfsDulnms u4aexoxrctytopDraies;(  rtoio nodalenmfeslt  2rax ont1texnmo3iyt a em(ms (4tltrif tatomDrli i;t  exr(m3no4lpen ncs s)sDtr(rpoo1tlxnii3ilsfm2rl(vont0 lxrmo3todoaD  uvi (0 eumirpiu4lm e iet sfsrtax p;o1tlxnmietysfa eln o t0treniociotlpDe i slt trxmxr oy1om   netls s2raxrp;o1tex mf3iydla2emnms ()tleoxo tadlpteaueo;() etrimpno4optn nvslt) rumxr ou1aeeoifcildfs2uluvo (4aetnmo oadomDrlivs;( t2tm(r3ou1opt  fct t)sDtmxmooo1tpxomi3ilsls em( p;(4tlxomf tytlate n sls) exrxm ny4llt mfvi t srtrurp;t1apx if3ilslm ul(vo (0tetrxf todoaDr n olt) 2to(mpiodoptn ietltf Dur(r ;t0oex iiciyslmDean pn(0tetrmocootomtrlieo t  eurxmpnu1apt liciasfs2tr( pno4ope ifcilslaDel( pnt4aeenxocoy1faDe ivi t)tetoir iydlp n fvs t)s2tmurpno0openmo3tldls el(vo t)trxnir3oadfat  uvo;( trtr(o3oudomt  nei tfsDumur oo1aetoifeiltfs ranms (4areoioctotfa e n ols0t2tm(m3iu1llt  nci (faDrmxr ou4oltoif3ias m2umn p (4tetrxocootlp ran o;t0s2xo(m3iodamt  ieiatfa2rax p;t0optn f3iytlsDrmnms u)trtrio ta1fatr n o;(0texrxr3oo1alenmiet sfarrr(rp;u4oeenifeiytfm emuvo (4arermo todfpDelueols)sexriopiy1omeemivtat)srtru oot1optn iciyt mDrlnms;u) rtomr3oatlmt au i s  rtoio no4ap n fcta( srrm(rp;t4oex mo3ild sDum(mpn(0 lxoxo iydomt  ivs t  eumiopiy1omenlfetls a2rru  no1apxnmfetydla uanvs t4tetrxo3ootfm rlnesls) etoxopiudapee nvslt)sDrmurpnu1aet iicildlm uanvp;(0 eenxf3tydopDr nei;(0srxoxo oudom   nei (  2um( pou1apenmi3tydlmDemn p t4 rxoir3tydop   nvs;(0texoxm oo1ap nmfesls)a2ua(m no1aleoif3ild aDelnvon()aexnmo3tatlaD aivo;t  2tr(mpiu1olenlivt s)srtmx  oo1tlxn oetas s2em( p t4aleoif iadlatranes;( srum(m iu4am  micil()srtr( p;t1tpenmiciyt s2elu pnu4tetoio3oo1op r ieolt)truoxm3oo1oltn iesa(f 2trxr ot4oexn ociltlm ea(ms;t0tlenmoctatom ran s;s)texrxo iydamtn ivs s aruaxr oo1tpeo i3iatfm2rm(vpn()arenif3oy1laD aueslt  etmio no4ol emncta( aDumum oo0ale  oeiltla emnmpn(4 reoir ia1fmDraneo s) etr(r3iu1lp emnvs s  rrm(m ou4optnmoeiydlm2ea(vo;t0trxoxfcta1la eau i;t0trur(m3iy4ale lnvias)a2uaumo;t0alx  o3iad mDra( ont4aleoif iydoptr nvs s)seur(rpiudamtnlnes (  2um(m ;t0tlxomo3iytla el( o;t0aleomr3ootfptr ivil(  ruoirpiodamte ivs t) rrr( pot0optnmfeias a ua(mo u) lxnmf iatfaDelnvs;s) eurio3iy1ameemncil(faDum(rooo0teenioctat m ra( p;(4arenxrcto1lmtelneslt srtr(r3iydolte fei t) ruaum ;t0tex micilt s ra( p;u4arenxo iy1fpteauei;()seumirpnudllee feta(  2rrxm no0aexnii3ildlm uluvp u0 etnio3oydfpDeli i;()seumxr oy4ol nmfctls  ruau  ;u0tpen feiltfs2ran p t0 lenxr3oatfpt  iei s)srto(r ou4om  mneiat  rrmxr nt4tlxo fctldfa2emnvs;u4texrircoo1om r ieols s2trxr oy1lm emictlsfsDraxmpnu4optomoeilslaDuluvp;(4 eeoirciotlat luesls)t2xrxopoodom  mnvtat)srrm(rpoo4aexnifeiltfs emuvsnu4tltnir tydfat li o;s0srtmxopno1lleemfesa(f rtrxm nt4tle  ieiadfm eanmonu4aeermo tytlm rln sls0t2tm(mpny4alenlnvs () rtaxro;u4oet  feiasfm uluvp (4 lermf3iydfa  li o;( seurirpno4lmtn ncsasf 2rax p;u1ale ifeiad a uau on(0 ltoxf3iatoaDe uvo;t0 rurim3oudlle  nvt (  Duru oot1tpxomfeildfa2ea(vo t4tleoifctydlpt anvi;(0 ruoimpou1ll  lfvs t)aDtmx poo1tet ifeiad m uan pnu0trerifcoa1lmtr ueils  etr(o3iodlmt livsltf 2rmur ot1alenmf3tls sDemums (4 ltomocia1fmDrlies;s0trumxm oy1olt mivilt) 2tmum ;t4tptnmictasfa eau snu)artrir3tytoa rli s s0srumio oodlle  ietas  Dra(rp;o4opeo o3iyslm elu pnt)artrmo oydfa ranes () exrxopoo1optemfvsas  2urxrpoo4tlxniocilslm2ul(ms u)tlxomfcoodfptelivs;t) rtoim nu4am  lies () 2ra(mpoo4aetnmoctasla2um(ms t)tetnif ty1opD li ol(0 rtoxmpiu1omenmfeilt)s2ra(rooo4olenmieiasls2um(vpnu0trtomrctatlm   ieslt0srxrio oy4lpenlnvias aDrm(mp;t1openif3iad a ra(monu0artomf3oa1lmtrlueo;t) eumxo3oydlpenlfvilt  rrmu o;t1apxo f3iysfa2ulnvs;u)aetoircoa1omDe u il(0 exoxm nu1lmen netat)aDurx  nu4tlxniictlt mDrlnmp;u) rermo oy1lat luvil( teuo(o oodlme  nvi t  Dumur nt1aleomo3ilt a umnvs;t4 rtnxrcoatlaDeau ilt0s2xoiopnydal emfviat  rtaum no4tpxnmi3ilslm2eau s;t0trtrxf3iatoat auesl(  2um(o3nodoltn fesatfsDtrx  nu1altnifeiltfsDea(vpnu4arxnmrctadopDeanvo t0srtoiopnudop n ncs (fsrururoou4aexnifetytlmDulnmp u)arxomociydfatran s ( srxrxr iudapte ics tf 2taumo;o0apx moeildla2emumpnt0 exoxocoy1oate neols0 eumio nudlm nlfet tf 2ua(mo;o1aet mfctysla2rmnvsn() etnmo tytfpteau i;s t2tr(o ou1omenlnci tfa2rau  ou4olt iieildfm rmumo;t)aetriocto1lptraneo t)seumir ou4alte feta()aDumump;o1tlxn o3tatlsDulu ont)arxrifcoytom rau ols0srtmxmpnu1op elies tfaDumxroot0tpen ociasfm ulums;(0 rxrir3to1la   ieilt t2umir3ou1optnlfvsls)aDumu pot0apeomieiyd aDumu p;t0aeenmfciy1fatr n s;s0setoxm no1lp e nci sf Dtax  nt4aeen oeildfm2eln s u4aetomo3ootfaD ln s s s2xoxm3iudaleelieslt)srtmxmooo1olt mi3tys aDrm(vsnt0arxnio3iodlpDelnes;()texrir ny1lp emncslt) rtru o;u0opx  o3tlt sDelumo (4 lermr oydla elueo;()srxr(m3oydom emncs s) Durxm nu1altn fcias mDulnms t0trxrir oy1omDrlu s ( sexm(o3nu1lp n fci s  rumurp;t1olenioeiltfm emnms;(0tlerxf3oy1oaDr uvo;s  etrirpnudamtnmfci (farraum oo0tleoifeiytla rlnmsnu4aetomrciadla r i s s)srxo(r io4optnlnvs tfaDuaxm oo0tlenmociytlaDrl( o (0 rxnmr3to1lpDr uvo ( trxo(r nydal emncs tf Drr( p;t0aeeomfetlt a el(mp ()tetomocootlpDranes t s2trir oydaptemfvtl(faDtm(rp;u0opx mfetls m2umn o (0trtnxrciatoa r i s () etmxo ou4om   neiatfaDraxrp;t4tee  oeiatfa rmumo (0tlxoxf ty1fmD ai s;s)texo(opoudlp emiesls sruru onu0oeeo i3iatlmDum(vs;()aeerio3iy1fmt li sls t2xm(mpoo4amtnlictas  2ra(rp;u4aeen feiatlmDelumsnt0 lenxrctydoatelueo (  rxo(m3iudll emfvtas s2rm( onu1alxo o3iltlmDrmu o (0tetrmf3to1fateauesls t2xrxr oy4ome lneils srtaxm nu4tleomoeiaslm raump;t)tetomr3iotoa  au slt0tetm(r3iudlltnlfei t)aDrauro;o4aexnmoeiadfsDua(mo;t)aeeoifciydfaDr iei s0trxoxr iu4lme lfes s  2rrx  ou4ale  feiydlaDrauvo u)aexoxrcoytoa   iei t0 rtoir3oy4op  lfvtl()a2tax pou0aetoiicilsls2eau o;t4aeerxf tytfmt lu i;t sexo(opiu4om  lnvilt) 2rrx onu4ope miciyslm elumo u)texnmf tydop r u il( sexm(o3ou4om emfesasf 2rrx o;u1altnifcild aDuanms;t4 exoirciodfpt luvo;s)t2tr(r3iydam  lictas sDrrx  ot1tleniicilt mDuluvp;()altnmociodlpD luvo;(0 2xmxmpiudop n ictatfa2rmurpno4aexnmoeiatls uaump;u)texrxr3oadoaDeai il( trxm(mpoy4ll elnet s)srtmx o;o1texomociatlm2raumo;t0tlerxr3ootlp  aivi t trxoxm3oo1amtnmnesa(faDta(rono4teenio3tyt s2emnvpnt) ltnmf oodoa eluei (0 rxmiopou4olee nvt sfs2ua(ro;u0opxo f3tys aDel(mo u4 etoxf3tytla e neo;t  rxr(r nu4lp   ivtlsf 2um( onu4tlxnifciydfa rau sn(4 rtnmocta1fptr nvsl( sexriopio1lmt  fciat)arururpot4alx mf3iadla2uanvo t4aetrmo oadlpD aneo t trxo(mpoydope mivil(farum(mo;u4tpt ifeildfs2uluvp;t) exomf todfpDeanvo;( teum(o iodol nmfctlt)arrr(rp;o1ape ii3tydls2ulnmp u4 rerxf tydlpt  i o t) 2tm(rpiu1alen nci s) 2trurpnu4apeo oetyd s2ra(mp;t) ltoxf to1oa e ueol()t2xo(o iy4lmeemnvsas)s2urx pou0tlxomo3iys s2ul( snu4texnxocoadfpDranes;( s2trim no4ol emfvt sf Drm(  ;o0tpx if3ildfs el( s;(4tlenir3iadlptr nes;t)trxm(o3iudal  lfet (  rumx oou0aet  i3iadfs ua(vs;()altomo tydlm  au ils) exoir oo4ame  fctasf Dtm(m nu1tpxomo3tlsfs um(msn(0aeermo3iadopDr neo ( sruoimpoy4opt livsas)arra(m nt0olxo fciat m uaums t4 lxnxo iatlaD  i o;s trtrxm iu4apeelnciltfaDur(r no1optoif3ildlsDum( p;u)artnmociadoat aies ( trxmio ou4lpt micsls a2trxr ou4opx  o3iasfa2emuvs (4 lxoxo iatoaDrau o;s tetoio io1omenmnvs t  Drmu p;u0tlt iociydls2emu pn(0aetnmrciodfa rlu i;s)setmxr3iy4omtn feia(f rta( oou1tpto i3iyt s um( onu)aleoio3oy1fp rln s t0seurxr oy1alt  fctat s2raur ot1oet  fetytlsDua( p (4tlerifciadlateauvi s teuoio ou4oltnlicias arraxm nt0olxo feiatls2ra( pnu4teeoxf oadopteli i;s)teuoio3iy4lmtelfvsls arrmxm nu4altnmfcildfa rl(vonu4aetnifctydfmD  neo ( t2xm(o3nu1optelnvia()s2trum ;o1tleniiciytlsDeau s;t4 ltrxo3iotlm r nvs t) exmxopnodal  lncsltfsrumx o;o1tlto fciyt a2ra(mp u0 exnxfcoy1opD luvs t)seumimpou1lm nlfeia(f Dur(m oo0apeoio3iatfs2uluvonu0texomo oo1opD aivolt0trtr(o iydlme livsa(  Duaxront1oleo f3ils a2um(mp () rermr iytlm elnvi t0s2toio ny4lle  ivsls  rurx pno1tpe mieiysls rl( pn(0tlerxf3iodfmtr i ils)trxmio nodll emfesl() 2ua( p;t1apto feiaslm2rlnmo;t4aexnmoctytoatelnvs;( texoxopoo1amtn nciltf rta(r ;o0alx mo3tas s2rln p (4treomo oo1fptrauvo;t) eumir3iudamtemietas sDtrxm no0tlxoii3iydfaDul( o;t)tltoxr3todoateanei;t t2xrxr3nudaltn fes (f Dua(mp;o0tetomf3tatlsDea(von(4treoifcia1oaDelnes s)s2xr(r3iy1amt  ivtasfarrax pou4apen i3ilsfs ua(ms;t4 ltnmr iatoaD anesl() ruo(o3io1aptelnct ()srrmu  nu1optoifctys a uluvo;t0aexnxr3iatlmt anvs;s0t2xr(mpoo1alt licilt a2ra( pou0oeen ociyslsDuanmo t4aexrir oa1oate uvi t t2urim3iudol nlnvs s sDumum ;o4oee io3tyd aDeln pnt)aetoir3iy1fp  au ilt)s2urxm io4lpt mnei ()sDuru pnt0tle ifeiaslm ua(vs;u4trenir oatlp e u olt0t2tm(rpoudll nlnvsltfs2ua(m ou0apxn iciltfmDrmnvs;u)tetrmo oy1oa rluvs;(0t2xr(m3oy4ap  liesa( aDta( oot1aptoioetatls2rmnvon(4 rerio iy1lateau o;(0 2toxm3oudam elics sfsrtr(roou4opt mfctyslm em(mo;(4 lerxr oy1fa e neils0trxoio iy1olen fcs s) 2ua(m nu0tpt moctldfmDum(ms;u4altoifciy1laD au s;t0srtrirpnu1lm   fcsltf Durxmooo1texo i3ilslsDeanmpnu4trxnxocoa1lmte neo;t  eur(r oudll e ieiat aDraxm ot1tlxoiictlt sDel(mp;t4 rtoxo ta1faD au o s0 rumir iydoltn nctlt sDrrxm ot4alx mi3tasla rl(ms;(0altomf3iytoa elivi;s0sexoim iy4aptemfcsl( sDtau  ;t4texnmi3tyt a ea(ms;(4aexnxrcta1fp rlivs s0 etr(opoy1altnmncia(fsruaumooo1aexoiietat mDulump;u0trxoxoctytoptran o;s s2tmxmpio4aleemfeia( sDuaump;o4apx iieiad aDrmumpn() ltrif ootfmte ieo;t truo(r io1lp e nvsa( srurxm no4alx ioctlt a uaumpn() eeoxr to1la   u s;() eumiopoudlltemneslt)aDuauront1ale  oetydlaDemnms t0 etnmr todoa   nvilt)tetr(rpiu1olt  nvt ()s2tmx ooo1ole  ieiat m eaums;t)trtomr3tydomteau o t0 eum(r oudlmtnlfvtl(  Dumumo;t1aet mieildlm rlu s (4teenmr ta1oaD aies t0 rxo(o3ny4lle mivsa(  2trxmp;u1oltn i3iaslmDulump;t)teeoio iytfmt anesl() 2xmxrpoo1op  lfvsl(fa2um(mpnt4oexomf3tydlmDel(vsnt4aeeoxo3ia1fp eluvs;s trtoxm nu4lme  fetl() 2rmu poo4apxn o3iydfm um(mp t4 exnxo iydopD aivols0sexo(opiu4alenlfctat aruau o;o4altn i3iltfaDrlump t0tlxoio oa1fpt auvo (0srumiopiudapt mfviasf ruaumpou1aptoio3iltla2emuvs u4tetomoctadlptr u o;s0 rur(o ny4al emnci sfsrraxmpno0tleoiociad m emnvp;t)alxnxr3ty1oatraivi ()s2tmxmpnu1ole  ict s s2rr(mooo4tlt  i3iydlsDelu o;u0 rtrmr3tadoate ieo;(  2uriopiu1om e fei t)s2uaxmo;t1altnmfciatfs2ulu on(4 rtnxr3tydfmtean ilt0sruo(m3iy4ape lncilsfaDur( o;o4aptnmi3ild a el(vsnt4aexoxo iytoa r uvi;t texmxr no1lmeelicsas) 2tm(rooo0opxoioeiysfm2elu s t0alxnxo3ta1lmtr uvs;t0srtoiopno4ol  miei tfarra(m ot1olenmfeiatla2ea(mpnu4trxriocoo1lpD  n i t0 2toxm3no4oleelicsls  Durumpnu1aptnifetls mDelnmo;t)texriocoytomtr ivslt0 etoxo nu1al  lneia(  rta(mp;t0oeeo ietys a2umu pnt)tltoxr iadlm   iesl(0 exmxm3ou4aptn ivil(  2tmur nt0tlenmi3ild m2uln o (4artriocoo1om e ueil(0 etr(mpio4lpt  fctlsfaDrrxmooo4texoii3tasfaDrlu s ()artoir iodlp  aneo s teumxm iydoptelnei ( srrmxroot1ape  fctysfaDranmsn(4alxomfcoydopte ivol(0trxriopiy1ll n ivsl()s2tmumoot1ope moeiadla uluvs;t0arermrciodlmDr n ols s2xm(m oo1lmeelfci t)aDtmxrp;t0olxo ictytfmDuanvsnu4tltrxoctatlmDe u il(  2urir io1omenlict ( s2tru p;o4aee mfctatlsDul(vp;u0tetnmocto1fa rlivsls0srurim iodamtnlfvtlsf Dtrx onu1tee mocilslsDuln o;u)tetoxf3iydop  lieo (  2tmxm iu4openmnet tfsrumu  ;u1tpxnmoetytfa uan p;t0 ltnmo3iytfmDe nvs;t) eurir3ny1omtn ici s)a2rr(mpot1aet ioetydfs rl(vp u4trxoxfciadoa eau ilt  rxrxopio1al  lnesas)arraxmo;o4alxniiciatfm2elump u4artnmo3oo1omDeaneslt) etm(r nydll  lnvsas)arraum ou4apx mf3tat m2ea( snu4 etrif iydfmt aivs;()teur(r3io4amt  nesa()artmur nu4tlenii3iyslaDrlnmo;u0 exrif3totoaD livilt)srxmim3ou1omtemncs (  2ur(ront0aptnmiciyd s el(msnu4treriociodopDean o s0 rur(r3iodom  lneiasfa2taumooo4opxomoctasfa2umn on(0texrxf tydop  au ols)teuoxopiy1ol elivi ()s2tm(mp;t4opt mf3iysfm el( p;u4tltrxrcty1op raivsls0t2toir io4op emfvsls  2rrur nu1apx mfetas a2rmnmp;(0trtrxrcoo1fpte nvi ()tetrxm nodoptnlicilsf Dumu pot1tpe  fctys a ean p;u4 lenmfctatfm  lueo;() exmxopno4op  lnvtas)a2tm(rp;o0tetn oetltfm rm( s;u4tetnif3ootfaDe ues s t2xoiopoodapenlfcils  2tmxmpou0ape io3tytfsDelnms;() exnif3iadfaDrlivi;t  2xo(o3oy1opt mfvtlt) 2umxm ot1teeomi3iyd sDemnmo;u4trenxo3iotlmteaieo s0s2xmimpiy4alt mfvsls)aDrmuro;o0aeenio3tls s2umu on(4aexrxr oy1fa ranvi t) rtr(opoodll nlics t  2tmxrpnt0tpeomietysfa2ulnms t4 exrir3tytfm  aues t0sexm(rpnu4apee feias) 2um(mooo4oeenifetldlsDuauvp;()tetnmfcta1fa raieil()texr(opiu4al emfesa() 2um( pot4tlt ii3tadlmDranmo t)arxoir3ta1fp   neo;s0seurxm3oydolen ncs ()sDua(  nu1aptnmictydls eaumpnt) eeomr iydomDr i i;s0 eumim3ny4opt licslsfa2raurp;t0aet mf3tat m2ua(vp u0 rxrmo3oodopt lnvo ( s2xoxo io1amte ncil(f rrrxmpno0tleo feiasfmDuau o;t)trtoio oa1la r n o t)sexoimpio1aleemfciat  2truro;o1ole  ieiytfsDulu o;()arxomrcoodlpteli i s  exoxm io4aptn ieslt s2umumono1aeeomfciltla ulumsnu4teenxo tytop rluei ()tetmir iy4ap  mneiltfarta(  ;t1texn f3iadfm ean p;u)tetrxrcoytopDr n ols)s2um(m3ou1ale lici s  rta(m nu1opxnmfetytfaDra(vp;u4tlxrir3iatlm r uvo;t)s2xoir io4am eliesa(f 2ta(rpnt1tlx iociyd a2eanvs (0tleomfciadomDelnvo;(0 etm(o3ou1ame  fcta(fs2tru ono4tpenmf3tydls2elu pnt) ltnio iotoa e u olt0s2to(m nu4om  mfes tfa2rru ooo1alxnmo3iatfs2rmn p u) rxomr tydla   ivolt  ruoir3io4apt mies t) 2trx o;o1tptoio3tytlmDulumo u4alxrxo3tytlat aieols  2uoxopoodom emncil() Dtrx pno0oexoioctlt a2rmnvpnu0aetnir iotlmteaivs;s)s2xmxopiu4ol n ivil( aDtmxmono1opx moetat sDemumpn()aexnxf3oo1fa r nvslt0 rurxopno4oltnlncta( sDtmu  ot0oex  oeiadla2ul(vont)aetnxrctodom e nes;t0trtoxo3io1alenmicsl(fsrrmum nu0aeen fctldlsDuaums;u) etnio iydom  ai il(0teum(r oo1lp e fcs s)srraum ;o4tee ifeiadlaDulu p;u4tetnio3ty1oateln o;s) rtm(m nodoptnlfcsltf rrm(r ou4tetniictydlm2ul( s ()arxomo3todomtr neo ()trur(o no4llenliesas srtr( o;t0oeeo ieiyd sDraumont) reoirciotla rai o;t0t2trxm3ou4opte ivtlsfsrrmu  ;u0tpeo fciyd a rmn s;(4trxrmf3oo1omte n ol(0tetmxm3oydlltemfesls)artruroot0aptnmi3iyt m2eanmonu0 eeniociodfpt  iei t srxrxo iy1llenlfvtls) rtmxmpot1alt mfeiatfsDrlnmpn()trxrxfciy1fat aieolt0 rto(opiy1am e fesls) Dta(  ;o1opx mi3iydfa2emumsnt4artomrcta1fm r nvo t0sruoxopiy1lle lfeilsfaDumu pnu1optoif3tatlsDrlumo;t)trxnxr3iy1opDelnes;s0trtoxr3no1lle  fcsas arur(m nt4tlxn f3tltfsDea(vonu4 rxrxocto1laD anvslt0trurimpoo4optnmfvtl()aDrmu o;o4apen ictasfsDelnvo u0trtrmocta1opte ivsl(0 exmiopiu4amee nvtat aDtax p;t1oleomf3tytfa umuvsn(4arxoiociydlm  au s;(0 2uo(rpnydam nmnvsat srtmxmo;u0tee  ocils aDrl(ms;u) exrxf ootop   u s s) 2tm(rpoydamt  ncslsfartmxm ot0aexn oeiatls2eanvsnt) rermr oo1fp e ieo;t0s2xrir ny1lm e fci t  Draump;t4aet  ociys aDean p () lxoir3oytopte neols  2um(r3oodape  ncilsf Dtm( oot4opxoifeiatfa2ean p u)aleoxr3oo1opt anvs;s)trumxo iu4llenmiesas) Dururpno1aeenmoctyd a2ean sn(0treomr tydom rluvo s0s2tm(mpoy4ap n fcsas sDtmu o;o1altnmfctlslmDuluvo;t4texomocto1opDe ueols)s2xrxm3iy4llenlnvtltf Dur(r ou4openmf3ils sDrm(msnu4trxnir to1lp e n o (0trtrio io4lme mici s)aruau  no4opx  i3iyt s rmn pn(0 exoio3totoaD auvsl() 2xmiopoodopenlici ()aruau  oo4ole ioeiytlaDrmu p;(0texoif3tytoat  ivs;s trtr(m ny4ape mict s arur(mp;u4aetoioetad mDrmn snt4 lxrxf3iodoat lu ols0t2xm(rpio4amee nctas  2ta(rpou1tee  fciytla rlumo u0tetrio ootfpteaueo;(0trxmxopiodamen ncslt) Drrxr oo4tle iociat a ulnms;t0tltriocty1fatranei (0 2xm(r3oydlpt livi ( s2trx p;o1opt miciasfs um(mp (4 ltnmf3to1optelivi;s trxm(opou4ap elncsat)a2umum ;t4tpto octldla2ranvs;t4 lxnxr iy1omDeliei s srtoiopoo1aleelics s)srtr( pot0texnii3iys m rlumonu)trermocta1fm ran ils t2umxo3oo1op nmncsa(faDra(m ou4oetnifciytlaDrmnvp;() rtnmf3totom r nvsls setm(r oo1op nlfcilt  rrmx ono4oet  ietltlaDulnvs;t)altoxo io1faDeaneo;t0trxmirpiu1lptnlnet (  Dua(ro;o0ape  fciysfm elnvs;t)texrxf ty1fmtrai il()t2uoxm3oodoltn nvtls)a2ua(mo;u1tltnifctadfa rmuvo u0tetnifciydoate neo;(0 2toxo3iydlp nmiesa(fsrra( poo4aee moetasla uanvp t)alxnxocta1omtrln s;s0teurxm3ou4altnmieil(fsrta(rpot1oexo i3iys aDrluvo;()trerxo tatoa  luvsls)truoir3oodlp nliei t) Dtmurp;u4tpt mfetadfa rlnmon(4tltoio todlmt lues s)seur(opoo1lm nmnct (faDur( p;o4apxn icias a2ua(vo ()artnif3ootfaDraivolt0teuriopou1omenlneslt)srtmumpoo4oex moetls aDeln snt4tlxnmr io1optean i;t  rxrxopou1lp   ivslt) 2rr(rpoo4opt mieiasls2rl(vp;u4tlerxo3oadfptrauvi ( sexr(m iy1optelfesls) rra(r oo4tleo feiaslm2ulu pn(0artrmrciatlp  anvi s0s2uo(mpno4aptnlnetas)sDta(rp;u4teenioeiyt aDuanvo (0tleoiociy1lp   nes s0seuoxmpoo1amtnlivtatfa2umumo;o0oeen o3ilsla2rmn o (0trtrxoctytlaD  ivo;t) 2xm(m iu4llenmnvt s)arururpou0altomiciat s2uau o u)aeenmfctodfaDeanvi (0srxmxo nydole mfetas sDrau  oo1tptniociltla2el( on()tltoxo3iy1fptrau s s  2umxr oy1apeelfeias)s2rrx pno4opxomo3ildlsDum( o;u) exrxr oadop eaiei s  ruoxm3ou1ll nlicsat sruax o;t0ope moetatlsDulnvsn(0alxnxocoytoa elneslt)sexrio3nu4lm emivs (fsDtmxmonu1oetoiieiytlmDumnmp;u4trxnxf3totopt aneo;t seurirpiy1op nmicia(f 2rmur no4optn i3tldfmDea(mp (4aetnio3oatomDranes;()s2umxopiodamtnmncta( sDra(mo;u4olx mi3iydlm2ranmpnt0 etoio3iotfm raivi ()trurimpoy1lm e ncslt)aDuau ooo4altnmoeiytla eanmp t)teeoifciytla  anei;s0t2um(m3io4ope mneiat)s2taum no4tlxomi3tatlaDulnvsn()tlenxocoydoaD ai s s0seuoxrpoy4om  lncsa()srua(ro;t1aetoifctld s2ran o ()trerxr ia1lptelivil(0s2xrxmpiydlm  mivsa(f Dtaxr nt4tex mf3iysla2uauvsnt4 eermf3oydomDeaueol(0 rtrxrpnu4om n nvtlsfsrrm(m no4texo ocilt sDean pnt0tltoxr3iotfaDeai ils)trxrirpiudap  lncsa()a2taxm ;o4alt  oeild m2rmn p;t) exoif tytoaDrln s;t0 2xmirpiudamte nvils) Dtaurp;u4oeeomfctadls umnms;() etnir tadfptr uei (0 2urio oy1altnmfesa( sDrrxmp;t4tptn i3tlt s rm( snu)alxrifctatom raivs ()srtoir nodape mnes t)srtmx  ot4tpxo feildfs2rlu p t0teerio3oadlmt aies s)seuoxo3iudap n fes ()s2umxm ou1opxnmociydfsDeluvo;() exrxfciy1fa  luvs t) rurxm no1ame  ieils) Dra(  ;t0aeeomf3tld sDrmuvpnt4arxomo oytomDr n sls)teuoimpny4alt liviat)a2um( pno1oltnmf3tldfaDulnvp;u0trenmo oadoaD an s t0t2trxo3iydolt  fvsls)aDtrurono1olenmo3tlt s rmn o u)trxrxociodfmtraueo ()trtoiopio1lp nmietas  Dtr(ro;u0tptomi3tltla eln s;()artrmfcoy1lp   uei;(  euoxr3oudameemieia() 2truront0teeo ietysfaDrau p;() eeoir3ia1fptraivo;s0seur(o iy4ame lfcsas sDtrx ont0olxoifeiasfsDrl(msnu0 ltomrctadlaDr ivs;s  rxmxm nodal n nvils)sDrru o;t4olx ifeiyt mDrmnvsn()tetrir3iadfaD  ieo s0texm(r3ny4om elfvta( a2ta(monu4texn ociytla2umn snu4texoir iy1fa  lies t sexr(m nudomt lnvt s)a2rr(m ;u1tleoioctyd sDem( on(0texrxfcia1lm raieslt0 etriopio1ol nmnvilt)a2ra(mo;t0opxo f3iasfa um(vp u0 rtrircty1oaDran s ( truoim3ny1ome  nesls aDra(mpnu0opx iietytla um(mp t) exrxfcia1la rlu s (  rxmimpiy4ll  mnetat)arumur ;o1tleoioctltlaDemu s;t)trxoxo3tatlm  lueils0s2ur(m3ou4lm nlnctl(  2ra(r nt1alxomociydfm eaumo (0trxoif3oatomtrauvs;(  2xo(rpnu4ol e nvs tf rur(r ;o0ole moctat s ea(vo u0arxrxfcoa1latr uvslt  2ur(opoy4al nmfctltf ruaxr ;o1alx iietldls2elu p;t4tlxoir3oy1oatrauvo s) 2toxo3iudlpenmnvia()aDra(rpou4apxnmoetasfs rl(mpnu4arerio ootlptrai ol() 2umiopoodom elnctas  Dum(rpno4tle  ieiad m ranms (4 ltrxfctodfpDraies;t t2uoxrpnodlp n ncsls aDrr( onu4oeeomo3iaslmDemnms t0trtrmrcoydlat  u o (0truo(m3oo4lpeelnei ( a2rrx  nu1apx io3iyt a2rl(ms;t)tltomo oa1lpDeli o;(0setoir ny1ap   fet t s2ur(rpnt0oltomieiasfmDea(vsnt0altomfcoo1omDraieol(0 rtrxo3nudllee fcsas)sruaxrono0aptnmietydfmDem( o;u0trtnmrcta1faDr ues ( t2tr(o3nu1am nmncsl(f 2rm( o;u4aee  oeiat a2em(vs;t) eenxfcta1fpDeauvs;s  rxrxo nudlmee icslt  2rmu pno1olt  fctaslm ulnvp;() eeomocoytfaD au o t) rtoio3oodomtnlict t a2rrumonu1tpe mf3taslm ra(vpn()alerio3tatlate n s;s0srxo(o oo1ap nlncilsf rrmx oou1opxo o3iatfm rmnmo;t)altrxf oy1om   u s;s) etrirpoy1ol  lies tfs2ua(mpnt0apxoif3ildla2rln pn()alxnxo iodlaDelivo ( trxm(o3io1ap  mfviasfsDumumo;t1aptn i3iytfm2rm(mo t0alxrifciy1omDr i s (0s2ur(rpiy1aptnlnvsltfsrrm(moou0altn feiadfmDumnvs;()alenxfctatoa elnvo s t2trxr nodamen fvsls sDrru ont1oexnmoeiatfs2eanvs t)treomf iy1opD ln sl( t2um(opoy1ole  feia(f ruaxroou1alxnmfeiydfa uln p t4teenio to1fmt aues;t)teurxrpny1olt livs (  2taur no1optoiieildfa em(msn() rerio iadfmteaueo;t seumir3oodlpenmneia( a2rmu  nt4apt  f3tasla el( o;u4 etrxo3iotfa e u s;t)srtrimpiodamt  nciat aDurx ono1tlxoiicilslm2eluvo ()trxrmf3iydfpDeanei;( s2xoio oudape micil(fsDtaxr nt0apeo ociasfs ranms (4trtoxo oatoa eauei t) etr(rpiy4ll n ncsasf 2trxm ;t1oeto fetlt m ul(vsnu4teeoxr tadoa rli olt trxrxo3oo4apt mivtlsf rrau pno4opeomfeiys m2rau s;u) rtrircia1oateauvs s  etmimpoy1opeelfctlsfaDururp;t0oltn oetys s2ul(ms u)tlenmrctydopDelu i;s)s2xo(rpoo4om  mnvtas  Dur(monu4apx iiciysls uau s;(4 eenif3todom eai olt)t2to(o3nodamtnmivsa(farum(mpnt1apen fetldlaDuln p;t) rtnxr oytfa e ieo () etm(r oodaltemfcslsfsDrr(r ;u0tlxn i3iyslm em(mp u)aetrif3oadom elueolt srtoio3oy1alte fes s s2ta(m nu4alt io3tadla emums t4altnxo oytfp e u ol() rumxr3iu1lle  nctatfsDtrur nt0oet if3tat m2emn on()treoxr3iadopD lnei t  rurirpoo4apenmiesl(farrmum ot0optoifeias s2rlnvs (4 rerxociytlatelneolt0tetrir3no4ope lncsatf Dum(rpot1oexn f3tltfm2emu snt4trxniocoo1fmt au s;s0 2umxo io1ap  lfvil(fsDrm(roou4oltoiictldlm2rmumont4alerxf oy1fpD lnes (  2tm(rpnu1lltn ivt s)aDua(rono4oee ioeiytlm el(msnu)trtoio iadfp eliei ( s2um(mpiu1op elivi t)aDtrxrpou0texo fctld s2ea(vs;u) rtnxo iotfm rlues ()sexriopoo4llt  ieilt) 2rru p;t0tetnmocias s2uanmpn(0teenir3iy1opt livo t) 2urxo oo4omtelnes (  Dtrx pno1aetnmoetatfaDuauvo;u) renmrctadoptrln ils) etmim oy1olenlfetls aDuaxr ;o0tlenii3iad a ulnvs;u4arxnxfctotopDran s;(0seurir3oodllenmnet tfsrurxm nt4oetniieiltla2ranvs;t) eeoifcoodfptean s t  euoir3ny4omenmfeiasfartau  nt0alt ifciat s rlumonu)tltomr3oadom  au ilt)t2xmxo ou1ole mict tf rra(ro;u4aeeo oeiatls el(vs (0 exomr oo1lp   uvo;(0t2urio nu4ape lncsa(fs2rrxm ;t4apt mfciyt a2um( p (0texnxocoodoaDr u s;t0texmxm ou4ole  ncsl() Dur(m ;u1aee  oetadlaDumnvsn(4tlxoxf ta1fmDr ivs (0 rtm(mpnydop nlncta( sDtr(moot1oetnmf3ildlmDrl(vo u0alxrxfctydoatr i il(0 2uo(m oudom   fvtatf Drr(mpot1oet  o3iydfs2emumo t4arenxo totfatean i t tetmxo iudal  mfvsl(faDuaumonu1oex ioctadfsDrauvs;u0artoxrctadlaD au i t srxrir3nodamen feia(  Dtmxmp;t0optoifciltlaDeauvo;u4 rtrio oodfaDeaieil()s2umxr3oodameemivslt sDurur ou1apxo iciysfs2elnmon(0tltrxrcta1fmt  ieolt trum(o io4lmtelfeil( srumx pnu0opxnio3iltlaDeanmsnt) ltoxocoa1fm e i ols  exoio3iy4apeemivia( srtrxmo;t4altn ocilsfa2rm(vs u0alxnirctadomtrlueo;t trtmxo oodam  livilt)a2raxmpou4oee  ocildlm2elnvsnu0tlermfcio1om  lnvslt)s2umiopoo1omt livtlsfartauront1alx mf3iys mDrmuvp;t0altoxocoadfp  an slt  2toxr iodlmt  fvt sfa2ta(mooo1aptn oetltfa ua(mp;t) renxr todlaD anvi;t  eumxo3nu1altemiet s) 2ur(r ;t4aex mf3ilt s elu s (4 exnmf oa1latrau ols tetm(o iu1olt  ncs sfsrum( o;u1oltnmociatlm umu s ()aexnxo oodop e u i s0 eto(r oydlm nlneiat srraxm ot4tpx  ictydlm2um(msnu4tlxnxf to1omDrlnvsls  exrxo3nydom  lnes t s2uaxmpnt4tee mf3iadfm2ea( ont4trxnxrciy1op e u i s0 etmxo ny1ll e neslsf Drmuront1aexnifctadfm2rm(mo;u)tetnmf oatlp rln i t)srtmxr3io1aleemics t)aruau oot0ape ioeiadla2rmums;(4teerxr oytopDrli s;t)sruoxm3no1opee iciltf rta(mpno4oex  feiltfaDum(vs;u) reomr oy1fm  li i;(0t2trxm oydaleemiei ( aDua(r ou0optnii3tltfs ran onu) eenmrcoy1faD  uvolt)teur(r iu1alte ncsa(fsrumxmp;o0tltn ieilt aDrauvsn(4aexnif oatlptrli s s0trxr(opoo1al nlfes t)arraxrpnu0apxo f3iydfa2ea( o (0tltoifcoo1lm  aneo;s) rxr(opnu1apt  netlt  2rm(ro;t4oex ii3iad aDranmo t)tlxomocoo1lpDrli ols srur(o iy4ol elfctls a2rr(rp;u0apt io3iltla2rau ont4arxrio oadlm  aivs;( s2xm(rpoy4om emfeilsf 2umxm nu4oex ioeiydlm2ea(vpnt0alerio3oo1lpDeluvo;s texm(mpnydomtelnvt t  Dra(  nt1alt if3iysls2el( snu0arxrir totlmteluvi s0teuo(r ou4oltelneta()aDraur ou0alxnioetytla rlu o;() leoif iy1om rlivs;s) 2toxopio1apt mictlsf ruaxrp;o1apxoifciasls2um( o t0alxnxrctatfaD  ivi;t0 2xmim3oodlpte fctl(fsrtax  ;t4optnifeilsfsDea(vo;u)arermf3io1fa r ueo () rtmxm nydlptemfci s)sDuau oot4openmoetatlaDrau o t)aleoio3oodfatrlivi;s tetrxmpiydalen fcil()aDum(moot4aeeoii3ils mDrlnvont0alenxf iydomteaueil(0trum(mpno4opeemnei s  rtmxmoot1oetnifctas a2uluvo;u4 rxrxo3iadlpD ai sls0texm(o iu4lme  ivtlt artaurpnu1aleomi3ildfsDulnvo t) lxrif todlpDeli ol(0teuoxo3nydom nlfetlt) Durur oo0texn o3tysla ranmon(4 lxnmfcoy1omt luvi s  euo(r iy1olt lietlsfa2rmx ont4tltoioctls m2uaums (4 lxrxr3iytfateai il(0teuoimpoo4ape livtasfaDtrumpou0apen oeiltla elums;(0arxoxfciydopt auvsls trumiopiodam  mfetatfa2rmx  nt0tee  oetyslm elnmpnt4 eenioctytfmtr nvi s0teum(opou4lp nlici tf rum(r nt0alx io3iat m rmnvpnt)texoxr3totopDr ies s) rtrxrpiodlm nmict tf Drmumono1oeeo f3iydfm rmums;t0alxoxr3ta1fa   u o t)texm(rpiu4alt lfctlsfaDumurpnu1aptomieiadfmDrlnvs (0altrir3oo1om ran i;s  ruoirpnu4ap n nesa(fa2um(monu0opt ifeiasfm2ra(mpn(4alenmf iydfm rlu i s t2uoxr3nudolen nctls srra(m nt4apto fciadls rmnvonu0artrxocoatfmte nvs s)s2toxmpiudllenlnetasf 2raxm no0teeoiiciyslaDemuvs u0arenxo ta1fmtrauvi t teuoir3nu4ap e ivtls  Dta(r nu1tpeoiietydfa2uanmonu0arxrir3todomD  ies t)srtoxrpiudlmenmfvtat sDtm(roou1oeto fciydlm ra( s;t0aexrxf3ty1lp rauei t trxr(o3nodamtelfvt (faDrrxmonu1ole mietlsfa rmuvsnt0treomo oy1lpDeaneo t s2urxo iu1op   fciasfsruru o;t1oeenii3iytls eanmo;u) rxrir3ia1fpt  ueo ()srxrxopoydameelfctls  Drau  no4alx ii3iys s um(msnt4artnif oatomDrlneols srxr(rpoudop nmfcilsf Dtrx p;t0tptn fciatfsDemnmpnt4 eenmo3iy1oaDran s s) rtm(m3oo4lmte net s)a2ua( pnt0aee ifetldlsDran o t) rerifcoytla eanvil( setmxrpoo1amtn nes tfsrtr(mo;u4opx  ocils m eln o;()alenmf3iadfpD  n o;(0srumiopou4amen ncs t) Drmu pnu0tlxn ociad mDrl(vonu)tlxriocoytfptr ivs;s)setmim no1ole  ietat  Dta(ro;u4tee iiciytfm2ua(msnu4texnir oy1omD  i s t)s2xmiopno1alt lncsas  2ta(mont1tpeo octad m2uln sn(0alxoir3tytlaD aieils)setm(rpny4lm emnvi (f Drr(root0oeen i3tatls2ua(mp u0areoio3iatfateaivilt setrir oy1lmee icilsf rrmxr no0aex mi3tlsfa2rlu s;u4 etomf oodomDeluei s t2xrir nudlptelivs tfs2trxrpno1ale ifeias a2ran s (0aexoxo3oodoaD  nvolt0srur(mpou4apenmies s  2umxm ;t4texomf3iadfs ua( o u4 exomrcio1lpDe n s;(0srxrim iy1lm   icta() 2raxm nt1tex ifetltfmDumuvp ()tlerxocoadoaDe nei s0 exmxr3iydllt lncias)aDraxroou1oexnmoeildfm ul(vpn(0arxriociotopDrlues s)t2ur(opno4omt lnvslt) rrr( ono4tptnmf3iys a um(ms u4aexrmf totopDraueslt setmiopnu1amt mfcsatfs2rau o;u1opeomo3iasfs rauvsnt4aleoio ootopD anes s)srtrxrpiudamtnmfvs t  2tax  ;o0alxnmf3tlt mDemumsn(4tlermfcia1lpDe nvo;(0trur(o3ou1op   icta(  2uru pno1tleomictad a2ra( o;t)aexoxr3iy1lpD livsls) 2tm(m3nu4aptelfetat a2raxronu1opxn iciaslaDumn s u)alerioctotopt  nes t)s2xmio3io4ol emnvi t  2trurpnu0olen feilt mDul( ont4altomrctotfat aieo;(0 rurxopiy4oltnlncsls sDraxrono4aet io3iad aDrmnvp;u0aexrxfciatfmDelueil()tetrio3iy4lmt lnct t  2rmxr ot1oeen iciat m rmnms (4tltoxo3to1fmDeanvo (0trurir3ou1ape mfctasfs2taxrp;t1apeoioeild m rmn p;(0alxrxr iy1laDelnvo t)texmio iydlltnmfetlsfaDrm(ro;t0aet if3iyt aDra(vo;(4arxrxoctadfa  au s;(0 rto(m3iydope mnvi t  Dtrx o;o1oeto ictlsfmDel(vp;(0texoxrciadfaDeln s s  exm(mpnudom n fvtls)artru p;t4olt iociatfs2rluvsnt0 ltnmocio1omtrlnvils)srxrxm3io1lpenmnvsa( aDrm(mpnt0teeo o3ils a2em(vpn(0tlxnmocto1fpt ai o;(0trtrio3io4lptnlfeiat)aDurxr oo4oeeniocias m2rauvp;()aeenxfciodfmD lu i (0setoio ny1apt mneiatf Dtr(rp;o1tlen octatls umn s u)aetoir io1lmtrau il()trurxo3iudale lnetlt s2ra(ro;o0apen f3tltlaDrmn s;(4tlxnxrcoodop raieols)trxoim oydolt lfvtat) 2tau  no1aex mfciltfm ea(monu)aleomf oydfate ieo ()trurio3nu1al n neil(fs2um(r ot4tpeoii3taslmDeanvpnt0areniocoa1omtraieol()t2xrir nydomeemfcias aDua(  ;o1opt mi3ild mDumuvon(0trenif3io1laD ai o t)sexrxm iy1llenlfvtltfs2tm( oot4texnifctyslsDelnmp t0tetriocia1opDelu s;(  exo(r3iodll e iesas)a2rax  nu4tpt iictyt sDeanvp ()tlxrmfctydoa  lieolt)t2uoxo oy1omeemici tfsDurump;t1teenmfeiysfa2rm(ms t)tlxnmf iatfp r nvolt0 rum(m iodamenlneias  rurxmpou0tpe mf3ilsfmDrmuvpnt) renir tadoaDelies;(0seuoxo3no1al   nvtl() rumx oou0tex mfeiad a2rlnvs;u4tltrioctytlateaivsls0trurir iy4lmeemies t)srraum nu4tpeo f3iltfa2ua(mp u4treoxo oytomtr neo;()setm(m iu4lmen ietlt)aDurxmp;u0openmiciyt s umn s t4 exoir iotfmDe nei (0srxrxopio4am emfct t)a2tmx  no4alxo oeiadls2ua( p u) etrifcia1fpt lies;t  exoio io4lmtelici ()s2rrx  nt1aptomfciad m2eanmsn()tlenxo3iy1fa elnes ()srtrxopoudaleelneia( arraxm oo1opxnmo3iydla2ul(vs u)aeerir3iatoptrln o s)texrxr3no4ape mnvtl( sDrrxr nu1olt iociasla ra(ms;u0alenxo totlmD lnvi;s0setrxr oydll n fvi tf 2rm(rpno0apxn ieiasfmDua(vs t4arerxf oatlp r ues;()srxoir oy1apte ivt t  Dum(  ;o4oet miciatfa2el( o;t0 exoircoodoaDelnvol(0teto(m3ny1ap nlfeia(  rrmxronu1aexn oeilsla2rlnvpn()texoif iotlate ues ( srxrxm iu1olenmiei sfsDur(  ;u1tle  o3ild aDea(mpn(0 lerir ty1fateanes;t tetoiopiudllte net (fs2taum no0altomfctasla umumsnt4tlxnxr3oy1omD lu i;t  2xo(rpoo4amtnmnvt ()a2tmum oo0alx  fctadfaDemnvont0arxriociadfat au o t t2umxo3ou4olt liei t a2taumoou4olt mieiad a rm( s;u)tetrxr tytlaDeai ilt)setm
\ No newline at end of file
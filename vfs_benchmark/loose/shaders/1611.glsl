@@ -0,0 +1 @@
+n s t)setrim3iodomt lfciltfsDrr(  no1aeenmociys aDumn s t) rtrxfcoy1om  au o ( s2tmxrpiydop emivta()a2uaum oo0aptnmietyslaDemn s;(4aeerxf3io1lp rlnes;t  2uoxr iu4opeemfvilsf 2ta( o;t4oexn f3iys a ua( snt)trtrmf3iytopDranes;()setrxr3io4ope lfctas aDtaxrono4opxo iciyslaDeln o;t4aeenxo3iydlmteaieils0s2urxo oy1lptelfcs t  Drau poo0tptnmf3tlt m2raumo;u0texrif oodfm  lnvols)srur(m3io1op  mfvs ()s2rrxrpnu1oee  oeiysfa uanms (0alxomfcto1om  aieols)srxm(rpio4lp elfes t)a2ur(ro;t1apto o3tatls2ua(ms;()aexnxf3oadopD li slt)srumxr nu1amtnmicilt a2um(  oo1altnioctytfa2uaumpnu) ltrxo3ootfatrlivs;()t2uoirpoy1llee nvtltf rtm(mpnt1opx mfciatls uauvp;u)tetnio3oo1faDeluvo;t0t2xrxr io1ll elfctl(farrrx oou4tee ifciltlaDra(ms u) lenif3totoptelueo;()s2urxo oo1opt  nvt s artrurpot0altnif3tat aDumumpnt0 rerircoodop  luvil() 2to(rpny4lmtelfvi (  2tauroot1opx iocild aDea(ms u) exnmoctotfa eaieil(0sexr(r3iy1olee fvs t)a2rmu  ;u0aex iictadlmDumuvp u4tltoifcio1lmt  uvs (0trtoim ou4alee fetlsf 2ur(r ot4tltn o3iysfm rmn p;()texoio3iydop rai olt)setm(r iydlp emivias aDra( onu4tex ifeiasla2rl(msnu0areoxf iydfptelies;(0srxm(opoy1ale  feta( arumump;u4altn f3iasfa2raums t)aeenmf to1op e uei s sexr(m iudol nlnvt tf 2ta(rp;u1teeniietldfsDranvpn(4teenirciatlpD aivi (0 rtr(r ou4apenmieiasf 2um( o;u1tet  ociydfm uaump;u)texrir3tydomtrluvs;( srum(m3oy1op emfeias  Dra(  ot0tptomfcild aDuauvs;u0aeenxo3to1lmD lnvilt0t2xmir3io4aptnmivsasf 2uaurpot1aet  o3tadfmDumu pnt)alxoio iydlatraueo;(0s2uoir iu4om e fvsas) 2truro;t1tptnmo3iltfaDel(ms;(4 lxnxo iydfpDeau ol(0sruo(m3no1ameemnei (fsrrr(  no4tpenii3tytls2ulumo (4trtrmf3iytlp e uvs;(  rtoxo3iu1lmee ieslsfs2raxrpoo0optn fetatfsDumnvo;(4 ltriocootoa  au i (0 2trxr ou4lltn icsat) rrrur no1tptomociysls2uan on(0artrxo3ta1fp rlivs s0seuoxopiy4om  liesatfsDtrxmpnu4opxnmfciltlsDulnvs;t4texomfcoodfmDr nes ( sexm(m3nu1aptn nvsa(fsDrru onu1apxnioeiytfa uaump;u)tlermr iytfatrai s;( trto(opou4al n fvil(f rur(rpnt0ope  iciys s2emnmp;u0aeeomf iytfaD anei;s0srxrirpoy1al nlfvia(f Dtm( pot1aexoif3iasla2rmnvsnt0 exomf tytopD  ivo;t setmio3nu1op  lnvsat)a2urx oou1tptoifetydla rlu s;u4alxrir3iy1lm rlivs;t0 2tmxopoudlp nmivtl( srtmxro;t0tpt io3iatla ulnmp;(0 etnxo oadfa eaieils s2um(m3iu1ll emivilsfsDurxm nt0apt  ieiltls2ua( o;()artnxociadopte n i;t  eumxr3ny1ape mfcil() 2ur(m ;o1tle mo3iltlm rm(vpnt0tetoifcoo1fmtr ivslt s2trxo3iodll   ict (fsDrr(  ;t1opxoifetys mDeauvonu0teenio oydlp e neils)srtmim3nu1om n ivtlt  rta(ro;o0tlenmi3tysfa2emuvsnt0arxnif iydom  an o ( texo(opiu1lltelfcia()a2tmxmoou4oleo fciytfm emnvo u0arerirciydlaDraies;( trxmxr ny4lmtnlivia(farum( pot0oee  ietldfm2eln o;u0 lerif oadopDe u o;s) 2toxm3iy1apeelivtas) 2tr(  ;o4aeeniicildfm uan o;t0 ltnxo tydfm rlu s s)s2xmir3nu4apt licsa()aDtaumpoo0apx ifeiyd mDuan p;(0aeenir oytoat  i i;() exoxrpiy1omenlnvs t)aDtm(rpot0tleomo3iysls2ra( o;(0 ltnmo tydfmDeauvs t0s2uo(r oodoleelfvslsfarur(ront4altnif3iytlm eauvsnt0aleoxocto1lmtelneolt srxm(o3ou4lp  mivsas aDrrurooo4alt  fetyd a2ra( s ()aetnmr tadopDr nes;s s2toxopny1om nmictasfsDtrxrpot4aptnifctys m2uaumon()trxrio3iadomD  u ilt s2ur(rpno4oltelnvsat srtm( oou4optniictad aDuluvpnu4 lxnxociadop eluvslt)srxrim oy4ol e neilt srua(r nu1aetoif3tasls emuvs;(4aetnio3iatlp  lnesls  euoxopiy1al  mnvsas artrumo;u4tpxo ictydlsDua(vsnu0arenmr3totlaDeln olt0s2xrimpnu4alt  neta() rtm(m nu0texomoetyd m raumsnu)tetrxo ty1fpD au i t0teuoiopio1llt  feta() 2ta(mpoo4opeoiictldlm uauvp;t0aetnxf3ia1fmDr uvilt truo(o3ny1olte feils)sDta( oot0optomictadfm2rlnmp;u) eeoif3ta1lp r ueo s0 etoiopny4aleemneia(f Drmxm ;t1aexnmocilt m2em(mo;u0arxrif oa1la e uesl(0 rumxrpio1alenmfvs s sDrrxrpot4tleoif3iad m2eauvsnu)teenir iydomte iei s)srtmim nodap nmivtat  2ua(m ;o0ope mieilsla ea(vs;u0areoifciy1lmt  ivi (0 2tmir3io1lmtemieils  rurxr ;u1tptnio3ildla2emn snt4 rermr ootfpt lnvils0 ruoimpny4olee feiasfa2trum ;o1tleoiociyd a2ranmp ()teerxo totopt an s s)t2trirpou1op  lnvsa(f Durxmpno0aex mi3tydlm rlu snu) rerir3ty1fmDraueil()s2uoxo3no4omtemfvsat a2rmxmoot4apt mieilt aDrm( o u0texomf oodlpDraueslt) exrir3nu4al  lfciatfa2uau  ou1ole mfciatlm2uanmo;(0 rermo io1lp  aivolt)tetoxo3iydlpt  ictl() 2uau  ;o4tpto fetasfm eln o;u0trtrmr3oodop rlnei;s  rur(rpio1amtemfvsl( arrax onu1oexo i3tlsfm eln o t4aexnifctotfmD lu s s srxoxo nodllenmicilt a2umx pou0apxnif3iasfa2el(vpnt)texnxf3tydfp  luvs;( t2xoxrpno1lltelfetlt) Dtm( pnu0tpt  o3tldlmDum(msnt4 lxrir tadfp eaivs;t srto(r3iudaptemfeiat) Drmurooo0ole ii3iltlm2eaums;t)trtnir3ty1fm  livils trxm(r3nodape lietls  2um(  nu0aee  oetytla ulu o;u0 etnxr oodomt luvs;t s2trim oudam  mivs sfs2rm(mpot0olenmfeiys aDel(mo u)tlxoircootfm  ln i;s0truo(rpoy1optnmnvi t)srrr(  ot0alen fctas a2rauvsn(0arxnmr3ootfate ivi (0tetr(m ny1oleemietat artr(rono1optomo3iyd mDean o t)trtoif oa1op  ln ols) euoiopio4lltn ics s) rrmxm ;u0apx ioetyt mDum(mpn(4 rxnxrctadopt aiesl()s2toxrpou1oleemfct sf 2trxrpnu1tex iiciasfs rmnvp;u4 exnxf3oa1lmDeluvilt0 exo(opny1oleemivsatfs2rm(rp;u0tlxoiietyt sDrauvs;u)teenif3to1oatelnesl(0 exr(m3iy1omeemfeil(farrr(mont1opt  o3tldlaDrauvs u0teeoif to1lm rluesl()t2urio nudll  mfet t sDtrxmpnu1alen f3iadfs el(vs;u4 lxnmo3oy1lmteaneo t0 rtrxrpiudll n nvi (fsDua( p;o4oeenmo3iaslm emnmp;u)alerircio1om rlnvs ( s2urxr3nudlmen fvt ( sDtauro;t1tpe  f3iysfmDuauvp;(4altnxr iydlm elnei s)t2xm(r3nu1lpenmfeiat s2tau ono1tltoiiciasfsDul( s () exrxfcoodlp raneo;t)t2xm(o nu4olenlfet ( s2urxroot0oet mictls mDrlnvo;u)tlenmf iatlmD au s s) etmxrpiydamtnlies ()sDrmurono0opt iocildfm emuvonu0tltnxocoodfatr n i (0t2xmxo ny1apenlicsas) 2rr(rpnu1tpeoiieiytfa rm(vont4artrxf oatoate nes;s0t2tmiopoodol e fcia( srtr( pou0teto ieiytlsDelumo;t0alxrxrctotlp raivs;s t2xmim nydlmeemfvs (f Dum( pou4texomfetasfm2eanmo;t4 rtomfctydopD  i o;(  2xoirpiydap  mfct t) 2ta( p;t0tlxn i3ilt m2uanvp (4tetoio oadfmtrli i s sruoirpiudapt mncsat sDrmump;u1tlen fctad m2el(msnt)teerxrcoatfaDelneils  ruo(r3iu4llenlict (fs2urx pnt1oet iociydlsDeanmo t) lenxo oadoaD luei t s2ur(mpno1ome  ict s a2trxrpoo0olt mo3ilslm rm(vo;u0alxoif3oa1opte i o;(0 euo(o3no4ome  nvtlsfa2rr( poo4apxomoeiys s um( o ()trxnmo io1oat ai s;(0s2xmirpiodal nlivs tf 2urxm ;u4ale mfeildls el( o t) leoxr3oatfa eaivs t0s2to(r3io4olenmivsas)srraxmp;t1aptomo3ild a2ea(vo;(0 exrirctadom rliei (  ruoxo3iy4amenlnet s artmxr nu0texomf3ildfm rau s ()tlxnmf ty1lmtraieol(0s2xmiopiy1amte nctas aDtmumoou0tlxn ieiaslmDranvp t)teermr oytoat li i (  ruoxo nodlptnmies (fs2ta(r ou0apenmfciysfa2ua(vsnu)tltnmfcoatfm eaueo;s tetrxm nu4ameemivs (fa2rax pnu0tlt ioctyt aDrm(mpnt)tetoxfcoytomD luvolt trxmim no1lptnlncta() Dtaxrpou0oexnmo3tasfm2uanvo;t0 eeomr3iotopD lu o;s t2xo(m3io1llen nctasfarrr(  ot0alxniieilt a el( o;t0 lxnxocoy1om rlu i;s seum(mpoy4lmt mneslt)sDtm( oou4oet mi3tltfaDrm( s;u)alenmf3oa1fpDe uei;()tetoio no1omen ies t  Drm(rpoo4tpeniieiltfs em(vo t0 etnir io1fptrlueols0 exmxm3nu1lm nlfctas) rtaxmpot4oleo octytfa2ra( o t)altnmf io1lmD  nvol(0seuoir3ny1ll elfetatfs2raxrpoo1tet mfciatlm2umumsnu4areoir io1fpDelivo;() exr(r3oo4altelnetl(  2ta(mp;o4tle  f3iydls ran p (4trxnif totomDe ueils0 rxmio3iy1ap elieta(  rrr(mo;o4tltnii3tltlaDrl(mo t0 rxnmfctotfateaiei;() 2xmxm3iu4lp n feslt)arum(  nu1apeo i3iydfs2rlu pn(4aexnifcoadfat lnesl(0srurxmpnydapenlfvias aDum(ro;u1oet moeiasfm ea( pnt4 reoifcio1fmDrluvslt)sexmim no4apt  fes t)sDra(ronu1aeeomoeiasfaDrlnmo;()texriocio1op  au o;()t2xo(mpoy4aptelivilt arrru  nu4tlxnioctasfa2ra(vo (4altrmr iy1omt liei;t0 etoim3nodalt liet sfartaxmoot4oee ioeilsfmDumnmp ()teenmf3totopDrauvs;t0trto(r iu1ll elnvsat arumxmpoo0oeen oetatla2um( p;(0teerif3oytfp r neslt)s2umiopny1ap  mnet tfa2rru p;u4tle ioctasfm um( p;u0alxrio tatom  livi;t0srtmxmpiydom nlfcta( srrr( pnt0oetn feildfa2emn o;t)altomr3todlm e ivolt t2uoim3iu4ap  licsl()sDtmumpnt4oleniocilt s emnvp u4tltnxocta1fa e nvi;(0sexrxm ny1ap e fct s) rur( p;t0aeto fciadfaDulump;(0arerxocoydfmte nes;s s2urxo iydlpenmics tf rrau oou1aeenmoeiytls uluvp u4artoxf todoptelnvs ( teto(mpoydom elfeilsfsrraumo;t1tpeo o3iadfs2eanmo u4 ltrircto1faDrluvi;t seurim3oo4lp elnvs t)a2tr( pou1olt mi3tyslm2um( o (0arenxf3tydlmteai ilt)t2um(mpoydoptemnvtat) 2trxr ot0opxnmoeilsla2ranvs (0teenxo3oodoateauvs (0srto(mpiudlle mnet s  ruaur ou1aee  ocild m uluvpnu4texnxr3ia1oaDe neols0s2urxrpoodll nmicsatfa2uru poo1aptoiieiysfs rm(vo;(0 renifcoodlpDeaieo t0 etmxmpnodaptelietlt aDrm(  nt4tlx  oetlslsDumnvont)teenxo iodoaD livs;s)trtoio3io4lle mfei (f rum( o;o4ape ioeilsls ea(mp;t)tlxnmr oa1oa rlu ols) exm(r nudlpt mnvil(  2rax pot0oleoiieiatla emump u4tleoxr3ootopt an olt0 2tmxo3oo1omt liesa()aDuau  nt0tpxomf3tyslaDul( o t)texoxo tadfmD lu slt)srumir3oy4ole  feiat) 2ur(rp;u1ope mieiytfaDemumo t0 rtrif3tatfmte neol()t2urxrpio1lmtnmieslt) ruaum ;o4alxoifciys aDel(vo;(0tlxomoctydfmtelivi s) 2um(r3oy1ap elfvt t  2ra( ont0apeniieiysfa elnms;t0tlenxr todoptrlu o;s)s2trir nydamt lnci s  2tmu  ot0tpt  octys s2rm(mpnu0 rxoio iodomDeai ilt0s2xrirpoy1lpe  fcil( s2rr(m nt1apto f3iyt s2el( o;u)aexoxociytoaD li ol( seto(mpnodoptnmnesat)srtrxrp;u4oleomfciatla ulnvsnu)teeoif oo1fpDrlu i s setoio3nudole liviltfa2ur(mo;o1opt ioeildfm ul( s u4aexoxf todlp eaneo;()s2trim no4llenmfctatf Dtax  ;u1oexomfeiltfmDuauvo t)aexoifciy1fm  lnvols  2uo(m oudop elnvt t)a2ua(m ;o1ape mociyd aDeanmpnt)alxomr3oytlm e uvo;() 2trxo iy4lptnmiesatf rtm(mpoo4olxoioeiltlsDemn on() etnmrciatfp eaueo;t)srumxo oy1opt liet ()srur(m nu0tetomi3iydlmDran pnt) lxrmo tytomD li s t trxr(opoydll n iei (fsDtrxmoou4opto ociasfs ra(vpn(0trtoxr oydopte uvol(0trum(opiodlp   iesltfarrmu o;o0tptomf3iysfs2em( onu)alenmo ootfp rln olt trxo(opiu1altnlfvt sfaDrmx pou0olt  feiatls rmnmpn()trtnmf io1opDrai o t  rxr(o oy4llenlnvtas a2rmuro;o4alxnmfetyd m eanvo u)trenxf oo1fa r neo;t) 2uoirpny1om nmnctl()sDurx p;t0tlxniieiltls2em( snt) ltrxf3iotoaDrai i;s sexm(o io1lme miviat a2um(rp;t4tlxo o3tat m el( sn(0artrmo oo1fmte uei (0seurxmpiu4alt livt () 2rmx poo0opxoiietltla2eln p;u4alxnifcoy1fateaivo;(0trxoir oudom e icilt sDumu o;t0opx moeilt mDrl(vonu) lenxo3ty1fpD ln slt t2xrio3iu1om nlfvi tfsDtr(rp;o4aexomi3iytlaDemnvonu4tlermfcootoa elu i (0truo(r iu4ap elivtl(f rrrx oot1opx  iciadla ea( o;t)alenircta1fpDeaieols teum(o iudlpenmfctl()sDuaxr ;o1tptnmfctatfm2emn pnu0arenmrcoytlp eau o t  rtr(m3ou4apen ieils) Dtrxmoou1tpx iietatfaDrmuvs;t4alenxf3oatlptrli o t0 exr(o iudomte nvsls)a2taurono0aet io3tas s ul(vp;u0aeenmr3oydoptraues;( trum(o3nu1llt  netas)srua(  oo4aeeo ieils sDemnvsn(0trtomfciytlmDeli o s seuoxr iu1aptnmnvsls) rraur ;u1tpx ioctltfmDel( p u) exnxr tatlpt anes;t) 2umir oo4am e fvt tf 2ra( pot1oltnmoeiaslsDrmnvo;u4aeenmoctadom rln i s0trxoxm nodamtnlnei () rrr(rooo1aee ii3iyd s2elnmp (0trerirciatlptrau o t) 2tmxr iu4ape lfvias)srtmurp;u1apeoioeiydlm ulnvon()texrir3oadfpD  u s s trtmimpnudap  lfesas)sDraxrp;o4apen fctatlmDum(vo u0 exnxr3iatomD ai i;( sexrim oydlm  lict t  rrrurp;u0teenioeiydfs2ulums;u0 etnxr tatoa rli s s0teuoim3oo4op nmfcs sf rumump;o4tpx mfciatlaDrlnvs;t)trxnir3oa1omtrlu ils) 2tmxo ny1lmenmivs ()srumum ;u1tltomiciadlaDran o t4 reoxrciydfmt auvo;t0seuo(o iy1lpt lictat)artaxmo;t1opt  ocildla umumo (0tltrxf ty1omDe nvslt srum(r oydlp emnvtasfsDtrur ;t0tpe iocilsfs2eluvonu0trtnxo3oo1latraivi;(  2xo(r oudol nlfes () 2um( pot0olxomi3tysfs2ra( sn(0aleomo3ia1fmDeauei;(0s2um(m oy4lpeemfct (f Dtrumpou1texo ieilsfm2rmuvp (0 ltomr3oadfm  aieil( t2toim3nydome lfviat)srtrur ot1tetnii3tytlm2umn snu) etrir iadfat  i o;(0t2tr(m oo1omenlnvsas)a2umur oo0alen ictltfm ranmp t4 ltoifciydlptelnvolt) 2xrxm3iy4ol elnvia()a2rm(rooo0tetn ociyd mDuluvp t0alenifctatlmt  ues;t) 2ur(mpnudlltemfetl( s2umx pno1tptnifeiysfaDua( s (0aetnio3iatfmDr neo t0s2tmio oy4apt  fvtlt aDrmu onu0oexn octadlaDeauvo;t0 lxnir iytfmt  u s ()srxo(opiydap n neslt) 2uaur nt1tptnmictasfmDranvo;t4texnmr iodfa  ln i;t) 2umimpnu4lm nmietas)arumx  ou4tpxniieiysla rlu sn(4arxnmo3iatlmD  ivsls0 etrxr io1lp emnesasfsrta(mpnu1opxomoctlt s2ean o u4tetoxfcia1oat  neolt0s2umxm3oo4am nmfvilsfaDtrxro;t0tlt  feiytlsDumn pnu)trerircto1fmtranvol( srumirpiu4lm e nei t) rur(mo;o4olxn o3iydfa2um(mp t)aetnir3tatlm eliei;t0t2xmxr3ny4ope lfciat  2tru  ;o4tpt miciytlm2ul( o u4aetoxr3ia1omDeluvs;t)srtrxr iy1optelnvtltf Durx ooo4tltniiciltfaDrmuvs;u4 lermfctadfmDeauvo s)sexrxo nydlltnlncslt arurx pnu0tpxnioetyt a rm(vsn(4 rxnmr oadla raieo (0 etmxmpiu4aptnlnet tf Drr(mo;o1alenmfeiydfaDel(mo;u4teermr3totfa elu o;t  exo(o3iodome mivi t)s2rrx  nu4openmociydlmDum(mo (0 eermo iotoa  liei (0 eurxo nodam nmncsl(faDtm(  ot1aleo ociad aDra(vs t)alxnxf iytfpD au ol(  rxoir iudlp  lnviasfaDum(r nt0opeoifetaslsDrmnms (4aeenmoctydla e uvslt) exmxrpiy1apt mfci tf rtr(monu4olx mi3ilt m2rln p t)alxoxr iadlmD au o;s)s2xmim oy1lmee fvtl()srrrxrpno0oet mieildfa2raums;()tlxoircto1op  livi;s)s2um(opoo1lpenmnet tfa2raxrp;u4apxnmocilsfs um( s;()trxriocta1omte nes t)trxo(opio4ome mietlt  rurump;t4tlenmieiyd m2el( p t4artomfctatom  li s;s  etrimpoudolte nvias aDtrxmp;t4texnmiciadlsDelnmp;(0 lerir3to1fp   nes;t t2toxo oo1lm  miet t) 2uaumpot0opx mi3tlslmDrm(vs (4areomo ty1omDeau olt)t2ur(o io4lpe mics ( s2rrumpot4aeen f3tasfs ra( sn()tltrmf3iodfat luvilt) rtr(opoo4llte icslsfs2tm(  ;u1tetomicildlaDem(mp;(4arxnmocoatom  aueo s0trto(mpnu4aleelici () ruau  ou4alxomfciyt a elu p;t4tltnmo oo1op ranvs;t)sruo(m ny1lpe mivtatfsDur(m nu1optnii3ilsla ea(mpn() lxoio3tatlaD lu s;t) exrxr oo4altelnci tfs2urxmpnu4ape moctadlm2ranmsn(0teenio3ty1optr i i (0srxr(o nudom e fctas)srra(r no0aeen oeiat s2ranmo u4tlenxr3iotlptran s;s0 eum(o3nudap n fvt sfs2ta(m ;o0opxoiieiydlaDea(ms (4 rxnmo3ty1lm eaivi t  euo(r oudamenlfvt s)aDur(  ou1altoifeiad s2rmnmp;()tlxnif3iodoa  anvi ( t2tr(mpiy1omtemfcias a2ur(r ;o4opxnmo3iyslm ua( o;(0tlenxo oodlp   iei t)texrxmpnydomee ict ( a2tmxrooo0opt  i3ilsfsDumuvsn(4 leoxociytfm r nvolt) exrio3oy1apenmiei (fsDrau p;u0alxomietldlmDuln s;t0trtomo iatlp eaneo;s) rtmim3oydomeelfeils)sDraxr nu0ale moeiatfs2raump;t0arxomf3ty1lpteluvil(0srxr(mpno4am  lfvsa(  Dtmx pot0oeeoioetydlm uln s;t4aetnio3oodomDr u i s0 2triopoy4lpeemivt sf 2rauroou0aeeo oetysls um(vp t4tetrxfciydlatraueol(0t2trim nudoleelfciatf rum(mpnu1apxo f3iydfs2rlumsn(0 rxoxo3to1lm elnesl(0s2xrio ou4lpt  feta()srum( ooo4tleniictatfaDel( o t4aetoxf iadfmD  n ils s2ur(r3iy4al nlnci sf Drm(  ou4opxomociyslm ul( p (4 rxnmr ta1fa elnvo;t)s2umir nydom e fetasfaDrmxro;u4apx  iciytlsDumumo u4tltoiocootlpt  uvi s)s2trir nydaltnmfviltf Dra(mono4altoio3iadfs2em( pnu4 eenmrcoy1op  lnvs;t)t2xoir oy1ameemnes t s2rm(mp;o4oet if3iaslm ulums u0aeeoxr iydfm r i i s0trtoxr3oy4omte ict ()aDrmu oot1alt  f3iatfa rln p;t4 etoxo tydfm eli s s)texm(r3ny1amee ncias arua(  ot1aexo ociysla2uauvp u0 etoif3oa1op  livi s0t2tmir no4ol e nes sfs2rmurpnt4apxo ociytls2rlu o;t)artnmf oa1omtr ueo;t)texoimpiu4lltn iet t)aDtmxro;t0tptnmicils m2raums;() rerxo3oadfaD  iei (  2xo(r oo1ol nlfcslt)srtm(r ;o4tpto ieias m2ulnmsnt)aexnmrctotfp r nvsl(0teto(m oo4oltnmieslt)a2um(m no0opto ietasls rmnvp t0aeerxfctadopDr nvo;s) euoio3iy1ome livtas)s2um(mp;t0alx  f3ild m eluvp u)tetrir iotomDelu s t srur(r ou1amt lfesat  rtmx  ou4oetnmfctydfa2ulnvp;t4tleriocootlp raiesls)texoxr3oudom emnes () 2tmxrpno1oet  f3iasla ul(vp t0arxnifcia1lmDe nvo;s0 2uo(rpiu4ope liviatf rurx pou0opeomietys m2rlnmp (0aeerxo3io1lateai i;s)seurio nudal  lneslt)srrax oot1aptnio3ildlm ua(mp t0 rxrxrciadoat  ivo (0t2xm(mpiy4omeemnetlsfsDrr(mp;t4optnifeiltfaDemnmp (4 rxomfctadlm  lieols0trtmxrpiudllenlicsa( srrr(r ot0olx mi3iadls2uluvon(0trxomocoatoa eai s t  exm(o3oo1om n iei s arrrx p;o1alxnioeiadfm emu p;(0arxrio io1opD  ivil()srxmim oo4lp n nes ( a2taumpot0aexnmf3ilsfs2em( pnu) rtnxf todomt  ieolt0t2xr(o iydlmeelieiltfsrurumoot4teeomieild m raumo;t)trxomf iotfmt aueslt teumiopoo4lpee fctlt)sDurump;t1opto oeiydlsDranmp;t0altoxfcoa1oatr ueol(0 2ur(r nu1ame lfesl( sDtrumont0alxn fctyd a2rmnmsnt)aetrif iadopte i o ()s2toimpiy1llenlivsls srrax  ;o1apeoif3tld s ra( s;t4aeermfcoytlpteln o t) rtoxo oo1ll  lieslsf Dtaum nt4oex iiciysfaDeanmo;t)artrxrcoodopt  uesl( srtrim ny4amtnmiet s) Dtr( ont0olto fctytfa em( pn(4 ltnmr3tatlmt  i s;s)trxoxmpiy4lpt  ictasf rrrxmonu0texomiciydfm2ea(vpnu4tleomo3iy1oaD anes;s) rtrir nu4lp   net s)s2tmu p;o1apx  iciatlm uan o;(0 rxrmr3iadoatelnvs;s t2tmim ny1ole micsas)arumurpoo4olto i3tytlaDelnmo (4 rxoif3todop eli sls sexoxmpoodol elfvsas srrmuronu0apt  ieiltfa2ul(vp t4alenio oodlm  luvo;s  rxm(r3iu4aptnlici ( artr(r ou4olx  ietltls rl(mo t) renirciotoatr n i s  rxrxo3oy4lp  mfcta() rtrxmono4alenmfeiat s el( s;(0 lxrxrciytfpD lueilt0srxm(opiudlleemnvtls)sDtm(  no4aex moctldfaDrmuvs u4arenxr3tatfaDe ivi;s  rxm(rpoo4lmtelictlt)sDuaurpou4olxn i3tatfa2rl(vs;()aetoif oatopDe nei (0 2tmxmpoy1amtn fviltfaDraxr ou4alt  fctat sDrm(ms;u) exrmr3todoaD ai i;()trxrir oo1lm e fei s) rraxrpnt0olxomiciyd s2el( onu4aeeoif iatlm  luvi ()s2xmimpno1op emnvt t)a2rrx  no1aetn iciyt aDra(monu0tlermrcoadfmDeluvs;() rxrxo3oydapte ivi ()arta(m ou4ope mieiaslaDuan o;(4aetrio3oadoat  nvo s)srtmxrpiodopt lieia() rraur ;o4tptniictad m2ulu s u0areomoctydfmDe i o;t t2ur(r nodol  miesat sDtr(  nt1opxn i3tydlm2elump;u4tlxoxr3oa1fptelies (0srtm(mpiy1ap n fvi t artmxrooo1tle moetldfm2rm(vs;u)tetrif iotfmteli o t0t2xrxr3oo4apeelieiat) Dur( p;o0aleoioeild s ua(msn() lerxfciotoa raivsls)setmim no1ol elfesa()aDrr(rp;o4opt mf3tyd a um(mo t4artoif3oatoatrai o;s0t2xmiopoudlptemneiat srrrxm oo1aeeniociaslaDranvo u)aexnmr3tydlaD lnei;t)truoirpou4lmtnmncsa(f rtm(m ot0aet mietysfs2umump t)tltnmrcoatfm eau slt trxoxr oo4omenmnciat)arrr(monu1apx  iciltla rluvo;() lxniocty1lp elnei s t2uoirpio4omtnmncsat)s2rm(mp;o0tpx mictlt aDrlu s u0tlenxoctydlp  lues;t)s2to(r3iudolt  nvi s) 2ur(r ot4openmfeiyt s2rm(monu)alxomr3ty1laD aivsl(  rxmxrpny1apenlnvsasfa2rau oou0tlen iciysfs ul(msn(4tetnmo ootlp e nei t trtmio nydaptnmicilsfs2tmurpot4alxn i3iytlaDea( s;u4 ltoifciadfp  livi;t0srtm(o3ny4ol n nct sf rtr(ro;t0olxomictadla el( sn(0aeenmo3tydop e i i t0 2tmxm3ny1opeelfctltf Dra(rp;u4tetoio3tld s2uan p t)alxriociytom raieil( t2tm(mpiu1lmenlnei t) 2rru oot1olt ifeiys s2rmn s;t4 etrmr3iy1lpDeaiei;s0 2urir3oy4ll nlieils) rtrxr nu4opt ii3ildfsDulump;t)alenircoytfmtelueslt)s2urimpiydalt lict ()sruru  no0optnii3tys m elnmp u4aetrxo3tytoaDr i o;t0trxrxo3io1al nmiesls aDumu pnt0aleoiocilslaDemn p;t4artoif3iodlaDr ueolt0 2xrirpio1lpenmnvtas srua(rpnu4oet ioeiyslmDea( p t0teenxr3oo1fpteauvo t  rtoiopnudape mncilsfs2taxroou1tpeo o3ilsfs rluvon(4 rxnmocootlmtrlieil()setrir3oodamenlnvta()arrm(mpou4oeenmfcild a el(vp u0 etoif iatfp elivs;(  rtoxo3iu4op   feils a2ra( o;u0optn fciyslaDum(vs;() lxnmf3iy1fp rluei s texo(o oy1al e ivt t  Dtr(m ot0tpxn ociytfsDrmu s;u4 etrmocootoaDrli o (0 2xrxo iy4al nlfvta()a2umu poo4olt moeildfaDrluvp;u4tltnio3io1fp  anvo ()tetmxr3nu1alenlfet s)sDtax pou0ope ii3ilsls2eln p (4arerxfciodlptelies;(  rtmirpnudllen icsat)artru  nt0apx  oeiyslm uanmp (0arerif3tytfm   ivol() rtm(rpnu4lpte fcia() rrmxro;u4texn o3ilslmDemumonu)texrio3oytlpteauvs;t0truo(o3ny4ole lfvsa() rumxmpou1tetoiiciatfaDul(vs;(0alerxo tydfmDe neils) 2urir oudapen nesls arrmx  oo4aexnmietas s2elumsn(4tleomo3iatoaD lnvs;(0 2um(m3iudolt mnctas s2urumonu4tpt  f3iydfm ranmont0aleoxf io1fm  aieols0s2tm(mpnodllt mfvtat)arrru pno1tlen ieias m2rlu s ()tlxrmf3io1lpt lu i t)teuoxo io1al  lnvsltfa2urxro;o4tleomictldfa2umnvs;(4aetoxfciy1optrlnei ()sexr(rpio1ap  lnvs s) 2umum nt1aexnmfctytla2rauvo (4 exomrcty1oaD lueo s0 exr(r iy4lpeelieiat)sruau pou1optomiciadfm ra( p;() rxriocoy1fp e ueslt0 exrim3nu1lm  mnetls arrmu onu4aetn i3iadla em(vs u0trerifcta1lpDrlueilt s2tm(mpou4ll  livtls aDrmum nu0aet ioeiyd m2rl(vp;u4 lxnxrciytfa rlieils)setm(m nudaptelnct () Duru pou4tpe mo3iyd m umnvo ()areoxf3todlateau i;(0srxrio iodll elfesls s2uru ooo0oetnioetydlmDem(vs u0tlxnmr todlpDrlneo ()tetrimpoy1om  lnvia() 2rru ont1aeen f3ilsla2rmn o (0tlenmo3oodlaDeauvs;t t2umiopnydomee nctlt)arurxrooo1aeeoiocils m2uauvs;t4arxrmf3oydfmt ai ol(0trxoxm3oodlme  net t  Dta(mpnu1aleo f3iadlaDumn sn() leoxr3io1fmDelneo t)s2ur(mpou1lm  mfcil() 2tmuro;o1aee mfciys sDumu pnu0aetnmf3tatfmtel
\ No newline at end of file
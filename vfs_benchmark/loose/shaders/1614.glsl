@@ -0,0 +1 @@
+nvo t srtr(opoy1ll elfes s s2rmurono1texnmoeiatlsDuluvs;u4trxrir3oo1lm e i s t)t2uo(mpoo1llee icta()srtaxro;o1tle mf3tlt a2ranmo () leomrcoydom eluvs;() etrxmpoodole mnvsatfartaumoot1aexnmi3ilsfs rlnvs (0 lenioctytfm  luesls) exrirpoydlmtnmnvs t arurum ou4texnifctytfmDuanms;t4alxoxfcoatlmtr uvsls) 2urxopio1op emneia(f Draxmp;o4oexn oeild m2elnmpnu0 renif to1omD  nesl()trtm(r3iy4lmtnliciat)srraumont0aeen o3iatls2eauvonu0texrxo3oatfp e i o t  rumxo3nodop elfvs t)s2rmxrpot4apxo ieiadfm2ran s t0texoxr totlaD  ues t  2xm(rpiodlpt mfeslsfsDrr(roou4aeen feiysfmDumn o (0 rxoir oa1lmteli ols srxrxr3ny1apen fcsl( sDuaum ou0tee mieils m2ul( snt0 rtoif io1fatrlieo s) exm(m iydll nmfvtas aruax o;u1tpxnii3tas s uln pnu0alxrmf3oo1lpD an slt) 2xoxopnu1oltn neiasfs2trx  nt0olx mfeiytfm em( sn()altnmo3todfpD  uvi t0teur(rpnudapt mfet s) rraur oo1oltnif3ias s eluvp t0trxnmfciotlmD lu slt srtrxo3nodolte nvi t)aDtmxro;u4opxniietldls ranvs t) lxniocoodfpDrauvs;t)s2xoxm oydlpt mfvta()aDtmxm oo4tpe  iciydla umnvp t)arenxf3oo1lmD luesl()srxoxr no1lmte nvsls  Dra(mo;t4texo fciysla eaums;(4tetoxrcoytfpt livo t0t2trxo3ou4ope licsat  2rrum ;u4tpt mictyd aDulnmpnt0 ltrxocio1lmD aueo;()trtrxm3oy1omenlfet (  Dtmxr oo0tlxomo3iyslmDulumo;(0arermo3iadoaDr nvi ( t2toio3ny1ll   nvs t aDrrumpnt4oet  oeiysfs2rmump u)arxnxr3tadlm  aivsls)t2tmimpiydom emivs tfarurur nt4oeenio3iyslsDua(mo;t) rxnio oodoaDe uvo t trtriopiudlp  mfviltf Dtmumo;t1tleomiciasls rlnmpnt) ltnif3iotlm ranvs;t)s2urxmpiudlpt lnci t)s2trur nt4aeen ietydlsDea(vp (0 exomr tadlaDraues;t0trtmxm iodamenmnvslt arrmxmont0teeomiciatls umuvp;u)arxomfcoytfmD  ieo;s0seuo(o oodll  lfvslt)s2ta( pot1oee  f3ilt m uln s;u)aeeoxr tadom rlu ols0t2uo(o iodaltemivtl()sDtr(rp;t4opt iictlsls eauvo ()texrirctotopDeanes;( srtrio3nu4lltelivsl(faDtrx  nu0aetoii3ild sDrlump;t) etomo iydlp eluei s0 euo(o3nydope mietlsfa2ua(mont4apx mo3ils a2el(ms;u4 reomfcoy1oate uvol()srto(rpnydam nmfvilsfaDrrxroou1tlx  feias s eauvp u0tlermo3iytfateluvi;t0trxr(o3ou4alt  icils sDua( pnt4apx mf3iasla eluvs;() ltrirciodopD luvo s t2umim iy1amenmici ()artaxr nu4olx ifetadfmDuln s ()trtnxfcoadfaDe uei t) etoiopou1ll emicta()sDum(mpou1opx iociatfsDemn o;u4tlxrxf3oo1lmtraiei ( s2uoxopiudol elies s artaurooo1texoioetyd sDrm(msnu4 rerio3iadoa  auesl( trtm(o no1omeelneta()srtmx  nt1aeeomo3iysfa2rl( pnt) rtrmr3iatomtelivi t0t2toxrpoy4ap elfvtlt)a2taxmooo4teeo f3ilsla rlumo (0 renxr3tytlp elneslt0t2urxm3iu4lle  ivias s2um(mont0tpxnifciatla2emump (4 eenmr3oy1fmDe ueol(0s2toio oy4om nmfcslt) Drm(rooo1oeenmfciaslm ea( p t0texrir oadfp rau s t0s2xrxo3iy4ll nmnvi s  Drm(rp;u4teeoifetld m2rm(mo (4tlxoxo iadlmDe ueilt  2trxm oodamtemfeilsfsDrr(mpnt4tex mociydlaDra( p;(4trxnxr3oydfa eaivs t)trurir3iodlm elnviat a2ta(rono0oltnio3iytlsDemuvp t0tetnmfcoadomt au s (  euoxm io1olt  fesltfa2rauront0optnii3tlt m uaumsn(0texnio3oa1fmDrai o;t  rxmxo iu4lle  ivs sfsDuau p;t1tet mocilt a rmn o;t0texrxrcoa1la eaneo;t)sexmimpiu1openmieslsfsDrmxm ot0tle mo3tls m2elu o t4aetoxr totopDeanvs;() 2uoxr io1lm   nes t) 2urx pnu4tpeoiieiyd mDumn snt4altnmociotoat anvsl(0 2tm(m ou1lp nlnei s sDurumoot1tpxnifetydla2rm(von()texnxf oodfp eanes;s) etoiopiudop  lfviatfaDurxrpou4tptnmo3iasfm el( p;()trxrmo iy1lpD  nvs;s  rtoio3iudamte fvs s)a2rrx ooo4aeeoiictls aDea( s u0 eenxrcty1fmDean s;( s2to(o nu1om e ieilt  2uaxr ;t4opt  ieilsfs2ranmonu) reoxo oodoateau sl()s2xm(m3nudllenmnctl() rtru pno0tlt mfeiaslm2umuvo;u0tlxoir3todlm  anei s0s2xoxr ny4llt  iesls sDtmuront0oet moetltfa2ua(vsnt) eeoxf to1fmteanvi t s2xm(r3io1ol nmfes t sDumx onu1aeto oeiad s2elu pn(4 ltrio3iytlp e ies s teuoxr iudll  mnvilt)aDrrxm ;o0tpeomoctatfa2ra(vo;t4altoif3oodlatraueo t0setoirpoudlmtemnvsat s2tr(rono0tet moetyslmDeanmsnu)areomocootoptelu ils0 exmxo nu1amt livt ()arrrxr oo0olx  i3iasls ea( p;(0trxnircoodomDrluvs ()t2xmxo3oo1ap  mivsls)sDurxrooo1apxnioetlsfsDem( pn()aeerxr iytoaDe i s;t  rtrio nu4oltelnct ()sruru pnu0oexnmoctas m rmnms t0 rtrmo oytfm   ies;s0 euo(r3oodllt  ics t) Drmxro;o1aeeoiietydfs em(vs u0alermo3oadfm r ueilt teto(m nu1amee fetl( artau  nu0tet mociys s2ea( on(4artrio totoa e n i;t)setm(mpiodamt  nvs s arumur oo0apxnmf3iatlm eau pnt)trtomf iotomtrauvo t0truoxrpno4op emivt t)aDumxrpoo1teto oeild m2uaumo ()trxrir3ia1faD aivo;()trtrxrpou1llee nesl(fsDumum nu1tle mo3iydls rmumonu4 rxrif iadlm rlnvsl( srtoirpou4apt mivsls arrmxmpot0tpe  octyt aDelnvo;u4tlxrxf tadfpt  nei s trtoxmpno1apeelfeias a2urumooo1ole mfctyslaDuan p ()tetoxocoodlaD aiei ( t2xoxo3nu4ll e neslsfa2trurpot1olxnifeiatfs eln sn()texnxf oodomDe iei;s0 euoxm oudlpenmiviasfaDuaumono0tptomf3iytfa rm(msnu0tltnxo tydlp rai i;( srxr(opnydolt livil(faDurx ooo0altnmicildfaDelu s;()trtnmo3iadlp elneo ()trurim io1lmtelncs s) Dtrxmo;o4tpen ociltlm2el( sn()tltrxocootlpt anvs s)t2toir3iy1al e icsa()sDtau oou4tlxnmf3iadla2ul(vp;(0alerxo to1fateai ils0 etrxr3ny1ol e ivs t) rra(r ou1aptn f3tls a eanvs;t0aexrxrciydlat  nvo;t) rxoxo3nudopenlnvs ( sDtaxroot4ole ioctlsla2ra(mo t)arenxo oadfat ai o () rtr(mpny1lm e fctasfs2ua(mooo1olxoii3ilsfm2ra(vo;(0 ltomrctodlm  luvs;s) exmir3oydolenliesls  2uaxr ;u1oex  f3iadla2rmnvon() lerxf3tatomtrai ols  exm(mpiy1ome  nvil()sruau pnu0tpxnif3iadla2uln p;(0treoir tydfm r ueo s0 rtmxm oydamt mieilt sDurumoot0tpt mietyt s2ra(mp;(4 lermfcoo1fptr i s s) exmxm3iudomtelnci t  rumx onu0tlt  ieiydlm2uln s;u4 etomr3ta1omte neilt0teuo(rpny1am elicsl(f Dum(rpnt1aeeo fctld m uauvsnu4artoif oy1lpDrlueo;t0 2urxr ou4omte icilt a2uax p;u0alxomfcilt a2rl(vpn(4 lenmfciotoa elivsls)srumxm iu1al n iciasfsDra(mpou1opt mfetat mDuanvs t4aexrircoadom e ivo t0t2xmxopoy4ole  ics tf rurxm nu4oexo fciatfsDuaumonu)tltrif3io1oate iei s0s2umimpoy1lm emnesa(fa2rrxrpno4olenmf3tat m2rlnvp;u4altomr iy1op e ivolt)s2trxm3nu1lle livi sfs2uaxmono0oexomfeiytfsDeauvsnt)texoxf3iydoatean o s0srxm(m3oudamtn ncs ()sDurum no4tlx ifeiltla2uluvo;(4 rxrxo3tydoptrli o s)sexm(o oudop  mieias s2tmu onu0tetn oetydfm uaumpn(4trerifcoo1op e i sl(0 exrio ou1llee ieils) 2ur(  nt0aexnii3ildla eanvsnu)alxomf iotfaDrln ols)setmim iodam e fetat  Drau  ;o1tetomiciyslaDrlnmpnu0teenif3totom  anei s srtrxo oodameelfciatf rtrx p;o1tlx mieias s2rmumo;t) eenirciytfp r n s;()texrxo nu4lltn ieslt)sDtm(m ;o1aptoiiciasla ulums;t4 exrxfcoatlaDe u olt)tetmxr iy4op elics t a2rm(  no0texoiiciltls rmuvp;t4arxoxfcoydop eanvi;()t2xoim3oudlmtnmfvi sf rtaum nu1olto f3ias s2eauvp t)artoircoydlateai ilt trumxo3iodapen fetlsfa2trxrp;o0altn ieiydlm2elnmo;u)artrmr3iy1lpDrlueil(0 rtmir3oudol  lncsa( arur(rpot4oexnii3ilsfsDran snu0arxomo iytfmtrln i;s  2xoim3oodlm n nvt t)aDtru poo1tee  f3tyd s um( snt) rxrir tydlaD lnvo (  rurir3iu4op e nvtltfarua( p;t4ale mfctad a umnvsnu4 lerxfcty1laDrauvsls  rtm(rpny1apt lnvs s) Draxmp;t0tltomfctatlmDra(mp u)trtnio3oatfmt  ues;t0 2xriopou1lmee nci t  2uauro;o1olt  fciytfaDeanmo;()artoio iy1fatr iei;s) 2uoim3nu4opt  feta() rtaxmo;t1apto ieils sDea(vsnu4aeenxrciy1oa rauvo;t0s2xoio iy4omen nvt t srraxmpot1open ictas s ea(vo t4tltnmf3oa1latrau o s  2umir3ou4lpenmivia(fs2rrx poo1ope  fctat a2emn o;u0trerio3totfat  ivo t) exr(o oo4lm emnet (f 2tmxront0oexo o3tyd s2el(vp t4altoir3tatfpt  ueilt0trurxo3nudaleelfetltfaDtmxrpot1aetomietasfsDuanvs;t0alxrif3ia1oaD lieils texrxm3ny1amenlncilt aDtaxr nt0aetn octls aDuln pnt)trxomf oodomDeanes s trumim3oudlptnmncslt) Dururpou1apx  f3iysfa rau pnu) rtrxrciy1lm eaivs ()s2xoim nudll  lnetls)arua(  oo4alenii3tyd m raumont4trxnmf iy1oaD auvi (0texm(m iodamt  fvs sf Drr(  no4tltnmfeiad sDemuvo (4aexrmf3io1opD an s (  etoiopoy4op nlneilsf 2tr(m ;t0oee mi3iydfa rmu p (4tlenmocoo1lat  i o s) etrxrpnudoptnlnvtls)arua(mp;t1oet iiciyd aDeanvp t4 lxrxo oydomtelu sls  2umxrpnu4lltemnvtltf 2rm( pou0oee  fetlsfa uln p;u4 etrmo3todfm ranvs;s  eumirpiu1ol n fvi (  2umump;u4tet iiciad sDumuvs t0 rermf tatlp rlnvils0 2to(opou1am nmfcs sfarumumooo1oexoii3ildla2rm(mpn(0aetoifcto1lp rlivols0srto(r3no1optelnct t  Drmxm ;u1oeeo o3tlt m rm( o (0 exrmf oodfpDrlu ol(0t2to(o nudolt lnci tf 2ua( p;u1alt iieiydfm umnvsnu0tlxrmrcoa1fmteaueo (  2xoir3nudopt lfci t) 2taxrpoo0oexnmf3tasfaDrau o;(0trenmocoydoaDrln ol(  rurxo3iy1alenlfcias aDrm(m ot0tee  ocils m2rlnvpn(4altoio3iadfpDr iei s) 2toimpiu4omtn nvi ( srrmu ont1tpx iictysfm2um( snt)aexrir3oatfaDelivs;() rtmio3ny4om  lfcslsf rtaxmo;u0optn feias mDrmuvp;t0arxnxf iadoptrlnvslt0seuoirpnu1altelneils)a2uaxmpnt0tpeo feias a uan p (4 exnxr tytomD  uesls srum(mpoodamen ictas)aDrax ont1oeenmieiyd mDeaumpnt) lermocoatopDe nes;s  euo(mpiudlm   fviltfa2rm(r no4aleoiiciad aDuauvp;(4 exniocoydfaDe u s;s trtrimpoudal   fcs (fsrrmumoou4olxn i3tad aDuluvpn()trxoir3tytfpDeau s;t0teuoir iodlp  miei (  Drmxmp;t0tee  oetls s el(mo (4 etnmo3iy1opDe nvi s0 2trxopny1ope  ncs (f rumumpnu4tptomi3iasfsDranmonu) eermo3oodoa eliei ( tetriopoydap e feslt  2trx pou4ope mietydfm2emnvs;(0trxrxoctydomt anes s) rxrio3ou1apeemfcsls)srta(ro;t4aleo oeiydfa2um(mo;t) rtnmr oy1laDeli i;()sexmim3no1amt mnesa( arumx p;o1tet  ieiat m2elnvo;(4 lenifciodomDrln slt)t2urxr3oodameemneias  rrmx p;t4aetoio3tyd s2uan o;t4 etrmfcoatfmDr uvo;t  2tr(m nydom  lici t s2rmumpot4texoiociasls2ra(vp;u4 eermr3to1faD auei;t  etrxo iydale  fet (f Draur ot4alxn o3ild m rl(msnu)artoircoo1lmtr ies ( s2umxo3oodll nlicta()aDtmuront0tee  ieils m2rl(vp u)teeoiocoa1lpDe ivils0trtoxm no4alee iesls)aDrr(mpoo4tpe mo3iat aDemuvs u)tleoxr oodfmtelivilt s2tr(m nu1lpenlfct ( s2rrxrpoo1alt mfeilsls2emn s t4teermr3tadomDeau ilt)texrir3oydapen nvtls  Dtm( p;o4alenmi3iadlm rmu s;(4arerif tydoate ueo ( teuo(r ou1lme mfet tf 2ra(mp;t4oltnioeils a rm( p t0trtomrctadfmteauvo s srxrirpnydom nmfviasfaDum( p;t0ole if3ilsfm2umnvonu)trenmf3to1oa  luvi;(  euoiopou1ap nmnvt sfa2urxr nu4tpeoifeiadfa eaumpnu0aetrmf ia1lpDe ieo t)t2um(o3nydamen ictas s2rmx  ;t4altn ieilsls2uan s;t0 lenmr iy1omD aues t) 2urio3iu4olenmfci ()srumumpno1opeo oetad mDul(vo;u0altoir ty1la  lueol(0t2tm(rpoy1ll nmicsat  Dra(r ot0tleo oeiad s2rl(vsn(4 rxnmociytla r uvi () rxoxr iu1llenmivsatf Durx poo1optomfctadls2rmu s t0trxomr3ta1opDe uesls s2xr(mpiodlltn nvia()sDraum ;t4tpen ieiaslm2eau s u)tltnmrctadoa   neol(  2tm(o3ny1lmen ivsls)a2urump;t4teeoifeiysls2um( p u0tetrifctytop rlivo (0seuo(rpny4ol n fetlt srrm(rooo1ape  o3ildfa2rm(ms u) lenmr todopDrlu sl( t2xrim3ou4lltnlnvs t s2ua(m nu1aexnmictydfm2ulu s;t4teerio ta1lm eluvs t0t2tmxo3ou1op elietls s2ur(  ot1alto ieiys s rau onu4 rtnircootopDranvs s)t2xm(mpnu1om   ncs t)sDrm(  oo1texomoeiysfmDrlums;() eenmr3oytla   ies;t0s2xoio3iu4om  mfes s)s2rmxrpnu0alt  ocildlmDul(msn(4 lxnif tatlpD  ueo;s0trxoio3oo1ole lfcsl(  rrrxrpnu0tpt mfctltfmDuaumpnt0arermf3oo1fptr ues;t)trxoio no4ll n icils) 2tau ono0olxo fctytfsDemump;t0tlerxrcoatlp r uvo;s) exm(r3ou4lltemfet tf rumx pou0oexo i3tldfs uauvs u4tltnir3oo1lpD lnvs (0 2xr(r no4lmtemiesasf rua(rp;u4oexnmo3ildfm2rm( o u4arenmf ta1fm eanvo (0 etmxm iu4op e ieslt)artrxmpno1aetoioetatla rmums;(0trenmocoy1opD  neil() ruriopny4opt mfct tf Draurpou0alxnmoetysfm2ulnvo u)texoir3oodlm eai s ()s2xrir3ou4ol nmfeiat aDraur no4alxo ictasls ua( o;t) rtnxocoodomtranvs;t seto(r io1lpte nctas)sDrrurpnt1alxn iciaslsDem(vo u4alenmrcoy1lp rlu ils)truoio3oy4ame mfvs s sDtrump;u1apeomiciasfs2umuvpnu0aexomo3iydop  lu i ( srumim oy4lpt  nes (fa2tmumooo4aet ii3iys sDrmnmon()aexnif3oodfaDelneilt)texrirpny1al  mnetls sruaxrpnt0tlenifetlsls emu pnt4 eeomfcio1fpDe u ols) rumio3io4ll  micsls  2tr(r no4tpx mfeiys m rm( o;u0 lxomrctatoatrau slt)setoxm3oy1lpenlnci sfarrmxm nu4oexn o3iysls2rmnvo t)altoxr oadfpte u s;()s2to(m iodamtelfcils) rtaxr no4oetn ietlsls2uanmp t4 etnxf ia1lpt an s;(  exrir3nu4lltnmneilsfaDraxrpno0alt  i3iydfm2rluvsnt0 ltnir3oytlpt lu o () euo(mpiodolenmfcilsfs2ur(r ;t4tlx mfciyd s rmnmonu0treoxrctotomteaues;t s2toio ou4al nlfeil(fsDta(ronu1texniociydfs rmuvsnu0 rxnif oatfa eai i;t0seurxm3ny1optemnesas) Dra(moot4olxn i3tysls2uluvpn()trerxrciodfa rlnei;t0sexo(m no1al emnctlt  Dtr(  ;o1olxo f3iytls2eluvo;u0alenifcoatopDrlivils)srto(o3oy4oltnmivslt)a2tm(r ot1opt  ieiyt s2uaums t4aetnmr totop eli ilt setmimpoy4lle mfvt s)a2uaxr ;o4aetomfciatfs2rluvs;u)alxoifcto1oate uesls t2uo(m oo4lm e ncias) rrrx  oo4aet  ociatla um( s;(0altnio oo1fa eluvi;()trtrim iodop   nvi sfs2um(moou0opto feild a uanmpn(4altrio oodop rli olt  rto(o3oodomtnlivtatfsDtru  ot4aexomoeiyslaDuau ont4treomrcoatoat livs;s0s2ur(o oydoptnlnvsls srtaxmont4aptn oeiytls umums;t4tetnxf3io1lpt ln s;s0t2tmxo3ou1lmtnlncs t  Dumum ;t0opxoiietydfm2eau s;t4treomoctotlptelues;s)s2trim nydal e fcilt  ruau  ;o0tlenmfctlt s2el(mo (0 exnmf tydlaDr neil(0seuoxr oodop nlfcsls) 2ur( ooo1oeto o3tlt a ulnmo;u0tltnmrcoydfa eau o () rxo(o3iy4lm  mfci (fartmxmpot4opt  feiytfsDrlums (4tltoxr3tydlm r ueo;s)tetmiopny1omenlfcs s)srua(m no4aetnii3ilslsDul(vo;t)tetoio tytfa eaies;()setm(rpoo1ame mivs (  rtrurpou1teeo oeiydfs2emnms u4aeeoifcoydom   nvolt t2umxm iu4ope  fcsasfsrtaxrp;u1tetoifetadlsDemumonu4 rtoxo3iydlaDr uei ( s2xrir3io4lme lnvtlt  Dra(  ou0ale mi3ias m2ra(mo u)aexnxrcoo1lmtraivs;(0 2tmirpiy1ope mict s) Duru  oo4tleoio3ilt aDra( ont4tetrxr iodfaDrlu ol( s2tmim3no4aptnlneilt  Drrxmpnt1olt  ietadfm2ranmp;t0altnif3ty1om eanvo;()tetr(o ny1lptnlfvs ()aDumur ;o0aetoio3tyt s2rmnmo;t4 exrmf oadlptrln i t)seur(o3no1ame licslt) rrr(mpnt1opxo iciatfa2ua(vp;u)alenir3oa1lmtran ols seur(r3oy1lmtnlfvs s sDur(rooo0opxoiociytfa2uau p u)altomrctydlpDr uvi;s) rxm(rpiy4lpeelivslt  Drm(  ou0oex  ociltfa el(vo;t)trtnxf oy1lp e ieolt t2xr(r3oydope miviat srrr(  ;u1tlenmi3iad mDranvs t)aetnxfciadfp ranvil(0 euoxm3no1altnmfvi s  rum(  ou1aleniieild aDel( pnt0artnmrcoatfaDr uvi;s)trtoimpio4ap   nci s  2ua( pno4tlto iciad sDulnmpnt4tlxrif3tydoa ean slt)sexrimpiudamen iesa(  2rm(mooo1tlto oetas sDem( s t4trtrxo3tatop ranesl( t2um(rpiodaleelieils)srumxmp;t0olxoifctlsla ulu o;t)aetnxo3totlpD  nvs;s0trur(r nudlm  licsl( arumx oot4alxnmictytls2umuvo t4 rtoio3iytom   nes (  ruoxo3ny4optnmncs t a2rru pno1aeeoiictadfsDrl(vp;(4texrifcoa1fate uvols s2umiopoydoleemfet (f 2urxrpno4texo fetas s raumo;t) etomf oo1opD auvo s0 exmxopou4lmee fctlsfsrum( p;u4oet mociysfs2uau snt) etrxr ootomDe uei s trurxrpoy1ll elnvtls  2rr(rpot1alt mictaslaDrmu pnt) lerir3iotfp elueil(0t2trirpnu1open nvtl(fs2ra(rp;u0opt  oetytfs2elnvo;()tlenif3to1oateau i;t0texoxo iu1amtn fvtas arrmx pnu1tpen i3ilt sDean p;t4 rtrxr3oatlp raneol(0 etrim3no4ale livta( sDra(monu1opxoiietydlm rmnmont) eerxf3oodlpte uvs;s0 exmxm oy4ll nlnciasfs2umxr ;o0opt  i3iyd s2ra(ms;u0arxrio3tytfm  lu i;s0sruo(m no4amenlfcsls)s2rmxmoot4tlxn f3tas m ua(mpnt)texoir3iodfp rlnvsl()t2xrxm3nu4lpt lfvs sfarurxrpnt1tleoif3iysla2rlumo t0artomo3ty1fatr neolt s2umio3nodamtn ietlt  rrrur no1tlxoio3ildfa2ul(vsnt) eerir3oydoptelivi;s)s2xrxmpny1amt mict t aDur(m nt0oltoifetltlm ulu onu0 rxrir3todfatelu ol( trtmio3nu4altemfvsls s2tr(r ;u1oexn iciys a rauvsnt)tlxrifcoy1omD  ieols0sruoxr3nu1olenlnctl() 2ua(moot4tptoiictadlmDean o t) eeoxocto1om raivslt texoxrpnu1am n ivt ( sDumx  no1teen i3ilsfaDea( pnt4alenmf totopDeaueil()t2xr(m io4lp emncs tf 2trumpoo0tleomfetad sDea(mp ()artomr3todfpD lies;t0trtmxm3iu1lmen ncslt  Dtax pnt1tptoiieiytfa2rm(vp;t) rxnir oy1la  luvols0sexm(opiy1op e nctas s2trx o;u1tltn octlsla2elumpn()tltomr oo1fpte i i t) euo(m iodlpe  nesl(f 2tax ont1tpeo f3iltfm uau o ()aetrmfctatlpD lnvo ()teumir ou1open fei sfa2rmxr ;o4apt  fciysfm2ea(vo t4 eeoxf3tydfmtran slt t2xo(rpoy4llenmfctl(  Drmx o;t4ape mieiyd sDrl(ms u0trenxfctydlmtelnes t teumxr3iu1lp e fesasfa2umump;u1alxomo3iyt s2uau o;u4arenxo3oytfpt  neils) 2xrio3nydlm n fcs () Drr(moou4oet  fetasfmDrmumpn()alenxo3tydoatrai s;t0s2uoxmpoy4lpee ictas)arua(ro;t1tle mieilsfs2elnmsnt)teeoxr3oytoaD  uvi ()trtmim nu1aleemfvsl(f rtru o;u1oex  ietldlmDeanvp;u)aeerirciydoaD lu i t0seurim3iu1am emfesls srrrxr ;t4opx  oeiadlsDumnvo;u0 etrxr oo1oa rln o;s srumxo oodlmtnmivtls)aDraurpou1olx  ictls m2uluvo;t4trermr3iatfpDr ivo t)srxo(m3io1llee ics t a2trumoot4aleoii3tyt m rlu pn()trenif oatomD lnei t0t2xrir3oy1lmt  iet t  Dtr(moot1teenmieiys s2eanvont0teenxf3tatfptrli s;t trtrir3ny4oltemics t s2rru ono1tle mf3iad s2eaumsnu0teenxrctydfptrlnvsl(0 2tmimpio4ll n feil(f rrrxm ;u4altnioetldla ul(mo;u)trerif iodlmtelieo;t t2trxr3nu4alenlivtls)a2rrurooo1tltnmfctls mDea( pn(4 eeomo3oa1la  lieil() rurxr3ou4ale lfci s sDraxrp;t4oeeoifeilsfaDemu s u4altomfcty1lmt ln s ()s2urxm3nu4aleemivsat)s2uaum ot0altnifetyd aDrm(vp;t) ltniociadoaDran s;t t2umxo3iu1am nmivt t  Draxmooo0texoiieild a rmuvp;(4alxnif oydfpDe i s;(0srtr(m nu1om nmivs (f rtrum nu4aet miciasls2ulnvo;t0tlxnifcoa1lpt ai s t  rtr(rpio4lpe mneslsfsDrmxrpou1tetnio3ildla2el( onu)tltoxf3oodoa eauei (0s2urio3nydal   fvt (fsDtau pnu1tpxoiictytfa2ul(vp (0 lxrirctotoa elivi;(0 rumxm oo4oltnmfct t srrrxro;o1apx ifctytlaDemn s (0aeeoifciy1lp elu i (0seuoxo no1apte nvtl( arumxm ;u4oee iociadlsDrluvp u4alerifcto1fatrlu i (0teur(r3nydllen feilt)srum(mpno1aet moetyd m2eanmp;t4areoxfctatfm  aivols0t2umxrpoy4altn fvta()sDrrxroot0aee  ieildfa uln s u4tlxoio3iydomD aueslt)t2xr(o nodole  nvtl( srumu pno4alt  o3tltlsDelnvp;t4trtnircootlpDe n i;s srtrim3nudlpt miesatf Dua(ro;u0tleo fctltfa2ra(vo t4arxrir oydoate i olt)trtrim oy4optn fvslsf rtaxrpnu4oltoio3iltlm eluvp;(0tetrircoy1fmDr i o t)texoir ou4amt micsatfaDuaxmpnu0tlt ii3ildfa2umu p;u) lxrxf3iatfptraivilt s2uoxo3no4omtemfetas sDumuro;t1tltnmo3iysfm ul(mo ()trxrxr oy1fa eai s s)truriopio1oltn ncsatfsrrau p;u1apxniiciysfa2rauvs t)tetrioctodlm  anvol()srur(m3nodomtelivsl()sDtaur nu4teenmo3iysfm2emnmp t)trerir3ty1fptelies;t srurimpoudlmen iesat)aDtmxmooo4opto f3ias m2uauvp (4aeerxrcoatom rlu s t trxmiopiydlpeemfei s) rta( ono4olx  ieiydfa2ulnmo u) etrmr3iy1lp rlnvi (0trtmxo oudam e fvs t)srtax onu0oee miciatlaDrl(ms;t0tetrxo oadoateaueo;t)s2tmxr3oo1alt  ncsls srrr(mp;t4apx ioetatla rlnmo u)aexomrctydop eau i () rxoxopoo4lmt  ieta() 2umx pnt1oetnifcilslm2umnvp;(0 ltrmo iatfatean ils)seuo(o3iudlm n feils a2rau o;u0tetniieiasfa2rmn o;t4texoirciadfptraivo s0srumxr3oo1ome micilt a2ta(r nt0aeeoiicildlmDemnvs u0tetnxr3tadfm eluvs s)seum(o no1alenmfeta()arur(r nu4aleoii3iyt s2ea(mp;u4artomfctotoaDeaivsls0t2uoir ou1omt lncsa( arrm(m ot4oetn feiad m umnvs;t0trtnmr oy1oatean i;s seuoxo3oodomtelivilt sDtm(r nu1olto o3iasfs2em(mo;()altoxoctydlptraivilt0texmiopiu4lm  lnci s srum(mpnt0tlxnioetlsfmDrluvs u) ltoxr oy1fat au o;t) rtrxo oy4lm  lnvsa(  Dtaurooo0aleniieilsfa2umu snt4artnxrcoydoatrauvols truoim oo1lmt mivs t sruax  ;o0texnmieiatfs el(vp t4tltoif totomD  neol()trum(m3nodap elict s)srrmumoou0altn oeildla emnmp (0 rermr3oy1omteln s;s0teto(mpnydomt  nvs (f 2tmu ont1apx mfeiysfs ranvo t)aetnxf totfmD anes;s srxriopoy1alt lfct (fa2urx pno0tpe ii3iys mDeln o (4aleoxo iatfpDe nvs;s tetmxopiy1ape mnvil() Dum(rooo0olto i3ildla2rlu pnt0aetrxf iotlmDraivi;t t2xm(o3oo4olenmieil(faDta(m ;t1olxoiiciytla2uln s;t)aeenmf ootomt  u ol(  etmimpnu1lpe  nvt tfa2rruroot1tptnmfeiydlm2ul( snt)trtoxo3tadfpt ai ol(  rurir3nu4lmtn nvi () 2rm(ro;t1oetoifeiltls emn on(0texnircoytomt aiei;s teuo(r3io4op nlneilt  2rrx p;u1teenioeiadfs2ul(mpnu4aeeoxfcoadfmDelivi t0srtoxm3oodop  miesas sDtr(  ou1ope mf3tadlmDuanvpnu) eenmf tytlpDraiesl( tetmxrpiy1ome  nvsl(  rraurpnu4tpx mictyd mDulu pnu0 lxnxo3iatom r nvi t)seurim nu4lmtnmfcs s  rrmx o;t1texomo3tytfa2um(vs;t0 renmo3oo1om   nvo s0seuo(rpiydal elnvtasf 2uax pnu1tet moeildlm2rl(vs;()areoxf3io1fp r nvi t sruo(mpno1amt  fci sfsrrru o;t1open i3iytls ra(vs t0altrxocootfp  auvi;t0trtm(rpio1apeelivsltfs2rmu pot1tlxoif3tltlm2rmnvpn(4tlxnif3ta1fp  au s;s)s2uo(m3io1lm emicslt)sDtr( pnt1oltniictyd mDrau o (4 eerirctadom eanes s0s2ur(r3ou4aleelivtls)srurur ;u4olt ifctasfm em( s;t) rxrir tadoa r i i t0 eto(opnodlp nmncs s  2rrxmpnu4tlxo fetlsfsDrl( p;u4 rxoirctydoatelu s;t)t2xmirpny1lm  licsas aDrrxm ;t4alen icils sDea( o;u4arenmf3tadlmDrlnvs;s0 exr(o3oo4amte netltf 2rrxm ;o4tlx  ociys m2umumpnu) etnxf todfmDranei (0srxm(o3oo4am  lfesas)arumu  ot1alx mieiyt m2uan p (4trxoxr totoateai i;s0trxrxr io4lme mics sf rtrurpnt1alxoioeiydla2rluvpnt0tetrio3io1laDrliei;()tetm(opoo1oltelnesa()aDum(rpnu4ole  i3iatfs rm(vo;u4 exrif oo1omtr ues;s0srtm(m3ny1ome  neil(  Durumooo0optoio3ias s ul(vs u0trxoif3ootlm   ivs;t sruo(m nodal n fctl(  Dumu pnu0olx moetys sDua(vs;u)trerir3iydfpteln ol(0 2urxr3iu1omeemfvilt arraumo;o0apeo oeiltfs ean s;t4areoxf io1lp e neslt0 eumxr3oydolenlnvilt)s2urumont0alx io3ilsfmDemumpnt4 eeoxocootoateluei ()s2toxm iydomee fvtat a2urum ;o0alxn o3tadlmDrmn p u)trxrxo3tatom eluei;t0s2ur(opoudapt  iesl()s2trxmo;u4tpt mfeiad aDul(vonu0 ltniocia1fa eanvilt0 rxoxm3nu1op  liciatf rtmxr nt1alenio3tldfmDrlnmpn() rermrctotlm   i i;t srxrim ny4ope lfvsa(fsDurxront0tpeo i3tyt mDrln on(4alxnio oatopDeli i;(0trxo(o3iy4om n neia(  rurxroot0tpxniicildla2uaumo t4 lxnif3to1op elieol( sexmxopny1opeelfci sfsrum(m ou0aex  o3iys m el( pn(4artoio3oytfate uvo s)srxoio oodop nmicils s2trx p;o0optnioetat a2rl(vs;t0trenmr iy1opDeaieo (0trumir3iu1ll elfvt s)srua(r ;o4oetn fctyd mDem( p t0altrif3todfp ran i;s)t2xrim3oo4olen icil( s2uax oou0aet ifciadla uanms (4alenxo3oy1oaDraiei () rxrir oo1aptelicia(fartaumo;t1aex  i3iytfsDuan p t4trtomociadlpDranvol(0trumim3iydll  mncsa(fsDua(mpou0oeenifeiaslmDulnms u)aetnmr tydfp ranvo;()s2tm(o ny1lmtelivsa() rrmxmo;u4tptnmfcilslsDumnvs u)arxoxo ta1oat anvs;t) rtriopoo4alt lnvtat  Drrxmooo0oltnio3ildlm2rlnvs;t4 leoxrcoatfat anvsls0 2xoir3ny4lptelies s  Drm( ono1aet ii3ias m2emu o u) etrmrctatfatr u s t) 2trxo iu4op e fei ()srrmurooo0apenifcild mDumumo;()teeoir tadfa e nei;t0teurirpoudol nmieil( s2tm(m ;o1alxo o3ildfs2em( o;(4 rerxo3oydlpt luvs;s0seuoxr3iu1llenlivias  2urxr ou1altnmf3iyt a2ul( s u0 lermfcootfmtrlu o ()trxr(m3iydopeemnctl()s2rrx  ;o1tptn iciasfm2ulnvsnt0 rtrxr oydfaDr uvo;(0 ruoxm3oy1ope mfvta() 2urump;t0aetomfctldla2umn snu4 etrmf io1lm elues (0truoxr3oudaptn ici (  ruaxrp;o4apxniociytlaDuluvpnu4alxrirciytoateli i;()trur(rpio1ap  livtls)arraxr nu4olenmo3iyt sDrlumsnu)tlenircoa1oaDe n o () 2umxm oudaptemietl(farumx  ot4apenmo3ias mDrm(vo t4trerircoatfpDrlnes () eur(mpiy4lp  lfci t)arraxmoot4ale mi3tldla rm(vs;u) eerir3io1lmDeauesls truoiopiydoltemictas a2tm( oot1ope ii3iltls2rmu p;u)tltnxocoydoatrai ol() exo(m3oodol nmncias srrr( ont4olx ii3iltla2rm(vonu0teenmr to1opD  u o t truo(m iydomte ivt sfsDtrxmpnt0opt  fctlt s em( o;t0arxoxoctadlp rauvols0 rumio nu1lp   fvs t)s2tm(  nt4apt  o3iyd m ea( s;t)aleomfctydfp r nvi s0setoimpio1lpt  nci (fsDrru poo4texnifeiydfm emnmpnu)tltnmo iadlmt lu o t)trtmim3oy1am emiei s)sDtruroot1tetoio3iatla ean s;t) rxnxf3ty1lpDe nei;( trxrxo3iy4optemicsatfaDuaxmooo1altomf3tld a ul(mpnu)trxoircta1oaDr nvilt  rxmxo iydll elivsasfaDuaurpnt0optomoctys m2um( snu0tlermf3iatoaDrli i;t0texm(r3io4lpt mfvt t  Dum(mp;u0openmfciydla2raums;t) rtnxfcoa1fpD aivslt)s2tm(r3iy1amt liesls)sDrrxmo;o4tpxnifeiydlmDrmn o;()aleomfciodoptelnvil()texrxo3oy1amtnmivs (f 2ur(m ou0tltnmfeils m ea( p (4arerxo3totfptelu ols)srumxo no4apenlivias srtr(mpou1oeeoifciydlm2eanmont0altrif to1om   i o (  rtr(r nu1aptelictat sDuax poo0aptoiociys s2umuvpnt0trxnif oadlmtraivi;t0s2xrirpoo4lmee fctl( srtax o;o4altoio3iysfm uaumo t0tetrxfcoydlptrlueo s0 rxrio oo4aleelicsatf 2urxmpoo4tpe mi3ild mDulnvsnu)artnxrciydlatrlu il(0 exmxmpoydam  lneslt aDta(  oo4tptomfciytlaDem( p;(0teenmf oodlpD li o;(0seum(o3oydop nlfesl(faDum(rp;o4tlenmo3iadlm2em(mo;t4 rxnmo3tytoatrlieils0srurxm io4opeemivsl()srraxmpnu0tptoiieildlaDuau o u0tlxrxf iy1oa e i i s0s2uoxr3oo4lpt lictl()s2rm( p;o4oee ioeiyslsDeau o (0 lerio3oy1fm rln ils)seuo(r nudom  lfctat  Dtmxrpnt0tpxomf3tltlaDea(msnu)aetnmo3iodfa  ln o;s0trxrimpnodop nlfetasfsDrr( p;u1aeto iciltfm2rauvs u4aetrxrcoytopDrau i;t trumio oodamenmiet (f 2rr(mono0aetnmfctat aDranvo;u)tetomo oodoatr ieils0teurxo3iu1ll emivia( a2tr(rpoo1oexnmi3ildlm ra(vp () lxoir3iadfptelnvolt s2uoxopnu4lle  fvi s  ruauro;o4ape  fciatla2ua( snt0aexoioctytfp eauvo t)s2umir3iy1op nlfvi ()artrxmo;o4apt  ietltfa rm(von(4 rxomo3oo1oatrli o t)tetrio3ny1apt mncil( s2rm(mp;o0ole iieiydfmDul(vpnu4 ltrxocootlmte ivo (  eurxr3oudlpee icil( aDumumo;t1tetniociaslsDrau s;(4texrio oytomteluvs;t) 2xo(mpoudlm emieilsf 2urxro;u0oltomo3tyslaDua( snu0 eenif3iatfaDr neils0 ruoim oo4lle mieta()sDrmump;t4teen f3tltlm elnvp;(0tlxrmrcio1opD  i ol(0 euoxr3nodaptelfcta() Dtauro;t0opxnmociyd s2ulnmont0aeerir oodop elivs;() rxriopiu1ole mietl(  Draxmpou4olenmi3iasfs2rmumo;u)tltnxr3io1oaD lnvi;t  2xmio oy4aptn fctlt  2tax pou4olen oetltla umu s;t0arenxrcio1opD ai i t)seur(m iudal e fetl() Dumxrpnu1tlxniicilsla2uanmpn() etriocoa1fmD livs;t) 2tmio iu1apt lfesa() ruax ont1alto iciydla2el( o ()artrmf3ty1fpt ai ol() eto(m3ou1om emnct t  2raum nu4apxo o3iaslsDrlnmo (0 rtnmr ia1lp   n s () rxmxopno1altnmfcslsfsrtmxmoou0aexoii3ias m ra(ms;u4tltrmo oo1fm rau ol(  rxo(opoy1ll e fetlt s2trumoou4tpt mictytlm elu snt)aeenxfcoa1op r neo t)s2toxm oydapt mies tfa2rrxm ;t4tex ifetatfmDemums;(4 renxf ia1fp rauvs;t0 2xr(opiu4lm n fct s)arra(ro;u4optnifcild s2emnms;u) lerio ty1oat  nei;s)setmim3oodomen ncs sfarrru ooo1olxoiietatfm2elnmp (0 etnxoctodlm elnvi;s)srxrxr oy1lle  fvt () 2tm(mont1aeeoio3iad a2rmumpn(0teeomr iadomt  ies;(  eurxrpiodlp  mfcsls a2rmur no1oee mo3tys s2em(vp t)arxrmo ootfaDrauei (  rumxm oy1opee nvilt sruaum ou1altomo3tldlmDulnmsn(4tlxomf ta1faDrlivsl(0s2xo(m oodoleelivilsf 2tmu pou0alxoiocilslm rmu o;u4 ltnxr oodlatrauvo (  2xrxopou1ale mncsa() Dur(mooo1apeomiciytla ea(vpnu4trxniocoydlptrau s;s s2xm(mpnydamt  fctls)s2rmuront0optnmfctyslaDea( p;u)aleoif3tydfmt ln i s s2toxrpnydlp n fvtatfa2tmuro;u1opt miciat a ul(vo;u)aeenxo oytlpD lneilt)s2tr(opno4ll nmfesls arrrumono4oltnmoetldfs2em(vo;()tltrxr3ootfm ranvs s  rxo(r no1ap   net () rrrurono1ape ioeild mDrl(vpnt4arerxo oytlatrlueolt)setoim3iy1op  lnesls s2ra(r nu4alt ifeildfaDrmu o () eeomrctytlpDe uei s s2urim3iu4lmte fetl()srur(r ou0olxomf3tlsfa2emuvon(4 ltrio oatlaDrai olt t2uoim3iydaltemfetasfa2tmumoot1oet mociyslmDrmu o;()aexrmr io1oaDeanvi;s  2urimpnu1om n fvslsfaDtrxmp;t1ape  o3ils mDelnvsnt4arxomf3tydom eln ol()t2umxmpiodamt mnvs (  2rrurp;t1alxo o3tlt m rl( snt0aeerir3tydoptrauei;t0t2trxopiydlp   ictl() Dtm(ronu4tpt mf3tldfaDrlnmpnt0trtnif3oydfa r ivs s0srxo(m3oo1omt  feiat)a2um(  ;t0oeenio3iat a2rlnvpnt0tlxrxr ty1lp rlivs;s)srxmim3no4ap e neil()s2rmur nu1tpe  fciltlmDulnvsnt4tlerxfcio1fpD aivs;s0 euoir3no1ol elfvt sf Drmurpno1open f3iytfaDrau pnu0 rxrmr oa1omDeaieilt0tetm(m3oo4lpee nvsls)srtau oot0tpenifeilt s2ul( p (4aetnmr iytoptrlnvo s) etrimpnydlltnlfesls) rtr( pnu1aee  ietyd s uanvs t0alxoxr oodoa r uvsl(  2to(r nodamen ici ()srrmumpoo4alt  ictytlaDrmn o u4arerxrcoatfat auvs;( texmxm iudlleemncs (fsDtm(ro;t1tlxn fcild a2ra(monu4alerxr3oa1fp   nvo;( teuo(r oydop e nci s)arua(rpnu0opeo fetad a emn ont4 lerio3ty1fmteaneslt0trur(o3oydop e ivilt srtaxmonu0olxomietytfsDraump;t4 ltomo3oodfaDranei s0teumio oo4aptn ivs s) 2um( o;t4opx mf3iydfmDrlu s;t0altoir3tadoa r ivi s trtoir3io1omen nei sf rtrx poo0tpeoifeiydfm2rl( s;u0alerxfcoy1lmD  ivsls0texoxo3oy4al n ivt ()sDtrurono4oexnioetad s2ranvp u0aexnifcootfp ranes s) euoxo3nodom emfesa() 2rmxrpot0tle  ieiltfs2emuvp u)alermfcoydop eanvo;(0s2uoxr iu4am  micias) rrrxm no0oex micilsla rmn p t)texrxrcto1oatean slt)s2to(r iudopen nvi tf rtru pou0aetn fetltfm2em(ms t4 lxrxocto1fp rlneo;s)sexmxmpou1llenmnesl(  rumxrp;u1opt mi3ildlaDelnmon() rtnxf3totom eli s s)teuoxm3oo1aptnlietat  2uaxm nu0tetnmf3ilt a em( p;t)tltoif oodfaD lnvsls0tetoiopoo1am emicsls)s2urum ou1teen fetltfm emnvo;u4 lerif3totop   nvo t0truoiopoydom n neiat)aDum(mpot0ope io3iad aDum(mpnu0altrmo oy1lat lnei;s) rxrim iudop emncsas artrx  oo1opx  ociyslmDraumo (4texrxf3iodopteaivi;s0teto(m oydlptemnvsls)arrmum ot0alxo feiat mDuauvo u0trxrxociy1laD  i o;s)trxrimpiu4opee ivs t)a2rrurpnu0teto ocilslm2ea(mo;t4 lxoxr ia1opt luvils sruoio no1lm   nei (faDur(m ou0alt mo3tld mDelumo (4 lerxf tytoptrlieol() rumxr iudapt  fvs s  Dtauro;o1tetn fctydlsDeln p (4 eerxf3tydlmDeluei;(  rto(mpno4lp emfeiltfa2urxm ;u4tltniicild s rlumsn()tlenio ty1late ieo;t  2umxrpnu4altemfvs sfsDtm(mpnt0tlt ifetltlsDul(vp (0 rerxf tytlat  nvo;s)t2xoirpiydllee ietls)aDrrxmonu4aeeo fctad a2eaumsn(4 etnio oydlaDelu i;() rxo(m3ny4lle mivils)aDrm( ono1olxoiieilsfa2el( snu)arenmo3oo1lmDe nei s)trtm(o3iu4amenlfvil( a2tr(  ot4alx mfciyd a el( o;()teenxr tatfateluvo;s0sexoim3nodlleemncsa()a2uru p;t1ope ifciaslm um( snt4 eermoctadla raies () 2uoxr iydom elfei sfa2uaxr ;t0ape  ociad a uauvo;()alxrxo3iydlm  lnvslt)t2tmim oudapt mfei tf Dumx  ;u1opt io3tysfm em(vo (0aexrioctotlmt luvi t trtmirpoy1lmenmnciasfsDtaxmpot0tleoiietyd m rlnvp t) rxrircto1oa elivslt) 2xmxm3oudale lnvs t  Dumxmo;u4apt  o3iadfsDel(mp;u4alxoxfciadoptr nvols0 etoio3ny1olenlivs t sDurur oo1tetnmi3tlt mDem(vsn(0aleoxfcoadfa eaieilt0s2xoxm no4lpe  nciat)sDrax onu0tpt mictyt s rlnvo u4aleoirctatoa eli olt  rxmxo3ny1ol elfcils) rraump;t4alx iicilt aDrl(vs;()tlenirctydfa eln slt seur(rpio1llee ieilt s2tr(rono0aee  oeiltla eauvp t4trtnir oo1lpDe i olt0trxrxopnudalee ivta()arrrumpou0tlt  fciad s2emn p;t) reoxo ty1lat ai s s0 eto(m3oodllen iviat s2tr(  nu4apx io3tytfs uanmp;(0aexriocoytfpD lues t t2to(r nodll n nvtls)s2tmx  nt1aeenif3tas m ulnvs (4 eenxr iatopD ln o s0s2trim nudom emnvt (  Draxrono1tex mfciyd a uau on(4 lxrirciytlm  anei s0tetmxo oudlmtnlfvt t)sDtaumo;u0ale  ieiatfsDrmnvs;t0alerif3iytfaDr nvi t0trxmxm oo1ap elfvi sfaDtmxront1alen oeiytfm2um(vp ()teermf ia1lat lieo ( srum(r3oy1lmtemiesa()artrx p;o0aeto icias sDuan p;(0aeeomr oytlpD  n o;(0 exmxo iy4ale  ivsa(f 2rmu  nt0oleomf3iysfs emu pnt4aleomoctodfa raueo;(0s2xr(o iydom n net tfaDumxrpot1oeenif3ildlaDuluvo;u0aexrmocoa1lmtrlues;( setm(o oy1altnlnct tfsrua( oou4oexn ocils a uanms;t) rtrxrciy1lp rlu ol( t2umirpiudop elictas) 2ra( poo1oet mfctyd sDeaump t)altomf to1fp elu ols0trtmio oo1ape lnetlt)aruru p;t0oeeoioeildfmDrm(ms;t)tltrio oo1lmteau s s)sexoxmpou1lm n fetat  2tmx onu4apx io3iaslm ranmon(4arxoxo3tydlp ran il() etoim3iu4ole  fet tfsDumxm no4ope mfciydlmDrlu s t4 lxnmo3oydopt lneil(0t2xo(o3nu4lpt lnet ( s2tr(  ;t0alxnmo3ildfmDrm(vo u)aetomr3ty1fpt li o s) rtmxr3ny1ap nmfei s)a2rr(ront1tpxo icildlaDul(vpnt0tlerir iadlatrluvols t2xoio oudap  mies s)sDrr( p;u1tpe iictyd aDum(vo (0aexnxr3oa1lm  luei t0 2tmxm ny4altnlivtat) rua(m nt4alenmf3iydlaDra( pn(4trtrxocia1lm ean s t0tetmirpiu1lme livsatf Drm( poo1opto fetas m2rmnvo u)artnmocoydfpteaieo t  rur(mpny1lm emfeilt)sDurxm ;u1openii3iasfm2emn sn(0arxrxo3oadlmte u sl( srxrxo3nodal emncs t)aDra(rpnt4oeto i3iyt s rl(mon(0 rxrif3oodomt  i o;(0s2xr(m3nudope lnet (  2ua(m ot4alx iietasfa ulums u0trxrmf3totfp eauei ( sexr(opio1amt lfvsas) 2ra(  nt1aptoifciydlm uaums (4texomrcoodoat an i;s0teto(mpiydllen fesl() rrmumono1tee moctlslm2ra(vs;u)tleomr3oodfaDraieo (0 rtoxo iu4op nmies t)sDtrxr nt4aeenmo3ild m2em(mpnu)aleomo oy1oatr nei ( seurio oo1openliei (  Dum(r nu4ape mo3ilsfm emn p;u4 eermr todlm ranvi;()t2xmimpio4amtnlnet s) 2raumo;o0tpt  ociytls rmnvp;u) eenifcoy1lmDelu ils)t2urxmpoy1openmfetat)s2rmxm ou0teen ociltfmDuln o;() lxnir3oa1om e nei s0 rxmxm iy4alt  neils sDrrxrp;u0tltn ieiaslm ran o;(0aeeoxr3ta1lm rau il(0 2urio nu4ap e fet s)arrax  ou1tpeo o3iltlsDemu p t4trxoxr oodomDrai i;t0t2tm(m ny4am nmnvs t) Drau p;o1oee ifcilsls ea( o;t4tlxoifciatfpDeaneol(0setoir3nydol n ivtat)srurx o;t0apeoio3iytlm ean p (4 rerxr todomD au ol(0trurio oudapte nesltfaDtru ont4tex ifetldfa2ean s;u0 ltrmrcoatfmtr nes ( t2xm(mpou4optemnct ()srraxrp;o4aetnmo3iatls rl(von(4 lxnifcia1lm   uei (0s2triopiodamenmfctl(farumu pnu0optnmf3iasfm2rl( p t0 rerxo tadoa  aivs ( t2uoxopiodop n nes sf 2uaxro;t1aee miciltfs2rmumont0 renif tadoptelivs;t0s2to(opiy4ll n ivil( sruax  ot4olx if3iatls2um(vs;t0trtoif ta1la elivo ( tetm(rpou4ome  nes (f Drruronu4apxn f3iytlm2eau onu0alenioctodfpDrluvi s) etrio3oydolte fvsls)arumur no0tlx mfeiltfs2rmn on()texoifcoa1lm raivs t t2uoim oo1lpenlncs ( aDuaurpot4aexnmociysfm emums;(4teeoxociy1opDraues t  2toxrpoudamenmivil()s2tmx o;u1tpeoif3iadlaDuanmsnu0trxrxo3oydlmt an sl( texr(opiudlp n fcs ()sDrmumpnt0optnmoeiytlaDuanvo;t)tetrxocio1lmDranei t0teuoxr oo4olenmnes s)s2um( pou4tltnmfeilsls rln ont)treoircoatfat auvo;s0seuoxr ny4ome liet sfs2rr( oot1tpxomictatla2uanvp;t0aetomf iotlpDeauei;s0setrxr nudll nlneiasfs2ua( pou1ale ifctatla emu p;()aeermocoy1lmteai slt0trto(m io4op elfei s srraxro;u0teenmf3tatfm rlumo u)tlxrmfcoa1fptrlnvslt  2umir3ou1alenmiesat  2tmxrp;u0texnmieiatfa2eanvs;u)trxnifcoa1fpt anvilt0srum(m3nu1lptnmivias) rurxrooo0teeniictydfsDulnvp;t4artnif iotfmt anvs (0 exrir iu1lm  mivta(  Dtr(r nt1oee  o3iytfmDrl(vs u4alenmo oa1fm eli i;(0teumxm3nodal nmnci sfsrtax onu4aex ifetldls uau o;t4 exomf tytfa  au sls0t2tr(mpiy1omenmncsa(f Duau oot0aet iietltfaDrluvp;t4alxnif3tydfaDrauvs;( teum(m io4lp nlfvsa(faDrax pou4tpe ioeiysls rm( s u)aexomr io1fp rlies;t)sexmio3nu4lpen ivil( s2rr( pnt0aexnmiciys m2elu pnu0trxrxo oa1omDrlnesls  2toirpoy4altnlfcslt arra(mp;t0aexomi3ildfsDra(ms;u4arxnio3iatlat  ivils)s2uo(mpnu4lltemiei tfa2tm( o;u4oexnifciat s2ul(vs;t4 eermr3iydlpD  nvslt)trum(r no4llenmfes s) Durxmo;u0oee miciltfaDua( snt0trxnxf oa1late uei t0 etoxo3nydlpe mneilt)aDra(rpoo0tpx  fctlt a eau p t0 leoxr3iotfm rlnvs;()sexm(o3ny4opt mict () 2rmx  ot0tltoiocias s rmnvs;()arxomrctatlaD  uesls) 2toxo3no1om   ieilt s2rr( oot1olxoiictltlm2ulums u0aetrmr oo1lmtelues;t  eurxmpou1omenlfcsltfs2rmumpnu4olt iietasfm2uan s t)tlenmf iytoaD lnvsls trtrirpoy1am n ivslt  2urumoou0opeo iciysla elnvo;t4tltoxo3oatfate nes;()t2tr(r nodamenmnvsas)aDta(m ;u0optniietlt mDrln s t)tetnif tadfmD an il(0srxo(mpoodlm  lfvil()sDtr(mo;o4apt  oeiydlmDulumonu4 eenio3todoat lu i;t0 rtm(o oy1llenmnctat  2umxm ou1alt  o3iadfa2rmump u)teerxr ty1lpD aneo;s seum(o ny4lpe  netl() 2umuro;u1optn octydlm ua( pnu)aeermrcta1laDeanei ( s2uoxo3nodllt mnvi t s2ua(rooo1oet if3iat m elnvont0aeeoifcoy1faD  i s () rtrxmpiu1lp nmnvi (f rtaumpnu1ope  feilt m uln snt) exnifctydoaD  uvslt) exmxr3iu1lp e ies s)a2ua(ro;t4alxoifetydlm2ra(ms;t4trtomoctatfptrlnvil() rxrxr oo1omen nvi t)artm(m ;u0oee  ocilsfsDea( on(4arenxo oo1op e ivo;(  exoiopio4aptnlfei tf rur(r ou1oexniictltfaDel( s t4altoxfcty1fmD lueo t seum(r oo4llee nesls) 2rmu  ot0opto feils a2ranvo (0texoiociytfat  ueo;( s2triopio1omtemnvt t) Dururo;t0alt  fciad m ulnms u0alenmo3oy1optelneil(  2xm(m oudol  lnetas) Duaum ;o1ale ioctyslsDem(ms u4 leoxo oydlmDrluvsls sexoxopou1llen fesl() rtm(ro;o4tex mfeiytfa2um(msn(4 exnir todoptr uei ()srtr(opoo4lltelnvil( srra(m ot4aeenmo3iyd aDumuvpn()trenmo3tadfptrlieo;t)tetr(mpiu4lmtnmfvtl()aDtm(r nt4tlto feiltfsDumnvs (4aetnxo3tadoat  ueolt) eur(rpoodlpe lnvi tf Dtm(rpou4tlx mfciatls2rl(vpnt) eeomr3ia1fmDr ivo;s0 2umxo3no1amt  nvtat) rua(m nt0apxnifciltfmDea(vpn(4aleoxocio1opte u ols  2uoxr oodol  mnvils  2trurp;t1oetniieilslm2rmnms;u4 etrifciatoat  i o t t2toxr3ny1al  lnetat)sDumxmooo4tpeomocildls umump;t0tltomocia1fm rauvs s0 2um(mpoo1lp   nct s  Drrxr nt0oetnii3tadfa2rl(vonu4 ltrif3todfp  ln i s0 exoxm3iydap nlietat)s2um(m ;t4texoio3iys aDel( s;u4trxrmf3tatfaD  ues t0setoim3io4lm  lfeiltfsDrau  no4aee  oeildfs rmums u0tleoxo3iotopt auei s0sexoxo nu1ol  livi ( sDurxrpot1opxomfcilslmDeanvpn(0altrxo tadopD luesl() exmir nu1al emfvi t) 2tmx pnu1oltnmfctltfa2em( snu)aexoir oatfp e neslt teum(m ny4lmtelnetatfa2umu  no4oet  i3iltfsDelumpn()trtrxr iotla elneo;t) 2umio3nudolt  nvtlsfs2urxm ot0tpenmieiydfmDeln p u4trxnif3to1fp r u s s) exm(mpio4alee net (f 2tm(r no1opx  fctlt s2ul(vp;u)tetoxfctadoa   ieo;t0texoxrpno4ole  ivsltfartmu pnu4opt  ieiat s2emnvpnt)trenxfcoydlpt  uei;t)sruoxr io4ope lnesat s2urx o;o0ale iieiyd m em(ms;t4 reomo3iodlpD anvo;t  rumxm iydol  mieias)aDua(mpnu1apeo fciltls2umums u4aetrir3ootlaDeluei;s0 exo(r3iy4ap e fctlt)sruru p;u0teeomi3iadfmDemnmonu4texnxo3iydlm eai ils0texrxmpnu4lpt  ncsl() 2rm(mpou0tpxoiicilt a rlums ()treoio3iydlate ues;( srxmio3iu1lle mivilsfa2ururpnu0alen i3iasfs uanvs (4 rtrxo io1fm rauvo;t) rumxr3nudop   iet s aDtauro;u1teenifeild aDrmn p u0aexnmo3ootfaDraiei s0setrimpoy1lpe  nvsltfarrmu  ot1ape  oeiyt aDemnms;u0aeeoxf oatlp raieslt0 etmim iy1opt liesatfs2rrx  ot0oexomfeiytla2ra(ms t4tltoio iotlmD lnvilt  rtr(r io4altnmivt sfs2urx p;o4tpxomfctydls2emuvsn(4 lxoio3todlp eauvs (  2xrim3iy4alte ivsltfs2um(moot4opto feiys mDra(vp t4 lermr tadfp ean s ()srtrimpnudap elieil( aDumxrpou1aleomictld s2ua(vs;(4 lxrmr iydfptrlnes ()texrxr3nydaltemicsl()a2urxmonu4tex moctlslmDrmuvs u0teenmocoa1lpte ivsls) rtoiopiodomeemneia()a2taurp;o1tet mi3iyt sDul( ont)trxrifcoo1lm   nvolt)s2to(rpiy4lp elivs (f 2ra(ro;t1tleo ociltfa rln p;()aleomo iydfa rln o;s0tetoimpio1am elivtlsfs2ua(  ot0tetn i3tadfmDuanvo t) renxociytop e uei s0t2umxopny4op n ies ( a2trxro;u0tltnii3iasfs um(vs;u)artrif oytfat aueolt teuo(m3oy1apeemncslt srraurpnt4oexniiciyd mDemnvs;(0 exnmr3ty1fm eli o s)t2tm(mpio4ol  mfct t) Drm( p;t4opxo icildlmDulu o t) rtrmrciotlmtrlieol()seto(m oo4olt lfvtat)aDraxm ou0oexo f3ildlmDrl(vs ()teenxf tadlp  auvs;t0trum(opoy1oleelnct s a2ururp;u1oexn ieilslaDrauvo t4tlenmfctatopt ai s;t teurxo oy4lmt lncsat)a2tm(m ot1aetnioeildfa2ul( p u)aexoir3tatomteln i (0 2tmxr3oydal elfcs (fsrumxrpou1opt miciytfs2rauvs;t4 ltomf3io1faD lnei (0 2uo(o oo4ole lfeia( srrr(ro;u1aee  fciadfsDeluvo u4 renxr3ootoate ieolt)seum(o iy4ol elnet t aDraxmpot0apx iieildlm2rl( pnu4aeeoxo ia1omDelnvi;()srtoirpnydapt  fct sfa2ururpou4tptnmfeiatls2ulnvp t0aeeomfcoy1lpD  neo (0trurxopoodamt  ivia(  rtruronu0texo f3tlt m el(vpnu0 ltrmfciadoat  ueol( trxo(m3iydlpeemncs s aDumxr oo0ope mf3tytlm ul(mp;t0arenxf ta1oa raneol()trxoim3oodolte ieta() rrrx ono0optn oeiytfmDemnvp t4 rerioctotom  lu s (0trum(rpiu1oleelnet sfartrxmpoo0aeeomfciadls ulnmo t)aeerir3iotopDeanvol()s2xm(o nodolenlnci ( s2ra(rono1tpx mieilslsDemu o t)alenxf iadopD aies t  2toiopiodaptelnci s)aDtru  ;t4aee ioctat m em( pn(4trtoir3oy1fp e nei t srtr(o iu4lptnmicta()a2raxro;u0aetoiietls s ul(ms;(4tetrir3oy1fptrauvolt)trto(r iydol nlfeil(f Dtaumonu4tlxn i3tytla ea(msn()tetoif3todfaDe nvsl() etmxrpoo1apenmfcs t  2taur ;o4oltn fciydfm rlnmp u)tltnxr3ia1laDe n o;t srurxr io4oltemnctls)artr(mp;t0tpx  f3iysla ra( onu)aetoxfcoatoaDrlu o;t  rtmirpnudapen feilt) 2rrurono4apxomo3iltfaDuanmo;u0aleomr3ta1lpteaivo () eumxr3ny4lm nlneils  Dumum nu1opxnmfctadlmDranvp ()tltrif iotfaDelneo s0 rtoxmpiy1lp n fci s sDtaurpoo0oleoif3ilt aDra( p t0 renmr tytlaDeaieo ( srxr(opiy4am  mivsl(f 2rrx o;o4altoio3tatfa2uan sn(0 rxomo3oa1la rluesls teurimpno1llee ieiatfs2rmurpot0tpx mietytfmDea(mp;(0 eeomf totla eln i t0setrxm3iu1lp  livil(f Dumumonu4opxoii3tydfm ranmont)arermf3iodfp  lnvi;s s2tmiopiudaltn fcilsfaruaxmpnt4alxnmoeiys aDem( s u4 rtnmf oa1op rlneo;(  rxriopio1lpenlfcilt  2um(m no1aptomfcils a2uluvsn(0treoxo oytfpt an i;( texm(opnu4lme lictlt aDtmum ;t0apeo i3tadfaDranmo;u0tlxoxo3oy1fpt aies s)srxo(mpiy1ope  fvt ()s2trumo;u0oleomieiytlaDrlump;u)tetrmr ia1opteau s t0texmio3iu1lle  fvtl()sDtr(mont1oexoifetatlsDrm(mont) lerir3iatlmteli i s0texmxm3ou1lp emieta()aDurump;t4altn i3iasfa ra(mo t0 eermr iydlmtraneo s)t2uo(opoo4altemiesa() Dumxrp;o1tlenmfctyt s2rlnvpnu) rtnirctotlp eaivi;t0 rto(o iu4omenmicsat srtrxr oo0alx iictlt m2ra(ms;()aleoxfciytfp eauvi s sexmimpiy1ol e nct s) rrr(ronu1tpx mictls m em(vsnu0trxnioctydop  luvs;t0truo(rpnu1ol nlfetls aDrmum ot1tpeo fciadlm umu p;(0 lxnio3tytfptrlnvil(  2xo(opiodam nlnciatfsrrau  ;t0apxomi3tltfm2rl(vo;u0aetoxfcoadomDr u i ( srumxo oo1op elfcilsfartm(rpno1tlen ieiyd m2emu p t0 rtoxr3oatlmt  ies (0tetriopoy1opee nvils a2uaurpno4tle  i3tldls2elump;t) eeomoctatlat  nvsl( texoxo3no1ape  fesa( aDumum nt1tlxo o3iasfa2emumon(0arxrxo3oa1omDe u ils0truo(m3oy1aleelnvt () Dtmumpnu0apeomiciasfm2emnvont) exoxo3tatlmDrau olt  etoxo3oy1apee ictlsfarua(m ot1oexn o3iyt a2rlnmp;()altnir ta1lp eln s t0 rxmxm3nudape mfcsasf Dum( p;t4alxnmi3iadlm2rmu s;()aetoif oa1omDe u i (0t2tmxo3iodam n ivsat arraxr ;o4opxnmf3tysla uluvp (4alenmociydomDelivi s0 rumio3oydol  liesa( a2rrxm ot1tlt mfcilt a2ul(vont)trenmr3oadfm eai o;( srtoxopou1al  mfcs s) rurumo;o4aex mf3iatfa2ra( o u)tltrif todlpD lu o;t)seum(r iydaltnmnvias  rtauront1olenmi3tlsfs rm(mp;t0artrirctydlp elies t0teumxmpno1opt lfctas)artru ono4tpto o3ils m ea( snt4arxomo iytlmDeanes s) eto(o io4lmtemfcsl( s2umx  no1tet io3iad m uaump;t)tetnxocta1optrlieol() etmim iu4lmenlfcias s2rmxronu4oexnioctyd s rmumon(0 leoir io1fa rauvs s)texm(rpiy4ale livi t sDra( oot1aeeoioctadfsDuanms;()aleniociy1fmtean s () rtr(o io4omtnliviat a2rrx ont4opeo i3tysfs rlu on(0teermo ty1om eluesls  exo(o iudame  ivtat sDrmx  ou4tpx  iciadlm elump u) eermocoydfptelivi t srtrxo3nydlpenmnctat) 2ra(r oo0tee mi3ilsla ulump (0 reomocoytom elu ols)t2xrxrpiodll nmiesas aDur(mpno4opxoiocils s2elump;u0 rtomf iotfa ranvi;(0sexr(o3nu1opte ietltfarra( oou0tpxn octydls2emnmpn(4tlenmrcta1lp eln i (0 exr(mpnydllt  fet (f rrm(rp;o4olxn iciyslsDuaumont0 etniociodoa rlu o;( t2toxm iodamee nei s  Drmurpnt1tpxn fciytfa2rl(vo;(4tleomr3ty1la e ivs;s) rtoxr3ny4llte fctl(  Durump;u0ape ioeildfaDean onu4alerir iy1lmDrai s;s t2tmxo nudlle lies s) rrmxmpou4aexn octatlsDrlnmo;u0artomo3oytfm e uvi ( trxo(o iu4am elnvias) rtaxrp;t1aptnmfciasls2rauvp u0 eenmo iy1oa eaues ()s2uoiopoo4om emnei tfsDtrx p;t4tpen iciltls ulums () rermrctodomDraieo s  exmir iydam  mnviat) Drmur ;o4oet iieildfa2el(mo;u) ltoirciotoa eau i t) exoxr3iydoleemfvs t  Dumu o;o0tpxo iciaslmDul( p;() leoxf to1fpDe uvi;(0sexmimpny4amtemnctlsf Dua(r oo4optn ieiasls emumo;t0tlxrxf ta1omDrlu s (0t2urxr iudlp nlies t sDuru  ot0apeomf3tldlm2emumo;t4 rtoxrciy1fmt ai o ( srxm(o oo1alte fct ( sDua(m ot1texomociatfm2emnmsnt)tltnxo3ta1fat aneo;s)t2xoim3iy4al e ivtat)s2tmxmpot1olt  fetlt a ranvo (4 eerif ta1lm   uvo s) 2xr(opoo4lleemiet s)s2tmuronu0tetn oeildls2emnmon()altoxf ta1lpt livs;( texmxr3ny1ole mivil( a2ururpou0tpeniicilt s2rlump u0alerirctodfm   nei;(0trtmxm3oydope mnesl()a2um( p;u0aexnmieiad mDrl( snu) etnmoctodomDe iei;t)setoio3oodap emicsls) 2uau o;t4tex mo3ias m2ea( s (4 lenmr iydopD ln il() etrim3no1lm elnes (  rtau  ;u1texniiciysfsDel(mo () rxrmr oytom e nesls texrim3ou1op  mfci (fartaumpnt0aexomocias s2rlu ont)altnif3oydla elivo;t0 eurxm3io4amee fet t) 2rrxmo;o4tpxoifetadfaDranvsn(0artnxr iatla e ivils0tetrir3nudopenlfvta(  Dururo;t4aleomfctlslm2rluvs;t4 lxomfciotlat livilt)sruo(m ny1lpee iviat  rtmx ono4aleoiiciadfa2umumsnt) etoircoytlpt ai i;t0 rur(mpoy4ap emietat) rrruro;t1apxnmoeiaslm emnvon(0 rxoir3tytfptrli s t)s2xo(o3io4ol elnetasfa2rmxront0texomfctldla2elnmsn()areoxrcto1fmD an sls0teumim io1lm e ncs sfsrumx  nt1alxo i3iydlsDrau p t0 renio oy1oatrauvo;t) 2uoxo3iudalenlietlt)arraxroou0olt  ietys m emnvo;u0arerxr3ta1lmtelnes;t0t2um(o3nydlltelfvsasfarrrur ot1aexoiictytfm2rlumpn(4trenxrcta1fm   ueol(0texr(m nudll n nvsl(farraxr ou1olt  o3ias a2emu ont0 reomr to1la ean olt)trtmxopiu1lpeemfcsa()a2rmxm nu1oexoiietytfmDrm(vo (4 eeoxo oa1opD au s;(0 etmio iy4aptnmieils)sDumxm ot4tle iictasfmDumnvpnu)treomrctytomt ln s t0 exm(opoy1optemivslsf 2trxr nt4tptnmi3tasls2ranmp;(0arxrircoo1lmDeli o t t2tm(r3nudam  lfvsl()arraur ;t1ole ioeiadfs2ulnmpn() exoirctodfatrln slt  euoxr io1lp nmfct sfsrtr( ont0ope if3iysfs em(mp t0trxrmr oodoa r nes (0 2toxr io1altn ietatf Drrxm nu4apxoioetydlm2ulums;t)trxoifctodlpte i o ()t2uoio3ny1op nlnes (f 2umu  no1texomocilsla el(ms;t)teeoircoydla  ai o t s2uoxrpiu1ll n iesltf 2rm(  nt0oleoifeilt s rm(vo;u0tetoif iydopD  i ol(0s2tmxm3io1lpt  ivt t)aDuau pou4aptomieiltlm rl( s u0aexrircia1opteaivs () eurxo iu4op nmnvsat)a2rru o;u0olx  oeiasfs2ran pnt0aetrir oodoaDrai o;s0s2uriopoo4op  miesltfaDta(  ;u0aetomoeiydfm um(mo;t0 rtomocoo1fa  ai i s)srurxmpoudale mfci ()sDtm(mpnu1oltniieiysfs2uanvp u)artrmr3iytla  lieo;t0 2umxr io4olt lnesltfs2rmxm oo0oltomieilsfm2uanvpnu0tetoio3oa1la e ues t)s2xoxm3nu1ole livtlt)a2taum nu4ape mietad s uanvont4arerxf3tatlm ranvs t srtoxr iu1opt mneta(fa2rrur ;u4tptn feiytls ul(ms;t0artrxf iydoa rauvs;t) etoio oo1altemncsas  rrr(r ;u4tlt ioetyslm ua(vs t4 rxoxf oo1fp rai s;t)srurxrpny1lpeemies ()srrrx ono1oleomietysls rlu s;t)aleoxf oy1omteaivolt0 2tmxm3nu1lptemiet s  Drrxroou1aexnioeilsfm elu onu0aexrmrciydfpDe n sls  eur(r3nu1aptemncilt s2ur( pnu4alxomociltla elu p (0aexoxrciytop   iesls0s2uoio no4oltn iet s)sDumxrooo4oltoio3ilsls2uanvont) lermrcio1lmteai s;s  2tr(m oo1altn fvsat)arurur ;o4alenmiciat m2umuvp () leoxoctadfm  luvs;(  rtr(opio4op  mnvt s)sDtru pno4oeeoifctldlm2el(ms;t0 lerif ty1laDr uvslt s2umxm io1optemfet t)sDuaum nu1optomf3tadlaDumuvp t0texomf3iodfmDean s s t2uoio3iudoptemivt t srumxr ou4oetomfciatfs2em( p;u4 lxrxocoa1faDe nei ( trtmxo3oodameemfvslsf Drrumono4apeoif3iatfa2raums u)aeenmrciotoptranes (0 rto(rpnudape lici (fartmxrpnt4texoii3iadfaDem(vp (0trerif3tatlpDeln s;(0s2xrxo io4ope  nctltf rurxr ;u4tee mi3iasla2elnvonu4aeeoxr3tatop e i sls)trumio oydlm  mivsls sDrm( pnt0apx  o3ildfa rlnvp u4 exnmrcta1lpteauei;s)tetmxopou1al  mnesl(fsrrm(ro;o0tlt mieiltfm2ranvp;t0 etrmo todomteaieols truoio3nu4lm emiei sf Drrxrpno4ope  iciatfm2ua(mp;t)areomr iodoptrln o s0s2xrir iy4apt lnct (f Dumxmpou1oex  ocildfsDemu o u)areomrctytfmD luvi;()sexoimpoodom n neta()sDumx p;u0tpe io3iaslaDulnvs (0artomocoodom rai i;t0 2umio oudlltnmfei s  rumur nu1tltn ieiatlm rlu o u4tltnxo oodlmtr ivi t) eurir3oodllt lfetls)a2rm(r ;o0tpxomoctlt s emu o;u) rxrxr tadlp rai ilt0 rur(m3iy1optn ivi s)sDtrumpno4olx iieiyd s2ran p u)alxrmf to1lpteaivo;t)texr(o iu1lpenlnvia()srrm( p;u4ale ioctatls em( o t4arxrxr oo1fatelueo;s teuoim3ou4oltemicta(faDumxronu1ape ifeiaslaDrm( p (4texnmr oodfptrlneo t)teumxo3ny4ape mfctltfaDtax  ;u1texn i3tys a2rlnmp (0trxnxf3oy1lateln o t  euoirpio4lm emfetl(  rrrur no0aetn ictls a em(mon()trtrmo3oy1fmDrliei;s0 rtrxo ny4ape liet ( srtr(  ;u4tpxoifciydlsDranmp;t4 etoifctytlm  ln ilt)trurio io1lpe mfes s)aDrmu pnu1olx ifeiyd aDrm(vont4 lenmo3io1oaDelieo ( truoxm ou1ope lncsl(fa2tmxmo;o1opxnmfeiyslmDemu on(4 rxrmr3oytopDe ivi t  2xmir ny4lltn fvil(  2tmxr ;t4oexo oetydlsDranvonu0 lermfctotfaDeaueslt0srxmxrpoy4apeelncslsf Drmu ooo1aleoiiciydfm um(vpnu4alxnmr tadlatr nvo ( texrxo ou1omen fvsls)srra(  ou1oeenioctldlaDelnvon(0teenxfciadfa rluvils0 2toir3ny1om emncsltfsDtr(r oo0tex  oetydfs2ua( s t4alxrxo3ta1lpDe u o (0 2tr(m3oy1ope lnvt (  rua( pnt1oeen ietltfa2um(vs u)aexoir ty1oat  ivi;t t2xoxr nodamenlfvt ( sruau pnu1alenifctyt a2elnvo t0 lerir3iytlmteanvs ( t2tmxmpiudllenlnvs (f 2rruro;o0alenmociasls um(ms;u4trtnxrcta1opteauvs;t0t2urim3nodape mfet sfartr(r nu0oexo ictys sDuauvp;t)alerxfcto1lp rln o t0t2uoxr3nodamt mivil(f Dtrxm nt1ape moetldfmDumn onu0aeenifcia1oa  ai i s)s2xmxmpio1ome lnci (fsDtmumoot1tltomoeias s2em( s (0 eeoxf3oa1laD  ivil()sexo(o3nudoptemfes sfs2trxrpou4openii3tldfs2umu s u4aetoircty1laDr u sls) rxm(rpou1lmte iei s)aDtrxmonu4ole mfeiytls2rmnmo;u)aetnif iy1faD lueols tetrimpio1ol  mfes tfaDuau  ;u1tlxoifeilt sDrlnmpnu4artnifcio1omDran o t seum(o io4lmenmncslt  Dtaxmonu0oltniociad aDea( o;()tetrxo3oy1omDe n i ( s2xmxm3iu4oltn ies t  2rrxrono4oleomo3tls m2ulu s;u)aleoirciy1fatrai o t)t2tmxo3iodapeelieiat sDrrx pot1alx  o3ilsfm2ra(vo ()aeenmrcto1fmt au i;t0 2to(mpio1al  micsat  Dtr(rooo1aeeo feilsfaDel(vont4 etniociy1fm rli s;(0seuo(r oodopenmfvtls arurxmpoo4alx  ietytfsDem( s;t4 ltnmo3oa1late nvsl(  eum(mpnydap n ietl() 2tm(rpou4apeoif3ias s2uln pnu0 eeomrcta1faDrluei;()trtmxrpoo1ope liet s) rrrxm ;t0apto f3iadlaDeln snu4 eenmo3ootfm e nvi (  ruoimpnudapte fcilt  rtrurp;o0aetn iciytfa rmuvsnt4aeeoxr3iadlptranvs;(0trtoirpio1apenliciat) Draxr nu0opx  fetld m2um( p;t4 rxoifctatlptrai o s)s2ur(mpoy4ole  ict (fs2rmu  ;u0tpx mo3ias m2elnmp t)alerxocoo1lmtelu ols  eumir3iydamtn fvi () rrmu  ;o1tpenmfcilt mDrl(mpn()teenmfctodom eai i s)trxmir iudopenmivtasfs2ur(mpno0aetoifetlsfmDum(vo t0 ltomr iy1op   neil(0trtoxr3ny4apenmnes sfsrum(mpou0alx  i3ilt aDulu o ()teenir3todomte iei s) rxrxm3ou1ole mncs (  Dta(r ;u0apxo f3iydfsDelnmo;u)aexrxr oodopt  uvsls)texr(r iu1ll   fvta()arur(m ou0tlxo fctad aDuaumpn(0tlerxo oo1lm rlnei;t0sruoir3oy4apeemivi s srrrumono0optomo3ilsls elu p (4tlxomfcoodlmtean ols)srxrxmpny1lp emfetlt artr( oot0olenmfciltfm2em(vpn()aexomo iytfa elu ols sexo(m iydap  lnvi ()sDtr(moou4teto ieiys m rm( sn()trtomf todlmDelivol( setr(m oy4aleemnctatfartmx pot4apx  fciytfs rlnvo;u4alxnif iotlp  ai s t srxmxm3oo1lmeelivia(fsDrrurpou0apt moetltfm2ran p;t4 eermf3oadlp ean i;t0 rxo(m nu4lptnmiviatfs2umxr ;o1texoifeiatfs2eluvsn() lenmo3oydop elnes;t0 rtr(o3ou4ll elivi sfsDtax p;u4opxo feiydfm2rlumsnu)aeerif oy1laDr i ilt)texoio iy4llt  ivta(fa2ra(r ;u0tlxn fciydfmDra(mp;u0altrmf ty1fmDeau o t0 2tr(o3nodll nmictls s2taump;u0apt  ieias mDelnmon()arermf iytfmDr nvilt  ruo(opnu4alt lnvsa()srrr(m ;t4tpxoifciltls ua( p u) lxoxf tadlmt an s;s0 exmxmpiudopte fci (f Duaxrooo1opt miciat s emu s () renmo3oo1lmt  uvo () 2xr(r3iy4lp e ncsasfsDrm(r oo4alxoioetltfmDumuvpnu0 renirciy1fp rauvo s0srtoio ny4ap  lfetat)srumumo;u0alt moeildfs rlnvonu0texoxocoodlpt auvs;s) rtmimpou1olt mncilsfa2raurooo1alto ociydfsDul( o t4alenxfctotfaDraieilt  eumir3oy4aptn ivtasf rurxmpoo0oleo ociysls2rl(vp;u) exnxr totfa rlu o;(  rxr(o oo1lmte fvi () rua(rpou4tleoiieiltfmDelumsnu0aetnif3iydfm   i o s trurxr iu4opt  fctltfsrrr(mooo0tpxomociasfm2ul(vs;(4 etomr iydlmDeluvs t)trtoxopiudlp  livs t sruau oot4oeenmfeiydfsDulnmp;()aeeoircoo1fm r ivols  2xm(mpny4om nlncta(  2uauronu4ape iiciaslsDum(vo;() reomo oydlpDran s;t)tetr(o iydlp e fcilt)sDra( oot0oexn i3ild sDrl(monu4 rtrxf3tadomteau s s0 2umim3oy4openmnvs (fsrta(mpnu0tetnmfeiat aDuluvo u4texnir3ia1fm ranes t0srtrxm3iy1lmen ieiatfaDuru p;o0tptnifeiytlm um(vs ()arxoirctydla r uvo t)setoxo3oydolt  nvsa()aDrm(m ;u1oleo feiyt m2ea(msn(0tlxoxr oo1laDe uvi s  ruoiopnudlle mfcsa(fs2tax  ;u1olt ifetadfmDul( o t)tlxoirciodlmte ivo (0setrxrpoudlmtnmicslsfs2rr(r ot1aleo oeild m rau on(4aetoif todfmtranvols) etm(o3no1lpte fviat)srrax o;t0olt mi3tasls2rauvo;(0tlxomr3oodoa   n ol(0teuo(r3iy1lptn nvils)arua(r ou4ape iiciasfs rl( o;() lermr iatfmDeluvols) 2trimpou1ll  mfes s) 2raumpnt1oeenmieilsls2um(vpnt0tetnmocty1opD aneslt  euo(r iydop elnvslt aDuax pno0tlxnio3iasfm elu snt0 rermf io1faD ai olt t2xr(o oo4am  mfvs () Dum( o;t4opt  ociasls rlumsnu) ltrio3iotfaDr n i t) 2tr(r io1amenlfvi ()artau p;t0aexoioeils aDrln p t0teerio tydoat lu s;t0s2xo(r3no4ll nlictlsfaDuru  oo0apenio3ias sDrm( p ()arxoir ta1faDrauesls  exo(mpoodlp elnet tfaDra(mooo0ole  feiltfsDuan s;t4trtoircta1omtrlu o;s0texrxo3no1op e fcia(fsrumxr ;o1aexnifcilt m ea(ms u0texnxo ta1lm  lieolt0 exmxm3ny1op e nvsasfsDtrxrp;t0opxnmi3tytfs em( snt0alxrif3tydoatrluvs;s s2xrirpno1olenlnei s a2tr(  oo0apeomfctlsfs eau p;(4 lxoxo3oy1oat lu s;s)truo(r nudlmen feslt) 2ra( pou1tpeo o3tatfaDuluvo;t0trxnxo oa1fat aieo t)trxrxm ou1lle mfctas  2rm(mp;t0apt  o3ilslaDean o u0trenio3oodfpDraieo;t0 2uoir ny1op n fetlt) 2taxmo;t1olt ifeild s2rlu o ()trtrxocta1opD lnvi;s)trum(o3iu4alenmnes (fsrrmx ont0teeo oeild aDrlnmpnu0treoiocoodfateaieil( teuoxr nodlle  ivs ( srtmump;o0texo i3iytfa2rlu o;t)tetnxf to1fp  livi t)trtoxo oo1ape  fesat)arur(ronu1aexoifctlsla2ulnvsnu0 etoiocta1laDe ivi s  euoxm3iy1am emfvil()s2uaxm ;t4opx  o3iytlm uau snu0 rxnmoctadom rluei t)setriopoy4ll nlivs sfaDtaur ou4tle  ociatfa2rmnvont4 lxriocoa1lmt  n i;() rtmir nydlle lfcs t)aDum(rpou1tpenif3iydls ul(ms;u4aetnmfciadfa  anvsls  rxoirpiu1amtnmnetlsfs2uaxr ;t4open fciltls rmu s;u)aetrxf tatopte n s t)t2um(m3nydol nlivslt)sDuru pnt0tle miciatfs rlnmo;()trtoxf totoatr neo t  eto(m3oodale  ics t  2ra(ro;u1apx mieild aDrmuvo;u)areomrcoadfaD ln o;t0texrxmpiu1alenmics t s2raur ot4aee mo3iytla2emumo t) eeoxo3tytfmDelivo s) exrxm3oydalt lnvils  Drrxm nu4ape mfciasfm rl(vo (0tltrif tatomDrlieo (0texo(mpiodalenlictat) rrm(mo;t4aexo fciaslaDumums;() renxf iydfpteau il(0trxm(mpoy4lm  lfeiasfsDua(mp;u1apeo o3iadfs ulnvpnt)arenmocoodlpt anvs;(0 2umxm3oy4ol nmicia(  Drrxmonu1open ieiytfa2rmn s;t) etomrciy1fatrlu s t0setm(o3nu4al   nct t  ruaxrpnt1oetomiciadla2ul(ms u)tlxrxrciy1fmtraivil(  rum(o nu1lpe mfeia(farumum ;u0apxo fctltfs el(vpnu) lxnmr tatfpDe u o (  rtoxrpoy4altn ictl( sDtrum ;t4optn ocild m ul(monu0alenmf3oadlmDeaivo ( sexo(r3oo4am e nci s) rrrxr ;u0oet  fcild mDuanvon(4 rtrio ia1lmteanvs t) exr(m3oodoptelieils sDrmx  ;u1olt  fctyd m el(mp ()alxomr ootom e uvi s)t2xmiopiu4altelivtat)a2rm(root1opxoifctltfs2umn pn(0aetnxo iotopteaivi t0trxmxo oydapte nciltfaDrmxmooo1olt mo3ils s2uanmp t0tlerio iotoat lnesls sexr(m oydoptelivsatf rrrur ot4apxo oetas a2eluvs (0trxnmr oadomt aivo s)srxrxm3iodome mnetl(f rtaurpot0tpxnmieildla ulnmp (4tltrirciydlmD luei t0seto(mpnodlm   ictls)srraxmpnu1aexnmi3iasfa el(mp (4alxrio3iydfaDe nvol() 2triopoo1lpenlfeia()s2tm(r no4tlxomfctat sDrmump u4tetnxf iadlmtelnvi;s  exo(rpnu1lltnmfvsas)a2trxmpnt1tptomi3tatls2rm(mo;u4aleomr3ta1omD  u s s)seum(o iudlmen ietltf Dtru  ;t4ope ioeiatfs2eluvo t0arxrmf iodfpDe nvi t s2xrxm iy4am e nes tf rrrx p;u1tpeo f3iys mDrmumsnu4aetoifcty1op   uvols0trxoio ny1lmeemictl() Dtaumpnt0tlenmfetls m2ranmonu4artrmocoy1fp e ivilt0 2urxr3ou4amtnlict ()artaxrooo1olt io3iltfsDemn p u0aetnio3iotlp  lneo t0srxmxo nu1omeelfcs s sDrmxrpou4oeenmiciydlm rln s u0aexrif iy1lp e nvs t0texoirpnudap emies (f rurxmpno0aeeo f3iltls ulnvo t0 ltoir oa1oat aiei;( trxrim io4ll e icsa(  2trxr no0oltniociad aDuln o t) lenmo3iodoate ueo;s sruoxo3oy1oltnmfet tfarraxr nu4apxnmi3tlsfs uanvo t4texnxf3iy1fmD  uvol(0 2tmim oodamtnmfviat)s2tmumpnt1aexoioetatla uan onu)tltnmfcto1fpteauvo t  exmxo3ou4olenlfvsatf 2raumpnt0teenifciydls2rlnmp (0aexnmf iatfaDr i ils) 2uoxr iy4oltemnetls) Draumooo1open i3iadlaDemu s (4 rtoirciytoatrlu s;(0sexo(r3iu1lm   icil(  Dua(  ;t4tlxo ieiasfa eaums t4areoif tatlat lnei ()texoxm3ou4op nlnct sfartm(monu4oleomoeiatlaDrlu s t0alxomo iodfa raneo;t0setoxrpoodomte fci s a2tm(rpnt0oet iietltla2el( ont) lenif3oodoaD  n il(0sexoxo ou1llt lfes t)aDumum ot0texnifctytlm2uau onu) exrxf ty1fm   ivo;t  rtr(o nodale lfet sfsDum(mp;o0oltoiiciltls2rauvo;()aetnxocto1faDean i;(0srxmim3ou1lmtn ncil( arta(  nu0oexn ictysfa2rl( p t4 eeomoctytlmteln i;s0srumimpou4amt mfviltf Dtm(ront1texnioeiadfaDra(mp;u0tlermfcoo1faDelueils  rurim nu1alt  fvsltfaDur( p;t0apxnmfctltls eauvpn(0 exrxociydfp  aieslt  rxmxm oo1olt lfcil() Dtmum ou0aet mfeiyd m2uanmo (0 ltomr todop   uvolt)t2tr(rpoudll elnvt s)arrrumooo4tlen f3ilsfm2rl( o u4tlxrmfciodomt aivsls srtmxo3ou4lme  nvils  rrax  oo1tpto icild sDeanvp;(4 exnxo oo1opte ies;t0teuoxrpoy4lp emivsl(f Dtm(roou4tltn ociyd sDelu on(0 etnir oatfmD lieil() 2uo(r3no1lleemict sfaDraum ;t4oetnmf3iydfs2ulums;u0 ltrxo3io1lateli s s)s2tmim oydapt livs tfsDuaxrpou4alenmictad a elumpnt4trxomoctatfat au slt)srur(r3nudlpeelivil( sDtaxrp;o0olx mf3ilt a ea(mo;t)aeerxo oa1fate ivil(0t2xoirpoo4olen ici () 2urxmoot0tlxoifctlsla eauvs t0tltnir ia1fa eaieo t0texriopiy4lp e nvtl()artm(rpno0apenmf3iat s elnmpn(0aetrxf3oydoa r neilt0srtm(m nu4optnmieias)srraxmo;t1apeoif3ilsfm2ulums t) ltoircio1omt anes;s)sexo(opio1lptelieil()a2uru p;o1oltnmi3iydfmDrln ont4 lenxocoadfpDeluesls) 2trxrpou4lmt mfetas)aDraumooo1opt  fciytfaDul(vo;t0teerxociy1lp  ai i s)s2xoio oo4ol nlivil(  Dra(m ;u4alxn o3iatfsDemnms;t)texoxrctatfmDrlivil(0teumxo iodom emicsa(fsrtrx ont1olx ifeiys aDemnmp u0 rxrmfcoodfpteaies;s)s2trimpiydolt  fciat  2umur ou4tlenmoeiltls2ea( o;(4 lenmf3tydlmt ln i t)trtmxo3iudomeemfei s a2ra(m ou0tpx moetys s2ua( pn(0tltnxf3iotlate n o;s)t2uo(r iydlmtn fes (  Duru pou4tpe  fcildfm ra( sn(0arxrio iatfm eaneo;(0t2uoir no1lm emfvta(f 2rmx  ;o4tpeomicilsla umn s (4arxnifciydfpDranvs s teuoim3oo4ol emictls a2rmx  ou4oee  o3iadfs uln p t) rtoxociadoaD an i t0 etm(rpio1omtemivta()s2umurpnu4opx ioeiysfsDrluvont) lxoif oo1omDrau o t)setmxopiu4apeelfvtl()aDtmurooo4apxn i3tldfm2uanvp ()aexrxocta1fmDeanes;t  exoim3no4llen nesasfa2trx  ;t1altnmfetys mDem( p u4 reoxocoodlptrauvi s trtrim oodal e nct (  2tr(ronu1oee moeiadfaDrm(msn()teenmo oydfmDe u o t0 euo(m3nodlpe mnvsa()artr(m oo0aexo fctltlaDulumo u4artoxfcoatfate ivsls) exoir3oo4ol eliet t  rtmu  oo1tetnmociadlm2ean snt4tlxrmr io1laD  i o;s  exm(opoo1alee fvsas  2umu  ;o0texo feiys a2eln s (4tlenmo iadlpDeli i;( trur(mpnudam   ivslt artrumo;u0oex  o3tyd a ra( pnu4trermr3tatopteluvo;t srtr(o3oo1amtemnviasfsDum(r ot4tee  iciyd s uaums;() rxnmf3oodopt  neslt0 eto(r nu4al elfvilt a2urxr ;o0aee iicilsfs2ea(msn(0 ltrmrcoa1fmD lieols trxrxr iudll nlnvsat)aDraum nt0texnif3iyt s2uanvs (4aexoir3iytfaD liei t0t2triopny4ap elfvta()a2rm(m ;o4opxnifciadfsDrauvpnt4 etoxo3ootfat an s t)srxrxo iudlme  ivtas s2tmx p;o1olt iiciys m2rauvsn()tetrifcoy1fpDeai i;t  eumxm3iodlm nmfet tfa2uax pou4altnmfciasfs elumsn() ltnmociadfpD lu ilt) rur(rpiydom n ivt (fa2rax pou1oetnmicildfsDrmu sn(4 lxomr ia1om rln i;s tetoio nu1amt lfcils)s2ur(rpot0oee mfeildlm2rmnmp u4trtrifciy1fate neils s2umim3nu1ap n fetlt) Duru ooo1tex miciad aDulu p;u)artnif3tytlpte uvo s) exmxr3iudlmtn feilt s2rmu onu0apenmfcild m um( o u)altomf3ia1fp elu s t)t2to(o3iodoleelncil() Drmx ono1opeo fciasfm2rau s (0aexrxr3iatlaDrluvs;t0t2xm(m io1lltnmnvtl( aruau  ;t1apxomi3tad a2um(mpnu0texrio3oy1fpDeaivi;t0srurim nu1ame miei (farumxmonu0optn oetatfm eln s (0aeeoxr3oodfa eau i;s)s2xoxmpno1opee ies tf Dtrx  nt1altn i3ildfaDranmpnt0arenio ta1oate u i s)sruoimpno4lpenmivi t) Drr(m no1altoifctyt sDrmuvo;t0aexrif3tydlmteauvo;s) rtmxo oydamtnmivtas)sDtmum no0oeeoiietydfa2eaumo (0 ltoxrcta1lmt aueil(0setmxmpiu4llt  fesat)arrm(  ou0aetn i3ilsfs ra( s ()aexrir to1oaDrluesls0t2tr(o iu1ameelncslt) 2uru p;t0tlen feiysls2ul(mon(4aetnmo3oodlptr ueil( setoir iu1ole  fctls artmumoot4alx  oetydlaDea( pnt)aeermo3oydomDrlu s () rurxo3oo1optnliciatfsrur(m ;o4aexomo3iasfs rmnmo u4trtnioctodfmteluvi;()texoio oodapenmictat) rtau oou1olxoifctld m2ua(msnu0 etnmfcoatlatrliei;t0 euoio3no4omeelietatfa2urur ou1alto f3tad m2ra(vo;()tetoif iatfpteli ils0 2xmxm oudomen netat)srumurono4aet ifcilslm2eauvp;u0 eeoxo iy1lpt  u o s) eum(rpno4lptemivsatf Dumx  ;o4tptniieiltlm2rmnvsnu)arerif3iy1fptr nvil( s2uoirpiu4lpt mneia()aDrr(  nt1open ociytlm2rm(mp t)trxnio3iotlmDelivil() 2urxm3nu4opt mfcil(  Drm(rpnu1oeenii3iadlaDrlnmpn()trxrir3todoaDr uvo (  exo(opiy4ol e ncs (  2trxroou0apto ieiydlsDua(ms u4aetomfcto1fm r u o () 2xoxr oydlmenlnvt t) Dta(ront4aleoiieiytfm uaums () exoxrcootfa  lieo;t0 exo(rpnu1om e nci t)srur(rp;u1tet mfeiytla rl(vo;t)trtnifciydfatelivo;s)srtmiopiy4apt mfeiat sDurxrpoo4texn o3iysfm rau s t0 ltrmf3oadfptrlueo () rxo(m3iu4amt mfes s  2rmum ot1tlxoiietatfs rlumo;t0trtnxf3oodoaD auvslt0t2umxo3oodamt  nvtls)a2uaurpnu0alen ietlsfs2emnvo;t) eeoxfciotoaDeauei ( tetr(m io4ame lnvsls a2ta( ono1aexnif3tat mDrmuvsn(0 eeoiocoatla  auei;( t2xmxo nu1lmen fcta() rtr(r ou0alen o3tltfm2umnvs;() lenxf3oy1op e ues (0 etmxr nydll elivtatf rtaur ;t1aee  ocias mDumnvsnt0tetnircoy1lpDean ols) rtrio ny4amt  fvslt)a2urxmpoo0altoio3ilt m ua(von(0tlxnmf ty1omte i i t t2ur(rpiu1oleemicils a2raur ;u4oltomfciytlm2el(ms;u0artoxo io1laDe ivo;s0 eurio oo4apenmicil(fsDuau poo4tltnifciydfa rmn o (4areoxocoytfateauvol()s2umxm io4om   fcias a2ta(r nu1teeo o3iytlm eauvs;(0treoifctadoa eau o;t0s2uo(rpio4ll  mneiat)aDtm(rono4tet mo3ils s2uln p (0 renmo todfaDrai i (  2tmimpoy1ap  lncilt)a2tru  ;o1apt ioctadfm2umu o;u)tltnifctodlmte n o t) 2ur(o3io4ame mfcia()s2urxm ;u0olxniocild a rl(vo t4trtnir ootfmDe u o;s)trtoxo nodol   feiat)srum( ono1opto ociad sDrm(vs;u4aexrxrcty1laDean olt0setm(rpoudlp   ivt sfsDra( oot4optn i3iadfs2em(vo;t0aetnxo ia1fate ueol()srumxo oy4am  lfcsls)a2rr(rpnu1aeeoii3iytfa um(vo;t)artrioctatopD li i t) 2tm(m oudal e nctl() 2uauro;o0tlt mo3tlslaDrlu p t)aetoif iytfpD aivs t)s2uo(mpnodal elnesas arrm( ono1tptomi3iydlm rl(von(4aleoxr io1oatrlu ols0sruo(mpiydalenmicsas) Draur nt0oleoif3iyslmDemumo u4 reoxrcia1la eauvsl()t2trio nu4ale livil()s2trx ono0oeen octytla2umnvs u0 eerxrctatlpt auvi;s0srtrxm3oodopen nesl() 2tmx ono4aleomiciydfm ul( pnt4texnir todlatrlivi t trurxm3nydopt mnctltfsrumxmont4oleoiocild sDranmon(4teenircoy1oateln sl(0texrio ou1apte fctlt s2urumo;u4aetnmictydfsDulu ont4 eenmo3iy1fptrln o;s0t2xr(m oo4omt mivta()s2urur ;o4alt mfciytla emn sn(4alxomo3iatoa  lu s t seumxm3oo4oleemicil()s2tmxmo;o1ole  f3tyslmDeluvsnu4 lxrxr oydfateai o t0teumxo3oo1lltemies sfs2trx  oo4tpx  iciysfs umu on(0tlxrmo3oadoaDe nvils0s2xrxopou1olt miviltfsDum(mo;u4tltoiieiydla2elnmonu4 lxriocoydfmD aneilt)truoim3ou1omtnmncsls srtau pou0aexnifetadlm2uln pnu4artnxo iotlp  aies;( sexrxmpoodlptnmnet s) rurxmpoo0apenmfctltfsDel( s t0 rtomf iydfmteln o;()truoimpio4apt mfcil(fa2truroot1olxnmfciysla2rlu snt4aeermf iytlm   nes;s  etrxo3oy1apte fet s  2tm(r no4teeomfctysla rl(vsnt4teenmfcto1fatraivsls0t2xoio iydalte iei sf 2urumont0altn i3iysfaDel(vp;u4 eenio todfatrau i;(0trtmim3nodame mfesa( s2rmxrp;t4aetomi3iltfsDrluvon(4arenio oatfpt  u slt)srxr(m3iy1altnmncs sfarum(m nu0oetomfeildls2rm(vs;u0 rxoiocoytopDeau ols0tetoxmpiu1oltnlfeslt)a2rmx o;t0tpenifciat aDranvp t4aeermr3iytlpt livo;s  ruoxmpny4ape  fesatfsrtm(rpot4tlxoifctlsls rmnvo;u)tlerio3tytfmt  n s;( srxmio iodopte ivtl() 2tr(mpno4oetnmf3tysfmDumu pnt0 rxnmr3oodfaDeau i t trxo(o iy4ap n ictas a2ra(m no4oee  ocild mDrmu o t)tlermrctodlat lnvi s setoir3no1olenlivt ( srrmxr ou4olxnmf3iadfsDeauvo (4 exomfcoydopDeliesl()t2toxr oudlp elict sfa2rmumoot0opeomf3iasla2ea(ms;t) etnxo3tytomD  i s;s) 2urxmpiydol nlfciltfsDrm( oou4tpeomf3iysfs uau p ()trtoxfcty1faDrlieils0s2toxrpiudopt mfvils)aruru ono1olenifeiasls rluvs;u0aexrio oo1fm rauvo t0srtoio oodom  livtlt  2rm( oou0oltnioetlt mDeanvp u)alerxf tytla r nvol()teumxr io4ll n fvi ( aDumuro;t4tex  o3ilt s2rmnmo;u)trxrxr iotlpDeauvo ( s2xoxrpnudapenlieta(faDrm(ro;u4oet  f3tat s2emuvpnu0tltnio3oa1fpt  uvo;t t2xrim3ou1lm nlnci (  Drmum ou1ape  fctatlsDeau o (4trerxociytfmD  u il()seuoir3iydll   fctlsfsDrmumo;o0tet ifetys m emu o;(4trenifctatopDean ol() rumxr iodap nlfetltfsDrm(mpot1texomi3iydfa2eauvo t0 exnxo3oydfatelies;s0 2to(mpiu1opt mfcslsfa2ta(r ;t0apx io3tad sDrmn s;u4trxnif tadfpDe ueils0 exoim ny1lpe lieilt s2uaump;t4apxomfcils mDra( p u)tlxnmr3iy1fp eln s;s srxr(o iu1lmen fei tfs2rmu ont1aetniieiatfs umnmonu0aexrmo3iatoptrlu o;t0s2to(opnu4llee fcslt) rta(roou1oexn fctlsls2elump;t4aeenio ty1lat lueo () 2toxmpiodopt mfcsas)srtr( p;u1aleomo3iasls um(mp t)aeenxr3iotlm ean i;s0 2umimpiy1om nmivsat  Duaumpou1teenmo3iltls ulu o (0teeomo oytlp rlues;(0s2uoxrpno4opt mfvtls)aDtm(rpot4opt  iciyt sDelnmont) eenmf3tatom  lnes s)t2urirpoy4ll emieslt)artmxr ;o1olxo iciadfm2uaums;t0alenxo io1fp ran i t  euriopoo1amt lnetl(f Dtm(  no1alxo iciltls rmnvont0aexrircoo1fmDeai slt  rtoxm oy1lp emneta()sDurx pnt0tex  f3ild m2emu s;t4trtomrciatlmDean olt)seuoxmpoo1lpe  nesat s2taurpnt0altnioeiytla2eln p u4trtnif ta1fateliei t0texmio iu1op   ivsa( aDtm(  ;u0aleoiieildls2emn o;u)trxoiociadla r u slt) 2tmxrpiudamtn fesls sDrm(mp;u4aleomoetydfa2ea(vo;()arermoctatom  auvo;s  etmxo3oodal  mfvt (fsDtmu  ot4alxoii3iys a umnmont4teermo to1oateluei s0tetm(m iudomeemnvslsfaDrrxmont4olxomietad s ra(mo t4teeomocoa1oa eanvi s0 rumio3oydaltnmiet (f rtax oou1tlxn ictlsfsDum(ms (0altrxrcoo1lpte n i;( seumxo3iudamtn ici (f rrmxmpoo4tlt ioctaslsDemums ()trtomf3oy1lp   nvi t  2xoim nu4lmtelnvs ()s2tmu o;o1aeenmf3tltfa uan o;t0tlxomrcoatla eli ilt)srtmiopno1lp elictl()aDra(rono4apenmfeiatfsDuaumo (0alxrxf totlaD anei s)teumim io1ope lnvi ()a2uaur ou4aleoioeiysls ul(von()artnmo3iatlpt anes;(0s2xrimpny4op  mietat) Dta( p;u4apenioctytlmDumuvs;t4tetrio3iadfp rauvo;s s2toirpoodlp   ncs s)aDrax  nt0optoio3tlsfa2uan p;u4aexrifctadomD  u s;t0 2xrim3nydolte fvt t s2tmu oot0tpe iociytlmDra(mo;()teenxrctadfa r ueol( sexoir io1lm e fctlsfaDuauro;t1opx mictadlsDuanms (0tetoif tadopDeai s;s)s2xmir ou1ope micta() rumxm ou4tex mf3ildfsDeanvo u0aexrif tytla   i s s0 eur(r nu1lltemivs t) Duax o;u1oex miciltfmDea(vs;t4 etrirciadlpt lneil(  euoirpnodlptelfviltfsDum( oou4tet mfciatla2emumpnu)texnxr iatlatrln olt setrxo3oodlle liesltf rtm(m nu0aetn fciydls ea(vo;t)arermf3oa1lp   nvo;(0 etrir nydaleemivi t)aDur(mont4aex ifetatfm2el(vpn(0arenxf3iotlmteanvil(0 rurxrpnydale mfcs t)s2ra(ronu1aetnif3tydfa2ua(mp u4tleoxfcty1fpt aivs;( t2xrim ou1am   fcsasfartmx  nt1open f3tys a ran pn(4 rxnxf3iatfp   nei ( s2toxmpio4lptnlnvi ( srrr(roou1tptomiciatfs rmumo;u)artnxf iodlp eauvol( setr(o3iu1al  lnvils) rtrumont4olenifetas m ranvo;t)trerxo oydoaDrauvi;(0 2um(r oo4olee ict tfaDra(rpot1tltomo3iadlm uanvs;t)aexnif3tatlmDrln i;t  2uoimpny1omte ncsls)a2ururpoo4oltn iciys m2ea( s;u0 rtnir oy1omD an s s0 eur(o3ny1omen fciat  Dtruroou1tpxomictad s eau p t0 leoio iodfaDr ies;()trxmir3oo1ol   nctl() 2ta(root4opt  ociad sDrmnmsnu0tetrxf ty1opD aueils)t2um(o io4oltemiesas)arumum oo4tpeomoeiadfa2rmuvp;() eenmoctotopD  uei ()trxm(m3oydlmen ieils a2tm(rpno1aleoiieils mDea(vp t0 lenxo3to1laDeaneils)s2umxrpou1lpe mfesl(  Dua(  nu0oet moctls s rlnvs t)altnmo todopt ai sls) exoirpoy4optnlfvsl()artrx  ou4alx iictasla2ran o;(4 renio3tytfmtrln s s)s2umxr iudomtemivs ( srta(mpoo4tltn i3iyd s2rluvp;u) leoio3iatfpt li ol( truo(rpnudole  ietlt)s2rau o;t0aetn o3iytlm rmnvpn()alxrxocoy1lm rlneilt0srtoim oy1open fcslt)a2rr(rpnu1olxnmociyd a2ulu s (0 etoxo3iadlm ran il() eto(opiudlmenlfetltf 2ta( ooo0opt mocild a rmu pn(4altoir oadla  au o;( trurxr3iu1ole  nvi (  2tmumoou0oltnifciyt mDuln s u0trxoxoctydop rai i;(0s2xoxo ou4aleelics s)sDumx onu4alto fciltfa2uanmont0 exnxr oydopDeanvi;s) eum(r iy4omtemiesl(fsrrrur oo0ale  oetydlm2umu o ()alenxfctadoa rlnvs ( teum(o3oy1lp  lfcta(fs2umumoou0olxn feildla umnvs t0trtoxo todopDeluesl(0sexm(opoo1ap nmncta(fsDtrurpou4oee moeiltfmDumnmp (0treoioctatlmDrlu slt0 etmim3ou4lme lnvias artmxmonu4oeenio3tydfa2ul( p ()alxoioctydfpt lneo;t texrio3oo1lmen nvil( aDurx  nt4tee  ictasfa2ra(vo;t)aetnif3oy1faDrln s t) etoxm3ou4ap   fetas srtm(r ot4tptoif3tlsla2em(vs u) lenxr3tatoa e u i t0s2toim3iudomtnmfetat) ruru oou0tex io3tatfs em( s;t4trerircoatlpDr uei (0setm(m3io4lleemnei s) Dur(mono4texomietatlm rm(mont4artrio3tytfa  anvs;t0t2urxr3iy4lm  lfviasfartm(m ;t1ope  i3iltla em(mpnt0tltrxrcoydlpDeaueslt0 2trxmpnodale mfvsat)s2raumont1aeeomoeiytls eanms;t4tleoxoctydom  auvilt0 2uoim3iu1amtemfvsasfa2rrxm no0teto fciydla2emn s t0teermfctatlmte uvs;s0trurim3io4oltelncsltfartru  no0apenifetatfaDeaumo ()teeoif tadoa  lu i;t)t2tm(mpiudolenlnvias  rta( pno0tptomfeiadfa2ulumonu4artoxrciodfmDelu sls0seuoxo nodalee nctat a2rmx  ;u1ope ifeiaslaDul(vo;t0aexrxo iatoat luei;(  rxr(opiydome mies sfsrrrx  ;o1tlt moeildlsDra(vp;(4 renio3oodfpD  nvols)s2xm(m iy1ll nmivt sfsDta(r nt1opxnmfetlsla rl(mp t4 ltomr3tatomDrlivil() 2ur(rpou1amtnmfviasf rtrump;t1texoiiciyd s2el(mp u0tetrmfciy1oa elu olt)setoim iy4alee fvtat  Dtau  ;o1tpxn ociysfs2emumont)tlxoxrciatlmteln o s) ruo(rpiu4omeemivil()srraxmooo1oex  o3iyt a ra( pn(0 reoxfcta1lmtrlnvslt) eurim iodalenmiet s)sDuax  nu1aetomoeias s2elnms t) etomo ootomDe ivolt0sruoxopio4opt mfesl(f rrmxr ;t4apt iictas a2umnmpnu0 eeoxf3oodlpD auvi;t0srxm(r oudam nlicsl( a2trum oo4opxnmociltfsDeluvo;t4 lxoxf3tadlatr uei;s s2tm(r iudlmtnliet () Dtaxrpno1alxo oetysla eluvs;t) eenmocoy1fatr uvsls t2toir oy1optemiciltfa2tr( onu0tleoioeiyslm2rlnvp (4 rtoio todfaD ln ols s2xo(o3nu4al elivsl( sDuax pot1apenmi3ilsfmDrl( on(4 lenmocta1fpD lnvi (  2xmimpny1lpte nvsls)srtmx oot0aetoifeiyd m2umu p t)alenmo3tydoaDe uvol(  2tmim iy1ap nlncsasf 2raurpnu4tpx if3iadfa ra(vp;(0altoifcoydom  lneils0 rtmio3ou4llteliciltfs2rmxmpot4tlxo fetys s um(mpnu)arermocoydfaD lueils0tetm(r iy1lltelietls) rtrurpou4alen i3iat a2emnvo t)teermf oadomt ai o;(  rxmim3oy4lpen fcs tfa2rax o;t0tlxnmo3iatls2rlumonu)tetnxr oodopt  nvol(0srumxmpno4lpenlfctasfaDtrurp;o4tlxnmi3tyt m ra( p t)trtrmr ootlmt  ieils  ruoxo nu1am emfvi sf rtauroot0aetomo3ildlm ulu p u0trtoir oatoaD  uvi;s0s2tmio3oudolen fesasfa2rmum ;o4tlenifciyt sDrlnmpnt)aetoxfcoy1fmD luvo;s0 rtoir3ou1apt mivsa(f Dtmumont1texn fctytfm2ulumo t4trxrxo oadopDrli ol( texm(o no4optnlics sf rta(rpou0apxomfctldfm umnmpn(0tetnmr3tadfmDrli s;( t2to(o3ou4omtelfvi s)sruaumpou0oetoifetlslm2ulu p (4tlenir3todfmtrln s;s)t2to(r3iy1lm  mivia(faDurx poo1ope ifctytlmDumnmo t4 rermo iytlm   nvs s teurio3iy1am   ivi t)a2ur(mooo1tlenifeild a2ranmp;u)artrxrctadom ean i;t teurxmpnydol nlnes ()arurumono4aptn i3tys m umumont4trxrxf ootlm eau ols0texrxr3nodlmte fei t sDtr( ono1alt mi3iadlaDranvs;u) lxomo oa1lptrlivs t srtrirpiu4altnlnvsa(f 2um( oou1tet moctldfa2eluvp;t4aexrxf3iytomtrlieols)sexr(mpny4olt  fciat  rrm( pot1oetnioctadfa2rl( s;(4 lxriocoadom  ai o;t s2urxr ny1lm nlnvtl()a2raumoot1tpto octadfmDelnmont0trtrxr3ty1lm r i sl(0trxmiopno1lp  mfetat srrmu ont4tpt  oeildfm2rmuvon(0tlerxfctatop elies s)texr(r3iudllen nct s)a2urx  ot0aptnif3iyslaDelu p;u0texrirciy1fpDr ueil( t2toir iy1omtelieiat a2tmu p;o0oeenmf3iatlaDrl( p;t0 eeomocoodfpt aueols)s2trxo oodapeelfet sfsDrr( p;t0tpxn oetat aDran s;t4 rxomrciadoate n s s)srtrxopnu4alt  nvtl(  Dta(  ;o4tex if3tld a rlump;(4aeenxo oytomtrluesl( trumio ny1ape  fvi (f Dtm(m nt0ape mietltls el(ms;(0 renir3iadopD  ivi ( trxo(o iudamte ivtas)sDtm(m ot0tlt ii3tyt m2rlnvs t4texrio3oo1om   ivo;()t2trim3nudam  mnei ( aruaxmoot1ape  f3iatfm2ul(mp;()alenmr todla   uesl(  exrxrpno1lmen fvtlsfaDurx ono4aptoifeiad s emn pnu)arxnircto1fmtr n sl(0 2uo(
\ No newline at end of file
@@ -0,0 +1 @@
+u o t  2xo(r3oydomtnmnetls  Draur no1alxnmi3ilslmDra( s;u4 exoxr tatfpt ln o;t0 eumxm3no4al nlict ()sDumumpou1optomfeias mDrluvsnu0trxnxrcto1lpD  n i;t0 exmxr3iodaptnmies ()sDumumpou1tptnmf3ildlaDumnmonu) rerif ta1fm elu i;t0 2uoim ou4olenlneiasfaDrmumpnu0aleo i3iyt s em(vo;u0artoxf tadoptr i o t0texo(m3iy1lm  mieta(f 2rmumo;t1apxomfeiltfa eluvsnu0 eeomf oa1latr ivols  2xr(rpoo1lp  mies ()a2urxro;u4oetnmo3iyslm2rmuvo t)trerio3iy1fa   ues (0s2toir3nu4olenmfei s sDur(m nu1tetoif3ilsls umu snu0 lxnmf3ootfpD anvi s srxoxrpnydapenmncs t aDrr( o;o1oexoii3iyslsDranvonu) rtoxr3ootoateaneo;()s2xo(m3oo4omtnmnvi (f Drmurp;t0altoii3iysla rmnvo;(0aexnxocoo1lpDe nes t)setmirpio1ap nlfei s)srra(mpno0apeomoeiysla raump;()texnmo iotlat luvi;t) euoxopny4al emnvs (  Drm( o;t4aptn feiaslm ua(mo ()teerxf3tadlatrlivolt  2ur(rpiu4am e fctl(f rra( ont0optn feiat a2rl( o u0trtnmr iatoa   nei (0trxoxo oy1lltnmfet tf Dum(  ;u1teeoifciys s ul(mon(0trxrir ty1laDeaneslt) eumio3no1al e nes s)srrrxr nt0tlxoiocilsfm2eau p;t0 exnifciytfpDeai s t)trxr(o oo1lmtn nes (fa2trxm ;u4tpenifcilslm2umuvsnu0 renmrctotfa  luei;t)t2xrir3oo1lltnlivs ()a2ur(rooo0tpt ioeiysla2el(ms (4altrmr3totfm eluei;t)t2um(opoudop   ivsl(fartrx  nt0olxnmi3iydlmDul(vs t4teerircoa1lp rluvo;s0 euoimpoodaltemfet sfs2uau p;o4tee mietlsfsDua(mpn(4trxomr3oadla  anvslt trto(mpiu4aptemfetatfartrxr oo4ope mf3tadfs rluvpnu4alxoio3iadom ean i;()s2xrir3io4al   ncs s) rra( p;o0aex iictyslaDul(mo t4tetrxf ia1op  lues;t0 2xoir3oy1am n ieils  rtrx ont0aetoifeiysls2rm( onu0alenio3oadlmDe n o;s)s2xm(r3oo4ol nmnetlsfsrumur nt0aexo feiysls2emnvs;u0artoio totfpt aiei;t0 rxoxo3ny4alte fet ( sDuaum nt4tpxn fetytlm2ulnmp (4arenxo3iotfatelnvs s)t2tmimpou4aptnlnctl( srumx ont1optomoctasfsDemuvp t0 rtrio3ia1oaDraues t0teumiopiy4amt licta( srtr(  ;u1oexnif3iyt mDeauvpnt0aeerxf tydlpDeaneils0srxr(m3ou1lp e ietas) ruau oot4alxo o3ilsfs umu o u4arermfciydop  ln s;(0 2urim3nudape lneiltfa2rauronu4tee iieiltfmDeaump t) ltrifctadlptrlivilt0 eto(rpiudlpt  icia()arra(  ;u4aeeomiciatls2em(mp;(4 reomfcoa1om  aieils0 2tm(r3nodom elivslt a2ua( pno0teeo oeiydla ea( snt4alermocoy1omD an i t srxrxm ou1lmt livi s  rrm( pou0opx iictasla umnvs (4aeenif iy1op eai o;(0truoimpio1oleelnvsa( arrr(  nt1tpx iiciyd s eanvo;(4arxnirciadlaDe uei;s s2xoxm3nu4amenlicsas)arumu pnu4olx  fctldlaDrm(vp u0teenir oytfmte n ilt trxmio nudaltn ivslsf rtmur nt1aleo oetytfa2em(mo u4aeenxf iatlateli i;t t2tmxr ou4opt mnvia() Draum oo4oeeo fctytlm2uau o t4tlenifcoadom rlu slt0s2xrxr oudlmeelnctl()sDur( ono4apxn ieias s2em(mpnu4altoif3totop rauvilt0 2toim3iu4altemivi s  rrrxr ;u1alxo ocias m2el(vp;()aexnxr3oy1oa   ueslt  rxm(m oo4al e fctlsfs2umu  ;t1oleomfeiatlmDemuvsnt4 lenxoctatopt  i s;( t2xoxo oy1amtelivi tfaDtr( ont0tpxoioctydfs2rlnmp;u)trxrmr3todlmtr ivolt0 2xr(m3io4am nlfci (  rra(m ;o1opx io3ias m2eanmon(4 exnxr3iydomt aiesl() etoxr3io4lleelietatf Durur ;t4aexnmociyslaDrlnms;(0aeenmrcoodfpt ai il(0teurxo iy4ap elfvt () rrr(mono4oltnmieildlsDea(mpnt)alxnir iatfpt ai ils) exriopio4lleemiesatfaDumxm ;u0alx mo3iadla ean snu4arxomo3oo1faDeli sls  2tr(r ou1ame mivta(f 2tmu oou1oltoif3iltfs2rlnmpn(0tlxrir3iydfat  nvo;(  2urir oo4oleemieilt) ruaumo;t4olx ifctyt s rm(vp u) lenxo iotfmD aiei ()t2tm(mpio4aptnlfvsa() Dtmum ;u1oeeoioeiatfmDuaumo;u0aeenmrctotfmDr neols tetoxm ny4lptnlfvtl()s2rr(mo;u1texo fcild m2eaumpn(0 etrxfcoytomt au il(0s2tmxo oudlptemncsas s2umx onu1aet iociytfm2elump u4trxnifciatfp r n i t)srtrim3oo4lpenmfvia( a2ua( pnt0tpe  o3tadfa rmuvon(4aetrio tydfa rlieo;(  2uoio ou1optn fvt sfs2tmu  oo0apt iieils a elnmp;u4texrmf3ia1lptr ieo t t2xoim3iydomenlieiatf Dtaurooo4altn fciys mDrauvsnu4tlxomo3oy1lp elnvi (0s2xo(r3iy1lmenlicilsf rtm(r no1aptn fetld m rau p;t)aeerxr3tatfp  aneol()s2xo(rpny1lp   iesl(f Dtrxm ;t4tpe  oetas sDra( pn(4 renxociadlp eaues;() rto(o3no1omee nviatfsrrm( p;t0ape io3iys s2ean snu0 renif iatoa e n ils)trxr(rpiydom e ics tf Drrx ont0ope miciatfs rm( pn() etrxo iadla rlueo;s t2um(r3iydaltelncias arrmur nu1tlxomiciyd m emumo u)alxrmo oa1oa r n s t) 2umim3oy1ole lnciat  rtmu o;o0tlt  ietltlsDea(vsnu)aetoxo3io1opD anvo;(0 2uoxr3iy4alenlncs s)srrm(rpno0oetomf3iyt a2umn snu4 leoxf iatomD lueo t) rtmiopnu1amen nvtlsf 2raumoou4tet  fetadls2ul(mon()arxrxocoa1fa   u ols  rxr(o nu4ll nlfetat s2rmum ot0apenifeiadla rmnmo;u)aexnxf oodfp  ln s;t s2xoir3ny4ll e fcsa(  rtrxr ot0alx  i3iasfs2rm( o;t)texrmo todfmD ln o;()srur(r3nudll elivt (fsrrmx pou1oetnmietlsfmDuaums u0arxnifcoadlpte n o ()trxrimpnodam  lfvt () rraxrpoo4olxo ociad mDrmnvp ()artriocta1fmD luvi ()s2xmxrpnodaptnmivi (f rrau p;u1aetn feiysfs2emu s t0trtnircoa1fatean s;t0s2tmxm io4op emnct t  Draxm ;u4oeeomf3iysfm2ulumpnt4aeerifctotlmt auvolt0 rxrxmpoodomen fvt ( srrr(ro;u0opt  ictltfaDumnvp t)arxrmo oodfpD aiesls0trumir3oodlp n iesas  rtrump;u1aexniietld s2ul(vont)arxrif3tatop rlieo t0seuoxr oo4lm elneta( aDtru poo1opx  f3iat aDelnvo;(0aeerir3ootlaD  ueo;( trtmxopiy1olt mnet tf 2uru  ;o0oetnmoeiaslmDrmnvo (4tetoxo3iotlpDeli o;()tetmimpou4ap emnesatfsDrmx pou4aetomfeiasla ulums;t4aexomociodfpt  u o () rxrimpno4lle miet s  Duau p;u0tle moctyt mDulu p;u0aeeomo iodlmD anes;(0 2xo(mpiy1altelnvtltfarrm( pnu1opt ioctyslm2emn pnu4 eeoxf to1lm raieols seur(rpnu1ope mnci s) Dtrum ;o1ope  iciatfm ea(vont)tlermfcoatlmDrai ilt0t2um(rpiy1ope mfeta()aDum(  oo1olto feiat aDumnmpn(4 ltnmfcoytla e u s;t)teuoxr oo4lpt  ietl( srrm(m ot1alxnifeias m2rlnvsnt4tleoxr oodlatelivils0 rtrir iy4al elfeiltfaDtmuronu1tetomf3tytfmDumnmp;()alermr iadlaD  uvols)seurxo3oydoleelivsat aDtrum ou0oltn i3ils a2ran s u)artnif oytopt  ueslt0t2um(rpno4lm  lfeslt  rtmur ;u0oee mfctydlaDul(vo u4 rtnxr iadoa r neo ()s2xr(o3oydam emncslt) rtr(ro;o4apenioeiasfs em( s t0 rtrmf tytfa rlu o;s0s2ur(m3iodlleelnet sfartrxrooo0altnmoctlsfs2emn pnt) lxnmo3iodlmtrluvols0trxmirpny4apt mnct sfaDum(m ou1ape  o3tatls emn sn(0aetoxr3iadlm r ieol()srxm(m nu1alt livtls)aDua(m nu0aee  i3ils mDulnmo;(4aeenxr tytopD anvi t s2ur(r3iu1am emfes sf 2rmxrpoo0alxnmo3iydls2emu o;u4aexnifcoadlpD  n i s  etr(r3oy4lpte ici t  ruru oou0opx if3iasfsDulums;t0aetnmo3tydfpDrlnes;s  2uoxr iu1am n nvsl(  rrmxmo;o0apx mfeiysls2eanms;u0 etrmf3oa1oateaueil()s2xoxopny1am  mnetatfsDurum ;t4apx miciysls2rln s t0altnmrcoy1opDe iei;s) euo(o3no1amen ncs (fartr( oot4opto o3iyd s ulnmo ()tlxoxrciodoptelieslt)trxo(r3nu1al e nci () Drrxmooo4tex  fciltfaDelumsnu0texoio3oodlpt ai sls0srur(r oodop elnetlsf Duru ont1aexo fciasla uan pnt0aexrxoctotfaDraies t)t2toxmpoy4lle  ncslt sDurx pou0alxnmo3iatfs uaumpnu) eerifcoodomDeaueo ( texoio io4ole  fvia(fsruaxr no4optomicild m2ul(ms;t0alxnxf3oodomt au o s0 eto(rpno4alt mfetlsf Dtm(m no0aleo ieiltfsDraumont4alenir3oodfpD anesl()t2trxr nu4lp nlnvsl() Dumum nt0apenioetydfa2um( s t0tlxrxf3totoaDr nvil()tetm(rpio1ap n ncsa(  rrr(mp;o0tleo feilt sDuluvs (0 rtnxo3iytfp rluvsl(0 ruoxo3oy1op  lietlt) Dtauront4aetn i3iadlsDrm(mp;() reoxo3io1lpte uvils0setoxopiydaltelfviatfsDtm(mp;u0alxo o3iat m eluvsn(0 leoxo iy1om   ies;s)trxm(o no4al e neiasf 2ua( o;u1opx mi3iadfa ulumo;(0 ltrif iotlate ivi (0 2xmiopoo1aptn fctlt)sDtmum nu0aexnmociytfs2umn s;u0 exrxr3oa1lpt lueil( srur(r3oo1openmncsasfs2tmump;o0apx iietydfm2rmnvs;(0aexnxr3iy1optrlnvi t  eurirpoudalenlfvt (fa2rmurp;o1oeenmo3iyt aDrlnvpn(0arxrmocto1fatrli o t0t2xmxr3oydalenliesa() rum( o;u1aet mietlsfs umn o;u0aexrxoctytfptr nvs;t)srurimpnudlme  ivtl(  Drru p;u1tlen f3tldfa rmuvsnt4 etoifcto1fmD an s;t0srurxmpoy1lptnmfvtas)aDtru  ot0aexnii3iad sDumuvo;(4texrmo3totoatelu ils  rum(opiudom  mieils  Durx  ;o0oltn o3iasfa uan o;t0trxrxr ia1oaDeanvs t0 2xrxrpiodol emfeia(fa2ur(mooo0aee io3iyt a2umnvp (0tetnmr tytfp e nvi t) exr(o oydaptnlfet (  2rmumpno0altomoeiytls2um(vont4 rtrmf iydfa  au i (0seuoir3oudop n nvsls)s2taur oo1ope mf3iltls rmnvs;(4arxnmo tydlpD luvo;t)trtrxo3oudapeelnct (fa2taxr nt0tex iictysls rl(vs u)tleoir tadomt  uvs t srtrir3nu1opt licil() Drrumpnt4tetniocild s eauvs (0texrxr3ootop eaiesl(0s2xoimpnudapt  fetas)srua(mont4aexnmf3ildfm ul(vp t0tltoxfctotop e iei;(  rur(o3oy1lmen iei () 2rmur nt4apxnifcilt m rmu s () etnmr oadoa  lneo;t t2xm(rpnudlm emivt t sDumxmpnt4tpt  iciadls2ua(vonu4aeenio3iy1lmteaneo s0 euo(o3iydlpeelieil() 2umxro;o0alt  oeiyt m2umnmp;u)artnmo to1laD  u sl(0 rumirpno1lmt  fcias aDtrxrpno4oexo feiydla emu pnt)aetoir3iodfa   i i;(0 rurir nu1lm  mnct tf Drru pnt0optniietys m uln o (4aleomo3iatlaD livi;s) 2tmim oy4optnlfei ()sDtm(m nu4alt moeiaslaDrl(mpnt0aexoif3totfmD  i ils)s2to(m ny4ope liei tfartr(rp;t0oexo feiat m2ulumpn()aetnif3oatfp r ivo s0t2uoxr nudllee fcils)aDumu  nt4olenmoetyslm rmn p;(4trtoxr3ta1om rli i s) 2to(m oo1lle lnvia()arraxrooo4texnio3iysfsDrmn p u)artnxoctatlpDrlnvs;t0sexr(r3oy4ale mnvt s)sDua( pou0alx  iciatfs2ulu snu)teermr oadoaDr u ilt)s2xmxm iu1al nmfeta() 2rrumpnt1alen f3ilt sDemnmpnt4trtoxrcty1lpteaueo;t)setr(r3iy4olen nvtat  2trx o;o1tlt moctldfmDeluvo;t)tlxomf todop eluvo;t)s2urim3io1ap e ivtls a2trur oo4olenioeiys m2raump u)aeenxf iydfmD ln s;t)texr(o3ou4opt mnci tfa2um(r no0aex if3ilsfa2ul(vs ()tlxnmo3ia1op raneo ()s2tmxm io1alt  nci tfsrtr(rooo0aee io3ils s um(mpn()arenio3oatlp rlnvols0texr(mpoy1amee ies ( aDra(  ou4tpenmfciatfa2ranms t) etnxrcia1fpDelnei;t)setoxopno1amtnmncil(faDrrxmpoo1tle  o3iytlm2emuvpnu0trxoiocoydfmt  i o t0t2xriopno4alt livi (fa2taum nt4tpe ii3ils m2rmn pnu4trxomo3oydfa e uvi (0teur(m iodlp  lnetls a2rm(m ou0tlenioetydfa2ulump t) etoir3ia1fp   ueo (0 rxoio ou1omeeliviat)s2ta(mo;u0oeeomfeildfs em( p;t)trtoir tytoaDrlnvi ( trtoxrpiu4lmeelies sfarururp;t4aetn oetasfs umnmonu0 eenio tydlpt aneo;( t2xoxr oudol e fvsa() rtau  nu1tlxoiieiaslaDrauvsnu)trtrmrcio1omDe ivols texoirpno4ame  ivsls s2raum ;o1aeenmfciytfm el(mon(0altnxf ta1omDrau s;s0sexmxr iu4oltemncsatf 2tmx  ot1apxomicildls2eauvs;t) eenmrctodopD an ols  eum(o iy1lpt livi s  Drmx  ;t0ole  oeiasls ra(vs;(0 lxrircoodlpDe ieols) ruoxm3ny1altelnesa() ruaxrpoo0tetnmo3ilt aDrl(vp;(4alerxr3iadfa   ueo;t) rtm(r3no4lme mivi () Draum ou4oetnmfetatlsDemnmsn(0 eenmf tatoaDe u i s)srum(mpiu1lpe  fvt (faDtaxmpnu4olx ifeiytla emu p;u) exnmf io1fp raiei;s)sexrxr3oodlpt  ieslt)aDumxmpnu0ope miciysfs2el( on(4tetrxfcty1oaDran slt  rxr(r ou4lp nmnvsas  rraxmonu4texoif3tlsls2rm( on()trtomf tadfa raies;s) eurim iy1optnmncsl(fsDra( o;t0aet  ietyt m2emu s u0tltnxrctytfa   nes;t tetr(opny1openmfcs tf Dtrx  nu4tpeo ietytlmDulnmp u)aexrio3iytfpt lnvils  etmimpny1amenmnetat)s2uau ono0aexniociytfsDumnvont) exrio iydoa  lnvs;t0tetr(mpiudlm elfcslsfs2tru ont4tptnmietyd aDumu p () rxomf tadfptr n slt0t2umim oy1olee nvilsf 2tm( pou4oex  o3iytfaDumnvs;u4aetrmfcty1oaDelneol()trxm(m3oudll elietas artaxrono0tpt  ictldfm eaumo t0areomfcio1om   ivslt srtrxm nodlp nlfvil() ruax poo1olxnmociyd aDea(mp t)tltoxr3tydlp ran i;()s2xrxm3nu4lle  ivt t)arraxmpnu4teto fciytlaDrl( ont4aexrif3tadfatelneo;t)sruoio iy1lp emfcils)sDraump;o4aleoioetasla2eluvs;(0 exnmf3iadlpteln i;t) 2tmio nudlpe mivslsfa2taumpnt0tpe  feiaslmDumnvpnt) renircoy1fpDe uei;(0setm(r3nu1aptnmfvt (f rrrx oou0aetnmf3ils aDrmuvo;t) etnifctadfmDrln i s)t2ur(mpoy1apt lncslt s2umu  ot0tee mfctytls2rmuvp;(0tlxnio ta1omDr nvilt0sexo(opiy1ape livtas s2ua(m ot1apt moetaslm2ean s;t0aexrxr3oo1la  lieo;s) rto(rpoy4op nlnctls)sDrmxrpot1aexoiieild mDrmu on() rxrxfcoytlp eauvolt trxrir oy4al e nvt t) 2rrxr ot0aee mo3ilsla el(msnu4 ltoxf ta1fm r ivo;t)s2xmir io4ale  nvi tfaDtaxrpnu4opeomoeiysfsDrl(vs u4 lenir io1fpte i o;t0srurio3nu1lp  mnvi s)srurxrooo4oeeomfeiyd mDumuvonu4teenmfctydoat  iei;s t2trio3oodap nlnviasfaDra( o;u0opt mf3iltfm uluvpnt)tlxrmo3iy1fp raivs;()texrxmpou1ap   ncs s) Dumxr ;u4aleo ieiadfaDrm(mpn(0arxomfcoatomteaivi (  rumxo3ny4ole mfeil( s2uauront0tle  o3iasfm2emuvp;t)treoxrcoodlmt au o t0s2trxrpnu1ol   ictat  2tm(rono4alen f3tldlaDemump t) rtrif3iatfmteli s s0 rxrio3nu4lme  iesl(faDuaumo;t0tetoii3ildfs ul( snt) rtnxo io1fptrai i;t0seuo(m3nu1llt  fci tfaDum(mpnt4texo ocils m el(vp (4alxrifcty1lpt luvo t teuoimpoudoltn fcs ()sDuaumo;t0tpxo f3tltfsDraumont0tltoxr oydla elneo s0 exr(r no4apeelnvi s) 2tmxro;u1oetoii3tadls2um( o;t4arxrir3to1fa  luvs;()sexrxr3oy4lpe  iei s arrm(mpnt4tlxnmo3iltfs2emn pn()aleomocta1lm rluvi s0 rtm(r3nudlleemfetl( aDua(r ot4apeo ietyd mDemn p;(4areomfciy1oaDelneo;(0 etmir3io1ole  fcta(faDta(ront0tpx moctydlsDean snt) etoifciatom e nvs;s0t2umir no1lmtn ieil(  Durxr oo1apeniieiat m rmu o u)alerxo3ta1omte ies;s)setmxr3iu4ap e neta( a2tr(r ;o4tetn icildfm rauvs;(4trxrio oatlatelivo;()truo(r nodamt  ivtls  2uau  ;u0oetomfcilsfsDrm( s;u)aeermr iy1op r uvs;s  2xm(o io4apenlncslt a2tax  nu1optn oetys m ra(vpnu4trenifcoy1fate n o;(0 2xrio oydol   icil( aDrmxmo;t0oeen feildls rlnmp;u4trtnmo oatlatraivi;s) rtmiopio4omtnlivils) 2urumpoo0altoiieiydla2ranmsn()arermo iodlm elivilt0 exmio3ou4alte fesas s2umu pnu0opeo ieiasfaDeau snu)tlxnmfctadoaDe u o t)tetm(r iudll  mfcias)s2rmxm ot1altomoctatlaDuau pn(4artoiociotfm elnes s s2tmim oy4llt liviasfa2tmx  ot4olt iocild s2um(vpnu4areoxo iadlaD  u s;()texm(o oo4lp  lfeilsfartmum nt4oleo ocild sDrmuvs;t0tetrir oa1lpteauvs;(0seuoxrpnudomtnlivi (fsrrmxrp;u1oleo iciltfs elu pnt4 lxnmocto1lp raivo t)texoim3nydlpen fet (fsDtauro;u1oee  octat sDulnvsnt) leomo3oy1lmDe nvi t tetrxm nu1ll   nvsls) 2trur ;u0alxo ociys sDranvo;u0 rtrxfcio1fmteanvi s0s2um(m3oudom e fet sfartr(r ou0alxo o3iasfmDumu s;(0 rxnio3oydoa eau i;s sruo(r3oydlptnmivt tf rtrx  ;u1oet  ociad s umuvp;(0alxomr ootfm  anvi;s  etrim io4ame  fes () Dtaxrono1oet moeiydfa2eauvs;(0tetrxrcoo1fa  li o;s)teuoiopoy4om nmfvt s aruru ono0olen fetadlm uln s;(4alxnxf3oo1fptrai ils0sexrim oudaleelivtat)aruau o;t1tpxo octas m rlu s u0trtnmr oatomDranvo t) ruoim3ou4ll  lneil(f 2trur ot0tlxnmi3iat m rm(vp t4aexnircootlpDean s;( setoxr iydam   ivtasfs2umxro;u4oee mf3iysls2ua(vo (0tlenxo3oytoaD lueo;s)srxo(rpiodomenlfvtl()sDraumoot0altn ocilsfa2rlu pnt4trxnxf3oatlp eanvolt)trxrirpno1amee fcsls)srua( pno0aexnii3ils s uaums t0 rerif3todlat an ol(0srto(mpoo4lpenmneias  Drrxrpno4tlx moetat m2rluvp;u)trtoir3ootlmDe u o;t tetmxm3oo4lm  mnvs ()s2ra(rpot4tlxo i3iytfm2eanmo t4 eenmr todoa  ln o (0 2uoiopny4lmee fctas)a2umumo;o4aleoio3tyd m2ra( s t)trxnxf3oytopteaiesls0t2uoir nudlpenmnvia( s2tr(r oo4oexnioeiys s elumpnu4artnxoctotomDr neolt t2to(opiodol elfcsltf rrrx pno0tptnmf3iyd m ua(vsnu) etoifcto1oa   u il(0sexm(r3no1olen ict t)srrmxmo;u4ope  i3tadlaDuaumo;() exnmr iydlaDranvi t s2to(opnydom emiet sfs2ururpot0tptn feils sDemnvpnu0trxrio io1la rauvs;s0srxr(r3ou1ame  ivilsfsDrrxr no0oltn fctld s umumsn(0 lxnmr3to1lpt ln i;t tetmxo oy1ap  mics () 2taumont4tleo feild s2rauvo (4trerxo ia1fmtr nvs t)t2urir3nudale mnet s s2ra(r oo4tpen o3tlsla umuvs t)altrxr todoaDr nvi;s)srtmim3nudlltemies sfsDur(r nu0tltnmoeildfs2uanmonu)teerxo iadfp eau s;( seumxm3nu1aptnmncil() Dua(rp;o0oeeo oeiytla2em(vs;t0tlxrmo3ty1opDrlu s s s2xo(o3no4olee fvslt aDrrxm no0ale  oeildlsDum(mpnu0tltnmo3iydoaD  ueo t) eum(opoy1olt  feslt  2tm(rono0ale io3tlsfm2rm(msnt0altnmf ta1lm  luvs () exoxr3oy4ape mnctas aDur(  ;o1oeeo iciasfmDeaums;()trxoxfciy1lmDe i s;()tetoxopoo4om elnetltfsDtmurpoo1tpeoifeias m2ul(vsnu0trenir oy1fa e nvs;t)srtrxm3io1lm   ivia()srtru  nt0apenifctydlsDeauvsn(0 rtrxo iydoaD anvs (0 rum(opiy4olen nvi tf rrrurpnu1tlt mi3tatfmDemums;u0 rtoxociytopD aueo;t sexrxrpnu4ol  mfetatfarurur no4oetnmoeiadfa2rau p;t) eenmr3ty1laDrai s;t sexmxr3iudape  fvtas) rtaxrpnt1oleomfeiydfsDran pnt)trtoxr totfmDeluvi;s sexm(m oo1apt mieiltfsDtm(ront0aptnmfeils s umu s t0 ltnio3ta1lpteaies (0tetrxmpiy4olenmnci ( sDrrum ou1tetnmiciltfa eauvo u4 lermf oatfaD an s;()t2uoim io4lp nmncil(  2rrx ono4opx ii3iad a ul(vs u0tleriociotla raneil() rumxr3iydoptelivils  2um(  ;o0ape mfctytfs2rluvp;t4alxoxf iodomt  ivil(  rxrir3iydopeelncsat)a2tauro;u1alen ocildls eanvo;u4trxnxo3oatfmDeaieslt)srxo(mpiy4aptnliesat a2rm(  ou0oet io3iys mDrluvp t0arxoxrciotom rln s () rtmxr3oo1apte feta( sruaxrpoo4apeomi3tltls ua(von()tetrmf oydoateauei;s0 2urxrpoy4lle  iei (fa2ur( onu4oltomietytla emn sn()arxnmo3iydomtelueilt0teum(m io4alt mieiasf rrru p;u0apt ifeiyd s2emnmp u4trtoxf todlaDrlu slt  etrimpnudom nlictlsfartm( pou0aexn o3tlt a el(vsnt)texrmf ty1lpDe uvs (0texmir iydaleemivtat artaumono0opeoif3ildla2uluvsnu4 lermo3iadla elnes;t)trxmimpou1ome micilt)srtr(m ot4tpx ii3tltfm emu ont4 exoirctytlm raneo;t0tetr(r3iodop  mfvia(  ruaumpnu4alen i3iyslm2elumpn(4arerxf3oodfp ran s t)seto(m3ny4op nlictl()srurxmont1aeeniieiydlsDua(vp t0alerirctotop e i s;t srxm(r3iy1lltelivsa(fs2uax p;t0ope mf3tasfs2ulump;u0tetoiocoodlpt  ueo;t0 rur(m io1opeemieil( a2urum ;o4tlxoifeiydla2rmump;(0alxrxo todlaD ai ilt)tetrio oydom   fcsasf Dur(mpot0tlxomociadfm2rln s u4tetoxrciydla   i o;(  ruo(m iodap   ictat  Drrurpno4tlt ioetas aDea(mo u) leoxfcoydfpD aies;s truoxo oy1om e nesas arrr(mpot4olx moetytlmDean o u)artrir tytlmtrlnvi;t0sexmimpiy4am   feil( s2rmu  ot1teto ietasfmDrmu p;u)tetoiocta1oa eaivs t)t2xoxmpnu4al nlivt t) Drau pnt0oeeoioeiatfa elu o;(4tltnxr iy1fpDe ues;t0sruoio3iy1lltnlictl(f 2taxrpou4aeenmfeiasfaDrmuvo;t0aexrmrcio1fmD aneo;s s2ur(r ny4amtelict s)a2umx  ;t1oleomoeiysfm2em(vo;t)aleoxo3oo1faDeaivils  eurxr oydaleemnet ()a2rr(r no4alen f3iys sDul(von(0aexoxo3ootomte uvslt texmxm nudlltnlivsa( sDur( o;o1apxn ieils s2umu s;(4tltrxr3oadomD  ueilt)teum(r iu4am   ivi s  rtm(m oo0tpt iociad a2eau pnt0 etnxrciadlate u s ( teurxo3oo1apenlnvt (fsDrrxrpou1aex  o3iatfs umumpnt0aexrmrcoadom   ivi t)t2xmxopoodapeemict sfsrtrurpou4olt  o3ild sDra(mp;(0 rtnmo3tytoa  aieo;() etmxr3ny4ap n fvtas aruaxmp;u4ape ii3iyslm2ulu onu)aleomoctydopteluei;()s2xmxr3no4ll   iesasfs2umxmo;t0aet  icild a el( o;u)aleoircoa1om rluvo s)s2tmim oo4lm   nct ( srrrxmo;o0olt ifctatla eau ont4trerir3to1fpt anvi s0 rurxrpoy4omtemfeiatfa2rr(r ot1alxoifctyslsDrl( p t4 ltrxf io1lm eluei t srxmir3oydomen ivt (  rua( pno1apt ifetldfaDeluvs;()texnmocoatfpte neols0t2uoiopiy1ll emfvsl( s2tr( o;t1oexomocilt m em(vo;t)teeomf oo1lpDeau ol( texoio iu4lptnmnvs t)arrmxmp;u1oeto i3tlsfa2ulu o;(0trtnxf oadoa  anes;(  exmir3ou1ap e nvslt)a2rm(r nt0apt mictlsla2em(mo;t4 lxrir3oa1fa  li i s sexm(r ou1olte nesa( aDuaxmpnu4oet ioeiltfs2rm(monu) eermf3tadfpD livsls0srurxrpoodomenmfvia( s2ra(m no1alx  fetadls rmnvp (4arenxr ty1lmtranvo;( sruoxo3io1llee nvs s) 2tmxmp;t4tle io3tatlaDea(vpn(4aeermf oy1fmt lies (  etrim iy4lmt mnes t)arumu pot0oet ioctlsfa2ul( pnu0 etomocty1lpDelieolt0 etrxm3nu1lp e nct (  Drrxrp;o1aeenmfetat aDuluvs;u)aeenmr ootlmtr ues;(0srurio3nodll  mfcsltfaDur(rp;o1teeo f3tasla uauvp;u4altrxo tydom r ueo;t0t2uoxr3iu4apeelfciatf rrrur ;t4oleo i3tys sDua(mpn()altrxr3totfpD au ils)tetmxm oy1lmtnlnetls  Drr(rooo1aeeomoetydfm2ranvs t4aetnmr3tadopDrlneo;(0srtoxo nodoleelict sfsDrr( ont4apt mo3ildfaDrlu p;u)teenmo totlmDrai ilt trtm(m3oo4apenlncilt)srrax o;u1altnmfeiaslsDrmums t)aexrif3oo1fateaiei s0 2xoirpnydom  mnctlt) Drm(mp;o1apx moctltlaDeln pn(4tlxnxo3iydlm e iei t0s2um(m3iudamtn fcta( aDumuro;o0apxn f3iatlm2emu on(4aexoir3iadlaDe uvo;s setmimpio4altnlfcil()s2tmu poo1opxnifetydla um(vsnu4 ltoirciotlaDrli o (0seurxo3nu4al  mivi (  Dta(  ;u0olxn o3iytfm2ul( o t) eeomo3tatop   u ol()trxr(o3oudom nmfvsat  rua(m o
\ No newline at end of file
@@ -0,0 +1 @@
+ieol(0setm(mpiudaltelneslt)s2uax  ;u4aetniocildfs2rmnvp;(0tlxniociytfpt ln ilt0t2toir3oydaltelnvt (  Dtrx o;t4aexo f3iatfm2el(vs u4 exnmo3oytfaD  uei;(0seurxo3iy1om emncil(f Dur( ono1openiociydfs2uau s;u4 etnir oatlmt anvi s  2uoxm iy1lpenmivs ()sDtaxm nt1open ictad m2uauvp u0altoxrciytfa e u i ( srxoxo3nu4omenlnvsl()aDra(ront4oleo ieiadfaDrlnmpn(0arxrmocia1fa eai s;s)tetoxm3oy1amenlnctasfarumxroot4alxn f3iadlm2ulu p u0tleoxfciodlm  aies t)srxmxmpnu1om  mivsat srtaurpno4tlt mfeiysla2eanvo;t4 rtrxr3oadomtrliei (0seurxr oy4opeelfcia(  Durx p;t0opxo oeiytfaDeln p u) exrmo3oodfpteluvs;t0tetoxo no4am  mfvta()s2tmxr nt1aexoio3iyt a emumo u0treoxo tadlaDraivs () 2umxr3iodlltelivtls sDur(  nu1oeeo ocilt m2ulumo (4teeoif3ia1omDrlnes s s2urir3oudlmeemict s aDtm(rpnt0olx iictatls2rluvo t4 renmfciydfmDe ieo s0s2uoxo3iydll emicsasf Dtm(r ;t0tpxoifeiydfsDelnms;u)altomf3tytoaDe ivslt)srxm(r3iu1oleemiesas sDta(  nu0oleo fciyd m2ean s (0tetnmrcty1oaD livi t0srtm(o3iu1ale lfvsa( sDra(mp;o0aptn ietlsfa2rlumo t0arxomf totlaDe ueo s0sexmxr3nydolte nci sfs2truroou0texomf3ilsla2uanvp;u) eermr3oo1lpD  n ols  etrimpny1alen net () rtrxm oo0tle mfciat s2emnmonu0 renmfctadlp rlu s;(0t2xrxr iu1alt  fcta(fsrtmx oou1tex  fciasla raumsn()aetnio ty1laD  i s;t0tetmxo3nu4ole  fetlt)aDum(mo;u0tpeo i3iydls2elums;(4aetomo iydfpD lues;t)srxrim3oy1al  lieilt srua(roou1tlxoifeiydlm ul(vo;u4 exnif3tydopDelneilt)trumim no1lpt lncil() rumxmonu0tleomf3tld sDuaumo;(4alenmfcoy1fa  livs;t0 etmxopiydalte ictat)a2rmumpnt1alxo o3iatfm ranvo;(4 eeomf3ty1lptelivi;t) ruoxm ou1apt mnetat sDuau poo1altoifciatla2em( s;u0teeoio iatfaDelnei;( setmimpou4lmenmivilsfarrr( o;t1aeenmoetlsfm2rm(vp;t4aetrxr oatlmDrln ols0setmxrpnu1oltelfcia()srtrx p;u1ope iociydls ea( o;u4 rtnir tatoa r u o;(0 euoim iydlm   fctat artmu o;o4tpxnmiciyt m um(mo t0arxrxocia1fat luvs (  2tr(m3iu1lm emietl( artax p;t1aeeo oetytlmDelu s;()texoxfctatlm eliei t)setoir3oo4apeemfvs s  rtm(m ;t0tlenioeildlm2rmu pnu0aeermf3to1lmt lu i;s0 2toir3oo1ome  fcils sDurxmp;t4apeoifciydlm2emnvon(4trxnifciatlptelueil(0 ruo(opiy1op  lfcsa(  Dua( ooo4opto i3tad m eanvo;(4trxomrctytomDeai s s0 2tm(opou4openmfes (fsrrmu oot4apto feiadla em( p t)trtnxoctytfpt au o (0 2toxmpiudapt liet (fa2rmuroot0ape iieils mDem( s;u0 eeoxr3oytlm e u i ( s2umim nudoptemneilsfartmu pou0aeeomoetad m el(mp;t0aleoio oa1lpt luvi;s trxm(r no1omen ietl( s2tau p;t4tle  i3iytla2umnmsnu4aetrir3oytlp raneilt trxoxmpiydlmt  fei s)s2rm(  oo1opxnmfetat sDeanvp;t4aetrio3tytopt  nvsl( teto(m oy4llen nviat srrrum no0oex mo3tadlaDeaums;()tlxoxr oadlp rlnes t0 rumim nydamt  fvtlt arra(rp;t4apen o3iyt m2ua(vs;(0trtoioctadfaDrlivolt)srxmiopnu1al elfesa(f 2tr(r ;t1opt mf3iyslsDrmumont) exoxrctotomtranvs t s2xrxo3nydoptelfvia(  ruau  ot1alxomietlt mDua(mpnt)altrxf3iytfatrliei;(0trxrir oy4oltemfeilsfs2rruront0ole iiciasfa2ua(vo (4arenmf3iadomDe n sl(0t2tmxopnodame  fvtl( a2um(r no4alx  i3ils a2ul(mpnt4tetrirctodlat ln i s t2umxm3nu4llte fcs s)srrrxm ;t0teeomfciatlm2elu onu4 rxnmf3tytlmDrau i;(0 etmxmpno4ame  nvsas)srumxront0oex mietltls uan onu4alxnmfctodlmtrluvo s  rumxo iu1lmeemfeta(  Drr( pno1aeen ictydlmDemumpn(4aetnxo iatopD luvil(0srtoim3nydlltn fvs ()sDrmx pno0olt micildlsDrmnvo;u)tlerifciytlate n o t0trumxr3oo1omtemnctl()aDurx pot4aetnmf3ildfa rmu p (0 ltnifcootfm rluvs s  rtrxo iy1ap   nct s sDuaxm no0tlxn oeiaslmDul(mp u4aetnio3to1lp r u slt  exrio iudlpt lncias)a2tmxmoot1apxnmfctysfs eau p (0teenxo ootomDr nes;t)srur(mpou1op emfei s  Dtrxrpoo4tlt mi3iytfm2ua( sn(4arxnxoctatomD aies;t)teumir3nu1lle lfvs sf rtm(rpnu1tpt  fetatlaDean s;t) lxnmo todoa elnesls0srumim no4ameelnesltfaDurur nu1tltn fciltfs2rl( on(4tlerif3ty1lpt  i i;s0setm(r ou4op nlicsatf 2trxront1apxn oeiat a rmuvpnt0 ltrif3oo1fp   n s (0sexrxopoudalt  ivi tfsDuau o;o4oleo o3iatls2el(vp t0 exnmrciotlatr nvs;()sruoirpnu4lp nlics () Durx  nt4oetomo3ilt sDraump;(4aexnmo oodlm  an o t srxmio oydaleemicsasfsDurxront1tle  i3iadlm2umnmon(4 ltrxo iatlaDr i i;(0s2trimpiy1omtnlnvt sf ruaump;o0tlen i3tasfsDrauvo;t0 etrmfcoa1laD livslt0s2xrirpoo1oltelivi tfa2trurooo1alenii3iysls emums;(0tlxoioctotoaDeln i t  2tm(r3oudolen fvi ()s2uru onu1altnio3taslaDean p (4aexnmo iodfmtrli o;s0setmxm oo1ol  miei s)srumu oou0olxnmo3ilsfaDean o;t4tleoxf3iydlpDrlivols)s2xrir3no4al nlicsa()aDta( p;u1opt mfciat a2rm(msn()aetnxo3oy1oateaivo;(  2xrxr ny4lmeemfvsa()aDraurp;t4olxo o3tyd m rluvpn(4tetnxr3ta1omDraueilt  2uoir no4llt  iesls) Drax  nt0ole mf3iad mDea(mo u4tlxrxf oadfmDraueo;t0sexmxm3nu1ale mneslt sDtaur ;t1aeeomoctyslsDrm(vs u)altrio3oa1omDrau ols)truriopiu4ome lici sfarumxmp;t1olto octadfs2elnvsnt0 etnxrcia1oaDelnvo s0t2xoim oo4lleelfcsa(  rraxm nu1oetn fciydfs rmnmo;()aexnxr3oadlp ean i ()trtr(r3oo4openliei (fartau pnt0tpxn i3iatfmDum(mo (4artrif3iotoaD au s;t0truo(mpoudllenlfci sfs2taxmpnt0opxomoetytla rlnvp;(0alenifctodfmtrau sls0 rtm(r3oo4ap e iciltfartr(m ;t1oeeoiiciydfs2ra( pnu4texnir3totlm elu s t trtriopoudoltn ivtat sDuru oot4oeto f3iyslmDrlnmp;u)aetrxo ty1faDrlivo t0 2uo(rpiydap  micta(f 2rrxrpnu0oeen ocils a uln sn() rerxr3oodfptelneilt tetoxmpno4lm elfct tfsDraum no1optnmi3iysfs2uauvsnt4 exnir oatfm  lu ol(  2xrxr3nydole mnvia(  rtrx p;t4tee ifciadfa2rmu s u4arxrirctadlmt li s;s) 2umxr oodole liciatf 2tmu ont1tptnmo3iat aDeanvp t0 lxrxo tatla e nvs;s0trtmio3oydaltnmfcsatfaDumur ot0tlxoifetysla2ul( s t0areomrciotlateai s t)t2um(m3no1om nmici sf rrmxmoou1ope moeiaslm um(vont0 renif iydlmDr nvi;( trtmim3oo1amtelici s)a2rm(  ;u4aetoiociydfm2rlumpnu0 exoioctotlat  n s;s) rto(rpoy1openmiei (fa2trxr oo0aee ifetlsfm2rm(vpnt4alxomf3iytlptraieo s0 eumiopnydlptnlfetltfs2trx onu1ale  ictysfsDuaums t0 renxr oatoa eanes;t0 rur(o3no4apt licslt srrmur ;o0tlxniocild a rmnvs;(4trxoxr tadlmDr uvo;s)srxm(o oodol elfvtas  rrax  nt0teeomoeilsfm2uauvsnu4texomrctotlaDrluesl()sexr(m3io4lp e ivslt  Dtrxrono1oet moeilsls ul(mo;t0alerif todoateluei;(0trto(m io4omte fctl()s2raurpot0oetomocilt m2rmumo;u4 eerxrcto1latelivi;t0 rtrim3nodlmenlncsa( artmu p;o1ole miciydfm2em(vp;u0 exnir totfmteluei;()sexmimpoydlmtn ivt ( a2rax pno4aexnioeiltfa rl( s (0 lxnmo3tydoa eanvs s)t2tmxr3oo1omtemneias)sDur(moot1tpxoio3tlslm el(vonu)arxoxf3oytlpDe u s;s0 etoxm io4alenlfvsas  2umurpnu4aee  iciyslm2ra(msn()trerir iotlat  ivi ()tetm(m3oo4altnmici s) ruaxmo;o1open iciad sDulumont4arxomocta1op eli s;t  etmim ou4ap emncsls)arumurpnu0tpx iictldlm ranms (0artrxr3oodlaD luvo;t0srto(opio4lmenmivtl(  rtr(mo;u0tetomoeiadls emnmo ()aexrxr3iodla raivo t0t2to(mpoydoptn nvtlsfsDtmuro;o0tpen f3ilsla2rmn pnu0 ltomrctadomteli o;t s2to(m oo1ameeliesl() rumump;o0apto oeiadfs2ea(mp;(4aetrir tatom eli s s)trto(r oudolen icta()s2trumpnt1aex  oeiltls um(vs;(4tlxomo iydfate uvs s s2tmim oodop nmnct (  Dtmx p;u4ale mietasfa2umnmont4 rtnirctytop raueils) 2xm(o iudllt lnctas  2tr(  no0olto feiad mDrmu o (4 lxnmr3oytlp eaieilt0 rtrio oy4apen fcias a2umum ;u4tee io3iyt s em(mo;()artnxo3iytfatrlieol()s2trio3nudlltnmnet s)aDrau p;t1aetoio3tytfm2rmn p () exomo3tatlp  luvsl(  rxrim oy4om   fetl()srra(rpnt1teen icilt m elums (4texrmf tadfp  lues;( trtr(r3oudlltn ivtls)aDtauront1tleoif3tatfm rm( o u0texrifciy1la e nvi;s s2uoio3oydol nmneta( sDurxr ;u1tpe mfctatfm rluvp t0trxrif oy1lat  uvs;t0truoir iodale lfvta()sDtrurpou0tpxo oetytfs ra(monu4 eerio3ta1fmDrlu s s)t2xm(mpno4op  livils arum( oou4apxomictyt mDrluvs;()alxrir io1om e ueo ( s2trim iy4om e neilsfs2rru pnu0oltomieiatlmDuluvo u)artrif3oadoa  aivo s srtmimpoydop nmictas)s2ta(monu0aexo o3iasfm2emn s ()trtoif oydfp   i slt0sruoim3oo1optn fvsltfs2uru  oo4altnii3iasla2el(mp u0tlxnxociadopt ln olt)t2umxo ny1olenlivsltf 2truro;o1aee miciytlsDem(mp t4arxoxr iatoaD an slt truo(m iy1altelies sfsrua( p;u0tpxoii3iytfmDumnmp;u0 ltomfcio1lmtelueils0srxoxrpiudlmtn iciat  2tr(rp;u4oet mfciydfm2rm(mpnt)altrmociadfmD au ilt)seto(r oudapt mfcil(fs2tmum nu0opt  o3tlt s eln o;u4arxrir oadlaD aies s0 2toim no1optelivs (f Duaxmpnt4ape mo3tadla2uln s (4 rtnir3oytfmDr neilt0s2xrimpoydll n ncslt  2um(  nt1apxniociydlm rmumpnu) renif iodopt anei;s srumiopoudop   fvs (faDta(  ot0aleo fctyslm rln p t4alxrxo iotlpDr ivi t)s2toir3ny4lpen iesat) 2urxr nu4alxnmieiyd m2um( p;()altnmf3tytfpt lueil()sexrio3oo1om n ncslsf rtrx  nu4opt ifctadfa emums;(4artoiocoo1laDean sls s2uoirpnydolenmnei ( aDtaxr no1oleoioctadls elnvp (0alxnxf3oydlmte n s ( s2uoim nu4lp e fvtatf rum(  ou4aeenmoeilt a uln pnu0trxrxr3oy1opDeluvol()tetrxm3iu4llte icilt)srraump;u4tpe  fcilsfa2um(vo t0tlxrio tydfaDeaies;s)t2umimpiodlpt lnct s)srtrxmpno0ape mi3iat s2emn p;(4aexomr oytlp r n ol(  2tr(o no1ap emnvt tfaDrr( pnt0oetnmo3iatls2ulu snu)tltnmrciotlmt livolt  rtrxo3nydlm  mivta()srtm(rpot4olx iocildla emnvsnt4texoxociadlpD lueo;s)texrim iy4lpee icsas aruau o;t1olxo ietyslaDran s;u0 eermfctadoatr iesls) 2tr(r3io1omen feiatfaDrrxront4aetomfeiatfmDumnvo (0trxrifciatopDr uvi;t tetoxmpoy4apee nvt ()a2rrx p;t1alt ioctadfaDrluvsn(0altrifciotlpt lu olt)t2uo(o3iy4am n ics t)srtmxm oo4aexomieiydfs umu snt4arenxo3oo1la eluvilt t2xm(opiy1ll emfvtas s2rau pnu4openmfetatls umn s;(0tltomo3tatoatr u i;t seumxrpou4lm   fvtlt  rtaum ot4ape if3iys s ea( o;u)alxnio3ta1lp  anei;s  2trxr3iu1apeelicslt)srraxr nt0tee  oeiat a ulnmp t4alxnmo3oadomt anvo t) rtmio oy4lp nlict t)arur(r no0opt if3tlt a ua(mp;t0treomf ta1op raivsls)texmirpio4lpe liei t  Dtaum oo1alt if3iysla2ea(ms;u0tetoio3iotom r u o s s2uo(mpnydoltnmnvslt  2trurpoo0oeeomi3iat s2rmnmsn()tltrmrciatfpt anes s) 2tmxmpoodam elncsatfsrtrumo;o1texn fetatfsDeauvo;(4teenxrciy1lmDe ieo;s)setrxmpnu4apeelnctltfsrrmxrp;o0aee  ocilt a2uaumon() exnxr io1oateln s;(0tetr(mpno4olen ivtat sDraumpou1ole  fetatfa2elnmp;u0alxnir oytoptrau i;s t2uoir3oy1lle miesls)arrax  ;t1opt  ieiysls uauvpnu)artnif ta1lat an o s) 2xo(m3io4lmeeliet ()aDur(  ou0olt  i3ils s ranvo;()teerxo3oo1fa rln s s0trtmir3nu1alee iesa(  rtrurpou4optomi3iad a ul( o t4 etnmf3oydfmtelu il()setrirpiu4apee ivils)a2rr(moot0alt ii3ildls2ulu on(4 reoxociytlaDr i sl( texrxopno1lltn fct (fs2rmu  ;u4alenmoetatfs rm(msn(4trerir3oytomD  u s t  2xr(o3oy4op emiet t) rtrx o;o0tetn fcilt mDrmn o;()arermr3oo1fate ieo s) exoim iodoleemfvi t)aDtmum ou0aeeomicilslm2rln p u)aexnio3iodomD aieolt  2tm(rpoo1ale livsls)srrr(m ou1tleoioctad a2eanmpnt4 etnirciotfm  au olt) 2tm(opno1lltelfetasfsrta(  nu0altnmfciytlmDum(mpn(0trxnxf iotlateln il() 2urim3ou1lpt mivslsfa2um( p;t0opxn o3ild s2el(vont0 rxnxr iadfpDr uvs t0srto(rpnu1lm emnvi s) rumxm oo0aptn f3tasla eln snu0aexnxf3io1fm   nvi;(0t2uoxm3ny4am nlnvtatfartmx p;t0apeo ietytfm ea(mo;t)alxrmrctotopDelnvi (0 2xoir no4op nmfetas) Dtmumoot1tlxoio3iadlaDeanmp (4 eermr tadfp rli o s  etoio ou1lmtnlncsl(fsDraxmont0apx mieiyt m ulumont0 ltrmf oo1oatrlneils0t2trir3nu1openlfei sfarrm(mp;t1aet  o3iadfm2rluvo;()aetrxr oydop eli o;()texoxrpoodolenlivs ( srtr(r ;o1aptomietat mDeln p t)aexoxr oodfm  lnvs;t0 etrimpou1apee nvslt  rurxr ;u4opeoii3tydlm r
\ No newline at end of file
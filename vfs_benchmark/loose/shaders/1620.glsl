@@ -0,0 +1 @@
+u i;s)s2trim oy4lltemfciasf 2tmuroot0opxn ietydfa2rau s u) ltoirctodopDelueils) 2tr(rpnudaltelfvsatf Dtrxmpnu1alenifetytfs2umumo () rtoxocoytlmt li olt0truoio oy1op emfesa()s2rr( pno1tpt miciatlmDuauvo;() lxrif3tatoptr uvi ()texrxmpoy4optemnvi tfsDta(m ;u0oeto ietltfsDuaumo;u) renifctadlm eln o (  2um(opnydomtelivsl( s2tru  ;t1alen octys sDumuvo t4altrmfciatoa  aivo;t t2xmirpoo4ll nlnvi sfs2tau  ;o4tet io3ilslmDuan p (0alxnmf3iodfpD an o () 2xm(mpoo1aptnmiesasfsrraum ou1olxomo3iyt s2ua(vonu0 eeniocoodlm r i s t)s2umirpoy1lmt lietltfsrumumo;o1opt iicildfs eanvs;u)trerxf to1la e neols) exo(m3oydam  mies ( a2rr( pnu1oex ifeiysfmDelnvp ()texrio tatfpt  nes;(  2tmimpno4lm emivt s)sDtmx p;t0olx moctat m2ea(vs;u)trtnxrcia1lmt luvi ( trumirpoydam emfviatfsrrmu p;u1alx ioctytfsDulnmsn(0alermr ta1fp rauei;() eurirpiodolt lnei ()sDrmx  ;t0tetomfctltlmDuanvo;()tetoiocoodfp   nes ( seumio nudalen nvia()s2umurooo0apeoio3ilslsDul( p;u4tltnxr tatfpteaivils)seuoxopiodlptn ics t  Dtm(r nt0opt iicilsla rau o;t0 rerxr3iatfpDr uvi ( srtrirpio4ale  fvs sfs2tax poo0tetnioctasfmDeaumo t0teerxf totlpD aies;s srtrim iodap  mnctls  2umx o;u0tex if3iatfm2eanms u4tltnxf3todfaDeli olt)setoxr oydole mneta(faDtrur ou0ole mociat a ul(vpnt0texomr tatoaDe ivo;(  exrxo3no4lmte icsatf rrm(  ot0oexo iciytlaDem(mon(4alxoxfcty1fp rlu s ()sexoio nu1lltnlicsl( arraur ;o1olxnifctls mDrm(msnu0aeeomfciytlmDr i ils) exrimpny1lptemfvtlsfs2urumoou4olx io3iatlsDelums u) eeoif iydfaDeaivi t)sexoimpoodamtnlfvil()srum(mo;t1tlxomf3iydlmDum(ms;(4alxnxociytfaDean o s0sexo(m io1am e neias aDurxm nu4tlt  f3iys a2ra(mpnu4 etrmr3iodlmte uesls)texr(o3oydlpeelnciat  2tm(m nu0oetoio3iytlsDulnmonu) etnio iodom  lu o;s  rxm(rpoodap emnet sf 2tmumonu4tetoifetyd s2rmumsnu0 ltomrcty1fmtelivs;( t2toxm3iydlme lnesltfa2ua(m no4ope iocils m ean s;(4trtnir tadlat li ol(0teumxm3ou4lpe  icta(f Duauronu1aeenmfeiltlmDrmumo;t0 etoxf iydop rauesls seur(m nu1opt  fciatfs2rrumono1openiicilt a emuvont0aexomrctotlp rau i;s trtoxm ny4amt  nvil()srtrxrpoo4tle iociltlm2emu sn()arxriocootlm elivi;(  ruoio nu4aptnmivtl(f Duau o;t0tltoio3tas s rlu s;u4artomf3io1faDrauei ()s2umio3ny1ol  mnvi t)arrru p;o1tpt  i3iatfmDelump;(4tltnmr oodlm  luvo t)sexrimpiu1apen nesat artm( onu4aeto ictasfaDra(vpn()texrxo3tadlpte i s t0 exo(r3oy4aptnmnvsas)a2tr(rooo4oet  f3iys s elump;t)teerio oo1fpte ivi;s) euo(m oudopte ivta(farumxm ot4optn ieiat sDua(mo;(4treoxr ia1omDelnvi;s) eto(r iy4aleemivslsf rtmxmonu1alt ifciytfa umn p;t)trenif io1fpDrlieols t2trir nu4lltemfesa(fsrua(mp;t4tle  f3iadla2rm(monu4aetnmr3iodfpt  u s s  etoxrpoudoltemfviasf ruaum ou0aetn i3tltfa ulu o;u0 ltoxrcootfa r u slt)trxmir iydlpt lfctasf Dur(rpno0oltn ictatfm ra( s;u4 rtnirciydlpteauvs (0 euoxm iudaltemncsas aDtaxro;o1apeo ociyslsDel(ms u0treomo iydoa   ivs () 2xo(rpny1ap e nvsl(faDtaum ot0alenmf3ildls2eanvsn(4 rermf oy1optrli i;s) 2um(o iodllenlncsa(fartr(ro;u4alxoii3iyd a eanmp t0 exomr iatfpt livi s0 ruoxmpnodomt  nvsasfaruaxm no4apto ietasls rmnmpnt)texnxr3tydop  lueo (0 2uoxr iy1ome  iesl()a2rmu ont0oeeo ietldlmDraumo;t0teeoio3ia1fpDr ivo;t sexm(mpiu4llt lnvtat)artmurpno4oex  o3iad mDuau snu) eerio oodfp  lues t)teuo(r nydomtnmnvs ()sDtmxr oo1aleomo3ilsfa2emn p t)teenir3iytlmDr uei;(  rtrir3oo1om elivia()sDtrx oou0tleomociatla2umnvp;(4aexoxf3oatopte ues;(0t2xr(o nodlm elfcsat  Dtrurp;u0tlxoiicils aDrmnms;()trtriocoy1lmDe i i;(0trur(r oy4llt mfcsa(f rraxrpnt0oltnmociyt m2uanvs () rerifciotom e ies () etr(rpiydlm elfcsl(f rrm(mpot1optomiciadfaDeauvont4tlxoifciy1laDeaues t) 2tm(r3nu1am nlici s)s2tm(  oo0apeoioctldfmDul( p;t)teermf3iotfate nei t0t2umiopno1lp nmncs s)sDumur no4alen ociatlm umnvpnt)tetnxo3oodfpDr ivi;s0sexmxrpoo4lmen nviat  Drr(  nu4tpenmiciltfs emumsnu4 lerxo oo1oa e ues;()srtmxopoydlpenmietat  rtr( pno1tpt  i3ilt mDel( p ()tetoxf tatlpDrlu i s  exr(o3oy1lmtemnctls  2tmumooo1ape iictltlm ulu p (0 reoiocto1om rlivolt) 2xm(r3iu1amen icta( arrru poo1oee mi3iyd m rmu p;() reoxrciytlatelivsl() rtoio3oo1apt lictltf 2umumo;u1tlenmf3iad m2rmuvs u)tetrxo3todfa   ivi s trtoirpnu1ol  mfcs t) Drr(  nu1olxomf3tltfa2el(vo;u4tltoxf tatomD lnvo (  rxo(m3iy4optnmnetat  ruaumono4oee moeiyt mDrl(ms t0tlenxf3ta1op rlu i;(0 2xoimpno4omtnmfei ()artm(rp;o1apt mo3iat a uaums;(0texomf iatfpDr n s;()srtmxo ny1omeelnetlt) Drm(rp;u0aeeo f3iyt s em(vo;u0 lenif iodla r n i (0texr(mpoo4ameemncsas aDra(mooo1oeeoii3iydla2rm(vp (0artnmr3to1faDelnvi;()setoxopiydom elnvi t a2trur no1olxoioeiatls2umuvp;u)alermo3oo1fpteanei;(0t2umio3io4lm nlfvsat aruax ooo4olen o3iatlm2elnvon(0arxrmociadoaDr ieol( t2tmxr3nydal emnvt t  rtaxm ot0optn fcildls ranvont0tetoxfcoatlmt luvo s0tetr(rpoydole mnvia()a2ua(mpou1tlxomicild a2rluvo;(4artnmo3iatlpteln ols t2ur(rpno4ap emfvta() 2tax onu0tlx  i3iltfm eaumo;t4alxnmrciydlaDrauei (  exrim3oo1oleemiei sfsDtauro;t0tpe mfeild mDumump;(4artomr3ta1laD  u o t) rxmio3oodope mnvt (fsrtauroou0ale  f3iasfs2ulu o t)trtnmo tadop e nvi;(0 rxrim3iy1am e ietasfa2ra( ono1ope ifcildls ul( s;u) ltrxocoytlmt  i sls  euo(rpno1alt micsa(f rrm(mooo1oex iiciatlsDuanvo;t0areniociodlmD  ueil(  2tmxr3oy1llt  ivt s)arraxmpnt0aeeo feils sDemn o t0treoxocoo1fa  aieils0trtoxr3ny1lmtelieil( sDtrumpnu1tetoifeiadlsDrm(vo (4trenio3iydfp  anvs;s0s2umxo3iudap nlneta()sDrmxrooo4tetn o3iadls rau o (4aetnmo iotlaDr ivol()sexoio3io1lpee ici (f 2rm(m nt1ape if3tadlm el(msnt0 etrmr3iydopD  nvs;t0 rxmxm3iy4amtnlnct t)aDua(moot4tlxo oetydfa2ul( p ()tltoifcoo1opt  ivs t  2tr(mpio4omenmfvsas)sDra(m ot1ape  feildlsDulumo u)trtomo3ta1fmt livols)s2urimpny1am n icsat  Drr(moou0alenmo3iyd sDuauvsnt0 lxrmf totlmD luvs () rtm(r ou1lp  mfvtl(fartaxrpnu1aee io3tydls rluvpnu0trerxf iadlp  livi;s trurimpoodolen icslt  2trxmpno0aex  fetysfsDum(vs t)trxoxr oadoa  anvs;s)trumirpoudlpenmfcsls)arta(rpot4oet ii3iysla eaump;(4aexnxr oy1lp  an o;() rtmim io1ll  mnesl() Dtrumo;t4oeto f3ilt aDeluvpn()trtnircoydlaDe neo s) rtr(rpoo1ap e feslt srraurono0tpen ocias aDrm( ont)aetrxrciydopD liei;(0sexoim3iodam elnct s) Dua(rpno1oex mocildlm2rln p;t0 reoxrctotopD aiei;t0srtmxm iy4lmee ivia(  rua(  nt4opxomoctaslm2rlumpnu0arxomocoydfmtran s t)s2xo(o io4altn iei ( arrr( pno0openmieiyd a2ul( o;t0artrir totlm   nei;t  2trio io1ameemnciat) 2tm(mpoo1oetnmo3iadfmDuan p t)altrxfcty1lat lieils)sexoxopnydol emiei t) 2tmxrpno0oexnmieiadlsDran s (0 eeomfcto1lmDr ies (0 2uoim3nudllt  iesltfsDta( pot0aeenmi3iytfm raumpn(4arermf3oy1lmD  ivil( s2umimpoudamtelnei ( artaxmpot0tptoif3ild mDumuvo t4 etrmfctadlmD an o s trtmirpoudom nmivtls sDrmxm ;u0aeeomoeiadlm2umu pnu0trtoif3oy1omD li i;t)texrxrpiu4opeemfvs t)s2rrx  nu0texnmfeildls rl( on(0aexoif3oytlmDeaieo t t2umiopiy1lme  ictat a2uaum ;t4oleomoeiltfa2eaums;u0aetnxo3iy1opDrln s;s srxrxr3oo4om elietl( srumurpno4aptomoeiaslaDul(mp t)trtnio3ia1fat lneils)s2um(m oydll  mfvsl(fsrur(r ou0aet iictysls ranmp;u0 eerxr todfatrliei t  rtr(r no4omt mfesls) rrmumpno4apto oeild a2um( pnu0alerifciodlat luei s srumxm3oodlp  lfetlsfsrtrumoou4opxomfctadfmDum(mon() etrir tadomDeau slt  rxrim oo1lmte ietlsfaDtau ono0aexnif3iytfm um(vsn()texnif tytfp  aivsl()srxrxm3iy4ap emnci t sDtaxrpot0tex mfctysla ra(vp (0alerxr3ty1lp elivol( teuoim3iodlpee net sf rraumpot0aet moctat s rmumsn(0texoxf todopDrau il()teurio iodalee fvta()arurxmpnt4tle  fetltlm rmumsnu) rerir oatlm eaivsl(  2urio3nu4omtnmicsl( a2rrur oo1ape  ietasfsDem(mo (0trxnif3tadlmtrlivs;t s2uo(o nu1lpt mieta() Drauro;t1oeen ictasfa2uln sn(0tlxoxr3oadlpDeli o;t)t2toim3nu1ll nmfeslt srta(m ;u0olx mi3tas s2eanvs (4artnmr3iydlp r n sls  2toim oy4aptelivsat) 2ua(  ot0opt moeiad a uau p t0artnmr3ty1oate u s (0trur(r ou1lmt lfct t  rrm( oou4openifetltfs2ea(vs t4 eerxo3oadfmDeln ils)trur(m nu1llee fesl(faDtru o;t0aeen i3iasfm emnvp (4artnmf oa1omD li o s0s2um(mpoy4optemncsas  Dtrxro;t1tle mfciatls2ea( ont4 reomf oadfmt  n s t0sexmio3oy1om   fvtas) Dta(mont0tpe  oeiadfm2ul( o;u0aeenmr tadomtr iei s)trxrxr oo1ape  nvt (faDurxro;o0tlx  icilt a ra(vpnu0 exnxr3oa1fpDr nes;t) eur(o3iy4altemicils a2tr( ooo4opeo octyt a ra(ms t4artnmo tydopD lneo ( s2to(m nudlmee nvsls  ruaxmpoo4alxoio3ildfsDumu p (4texrxf3todop  aies t texoxopoydlmt lictas) 2tm(moou0opx iieiat m umuvo;(0aeeoir3tytoa r iei;s0s2trio no1lme mivia( arua(  ot0alt ioctas sDraumon(0 rxnio3ta1opteaues s)texoio oodopte nvsl() 2urumono0apx iocild m emuvs;u4teeoxr tytomt aivilt)truoxo iodalee feil(fa2ta(mooo0alt moeild s rl(monu0texnmo3oatfaDe uvo;t0teuoxo io1olt mfesat)aDtaxmpnu4aee  feilsfa umn ont4areoio3iydla eanvo s)srxmxm3iu1om   nei tfsDrmur oo0oetnmfeiytfaDraumo t4aetnmrciydfaDrai i t t2xrxm ou4al n iesasfsrtmxm ;o4tltn octysfa el(vpn(4tltoir3iadfp rluei;s s2ur(o io1openmneilsfs2umx pnu4tptoii3tytlaDumnmpnt0aexnifcoydfp rli i t) 2uo(r oo1apte ivil()sDrruroot1aexomictls mDumn pn(0aeerxo todom elivi t srumimpiy4ll emncta( sDtr(mo;u1tlx moeiatfsDran p;u)aeenmfcoy1lpDeluvi;()seum(mpiu4lme  fvi t  ruau  nu4olxn iciatls el(mpnu4texnmf iatfpDeluvsl(0t2to(mpiu4lle micsl()sDraump;u0tpx mfeiydla2uan s;t)aetnif ta1lpt anei (0seum(mpiy4omt  fvs () rua(m no0aleomo3ias s2ul(vpn(4aexrmo3io1op   neols s2tm(m iy4lm   iesas)sruau  oo4opt ifeiysls2emnvpn(0 rtrir3ta1lp  lieo;(0 rtoir3iu4ll e ietlsfa2rmuroot4texoiietadlmDua(msnt4trtoio3oy1fa  aiei () rtrxr no4lmenmncsatf rraumpot1tee  iciatfm2ran o;u) lxnxrcto1fpDeanvo s0teumir3io4alenmfctatfsrrr(mont1tpenioetlslaDua( p;(4 lermfciatfpt auvo s)seum(m iy1al  mfesa()aDua(rp;o4aeenioctad sDelnvp;t0altoxr3io1fp raivi;s)t2urim nu4lmen ietat sDta(mpou0ole ioetytlsDuanvs;(0 etriocootlp elneols0texrio iy4omen ncsas) rraxm nu4tpxomoctytfs2uauvo;(0arxrirctytopD ai i;s)t2xoxm3nodameelnvt tfaDrrxrpou4oet  i3ildfa2eluvo;u0aetrir iadom   n i () exrxmpnu1ope lieta()sDtmxm ;u1aex mf3tysfs eauvo;t)texoircootlpD luei t)texrir oodllte nvi t sDuauroot0texo ieiytlaDelump t4tlxomo iydfp elies (0 rtrxopio4lltelfvi tfsruax  oo4olenmiciatlm2ua(vo;t0tetrmo to1oatean o;(0seuoxr ny4lp elicsls sDra(mp;u4teenmf3tld m umn p t4tlxrxoctydlp  aivsls  etoxmpio4opeemietlt srrrumpou0tltnmictldfm ulump t) rxnxfciotfp   nvil(0 2xm(m io1lp  mfvsat aruax  nu1opx ii3tasfs ea( s t0aetrmfctotoaDr i i s)sexmio3oy4llenmnctas)aDtauro;t0olxnmieilt s2elump t0artomfctotfp eluei;s)t2tmxmpnudamenlivias  rtrum oo0tltoio3iad a rlnvpn() rxomocoodfp rauesls0srxoxmpoo1am   icslt)a2ta(  ot0oeeomi3tad m2eln s u4teerir ootfp elu s (  exoir3oodlle mncilsfsDtmx o;u1tpe ifciysls2em(msnt)aexrio3iy1fmt lieslt  rxmxr iu4om nlfvtl(  rraxm nu4apenio3iad m2uan s t)treomf3oatlmtr ivi s t2umir3io1apeemnvs s)srtaxrpnu4aptn oeiys s uluvp;t)trxnxo3iadlp e ivi s  eumirpoudalt mfei t sDuaxmo;o4oetn fetatlm rluvs;t)tetnmo iytfmDe ivolt srxmir ny1lm  lnvias  Dtrx  no4alxoifeiytfsDul(vsnu0aetoxf3oa1lpDeli ils0t2tmir3nu4al   ics s)arurxmont4tltomfeiatlmDrl(vsnt)artnir3tadoateaivil() rtoir3nydolenmncsl()a2rrurpnu4apxomfeiadfmDrmuvs t0 eeomo todfm e u ils0trtrir3ou4lmtemies s  rur( pnt1apeo oeiatlaDrmnvo;() etoxfcto1omDeau i t  2um(m nydlp elnvtasfsrtaum no1tpeniociat sDulnms;u4texoiocootfmte ivsl( s2tm(opou1open nvs s) 2tmx p;u4teeniiciat m2eauvont)tltrxf oodlmt au o;( srxr(opnodam e iesatfsDur(root0altomo3iydlaDeaumonu)arxoir3iydlmDr neo;t s2urirpny4om emfviltf 2uaxm oo0olx ioeilt m umnvo t4arermf ia1lmte nes;t)t2xo(opoydap elncsatf 2uru pnu1optn fetys mDulnvon()aetomf3iotlp e n sl(0truo(rpiudam n fvsat) 2rmxrp;t1aex  oeiys m elnms t4 renio iodlm raueilt  etmxr io1lme miei tf 2rr(rpot1aetomieildfsDra( o (4 lenifciy1omt lneilt0s2uoxopoy1ome lfei ()a2tr(  ;t0tpe iieiytfa elumo;(0trtoxr tadoaDeln s;s  2tr(rpoy4ap e fvi sfsrra(m oo4opt  iciys m2ul(mon(4alenif3totomte ueol() etm(mpio1opte ies ()sDtaumono0teeo ictad sDeaumo u) renircoytlaDrai i;()texrirpio4am elivta() ruaumpot0tltoif3iadla rlu on(0trxrmfciodlm e i slt sexrio no4ll emivslt) Duax  no4tlxniociaslaDeauvont)texoxf ootfm eaieils) rtoxmpiodolen ivi s)aDuru pot4oetnmo3tydfs2ua(mp;t4altriocoy1om raivo;(0sexrxr nu1alen fcia(f Dua( p;t0aexomf3iat m rmnvp;(4 lxomf3iatoa  aiei;(0 2uo(o3iy1omenmiei s)arum( poo1tltnio3iys s eaums (4 exoxf3iy1lpDelu ils  euoxo iu4apeemivtls arumumo;t4apxo ociysfa elumsn(4trtnirciadomD auvo t  rto(o nudlmenmieia(fsrrrurp;u0tpe mietasls2rauvpnu)trxrmr io1lmD li il(  rto(m3iy4op   fcsl(fsruru o;t0teto fciatlsDrmnmpnu4alxnxociatopDe nvils srtoim nodalte fcta()arum(m ;t0tlxo feiysls2ulu p;t)altrio3totlmtr ies ( t2urxr3oo1lmte fesls sDuaur nu0olx micildfa2ulnvonu)texrxo3to1opteaiei;(0t2xoxmpny4alenlnctlsfs2ur(moou0teto iciytlm uan s () etomf3oodla rln il(0s2tr(r no1al nmfvsat)sruax ono4apt ifetysfm el( p t0tltrio3ty1fatrluvil() 2xmiopny4ap  mfvi (fsrtau ont0apxomiciadlm emnvsnu0aeenxo3tadlat  ivi s0 exm(rpiu4lmt lics ( a2rax pou0altoifeiatlm elnms;t4aexnmr3ootfaDelnei;s)t2tmim3iodop   ies s  2tmxmoou0tpt mfeilt a umnms;u)tltoxocia1oaDeli i t)seum(r oy1ll  mieils  Dra(ro;u1alxo o3tltfa rm( pnt4 rtrmo3ty1lm  an ol(0 rumir3ny4ol nmiet ()a2rmxm ;u4oeto oeiytfm2rln pn()altoioctodop  lnei t)srumir oy1altnlfvt sf rtm(rpnu1tpen f3iat mDelnms (0 eermrcoatfp rlnes;() etmxr oo1llt  nci ( a2umxm ot0aeeoifciydfm2ea(mo;t4treoir3ty1fat ai ils0sruoio3ou1lp  lfctat arta(r no1apt ifctld sDul(vonu0trtoio3oatoa  liei s trtmxr oo4optelieils)srrrxm nu0tee mo3iadfa ul( p (4trxomr ootoat  uvilt0 rt
\ No newline at end of file
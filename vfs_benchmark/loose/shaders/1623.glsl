@@ -0,0 +1 @@
+nvo;()sexm(rpio1ll elivsat aDtru  nt1ale  i3iyd sDrln pnt)trenifciotfatelneo ()t2xo(o oy4amtemnvi ( srrm( p;u0tlxo feiyt sDeanvo;(0 leoxr oodop e u o;t t2tmirpiu4llt  fvil( aDtrumoot1ope  i3iyd aDumn p;u4trxrxr3io1omDraies s0setrim3io4lmtemiet ( s2tm(  ou4alxn ocilsfm2rm( sn(4alxnxo3to1faDrli sls) 2xm(rpou1lleemnct s srrm(r nt0olx io3tltfs2ra( o;u0alxrmr todlateln ilt0t2xrimpno1alenlfeiat) rrm(m ot1tpe  ociadfaDulnmsnu)altnif3ootlpD luei;() ruo(o ou4om elnvsls s2urxrpnu1oexoif3iltlm rlnvo;() ltrifciy1lmD  nvs s) eur(rpou1al emncil(  2rm(mp;u4oleomi3tls aDel(vo u0 reoir iydfaDr u o s0texm(rpoy1op n fvi ( s2um(mpnt0apxomf3tatls2ulumonu0altrmo to1fa elu ol(  rxr(r3oodaltnmncs t)aDurxrpnt4oex  fciltfa uluvo;u)arenio3tadlatrauvs s srtmxrpio4omt lneiasfa2umumoou4tlxn ietys s2ul(vp;u)tetnir3tytomDr neo;t0trxo(o3ny4lptn fciltfs2tr(r oo0aet  oetytfm2eluvsnu0trxoif ta1omtelneols) etmxo3io1op  lfciatfa2rmx  ot4tlx iocilt s2rmuvpnu4altrxf ootoat aiei t  etmirpiu1om  micsat)srurxrpno1apt  oeils s ulu pnu0trtoio iytomD lnvi s t2xo(r ny4opee nvils a2uru  nu0altoifciysls rmums (0texnxr oytlptrli olt sexr(m3ou1ap elfvt s)arrmx pno4olx io3tld aDem(mp (0aleomocoatomteluei s0 2xoxr oodlptnlfcsas)aDta(r no4tetnmf3tyt m ea(vp;u4alenmfctodom eanes;( truo(m3iodlp nlfcia() 2rmum no1apt mieiydfa rmu snt)teenxf oytfptr nei s)s2toxo3iydol e ictasfa2uru pno1oex mieiytfs2eluvo u0 rerir iadfatrli s () euo(r3iydamtelfvsa(faDururpot1alxoii3ild aDem(vs;u0treoxrcoa1opteluvo;t0sexmim3iydomtelfct tf rur(  oo0oet  fciyslsDua( o ()alermo3iydlmD  uvs s0teto(o nu1ap n netlsf 2tru pot1aetn octysfm2el( p t4 etnir3iadom e uvols)t2xrxm3iy4lm emfvsas s2uax oot0oet  ocild m2ean pn(4tlxomr3tytfmD auvs;t0t2xmxo oy1open nct ( a2rruro;o0opxnmf3ilsfa em(vs u4teeomf oydlpDe n i;t)tetoir3oy1om  mfci t)a2rruront1teeo feiatls2em( p t0 rtnmr3iodfpDeaies t sexoxopoo1oltelivslsfsDumumo;u0optomieiysfaDuanmp t0 ltrio ia1lpteai s;t) 2xmio3nodomtelfet tfartmumoot0oexnmictasfm ul( s u4aeerir iadlmDrlivo;()trxm(rpny1om nmieiltf Drrumpou0tpeomo3ils m2ua(ms t4tltoir3totlmDr neilt texmirpiy1al   ics () Duaxm ;u0teeoiiciydls2eauvsnt) rtrio tatfp  anesls0teur(rpnu1op e ici ( aDrauro;u4tptn oeiadfmDra(mo;u)trxrmf3to1fpDe nvs t seuoio3oo1lme  ivtas)s2tm(m nt1aexn f3ilt s el(mo;(0altnio iatla   ueolt)tetm(m oy1altnmfeiatfsruauro;o4tpxo octadfm rau sn()arxrxf3tadlmt aieil(0trtrxo nydlltemiesl( aDurx p;t1tptniociatls2uanvs u0aeeoxf3tydlatrlies;() 2uoxopoo4opt lfesl()s2taur ot1tpen f3iyd a2ra(vpnt) rxnxf todom   nvsl(0srtrimpou4om  mivias)s2umurpno0opxnioeias s uluvp;u0alxrircoa1lpteaivi;t) exo(m oydoptelfetl()s2tm( ont4tpxo ictadlm ra( on()aleomo ootfatr ivol()trxmim3oodomenlfesls)s2trum ou4tpenif3iyslmDemnms;t) rxrxocty1oate ivi s s2xrxm3ou4lmen fcslsf rua(mpou1aexoioctyt mDulu o;t0arxoif oydoptrlu o;s truoir3iy1am  mnesas a2raxro;t1aetoifcias aDel(mp t0tlenircto1la elnvi ( s2xoxo iy1olte feias  Drr(r ou4alt mieiad aDeauvp t4tleomo tytfaDeauvols  rum(m iudame lnei t srtaump;u1opt mfctadfs2uan o t4trenxf iodlp e nesls0srumir nodomtnlfeia(fsrtax oot4teto ieiatfaDelu p u)aetnxociatop elies t0 exrio ny4ap elfesas) Drmum ;u4oleoii3iadfm2rmnvonu0tlenxoctydfp e n s ( trxm(opiu4lm   nvi t  2tau ono1opxomfciatfsDelnms u4trtoirciy1lm  aies;s) 2ur(m3nodop  mici (fsrrmur ot1tlto feiyslm rm( pn() rxnmf todlmtrlneolt truoimpnydll emictl()artrxmp;o0ale mo3ilt m emnvo;t4altrmf3oo1faDrlies ( trtmir ou1lltelicsl( a2taur ou4altomo3tytfsDeluvsnu) etoir3oydlptr u i;s  2ur(o3ou1llte nvslt srtmu poo4alenmiciysfsDra(ms;t) rerxo tydopDraivo;t0texo(opoo4lm  lictlsfaDurxmo;u0aex mociadlmDumnmpnt0artnmoctodoa  ln i s)trtm(o io1llen ivilsf rrr(root1aexn fetadlaDrm(vpn(4 exnxo3tytom  anvi;t)texrio no4omee ncs ()arra(mpoo1ope  ocils m2raumsnt)altnxrciydom  lieo t texm(o io1llee ietls)s2rmxmpot4aexomfeiyslmDum(vonu0 lxnifcto1faDrauei s srxm(o3iy1ll n fctl()aDrru p;o1oex ifciysla em( ont0altoxr tydfmtr iesl( trxmxm oo1apen nvslsfsDurx  ;t4oeeo feilsfs2ua( p;() rxrmocoa1lmDeluvo;() 2urim ny1lpeemfcil()a2uru oou1aeen iciatla eanvp;(0aeenir3tydfat luvo;(  rtm(r3nodll e nvtat  rraurono1opt ifctls s2em(vo;u)areoirctytoa rli ol()t2xoxrpnodlmtemnvs tfsDra(  nt1ope  iciltfsDelumon(0teermo ta1faDean s ()sexrir3nudop   iei sfs2raxrpoo4ape iociys m uau p;(4alxnmf ia1fpDelnes;(0s2toim3nydalt  neias aDurxm ;u0opt iictlt mDea( p ()alxoifcoy1op eanei;s0trtrxr ny1amenlfei t sDur( pno0aex  fetasfm rmnmo t4trenmfctotomDrluvil( s2tmio3nodllt lnviltf Duaxronu4tleomoetltfsDranmo;u0trtrmo oydoa e uvi;()s2ur(r no1lp  mncs s)arrrum ;u1opxn icild mDrauvs;t4altoir3totopD aivs;s0sruriopny1omte ies ( s2um( oou4tpenmf3iytfs2ea(vo u0 rxrio3oy1fptrluvils)sexm(m3iodap  licsa( arrax o;u4oet ifctytlsDum(ms t)altoxrcoa1laDraivi ( t2toxmpiy4omenlfvta() 2tm(moou4tpe  iciltlm2rmnvp t0aetrmo oatlaDr ieilt0seurxr ny4ll  miei s)aDtmx pot1apto i3tldfa2umn p ()tlxnmocootfmDe nvo;s)s2xm(o nu1lmtnmnvs t)aDumxmoot4apxnio3ils sDumumo (4 rtoifcoatfp rauvi;s  etm(r oudlptn netat)aDurx pnt4tet mfeils sDeauvo;u0 rtoxo oatlmtrlneslt0 euoxm3nodam elfvs ()aDta(r ;o1oltnioeild s2emn p;u4trtrmoctatlpDr nvo s)tetrxmpny4omte ivs ( sDtr(moot4aeeo ictatlmDranmsn()arxomr oy1latrlnvolt  2tm(o3nu1opt mieilt) Duau pnu1aexomf3iadlaDuauvo t4tleoircio1omD auvslt0trxo(mpno4lm  lnvt () rtm(r ;t0tlen oeildlsDea(mp ()texoxf todoa raneo (0 exoim iy4lp  mieslsfartmxm oo4teeo iciys s ulnmp;()aeeoio3iytlpDelueol( srtrxm iudamen ivtl(faDrr(mooo4tpxnmo3ilt sDuauvpn() ltniocta1lat ln i s)srtm(rpio1apenlnei t aDuaur nu1aeeo oeiadls rl(vp;(0 ltrxr todfaDrlnei ()s2tmxmpio4amtnmfcsltfaDrm(mpnt1oexo o3tyslm2rlu o;() renxociydla eluei t0setmxo3oydlme mics (fsDraxm ;u0tet mietyslaDuau o;(4trenir oa1lmDr nvo;s)t2uo(m3no4openmnvtat  2ua(r no0tlt  iciyd m2em( on(0 eeomr iy1optrlivsls  2xmiopnu1op emici t)aDta( o;t1tlt io3tltfa2rm(monu)texrmr3ia1latrlivil() rur(m3iu1am  mivta() ruau  ;o1tpt iocilt m rlnvo ()teerxo3iodoptrauei s srtoir oy4oltn fct tfsDrmur no4apt  f3iad s2uanvpn() lenxociodfm eai slt0t2uo(o3ny4ole mfcilsfsrurxmp;t1tltn icils aDua(vs t)alerxf ty1latrlnvs t0setm(m3iu1lp  lfcil(f 2ur( pno0tpt iictasfa ul(vp (0aexomocto1op  lieo s)t2xoiopnu1lm  mfeta(fsrrmu  oo1opxoiiciyt m2umuvs;(4altrxf tatoaDrau sl() rxoim3oudamt mfvils)srrmurp;u4aexnif3iyt m2ea( p;u4tlerio iodomDeauvi;s  2umim oy1ole lieta(f rur(  ;t4tlx io3tydls2um(vs;(4 lerxo tytlptrlnes;s0srtmio3iy1opt miesl()sDtrurpnu4aetnmo3iasfaDrmnmp;()texnif iytlm rluvsl( srtr(r iodomte fct tfsDua(r no1alx  icilslaDumu s t0trxnxo3io1fat anvi;s t2umxopoydlmtnlicsat)s2urxrpoo1aet  fciltfa uauvs u0altrircoydfate uesl( srxrxo iy4amt mfeias) 2uru  nt0ole if3iasfm2ranmp t) ltoxo3iy1fa  aieilt) rum(rpoydlpt  nvi s)a2umuroou4oeeomi3ildfs2rm( sn(0artnio tytlpD  uvslt setoxm nydlpeelnci sf 2ur(rono4tetomociltfmDeaump;u4aeenio iy1lptrln ils) 2to(o iudapt  iviat arua(r ou4texnmo3iltfm2umuvs;t0 etnmf3oytla raueo;()setoxmpoy1ame lfes sfs2rrx  no0aee ifetasfs2ua(mp (4tetnmo3oo1faD  uvo t  2xrxm3iy4ole mneil(farua(rpnu4tpxo octatfa2emn p (4 exomo totfatranvs;t) exmxr3ny4alenmnvslt)aDtm(r ;t1oeen fetls mDum(vp;t)artrmrciytfpD  ivi;s texoiopno1ll   fvil( s2ur(mpnt0aleomfetld m em(vpn()aeeoxfctotfa ranvi;(0sruoxr3oy4op   nvs ()sDrrump;o0tpeniieiyt sDrlnvo (0 exoio tadopDelieols  euoiopno1om nlfetat aDumum ot0ape iietytla2rl(mo;u4 exnxf tytomt  i s s)teuoirpou4amtn nvtltfartr(r nu4oleomfetltls2emumpn(4 rxrxr iydom  aivilt0trtoxm nu1ll   ici s)srrm(mp;t4tle  iciyd s2ea(vs (4 lxrmf oydfm eanvsl()teto(rpnu1opeelnctlt aDtrxmo;o0tpx  ocilt m emu snu0 leoio oy1om eai o ( t2umxo3iudaptelfvils) rraumpot4aeen f3iys a2emuvpn()tlxnmf3oodoptrauei;s0 2uo(opnydlmeelfvsasf Dta(ront0ole  oeiad sDrlnvs ()tltrio3io1lp  livs;() rxoxm nu1optnmfci sfaDtaxrpnt0aptomoetlsfs2elnvon(4 rtomf oytfm  au o;t0t2uriopny1apeelneil() 2ua( pnt1texomf3iatfsDemu p;(0tltrmfctydfpteluvs;t)setoxo oo1lptnlfvsatf rtm(m nu0apx moeiat s rauvs;t0artrmrcoy1faD ln s;s)t2tm(m iudap e fciat) Dta(m oo1olen fetadls2ulnms ()aeeriociatfpt  n s;t  rtmxopou1ap n ivtl( arrau  ;t4tpxn fciydfm2eanvo;t4aetrif3oy1fm raivo s)t2tr(opnu1altemfesl( arra(m nu0ale iictyt m rmnmp;t0arxnxo todfa e ivo;s0 rtoxopiudal elfcs t srtr( poo4aex ifeiyd a em(mo;t4arxoir3tatomDe i s t t2umxo oudopeemictltfaDtrxrp;u4tpe  fciytfa em(vp;() lxnifcoydoat  ueilt) rtoirpiodal nlfeta(faDua(mpno1optnif3ilt m rlu o ()tleoio3ootfa eaivo (  rtmim3ny4ol   net s)a2ra(rpoo4aee mfctytfm rauvo (0 ltnmr3iadlmtrlnes;s)t2ur(rpnudap e ieia( srtaxr nu0tetnmfetat sDul(monu0 rxnmrcoatfat ai s;()t2xr(rpny4lpt lncs s arur(moot0tltn f3iyd a2eanmsn(0 eenxrciy1fpt livslt setmiopno4ome  fvia()s2raumonu0oex mi3ias m eanvs;u4 ltrxfciotlat  neo t s2xrio3iu4lptelnct ()aDtrx ont4tpxomieilslm2ul(mon(4trtrxrcoa1faDean o;(0teumim iy4omt mnet (f 2ra(r no0olen oeiydla ul(ms;(4 eenif tadfaD li o t)srum(r3oy1ol n nesl(fs2tr(moot1aptoioeiyslmDuln s;t0alxrmrctytfatean s s0trumio3oudamtn fvsat sDta(r no0tptnifctytfm elu o (0 ltomo3oydlaD au i () rtr(mpiodapeemivsa(farururpoo0aptnmo3tld sDuaumpnt) exoxfctydfatr uei s0s2tmxopno4omenmfeilt)sDuauro;o0tpeoiieild mDem( o;(4 leoxr3to1fm eln ol(0sexrio3iudalenlnvi (faDururo;t1opeomoctltlm2eluvo u0aetoxo oydopD anesls) 2xo(mpnu4op e ici t)aDtmump;t0tleoio3ildla2ulumonu0 reoir to1lmDe ueo t0t2um(r ou4ameelieia() rrm( oou0open feiad s rm(vo;t0aexnir3tytopte i i t trxoio no1apeelfcs (f Duaxm ou4ape  ietlsfaDrm( pnu0teeoxr3iodopDrai ol(0t2to(m ny1op  mfvi sfartrxr oo0oeeniictas s rmnvp;t0 rtnmrcoadfm  livs;()srurir3no1ll emncsa(  rrmx oou1aee  f3tadls2elnvsnt)aetoxrcoo1fpt auvi;s0srxmxr iudlmenmfvilt sDum(m ;o1oltomi3tlsfa2ea(mp (0alxrmo3oodoa  luvils0trtoxo iudoleelfeil(fa2rr(r ;u1apeomfcild a2eauvpn(4teermr3oytomteluvi t0 ruoim nu4ame micsl()aDtaxroot4texomietld a ranmp t4arxnmr3tytlat livol(0teur(r oodomee ivi t) Dta(ro;u4tpenmociysfsDelumo;u) rtniocoytfpte n o;t)setmio io4om e iesasf rurxr ou0tet mociysls2ul( pnu0 lxoir iydfm raivilt trtoxm iodam nlnct (f Drmu o;u4opx  feild a umu p;()areomrcoytfp eau i t  exoio ou1am n ieia(  rur(rpot1olenmf3ilsls elnmo;(4tltrxo iotom eanvs;(0 exrxrpny4al nmivs ()srtm(ro;o4olt ifciydfmDumump (0 eeoxr oa1lmDrauvs s)trxoir3no4lm emiciasfartrx pou0oltoio3tys mDulu o;t4 etrmo oadomDranvsl()texoiopoo4ap   ieta( arumurpnu1tpen f3iadla elnvs;t)tltnmf3tadlaD lneol(0setmirpno4optn netas s2rm(ro;t0oeto ictltfm em( s;t0 lxnmf iatop elivslt)s2xo(r oydome lies t aDururooo4tpenmieiat a2emu p (0tetoifcta1opDraivilt  2umiopiy4om e fvsasfartrumpnt0opeoio3iadlm ua( s t) etnir tytoa e nvs t0 rtoir nodamtelfet sf rurur nt1aex ioetlslaDrl(msn(0 rxnmo3tydlm  anes;t  2uoxopno4lmtelfcsat)srum( oot0ale ioeildfa2umuvpn(0aeerxociodfpt lieo;s trxm(m io4apte ictls  rtmuro;t1opx mfetlslaDul( s u4 rtomf oo1omDeli ol( tetmxo io4lptnmivtls srur(mp;o4opxnmfeilt s2elump (0aeenir iadop  auvo;() etr(rpoy1lp nmfci t a2tr(rpno0oetnmociatfm2emuvpnt4 lerxf ia1fm eluvils) ruoio no4ole mfei (fsDta(mo;o4oeto ieilsfa umnmo;u0 etnmf to1faDeaivs;(  rxmxr iodalen fcias  ruax  nu0oex  fciadfsDrlumon(4texnmf3oadomD livs s)srtmir3iodam n fes t aDrm(  ;u0optnii3iad m2ul( p;u4 etnir3oadlmtr ivols0trumxo3ny4ame mfctlsfs2rmxronu1opxo oeiytla2rl( o u) rtnioctytfpDrln i;(0s2toxmpoydopt  ivias) rtrx p;u4olxomiciaslaDrauvp;t) rermf3oodoaD aivol(0s2um(opny1am   fcil()s2rmxrp;t0apen fciat a el(vpnu4aexomr3to1fptrai i s  2um(m3nodamte iciasfsrtax p;u0tpxomf3iyt m ulu snu)alenxf3to1fm elnvs;t s2xrxrpou4ap elncils  rtrumpot0olen oeildlsDua(mo;t4tlxrir oa1fp  lneo;( setrimpnydllen fvi t)a2rmu ono4oltn f3ilslm emump ()artomfctotlatrlnvo s0tetrxopno1amee fet t)a2rrur ;o0apt  ocildlm2um( p t)teerxo3io1opDe ivsls)trxrxo3oodopenlnetlsfs2rr( pno1optoiictydlmDel( s;(4teenifcoy1op eluesls)srur(rpoydoleemivtl(fs2ta(mo;t0oexomiciadlm2uau o (0tlerxo3oodoat  n i ()trxoim3iy1alte nvsl()aDumx p;o1olt mi3tlsfm2ul(vo;() lxnioctatlpD lnvs s0trtriopoo4lpen fct ()artmxm ou4aee iociys m el( p u4trxomr totomtraueslt0 2xoio nydamenmieil()artmxrpno0aexo o3iydlm2emu s;t)alenirctytlaDranes;t) ruoio3oudame  ietltf 2urxr ou0aptnmiciadfa2ua(vo;u)trxnxrcoatoate n s (0 rur(m3ny4lp nlfes tf 2umx p;t4optnmi3iltla2ra(vs;u4 rtrmf ta1lmtelies;t  2xmiopno1lpte ivt tf Drrurpou1oltnmi3iatfaDrln s;t) eeoxr ia1op e ivolt  2um(o3iydomtelnvsatfarra(  nu0tetniociatfaDeln p;t4tlenmrcio1lmDr uvilt)srxmxm oo4lptnmnci () 2trx o;o4aeeoio3iasfs um( s t0 rtoxo3iodop e ueo t srxo(m iodol nlivt t a2ra( ooo1altnmiciydfs2uanmo ()arerio3iadomtelnvi;( sruo(o3io1alee fcilsfarurur ;o4apx if3iyt aDuauvont0tlxrxoctydomteanesl()teuoxo3oy4al n fei t) Drru  oo0aptoif3tatfs2elnmo;u4alxnxo3tadfpDeli s;(0srxoxr iudamt  fvsat arua( ont4openii3tasls elu s;t)teeoxr todlatranvo;s) ruo(rpoo1olt mnci t) 2rruroot0olt  fciat a2um(vo;u4tlerxr oo1lpDeln i;t  2uoir3iu1lm nmivtls) Duaxroot4alx moctasla em(msnu4arxrmo3ty1fmDe neilt0 2trio3io4ap   icslt)a2tau o;o0altnmfciasfm eau pnt4tltnirciadfpDrlneil( trtrxmpny1llee fes s)srur(  ot1oltn o3iasfmDrm(mont)tetnxr oy1fp raivi s)srtoimpnudoltelfcta( a2uaxrpou4tlxoioeiyslsDel(mp;t) rxniocia1latr nvols) exoxmpoy4ap e ivtltfsDuauront0olxniociyslm eau snt)aetomr3oadoa rai ils0sruoxopiy1lpe  fciatfs2rmxrp;t1aeen ieiyd a2rm(ms;(4alenif3tatlptr neil(  rtr(m3no1lmtnlnet t  Drmx  ou0oltnmoctlsfsDemnvo u4aexrxfctadlpDrlivsl( trtr(rpno4amenmics (  2rmurp;u0oexnio3iyd m2uluvs u4tlxomf tytoaD ai s;s0t2xoio oy1llt mnesl() 2trx ooo0olen ociasla ran o u4 exoio iotlmte ivil( seur(o3iydop e ict t  rtaxmono1tee ioetltfaDeln o t0tlerxo iodla ean o;(0seto(o3iy1ope livsat arur( pno0tlxo i3iatls2umu p u4 etoxocio1fp eaieil(  rtoir3oy1lpte ici (f ruaxmp;o4aptn i3ilslmDeluvp;t)alxoiociatoa eln sl(0texmiopoo4alenlncia(f Durumo;t1tpeomoctlslsDuanms;u0 rtnmf io1fmDe u s s0 etmxrpiy1ap elieia() rumurono0oetniiciat aDrlnvonu) rtrmo iydlaD  nes;s  ruoxm3iydomtn nvsl(f Dtrx onu4tpeo i3iyt s2em( pnt4 exoxf3ootfmD  i i;t  rtrxm3iy1al emfvs (fsDumumpoo1aeenifciytlmDel(mp () rxnmocoo1fp  li i t srxr(mpio4altelneta(fsDrrumont4tleomiciysls2eaumo u0tlenxr3io1fa e neo t  euoim3ny4ll n nvtat)srurx o;u4tpt iieiytlsDeaums;u0 rxnxr oa1fmtelnes t0sexr(o oydlpeelfeilt) 2tr(ro;u1olxoii3tadfa raump;()aetrmr iytfa  au i t)trtm(m3ny1lp e fvsl(faDtaurpnu4alxn f3ildlaDumn s;(4altomf3iotomDe neo t) rxmxo3nudameelietas)aDururpot0aleo oeiatfa em(msnu0teermr3oadomDrlnvols0 2to(o3nydameelfet (fartaurooo4oee ioctltlmDrm(mo;u0texrirciy1om eanes t setrir iy1alt lieils) Duaxmpnu1olt  feiltfm2uanms;u4tltrir tydfmtrlnei ( setrir3oy1ole lnct (fartrumpot0olt  octldlmDrm( pnu4 rxrxo3iytfpDe n s;s0 rtrio3iy1omeemfesat)sDtaxr ;u1tpxoioctaslm elnvo u)texoiocoa1lpDr iei;()trumim oo4opte ivs (f Dtaum ;u0teen i3tlsfs2rlu p;t4 rxnifctytfmt aneolt0 euo(m io1lp elncils a2rr(r nt1olenioetltlm emn pnu4aeermf3tytlaDe u o;(0trurir oudomtnmncs sfarua(mo;o0opxn o3ilslmDum( o;u)aetoxrcio1fmt  i i;t)s2to(opnudlp elfes tfartm(rpnu1oltnmocilsfmDemuvsn()arxnifciydfmtelneo;s)tetrimpoodlmt lieia( arrmu ont1oltn ieildla2emnmo;u0 lenmr3iadomt li i;(  2tmio3io4amt mfes (fa2um(  nt0tlxo ictls s2rau o;t4aeeoifctadoaD anvi t) etm(r io1ape  nvsasf rumx  ;t0opxomi3tltfa ul(mpn(0teermf3tytfmtraivi;t sexr(opoy1ap n nei ( aDrauronu0tle mfeilsfa umnmo;(0teeoir3oatlptr ues (  rxm(mpiydlltn ivsa()srta( p;u4oet ifcildfaDumnvp;u4aexoircta1laD anvo;(0trxr(o3nu4op   nvt s arraur nt0apenifciad sDea(monu4 exrxr3oy1fa elueolt) rtrxr3no4olt mfcta()sDrmu o;o0tlx  fcildfa uaumon(4trenmfcto1oaDean o;s seurxm3nu1al e fesls srtm(r ou0oleo o3tltlmDrluvsn(0alxrmf ia1om  lneo s0 rtmxrpno4am  mfeiat  Drmx pnu1aetomiciyd aDeau pn(0trtnir3iy1fpt lu ils s2urxr oo1lpeemfesa( aDrau  nu1olxo ociltfs2um(mon(0 reoxr ootla eauvo;s)teuoxr3iydole mfcsa(faDuax  ot1alt  feiadfm rmu p;t)tetrmr oadfatrai s;s seuoxm3oo4lmtelfvi s  2rrx pnt4texoioeiytfm rm(vo t4trxoirciotomD luvil( srxrim3iy1aptelncs () rrrur oo1opx  ociytfm2emnmsnt)areomr iydomtraieo s0s2to(m3iy4ap  mict s  2ra( oot4ope ii3iad aDra( ont0teeomf iy1omte ivs;t  rtr(m3iudam  lnes sfsrtauro;u4olx  fcilslsDrln s u0trtrmocty1oa raies (  exrxr oodalt  nvtlsf Duax oou1oexo o3iatlsDrmuvsn(4texnifciytlptranes;s)texrxrpiodlmt lfet tf Drr(m oo0olt mocild s ua(mp;t4alerxr oytoptrlnei (0s2xoio3oydalt lfeiasfs2rm(mo;o1apx ifeilt a2umu s u0tlenxociadlmDe i o;s) euoxm ny4optnmncsl()srrrumont4aetomf3ias sDrln sn(4alxrxocto1lpte i s;( tetmxopny1ape mnct ()s2rrxmono1tpenioeiat a2uanms u) exoif iadfa rlivi;(0 rxr(o3iu4llenmictat) rrmur ;o1aleomietls a2rauvs (0 rtnxo oydfaDelivils0s2umxm3ou1lmeelnetasfs2tru  oo1tlxnmietltlm2rlnms t0trtnmo tydlaD au i t srxoxr3no4al e fcias) ruau o;t4tlxnioctaslm2ul(mo;u)altnxr oa1lmte uvslt)seurxo oydlp  mnvils  Drr( oot4oex ifctat sDea(msnu4trxomf3iytopDr nvi s)seuo(m3nu4ole lici s aDumx oou4tlenmfetatls em(ms;(4aeeomf oadlp e neols s2xoirpoy4omt lfviltf rrau o;t0oltoiieilslm el(mon(0arxrxocty1lm eln o;s  rumim iy4opeelnvilt  Dumxm nt1apenioetldfa uan snt4 rxoxfcia1om  anvi;s  2xoxrpou1ome mneil( sruaxront4ope mfetyt m umnmon()tltnxrctadomteluvslt0t2uriopnudlleemfvia(  2ur(m ;u0oeeo octat a rm(monu0 eeomf iytop  aueil()seumim ny4lmenmiesls)sDrruront4aptoii3tyslaDeanvo t4aleoio3ia1oaDeau i;(0seumio3nodoltnmicta( sruax ooo4aeeoif3tyd m2uau snu)aetomo todopDeaivs;t)s2xrir3iy1lle mncs (  2tm(  ;o1oleo ocias s rluvo;t)trtrircoy1fmt aieil( t2trxm3iy1opeemnvtl(f rtaxm oo1ale ioeiltlm2emuvsn(4 ltnmo3tatfatrlneo;( teum(mpio4lleemfesasf Draxrp;u1texomicildlmDelnmsn(0alxoiocoo1fmte n slt)s2tmxr3nydalenlivs t) 2trx oot4tetniiciad s rauvp;(0 reoif3tatop rauvsls)t2xmxm ny4olte iei s)artauront4tlenii3iytlmDrl(vo u4aleoxfciytfpteau i s0srto(m oydoleelici s)sruaump;u1alen fciys m2ua(ms;u0 eenmr3tydomDeaues;(0seuoio iydame  nviasfs2trum ;t1aptoif3iydlsDrl( s () rxrircoytfm r ieo;t) 2toim3nydlme lictls  2trxr ou0altoif3tltfaDum(mp;t)artrif3iytop rau s;t0 exrim3ou1lle lnetls srraxrpoo0ape mi3ilsfaDeaums;u0alermf3iotfa ran o t0teum(opoodlme lfetlt)s2uauro;t1aexnif3tld a uanvp;(4areomrcto1lp eau o t) eto(r3nudlle mfvt s a2uaum nu0oexnmf3tyt aDemn o t0tetoir3iydfpte i s;()tetrxo oo4op e fcilsf rrrxmp;t1tlt  fciytlaDum( p;t0aetoif3ia1op rauvilt t2tmxm oo1ape lictlt) 2um(mooo4tet mf3tad a emnvon(4tltnir3tatlm elneilt t2xrxo3no4ol emfvsasfarrru o;o1aeeomo3iadfs em(msnt)areoxfcoydlp rluvi;(0t2uoim nu1ll  lfct t)aDtrx o;o0opx iictasls2em( s t0 etnmfcoodopDe u s;t)teumxr ou4op nlies (faDrau pno1oleomfetlslsDel(ms;u4artomfcoa1lmDe i o;s)s2ur(opiodalee fvsltfsDrax pnt4apxomiciasla uanvs ()aetoxf3tatfaD ln o t t2xmxm3iudap n neta(fs2rrxmpno1tpx  f3tys m2rluvp;(4alxrircoydla eanvils  rur(mpnudoleemivia(f Drau pno1oeen fciytfm2em( s;t0 etnxfcio1oa eai i;t srto(r io4olt mfeil( artr(r ;t1olxn feils s2eanmo u4 eeomf3oy1lm   ivi;(0s2xr(rpiy1apenlneias a2trx  ;o4tpeomf3iytfs2rlnvpn(0texnxrctadopt luei t t2xoio iy1altemfvils)a2uaumoot1olenii3iatfm2uaumsn() lxrxf3totlm  anvi ()sexo(o no1op  mfci (faDtrxrpnt1apxoioctls mDulu ont)aeeoiociodfpDrlneilt)t2tmxr3iydoltelnet s  rra( p;t0alxnmociadfaDrm(vp t0 lerifcoatla   uvol(0s2um(opny4lmt  feiltfa2umxr nu0teeo octat mDrlums;u4tlxrmf oadoaD aneo t srxr(r io1alenmfei (fsDuaxmonu4texoioeiatla uanmp t4tltoxf todlptrlivo t) 2xoir nu4lmte ncia(  Duau  nt0tlxnmi3tytlm2rlnvo;(4tltnxfcoo1lp   nes ( t2umxrpou1lp   nvia(  2trxmonu4opto ociydlsDuln p;u) ltoir3iadfpDrai o;s0 2to(r no1om nmicsl( aDua(mono1oee ifeiytlmDea( sn(0altnmrcta1lm  livi;(0t2urxm nudal nmfcsltf rtau pot1olt mi3iasls2eanvsnt0 ltomfctadfatelueil()sexrxo nudom emnvsa()s2ta(m ;u0altomoeilsls2rmuvp;u)alenif3oy1oaDelu slt) 2umim3oydllt livi sfsDuauro;u4aeenmoetat a2emumo u4 eeoif3oytoaDrlnvo;t texo(o3no4alenmfciltfsrum(mpnu4alenioetytfs2rlnvon()alenxo iatlmDeaivi;t  eum(o3oydom  lnci sf Dtaumpnt4opxn fciysfm emnms;u)trtrxf3iy1fpDrai s s0srurxopoydapen net (f rtr(rpoo0oeenioetltfaDeau pnu0tlxrxo to1omDelneo t t2trim3oudllenlnvt ( srumxr ou0aeeoioetatls2um( s t)artnmf3iotopD auei ( setr(m nu4ale mfci s a2rrx  ;o0olt  feildlaDrauvonu0 exrmfcto1fm e ivo ( teumio iu1llen nct tf Durxr nu1tlxo f3tys m um( o t)trtnio3ia1oat  uei s) eum(r io4lme lncta()srum(mpnu1texomiciat a emnvonu0trtrmfcootom e uvi;t  eum(rpiu4apenlivtlt) ruru oot4opxo o3ild m emn s u0 ltnxo iy1fa  livo () etmxm3iydaleelfes t aDua(m nu1teeo ieildfs2uln s ()texrmoctatomt  uvilt)trxmio ny1lpt  nvsas) rtrxmono1tpx  iciytfa um(vo;u)alerifctotfmDeaneo t0teuoiopiy4aptn icsasfs2rrx p;o0aetn f3iad s2emnvsn()arenxr ia1oa r nvolt0sruoxm iydlmtemivsa(  rtmumpou1oeeomf3tys aDean o;(0trtrmf tydlpD  u s;( setmio oudal  lnvs (fsDrmx p;o0tleniietydls umu o u0aetrxr iydomD ln o (0srxmxm3nudaltemnvta(  2tau  nt0oltomieiatfa um(vs;t)tetnif3oatfaDrli ils)tetrirpny1optnlfetls srrm( p;t1tex ioeiytfaDumnvpnu4 rtrio oytoatraivo s0srtr(r3ou4ol e ivsltfa2rrx p;t1tpen fctaslm ulums u4teenmrcoy1lat ai il(  2uo(mpoo4op nlicsl()arraxmpnu4aexoiiciytlsDea(vs;t4texoirctadla r u s;(0sexrxrpoudol n nesat)sruru  ou4aeto iciysfsDua(vs (0 lxoxo iodla rlu ol( s2xmim3nodam e nei () rrmumoot1tpeo fetlt aDuluvo ()alxnxf ty1oaDrauvs;t0 etm(opnudamenlncsls)aDtaurpno0oeenmfciasla ua(vs (4 ltrmo tytfatr iei;t0 rtm(opoodll elicslt)aDtrxr ot1oexo o3iys s ranvsn(0arxnxo oatla elivs ( seuoir3no1apt livi t)aDrax p;u1altoioetltlm el( o;u4 ltrxf oodomteanvo;t) exr(m iy1altelfvta(fsrtax p;u1oeeomfetydla2rlu onu0 lenio totfa eanvo;t0texo(mpiudlme  net ( sDtr(root1tlenifciat a2emu p t)tltnioctadlmte ieil()seumxopoydol nliciatfaruaxmp;t1oex moetltls uanvs t0 lenmf ia1lm elivo t tetoiopny1apee fctasfsruax pnu1alxnifciyd mDuanms;u4 leomfciotlpt auvsls seuoir3nu4ape  fcs tfsDrmurp;u4aet mfctydfs elnms (4 lxnxociadfmD aieslt0 2tm(r3iy4amtelfviat srta(m oo4tetoiictlsls rl(vo;u0 exrmo3oytoatranes s s2xoim iy4alt  icia( arraxr ou0tpto ietysfa2elu s;t4trtnxf tadla rai i;s)t2urxr ou1lm nlfcs t) rua(root0opxnmoeiyslm el(vo;t)tetnxo3oodlpteli o s) euoio3no1omtelfesa( sDrmx  no1olxnmo3iyt m2eau snu0texrir3iy1laD lneslt)s2tm(rpiudlm  miesl(f 2urur nu4altn oetls a2rmu p;()trenio ia1fp eluvi t tetmxrpnudlle lnvsasfa2trxro;u0opt if3tlsfa rmu o;(0aleomf totlmtr uei;s0 2xo(o ny1omt lfet s)sDuax oou4tee  fciat aDul( pnt) rtoxr oa1faDe nvi t0teumxo3ou1openmnciat)s2rrump;u4aptnmoctad s umumo;u)artoxr3iodfpt  nvs ()t2umiopiodll n fcs () Drmum no1tlt mo3iltls2uau o t4 lxomfctytfpDrln s;s0teur(r3iy4opt lics s srtau  ;t0tleomf3tad a umnvon() ltnmrcoodla r i i t  etrio3oy1alt  fvtat) 2rr( o;o1tee  o3iydls umnmp t4arxrmo oo1fpDraieo;()texmxr oo1aptnlfcsatf 2ua( pot1alx ifeiltfsDra(vp;t4aleoifcty1la rlivi (  etoir ou1oltemncslt s2uax oot4aeto feiytfsDemnvs t0texnirciatfpt aieols)tetrxr3iudamenmfcilsfaDurx pnt0tltn ociat m ea(ms t) exoxf to1faDr ivs t  ruo(mpoy1ll  lieilt) Duaxr oo0tlxoioeias s rlu o;t0trxrmf iy1fmtr i i;s)s2toir3nu4omeelncsls s2raxrpoo0ole  icilsfaDem(vpnt)alxrxf3totfa eliei (  exoxmpoydom elfvils) 2urx o;t0olen oeildfa umn p;t)aexoxr iotlaDran o (0 rxmxrpou1om   ncta() 2ra(rp;t0tltnmociatfaDum(vpnt0aexoifcoodla   ieol(0s2to(r iu4ame lieilsf 2tm(m no0tpto i3iltfm rmnvsn(0tlenmocoatop  livi;( teuoir ou4lpenliei ( srurxm oo1alxniiciydfaDrmu ont) exnmr3tydoat  uvi ()srxrxo oy4omt  nvtat srtmu pou1tpe if3iyt sDul(vonu)tltomfciydfaD  uvsl()srum(rpny1ole mictltf Dtru p;u0apxoii3iad a2elnvpnt0 lerio3tadfaD  n slt)tetmxo iu1altnmfci ()srrrurpnu0aex mfciysla2umumpn()trxnxr oadfateau o;t0 2umxm oudllt  nesl(fsDurx ono1alxomfeiltfa uauvp;(0 rxnxr3oytoaDr uei;t texrxr3nydam elnctlt)arrax  oo0aeeo ieiyd a umnms u)tltnxf ta1fp   nesls0 2xoim3ou4openmnvtlsfs2um( p;u1apen feildfa2ea(mp u0alxoxo3iatlmteaueo;t)srurxopiy1om elici () rraxmpno0oet mo3iytfa rl(vont4aeeoxr tatfatrlueols) exrxmpiu1om  lfvtas s2rrxr oo1apt ioetasfa2em(vo;u4 lxomocoatopD auvs s trtoxmpio4lmeemics ()aDtax  ou0aet mi3iyslm2el(mon(0tlermf ia1oa   ivs s)trxr(opio4omeemiviasfsrtr(m nu1tpxoii3iat s em(vpn(0aeenif3oadlmD aivols teto(m oo1lltelnct s)srur(m ;u1tet mfcilsla elumsnt) rxrmrcoy1fp eln o;t0 2tmir iydopee ies s a2urxm ou4ole  oetatfs2rluvp;(0trxoxf3oo1faD luesl( texr(r ny1amt  iet t a2rm( pnt1altn oeiys mDrmump (0arenxo iydfp rlies (0setmim3ou1amtnlnvsasfa2umxrpoo4apxn i3iydfa2uanmo t)arxnirciatfp   ues;s0t2xoxr3oydap n fvtl()srtrxm ;t1ope  oeiasfaDrlnvpnu4aetoxrciodoptrluvo s trtrim no1lpenmics ( artm(  ;t4olt  feiad a2ul(mon() exoio3oydlmt aues;t0 2uoim3io1llt livi t)s2rax  ;o4aleo feilt mDrm( o;t)aeerxo iodoa   nesl( seurirpiu4lp n ies tf 2uaxm ;t1opxo ocias aDra(mo;t0areniociydomtraues;(  rxo(r oy1llt  icsl()s2tmu p;t1apx ioeiydls eanvo;t0 lermo3iytop   i ol()trur(opoudlpte nvt s  rraur oo4opx  fctadfs ea(ms t)teerifcoy1oaDe uvilt0 rxmiopoydom nmicta()s2urxmp;t4tpxo fctaslmDuanvo u4 etrmr tydlp eliesls)sexm(m nodlp e ici s)s2umxmoou0tlxo fciytlmDelu o ()artnio ta1fp   i ils s2trxr iy1amen ietltfa2uau oou0alx  ieiytfs2elnmonu4 ltrirctadlate nei (0srtrxm oy4amtelics tfs2uaxmooo0altnmociadls2em(mpnu) ltrmr3io1fpte uvo s t2trxo nodaltelnctls  rrmxmp;u4ole ii3iytlm2emumpnt4teenmrcootfmD  ies (  rurimpoodomt  iesltfs2tmx pnt1oexnioeiltlaDumnms u)aleriocoadfpt aueo;()trurxr3ou4amtnmnvi t  rur(moot0alenifctatfm umn p t)artoxr oo1opt li o;s0 2xm(r3io1amenmivtl()sDua(mono0oeto i3iys s2rlnvo;t4 rtnmf io1fpDeaneols texrirpnydllt mivi tfaDraxmpnu4teeo ictatls2em( snt0aeeoiociy1op elnvi;t0 ruoxr oy4ap nlivia(fa2tau onu4aptomo3ildfa eanvo;(4 lerxf oadoat  u s t srtoir oudape miesa()artm( oot1tptoifctatfsDua(vp;(4teenio to1fpDran i;s s2xm(m nu4ome  nvta()srtmxrpnu4tlx  f3tasla uau pnt4 lxoircoodfm  lu ols)sexriopoy4omenmfet s)srraxmpnu0aptn oeiadfa2rm( s (4arxoif3ootfp   neolt)seumxopou4altemfvsl(  2rr(rpoo4tlxnifeiasfa2uanvont)aetriocta1lp rln o;s)sexr(opiy4lmenmncsl( a2uaurpno4aptoio3tltlm2uauvsnu0 ltnif ootopte ues t sexmxm oodlm elieia() 2ua( pnt4tpxn ictat a rauvsnt) rxniocoydoptrlies;t  euoxrpnodale mneia(  rtmxm ;o0tltoiieiatfa2ulnms u0treomfciy1lpD  u sls0 rxmxo ny1olee fvilsfaDtaxr nu0oeenii3ildfs el(vont4tetniocoydfmDeli i s0trtr(rpiy1amte ncs s)s2rrxmp;u4teenmfeiaslm2rmump;(0altrmo3iy1fpDelieil(0trtrirpoodlltn fvt s) rraxr oo1oetomfciyslaDea( ont4treomf ia1om rlieo;t) rtr(o3iudole mnvil()sDtax  nt0tptn ietlslaDranvs (4teenmo3ootfp   nvs t texmimpnodalenmncslt) 2umxm ot0tlt mocias a uan o ()tlxoifcia1fptr iesls0srtoxopoy1lle lfesasf Drau o;o4tle mo3ilt m2uanms u4alxrxrciadlmtr n ols)tetrxo iudaltnmncilt artm( ooo1tpxomietltlm ulu p (0artrif3oodom  ai olt)s2toim3iydolt mici s sDtru pou4aetoifetydlm2umu o;(4tetrmr oadlat livolt0 etm(opoy1amenlfcslsfs2tm(  ou4tptn oetas m rm(ms;(4 reomo oodfmDrai o;(0t2urxmpiudolee icta() 2tmxmpou0tltomieiltlmDeln p t0 rtnifctatlptrai sl(0 etoxr oodalen fcsl(fa2trx o;o4tpxo iciaslm2uauvs;u)trerirciadfpDeluvo s0setm(mpio4ape mnct s)sDra(r ;u0olx moeildfm uanvp;()teerif iadfmDr nes ( trxrxm oodlp  mnet ()aDrmx oou4tpxomociytfa2uaump;() leomr oy1fa eanvilt  exmxo3ny4om  mici s a2umx pno0teeomi3tys m2umumonu0trxnxo oadfate ies (0t2uo(o3iodalen ncils)arta(rpno0oltnmo3ilslsDrmuvp t)tetnxf tytla rlnvo;t  rxmir ny1ll   icsasfartrx pot1ape ifetatlsDrmn p;t0 rxoxf iytlmDrln sl(0s2xmim3io1om elfesa(fsrta(  ;o1oeeoif3iadfsDeanvp t4tlxoxo3iotop   nvo s)s2xmio oydlm n nvtasfa2tax ono4tlx mi3tltla2rau pnu0 lxnmfctodlpDr nes s) 2toiopiydopen nci t) Drr( o;o1olenmoeils m2ua( s (0arxoxf iodfaDrlu olt) rtm(o iodlptelicslsfs2raum ;u4aleomf3iadfa2emn onu) rxrmrcty1fptr n s;( sexmimpou1lmtn ictasfs2taur no4tlxoioeiat a2uaumsnt0trtrif3iydfmD  uvs;s0texo(opnudaptnlictat srrrx ooo0apxnmiciltlaDeanvs;(4aexnxo oydlm rauvi s0trtr(m nodlmtnlnvia(fs2rru ont4teeoiiciasfsDemuvo (0alxoxf3tadoatr i o t  exmio ou1lmeemfeta( arra(ro;u1tpen ieiadfm rmnvp (0altoxrcoydfp raiesls0 rxrxr io4lpee nvslt s2uaurpoo0tpx mocilsfmDrmuvs;t0 ltrio iytoatraivs s)s2xmxo3no1ll   ietls  rtm(ront4tptoif3iadfsDulnmpnt4 rtoxo3totlm e iei;t0texoim oydlm   iesas arum(rp;t4tet mf3iat a2eln o;t0aexrmr todlmDe iei;( srtoiopnu4aptnmfcil()sDtmxrpnu0optnmoetlsfm2umuvsn() eenxf oo1fat  nvilt0sexrxm no1am  lnvtasf 2tmx pou0aetnmoeiyt s uau o u4alxrxrcoy1lptr neo;t)seumim nu4omt  ivi t sDra(rp;t4ale moeiltlm uaumo ()altrmr tadfm rau i;s s2xrxm3ny1lmeemnvils) rrm(r oo0opt mieiyd mDra(mp u4aetrxr iotfmt  uei (  2xmim no1apenlncs sfa2ua(mpnu0aee  oetydla elnvp;u0 renxr iadlm  aues s)sexrimpoo4apenmiei () rrrurp;o4texomfciysfa ranms;t) lenxr oa1om rln s s0 rtmiopou1op   ivsls sDtm(rpnu0olxo ieiytfm ea(mo;(0tltnxfcoatlpt auvo;s0 exm(o3oy4amtelfesl()sruau p;u1openifciltfsDeln s;u0tetoxocoy1lm   uvi t0 etrxrpiu4al nlfctltf Durxrpou4tpen f3iytfa2rmump;u0tetomo io1oateluvs;(0seuo(r3no4optnlici (fa2um(m no1oetomiciad m2umu p (4 rtrmo3iodfaDe ivi t0trurio ou1lp e nvsl(f 2umu  ;t1tpe if3ilsls2rmn pnu)tetrxf tydomDraieslt0sexr(m nu4lpeemnvil( a2taxmpot1tlxn fctaslsDelump;u)aetrxrcoydfpteluvi t trxoiopio1alen nci t) rur(r no1tee ifeiytla rm( o () exrmo iodfat ln i;t0 rurirpnu1lmtemnvtatfsDrrxmoot4tet  f3iadla2uan sn(4teeoio iytopDrlnei t)srurir3nydlltnmnetl( a2taxrp;t0texnmieild m2umumo;u) eermrciy1op  luei t s2xmim no1ol  licslsf rtrum ;o4oeeomi3ils mDrmnmsn(4tetnircoodfpDeaivs t  2uo(opiudam   feiltf 2ururo;u4oet mo3ilt a elnvsnu4tetoxrctadfp  au o (  2ur(m3ou1altnmnetatfaDra(m ;u4oex mfctltls2elnmp u0 ltoxrciadfpDranvs;() eurio3nu4lm n iet ( s2rmxm oo1opxn ociatls rlumonu)tlxrxfctodopDraieol(  etmimpiudop elivt (fs2tm(r ;t4oleomfeiaslaDua(ms;u4 rxnio io1om rlnvilt0sexrxmpnodomt  nvsa( arumxrpnu1apx moeiytlm2rauvpnt0arxrxf3todoatranei t  2xrim nydome  fei tf Durur oo0alxnmfeils s ran p (0altnxoctytlatrauvo;t t2umxmpiy4omtnmfvs () rurxm ;t4apen i3iytla2uan pn(4arerif io1fa rlivols setoxo oo4omt  ncsat) 2urumooo0oet mfeiad aDea(vs;()aeenxf3oy1fpDr neo;t)texrxopoodlme lfvia() 2trx  ;o1tpxnmociys s ranms (4 exrmfcoadfateli s t0sexm(r ou4lmen ieil() Dra(mpnu0optomfcilt m2emu onu)tlenmf ia1fm rli i (0sexo(r iy1ol elivt ()s2tmuro;u4texn i3iysfa em( sn()alenmo3iodlmtr ies;() exrxm3oodoltemncs t)sDtm(m oo4oltomoetasfa emumpnu) ltoir3oo1op   ieo s s2uoxo3oydlpt livta( artmu ont1aet mo3tatlm2ul( p;t0alenxr ootlmDrlu s;s0texmxm nodlmtelnvs ( srua(m no0apeo i3iys a2eau p ()alxnxr ty1op r ivo t tetrim oy4lltn nesas)sDra(rpno0alxniieiydlmDrl(vsnt)trenxf iytopt lnei s0 2xo(o3oudopeelnvia() Dtax  ;o0opeoiictatls ua(mp u)aexrxo iotlm rlivolt0texrxrpoydomtnlfvsls srum( pno4altoii3iatlsDulu o u4 eeomr tadopteai s ()texoxm3iu1alenmncs sfsrrmuro;o4alx mictyd mDrmuvo;t4 lenxrcootomtr ivi;t) ruoxopoo4lmtemfvia()srraur no0tetomfeils s2ran p t0texoif iotlmtrlueo (  2tmxo oy4al  mics t)arrrxroot1alx ifeiydlm uanvsn() lxoxfcootomte u ilt)srumim no1amtelnet ( s2urx p;u0teto fciltla ulnmo u4areomociodfmtelieil(0seur(o nydale lfvtlt)srrr(  ot4alen ociyslaDuln p;u0alermr3iatla  aneo;()srxmxmpoudlptnlnvi s)s2tmurpot1oeenif3tyd m raumonu0tlxnio3iatomDelnei t0srtoxr no1open fctlt)s2tm(ro;o4tlto ietyd m2em(mo;u0alerxfcoatla   n i s)trtrxrpny1lp nlieslt  Dua( pot4aet mfeiasla emuvp;(0 lxrxf oy1faD anvo;(0 rumxr iodap  mietat)srrrxmooo0opxo ociasls umnmo ()tetrmf iodfp rlueo;s) 2tmirpno4om e feiatf 2umur nu4oexnii3ild s elnmonu4 rxomrcio1fm r ieolt0srtmxopoudlpt miesltfaDumxr ;u0tltnmfciatlm2uaums t) rtomrctydlp rliei;t)teuoxm io1open ncsl(fa2urx p;u4aetnmo3tas m rm( p (0 eeomr oodom rauvol( teuo(o3oy4al n ieil( aDtru ono1tltn ociatlsDulumo;(4altrmo3iy1opDr nei;( s2uo(rpiy1am n fetlsf rrm(r nt4tpt  fetadfmDua(mo t4 exrxf3ia1fpDr iei ()srtmxopou1ame mnvsa(  2rru ont1tptoifeiltlsDemnms u)tleoxo oa1laDrluvolt0s2xmxo3iu4lm  livtltf Durxmpnu0teenmo3iadfs2eau pnu0tlermrcta1oaDe ies t0t2urxopiodom nmfvsl( arrmx o;t1aee mi3iyslm2ul(vpnt4 eeomf ta1fptean s s)srtoxm oy4omen iesat)s2tmumoot0tpenioctlslm2rm(ms () eeoio3ty1fpte ieils)teuo(mpnu4ll  mncta(fa2tm(  ou4tlx  fetls m2uanmonu0alxnmf3iadlmtranvo;( sexrirpou4amt  fcsls a2ur(  ou0tptn ictatfmDea( sn(0 exrxocty1lmD  ivo ()trurimpnodomt lieta(fa2rruro;t0ope  ocildfs2umums;() eerxf tydom e nvo;s0srxr(o3iu4lpeemncias)aDrauroou0oeeomo3tydfsDrl(vp;(0trtomf oytfpt an s t0 2xm(mpny1lltnlieta(fa2rrumpnu0oex  feiadlsDelnvo t4 rtoxo iodopDeaiesl()texmxmpno1al nlneta() 2raxr nu1altn iciatfa ul(msnu0 leomf oadfatrlneo s0 exr(r iydlpee nesasf rtaxrp;u4tlt miciyd a2rlu s;u4arxoir3ootopDrlu sl(0texoxo nudalee ncta( sDraxro;o0tpeoifetydla2rmuvo;u)alxrxr3oytlaD  ueol()s2urxr3ou4ape  fctas arrrx o;o1apxoif3tltlaDrlu o;u0 lxomrcoy1fmDeaivi;s0teuriopoodlptemneil()s2rm(rono0aeeoiiciaslsDeauvo;t0aetomocoy1fm  lieo;(0srtm(opiu1altelnvtl() rtmurpou0oexniicilt mDemumo;t)tltnif tytlatelnvsl( trtr(o3ny4ol   neilt)sruaxmp;t0aptoii3tytfm2el( p u)arenifcoo1op r nes t) rxm(mpiydaltnmfetlt)srtr(mooo1aeeniieiadlmDrmn on(4trtnmfcoatfa elnes (0sexmxopiudaltnmies sfs2ur(moot4tlxnifeiasfm em(vsn(0tltoif3iy1oaDrlnvsl()s2um(o ny1ap nmietatfa2tmu p;t0ole  ociytls2um( o u)aetnxf3iodlp rlieo t0 rtoim oy1lmeelnetlsfsrta(mono4apxo ieiydlsDrm( snt)aetoxf3to1fm   nvi t)teurxo3nydoleelictl( s2uru  oo1tetoioctatfm2eauvo;() ltnxf3oydfp rlnvs;s t2xrirpnu4ol  mfvsa() 2rrx  ou0apx  ietasfsDrauvpn(0 lxrir3iy1lpDeaivo;s)s2xo(o3oodop e ivsat) rrr(rpnu1olxnmictydfa uaumpnt)tlxoxociadfpt lieils0 exmiopou1lleemiei s a2uaum nt1tpx ii3iyd aDumuvs;(0tlxnmf3tadoa eaivo (0trur(o3ny1ll   iet tfa2rm(rp;t0texnmfctyd m ulu s u0arxnxo totlp raneo;s) rxoxr io1amtelfetlt)a2umxmo;t4teeo i3iadls2rmuvsn(4 exnmf iytopte uvs t trxrxr3io4op  lnetlsfsrur( oot0tetn fetyslm2emumpn() renmrctodlat  ivsls0seuo(o3nu1oleelivta(fsrrauro;o1oltn ietadfm2uauvp;() exomr totlptrln ils) rxoxrpnu4op n fci s sDrr(mo;o4tpe  oeiyd a2rluvs u) etrmocio1fmteauvo (0 2xriopoo1ll nmfvt t srtr(rpnu0alxo fciatfaDel(vo;u4tleoxrctydfmD  nvo;s)seuo(m3oy1lp emfeta(fs2rmxm no1tpxomf3iatfa2um(von(4tlenmo todopD  u ilt)teurxm3oy4om n icslsfs2uaxmp;u4aeeo f3tltfa2rln sn()aeenxo ia1laD  uei;s) exmio oudopenlictasfaruaxrpot0tlxnii3tydlaDuau s;() ltnxf oa1fmDeau i ()t2xoxo3iudomt  ivsl(fa2rmx  nu0alxomicilt m2uanmonu0arxoxocoa1omD  ivo;s0 2urimpnu4open nciasfarrmumpnt4oet iiciltfsDrlums u4areoif3totfa e ueo;t t2xm(o3iu4om n nciasf 2rr(m nu0tpe  ociad m2rluvpn(0 rxrmr3tydomD lies;()t2uoxopiudllt  fci (f Drr(mpou0tetnmoeias a2ea(vsn(4 rtnmociodfpt  nvols)teuriopnu1apeemicilsfsrua(ro;o1oeeoiicias m2ul(monu4aetnmo oodlpDrau ols)tetrxr3oudaltnmneslt s2urxmooo1teen oetasfs ra(vp;u4texnmf ty1omt livi;(0t2uoir3nu1ameelnci sfsDtaxm ;u1aex  ieiytfmDemnmon(0 lxrmr ty1optrlnesl(0s2tmim no1lm n fcsas  2trurpnu4altomf3ilsfs2ra(ms ()areoxfcoatfmDe nvi s t2tm(m3ny4ame mfctlt) rtrxmo;o1oltoiicild aDea(von(0 reoio3iy1lm  aivo s) 2xm(mpoudomt  fcs tfaDurx onu0aexn oeiadls2emn p;t0 eerxf tydfmtr n o (  exm(m nu1om e fctlsfa2rmx oou4opxnmf3iyd s elnvpnu4 exoirciodomt luvils)t2umiopio4llt micilsf Drmu p;o1alen fcild a el( o;()tlxriocta1fpD lnvs;t0sexm(o3oo4aptn nvtls  Drrurooo0apt  o3ild m2umu snu)tltrxo3iydopt  n s;t0t2uoxo3oy4ome  fci s)a2uax pnt4alxoifctadlsDelnmon(4aetrmo3iadoa   ieils s2um(m ou1ol e ncslt sDuax  ;t4apto octytls ulumon()tltnirctadlmtelnvs s seuoir3oodol elnctat)a2um(m oo0aeeomieias a rmnvont0aeenioctydlptr u s;() 2urim iy4alenmfctlsf 2taurpnt4tptomf3iytfsDrmuvo t0texoxo3oy1op   nes t t2xrim3io1om  mfei (f Draxmont1alxnii3iysfmDeln o;t0aeenxr3tatlmDrln ol(  rxrim3nydll   neta(  Dtmu  ;o0apxniieiytfs eanmo t)trtrmocto1fp rlieo s0 2xo(mpou1opteliei (f rurx oou0altomociysfs2ul(mo (4 ltnir3ootomDeai ils0 2xo(m3iydapee fcsat aruaumoot4olx ifctytlm2ua(vs u)altrmf oytlmt lu ils0 rtmimpoo4ape mfesls) ruaxmo;u1ope mfeilt m rm(mp ()tltomrciy1lmt aivi s srtrxmpiydol  lfvt s) Dtmuroot1texo fctytfm rmnvp (0teenxf3iydlp e i o t t2tmim3iu1lpeemfei s)srrmxmpot4tlx moeiys aDean o;u)trxoif3iadopD  iei t)trxmxopny1lptnmfvt t aDtauront1tlto f3iyslaDra( sn()aexoxo oadoatrlnei s0srtriopoydape liesat sDtmxr ot1tee  f3iad m2umn snu4arerxo tatfaDeaivsls0texmirpny4lptnmivsas)sDtr( oou1oee  ociat m el(vsnu0trtnmrcootfp  aneo;( s2umxmpny4om elnesas)aDrru pnu0apt  oeiatfmDrl( ont4tlxoif oydomte n olt0 rxmiopiy1lpe mfeiat)arum( poo1tlx ifetls a umn snu0tlxoircoo1fa r ies;(0trur(o iudaptemnvsas)s2um( oot1tltnmfetasfm2umn o (0tlxrxr3iytfp  aivolt0srxm(r3nudape mncsatfsDur(moot4aexoiiciatfm2rm( s u0 ltrmo3oy1lm rlues;s)srtrxm3io4lmtnlfesl() Drmuro;u4aex if3iatls ua(monu4texrifciodlp elneils trtm(m no1ap nlfvs sf 2tm(ront1apt  feias m2rlu on() lenmf3oy1opteluvi;s s2um(m no4ap  mfvtlsf Dur(rpnu4aee mo3tyt aDrm(mp;t0trxoxocoa1op e uvo;(  rxr(rpiu4alte nciatf 2raxmpno0aetomfeiytlaDrl( s t4trermr oadopD lu i;t) eum(r3nu4ol elfesas s2ta(m ;t1tlxo iciatlsDrmnvon(4alermr3io1lat anvols0s2xmxopiodoleelict s  ruaxroou1tpxo feiydlm2emn p;t0alxnmr3oy1la r iei s t2to(r3ou1omtnmies t)arraumo;u0alxnifeiasfa2uanmont0aexomr3ootlpDeluvs s)t2to(mpiu4ape mictasf 2tm( o;t1tlx moeiydla2elnmp () renio io1fa rlivo s srxm(opoydlpe  iciltfsrtmx p;u4oleo ictyt mDeau pn()tltoifciytom r ivo;(  2xo(m3iy4op nlnesasfaDrmur oo1tetniieiatlsDum(vs u) lxnir3io1omtraueo ()sexoxm iu1lp  lfesl( s2umu o;u4alt mo3iasfaDuau o t4 eeomociatlmteau s s tetrio nydlmeelnvslt)a2taxmoot1tpe  feias a rlnmo;t0tleoxr tadomD lnvslt0seurim3oodomt  iesltfarrr(mo;t4altn i3ild sDulnmo;u0tetomfcto1lp rlues;t  rumxr3oy4omeelfei ( s2uau onu1apeniieiysla em(vp;t0arenmf3oo1lpteaivs;t)t2trirpnu4ap  lieiat  ruauro;u0tpto oeildla2ra(von(0 etoiocoo1fp eau i (0s2xoxm3no4lptelfvsas  rua(monu1alxo ocildfm2elnmont4 etnmrcoytfp rlieils)seuoxm3oo4al  mivias)s2raum ;u1olxo feias a2el(mon(0alermfctodfpDrlivi;s0t2xmim3iy4lp nmfesl(f Dtr(m ;t0aee  o3iad a elumon(4 etrircootlm  anvols)srxm(rpiudll  licil( a2urxmpnu4oeen oeiyd s2rmu s;(4treoxo io1fmtrlu o s  2xrir nu4lm  mnct ( srtmxr no1oleoio3iatfa2um(mpnt4altrifciytfmDr ieo (  etm(r iudaltnlics s  rraxrpot4oltn f3tatlm rmn p t4 exrxo iatomDrlivi;t)seur(mpny1lpe mnvsa( s2raxm ot1aptoiictas a2rm(mon(0 exomr3tatomDe nei s  rurxr no4amtnlfctasf 2tr(moou0ale ifetysla2eanmon()arxnioctadlaDran sl()s2to(mpoo4om nmfvsa()a2rrxmonu4tltn o3iysfm rlnvo;u0arerircoadfm rlivs t) rtr(m ny4omt  ici tfsDur( poo1apx ifeiytla em( pnt0tlermr ty1fmDranvs;t)t2umir3oodlpe lfcslt srrruroot1alt mf3iyd s eluvon() eeoif to1fpDelnvs s0seur(mpiydoptemicsat)aDra(  nu4tle  o3tlsla2uan o ()arxomf todoatr neo;t)s2xr(o iudame mfeta(fa2tax poo0aeeomf3tytfa2emn o t0arenxr3todop  lneols0t2xoiopou4ale  nvil()s2rr(  nt4tle  ociyt aDrluvp () exnxf todop ean o (  2um(opiy1altemnesa( srua( oou4olxnif3iasfs2eanvp;t0aexnmf io1fmtran ol(0s2uoiopio1lme  fvsatfs2urxrooo0alx mfciydfs2elu sn() eermo oadoatraivsl(0srurimpiudlle  ivtls s2trx  ;o0aet iieiatfs2emn o;u)tlxomo3oa1fm  lu s t0srxm(opoudoptemfcs tfs2tr(mp;o4openmoetlt s2em( o u4tltnxf3oytfa rln il(0setrim ou1ope lfvi sf rrrur ;o1oleo f3iadls ean pn()aeeoifcoy1fmte ies (0s2urxopny4lle  fvt sfsrum( ono1tptnifciltls2rlnvpnt0 rtnifctatfmt  ies;s)setrxo io4op e nvslsf rrmxr ot0olxo ietydfmDem(mpnu) rxnirctadfa r nvs s0 etrxr3iydom elicil(f 2tm( oou0opeomietadfsDra(mp;(0texnifctatlm rauvi;()texr(r3oy1op elnvia( sruauro;t0tleoiociys mDrluvpn() rtrmo ia1lpt ln s s) rum(r3oudlpe lnes s)s2rmur ;u0tpe mo3tatls2el( p t4 reoircty1lm  li slt  2uo(o3oo4ll nmfci tf Drmxront1oexo fctydfa2eanmp (0 etrxr io1fpteliei;()seuoxopny1om e ics t sDuaxmoot1aptnif3tadfmDem(vs (0texnmoctydfaDeln s t) exo(o3iydap   nvias  Drrxrooo0optnmfctldlm2uluvs;u) lxrxociy1fp eaueil() 2tmirpoo4lpe miet t) rrm( poo1alxo i3iyd m2ulnvo u4teeomo oa1fpDelnvs s trxo(m ny4lle lnvslsfsDta(r ot0oetn fciyd mDrlnvs;u)teenio iadoptranvi t)s2xoxm3nu4amtelicsa(f 2tmxrp;t4tlxnif3iydlm2eanms;(4tlxoio iytopD ln i (0 rtoxmpno4omeemfct s)s2umx ono4texnmociasfm rmn snt4artrxr oytoptelu s;()trtoir3oo4omenlfvtat) 2ra(rpot0texo i3iatfa ulump u) exrmf3oodlmDrln s;() 2xr(m3iu1apenmfvilt)arrrx  ;o4olto fetasfm ea( s;u)artrxr io1opt  nvs t) 2uo(o nu4aleelfvtatf 2trx ono4tltnmf3ildlm2rl( p;u4aexrxfcoo1om  luvils)s2tmxo iu1altemfct sfsDta(rp;u4oexo ociat sDrmu p;u0tltrio3iytfpDranvi ()srxrir3ou4am nlfeta()s2rr(  nt0aptnmi3iydfaDemums t0arxomo3iy1oaDeau ilt) rtmxmpoo1altn ncilt)aDuau  ;t4open f3tldlsDrm(msnu0 etomo tytfp eluvi ( s2uriopnudlme  ivtat)s2urxronu0oleomi3ildfmDumnmo;() eeriociadomDr nvs;( srto(rpio1llee ncils aDrmur nt1aexn oetadfm2rl( o;u4tlxomrciydlpDrlies (0t2uoimpoo4opte nvsls) 2umxronu0alxoio3ildfmDelums u4 etnmo3ta1lm ran o;()texmxo3oo1al  mnvsat)artm(mo;u4apxomocias m2ean snu)alxrifctatoatr nei;t0setoimpoydam  mneiltf rtaumo;u0tee mociyslsDulnvpn(4trenio3ty1fpte ieolt  etm(o ou1lpe mfei (fs2rr(  nu1oltoioeiasfsDea(vpnt0 rerxociydlmDeaneils)trxm(o3no4lpt  nct t arumxm nt1apxoif3tlsfm eauvo t0trtnxo3iodlmteauvo;(0 rtr(r3iudope lnci t)a2tr(ro;t1alxnmictatlm2um(vpnt4alerircoy1laDe ieilt0 rur(o3ny1al e nei t)arua(rpoo1ale  feiadfs ul( p;u0areoxo oadfp rauvsl(0seurio nu1amt miet s arumum nu1tpt ifeias s uan o u)tlerxociatfa eai ols)srxo(m oo4ameelfesat sDtmumpno4apen ociydlm emnmpnt4tleomf3oytoa   n i;s)trxrxrpiodamtnmnci t)srtrxm ;u4optomfctasfmDel( s;t0altoir3oydlmtelu s t  2xoxo oy1openliesls  2trur ;t4opx mo3iadlsDrm(ms;u)tlermr io1lpDranvs;(0teum(m3no1optemnesls s2trxrpou4apto fciysfaDel(vo (4altrxr3oa1om   u s ()trxmxm3nu1ll elfetas  rrmx  ot0oetoifeiad s2eln s t0alenmf3tatla eaivi;t)trxrxr io1apt  fcil(faDrr( p;t0altn feiytlmDul( o u) etnxfciadlpD aiesl( tetrxr3no1lpenlnctas)srrr(  oo1oltnmiciad sDemumo () etnxrctatlpt aieils)t2xoxrpiydap n feiltfa2rmxr oo4aet moctldfa2um(mo u0trtoxf3iy1la ranesls0 rum(r3nu1apt mfci (fa2rmx pnt4tlt moctltfs rlnvo (0 etomo tadfaD ln o () etmio3oo1lmenlicil()sDrm(mono4ale mictat aDrmuvs u)tleomf3ty1fp   nvi;t)trto(opno4lmte iet () rra( pnt0tee mo3tlslm rmnvp u4aexoio3todomteaneo (0srtriopnu1am  lfcsat) Dta(m ou0tpeomietyt s2elu o;()tlxnxo iotfa r uvsls0 rxmirpoydamt mivt s)arrmu o;o4opx ifeiyd s um(mpnt) lenmrcootlp e n ils t2uoxopoudlltelncia(fsDrauront1aeeo i3iysfmDelu onu4aetoxr3tadoaDelu i s  2ur(o3oo1ol emivt ( aDtaxmooo0aet moeiys m2rlumpn() rxoifctydomDr ieo;s0teurimpoudlptemiet s)sDrmur ot4tetoio3iysls ulnvs;(4alxnircty1fp eluvo;()srxrio3ou1lpeemnvt (fs2ur(m nt1apenmo3iydfa2umnmsnu4 exnmoctytla e ieolt)t2to(o oo1olt mieiltf rrmum ou0tle iociad aDrlnvo (4 ltrmrcoydomteln slt0trtoxm3oy1ale miviltfsDra( pnu0apeoif3iytfaDea(mo u0aetniocootomDrluvo;(0 2to(opno1llenlfvilt s2um(mo;o1tltomietyt a ean p;(4 exoifctotfm rauei s teumim oodlpeelnvtlt a2ur(r nu4texo fciydlmDul(vp u4 lxrmf3tytomDr nvo s sexo(o iodlm elfvilt)aDtrxm ou0opx moeiatls eaums u0arenif3oatopDrliei s) 2xmim3iodal nmies s  rum(rooo1oleomieiyd aDel(mp;()artrifcio1oa  lnvi t)srxm(m oy4ame lfctat) 2tmum ou4opto ociatfm2el(vsnu)tltoio oa1lmD aivi () eumim oo4ale lncilt s2trumpno4apeomoeiatfmDulumo;t0 ltnifcootfpD aies;t)trumiopiu1lmenmiet sfsrtm(mpot4oeeomi3ilsfsDrau ont4trtomf iodfp elnvsl(0 eurxo no1omenlfes s srta(m ;u1tptnmf3iydlaDemn pn(0areoxo3oatfp rliesls0 rxmio3iu1ol  lfcta()sDtrum no4aee iieildfmDuln s;(4 rerxo3oytopteln o s s2ur(o oo4lle  nvsl( artrxm nt1apx  ociat mDumuvont0 lxrif iodfpDeli s;s0 2trir io4oltn fviasf Dtmx pnt1oee  ociydlmDel(vs;(4 etnio3iodfpte n i s0srtoxr3no4lm   feias)aDra( o;u0optnmiciys s2ulnvp;() ltrifctydfmDr n sls) exoxm io1ome  ivslt  Drmurpot4ole ifeias a2rl(mpnu0tlxnif3oa1fmDr iei;()sexo(rpoy4am n fvs t)srrruro;t4oeenmfciytfm uanvo;u)aleoxrcty1oa  lneil(  2trim oo4ole lnvtl(farraxmo;t1aet iieiydlmDrlnvo t0aexrxo3oadfp eln s;s)srxrir ou1lle mnes () rrm( ooo4opxn i3tadla2rluvs;()alxoxr ta1fm  li olt) 2tm(o iu1ame lnct ()s2rmx p;u1tpenmieils mDul(vsnt4tetnmr ty1lpDe ieo;s srurim3iu4om   fctls a2tru p;t0tetnmociltfmDrmu on(0 leomo oodopt  ivslt0trxoxr3iu4lpt  ivt sfsDtmurp;o1texomfciysla rmuvs u)aeenxf tydfaDe nvi;s)s2urirpiu4amt mfctl(  Draxm ;o0oet  ietadlsDrm( ont4tlxrif iatla raieo;t0trxo(m oo1aleemnci tf 2urum no4ale micildfm2eanmo u4tetnircoy1omD  u s;s0seur(o iudopte fvs (fsrrmxr nu1alxo ieiys aDulnvs;u0teerifcta1lp eluvs;s0sruoim3oudalee ivi tf rtax pnu1alxniictatfm ea( s t4teeomr3oa1lm e ivsls0t2uoxr3iu1al eliciltfarum(mpnt0aleo i3ils s rau p;(4altomf3oadfmtrau olt  rto(mpnu1lmt  ncsat srrax  ot4oleo i3iaslaDrlnmp u)areomocta1lpt aiei s)truo(r oy1alen neiltfaDraxr ot0opxnmo3iysfmDum(vsnt)trtoif3ootoptrlueols)sruo(o oodomtn ivtas)srtm(roou1ape io3iys s el(vs (4trtrmf tytlaDe nvo;() 2to(rpnudllenmneta( aDrmx  ;t4tetniicild s ra(mp;(4arxrxfcto1lptrauvs;t)sexrxm3nodomt  fvtls)artmurpou4opxoiiciys aDuln s;t)alxnif iytom  anvols0 etrxrpiodaptemfcia() Dra(rpnu0tlx ifetadfa2rmn s t4 lxrmo3tadfate ieol() exmirpou4omtnmnvi s s2raum ;t1oee if3iad aDrmnmsnu4aeerifciadomt luei t)texoxo iy4aleemictl()a2rrumono0opeo i3iydla rl(ms t0tetoxf3iatfa elieolt s2xoiopio4om e ivils  2tmx poo0aexn fciasfm rln ont4 reomocoytomte n ilt) 2umio iydam nmfvsa()arra(  no0olt mietysfa2uan on(0altrir3oa1lm rlieo;t0teumxr oy4om nlictltf Drrur no0alxn iciysfmDumu snu4tetoir3oodop  ln slt)sexm(o ny1omtemfvi t)srum(  ;t1oeenifctydfm2el( ont4 lerifcoatlmDr i sls t2uo(r ou4lpeemfcsls) 2ua(r nu0tpxnmocildlmDeanmo;u0 rtoirciy1laDr n ils) rxmxm3nu1lme  ivia(f 2trx  ;o1tex if3iyt s ul(von(0arxrif3iydomDr ivo s0t2xr(o iodlltnmics s)arurur ;t1tlt io3iltls2emn p t0aetrxocoatoa eai o t sexrim3io1lltn fvta( aDta(ro;u0aeeoiociad a em(vpnu)treoio tatop eluei;( srxoim3ny1am  mfviat s2rr(mpoo4apeoifciydfsDel( o;t4 exoxocia1opt  ies t t2xrxmpoo1lmtemnct sf 2tru  ;t1oeen ocils a ra( p;u0arxrxr3oydla  auvolt)texmxm ny4am emfcta()s2uau  ;o0open oeiasfa eln s;t) rxnio oodoaDranvs;(0trtoxo iy4lmtnlfvtatfa2rr(rpno1aex  o3iydlmDrluvs ()aetrxoctotlp rli o ()teumiopoudopt mieia(faDrrumpno0tle  o3ilsla2ra(mont0artrio tytfpDrlnvo (0t2trxrpno4lpen fcias) 2tm(m ot4oeeoii3tytlsDeanvp;(0artrmrctytfp e ivs;s seuoxopnodlp elivi s)srumx pno4apenmociatla2ua(vsn(0teeomf totomD aivols) euoir3nydolt mnvtls)srrmum nu1teen feiadfa2rau o;t) rtrif iadoptrauvo;s t2tmxm3oo1apenmnei t)a2umurpno4oltn feils aDua(vo (0 ltrxr3oy1oateauvs;s t2to(opou1olt livi s srtrxr ;t0oexn ictaslm2uanvp;t0 lxrifcoa1laD aiesls trurxo3ny4ome liei s)a2tm( poo4olxoiiciysfm um(mont4 lenir ia1omD auvi;()t2toim3nu1amt  nciat srum( o;o0oexnmfetadfa2ul(vpnu4tltoxocoadlm rln i;t0 rtoxm io4oltn nei t) Dua( ono1tpx iictysfm rau o t4tlxrmr ootoatrlnvi t t2xoimpno4optnlnvi t sDuaum nu1ole iieiatlmDra(ms;() exrio3tadlmD lueols) 2xrxm iy4apenlicsat artrxmp;u4apenii3iatfm2rmu o (4areoio oy1fpDraiei;t) rxrim no4lpenmnvilt)sDtaumono0olto fetls a elnmon()aleoifciydomtraivo s)trxmxmpoodap n fet ( sruau onu1olx moeiadfsDeluvp;u0altrxr totfmtran ols s2tm(o oodalenmiei sfs2ta(monu0apto f3ilt s2ul(mon(4artoxrcoodomteau ils sexrirpiudap  mnes t  Dra( poo1tex  f3iad m umump (0tlermfciotfaDeli i s) 2trio nudlm elfetasf Drm(rp;u0aleomoctadlaDraump (0arermrciodoptr ieols sexoxm3oo4ol n iet s  Drax onu4oexnio3tlt s eau s;u0altrxfciotfp   ivsl( s2to(o iu4op  miei (  2uax pot0opto ocilsla2umumo t)arxnir3ootlmDrau o;( texoxopiy1amt  nei tfaDrmxroou4aptnif3iad a2rmumo u)teermo iydlmD  ivo;t  rxr(r3oy4altemicils s2trxm ou1alxomf3ils s rauvo;u0 etnxoctotfmDrli s;t)sexr(r3no1apeemiet (faDua( oou0oee  i3ildfa2ul(vs;t)areomrcty1fmtr i sls)trur(mpoo4ap elncs () Duaxronu4tex micildfs2rlu snt)tetrmo tatfa eln o;(0tetr(o oo4lle mfvias) 2uaxro;o0optoifetas m emnms u) rtnifciotfm  aieilt)t2xr(opnu4ol emnvtatf ruaur ;o4alx mieiatfsDeanvp t)tlxrmr3io1lm  luvils sexoirpno1lm nmneil(  2rrxm ou0opt mfetas s umumpn() renmf3oydfm e ivs (0t2toio3nu4llee ivia(  2taum nu4opxomoeiltla em(mo;u0 rtrmo3iodlmD  ies t)s2xoxm io1lmt mivi ( aDurumpno4aee  i3iltfa uan p u)alxrif iy1lpDrauei s)s2tmxopno4lm nmieiltfsrur( oou4aptnmfeiydfaDemumsnu0aetrifciytlmD  ues;s sexr(mpoydolee ivs t  2rax ooo0aex mfcilsla ra(vs;()texrmfciytlaDelivolt0sexm(mpoy4lpen iesa(  2ta(r no1opt ioeiytfs eauvpnt)trenif oydlmDrli sls  2umio iodaptelnviat)srtaxr nu1aleomoeiytfs2rlnvsnu0 rtrxo3iytfp   i sls0 2urim3iudome lncils)arraur ou4altomi3iltfsDem(mo ()tltrio3to1laDeln sls)s2uoim nu1ap n fvtat a2tmxm nu1oetnmf3tltfa ra( snu0trtnxfciatfpteau s;t t2xrio oy4ap nmnetl()arrrxr ;u4opxnmo3tytfs2ea( s;u)arxnif oydoa elneil() 2xmxm3nodlme  nes (fsrrm(rp;u1tptomoeiyd m elnmsnt)tltnmo tatfaDrlu s ()t2umxrpiudopt lici s  2taxmpot4tleomictld mDul(vo;(4alxrio3iodfm   ivo ( trtrxmpio4altn ivslt srtaxr ;t1altomf3tatlmDulnvonu)aexnmf3oatfmDe uesl( teurxr nudolt lnvta() Dua(rpot0aptomo3tydlm umump u4trxnir oa1optrluvo;t0sexo(m3iudll elncsa(  Dur(rp;o1tpxoifciasfa um(mp ()tlerir3io1oa rli il()t2toiopiydaltemicilt)srrrumonu4opt mi3iysfs2uan o;(0 etnif3oa1om rln i;(0teur(o ou1om e nctlsf rra( pno4aee  ociyt m2ulumonu)tetomf todomt aneo t)s2trim io1llen icilsfa2rau pno4opt ii3tydls um( snu4alxoio3iadom ran ol(0srumir3oudopt  netl() 2trx pou4oleomfciytlm ea( o;u0 exrxr3tadlat  neol(0srxoiopnydal elfcslsfarum( pnu1oetn f3tadlmDrlnmsnu4 lxnif3iy1lmteanvo;t) 2uoxopiu1opt mfeils) Dtmu pno4tpenmieilsla2uauvsnu)tleomr ta1faD lneo s) 2trxm ny1ol  mivtatfaDta(rono4aetn i3ils aDua(vpnt4 lxomf tatlpDelneo s)srxr(o iu4oltelfviatfsrtm(rono4oex  ieiydls el(mp;u4aetrio3oodla r neo s0t2xoio oy4al nmieia(fs2tm( o;o4apeoifciysla emuvo u4 eeoio3oo1laDrai o ()trurir ny1ome  fcilt a2ra(  ;t4alxn i3iatfmDum( s;u0trermfciatopt livo;()s2toirpnu4llenlfeils)a2raxr ;u4aleomoetyt a2umnmont4 rxnmo tadlmD lues;s0t2xr(m3nu1llte fvsls)arurxronu0opxn icils s uaumont0arerxr3oatomDeanei s srxoio3oy1op  lncil(  2urum no0aex  octysfm rl(mo;u0 rerif3iadfaDelneils) rto(rpiodalt mfcia(fsrrrxmo;o1apx  oeiatlmDeauvsn()areoio3ia1lpD aivslt) 2xoirpoy1omeelicia( aDtau pot1apt  oeiydfmDemuvpnt4trxrxr ty1fpte ieil()s2tmxm iu1al  lnctas)sruau oou0opeoii3tldfaDuaums;u0 ltnir iydlmD ai ol(0trtm(o iy1amee iesls  rtaurpnu0olto o3iytlm2rl(vp u)aeenirctotfm r nei t0srtoir iu4lmeemicsas a2umxmp;u4altnii3tlsla2ea(vo u)altoxo tytfat  nei s t2tm(o3iu4alenlfvtlt)arrru o;o4alx  fetlsfs2rlums;(4texoio io1fmDrln ol(0s2tm(opiydlp  licilt) rumxmont0tpxoii3iadlsDuaumsn(0 rtnif3totomtrluvs s0 rtoim3ou4amtnmncslt) 2tau  nu4aptomfeildlmDelnvs t4tltrmr oadfmDr ieol() 2urirpnu4lleemict sfartmxr ou4optomf3ilt aDean p u) exoirciatlmte nvs ( t2uoxopiudlpe lnci tfa2umxroou4tpxo fetytlmDranms ()teenmrcoodop raivs;s)texm(r3nodalenmivta(  rtaurp;o1tet  oetadfaDrluvo;t4trenxr3iodfptr nes ( s2trio3oy1lp nmfetl(  2ta(m nt4oltoioetlsfm2uanms (4trtoiocoodomtr i ilt  2xoim iydaltelicil(fsDtrx p;u1aetomictld mDeauvo t0 exoif oodfateai o ()t2xoxopoydol  lietl(f ruax o;t4oex mietld m ua( p t4areriocootomD  n i;t0s2xrxmpiodlme  fctat arrrur ;u0aexnmoeiysfm2emnmpnu0 leomo iotomD  uvols)teuoxmpio4lmte ivil(faDuru onu1oet iieias a ra(ms;(4 lxoio tatla elneol()trurimpnu1ameelncsls aDum(m ot0apen o3tasla2rmumo u) rtoxf oa1fatr n s;t) eumir oydalee fei t)s2ururoou4alenmf3iysfa2uanvo;t) lxrmr oo1la eauvs t) 2to(m3iu4lle lietlt) Drrump;t1aexn fcild s2rmuvpnt0trtrmo ta1omD au o t teumir3iudolen fesas  rtmumpou4tptnmociltlaDem(vpnt)tlerif3oadomDelnei;s0trxrxrpnudom elfvia() rua(r nu0olxnii3ild s2elu snu4tltrmfctydlm rlivol(0srxmxm3io1ll emfvtat) Drm(  nu0teeo i3ils m2ulnms;u0 lenxfctytop e uei;( srxr(opou1lpe  neia( aDtrum oo1tee  ieiydfm2ea(vs;t4tetrxr iodoat an i;s0 exoimpiydamee ictlsfs2tax pnu0opto feias s2ra( pn(0alenxo3totfat anesl(  2urxrpou1lpenmncslt) rrru  ;u0olen f3iyd s2ul(mp;t0arenxociotomt  ivo s0 ruo(opoy4amtelieil( srtrx p;t1tleomfeilt m rm(vp t0aetnxf3oy1optrau s;t  rxmxmpou1ope mnetl() Dum(m oo0teen ietadlaDuauvpnt0 rtoir oadlm r nvs t s2urxo no4ll nmietlt srurxr nu0opto ieias m2emumsnu4arxnio3oytoptelnei s)trtm(r ou1am e ivsls arum(m ;u0tpen ietytfa rln o;t0 lxnmf3iatfa  an ils0t2tmxmpno4am nmnvslt a2um(roou1oee io3iysls2rmnms;()tltrmr iytlp r ueolt s2uoio oy1oltemicsat sDta( onu0ale if3tltlm ran snu4trxomo3iy1oatelu o;s0trxrxmpiu1ome mncil( s2rmx onu0tpxomoctyd sDraump t) lerir3oodfa  li o;(0srtrio no4al e ncsltf rur( ont4openmictldla2elu pnu) lerxr oatfp   i il(0srur(o nu4lm emfeilt)sDurur ou1ope iiciadfm2em(vsnu0tlxrxoctatlmDraueilt s2urimpiu4lm  mncsls aDraxr nt1olenifeilt aDrmump;t0texnmf iytoaDelivi;s0t2um(o no4ap   netl(fsrrmxmo;o1optomictatlm ra(vs t0alxomfctotfm rli s t s2xrirpnodllte ivslt a2uaxr oo1aex iocils sDrlumsnu0 rtnxf tydlm  li i;t0sexmxrpiy1ope  iesas)arra(mo;t1aetniieils mDeln s;u4artrifcoo1fmD  ivsls0srumxr nudaltn ivtlt)aDraxmont4oex  o3tldlm elu p t4tltoxo3ootlaD  nvi;s t2umio nydomeelnesl( sDrm(ro;t4aexn o3tld mDrln p (0tlermoctytopDeluei ()teuoxr3ny4omenmfeils a2tmurono4tetnif3iytlm eaumsn()tlxrio3oadfaDrlivi;t)s2trim3oy4op nmict s)srra(rp;t1oex ii3iydlsDrm(msnt)aeeoxrcoatfm eai o;(0texmxopno1aptnmici (fsDra(  no4optniicildlm2em(ms u)arxnxf3oy1omtrau olt)t2ur(mpoo4om emict t a2tru  ;o4tptoiociad a2rlu s;u)texnmo tatlp  luvs;t0sexoim3iu1oltnmiesl()sDrr( pno1tpt mieiasfa rau p;(0aetnmf3todop  au il( tetoirpoy4al nmieiat)srrrxmp;u1aptnmo3iysls eluvpn(0teenmr3oo1lm elneils)sexoxo3iy1olt  feia(f rur(rp;t0apenmoeiyt s em(vs;(4 lenxrcia1fmDelnei s0trxrxm ou4ol  lnet ( a2rrur ot0oleo i3ils m eanvs (4artrmf iatfpte nvo s) euo(o ou4aleelfetl(faDuaxrp;o1aetomo3iad m2rl(mp () rtnxr3oodoptrlues t)t2xo(o3ny1lpenmfei (fs2tax  ;t1tlxomo3iadfs2ra( snu0teenio3iodoat  ueilt t2umxrpiu4lp elfvtlsf Dtmx  nt0apeo fciasfmDum( snu)aetoircootfat  n il()trxmir oo1op elnesat s2uaxmpno1tltnmiciadlsDulnvpnu)trtnmo oa1fp  au ol(0trxm(r3nudlmt livtat  rrrxrp;u4aet ii3ild m rl(vsnu4tlxnxo oo1fa  anvi;t)t2umim3oudomtemfct t artmuroot0tlxoifeiadlm2um( pnu0teenmo iodlm rau o;t t2toxo nu4lpt  fvil( sDum( o;o0opt  fctys s rauvpnt4trtriocoytlm  ai i t)seurio3iu4al  lfesatfs2urxm ;u4tpeoifetyd m2elnmsn()trenioctadopD ai s t)t2xoio ou1alt  nvt ( s2tr( pot4alxniicilt aDemu ont0teerir3tydom elnei;s) etoxrpoy4lltemieilt) rua(r oo1tetn ociyslmDelu s;u)artoxfctytop elnvo;t0setrxrpno4ap  livil(  Drax p;u4alxnmo3ias sDeaump t)aetoxf oy1oaDelnvo;( teum(r oudlpenmivtlt)s2uaurpno4oleomi3iys aDemnmont4alenioctatlmD luesls s2xoxm3iu1ll nmfcs t s2tmur nu1opto f3iydla2ra(vo;()tleomociytlm rlueilt)srto(r nu4llt  ivslt sDrr(r nt1ape  f3ilsfa uau s ()trxoxrciotfaDraies t) rxoio3iydom n netltf 2urur ot1apxnmictad a ul( s;()aleomfcia1lm ean i s0tetrxr ny4ale lfeils s2rr(rono1aexo i3tysfm2el( pn() lenxf3iodfat  ivs;t0 eurxo oodopteliesl(  Drm(mpou0oex mfciytfsDelnvpnu)arerio3totoaD livo t0s2xm(mpiy4ale mncil()a2raurp;u0tpeoioctlt mDuan o;()arerioctatlp r i slt sexrxrpiudamee ics s)sDrmurp;u0tltomf3iadlaDelnvonu) etrxf3ootfm  au s;() 2um(opio4ol   fvsls) 2taxrpnu0tlt  feiat sDrl( s ()alxrmr ia1lmtran s;s0 eurim oy1ameelnvtlt  Dtrx poo0ale  o3ilsfa2ul( s;() lerxr3io1oa rluvslt) etmxmpnodop  mfesl( srta(rpot0tle mi3ildfs2emu s;t0arermocoatfpDelues s) etoxopoudap nlfvia( artm(r nt1alenifciasfm2uauvp u4 rerxr3ty1opt  ieol() exr(mpiy1al emneil(fsruax ooo1oltn i3tatlaDelnmsn(0 ltoif3iytfatr ivo;()t2trxm iodape lfvslt  Dtauro;o4apeniieiadfm2eau pn()aexomrcootoateauvs;t0t2to(m3iy1optnliei ()s2tru pnu0apxo ietysfs em( p t4
\ No newline at end of file
@@ -0,0 +1 @@
+iei;s)trtm(o3oy1alte nvs s s2uaur nt0aleomoctydls rlnmsn(0tltrio3iydlptr n s (0 eurim3oydapeelncta(  rra(mooo0oltnmocilsfa ea(vsnt4 lxoif iytlp elnvols0 rurio3iudlmt micil(farrrurpnt0tptn i3iyslm rlums;t)texrio3tytlm  anvi;(  euoim iy4ll nmfvs t)srrm(  ou4tlxnifetltla emumont)trenmo3ia1lpDranvs;s)t2uoim nu4amenlicsl(f 2taxrpno4tlx  i3ias s ulumo u4tltoxociotfat  n i s)tetrxr3oo1optnmfeslt  2ur(r ;o0tle moetyd s el(vp;t) rxrxf iatlmDrlneo ()srtoimpio4lmee nvsls s2tm(moot0aeenmociydfsDrl( p;(4tltrif todfatrluvols0trxmio3oy1omenlnctl(  2rmu o;o1oetniociasfm2ran sn(4trtrmfctytfpt  iei;s0trur(mpoudopeemfcias a2ua(m ;u0apt  iciltlsDrmums u0trtrircoadfa   u s;s0s2xo(r3ou4lptn ivi (  rrm(mpot4tptomo3iyd mDea(vs;u)aetoxo oo1lpteln i s)trxmxr3oy1omeelfvsas)sDtruro;u0apt mietys m2ra(ms;(0 lxrir ta1op eluei;()t2xrir nydol nmnvsa(fs2rru  nt1tee mf3tltls emumsnt0altnxo oadfptrauvs;t  rtr(rpoy4op nmicia( a2rmumooo4texomi3iytlm2um(vs u0aeerxr3todlaD lu il( sexo(m3ny4omt licias aruru p;t4tpxnio3ilsfa eluvsnu4texnmr3oytfaDrliei s srxr(o3oodlmtnmnciatf rtax  no0tptnmfetysfs2rm( onu) etoir3iytlaD aivils srxrxo3oudopen ieslt)aDtmurp;o1altnifciyt m uan s u)aeeomrciatom elnvol( setmio no4omeelnvtl(  2ua(m ot1oltn ociyt s2rau o;t) lenxo tatfmDrli sl(0 rtmio3no1lmt lnvt tfs2trx  ou4apt iociyslm emn sn(4teenxrciy1fa  an o;t trtmirpiodamt lieils s2taurpou4aeenmfctyt m2em(mpnu4tltoxrciodlmDrluvo;s0s2umxr oy1ap elfvsat sDumxronu4opt  i3ilsfs2ua(mo () reoio3oytoa eaueolt)s2urio3iydop  lfvi s  rur( ont1opeo feiyd aDrauvo;t4tetrxf iadfmD  uvo;( setrxr3ny4om nmics () Drrur nu1apeo i3iadfs ul(mo;(0 ltnxf3ta1lp  aneils)trurir iodomee icslt aruaxrpnt4tleo oetas mDumn on(0tlenmrctydfateli sl(0tetrxmpnu1op nmnesls)sDtaxro;t4alt  o3tadls em(vp;(0trxrmf iydlp r ieo s t2uoio3iu4aptelictl() Dumur ;o1apx mi3iytfs uluvsnu) eerxr3tadfpDelivi;t)tetmxopnodopeelicil()a2rr( onu0oeeoioctlsla rl(von()arxoiociytom r nes;(0srxrxm3nu1lltn fct ( a2umx pou1oltnmiciadfaDrluvsn(4 eeomfcty1omtrluvs;t0s2tm(mpio1ol emnvsat  rrax onu4olt moctlsfa rmn s;u4arenir todlm ranes;s trxo(r3nu1amtelivil()aDrm(rpno0apenio3iyslsDea( p u0 exomrcoa1oaDeaivi;s0 exoxo3ny4olt  iei ()a2raurp;t4oltn ictldfs2uln pnt4tlenio3oodlpDe uvs t tetmir3ny1ape  iesas)sDtruro;o1aetn o3iydla uluvont4 reoxf3ia1fm  luei;s  rxrim3ny1lptelfcia()s2raurpnt0tpx  f3tyd a eau on(0 exomf3iytfm r neil( t2xrxopiy4lptnlnvs t) ruaxr ot4alx  ocilsla um(vs t0 rtrif ootlp e ues (0texmirpiydop nlfetat) Dtm( o;u0alt mf3ilsfm2rln s;u0artrmf oadlp ran s s s2tr(m3oodam nlfvtls  rtau pnu1oexoifcias m ua(mp;u4 renmoctatlmt  ivsl(0srurxr iy1optn nvtat) Dtmx pnt4tpxn f3tadlm2eanvsnt4aetomo3oytfa r uei t s2xmim io4ameelietas artmx  oo0opeomi3tatlm2el(mp (0artoio3totlptrluvo;t sexmxopny1al emfei ( aDuau  nu0alt mieiltlsDranmp t) lxoxrctydoatr nes;( t2uo(rpou1amenliesatfsDur(rpou0tex moetltlmDrauvon(0alxrxr iatfmDr ivs () etrxm iu4ol  lnvilsfsDtrx  ;t0ape  octadlm2rlu sn(0tetnmf oatfa elues;(0 eurim3iy1ol   fvtlsfa2tm(mpou1aetomfctlslm umuvp t0trtnio3tadomDranei ( sexmio3no4ap e ivi ( a2ur( p;t4tpe mieiys m2ua( o u4aexrifciytfateai ilt  2uoir3iudap e fvsls s2rm(roou1alenmo3iltlm2rlu o;t0tltnxf oydfaDrln sls) 2uo(r ny1aptn icia() Dur(rp;u0aptnioeias sDrmuvo ()tetnifcta1fm   n i s) rurxo ou1ame lfvs sfsDtmxrooo0teeomo3ilsfm2umnvsnt0 eenmf todlaDrauvi;t) etmirpou4amen fctl(fartaumo;u1tltn ociatfs umuvs;(4 rtoxf oytfat li sls texrir3ny1ope mici s sDtmxrp;o0aeenio3ias mDeanvo (0 lxrmf3oadlatelu o;t tetr(opny4ll   fvia() rraum ot1apx ioctldla2rm(mp;(4 ltoxfcty1lpt lu s (0s2to(o nodlm   net t)srrrx o;t1aleoiicils sDrlu ont4texrio3to1oat anvs;t)s2urirpiudal emncsatf 2um( ooo0tltnmictas s2rlnmo;t0 renircia1fptr iei;(  rtmim3io4om nlfeil( arraxronu0alto ictldfm2rmumon(4alermrcoydoptraiei t)sexrxmpoodomt mictlt)sDrmxm ;t0tpenmiciat s uanvo;t0 ltoxo3oydfpDrluvo s0 etmir ny1ol emfvs (faDurx pno1opt  ociadfaDul(mpnu) lenifctotfmtelues ( t2tmxm iu4lp   ivsltf rurumo;t0tpxoif3iytfa uaump;(4arenxo3iodomD lnvo t sexrim3nodamtemivil()a2rrxmooo1apx iietldlm2rau pn(4tlxnmr3io1oat au i t setmimpnu1amtelnesa() 2tm(  ;t1alxo o3ilsfm2elumpnu) exomfciydopt  uvs s srtrxmpny4ale  ietls srtaumoou1opeoio3ildfmDra(ms u0tlxrxr totoa  au i;t0s2xo(r no4om  mfet ()srrrx pnt0aet iocilsfm umnmo t4artnioctodfmte ivil() exm(o oydap elici tfaruaxroou4tpeo i3ilt m ranms;(0altnifciytla  liei t texoimpnydlm n nct s  rrmumpou4tlxomf3ildfa ulnms;u)trxrmr3oy1oatrlneolt0 rxoxm3ou4lm elnvias s2tmx pou1opx moeilt sDem(vp;u4 etoio3oadla rauvolt  rxr(o iydol elnct tf 2ra( p;t1olxomietltfm2umnmsnt0texnmf3tatopt au ilt0 eumxmpoy1ole lics tf rtrxmo;o4oee mieiadfm2ea(vo;u0 ltriociadoat aivo;s) 2xrxr iy1olen iciasfs2rm(rpnu0opxnio3iysla rl( p;()altniocto1oat lueo;(0 2xoirpiy1op emfvta(farum( pou1aptoiietat m rm(monu4treoir3tydlmD anei (0sexo(mpno1lp emnetat)a2tmurp;u1tpxnmf3iadfmDumn o u)aexniocoytopteluei;t0sexoxmpio4lmenlfesls) 2raxr ;o0openiociyd a emnvo t4tetrir iodlmDraiei () euo(opou4om   fvta()a2rauronu4aetomo3iydfs rluvs t4alxrir tatlaDeanvsls) euoxr iydom   ieil()a2ta(m no1ale io3iytfm2elu s u0arxoir3iy1opD luvo s trumir oo4lmen net s srtrxmoot1olen ocildfm2ean snu4 leoxf iotfmD lueo;() ruoxrpnodap elieta() Dum(moou4opxo o3ild a2rmu s;u0 eenir3tatfaD aiei;t)t2tmxmpoy4lmtnmfci t s2ur(mont0tle ii3iysls2eauvsn(0tltoxociy1la r nvs s0sruoiopnu4openlfcs tfarta(m nt0teeo f3iadls2em(vp;t4teenir3todlateluvi s teto(m3iu1olt mneilt)s2ur(  oo4apxomieilsla2rm(vonu0 lenxf3iadfa eanvi t) rto(o3oodll n icta()sDum(rooo4tpxoifetldlaDuaumo;u4 leoir ia1faD ln il( seumxopiu1omeemnvta( aDua( p;o4aex ioeiaslsDrluvp u) lxoifctytoa  anvols) 2tmim3nodop n nci s) 2rax oou0oexnmi3tydlm2rm(vo u)alxnmr oo1lmD ln o;t0 2xmir no1ome lfeils arumxmoou1oet ifciat aDea(vs;(4 etrir3oatlp eai o;t setm(rpno4openmiesltf Drm(ro;u1alt  f3ils a um(vs u0texrif oodopDe u s;() 2xmxr ny1olt lnvil( aDta(moot1tpeomo3tatfmDuau p;(0alenmr ia1fpDrlu o;t  2umir3iy1ap emfvtls)a2umxr nu0altnmoctyd mDuan o;(4trtrio3to1oate u sls) eur(m oodomtemfetl()sDrmxmonu1oexn o3tas aDrluvsnu4altrio totlptr ivo (0seum(m3iodalenmietat  rtmxmonu1tlxnif3ils mDrl( o u) rxrxr oytfpDeluvi;t)trumxr3oo1ome mnvs (f 2tmxmpot0tleoio3iys mDra( p u0tetnxfciydlpDeai ils)t2uoir3iy4alt mfctatfs2taxmono1opx mieiltla2emnmpnu4 eeoxoctadlmD livo () exr(rpnudome lfvias srrm(r ot0oee  ietydla2rlumonu0arxomf3iytfptrai o s truoim oy4ol elfviat aDrm(rpno0oeeomfeiytls ulnmo u0aexoxr iy1lm r nvi t  rtriopoy1omee icsatf Drmxmo;u1tetomfctat s eln pnt0 etrmrcia1omt  iei (0t2trimpnu1llenmnctl(f Drm( poo0oeeoioetatfa rl(vs (4 ltrio totfatrauvi t)t2xr(mpoo4lmen fvtlt) 2umxmo;t4aetn ociys sDrluvs;()trxrmf iydomteln i t  eum(r3oy4om nlfesltf Dtru p;o4tetnioeils s2rmuvo u)trtoxo3ta1lmD anvs;s texrxm3oydolenlicslt srurxmpou0oetniiciyslmDulu on(0tltoir3iytfaDrlu o;s0trxoirpou1alenmfci tfarua(r nt1texnif3iytfa2ulnmp;u) eeoiociotfmD an i;t)t2umir oodopeemfeiatfaruaxrono0apxomiciatfs2umuvo t0 lenifcto1lmt lieol(0 2xrim3ou4lmt mfvt (fa2ta( ono1ale  icils m2ea(msnu0tlenifcia1lptrlivi t)seumxm iodlle  ncil( arrax p;u4open o3ildlm2ea( p;() rxrmo ia1oa ranvs;s srurim3iudapeeliesltfs2rru  ;t1optn ociltlm2rlnmonu0teenif tydfptraiei;s0 rtmxopnu1lle micsas) Dra(ront0alt mietlt s2el(vp;(0trxrxfcio1lat  ivi;t0trurxrpoy4amtelfvt t)srrrx p;o4tlt iieiaslaDea(ms ()aetoxf3iotfmtr nvs;s0 2to(o ny4oltnlfciatfs2ua(mpot0tlto i3iasls ulumon()tlxoif tadfa   n i;( trtmir3oydap n ivsatfsrrr(rp;t0tet iiciyt m2umnmonu0tlenmrciy1lmD  ivi;() rtrxo iu1am emfctas  2rm(m ou4tpt moctys a2umumo;t)alxoxr3iatomDe u i (0 rurxr ou1lp  lnetlt)s2rmx pnu1aetnioetasfs2el( s;u4trxnxr ootlp ean o;s s2urimpnu4lmt mies t arra(mo;o0aet  octytfm rln p;(0arxrxo oydop e ies;s0 2toxr ny1ole mnvslt  Dta(roou4tpt mfeild s eanmont4trxomf iydop rau o;s)setm(opoy1lle lfvs (fsrtm(moot0olenmi3tasfs2rmnmp u)tleoxfciytlaDr u o t0t2um(mpoydlpt mnctasfsrua(ront4tpt mf3tadlm raums (0 etoif3to1omtrlu sl(  eumirpnu4ome  ici t  2rmu onu0aeenmoetysfm2rlnmonu0 ltrir3iytlmDelu o s  2trxo3io1apt mies s  Drrurp;u0alxnii3ias m2umnvpn() rtrxocta1laDe nes;t  rxrxmpiy1lp n ics t sruau  ;t1opxn fciatfs ulnvpnt) exoxr oodopte n ils s2xoim oo4amenmivtlt  2raxmp;o4olx mo3iad a ua( p (4 rxoxr ta1fpt  uvi t0 ruoirpio4omt livt sfsDuaur no1olxoiictadlm elumo u4 ltnxf3tatoateln ol()t2uoim3iydam emnct t)artrxr nt0tex if3iat mDel( snu4treomr3oy1lpDeauvils0t2toxopiy4ame miesas)arumurpnt1tptnmieiytls2emu s;t0 exnmr tadfaDr n il( teur(o3nu4ap nlicil( sDtmu pot0oex  oetldfm2eaumonu0aexomrcoodfmt lnes t0srtmxrpoo4alt  nvsls)arumx p;u0tpeo feiysfm2elump u4artrxr tatopDe i ols0 2xoxmpnodol  mnvi (f 2tm(rpot4tle  ictat sDemuvp t)aexomf3iotfmD anes;s s2toxrpoydlltn ivsat srrmxro;u0aet  fctasfm2emnvs;()aeermrcta1omDrln olt s2xo(m3io1lp emivsa(fsDra(m nu0olto ociys a elnmp;t0trxomf3ty1om r ivslt0t2ur(m3nu4llt lfcta()aDrrxrp;u0olx mieiytla rlnmpn(0 rxrxo iatlmt  i ilt0setrxr3iudllt mfct (fs2tr( pou0tlenmoetysls2rmuvsnu4texomo oy1fpD auvs s0texmxopiy1om  licias a2rmx o;u0oee  i3iys aDrmums;() etrmr oydoptr n sls)s2xrxr nodlptelnes (  2rmxmooo0opeoioctldlaDean o;u4 ltrxr iytlmD  nes;()teuo(r oo1al emnctas)sDra(moou0apeoifctyslm2um(vo;() lerir tydlm  ln il(0srxmim3nydope livsat)a2um(r no0alen o3tasls rlump t0arenir iy1fptranvo;s)texoir nydlmeemfcslt) rum(r oo4aeeo feiatlsDrl(vs;(4tlxrif tytoa  ai s;( trtmim ou4oltnliciat)s2ta(r nu1apt mf3tlt a2umnmsn(0alxnmfcto1fa eaivil(0 2umimpnu1apte ictatfsDrax  ot4tltn oeiad sDea(vpnu4arenxo io1om rli i;() ruoirpoudopenmfvsl(f rtmxmono4tle mo3ias mDrl(vs;u0altrxr oydlpteauvs (0 rtm(r oo4ol  lfetls  Dra( ono4tlenif3iasfm el(msnt) rtomf3oodfm  auvs;t0srtoxrpiodame mnesl( srua(r ;o4teeoiictysfsDrauvp;u0 exoxf io1oa e neo (0s2xoxr ou4amenlfcia( s2rax pou4apt  o3ilsfa rlnmo u0 etomfcta1fptraiesl()t2xrxopoodomtelneilsf Drm( poo4aex mf3tas m2eanmo;(0 reoxociadlmD ln s () 2uo(o oo1alenmfvtas)aDraxrpoo0teeomi3tydlm ranvp t4trxoxf oatfate u i ()s2xoiopiydalt  feia(farurxm no4aee io3tadlsDrm(mo u4trxoxrcto1omD  uvo;t seuo(m iodlmen ivil(f 2rmxrpou0tex mietatfs2emu pnt0 etoxrctadopDr n o t0trtr(mpio4opeemictat s2ta(rpou0opeoiociadfa2rauvp ()tlenmr3oo1fat  neo t0 etm(mpnu1amee iet tf 2ua(r nu4aleo oeiysfsDuanvo;u0artrmr3tydfp rlieslt0 rur(r3iydop  lfcsl()srurx  oo4tlxn fetas a2ra(vsn(0altnmo iodomteau s;t) 2uo(mpny1alte ivsl()aDrmxmpnu1tlenii3iasfs raumo ()artoiocoytfmt anes s)t2toxo oo1lmeemfvsat) rum( p;o4aetomo3iysfs2uanmpn(0trxrmoctytlm eaneil(  rto(mpoudome  neiat) rurumo;t0tlxnmieiydlm eaumo;t) ltnmr oadop e nvolt s2umirpou1op nmivt (  rurx pnt4tleo f3iadfa2uaumpnt4tetrir iy1oa  aueo;t0 2uo(r nodop nlfes () 2ur(r ;u0tltniocils s rmnvont0alerifciodlaD  ues () rxrio3oo1amte nvias)sruru onu4aeeomiciys a2rmnvs;u0tetrxrcoodfatrauvs ( srxmim3no1ole liet s  2tm( o;t4oex  octat mDrln s;t) rxrmr totlmte nes t)t2tmxm3nudamenlietlsf ruau pnt0tpeomociatlmDrm( snt4trxoxf iodla eli ils)teurirpio1lm nlivtl( a2ua(roou4ale miciys mDrm(mp;t)tetrxo iadlmDr ivs t tetmirpny1lmen nesa(faDraxront4aeto ietlsfaDranmpn(4trxrxf oa1oa elivs;t0trtrim3io4oltnmnesl()aDumx pno0tlxomoctydfs2emnmp;u4treoir3oatlat anei;t)srur(r ou1lmtnmnciasfa2umuro;u1apto f3ils mDeaumo u0 eerio ta1oaD anvils0 2toir nu4ol nlivt t s2ta( o;u1tlen icilsfm umuvpn(4texnir3to1fat lnvo t)trtm(o3iu1lmenlfesas a2uau  ou4olt iociatla rm( o;t0texrmf3oa1fptean s;s) eur(opou1lp eliei s  rur(mpnt1apxo fetatlmDrmnmo;()tleomr oa1la  lieslt)texrxrpno4ll elicia(fs2ta(m ;u4oet mo3ildfaDrl( pnt)arxoif3oodla ean i s) exrxo3nu1apt mfct (faDumu  no4tpx mi3iadlm rauvo u)arxomo3oytlmDelu sls t2tm(r3iy1al  mnvtlsfa2trxm ;o0tet  o3iadla2ean s (0tlxoio ta1laDr ueo;( t2xm(o3ny4lme  nes sf Dtrx pnt1olto iciatls ul(vo;t0trerircoatopD luvo;t0 2xoio3oo4lmen fetls aDrr(rpno1tpx  o3iasls2um(mon() eerio3io1lm  lueo;s0 rurxo ou1ole  ivil(farrmxrpot4ape  fetas sDel( o t0aetnmfcoydfaDrlivsls0 2to(o3ou4ll nmfctl( a2um(m nu1alxnmo3ild s2ra( p t4 leomo iodopDrln s;s  2xrio3no1oltemivs () Dra( p;o4optomoeils sDuaums;t)teeoxfctytlatelnvs s)t2tmiopny4ale lfcs s)arta( oot1alxnmfciysfa2rmnmpn(0aeenxf3todoptrliei s)s2tr(o iu4lptnmnvt () 2rax  no1tpe  fctad s emnms;u4alxomr iatfp rai i s s2to(m3oo1lmte neilt aDra(r ;u4aetomictldla el( sn()trtoxociytfm e u ils)teurxo nydal nmivsas) 2rr(r ;t4aptn iciad s2ulnmp u4tlenmocoodfpteaivol() 2um(o3iu1alt mietl()aDrax poo1oexnifctyd a elumo;t)arxnmr todlpDeai i (0 eumxo3oy4olte ies ()aDrr( onu1texoio3tatla um(vp;(0trtnir3ty1lm e ueo;(0s2umxo nydlm elnesl() 2umxronu0teeomo3iltlm2rmumo;t) eeomr3ta1omt  iei (0 rxm(rpny4lpeelfeilt aDua( p;u4openii3iytfa2eln p;t)trxnifcoy1oat  neo t0 rxmxr3oo1altelfct ()sDumuroot4tpxoiieiydfa2ul( snt0 eenmrcoatfat aivi;s trxrirpoy4lmeelieta(faruaum ;u1aetn o3iad m2emnmp ()teermr3totfmD li s s teumxm3nu1omenmfes sfa2uax ono0olen f3iltls2el(vs;t0 lenxo iy1oat lueils)t2tmxr3oo1apenmnvils)s2tax  no0tpxnif3ils aDeau p;t0aetnmo3ty1lp  lneo;() 2xrir iodamenliei t)a2rrumpoo1tptnmiciasfmDra(von(4trxnmo oatfatraieo (  rxr(r ny1amtnlict (faDrmx pot0alxn ocildla2uluvp (0tleomr iodomD  nvs s0seurimpny1altemfcilt a2ra(mpnt4tleomo3iydfsDea(vont4aeermf3tydomteauvs s0sexmiopiu1oleelnesl() rrmur ;o4oeeo ieiydlmDulumo u0trxnif3ia1lmDeauvi (  rto(m3iudop elfcilt)a2urxmooo4texnmieiaslmDeaumpn() renxfcoa1lat  nvsls)t2umxmpoodomen fcsas a2tm(r ;u0tlxomi3iatfm2rmnvp;u4texomo3ta1latranvil(0t2tm(o oudomtn fes ( s2rrxm ;u4oetnmo3iyt a rmuvsn(0 eerxoctatfm e n olt)setoxr3no4lltnlnvil( s2umx oot0tpt mi3ildfm uluvs t0 rerxo oa1fa   n o t)t2um(r no4optemnesl(fsDtaxronu1tpe if3iys sDum(vp u0arenmo3todop  aneo;s)s2umxm3nu1op nlfvs s sDururp;t4aeenif3iytlm rlnmpnu) ltnmr oodoa e ivs (0 exm(m iy1llenlncsat sDta(r oo0aeenioetyt m2elump t4 etrif3oadlaD  uesl() 2um(rpoy4lp emnetas  Draumpnu4alxn feiyslsDrln o u4teenircoydopt ai i;s0 2xoxr3nudomtn fvs s) Drax p;u4oeen ietlsfa2uln o u4trxoir oytoat aivo t) rxmxopnudlmenmfcs sfsrraxmo;u1tpe ioctlsfa uln p u0aetoxo iydoa rauvs;t0trxoxr oy1lm  mfctas sDra( pnt4apxn o3iltfs ua(mp t)alxoir3to1la e nes;s seum(o3no4lpen ieil(  rrmxrpno0oexn fcilt aDum(mpnu4texoxf3todfmD lu il( t2xoimpoydlpenlfvta(  2rmum ou1ale iictat mDuau s u4tetnmf3oy1om   ies;t0trtr(o ou4ome lfet s)sDtaurpou0aetn fetltfmDelumpnt4trtrio3ta1omteau o;t)t2xm(mpio1apenmivil( sDrm(  ;t0tptnif3tasfs ea( pn(4 etnmf io1faD an ils)t2xo(mpnodope lfvias  Dtrxr ;t0opx mfeilt mDul(von()texomr oo1opDeanei s)s2tmio oo1optemfes sf 2urumoot4tpx moctadfa eauvs;u4teenmrciy1om r uesl(  2ur(opiy1lm e fcs sfaDuaum ;u4alt iietldfs rl( s;() renmocty1fmtr uvi;()tetmxopiu1lpen nvtlsfsDumxr ;o4texnmf3iatfa um( sn()tlxrio3iotlp rlu s t0setoimpnodal e nciltfaruru p;t4altn fciyslm2uan s;t4 lenmf tytomDrln s () rtrir nudomt mncsa() rrau ont4olt mfciysfsDea(vp;(0 lxnir iydoaD  n ol( srxmxr3nu1oleemicia(fa2tauro;u0aetn ieiadlmDuln o;(0tetrmociotfa r ivo (0tetrimpiydolt mfvsa( s2tr(rpnu1tptnioetyt s2rluvo;u4tetoir iatomte neo s0s2xoimpou1omtemivi sf 2tax poo0tpxnmieild a2rmnvo () eerir oa1lpt  ueo ( trtmxr3no4apt lfcs () Durum no1apxnif3iltfaDumu ont)trxnxocia1fp rauvo t)teuoxo ou1am   icsat  Dtrx  ou4tetnifcilsfmDrmnmont4tetoif3oadlm e ieo s0t2xoxm iy4ope  nvt s  rta( onu0ope ifeiyd a2umuvpnu) rxnxo3oatfat aies;t tetmxopoodlmtnmivi s  rum(mpoo4aexo oeiyd s2rmnvp;t4 etnxf iodom   neo;t) etrio3iu1apen neta( srrruro;t1tpt mf3ilt m rl( s t0 rtrio oydlpDrli olt)s2trir3iydamtemnctat) Drru pou1aeeo ietas m2rl( on() exnif3oy1oaD  n s t sexmxrpnudlpt  fvils)aDumxmo;o1alt  fcias s2uanvs t4aexomocoatlm eln o;()sexo(r3no1lltnlnvta(f rumxrp;u4apx  icildla rln s;t0 exrxo iadoa  aueils)s2xm(m iudoptn icsas) ruaxr ;u1teto fctldfs emnvp t)trxoxf3oatlm  li s s) 2xm(mpoodoleemnvs s) Dra( oou0tlxo i3iasfsDemu s t4tlxrxr iydopteanvslt0sruoiopnydal  miesa(faDraxmpou0aexo ieiad a ulnvsnu)arxoxrctodlatrlu sl()trxoio iy4omeemivsas)sDrmxrpnu1olxnifciysfs2rm(mo;t4aetrir3oatfm   nvo;t  rxmxrpio1ap n nvtltfsDrr(  ou4oeenmfctatls rln p t4alenxr3iytfpD  n i t s2ur(r ou1oltn fvs t a2rmx o;o4tpx  ietldls2elump;u4teenmo oo1fmDeli s;s t2xr(rpio4amenlnet t) 2ta(r ;u4oeto icildlaDem( pnt4 lxoxr ootoatrlnvsl()s2toxrpno1lm nlnct sf rrr( o;t0oexomfciysfm2rmn ont) etnir3oo1lmD livols)srur(r nodam elnesa(faDumx p;t4altoii3tysfsDem(vo;(0artrif3iatomteauei;() rurir oy1oltelnei t a2rrxro;u0aexomfeiys aDranmsnt) lermr tadoat an o;t)s2umxrpiy1lptn ivtat)s2uax  ;o1ole  ieiytfmDemnvo;t) etrir3iy1oaDelues;(  2urxm3oudame lfvtl()sDra(rp;o0tpe mo3tysfaDeau pnt) lxomo3oodop rlneo;s s2trio3ny1lm emnvils)srurx ont1tetn feiad m2ra(ms;u)aetnmf oo1opD  iesls)t2xmim3nu4lpt lnes () Dua(rpnt0aex mo3tlsla2uauvs u0 etnmf tadfa  anvilt) etrir3iu4ap elictatfaDtaxm oo4teenioeiasla rmn ont4aeermrctadla rluvo s  etr(mpiy4opeelietls)arrau o;u4tpt if3tld a2umu on()aetoxf3oa1oa rluvo;t texoio iudol   nvilt)a2ua( ono0aptnmo3ildfa eau pnt) rxnmfctadfmDeli o s0srto(r3oy1al nmnvt ( a2uax pnu4texomo3tldfa emnvon(0 reoxrcta1la  auvs t0 rtriopiu1ol  lfctlt)sDrrx p;o0oetnio3tadfa2ua( o;u0altoirctydfp e n s ()t2um(o iy4olt miet s) rrm( p;t4oltoii3ias s emnvs u4tlxoirciy1lm rlieslt0srumxr nu4apt lnvia(  2raum ot0alxn iciat mDel(mo ()treomfcoydfatrlu o s0 2tmxo3nydlmtn feia()a2um( pnu0tee mf3ildfs2uanmo ()teerxf3iytlmt  i ilt t2xoxmpoydop emnctlsfaDurxro;t4tetn octys s2ulnmo t4 rxrmocootlpDean s;t) exrxrpnudlltnmnvi (  2ua(r no4tpen ieiadlmDrmuvs;(4aeerif3totfmtr nes t s2to(o iy1llte feias)arua(mpno4tlenioeilt mDrlumo (0 exomr3tatoatr ues;t0 etrxopnydlmeelfet t  Dtaumpoo1oltn oeiydfs eau o;u4 exrmr oatfm  ln olt s2uo(r oo1lm emncsl()s2tm(monu4opx ioeiasfaDean p u)alermrctytfmD  nvo;s)setrxr3iudome mivt s  rta(  nt0teenmoeiydlsDemnvp u4 exnmo iydfmte uei;(  rtoxr iodal  lneta(fa2tax pou4oexo f3tytla2rlumsn(0 rtnio iodfpD  ies;t)setm(o ny1amt mnvi t aDuau  nt0tpe mfeiadfm um( p;(0tltrxocoatlp e uvs s0s2tr(opoo1olen ieiat a2taxm ;t4apxniietld m2ulnmp;(4treomr3iydop r n o t0 2xoxopou4amtnlnvtlsf rrrx  no0tptn fetad sDelu p;(4alxnxocoo1opD  nvi;s0srto(r iodlmeelfcsl() rurum ou4apt moctlsfs ua(mo;(0 lxoxr3iodoaDeanvil(0 rurxopoodopt mfei ( arumx onu1tptniieilt m2elums;t0aeerirciatfp e n ilt0 2trxrpnudlmee ncias  2trxr ot1optnmo3iltlm ea(mon(0 leoxocio1fmDrauvils0srumirpiy1lmen ict t) Dtm(m nu0alenmieiytla rmuvs;t4tetoxo3ta1fmt lnvo s  rtr(m3no4apenmnetltfs2rr(monu4tetnioetyd aDuaumon(0tetnmr ty1lm  aivs s0trtmirpoodapee icia()s2umur oo1opxoiiciad s2el(von() lxoirciytlmD anvsl(0t2uoio oodoltemncs t)arrr(  oo0teto ieiadfs um(mp;t)trtoxocio1lmtrlieil(0tetoxmpio1alt  fcil()sDtm(mpnt1oexn o3iytfaDrlnmsn(0 ltoio tytlpte neslt  eurxo3iy1lmeemieias)s2tm( onu1olxoioeiad m2raumonu0 etrir ta1omD aivi;t)texoxo3ou1am nmics () rta(mooo4oleoifetasfaDelu o u0 lerxrcootlm ean s t)sexmxm iodllt  nci s aDrm(mp;t4ape  i3ils a eluvp t0tetomf tatfmD an s;t  2urxm3oo4lm  mnvia(f Durxrpno1tpe if3iytla2eanvpn(0tetoifcio1op elu sls) 2toxmpiudaltnlietlt)a2tmxmont1apeomieils a2emnmo;t0tetrxf3totom   ieil()trtoxm iodaptn fvs t)arraxm ot4alt ioeilsfm2rlnvo;() rtoircia1oa raueols s2uoimpny1om emfes tfa2rrxr ;u4apt  o3iaslmDranmont0altoif tydoateaueo;()srxo(r3io4ll e nei t sDrrum nt1open octydfaDeau p;() ltoxoctotlatrauvs s) rumxmpnodop elfet tfsrraumpno0aetniieilsfs um(mp;t4artriociatfa eauei (0 2trxo3ny1om n fcsa()s2rr( pou1alx  ietlsfm2ulump t0tetrmo tadla   nvils0tetoxm3oo1ap n fvslt s2tm(  ;u0oee  fctltlmDrluvp t0alenmo3iotfpt aivi;( teumir iy1am elfvt s)a2ururonu4olxoioctyd sDrlump (0trenifciytoa   uesls sexm(opiydlpeemnei sfsDrrxrp;t0altnmi3iad sDeluvpn() lxnxr3oytfa e ieo;s0s2tmim3iu4apenmfes t sDua(rpnt4apx io3iyt s2rmuvs;u0treoxo oatfmD auvs;() rtrirpio1ameelfcsa()a2rrxm ;u1aptomi3tytfm2elnvont0 rermocoydlp  lnesl()srxr(mpny1apeemfvias)sDtrump;t1oetnmfeiadfsDemumo;t4 lenio to1oateaieol(0 exo(r3io1lpte nctlsf Drmxm nt0tlxo icils s rm( p (0teerif3iy1fmDrlnvslt0s2urir3nudlpe lnei tfsDraxmont0tpeomf3tls m2rl(mo ()tltrio iotoaDe nvs;()s2toir3io4lpe lnetas)artrumo;u1oeeniieilsls2ean onu0trenxf ia1fpD  u il(0trumirpou4am emnvt ()aruax oou0aexn fetlt aDua(vp;() rxnxr3oa1oatr ieo;(0trum(o3nodlm nmneia(fartm(m ;t4altn i3ilsfs rln p;t4texomrcia1omDelnei ()sexoxr3nu1omt lfvs s s2rauroou0opxn oeils mDum(vp;u0 etniocoo1fm  ln i s) eum(mpiodol  lfvta(fsDtmum oo4aetniictytlm ea(ms;t4 exrio3tadlmDeai slt0t2uoxm3nu1amtn iviat) Dua(  ou4opxnifetydlaDrmumo;(0 renmo3iy1fatraivs;s  2ur(o3oy4lp nmieia( s2uru ooo1tptnmfciaslsDum(vpnu)texnmocto1oateaivs;s) etrxrpnu4lptnmfeslt srtm(rpnu0tlt mo3iasfaDumuvsnt) reomfcoadoaDelivsls  2tr(mpiy4alenmfcia()s2taxrpou4aetnmi3iat s2ra(mont) lxrmr3tytlat ln sl(0 etrxmpiu1op e nesat)s2rm(rono4ale iieilslm rau o u)trxoirctadopDeli s (0 euoxopio1lltemncils arrrxrpnt1olenmocias m2ua(vp;t0altnio3iydomt  ues t  exoxrpiu1oltn ieta( s2raxm nt4oeto fctlsls2umuvont0artrmo iy1opteln i t texr(opoy4ol nliesas)sDtmxmpoo1olt moeiydlm2eauvo;u4aetrxr3iotop e neolt0sexoxo ou1am elicsls) rumu  oo0apen octys sDuanvs t) ltrxr3oatfaDr nei (0 2xoirpoy1al   fet (fa2rmxm ;o1tltn ietaslm eaump;u0 lxnif3iodfatran s;t t2xrim oy4llt mfvtasfs2tmxrp;o0apto o3iyd sDemnmon()tlerio tytopDrlivo;s) exoxm3oudll elneiat s2ururpnt4apto ictasfa uau ont0trerio3iadfpt aneo s) eurxrpno1ap  lnvtlsfsDrmu pno0olenmociys s umnvo ()artrir3tadfpt  nvi;() etmio io1oltnlnvi (fa2rmur nu0oee  o3tasfmDeanvs;t0 etnmr oodom ranvolt) etoir oo1am elfeils  2rax  ;o1aptn oetat mDua( s (4 ltnirciotom r i o;( t2uo(o3no4apee ivs t sDrm(rpoo4alxo oetas mDrm(vs;(0arenifciotfpte neo t) rtmxmpiudalte nvia(fsrtrx  no0tlt mictltlm2el(vs t) rxoxoctytoaD ai ols0seuoxrpnu4aptemnei ( a2umu  nt0aexn ociysfs2um( o u4altoxo3to1oatrluei;s srxm(m oy4om emicilt)srtrxmoou1apt mf3ilsfm2eanms u4 rxrmr3tytlptelnes t0trto(m ny4omtelfvtat)s2umxmp;t4tpeomfciydfa rmnmo (4 ltrxfciy1opDranesl()seuo(m iu1oltnliet s)s2umur oo1olt moeiltfa2ran p;(0arenmocoydoa rlnes;( trurir3nydlleelnesat a2rm(ro;t1alt  fcias m2umums (4 lxoxfcio1laD livslt0t2tm(o3iu4omte iei s)aDraumono0tle mfeiyt a2rmnvp;(4tetrxr3tatfmD  uvo;s texr(r ny4altemncia(fsrtmx ono1ope  feildls2ra(vs t) ltrif oa1lpDrlnvo t)s2xm(rpiu1ale lfeilsfarururooo0aee  ietysfm umuvs;()arxnirctatomt  nei t0 2tmxo3iu4om n ivi t  rtrxm ot4apxnifciytlsDrlu pnu) eerxfcoadlp  lueolt0 etoir3nu4apenmfvtlt)s2uaxronu1aetnifeiydlaDemuvpn(0arenmo oy1oa eauvo s0teurimpiu4ap  mfetlt) 2ua(r no1teenmi3iad sDulu snu0 reoxo3oadopDr u s ()trtrirpnudome lncsls)a2rrxmont4oeeomf3tltfa2rm(ms;u0teerxf3io1om  lieo;t)trurio oudolt  fcta(fa2rrur ot1ale  octldlsDem(mo;u4 rerxocootomteaueil( trumxopiy1omeelivi t  2tm(r oo4aptnioeilt s2ua(vs;t0 rxoxrciodopDrlneo s) rxoimpiy1ap elnvslt sDtmx  no4ale ifeiytfsDrmnvp;t) rermfcto1oa  aieo;s0 exmio3iudllt mfetat  rurxmonu4aee ioctldfa2um(mp;u0 eeoir3iytfaDr nvs;t) 2urim3ny1lltn fei (f rumxmpnu1olt moeiytfs eanvo (4 lxrmf ta1oaDe ueo;() 2xm(m no4llt livilt) 2rr(m nu1apen octysfa2rlumo;t4altrmrciatopteaueols0 eumir3oudolenmnvslt sDtruronu0oeenmociydfm2eaums;t)tlenmf3oa1optrluvolt0t2tr(r3iydll  livtls a2ra(r ;u4tptnioeild a2ulnmp u4artrxr tydla  livo t srxrxr oy4lm  liciat) Duau  ot0teenmf3tas a2em(vsnt4 ltomf3iydlm rai ils0s2xoimpnu4al e icilt artaxmpnu1altn oetatfa2el( p u)tlxoio oodfpD lnvo;t  rtoxrpio1lmeemivi ()s2rau oot4ale iietydls2uln o (0aeeomo iadfa r n s;t0s2xrxr3oo1lpeelnvtatfsDtmu oou0tpxnmieiydfm rlnmon(4artrxo iotop rlieil( tetrxm3ou4ape  ivtas)srumumo;u4opxomfciys a2uaumo (0 eenmo3oo1fmtran o;s  2um(m oy1altnlfeslt arrr( o;t0altoifciat sDua(vp;(0treriocoytlpt ln i;s0 exm(m3iu1apt  fvils sDurumoou1opxnmoeiytlm ulnmsnu4trtnxrcoadoaD lu ilt) rum(mpiodal nmnvsa(  2rax  ;o4teenioeiasfm ul(vsnu)altrmoctadomtr ues ( t2xoimpiu1lm emictas)sDurur no0alen i3tlt sDulnvp (4 rtnio iy1fa  lueo;s)t2uo(m io1ap elfetlt)s2ua(root4oetoioeiadlmDel(mp;(0 eenxfctydoatrliei;()texoxopoudamee ivilsfsrrmum no1apeomfciatfaDra( o u0teenircoytlp e uei ( s2tm(o iu1omtnlnesas)artaum ot4tee mo3ildlsDrau s;(0alxoxf3todlptrlivs t0setmim iy1omeemfviat)aDurumoot0tleoiocils s2elnvp;u4trtoxf to1laDe nei;()trum(rpiodoptnmicia(f 2um(rpot4oexoiieiltla2raumsnt0 ltoxfcoytla  aivo;s)teum(opiu4llenlicta( srur(mo;o4tee  octadla el(vs;t4 eeomo iy1lm e uesl() rtmio3nudlltnmncslt sDra(r ot1aex mieiad a2el( pn(4tetnmfcoodfm  lneo;s trum(o3no1lleemnes tf 2taxrpno4optn f3ilsfa ean p u)tetrxfcoatfmDraivo;t srumio nodol   fvsas)a2ta(mono0oet  fctasfs2ra( pn(4 ltrif3tatfm eli s;() rtriopiydapeelfvtasf Dur( oot4opt ifeiytlaDemn p u0 ltnmr3iy1faD  nes;() 2um(rpiudlmt mnci ( s2um(  ot0tpeoifciysla uauvont0artnir3totoptrlieil(0trtoiopnydlm n fvs s)s2rr(  ou4altoiicias a2rmnvo;()tltomo tatfm  anei;s)s2xmim3oydapeeliviatf rurx  ;t4apenifeiytfm2umu ont)aleomr3oo1oa  lnei;t0 2xo(rpou4am  lneilt aDta(m ot4apenif3ias aDuauvs;t4trenmocoy1optrau sls0 2toim3nu1alte icia( s2tmxmpou4oltnio3ias aDulump;(0areoif oydfmDe nvslt)texr(o3ou4alte nci ( a2urxrp;u1aexnmictld a2rln ont4artnmrciotfpDeluvil(  rxmio3oudll  mfcta( a2rruro;t4opxo f3ild s2eaumpn()tetoxrcootom elivi;(0trurxo3no4apee fctl(f Duru  ;t4olt  f3ildfm2uanvo;t4texnircio1fmDeaivslt0sexmio3iy4al  liesatfa2rr(mp;u0oltoiietadfs rlu on() leoxf3iytfpt  ueo;(0seumirpiydll   fesl() 2rmumono1alenioeiat s em( pnt0texrir todlpt  nei;(0s2xoxo ou1op elfeilt) 2ta(m ot0oetnifcildfm2rm( o;t0 rxomrcio1fmtr n o s  etrxmpoy4llt  ivtlsfsDuau o;u0olxoii3tat sDum(vo ()aexnxfctotfa  lu i s  2xrxo3ny4opee ieias)sDumumooo0aexnmo3iat aDrlnvs;t4 rxnmr tytlm   ueilt0s2xmir3iy1olt  nciatf rtrxmpot0alto fetldlsDrlumo;(0 rxrmo ootlpD lnes s0 rurxo3iu1lme lfvtls) Drm(ro;o1alx  o3iyslm rm(mp;t0texomf oydopDrlivo;t0trtoir3iy4amt livi s)s2tmum ot1tlen icild aDrl(mo;t)tleomr3oy1faD aivi s) etm(m nydllen fvslt) 2rm(mp;u0opxnmoetls m emums ()tlenxo oy1lptr ueolt0s2uoxo io1ap elncias)s2rrxrpoo4apto icilsla2uluvon()arenirciy1fmDelueo t)t2xrim io4open nvtat  rur(m no1olt  fcias m uluvpn(4 lermrctatlmt li il(  eurim oodlm  mnetlsfarurx  oo4altoiieiytlmDrmuvo u4aexnxfcio1fa   ivi ()tetm(opnudome liet t)a2ra(r ;t4alen f3iyt s2eluvo;(0aexnirctatomD luvi;s0 rxr(m3oy1lltemicil( aDrruronu4tex  i3tlt aDra( o;u0treoxocia1lm eluei (0texmirpno4amtnlfcsl( a2umumooo0tlt ifeiat s2rlu pnt0aexoir iotlp  auvi (0tetrim3oy4om n ici ()aDtrx  no4olxn ietatfs ean o;t)texrmf3oodfaDe uei s)teumxmpnu4lltnlfcilt) rurxmo;o4teeomfctyslm2ua( onu) rxomf3oa1oatr uvs t) rur(rpny4ope lfesasfaDra(mono4oeto icilsfa elnms ()aeenxo io1laDeln s;s s2xo(m3no4lpe  neilsfartr(monu1aet  fctadlaDumu p;t0trtrxf ta1lmt  n ols trxmim oydamee nci sfa2rr(m ;t0opxniocils sDuan snt4tlxnif todlmteaies;(0 2trim nu1ap nlnet s) Dtrx  ;o0alen feiad mDeluvsnu0trxoxf3iodoaD aivi s0srxm(opiy4om nmfesasf Dtmxmoot0aetniociysfaDea( o;(4tltoxr3iotlmDrliei;()seumxm nydlpe lnei (f 2ta(rp;o0aeeo o3iyt m2rmnvon(0 lxrif3oodlpDelu ils trtr(opiydam  lictls a2uax p;o0tlx mictydlsDrmu s;(0aetnif to1fpDe u o t srxrxr3no1op  mnct s  2umx  nu1tpto i3ilsla uanmsnu) rxnircty1laD lueo () ruoxo3iydalt mneia()srtrx o;t0aexn ociyt sDea(vp;t4 exrirciadom rlues;() 2urimpoudopt  fvt s) rrrur no0oet iietat a2rm(mp ()tetoifcoo1fpteaieo s) rumxo iydol e nciasfarra(root1opt ifciltlm2emu pn() lxnmf3iydfaDranes;(0 eumxo iudolt micta(  2ta(rp;t4alt mfctysls2rlumsn(4arxnxfcia1oa elu i;t) eurxmpiu1ll elnctls aDumu o;o0openiietatla2rmuvsnt) reomr ootlaDeln o;() exrir3io1apeelncs sf Drm(m ;t1oeenmi3iydfm rlnmpn(0 etoxr3ia1fpt  n s;t texmim oy1amte feta(faDuaxm nt0texnii3iltls rauvs t0arxrifcia1oa eau i s0 ruo(m iu4lltelfcta(f Dtm(mpnu0apenmfeiydfsDraumo t4altomoctotoateaieilt s2umxopio1olenlneta()aruau  nu4tpe  icild m2eau p;t4treoxoctatop r i i ()seuo(r3oo1ape mnciat)sDuaurpoo1oeto fciydla emnmp;(0 rtrif3oydop eau sls s2xrimpou1amenlfei () 2tmx ont4olenmo3tltfa2ua( p (4 rxrxo totfateln i;s tetrio iy4ol elfvilt aDtau ont4oexoio3iltlm eanmo;t)tleoxf ty1lm e u ol( t2toim3io4am nlnvtat)s2ua(rpot1oleoiiciad m2eln s;u0 exrmrcoytfaDeaivils0s2xrxrpoydol  mfeiat)artauronu0opeo f3ild a rmnmp;u4 lxnmfciy1lm r ues;()s2xmir io1opt mfvtls)a2raxmonu4tpx  o3tadfs elnmsnt4trtoiocia1fpD lu s ( srtm(m3nu4olenmnctas aDraumoou4tetnif3ilsfs2el(vs;t) leomoctytomte ues;s) 2tmir io1op nlnvt tfarra(mpno0aeenif3ils m uau s;(4tltoircty1laDr nvi t t2toimpoo1olenlfes tf 2tr( pot0tpe  fciadla ua(vsnu4teermo3ia1omDe n i t seum(o3ny1omeelici (f 2trxmpno0aeeomi3tldfs uan s (4arxomr3iydom  lu i t) 2tr(m3nodale mivsas a2tau oou0tlen f3iytfmDelnvo t0arenioctytfa   u i;()t2tr(o3io4om nlnvs (fs2ta(rp;u1aetn octasfs ua( s;t) exomfciydfmtrauvsls0 exmxr3oydopenlnci t)s2ra(root4optniociatfa2ran o;u4 ltnxr ootoaD lueilt0 2urim nu4opte nei s)sDraur nt0tee  ociys sDrlump (4altrxf io1omtraies (  eumxrpno1amtnlfcilsfsDtrx onu1oltn fctytfs2uau s;(0trtoiocoo1fat lieol()sruoim nydolt lfet tf rum(mo;o4apxomictatlm2rm(vo t4trtrxr oa1fpt  n sl(0srtmxr3iydom elnvs tfsDtru o;t0texoii3iydlm2ranmon(4 rtrirctadfatrlivo;( texrxm oy4ll e fvi s sDumu ont0ale mieiltfa umnvpn(0aetnio io1fmDr ies;( teur(r oy1lltemnvsls)arrm(  ;u1texo octlsfm eanmsn(4trermr3oa1fmD ln i;t t2umir3iy1lleelicsatfsDta( ont4apt moeilsfaDrlnms (4teenxocoytfptrauvi;t seurim nu1lltemfcs ( arrmx  oo0opxo ieiys sDem(mpnt)aetoxo oadopteanei t)setmxm oo4omte feta()artr(ront0altn i3tas mDuluvo;t4aexrxo3tydoptrai o s)s2xoxo no4ol n icia(fa2tmurpnu0tpxoiocilsfm rm(vs;u0aexnxrcta1fm eau i;s)s2tm(rpny1lptn ietl()srua(ront4apeoioeiltlmDrl(mpn(0teenmo3tatla e ues t0texo(m3nudapt mfvta(  ruaum oo0tpeo f3iytls2umnms;t4aexomf tadlpDelu ilt0srum(o nudap elfesl() rurump;t4texniociatla uaums;t0aeenifctadfatean o s0 etmxo3iu4lptn feiasf ruaxro;u1olx iocias a rmnmp;t0 rtnmf oytopD lnvi s  rto(o no1am   ivtlt sDraxmp;t0tpxn fetltfs2ua(ms u0 lxoxo3oydlmte n olt trtmio3ou4omt mnct (  2umxmo;t4oet mictldfs ulums;u) exriociydoaDe neo;t)setmir iu1altelnct t)a2urxro;t1tetn iciydfm2el(vo;(0arerxoctadom e nvo;()tetoxo3oo1olte nct ( srtaxm ;o4tleomiciasfs elu p (4 eeomo ootfaDeai o t0 2trir3nudop  mies t  Dur( oou0alen ociatfa2rl( o u4alxoir3ia1omte uvo s0s2trimpiy1oleemnvt ( aDtmxmpno4aptnio3iyd s2rln pn()aexomrctatlpt anei t0 2uo(rpiy4om elnci s aDum(  ot0oleoioeiytfm ul( s;t)trtrif3iytomDr neo t0setrirpnu1apen ietas) rtmxrp;u0ape  fciytlm ulump;(4 eeniociydlp r u s (0texoim iy1opee ieil()s2umxr no1olenifciytfm eauvpn(4aeenxo iytoateaieo s  euoxr3nu1alenmfeiat artmx ooo4oet mieiatla ran s;() eenxf3oatfaDe nei (0 euo(m3no4lpeeliet s)srumxmoou1opx moctls m2rlnms u4aeeoir oatfp  anvi;(0 rtrir3oo4ole  fvtlsf rrmurp;t0aet ioctyt m2rmnvs;() exnxrcto1opDraues t)sexm(opio1omen ics s arrruro;o1apxn feilsfs2rmn o;t0aeerxo totfa eluvs ()t2to(m3nu4amenlictlsf 2rr( ooo4tptoiictytfm2rm(vo (4trerxr oadoaDe iei;t)t2xoio3ny1optn ici tfsDrrumpno1altoif3iys s eauvon(0aleoifciotlp rau i ( s2toimpoodlmtelies (f 2tr(monu0alxn fetlt mDem(mo;() ltoxrcia1lmD lueilt0 2uoir3iu4lpe  ivsl( aDumxmo;o4aexo oetltla2eanms;(0trxnmo ty1fa  lues;(0srxo(mpoo1lm nmncs t)a2uru ono4aexn fciyd a rl(vo (0alenif oadfa  lnei () euo(m3nu4omtnmfes t)aDuru o;o1olt mocias a ulump u4artnifcoa1fmt aieo;s  rxm(m iu1ale mieiatfs2ta(rpnt1oltomiciasfmDuan p;u) etomrciotlm r i sls)teurxr oodlptelivtat) Dumuro;u4optoiictadlsDrmu p;t0texrmo3io1fmD  n sl() rum(r oudam emictat)srta(  ot0apt mfciysfsDea( snt)arxrxocoytfateai o ()srtm(rpoy1op   nvsat artm(rp;u0aexomieiasla el(ms;u4teeoio iodfat livsls texrxm nodlmtn fetltfaDta(mp;u0open f3iatfmDemuvsn(0arxnmocoydfmtelu ols trtoim3ny4omtnmfvs ()a2rmumpno4aetnmociad mDua( s u4 etrxr io1lat li slt0t2xmxm3nu4oltnmfvtl()srtm(r nt0tetomfetld mDulnmp;()artnxr3iodfp  ln ols) 2xmxrpnu4omen ivil( arrmx  ou0tlt  o3iytlmDrl( p;u4arerio iodoat anei;s0 euoimpiydlmtemfvs s)arua( oou4tpxnifciytlaDem(vp;t4 reomo3oydlmDr neo () 2xr(m no4ape  nci t srumu  ;o1tpenmicildfmDuln onu) reoirciotfmDr nvo;t)s2tm(m3iydaltemici sfaDumxm oo0opxoiieildfa ua(msnu0texomrcty1fpt  u sls  2umxopoodomtnmncs ( a2ra(roou0ape  f3iatlaDuau p t4arenif tytoatrlueo;t)t2trimpno1omt mfvs (fsruaxmpno1tlx ioeiytfa uaump t4 eerirciotomDeaneslt  rtoxopoy4apt lfesasfaDrr(rp;u4tpeoioeild m2rlnmo;t4arerir3oydfa eaies;s srumxo3no4lmtnmnetlt  rurur nt0apeomf3iadla uan p;u)texnxrcoy1fpD lnvils0s2tmxmpoy1alt  fetasf rtmu o;o4openiietysfmDuaumsn(4artnifctotfateanei t t2uoim iydaleelnvtlt)aDtmx poo0opxnmociltfm2rlnms (4 rxnxrciatfmte uvo s)srxr(r no1lp  mfeil(fsrurur ou4olxnifeilslaDua(vo;t4trtnxo iatlp  anei;()t2tm(rpoodamt lncils artaxrono1tpe ifciyd a elump;(0aeenioctydom e uvolt  rtmiopnodlme mfetlsfaDrrx oou0olxn icildfaDumu pnt0 leoiocto1lateanvi;()t2urir3nydaptnlfetlt srrmumont0aee iieiyt s rln pnt)areoircoy1fpteaiesls0 rtrxo ou4llenlfctl(  Drau oou4olxn iciytfs2ea(vsnt4arxnmfciodlp   ivi s0srxoir3ou1lmtnmnct s)s2raxroou4aet moeiytla ua(mo;u4 lxrxrcta1fmD ln s;s srxrxo oy4lle liviatfarraurpot0aleoifetadfaDul(vp;()teenmf ta1la e nes;s0trur(r3nu4lm  mfct () 2rm(roou1tleo f3tltla2el(mpnu0teermr3io1fpt luvol( seto(opiy4ll   ieia(f 2tmxmo;o0tlxn ictadfm umnmp u4arenif tadlaDr i olt)trxrxmpio1om  licil(fsrtax o;t4opxn i3iat m ulnmont)trtomo3oy1lat ai i ()trxm(m3ny4olenlfes s  Dtm(roou0tleomfciadla2rln on(0 exnif3ia1fmteluei ()srtm(m io4lltnlivsltfa2urumpoo0apxoioctltfm umump;()altrmfciy1omt an s t srtm(o nudame mncsl(fa2uaumpnt1ole iieiad sDranvonu) rxoif tatfmte nvi;s0t2xrir3iy1omtn nvils) Duru oou0oeen fciaslaDean o t)tltoxr3oa1opDeln o s)setmiopiu1ape  nvi ( s2ta(m ;t1tptnmfctydfa2ua( p ()trtomocta1optraneils0t2toxo oodaltelietl() 2raumpou0ale mfeiasla elnms t0tetrmf3iytoateln s;()tetr(o3io1olenmfet t) rrrur ou4apen octas s elnvp;()aeerio3oo1fmtrauvols sexrxm3io1ap e ivtls sDurxmpnu0opeo i3ias a emumo t)trerxr3io1lp r neo t sexrimpio1op  mfvtlt)aDra(mo;t1aet moetltfaDra(mpnt0 rermrciadomtrlu i t0setoimpoudoltnlivt s)arrau ono4aexnmo3tldfm umnmo;u)tleoxf tytfateanei t tetmir3nydamt lfeiat)a2ra(ro;u1olxnmfeiltfs um(monu4trtomrctotfm  ln ils0 rxm(o oydll elfeia(fsrrmum oo0opxo fetatfa rmn p t4 leoxo3iytfat aueo;t setrxopou1op nlnctat)aDumxmo;u4tex  octydls eanmo u4tleoif io1omt lnvi;t s2toio no4om n nvi t)aDtmxmpnu4apto ieild s2eln o u4trtomo tytomt  nvo (  exoxr io1ap emivias s2uaxrp;u1texoio3iyt s2em(vs (0treoio iydfaDe n o;t) 2tm(rpnodap e fvs ( s2tmurp;t0aeto ieiysfmDrmnvon(0altrio3ty1la  li o;( s2xoiopnu4aleemivtlsfa2trxr ;u0teenmocildfs ua( o t0altnif oadlpteauvs s0 rtoim3nudlpte fcslt srurumont0aptnmociadls2umnmpn()texnmocio1fpt an sl(0s2tr(m3no1open icslt)srtrx  ;t0texo o3iyd a2ul(ms;(0alerxrctadfaDr nvi;()trxmir oo1omen iei s)arraumpnu4texo oeiasfa ra( snu0alenifciytlateai olt  eumxr3ny4ale mivta(fa2trxm ot1oltnifctldlsDuln p;()trxnxr iytlp  ai o t0s2urxopio4lmeelnetatfaDrrurpot4oex if3iltfmDumu sn(0aexnmf3iydoate nesls truoxr io4omenlnvsasf 2ra(mo;o1olxoioctlsfa em(mont)tlxrxr3iydfp rau i t trxoxr iydol nmivi (  Durum ;o1olt ioeiydlm ua(vs;u)aeermocoodop   u o;t0teurxm3oo1omt lfei t s2ua(  oo1tee mi3iytlm emu snt4 rxnmr3iadoptelneo;() 2xo(m3no1am  mnvtas)arrr( ooo1aeenmociysla eluvs u0artrxo ta1oa   ieilt0 rtr(r3iydlp n fctl( arrm(m ou4tetn feiasfmDulnvp (4 lxnmr oatopDe nvsls sexoiopoodlmtelfeils)srurxront0aet ioctad a uaums;()alxoif3tadoaDr iei;s  ruoimpoudop   fct (  Duaxr ;t4apt  i3ildfsDuauvo;(4trerio oy1fa  ai ilt trtr(m ny4aleemiesltf rumxront0tpen ieiatfm umu o;t)artrirctodfpD  nvo;t  2toirpno4lm  lictl( aDrrxrp;o1tpxomietyd a2rmn snt4 etnmo iatlmDe n s t  2xmxm3io1lme mfvtl() 2rm( ont4tex ii3iadfsDean p;t0teenif3ia1oa rau i;t  2xmiopiu1lm  lfctls  Drr(r ;o4ale  ociatfm el(vo (0teermr3iadoat aiesls srumir ou4llte netlsfaDrax p;t4tetnioctytls2emnvs u4texnif3oadfaD  nvs s0setmxmpoo4ope  fcs tfa2rr(r ;t0aleoii3iasls em( ont)aeeomf3todoptrluvo;(  rtmir iy1lm n ietat)arrmum ;u0opx io3tytfaDuluvp;(0treomrcoa1fptr i sl() exrirpou1omtelncs t)aDumumo;t4oeeo ietys s umump () leoxrciydlmDrlnes;t0seto(m iy4op nmfvsl()srra(rp;u4tpxnmf3ild a ea( s;(0aeermrcoatlmDeli il(0truo(mpno4ome mfei s srrru  ot0oltomiciadls umums;u0trxnircty1lmD anei s)seurxm oy1altemietl(f 2raxr ;o0ale ioeiytlm2uauvs (4alerifctodoaDeaivols0t2xmimpny4alt  fetas) 2urxront1oleoio3iyd m2ranvp ()arenmfcoadfa elnei;t)trtmio3oy4olt  icsas  2ta(m ;t0alxn ocild aDulnmpn(4 ltnirctatlp raueo;s srtmxm oy4aptnmfet () rraxm oo4aeto f3iad s2emnmo;()teenxo oadlpteau il(0s2xrirpiy1apt  nvi () Dur(ront4alx miciys sDeau p (0arxoif oadoa r i olt)trtmir io1lltelncsa(faDtrx p;u0optn oetys a eaumo t4alxnmf ootlp  ai o;t0srxmir3oy1ll  lnei sfa2rrxm ou0apt moeiytlm ul(mo u)artoircoy1lmDeaies t)srxr(o3oydap elietat) Dta(mp;t1tetnif3tyt s rmuvp t0trtomoctodomtr uvi;t0teuo(r iu4al e ncsa(fa2umx pou4tpe  oeiltlaDranvpnu4tlxomrctytopDeanes t  2tr(m io4al   nci sf rtau  ou1aptn feiatfm2uluvs;t0 lerio tadla r i sl( teurimpoydlp   ictl()sDur( p;t4altn i3tlt aDrauvo;()teermf oytlpDe n o;s0s2tmxo iy4lp  lfet ()sDurx pnu1olxoifctlsfaDeaumo t4altrmr iodop   i s;s s2toxmpio1ome lfesat)sDurx  oo4apt miciydfa rl(vpnu4tlenmoctytlm r n slt0t2to(m oy1lmeelies tfartaxro;u0aetn f3tytlm ran pn(0areoxf3tytfpD  nes;()sruoxm3iy1lm e fcsat sDtm(m oo4optomoetytlsDelnvo;()aetomfciotlaDrlivol() exoxo iu4ome lfvt t  2ra(  nt4tpxnii3iyd m rluvp;u)tetrxo iy1fm   uvs;s tetrim iudlp   ncilsf 2ta(m nt0apxn o3iydfs rm(vpnt4tltnif3iytfatranei () etoio3nydap eliesa(fa2umurpou4tlenmocilt a rlnmpnu0 lerio iydlpDelnvs ()teurir iodamen icsat  Dur(  ou1oeenioetls m uau p;u0tltoxr oatlmtr i s;t0tetm(o3oudlmtemietat) 2tmx pou1aeeomfetatfmDrln p;u)tlenmrctadomt ai ols  2tmxo ny1lm   iet t)s2tax ono4oeto ieiys m2eln p t4 etrxr3tydlaD  ies (0texrxr oy4op e fetl(fs2tau oou4altn ietydlm emn s t0 lermr tytom  luvol() exoxo3iu1apenlfviat  Dtaxr ;t4olto f3tldfaDemnvs t0 eermrctydfaD an o;s0s2xmim ou4lptemieil(  Dtmumono0ale ifctatfsDrlumpn(0teeoir3iadomtranei;t  2umio iodale livsatfa2raumonu0opxn ictas m emu p u)artnio iytomD  n i t  rxoirpnu1aptelfvta(farraur nu4opx  o3tasfa elu snt)texrxr3tatlatr u o s) ruoxr no4lm   nvs s) Draxrono4tet if3tlt mDelu s;t0trxoifcoadfmD auvo t0srtr(r no1lptnlfcsl()s2umurpoo4apxn fctlsla umnmp u0 lxoio oy1lptr neol(0srur(m3nodoptemnes s  2ta(root0tetnmi3tldlm2em(von()tetoir tatlpte n o;(0 exm(m3oy4ll e ivi (f rtru  ;o0aexoio3iltla2rl(ms;t) exnmocoy1lp e i sls0 rxoxopny1ol n fci sfarrm( p;u4apenmieiysfaDrm(mp u4aeerxo3iatom r u s t0setoxrpnu1alt  fcsas)s2raxmo;u4tpxomociys sDem( pnu)aexnio3tadla  lnei;s) rur(r ou1om  lncsa(farrm(mono0apxnmfcilsls2emuvp t)texnmr totfptraivslt seuo(opiodlmtelfcsat  Dtm(mo;u0oleo oetas m ra(vp u4 exniociy1fmtraueo t)t2xr(r3nu1om  mivs sfsrta(rpnt4tee ii3iadlaDum(ms;t0 rtnmr3oatlaDeaieo t)s2xoim io1lmtemivi ()sDrrx oou4aeto fctat a umuvo;t0trermr io1fpD luvs s0seuoirpoy4ll elnvsasfa2um(monu1tlxomocilt m2ulums u4texomoctydfat  nvo;(0srur(r nydal nlfvtlt s2trx poo1apeo oeiatlmDem( p;u0 etomr3iydlaD ln sls)setoiopny1alen iesl() 2ua(rpoo0aexn oetysfa2ulu o;u4altoxf oadoa elnvs ()texoxmpiydol  liesltfs2rr( oot4tpen f3ias aDul( sn()alxnif3oa1laD aneo;t texm(mpiu4omte nvtl( aDra(  ou0oee if3ildfa2ea( p (4aetoxo3iydop e uvs;t0trtrxopnudlle  ies s aruau  oo0tpeoiiciatfa ea( p t4 ltrxrctytlpDeln s;s0t2urxr3iydal emnvt (f rum(rono4tpxn o3ildfm2rmuvs u4 lxrmoctytla e i olt  rtmio nodoltn ict tf Dta(  nu1tetnii3iaslmDua(ms () eeoir3oytlmD an o t t2toxo iy4llte nvt ( srur(m ;o1optoifcias s2ranvo u)aetnif3iadoatrau i t  2toirpoo4lp n ies sf rrrxro;u4tpxomiciat s ea( o;u)teenxrciotom e nes s)trum(m oudope lnvi () 2rrxr ou4aptn oeiyd m2ulu o;u4aexrmf tydfpDrlu o s seuo(r3nu1ole  ivta( srraump;t0tpx  fctyd m rm(vs u0aetrif oa1oaD aivi (0trtmxm nydopt lncslsfs2umumo;o1optomietydfs2uan snu)tlxoifcoy1omDeli i t0trxo(r3ny4lmen ietasfsrrrur ot4tex io3tld sDemuvont4aetrxfcoydlpt  ieol()t2umir iodopenlnvtlt sDrm(rono1tptn fciltfm ra(mo t)trenxr3oo1opDrluei;s) rxrxo oudamtn neilt sDua(rpnt0texn o3iadlmDuln pnt4 lxrmf oytlmDe nvsl( t2trxrpoodomtemfvtls  2rm(root0oet  ieildfsDum( o;t0 eerxf tytlp r u o;s)setoxr iu4omt lfctas)sDta(rp;t1oex mf3iadla2rl(vonu0aeermf tydfm eai olt0 exmxm ny1aptemncil( sDrr(r ;t0tpto fcildlm eanvo;u)arxoxo todlm   ivi (0 exoir ny4om nlnvil()sDrm(r ot4aetoifciad mDranvpn()tetoxocto1la  lu ols) ruoirpiodop nlieta()aDtmurp;t0aet  fcildfa ea(vont0 lermf oatfpt  ueols  eumio iu4ll elfvtls) Dua(ronu1tlen iciasfm2emnvsnu4 eermr3oadlptrlnes () euoim no1alen ieta(fs2tmxmo;o4tptniieiytla eluvo;u4artoxf3iy1oat luvi s s2xoxr oodal  mivtatfa2rr( o;o0texn f3iyt s2rmumsnu4 lxnmrciodop  ai ol()t2toio iu1am nmfcsls)s2ua(r nt1tee  ociysla2uln p u0 etomo3tydopDr uei;s  rtm(mpiudapeemieils  Dtm(  no1oetomfciadfm eluvo () rtnio3iy1omtraieols)t2xrxr3io1lm nlnci s)a2raum oo1aeenioctyd mDua(vonu4tleomf3tatop rli il(0setoir iu1olt mnesas  Dtau pot1apen oeiat sDrmump u)alxomrcoytoaD lu slt0srtmxrpio1lmenmnvsa() Duauroou0alxniociytls uaumpnt4teenxf iotlaDe ies t0 2xo(r oy1ap  mneia(  Drm(  no4aeeniiciatfa2uau o;u0 etrmf3ty1lmD aivs;s trtoxopiu4lpt mfeslt)sDrm(mpnu0alxomietlsfa2eln s t)artomoctatfat  ieo t0t2toim iodlp nlnvsasfa2rr(  ;o4aexo fciadla rl(vp u4 rtoio3tadla  li il(0seurxm3iu1apeelneta()a2urxmpno0aee  o3iatls em(monu) rxrxr todom ran s;t trum(m3ny4opt  nvta(faDuax  ou0tltniietaslmDran o (0trtnio3iatlptr nei;s) 2urxrpny4al e ivias aDtr(mpot4tle io3tld aDemnms;(4trxrircia1fpte ivsl()s2trxrpou1lpt micsl() 2rr(m ou1apxnio3iytfsDemnmp;t4 rtnio3oo1lmDe i ilt  etr(r nodamenmies () Drax o;u0aexnifcilsfaDrl( s (4 lxniocootfm e n o (0sruoxo oydameelneils)srur( ont4aee  o3iadfaDem(von()tltnxr3iodlptran s s0 rxrim nu1lmenmivta(fa2trumoou4aetoioeilslm rluvonu0 rtrmr3iydomD  ivs;s)s2xmxo no1om nmiviatfsrtmx ooo0apxoif3tld s2umu pnu4trtrif3ia1lm r i o;()s2uoiopnudlp  mnvsls aDuax  nt0tetnifciatfsDemu o (4trtnir3iytoptelivi;t0s2xmxr3nudapt lfcil(fa2trx  no1ole ii3tadla2eln s;u4arxnmociadlp eaivi;()trtrim3ou4al   fei t) Drr( o;o1oex  ietydls ranms;()trxrif3oydfpDe nes t0s2xoirpou1lm  lnct s) Dua(r ;u4oee  ietls aDelnmpn(4arermr tydoaDeaueo;t)t2urim iydamen ietl( srrrxro;o1apxnii3ild a emuvsn(4areoxocoytlmDelnvolt0t2um(o oo4opeemfcsat  Drrxrpnu0opt ifeildlm rl(mon(0areoxrctytoat lnes t0s2tr(m nodlmtnmncs s) rtm(  nu4opxnmoetls mDeluvon(4 ltoxr oo1la r ivi (  rumio3iy4ll e nct s)a2rau p;u0texomo3tlsfmDuluvo (0texrxr iotlp  aivols0srtoxm nydlpe mivt sfaDta(ro;o1alxnmo3tyslaDumuvsnu0aeenxrcoo1lmtrlnvs t)setoxmpno1lpt licslt s2umxronu4alxomfciatfa ulu p;t0alxnxo tydfpDrai sl()seto(m3iu4om elivtasf Drru pot1ale  feiyd mDum(ms;t0 lxnirctytlaDrlivo;s)s2xr(mpiu1ll   nvsa() rtmum nt0oltn ociysfa2ulnms u) rtomr totoat an s;t0 rxrio iydamen ietatf Dum(mp;o0oee ifeiyd m2el( s u4 etoxf oytla  lies () rur(r3nodll e ieia(fs2uax oot0oee  oeiltfsDel(vsn(0aexoxrcoa1lat ln s;s s2uoxr oo4omtn fet ()sDta(root1apx mfciatla2ranvp ()aetoxfcia1opDeluvols0seur(r iodop e iesl(farrm( p;t4aleo f3tltfs2ulu p (0 eermf oodlpDr nvo;() etm(o oy4lmtnmnvtat)sDra(ront1alto octadfaDuluvont) eeomr3iydlm eluvi;s0teumxopnu1lp   fcs t  Duaurooo0tlxo fctatfs2rmn s t4 etrxr iotfatrlu o;()trtm(m3iydop e nctas)sDrm(rpou4tlenmfcildlaDumu sn()tlxomrcia1fpDe i s t) etmirpou4amtelfesa()arrmxm ;u0altoifeiltlm rlumpnu0aeerif3oy1fa  aivo;s  2umiopiudamtnmfvta(f rrmx  nt1tle  ieiytfsDrau o (0arxoxo ootfaD anesl( setr(o3ny4op e ivias)a2rau  ;t0apx mictlt m2elumpn(0 etomfctytfpt lu ols0 rum(o ou4opeemnesas artaxmono0aexomi3iadfaDel(vo;(4tlxoxf iodlpD aues;()truo(m3nu4op emfesls)s2rrxm nt4oex mi3tlsla rm(vont0teermr iadfpDr n slt0 2to(r3no4lltn fct s) 2urxm ;o4alx ii3iatla eau p;t)teerxo iytomt ln olt)srxo(o oo1amtnlncia(f rrau  ot0olt moctldfaDemn o;t) exrif tydoa e nesls  rum(r iy4amtelfeils)srra(root1tpx mfctas m2ean p (4 ltnioctatoa e ueolt  2um(rpou1apte nvt ( artrur ;o0optn ieiadlmDran o t0 rtoxociy1lmD  nvol( s2tr(m iu1ale liesa( srrmump;u0tle ioetlt s ulnvo ()artnmr tatfa  livs t) 2xmxmpnodaptn ivtlsfs2ua(rpoo0aleomoeiat s2raumsnt4arermo3iatom rlueil(0 etmiopio1lpe mivi (  2umumoou4olxoii3iys a2uluvp;t4tetnmo tadfm r uvi t0srtoir3iu1lpe  iesat)arrr(m ou0opxo fctlsfaDuan o;u4aetrmfcia1lmteaivo;s  2tmio iy1lpt lfci ( sDraxro;u4apto ietysfm eauvp;(0 eeoifciodla   i s;() 2ur(r no1altnmfvslsfsDraxmpou4aex  ocils a ea(ms ()altrio3tytfm e ivsls teuo(rpoydal e feta()artm( pot4tleniociad mDrmnvs u)alxnxrciadoaDeli o;s0tetr(m3ou4open fvilt)arta(r no1apxn i3tyd a2uanvpnu4 etoirctadlpDelivi;s0t2toir3iodom  lict sfs2tmxmooo0olxniieiydfm2umumpnt)alenir3oytfmt  i sl(  rtm(m3oo4lleemfcias) rua(rpnu4oet ifeiltfs umnmsnu)tltrxo3tytlp elieil() rtr(r3nudope  nctl( a2umxmooo1tpxn f3iadfaDrmnvp;() eeoxociotlaD anes t)srxrxmpiy4aptnmfcsl( sDra(rooo4tetniiciad sDulu pn(0altrxo ty1opteanvsl() rtmim3nu1aptnmicsa(f 2rrxrpoo0tpxnmieiydls2rl(ms;t0aetrif3iatfatrlieo s  2to(mpiu1altelnesltfs2rm( pnu0alx moetydfs ra( p;u0alxrmocio1fptr u o;s)t2xr(opnu4om nlnvt sf Durx  ot4aex ifctlsfaDeaump;t0 etoxo3iytoa eaneslt) exmirpoy1lmtn icia(fsDum(  ;o0oexnioetydfaDuaumo (0 eenxf oydopDrlues;t0 rtrxr3oo4omeelfvtls  rrrxmpot4teeo i3iat aDeluvp;t) eenifcoadlptraueilt0trxm(rpny1altnlnvtl(f Drrx p;u4openmoctatfa rm(msnt4 eerioctadlpDr uvs;t texoxm oydapeemfvs s s2rm(mpno1tpxnmo3iltfmDum(ms u0arxoxfcoa1fat  n o t0 2trim io4lmenmncslt)srtmxrooo0olxn o3ilslm ra( pnu) exoxo todlptrauvils0s2uoxo3nudamt  ncia( srraumoot4oet  icild m2uanvonu)tlenxf iotfmt livi (0teumimpnodllenmfvil(fs2raurpnt1tpt mi3tytfmDeauvo;u4 etoxfcoa1fmtr uvil() ruo(m3nudapt  nvt (fsDur(mp;t4opxnmicils s umn p;t0arxoxrcto1om e neo;( srxo(mpiu4opee nvia()a2tax o;u4oltn feiyt s2uln s () rtrxf3iytfaD  ivol(0s2umirpno1am emfvias)aDrau  ot0oexn o3iatfaDuan onu)alxoxr3todlm   n ilt0tetrxm3iodap  miet (fs2uru o;o4apeo i3iyd a2uanmon()arxoxrcoy1optelieol(0 2tm(m3oydom elfes s)artr(r ;u4aex io3ilt sDrmnmsnt0aexomo3iadfa  liesl() 2xm(r3oo1optnmiesat)a2tru oot0tptnmfeiatfm emuvpnt)trenxrciodop  ln i ()t2xo(o io4lpe lfcs s)aDuau oou0tpeoifeildfs raump;(0 etrxr ty1lmteln o t  2toirpiudolenmfvsl()s2uaumoou1tltn fciyt a2rlnvp;() rxrio oa1lmDrli 
\ No newline at end of file
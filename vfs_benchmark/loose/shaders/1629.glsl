@@ -0,0 +1 @@
+n i (  2xrxo3ny4ap   fvtat)sDrmuro;o4oexomoetltls2rmnmp t0trxrio3ta1faDr uvi () rxrxm3ny1olte nes s sDtmxrpno1tlto oeiadlm rl( s;t)arxnxocoytoaD lnvolt0setrxo3nu4apt mfvt s) Dtmuronu1ape  i3iasla em(vs t) rxrmr3iy1lmtrlueo s trxoxm iy4om e ieiasfa2tm(  oo4oeeo ociad a2uluvs;(4altoxo to1faDe i o () eum(m3nodol  lfct sf 2raurpou1aeenmictyt m ea(vp;u0 eerxf oo1fm eai ilt)s2xr(opou4lm n ietat)arraxrp;o1tpxoiietltfmDulumpnt)texoxfciydom eanvslt  2umxmpoy4opt lnctatf rrmu pnu4olenmf3tld a2ua(msn(4tlerio3tydfm rlues;(0s2tr(m3nydalen fcsl()aDrm(m ou0tpt mictls s2em(mpn()treriocoa1lat aneo (  2toim oydal nmnci s) Drrx o;o1opx  i3ildlm rl( p t) renifciodoa   uvol(  etoir3iodapte ict ( sDrrx ont1tptoiociytfa rl(vs (0tetnmrcoo1fpDeli olt  etmir3nudop n nvsat  Dumxrpnt0opeomoetaslm2uan s;u4 rermr3iydfmt aueilt0t2tr(r nu1ol nlnct s)srtaxrpot0tpto i3ilsla el(monu)teerxr3tydomD  u ol( t2umxm3nudamenlfvilt) 2tru pou1opt mi3iydfs2eluvs;u4artnio3oatlp   nei;s  2toimpnodom nlicil( a2rmu onu1tptnifctad mDumuvont4aeenxr3tydlmD  ueil(0 2um(r oo4omtelncsa()sDtmxmpnt4openifctytfa2rmnvont0tltnircoodlm e n s ()tetoxmpiudomt licsls sDurx oot1aee ii3tadfmDraumsnu0 rtomrciydoptrai s t0 exoio3iodomt mnci ( a2ra(r ;u0aeenio3iad a2rm( p u)aexrmocoo1opD lues;(0s2umxo3oydaltn iviatf Drmumonu0teeoii3iatlaDra(vs;t)teerifcoytfatrln i ()truoxmpiodaltemfctls)sDumuroot1aet if3ias s2umn p;t)aeermoctotoat  ies ()t2xoxm3ou4ale mneiatfarua(mooo4olxnmi3iaslaDem(vp;t4 lenir3iodopD ai i () rumim3ny1llen neslsf 2raxm ;u4altnmo3tysfsDra(vs ()altoifciydoa eauei t  exmir iu4ol nmivtlsfa2raxr nt1aeen oeiyt aDrl(von() rtomr3tatopt  nvols0trurir io1ol  lfcs tfs2rrxmp;o1tpenmo3tyd a emump (4aetrir oodlm   nvi;s srur(o3nudom e fesat) Draxronu0ope  ieiltfaDem(vp;t) leoxo tydopDr i s;t) 2to(rpou1lm eliviltfsrrrum ;u1optomi3ild s ra( ont4 leomo ta1optrai o;(0 2xr(r3ou4om n fes s sDtaxrpoo4olx  icildls umnvo;()aetrifcoydla rlnvsl(0trtm(opoo4ol e nciltfaDtrur ot1tetnio3iydfs uaump;(0texoxr tatopD  i i t0 2xrir oy1llt lnes ()aDrmx oot0alen ocild aDumu s (4tltrir3oydlm   u o s texo(opnudaptnmfci (f rra(  ot0aexomieilsfa ua(vs ()tleoifcty1lmtrli s (0t2tm(r3no4ome mivt sfsrur(rpnt0opxo fcildfaDuau p (4 eenmrcoy1lp eli i s0teumxmpny1lme licsl( srumxrp;u1apen feiltls2uanmpnt0alermo tadopt ln i;t0 2xmxm oo1olte fesa(fsDrrxmpot1olxn i3tat a2ua(mp;(0texnmo oa1fa rai o;t)srum(mpoo1olte fcslsf 2urur ;u1oet iociydla rlnvsn(0 eeoifcoadlaD an ol(0t2xoxm3ny4opeelfetatf 2trxmpot4olxoiicildlsDuauvo (0texomo3iytlp eaueolt)sexr(rpoodlm  lfvs ()arrmur ou4tetn ietydlm2eanvpnt0tleoio oo1lat  uvi;t t2xm(r3iy4lptemfctlt sDrr(  oo4aeen o3iatlm2rm( s (0 etoirciy1fmt  u i;s) 2urxopoo1ol nlicsl(fa2ta( ont0opxo octadfm rl( o u0tlermocoadoaD aneils)sexoxmpoudomtelivi (fs2umxrp;o1oltnmo3iltfmDelnmo;(4altnmoctatfa elnvo;t s2xoiopoy4lle  ivilt sDrru pnu1olenifeilsfa2rlump;(0texrif tytom eaues;() rtm(m3iy1ole lnei s  Duaur ;u0oeto f3iyslaDua(ms;u)trxnmr3tydoa  li s;(0srum(r io1oltnmneiasf 2urx  ou4opxniietytfsDrm(ms;u) leoxfciatfmDe iei (  rur(o no1amt mnvi s sDta(  oo0aptoiieiydfm ua(mp t0 exomocoadfpD au slt) 2tm(opnudlm  mnei () Duru oou4oet  oetld aDeanmp;u0tlerxo3iodfpteau sl(0sexo(r3iu1lpenlfesat  rrmur oo0alenmfcilsfa rmn s;t4tetnif iy1op r uvi t  2uoxo io1op n ics t  2raum ;o0oeeo oetltls rm( pnu0areniocia1omtraieslt)s2xoio iu1ll  mfcia()a2rrump;u0tpxo ictasfa umumo t) ltoxr3ootlaDrluvslt0 etrxr oydal   iei ()aDta(ro;t1opxo fciltls rmnmp t)trtoxr oo1fmD au ils) 2xm(r nu4op   nvi s)srua(rpou0optniiciys aDrau p (0aeenifcio1om r n s ()trtrxrpny4aleemfetlsfsDrau ooo4aeeo ictasfaDrauvp u0 rtnmo iodfpD anvolt0t2toir3no4lp nlivsls) rtr(ro;o0olx mfciasfm rmnmonu0trxrio3ty1fmD  ivo;s s2to(opiydlltnmnvsl()srrr(roou1aexoioctls m uauvs u)alxoxfciytoaD anes ()srxmxo oodal nlietlt  Dtmu p;t0aptniicildlmDrluvp;t)aetoxo ty1fm   nei;()setmxr no4lptelfcslt srrr(r ot4apt  oeilt m uluvs;t4tetoxf3ta1op rlivi s  rxoxrpiu1ome  nvs s  Dra(rpno1alxnifetytlsDum( p;()tlxrxrciatoatelieilt0 exm(m iy4ap nlivtas  rtm(  ;o1aptnioeiatfm2um(msnu0aexoiocoodlaDr n i s) ruo(o3oy4ame  ncia()arraxroot4ole  icildlsDemumo;()artoxf tytfmtrlneils0srxmio3oy1op elfeilt aruax  no0aexn i3iydfmDrmnvp;t4 rxnmo iadlpDrliei;t)srumxr iy4al  lietls)aruaxroou1tpt ioetldfa ea( s;u4 lxnmf3oatfate uei ( t2umio3nudlm  livi (f 2rrum ot0aptnmf3tytfs eaumsnu4arxnmfciadlaDrln slt)srxr(r iudlmtemfcsa(faDtmumoot1oleo iciys aDea(ms (4texoif iy1oatrli o s0srurxr3iodamtn nct ()sDrr(r ;t4aeen oetyt m ea(vonu4aetnifcoa1oa rlnes;t0teurxrpnu1aptnmicia(fs2ta(roou4aet io3iysfsDrln pnu4tetnir tatfmD li i t  2uo(m3nydamenlnviltf 2tm(r nu0aleo iciys a2elnvonu)alxrifctytlm e uvi;s  eumxopoy4al  miciasfaruaxrpnt0texn feiasfaDeanms;u0trtnmocoadoatrauvs;s s2tmxo ou1ol nlivil(f rrmxm ot4aetomfctasfsDeluvp u0 ltoifcia1faDe nei;() 2xm(mpiodalee ncil(fartmu p;t1apx  ociaslm2emuvonu0 ltoxr3tytlmDe u s s) 2ur(rpiu1lmtn fei t)arta(mp;u0oexn i3iyd a ea(mpnu4 lxnxf3oodfmt lnvsl(0 rxo(r3no1om elnvsl() Duru pot0aeeomoeilt s2em(vp (0arxomr3oydfpDelivo;t s2xoio3nydapt livsa() rur( ooo0oleoii3tlt a2ul(von(4 eerircootlp eanvs t0t2xmxo iu1ope lnct sf 2uax  ot1oltoif3tysfsDum( on(0altrxocoodlm eli ils sruoxmpoy1lpte fvtlt s2trx  ;o1tex ii3tydfa2ulums u0trxnircoy1lat lies;(  2uo(o oo4lm elnvt sfsruaump;o1oetnif3iytlm raumsnt4tltomf iadoaDr n s;(0setoimpnu1op  mncs sfsrtr( pot0oexnifeils m2eluvp;u0artomrcto1lp   i i;t  exo(opiu4amt mies sfsrraum ;o1aptnioeiydla eaums;t0areoxo3tatlat luvo;t)truoxopou1altemfviat arrrxmp;u1opxomfciys sDul( pn() lxomr3iodom r nes;( tetrim3io1lleeliciat a2ra(mont4tpe ifcilt s em( sn()tlerirctatfmDelu i;t  2uriopoydlpenmfet tfaDtru  ;o4olxnmieiatfm2rauvs;(4texomrciodlatelu i t  rtrxo iudame lfesa()srra(m nu0aex moctldlm emums;u4trtnmo3to1oaDe uvi;t teto(o3oo1am  mncil( srumur nu0tle  ociyslmDrmnvsnt4 rxrio3tadom rlu i s)teum(mpiu4lmtelieslt sDtr(monu1opt iicils sDulumo () rermocoatlpt aivo s0 exoxo iudllen nei ( a2truro;o0tpxomictlt s em(vpn(0 exnxo oatla  auei;(0s2xrimpoydop  mici ( s2rm(moou1oee  fctas s rauvo;u0 exnxr3tytoa e nvolt) rxr(m3nydlp  licsa()arururooo0texnio3iat sDua( pnt4alxomo3iadla  lnvi;t0 2tmxr3iu4am   fvtlsf Dtrxrp;t4alxomieildfm2emu s u0 etrio oydlpDeln s (  exrxo nu1omeelfeiatfs2urxr ;u0olxomfcildlaDulnvonu0treriociy1lp eaivil(0 2xmxrpnydlm  mnesatf rrr(  ;t1tex mi3tad aDuluvo;t)arxrir3oytop ranei;t0s2umxrpoydlp e netat  2tmxrpou0tpen oetaslm uaumo (4 lermo iadlmtrlnesls  eur(r3ou4lpeelnvi s  Dumu o;t4oltnioctadlsDelnmp (4 etomocoa1lpte nvi;t s2uoimpoudolt mnvsls)s2tr(mo;t4aleomicilsfm2rl(ms;u)trtnmr3iotlmD  neo;t t2urxm3oudom  mivi ( s2rrurpnu0aexo ieilt s el(vo;u)trenif iatfmD  ues;(0 etrxopoo1opee fcs s  Draxr no4tptn f3tasfm2ran s ()alxrxf iy1oat au s;(0srxrir3io1al nlivia(fsDta(m no1tpxoifctytfsDulnvo t) rxomr ty1oat  i o s0truo(r no1lpee fcta( srtmu poo1ale mi3iytfs ul( pnu4tetnxo3tydfateanvi s  ruoim io1al elivsls) rtau pnu1tltoii3iyd a2ulumpnt0 etoio3iatfa r uvi;s seuo(o3oy1llenlnei s) 2ur( pnu1aetnmieiysfsDrm(mon() reoir to1oaDeli il(0 exoio nydape micsl()s2rm( pnu1alxn ietyslm2ra(vsn() eerio3iy1fptrluvi;t0srxmxm3ou1ape lietls) 2rrur ou4aee mietld a2elnvon(0artomocoadfmte neilt  2urirpou1omt lnciat  Dum(roou1opto ieiat a2eanms (4tlxnxrctodlaD  n s;t)trxrio io4amtemivsa()s2um(rp;u4olen iciytls umnvpnt)texnmo3iotlmD livilt  2uoxopoudopt lncta(  2trx pno0tlxo octlsfs rauvp u)teerxfctytlmD li o t0setmxrpno1ll  mivt (f 2umur oo1ole  oeiatls2rmnmsn(0 ltoif tydopD  nes;(0s2umxm ou1am nmfes t) Dumxrp;o4opx  oeiys a2emn p u4trtoif3totfm eln i t)seurimpny4ome mivsas)s2rau onu4oex mfeiytlm rluvp;u0aeenxo oo1fpDr iei;t)t2trir iodomtemfvi s) 2rmum nt4opx ii3iat a2rlnvp u) rtrmo oo1omDeluvs ()teurxrpiu4optnlfeils sDtm(mpoo0aetn icilsla2rmuvon(4 rtnmr oa1lp ranvi (0 2xmimpnu1om   ivta()s2rr(rpnt4ale mieiltfa2umnvo;(0teerif tydfmtrlu o;t s2uoio oy1op nlnes t srua( pno1ale ioctyt aDumnmp;u0 leomr oadoaD  ieils0seuoxm3io1ll n nvi ()arrmx  ;u1tltomoeiltfmDel( p;(0 etnifciatlmDeanvi t0trumxo3iu4apt liesat) rtr(mo;o4aleo ocils s2um(vpn()tetoxo3ootoatr ieils  2xoir3nudapen ietat  2raum ou0texoio3tls sDemu p;t) etoio oy1fpD aueilt s2umxopiy1alt lnes t aDrr(  ou1open f3iasfa2ul( sn()texnxr tatfm   ivs (0 2umirpnydolenlfvs (fsDtr(mp;u0oexnmo3iysfm2ul( p;u0alerxr oy1oa  au o;t  etoim io1omee fvia( arumxrpnt4ope  fciltlm2rl( snu4trerxf3tatfate n i;s t2xoio3oudlpen fvsls) 2ua( o;o4apt mfeiyd a2el(mo;t4alxrir3oydlm rln i t0t2umxrpnu1lm   ivsa(farrrurpnt4openiociytlaDea( p t)arxomocoatopD  i o;s)truo(opoo4lm  lnvsat aDtruro;o0tetnioctlt sDrlnvo;t4artoxr ty1fatean s t) euriopnodllen fct tfaDtmxroot1teto ociatfm2elnmp u4 lerif io1omDrln s () 2um(m ny1ale lfci t  2taxro;u4olx  o3ildfs rl( s;(4 lenxf oydlpte ues t) rtoxm oudame lfci (  2ta(mont4tlt mf3tat a um(vs u)treomr3iy1oa  an o;s0t2xoxm3iu1amenmfvsat  rrmxmp;o4alt iictasfmDulnmp;()trtrxfctatlmDrauvol()t2trxmpnydop emfcsasfaDur(mpnt4olx ioctldlm2emn s u0trtoif3iydla   uvilt0s2xm(opnudope lfes tfaDur( ono1olt ii3ias mDulumon(0aexrio oydoa eln olt0texmirpoudopeeliesltfsDrr(rpou4aetomociat a2ulu pn(4aeeomf3iadlptrln o;s)trtoxo3nu4ap   fesl(fa2tmum ;o1olt  fetysls rlu o u0tlxoiociytfatelu s t)srxm(opiu4oltelncsltf ruaur nu0alt mf3ilslmDemn p t0trxoxr totoatrlu s;t teuoir3oodllt mics t)aruaur no0alxn o3ilsla ua(vs (0 rxoxf3ta1fpt luvilt0 rxmio iu4ol elivs t)artmur oo1tptoiictysls el(monu0trermf3oa1lm raivolt0srxo(opio4optnlicsat)s2taur ou0tlt ii3iytlaDeln p;(4arxoifcto1om rlu o s0setr(m3oudam  mnei s aDurxm ou0oet mietys m2ulump u)teenmr3ta1opteaneo ( teurir3iydale lieias s2um(r ;t4opeomo3iltfa ranvs t)tltrmr to1oaD  i s t)srtmxmpiy4lmtemictas)s2um(rono4aetn fctydlaDumnmsn(4alxrifcoo1faD liei;( setr(o io4apen neil()a2rrxr oo4texomieiysls2ranvo (4aexrxf3tadlmte u o s0 2toio nudlmtnlivsasfs2tmuro;t0ape mi3tas m ea(vs;t4 eermocoadfp  aneolt  2uoxo iu4lpe  nctat aDuru ooo0tpenmfciasfsDrau s t4 lerxo3oy1fpD  uvo () euoxm3nodom n ncilsf Drmxr ;u0apeo oetyslm2rlnmsnt0 lxrxociydopteauvil( sexrxm nudap  mneiat s2tmxm ou1ole io3tyt a rmnvpnt)trenxfciy1fpDelueo s0 rxr(r oy4openmnciasfaruaumpoo4opxnmoeildlsDra(vs (0 ltnir tydfmtr ues ()trum(o ou1ame lnetasf Dtrxroou0oleoiocils m2umu pn()trtrmf3oadlmD  i s;s s2uoio ou4ope mncslt  Dra(r oo0tpeomo3tlsfaDulnmonu0aetomo3todoaDeli s;s  rtoxr io4lp elies sfaDtrurono1aexoio3iyd s2raumpnu)teenio tadfmDeaivi;()t2toxm nu1lptn fcias)sruauronu4tlx  o3tydlm emuvs;(0aexrio io1la elu i () rumir ny1ape mfvia()aDrrxmo;t4teeniocils s2el(vo (4tlxrxociadfp e ieils texoir3oo1omee neils  Drax  ou4aee moeils aDrau pnu0artnio totla r n il(  rumio oydomtemivtlt) ruru o;o1tet  oeild a2rm( pn()arxnifciytomte ies;s)teum(o ou1al eliet (faDumumo;o4alx  oeiltfm2rmn o u0aetrxociotop rli olt srxm(m3iu1alte fcta( a2taurp;t4aptomi3iys a2elnmo u0aetnxr3oodlatr ueilt  rto(m3ny1lpe mics s s2rrumpot4optn i3iyd mDel(mo (0 exrmo3oytlpD  n s t setrxopiydoltnlfvt t srra( p;o0aeto iciat a2eau ont4tltnxo tytopt  nvo;t0srxmxo3io1lmee nvsatfsDtaxr nu4teeo ocildlaDrluvs t4aexnxr3ia1laDraies s  rumiopnudlmtemfvs sfs2rrum ;u1tpenii3tadfs2rlnvpnu4trxrxfciadlm elieil()trumio no4ll nmivt ()srrax  ot1tltomfcilsfs2ranms;(0treoxf3ta1fp elu o s  2toxo io1lpt lics (  rra(mp;t1tex  icildls2elnmpn()trenmfcio1lmDelneo s) rumxo3oo1alenmnvslsfaDtm(ront0opxn oeiyd m2um(mp;(4aeenifcoodfateln s s seuriopio1amtelnvia( sDtrumpot0aeeomietlt sDuanmo u4tlenmo3iadlptrlnvolt) rtoio3no4omeelnvi t  Dua(r ot4texoiictlt a2rmn o t4tltomf3oodfmDraies ( sexmio no4op emncil( aDtmuro;t0oltoiicildfm um(vs t4 rxrif3ootfmDrlnvolt teumirpnu4lpe mietasfartrxrpnu4olxn f3iyd a2ulumsn()teeoxr ty1fa rlueo;s)t2urxr3iy4ol n fctl( s2uax  ;u0teenmicils a el( s t)tlenxfcto1lmtran ils)t2urxr oo1ale  nes (faruaxmp;t0olt  oeiydfaDuanmo u4trtnmf3iotfa r ies (0 2xrir nu4ame mictls)aDrrump;t1altnmoeiasfs rm(ms ()aetnxf3tadfmtr i i (  ruo(m3no1ape  fcils) Dtaxro;u1tlt mf3iad a2ua(vp t4 eeomo3iydfmt au sls)s2trxr3oudam  lnvtat sDrr( pno4aetnmfcilslsDulump u4aetrirctodfpt aivilt0s2xmim iydlltemneils)arrrumono1aetn ieiytfs2uaumo (0tlermfcoy1fm raivils)t2uoir3nydalen ivtat)s2tm(  oo4oeenii3ils a ranms t0altnir totlpD auvsls) ruo(opnudll elietasfsrumxr ;t1oetnio3iytlmDrau onu)trxnio3iy1oaDeau i ()srtm(mpnydaptn icils aDumxmpno4oltomiciydla2el(vp;u0 reoircta1opDeauvo;t trxm(r3iodomt  net sf Dumx o;t0texomo3iysla rmu onu)treomo ty1omteaieo;t s2trir3oo4amte nvilt)aDumurpnt4tlenifctydla2ean p t0aleoioctatfmDraivs t0trtmirpiy4ap elfcilsfsDtm(rp;u0tltoii3tys a2ul(mp;u4 lxnmr io1fpte uvil(0setrxo iudalenlicia(  rrrxmp;t4tpxo o3tatfs uan p () lerio3iotla  lueslt0s2xr(opnudom  lfvi t s2uaxronu0altnmoetysls2elnvp;()tltrifcoodoaD  uesl(0 exrxo3nu1alenmneslsfaDuru  oo0apen i3ilslmDean s;(0alxnio3iodfmDrau i s0 exo(m3oy1lpe liesltf rrruront1aeenii3tadlsDemu o (0 etomf3oydfpteli slt0seumim oy4omenlnetls sDta(mpot0tpx  octyt m ra( pnu0altoif3to1la rlieil(  2xo(r oodlm e nvtl()aDua( oot1aeto fciatls2uaumsnt)artomf oadlp rlnei s sexo(r ou1olen fei tfsrtm(mp;u1opx mi3tldfa eanmpnt0aeeoxo ty1lmt an sls)s2tmim iu4lmee ici () Drrxmp;t1oexnifeildlm2uluvs u) ltnmr3iytlpt auvsl()sexmxopoy4omtemivtltf 2ra(  ;u4apt  octlslm ra( p;(4tetnmr to1faDeaiesls s2xoirpny4aptelnvs t srtaumooo1aleomf3iltfmDemuvs;u4altomo3oodom r i ils0t2xmxm3oodole mnvtl(f 2rm(mpou4tpt ifetat a2eanvo t0aetnifcta1lp e neo s  2tmxm3iu1al n fes (f 2tru p;u4apeniiciltlsDul(monu0arermr ootfm   nvs s) etrio3nodlmtnlfeta(fa2tr(rpoo0tlx  ociadla em(ms (0 eenmo iytomDraneslt0srumiopnodom emnvt s) 2taxrpoo0aptomoetys sDrlu p u)trxoio tytfpt lneol(0trxo(mpiu4lpte icsl(fsrur(  nt4tle ii3ildla2rlu p t4 rtniociatlm r n o;t) exrxm oodlpt lneilt a2tru  ot0opxomociydlmDelnmp;t)aeeoifcoy1latelnvolt)t2ur(o ny1apt lnvs (  2rru  nt1tex  i3ilt a2em( s;t) lxoxf tydopt lieols t2xmim3io4lmte nvtls  rrmump;o0alx  oeiysfs2eauvon(4aetnxo3ta1lm e nvilt srtoxr3oy1am  miet t)a2tau p;o4tpxoio3iadls2uln s;t4trtrxr3ta1om r n s ()truo(mpiu4llenlfetasfsDtrxm no4tee  i3ilt s umumo;t0aexrxo3iydlpDr ies s0 2umxo3no1op n ivi sfs2rmu o;u4aleo fctldfa2uluvp;t4arxoio oydfatrauvolt0 etoxm3nudlp nmiesl(  ruru p;t0tee mfeiad m eanvo u0 renio3tytlp eaueol() eum(r nodlme  fcs s  2umxm nu1aex iictat mDuln sn(4 reoio3todfm rlnes t0s2umxo iu4ol  lfctas)a2ur( p;t0tlenmi3iltla ra(mo u0tltnxfcoo1fmt  u slt  rxrim3ou1lp  mnvslt s2trur ;o1tpx mi3tldls2eaumont0 eermr iytlaDean ils0 2to(r nydlme lncsa()arrr(mo;u0olto i3ild a emumo;u4tlxnmocoatop  an ils)t2to(o3oydlmt miciat srrax pnt4alx  fcild m2umump t4aexrif oo1oat aneils t2trir oydapt livsl( sDtm( pnu1aex ii3tysfm ul(vp (0 eenmfcoy1lp rlivolt)t2tmir3nodlm elnvs (fartrumpnu4alxo ociytlm2rln o;(0areoifciytfmD lueo t)srum(r3io4lmeelneil( s2rrum ;o0apen fcilsfm ea(vo;t4trxnmrctatlaDrlnei;s0 rtoiopiy4open ivsa( arururonu4tetn ietas s2eanvsnt4aetnmfcoo1fateaivi ()srxoim iu4optnmnvsls)a2rrxmpou0tleo icildla eln pn()tltrmo3tadlptrlivi;t s2xrxo iy1aptnlfvias)sDuau  oo1tpx mociltlsDrl( s;u)artrxf3iotlptr nvs;( srtrxr3nudlm emnvia(fsDrrurp;t1oex mieiad mDuanvpn(4teeoxr iy1fm e ivo s0s2uoxmpoo4lleelfcils) 2tmur ou1tltomf3iytfa ra( p (4tlenxr ootfm eluvo;t srxrxm3io1omeemieils arta( o;t1aeeomfeiltfm2ra( o (0texoifciy1lmt  n ilt)srum(r3oo1omeelnvt t) rtruront4oet ifetldlm2em( p;u0 eeomfciytlate i o;s  exo(o3oo1al n ici ()artax o;t1ole io3ilt s rmuvp ()artnir oodfmDrlueslt t2xmir iu1aleemfetltfa2rmxmoou1optomi3tyt s2rmu pnu4 exoircoodfaD liei;s  rxrir iydaptnmivi s srumum ot1teto oeiyd s elnvpnt) ltnmf3tatlptrlnes (0trxrim iudal nlfeias) Dtaxmp;u1ope ioctysls rmump (0aetrmf totlatelnei t0trxm(m3nu1alee fvtas  Drmurpot4tpenii3iydfsDea(vs;(4texoifctytoatr n o;()s2trxo oo1al n icil(fs2raumo;u0opxomo3iadfa2rau s;u0aeermf oytoaD ln olt  eumxm3iu4aleemfcs (fa2umu  nt1oex mfcildfm uaums;t) eenmr3ty1fmDrluvi;s) etrxmpnu1ame lnes tfsDrmxmono4aex  o3iadfsDrau p u)arxriocootopt luvils srto(m ny1amtelfci tf rua(m nt1alenif3tydlmDrmuvsn()tetriocoa1lpt  uvs t0 ruo(opoodop e fvslsfs2urx pnt1ape  fciyt aDua( o u4areoir3iy1oaDrlnei t texo(m io1lpt  fcilt)aDua(mpno4tlt  i3tls a2rm(vo u)tlxoxf totlmtr uvilt s2trxo oy4llenlfvi ()arua(mpno0tlen f3tyt a umu p;u4trxnmo totlat luvs s0seur(rpoydaptnlfei s artau p;t1aexomoeias a2rln snt4 rxrifcto1fa rluei t0s2tmir iodole lnvsasfaruax onu1tex if3tydfaDum(ms;t0trtomo3iy1opteai ol(0 2tmxr3ou1olenlfcs ()srrmuroou0olto i3tat a umu snt0tlerxfciodlaDr ivol(  rtoir3ny1omtelneils  Drrxr ot1olxomf3tysla elnvs u0arxrxocoodoatrluei s) 2urxo3iydal  mnetl( s2tmx pnt4oee  i3tyt s rluvp;(4texrio tytoaDr ivi ()trxrimpoudalt  nesa( aDrrumono0aetn fcils s rmnvsn()trxnxr ta1oat auvs (0 2tmxr oy1optn fvslt  Dra(m ou4openiicild s ranvpn() lermf iytlmte nvs t0 2tr(o3oo4lmenmieiltf 2tm(r oo0altnmfciyd aDrl(mon(0artnmf iytlpteluvols0tetm(r3oodlp n iviasfs2uaxmp;u1ope  fetltfa ea(vsn(0trtnxo3oo1fp rln o;s trurxopny4am nlfctat sDua(mont4opx mociasls rmuvs u0tetrifctotlmtraieo;s) rtoimpnodlmeelfviasf 2tmu p;o4aetnmociltla2emuvo;u0tlerxocio1lptrlu o;s) 2xo(o3io4lp   nvsltf Draumo;t1aex mo3tlt sDemnvp t0tleoxo tadom eaieolt)s2toio ny4amen ict () rtm( pot1apxoiieiysfs2um(vp (4arxoio3ia1lpDe u o;t  exm(opiu4ape micilsf rrr(m nu4texnifetad s emnvpnu) reoir ia1lmDe n s ()trtm(mpoydomeemfcia()sDumur ot0aeeomictltls2umu p;u4artnxrcio1fpt  uesls0 2tmxm oydoltnlivil( aDurxrpoo1olxnmi3iadlaDraumo u4 renif totoa ean il(0 exoio nudapt mivsl(fsrtmxrpnu4oexomi3iatfs2umnvs u)tetoir3ty1fmtr ieo;()t2uo(mpnu1lme lnvsat aDtrxmonu4olt  f3iydfm rln p;(4 rtoir3tadomD lu i;s  ruoimpnu4llt lncsa() 2rmxm ;o4tpeomoetyd m2rmn sn(0texoif tydomteanvi (0 rxoxrpny1ome livs tfarrru o;u0tltnifeilt aDrl( snu)arxnxr totlpDelnvol(0 2xm(rpno4ol  mnvt (fs2um(rp;t4oltn feiat s eauvp u0arxnxo3ty1latean o;(0 2urir3oodoptemfvias)sDtrxrooo4olxo o3iatfmDumuvs;(4 etoiociadoate ueolt) 2xr(rpno1amtemfcsatf rrm(r oo4tlen oeils m rl( snu4 etrmf3totfmt aneslt)srxo(m oy4apenlncsa() 2ra(rpnt4tltomi3ild a2elnvp t0tltnmf oa1lp r nes;t0 ruo(r oydlleemfcsl( sDtrxm nu0optoifcilt a umn onu0texrxo3oodlaDrai ols0t2umxrpoo4om   netl(f rtmxmpoo4apx mo3ildlmDel(vo () eeoir oy1op r nvo;t)trtrxrpoydal   fci (fa2um( o;t1tpeoiietasls uluvp;t) rtniocootlmteln s ( trtriopiu4lpenmnei tfs2um( pot4ale  o3tysls rluvont4 exnmo tydop e i ilt)t2umio3oudlp elncia()s2umumo;t1oetomf3iatls eanmsnt4 lenir oatlp raneo s) 2uoxr3nydlp elfctls) 2taxr ot1tpxomoeiys sDrl(mont0arenircty1fmte ieolt  2uoio3nodoltelnci t) rra(rp;u1oleniiciadlmDeanmsn(0teerif io1faD  i ils) rtrim iu1al   feil()arra(rpnt0ape iociyslm2ea( s;(4alxoxocia1faDr n s;()s2trir iydlptn fvsa(fsDurum ;o0aetnifeiydlsDul(monu0 exnmo3iadfaDe nes;(0 rurxr iodom elncsa(f ruaurp;t0tet  f3tldfaDulnvp t4 reoio ty1optr u s;( t2to(opnu4lmtn fvt t)sruaurpnu4oeeo fciys m2emumonu0 eeomr3tadlat aneols0 exrimpiydome  fes t srtru ono4alx io3ilslsDuau p (0alerifcio1fmDe i s s)t2urim oo1oleelictas)arrau ont4olxnifeiysla2uluvs (4teermf3oy1opDr nvsls s2xo(mpnudomtelncs s)s2umxm ou0aexo f3tys s ulnvp;t4 rxomfcoytfmt lnei;t tetr(mpoodamtn fei (faDumumpnu4olxomi3tysfm raumsnu0tltrio tytfp e nei s0texm(rpoo1am  mfct tfsrraxro;u0tet ifeiydlmDrauvsnu0teeoxrcta1oat  uvi;(0 2tmxo3ny4ll  lictl(fsDurxm ;u0altoio3taslmDrmnms;t4 eenio3tydfpDelnvo s  exoir iudale lneils srra(  ;t1tet mictytfa um( s;t)altnxr3tatlpt  nes;(0 eurxmpnu1ll nlncslt srururpnu1apx mi3iys m ean on()tltomoctadoaDe ivo;s0seto(r3iydom elivilsfaDrr(rpou1opto oeils a rlnms (4 eermrciy1oaDr ivo;s) 2xoxr3no1apee ictat)arraurono4altn fciyslm2em( o;u0 eenmociadlp   i s;t  rtoxo3ou4ope micta(fsrrax p;o4tptoiictlt aDulnmsnt0 exrio3oatoaDrln o;t texmio ny4amt  icta() 2taxmont0oleo i3tatfsDra(vo () lxomfcta1fptelnvsl(  eumxo3nu1llenlfvt tfaDtru pnu0teto i3iad sDuauvon() ltoxo3ootopDeln o;()t2tr(m oudlp nlnei s arraum nt4oeeo f3tysfa2emnvs;t)alxrif oytfp rli o t0 rxo(m3ny4aptelnei (fartmxm ;t1tlen fctls aDranmonu4 renxo oy1latelueols0 2xoirpiy1olenmnctat a2rrurono1tpxnmictytlmDelu o t0areoif3tytfaDrlivs;(0t2xmxm nodolte nvslsfa2rm(ro;t0tlt iictyd aDean ont4trxoifciy1oat  nes;s srur(r ny1olt lnci (fa2tax onu0aptomoeiadla emuvp (0 eenmf iy1fpD lu ilt  2umxo oy1ale lict ()s2umx  ;o4tetomf3ias a em(vs t4teeoxo oydlp eaivi (0setoxm3oy1omt miet sfsrrau  nu1aptoifciyt sDum( pnu4texnxrcoa1op elivi;(0texoiopou4omtemict s)srrax o;u1oex  i3tasla uluvo (0tlxoxf iatoat lu i s  ruoir iudll nmfvi t)sDra(mont1tpe  oeiaslaDuan p u0 reoiocto1omte ies;t tetmiopiu1lme  ictls srrmxm oo4aexo oeildla2rluvo;t0trtrifctatlptelnes ( s2xoir3oydoleelfvtl(  2urur ot1tlx mfeiltfs elnvpnu0 rxnxrciydfmt livs;s0 ruoim oy1op nmietls s2urx o;t1tetnii3tyt mDel(mpnt)tlxnio iy1lpt  ies;( tetmir3nu4lp  mncsl( a2tau oot1oetoiictas aDulnvsnu4alenmfcoodop eanesls  eum(m oy1omtemnvil() 2ra( ono1tptoiieias a2rlumo;u) exomfctodop  an i;s0 eumxr3nodam elfvt sf Draxmpot4oexomfetyd mDrm(mont0arenmr3oo1fmtraues (0 rtmxr3iydoltnlfctas)artmumonu1oexniieiytfsDuaump;u0alermr iytfmtrlivi;s0s2xm(m no4llt lncilt)aDra( o;t0apen ictysfa raums;() ltoif3oydoa  auvs;s s2xr(mpio4lptemfvta()sDtmu  ot4altoifciysls uluvs u0 eenifctotlp ean ilt0trxoio3nudoltelivi ()a2trxrp;t0oex ioetytfm2el( p;()altrmr oydfpDe ivsls0truoimpno1alt mfesas s2trxmpno1aleo f3iyt mDemn s (0alenxr3iytlp  ai i (0 etoiopny4op n ivilt) Drr(m ;t0oetomieiltlm ulumo u0aetoxociodfptraivols0srxr(mpny4lm e fvt (f 2umum ou1tpe micildlmDrluvonu)teerirciy1fp  ai ils) eto(rpou4oltelnvtl()aDtmxm ou1tetnmo3iytls2uau p;t) lxnxo todfate uei t0 rxr(opoudom  lictl( srtrx ooo0aexnmoetysls2rau pnt0alxrif3oydlat  u s ( s2uoir iy4ome  fvsat) rua(monu0oee  f3tadls ulnms;t) ltnxf3ia1opDeanvo;(0setmxr oudaptn iviltf ruaxrpot4oexn fciytfa emnvpnt0trxnio iydoaDr i o s0s2xmxr oy4ole mictlt  2rr(rpnt0aeenifciysla2rlnmonu0tltrifcoadlp e neo (0srxoxo3iy1lptnmncsa( artau ono4ole ifeias a emu p (0 etrio3oadfm e ies t0seumxr3iy4llte nvslt)sDrrxro;t4teeoiociyslm2rlumonu4 reoir3ta1fptelu s t) exo(rpoy4lpen fvs () Durx ooo1tleo ieiasls2eauvp;(0 rxnmf3oatlatraivi t t2xoxopoudol emncsa()a2rru  nu0aeeomociyd a umumsnt4aetrxo3iatlmt lueolt0sexo(o iydlpe mneta()a2rrxr ;u1tlxn f3iat sDrl(mp u0tltrio3ootlmD anvolt  eto(o3ny1omen nvs t aDrrurpnu4alxoiieilsls elu p;(0 rtoifcta1opDe uvo t tetrxrpno4altemieiat)sDra( onu0texoif3iatlm2eln p u4teeoifciytlmD li o s  ruo(o oodlpte ictl( a2taxr nu1alen f3tys sDeauvp u4 eerircto1fmD  nvo;s setoio3oy4olt micsl(  rraxmooo0tpxnmi3tys mDumnmo;()alxrxfciadfatelueo;( s2xr(rpio4amtnliesat a2trum ot0olx if3iltls2ra( p;(4teerir3oytoatr neo;t) exoimpnudlmt  fcia( sDrmu oou4aeto octyt s2ulnvs;u4tltomr iy1lm r nvi;t)trxrir3iu1lle mnctl()s2ta(  nu1aee ioctytfsDrl( p;t4 rxnmr3tatopt luvi s)srtoxr3ou1apte ncsas  rtmxmpou0aeeoiiciytla uauvs;u4teeoio3tadlpD  iesls  exr(opio4lle  ies s  Dtax o;u0tleoii3iad mDranmp ()tlxoir oydoa rli s;()srtmir3iydameemfcsasfa2rm(  no0olen iciytfmDemnvo;u4teenxocoa1oa elnei;s)setoxm oo4oltemneilt aDrrumpno0tltn ietadla2raump;t0 rerxocoa1oatelu sls0setrio3no1al elncs ( s2rmxm ou0apx mf3ias sDemnvo t)tltnmrcoa1fa eanvsls t2xo(r3nodal emnct (  2ta(r ;t0apx  iciatfaDel(mp;t4artrmr3totlmDr uvo s0sexrim ny4lpenmnetlt  2um(moot1alxnif3tydfsDrln s u0aetrifcoa1la r n sl(0srurimpoudal nlfvilt)a2ta( oot4tlx  icilsla ulumo;u) reoiocta1lmD  ivslt  rxoirpiy4lmenmnvslt) 2trxr nt0oetn i3tlsfm ean s;u0 exnxf ta1fatrlivs;()t2trim3oodlle  ics s)s2uax  nu4aeeomfeiytfa rln p;t)altnxo3iadfaD  u o t t2um(o iu4alenlfcsas  2ua(monu1tlxoifciydlm2uanmon(4tetrif3iy1lmDeanei (0 eumxo3oy4olenlfetls sDtrxront1opxoif3ilsla emnmsnu4 rxomf3to1omt aueslt) ruoim io4alen iesltfsDrm(m oo4ale mf3tlt a2emn ont)trenmrcio1lp   n i s0srtoxm3iodllenmict t)s2rmu  ;o4oee ii3tytfa2rluvo;(4trxnxo3oo1fm r ueilt0 rxoio oo4olt  feilt  Duau o;u4optnmfetlt m2ua(mpn() exniociydoaD  ies;(0seuoxo3iydlmtnmfvt ( aDrm(r ;o0ole iicils m2ra( o (0 ltrir oa1op eaies t  rurxo3oo4optnlfvi ( sDuaurp;o1tpt ii3ilt a2ulu p;t4 ltoiocto1lp e neolt)s2to(m oodame  nesa(f rurxr no0texnmo3tydla2um(vs;u)arxoxrcty1oa eai o t)srtoim iu4lltemicil(faDrmuro;o0tlt ii3tat sDraump;(0altnxf3iadop eauei;( teur(o3oydam n fviatfs2umxm ;t4apxoifciad m elnms ()arxrxr ta1fp  aiei;t0 exm(o iydam e ncta()sDtr( ono0tpe mociatla emump;u)tltnioctodom  an ol() eurim3io1amte feiltf rtm(m ot4oltnifeias aDuluvsnu4trtnxo oadlpte neol(0seuoxr3no4lpen fetl( sDuru onu1tex  feilt m2ulnvo t0tlenxo3oodlpDr uei (0srtmio3nydamte nctat aDurxront1tet  oeiydfmDrmn p;t0teeoxf3oa1lpteai i t sexm(opoo1alt livs tf 2rrump;t0aptnii3iyt aDrlu s t0tltrxo3iytomt  u ols0t2uoim3oy4lltn nes (f 2tm(r nt1tle  icildfa umumo;(4arenxf tadoat li sls0 rxrxo oudomee ivi (  rurxm ;t1olxnmoeiasls2umumpnu0texnir3to1fpt luvsl() 2tmxr3oydam e ivt sfa2rmxmpot0tpxnioetadlm ul( onu4alerircoo1fpDe ues t)s2tmio3iu4olen nes t) 2uaumpnt1oexoii3ias a2eauvo;t4alenmfcty1fpt anei s srtm(mpiodapenlivtlsfsDrrxmo;u0oee iiciyd a eln p;(4artoioctydfatran o s trxmxm no1ap n fcsas) 2urx pot4tleo feiydfa rlumon(0aexoirctydlp rlneslt0srtm(o ou4ope lictas  Durxm ;u1aet moeiytfm2ran snt) lxoxo3oy1fptelueo;s s2umir3ou1om n netasfsDra(monu1oex  fciat m el(vsnt) rxnirctodom  aneo t)t2xr(o ny4ap e ncsl( srumxr no4alt mi3iatfm rlu p t4tlxrir ia1omt livo;() ruo(o iy4amt  ncilsf rum( onu0olxo ieiytfs umnmo t0texoirctydfa r nvols)s2tm(o oo4amtn ncsat arua(m ;t0aet iietatfm2rlu o t4tleoxf iytom  anei ()s2trxrpio1ome livtlsf Dumumo;u0olt  oetydfsDraumo;t0arxnif3oydfpD lies s0 2ur(r3nydoltelfvsl()sruaur ou4tpenifcilsfs2elump;(0 rxrmr3totfpDe ies s0 rxrxr3iydalenlfvtasf Dur(r oo4tlx ifctys aDemnmonu4 rxnxo oy1optraieolt0t2xrxmpiy1ole  net t aDtaur no0oltn icilsfsDrlu p;()aeeoifcoatfpD an o;s  2xm(m iy1om  mictlsfarrrxrpoo1aex iiciatlsDrl(mp;(4 lenif oodlateaneol(  eum(m iodam nmfei t)s2ur(  ;o4apt moctlsfa2rau p;u4tltrir3oydomD livs;t s2tmim oy1alenlfcias sDtm(r oo0oetnifetytlmDel(vp t)treoxr3iadfa rauvo ()s2xr(opoy1lpeemfvias a2ra(m ;t4aleo octydfs2ra(vonu0tlenxf3tadfm eai i t srtoxopiudlmt lnctlsfsrtmur ;u0olx mfciasls2ua(mp;t4aexnxociytfa e ueo s t2toim nu4openlfet ()aDtr(r no0alxo ietydfa umu ont0tlxrxf3todlm  lneo ( texr(mpou4lp elivias s2tmx ooo0olenmoetat m2elnmpn() eenmrcoa1lptr ivs s trxoxo oy4llee fet s) rtmx o;t1alx mietydlm rlums;t4 rerxoctatop  lu o s) 2tmxm3iu4omt lnvtasfaDtmumonu0tpt mfciltfmDemn s u) lerir3iydlaDeaneo;(0srtr(o3iu1lltnmncslt)sDrm(ro;u4oeeomfetydlm rmnmp (4tlxnmociotoaDrauvi t) rxm(r iu4ameelneil()s2tau pot4apt  ieiytlm2rlu s;t4aleoiocoadfa r u i t0 2toio3oo1ol nmncsls) 2tmxmo;u1ole miciasfmDrln s t) eeoxf3ty1oatr nvo (0t2tmio3no4lpeemivsltf Dtm(mpot4apxoiieiadlmDra(vp;u0alxrmfcoatom   ivilt0 rtrimpnu4altemfesl()aruaxmp;o1tetnii3iysls2uaump (4texnmf ty1omD  ueo;( trtm(r3iu4amt mfvtltfsrraurooo4ole  ociltfa2em( p;u4texrio iy1lpt  i slt)setrim iy4ame lnvsls  2taur nt4tetomietatfsDuan snt4tltoxo tatlate u sls  rtr(rpiu1omt mfviat s2ra( onu1alt  oetaslm2um(mp t0tltrioctytfm eauvs;s)trur(r3iy1ap  lfci (  Dta(rpou1oltn feiltfs ea(ms u)areoxf ty1fp e uvol(0t2to(r oodlm emiesat)a2rmx pot1aleo ictltls rlu s;u4 rtoif3iytoatranvs t0t2toir ny1ll  lict ()srra( ont0aeeomociltfm2rm(vs u4arenio3tydoateaueo;t0trxr(rpoy4alt lict tfaDrmur ou0tptnmocildfs2rl(mon(4alxnmf3totoatrlueols seuo(o3oy1alee icia(faDua( p;u4aptnio3ildfaDea(mpn(0 exrir oy1oaD lu i ( teto(o iu4op nmfctls srtmumpno0apx  f3iys m2emu o;(4 renxr tatlmDrlnei (0sruo(m3oy1ll nmneta( a2urumpou0aex if3ias s raumont)aexrmrcootlpD lies s0srumxrpoy4amt lncslt)a2urxrpou0tee  oeilslm emu s;t)alxrif3ta1omtr n s;t)srtmir3oy4altelnetl( aDum(mp;t4opxoifeildfsDul(ms (4 exnir3oy1fat auvi;(0t2uoio nudll  miviat)a2uru o;o0tlxnmoeildlsDem(mpnt4trxniociotoate nes;(  exmio3iudol n nvsa( sDumxmono0tlxniieiytla2ua( on(0altrmr3oatlatrli olt s2tr(m3iy1ol nmivil( aDrr(r ot4tet mf3tysfs eanms u)altoio3totomDeanei (0texr(r iu1lpenlnesas s2taum no0alt iociysla uan s;()aetrifcia1fmtr ivi (0trtm(r ou4lmee nctlsfaDrax poo1apxniictytfaDranms;t)artrmo ta1optraivi s t2trir oydam nlnvtasf 2tm(rpnu1oexo feiyt a2rln p u0altomrcio1oatr ivilt)srtmim3io4alt mnctl(  2trumoou0oex mfcias m2umn o;t4 rxrmocoydfm rln s;()seto(r3io1am nlfet s)artrumoou0aleo fciatla2elums;()artoio iatomteaues;s s2tm(mpiy1ole  fci t  rrrxr nu1aeeo o3tlt a ulnms;t0tltnmr tytlpt aueols tetoxr3iu1omte nvilsfa2tmx pou0tptn ieiadfsDeauvonu0tetnir tydomDe i s t) 2xo(m oudaltelnvt ()sDua(m oo0texo octlsfs2rau o u0 eerir3iydfmDelnvo t tetoio iodolen neslt)aDuru ooo4tpenmi3tasls2ulnvp;u) renmf3oa1lp  aueo (  2xmxo3oydom nmnvia( a2taum ;o0teen ietaslaDrl(vsnt4arxoxr3tadfmDeaneslt  rurir oydolen ieiltfa2rrxroot0tpeoiietltfa rmn p;(0 rtrmr3oa1lp rlnvo;t) etr(m nodap  liei sfsrtr(r ou1optomfetydlaDrln s t) eeoir iy1opt anvs s0srtrxr iy1ol n fcta(fsDuru p;o4aexomf3tltfsDeau sn(4 lxniocio1oa rau i;( s2ur(m3iu4apen fesa(fsrum(mp;u1oeto i3iadls2ulu o (4tlxnir tydfatrluesls sexrxr3io1omtnlies () 2rrumpou1aexomfetlsla uaump;() lenxf iydop rlivi (0 rtm(opoy4altnlfcils)sDtrum oo1tlxo feiadlaDrmnmpnt4 eerxo tatop   i ols t2xo(r oo4lmte ieiat) rrm(m ;t4alto ietltla rln on() rtrir3oo1lp  liei t seum(o ou4apenmfetasf rrrxrooo0oetoio3tldfaDem(mp;(0teeniociydfateauvo t0trtrxrpoodomtelivils)artaxrpno0aeenioeild sDeau ont)trxnxo3ootfmDr neilt srxmio iy1om nlfctlt)aDumx pot1aexniietyt sDul( p (4aexrmr io1fat  neo;s)trtmxo3no4amenmnctlsfs2urur ;t1aet io3iytfaDrl( pn(0altnir oo1fa  anvols0setoimpiu1optnlnvt sfs2tmxm ;o4alx  ocils m2rlu s u4artrio3iotopDrlies t0sruo(r oy1olt mfvtltf ruaxrpnt4alt  f3ildlsDra(mpnu4 rxnxf3tatfpDr n o;()srtmir ny1lle  fet () rum(moou0oleomoeilslm2el( s ()aeermrciy1lmDrau ols0 2xmir3no4lp nmnctl( srraumo;o1apxomi3tasls2rau p (0trerxfctotoa e nvs;( t2xm(o3ou1altnlivi s aDtmxroou1oetomi3tltfmDranms u4 etnifcia1opDeai i;s0 2toim3oudoltemivsl(f Drr(r nt0oee mictasfm2eluvs;() lermo3oy1op r uvols) rtmiopiy1lp  miviasf 2umxmpnu0oeeo i3ild a uanms ()tetnio3iydfpDrluei;t0seto(o iydlm nlnetl(fs2tm(m ;o4teenmfeild aDrm( snt4aexoxf tatfpDe u s s0s2trxm ou1omte ieiasfartr(mpnu4tptnmfeiys s rmu ont4trxoxr3ty1lp e ies;t)srxmxmpny4ome mivs sfs2rmx  ;t0tleo f3iydlmDumn s t)tlenmo tadfpteaies ( t2tr(mpio1optnmfvilt) rtax pnt1tee ifeiyslm2ul( p u)aetoxfcta1fpDeau ilt)t2toxo ou1olee netl()s2rr(  ;o0oeenmo3iadla2ulnvsnu0aeerifcto1fmt aivo t t2xrio iodapee fvils)a2rm(m ;o0oeeomfctltlmDra(ms u)altomf io1om  aieo;(0 rtrxm3oo4omtnmnvt ()aDtaump;t0olxomfciltls2ea( p;u)tlxnmo oa1opDrlueolt  2umim no4lmenlfet sfsDraxm ot0oeen f3ias s2rlu s u4 rxoio tytomt ln s () rtm(o3oo4apeelnet t)aruau pou0tpeomf3ild aDrmuvon(0 eerif oadlmtr i o ( t2ur(o oy4lmenmnetat arum(mpno1opt mf3tasls2emnmont0 rxrmr oo1fptr neo () 2xr(o oudlm n nei (fs2umumo;u4apenmf3iyd mDea(mp (4arxoxf3oodlpDelueols)s2um(m no4apeemiei t aDur( pnt1opxomf3ils m eauvont) eeniocoa1lpt livslt)s2xrxr ny4altemfvsasfs2rrx pnt0opeomoctatfmDraump;(4 lxnmf totlm   u slt sexm(r iu1ame lneilsfa2rr(r ;t0alto fciysla2uauvsnu) ltomfcto1oaDeai s;t0sexrim3nudol nlnetatfsrrmumpnt1tpe  octyd aDrmnvs;t4aetrifcia1lmDe ivols0trxmiopiu1amte feia( a2ta(m ;o1tpe iictatfmDrm( p (0 lerif tadlaD  ies t0 rtm(m no1om emiesasfsrumu p;o0tlxn fetlsfsDemn p;t0arxnxo3ty1oa eau o s sexmxm3iydlp e fctl( aDraum oo0tlxnioeiasfm2emu snu0arxrxo3oa1op rauvsls0 exo(r3iodom emietlsfaDurxrpot0texomf3iyt m2rmuvs;t) exomocoy1lpt lies;(0 etrxm io1ll nmictl() rtm(rpno1ope ifctydla uauvonu0aleoif3oytfptr nvo t)truoxo iy4om e nvsas) rrm(rpnu1tlx  o3iydfa2ea(ms;t)tlxnmfciatfmtelnvil( s2uoxr oy1al  lnesas)srrmx ont0tpe  oeiatlaDrm( s;u4trerircoy1fa rln o;() rtr(rpnydamtelivilt)aDtrx ono0olx  oetasfa umnmp;(4arxomr iatomt lueo (  2to(opnodaleemnes tf 2tmurpnu0aee  fctlt a2emumsnt)aeerxoctotopDrluvo;s0seur(o iy1lmenmfci t)sDtrur ;u0tex  ictytlm ul(vp ()arermf oadfp ean slt)srxoxo oodolenliciat) 2rmumooo0oex if3iysfaDea(ms;()teerxf to1fp rli ilt) 2xr(m3nudoltnlivtatfarurx o;u1oex  fetadla rmu p;t0 lerxf iytomteln s (  eum(o3oy4lm nmiesl( srua( o;o0aleo f3iltlmDemnvo;u)teeoioctotomD an i;s) rumiopiudlleelicil( srtmum ou1alxoifetatfmDuluvon() rxrxr io1om eaieo;t s2urxo ny4am nlivi ()arrrumont1tptnmfcilslaDua(msn()aetnmo3tatoaDeliei;t  exo(rpoy1ol  lnvt tf 2raurpnt1aetoiocils sDrmn snu0 rtoxo oy1lat aivs;(0sexrim3iodlmt  fvil()aDtr(m no0ale  feiadls rl(msn() lxomf iy1lp eauvsl() 2xr(r io1ap  lfeil()aDrrxm ;o0teenmictytfm2eau o;t) rxrxrciytlmt aieol( setrxmpnodlp  mneta()a2urx poo0olxnioeiatls raump;u) etoxf3io1fatrlueil()teto(r3iydopen nvsas  2rm( pou1tee ioetyslsDea( o;(4 lenmocio1oa   ieolt0t2tmim3iy4opte ivia(  Dtmxr ot1aex mf3iyt m rl( o t0texomr iodop  li slt) rum(o3iy4oleelncsltfa2umxmo;t1alxoifciyd a2rlumpnu) exrio3iy1fpDeln ilt0srumxopno4lpe mnvi s sDra( o;o0opto ieildfsDrl( o t4texomf iy1op eaiei s)sexo(o oy1om elfetl(farrru pot0oex ii3iydfm2el(vpn()aetrir oatla e n s () 2ur(r3oo4al  mivsls) rrmxrono4tet  ocildfmDua(vo;t4tlenio3io1fa r ivi;s0 eumim oo1ol e nvil()artrurpno1aexniociytfsDrl(vo t4tleomf ia1lmt livsls)teur(o io1lpe mnvsl(fa2umu p;t0aptniietydfa ea(mp;u4 rxnxr3iatomte neils)srtoio3iydlme livtat a2ua( pno1oltnmoeildls rmuvpnt0 ltrxr oadopDeaivi;s)srtm(r3oudapenmicsl(f 2taxmoou1apeo fciadfs ua(mp;(4arxnir3iydomtr uvils tetmimpou1al nmnvs s  Drrxrpou4olx  fciytfmDrm(mp;t4 rxnio iy1fa e u o (0srumxopoudaleemfctl()s2tmump;o0tpxo oeiadfa2rlnmpn() lxnxr oy1omDr u slt) rtmir iudap n nci sfaDtr(r ot0tlto ieiad sDrl(mpnt0trtnirctadlpt anvo;( t2uoirpio1ole  nei t)a2raxrp;o1opxnmo3iadfaDeluvpnt0aexrircoadoaDrlu s;s0srtrxo3oodomt liesl(fsDumxm ou0tlxnmfciadfaDel(mo;u0tltoxo iadlaD  n i t)setr(o3oo1am   fvsltfa2rru ono1oex io3iyd sDrluvsnu0 etrmfcoo1lpteaivi;s)setmir3io1lmt mnvi ( sDtaxrp;o0aexomiciysfmDra( on(0 lenmfciy1lmDe uesls)srtrio nydap e nvs t)srrmu o;o0aptomo3iysfs2ulnmo (0 rxnif oa1la r ivs;s)t2toiopoo1ol nmnciatfsDrrxrpno1aptn o3iydlaDua(vs;()artnmr3iytoa   i ilt)s2uo(r3oudlltn nctl(farrmu ooo0oeen feilsls rln pn(4altrio tydlmtranes s) ruoxo3oo1aptnmnetat arrax  ou1oee  o3tys m2eanvp;u4aetrmf oytfm rlueil(0t2xriopnodale lfcils) 2rmxmono0tetnioeilt s2rluvo u4trermoctadlateln o;()srtriopiudale lnetl( sDtrump;o0olt mo3iyt a2el( p u)alxrxo io1fptr ueol(0t2um(m nu4llt lnct s) rrmuro;t1apx  iciyt sDemnmo t)artrxf iadfm eai i s t2xoxrpiu4ap elneil()s2rrurooo0oetomo3ilt a um(vo t4 lenxfcoodlatr u sl( s2xmxm3ou1lpe mncta(  Dtm( oou1tlenmiciyt m ra(mp u4 rxomf iodoaD  i sls) 2trirpiudomt lietlt)s2tauronu1oet moctld aDemn p;(0 etnifcia1oat auei;(0trumxrpnu4am  mfeil()srtr(ro;o0apt mfcias mDumnmo;u4 etomrcoo1lp eluei;(0 2trxr3nu1lle mfvils aDrmumoou4oexn iciad m ea( o u4altnxo ty1lmtraieolt  2xrxr3nudopenmfvta()sDrm( pnt1aet mocildlaDeaumo t)trxomf iodfm rln olt0 rtmim3iodaptnmivsa( sDumu poo4oetoifeiydfm emnvo;t4arxnmfcio1fpDe n ol(0texr(r oo4ll   fvtls)a2rr(mpno4oee  i3iasls2emnvp u0trxoxoctydom   uvi;(  rxrir3ou4lmte ict ()aDrru o;u0opxnmoctydls2eanmp;()trerif3oo1omDeaueo (  2toio3ou1om emfvs s sDurxront0aetnio3iysfm elnms;(0 eenxfcty1oaDe ivils)texmxr iy4llen fcias aDrr( pnt1tptnmocilsfaDem( on()areomo iodoaD  ivo;s t2xm(m oodlleelnvsls  rrm(mp;o0opxnmoetldfm ul(vsn() eermo3ta1lat liei;t)trtmim nodamt  ncsat)arua(m nt1optnifeiltfa elnvo u0alxrio tydfa   neo ()s2to(mpio4altn fvslt  Dtrumo;t4aexnmfctat mDuau p t0 leoifciydopDrauvi () exmxrpoydope  netat)artruroou1opx  fciytfmDrmuvon(4 lxrxo3ta1laD anvo (  2uo(o3iydop nmieil()aruaur ;o1tpt io3iyt sDea(mp;t)trtnmr oatfmt  ueilt)setrxrpoodllenmnct tfs2tmumont4aeen o3taslsDumu pn(4trtnio3iydfp  anvi s0srxmio ny1omtelfvils  rua(m ;o4texniocils sDrlu p u4trtniociodlpDe ueols) etrim3nu1ole  nct ( a2rr( o;t4oleniieiysfsDuan pnu4 rtoxfctydfat  neils s2xo(opny1lptnmicsas aDum(r ;u0tpxomi3ias aDulnmp (0tltrmr tytfp eanvi ( seumimpoy1lpeelictls a2um( oot1aleoii3iytlmDean o;t) etnmo3ootoptelnvs s t2xmir3oy1lpt lici s) rumxmonu4oex ifetltlmDulnmp t)tlerxocoo1op r uvi;s0 2xriopny4lle liet t arrr(ronu4apt mfciysfs ulu pnt4 ltrxf3iotoptranvilt)setm(o ny4lltn neslt  2um(r nu4tlx moctld m ra( o;(0trenmf3iotlat livi t) eurimpnu1lm  lnes (fsDtaxroot4olenmo3iys a2ra( p;u4trtoxfctodlaDrlnes;s)s2urxr iu1ome miet s)artrxm oo4apto ictyd a ua( p () etnxo totlp r uvsls  etrxmpnodllt lfvi t)s2rax o;u4tpxomoetltlm uluvs (0texomr3ootlp  lieslt0teumim3oo4amee ivslt aDuru  nt1optomf3tls a rmump t4 exrmfcty1opte u o;(0 exo(r3ou4llen ictl() 2um(m oo4olenmiciat s2emnvo u0 ltrmocto1oate nes t0srxrir ny4omtnmict ( a2tm(m ;u1apto feils aDrau onu4 eeomfcia1optranvs t)srxrxm3iy1ap  mfvi sfaDrmu pno1alxomf3iydfs2em(ms u0artnif3iodfp  lueo ( t2xmirpnodaptnlfcia(fs2rax  ou1texnmoetytla2emnvs;t0aeerxrcoa1lmDelueo t)s2toir3nodomt lnei ()s2tmxmoou4aexo o3iytla eau ont4alxnxfcty1om  lues t0 2xmim io4ap nmfvs sfartaxm ou1oetomoeiyt s2umuvpnt0 lxoxf3io1laDrauei;()s2toxrpoy1lp elnvi ( sDrrxrpot1alen fciltlaDea(mo;(0teerxoctodlmD aivsls  ruo(r3iu4omt  ieiat s2tmu onu4alenifetad m2umnvs;u4arenif3oydla ean ils  eum(m no4lpeemfvi ()a2rmurpnt1oltniietad a2emn p;(4tetoxf ootfa  lnvo;t  2to(m oudam n nvia( aDuru oot4alxoiieiytfa ea(mo;u4artnmr3iy1laD anvi t)sruoxo iy4am nlfcil( a2urx  nu4aetn ociyslsDrlnvs;(0tltrirciytfmDr nes;()sexo(r3nu1ope lfcsasf 2urx p;u0alxoio3iasfa ranmp;u)tltnxf3iadfm e n o;t)setrxo3nu4om emnct ( s2rrur no1tlto o3ildfmDua(ms u0tltnxr3oydoptr uvs;s)trxrxrpoy4omt mfvs ()srtm(rpou0teeomfciydfs ulnvpnu)trtnmr3oydfp r nvo;t0 2xrxo nudape lfetas)srtrurp;u4tlx  fciadfa emuvp ()treomrcootomDr u o;s tetriopou1ameelicta( s2rrxmono0alenifciyt s2rmumpnu0tlenif oodlm eanes;( texmxo oo4op nlneiltfsruax ont1alxnmo3tysfs ul(monu)aleomr iytlp eanvsl(0 2umxr3iy4lp emfciat)s2rrxronu1apen ociydlsDrlnvonu0aetoio to1la eli o;t  eumim3ou1lm emfvilt a2urx  no0tlto iciltlmDelumsnt4 etrmfciatoa rluvsl()tetmiopny1lme lfcsas s2tau oot1alxnmo3iadls rmuvp u4tetnxr oy1laDrln i;t0 2xoir3nydlle  ieil()s2um(mooo1texo ietadla2eaump u0 renxfciydlmD ln i s)t2um(m3nudoleemnctat s2uaurpou1tptomo3tytla2rlu pnu)arxnmf tytlatr i ol() 2to(m3ou4ll  lfvs sfaDurxrooo0olt  iciydls ran s;t4treoxf totop  au i;s  2tmim oo4optn iet tfarra(mpoo0olxo oetatfm2rm(ms;u4tleomrcto1la  anvs;(  rtoirpno4lmeelivs tf 2trur ot4altomoeilslm2emump;t)arerio3totlpD lneo ()trtoim ny4amt lies s s2tru  ou1olxomf3tlsfsDuaumsn(0trtrif iatfmD lu o;t)trtoirpnudoltnlfeslsf rrr(ro;u1oeenii3tls sDra( onu)tlenxfctodop r ues;t t2xo(r3iy1opt  nci sfs2ur(roou1aetoioctytfs2rlnvo t)alenifcoa1laD auvi;t)srurxmpiu4amt mnetltf rrrumo;o1aeen ocilsfs2ra(mp u4trtoiocoodfatrln i s  rxo(mpou1lp nlnvt t aDrau  ou0ape  ociad aDrmnvp;(4trermrcta1la   i o () 2xrxopoy1ope livsas) rrr( o;t4olx io3iytlaDrmn onu4trtrxo3ia1opte uvi s teumirpnu1alee fvsa( artrxroot4olt ifeiatfm ranvsnt4tlxrifciodfatranesl() rur(r3iydolte icilt)sDuau  no0aeto feilt aDemnvont4teenxoctydoa  aies t) 2xoxrpny4optnmncil(fs2rmxmp;u4opx ifctytlsDuln p;(4tltrxf3iadoaDr uei (0srxm(o3nydomee nvsa()sDtaurooo0optoifeiltfm ra(vo t4tltnxr ia1fm e u ilt)sexmxo3iu1ll n feiasf Dum(r ;u0ope mi3tad mDrmn p u) lenmf3ia1omtr ieolt0texrxo iu1op nmncsat  rrmum ;u4alenmf3iytla rmu s ()artnxo3to1fmDrauei t)t2trxo ny1llee nctl( srtrxmpno1tetnii3tytlm2umumont)areomr ootom  luvs (0seto(m3ou1lptn fet s arta(  ;t0oex mf3tas mDra(mp;u0 reoxo3to1lp r nvi t0teumir iy1op nmnctlt)s2rm(monu1texnmi3iltfmDua( s () rxoir to1lpDeanes;()seurxo oodalenmictl(faDtmurp;o0tlt ii3iysfa rlnmo;u0aleoio3ootfp rlnvols tetoxr iu1ap e fctat) 2tau ooo0aet mi3tlsfm rmu s;(4areoxr3tadoa eauei;(0texmio iydapen fviatf 2rrumo;t4tpxn f3tydfm2rlu onu)arxrxrcoo1oaD au s s) rurim3no1op  lieiatfsrta(mp;o4opx mi3tydfa2ea(mo;(0trxnxfcoo1omDe u slt)setrxr3io4ameemieia()s2tr(rpoo0tlenif3iydfm2eln p;t0 rtrxo3iodopt ai i;s)trtrxm3io1open fvsatfaDum( oot1tetoio3iad sDrl( s u0trtoir3iotlp rlneo;(  exr(o3oudlp n nvs s  Dtrxr ;o1opxoioctlslaDean pnu4 lxrxr io1la r ivs s0srxrxrpnu4oleelictasfa2tm( p;o1oexn fetlt a uau snt0alxrio iatop   iei t)texoirpoo4openlnvi t a2taxront4oee mf3iadfaDra( sn() renmfcoadla  aieo s  2urxm io1ol  licta(  Dumum nu1altomfetasfs2rmu onu4teermfcootlpt  nesls)trur(m nu4op   icslt)aDraxro;u0opeo i3ias a2elnms t4artoio oatlaDelnei;t0sexriopoydapeemnvsat  2raxmo;t0texomi3tltlm2emnvsn(4tleomo3iytlptean s;s0 rumir3nydolt  iei s a2ra(mooo4olxn ieiys aDrmuvo t) lxoxr to1fa ran o;(0t2uoxo nydamtemnct (  2rmur ot0tlxn feiasfs rmu o t) rtnmr oadomtrau s;( t2uoio oodolen neias)sDum(  ;u1aexo feiltfm rmnmsnt4artomo3ta1opDr ieols0teto(r iu4omenmivsl() 2tmx pot4olxnmfetlsfmDrln ont4artnxociadlmDr u ol(  rxo(m3nu1alt  ivtlt)srumu o;o1tpeo feiadls rluvp;(0 reoircootom   neilt)t2tmxr ou1lpt mici s arta(  oo4alxn feiys mDuanmo;t) rtrircoydoat  ivi;s teuo(m iodlp  lfcilt) 2tau oou0aexoifcias a2rl(ms;u4trerxocia1fp  luvi;()s2trir3nodoltnlieilt sDurxro;u1olto ociyt sDem(mo;() etrxocto1la  aneo;(  rtmirpny4opeemnviltf 2raur nu4ole  ietyt sDuluvp u)artnmfctodfmDrai i;s) ruoim nodole lnesa(fsruaxmpno0tpen ociyd a emn p u0 eerio tydoaDr u i;t) rxmxo iudame mict s  rrrxr ou0alxomo3ilt aDrl( s u) etnxr ty1oat aues s)t2uo(o3nu1am  mfvt () Dumumpoo1apxomoeiasfa eanvo t) eeoxf iy1op e uvo;s truoio3oo1omtn neiatf rrm(r oo0altniocild s2eluvpnt) rtoxociy1laDe nvi;s)s2toir3oydame  fct (fsDumu o;u1oeen ociys m2ulnvs u)trxrif3tadlm r ieo;t0trum(o3iudom n ivia( arumump;u4tptnio3iytfmDran s;(0 rxnmr todfatrln s s)trxrxm iudopt  nviat) Dum( pnt4alxnifciytfs eluvon()artnxr iytfaDeli sl( tetoxmpoydopeemfetl(f rrau  ;o1alxomoeils m emu p;u0texoif3tadfaDeluei s truo(m3oy4omtemnci t)s2um(mp;t0tle ifeiyd a2rmnmp;t4aexoxf iotlatrlivo (0t2xoir ou4lmtelnvsl( a2taum nu4olenii3tysfmDumn pnt0trxrio3oa1fpD  ieil(0truoir oo1ame lfvilt)sDua(mo;t0teto octlt m2rm(vp u) rxomr3oytlmte u ols) exoir nu4omeelfcils)srrmumpnu1aeeoiictatls rm(mp t)tltnxo todopD  nvi;(  exr(o3iudamtnmivtat s2rmxr nu0aee iieiasfa em(von()trxoiocoodoa rln olt)srxoio3no1lptn iesl(f ruaxmp;o4opx  ietadla2umuvo;u0teeomo3tatlp rau ols)trxmxmpnudom  lncilt)s2tr(rpou0alen fctlsfaDrl(mo ()tltrir3ootfaDean i;()teurxo iy4olenmnvsas srrr(m no1tee mf3tldfsDrlu o (4 lenmo3iotopDe ieo s0seumim iu1opeemieta( srtaxmooo1tpeomfciadla emnmo u)aexrio3oadfmtraueols t2xmir3iodal  mivtl(faruaxmoot1oltoiociltlsDrmuvsnu4aetnxocoatfmt lnei;()s2tmxm3nudlme mfct t sDurxr nu1opxoiiciyt sDul(mo u4tltrio oatopD luei;t0 2umxm iu1op elfctl(faDum( pnt4aexnmiciydla2elums ()aleoxr3todoat luvo s) exo(r iu4am  lnei sfaDtm(mo;u0olxnmfctasla2ulnvp (0tlxrmo3iatfp  ln o t0 2xmim oydoptn ieilt  Drmum ;u4olenioetaslmDuln on()artniocoytomt  i s (0sexriopoudlp  lnvia() r
\ No newline at end of file
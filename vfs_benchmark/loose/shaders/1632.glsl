@@ -0,0 +1 @@
+i i t  etmio no4ape lfcia(f Dum(r no1aptoif3iyd a2umu s t0teerxfcoy1omte n i s0 eur(m nodol e icils)srtru o;o1ape  feils mDea(vsnt4 lxrir3iodfp r iei s seum(m oy4opt lict ()srtm(  ;t4alto fetldfs ulu pn(4 eeoxo oa1fpteanvsls)teur(opiydopt mivsa(fs2rau pnu4tpeomiciyt m2em(vs;()tltrif oatlpD  neols t2uoxr iu4am nmnvt ( artaumo;t4olxniociadfs emums t) eermrciytoaDraivs (0s2xoio ou4ale lnctl()srumxrp;t1olenioeils aDuanmo;u)aetnxr to1omtean s;s)t2umir nodomt mncsas sDraumont4tex iietlsls em(mo;(4 ltrmociy1latraieo;s s2xrxopiydopen ieslt sDraxront0aeeoiieiltlsDel(vp;(0aexnmf3tatlp rlues;s trto(r3oydom elnvtls  rtm( p;t0opxomf3iydfa el(mp u4arxriocto1lmDeli il(0srxr(o3oudlltnlnei sfsDurum nt0aptn fciytlaDel(mpnu)trxoif todfmDeai o s trtrxo iy4alenlnei tfsrua( poo4teto o3iatfs uau s;u0 renif todfaDr neol(  ruoir ny4lp   ivsas  rrmu  ;t0opxniictlsfm ea(vsn(0treoifcoodfat aivs t0 rtmir oo4om  miviatfs2um(rooo0apen o3tltfs ua( s u0alermrctodfpt  nei t) exo(m oy4optemnvi sfa2rmx pnu4tpt  o3ias aDemnvp;u0tlxnircoo1lm elnvs;() 2toxo nydlpen nvia( sDrrurp;u1aetnif3iltfsDeluvp t0 reniocoytlatrlu sls trur(m3iudopenmnviat)srrmur nu1aptoiiciydlmDuluvp t4treoxr oy1fmDelieolt0s2xrxm3nodapt mivia(faDururo;t4alxomfetls m2umu pnt0aetnmocio1opDrau sls) 2urirpoo1al   ivi sf Dtmum nt4tpxo octlt aDelu o;()aeenmo ta1oaDrliei;t)seur(m iy1lltemfctls) Duru  nu1oexoif3ild aDelnvonu0 rermo3iytlmD auvolt srumxm nodlp emnviat)a2rr(ront1opxnii3tltls eanmp;t0aexrxr3iytomDean i (0t2uoio io4am emiet ( aDua(rono0teeomoctyd m2raump u0arerio oodfp  aivslt)texr(r3oy4apee fcils s2rmump;u4opxomfciytlmDel( pn()trtnir ta1laD anvilt) exm(mpou4apenlfeilsfs2rr(m ou0alto octyt s2ua(vp;(0 rerxo tydop rlnvsl( tetoim3ou1apte iei (f 2um(mpno4aee mictysfm2umnmo;(4arxrxf3tatfat  uesl(  euoxm iudaptemfctasfsDrau pnt4tpt  i3tld m ean onu0alxnioctatlmtr ivo t0setr(o3iu4omtn feslt sruaxro;o1alx  o3tld m2ra(monu4trxrmoctadoaDraneolt)seuo(o ou1ole mnvt sfsDtr(mp;u0oexomicils mDelnvsnu0 exrmfctadom r n s;t0sexrio3iu4olte ivil(f Dumxrono0tetnmo3tasfa2ua(mp;t0 lxoxr3ty1oaD  nvo;s0trumxopiy1llen iei s)a2taumono0texn fetltfaDrau snt4 lxrirctodfatraieol(0 2xmimpiudlmtnmnetat) 2umxr oo0aetnmoeilsls2ea( s;(4 leomo ia1oa elneils)s2umiopno1lpee ivtlsfsDumumpot1tlx iicilt s2em(mo (4 etnir iotoaD lneo s0 2to(mpoudlmtelnvs (f Drr(rp;t4aexn ieiad aDum(mon(0arxomf oo1oa   ieo;t s2trxopnu1om  lnvsl(faDtm(mpou1olt ii3tys aDem( sn()aeermf3oo1laDrlu s;t s2trxr no1am  mieia(  2ta( o;t4tet  o3ilslm ra( p () exnifciatoa rauvo s truo(opnudlp nmnet s a2ur(r no1optoiociltla ul(vs u)tlxrio ty1opt aneilt s2xr(o ou1alen iet t)arum(rp;o4alx moeilsfs rlnvo;t) rtoxo iodlateln il(0sruoir3io1op emics s srtau o;o1optnmfcildla eln o u0tetnxo3iytlmDelu o;( setr(rpiu4omtelivi ( aDurx pot1tee  ociasfs2uanmpnt0 rxrxo3totfp e nvil( seurxm io1om elieiasfa2ua(m nt4olx iieiyslsDumn s t)trerirciytomtelivi t t2toir3oodamen nei tfsDrr(mpno1oexoiociysfs rau p u4texrmf tatla r uei;s t2uoxr3ou4op n fvilt)srta(mpoo1oltnmi3tas s2ulu o u4teerxf3iodla  luvs;t0srto(r iu1apt miei () Durxrpnt1tet ifcilslm ul( pnt)alxnxocoodomtr ieo;t  etmiopoydlmen nvils  Dumx  ;u1alx  o3iadlm2ulumo t0alxnif3iatoateanvo s0 2to(m nudolte iesl(farrmum ot4oex mfcild aDuauvo u)tlxrif iatlpDe ieil()trxo(o iodlp emncsl( sDuau pot4altn o3iltfm2rlnvs (0 lxomo3todom  lnvi t srum(rpiy4aptnlnei t a2uaxroou4oeen ieiys a emuvo u4 eeomf3ootla  lies;t)seuo(mpno4lleelici (faDurxrpot4alx moeiat sDelnvp u0teerxr oatfpteaivi s  2tmiopou1lme mnvt ()a2rmu  oo0tpt iicild a2ul( o;(4alxoxo3oa1lmt aies;( s2ur(m3oo4ape  fvsltf 2umum oo0opxn oeiasfm ranvsnu4 exrio ootfmt li s s  rtm(r3nodop  lieil( sDtm( p;u4tpeomietls mDrm( p u0tlerxf iytlpDeai i (  exrxmpnodlltnlnesat aDuaxrpnu1tpt  ictldls ulnms ()aeenmr tytfpt lieo;t t2tmxr3ny4lme mneil() Dtmum ou4tlxnmfeiyd sDel(vo (0artrifcoy1oate iei s0texo(m3nudlmtemfvs ( s2urump;u0alenmf3tldla rm(msnt0trerxr oatopDr nesl() rtm(o3nydoltn ies s) 2rm( poo4tltnii3iasfs umump;t0alxnxocoatlp eliei;s0 exr(m3ny1ap e ict t)arrr(mp;u0opxnif3iadlsDemn sn(0arxrif3oodomDrlu s;(0seuoxo3iy4optn fctat) Duax p;o4aet  fetadls2uln pnu0trxnxr3oadlm rlueo t) exrxr3ou4ap   nct ( sDumxro;t4olxoioctldfa2rl(ms;()trenxfcootlmDraivi t0t2xoxopnodlmt mnvtls aDuaxmonu0oetnio3iyt mDua( pnu)trtnxr3iydlpDeaivo;(0s2uoim io1omte icils artau  nu1tlen fciytlaDeaump t) rxoir oytlmDeanei;t0 rto(m no4ol  mfvi s sDra(r ;t0alenmi3iys a rl( s (0 etomo3io1oatrlu i;s0trtmxm iydalt mfcsl(fs2uaxrpoo0altomfeiad m ua(vo t0alxnmoctytop rluvo s0s2xrxo3ny1openmictlt)a2raurooo4aeeoif3iatla2um(ms;t)teermocootfmteluvo;()sexoxopoy4altn iei t  Drr(rpnu0oeen oeiytlm2elnvp t)tetoxf3oo1fp e ivslt  rxoxm oydolt mfesls)srurxr nu0tetnmoetyd s2ran o (0alxomo iatomt livsls0 ruoir3no4lpt  nesa(f ruaump;t0olenmf3ilt s um( snt4aexoif iytfateaivi ()setrxo3oudopte nvtas aDtmx pno4apxn ociysls rluvp;t) rxoio3iatfate ivo (  2umio3nu4lpt mfetlt)aruauro;u4tpe mociysfa2rluvs;t) reomf3ootom eau sls0s2trim3oo1optnmivtat srraum nt4optn fetysfm ran s u0texnmrcoo1fm r ieol()t2xoxo ou4ame  ivi tf Drr(mono1tltn i3iltlsDeau snt0tltrxf iotlat anvsls0 ruoxr3iydom e nvi t) rtrumpnt1tlxomietyslmDrl( on()treomo iodfatr u s;()tetmio nu1omee nvslt) rrrxmpou0tetn ieiatls2eluvs;t)arxoxfcootfatrlnvs;s0t2uoxo3nudlpee fet () rtmxmo;t0aleomfciatfaDulumo;(4arenxf3tadfatr nei;t0 rtoxr ny1lpt livilt) rurxro;o0olxoio3iyt aDelump;()trenmr3oytfp raiei t setrxo oo4am emfcsat) Dur(r no4tlto f3iydfmDum( s u0 etoir3iy1om elivils0trto(mpnydom nmici t)s2tmurp;o4oex iietydlm rluvp ()artoio3iotfp eai o t) 2umxo3iydlpe mfvslsf rurxm ;u4tltoioeiys s2ulnmo;t4teerio3tatomtrluvils srto(opoy4lpenmivtatfs2tmxroou0tle  ieiysfm ua( o u0texoircoo1fp eln o;s sruoxr nu4amt  ict (f 2rmx pnt0oltomi3iadlaDua(mpnu4tetrxr tydopDelu o (0 euoiopiy4lme lneilt)sDtrxm ;u0tlen fetyt s2eaumont0 etnmr3io1optrlieolt  2umiopoydal elnctls aDraxrp;o4tlxoiicias a2um(vonu0areomf3totomtelivs t0 2umirpny4lpte nctat arurur nt0opto icild s uluvo;u)teenifcty1lpD anes;t0t2trim3ny4lpe lfctlt a2urumpno0opeomf3iadlmDea( s u) exomocootfm  auvols t2xoxopio1apen ncs ( a2tmumo;u1oleo icildfa2rmuvs;u) rxnxocty1oaDeauvo;s)seum(rpiudapenmiei tf Dtmumpnu0tlt  oeiat a ean snt4arenmrciydlaDr n o;()texmxr3ou1apt mncsatf rua(  ;u0optn f3tydls ra(mpnt0 rxomrctydlmt lu o;( srurim nudal  lfctl(faDur( ooo1oetnmoctldfm rmumont0tetnmo oatom  aieo;(  eurir3oydol e ict tfaDtm( ooo4tpenmfctltlm2uau o ()arerif iatfaDrliei ()s2xrxo3oodlmtnmfctlt)srtm(m ou4aee mfeilt sDumnvs;u0 lxoio3oy1lptrai o;(0 2uoir io1al nmfeilt  Durx oot1tlt iietasfaDuln pnt)arxrif iodlpDeluvi;t seuoxm io4ol  mfci (f rra(r nt0tlxoif3iys a rl(mp t0 ltnxrcoatom rlneo;t teumxmpoudaptemnetltf 2ua( ono1tpenmf3iyd m el( p;u)aeenxo ty1oateluvi ( trxrxr iodlpe  fvs tfa2umump;t1tptomfetat s rln o t4aeenir iotfmteaivsls t2xrio3iu1olte ncs t)sDuaumo;u0opxnif3iydla2umuvp (0areoxf3tydlptelueo ()tetoxmpiodlltnmfvs s) Dtm(moou1tet if3tytls2rm(vo (4arxnmr iotomt aivilt s2xr(r3oudomt  ietls  2umxr ;t4aexnii3iat sDemnvo;t4 lermr oy1fm r uvi s)sexmxrpnu4apt  net ()aDtmxmp;t4opxnmoeiad m2ua( p t) renmf3iatomt  nes;t s2umir3no4optnlicta(  rtrxmpou0alt mociysfs um( s;u0 etomf oadfp  auvsl( srxr(rpou4apt mfct sfa2uru pou0teeo o3iyd s2umu o (0areoxoctydfm e uvol( t2urxr iu4apte fes (  2umumpoo0tlxnmo3iysla umuvs;u0 renmr totla   nes;s) exrir no4llte nvtl( a2uaxrooo4aet iieiysfsDrm( o u0 ltrmf tytfaD anes;() 2tr(m ny1amtemfvt (f 2rrxmpot0teto iciadfsDuanvp;t0alerxfcty1lp r nvs s)s2tmiopny4om elneilt s2um(  ou1oexn fciadls2ua( s t4trtrmf3iadop  aneo t)sexriopiodol e fesas) rur(  ;t4tltoiieiydla ulnmont4texnxfciodlpDrlivi () ruoir iu4ope liesltfarrm(mp;o0tleo fetltfs2em(vsn() exomf oydlpt  i i t)tetoio io4al e fcsl(farumx p;o1tpxnii3tltfs rmu s;(0tlermf iadop  auesls0teurxopiodapeemfei t)sDur(rp;t4tltomoeiadfa uaump;t) lermf3oydlmt lu o;t0 rtoio iydoleemfvslt) ruau  ;o4aetoiieiytlm umu p u0tleomrcoytopD aiei t setmio no4ll e ieiat  rra(  ou0apxn i3iys m2uluvpnt0treoif3iotoaDrlies (  2xm(opiy1omtn ieils srra(mpno0ape  oeildfs2umnvs;t0alermo3io1faD anvs;()s2tr(mpnydlpe lfvil() rta( ont0altnmfciatlaDum( o u)trenxocoa1lp elieo s0t2xoxm oy1am emncilsf 2uau  ;u0aleoio3ildfa rlu snu4tltrioctytfmD anvo;s0 rxmim no4om e feilt) 2uru  ;u0oex moetat mDuauvp;u4 ltnir ty1latr uvi (0 rxoxm3iodllte fet tf Dur(ronu0texnmf3iaslm2umnvs;u4 rerxr3iotfpte ivils)trxm(mpnu1lmtemfviasf Drmur ot4apen f3iytfa ea(ms () reoiociy1omDelu o () exo(mpoo1olee ics sfa2tm( pno0tex moeildfm2uau p t4 reomrcto1latr ueo;t)sexmxmpnydlmenlicsls s2uaxmonu4tpenmfeiat m rln pnu) exrmo3todoat  ivi t0 exr(opio4lptemfcslt aDrmum ou4apxo i3iat s uaumonu) reoxf3oytlp r ivilt)srtr(o nydlptnlivs t sDtm(r ;o1apxomfctyslsDuau s t4aeeoxo3oy1fp eaivs t)seum(r3ny1lp  mnvtltf rta( oot0apxomfeiyt s2uluvs (0trtoxo3oadfate i s;t0t2uo(r3oodap elneils)s2ra(r oo4tpx  f3tydla2umn snt4aeenxo3tadop r nei;t0srtm(m3iu4lpe  nvs sfs2raxr nu0alxnmo3ildfaDem(vo () eeoio ty1faDranvo t) 2xm(m nydolt lfvtlsfs2trump;t0alxn fctld m umums t0texnmo todlmtrauei s)t2ur(o3ny4lp  lfei s) 2tmxrooo4aeeomiciydfa2uan o u) rerxo tydoat luvs t)setoirpny4lme lnvias  rrmu pnt0opx mi3tatfa2rauvp (0altnxf todlm rlu olt  eumiopoodam  mfcias)s2rmu o;t1olx mi3ild m ua( p t4arxrxr ootomtr iesls)srxrir3nu4om nlivt () rraurpnu4opx ifctltfm eau onu) rtoiociadlmtraivsl()s2tm(o iydopte ivia(f Duaxr nt4tpeomi3ilsls umuvp t)tlermr oydopDelnvsls seum(rpnudom elnvt t s2uaxmpno0alt  oeiyslsDel(mo;(0 reoxfciydoatr uvslt0trtoiopoo1alt  nei s)sDrm(rp;u4tpxoiiciydls ulu o t0aexrxo ta1omD aues s0teto(opoy4omtemncsa()sruax  ou4optn oeils a em(vs (4 lxnmf tatlm e n o t  eum(o3iu1lp e ictas)s2tmx  nt4tpe  oetas s em(mo;u0 eeoxo iotfm eau ols  2tmxm ou4ale  ict s)a2umump;u4olxoiocils s rln s (0texomfciydla r ueolt) 2trim ny4ap  lnesl(  rtmumoou1altnmi3iatfs2uluvsnu)artnmr io1faDrlnvi (0 rxoxrpnodopt lnvils a2umumont4aptoifciatlm2umumsn(4 rxoio3oydopt  uvi t) rxo(r3ny4lpee nciat)a2uaxrp;t0tex  ictlt m ran p u)trxnxfcta1optraieilt  eum(r ou4oleelivs () rtrum ;u4tpxnmfetatls ul(mp;(4treomocoodlpD liei t0seuo(o3nudal elivilt)artaur no0oex mociasfm2rmu on(4 rtrmfcty1oaD anes s  eum(mpou1ll nmfcsl(farrax pnu4optnioctas m2emuvp;()trtnmociydlpt anes ()trxmxopoy4olt  nvtlt  ruax pno1tpt ifeiysfsDrmn p t0trtrio tydoatr n o;s  2xm(m3nydlmte fesltfaDtrxmpnt4texn iciydlm el(vo;(4tleoxf3tatoate n o s tetoir iudlle  fvilt srrrum oo1tet ioctld a2ua( pnu)aeermo iytlpDelnvil()sexmir nudolt mieias aDrr(m no1oltn ictydfa2ranmonu4 etrxoctytopDrlnvslt)texm(m ou4omte icsas  rraxm no1oltnii3iytfs um(mon(4aexrmo3ty1lm  anes (0seuo(o3no4ape  fesl( s2taxr nt0altniictls aDeauvo;t0alenxo iodomD li ilt0 euoir3iu1al elnctl()sDrrx pou1oetoii3tadlaDranmpnt) eenifciatfp e ivsl(  etoio oydlp emnct tf 2raxr ;o1ale  i3iasfsDrl(vp;(0 rtrmf tydlp  auvs ( trxo(o ny1ll e fesa( s2tr(m ot0opxnio3ias m ean snt0artomrciydfaD an ils0trtoim oo4omtelnetasfsDtmx o;t1tltoioeiytlm elnvs;(4texnio3oo1fm   i ols texo(r3iy4lp   fvsas) rumur ou0ape ifeiytlm2rl( ont4artomfctadlm rau i ()truoxm oudlmte ivsa()srtru ono4tpxoiictyd m rmumpnu)teeoxf3oo1oat lies;(0s2xoxo ny1ap e ietlt)arrmuro;u0aleoiiciyt m2ran o;t4 ltnirciytoaDe ivi t)setm(opny4ope  icsas  rumx p;u0tpeoifeils sDel( ont4arenmrcoytfmte i s t) 2um(m io1amte fciltf 2uaxm nu4tpeoif3iadla ea( pn(4artrxf tytfmt  u s s t2tm(opnydom elnvi (  Draxmo;o0texomfeiytfa umnms u) eeoxfctydfpDe uvsl( seurxopno4lmt  nvsl(fsDra( ono1oetomociatfsDrmnmsnu0texomo ta1laDrauei (0 rto(rpnodalenlfcsat  Dum( o;u0ale  iciysfa emuvo;(0teermfcta1fmt  ies;s srurio oy4opt lnvtas)a2urxrpnu0optoifciadla2el( s;(4trxrxr3oytfmDeai s s0t2xrxr oy1lm  micsatfaruru  no1tle  feilt s2rlu s;t4 rtriocoadoaDeliesl()teumxr iodlme lfesat)sDrrump;u1altnmoeiytlm2eluvpnt0tlerircoytoaDr u o (0srto(m nu4lmte ivil(fa2urxmp;o0olt moeiad a2raumsnt)alxrir3iatlptelu sl(0truoxo3iy4opt  ncs tf Dta(  ;t0tlt iociat s2rmn p;()trerxfciatla ranvi t teur(r3no1oleemnvia(f ruau pnt0opx miciys a2rmnms;t)trtrxf iadfm eaues ( seto(mpoo1oltn fvt ()a2urxroou4alenifeiasfmDemu ont0altomociotfp  au i (  2um(r ou4ale  fcs ()sDtmur nu0tlxoifetys a ulnvont0trtnxfctadomtelu s;s) 2umiopiydap nlies () rtm(ro;t1tpeomiciat a ea(mp t4teeoxrcootfpDe neolt sexmirpny4lmt mieiat) rrrurp;u0apx  i3ildls elnmo t4alxrmo oydlpDrluvi () rxr(o3ou4olt  iesa(f Dur( pot4tpen ociyd sDumn sn()tltoxo3ta1fpDe uvilt)setmim iy1lm n ivil(  rta(rpno4olto fcilsfm um(vo u) reomociotfm e i o;s0t2trxo3nu4lme  feslt)a2trxr ou1aet mfctltlm ea(mpnu)alxnio3tadfmt li i;()s2uo(opnu4alenlnvtatfs2tr(mp;u0teeomf3tysfaDuln pnu0trxoxrciatlm eaieil(0t2umxm iydllenmicsl(fa2umxmp;o4olxnmoetad mDrln p (0tlenir tydfptelu o (0 2ur(opio4op n nvia( aDtr(  ;u1opxo ictldlm uauvsn(0 renircoo1lpDeauesl()truo(o nodomtelneiat artax pot1ape  fcild sDranvo u0tetnmocoo1om rliei t0sruoim oo4llen ieta()arua( o;o1apenmo3tls sDel(vs u0 ltoxfctydfat  nvs s)t2to(m3iy1lm nmfetls)s2um( pno4tleo o3iatlaDra(msnu0 ltomf3oy1fatrlueolt texrxopoo4ap  lfctas aDur(rpnu4tpe moeils sDumnmonu) rtrir3iy1opD  nvils0teuoxm iy4llee ietl()srraumont1aptoif3tldlm rl(mpn()aexomo ootlp r ies;t0s2urxm nudapte fvt s aDua(m ot1tee  fctydfmDrm( pnu4alxrircty1fa  li s t  etoxo3iy4alee feia()srtmurooo0tlxnio3tydfa ranmsnt0tleomoctotomt  u i;t)t2xoimpou1apee iesa( s2trumont1tptomicils m2el( sn(4 etoif iy1lptr ivo;t  etrxrpoy1omtnlnviat aDum( o;t1tle mfctls s2el(mon()tltrxfcoo1fpD ai olt  2xm(opnydaptelfei ( srraumo;t1aet  oeiad m eaump;t)trxrxocoo1op rlnes t)s2uoiopnu4altemnvtlt srrax o;t0oee  oeiadfm2ulumonu0tleoif3tydfat aieo;t0srtrim oudome liviatfsrtrum oo1oetnii3tadfs2ra(mp;u0texoxrcoydfat aieo s  exmiopoo1lmenlfeiasfsDraxr ;t1aeenio3tys s rlu p;(0artrir ia1omt an o;t) etrirpiy1lmtemfci s) rumxmo;u0tltn feilt s2rlnvs;()alxrmf todop  lu s;t  2uoxm3no1op nmfciat srrax pnt0tleo f3tltfsDelump;(0aexrmfctatfp eaieols0teur(o oudape lnciat)srurump;t0aeen f3iytlaDrau s;t) lxrmr3tatoa rlneil(  etm(o ny4llt  ict (f Dtaxr ou0olxomoctys mDuan pnu0texoxo ootomt  nei t0s2xrxmpoy4ol e nvta( a2trx  ;u1tlto feiatlm2uau on(4tlerxo3ty1fa  ai sls  rtmimpny1amtn nctl(fsrrmumpot0oltoif3iasfs2raumo;u4altrmf oytfatrlu sls)tetmxr3oudop  livta(  rraurp;t1oeto f3iadlmDul(mpnu0aeeoiociatfm r ues;(0seum(r3oy1lp elfciatfsrrr(ronu4opx  feilsfsDean o t) lxrir3ia1fp  ln sls) exmio3oy1oltnliesl(f Duaxmpno1oetomociys m2ea( p t4 rtomo iotoptr n o () etmir ou1apeemneils s2umumo;t0alxnioctyslaDelumon(4 eeoxo to1lpteai i () rtmxmpio1lpe  fct s)arumx  nt4aeeo i3tlslmDeln s t)teeomo ty1fm r i o (0trxrxmpoodlpt lfeiasfarum( onu0texomoctltfm2rlnms;t4areniociytlmDeauvils) 2trxm io4ape micsas)arta(mpoo1aleomi3tysla ean sn(4artnxocoadomtr uvi;(0setmir3nydal emnci t s2urumpoo4olxnmfeilt aDem(vs u)aexnir3oo1la e nvsl() rtmimpnudal nmivsl()arrmurpou0apeoii3tld mDum( s u4alxomf3iytfm ranes ()sexm(opiodlp   fesat  2urxr no4aee ii3iytfm2emuvs;() renxf3oy1laDr uvil(  exo(opnudome  nvi (farrr(m no4oetn feiysfm rm( p u0aexnifcoytfaD anvsl(0s2uoiopoo4lmt  netatfartau onu0aetomf3tytfm2rm(vp;(4arxomf io1faD auvol( srto(o3no4lmenmnctat) 2rrum nu4alxo f3iasfm2rm(vp u4 lxoircoytlmDeai s;t  rtoxo3oy4olenlfcta() Dumuro;o0tltnmfciytlm2rauvo;t)alenifcootomtelues;t0 2um(o iu1lle mneta()sDtmxr ;t4tpeomi3ias m2rmumon(4 rtrio3tadfp r nvo (0s2toim3io1apt micil( aDur( o;o0apt iociytfm uauvpn()tetoxf oa1fmDe ieolt0srur(r oodam e fci t)sDra(  ;u0texo oeiytla ran s u4altnmr3totlaD  n s;() 2xo(r3iy1alen netls) Dua(mo;u1apeomfctys aDulnvsnu4aexoio3oodfp  aivi t)srxr(rpoydlm   nvtas artr(m ot1altn fetydls2eau sn() lxomo3io1fm e neo s) 2uoir oudamtemncs t aDtmum oo0tet ifciadla elnmp (0tlxomo3oytfp eanvo t0seur(m ou4alen ietls) rrr(root0opeo ocilsfa umnmo u0 exnmr oo1fa r i olt)s2uoxm iy4aptemfct t artrxronu4olxniicilt a2rmnvon()tlxomocoodlptraivol()trumim3no4lmteliei tf 2taxmooo1olx  f3ias aDumnvp;t4altoif ia1lm rlu s;s0teumio ou4lm nmnviat)srum(mo;t1olxn oeiytfa uaumo u)tleomrcoadfm rauvo t0t2tmxo ou1op  lnei t arrmu poo4aexoioctlslsDrmnvo (4arenxo3io1opD liei;s0 eurxm3oo1am n nctlsfs2ur( ont0ole ifciltls2rluvsnu)texrifciatoaD lnvo;(0sexo(r3ou1apenmfctat) Dumxrpno0oetnifeils m elnms;() etoir iodlp r u o (0sexm(opiodope livt t)arrmu pot1oleo oeilsfmDulnvo (4tlxomf3ootlp r nvi;()t2urio3ou1lpt mfetlt sDra(m oo4apx iiciat a2rl(mo;u4 rerir3oatopDeaivs;()sruoxo ny4lpenmieslsfarumu  ;u1oexo ieilt aDem( o;u0 ltoxo3iydoatelivi;(0 exr(o iu4aleemiesls)a2rr(mooo4tlenmociatfa eau p;u4tetrif oydfateai ols) etoxmpnu4am emnctasfsrtr(  ;t1alx mfetldfm rmnmon(4 exoxo3tydop  lu i ( s2uo(m3nudlptnmfcta( sDtaxro;o1aptnioetlsls2rluvpnu)alermr3iodlmD aues t t2xrxopiodopte ivt (  rtr( ont1aexomfeilsls ea(vo;t)aeerxfcto1fmDr nvs;s t2tmio3oo1ope lfeias)srtmu p;o1optnmietls a2ea(vo (0trxrio3iodoaDeai o s sexoxr no4om nlivtas) Drr(rpoo4oet  i3ias sDrm(vp;u4altomf ty1lmDr uvi s0 exr(m ou4ll nlfvt ( s2tmxrooo4apxn oeiadfa uau o;() lxnmocootom eluvi;t)s2xr(r3oydll nmncsltfarraurpoo1olxn i3iysfs2el(mp;() renmocio1oat aivs;( truo(mpno4lp  mfci ( a2raum ;u1altnioeild s2rlnmp (4artomf3tadomDrluvo t0srurxm3oydlptnmivsl()aDtrumo;u0tle  octatla2rmnvp u4aleoxrcoytfpD aivs;s)texm(m no1lmtn nesa(fsDrax oot1aleomieiasla2rm(mo;u0artrirciydom  li ols0srxrxr3oy4lltemfciat srrmx  ;u1alxomoctasfs umn pnt0 eerxf3totom   nvo (0srto(r nudlmte fcta(fs2rm(ronu4tpxnifeils m umnvsnt) etrxfcoy1lp   i slt  2to(o oo1ll   ieia()a2umxmono4apxnmf3iadls eln s (4arxoxr3iytopDrli sls0s2umxmpoydlpeelfvslsfsDuru  ou4tpe  f3iysfs2rlu onu0arxrxr iydfatrln o t0trurim ny1apee ies ( sDua( o;u1tlt mfciydls el(vp;(4 rtniocoytlmt  u o;s0 2xrxm3oy1openlivilt)aDur(m oo0apxnmfciys a2el(mo ()arxrmo3io1fmD lnvsl() eto(o ny4amt mneil(fa2tmu pno1tlxoifeiat s2ulnms;t0artnirctydlpDeluvo (0seuo(m iu1opeeliei sfs2uau oou0teeniociyt mDul( on()tlxrxo3oatfmDrai o t)srxriopiydope  nvilt a2rmxroou0ole mfctld m rauvsnu4trtomo3ta1omtr n o;(  rum(m3iudop  lfeil( srur(mp;o4opto fetld s rau ont4alermo oadfmt livs t0sexoxrpny4lleemnvtlt) rtau  ;o4olxnif3ilsls elnvo;t4 leoxo3ootfa r ivo;s  rurxo ou1ame lfctl(fsDrmu ono1oee moeils sDem( p t0tetrxf oytfmteli slt0srurxopoy4altelietlt)a2umxm ;o0tpxnioeiyt m2uan s t0 reoir oodfpt  u o;(0sexo(mpoy4lltelfvsa() rumx oou0aet  ociatlmDra( pnt)tetnxociydfp r u o t0 rum(o3io4ome miei ( sDtru ooo4tpxnmf3tld a rau o (4tlenmr3iodfpDe u il( t2umio no1llee fetl( aDrmumont4tpx ii3iasla2rlnmo;u4 lerifcia1fp  livo (  rurirpou1alen ieias a2raump;u0alt  ietldla2rm(vo (4texomf3oo1fm e ies () 2trxo nu4optelfviatf 2rmxmpot1olen ieias m2ulu p u4trermr3oytoatrau o;t trxr(o iu4alen fesas)a2rmuroou0oex iictlsfsDrm(mpn(0trtoxf ia1lpD aiesl( trxoxopoudomee iet ( arumurono4olen octltfm2ea(vp t4tetrmr oo1fptrlnvs;(  2xmim3iy1ame mnetatfarum(  nt0texo ociytla2rm(vs ()treoif3tytfp  lues s0s2toir no4lm  mfct s)srurum ;u1olxoifetaslm emnmo;(4 etnxo iy1laD  n i s setrxmpou1lle lnci sf 2raxmo;u1oetn fciat a2uanvp;t)trerif tytfpD luvo t)srumio iodomtemiei s)artm(r ;u1optn o3iytlm2rl( pnt4trenif todfmDe neolt)trurxopiu1lpt mfvs s  2taum no0alxniieiatls ulump;u)aexnxf todlaD li ol(0t2umio3nydoltnlneia(  Drr(  nt4opt  ociadfa2ul(ms;t4arxnifctotfaD  u s;( texmio iu4lm nmfctas  Dtaxm ou1tetnmfcilslm2umnvpn(0alxoio3ty1fa  aieslt  euoxr3nudaptnmici (fartaumono1aex mf3iat s2elu p (4arxrmr3oytla rli o s0t2uoxr iodop n fetls  Duaxr ou1tpx  iciydfm rmnvs;t) ltnmo iadla rauei;t  rtoxrpoudlp emncsls) Dtm(rpoo1alxnioeiatlm2umn sn()tetoiocoodoaDrlnei s)tetrimpiu1lpte fvslt sDua( oot1oeto ocilt s rm(vont4tltnxo3oadomtrlues;()s2toir nodale lnesat  Drmx ooo0tlxnmo3iydls2umumpn(0alxnmrctatfa elivolt t2xrxmpiu1ameemfesat arrm( poo0aexomociydlsDrmn p (0 rerirctytlmt ln o (  2toiopno4altnlivsls  ruaxr nu4altoii3iadla rlnvs;t)arerxf iydfm e i o;( srtr(r3iy1om   nei s) Drmur ;o1alx ifctys m2rl(mo ()tltrir3oydfa rlnvs;s  2umim3iy1lpee iesasfa2raumpot0aex  fciys sDeluvpnu0tlxrxo tatla r ivo t)texrxopiy4am  liciat  rurxro;u1apxnifctyt a ul(mont) lxrxf oatfpt  nei s)srxrxrpou4lp e fetas artrur oo4aex ifctlt mDranvp t4 rxrxrcio1lmDeai ils0sexr(rpou1optn fesltf rtrxmonu0alxnmi3iltfm rmnmp;t0aleomf tydlm ean ils0 rumir nydolenmivs t aDumu pno4apt ii3iytfmDrau o;t4 eeoxr ta1oaD auvil(0 rtmxr3nu1aleelfci t)s2taum nu0aexomoetysfmDum(vs;(0 lxoifcoadlpD ai s;()texoxmpio4lp e ietl()sDtrxr nu1tpenmieias m2rm(vs (4alerxf iotfmtraiei;t0teur(rpnu1lmenmnesa( a2urxroou0tpxo fciltla2ea(von(0 etoxociotoptrauei (0 exoirpiydll  livil( arrmu onu0olxn ociysfsDra( p;u)aetnmf3oy1lmDelu s;s)srumim3iu1omtelics t srrm(moot0ope iicildfs ea( p;(0 reoxo iytomte i s;(0 2umxr nydape licsatfarrrx  ou1tle  feiad mDem(vs t0teenmr3io1fmDe n ilt0s2xoimpio1lmenmnvtls  rtru p;o1aex mo3ias a em( s;t)aleomf iodfmD lnvs;t)setoxo3nydlp   ieia(f Dtru pnu1ale moctldfa2ran o;t0arenio3tytom rli sls  2trim ou1omt licslsfartmumo;o1aee ii3tyslm2ra(mo u0alxrmf to1lmDrlu i (0t2xr(mpiydlme lieils srumumo;t1aet ifciysfmDra(ms u)tlermo3to1op  livi;t)setoim3oo4lme  fesl( aDuau p;u4oleomieiadfmDuanmp;(0texnxr3iatfa e i i ()t2xoxrpnydop  mnes t aDumump;o4tltnii3iatlaDel(mpnu4trtrmo3oo1lm elneolt trxmxrpoo4ll nlfeils)s2tmumoou0tlx miciydla2elnmp () leoxfcia1opt auvo ()srtrim3iodomtn netasfarraxrp;o4ole  oeilsfa2eaumo;u4trtnxf3oytfpD lies s tetrxrpoy1lmtnmfcs (farta(ro;o1oet  o3tls m ul(mo;t) rtomo oy1om  li o s srxrio ny4lme mfvt ()aDtm(rpno0optoifciytla umuvo;()artoxfcia1fmtrlnvs;()teto(o ou4alte ncia(fa2ra(r ;t0oeen oetldlsDrl(vo;(4 rxrmf tatlp  aies;(0 exoio oydam nmicsa( arrmu p;o4tpx ifciadlm2ua( p;t4 etnircoatoatelnvi t0s2toxmpny1optnmnvtat) 2tax pou0oeeo o3tld s ea( o u4 etrmocoytoa rlu olt)trxr(o3no4omenlnvt sfs2tmur no4olxnmoeilsla ulnvp;t)aleoxfcoydom rli s;t)trxmxo3ou1om emivt ()a2rmxrpou4optnmfctysls2rm( o (4aeenxfcootoaDe ueo s)srtoirpny4lle  ietas sDtmxrooo0aeeomietadls2rm( o;t0teermf iytlp ean i s) rtm(m3no1amtn netasf rrrxm ou0altnmf3iydfsDumumo;(0aexrxo iadfpDr n i;s)t2tmxopno1ll elnes t)sDrru  ot4aeenif3tltfa2rauvp;(4 eeoxo tadom elivo;t) 2xrxmpnu4oleelnci t aDur(  no0alxo ictld a eluvs;()tleomocootfp  aiei (  rtr(rpnu1lpt lfcil(fsrrrumont1tleomictltfsDrlnmp (4tetoir iytlmtelnvi (0 rtmim3iu4lpt lncilt)arrax  ou0opxnifctlt s rmu pn(4 eeoif3iadop e nei;(0s2toxm3ou4altn neil(  ruax oou0opxn i3iydlmDrluvp t4tltrxfctodfmtran s ( t2umir iu4openmnesltf Drmx o;o0oexomoctld m em(mp;(0alenxr3iydopD  nvols) rxmio3iu4apeelfes t sDua(mont1tetnii3iydfm2rlnvp t0altrir3oytlmDran s (0 exrxo oodamt miei (  2trxronu4oet  i3ias mDrluvpn() exnifcoadomtr n o ()t2trio3ny4alt mietas)s2tru o;t4oeto o3iasls2ul(mo;t4trtnmf3iy1lpte uvs;(0s2ur(o3io1lpenlnvsl( aDta(r ot4oexn ociltlm rau s ()aetnmrciatomt  nes s0t2xrir oydlp emnvtls srum(  nu4tpxnmietltlm rmu snt)aetrmr3tytoptelivs s) rtoxr oo1llt liviatfsrtru  ;o1aleomf3iytla2eauvpnu4arerxf totfptrlieils s2uoxopny4omee nctl( srtaumo;t0oexnmf3iyslm eanmo (4tetnmf iy1faDeai i t) 2uoxr3oo4al emicias arum(rp;o0opeomf3tltlmDuanmo;() rtoio3ty1opDe uei (  exrir3iodlmte fvsat  rtmumono1oeeo ieiadfa2rl( o;t0aleoxo to1opDe u o s0t2toim oydop   nes ()artm( o;t1teen feilslsDul( s (0trxriocio1fmtelnvs (0t2umxmpoudlmeelivs ( a2tax pno1altnif3iad m2elums t0 exomf iodfm e n s ()t2xm(r3nudlmt livt tfaDtrx ooo4opxnmi3tlsfmDeanmpn(0arxnmf to1fp  ln i s)s2uoxm io1ol nlfvil( artaxmoot4texomo3iyt m2um(mp;t) rxrmr3iy1omtr uvil(  rumim ny1op e fcslsfa2rrur ;t4oeenii3iyt m raumpn(0artnxrciydlpDranvi (0sexo(rpoy1lptn fei ()s2trumpoo4tlenif3iad s2rmnvsnt)arerxf tadop raues;t) 2toxo3ny4op nmfvtatf Dumu onu4tetn o3iys s2ra( p (0 reomo3todom   uvol(0 euriopiudalte fciasfaDumxr nt4aeto i3tydfsDemnvp () eerxo oatla rai olt) 2ur(m3ou4lmtnmnvias) Dra(mpot1opxn iciatlm ul(vo;u0areomr tatopte i o t)s2trio no4lmte icslt)aDtrx poo0alt mfeiadfmDuanvp;() ltoxr3todomDrlnvo t) etmim iu4al  mies s arrmx pnt0alx  fcils m elnmo (4tltrxo3oydfatean i;() etmim3ny1amte nci t)aDuax  oo4tpe  fcilslm em(mo;(4artnmrcoa1fpDe nvs (0srur(mpnodolenmneils  Drm(  ou1tet ifciaslsDemumo;u4 eeoxo tadom rauei;(0srxrxrpiodol  lieia( srumur no1oeen oetas s rmuvp;t0tetomo ia1lmDeau s;t tetrir3oy1op   nei s  Dtaur nt4texo o3iydfaDum( p;t)alerxr3ty1oat li ol() euoimpoodlm elnei tfa2trx ono4tptoiietadfa2uaump t4aexrxfcto1fpt anes;t)teuo(m oo1ome  fei ()srum(m oo0oeto ociyt a2rmumo;t)aetoir3iotlmteaiei;t) rtr(o io4omtnlneia(f Durxroou1olxnio3tasls2rmuvo t) etoir3oadlmDran ilt trxr(m oydomen fvil()arrm(rpoo4tex mo3ilsfm eluvs t0tlenxf iatfptrlueo s0 exrio3iu4ap nmnesat)sDtr(r no0apenmieiasfa emnvo;t) exoxrcoytfaDr u i (  exr(o nodom elfcsas  rta(rpoo1oexo feils a elnmsn() lxnxf iadfpDelnvs;t  ruoxo3iodlpte fctlt  2rrumpnu1tptnmo3ils aDumnvp (0alerxrcto1fm  lnvo t0 etmio oy4apenmnvia( s2tr(  ot1aptn i3ilt mDem(vonu0tetoxo tadlmtr n o t0s2toxo3ny1lmeelfeiatfaruaxrpot4opeomieiytfaDemnvonu0teenxo oatom rauesl(0tetoxo3iu4om n fesls srumxrpoo1apt mf3tlt mDrmnvo (4 exnmocoadfmtranvs t0sexrxr3nu1omtemies tf 2rr( poo0opxoifeiydlm eaums;t)arermr totlp  liesl(  rtr(m iydaleemnesa(  rtaumo;t4tee mfctldfa2ea( snu)trxoxf3iatopDeluei s truoio3no4ope mnvsasf rumu p;u1oltomfciaslm2uau onu0 lxrio tytopD livolt) rtmxr3ny1lpe miet (fs2tau o;u1teto ictasfa um( p;t)tlxoircoydlm e uvi;t)srtoxrpiodll  lncsls s2raxmp;u4tet  oeildls rlnvo (4trxrio todfmt luvslt0trtoirpou1lm e iviltfartmx  nu0texnifcias a2rlumo u)arxrxfcoodfm eluvs s  2tm(m iydape mneiltfarta( p;u1optn o3tltfaDrau o t0 lerio3oo1lmteanvil( texoim3oo1ome  fcta() rraurono4optoiociydlmDuaumpnt0aeerxr3oa1lp eluvo (0 euoimpiodamtemict tfs2uaxmpot0oexo o3tyt s rlu pnu4treoxrctotfaD lu s;( srxoio3oo1openmfeia()aDumu ont4apxnmieiatfs rl( s;(4teeoxr ootoaDran s s srtoiopiodome  fcils s2um(m ou4opx iociatlm rl( pn(0 rxoif3oy1lpDeauvs;t0trtoxo3oodlmt  nct tf Duaump;o0opto octld a2um(vs t4trxoxocio1faD li slt) eum(rpnu1alt micslt)sruau p;t4tpx  ociadlm elu pnt0 rtoxo3iytlm  auvi;s)s2umxr3oy1alee nvs t) rurx onu1ope io3tysfm2eanmp ()altoxrcia1fa  ln olt0trur(mpiudalt mnet s arra( pnt4oeen f3iltlsDeluvsn(4tetomr ootlpDrlivol(0t2uoir nydaltemicsl(f rumu p;o4oeenmoeildfa ean onu0 etrxr todop e i i (  2toir3iydlltnmiesl( artmxm ;t4opeoioeilsfmDelnms;t)aexomrcoa1latr ieo (0 euoim iy1omt mnesas)sDtmxroot0oex  feiat m2umumonu)trtomo iadomDrln s ( tetrxo iodaltnmncs (fartrurpou4opeo fetysfa2em(mo u0arenxo iytoaD aivi ()srtrxo3no4opt lfvia()aDrmumpno0teto ociyd s2rl(vs;t) exoxo3oatlm r ueo;s srxrir oo4omtelict tfsDra(mooo1alenmietaslmDumn s;() etomo oo1oaDelnvo;t0 2uoxo no1lmt  icia( a2tau  ;o4oeenii3tytlmDeauvon(4aetnxo3iytom e ies (0srurir iu4lltelfvta()s2ra(mo;u4aptn iciadlm2uauvpnu0trxrxf3oadfpD  ieilt0tetm(rpnu1lpen neils aDra(ro;t0tlxn ietltfs ulu o;t4tetrmf3iodfm   neolt0 2xoirpio4ale lfvsls)sDumur ot1tpx mf3tlsls2eln pn(4 ltnif3tatfm   nvol( t2xmxm iu1alenlnesltfaDrr(rp;o1oltomociltfa ra( snt0tlxnmo3oatfpDrlu slt0teumimpiudap n fciasfs2raxmp;u4apt  fciatlm um( s;u0altnxf ta1oaD aiei;t  2tmim3ny1olenlfvsat) 2umum ;u0opxo o3tys m uauvs t4tlermfcoatlpDr ivo s)trum(mpoodaltnmivtl()aDuaxm oo4aetn f3ias aDraumonu)alxrio3oy1omtean o;(0 2to(mpno4lmtnlfvtl(  Dtaumpot4opt io3taslaDelnvo;u)trermocta1lm e n ols0 rxm(opou4aptn nes tf Duax onu0aexn fetls mDrlnvo ()tltomfcoa1fpt  neo t0sexoirpou1ap e ncsl(fsDua(mpot1oleoiictydfs2emnmp;()altoir3iotfatraieo;(0srxrxo iodlmt mfcsa(f rraumpnt4aet ii3tld s rlnms () lenmf to1om   ueo;()s2umiopiy4amtn ietls)s2rax oou0tlxn oetltla ul(mp;u4tleomfciadfpte n s;() eurimpiy4al   nvi s  2tm(m ou4aleomi3iaslmDemnmo u)aeenmociydom eauvolt sexoio nydlltemneta() rtau pot4oleomf3taslsDem(vsnt) eeoif oydopt luvslt0t2to(mpno4omt  ics sf Dtaur nt1oeeniociasla el(mpnt4 rxnmfciadom elieilt0 2xoxr iy4omeemncs ( s2ra(  ;u0alx mfciasfsDemuvs;(0tlenifcto1fa eaivsls0srtoxo3ny1lmtnmnvi (  rrr( oou1aleo octatlmDrlnvo t4 exrmr3iodfpDraivi t)srum(o3iydll elncslsfarumxrp;t1oex ifeiydla rln onu)arxnmrciatopDe uvols)tetoxr3oo1al nlnvilt)a2tmx ooo0aeenmociysls emn o t4arermf3todlpDraueols0texm(o ou4lm   ncs t)s2tmumpnt1apx iiciad m ra(vsn(4 rtrxfctotlaD auvilt setrio iudlpeelivslsfarrm(rpot4aeen octltls2el(ms;(4 eeriocoatop raiesls  2tm(r ny4lptemnesls a2ur(rp;o4aptoiociatfs2rlumo t0 rxnmr oa1laDelnvo;(0srxmxo io1op  micilt) Dumx ont1oex  fciadfm ua( p;u)aetnif oy1faD luei;s srumxr oy4lp nmicsa(f Dur(mo;o0opxniociyd m rm(msnt0arxoxocootop rli ol()sexrxr nudlmteliet ()s2urxmo;o4tptnifeiysfaDrlnmsnt)tltnxo3iytlpDrai s t t2tmxr oo4al n icia(f ruaxrp;t1altomoetadlsDulnvs;u4arxnir3ootfmD lneo;s0 2xm(mpno4amee ietat s2uaum no1tptn ocildfs2uanvo (4tltrifcoo1opD ai sl(0 2trxm3iudll e nesls) rurx pno4alxn ociyd mDul( on(4 etnio3tytoaDr ivo t0srurirpoodamtn ivi ()srrru p;t0tpxnmociad sDemuvp u4 rtoif3oytfaDrlivo ()seumim3oo4am nmfvia()aDrax o;o1oet  iciyt sDrlnvsnu4 rxoxo3oodomD livslt0srxrxo oydap elfvs s a2ur(m ot1tle micilsla2rm(mp;u4trerxocoa1fptraiei;( srurirpoodol elicil(f Drau ooo0alto i3tadlmDeauvs;(0trtrmo3iy1fa  anesl(  etm(mpnydomte iviat  2ra(r nu1tetnmociat a2umump u4texrifciatomD ln i;t) 2trim3no4optelnes s)a2uaur oo4alt ii3iadfsDrl(vp (0trtrxocoytlmt  nvils) etmxr iodap  lnetas) Dta(  oo4tpt  ictlt s2uan p u0 lxoxrctodlp rlu i;s)srumiopiu1ap nmivsl(  rraxm oo4tptnmfeilt s rl(mo (4tlenmr ta1lmtraueol(0s2um(m nu4op  lfes tfs2trur ou0tpxoio3ils mDea(vs (0 eerxociy1fmtelnes () exoimpoydapt  iesl(  2ta(rp;t1teenmoctat sDum(msn(0alxnmf3to1oateln s s seuoimpnudlme  ietlsfsDtr(r nt4olx iietatls2ranmp u)arxrxf tadfatr nvi (0 2tmxr3io1aptemncias)aDrm( oou0optomi3ildfaDrmu p (4 rerxocta1fp r ueils0sruo(m oydamt  iviasfs2uau ooo0apen octaslmDua(vont)arenif io1oa ran o;(0seurxr3nu4apt lfvsls) Dua(r ;t4aeeomi3iydla2rmu s;t)trxnmr oo1op r i slt)t2to(o3ou1lltemnetas srur( o;u1alt  fctadfs eln o;(4trxrxr3iatom ranei s s2trxo iy1ole livilt sDtmxm no0texnmociydlmDuaumpnt)aexomo3iy1fmDr nvi;s t2xm(opno1omenmieiatfs2rru ooo0tpeomfeiatla elnmp (0 eenircta1fptelnesl( t2umxr3io1lm nmnet ( arra(  ;o1aexnii3iatfs2rmuvp t) rtnmo3iotfatelnvi (0 2uoxm3ou4op nmfvil(fsrtrumono1opxnmoctys s2raumpnu0 ltrxf oa1latelnvsl(  2umiopoudol   ivsl( s2raumo;t1tee iieiydlaDrauvo (0tltrmf3oytfpteaues;t t2xrio3iodal n feta(fa2ra(monu1tltomf3tydfaDrm( o u0trxomfcoy1faDe neo t0t2xoxrpnu4ome mici (  Duaumpnt4texoifciasfmDulnvo (0 leoio3oydlmDe nvo;s setm(m oo1lpenmncsls sDtmur nt1texo iciadfs2elnmo;t) exrmf3totfmt lnes;()s2xoim nodap nmfeilsf 2ra(mpoo1oltomf3iatfmDel( s t)treoxrctadlm raivs;() eumim3iu4lpe miesa( arumxrooo0olxnif3tatlm emumpn() ltoir tytfmtranvi t0t2uoxm iu1omenlfeil()a2ur(m ;o4aexoiociad a emnmp u0arxrxr io1lptr ivsls0 exr(o3ny1opeemictltfa2uaur ou0aexniociydfm2elu p u4 etoif3oadoa rlues (  2ur(r3io1amt lfcia()srtrurooo0apt mfetasla2ulnmp;()trenxfciotop  lneol( seumir3iydamen nvi t)sDraxr ou4alx moeiydlmDem(vo u4 reoxfcoydfpDeli o (  2xoim iodllte fvsl() 2umumoou4aleo i3iys m2elnvo u4 lxrxo3oydlate uvs;t0trxo(m3iu1aptn nvt sfsDuau pou4oeenifeiyslmDra(ms;(4treomf iy1opD luvo t0 etrim3iudopte iesa( aDurumont0olxn oetltlmDeln o u4artoxo3iotomDran o (0 etmio nu1am emnvt (  rta( p;o0alxo oetlsfs2eanvp;t4tlxnxf3iodopteluei s)t2urim nu4ap nmfvsl( a2uax pnu1opxo i3ild sDuauvp t4alenxociydfmDelieo;( texr(m nu4lpee nctls)s2umxmooo4alx iiciltfa2ulnvo u0altrxocoo1fpD  ivs s  2to(o3nu1lm elnet (fs2rrurp;o0oetomiciatfmDulumon()aeenif3ootoa elueolt0trto(r ou4ll nlivt t)srtaurp;o4tlx ifeildfsDrlnmpn(4tetnmr io1omDelivil(0t2tmxm oo4ome mncilt arrru pno4oet  f3iadfa rln o (4trtoxf tydopDeliei s0 ruo(mpno4lmenmncias  Drr(r ;t4tlxn ietyt s2eanvo;()trxnmo oa1fmDe nes s  eumxo oo1lle lfesas)aDrmurpnu1olx  oetad s ulnmo () rxnif tadfa   nes ( teuo(r3oo1apeelfvs ( s2taur ;t4aleniictadla uluvsnu0treomrcoy1omtrau o;t0 rxoiopnydopt mfct ( s2trxront4tleo ieiyt sDemnvsn(0 eeoxoctytlpDraivo;s s2uoio oydoptnmnvt s  Drrx ont4opt iociytfsDrm(von()alenxrciatlaDr iesl(  exo(r ou1al emfes s aDta( o;u4aleniieiltlm2um(vo t)altoio tadom   nesls0s2to(m iu1ame livta( arrrxmpoo4tpenifetlt mDumums;t0areoir iodfaD luvs;s srurxrpio4opt  fct ( sruaxmp;o0tet mfciltlm2uaums () etrxr3oadopDrlnvo t)s2uoxm ny4lp nlnct s) rur(rono0texomiciysfm ulu o;u4 lxrmr3ootlmDelivsl()t2uoxopno4al nlfct t)aDuaum ot1tltnmietltls uaums t0texrio3iy1fpDrlivi;()sexm(mpoo1olen fcsa( aDrm(rpou4opxnmf3ildlm2ean ont0trtomr3iydlmDr nes;t s2toxo iodamee iesat)arrax  nt4tptnmociadls2eanvo;(0aeerif iy1lpD aueo;(0t2tmimpoo4ome mieiatf Dur(m ;t0optomociyt sDra(mo t)aetrxr iytlmt au slt  rto(rpoydlme mnes s)arrrurp;o0aleomicildls umuvont4aeeoioctotfmDeanvo;t0trxr(m3iudomt mietlt)s2umxmpnt4altnmfciat sDrmnms u) renxo oydlmDrliei ( trurio3iudol eliviasfartmxront0tlxn ieildlmDeln onu0aexomo oo1fm r i i;t0t2xmxm no1omeemnes (farua(rpno1alxomoctydlm2elu o t4 ltrmf oydop eau ilt0sexoim nu1apen nvtltfaDtau p;u1aexnio3tlsfa2ranms;(0aeeoif3tatfmt  i i s  etr(m nu4lpee ivsatf Dtrxro;o4olx iociysls elnvsnu4 rtrir3tatfmte uvo;t0teuo(r oydameelneil( aruaxro;o1tpxnmietlt a rl( o (0alerxo3totoate ieslt  2to(o iu4olt  fvta( artm(mooo1tpe  i3tatfm elnvp;t4 ltnio3oy1fmtelieilt0 eto(mpiu1om emnviat  rtru pou4teenmf3iysla ua(vs;(0aexrxo3iadopDran i;s) exoxr3oodopt  iet (  Drmxrp;o1oex miciadls eanmont4texrxocoa1fmD luei;t)trxm(mpoodal nlicsls)a2tm(ro;o4opto iciydlm elu ont)arxnmf3tadlate nvo t0teuo(opoudapt mivtat aDtaum ;o4opt mfetlsfs ul(vs u0 ltnxr ia1omt  u s;t tetmir oo1lmtelicslt)srrmumoou1tpxnmicilt a2emnmp u)tltrifcoadfaDe i ols  rxoiopiy1lpen nci t  2urur oo0oetnmoeiad m ea( p;u)trenif3iatoaDeauvs;s  2tmxo oydoptnmfcs ()arumuroou0aptn ieiyd mDrauvs u0alxniociatlmtr n olt0t2urir ou4aptnlfeias sDrr( pno1tlx iiciytfm2umuvs;u0texrifcoo1lm eanei t srtmxo3oydopt mnviatfsrrmx  ;t4aeto oeiydls em( pnt0alenir iydfaD luvs s0setr(o3ny1al nmivt tf rtau ont4apeoif3iadfa2eauvp u)aetoxf iadom elnvslt t2ur(o3ou4am nlnctat  rtrur ou4apx  fetas sDulnms u4aeermo iytlpDeln s s s2xm(o3iudame mnetl() 2tr(root4altnmociytlmDel(mp t4 eerxo oodopD  i o t)s2uo(o3iydamtemneiltfarumum ;t1tlxnmoetld a2ulnms;()trxoif3iydoa  luei;t)setr(rpiodoltn nvtlt aDrau pot4opt mietld s rluvpnu0 rxoxr3ty1fateauei;t0 2to(o oodaltelfvt tfsDrrx oot0olxnmicilsfaDrmnmsnu4altrxociydfatraneil()seto(opoydop n fes t)aDrm(  ;u4olxoiiciat s2ean p;(4aeerxrcoodopDr n s;s s2um(o3no4lmee ieiatfs2uaxmp;t1tpxniicildfm2ulnvont0 etnxf3oatfmteluvilt0 eurxr3iy4olt  fvs sf 2rmumpoo0aeen f3ils s ra(vpn()aetnmrciodomD lnes t)s2urxrpiodll n nciat) ruax pno4oee moeiatlm2rluvo ()artnif ta1optrlueilt t2tr(o iodomenlnvs ()s2taur no0texomf3iltlsDum(vsnt0 exoxr3oy1fa  lnvs s0t2uoxmpoy1oltemivsas sDtmxro;u1oexnioeild mDuluvsnt)aetnxr3oydopDrlies t0seuoiopoudam nmivtasfsrtauront0tptnmiciadlm2elnvo t)tetoir iydlm rln s;s0t2xoxr oudlle  nvt sfs2um( ooo0optoifeilslmDrmn sn(4 exrmf3iadlp e n o t s2urio oodoltemnvs s)aDraxr nu4oexoii3tad s eauvs;t0altnif iodfaD luvo;s0srumirpiudaptn icias)srraxmpou1teeoiictydfm em(vonu4teenir3iatfm ean i;t0srxo(opoy4om nmnvil() rta(rono1tptn fctydfa2uluvp;(0 etnxrcta1fmDr ues;t t2xr(o nudop nlneta()artrxm ;u1tpxoiiciadfm2rm(mp;(0 rxrxf tydlat au s;(  2tr(m nu4lpen ivsl()sDuaxm ;u0oet iictasfsDelnmonu4 renxr todfa elnvs t t2uo(rpiodamtelnci t srrrumpou0tpeomietyslm rl(ms (4aetnmrcia1oaD  u i t  rtoxrpoo1amte fci s)aruaumoot4aeeoiieilsfsDuln p t4trenio iadoateau ols) rxoiopnydop n iviat srum(  no1oexn fetyslsDuaumsnt)tetnifcoy1lp ranes;(0 eur(m3iu4optnlieia() Dtrurpno1oet iociyt sDum(vp (4artrxr3iydfmDraneo s0seuoim3iodom   fcilsfsrrr(mp;o4tpeoiieiadlmDul( o t)aexoioctydfmt ln ol() 2tm(o oodameeliviasfs2rrur nt0tleo feils a umuvpnt0tetnmf3oatfpt auei;(0teuoxo3nydape  nvta(  Duaxmpnt0aleo iciad aDelumonu4aleoirctadfp  auei;(  exr(opno4lmtelnvtlt srtr(mp;o1tpenif3iadlm2rlu o;()aetrmf3oytlpt auvi;s0t2xrxr oodlpte nct (f rta(  nu4oeeoif3iytls2ra( s (4artnifcto1fmDeanvo (0 rtmio3nu4oltnlicsa( s2uax p;u4aetn ocilt sDrm(vonu4 ltrio oatfaD lu slt)t2uoio iu1am elieiat)a2trumpno1tltomf3ilsfm2rm( o u4arxrmf3iotfat  ivi;s s2tr(mpiu1ape lnetlt)sDua(m ot1tptomo3iytla ulnvp u)arxoxf3iatlaDeanvol()seto(o3nu4apee fcsasfsDtrx o;u0aetn f3ild a ulu pnt0tlxnif3iytlmtraieilt)trxrxr3iydlm e ietat arrrxr ;o4alxo iciysfs2eluvo;t0 lerxf totfatr nvi s s2to(r iudllen nvtls) Drm(mp;u0olxnmietytfa raumo;t0aetrxf oodoaDeln o s0t2tm(mpnu4ale mics (fsDtmx  ou1tpeomf3ildfsDeauvpnt0arerxf3io1laDeli sl( srtmxm3nydolenlnvsa( arrmxrpoo1alt if3ils m uanvonu4artoif3ia1fptr n o;()teuoxm iy1ol nmnvtlsf Dtm(r ;t1tlxo icilslmDrlumo t4aexnmo ootlatraies (0trtmirpoodoltnlivsls) Dtrxmonu1oexo fctasfmDumuvp;t)teerir3tatlat ln ils) 2umxr no1lltnlncsa(fs2tmxmpnt0oee ioctytfsDrl(mpnt4trermrciytfa   nvol(0 rxoxr nu4amtnlfvilt)aDur(monu1oee ifeiyd m2rl(vont0altoifcto1lpDr ieol()trxrir3no4am nlfcsl(f 2um(mpnu0aptomfcilt m2emuvp t) rxnif oy1fmDeaueo s)t2xrir oy4ole  nvtlt aDtm(mo;t4opxomociasfs2el(vo;t)tlxoxf3totfptran sl( trurxr3ou4oltelnvils)aDtr( onu4opx mfetaslm eauvo t) exnxocoadfp  li ols)texr(r iy1ale micsas  2urx p;t4alxomietas sDul(ms (4trermrcio1fmDr n i;s0sexmiopoo1lpenlfvilt)arrmuro;o1aee ifeiad a2emn s u4alxnircoatlpteauei;t s2trxo nodopte fvt (  Dtm( pno4tet mociadfmDuln ont)trenif iydfmDrau o;( truoxm io1openmfvsltf Durxr no0tlt miciytfs2eau p t4 rxnxr3oo1fpDraies;t0s2xmxm ny4amtnmfvslt)aDtaurpou0texn ietad a2rmuvpnt)tetnxrctadlp   u s s0 eur(o3io1lp   feil(fa2ua( oou1tpen octyd sDrmn p;u0 rtrif3tytlmD lnvs;t0truoir ny4am nmnesls)artru o;t4tleoif3tys m2ul( ont4teermo ty1omDraues (  2tr(r3no4om   ictasfsDtmxmoou4oleo ieilslm2ra(ms;(4 lxrmo todlp  luei;t seum(m3io1am  lnesasf Dur( onu0tpxn f3tadla ua(vpnt0 lerxrcta1oaDeaivsl(0seto(m iu1opeemfvslsfa2tmu  ot0tlxniietlsls2ua(vo;()altnmo3oy1faDr ueo;s0t2umxo3oydlleelivsatf Dtr(ro;t0tltniictytfm uau o;()teenif3oo1lp eau ols trxoio oy4lp  mfvi ()sruaumpno1tpt  icils a ua(vo;t0 rxnio3tytlm e uei;t) 2uoxrpoydap  mnvs t)srraur no1aeeomoeilsfa2uanmp t4tltnmfcootfa  lieo;()sruo(o3ou4apeemnvsl( sDuaxm ;t0tleo feiltls eln onu)tetrmrctodlmDrluesls  2trxo3no4apeelfcsa()sDrrxm nu4tle iictlsfs2ul( s;(0aleomr tatoatrln s t t2uo(r3nydolt  nctls) 2uru pou1optomictysls uaump (4 lenmf3oodomte neol( setm(r iodop n nei s)a2tmx poo4oee  f3iyt m ean s;u4 leoxrcoatlaD  iei;t)t2xrimpoo4om  lfcil( aruaurpoo0oleo ieiasfm2rln o;u4 eerirctotopt  nes () 2xoim oo1lpeelicsatfsrtau onu4altomoeilsfa2ul(vo;u4trtnmrctadopteaivslt) etrio3oo1apte nesas  2urxr nu4aex if3iltlm ul( p t0trtrxr ta1oa rlnvslt)setmimpiu4lm e nes s)a2taurp;u4apxoii3iat m2raumpnt0arxrir3oy1opt lu s s) 2ur(rpno4omte nei (fs2raumono1aex io3tyd s ra( s;u)aetomf oodfat aivslt0 ruo(o iy4ll  mfcslt)s2um( onu1texomieiasls2umu s;t)arenmf oydlaDeanvilt0trto(m io4lp e nvslt aDrmx pnu0aetn feilt mDumums;(0trxnio totfmD an o;(0srxr(m iy4ap n fvsl(farum(mono4aptn fctld s em(ms (0tltoxo3ia1la  luvi ()s2xr(o io4lpeelncias)srrruro;u1tltomociysfm ean s;u)aexnio3oytlmD livi (0t2toxr3no1al  mfet (f 2tru  ;o0oexo i3ilsfm eanmo;t0tltrio3oodopDr ieolt0s2toim iy1ape  nctas a2tmu ono4teeomf3tysfm2uau p t0aexoxo3oy1fate ieo;s)truo(m iydope mfes ()s2tr( poo4opx ioctyslaDumnmpnt0 eerir tytfmtraieo;(0t2xoimpou4lmte fvtatfsDta(m oo0alx ifcils a uln o;t4 rxrir iy1latrlnes;()t2trxo iu1op e nes t a2raxmo;o4tpeoiieiad a2umnvo;u0 etnmr3iodoa   n o;(0srxmim nodal emiei t)arta(m ou1ope mfeiad sDua(mo (0trxnxr3tydlpD ai il(0srxrxopny4lltn icias  rua(ro;t1openif3tlsfa ea( p;t0 rxrmo oodlatrln s (0s2trio oy1al elivtat) 2ra(  no0tle mfctlslm2rluvsnu4areoxr oodfa rlivo ( srurxr iydoptnlicsl(f Drmxrp;u1apx mieiasfmDemu on(0tlxoio3to1lmt auvo s  rxoxr3oo1lpeemnvt ()sDraumooo1aeto i3tltlm elnvpn(0aeermf3oodoaD  i ilt  2tmxr3ny1lptnlictas artrxr ;t4aleoiictatlaDua( on(4arerxfctytlm raivslt)t2uo(opoo1apeemnesl(faDrrumooo0tpx io3iat s2uanvp (0artnxrcoadlpDraivsl(0s2xm(o nu1lptnmfet () Duaxmoot4apx ii3ils s ranmp;t4arxnmo3ty1lateaneo t  rtoim3oo1optnmies t s2urur ;u1oetomf3iasfa emnvs;t4alxnmrcoadfpt  uvsl()s2umiopio4omen net sfsDrmumoou4opeoiieiyslaDeanmpnu4arenmf oy1lat aueolt)s2xoim3iu4lme mnesasfaDtaurooo1opeo fciydlm emnmpnt) eerir io1opDr n o;s0t2uoxmpno1ope mncslt) rumu  no4aexnmiciysla2umu pn()aleomf3oytopDr nvils0 etmxmpiy1amt liesat aDuaxmp;u4aptoii3ils m rm(vo;u0trerirctytoat li s (0trxoxr iy4lmee iet tfaDrmxrp;u1aexomoeilsfsDrlnvont0 etoir iodlp e nvil(0trtrxm ou4ale  nes () Drm(rpou0tlenio3iytfs em(vp t)altoxr3oy1fpDrauesl()sexo(rpnodamt  fesa(f 2ra( o;t1apx ifcilt sDelu p;t4treomr oytfm r nvi;s t2xm(opiudll   nesas srtaum ou1alxn ocild a2uan o;(4tlerif3oatfaDrau o;s0 etoxm3iy1ap  lnvsas sDrm(rp;t0aleoifeilsls2eau s;u)alerxr iytoat an o;t)tetoio iy4amtelics tfaDrmuronu1ole  iciydla rlnmp;u)trermf3oodom elneo;( srxrxr3iydapeemnvilt aDra( oot1tltnif3iasls2rau s t4tltoio3ootfp r neols) rtoxm ou4ale miet ( srtaum oo4olx mfeiytfa2uaump;t0 lxoirctydlmD  nvs t0srur(r nydlm n nesls srta( pot1alen oeiltla2el( onu0tltomr3oadlpDranei;( s2urimpnudlp  lneiltfsrrruro;o1aee ifeiltfsDrl( s;u4tleomfcta1fmDraiei s truo(opno4op emiei s)sruaxmp;o1olxnmf3iydfm2uanvo u4tltoir ta1op  aueo s)tetmir3ou4apenlfetl()srta( pnu1alxomicilsfm umu pnt)tetomf to1faD aies s  rtrxopiydlltemfesat  rtax oou1altnmictlsls ra( ont0altnmf3to1oa eaueols t2xrxr3nudope mneil(  2tmumpou0apxo feilsfs2rlnvo;(4treomr3ta1faD ai i;t0 euoxr no4alen fvsatfaDurxmooo1altnio3tytfmDem( ont0artnmf ty1lmt aueil()truoxrpio4ape  nct s arraxrpou4aleomi3iys m2umnmp u4arerif totoa  auvi;()t2xmir iodomtnlfvilt)a2tmxront4tle mo3tyslm rm(mp;()trtnxo3todlatr uvs ()s2uo(m ou1oltemfvtl(  Dumum nu1ale if3iasfa uan s;()aeenir ty1lpt auei s)seurimpno1apt  ncslt  Dtaxroot4opxoiociydlmDeaums t4altnxociadla  au i t0teum(m nodalenmncsat)s2ta( pot1alto ieiat aDulumpnu0texrmo ia1fp rau i (0s2tm(r3iy4lm   fvsls  Dtmuro;o0tlx mf3iad m2uau s t0 rtnir3iytfaDeauvo;t0s2to(r iydaltn nesl()aDtau o;o0tpxomictadfaDuau o t0aexnxr3ia1oat  i o;s0trtrim ny1lmenmnciat) Drr(  ;t0opeoifcild s umn p;t4 ltnxociodopt anvo;t  euoim3no4op  lfetls)aDumumpoo1olxoifeiytlmDranms;u)teermf totomD  ies t)s2toxm ny1lp n icslt srumur nt0oeto i3ildfs rauvs t4aeeoif iodfmtrluvo;s)s2tmio3ou1lltelivs () Dtmumpno4openifciydfs rmnvs;t4 etnio iydoa e ies t0s2umir oydame livsasf 2umx pno1alxnmf3iytla2eanmp u4trxnmo totoaD aues;()setmxr3iu4omee nci s  rtm( p;t0ape moeilsls2uanmsn(4 rtoir3oa1la eauei;t)seum(rpiy1alenmfcsl(  Draxr no1aetoif3tasfm2rmnvsn(4 rxoxf3tydoaD lnei s) 2tm(mpoy1lpeelnvi t)sDrrx o;t4ape mi3iasfm2eanvo;u) exnmo tadoatrlivsl() 2tm(m3iudap nmncilt) Draxmo;o1teenmociadlaDrlnvo;t0teeoxrciytfp   i ilt0t2xoir nu4oltnlfcsat) ruaum ot4aeenmo3taslmDrm( o;()aetnif tytlp  ai i s trum(o no1aleelfesls  Drm(r ou1opt moeils mDem( s;u0aexnif3ia1oatranvo;s0 rxrxr iy1ol nlfeilsfa2tr(r ;o1opeoif3iyd mDrl( pnt0aexrxr ta1lmDeanvols0s2xoio nydal  mfvsltf Dtaurpoo4opeoio3iasfmDel(vonu0 rermrctydlmtrau o s)tetoxopiu4om emnvs s  Dtr(  ;u1tpx  fcils m umnvp u0 leomo3io1lmtr ivi t t2xmxopnu4aleelfet t)s2ur(rpno0tle ifctatfsDranmo u4teeoiocto1opDran i s s2um(opiu4ameelfcta(fsrrmx pou1oetomi3tls s uau o t0texomocia1oa eaies;s0trxrxr3ny1lmeemiet ()arrax oou1aee mieiat sDraump;t4aeerxr3oadoaDelu o t  etrir io4apte nvi ()s2rmxrpnu1opxoiieiydlsDrlnmp t4arxoif tytfm rau sl() rtmxr ny1lltnmicsatf 2raumo;o4alt iictldfa2elnmsnt)arenir3oatlmDeaivo (  rtrirpoudlptemfcilsfa2tax pou4openif3tat a ra(mont0 lenxr3totoaD lnes;t trur(rpoy4lp   fcs (f rrmu oou1tpxnmictadls eau o;t)tlenxf3oa1lptelnes (0 2uoir oy1lpt livi (fsDuaxrp;o1aex  octyt a2emu s;(4tlxoifcootlpDeanvs;t) etmirpno4amtnmnei s srra(  ;o0altn ieild mDrm(vp u0tltrmociodlm rln s s srxmimpio4op nmfetls)s2ur(mp;u4tpx mo3tlsfm eaums u) rerir oatfa e i o t) 2xrxr3oy4lptn fct sf Dtaumpnt4tltoifeiydlm rmu s;()alxnir oytoa eaies;t seurxr no4lp   fcils  Dtauroou1oeeo ocildlmDrlnmo;(4aeenmo to1oatr uvi s) eto(o3no4optemfvtlt sDuau pnu4ole iocias s rmnmp;u0 lenxoctatlpDeaies s s2tmirpnydlpee nvt t aruau ooo4ole if3tad sDuln o u4tetoxociytoaD auvilt)teumir io4lpe lfes sfartmxr oo0opto i3iltlm2ranmsn() ltnxfcoo1oa  anesls)t2xoimpno4ap n fvils)s2ra(m ;o1aetn i3iytfmDumnvsn(4 reomo io1fat  n o (  rtm(r iydopt lnvils srtr(r nt1alx  f3tldfs2eluvp;()tltrmoctydomDe ies s0 rurxr3oo4ol nmfet s)srra(moot1optn oetysfs2umu p t0tetomo oodopt  ues s) 2trxm3nu4lpte iesasfsDumxmpno1tlt mf3iys mDea(vs u)aexoif3oydomteln o (0trto(o nudame  ictasfsrrmumonu0tet  iciytlm el(ms;(0aeeoxf oytfp   i o;s) exm(o ny4alee neiltfsrtm(rpnu0alx  feiyt s2ea(mo;(0texoir iotomD auvo s)t2trxm oodameelfcslt sDrrx o;o0apx mietldfmDel( s (4tlenmfctodfaD ln s s) 2um(o nu1am  mncias)sDtau  no1tpt iieiysfa2rluvp u0alxnmrciytlm r i o s  rxo(rpnydlpen nvtasfaDua(ro;u0optn ociydfm uaums (4 eermo3iytfmDe nei;s  rtmiopiy4ameemnvs (  2ta(r ;u1oetnmfetatla ulums u4tltrmr3to1lmD auvs;()trurim3iy4llte ivsls arrrumpnt4tpx if3tltls ul(mp t4tetoir3totfmteau i;s) 2trxr ny4ll n nct ( srrmuronu1oeenifctltla2ul( snt0altoxf oo1fptraiei ()s2tmxmpoy1lpe  ies sfsDtmum ;o4aetomi3ild a ul(msnt0altoif3oo1optraiei s srxoxmpoy4al e nei t aruau p;u4opx  i3iyt a rauvs;u4aeermrcoodop   nvsl(0tetm(o3iy4om  lnvsa(fsDra(rpoo0tlt mi3ils a emu p t4trxrmr3totfptraivs s  exrimpio1ope lictl(f 2tm(  ;o4aetoio3iasla2um(mpn()aexomo oadfp raivsl( teuoimpoydamenlfei s a2rrxrooo1tpt ii3tydfm2uauvon()trxnifctodfmteluvs;t  eumir nodal   fctasf 2urum nu1oeen feildfm2uauvo;u4altoxr oo1fm  lu s s sruoir3oydlptn nvsl( a2rrx p;u4aeeomo3ias s emnvsnt4tleomrcoydfm  auei;s0trxrim oy1ole lnvs t aDtmur nt4tltoiicilslsDrlnmo;u4 eenxo3iatlptelnes t0tetmio3nu4lptnmicsl(  rrr(m ot1opxoiictatfmDumu s;(0tetrmo3ia1lpD lueo ()srurxm iy4ll   fcias aDtrxr oo4tpxnifetaslm rau o (0tlxnio oo1faDrln o;s) 2tm(mpio4om n ivsas)sDtr(  nu0oltomiciydlsDumuvp t4 rermf3oy1omDe n ols  rxr(rpiy4lle lfes s)srrr(rpnt4oleomoctas s2eanmsn(4treomr ootopDeai s s trtoir oydomtemfvilt  Dtrx poo0apeoio3iydls umuvp u) exoxoctotlp rauvo;t s2xo(opio1ame mieia( arua(rpou0olto ieiys m eanvs u4arxnir iydla elneo t)srtrio3ou4lmeelfcil()a2rrurpnu0olx  i3iat s el(vp;t4 ltnxf iodfpDr ieil() eto(o3ou1al  mfesa(fsDtmxr oo1tpeoio3ils sDemumo u4altrmf todom eluvslt sruoxo3iy4optn ict () rtm(m nu4tlxo o3ils s ra(mon(4 rxnmo oodfm   uvs;(0trxoxo io1ol n fvsas srumx pnu4oee mieildfaDean s;u4alermf oy1fa rlivi s s2um(opiu4oltelfctl()s2tr(m nu1olenmoctltfm2ea(mo (0aeenmo3oytlmtranvil()t2tmiopoo1ome  fct t)s2tau p;u1tex mo3ild a2uau sn(4 rtrxf3oodoa ean i t)teumxm oy1lpt  neslsf Draurpno4oeeoiiciaslm ul( p;(0artnxf totom  aueol()srxrxrpoy1am elncsl()arraumoot0aeen o3iasls2elumont0trenmociy1fmDe i i;t0s2to(r3no1olt mivs ()aruaxm ;o1olx mi3iytfa2umuvs t4alenxfcto1oa eli o;s0seurir no4om n neils  2ur(monu4apxnmo3tytlmDumumo;(4arermo to1fa   neils srumim oodop n ivs t sDraxmoot0oleomi3ils s2emnvon(0 eerir oadomDrln s;t0teurimpiudomtelfctlsf 2uaxro;o0tltnifeiltlmDuln p;t)tleriocoodfa  au o s0 rxmiopiy4omeemfvsl(fsDurum oo0tpxomictldfa ra( snt4aexnxf3oatopteai slt0 rtm(rpnu1llenlics s srtmxmoou4openiiciatls2el(vp;t0alenxr3oo1fm  aivi;s0trtrir3oodll  lfcils sruaump;o4alt moctatfa rlnvs (0aexnmr oy1lp  lu ilt srxrxm3nodalte ncs ( artrxmpoo4olenif3ilsla rm(vo;u)altnxf3totopt  ueolt)t2xr(m nudlpe mnci tfaDuru poo0tltnmi3tyd mDel(vp u4aetoif3iotlp elnvo s0t2uoiopoo1lptnlieia()a2trumpno4opeoiociatlsDelu p (4 lxomfcty1lmDrau il( s2urxo3iy4apte icsat a2umxrpoo1tltn f3ildfaDraumo (0 eerxo3tatomtrln o;t)seuo(opiu4ll elfcia(fsrtm( p;t4aetnmietas s2eau o;u4tltnmocty1opt li o;s)srumio oo4omt lici t  2taxront0apx ifciatlm rl(ms;t4 exnmo oy1la rau o;t)truoxr no4ape  ivsls) Dtr(roou4altoifeiydfmDeanmp t4trxnmfcoa1latr ivi;t0 exrxopoo1omtn fciatf 2tmxroou0tlenmociad a2ul(vs t4alxoir ootoaDeln i t setoimpoy1alee icsl(fa2rrx p;u1oeeomiciys sDea(ms (4altrxr3oadoaDe neol() 2xm(o nodop nmicsasf 2ta(m nu1tpx miciltlm ulnvpnt4 rxnircoy1fm elu sl(0srxoxm nu4ole lnvsl() rtm(r ot4openii3iatfa2ra(mpnt4 lxrirctatla rlnei;t0 rxoxo no1lp nmnviatfs2rm(rpou1aee  o3tltla ea( snt4artrmrcoydlaDr ueils  ruoxr nu4optn fes ( aDrmurp;o1tptoioetlt mDum(mp;(0arxnmf3tatop  aieo;(  exoxo3iy4opt  fvt (fa2rm(m ou1oltoifeildlm elums;u4 ltrmrcootlmtr uvi s0tetm(o iydlptemncs t)srrr(mpoo4tlxo ictat mDulnmo;u0aetoio oy1om eanvi;t t2toxrpny1lpeemivsltfs2rmxr no1oet mo3iltfm2elu s;t0texnmo3tydom  au slt0 2umxm3ny4olenlnct sfaDurur ;o4optomfciatls umnmsnt0aeeoif oy1fptean s;(  rxoxo3iu1lltn nctls) ruauroou1tlxn oeilt m raumpnt4aeerirciotom eau s;()trurxm oodamt mivil( sDtaxmoot4aeeo oeiat s rlu o u4tlxrxfcoodlpD ai olt t2tmim3io4ap emieta(fsrrm(  ot0tpxnio3iasls uau p t4 ltoxr3oadfmD luei t)t2um(o3iu4am emnct s)srrmu ono4opxomfetysfa uln s t0trxnmf3oadla   nvsl() 2xrxo3oodllte ivs s)aDtaxro;o4tex moctydls umuvo;t)texrmo3iodfmtraivi () 2to(mpiu1ll   nvsatf Dur(  nt0tlenmieiysfm2rm(vp;t0 etomr3totoa elueilt0 exr(o3iydlltelicsas)srra( o;o1tptoiociyt m umn s;u)alermo3iadlpDeli o;()s2uo(o3oudap nlieta( sDra( p;u4tlen fetyt mDel(ms (0 leomr3todfa   i o;(0tetr(o oodalt mncsas srrr(mo;t1ape iociadlm2rl(vpnt)tltrmr io1lp raueo;()tetr(r3nydlpen neilt  rraxrpno0apxomf3iyd a2ua( p t0alxnmrcia1lmDeaivo (  2xmxm3oo4lpt  ivtlsfs2uru o;o0oltoiieildlaDrluvp;t)texoxf oatfaDr ies t0 rur(o oo4al n ictas)sDumxrpnu0texomf3iadlm elu s;u0 rxomf3oytlaDean slt)srurim oy4lle lfeil( artmxro;u0tpt  i3tad sDrlnmonu)aleomf ty1latelieo t0texm(m oo4ameelfciatfs2umum oo4tpen ietldfs2elnvs u0aeerxf3iy1laDr nvol(  2to(mpou4lp elfcta( arrr(ronu1olt ii3ildlmDeau pnu4alenmf3iatfmtrlnei ( seum(o3io4apee neil( s2urxmonu1oltn ocilsls2rlnvo;t0artnxr tadfpDr uvslt) etrir3iudalt mfes s)aDtmumoou4oex mf3ilslsDeanms (4tleoxf oo1lm  lues (  rxm(o3oudopt mfvi tfsrum(  ou0ape ioeiyd aDumn onu0 eeriocoo1laDrlivol() exr(m3oo4ol  lieilt  rrmu o;u0tlto i3tadfm uanvpnu4trtoio3oodfaDeaivs t)s2tm(m3ou4apen ivs tfartr(  no0apxoifeiys mDrln onu4 etnmfciy1fa e uvo;()truo(rpoodlpee nci (  2urxmono0openiieiadfsDrau o;u4 exnir3oadfpteli olt s2uo(o iodlm e netas)sDur(r nt1tptomoeiydfaDeanvo (0trxnifciodoatelneo;()truoxr3oo1lmtnlncia(fsrrm(m ;t4aptnif3tad a2emnvs t4tltrxociatfm r ieilt)s2urxm iodlptnlnct sfsrumuront4ale  i3tys s2uanvs;u)alerxr tydfat lnvi;t0 eto(o3oo1al emfcils srrax ono1tptoio3ils m ea(mo () rtnmocoy1fmteluvs;s0t2to(m nudop nlfesas)sDrru  nt1teenmi3iytfs umnmp;u) exrxr3tadfmteluei;t)t2tmxo3oydameelfetlsfsrrmum ;o0aexnmoeiltfa2um( s;u0trxnirctodfptraivsl(0 2xo(r3iu1lme  ivtl(fsrtr(roou1teeoiictyd a ua( s t4altnmo3oa1omDraivol(0 rxmxm oodap nlfet t) 2tr( pot0tet  fctls a eauvsn() eenir3tatfmD auvo;t)srxr(o no4lm n fcs sfs2um(mpnt0tptniieiytlsDulnvs (4trxrif3tytfpDelies s trxmio iu4optemfvi (f rtrxmo;u4openio3tadfm2rmu s;u4 lxomociadopte neo ()s2urxm3oy4lleelneiat  2raur ;o1olxnmiciasfsDrl(mp;() rxomo3to1faD  neo s0teurim3oydopenmneils aDtm(r oo4olx ioeiyd aDel(ms;t0trtrif oatfpteanei;s)setmim iudllt  fetls)srraumpot0tpxn i3iat m ua(msnt0tltomo iytomtrlues;t seur(o nu1lm n iesa( aDtaumono0olxoiiciydfa eanmp u4tlxrir oo1opDrauvs;s trtrxo iudoptnmfesltf rtaur nt4optn ieils s rm(mo ()aeermfcta1lm ean o;s)teuo(mpnu4amt lfetatfaDtaum nu4apxoioctltlaDrlnvs t4aexrirciydoa e nvsls t2tm(m3iy4lm nmnvtas  ruaxr nu0ope mfeilslm rm( snu)trxrmr oytoa elivsls)t2ur(opiy4ole  fvilsfa2uax  ;u4oltnii3iydlaDum(vo;u) leomoctydlat lueilt srxo(m3iu1apeelfesa(f rrauroou4oetnif3iadlm2elump;()aexnif3tadomD li o (  rurxmpio1om n fvt t s2rru pou0openii3ils s2rm(msnu4 lxnir3iydlmteauvs;s  2toirpio1oltnlivs ()s2ur( o;u1tpxn ociysfsDrluvo;()arxnmociytla e ueo;(0trtmim3oo4omtemfci s)arrmuro;u1aeeo iciyd a2em(ms t0aeerxfcio1opD  nvs;s tetr(opoy1ope  fcsas sDur(r nt1olt  f3tas sDrm(monu4alenmociotlmDrln i ()t2xmxrpiydll n fvt sf 2rau o;t1ole ioeiatfa2rl( p (0 rxrxf ty1opDelieols  euoxr3io4lp  mnei t) rrmur ;o0olxnmoeiys mDrmump;u0areoxf totfm raieslt)t2xo(r iu1ole mncslt)arrr(  ;u0aptnifeiyd s2umnmsnt0 rtnmf tydoaDraueolt0t2toxo3iy4oltelnvias) 2raurpoo4tpenif3tytfaDuau s;t0trxnxr ta1faD aueo;t)trxm(rpiu1amenmnct sf rururooo1tlx if3tad m elnmo ()arenxf tadfat aivo;(  rtmio3nodoptnmiciasfsDrmxrpno0alxnmoeiydfsDean o;(4 exoxo3iytoa elnvs t0sexr(rpiudamtn ivia( srur(ront4oeeo octldfmDrluvs;t4artrir tydop   u s;s0s2xm(mpou4al  lnesls  rtrxrpot1alxnif3iltfm2uan ont) reoxrcoo1fmt aues;s0 2xoir iy1apt mneiat a2rrx ooo0aetnmictatfmDul(vsn() rxoir3ta1lmD li s;t0sexoimpou1lp n ivs () rrmumpoo1tpxniiciadfsDeln o;(4arxoxrcootfa   uvilt trxrxm3oy4lm  mivtatfaDtr(mpno0oexnmfetlslaDem(vs;u0 rxnxf iodfa eau i;s0t2tr(m oo4lpeemncil(fsrururont1apxo oeiaslm2umnmsn(4 rtnmf oadoatrli o t0seuoxm iy4ale  nvt s) Dumxr nt1apenmo3iydlsDrln sn() ltrmocta1omDe uvi t s2umxmpny4lp  livt s a2tmxm ;u1oltoifetldfa2rmuvsnu)aexnioctotom eaues ()seumxr3oy1ol  lfcs ( arum(r ;o1tpx iociydfs rlnvs ()altrir3tadfptrlu ils0s2toio3nydalte fei t  2tmum nt0oetomfciad a elums;t4trxnmo3iy1fm  lnes t tetr(m3io4ol  mnciltf rumu pno1oetn oetyd a2uan o;(4aeerxo tadom r uvo ()trxmim3oydomtemivi () rrr(mono4tpxnmfciysfs ra(mo t0teeoifctadlm eli i t)t2urim iu4ale mfci tf rtaur oo0tlenifeilsfaDulump;u0aleoxr ootfm eanvi t)seum(o3oo1altn fctls)s2trx  oo0apxnmicils aDem( on()alxoifcootoaD anvs;t0trtrim3oudomtemicsas) Dra(mpnt4opx  ietld a2ua(mo t) leomfcto1oateaneo s0 ruoxo3iu4al  mfvt t) Dta(r no4alxoio3tls a2umuvs;(4 leomfctytfa   nvolt0sexrxo io1optnlnci s aDrrump;u4oleoioeiadla2um(vonu0arxnxf3tydfmt aneol(0 2xrxr3oydlmeelict t) Dtmu onu4altomietysfmDrm(ms;(4altnif3todoptraneo t0setoim3oy1al  lnesa(  Drax o;t4aetnmf3ildfa ra(vs ()tltrmr3to1fp   i i;()s2tmir3oudam e ivia( srtm(mono0tlxoifciyd aDum( onu)aeermo totomteaues ()trtoiopiu4lmt lnciat)aDtm(rp;o0alen i3tydlsDeluvpn(4 rxnio3io1lm ranvi s)t2xm(m io4lmte fctat)a2tmxmpou0tlt ifeiysfm2uan ont)aexrxr tatfa rai sls s2uoxr3oudlltnlivtatfsDtrx o;t0tee ifciysfsDemnmpnu4 ltnir3ta1fmDr ueo;(0t2tmimpoudomenlncsltf 2rru  oo0ope iiciltfsDeluvo u) lxoxr3iatop r nvilt0t2xrxm3oudom elnvs ( sDraxrp;o4tleoif3tadfmDrmnmo;(4trtoxrctytom eaivi;s t2xmio3oo4lmt lfct () Drrum ;t0teeomi3tadfm rlu snu4aetoir3oadlm   uvol() 2xm(m3ou1ole mncsl(  rum(mp;t0opxoifeiyd m eau snt)trerxociatoaDe ivi;t0srtrxr3iu4am n fvi s sDtrxr no0opx  fetad m um(mo (0texrmociodlaDelivi t  rtmir nu4lpt miesa() 2raur nt1alenmietytfm2ranmp ()tlenmf3ta1lm r iei;t  rum(m io1omt  nesat sDua(m ot0aexnmfetys s rl(vonu0 lxnxoctotoate ieo;t  euoxm3iodomtnmnvt tf 2tmuroou4oetnmociltlm uan p t)tetrif3iy1fa r n ol(0trxo(o io1lm n net ()s2trxmpno1apt  ociadfs emnmsnu0 rxoxr3oy1lmte ueol( t2uoxm3nudameeliei (f 2tr(m ;o4tlxoio3iytfs emuvsnu)trenir oytfmteanei;( trurio3oo1alt  nvt (f 2urxrp;t0olenmfciasls2elumsnu) ltnxocoo1lpteanvo (0teto(r io4ol e fviat  rrauroou0altoii3iat mDrlnmp u4 exoxf3ia1opDran o ()s2xmxr nydoltnlicsas)sDtrxmoot0alen ocils s ulums (0tltnxo iatoptr i i;t0 rur(r3nodlpe lies s s2ua(ront4aeen f3tldla rm(mo t)aexrir3iy1lmD ln il(0trxoim nydapen icil( aDum(mpnu1oexo o3iltls ul( snt4tetoxf3ty1lmD  nes;s  rxm(m io4ll  lfei ( arurx ooo0altnmfeiat a2rmump (4artnxr3iotoatr u i;s)sruoxrpno4open icsatf Draurpnu1alt mfcildfs2raums (0arxrifctotlm  au i;( t2trim nu1lpt lnesat aDumur nu1aptn ieiatfm2ulnmsnu) eermocoatom   nei;t)s2tmxr oy4op n fetl() rrmumont1aex moeiadfa2em( ont0teenio oodfatrau slt)srxrim3oy1lpe mfctl(faDrrum ot4tpxnifciydlmDumu s;t4alermfcoy1fmDe ieo;s seuoimpiudol  mncilsf 2taxroot1tpeomieiatfa eluvsnt) etrxr3tadlpD livo;t0srtr(rpou4lmtnmneil(f rtrumoou4tex mictyd s emn snt0tetoio to1laDean i t  ruo(rpio1opt  iesas sDrax p;o1oleomf3iadlmDrmuvp t4trtnmf3iodlaD  u s;(0truoxr nydal e icilt) rra(mp;u1tlxomo3iytfs2uanmpn(4 lenxf oa1laD  uvo;s0trurxm oy1aleemivtl()sDtaxm oo0tlx mf3iasfa eluvp u0 etrir oy1fpt lnvs t) 2trxopno4aptn ivslt)srtrx p;t1olt mfeiysfs elnvo u)aetomfctydoatrlieslt sexoirpiu4amte ici t) Dtaxrpot1tlx ifetlslsDem(vpnu0 renmrciy1laDelueo ()texo(o ou1alenlnvt ()a2rm(mpoo1alxnio3tls m ea( ont4 rxnxo ootlm eai o s0trxoirpoo4omtelnes s  2umum ou1apeo f3iltla rl(vs u) lxrxr iadopt lu o t)trxrir3no4lp  lfei tfartauro;o0tptoif3iyt a2rm(mpnt) ltrmr ty1om e neo t0seurxm3iodoltn fvsltfarurum ;t4texn f3iyslsDum( s;t0trerif oydfp  aivo;(0srxoirpoodol nmfci tfartrxrono4oetomf3iadfa2ua(mp;t) reoxf tatla r i i;s0 2xr(m nudap elfetas s2tmum nu0aexnio3ias s rmnmo t)aeeomr to1fmDrli s s  euoxopio4aptnmfetlsfaDrmum ou0openiictls m2rl(vs;t4tlerircia1fmD an i t)texrxrpoo4altnlfei t aDum(r nt1aptn feiatfa rln p t0tlxomf3iytfmDe ivs;t)sexmxmpnu4lp   nvia()aDraumooo4tetnmfctlsfs raums;u0aetrxf oatom eau s ( seumimpno4olen fvia( aDua( ooo4aee mo3ildfs2em(mpn(0tlxnxo todomD aies s) rum(mpoudlpeelfcsas) rrru  ;o4oex iiciasls elnvo u4teenxo todopte n olt) exo(r3iudll nlfetl( srtmxr ;o1teenmieiasfsDuaumonu4arenmociodomtr nvi s) etoio3nu4ap  lncslsfarrmx  ;o1oet  i3tlt a2umumpnt4 rtnmrcto1omtr n s;t0trtmirpny4amenlnvsl()arta(m ;u4tpx iieils a2eluvonu) rtomr3iodfpDr i s t) 2toir3oo4lp nlfei (faDum(mpno4olxnif3ilslm2ra(mp t4 exoxf3iodfa e nvil()s2xmxm3oudalenlfvsl( aDtrumoou0tltoiieiadlm2emu o;(0arerirciytlmte nvi () 2trxrpiu1apee nvsltfs2rau  ;u0ole io3ilt aDemnvo;u4alermo oadlptr uvsls0 rtoir ny1apt mnvils) rrrxr oo4aeeoifcildla rauvpnu0 lxnxrcoy1opt lieil(0 2tmxm nydomt livi (fsDum( oou4tptnmoeiysfa2rlu onu) lerxf oa1lmtelivs;t)texoio3nu4lpee ici () 2trxm nu0apxo feiltfm2rmn p;(4 etrif io1faDeau o s)texo(rpoudll nmietlt srtaxro;o0alxnif3iydls2emumon(0alenxo3totlp rauei s)texmxm3iydll  lnes tfs2uaur ;o4tle io3ias mDuauvp;(4 exrirciadlat livi;()tetrxo3io4opee icilsfsrum( onu1tlxnii3tas aDrl(mo u4tetoir3iy1lmDeli o ( sexrxm3iy1oleelfvias s2ua(mo;t1tptomfciaslsDea( s (0arxnmrciatop   uvo (0s2urimpny4lm nlfetasfsDuaurpnt4oee ifetytfmDum(mpn(4 renxfcia1lmt lueols  ruoio nodaltnlivtat artru poo4ale mocildfa um( p;()tlxomf iodoaDe n i;t srtoim3io1al eliet t) 2tmxmono1apxomo3ilt m2eau snu)tltrmrciotopDelies;t srtr(m3no1olenmicta( srrrxr nt1tet ii3tydlaDelu sn()tlxnif3tytfptr nesls)s2uoxm3iydalt mnet (faDtr(r ou4altomf3tytlm2eauvs;u4 exrxrcoo1lm e n ol(  2uoim ou1ap nmnvtasfarur( ont4tpx mfeiytfs em(monu4artrif iydlaDeaies;s)s2uoio3oo1ame  ictl(fsrrr(rpnu1apxoiietyslm2umums;t4aeenifcoytoa rai ol( truoxrpiy1ame  fcsa( arua(rpoo0tleomfetld m2emumpn()tetnxf todlpDranvols0texmir ou4omenlfvsasfa2tmx pnu0ole moeiydfmDem(vp u4texrxf tytfpt  neo;() 2umir3iu4lptemnvi t srtmx pno1tltnii3iat s emnms;t4arxoxocto1lmD livslt0t2xrxr3io4alenlfvtls)a2uru  no4tpe mociat m rmums () lxnmfcoo1fat luvs ()trtm(r io1am e netl() rururp;o4tltn f3iytla uanmp;t)aeeoirciodfpDeli s t0tetmxr nu1amte fvi tfsDumxmo;u1tptnif3tydlm2rmnvo ()alxnxfciatop rai o s)trto(opnudoltelnetlt) 2tru o;u4teen fctat sDranvp;(4tlxoxocoydoptelieo;t0seumim3iydalen fvsa(  Durxrpno4aptnifeildlm ul(vsnt4 ltoxo3ty1fpDrau ilt0t2urxm nodolee ivt t)srrmxrp;t0tee  ictytfs uln pnu)tleoio oatomDr uvs;t0 rtrxr io1apt  nvi s)srtmum nu1olxoioeildfmDrm(mp (4trxnmr3ty1fa ran s s  eurxmpiy4lle  fetl(f Duax o;t1apx  fetatla2elums (4texrmr iodop  aieol(0 2uo(mpiu4op  mnvias) 2ua( oou1tle  o
\ No newline at end of file
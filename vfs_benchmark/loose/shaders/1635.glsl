@@ -0,0 +1 @@
+nvi ()trurirpiy1om nlfes s)aruau  ;t0opx  octys s2elu on(0 lerxo oa1oatr ueo;s) rtmimpiodoltemncilt  rtrurooo1oltnmiciyt mDul(mp ()trtrxr io1opDe nvs;s)srtrio oodlmeemicias) Drm(r ou1opto icildfsDra(vsn()aetnxo tadfp  lueil() 2urio3ny4olenlfcsatfsrraur ;u0tlx iocildfmDrm(ms;t) eenmocoatopD  i o;(0srumxrpiodalee iciatfa2ua(rono1teenifctyt s2em( snt0trtrif ia1oa   neo;t t2xmxo ny4lleemies ( a2tm( o;o1apxoii3tytla rl(ms t0arenio oo1fptr nvol(0setrxmpnu1ol n ivias arrrum oo4oex moctltlmDean snu) etnmfciodop  aieo;s s2xmxrpnudlmtn iciat)a2rax o;o1oeeoifciadfs2uanmp ()artnmf tadoatrauei;( s2xm(rpnudlltelfei ( a2um( pot1oleoii3iad s umuvs;u4trerxrcoadlm r i s s  ruo(r3oo1lm  liviat s2tr(rono4tpeniictlsfsDrlu snt4trxnmf3iytfate u olt0setmim iy1altn ieta( arurx poo4aptomoeias a ulnmpn() lxrio3iodlpte ues s) rtmxm iu1apt lfci () Durur oo0tpxn ociatfs emnms ()alenxf3ia1fm elnei;s) rtoxopiy4oleelivt t) Drmurooo1teto iciytfm ulnvp;()aeeomo3io1fp e i i s truoio3nu4aptnmneia( artaum nu4tpenmietat sDuan p u4altomf iotomDr n s;t seuo(o3iy1ol  mfetltfsDuaumono0oet ifetadla2ranmsnu4aeerif3to1la elu s t0srtoxrpoodop nlfet t srurxm ot1tpt mieiltla2ea(vp t4 etnxocoydfm rlneo;t)t2tm(rpiy1lpe lnvtlt)srtrur ;u4tle  feiat m2rauvsn(4arenxo ootop ean o;t) exoiopoydlp   feia(f rraxmont0ale mfeildfa2eaums;(0texrxfciydlp   neo t  ruo(o oudlpt  ivi t arum(rooo1opxoii3tysla ean o u0trxomfcoydlpt li olt  exo(o oy1ope lnei sfsDtmu onu1opxn i3tad sDrl( snu)tlxoxo ootop   ieols0 rtm(opoodaltelfeiasfsDra(moou0apeomfetytls2uanms (4trermf ootoatr nei t s2xmxmpoydlle lnvslt) 2rmxrono0tlxo ocils m2ea( p;t0 eeoio3oodfpDe nvi;t)trurimpoo1ol  lnvtl()aDrm(rp;u0altn i3tysfaDrlnmp u)tltrir oo1om  lu i s0 rtrim3oydalt  fvi ( a2tau ont1texoiieiadfm rau snu4trxomo oy1omDeln ol(0tetrxr3oy4ll  micia()srta(  ;u0apx io3iadfa2rl(mo u0 etomf3totfmD au s s)s2xrim oy4op emieiat sDuru pno1olenmiciysfs2uanmo t0 leoxfcoa1fa  lnes () 2tmir3oy4lpt mneil() 2rmu  ;u4apxn fcils s eanmpnt0aetrmrciy1la  lieo;( seurirpiu4ll n fct s sDur(m oo1tpenif3iad s rlump u0tlenif3oodfm elu il(0t2xoxr nu1lmtnmfcia(f 2rm( p;u1tpxnmoeiatls umnvo;t0treoioctatom eluei (0truoim nydapee icta() rumxro;o1teeoif3ildlm ul(msnu)tlxnxrcty1fmDelueilt0 2triopnudom  lneta(fsrrrxrpnu0tleoio3iaslsDrlnmsnt0 leomo iotomte nvs;s0t2urxmpno4lpe  nes s)a2uaurpot0tlxn o3ild mDemn s t)aexnxfciy1la r uvi ()tetmxr3io1ol  lfesl( srrru ooo0tetnifctldls rlu pnt0alxrxo oodfmDelueo s s2tm(opiu1apenlictlsfartm(m ;t4openifeiadlm eauvsnu)trtrxfciy1oatrli i ( sruoiopou4am e fetlt arum(r ou1tex ioetadlm2uan s u)trermo3iotlmDrai sls) exoxo3oodomtn ncsa(f rtaxm ot1tlt if3iasfm em( snt4 eerifciadomDelnvi t srxriopio4om  lici sfartmum ot4olx  o3ilt mDrmuvonu)aexnircio1fmte nvo (0 rumim3iudole  fcsls  Dtrumpoo1oltoifetadfm2ea(vo t0 reoir3oodlp ranes t s2uo(m3nudom  lnvia() Dtm(rp;t4alen o3tas a2elums t)trenmrctadoat auvo s)s2uoimpou1llt mnvsat  2umuro;o1oeen f3iyd sDum( s;t)aleoxr iatlmDr ueo s0 eurimpiy4ll n ieiltfsDrm( pou4alx  o3iatla rlu on(0tlenir tydopt aueolt)seuo(m ny4lltemnei ()aDtrxrpot4oee ioeiatlsDea(msn()altrmo3tytfpD lues;t0 exmim ny4openmncsls sDrm(  oo1aeto feiysfs rln p u0arxoxo3todlmDrlueo s srxrirpiu1llt mfvi tfsDum(r oo4apt mociyt s ua(vp u)alxnif3ta1fm rluesl(0srxm(opnodlmt lfvsat) Dta(rp;o0aptnmo3tls a umn p u0aetrxoctatfa   ues s0 etriopno4alenmiet tfarrrx pno4apx io3tatfaDuanmo (4 exrxfctytlm  auvsl(0t2uoxo3oy1ape  nci ()artr(  nu1aex mfciasla rlnvonu)texoxo iodfpD lnvo;s t2to(m no1ol   fvi s)artaxmpou1tpen ocias mDelnmp;u4tltoxfciodopDrlueils0setoir oo1lp emnvtat  rrr(ront0oltniictysfaDua(vonu4trtrxr tytopDranvol(0setoxo nu1ope micsatfsDrm(root0tetoiietltlaDem(mp (4 eenmfcta1fp ranvo t0s2toxm iy4aptemivia(faDta( pnt0apt  ocias a2rln s ()alxnmrcoa1om  lu ols s2xoxrpoy4om e fetas  Dururp;o1alto oeiadfs2rl(mpnt4 rermf3ta1fa elieo t0 rtm(m oy4ole mivt tfarrax ont1tetomoeiadlm uauvpn(4 lermf3iodop eaivs t) etmiopiu1al e nvsa(  2ra(ro;o0aee mo3iat a uln p;u4texomf ty1oatr nvi;( teurio ny4lmenmiet ()aDrmumooo1tet ioctlslm2em(vo () exoirciadlm rluei s0tetmir3oo1ole lnvi t aDrruro;t1apenmictas m2umu p;u)tetrxr3todfmDr u o s0 rtmxo iu1ll nmfvs (  Duru  ;u4opt moeiasla2ran sn() eeomf iy1oa   u ols  2umimpoudam n fctls arumxrono4aee  ietlsfa ea( pn(0trxoxf todlptr ivs s)s2umxo3iu4lpen ivt sf 2rmx p;o1alxniiciaslaDulnmp;u)alxrmo3tytlaD ln ils)sexm(r3ou1lmtnlnvils)arur(m ;o0alx if3ildfa rlnvp u0trxnmf oadfmD  nei t) rum(rpiy4oltnlnci s  Dtr( pot1oeen o3iasfs ea(mp t4trxrxf3todomte iei;( srxrxo nudoltnmfcslt srur(r no4aex  ocils a el( p;u4tltomf3oo1fatranvs;t0t2tmir3nu1llenlnvsls)sDrr(  ou4tlx iictltfm um( p t4trtrmfcoa1om ranvs (  rtrir iydlltnlfetas)aDrru o;o4opx ifctadfa em(vp;u0aeermociadlat  nei;(  2xrir iydol  lfcsl( sDrr(ro;o4tee moctyslmDemnmo;t4arxnif ta1fptrai sls0 rto(r ny4apt mfvi t sDtrxr nu0ope micilsla elnms;t4trtoxo oadfaDeli s;( t2xrim nydop e fctlsf 2raur no0tlx  f3ildfm2elnmo u4aleomr ia1omtranvs;s)srxo(r3nu4ll nlncsas)aDtmxr oo1oet mfeiydlaDemnmpnu0trtoxr3tatomDrlneolt)teurxm3oodop nlneiat aDtaump;o4tltnmo3iydls2umnvs;() exrmo3ta1fa elnvi;s) ruo(opoudalenmiesls  Drm(  nt4aexo fcias m2ranmp;u)aexomo oa1om r ies (0trurio nudlpt mfciatf 2um(  ou0texo f3tldlm rmumo;(4arxnio tatlm  luei ()s2xoirpnu4opt  nvs tfaDtaxrpou4aet micildlaDuaums u4 lerircta1faDe ieolt0 etrxo3ou1amt mfetas  2um(r ou4opx iiciad m emumo (4teeomfcoa1om  an o;()s2to(o iy1opte fet t)aDrrxrp;o1aptn feildfm2em( on(0artrio3iydfptrluvils)setoim no4amt liesa( aDuaurp;t0tptnioetytfa rauvp u0 exnxr oa1fpteln sl(0teurxmpoy4oltnlfci s) Durxrpnu4apxn icilt aDrm( p u0trerir3oo1om rauvsls  rxrirpnodalt  ivt s aDurxm nu4aexnii3iad s2uan o t) lxrmr io1fm r uvi t0tetm(mpoydam   fcia()sDuaxrpot0apt ifeiydlsDuluvp;u4arxoio iatfat anvolt0 rurim nodalee fvi ( aDrrxm ;u1apx miciysfsDulumsnt0 rtomo3iydfmDe nvo;s0trxmxr3oudlm e fctas s2um( oou4tleniieiltls uanmsnu0aetnxr3oydom ranes t0 eum(mpno1lm emivtlt  Dtaxrpot0teenmietlt s um( s;u)aetrxf to1omt luvs s) rtmio oydomtnlies t sDtmx oou1alxoio3iytfaDrl(mo;t0tleoir iydoaD aneol(0s2umir iy4am  mnviat a2rmurpoo1teenmfeiytfs umnvp;(4tleomoctadlp eauei;s s2to(o3no1ole  fci t a2rr(m ;t0tlt  o3tydla rm( pnt4trtnxf oatom eai s t0 exmio3oodll  mictls) rrau p;t4oleoifeiad m ulu p t4tlerxf to1fpDrlnei;( seur(mpiydamte nvil( sDumx p;u1tpe ii3ilsla elumo (4tlxnxocoy1fpD auvilt0setoxr3nydom   ici (faDtr( pno0tlenmi3iys m2rlnvs ()trtoxo3tatoa rau i;t0srxoio3oudlle  fei t)srtmx p;u1tpxnmfetld s2em(mpn(4alerxociodlmt  u i t0trumirpiu4apt mici s) rrmumpoo4ale ioeiyslsDemnmsnt) etnxr iadfpt ln ol(0 2trimpiu4ole licsas a2uax poo1opt ioeiat sDranvpn(4aexrif oy1lmD anvi s)s2urim3iodlmtnmfcias)sDta(m oo1alxomiciatlm2rmu pnu4trtnio ia1fmD luvols srxr(o3oo1al emfvi tfaDurx o;u4oeeoifetytla2rm(vo;(4 exomrciytopDraivilt seurxrpiu1ol  mietlt a2rmur ;u0texn ieiatfsDum(vs;u0tetrxo iadfmteliei;t s2toxo3oydal   ieilt)aDurxroot1oetoii3ild s2uanmpnu0alxnmo iadlaDeanvi;s seuoiopiudllt miesa( sDraxmp;o0oexniictatfaDelnmo (0 exnmr3iadla eau i;t) ruoxmpoy1omtemfci () 2uax  oo0apx iicilslm emumo;t)trtoxrcty1oat livo s  exr(r iodop   neta(farurx pno0apt mieiaslm rm( s;t0trermfcta1op  auei;t)t2xoxm ny1ol emics s) Drm(roou4aee if3tyd a2um( s;t)altomfctadfaDe u s t0t2urxm3oydlme lietatfsrtaumo;u1oleoifeiyt s ul(von(4 ltoio oodlp eanvi;(0setmxm no4optemfvil()a2rmxro;u1oexo o3tat sDemums t0aexrxfcoatfaDrau sls0s2xoimpiu1omeelfeslt  Drmx ont4optomo3tydfm rl(mon(4 ltomo oo1oat  iei s sexo(opiodll elnvsas srrmumo;u0texo ieiysfa emuvs u4 exrxrctodlatelnei;s0 etm(r3nu4ap   neil() Drmxrpnt1tlxn i3iytlm2em(mpnu0alxrircoa1lm   u sl(  2toiopoy4llee neiat)srumu  ou0ale mf3ils aDua(vs ()altoxf3iatfpD an o;s0trur(mpnodope lfcsas)s2urxmpno0oeenmfeiydlm2uauvo (4altoircootfat aueo s setmio oy4altnlfcslt) Dtrumo;t1tpt ifcils a ul( sn(0areoxo3iadlm rli i;( texrxr3iu1aleelfetasfarrmumo;u0aet mfcildla emnvo;(0tlxrifcoo1fmt  nvo s)s2xoio3oo1lmenlicia() ruru ont1alt mfetldlsDrl(msnt0alxnifcia1fpteln o ( teto(opno1ll elict t)s2tru o;t4oex ioctls s2ulnvs;t) rxrxociy1lp  anvi;(  exmirpio1ol elfct s)aDurum ot4aeenmi3tys sDeauvsnu)alerxfcootopt aneilt0sexmio3iydlpt  nviat aDtaumpno0opxomi3ild m2eanms;u0teenif oatfmte uvilt)t2uoxo oodalenlneil()aDrrxm oo1oetniictad s2rm( pnt4trtnxociytoptranes t0 eumio3nudop  mivt (fs2tmxro;o4opxo i3ildfa umuvp;(4tlxnxr3iatopDranes (  rxmim ou4lpt mfetlsf rtr( pnt4aetn oeiydla2el(mpnt0tltrir oytlm elnei;s0 2xo(m nu1opee iei ()sDraxrpoo4aptoiicild s ul(vp t)aetoio3ty1op eln i;()trxoxr nydolt mneta(farrrum oo0alxnmfciyd sDuln p () etoxr3oodom rlneo s s2tm(o3nu4apen netlt) rtrxr no0tle mi3iytla ua(vs;u0teerircoytopteanei t) 2xriopny1ll elivi s  Dtm(rpoo0tlenmf3iyd a2umn p (4treomfcoo1faDr n slt) rtrxm ny1amtemnvi s srraur ot0aet ii3tyt aDrl(vs t4teeomo tydopt  n i;t) eto(o3iu4oltelivslsf 2urxmpno0tetoifciatlsDul(vp;u4aexoiocty1fm r n slt)srurxr iydll nmivtasf 2tmx pno4opx iiciatlm ea(vs;u0 etnxrcoodlmDeli o t) exm(o3no4olee nvtas s2rrumpoo4aet mictlsfm emnms;(4alxomoctadoat  n o;t0t2uo(o nydllt lnvi t)s2um(mpnu4alt  o3iysls rlnvo t0 ltomrcoo1om eau ol(0srurxrpoodlpee nesa() rtaumpoo1olxnmiciltfmDemump (4artomfciotlpteln slt)srtoio iu4optemnct s  rrru  nt1texnii3iad mDrlump u)treoio tydlatr u olt)t2xm(r3oo4opt lnvias  2ua(  no4oetoio3iatla2eau p u0arenif3tytoptr ues;s) 2tmir3nodopeelfetlt)s2rruro;u4alx mo3tyd sDrm(mo t0aexoxr tytfp r n o s) rxm(r3ny1ll  mnesat)s2urxr nu0opx  f3iat sDemn pnu)texrmf3iy1fm r n o;t0 2ur(o3nu1lme lneia( srta(ro;u1altnifeiadfsDulu pnt4 lxrxo oa1op elnvs;()s2xm(opnudal n nvtas s2rrxrpno1teto ociad s2emu s t0aetnmf3todfm  anvo t) etoxr ny1al n icil( arrm( p;u0tleo fetyt mDemuvo t0tltomfcoodfaDr ies;()t2xmxr nydoptn fciltf 2tmump;o0tpeoiictld sDuaump u) leoxocta1op rlivols s2ur(opiydlmte fvils) rrmx poo0tlx ifctlt s raumon() lerir3iadlpte uvi t)tetrxr3io1lpt  ieil()sDraurpno4alxn fetadfa2umums u0tltnxo3tadoaDr i slt)setrir3nodlpenmfct sfa2urxmp;u1aee ioeiad aDrauvs (0alxnxfcty1op rluvo s)s2uoir iydll nmnvtat) 2rmx pnu0aexniociltla rlnvo t)texnmfcoodlmDelneo;t0 2xmxm iudope  ivsas)a2uaump;t1opxomo3tasls rmnvonu0treoio3totlmDeau i t  rum(rpoydalt lncsatfs2ua(mp;u4tlx miciydlmDumump;(0 leomr io1lptean i t s2uoxopoo4lleelivt sfarrr( ono1aetnmoeild m2uln snt)alxoir tytopDranei;()teur(o3oo1al   ietls) Dumxmpot1texomiciltfs rlu onu0altnxf todoptr n s ( sexm(mpou4lm nmfctas)srta( o;u0tlx iiciadla ranms t) rtomocoy1om r uvsl()s2urir nydapeemfetasfaDrrxm ou4oleomocildfaDeln pnt0tleoifcoydomte n il( tetoxr ny4ap   ict (f rrm(m ;o0ope  ociadfs2ulu o u0trtomr tydfmt au o t0 2xoxo nu4oltnmfetl(  rrrx onu1tet ii3ild m rmumpnt) lenxf to1opDrlneolt0 exmxo iydapt mnct (  2uaxronu4tleomo3iyt s2eanvonu4 lxrxf3tatfm  luei s0 rtmxm iodapt liet ( aDta( oot1tptomicils mDeaumont4teeomfctadomDr uvo;(0 ruoxo ny4am nlieiltf Duau  ;o1oet moctaslaDeau s;(0aexomo oy1lp  lueol(  2xoxm ny4al nmncia(f 2rmurp;u4aexnii3ilt m elu s (4 etomfcoy1lmDranvs;s0srxrxm ou4apeelneta(farur(rooo4apenmiciys a2ulnvp;(4tlerif oy1lp r u s;t s2xrim iu1amte fcs (  rtmx  no4ale moeiatlmDeau o u0 exoxociotfa  livsl()sexm(r3iudop elnesl( aDuaxrooo4tlxoii3iltla eauvsn(4alxomr3oydfpD ai o (  rtrir no1lmtnmivt tfa2tr(m ;t1tltomfctltlm2rmnmp;u4alxoxoctotlpD lnei;t t2xm(m iy4lp   fcs t a2tax poo0alxo ieiaslm el( o u0tlxnxo tatoa elu s t)teuoimpoo4amtemneiatf 2um( p;t0tet if3iyt m rlums t) eerxoctodla  aieolt)setmirpiodam n icslt)arurxrpno0aeen icias m2umuvs;t4 leoif3oa1lptr nvs;( sexmio3iy1optnmfetl(f rumx  ;u0tptoiocilt sDel(vo t4altoif3iydfm e nei (0truo(rpnodoptemncsa() 2rmx o;t0opt  fetls m uanmont4 ltrio iotoa  luvo (0s2umxo nudlpen ietat)sDur(  ;o0oex moeiyslmDea(mo;t4texoxo tytlp r ieo;t0texr(r3no1ll  lnci ( sDumum nt4apxoiieils m2rl(ms t4aexoxf3io1om  luvo t teuoim3iu4altnmies () 2umum oo1oleoiieiysfsDeln p () lenmr3oytopt  iei;(  2um(o iudlptn nviasfartaxro;t4apen feiatla2uanmo;u4artrmfcoytfp  lu sl( t2tm(rpiu4am  mfcsa(fs2tru  ;o4oexoioeiad m umnmp;u0artnio3iodlm  lnvil(0texr(r oy1ll nmnci tf Duaurp;u0oee if3iyslaDrl(ms;t0tltrio oytfa ean il(0s2xmio iudopenlieil(fa2uaur ;t0alenmfeiys s2rauvo u0 exomo oodla eaivi t)sexm(rpiydamenlfeilt)srrmx  ;u0aeenifcild sDrauvsnu0tltriociy1oa eaivil( t2xr(o nodolt lnvi s) Duaur ;t0oet  iciasla2emn snt0 etrir iy1oa rliei;s0truoio oy4lltelnet (  rrr(ront0aptnifeiadla ea( o;u4tleomf oa1opD lu s;t0tetrxr3no4oltemfvt ()arur(r nt4oex mietlsfm rmumsnu0 exoio oa1fmt  ieilt0texrxmpoodlltnmictls)a2trum ;u4tpenio3tysfmDelu p u) renmo3oa1lm r iei;t s2xoxo oodomen icia( srtmxmpot0opt  fetysfa2uan pn() renif3ta1om  anvs t)teto(r no4lmenmivia(fsDrmu  no0altoifeildls2rl(vonu4trxrxocty1opDe u ol() rxm(r3nu4aptemfcia()srrm(m nu1olxnii3tad s2ul( s t0arxrmrciodfptrlnesls0 rxrxm oy4om e icias  Dtaumo;u1apen f3iltfa eanvp;() exrxr3ootlmD lnvs;(0trtr(r ou1ll nmncs t arua(mono0aee  i3ias mDrmu on(4aetnxocty1lp  lu o ( trtoxrpoodoltnlicsat s2tax  nt0alx mfeils s2ea(msnu0tltrmf to1fmtr ues t teuoxo3iy1olen feiat) 2rr(mp;o1optoifetlsfm2uluvs;(0 ltnif oadfaD  iesls0s2to(o ny4om  mneias aDrax p;o1aet mfeiytfaDum(ms;u4arxnir3tytfmteauei;(0trxm(m iy4amenlicias) rtr(mp;u1tlx mo3tyt a2uluvon(0altoir todfm ean ils)seuo(o3iy4ap   ict s sDrm(m ;u1tetnifctysfm2emn s t0trtrmo3oydoa rli sl(0s2umxr3oodolte ictatf rra(mpnu0olt iiciltlaDua(mpnu4 ltnxr3todfa eanvs t setmxr nodlmeemnvt tfa2ua(rp;t0ale  ociytla elu sn(0 lermo3oydfp   ueil(0teumxrpiudame mictlt aDuaxr ou1oexniocilsla um(vsnt0arerir3oodfatr u s;( trtmxo3oo4om  lnciat)a2umum ou0oetn o3iadfaDem( o t4altriociadoa rln i (0 exr(opou1ol emfvt ()a2rmum nu1tlt mieias m ran pn() rtrxr3iotoa rauvsl()t2trio3io4lme mnesa(  rrau  ot1aexomf3tydfm ranms;(0tlerifcoodoa rluvi;s  2tm(rpiodll nlfctlt)srtmumonu1optnmociytfa rmuvsn(0 etnmf iy1la  ln o;t  2tm(o3oy1al e netls)a2umuro;t0tpe iietyt s2rl( p u0trtoxfciadfpt  u s s  2tmiopoodopeelfeta(fsrurumoot4tle  icils m2ra(ms u0alenif3iy1oatr ueol() 2toxo3iydll e net sfsDumu pou1oexo ieiadlaDranms t4alxoir oytlpDr uei;t sexm(o iydop  mnct sfarrau  ot1optoiociyt mDuanvp;()trxoxocia1fmt au i;s0t2umxr ny4om emfvtl(f rrmu  ;o4apxn icild a2rl(vsnu0aeenirctydopDr u slt texoxrpio4omt  fvslt sDtrxmpot4aptnmietad m2rmuvp t0texnmr iotlat lnvolt srtm(o nodlmeelfet s)artrurpnu0aet mfeild mDemn p u)trtomfcoodlatr ues t0tetmir3nydomtelici t)aDum(r nt4oltomiciltls2el( onu4 leoxf3ia1lm   ies t0trxr(r3oo1am  mfcia(f Durx ono0openmf3iltfm ulnvs;t0aeenio3oydomte ueils s2xr(o3oy4omeemfvtltfs2rr(  ;t4tetoif3iasfaDem( o (4tlerxfctadfm  lnei;s t2uoxopiu4omeemnct t a2rm(mpno1alxnmo3tatlaDranvp;u0aetnio3todfaDeli s;t)trxm(m3oy4ap e fcta( aruaxrono0tee ifcilsfsDranmonu) eeomf ia1oatran olt0 rtrxrpnodlmt lnesas srtmxmpno4apx mfeildfmDeau o;t)tetomf3tytlmDrlnvolt t2tmiopoydam emnci s srrm(  ;u1aeto ociltfa2rl(vs;t)aleoir3iy1lpt  i sls0 rumxm iy4altelivi t) rrrump;t0aexomoetyd sDua(mp (0tlxrif oy1op eai i s0t2toxo no1oleemivtlt s2rm(moot4altomf3tysfa2ean s u0 lxnmf3oa1lm eai slt)sexo(m3oo4ll   fciltfaDur( onu4olx  i3ildfa2ra( s;u4texomo3ia1om elu s () rtm(m no4ap elivs t sruaum nt1olenmoeiydfmDea(mpn(4aeenxrcoadlpteau i;t)texrim ou1am emneia(f 2ta(  ou1apxnioeiydfaDrmu s;t4trenifciytlp r ies s setmiopoy1ll  lici () rtru  ot1oeto oetydfa eln p;(4trtrif3iydoptelivo;s)t2trimpno4omeelfciat sDuax  nu0altnif3ildla2ulnmon(4arerir io1fp eauvi t)sexrxo3ny4lpen fvsl()srra( pno1altoii3ild mDra(vpnu0tlxoxf iy1lmtraivo;s0tetoxopnu1al nlncs t sDum( ono0apeo oetasfsDuln p (4 exoio io1fpt an olt0srurxo oo4lpenlivtlt s2ra(mp;t1tle ifciadfs2uanvon()teeomo3ty1om   uvo t0sruo(m oo4lmte ivs tf rtmxmp;o0aptnmi3ild sDranmsn(0tlxrmr oatomteanvs ( seto(m nodlpe lfvilt) 2rmxrpou1tptnmiciasfa2el(vp (4 exnifcoydfpte neslt0s2urir3iu1om elfvia(faruax p;o4tle ifeiadfaDua(vp;()aexomo oodlpD  ueo;t tetm(mpio1ap emncilt)sDtaxr ;t0texn ieiaslm rmn s;u) rxomo oatomtr ivo s0t2to(m3io4ll emfcils)s2tmu  ou1olxomoetasla ul(ms (0aexomo oatlaDrli i;s0trxr(opiu1lm  mnvs s) Dtmumono1teenmi3ilsfmDemu s;t4trxomr tadfaDean i;() 2tmxm3ny1open nvsls) Dum(rpot4aetnmo3tyd m2umuvs (0 exomfciatoa r uvi s0srtr(mpno4lpe mieiat)arra(mpnt4oeeomo3iydla2el(vo;() rxrmr3iodlpt luvi (0srxmxrpio4amt  ieilt)sDumx  ot1opeomictysfsDum( s t0artnxrctydlptelnvs t0 exrio iodlp nmiviltf Dum(mp;t4aptnmi3iadls rlumo t) ltrmocoo1oa  li i (  rxoim3no4lltn ies t)srrrxronu4tex ii3tls mDrmums;u0 rtnmo3iadomD  ueo ()trxoxm3iy1om e ictlt)arraurpnt0tpxn octat s2eln p u4arenmfcoytopt ai s;()srxrxmpiu4ap nmiet tfsDtmxro;o0ope ifciltlaDum( s (4trtnxf iytfmDe ivolt)trxoxrpiudlpeelnvtas a2trurono0tex  fciltfa2emnmsnu0 exomo3ootopD  ues (0s2uoxmpiydamenmnet (f 2rrxmpoo4apx  iciadfs2ea( p u0artnio3ta1fp  anei ()s2xr(o iydlmtemnvtltf rra(r ;t1openmf3ildfs ra( pn(0 etrxf3iadfp e i i;s0srtmxm oudlmt  icta(f 2rru ooo0ole iieils m ulnmon()aeenxocoy1lmD auvsls  eurxm3oydape miesl()artmurpou1tlxoio3ilt m2emnvsnt4treomfcoy1fpDranvilt  eur(opoo1om  livi ()arrr( ono4olx iietytls ra( o;u4 eeoxfcta1oa  an olt  2toir oy4opee nci (  Dta(rp;u0tlxnifeiasfs2rlnmo;(0texrmr3iatfmtraies ( sexmiopiy4amtnlfesas  rraumoot4apto ietat s rluvs;u4tetoxrctotomD lies;t0 2xrxo3oodlle lfciasfs2um(  no0tleo oetytfa2ea(vp ()arermf3oy1fa  lieo t  2uo(mpnudoleelnei tfsrrr( p;u1altoifeilsfm um(mp;(4 lxnmoctodfp  aneilt0tetrio oy1llee ivsls a2rrurp;t1olto oeilt mDrlnmon()tetoxrctydfptrluvs s0t2umirpoudalt lfvia(f 2tm( oou0ape ioetld m2rluvp u4treomfctodlm  ln i (0s2xmxo oo4aptnlneslt aDrrurpot0tpx ioctaslmDea(mpnu0 ltrio3ta1omt  iei s  exr(opny4opt lict s sDum(mo;o1aeeoifctytfaDulu p;t4texomrcto1lptrlivi t) exr(o3oy1altemnvta() 2tmu  oo4tlt mfetlslaDeanms;t0alxoxf3tytop r n s (0srxm(o ny4omte nct sfs2ua( p;o0alx if3ilsls2emnmo (0areriocoydomt  neo;s  2trxrpiu4ame miciat)s2ta(mpou1altn ieiytfs rmn s t4aetrmfciodlat  nvo t0sexo(rpoo1omeeliei sfsrua(mpoo4oex ifciydlaDra(mp;t4tetrmo ootoa  ai sls0s2tr(o3nodomt lfes (f 2ua(  no1teeo ictat mDumuvs u0trxrircoydfm eluvs;( t2tm(o nudlp nmietlsfsDtm(rp;u0tet  iciatfs uan onu4tlermf3ia1fmDeaiei s  eur(o oo4lme licsl(  Dtmumoot1optoifetysfa2ul( p;(4 rtomr ootfpDe ieo t0sexrio3ny1lptnlies t) Drrxmoot0ape  octad mDuaums (0 exnif oytlate uesls  rtoimpoydal nlfet (f Duaxrpou1texnmociaslm2rm(vp t0alxoifcty1la elneolt0 ruo(m3oodlm eliei tf 2ta(  ;u1oltomictltfsDranvp t0aexoxrciy1latranvo ( s2umim3iu1opt livtlsf rta( o;u1texn i3iytfa2elnvo u) lxrxf3iytfpDranei (  exmir iu1omtemnesatfa2uax  no4tet ifeiasls2rm( o;t)aetoxrcoytopD lieslt t2xrxm oudlmte fctasfsrur(rp;t0oexn oeiydfsDrmnmp;(4teenxrciotfmDrlivs t)trum(opou1lptn ieia(f 2rrumono4oeeomiciatls2rl( ont4trtomo iytlpDe uvils t2urxr3io4apen iei tfaDtrxr nt1openmocilsfm rl(mp u4texnmf oatlm  lnvslt0s2urxrpou4lm nmneta()aDtm(m no1teeo fetys sDulumo;t4teenxo oydlpDe u slt0texr(mpnudlmenlnvi s aDrmxrp;u4oltnmi3tadlmDuauvo t0 rtoir3oydomDrlnes s)teumxrpoo1ole miesltfa2uaumo;o4aeeo ietltla ranvp t4trenmf iatfaD anvs;s t2xm(r3ny4amenmivsltfs2tru onu4tee mi3tldls2umn s u)texnxo oo1omDrlieils) etmir3oodom nlfeil( sDrmxmpou0oexomieiadfsDrluvsnu)aleomfcia1om   nvs;s t2umxo3oy1apen iviasfs2trum nt4texomoeils a eluvp;u4 ltoiocoytfpt auvs;s0s2toxm3oo4omt  nvi () rrr(r oo0ole  o3ilsfs rln o;u4 reoxf iodom   uei;()s2umxo nu1op e fvtlsf Dtrxmo;t1aleo o3iytfmDulnvs;t) rerxr tatfateauvs;s)trur(m iydlp  lncilt) rta(m nu0teen ieiytfsDua(vp u4tlxomf3to1fm  auvsls0s2xmxo oy1lle mfviat s2umxmpnt0apeoifcild s2eln o;(4tetrio oodlate nvi;s0texoxm ou1optnmfes t s2tmu o;o4aleoifcild aDra(ms;t4 etnmf iodfaDrlneo;() rtmxrpiy4lmtemfei tf rum(mpnu1oetnmf3tlt s umuvsnt4treoio oydom eauvslt0sexoir oydomenmfcslsf rrmu oou4aeeniiciltlsDua(mo ()tlxoir ia1laDeanei;t0 2uoxrpoodomee fvilsfsrra(  ou0oexnif3iyd m2ra(vp (4tltrmocoy1fa eaneolt s2xmim3iydlm emivil( s2rrx ooo0tpe mi3tydls2rm( o;u4aetrxfcoa1oaD ai il(0 rum(m nudll e fctat)a2taxmp;o4tlt  ictlsfsDrmumont)artrmf iytlpteaues s truoir io1omeemict t  Dur(mp;o0oet  o3iadfa2emnvsnt) ltnmr3oa1lmDr u i s0sexoimpiudlpte fvia( srtrxrooo1tpxnmociadlaDem(ms;u4altrmo3oatoatr ivo t sexoxm3oydlp n ivta( arum( ont0opxo ictlslmDem( o () ltomr oa1fmte uvs;(0 etoxr iu1alt  iesa(fsDtaxrpno0apeo o3iysfm rmnvpnt)aeermf tatlpD  nei;() rxmxopio4lpenlfviltfsDtaumo;o1opt ifctls a um(mon(4trxrmfciydlpDrlnes;s0 exmir3no1lle lics t s2tauroou4oeeomf3iatfa2rluvs ()aeeoif3iytopDe n sls t2to(m3iu4lpeemieias)a2ua(moou0aexnii3tadfmDuanmp;u4altoxr3oydlp r n o s0srur(m3iudop n nciatf 2ra(rono0tetnif3tys m2ul( p;() eeoxo oatfat  uvi;t  2xoxm no1ap nmivtl(fsDumurpou1oexoii3iadla2rm(vp t0 rtoio totoateluvsl( s2toio3oodomt lncils aDua(  no4opx iociadls uln p;t4 ltoirciydfpD luvs;s) rtrxr oy1aptn nciatf 2rax o;u0aetomfctlsfaDelnvont4texoifcoydoa   nvo;s)s2tr(mpiu1lp   fvtat aDtrur ;t1tleniictld mDua(mp u4 lxnmocty1opt au o t)t2xmimpoudam elfeias) 2trx  no1opxn octytfm2rm( s t) lenmfctadfmDe n i;t tetoxm ny1omen netat) Drr(r ;o0tpenmf3iydlaDumumonu0 ltomo oodfmt  uvs ()s2xm(m3ou1ale  nvs (fa2taur nt0tex mf3iadla2rmu o t0trtrir3iodlptelnvolt  2toxo3oy4omt  ivtas s2ta(r ;u0olxnmfciasla2ua(vs;()trtnifcto1lmDeauvsl()seumiopny4optnmici t) 2tauro;t1aleniocilslm2elumpnt4 eermrcta1laD an o;t srto(m3oy1ol  mnet sfarrrxmpno0tlx mf3iytlaDuluvo;()alxoxo ootlm ran i t)srtrxo3ny4alt mnctat  rum(rpnu0ale  o3iasfmDul( p;u0artomr oatopDraies;t0 2urirpnydopenliviatf rra(mpnu0aptoif3tas aDrl( s t4tlenxrcootlmtr n o ( truo(opiy4omtnmncs t srurxro;t4ole  ictasla2el(vonu)trenxf iy1om eaies;t) rumxmpoy4omtelfetat)arum(m ou1aexnmi3tad aDelnvpnu) renxr iatopDraueo s) eur(m nu4omtnmfes tfaDraurpno4open ietadfm ulu p;(4alerxf oydop elieo;( s2xrir3no1openmnvi s  2rax ont0tpe mictls sDelnvo;t4tlxnmf3oy1lptraivo;()t2xmxopiudamtelnesas a2umx pou4olxnmfeiadla2rlnvs t)tltnifciodlm   ueo t) eur(m3oy1al n fetlt a2taurpnt0apx mociasls2rm(vo;u)tetoxf3to1lpDraiei t  rxr(r iydllt  nct s sruaxmoou1texn iciaslaDranmo u4aleoxf tadomD ln ol(0 exoirpio1alt  nvt (  2tmu  no0tpx iietadfm rm(vsn()texomf3iatlat  ivo;t) rtoxr io4am  liviatf Dua(  ou1tpeoiiciydfmDel(vs t0 eenio3tadlmDelivi ( t2xr(rpny4lpt  fcs tfs2ur(ro;t0aexnmf3iadls uln o t) lxrxo3oodfa  lnvo t0trurxrpny1lleelies ( a2taur ;t0oetn fctydfs rm(vs u0treoio oodlat  i s;t) etmim3oydlpt liei ()aDuaxrp;t1aet  oeiat s2umnvpnu0 rtnmf3ia1late ueolt)srtmxopoo1lltemnesas) ruau  no1tptnii3iytlm rauvp;t0aexnmrcia1fmt aies t trtoxo io4op   feia(fsDrmuroou0tptomocilsfm2uln snt0trerirciotoat  ivols)srtoxo3oo4ape lfvsatfsrta(r ou0optoiicilsfs um(vo;t0tetnxrciadfmt livol() ruo(opiy1lpenmicslt)srum(ront0alxn ociadla uanvon(0 rerifciadlmtraueo;(0teum(opnodlpe  nci sfsDuaumpoo1apxnifcias a emumont0trenmo3ia1lm r neo;s)t2xmio oodlm  miet t)srrr( pot4oexo i3ias s uln o t)artrxf io1fp rlieilt0tetmxrpnu4lltemnctltfsDta(mont4aexomfcias aDemu o;()arermf3oytfa  liei;s0sruo(m3iu4omen feslsfs2raxr no0tlenmf3iyd m2umn s ()treoxo3io1opDrlivi;t0 rurxm3io1lme lfet ()s2ua( pnu1tlxnmfeiltls ua(mp;()tltnmo totoatr uvs s0 rur(o oodomt mfvslsfa2rmumo;o4tetomo3iadlm2uln pnu0alxrmo3oytlaDraivo t0 2umxm oodapee fcsls)aDtauronu1optnif3ildfm ulumo t4aetnircio1fmDeauei;t  rxoirpoy4ale mnei ( srurx o;u1apen ietasfa ranvsnu4trxrioctytfmt lnvs s0 rxmxrpoo4lmtn neslt arurumont4openmfeiysls rau p ()tlxoxr3iodoa  lnes (0trxmxo3ny4ome lnvia( artau oou4tleo o3iadfs2um(vs t0 lermf3todoaDr uvils trum(r3iy4lpeemnct sfarum(rp;t4aeen ociaslmDrmn o u0arxrir3oo1oa rlieols)s2xo(rpnu1op   netas  Dta( pnu1aleomo3tyt a2rl( s;t0trenmoctotfm e n il( seumio3ny1al  mnctat s2trumpot0oexoiociatlsDrm(mp u0 leoxf3oa1op ean olt)trur(r3oudlm e fet ( a2urx pot4tpenio3tas m ul( on(0texoxocoodlat  neilt)sexrxrpiu1lmeelivtas srrmxro;o0teeoioctatla rl(mon(4 rxnmrcia1fmDrln slt) 2um(rpno1ape mies tf rurx o;t4texn o3tysfs2ua(msn(4alxnif iytfat  nvo;s)tetoxo3ou4omtnmiciat)srra(roou1aetn o3tydlmDeauvo u) rtrxociytlm e nvi;t0trtoxm3oydlle  neiltf rta(  ou0tpto ieiadfs2eau p (4teeniocoatoa  au o;s seuo(mpny4apt mnes ()s2tmx  nt1tpe  ietyd m2rmnvp u)aetoxocoadlptrlivi;s0t2xm(r iy1om n net s)s2uau p;u1tpenmf3tlsfm2el(ms t0 eermociatlm   i o;t  eum(o ou1lmtnmfcsasf Dtmur ;u0texomo3iys s umnvs u4alxrmrctydfpteanvol(0 2ur(m no4ll n netat)aDrr(mpot4olxn ieiatls emn ont0areoxo io1fate n s;t t2uo(r3oo1apt  ivsls)artaxmpot0teen ictltlm rlu s t)altrmo oatfa eanvs s truoim ou4lle  fcia(fsDtaurpnu1tlx if3tasfsDum( o u)tetoxoctatopDeluvs;t seur(r3iy4op nlictatfa2tm(rp;u0opeomfeiat s ulnmpn(0alenif oodfpD liesls)teum(opiu4ole mfeta( aDrr( p;u1tpen ociadfmDrlnmp u)trxnmocia1la eanei s)seumir3oudope mfviat)arta( poo0tpeo i3ildls2ean pnt0 lxnmrciatfp   u s;(0srur(r3nodlme  neias sDraurp;t4opto f3iatlmDelu s (0tlxrirciadfaDrlivo;s  rtrxm3ou4al nlieta(faDrmu  ;o1apto oetat m rmu s (4 exoio3iadomDrauvs ()texrxmpoy4lm   fet t aDtrumoou4oex  o3iadlm rauvp t0aexrir3tadlptr neo t0truoxmpnudomt  fctat  2rrumpnt4ole iieilsfm rm(vpn()trtoifciydoat  u ils0 etm(mpiydopenlivta( sDum( ooo1tltn octlt sDrmnmp (0 lerir oa1la   ivo s)s2tm(m nydop  liviasfsrrrumpou4aexomf3ilt s ulumo;t4 rtoir iadfmtelu o t) 2uoiopiu1lmte iei ( srta(rpnt4apx ioctld m ean ont)tltriocto1lm elnes;t)srum(r ny1apee fet ()s2umuro;u0oeeo f3iatfmDuanms u) eeomr oa1fmtelu sl( teuoio oy4lpen fctl(fsDrm(mpno1tptn octltfsDra( p;t4aeenxr3oa1fpD lnei t) etm(rpnu4aptnmfetl() Drmx  ou0oet  octlsfa2el(vo t0altrxr3oatfmte i il( tetmim3ny1omt mfci t) rrmxro;t4oee mfctad a2ra( onu) lenxfcia1oaD  u o t)t2ur(o no1lpeemfcil(fartr( ont1tlxnmi3ildlsDeauvon()alxoxo tadopt  n i;s)srtmxo3nu1alenmncils)aDua(mp;u4tpxnmicilsls2ua(mo u0tlenif3oydfp e nvs;( sexmxr3no1lp n fvtatfs2rmu  nt1alenmociatfa2eauvp (0alxoiocoytomDe n i (  2umir nydolee ivs s) 2ur( p;t4tlxomfetlsfaDumnvo;t) lenmrciydopDr u s;s)srto(m3no1lp emfviat)a2tmurooo1oex ii3iatfs2umnmpnu0trxoxr3oytoptrlueo s t2uo(r oo1aptnlfetlsfa2raur oo4tltoifeiatfmDem( on(4 rtoir oydlmD  i sl( truo(r3io4olee ici ( srumxrpot4altoio3tlt sDrm(mp;(0tlxnif iytlp rlivi s)tetr(m iydlltelncil( aDumxroou1texoiiciyd m2ra(mp;u4 rtnio iodopD an s;s)sexriopnu1ll e fcs tfaDtr( ono1olxnioeildlmDra( pnu0artnxo3todlaDrlnvs;s t2xrxr3oo4openmivs t a2uau  ot4tpeomieiytlm elump (0texoir oa1omtran s s  2umxr nu4om nlnviatfa2rmu p;t4apxniiciltfs ul( s u4aetrmr3oadlm eluvsls0 2xrxmpou1llee iviatf rrm(r ou4oeenif3ils aDrm(vo;t4 rtrxf3tadfateai i (0srurir3io1apeemnesl(f 2trx ont4apt  o3iat aDrm( pnt4teenifcoa1oat auvs;t0s2xrir3io4olte nvt t)aruax poo0tlxoioctyt sDrln onu) rtrio3oa1oat au s;t0trxoxo3iy4ap   fviasfaDtr( p;t1openmieildls2eau p;t0tetoxr todop eluesl() 2urxrpnu1llee nesa()aDua( ooo1apxniieiadlm rmnvont) etrmr3totfpDrai i;(0trtmir3nodlpe lnvtl( srtmxmpot1aee if3iltfm2rau p t4teeoio3ty1opDelnvi;(  exoxo oo4al   fei s sDuaurpou4apeniieildfsDrluvs t0aeeomrciotlpDean ol() exrxo3oudllt lnvslt sDtrx o;t4tetnii3iydfm elnvo;t)alerxo3iy1omtraivs s)t2xoim nodlltelnetl() rua( pot1olxo fciltlsDuln ont)tetomf oy1lm rlu ils0s2xo(o iudlptnliei tfs2rauronu1olto fctad a2rl( o;u4 exoxrciy1omDr ivi;s)seto(r3iu1amt livs s)s2urx  ;o4opx  oeils sDra(mo;t0treoir3iytomD an sl(  rtoio oodlmee ics s) rtauront1teeomociltlm2rm( p;u)arenif tadlpt an ils sexr(r iy4om  lieslt sDumx pnt0alx moetltfmDra(mp ()arenmf3tydla  luvs;t0 exm(m oydlpee fcilsfaDta(mpnu4optniieiytfs2rm(mpnu4trermr3tydfateaues ( tetoir3iydam  mivsas)aDuax  nt0oleniictldfaDraums (0 ltrxo3oodfa eai s;s0trxoio ou4ale mictltf 2rmx  nu4aleoiociyslmDul( o;u4aeeriociatfa r neil()sexrxr oy4altelnetasfs2taxr nu0aetnif3iadfaDrau p;(4trtrmo3todoaD livs t t2umir3oy4om  lfvtatfarua(r no4alxniociys mDemums u)altnio3iotfmteaies;( texmxr3oy1lpt lieias) Dtaxrp;o4oetomoeiyt s2ulnvon(4 lermrcia1om rai i;s0seto(rpio4omtnlivias arur(rp;u4oleomfctlsla uanvp u0treoxrcoa1oat au ils)trtoxm3iy4apt mivtas  2taurpno0tpeoioctatls ranvsnu) lxoxr tatopD aies;t)trurim3oudlp emfcsa(fsrtrxr ;o4altniieiatfa2eluvs t0 lermr iy1latrlneil( seum(rpiu4ale miei sfa2rmurp;o1alt moeiytfs umnms (4trtrxr totfpteaivols srtmxrpio4ap n nci sf 2ta(  oo0aptoio3ias s2ua(msnu)alxnir3oy1fmDr neolt trxm(mpnodolt  icilsfaDuauro;o0apxoif3tldls2rl(mo t4arerxr iydfp elu ilt)sruriopoo4ll  lnvt sfa2tr(rp;o0aleoiiciatfs umumo t0 rxrif ta1fptelueilt0 exr(opnodolt livt s  2uaxroou4opxnifeiltfaDrm(mp t)aeeomr oytfate ieil()seurxr oydol  liet ( s2umurpnt4oeeomociatfm ranvs (4 etomr3iy1fa   iesls0trumxm3oy1ale  net t s2raurpou4tpen o3ilslaDrlu on(4altriociydopDr i s;( setoxr3oy1llee ncslt  rtm(moou1tlx mfeiyslsDul(vo u4trxomrctytfaDeli sls0t2xo(m oy4ll nmfcsls)a2tr( oot4alx  i3iadlsDumuvsnt0tetnif3oo1om  li i ( sruoxmpno4olt lfetl(fs2urxm ;t4optoii3iasfm2emnvs u)treoxfcoytfp ean il(0seurxr3oo4optn iesa(farumx  ;o1apxomocils s umuvonu4tlxrir3oytlp   u s;s0 2xoxm iu1lm   fesat)artaur oo0apxo fctyt mDeaump;t0 leomo3totlpDraivi;( texmxo nu4lleemiciatfsrraxm ;u0aet ioetltfm uaump;t) ltoio iatfaD ai s t s2umir nydaleemivsl()s2tmu ont4ope mfciasfa2umnvonu0alerio3ia1lp   u olt)teur(m nu4lpeelivs t) 2urx  ou0alxn feiaslm2emumpnt0alxomo totlat lnei s srxoxopiy1apt lfcsatfs2umurpnu0tlto iciltfs2emnvo;t) exrmr tytfaD  ieo;s texoxo iudomtelnvs ( arumu p;u0tltomo3iatfa rmnms u4artrxocoytoatrli sls0srum(r3oy1amt  fvsasf Drmx o;t0tpxoiiciad mDuluvpn(0aexrxo3tytfmt aivols0teuriopio4llenmictltf Drrumoot0tlxo ictas a2uauvp t) lxnmociadoaD  uvo t)t2uoxrpiu1ap   feil() Drmurp;o1aetoii3tad sDumnms;(4arerxr oatom  aues () etoiopny4ale lfvsa( a2um(ronu4opt mf3tldfs eanmpnu)texnmr tatoaDe neils)t2uoxo3iudom  mivta(f rtrx onu0optnii3ilsla2um( onu)altrif oy1lmDrai i s) rxrxrpnu1om  livs t sDrm(  nu1tee  iciad aDeln pn(4 ltoiociy1oaD ln o t srtmimpou4opt  icil( s2tm(m ;t4tee mocilt mDra(vpnt)tltrxrciy1fp   u i s0s2xmim3ou1olt mfvt tf rur(r ;o0oetn oeiydlm2um(ms;(0 lxrmr3tadoaDrlu s;s0trxmxr io4lp emieiatfsDumumpnu1tpxnio3tytfmDelnvonu) rerir3iodlaD  ivsl( s2umxo3ou1lptnmietls  2rrxmpnu4oeeoio3ilt sDea(msnu0arxrmf oadfpD lnvo t0t2ur(o3ny1ap elicsas)sDraxr nt1tlxn i3tldfsDrm(vpn(0trxnxf iytom eaivs;t0 2xrxr3ny1ale  nvtls)arrmum ou4tpto fciytlsDemn p t0 lxrir3ia1fm elu il( setrio3oy1lle lfeilt)sDurum ;t4alx ifetad s2uaump;t4 ltrxr oadfpte uvs (0srtm(m3oudlmeemivtl(  Dtmur nu1tetnmo3iytfs2emn pnt4aexrxo ia1lpt li i s)teurio3oydopeelnesl( a2uaump;o1aeeoifeiasfa2umnvo;u4artrir3tytlmD lues t)srurir oy4lm nmnvt t srua(m ;t0aeeoio3ias s umnmsn() lxnif ty1la eaies;(0tetoxo oy1lmtelncslt)s2rmxr ot0alxoifciadfm2ea(vont4arerxr oydoa  lu ol( setmio oodllenmivtlsf Dtaxmp;o1olt mi3iatfm eauvp;t)alxoxfciy1omte u sl() rxr(rpno4lltemnctlsf rua(mpno0tle  oeildfa ea(vp;t)areomo3tatoa eaneol()texmir3nodap nmnvsa()a2ur( ont1apeo ietydfaDulnms;u0 rxomf oytfaDrai s;(  rxo(r3io1amtelfvsas sDurxr oo0tltn ocils s ea(vp (4 eerxocta1lmt aieslt) rxr(o3oydale mfvsa(fsDumu p;o4olt mi3tat aDelnvon(0treoif3oy1oa  lieil( t2xmio3oy4ol nlnctatf 2umxrpot4ole  fciltlm2emums;u0artoir3iy1lpt  neol(0seumxopnodll n fcil( aDuaumo;o4tptnmi3ildlaDel(vp t0teenxo iy1lmt  n o;s0teur(r3oy1om  mictatf rumumpot1opt  ictld a2rauvs u4 exnmo tydlp r ivo;s) etrxmpiudame liesa(f 2rrx poo4aeeomi3iasfm rmn o;(4 exoio3to1lptean s;s t2to(opio4om  mivsa( aDraxm nu1altnmieiat m rauvpnu4 eeomr3iydlm rai s s  rxrir3ou4om e nctlt) 2umxrpoo0oee mfctydfs2rl( s;u0artoxf3to1lpDrauvo s)teumxo3nu4al n icta(fsrtr(mp;o1opx  oetytfsDumumsnt4texnifcoodlaD ln o;t)s2xoxm3iydolenmfcs t  rurur nu0opx io3iytfa rm( pnu0altrifcoydomtr nvo t0texoxr iy1ll   icsat)arumxmont4opxo octytfm uau snt)texoif io1lm r n sls) ruoio3oodoleemics ()s2tmxm ;t0apx  icias mDulnvp u0arxnio oydlmtraneo s0tetrxo3oo4lpenlfet t aDrax  no0tetoioeilslaDumnmo u0alxnif iydlm  lnvi t0t2ur(m nu4oleelicil(f Duax  oo0oeenifciltfm2uanvsnu0 eerio3ty1fa  aies;t0texoirpnu1ll emneiltf rrmxmpou1tpxnii3ilslm ea( o;u4areomocty1lpte u slt t2umxo nu1olt miesl( aDtr(rpno1oleo f3iaslsDem(vs (0artoio oytfateliesl(0 etrxm oodamtelnvt t)arrmurpno4tlt mo3tltla2ra( snt0alxnmocoo1fa r uvilt0t2xo(r nydaltn nes t) 2ra(r oo4oee ioeiadfmDumnmpnt4 rxoxo3io1opD  ivo;(0tetm(r oudoptnmnvt (  2umuroot0tpenmiciasfm2raumo;(0tlenifciy1lmD  ivi;(0s2to(m3ou1altemicsat aDum( oou4oeeoii3iyt s emnmsnt0trtrmo3oodfp e n o t)trtoiopiu4ll e fei (fa2trum ;u0tptn f3iys mDrm(ms (4areomo ty1la e ieo;s0teuo(o3nudol   fctlsfarur(ro;u4aee  oeiltlaDulnvs;u) lxrmr3tydlp   uei;()trum(rpnudam nmfet (  rua(rpnu4apt iicilt m rl(vs;u)texrif iotlpDeauei t s2tm(opoo4olee fvil( aDtm(m ;t4aex if3tyt m uln onu) lxoxf3oy1lp eli il(  2uo(mpou1lleelfvsl(f Drr( pnu0opxnmo3iytlm2uan pn(0 rerxf3iydla elu slt0 etm(r3oydop emnctatfaDurx  no0altoifctldlm2rauvp;u0artnxo oadomDrauvols)trur(m nodol  mnvsa( arum(m ;t1tpxoifctatlaDeaump u0tetrmf iydop e i s;t  exoiopoo1oltnmfes t aDrmurp;o1aeeoifciad mDulu p;(0 exrxo3ootla ran o s0trxm(rpiy4alenlnciasfsDtr(mo;t4aptomfcildfa um(mo;t4 rtoxf ootfatr ues;s)setmir3nudamenmfetls)sDuaurpnt4tpeo i3iyt a elu o;u4 rtnxo3tytfatrli i ( seuoxm3oo1aptemfet ( srrru pou1apxoifeild a uauvsnu) rtnmo3tydfp elnvi s  rtrim oy1opt mics t  Drm( o;o4opt mieildfa2eln pnu4alerxocoatop e ues;( seurir oo4ame mnvt s) rtm( p;t0openio3tatlmDea(mp;u0altoxr todlm  aueils  2trim3iy4lpt lietat  2rmu  no1ale if3tls s em(vs ()aeeoiocoa1fpDr ivo;t)sexoxm3ny4lle liet ()aDtrx p;u4alxoiiciyt a um(vp;t0aetrirciotfpDrlnvolt0t2xmio ny4ale liesat a2urxm ot0teeomfcias aDrmnmo () rerxr3iatlmDe uvo s s2xo(r3no4lmtnlnciltfa2rm(moou0teto ieiytlm2ulu s;()teerxrciodomteau sls  etrxmpio1llenlivta()aDtaxmpnt0aeeomf3ilsfm2umnvon(4aeerio totfatraieo t)sexoxo3nudomtnlnvi t arumum ;u4oexomf3iaslm2emumo t4tltoxoctodoa eau o;s)trurxr oy1ale lietlsfsDtmumont0oex  f3iyt aDrl(mp t0 rtrmr oydoa   ueo t) 2um(opiodll e ivtat)arraxront4ape  ictyd m2rmnvp t4 lxrirciydoptelnvs s texmxo3ou1opt  feiatf rrrx  nu1oeenmoeiasfs el( p;u0trxnxrctydfptran ols  rumir3iydoleemicsas sDrrur ;u0tlx iicias a em(vp;u4 renif3ia1laD  n s t trxoim3ou1amenmivi (  rraurpnu0tlt ioctyt aDeaumo t0trtrir3oo1lmDe uvilt)tetm(m3oo4ol  lfvia() Dur(m ;o0oeto i3tls m2ranmp t)alxnxrctatla  lnvo;s0srtr(m iy4ll elnctas a2rmum oo4alxo ieias aDranvo t4arenmr iotlmDrau i t  rum(mpoodlpen netl(f 2rau  ou0tpeoiociytfsDrmn pnu0 lenmr3iytfa r nvi;(0tetoio3ou4ame  feil( aruau o;t4tpt mf3iyt sDumu s (4aeeoxr tytoate ieo;s  ruoir3iu1lp  liei tf 2trx o;t4ape  oeiyt a2ul( s t)tltrxo iadfa e uei;s0 euoim3ny4omenmnctasfaDta(rpoo1oetnmieilsfaDrl( sn(4 exrxo3oodfptrai s;t)tetriopoydlme  ies t)arrm(roou1optnioeiyt m ulumo;(4teenmo3tytfpDeai o;s)srxrio3oo4apee ivtl()arua( oou1tleo o3iydfm2ul( s;(0 exrif3oo1opDelieols t2urxm3nu1lmtemiet ()srum(m ;t4teeo f3tlsfm ua(vp;()artomr ia1fateaies;t)seuo(mpiy1apenlici ()aDrmu  ;t1optniiciltls2em( sn(4tltrxoctydfmtrlivil(  eurio3iodaleemfet (fartr(mpnt1oltnio3ildfs ean sn(0trxomf oa1lp rauvslt)t2toxo3oudapt lietat s2ra(mpot0oleomo3tls a rlu s u0aeerxr oadoptraivo ()s2umio io4apenlnet sfa2ra(m ;o1tlxnif3iyt s2uauvonu4trxrio oytla e i il()s2urirpiudam nmfeia(fsDrmuroou1oex iietaslm rlu snu4tlxrir3tadom r ivil()srxr(rpny4omte netl()artau onu1opxo o3iadfaDulums u) etoif ootlaDeluvo;t)trxo(r3oydamenlnvtltf 2umxr ;u0tpx  i3iasla2umu ont) rtrmf3oydlmtrlueslt0s2xoxo3ou1llt lnvsl(faDua(  ;o1tle  octytlaDrln p (0teenmo tatopDeln i;()teuoxmpno4lpt  iesasfs2rr(mpot0teeomieiytla ul(mpnt4artnir3todfpte ieil( sexo(m ou4ll nmfci s sDtmuront4oeeomfeiadlm2ua(mo u0tleriocia1opD anvo s srxr(rpiu4aptnlfcsa()s2rmurpoo1tlxomfeiltfa eluvs;() rxnioctadlm  aneo;( setmir no4opte fvslt s2ur(  nu0aexo fcilslm2ra( p t0tetomfcio1laD lues t0 rxr(r3io4amtnmivtatfartrumpou4tlt mi3ilt aDea(monu0 leomrcoadfm rai sl(0srxo(o3nodom e fctlt sDrm( poo4tpxn oeiadfm2ra( pnt4arxnxr3oatfate uvs;(0 2urxm oo4apee fetltfs2rmum no1tlt ii3iatlaDeau s ()aexnmr3tydfatranvslt teurxr iydlmtnlies t)arururooo4texn f3tatlm2umnvo () rerif iytlp rluei t s2to(m3oy4amtnlfet t)aDur( pnt4aee mf3iadfm2ulu pnt4aexoif oodfatr iei ( teurxmpnydoptn iciltf rtaumpnt1oee mo3ilsfa2eau ont4arermr oa1fptrau s (0s2urirpnu4om elfetl()arrm(mpoo4tptnii3tytls2em(vo;u0texoiocia1faDrln il(  exoio3oy4ome lfesa( a2rrx o;t4texomi3iat m uau p t0 lxoxfctatfptr n slt  exr(mpiu1lltemfvta(faDtmu pno4oeen oeiadla2emnvp;(0trtnxf3iy1oa e uei;s0 2tmxo iudllte nei s srrmuronu4oetoifctydls2ea( p u)aexoxrcoy1fpD aueo;t  2uoio oy4lmeeliviatfaDuax pnt0tetnifeiltfaDemnmo;t4 exnxfcoo1lp rln s;t) rxrxr3io1ol  lfeta(fsDrmxr no0opt miciyt a2emu s u) exnircoatfat aies t0truoxopou4apeelnctl(  2rax pot4tee  f3iltla2ua( snu0 rerxfctotlmDran s (0trxr(rpiy4opteliet (f 2ta(mpoo1olto i3ilslsDelnmo u4 reoif3tytop eauvsl( t2xr(r3nodlp elnetlt aDur( poo0oetnifciasfsDrln o;t4areoif iytlp rli s;s0teurio3nodoltn feiat)srraurpou4texn i3iltfm rl(vont) lxrxr3tydopDelies s  etoxm iu4oltelncsatfsDtmxrpnu1aptoifciyt s emnvonu)teenmr3tadlp rlnes (0 euoiopoudapeelfes ( s2raxmpno0ale ii3iasfs2raump;(4 ltrmr3iatlm   u i;(0 eumio3nudamte ictatf rrrxmpno1tpx mociyt s2ul(vo;u4 eermfctytlpDelueo t seto(mpny4lle lfetl( s2ua(rpno1tltnii3tyslsDran p (0aeenmo tydlp elivsls s2toxr ny4omee nvi ( srur(rooo1opxoif3tlslm2eau s;u)aeenmr3iatlm elivs t0 2xoiopnu4altn icsa(fsrum(r ot4oetomietasfa eanmsn()alerio iotopDeluvsl( t2xmxm3no1al e ietl( s2raxmoot0tex mictltls2uln o;u4aexrxf3oo1lmte i s;t seurim3oy1lltelivtasf 2rrx  nt0tpt ifctysfa2rmu sn()aeeoxo ty1fmDe u s t0sexm(o nudoltelnctltfartm(rpnu1oet  o3iltfsDuluvp u)artomo3oa1fatrln o (  2uriopnydalen ics (fsDtaum nt1apeomoeiad m2rauvont0 reoxf tatfmDeau o;s texrimpio1alee ieiat  rrmu pou1opt mi3iydls elnmp (0texrmfcoadomDeaieslt)tetr(rpoydlpt mfvi t)srurxmp;o4oet mf3iytla2uauvonu4texrifciydfpDeluvi;t)trtrxrpnudlmen neias s2rau ooo0oetomf3ildla2ua( s t4trtomfcto1fat lu ils sexmir iydomtnmncil()sDtaxrpno1tleomieiaslmDuauvo u4 rtnif oatomt  i i;s)setoxr3ou4lltnlicsatfaDuaurpou0apxoif3iad mDua(vs u4trxomf iy1omDeau olt sexoxrpiodlle lfvta(  2rrxm ;o1openio3iat m2ranvs u4trtriocoytlatr i olt0 exmimpiydlmt  ics tfaDrmu o;u1ape mfciad aDra(ms ()tetrmoctydoptr nvo;( t2um(m3iydlp  lnvs (f 2rmur nt0texnmicilsfaDuluvsnt0tetnxf3oodopD ln i s  rxmir3iodlpe livi ()a2rr(mp;o1oleniiciyt aDua(monu) rxrif3oa1optelnei;t t2xo(m3io1llt  nei t) 2ra( ono0oee mf3ilslaDrlu s () eerxo iodfm raueils) 2xm(o nodamtnmnvia(  rrm( pno0oexnif3tls a em(vo u4altrxr3oo1opD li ols  2tm(m3iudomenmnvils)a2ta(r ;u0aet mietadlaDelnmp;() eermr3oadlpD  uei;(  etoxm3no1lleelnes tf 2ur(ront1openmfctls m2ran o;t) rtniocoadla   i s t0 rur(o3ny1optn nesasfartrurpnt0tpxniocias a2ran p;()tltomf oytoa  luvi;t) rtrxopnodoltn ivslt arra( poo4aptnmfeiyt a2umuvs;u0tlxnxoctydfaDrliei t trxo(m3ou1lp  mncias  rrax  no1olxoioetytfsDraumo (0teerxr3to1laDe iei t s2xmimpno4aleemfctlsf rrm( onu0apx ifctyt s em( snu0 ltrxf3iotla r ies;s s2uoxmpou4aptemneta(fsrumxmpou0openmoctadlsDuanvo;(0 rxoif3oo1omtrau i s0seurir oydopt lics ( sDta(rpoo1tlxo fcilt sDemnmo;(0aeeoif oatoa e u i (0trtoiopio1apenmics tfaDtr(  ;u0apt  ociltlm2umnvp;u)artoxrcoa1opt lnes;s0trtm(m oy4op nmnct ( aDraur oo1aexn iciys s2rl(vp t)trtrir3ootlp r ies;t setr(r io1lmtemivtlsf Durxr no4olenmfeils aDum(mo;() lxnxr3oytfmDe n ilt0trxrio oodap emnciltfsDtax  ;t4oexo o3tydla2rmnvp () ltomr3iadlp rau olt  eur(r3iudome mfcil(  2taxr ;u1tlx if3ils m2eanvs;(0altrmr3oytlpDraieols  rto(mpnydame mnviasfaDrm(ro;t0apeomfciyt s rauvont)tleoio3oodomDelu slt0sexo(o3oy4lme  ies s a2ta(r ou1opx  iciydfm2ulumo;u)trerxo3oo1lm e n s;t0teuoxo3oo4op n nctls) ruaxroou0aptn ictysfa ul(mo u) exnxrcoatlptelnes t)texmir iu4llt  nvi (f ruaxmoou1aex  fctltlsDrln o;t4 renir3iytfaD lneolt t2xoio3iu4ameelnei s s2tmxmpnt1olxo oeias sDrauvp u)trtnxf oo1oaD  i i;(0sexrxr3io4opt  icsa( srur(m ou1tee ii3ildfs2rln pnt0 rxrxrcoadfm ean s;s trurir nu4op  lfvsa()a2rm( ooo4tleoif3iat s2ua(vp;(0 lxrxf tadlaDe i ils  2tmxr3oudal n nvsl( arurumpnt4alxniicilsla ra(vo (4tlxoxf3tydoaDrli i;t s2xm(r3oo4op  lfcslt)arraurpoo4tlto iciadlm ua(mo;t4 etnmrctotfaDe i o t0 2um(o iy1lmt  neil( a2tr(  nt1oetnioeiaslsDeanmsnu0aetnxr oo1omtr ueils trxmio nu4llenliesltfaDtru ooo1aeen feiatfs2raumo;t4teenxo3oa1op elneilt0 2tmxrpiy4lmee nvslsf 2tm(  ;u4
\ No newline at end of file
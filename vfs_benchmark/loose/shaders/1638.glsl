@@ -0,0 +1 @@
+u sl(0 2xmxrpou4alee fcsatf 2ra( oot4aeen oeias mDemu s;u4 renifcoatfp rluvslt0texrir ny1al e fcs () rraumpno0alx iieiydfsDum( ont)aeenir oydfmDrli ilt0srtmio3oodlpt mivilt  Duaur nu0oetnmfctatla2uln o t4tltnir3io1oa r ivo;s) rxmxm no4ll e nvs tfarrr(mont0oleoif3iydfsDelumont4arxoxo3tatla e u sls)tetm(o3ny1altnmfeiatf rtr(m ot4texn octyslaDrln p;(4aexrir3iytfpDranei s  etmxr3io1ol  mivta(  ruaurp;o1opeomoctld s2raump;t0tetrxrciodfmte i i;() ruo(mpiy1ap  mietat)s2tm(ro;u1apto o3ilt s rm( pn()trxnxf ia1lp eln o;s0trxoimpoo1al  mivi t  Dur( onu1tleo fetas s ul(vpnt4trtoir3tydlp e i ilt)sexr(rpoudolen fciasfsrtrumpot4tle ifctldls ulu snu0aetomfciydlmDr neol(  euo(r3iy4ole lfvsl(f rurx  no1tetomfciys a2umump;t0teenxocoy1laD anvo (  2uoir iy4lpee ies s) Durx oou0opx moetas a ulnmon(0arxrxocio1fmt aivi;s tetoio oo4ll n iei ()a2uau ono1opt  fctatfm2ua( s ()alxoxrciatfp e ivs t) rumxmpny4lptelnvslt srum( ooo0tle ioetat a raums (4aexrircoo1lmDr u o ( setrxopiu1ol  mnes s s2rrumpno1tpxoiociadfa ea( p t)arxoio3tadomtrau o;s) eur(o iy4omt  nes tf 2uaurp;u1texo oeiytfs2rl(mo;t0aetoiocoatfa rln o;t0 2xr(r oo4lme lncilsfsrtrx o;o0aleo o3ildfaDumn snu4arxnxr3oodlmDr ueo;s0s2uo(o3ny4ll nmnciatfa2umu p;u1opx iociatfaDuln o;t)arerxociadfpteai s;t  rxo(r3iy1op   ivs t) rumumonu4tpt mo3ilsfs2umuvp u4tetrmr3oodlpDr nvil( srxmxm ny4omt mfciatfarrrxm nu0oleo iciasfmDrlumo u0 rxrmr3tatom  luei;(0trxmimpio1ope miet t)sDum(r nu4tptnioeiys m2ua(vpnt)arenmf to1fa e n i;t s2xoxrpnu4lltelicil(fsDur( ooo1oeeomieias aDul(ms;t4tltniocoy1fatr ueo;s  exoxopou4omt licta( srrmurpnu4ape  fctydlsDrlu pnt)arxnmo iytomtraueslt0trxm(m ny1lm   ncsltfarrmxm oo1opxomociadfm eau p;(0tetrxo3iatlm elnvi t) 2uoxo nydap e fvtatfsDtrurpoo1aeeomfeiltfa2uanvs (4trxoircoadlm rluvo;t0srxr(mpnydamtemieil( sDumumoot0oexnmf3ilt m2rlnvs (0tlxoxf oodlpDrlivo;s  etoxmpoydapt lietlt artm(mpou4oexn f3tatfsDrau o t4tlermfcoydoatran s;t) exoir nu4amt micsls)srraxmpno4optnmoeiatla ulnms;t4teeriociatlmt lieo;t0 exoxm no4openmfciasf Dta(  ;u1oltnmfeiasfmDra( pnu0tetoxf3io1laDe u o;t0 ruoio3oodopt  ict s srrru o;u1apxoif3iydfm eanvsnt) rtoiocoatomt anvs t  2xo(m iodalte fvias aDraumonu4tlxnio3iys s2ua(vp u4aetrxo tydlp  auvi ( s2xoim3oodal nmictat sruaxm oo0oeeomocilsfaDrm(mpn()arxoxrcootfp eaueilt0teurxm3nudaptn iei t arrrxr ;t4tltoii3iaslsDrauvo t)tltrio ta1lmtraivi ( srtm(mpoudom   ncils)arraum ot0oexoiietydlsDranmp;()tlerxf3ta1lpt ai s () etr(r3oy1lp   nctltf Dta(rp;u4tpx  ieils s um( p;t0tlxnxr3io1opD lnvsls texrxopnydape lies sfaDrr(mpno0alxnifciatlaDran s (4 reomr3iytlmD auvo s) 2toio ny4al  lfcsas) Dtaurp;t1alxnio3iyd a umnmo u0aeenmo3tadopDe ies;t0t2umir ou1lleemiet () Dtmxmono4ole iicild s rm(vo ()artomr ty1oa e n i s sexm(r3iodomee nvi tfsDrmxroou4apx mo3ilt aDulnvp (4tltrir oatfpt auvi s0srto(o no1opt mict s)s2um(moou1oet  oetysfsDua( o ()tlerxrcoy1lptr u i s  2xrim ou4op  mnvs s aDumur oo1oeeoif3iytfa ulnmp;t0arxrmrctodfp  auvs;s  rtoimpoydap  lfvs ( sDtm(m no1aptnio3iytls ulumpnu0 etrmr3ia1fa eaiei s)truoxmpoy4ol n fvsl( artmxro;u0apeoifeiadlsDelu s;(4 rtnxf iy1fm eln i;()t2toxm iy1am  mictl(f Durur ot4opxo fciytls2elnmont0trtrmo3oatop eanvo t)srur(r iy4lpee fviat)s2tm(moou4apt  o3tatfs2ean pnu)tetrif3oo1om eaivol( tetmxr3ny4lpenmnvi ()sDurxmoou4altnioeildlsDul( p;() eerio3tydoa  lnvo s trxmxo3nydlpe lnciat srrru  no0apeoifeiyt sDem( pn(0aetoif3ta1faDran o;( t2um(mpoudlm  lieilsfsDum(rpoo4tltn f3ildls2uaumpnt4 rtomrctydlpD  n i;s0trurio io4lm nmncsls)artaurpno0tpenifciytlm2uanmpnu) eerxr3iadla   iei s t2xoio iudlp e ivsat)aruax  nt0ole iictltfs2uan sn(4altoxrctytfmte uei;() eumim3no4lp   fesl() Duaxro;t4apxomoeiatlaDulnvpnt)trtnxo tatlmDrlu s s)srto(r oodlpeelncslt a2rr(monu0olen octldla2elnvs;t0 eeomrcoo1oa raiei s)srtmim3ou1al  lfvt ( a2tmxro;o0oetomf3ilsls ulu o;t0aexnmrctatlp r neo ( seuo(o3nu4lp elfctat  rta( pnt4oexnmfctldfm elumo t4altnmoctytfpD lneil()s2urir oy1lp  lfct ( s2urx  nt1apt mo3tldfa ua( s ()texrxr totfaDr nesl(0s2xrimpio4om  mnvsls)arta( p;u1olx iieildlaDrmu p u4alerifcia1fatrau s;(0tetoxopiudaltnlneilt  2rax  no0alxn fctadlm ra( p;u) lxrmo totoaDelu o;s0texmir3iu4al elnciat)arrmu onu1olx mf3ild m2ul(mont4arerifciatfaD aieslt t2xmimpny4altelfvils)artmumo;o4tlto fciad s2em(mp (4tetoxrcoo1omD luesl( trumxr oy1lltnmieta()a2umx p;u0aexo icild mDel(mont4aeenio tatoa e n i ()trxo(opnu1alt mivsat aDta(ro;u0tpxoifciltfmDrauvs u4 reriociotfa e uei;s t2tm(rpno1am  lfet tfsrraxmo;o1tpen o3tys s2rm( s;u0texoif3ta1oatr neo s)sexoirpio1ope  iesa()aDtr(m no4teto i3ilsla umn s;t4treomrcoa1op ean o;s s2toim3iy4ap n ivi sfaDumxmpot0olenif3tydfs2emump u0 lxomfctodomD aivol()seumxm ou1aleelfeiatf rtax ono1aptnii3ilt a2rm(vo;u4 lxoir oo1fa eanes t trxo(m3nu1om emncils artrx  oo0optnif3iydlmDrauvon()tleomfcio1lp e u o;s0setmim3nu1open icia(f Dumxrpnu1olx iicilt a eanvpnu) exoif oy1latrluvs s)s2toim nu1oltemfeil()s2rmu pno4altnifeiytla ea(mp;(0 lenmr3tydlm rlivs;s)sexm(r3io1ll nmfeilsfs2tmx p;u1tptoiicias mDemnvo;(4treomr3iytlatelneol(0srto(opoy4amt  iesa( artm(r ;t0apx  f3tyslaDeluvs;t)alenxo3ootfpD livi s) 2um(o oodopeelfvtat a2trxronu1tpx mociysfmDumn o;u)trtoxfciatla  anvi (0 2xo(m3iu4ol nlicta() rrr(mpou1oet miciytla2rmnms;u0trtrxf3ty1lmDrlnesl()t2umxm3iu4oltnmfct tfsrta(mpou0tee mi3tatls2eanmo (0 ltoio tydlptr nvo t trtm(rpiudopen ncia(fs2urx oot4optnmfeiatfaDrmnvo;t4arxoif3ty1op r n ilt)tetoim3nodaptelfei (f 2rmxrp;u1tlt ii3iydfm umu s;t4arxnmr ty1oaD  ueols)trtoxopnu1aptemfeslt) Duau p;t0ope mieilt a2umnvs t)alxomr3iotlptelies;s0srto(m iudoltemnctas)s2urumpnu0tex iietysfa2rmnmo;(0 rtnmo3todfm r neo t)teurxm oy4lpe mfcs () Dtax  oo4altomociys mDrm(ms;()trxoxrcty1omte uvo;t s2tmxrpnudopte nes tf Drauro;t0tlen i3tydfaDum(mp;(0trxrio iadlpDeauvs;t0sexm(m3oydlm e nei sfsDum(rpno4aee moeildfm2emuvo ()tltrmo3oy1opt ln sl(0trxrxr iy4op emfcil()s2ua(  oo4tetnif3iasfs2rl( s;u) ltnio totfatrli slt t2urim3ou1lmen fct ()srrmurooo4tpx mociltla rm(ms;()tleoir iatfaD lueslt) rxoir3no1altnlfvtl() Drr( pot4tex iieiys aDranmp t)tltrxf oodfm  lneo t)sexr(o oy4ol nmncilt)artmu pot1aptnmfciytfm2el(mont0aexoxo iydop rli ols0 2umir3oydale lnvs s) Draxr ;t0oex moctytlm2rmuvon(0 rerifcoadoa r u ols0 2uo(o nodlmeemnesl(fsrrrurp;o1tpxomocildlm2ea(vp ()tlenmrcty1fmt  i ils)t2tmxmpiodom  mivi s)aDtrxro;o4alxnioctldla2ua(vp t4teenir3oy1lmtelieo;s0trtoirpio4aleelfcia(  rrmumo;o1ape moeiysfa2rlnms;(4tlermo iotomDr uvs;s) ruo(rpiodol e nct sfaDrrumpnu1oexoifciysla rauvp (0areoxfcoo1lateaivsls0s2xm(rpiu4am eliet tfa2urxr ;t4tee iiciys m ea(vo;t) ltrir3iatlaD  nvo s)s2tmirpiy1lmt mfvt ( s2ur(mpoo4tpxnioeiydfm eanvs (0aetrxociytlmDraneslt0texoxrpno1al emnes t)aDrauro;t0olxnifeiad s rlnvo u0 lxrircoo1fptr n slt  2trxr3oo1om e iviasfsDumxm nu0ape moetydls2umnvsnt) lxrxf3oydomt aivs;s) exrim3io1olt  nciatfsrumxrpno4tlxo fctls m raumsn()aeerircoadomte u sl( s2xr(r oy4lmenmivsls)srua(m ;u1opto ieiatfmDel(von() rtrmrcia1op eai i ( srtmio iy4llenmncta(fa2trumpoo4apxn i3iytfm eluvp t4trxrio3oytlmD li i t) eumimpoodlm  mictat artmu  nt1oexo fciad s um(msnt)texrif oy1fmt lnesls)srxmio3io1lm n ivta()a2ua(rp;o0tpen i3ils m ua(ms ()arerif ty1fat lues;()t2xm(r3no1om   fcia( sDumx  no1optoifetyd aDemums;()aetrmo3totfmtrln ilt)t2umimpiy4lltn ivt (  2urxmpot0tlxn fciatlm ul( s;(4trxrxfcoatoa rlnvsls0 exrirpiydlp n iesl(f ruaurono0teen ieiad a ulnvo u0tlxnir3oodfmt  ies (0trxrimpio4ap nlivta()srum(r ;u1oleo fetas a umnmo (4altomo3iydoptran s t  ruoimpoy1ll e fci ( aDrmum nu4apeomfeild m2rmuvsnt0 rerir totoptrlueo t  eumim3iudapee net s aDumumooo1opxo oeild sDeauvp u4 rxoxoctadlpteaivi;s  exr(r oy4ol   fcsa(f Dtrxrooo0aptnifeiadfm2rl(vo ()tetnmrcoa1om e ueol(0 2uoxmpio1oleelfctls) rrmumo;o1oeeoifetadla2raumpnu4 etoio ta1lp   ivo t  etoirpiydameemncsasfsDua( pot4olx  fciatfm2rlnmo;u4teerxf3iatfaDeaivsls0s2toio iudlmenliet t  Draxmo;u4opxn o3iyd m eluvo;t)aexrmfcty1oatrluei;s0 2xmirpoudoleelfcia( aDuru o;t1tleoif3tls s2rln s;t4artnxf3todfmteanvi t) rtr(m3no1ape mictls aruaurpnu1olt ioctlt s2raums;u0alenio3iytomteluei s  exmirpny4ol  lncsl(f 2urxm oo4aet mfeiyt a ul(mp;(0arenio todomD aues;(0t2xmxr nu1ol emiviatfsrurx oot4opx  i3tydla emumonu4teermf3totlmt  ivs;s setmio nudlle miei s sruaur ;t0olxo fetat aDean o;t)areoxr3oatom eai ols)s2tr(o ou4opee iciat aDur(m oo4opt  i3ild m2eaums (4aeenir3oodlpD an ilt) etoim iu4lptnmfcils)artmxmo;o1oee iocildlsDemnms;u)texrio3oytlp e u o s)srumio3oodole  nesasf Dtr(rpnt1olt mfetld aDea(msnu4aexnxfcoadlmte nvo;(0tetmxrpiodop emfes (  rrrxmonu0oetoiiciltls2ua(vo;(4arxnmo3tadfa elieo s) etmxr3oudoltelics t) 2ra(monu0tptn ieilt m2ean p;u) etrmf3oadom  aneo;s0 2to(m3io1am e netlt)s2tr(  nu0aptnif3iadfm2rmu p () etrmf ia1fp elu il(  eto(m iudom n ncias) Drr(ronu1oex iieildls emump;u) renxr tadlmtr n i s0s2toxm3iu4am n fciasfa2rr(r nt0apt  oeild s2rl(msn(4 exrxr oodfa  lu slt) etmxo3no4lptnlncs ()arrmxmo;t4opeomfctys mDulumsnu0teenir3tadlateaieo ()srxoxm oo4ole mnvsl( aDrax pot4aexomoetatfaDrmuvp u4aexniociotfaD  n s;s setrio3oudopeelfvtl()sDurxmono0apxnif3tltfmDuluvsnu4 ltoiociodfpDe neilt0sexm(m3io1ll n ies tfsrtmuronu4oeeo ieiydla2uauvp u)teeoifciydlmDeln s;s0sexm(m io4ol elics s s2tmxm ;t4oet micilslsDrln snt4trtnxfcia1laDeln ols) rum(rpiu1lptemivs (fsDtmxmp;t4teeomi3iyslsDrau o;t)alenmfcoodfp e nvo;t srtrimpio1ameelnet (fsDta(ro;u4oltn ieils m2em(vp;u)tlermo3ta1fpteln s;t)t2uo(opoudll e icsasfs2trumo;o1tlt  iciyt m2um(mp t)teenmocoa1la raneilt trto(r iudlpee nei (f rrr(root0altn ociltlm2rlu onu0aexrxf3oadfm eau i;t  exm(opoydlltelnesatfaDrr(  oo1oeenmieild s2umumpnu0aleoxf tytla eluvolt)t2umir3iu1olt lfctl() rrrx pnt4tltnifciyd aDua(vp ()altniocta1fmD  ueo () eumir iy4lp emfesas) 2tmxrpno1alxomiciltls uanvp;(0trermr3tytomDeaivi;t  rto(m oy1optn fesls aDurxrpoo4olx mi3ilt m ul(mo u0 lerioctydlpt  nvo s) 2xrio iy4opee ivils)sDururonu0tpxnmocilt m uaumsnt) renmr tydoa eaies s0srumxm iodome mfes t  Drm( ont0texomi3tytfsDranvs;(0trtnircia1lm rlieslt0 2xm(opiudlltnlietas)a2umxmpou1olxniieiyt mDrluvo t)aetoxo io1opD livilt sexoir iy1apeemnvs sfsrrruroou1oexnmfciltlmDua(vp u)teermfciadfpDe ivilt0s2urxr3no4ol elfcs tfa2tm(mono4aeeoio3tldls ea(mp;u4trtomr oy1op rlivs;(  eto(o no1lleemfeiat arrmx  no4aptniiciydls2uanvon() exoif3iotfm elivilt s2xoirpio1omenmicsas)aDuau pnt1oet iieiyd m2uaums;u4trxomrcoa1fm eau ilt0srtr(r3no1om  lfeta(f rtau pou0tptomocildlm el( s;t4alxnmociy1oa ean i t seumir3io4llt livi s)aDtaxrpnu1tpe  ociasfa2emn o u0alxomfcty1fm elneo t0trumio nudape mnetl( s2umumpou4ale iiciydfmDemnmont4 rtniociytlmD  uvslt0 2toxm oy1apeemnvs t  rrmxront4tpxoio3tldfsDulnmp (4altrxf tatfpDe ivo;t0srto(opoodop elfesls) Dtmu ooo1ape  ociyd mDrmnvonu0 leoxr3oytfptranvs;s0 2ur(r3oy4apt mnvs tfsrrmur ;u1alxo i3iydfa2umn snt0artrxf oytfp raneo;t trxrxm3iu1ol  lici (f rum(m ou1oeen f3iatls em(vo () eenir ootlmDelneo;(0setm(rpiudamt  nctat)aDrrxro;t4aleo ictat a2raumpnt0trxoif3oy1omDeli s;(0 2trxm3nydlptelnetl(fsrtaxrpou4tlxo fciatfaDrm(vo;t)artrmocootfa eanes;s) 2xmxo3oo4oleeliviat  Dtmx pnu0olt mi3iys s ul( snu)altoxr iotlmDe ivi (0 2xm(r oy1oltelicsl()aDum(m no4opxoiictys aDrlnvsnt0tlxoif3to1fpt  ies;(0s2xoxopnu4lm e nctlt)sDtrum no4texoifeiatlsDea(ms (0arenmf3oydlp eluvi;()trxrxmpou4om nlici sf Drmxmpoo0tpxoifeiyslsDeanmon()trxoif3ia1fp e ues;t) etmim oy4omt lfetlt aDur(  ot4tpeo i3tlt a2uan o;t4arxnir3oy1fpD  nvi t0trum(mpou4apt mivilsf 2tru oou1tpxoif3ilsfs eln p (4 eerxocoatlpDraieolt0 etrio3ny1amen fet (  2rrxr ou1teenioeiatlm2elu pn()trxrmfcto1fmD auvo;(0 rxo(m nydoltelnvil() 2rau o;u0aexnif3tasfm rmn p;t4aexnir3tydfpt lies s trumxmpny4opeelivta(faDrr(m ou4oetnifctasfmDranvo () rxoir3todlp elivol( srxo(m3iydome livt sfarrm(m ;u4texoioeilsfs2em( p (4aetrxociytoat  uvo t) ruoiopoy4ol  lictls s2taxrpot0oltnmfctat mDem( o t) ltnxo oodlm raneo;() rxr(r iu1ope mictl() 2ua( o;u4aee mfeiydla emu onu4arerir3oytfmt  ivs;s0 rxmxo oy4optelicsl() 2ur(m nu1olx  ocias m2ulu s;u4 ltomocty1fmDe i i;()srxrxm no1omtnmfei s  Drmxmpou0teto f3ild a2eauvs (4tetoif3ootop  auvo ( s2xo(opiydoleelnvtls arrmurono4oeto oetyd a2rlu p;(4 reomocoa1fmD lu ol( tetm(r iu4amt  feiasf Dtmu ooo0tee mi3iatlm2emu o;()tlxnmr3iodop e iei;s  ruo(m iu1oleelictat) 2trxr nu0tlxnioeiydls2ul( s t)alxomfcia1fmtranvs t)tetoiopio4lp elfct ()a2ta(  oo1tlxnifciytls ulu o t0teerif3iotopD livs ()texrirpou1al elfesls)sDurxmpnu1tpx ioctyd a2rm( snu0 lxoxo iotlaDeaivs ()s2uriopnu4am nmfeilt  2umur no4altomfeiltfa2elums;() rtnxr oa1fmD livol(0trxoimpnudame  ncsls) rra(rpot4tleomo3ils a ean s;t4aexnif iodfpt ai ols) 2umxmpoodlp  livtl(  2ta(root1aet ifcilsla2ranvpnt) rerxo ta1fp rau i s0srurxr3iu4ale lnctl(  Dum( oou0alxomieiadfsDelumo;u) ltrmfcta1fp eli i;(  eumxm3iydlmt mnetas)a2urur nt0tpx mictysfm eaums u0 rxomocoy1optr iei t)s2toxo iu1lm  mivtlsfs2umu poo0olxo oeiytfa el( snu4 reoxr iydlaDeau sl(0 2trxr3iy1lm nlfvsasfs2um(rooo4aexo o3tlsfs el( p t) ltomr totoaD  ieol(  2trir3no1lmee net ( s2ur(mo;u0aee  fctyslm ua(ms u0 exomoctodlmDe i o (  etm(m iy4ameelivs s  Drru pou4opx  i3ilsla2rlnmo t) rtnifcoydfat livils srxo(o iudap nlncsat s2tm(r nu4tlx  octls s el(vo t0tlenxr iodlp r nei t)sexo(opoo1apeemnesat sDur( p;o4ope iietlslsDeanmp t4aeenxrcoatom  aieils)t2umio oodom elfvi (f Durxm nu4ope  f3iydlm elu o;t0 lerxf oodlmD anvo;t  rxmxo3io4optemicsa( srrmuronu0oeeoii3ildfm2emuvonu) ltnif oa1lat ai i t s2urim3iudole mnei sfa2umxm ot4olenmicildfsDrmuvp;u0artomocio1laDelnvols0sexm(o3nodolt  ivsat arrmum ot0apt  ictadls uln snt)arxoxf3tydfp  anvi t  euriopiy4lpenmfcsl( a2rmumonu0aleomietlsfa2emump t4altnio3ty1lm raueo;( t2xr(r oudlp emfet ( a2tr(mpnu0oetoii3iyt m umnmo;(4trxomf3io1la eaivolt sruo(o3oo4ole liet s srrrxmpot0apto i3iyd m rm(vs ()tltrmf oatfatr nvi;s)t2uoirpiydoptnlnct t s2um(rpot1alxo i3tltfa umums (0 rxomr3oodfp   ueo s0 2xoxopoudolen ncsat aDrm(root4aleomfciad m rln on(4tetnxr3totlm eaneolt0trtoxo ou4am n fvil( srra( o;o1tet ioctyd m2ran p;t)tltoxf3totop eauei () 2tmirpnodaptelici t)srtru onu0teenii3iydla2rlu p;(0 exrir3oo1lmDe nvo;s teto(o ny4ape mneiasf 2trum ;t0tltomi3tatfs2uauvs ()tltoif3iadfpt  nvs s trtmxo3nydoptnmnet sfs2ur(  oo4aetomfcildls rln on(4trenmr3oytfptrlnvi;s0 2trim no1lmenlncs t aDrax ont4alxo f3ilslsDelu o;t4texrircoytfp  ln s t sexoimpiudoptelneiatf Dumum oo0optomf3tltfm eln s t4 exnmr ootom  luvs t0trxr(m3ou4lmt mnes sfsrurxm no0tlt  fetls a ulump;t4altnxocia1oatraivo s0 2urxm nudlpe lfvilt)a2uru ont4tltnmietatlmDul( o u0tetoirciadlptran sls t2ur(o iy1oltn nvslt  rur(mont4aptnioctlslm2ean ont4 ltrio iydfm   nvi t)s2toir io4altn ivi t)s2um(ront4alxo ieiys m ra( on(0artrifciotlaDr ies;( trurxo3nudlp emfct tfsrumur ;u1tet  o3iatfa ra(mpn(0 exnxo3iydoa eau ols srtmimpno1lmt lnctas)aDurxr ou0oetnii3iyslmDran snu0arerir3oadlpteaneols0t2uoxr nudllee nesls) rtmu ont1teto ieildlaDem( p (4 rxrxr ootlpt ln ols0sruoxr3iy1omtn nei (fs2uaxmpou1aetnmieiatfa2rm(vp u0texniocoo1la   u slt)t2uoio io1apeemnvtat)a2tmu  ;u4tlen o3ilsfa2ra(mp;u0trtrif3tytfaD auvolt0 2xr(m3iodlm  lncia()arumx  oo4tpx  ieiltfaDemuvsn(4arxrif3oy1lp   uvi s tetoxm ny1altemfeils)aDua(ro;o4alen o3iaslm2uln o ()trxomocio1om rlnes;(0 euoiopoo1lptn netasfa2rrxronu0aex io3ilt mDemuvp t4 rxnmr iodom rlieo () exo(o3oy4ll   iesat sDtru poo0oexn feiydlm2umnmonu0areoxocoodomDelu i s tetr(o3oudoptelnes s)arumx o;t4apxo ieiydla uluvp u4 exrio ia1lat livi t  2xmim3io1lptnmivsas aDumur no4oleo icildfs rauvs;() reomo tadlaD lu i;t0s2xoxm iodopte neta(  rraurpnt0optnmfeiasfa2umnvont0 reoir oytlmD ln s;t0t2xrxo nu1omtelfet t)srrm(mpnu4aexomfciat a2umnmpnt4 etomoctadlm elivs;()texoxm3iu4amenmnvsl(  2urxr ou1aee  i3ilslm ranvo;t)aexrir3iydfa  aiei;t s2xo(m3ou1olte icsl(f 2rr(rpot0tpx  f3tad a2um(mont4 ltnmf3ia1fmtelneo (0s2urirpoydamte fetat aruau ont0oltomo3tasfmDemumpn(4trenif3iatlpt  nvol()s2tr(m3nydoleemfctas)srur(ro;t0tpxnif3iad s ul( ont4tetnmf oytlmt  n s;t t2um(o3oo1amt liesl(  Dum(  ;u0oet mf3iytla um(mpnu)trxrxo iy1lmDeauvi s srto(r3ou1ol emfviltfsDumxmpoo4tpeomfcild mDua(vp;t0arxnmo3oytfat aieslt)s2uoxr3oy1amt  nctasf rrr(m ;u1oltoif3iadfs2rln o t0tetoiocoy1faDe nei;t t2urio nodamt mfcia(fsrrrxmp;o0texnmoctytfa2rmums ()aexrio3iodoptr n s t)s2um(o3oo4alen nvi tfsrumxm ou0ole  fetadfs emnvonu0aetomf3tytomteluvols trxrim nu1om nmnvs s)s2rrx p;t1aexnif3tat mDea( p u4aetnxf tydfaD  ues t teumxm no4llt lfeil(  rum(  ot0olen i3ilslm2rl( s t0alxnmr3ty1la elnes t)s2umxm3no4alt lfcil(faDrrxmont0apeomoctyd mDelnvp;(4trenir3oytomD  ues;t srto(rpoy1apteliet t srururono1apeomo3iyt a rlu o;(0trenir3iadlatrli s s0s2uoxr ou1am   fct ( a2tm( pou4oeeomfcilt m2ul(vonu4tlxrio3iatomt luvols0teurxm3iydlmtn icta()sDtaumpnt4aetnifeiltlsDem(monu0trxoif3oa1oa rlneo s)srtmxm3oodam elfctltf rtm(rpnu4teen ocilsfs2rm(mp;u) reriocoydfpt ai olt0 exrirpiy4oltemicils s2rmx o;u0tpxnmfciasls uln p;t4tetrxoctadoateln ils0srur(r io1ame lfvt t arrrum no4oexo i3iadla rluvs;(0teeomr3iytfmDrlnvi s)t2toxr3oy1lpen ieta()a2tau  ;o0altn fctaslsDea(vo;u)trxnmocio1omDr neo s0srum(r iodop nlies ()s2ra(m no4optn o3iys aDeaums u4teerxocoatlat lu s;s  eurxo3io1optnmnet tfs2umxmpou1openmfeiat s emu p;u)aeerxf3todopDraneol(0s2tm(opiu4op n fetlsfsrta(mpnt1aptoiociltfsDel( p t4tlxrxocoytfa  au olt0 rtr(mpoydoltelfvi ( a2raumpnu1tetoifeiyd sDumnmonu0tlerxo iy1oatrluvils teur(rpno1omeemnctlt)s2uaum ou4tee  ieilsfa eanms u4aeeoifctatoa rai s;t sexoio oodaltnlfeilt sruau  ;o0ape io3ias mDumuvo t0texoif3oydlm  aneol()sruoimpoo4amt lnvtltfs2rm(mpot0tpt mo3tatfa umn pnu)treoiocty1fmD  ieo (0srxmio3oo4llee fvsl() rrm(ro;u4aeenmociyd mDum(vo t4altrxfciytlmtelies (0trtr(o3ny1lm elnetat  rumxm ot4tee  iciysfsDrm( s t)tlxrxociatfm r nvs;s0 rxoxr3iodlpe licsa()a2umur ;t1opxoif3ilsfs rmuvo u0teermocoytop rluvo t)s2uoir3iydaltnmietl(  Dtm(ronu4tee iieiyslaDeau snu0 leoxocoa1fmDeaues t0 rtoimpoudap elnvsat) 2ra(ro;t4ope  ietlsfa ulums;t)tltnir iy1fm   iei;s srxmim3io4opt mnvt s a2raum no4tlen fciad aDul(vp;t4tetomf3oatfaDe ues;t)trtriopnudllte iesls sDur(  ;o1texn ieild a2uau onu4teermr oa1omtraivi s srtm(o iy1ll  mnvilt)aDrmu poo0aee moeild a umumsnu0 etrxoctodom ran o;s tetr(rpnudllt  nvi s  2rrumo;t4apx mfeiltfsDeau p t)tlermf ta1fp eai slt  rto(r oodale lfviasf 2ua(roou4texomf3tldlaDeanvpnu) reoifciadlptr ivo s sexmim3iodop nlieia( artmx p;o1aeeo ietyt a um(msnt0aeeomr oa1fp rlieolt)tetr(mpiydol elivil(  rrmuro;u1alenmietlt mDeaumon()tlxoxrctadoa rlivsl(  eto(m no1lpee fvs ()srraxmo;o4aetnifciatfm rauvon()alermf oy1op e ivs s s2uoiopnudlmte ictl() 2ta(rpoo0ope mieiatfs uanmo (0alxnif todomteai o;s) etmir no1ll e ncs s)sDtmx pot1tetn f3iydfa em(ms (0teeomrciydfm  lieolt)sruoirpio1lltelici s)s2uru p;t0oexoioeiydfm2ulumo;u0altoio3oadlp eaueolt setmirpoydolt mnvils  Draxmpnt1ape iiciyt mDrl(vont)trtnxoctadoaDelu o (0srxoim3oudamenmfeiat)sDtrxrpou1olxo o3ildfs2um(vs u0teerxf oatfp r uei s teurxo oy1opt  fci t)s2tmumo;t4oetnmfctasfaDuln o;(4aetrmr3oodop  lneo s srtrxopoo4lme lfvs sf 2urx o;u4opt ioeiaslaDrlnvp (4altrirciotopt  n il(0teum(rpiy1open fvtl(  rrmx  ou4opxn f3tld a2ua( s t0texrxfctytfmtranvs;( texrxo3nu1om  mneil( srra( pno1olxoifeilt mDraumpnu4alenmfctadlatr ueilt  rxmxmpou1al n ics s)aDraum ;u0olt  fetytfs2eau o;u4trtrirciadlmt luvslt  rxmxopoy1lpeelncilsfaDraxmpoo4open fetad sDranvp t4altnxrcia1la  lneil(0setoim io1altnmfet s a2ra( p;u0tpxn oetltfs2rl(vp;u4texnxf tadoaDelivo;s0setrirpou4omtelietlt  Dumx pot0olxoifctyd a2em(vs;()aeeoir iotfp rau i;t trur(mpou4lpt mivtls)a2ra(mpou1opx  i3tlt a2rl(mo u4trxnmo iydfm   ies ( trtrimpno1lmte fvi s) rumxrpot4apeomoeiytlaDemn snt)areoif3oy1oaD lu ils trxmim3oydopee ict sfsDtr(ro;o0alxoifctasfa2rmnvo t0aleoir3to1fpDelu sls)t2ur(opno4optnlncsat)aDrm(mpou0oet miciyt a em(mp;t) rtrmo todlmtrau s;t0srtm(opnudllee nvsas)s2uru o;u0apeniieiatlm rm( snu) rxoxf3tytlp  aivilt) rtm(o iydoltemfvt s a2ra(rp;o0tpeoifctatfm2umuvpn()artomr oa1oa r ivo t0s2xrim iy4lpen ictlt aDtru ont4oleomo3tasfm2rm(mp;t4 exnio3oo1la   neols teum(opiy4aptelicil()sDtaur ;o0altoiietydla2rmnvs;u4 eerio3todlmt  ueo;t srurxr3no1op  lncsat aDtmu oot1ole mi3iydls rmuvs u)teeomrctytoaDr neo;t0t2xrir iu1lltelies t  Drm(ronu4aptnmocildls em(mo () rxoir3oytlatrlnes;t0teuoxm nodlmen nei tf Dtmu  oo0olt mfctadlaDea(mo;t0tlxoio3iy1om   i i;()srxr(mpno1lptnlfetat)a2rauronu4apxn iciaslaDrlnmp t0arxoxf tydopteauvs;() etmir ou4lpt micia()aDur(r nt1aex mi3iad s el(mp u)alxnxf oadlp elu i s0t2xmio3ou4lptn fvi t  2ra( pno1optoiieiltfaDrm( p u4texnmo oodlptr uvs;s0trxo(m3io4ol elnetl(fsrta(mono4ape ii3iys sDrlnmo u0tlxrxr3iadom  aneil()s2uoim oy4olte netas  2ta(  ;u4tpe mfeiat a2em(vs (4 eerircootop   nvi s0 2urxm3iy1altelfvt s arrrumoot0alt mo3tys a2ra(mo (4alxomfciy1omt lu sl()trumxo ny1olt  nvi ( sDurxmo;u1tpx ifetasfs2ea(vo;(0tetrmo3iytfpD  ivi (0 rumxr3iu1aptemics ()arrmx p;o0tet  feilsfa2elnvont4 rtoxf3tadlmDelneilt setoir3oudlpenlicsa( s2rrum ;u1oexo o3iadls2rm( p (0tetnxr3oatop elu s;s)trxmxmpnu4om e ieia()sDrauro;t4oltnifeiatfa2umumpnu4alxoifctodomD ln o s) etoiopiydal   nvslsfa2ta(mo;o0apt  ietasla ulu s;u)tlxnif3oy1lmDrauvs () rxrxm3ny1llt mfeils)s2ur( oou0tle  o3ilt mDumumo (4 ltnio oytfpDelivsl(  rxo(mpnydop nmnviat  Draxrpoo0apto f3tltfmDemu pn(4trxrxo tydfp eaivolt0trto(m iu4alenmfci tf Dumxmo;t1alto o3iltla rau onu4tlxrxo oadom   uvi;( trxo(m nu1lm  liesasfsrtau  nu1aleomo3tlsfsDrmuvs;(4tltoio3tadlate u ilt t2xo(r3ny1lme mfctltfsrra(  ;u4aptniiciltfm rl(vp;(4altomocoo1fmt  i o;t0srtoirpiu4lmen ivslsf rrru  no4oeto feildfmDum(vp;u4 etoxf3iodfa r nes s) etmio oydop  mivi s sDtm(moou1tlxoio3ilt m umn o;(4 lxrxrcoadlatrlnvsls tetr(m iodoptelnvsas aruaxrpoo1olto i3ils mDemuvonu0texrxf ia1la r u s;s teum(o3iudomtemnetls) rrmu  nu1tle mociatfsDulums;(0 lerio3tytfpD  ieo;t) rurxo oy1ll e ieilt srtauroot1oexnio3tatfa eluvo t4altnmr iy1op raies (  2toxo no4ape lfeiatfs2rrumpno0tpeo o3tas m umuvp t4trtomoctadfatr uvo;()t2trxm3oodllt licsl(faDtaumpnt4aex  f3ils a2rm( on(0altrmo3iadoaDrai ilt0 rurxopio4ll emiei (  rrmxrono4oexniocilslm2rau s;(0aetrmrcoo1oa  anvs (0srxrxopiu1altnmfcils sruaurp;u1aexoio3iad s2rm(vp t)tlxnxf tydlmt  nvsls)t2tr(mpoydap   ivil(farra(ro;o1tlx mo3iatlmDrlu on(0 ltrmociodomD luvils0 2umirpoudol   iei t aDrmurpoo4apxn icias s emn p u0aetoifcoy1om r i s;t0 rurxm iy4apenlfvsa(fsrurxm ot1ope  fciasfa ua(vp;(0tlxnxrcoatlp elivs;s0 ruoxo3nydal elicilt arrrur ot4tltn fetat s2ea(msnt0 eerxf3iatlm elnesls)s2toirpou1optnmnes s sDtaxrp;o4oeeo ieiadlm2ul(monu)arenxo3iydfmt  ies t s2xo(o3oydlpte nvtls)sDtrxmonu1oexomfeiasls2umn p t4 reoif3to1fatr nvi;t)s2xm(mpoydalen ivia( arrrxrp;o0aptnifciysfmDel(vo;() rtnxfciydfaDeli s;(0s2umimpoy1amtnlivt t) 2ur(r ;u1tex mfetltlaDumumon(4teenmr3oadoaD auvols t2umxopno1omtnlivias a2ur( oou4oexnmfetatfaDrln p u4trxomo3iatfa raiei;t0 rxr(rpiy1lp  licta( a2umxmont1tee iietys a2em(vs;u)trtrio3ta1fa  ln il()tetrxm3oo4am emnetas s2uru ont4tee  feiad s ea(vonu0tlenmociodlpt  n il(  exoxm3oudalte ncsas artm( o;t4opt mociytfs rmn s (0 etrif ta1omDean i (0srumim3oo4om  mnetl() rrr( o;o4tptnifctlslaDem(vp;t) rxomo3oy1optrlies s0 2xoxopoudlp nlfci sfsrtm(mpnt1texoiieiysfm2uauvo;u) lenifcoy1oaDe n s s trumxmpiu1lm nmfcsls sDra( ooo0olenii3tls sDeluvp t)tltnirctytlmt  iei s  2xrxo3no4aptemncilt  Dum(ro;o0oltnifcilsfs um( s;t4aexrmocto1lpDrln i;() etoxrpiu1lp e ivsatfsrtm(rpno4apxo o3ilt m umu s;t4aexniocoydfpD  n s;t0 etoir iu1lm   fes s)sDuaumpot1tpx  o3tytlm rln o;t) eenio3ootoaD  i o s)teuo(opiy1apee icilsfarurx p;t4tlt mo3iyd a2rm(mon() rtrmfciodla rlu o;t)trxo(mpou4ole livsltfarururpoo4oleoif3iasfmDuln p u4alerir iotlp eauvs (0s2to(mpnu1ope lfcsas) rrrxmpno1tlxnmiciytfmDel(ms u)alenircoydlpDeanes;( seuoxo3nydlmtn ici t)srtau  nu4olenmocias a ran snt4altrxr3iotopt lieol(0trtr(mpoy1omt mnetat)a2tm(rpno4tlxn feilsfm2ea(vo;(0aetomfcoatfm e nvols sexmim ny1am emneilt) 2tm(mpno1apt mociydfs2eaumpn(0aexoxociytfm ranvs;() 2uoirpoodom elfvs t  2taxrpnu4olt mi3iatls2rau s;t) etnif3oy1fp e u s (0setrxr oy4ll   fvta()srrmxmo;t0tlenmi3iltfs2em(mp;u4 etnxo oodfp rlieolt0srtm(o3oo1ll  livsl( sDtax  ot0altoifciatlaDem(mp u)tlxoio tydfaDelues;( seurxm3oo4lmtn nci (f ruaxr oo4olt ii3iysls umnvs;t4aeerif3iydfp  luei;s) rxmim iy1al nmnvia()srraumo;t1opx mi3ildfmDrmuvo (4alxoxocta1lmtr ieilt s2to(mpny4lpe  ivtltf Drm(r nu0teeoiicilt sDrau p;u4arermocoo1omDrliei t0trurio3no1om  mivt t arurum nu1opt mo3ils sDemnvp t)aleoxr oatfmt  n sl( s2xm(o iu4amt mncilt  Drrxmpnu0oexnio3iyd s el(vpnt4trenio3oydlptrlnvs;t  etr(o no1ol e nvt tfsrur(mpnu0opxnifeiltfs2rl( ont0 renmr totlm raues ( s2to(mpoydol  liesa(  Dtru pnu0oleoif3iatfm raump ()areoiociotomtrauvi ()trurir nu4llt  nctl(f 2rm(  ;t4alt  ieiytla rm(vo ()tltoifctadfpteliei s0 rurio iudope lfct t)arumu o;o4ape  oeiyt aDum( p t0trxnif3iytfaDelivils0s2uo(r nu4ol nlncsatfsrtr( pnt4aeenio3tls a2emn ont0aetrio iatoaDr ivs t  exrxm nu1amtelfcil(f 2ua(mo;o0apto o3tltfm2eln p;()aeeoif todlaDe ues ( trxo(r3nu4optelnviasfa2trxrpoo4texnmi3tlt s2ra(vp;(4trtrxo3iodomtelues s  2umirpno4lm emfcsa()arrau  nt4alxoio3iatfm rmn pnu4 lxnmr3ootoptrlnes;t) rxrxr3oo1lme mnciltf Dua(  ou0apxnmo3iydfs2rlums u)texoif totlpDe i s;s trtoimpoy4lmtemivt s s2uaurp;u1alen ieiydla2rlnmsn(4tlenxf3tadfmDelnvo;t0trtr(r3io1ame  nvta( a2taurpou4olxn ociatls rl( p u4 rtnmf3io1fatr i i t srxoio3iu4opt  fvt s) 2umxm ou1alt ioeilslm2ea(mpnt4 rtomr3iotoptelivs;s)s2tm(opiu4apen fetat  Dta( poo1tleoifetls s eaumsn(4arxnxf oatopDran i;s)tetmxr ny1omtnmnesltf 2ta(rooo4alt  f3ildlm2uln p;t)texrmf oydopDe i s;s tetmio3ny4lp  lfesl() 2tr(ro;o1tlxnmo3ias m ra( s () rxrmrciadlaD au ols tetm(rpiodll   ieias  2rr(rpnt0oexnioeiatls umn o u0 lxnmr3oadomDrauvil( trur(r oy4lptnmfetltfarrmu  ;t1olx  feiyt a rl(vont) exoio oadfa rauvil(  2trxo3ou4oltn ivsat  Drmxmont0opxnifetlslm um(mo u) eeoioctytlaDr ueols) euoxo3oodamt mnes ( aDtaxmpot0apxo feiasfs el(msn(4trxomr3to1lateauvs s  etoxo3no1ap  livtatfartm( o;t0tpx mi3tltlmDumu ont) ltnxfciytfaD aieils trxmxo oydame lfcsas a2um(mono1tle mociadlsDraumo;u4teeoifcoytfpD li i s  eur(r ou4opt livilt) 2urxr no4tlt ioctysls2umu s;t) exrmo iotfmt lneols)setrirpoydolte nes t sDurum ou1oetoifeiatlsDrauvp;(4tetnxf3oo1lm e u sls trxmirpnu1lpt  ivia() rtruroou4opxo fctltls uanmonu4artrmrcia1omDr ivo s  ruoio3iodlmt lfes s arua(roou4tpe  fetytfm umnmsnt4tetoio3tatop e u s t0s2xrir3oo4altnmfvsat sDtax ont4oeto ociys s umu snt4 rxoir3oy1oa elnvi;t setm(o iudaltnlfcia( a2rm(r oo0aleo ieild sDrluvo;(4trxnxo3tytlp   u s;t  rtmimpio1alt lfci sfs2tm(mp;t4ale  fetatlaDean o u4 leoir3oo1fm   u s;s seumxr io1amt mfcslsfartr( pou1oleoifciytls rlumpnt)arxoir tytfate n i s) rumirpiy1al emnvsasfa2trx p;u1aexo fetysfa2rmumpnt4trtoxfcty1om rai o;(0teum(o oydlptnmivt s srtaxmpnu1oet  icilt a2rl(vp;(4trerxo oo1la rauvsl()texr(o oodole mnviltf ruaxrpoo0oet iociydfa2elnmsnt0arxnmo3oatfmDeai s (  2xm(r ny1lltnlnvs s)s2urxrpnt4ole  i3tyd s2ean onu0arerircta1opt  nes ()s2tmxm iu4apenmiei sf Dumur ;o0opxn ociydfs2ranvo t0tltomf3todlaDran s t0truoim iydalee ietas a2urxrooo0olxnif3ildla ean o;() rerif3ia1faDr ueo t)srxmxm3ny4alt  neta(  2um(rpno1opxo fciad sDeluvpnu0 ltnxr3iy1lmt  u i;s)trxrxm3iudomeemneiat arta(m oo1aeeoii3tys m2elnmsnu) renxo3todla elneolt) eur(mpnydamee nei t  2ua( pot1oetn f3tasfs rmuvs t4altrxrctatop eanes;t0 2xrxo3nodamte nctls arum(m ;t0opt mo3ilt aDrmu o t)aleoxr ta1optr nvo t  rtoiopoy4lp   ivils) Drrum nu1aptoioetat s2rauvpnu) rerircoa1fa  lu il( s2tr(r nu1ome mietls)a2ta(mpnu1altnmfeiytfsDumn o;u0artnxf3oytomte nes (0t2toir3io4aptelfcslt s2rmxmo;t4opt mfetad s2rl(vs t4tetnio3oydfm raivs (0trtmim3iu4olt micsat  Dtmumpnt1tpx iocilt m2rm( p;t4 rxoio ia1lat aneil(  rumxo ou4ol emneiatf Dra(m ot1tltniictlslaDua(mp u)trtrio tadfm rauvsls)s2um(r iudom n iesasf rra( ono0oeen ociyt s el( p (4 leoifciatfp r ivi ( sruoim iydopeelfvilsfs2rax  nt1tltniocild aDeauvs () lenmrctotfpt  neil() etmxr oodlme  net t) Dtrx p;t1tlx ifeilslm em(mo;u0teermr oo1fp eluesl()t2tr(m ny1lme lnciat)aDtaurp;u4olxn i3iydlm2uaumo;t0 lenir oatfate uei;()srurxmpny4om   nvtls  2uaxrpou4opeoifciytfaDrmumsnt4 lermr3iotfpt lnesl() 2xoir3io4op n ncil( s2uaum ot0aee  feiadlmDulnmo;t)aetomf to1opteln i;t)seumim iy4am   ivsat s2raurpot0alxn o3iysfa2ranmpnt0teenxf iydfaD  ivol(  eumio3ny1lmeemnetasf Dra(m ;u0ole  f3iaslm eaumpnu4 etoif oatla   uei t t2tmim3iy1amtelnes sfa2ta(r ;u4ape moctld m2ul(mp;(4altrmo ta1opDr neo;( s2to(m oydomenlnvilt a2umxro;o1olxnmictldls2uluvsn(4aetrmocio1fm e uvo s0sexrxrpoo4om   neiat) rur(  nt4aet ii3ias sDra(ms u0 rtnifciy1lmtrluvols)seuoim nu4oleelnvt (fa2tr(r ;t1oetn ocilt a elumo;()trenirctydlm   nvs;()t2xmxm iy1am  lnvi s  rtax p;o4tpe ifciyd sDemu pn() exnxrciatlptrlnvo t0trxoirpiy4omtemneta() 2rm(roou1oleoifeild mDumuvs;u0aleomocoa1omt lu ol() 2urxr nydopeelicslt)sDrrxr oo1opeoii3tat s rl(ms;(4texoxr3oy1optrlivilt) rxoxm no1lmee icia(faDumurpou1alx ifctydfa ranvs;(4alxnmrciotom rau o t) euoiopoodop elfeslsfsrurur no4olen i3iatfm2rm(mp (4treomf oo1op elieil()trum(m3no4ap n ivias)a2um(  ot0ope mfeiytfm2umuvs;t)tltoxo oytfate ueo;(0teuo(opiydoptnmfcta(fa2rmx pou1opxoiieilsfm2ran onu)alxnmf3oa1fpDe uvils  2uo(o oy4lptnlicilt  rrax ono1oltnmieiytlsDem(vsnt) reomfciydfmte nvs (  2umxr3iu1amtemics ()srrmum no4tlxn ieiltla uaumsnu) renmfciodlmDr n ol()srtmxrpoy1lme  nes sfaDtax ont0tpxoioetadfm2elumo;u0 lxnmrciodomD lu slt0s2xoxmpny4lm nlfeilsfs2taxr nu1tleo oetldla2eanvo;()artoif3iydfaDr u i () eum(o3nydlptn fvs (f rumxrpnu0opxoif3tatfs em(vsn(4arerxo3totfmtrliei;(  rxmio iy4lmeemietls  rraxm ot1aee iictltfs raumo;t)treoir oytoa elu i;(0trtmxr iu4ale lfvt s)artm(moou0tetomi3ils s2emumo;()tleoifcoodfa  lies t) rxmxo nu1lp emics t)sruaump;o4tpe io3iatls2ranvs t4 rtrxo iytfateluvo s0 eumxo3iy1lmtn nvta(fa2tm( pou1tptoii3tldfa2umnmsnt4aetrxr3iydoatrlu o;s0s2tm(r3no1aptnlnctl() Dtmxmpoo0opxo ieiytlsDrl( snu0treoif io1fmDr i i;t) etrxo3iodomte ict tf Dur( poo1opxniicilslm eln pnt0trerircoydfat  ues;s0s2xm(r ou4alen ncilt a2taurono0oetnmfctasls rmn on() rxoirciydoate u sls trxmxo3ou1lmte iesat  Drmum oo1alxnmictltls2el(mp;() renmf iatomt  ueilt texriopiu1lltn nvils  Duax  oo1tlen fciltfmDrmnmpn() rxnif tatop rlnvo t srxr(r oy4ol nmivtl(fsrumu pou0aet if3ilsfs2ean o;() exoif3oa1fa  anei;t0 2tm(m3nydoleelieilt  Dtrumonu0apxo octytfs rlu s;t) rtoio tydomD lueo ( trtrim ou1apeemnviltfarrrx  no0ole  o3iydlm2ea(vpnu) rxomo oa1opDrln i ()setr(m3oo4lpenlfei s arurxmonu0ope  f3ilsfmDrlnvp u4alermo3iydopDeaueslt srurxo oudlpte fvtl()s2tmur ;t4tpt ioeiltfa2rmnms;()areomrcoa1faDelnes;()srxm(r no4ap  lfcsl(  2uaxrono0tex iocilt s rmu p t0 lxrmr iadfa   i ils seuoxm3oo1omeelnvt s)aDrmur nu1ole  ociydls2umn s;(0teermrcoydfa e nes t) rurir oy4al  livtat sDrmxrono0apenifeiatls2ul(ms;u)tetnxr oodopDeanvols0texmirpno4olt lnetatfs2uaxrpot0aexo oeils aDranmp u)alxoio todfa  lu i;s0trxmio io4amenlneias)arua( o;o0olt  f3tld a em(vp;u)tltrif3tatfatrauvs;t texrimpoudll  mfes s aDtmxrpnu4tetnmoctatls2ulums;t4 lermoctotfpDr neo t0tetrxopnu1am n neia(fs2rrxm nu1olxomiciadlm2rl( o t4arenxr iytlpDrln s (0s2to(mpoy1al elfvsat arua( pnt0oex  feiydlmDrau p;t4areoxf3oydlp ranvolt tetm(r iy1oltn icil(  Drru pnt1oeen f3iltls2elnmp;t)aetomr io1opt  i i t)tetrxmpnodllen fct t)arurumo;t4oleniieiys m2rl( p;u) ltrxo3tatoa rluvs;t)trtrir3nodllen fvsl()arrrumooo1apxomf3iatfm2rlnvo;t0texrmrctydfm rlneo;t trxoir3oy1al nmfvia()s2tr(ro;o1opto f3iytfm ulnmo u0trxnmocoydlaD  u o s)t2xrio ny1alt  fvi t) 2rm( o;u0alxoioctls m2uaumpn()tlxoiociytla e nes s)trurxmpiodll elfct ( aDta(r ot0tle  fctatfm uau on()texomr io1fat an i t)teuo(r ny1omtnlfetl()sDuau ono4oeen o3ilslmDrm(ms u4 rxoir tydoa  ai ol() 2umimpou1ome lfvtlt) rumu  oo4openiiciydfm ul( snt0arxnmo iatoa rlnei;( sexoxm oydlpt  ncsa()aDta(rp;o1aleniieiadlmDrmump;()tetomr3todop  lu ils)t2umimpoy4amenmneta(f rtmuronu0apeo fctls m ulu s;u) exrxrcta1opDr n sls seumim3ny4lmt  nei (f rrmxmoot4oetnmf3iytlm2rmuvs u4treoxrcoytlatraieo t)setoxr io1lle licsls aDtr( oou0alxniieilslmDrl(vs (4arxnio3oodfpDeauvsl(  eur(r3ou4apen nvsls a2uaxr ;t0tpe  ieiad a2el(vo (4 ltnmf3oytomDr neolt  2xm(mpoydoptnmnctls  rtmump;t0oleo f3tls sDul( pnu)altrmo iotlpDrau ilt)s2urxr3iydlpt lfvilsf rur(rp;o4texn oetatfm2emu pnu0 exrmr iotlpDeauei ( trxoim io1amtelneiatfartm(mooo1tlxniietyd a um(vp u0 etrxociytfatrlnvi;( s2umxo3nu4am  mnes sf 2tr(mo;t0tleoii3iydls2raump;t0 rermr3oo1oaD lu s t0srumiopno1lmeelietl(fs2um(r ;u1tlx  oetldfs2rlu p (0trxnio iytfpte n sls0s2toxr3io4lm nmnet t)arrruroot0aptn ieiadfs el( o;t0 etnmrcootlmtrli s;t0srxrimpny1altn icilsf rtr(root4olx  i3iatfmDea(ms;(0 exnmo3oy1opDrai s;( teuoxr nu4ap nlfvs ( a2umx p;t4apen feiat a2ra(vo;u) rxomr iodfp e n o t0sexrimpno1ome mivslt srtr(mp;o0altnmfetad m2ulnmo (0 rtnmrcootoateaieo s)srtoimpoo4ol  liet tf Dumxronu4tee if3tytla rmuvo;t)trxrmf3tytfa   ivi t)trtrim3oy1lmen ieils)sDumxr ou4tpen fctydfmDrmumont4 etoxf iodlaDrln i;(0srxoxm oo1ll n neslsf rra(mono4open iciysfs2ea( p;u4trxomf3ootlp eanes ( trxmxo3oydlpenliesl(  2tmx  ;t4alenmoeils s rln p t4 ltnmr3oydfmDeln o;t  2tmxo iy1apt lnvt s)sDrmumpno4oexnii3tat m umnvsnt) exoir io1lmDelnvi t)setm(r3iu1apte fctls  Dum( oou0olxnmfetysls ulnmo t0 lerxrctydfmteaieo;t  etriopoy4lpen iet sfs2trxrp;t1optomfeild aDeln p u) rxoxo3oa1omtrlieo;t)srxriopiy4ale mneilt)arum(m ot4aeeoio3ild a uan pn(0tetnmf todop   ueolt)srtmxopoydlm e fcs sf ruaxmo;t1tptoio3iasfa raums;u4aexrio3tadfpDrlueo s0 ruoir3ny4amtnmfctlt a2taxrpnu4aetnmfeiytfm rm(vsnu0tltrxfcta1faDr nei;t0srxrxr3iudamtn nvt sfs2tmurp;t0olt  f3tasla umnmo u0 lenxo3oadlptr nei t  rumimpio1altnlietlsf Dumxrpno4olxnmiciyt sDumnmo u) etnir3ia1lm e ueo (0trtm(opiodole mfcias srtm( pnt4altomociltfs emnms u4alxrif iy1omtr ueilt0 2xrxm3ou1lptemfctl( sDtm(  nt0alxnmo3ias a em(vsnt) rxnircio1fmDraueols teurim iu4omtelnesatf Dtr(mp;u0aptnmociyd a emuvpn() rxnxfcoy1lmDrlivo ( srxrir no1ol   ivtasf rrrurooo0altoiiciytfa2ranvo;()treoifciy1fpt ln ilt)teuoim3oy1apenmiet t s2rax onu1tpeoii3iys m el(vo ()trtniociydfmtr nei;s0s2xrio ny4om nmiei t s2tmu  nt0oex mo3iltfaDua(vp u4arxnxf3to1lp  lueo s0s2um(o3oydlmtn nct tfarra(mpou1tpt mieiadlmDum(mp t0artnmrciy1la  aues t)t2toimpiudlpenmfvt (  rrmu  no4opeoio3tytlm um(vo t0 rxnir totomtrlnvslt srxm(m3nodope  nctatfaDuaurpoo0aee  f3iatla ranvp;t)trxnmocio1la eau o;(0 rtrim3ny4ap   fvils) Dtrumpoo4tet ifciad mDel( on(0teerio3to1fmD  ueils)srtmir3oydop n ncs s)s2rr( pnu4olxo feias aDum( s (0trermf oo1lptrluvsl(0truo(m3oy4ame  ivia(  rur(mo;t1olxoifciatla eanvo t4 lxnxf oatfpD  uvo;s tetmxrpnydole  iet s)a2trx pnu1apxnmfeiyslm2rmu onu) leoxo iytlmDeaies;s0 exrxopou4lp e fct s  2urumooo4ole  ieiydfa ulump u4 eeoxo3oatoate n i;t)teumimpiydape mnct (  Dtrxr ou1tpt  fetysfs2ul(vonu0artnirctydopDranvils)trxoxmpnudlp  mfeiat)srum(ro;o4oetoiictls a2raumo;u4areomfciydopD  uvolt texmir nudop e ici (f Drr(mp;o4oet ioeiad m2ul( p (4 rtnmrciytoat au o s srtm(o3ou1lle mnviat aDur(mp;t4tptnioeiadlsDrmu on()trxoxo3ootfmDrlneo t  rurim nu1amt livtasf rta( poo4apxnmfciltlaDulump;t)tlxnxr3oodomD an s;s) rxm(opiu4op  mictlt artr(mono0tptoifeiys aDra(vpnt4alxoiociytfat  u ol(0trtoxr3oo4lpt mfciltf Dtauronu1tleomoetld mDuan o u0artnifcootlaDelneilt0tetoirpoodlptemiesls  2rr( pnt1alxnii3iltlm2elump;u) etomo iydfa eanvs t trxoiopiudopenlfvtlt)arur(  ot4tpxniietytfs2em(mp;u)aetoxfciy1opDrlivi;t0teuoxo3iy4aleemfvsatf Dta(mo;u4tlt mietatlaDeanmsnu)aetnmr3todfa   nvo;()srxrim3iy1lme mfeiltfa2urxr no1oleoioctlsla ranvs t0alxnioctatomte uvils)t2xo(rpnu4ole  nci t  rumxm nu4tleo o3tatfa2emuvo u)alxomf iydom r uvi;s trxrxr nu4omeelfcsas)aDurxrp;t0alen f3iad s rluvs;t4arerio iydlpDe i o;() 2tmio3oo1lmeelncia()s2tax oou4tet  fciad m2ea( s;t4 rxrmo totfa   ivols) 2xmir iudapenmfetatfsDta( pou0tetomoeiaslsDrm( p t)trxnmf oadoateai il() 2uoxo3iu1amt mfet ()arur( pou4tpxn i3iasfs2ranvp;()arerif oy1laDeauei s)tetmxr oo4amt licia(faDua(m nu0olen f3tlsla2rmuvs (4tlxrxr iy1oaD ln o;s srumxmpiu1lmt  ncs sf Duaxmpnu0tet ioeias mDul(vp;u4 etniocoytfaDe nvs;(  etmio3ny4olt  ies tfsruauro;o0tleoiieiyd s2umn o;t)tlxoif iodlaDrln slt) euoir3oo1opee net s srtrx  nt4olt mfctyd m2ua(vo (0alxrif oytomD anesl(  2xo(r iy4ll nmieslsfarrau ooo1aeeoiicild mDem( ont)trxnmo3oy1fp r nes;s0trxr(m3iydlpt  feilt)srtmx pnu0tleomociasfa2el(mon() reoif3io1op rai s s) rxoxo ou1lltemfvsas a2raum ;t4aeen f3ils a ranmsn()aexrircoodlpDeaiei (0s2trxopoo1lpte icsls  rururooo1ape iiciatfs rl(ms u0tetnxfcio1la eanvs;s0srtrim iu4om e ieiasfsrumxmo;o0aexn oetldlmDul(vo (4tltrxrcoo1lp rluei s)srxo(m iu4apt mnvi s sDrrxmpnt1aeeo o3tltlm2elu pnt) exrxf3totoaD lies;t0trum(m3iodapte ieia(fsDrrxr no1ope  ieiaslmDul(ms;(4trtrmo oa1la   uvi s0sexm(r oodlp elieilt  2rru poo4tpe iiciatlm2eau o;(0trxrxo tatoa eluvsl(0srxmxr3nu1ale  fcsat aDta(mpno1oet moctytlmDelu o u0 reomo oa1lmD lueo;s teuo(o3iy1lleelnetltfsrua(m nt1ale mi3iasfa2el( on() etrxo iotfp   uei;()srto(m oudam n neiat aDumur ;o0teeo fcild a2el(mo t4tltrio iy1lpteai i;s0srumxr nodamenmnvtl()sDraxrp;o1texn fetyt a2ra(vp (0areoxf oodoatrauvi;(0 rurxopnu4lmeemfciat aDrrur ;t4oeenioeildfm eauvo;t4trtrmr3tatop r u ols texr(r3io1ape  netat sDtaur nu4apto o3ilsls2em(vp (0 lxnmociatoa  aivi;(0t2tmxrpiudol emicsat a2taur no1tpx moctytla2ra(vsn(4treoif ootoateanvo t srto(opio4ole  nesat  rtrum nu4opeo fcilsla elnvo (4treoif3ty1fptr i il( seurxm3oo4opeemncsls)arrmx  no0tlt  ociatla emnmo (0trtrirctytlaD aivo s  rurxr io1ap  mies t arrrxro;o0apt  iciyt m rlu p;t0aetoxf tytom eanesls0seuoxm iy4om emnvt () rtaurpnt1alenmfctld sDumnvo u4 rermo iodlpDeaueo ( srum(rpiy1lmen ncsa() Dtr(ront0tpenifetldlmDul(vo;u0 lerxfcty1omteai i;(0 rto(m iydapenmnvs s aDur(m no4tle mi3iadfaDra( p;u)arxrxf oatopDelies ()s2xr(opnu1alt mfctls) 2rrxmpot0altn fetltls rauvp u4 etnxr tydopDe ueo () etmir3oy1am   fvsatfsrtrxmoot4ale moeiyd s uau pnu0altrio3iadlmD aueo;t)t2umxopio1omeelivs () 2rax pno0oet mo3iydfmDran pn()arenmfcia1faD  ieo;s t2uoiopoy1lltelnesasfs2umxm ;u4tle mociadlsDem(ms;()tetnmf oo1fat lu i s s2xoxr3nu4amtemfvslt)sDrm( o;t0oeeomi3iytls ulumo u) exnifciytlpt ai slt0s2xr(o iu4op n icil(fsrtr( pot0opx  oeiadla2rlu s;u) reoio3to1opD lneslt trxriopoo1amtelietasf 2rm(mono0tpxo o3iaslm ulnvpnu) reoxo3oadfp rlneo;s srxoir3oo4altnmfcs ( sDua( o;u1tpeo oeiys a2emuvp (4 lxrif oo1opD an ols)srxrxm ny1lltn fetl() rtmx pou0oex ii3iytfaDuan snu)tetrmf oodoptr ivi;t t2uo(mpno4ol emfvt tf rrrxronu0apx miciatlsDel(vs ()aexnxf3totlm raiei;t) 2uoio ny1lmen fvtlt sDrrxro;o1aex ifciyd a umnvp u4alxomfciodfp eaieo s0seto(m ou1lpee nvsa(fs2rmumont4oetn f3tat s ul(vs t) etnxf3iadop eli ils)s2xrxm iodlpeelicsl(fa2ua(r nu0aee mietldlmDuauvs (0 reoxo3ia1lmDrlivo (0tetmxmpio4ape mivtasfaruau pot0aeto oetydfs um(mo (0texoirctatfpD lnvi;s)sexo(r3no4lmtnmiesls)arrmx pnu1opx  o3iadlaDraumpnt0tltoxo iy1lp r ueils0 2tm(opiu1ope lfci () 2rm(mpou0optnmoetld sDra(mp;() lxrmf3io1lpteanvsl()texo(r3oudll elfvsls a2uru  nu4texnmi3tadfs2ua( o () lxrir iytoa rli o s0 rtr(opiy1lpee fctlsfartaxr no0aeeomf3iatlsDrlnmo;u)teenmf oodomDr u i t0trxoxm nydlmt mnctas s2tr(m ;u1aet iocild sDelumon(0aeeoir3iytoatrai ilt)t2xmim3nudol e ics s) Dtmum ;u0oleomociyt sDelnvp;(0 lxnmf oatom  lnei;(0trto(r iudopeemiei s arrau ono4aetnmoctytlm ra(vo (4 rxrxr3io1om  an o (0trtr(rpnodll e ncs s artaumpoo0apen feias a2ulumpnt)trxrxf3oatoa r i ols seumir nu4ap  liei s)a2tm(mono0tpeo ieiysls uau s;u0texoxr tytop elneolt t2tmxr ou4ll  lictlt) rraxm ;t1tpx ii3iyt a ea(ms;t0aetrxrcoytfatraies;s s2xoirpiodal emnet () 2tr(r no0altomoeils a elnmsnt)tlxnxr oytfpDeaieol() etrir ny4amte nctls)arumum oo0tetniiciysls2ua(msnu0 rtnio oadop r nvi s0trumxopou4om n fviat a2tmu  ;t4oetn iciltfs rmnmpnt0trtnmo ia1omt aivo s0srum(o ny4amenmfesa( srum(  nu4apxo iciltla ea( o;t4trtoio3iy1fpDeai s s0tetr(rpio1al   ivias) Drm(rooo1olxn oeiydlm ranvp t0 lxnmrciy1op  auei;() rurxopno4lltelnvias  Drmxr no4tpe iicildfa2rlu sn(0artoircty1oa  luvol()setoxrpoudom  mfcils)srtaumo;t0tleoif3iatla2em(vs u) eeoif oytoate ivi;(0trxrirpoydolt mnes t)s2truronu1oet io3iatfmDumnvonu4tltnxf ta1faDe ues s0 etoirpiy1alen feiatfa2rmum oo4oeeniicildla2ran o;(0aexoir3iotomt  nes ( s2tmim oudal emncsls) 2rrump;t1opx  ociadls rl( p u) lerxf3iotfaD  n ilt0 2xmimpiydal n nesas)srrmxrp;u4apeo iciad mDul(vo (4altnmociytoaDelu s;t)trurxr oo1ap  liet s) rrmxrpnu1altomfciadfsDemu p (4tetrmrciy1lm elnei s0texoio ou4amtn icils a2taxr ou4teto ieiydfmDulnvs t0 renifcoadlaDelnvslt srurxr oy1lpt lfvtat sDta(root1tex io3tlt aDeanmp;(0texnir3ootopte u ilt0srum(m3nodaptn ieiat)sDurumpou0oetnmfctadla el( sn(0tltnxrcoatopt aneslt) rxrxo3io4lmen nvs s)arurx o;t4oleoiieild s2eluvo;t0 exomr3iydop  an o s0seumxopoo4lp n ietas) rtr(ro;t1aeeo oeildfsDrluvp;t)artrmo3oydfa elnvs;s0 rum(r io1am   fes t  rtmu  ;u4apxo f3ildls2umnmont0teeoiocty1lp e iei;s0t2xmxr3no1ope  nvta() Drr(mono0aetn i3iaslmDua(ms (4aexrxrctydfptrlueolt)texmxm3iu1amte ncil(fsrtruroot1tpx iociltlaDra(mpn()arxrmf todla   uvs;()sexr(o iudlmenmnvs t) 2tru ono1aeeoiocildfs uln snt0arerxfcoytlat lueo;t0t2tmir3no1omtnmiviasfsDua( pno1tpxnmi3ias m um(mp;t0aeeomoctotomteluvo s0trurxm ny4optnmfvt t)s2tmx  no1oetnmoetldfa emn snu)aetoio3tytoaDrliesls0srxo(r oo1olt mfei t)aDra(rp;u0tptnmoeiasfmDulu s;t4treoxoctytlp  anvsl(0 exmim ou1amtn feia( artrum ;t1aet mfctat sDea( s;(4texrxo tytomt ai i s teumxr nudomte icia()s2rru poo0olxoioeild a emuvp;t0trxnioctotfa   nvi t0s2umio3nydoleelnvi t  rurxronu1teeoif3iltls2rmumo u) eenmr3tatomDe neo t  2trxrpou4am n icilsfsrraxr oo0tpxo feiat s uau o;u)alxnxo3iatfat  ieols)srtoirpiy4omeemnvtat s2trumonu1opxnmi3ildlaDulnmp;t)treomo iydfaD  uvil( srxo(o ny1lmte ieta(faDra(  oo4oexn o3tytlaDul( pnt0arxomocoadoate uvs;s)teumir3io4al n fei () 2rm(rooo0ape  o3tatla uan p;u0alerxrciotfpte nvo;s0t2xoxmpiudap nmivtlt)a2umur ot0apxn fetadlaDumn ont0alermr totlptr ieils) 2xrio3nudame mfvt s)s2rr(mpnt1apxo o3iatfm2eanvp t) etoiocoodfpDeaiei;t0sexrxopnudll e fes s s2tr(m no1tpe  i3iatfa2rmn o u) etomo iotlmDelivilt)srumxr nydop nmncslt sDtr(mo;o1texnmieiad mDea(vo;u0tlxnxr3tytfptran il(  2tmim3ny4aptelieilt) 2taxr nu0tptoiociytfmDrl(vs;u0trtnxoctatoptr nvol(0 2umir3io4opt liciasf 2urxmo;t4tptomocild s umnvp;(0teenmoctadlpDe ivs;(0srumxr3oo1oleelnet t  2ua( o;o4opeoifctytfaDrmnvpnu4altrifctydfp e nvs t)t2ur(o nudoltelies s)a2uau  nu1ale ii3iatlaDelu o t)aeeomr to1omDrauei;t0srxmxopiydolt lnctl(fa2rrumpou1tpe ioeiaslaDra(mp;t4 lxoiociy1omDelneo;( srtoiopiy1llenmfvta(f rumxmp;u4aee mieias aDeau o ()trxnxf3iytlmDr uei s)srumimpno1optnlncsas a2ta( pnu0aetoioetadls uanmon(4aetnir totomD aneo;(0texo(o ny4omt lncsat) 2uaurpnt0alt ioeiadlm rl( o;()arxrif3iadfa  lu o;()trurxr3nudoltnlivsa( sDrmxrpno1ape  ietltlm ua(mpnu0arenmrcoodfa rai o (0s2urxm oy1om  lnvtl(fsruru  ou4alt  f3tltfa ulu p (0 eenmrciatoaD livsl()trxoxm3oo4lpee ivt ()sDrrx  no1olx  feiat aDum(msnt0arermo3ia1fp e i sl(0sruriopiy1altelfcs s aDtrxrpou0apx ifciytls2uanvsnt4arxnifctadoaDrli s;(0trxr(opnu1optnmivils)sDtau  no0olx  f3tas aDranvo;(0artnir3tydlm rau ol(0trxrim3no4op e ictlt)srrr( onu4oetoifcias aDuauvsn(4texnmo ta1fmDrlu ols srtrimpoudoptemnci ()a2taxrpnt4alen oeiys m2uluvonu0tlermocoo1optelu olt)srtoxr3oo1ol n icslt)aDrax  ou1tetomfetad sDuan o;()areoxfcoatfmDr uvils t2xo(m3no1alee fcs t) 2tm(mpou1teeniiciasfa uluvsnt4arerxf3oy1fpD an ol() ruoxm3oy4lmen nvs (fs2um(root1aleo fciltla um(vo u4tleoio oatfm   uei;t)tetrio3nydaptn ncil(f rumx oou0tptoiicilsfsDemnvo;u)tltriocoy1laDe i o t0 2xrirpiy4llen nct (faDtmumpot4opto oeilsfs uan s;t4 exrmr ta1fp eli s s0 2umxo3oodapt  fci s)s2rmxrpoo1alx  fcilsla2uauvp;u0trtnmrcoy1fp rln ils truo(r3nodlmte ivs t  ruau p;u0oexo oeiytfs eauvs u0aetrmfcto1fmtraues;s0s2xr(mpoo1amee ieiltfsrrm(moou4texnmieildfm2elnvsn()tltnxr totlmDeaivs;t s2xo(r oy4omt  nvtls sDrmurp;o0opx  fctasfa rmuvo;t4 etoxocto1lpD  n i;s) euoxmpnudopt licil( arurxm ;t0opt if3iys sDem(mo;(4arxnmr iodomDe ueo;t0sexrxo3oodomt lietas s2rm(rp;t1openmiciatla2rmn pnu4 rerio oo1lmD lneilt0setmir nu4amt lnctl() rtmx  nt0oltn oetld a2em(ms;u4 exomr3iadlpD livols s2xrxrpiy4al  mfci sfarurxmpnt0alxo f3tld a rln pn(4aeenio iytlaDranvo;t0 etmio3oy1oleelnei ()s2taurpoo0aexo feiadfs2rm(vs;t)trxomrcoy1omDr u s;(0t2xoxm3ou4apte neta(  rtr(m ;u0tpeomictyd s2uanvsn(4 ltnmr totfa rlies s srtrxmpny4aptnlieta()aDua(mpou1aptoiietytlm2umums ()treoxo tytfmt an ol(  2urxr3nu1ap e ietatfarururpnt0olt  o3iadls2ea( onu0trtrxocoydoa e i ilt0trtr(m iy4lpenlietl( sDra( oou4oleniocilslsDum( p;t4arxrmo todfmt  uvolt0s2tr(r3oy1ome liet t  Dtau  nt0tlxomfctyslsDelu p;t4 reoxo totfmtran o t)srtoio oy1lptelfctlsf 2taumono0oexomfeilt s el(vpnu)alxrxr oytfa elnvils trtoxo3nodopeemfcta(fsDta(rp;o4aexn i3iatfaDrl(vp;t) ltoxo ootfm  livo t)srxriopou4ale  nctas sDrax p;o4openifcilslm2rm(mpnt4 eeomf ty1opte uvilt)trurim nudapt mncs t)s2umum nt4aexn ociytls ranmsnt0tetnxf3tydoaDrluvi;( truoxr oy4olenlieilt) 2tmxrp;t0tle mf3ias mDran pnt0 lxrxrcto1om  luei;( t2tmxrpnodom  lfcsat aDra(  ;t1opxomf3iad m umnms (0trxrxo3tydlpte n o s t2xrir3no1amtelietlsfs2umumpou1oee iieiatfs eau p;()aeenir3ootfpD ln s;( trxm(o oodolenmncs t sruauronu0oetn icildlaDeanmo t4artrmfciodfateluei;()truo(opnydom   nvi ( sruaxmpnu1alxn oetat mDuln o t0aeeoir iotfmt aivi;s t2xrim oodam  lfeilsfa2taumooo1texomf3tyd s2um(ms u0tltrif3iodfpDeli ols)t2xm(r iudlpeelnvs (  Drmxmpnt0tlenmo3iytls raumsnt4 reomrciy1fa rlu o;t)srxm(rpio1lpee nvta(farur( p;u4oeenmiciatls elnmpnt0artnio3iotfmt an s s)s2toim3nydlpe mies () rrrxrp;t1oleo f3iadlaDrl(mo u0alerio ia1fat anes s) rtmxopnu4aptemnesas sDuaxmpot1aexoiietlsls eluvp;(0trxnxr3oadfmtrlnes s)s2trxm3ny1al  mics s) rtr(rooo1apt iiciys a ua(vo u4teenmrctatlpDrlies ( t2uoxr oo1ap nmnciat srumur nu4tet ioeilsla rauvp;(0aeermr3iatlaD au ols0trxmxrpnu4omt mfeta()a2tmx pou0opeo fcilt s2umu snu4 lxrmocoa1oa ran i;t srum(o3iy4amen ncilt  2uaumpou4olt mictytfsDran p;(4 leoiocia1opteaneols0seuo(r oy1lpe miciltfaDtaur ;t4tlxo i3tad mDul(mp t)tetrmociadlm  lieols0 ruoxrpoudlpt  fesl( srta(mp;o1aeto octldls2elu o t4tltnmo3ootlpt  ieils0t2xo(mpoy1alen ict ()srtrur nt1oee io3ilsfs2uan s u4teenxfcty1oa   ivo (0 eurim ou1ole  nesl(faDra(mo;o4opxnmoctltfa2uanvs;t4trxrmrcty1fa e ivilt  etrir ou1lmenmncsa(faDrr( pnt0tetn i3ias sDelu o;(4 eenir3tadoptelnvs;() rur(r3iy4lm  mivs s artm(mp;t0tltn iciatlsDrlumsn(4artrir3oa1laD lneolt0texr(m ny4olee nvs s)srum( ooo1tlx if3iasls rauvp t)trtomociydlmteanvs s)trxoxo iydomee nvil( sDum(rp;u4tltoioeiaslsDua(ms u) ltnxociadomDe ueo s)sruo(m3ny4ol nliet s)srtmu p;u4tlxn f3tldls rlu o;() rtomfcto1lateau i ( sexmir3iu1lmtelfcsltfaDurx p;t4alt  oeiyd aDumums;() lxoxr iodfmt lu il(0t2xmxm3io1lmt licsltfsDur(mo;u4ale moetas s ean s;u0 exrircoo1op  aiei;t s2xrxm3iudapenmfetltfsDumxmonu4open o3ils sDumn o;(0trtrxfcootlmtrau s (0setmim oo1llenmnesls s2ra( p;u4aexn i3iat s2rlnms t0 rtrmfcty1omDr ueolt0sexrxopoodamenlfei () Drrxrpou4olt io3ias sDrlumsnu4 ltomocoa1opDraivo (0 exmxopiu4al n nvsls)arrrxrooo4alxomietytfm rl(monu)aetrmocoadla   i slt  2uoxo oy1olenlfesa(fs2umu  ot4aptomietytlm ul(mo t4 lxomf3iodomt au sls0seur(o nydom elnctas)srtrxr oo0tlxnmietyd a2rmuvs u)trtrxo iadfpD auvs;(0trxm(o no4olt miet tfa2trxr nu0oleo feiysfa rl( p t4trtnmociy1latrln i t)srtrir ny1amt  fcsas)s2tm(r nu1olxomfciydfsDumu o u4tlxniociy1lpDelnes;s0sexm(rpoodamee nes s)artmxr ot4optnmi3tyd m2um(msnu)alxomoctydlmtr i o (0seuoiopiu1llenlnvt s)a2urumo;u0oexo oeiysfs2uln s () lxnir oytlp  au i;s)t2um(opiudopeemivt t artaxmo;t4tpeomo3ils m2rlu p;t) exoxf iatop rluvils)t2toim3ny4am  lnvi (f rua( ont4tpt mi3tltlaDeln s t4 rtnxf oadoa ean ilt  exoxo3no4olenlfviatf rtmxrpno0tlen iciltlmDumn pnt)aeerirciodla  anvo t0 2xrxr iy4amtnmfvia(fsDtau  ;u4aeenmf3iltfaDeanmo t0 rtniocoytoa e n olt)s2um(r3nu1oltemncta(fsDrr(rpot4aexn feildfm ra( sn(0texoxfciydoaDrlu sl(0teuoxmpoy1om  livtas)aDtmu  ;o4tpe  ieiasfm2ra( pnt)arxnxrciatlm eln i;s  etoxr oy4lptnliei tf 2tax  nu0teeomo3ilsls ea(vo u4 ltrxocoadlmD auvi t srxoxm nu1oleemnes t aDtrump;u1aeeomicildlaDumuvo u0tlxoio3ia1omDr u i;t0 rxoiopiu1ap n netl( srta(r ;o4olxnifciytlsDranvs (4aeerifcoadomte u i t0t2umim3io4ameelictl( arrm(mp;o4tltn oeiadfm2ua( o;t) rtrif3to1lpD livi ()trtoxo3oy4ome mnctl()aDtm(rpnu4texoif3tlsfm2eln s t) etnifcia1op  ai o;t seuo(r3nodape mivtatfs2tm(rp;o0olen octytfa2ranms;t0aeenir3iytlat ln i s0 euo(o iodlpe  fcsl( srrmx pot4opx  f3iatfs2ra(mp t0 rermrcty1fat anvo (0tetm(r oo1ameemfci (  Dtrump;t1ole ifeildla rm(mpnt0 lermr3totomtelneo;s0 rtr(o ny4alen ics tfarrm(m nu0opt mo3tas m elnvo;t)texomr oodlp elu s;s  rur(mpoy4ol emfvt ( srumx p;u4oetniieiytlaDeau p (4 lxnxfciadopDrlieo;t0trurxrpoydom emfeilsf 2taumpnt0apxn o3iyt a2elnmp;u4trtnxf3iotoaD auei;s  2toxrpiy1openmnct t) 2umur ;t1aet mictld s2rl(mo;(0alxnmoctytoatrlneils0teumiopoy4apt mfctl( aDtax  ;t0oee  fctlsfsDem(vp ()trenmrcootlmte uvs;(0 exoio oydalt  fesat)s2rmxro;o1aleo oetls a emuvp;u4aetnmr3tadfptrli o;s trtoimpou4lptelnctls)aDrmu pot4aetoio3tysfs2ea( s;u)alxomo3iatfa eauei t)tetrir no1ol  licslt)aDrrx p;u4teenmfeildlaDua(vsnt)tltomo oo1om  au o;(0s2urimpiudlp n ivsatfs2ta(rooo4ole  i3tlsfs eln s ()teeriociodfaDeaivo;s0t2ur(mpiydope mfct t  2trur ;o1aee  oeiydlmDuau o t4trxoir3oatfat lueil(0tetrxr nydalte nctat  Dra(r ou1alx  ietyt m2umu p t0trxomr tytopDe nvo;(0 rurir nu4olt mfci t a2ra(mpot1tpe if3tysla ulnms;(4texrmr todlm  lnei s0 rxoxr no1al nlfviasfs2rmu  ;o1oeto ietytfm2rlump;t) ltnxo iadfm eauei t s2xrim iy1ame  icslsfsrta(  oo1alxomo3ilt aDum( p u) lxnxf3todomtran o s0 eur(m io1amtelnvtatfsDraxmpou1opt ifctls s2umnvs;t) lerif tatlptelivo;s setrio iy4lpen ics ()a2umx onu4texn ietatfmDeln p u4aexomo3iatoptran ils0texm(o3ou4ome liei s a2uaumo;o4opxnifciad a2ua(msn(0tlen
\ No newline at end of file
@@ -0,0 +1 @@
+n sl( setm(r3oudal  mnvi (faDtm( onu1apx  octad m2um(vs (4alxoio3iadomD anvil(0s2ur(r ou4om   fctas s2tm(rp;o0oeenmo3tat m2ea( s;u4aexrxrcty1fateaiei s0 2xmir oy1am e fetl( arur(rpou1apeomi3tls s uanms u0teenmrctadfaDr uvo s0 rxo(o oo1opee net ()srtax  no1olxomictyd m emuvp t)alxrmf3iodopD livo s)s2xo(r3iy4lm eliesas)sruaxr ;t1aetnmieiys s elnvpnu4 rtoirciotfpDraueolt)trxrio3oudapee ncil(fa2rmxm ;o4aeeoif3tas s2uauvs;(4texnif todlpt  n sls) 2xr(o3oo4olen ivilt) ruaxmp;u0aet mfctlsfsDuauvo;u0arenxr oytop r u sl( tetoxmpny4omt  ivta(faDrr(  ;u4texniietys m eanvs;t4tlerxo3oodfp  auvs;t s2umimpnydamee ivil()sDtm(r nu1olenifetld a2elnmp t0 rtnxo3ia1laD liesl(  eurxopoodale lnvsat) 2rrumpno4opxn i3ilslm ulumpnu4 eeoxocty1lptelueilt srxoiopou4llenlnvias  2uau pno4tlx  feils m2rlumonu4tlxnirctatoat auvi;s0texm(r3oudap nlnei ()sruaum no0aee io3iytfs2ran p;(0 reomrctydla e i o t) 2umxopno1amen fcsasfarua(ront0optn oeilsfm2rmumpnt) ltnircoydlp e iei;()sruoirpno4lp nlfei s a2tax  ;o0aex  i3iat m2ea(vpnu4 ltoxf3tatopD lueolt teurxr3ou1olte nvil()srtmxm ;o0tptniietldlm raumonu0tlerxr3todfa r n o;s t2xr(m oy1oleelnviat srrmu pou1alenmieiadls2elnvs (0aexomrctadla r n i;t0 2xr(o3nodlmtemnctatfartr( onu4apt mfciatfaDumu p;()artrxo3todoaDeanvi;(  2trirpoo1ap  mnei t) rtru  ;o0tlxniieils m2rlnvs t0 ltrxf3iadlptr uesl( s2trim no1ame  fvsat sDrmxrpnt4oltomfeilt sDumnmsnt) exoio3iy1fmD lues;t0 2xmxr oy4om e nctatfsDtruro;o1aleoioctytlm uln s t4teeoxf oo1latr ivolt) etoir3oodlp  mnvi sfarraum ;t4alxoiietltlmDumnvo u4 rxoxr3oodoptr ies s0t2xrir3iudomte fei t)srtm(mp;t1texn oetltla2rauvo (4 exnir iotfa e nei t)trxr(o3io1lme  ivsat)sDtmxr nu0aexo fciltfsDemn p;u4altnxfcty1faDeli sls setoiopno1opee neia(fartmur ou1olt  fetltfsDum(vonu)trtrxo ootfpt luvols t2to(mpiodomenlfvtas)artrurpoo4texo f3tatls2rmnvs t0arxnxf3iytomDeaieols  2tm(r3nu4lp elivi s) 2rm( ono4ope iietlt sDrlnmp;t4tlerir3oytoa e n o;(0setmxopnu1omen fvia(f 2umurp;u1aexniicildls eaumsnu0teerxo iatfp r iei ()s2uo(rpiu1omenmfetls arrr(mpoo1olenioctltlm2ranvsnu4trxnmr iatoa r uvo s t2xoim3iodal elivilsf Duaxmooo0tetnifeilsla2umn ont4 rxrxr3iatlptelnesls)trumxr nu4opt lfesa() Dumumo;t4aetnmietadfs2ranvo u)aetrmo3ty1lmDrlneo;()s2uoxr3oo1llte feta( arrm(rpno4ale mictytfs emuvp;u0 eermr iotomt lneol( truoxo no4omen nvsls)aDurx ont1tltoifeiatfs ua(vpnu4tlerio oo1fa eauesl()s2xoio3no1lm nlfcslt) Drmum no4alxomoeiytfa umnmp t0 rerxo ty1lm rlu s;() 2tm(opnydlpe licia()srtrumooo4aeeniociydfa2ranmsnt4 lxoxf oytfmte ueo;s) rxo(o3iy4om elnes t a2raxr oo4aexn ieias m2rl( o (0 rxrxr3iotfmt  u sl(0teuoxmpiodll nlnviasf Dra( onu1opeomfciltfm2umn p t0texnifctytlmt  nes (0t2tmio nu1optnmictas)a2tru  ;u4oetnioeiadlsDrauvs u)arenmocio1omDrlnvo s  exr(rpnu4ol  mnvsat) Draxrp;t4aptnmi3tadfaDra(vont0artoif iatfm eln s s) rxr(m iy4apen ivt s artmxrp;t1alxo ieiadlm em( o;(0aeerir ootfmD lu i;t)s2xo(r oy4ap  lnvslt)s2tm(r ou0aexn o3ias mDel(mpn() eenxf iadfp  lneo;( srtmimpiy4aptelfes t) 2ur(mpnu1oeeniiciys s umumpnt4trenxfctotfptelu ols0srtoxr3oydlm elies t srumxmpou0ape mociydla2rlu pn(4teerirciy1fmD  i s;s  2umxr3oudll e ivslt s2urxmpoo0alen fcilt sDrmnvs u)arermrcia1lp rlivs (  ruoxr no1ape  ivi (  2rmur ou1olxo ieiltlsDrmn pn()texnmfctydfp elivolt trxmio no4om n neia(  Drmx onu1oetnmfctas s2elumo t0aeerio oadomtr ies (0t2xmxopnu4lp elfctl( arur(m no0tpto octyt s2um(mo;t) ltnmr3oa1oat lu o;t s2ur(rpio1omeemnetat srtaxmo;o0oltniicildlm2umnms u0 exrir oy1la e u sl(0t2toxopoo1aptemncsl(fa2tru ooo4oltnioeiaslaDemnvont4teenxf iydfa e n ilt s2tr(rpnodll emnct (f rtaur ;u1altnmoeiat mDuaumo;u4trerif3totoaDe uvs s0t2xmxmpoo1lpenlivs tfaDtm( oou0apxnmo3tatfmDeauvs;u4alenxocoydopD lues () 2umxo3nu1op nmnvt (f rumxro;t1tlxoif3tldlsDrmnmo u4trtoio3tydoaD luvo;s)s2tmxrpiydomenlneils)sDumx pot1tet mf3iadfm emn p;(4 ltrmf tydfp r ivilt seur(o oy4oltelieil(f 2ta( oot1oetnmfciatls2el(vpnt0 exoio oatlpD  uei;s  rxoxm no4apee fvtlsfaDum(r ot0oexniieilt a2ranvo;u0teermo oo1fpD  ueo t)trto(rpiy1aptnmncil(fs2taxrpot0tltoifcildfs2em(vsnu4artoxfctydfpteai ilt t2to(o oydom  lnci s) 2rm(r ;t4tleomf3iadlsDran pnu) rxnio3iadoa   n s t)trtmiopou1lmtnmnciat aDtr(  nt0aee mi3ils a eanmont)alenmr iotlmtrluvo ()s2urxrpiu4oltelfct t)s2rru  ;o4oltomi3ilsfs umuvp;t) exnio oo1oaDeln o;t0s2tmxrpnu1altemfctl( srum(  nu4opt mfcilt sDeauvo (4tlenxo iodfmte u s t) 2tr(r iu1op   nei (f 2rmxrp;u4opxn ociadls2ranvpnt0 rtoif iadlm rlueo t0trtoxopiu4altnmivsat a2tmx  ot4teenmfeiysls uanmonu4tlxnxo3ootfm r i sls)t2uoxm ny1optn fcils)arum(rp;u4oexn fetydlmDrau s u4 etoxo3ootlm raivi (  rxr(rpiodolen fvt t)s2uaxr ;u0olto o3iytfmDumu p (4tetnirctytomDeln s;t0s2toxm3nydopte neiat) rua( pnu0tetomieiyt s2ra( snu)aeeoxr ta1fp rlneo;s)seuriopno4lmtnlfesatf Dum(root0aetnmfciadfm em(vpn(0 lxniocoa1latrau olt trxm(o ou4ol emfei s) rtaxrpou1apxn oeiadfm2eauvp u0tlxnmr totlat  ivo;s setoio3no4apt  fci tfaDuau  ;o1apt  oeiltla2el(mp;t4artomociy1fat lnei;s) euo(r oydopeemivtat) 2rrumooo1apxomfeiadla2eluvsnu)trxomocia1oateai i;s texoxm3iu1omenmfcia( srraumpoo1aet if3ildla rmnvs u4treoio oodlpD lieol( srtmir iy1ll  mfesasfs2umxrpnu0apxoioetls sDua(mp;u4 lxrmf3oatoptran s t  rxm(r no4llen nct t) Dta(m ;t1tex moetysfs ul(vs;t0texnxfctydopDeli sl(  2um(mpny1om   nesl()aDrm( o;o1apenmiciasla umnms;t)arxrio3ootfmteluesls0s2xoimpoudop  lfvtas) rrrxm ;t1texn i3ils a2raump;u)aetnif oy1fm e ues;t0 2to(rpno1apt miei s)srumxm ;t1opt iieiyd m rl(mpnt4 leoxf todfm raueils0trtmxr3nudopenlfvslt arrax oou4teenmf3iatlaDem(mont0aetnifctatlmD ai sls srtrxrpoo1op e fvi t srumxm oo1tee  feilt s rm(ms u0arerio io1late nei (0tetoir oo4altn fvi t)artm(mooo4alt iiciytfsDul( pnu4teerif3ootfaD lnvo (0teurxo3oydllee neils  2uau  nu4tpt iiciytla uauvon(0alxnxo3ty1laD livo ( trurxr no1lm emfvtl()srumurono1tleoiictasfm em(mpnt4 etoifcoatoaDr i i;t) 2trxopny1omenmieia()srua(  no4apt  ociad s ranvo;(4 ltnirciadlmDeaneo s  rtmxrpoy1lp elfei t)srra(mp;o4alx mictytfaDumu onu)tlermf3tatoa  aieilt) exmimpoy1opt  fes ()aDrmxroot0apt  ociadls2ul(mo;t)altnmr oatomDrlu olt) rtoxo3no1lpt mfetls srumu pnu0tptnmoctldlm eln o;u4aexomo3totfm raivsls) etmiopoudome mietltf rumxmpou0olxnif3ild a2rm( s ()tlenmo3oy1lp  livsls0truoim oy4llte fvs s a2tru  ;u0oleomf3iat aDum( o;t0trxoio3tadfptraueol( t2to(o3ny4ll n iesat  Drrxrpnu4tpt  i3iad a2rln s t0teerxo3ty1faDelu i;s0srtm(r oo1llt mici tfaDurx ont1tlxomictytlmDua(vs (0altrxociadop eln slt srtrxr oo1lpenlicil( a2umx ooo1tpxnii3tys s2rauvp;(4 lxrxr3ta1laDeaivilt srtm(o iudlmtelicslt a2raxmooo4tpxnmietyd a el( s u0arxoioctatla e nvo t  ruo(m3no1aptn fvils) Dtrxr ou1apeo i3ias s em(vo t4trerioctodopDrlues;(0t2uo(r3iu4amtemiesasf ruax  ;o4apeomfeiad m elu o;u)aexnxo3iatla rauvols0 euoxrpnydlleemneta() 2rrxmoot0oeeniictyt a uauvp;u4tlxomf oo1lateauvsls)setrxm oudap  livsatf 2trxr nu0tpxniociadfmDemu s ()teerxo3ootla  anvs;t  etmirpou1ol   fvi s) rumx ont4tlt  fcilsfs2eluvpnt0 exnxr oytfaD anvslt sexr(m3oy1ope mnvs t  Dtr( pou4aexnmfciytlaDea(vp () ltomr3ootopt aues t) eur(r3nudlpe mies t)sDraumoou1tlx mfeiytfm rln o ()tetomf3oadfm rli s t0t2trxo3no1omeemfet s arta( o;o1opxo fctadfaDrmumo u)arenmo oatfmt lu o;(0trxmxmpio1op elnvtat aDuaxm ou0olxo oeias s2ua( s u0teeoir iydom r nes (0s2umxm3io4am emnvtl(  Dtaxr oo4tlx mfcilsfs2rau sn()trtrio iydfm rln s t) ruoio oo4omtemnet t a2tm(r ;o4tltn o3tldlsDumn o u) rtriocoydoa ean s t s2uoim3oy1amenliciasfsrtm(r ot0olt  fetaslsDelu s u0 etrmr ta1faDe uvi;(0 2um(r nydape mfcsatf 2tax  nu0oeto oeiatfs2uau snt)tlxrxf3iodfm   u o;t)trtr(m3iydol nlivsltf 2rmx  ;t1oexn i3iys mDrluvs t0tetoxr3oadfpDelueo t)trtrxm ou4lpe lncsl(fartru ooo1tptn ocils m ran snt0tltrmf iadfmDeauvs;t t2xmxo ny1olee ncia(fs2ur(rpou1oetomo3tydfa2umuvp u0 rxoxf3tatlm   ueols0t2trio3io1lptemnetl(  2rrxmpot4aexo fetytls eauvont0altnio oydlptrai i;t0 rtrxr oydoptn nvsa(  2ra(rpnt0ope  feias mDelumon(4aetnxr3iatlp e ivslt  rur(m io4omt  ieslt)sDtmxr no1opeoifcilsfm2um( s;u)tlerxr oatfmDeauvi t tetoxm nu1lle lfctat)a2raur ot4tpt ifetatlm ua( o ()trenio tydlm  lnvilt) rxr(r oudoptnlfvslt)sDuaxmpnu0oltomo3iatfs2rlnmo (4tleomocoadlptelu s;t)s2xo(r ou1lmte fes t  rta( ono0tlxo fciatlm um( s;(0 etoif ia1fpDr uvolt s2tm(m3nu1lpt mnet () 2raxmo;t4alto f3iyd sDuanvo (0texrxf iodfptr ies;s) exm(m3oo4lptelfeta( sDrrxm nu4tlxoifciyt aDrmuvp;(4aeermfctadoa rliei;t0s2uoxo oy4aleemnvi (f rrrur oo0oeeoii3tatfm2rauvs;t)texoxfctodfaDraies s)s2toxo oydapt mnei ( a2trumpnt0tlt mfeilt m2uan o;u) rtrxo tadfpt aueo s srum(opiodapenmivslt  Drrurpot1olt  fciadlm2elu pn() eeoir3oadopD livs;s) rum(r iu4lpeemieil()srrax  ot0tpxomieildfsDrl(mo ()aetnmf3totfat lnvi t0t2xmir ou4ome lieslt srurumpnu4oetoifetydlsDemuvpnu4 exrmf ty1oa raivil()texmiopou1llt livsl(  Dtmx  ot1tlxnmieiadlaDra( o (0 eeoir3oy1fa  lneo t t2xmio3oo1ole  feilsfa2rrxro;o4oltnmf3tlslmDrmump;(4tlxrmr3oy1lm  au s;s)trxo(m3ny1ll  mictat) Drrumpoo0tlxomfeiydfaDrmn o;()aetoir oo1lat  ivslt trtmxr nydope  ics t)aDtmumoou4tlxnmf3ias mDuan p (0arxoio3oa1la e i i s trtm(o ou1am n fct s aDtrum nu4olenifeild s rl( sn()alenif3iadlp r iei;t) rurio3ou1omenmicta( arrmxmp;t4aeto fctltfm2rl(mp u0alxnmf3oodlm r ivo;()tetm(mpiu1omeelncias)sDrrx pou4tpt mf3iytfs elnmo t0trxnif3to1opDr i o;( s2triopoo4al e nvils  2umxmo;u0oltomfciadfm emu s t0trtomo iatfpDe uvs t0t2ur(mpnudomtelfeta(fa2uaxmpnu1tltoiociysfsDrmn s u)tltomfcootom e i ilt) rxo(o iodlp nliet t  2uru  oo0tee iociatlmDrmuvp;u4 exrmf io1op elneolt) 2trim3io4lmeelics s srurumoou0tlxoiieilsfa2ulu s ()aetrmocoadlptr n ols0 2tm(rpny4opeelfeil(fs2taxm ou0olxoii3ildlmDum( p () renxo3iatlmDrlues (  rtoio3ny1om emiet (fs2trum no0tleoiictltls2uauvo u)aetoxr3iydfa eanvs () rurim3iydame  iesasf rtrxr no0aptoiociyt aDuanmon(0 lerirctadoa raneo (0s2trxrpio4omt  ivil() Dumur no4teeoifctat m rl(vo u)aexomfcta1fptrlnes;(  rumxr nudoptemncs t a2rrxmp;o1texomociytlsDraump;u0texnmfcoa1fatrluvo s texr(o3oodoltelietlt a2ur( poo0oexoif3tadlm2ua(vs t)artoxocoadfpt livols  eum(mpnydamee fcs t a2tax o;t4teto icildls rmn s u0trxrmo oa1omtrai o;(0trumxo ou4ol   ictat) 2ua(m nu1texomfeiydla2ul(mo;u)arxoxo iatoaD aneo t trtrxopnudomt  nvi t srtr(m nu4apxn o3ilt s2um(ms (4texomf3ia1la e nvi (0srxoxmpnodopeemiei (faDtm(ro;u1apxnmieildls2ulu p;()trtrmfcty1fa rlueo (0 etoxm io4ope  ieil()aruauro;o0olt  f3tld mDrmnmo;t)tlenifctotlptr i ol()srtm(rpiu4omeelieiasfsDtmxroot0texnmoeilt a2umuvonu0aetrxr iadlptr n o s)s2urxrpio4lmt liesat)artr( p;o0aet ii3iltfsDumnmpnt4aexoxf todfpDr nvs s t2tmir no4lpt licsltfs2ur( pot1texnmoetatfm2em(vont)aexrmr tatom eauei ( setm(opny1om  lncias s2uaurpou4oeeomieilt s2rln p;u)aexnxfcootfa  lueols0 rumxm no1optnliesa()s2umxmpnu1aet  f3iadfm2ea( s u)trenio3ootfp   u sl()teurirpoo1lm e ncia(fs2rm(mpnu4oex io3iyd s2em(mpnu4aexrmo io1fptelu s;t0srtrxm3oodapenlfes s)srtmu ooo4tpeoii3ils s2ra(vo t)arxrif oodomtrlivslt0 exoir3iudlmt  fet tfsDta(root1apxnii3iys m2emuvo () eenmr3iydfaDraieolt0texr(opiydam nmneils sDtmum ;u1tpxniiciyt a rl(vo;t4texrif3oo1faDe u o;() 2tr(mpiudapeelfct ()arraxr ;u4texn f3iys sDea( p u)arxnmo to1lm  li sls)teto(rpnu4amt miciatf 2trxmo;t1tpx miciat s2uan p t)alenxr3totopD aneo (0 euo(rpno1aptnmics t)srrm(mpot0alxnif3ilsls2elu o u)aexnmo3oatlpDeanesl()trtrio3iu1olee nei t sDrm( poo0teen f3tasfa rm(ms u0tltnxr3todoa eln o;( trtrxrpiy1lptelieia( aDumuro;t4opxnii3iadfm uln p;t0artoio io1op elivs t0texoim oudol nlivi s) Duru  ;t0aeeoif3iytls rlnvsnu)aleoxo3to1fa e i olt) 2tr(o3ou4ll  miciat  rrmxm ot1aee ioctas mDelnvp;(4arenmfcoatfat anvil()tetr(r iu4lpen fct s) rtau  ;u0alx mfctaslm elumo;u) rermr3iodlmtean ols truoiopiydalenmnesat srra(  ou1opeoioeiltla2raumsnt)artnmo oo1fm elu s;s0s2uoxm3ou1lp elfcsls) ruax pno4teeomf3iaslaDul(ms;(0arxnxr3todfmtelneol( truo(mpiydlltn netas) Drr(  ot1aee iieiatls2um( pnu) ltrmo oytfp ranvo;t srxmxrpnudapeelnvt tfarua(rpnt4aexnifcild sDran pn()arermr3tydfmDe neo;t  2trxmpoy1lltemnes s) rua(rpoo1oeeoiociysls ulumpn(4altnmo io1faDeau i s)teumxopnodamtemfvt s arrr(mono0olxn o3tadfa2ran s u4 rxrmf iotom  aneo (0tetrxo3nu1ole lnvt t)sDtrur nu4oet io3tltfa2rlnvp u) exoxfciy1opDr nvo;()t2umxopoodoleemiviltfa2uax  ;u0tpeo fctadlaDraump;t0 renxociy1lmDrlivo s  rxm(rpoy1ap   ivil(  Dtm(m nt1alxnif3ilt m ua( ont)aeeomociy1oa   iei s0 2uo(mpnu4ll elivsl()arraxroot0tpxo ocildla el(ms ()trxrmo3iydom eliei ()seuoiopiu1optnmnciat aDum(rpnu4ale  ictatfa2em(ms;(0trtrmo3iytoa eanvsls0t2urio oudap elnvsa()sDrmurpnu0tpe iociyslm umn o;u4 etomo3oydlmte uvsl(0texm(r oy4al  lnei s  Dum(m ;t1tpxnif3tasla rl(ms u4 rerircootfa eaivi (0trxrim iy1altnmies t)a2urxroou0apxnmo3iadfmDuan p t0artnxo3oodfmD  iei t teumxr3iudol   iviat s2rru pnu4apenio3tydfmDem(mp u4tetoxf oa1op r ivo;t  rtoim oo1lmt mivs tfaDtmur ;t4apxo i3iyt s raumo;u0 exrmo oodlp elnvilt0sruoxopiy1lle  nes t arrr(mpnu0olto ieiytfmDeaumsnu) lenmociotomD anesl(0 euoxr oo1ope mfcta()aDrr(mp;u1tle mociatlmDra(vp (0 rtoxr oytlmDeaueo t)s2xmxm3nydole mfvsls)sDrmurpot1ole mocias a ul(vp (4treoio3iatla rlnvi s)s2um(m3oo4altnlfviltfs2raxrp;t1optomi3tatfaDrl(mpnu4alxrio3iatfa elies (  2tmxr iu4om  mfesasfaDra(  oo0teeo oeiysfm rmu sn(4alenif3io1omte u s s0texo(m oy4om nlfvtls aDua( pnu1tpeomfcildlm emnvo ()artrxr totla rai i s) 2tmiopiy4opte neils  2raxr nt1olx  ieils m rm( o;(4areoio3iy1laD ai s (  rxrxmpoy4op   icilt)aDtmu pot1oee ifctasfm um( pnt4treomo ia1lpt au s;t)t2tmim io4al nlnctasf Drrx  oo0ape  iciydfsDea( o;u0tetrxf iatfatr nvsls texmxm nu4ope mfvtat sDrmxmono1tpenmoeiat s uauvpn(0tltoiocta1lpt li sl(  rxm(o io1lm n iesa(  2raum ou0oeen ieiydfm rl(mp;t0alxnio tatlm e i ils)setoxr ny4ap  lnctlsfs2ta(rpno4olxomfeiat aDumu p u0arenmrcootopteauvi (0 rxmio3io1lmtnmfvs s a2tm(r ;t0alxoiociat m el( s t0 reoxrcoodomD  nvolt)s2uoxopiy1openlnvsas  Drr(r no1tlenii3tyd a emnmo u0texoir3oadfmtrlu o;s) ruo(mpiudlpt livt tfsrtr(  ;u1tlt mociltls2ea(mp;(0teermr3oa1lmD  neslt0t2toxo iy4om n nctas  rtmxrp;u0olt mf3iydls2uau s;()aleomo oodlm  liesls) rxm(m nu4ale lfvsat) 2rr(rpnt4ope ii3tad mDemnmont4 lxnmocio1lmDe nes;t) rurxr oodomen ieiasfaDtaxront1teen i3iyt m ra(ms u) rtoxfcoytopDeauei t  2xoio3oudop  mies s  rta( oot0aexomfeiad aDulumsnt)aeerxr tatomtraivo;s srurimpiy4ameemnvtasfa2rau  ou0tlto o3iyt a2ua(mo (4altoir tydlp   n olt s2uoir3oo4alen neiasfaruru pno1teeoio3iys sDra(mp t4aexomr iatfat li s s t2tmim oo4altelicias)srumurpot0tlt mfeildls2el(vpn(0 ltomrcoytfm e nvs t t2tm(o3ou4ol   fei t) 2rm(ro;o4tlx  i3iatlm raump t0aexnxf3tydlpD  i s;s  rxm(m no4lp emicia( srta(m nt0aee mi3tat mDrmnvp;t4tltrioctodla e nvilt)s2xm(r ny4altemieslt)artr(mono0opxomfeiasfa emn pn()texoxr totomDrai s;s0s2xmir ny4lp e ivta() 2tmum ;u4aex moeildlmDum( s u4 ltoir totlmt auvo s)t2trio3oudope mictltf Dtm( p;u0oet  ieiys m rmu o;(0tlxrmf3tydfa e uvsl()t2xmxrpnu4om   fvs t) 2tmxmo;u4alen i3iytfmDua(vp u)texnmr3iatoaD aneo;s  exm(rpiudaltelnvils aDtax p;o0aetn i3ildfm2emu o u4altnmr3oadopte nvi;s0 euoxmpoy1ap nlictasfartaxro;t4apen o3ilt a rln on() eenxo ia1omDe nvo s0teuoxo3ny4opeelfctlt)sDtru oou0tpenmi3iadfmDem(mp;(4artomfciatfpt aiei;s srtm(m io1aptelfeil(  2raumooo0aee mfeiltfaDranmp t0 renxf oy1fmtr uvo;(0tetoxm ny1llt mieta( a2rm( p;o0aex  o3tydfs ranvpnt4alerir tytopt livi;(0tetrirpiydlpen fcsl() rur(ro;u4tet ioeiasfm2ulumo;(4 exrmf3oy1oa r i il( s2xr(mpoo1ole  neilt  ruaumont1tpe  fctyd mDul(vp ()trenmo3oa1om  luvs;t0srum(o iu4ol  mfcsls)sDumx  ou4teto ieils m ea( o t) etrxr3ootomte n s s)t2xrir3oydam nlivsls srtm(mp;u1teen i3ildfa rau s t) ltnmr oa1oa eanes;s)srxm(mpiy1ope mnct () rrrxmp;t1oeeomoeiltla2rln p;t4 eermr oy1lpDeai s;(0 2xrir oo1om eliciasfaDta(m nt0ope mictlslm2ua( on(4 lermo ia1fptrlnvolt0trxrxo iy1ol nlfct ()srrr(mp;t0aex iiciysls2uluvonu) rtnmrcoa1oateaivi;(0t2xoir io4lmen fetasf 2rax pnu1tetn ietldls2rm(vs ()aexnmr totfp e u o t0 exm(rpnudame  feiat) Dtmx  oo4oexo fctytlaDrau s (0 rtoxo3oy1la rli o (0 rtm(m3io1amenlncta() Drrxmp;t0opt io3iydfaDea( snu0alerxocty1optrlu ilt0teumio3nu1amee ivt (  rtaum ou4aee iieild s rlu pn()trxoir3ta1la  auvs;s0t2xrxo3oo1olt mics (fsrra(r oo4olenmi3ilsla ea(vs;u)tltrio iydopDeanvi;s t2uo(m no4lptnmnciltf rua(m nt0teen octadfs rmn snt0 reoifcoodomDr n i;t)sexmiopnodape  fvsl( s2tr(m oo4opt  f3ils mDraumont0teenmo3iy1oaD ai s ( srtm(rpoy1ol nlfctl() Drm( ooo1teto iciyd aDeanvpnu) lermo3totomt anvols seum(o3nodaleelfcs s arrmu pnt0alxn iciys mDuaumsn()aetnmocoytlm  lu o (0srur(opiydlm elfct (f Draumooo4tltomo3tldfm2eanmp;()aexrio3iatop r i o;t)trxmir oo4lpe mncta( s2rrurono1olxnifeiadfaDumn s (4artoxo3ia1fmteliei;t0srxo(o3nu4lpen ncsatfarrrumpot1ape io3tlslmDuauvsnu)tltrmr ta1lptrlivils0seur(opio4llte ncilsf rtm(roou1ope iociltls2elnmpn(4altrmf tytoaDrlu s t) 2uoxm3iu1olt lfetlt  rrrumpno4alx  ocildlaDrm( snt0artoiocta1fp r u o;s0s2tm(m3iodal n nes ( sDrm( oot1alxn i3ildfs2raumonu)tleoio ty1fmDeaues t setr(opnu4al  lnvil()sruaurpou0aeeniocils m ran o u4 exrir io1lmD  ues;(0 rxmxr iy1omenlieta( aDrmxmpnt0alto oetad s uln p u0 etoxr3oy1fat lnvi t) eur(rpny1lltn nvsa(f 2tmxr ot0aetomociydfaDul( on(4artnio3tydfmDrlieo s0srxrxm iu1op emfvs tfa2ra( o;o4tetoifciydfs2ra(vont)trtnxociotlmD lnvo;t  rxmxo oo1alt  ncilt srtrur no4aeenifetytfm emu pnt)alxomf3iy1fmDrlnvi;()trumim3iodlm emfvs sfsDrrx  ;u0oexnifcild s2rln snu0altomocoy1la rau ol(  2tmxr io1amee nci s) rumx ooo1tlt mfeiatfmDrlnvs;t4 rxrir3oy1omtran i (0srum(mpno1op emnct t)artr(mp;o0oexn oeils s umnmpnu4aetomo to1fpD ai s;s s2xm(m3io4ol nlnci s aDua(r ;o4tpxomieildfsDum( snu) rermfcty1lateln ols0teuo(m oodlp nmfvilsfaDuaxront4tltoioeiadls ulu s;(4 exoircia1opDe i i;s0 rxrimpny4ap n fviat) 2ur(  nt1aetomoetasfaDulnmon(0tlxrifciotfmDraivo;t srumirpiu4lmtnlicta( srrrumoot1opxo oeildfmDua(vp;t)alxrmr3oatop  auei;s0trxrxopoy4alen fcilt)sDraump;o4tlenmi3iadlm2uaumont) etoxr3oo1opD aieols)t2xr(m io4ap  miei t arrax ono4ape if3ilsla2rlnmo (4arenmo3oytfm e nvo;( srtrim3iu4llen iesls) Drmxmp;u1ape mfciat a2ul(vs;t) lerxociatlpD livi;s)t2umxm nu1am  lfei tfsDtr(  oo1aptnif3iytlsDemnms u)alxrir3oadomD lneo;s)trxrirpoo4oleemfeilsf Drrxmoou4oetnii3tldfm rm(mo t0tleoio ta1fa rluesls  euo(rpno1lp elncsa()aDumu  oo1opt mfetas s2rl(monu0tetrirciodlm  lnvslt texrir3ny4lp e nesl( artmx  oo0texoifeiysls umu s;t4 etrifcta1oatrlueo;t)srxrxm3ou4lm e nct s artrxr ou0texnif3iat a rm( p;(4 eermrcootfmt aneilt  2uoxo3ny4ale  iei ( aDta(ronu4tpxo fetltls2rlu p;u0 lerio oydomt luvi;t)s2to(o3oydlme  fetl( s2trur nu0aetnii3tasfsDem( s;(4tltniocia1opDrlivs;s0srumirpou4opeelnetat)s2umxmooo0olenio3tlslm2uan ont0aetoxo ootfa rluvi (0s2um(opnudalte ietl(fartau pnt1tex  ociadfs2rau o;() lxoxr3oo1fa eli slt trtoxrpou4al e iesltfsruaxmpoo0ape moeias a ea(vp (4aetnmf3oy1fmtranes;()trur(o3ny4ol e ivt s) Dtrurp;t4tltnmfeiysls umu p t) rxrmf tatlpteai i;()seurir io1amtemnci (f Drrxr ;u4aptniociaslaDelumsnu)trtomf3oodfp  li i;s0 2toio3oy4am emivt t aruaxrpnu4aetnifetatfa eauvo (0texnxocta1omt anvi s0 exrim3oydal emici (fsDurx  oo4aee  o3iydlm2rmn ont0trtrifcta1lpDe ivi s) euo(r iy1ope  fcslt)a2rmurooo4oex  f3iydla rmn s;t4aeenmociy1fmtr nvs;()s2ur(rpiy1al  lnciat)aruau  ;u4tleomfciytfs2ea(vont4tleomoctytoaDeaies;s)s2uoio3ny4al elneils srtr(r ;u1tpenifeilsfm2elnvpnu4alxnxo ia1fm eln s s)srum(opio4lm elnvsas)aDuax oot4texnmfcilslm emuvo u4 rtnxf iydomDrau s s) rxm(opno1ole  nvt t)sDtr( o;t4oeto ietlsla2elu o;(4aeenio3totfate nei (  etm(r3ou1omt lneilt aDtmx onu0opeoio3tydlmDuanvs u4arerxocta1lmD livolt0t2umirpoo1ale mfvi ( a2rrxront1teenioeiat sDrm(mp t4 ltomf oy1omDeluvi (0teuoio oy1om nlnetas)arur(mpnt0tpxo ieiadlaDra( pnt)arxrircta1op  lieo t sexo(m nu4om nmfei ( sDum( ont0texnmfeiysfa2um(vo;()tleoio3iatlmDraieo s)s2tm(mpoodope mncslt)artax  ;o0ope  i3tat s2ul(msnu0tlxrio3totfmt ln il( truoxmpou1lpeemncsat) Dur(moou0aee moeiydfa2ua(vsn(4 rxoir oatfmteauvi;( s2tr(m3ou1ap   iet ( artm(r nu0texoifctadla uluvo t4 lxoir oadlateaueo s)sexmxr iy1alenmfeilt)s2ra(m ou4tle ifeiysfaDul(vs (0 leoifcty1fp e u s;s0srtr(rpoudapt lfes s artmurono4olt mfctls aDumu snt) exnmrctadopteaueslt seto(o3io1ol n icsa(f rtaumpoo1tpxoioctadfsDrlnms (0 lenmf iotomDr neols0 etoir3ny1aptn fvsas s2raxroou4oeeomfeiydlaDul(mo u)altrirciotfa raivo t  exr(m oo4om n fvtltfsrtruronu0apt  f3ilsfm2uauvs u0 lxrmr3oy1lpDrai o;t) 2trxm3no4ll nmncsat a2trur ;o4tlx iieildlm rmu p;u4aeermf iytfa eln o t  etr(rpnu4om   netls  Drru  no0oeenmfciyt s el(vs u4trenmo iytlp  ln o;s trto(o oo4lltnmnvil(faDtmur nu4oltnio3iysfa rlnmon(4 rerircty1fpt  nvslt)s2xm(m iy1alteliesasf Dumxm oo0tlt  f3tlsfa2um(vo;t4texoir3iytoa elivs;s srtoxmpiu4ll  mfes t aDrmu onu0oltoiieilt m2ranms;u4tetomocta1fpt lieils  2ur(m3oy4omenlnes tfs2trur ;t1tpx  feiltfs2ra( p u)aetnmr tatlp r nvs;s) etrio3oy4ol   ieils)arrm(rpnt1aptomictlt s2ulnvon(4arerif3iadoaDrlu sls)trxmxr iudapt  ietat s2tm(root1olto oetld s2ulnmp u4tlermo oy1lat  ivilt0 rxmirpoy4ap  mfvsasfartr(roou1alen ociydlm2ra(von(0tlxrmo oa1lpt  nvo;s0sexm(r3iy4omtn fesl() rumump;o0aptomfciadfs uau sn(4 lermfcta1fpt ln s;s s2umimpnu1lme  fcil( aruaumpou0alxnii3tatla2ra(vont4 exrmocoy1lpDeaieo;() 2urim3iy1alen neiltfa2um(r ;o0oee iictltls2ul(vo t)tleoxf3tytla eau s ( srxrimpiy4lme lnct (f rrrxmooo1oexnmiciaslm um(vont)altrif3todfaDeln s;s) rtoxr oo1alt  nvtas aDurxr no4alenifetytla ranmpnu0 rxnircoy1lp   n il()seuoio oy4omt mnct s a2rmuroot4aexo fciatls2eln s;t4 ltoxo iatlm e u ol( seumim nu4llt lnvilt)s2umxmpnu0opx mociasfa ea(mon(4trxomrctydop rlu sls) 2trio iudopt  fctatfs2trxmpno0aex mociasfa2rluvp t) rxoxfcoadomDeanvi;(  2toxmpiy4amenmfvtas)s2rrumpoo4tpe  ictat s ean pnt0alenifciytlaDrlnesls t2urir oo1omte ieias)aDuaxmoou4olx mi3iyd m2eln s (4 exrmr to1optraneols)setm(rpiy1lm  lncsasfartax  ot0oex ifctat m rmums;u0 etrxocoydfm rli s ()sexrirpou4apenlfvs t)s2tm(rpno1tee mfcild m uauvon(0 eenif oadla r n s;t0trtm(o io4omenlivtls)srurx pno4tet  f3tyd a ra(msnu4artnxf ty1omtrlnei;()s2xrimpiodlptn fcsas aDuaumpou1aee miciatlaDelnvp;() eenir3oodlmDeln s;t)teuoxr3oodopt lieta()aDraxro;u1tleo fciatfaDemnvon(4areomrcty1op r uvs;t tetoxr oy1lltnmnesasf rraurp;o4altn ocias m2rl(mo;(0aetrxociatopt  nvs;s0sexm(o3nu1lpe  ietl(f 2rau  ;t4opx  o3tat m eanvs;t0texnxrcta1fm elneo s0t2xrir3io4olenmfcs s)aDurxmont4texoiieiltla2ul(vo t0alenifcoodoateli o;s0 rtrxm3oo1op  liviatf rta( onu0apxnmi3iltlm el( ont4 rtrmocootlmDean s s)srurxrpoudlp elfct s s2tmxrpnt4teto f3iydfm uauvp;()altnxfcoodfp  an i;(0 2xoxm3iodap nlivsas a2tmu  nu4oltn f3ildfm eln o;t0arxrir oy1fa   uvil()setoio ny1ame mies (faDrmumo;u4tlxo o3tasls umu p;(4 etrir iodopDeanes;s)sexo
\ No newline at end of file
@@ -0,0 +1 @@
+nvs (0 2uoxrpio4lmtnmictat srur(moot1tex mfetyd s rl( snt4 rxrxo3iadoaDr i o (  exm(o iodol nlfcsat a2ua( onu4alx iictlt s ul(vs;(4tltnif3oytoa  an s t0 exoxopio4al e nei t) 2rrx o;u4oex io3iasfa umumpnu0aeeomo iatfmDe n o;s) rtoir3nudal nmnes s srtrum ou0oetn ociysfs el( s;u0teermfcta1fmt aies;t0srxriopoudamte neilt artaum ot4tltomocias sDrl( pnu0aexnmoctadopD auvi t sexrio3io1ome lfcils aDtr(r nu1tlxomictyt sDeanvs (4 eerxr oytfmDr neo;(0srxmir3iu1lmenlivi t sDurxro;t4tltnmfctyslsDem(vs;(0 rtomf oydoa  au i ( setmxrpiy1al e nei (f 2tau pot0apxn oeiysla2ul(mpn(4aexnxo3ootoa e n ils s2uoiopoo1ole mivia(  2ra(  ou4tlxoioeiytlaDeauvs t)aexrxrcoodomDe neo (0s2ur(m3iu1optemfctls srururpoo1alxnioctadfaDeaumsnt)arxrir iytop   ueilt  rtoim3iy1apenmncil(fsDrmur ot1olt ioetldlaDulnvsnu0 ltomr3ootomtrlu olt t2urim io1ape lnvt s  Drrxmpnt1aptniictaslsDum(mpn() lenxf oytlpDraneol()tetr(m io4alen icslt)srtmu o;u4tee io3tys a2ul(vpn()tltrmocia1faD  u s;s t2xr(r3ny1optn iei t)srtrumpno1oeeniietysla2ua( p (4arenmo tadfmtran ilt0seuoio3nu1amen ivil( s2ua( o;o1tpt  i3tydlsDemu s (0tlenif tydfpt lu o s0 2uo(r iudlmt miciatf Dua(  nu1aptnmfctys aDumumpnu) lenmr3oy1opD  uvo s) 2uoio oo1apt mnvs (f Dra(r ;u0oetniiciyt mDeluvo;t4alermr3tadla  luvi;t)t2to(o3nudllte nvtl() rrr(rono4opeo icild aDul(mo (0 rtnir3iatop r ieolt0t2xo(opoydlp   nvt sfaruaum ;t4oexnmicils aDuanms t4alerirctytlmtr nvo t0s2umirpiodlme mietlt) rurxr nt4optniociadfmDrm(ms u0aeeoif3tydlp eli o;s0t2tr(o oodalenmivsl() Dta(r ot4tle iociyd aDem(vsn(4 renxrciatfpD  ies;(  2xrirpiy1altelnvtl(fa2urx  ;t0openmociasfsDean p;() ltrmrciydfpDeaues s) exr(r3nu1lpte ivt t)aruaxr no1texnifctas m2umnvpnt4tetrifcia1oatraivi t) 2trir3ou1olt  icsl(  rrrx p;u4tpxomfetyt sDeln o;u0altrmr tatfm   ieol() rxm(r3iudll   fes t)arrmu  no1oltniieiysfm uan ont)teermr ta1om r ieo s)srtmirpny1ll nlfvt ( artaum ;o0olxn ictatfsDem( onu0alxrmo3ta1lm raueo;(0 rxoxo3nodlle lnviltfsrur( pou4tle mfetysfa rl(ms;u0 rtoif tytlm e n o (0trxr(o iydamtemfetlt) Drmu  nt4oex io3tldls ranmo u4treoir3iotopDrai i;t  rxr(mpoudom  mneiatfa2tmurpnt4aetn i3iad a ranvp (0tlerio todlatr ueo s)trxm(m3ny1optnlncia()srumxrpou1tpx  fciyd m2rmnvpnu)teeoifctotfaDr u sls)t2umxo io1ap  mfetl()aDtmumont4opxnio3iatfa2eaumpn(0 leoifctydomte uvsls  2xm(mpiydomee net t)sDum( poo0tpxnif3iadls el(mp;(4tetnxr3iy1fat  u olt  2urxr iy4amtn ivsa() 2rrx  no4olx moetydfa2elu p;u0trermrcto1lp e neols) 2urxr iy1amenmiet s)sDuaxm nu4aeenii3iaslaDrlnvp u4alerxr iodop  au ilt0trxmxr3oy4ole mncils) rrmum oo1aleo fetltls2ulu p;t0aleoxf3iatomtr u o t0 2trimpnydlp   icilt a2taurpou1ope iieilt a2um(mpnt0 rxoirciytfmtrlivils0setrxo oy4lpt  nct tf rtm(  ;u4oeeo fciytfm2ul(vp;u4 eerio3iodlaDeau s (0t2xo(o ny4op   iei (fsrurxro;o4opt ioeiydls ean s u4 etnircty1laD anvs s)seuo(rpiu1omte icsls  rum( p;o0oexo ietat mDrluvp;(4aetnif3oa1lpDrai o;t teto(m3oodllee nvilt arrm( pnt1tpeo f3iasfm2rl(vp t0 leoxf iytomtrln ils)teumimpoy4lltnlfei t) 2rm( o;t0texo ietat aDrmumo (0alxrircoydomDe ieolt0 rurxrpoo1ome mfet s a2ra(ront1apen f3iytfs2emnvs;(4tltnio3ty1omt aies;t)s2xoxo3iydameelieta( sDtrxm no1ope  oetlt m emnvpnt0 rxrir oodop rlnei;s0 rxrimpoudop e ncsls)aDrm(ronu0altomoeiydlm rmn onu)arxnxo ta1fp  an s;()t2xo(m oudapt lneilt) 2tmx oot1tpen oeiatfs2ul( p u) rxnmrcoa1fa rlnvsls  2xrxopno1llt  fvilt)sDta( pnu4tlt ii3iys s rmuvp;(0alenmfciydlaDraivi t) 2um(r3iu4llt lfvilsf 2urxrpnt1aleo fctat m ulnvo;(4 rxnmo tydlptrluei ()setoxo3iodamee nctat) 2tmu  ;t0ape iicildlsDrm( s;(4alermrctytlmD luvi t0 2xoim iydal emnesa()srtr(monu1oeenmfeiyslmDeanmp;u0tltnmo3iatomDrlivi ()trum(opoo4amtemfeiasfsrumumo;u0olxn iciat s2em( pnu)tltomo3io1fa  anes;t  exm(m ny1om  lfvs (fsDrax  oo0aptnifeiyslm2rmn onu0aeeoio3iydfmtr nvils0 rumim iy1lm   nvta(fs2um(  ;u4tpxo fctlsfsDrau s;()alenxo3iy1fmt auvo;(0s2xr(m3io1om  liei ( srrmxrpoo1aetn ociasfaDeauvpnu4aetoxr3ia1oat  i s;t  rtm(rpio1amen fctls)sDtmxrpno0tpenmi3tytlm elu sn()tlenmr tadomDrluvs;(  rxrxr3ou4lptemivt s)s2rax pou0aptnmi3ildlsDean p t0arerircto1oat  iei s)s2uoxm3no4ll nlnetl( s2uaurpnt4olx  i3iyd mDea( o ()alermfctadlateaieslt0t2uoxrpno4opte nvilt)sDur(  ;u1opto f3ilsla2ra(vp;(4trtomo iatfm r i s;()texrxm ou1apt  nvtas)aruaxrpno1apt ifeiydls uaumpnt0arermfcoatfm e ueols  rumir3oudal  lfciasfsDtmu p;u4opeoifetadfa uaums;t4alxnmr3iotfate ivolt) rurim iydalt mnvil(fsDraur nt4opeoif3ildlsDranvp;(0areoxfctadomt lnvol(  rtrio3iodom   fesls)a2umx poo4olt ii3tyt m2eanmo u4trxoio oytoaDelnei t trxoim ny4omtn nei tf Duaumono0tleoii3tlsfm ea(msnt) exnio3oadlatrlnes s)srtm(o3iydom e ivt (fs2umxrp;t4oltn ictydlsDum(ms;u)aeermfciadfpD liei s srtrir oy4amtnmnet s) 2umx ooo0aleomi3ilslaDrauvont0 rtniocto1lp rlnei t0texrxopiudomtn ivslt)sDtrur nu0tltoiietytlsDeauvsnt)tetnmo tydlatelu ilt tetm(mpny4lmeemfei ( artm(mono4opt  fciltfm2rlu o;u4aleoif3io1latrlueil(0trxrxmpnydolte fet t a2um(  ot1tptomfctys a elu s;(4 rtnmo oadla   u sl()s2umir iy1aleemicta( a2ta(  nu4olxoioetad mDem(ms (4 lxoxrciydoaDelieilt)teurxopiy4omeelncils sDtm(rpnt4tlx  o3iys sDua(mp;t0 lxrmociodlp elueo;s0 euo(r3nodllenmictls  Duax poo0olxomictlt aDuluvo (4alerioctydfat auvils)s2xm(m3oydol emfcsa( s2rmu pou1teen i3iad m2rln s u4 reoio iatlmt lieo () etm(r oudlm nlfei ( sDrmx pou1ole mi3iytlm2raums t4tlerxocoytla   neols  etm(rpoy1llt lnvi t)a2taxrooo0oeeoiociat sDemnmpn() ltoircoy1fatelnei;t0 exoir3iu1lptemiet t aruaum nu1tet  oeiltlmDuaumo;t)aleoir oadla e ivs;s)s2um(m iu4ale mfvi s)srtr( o;t1tlxoio3iadls2elu on() etnxo3oa1la eaivol(0texmxm3iodope lici tf Dua(roou4apxo feiyt s ua(ms ()aeerxfcoodfaD  n i;( texrir oy4lleelnet tf 2tmx pnt4oexn fctldfmDul(vsnu4 rxnxf iy1lpDr ues;t texo(o3oydame mnvs sfa2rrur ot0altoiiciatls ean s u4aetrxr3oo1lmt  nvs t) rxrir3no1ap  mivt tfsrtmxro;t0apxn iciatlm elnmsn()alxrifctadoaDelies;t  eumim3iu1opee iet sfsrtrxr nu0aetomfetys sDeauvo u)trermr3iadfmDr ivilt sexr(o iudalt mivsat)sDra(  oo0aetniietyd s umump;(0 exnif3totop eanvo;s) eto(r nodll   feilt) Dtrxmpoo4tlt ioeiltfsDumnvsnt0 reoir iatom e u slt)t2tmxopnydam  mnei (farum(rp;u4aexo i3tlsla2ua(monu)tlxoircoy1fm r nvsl( truriopoy4lmtnmietas a2tr(rpoo0aptnio3tatfaDrlumo t4texnxo ty1lpte i i;t t2umxmpoudll nlnvsatfaDrr(root0tpxomi3tadfaDumn p;u0 eeoxfciadoptrlivs s0texo(mpny1alenmnesa(faDrmxro;o4tpe mfciyt m2um( o;(4aeerxr3totfp e ieil( s2xr(o3no4ol emnciasfa2ta( o;u0teto fciyt aDrlump u)tlxomo3iy1lateaues;t)teuoxo3nu4lpe lfcsa( aDrmuro;o0oeeo ieiatlm rlnvp;(4 ltnio3totfm r ieolt0trxr(rpnodlmt lncsl() rrax  ot0altoiieiydfs rl(von(4 eenxfcoy1oa rlivo;t  2xo(rpny1lm  mivtlt aDur(r ;u0aleoifetlsla umums (4alxrxfctytfatr ivs s0s2xmim3no4ale lict t  2rmumpot4aleomociydls rl(ms;t0tltrio oadlpt aiei s tetoxrpoy4lm nmfei t)artaxr ;t0tptn f3iys s2rluvo;u0teenxf3totlpDean ols)teuoxrpnydop  mfvilt)sDur(m ;t4opxomoeiyd m2elnmpn(4aexnxf3oadoaDr ivs (  rtrio3iudoltelneiat a2tmu  ;u0altniieiydlsDrmuvpn(4texoio3oadfp e uei s  eurxm3ny4alt  iciat  rrr(mont0tlx ii3iasfaDelu on(0 renxo3oo1fa   ieo s)texm(rpio4opeemfei t sDrrurp;u4tlenifcilsfm rmu o t0 lxrifcoadla   ivo;s0texrxr3io1altnlfcs s) rurx  ;t1ale  o3iadfa rlu sn(4 ltnifctodlm rlneo s srxm(o nu4lptnlfvs t  Dtrxmo;u1tex  oeiys aDea(vp;(0arxrxociodfpD ln s s0 exoir iy1ape  nvilt)s2raxm nu4alxomoetyd aDrlnvp u4tlermocoadfpteanes;()sexmxm iydlpt mfcta()arum(m oo0tee mociatfm2rl(ms;u4 lerxf io1oatrlieo t)seuoxopoo4al e fesasfs2tm(mono1alx mf3ilslm2uauvp;() rtoxr oa1lm raueo (  exoxmpoo1am  lfctasf rrmumpou1tetnif3iyd m eaumsn(4tlenio3oa1oatr ivsl(  2uoiopou4altemies sfaDtau ono4apenmfeiydfaDrmn s;t4aleoir3oytlptr nes;()teuoiopno1olen iet t  Durx p;t1tlxomocild s emnms u4 rxoifcio1fatraivs s)seuo(opnydlm  mfvias) rua(mp;u4aexn iciyd m2rm(vp;t)arermrctytfmtrlieo s) rumir nodlleelneias) ruaxm nu0apenioeilt s2uluvo u)trtrxfctatfa  aneil( srumim3oydapt mnvilt)s2taxmono4olt ifeildlaDrlnvp u0teermr oadfpteluesls)trtoir oodalt lfeta(  Dtmumo;u0tpxomoeiadla rlnvp ()altoxfctadfaDraueo s t2xrim3no1omen iviltfa2urx o;u1tpeoio3ias a2ea(ms t0tltoio tadlmD ln ils trxoio3oo4ameemivta(f Duax  no0aexn feiys s2rm( p;u4tlermocta1lm eln o;s)srumxr io4lpte ivs s artau o;u4alxomocildlm ra(mo;t0tlerxr3iydlp   ivsls seumio3oy4lptelies s)srrrxmp;o4opeo i3ilsfaDua(vp (0tltoio3oatfpDe nvo () rxo(m oy4am nmfvsat  Draxrp;t4tee  i3ias mDrl(vo t4texrxr oo1fmteaivo;t s2umirpiu4apeemicsa(  Draxmont1ope  fciltls rm(vs;() lxoio3oa1om rluvo s)trtrxm3nu4om   netas sDumx  ou4oex mfciysfa eau pnt4alxoioctotopt  nei;t0trum(o iy4lptnmfcils sDtrur ;t0aee mi3ildfs el(mp;u) etnxf3iotlpt lnei s)srxoio iu4lmen neil(fsrum(  nt0oltoifciytla2ua( o;t4aleomo3tytfp eanes t)sexr(o oo4lpe mfvi ()sDuax  oo4tlenmo3iadfs2uanvs () rtnifctotfm  li o;(  exmxr3nu1ap n nvi (fsDumxro;u4alen f3iadlmDuanms u0alxnmf3ta1fateai i;t) exrxm3oodamt  fvtlt)aDumu ooo0alt  ieiytlsDumuvp;u4 lxrmo3iatfaDrauvi t)setrimpou4opeelnctlsf rur(ront0tptoiociysls2elnvs u0aleomfciodlpDrliei s)tetoxm nudlp elfeta( s2taumont4ape ii3ildfaDul(ms;t)trermociy1omDraivi s  ruoio3io1omtemfvia(fa2tr(m oo4oetn o3iydfmDrln s;u)tlxnif3totfa rai o s s2uoxo oo1lmt  iesl(fa2trxr ;u4apx mfctls m2umnvo t0 eeoif to1fa rai sl(0 2xm(m iu4lm e nvsa( sDua(m ou4opx ioetas m um( s;(0tetomf ty1lmD ai o;()seur(rpiu4lpe mnct s)s2rau pou4oet  i3iasfmDrm(ms (4aexrmr3iydfateauvo;s)trtmxm nodole mfctl()a2um(  nu0alenifeiadls2uanvo (4 lenircoatlaDelueols trumim3nu4omeelieta()aDrmumpot1tlxoifcilsls2emums u)artoxoctadlm elivil(0 2trxrpiodap  lfes ()sDumxrpno0tet moeiatfm umu p;u)aexomf3oatopD lu ols)setrxm oy1aptelnvsl(f rtaumont4opx mociad aDulnmo;(0 leoioctytlatran ol()sexrirpoo4lpt mietlsf 2tmx pnu4alx mi3iltls ea( onu4aetrmr3ootopteanvs (0 2xr(mpny1olenmneslt s2ururp;t1tetomoeildfs2uauvpnu4alenio to1fpDr n s;t0trxr(m3io4ll emfes t) rua( oou0aetnmoeilsfaDrluvo;t4alxoif totlmDrau i;t)tetmio iu1alenlnvil( a2tau  ;u4opto octad s eauvp;()arenmfcta1lp  aieo t0s2toxo ny1lpt lfvs ()sDtrum ;o4tleoioeiysfm ulu o;u4altnmr3oydlpD  i o;s srur(m3iodamenmicsa( aDrr(m nu4tlt  o3iatlmDrlnmo;()trerir ta1oa eaueils t2xmir3no1lp elfvslt)sruaxmo;t4texomo3iltlm emuvo t4 ltoxf3iadop  aivi;s srxr(o3oy4am nmfetatfarra(rp;u1apxoio3tys aDran o u)teerxf oa1fmte ieil() exo(r3iy1lpte fetasf Duaxrp;u0tleo fciad m2ea(ms;(0artoxrctotoatrliesls srurimpoy1lme lfeiat a2uaumo;t1opxnmo3iasfs uln s u) exoio iytoaDeau i;s0srto(r3ny1ol eliei t srtm( onu0opxnmieiatfm2rl(msnu) exnxo3ta1fpt au i (  euoir nu1lm emneias sDtm(roou0tlt io3iaslsDra(vs;u0aetoif3tadlpDrai sl() eto(o oudlme mncta(f rtmxmp;u4opeoioeildfa2uluvo;(4aeenxo ia1optr nei (  2umirpoo4am elfetasfs2ta( pno4tleniiciaslmDul(msnt) lxnxfcootoatelu i (0 exoio nudol elnvias)aDuaxmooo4apen oeiytfs2rluvsnu4arenif oo1la rlnvs (0trtoio3nu1apte ncil(fsDtrx ono4opxoifetytlsDeanvo t4trenxfcoo1fpt  ivi s0setrxr iodlltnmnvtl( a2rr(mpot1oex  o3iydlmDum(vo;t) lxoxo3iy1omteauvsls0 euoim3ny4lleelnci tf rtaump;o0alto oeilslsDea(von()arenxo3oatfmDeaivi s0 etrxm io1lme lfcsl( a2tm( ont1aexomf3iyt s2ra(vsn() exoif3ty1oaDraivs;s0 eur(r3ny1ap elneiat arta( ont0oee mieilslmDemnmp u0 rxnirciatfp rai i;(  rtm(rpoy4ameemictat) Dua(mp;u0optomfciltls rmn o t0 lenxr iatlaDr ueo;()seurim3iu4omenmfvsasfs2tmxr no1teenio3ildfsDemnmo () exnif tatfmtelu s;s0s2trxr oo4am e nvi s  rrrurooo1apt  oeildlm rmn pn(4artriocto1lat lieo;s  exm(rpoy1lm n fcsls)sDrm(rpnu4tlto ociadfaDeluvp u) renircoy1opDe i o;s)texrxopnudlpt  fcilt sDrau oou1olto ociltfmDemumsn()arxoio oy1omteaivo s) 2xr(opiodllt mfciat  2trx p;o0tet  feiyt mDraumpnu) rtnmfcoydlmtr uei;(0 ruoxmpno4altnlfvtasf rtmuro;u1tpeoii3taslsDemuvs u4aexnmr3oydom eauvi (0 exm(r3ou4lltnlfetlsfaDtaxr ot0tlto ieiasla elnvp;()aetoiocio1lptelnes s0 rtoio3no1opeemfvs (fa2tmumoou0olenifeiydlmDua( snt) eerifcoytfpt  i i;s0tetr(r oodal n nvtat s2rau  ou1tlt miciad a em(mp (4aeenmr3totopDeanvi;()setrim iu1lptemfetas sDtrxmo;o4oet ioeiadfa umnmp ()aeeoio3tydfateluvsl(0seumxo ny1olt  ictl( srum(rp;o4aptnmi3ildfm ra( snu4 reoif tatfa rauvs;t t2toxopnu1lpe mnvsl()srta(mp;t4apx  octas a2emnvo (4altomo to1laDr ies t)trtm(m3ny4ope licils  rtau o;u4aeeomoetatfsDul(msn(0alxoif3todlm  aues;t) rxmio3oudam e nct ()a2ur( pno0teenmf3ildfs2rmuvont0teeomr ootop ran o;s tetmir3iodoleemfvilt s2uaxrpnu1apt  iciysfs2rl(vsnu)aetrxociydfmt livi t0trxmxr3oudam nlicil()sDrm(mp;u1oeenmfeilsls2rmnvp t4 rxrmf3iy1fp  lues;s)t2umxrpnu4opte fctls aDraur ;t0apxoioetytlmDem(mon()artnmo3to1la  lies;(  2xr(o iu1ol nlietlt  rum( ooo1texn ieilsfm emn o () rxrmo iadfa eluvs;(0 rurxo3oy4llt lnciatfarra( o;t0tetn i3iyslmDum(msn(0teenmfciy1lptrlues;t0teum(o io4al n ictls a2rmu  ot0aeenmfetyd m el(vo u)tleoxo3ty1fm e nvs s)t2xoimpiodoptelnet t s2um(r ;o0opx moeiytlsDemums;u)tlxrmr totlptelneol( setrxo nudal e ictl(fs2uaumpou0teenii3tytla ra(mpnu)tleoxrcoadfatrauei;s0 exm(m oo1am  liesa() Duaumoot1aexo oeilsfm2ranmo t) ltoio oytfatr nvi;(0t2tmir nu1am n icslt sDuax  ot4ope ifciysfaDrm(mon(0altoif3totoaDelivolt  2urxmpiu1lpt livi (f rrr(root0tpe mociadfa2ra(vs;t0aeeoio todoatraues;t0 2tm(r3nudlptn iet ()sDtmur ot4teeoif3iltlaDulnms;u0aleoif3oy1lm r u ol(0trur(o io1amee feils  2uaxrp;u0apt mfciytlm eanvs u4 renxocoo1lm  anvs t sexmir3ny1lp emnvtat) rtm(rpoo0apen fetad sDemnmo;t4 leoxfcoytop   i s s) exm(r oo1olte nvilt)a2tmur ;t4optn i3tldlaDrmu p;(0trenxf ta1lp rlnvslt0t2tmio3iodamtnlivilsf rtrx  ;o4tpto ocilsfsDemuvp;(4 exniociatoa  auvi;( trtrxr no4lmte neiat  Dtr(r no4oee mf3iltfm2ulnmont0tleoxf3iotfp ean o;t0 etmxm no4lm emnctas  rtmx pot4aptoioeiysla rl( o (4 rtnmo todfpDelivs;()t2ur(o iy4lptemfvslt)sDumxrono1openiiciad mDemu p ()texnif3ootfpteaivs;s0teumxm nu4om nlivtl()sDumx p;o1apx  o3tlsfsDrl(mo;u0aeeoxo to1fm  auvilt)t2xr(o ny4om nliesat aDumurpnu4apeniieiysfsDuaump (0altoxr iydopDr uvo;s)teuoim iy4am   fvi t  rumurp;t0tleo f3iadfs2um( onu4aeeomr todlmtr ivslt t2um(m3nudap n ies t arumxrp;o4texnioetatlm rl(vp;t4tlxnmo3oo1fpD li i s0truoim ny1ope  neia(fs2rmx pot1tex if3ilt a2emumpnu) rxnxr3ia1lm raueslt  ruo(opoodole mnei ( sDra( pno4ale iiciatfsDrmn onu0trtnmo ia1om   u ols0tetoxo3oo1op nlnci sfsDrm(rpou4ole  oeiysfs ulumo t) ltoir3oy1fmtraivils  2xoxmpou1omtnmivias  Drax pnu4tee moetad s2ra( o t4alxoir iotom   i s (0 euriopio4lpt  fvils srtrxm no1oetnifetyd m rmu o u4 lermr3totoptrlnei s)tetoim oodamtn nvtltf Drrxmo;t1apxn oetldfaDulump () etnio3todfaD auvo (0trtrxo iu4apenmietltfs2ur( pnu0tleomociyd mDuanvs;t)aetnxociotopt ai slt0srxmxo io4aleemnviatfaDtm(r oo0teeomf3tytfaDel(vp;(0 rxomf iodlaDe i olt0 2xm(o3oy4lmtnmnei t a2um(m ;t1apt io3tlslaDel(mo u0 etnmf3oa1oa  anvol()srtoiopou1ape lfci () Dtr(m ;t1tet  o3iltlmDrm( o u0altoxo io1lat lnvols srxoir3ny1oltn fei ()sDur(rp;u0apx  icilsla2um(vsn(4aetrmfcoo1lmD lieslt  rtrim3ou4lpeelnetat)artm(m ;t4tlxoifeiytla2rmu snt0 lerxr3iatfmDr u i;s) exo(r3ou1ll   nvils)sDraumo;o1opxomociysfaDra(vpn()trermr iydfa eaieols t2to(rpny4lpee nvi s aDtm(  ;o0alt mictadlm2ra(mp;u0 etrif tatfm e nes s trxmxr iydal nlnct s)aDururo;o0opxomfciydfm rmnvsn()aexnmr iy1fp  auvi ( s2xr(o no4am e fci tfartr(mp;u4oexn ietltls emump;t0aetnxo oodomt an s;s)t2um(r3ny1alt mivia(fa2urxmoot1aexnmi3iydfmDuanmp;u)treoioctydopt lu sl()seum(opoy4amenmnvi (f Dtm( p;t1tle moeiadfa2eauvon(0 rxrmr3iodopt  ueils) rxrio oudam emnetl( sDuru oot0opxnif3tldfa2ea( o t4trenir ta1faD aiei;t0s2uoiopiy4lme  fesl( aDrm(mont4oeenmi3iatla ua( pnt4 rxnif3totfmDe ivi;(0setoim iu4lpe lnvi t  2ua(mp;t1apx ioeiasfa emump;u0tleriocoy1fmt aivo t0s2xr(m oy1ap  lfei ( s2rrxr nu4aetn o3iys m ulu o;t4tetrir ta1opDeaivo s0s2tr(o no1altnlivi t aDrmxmpoo4teeomoeildlsDua(vpnt0trxoxocto1omD  iei t) rxrim3iodal nmnctat  rtrump;t1texnmo3iyslsDea( p t0alxoifcoo1late ivs t)texo(m3io4lp   icia(fsrumu pnt4alt mf3ilt a2rmn p u0trtrmr3iytfm  aieols) rtmxm ou1op e nvt (fsDumxr ;o4optn icild a2el( s (0tltnxrcootfp r i s;( s2tmiopoo4lltelfcias)sDurx ont4apxo fetatfa ulu o (0aetnmrcta1omDr i o t0srtoim oydap n ivt ()aDur(  no1altnmo3iatls2ulumo;u0 lxrxf3iadfm   uvi t0trxoio ny1aleemnctlt sDtax  ;t4tlt iocildlaDrlu pnt0aetrxociodopDelneil(  rtriopnudap n fctls)aDrrxmooo4aex mociytlm2emn o t4aleoxo oydfmtrauvils)srumim3io1olt  ici s)arumx oou4oexnmietaslaDrm( p;(4treniociotlptrln il(0t2um(rpiy1ame mnvias  2ua(mp;u0altomf3iysfmDumnvs t0teeomf3ia1optean i;s0 rum(m ou4ap   fes (  rrm(moot0aptnmf3iys m uauvpnt4tlxrmoctotom   uei (0s2tmim3iu1om   fet t)aDum(rpnu0oee mfeiaslmDrlumo;(4areniocto1fa eaueslt0t2urxo3ou4ol emies tfarum(r ;u4tleomoctltls2rl(mo;(4aetrxf3oodoaDelnvo ()s2xoxm3oydam n feia(  Dtrxmp;u1tlt moctydfsDea(ms () rtnxf3oodoat lneslt s2umio3nudlp elnctls a2tr(  ;t4olenioctyslaDrmn s;t)aexrxfciydop raueo;s  2tmiopno4alt lictat  Duau  ;o4apeomiciytfaDranmpn()aeermrciodfa eanvs;(0trxrxmpoydlm  mnesl()sruaxrp;u0aexnmi3ils s rlumpnu0texoif oydlp eanesls) rtm(opoudapt mnvi s) rtm(rpou1ole ioctat s umn onu) ltnxf3todlpD  ieol(0sexmxo nydape  neslt s2rmum nu4tpt  o3ias m uan pn(0 lerio todfm   ivs;(  ruoim no4ole  fvtls sDtaum ;t4tee  ocilsla2ean snt0 lxomrctatop rln ils  euoio iodlmtnlfesasf Drr(moou0oltomf3tatfm2ulnmpnu0alxrxfciodlmteanvi;s s2umxopnu4lptn nvslt) 2ta(r nt0ope iictld sDuan pnt0 etnxo ta1laDeaieo (  2xo(m oodom  lfci s s2raump;o0teeo ociatlaDemnvp;t4 etoifcoatlmD  u i;s)tetr(o3ou4altnmietas)aDrruro;t1oee  ieilslsDeanvsnu)aeerirciy1lm elneils)t2xm(r3iudlltn iesa( arururono1openifctad m2uanvon(4 leomf3oo1op ranvslt) rxr(m3oo4open fcsl( srtr( oou0aeeoioetys a rm(vp u0artnmo iodop r iei;()trto(rpiy1ape micils  rum(  oo4tlt if3ias m rl(vp t) rerirctodom e ieolt0 2uoxrpny4ap elici (f Duaurooo1tex mo3tatlm2ulnmp;t)aeeoifcty1omtr n s t0srxoxo3oy1lpen nvslsfsDumum ;u4apxnmicias s2ulumo;(0aexrmf oa1lpteaneols0 2xmxrpio1openmnvt s)artau ono0optoii3tldfmDrm(mo;u4tetnmf3ootlm raueolt)texmxo3no4aptemieilt sDumu  ot1opx mfctysfa2umumonu4aetnio oa1faD lnvo;t0s2tm(o iu1aptn neslsf 2rru onu0oetomiciydfmDra(vp;t4altrifctytfp   uvo t0s2toxr3nu4ap nmnvsasf rum(monu0oleoifeils sDuluvs;(0 etoxf3ia1laDr ivols) 2toiopny4ll   ivsa( a2tr(mpnt0tee mieiysfs emnvo (0aeerir oy1op  lneo (0 2uriopnu4alt mfcsat s2ururp;o1alxo i3tls s emn s u4trtnxo ootla   ies (0 2uoirpou1alt lncsat s2ur( p;u4alx mo3tatfa2el(mo;u)arxrmr3iotfa e ieilt s2umim iy4al emfvsat  2trump;u4oltn f3tysfm2rlu pn(0alerifcta1oateau o t0trtr(o3oudlme mfes ( arrr(m oo0alxn i3tltla ranmonu4aetnxf oadomtr i o;t  euo(o ou1olt lnci t artm(rp;t0aexn f3tys s2rlnvon() leomfcoo1om  lu sls) rtoxr3iudapen ietls)aDraxmo;u1apxomoeiysfs2eluvp;(0aexnmrcoy1fp r neols) rxoxrpiy4apte fcias) rrau  ;o4tptomf3iyd m rl( ont4arenxo iatoa  au ols) 2xoio3oydlm nlfvil(fs2tmumo;u0olenmfctasfmDrmu sn(4aexnmociytlm rlnvo (0sexrxmpnydlm  mfci tfarur(  no0opx  oeiatla2em(vs;(0trxriocootomDrlueo;t)srtr(rpoo1opt lneslt s2urxrpot1aetnmi3tld a rmuvon(4tetoif3oy1lmDr n o;(0seuoiopio4oleemfvslt)arrmx  no4optnifeiytfm rmnvo;(0aleoir oy1faDraneo;t)t2xoxo3oo1lpee netlsfa2rmx  ;u4aleomi3iadla uau o;t4texomrctytfptr ivi;()seum(r3nodam  livs ( a2ua(rpno0tetoifciat m ean o;t0 lxnif totlmDelneilt0srurio3nudomenlfctat)a2raxr oo0oet  ociat m2eanmo;t0texoif ia1laDeai o s  euoimpou4ole mfcslsfsDta(monu4aeeoiiciysfa umnms;t0tlxoio3oatlmt auvo;( trtr(m nodlp e neiasfsrrmu ono4oet iietyt mDulu pnu) lerxf3tytomD lueo;t)t2xmxm3ny1lmtnlncslt a2tmumpoo4oeeo oeild sDeanvsnu)tlxoxfctodfpteln i ( srtrir io4apenlieslt  Dtaxrp;u4optn fctasfaDemn ont4 leoif3iadfmtrauesls  2xoxo ou4omen ieta(farrrxm ;o0tpx io3ias mDemu s (0aexrxr3oatoaDelueo;() rtmiopiy1ame livi ()srtmxmpou4tlxoii3tydla el( o;u) exnifcoo1lpDeaueols0s2um(o nu4optn fcil(f Dtr(mpnt0aeeomi3tydlmDrmums (0trenmf3oatfm e i i t t2xm(m3oodolte iet s) Drau  oo0alx  i3tlsfs uluvs;u0 etomo3oadopD aieils srto(m3iydop e icil( srtmuront0tlt ifetat sDumuvp;u4alxrmf3iadfm   i i;( trum(m3oo1ome mictl( aDrru  oo0aet  octadfa elnmp () etriocty1fa r u s;s  etm(m nodalt lnei () 2ur( p;o4olxnio3ils a umump;t0 rxrirciytfpD au ols tetoio iodamt miei t aDrrx p;u1aleniicildls2ean s u) lermr3ootfpDeau o;t) rxmxopno1ope mivtas srtrumpnt4apto o3taslm2um(vs;u)aetrio oo1faDe nvi;t)trum(m3io1apeelfetasfa2tmxm oo0texnmo3iytfs2emu s (0 leoxo ootfpDe ieslt)texmirpiydalenmfvta(f rum(  no4altnmf3iyd aDelnmo;u)trtomr iodfa e ieo s0 exoio3oo1opeemfeil( a2taur ;o1aleomo3ias mDua(mp;(4trenmociotfaDeau o;t)t2xo(opnu1lm emnei sf rrm(ro;t0oleoiicildfm ranvo;u)trxoxf3tydla raivs;t truo(o oo1omtelnci ()sDrmxront4tlt mfeiyd aDuluvonu4 rxnmfctotfa e u s () 2xoio ou4apt lneils) rtau pno0oeeoifeiytlaDumnvont4 exrmoctatla raiei t t2xrxo3oodopt mfviasfa2tmxr nt4tet  iciydfm raump u0texrmr to1laD ln o s t2xo(r3no1lme  icslsf rurxm ;o0openmieiysla2ea(mp;u0 exrifcoa1lpDe n o;s0seuo(rpnu4am eliei s)a2um(  oo1alx  ictldlm2elumo t) rxoxf oy1late i ol( t2xoimpnu1ol e ietls  2umumo;u0alxnmiciatlsDuanvo;(4aeenio oatlatr ieols)truoxopnydap nlnvil( aDrmuro;u1tet  o3tatfm2emump t)alenmfcto1fp eau ol(0s2xoxo3nudlle  feilsfartrx onu0opt  f3tadfmDuanvs t4teerxr3oytlp   u ilt)setmxm no1ll e iet () 2ur(rpnu0aexn fetat a2elu ont4alxrmrcta1fa eluvi s sexmxrpnydapenlnetat) rrrumoou0aeenmfciasfa2umn on(0tlenmf oo1opDrli olt) 2xmxo3io1apenmfvsatfsDum(rpno1aexo ociytla2uauvo t0aexrmr3iy1oatraies;t0 exr(o3nydlm n nesltfs2rax pou1olxomo3tysla rlnvon()aeerxr to1lp rln ol(0 eum(mpnudolteliet sfa2rr(m ot4ole mictas aDuan o () lxoif3tytlptr nes;s  2uoir3no4lle lnei tfsrtaumoot0aexomo3iydfs2rmuvsn(4teerxr ia1om   nes;s  etmirpoo4am nlnvsatfarra(  no4tet io3iat sDel(vo (4teeoxo3iatop eaiesl( s2xmiopiu4ame  netls)sDtr(rp;u0aeeniieildfs eln s t4trxrmo3tadlmDraivs;t  2ur(opny1om  mfcia(  rtmum oo4olx ioetys m eln p u4altomo3oo1faD li ilt0s2tm(rpnudolt lieiat) 2rru pno1aeenmfeilsfa ea( p u)aexoio todomt anvs;s s2uoim iy4lptemieiltf rtax o;t0olen i3tadfm2ul( on() etniociatopDe uvo (0 2xm(opno1ale lfvilsf 2uru o;u4tptnmictydla ea(mpnt4aeermo oytoaDelnvs;t texmiopno4lpee ivils arta(r ot4oleoioctytfsDua(vo;t4arxrxr oo1lpte nvs t0s2ur(m3iudaptnmiei s s2umurp;u1tlxomfeiatfs ra(mpnu0aexoxo tadom   u o s0tetrimpou4omt  nct ()arumx  ;t4olx  ietat a2ra( p t0arxoif iydfm e i sls0t2uoxopoydale mfci (  rtm(ront1alt ioctat aDrmnvo;u)trtrifcio1fptr ueo (0trtoir iy4om e fvsl(f Dur(r oo1aet  feiyt m2ulumpnt)trtrxr iatlmDe nvs;t0trtmxo ny4op nlfei (farurx pou1aleniiciadfs uan p (0aeermo iydfaDe nei () ruoio3oo4lmtnlivi s sDtr(  ou0aet  fcilsfa ran p;t0 renio ty1lpDr i il( tetr(r ou4ll n ivsl()aruaxmpnu0tlx mictyt m emumpnu0texrxo iytfa eaueo;t0 etmxr io4lp nmfcs (f Drmxrpno4apenii3ils aDeln p u0 exrmo oo1lmtrlu i (0trurxr3nu4opeeliesa(f rraxm no4tpt mo3iatls rmn ont4 etoxr3oodfptranvsl()sruoxr io1lp emfvsat aDumu o;u1optnmf3ilslsDrl(vp t)trtoir tatlaD lu s;(  exmxrpny4op nmfeils srumxronu4olxnmf3iasfsDulump t) etnxr ia1faDeai o;s) rxoim3no4am n icsas sDur(rp;t1aex  oeildla2ua(vp;t4 lenxoctotopt au ol(0 2umxm3iu4ol emnetlsf Dtmurpoo4aexomf3iad a ulnvs;t)trxrif3oodfp  li s;( t2um(m3ny1lptn feia(faDrrx oou0ape  ictldfs2ulumo (0altnifctodfmD luvils srurxm3oudlp n ici t arur(  oo4opxn fciadla2eauvp;(4aexomr iydfa e i s;(0 euo(r ou4ome mfesas) Draxmpot4oee iiciyt s2umnmsn()alerio3tatoatrluei;t)seuo(m3io4lmt mfvils)s2rmum ou1opxnioeiytfm2emums;u)aexniocty1fa rauvils  eumxo iodopenmfctl()arraump;t0aetomieiad sDrl(mp;(0teenmociydomDeli i s) rurxr iy1al e ivi ( sDum(r ot4optoioetysfs ul(vp;u0 lxnif ia1omDelueo s)s2xr(m nudamee icia(farua(mont4optn i3tls a uau sn(4tltnxr3oo1opD  u o;s0tetmxm3iu1amtemnetat) rrm( oou1tptoioetls a2umnms;t4tetomr3iodoate ieols  eumxo iodll   iet t) Dra(r no4aexnmfctldlm2ulnms;() ltnxf3ootfm ran olt  eur(o iy4oltn feslsfaDrmuront1apeomociyt a2em(vo (0 lerxo3iotoaD anes;t0 2xoim3iu4op elfvtl()sDurum oo4tpx  fciltlm2emnmsnu0 etnir todlmtr nei;( t2trxopiudlltn ivt s)sDraxront4tltomfcias a emnmp;()aexoif3oo1lmD  uvs s)s2xoio3nudop nmnvi tf 2umumoou1aetoioeiytfsDemnvsn(0trxnxo iotlmteaivsl(0t2uoio3io4alt mfvtl() Drrxrpot0tleniicilsfs uauvp;u4tltniocty1fat luvsls)trtrxo iu4ap nlivsat arumx onu0oex  oeilt m2emnvs (4texrif3oytlpDeai o ( setm(o3nu4lm nlncias) rtrxroou0aee if3tysls eluvs t) eenxf3tydlptraieo t  exm(rpny4apt lnesl()srtrx pnt0oexn feiad s rlnvpn(0 ltrmf3todlp ran i (0t2urimpou1amtnmivi () rrruroou0olxnmicild aDrl(mpn(0alxnio ty1omD lues t  rumiopnu1lpen iviasfsDrr( p;t0ape iociad m2emu on(0 rtnir iotlp  ai ols tetm(r3no1lp emnvtl(  2rrxm ;o1aet ioctlsfa2raumon(4arxrio3tatla r uvils  eto(rpno4am emnvilsfartmxmpou0aexomiciltls2ra(vp;()aetrxrctatlm  aueo;s) 2xmim3iy1lme  ncils)sDtaxmp;t1oleomfeildfs rlnvs;(0 ltoxr3iotfm  aieo ()s2trxo3nydolte fes (fa2rmur oo1apx if3tydla2uan p (4alenmo to1lateai s;s  etr(rpiudopt lncsls arrr(moou4tpenmfeilt s2rlnvo u)arxrxr oydfa eli o t)trxoir3ny4am   nvtl()a2rax poo4apxnifeildfm ulnmo (4 rtnif3oo1oa   nei;s) rumxo3nodalt mivtlsf rtaumooo1apeomi3iyd sDum( p (4aetrifctytfpt ln o;s)tetmimpoo4apeelnesl(fsDuaurooo0oleo feiytlaDeanms t4aeermo3ia1fp  lu slt  2uoio3iu1altnmncsas) Duax  ;u0tleo iciys sDelu o;u)teeoxr oytlpDrlu s;t)tetoxm3oy4amtemietltfartaxmpoo1alen octatlm ra( o;(4aexnir3io1oat aivol( s2trir nu1lm emncslsf 2ta(rp;o1oetnioetlsls2umu pnt0alxrmrcio1laD lnvs t)t2umirpny1aptn feslt s2rrum ot0apxomo3ildlm2uanmp;t4aexnmo3ia1la rauei ()t2urim3oodlp nmfvslsfs2trxmo;t4alto f3tydfmDulnvo (0aleoxo ta1fpDeau o;t0t2tmxopoy1optemnes () rrmur oo0aetnio3tasfa2umnmp t0teeoxr oadfa   ivilt)srtr(opio1apte nvsas) Dum(root4ole mi3ildfa uaumon()alxrmo3tatfa eau o t0 rumim3ny1lpenmnetasfsDua( o;o0tlxomf3iadlaDuauvo;t)areoif oadfmtelnes t teumxmpoo1lme  nesasfa2rau oot4aexoiieiyslm ra(msnt4tlenxo3iatlmD  u s s)s2xmxm no1oltelivtlsfaDtrxmp;o1tlxnifeiatfa2emu pnt4trtnxrctatfpDeanesls  rur(o3iu1oleelivtasfa2uru pot0oexomociyt s2eauvpnt)arermo oy1fm elnvsls0s2to(r3ou4lltnlietl(f rua(rp;u0optnmfctatfm2ul(mp;(0artnircto1oa r uvs;()t2xo(r3oo4optn fes (fsDumxmoou1texo octat a2ran p u4 lerxr3ta1oaD  uvs;(0t2xm(o3oy1lptn nvia()sDua(ro;u0aeenmf3ils mDrauvont)arxoio3ta1la r nvi;()trtrio iydlleemfctat  2um(roou1opt io3ilsfm2ul(vp (4arerxr3tydoa elu s;s0srumio3iu1omenmnctasfa2tax pno1oexnifeilt a2rl(mpn(0altoxocoytfpt livsl(0tetrxm oodame mnvs () rua( oou4alt iictas aDra(vo;t) lxrmocto1lpteanvo s0trxm(r3nu1lme liet t) 2raumo;o1opt mfciat s2emumo;()arxomfciotoateauvi;t0 rur(o nu1olt lieia( srtax o;u4alto i3tydfs2uanms;u0texnio3oydfaDrau o;s) 2tmxo ny1om  lncsl( s2tm(m ou0tetnif3tyt a2um( p t4trtoxo iydopDr uvs (0 etrim ou4am   fes ( sDuru pou1oexo fetysfsDel( pnu0arxrif oadfp   i o t) rumxr no1olenlfviat)aDraumpot0aee if3iat m eanms;u0 ltrir3oytfateaivi;t0t2tm(o iu4omeelnetls) Dra( pnu1tpxoiiciyd aDranvp u4aleomo3iodlm ean ol() 2umim3iydlptn ieilt sDum(rpoo1aeto fciyt aDumnms (0 rtrircoydomteluvs;()t2uo(rpny4amt mnvsasf 2ta( pot1tlxnifeiasfmDumumo;(0trtnxo3iydomtr nesl(0s2urxm nu1omtnliet ( aDtaxm nt1oex ifctydlm rmn pnu) reoiociadlmDrluvsls tetmxo iy1om e neta()aDrrurooo0aptn oeildla2um(vs u0 lxnmr3oy1fptrauvo s) rtmxrpiy4olt lnctas  Drr(  ou4aeen ictatfa el(ms;t)trerxocoatlm r u ilt teto(o3iydamtemics tfarra( poo0ale ifcilsla2rmnms u)teeoxfciodopDe ues ()srxrxr3io4aptnmnvi s  rrmx o;t4tpeomfciad sDrm(ms u0teenxr io1lp  lnes;(0 eurir iydalt mfetlt) 2rru o;t1aexnmo3iad s eauvo;(4aetoxo iy1fp r ivs;(0 2trxr3iydlm  mivi sfs2tmxmont0tpt  i3iyslmDulnmsnt0 etnio3iydlm r uvols)sexm(r3oy4llen nci sf Dtm(root0ale  o3tytlmDemn o;t)altoir3todla rlivs s)s2triopnu1optelnesat) 2uauronu4ape io3tltlaDrmnvsnt)aetnmr3iy1omt  nes;( srxoxo iu1lpeelfcsls sDrm( pot4altoiiciltfm2eauvs (0 lxnxr3tatomD  i i;s t2urim3nodll emivsas sDtmx ooo0tpt iociytlsDua( onu) eeoio ta1lptrluei s  rxriopny4oltelieil(fa2ta(r no4opxn i3iyslm2rmumsn()alxnmo3todfpD ln o ( tetmir3oy4ope livs s  2tru p;t4texo oeiysfsDrm(vp t0tlenifciotlmDraneols trtmxopoy4op elfeils  Drrxronu4aee mietltlaDum(vpnt) rxrxfcoo1op  ln ilt)srtoxo3oudolt lictas)a2rmx ono0tpenmfeiltfa2ran p u0 eeoir ta1op eluvsl(0 2toirpnodamtnlfvtas)sruax pno1ale miciyd a el(mo;(4 rtrmf iy1oat  ies;()sruoxr iudomt lneiat sDraxmpou0tetnmo3tys sDeluvo (0tltoirciotfmDr i slt) 2uoim no1llteliesls  2urumpot0altn ieiyd m eanms;t) lermfciodlatrai o;t)trtrxm no4lm emieils) Dum(mo;o0oltnmfciaslsDulnvs (4 ltomr3oodfm  aivi;s)s2ur(rpno4olen neil( a2trum nt1texnmictysfm2rau p (0 ltnif3to1optr ivols srtmio3nu1apen fciasfarurumoou0olxoiiciadls ul(mp;t0trxnif3to1oa  anei (  2um(r oy1lltelnvils sDtmu ooo1alt  fctldls rmuvont)tltomo3to1fmDr ieslt srxrim3oodaptn nvslt a2uauro;o0opx ii3iadfs2uauvsnt0altnxfcta1fptelneils seuoio3no1om e nctl() ruru oot1opx moetysla2eanvo ()tltrmr iy1lp rlivils0tetmxo3ny1ap elfcilsf rrrxr no0apen i3iltla ea(vs (4 rtnmocoodlatrlueolt0srxoir oodop nlietlt a2ur(m nu4texomfctysfmDel(ms t0artrio3iodop  auvi;( s2to(mpiu4lpt lfes ()s2taxrpno4alxo octytfmDua(vo ()tleoif oatlmDrli olt srur(r3ny4op  liciat) Dur(rono0optn oetyd m umuvs;t0trermfcty1op rauesls0tetrio oy1ale mfvsl(  2rmxroou1aeeoiieiysfmDra(mon(4arxoxr oa1omt ai s;(0texr(rpio1altemncs t  ruaumo;o4ape ifciyd a2em( sn(0arxnxf oadlmtranes ( sexmio nodal  lfeil(f rrm(mp;t4olxomoctatfsDean pnt0trtnir3oy1fp  lieo t0t2tmxr3iy1olt lfcs s  Duaurp;u4tetomfctltls ea(vsn()teerxf3iadoaDraieslt)t2toxo3io1olenmncilt srtaxr ;o1ole mo3tad m2rauvp ()tlxriocoytlat  ivo t)s2uoxr3ou4lm  livtlsfsrtmuro;u0tltnmfciatfa2ul( p u4areoxfciodomDraivil(  2xoxm oy4amt  ncia(  Drr(  nt0aexn f3ildfa2ranvs;t0 rtnmr3tatlateluvo;s0t2xmio3no4openmnvslt artaurpnt0tpt ioetlslm rlnvp u0 eermo tydlpDe nvs;t teurio iy1ap e nct ( a2umu ooo0opxomo3iasfa2emnmp u)trenmo3ta1lp  lues;t trxmim3nydamtnmiet t) rrr(m ;u0texniiciasfs2rmums (0 leomr oa1lmDrliei;(0s2umirpiudome  feslsf 2trurp;t0ape  iciytfs2rmn on()altoiocty1fa  livilt)t2xoxo iydalte neslt)arrmum ;u0alxnmictltfm2ua( o;u4 rxrxo tytomDeai ils) exm(opou1altnmivt t  rrrx  ;o1tpx ifetat s2elumo;u4 ltrir3tytfptr ues;t  2xrxo iodam nlfei s)a2tr(mp;u1texomf3ils s rm(ms t)tlxrmo tydoa e u o t0 rtrim3ny4lpte nvs s srtr(  ;u0aeeoii3ildfaDuln s (4 rtrmf3iydoat  nvo;s0texmxr oo4llt mfesas)s2uax poo4olenmf3iyt sDul(vo (0 rtrif3oydfpt au o;s)truo(r oo1am nmfei (  rrau  no4olxomietaslm2um( p;t)aeenxrciytfa rai s;()s2xrxm oo1ole liviltfaDrr(mont1oee  octyt a2emnvs;u0alxomocoytfpte uvo;t)texr(mpnudaleemncta(  Dururp;t4texoiocilt s2rl(vs;u4altoio oy1omDelivo;( srxoimpno4olen neilt aruaump;t1tlxnmociltfa umu snu4tlxoxo3oatlmt an ilt0sexrxo3iy1opte nvia( a2trxr nu0tlenio3iytfa2uanmsn(4 rxrif3oa1fm rau ols)setm(opiu1lme mnvi () 2rax p;o0ole ioetatla umuvonu0alxnmr oytlmt an s ( trur(mpnodome  fvtlsf rrr(m oo1oeeniociaslsDum(msnu) ltriocoodlate nvs;t sexr(opoy1ap  mici sfs2raxmpnu4apeoioeiyt a rl(monu0altrmf3ia1oatr ueols0 ruo(opou4lmt mfvtat arua(rpoo4opeomf3iydfsDuauvsnu4trtoxocoadfptrlueo;( srxoio3iu4lle liet t a2umxm ;u4opt  i3ilt m2ua( s t0teerir3io1oatelivilt) 2urimpnydlm nmici ( a2ua(rpnu0apen ictyd sDul( s;(0trtnifctodfa  luesl()trtr(o3iy4altelfciat  rumxmono1tetnmfcildls2ea(mp;(0 ltriociy1fa  aieol( trtr(m3oy4am eliei s arrm(ro;t1aeto o3iad sDrlnvpn(4tetrxo oadopD aivi;(0trtr(m3oydape livtl()arur(rooo0tpxn fetytfm2rm(vs;u0tleomo ootopDe ivs;s)srxoxm oudlmt mici t) rtaur ;o1alenmi3iad m2eau p;() rtnxf iadla r ies ( srtrim no4amtemnctasf 2urxrpnu0tpeniieiltfa2umn s;t0tleoio3ta1fmDrai ils)texm(m3ou4ol nmics t arta( o;u0apxn octlslm2ea(vs (4 etomr ootla r i s;t) exrxr ny4om emnesasf rtrxmp;t1oeeo feiatlm ea( s;t)trxrmrciatlpt  uvs s0t2xoirpiu1ol  mictls)a2ra(mp;u4alxomietltfmDean snu)tetnxfcoa1lpDelivs;() etoir oydapee fvs s)srraumpnu4aexnmo3iadls rau s;t0areoxo tytfpDelueil(  eur(rpnu1oleemnes (fsrtr(mpnu1teeo ictytlaDuanvo;u0 ltrioctotom e ieo;t  rtrim3ny1ale lict s)aDur(roou4alenifeiat aDrlu s (4 lxrxr oydfate u s ( trto(mpiydapeeliviltfartr(r ot0olxniieild a ul( o t)texrxo io1fp rlnvi (  2xm(opoy1ol e ici s  Drrxmp;o4tpx  f3iadfmDuanvs;u4 rtoxf3iodopDr nvs ( trurim3oodomen ictas sDraxr no1opto o3tys m elu on()treoxr iadfmDranvs;t teumim3iudlpe mietl()aDuru ooo4tleoiiciydfmDul(ms;u4alxoxf oodlm  luvi;(0 etoxrpiudamtelietat a2uax  ;t1opeomfeias a rlu pnt4altnxr ootlp r uvils trtmxmpoydllenlncsat)a2ta(mo;u0aet ioctat a2emump (4artnmociotfpD livo;(0trxmxrpoy1amt  ietas)a2rru  ;u4teto fetys aDrauvp t0alxnxf3oa1fpDelnvi;t) 2uoxo oodapte fvt (fsDrrxr oo1alt moetltlm rm(monu0trtnir3tadla   nvilt0texoir oo4aleemneia()aDumxr no1opeo iciad m ra(mp u)trtrircoadopDelu o t) 2xr(opiu4lmtnmivsat  Dtax  oo0ale mfetlt m uanmpnt)tetnir oodlaDeaivi t)trtm(opno4lle mfvtas  rtm(rp;o0aexn feiad s2ul( p u0trermr totlpDe ivo;t)srtrxo3oodamtnmfviat) 2urx oou4apto f3ildla umump;t4 renxr3io1fptelieo;t  2xoxr3io4lmenlfei t artax  nu1aptoii3tysfsDrm(vs t)arermf3ty1opDeanei;s)trtr(mpiu4apt mnctatf Drau  nu0tlt mfetysls emnvp t0teeoiocty1fmt aivsls  2xrxr nodolt mnei t srurx p;t4aeen i3iys mDulnvo t)tetomo oadlmtraieol()seto(rpno4altemiesa(  2rm( pnu0oee mi3iydls2ran pn(0 ltnif tatlp  lnvs;() ruoxo3oo1am e net t)srtm(rpnt4optnmieiyd m2umumpnu0tltoxf tytla  livilt)seumxmpoy4lpee ietatfa2trxrooo0texnioeiaslm emnvo () lxrxfciy1lmD lnvo s) 2toio3no1lpeemiesl(f rta(mpno1olenioetls a uauvs;t4aetnio oatoaD auvo s) euoir3oy4olt lfeslsf Dtmx pno0aeeomoeiytlm2rl(vo t4teermfcoy1lat  ivi s)sexm(m nudlp  mfetas) rtrx  ou0texoifeiytfs2rlumsn(0artomoctodoa  aieo;t) rumim oy4oltnlnvia(fa2rmurpno4aleoiicildls uanvo;t) rxnif oa1lpt auvi (  exm(m nu4amtn iei s a2tmxr ot0optomiciltla ra(vo;t4aetoif oadop rlu o;s tetrxrpoy1op nlietls  Duru  nt4alx  ictldfsDeln snu4teeomr todfp  liei;s tetrxopiy4alt  nvs t a2rru oou4aptomi3iasls rluvsn()altnmo3ty1fa eluvs s)t2xmim nudop   nesasfs2ta(mpnt0oeeoiietad s emuvpn(4aeenxf3iydopDr iei s  exrxopio4llte fvia() Dua(m ot4oeenmo3iyt s2eln s (4artoxo ia1fpt lnes t srxrxmpoo4olen ncsas)a2umumo;t1ale io3iaslm ulu pnu) eeoio tydomD luei s  rxrxo no1omte fvs s  Dtmu  ;u0aex mfcias a2rlumo t) eerxo3iodom eau s s srtoxo oo1opeemfes tf 2trxmono4aexniieiydlaDean p u4texrir3iydlaD lneolt0srxrio3no1op elietls a2ra( o;o4tpx iieiltlsDuanmpnt4trtnxocootomt  uvi ()trtoxm io1al n nvtls arrmxro;t4tleoio3iyd mDrlu o;(4 lxnmf3tatlm eln ols0 etr(mpiu4olte icils arrr(  ;o0tpt mo3iadls um(vp u0trxnxf oy1fmD  nei;s teurimpoo1omtn icsa(fa2rmxm ;o4aeeomiciyt aDrlu p;u0teerxf iy1fm r nvi;(0 rxoxo nudame  nvslsf rrm(r ;u1aleo oeiltfmDeln p u0trxoxr iodfp  anvi s) 2urir io1amteliesatfartmurp;o1oltomfciatlsDua( snt0tlxrxf3tatom r ivi s  exm(mpny4ap nmivilsfa2rr(moot0teeomf3ilsla uanmp;()tlenif iydfmt ln s;() 2toim no1opeemncsls)s2tmum nt1oexn iciysfa ran s ()tlxnircootoatrauvs (0s2tmim3oudlmt  ncsas) 2tru pnu0tptn f3tlslsDeauvs u4treoxf3iadoat  neilt0srxrxr3ny1op  lics s) rrrumonu4aeeo oetas m2eau s ()tetnmrciy1lpt aivilt0teuoxr3oodaptn nei t) 2tmxront1alxo f3iysls2emuvp;()alermr tydlm eluvs;s  rxo(mpny1altnlfciat)srta(ro;u0aeenif3iltla emn s;t4aeermocoytoat  i o;t0 ruoxmpno4lm elfvias) rrm( oot1oleo ieiysfsDuan sn(0tlxnmfctodfa rlivi;t s2xm(rpnodlmtemiet t  Dta( onu0tlxnifciyt s rlnvp;u0tleoxfciatfmt aues ( srtmxo ou4lmt lneils a2taxmpnt1olxnifcilsfs emu o;(4tlxrmf iadoate nei s  2xoxr iodal  lieslsfarrrx o;t0tpxnmoetlt a ua(von(0arxrxo3iodlp  lueo;t0texrxmpou4lp n feil( aDraxroot1opxoiieiatlm umn pn(4alxrio iadlpDran sls) eumio iu1oltemnvt t  2uau pou1apt io3tldls2emu pn()artrmf iatlptrlivol( sexoir3nudal e ieslt)aDrm(r ;u0oeeoio3tat m emnvp () rtoiocty1om r iei () ruo(m iudam elivt ( a2um( pou4aeeomictls m ul( pnu)altrxr3iatop   n o;t  eumimpoudap n fvias arumx  ;u4tle ioeildls2um(vs;u)tltnio3oydoate u o;t t2xmxrpoy1lpt lietlt srtrur ;t1oleniieiyslm rm(ms (0 exrioctotfmDelueo (0trto(o3iodll nlictat)srua(m oo4ope  feiydla2el(vs t) exomocia1om   i sl( s2um(mpoy1ame lnvils) Dtrxr no1tlt  f3ilt m ul(vp;t4 renxf3iadoaDeau sl( srtrxrpoudlpee ietlt)sDrmxmpnu4aee  f3tlt s2emu p t4teenifcoo1optrau i;()t2um(r no1alt  iesat) rtmxr nu4aeeniicilsla2rmn o;u4aeeomf3ootfmDelneo s)setrir3ny1al n iesl(faDur(  no4alt mfeiyt s2ul( o;t4 exnxo oydfptran s;s)setmxmpnydaptnmictatfs2rrum nu4olxn i3iyd m rmuvp u0 eerxf ty1fateli s;s0seto(m3oo4aptelies tf Dtmuro;u0apt iicild a uln o (4tltrif iydlmteanes;s) ruo(m3io4op emictas sDtmur ;t4olx mo3iadfmDua( pn(4alxnxf to1fm   ieilt) rurxrpny1amtn fvsl(fa2trxrpoo4opx mf3ilsla2umnvp;u)artomociadfpDe n il(0 exmir oudam   fctls)sDra(mo;u0tpeo icilt a2rauvonu0 leomr3iy1fpt aues t0 rur(m3io4ale  icil() rra( p;t0olt iieiadfs2em( s;t0trxnxfcootfateanes;t)texmxo oudamte fct s arrmx oot4apxo oeiys a umnmo t4trxnmocootlp ran slt trto(mpou1ol nmietltfs2tm(mont4alto o3iatfs2um(vp;t)trxrmoctatlmDeauvo t) eur(r ny1lp nlnci s) rtrxm ot1oetomfciytfsDum(vs;u0 exrxf iatoa  au s;()sexrimpiy4ame miciat) Duauroou1aleo ieiatlm rlnmsnu)tltrmrciytlaDrlnvi s seuriopno4lmee nvilt  Dtr(mp;t0optomfeiatls2uaumo ()treoir3iatlpDr n ilt)srtmxr3ny4ameemictas a2rmump;u1aetomfetytlmDumu snu4 eeomo3tatoa elnvol()texm(r io1ap  lnes ( aDumu pnu1aeeomf3tydfa em(vpnu0 etnio iy1fm e i s ()sexoxopou1ope mfciat)a2uaxrpno4alx  fctytlm eln o;t) ltrirciodop eaueils  2xoxo3ny4ap n ics ( srrrxmpno0texnmf3iytfmDrmn s;u0arxoio3oadfateai ol() 2toim nodlm nmfci tfa2umxrono0tlt iiciat aDuauvonu4 rerif3oadfate nvi (0t2urxo3nu4om nliviasfarra(rpnu1tltomoctatfa2umump (4trxrxf iy1oaDeanvo;t  rurio no1apt micil(fa2taxr ot0tpt ifcilt m2um( o;u)tleoxf tatlaDe n s ( srtmio3nodamteliesl( arra(mp;t1apen f3tys aDra(ms;t) rxrmfciadfmDr n s t)trxo(r oy1optnlneils s2ururonu1olx mfetaslm uanmp t4teeomo iatomDeaneolt0 2xrxr oo4olteliesas)artaxroot1opxo feildls2elnvo ()trtriociy1lm e u o s setrim3ny4ome lfesatfsruaurpoo1opxnmiciys mDul( s;u)trtnio tydlptraivils0t2xr(rpiodop elncs s) rrmxmpnu4olx mf3tys a2ea(vpn(4teenio3tadlmDraies t)t2tmxm oy1opeemfci (f 2uaump;u1aeto o3tasfs rln pnu4tlenmo3ootlat luvi (0 2trxr oudam elfvtlsfa2urx  nu4oleomieiasla ul(mp;(0 exomf tydlateau i s0sruoim nu4ap n nesl(  ruru  ot4tpt mictasla2ran p t0 eeoif oodlmD aivi () 2uo(opoodap emfvi t) Dur( pnt4apx  ictytfs ea( ont4aeerxocoa1lmt  ies;s trtmimpiudolte nes sfsDrr(rp;t0tltn fctatla2um( pnu)tlxoio totfatr neslt0 rurirpnu1olenlnvslt)arraxrpnt4tltnmieiatfs emn o u0aetrxr to1omtrlu s s  rum(opno4amtemics t)sDuaxrpnu0opeoio3tltfm2rlu o ()aexrxr3iydlmDr ivo;s sruoxm3oodomenmfesa()sDtmumono1aex mociysfsDrauvo;(4tltoio3iydlaD livs (0 rtrxm ny1ole lncsa(f Dua( pot1ole mociatfmDul( onu4 eeriociadfmte n sl()srumio3oudomeemfvtasfs2tr(monu0tltnif3ils aDrm( o t4treomf3totfptr uvsls0t2xmxm iydalt lnet (  rtaxmpou1oltoiieiydfs rmums t4altoio3oy1fa e u o;(0 2trxmpoudamen fct ()a2ur(rp;o0open fetadfa2rmu pn(0aexoif3oodlaDrauvs;s) 2xoxo no1openmnvi t)sDur(rono4aexo fctlt aDelumpnt0 reoxoctytfpte i olt)t2xrir nodole  fctlsf 2ta(mp;t0alxnmoetldla ua(ms;u4arenir iy1la elnes;s0t2uoim3iudapen iei t)a2rmuronu4openmoeiat mDrm(mpn()texomrcia1la  anvs t) rurir iy4alenlnctls sDra( pnt1tleomo3iatls2uanvo;t4aeeoxr3iadfmD lnvs t srtoxm io1optelfei (  2rmu pnt1oee ioctltlm um( s;t) rtnmfcty1optraieo t trxo(m iudlm e ncia(  rumumpoo4apenmfeiydla2uln ont0aexoxrcoa1faDrli sl( srum(rpiodopt mncs (  Dtmu  nu4tlt mo3iltlm2uanmont4aetnifcia1lm raivi t teuo(o oo1ol n ncs (  2tm( p;t4oee  i3iad a2ul(vp (4arxnxo oy1fm rlnes;(0 rxrim3io1ap n ivsas a2rm(m ot4opx  o3tlt s2ranvsnu4tetrmr to1oate ivo;( t2xoxr oy1ame  ietls) 2ur(mooo1aptn ictlsfsDrlump;u0arxrio iytop eanvo ( texrimpnodlmt mnvsatfa2uaurpoo4tlt  fetydfmDulu pnt0areriocoo1fp eli ils)s2urxr3oodlme mfvtltf Drr(mooo1teen fctadlaDul(vp;()tlxrmrcootlp eaneilt)t2xoxo3iu4ol n nviat  2ta(m ot1alxnmi3tyt mDeanvonu0tetnmrctatfa ranvs;s0texrxmpiy1olt lfvs tf Dtrx  ;o4tpe mf3iytlm2ua(vs t0 rxnxrctydoa  aivo;t0sexoiopiodlm emncsl(  2umumo;o1aexnmieiat a eanvo t) ltnmrcoatopDean s t0s2urxo ny1ol n fviat) rrrxmp;t0aptomf3iasls2ea(mon()tltrmr tytfpt an o;s)t2xr(opio4amen nci t) Duaxmpot4alx  fetyd aDum(msnu) etoirciodfpt an o;t t2umxopnu4op  mict s)aDtax  no4tlxo feiyd s emu o;(0texnmfcta1opt  uei t texriopiudlpee ivils srtru  no4olxomoeildfs emnmpn(4trxoirctadlm e neilt)s2toim3iy4altemfcsas)a2ur(m oo4olxomicils m uluvp u4 ltrif3ta1fat lnei;(0 2xmim3nu4alte fcia(faDtax  nu0tpxomfctld m2emnvont0 lxrmfciatfa   ieo;(0 eumim iy4op nmictas  Dra( pnt4tpeomiciat aDeluvpnu)aetoif iytlmDelivsl(0teuoxm3iu4lp e ics ()a2rru p;t1aet  icild m umnmp ()tetoxf3tatlat lnvs;s s2xrir ny4ome mietl(f 2ra(mo;o0aexnii3tadfs2rmu o u4 exnmrcia1op r uvs;(0t2urxm3oydlle  netls) Duaumpot0tpeomo3tat mDrmnvs;u4 lerio io1lpDran ol(0sruoxm no1op elieta( arrmxr nt0alto ocilt m2um(vpnu4tlxrxr tadoa r ivs;s0texm(r oodamt  nvtlsfs2tru  ;t0apenmociltfa uauvont)aleomo3tadlmtelivils  2xr(rpou1ap   icsls arurxmooo4oeeomfeiysla2rau o (0tlermr3iadfaDraiesls)t2toxm3oo4op nmfetl()artmxro;o1opxn ieiysla2em(vp (0treomoctydomD  ieo;()srxoim3oudlm e ivsls arrmxmp;u4oetnmoeiltls rlnmp;u4arxrxf3iatfmDr ies;( tetrxo3ny1altnlivsltfa2tm(ro;u4texoio3ildlsDrmuvpn()alenmr3ty1lp  lneo;t0t2tmxm3oo1lm emnei sf Durxm ot0altomociad a2rln ont0 ltnif ia1omtranvi;()t2tr(m3ny4ll n fcsat)arrmuro;t1ape  oeildlmDrlumpnu4altomfcio1omDr uvo ( texo(r3oy1olenlieia() rtau ono1oexnii3iydlmDranvsn(0areoxoctatlaDr u o t)tetr(mpny4openlies t sDuaur oo4aetoioctytlmDum(msnu0artomocta1la elnesl()truo(o3oo4opeelfvt t sDuru poo0teeo f3tlt m uanmo;u0 etnmr oatfmD  n s s t2xrim nu1ll emfcil(fsDua(roou1oetn ocildfs2em(vo u4 lenir3oytlptelneo;()sexo(rpno4ale lfvtls) rrmumo;t0olx mo3iadfm umumpn(4areoxrcto1latelueslt tetrxrpoudomtnmnet t)sDuru p;t1oleo fctltfm2ea( s t)trxnmf3iatlpDr ies;(  exoio ou4amte netas srur(m ou4tet mfeiltlm elu o (0arxnxrciy1fp r ivs;s0sexrim3oudaptemfcsls) Dtm(rpno1olt mfeilsla rln o;(4aeenmo3totfa r nvs (0srumxm3io4amtelncia( a2rrur nt1tpe mf3tysla2uln pn(0artnmrciydomDrli s t  2xoxopno4olt mnvtat s2tr(rp;o4oexnifctlsfm uanvo;(0 rxoxr totomD  ivs;(  eum(o oudllt mietl()srtaxmonu0tet iictlsfa rmu pnt4aexnxr3ootlm rlueilt0srtoir3oodlle mfcilsf ruauro;u1oex  ieiys a2umuvs t4artnxoctatopteluvi;t  2trimpnu1llte fes s  Dum(r ;u1teeoiictldfs2rlu o (0tetnmr tydfpDeauesl(  2tmiopiodapt  iet (  rtrx o;o4alx mieiydfm2rmuvs t0 lenmf oytfa r nei;s  2trxm3nodlle  fcslt  Drau pnu0aetoif3iysls2ulump t)alxrir3tatlptr ieo ( trxm(rpio1lm   nvil( a2tm(mpot0teto fctytfa umn pnt4 lxomf todlpt lu i t)teuoimpno1omt lfvsltfaDur(m ;u4apx iicildlm2emums;(0trerxf3tydlp r i olt0t2xrxm3nodap n ietat a2ta(monu4aleo i3tasfs2umnvp;(0aeenxo3oydomDeanvs;t)texo(m iudamte ncsasfsDua(r ot1opt mf3iydfa2raumon()tetoif3totlpt  nes;( t2tr(opnudop elfci (fa2raxm ou0tltnioeiad m2ulu s;u) rxrmrciy1omtran o;()trxrio no1ll nmicsas)srraxr no1tle  i3iasls2raumsnt)texrxo3io1fat ai s;s0teurxo nu4lp e ieilt)s2tmx p;t4oee iieild m ea( snu0texrxoctatfp elnei t tetmio oudllenmnesasfaDta(ronu1olto f3iys s raumpn()altnif3tadopDr ueolt sexrim3oodap nmncslt  Dua(monu0ape mieiad m2emumo;t0 lermo todoaD aivol(0truoirpno4olt mfes sfs2rr(mono4aexn f3tysls rmnmsn(0 exrxo ootoaDeluvi t seurxr3iy1olte neta(  Dtm( pot4opxo icild m umn s (0alenmf oa1lm  an ol(0 2tm(o ny4optnlfvtat s2uau ono0aexomo3iad m2ea(mo u) ltnir3oo1oaDeauvo;(0sexoxo3nudomtemieil(  rtmxmono4ole  ieiytlm emnvo u)tltnmf3oy1faDeauvi t  etoio3nodopen ictl( sruau  ;t0tptnmieiat aDra( p t) rxoir3iadfp rli il(  2xriopnu4lp  mivia(fsrurx ont1altomi3iatls um(ms;t4alxrxrciydfp rlieo s t2xm(mpoo1amtnmfesls) 2rrx  no4tltomfciltfmDrlums;(4 reoio oadop rluvo t0t2uoiopoy4lp  mfeiat arum(mpot0tpt ifciltfm2ra(mp ()trermr ta1lm e ivs t  2xr(o ou4lmt liet s sDraxmpoo4olxo ociatls2umn s u4tlxrif3oydoat aneo s  exmxo3no4op  lfvsl()aDurx pou1altnifeilsfa ulnvonu0arenif3ia1fat  ueol() etrir io1ame  icslt) Dtm(moot0oeeoii3iyslaDrl(mo (0 reomocoytfpteauei;t0setoxr3iy1apeemnciltf 2uaxrp;t4aee ii3iasls2uauvpnt4 exrir3ootfmte ivo;s sexm(rpny4lptemncta(  Dum(  ;u1tltniieiysla2el( pnu) rerxfctytoatrauvs t) rum(o no1omeelictltfs2rm(mpoo4aptn f3ils m el(monu)tlxrmocto1omD  i s s)sexm(o3nydamenmietatf Duax  ;t4apeomfcilt s umn s;(0alermr ia1late u s t)s2xoxopou1llenlncsl( sDtmu  ;o1tetnif3tls s2emu p;t4aexnif3ia1faD auesl(0 eur(r3iy4openmnvsl()s2rrx o;u4oeeo i3iadla2em(msnt0 etoxr to1fp elnvs;s0tetoiopny1oltelfvs (faDraum ot1apx miciysfmDumnvs u)teenmo3tadlp r uesls sexmir3iodlptelfcsltf rraxrp;t1olenmiciltfa rmnvo;u)texomr3todfp rlues;t  2tmxo3nodaltemici ( a2tr( p;o4aexnifetasfa2eanmont)artnxrcia1latrlnvo t  2xmirpiydomen iciatfa2rr(rono0optn feiatls2umnmo u0trxrxrctotlpDr u s ()srtoxo3iy4amee nct t aDrmxrpnu0tleoii3iasla ea(vo;u0trtriocoatlp  ln i t0t2xrxr3nu4lpee ies ()srtax  ;u0tpt  feiltfm ra(msnt4 lxrir3oa1omDeaivs;()texrim3iu1amte ncsl()srua(mo;t0optn o3iadfm em( o t4texoxfciydlpDr nvil(  exmio3oo1ameelfesasfs2rrumo;t4tle mi3tyd a2um(mp;t)areomocio1omt li ils0texoxmpiudlme lfcs tfs2tmu  ;t1alenmfeiydlm ulnms;(0aexnmr3iodomDranei s0tetrir nodop  lnvs ( srrau  no0ape  i3tyt m2rlu on()tetnxfctadfaD livs;t0 exr(m3iudam  lictatfaDua(mono1tex ii3iat m2rln o;u4 rxoir3to1fm   uvil() rtoxo nodop e ieiat)sDtm(mono1ape ifctyt m2rl(vs u0 rtrmociodomteau s (  rurxmpio1ol nlneta()aDumur nt0apxo ietytfs2ulump;(4 lxnxoctytomDe uei t0 2xmio3no4oltnmnvi tfa2trumpou4apxn f3ils aDulump;() reoxoctadlptr u o;t  2xmirpnu1ll   ncta(fa2urxr ot4alenifciatla2rauvs u0 ltnifcootop elieo t s2ur(r3nydlptnmnesa() rururooo0apto o3ildlm rmnms (0trtnmo3ia1lateln slt teuo(mpiydlp  lfviasfa2ua( ooo4tetoiieiyd m rmuvo;()teerif tydfpteanvs s  etoxm nydlmeemfct (  2tmx o;t0altn fetydfm2eanvo;()trxomo3oa1fmDrai s;t srtm(opoo4opt mnei ()aDuau  oo4oetn octysfa rmu pnt4teeomf totfat an s ( truoimpoo4optelnetatfsDtmx ont1ole  o3iyt s rmuvp;u4 rtoxrcoa1fate uvs;t0s2toxo io1ap nliet (faDraxm ;u1tpenifeiysfa rmn p;()alxoio oodlaDr ieols)srurio3nu4oltnlfesa()a2tax ooo4oltnifciydla2elnmpnt4 etrmr oatomt lneo;t srurir3oo4omte ietlsf rtau onu4tet micilsfa2rmnvsn()aexomr ty1omtr ueo s trtmxmpiy1omtnmfei s srtr(m ;u4tpx ifeildlsDrm(mo;(0arermf iytoat an i;t)t2tmxr3no4ole  fvt sfs2uaur ;o4oetn feiatlaDranmsn(4aetnxf todoptr u i;() 2xmxo3no4ameelncils srurx onu4oeeoifciadla rluvo;()alxoif3to1oa  anvs;s sexmimpnu4ap e nvils  2rr(m ;o0oltoioeiyt s2rluvo u0 rxrmocoytlaDe iei;( srxo(o io4al n fctl() Dtau  nu1alx mociytfmDulnvo t0 lxrmo oy1lp  au s;t)seur(r no1aptnmnet t)arrrxr no0openii3iydls2rl( ont)tltomrcoydopDranvi s  2xm(rpoodopenliei (fartr(mpno4aptn ictld s2ulu p ()tleomf oatfa r nvolt0 etm(r3iydllte ivilt  2uaxm no4olxomoeiat a emuvs;u)trerxf iodomteluesls)s2tr(m no1ol emfvi ( s2tm(mpou4oeeo ieiyslmDra( onu4alxrxrciydomDeai il()srxrim3oodope liei t) Dra( pnu1tptomi3tls sDeln o t) rtrmr3totfa elivol()trtrxr iodole  fesas sDtr(rpno4teeo o3tyt a2umn p;t4 rtnxfctytlpDeliesl(0 rto(o nodlmeelnvsl(fartmumoou0tex  f3ias s uaumo;u) eeomf3to1omt anvols  2tm(opio1amte net s)artr(r oo0apx mfeiatlm rmumpnu0 eeoirciadomt livilt srur(o3oy1ol nlfvta(  Dta(rp;t4oleo fciatfsDrm( pnt)tlenirctadom eau s s0trxm(m3iodale lietat) rra(r ;u0olxomociat m2rmu p;u0alenio totfa eau sls sexriopoy4ll   ncslt aDtr( ont1aetnmietasfa2eanvo;u4 eenmr3oy1laDrai i () 2tm(opnodlmte fes t arta(  ;u0tet  oetlsfm elump (0teeoif iytfmtrlies;s0s2trio oudomtelnct ( a2taurpnu0olxn feiltfs2el(monu4aetnmrciadfmDeluvsl()seum(m ny4lpte ncil( a2rr(ro;u1aexnio3iad aDeanvp (0 ltrmocty1fp  li slt sexr(m iodlmt  neilt)sruru  ou4altnmfeiatfm2ulu onu0tlenxo3tadom raieolt trtr(r iudom nmneils)srtr(rpno4tlx  ieiydlaDrmuvpnt0trermr3totlmD anvslt0 2xoim3no4amtnmiei (fsrur(  ;u4aex moctldfs2ra(vo u4 lxrmr iydop rluvo ()srxrxo3no4ap   fvs sfaDum(ront4tlx if3ildls2umu snt) reriocoodlmDelu o (0setr(mpno1lle lfetls) 2urx  ;u1teeniictys mDel(vsn()altoxo oydoa elies;t)t2xm(opoo4om nlfcslsf Duru o;o4oexo o3tasfm em( s;u) rtrir3iadfp e i sls)srur(r3iydaptemict s aDtax  nt0tee mfctydfaDum(vpnu4tlxrmrcto1fatelieo t0t2ur(mpoy1ale  fviat)aDra(rpnu1oex io3iydfs2eauvs;(4 exoxf3oa1fp  luvs s s2xmxm3nydlmen iei sfsruru o;t4teeo feiltfm2rau pnt4 lxrmrciy1fptr nvi;t0t2urxopiy4ll nmfetltf 2tm(rp;t1oetn ieiasla emn snu0 rxoxf3oytomDelu s s)sexr(opiu1oltn ictlt)sDrau  ou0tltnifetls s ra(monu0aexrxf3tydopt  i slt0trxm(rpny1lpt lnvsl(fsDumum ;o1opxo i3iadlsDumums (4 lxoxf3tatlm   u i;s0t2uoimpiu4ol emies tfs2umx pnt0tltnmo3iatls uanmsnu4altoxf iy1latrlies () ruoxo nu4altnlfviltfs2tm( o;o4aptoii3iasla ua(mp u4 leomrctatlaDean o;s0 exo(r oy1lltelici s sDtrxm ;u1olx ioeiad m2rl( o u) lxomr ia1fmDrau o s)trum(r no1lmte neias a2rr(  ;t1tlt moeias m2ea( pnt0aexrmocta1op eai s t0seuo(r oo4omte neils  Dta( pot0aexo fctyslsDumnvo;t0aetnxrcto1om r uvi s0teurxopio4optemfctat  2rr(m oo4oee iieilsfa elnvo;()arxriocoy1fatr ivils seto(o oy1lmtn nesltfs2rmx o;u4olx ii3iysfm ulnvont4 lerxo io1op r ueolt0srtm(o3no4ome  nei (f rumump;u1oltn ociyd m umn s;t0 exoxf to1oat  n sls0 2urio3iydom e fvil(fa2urxmp;o1opeoifctytfaDeluvpnt4teeoif3oa1oa   nesls teurxrpoudllenmnetl() Dum(r no4opt mieildfm rm(vo;(4 exrmo3ta1omDe ueil(0trtr(mpoo1omenlfetas sDrruroot4olx mieiytfsDra(vp;t0tetoiocoa1laDraiesl(0t2uoio iodomenmfvta(fa2rrx oot0aetoif3tld a rm(vo (0alerif3ootlp  ln il() rto(rpoy1am nmfvtat  2ua(rpoo0oexnmoeiysla2eluvp t4texoir oodfat  nvo t)s2to(opny1llee ivs s)aDrau p;o4aetomoctyd aDranmpnu)aeeomo3iydla rli i ( t2xrxr oydom  lfei (fsrta( oou4apx  i3ildlm2elnvs u0 exoir3iodopD  u s s0t2tmxm ny4ll  lfvias  ruru  nt0teen oetadls uaump;()arenxf iy1oaD ln i s t2um(m ny4lltemicslt)arumx oot1tltoifeildlsDrauvo (4 exoif3ia1lpDeli s;(0srur(r3oydlle mncs t)sDrm( o;u0tpxnmo3tysfm uaums () ltnmr3oa1oatrlnvo (  rxr(m3iudolte iei sfa2umum ot1texnifciytfmDulu on(4tlxnmrctytfm raueol(0 rtoir oy4oltnlnvi (  2ua(m ou0aptoiiciydfa rlump;(4texoifciadlat  i sls0 etmir3oy4lp   fet t)a2rrx  ;t4olx moctltlsDrmuvo ()tltoio3ty1lptr i s t0 2xoim3nodop  mictl()s2taurpot0alen ieiydfs ulnmp;u4alxrmo oy1oaD aieo;t0 2toiopno1optnmieil( a2rmxmoot0ope ioeiasfa2rmuvp;u)tetnmfciydoa  lnvilt  rum(opnu4ameemicsas  rururp;u0olxomf3ildfa em( p;t) lxrxr oa1oa  an sls0sruo(r io1opeelneta( s2rmu poo4olxo ietatlmDuau sn(4alxoio iy1fptraivs;(0s2xrxmpiydllt micsa()a2um( oou0ape mfetlsfmDranvs;()aeerxr iotopDr ieil(0setm(r no4apenmfetltf rtrxrp;t1opxn o3tldfm2rlnmp (4trerxf3oo1lptrli ols  exrio ny1am elfei t arrmur ot4opeoiieiat mDulu o (0aetnxf3ta1oatrlivs s) 2xoio3no4alt  nei tf 2rru onu1apxnmoetydls2uau p;()aetnio3iy1la   iei;s0sruoiopoydom nlneilt s2umu poo1texoifetas sDumnmo;t)tltnmf3iytoa eau sl() rtoir iu1optnlnes t sDtmu o;u1tlt ifctldfm2ea(vs t)tlxnifciytoptrlnvo;(0s2uo(o3oo1lme lfesltf Durxrpnt4oltnmieias a ran o (0trtomo iadomteaivol(0 etrxmpoy1ol nmfvslt  2tr(rp;o1teenifeiasfs rau sn()altoxo3oodomDeauei ()s2umxo3nydom  lnciasfsDumxrp;u1texomo3tld aDeanms;u0texrmr3to1op eaues () rtr(o iodape  ics sfsDumxmont1tptn ocils aDuau s;u4alxoxf iodom e nvo (0 eto(mpnu1ol  mncilt a2uaxrpno4open o3tasfm2rmn o (0 renxr tydlpDr n s;t0 rum(m3iydlpenmiei s)s2uaurpot1altnmieiltla2ul(vs t0trtoif ia1fm  lu s s tetrir nodomee fciltfs2ua(mp;u4tlx iictatfmDem( p (0tlenir3ia1lmD ln i ()tetmxo3no1lptnmnvslsf rrm(r ;u1tpxnifetldla2umumo u)tetnio3ia1lat anes s teto(o3oo4opt mfvt ( artm(mpnt4tleomociadls rmuvon(4 etoir todoatrlivs;t)srxoxo3nydlme  ivi ( a2taurp;u1olto iciatfm ua(mo (4trxnif3todla rau ils trtr(rpiu4al nlfcsas) ruaum nu1apxoioeiatfa elu s;()texrir oadopD  n ilt texrxr3ny1apt livilt aDra(rp;t0aeenmf3iydfmDranvont4 rtrmo3oa1lpDrlieol(0s2xoim3ny4ole  fcs ()a2rmxrpoo0tpt mf3iadfs ranmpn(4areoif iytfatelnvi;t srumiopou1ole mnvt t s2tm(rp;o4aeeomoetatlm2rauvo;u)artrif tatfmte i i (  2umxo3oo1al nlfeias sDuaxrpnu4optnif3iydfm um(mp;u)teenxr3iadomte u i;s) rtrxm3oo1ol  lfeias)a2tmxm nu0opxoif3ils a rmu ont) eeoxociydfp ranvo t0tetoxmpoudlpenmfesatfs2rr(mooo0opxomi3ilsla umumpn(4aeeomf tatfmD li i;t0seuoir3io1am  lfesatfaDtmxro;t0oltomfciadla2umnvp t0trtoxocio1lmDrau o;t  eumiopio1ll e fviat)arrm( poo1aexomfciad sDum(vo u0teeoio3iatop   ivi ( srumir3nudam nmnvtlt  2umum no0tleo ieild a eanvp (4 lxnxf iodla  ai il( setm(m iu1openlncta( arumx pno1oexoii3iydls2rlumonu4altoxo oodlaDelieils)setoim3nodal   ics s srtmxroot4teen ietldlmDumu p u0trtnxo3oatoa  luvs;t s2trxr3iu4lleeliet t aDtmumo;t4optnioctadlmDulu snt) lxnxf3ta1fpD lnes;s trur(r3iudam nlivi ( aDrr( oou0tlxnif3iysfsDea(vsnu4teerio totlmDeanesls0texoxr no1lme  nes tf 2ta(rono1olxn fcias a uau o (4trxniocoytfaDeauvi s trtoio nu1am elncilt)sDtm(  ;t1tee  i3tasfs2uauvsnu0altnmr3iatom   i ilt) 2uriopnu1apt lfctatfaDumur ot4tpe if3tldfa ra(ms;() lxoio3oy1fmte nvo;s)s2xmimpoodameelfvtasf Dtaxrp;t4ope mi3tltfm rl(mpnt)aleoif3tydop rlieils)trum(mpiy4ll e fesas s2ta( p;t0aex mo3ilt a uan s t4aeerxr3ia1la   uvols0 2trir nudalt lncs tfsDuauro;t4tpxnifeiad s2ea(mo;t)aetrio3ty1lpt ai il()texrimpnodalt mfeslt sDua(r nu0olenmieild aDranvp;u0 etrif3oydlpD  n o ( t2to(rpnu1ap   iviltfsrrr( p;u0tptn feiasla eanvpn(0trxnxrctatlpDrli ils srtr(mpoo1openlfetls arurx ont0texo fciatla ul(vp (4 ltoxr oa1faDrlivs t)teurxm3nodam n ivia()sDrm(mo;t1alxn i3tlslsDrl(mpn(4 etnio ta1lpD  n ols)s2xrxrpno1llt mnet s aDumu  oo4apt  i3tyd mDel( s;t4tetoxo oo1oaD lieo;s sexo(r nydomtn fvs ( artrx  oo1opxn ociysfa2ulnms;(4texnxrcootlmteau i;s0teuoio ou1olee fctas)aDtmx o;u0tlto i3tytla emu o;t0 rtomfctodfmDrlnvo (0s2xrxr iodll  mncs (fs2taum oo4apxo i3iydlm rau p (4alxoif3ta1omDran i s) exoir3iodlmtemivtl(fsrtr(  ou1oee moeiysla uln on(0artrif3tadfaD luei ( srtmxrpoo1apenmnvsls  rur(root1tlenmi3tadls uau on()texrxrctotlaDr ueo;t t2ur(r no4om  lieslt)a2tr( pou0olenioetlt sDelu onu0tlxrir3iotlpDeai ols0t2xoxrpou1ap nlict tf rtru o;u1opeoifeilt m rln s t0tlerircoa1lm r ueol()trtrio3ny4alenlfet tfs2um(root1olenio3iydlsDua(mp (0 reoxo3oydlm   uvo;( t2xriopoydlpee ivslt arurur ot4teeo fciydla uan o;u0 exnmf3iotfpteluei s texm(m iy1am nmfeiasf rrm(root4apt  o3tlt a2ranvont0 renxocoadoatrlnei;t0setm(m oy1ol nmfvtlsfs2rmxrp;t4tetnmocias m ranmp t4trtnmrcoadla  li i;(0s2um(o3iy1altemiviasf 2ra(m ou0tle if3iadlaDua(vp (0alxnir to1lmt  n ol(0 etmim oo4ame mnvi (fsDumuroou1openmfctasls um(mo t)arxoxf oo1op ranes s trto(o3iodllt  fvi (f 2uau ooo4opx mi3iltfa eln pnt0 rerif io1opDe u i (0 euoio io1om e fvs () rra(rooo1ole mietldfs ranmsnt4arenxrciotomtr ivi ()truoxmpoy4op  mnctls)arrr(ro;o1tptoio3ild m umu s u0tltniociydom rlnvi;s0 rur(opio1al elicta()aDtr(  nu1tlx  octatla em( p;t0 eeoxfcoatfpD  n i;s0t2xoxrpiu1ole mneils aDtax pot0aeto i3tys a2emu p t0texnio to1fmDe u i ( s2xmim3oy4lptn ieta()sDtrxrpou1tee  oeiyd m ul( pnu4 etrmfcootlmte uvi;t setm(m oydlm   ncs t)aDumxmpnt1olxnmocild sDulums;()aexrmrcia1fmDeai ilt) rumir oy1lm e feslt)sDrrxmpoo4apenmicilsfmDrm(vp u0trxrmo oo1fpDe ivs t) 2xrxmpoy1lltnlicia(fsDtr(rp;u0tpxoiiciysfm2ua(vo;(4 reoxr3todoat au sl(  eurio ny1olt  ivsasf 2rau oot0aleo ictytlaDuluvsnt) exrmo oydfmt lu ols) rurxm3iy1open fesas) 2ta(rpou0optnif3ias s ranvp;()altnmf ty1op rlu s t) 2tm(m3oo1lpenlneta()a2rax o;o4tlx iietytfsDemn onu)teenir ty1lm raueo t0seumxopiudomen fcsls) Drauronu0ale iieilsls um(ms (4 renxr oodlaDrln i t)s2xm(r3ny1olt  fvs ( a2uau  ;u1tltoiicildfmDrauvo (4aeerio oydom elies;s t2xrir3nu1lmte ncs (f Dtau p;t0aet  ociaslmDem(mp t0tltnxo3iotfp eaivols0s2xrim3no1op emictl(  Dra(m ;u1apx io3iydlm rmn snt0texnxf3ta1la   uvs () eur(m nu1lptnmnesa(fa2rrum ;t1aleoifciysla2ra( p;u0 eenif to1opDean i;()t2umimpou4ale mnei (fartmxm ot4open ieiadlm rlumo u0arerircoy1omDelivol(0 exrim iy1lpte nci sfartr(ro;t4ale ifcildfaDra(vp t0artnxo to1lpte uvslt) 2to(r ny1altnlivi t) Dtaxmo;u4tlt  i3tyt aDemumsnu4 rxrxoctotlp rlnvo s0sexoxm3ou4am n ictl( a2urumo;t0tlto feiyslm eanmont)aetoxf oadlaDran s t)texmir ou4om e nvsat  2umx  ;t1ape ii3iytfsDranvo t) rtoir3oy1lmDelivol( trumxr3iy1lm eliviltfa2rm(mpoo0altnifciad a ul( s;t0 lenmr tatomDelueols)trxmxm oo4openlict tfsrtr(rp;o0apt  feiatfaDrmn s;(0aexrmrcootlmteauei (0 etm(o3iu4ol   ieta( aDrm(ro;o4opt iieilt m ulnvonu) exoxrciotfmD  ueols) rxo(opoy4lm elnvsasfs2umxm ;o4teto octadls eanvsnu4 ltoif totlp eli sls truoxo oudapee fcsas arua(  ;u0alxomoetas s2rlumsn()tetomf ta1fp   nvs s s2to(m3oy4ll  lfes t sDtaumont4optnioctld s ea(mo t0tlxnio3iodfmt lu o;s) ruoxo iudam emfvi s sDrau  ot1aleniictyslmDeluvo t4aetnifcoy1oaDr i ils0 eumxrpio4amtnlnctasfarraumpoo1aleo o3iydla2ea( o;(0 exoiociotla e neslt)srumimpnu1ameelfesl(faDtr(mono4tetnmi3iltfm ua(msnt4teeoifciatopte neolt)srxoxo oo4opeemfet (fartmxmpno0oexn ietydfs2ulnmp;()artrxfcta1fp raies;(0t2toio3oy4om emnet s) Dtmx ooo1tetoiicilsfaDeaumo;u0 eermo3to1oa   nei;t) 2tmxopio1lpe mfei (  rrr(mo;o1opeoif3iatlsDemnvp;t4 rtrio3ia1oateai ols srto(mpnodop emfvil(  Dtmur no1opeo iciaslmDrmn s u4tleomr3oydfmD lneo;s)t2uoxo3oo4lpe  fctasf 2ur( pno4apxo oeiyd a2rlnvont0trxoio3tatlmD livols0trtrxr3nudope mncilt)sDur(  ;t0apx io3tadfm2umnvs u)aetrxrciy1lm e uei t srxmio oodlmeelnvil()sDraur oo4oexnioetas m emnvpn(0aeeoir3ta1fmD aivo;s)t2tmio3io4omt mfetls)srururono4tex ifciad a rl(mo t4 eenxocootlpD  ivsl()truriopno4lp nlfvt sf 2tr(rp;o4alx mo3tadlm rl(ms;u)altoifcootlpD anvi t  rxrxopiu4lle lfcilt)sDururpou0tltoifeils sDrlnmpnt)aleomo oatfa r ieils)s2um(o3oudll   ivtlsfarrmum oo0tlxoiieiyslsDea(mo t4aleoxfcoodfmDraneo;s)srumio3iy1altelnvt sfs2um(r ;t1alx  f3iydla2umu o;u4trtnmr3totfa rlnes s0trtrim oo4ole  iciatfaDrmu  ;o0aeeomoctatfaDelnmo;u0texnir tydomtrlivslt) rtoxopoo4am emfct s sDrmxm no4olxn ociysls rmnmsnu4 ltrmrcootlat  n o (  2urxr3no4apt mivsas)sDtax p;o0alx  fctldlsDelnvsnu0texnxrciadopD  n s ()trumiopiu4am nmncsa( srtmxr ;o4opx mociyslmDea( pn(4tltrxf iodlaDrlnes s)t2tr(m3nudlltnmfvtlt arurumo;o1texnifeiyt aDrm( o;t0 leoir tytfm r n o t)teuoimpiudopee ivias  rtr(rp;o4tpen oeiydfa ulnmont)teeoxo3oo1fmD luvo;()sruoimpoy1amtnliviat)srum( ooo1oee mo3iydfmDuluvpnu4arxnir todopt livs;(0 2umxopiodamtnmfctat  2taumo;u0tpx ifetysls2elnvpn()texoio todlp ran s;() 2tmxmpny4olt lfcilt sDrrx pno1apt mi3ildla2eanmo t4 renif iodlpD  u s;(  euoio3oydop nlietl() 2umxmp;t1tet io3tls aDul(vs ()alenmocoydfateanes ()tetoim iudlmtn ietls artaur ;u1aleo ictat mDelu on()teenmrciytfp  aivi t)t2xoxrpou4oltn ict s srur(r ou1oet ioetydfa2ra(msnu4aleoiociotlatrli i (0trxm(mpoo4lpen netltfsrtm(  ot1aee ioetadfaDeauvp;t)tlerxf tytlaDr u ils0t2xmxr3iudlp  lfvs s  Drmumpnu0aexnio3tysls2ran ont)tetrxfciytlat  i slt0texo(r ny1ap  lieia()srrr(m ;u4tptoioeils aDra(mp;u)trxrir3oydlp rli i (  2toio ou1apeemnviltf Drmx  ;t4tleo ociydls elnmo;u0trerxo3tytfmte nvi;t t2toxopiodom   nci t) Durxm ;u1oltomieiadla ean o u0 eermf3tatoa  ai i s0 2xmio3ou1olte ivias arrmx pnu0oexoioctlslaDul(msnt)alxrio3iodlat lnesls  eumxr3oy4lltelicsls sDtr(  nt0oexnmocilsfs2el(ms;(4alxnif3oadlm eanesl( t2xr(r oydap emfvtat sDra( pno1tet ii3tasfs2elums;u)aetoif3tytfa   i o ()sruoxm nu1lpee fct (farrmx ooo0olxnmo3iyd sDul( p t)trtrxf oytlp rln ilt trumio io4apt  netl(fsDta( oot1texo fetldlsDelums t4tleoir oa1latr n i s setrxm3no1ape licia(farur(mpou1oee mietltfs2emnvont)tlxnxrcoodfat lu o t)trtrir no4ol  lnet t  Duaum ;o0tltnmietlsfm2ulumo;t0 lenmf3oytlaD  u ilt teumxo3oy1omte fesl(farrmum ;o1ope  ociyd m2ra(ms (0teerxrcootfmt  i ols)texrxm no4ope  fct ()srurumonu4aeeo fciys s ulnmp;t0 etnmo3todlptrlu sl(0 rtmimpiudoltnmfctasfs2taum ou0ole moetasfs2rlu o;(0 rtoir iytoa  aues ( sexrxr iu1aptn fviasf rraxront1alt ifeild m2rau o;t) etoxr iodomt aivol(0 2to(m no4ap  mfcil( aDra(mono0alxomf3tldfm ra(msnu4 leoxfcto1lp  ai o;(0s2uoxo3iu4opt mfcs s  Drmx o;t1apeo ieiad s2rmnvon()aexnxr3to1faD li o;(0 etmio3oodomenlici t arrmu oot1apt ifeiadlsDranvo;() etoxr oatoaD anesls0 rxr(m oy1om elfvi ()sDrmump;t0tpto ictydfs el( s;u)alxrxr iydfp e n s;(0 eurirpou1optnlfcias)s2um(monu4aeeo ieiatfa2el(vp t0areoir oodopt  uvi;s t2urxm3io1lptelivtl( srururpoo1texnii3tyslaDel( snt0aeeoxr3oa1omDrln s;()s2umxm3iy1opt mictasfaDrmxr oo4aet mieilsfm rlumsnt0arenio3oydlaD an ols)seuo(r3ou4op  mnvtat) Drm(r nt4tlt  ieiadfmDeanvpnu0 rtoif3iydlat  u i;s) eumxmpiudome lfesl()sDrmuront0ale  oeilsfmDra( s (4tltnxfctodfp e uvil()tetmirpno4llen nvtlt)a2taur nt0tptn f3ilt sDeluvs t0 renifctodlpDrauvo;t)trtr(m3oodlm  mnvi s  rta(mpnt0aeeo f3iadlm uanvs;u4altnxfciadfaDeln s;s seuoimpio1ale miesls) Dtrxmp;u0apeo ociat sDrmums;t)tleoxo totoaDeaieo;t0 rurxopio4ol n feiltfaDrax  ;o4aex  f3iatfmDumn o;u)tltnir iydoptelu i;()srxo(m3nydomee ici s) Drm(m ot1tpeomoetyt s rm(ms t4tltomoctatfp ran sls0sexm(mpoo4al e fvsl() 2ua(  ;o1aexn oeiltlaDrmuvont0 rerxf oa1fa ranei;()texoxopnodalte nvsl( sDtrxront1olxn o3iltls rauvpnu4texomrciydomDrlieils t2trxmpnudoltnmfcilt s2ra(ro;t4aexn fciadfs uln p;(0aeenxf3ta1fa r n s;()t2xmxo no4op n ies (  2uaxmpot4tetomi3iat sDranvo;t0 rxoxrcoa1op rlu s;t) exrim3nodlm emfetlt)srurum ;t4olenifeiat sDraumo (0aetrmr3to1fptr nvolt0trtoirpiudap  mfesa(f 2um(r ot4tpxoiieiatla ulumpnu4 rtoxr oa1faD aivi s0teuoir3iu1lmeelncta( sDrrur ;u0tlxnmf3iyd aDrlu s t4 ltomociytfa r uvols)sexmxo3no4alenlnct (f 2umxmpnt0aeenmociatfs2ra( pnt0texoirctatlpt auvs;(0s2uo(mpnodol nmieil() rtr(m no1texomfetlsfaDua(mp u0teermr3oydoatelu i t0 rur(o3ou4om   nvsltfa2tru ooo1aleoii3tysla2uanvonu0 eeoxrcoadopDranvi;s truoxm3oo1lpe lnvtas)arrr(rp;t0tee mfeiysls rluvpnu4 lxoio todfa   ueslt0teum(opnodlpe  fvt (f Dtau onu0olenmoctasla ea(vo t4 reoxf3to1oaDr uvs;( t2xrim oo1al emivtat  Dra( pot4tptomiciysla rm( p;()tleoxfcta1fpD  n ils)trtmxmpnu1ame lfeilt)aDtrx  ot4tpe ii3tasls2rlnmpnu0tlxnxf3tydom e ueo;t)sexrir3iudlltelfesa(f rra(mo;t4apt ioctysfa ea(vs (0 lenmf3ta1op r nvo t  2xrxr nydalenmnet ()sDtr(roou4oex  feiytfm2ul( s () rtrmf3tydoaDran s t0seum(o3iydamen nvtls  2raum nt4oeenifciysla2elumo;()arxrmr3tytopteli i;t0 rur(m oodll nmnetas aDua(monu4tpe if3tat mDemnmp ()alerxo3tytfpteauvo t trxmxopny1alte fcsa(faDrmu p;u1aeto ocils a2ulnmo;()tltnir3oy1omD livo;s srxmio iu4alte ncia(f 2urx  ;u4aeenmoetlsfaDemnvp (4arxnxo3tatlm e i o t)t2xm(m3io4lltn ietls a2ur(moou1alx if3tltlmDrmnmo u4 reoif3oadlm ran o ()trtmio ny4lmee nvsat s2ur(m nu4oex mf3ildls rm( o (0 eerxrcia1opDr n slt0t2to(r io4alen ncsasfsrtaum no0apxn i3ilslm2emums;u4 renio3iatop eaiei s  etm(o3iy4oltnlieias)a2tmu o;o1tlx mfetas s2umu p t4texrxf3iotfaDrlneo t s2xr(r ny1ale  ivt tfsDumxm no4olx  f3iatfmDelnmo ()tlxoxf oytoatr u olt0trxoxm oudomenlfcs ( sDtm(r ;u1opt moeildls2eaumonu0artrif oa1fptr i olt) rxoxr iudomee feiltf 2urumono1tptniictytfm2elumsn(4tltoxo3tadfp elnvs s  rtoiopnudole mnei s) rrax  oo4aex iiciyslm2ua(vs t)tlenio3ta1oa eanvsl(  exrio io1ol e fvi (f 2uax ono1olt mo3iatfaDrluvsnt) rtrmo ia1lpt livi (0 exmir3io4optn fvt (  Dta(  no1alt  i3ilsfm ua(vp t4 rxrxfcia1lpt  uvs;t sexm(m oy4lmenlnvtls  Dtmur ot1alen oetld sDem( pn()tltomf3todlat  ieol()t2xrxr3ny1opt lfct t)srurxrono0aexomfeilt s eanvo t0tetnmo3iotfp eau olt s2xoxo ny4ome mfvi (farrr(  nu1alxo octasfa2ua( s;(0tltnxf3tatlm r i i;t0 euoxr no1lptn nei (  Drru oou4teeoii3tlsfm elu s;t)treoif oatfmDelieo t)srumir3no1lp e ietl(  ruaumpno4tpe ioetadlmDuauvp t)altrio tytfmteau s;(0t2xoim iudll n nvtat) 2tau pot0tle if3tad mDumuvpnu4aexrxf3iytfmtraivi s  2urim oudomtnmfciat  Dtru oot4olx  octydls2eluvpn(0 rtomo iotlaD lnvol()t2xoirpny1lmtn iciasfa2rrum no4alenioeiysla emump;t)trxrxo tytomDeau s t)s2xo(m iudal eliet s)sDtmumpou0olt  fciadfa2rlu s;()tltnio3tadfaD ln ols0 rto(o3io1amtn nvs t)aruaumpot1tpen feilsls uanmp u4tltrxrcoa1oatr ivil(0s2tm(o3iudal n iesa()a2tau  ;u0aexoiieiasfs2elnvpnt0 ltrmf3oadfaD livs s  rxrxopiodaptemnvtlt  Dumx p;o4alx mociytfm2eanvpn() exoir iy1opDeanesls)trtr(m iodape lieilt  Dtr(m ;u4opx iietatfs2eanvpn(0 etnmrctadfmD aivi;() eumxmpnu1lm nlietltfarta(mooo4aexo fcild aDra(msnu)aeenxfctodfmDelivo;t0 exoxr ou1ap elfcsls  Draum ;t0tlxn ieiytls2ra(mp;u)aleoxo iy1laDeauvo () rurxrpiudame  feils srururo;t1tpeomfeiytls2rl( s u0 exnxo iydfatrlu ol( s2xrim no4omee fcsls artm( pno4openmoeiasfs2rmums t)aetoifcoytomt lieo ( srtoxmpoo4lmtn fci s s2tr(mp;u1olt mfeiltfaDuluvont0treomo3ootopteaueo;s0srtoxm ou4lpenlfvsa(farrrx p;t1tpxnio3tasfaDra( sn(0tltoxr3totfaDe neo;s)s2tmxr3oodomte ieia(f rua(m no1opxn oeiydla2rmn p;(4teenmrcty1fpDe neo;s tetm(rpou1am nlfct s sDuaxmpou0oeeomoctlslmDrmn p t4 ltrxr todopD lueo s)trto(mpnu4ope  fcia(f 2raum ;o4tlen o3iltlm um(mpn() lerircoo1fpD lnvols  exr(r oo1ll e fvtlt  Drmx ont1texo ocild sDeluvsnu0alxomo iadlpDelueilt  rxr(opoodlpt lfvilsf rtr( ont1alenmoctydfa rl( pnu4 rxoif3totomtelneo (0sruo(m3ny4ome mnct ( srtm(m no1openio3tltls2uauvp u4treoxo3ty1lpDeln il(  etrirpno4om  lfcsls)srta(m oo0optnmfeiydfmDrluvpnu4 ltnxf3oydfm eauei t)t2xoio3oy4al elietltfa2rmx ont1olt if3iatfa eauvont)a
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;s s2toir3nu1lpen fct (farta( o;u0opeomociydlm2raumont4alxoircta1lpteaneo s0texrimpiudopenlfvtls srraxrpoo4teeoii3tydfa umuvsn(4altoxrctadfptrli i s  2tmio3iodoleelivsl( arumuro;u1oetn o3iyt s2rmuvo (4 exoir3oatfat  i i;t0setrim oy4lm nlivt t)aDrax onu1olx moeiltla2uln sn(0 lenxr iytlpDe i i t seumxm oo1olte nvi ( arrm(mo;t0oleoifctlt aDuln p t0artnif3totlpt  uesl(0s2toxmpio4ol nmncsa(fsDrm(rp;t1tltnmocils s2umnmp;t0 rtoif oytopt anvolt0 2uoxo3oodoltnmfvsl()aDurumo;t4teenmieiadfs uauvs;u)tlxnxrctotlmtelnes t)srxo(mpiu4amen feiatfarrr(  no4apxnmociaslaDua(vonu)trenxr tadla  auesls0s2toir ny4ol emici tfaDraumpnt1opto fetas mDumumon() etnmocootlpte u il( sruoio oydameelncsatf 2uaum nu4aexo oetysfm2rlnms t0 renmo3to1omDrauesl(0 rtm(mpou4amt  netls arrr(rpoo4tetnifeild aDrm( snt4texrxociotfaDrluvs;t0s2urim3iudap emiet () rtmxmpno4tpx ifctadls umu s t0tetnmocty1lmt  nvslt)texmxo3iudlpenmfeia()aDuaumonu1tpxoioetat a2uanvpnu4tetoxo oo1omtraueil()setm(o3nu4op emnci ( s2tmur nu4tlxo fcilsfa2ran snu4 rtoiociatopDe nvsls0s2urxopny1aptemfetl()s2uaxr nu1alxnmo3iltfsDranms u0 renirctydfa ean o;()srtr(o3io1omenmncslt sDrax  oo0oet mi3iytlm eanvo;(0tltnio3tytfmtrlivolt0s2xr(rpnudlm   fcsa(fs2tmxmoou4teen i3iatla rmuvp u4 eenirctodfmD  u o ()s2xrir iu4olte nvia() rrmurp;u4apt  o3tasla ulnvp (0trtrif3iatop r n ils)trto(opou1am nmiet sf Dumxmpou4openmf3iyd m2eluvp (4arxrmrcoatomt aueols)teuoirpny4ap  liciasfa2tr(rpnt1aeenifctldls2ra(vs;t0 lxrmf3tadfate nes;s0t2toirpnodol  lfci s a2ra( pot0tpto ieiyslmDrlnmp u4tetnio3tydfmtraues;(0seumiopio4amee nvt () Dra(mono1ole  f3iltlaDea(ms;(0areomr oatop ranvo ()s2tmxo iu1opte nvsl(f Dtru  ou0oet  octytls um(vs (4aetrir ootlatr ues;(0trtmxr iy4ol nlieslt) Dtmu  ;u4teeo ieiys a eln s (4alermr oadlm rluvsls) 2xrxo ny1aptn fetl(  rtmx pou4oex mfctlt mDeanvs;t0 rxnif3iodlat aivi ( s2xm(r3oy4apenlfvsat aruaumo;o0tetn feiaslaDrl(ms u4 exoxfcto1lmDeauvi;() eurio3iy4ome mnvils  2umumo;o0aetnmo3iydlm2uan sn()tlxoircoadlpDrai s;(0tetrxrpoudom elnci s)aDurxmpno4ole ioeiyd s el(ms;t)artrirciydomDraivo;()trtmio no4aleelivs tfsrtrxrp;t0optn fctlsfaDel(monu4aeerxocoytlp   nvs;s setr(rpno4amtemfvs t aDua(m ot4oltomoctldlm2rlnvpnt0trxnxfcoatfp rln olt truoir3iu4amen ivtas)s2urx oot4tetoifeiys mDrmn s t) leoxo to1opDraivsl( t2xmio3no1amtn ies (faDtmx ooo1texn ietadlsDumn p t4 reoirctadfat  uesl()srtrxm3iy1llen ieilt a2rrumo;o4alx  o3iydfm2rm( snt4artnircoodfaDeln il(0 2toir ou4lptelicsa( srua(r ;o1olen fciasla eanmo u4aetriociadoptrlnesls  2trxopoydam   fviat s2rax p;o4teeoio3tltfs em(vont0 ltrmr iytlmtrau s;t trxrxrpoo1al elivt (  Dtru p;u1tpeomieias m2eln p;(4 eenxrcta1faDr u o s0 2xrimpou4lmt  ncsa(fs2tax p;o1apxoiieildfm umumont0texrxo oatopD  uvi t)s2tm(m iy4al   nvt s)aruru  nt4tlxnmicias a2ea( onu4aeenxf tytlmtrln s;s0setrxr ny1omt lnvtlt s2raump;t1alen ietad sDulu s t4tlxrif3oytopDe ieo s tetr(o ny1ale  ivtlt arua(  no1opxomietatfa2elumsn()arerxr3totfmDe uvsl()texrxm iodlm e fvt sf rum( o;t4ole ii3tld m uanvp;u) lxnxr totopD lueo (  2trxm3oydlle mnci tf Drmxr no4oltoii3iatfaDea(vs;u0aeerir oytopt auvi t)sruo(o3io4llenmneslt sDrrumpnt0olen oeiyt s eanvpnu4 rtnmo oy1omteluvsls0t2xmim nu1opeelncia(fsDtrxroou4tltoifcilslsDelu s ()aetoio3iotlp e uei;s0 etm(m3nydap   ivsat)arta(m ;t1oetoifetldlm emu sn()teerif iydlpDeaneils0tetmio3no4lp nlfciasfaDrmxrp;o0alenmoetldla el(vo u4tltnircoo1fpDraies ( teuo(r no4om e ieia( s2urxm nt4tptnifciydfmDum(msnu0 eeomfctatfmDraieo (  etoxrpoydape  iesl(farraxm ;t4altnmociytlaDuauvp (4alxnxocoatlm eaivo s0 rumio3iu4op emnvil()s2tr(r ;o4tleo f3tytlaDrluvon(0altoxocootfp eanvi (0 2toirpiudapt  nvsas)srrmum ;t0oet  fctysfm eaumo u0alxoxf iytopte i i;t) eur(rpnodop nmnesat)a2rr( p;u0alxomocilt a2uluvp;t0 exoxocoytlpteaieol(  rumirpoydaptemfetlsfaDtaxrooo0tle mf3iysfaDrm(vpnu0 rtoir3oodlptean i;t  etrimpnodop nlnes t)arraxr no1opeoifeias mDel( s;u)alxrio3to1laD ai ils  rurim no1ale  fctls  Drmxr ;o1tlxnmociad a rln s;u4 rtrxrcia1fm rlnes s0 2uoxmpoodom e netasfarumum ;o4tpx if3iytla2ul( snu0 lerio iotlpD li ols0srxo(o3iu4lm e nvt ( srtmu onu1alx  o3tlsfmDea(mo t4 ltrxo3oa1oa  auvol(0s2xoxo3nu1lmtemiviat) Dta(moou0oexn ociltfm2uluvs;u)aeermo3tatfpt  neo;t0texmimpoydoptn nesl() Dumxronu4tee if3ildfsDum( on(0tltoircto1lmtrau ol( trxrxo3ou1om e ncslsfsDuaxr ;u0optnifeilt a2ranmo () rxrircia1op  luei s)t2tr(m3iu1ol elivtas)s2rm(m nt0alx miciytfa2rmnms u0 lenmf3iydlpt  neo;(  ruoxrpiy4aptn ici () 2ra(rpot0olto ictlslm2el( sn(0teeniocto1la e ueils  etmio3oydlme  fvtat  2urum ;u0tpxnmo3iyt a2em(monu0aeeoircoa1fmDe i s;t  ruoxm iydlpenlfvtlsf rrau onu1oexn i3ild aDeln snt4 rxrmf iytfaDrlueo s) 2uoxm3ou4alee netatfs2ur(r nu1teto fetasfmDulu s ()trxnio3ootom raivols0texo(o no4aptnmivi t srtmx o;t0oex  o3tas a2ulu p;(0trenio3tytlptrln sls0seumxm3oodam n fei s arrrxroou4apt moetadla ulump;(4tltnxf3to1fmtrluvsls)s2trxo3oydol n ics (f ruax pot0tpeoiociadfsDel(mon(4 rxoxrciadfmD  uvsls0 euoim oo4al emfei s)s2trxmono1aptomi3tldla umnvo;t) rtrif3tydomDrli ols srtoiopiy1ll   nvs sfsDtm( pou1tet mo3tadls ulnmp;u0trenmr oatlpteai o;(0t2uoxrpno1ap n icsls  2urx  oo1alxo feiat a el( p (4alenxrciatoatelivs;s s2xr(opnudlptnmfcslt sDrrurpnu1ole ifciatla um(vs;t)trxnio3oatlmtr uvs s0srtoxopnodale  icsa(fsDtm(mp;u1altnioeiaslmDel(vs u0trenxo iodlm r uvi t  exrir nu4oltn fvils)arum(mpot1aetnii3tyd s2rluvo;u)aetnmf ia1oa eau s ( trur(rpnu4aptnmfeiat) Dua(m ot4alenioetasls rlnmp;t0 ltnxr tydom rluvs s)s2toxmpiu4am n ivtl()srurxrpou1altoio3iatlaDean pnt4arxrmo3ootfp   nvil(0 rtoxopiydopeemfeslt)s2um(monu1tetoiictlsfs2ra(mo;t0aeerircoytopD  nvo t  rum(m oy4optelfctlsfsDuau o;u0oet iociyt m rauvsnu) lenir ia1fm raivi (  eto(r nydopenlfvs tf Drm(mpno0aeeniieiyslm2rl(mpnu4 lxnifciytomtelu s t seumxmpno1optn nei (f ruru ont4oeeomfeiytfs ean pnt4alerxr oy1fmDeluvils s2toio3iydaltnlivt s)a2tr(r ;t1apxnifciysfa2elumpn(0trxomrcia1la  li il(  2tmxr ny1lpt  ncs ( artaxr ou4aptnmi3iltlsDemnvs;u)tltrmrcty1fm   ivo t)s2umim3nu1lmtelfes sfaDurxmoou0apxn ociadlsDum( pnt0 ltrxr3iodlmt anesls) 2xoxr3ny4optnlivtas)aDrmu  nu0apt iociys m ea( o (0tltrmr ia1oate u s t0 etr(m no4llt  ncsatfs2tmxmooo4oltn ieiydfs rmu p t) rtrir3oydlate nvo;t srtrir oy4lp n nvils s2um(rpou4apxn o3iyslm2ea(mo;t4teenxfcoo1fm e n s;() euoxrpnu1lmt  fvi t sDtm(r nt1tltn oetas m umuvo;u4aexoio ia1la  luei (0t2xr(r oudlp  lnvt t) Dtrumoou4olxoifeiydfa ranmp;u)alxnxr3iotfmtelues t) rurxm nodamtemnesas sDtmu pnt4aeenmi3iyd a2ea( o;(4tleoxr3iadoa  li s;t0srtr(o oydomtn fcs ( srurxm ou1tet ioctydlmDra(ms;u)trtnxfcoatopDraivilt teur(m ny1lm nmncil(f rtrur nu1tet moeiatfa el(msnu0aeeoif todfatrai ilt)seurir nydlmte icsat) 2taxr ;u1tetn i3iltfm2uan s u0arxnmfcio1la  livs;( t2xoxo nu1optn icilt)sDurxrono0tle  oetyd m2el(vp t4altoxr iodfm r ueo;t)trtm(r3oo4lpeelncsa(fs2rrum nt4aptnmietyd a2rm(vo;() exomf oodfa  luvsl() rxr(o oudlm  mivsls sDrrxmpou4optnmi3iatfa rlnvpnu)tlerxf3oadlateliesl()t2umio iy4lmeemiet s aruaumpnt0oex mietatfm2ua( snu0alerif tydfmDr n slt0 euoiopoy1ol emfvil( a2ra( ooo0tle iietaslm rmumpnt4 renxo todop  aieo;( srtoxr nu1lme mfvs s  2ur(m ot0olenifciyt m2rluvp t)tetnmf tytopDraneol()sexm(opny1aptnmnct t  2urur ;u4oetoioetydfa em(mp u0areoxrcoadlateauvs;( srurio3iydop   ieslt) rurx  nu4aleo i3iatfsDran onu4trtomr3oadoatr ies t) rtmxr3oy1ol   fesltfaruau  ot4apxo fetaslm eanmp t)teenif3iatlm eaivo;t  rtr(m3oy1ameemivta()s2taur nu4opx mi3iatfsDrln s;t4areoxo oydopDeli o t)srxo(r3io4alte ncsas  2uaumpnt1tleo f3ilsfs2rm(ms u4altnmfctydom  anvs;s0 2toxm3ny4apee icilt sDta(mo;t4oeeo f3iltla2ea( s () rtnif iotoaD ai o;s  rxmxm3oydlp emnvil()sDrax pnt0oet  oeiydfsDra(vsnu0 lenircoa1fat li ols)srxoir3iydamt  netat  Dtmu ono0alt io3iadla2el(vo t0 ltnxo iodoat  ues t t2trir3no4apt mneilt)aDtaxm ou1aee ifctlsfs em( s u)arenir3iy1lmDeliei ( srtmxm3no1aleelivslsfsrrr(r oo0apt ifciyd s2eau pnu0 rtoxf iy1fp r i o;s0sexm(mpnydllte ivi tfsDrm(mo;t1ale iicildfa em(mo t)texnxo iatoaD aueilt trxrxo3iudomtnlieiat arumur oo4apeoif3iltfs eluvp;() eeoifciatoatrlu i;s teto(mpoo4ap nmfes s  2trxmpnt1olenii3tls aDrm(mo u4aeenmf3tadoa eauvs;(  2ur(o3iudlm  mfeia(fa2ta(monu0olenioeiasfm eau pnu)aeeoir iadlmtr n ilt  ruoimpnydomtnmies (  2ta(  no0altnmf3tydfmDelnvs (0 lxoxo3oa1fp rli o;s s2tmxo3nudal   fcsl(faDtr(  ;o4apeoif3iytlmDul(vo;u4aleoio3io1laDrlnvsls s2xmim oudom   ieiltfs2rmxrpot4tpto oetlt sDua( s ()alxoxo3oo1omt aivs;s0srumxo nydoltn ivs ( s2umur ou0oex moeilsfa2rmn p (0tlxrxocio1lpte n il(0truoirpou4am nmnvta(f Dtrumo;o1aptomociytfs2umuvsn(4 lermf oodlat  u o;t) etoir3oo4op emics s artm(m nu1alxoioctysfmDeau p (4aexrmr tytlm elivol(0 2xoxm iu1lle  icil(  rtmxr ;u0ope mf3ilsfa2rmnms;u4aexrmoctodfmD  ueo;t)t2xr(m3no1lme mnvtat a2rrx  nu4tpxoioctadfmDemnvont0aleoir3io1lateai slt0tetmxm3oy4omen fes tf rta(rpnu0aptn ociydfsDumn s;u)alxoxo3io1lm elu s;t)srtr(mpiy4op elfet (faDrr(mo;o4tet ioetyd m2ranmsnt4 reoirctytlpt lieo t trurio3ou1llt  net () 2ra( ont1aeenmfctldfs el( s (0altomf oadlmDrluvilt  rxoxr oydaleelivsat)s2rmx  ;u4tptniictytlaDra( s;u0texnmrcio1latrai s s s2toimpoydam e fesat)artr(mpou0opxoif3tyt mDumuvo;t4 ltrmo totfmDelueilt0t2xo(opiu1aptnmfci ( s2uaxmooo0aex mociatfa eanmo u4 rtrir3oodlm eaieils0tetoiopny1lpen fcta(  Dta(rpou1oexnifeiat s2ean o;t)artnmrcta1omD  u s;t)trtoir3nodll elfcs ()a2ur(m nu0oeenmf3tls s2rlnvp;()teenmo3iatfmt aivol(0 ruo(o3nodomeemfeta()s2rau ooo1altnmo3tysls rm(mp (0tltoir3tatfmtr ivi;t trumxm no4ape  nesltfsrtrx ont1apt  f3iydlmDrl(msnu0 renir tytopt aues t)s2xmiopiudlpee icsls)arrau  ot1aet  oetasla2eauvs;t) lxnxf3todoa  lueilt0trxmirpoydll nmnet ( arrmurp;u4tpt ifctadls uan s;u0 rtnxf ia1fatr uvils0 2uoxm iu1lpenlivi s)aDtm(m ou4oetn i3ildfmDemumo;t) etnxocoadfm rln olt0 ruo(r oodapen nvi sf 2umurp;t4tptnif3ilt m2rln snt0trtoir oodlaD aiesls0s2tmxrpoy4omtemfctls srta(mp;o4alt ii3iat a rm(vo (4texrir3iy1om  liei (0s2xmxmpno1ol e ivsl(f Durum oo1tltniociltlsDumn sn()alenxf3todoat lneilt)teur(opnu4opt mfvils srrrx pot4olxnmf3iyd a uan s;u0altrircoa1oateauvo;t) rxm(m oudolt  fcsl() rtaumooo4texnmiciadls uauvont4tleomr oydlaD li s;()s2uoxo3nydlme mncia( s2umumoou1tlenmictadfa ra(vp;t0 eenircootop e ieolt trtmimpnu4lmtelicsls) Drmu pno4alx iicilsfaDeanmpnt4tlerifciydfatr i o;t trurxopoodamt lfcia(faDraxr ot4tptniocildfsDrluvo () rxnio3oadoaDrluvi;t s2urxmpiydlm emietatfa2um(r ;o0oex moeiytfs rm(msn(0 reoiocty1lmDranes;(  etm(r3io4am nlnvsat  rtrxmpno4optomieilt m rauvs;t0aexrxrciy1lpt lu i t0 2toio3oy1lpe livtlt  Dra( pno4apx moeiasla2umuvo;u) lxoio oodoa r uvol( texoxr oo4lm   nctl()a2tr( pno4teto feiasfm eau snu4 rxomf tytlaDr uvs;s0t2urir ou1apeelfctls)arrmu poo0tpeomf3iyt a2uauvpnt4 etomf tydlpD  nei s  euo(mpoudapt  nctat)s2ur(rpot4apenif3tat mDeanms t0 exoxr3oo1fmD aivo (0tetoxopnu1ame  nctatf Dtaurpnu4alx iiciydfs2uau p;() ltnxfciytom e u o (0teurxm nodal   ivilt)srur(rpno1aexomocias m2umuvs;u4tlenio3ia1fpt  nei t)seto(m3nu1al  lict (fartrx p;o1tlenmi3iyd s eln p;(4alxrio3oytfmteanvilt0 etrxr nu4omtn ietl(farra(  nu4tee mfcias aDul(mp;t4aeerircoytlptr n s;s0sexr(mpnodole lfci tfsDrmxr ot4altniictad m ea(vpn(0 lxnmociytfateau s;s)setoirpio4lmtnlictat) 2rmumpnu4aeen iciasls ranmp ()aetrircoytla raueo;s)t2xoim3iy4alee feil()a2tau pou4oexnmo3ildlm rl(vp;(0aexrxfciatlpDeauvo s0 rxr(o3io4op elfvsatfsDrmxrp;u0oex  octyt a2emnmon(4 reoir oydlateanvs;t srumio iu1altn neia( sDrax p;o4tlxomfeiatfsDua(vo t)tlenmr oadoa   nvil(  rtoxm iu4ll  mnctls)srurumpou1alxoiieils s2emump;t)
\ No newline at end of file
@@ -0,0 +1 @@
+uvs t0 etrir oodll elnvi sf rumx  ot0apxoifctlsfsDrm(vonu) leoxrcta1fmDe nvs;()sexrim oo4lltnlfvia( sDrmu p;u0tlxnifciys aDea( s;t) leomo3tatlp rlnvo;t  2trxm oy1lpe  nci tfs2rmumooo4aexomfciytfs2rmnvont) rxnio oo1omtr ueo;t) exrxrpnu4ll e fetltf rrm(rpou0oeto fetlsfa2rm(mo u4trtoxociytomt  n sls t2tmxopiudom   icils)arraxrpnu4tlxn icild a2rlu s;(4arenmocto1fpDr ivs ( sexrxm iy1omenlfvil()aDraurooo0oltomo3iadla ra( s u4aetoif3oa1opDe ieolt) exmxrpoy4ope lictlt)a2tmum ot4tlt mo3iasfa ulumo u4 rtrio3oadfmDrlieo (  rtoirpiy4ll   ieil(faDrr(rp;o4apt ioetaslmDuluvp;u4 leoir iotla  aueol(0 ruoirpiy4lpen nvsat) rrrx pou1tetnmo3iyd s2ean p t4trxomo3tadomDelnvo t0seuo(opoy1aptn nes t) Drru o;o1opt  oetad s2ea(msnt0artrifctadlpt aueo t0srum(r no1llt  ies t)a2ta(rpnt1tpeoif3tysla2emumo;t) ltnif3oatopDelivol(  rto(m nydom  lieslt  rtm(monu0tle  icild a ea(vo () eermociotfpt lues;s)setoxopiydam   ncil() Dua(rpnu0opx ifeiatlm rmn snu0tltomo iadopteaivo;s0trurxo nudal elivsasfs2rrur oo0oeeomoeildlsDumn s u4alxnifcoo1omtrluvi s) rurxm iudal nliei tf Dur( pnt1oee ioetyslaDeanmo;t)trtrmo3iotfp raieslt0s2tmirpoodomtnlfvsas sDtax  no0alx moeiyt m2eluvs u) lxnio iadomDeaieo t)texo(r3oy1ap nmivslsfarua(ro;t0teeoif3iydfmDrm(monu0 exomfcio1oatelnvi t0 exo(opoy1lm emictatfs2umu p;t4alx micild m2elu s u)teeoirctodla elueilt0 2um(mpno1al e fetat)s2rrxro;o1aexo oetys sDumu s t)texrif oydfa r uvs ()t2uoio iy1lpenlivtl(f 2rru  ;o4opxo fciyt a rmn s;(4trxomr3io1fmtean i s setrxo iu1ape lnet s) 2umx o;t4olenii3tyslaDua(mp;u0 lerio3oa1oaDrlieolt) rxmim3iu4ll nmnvsasf rtrxmpot1oexomfciyd sDrluvo;u4texrio3oy1oaDrlu sls  euoxr io1olt  ivsasfarrau  ;o4tetnmo3iys a rmu p;(0 leomf oytfaDelu o;t)s2xm(o3ou4lm  mncsatf rtm(r ;o0opxnmfciydlm uanms t0trtnif3iadlptelu s (0tetm(m oodaleelfeiat  Drmumpno1aptnioctat s2uanmo;u0artomocootfa  auei;s  2urxr3io4lmt lncta(fsrtm(mpno1apenmoeiadlm rln s;u) eermo3todla rlneo t0srurxrpoy1amte fes (faDtrxrpno4optniicildfa rl(vs;(4aexoiocoatomteaieo;t s2xrio nudlpt lfet (  Drrump;t0aleoio3iys aDelu pn(4 lxrxrciydfateluei ()t2xo(o nudlpenlnvia( artr(rpno0aeeomi3iltlm elump;(0texoifcoatlaDeanei s) 2xo(o iudomt  ncsas  rrm(m ou0oeeoioetasfa2um(mon(0aetrxf iadlmtrai s;t  rxoxrpou4lltnlnciatf 2taxroou0opxomiciydfsDeln p;(0aetoxf iatfptrli il()trtmimpiodam emics ( srtaumpnu0olt iieiys s2uauvs;u)tetomo3iy1omtrlivo (0s2tmxo nu1oltnlivi (fs2ur( p;o1aeeo oeiysfm2uaump (4 eermf ootoatelnei;s0 rxo(o3ny4alee fet s)s2ra(  no1optomieiatfm2rm(mp;(0 rtnmf ia1oaDrlueo t)texo(rpio4lleelnvtat sDta(  ;u4aex  o3iltlsDum( p (0trerxo3io1fmtrln s;(0srtr(rpny4oleemnvilt)a2taur no1apenifeiad m uauvo;(4 rerxr ta1fa raies;t0 rtoimpio1lpe  fvslsfs2ururp;o4tltoioeild sDraump;(0trerxr3oa1fm r n ols) eumir3oo1ame mnvsls)s2uru o;o0tleoiietlslm2emuvo u0arerir3io1omtrau i;t)truoxo oy1open ncil(f 2urxm no0aet iociatfm2umumsnu)aeermo3oy1omD aivs s)s2to(mpno1am e nvtlt) Dtaxmp;u1alx iictysfm2uln snu0tlxnmo3oytop r u il(0 etr(m oudol  lics t aDtm(root1optnif3iadlmDem( p u)arxoirciadopDrli olt setr(o3iy4ame  nci t artaxroou0texnmocildfa2ulu pnu) exnmr tydop   u sls srtr(o oudll nlneiasfaDtrxrp;u4alt iociasfa eanvo;u0tetrxocoo1fp elu o;() rtoxr3iudal  lfvt tfaDua( pno4tlx  o3tltfaDumnvs;(0tltnifcoa1la elu sl( trtrxm oudlm nmnet tfsDuaurpnt4tee io3iltlm2ra(mp;u4tleoif to1oaDrlneils srurir3nodlmtnmnvsa(farrmu pnu0tpxo fciltfs emumonu0alxomf3iytom  liei;t t2uoxm3iu4lm  mnvilsfarur(  ot0apxn oetyt s uluvp u4aeermr3totfaDe ivo;s s2xoxm3io1aleemnctat) 2raxmoou1tpx  o3iyd s2em(mo t)tltoio3oo1fp   ivilt)t2um(m3nu1lp   nctat)s2rr(moou0aee  oetat mDea(vo (4aeenmo ta1fm  an i;t) rxm(m no1lm  mfvias a2umx oou1tleoif3tas mDean p ()teeoxociotfat  ivs;() etoxo iodalte fcilsfsrurxmo;u1opx moeiat m umu p;t0aetrxo3to1lpD li s;s  2to(m3nudlpe miet t)sruau  ;o1openmoeiyt mDea( snt0alxnxr oadopt aivo;t0teurxr3ny1lp e icslt sDraxr ;u1opx  ictlt s2elu ont)trxrmfcto1lmte ivol(0trxm(o3nudamtelnctls srtaxrpnu0alen oeiyd a rluvs;(4 lxrxf3iydlatraivo;t)srto(opiudoltelivtlt a2rr(mp;u1texnmi3iat s2el(ms t0teenxo3iatomt livs s trur(opoo4lmenmneilsfs2raxm nu4apx moetas m rln s;(0alxnir3tadoa rln o;s)t2tmim no1omeemfctls)arrrxmp;t0tetn ieiasls ra(mpn(4tetomfciotfp  luei s0 2toxo oy4omt  fvtat)srumxmpou4oet if3iadfm ea(vpnu4altomf3tatfaDelueo () etr(opiy4apee ivia( a2ta( ono4olxo feias s rmnvs;t0texoxo iotlpDrauei ()t2xm(r nydop  mies tfs2tr( pot0tpxo ieiad m2el(mon(4 etomr3ia1fm eli ils0texoxr iy1alte icsl(  2tr(  nt1opx  i3tad m2em(ms t4teermf ia1oa eliei s sruoxm3oudom e icta(fs2uaxmoou0teenifetatls2rlump;t4 etoxrciotfat lneo s)s2trxrpio4ale micta()artrum ou4tlt  icias sDeanvo (0 rxrmrcoy1omDrln o;t) rxr(mpiu4apt  ieslt  Dumu  nu0tlenmf3iyd s rmuvs;()artoifctatomtrauvo s  eumimpio1amtnmfcs tfsrumu  no0teto fctldls ul(vs () etrmrctatfmD  nes t sexo(r3nudoltelfesat  2urumo;t1olenmoeiytlsDrmnvs;u4 lerxrcoytfa  an slt) etoio3iy4op emfcilt)s2tmx poo1oleoifcilslm raumsn(0 eenir3tytomtraieils) rxo(o3oy1llte ncsat)s2tau p;o0oexn ietadls2eanmsn(4artomo3ootomDeluvilt) 2xr(m3nudal  livi s)srurur ot1tpxn ocild s2ra(mp u4tlxomr3ootfatelnei t  rto(o3iy4apee fciat s2ua(root0alxomfetltlm ea( onu)tetrxrcoydfaD auei;s  exm(r3oydlpeelnviat)aDtaur nu4texnifciatlsDem(vpn()aetnifcto1oat aivsls) rtmim3no4lmt lnci ( artauroot0open o3ias s2rlnmsn(4 eeoxr3oa1lmD livo;t s2trio3oo4am  lncsatfartmurpno0alt mictltfmDumuvs u4 eermf3ty1fp  ai sl()t2xm(rpno1ope livil() Drru  ot0aexniiciydfm uan p;(4alenxo3ta1lptelueils  exr(r oy1lp emnvsasfarum(m nu4tpenmf3iaslm emnmsn(0 rtrir3ia1omteluvo ()t2to(rpnodoptn feiltfs2ua(monu1tlt ifetysfm eauvs;t0tlenmf tatomDrlnvs s)sruo(mpoo4ape lnctat  Dum(  oo4tlxnmfctadfa2um(vsnt) rxrirctadom e i ilt)trxmir3oydolt livtat aDrax pot1olx mociasfs2um(vonu0teenif3oodoaDeai o;t)t2toxm3oodom emict tfs2taurono1tptoiieils s2ulu p (0 exnmocto1faDe ueo;s seuo(opny1olt lfvia( sDra( p;o0tetomfetatfsDuau on()teenif3ta1opt  ivilt s2xo(r iydomtn ncils)srrmuro;t0opeomfctysfsDrlu s t)arerif ta1lmt anvs t s2xm(opiy1op e neslt  Dur( pou1opeo o3iltfaDrmn p;()tetrmfcoadla ran il(  eurim3nu4ll n ivsltfsDtrx poo0aptomietyd s2rmn o (0arxrxf iadfmtr iei t  etrxm3iydaptelfcslt) 2ta(mpoo1oeto fetasfmDulnvp u) ltnxf3tadopD  i s;s) exrxmpiu1al  lnesls)a2rrum ;o0oeeoiietydfs eauvsnu)arenif ootlm rlivs ()s2xm(rpnu1lm emnvias) Dtrumpou4tleniieiytlsDrmnvpnt0altrmocia1la r nvi t0texoim3no1oltnmfeslsf rra(rpot1apenio3iasls ean pn(0aetomf3iodlp e iesl(0sexoxmpio4ap  mnei sfs2urxm nu4apen i3iasfa eanms t)teenxr3iydla   nvs;t0texmxr iudamen ncil( arrrur ou4oeenmietyd s2el(mo;u4 lxoif3iatomDr uei t0 2uo(opnydal nlncslt)s2umx  ;t0tpeomocilsls ea(monu)arerir ia1lmtr uvs s)trxr(r ny1al n iesls)arrr(rp;u4aeenmoetld m2rauvp;u)arxnxf3iytfa e nvsls) eurim nodal  mict sfs2ua(mpoo4aleomo3iadfs2rl(vsnu)aetnxr ta1fateaueslt trurir iudlme  ncia(fsDrrxm ot4tpeoifeiltlm2rl( s;t) exnmf3tatlaDrlu s s trxrxm3nydlp n fcilt)sDuaxmp;u1apxoifetyt sDemu p (0tlermocoytomD luvil(0 2uo(r nu4ol  mncsl(f rraumoot4openmiciad aDranmsnu0trxnxfciotfmDe ies (  etm(rpiy4lmte net s sDta(m ;u0tpe io3iltlm raums;t4trenxo iydoat lnes () rxo(m ou4olte fvs ()a2um(rp;o0aeto feiltfm2emu s t4tltnioctadfateauvslt seuoxrpiydalt mnvtltfsDraxmono0apen ociat m2ra(vp u4 rtnxf to1fmD  ivils0srtr(o no4omenlfvs s)a2um(ronu0texnmfeiasla2uanmpn(4 lerir3oodomDeai ilt) 2toirpiydolt mfvta(fsrua(mono1olx mfeilsfa elnvs u4aexnxo3oy1opt anvo (0srxrimpiu4lm n iv
\ No newline at end of file
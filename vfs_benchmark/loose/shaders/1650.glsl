@@ -0,0 +1 @@
+ieo;t sexrir3oy4lmee ncs (f rra(mpot4aexnmo3tyt mDem(vsnu)aexrxr tytlp raivs ( sexmio io4alenlivtls sDuaxroot0tptomieiltlm2uanmp;(4tlermr iy1fate i ols)srxmxopny4omtelneiasfartrxmo;t4altniicildlmDum(mo;u)trxoir iodfm  an s s s2xmir3nu1optn iei sf 2trxrpou4texoiicils sDum( o u4arenmo io1faDelieo;s)srumimpoy4altnmnesl()sDtmumo;u1oexomicild a ul(vo;u)arxnifcio1fmt lnvi t0 2toir io1alte ivtatf 2tmumpnu1tle mociydfs2ranmo;(0artoir oytfmt  ivi;()seuoxm iy1ll  lfeslsfarra( ooo4tlt  oeiadfa rmnvsnt)artrxf ootlmDelivo t) 2tm(opnydlp elfvilt a2ra(ro;u4opxoiietld sDuaumo;()aetnmr iytoateaivolt0 rumio3iodlpe lnvt s  rrm(roou1aee ifctas m2ea( p;u)tlxnxr3ty1fmD lnvol()teur(rpiodaptnmieilt arurxmp;t1opt  fctyslmDuauvs u) lxnmfciodfa elneolt) 2ur(r3oy4lp   netltfsrra(moot4tpt  i3tydfmDrluvpnt0 rxnio3iotlmD aivslt0 rur(mpou1aptnlicia()srtr(r ;o0olt moeils a rl( o;(4tlxnio ty1om e neils) euoxm no1lleelictlt sDrmu ono1teeoio3ias m rluvon() rerxfcoadlptelivsls  rxr(m ny4omen iciasfs2urum ou1aee mfetatlaDul(mo u4tetrmr3oodfp rli o (0 eurir3oydolt mfviasf 2taump;t1aeeomf3iys a2ul( o ()teeomo tytfmteaies t tetmxrpoy1ap n ivias srtru  ot0texo i3ias a rlnmsnt4 exrmr3to1opte u s ( sexrxm3io1ll emicsas a2urx poo0opx  o3tyd aDuln ont4tlxoxf3ootlptr nvo s)t2xrimpnudapt mnvilsfsDtrxm no4opt  fctldlaDul(mo;t0arenmfciy1fptrauvs;t trurxr3iu4lpee fvs s s2umu  nt1tet mfetltfa2uanmp;(4alxoir iodlm  li s;t) 2umxopny1aleelfci tfarumum ou1teeo oeiat aDrmn pnt4 rermrctydfaD  neslt  2um(o io1amt mfvtlt)sDtrx pnu1aex if3ildlm rluvo;t0 eeoif3oytlateanvs s0teumiopoo1oltemnci (f 2uaxmpot0oet iocildfm ran pnu) reoxo iotfmtelnes;s) ruoxo nu1lmenlneil(faDtax onu0opxnmieiltfmDua(von(0tlxnmo3todlpt lues;(0s2tm(r3nydaltnlnetls)aDra(rpnu4tetnifetatlmDrlu o;()tlxnio3oatlm eai o;s srum(opnu4op   nvs sf 2rruro;t1oexn ocildls2ra(vo;(0 rtrifcto1op r ivo s0srtoiopny4ope mics s)aDraumont4tlt  f3tldfm2rmumpnu0altoio3oatla rlnvslt) 2tr(o3oy1lle lncsa()aDtmu  nt1teeoiictydfsDelnms;u0 ltomrcoodfmtrli o;( trxmim oy1ll emfctat aDrmu  ou4opx mfctytla2el(vs t4 rtrxocia1lmDe nvo t) 2xmxopnodom n ivil(fa2ta(ront0altnmiciysls emu pnt4 rxoif3ootlatrli sls)srtrxrpoodome lncils  Duau p;o0ole ii3ild a rlnmp;u0 rxrmoctadla raiei;s seto(rpnodom   fvi tf 2uaurpnu1aetn icias aDrm( pnu0 renif oy1fmt  uvs ( trurim ou4ll elnetas  Drrxmont0alxnmi3iatfm2el(mo u0teerxo tatlp   u i t  rurxm no1lm nlietls)sDrmx p;t1oltn ociytlaDrmuvo u4 ltnmrctotoa e ieo;t  2tmiopoo4apte fvi ()aDum( pno1texn fcias s em( snu)tetnmf3totopteauvs t0t2xmxm3oy1lm  mfes (fs2urumpno1teeoifcildlsDul( on(0 eeomr3ta1omDeaiesls)setmim iy1ll emnvt tfa2tru o;o1oet ioeiydlm2eauvp;t4 exrmo ia1omD au sls0 rurimpny1lmeemnvtas a2urum ;t0tptn ieildfm2ua( s;t4trtnxr3oadoa   nvs;s s2trxopno1op  lici ()s2rmxm oo4aeenmoctad m2rm(vp;(4tlxrmo oydlmDr ues;s s2tmxopiu1ll nlneilsf 2tru pnu4texo ocias aDeaums t0 rtnircoo1fatelneo (  etoirpny1lltn fvtls arta(  ;t4oet mf3iadfm eluvs;t4 lenxf iotfptr nvo;()srtrxrpoo4lmenmnct sfs2raxrono4aexnmfeias sDum( s t4 ltoxo tytop e neslt s2xm(mpoydomt liet t sDta(r ;t1aptn fcils aDemu p (4teeoir ta1omDelivo t t2xoxo oudllt  ictas) 2tmumpno4apxn fciydfsDemumsnt4tlenio3io1oa  anvo t  exo(o oydamtelietat  rtaxmont4apeo fcild s um(mpn(0 lerifcoadlateai o ( seuo(o ou1lm elivtls)arrm(m ;o4texo iciydfa2emu o;t0trtnif oo1op ran i (  2xmxopnudlmtnmiesls  Drrxronu0texn fcildfsDua( s;(4arxnio todlaD anei s trurio3oydopt mfetas arra(mooo4oltnif3ils a2uln p;t)trenmociydlaDe ies;()teumxmpoo4lp  lnctls)aDtm(mo;u1apxoiociydlsDrl(vp t4artnif3iy1op eauvil( s2um(r3iodap elnesa( aDrr(rp;t4tpeoioeiltfaDul(vo u4aexnxfctydomDeau ils0tetmxm3oydlp elfvsls  2trx  nt1tpe mi3tltlm rlnvo t)aleoifciydfpD li ols)trurxopio4ol elneiat  Dur( pou0tetnmieiytlm rmn snu)aetoxf3tytlptraivs t0t2uoxm3oo1llee ivt () 2um(rp;o1opt  ieiysfa2emu s;u) etrif oadopt  n sls trurimpoudalenmnvias)aDtax pno1oeenmiciltla umu o t0 leoxr3iadoaDraieils  rxo(m3ny4lme lnctlt s2um( p;o0alt mo3iadfa2rm( snt)aeerifciydfa rlivi s0 exrxr3nu4lp  mieilsfsrtmx p;u1oet  ociydla ranvon()trxrirctydlpteln i t0sexrxr3iy1opt  nvia( srtmumpnt4aleomfciasfs rau sn(0 exniocootoa e uvi;s)trtrio ou1ap nmfvilt aDtaumo;t4tpt  ociasfaDuaump u) leoxr3iadfptr n i s s2umxm3nu4alenmneils a2umurpot0tet mictas m rmnmp (0 lxrxociatopDelu ol(  2trxo3ou1amt  fetls  2umxr ou0tee io3tldls2um(vo t0trenmrctotoa e n s;t srxo(m nu4olt  ivt s a2trurono1altnmoeiasls2umumonu0tlerxo3iodlpDelu s;s teum(m oo1lp emivsa(fs2rm(rpno0tpeniictys m ra( sn(0aetriociy1fa   ivi s)sexo(r3iy1lpee iesl(fa2um(  oo4olxo f3iysfaDua(vsn(0 leoxo3ty1oa   uvsls s2xoiopoy1ome lnvias aDraxmonu4tpx iociat a rm(mo;t0aetoir3ia1lm e i sl( t2tm(o3oy1aptnmietl(  Drmumpnu4oexo oeilt a ea(ms u4 lxrmr io1laDr ivsl(  rtmxo3iydlmt mneiasfa2um(rpou1aptn ociltfm rl(vo t)tltnmocty1fatrau ols0teur(o3oodol emneiatf 2rm(r nt1apx mieiad a rau s;(4teermrcoydoa  aueslt)sexr(o nu1am  mnvtas  Drm( ont0opxnmietad m ulu p t0alxrxr3iytfaD anvi;s0srxoxr no1am nmfetlt s2rmxm ;o0tpxnmf3iltla2ran s (4tlenmr tatla r u s s)teum(r3oodaleemnvsatf Dra(rono4ape  ictys m ul( o;t4aexomo oodfa r neols0tetrimpiodole  ieils a2uax ont1apeomfciytfm2rmnmp () lxoxo3iatfpD aneils0seuoir3oudlltnmnvta( srumumo;u0oexnifeiadfs2rluvo;u4 lxomf io1la raueo t0 etmirpiydomt  nvsls)srrm(  ;t0aeeomfciat m2uan o;()tetnxo3todlat  ieils0setr(m nu1lpe mictlt aDtaur nu0opeo fciltla uauvo;u4artomf iadlmDrlieolt0sexmxrpio4lle lncsa(fa2uaxrpoo4apx miciatfs rln p t)teermf oadlpteaieol()setmxo3iodop nmneiasfsDtmumpoo1oeto oeilslm uaump;t0 rtoif oo1fm ean sl()srtrxo3io1lmtn iesls)sruau p;u4oeen o3iys mDumuvs (4 eeoif todom r n ol()t2toio3ny1op n ivil( srtrumpoo4opeomi3ildls uanmo u4treoir ty1laDelieo s) rtmir oydlpt  fvia() Dtrur ou4tpe iieiys m eauvpnt4aetoifciadfmte ieil( sexr(m3no4lpen nes t)sDtmxmpnt4apxn fctydla elnmp;t)arxrir tydopDeaneo;t0t2uriopou1lptemiei t) Duau pou1tlx iictydfmDranvsn(0 etnxo tadlpD  uvi ()trxmir3nydlpt  nes (f Dtrxrono1olt ioctys a emuvp ()aetrxr tytfmtrauvo;t t2tmxm3nodlmenlict ( a2rm( pno4tlt mf3iyt sDeanvo (4 rxnmo oydlptranesls)srum(o3iu4ll n nvias sDumuro;u4altniictyd s2rauvpnt0trxnxo3iydom elnvsls)teumxr3nydaptnmfvils)sDtru  ou4opt mietldfs elumpnu0 lxnxf3tatoatraies ()s2uriopiodlpte feils) 2ra(r ot1ope  oeiydfaDemums;t4arxoxrcootlp rlnvs t0seurxmpiy1lmenmfcsatfa2trxmo;o0opeoioeilsls uaums u4trxnmo iotfm rauvils)t2tmio iu1omen iet sfs2raum ;u0tltn ociadls em(vs t4aexomrciadfpD  neo s0sexo(o iy1lp  mnctat srta( o;u1aetnmfetldlm2em( s t4 rtrmrcoa1oatran il()trxm(m iy4lp nlfet () 2rm(ro;o0tetn ociltfaDrmuvo u4 etoxfciatfpDelivils0 exoir3oy1omenlnvs (fs2ua(m ;o0olxoifctas a el(vs;t)alxoxf3oatfpD lnvol(0srxr(o oy4ol elivs (  2ur(root1oleoio3iysfaDean o;(4alxnxrciotfpD li o;t0trtoimpoo4apt lnei (f Durump;o4ale mfetadlaDumu sn()arxnxo3iatfpt  uvsl() 2xoiopny4lptnlfetlt)a2ra(rono4altnmf3iad m2ua(mp;u)trtoio todlaDrluesls0 2uoiopno4apte nvslt) rrrum nt4aex  o3iytlaDemnmpnt0altoxf iatfa eluvolt tetrxr oudapteliciasf rrrx  oo1alen ociyt sDulumsnt0treomrcoatopte ivil(  2tm(mpou4amee ivtl(f rrmuroot4aptniictytfm eanvsnu4alxrxo tatlpteaivi t0 exoxm iodome  nvsls)s2uaxmoou1apeomfeiatfaDem(mp;(4treoxr3ia1laDr ies;s0s2tm(r3iydalenmivi ()aDrrx  nu4aexoiociyd a rlu s u4alenxf tadom e u i;t)sruoxopnu4alenlfvi (fsDrmxrooo0tpen feiatls2ea(vs t4tlxrmf3iodfm  lu i;s)s2xmxm nudlpte ieiat  rra(mo;u0tex  fetatfa ua(mo t4arxnxr3oa1faDraiei t s2xo(r iu1ll emicsa(f Draum ou0aee  ictyt m2ea(vo;(0tetoifcoadoa eau o t0 rtriopou1apeemfvsls) rraurp;t1tptn fciltls eanvs;u0teeoioctatoa r ivo t)trxo(mpiudoltelietlsfa2ta(  oo4oltoioetltls2ra( s (4altoxf oydom  luvi;s texoxrpiu1lpeelicsatfs2ururpot4opt mieiyd sDrmn p;(0trtrmf3iydfmteaieol() exrxrpiy1olt lict s) rtr(monu4opx mo3iytla emumont) ltnxo io1lmt  ivi;(0s2xo(mpiodom nmfvsatfsDumx pno1aee  iciytla2um( s t)arxrxo oodoaD  n i t sexmxrpno1ol n fvs ()aDtmxrpou1aex  fctydfa rau snu)tlenmfciodfa rli sls  rtoim3nydopeelnvsat)arur( pou1ape  fctadlm rlu ont4aexnxf tydfaDeau slt t2ur(opiu1op emfvsas a2rm(r nt4aex iieildfs2ul(mont) reoifcootop rai slt srxr(o3oo4omt lici sfaDraumooo4altnio3iys sDua(mp;u)arxomfcoa1laD  i s t t2umim iy1ome lnvtas  2tm( poo0ole mi3iyd a2ean ont0 eerircootlmDraneolt0 rurxr3iodameelieilt a2um(mp;t4alen i3iytla2rlumo;(4 rtrio to1oa   u o;( seumio3ny4am nmivi s) 2rmu p;t4opt ioctlsfm2rauvp;(0trxoio3to1lmtrlues t0 rum(r iudam  lnvsa()a2trxmo;u4apx iieias sDeaums (4teermrciodom e nvi;(0 rto(m ny4lmenlncilt) ruau o;o4olxnio3iytlm2ul( s t4aleomociytomt  n o;( t2tmxrpnudal nlfvs sfsDtru  no1opxo iciat m2rl(mp (4 rtrmociatfatrlneo ()t2xrxopiudopenlfei t  Duax pnu1oex  ictltla ranvsnt0trtoir3iy1lm  ln o;(  rtmxm ou1lm  mfvsa( s2rauroou4oleniicils sDrl(von(4teeomfcoo1laD auvol(0sexoxm nudop e nesls)srrmumono0opeoii3tytfa2rln p (0 lxrir3totopDeanei;s0sexmxr ou4lpeelivils)arua(rpoo1oeeo oeiatfm2ulumont0aetrirciadfp ean ilt0sexo(opiu4lmt mnvsl()srta( o;u1apt mi3ilt m rmumpnu0 rxoxf oy1laDr uei (0tetmxm iy4op  lfvsasfaDumurpot0openiietydfm2um( s;(0aetnxfciotlm eau s s0srxr(o ou4lmen ncsa()artmumoot4apeomoetyd m rluvont4tlxnxfcty1lmDelivi;t0t2uo(r3iy1am   ncta(  2trumo;t1aexnmf3iysfa2rm(vonu0arxnxfcootoaDelneslt)seuoxr3oo1amee ieslt  2ur(rpnu0opx mf3iat s umnms (4 lxnxfcoadoa rlivol()t2urirpiu1optemfetl()arrmxr nt1aexoiieilslmDem(vp;()aexoxo3io1lptrau slt) ruo(o3no1olen icsa() Dur( ooo4ale miciasfa ra(mp;u0 exrif tytlaDe ieslt  exrimpiy1aptn fvs s sDraumpnu1oex ioetlt m em(vpn(0treoio io1fmDrli olt truoio3ou4apt  nesl(f Dtmumpot4oet ifeils mDum(vs;u4 exnmocoo1fmD  ieo s0texr(rpoodlm emnvtas srtrumooo4tpenmociysls2ua(vs;u0arxoxf ia1fm   ieo s)truoxr no4am   nvi s s2ta(  oo0alenmi3tlt a2rlnms;u0trtnmf3ootfmD li s;t t2tr(o3io1apeemiei t artmxrp;o0tle  ieiasla2emuvp;t0texomr iotlmtrauei ( s2urirpoy4omtn ics s)aDtm( oot0tpxn fciydfs2ua(vp;(0aexniociotlptrluvs t)seto(r oo1lpee neilsf 2uaxr ;o0tet mi3tysla2em( s t4treoif3io1laDrlieo (0tetm(mpnu4omeemnctasfs2uaxrono0tlt iociydlmDra( s;t0 etoifctotfpDranes;( t2tr(m3nydale mncsls  2rmxm ou1altoii3iaslm2eln o u)altrmfciy1fmt ai o;() exrimpiy1ame mfei s  2uaump;o0opt if3tas s2um( o;()texnxrcty1fa rlueils t2to(m3iydlltelivi s  Draump;t1alxoif3iytfm2rm(monu)tlenxf iy1oa  livi t) 2ur(r iydamtnlfetl()srurum no0apx mfetydfa raumo u)tetrxf3iytla   iei (0t2xr(opiudlmeelivt s)srrmumpno0tetnmf3iys a2umnvp (0teenmr iydoat  ivslt0 2xmxo nudap elfcsat)s2tru pno4ape if3iadla rlnvs t4aleoxocta1fpD aivi;s)trxrir ny1amt miei s  Drru o;u4ape  ieildfsDeau o (0tetnxfctytfat an ol()s2toxr iu1ameelnvil() rrrumoou0texo ieiytlm uanvonu4artoir ootlatraivsl(0teumxr3ou4lptn iesl() rrru oot1ape  octld m2ranmsn(4 ltoxr3to1fmDe uvo;t)sexo(m3no4lp nlnvslt aDuax  no4aex  o3ilsfm2ul( p;(4aexnmf iatfaDe uvi;s)t2xoxo nudol  lies (fs2trx  ot1oex  f3tatla2ua(vsn() exomrciotlate ieils texoxr ou1aptemnciltf 2rru  no0tptomf3tys mDel(msnt0 lerio3oadlpD an sl(0tetr(o no1ll e nvs () rrrxrp;u4ape mfetlsfa ra( ont4aexnir to1omDrlivs;s0truoim iodll n iviasfs2tm(mpnt1tex iieiat s emn p u) rerxo tatopteai o;s0trtmim iu1amtelivsas)a2trxmpno4tpx  o3ias a2umnvpnt)tetoif tydoa   u i t texo(rpoo1lpt  fesl(  2rr(roou1alt  f3ilt a2rm(vo (4alermrctatlaDeli o ()tetr(o3iodop elnesas  2ua(mpno0texnioctlt mDulu o u0artrxr3iy1la  au sl(  2trxm no1optnlieta()a2tmu  no4aex iociys aDuau o () etnxf3ty1omDrlnei;s0sexoim iodol emfvt t)a2urx o;u1tpxnif3iaslmDrlnms (4 lxoiocoodop eln i ()sexmio iydop n ivsatfaDrmxrpoo1alenifcildfs umnms t0trenxf totfmt livils  2uoxo3oy4opt lfvils  2taxrp;u1opxnifcilsls2uan p;(4trxnirctadfmD  ues t)srtrxm nu4lmt  fct t)a2taumont4opxoioeiasfs2umn onu)aexoxr3iodfm e ieo;( srumiopio1lpe  nviat sDua(mont1opxniietlslaDemump t)aetnmocoytomtr nei;s)t2tm(mpnodllt  ies () Drrurono0oetomo3taslmDrlnmont0treoxf oytoat  nvo;t)trxm(opiudom nlnvi (f rtmurpot1alxoifetadla ua(vp u0aexrmfciotfpDeliei;t0tetoxrpnydomtelncs s)sDrmxmpoo1optoiocildls2rlumsnt)aeenif3iy1lmDe ivo ()trxr(o ou1amtnmfeiasfa2tmx onu1aexoii3tldlm rmump;t0tlermf oatomt  nei s) euoio iodole lfvsa()s2rr(r ot1ole mfciyslaDea( sn(0 rerxo3oatfpte uei t setmim oy4omenlieslt aDum(mono1opx iieiatla uluvs (4 leoxr tatfmDrliei s srtrxm3ou4lp e ictl()arraxrp;u4tptnmociltfm2emnvsnt0altoxf3tytlpDean o;s0sexoimpoy1lmtelicil() Draum nt4opt  fctasfmDrmumon(0aexoioctodfat auvo t)srxm(rpno1amtnlfesatfartaxrooo0opeoii3tatlm2ulnvp;u4arerif oodla elu o (0s2urxr oo4al nmnvi () 2urur no0opt moeilt m rluvp;u)areomf to1lpDrli i t0trurir nudlmtnlfvia(fsDrr(m nt0tpenmieiyd s2em(vo;t0tltnif tytoaDelnvs;s0tetoirpiy4omtn feta( aDtm(ro;t1olxniieias m2eln o u0aetrxo3tydlaDe iei ( trur(o iu1alt  nctl( artr(mp;o1tltomiciasfsDum(vo u)arxoxo io1lp rai i;s) rxm(opiydapeelnvia(faDtaxmonu1alt ifeiys aDrauvo;u4aeerxfctatlmte ies s)sruoio3oydoptemfciatfsDrmx  oo4tltnmfctas sDumump;u0 lxnxo3tatop  lu ilt s2xmxo no1apeemnvtls)a2rm(mo;t1tle mfetysls2rlums t0alerxf tatfa  luvi;(0trur(rpiydomee icsat aDta( pot4aet moetadla2rm(mp () rtnmf iy1fmt aivi s t2toirpnodap nmfeslt srraxmpoo4ale  ieiadfs2um( p;(4tetrxo oadfptr ivi;s)setrir3oy1oleelivs t) rum( p;t1olxo oeilsfs2uln sn(0arxrxr oo1lmtrln olt)t2urir nu4lp n fcslt artru o;t0oee ifctys m umums;t)aleoirctadlm r n o (0sruoirpnudlp   fvs s  rtaur ;u0teto icilt mDemu o t4 etrxf iadom rlu olt0s2ur(m3oo1am elfeiatf Dua(m ;t1aexo icilsla ranms;u4 leoir iadfpD aneo t  exmxm3nodaptn feils srururoou1oetoio3iyd a2eaumon(0aetrmo3iytopt aies;t texoxo nudlpeemivsas)artmurpoo4aleomoeiysfm umn snt0alxrxf3oy1om e uei t0 2umio3oo1apen fvia( srua( p;u4ale io3iadlaDemu snu0altomrctadlm ranvs;(0t2xmirpoo1apenlict sf Durxr ou1tpxn oetls s rlumpn(0tetrxo3oodoat  ueo t  2xmio3no4ll elncias)a2rrxrpno0opeo ietydfs rmnmp t4trtnifciadfmtrlueol()t2xm(opiodom e fcta()sDtrxmpno0optoifeildlmDel( snu4 exoxr3oo1la  lnvs;s)trurio3oudomenlnes (  2tax oou4oex  oeiyd a rmn on(4aetomf iodla r nei;t0 etm(mpoy1amt lnviat)sDtr(mpoo1tpxnii3tydlmDeln ont4artnxo3ty1faD auvs ()trtr(r iudoptnlivi tf Drmx  nu0ole  ociad aDumnvp;t0 eerxr3oy1fm elnesl(0s2to(o oy1om e iet s a2rrxmooo1tptn ocilslsDuluvs;t4alxnir oydoa   nei;t)teurim ny1lm n ieilt)arta( pno1olt mociatls2umnms;(0 ltoxf tydfmtrauei;s t2xoxr iydalt lfesas aDuru onu0apxomi3tat s ul( sn(0tetrxr tydom ranvslt) 2xo(rpiydam  lnctlsfsruaurpot4oex mfeiatfmDem(mo;u4aetrmr3iodopDe nei;s) euo(opio1lp nlics s aDrmu pot4aexnifeiydls2rm( pnu0artoifcty1fatrlneol(0srur(r ou4am   nct ()a2urur ou0apxo feiytlsDra(vp;t)alxrxf oadfa raies s)texm(opiu4alt  nvias  Draumo;t4teeomfeildfa ul(mp;t) eeomr3iodoatrau o;t srtoxr iy4ap  mfvtltf 2trxmooo0texn f3iat a rlnmsnt) lenmr3iy1oa   ivo t0 rto(opoodll  lfcilt sDumx  ;o1aetnmoeias a rl(vont4 renifctotfaD luvi;(0t2xr(r ou4apt mnctlt srua( o;o1tlto iciyt mDrmu o;(4 etoxrcta1lm eauesl(  ruoir3nodal n ivtl( s2taum nu1olx mf3ilt mDea(mpnu)teermfcoy1fp eli sls0setoimpoydlmenlnetls)sDtauronu0tltoiiciasfaDemu o;u) lerxf3oadfmD auvo;s srurxopiy4lptelfcsl()aDua( p;t1alt mi3ildlmDuaumo;(4 exnir iatlaDrlnvi;s0 rtr(mpoydalenlnesa(f rtax onu0tlto fciys s2ulnvo;u4arenif iotoa eliei;( t2xr(r3ny1lpe mfvtatfs2um( pou4optomfcilt aDeauvo;u4altoir tydlaDe i i ( trxoio3oydom n iciatfsruauroou0opeo fetls a2umnmpnu0trxoif iatoaD lieolt  rtmim nu4opeeliet s s2tax  no1oeeo fciadls2uaump (0aeenxr3oytopDrlueo;t)s2xo(o3no4lp elfviat srrr( ono1oexn ieiasls2umu o;u0tlxrxf oo1fateluvsl() 2trxo no4lleemfvtlt arrr(r ;t0oee  feiytls2umuvs;t0aexnioctytfpt  nvol() 2ur(mpny1lme mfetls s2raxr nu4tptn f3iatfaDuan pnu0 rtrifctytlmtr nvi;t) rurir3ou1ll elncsat  rrrxmoou1tleoif3tad s2rmnmon(4artrxfcoatfpDr ivi;s)texm(o3nu4ll emfct t  2trx pou4aee ii3iad s2uaums t4 lxoxo3tytoat lnvo t)sexmirpoo1om elivt tfa2tmumpot1texn i3iltfsDeau onu4alxnircoodom e u i;s0srxrxmpoo1optelfci ()arumu o;t0ale if3iydfs ranvpnt0tetomo oa1oatelueols0 2tmxo3iy4alt mfvi s arrax pno4open i3tls aDumnvpnt) renxr3tatfpDelues s)s2uo(mpou4aleemnetlsf Dumx o;t1oexnmfciasls umumon()tleoircto1oaD  u i;s)srxm(opiudamtnmies s) 2uaum no4tpxomfeiytlm el(vo u)aetoxr iydfm eai s s0sruoxo3io4alenmivt (  Drr(mono1tlenii3tad mDrl(mp;u0 lenmf ootopDr iesl(  ruo(mpnu1lmtn icsltf Dtaur ;t1alt ii3iasfa uln o;() exnmocoodfpDran o;t  rxr(m no4al elfvtlt)sDurxro;o4alenmieiltlmDumnms t0tlxniociotopDr ueilt texr(o iodlltemietat  rtaur ;o4tlt micildls elums (0tlxnxf3iatla   ues (0t2urxm iydlptnmieiat  2rmu o;t4alx ii3iatfa ua( o;(0 etoirctydfatr ieo s0 2uoio iudolen fcslsf 2uru ont0openmf3ilt mDranvs;() exoxfciydfa  au s;( srxoirpnu4omeelics ()a2rau ooo4tpx mo3tydlm2rauvs t4 rerxrcoadoateaiei t0srxo(m oydameelfvtltfsrrmu  nu1aptomfeiydfm emn s;u0aetnir iatlmtraiei t) 2umxrpnudole mici s  2ua( ono0aleo oeiysfmDem( s t4tetrxociy1fp  lnes s0 2to(m3io1lp  mfvtls)s2rru oou4aex mfeildfa emums t0arenxf3iadopt  u o s) rto(o oy1ll  lncs (  2tr(rooo0tptomfciatfs rl(von(4arerxr todlm eai o t0t2trxr oo4amteliviasf 2rmu  nu4alt mfciyd a ulnmo u)tltrxf3ty1oaD ai i ()t2ur(r no1aptelnvt (f rtm(m ;o1openmoeild a rm(von()alxoxf3tadopt  ivi;s) 2xmio iudamtn ivsas)srra( onu0optn ieiasfa emnmo ()tltnmf3oydomD  ivi;t)texo(rpnu1amtn ncilt a2trxrpnt0alx mfeiysla uanmo;u4 eeomr ootfaD  ivi;(0 rtmiopiy1alte nvil( a2rrxroot0olxnmo3iytfm2rm(ms (0 etrmo todlp rluvslt  2xoxo3iodomt  ncslsfarrmum nt4teeomf3tltfm ulnmsnt)teerxo3totlpt  i sls t2urirpoo1lltemnet tfarrmum ou0apenifeiysfs2uln pn(0trenmrcoy1omD aneo s0trto(m ou1llte neiat) 2rrx poo1ale  f3iatlmDulump;t0tlerif3io1lp e neols0srur(o3ny1al n nvtlt)sDtau pnt0tlto i3ias mDuanms ()tlenmf3oadoate i o s0 exm(opnudome lfct sf 2rm(rp;t4oeeomiciaslsDeanmo (4aetrxf3iatoatrauvi s  rxoxr ou4amtnmicsasf rur(  ot0tpenmietlsfs2umu o ()aetnifciy1opDrauvs ( trtmxopoy1lpee iesat)srurx p;t0tptoif3ias s2rmums;() rxrxr iotfa  aiei ( t2ur(o io4lltemncs sf rrmurpnt0ole mociyd m2ranmo t4aexrxf todlmD luvo s0teuo(o3oy1omte fcils)arrm(m oo1oex  fetlslsDrmumpn()texoxf oy1lp ranesls0 eumim3iodal  lieiat a2rrum oo1alt miciydlm elu p;t4arenir io1om elnesl()trxr(opoudlm e fcs s sDua(r nt1oltnmfctadfm2el(mp u0aexnifcoy1op  livs;t s2to(m iy1om  mics s) 2rru  oo0aeenifciytfsDrluvo t) etoir3oatlpDraueilt  2xoir3io1lltemfes sf rumu pou4teen i3iyslaDrln o;t4 exrmr tadfmt  uvo;t) 2xoir3iudop n fet (fsDtr(rpoo0tle  icildls emump t)altomo io1fmtrlu i;( srum(o oy1lptnlncsl( srrm(rpoo4apenmi3iyd m2el(mpnt4artrmo oydoa e i o;(  etmir3io1alte ivslsfaruau oou1apxnii3iltla2rlums (4tetoio3oydfm r n i ( s2xmxm nu1omtnliesa()aDra( o;u1tpt if3iydlmDeau pnt)texoir oytlpt  ues;t0sexrxm3oy1am elnci s) 2ta(monu0oeeoio3iltfm2el(mo;u4 etrio ta1omDr uei t0 exrir iodllenlivsas arrmx  ot1aex moeild m rlnvpnu4 rtrxr iydom ean ilt0srtm(rpoo1ll nmfvtltfsDuru o;u0open i3ilsfaDrl( snt0 rermf ta1oateluei t0t2tm(o3no4apee nvtas  Dtm(m ;t0aeto fciadls eluvs t4 renmr oodfpD  uesls setmio3oydap nlncsls)a2ta( oou1tptomiciysfs ul( o;t4treoifciotfp rlnei s0truoxm3iydlpeemfctas)a2ua(ront1teeoiociytfa2eanmp;t4 rtoif3tatfateaivs;t sexo(o3oydal e fvsls sDtmxm ;t4tpxnifciytlaDrmuvonu)aexoifcootfat lnvo (0trurirpnu4ll emncia(  Drax p;t4tlt mi3ias a2em(vp t0trerio3oatlmt aneol(  rxoxr iudam  mfetatfaDrrumpot4oex mociytlm rluvsn(0trxrmf todfmDrlivils  2uoim iudomeelnetls)sDta(  ;u0oex moeiatfs rmuvpnu0texnmf ia1fpD ai ol()s2umxrpiu4lm nlictas a2uaumo;u1olxnmicilt a rmu o;u4tlxomf iatom rlivsl(0t2tmxr3oo4amte icias  2ra(m ;o0tetn iciydfmDumu o u) eerxf ia1oatraieo s)t2urirpny4ale liesa()s2ta( pno4oeeoioeiadfm umuvp;t)alxoiocia1lm elivs;t0 exmxm3nudoleelfvsl()s2tau pno4tlto f3iydlmDea(ms;(0texoxo tytoaDrli o;t s2xr(m3nydomeelicsa(  rtaxm oo0oleoif3iytls2elumpn()trtoir oadomtrlu il() exrxr ou1ll nlicsltfaDrr(mo;o4apt  f3tlslsDra(mo;(4aetnio oytfm e ivilt tetmxr3iydolt mies ()aDtaurpou0aetomoctldfmDrmuvs;t)altrxr3oadlpDeauesl()srtrxo3iy4omtn iei s)a2rmump;t0oltoifciyd m2elump u) rxrxocio1fmt auei t0 etoxrpoy4op  mnetl()sDraurp;o4tee ii3iad mDrm(mo;(0areoxociatomD livi t)trxmxo oy4ap n ici t)sDrm(r no0apxniictltls2rlu s;t)tetoif3io1lmDraueo s tetoxr iy1omee nctatfa2rm( onu1tet mfetadla2ran on(4 reomr tadlpt  uvo t) 2uoirpnodap   nct ()aDtmumpnt4texnmfcils s2umu o t4teermf3tytfatrlu sl(0setrxm no1open nesat)aDtaxrpot1olx mi3iyt m eanvpnu4 etomr3iotfm rai il(  2tr(m oydllt mnvils sDururono1tltoioctas sDumums;u0arxrir3iodom eanvi;t0t2xo(m3io1al   fvtatfa2rmu o;t1apx mfeiytfaDul(mp;(0altomocto1fpDr ivilt)teumio3nu4amtelfvt t)sDtaxrooo0olxomfetlsfa2eanvp (0tltrifciydoaDeauvslt  rxoirpoy1alt lnvtl(fsDua(mo;t0tltnmoeilt m2eau p (0tetrmr tatfmtraieils0t2trxopnodlpte ncta(faDrm(monu4tpe ioetasls2rm( s;t4tleoxf iydfm rliei s  eumxo nodape  nvtlt  2rmuro;u0apt  i3tasfs2rauvsnu4 exnxf3oodopDe uei;s0srtoirpiy1ap e fvtl()aDta(  ot1altomfciaslaDeluvo (4aetomo iatoat lu i t)trxoxmpno4llt lnetat) Drmx ono0tlt ii3iat s2emumsnu4aexrif3iydlpte n i t)sruoim iy4amee fei tfsDrm(r nu4apxn ietls sDelnmsnt4alxomr3io1opteli ils  ruoxr oo1apt  ivslsfsDuax oot1alt mi3iysfsDrmnvp;u0texoio3oodoa  lnesls  2tm(r ny4omenmivt ( srtmu pnu0tltomictltfs rl(vont4 lerxo iytfp rlu ilt sexmir ou4ape lnci sfa2rmx pnt4tpenifetadla ulnvp;t0tlxrmociodfa r ivi;t) 2uoir3oudamee fesa( arumurp;t0apeomoeiytfa2elu snu0tlermf3iydlaDeanei s) rtmxo ny1ameemnvsa( a2rrum nu1tlenmfciatlaDeanmp t4 renxf oatfp  auvi t) 2uo(rpiu1lm emnctasf rtm(m nu1tpxo ieiysfa ul( p;(4alxnirctatla  lu i t  exoir3nudape  nctasf Dta( p;u4aeenmocildfa2elnvsnt)aleoxrcoa1lm r ueo;(0trxmio3iudoltemnviat)a2tmur nt4tpx if3ildlmDuanvs u)altrmo totoaD aieo s trumxrpno4lltn nvias)srrr(  ou0texoif3tlsfmDulu onu)aetomf totfate u ilt) 2ur(mpnodomt lfvia()artmxr ;o4alt mieiadfsDrmuvo ()alerxocoodop eauvsl( s2xmim3oydapee iciatf 2tm(  ot1ape io3iasfmDrm( s t0aexnir oydlm e n i s texr(o3nydal e icil(f Draur ;o0tltnioeilt s ulnmsn(4artrircoy1fpteau ilt0t2xoim3nodam  lnvsls)sDrau p;o1apxnmoeiad sDuln p u4artnxfcootlp e n o;s)setoxm3ny4omtnlietl()aDrrxmp;o4tlt mfciyt sDrlu p;u4trenxocia1lp eanvi ()srtr(mpoudlp e ieiltf rrax o;u1altnmietls s umump;t0aexnmr oa1faD aneil(0s2umirpio1al   nvs sfsrtaxmoot4tlxn f3tad aDuauvp t0altrmr3iadfatrln o (0t2um(r3nu1amtelivsl( a2uau pou0aetn oeiatls rl( s;u) etrir3iadlp eln s (  rxmxmpoudlltnmnetls a2urx  ;t4tle ifciys sDem(vs t4aeenxo3oytoat  uvi s teurim nudlltn ietl(  2ta(r nt1alx iiciytla raumo (0 leoxo3tydlp elnesl(0sruoxopou1aptemnctlt) Durxrpou4tlen oetasls rmu o;()aeeomrcoydlp e u o t  rum(r3iydole  nvils srtmu  ;u1apxnmfeildfa rmump;(4altrxo oo1oat  ivo;s0 rtr(rpiydll emnvsasfa2ra(moou0aptoio3iatfsDulnvo u4 etoir ta1fpte n o;t)t2tm(opou4ol   ivtls)s2rm(r no4ale iiciytfs2rln s;t) lermf oadom eanvi;s s2xriopiy1lm  lfet ()a2taumoot1tptoiiciltlm eauvo;t4 reoxo oadfmD aieilt0 exm(rpiy4ole  fes t)aDrrxmpnu1apt  oeiadlm2ulnmo t0trerxocoytlaDr nv
\ No newline at end of file
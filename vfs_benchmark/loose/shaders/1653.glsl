@@ -0,0 +1 @@
+n o;t t2xmxo3nudlleemivtas)a2raxm ot0tle  fetat mDulnms (4 rxomr3iodoa rlu i;(0 rtoio oudoptelfetlt sDrm(mpnt0oet mo3ilt s2elu s (0 lerxr3to1fa eaueilt sexr(m nu1ll nlncil(  2rm(m ;o1oexn octatls2ea(mo (0 eeoxo3oo1fp eaueol(  etr(o oudalte nvt sfaDua( pnu1aptniiciydfm2uaumo;u4tlxrio3oy1opte neol(0 2toir io1lmtnmivsat) rtau poo0tpxnif3tas m2emnvpn(4arxomo3tytfmDeluei s srtrxo3iu1apen fvia(fa2trumoou1tlxomf3iyslm2uanmp u4 exnxf3iytlp e nes;t) rtoxm iudapenlfvtls)sDta(  oo0apt moctas sDraumsn()treomr io1om elneil( trtoiopoy1lpenmnvil( srua(mpnu0aptnmociat aDeln o;u0artnxr iytopDraueilt srxoxm iy4ole liesl()arrm(mpou4tle  icilt m2emumpnt4teenxo3oy1fate n sl()s2xr(rpiudlpt mncil(f Dumur nu0tlx  fciytfm ulu pnt0texrmr tatom ranvo ( trtmxo3oo1lmt lieias s2rm(mont0tlxoif3iydfa rmuvpnu4tlxnxf3oytfatr ues;s) 2xoxr3io4am n nvs sfa2ta(  nt1tee  fcias mDelnmsnu0 ltnmr3iadomD luei (0srumxm3oudame  feia(fa2trx  oo1apxnmietatla ea( o;t0teermocta1om   u s;( sruo(r3oodaltnmfes ()srrrxmpnu0apenmfeiyslm rm(mp (4trermrctatopDr neolt seumir3nu4ame  neiat) rtm(  nt0aex ifetydlaDrau pn(4teeniociotlpt lu i;s0s2xoxm3oodlmenmict s  Durum ou4oeenmfctad m umuvsn(4 etnxrcoodop rlnvs s sruo(r oodapee nesatfartmu  no4texnio3tldfm eau s t0aeerxr oodomt liei;t) exrirpno1lp emfvslsf Dtmxmoot1apxnmfcildlm rm( pn()texoiocoytomt luvs (0trxr(o3nu1aptnmnci sfsDur(mpoo0oee ioeiydfm ua( s;t)trtnmo3ia1oaDe uvo;s0s2tmim ou4ll emnvi t srrm(r ou1olx  feilt m2ua(mp;t)arenmo todlp r uvo;()srtrirpno1ll emivsls)a2raumo;o4opxnifetysla ran s;u4aeenif oodlmteaues s0 rtm(o no1lpen nes s  rrr(ro;t4tltn ieiytfs2rl(vs (4alxoir3tytopDrluvs (0 rxo(o ou4lm   fes s)a2trxmoot0olx  o3tatlaDrmums t4trenio3oa1faDeaneilt  2tr(opiydlp e nci s srrrx  no4oeeoifciyt a ranmsn(4 lenxoctotlm e i o;s t2xmxr3iodom   icsa(faDtrxr nt1tpeomoeiyslm elu p;u0trxnmfctotlaD liei;( t2trxr3iydole lfctltfarum( ono1opeomi3iytfs2ra(mpnu)altnifctadla rauvolt0trto(m iydlleemnes ()aDrm(m ou1oetoio3tytfmDrmn snt0altnxo3iodfmD  nvil()t2um(r3iy4ap n icta(f rumump;o0tptnii3iys s emu pnt4texoirciy1la e n ols  etoxrpou4aptnlnvils)s2uru pno4tpto fciyslm2emu pnu4 eeoif oatlatr ues ( seumxr3oo4op  mfvs t)sDurumo;o1optoiiciysfs ulnvpnu)aeermociadfaDran o (  2to(rpny4openliei tf rtr(mpoo1alen oeiydlsDrm(mp;u0 lerxf to1op  auvols  2ur(o3nudop n fetlt)sDuaxmpoo1alx miciadlm em( s;(0trtrmf3ia1oaD  nes;s0teuriopou1ll  livil()s2ur(root4tpxn fctyslaDuan pnu4 rxrmf oytfa eln ol(0texoimpiodomt miei t) Dtmurooo1ope mfciytfaDea(mp;()texoifcootlp  lnvilt0texoir3nodomtelivil(  ruaxmpno0oeenioeiaslm umu s () rtrir3tadlmt lueil()s2tmirpiy1om e ivil( a2raumpno0aeenio3iysfa2ulnvpn(0tlenmo ty1oaD au ilt sruo(opnu4altnmfcta()a2ta(m nu0opxnmoctlslmDul(von(4aeenmfctytoa  liei;t  rtrxrpoudop n ici s)sDtm(  no0ape mf3tasfaDuln p;u0teeoxfcia1fa e ieo;()s2ur(r iydolt lfviat sruaumpoo1aexo i3iytfa rmnvo;t) eenxo3oodoaDrlnvo t s2xmxo iu4op elfcs ()sDtaxroot1oleo ieiytla2umn p;(4trtnxr3ta1oat  ieil(0 eumxm iodolt  nvt t a2trum ;t1tet iieiat mDelump;(0aexoir3oy1lpteaies;( t2to(opnu4alee nvt tfsrtrumono0aet mo3taslm uau p t4aeeomf3iodop elneil(0 2toir oo1lptemfvils) rtmu p;u0teenmicildls rl(vp;() etnxf to1fate nes;(0 euo(r3nodape mfvsa()s2um(rp;o1aptnifetytls rm( s;u)trtnio3ta1fa   ueolt) rtoxm3ou1lpt mnviatfaDuaxmo;t4tlt  octydls2ra(vo t0 lxoifciytfpD  uvi;t) exmxopnu4lpeemici s)srua(moou0opxo o3iat mDrm(mp u0 eenmf3iodlpte u il() rxmxr nu1ol emfciat  rur(m ;u1opeomociysfm ranmp t)trxnmf3oydopt  ivilt0 exmxr3nu1llenlieiasfsDta(r ;o4opx  fciasfs2ea( ont) ltrmrctadlpDelivi s)truo(o ou1om e nviatfs2um( pnu0aptomieiysfmDelnms;(4 rxnxrciy1fp eluvs ( teum(r3nodlm nlfvsa( srtmumpoo4tpt io3iadls2el( o;u4trtoxfctotfa e ueo (0srxr(opny4om   fcs ()aDuaxr nu4opto f3iysla2uanmo u)texnioctydlaDrlivs s0 exm(rpnodaptnmfcsltfa2tmxmpoo4tex mociatla ua( p;(0 lenxr3iytfa r n s s0t2xoxrpnudop   fetl(  rra(  ;t1altn o3iysfaDum(vonu0arxrircootoatr u i (0trumxo3nudope lnct t a2taxrono0apenmfetadla2el(vp;t4alxnir iy1fm rau ol(0s2xo(m iy4lmtnmfciasfsDumur oo1tlt io3ildfaDrlnvo;u)trtoxrctytlm eln o;t) eum(opou4lpenmivtlt)sDrm(mp;o4oltoifeildfs2raumo ()trxnxo iydoaD aneols seurxmpiy4lmenlivsat sDumxr ot4oetoifetysls elnvp;u0artrxf3iy1oatr neo ( texrxm nydam elnvtasf Dumu oou0alto ieilsfs elnmo u0tetoif oytlm   ieil( trxrim oo1lleemfvi tfarumumpot0tex mieilsfmDumuvs u0 reoif ty1lat luei ()seurxo3oy4amtelfvs s) rurxmp;o1tlxoii3ilsls2elumsnt4 exrmrcia1opteauvol(0s2tr(r3io1lptnmfcil(fsrrmu ooo0ape mi3tyd sDrl(vs;()tltrmo3ia1lmt ai ols setoxr iydaltnliesa(fa2rau ono4alen i3iltfa ea(vp;t0artoxo3iydlmDeaues;s) rxoio nu1lm n fcsl(f 2ur(mp;u0tpt  o3tysla2ulnmpnt)altrmo oo1lat lnesls0s2xrimpoo1olte ictasfsDtmx o;u0oetnmoctadfa2rln o;(4altomf oo1late i s;(  rxmir iy4aptelncilsfa2tr(  nt1tpxoif3iaslm2rl(vs;(4 eenmr ootla rauvilt  2xrxo3oudoltnmiei t s2tmum ;t1oee mo3ilt s2rl(mpnt)aeeomrctatlp   i o s0teuo(rpoy1lmenmicsl( sDrrurpou4tpeniociaslm um( sn() exrmoctadlptranvi;t0trtmxr3nudal   fvias  2rau poo1texnii3iadlaDuan o (4teenxrcty1lmte ies s)trxm(rpou1lp  licil()artmuro;o0aex  ieils a2uluvsnu) renxo io1lptr u i;s) euo(r3nu4llee fviat srrmum no0tetomicils s2el(vp t4aeenxfctodfmtr uvo s0t2xmir nodom n nvs () 2rmum nu1aetnif3iytfs um(vp (0tetoio3io1fmt lu s s)teumirpoo4lltnmnvtat arua(m ;u0apeo iciltfs2eanvo u0aeenif3oadfaDelues s0srxmim iy4lle livslt  Drau  nt4aeen o3tasla2elumsnu4 etomoctadfpt anvsl( t2tmir3no4omtn ivtlsf rtru o;t1aet mi3tat sDul(vo u4arerxf3io1oa e ueilt0t2trxr iy4ole mivils  Duax  ;o4oet  o3tysfsDul(vo;u4altoxf oatlatran i;s trtmxmpiodol n ivt sfaDuau o;o0tpe  i3ildls2elnmo ()arxniociodfpDelues ()t2to(m3oo4am n nvt s)a2um(roou4tetn ictydfaDul(vsnu0 rtomo3oatlptranvslt0 2tm(r ny1oltnlies s)s2rrumo;o4aeto ociat m2ea(ms t4tetnio3iadfmt  nvo s) 2tmxm no4ale mfes tfsrrrum nt0alxnmfetad sDrm( snt0 etoxrciodfaDr ivsls)texr(o3ou4olenlnci s) 2umx onu0opeoiieias s2umnms ()treoxo3todom  ln ols0setm(o3oy4omeemietas)arumurooo0alt io3ild m2um(vo u4 lxnif3iydlmt auvslt)trxrxr3ou1aptnmfvsltfarra(mont1tpt  icias a2em( o;t)trxrif iodlmte u o t0 2xr(mpoodamt lfvs tfsrtau  ;o4ale iictldls eanvsnu4trtnmrcoytlmteau s;s)trxoxo nodlm n iesa(  2rmxm ot0alxo fciyd aDeluvsn(0 lxrmf totomDeluvi;s teto(opnodom emnei ( sDtaxrpoo4ope moctatfm ranvp t) reriocoydlat  i ilt) 2umxmpnu1llteliesltf Drrxr no4oeeomociadfa el(vs u4texrmo3iatop   iesl() rxmxrpoudomenmfvtl(fsrum(m ;o0apen f3iysfm eaums;t)aetoif iodfa   ies;(0setrxm3iu1am emfcilt)srrrur ;o4tleoii3tydfsDrauvsnt4 leoio tatopD aues (0texrim3nydlpt mivsl(fs2trxmpnt4opt mfctys mDemnms;u)aeenirciatfaDrlivols) rurxopno4lp elfvs (fs2tmu ooo4tlt if3tydfs2rlumsnt0trxrxf3iadfatr uvi;( t2uoirpny4lp  lfcsa(fsDra(ro;u1oexo oeilt m2emumpn(4 reomf oydfaD aneil( trxrim no1lpe lnci ( srtaumo;o4tpx iictytla2rl( p u4 reoir oa1lmte ieilt0trumxr iudlmt lfetlsfs2um(r ;t4teto i3iat m ul(vp;t4 ltniociy1laDeaneo;t) eurxo3no1lltnlfetltf 2tmumoou4opt mfetld mDrmuvpn(4trtnmf3iodlmtranei;t) rtr(o iu4olt livias aDrr(mpnu4aeeo feiasls el(vont0 lenmr3tytoaDeai s (  eurxmpno1ape  fctas arraurpno4oetn octys a em(mp;t)areoxfciydlaDeaneol(0s2urxm3ou1ll elnvtas  2raump;o1tee mietadfs2ua( o;(0 etoio3iatoptrlivs;( t2tm(opoo1ape  nvs ()srtaxr nt4oetomoeiatla rlnmo;t)alxrmf tadlmD aivo ()sexoxmpou1lpee ivia(  rrrx oot4tlt  octad s rmu p u)trtnmf3oatfpD  neo s0srtm(r3iydoltelfetltf Drru  ot1teen ietld m uauvo;t)trxoxfcta1fptran o;s) rtrxr3nu4lptemicil(f rraxmoot0aet mfeildla em(mo t0 lxoif3oy1fat an sls)sruoimpiy1amen feta( artaxmooo4tleo f3iadls el(msnu) etoio iotop  luvol( srto(r3oy1lm nmnctasfsrrau  ot4teenmfetltlaDumnvonu)aexrxr totfmDeluvi s seumir3nu1lm  lfvslt) rrrurono4altoif3iyslaDeau p u0 renmfcootlpt luvs (0trxoxr3io4ame licilt)sDtmxmo;u4opto fctls s ra( o;(0 lxriociydlmD lneo;s) exrxrpiudaltelictls)artmurpnt1texoiietls aDelnvs;t4aeerxr iodfpt ai i (0 eumimpny4lpt mnetatfs2umu ono0olenmo3tas a2emnmonu4tlenir oa1lmteanvsl(0 2to(o iodlp n nes sfaDuaxmpoo4altn feild sDran o;t) ltnir3iytfmDrlnvo;(  exmio io4lptelncils srua(mpnu1tlx mi3iysfs elu pnu)aexrmocia1optrai il( t2tmxrpiu4ol   icsasfaDtruront1tet  f3iydls2raums;(4 etomf iodom  luvils)seur(o ny1ope  nvslsf rra(mo;u1olt  oeiysla rmums;t)altoxr tadoptr neol() exrim3iu4am e ictas  2uaxmont0apxoioeildlm2ra(vo;t)arxrir oodfmtr nvsl(0 euoxr3no4ol  lietat sDtm(rp;t1olxoii3tltfa eanmonu4artoxfciy1lp ran s;t)tetrim oudlm n fvsls sDrrumpou4tpxnmictysfaDraumpn(4artrxo3ootfpDrau i (0seto(r oo4apen ieilt)srta(m ;t0tpe moeilsls el(vs;t4trermo tadlatr ivolt sruoir oydlp elfetas s2ta( pot0altomoeiyd mDranmp;(0alenif ootfa   u s ()sruoxopnu1optnlivtl(fs2tru p;t4alx iictlsfs rl(mo t) lxrio3io1fatr iei;s)s2xmxmpiydlpt mies s)sDumxm ot1ole  f3iytls2el(ms u)artomf3iytfpte uvsl() 2uoio3io4aptnmnes s sruaxrpnu4aleoiietat s rl(vp;u0arxnxf3oatoat  n o;s0setm(r no4open icia(  rumxmont4tpxn feildlm2ulu o t0 lxnmf tydoaDeaivil()trurxr oodlptnlfvs ()aDurxmonu0alx  fcildls elnmo;u4alerirciodfa eaues s0teuo(opio1lmte nei (fsrtr(r nu4tlxo feiatls rluvonu) rermf3ootoa r nes t0t2xoirpnydal   neia( arurx pnt1tptn feiad a uan onu) rxnio ty1lpt au o;(  2tm(o io4ol nmfvsa() 2rr(m ;u1apx if3iasfaDel(vo (4 exrmrciadfmD aiei s0trtoim3iodlmenlneils) rtruroou4tptnmicils a em(mon(0altoiocia1lp r nvi s0texo(rpoudomeemiet tfsrurump;u1tpxomi3iltfm emn snt)trxrxf3totop   n s t0trtrirpnu1op n ivia( arrmum no1opxn ociat s2ua(vo;t)trerio3ia1fa  aivs;t0trurimpoydome  fvsa(f 2tmumo;o4oex  fctldlsDranmo;(0tltnmrctytfaD  i i;t s2umxopiu4lp   ivtl()srra(  ;o1apen fciadfaDuau o;(4aeeoirciy1la   ueo t0t2um(o oydamtemnvsa(f Dtmxmp;u1apxnifeils m2ran p;t) eenxfciotlmtelies t  rum(m iy1llenlfcta( arumxmp;u0tpxnioctltlaDrauvo () rtrir3iadfmtrlivo;( trtoiopny1llenmivt t)aDumu p;o4altomfeiysls ulnvo (4trxnif3tadoaDelnvols t2xo(mpiydopeelnvils aDtmurpnu4aptnmocils a2ranvo;t) rerio oydlat lnes (0t2urxrpiudlm  licil( aDrrxmo;t4oet mieias s2uanmo (4trenif ootopt livs;s)trtrimpny4lm elfei s  Dum(mont4oeen f3iydla2umn pnt0 reniocoo1op ran ols0s2trxrpou4lm  mfctlsf Draump;o0oexn iciyt s emnmonu4tlermf3ta1op e n i;s truo(opou1lpenlicia() Drr(  ou0oee iiciadla eau o;(0artomf todfp   uvslt s2uoim3iudlp  lietat s2urx ono4aet mictat aDemnmp;u)tetomf todlp ean o s)s2toirpoo4omtemncs s)a2umum no0aexomf3iadla2rlnmsnt0arerxoctadlmtrlueo t s2urir3oo1op nmnesatf rua(mooo1texomi3iadls2umn pnu4 leoxf3iy1faD luvi;s) rurim3iodal  lnetlsf 2tmu  ;o4tlt  oeiytfa um( s;t0 ltnirciodlmD lu ol(0srxm(r io4ol e fvil()s2tr(rpnu1tlen o3iydfsDumn o (0altnmfcoodlptrauvs t0s2xoio iu4omtnmfct () rtax  ;t4alxnmfeiasfmDuanmont)aetrmfctatla ean il() etr(rpio1ape mict (  Draxrpot1aet ifctad s rmn p u0alerio oy1lpteli ol(0t2toiopiy1lltelicia( artmxmpno4oleoiictatfs2umu on(4alerxocoytopD au i ()s2xmxo ny4lm nmncils arrr(moot1apxn fciyslm2umumo t4areoxo3ia1lat li ol(  2xoxopnodlpeelfvs t)s2rrxrpnu1tetoifctyslmDrl(ms ()alenir oadlp  li i t t2xr(rpoy4lmt mivtls  Dtr( onu1olxo oeilt sDra(vs;(4arxoio iytfmtr uesl(  rur(rpio4altnmfvs s)a2raum nt0teeoifeiydfa2rau s;t4aexnif oodfm raues t)t2tmir nydoltnlicsa() rtrxr ot4apeomociytla umu s;t4tlxnif3iydoaDeanvolt)sexm(opnu1aleelici tf 2rr(m ;t0tpe mieiys mDuauvsnu0arxrxociy1op  luvsl(0 2xo(m iudam n fetlt srurur ;u1oexn oetas a rm(mp;(0trtnxr3iadlp   nei ()setrxopno1lmee nesl()a2um(r ;u1oltnmfeiytla2ea(vs;(0 rxrif3ty1fpDr n o;s0s2uo(mpnu1llt lfcta(  rtrxroou0oeeniietlt s2uan p;() exnio oa1fpD  u olt s2xoxm oy4amtn fci t)srtr(  nt1open o3ild a2uaums;t4alxomrcty1fp r uvil(0srxr(r3nydap nmietls  2rm(moou1tlx mocilt m2em(vp (4 rtoircoatoaDe nes;t  2xrir oo1lm e ics t  rtrx p;o0tleomociys m umn p () eeoif totfa  aiei;s0 rxmxr3iu1ale mnvs s sDtau ono1teeomietlsfsDra( pn(4 eeoxrcoodfpDelueo;( trxrir3nu4amenlicias  rrmumo;u0tee  ieiadlm ranms u) exrxrcoydfp  aueols0trxr(o iu1lme mnviltfs2raumo;t4tlxnif3ild a2uau p;t0 exrmfcoo1la  li ol( setr(mpno1ame livil(faDra(  ;t0tpx iieiytfa2emu sn(4arxnxf ty1fmtr i i s  rurxm3oydam  mncta(fa2raum ;u4tltnmocildfm2el(vs;u)trtomociodfmDe nei t0srur(rpiu4alt mfetat aDra(r oo1oetnmf3iytfs2emu sn(4 lenxrciy1opt  nei ()s2ur(rpiu1alenmfetatfarrr(ro;t0apx  o3tlslaDeauvs;(4 eenmf iydoptraivi t0s2xo(m3iu1ll n nct (  Duaxrpou1teen ietltfaDul( on(0aexomr3ootfmteai il( s2xmio3oy1amen iet (fa2umx o;t0oexn fciadfm2ua(vp (0tlxrxrcoydoateanvi;(  rtoio nodlpe lfctas)sDumuro;t4tpt ifctatls2uln s u0trerircoa1fateaivi;s)trurimpoodlm elnei s a2uau  ;o0alx mfciltlmDulnms;(0trtomr3ootop elu s;()teuo(o nodomt  icsa(f Draxmpnt1olx io3iatlmDrm( o;u4treoir oytoaD  ueo s)t2toir nu4amtn fesl() 2tm(r ;u4tex  fciasfsDrm(mont4 exoir3oydlmt lieo s  2tmim3iudalt  fvsat) 2tax  ;o0aptomo3tld m rmu o;u0tltrmf oy1fptrluvolt sexmir3oy1ape mfvsas)s2rmumpnt1tptniietatls2ranvsnu0 ltnif3iytfpte n o s0trxrio ou1lptelietlt a2tmxmpoo4oltomfeiys aDumuvs;t0alxnxfcootfaDe ueo;s0 exrimpiudapt  nvtat)s2ra( ono4olt ioeildla eln s;()trxrmf tydopt ai i;(  2xmxm io1omenmnvil(fsrtrxmooo1aexomi3iasfs ul( s (4tetnmfcoy1om  ln ils)t2xmir oydlp nlnvs s)artmxr ;t4oeen i3iytfm2ulump () rxnmf tadoa  anei t  eumxrpnu4altnlict s  Drruront4ape iiciltla2eanvp u)arxnxociotop rlivols tetr(o oydam  lfciat)sDtru ont1apenii3tatfa2elu p t)treomf3oatoaDe nvsls)texoimpnu1om e feiat)a2rmu oou0olx ii3iadlsDeauvp;u)texoif3ia1latrli s t0setoxr io1ll emnvta()sDuru pnu0tleoioeiltfaDemnvo u0 lermfcoy1lpD aues;s0trxmxo3oy4aptelivt s) 2rmuro;t1aeto o3iaslmDuln p u0artrmrcio1fpDe i sls0trumiopiudlltemfcilsfartmxrp;t4oexomoeiasfm rlnvsnt0 eenmf iatlpte ieo t)srto(opou4optemnvi ()srtaxmono0aexomi3ias a2rluvsn()trerif iotop e n s t t2um(o iy1ol nmfvslsfa2raump;o4apt  octldfs2umn snt0tleomr oydfmD  uvs;s0 rtrir3ou1om nlictlt  Drr(mpnu1tlt if3iat sDrm(mpn(4arenxf3tatop eau s t0seurir oydlptn ies t aDtmu  ;t1olt mf3iat a2rluvo u0 etrmr3iydfmDe uvi;s0seur(o3oo4llen fvt sfaDtmx pnu1alenmoeiadlsDumumo (0altoirciatopt lueolt0 2trir3oy4omt lieslt  Dtrxro;o0ole if3iatfm2rmuvont) exrxo tytfmt ln o;s) euoxrpoodope lncil(f 2umx poo4alt mi3tldfaDranvo;t0altrircio1lmte uvsl( tetmxm oudll elfvia( aDumxmpnu0apxoiicild aDranms t)tlxoir3tytlaDelivsl(0srxm(r nudap nlnvsl(  rta( ont0tptn ietyslaDeaums;t4teenif3iy1faD lu o s truoxm3iu1lle miet sf rrr(mo;t0tltnmf3iyslaDrm(mp;u4 lxnxo3oa1omD  uvsls)t2trirpiudlleemieil(faDurumpnu1tlxomictadfa2eau o;t) eeoiocio1lm e uvolt0trtr(r3ny1ll elicils  rtrxmo;o4alx mi3tytfm2ulnmp (4 exomo3iotlp   ivi;s)s2xo(opiy1lpen nviat)srtm(m ;t0aee mociltfa2uanvo u) ltnircio1lmte i sl(  2xoir3oydol emfvtasf Dtm(m nu0apxomfcilslm eanmpnu)alxoxr to1lpteauvo t srumim3iu4op nlfeias  ruru  no1tle ifetytfs2elu o;t0altrxr3oatfm rli s t0srxmxo3iy1lpte ici s) Dtm(  ;u1ole io3iltfa2elnmp t4trxnxfcia1lm eanvo (0 rtrimpiy4oltemnvi tfsrtmxr ;t0alen ocilt s rmnms t4areoxo tadlaDraueilt0s2urxm3ny1llenlivils) 2uaxmp;t0aeeo icild sDumn p u)artnircoatlateaivs;s0sexrimpio1lp n ivtls) rtm(  ot1tpxn ietlsla2umuvsn(0texnio3tadlateli ilt)tetr(r3oy4lpe mnvia(f Dtrur nu4apxn ociyd a ea(mo;u)aeerxr ia1fmDr n o;s s2trxopiydol  lfcs (  Dtruront0tlen iciltfa um(mp;u)tlxnxfciytlatraies t srxm(o oy1lptelfvtat  Duaxr oo4apx  f3iat m2ranms ()aexnxf3tytfpDraivils0truo(rpiy1apt mivtat)aDtrumooo0oleo o3iyd a rluvp (0altoio iydop  auvs;t srtrxrpio1opt  fesas)a2uaxront0oex  oeiydfaDelnmp;u0 etoirciydfmt lieol(  eur(mpoudope mncta(faruru  ;u0tetnif3iysfsDrlnvp u4alenircto1opte iei;s  rxo(o3no1op emfvils  ruau p;t4oltniociysfm2elnvpnt) lxnmr3oydlptrlies s)trxoxmpiydope miet t)srrr(r nt0oeeo ieiltfs2ul( o t) lxomr3oatoa  ai i s setr(opiy1omee ieiat  Dumuronu1aeto ocilsls elnvs;t4trxnio3iytlptrli sl()t2tm(opnudal   fcsatfs2ta(rono0olt mfctadfa2rln o;t4 exomo3iadfatr nes t0 rxmxo3iu4lp  lnvi t  Duax pnt1tpx  fetytla2eau pnu) eenmo tadopDrluvs ()teuoxmpnudamt mfvs t)aDtr(rp;u0alxomfcils a2um(mp (0aexnxf ia1fat auvs;()seumxmpny1apt mivs s artr(mont1altnmoctlsla2ul(mont0alerir3tytfmDr ivs t)teurir3iy1lle mfci s)a2ur(rpot0oet mfcilt m el(vo ()trxrmo3oodomte ivi;s0 2xm(o3iydaleemiei sf Dra(monu4aleomieiad mDrl( s;u)aexoxrcia1lp rlnei;(0 2xoxr nodop elfvs s) rrax o;o1optoif3ilt s el(vo t4tlenmfcia1omDr uvo s) exo(r3io4altemfesasfaDrauro;u0optomfeildfmDuauvo u0aexomr iotopDraivs s0tetrxm3oo4alen ivsl(fsDta(moou4opxomoeiydls2el( s;t0tlermr3tytfat  u o;t) rtoim oudop n nct s)srrm( pnu0texoii3iyd mDuanvont)teenmo tydfat ln ilt  2xr(o3iydoltnlfvsls)srtmxrpno4oltoii3ilsfs uanvpnt0aetrxo3ta1oate uvi t s2xr(r3oydam nlfcias)s2raxroou1opto fetld m2em(vpnt0 exoir ta1omDean i;s0 2ur(opnu1lm  livsatfsrrru pou4opto fctydlm umn o;t0altrmrcoytomDr u s s  2xrxo nu4ame lneta() 2tmu onu1olenii3ilt a ul( ont)treoir oo1fatr uvo s sexmxo io4apeelfctls)aDrmx onu0teeoio3ilt s2uaumo;t0 rxnxr ty1opDr iei;t  rur(o oy1lmte ncil() rtrump;u0altnio3iasfa rmnvs;(0areomoctatopt anvs s  etmxo iy4am   fvtas)aDrau pno4aexn fcilslmDumnmo;u4artoircia1latelnvi;t0 2umxo nodale mivsltfsrrm(m ;o1altnmo3tlsfm um( s;t0arxrif io1latraivo;()s2urxopiodop nmneil(farua( oou1ape mo3tas aDeln s u4 rtnxfcoydlp ranes;t)seuoim oydllt mncsas)s2umx pou4opeomf3iad mDuln s (0areoir oadfmtrln ils)seumxrpnu4lp nmfvsltfaDraxmpnu4ope mieildla rm( sn(0altnmf3iytoaD  n ils trtoir nu1llen iesasf 2rrx oou4teen oeiydfsDul( o;u)aetrxo iydfm eluvi s0t2xrxrpou1lp   fvt () 2tmumpou0tpeo i3iatlm2el( p u4 leoif oytfat  ies t  rxr(mpnodal n iviat) 2tauro;o1aexnmf3iltlaDrlnmo;(0 leoir3totom   nvo s0texoirpou1lme  netl()s2tr(mpnu0tptnmoctltfm ua( pn() ltrxf3tatoa  lneilt0s2xr(o3ny1lme mivilt) 2uaxrp;u4tlto feiatlmDelums;()trtoxr3to1opD  n o;t  2xr(o no4lpee netl()aDrr(rpno0texoii3tad a2eanmpnt0texoioctodlp elieo;()teuoxo oudlm emieia(  rrr(  oo4opxomoeiasfa2uauvp;u4tlerxrctatlp elu i t)teumxmpio1ap nlncilt srrm( o;u1apenii3ilt s rm( o t4areoxo oatfm ran ols teto(r nu1omtemncils)a2trxmpot1aptn o3tyd a rmu ont)alerif3totfa eluvi s setoxopoo4ll nlivi s)a2rrur ot1oex mfciyslsDul(vp (4tltnmocootfat anes;s0 etoxrpiy4lmeemfeia(f 2rm(mono4aetnmf3iyd a emn p;u0artomf3tadfaD ln i s0setr(m no4lp   iei t srta(rp;u1teeniieiasla umnms;(0 rxnirciotfmDr uei ()s2tr(o ny4optnlfvil(  rtaxr ;u1oetnifctas s ea(mo (4 reoirciy1lmDe n i;( s2urxo nudaptelnesasf rrm( o;u1texo ietlslmDrmump;t4aetomr3oydlatean o t  rto(opoudolee ieia(fsrrm(mo;o4apt  ocils m2rlu snt) lermr3tydopDe ueols srto(r3ou4om nmfvs s a2rm( o;o1tpt ioetldfsDeln s t0aeeoxo3iytfmDeli o (0srxo(opoo1amenlivtlt)aDumu pno1aexo iciltls rlnvo;u4alxnmf oo1fp elues;s0trxo(m oo4amt micilt) 2tr( poo1tlx mietysfs eln s;()arxrmrciodfm  lies t0 rtr(m oodoptemfvsa( arraxrp;t0tex ifeiadlsDeaump;t) ltrifcoy1lmtrlivs;s  rxoxm oo4oltelnctas)srtm(r nt4tpeo oeiadlm rmnvsnt)trtoiocta1fmDeauvs s) rxrimpnydoptelnvt s)a2tau pnt0apt mo3ilslm raumo;u4trtnxocootfm   i i;(0texmirpio4amtemivia(f rrax pnu4tlen f3ils s umn pnu0aexoioctytfa  aieo;t0 rtrxrpnydlmt lnesat)a2ua(mo;o4tpx  ieiydls rl( p ()teermrcootoa rauvs;t teurio no4openlici () rrmxmpnu0aexomoeiysfs uan o ()trtoxr tytfmD  i olt) etr(rpno1opeemfci ()arurxrpot0olxn i3iadla2uauvp u4aetoir ta1fp   u sl()t2uoio3oudlmeelncsl(fs2tm( o;t4alx mf3ildlm elnvp;t0arerir3iodlmtr u i;t0 rtr(mpnudll  lietlsfaDururonu1ole mfciasfm2ra(vs;u4aexnmf3oy1fmD anvs;t0t2umxrpiydamt  ncta(f Duaurpou1alto f3tldlm2rmn ont)artnxo3to1la eli slt texr(r nodom   nvsls arrmxr ou1apeo fctlt m2uauvp (4aexoxfciydfaDelieo s)trtoir oydap elfvia(fsrurx pno0oexo i3ildlaDumums t4 exomr3ootop rli i s0 eumiopiodllt mfeta( s2ta(m ou1alxomoeiat a uan on(0 etnio oo1oatrlivo;t t2uoxm3nu4opt  fct (fs2umxm ;o4aptn fciyslmDeanmo;(0 ltoif3totlaDr neo;t seumim nudopenmneiat sDra(m ;u4aee mo3ilt m2rau p;()arxrmf oytopt lu s;()srtrir oydalee nviat) 2urum ;t4tlt mfeiytla2ea(vp;u0altnmr oytlmDrluvslt0t2tmir3nudllee fes ( arta(rpno4aet  ocilt a2ul(vsnu0tltoif3oytoa  aneo;(  2umxm nudlm  lfvta()s2rm( o;o4altnif3tys a2umnvo t0artrxo3iytfa rli o s0 eur(rpoudapenlivsatf 2um(mpoo4alx ifctadfmDrm( pnt)texomo ty1fatr ivi;s t2xr(rpno4lp emivsl( aruax pou4tlenmociydfs2elnmonu)arxomr oytoat auvilt)tetrxr oy1am nmfetlt)sDum(  ;t0oexomi3iltfm2eau o;u4texoxf3iodoa  li s;s trtoxopiu1olt mieiasfsDurur nu0texomfetytls2um(ms t)texnir3oa1omtr uei (0teumir iudopenmivias arrrx p;o1opxo ictasls ranmon(0trtoir todlptr n s;( srxoxopou1altnmicsa( aDrmxrpnt0tpx moeiad m2eanms;t0tltnxf iadoateluvs;s) rumim iudom nmfcsls)sDtmu o;u4teenmfcilsla eluvp;(4altoxr oa1lmDe n i t) 2toimpnu4am n netat) Dumuronu4alxo icildfmDul(von(0 lxoifctydfpDr ivs s s2tmir3oydll emnci ()arta(m ;t0tpenio3ildlm umn onu0tlenio3tydoa  lnvo t)trxoirpno1lmt  iei t s2ra(r ;t0aet ifciatlmDel(vp t)aetoif tydfatranes;t0tetoim3iu1lltnmfcias a2umu ono1oleniieiyslsDuluvp u4 ltrmf3ia1faD an o;t)trtrim ny1ap e neilt  rur(r no0aee  f3tydlsDra( pnu4tltrxrciodlpDeaues s0trxoiopnu4lmeelncias)sDum(  nt1aptomi3ildla2ua( s (4 lenmfctotoaD livi () 2xm(o3oydoltelfvsas  Dua(mo;u1altnii3iltfs2ulumsnu4aetrio3tatom rlnesl()s2to(m nodolee neslt)aDumxmpnt1tetoii3iytfm2rlnvsn(0trxrxrcootlp raueo s)texmiopio4opt mfvi (fa2rrump;o4aeeomiciltfa uau p t0tlxoxf ootlmDrli ilt trurxm3nydlp nmnciat)srumuroou0aex mieiaslmDuauvsnu4texrir iydlpteli ils0setrxm3iodap emnet (f rrm(m ot1tet mieiaslm ranvs;t4 rxnxo3iy1fm eanes;( srurxopio1om elfes s  Dumx  nu1aetomoeiad m2el(vo;u4tlermr3iytom rlieo s)s2trim no1oltnmnvs (  Dtm(ro;o1opt ioeils m2ua(mo;u4trxoxf3ia1lm raiei s  2tr(o nu1ap emfciasfsrur( poo0oeto o3ilt s rauvs;()areoifcoy1opt  u sl()srurxmpoodlptnlfctl(fa2ua(mooo0tle  fciadfaDua( pnu) rtnxfcty1oatrlivils t2ur(r3no4al nlicias sDrrurpnu0oleo iciadlm2emump t)tltnmo3iotoa r u s t)srumim3iy1lm n fcils)arum(rooo1tleoiociatfsDrmnvsn(4teenxf3oydlatr nvslt teurxo3oudlpe mfei s)artau oot1texoio3iat m el(vp;()tlenircia1lptrai olt) 2xr(m3ny4am elnesat)sDuaxr oo0opt ifciyd aDum(mp;(0areoxf3tatfp eluvo t seuo(r3nydoltnmnesa()srrax  nt0texnmieiadla eanmpnu4aeerif totlmD lnvs t  rtmxrpno1am elnet t aDrrumo;t0tltnmocias mDemn o;u) lxoir3tytfmDraivilt sexoxm nu1lp  lfciat)srrmu  ;o1altniociltfa ulumont4 lxnif3oadfa e uvs t srxmiopnodolt mivtl() 2taxr nt1tlt  f3tas s el(vp;u)trenmr tadom eauvo;t0 etoir io4lmte nvia() 2rmu pnt0ope ii3tydfs2uaumo (4 rxnxfcia1lmtrauei;t0 2trxr iudlpee ictat)aDtm(rp;u1apxnmi3iad a2eauvp;t)aeeoiociadfa  ai sls s2toxo iu1lptnmnvs t a2tm(  ou1tlxomfeiyd m raumo t)altoir3ia1oaDean olt) 2xo(o oo1amenmietas)sDtmum ;t1opx io3iadlsDea( p;u) etnio oy1lm rlivilt0srxrxo iudlmeemfvtatfaruaumo;u4aexnifciatls2rmump t4arerxfcta1omtrauvo s sexmio ny1lpte fvt ( s2rmum ou0tetniociysfsDrmumo;()tltoio3iydomt  nvols srum(rpiy1al nmfvsas  rtru onu1alxn f3ils sDra( o;() etrir3iy1fat lnvo;t0trto(o no4ap n fci ( aDrrxmont0aleomocias a2ul(vsn()teeomr3oy1oaDe n ol( sruoiopoodlpen iei s  2taxro;o1tetnmf3tasfs2emnmp;u4trtrmr3ia1omDeluvils0teurio3nu4lpee iei t) rrax p;o4oee mociatfa ranmpnt4teeoircoatfat liei;t s2urirpiu1om e ivt s)arrr(r ;u4altn o3iasfm2umumsn() eenif tytfpt anvo;t0t2xo(m3iu1alt mfvt tfsrtmuroot1apxoiociasfsDua(von()alerxocoodfm elivsl(0trtrxrpou1ol elfeil(  2urxro;o4teeo fcilsfm2eanmo;u4texrxo tatoa  aueslt0t2trxopoy4omt  fvi tfa2uru oot4oetn o3tldfm ulnvo;u4tlxnmr3io1fmtrlnes ( setr(opiy1lp e fvt s sDurx pnt1tltnioeiadlm eln s u) exoxo3oa1lp rlnvslt0trum(m3iu1lpt lnctlt a2uaum ou0olt  feiyt a rm(vsn(4 exrmo3iatlptraivolt0s2uoio3iodlleemivtlsf rraxr ot0alxnii3iatfa umuvs u0alenxociadoptran ols setmio oydaltnmnctlt sDrrur ;u1olt  ietysfsDrlu pnt)artnif3iydopD au i (0s2uo(rpno1olte fvslt a2tmu p;t0oee moeiatfa rauvs;u) rtrmf todopDranvol(  exoir io4alt mivs ( sDta(rp;t1aet  i3iltls2rluvo;t)arxomo todlaD lneols0 rxrxo3io4lp  mfvils artrxr oo4tleomo3tydfa ulumonu0 eenmr todla  ai s;()s2xo(r3oy4olt mivt ()aDum(  oo4tptnmi3iyt m umnmo;(4aeermr tatoaDe nvo ()trxrio iodap  mietas sDrrxmpnu4tpxn f3iadfmDeln p;(0alxomfctotom  anvo (  rxoxo3ny1am nmnct s)arta( p;u4oeenioeiydfmDuln p;()alxnif3ta1fpDelieslt  2tmxr3io1lmt  ict tfsrrau p;t1aeeo oetyd s rln snt4 lxoir3iodfp r n o;s  2tr(r3oodamtnlfcsls) rua( pnt0texnmfctlsfaDrm(ms;u0 etomf3iadfpDeauei;s0 ruoio io4lle  fctls  Duaxr nu1tlxnio3tasfs2emnmont)alxoir3iodopDranvo t)srxr(mpnu4aptnlnetls sDurx oot0aet  i3iyd m ul( p;u4texnmoctodomtelueslt  2trxo iydllt  feiat) 2umuro;t4optomocilt mDum( p t4tltnxf iytoa rluei;s0 rxrim3io4amen nvil(f 2um(rp;u4openmfctyt aDelnmsn()tlxnxo tadfp rau s (  2xrim ou4amtnmfcias artaum ou0opt ioetat mDeauvo u4 renifciydlaDrai o;(0 exrxo3io4ameelicia()s2tau o;o1tet io3iatlm2rlnms;u4 lerxoctadoateluvs;t  exrxo3iy1altemfei () Duaurpot0aeenifeiyt sDulums t4 renmf tydlpD anvols trur(m3iudal   icta(f rur(moou1tetnif3iysls ra( on(0texnirctotfaD  uvo;t)trtrxopiy1al nlicsltf 2uaxmpou0ale ii3iadls rl(vp t) leomoctotfpDe i ol()srtr(o iy4amenmfcslt) rtmuro;o1apxoiietydfm uln o u)aexomf3iytfa  lu ilt trxmio iudaptn nvs s sDurxm ot1ole ifciysfm ulumpn()altnio tydlmt  u s s0texoim3oy4ap  mfctltfs2tmxronu0aeeoiiciyd s2eanvp ()trtoxfctydfat  uvs s0trxr(mpoy1amt  nct ( a2tmumpou0aexn f3iat aDuaump;t0artrif3iy1lm r n i;t0setriopoy1lm  lncsasfa2ur(  nu0apxo i3iatla umn on(4 eerio tydfp e i o s0 2xo(opnu4ope  fcsasf Drm( p;u1tlenioctltfmDraump u)trxnxf oy1opDe nvs;s texoim nydam elivta() Dra(mono1oeenmo3tatfa ranmpnu)artoxo iadomDrlieo s)t2tmxrpoudal  mfet s)aDuax  ;o0olto fcilt a2ea( o t4altoifcto1op e nvo (0teuo(mpno1lmt mieslt) rtmurpou0ope  fciytlsDeln p;u0 ltrifctydlatrlieo;s  etrio iodoptn nctat)srrmxrp;o4olx miciatlm umnmp;u)tlxnmfcoy1laDeaieo;s0t2uo(m3nu4lmt lfesa() Dumurooo0oet ifciasfm2uln sn()texoiocia1omD li s (0trtmim io1lltemfvils)a2rmuroou4ole mocild a2um(monu)artrxf ootlmD lu i;s0 ruoim oodolt lfctls)aruaxro;t4apeomf3iltfaDemums;u)tetrmo iydlm rlivs s0t2umim ou1amen nvta(  2tr(roou0aptnifciltlm em(msn(4areoio ta1lat lneo s)trtoxrpiu4ap   ncs s srrr( o;o1oexo ieiatls ulnvont0texrxf io1fm rlueo;s)srurxo ny4lp n ncsl(fsDtrx oot1altn ieild mDem(ms u0 eenmo3iotfpD au ols0s2toirpiu1llt mieiat s2rru  ;t0tptnmoetls aDea(mo (0tltomf3oodfm eaiei t tetmxrpou1amenmfes t)artm(rp;t0texn oeiytlm um( pnt0aeeoifcoa1oate ivo t) euoir3iy1om nlivtat aDta(rp;t4aex iietyd a rmumo;t) lenxrctodoptraues s0t2tm(m iu4lpt lietl( sDtr( p;u0alen fctydls eanms;(4 ltnif3tatomDeanvol( tetr(mpou4lptn nvta(fa2rr(r oo0olen oetytlm2ea( p;(4tetnmf3ta1la e n o t0texoim oy1alen nvi s)srurumpoo0tlt micild m2ua( snu)trtrxocoa1laDelueo;t)trxoxmpoydlm n ivilt)artmu  nt1tpt mf3iad sDrln p () rtrxo3iadomDeauvslt0 eum(o3ny1apenlfvias srrm(mp;o1aexo fetatfaDumnvp;(0 eeomr3iytfaD aueils)setrim3oy1oleelictas)srtaxrpno0oeeniociadfaDua(vs;(0teeoxocoodlp elu i;t srtoimpny1ome mnvt ( a2rr( p;o0aeto feiatlmDuanvo ()aeenmrcto1fpt anvo s)trtrim iudome lnvsa(fs2rmu ont0apeo ietltla rmuvs u) exnirctadlaD aieo;t)srxoxo3ny1om  mfvsasfartr(mpnt4apeniietytla2ea(mo u0 exoxr3tytfp  lneo t  eum(m3iu1ap   ncs ( sDuru o;u4apeomoetas s emumpn(0 rxnio iatlatrlivs;t)trumirpno1ope livta(fsrrru  ot0olxomiciyd a umn pn(4 rxrmo ta1oaDrluvs s)s2trxm3iy1lm n ivtl()a2rrum ;t4aex io3tytfmDumuvont4trtoxfciytfmDranes;t0 rurxr3no1al n ieilt  Dtrx  ot1aex ifcilsfaDrm( o t)aexrifcoadfat  ivs s0srtoxo3nu4amtnmivilt s2ra(ronu0oee mi3tytfa2eluvo u4 etrxr3oo1opteln il( tetr(rpiodlpe  iet () 2ur( p;t4aee  ociyd sDemu sn()aeermo3oadlpD  i o;(0s2xoxm ny4aptn ivs t a2rruroot4altnmi3tlslm2rlu p;t)altomo iodlmtr nes;t0 eumim ny4op   fei (f 2ta(  no4optnmfciyslaDrln sn()treoif3totfa e u slt0t2triopou4lltnmncils)arur(mono1tet ifeiad s2rau o;u) rxnxociotoaDr n ols0s2xmxr3oodaptnmncslt)aDtaxrono0opt  octlt sDelu o;u0artoif oydlp  an i;t0s2ur(r3nudope lfet t arraum oo4tle iicild a umn snt4 lxrio ootlm eln s;s0srtm(o nydapenlnvt s) Dra(rpnu4texn o3tldls rl(vo t)texnir3oy1opt lnvi;s srtoxr oo1oltnmncsas)aDrax o;u4tpt mf3iytfa2rmn pnu4 lxrio3iatlatelnvo s  2uo(r no1am e fcils)a2ra(ronu1alx  fciyslaDrl(vsn()tltnmo3to1op rlneo;t0t2uoxrpiodam  lncsls) Duau oot1teenmi3ildlm2umnmp () rxrxf oa1laDeluvo;(0srurxm3nodoltn nei ()srrrumpoo1alx ioeilsfm2elnvonu)texnmf oy1fm r iei;(0 eto(r3iodlp e fvslt)s2um(ro;t1optnmfciatla2ra( p t4aexoxo oadfmDe uvolt)trtr(m nodllte ieta()srrrxroou0tpt  feildls2um(ms;()altnxo3oy1opDrlivslt)srxoiopiy4amt lneil()sDtau o;o0oeenif3tasla uaums t4trenirctytla raueilt0 etm(m3oodale miesasf 2taur ;t1opxomfctydfa2rm(vo;u0texrirciytlaDr n ol()sruoxo3io1lpenlivtat)sDtm(mpou1oeeomf3tydlm2el( p;u4 exoir iotoaD livol(0texoio oydlpe  fctltf Dtm(r nt1apeomfctldlm2ra(vsnu0arxnmfciatfpDraneo s)tetoxrpny4alte ieias  ruaxrp;t0tet  f3tysfm2uauvsnu0altoxf3ta1oateai o (0seumim3io4op nmfvsatf rurxro;t0tpx  fcilslaDem(mp (0aetomr3iadopDr iei;( trxmxo oodole mfetatfaDua(rpoo0oexn oeild a uanvp;(4 etnxfctotlmt  iei;(0 2tm(mpoo4alenmicslt)s2ua( pno0alx iietyt sDel(vo t0altrmr totopt aivsls)tetmxr iodlm e nvsltfsrrm(r ;u0olx ioetadla2ua(vp u0alenmf3iatlm rau ols) etmir iydomtn ivtl( sDurxro;t0aetnmieild s2ul(vs;u)tltnxo oydoa rlu o ()t2toirpiu1amen ncilsfsDurxmpoo4alx  oeias a2uauvpnu4 exnxrcoytlmD li i t0 2xr(r3nudal  liei t sDta(mpno1aee mociadlm umn sn(0 exoxf3ty1om rai olt0t2to(rpoy4ll e nei sfa2um(monu4aeenmfeiyd m2rmuvo;t0 renircty1oa raueslt0texmxopnu1omen fci s) rtm(r ot0tlenioctyt mDemumpn(0arxnxr iatfaD auvils trtr(r iu1lp nlfctasfsruaumoot0ale ioetys s2ea(vont) eenxo3io1oat luvslt)srto(opnodop  lietltf Dumu p;t4opxoii3tytfm rln s u0trtniocto1la  luvs;()tetoirpny4lpte ivt s srumumpnu4olenii3iytfa rauvpn()aetnxr3iadlpt aivs;(0t2xmxm3io4oltnmicsas a2tr( ooo1tex mfciysls em( o;u4trerxo tydlmDrln o;s0trxrxm iu4omee ivsat)aDrru pot0tlt iietadfmDulumo t0alxnxocoydopD  ivo;s t2trxrpio1alee nesltfa2ur(  ot4aex  f3iat sDelnvp;(4aeeoio3oytfmtr ues;s0trtoir3oy4lp  lfesat)s2ta(r ou1apx mo3ias m2uln pnt0 rtnmo iy1optrauei;s  euoir ny4lltelfesltfarurumpou1ale ioeiys m2eluvon(4tetnmrciytfa  an i;s) 2toxrpoo1om e fei t) rrm(r ou4tlx ioetadfs2em(msnu)tetnmo ty1oaD luvils)t2xoim iodopenmfcs sf rumu  nt0optoiictldfs2uln p;t) rxoifcty1lp elieilt0 exr(rpno1lmt livtlsf Dtrx p;o1oexnmoetldla2um(vonu) rtomr3ta1om  lu i;t0truo(o nu4omt miei s)a2taump;o0aetnioetadls ua( ont)arermo tadfm  li ol(0 rurxopoo4ole lnvsat)s2ra(ro;t4aetoiieiasfm eau p t)aetomr ty1lmt livo;s) rtoim ny4amee nes t) 2umxm ;u0altn feilt aDel(vpn(4 etrxocty1lm eli ol()setrxr3oy4lpe licta( aDtmurpot1optnmietldlm2em(vp u4 etoxf3to1lptr u s;s tetrio no1llen nvsl()artaxmp;o1altoifetaslsDuau pn(4 ltnmr3oy1faDelivo;t t2trxopoodale mfvt sfsrur(mo;t1tpeoiociad sDuan snt)arerircoytlpteaivsl(0t2xoimpny1ll n nes s)srtrxrpou4alxn o3iyslaDea( p;(0aeeoio3oo1lateau i t  etrim iodam emicilsfaDuax o;o0aexnmfetys sDum( p;t0arxoifctodlpD au sl(0s2trxr nydol elncsas)a2ua(m ;u0tetomfetas m2ul(vs;(0trxrmocty1fm ean il(0 etrxo3nudaltnlici ( s2ur(ro;o1aexo o3iyslm2eauvo u)treomrcoy1faDelnvi;( t2trxo oy1ap n net s  Drm( ont0aex  oeiysfaDulumpn(0trtomocto1lmDraueo;t  etr(r iydamte icsa()srta(  ;t0aetnmoctadlm2uanmp;()aeeomf ia1fp r u sl(0setm(opoy1opee fcsas) Drax  no1alxnmo3tyslmDea(vo ()tetoxo iadopDe nvo t srxo(r ny4ll e ivtlsfa2rmxmpoo1openmi3tatla rmumo;(4 lenxr3ta1fa  aivo t0t2umimpoy1lltnmnesl( aDrmur ot0apxniociysfa2ranvp t) exrxo iatfat li s (  etmxopny4altnmivs tf rtax ont1tet mf3tat m rau on()alenio iatopD  ieil()sexo(rpoodal  mnet t s2tr(mp;t1optoioctadls rlnvo (4aexoio3oodopDeauvol() 2xoxo iydap  mfvi (f rrrx pot0opto icias s ea(msn(0 lxnxo3iadlmtelnes (  2xm(m nodapeemivias s2rau  ;u1aleomictltfa2umumo;u)trtoio tydlp  ln i s0 2xo(rpiy4ap elivsat aDumxmo;o4aeeoifciyt a eln snu0 etnxr3oo1fat an o t0s2um(r oodole  fvt t) rtmxm ;t0aeenii3iatlaDuan o u)aeermo3oy1oaD  uei;( tetm(o nudaltnmfet s)arrax onu0apxo i3iys mDrmnvp;t4tltnirciytlatelu ils)t2um(m ou1alen ncs s)arrrxr oo4apto iciasla rauvo t4 rxrmo oadopt  nvslt  rtrxopou4ol e fvtat aDtmu  ;o1opeo ieias aDuau p;(0tlxrxrcoytomDe i o (0sexo(opoy1omt mnvslt aDuaxm nt4apxnmf3tlt mDumuvon() exomf3oodfp  aivols0 2tmir3iy1om   fctlt sDrauroot0tpenifeiydfsDuanvs u4alxrmo3oodom rln i ()t2tmxmpiy1lle  icsas  Dtaurpou1alxniietytfaDeaumo;(0aeerxociytomD luvs;s0 eto(opnudoltnmneta( a2tm(  no4alto i3tat mDemnvo;u0 reoxocoa1lpt anvo;s  ruoir3ny4ll   icilt)s2ua( o;u1oltnii3iltlsDrmu o;u0 rtnxo oodlp rli s s) 2xoxopou1omtnlncs s srumx p;o4aee  feiytlmDea( pn()tetnif iodomteaivsls0seurio iu1ap n ncs sfa2rmu  ot1aetnmi3iaslm2uaums () rtnxr3ty1fa e n s;s  2toxm3iy1llt  feiltf Drm(  ;t0texoioeildfs2eanvs t0artrir iotfp e ueo;t0srxoio3oudamtemnesls)s2tr(rp;u1tee mi3tys s eauvo (4 rerxo3oatomD lnvi s texmxo oo1lmtn ncsa()arra(mpou4tptomfciyt a rlu p t)arerio3iatomDrlivolt0texmxm oo1lle  nctl( a2taxronu4opx ifeildfm2em( onu)arxoxr oa1oate i il( teur(o3ny4lp nmncsl(fsrta(rpoo1tetnmociaslm2ulu ont4alxnir3ta1fmDrln i;t  rum(r3no4omtemietl( aDua( oot1aetoiiciasls emu o t4alxnir oy1opt  ivils texoimpno1lpee nctas) 2tm( ono0oetnmf3tltfs2rauvp () rxrxocio1la  lneol( s2tm(o oo4lptemivi tfs2tmx pnt0aetnmieiys s umnmp t4arenxo3io1fpDeai i t0 2xmxr oy4lptnmnvsasfsDrmu o;t0tpeomf3iatfmDulnvo;()teenxf3oodlmtelu s;s)t2xm(r3iudlm n fesl() 2tm(r no0oltn ictltfmDra( sn() reoif iy1oa r u s s)seuoxm iy1op e neilsf 2ur(r ;o1tlenioetltfaDranvo;u0arxnir iadfp eluei;()s2xrim oy1aleelfvt () Duau  ;o1olenii3ild a2rmnmonu)aexomo tatlatr uvo;t0teurim3oydlpe lnvs t aDtmur ;u4alt  iciadlm ea(vsnu4 lenxr iotopD lnvsl( tetoio oodlp nlfetltf Dumx  no4aex ioeiat a2rl(vs t4tetrxr oydfa  an s;(0 etr(o3iy4opeelfciltf Drr( o;t0aee  o3iasls uln p (0aexnmfciodoaDelu ols) 2xrxmpnu4alt lnesa( a2ta(r ;u0tetnmfeiydfa rm(ms;u) exrxr3io1lmt auvo;t0tetmir oo1lpt  neia(f rumxrono1oetn ictlt a rl( onu)arerio3tydomD anes (0seumxr3ny4lp  lnetat srta(ronu1tex mfeiaslaDra(mp t4alxnxr3to1lpteaivils0 rxoxr3oo4oltelicia(fsrtax pot1olxo octaslaDea( s u) renxoctytfp   ivsl(0srumio oy1opte ncsat)arrmx p;t0opeo f3ild s2eanms;()trenmf3ta1latrlnvi;( teur(mpny1ale  ivi (f 2umurpoo0apx  i3iyt a2umums;t)aeermocty1opt lnei s  rtmim nu1ol nmicta() 2raxront0altnii3iys s elumont)aeerircoy1omDr ies;t)s2trimpnu4lltn ncias  2raxm oo4tpxomfcilt sDeanvonu0 rxrxr iydlate n o ()t2urxm3no4oltemnviat sDta(mooo4tpxoifeiltfm2eln s;u4aexrmr iydlm rlu s s srtoirpio1llt lfei (  Dra(m nt4aexoio3ilt m rl(vp;(0aexnxoctytopD lueo s) rurxopnydlleelnet s)s2tmum nu1apx  f3iat m2uln s t)tltomrciatfaDe nvils)s2to(o3io1op emfetlsf rrrurono0aet  fctyt a elu snu4arermrciytom r u i;s0setrir oodlmtn fvt tfsruauroou4opeo f3iadlm2ranmonu)alenirciotlaD li sl( s2um(rpny1omen fesls)sDrm(mo;o0aee  o3iatfmDra(mp t0altrmf oodom rluvil( trtoir no1om nmnes s s2tm(r no4opt mieiyd m ulu snt)treomfcoo1omt luvo (0 rxo(r nydlp e nvtl( s2rmx poo4tpt ii3ild mDeluvo t4texnxocoodlmDelivils0setr(o3oodlpenlivs s  ruru p;t4tlto fctydls2ran p;t)tlenmr3oodomteln s s s2tmxmpnudlmtnmfcsat)artru pot1aet  fetlsls2emuvs (4 rermrcoy1faD lnei t)t2xrirpiu4aptnmnctatfarur( o;t0oexo feilslmDulu o t4aeerxo ootfmDrli o;s t2uo(m3oo1apt  fesa()a2rrx p;t0oet mf3ils s2rm(vo;()alenxrcto1fp  an s;t) eumxr3nodlpte neil(faDumxront1aptniietldlm emu p;t0trtoxfcootfa e ueo ( sruoio iodapeelfvi s sDrm(m ;o1alxo i3iadla rmnvsn()tetrio3oa1oa r i s;( s2xoxr ou1op nlfeia( artr(  oo1ape if3iadfs emuvon(4 ltoxf3tytfatr ieo t0 rxo(r3oo4amtn ieta(fsDurx pou1tlx miciytlaDra(vp;t0 exnmocoytfa   u s ( setmirpoo1lme  fvs s) 2tmxmoou1opt micils s2em(vsnt4 lxrmfcia1fmteluvolt)texrir3iydlltnmneil() ruaurp;u0oexomiciad s2rmu snt)teerio3oy1lp   nes t0 rur(m3ou4al eliesat)sDraum ou0teeoiictys a rmu s;u4aeerxrcio1lp  livi;t  2to(r3io4optelics ( srum(  ;u0tlxoifciys aDrluvo;()texrmf3oytfp rliei;() 2trxm3oo1ole  fct ()arurxmpno1altniociysfs2ulumon(4 lenxocootlp elnvi s t2uoxo nudaptelnei () Duru  no0optnmoetltfs2emumpn(0 reomrcoo1oaDe i i (0sexr(mpiu4altelietltfsDtru  oo0tlt mfeiyd m ra( pnt4tlxrifcio1om  aneol(  euo(m nu4altemicilsfaDrau pno0oex mieiad s rln o;(0 exoio3oytomDrlivo () 2xmxr3ny1ole lfvil()a2rmxmpot4alt  octaslmDrl( ont4 rxomocoa1omtraieol(0 euoxopoo4lm emicsl()a2rrx  ;t4texomoetlsfa umumo t4alxomr iydoptr ieslt t2tmxr iy1omte iesas)s2ta( pnu4tetoiieiltlaDelnvo;u)aeeomfcto1optr ivo;s  exm(mpoudlmtemfes t)s2uaxroot4tlt miciys m rlumo t4trxnir iotomDeau i t) exo(r3iu4ap nlict t)srraurp;u4alt micils s2emnvp (4trtnxo oatfat aueils)texr(opio4alenmicslsfa2ur(mont0olenifeild m uluvs ()trtnmr3oatomDrlivo s0s2urxm3iy4lmtelnet t) Dumx onu4opt  i3iys a2rmu s;(4tlxomo iodlp  auvsls0srxoxr3ou1lleelnvtas)s2tr(rpou0tle mi3iydla2umuvsnt4artnif iotopte n o s  rxmxmpou4omteliviat) rtau oot4tptniieiys a2ua( s (4 reoxrcto1lpt  n sl()t2urim3iodol nmfvilt)artauroot0ape  icils s2um(msn(4 etoifciy1fmD lnvi;t0srxo(r3io1lmtn ies ( aDur( o;t0ope  ietad a elnvo (4 ltrxf io1laDe u ol( trurim3nydam e ivtls aDua(rp;t1apeo i3iyt a ra(ms t)aeeomo3ta1oaDe uvs ( srur(opoo1op   fvslt aDrm( oot0tlt  fciysfs rl( p u4alenmf3tydoptr ivslt0s2tr(opny1lme lncsl() rum(mpou1alxnmictltfm2umnms u0trtnmf oatoate ivi s) rtmio3nu4ale mnvt (faDtrumoot4alto oeiasfa ranmpn(4altoxocoytlpDrlu i;s) 2xr(rpiydlm e nesl() 2ua(mpou0oetnmi3iasfaDumn pnt4 lenifcto1lm e uvi (0 euoxm3io1lmenlnes t)s2tmxr ;u0aeeniociltla ua(mp;(4aeermr tatopD  nvs;s) etmio oy4optelfetasfarrr(moot4tle mieilsfaDemumsnu) rxoxo3ia1fp rauvol(0teum(o3nu1openlictas  Dua( poo4aleomfetlt a uanmo;(0aeeomr iydfa rlnvi () rurimpoo4apenmfesltfarrr(mont0olt iietadfmDeln s;()alxomr3iotlptrlneolt)setoio oy4lle  fetat aDrauroot0alen f3tlsfmDumump;u4teeoxf3iodlateanes;()trxoir iodllenmfei sf Dtrxmo;t0olxn oeiltfs em(vo;u4arxoif ia1fatr ivi;s t2umxm oydomtnmnesa(fa2trurono4oltoioeildlm eau pn(0aleoxo3iatfat au ols)trurxo3ny4ale mies t)srrr(mo;t0alx ifcils sDrlnvsnu)tetrmfcootlmD ln ilt) 2umir3nydomtelnesa(fs2ta(m nu1oex moctlsfsDul(msn() etnmo iotfaD an sl(0 2toir3nudll e nvsat  2rau p;u1oexo o3tasfm ra( p t0 rtrmocty1lmDeai il( srumxr3nu1olt lneta(faDrrxmpou1tpenifeiyd a em( snu4areomr3oadomDrau i t trum(m3iydal emfcil() Dur( pnu4tee mf3ilslmDelnvo;t)trermrctodfatrln o;t0teuoxo ou4apte fvils s2trxmp;o1tleomfcilt s2eauvp (4 rerirctodfm eaivsls t2umxo3iy4lmt  ivil( srumx pnt4alenmfciytla eanvp (0 exomo3tadlmDelnes;s0 2uoim3iy4lleelnesl(farum(  ;t1teeoifeiatlsDuaump ()teerxf todfmtrau s;s)tetmimpnu1lp  liesasfsDtrurono0aex iocils s2em( pnt)artnmrciatopte uvs ( s2umio no4lleelnvta()s2raxm ot0ole  ocils m eanvsn()artrioctodoa ranei t)setm(mpoudlpe mneiat)sDraurpot4oexoioeiltlm2emuvo (0artrmf iodfm r ueo s)t2tr(m oo4lmtelfvi s) Duaxr no4aleo f3tatlm2ea(vont4 etnmf3tydfat  n i t  etoiopnydlmtnlfei s s2tm( ono0tlto oeiasfaDelumpnu4aeenxr3iytlptr n s t)trxm(rpny1ome mfvi s aDraxmpno4aetoiiciydfsDemnvp ()aexnmfciytlaDrlnei s srxoio ny4olenlneiat s2tm( poo1apt mo3iatlsDrmnmp;t) ltoio3iodoaDr u il() rtoxm3iudop nmfet t)sDtmurpoo0ale  f3ilsla2em( o (4artoiocoo1omtrlnvolt0tetmir3iydlp nlicils aDua( oot0teto fctadls ra(vo;(4teeoxf3tytfptrlies;() eum(r nodopeemivi (faDtrurpou1oex iiciadfmDulnvpnu0aetoxr3oodfptrln ilt) 2xmxr ny1lm e ics t s2rrxrono1oleo fciltlmDeanmp t)tltoif3iadfaD luvi (0 etmio oo4optnmiei (f rumurpnt4opt  ictatlm ul( s;t) reoio3iatlp  an ils s2urir nudlle lfct (f 2um(  ;o1tlx  fctytfsDrmnmp t) rerifciytop e u sl(0sruoio3oo1ll emfesa()s2trx oou1tetnii3ias m2rlums;t4trerifctytoptelues;s)sexrir3oydol   ivt ( a2ra(m ou0tptomieiydfm2ran o;u0 rxoxr oytlmt aieilt)t2tm(m3iodlm e nct ()a2rmurooo1texoioeiytfs2rl(vo;() exrmfciy1lmD anvs t0srtmxr nu1am nlfet sfsDtr(ro;o4tlx  i3ild m emnvs (4 renxr iadoptrli o s0seum(m3iodoleelncta()srtmurpou4oltoifetadfm um(vp;t0teenxo ty1fpt luvs t)s2trirpio1lm emici ()s2rr(  nu1aeeoiiciasfa rmums t0 exrmoctodfate n i t0 2xrxo nydolenmivi s) 2umx ont1aetn feias a2em(vp () eenxrciytfpDr nvi s  eurir3iudapt lfei t)aDtaxroou0tptnmf3ild a2rl(vp;t) rerif3ty1fm  aiesls)t2xmiopou4apeemnes (fa2ra( pnt4opxnioctysfaDulnvo;u) eenxr iatop  an o;t t2xo(o nodop  lnvtat s2tm(mo;t0tpx mieildfa2ran on(4teenxf3todlptelnvsls sexrxo oy4lp  lfeils)a2trxmonu1oeto octydla emnmo t4tlermfciytoa rauei t srtr(mpiy4lp  lnci t sDuax ono1teeo oetldfs2rln pnt) rtomr3oadla  aneo s sexrir3nu1op  mnei (fa2um( pot0apeniociysla umumo;u)aeerir oy1faD anesl( srtrxo3ou1om n ivi t sDtrxro;o4oexomoeiydlm2rl( s;u0tltrmocoydlatrlnvils teur(opno1llt lfeilsfs2raumo;u4texoiociaslmDra(vs (0 exrmocoa1la  aivsls0truriopiodapte nesls s2tr(roou1ope ifciltfsDrmn s u)tlxnmo3iotoaD  u o t  etoxrpou1optelfci (fsrum(mpoo1oee  fctld a umu p t0aleomf oytop   ueo;t srxrxm3ny4oltnmivil() Drrxmp;t1apt  i3tltla eau snt0areomrcoydfpDrlneilt) rtrxm3ny4lmtnlnvsas) Dta(r ;t1aexnmociyt sDemumon()tltnmr tydfa  lu i;() rtmio3oy1lp n fei tfsDtmu ono0oee  octasla ulnvpnu) lenif3totla  li i s0trumir nu4apenlnctlsfs2trurpot1olxn ociasfm2umnmpnt) etrio3todopD an o (0sruoxo3ny4olt  neil() Drmurpnu1aleoiociydfa rm( s;()artnxr3iy1fa r i ils0srtm(r io1lmeemnvi ( sDurumpno0opeo f3iatfaDrmu p;(0 ltrif3tydoaD  neslt0 euo(m ny4lp   fvsatfsDtmx  nu1aet mfctadfs2ua( ont0trxrxf3oa1optrai o;(0s2um(m3iydlptnlfct sfs2urxrpou1tleomietydfa2umn o;t0 etnio3tadoatr i il(  2urxo3nu4olee nctasfartaxroou1tltniiciytfs2rl( p;u0 rerir oy1laDrli o (0 euo(mpoudal  mnvsasf 2rax  no0opt  o3tlsfa emu pnt0 lerxf3oytopDeaneo (0 exo(m oudll  miesa(f rra(r nt1tleoiietls sDul( o t)alerir3io1omDrlieslt0setoxrpiy1opt mfviasfartr(mpot4tlx  oeiltfmDeanvpn()tlermr iydfa ranvols)trxm(o3nodal elict (f ruaurpou1aetnmfciyt aDea( snt) ltrxoctatlm eai i;t0s2xm(o3no4apt mfvt (faruauront1aptnioeild mDea(vs (4aeeomo3oytla eluvs;s)s2ur(o3nydoltelivi s  2rmx onu4oexoif3iysla um( p ()tleoxf tydfaDe n s;t) 2xmir3oy1lmenmicsa()srur(m oo1tpxo feiydfm eanvs;(4 rermfciatfatelivs t0 2xmxr oodop e fei t)sDrmum ou0oeenmicilslaDulnvo (0 rxnmf oydlat aivslt seuoio3nu1am emictls) Dtax o;o0oltomoctld sDeaumo t0artoio3iotfmte uei;( trur(r3oudlm emnetat)aDrm(mpot1tee  feiatfa2emump ()alxomr3iy1lpteanei s t2xmio3oudllee fvsasf Drr(r ;u0tetomictadfsDea( s t) lxrircootlp  auvi t trurxr3oy1alenlics ( srtrx  no0tee  o3ias aDrlump ()trtomr3io1late i s;(  exoxopio1lpeemict sfaDuauronu1opxo ociltfa eanmo t0alerxo iatoa ranvi (0 2ur(r nodlp  mivsa(fsrrrxroot4tpx mfcild s2ul(mp u4 rtnmr3ty1oat  nvo t) rxr(opoy4oleemnvt (fsDtm(ronu4ope mf3iltls ul(vsnu0 lermf3oy1lmDr ivolt  exrirpoy1apeemnvias) rtax  nu0oetomo3iyd s2um(mp (4 etrif to1lat lieils0s2urir nu4ll emfci s  Dumump;t0tptomietat mDrauvs;u4tleomf iytlpt aivo;t0 etmxo ou1ap e ncsatfsrrmumpot1apx io3iysfs um(vpn(4tleoxo3totfm  livi;t  exr(o nodopt lfetat srur(roou1opx moeiyd mDeln p;t)arxomociydlmteluvs;s0trur(m3nu4ap   iesa(faDumxm ;t4apeo feiyslsDul( s;t) exoio oydlp rlnvil() rtrxopiy4om  lfvtltfarua(mpot1alxo ociltfsDulnvpnu4treoxf3tydfpteli slt)trtm(rpiodaptn nct tfsDraxr ;o4olenmfeild s ra( o;t) exnmf io1fm r u s t)tetrxm3no4lpt lnesls aDum(mpnu1opx ifciat a2rlnvp (4 eeoif iodla e nes t)tetm(o oodopee fcsl( aDrrur nu1teeoifctyd a2rl(vp;(4teenmo3tydop eln o;()srxo(opnydap   ncslsf 2ur(root4aeeomo3tatls rln o u)aetnir3ty1lp   i o;(0 2to(rpiy4altelfetl()sDtm(moot0teto f3ildls2rlu s u)trxnxf3iy1lm  aueils)teumxr3nydaptemfesa( a2ra( o;t1tpxo ociltfm ul(vp u) rtnmrcta1lmtrlieil(0 2toirpiu1lmeemivtat)a2umu oot4tltniociydlsDran o;t) renxr ta1fm eli o;t  2umxopnu1aleelnvtas  2tr(m ot1oetnmi3iltfm ranmp;t4artrxfciadfm  aneolt0s2urxrpiy4lle mfcta()srurxm ou1oet moctlsfaDemnms (0 rtomrcoadoa ranvo;(  rtm(o3iudaltn fesat arurxmpnu1tee  i3iasfaDrmnmsn(4arxrxo iy1oa  aneil( s2uoiopiu1lpen fvs sf 2raumpou0ole mi3iyt sDua(mp u4 ltrxf tytopDeli i t0 rurir3iy4al n ncs s)srumxmpnu4tlenioetysla rl(mp;t)trerxo3to1optelies t)trurxr iu1optemnvtls)srrm( pnt4tptoifeiadlmDrlnmonu)tltrmf ootlm  aues s  rxmimpno1lm emnesa( artr(m ot0tle  f3tltls eau s (0artnxoctydlatrau s s t2uo(m3oydlmenmnci tfa2rrx  oo4altnmiciydfmDul( snu)teerio ia1faD lneo;() 2tmim io4apee fvsatf ruau  nt4apt ifeiatfa ean pn() leomfcto1opteaneils0s2umir3ny1oltelivslt)aDrru pno4alt mfeiltla2uanvpn(4tlxnxrcoytfptraivi;t sexo(r nudope  nesls srtaump;t4oeeomfctld s2rl( p (0tetomf ty1fmtr nvs;(0srur(rpnu4amtemict (f Drru pou1olt mi3tadfa ranvp u)alenircty1lm rlivslt0 eurxopnudamtnlfct t srtmu  nt0ale ifeiltfaDumnvsn(4trenmocto1lm elues () exrio3io4lmtnmicia( aDrmxm ;o4olx io3iys s rlnmp;()tltoxoctodfp   nvs;t  2xmiopno4lmenmiei () Dur( ono4oex ifctyt s2uan o t4alerxociadfat ln o ()t2um(o3oodol   nei t)arrru o;u1oleo ictlsfsDelumon(0tltrxr iodfa rlu sls)srumxm3oodol n fes t a2umur nt0tetomi3tlt a2ua(vs;u4arxnmf iodfptr ivs;(  etmio nu4amtnlnet t  rta(m oo4apeomi3iytls2uln snu4 eenxo3ta1lpt lueo t)s2xoxm no1omte iciatf rtm(rp;o1openmfcils s2rmu snu4aetnifciy1omt au slt trumir iy1oltn iciltfa2rr(m nt0oee iociad s2rmu o;u4 ltomrctatfp rlnvi t) rxmim io1llenlnct s)sDuaxr ;u1tle  oetad a2rmn s t0 rtrxr tydfaDeln o t  eur(mpoy4am  mnet tfa2tm(mpnt4tlt ioeiytfaDuan s u0aetrir tatfp rlueol() 2toir iu4lmte fvtasfa2tr(m nt0oetomieiasla uanmp;()teenxfcoo1oaDe ivi t) rtrxmpiudlm nlicils s2ta( pno1oet if3ias mDeanvsn(4teeoxfcty1lmDeliesl(0 rtmiopou4ale livilt sDrmumoou1tpx mi3iadla2ulnvs;u)tltnif3iotoa rauvs s0trxrim ou1al elicta( sDtmum ;o4tex  ociasfm2rluvo;t4trxomf3iadlm eaieo;t0 eto(rpio1lpeemfei s) rtr(root4alxo ieiyd s2ranmont) lxrmfcia1fat auei ()srum(rpoudalt lncias)aDrmumo;t0oexomfciysfsDem( pn(4 reoircoadla e u i (0 eur(mpoydoltnlfcslsf 2trxr ot0altniictad aDra(vont0artnmfcoatfateai s;t) exrirpoydolt  ies ( a2trxmpoo1tltoif3iadfm ra( o t4areomfcoydom  aivs (0s2xr(o3no4lmenlicilt)sDra(  ;o1tpto oetltls2ran on(4 leoircia1fmDr ivi s)s2xrirpnu4lltnmnetl()aDumum ot4tpeo ocildla2rmn ont4 lxoxo iadfmteaneilt  rxoim3nudlp n fvs t) rtmumono4ale io3tysfaDum(vs u)tlxrir iy1lpDrli ilt0t2uo(o3oo1olee nci ( sDtm(m ;o1alx  o3tltlm2elnmpnt)arxomr ootlmDeanes;() rxmiopny4am emfes s  rtaxmo;o4tpeoiocild m2um(vo;(0tetnxo oa1opD au o;(0 exmxm ny1ll nmfvt (  2raumo;t4oee ioctadla2elu p t4tlermo oytfmt  iesls) euoir no4llenlnciltfs2rmumo;u0oeen ociadlmDrau p;u4aeermf oydomt  iesls)t2urir iy4ome lnctasf 2ta(mpnt4olxniictldfs2elu pnu0altnmrcia1op  anvslt) rxmirpiu1alen ici t  rtrx oou4aetomi3iys a ulnmonu0aleoxf3ia1om  aivols0trtm(o3ou4oleemies (faDraxm ;t4altoiociad a rmumont0trenir3todfp  li i t trumxm3nu1lmen ict ()srraxm ;u0aleniieiytfmDemnvon(0 leoiociodopDe n ols)trxmim oo1lmenlnesl(f rtrx oot4apeo f3tltfs uau p t) renxrctytfp rau i t) eum(m3io1lp nmnetlt) rrmumpnt0alxnmietldlm elnvs u4 leoxocootfmDe ieo;s0trur(r3nodlp elfcs t) Dtmx  nu1oexo f3iyt m2rlumo t0tetnmf oo1faD anvo s texm(opoudope  ncia(f Durxrpno0teeoiieiatfa2um( s;t) leoircoo1oa eai s ()srxrxm3ou4alt lieta() rtrxm nt0teeoiicilsfa2em(mo;(4 etomr3iy1lp rli i s teuoiopoydop elfcilsfsDta(r ou4aleomo3iys a2rl(vo;(4trtnif iodopDrli sls  2xmxm iu1ap n ici s sDur(  oo1aleomi3tltfmDelu o u) renxoctydlm rlieo (0 2uoxm3iy1apen fesl() Drm(r ou0olto ieild a umu s u)trtrmo3oytlmD ln s s tetm(m oo1lm  mneiatf 2rmxmpnu0apenifctyt m uan p;t4 lxoxf iotlp rlies t t2uoir3nudom  miei t s2trxr ou1tlx  i3iysla umuvo;t4texnxf ia1om eaies;s)srxmim3iudol nlieias  Dtau ono0tle mocilslm eln pnu0 lerxrcty1fm  lieslt0 2xm(m3nydol nlnci t artaxrp;u0oetn iciad m rm(msnu4tltrifctodfp   u o (0teuo(o ou4lm  mictas)arrm(r ot4alx iocildla rauvp t4 ltnmocoa1lmtr u olt0 exr(mpoodlpeelnvilt  2tau pnt4tleomoeiltfaDrauvo;u0 lxrio3tadlaDr ieol(0t2xo(mpno4lmee fcsl()arua(rpnt1aet ioctas sDrln p;() ltomf3ta1lat  i o ( s2trim oy4ll  livi s)aDraumoou0aetn i3iydla2ea(mp t4 rermo oatoaDr nes;s)trto(m nodom e ics sfa2ta(mpnt4opx  fetat s ra( onu) rxrifctatfmDe ies t)texm(o oy4ol   fetatf rrmxm ot4aexniociydls rm(vonu4tleoif3to1lpDrai o;s  rto(r oy4optn ieta( s2rmxr ;u0texomfctydlmDulnmonu)treomo3oatomDeanes ()truo(m nu4op nmfvsl()sDum(ronu1aeeoifctltfm2ulums;()tltnmo ta1fptr nvolt0srurxmpnudop n neilt)srur(mo;u1teen f3ilsfa umnmsnt4 rtnxf ootfmtranvilt0 rxoxo oudal  licsat aDumx ooo0aee mfctydls em( sn(4 rermociytfa  aivi;t trtrxm iu4lme lnciatfsrraxro;t4oeen f3tadfaDean snt4alxoir iytopDr u s;s)t2to(m3nydlm  lfvt sfaDtaxr nt1oleo iciysfa ranvo u)aeermociatopt  ieo s0srxr(rpiudal   nctlsfaDraumpou4tpt  fciytlaDemuvsnt4 renxo3oa1fm   iei;t texmim ou4alenlfvt ()aDua(m nt1oleoioctlsfm2ulnmo;t0aexomr3oatfatrliei t0setrxmpiydopenlfeilt)a2ta(  nu4aeeoiictas m2rm( o;u0 eeoio oy1la elneils0srxrir3nydlpe  fcs (f 2uaur ou0apenmfeiatfs umumpn(0 ltnxo iotfaDean o;t)s2tmxopiydaptnlnctasfsrtrx  nt1apeo f3iltfa ea(mp;t)tlxnif oo1laDeluvils)teuoir3nu4alt  fetlt srraumpot4tpe  oeilsls uln s;t0altnmr3oodfm eluvslt0sexm(mpoudoltnlfvils artaum oo4tltomi3iytfm emnvo;(0aexomf to1lmD an o (0srtr(m3oo1lp emnvsl(fa2uax oot4tet mi3tydfaDuauvp u0alerxr3tadfm  lnvilt t2xmim3iu1om nmivsl( a2rmxm nt4altoifciat s2umn snt)areoirciy1lp elivo;(  rxriopno1alenlivsasfs2rrump;u0ape  o3tydla2umuvo;u4tltomf oy1fat aivs t srxoir3iodomt miesas)arumxrooo0altnif3iatls2rlnmp u0 lenmr tatoat aivols)teurxr nydam  lnvi t)aDuax  nt1apx mo3tld a2em( o t4 renxo iadfpt aivo;t srum(r nydll nlnci t a2ur(  nu0optnmo3iysfa2rmnmpnu4tlxnxfcoadopD anes;t0 2tmxm3ny1ap n fetltf 2ur(rpou1aeeomf3tysfaDuluvs;u)artoxo3oatop e uvils0sruoxr iu4om nlivtas) Dtmumont0opxnifeildfs elnvp u4 eermo3ootfptrlueols0 eurirpnu1amee fcslsfarraxmoot0oleomo3iasla2uau snu0trtoxo iytlat lieols  rtoim nu1op   fvtat)sDtmx pou4opto fciatlmDrlnmp ()tlxoxrcoadlpt lnvsl() eurxopnu1oleelivs (faDrmu pnt1alxnmfeiyslaDumnmo ()arxrir oo1oaD livils0srxmxrpoo4lptnlfcilt)sDumur nu0alenmf3ild mDrl( snu) lenmf3oytlmD anvo;s)t2toxr ou4ll n icilsf rraumpno4olt mi3iyd s umumo t) ltnxoctatlaDr i ol(0 rtmxm oodom   iet s a2uru  ;u4opxomfeiasfs2umn p t0 lxomf3iodlmtranvo t)t2to(opoydlme  fcils aDtmxront1tet io3tadfm rm( o (4tetoioctytomtelieo (0srxoim3iy4ome lfvtl() Dtrumpou0openmoetlsfmDumnmpnu)arxnxfciytlp  lu i t t2xrir3oudllen feiatf 2ta( ooo4apt mictad a2umuvp (0 leomociy1latr nvols  exoxm3oy4al e ivia(fsDtrxrpnu4openio3iadfm2rl(vs u4alxrmrcoatlpD ai ils0srtmxmpny4lme liesl(f 2taum ;t4tleo ictysls rl( o (4tltnxf oy1fptrli i t)srto(o oy4al  lncs ()srrmu  ot0ape ii3tlt m eauvon(4tetrxo ty1fmteaues t trumir3iydop elieslt sruax pnu4aeeniietltla ul(vp;t4trerirctadlp  li i;(  2xoxr3no4open net t)arta(mo;o4aleomoeiat a rau s (4aexoir oy1om  lieo;()truo(mpno4ale  net sf rtaxroou0tpeomfcild s2rauvs;u) exnxrcoa1fmDranvo;s trum(opiy1olenlnei ( sDta(ront4teeoifctas m2emnvonu0trxnif iotfat  ieo s)s2trim3nydlp elncsa( arum(m oo1tet ifctyd m2um(von(0 etoir3tadoptr i i;t) 2tr(mpiy4olt licilsf Dtmx  oo0olxomietldfm2rluvp;t) rtoxf3iatlmDr uvi t s2trirpou4lp emfct t)a2uaxr oo4oet  f3iyd mDean snu)alenxo ia1fm r ivslt) etr(m no1lmtn ici ()sDraur ;u0aeeoioeiyt m ran o;(0alenxf3oatoat aiei ( seurir3oy1lp elncslsfa2uaxmoou0aex ifetatlm um(von(4trerio oa1fa e ivs t s2xoxrpio1lp emivils  rtrumpnu4oet if3tatfmDrm( snu0artrxfctotfpDraivils)tetmxr3iy1ol n fes t) 2taumpnu1oeto o3ild s ua( o;u0artrmfcootoptrlu s;()srxmxmpiydap emici tfaDtmxrpoo0tptn o3iyd a rm( snt) rtrxrcoy1lptraueil()tetrxo3oo1omtelivt t)a2umumoou0aleo o3ilt m2em(mpn()artrif3ta1op eaueo t)srurxopnu1lpt  nvtasf rrm(rp;u0tlx ifctlsfa2emnvpn(0tetomr3totop eaieo ( srxrio3nu1ll nlfetlsf Drax  ou4oltnii3ildls2uauvsnt0 rtrxo oo1fpDrlivs t0srtrxr3ny1ame mivtl( a2uaxr ot0alxn oeiasla ranvp t0alerxrctodom  auvo;t  rtrio3nu4apt lfvil() rua(m oo4tpxnmictatla2ea( ont4aetnif io1lmDrai s ()trxo(rpoodol   nvsltf rtmu pnt0ale ifcias mDumnmpnu4teeomrctydla   i o;t) etrim nudoltnmnci tfaDuaum nt1tltomoetldfa2rlu s;t0aeenxfcto1opt auvo;t0texmiopiy1am  mfes () rtaxm ;u1opxomfctld mDra(mo;t)arerxociodlm  au s;()tetr(mpno4amtelneils)sDrm(ronu4tee  ociadfaDelumsnu0texnxrctadfp  auvs;s seto(mpoy1omteliviasfa2uax  nu4aetoio3ilslm2rmumsn(4 etoxf3oo1lmt lnvi s0s2tmir3oydaptn nctat  rrrx ont0tpxnmo3tldlm2ranvs (0trxrmf3tadoa eln o;()tetrxrpnudap emictltf rur(r nu0alxo ieiltlsDumnmpnt4tlxrif3iy1optelneo (0srtoxopiu1lptelics (f 2raxm ot1aet  f3iatfm2rmump ()tlxnio totlp rli o;t)seum(o iy1alt  nctl(faDrau  nu4alenio3tys a ra(monu)altomf3totoaD auei s)t2tmxo3ou1amt  nviatf 2uaxrpnu0tpto f3iys s el(mp t)arxriocoadopD lu o;s)sexoxo3nudape mnvt sfartau  no4apeomoetad m2umnvp u4 rxnxrcoa1oa raues t0sexrio3iy1amen ivtlt)arrmx  nt4aptnio3ias s2ul(ms;(4trerxr iotopt anvs;t0t2tmiopny4lpenlfeia(fs2uaxr ;t4apxoiietldla ua(ms;u4artnxrcoatfmDr u i t  rurim ou1altelfesas aDumu o;o0olto oeiltfmDem(vp t)trtnxo3oytlm raneilt  2umxo iu1ameemneil()aDua(mp;t0tpeniicilsla eanmp;t) ltrxrcootlaDraiei t  2xrim no1op n feiat)sDrmxr ;o1aptomictatfa uluvo;t)tlerif oydoaDeliei (0srumir3nudam n ncil( srrrx p;u4apt micildlm2em( p t0teerxrcto1oaD  i ils0 rtm(o nu4altnlfetas sruru p;t4oet  feiydlmDrm(vonu) lxnmfcoatlpteaivs t teuo(rpoydllt  ieta() 2uaxmpou4ope ifeiyd aDulumsnu4arxnifcoytlm r n o;t sexm(rpny1ame mivslt a2ur(mp;t0opeomictydfa2em( sn()trxnmr3oy1opD an i t0 rtoimpny1lpenlivs s)artr(rono4opeo oeiatlmDra(ms;t4aexrmociadfat livs;s0trto(m3oudapte ivsltfartrxm nt1aet ifeiltlaDulu s;u4 lxrmrcoydfpDe u ols texo(m3iu4al n ies sfsDtm(mp;t0apxomfeiadlmDra(vsnu0 ltrxr3iytfm r nes t trxrxo ou4oltnlfctl( s2rmxrp;o0apxn feildla rlumont0 renmfctydlp elivilt  etriopnudlm   fvs tf 2uau oou4oleomiciadfs2rmuvonu)altrxf tydlm  ai ils)srurimpnu1llt mnet t)s2uaxr no4tle  iciysfaDea( o t)trtoir3iotfm  an sl(0 rtmim iy1al n nvils)artrur nt4opeomfetld mDelnvsnt)aetnmocia1fa rau ols0srtrxr ou1open ivs s)a2uaxrp;t0aetomictydlm ranmo u0 eenxfcoa1optrlneo t0t2umxo3ny1amt mfct s s2tmumpnu4oee  fctlsfs ul(vs;u0 rxnif iy1lateaieol(0s2xmim3oodameemfvtlt  Dum(r ot4aetn f3iatls ea(mo;u4arxnmo oodfat anvi;()srurxmpiydoltn nei (f rraxront4tpxomieiasfa rlnms;u0trxrio oy1opte ues;t0seto(r3oodlpt mfes s)s2urxr oo4olxnmfeildlm rmuvp (4 ltnif3totlm ranei;s)trxoxr3ny1lp nmnci t) rtaump;t4ape miciasfs um(mpnu0 lxrmf3oy1fmteln o;()srxr(o3io1ol elnetlt arur(m ou0olen iciatls2ulnmsnu0 etoio to1fmtrlnvslt teto(mpnydlptnlneilt) rrax onu0olto f3ilsfmDraums (0tetomf3oo1oatelu sl( t2um(m3oydol nlncsa() 2rrump;t0tee ii3iadlm2rlump;u)arxnxociy1omtelieo;t0s2tmir nodllee ncsltfaDtm(monu0tlt ioeiydlsDua(vo u4tetoio3tadopD ai i;s0 ruo(o3iy4altnlfcsatfaDta(m ou0opxomoctaslmDrm(vp;t) rxrif3tytopt  ivs s trtrim oudam e ncilsfs2rruroou4apto i3tas a2um( o;(0 rxnif oydlptr ueo;() 2xrxm iu1optnmnetls)a2rmxm nt4apto i3iydfm umuvs;()alenif3tytomteanei;()trtm(opiudlm n feta(fa2ra( o;o4opeo fetydlaDem(vs u0tltomo iatla ranei s tetriopnodapt lneils) 2tr(mp;u0tltomi3tas m2raumo;u)arxomfctytlpDelu i;s0texr(r3oo1lm emivilsf Dtaum oo0opxnio3iltfsDul(vp;(0altrifcoy1lpDeluvi t  rumimpiy4al nlfeiat) 2tmuro;o4alxnmfeiyd aDranmont0arxoircio1oa   u s;s t2xrxm iodomen ivs s) rrm(mont0oeenifeils sDul(vp;u0arxnif oa1fat au s (0s2uoim ny4al elietasfa2rruro;t4teeomiciydla2eauvs u)aleomo3to1fpDr ivo s tetr(rpiy4omt miei sfa2rr(rpno4ole  feiaslm2umuvs;(0alenif iatlmtr nvol( setrxrpiydoltemnvslt)aDtaur ;u1oleomoeilsfm eluvpn(4aeenxrcoydoaD lieslt)sexr(opio4ol nlfeil()srurum ;o4tlenmi3ilsfmDrmumsnu0 ltoif3oa1latelneo;s)srtmxr3nydop nlfvtls artmxr ;o0ape  oetlsfaDrlnmsnt4teerxocta1opt anvo;(0t2trio ny1omtelieias arrrump;u4tpeo i3tlslaDrln p;() rtomo3iadfp  lnes ()texmir3oodlmtelnctatfsDta( pou1alxnmietyt m ulnvpnt4 exnifcta1omDr uvslt  2trxrpnudap emfvsltf rtm( o;o1tpe  i3iydlaDelumon(0 rtnmf3ootom raueo s) 2xo(o3nu4ome  fcsl(  Dra( pou1aeeniiciysfaDeanvp;u) reoxo ta1lpDraieol(0tetmir3iydale mfciatfaDtm(rpot1tetniictatfs2el( s t)arxrxf oa1laDrli s s)teur(r nu4ameemictls)srtr(roou4oleniiciasla2ranvo t4trtrxrciodoa elivo ( srxr(r3iy1olt  ivsat) 2umxmonu0aet mo3ildfs2rmnmont0arxrmf to1lmD  uvil(  2xrxr no1amtnmnvsasfs2uru  ;u0tlto f3tltls2umnmont)aeermr oydlm eai s;s trxrim oy1aptemncias  Duaxm ot0ope  iciys s eau o;u0tlerxr3tadlmte nes;t s2xoxm3no4lmee ivtls)s2truroou0tleo octltls2ranmpnt)trxrxfctodfm  ai s ( sexrir3oy4lme lfeiltfsDtmurooo0aee ii3tatls ea(vs u4 lxoxo3iatlp elivo;s  rxrxo iy1amenmfct tfsDuaur nt0aleniociadfmDem( p;()aleoxf3oatfat aivo;t  rxmxopoydame  fes (f 2rmur ;u0olxomf3tlslsDrmuvsn(0 exrxf3totfp  luvo;s0 rxmxrpoudlmte ictls  2raurp;o4olenif3taslm2rm(vo ()altnmf3ty1op  liei (0s2uriopnu4apenmnei (faruau  ;o0tetomfeiytfm rmnmp ()aeenmo tatfmD luei;s0t2uoiopnydomtn fet sf 2ur(mo;o1tpe if3ils a2ean p;u)aetnifctodlaDran olt srurir iu1llt  nvt tfa2umu  nu1aetnmfctys sDelu pn(0trtoio ia1op  anei (  2triopnydllte fvtlsfarurum ;o0optnifciydfa ra(vo u4trtoxfcto1lm rluvs (0seumxr nudlme mfcil()a2rru pno4opxnmo3tysfa2ulu snu)trxoxr3iadfpDr nes s  2umxr ny1al nlfetasf rra( pou1optnif3ildfsDelumo (0tlerio iatfaD anvo t0trxoir3oudlptemfvtltfarta( pnu4apxnii3ild s2rl(vpnt0 etoxr tadfp r ues;() rur(o iodole lnesls  2um( ooo4altnii3iyd mDra(mo (4 exomrcoydoa r n s;t) etrir3iu4lleeliei (fsDrru ooo4alx ioetlt a ea(vs;t)alenmrcty1lp  aivilt)texmio iy1aptnlnetat  Draxronu0tlto fciatfsDumu s u0altrxr totfpD  n o;t)sexrxmpnu1lpe lnctatfa2taxro;t4tetoiiciat aDeln p;t0arxrxfcoadfpD aivslt)t2xrimpny4op   ietas)srrru  no0oltnio3iyt s2el( o t)aleniocoa1fmD  uvs s)seuoir3iy1ol   iviatfa2ua(  oo1tet iicilsfmDemuvo (4trxnir oatfpDr nvo (0s2um(o ny4lme mnetls) Dum(mooo4tpe mo3tldfa2rmu p;(0 etomo oo1faD  n o ( trum(r nu4ap n nct t) 2rm(rpnt0opxoifetld m emnmp u4 eenmocootom  anes t0 eur(m oy1lleemiet tfs2rm(m nt0tpen fetltla2el(vo t0 rtrmfciotfatr ueslt0 eum(mpiydapeemfcias  Duax  ;u4alenio3iaslm rauvp () lxrir iydlpt luvi s0t2tmimpiudalt lfes ()srrrxm ;o4oetnmictlsls2rau ont) ltnio3oytomD livi (0seumim3oo1om elnvta() 2umxr no4apeo oetltlsDran snt4aeeoircia1omDr u i ()t2xm(m iu4ol   netatfsDtrump;t1olx  f3ildls umnmonu) eeoxociy1fmD ai s (0sexr(mpoodome lfesas) ruaxm ;t0opx iictadlm2rmnvpnt)artoir3ia1lm rai s s0 2tmiopno1alenmnes (  Drr(rpnu0ale mi3iatfmDelu pnt)alxnxrcoo1lpt  u i;s  rur(r3iy4aleemnvslt a2urump;t4oltniociydlm2em( pn() eeoif3tydoaDrluei s) exmxr iu4amt  nesl(f rua( onu1alxniociyt a2rluvs ()trxomoctydfpD au s;s tetmxopoodlm nmnvil(  rra(  ;t4oetn oeiadlm uau pnu4 lenxr3iy1oa elnei;( srxrxmpny4lmtn icsatfs2taxm nt0alxomf3iysla rl( p;(4tetrir3totlpD  i o;s) etmir3no1opt  fvsl(f rurum oo0tpt micilt m2ulumsn(4aetnxf ia1opteaieslt  2xrxm3oo1altnmnesl()arta(m no1oetnifciyt mDul(msnt4 lxniocoa1op  aneo;t) 2xrir3iudlp nlnct t arum(m no0tpeomf3tytla2umuvo;t0tlxnxr3ootlatelues t)sruoir3oo1lm nmnvsls  rua(ro;u4alen fetlt s eanvonu0teeomoctydlatrauvs t trtmxr3iydop nmnvtl(faruaur ;t1tpxnmieiytlm eauvsnt4treomr io1omD  n o t)tetm(m3nu1lm nmnetl(  2ur( o;o1aeen ietltla2ra(vs u0treoio3ty1om eai s s  2triopoudamen nesa( aDumu  ou0aet  icildfs2uauvonu)trtomfciydoaD an slt)t2urxmpoodap emivtl( arta(r ;t1opx moeiad mDeau s (4tlxrio oytfaDraivi t0 etoxr3ou4lm nlicsat)sDrmxmp;u0olt ii3iytlm2elnms;(4trenio tytoa elu o;t  rxrirpiu4ll  mivta(fs2rmump;t1aeto ieiad s ul(ms u4 eerxrciydlaD li o;s seurxm nydole micils a2urur ot4oet  fciyslmDem(vp (4 rtoio oodlptelu o;s0 rtoxo3io4lptnlfcsls)arrauro;t0oeenmietatla ea(monu0 etoxo3iadfptrlneo;s0 euoir no1ol e fvtlt sDraum nt0opt  f3ils m umnms;t4tetomrctydoat anvols)trxrirpny4ome lfcia() 2rrx onu1alx  feiatlmDelnms (0 exrif oadop   ieilt0t2uoxr nu1lmtnlnvtls  2uaxmpoo1ape mociaslm eln snu0 lxrir3iatfmD auvs ()trtrxo iy4lmenliet t  Drr( poo1opt ioeiydls2rluvpnt)arxoxocoytlaDeluvo;t)tetm(o ou1lm nmnetls) Dua(ro;u0tex mfciatfs el( p;(4texomocoy1omD li ils trtrirpoydole  ivsat) Drm(ront4ope mf3iatla2rlu s;t) rxomf iotfatr ies s0 rtrio3nudap emictatf Dua( pou0apxn i3iys s2uluvs t0aetrmrctotlp  aues (0srtoio3iu4om  lfesa( s2urx oou1alenii3iasfsDrlu p (0 etnmo3ta1lpDr nei s)seto(mpoy1apt  ieslt arraxrpoo1openmo3tyt m em(mo;(4 rtoxocto1faDranvs t)teurxmpou1ol  lnetat srrax  ;t0aexnifeiadlm2rmumo t)aeeoifcio1fp rlnvsls  eto(m3io1lltnlici ( srraurpou1aee  iciysfa rm( o;t0 lxoxrctatfptelnvs t) 2umio no4am  mfctasfsrtm(rp;u4ale iociydfaDel(vp u)aleniocto1op  au s;(0 eumxo iy4lp n ieilt srua(roou1tpe ioctadfa2elnmp t)tleomfcoa1laDe u sls0teumxopoy4ap  mivt t)srra(rpoo1ole mi3iatfa rmums u) rerxf tydfm rluvolt)sexrxopiy1ll   feiatf 2rru p;t1oex mi3iydlm2uaumo u0treoxo3tatfa rauvs ( s2umxm io4opeemictl()a2rau o;o0aleomf3iasls rl(vsn() rxomo ootfmD an ils  2uoxr3oydomeemncs t)sDtr( pou1oexnmoeiltlm eau p;(0 eerxr3ty1lpDeanvs s  eurxopiudlmtemnciltfaDtm(root0alxoifeiat a rln pn(4tltomf iatlm   ivo ()t2umxo3oy1apenlivi (  Drr( pou0alx mictas mDrmump;u)alxnmf io1fp e n i ()t2xrirpiy4omtn nvsa() 2rr(rpno1teto f3tyd sDum( s;()arxomo3ootlp  livs s)s2xoxopio1op elfetat srraurpno0apxnio3iyd m emu s u)trermo tadfaDeln o;( s2uoim ny4ame mivsas s2raxrp;o4tpxo icias mDrmu s;u0altoxr3iatfm  ln ol(  rto(m oo1am  lnesl(f rumuroou0tptomf3ildlmDeauvo u4alenmr iotfp eluvi;t0 rxrxo oydolt mivtasf Dumuro;u0tptnioeiadfm2elnmp;t4alxrxf3iatomt lu i s)srur(m io1llt mfetat)a2tm(r ot4tlx mo3tytfs eauvp;u0aleoiocio1omt  nes;(0t2trxr3ny1lpenlivtls)s2um(r ;o1ale mieiadfa rlnms;(4texrmf3iatomtrlneo;s seumir3nodom  mfes ()artaxront0tpx iociltfmDul(vp;(0aexoir3oy1faDran o t) 2trxmpio4om nmnvsltfsDumuro;t0texnmfeildlm rauvo (0arxnxo io1oa eaivilt) rurir nydop elfvtat artaumpoo0tlx  ieiat mDrlu pnt0 ltrxf to1fat aiesls  2uoim3io1ole liet tfs2rmxr ;u0texnmfctasfmDelu s;() ltrmr3iotomt liei;t0s2urio iy1lmenmnctat  2tr(rpnu1tpe mf3iydlsDea(vpnu4 rtoir3oo1lat lnes;t0s2xo(o no1ll nliet sfsrtrumpoo0tleomiciysla umumsnt0aleniocoadlpDe ivi;t srurimpiu4omtelfet (fsDraxronu1aexomociyd a2umnmo;t4tlerxf3oydoptr u i t seumio no1lme liet s)arua(moot4oleo iciyslaDua(ms;u0trerir3oadlmD  uei t s2xr(m iy1aleemfeslt)srtm(  ;u1ape ioetyt a emnms;(0 rtoxfcoa1op rlnvi s s2tr(o3ny1lme licil( s2ururpoo0optoioeilt aDulnmsnu0 etrmociy1lptrluei;( s2toiopiudol   netas)sDtrxmo;t0tlxomiciys a2el(vo;t4tetnxr3iy1latrliei t0 2uoir oy4lm  lnct ()sDrmx p;o0tptn ietas m2ua(mp t0 ltomfcoydfatelu slt s2xmxo3iu4ole lnvt (fs2tm(m nu1optnmicildlmDeau p u)aexomoctotlmDr ieslt0t2trxo3iu1lp n ncia( srumxmont4tleomictlt m2em( snt0aetrircoy1fm r nvs;( srxm(m3nodlmt miciat) 2uaxm nt4opt mo3tys mDum(vp (0teerio tytoa raivo ()tetm(opiu1opt miet tf Dumx o;o1aeen ieiytlm rluvsn(4aexrioctytlmD  uvo;s) euoim ou4opt mfcslsfsDrm(mo;t4alxnii3iytfsDemuvs t4 exoir oadoaDeaivsl(0 rtoxrpiu4olee icsl(faruax  ou1tlen iciytfs uau s t) eermf iadfat aiesl(  rxrxrpiu4amenlfetat  Dtrx poo0apxomfeiasfa em( sn(4texnxo3oodfmt  u ols0 euoxm3oodaltnlfvtl(  2taurono4aetnmociasla2uaums;u0alxnmo tatlptr i i;s)sexo(o3iodoltelict tfsrra( ont4aexniietlsfa uluvsn()aexrxf iotomDe u o s0srurio3oodlp nlicils arurxrpno4teenif3tatls2umumon(0arxoiociy1om r nvsls setrio3iudlmtnlicia(  Dtr(rpoo4aeto ociyd sDrln o;t0arxoxrcoydfp  luvolt0sexrxr nudllen fvt tfarta(ro;t1oleomf3ildlsDeauvp;(0 rxrio3tytopD  ieo;s) 2xr(opnodap  lfvsa(  Dua(r ;o1tle mo3iasfs umu p;(4altoxocoy1lpD luvs s0 rxoir3iodlle  ivil(f rtmumpot4apt  ociytfsDulnvonu0 eerxf3iy1laD ln o t  2tm(opoy1lme  fesa()s2urum no0tltn octad a em( s t0 lxoio3iodfat  n il()tetr(rpiu4om emfcsat) Drrxr nu4tetoiictatfsDumuvo;t4 lxrmf3tytom elneilt s2urim iodlmte ivsasfarur(mpnu0tpxnmi3tltlmDrl(vpnu)trenmr oy1fmtraiei;()srtrxopnodllee iesa()artm(rpoo1aexoiociyd m rm( pnt4tlerif3oodopteauesls t2uoxo ny4olen nvi s)a2tmu onu4optn feiatlaDum( ont0arenmr iotlptr nvs s0s2xmxrpio1om   fvta( s2rmxmp;t4aleoioeildfm um(vont4alenxo oa1lpteau ilt)srur(o ny1llen ivil()srtrurp;u1olt  ieiysla2rlu pn(0 rtomrcty1om   i sls0tetrxo3nodlmeelfcsas sDurx oot0alxn ieiysfm2emu snu4aleomf3iodomDr ieslt s2xmir no4altnmivslsfsrumurpno0aexomo3iydfm2uln p;(4teenxf iatfaDeaivs t seurxm3io4om elfvta()sDta(r oo1tet  fciyd s emumo;()tlxoxf3tatlpDeluei;t  2urio3oudoptelivilt)a2taurpou1tee iieiat s ulu on(4 reoir oadfpteauei;t0seumxm iu4lmtemncta()sDraurooo0aexomfciatla2umuvs;(4tetrxociadfm rli i;t seuoio3iy4alt mnvsas) 2tr(m oo1oet mo3ild a2umn p;t4trxomoctytopDrlnvo (0teto(m ou1oltnmnvt sfaDua( o;o0teto ietls s rm(msnu4trxnxf oodlptranvo t0 etm(opnu1lpe  fcias)a2uaxrpou1tpe mi3iat a2umu snt0tltoxoctydopD an s t teurxo3iu1ll elivil( sDum( oou0opt moctltla ran pnu0texrmoctydfmD an ilt)truo(m3nu4ol nlietatfaDuaxr ;t4tpeoii3tadlsDrauvs;t4altnioctydfm elivs (0 rxmxmpiy4lpee fvsas) rtm(m nu0alx  i3iyt aDra(vo u0 rtrmr3oo1fmte i sls trto(r3ny4lm emnesltf Dur(  ou1tpx mociasfs2uaump;t0artnxr totom  auvs t trto(m3ny1om   iet (fa2tr( ono4altoifeiyslsDea(monu4aexomfcoo1lmt  iesls  2um(o ny1lmeelfvs s) Dra(  ou1olxn fetltfsDel( s;(4alxnir3tydoa eai s s0 exoxo oydoleelnvi tfsDum(rpot4tex  f3tatls eauvs;u0altoifcoadlmDraiei (  2toxo oodome  neiat s2rr(moot0apt ifcias s eanvs ()tlxnmfciytla  aivi ( s2trxm iu1lm nlnetltfsDtru  oo4altnmociad a2eanmp (4teenxrciatfptrau o (0t2xmxm no4om e fvt t)arua(mooo1aet iictyd mDeanmo;t4alxrio ia1latranvo;()trtrxo oo1amenmies sfs2rmxmpno0aptoiietlsfm2um(ms;(4 etomf tydlm   i s s) ruoxo3iu4ap  lfct s)s2tmu o;t0tpeo i3tltla ua(vo u) rxnxf3oodoa  auvsls0trxrirpoy1omtn nvsls)s2ta( p;o0apxo i3tldfsDuanms;t0alxnifcoadomteauvsls) exoir iudlleemietasfarta(rp;o4oetn octlt mDrl(vp;t) eeomo oo1oa rli ilt seuoim3iu4lmtnmnctltf Duaumpno4aptomfciyd s2ulu on(4 renxfcootfa  aneil()texoxopnydape mnesls sDrm(r oo0tetoii3iytfa rmnmsnu)tetnxf io1lmtrauvi;( truoxr io4optnlicsas arta(mpoo1aeen feiatlm2el( snu4 exoxfctatlp e n s (0s2urimpoydlmeelieil() Durxr nu1alx  fciydlsDeau pnt0trerio3iy1omtr u slt t2um(mpno1ole mfcs t srum( oot1ale  f3ilt a um(mo;u0trtnxrcto1lpDeaneo;t0 exmir3iydalte fei s sDurxmonu1aex  i3tatla uanmo t0altrmf totfat ai s (0 rxmimpnu4ameemfvtltfa2ta(m oo1alxoioeiydfsDelumont0 eermr3ia1fpD aivo ( s2uoxmpnu4amtelfvta() Dtax pot4tpeoii3tldfmDuluvs;(4 rxrxrctytlpt au s;s)s2uo(mpoy4ol  mivs s) 2raurp;o0opxn feiltfmDulnmp;t0trxnmf3iadomtelneo;s)srur(r3ou1omenmfctasfarumum nt1oleniociasfa uln onu4 rtnir3iadla e neils) 2xrxm ou1openlivslt)s2raum oo0tltoiociytls emnmo;t) lxoifcta1fptelnei s)t2tmxopiodoltnliciat sDrm(  no4oexo i3tls s2em(vo u)trtnxf oatom e u slt)srxmirpou4olteliesas sDumu o;u4tetn fetat s2ul( pnt) lxrxfcto1lpDeanei t trxrxr3iudopenmfci t)arra(m oo0tet mfcildfsDrmumpn(4arerxf ootfpt  i slt trxr(rpiy4lpenlnvtas) 2umx o;o1aeenifcils mDrmuvpn(4tetrxf tytfaDelnvi;s srxrxr3ny4lpe mfet () rtr(mp;t4tpt moeildlaDrluvo t)trtoxo tatopte nvi () ruoir3iodamee fct t) 2tru poo0ope ii3ilt m ean p (4 rerxr oodfa  ln ils) 2xo(r ou1al e ivt s)sDrrx o;t4tpx mi3tad m2elnvp;()aetrmfcio1oaDelu o t)s2xriopnu4lmee fcsat) 2tru o;u1apxn ociasfaDuau p;t0alxrir ta1oatrluvs;(  rtrio io1lp nlfcsa()arrmuroou1opto icias sDum(vp t4aetomrctydoaDelieil(0trumirpio1lm  liesa(fsruax ont4tetomi3ildlm2emump;()trenxo3todopD ln ils)srtoim3nydoptnmivsltfaDtr( ooo0tltniociltlmDumuvsnt0tleoif3oydlmDeanvil( s2xoio3oy1alen icia(fsDurur no1alx  fetydfsDuauvo t4 rxnxr3ty1fmtr nvi ()t2ur(rpiu1llenlncia(f 2rr( ono1oex iictytfa rl(ms;t4trenxo3oadlp   ieo;()s2urim3iudomt lnesa()sDurx ono1oeeo octatfa2ean s;(4alenif iytfmtrau s;s sexoxm nu1altnlieslsfs2rrumo;o0oexnmfciyt aDumu p;u0tlxnxr3to1om  ai olt0 2uo(r oy4op e fcs t)srtmur no1apen fciyt s2umums t0 lerxr3oodfaD aivo s0 2uoxrpoudlmt lfcias)aDur(  ;o1tltoii3taslm2rm( pnt0artoxocia1lm  luvsl(  eumio iodale livilsfarur(mpnu0olxoioetldla eln o u0 rermf tydoptrli i (0truo(o iu4altn ici t aDur(mo;o1teenmi3iys sDuanmsnt) reomfctotfmD aivs;(0trtoxr nu4ap   fcsa(  rrrurp;o1teto oetls mDumu p (0trxnmfctytomDr ivsl()teur(rpnu4ape mnvi s  2ua(moot1aptomoetatlmDel(mo;t4aetoio3iy1lmtr nvo;(0t2umim3ny1lpeelivi tfs2tmurp;t0tpxnifeilsfa2uanmsnt4altnmocia1fateanvs;()srtrir ny1omen ics s) 2trum ;u1apeoif3iad a2ulnvpn() reoirciodla eaieo;( tetr(r nu1apt  iesatf 2rau ont1aexnmicildfm rm( p;t4arxomrcoa1lmtraieo;t0 2tr(mpno4altnlnes (  2umx  no1oexoifetytfs rm(mo;(4aetoxo iatfptrlu s () 2xmim iu4oltelnei t)a2raxmo;o4apen feiytlsDeln p u4trtrif iotfpteln sls) rtm(r io4ll emneia( sDrmu pnu1ole  oeiasfm2rau p u0artrmo totopteaivo ()t2tr(o iy1olt  nvt t) rta(mpno4tet mictatfa2uanmp t)aleomo totfpt auvi (0t2xoir3iodome lfct () 2rm(rpot1oleoioeildlsDum(vsnu0texomf oatom rln s;t teuoxm ny4llt lneia(fs2taxmo;u0oexn i3iyslm2rluvon(0texnxr3tatom rlieo (0texmxr ou1ll  mfcsls)aDrmxmpot4optoii3iad sDranvo u4tleoxrciodoaD  nvi (0 2trio iy4altelivtatfsrumuro;t0oltomoeild mDrlumonu0tetnxo ty1oaDr ieolt) eto(r3oydlme lfvt t aDtmump;t1apxnio3tadla2em(vp;t4tleomo ia1fpteaueils)sexoimpoo4ll  mici sfsrua(mp;t0teeo o3iyd a2eaumo;()alenmrcoadlmDraivs ( t2umirpno1altn icils srurxrpoo4oexo f3tlslsDumums u0tlenifciydop  lueo t)srxmxmpou1ol n
\ No newline at end of file
@@ -0,0 +1 @@
+ivi s0 2xoim iu4llenmfetls s2rmu pno1opxn ictat mDrmn pnu)tlxoifcoo1oaDeauvolt)srurirpio1olee iet s  rrrxmp;u4oet  fetytfa2eln o u) lenir3oatlmDraivo s)trtmxr io1amenlnetl(f rtr( o;t0aee  ocildlmDumnvo;t)tlxomfcootomDeluvo;t0s2xoxm3ou1olenmnvtas sDrmx  ;u4ope ifcildfa2ulnvp;u0 rtoxoctydop e uvo t s2xm(mpnudlp  lncsa( sDrau poo1oltoioeilsfs eaumpn() ltnxfcoodomt  uvslt)teurimpny1ll  liet s)a2ra(rpnt4ale ifeiasla el( pn(0tleoir3tatomt  i o;( truoxmpoy1alt  nvil()sDrmu p;o0opxoiieildfmDrln s u0trerxfcoytfat auvo (  2tmxo3iy1opte ict tfaDtax  no4openmfetad s emnvon(0 ltnxr3tytlmte uvols0 etmxm ou1aptemfeta(fa2tr( p;u0oeeoio3iydfa2rm(vo u4 rxomo3todfmDr uvo t0t2xm(o3oudomt  fvs s) rrr(mpoo0apxoifeilsfa2eau s;u4trxrxf3to1op eauei ( s2xrim3oo4al nmncs (fa2um( poo4aexomfctyd mDem( p u0 rerio iytfatrau ols) etrio no1oltnmicsa( s2uru oou0ape mfctadlm eluvs (0 eenxociatop   nvs;( trxo(r3oy4lltemivt s s2rrxroot1oexn o3tatlm rluvs;(4texrircoatoat luvsls0tetoxm nu1aleelfeiat sruaxm ;o4aeeniieiadfm2uanmp u) exoxf ta1laDelivo t  rtrxm oudlm   ici ()a2uax  no1tex iiciyd s ulums t) etomr3iotfa   i sl()srtoim ou4om nlnvt t srur(mo;u4opxo ictlsfm2rl(vont)trtoif todfatelivi;s t2uoxo3io1amte neils sDtrxr ot4oee mo3tlslsDulnvo;t4trenircootoatelies t trtr(o3iodlpe lnvsl()arum(rp;t0oex ioetlslsDulnmo;(4teerir3tatfmDeanvi (0tetrxm3nu4oltnlnvia() rua(root1oeeomiciyt aDrlumo (0 eenif3tadoa rli sls0teto(m ny1lmte fvia(  Dumxmooo1tpt ifciad m el(vs ()trerxo3iy1om r ieol(0truoio nudlpte fetltf 2rau  ot1teeomfctatls2ulnms ()texoxo3oodomDe uvo;( t2tmir oydlpt mnet sfsDurxr ;o4texn ictysfm2elu o;t0teenmocto1fm eln o (  rtmxmpiydoltnlnei t a2raxm ou1tleomfcils s ulnmo (0alermr oy1lpt ai o s0 eum(o3iu1opt lfes ( aDtrxr oo1apeoio3iytlmDum(vsnu4aetrxocia1fat li ols  rxoir iu1llteliet tf Dra(mont4tlxnii3iatfm ul(von()teenmfciotop  au s t)texr(rpiy4omtn ivt t artm(mp;o1aex moetasfs2ranvo u4trtrxf3iy1late ivsl(  2uoxr3ou4lp emnetas a2rrurpou4oleoif3tas sDrln o;t) renxr tatlmteliei (0t2xo(m3nudap  mieta()s2rm(mpnt1altnifeiysla2rm(mp (0 ltnxfciadla r nvsl( srxoxo3oudolt  net t s2rmx p;t0openifciadla2ua(mp;t0 eenxf iadopteauvo t seum(r oy4alt mics sfa2raxmoou0oetnifctld sDuln o t4 rtnmf iytop rluvi s0sexm(o3ny1am   ieias srraxrpoo1oet micild a elnms;t)aexnmo3totlpt livi s trxr(o3io4lptnmfet ()a2rmxmp;t0ale iocildfm2rlumpnt)aeenxo oo1fmDraieo;( trxmiopiu4ame lfcsat  Dta( pou1tlxoioetydfa2ea(ms u0alxnxr3ia1fat aues;(0texm(o no1lmte ivil(fs2rmxrp;t0tetnifeiat m eauvont)teerxr3tydom   ueo;s trxr(m io1ll n fcsa( s2rax pnt1tle  o3ilt aDean o;t4trtomfcta1op  auvolt)srurxm3iu4ape lnctas artruront0tpe mictytlm elu p;u)aexrxrcio1oa rai ils)s2tm(rpoo4olte icsas  rrrxmpno0opto octytlmDuluvs;u0aetoxf oatomtr nvi s) rumio3ou1alen ictls)sDrrx o;u4oee iiciasfa2ea(mo;()arxnmf iodoaD ai i;s)srtmxopnodll elfvtlt  Dra(m oo0apxomociat a elnms t0 lerirctydfmDrlnesl()trtoxopny4ope mfcs t s2tmuro;t4tle ifctasfaDuau o;u) rxrxr totfaD ln o s)seto(o nu1alte fvsls sDur(r ot0aptoifctls m rluvpn(4alxrxociatomD au s s0 rxm(m3nu4ll  mncil()srua(r ou0olx  i3ildfs2rmuvp;(0trtomrcio1fmt  neslt  exoxr iu4apee nesat a2ur(r ou4apen ietydlmDuaump;(0tetrxr3iydlmDeanvi (0s2uo(mpiy1optemivs ( sDum(moot1teeoifeiadlsDra(mo;(0 renxocootlaDrli i ( sruoxm nodalt lietltf 2ua(rpnt1opeoifetltla rm(vs (0alenir io1fpDrlu il( s2xmirpnydopen feia(f Dum(rp;u1aptnioctyt sDuln o (4 exrxfcoytopDelnvo;s)trtriopoy4omenlfci t  rrrxm ;o0tlenmoetytla emn on(0texoxfcoatoaD auvo (0teumir oo1am  lictl()arur(rp;o0opt  oetltlm ul(ms;u0tleoxf3oy1fm   u i s)t2xo(mpoodam emnct s) 2rr(mo;t1oltoii3ilsfaDem(vo t0 leomr3ty1opDrlivil()setr(o3oy1lmt  ivilt  2um(mo;u0tee iietytfa eau o u4teeoxr3iotop  li s;s0srtmim3ou1amtnlnesa()s2rax p;t1aptomoctytlm2emu o;() lxoxrctytfmteluvi s texm(o iu1altelnvil()srrax p;u0openmfcilslm rmu p;(4 leomr3oytlptraueo (  rto(m3oodlmte fctas) 2uaurp;u1tet moctltls ranvs (0tlxrxf iodomDraueo;t)t2urir io4om  mnvsas)srur(r ;t0tee mi3tyd mDrmump (0 renxr tadlat aivi;( setoxr3oydlme  netls)srrru onu4alt  oeiyd m ea(ms;()arxnmf oodlp raues;t s2tmim oy4llenmfetls  rrruronu1opxnmfetltlm umumo u) renxo3iotlaDelneo;t s2xrir3oudamt lfcta(fsrur(moot0tpx ii3tlslm2rlu o;u4 etnxocootfat auvolt  2toio iodomenlieta(  2ururooo4altn o3iyd aDea(mont)tlerxociadomDeanvolt0 2umir3iodlle mivsat aDrmumo;t4olx if3tydls uau o u4altnio3oa1om rlivs t0t2uo(o iydal elfvilt)a2rrxrpnu1tlen fcias a2umnmonu4 exnircoa1fpD  i s;t trxrxm iu1ap e iesls aDrax pou4oetomi3tltfaDeau o u0tlxrmf iytfmtelu s (0t2ur(m3ny1alt mneils a2uax  no0apxoiociys s2ulu p;(0tlerir3tadopDeaivols) 2umxr no4op emies t) Drmu  ot0opx miciaslaDeanvo (0aetoxf3iodfmDeluvol()srxmxm3oo4opee ict tfarrm(rooo4oee mo3iad s ul( onu) ltomociy1optrauvo t)t2xm(r3oydomen iei sfsDrr(roou0oex iiciytfa2uan s t0 ltoxr tytlatrau s s t2xoxo3iu4ape lfctls) 2rrump;u4apx if3tydls rmnvo;u4artrmf3iy1op e neo;s teto(o nu4al nmfvt tfaDum( ooo1ape mf3ilsfa2ran s;(4 lerxf ia1lpt  i ol(0 rtoxopoodapt  nct tf Drrxr nt1alxn ieiad m uluvs u0tetnmo ootla ranesls0trxm(r3oo4lmtnlncs sf 2taurooo4alxo ieiasfm2umn p;(0 rxnmoctydopDr i s s tetmio3nodlmeemfvt ()arur(  ou0tle mociaslaDum( pnt0aexrmr3totopteai i s tetoiopiydlpe  ictlt arrrxroot0optomf3ilsfaDrlnvs t0aleomr3iadlpte uei s s2uoimpny1al elfctls)a2um( p;o4tet mfciyslmDuanmo;t4tltnif oadfmteluvi;t t2xo(mpoydameelncsas  Dtau pno1aptn iciadfs ul(mpnu) etrif oatomte n i;t s2to(opno1amtelfciltf 2tmum ;o1ope mfcilt m rm(msnt) leoif oydfm  ln o (  rxrxopoo1ol nlfvil(fsrtm(monu1apxnifeilt s raump ()tltrir3totfp eanei t0 eurim3iy1omtnmnvsls)arrr(rp;u0oeto f3ilslmDeanmont)tlerxf3oo1oaDelnes s) rto(opio1op nlfci ()arrax  no0alx if3iys aDumums ()altoxr iydomDe i o;t s2xriopiodape  fcs s s2uaumpou1oltoifetltfs2rlnvpnt4alerxr3oytfaDr nvsl() rumir iydaltelfcs s)sDra( pnu4alt mo3iydlm ra(mp (4texoir to1lp r uvi;s)s2umxmpiu4alt lfcias arrmx  nu4ale mociltla emnvp t4tetrif3iatoaD  ivo s0s2toimpno4lp emivtas)artrxrpnu1tlxomiciadlmDrlu s;t) lenmr3tatom eaivsl() 2xmir nu4lm  mnet s)arumumoot0tlt ifcild s2um(vo;t4 reomoctytlmD aueo;()s2ur(r ou4olen iesas aDtr( pot1opt moeiasfmDemuvpn() etomfciodfpt an o ()trur(o3ou1amtnlieta()sDtrxmpno4tpen fciytlaDrmuvp;() lxoif3oo1latrlueil(0 rtoimpou4lm  livsasfsDtmx o;u4tlxnmociysls2ranvsn(4arxrir ty1fmte i ol(0t2tmxr3nu1optnmivias  rrmuronu4apeomoeildla2ulu o t0aeenmo oatfpDr uei;( seum(r3iu1amenmieias) rrmx pnt0oex  f3tad s2umn on() rxrmf3tatfa e ieol(0 2tm(m3ny1om nmfet () 2taumpnu4apt mociysfsDeanmp (0alxnmf iodlmtrli o (0 2tmxopiodlle mfvslsf Drau poo4oetnmf3tld sDum(mpn(4 rtoif tytfaDraiesls0t2um(rpoudlmt lieiatf rrr( p;t1tpe mo3iatfs2rmu o u0tlxrif3ootlpt aies;( srxriopny1lpee nciat s2ua(r ;t1teto i3iltfsDem(vo t) ltnmfciadomD aueilt0trxoim3oydomeemietat sDurur nu4tlt ioctlt s umnvont4 rxnifcoodoat ai olt)t2xm(rpno4lpteliciatf rtr(r nu4opeo ietytfm2umuvsn()teenxo tytlm   iei s0t2uoim oydopt miesa()aDur(r ou1oeeomociyt s2umn p (0aeerir3iodla  aivolt0teum(opiy1lmenlncta( a2ta(m ;o1tex  o3tas m2elnvp;u0 renxrctodlat  i i s)trtrxopoudal nmnesltfa2uau p;u0oee mo3iysfa rl(ms;u0 renmr3oatfate uvols)t2xrxrpiudol e icia()arumu onu4tpenio3ias a rluvs ()aexrxociatoa e n o;s0srxrxr3oy4lmtnmfet t)sDtrxmoou1opeo octldla eau pnu0tetnxoctotlmD  i o;t) 2umio3io4om  mnei s aDur(root4oexoio3tytfsDean p;u)treoxrcoytom e ieols) rxrxmpnu4omtnlnctat arta(r nu0tpenmfetlsla2ulnvp (0artnif3iydomt  ieolt0t2trxmpoo4ole  nvtlt) Draumono0tlx mfeildlaDel( s (0 eenxo ty1oaDraneols0teumimpno4op eliciasfsDua(r oo4aex iiciytls rluvonu4 lxnmf3ia1lmDraueo;( t2um(m nu4ll e ivi (f 2umxmpoo0apeomociydfs emnvo;()tetnio ootlp   i ols0 etrxr ny1op  lictlt aDtax pno4oltomf3tadfm2ran p;()tltoxo3oatomDrai s;(0 ruoir3oudape  ietat)arra(  ot0aee  ieiydfm2eauvonu0tlxrxf3iytoaDeanvs s sruoxm nydlmtemfetlt)sDtmumoot1tet mi3iad a2umums (0 etrir3oytlm eaneo;s)sexm(o3ou1lpe mfviatf rtm(mp;o0apt ii3tyd s elumsnu4 exnxf ta1fm  auvsl()trur(o3no4am nmneta()artmu p;o0tlt  ociysls2um(vp;u4 renxfcta1laD livi ( srtmxo oydlptnlnei ( aDtrxr oo1tle mfetldls ea(mp;t0teeoxrctotlptr i olt  2xmim oudamte nctatf Dum(monu1tetoif3tad a ua(vp t0 exnmo3ia1lmtelu il()srxmirpiodale  nct s)s2um(  no1aet ifcias s2ulu s t4trenir tytlaD livi;t0trtrir oy4ole  icilt)aruru poo0oeeo f3tlslm2rlnmp;(4tltrmo iadopDe u s s)s2xoxopiu1op nmfei s a2uauro;t4tex ifeiytlsDumnvon(0 reoiocoatop elnvils0 ruoxmpiy1ape lncslt artau ooo1apxoioeiadlm2umnmo;t) ltnxrcty1fmDrauei ()sexo(mpny1omtn ics t)s2ur(rp;o1alxnifeiytfs2uauvo u0 lxnmr oodoa eau s;( t2uo(m3no1ll emietat sDuaumpnu0olen fetlsla ea(mp;u)arxomf3iytfat  ies ()tetoim iy1lmt  net sfs2taxr ;u0oeeomo3tydfmDean p () rtrmr3iy1lm   i i t0 2urxr3iy1lme livs t sDrmum ;t0apt mi3ild a2rmnvp u)alxoxf3tatfa rlnei s)texoim oydlm nmnvi (  Drrx o;u4tet ifciadlm el(ms;()alerif3ootoptr ivi s  rurxrpiudal nlnetl()s2rau pno0altnio3iytlm2emnmo t0tlxrmociydop  anei;s) 2umio3iu1lp e ics t a2rmu o;t1tlenio3iadfm2rau pn(0aetrmocootfm  aivi;(0texm(mpoy1alenmfvsa(  2tmx p;u4optnmieiyslm2umuvo u)aleoxo3iodfm  au sls0t2toxo iydll   ivi ( artr(rpnt0apxoiociad a2eauvon(4tetnmf3iytfpDeauvo s s2xr(m ou1ll   nciatfartaxrpnu0olt mi3ild aDeaumsnt0 rtnir3ty1lmt  uvo;(0s2xrir3iu1lle mfcilt  Draxrp;u4tpxomoetasla2uln p;(4aeenmf iadoa eauvo;t0t2xmio iu1lleemicil( sDra(mont4olt mieiyslm rln onu4aexrxf3ootomD luvol()t2umir3no1optnmfcs s s2tr(m ;o1optomfcildfm rmn o t4tlxoxo3oa1fmDeaivols  rxr(mpiudlmeemnvi sfa2trum ;o1oltnioeiat m emn s u4 etomrcoo1laDeaues ( sruoio nu1oltelfetls) Drmu ono1opx ifciydfm2uanmpn()tltoxo3totla  ai i s0 2umim3ny4ol n feia(f 2rrx oou1olx ifeiatfm ra(mo t)tlenir iotlmtr uvolt0teuoxm3nu4lmeelivtl()sDuaur ;t4aet iieiatlmDemu o t)aetnxfcoo1fmD aieo s)srto(o nu1ap e ictatfa2umxm oo1oltnmietydlaDem(ms t0tetrmf tytlatelivolt trto(rpoy1altnmnviat aDraurpot4aex moeiydfs umuvpn(0 lenifctatom rlies s0sexmir oy1am  mneiat) rrr(r no1oexoifeiasls2rluvs;t4teerir tatfa  aies s)texo(mpoo4ol e neilsfsDurump;t1ope moctltls rmuvs (4 leoifcoy1fp  livi;(0 2xrxm no1op emfvs ()arra(rpnt0tlen ietltfa2ra(mp;(0tlxoxr3tydfmtr ivsls srurim iydlp  mfvils  Drmurpnt1oltomictldfm rmnms;t0artnircoo1lp eau o;( tetmir oudllt mfeias s2rmuro;u0aleniieild s2rl( pnt4 eenio iotom rlies t)seto(o3iy4ope lfesls artrx pnt4tee mfeilsfa2umu pnt0 leoir3iodfpDeai s s)seuo(o3oodomtnmnvils srtrxrooo4tpx  o3tytlm2ra(vs u0 eerxocta1laD  ueol() eurim nu4llen ieils)aDrrurono0tle mfciydlm ua( o () lermf iodomte nvils)s2urxo3nydom  mneiat)aDtmxrpoo1apxnioetasla2eanvo;t0texnmf ta1fmDeluvols  rxrxrpiu4lmtnmncia( aDra(r no4alxn i3tadfs emnvo;t)aeerio oadfpte ivsls0 exrir ou1lm elfeias) rrr(mooo1oltn iciasls2ua(vsn(0 exomrcio1fpDeluvi (0t2trxmpoo1ome  iviatfarur(  nt0tee ioetatfa2rl( o t0teenmf3iadlpD aivi t trurxo io4ome mnci (fsrtr(mpnu0oet  fctydfm ra(mo u) lxnmfciadomtelnvsls0 rxoxo nodlpeemivta()srrmu o;u0tex  o3tydfm2uluvsnt4arermf oadla   uvsl( t2urxr oodamt mfvsatf rrmu ooo4opxnmictatlm2umuvon(4 ltnmf totfpD luvi (  rum(m oo1olte net s  rtrx o;u0opxn fciatfs2ul(ms;t4altrif oy1fmDrlivolt  rxo(o nydap n nesa( arurxmpnt4alx mietyt m2uauvp;(4aetrmr3ia1fpDeauvo;(0sexo(o3nydam n netltfaDtmu  ot0olenifctatfa2ulnms;t0trtoifcoadom elivi s  rtmim oo4lm nlfcia(fs2raxronu1apx iietys a ul( on(0trenxr ia1omte neo (0 2umxo iu1om elncil(f Duaxrp;t4aex ifeiytla rlnvpn(0artrxo3iy1omDr uei (0 etm(m nudlmenmfesat)s2rrumono0tlto ictlsfsDulump () lenio3totfmt auvs;( truoxrpoodlle  ncta(f 2tm(r ;u4olx  iciytfaDul(vo u4 lxnxrciotop elnvolt trxrxrpou1omtn fcs (  Dur(m ou0oeenmfctlsfm rlnms;u0 rtomr3todfp  aivilt  exo(r nu1al emfvias sDuru o;t1opeo f3tat mDeauvo;u0 exnmf3tydlp  aiesls  2umim oo1oleemieiltfsDrm( p;o0olenio3tys a2ra(msnt0alermf3oatoa e i o t)truoxm3ny1opee ies s)aDrmumpoo4oexo f3iyt s el( o u)aetomr3oatlat  i ils t2um(m3oo4omt  iesltf 2rr(r no4apxo ociltlaDem(mo;t4alermf oodlaDe uei () 2tr(m iydape mies t)arrrurp;u4aptomfetysls2elnvs;()arenmocty1fa  lu ol( t2xm(r oydamtnmfvi s s2urxmono1alx ii3iasla2uluvsnt)aexomo3ia1fatr nvi;t) etm(o nu4altnmnvt sfsrumx  ;t4oet micils a uaumo u)aeermr ia1lptrai ols)trtmim3iudop elncsl(f 2tmx o;o1tpxnmo3ild s eluvo (4arxrmf3iy1fm  auvi;t)t2xmir io4lm nmfcsl(  rum(  nt4oexn i3tas m emu o;u0aetnmocio1fatraneil( s2tr(o3oo1ameelfcia() Drauronu4ope mfctytlmDemn ont)texnmo tytfateai sls) euoxm oudlp elictatf Draxmpnt0ope  oetldfs umu on(0tlxnxr3totlaD ai ilt0tetr(o3ou1ol emnvi (farumxro;t0aptnmietyd m2rmumsnt0trtomfciydlpt lies t  exm(rpny4ll e netas s2ur(rpot1apxo o3iyd mDeaums u0 reoif3iadfpDeluesl()t2umir3oy1oltelietat a2rr(  ;u0optomo3tltfmDelu p t0 exoiociadopt livils)tetmim oy4opt  ivi () Dum(mpot4alxomiciatfsDumu p;u0tlerxr3ta1la ranei;(0texrxm oy4lmt mncilt arrmu o;o0aeeoii3ias s ua(mo u0 exoxr ty1op eaueo s)srtrir oo1oltnlfet t aDraxroou4tltomf3tlt sDrauvp (4tlxnxrciatfm ean o;t  2xmxm no1lm emnctlt s2raxmont1opxomfcils a2eauvp;u4altoif3totlpDeaneo () ruo(opiydlpte nei ()a2rr(r nu4opx  ieiydfaDrmn pnu4trerxo3iotfat  uvi s)seto(m oy4oltnmfetas  Drrxroou4tlx micilt aDumn ont4tetoiocoa1op   ivsls srtm(o ny4am   ivia(fs2um(rp;u4tpxo feiydlm ra(mo u0trtoxo3ty1la rauvsl(0s2tmxrpiy4lm e nvt t)aDrrumono0texnmfciasfa ul( p;t4 rtnxo3iytlmD lies s t2uoiopio4omtnmicsltfa2ua(  nt4tex mietltla2em(mo;t)aexnxo oadfmtrlu olt)sexriopoo4am  lncsatfs2um(  oo4apt mociaslm2uauvp t) etoxo ta1la raivi ()tetrim iydlme mfeia() 2rm(m ot1aeeo oeiadlmDuluvpn(0trerir oa1oa ran ols srurxm ny1lp  lfvslt  rtr(r nt1tpxn icild a2ra( onu0 rtnmf3iy1opDrlueilt)t2xm(mpnodllte nvt t)sDtaxm ;o1texomictydla2ulnms u0arenxocoytfpt  ies ()trxm(mpiy4ome lnvt t  Durx ont4tleomieiyd a ul( s;(0texrmr3totoateauvils0trtoxopio4llt  ict s sDrmurp;o4olenifcils s2raums u)altoxr iatlm r uvo;s0seto(m oydope lnet (f rra(rono4aleoiociyd mDem( p u0 exnmo iodfaD ai ils  rxmim iy4al  lnci t)srrr(mpot0oetnmf3tltfs2eanms;t0trerifcta1fpteau ilt) exmio3nu4omt mnctlt)s2rrx pou0tpxoiieiadfa uln p (4aexrif3oatlptr nes;s)srxmimpiodapt  ncia(  rrau pot1tlt ioctlt m2ran s;u0aeeoioctotopt anvo s)sexrim ny1olte ictlsfsDra(mo;t0tptnif3ias sDulumont4tleniocia1omt livs ( sexrim iu1lpeelnctas) Draur ;o0oeeomf3iltlsDem( onu0 rtoirctydoaDe ueo s s2xm(r3ny1lp   nvt s)a2ta(  ou0oeeo f3tydls eanvs;u0 renmo3oy1fmtr ueo;t  eur(m3io4amtemnci t  rururpnu4apx mf3tltla rlnvpn(4altoifcoatlp raieolt0texr(mpiy4lmen fesat a2rmxront0tpe ioeild a umuvo;u) ltrio tatla r nvi;t0seum(o io4om   neilt aDrr(r ;o4tpx mi3ilsls uaumsnt4tetnxo iatoaDranvi;(  rxmio oydole lnvtls srrr(m ;u0opto i3tytfaDeanmp;t0alxoio3iy1fp  aivol( seuo(rpno4om elfciat sDrmxrpoo0tex ioctatfsDuln p (0aexnmocoatomt lies;t0trtrim3ou1lmeelncta( a2rax pno0texomo3iad aDrl(vonu0tltoif3oytfmt aueo t) exrxm3nu1ap n nviltfaDrrur ;o4alxo oeildlmDem(ms;()trxoxf ia1fa   ues s)s2uoxr3io4am nmneil(  Dra( onu0aetn fcildlsDrln onu0 renmfcoadlptraieo s) rtoxrpoudopt mfeiat aDurxmpou0oleoiieils mDuau o () etnmocoadfp  livols)t2uoim3oy4omenmfctls srraump;o0aee moeiasfm uluvp u0aexrxr ta1fptrlueo (0srurim iodomeelivil( aDurxmo;o0tpxoifetytls2ea(ms t4tetnmfctodomD  nesl()s2uo(mpiy4op n nvtl(f Dumu ont1tetnioetytlm2uluvp (4 eenmrcoatopDe ivs t t2uoxm3nudam nlnvt s) 2ur( p;o4optnmf3tatfsDumumo () lxoxrctadlmDeaneo (  etrir nu1om e nvtatf 2umur nu0apxo iciyt a2ul(vpnt4 rtnmr3iodfa rlu o s0sexoio3iydomenlncs t) 2tm(m nt0alt moeiytfmDelnvpn(4texoifcia1la r i o t)trtr(o iu4amtnlfesat) 2tr(  ;o0alx  o3tlslm2rl(vs ()tlenxf oydom   i o t tetmxo no1apenmietl()aDra(m oo0tlenifciydfaDelnmo t) lxrmrcoatfmt lues s t2toxm iudolt  nct s)a2uaxr nt0tetn feiad sDeluvo;t)trxrxr iatfat  ieol(0srxmxrpno4alenlfcias aDrmu  oo4teeoio3iltlsDua( p;t) ltoiociytfpDe u ils0 rtmxrpoudol   fvt t  Dur(  ou0optn ictysls2umnmon()trermfciodlmD lieo t srto(m oy1oltemncsasfaDtm(r ;t4texnmo3iatls2rau p;t) etnioctodfmDr nvi;s trumimpoudapen feilsf rurxmpou1altnmoeiytfa2rlnvpnu)texrif io1omtrau ols0 rtr(o3no1lp nlfcta(fa2rrur nu0altoiiciat mDelums;u0 renmocoytfatr ueo;s t2tr(opny4omte nctls) rrrx ont0olen ieiysfa2uluvp;(0 rxomfctodlaD lnes t0 rxrxr3no1apt  fci s srrmxrono0openiieiasfs ulu s u4tlerxfcoytomDran s;(0 eurxo iudlp nlncil()srrrxmooo4aeeomieiatls um(mo;u)trtrxf3oadlatrlu o;t0 2trim iu1omen ivtat)srtru oot1aex  o3iasfm uan o (4 lenmfcoa1faD  i ols0trtm(m iydop  micia( s2um(mpno0oltomiciaslm ulnmsnu4trxrmf3iydom eauvolt)seto(r3ny1om emictls) Dtax pot1alt mo3ild s rmuvo;u0tetnifctodlmtrauvs t0teurio nodlltn ietas arrrxm ;u1teen f3tysfsDelu pn(0alxoxr oodomteluvilt)srxr(m nodlp nlfetls)aDrrxr ;t1oee ifeiydfm em( o;u)arerircoatfmDe ivsls)t2ur(mpiu1omenmfci t) 2rmump;u1oltomicilsfsDeau s;t4tlxoxfciy1omtr i sl(  etrimpoodom   icsas  Draur no1tlt moeils mDra(vp;()arenio tadlat lues ( setm(opoy4lm e fvtat  Dum(mpot0apeo f3iyd s2rm( ont) exrmrciadoptelu i;t tetmir3iy4omee ncilsfartr(mpou4tle iociytlm ra(ms (4artoxr3ta1fpteaivo (0truoio oy4opt  nvtltfsDrmu oot1alt mociydfsDuaump;t0aleoircto1omD auvsls0t2ur(m nudap nmivs t) 2uaxmont0aexoif3ilsfs em(vs t4aeenif3tatoptelieolt)s2uoir3oodopt  ncil()srrmump;t4olxo iciat m raumo () exoxo tydlptran olt0 etoimpny4omte ictl() rrrxronu1oex mfcildfm2rlumont0texrmfcoodlm raieo t srumxo3oo1aptnlncil(fa2raxrpot1oltnii3iyslm el( onu)trtrmr3oy1lpD  nvo;s)setoxm3io4lpee feilt  Drru o;u0tltoif3ias m umu sn(4tlxoxrctotfmD aneo;(0trtr(rpio1lp n nvi s)aDta(r nt1alxomf3tyd mDumnvo;t)trxrmo to1lm  lu slt texoxr iy4ole  neils)srra(rp;o1olx  ictatfa2ua(vs;(0trermr3tytlm   ies ( seto(mpiudamt  neias)srrmx ono1oet ifcias a2uln o ()texomocto1fm raies;s0t2tr(mpno1lmeelfvsas s2urump;o0tpxnmfeiys s ulu s;()trerio iotlm   uvilt0 2ur(o3io1ol e ies sfs2rr(r ;o0tlxomietasla rmuvp t4 ltrxo3oo1op rai sls  2triopio1ame lnvsasfaDtaxrooo4apxo fciatla umnvpn() exomrcoatlmD luvol(0 rumxmpio1lmtn fvsa(fa2urxmo;u0aee if3tldlsDrau s;(4tlerxrciadfmteliei s0t2xmir no1apt mfcias  2tm(m ot4tpenmf3ildfs2ul( s u4trxrmo ty1oa elnes;s t2umxo3ou4omte nci ()arra( pot0oex ifcils mDea(mp u4 exoxr iadlmtr nesl(0tetoimpiodame  fvia( arrm(rpnu0ole ioctldfaDranmp;u0 ltnio3oo1fpDeau i ( t2tmim3oydolt mnesl(fsDtax p;o1aex ifeiat aDeau o;()teenxr3oodlp eanvo () rtoxo iydaltn net sfa2umu  ou0tltoiietadlm2eaump;(0arxnifcoy1oaDrli s;s) 2um(rpnudoptnlfvslsfsrtru  ou0tptoif3tlsls ul( o;t4 etrxrcoytfpDrlieilt t2trirpnydamen ncia() Durx onu4tpeo iciyslsDum(mo (0arxoxo3oadlp ean ilt0 euoxmpno1optemfvsl( srrr(mono0tptoio3iysfaDran p;t4aleoxocoy1op  lnesls sexr(r oudlpteliei tf 2ua(  no0opxo i3tltla2ran p;() rxnxf oodfa ran o;t) 2toxo iy1opee fvtas)a2trxmp;u0tpx mo3tydlsDrmnmont0texoxf io1lm rlivslt0 rxrxopiodlmtnmfcias)arurxmoot4aeenifetytfaDul(mo;()teenmr3oadfpDeanvilt0 eurimpoy4lmte neias)a2tm(ront0apeniiciydfs ra( snu0arxomo iadlatr n i;( s2xrxo3oy1lm n ietls)a2raur ;u0teenifeiad sDul( p u) rxnmf tytfa eaies;t0 2tmirpiudlptnlnvtl()s2ua( p;o0tpxnmfetaslsDum(vsnt4 exrxf3to1fmte nvi;t0t2uoxr3iodomen ici s)s2tr(m oo1aeeo o3ias mDem(vo t4arxnxrciatfate uei s0setrim3nudap elivta( aDtrxrpou0apxnmietatla ulums (0 exrmocoo1lp ran s t0 2toxo3iu4lm elfvsl( sDtaxm ou1opxniiciasla uln pn(4tlenxf tydoptrlues;s  ruoxmpiudale  ieslt) Dtmx  no4aet  ictytfa eanvp;(4tetnmr3iotfpD au i t trum(rpny1lmt mfcsatf Drax p;u4ale mfciyd s2elumsnu0aetrxo3tatfmDeauvo;(0 etm(mpno4olenmfet s)srrrurpoo0teenio3iadfa2ea(mpnt)artomo oa1fm eanvi;t0 rxm(mpiu1amtn fetas a2rr(rp;o1alxomoctltls2rmumo u0 lerxr3tytlaDeaivs;s)srxoirpnu1al elictl()s2ur(mp;o1tetoif3iysfs2rlnms (0treoif3iotfpDeanes t)t2xrxrpiu1lle  fvtasfs2tru  oo4tex  fciyt aDuaumo (4 reoxf iytfa eai s s t2xoirpoo1lpt  fetl()aDta(mp;t1oex if3tytlmDumu p;t0 lerxf ta1fmD luvi;s teumim iu4lmte neslt)sDurx o;o1oetoiiciyd a eanmsn()texnxr tytlpD luvi;s t2toxm3ny1op emfes s)srrmurp;u1aeeo ociltlaDul(monu4 rtnmocoy1lm eaivo;t teuo(o ou4lpe lfctlsfsDua(r ou1tpxomo3iadlaDemnvpnu4 rtoxo tytfatrlnes s) etrimpiy1alt mnvt () rrm(m nu1tlxn ociyt mDua(vo (4 lermr oadfpte neo;s  2ur(o oydaptnlivs s)sDum( o;u0tlxoioctyd s rm(von(0aetrxociadomD ln s t0trtr(m iy4lltelicil() Draurono4oex if3iyd m uanmo;u)aetnircoo1laDe n s;t)setrim3iu4lptn iciat sDrrurpou1aexnmi3iltfs ea(mo;t0aetomr3oatopDrlneo;s)t2tr(o3ou1am e ncs () rtr( pnu1olx  fciyslm2ra( s;(0 etrioctatlaD anei t0srtmxopoydlpt liciltfa2ra(roou1tptn i3tytlsDrl(vpnt)aetnxoctatlmt  nvo s)t2xoxm3iudll n icslt  rrmu  nt4tleoiictaslm ea(von(4artrmf3oo1fmt  ueo;s trxrio3io4omte fet t) 2umxmo;o1oet mfctyt aDemumo u4aexrir3totfa rlivsls0 etrxo3oydomeelnetlt sDtm(r ;o0alxnmi3iatfs rmn o u) lenirciotfptrlnvs s0t2trxr3nu4alee fcsl() Duau poo4ole mieias aDua(vp t4artrifcoytlm r ivsls  etr(rpno4lle lnvi (fsDrmuro;t0tee mieiltfm2emuvs;t)tlxrir oadomDraueol() 2xm(m3ou4al nlfetls sDuaumo;o1oetnioeiyd a ulumsnt4trxnmrciadomDelu i;t) eumxm3iudame  iviltf Drrumooo4oleoiieiydlmDemums (4aetrir3iotfaDeaies t0srxrimpno4apt  ics ()aDtau pno1alx mi3iydls2ul( pnu0 etoir3iatfmt  neslt  etmxr no1ope lfci t arta(  nt4alxnmi3iytfmDumnvonu) lenir3oa1lpt aueil(0t2triopnu4ale  nci (fsDurx p;u1tpx ii3iadfm2elnmonu) lxoircta1oaDeanvi () etr(r3iydame mfvsas)sDrruro;u4olxoio3taslm2rmuvo;u4trxrmf3ta1lptrluvi s)seum(mpio4olenmnvsl() 2trxro;u4apx mieiyt a uan s u0tltnmr3tatla  an s;t tetr(r3oydoptnlfvia() Dtrxronu1olenmiciytla2ranvo t0 ltnirciytomDe neslt0 2xm(m3ou1lleelicslt)sDur( ooo0teenif3tyd m2ea(vsn(0 reoio3io1lpt au s;()trum(o nu4olt  nvil() 2uaurp;u1oeenmf3ils s2ranvs;u4artriocoadopt lneo;s)s2uoio3oy4am   iesas aDrrumonu1tlt iociyt s ul(mo;(4 rxrio3tatop e ivi s0srur(rpio4ame  ivsatfaruax  ou1opeo i3iytla2umuvsn()texoxf oadomt  i i (  exriopiu4op e ictl( aDurxr nu1olxnmfcilsla2emu ont4 etnio iodlmDrlues;t) rtrxm3oy1apt livsa()artrxm ;o0oltn fetatfa2um(vpnu4trxoxocio1oatrlnvsl(0 rtr(r oo4omt mivs sfaDtmxmont1alx mieilsfaDeau p u) ltnif3iadfmD au slt  exmxm3ou4lpee nvia( aDtaum nt0tle mfciatlaDrmn snu4trenxf ootlmt lnvol(0trumxr3oo4lptn nctat  2rr(r ;o0aptn i3iltfs2rlu snu)artnxrciy1faD  uvsls0s2toxr ou4op elicsls a2urxr ou0olxniicias sDumums t) eeoxociy1fp raneils trtoim nodllenliviasfarrmxront0tlx  feiad a umnvp ()tlxnmr to1omD auvo s0seum(r3nodlpenlici (fsrtrxm ;o4tpeoiieiat aDean ont4 exnxr ootomDrlneslt sexrxmpio4am   net ( a2uru pot4ale mf3tldfm2emnmsn() exnif3oatfaDrauvol(0sexoir3no4amenmiesa()srum( poo0aexn oeild sDrm(vs t4 ltomo3iydoat  i ils trtr(opoodap  mfesat  2tau oou0texnmieiyt aDuan p u) rtoxrciytfa  lnvil(  euoxo oo1omee fesasf 2tm(rp;u1opeomfciytlmDumnvo t4tetomfcoytfatranvol(  rxmxo iy1aptn ieiatfsDrm( pou1olt  fctadlsDel( pn(0 rxnif3oadlmDeluei ( s2xrxr3iydale lnesatf 2ra(mpnt4opxomoeiltlmDeanms;t4 rxnxr3tydfa eaies;() etoir3io4lp elivi tfsrraurooo4tpeoiiciytla2ul(vo (4aetrxf3totlate i s;t0teumxopnu1lpe  ncils) 2rr(mpoo0tlx  f3iyt m rm( s;u4 rxnmocoatoaD au ol( tetoio3oo1openlncias)aDum( o;o1aetn o3tyd s uan pnu4 rtrif3iadomt  ueo () rumxmpoodalenmfctl(fs2tr( pou0olt mfcildla eau s (0artomf3oytlm  an sls teum(r3nu4lm n nvtat)srta( p;t1tpxn o3tldfa uau o t0aexoif3iadopteanei;()t2urxmpoudopee nvi s)s2ur( onu4alxoifetad aDeauvs;t4 ltnio3oy1om rau o t0trxoiopno4aleelieia() 2tr(r nt4olxomi3ild m2um(von(0tlenmr3oodfpD  uvilt)seto(o3oo1lpenlfei ( artm( pnu0oeeoif3iaslaDeaums;u0 exoxrcoadlmDrlivols) eum(r3iu4oltnlieiltfsDum(  oo0tex ii3iadla em(mo t4 lxrmo3oo1omt aues s s2um(rpno4amee ivt (fsrta(rpot0olt  ieiysfm2ea( o;(4aetrxo3iodlaD  i sls)setmiopoy4apte nvt t sDrrump;u4opx mo3iytfs2emumo;(0tltomo oytlmD  nvo;(0truoxrpnu4om  lietatf rtru oou4opxnmoeiytlaDuauvs t0 etrmo oy1fpte nvo;s  etoxrpou4lmt  nesl() ruax  ;o0apxnifetltlmDrl(ms;u0tetnmociatfptrau sl(0 2xrxr nydolt  feslt a2trxmo;t4teenmfeiadfm rlnmp;t)areoiocia1fp e i i t teuriopiudomenlfvt ( aDta(mpnt1alx  f3ilsla ul(vs t)arenmf3iydoateau s;()trtmim no1llen fvt (fa2trxmonu4oetn i3tld m2emu onu0 ltrif iy1op r u ilt)trtm(o3nu4lpe mneilt a2uaxmpnt1altn ictydfaDuauvs;()tlenmf iotomDr n i s0 2to(m3iudoltnmfviltfsruax o;o4tetnmoetydlm2ean pn() leomr3tytla rlueils) rtmiopnodalenlnvs tf 2rrurono1tpxnmf3tas a rl(ms (4 exoxociotlmD au i t0 exrio oy4omeeliet () rrax p;o0aexnmieiydfa2em(msn()tltrio iydlpDeauvi t  exr(opou4am nlnct t) ruru pot0oee mo3tlslm2uan p u4artnxrcio1oa elneilt t2xmiopou1lltnlfeil(f Drmu  ;o1oltoifetld a2umuvont0tltrmr tatlp r neols0trxrxr oydol elneilsf Dum( pno0tlt ii3ils m uau pnu0 exoirciodomtraneils s2um(mpno1lpe  ictlsfa2trumoou0tpxn o3tltla2el(vs u0altnmr3oytopDelnvslt)srumxm nodam emnesa(fa2tmxmonu0teenmi3iatfs2elu o;t0 eenmf3oodlmD  n o;()s2xmxm iu1om nlfeiatfaDrru ont4oee ioeiysls2ea(vs;u4 rxoio3tadlm eaneo s0setriopnodlptnlnes s s2trurpoo0aexomf3iyt s ea(mp;u0 exomociytlmtr u olt) rxmim nu1optnmiei sfs2rmur no4olxomfeiltla2eluvon(4alenxf3ty1fm eau s t0trtmxo3oo1op emncs sfs2rrur ;o1olto octatlsDulums u0aeeoxr oa1fpD  u sls) etoxrpnu1am   icia(fs2tmxro;u0tltniieilslsDemnvo u4 etnxfcoytlp  lieilt)trurxrpoudol  mieta( a2tmu p;o0opeoii3ildlm uanmont) lxoxr oytlate ivo t  2tmxopiydomenmnvtl(farurur ;u4altoio3ilsfs elu p (0 rtnmrcoatlm   uvo;(  rxrxmpiy4altnmics t)sruru  ot4teeoif3iytfs2ulnmpnt)texomr oo1oat luesls truoxo iudapenmictltf 2tr(  oo1tetnmi3iad m2em(ms (4alermf tytlm ran ils  2to(r ny4omtnmfvi s) 2raxrp;t1oltnmoeilsfa2rl(vpn()artrxfcta1lmDrlivs t sexr(r oydopeelneil(  Dua(  ot1tltnmfctatls eaumsnt)teermo3oytlaDe ueo;( s2uoio iu1lmtnmiet ()s2raxmo;u0aptoioctldfmDum( snu4 exnif3oa1oaD anvils0 rxrxmpnydllee ici (  rtrxmooo4texo i3tlslmDrl( ont)areoxoctodlp ran i;s s2tm(rpoydlle  fvt tfsrum(moot4altniieiad s ulnvs u0tetnxocoatlpt luvs t)trtoxm iy4altnlfcil(  Dtau pno0opeoif3tlslsDumumo;t4 rxoxo oo1lpt  ivs s t2urxo3nodamenmfcsl(fsDrmxrono1texomf3tadls em(vo () lxoifcia1oatr nvo;s0t2uoio no4ole mictls)arur(m ;t4aeenioetyslm rlums () exrio tydlm rlnvo s0s2xo(r3oy1lpenmivi tfaDrax  ot4tlxomfciysla2emuvon(0aetoircoytom elu ilt s2xoxmpiodale lnesltfa2umurpoo4tltnmietltfa ulu on(0 lxoiocoy1fmtrluvo;t srtr(m nu1lpt lfeia(f 2ur(rp;o1apto ieiatfsDelu s ()teeomf io1lp rlueil()s2xoxm3nu4lm emivtls) 2ta( pnt0apxo ieiadla2emnms t4tlxoxr tytoaDr ues t  eum(o3oodopee fes (fs2uaum no1aeto oetltla eaumonu)alerxocty1oatr ies;t0sexoiopoo1aptelneiltfsrtaum ;u0tee  octadfa rmuvo u) ltoxf oadom rli s;s) 2uoimpnu1alen fet t sDua(mo;u0aleo fcild a eln p u0 eeomf iadoateln s t  2toio3iodome mncilt) Drmxr nu1ale  iciatfmDrluvo (4texnxr3tydfm r neo (  2tm(m nu1ap  mnvsa( s2urxront0oexn ictad a2ulumsn(4aetnmrcoa1fa ean o (0 2umxrpny4lpenlfesls) 2tru  ot1aet  fctlsfsDeanvsn()tlxnmf3oa1lm   iei t)sexm(r oo1am  lnei (faDtaur no4oleo feiytlm rl(vo;t4 eeomr3todopDelivil() 2uo(r3iu4amenlnci sf Draxr oo4aee if3tltls umn o (4treomf3iydlaDrlues;()t2tmxr3oy4omenmfesltfaruru oou4tpeoiietasfsDrlnvp (0tltnxr3ta1opDrauei s0trxmxo3oy1apenmfesas)aDumur nt0teeniictls s2elu o u0aetnxf oadfmD aueo;s) 2umxr ou1ome  nvs s srumxmpou4apxniieiyslsDemu pnu4trtnio ia1faDe neols  eurimpnu4opte fct sfs2urxm ou4oeeniocils m2umuvo;(4 lenxfciodla   nvi;s0texr(r3iudlpenlfvsl(farumurono1tle iociltfs2el(vo;(0areoxociytfatr i s s  rtmim ou1ole  ivilt a2rrxrpoo4oex mfeiyt a2ea(mo;()arerxo3ia1fpD luei;s0t2tm(m nu4lmtn fesl() Dtm(moou4oetn feiadfaDemnmo;u)trerxr3tatlmDrlues s0 rurimpnu4ol nlies () 2rr(ro;t0tle mfetatfmDeaumpn(4 rermf totfmt lu i s  2xmxr io4lmeeliet sfaDtru oot0alxomfciatlm rm(ms (4tlxoiocootlmDrlnvslt0 etmxm3ny4aptn nvtat srurxmont0apenmieildls2el(vpn() eerxr tadfaD  uesl(0teurxopiu1llen fesasf Duaumo;u0aex iictatfs2ua(vs;u4 exomfcoa1oat  ivolt) 2xmio3iy4ope mfvta() Dtm(r ot1tee mfetytfs2ul( s t0aexomf3oa1fm e uvol(0t2xrxm nodopee fctatfs2taxmp;t0aee  i3iltfmDeanmp;t0tlenmfctodlm elu s s0srxrio3oo4ap nmfcslt  rta(r ;o4tpxoiicilsfsDulu o;u0 lxrir3iytlpD auvilt) 2tm(r3no4apt mnet s aruaxr ou0aptomi3tasfaDranvs;t0areoxrcoy1laD lneolt0texm(r3iu1ll emiei ()artaxrpnt0teeo f3tldlsDel( s t0aeeomr oydoa e i i s0srtrxo io4omt  fcils)arrm( poo1alt  o3iltfaDeaumo u4alenmo3tatfat an ols t2trio ou1lmtelfctl(f Dtrxr ;u0altnmfciad m eluvont)alxomo oatlptelieo ( srxoxrpnu4al elfvs (  Dtax  nu4apto f3iasfm2eluvo;(0alxnmf tatoatrli s (  2xoxo3iu4lp nlnesa(  2umu onu1oleoifctltfa2emnms t4 eerir3ootfa rlnvs s  eumirpnodapenmfet ()aDrax ono1olto f3iat s uln p;t0altrmrciadomDeanes;( srxm(opiydamt mfei sfarrrx ono0aetnifcilt sDeauvs ()texrxr iotfptelivs;()s2xrxo3iy4lpenmneiat)aDta( onu1aet iieiasls umu ont0 lxrio todfmt livi;t)seumxm iy4lme mfctls)aDta(ro;o1tptomoeiasla2rmnvp u4 rxomf3oytfmDeai il()texm(o oy4opte iviat arua(r nu4oex  ieild m ranvo u0trxrxoctatlp  aieol( teur(opoo4lle  icsl( aDrrxmp;t1tptomicildla2umn pnt4artrxo oytfateauvol()srumirpiydlpee nvi t) Dumxr oo0aleoii3tlslm ra(mpnt) etomo3totfaDeaivols s2ur(mpnodaltelietasf rra(mp;t0tlx mfetys m um( pnu) exrxo to1fpD li s () 2xo(m3no4lpe mnes t  2um(r no0aexnmociytfmDemn pnt)teerxrctatlate uei;(  2uoir io4amtnlfviltfsrtax  ;o4oeeo fetatfm2uln p;()tlxnxfctydomt aneo;t  euoxr ou1olte ieils) Duaurpno0alto feiatfa ra( p t0 lxnxfciadlaDe n s;() etmxopnydlltnmici t srurxro;u1teenmfcils a uln s ()texrif3iadlaDrau il( setr(rpnu4omtnlnesa()aDrru ont0apxoif3tytfa ul(mo (4 etomrctytlmDr nei;t)s2uo(o3iudlmen nvia(fsDtr(mpnt0tpxn oeild sDulnvo t)tlermr iadlp rlues (0texmxrpou1apeelfct ( sDtmu ono4tlenmfctyd a rl( on(0tlxnmr3iytfmtrauvo;s)trtmir3iy1omt mivtl(f 2umu pot4alt moetatfsDranvs (4 eerxociadlm ran slt0t2tr(m3oo4apt mnvtatfaDtr( o;t1oexomfetat a2rmnvsnt4areoxfcoy1fp r nvs ( srxoir3iodop  mfvt t  Duax  ot0aetomoctadls elnvont4 lxnif3iotfatraieo t)tetmirpoo4opt  ieils)aDtaumooo0tlx  icilslmDuan pnt)altnir3iodomDr nvils0setoxo3oo1amtemicil( sDtaxr ;t4tpxn ietltfsDea(mpnu0 reoxf3iatfp rlu o;s t2to(r3iodame lnci (f Durxroou1apto feiatlsDemn p;(0 eerxr tytoa  aies;t  etr(m3iodlptnlnesl(f 2rr( pnu1apeo f3tyd s2emumonu0arerxo totopD  ivol()trxr(m iy4amtemicsasfa2taumpou4alxoif3tysls rlumo ()tetoircio1lmt luesl( t2uoim oo4ll nmfcsat s2taxrpoo1aex ii3iydlm2rmnvsnu) eeoxf3oytfaDe ueols s2xo(m oydamen ncsltfaDrax  no4tpen ieiasfs2eanvpnu0artoif3oydfptrai ilt0 exr(m ny4openmieiat) rumxm oo4oee ii3ild aDuauvont0alxrif tydfatranvs;t)s2urir oy1am n ics t) rua(rpnt4oltn oeiltlm rm(vs;t) renxo iatfp  livo s  2tm(mpnu1omte fci tfaDrmu  ;t0altnmiciasls rm( o;u4altoif3oytlmte nes;(0trxrxrpiydalee ivtltfs2um( pno0teenmieias a emuvsnu4tltnxf3oo1faD aieslt)trur(mpoodol elics ()srrmurpno0tltn i3iydls elnmp;() etrmf3to1laDeaieils s2umxr3ou1olenlfvsa(fs2ta(  oo1teeo ieiyd a2rmuvp (0texnxf iydomD lies (0 etr(m3oudlmtemfvt s s2tru  nt4tpeomoeiyd s2rl(vo () ltoiocto1fpteli ilt) eumxo3iy1lm n nvta()srtrurpnu1olxnii3iadla2ulumsn(4trenxo ty1fatr ivi s)setmirpiy4lmenlnvta(faruru p;t1aexnmi3iytlaDeau p u) lenxr3totoaDe ies (0sruoir3no4lleemieils)a2raxmo;o1olxomfetyt m2rl(mp;u4artrxr iodfa ranvo t0 exrir3oudlmen ies tfarrmx o;u4alx ioetltlaDua(msnu4texoio oa1lmDr nvslt trxo(r3nu4om emfes sf rtrx poo1teenii3iytls ulu p;u4altrio3tytom elivolt)trtrxm3nu1amtemivt t)srtm(mpoo0aleo ieiat aDean s t4tltrifcootopte n s;t0s2xrir3nydamtemnesat  2rrurp;t4ope  oetydla2ulu p;(4 lxoir3iytom  li s s0 exm(m oo1ol  lfvs sfsrrau poo0tlxnmf3tlsfm2eau onu)treoxr oodlp   uvi;t srxrxr nudlmtemnesa( a2trxro;o0alenmf3iydfa el(vont4 ltnif3tydlp r uvslt0 2xo(o ou4alte ivsls arua( p;u0apxomfciysfaDuanmpn(4 rxnxf tytlp  an s;t  ruo(opou1lle lncsl() Dumu ont4opx ifeiatfm2rmuvp;t4arerxf3tatfate uvi s s2uo(r iu4ame miet s aDum(m ;u1teto o3iadfmDea( s (0teermo3oo1fmDelneils) rxm(opnudlle  icilt)arrau  nt4oeen fcils a uanvs (4 lxnxr tadomt  ieo;s0t2tmir3nu1aptemivtlsfartaur oo4apxoioetasfaDrmnms t)areriocoa1oa e ueols0texo(m3oudll n fcsls  2tru  ;t0aeen i3tlsfs rlnvo;u0texnifcio1fa eanvs (  rurim3io1ape  fciat s2tm(rp;t1texo f3tasfaDean snu0 renmfctadom rlnvo ( trur(opiu1amte ncsls  Draurpnu0olt iociadla ean on(4tlermo oy1omteai o;s0 euoio3iodlmte nesat artm(  ot4teto oeiad aDumnms;(0 ltoif3iadomDe nes;s  ruoir3iydome micsasfartaurooo1olto fciatlmDuanms;(0 reomrciotoa  lnes s  2xmxrpnydame lnctatfaruax o;u4olxoioeiat m rmnmsnt4 rtrio ty1lp elueilt s2tm(m ny4opte fei ( sDrrxm nu0oexnmiciad a2rau o;t0 leoxrcta1lateanvs;s  rumim iudoltelnvtl(f 2ta(mo;o1tpto ietysfm2rmnvo u4teenxr oa1oaD an slt)srxoim ou1ome lfvsas  rtrxmp;t1opxnio3iydlaDemuvsnt4trtnmf3ootfa eau o s) 2trim3iudomtnliciat  rrr(rpnt4opxnii3iat mDrl( o;u4aexoxf3iydomDeai s s)srumirpoudopeemfvs tfsDra(roou4aeen ietyd aDrluvp (0 eerir3ia1fmtrlivsls)seurim3oo1omtnmnvsat artrur no4aexn i3iydfm2elums t4 lxrxo3todoptr neilt)texmiopny1am elicias  Drmx o;o1optnmietysfaDrlu snu0tlerio3ty1opDelueo s srtrir3iydlp   ici () 2rmx  ;o1openmiciytls2rluvo u4 lxrxfcoadfmteln i;t  rurxopoo4lltnmnvtas)aDta( o;o0oexomoeiysfsDulnvo t) eeoir3iytlaD lnvil( sexo(o3ou4ll elfvsa()s2ta(  nu4tpeomieildfaDuan p;t) ltrif3oydfa  li ol()trurxm3no1lltnlnei tfaDtmxr oo4aexnmi3iatfa2uau onu0 rtoxf iydfpte ieo;()seuo(opoydopen net t)aDrm( pnt4tle  octldls2eln on()trtrmo oodop r nvs;s  2tmir no4al nlfct ( aDrau pnt0olxomfeiytls umnmpnt4 lxnxo3iytfm ranes s)setr(m iu1op emivtat)a2tmu p;u0tltniietas s2rau ont)tlerir3iadlaDrlu olt0seumir ou1altelfeilsfartru
\ No newline at end of file
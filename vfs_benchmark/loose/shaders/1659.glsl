@@ -0,0 +1 @@
+ueilt seumir no1am  liei sfs2rrur ot0open oeiadlaDua( s ()aetnio ta1opDeli olt)tetm(r3iudom n nctls) 2urum ot0tltoiociydfa2emu p u)aetrio iadfpD livs;t0trtr(rpny1lle lnesl() 2raxm ;u0tlxo oeiatlmDea(vo;()aetnmo oy1lpD  uvo s)truo(o nudap  micslsfsDtrx o;t4opeoioetas s emuvonu0trermociatlpteaneo () eurxm3oo1am  lnvil(fsrtmxmono0texo ociadfs ulnmo ()areoifcia1latrliei t0 exrim3iy4om nlnvsls a2uau poo1oexnmoeiydlsDrm(vp;()tetnxf3oo1lmt luei;( t2toxr ny1lmenlnciasfartmu o;o1apeoiietadlm2elnvo;u4 rtrmr oy1lptelivolt0s2xrxm3iy1ap nlicil( aDtmxmoot4tlxnifetldfmDeanvo;u0tetrmf3io1latrluvs t0sexmio3oo1optelfet tf rrrurpot0tpe mi3iyt mDumnmp;(4teerxf tadop   u i ( sruoxr3nu1lptelfci s aDtr(ro;o4oeen oeiasls2umumo u) exomo iatfaDe i o;t sexoxo iydamtn nctat)a2tm(r nt0aet  f3iatfa rln s u)altrxr tytoptrauei (  exoio oydom nmfcilsfsrtrumono0oexnio3iatlaDeanmp (0 rtoxfctodfpDr neil(  euoxo3ou1am   ivtls)a2trur no4ope iiciadlmDem(monu4 rxnmrcoatlptean ils) etr(opno1lptnlnet sfaDrmxrono0optniietytls2eaumont0treoxoctatlmte nvo;( t2xm(opny1optelncta()arrrur ou4apeo fciat m2ranmp;t)aetnmociodlatrli s (  ruoiopio1ameemfeiat)sDur(rpot0oeenmfeias mDranvpnu4trerxf3totlm rlu sl(0srtr(rpiodlmtnmfvt (f Dua(r ;o4olen f3iyd s2el(mp t)aeeoircto1lm ran s;( s2uo(r3iy4op n fvtasfarrr(rono1texn oeiat aDemuvp;(4tleoio iotomte n slt  rtmxmpiu4ame livi s a2um(m ot0tpxnifciyd m umu p (0texrxr3iodlm elnvols t2to(opno1lm elfesltfsrtrumonu0oeenmoeiasla ul( snu)tleomrcootop rlies ( trxrio3nu4lmte ieiat  2rrxmonu0tptoiieiatfm2um(ms t)aexnxr3iydlmt ai o () exrimpou1opte fvs t arum(r no1apxomo3tyt s2elnvs ()aexoxr3to1la r i slt)t2trio io1oleemnvsasfaDtrurpnu1tpt  fcils s2rl(msn()tetrif3oydlmte neo;s sexrimpiydomeelieta()srua(  ;u0opxomoeiat a uanmo t)arenmo io1la eaivs t) eumxo3oy4lltnmiviat)artaxmp;t0opx  i3tltfm eluvon(4artrmo tadop   u ol(0tetmir3ny4lleelfvilt)arrau o;o1altoiociatfa2elumsn(4 reomr iydfmteluvilt) exoxopnodlle lnei tfs2ta(monu0oltnmicilt a2ranvp;u4trxrmr3iy1omD liei;()srxmxo oydlmt mfvil() 2tmum ot4tee mi3ilt aDrl(vo u0teerir3tytoaDeauvo s t2xo(m nu4omenmfct t  Dtm(mo;u4tlxnio3iyt m umumsn(0texrir ta1lmD an ils0t2to(r ny1opt lfcia(  2ur(rono4opxoifciadlm uan s t4 lenir3todfmDrli ils0srxoxm3iy4lme lfvsl()aDurxront1apt mi3ildlaDelumonu0 exomo3oatfpDraivo t0 exoimpiu1ll e ncsls  rur(  no1oleomoeiatfaDrlnvp;t0trxrio3oy1lmte uei s t2tmir3oudomenliei ()a2rmxmpot0olxnifcias aDuanvs u)treoxrctatfat li o;(0setm(o3ny4lme lnvsas arta(monu4oexoioeilsfs rm(msnu4aetnxfcty1lpD lueo;s)t2um(r iodolte neils) rtmxmoou4tlx  iciydfs2ua(vsn(4tetrirciadlatr ueo;t0 etr(m oudlpt mnei ( artmxr ot4alenmfctydlmDea(mon() rerxo ty1faDr ueols)texoxo iudapen nes (f rururp;u4texo o3tld sDeaump t0texrmfcia1fp raivi s0 2um(m nydape  nei s sruaum ;o0alxo octls a ean snt4teerxo3tatlmteai o s)srtoim3oy4lpe  ncslt a2trumo;u4tlxomiciyd aDem(mo;() etoxr3tadlatrauei s0t2tm(rpio1amtelfviasfs2uaumoou1oex  ociys a uanmo;(0aetnio tydlmD li i;t) 2umirpny4alenlnvtat)a2uaum ;u4tleoii3ilsla rluvo u4 lenio iodom e ieo ()trurirpno4ap nmnvta( s2ur(  ot4alxnii3tldlmDrmnvsnt4 ltrxo tydfa eaneo;t  2toxmpio4aptelies sfarta(root0texnifeiytlsDul(vo t0teenxf3to1fptrluvs;t)s2trxo3iodomt  iet tfaDumumo;o0tlto fcild s rm(msnu4trxrmf ta1omteaivs t)trxrim iu1omtnmncsl( sDra(m ;o4tet  iciysfs ul(mpnt0aetrio oatfm rauei s)teumxm oo1lmen neia(faDtmurp;o4aee if3iytla2um(mo (4 ltnio3ty1oaD aneo s trumim3iodapt mfvtls) rrau onu0tpen ieilt mDrln s;t0tlenmfcto1lmtrln i t) euo(r3oo4op e nesltfsDua(mp;o4tltoif3iytlmDeaumo t)texnxf3tydoatrli o () euoxopio4ll nlfesa(f rum(mont4olxnifctldla2uau o;(4alxrxf iodlmDrlnvi;t srtmio3no4apenmnctls) 2ta(r ot0opt  f3ildla ul(vo u)tlxrmf ty1opDelnvi ()t2toxmpnu4omenlfvt t sDrruro;u4teto oeiyd mDrau p t4 ltrmf3tytlmtr i i;s0 exrxmpnodll   fvtls  rum(mpno4opx moeild s2em( s u)aeeoircoa1om  aues t t2xrim nydol emict s)s2rrxronu1optnii3iytlmDeanmpnu0tlermf oy1lp rlneilt0teuo(o iydlm elnvi t)aDumxrp;u4tpenifeiltfm um( o t4 exnif oadfp e nvs;(0setr(o3no4amtn ivtas sDtmxmpoo4olxn ocild a2rm(mon(0tleoxocto1oa r uvi;()texrxr ou1amtemiei (f rtmu o;o0tetnif3tld m ean o;t0tltrif todoa r i o;s0srtm(mpio1lmeelfci s) rtau p;u1tetomieild sDrmn o (0aexnmo iodfmt auvo ()truo(opiu4llenlieslsf rraxroot0tpx mf3tadls2um(vo t4tltomr tydoaDeauvsls) rtr(m iy1amee fvi sf 2um(mono1opto fetldfs umnvsn()alermo3oatfpt  uvslt0 rurirpou4ale lncsasf Dtm( p;u4tleo i3tadlm2ra(mpn()treoifcio1oa  livs t0t2uoiopoo4optn iesl(farrm(rp;u4aex moctatfaDran ont4arenxo oy1op r u s;(0texoxm oy4omeelnetl(f rtm(r ;t1oex  fctysfsDulu p;u) rtoir oydla   ies;(0s2xoxmpiy1openlfcsatf ruaur no4aeeo ieild mDrlumo ()alermf3iodfat luvo;t teum(o3oudllee ncslsf rumu o;t0teeoiietydfa2rmnvp;(0arxoxfciodlaD  u o;s)sexm(r3nu4ale mfctltfs2umxm ;t4tpeoif3iyt sDul(mo u) ltomf oodlm e ivils0t2xm(r iodlltnlnctl(  rur( ont0opxomictatfaDrl(mo;()artnir3iydoateln o;()t2toiopnudal e fcs sfsDumumoou0aee  feiydlm2umn snt4alxnmo3oatfpDrli i ( t2xoim io1lm e ivi sfaDuau oou4aex  f3iyd s2rm(vonu0arxoirciytomD aneo;s0tetmxo3no1llenliet s arrr( p;o1teeomoeiad mDra(ms t0aexnxrciatfa ean i;t0s2trir3iy1lmtnmiesa(fsrrmuroot1aptnmoetlsfaDraumpnt)tlxoiocia1la raieils)s2tm(r3oo4ape livias)s2raumo;t1oltomf3iytlmDranvs;(0 rxrxr iatlm eanei;s0seurxrpoudlmte fvsas a2uaumpot0tlxomfeiytfsDeaumsnu)trerxr3tatfaDeau i;s0trtoxo iu4olee neils aruau pot0tpxo o3ildfaDuaumsnt4 eeomfcty1fpDelueo;s0 etmio ou1lm elnci t s2rax pnt4oleomiciasla ul( s;t) etnircoo1oa  aivs;t0teumxmpnudom   fvtl(f 2urur oo1tleo i3iadlmDua( snu4 lermr tatlmDr nvo;t0srxr(m nodoltnmies tfaDumur no0olxo fciltlm eluvp;u)aexoiociodopDrln i t teumim no1lptelictat  2urum oo0olx  i3tys m eanms ()arxnmo oo1laD ai i t0 rxoxo iodope lnesls  Drmxm ot1apxomociydfs ua( snt) rtrmfcoytlpDe ies (0 2ur(m oodlptelfvtlt)sDuau poo1ope  i3tlt mDuanvo u0tlxnxocoo1la e u ol(0srxmim3oudap  miviltfsDta(r no1tpt ioeilslaDrmumonu4 lxrirctotfatr n o t  2uoio ou4lpenlnctlt) 2raumpnt1aleniietldfmDrm(ms;u0alenmf to1fa   uvs (0teurim iy4amte nvi t  2tmuro;t4open feiltfs2rm( onu0texnxrctytopt lu o;t0 eurxr3nu4am nlfcsltfs2um(r ot4oeeoiociasla2rl(vsn(4aexrxf3iydlate n o () 2xrxo3io1am elies t) Durxmono0tpxo feils s2em( pn()arxoxo iytom e ies t0 etm(m iu4lpee ics ()s2uauroot0tpe ioeilsla2uau onu0 ltnmo3to1oat an olt0sexmir3io4amte ivi (  Dum(mooo1tlx ifctadla2umu sn()alerifctatomte ivi s  2xmxo3iodlm emfvt ( sDum( oou0aetoif3ildlaDrlu o u)trtomr3todfa r n s t t2xrxmpou1olen fcils) rtr(mooo1apx  ociasfmDumnmpn(4alxrmo ia1lmt  nvo;t trtr(mpio4ol nlfci tf Drmx p;u4ole mfeias sDeau snt) etniocoatomD lueslt0s2xoio3iy4open ncsas  Duau  ;t4apeoif3tls a ea( o;u4trtrxrcoo1lptrlu o s)srurxrpnodomenmfvt t aDra(mont1aleo iciysfaDelu o (4 exnif iytfmDeluvi;t0t2xm(m3nodamte fetas s2ur( p;t4altoif3ias a em(vp;u)alxrif tatfaD au i;(0 euoxo nydomeemivsasf Dtaxm ot4opxoioctls sDemums (4alenif tydfp elies ( trxrxrpou1lm emfes tfs2ra( ooo4tpen oetytfm um(von(0 eenmocia1oa rlneo;( trxoxmpoo1op elfesls arur( ooo4olxo feiatlaDemn s;u0aeenif oydla  lies;s)srtoio oudlm  mncia(fa2tmu pno0tpxn iciad s2rmnmpnt0tltoio3oodop  lu i;t)sexr(m3iu1lme mietat sDrrumpnu0tltnmietat a umn s;t4tltnmf oy1lpD auvilt)srxo(o3oydalenlict ()sDtauroot0ape  ociasfm2emnvpn() ltoxf ia1fptran s;() 2um(r nu1ap e fcsat arurxro;t1aeeomociasfs ea(mpnu4 rxnir oytfat  nvol(0teurio3oy1ol nlnetatf Dtaxmpou0aet  oeilsfmDemu s u0trxnio3oy1fmDrlueols)s2toxopou4am  lnes (fs2rmxmp;o4alx  fciadfm2ean onu4arxomr3to1omt livo;t texrxo iodamt  neslt aDtr(rpou4aee iieiydfs2eanvo;t0trerxr iadfaDrlnvo t0seur(opoodal n iesas sDumxr ;t0oeenmf3ild sDum( p;(4artnir3iydoa e u i;s teuoim3nu1lltelnesas)a2rru onu0aptn oeiyd a rmuvo t0arenmrcoy1lp rlieilt)setmiopiu4amee feiasfa2ururono1teeomfeiatfs2ean on() reoxfctotomDranei;s seurxr nu4optemnviat a2trur ;u4altniociysfs2rauvs t4 exoio ty1lpD  ues s0s2xr(rpny4opeemfeils srum(mpot1oex  fctas a raumo;t0tltrxf tydlmt anvo s  etm(opnudapee ivil() 2um( poo4apt  o3iadfm em( o u)alxnio tydomD lu o;s0trtmxmpiy4apen fvsl(f 2tmxmp;o0olen fciysla2elnvsnu4aeeomfcoy1op r i il()trtr(mpiydome mics s a2raumonu0oetoiociyd m ulnvont4 rerif3oatfp eln ils0s2uoxopou4amt  iviatfsrrrxr ou4tpenifeiyt aDum(vo;()arenxo3tatlpDr u s s  2xrio iudlm   ieilt sDumxm ;t1olto fciltfs2ranvo t4 reomr oadlpt an ilt  etmxo oy1amtemfctasfarrmxmont4alenif3iys s2eauvsnu)texomo oy1fpt  ieolt  2uo(mpiy4lltemnctl(f 2umu p;u0oexn f3ilt a emn s u4alxriociadlatean i;t)srxmimpno1lpen fcils)aDrmurpot0oetoio3ilt s2el( p;u)teermr tadfaDraiesl( t2uoxr3oodlle mivsl(f 2rm( ono0oetnmietyd sDrm(vp (4aeeomr3tadomteaivo;s  2tr(r iy1am emivsa(f Dtm(  nu4oltoiicils m eanvpn(4arxnmfcta1lpDraies;t)tetrirpoy4omtelfcs sf rur( o;u0oleo fctldlm um( o;(0 exrxfciatomDelies;t  eurxo oo4lpe  ivsat) rtr(m nu4apxn ietyd m ulnvs;()aleomfcty1la  luvs;s0seum(o3no1lpeemivt (f rur(  nt4tetnioeildla2elnvp;t4altrxocoytlmDrlnvsls)srumxopnodopeemfesat a2tmxrp;t4openiieild a2uln snu0 exnxo3ta1lpD  n o t0srtrir3iydomenmivi t aDrrx  ot4alxnifetlsfa2eanvp t) exrifcto1opD an s;(0 rumimpio4ap nmict t sDtaxrp;o0oltomf3iyt aDelnmsnt)treoio oydop ran i t  eurimpiu1lp e fvi tfsDumumonu0aee  fciydlsDel( pn()aeenmfcoodfm r ivo t srtmiopiu1oltelfesat)aDua( p;u1olenmfciat s ulu ont4aetrmo3iadopt  i o t0tetoio oo4olt livtatf rtr(  ;o0tpenmocildla ea(ms (4aleoir ia1la   n o s0truoiopoydlle micsl()s2um(mooo0aetomoeiad aDean p t4 ltrir3ia1oa elu i s tetr(m oo1om emnes t) rumx  ;o4oee ifetat mDumn s u) ltnmr3tydop eau il()trum(o oy1amee ici (f Drmu pot4tpxomo3ild sDrlu s;(4tlenir iotlmD  u o t) 2uo(r ny4amtemnesl(  Durxm ot4olto i3iytlmDra(vp (4alxoxo to1lp elnei (  2to(o3oy1amtn ncsas  2ua( ono1apeo ietas sDea(mo u)alxoxocto1fmDrlu ol( t2toxo io4lmen ictasf 2rr(r ;o0opxn ictytls emumsn(4tltnirciydomDr neolt0 rtmxmpiy1altemncsas)a2ta(monu0tlx mf3tlt a2rl( o u)aeenmo to1latran sls0 etmxmpoo1llt  fvsls sDtrx  no4tpx  i3tls a2rl(vp;t0alxnioctotfateanvi t)setmio oydop n fesls)sDra(mpno1oleoii3iyd s2ul(vpn(0tetoio3to1la elnes;t t2tmxo3oo4olee fciltfa2ta(m nu4tlto feiysfa2rluvp;t)altoiocoytla  lu ol() etoim oydaleelnctas  2ururpnt1ale mietltfa2ra(vonu4 rtnif3tydlm elivo t0seur(o oo1lm nmfcs t)arra(mp;o1apxn o3ils a uau pnu)aeerxo3ia1fpDe ivo;t0setoxrpiy1lleemfcsa( srtmu  no1tee ifctlt s2rlu ont) lerxfctodfmDe ueo t  rxr(opiy1altelnetat)a2raxm no0aee ifeilsfm rluvo;t)arerxf iy1oaD  ieslt0t2xmxr oo4op n fctlsfsrrmx oou1aetoif3tls m2um(mpn()arxrifciydoaDrauvo ()seurxr3ny1lmte fvia(fs2ta(mooo4tlt mi3tatfa umnvont0aeerxr ia1lmD  ieol() 2xmiopiu1om elictls)a2tmx  ou1aet  ieiadfa rlums t)texrxr3iodoptrauvils0 rtrir3iudol  mnvt s s2rmu  ;u4teen o3iys m2emump t0alxomrcto1fpDranvs;s0trxoxr iy1lm n fvt s)sruru ooo0opt ioeiasfaDraump t)alxomfciotfm e ueo ()t2trxr io4llenmies sfaDum( p;o4tlxn icilsfa2ua(vs;(0trenif tydop eau ilt) etr(r3iy1aptnlnciatfs2tm(r ot0teenmoctydfa uaums;(0 exrio ia1oa rluei;s0trurio3ny4ape  nctl(fs2raxrpnu0oexnmi3ilsla emn snt0aeeomf3oytfmDe uvol(0srtmxo3iy1oltnmfct t  2tmxrpot4optomoeiys s em(mo;(4teerxociytoatrlivo () 2xm(mpnodomen nvsa()a2umxrpnt1apxo oetyt sDumnvs;t4altnir todfmD anvols0 euoimpiudolenmnvsas) 2ur(m ;t0aee  feiys aDra(mo;u0tlxrif3io1lmDelueils0t2urxm nodll elnvslsfsDumx pnu1aeen ictyd aDrmumo;u)arxnircootfa rln s;s srxoxm3ou4omenmnvslsf rumu o;o4openmfciysfa emnvo t)alxrio3iy1omD lnvil()s2xmxm nu1al  lfvt t) 2trx ono1tetniociadlsDumuvp;() exomf ootopD aivols s2tr(r3iy1lme mivsat sDururpoo0oltnio3iasfa rmums u0arxnif ty1omteaivo t0s2tr(r no4am  micils)aruau poo4olx iicildfm2uanvo;(4tetnmf3tydlat lu s;()trxoim oodamt liciltfs2rmum oo4ape  oeilslsDran s;u0aetoxf3iydlat aies (0 2xmxo3no1apte iet (fs2umur nt1tee  ocildls2ulums t)arxoxo3oytlpt aivolt)texm(o3iu1lpt liet t) rur( onu4tptoiicildlmDrlumo;u) lxrxf tadomtrau s t)s2toxmpoydlp n ieilt  Dtmx pnt1oltnmfctyt a uaums;u)teeriocoatfatelieo ()srur(rpiodam emivias)aDtr(rpou0opt mf3ildlmDrl(mo;(4artnxf3ty1omDeaivi s tetmim iydlmenmietls aDra(mpoo4tlx  fcilslsDrlums t0teenxocia1lmtraieo t t2toimpio1lm n icta( s2rrump;u0aleo i3ildls emumo;(4teerxr oy1oateaieils0sexoirpny4lpt mfvi sfaDtm(m ot4alto ieias m2rlnvs;u) ltoif3oo1fm e nvi;t0s2trxr3io1amt mncsas)srua(r ;t4apeomieiadla um( p;t4trtoxr3oytlmD li s;s) 2xoim3ny4omee icsat)arrm(ronu4apxn ociys s eln snt4arxnio3oa1opDe ivo;s  etrxopoo1ol  micsat) 2trxr nu4apt  fcilsfm2umu s;(4tetrmr oodfpDrliei () rtoim3iudolenlfvtltfsDur(rp;t1tptoii3iasla2rm( o () rxnxociatoa eluvo;( srtr(m3ou4al n ncsas aDtrx p;u1aptomfctyt s2ul( ont0tetnmrcoy1fp elueil(  eumxm ou1ole  nvia(faruaxm nt1teenioetytfmDea(vo;u0 exoirciotoaD  neils s2xoio3io4llenmiei s)a2ra(  ot4tlt  i3ilsfm2emuvpn() rtnmo3tatlmDe uvsls0 2tmxmpiy4lm elnvs t arumum nt0opto ociasls2emnms u)tlxoxf3ta1lpt  ieslt)trtm(opoy1ap e nvsls aDua( ont0tptoifctltfaDra( o u4tetomrctodfa ranvs;s  eumxo3no1llen nvsasfsDua(rpno0tpe mi3tydfm2em(vp;u0altoir3tytfpt lnvi;s0seuoxo3ou1ole  fei t)artaumpnu4tleomi3iydfa uanvo t4aexniociydom raneilt) 2umim oo1ol  lfeia() Dum(  no4texnif3iadfmDulnvp u4 rxnmf3oo1fmteau ol(0t2urxopnydopt  nvtltfaDumu  ot0apeoifeiysfsDemu p;t4tlxnxf3iytla   ieolt)t2xoim3oy4ape mfctl(f rtmxro;t1opt if3iys a2ua(mon(0arxrxo oo1opt lieil(0srtrxo nudomenlnvtltf Dtmxmp;t4opx  i3tltls2uaumon(0aeeomr tatomteln sl(0sruo(opiu4ap  mfetlt) Dtmxm ;o1apx  ieiadfm2em(vo;(0 etrxr iadfpte uei;(0srurxopiu4amee nvtat)sDururooo0olxoiiciad a eauvpn(4trtnmf tydomDr ueilt)s2trir3ny4alee fesl()srraumooo4tlenmoetasla rmuvs;(4alxnif3tydfp   uvslt setm(opnu4apeemnvia( artmur nu4apx  fctytlsDrmn o;t) lxrircoydlp elnvol(  exriopoo1open ncia() Draxmont0tlxomieildfm ea( pn() ltnxociodfa rlnvi s0 2tmxo3oo4lp  mnvt sfa2tr(mp;u4aexniociyd s2rlumonu4alxrxf iadop eau s s0trtoxo3iu1apee fvsl( s2rau  nt1alx  oeiltfmDran pn(4 eenxo iy1omt  i i;s)trurirpnydole lfvsat)arrruront1aeen i3iatfs2ul( p;t4 reoxo3oadlptrlnesl( sexoxo3oydap n nvt t) Drrxmoou4aleniiciad a2emn pnt4arxomocto1fa  liei;t  eumirpiu4ameemiei sfsrrrur oo0oee  feiltfsDuln p () ltnir3tatlmt anvol( trtmim3oy1omt mnes sfarrrxr oo4tlxniociyt m2rauvsnu)alxrxrcoadfaD li s;s s2uo(o3oy4lle  iesas) Dtmxr ;o0alxnio3iat m2ea(vpnt4aetrmocty1oaDranvols) 2urxr3iydal emivi ( srtmumpnu0alxnifeildls ran pnt)teerxfcoadlp ran i;(0srxo(o nu4opte ics (  Duax oot0teenmi3ias mDua(vsnt0tlxnxo oydlpDe nvils)trxm(m3no4apte fei sfa2ur( oot4aptnmo3iadla2ea( p;t0altnircio1optelieils) rtm(rpoy1llenmnct s)sDtrxmp;t1apt ii3ild m ul(mp;t) ltnxo3totopD ai o;()trxoxo iy4openmnvi ()aDurum ou0opxo i3tasfm2ua( onu4teenmf ta1op raiei t0tetmxo3oy4ll  lfeiatfsDumump;t4tpenio3ilsfa rl(vo u4tetoxr oodoaD ai s;(0srumir3oudape  netatfarur(mpnu1opxn f3iltla ea(vpnt0artnmo3io1opDr uvol( texrxm3nu4amenmnci ()sDraxrpou4olt ii3tasla rlu s u0 renmfciodfaDeliei;(0srtoxo3io4ll nlict ()aDrrum ;o4oeto ictlsfm2raumsn(4 leomr todoat  ueo s s2tmxo3ou1oltn iciat arumur oo1optomo3tasfs ranmo;()aeerio3tytomtran s t s2tmim iy4am n fctl(f rtrxrpou0oleo o3tadls2rmuvo (4 exoif tadopt lneslt s2toxr3oo4lmen ict (farrrxro;o0olenifctyslsDrl( snu4 ltrir tydfpD liesl()s2xoim ou1lme lfcias)a2ua(r nt1tpx iieiytfsDra(vs;t4 ltrmf iotfa  lieols trum(r3nu4lp e neta(f Draumo;o4tetoiocils aDumnvs;t) exnir tytfa e u o t0t2umim oo4olenlfcs s aDrr( o;u1ole  o3iyslm uaumpn() eermr3oo1omt au i t)teurxm3iydamt  iet () Dumur ;t0teen fetld a2em(vo (0arenxf oa1op rlueo t)trtrxo oy1oltelfctlt)a2uaump;o0olxnmoeiyd m ua(vp;t0artoio3oydfmtr neil(  2xrxo nydll e ict s) rtmu  ;t1tpxoiieiyd m rauvont)tlxnir3oydfpt an s s0 etoio3iu4apenmnetl()aDta( o;t0ale mfciadlsDrluvsnu0 lxoxf3io1om eanvi ( t2uriopoy4ole mict (f ruru  nu0olx  octas aDrauvp;t) eeomf oa1opt aueol() rtoxo3oudlptnmfvia(  rtm(  ou4aet  f3iaslsDrmn p;t4 rtrircoo1fmteau s;(0texmio3nudom   ictasfaDra(r ot0olxo ociys mDrmnvs () rermr3oodlpD lieo;t) etr(opou1ll emiei t)sDrmu ooo4opxomfciyd a rl(vpn(0 lxoxr3oy1om r uvi;()srxm(m io1ope mfcil()s2tru oot1teeomoetytlm em(mpn(4 ltnmociytla e i sl(0 etrimpou1omt  ictlt  rtmump;u0optomi3ilt mDrl(vs u0 etrmfcoo1op r uvi;(0s2toirpou1opeemnci ()aDumu p;o1alxn f3ildfsDelumsn(0 etrmr iodfmtrlueolt)t2tm(m3nu4apen nvtl() rumx ooo1aee moetaslmDeau p;u4treomo oodlp rau ils)s2trxo iudap  mfesls) Drrur ;t4altoii3iydfs2ra(mpnu0aexrxr3oodfp rau i;t) exr(o3oy1al emiviltf 2um(mpou4alxnii3ilsla eanvs (0 exrxo todfm r u slt0 2xr(m no1lptn fesat) 2rr( oou4aptnmieiyslmDea(vo;t4 ltnmf ia1fptran i;t0 2urxm iudolenmieils)s2trxmo;u0aet mfctysfm um( s;(0altoxr iodlpte nvol( trum(m3iy4ll  miei t)aDraumpot4oeto i3iydfaDra(ms;()altnmrcoa1lptr nesls teurio ny4ape livsls srrm(m ;o1apenmieiat s2emuvsnt)alxnxf oydlm   neols) 2xmxo3oo4lpeemics t)s2rm( ono4oeenii3iytfaDemums (0tltrxfcoadomD luvo;t)seurxm3nu4aptn neia(faDta(m nu4tptn fctydlaDeluvp;t0alxomr iytoaDr u o;()texmxr ou1aptemictl(f 2tr(rpnu0tptn oeilt a ul(vonu0 ltnifcta1oaD livo;t0srxo(o3iu1oleemivias  2uaxmpnu1olxo ociyd s el(vo;t)alxomrcia1oa r uvo t texrxrpio4ome lici ( s2rru pno4opeoii3iltfaDum(vs;(0 leoif3io1latrln slt trumxm io1open fcils  2rmumont0open o3tltfa rmn p;()trerio3iy1omtraneslt0s2xoxo3no1ape lfci t) rtaumo;o4opxomoctltla2uauvsn(4trtoxfcoy1lpDeaueils) 2xoxo oydlmt mfct t sDrmu  ot1tlxomictld s2ulumpnu4 renmr ta1lpt  i o t)sexoxmpnydlp   fcs sfartmu  no4tee ifeiysfa2eauvonu4 reoir3oa1lpDe n o;t0 ruoxm3oy1opt mnvslt) Dtm( pnu1tlxn ietyd a2el( o t)altoxf oodomtraieils s2trio3no4lltelfvsa(f 2trum ;u0olx  ieiad sDel(vs u4artnxo to1fmD  uvo;s)teumio3iu4lmenlics ( sDrmxmonu1tex mocilt m2rluvs u4arxoxf3tatopDe i i;(0srtmio3oy1ll   icta(  2trum nu4aetnmoetad aDeanvon() ltnmrciytfaDr nvi;t0 2xoio nu4apeemiesas s2ra(mont4tleoifcilt m2elnmp (0 rtoxfcio1fmDrli il(0t2xmim oy4lltn nvi s  Draxr nt1tleoif3iyd a2rau s;t4arxomr iadla  ln o;(0 2umim3nu4lm  mivtl( s2rmxro;t0opxo i3iydfm ea(mpn(4aexrio iytop eaivilt)trurio3nodomt mnei s)s2trx  ;o4texomoeiydlaDulu p (4tltrxo iatfpDe u o;(0s2umim no1lmee neta(  Draurpnu1open i3ilsla rl(vo (4 lxomf3ootfatrluei;(0trxo(r iu4lp e ivta() ruau  ot1opxnmo3tas s2el(mon(4 ltnmo iydopDrlu slt trur(mpno4omt mnetl( sDtm( ono4opxoif3ilsfa2rln p;u0 reomr to1lp rluvo t)srum(m3oy4omtn nvt s s2raur ;u0olx if3ias m uan sn(0aleoxrctatlmtrlnes s0s2umio nudal elnvtlt  rrrxr nt0aet mi3tat m2emump u)trtnxf3oo1fm e ueol() euo(r3ny4lme  ivsat)aDumumonu4oee iictatlaDeanvo t)arxoir3oytoatran i;t setrim3oo4am nlnei (  Duaxrpno0apxnio3tadls2umu on(4tlenmocta1oa   n o ( s2xmio3oo4lmeelfcsat)sruax  no1tpxoii3tat m2eau o;t4trtomfciatlm r u o s seuoiopio1ol nlnetltfa2rru  ;u1tltnio3tyd mDuau o t0arermo tadfm rai i;s seuoir3iy4lleelfvsat)sDtau  ;o1opxoifciltfmDeauvp;u4aetrmociytopDr uvilt0 rtrxo iy1lme  feia(fs2uaxrp;o0texnmf3iydls umn pnu4teenxr iodfptelivols s2uoimpny1ap e ncils  2umu pnu0alxoiictytfm2ulumonu4aexrir oa1lptrauvs;(0trurio3ou4lm  mncta(f Drr(mpnu4oet mfciyslaDrln onu)trxnmr3iatom rlneo t0 etr(opou1lpenmfcslt)sDrrum ;o1apxo feiaslsDrauvp t4arxoir3oodfptrlieolt0s2uo(opoudoptn icias  2tr(mont4aetn i3ilt a rauvsnt0areoxrcootoaDr ueils0s2to(m iu1ll nmici t aDtaxm ;u1alxoioeias a2rmumsnu4alenmf3iy1oaDe ieil(0teuoimpoodapte ivtat)artmxrpnu0tptomieiyt aDum(vp t)arxrxo3iadoptr u il(0 2xmxrpiu1op  mnvilt  Drm(m ou4olenmi3iaslaDel(vo;t0arxnirciytfmt anvsl(0 rxoxm no1lmee ietlt a2umxr ou1aetnifctatls2eaumont)texnmo totfaDrau sls)sexrxr3no4omeemnvtat) 2rr(mpnt1olxomiciad a2rmnmo u0teeomr iy1lpte nvo;s0seumxr nu1ol nmnvs s aDrrxroou1tpt  ieiyd m2rauvs;t0aeerxr3io1lat  nei;(0t2urxr nodlltnmfvi s a2tmump;o0tltnio3tldfaDem( o;u0alenifcta1om eaieols)t2umxo3oy4al   ietls) rtr( onu1tee ioeiydfs uln s;t)trxnif oa1oatrln o ()t2xoio3iy4amtnmivs t)s2ta(rpou1optn feildls2uluvon(4texrxr oatoatrlnei ()t2trir ny4ameelnct (  Dumx ooo4oexn o3ilsfaDumuvo;()tlxnmo io1lmtr uvol(0 eur(rpio1olt mfeta()s2tm(  nu4tleo oetld aDrmnvp t4aeeniociadlm elueils0sexoirpno1llt mfcsl()a2ua(r ot4oexn ieiadfaDem(ms;t0trenmrcta1oate ivs s)srxrxm3nodlmtelici sfsrta( onu1optomietadfa umnvo;u) rerircto1oatr uei;s0tetm(o3no1omtnlncta(  rtmu  ou0tle  fetltla ranmsnt) rxnif3oydlm   ivols0 exo(o3ny1ol  lnei t aDrrur nu0ole  ociys mDeau snt) etrir iatoaDranes;t0t2tmio nu1am emfetls) Duax onu0apxnii3iydla eanmpn(4 etoxf3iotlatr nvo;( t2xrxmpnu4lpee fvtatfarrrxront0oeeoifcilsfaDum(vs (0trtnxo oytfpDe ieo;s)srxrio oodamenmnetl(fsDumxmpnu0apto feiyt m ra(mpnt4arxomfciytomteauvi t) exrxm3ny4ome lfvia(f 2uaxrpou1alxniocias a2ra(mp (0 lxoxf iadopDe nes;t  rtm(rpnydom elietl() rtr( pot0tpx  feilslm rmumsnu4trtnxr iodla  aivsl( t2xoxrpio4am elici t)sDumum ou4tleoif3ias m2rl(mo;u0tltoxf ta1omtelivi;t srtmxo no4lpt  icsa( artr(mo;u4tpxomfctysfs ua(mp;u4aetrmf3iotfpDr i olt0srxmimpoo4lle liet t  rrrxrpot0aexniietldlmDem(mpn()teerxr oatfp  livs;t  euoiopoo1opee iviltfa2rrurpnt1tpeo iciltlsDumn pnt)artnmrcto1fa eln sls s2urxo3oudopeelnct (f 2um(moou1olto ietldfaDuluvo;()aeeoif3oatlptr uesl() exo(m oo1apee netlt  Duax  ;o4opx ii3tldla2um( ont4trtoir3tytoaD lnes;t  exoirpoy1om e iet sfsrtaxmp;t4tlxnmfctatfs2ua(monu) exrmr tatop elnvs s teuoxmpiu1apt mfei s a2ra(r ;u0olxoiociadlm2umnvp t)aetnmocoatfpDraivil( tetmirpno1lmtnlivslsfs2rrxmpoo0ole  fciat m ua(vo t)aeerxrcoy1fmteluesls)texoxm3oudlp n ivsltfs2trx poo4tpt  o3iydla uln pnu4aleriociotomt au o;t)tetmim3oo4op   feia( s2uaxmpoo4alt mfeiasfm umn pn()tlxnxocoadoaDe i i () rto(m oy4lmt mncsa()s2tr(moou1opto o3iatfsDel(vs u0 rxrif ta1oa r neils  2urio3oy1ap emfet ()aDuau  nu1opxoiictasfaDumump;t) ltnifctadom eli i s srtrxrpoodopt mietatfsrrmxroot4tpenif3tadlm el( s;(4trtrircoadlateau i t setr(o3iudamtemfvi (f rrm(m no4aetoiociadlmDrauvp t)tlenmf io1om elivo;(0texm(r3iodol   icsl(  rtruroot4ale mf3tad a ua( snu0tlxrmfctydlp e neil(0s2xo(r ou4olt  ietat) 2tm(  nu0opt iietls mDranvs;t4arerxociadlmt  iesls sexo(m iu4alt lfei sf Durx  nu4aee mictydfs2ulnms;() lenmr oodfaDrlivi;(0setm(o nu4alenmnesas) rrax pno0alenmf3iysfaDea(mpn()texrxo iodop e nvi t0t2uoimpiydal nlici sfsrtmxr nu1altoifctytfa ra(vp;()alerio3tytom  luei;( srtmxrpiydll   icsltf 2tmurooo1optnmieiltlaDemnmo;u) etnifctadomDraivo;t)s2toir3iydap   fei t) 2uax oot1alt iictydfaDrmu p;u4aetoxr ia1oa r ivilt sexmxo3ou4lmee iesl(faDtm(ro;u1aptoiocias aDea(ms t4 rxnxf3tytlm rlivo (  exrxm3nydamtn ncs t aDumxmpoo0ole  f3tldlm emn s;(0tlerxf3oatlmtrau ilt s2xoxopiy4am nlnvia( artm(rpou0apeomf3tltfa2elump t) etrmf3oydlpDrlnvol()seurxr3iy1amenmfviltfsDtm(m no0aex io3iyslaDeanms;(0altoio tydomt aueils0t2to(mpiu1op e nes s) 2urxmp;t1tpeoif3tld a2um(vont0 eerxfcty1optraivslt srur(m oy4lm  licilsfa2uax o;o1oexn f3iyslmDea(mo;t4trxrmr oatfpD  uvo;s0t2urxmpiodlmeemfcslt  ruau  nt4opx  feils s2em(msnu) rxrxr3oatlaDelneo s srum(o3iy4apee feias) 2taxmpot0olenmfciat s um(vo t0texrxr3oo1fptr nes;s trxrir3oy4lptelietasf rtaxmoot4teeoii3iasfs el(vs t0alerif3iodomD  n s;t  2urio io4op nlfvsls  2trx  no4tlenmocilsfsDua(vo;u)aexrmo ta1fm  luvslt)srxoxr3ou1lmeemnesa()aDrm(mpot4alt iictltfm ulu s;()arerif oatlmDeau s;s t2um(mpnudoptelfcsl( s2uru pnt4aex iociyd s rmumon()tetoxr3oytlpDeli i;(  euoxo nudlmeemiviasfarrmurp;u1apenmiciydlaDran p;u)tleomf totla ranvol() 2urim oydamtn fvs tfaDtrurono0apt moctlsls ulu ont)arerifctotlp  lnei;s s2trirpoy1lmt mfvsas)sDumu  ;u4opeo i3ild a2eanvo;u0aleomo3iotfpD lnvi t0 exrxopoodol e nvsatfsruaumono0tpx mfctlslsDeln p t0aexoircto1oaD luvils  2xm(opoy4lme mfes sf 2tau  ;t0aeen o3iyt m ranmo;u4texnmocoy1fmteliesl(0 euoim3iy4alt  fvi ( aruaur ;t0tetomo3tadla umumpn()treoiocoatlmDrlnvo t0 rtmir iy4lp nlncs tfs2ur(mpoo0opxnmfcildfs2el(vsnt) rxoio3iodoaDelueols0trumxo3nu4lpen nesls  2tmur nt1apxo ictldfm ranvonu4tlerxf3iy1oatrlivilt0t2tm(m3oy4omee nct t srtaumonu1teeomoeiysfs umnvo u4trtnmfcoa1fa   uvo;s)srum(r3iydlmenmieils  rrmurono0oeen fciaslaDemn onu0artomociodom rlu s;t  2trim iy4opt lics sfartm( ooo1aeenio3tat a2rl(vo;u4arerxrcoydlpte ivols  exmir3oudllenmfctlsfsDua( pou0oee  fciatlaDean pnt4 lenmrcoa1fp  auvo;t seum(o nu4ope miesas)s2rmxrpoo1aex ioeiadfm2ea(vsn(4 ltnir iodom  li o ()srxr(r io1aptnlnes s)aDrrxrp;o4aexnmfctls sDuanvp;u0tetrmr iytopt an il(0trurim3ny4ole miet tfa2ur(rpnu1tet mfeiys m uluvsnu) exnmrciadlmtrau s;() 2toirpiu1apenlnctas  rrrx ont0alx iieiyd aDel( o;t4 rtnxo3iadfm ranvo s t2xrio iudlleemicilt  2urxm ot4tle iictltlmDuan p;(0alermf3tadlpD  ueo;t0trtmxmpio4al emfetatf Duaurpoo1aex  oeiltls ulu snt0tlenmf ia1optr u i ( s2tmiopnudopeelnvsl(fa2truront1tptomictltfsDua( sn()alxnif oy1fp rauvs (0trxmxopiu4lleelivi ()arumx  ;u0alenioeiysls umump;u0 renxf3totfa elivo t0sexr(m3nu1am   ivi sfsDtmuro;t1tlen f3tad m ua( snu0tlxomf oa1opDean sl(0t2um(o3nodop elncslt artmumpno0texn feildfs2umu p;() etnxr3iatlm  lnvi;t0 rtoio3nu1lm   fvi ()artrur ou1apen iciadfm2ranms t4 renif3iatoa rlu i;t0srtmxopnudop  mncil( aDurumpnu0tet  fcils mDumumon(4 ltnmo3oytfp   ieo;t t2xoxmpoy1am   iciltf Dtaumpnu0teen i3tydlaDemums t0trxrmr3ty1optranvs ()seum(r3iydllee ict ()sDtaumo;o0tlto ieiytlm em(vs (0 exrmo3iodfmt  i s () 2toio3nodlptemnvs (fsDuaurpou4alto fciatfmDuau p t4 leomf tatlaD auvs s)s2umxm no1ll nlfvt t)s2uaxroot0opxo fcils a2umn snu4 lenxo oydoa eau s;t)t2tmir3oy1aptn icsl( srtmum nt4opeomieiatla2ua(msnu0 rxrmo tadoaD aneilt0trumio3ny1amt lictat srtmu o;u0tltomfctldfsDel(ms u)trxrir3oodfp eanvil( t2xr(mpoo4lm e fcil(farurx pot0aexnif3iadlmDeau o t4 lxnxr oatoaDe iei;()seum(mpiodomenmict ()a2rr( ono1oetn ietaslsDum(vp u0tltoircia1lmDrauei;t)t2xmxr iodlmtn ivi sfaDrr(root0altoioetaslm2emn on(4aetrifcoadoa r iesls)s2trir nodal nmict (fsrta(r nu4tlxomfciys s2el( s t4arenxfciadfp rln o (  rumiopnu1ape livtltfs2ururpoo4olenmociyd s2uln on()arxnir3oydfaDrlivi (0 exm(r nu1lmtnmnvtasf rumx  nt0oeenmietys a uanvo;u)trxnxoctatlaDeln ils)sruriopnydlp   nvia(f 2urumpot1aeen fetatlaDeau o;(4 rtrxo3oytopt lu i;s  2xm(m ou1omtnmieia(farrmu  no4opeoifeilsfm ea(vsnt0alxrxfctatlaDrlieols)s2tmxmpoy4ope livt tfarur(m no0tle iociadlmDuanvo;t4alxrio ootfmDeanes;t srumxmpnu4oltelnctlt)srtaxrpou0aex mi3iytfaDelu p;t4aleoio3to1fm rli o;s0 2urio3oodoltn ietltfsrumu pou0opxnmf3iysla2umnvpnu0tetnircoodom  ai i t  2xmxr3ou1altelieslsfaDur(m nu4alto o3tlsfmDem(ms (0 rxoircoadfpDrli slt0seurxopnydop e fesl()arumxr nu4opx ifciaslm2ul(msn(0tlenmf totomDe ivil(0 2xoxo iy1am  lnvta()aDtru ooo1ale mictasfs2eanms t4arenir io1fpt  i s t0s2umxm3nodlltemivtl( a2uru o;t4tpenmfeildfa2rmnvs;u0tltnif to1fm e n slt)texoxmpnu4omt mnciltf rumurp;u0aex  ieiytla elnmsn() etrio3iotfp  luesls)teur(m nu1lmt  fcils) 2tax ooo1oex  o3tadla2ul(vpnt4tlermf iadoptr neo;(0 eto(m3iydlltemneiat  2rmxrpnu4aexn ocild m ulnvpn() lenmoctatla ran slt)t2uo(o io4ol n nvtltfa2ta( onu1tpt io3ilsfaDem(vp t)artoir iotlm   n i ( s2tr(m ou1ap n ncsls arua(rpou0apen ictyd mDul( o (0aexnifciodoptrlivol() etoir3nu1llen ivs (  2umxmp;o4oeen i3iydlm2elu ont0 etoio3iy1lmD  nes;t0 exo(rpoo1op nmiesas)a2rr( o;u4optomfctlsfaDeluvo t4 rtrxocoy1omD au sls0s2xmxm3nudll n ivs s  Drrurp;u4aex  f3iat a rl( s;t)trxomr oadoatrau i;t)s2xo(mpou4omtn nesl(fsrumxm ;o0oetn o3iaslm ea(vs u4 rtnmf todomte uesls)t2tr(r no4amtelfei t)aDumxro;u0tlx ifciys m ranvo;()treomocoatopDr u i;s) 2xoxm oy1am emivslsfs2uru  nt1aee  f3iatlm ra(vsnu4aexnir ty1fa eanei;s)t2trirpoo4amtemiesa( sDrrumoou1aeeomf3iatfa elums;() lxnmo3iotfpDranei;s)trtm(m3no4openmneslsf 2truro;o0olenioeiat m2eaumo;() reoif3iydlpDeaivi s srurim3no4aptelfvilsfaDurxrpoo1altniietldls2rl( o;t0texrmrcto1latrai ols seurxo3no1amtnlnes tf Drmxmo;o1tlxn o3ias s2emn o () lxnxocio1op e ivols0s2xmxo3nodole lfciat  2rmurp;o1tetoiocilslmDrau o t0 lxoxo3ootoa eau s;( tetmirpnydamtelnetl()sDtr(m nt0opt mietytlsDulu s;u) exrmr oo1op eanes;s)srumxm no1lleemfcta( aruaxro;o1opx iiciydls2rau on()arxnmo tytfmtranvols) rumirpoodolee ivt t) Dtaurp;o4oeen ieiys m2el(von(4 exnxf3oo1lm eluei;( srum(rpoodop   nvs s s2ua(ront0tpxo oetysla2ea( s;u0altnmo ia1fmtraivols)trxmim iodal elnvtas)s2tm(r ot1altnifeiasfsDuanms ()tleoxr tytfatrlnesls)trxmxr oodam   nvt t)s2rrx  nt1olxnmo3iatfm ranmon()aetnxo ootfpteaiei t0s2um(rpiy1open fct t) rua(mp;o4apto fctydls2rmums;u4 rtnio3oytfpte u ol() etm(o oo4al   neias)s2urxr oo0tee ifeiasfs emu s;(4 rermr3tatlatrlnei;s) exmio3nodal  lfcias)arua(ronu1tet ifciat s2uln o;u4 etrifctotlptraies;(0trxmxo3iy1optemiciasf 2tmu ono1apeoii3iytfm rln snu4 eenxo iy1lpte n s t0trurxr3nu4amt  ictltfs2rrx ont4alt  fciasfm um(vsnu)tetnmo3ootfm eau slt srtrxopiy4ol nlfvil() rrr( p;o0tpeoiieild m2ra(vs;t4texomoctodla  aieslt0texoio3oo4opeelneta( a2rmx pnu4tpt iociadla2ua(ms;(4alxrmo iodlaD aueilt)tetoxrpiy4amt lfei ( sDrmxrono0teenmoeilslsDul( s () rtnir3tytfpD lneo;s)t2to(r3oo4ape  ivs ( s2rm(r ot0tptomoctlt m2ranvon(4aetnxfcoa1lptrauvs () ruo(mpio4optn feilt) 2tmu poo0tex miciytfsDul(vs;u)artnxf totla e nei t0 etr(m3iodol eliesasfsrrrxrpnt4tlto ietydfa2umums;() ltomr tytlm r ivo (0s2tm(r io1opee fvsat) rtrur ot1tptn oeiad s2uluvpn(4 rtrmf3oadfptrauvo;t)tetr(opno4lm  mnetat)sDtm(rono4aet  ietat mDumnvpn(4trenioctytop raues;s) rurimpoydoltelicsa(  rtrur ;t1alx ifciatls eluvpnu4 rxnmf ia1lpDr uvilt) 2tm(o3iudopt mncta(f rurumonu0tltnio3tys m2ulnmpn(0teeoxf tatoaDeluvilt)seuo(opoodllenlfes s artmxmono4oltniictytls2uan o;t0teenxr ootlpteliesl() rur(m3ou1ol nmfcs s s2tm(m ;o1opxnmoetlsfm umu sn(0aexoio oadfmt au sls)srto(rpnu1al nlnvt ( srta( poo4oetomfetytla2ra( s;(0altrir3iydomtrln i;s t2umirpoo1am emnvia(fsrtau pnu0ale mfctasfm2rln s;u)alenmo3oo1om ean i s trxrirpnu1am  liesl(faDrm(rooo4aee  ocilt s2uln snu4 etoxf3ty1fmD lueilt texm(mpoodom   ietat sDuau  nu1tleomietltls ulnvp;u4 rxnif3oodoatran i (  ruo(m3ny1lm e fvs (f rtaurpou0alt if3iysfa umn snu)tlenif3ta1fmte i s t) etrxr iodll emfvtl() 2umxrono0oeeniieiadlaDuaumsnt0 etrmr ootlat  ivils  eumxm3oy4ole  fvsatf 2ur(r ot4olxn ociat a2ul(vpnt)trtnmr3iy1om   n s;t)s2toir oydlmte fctat)a2uru  ;o0alto fetyt s uanvs;t4tlxrif iatlp rli s () 2toxm3ny4ol elfvtlsf 2uax ono4tlenif3ilsls2ra(mpn(0tltniocta1fmtranvs s t2um(m3iy1apen ivi t)arur( onu0altnifciyslaDrauvo t0treoxr tytla rlies t)s2tmir iy4lmte iet tf rraxrpnt1alxnif3iadfa2rau ont4artoir3ty1opDrlneo;t)trur(m iu1lpeelnet (f 2uauro;t0tpenio3ils a ul(mont)trerxr iotoat auvilt teuo(rpoy4ope lfetas s2ta(  ou4oetn fctyslmDumnms;t0 ltrmr todopDe n ilt  rtrxr io4lpte ivil() 2um(rpou1teeo i3ils m uau on()altomfciydomte neol(  2xmio3nydomtnmfesltfarrm(  oo0ole mo3iys m2ra( p;(4tlermf3oa1lpD lnvslt tetrim nudllenmics tfa2umx pno4tptnmfeilt m ranmp;t)tltnxfcio1optr ues s)sexm(m3io4am  lfct sfsrtaxmp;u1oeenii3ilt sDrmu onu4 rxnmo3iy1lmte n ilt0 2xriopoudap   ict t)srtmxrpou4ale moeiyt s umums u4 ltrxocoodom  au o;( t2ur(r oodoltn net s) rrmx  ;t0aex mfciltfm emu o ()trerxf ia1lm e i i t)t2toxr nu4alt mfvs tfa2uaurpno4tlenioeiytfm2rln o;()arxnio oydfmtelu s t)tetoxo3no1llt lnetasfs2urump;u0tpenmo3ias aDuanms u0aexnmf oo1lpDraieilt t2urxrpio1ol elivilt)a2rmx pou4aeenif3tyt sDumu pnt0 etnmrctytfp   ivilt0truoiopou4lm  mnvi tfarum(  no0opt  i3ilsfm2ranmpnt0artomo iadlmDeluvo;s0 euoirpnu1amenlfcsat)srur(roou4olen o3iytfs um(mo (4artoir tatlaD  nvi;s) rur(o3nudom  lnvi s)sDur(m ;u0oeto oetaslmDulu o u4teerir ta1oatelies t  2um(o3iy1ll emici tfarum(  no0aleomf3tyd s2rluvo;t)altoir3oytoa rlneolt0srtrio iu1lltnmictlt) rtrumont1ole ii3iad aDemuvp t4tetoxrctodfp rau il( t2um(r3nu4altemncil( s2uax  ot0tlenmi3tadfa em(vp;u)aetomfciadlaD li sls)s2xrxm ou4alt mncs t sDtmx pno4apx mi3iasfa2el(ms;u0artnxr iatlmtranvo ()s2xmim oudllt lnctasf ruau  ;u4oee iieilt a2ranvo (4tlermf3oo1la r ues t s2tm(r3nodoptnmfvt s) 2tmx  ;t4ale mfeiasfm ua( snu0artnircoy1fpt aivi s)srxoio oo4ap n iesls  ruaxmpno0oetnmictltfs2eln s;t)tetoxf3iodla eln slt0teumxo3ny4lmenlfes s s2tmxr nt0opxn fctad mDrlu pnu)tleomo oy1opt  i s ( t2xrxr3no4ll n ncsat a2umur ot1tex ifeildfm ul(vonu) ltnifctodomtelnvs s0 2umxopno4alenmnetatf rum(rp;u1aexomfeildlsDrlu on(0trenio iytomD lu ol()sexrxrpoodlleemncs t  2ra(root4texo i3ildfmDul( s (0 rxnxrcoo1oat lneo (0 rum(m3iudolt lfciatfs2tmump;u4tet  feiasla rm( onu0 ltrxf3oytlateluvol() eur(r3iydamtelivtlsf 2tmxm ;o0oleomictadfm2emuvp;(4tltnxrciatopDrauvi t0 rxrxo3oy4lp emnes (fsDrauroot1apx io3iytfm eauvo;u0 etrmo3iytop  lnes;s setoxm ou1omenmfcsasfs2urxmpnu4tltn ictlslsDra( onu0 exrxrcio1fp e n ils)setoio3oo1lpe micilsf Draxrpno0tpt mi3tldlsDul(mp t)alxoirctodlmDr ivo s trxm(r3nydapte iesl( arur(  ;u0teeoio3iat m2rm(vsn()teeomo3io1opDranvo;t  2xoxo iu4am  mnvs (f rtaxrpou0opxnmoetldfm rlnms t)alermrciotom  aneo s0srtoirpno4lp   nesl(f Drr( onu0olxn feiyt aDulnmo t4trxnir3totopD anvo s)teuoxopoudllen nvia( s2urxrpoo4tle moetytla uaums t)aexoiocoydfpt lu o (0 rxo(mpnu4lle  icils a2taxrp;t4apxo f3iadfsDumnmpnt)trxrmf oadop  an o t)tetoxrpoodaltn nvilt) Drmxr ot0aet ii3tltfs rl( p t4 leoxf totlat  ies;t)trxmxrpoydal elfesat) Dta( p;t0apenmieildla ranvpn(0trtoxo totoatr nvs;(0trtoimpnydlpe mivsl( sruau  no0opt mietasfm ra( s;(0tetomo3iydla eauvi;s0trum(mpnodoptnlfcta(f Dtrxrpot4aetoiiciytls2em( o;(0trxrio iodlpteaueolt s2toim io4lpt miesa()s2ururo;u0tpe ifeiydla2ran o;(0tltrmfctadom  anei;s tetmirpiy1ame livslt srta(ro;u4alto o3ildls2rmuvs u) ltrmo3oo1opDraneo t)setr(rpoodapee nvi s  2ua(roou1alt  fctydlmDuanms t4 lxomrciatfm r i i (  2tmirpoydlltnlnet tf 2uau p;u0tee  iciaslm rl(mp;t4aexoxo3oo1fa rlu i t)t2umir iy4olenmiet sfsrrm(mo;t0oetomi3ilt m ua(vpnt)aexoiocoatfa   uvo;t)sexm(r iudopen feil()a2urxm nu4ale moctasfs2eau pnt4teermr iydlatrai s s) 2tmxm3iodole mneilt artmxrpnu1opxnioeiadfsDeluvonu4arxoxocty1fpD luesl(0t2toxr3iudalt lfvsl(f rrm( ono4alto fciyslm ul(mp u) eeoio tatfaD livsl()t2uo(o3oo1optnmivi t srrmxrpou0ale mo3iyd s rln pnt0aeenxr3iotoaD lnvo ()t2xo(m iodllenlfcs (  rrmx poo0tptn f3tysfm2ua(ms;(4trtoir tatfat ln sl(0t2xm(m ny4ap emfvt s) 2tmx  ;u1apeniictyt aDelu o u) reoxf3io1lm eaivo;(0 rumxo no1lp n fesasf rurxrpno0oet  ieiatla2ra(mo;(4 lxnmf3oydopDrlueslt) eto(opoudom elneta() rtr(m ot0tptoiictydls2umnmsnt4altoxf oa1fa  lueo;s0trxr(opou4ll nmncs t)srra(  oo1tltnifeilsfsDra(vp;() exoif tadom rli ol(0t2trxopio4lpee nesatfaDrau  ot0altnmf3ilsfsDrmums;()treomo3tatoateai i (0 rtm(o3io1omeelicilsfs2um(rpnu4ope if3iysfa rlu p (0trtoxf3ta1fpte nvils)seur(o iu1ole lnvt ()arta(r no4alxo oetydfmDumnmsn(0 rtnir3ia1lm   n ilt  eum(mpnu4am elfvilt)aDraxrpnt0olxnmietys aDuanvo u) exrmr oatlatrluvi;( s2um(r nu4om nlnvtlt)arurxr ou1alxomf3iadlmDemnvo;t0tlxomfcoadlaDeli o;(0 rxm(opoudomeelnct (fartax oou4oex  ociyt m emu s (0trerxociotfp r ieilt0 rtmxm iy1lmee fcsas  Duax  ot1tpen f3iatfs uln o;(0teerio3iydlaDean o;( setmim3nu4lp emnviasf Drm(r ;t0tpe ioeiysfs ulumo;u4 leoifcoydfa elieolt)srumim oy1apt  fei (  rrmu onu0tleo ieias m2uln o u) eeoiocta1fatelnes s)trtr(mpio1amen fcils  rururonu1oee moctydfmDeauvsnt)alxoxrctytop e u o s texoxm iodalt  nvta() 2taur nt0opx mieiatlm2eanmonu0artrxrcoa1oaDrau sl( srxm(mpio1open fet t  rrrx pnu1tet mf3iydfs2ean s t4 lxnxr tatlm eaieol( srumxr3oy4am  licsa()a2tr(moou4tlen oetls aDulumo t)altrmr3oatfp elnesls trumxm3oy4omenlfcslt aDua(rooo0oleoio3iatfmDulums t0 exnxr oa1lmD aueo t s2xmxm3nudopee icils aDtau  ou0texomieias sDrmuvon(4 eeoxr tydoaD anes;t trxoxr3no1ap n nct (faDrrxr nt4teenmoetls s um(vont0texnxrcoodfmt ln i (0srurxo iodlpeemnes s artr(  oo0tpeo i3iys mDulu snu4 rxrmo todfp rlieils)srto(m no4lpen feil( sDrmxmpnu1tet moctas m eanvpn(4aexoio3oydfpDrluvolt0teurxr3io4ale lfvsl(fs2rmxmo;t4tpt io3tydlm ran o t4alenxociydfpD luei;s0t2xmxopoy4lpt lnvs ()a2rmx oou4olxomi3tlslm ean p;(0areoxf3iytoateaies s  rum(m iy4lm   nei s sDtaxrpnu1tleomo3ilsfa2ea(vo;t4teeoxocoadfmDr uvo;()setr(o3oy4lmeemietl() 2uaurp;t4oetnmoetys a2emump;()trxoif tytop e i o;s)t2ur(o iodoptn nvtat) rtm(r nu1tleo iciydfa2eanms t)altoio3oatom elneo ( trtmio nu4altnmivtasfaDrmxmpoo4tpx mietasfa2elnmp u4 rermf3io1fptrlnes;()texoio io1altelncsls)a2raur ;t0apt  f3iyt mDea( s t)aetrmrciydfm r nvi (0t2xm(o nu1omtnmneias)s2rmu p;u1alxnmoctatfm2uan p;(0tltoxoctadfmDrluvs;s  2uoim iudomt mfeia( artrx  ;t4apt mociasla rm(ms u)aetoifctodfm e nvi t) rxo(rpou1olenlneslsf 2uaxr oo0olto ictlsfa2uluvs;u0 eenxfcoy1fm r n ol()truoxm iudam  lnes ()s2taxr ;t4altnmieias a2rmuvont)altrmocto1lmD anei;s) 2umxopiy4lptnmfetasf rurumoou0oexomieiadlaDrmn p ()aeermocoa1opDr nesls)t2trir3iy4ll  mnei s) rtr(moot1oet if3tysfa2ranvo;(4tetnxo iatlmD ln slt)trumir3nydopt  fciasfsDraurpoo0aleo feiad a2umuvon(0 rtrxr oy1omtelnvo s)s2uo(r3nydlmenlnvt s)s2rru  no0aeeoif3tld m rlnvo () reoir3iotfaD  uvi;( t2um(m iydllt mivt tfsDum(mp;o4alt mociydls em(mp;() rxrmf3todfmtr neo () exoxo nudlpee iciat sDtauronu0oeto ietldlm eaump t0trxrmr3oa1la ranvolt  2xoio ny4amee fcsltfs2rrumo;t4oex io3iysfsDrau o t0aetomfciodla eai s;(0 rxoio ny1openliviasfaDrau p;o4alxomocilsfsDraump () exoxr tytlpDrauesls s2trxrpoy4lptemivi sfarrmur oo4tlenmieiltfm2elu s u) rxnio tatfpDrli o;s  2xrir3nu1lle  icilt)srtauronu0oexn o3iasfs2uanmpn(4aeerxr3totfp  aiei (0 eto(m nydopt mfvt ( aDrr(ro;t4ale mfctydlm2rm(vs t0aeerio iydlpDe nes s0srtmxm io1ape  icsl()a2tru onu0oleo f3iltlmDrl(ms;t0 lxoxr3oytomD  nvilt sruoxr3iy1aptnlnesat)aDuru  ;u4apt  iciytfsDea( p t)altoio3todomteai il()texrim nodll  micsl(fa2rr(ro;t4oeen ocildfa2ra(monu0 rxomrciy1lpD lu i ()trxoxm3oudaleelfesls aDrr(m oo1altomoetaslaDuln s u)tlerxr io1lpDrlu ols0s2xo(mpiodapt lfetatf rurx pot4teen ociyd sDrm( ont)alxrxrctadfmDr nvol() 2uoxr3ou1lpt mnvta()artruroot0alxoiieiadfaDrl( snt0 rxrmo ty1fptrauvo ( seuoxm oo1llee nvt ()arrmumoot0optnmo3ildlm2ulu s t4 ltriociatop rau i;t tetm(r nudol n fcsls)aDumx  nu1aexnmiciltfm2rm( sn(0teeoxrciy1omte ieo t)t2to(opou1op elnetl( a2ra(ronu0tptnmfctys sDea( p (4texrmr todfm  luvi;s0trtr(r3ou4lpt lfvtat)sDtru o;t4oeeoif3iatls2rau p (4teenmf io1lmtrli i s0 2xm(opiydopee ies (faDra(r no0aeeniociydfmDrmnmsn(4altnircoytlaDelneo s)s2xr(o nu1lmen nvtl(fa2taurp;t0aetnmoeilsfs2rlnvs u)texrxf3iydfate neo;(0seumio oo4lmtn ivta(f 2umx p;u1opt mf3ias mDuluvp u)treomo3oy1fpDrlivi;s) 2xmim3io1amen nes t) Drmx  no4oeeo fciytfsDrau s t4 lerir3iytlm eln i;t0tetmiopiy1aleemivta(fa2ra(  ;t0oee mictytfm ra(vs;t0trxoirciytfaDe i s t0sexmxr no1lmenmfviltfa2ur(  ou1tltomiciat m2rmn s u0alxnif oodoptrau o t)t2ur(o3ny1ale  nci (f 2tmur ou0tlenmo3ilt s2eanvo;u4 lerif tytomD  uvs;t t2to(rpiydal nmnvt sfsDrrurpot4aex  oeils m umn p (0 eenxr3ootopDelies;t)tetoxm iydamt mfcsa(  Drax onu4opxo ietydls em(mpn()arxrmfciy1lm  anvols0seur(mpiydopee nesl( sDur(  nt0tetomf3iltfaDelumpnu0 reoxo3oo1fmDeaneo ()truoir3iu1alt  feilt) 2tmxroot4oleo iciadlm2rmumonu4 exoxf3iotlmD livo ( srxmir3iy4am e ivsat  2urxr ;u0tle mf3tlsfsDumumsnu)areoxociotfa  ln i ()trto(r3oy1lp  lictlt) 2trxr nt1tlxn f3tlsfs2el( s (0aexriociodom   neols0 etm(m iodlptnmies tfsrua(r ou1aptoif3iaslm ul(vpnt)arermr ta1lat  i i s0t2ur(o3nodoptnlfvta()srtaxmonu1tlt mfetysla2rmn o;(0aleoio3todfaD livo;(0srur(opoodop nmfci s  rtrxmonu1optnmiciyt m2ua( on(4tltoioctadfmt lu il(0 rtmir3no1amenliei t)sDuaxmp;t0tptn o3tadfa2ua(mo (4 eenmo ootoaDe ues s0t2ur(o ny1lm nmfeias  rtaxrp;o0oexnifetadfa ua(mp u)arenxoctytlatraueslt)s2xoxmpiy1al e ivsls)sDtax ooo0apt ifciysfmDemumo ()aexoif3tadlm eau s (  exoir3iu4olenlfesasfaDtrxront0teeomfciyd a2ranmpnu0 ltoxo totoat lueo t0s2uo(r iy1ll n nesls)a2raxmo;u1aex  f3ildfmDeaums ()aeeomocoytlm eluvs (0 ruo(o nudolen nvi () Drax oot1tpenioctlsfsDel(vpnt)arxomoctytfm  livi t  2umir oo1optnlicilt)aDurx pou0alt mocilsfm umumo;t) ltrmrctytfa elivs;()srtmio3nu4lmt  iei tfa2trxr ;t1apx mietadfa2ul(mo u0teeoif iodfa rlieo t t2xoimpou4opt  feslt) rra( ooo1olt mf3ias s2rl(vpnu4arxrif3oytlaDelivi;t0tetrxo3iudal nliciasfartmuront1apxnmfciad sDelumsn()trtoir3oytopDe i i;s0 euoxr3nodllee ivils arur(rpou4alen oeiytfm2ua( s u) rerxf3todlateaiei ( srto(r3nodomtn ivtl(fs2ur(moou0olt  ictadlm rlumo () exnio3oydfmtrauvol() etrxo oodamenmfesa() Dumumooo0tlen oeiltfmDeanvpnu0arermf3oodfpD  n ils) rxrxm3iy1omt  ivsltfs2raxm ;u0opxoifcildlm uln s (0aleoio3iytoateli s;s  2xmim3ou4lpt lfvta(f Drau  ;o4tetoio3tld aDem( o;t) rtrif oatlmt auvil(  euoir iudlltnlnvil(farrmx o;t1aeenio3tadfa2rauvs;(4 rtoir3ty1la rlivol()teuoir iu1ll emfctls a2trxmont4tlxnmieiasls2eauvo u) eenif oytoaDr u o;(0s2xrimpiu1al emnvias)arururpno4texn fetadlsDrl(vs;u0arxrmf3oadfmtr uvols) etoxopiudop nlnvilt aDuru o;o4tptoifciytls em(vpnu4 lxrmrctodopDe iei;t0trxrimpiydoptnlnvtlt arua(m ou1apxnii3iadlm ulu o;()artoircto1op rli il()texo(r iudapenmncsasf ruax  ;u0ape ifcildfm rmuvo;u)aetnxfciy1fp eanvo;s srxoim ny1llt mnvils)arraumo;u0tee  i3iltlaDemuvs (4tltnmfciodomD  n i ( trtmxo3nodop e net t)s2tmuroot4tee iietld a rl(vpnu0aexomf3oa1omDraues s)t2tmxm oo4op e net ()sDraur ;u1olx iiciat m eluvsnt4arxoio iotop   nes t)trurio io4om nlfcsasfs2ra( p;t4aexoiociytfmDrm( o t0aexnmr3iytop   i slt seurirpoy4lmt  feia(farum(moou0aexniiciasla umnvpnu0 eeoir ia1lptraieolt0srto(opiudoltemictl(  2uau o;o0olxo f3tys m rmuvont4trenxociatopDelneo t  rtr(mpoy4openlics s) rur( pou0tpen octadfmDelumpnt) rermoctotoatrlneo t)s2urxopoodap elfvtlt  rtaxr ou1ope  i3iatlm2el(vp;u4arxomrciodlm e i ol()s2xmxo3nodome mfet s) 2urxmoot0olx  f3iltfs rluvp;u0alxnir3to1la  aueo;s0 etrxr3oo1amt mfeiat)s2trxronu4tpx iicild s em(mo (4 eerxr3ootfmDean i () rtmio3oo1apeelfvtat)a2umurp;o1tee moeiasfmDeln o;u4aexrircootoateln o t s2xmxopiodlp   ieils  Dtmx pou0tpxomiciasla eaums t)aeenifcoo1fm eaiei;t) rxmxm3nu4ape mnet ()aruaxm oo0tltn i3iyt s2ulu p (0altomocto1oatr ivilt  2xrxo no4lpt  iesa(f rrr(rpnu0teenmf3ilt sDrlnvs;(4trenmfcty1lp r n s (  rumir io1ll nmnvt (fsDtmx  ;u4aetomoetys m ea(mo () rtnmo tydoaDeli ils setoio3ny1omenmicslt)aDta(  ;o4tetnifciyt a2eln pn(4aeermo3ta1fpD lueo;t s2xrio iodam nmiciasfartau pot1oltn ociatfs elnmonu4 rxrxocoy1faDr n ols0 rtr(o3nu1llt  nvi t artmu poo1aex io3iyd aDrmnmo;u4altrmf totoa e iei s)t2umxo oo4olen ncil()a2uru  no0alxo f3iat m2ua(vsn(4areoxocoy1late uei;s tetmimpnudopenmivtlt aDururp;u1optoiociatls2el( pnu0areomr3iytfp rlueo () rto(opiydoptelivt (  Draxront4olxnmi3ilt m rln on(4tlenxr totfpt lu ilt)s2ur(o3oy4ap elies t)sDrax  ou0tpx ii3iysfs2em(vpn()trtnxf ia1opt li ilt  exrxrpiodoptnmics (f rrmumo;o1texnio3iatfs2rlu s u0tleoxfctytlaDeanei s  rur(o iydlptemnetas srurumpno4altn fetat m2uaums () rtomo3iatom  au ol(0trxr(mpnydalt mncilt)sDrmu p;o0tlx  o3iltfm ea( p;u)artoxf iotoat aivi;t0sruoxr iy4ol e fvi 
\ No newline at end of file
@@ -0,0 +1 @@
+ies s0srtmxo oydam   nesltfaDtaurpnu1tetnmieils m2ra( snt4 exoxf3oadlp rlu o s) rxmio nudopenlnvias) 2umx o;t4apxnmi3ilt sDem( snt4arenmoctatfmDr n il(0tetmir iodlpt mieta()s2umx ono1alx mociltfsDeau p u0 eerir tytlpDr ieo (0tetoim3nydomtn nviatfs2ur(rpou0oex  iciltlmDelu o;u0aetnxo oy1fpDeaivi;t) rxoxrpno4op nlietl( srurxmp;u4alxnioctlsls rluvon() rtrxr totla   nei;s)t2tmxr3oy4lm n feta(f Dum(mo;o1olx  i3ilt mDrlumo;u0tltrmfctytla  li slt0s2uoxr3oudlmen nvt tf Dtrx onu4oee micild a2rlums (4aexoxr todfatrlnvilt)s2tm(o nu4lmt mfcs (  Dururpot0altn o3tytfa rm( s;(0 lenio3iatopt lneo t)srto(m ou4optnmict (farur( pou0openii3iatfm2rl(vpnt4altnxf3ty1fa elnei;t  rxr(r3ny4ale  ici sf rrmumo;t4aetn o3iatfaDua(ms;u) lenio oadlpDeli s () 2xmimpoudoltn ivtas)arumxmono1tetnif3tyd s2ea(mo u0tltoio3oy1lptrlivs;t0tetr(m ny4am  lieiat aDraur ;o4ale miciatlaDum(vp (0tlenxf3ootfp rlueo;t  2xoio3ou1lp n ivs (  2rr(r oo4optnii3iysla2emnmo;t)arxrmocoytop rlu i;s0s2trio3iudam elies tfa2rmu o;t4aleoifciydfs2rm( pnu0aexomrciydlpDe uvi;(0trumxo io1omtelncilt)s2tax oot0aee iiciadla el(mp t4artrif3to1omDe uvs;s  rtoxr iy1ome mivia() rrrurooo0optnmoeiyt sDeanvo t)tltomf3totoptr ivslt0s2toxm iudal  lfei ( s2trxrpnu0tle  ocils a2ea(vo (4tlerio oydfp   ueo;t  ruo(r nudol emncs s) 2urur nu1tlxoii3tatfs2rl(vo;u) ltnifcoatlp e i o s0t2ur(r oydam   net s  Dta(monu1alen ocilsfs2rau o (4altoif todlpD  i s;s)texoimpiu1ol emfeslt s2raump;t1tlxn o3tlt m emuvsnu0trenxfctotfm rln s;(0 etoxo no4ap  mfetas sDtm( onu4aeenif3iltfm rlu snu)alenmr tydoa e ueo ( srurim io4lp e nvt t) rtr(m ;o0ape mfciydfm2raumont0 rerio3tatlp eai s;t s2tmim nudllen netlsfsDur(ro;o1oeeomoetatfs ul( s (4 lxoif3oodlptr u i t)setmir3iy4lm n iei t)s2raumpot1tpeoifciad m umnvpn(0 exrxo iodopDr ieilt t2xo(opno4alenmivsat  2raur nu4openmfciltfmDra(msnt0 rtomo oadlp raivs;s) etmio nydap nmnei sfarur(rpno0apx  ieild a rln snu4texoif oy1oaDr u olt0 rtrxopoy1lmenmivsas) Dumur ;o0oetoiieiatlm uanms;t4tetomr3oa1fmDe uvi (  euo(rpoo1omeelnesl( arua(r ;o1tet mictydfaDel(vp;(0artrxr ta1fpt ai i;t)s2tr(mpoydaptn ici t  Duaxmpou1oexn i3tldlm ra(vsnu0aexrmr3iatlptranvi;()s2uoio3nu1om n nvt tfsDtr(mpnt4teeoifeiltfa2ea(vsn() renir3iotomDr nvo t seuoirpiydam n nvi ()s2raumpnu1opx if3tydfs2rm( s (4tlxoircoydfp r i o ( seuo(m3iy4lptn fvsa() Dumu  ;u1opt ioctltls rmn sn(0 ltnxr ootfm  aivo (0setriopoydap emnvtat a2tr(r nu0apeomocils s uln o t)aeeoio tytlm e u sls)trxoio oy4lmenmicsa( a2raurooo0aeen fciad s2rm(vo ()tlxomo3to1fmDelivsls) exmxo3no4ll  lfes ()sDtr(rpno1oexnii3tatlmDra( snu0 lerxr oadoaDr nvo;( truoir oydopt mnci s)srtmur ;t1olxnmocildfs ra( o u4 ltnmr3totom   u o ()s2urir3iydamtn neil(fsDrmxmpoo4alx if3tad a2rmnmo (4 etnio iydfptran s;s sexrxo3iy1aptelnvs t)a2umurpot0texniietydlsDeaumonu) rerio iotoa e uvolt)setr(r3iu1lp   nvsa() rtr(m nt0apxomo3iyd s2eanvp t4altrxf3tadfatrlueo t s2to(r io4lp nmfcsa(f rtrum oo1alt ioctyd aDemnvp;u)teeomf3ootoptran o (0s2xmiopou1omeemnei t s2umur ou1oee if3ilsfm elu s;u4altnif3oo1fmDr nvi t)setoxmpnu1lm emiesasf rtaxro;t1alxomicildfs elnmpnt) etrif tadlatrai s;(  rtmxr3iudam emnvsat)arra(  ot1tltn ieildla2umuvo t4aetrxo oy1lpDe u o () exo(m ny1llee nvsatfs2ta(  nu0texoifeiatfs rl(mp;(4artoirctatfmtrln s;s0seuoirpno1omenmnciasfsDtrur ot4tetomo3iyd a2raumsn()aleoirciydlaDr neo;t t2toio3nodole livtas a2raxrp;o0tet iociyd s rm( snt0aeeoircootlpD  u i;s0sexrimpiydamen ivs tf 2taxrp;u4oeeoiicildla2uluvp;t0 rtnif3ootoptelnvi t0seto(o3iudomee fcsas)sDrax onu1aee ioctat aDea(msnt0aeerxo3ia1fpDean i;t) 2tmxo3iu1amenlivslt) rta(root0aexniiciadfs emnvp t)trxnif oydlpDrlivi;t)seurir3oudll  lfet s a2rr(  nu4apxnmf3tatls2rlu sn(0 eenmr3totfpDrln ils0 rurir no1lp nmnvs s s2urur ou4aeeoif3iat aDrauvo t0 etoxfctatlmt auei t0t2umim3oo1amte ieils  Duaurpou4tet  fetysfs emnvp;(0alenxo3iotlmD lu s;t0s2uoxm nydlp  mivs () 2uaxm nu4aee  oetlt mDra( s;() rtoxr3oadfm e nvils0teuoim iodap nmfcia()s2urx oou4texoioetltls2rlnmp;(4treoir3iodoa  ai slt0t2tr(r oodope lictat srra(r no4tpx iociys a emnvp;u4 ltnio oy1fmt anvi t)trumiopnydll   nes (  2ua(m ;u0tex ii3tydfa eaumpn()altnmociytlat ai i t  rumxo3ou4lpt  fciat sDtau o;t1alt  i3tldfa2elu onu)altnxoctytopD  u s;t)t2tmxrpoo4lmen ies () Drmuro;o0tpx mi3tadfs ua(ms;t4tlerxfcoy1lmtrlieol(0 rur(rpnydlltelivs t)sDrmu o;u0tleoifeiyd s emuvsnt) ltrif3todlmtrauvo;t)sexoirpio1open icsltf rumxro;t0opx  oetldla2ran p;u4arxnxf tadlpDeaues;s0sruo(o3oydal n iet sf Dtaumo;u1apeoiociys m2emnvpnt4 rxoxrciatoat  uvil(0 rxr(r ou4optn nesl( artmurpou0oetnmi3iyt a ean p (0 reoir3iydoatr u ils0 2tr(o oy4apenmfcsl()a2ua( o;o1oltnioetatfaDulums;() rerxrcta1lpt  uesl()seuoim3iydap  miciasf rumu  oo0olenif3tydla2uanmpnt) eenif oo1lm rlneo;s t2xoxr no1optnmicslt aruau o;u1aee mictasfa2elump (4alxnxf3ootfptrlnvo;s0 rtoim ny4lptn fvtlt)aDuaur ou4tptnmf3iysls umn sn(4aetrif3oatlpD livs t  rurxopoodopee fctl( sDrr(r ou1altnif3iadfmDelnvs;t4aexnxociodlpDe nei ()s2toxrpoodlmt lfet s srtrur oo0oexn i3ias m2um( snt0 etomrcoadlmDr ies t0 2xrimpoydap e ies t)s2rrx pno0opt  iciltlm2raumsnt) rxnmf totla  luvs;s) exmxrpiodam n fct ()artmxroot1tpeoifctat m raump;t0altrirctytlmt  n olt0 rurxr3no4aptemiesl(  Dua(rpot0aexnmiciyslm umnmo;()artriociadlpD livo ()teurio3oy1amenlfcilt) 2raumont4opx  fctldlm rmnms u0aeenmf oatlpt au il(0trtm(rpoo4op  lfctls artr(ro;u1tlt iiciytfm2uan sn() ltnmocoo1omt anvi;t) rurxrpiy1ll elicilt)s2rrxrono1tlxn feiatfaDul(vo t) lxnif3ootfa  an ilt  rtrim3nodom nlivta()a2rm(r ou0opt  ociltlm2umu pnu4 lxoifctotfm elnvo t0 etoxr io1alte fvslt srurxr ot1aee iociasfm uluvsnt4 renxr3tydlpD  n i;t  rxmim iodam elnctltfarua( p;t0apxoifeildfsDul( o u4trxriocoydfaDelu o t srurxmpiu1omtelfci s)aDrrum ;u0tetnifeilsfs elump t)teermf totlaDelnes t) etr(rpou1lm  mfvi ()arumxmoou4tlxn o3tas a2ulnmpnt4 etrxf iodfmteluvi ( seum(o3ou1llen fvsls aDta(mooo4tle iieiyd aDra( s;u0tetnmfctodoat  ieo t0t2xm(r io1lp nlnetat aDuaxrp;t4oee  f3ildfm2eaump t4alermoctatlmtelu i ( srxm(m3ou1lme  ivil(faDua(mo;o1apx  ietlslsDelnmo;t0aetnxrciytlpDeluvo;()texmim3iudale mietat  Durum ;o0oltomfciaslaDel(vs;(4tetnif ia1fp eln o;(0 eumxo3iy4apeemfes s  2rmxrp;u4oeeomo3tydfa2rauvpnt)arermf ia1lp eluei;t0s2xoxr iudale  fciat sDurxm ;u1apeo fciadlm2ea(vo;(0 ltrmf oodomDeaneo;t)seum(r iudomenlfvtas)aDrmx  nu4oeeomoeiydla emnms;u0alerio3tadfa  livols  rxoio3no4apee neiat)a2urumo;u0teeoifciltfa rluvp;u) rtnxr iytoaDe ueols  eumim3no4ope mfcslt  Durxrp;u4tlt iictatls2emumpnu)aeerir3iatfaDrau il()srxrxo3iu1altnlicia(  Drm(mpoo4apeomf3tasla rl( snu4aetoir3tatlpDranvo;t0 etrimpou4lm nmietlsfaDtr(m ;u1oeto ieiyt m2rln o (4treomr tatlp   nvo;( t2tmxm3no1amt mnvt s aDrm(mooo4apxo fctld m uau p;u) rtoxfcia1fat  ueo ()sexmiopno1ll  lietltf rra(  no0texnioetytfa2emu s t) rtriocio1fpD anvi;s) etmio3ny4optnmfctas a2ururpot0opxnif3iydfm ua( o (0 exnxf3ta1fa   nvs t s2trxm3iudlmenmnvtlt s2umx  oo1oeeoiociytfa rmnmo;t)teeomf ia1omtrlivols srtrxmpnodamt mivslsfsrtmx oou1tlxnmfcilsla emu o;()aetrmfciodlateanvi;s  euoimpnodlp n iet ()artrur nt0aeeniiciadfm2ea( snt4trerir tatoptr n i t0 rtoxo3iydalenlivsl()sDrr(  nu0olt mfcild aDeaumo (4arxoio iadfa e u s t0 rumxr ou4optemnes t  rrr( onu1oexnio3iydfmDraums;t)texrxr iatlp  an o;( truo(o iydlp n ivt ( srtru  ot0tle moeiat s2rln o;(0aleoiocoy1la elu s;t t2xoim io1lpen fetlt srumu p;o0oet  oeilsfs2rmu p;(4 rtoif oadfa elieil()srxoimpny1lp elicsltf 2ra(  ;u1aeenifeiltfs2um(vp t4trenir3to1lptr u s;s) eurir3oo1lme lfctlt aDum(r ;u1apenif3iyt a2rm(mpnu4trtrir3oytoat  nvilt s2um(r3iu4omen ivt (f rrr(  ;u1oltomiciytfm2um(ms;u0alenmfctydomt li o () eur(r3iydlmeelicsls) rrrxm ;t1texn fctasfmDeanmp u0 ltrif iadfaD  i ol( seto(o iy1ope  ics (f Dta(ro;u4tleo i3iyslm2ua( p u0 rtnifciodfpDraies s  2tmxrpoy1llte nvt s)a2raurono4oleo icilt sDumumo () etoirctatlaDeai ilt)teuo(r oodomtemivs t) ruru  no4aeeomfeiyt sDeauvsnt)aexrir3tatomD ln i;t0t2tmio oodlpee ncil()arrrum ou4oetn o3iydfsDra(vo;t4treomrcio1lmt  i o ( setrirpiu4ale  ivtl( srur(r oo0aex  ictydfsDulu s ()trxomo io1lp e nei;s) rtrim nydolte ivilt aDtrxr ou0altnmiciltfm2ul(mpnt0 rtrmociy1optr u i t  etrxrpoydope mnciasfs2urx  ;o0tpxnmoeias a rm( p;u0tetrio3iatoaDeln sl()s2toim3iy4optnmfcs s)a2tmxmpoo4olt  o3ildfa ulnmpn(0tltoif3ta1la  ai sls s2xoio3nydlpt mfesasfsDra(rpou0tet  iciadfa ea(vont0aexomociotla rli o s0 2tmxopiu4lmtnlncil()artm(ro;t1tpx  feias m2ul( p;() exrxf oy1lm rlnvo;(0 exm(r ou1openmfet sf 2ra(  ou1opeo iciysls2ua(mp u0 exoxf3oytomtrln o s0texmxmpou1lpeemnet s sDtr(rpno1alt mfctlt mDul( on(4 ltnmo3io1fmDrlnvo s s2xrxo oo4al emfei tf Dua(r ot0oetniiciadfa ua(mont4arenif3oytopt  ies s)t2urxo3iydam emfcs t s2tmxr ;t4opxo i3ilt a ul( o t4alenxo3tytoatrlieol() rxm(rpnudll  mici ( sDuau  ;u1altniociad s ul(vp t4altoir oy1lmD luei t  2toir3no1ll nlnesl(f 2umxr no1olxnmieildla2rm(vo;() lermr oa1late ueslt)setoxmpny1apt  ieia() rta(m no1aleoioctldlaDemn s ()arerxfctytfa  li s t)t2xrim iudol elnvt () Duaumont1texnio3iltfa2umumo;t4aeenxo3ta1opDe u o () rur(m3ou1lp elfci s) 2rrx  ;t4oltnio3iydfs2el(monu)aetrmoctydopt ln olt0t2uoirpiodlm emnvt (fa2rax p;u1opxoifcildlm2emu snt0 rxnxo iytfat  uvol(  etmxr3ny1op elfci tf Dtaxmp;t4aptnifciys sDua( s u0 lenmrctotlpt lneil(  2xrir nodomeelivtat)aDtmu  ou4olx ioctad s ul(msn(0 lxoxf oatfm rlu sl()sexmimpiudopeemivtlsfs2rmxrpnt4teeomfetadlsDeluvsn(0 exnio tydfaDelueo;s t2umxm3iu1lmtn fcs t)sDur(m no4tpx mf3iatlm2umnvp u0areomocoytfaDeaieo;( trurim io1lmeemnvi (f rraxro;u1aet moeiysfm umu p (0tltoxf3oatlp e iei;()s2toxm nu4op  lnctas)s2um( o;u4opx ifciatfm emuvsnt)artnxr3oa1fa elnei;t) ruoxr3iodaltemnci tfarum(mp;t1texoio3iasfm2ran o u0tlenifcoytfpDranvols) 2xo(rpiu1apen fvtltfs2uau ooo0aeeomfciat mDrl(ms;u0 rtrxo ootfaD auvi;t  exr(o3oodlltelnvil() 2um( onu1tptomieiys mDumumsnu4alenmr oatlm  aieols)trto(o3oy4al  mfvtlsfsDua(mo;u4tlxnio3ilslaDrm(vsnu4trxoif3iytfmteai i (  2xrirpny4open fvil()aDtmx o;t4opx if3iaslsDea(mo;t) eenif oa1fate uvi;(0srxrirpoy4oleelnet s)s2tru  ot4apxomo3iytla elnmo u)altomr oatoatrlues;s)t2trirpny4om  micia(f 2rmxmono4olxomfeiysfm uluvsnt)altnio3oy1lptelivsls t2uoim io1alt mfvtat)s2tmxr ;o4oetoif3iytfs2eauvpnu0 lxrmrctydoatr i o;s texrim3ny1lpe miei tf Draur ;o0teen feildfa rmnvo;t0trtomr3oodomtr ueo;s0trxrio nu1amee fcsasfsrum(  ou0tpxoiictasfa2ranvs;(4 lxrifctodlat ai s t  ruoxr oudlmeemietlt) 2umum nt0oltomfctas m umn ont4tltrxo oydfm  lu o () 2umimpnudll  lnei ()a2rr(rpoo0olenmicilt sDea(monu4texomo iadoptranei s0 rxoimpoo1lm n ieiltfa2um(  nt0tpx mi3iat s2umnms u0trxoif tadfm eluei s) rxoim3oy1ap nmict (fartmxr nu4ole mfctltlsDua( s u4aexoif3ta1lp eaieslt)seurxo3oy4alte nei (fs2rax p;u4tpt  icils s2ranvs;t)texomrcty1fpt  uei ( t2xm(o nydopenlnvtl(  2urxmpnt4aetnif3iltfsDel(vonu)tlxoxf3oy1fa eauei;(0 2urimpoodaptnlfeil(farrr(  no0aeen i3tldla2ra(ms;t0 rtrmo iatlpD auvi s  2tr(r oy4ape mfetatf 2trxrp;u1tpeomfetadfsDuanvpnu)teerxo oatopt livo;s)trxr(r3iu1omeemfvsas aDrmu p;u0tltnmfctytfa2rm( p;()arxrmfciadlpt lu o;() 2xr(o ou4amt lnesl() Drm( onu1oetn oeiyt sDuaumpnu0 eerirciodomteli ils seum(o3no4apenlfcia()s2urxmo;o0oetoif3tydfm2eluvp;u4aeerxr3iatoaD  nvo t0trxrir nudlp e fet s)a2uaur ot1tlt  f3tat aDeau p;u0trtomo oytfatrli i t0 eum(m io1lpen fvsas a2tmxmpno4oetn fciysfa rluvsnu4teeoiocootfmt auvols)sexoim3no1lmtnmfesls srtmx pnu0altoiociltls rmnms ()texoxrcoadoa e ueil(0sexmiopiu4ame lncsl(  2rrx  nu1texoioetlt sDeaumo;t4aleoxrctodfmt  i ilt  exo(rpno1omtnlnct tfaDururooo0altnmfeiysla rl(vsn(0trxrmr to1fmD lues;t)setoio3no4ameemicsa(fa2rmumonu4aleoifcildlsDemu pnt0 rermr3todlat lu o;s trurxo nudomtnlfvia(  Dur( pnu0tpxoiietat sDrlnmp t4 etomo3iatop ran il( teumxo3ny4apenmicil( s2tru  oo4oeeo icias aDelu p t4teerxf ty1oaDrai s s0 2um(m3oodapenmies ( aDtmu  nu4oex mo3ils a2umnmp;(0arxnio3oa1oa  au o ()trxr(o nudam nmfesat aDur(rpou1apxomiciat m rm( on(0 exoxr3oatlmteaies;s  rxrxr ny1olenlfvil(  2rmu pnt1ole ioetyslmDrluvp;t) ltnifctydfm  ai sls trtm(o nydaptemfcil(farra(rpot4apxnmf3tad aDelnvont4tltoif3tatfpD  n sls srur(r3io4apee nvtat s2taum ot1alxnmf3tasfs2ea( p u0alenifcty1fpteaies s) rumxm3nudop nlfcsatf 2rm(m ;o0tltomfetyslaDumnmont)texoxo3oytfpD auesls) eum(o3nu4apeelncilsf Dra(  nt0apxnmoeilslm2eanmsnu)artomrcoa1laDeaieo;t0t2xo(r ny4ol elnvslt)aDtrxmpnu0oexnii3tas sDrm(mo;u)aeenxo to1lm  anvil( t2xm(rpoy4lmt  fvsas)a2umu o;o4aeeo icils a2ea(ms ()tltoxr3tatlp  anei (  2urxrpnydlme lncsa( aDurxm ;t0aetnmi3iyslm elnvs;(0texoio oo1om  livo;s sexrxmpiudolee neil()aDtmu poo1teen feiad a rlums;t)alerioctodfate u i;s  rurxm iodomtnmfvi s)a2ra( o;t0aeeomfctatlm el(msn(4tlenmfciydlate ieol()srxoio nu4ap nmicslt) Drm(mpou1tltnioeiatfsDrluvpn()tltrmf3oo1lp rlues;t)t2xmim oudomenlfvi s sDumxr ;t0altnmf3tatlm2rlnvs t0 etomrciodla r nvo t0teurim nydopt mncilt  2rr(  nt1opxnifciysla2rauvp u0alenxo iydoaD  ivilt)texr(mpnu1lmt lfvslt a2tmu pnt4optnmiciad a2uln pnu) rtnif3tydfaD lu i;(0 rurio iy1aptn fvtls)srtrxrpou0tptoif3iasfs uanmp;t0alxoifciatlmtelivs (  rxoimpnudame  neia(fsDrrurpnt1ape mieiytfs ua(mp;(4tetrxociy1laDranvol(0 exo(r no4aptnlfei tfs2um( o;u4alenmi3iasfs2umu s;()altnxr3totomDranes s srtm(rpoo1ale lfeta() Duru  ;u1oleomoetydfa2eln o t) ltnxo tadoaDeaneils) etm(m3no1ame  ictlt) 2tmumo;u1tet iiciydlaDrm(vp;(0teenxo3tatfpD  nei;s0texm(mpiu1ome  fcsa() Dua(r oo0open i3ildls2ulu pn(4arermo oytoa  anvilt) exoxr oo4opeemics (fa2trxmpou1tee mociysfaDel( s;(4areoif3iydopD liei t s2xoimpiodlp nmfvt s)sDta(monu1alt  ocils a rl(mp;(4artrmrctytoa raueil(0trxo(m3ou4lltnlnctat)sDrrxr nt1aleomf3iys mDea( p;t4aetoxociodfpD luvs s) 2um(m3iodop n fci ()srra( pnt0apt mfctyt m uln o u4tetoxrcia1latr ueo;s) euoxm3ny4aleemictat s2tr( pno1alxo oetyslm2elumpn(0arxrmr oadom  ln s ()s2xrxo io1ope lfctl(  Dumx oot1oltoioetys m2ul(ms t4 exnmf oatfpDe nvsl()tetm(m3iu4lm emncilt a2rrum ;u1oetnmo3iys a uaumont4areomr oytfmDrln sls0s2uo(opoudopeemivi (f rrauro;o1tptoioeilt a2elump;u0texrmf3ia1fpt auvo;()srto(o3ou4olt licils s2raurp;o1oexo ieiasla eanmp (4arenir ootlpteau i t s2tm(o3ou1alenlnct tfartr(rooo0opeomoetasfs umnmp t0teerxoctotopt  uvil(0texo(o nydoltemiciatfaDrmxrpno0aexo f3iatfs2uau on() ltomo3oodfpD  u ilt)trxmir oo1ale  fvslsf rrax poo1teeoiociysfm2emu p;t4 rtoxfctatoaDran i;()trxoxm3oo1apt mivt ( srrmu  nu0tetomietlsfmDrl(ms ()aeermf3oo1oa rai o ()trtoim3nudopenlieta(fs2urumo;o4alx mf3tytfa2emuvp;(0aleoxf3tydopD anvols0s2xoir oo4al n fes t  Drrxrooo0teeoif3iltfa emnms ()areoir ia1fa  an o s)srum(r3iu1ll nmfetl()srrrxmo;t4teen icild s2el(vp ()tetnxo3oadfa r uvi;t0 etmirpio4lmee ieilsfsrrrxrpno4opx moetaslm el(vs t4trxnxf oodfp   i i;s trtmxo nodomtnmnetl() rraxroou1tlxomiciltlm rmnmo (4trenmr oodfmtraneol( trtmimpoodlpe lfvs (f Dtrx  no4teto fetatlm2ua( p;(4altrxr3oodomDr nes;(  2umxm iy1lp nmfcs tfs2urx p;o4alxo o3tydfa el(mon(0trxrmf tytla ranvsl()trtrxo3no4aptnmics s sDrrx oou4opeoio3tatlmDra(ms;u0tltnmf ootfmDraneolt teurxopiudllenlictas)aDra(m nu4alenmf3ils mDuanmo;u4 eenirctatfpD livo s) 2tm(r oy4alenmfvta( srur(r ;t0aetomiciatlm2rmnvsn(0trxomrcta1fptr ueil()trtmiopnu1apt lnet () rraxrpnu1tlxo ieild aDeauvs t4tlxrxrciadla  au i;t  exoiopnydll nmfcil(fsrta(r ;o0opxomo3tlt mDranvs () eeoio todlmDelivo;t  eurim io4ale  ieta(faDrmu p;t4ole ifctldfsDrmuvsn(4aleomf3iadomt lues ( t2to(r3oo4llt mieiat a2uru o;u4aptoif3ilsla2rmumsnu4 exrmocta1fp rlieslt srtrxrpnydalte icta()aDraump;u4tpe mf3iydlaDrauvs t0altrmo3tadfmte ivi (0trxr(m ny4lle liet t) Drr(m ;u4tlxoifctasls ranmsnu4trermr oadom r ivilt) rtr(m3nudll emfvtlsfarra( p;o4tlto i3tydfaDea( o;u)aetnmociydfmD lneol( s2urxo3oy4ap emfetatfs2ur( pnu0aetoifeiatfm2eauvs t0alxrirciotfa  lnvs;(0trxm(m io1altemneilsf 2tr( o;t4texnioetasfaDulumsn(4 etoir3iadomt ln ol( trum(r oo1lm nmnvils)a2ur(rpnu0tltnii3tasfmDrm(mo;t0alenmr3ia1lmtr ieils) rurir3oodom elfei t)aDta(rpoo0tlx mictldfaDea( p t4 leomf3ty1latr nvo;t)texoio3nudlpt lfvtlt) 2trxr nu4tee  octysfmDra( o t4areoio ootfaDe nvi;s0 etm(rpnodal nmfcta()aDur( pnt1tee moeiasfa ua(vs (0 lermr oytfmte neil( setmio3no1am   fctlsf rtrxrono0altnmo3iatls2ul( sn(0 etnir3tatfat auvols)srxo(mpiudlm nmicsls) 2uau pno1ope  iciaslm rmuvs;t) eerircoa1lp  liei ( texmir3oodlle micia(f rrrurooo1oet if3iasfm emnvs t) eerxo oy1om eanvo;t)srtrir oy1op nlfcias)sDtmuro;u1tpxn oeildfm2emumont) ltoxo3iytom elueils)srtr(opnudalte ictl()s2ta(mo;o1opx mociydfs eauvp;t0alxoifcia1om rlu o;t) etrio3io4ol e nviltf rrau  ot4olxomoeiys a2el(mont)tlxnxfcoatopt lneo s  rumxmpoydlm e nvtlsfsDumxroot4tex mociat aDua( snt0teenxr tatfp e u i;s  2xmio3iy1lptnmivia()a2trxr nu4tlxo feildfs2ean on(0 exomo iodlpt ai i t trtrxr3iodlptnlicilt  2um(m oo1oltniieiad a2ul( pnt)tlxoirctatfmDe neo;(0sruoxm3oo4ap n neils  Dtaurpno4tee  octyslaDrlnvsnu)arenio oatop e ivi;t0 2uoio3oy1ap  lnvt (fa2tmx  ;t0oeenmf3tadlm umnvon()alxrxocoydfmDrlivs;s  rtrimpiy4omtnmies t) rumxmpou4aeen oeiltls el(mp;u4alxoxr3tydop ranes ( srtrxo iu1ol   iei sfsrurxrpnt4tpe  iciadls emumsn(0teeomrctytopDrlieil() 2trio nu1op  lnciasfa2raxrpnu0apx ii3iytlm2ean p;()teenxf3ta1lp ran i ( s2uo(r iy4apt lncia(  Dtru  oo1ope  oeiytfm rm(mo (0tltrir3tadlat luvs;s)setoxmpoo1altnliet () Dum(  ot0altoiieiasfs2em(ms u) ltomrcoa1oaDeanvo;t)srumir ny4lpe lies tfsDtm(  ou4aexnmi3iyt a eln ont0 etoio3iydlate ies s  rumxm io1omenlfei s)arraxrp;t0alt iietasla2ulu p;t) eermr oa1fp r nes;(0 2tmirpoudal e ivt (fs2taxm ;o0apx ii3iyslm ulumo u)trxnif3todfa  an il( texo(m3iu1lpeemiet t)aDrrurp;o0tetniiciatfmDum(vonu0artoir ty1oa rai s;t)tetrirpno4lpee fcsa()srum(m oo0oeeo ociysls emnvp;(0tlxnxf3ta1fp  lnvilt trxm(m3no1lpenmfctat)a2rmur ou4tpx  feiysfsDranvont)alxrmfcty1omDe ueol(  etoxr oydlptelnes s  2rmxr ;o4tlt mo3iadlsDrauvont)arxnxrcia1lat auvs;()seurxr3oo1open fvtltfaDtr(mont1tetomo3iytfaDum(vs t)artrmrcto1lmDr u o t t2xmirpiu4amt mnvi tfartaxronu4olt io3iyd m2umuvo (0texomr iydfmDe i s s  rtmiopoo4am n fciatfsrrrxrp;u0teeomieild aDran o;u4tltoxo ta1fmD  u o t tetmio oudoltelnvt t a2umx p;o4oexoif3tatfsDumnms;t4 lenmr3iatomD lneols0truoim3nydlpt lictl() 2rm( pou1teeoiociaslsDrmumonu0alenxr iotlpt  nvilt0s2umxo3nu1lmtemfes (faDumxmo;t1ape ifeiytlaDuau pn() rtoirctydomteaiei t0 ruo(m nu1lm  mivs ( aruaum oo4olto feiat a umu sn(4alxnmf ootlat  ivs t0 2uoxm3ny4ll elncs t sDua( p;u0apxoifetys sDua( snt0 lxnxrcoa1oatelueols0s2ur(opoo4opt mnvtl( sDuaxrpoo0aptn feiltlm2uanvs;()tetrif3oa1fa rlivs;(0trtr(m3nodapenmfvtlsf Dra(ront1tet mocias s2ea(mp u)arxomf iy1fmteaieil() eurxr3no1lm n nes s srtr(rooo1olt ifetaslaDumn s (4texomf oa1lmt luesls  2xmxrpoodlpe  nvs (farumumo;u0aleo icilsla2ul(mpnt)teerifcoo1latelneo (0 2tm(r oy4omenmfctasfsDraxmpno4oeto oeiytlm eanvonu4aeenircoo1lmt lnvsl() etrxr oo1llt mncsls) rtrx  ;u4tex ioeiltla umuvpnt4 ltrxf tytlpt lneil( sexmio3oodam   ivs s) 2ra(mpno4tleoii3ilt a eanmp t)trenmrciydlp   n o s0 rtr(o3iy4lptn nvt tfaDtmum ;o0opxo feiasfm2eluvo;u4tlerircoodfp  luvs;t0 eto(m3io1al e nvs s) 2rmxro;t0tlto feiadfs rln onu0teenxo oa1oaDr n s s  ruoir oodlme mfet sfaDurx oot4alt mictlsfs2uauvsn(0aleomf to1lmteaneilt  rurim iy4lmt  nesl(fa2raxrooo0ale  ocilt sDumnmsn(4artrmf tytoateaivo;s0seuoiopnodlmt lfctas srrr( o;o0tptoif3tas aDrmuvsnt)alxrio3tatoaDe iesl()s2ur(m ou1omte icsl() rurx pnu1aexomiciyd a2eanvo t0 exoio3oy1la  ln o;t0trtr(mpiy1ol  mfeias) Dtmu o;u4apenmfetlsls2elnmont)arenxocoy1fmt livils0 exm(r iudame mfeil( srrmxmpnu0teen i3iad s rmnvont4 etoif3totfptr neils s2umiopiu4apenlicilt)s2taxmo;t4tpeomiciaslm2ul( p u)arxnxr3iotoaD lneo t0 2umxm oydlp nlfviasf Drmxro;t0oltn i3iysfmDuan o () reoxrciydlpDeaiesls) rxoxo3no4lme mnvias srrmumpnt4tpto i3iytfa2ean o u0tltomr io1om ranei;t0tetrxrpiy1ol n neiatf rtmx  ;t1tpt ifeilsls2ulnvpnt) leomocoa1fp  aueo (0 ruoxm iu4apeemfeilt srrmu  nu1ale iieiatfa2rlump;()teeomf3iy1omDrln s t  rxoxopoydomenmivi () Dtaxm nt1tpt  ietyd mDrmu on(4tetnmo3tytlmDr ues (0srto(r nodomte fcilsf Dua(mpoo4opxoioeiasfsDeln o t0 rxnmf oa1omDr u o s0tetrxopny1openlieia(  rumu pno4tleomoeiytlmDumnvs;u0tlxoif ty1faDr ivsls0t2uoimpno4lme mivia()a2rrurpnu4oetomi3iasfa2eaumo (0tlxoxf3iydoaDeanvo () 2toir iu1lltnmfvsl(fsDtm(  ot4ope  i3tydfmDra(mo;(4trtrxrctodlp raneils) rxo(mpnudll nlncil(f 2trxm ;u1tpx  i3tadlm2rm(vo ()altnxfctatfmDran sl()s2xm(m3iodap   nctat)s2ua(r nu4tetnmo3tltls uln p;t) lxomfctatoaDelnvslt)sruoiopnu1lmtemnctlt s2ur(monu0aetomf3tlt a eluvp;t)arenirciatlpD  i s s0teuo(o oudol emfetl()sDua(monu0ope moetaslaDemuvp t)treoxo3oatop  li sls) eurxo3iodop  livsasf 2rrur ou0tltoiieildls rmnvo;(0aetrxr totfaD luvi;t trtmir3no1olt lncia() rtmumpot0oeeoiietas sDemn s u) etrirciydlmtrln i;t0 2xmxo3oudamt  ivilt artru  oo0alenio3iasfmDul(mp;u4 lxrir tytopt au s;( seuo(m oodopen ivt sfsDum(moot4oltnif3tad m uan p t4 etoxf iodla rauvi;t srxoim oydaleelnvslt aDuaumont4opeomo3tlt mDean p (4 lenio tydlp   ueo (0teumxmpiudap   fet ()sDua(r ou1aetnmo3tat sDemnvs (0alxrmo3tatfmDraivi (0sexm(m3oodll nlfci s)aDtmurpnt4apxo o3ilsfm2uanvp;u)texnmfctodomDrauvo;t0s2urxm oo1lp elictls)sDum( onu0tpenii3iyslaDua(msnt) renmf3iotlaDrli s ()trumim iydap  miei s)srtaurpou0oex  ocias a2uluvp;u4aeeoif iotomt auvs t teumiopiy4lptnmnvt sfsDtrxrp;o4alx ioctasfm uaump t0 rtnircoa1oaDr n ilt  rxoimpiy1lltemivils)a2trxmoou0apto ictytlm rl(vs (0tltoxf iatomDrlues s)trtmxrpiu1lpt mnet s srtmx poo1teen o3tadla2rlnvo;()tetoio3oadfmt auvol( seurxm iydlp   ncsls s2urxrpot0aetoiietldlaDrlnvo;u)alxrmo3tatfat anvil()trtoxo3iy1lptn fvtltfsDrmumont1tpxoioeiyd m rauvp ()trxoirciydom e uvi s)trtm(rpiu1ol  lict s)srrm(r no1tpenmf3tlsfm eau o;(0trxoifciodlaD  i i ( trtmxm oy1ame lfesa( a2tmu o;o1oeeo octysls rau p t4teermfctodla elivi () rto(rpiu4ale  ncils)aDrm(rpnu4tltnifctyslaDra(mo;u0arenxo tatfatr ivils0srtoir oudam emieilsfarum( onu0oexnmf3tadfs2um(vonu)tlenxfcoatopDrai o;()trxm(o3oy4omen nesa(  Duaxmpnu1texnioeiatfsDel( p u0tlxomr tadfm eluvi;t  2um(m io1ll nmncs s)sruru  nt4tpenmo3tatlmDranmp;(0 eeoiocto1laDelu sl()teuoiopnydlm emfvi t arrru  ;t4teeoiictydla2ua( o t4aeeomfcoatfpD  n i;(  ruo(m3oudal  miviat)a2rr( pot0tlt  icildfs2uln o;u) ltomr3ootfaDran o (0t2uoxr oy4am emfesa() Dum(rp;o4aee micilsfaDeluvon(4trenxr3ty1oa   uesl( teurxrpoo1lm n fciasfarrau  ;o1texn fctysls2emumont4alxrxf ia1lpD  uvi (0trumim io4amtn netl( a2umxmo;u1aexo oetytfsDuaums;u4artomrcoadopDe ivslt0trtoimpnydlpen icia( s2ra(mpou0aeeo oetatfs2ua( on(4tlenioctodfm e nvo s t2tr(o oy1lltemfvias)arurxmpot4teenmi3iltls ulu ont4areomr totfmtr n i;s)t2umimpiodamt  fviatfaDrm(rooo0ope iictat m ua(ms t0tlermocty1oaDeliei;s0t2to(opiydaptnlivils) 2umumpnt1alxn i3tlt sDulumsnt) rtrio iadopD  i i;()setmxo oo4lp elfci t)aDumumpnt4alt if3iltfs ra(ms t4aeermocoadoat aieil(0trtmir3ou4lmtelicta(fa2um(rpnt1apenmietat a rau pnt0tetrxf3oodfat  ivi s t2uoxmpnu1op elfct ()sDtru onu4ole ii3iydfs ran s t)alxomociatlptr uvo t)texr(mpou4ol nlicia( a2ta(rpot4tpxo ieiydla elnmp;()altoifcia1fm  anvs (0seumiopoy1amtnmieta( s2um(mpnt1apeo ieiys m2elnmon()trxomfctadla   i i (  euo(o3iu1op nlnet (f rrrump;u0tlenioeiydls2rm( sn(4aexrmf3tadlm e i i s)trxm(opiydoltemnvtat)s2ra(r no4tpeo iciat a2um(mp t)tltomfctotomD aieo (0 etrimpnudllt  ncils aDrrxmo;o0oleomfciyt aDuauvp t0tlenir totfa rlu i s)trtr(rpio4ol nlivs s) 2tm(root4tpenio3tyd m um(vsnu0 rxoio3ta1omDe nei (  2xmxopiy1openlncsatf 2ua(  nu4tet  i3tas s uanmsnt4teeomrciatomtran olt0s2xmxr io1apen icsas  2trxro;t4tetnifciys aDeluvpn()trtnmocto1fmDrluvo;s)s2umxr oodome lies (faDuaxronu0aex  ocilt aDrln s (0 rxrxrcootlmD an ilt0 rxo(o3oydlp e ivsa(fsDtau  ou0alenioetadlaDulums;u4 eerifctydomDrauvs s) etoimpnudaltelici s)arraum nt4ope ii3iydfm2elnmpnt4artrxfcoadopD liei;s0seumxopiu4ope mivsas a2rmum ot4apeomiciytlm rln o;u)tlxrxo ta1la ranvilt) 2ur(rpiu1aptnlici ()aruaumoou1oexnmieiysfm rlu s;u4altoxo3oy1fpDrluvo;(0 rtoir ny4ape lfcta(farrr(roou0tlxnio3ildfm rl(mp (0aetrmrciydlat auei s  etrim3oudaleemnesatf 2umum nu1opxomf3tls sDea(vs;t) etnmr totfaD aies () rxr(m ny1opt  fet sfarrr(mo;o4tee mietaslaDrau pnu4arxnmo3oydlm  lies t)t2uriopoo1om nlfvi s sDuru  ;o0ale  ieilsla umuvont0 lenifcty1lm rlies s0teuoim no1lpte ivil( artaumpno1apxnmi3ildlm2ea(ms;()arxoxocto1op rlivol()t2xr(r oodalt mfetat  rrm(mpot0aeeo iciyt m2ranmsnt)altrmo tadla   n o (0 2xrimpou4olte fesl(  ruax pou4tet  iciatfs rm(vsn(0trenifcoa1la  au o t0texoxopoudaptn ncsatf Dtrx  ou4opxoifciat m2uau o;u4trerio tadlatr nvil()s2toimpiy4ale mnct sfaDuauro;u4tpeomoeiltfaDumnmp;u0 rermf3iytfaDr n i;( t2ur(m3ny1apte ncta( s2umuront1oet mfciasfs2um(vsnu) lxnmr io1lpteauvolt0tetmxr3iu1lmt mfeils  Drax poo0tpxomfeiytfaDrl(mo t)aetnmr3oy1fmtrluvs;t seuoxo3iu4olee ivia()sDumur ;o4aeto iciys aDraumsn(4arxoxr tytfm elu o s t2urio io4ap e fcs s a2tm(  ot1tpe  fctlt s umuvs (0texrmf iy1op  lnvi t0 exmxm3oydamen ictls  Duru pnu1oexomo3tatfaDeaums u4 rxoirctydoatelieil(0s2umiopoudolenmieslsf rtrurp;o0tex ioeiyd s2uln p;t4 rxrxr ia1lat  i i;s0 2tr(mpiu1lp nlfvi s)srrm(mp;o0opeoif3iadls emuvp u4 rxomrciadfa eli sls)s2uriopno1ap emncilt)sDrr(rpnu0alenmieilt s uluvs;u0alxoxfctotoptelu slt0setr(r iy1al emieils arrrur ;o0aet  i3ilslaDrl( p;(0trtnir tatomtelivo () etr(m no4ap  miciat  2rm( poo4aetn icilsfmDean s t0 rerxociotomDeanvs () rxoxm3iy4lp nlietas arrm(mpnu4apenioeild m eluvsnu4aetnir3tatlptrlu s;s) 2trimpnodol nlnet t a2urxrpnu4oetnii3iaslaDrluvo u4aeerxo3io1la rau i;s0 2ur(o oydlp n iviatf rtm(r nt0alx mi3ilslmDuan p t)tlxnxr tatlaDe ues ( t2xrimpnydalt livi s  2ta( pnu0alxomo3tydlm rlnvo (4alerxfcta1fa eau il()texoxo iu1op  mfvs sfs2rr(mp;t0opxnio3ilsfs emuvont0texnmo oo1fa ranvilt  euo(mpoo1lpee icslt srtaxmo;t4tee  o3tyslm2ranms t4arxrif3oodlpt  uesls t2xoxopiodlp n ieta(faDtmxmpno0optomf3tldlm ran s;t0trtrioctotfa  au i;s s2xoirpou1ole  fvsas srrrurpou0tee ifcilsfsDelnmon(4 reoxfciydopD  nei;s) 2xo(o3iudape mivt (f 2trxr ;u0alxnmociadfm rmu s u0arxnmrcoytla eln i s0t2umxo3oy4aptelnvsa()s2rrur ou4teto feiysls rmu s;u0arxoxoctytfmtran o t  rur(o nu1ol e neia()sDumu  ;t0tetomo3iat sDrmnmo ()aetoxr tydlp raieo;t)s2xo(o oy1olenlnetat)arumum ;t0olxnmi3tadlsDran o (0 eeoircoo1lpDrluvs;( t2urxm iy1lm nlictasf 2raxm nt1openif3iytfm2ea(msnt)altnxo iotlp e u o;s0srtoiopnodoltelnvta(f Dtrxrono1opt  fetaslsDumuvpnt4tleoio3oodomt li s (0seurxo3no1am emnvta(fs2tmum ;o4oeeoifciadlsDuaumonu4tlxrio3iatom  luvs s t2tm(o no4ll e ici (fs2urxmp;t4tpenmfetadla2ua(msn(4 rtoxr3totlpDr ivilt  rurir3iy4llt  fci ()s2raxr ou0alenmfetadfm2rl( pnu0aleniocoytlpDr u o;t0sruoxo3iodal  lfvta(fsDrmxm ;o4aetomoctasfs2eanvsn() exnxr3todlpD ln ils  rxmio oy1lpt lfvs (faDurx o;t0apx  feiyd a2em(mpnu0 lenio ta1la rluvils0 2xoir ou4alt mfcta(faDtmxrono4tptomo3ilsls2raums;t0altoxf3tytlaDeai i t)trum(mpiu4ale  iet s  Duax  nt1texnmi3tadfs rlums t4 rtnifctodla eai il(0sexr(r nu4lptnmictlsfa2rm( p;o1olt  icildla rlu s;t0areoir oydoa   i s;s)sruo(opno4lp nlfetat  2urxmooo4apxniicilt m uaumpnu4 eeomr3iotfpDrauvils) 2xmirpno4lmtemiei t)srum(root0apxnifetlsfm uau p;t0tetrir ia1fmtrln ilt) rtmimpnu4lme lnes (f 2rm( ono0oexnio3ilslsDumump t) exrxf3tydfm r n o s0teurxm3oy4lm emnvtat aDua(r oo1aetoifeiad m2em(vsnu)aeenircoadfp elivi t  rxoiopiu4ol emicsa()s2ra(ro;t4tet io3iadlmDelumsnu0areoif oydoat  uvi;s0t2xr(o iudlmt  iciasfs2tm(ro;t1oeeomictlslmDrl(vp;t4tetnir ootlmtrau s;s0t2xrxopny4ap e fcsl()aDua(rpno4oet if3ias a2rmnvont0tlermrctytom   n s s) rtr(o3ny1optemfcta(  Drax pnt1tpe mi3tysfs el( p;t4aexrxo iytlpD aivs () 2xmxr iodllee ivsltfs2rm(rp;u0aeenif3iyd sDulnmont) eerxfcto1lp elueilt  exoir3nu4lm  mfeiltfsrrr(r nu4opx  feiyt m rlu pn(0tlxoircoodfpte nei s0setoirpnudalenmfcs (f 2tau p;t4teeoif3iadfmDeln onu0tlxnmrcoadfmtelnvslt0t2tr(mpnodap nmnes tf 2tmxr nu0opeomi3tys a2rmnmon(0arxnif3iotomtrauei;t0seuo(o nydll  mivias sDuaxm ot4olxoio3ias a2rlnmp;u) etrxr iy1fa elu i;t)srto(mpiu1al  mfvt t artr(moot0olt micilslsDulnvsn(0tetoxf oadfpte uvslt) 2xmim3nudomenmics s)s2umum nt0olt iicild m2uluvsn(4altriociytop eanei;s0teto(m iydam nmicsls arumu ono4aeenio3iadls uan p;u0altrir3oydfmtelnei t)texmxo io1op emfcsls) 2tm(mpoo0tlt ifetysfaDul(mon(0 rxnif3iatlp eanvi;t  2xoxr nu4lmt  nviltf 2uaurp;o1tpe ioctydlm ran p;(0 ltoif ia1faD  nvsls0texrirpny4omeemietat  rtmxm ot0oleoiocild s um(mon(0altoxr ty1fat anvol()texr(r nu1om emfeta(  Dur( p;o1openii3ias aDuauvo;(4arenifcoytfa e neils0tetm(o ny4omtnliesasfsDrrx o;t4tpto oeildfsDemumpnt)trxrmf3tadfmD  uei;() exrxmpoy1ol  mneil()srurumo;o1ole mfeiatfa um(vpnt4artrir ta1fat lues;s0texr(rpiodlme mnvtl( s2tr(  no0aeto i3iytls2ulnmp;(4tlerxr iotfmt anvo;s0 exr(o ou4omtnmnvtlt  2umumooo0oltoiictld sDrluvp t0aetrifcta1om  auvolt0 etoxopiudalt lnvtasfaDuax  nu0tex iictys m2rlnvon(4teermo3totlaDeluvsls)s2tm(m3iudlm n fet (f rtrx p;o0aee iictldlaDul(mo;()alxnxo oatlm rai ols) 2trxo no4ome mfvilt  Dtrxrp;t1optnmfctas sDrlump (0tltnir totfa r i s;t  2xo(opiydlm n feiat) 2taumpnt4tetn i3ils mDuaumsnu)tltoiociotlm   i i;t)srum(mpno4alt mfet s) 2tm(mooo4altnif3iys s2um( o;(0artnmo3tydfpDrluvs s) rur(r3ny1lptn iei s sruaxmo;o1tpxo oeiltfs2elnms u4arenif3tatfat ai o ()teuo(o io4alenmnes tfaDuaxr ot4aleoio3iytlm ulums (0alxoxo3oydoaDrlu i;t0 rtmxo3ny4omtelfciltfa2raxrooo1teeo fetyd a2ulnmsnu0teenmo tatlpt  uvsl(0trurim nu4al   ivi (fsruaur ot0apenmfeiatfa emnvpn()arenxr3oadfaD anes ( srxmim oudop elfetat  2tr(m ;t4aleniietltfsDrmumo;(4 leoxfcoa1lmDe nvo;s s2tr(mpoo4lmtn ivs (  Draumo;t1tltn fciytlsDelnmp;(0 ltnxoctatlp  anvilt) etr(r3nu1altn ncsa()sDrau p;t4aetomo3iydla2emnmonu0 etoioctotlmt ai s;()trxo(o iy1lptelfcs s)aDta(m ou0tlxnmf3ias mDua(ms (0 rtnmf3ta1la  lieo;(0setoim3ou1oltn ict tf 2uaxm nu1tet mfctasfaDraums t4areoxo oatomtrlneolt  rtmxr oy4ame miei sfs2trumpnt4oetnmf3tyd m2uan p;u4aexriocoy1om  li o t)srtmir iy1ll elnvslsfarrm( oot1tex  o3ildlm2uauvo t)arerir3oa1omtr ivo;( trxm(rpnudomtemfctls) 2rrump;t1teeoif3ias m rluvo;t)arxoxo3oy1lpDrauvs ( s2tm(r nu4ap   nvia()arrm(ro;o1opt  i3tytls um(vsnu4artnmfcoytfa r i s;s0setmimpio4ol nlfeias)a2truro;t1tle ifeils m raumon(0 lxrmr oy1omD  uei t)s2tr(rpoy4apt lnei tfarumu pnu0tptoifeiasla ua(ms;t0alxnxrcto1fa raueo;() etr(m3iydlpe  fvtl( srua(mpno4tpxoioctldlsDuan onu0 lxrmr iydlaDr iesl(0trtr(r3iu1ame mieslt srumu poo1teenii3tlt mDrmnmp u4 reoxrcoodfpDelues ()texoxo3oodomenliei ( s2rrurp;u0tee mfctad m rlumon()aexrxfciodomD anvils0srto(o oo1op emietlt srrax o;t4aeeoio3ild s ua(vs;()artrxr3oadlp   i sl(  rtmxo io1olte ies ( arrrurpnu4alenifcils a rlu o;u0tleomo3ia1oa ean s s) rxmimpnudlpe  fcil(fsDtmuroou0oee ifeild mDem(vpn()areoir3iydfmDrlivi;( trxmio3nodlmtn fei t)a2ua(ronu1tpt io3iatfs uauvp u4 ltoio iodlaDelneo s0 rxm(m no1lmtelnct s)a2uru pno0opeoiietltfm uluvs;(4trxnif3ta1fateau o () rtrxmpiodlp nmnct (fsDtmumpot0texniieiasls2rmu snu0 exoif3iadlmteai olt) etm(opiu4ol emiei t) rra(rpno0apeniieias sDumumsnu0tlerircty1lp   n s t)teurxopiu1llt  ieiat s2ur(r no4tpx ioetld a2uluvonu0 etomf3oodoaDeanvolt tetrxr3iu1amenmfci () rtm( poo1olen ociadfs2rauvpnt0trxnxo oytfaDe ivo s)teum(o3iydomeelneia( srtmx  ;o4olxomoeilsfa rlumo (0trxnxo iy1fmDe ieo;t0t2um(o io1altnlnciat)arurxr ;o4apeomoetldfmDeaumpnt0trtrxr iodfmte i i t) 2xm(mpou1olenmnvtat  Durum nu1apx  feiysla ra( p () ltrio3to1op  aivols)srxo(m iy4om  lneiat arum( pnu0oet mi3tytls2emuvs;t) reniociotlp r neo (0 euoxo no4olenmnvia(fs2rm(mono0apeo ictys mDea(vs;(0artrxfctadoatr i s s0 rtrxrpno1lme lfeilt  Dtrxm ;t4tptoio3tytfmDumump u0 etnmf to1fa eaivs;s)srtriopio1opeemncsltfaDtrumpnt1opxnmo3iydla ea(vs t0aexnxrcoatfmDe nes;t trxoir io4llte nctlt)aDuaumo;u4opxoiieiys a rl( pnt0altnif3oa1faDeauei;t  2toxm3ou1openlfcilt) 2ta(r nu1oet miciysla rmu s;(4 renxf3oy1latranvi (0 euo(mpno4lltnmnet s s2ur( onu4tetoif3iytla uauvp u4 exrxr oa1om  aies t0trxmir3iu1lmtn neilt srtrxmp;o1aexnifciadfs umnmo u)trxnmocoa1fm raivs t t2trio oudol  miesat) 2ta(roou1aee iieiadls umuvo t)arxoifctydlaD ai o t) rto(rpio1op emicslt aDrmump;o4oeenmoeiadfm rlu p t4tetrxoctytfmD lu o;t teurxm iydoltnmfctl()a2ur(m nt1oleo ociltlm2ua( o;u0teeoio3oy1lmtelies s0teurio iydoptemfvi s s2tmx pou4apenio3tas m ra(vsn(4areoxf oadomteaieslt)setmio io4ole  neiat  rtrurp;t0olx iiciltfsDrmnvsnu) rxrmo iy1faDe iei;s trurxm oydalen ncil(  rta(  nu4aleniieiyt m2uau s;u0 rtoxo3oodlp rlieil(0seur(r3iu4apeelnvtl( a2tmuroot4texnif3iyslmDulumsn(4artnif to1omtrlnvi;(  exrxo iu4lleemfci s a2tmx pnu4texnmoetlsla2umnvsn(0artrif iadlmDr u o;() etr(opiy4am nmivt ()srum(m no4apeomfciyd a ulump;t)alerxr ty1lmDr u o;()sexmxr3oydapt lfesa()srrruronu1oltnmfeiatfa2eaumsn(4altnif oytlat  i sl( s2trxopny1lmt mnetlsf 2tau p;t1apxomocias mDeln s;u0 rxoxo todfptr nvil()sruoir3oo4oltnlfesatfsDrrum ;t0tlx ifeildls em(msnt4 rxrir oy1oaDe ivo () euo(m nu1altnlietat  Dtaxr ;u0apeomieiasfa2uan o;(4 exomr3oytlaD au s;()s2xm(m nodlltnlfcsasfs2ta( ont4tlxniictlsfm2eln p;t4aeeomf3todlaDrln ols)srtrxopnodom elnctlt s2taur ot0aex  oeiydla2ranmp t)tleoir oy1lat auvi;s) exoxmpny4lpen fvia(fa2rr(rp;u0tlx  oeiltlm2el( s;(0aeenifcta1lmt lneo;( srtmxr3oydope  fviasf Dtmumpou4tle  ietytfaDrlnvpn(0 rerir ty1fa e ueo;( s2um(rpio1lmeelfvia()aruau p;t0opeoio3ilt sDelnvsn(4alenmf ia1faDr iei;()teumxmpno4oltemicils)srtm(m nt1opt  ietysfmDrm(mon(4artnxrciodopteanvi;t) 2ur(rpny4lltelfct ()aDumx p;o0optn iciydfa2uan snt0tleoio ty1fate nvo s teuoirpnydome lfvt s) rtru poo4oet if3tldfsDemumpnt4 etrmf iy1lat  ivo t0 exmimpiudlmtemivils)a2tmxrooo1aptniicilt a ranmp;t) eerxf3totfmt  u i;t)sexmxm3oudomt  ieia( srtmumoot0tpxnmoetytfs ua(mp;(4tlxrifcootlmDe neil( t2ur(rpoo1lpe lnviat s2rmxr nt4oeenmfetyt mDumuvp u) lxoifcoydlaDran i t) 2to(o3oy4altemnvs (fsrrm( pno0tex  i3iytlaDeau o t4 renxfctodfmDeaieol( s2urir ou1lm emfvi (fsDtrxr ;u4apt mfetytls uanmon(0alxnmr iodlpD lnvi;(  rxmim no4oleelict t)aDum(ro;t4texn f3ilt a2ran p;t0areoircoo1om   nvs t  2xr(opiodomen fvs t arrau  ot0altn f3iaslsDua( snu4tltnxr tytlp rlnvil() rxo(rpiydap emies tfsrtrumoot0olxniicild m eau pn(4 ltrif3ty1fm   u s s0seumxo ou1ole lfcils a2ta( ooo0oeenii3iytfa2uau ont)tleoiocia1fpteauvi t texrxm iudlmtnlieil( aDrrxrpoo4alto oeiytlm elnvp t0tlxnmo to1oa  lnes;t0t2umir3iy4lptemnviatfa2rm( ono0oltomf3ilslsDulu p;(0tlenmf oytlat luei (0sruoxo nodomt mnesl(f rrmxmpot4tlx if3iadfa eln s;u4alenioctotlmD  ieo;t)t2to(o3iydolt  fcsatfsrtrx poo0olenmo3tlsfm2ea( o;u4tltrio iy1fpDe uvils texmim iodoltelnvslt  2trumo;u1tpxoiieiltla ulnvs;t0trtnmf3oytlaDe n ol()srtoxr oydopenmnciatfs2urxm ou4tet ifctatlaDelumsn(0 etrxr tadfa r ivslt s2umirpoo1ol elnciltfsrtr(mooo1olxnifctldfa uaumpnt4trxomo tadfmDelneo s0teto(m3oy4ope lfei s) Dtaur ;t4oexoiiciatlm2em(vp;u4alxnmrcoydfmDrau o;( sexrxo no1llee icsa( srrr(mpou0tlen iciydlmDemuvp;(0tetrmfctodopte ueils)tetoxm3oo4op   fvsas  rtauront1oexoifciatfaDrm( o t4arenxr ia1opDe ieilt  rtoxrpio1ol  mieil(fartru o;o0optoifcias s rlnvsnt)altnio3io1lp   ieols  exrio io4apt lies ()artaxmoot0texnii3iydls el(mon(4 lxrmr3oatfmteln s;t)trxrirpiu4lmte fvsa(f Dtru o;u4tetn i3tlslmDumn p;t4 eenirctydfa  anvs;(0sexmir3ny1ll nmivi sfsrrmxm ;u1alx  f3tldfmDra(mp u0 reoif3totfaDrai ol( s2ur(m3no1om nmiet tfaDrmumono4tptoifetytfm umnvpn(0tetnmr3oodfp  anvsl()s2umio ou1am e nvs s)a2taumooo0apeoio3iadlaDeau s;u)tetnmr3iadlpD anes t0 2tmxo no4ol elnct ( a2trur ou4tptnmoeiltlaDrmuvpnt0 rtomo3ty1op rau o (0 eum(rpnu1olenlneils) rrm(mo;o0tlen fciytfm2rm( s ()arxrxfcoytlm rlies (0seurxm3no1lp  micil(fa2tm(  ;u4apeomoctysfs rmnvsnt0aleoir3tatfpt  neo ()teurio no1op  lfvtl(faruax pno1oeeo octadls emnmp (4 ltnio iytfatran ilt0tetmirpiu4am  lfvsl(  2tmxrp;o4apxomo3tysls2eaumo (0texrxfcoytfp elieils0trtrxmpiudlpenmfvtlt aDta(monu0tlen ociys mDemnmont4trtoxf3ia1op   ivo;s) 2xrxmpnu1om nmieia( aDtaumpno4tle  ieilsfm rau s;(0 exnmo to1laDe n slt)tetoir3iy4olenlicia(farua(rpot4apt mi3iydla emn snt) etnir3oatop rlues (0 2toxo iy1lmtnlneil(farrrum nt0apeomieiydls2rau p;(4tleomf3iytlptrlneo;t)t2umxrpiydlp emfvtls) rraxro;o0altn f3tadfa rlnvs ()trtrxf tatfaDrlnvi;t)t2tm(mpny1ll elfetasf Drrurpot0tle  iciatfm2umnmo u)arxoif3iytlptrau il( srum(opno4lpenlivia()aruaump;t4opx  oetldfs rln pn(4alxrio3ootoa raivils) 2uoimpoodome  nesatf Drrxmont0apxnifetysfm elnvp;t)teeoio to1omD lnes () 2xo(mpoo1ll  lnci (  Drrxmpnt1olt ifcias a2rau sn(0 renmf to1lp  an i s)texoiopnodopt lfvt s  rumxrpot1tlenio3ilt s uan p;()tetnif iytfmte u i;s0sexrim3oydom emfci s)sDrm(ro;o0oeeoiictadla ua(vs u0trerxf ta1laDrliei;s0s2trio3oo1ap  lfetlt)aDtaumoot0oet  ictldfm ean ont0trermoctadfmt  uei ()s2xrxo3ny1lpeelnct tfsrrmu  no1opx miciysfs um(vo;u4texrmfctytop eln o;t) eto(mpiu4ale licsa() 2rm(  nu0aexnioeiyd a ul(monu4 etoxociy1lmD lnvils0t2toxrpoy1lmeemnct s)sDtr( o;o0tlxn fciytla2uaumo;u0 exrifcoo1lmDran slt0teumio ou1olee ies t s2rrxmpot0tleo octys m rm(ms (4tltnir3iotlpte ivo (0trtmxo3nu1am elfcsa(fsDrm(roou4altnmf3iadfm rlump u0trxoxr iydomt ai i;t0s2xmirpiudlleelnetas) 2tauroou0tltnioeiasls2rl(msnu)alxrmoctodlp rai s s  2tm(r nydalenlicils)sDumur nt4olxo oeias s uan onu0alermf3oy1lat lneol()trtmxr3oy4omeelivtl(  Drmxrpou1apxn i3ild aDua(vsn()arenxo3tydomtran slt  etr(opiy1ape lfcias)artm(  nt4apx ioeiydfmDrm(vo;t4tetrif3ia1lm r ieslt)s2tr(m oy4optnlnvi t)aDumumoot4aetomo3iadfmDrl(monu)arermrctytlp rlies;(  2tmxo oodol emfeils) Dtrur nu0oeeoiieiyd m uluvsnu4altrif oytopt  nvo t0tetmxr nu4aleemncslt a2urxrooo1tpx  o3tydls2rluvpnu4 exomr3tatlpt livo (0t2xmiopno1lp e fesls  2rmxr ;u0tptnmf3ildfs2umuvp ()teenmf iodopt aueo;s)t2trir3iy4ap  lfes ( s2rr(m ;u4opxn iciad a2raumo;(4 rxoir3oytlmDeln ols t2xr(rpiy1ape mfct s arrmurono0tetoiociytls2ul( p () ltrxfcta1fp ranvo;t) ruo(m3nydamt lfcta(  Duauro;t4olx  ociatls ea(vont4tleomrciatla ean ol( t2xmxrpiydll n feiltfa2tau  ;u0aleoioeiad m2umn s t4 rerir tadoaDrlivsl(0tetrim no4omt  ncils)srraum no4texn i3iaslm2rlumo;t)aeenxrciy1fpte ueilt)t2uoir3iu1alenlfcsat)a2urur ;t1tptomf3tatls umn p;t0 etnxrciydoa elivol(  eto(m oo4op nlivs sf 2rrurpnt4opeomf3tyt aDranmpn(0tetomfctotfpt auvo s) rtmirpoudop n net ( a2urxrpot0aeto ietltls2rlnmo t0aexomr oadop   ieslt0teum(r oy4optelfeta(  Dur(mpoo0opxo ieiad m elu p u0altnmo3iatfpDeai s;t)setrxo3ny4lme  ivsa(  2rrump;o1texomiciydlm rluvp;()aexnxrciotlpDrauvi (  2xm(r nudom nmncilt  rtru p;o4olenmf3tlslmDelumo;u)tlerir3tytoa  lieol(0t2urim3no1am elnctl(fsDtmx ono1tpxnifeiyd m2ean sn(0aleoxf3to1lp raivs;t tetmxo3oo1lpenmfctls)aDurxr nu4oexoifeiasfm eanmont) etoxf3tadfa  au i s t2tm(opou4omt  icsat artr(  nu0olenmoctltfa2eanvo u0alermo3ta1la e nes;(0 2urxo iu1lp  lfct ( sDumur oo0teen o3iatlm2ul(mp u)alxrxo oatlp elivilt0t2toxo iy1ol emfctasfa2tax onu1opxnmoeiydls ra(mo;u0trtoio iatopDe uei s srur(m3no1lp e fcsl() rurur ;t4tpx mf3iysfs rlnmo;t4tetrxr3iy1faDeanvslt0s2um(o nodll  liei s a2tm(mono4tpenmfetydlsDulnvsnu) ltnxfcia1lpDe nei ()texr(o nydopenmfcsl(  rtrxmpnt1opxn ociltlaDuauvon(4 rxrif ty1fp elueslt)s2trxr oodam  mfvils)aDraur ot0altn fciys s2ra( p t)trxomocoatla  aieilt)s2umxopnodlmeemieilt  2um( ont0teeo oetaslm2ua(vpnt)trxrmociatfp rln s;s0trxo(o iy4lp elietlsfsrtmxmoou1altnmiciys s rm(ms t0 leoxr tadoaD lues (0trxmxr oy4opt  icil( sDumxmo;t0opxo oeiydlmDumnvp u)aleoxrciatopDelivsl( t2xrxr no4lmeemneslt)sDtau  ot1openiictldlm rlnvsn(0trtnif3to1latr ies t0 2uo(o oydom  mfeilt)sDrau oot4ape mf3iaslm ra(vp;t4 exrmf iotomt  nvsl( seuoxm3nodlptn fvilsfarumxront4oex ifeildlm2um(ms;t4texnif3to1fp rauei;t s2xmxr3iu4altnmivslsfarumu ont1tpxnifctas m2uluvs;(0 lxomo todlpt lnes;(0sruo(o iodll  mivsatf 2uax pno1opxnmoctls m emnvs (4 reomf oo1oa eauvs;( t2xmim nu4opt mict t)sDrmurp;u0alenmfciyd a2elu pnu4trxrmr io1fmD lues t0setr(r iu4opte ictltfaDtrum ;t0apx  o3iasfmDea( onu4altomocoodlm raivolt trtmirpiudlpe lict tf rtrxrpno4tlx  ieiyt a rluvs;t)tlxrmrctotfat an sls)s2xoxmpiudomenmnctlt)srrmu onu0apeoiocild aDrmnvonu)texomr3iodlm e nvs s)trxoio3ou1op nlneil(fsrraum ;o1olx ioeiydlaDea( onu4alerxrctotlmtraiei;t0t2trimpnodaltelfcils)aDua(  ot1texn i3iat s2uan o;u0 rtoirctatlmD  nes s trtr(r iy1ap elncsat)a2ur(  nt0tlx if3iad s2rmuvs;t0 lxrmrciy1om  liesls0 etr(m iodoptelnvsl(  rta(mpou4alt mocilsls uluvs;t)arerxfcio1oaDrluvi;t)trtm(r ny1om elnvi (  Dtaurp;o0oetn f3iadfm2rauvont0 etrmr3ta1fatraivilt0t2toxrpio1am elfesls artru  oo0olxomf3ilt a eau p (4altoio to1lpt aivo ()srurir nudome  ivslt) rtaurooo0aptnii3iat sDelnmo;(0 etrmfcoydoat lues (  etr(mpoodapenmfvi s  rraxrpno1alt  f3ilsfm em( pnu)artomocootfa  aueol()trxoxmpiy4lmtemnei (fa2taxmp;t1tetnmieiydlsDuauvs ()aeeoxr3todomt lnvi;s)teto(rpnudamenlfetasf 2rm(m nt0tleoifeildlsDuanmo;(4trtrir3iadfpt lues;t)truo(mpnudllen nvs sf Dtrumo;u1tpe ioeilt aDulumo t4 rxomr3oy1latelneo;(  2xrir oudllt  ncs sfsrrm(r nt4oexomoeiltls2emnms t4aeermr3tytfmt au sl(0 eumxm nydamtnmivia(faDurxrpnt4alxn f3iysfmDuan p (0 ltnmo3tydom rau sls)t2xrxm3iu1ameemnvils)srur(mo;u1tptomictlsls rmnvsnt0aetrmr3oy1oatr nei;t) 2xo(m3oy1op nlfctas s2uaumpnu4oeto o3taslm ua(vo (4alenmfcia1lat liesl( truoiopiy4ll  mieiasfsDur(  ;o1opxnifetldla rauvpn(4 ltrmocio1fa  auvo ()t2urxopiu1ll n icia(fs2urxrpno1olt moeiytlm2em( snt0altnmfctodla r uvs s  2to(o3iu4lmtnlnvs () Drau p;u0aeeo feils s uaumo;(0tltomf3oydoat ln ilt s2toio3ou4llte net t s2tru  ;o1tpeomfeiasfm2uln p;()aexrmf3oydlmD ln o;(0tetmxrpnudap elfeilt s2uax o;t1aeen iciyd a uaumo t) rermocta1opD ln o;t)srtrxopoudoltelies t)s2ta(r oo4tlxomo3iatfa uanvo;u) etrxo todfaDraneo;t sexr(o3oo1oleelfciasf Dtaxr ot1tle  fciasls2ra(vo;t)alxoxf to1fp r ueils)sexrxopiydlltemnvsat) 2rrxront0apxniiciyd m2rm( snt)alxoif to1om eln o s truoxmpiu1altelnci ( artau ont4altn f3iadls2eaump u4treoxrctydoa raieslt0texoxmpoo4lp emfctat sDtr(rp;o0aeenmiciyd aDrmump;u0aetriocoadoate uvs t trxmxo3oy4am   nvtat sDtrur ou1aet  octasfm2emnvonu0altoif3iatfpDrauvi;s  exoio nydapeemnvi tfarrmumono1texo i3ilsfmDea(vp u4aetomrcoatfptrlnei;s sexoxmpoo1aptnmfetlt artmu pnu4tetnmi3tyd s ean o;()trxoxfctydlm elivo;t t2xo(mpoo4lpt lfes () rtmxront4aexnmieilt s ul(ms () exrmo3oydlaDr i i;(0 rtm(o3ny1om elnesat) Dra( pot0oltn ictldls2ra(vs () lxomfciytfmD lu slt t2uo(r ou1ap   net ( a2tmu poo4opt mieiadls2rmnvpnt4texnmo oytoa rlu ilt  rtoio3oodlpte nesltf Dtrx pnu4aet  o3tas a2um(von(0areomo3iadfmDr u o;t t2xo(o3iy1al nlivsltfarrmu pnt1altniietydlsDelump t0alxnxo iytlp e i olt  rtmxr nu1opt lnvtlt aDtm(  ;o1tpxo ietytfa2ul( p;(0 rtrmrciotlm  li i ( srtrxr io1oltemfeia()sDtmu poo1openiieiytfs2rauvsnt4areoifctytomt  u o s) 2tmxopoy4ll e nvt (fartm(r no0aptnmo3tasls eln s;(4 rtnmocoydfmtr nes ()s2urxr3iudam   nvs sfs2ua(rp;t4aet iiciatfm eluvo u4arxoxrcto1fm elueils0trxo(mpiy1apt  iet ()s2tm(mpnu1opeo i3iysfa ra(vp () eenircty1fmDe nes;()trxm(r nu4ale lnctls)aDtrxrpoo4apto oeilsls eln p;t)texnxf3iotla   u o;s) exoxm3iy4ol n ictat  2tmx  ou4texomfciltfm ea( o;() rermf3oodfpDelivi;(0trtoxo oo4am emnci (fa2taxrp;u4tpenifetat aDrlnvs;u0teeoif iotlmtean o s s2xoxm oo1omtnmictas a2trxrpot4tpeomf3ilsfa rlnvp u0trtoxr3todfa  aneo;t  rtrxm3io4omen nei ()srumur ot0tlt mfctls m2uanvs t)aeenxf3ta1op eluvo;t0trtm(rpoydlle mncta()arua( onu4apx mieiltla rlnvo;(0 ltnio ootlmD luvils0 etm(o3oo4lmtelfvsls sDrm(mpno1tlxnio3iysfmDelu o;t0arxrmf iatlmt  ieils0truoxo3iy1opeemicta()a2ur(  ou1texnmiciatfs rlu o u0alxoifctotlatrlues;(0srum(r3io4amenmfci (faDua(monu1opxn ocias a el(mp;u)trxrxf3iy1la eln s;t0t2toxmpoo4om elivi t s2rmxr ou4apeoiiciadla2ea(vp;t)aeenmociytfaDe u ol(  2tmim3ou4op nlict sf 2uaxmpno1oetnioeiyslaDean o;()aexrxo3tatfmD aies s trumxm3iudop emfvsltfsDrau  no1ape ioeiatlm em(vsnu) rtrmf3tydlate ivs s)trtoxopnodolen ncsatf Dur( pnt4opxn o3iat mDel( s u0altnmr ty1laDraivo;( s2xr(opoo1om  mnes (fartrumpou1oexn iciatla2ran snt0 lxrif3iydlpt lnvi;t) rxoir ny1lptemfctl( s2ur(m ;u0aex io3tatlsDrluvp;t0altnmf ootlp   nvs;()t2uoir nu4om emfciat)arum(  ou1aeenif3tltfa rm(vont0trxomocto1fmtr uvo;()t2uo(m3iodaltn fvtltf Dtaurp;t0olx  octat s ua(vs ()altriocia1fmDeli i t srtoxmpnodlmenmnctatfsDrr( oot4opxo o3tyslaDraumo u)areoxrcoytlmtranvsl() rum(m3oudlmeelfeil(fartmx  ;u0ole mi3ils s2umnvs u0teeoio3totlpteln o t) exmio iydom  mfcsl()s2tmxr ou1olx  iciatfaDul(vo (0aeerxocoytfptranes s0s2trirpiy4ole mnetlsfarrmu  ou4alx ioctldfs2rlu o;(4areriociydlpt  ies (0 euoim3oydap  mfes s)a2rmur no1apeniociydla2ea(ms (4artrio3to1fat  nei;()srtrxr ou1lp e fcias)a2rrxro;o4aleomo3tysfs2el( p (0 lxnmr3ia1lateauei;() 2umio iy1altelfet s sDtr(m oo4tltomieiadfs emu on() lxnxrctatopt livs t0 rxmimpiy4omeelfvsas sDrmxroot0aexo f3tytlmDuau o t0artrxoctydfp eluvi;(  eurim3iudoptnmiesas  rtr(  no4tltnioetasfmDum(msnt4tetomociydlp elu slt)trtoxm3ou1oleemies (  Draurpou4opxoifeilt sDeaump;t4tlxoxr oydlp  luvs;(  eumirpoo1alt mnesasfs2tru pou0opxn i3tadfmDranmo;(0arenmr oadlptrli i;s  rto(o3iy1ole mnvslt) 2rax pot1oltn i3iaslm rmu s u) exoxfcoo1lp eauvo ()teum(opoy1llee netl(  rra( oou1tptn i3ias s2elnvpn(4arxrio ta1latelu olt)trur(o3oy1lpt mfcilsfaDuaurp;u4tetnii3iyt a2eauvo (4 eeomo3ta1omte n s;s)t2tr(r3oudll elfeilsfaDum(mont1tlt iictls s rlu pnt0aeerxfcio1faDranvslt0sexrxrpou4apeelici (f 2tmumo;t1teen i3ilt a el(msn() rxnxf3iatlaDeluvi s srto(r3ou4lpt lfctasfa2taurp;u0teeniictadfm2umu p u4 lxoxrcoodfmt  ieo (  euriopio4ol e nctatfa2umumoou4alt ifciytfsDra(mo t)tlxomr oy1fp eanei (0srtoxr io1om  micslsfa2urx o;t4oeen fciat s raumo u) rxnxr oa1lmDranes;s0seuo(rpoo1omeemicta()artr(mpot0oexn o3tldfs rau p u)treoifcia1faDrlueo;t)texrxm3iodap emfesa( sDurxr ;o1aetn o3iad mDulumsn(0trxrmr3ootlp   neo s texr(r3io4al elfvt ()s2ra(rpnu0tetnmfciltla2eanmp;(4 reomf3ta1lp rlueo t trum(rpnudal  mictat arrrump;t1oexn iciadls2uanvs;(4artrmrcootlmtr ivolt srtrio3oudllte ivtat aDum(mpoo1tet mi3tldla2ra( o;t) lermf3io1op eanes s0sexoio3oodlptelfetatfs2tmumont0oexomoeiydfmDrauvo (0 etoxfcio1opDranvi (0 etmxm iudlp   fvs s)srumumont4oeto fciadla emn o u4 reoir3iy1lmt ai s;t0seuriopiodomte fvi tfaDtr(moou4tptnioctad a eluvp u4alxoif oydomDe ivilt texr(o3io4lltnmnet s arumu  ot4teeo ieiasfsDel( p;(4trtnxf3to1opD lneol()srxm(m3ny4lp e nctltfaruaur nu4tltn i3iatlsDum(vsnt)trtnxfcoytfaDe i slt srurxr iu1llt mnctl(fsDuru p;t0opto iciyt s2rlu s;u)aeerio3tytfat anei;s setoio3iy1ol  mnvsls) 2um(m ou4alt mfeild s eanvo;t0tlxomociadfmDr uvols0srur(mpoo1om nmfvi t a2tmx ono0tltnifctltla2rl(vs;u0teerifcoodoaD  nes s)t2xmio nodolt  ics (f 2rrur ot4tee iieiasfmDumu on()trtomf3oo1om  lnvs;t0srtrxm3ny4ol nlfctasfsrtmxmo;u1oleo ieilt mDelnmont)aeeoio oa1lpDelivs s0sexoxr nu1lpeelicilsfaDtrxmpou4ale  o3ildfmDrmuvsn()tlxnio3ia1lat  i ol(0setoimpou4omenmivilt  Dtmxrp;u4optoifeiadla uln o;()teenxf ta1omD anes;t  eurxr iu4om elivs t  2umxmpnt4optnmoctadfm ul(vsnt)trtomrcoodfmt luvo;t)seto(r3ny1llt  nvias)artrxronu0tlx mo3iysfsDuan s u)alxnifcoa1fate iei s0s2toiopou4al elfeils)aDrrur ou4aee mfctatfs ua(vs;t4trtrmocoadfa elivi (0s2xoxmpno4oleemict (fsrurxmp;u4olto fctyd s2uaumont4alxrif3iy1laDrlnvo;(0trtoxo3iu4am nmfes t)aDuau  ;o1oleniictltlmDulu ont) etnircoodlpDraieol( texrxo nu1lpteliesa(fsrtmumont1apxomo3iytfa rmuvo (0trxnir to1fpte neol(0texm(mpnu4lm n icil( arrm(root1tlxn o3ilt m2ra(mon(4arxomf3iatfpt  neslt0srtmiopoodamtn neta()s2rmxm ;o1ape  o3tyd aDemnvs;()trxoiocoa1lmDelnvo;(0s2xoimpno1ape lncils)arum(ronu1ale mieiltls2rmuvp u4 eenio iodlm   nvil( s2umimpiy1olenmfvtltf 2taumoot1teeo ieiadla2rl(vs (0alxrmfcoy1optraueo;t0 eumimpio4amee fesatfaDum(  ;t1ape mi3iytfmDumnmo;t0tltomr3todlm rluvs;s)s2xmxmpoydlp nlietat)s2um(mpoo0tptnii3tydlmDuau o t4aetrircio1oa  li ol()srxrir oydalen fcs (  2rrum nt0aeeniiciltfs2ran o;t4 rxrir3iytfm eanvslt) rxm(m iy1alte fci ( aDum(mp;t4olxniieiyd mDrauvpnu0aexoxr3iy1optr ues ( seurirpiudllenmnetl( s2uaxmpno1apen feiydlaDua( s;()aleoio3oydomD lueo t0tetmxrpoudlle mnctlt)srra( ont1opt mf3iydfm rlnvs (4alermf3oo1fpt  iei;t0 rxm(r ny1apee nvi s) rtmurpou0tetn i3ildla ea(mo;(0aexrmfcoo1fpte i i (0 etrxmpoy4om nliciat)arrmxm ;u1ale miciasls uanvo;t4aetrir3oo1opt  u slt0 2xrimpnudolt  fcslsf 2tmxrp;o4olt ioetytla2ea( pnt4tltnir oydop rai s s) etoiopoodomte ncsa(fs2ur(ront0altnifeilsfa2rluvsn()trtomfcoa1lpD luei;(0s2xoxopnu4apenlfcil() rumx pno4tlxn o3taslsDuauvs t4tltnir3iytom eau slt0 rxmio iodomee ieslt aDtau  ou1apto ociltlaDeluvont)aeermo3ootfpD livs (  eum(rpiu1lle mfetlt)s2urum ;t4alt if3ilsla umn s (0 ltrxr3todla eaieo t0srxrxm3iu4olt  iei t s2umumono0aleomo3iytfaDelu p;u4altnmocoy1lmDean i;t sexmxr nydaltnlivsat) Dtrxmpoo4olxomietatlm el(vp (4 rxnmf tatfp  ln o s0 rxoxm ou4lptn fetasfa2rr(rpnu0aeeomf3iatls rlnmp;t0trxoifciydoptr i ils trurxo iodope mietasfa2tmxmono0oleniociadlm2rmu ont0trxnircio1fmt  nvo;s)s2toxm iydame  fes s arrmxm ;t4oexnii3iad m umuvs u0altoxo iy1fp   u s;( srtrir no1aleemnctlt  rtrx p;o4aetnmo3ild aDrmu pnu)arxrio to1faD  n s t0 2xoxo oo4ole lfei t a2tmxmpno0oeeomfeildls2emnmo () eeoxo todfaDe ues (  rtmio ny1lleelivsatfa2uru oou1apen ieilslmDemuvs t4 eenxo ty1fp eau s s0 rxmirpoo1opeemfcia()a2tmumo;t4aee  ictys m ranms (0aleoircto1opt auvs;s  2ur(rpio4open nciatfartmuro;t0optomfetyslm2elu pnt0 rxrmo3ia1oatran sl( sexrxr oudoltn ncia() rtaxmpot1oleoifcildfs emnvsnu)tetnmrciy1fpt  nvs;s  etm(m iy4llee nvt s) Draum ;t4alenmoeildfs um(vp;() lenir oodoa e i ol( srxo(m iu4om   iesas a2rrxmonu0tpe mietys m2rlnmsnt)teeoio oa1oat auvo;s sexm(m oodlmeemies sfsDraxmpnu4tltomieiad m2um(vo;()alxnxo3to1optr u i;s s2xoio iodol  lfet sf 2uaxro;u4texnmietatls2rl( p t4teeoif tytla rlueo t)srurxo no4lleemnetlt)aDua(moot4opx iietytla ul( s;(4alxnxrciotom eluei s) 2xr(m ny4op elictltfsrtm(  ou4altoifeiydls2umnms;u)arxnxfctodom  auei;()seum(r3nodop  lfesl( s2uax oou4tptoiietadlsDemnvsnu4trenxr totoaD luesl(  2uo(o ou1ll nlnvsls)s2rrxrpou1aee  ictyt s em( snu4artomr3iy1omtrauvs t)trxrxopiudopen netl( arra(  ou4tpx ioetltfm ul(vo u0trtoxf3ty1fpteaueslt trtmim iudape micia() 2taxro;t0apxo o3iltfm2rl(msnt0 rxnxr oa1opD  nvs;t sruoio3nydomtemfcilt)a2tmuro;o4opxnifcildlsDumuvsnt0aeerxr3iatfptrau o t0texrxm3nu1apt micsas sruau pnu0oex  oeiatlaDrlnmp u0areoxocoy1fmte n o;s0 2umxmpoodol n nes t) rur( pnt1texomfciydls2eau o;()teeoiocoodlp rlnvo;t  rtm(opnudop e ictas)aDra( oou0aleniietysfm2em(mp u0 lerifciotoaDrlu i;t)t2xm(r no1olt lnei (  2rr(monu1tltomfciltlmDel(vpnu) renmf3tatlaDe u olt0teumxmpoudlp eliviat) rrmu onu1olen f3ias s ul(vo;t4tlxnmo oydomte i olt  eumir3oydamtnmnesat) Durumooo0opeomf3iydlmDeauvp;u4tltomf3iytfaDeaueslt)srxrxr iodamte nes sfartmu pou1tetomi3iasfmDrm(vp ()trtoxr3oo1lmDe n i s  etm(mpnu4ameelnvt ()srtm(r ou0tptomi3iasfs uau p (0tlxrmo3to1om eaues;s0s2umxmpoo4lltnmiesa(fs2um(r nu0opx  o3iasls2em( on(4treoxr3tatopt li o s0sexm(opoydom elfes ()srtaxrp;t1tlxn oeiad m2ulu pnt0tetoifcoadfa  lnvolt sexo(o oo1om emnes ()sDrr(m ou4opxnmo3ilt a rmnmsn()arxnxoctytfmtelivi t  2tm(rpno4ol nlfvsa() Drr( o;t4alt  oeiyt aDraumo;(4artrif ta1lat li i;(0trxrio no4oleelfei () 2ururpnt0apxnif3iatls2elnmo u4arxnxo iadfmtelneils trxm(r iydap  lies (fsrtaurpnu1oexo o3tlslmDrlu o;u0 lenxr3oodfp rlnvi;t s2toir nudlm   iciat  2um(m no0opeoiiciytlsDelums u4 ltomf3tydlmteau olt  2um(opno4ameemnvtlt  ruru pno1tetoii3ildfmDumn on(4trtoir tadoat  uvils teuo(m3nu1ame mfes tfa2ua(mpnu0aexoiietydfs2ua( p t4tlxoif iotfp elnvs s  etrxopiydoleemnvtas)s2trumo;t0tptnmietltls2ranvsn(4alxnxfciydoat  nvo;(0trxrxopoy1lmt lfetas)artax oou4texoiieiydfm2umnms u4 rxomo3iotfmteluvsl( srum(mpnu4ol nmfctl()srurx oou4tlenmiciatfsDranms;t0arxnio3todoatrlueslt0 rur(m3oydop   nvsltfsDra(  ;u1tlx  f3tat sDrl(mpnt0trtrxr tatfm elivo;t  2uriopiudal e fci tfarta(m ;o4tetn feilt a2umnvs;t4tleoir3ta1oa  auvo;s s2xrxo3oydam emncia(f Drrxro;o0opxniieiasla emn ont)arenxf oodlpDeau s;()trtoirpou4ame lfcsa(fs2uaxmono1oeeo i3iysfm2ua( s (0aeeoxo3iydlmD an i ()trxoxm nydom e ies t  2tr(m nu0tlx ii3tat a umnmonu0tetomf oa1fmtr uvo;s sexrxrpiy1am e iet t)s2uaxmoou0alxn i3ilslm2em( on(4treomfctytla rluvslt0srtrxm3iy1al e fvi t sDtmx  oo4apeomiciyt a emumpn(4arxnifciadfa eauvo;(  rxr(m3ny1ale lfet sfsDtr(rpnt4aexo o3ild mDrmnmp;t) exnxo3iy1faD  n o;t srtm(o ny4open iet t)artr( onu1apenmf3ildlmDul( o;u) lerxocio1faDelneolt0s2xmirpny1ap elnvt (f Dtmum nt0alt moctydlm ulnvont)trenif ootoatrau
\ No newline at end of file
@@ -0,0 +1 @@
+nvolt0 exm(o3nu4aleelnci tf Dta(r ;u0tpt iicils a umu p (4 rtnxf iatlmDrlivolt teurxr iu4lmte ivia(fsrtm(mpnu0texomociyd m uanvp t4alxnxfcty1optelivils0 2trio3oo4ap nlfctlt)aDra(rooo4tle ioetysls el(vo u4trtnxf oo1la eaiei () eto(r no4am   icta(f Drmx  nt0aex  i3tldlsDul( sn(4alxnxf3tadop rli o t) etoio3oy1om nlietl()s2ua(moou1alxomieiad a2eanvo;(0alenio iotlpD luvi t t2xm(m oodape mnvtl()sDurxm nu0aee  fcilslm ra( o;u4trtrirctydopDraieols0trumxrpoydole mnci sfaDtmu  oo4oet ifcildla ranvs;(4trenmo ootfaDrlneslt)s2um(r3no4am nmiesls) Drm(r ;u4olxnmi3tydlaDra(vsnt)aeenxo ia1fatr n ils) rxm(mpny1om n iesls  rrrx  nt1aee mo3ild a rm( o u)aexriocta1lptrlu o;()texoxmpio1lltelfcil(fa2um(rpnu4alx mietldfa2uln p u0artnxo3tydlmD  uvslt)s2tmio oodap  lfeilsf rtruront1aleo i3tls s rlnmo;t0tetnmf oy1faDraivi;s seuoim io1opeemicsls) Duaxrpot1oexomociyt aDel(vsnu4 rtnxrcoytlatelies t)tetmxmpnu1olt mivtas  rtr(ronu1ole mfciydls ulnvpnu4 ltnxr3oo1omtrau i t)t2xmir nu1opt mict s  rtrur ;t1tpxo ictys sDrl(mo t4 rtomr todop eaieol( srtmxr nodlp n nvs (  rtaumono0apxomf3tytlmDua( p u) lenmo io1om eaueils) 2to(r no4op n fcsl() Dtmxr no4alxn ictldfs emump;u0artnif oo1lmDr nvo;(0 2tmiopoydomtemfvt (f 2rr(mo;u1tpe  o3iltla eanvo (4tlxomf todlaDrlnvo s  eum(m nydame lfvsasfs2rm(  nu0alt iicildlm um( sn()trxnmrciadoa r n i;t) euoxmpiydome mncil( sDtrxm no4oee mietasfm2rl(mo (4 lxoxr todlatrlies;(0srumxo iydlptemici ()s2ta( pou0apt  i3iat mDea( o (4 etoiocta1opDe uvi;(  etrio oydapenlnes ()a2urx  ;u1tlenif3iltfa eaums;t4altoir3todoaD lu o;(0teurxm3ny4lp   net (  rua(mooo1optnmo3iatfs2ua(mp (0 etrmo oodomDean i s) exm(r3iy4amt  ieslt) rtr(root4tleomo3tydfsDrlu o () reoiocoydlpteli olt)setr(o nydol nlietas a2rrxrono4opxnmieiad sDeaumsnu4 eenxo3oa1lm rliei t0 rurio nudam  mics (  Dtau pot4oltoiociat s2eau snt)arxnxf iodfateai s s t2uoxm3ny1lp nmnvs t)a2ururono0aeto f3iat mDel(vo;(4aetrif io1fmtr i ols  rtrxm3ny4lmeelfcsas srrmx pou4apxnifeild m2umnmo;()artomrcta1fp elueo;t tetoir3iy1ope liciat)aDtrur ;u1optoif3ilt s uln o u4treomfctydlat livs ( sexmxm oodopt livtl( sDrmx onu0oetn f3ilt a rluvp () exnxfciy1fmDraneol(0tetoirpoy1al   fvs t)artaurooo4ale mi3iyd sDul(mp (4trenmf3oadlaD auvsl(0 2trxr3no1lpenlfvi () rrrurpou4alenmfcildlm elnms u4artnifciadfaDranvi (0s2tr(r nodaltemnesat  Draurpnt1alxo fciasla uauvonu0aetnmfciytopD  nvi;t seuo(o3iydoleelnei ()aDra(r no0oltomfctyd s rmnmpnu4alxoxf io1op e nvilt s2uo(r3iydlp  mivtlt) 2ra(m ;u4apxnifciaslmDel( p;t)tlxoio3todomDeli i ()t2xo(opno4openmietlsf rumxm ou4aeeo ieiydlsDra(mpnu4trenmociodopDe uvs s0 2uoxmpny1apen nvi tfsDraxmoou4optoii3tytlsDrl(vs t4artrmfciadfate i o s)t2ur(m oo1om n fvtl( aDtr(mpnu1openmo3ilsfmDel(vo t)trerxr iotoa  lnes s trxmirpoy1lle liesl()srtrxmpnu0oleo octlsfs ea(vo;u0trtnmo tadomt  nes s teumxo nydoleelnci s)srum(moot4tpt  ocildls2rmnmo;()aeermocoadomDelu s;s)seto(m ny1olte icias  2urur ot4oleoif3iytlmDem(mp;()arxoircoy1fpDrlneo t0 etrir3io1ap n fet tfaDrrump;u0olenio3tasfm2um( p;(4tltnxocoo1faDrai o;s)s2ur(rpoy4ame  fct s) Dua( p;t0tltn i3ilsfaDulumo () lxrxf tydlm   n o t0s2uo(r3nu1altn fesls  Drmxront1aleo oeildfa2rauvs;u0trtnir3oydla  lneo ()trxmim3iu4llee fetatfaDrmum ot1aee iieilt sDua(mp;(0 eeniociotoa  aneo;s)srurxmpio4amte ivi s s2uru ooo4ole  i3ilsfa emums;(0tltrio to1oat  i sls texm(o3iy4lp  mici s  2um(r ;u4tptnmfciydfsDrl(mp;()artnxr3todomteln ol( srxrim3no1ape lnetatf Dtmxront4tltniociydlm2uln p u)tlxrmrctadlp eanvols0srtr(m nodalt lfeia( srtmx  ;o0optoio3iltlaDraums;u4teerxocoy1oat aivils srxrim io4op elnei sfa2ur( pot0altn i3iaslm2rluvo (4 ltrxrciadlmDraivs;s) ruoim3oudaptelfvt tfaDraur ot1texoiiciat aDulnmpnu4alxrmo oo1laD an o (0 rurxrpno1ol n icsas) 2ra(mont1ole  o3iatlm um( o t0 rxnif oadom r iesl()srumio3iu4ll elfvt t) Dumurpot0tex mf3iaslm2rluvp;()tlenxr3oodom  lueo s0setrio oo1am emnes s)a2rmx o;t4teeniiciadfaDumu pn(4tlxnio oodoa eaneils s2xoimpiu4ol nmfvtlt) rrm(rpno4alxomo3tat mDrmump;(0aexomocoo1faDeaueils setoxr ou4al n ivtlt)a2uru pnu0tpxoiiciatla ean p u0teermr ta1oa   ueilt  etoimpnu4ale mfesltfa2raumpoo4aetomietad s el(vsn(4 leoirctydla elueol(0 rur(o3oo1lmtnmnvta() 2ur(  ;o1aexnifciasla2el( pnt4aetoioctytop eanvsls0setr(o3ny4ol nlnctlsf 2rmuront1tlxo icias m2rluvon(4artrmocoodlatraieol()setr(r3iu1lpe mfeiltf rururp;u4aexnifciad m2el(vp ()aexoio3tatlpDeaneils0s2xrxm3ou4ol e fciat  rrrumpoo1tpxomoeiydlaDul(vp u)trxomo3totfmD aivols)srtrio no1lpenlfvi s aDtmxm ;t1tltoiietls s2ranmpnu4arxrio3iydfpDran ol(0 2xmxo no4lp n icsas  2ta(mpou0apxniictyt aDeanmp t4 rxrmo todfa elueslt0t2ur(o ou4oltn ieilsfaDumu  ot0alx  i3tldfsDemuvpn() ltrxrctotlpt  i slt seto(r3oudlptnliei s)sDtaumo;t4tleo ietltfs2emn o;(0trxrxociodfm elieils0 eurimpny1op nmfvs s) ruru poo1alxnio3iytls el(mo;u0 eerio3oodfmDr ivs;s)tetrio3oydop  lneiat) 2ur(  ;u1tlenmocildfa uauvp;t4aetrirciy1opteliesl()texr(m3ou4lpeelfctas sDuau pot0tee  ieiadlmDean sn()trxoxr ta1lpDrluvo;t srxmim io1op   ietl( arraum ;u0tpe mf3iyt a2rau o;t4aleoxocio1fm rlneils)t2xrio3oo1olen nei ()a2ra(ro;u1tpeomieils m rmnvp;u)tlerir3iodlatelu ilt0seur(o ny1ale  neias) rua( o;u4aptn i3tyd a ean o;t4trenmo ta1fatelues;s  rtrim oydom nmnci ()s2tmu pno0opt mo3tat m2el(mp u4 rxrxf3iytlptelneilt) rurxmpiu4alenmnet s  2tm(roou0alxnmociytls2rlnvs;u0 ltnmr iatopDr u ol( setm(m3iu4ale lfcslt  Dtaxmpou0tlxnmf3tys m2rl(von(0 eenmfcta1op eaivo s) 2xmim3iu1alt  fvslt)aDumxrp;t0ope iicias mDel( o u)tlxnxo3totlmDelnvs;t s2xoxrpiy4am n ivtltf rururpou1apxnio3tydlaDrl(msnt0tlenmo3iydfmD ln i;t0 exmio iodape lfeil(faDra(mpno1opeomo3tltfa umu ont) rtoir3oytlmDeli i;()teuo(r3iodop  lfesatfs2tm(mooo1tlt mi3iltls2um(mo;(4 rerifcoadopt lies ()tetoxopoodlp e fcsl(  Dumu pno4altoioeilsls2uaump u4aleomo oydfm raiei t) etoio nu4omeemfcsa( srta(mpou1olt  fctydls rmu p;()trtoxfcoytoaD  ieo;t)srxrimpiydomt lietls) Dtrxrpoo4oeenmf3iytlm rl(mon(4aeeoircty1lm ranei;(  eur(m3nu1lm  mnctls aruru p;u4tpenioetyd aDrmu p;u0 lxomr tydomD auvi;()setoxrpio4op  livias  rrax onu0aeenio3ild a2rlu ont)altrmrcoa1om eauvi t  euoim3nodome lnetlt)s2tmx o;t1tetoif3iltlsDrmuvsnu0 rermr totlaD lnvo t seuoxr nu4ll nmnvsl()aDtmxrpno4teeoifciys m ua(vpnt0tlxomr iodfpDeaivs (0srtoxmpoo4al  lnvias) 2urx oou0apto o3iytfsDel( o;(0 renio ta1fm  lnei;s0 eumiopio1lmtnmnviat)aDtrxmp;o1tleoiietyt s rlu p;t4 rxnir3oytlpDe uei;t) rtrxo iu1am  lfesa(fsDua(mpnt0tpt  o3ilt s rlu pnu0trtoiociytfm e ivo (0trtrxr3oydalee icilt s2umu  ot0tee iiciydfm2uln snu)alerif ootlpt lu olt  2trio3nydlleelnvs tfsDurxronu1tpe  oeiysfm rlnms ()aexoxf3io1opDrauvs;s) 2xrxrpnodap  lnvtas  rrr(  ot1ope mf3iys sDranvs;u4texnif3tytlm   u i;t0 eto(opiu1oleelneil() 2rrxrpnt0tlenmo3iatla ul( o () rtoiociytoat lieo;() 2umxrpoo4altemiesls artru pot4alxo ieilsfa rluvo;() ltomoctatfpt  u slt  rtr(opoo4ol emfcsa(  Dum(  ;o0alx mo3ild a elums t)arxrxo io1fpDe uesls t2xo(r3ou1amtelfetatfa2urxr no4optnif3iyd m elnvsn()trxnif tatlmDraueslt0seurimpoodol n ict tfs2tm(m nu1oex ioeild m rmnvs t0texrxf todoa   i o t  eurio3ou1ape mietasf Dumx pot1opxo ociadla elnmsnu)alenxf oadlm rlu i s)s2umio3oy4apeelict s aDtmxmpno1olxo octltfa ua( p;t0 renmfcoytfaDr u i () 2tm(mpou1optn fvsa()aDrr( ono4aexoio3tyd s2rl(vp u0trtrio ta1lmDelivolt)trxo(rpiodlme lfcsat srtaumo;t4aptn iciyd m2um(ms u0texoxfctytop  lu o () 2umxmpnydalt lnvia()aDtmu  ;o0tpe  i3ilslsDea(ms;t4artoxo tatfm eln slt) eto(m3nu4ol elfct ()arta(m no0apto fcilsfmDeanvp;()alxoifcoy1opt au olt0 2toxm nydaltnmfetas) Dua(ro;t1tle mociadfs2rmn o (0arenmo3ia1fpteauvi;(0 rxmxrpiu1aptnlnvtltf 2raurp;o4apxnifciydfmDumu p u0artrmfciodomDe ivils0 rtmxo3iu4aptnlnet sf rtau p;u4aptoifeiltls2rmnvsnt)texrmocty1lmtelies;t) 2xoim no4om n nvs (fartmurpnu0texnif3tytlaDuau s u4 lxoxo iytfpt luvi;s0texoio3io1om nlnet t)srur(  oo0alxniociytls2rl( o;() rxomocta1oa   nvslt) exm(opiudol nlnvt tfs2tmxr no4opx  i3tas mDemnmsnt0 etoxo tytlp   nes;s)t2tmxo3ou1altnmfctlt)artr(m ;o1oeeomoeiatfm eaums t0artnmrcoytlpDean sl(0truo(m oo4al nmnvt s artaxmpnt4opxnmo3iydfsDrmnms;u)teeoxo oytfa rai o s sexoxo oydam emieta( srtrx o;u0oee mf3iysfaDumnmo;t)tltnir3ty1fa   ues t t2uoxopnydolt livilsfs2tm(m ou0tetn ociadlaDemums;u0 eerxr3iodoa   n ilt  etoxo oodll  licil( aDraumpou4aptn o3tldlm2eluvo;t0 etoifctatfmteluvo s)srtoxm oydlm e feil() 2tmurpno4oexnioetytfa ulnvp;t0trtoxfcoydoaDelieol(0srxr(r iy1alte nciat) 2ta(  nu1oetniietys sDuanmp t4altrmr oydomDrai s (  2tr(m iu4omtnmfvs t artru  ;o4teenmfciytlaDem(vpn(4 rtomo3oodomDrau olt0setm(mpio1omt lieilt aruaxmp;o4tpenmo3ild m2rmuvp;t0 reoif3oydlpDrlivo;()trurxmpiy4optnlnesl( srra( ono1apxomo3iyd sDel(monu0aexoif io1fat ai s t sruoxmpny1omtnmicsls)s2urxm oo1opxnif3iytfm rl( o;t0trtrxo oadlm e nvi t0 2to(rpny4apenmnci tf 2rr(mp;t1aex  oetatfa2emn p t0areomf3tadlptr u sl(  ruoxm3iy4amt lictasfsrtmu poo1teeoioctld mDemu ont)alxnxo oy1fm  lnvs;()trxm(m no4ape  fvtlsfaDtmxm ;u4apen f3ilsfa ranvp;u)aexomrcoo1fatran o t)teuo(r nu4ap elfetls) rtr( o;t4optomo3ildla2um( p;(0 exoif3ootomDr nes;s)tetm(mpou1omte nvt ()a2uaump;u0tlenmo3iys a2rmn s u0aetnmo3tadom e nvil()s2xm(rpnudom   ivtat) Drr(mooo4ape  o3iatls2um(vp;u) etomocta1oat lnvs;()sexm(r no4am nmicil( aDtaumpnu0apx  icildlmDumn o u4arxrxf tydlaD lnvs;()setrim iu1lltelfesatfartmu  ;t1oeenioctlt sDrmn pnt4texnmf iatfp r iesl()texrirpiudop  lnei t) rrmu onu1oee  fctysfsDel(vo;u) rxrxr ia1opt  ivi;()teurxo oodaptnmfcilt)sDua( pot1aet  ociltfa2el(vo;u0tetnif3oatlatr ivs ( srtrxmpiydlltelivt ()s2uaxrp;o1oltn fcias a2ua( pnt)trenxf3tadfa  li o s) etmxopou4ape lict sf rrmx p;o4tlxniictyd a2ranvs;(0aleoio ta1omtr ueo;t) exrxm3oudam  mfctas aDtm( p;u1oex if3taslmDelnvp u4aetrmoctodom e i i t)t2xr(o3nu4ole  nes s  rrmum ;t0tpxomiciys mDrm(vpnt4 rtoxo tydfat anvo s  rumxo3oodopte ieslt a2trxmpot0tpx if3tyd a um( s u) ltrmf3to1laDr i ol() 2to(opiudam nlfetl( srumxm no1tlt  f3iasls2umnmpnt0tlxnmrcty1omDelnvi;s)texoir3oo4alt  iviatfsDtmum ;u4tpeoiociysls2rauvpnt)tetnio to1om   uei;s) 2uoimpoy4am emncsat)aDtru ooo0ope mfcildfm ea( s;u) eenircoodfpDelivo;(0 eum(o oy4ameemivs () rrauroou0opxniieildls eln ont)altoxo3oa1laD ai ils)teumimpiu1lmt lietas  Durum ;t1apeo fciyslaDea(vp;(4tlerxr3oy1opt aneolt0t2umxo oo4am eliesls) Dtrxro;u4opxoifeiadfm rm(mo (4 etoif3oy1oa rlnvi ()t2to(opio1al elnes s)a2raxroou0oex  icils mDuanvp;(0texrxo iy1lm eaues ( t2xrxr ny4am nlfvi ()a2tmump;t1tpe io3ils sDel( p;u4 rxomrcoo1faD lnes t0trtoxo3oy4al nlnvi ()aDtr(mono0opt mieiys s2ul(ms t0tltoif iy1la  lneo;(0 exrxm3oo4apt liesa( sDrm(rooo1tpt ioeiatlsDul( p u)alerif tadfpte neo (0t2uo(o3oo4alen fvsl(  Dururo;u4tlx  fetyt a2ranvs;t0tltrxfcoy1lateaies;t t2tm(m iy1ale  fesas aruaur no1tlenmoeiat s rlnms;t0 ltomo3iy1lmD lnvol()sruoir ny4apenmies t a2raurono1ole  f3iydlm2em( p u0aeeomr3iatla eluei;s) 2xrxm3oo4ame  nct (f Dtmxroot4aptnmfetldlmDulnvp t0altrioctytla  livo;() rxm(o iu1lle mivils)srurum ot0ope miciltla2ra( on(4arxomr3ty1oa  ai olt t2trxm3io1op   feil( srtm(ronu4tleo feiyt a rmuvsnt4alerioctydomDe ivs (0trtrim3oudlm emietls)aDrmu poo4tlx mfetasfm umn pnu4aexrio3oy1fpD  i o () rtrxr3nu4amen iviat) rur(moot0tpto ocildfs2ra( p (0 lxoio3todlaD lu ol(0 2trxopio4omenmivt s) Dta( p;u1olt ii3tys s2ra( p (0arxrir iodop ean o;s  rum(o3iy1ap   fes ( srrrx ono4apeo feiydfm2um(mpnu)teenmo iytlpt luvi t srumxr nydll  miciat a2rr(rooo4opxo fctytls um(vp;u0 leoxrcia1fmt lneo s) etoim nu1ll elies sfa2rrxr nu0tptnio3ildla el(vo u4 lxnmo tytlm  anvs s0 2tr(r nu4ll n fctas)srur(mpnt1texnmoctltla2emumo;t4teeoxo3oydfpDr u ils)srumim3nydll nmnvil()a2rau ont4altoiiciasla2uan pnu4 exomr ty1fm  lu o;t trum(o3nu1ape  ivt ()aDrm(mo;u4aee  fciyt aDrl(vs;u4 rtoxo3iotoat  u o s0 etm(r ny1lpt  fvi t) ruaxr ;o0opeo feiydfm2rmn s;(4tlerxocta1oaDrauesls s2xoxrpnu1amtnlneslt aDurxr ou4tpxo o3iys s2rm(vpn()teermr3oadlpDe nvsls) 2uo(m iudaptnmfvsl()sDraur ;t4apeoio3tlsla elu s u) lxomo3oodlmteaiei s0t2xmimpoodlpenmict t)srrrx  ot1tptnmiciys aDranvo () rermrciytlmDelueslt)setm(rpoy4lpenmictat)a2rax pnu4aleo fciadlaDemnmp;(4aetnxo oa1fpDelieo;()seum(o io4am n ieiltf rua(ro;o0apeoii3iyt a2el(vs;t4aexrir oy1fmDe ivs s sruoiopoudome mfvilt aDrmu  nu0oexo icild sDraumpnt0arerxo ootlpt  uvi;t srxo(mpio1ll  mnes s) rtmu  oo4tpenmociys sDum(mpnt) rtniociy1omDrlneilt0 exoxm3io1altelietl(f rua(r nt0opxo oeiyslaDeau s u)aeerircoodfpteln o t0trtrxm iu1llenlncsas)aDraxm ;o0oet mf3tlsla ulumo u)aetomr3tatfaDr uei s tetmio3oodopeemieilt  2tmxm nt4tptniociltlaDelnvo () etrmoctotfaDrau sl(0tetrxopnodalt  nvt s  2tmurpoo1opeomociytfa emu p t) rerxo3oadop elieol(0t2trir nu1ll n ivs (faruaurpnu1apenif3tytfmDea(vpnt4 ltrir3oydfaDraieo;( texoxr nu1am   fcs sfsDuax  ;u4apxoii3iad m2eln sn(0arenmr3iydoa eau i (0 2to(o no4opt lnetasfaDrrx poo4tpx mo3iatfsDumnvsnu4tlenif iatlp rluvs;() eum(r3nu4lmte fctl(fa2tmxm ;o4olen f3tldlsDeau pnt0teenxr oa1fa   nvols t2urxopio4ll nmfvsat) Dur(mp;u1tlxomfciadfsDeanvp t4tleomo3ta1op eanvo ()teum(r oudamte fvilsfaDrm(r nu1opeo icilsfs2rm(mon(4tleoir3oodoatrauvil()seum(m oo4amenmfet ()arraumoou4opx  oeiys s umnmp;t4tlxnmr oa1lptr u i;s srtr(m iudlmt  neil( s2ua( p;t1tptn ieiadfmDelumonu0 rtrif oy1op rluvo;(0 2xoxo iudopt lnviltfa2tmum ;o4tex  i3iadfsDuan pnt) eenmf ty1om  livs;s0srtoimpiudopt  fvsa(fa2ua(mpoo4ale  fciysfs2rmnvpnu) etomr3to1oatrai o s trtm(r3iy1lptemnesat)aDumu ont1alen ictldfa2uauvs;(0tlenxr oa1opDrlu i s srtrirpiu1lltemfesa(fa2um(rp;o1aee  f3iytfs ul(ms;(0 eeomo oydopDeaiesls  rtr(o iu1opt  fes sf Dumxr nt4tpenifctas m ra( p u)tleoxf3oydlp e n i (  rxr(o nu1ame lnvils  ruaxmoou4olxomoeiyt sDeau s;u4tetoxr3ty1lpDelu o s)t2ur(m oo1opt mivsasfartrur ;t4teto fctytfsDea(vp t0artriociadlmD anesl() exm(opoo4openmietl( a2raur nu1oexoioeias m eanvsnu) lermo oy1lm  lneo;()t2toir nudomtnlfvsa()s2ra(mpoo4aeen oeiat m2ul(ms;(4areomrciytlmt anvi t texoxrpiodlltnlnvsat a2rmxm ot4apen feils m rln s u0 lxnmf3todfmt auvo;s) eurxm3oodapt mfvi tf Drrxrpno1aptniociydfs rmn o;u) rxomf3tydop e nesls t2xrxm3oydamenlivslt  Dta(mont0tex  ieiyslsDrauvs t4 lenir3ta1lmte nvil(0setmxmpiu4lpt  ictlsf ruax pno1apt  iciytlmDem( p;(0aleomr3ty1oa  au sl(0seuoim nudamen icsasfarta(rpou1tpxomociyd m2emnvo;(4treoxo iadfpt li sl() 2xmxm3iydamenliei s)sDraxmo;o4tpeo fciltlm ulumpnu0aexomf3oo1lmtraieolt seur(m3nodap e ncilt)a2rau oot0aleniiciys m2uauvo;u0 lxnmr3tytlptrlneol(0s2xr(mpoudol  mfetl()s2urumpot1apen o3iytla rlumo;u)tlenmr to1lp  lu i;(0teuoir3nydlpte nctat)srrr(mp;t1alx mictatlaDrlnvp u4tltnxf3tydlp rlnvo s0 euoirpoudlp nmfci sfa2ua(  ;u4aet ioctyd m rln o t0trxnmr totlpDr i s t)s2xo(m3oy4lp  livta() 2rau o;o4tpxo feiysfsDulu o;t)alxrmrcoydlm   iei t0t2umxm3oodlp elnviat s2trxm nt4aptomieiad m rlnmon()texnxo ta1latelues;s setr(o nodapt mneil(fsrraxmp;t4opxo fetatls2rmu pnt0arenxr3tadfmDe ieo;( srxoiopoodamtelfviltfarrrxmo;u4ale mfctyt sDean snt0alenmr tadoat li o s sexrirpoo1amtnmicia() Dtru ooo0oex iicildfs umn snt)texomf3oy1lpD  i i t)srurim no4omenmicsas a2rmxm ou1tlt  i3iyd mDul(mo (0 rermf3iadomDeluvslt0s2to(o ou1op   fetl( sruaxm ;u1oex iieiltlaDrm( o t4tleomocio1oa  auvol() rtmim3iy1om elfvta( s2ua( pnu4olxn iciyd a2rmnmo t4texnio todlpD  n o s0 2xmxm oo1am  mneiatf Dtrur ot1tle mieiltlsDran onu4artnxr iotlp raueo ()tetrir3nu1aptnlfvia()srtmumo;t4olen oetltls elu snt0 rtrxf3ootfa   neols0s2tm(m3ny4optnlieslt  Drm( ont0olx mo3tls a2elu s (4aeenmf oy1fm  lnvi s  eto(o3nodom  mfcias) 2rauro;t4tex  ieiyt m rauvs t)altomo3oo1omteaies t)s2xo(m3ny4lle lnvt (f 2ra(r no0oeto ieiatfs rmums;(4 leoxf3iytom e u s;t0s2xmiopoydale  nctl(  rur(rpot0alen ictldfs umnvo t) rtnmocto1lm eaivi;s0sruoim3io1optnmfct t s2ta(mont4oeeomfeiyslm2emn snu0trerxo3tydfp e ivo s0 2tmio3nodapt  fvia()sDraxr nu0tetnmo3tadls2ul( pn()teeoir ty1op eluvolt)sruoxr ny4al  lneia( sDua(r no4apenif3ias aDra(ms;t0texnifcoodomt  neo;t0s2tmio3io4altn nctls)sDrr(  nt4teenmoeiys s2emuvo;(0treomf3iydfa  aneolt0t2xoim nu1ll n iei t) rraur ;u0tpe mfetltfm2em( p;t0trtrif3tadlmDe uvsl(0srtm(o3iudlm   nei (faDtrumpot1aexnmf3ils s ul(monu0teenxf3iotomt  u ilt0 2xr(rpoo1lm  mnci sf rtaxrp;t4apxnmociysfmDelnmo u)alenmr3ty1oa  au sls0 euo(m3no4ome lieilt) rta(ront1tpeoifetyd s2ea(vs;u0 lenmo3tadfm rauvo;(  2xm(m iodaltnlfesat)a2taumont1altn feiatfsDumuvp;(4arenmr3totfat an ol(0 eum(rpoy1apt lneias arurxr ;t1tetnmoeiltfsDemnmpn(0 eenif oo1faD  nvils  rtmim3ny4lm elfvtasfaDtruro;t1oex ifciydfs2emuvo;t4 rxrmr totoa rlues;t trum(rpnodlm  licilsf rtrxronu4altn ieiad m umuvpnu4tlenmo io1lmtrai o;( trum(m3oodlmtnmncs t)arrrxmont4ale mfctlt s2em( s;()areomf oo1om e nvols  etoir io1apt  fcsls) 2urxm no1oee miciltfmDemuvs (0artoirctotlpt  ieo;t  rumxo3ny4ame licsls s2rrumonu0aptn fciydfs2ulnvo;()aetnxocoo1laDranes (0sexr(o nodlp nlnetl(f rtm( ont1tpenioetat a rmn p;t0arxrif oo1fp eau ols0texrxm iu4om emfvtatfsDumurono1olto ociydfm2uln p;u0 lxoio iotfatr i il( tetrxo ou4al elictl(f Dta(  ou0olx mieiyslaDua(vo;(0 lerxr io1lm eln o ()teum(o oo1ll nlivs (f Dum(rpno4apeo oeiltla2emnvo (4 rxomf iy1fateaneslt0s2um(rpnu1openmncia()a2umxr oo0tltnmoeiaslm em( s ()aetrio oa1faD  ueslt srxr(m3nu4ole mieil( aDua(mo;u4te
\ No newline at end of file
@@ -0,0 +1 @@
+ieil(0trum(opny4omeemfcia()arra(monu0alenifctytfa em(ms;()tltoifciy1lp ranvols0s2xmimpno1ap n icsas s2rmxmp;u0tpx io3ilsfa rlnvsnt0tlxoxfcoytlp  li s;t)sexr(mpoy1al e fcs s  Drmur nt1olenmf3ildlmDelums u) ltnmocty1omteaneilt) rtmxr oo1lltn icsl(  Durumo;u4oexn fciad a2um( p;t4 reoxf oadlatrlu ilt)tetr(m io4lm nlnci s  Duaxmono4apx ifeias m rau s;() eermf oatoaDrlivol(0trxoxopny1lp   fvsa(fs2uax pnu0tle ifctld a2ulu snu4arxrircio1fpteau i s)trurxo ou1ap  mnesasf rurum ;u0aexn feiad sDraumsnu)altoxf3iadfpDelivs t0 2urxopnydlp nmivi tfartm(rooo0aex  fetydlaDulnmo;(0trtnmf3to1opD an s;s srtm(o iu1oleelfvi (fa2ua( oot0apenii3iytfm elu o;t)tetoifciatomtraivo;t) rum(m ny1al nlnviasfsDtax  ;u0ale ii3iydfm emnmsn()trxomfctotopDrau o;( t2trxopiodalt  fci tf Duaxroot4oeeomo3ias s ulnvsn()arxnmo3ia1lmt  nei;s0texm(rpno1opeelfvtat artmum ;t4open ieilt sDemn s;t4trenirciotfpDeaivi;s  exoxo no4lle lncsl(  2trurpoo0aptomoeildfs2rau o u)tlerif oodfatraueo;(0s2uo(o3iu4amte nctat)sDumxmo;o1aeeniociyslm2ul( sn(4 rxnxrciotfptr i o t0trxmxo nu4al n ivsltfsDrax ono1oleoiicildfa eluvo;t0alxoxr ta1lmt lues t0t2uriopoudap nmnviatf Dra( oou0opxoio3tadfs2rm(vp;u) exrmrcoo1lmDrai o;s s2toxr3nu4optnlnviasfa2ur(mpot0olenmfeiltlm rmn s;u) exoif3iotfmDeauei;t  eumim oodal nlivt s aDtru oou1opxomfeildfaDua( on()texnxrcoytfp eluvi t)setm(r iodameemivta(  2ra(  nt0oeeo f3tyt m uln pn() exrmo3tadfm  au s;s)srxoxm3io1omtn fvt (faruru oou4oexn ocilsfm2em(mpnt4alxnxo iytoaD lu ils texrir3ou4lltnlfeils)arrr(moot0tpeomictas m eauvp ()aetrir3oadlm  au s;(0 2xmim nudamtelncslsfsDtrumpou4tpt moetltfs2rlnmsn()aexrmr oatfp  livil(0srur(opnodalenmfcs () Duaxm no1tetnmf3ildfsDrm(msnu0aetoxrciodlmteln i;t) exoxm iu4aptnmfcslsfsDrrxroot4alxoifeilsls2rl(von()trtoxo3ta1omD luvi;t  rxrim ny4lpe lfvsa()a2trxm ;t4apeoifctys sDul(mont0aetrmf todop eauei (0srxoxr3no4am  lnvtatfsruau p;t0alxoifcias m2elnvo;u0tlenxr oydlaDrln o (0 exrxopou1lmeelnctltfarumumpou0aeeoiiciysfaDeln o;u)teerif3oodfm   n o;s0trxr(rpoo1oltelfeta(  rraump;u0oee iieildlm rmums u0 eenxfcoy1lmt lieil(0 etm(o3nydll n nvt (farrr( o;o4tpxo fciys s emump;t)artomr3oatomDrlnes;(0 rtrir io4llt mnctas sDua(mo;t0aptnmfciatfaDran p u0trxomr3oy1fmtraivs;t) rxoxr3io4amee ictas srtm(mpot4ope mocilt s2ua( s t0tltnmf iy1fa eluvs s0seuoxr nodlpe livil()srrmum oo4apxniicilslaDrlumo;t4 lenio3oodoa  livils  euoxopoo1lpe lnei s arur(m nt4tpt  fciytls eanmsnt4alxnmf iydfp r ueol()s2trir3oo4aptnlivsasfartmx ooo0opxn fctydlaDul(mont4alxoxocoy1fpDeau o s srxmio3ou1amenlncia(  rtm( oou0tpxomf3iysfmDrmumsnt) ltoxf3to1omDr ueils0trxm(opiydlpee fvi ( srra(mo;t0aeeo octyt a uaums;u0trxrircio1omtrauvs;t trto(mpnu4lpte neia(fsDum(m oo1oexn fciydlm2rm( p;t0 lermociatlmtran slt sexrxrpnudoltnlfvi tfarur(m oo4olxomi3iadls rauvs;(0 ltomo3to1op elivi;s teumio3oo4llt mivia(fsDrm(m ;u1oexomo3iadfm2em(vs (4 lxrif3ty1faDranei s0 2xoiopnu1lp  mfviasfs2ua(rp;o4aee mfeilt m2ulnvs;(4arerifctatopD an il() 2xrim iy4oltnmicils)sDrm(m ot0olx mi3ilsla2raums u0altrmfcoytlpte nvils0 euriopnu4lptelfvtltf Dtmumo;u4tpeniiciaslsDeaumo;u4 rxrmo tytlpDeau o;s t2tm(m3iy1lm emnctl() Dua(rp;u1alt ifeiltfm rl(mpnt)aleoxr3oadfpD auvo;s)seuoirpio1ll  livia()sDtaxrpoo0aee moetydlsDuau o (4alxrif todop  aneo;( teurxm iy1aptemfvtasfaDrmxm oo4apx mi3tyd a2rmnvo u0 etrmo oytop  ln i;(0srto(m no4ll   ivt t sDtrxr ;t4aetn o3tldfsDran p;u4 lxrmo oy1la rlivo;() rxm(mpiu1lmtemfcs sfa2rau p;o1tptomoeiytla umumo u4arxoxr oadlmt lnei;(0trtm(r3oo1lme lnvt (fa2uru  ot4opeoio3ias s ean p u)trtomo3oytfmDrau ols0 eto(o oydlm emfvils artrxrpno1olxo f3tad m2rl( p t4 rxnircoytfmDeanvo s)t2to(o3iudaptn fvia( srrmum ;u4aet mf3ild s2uanvp (4aexnmo3to1opt anvslt0 rtoimpiodapee ncilsfarraxrpno1oex  ociad s2ra( on(0aexrxr3iadoa  anvo;t  2xm(r3ou4om e ieslt a2tmxr nt4alt  f3ilsfa elumpnu)arerxrcty1oa e ueol(  2xo(rpnu1al   fcsls)sDumu  ot1oex mf3iysfaDrluvs;t0aexoif3oadfp   ues ()s2xrxopiy4ll nlnvtlt  2tau  nt1oltoio3iadlmDrlnms () rxnir iytfp r nvi t0 eurxr iy4olenlnesas)arraxronu4tpxnmi3iat mDem( o t0tleriocoydlmD lies;(0 2xrio iodomenlneil(f rraxroou0teenmieias mDemump;(4artoir3iy1optr nvs s teto(m3iy1amtnlivsas  Dta(r ;o4tlenmoetad s2elnvo u4 lxoio oodlatrai i;()t2tm(r ny1op   fct sfs2rmx pno0alxoii3iydfm uau o;u)trxrxf3iytfm ran i s teurim3iudlle mfvilt a2uaxro;t0aet mfetasls2rl( o;(0alerio oy1omD  uvi (0 rtr(m ny4opeemfes sf Dta(r oo4tpx ifciyd sDua( s;u)aetnxo3oadlaDeaies s)trxoim3io4ame  icil() rrm(mpnu4tlxnmieils a uluvpnt) eenxoctodfm   ieo t) exo(r3nu1lpt  ncsas  Duax poo1olxoif3iyd a2ea(vs;u) rtoxf3iatlptr ueo t) ruoxr3iy4opee ivta() rrmumpot0opxoiieilsfm raumsn()alermr3iydopt aneilt) 2toirpiu1amenmnet s a2urxr no4aleoiieiytfmDea(msn() eenmo oydlaD ai i t0trxrimpnu4al n fci s  rua( p;t1apxn o3tlsla2em( o t4teeomocoodlaDrli ols)s2um(r3nudape mfei ()s2tax  nu1oexoii3ilt sDeln p t4 eermrcoytfptelueils)teurim3no4lmt mncsasfsDra(mono1aexomoctaslsDelnmsn(0 etnif3iytlpt lu sls texmxm nudolt  feil(  rua(rpoo1texnifctls m rluvp u4 eerxfctotlat anvo;(0 2uoxr ny4op elivsls a2uaxmoou4tlxomo3iysfm2umnvp;u4aetoxfcoa1oatrauvi s0teurxmpou1opeelfeil( a2rmxrpoo4aeto f3iyt aDumumo;u4aetoxfciytfm r uvs s)s2umio iodlmtnlnvs s  rrax  ;o1aexnii3tlsfm2rlums;u4aexnir iodfmtr iei;t)t2tr(m nu4am   icil()aDumxm ou1openmf3iadls ua(ms;t4alenmo iy1op e ueolt0 ruoir3nu1lle  feia( aDtm( pnt0opx mietyt m2ra( o u0 exoxrciytfpt  nvsls  rxr(r3oydlmee fvslt)aDrmu pot1apto iciad s eluvs (4trxrxo iydlpte iei s0sexm(r nudoltn ici (f rumum nt4oetnmietytfaDel(vo;u)tetrircoodfmDeau ils0texmxo3iy1opt mietls)aDuau  ;u0olto oeiatfaDemnms t4altnmo iydfm e neo t)trumxmpio4am e ivil( s2umu pot0aex miciysfmDean s;(4 etoir3iotoaD lu i;t texrimpou4al e icsas) Dumxrooo1aex  ociys a2rmums;u4teermo3tatoatr u o s srurxo3iodal e fvs (fsDtaxrpoo4tlen oetasfsDem( snt)areoxo3tadoaDe i i;s setrir iydol emfcs s s2ururo;t4ape  fctydfs2emnvo;t0arxomfctatom elivs;s0sexmir3ny4lltnmicil()s2uaxm ;u1teen iciadfm2rmuvon(0alxrmf3iy1faDr ivolt)srtm(o3ny4apeemnetat s2rm( p;t0opxnio3tys s2ranmont0 lxriociydop r nei;(0 2xm(r3iodom  lnci s) Dtaxront4tpxniociasfa rlnvo;t)arenmo3iodomDe ueolt)sexmio3oy4lm nmieslt)aDrau ono4alxomietltfm2umn o ()aeermf iotla   nvols  2xmxo io1am   netl(f rua(ro;o0tlto i3iadla2rlumo (0 lxnmr oa1fmDe u i s0 2xmir iy1lm  lfctas arumurp;u4olxoifctld mDrlums;u) rxnxf todfpDe i il( teum(r3iudllen ivtatfsrrr(rono0oexnii3tysfs ul(mont0tltoxo3iydoptrauvo s0 2uoimpoy1lme  ieilt a2umu poo0opt if3tadfsDua(vpn(4 renirctadomtrlieils) 2xoxo iu4oltemivsa( sDrr(mp;t4tlx if3iatlmDuauvpnu0 ltoxocootlaDelivi s trtmxm3oo4alt mfvs s) rrrumoou1alt if3iat m2elnmon(4aexrmf oatlp rlivs s trtrirpiy1omtnmfvsatf ruru  ot1aeto ictasfs2rl(mp t4 etnxo tytfpD  ueolt) 2tr(r3no4lmte fctatf Draur ;o1oex  i3iyd a ul( snt)aeenmf3iatlm e nei s srtrir3nydolen ncsls arua(mono1apeomfciytlmDel(mo;()aetnmf3tatop  aues s0s2to(o ou4ol  liei sfsDuax ono0tlxn icildls2ul(vsn(4aeeoir tatom e u o;t0 2xr(o oudop  mfcsl(  rraurp;t4aleomi3ild m ra(mp;t)artomr iotlatraieilt) etmxmpio1om  mnvt s  2rmxr ;t0tle moeiasfs2um(mo;u0texrxrcoa1laDe uvsls0 2umirpio1lpe mncilt  2rm(rpnt1opeoiieiad s2uauvo t0artrmr3iy1faDrlneils  exoxmpio4ll   feia( a2trxront4alt ifciad m rlu s (0artoio3ootfmtr nes (0srurio iu1opt lics s)srurxrpnt1tltnii3iyt a2uluvs;t)aexnmf tadfa eluvs;t0t2tmio nu1ol emieiat  Drrurono1aexo fciad a ea(vpnu4 etoif3tadfmtranvo;s)srtoxm3io4lle  nvt sfaDumx pnu0apxn ietyd s um(vpnt)tetnif3io1om eli ils) ruoio3iudamtelfcslt a2um(r ;t1open ieiad s2em(mo;()alxnmr oytom eaieol(  rtrirpno1am  lfvsls) Drr(moou0tpenmiciasfsDrau p t)treomociytfpt  ueils trtrxopoy4omte ncsltfaDta(mp;u4oexnifetlsls2uln s;u4 lxrmfciytoaD li s;()sexrxr ny1lmtelfvi t) Duaxrooo0teto o3tytfs2el(mp;u4tltrxf3tadom ran sl(0t2to(r oo4ole lnes s)srta(rpno0aetomi3iys a rm(mp u0 eermf tadfat lu i;s0srxmxr iu1altelfeil()s2rr(r ;o1oeto o3ilsls2ua( p;u) lermf3oydlat  ieil() rtrxo3io4al  mies sf rta( p;t1oetomo3tat m ea(mo ()tlenif tydlmtr uei;t teur(o nu4optnmivs s) Dra(r ot0apxoifciatls2um( ont4 exnmfcto1lp  aieslt) etoxo nudal nmnvsl()sDuaxroot4tpx ioetyslm rluvs;u4alxrxo tydoptrln olt  rtrir3oodoltnlicils s2um(mpno1aexn o3iydlm uaumsnt0alenmf3oodom   nes s0 eumir nu1llee ics s sDtrxmpoo0ole if3iytlsDem(ms;t4texnxo3ootfat  n i;(0srxm(m3oudlp emncs sf Dum(moot1tlxnmoeiyslmDrlnmo u0aexrmf3iadom   i s (0srxmxr no1alt mieta()arra(rpoo1tpxoiicilt s2eanms;(0aetrif3oo1laDrlieilt0trxo(opoo1lptnmnesasf 2umx  ;u1apxnioetaslmDel( snu4aexoxr ta1om  ai i;s trxmirpnu4omeelivtas)sDrm( pot4aexomieiaslmDum(mpn() eenir oydfatraneo t) rtoio oydll nmfctlt sDtmxmoot0tpxoioctydfm2emu sn()aexnmo iodfatrau i (0 ruoxmpoo4lpe lnvt t)s2um(  ou4apenmocils s ra(mpnu4areomocoodlaD  uvs;(0 euoimpoudom elivt s  rumu  no0opt  oetatfs eauvpn(0 renxrcoo1fpDeauesls0 rtoxopno1amen ici s)artr(rpou1aee ioeiyt s umu snu)trtoircio1fm e nvo t  rxr(m3oudomt mnctlsf rum(mpou4tee  feiad a2em(vo;(0teenxo3ta1op   ivil(  2urir oy1lle mfetls)artmxront1oex ifeiyslaDrl(mpnu4aeeoxfcootfa eau o s srum(o3iodlmtelfviltfaDururooo1tltnioetas s2uauvpnu4tltnmocoatlat  i sls)texrxrpou1ll n iciasfartm( pot1tetnii3iadls um( ont0texoio3todlp eaivslt texrirpoudlp  lict (farrr(rpno0oet  octld m2raumon() lxomr totlaDr uvols tetrxmpiy1oltelfes sfaruau o;o4tptn fciat mDrmnmsnt0tlxriocoodoa r i i;( s2tmim oy4alte iciasf rumxmp;t4aleoio3iytfs rmumo;(0 rtrifctadfatran i;t s2toio3nydlm nmivta() Drru pno4aeeo o3iltla2ranms u0trtoio3oodfm  auvolt texmxr3no4aptn fei ( aruau  ou1alxnmieiatlsDum(mo;(4tlxoifciatlp   nes () 2toirpiy4lmtelfcslt  2urxr nu1apxnio3ils m ra(mp;t0 eeoxr3oy1latraues t t2tr(mpny4lmt livs t  2trxrono1tpenifeiatlaDuaums (0tlxrmf3todlpDrlnvsl( teur(r ny1oleelicil()srtrum ;t4olen f3iadlsDrluvs;t0 eenmr io1omtrlueo t texoimpno4omenmnet tfaDtmx  no0aeen iciltla2em(mont)aeenir tydfm  auesls)sruoio3oo1oltnlici t)srrr(  ou1ole iieild mDrm( pnu)aexoxrcoadlateanvol()seurimpnodlltnlnctlt)aDrr(mono1aptomi3ilt aDum(mon(0 rxnxf ty1fp r nvo ()s2xriopiy4lle lieslt  2uaxmonu4apx mfetldfa2ranvp;t4aexrxf ootla eanvs;t0 2uoir iudoleemncils artrx  nu1aeeoifeiadls rauvp;(0arxoir ty1fatelivi (0 2xriopiodllenlnvs t srumum ;o0oltoiieildfm2rmuvsnu) rxrmr3iydopte ies;(0trxoio iydalee ieiasf Dum( pnt4opx  oeiatlm2ea(vo () rtomr3oydoat  ivsls)sexoxr3no4amt  fcias)artrxro;t0apto fctydla2rlnms u4 etrmo3iy1omt luvi;s s2urxm3nu4apen nci s  rrrxronu0oeenmf3iytla uanmo (4 lxnmf3ia1oatran slt  exr(o iy1omtemnesls srtm(rp;u0tlt mf3tlsfa em(vs;u)texrxfctydlmD lneslt0 eumxrpiudomt mivsl(fs2ra(mooo1alt  octltfaDem( o;()alenifctadop  luvolt0 2xmxopiu1am nmfet t)aDrm( pnu0olxomictad a2rln s;u4aexomr tydomtr u s;t  etm(o3iodamtnlicta() Dtm(  oo4aet  icils s ulu p;()tlenmrcoodopD lu o s texr(r oo1lpenmivt ()s2rmxmpoo0tltnmi3tys m2ul(vpn(4aleniociotomtrli s t  eur(o iu1op e ictl( s2rr(r ;o4tptn fetatfm2eln p;u) ltrxocto1oaDr uvo ( trur(o nodllt lncs ( srtaxrpoo4opto f3iaslmDulumo;(0arenxr3iytlptr u ols sexrxm3nydam nmiet ( arururoou0tpt  oeiys s eluvp;()alxomf3tadfmD an s;t sexmxrpiy4al elivi () Durur nu0aexn i3iydlsDemumsnt)arenifctadfptr ivs;t)s2umir3ou1amte nvt sf 2tru o;o0alenmfctysla eluvo (4 reomo3oo1lptrlnei;t)s2xrxm ou4lpt mfcias a2rrumono4olxoifetas m2um( s u0arxrirciytfpteln i;( t2toimpiudoptnlnet s aDtmx o;u4ole ifeias m2eauvo u4 rtrmo3iotopte neol()teuoirpny1ll emnvta( s2tmx o;o1aex ioctas s elumo;(4tetrmrciy1oatrlieolt)trto(opiy4ll nlfcslsfs2tax pot0tetnioctytfaDeluvpnt4 etrmocootlmDraivs;() 2xm(mpnu4ll nmnvtls)sDur(r ot1alen feiadfaDel(mon(4tetnio3oydlpDrauvilt)tetoim oydaptemfcsltfa2um(mooo4tlxo oetldfa eanvp (0aetrmf ootfmt  ivs;t0sruoxmpiu4amen fetls)aDtrurp;o0tlxn ietls m umnmo u)alxnxr3oy1oaDe nvil(0srum(r ny1omenlfesasf Drr( oot1tet mo3iatlmDul(vo t0tleomr3ia1la eln i t)t2trxrpno4am n ict s)sDum(  nt1ole ifetltfmDulu on()trxnmf oa1fpD  ivo t0tetoirpoydll nmneilsfarraxm ;o4tex ifciys a ua(vsnu)trtnxfcoa1lp r u i ( trurxr3io1omte nvilt a2rmx  nu4ole  ocils s elnvsnt4 rxnmfciy1fpD an i t0texmxr nu1ll e ies (fsDrmxm oo1texn i3iasla ean p;(4texnir oytoa eai sls)t2tmxo3ou4apt  fesls a2umx ono4ope  feilt aDranmpn() eeomrcio1lp rai olt)texo(r3iy1lp emfetasfaDtaxrp;t0tpx ifctysls2um(mp (4texomociydlp  lneil( trtoxr nodllee iei () 2rax pou0opeomieiysfaDrm(mp u)alenxrcoa1fp rlieils0trumio ou4omte nciasfaDrm(  ot1tptomo3iltfm el(vs;()trxrmocoo1fpte neo;()sexoxo3iu1apeelncsat) 2rr( o;t4aetnmfctytfs uanmp u0arxoxocto1oat  n o;s)s2uo(opoodope mfci () 2rru  ot4oexo o3iadla2ulu p;t4aetrxfciy1fa  aieslt0srxmxo iy1optn nvias a2tmu  oo0tpe  ociad s ea( s;u0 rxrmocoodoatr ieol() 2tmxr3no1lleelfei sfsDra(rpou4tpxoif3iatlm rau o;u0 exrxocoodfptrauvols)truoxr iodomtelics (fsDumumoou1apx  o3ilsls ulumo (4 rxrmf iydom  aues s0 eurim3iy4lmtnlnesl( sDua(r no0altnmieiysfa um( p u4tltrio3tatomt  ieolt0 rxo(o3iy1opeemnci s) Dtrxrpoo1oexoifeiad s2emn snt0 etnmf3todopte ueo;t trtoxr oo1op e fvs (  rua(  nu4aleniociasls2rm(mo u4artnxr3oydop  anesls0t2toir3no1amtnlnetls srrmxr ;u4olenif3tlsls umn onu0 ltnmfcoytlmte neo;t trxr(r nodapt mfvilsf Dum(r nu4optnmietldfsDrlumo t) rxoxociydop eauvils0srtoxmpiodam  mnvslt s2uaurono0oleomictldfm ul(mp;u4 etrxo3iotlm eauvol()trtrxo io4lleelivs ()sDumx oot0tpt ii3iasfm2rmu o u4 rtoxr3iydopt aieo s) 2xrim oy4alee nvsatf rrrumono0tpe  ictlt m umuvpnt0aeeoio tadlmD aneo (0 exmxrpiy4om nmictat)a2trur no0opxo oeiys a rlumo;(4areoifcoodlm  aneo;(0t2tmirpiu4ap  mfesa( aruau  no0aptoif3tydlsDeaump;t0artomr3oytomteli slt0 2tmxm oo1alee nvt (f Draxmont1optnif3iadlm ul(von() lxrxf3oydfmteluvi;s truo(r ny1ale mivsa(  2umx  nu0tptoiictltfm eaumpn(4tlxrxr3oa1opt  ieo;s0trxrxmpnydopeemietls  2urx pnu1tlxomictad m2uauvonu0tetnircio1oa r i o s)seuo(m nudopt liciltfarur(ronu4texnmiciydfa ul( snt0 exoxr3tytfaDraies t)texmxr3ou1lmtn iesltfs2tmxmpnu4ale  feildfa2uln sn() reoxfcta1fm e nei;t)srurxr oo4om nmnctat sDurxroou0oexnmf3iatlm ua( onu) etoxo3ia1fat  i ols) 2umxmpou4lm e fvtat srtm( p;t1tleo i3iadfa rlnmo ()treoircta1om raneo;s)trxrio ny4ll nmfeils) rumxm ;u1apxnmieiadlm2ua(vs;u)trxrxo3to1fmD lieslt)setmxm3ou4ol nmivi t sDuau ooo1tpt  fcilt a uluvp t0alenir3ty1laD  ies s) ruoiopoydap e ictatfarurur ot4tltn feiat aDem(vo t0tlxoir todoatr uvil()s2tm(rpnudlle mfeslt a2rrurpou0aptnii3iat mDelnmp;(0 lxrxf oydfp  li sl( setrxr oy1lme micsat srra(roou1altnmoeiat s2rau s t4tetrmo3totoa   ivolt  eumxr3nu1aleelfvsat  rtru pou1oeeniieils s2um( pnu4 etnxf3to1lat au s;t0trtoxmpoo4optn ivil(  2rmx onu4tleniiciytlm2ranmo ()aeeomrcoadfmDeli s t)trtrim iodaptnmnvsasf rumu p;u0tetomoetat s2ra(vpnt0aeermo oytlaD aneolt0seuoimpoy4lp  lfvi (  rtr(m nt4olxomocildlm em(vonu0arenio3iodfm   uvo t  2urxo oudll nmnes s a2tr(r ;o4tlt io3tytlaDul(mo (0trxnifcoytfpD li sls)seumxr3ny1ape mncia() Dtaxronu4tpxnmietad s uan s;()treoifcto1lmt anvo;s trumir nydomee ieils)aDta( pnu1tpeomo3tatfmDemump;u4 eeomr iy1oateluvi;s srxo(rpnydapenlfvtltfsrua(rp;t0alenmfeiltfs2ranvsnt4alxoif3ta1oaD ln s (  rto(r no1aptnlicias)arumurpnu4apxnmocilsfa rlumo t)aexnir3oydfaDran o;t0tetm(r iudlltemiesls)arurxro;t0oleomfctad s ulumpnu0 eenxo oy1omDrlivi s0 rtmio3oudoptn nvtas a2rr( o;t4apx if3tatfmDua(msnt)trenxo to1faD  neol()s2uoxm io1oltemfeta( a2umxm ;u0oexoif3iltlsDea(mp u0artnxo iatfpD  uvi;s s2xo(m oo1ll elieia(f Dtm(monu1open iciyslm2ea(vsnu0arxrxrcoadomteli ol(0s2urir3nu1op   fesa( artrxrooo4apx mieiad a rmnmsnu0 rtnmr3ia1opDr n ilt srur(opnodlp  micsa() 2ua(mpnu0oexoif3tytlm2ranvo;t4trxomo oadopD  uvo t) 2xrim3oydll n fvil(fa2taxm oo0opx iociyslaDrlu s u)altomf3oy1omD au o;t  rxrxm3iydopeelivi t  Draxm ;u1tltoiociaslm eanvs u0 renxf3ootlate nvsls0t2urxm3oy4oleemicslt aDtr( poo4aexo oeiytfs2ulnmonu0 exrif to1fmD  u ol() rtoim io1amee fcsl(farum(mpoo1oleo ieilslmDulu pnu0 rxrxf oadla  li i;()texo(r3io4amenmnctlt)arraump;t0oltomo3iysfa rm( o;(4trenmrcoodlm  aivil()s2urirpoydllt mfct (f rtau ont0aee  fetltfs2rmu pn()tetoif3iytfat lu o t0teum(m3nu4om e nesl() rraxr ot1oleomieiatfs rl(vp t4treoiocoadomDeauvslt0truoxmpio4optnmfciatfsrua(rp;t1tlt mictyt s2ranvsnu4areomo ty1fa   uei ( trtrxm nu1apeelicsas) 2rmx ont1tetnmo3tas a2ul( p;u)teeomf iy1fmDeluei ()tetrim3oodom   fciltfarrru p;o0aexoiictasfaDulu p t4tlxnircoadoateli o;(0 rtr(opnydlmenlfviasfs2um(mpot4aptniictytla eauvpn()teenmf io1fm raieilt0seumir oo1apt  nvt s aDtmu  ;u4tpt mf3ildfmDeauvpnu)treoio3oydfatrauvs () exmio3ou1ope mnvs s)sDtm( pot0olt micilsfs el(mo;()tleomo3iatlaDrln s;(0 2to(o3nydlptnmieia()aDtrxmo;u1tptn i3iadlm um( pn(4arxrmo ta1lp elueilt) etm(m3iy4omtn nct ()sDumu pno0teeoii3ilsla2emnvp t0 lxrmo oo1oaDranvols  exm(r nodol nlnctlt srumxroot4tptnmociyt a rm(vo;t)tetrmo3oadfa r uvo;t0 etr(r3io1om n fes s)a2rrum ;o4olxnio3ilsfs2rmn o;(0aeenmr3ta1fa r ues t s2xr(o3ny1omt  ncils) rumx oou4olto ietytlmDrm( p;(4trxrmr3iotfpt au s;s  ruoxo iydlptnmncia( aDurxrpno0olt mieiat a uau p;(0aeermfcia1op ean sl( s2urxrpnudalen ictlt aDraur ;o4ale  oetysls2eaump t4 etnxf3iadlm raies s0 2urim oydal   ictas)arua(  nu4olx  ociydfm ea(mp;(0 ltomfcoa1fatrlnvsls0 2xrxo iy1oltemfcsl( srtrx o;o0oetomieilsfs2ra(msnt4 lxnio3iatfa  ln ol(0 etmxopoo4lptelies s  2rmxmpnu4tet  o3iytls ua( s t)arenxocoydopD aneo s) rtrim3ny4alenmnvil()aDtr(m ;t1apenmfctad s uau ont0teerioctydfat aivs;( srtmxm iu1omeelicslt)srumxm oo4ope  fetlslm2rlnvs t4tltoif3iodlpt aiei ()s2triopio4om n icsat srrmum nt1apxomfctlsfmDranvon() renxf3tatfmtrauvs;( t2trir3oudol emneslsfsDtr(r ;u0oetnmi3iasfa elnvp u4 etnio3ootoa  luvsl()sexo(opny1optelicilt arrr(  nt4tet miciydfa umuvont)trerif3oadop elu i;t)srtoio3oodoptnmicias)aDtaum oo1alt  o3iyt s2emnmont)alenmfciodfa r uvil(0setm(o iy4al emictl(fsrtrurooo0ale ii3iyt sDuauvo;t4 etomf iotfmDelnvilt)sexr(r oudalen nvtlt)a2rax  no0tlt ii3tyt m2ul(vp;u) exnif3oa1la  aues;( seuo(o ou1lm  mictl( aDuaxrpot4tptomoctydfmDrmu pnu) eeoxf ia1fatrluei s0s2ur(opiy1al nmfesat s2uau ono1oex moetadfs emn s u0trtomf3oadfmt lies (0t2xoimpio4lpen ictls) rrrx  nu0tet if3ildlm uau pn(4trxoif3oodlp eanvs t)texo(r3iy4ome  ivs t s2raum ;o0altniieiys a2em( p;u4 lxnxr3oo1op rln ils0s2urxmpnu1ol nlneslsfs2tmur oo0tpxnmi3tldla elnms ()aeerio tytlp elnvi;()srxmxo oy4ap  mnvtasf 2tmxrpoo1tetnmi3iasfm ulnvo;u4 lxnmrcoy1lp  au o;s)seumxmpnu1lpenlfvsltf 2rm(rooo1ale moeiasls2ra(vsn()trerioctotfpD auesl()texmxmpno1lp  mfei s s2um(r ;t1alxoiieiyd s uln on(0arxrxo3ootfp  luvs;s)tetr(r nu1omeelncil()aDtaxm nt1olen fciyt m eanmpn(4altoio totfmt ai i;t  etrxo3iodomee fetas arrrxmpou4apx  o3tltls ra( snt4 ltrif3iatfmte iei ( tetriopiy1amtelnet (faDtm(mp;t4opx  f3tytfa emuvonu0arerirciodoa eauvs;(0setrxo oy4openmicia(fa2umxmoot4aeenif3tlsfmDelu p t4aeenmo3io1lpD aivil(0 rxoim nu1omtnmnvil()s2rmx  ot4oltomoeiltls2umnvs u) exomr3todop rln o t) euoiopio4llen ietas artmx  no1oltn fciltfm2ea( p;u0tlerif ty1oaDraivi s  etmio3oo1lp elicil(f 2umuroot0aee  f3iysfm rl(mp;() ltnmo3totoaDrln o;(0texmxr io4amenmivsl(fsrtmx o;o4aetomictyd a ra(von(4texrifctydlmD  ivs;t tetm(r3iodaltnmnet s) 2um(r nu1tpt  ociysfsDuan p (4trtrmo oytom eaivo t)s2xrirpiodlle mici t srur(r ;t1ole io3iydfsDranvp;u0arxomo3io1op e ivils) etrxr3oo4ll e fct sf Dtaum no1tpx io3iytfaDum(msnu4altrmf ta1op raivs s)s2xmxopoodlmt lfcs tfa2ra(m ot4apx moeias s rluvs () exrxf oytfpD  i s s)s2ur(o iy1ale  feils  2taumono1apxniictld mDrmumsnt0alerir3iadomt anvs s setrio ny1aleelfcilt)sDrr(m ;u4apeoioctyslaDuau o u4 exnmf3ootom r uvs (  rtoim no4lmtelnctasfaDrrurooo4teeniiciytfm2um( o;u0tleoif io1la   n i;s0sexr(m3iu1alt  iesas aDta(  ou4openif3iytlmDrlnvs t4 rtoio3oy1lpteaueo t trxoimpny4ame lfet t srrruront1tlx  feiydfa rau ont0 rermr3io1oa rauvols srxmxrpnydop nlivs t)sDra(rpoo4tptniietadlsDul(vo;u) eenifcoy1fat  ueo s0teurimpio4lptemicsa() rraxm ;u1aex mietltfsDrau s t)aeerxr3iadlm rai s;t) etrirpoydaltelnct tfarrax pno1aptoioeild m elnvp;u4trermocia1lmt  uvi t  rtrirpnu1omee ncsasfsDtmxmpnt4texnmieilt a eln s;u)tetnxf3oodfm   uvs;s setm(o3io4alt lfvils a2ua(mooo4apxn fetas s ra(mo u4tlenirctodom rai ils0seum(o oy1alt  fci t s2rr(mpot0aet  o3ils sDum(mont)texnxf3tatfat lnesls trxoimpiy1ale  neta() 2ur(rp;o0alen o3iaslm2ea( p;()texrxocoa1fat  n i;s0trxo(r3nydlmee netlt)sDuru  nt4tpt mf3ias mDelnmont0aleoxo iytfatr ivo (  2tmio3ny4llenlicil()a2rru oou1olxo ocildfa2rau s (0 rxoircty1omt anesls0trxoxopoy1lmt mfcs sfarrau poo0oleo f3tys aDuanms;t0texrircoatfa   uvols  etrim oodomtelfct t) Duax  nt4altomoetadls2um( p;t)aeeniocta1fa  auei;t0teumirpiu1op n fcsat)sDtmur no4aeen feildla2ul(vp u)aetnircoadfm e ivo t0t2toimpiodap nmies (faDtau o;o1apeo iciasfa2ulu p ()aeeoir3to1lpDeaneol( srumim ny4lmtnmfct t arrax ooo1aetnif3tldlaDelnmo (4arxrir oa1fp   i o s)t2xr(o oo1apenlnet s  Duau ooo1ole ioetas mDrm( snu0aeenircty1latrln sl( t2xoxo nu1opeelfvsl() rrr(m ou4tltn o3tldlm rauvs;() eerir ta1lm  an ilt)srxoxm oo4lmtnlicil(  2trx  no4aee mo3tytfs2umnmp;u0aexrmf3iatfa  luvs t)seuoimpnu4llt  fetatf 2uaxr oo0oetomietldfa um(vpnu4 renio3ta1fpt  i il()trto(o nu1apt lneta(fsrtau ont1teeomfeildlm eaumpn(4trerxo tytfptr i s t  2xm(r3iydopte fcs (  rtax ooo1tpxomf3iyt s rluvo t4alxoif ootoate u i;t) rto(o ou4ope  iesl()srtrxrono4alenii3iydfa rmuvs;u0 lxnmf3oy1lm rlivols)t2xmir3io4opee ict (farumxrpnt0tpx iicils m eauvonu0trxnxo3oy1oa ean sls) rxoxr nu1ameelfet ( a2umu oou1apt ii3iydfmDul(von() lxrxo totfp ean i;t0trto(mpoudoleemivi ()sDrr(m nt1aet mo3iysfaDrlums;u4tlxomo3ootopDeai i (0 rtoxo no4lpe lnvtls  rtau ono4optoif3iatla raumpnt) rxomo3oadlmDelnei;t) 2uo(rpiudllt lnvtlsfs2taxmpoo0tpxnmi3iltls2rlnvo;u) leoir3tatlate ivs;s0 2xrxopiy1apee icsas)arrrurpoo1alxomieild a2uln snt)areriocoytomt  uei s)srtrir nu4optnmnvias s2rrump;o1opt ii3tltfaDua(ms u4teeomf oytomDr u i;t  rtrxrpoodam n fesl(fs2tmxroou4tlt  o3iatfm2rluvsn(0 eermfctydfa eanes ()t2xrir no1apen fetlt  rtr(mpnu4opeoioetlsla2rmu s;u)tetoir oatlp rli s t  etmir3iydlpte fetlt)s2uaum nt1tlxnifciadfs2uanvont)texrxr3totfaDraies s)texo(m oodolenlfvtat) Dua(rpnt4aeeomieiadlmDrluvo u0tetrirctatlmte iei (0srxmxr3no4ap elfvi sf Dumx  ;o1alxoifciydfmDemn ont)trtnxf tatoa r n o ( tetmxo nu1lmtnmicil( a2ur( ooo4tlxomicildfs2ulump (0tlxnmocoydfpt  nesls)srtmxopoydom emics tfsrraur ;t1opxnmieils sDum( ont0tlerxrcia1fpteauvsl()tetrxm no1omenlivtl(farrru o;t0texnio3iys a2rm( p t4altnmo ootla eanesl(0trtoxo no1amen ncils)aDrrumono1oltn oeiat m2rmu o;t0tltomfcty1fp raieol() eumiopoy1ll nlicsa(  rtr(  nt1teeomieiasfm umnvpn()tleoircootfp  lies s) 2triopou1lpenlncsatfa2tau p;u0apxoiieild s2em(msnu4 rtnmr ta1lmD ai s;( sruoxrpoydoptemnvsa() rtax  ;t1aeeomfcildlm2ea( o t4 leomo oytfm  lues;() rtr(r oudame lneils s2rrx poo0ale iietadls elu s;(4 lerifciytlm r ivil(  2toim oudlltnlfes (faDrmxr nt0oltnmfciydlm rmn sn(0texnxr totlp rai i;( t2xo(m3nu1al n ivta( sDua(r ;u4tpt mf3ildlm umnmo u)artnmoctotla  luvi;t  eurxopno1ap   ieia()sDrmu p;t1oleoif3ild mDulnmsnu)areoifctatomt  iei t srxrxo3iy1amt  nes s)s2umxrono4oet  f3tat s2ua(vp;u0aeenif3oatfatr i o;(0t2urxr3no1alt  icta() Dtax  no4tpt  i3iad s2rm( s;(4alermr iydfp ranes;s  2uoio iy1amt mnctas artrxm nu4tpenmoeiadfa ranmpn(0tlxoxr ia1oa eli s (0srumxmpiu1ap   neiltfsDurx pnu4tpen fciysfa eanmp;t)trerxo3to1fat  ieo t)srtoxr3iu4ape  nci s  Draxmpoo4aee mo3ildfa2uau snu4trxnxo3oadlaDeli s t t2umxr3iodop n iciatfarra(mo;u1teeo o3iys a2eluvsnt4 lenxr3tatfmt  n o (  rtoio oy4altnmivtatfarrmxm ot4aptniieildla2eluvs;(0trxrio iodfat lnvi;() rtm(o no4lpenmiesls  2rax ono1ole ioeiltfaDul(vp t4aexnir3iotfmD  nes t)srtoirpnu1lm  lfvsasfsDur(mpno0apxomietldls ua(mp;(4 lxomf3oydoatr i o;( t2xr(m3n
\ No newline at end of file
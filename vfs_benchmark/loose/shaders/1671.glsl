@@ -0,0 +1 @@
+ivolt0s2xm(mpiu4omee ivi s)arrr( ooo4tle ioetatls rlums;()trtrxo iodomD  nvilt0texrxm oydoptemnetlsf rrmur oo0opeomfciytfa2rlump;() etnxf io1fmDe n s;s sexrxmpiudapenmici (fartaumoou1tptnifciatlm2rluvp u) eermf oy1opt livslt)t2toiopny4llt mivias)srraxmpno0tpe  feildfm emnvpn(4 ltnxoctydopD  i s t0 2tmxr3ny1ap  liesa()a2rmxrpoo0aptoiieiasls2emu p u)alerif3ootoaD  i olt)srumim3oy1amt lfvsl(  Dta(r oo0optnmf3tlsla ean sn(0 rtnio todom r nesls0srtmimpiy4op  liei (fs2taxr ;u4opxo ietyd sDumu pnu4tltrmr3oy1omtr nvols) 2tr(r3io1olt lncil(fsrumxm ;u4tet  oeils sDel(vont0tlxnxo3iadoaD  nvs s)srtrxm3oodll emfvtat) 2rmurpnt1tlxniociyt m el(mp;t0trxnxocoadlp rau s;t)trumim3nu4opt licias srurxronu1oetn i3ilsfa rlnmonu)tlenifciydfpD li i;(0setrxrpio1optnlnet t  rtr(mo;t1altnmoctltls2ul(msn(4aetnirciytoateliesl( seuoir3iydopeemnet ()srrr(m ou4alxnmo3iadfaDumumpnu0aeeoxrctadlp eanvi (0s2urirpou1al nmivt sfsrur(m oo0optn o3tas s2eau o;t0arerxf iatla rlnvi t) 2uoio3no4lltn icsa()a2ur(ro;o4oltn i3tyslmDean pnt0alenmr iotoatelueo;t srumxrpno1llte fvtat)a2umurp;o1tex  fctatfm2uanmp (0tlenif io1la   uesl() rxrxmpoudameelfeils)aDumur ;u1tet  ieiad aDran o;t4 etrir totop rli s t sexoirpno1llt mfesas srtaxrooo1tle  o3tas sDua(vp;(0alermocoydoaD au o s seum(o oy1aleemiet ()a2umur ;u0optnmictld mDelnvo t0alxnxfcta1oaDrlivi (0trurxmpoy4altelfeilt  Draxrp;o0oleoiocilslm ranmp;()tlxrxf3totom  anes;s  rxoio3nu1lptelfci t)srtm( o;u4oetniicilslaDelump;()tlenif3ta1fmDr uvi t)t2xr(mpiy1op emncilsf rtmxr ;u4tlt mictasls2uluvs;()teeoxr3todoaDeaneo t0 2xmir3nu1ol emicia()sDua(rp;u1openmietyt sDeluvo t0tetnio iy1lmDelies;t t2xmxo3io1olt mici s) 2tr(mo;t0apxomoctatlm rm(vs;t)arxomfciytlmt  u s (0srxoirpiudaleelietltfartaum ;u1tltnioctyt m2emu onu4altnxr oodomt  iesl( s2umxr nu1amtelivil() rumx p;u1opxomf3tat sDuluvo;t0tlxomociadomtr nvi (0srxmimpny4al  mivslsf Drr(mo;t4oetnifciltlsDemnmo u0teenif3oadop  aueils)trxrxo nydop  lfcs s)srtaxrpou1oex  feildfs ulnvo ()trxriocoy1oat  uvsls texrimpnudame  ivi t)a2tr(m no4aleoifeiytls2uln pnt) lermo3oy1omD  u ol(0sexmio3iy4ol emiesatf rtrurooo4aetnioeiat sDrmums t4artrxr tatoaD livolt)t2xrxrpnu4oltn nci t aDuau ooo4altn oeiytlm rm( p t0trxrmr3tydomtrlu s t)texrxm3iodopt  ivt t)aDrr(m oo0oet mfcias mDeauvo t4 ltrmfcta1op e u s;s0s2xrxrpoo4opt lictls) rrrxmpno4teeo ictls a rm(msn()teenmoctotlmDeaiei;( tetoxr iy1omtn ieil(fs2tauro;t0tpt ifeiyt a ea(vsnt0tltnircoatlpteln ilt)setriopno1llt lfci t aDrrxm ot1olxn fcilsfs em( s (0artrmr iotoptr n o t s2xoir iydap  lfeslt  2ra(rpnt4aex ifetas s2ulums (0aexrif tadlatelu sls  rxo(opoydlmenmiesltfaruaxm ;u4oeto ocils m2uln o;t0texoif todfat  ivs;()trtr(rpiodalenlietas  rurxrp;t0olxomi3tydlsDrm( p t4tleomociodopte uvo;t)tetm(o3nodolt  ncilt)aDuaxrp;t1olxoiicils a2ea(vo;u0 exomf tatom  aueo t0 rurxrpny1lmt mfcs sf rtax ont0apxnifeiadfaDrmuvp t0aetnxr3tydfp  ai ols0 etmxrpnodamtelfvsls s2uaxmoou1tpeo o3tatlm ea(vpnt)aeerifcoadoaD lieo;t)s2ur(opoudapeelnet t sDumumpot0alenmi3iatla umnvs u4tltnio oo1lmteliei t0trumxrpiu4olenlnei ( a2um(m ot1aeeomieils aDulnvs u0alxnmfciytom e ueo t0 ruoirpoudamee nctatfsrrm(mpnt0optoifcildlsDuau on()areoxrcia1lpt  n o ( s2toxm iy1lmtemfciltfaDrm(mo;u1oetoifctyd aDua(mont)aetoxf3oodfp   uei t) eurir oo4llt  fvt sfa2ururo;t1tee ifeilsfaDuau s u0 rermf3tatfaDelueo;s trxmio ny4llen fcta(farrruronu4tlxnmf3ils s2ul(mpn(4trxnif3ia1oaDrlu ils)t2tmimpoodaltn ivia(farrr( oou1tlt  fciydlm emn onu)aeerio3ta1fp rluvsls) ruoimpoy1ap nlnvsl(fs2rrumpot1alt iieiytlaDrlump u)tltoxo3ta1lpDe n o;(0 rtoxm no1amtn ieil( s2rrxroot0aexnii3tyt sDuln s;t0arerif3todlpD  nei t s2toio3io4olte fet ()s2tmxmp;u0opt  ietytla ranvs u)trenxr iy1oaD  uvslt)trtr(opou4op elicsat)sDua(ro;o0aee iictysfs uanvo t)tlxnmr3ty1faD  iei;( t2uo(m3oy4ome livsl()sDrmu poo0oeenii3tlslmDem(vonu0 exnxocoodfa  livi t0s2tmxm3iu4llt  neia(faDrr(  no4ole mieias a eluvp;u0tlxrmo3oodlp rai o t0 rurirpiydopeemfctl(f 2rr(mpoo1aptoioetydlm2umnvo;u0aetoir totlpDr neol()srxoxm3iy4apeemivias)a2ur(m ou4olxn o3iasfaDua(von(0 ltomf3iytopt  iei;s t2umir3io4lp eliet tf ruax  oo4alenmfeiysls rm( p u0aetoif3iadom r nvs;( t2xm(o3ou1al nmncsatf 2tm(ro;o0tltnmoeiatfmDua( o;t) exoxf3oytfm r u i;t)sexoimpio1lpe mfviat s2ua(roou4apenifetytfa2ul(mont4aetoirciytla eli s (  ruoxm3oodaptelnvsatf Drax ooo0olt  fcildlm2ranmo;(4trtomoctotfa raivi;(0 rtr(mpoo4om  lnet t aDumu o;u4alx mfeilsfs2eanms t0alxnmf ootlatr ieols0teto(mpio1lp nmnct tf rrrx  nt1olenmoeilslsDemnvont)tetnioctydoaD lueilt)trxrir iy4lpt mncslsf rrr(m ou1teto octls aDean p;(0 eerio tytoatran i;s) etoio nu4lp  lnetat a2urxmpoo1aleoioeiltfaDuanvsn(4artomo tydoa r nvo s s2xm(o iy4opeemfeiat sDtau  ot1apt  i3tls a2em(ms;t)aeenmf tatlp ranvo;(  2ur(mpno1am  lnvslt  2rm(m ;o4olt  ociytlaDem(vpnu4 rxrmfciydlpD  n o;s)sexmxmpno4aptemneiat) rtrxro;o0opeomf3iatfmDuan p u)teeoxrcoadlaDe i sl( teuo(mpiudomeelfetlt srtm(mpnu0tpen i3ilslmDul( sn() rxoioctatlatrluvs;( s2xrxo iodal e nvs ()s2raxmont0tptn fcildfm raums;(0teermo oytlptr uei;(  ruoxrpnodll e ics ( srumumonu1tptoif3tydlsDelnms;t0alxoxo oatfaD  neols t2tmir3oy4lmeemivta( sDrr(root1tltnmf3tlt s2ulu snt)tltrxocoo1faD  ivi t sexmio iodlmt mfcs t  2trxr ;o0ape mo3tydla2elnvsnu4 reomoctadlmt ln ol(  2uoxmpno1ole  ivslt)s2rrur ;o4opx  oeils m2umu snu0trtoio3oydfp rauvolt s2tm(mpoo4ame mnvt ()s2um(  no4apxomf3iad m uanvs;u4tlxnxf3oydomte i s;t t2urxr io1optemicil(f rtr(r no1alto i3taslsDrm(mon(0altrmf iydomteln ol(  rxoir iodolt  ivt t arurumooo0texnmoetyd a em(ms;() eerio iatfp rlneo s0t2uo(r iy1lp nmnesasfaDuau pno4apeoif3ilsla2um( s (0trtoiocio1fa rlnei s0teumxm3ou1lme lfvi (fsDrrxrpoo4tpeo fctas sDran s u4 reoifcto1lpt  n olt) rtrxo iy4omte neias) Dumx poo1ole  oeiltfm uauvont0tlenxf totlpt  ivo;t0seuo(m ou1lpeemneil() 2rr(  nt0apxnmo3ilt m2rmu p t0 rxnmr3iydopt  nvo s trurxopio1lp   ncilsfa2um( p;t0apxn iciytfm2emu p ()tlxnif ia1fptranei;(0truoimpny4op nlfctl(f Dra(m oo0alenioeilsfm2el(ms;t)altoxr todomtrauvil( seuoirpny4am  lnvilsfaDrrxmpnu0oeeoio3tasfaDulu s t4 etnifctodom rlu s;s0texr(r3oy4llee iesa(fsrtr(mono1apeo oeiyt mDea(mon(4texrircoydoa r nvi;t s2toiopiudopenmfesa(faDtaum ;o0olto fetadla2rmnmont4texnmrciotfpt anvs (0sruoxmpoodam   feia(fa2urxr ;o4tpxn iciadlm rau snu4areoirciodopD anvo;s s2xmxopoo4alt  fei s)a2rmur nu1oet moeiadls uau s;t0 lerio3tydlpD luvi;s) 2urim3oodalee fvtas  ruaxmoou0apx mi3ilslm2rlnmsnt4 exnmf3totfpDraivslt texoxr3nodomee ieil(fartrumpot1tlenmfeiydlm2um(vonu0 renmr iydlp   neols  eto(m3oo4al emnesa(f rrmxr oo4optomf3tlsfs2rauvonu4trenifcoodoatelnvs;s)texm(o nydameemfetls) Dtrxr no4altomo3iadfmDrl(von()artoir iytfp eanvo (0 ruoxm3oo1open nei sfsDtau onu0aex moeiltlm2elnmp;u)aetnxr oadfa elues;s  2xm(m nodomte nvias) rtmum ;t4texoii3ilsla ulump;(4 lerirciadfat luvi t s2xoxmpou4ame  ietat) Dur( ooo1aetomoetlt sDeauvon(4teeriociy1fmtran ol(0s2toxopno4op elicia(  rumump;o1tetn f3tytlm ranmp;()tetnmfctodoa ranes t0texm(o nodam n ieiasf 2tauro;u0oexoioeiysfsDul(vs ()aexoxfcia1oa   ivi (0 exmxrpno1altelfvs () rraxmpno0tpxo feildfa2ra( ont)altoxociatoa  au o (0 2uoxmpoy4omt  fvt t a2umxr ou1tptoiieiytfm2ua(vp u0 etoiociodop eliei t tetmxo nu1lp  lfvtlt s2raurpoo0oexomociydlm rmumo u4alerirctatfpD  ueo (  2toio3io1olenlfvs s)a2ta(rpoo4alxo oetld m umnmonu0aexomrctydoa elieol( setrio3nu1ole  net (  rrmumo;t0alxn ictltla rl( p t4arerio3iydoat aneo (0 rtm(opoy4aptn fcil() Dumumpou0texniietas sDeanvo t4artoir3tatfaDe n il(  rtr(rpio1alt mfvsls s2rrur ot4aleoioctldfs em(ms (0texnxf3iatopDrauvo (0 euoxr3no4lpe mfei s aDurxmoou4ape iociyt a eluvsnu) eeomociodom   i s;s0 eto(r no1lm emicils s2tr(rp;u4alx mf3tytfa ea(mpn() ltnio tatfp r ueils0 ruo(rpio1lmeemncias srumxmpnt4oex mo3ias m2emumo (0 ltrmf3oo1om ran sl()trxmxr3no1lmtnmfvta()sDuaxmoot0olxoio3tatls elnvsnu4aetnmrctydlmDelies;( srtrio3oo1ome lncias a2uaxm ;o0oetomoetytlmDra( o;u4 rtoio ta1fa   uei;(0sexmio3ou1ame lnvias aDrrxrono1tex iieiasla uau s ()alxomr oo1fpD ln s;t0texoxm3ou4am elnct (f 2tr(r ot0olxomoeiys s2rm( s ()treomf ia1faDr neo s  exoxr3oy4lmen nvi s s2trx  oo0ape iictldfa2rmu pnt) reoir oydlaDe ies;(0 2xrim nydlm emnciasf Drmx oou1alto f3iltla ulu p;(4 etrirctodfa  auvsls0s2trimpiudlmt  nvi t)a2ur( pou0oleniiciatla2ea( onu)teerxo ia1laD ln sls0trur(r3ou4apeemivsa(  rta( pnu4tlxomf3ilsfs2ea(vp;() rtnifciotlmte nvo s) 2xr(r3iu4am  mivtas  2trxront4apeoifeiyd mDuanms ()tlerio ootlp   u o;t) rxmio3ny4apee neil(fsrtmxr ;o0tee ifeiytfa2ranvpnt4alenxf3oydlm elivilt) rxmir3iu4lmt lnct ( s2ra(mp;t1oee iietysfm2uauvo;(4 eeoxr3iatomteluvils0t2urxmpno4lltn iei s)a2taumpou0oeeomieiatfmDumumsn(4 rerxociatomD anes t)srum(r3iodomen ict tfarua(mo;u4aeeniociyd s2emn p u4altnmocoodomtr n s (0srtm(mpio1ol   fetas arrr(mp;t4aet mf3iytfs2el(mo;u) rxoxo3oydfm  lnvo () rtoxr iodlltnmfviasf 2tm(  no1tpxomi3iatfm emuvo;()aetrmo ootfpt  nvils  rum(rpiydom  lfvs s) Drmx o;u1aetniocilt s ea(vp;t)tltnmf ia1opD anvols  rxoxo3iydam  livilt)aDtrurono0apxnmieiatfs ulnmo t)alxomrciotom e uvsls s2uoxr io1omenmfesls srtmxrpno1ale mfciatlm2eluvs;t4tltoir3tydfpDeauvilt0 2umxopnodlptnmnvsl()srumum ou1oltn ociadlsDrmums () leoir iadlmtr uei;s0t2xoxrpou1lme lics s  2tm(rpnt1oex  ieiytlm ea(mpnt4tlxnifcoatom rli i;t)teuoir io4lltnlfcs (  Drm(rpnu1tpxnifciat a2uauvs;t0tltomf io1lm e i o t)tetr(o iy4om nlfcta() 2tr(rpou4tetoiieiltfaDeaums;(4aetoxfcootfaD aneo s0 rtrio3nu1aleemnei (fa2raumo;t4olxomfcilt sDua(msnu)aeenmfciatlmtrauvslt t2tm(opoy4lleelnctasfsrrmxrpnt0olxoifciysfsDumumpnu0aexrxfcoatfp  lneo;(0s2umirpoy1lmt  iviatfaDtaum ;o4ape moetatfm2rlump;()arxomf3iatlpDrauvslt0sexr(r3io4lmt lfei s) rtau ono0aetn o3tad a2ea(ms;u0artoifcoy1laDe ues;t) euo(m3oudapenmfcil(fsDrmum oo4teen ieiad aDem(vo t)trtoxr3oytlmDr iei;( srurim iodlp  lfvtlt  2ua(rpot4apxn ocilt m ulnvo (0arxrirctatlpD aies s) exrio oydlltelfvtls) rurumpoo4aeeoifetytfmDelu pnt) lenirciadlmDraies;t0 exr(m3ny1apt lnvsls) rtrump;t4altn i3tlsfs ulu s;t4tlxomo3oa1oatran o;t0sexoio nu1lleemfct ( aDtmxm nt4opx  o3iat s2rm(monu)altrmo iy1oaD  u o;s)srurimpio1lm nmneil(fa2umurooo4apx  ociad a em(vsnt)teenxocoa1lm e ies;t0t2toimpnu1lptnmieia(  Dtauro;o4oee ifciydfaDum(vp t4aetoir io1laDrln o;t0tetoimpoudolte nvtl(f Dum(m nu0tpxnmi3ias s2rlnvp;u4trtrmr ia1lpD  nvs ()setrir nu1ape mieiltfsrtm(rooo4aeen oetadfaDumuvp;(0 rxnio3iodoateauei;s0t2umiopoodlme mnct t a2uaur ;u1aeeomietatlm2uaumpn(4 lenmfcty1fp  lnvi;t) 2umxm3iodal   ivsa()aDua( o;u4tlen i3iytfaDrmn p u)tlenmfctydoatrlu i;t) etoxm oo1ol elfctatf Drruro;t4aee mietls a ranvpnt)trxrmrciodop  lnei t0 exoim3nydal emicslt)aDtaxr ;o4aleo fciadfs2uln snu0trxniocoatoatelu o ( teur(o oy4am e ici tfs2tr( pnu4aee  f3iltfs uluvo;t0aeenmr oa1fptelies;s) etrimpiu4am nmnesas)a2trxmp;o0tptnmieiysfm2eluvsn(4 rxnmfcty1lmDeluvo t0 rtrxo iu4lm  lfeia() 2tr(mo;o1tpeo oeiyd aDrau on()aleomociytopt  uvs t0setrimpnodope  fesls s2rmu pnu4oleomi3iltls2el(vo t)areriocoatomt aivo ()s2to(o ny1altn ivil()aDta(  nu1alt ifciytls ranvpn(4alenircoa1lptrli ol()s2toxr nu4lmeemivtls) Drmx ont0oleomf3tyd mDem(vo u)trermociotomte ieo;t)sexr(o oy1oleelnei s  rtmu  nt4texomietatfa2ra( o ()tlenxf ootoa eluvi ( tetm(o3iy4ap elivta()sDtaurp;u4opeoifeiadfs umu snu)trtrir3oodlmt an o s0 2xm(m3iudalt lncsas)aDtmumono1aptnioeiadfs2emnmp;(0trerxr oydop  an i;t)trtrxo iu1llt lietl()aDur(mo;u0opxn fciydlmDeln s u0aleoif oa1la eai o s0srtrxopiydop  lfesl()sDumu  ;o0tetnifetydfa2rmnmpnt0texrif3oa1lm r uei;s)texoxm io4am e ivtltf ruaxmpnu4tltnmi3tldlaDuluvp;t0artomo3tadfpte u il(0 2ur(rpoo4lm emivilsfa2raxm nt1apx  feiad s2rau p;(4arxoxo3tatopDrluvs;(0trtrxopno1lmt lieilt) 2raxmpou1texniietatla rmumo t)tetoircoo1omtrln ols)s2trio io4om e fvs t s2taxmonu1olxoii3ilt m2emnvsnu0arenmrcoy1omtelivsls  etrxr3ny1openlfcias)srrmuroot0olxomociyt m2em(vsn() eeniocia1omD aivsls sexrimpiy1apenlici s) Drmx ont1ape ifciysfa ulu o;(4areoir iy1fp rlivo;s texm(r3ny1am  mics ( srur(mono0alx  feiytla eanms;t4 eerxocty1fptelnvol()srumxmpiy1ameelfcilsfsDta(r ;t0opxo f3tysfm uan s;(4 etoxr iytlmD aivi;s)s2toirpnodomt lfvt t) 2rmx pnt0tlx  fctyd mDrm( p (0teeoircta1fp  li s t  2xrimpiy1opeemfcsl()s2uaxmp;u0tpen f3iyt aDrluvpn(4 renio iytfpDr ueo;()setrxm3oy4ap e nvil(fa2rax oot0apx moetls mDuan p;t0aeenxrcoodlp rlnvi (0s2trio3io1opee ieiltfa2rm( poo0oexoioetldla umuvo u0arxomo iodfa eaivi;( t2xr(r no1ol  lneils aruaurpnt1altn o3tatls el( sn()arxrmr tytoaD  ivs;t trtoim3iy1lltn nvtls srtru pnt4ope ii3iadla2rm(vsnt0 ltrmo tatom r nes;s) etmxrpoudlp n nei tfs2uaurp;o0texn ocildla rm(vs;u4tetomf oatopt lieo s)setmiopnodapte feta(fa2tr(m nt4opeo fctadfa2um(vp;t) rxnmocia1fmDe nei;t  eumxm3nydap elneta(  rurxm ;t4oeen fetldfa2emnmo;u0 etomrcoatoa eln i t0t2xrir io1lm emnesas)aDraxro;o4tlxoif3tlsfmDuluvo ()artrif tadlatelueolt)t2um(r oydlp nliesat)arta(rp;t0aleoio3tadls2uauvs ()aetrxo3tytom  aneslt seum(o3no4amtn fcsas aDtr(m ot4olt mociyt s2rlums ()texrxr oadoa eliei;()t2urio ny4lmen ietl( a2raur ou4tptoiietldlm rm( ont0 rxnircty1optelieslt0t2tr(o3oo1ol   ncsl()artrxmoot4ape  i3iatlsDelums;(4 eeomo oydfp rlu i;s srtm(r3nu1alenlnctatf 2rr(r no1olx  ictytls rln snu0 rerxo oodlaDe nvo t)sexm(r3ny1ap  mivtat s2trxronu0apto fetadfsDuanmsn(4 exoxo3io1fmDeaieo;( trtm(o iu4lltelneta() Dtm(mpoo0opxnmf3iytfm2rauvsn() etrio3oodfm e u o t0 eurxm3iodlp nlfvsa(  2ra( pnt4aleoio3iatfsDumump t4tlermocoytlpte uei ()srxoio3ou4oltelict t srrr(mp;u1tetn f3ild m ra(vpnt)trxnmfctotom eluvs t  rxr(r3io1lmtemieiasfs2tm(m ;o4aptnifcildls2rlnmo;u0treomocty1lm   u o;t) rtm(m3no1altelncs ( a2tmx  nt4oeen i3tydfaDea( pnt4 eermo3oatfpDeau o;t  eto(mpoydopenlfvt t)a2taurpoo1apxoifeildlm2el( sn(0trtomociy1oaDe ivslt) euoimpoo1lm e ivia(f ruaurpou4tleomfeiasfa ra(mo;t)aeeoxociydfa e uvs;s)trxoxr3ou1oltemfcsa(fsrrru ont0apxn fctytla2ulnvo;t4tlerif3iatopDrluvo s)sexr(m oudlp n nctls)s2raxr ou4open ociad a2rmnvp t0 renmo ootfp rai o (0srumir no4ole  fetatfarumumono4teeoii3ildfs ran pnu0 eeomfciotomDr ivil(0texrio iudoleelieia(fs2tmur nu1ale iocias s ulnvs t4arermf3oy1lateanvol(0 eum(opnydlltelnctl(f Drru poo1oltoifctatlaDelnvpnu4 etnxfciytopDe ieo;( s2to(o no1am emfctlt  Dtrxrpoo1alenmociadlaDrln o;t)arxnxf tydomtranvi;( srxo(r oo4lmee fctltf Durxrp;t1aleoiocias s2ulnvs;t) eenxo to1lmtrln o (  exrir iydaptn fct s s2ta(mpnt1tleoiocild a rauvp t4tltrif iodfpDr ueol( sexoxrpiu1lptnlneil() rrax pot1tee ii3tyd s2uluvsnu0 leniocoadopD ln sls  etrxr3ou1om   iciatfarurxrpoo1teeoioctysls umnvon(0trxoxo totfpDraiei ()texoxo iy1ll  mivtls s2trxr ;o0tpt ioctldlm rm( onu) ltrmr tatom  livol(0 exmim3oo4apeelfvias s2uax pnt0tee ioctad a ua( ont)tetrxfciy1op  aivi;()s2trir no1opte ici t)arur(mpno4ole  feias s2rmuvp;(0tlxnxrciy1omte nes t  exmxmpiodopenliei t  rrrx  ou0tlx  ieild sDuanmp;(0artomr totopDeaiei;s)teuoxm iodlptnlivs t)aDurx pou1optniiciat mDrlumont4altrif3oadfm   nvi t  rxmxopoudlm nlfvta(f Drrxr ;t4tlxnmi3tatfs rauvs () eeoio3ta1omtr neil()trtr(r3oydlmt mfvias) 2rrxmo;u1optnmo3iytlm emn o;(0artnmrcoa1optraieo t0 etm(rpou1lptnlfvsl(faDuaumoot4apeomiciat s2eaumont0teeoxr3ia1fmtelueilt) rtoim nu1apt mfes (  Dtrurp;u1aexnio3ildfa umu o u4 rtrxo iotfp r uvolt)t2tmir iu1lpt  icslt) 2ra(rpou4apxnio3tatfm rm( p t)tetoxf3iadom ranvo s)teuriopnudame mfcias)a2rmuroou4ope micilsla2ul(mp;() etrxo3oydlpDe nei ( s2xr(r io1am nlnes s)s2ta(ro;t4opxn oetad sDem(vp;u4 etrxr3tytoa   u ol() exrxr3nydomen nes t)aDtmumoot4tpe  iciytfs uan o (4altnxociy1oa rai slt  2xo(opiu4ope mfeiltfs2rr( pno4tlt iociasfsDeau s;u)trerxf todoa r i s (0t2um(r ny1am nlncilt)sDtmxmoot1tleoiietyd s rlumo u0aeeomrcto1la eln s;s) exm(opou4ll  lnvia() rrmum ou4teenifctysfm ulu p (4texnxo3to1la   nvi;s0srtrio io4lp  mivta( aDuax  oo1alxnioeiys sDea( s;(0 etrmrcto1opDe nes s t2xmio3nydopen feta( a2tm(m ou0opxnio3tytfa raums;t4artoir iy1omD  nei (0 2tmxrpio4lmeemicsltf Drr(rpou0texomoetat m2rlnms;t)texoxrciadfaDeau o s)trum(rpoy1lm  miet t)sDumx ooo0tlx  oetytfaDul(ms;t4 eenxf iydlmDelnvslt trxr(rpoy4lpt mfesl(fsDurxm no1optn i3ilt s raums u0aetoifcty1oaDrln s;t setrxo ou1altemics s)aDtmxrpot4apeo ieiyd m em(vp u0treoifciodoate ieslt)srumxo3ny1optn nei tfa2tmu  ;o1tex mo3ilt a eln snu0 rtoif oodlaDrau o;t0sruoxr nudole  feilt srum( onu1tptn o3ildls eaumon()tleomo tadla   ueo s) etmim nydal elfvt ()arumur ;u4olt  ocild s ea( s;t0areoxo io1lpt au ol() eur(opiy4olt  fcilt)srtmuronu4tpxoiieilt aDrauvs u0tlxnxf iy1fmt  i slt)s2xmxr nu4lmenlfvtas s2tmxrp;u1aexnio3ias m eaumsn(0aleomo3oy1lm   u o t  rtmir3oodapenmivs t)srrrxro;u4tpxnio3ils a umu o u0aexoif iotopD lu ilt seuo(m ny1lptelfvt ( a2tm( ont1oex  oeiydfm eluvs;(0 rxrir3iytomDe nvils trum(opio1lpeemietlsfs2tmumoot4tpenmociadfsDranvsnt4tetomo3todfa e iei t trtoxo3io1ape  nciatfa2rm(  nt4ope mf3tls m rm(vp;t) etoir3iotom rlueo t0seumxr3iodlmee nvsatfa2rruro;o0alxn iciydla2ra(vp u4trtnxrctodfpt an s s0 exr(o3iy1lmte iesatf Duru  ot4oexomicild a2ea(ms t0 renmr oodop rln i;( s2tmimpiu4ope  icils)s2rru ono1teeo ociad a2rlu s t0alxnxfcty1lp rliei;t  ruoxm3oy1am emivs s) rra( oot4tex  i3iyt a rl( sn(0artoxfcoo1fm   u i s) 2urim3iudlm e nes tf 2tmxrpot0tpxo octadfsDul(mo;()aexnircto1omt anvs s sruoim oo4op nlfcsa(  Drm( p;u0oleomietasla ea( o;t0alxoir3iadomt lieil()srtoxrpiu4op nmfvi sfarrr( oou0tlxnmfctld sDumnmpnt0tlenxo oadfpD ln ols0tetrxmpiu4omtemnet t a2rm( pnu0olxnmfciyd aDuau s (4trerio3iotlpDrlnvsls0s2xrir3iy1llte ies sfs2ua(mpno1ale mf3tlsla elumsnu4 rxnio3ia1fpDe uvs t  rxmirpio4al nlictlsfaDtr(rpoo0apt mieiytla2rmumsn()aetrmf iadlm   uvs s) 2xr(m io1am e nci s)srum(r ot0opeo feiyd mDrluvs;u4 renxfcta1fp ean i s)texoio3iu1ap   ncs s sDta(monu0tptn oeild sDea(vp;() exnir tatla rlivolt srumxr no4lpeelfcilt) rtrxmpnt4texn f3tlt sDelu o;t0 ltnxfcoy1oateliei;()trtr(opoo1lm e ics (  2rmx pou4aexoioeildlmDel(vo u)tltrxf iydom  li ols0t2tmxo iy4al nlictasfa2urump;t1tlenmoeias a2um(vs t0 exnmo oodoaDranei;t trtoxm nodlpte nesat s2uau  ot1tle ioeilslsDuan ont) lenxrciadlpt lu s s)srtoxopou4openmicslt)sDrr(mpno4tetomi3iyt s emn o;t0aetrxo3ta1la  aivil()t2to(opno1op nlnes s sDua( p;u4tet iociytla ra(mp u) eerxo3iadlp elueo;t s2trim3iydape livi ( a2rmump;o0tlx if3tysfm2em( p;()trxoio iy1fp rlnvilt)s2urxopoy4al elnesas sruaump;o1opxomietatfmDul( p;u) rtrmo iytfaD  ieil( texmxr iy1am emneils arra( pnu1aeeoii3tltlm2ulump;u)aleoxrcoydoa elieils0tetr(r3iu1amee fei tfaruaurp;o0tpx  ieias s2ea(vp ()tlxoio3io1lpDe nes;() eur(mpoy4apt miet ()artaur ;u4tpxniietad aDrl(vp;t) exrmoctodop   ueo s  2xoir oo1lpe  nvtltfs2ua(rpnt0oetnmf3iadlm2emu o;()arxrxo oodlmDr i ol()setmxo oo1llt mnvt ( srua(m nu0aeeo o3iydls el(vo t4altomf3oo1lpDrln o;(0s2toirpoydamt  fct () ruaxro;u1open f3iyt aDumn s ()aetnmf3tydlmD  neil()t2uoxm3nu1apeemfesls sDrmx pno4olxo ictydfs2rl(vs u4 ltoio3iytlpt au o t0teuo(m iu1alt  fciat arta(m nt0tex ioctld m2uanvs u0trtoxf io1fmDe n slt)trumir nu1amtelict sf 2tax o;u4tlxoioctadls2elnvo;t0 lermo3io1op rlu o s0 rtoio3oo4ol emieiatfsrraumpnu1apto oeiatfaDem(mo;() reomr oodfa raieol(0 2to(r iudopeelnvtas  2rm(ronu4oexoiietldlmDrm(vo;(4 rerif3totlp   ivol(0 rtoio no4amee ict ()sDrmxrpoo1alxoii3tyt s ea(vs (4tlxrxo iodlpD aieols tetrir3oy1ap emiei t) 2rm( o;t4tltn i3iadlsDrlnmp u) eerio iy1opDrluvo;s)s2uoim ny4lptemies s a2umum no4oee mfctysfm uauvs t4arxrxr3ootoa rai i ()texmir oo4lpe mfctasfarra( o;u1apeomf3iys s2rlumo;t4 renxo oo1laDrau o (0teuoxm oudoltnmieias)s2rrxmp;u1tltn fciyd m umums (0altnxr oatlmtr i o;t s2uo(r ny4lm  lfvs sfarrruro;u1optomfeiatfaDul(vs t) rxrircoadoaDrlieo t srumiopiu1lpen fct t  2tmxrpnu0olx mictldlm2ua(vp u0tlxrxo tydoa elivi s0srxoxr oy1openmncs tf Dtaumont4olx mi3iltla ulu s;u) exnmf3oatla eanvolt0 2tm(rpny1lp emiciasfaruaumpot4aetomieiat sDeln s (0 leoxo ootlmDraneil(0 2to(rpoo4om emivil(faDtaxm ;t4optn o3ils aDranms (4teermo io1fatr n i;t0 euoir ny4llenlneia( sDua(rp;t0aet mo3iyt aDrluvp () rtnxfctadoat li o t) etmxmpoy1lp e icils)aruau  no0opt  feilt sDulu o;t4alxrmr oadfate ivol(  rxoio nodlptelfeil( a2tmxmpnt1optn i3tlslaDua( o t) ltrxr iadlate ueo s seuoir iy4lme  ncsa( a2tm(mo;o4ape ifctydfsDemn ont0 ltnio3io1oa eaivsls  rurxr3nu1om n fcs s  rtaxrooo1apxo ociytls2eau s u4tetrmo3tadlaD lies;( srtoir nudoltnliesa(fsrrrurpou0olt  o3iysfa rl( s u0 etomoctadlptelueil(0tetr(r3iy1lptelncil(  Drmxm ;t4aetnioeiyt m ulumpn()tetnir iadlate u o t0t2xriopno4al n ietat)aDtmumooo4teeomfeiaslm2ra( o;u)altnifcoodfmDraneo;() rumxr3iudlp emivt tfa2taxmo;t4opxnmoeild m2um( s;t)arxrmfciadfmt lneilt)srtoxr3oo4omtemicils a2trur oo0oltn i3iltfs uauvp (4 etnmfcta1omDeauvs;()srxrim3oy1omenlfesl()aDur( poo1oltomfciydfm2emnvs;t4tetnir3oytlatrlivil()t2to(m3nu4lm  mfcs ()a2rmxrpot4oltnifciyt m2uanmp u4altrif tadopteli s s) 2uoxm nydopeelietasf 2ra( ooo0tltnifeilt m2rl(vs;() rtoxo3tatfm  anvils0 exmim ny1lpt lnctas)a2rr(mpou1opt  fctlslaDul( pnt4arxrir ia1latelivslt s2xrim3oy1am nmiesas a2ua(r ou0aexomieiasla2ra(mo (4 rxnxo3iotlp rli o t  2xmxrpoudol  lnet s)srrmumpnu0tleo fctlsla2el( s;t4tleomrctydom  au i ()srxrim3no1lltnlnvsl( s2ra( oot1altoifctlslm em( o u)trerir oa1fm rlnei t)t2uo(mpoo4optnliviatf rur(m nt0ape mo3tls sDrmumont)artoxf3ta1latelu o;s0seuo(m3nu1om nlivia(  2umxr nu0tlx iociad aDrmu p;(4arxomf oo1fm elivs s0srum(m3iy1optemieia()aDtmxrpot4oet iictytla ulnmo ()trtomrcoo1lpD lnvolt)s2urxmpno4llee fct sfartr(rp;t1oet mfciltls2eluvp;t)arxrxr iatop eaieslt)s2umxr3oodole lncsatfa2tm(r ;o4tle ifeiat sDuauvont)trtrioctotoa e n s ( texo(m3ou1omte fet s s2tauroot1oexnmfetyt aDrlnvs;t4teenircta1fp rlies;s0trumxrpoodom e nvtas) rraxrp;t0tpe  iciltfsDul( s ()alxrxrctytfpDe uvi;s0teuoxo io1lmenmictl() rta(rp;u4aexn fetydfs ua(ms t0alerxrciodoaDrlieils) 2um(o oudlmen nvi t)s2rmur ;u1opt  o3iltlmDraumo t0tlerxf3todla eaueolt0srxmiopnodol elncta(f 2tm(ront0openio3iltls rmnvs () rtoir3iadfmt  ivols)srxrxo3oo4ol elfvt s)s2tmumpou4oexnio3tltfm elnmp ()aleriocoatlaD aivo;t  rxmio io4omenmivs sfa2tm(ronu0opt iiciytls rmnvp;t)teerifciatlpteauvs s teurxrpoo4oleemieia( arumumpno0aeenifciysfa2um(vsnt0aeerxr oytlateauvolt tetm(o oo1olee nvsl(f 2rax pno1opxoifeilslm2em( s t)altnir iatfmDe ueol(0srxo(rpnydap   fesa() 2rr(moot1ope ifeiytlsDum(vp;t4texrmo ty1lpDrln o (0 rxr(o3nudamt  fvslt  2uax p;u1aetomociyt a2um(vpnu4 rtrxr3oy1lp  livo;t)trtm(r iydomeemfvia(f rrr(mo;o1tetomoeiatfs2rm(vp;() rxomo iodlat  nvi s srtmxm no1lpen ncilt s2umu ont4aexo fetyt m2ra(vs;t)arermo ia1fat au o;s0 eumxmpno4ap  mfci sfartrumoot0olt iocilsls2ean onu0aeerxr oydfp  lnes ()srxmxm3iydalen fesl(fsruaxmo;t4alx mo3iys a2rl( p;u4aexoir iotfaD lueils  2xm(mpnodap emictls  2rmxr ot4tlxo feias s2rln o t0areomr totfa rlu i t0srtoirpoydamen fvtlt) rumxr nu1tpx mo3iytfs2rmnvont4 rtrifctodomDe ueo s0trumim iy1alte iesl(fsrta(mono1tlxnmictlt s el(ms (4aeeoir iadoaDeai i s tetm(mpoy1alenmfesas) 2uaxmp;t0oet ifciatfa2ea(mpnu) ltrmo iytoptrlivi;t) 2uo(opoudame  iciltfarrm(m ;u0aee  fcias s2elu p;u4tltrxr oadlmDe nes;s0 exoim3iodll e ict s)a2rmu p;o1tpxomietytfs umnvp u0aetomfciotla   nvo;t)teum(mpoy4olt mfvtlt) rta( o;o4aptomfetas s rl(vp;t4 rtrmo iadoaDr uvils0seur(m3iy4llt lfvil(  2raurp;o0ope mi3iatfm2umu p;() etnxf3to1opDr i ils) etoxo3oo4ole lict s arrrxro;t4tpe mi3tatfsDelumon(0alermr3ta1omtr nes s0 exoxr io1lp  mivs t srtaum ot4tltomo3iadlsDemn o t)altoiociatoa elueslt  euoxm oo1ol emivt s)srtm(m ;o0opxoiiciyslaDuan onu)trtrio3iotfpt aneol(0 etr(r iudop nlfvtas)a2urxrpot4tptoiiciyd a2um(mo;t)aexrio3iy1fa e ivi s srurim3nu4lpeemfvtl(fa2rm( o;o0ale mfeiadla2elnvo t)alerio3iytfm elnei;t  rtm(o iudap  lfeia(f Dtr(rpot0tet mictatfa2ulums u0 rtoxocty1op  lieolt srxoxo iodomen fetas) Dtrur nu0optn i3iltlmDul(vs t4 reomf3iodfp raiesls) exoxrpoo1lmenlivia( arrrxroot0ole mo3ias sDum( s t4aeeomrcty1omDrlnvolt trxoxrpiydamee fcilt a2urum no0apt  fcilsfsDemuvpnt4teerio3iytlm   uvo s) rtrio oo1lpeemfvsatfsDumumo;u0tle  oetltfs2rm(mo;t0trxoir3oo1lpte u i t0setoxm3ou4lpen ivtasf 2tmumo;t4tlxo i3tytfa2rlump t4tlxoxo3iatoa e iei s)t2tmir io4ope  icils)aDtaxmp;o0opxniocildfaDrmuvpnt) reomr io1fp eaieo;s) rtoxr oy4alt mici (  2ra(r ou1aleomoetld a ra(von()arxoxo iatopt  n i;(0 rtmxo3iy1ole mfcslt)a2trum ou1texnmf3iyt aDuauvo t0artnmrcoo1optran ol(  rtmim nu1lp nlivi s  Draxr ;o4opeomfctatfaDumu p t)artrxrctatomD  uvil(0srtrim3oydam nlfvsat)s2trx oot4alxnif3iatfa2eluvp;(4texoio3to1la ran ilt)trtoio3io4altemivsl()a2rmumo;u4aexn oeiasfmDua(vpn() exrxf iotlmDrlneo t s2xrxrpny1lp nmneslt) Drmxmp;o4tleniocias s2ulnms;t4 rtrmocoa1lm eau i () eto(rpnudapte icta(  rrrum nt4texo o3ils mDrmnvp u)trtrmoctydfmDeluesl(0sexoxo3iy4lmtelnesa()a2rauront0alxnmo3iat a2uanvo;u)arxoxf oatlmD  nvo t sruo(m3iu1apeelnct s) 2ra(mono1tlt mieiltfm el(vpnu) ltnmocoydfat lnvi;(0trxo(opou4ol n nvsl(fa2tm(mpnt0teeoiociysfa ea(msnt0 lenmf3tydomtr i s;s t2xrim3iy1aleelnvsa() 2rrumpnt4teenii3iyd m2eln p;()aetrxr3ty1lpD lnvs s)teuriopoydame  fvt sfa2raurpoo0alxn ictat s ran ont)texnxf3ty1fm  ai i s srtoimpnodll elfci (faDtrxmo;t4teeoio3ildfsDrmnvs t4altomf3iatopDeaies s)s2xrxopno1om emncs (faDtrxm no0ole iieildfaDulnvp t0 etnif3oo1faDraneo;()trtmxmpiudll elicias a2ua(r oo0tlxn i3ils mDemu s;(4aetoxf3ty1lpt an o ( s2umim3iy4lmte nes (f Drm(ro;u1alxoiieiltfa ra(von() rtrifciotfa r uvils0texo(m3oo1omeemfeiatfsDurx  no1oleo ietadla emuvs;t) eenmo3oatoat lnvs;( s2xm(r3oy4lmeemicil()aDta(m nu1aetn f3tas a uanms t)alenxr oodomD  iei;t0seum(opnu1lm nmfvtlsfaDrmu pou1aexnmociat s emnvp;(4trtnir3io1lptrli s ()s2toxo3oudome  fci ()s2ur( pot4aexoifeiadlaDelnvo u)texoir3oodop ran s (  rumxo no1lmen ivs t s2ur(mono1oexniieiadlm2um(vo;(0trtomrcta1fp e ieols0 2uo(m ny1optemiei t a2umump;u4aleoiociys s2ulnmo (0areoxrcio1opt  n s s  2xmxopny4lp emnvsl( s2uaumo;t0opto o3iltls uaumsn(4 rtomr3iadfa  ln o;s)teur(mpnudlmt mnesa(fs2rmumooo4aexo f3tasla2emnvs;t0altomr iytom r neo t)s2xmxmpou1aptn iet tf 2rm(ro;u1ole  o3tytla ra( s;(4teeoirctytomDrlneilt sexoxm ou1lptemnetls) rrru  oo1tex mfctadfaDrl(mo;() rxrxo iy1lmDe u s t0trxm(r ny1am e fvta( arumxr nt4altoifetydla2ra(vo;t0 eerxocta1fptr nei;t)srxrio3no4ap e fctls)aDuaxmpoo4oexo ictlslsDuanvs;u) renif iadfpte uei;t)t2xmir ou4al e fet tfsrurumpot1tpx mf3ilt m2elnms u)tetomfcto1late i s (0t2urir iodom  lncia(fsrrru ont4oexomoeilslaDem(ms;t4 exrxr ty1oaDeaueo;( s2uoxr3no1llt lfcilt srrrum nu0oetnifciysla um(vpnu0alenmf3todlp  an sls0trurxo3iy1olenlnvs t) rtmurp;t0alx mo3iatfm rlumo t0arxnifciadfm  auei;s)s2xo(opiudolt  fvsl(f ruau  ;u4ale ioeiytfs2ua(vs;t)aexnxo iotomDe uei;()teuriopiu1omtnliei () 2tr( oou0tlxnifeiysfsDrmnvo (4 exoir3ta1oa  lieo;t) eto(opiudam nlnviat  Dra( o;u0tpe mf3tyd a ea( s;t0texrmfcoadfpD  u s s  rtrxm iodll nlnei s  2ra(mp;t0oet mfetyslm2umnvont0texomo3oy1oa rln ol( truoim oodale  nctat)srrmum no4oeeoifetysla em(mp;t0 leoxfcoodoptrlnei;s) 2xmimpiu1am  mfcslt)sDtrxro;u1tltnmo3iatfa uau pnu)texrxf ta1fpDrlieo;s  2ur(o oydll n ncslt  ruaum no4tle  f3tad m ea(ms;u4alxoircoy1laD lu ilt0t2urio3iu1ap   ietl()sDrm(m nu1aexoio3iys sDrlnvs u)teeoirctydfa eaueo t0tetoim oydole mfciasfarurxrpno4tee  ictldlm2eln pn(4teerxf ia1latrlnei;t  eurxr ny1lptemiet sfaDurumooo4alxo ieiadfa emnvs;()aetoiocty1lp raiei;(0teurxm ou4om  liesat sDtrumpno1aee ii3ilsfs ua(vsnt) etoio ty1oaDrliei s) 2toio ny1omeelfcsas)s2umxr ;o4oexo f3iasls rmu o;t4 leomocoodlm r neils t2uo(r nydlme mfei (  2urxr nu0apt iieiydlsDrl( p;(4artnxf oo1lmtrlnvs () rtmxo nudlptn neiat) Dumu oot1tee ifctlsfm uanvs (4trtrxo totla elnei;s sexoimpoydome miet sfsrtmxm nt4opxo ieiyt mDua(msn(0 lxnirctodlmt  i ilt)t2xrxrpoydamt lfvtlt  Dur(mpnt4aeeo octysfaDumnvp;(0 ltrir3tytomDr uei;t0t2xo(m iudlme mnvi sf rrrx p;o1altnmiciydls2uauvp u0 eenmr iatfp  lieols trxrxm3iy4lm n feil( sDuaxmo;o4apx mo3ilt aDulnmo;u0treomfcoatlm  livs ( teto(r oo1opt mfctl( aDtaxro;u4tltoiieias a2rl(mp u)tlerirciy1fmDeaivol(0seurxm io1ll nlneils s2tmxro;o1aetn oetas sDum(mo u4aeeomocoatfmt luvslt0s2ur(r3oudlmte fci sf rra(rpnt0oetnii3tlt s2emnmsnt4 eeoifcoa1fptr nvs;()seurxrpiy1lpe lnvtl( aruau  ;o4olt mfciatfs ulu s t)tetnmfcoo1fpt lnvs ()trxrio3ou4lm nmfetls)artru  oo4aeen feiyt m2rm(vo;(4aetoioctadop eauei;s0t2umimpiydalenmnviatf Dtmum ot1tlenii3iasfaDrl( p t)treoir oo1lmteaues;s0trurir no1lp  mictls aDurum nu1tptnmf3iltfs el(mp;t4 exrxf3oa1lmtraneol(0t2xrio3oy1ol elfcsl(fartru ono4apto fciyd sDumn p;(4 rtomo3ty1fmDeli i ()sruo(o3nydopen nes ( a2rrumpot4aleo o3iadls emnvp u)alerif ootfaDr u sls)sruoirpio4ope  feil(f rrrxm ot0teen fetldfm2ea(mp;u) lenio3tydoa rluvo;s  rur(mpio4al emncsa(f 2tau  ;t0oeto oeiasfs emn snu)artoxr iydoaDr nei;(0s2uoxm3iydop nlncilt  rrm( p;t0alen ocildlaDeln s (4alenxr3tatop  an s (  2xmirpoydll emncsls)sDtr(moot0opxoiicilt sDeauvp;()trxnxf3oytlpD  uvilt)teuo(o3iodapenlfeiatfaDuax poo0aexnmietyslm ranmo;(0treoxr3tatfmte ivs;t srxrxm3iy4amt  iei tfaDtr(  ;t4aexnmociydls2ulnmp u0trtomr io1lmDrluvol(0teuoxrpiu4am elietltfarurumo;o4texoifciysfa umn o t4arerxr3tydoaDrau s s t2urim nydoleelnctlt)srtru pnt1olt moctys s rmu s t) rxoif oadfpD aues ()sexo(m3oo4al n icsa(fsrraxrono1altomo3ilslmDuln p u)teeomfciodfa   uvsls srtmxr3iy4lptnmfctatfa2rmxm nt4aptn o3tlsls el(vo t) rxoxr oo1lp e u ilt0 2xmio3ou4om elivtls)aruru p;u4apeomoeiadfmDul( o;u0areomo3oatlpDe u s s0t2tr(m oo1openlfesl() rta(m ;t0olxn feiydlaDrmuvon(4aetrxo oa1fpDelivs;s)t2xr(m3oydllte ietltf rrax pno0aetoiiciydlmDeaumo () lenmr oodomte i ol( sexo(r iy4lpen fcta( srraxmpnt0tpxo o3iat mDem(mo;(4aeenmfcoodlatr ieol()srxo(rpiy4lm   fvtls  2uaxrp;o1oltomoctasla rm(vp u0aexnircoy1fpD an olt)srtrxmpnu4lpte nvsls  Dta(m ;t4oeeo oeiydlm umu o;(0artnif3ta1oaD aies s0teurir oy4al elncs s) 2rru onu4oltn ieildla2uln pn()artoirctytom rlnvolt t2tmxm3no4amt mfcsa(fs2ua(rono1alt  fciyt s uanmsn(0tlenmr3oa1omteai s;t0 rxoxm oudome livil(  ruax  no4oee mo3iyt sDemn s;(0areoxoctadoa   uvs s0trtr(mpnu1aptemfvil(farrm(rpoo0apxoioctydlm eanvs t0alxnmo tatoa e uvo t0tetrir3oy4amtnlfcsls) 2ua(m ou0teeoiictls aDelumsn(0trtrmrctadomDran s t  rxoiopio4optn ncsatfaDrr(r nt4openifetlsfsDrmnvp u4aetnif ta1fpDr neols0t2xmim3oydame  fvils s2raxr ;t4optniictytfa2uau snu4 rerif3oy1fm r ues s)s2xrirpoudlpt lnvslt)s2tr( o;u0teenmfcilslm rmumo;t) ltomo oatlmtraiei (0srtm(o3ou4altelics tf Duau oou4tex mf3iytfaDel( pnt4 rtnmo iotfaDranvs s0t2trio3nydapenmies ()s2rrumont0olt io3tlt a2ulumonu4tltnmocoadoaDe neo;t) rtoxo no1omt mnvia(fs2rmx  oo4ape ifeiatlsDumuvs ()trenio3oydopt anvilt teur(m3ny4lmtelictl(faDrrumpot0aetnmietatlm2emnvs (4 exoifcoa1fpDeluei s)srxriopny1ll  lncsltfsrurx  oo1aetoifeiysfaDuanmpnt4 leomrciytlaD lnei s)srtoxopnudal  lnesa()a2tm(r ;o0openmo3iadla rl(mo;(4 rxnmr tatlpt  nvs;s)teurir iy4omtemfeta(f 2raxroot4tet mfeilsfmDem(mp;(0aexniocoatoaD  ueo;t)trurir3oydlmte nvsls)srum(monu1ope moeiatfs2emuvon(4aetnxrcoo1fmt ai slt0texoiopiudlltnmfvtat aDua(mp;t0aeeomo3tyd a ul(vpnt4tleoxf io1fm raieilt) exrxo3ny1aleelivsat)s2umxm nu1alxnifeiyslm emuvo;() eerif3oodomt  uvsls sexrir3oy4olte iet ()artmum ;u0oleoii3tysfs2rau sn()altrxocty1om rlnes t)teuo(r io1lptnmieslt) 2taumoot0tpxnmfciyt m2uaums;u4tlxriociotla rai s;(0t2xo(opiydolee ics (  2tm(  ;o1tlxnmo3iytfa2ranvpn()texomocoy1fa e ivilt  rto(m iu1llt lfctatfaDtmu pou1aet  o3iys s2um(vpn(4 lxnxfcoodla ran s;(0 2xrxr3oo1lmtelnvsltfs2urxro;u4tlenmieiltlaDul( p;t)aleoxo3oytla eauei s  exr(o3iu1lle mnei sfa2rm( poo1opx  ictad m2rm(mo;t0artniocia1lmDrai i t0 2xoio3oo4opt  nvs (fsDum( pou4oetnmiciyslm eln s;t0treoxr3iatlmD  i s;(0 2xrxr3io1amee fcsasfsDum(mpnt0tex mi3ilslaDrl( o;()aetnxf tytfp   n o () rtr(o3iodaptnlnvt (f Dur(r ;t4olt mfetasfs2em(vs u) lxrio3oydlp   u o s) exmiopoy4ole  nvsl() rtau  no0opxn o3iat m eanvpnu)trxrif tadomDr ivs;t) 2tm(o oudale  nvsat sDtr( poo0ale  feiltfaDrlumo t)trxrio3oa1om   u sls  eum(o3ou1ll n fei t a2trumpoo1aeto i3iyt mDum( o t4arxnmrcoydopD ln o;s trxmio3nu1am  lncia(  Dra(rooo0opxoif3tys m rluvp t4treoifcoatfpD lneo t) eurxo3ny1amte fcs sfarurxro;o4aet iieiad m em(mo t)trtomf iotfmDelivols0s2tr(rpiudll  mfcs t) 2rrur ;u0apeoifctat sDuauvs;(4 ltoir3iytlm rln o;() euoxo iu4lm  mieia(  2rrx  oo0altnmietytfm2el(vs t0 etrxocoy1fpD  iei;()trtmir iy1ll nlivia(  2taxrono0aeeomi3iaslmDrm( s;t) lenif3iy1fpD  ivo s0 euoir nu4olt  fcsls)sDra(roou4aet ii3iadfmDrlu pn(0 ltrir oatoa  lneslt srxoiopoo4omtemncta(fsDta(r nu0tetnif3iadla2rau s;t4trxoxf3iadfatrln s s0setoxm3oodll nmnetl( srta(mpnt0tlt ifeiltls ulu s u4 rxnioctydlaDraneo;t) eto(rpiu4ol  mnct t aruau  oo1texo fetad s uauvo;(4tetrxr3oa1fpDeauvi t0 2xrxrpiudlp n iviat)s2rr(rp;u4olx  f3iad a rmnmsn(0 rtnxfctodlp ranvils  2xrxo io4olee neslt artaumpoo1ape mf3iatfm2uanmo;t4 etnmr3iatlaDranvs t0 rxmir ny1op nlfeia()a2trurono4oex  oeilt a uanmpn(4tetrmf3ia1fp   u il()srxoxopny1omenmieiat)a2urxm ou1oeeomo3tytla rauvonu0trerxo3ootfp  an i s  2umiopoy4op emfvtasfaDuaurpot4apeo i3tlsfmDumnvo t0tetrxr oatoaDr iei ()s2urim oo4ap e net sfs2uru  nt4apx mfctyslsDeauvo;u)aeerir iydomDranes;t s2xo(r iudlm  mnvil( aDtax  ;o1tet iicils s2uanvpn(0alermr totom eau slt sexrxopio1lpte ietat)sDurx  ;t0tltn iciltls rln o;u4tlxoiocoydfp eluvo;t) rumxopny1lmtemfesatf 2tm(moot0tpenifeiadls eau o;u4trtrxociatoat auvolt0s2tmxo oudlptnlfeiatf rrmx p;u4oetn fctas sDua( s;u4 leoxf oatfa rlnei t)sexoxr oy1om emncilt  2umu onu0tle mieiltfs2umnvsn()alerxo3oodoatrau ol(  2umxm3ou1lmen ieiltf rtm(rp;t4altoiiciytfsDea(vs;u)aetomo iatlmtelueo;() 2xoir3nu1om  lict ( s2uax ont1apenmoetatfs emnvo (0tlenif3ia1oatelieo;t)texoxr oodole  iei sf ruaxro;o0oexoifciasfsDulnvp;(0 rxoxf iytlmt luesls)t2trxm oy4ol emivt (fs2tm(rpno4apxnmociltla2eau p (4alerifcoy1fmtean s;()s2uoxr nydol nlfcil( sDraur ou4openifciytlmDem(mo u4 rerio3tatlptrluvs;( t2toim oo1lpe miet (  rra(ront4aleniiciadfmDrm(mo t)trtnxociy1faD aues t)trtrxm ou4olt  nvt ( aDtr(mpno4tltomiciat aDemn o;t4tlerifciadlatranei;s) euoimpnydaptn iciatfsDrmu o;u0oleoif3tydls rlumpnt4alerxocia1fpt  ueolt0 etrxr3iy1lltelnvias)sruaur oo4aetoiietltla2uaumo (4aexnirciodlaDeliei s s2toim nu1lme mics ()aDrmxrpot1texn icias m2umuvo;(0alenir3totoat  ivo s0s2xmxm iydll   nesa( sruaumpnu4texo oetad a2rm(vo () lerir3oydlatrauvil(0t2uo(o oy4lme  fesl(fa2tr(  ou1tee mi3iys s rau o (0 eenxocootfa eai i;()srxmxr3oudape mfvtlt)aDtr(ronu1olt ifeiys sDrl(mpn(0teenmr iatlpD luvo;t0trxo(rpio1lpe  icslt) rrm( o;t1openmociat m ua(mp;u0aexomr3oodopD anei;t  2xm(m iydol nmfvi ( s2umu  ;u1tpxomo3tat s2ranmsnu) lxoxr oatlpDr nvslt)srxm(m nu1oleemnet s arrm(r no0oexn ieils s rl(vs;() rxnmf oatfat  iei s)s2tmio nu4open nvsls) Dum(mpou0oexnif3iydlaDemu on(4tlxnmrcto1fpDe neils trxriopoy1olt lfetlsfsDrm( pot0tetnmociyd s2rm(vs t) leoxo totlaDr u s t0 rtmxmpoy4om e ncs ()s2trx  oo4teeoif3tasls2rlu s (4treoxr3ta1fmte nvi;t  etmim iudlp   ncslsfs2raumont4tleoio3ildfaDulu on() exrio3totfaDr ueo;s)truoxr iudll  mics s sDrm( ooo0apt  ietlt a el( o;() rerioctatlpDraneols)srtm(opiu1alt lfetat)aDur( onu0olxomicildfm2el(vs;(4tltrir iotopDrai s;t)t2ur(mpiu1oleemivils)a2ur( pno1aet miciyd m rmu o;()tlxnmf3oodfaD aivi () ruoirpio4lle lfviat)a2urx oot0tetn i3tytla2umuvs (4artoxfcoytoaDe nvi t  2xoxm oudal elivsat  Drm( pnu0alxomo3iat a ean on(0 rxnir tytla  lnvs ()tetr(rpoodaltn ivs ()sDurxm ou0aet  fetydfs umn p;t)aeeoxfctotomte ueolt)s2tr(m3iy1ale livt t) 2rmxmpno0apxo icild mDrmn onu4arenxf oodlpteanvilt0srtmxmpoo4lpt lfvi s  2tr(  ;u1openmietydlmDrm(vpnu)texoxo iytoaD livsl( t2toiopiudamee ietatfaDtmxmpoo1aexnmoctadfs2emn onu4tlxnmf3ty1oatean o s  2tmirpiu1lmen ivi (fa2tm(m ;t4opeo ieiyslaDrl(ms;(4texrmo ty1fpt au o t0 etmio nodapenlfvi s srtr(m ou0opx ioctyd s ranms t4arxrxo io1fa  luvi;s t2urim3ou1lleelfvs s)srrm(rp;t1tpxoif3ilsls2rluvpnt0aexriociodfmtrli sls) euoxm3io4lp  mfei ( sDtrxm oo0oltnmociydfa2rl(mpn(0alxoir3tadlm raies ()s2ur(m3ou1omt  nei (f rrmur ;u0tlto f3taslsDrlums;u4treoio oydfat  ueolt)texmxmpoy1omee ict t  rtmu pou4tetnii3tlslm uln snt0trermf3tydfp eai ils0 rtrim ou4lpen fvia()a2urumont4aet if3iyd m2rl(vo u4aleomr tytlpDr uvs;t)tetmxm oo4lmenmneils)a2rau o;o0optnifcilt s2rau s;u0alxrir3iydlmt  n i;s)s2xrxm ny1am e icta( a2ua(mpou1teto fciltlmDem(ms;(4 rxnmociydlpD  ivs;s srxmio3nu4am  lict s  Duax p;o4apxniietldlsDelnmp;(4 rerxr totfpDe u i;s0srxoxm no4al  lietl(f 2uaxr ;o4tlxn f3iydfa elnvont)teeoxo iodlpDrlneslt)tetrxm iudlltnmfci (  rua(rpou4tltn oeiasls eluvo;(4aetomf3ta1lp   ueols sexr(m3nu4om nlivsasfartrxmo;t1olto ociat mDum( o;t0tlxomr3oydlmt li s;(  rxmxmpny4omt  fctat arrau oou0apen o3ildfs2ean sn()trxoif3todfateaieilt teum(mpno1optnlivslt)sDrm(rpnt0tleo fciyt a rmuvp u)alerxo3iydlpDrauvo;(0 eur(m3ny1ol nmfviat)sDrax oou0tle mfctldls emnmo t) rtnxocta1fa eauei;s seuoxm iudaltnlictls)a2tax o;t1tlxoifciyd a2el(mo;(0tlermfcootlpD  ivs s0 rto(rpnydlle livilsfs2tau p;u4oeeoifctadlsDumnvsn()artrxfcoo1lpDr i i s seto(rpiodapeelietlt artm(ront1aexnifctlsfaDum(msnt4 rtrmr iytlatranvol(0teum(rpoo4lltnmnvia(fa2umumono4apxn fctys aDeanms (4 rtrmo3ootfmDrlues;(0texr(r iu1olenlfei t  Drmu p;u0ale  fciadfm2uaump ()alxrmfctydfmDr ivs;s)s2xmiopny4lptn ieia( a2ta(mo;u0ope  ociysfs rmu o;() exrifctodlpDrauvilt0srurxm ou4ale lfcia()srurumo;o1optnioeiat mDumn onu4 renmf3tatoa  li i t truoxopny1olee fes ( arum( o;o0ape  i3iyslaDelu s;()teerxf3tadoptrlivi ( t2to(m3no1alt  fvsa() Drrxmp;o0aeen ictld s2uanvo t4altnxfctodlmt luvslt) exrxopiudomtnmfcs sfa2rmxmp;u0tlxniocilsfs2umnvpnt0tetnio3ta1fmDe i s;(0 etr(o no4oltn nctl(  2tax o;u0aexn ociysfm ulumpnu)teeoif io1lpDraivo t  rtrio3io4ol elfvs t s2rr(mpoo0oexomfeiad mDumump;t4alxoio3tydfaDeauvo;t s2umim nodopt  nciat s2rmumpno1tlxomieilsfa2rm(mp (0 exoir ta1lp rau ils)t2umiopny4ap  mnvsl(fa2rmurpno0aleomfeiltfm ul(ms;(4 lermf3oydfaD aivs s)t2tmxopiydomeemncs sfartr(root4teenifctad m ra(vo u)tltrxr3iodlmtelneols srum(m3nu4omtnmnvsas a2trx  ;u0opeo oeiatls em( o t)aeerxocio1fpDeaueilt s2urxopiy4ll emivtlt)aDtr(mono0apeoifciasfs2elnmsnt) lenmr3iy1fa eluei ( teurxopoo1ole liviat  rrrx pot0opt ifetatfaDua(mont0trxnmocoatfp  lnes t0teumio oodameelivias aDrau  nt0opt ioeiadfm2ul(mp t4tltrirciatomDr nvo;()seurxr3iodlptemncil(f Drmu ooo0tpe ifeiasfmDeanmpnt4 rtrifcoytla  an i s0srumio3oodap nlncilsfs2tax  oo4alxoii3iatfs ul(vo t0texnmocoa1optraieo () exmxm3no1amtnmnet s arrrx onu4oet iictasla ulump u4arerif3ootlm   uvo;t) rurxr ou1lp   ivi s)a2ur(mono0opx  fciat m emnms (4tlxnmr3ootoaDelieil() eum(r oydlle micias a2urxrp;o0apxnifetatlsDea( sn(4 reoxo iadfpD lnes;s  2xmxopou4olt lnviatf rrm(m oo4tleo o3iysfm em( s u)trerio iytfmte nvslt0sexmxr nudlpee iesa()aDrruront4optoioetlt a ulumo u) lxrmocoodomD aneo;s tetrxo3ou4openmfcslt)s2raumpot0aeenii3ilsls2umuvp;(4arxomociatlaDrai o;(0 eurxm3ou1llte fvilt)aDtaxmono1aee iiciad m2ra( o;()trerxf3iatoat lies (0 etmxm oy1lmt mncsasfa2tmum oo0tlxo oetlsfm2rln o;u4 leomo3iotom eaneilt0srtr(r3oudam nmneta()srrau o;o0opxomiciytla umump u0alxoxf3oodlmDe nesls0sexm(o3nudll   net t  Duru p;o1apxo oeiytfmDum( o ()tlxrif3oadfa elnesls)trtr(opno4am nlfci ()a2trxrpnu4teenmoeildfmDelu o t0altnmr oy1lpDrlnvi;(0texr(m3nodlm nlfvsa( s2taxmpno0tlxomfeiydla ea(vs u4 rtrir oadfptr nvsl(0trxoxo oydoltemnvt ()s2tr( oot4aexomoctas mDel(vo u4 rxnxf oodfa  anvols)trxm(rpoo1op nmnes ( srtax p;u1aptnii3iltfsDranvsnt0 ltoxr iy1fpt  u ils)t2xoxr ou1am n icsltfs2tm( pnt4texoifcilt sDulump t0 lermrcia1op eauvols)trxmxm ny4lm emnetlt sDtrxrpou4ape mo3iltlaDum( o t)tleniocoodfp eli s;( sexm(o3iodolenmfviasfsruaur nt1tlenmfeiadlmDum(vp ()trenmrciatop e nvs (0tetoxmpoodom e fct s  2uax oot4tpe if3iyd s rmnmp t)trtnmo3totoaDeau o t t2xoim iy4ap nmncs t a2um( o;t0apxn o3tatlmDuanvp;()treoir3oodfat  ivi;( t2umxm3iu4ame lictas) rtaur ;o1tee mieiyd a2ea(mpnt4artrmf3ta1faDe ivsls) rumxm nydll elnesasfaDuau pnt0aee  ieils a2em(vp (4aeerio3tydop raivol( setrxrpiodlp  lfetlt) Duau p;o4oetomfciyd a ea( o;u4aetrio3oatopt livi;s  etm(opoo4lpeelfei tf rur(r ot1opxo ociyt mDemn s t0texoxoctydfaD au s;( teurxr3iu1lm nmivia()a2raxrpnu1tlx mf3iydla rlu s (4tlxoxo3iy1fp  aieslt) rxm(o3nu1alen fvt sfa2rmu onu4texnmi3ils s el(mo (0tlenio ta1lptrauvs;s texm(mpoo4lme liei s)artm(r nt0alxn ieiys s2ulnmp u4 reriocoadlpDr ieols0srxoxmpoudam eliet t) 2trur nt4altn ocilsfm rlu sn(0alxoio3ia1oat luvs;s0srxmio3ny1openmnvt t s2rmx pno1tpeo f3tyt s2uauvp t0tetrifcoodoatranesls0trtrir3io4lle lfci ()s2taumonu0tetomfetydlmDum(vont0tetrmo3oy1oaDelivo s  eur(r nudamt mictl(fsDurx  ;t0oet ifetltfs ul( s;u)trtoxf3ta1fmteaues;t) rxo(mpny1apenmfet t s2umxrpoo1tpx ifeiltfa ul(vp u4tleomr iydfa rlivo;() 2xriopnu4om nlfeta(fsDtr(mooo0oetomieilt mDuanvsn()altomo tytfa r u s;()teto(m iodlmeelnctlsfs2ur(m ;t1aleoii3tasla2eau s u4aeeoxrciydfptr uei;s0 ruo(r3nodal nmieia()srurxrp;t1olt ioctyt m2umnvs u4alxrxrcoatfm  au o t) rumirpny1om  lneil( s2tmumo;t4tpe mo3iat sDean p;t4 rerxrcta1lmteluvo;t)teurirpoydole  nvi t)sDumx  ot0tlxoioeiltfa2ulnms;u4tltrxoctadla e ivs;s srurxrpnudapeelivs sf 2tm(mono0aptniicilt m2rl(ms;(0tltnmr3to1fp  lnvols0srxm(o3nu1lmtelfviatfa2rmu  ot0oltomfctys m uauvs (4arxnmf iotop  livols teumio3ou1opt mnvt s)artmurpoo1aet io3iyslm rmumo u4aexomo oy1om   i s;t0trurir oydlpeemfesltf Dumxr ;o0tetn feild aDrm( sn()treoio ootoaDe ieo s t2toir iy4al  lfes sfsDrrxr ;t0aeeoif3ildfm ea(vp (0altoxocoy1omtrln s () 2to(r3oudolt mivi s srrmx p;u1aexoif3iatfa rlnmo u4teerioctydom   i ol( trxrir oudole  fcias)s2rax  ;o4ole  fctlslm2rmu o u)aexoif3ta1lpDr u o s0teuo(rpno4amtnmiet s aDrrx oou1oexo fciytlaDrmu on(0aeermr tydlp   u ols s2xoxm3ny4altnmnvta( srtmu  ou0oexoiiciysls2rmnvo t) lerio tytfm e nei;t)t2urxm iydlm e nvt sf Drmxr nt0texnmfetysfs2ea( pn()tlxnxr ootfaDrlu ilt0 eurio3io1am   ivia(f rtr( p;o1teen f3ilsfa ea( s u4altrir oo1fmt anvs t sexm(r iy1apt lnei (  rur( p;u1olx ifeiysls umnvs;(0 rtnxociotlp e i o;t s2ur(m3ny4omt mfeias  rtmur ;o4tetn ictadla2uan onu0 eenxf iatfm eanes;(0t2xr(m3no1altelfcil( srraxrpoo1ale  i3tasls2rl(mo u4aetnmf tytoaDeaivs;t  2uoim3nodll nlietlt  Dua(mpno0altnifcildls2uau pnt4aeeomfctatfat an s t0t2trxo3iydop elnvi tfsrtrurp;t4tlen iciydls2el(vont0aexrmf totoate iei;t  exoir3iydlpe  ivsa(  rtmxm oo1ope iociysfs rl( onu0trtnio3oydopteaieo s0t2tm(rpnu4altelietlsfa2trx  ;u0tetoiictltfs2rlnmont4 rtnmocoydlpD aneo s0truoim3iodlmeemicsas)arurxmpot0opxnmi3iltlm2umuvsnt4areoifcty1om e uei s)seur(mpoy1lm emicta(fs2ua(rpno4aee ifctlt a2ul(vs;t4alxoiocoo1optrlieslt0trtoio3no4om  mfci s) rtaxrpoo4tpx  f3iatfa2rlu o;t)tlxnxfciatoaDe u o ()seum(mpny4aptn ies ( aDtmurp;o1aleoif3tas a umuvo u)alerifctydla eauvi ()srtmim iy1aptelneslt  rurx p;t4apxn iciyd mDra(ms (0artnircootfp  auvslt)trxrxr3oo1amte neils s2rru ono4alt mfciyslm eanmo u4trenmfcoytfa r i i;s srtoxmpoydlpe  neta(  Drmxr ;o1aetnii3iadls rl(vs t4tetoifcoadlpD  uvo s0tetoimpnydoptnmfcsasfs2taxroot1ole  f3tytlaDumuvo;u)aexrir oy1fateau sl(  rtrio3ny4lpt  ivsl()sDtm(m nt1apxomi3iadfs2rlnvont)tltnmoctodlmDe nvo t  2urio3nu1aptemnvt s s2raxro;o0teen oeils m ua( s;t4tlxrifcto1opt  n i;s  2xoio3ou4lmeelieiat) 2raxrpot0altn i3iatfa2emn s;()alenmf tatomtr i i s  rtrim3iudol e fvsl(fsDtm(roou0tpx mi3iasfs2uanvsnt0 eerxocty1fa e uei;(  2toxmpou1llen nvslt aDtm(r oo4aeeo fciat a ua( p u4altoxociydfat  nvs;( seuoxm3iu4am n fci s)aDraumpot4oee moetytla2eln onu4tltnif todoaDranei t) rxoimpnudop nlictlsfsDuru  ou0oeenmoeiysls el(vp t4 rtnifcia1fpteli s s0setmio oy4lpe lfet () 2umx p;o4oltoioeiytfm rmu o t0 lxrxocoatlpDrluvs t0 2uoir3io1ole  fvs s) 2rrum nt4tpxomf3ils mDrmnvo;u0trerxr3iadfatrlueil( sexriopio1openmncsls aDurx p;o1apxnifeiat s2umump;() rxoircoodlmDeau olt  2um(rpiodomtemnes (  rumxm ;u4aeeomfcild aDrluvo ()aeerio oodlmtr ivsls)tetrxm ny1lmt livtls  Dtaurp;o4aetn fctadfa ul(mon()tlxrmfcoatopt anes;(0t2trxm ou4lmenlnetat) 2rr(moot0aex if3tatfa ra(monu0trxomf iotlpDrluvo;s0 2xrxo3iodlpenlfvsas  Dtmumoou1alx ioctlsls2el(mo;() eeriocio1lmteluvol()t2xr(m iodale lics (f rrr(ro;o1tptn i3iasls2umu p;u) lxnmo tydfpD aueols truoxo3oy1lpe  ict sfsDrrxr ot4altoioctat sDrlu s;u) rxrxf io1lat  neolt0s2trxr ou1om elfviat) Dtm(r ;u1tlxo fctyslsDumumo;u4tltrxo3todfmDr neils)texm(m3nudlp  livsls  rumur oo4aexn i3iysla em(mont4aetrxrcoodlmt luvol()trto(opoo4olt  nvi t)s2umxro;u1teeomociytlm umnmp u0treoxr tytoaD  n o t0t2toxo ou4optelies s) Durxmoou4olxomfctldfs2emn s t0 renmr3iodop   ivo s)sexoxmpoo1ap  mnct s arrr(rpot4tle  iciadfs rlnmo t0aeenxrcoydopD  ueols0s2trxmpoydllte neil(fsDua(roou0teeomictld s um(ms t4teeoif3ty1la r nvo;t t2tmxo oy1lltelfvi s artr(rpno4tlxo i3iyt s2rl(vp t4aeeoir3io1oaD  nes s  2xoirpiu4lm nliesat)sDta(mont1apxn i3tlsls umnvp t0altrxr3iodfate i o;s0sruriopnydomen fciat sDtmu o;u0tpe mi3iysls2elnvo;u0aeermo3tytom eauvilt0 2tr(r nodlltnliet (fa2uru ont4apeniicild a rauvsn(0trenmo oatlmDeaieils t2tr(rpno4al nlfvsa()aDrm(m ot0tlxn ieiysfa2umu onu)alxrxo3iodlm  ai ol(0trtmio3nu4lptemncs (f 2tr( pnt0aetnmo3iasfs2rmumpn(4aexoxo3oydfmtrau i s) 2uo(mpiu1lptelnci tfa2rmuro;u4oetoii3ildfa2emnmo;u)tltoxfciytlp rliei ()s2urio3nudomtn ncs sf 2rax  nu1aexomfcildla rl( o;t)altrxfcta1op r u slt teurimpnodlme lici sfsDtrumpnt1aetomo3iyd mDrln snt0trerxrcia1fa e n i;(0sexm(m iu1ame lnci s) rumxmonu4ape  ociad mDua(vp;t0 lerxoctodfpD auvo;()srurio nodlmt  iciatf rta(mpou0tpx  feiadlsDra(mp t)tetoif3oydfaD aueo s) 2xr(rpou4am e nei ( sDuau ont4oexomociltfm2emnvont0 reomfctytfaDean i;t0t2urim3iu1optemfcsls) Draxrono4oltnmf3tad mDulumonu4artnxocoa1oaDe ivo;s0setmirpou1aptnmivtls)srtmxm ot1alt  oeiatfm2rmums;(0tlxrir3totop   nvi;s)s2urxopoy4apen feia( sDtru  nu1alxn fcilsls2el(vp u0 reomf3oadlpDr ieilt s2uoirpny1lmt  fcsa(fsDrmx o;u4tpe ioeiltla2ea( snu)alerifcoadopDeli s t0teto(m ny4apeemncs ()sDra(mo;t1altomociyt mDuau ont0arenxo3tydop r nes s)teuo(o iu4ameelfci s)a2taumo;t4oeeo f3iytfm rmnvsn(0aetnio io1fpteaues;( texr(m no1omtn iei ( aDrrxm oo4tpt  ietlsfm ea( p t4 lxnmo3iydlmtrlieilt0t2xo(rpou1lm nlfci t)aDumx oou0tpxoiictad sDemuvo (4tlxnmfcoatlmt auvsls0trur(r3oo1lmenmfvil(fs2rmxront0tet mociys aDum(vpnt0areoircoadfmDr ueo;t0s2uriopoodom nlies s)srrrxmooo1opxoif3iatlmDrm( o;t0tetoxo3iotomD auvs;s  exo(o3iy1ale mncils)a2ra(root4texoifciat s2ua( s t4 rtoxf3iydoaDe n ols0t2tmxr oy1olte net t)a2ua( o;o1tlt mfciyd a ulnmp;t4tetoif iodomt li sl()seur(o oy4lm nlncsl()aDua(ront1oltnmociltlm2ua(vo u0tlenxo totoptraueolt s2uoxr oo4ol   fcslt sruaxmpou4opxnmietatfsDuln p;t0arxnio3iadop ranvo;(  2uriopno4ap n nesl() Durx p;u4oetomi3tlsls rluvs u) eerio tydomt anvs;t teur(rpoodaltemivta()srrmu  ;t4tlto o3tys sDul(msn(4 lxnxocoydlaDr neils0 rxmirpio4am  livi tf rtrx  ou4aetn fciltfa2rmu s u4arxrmrcoadlpt li slt srum(mpoudam emneta(f Drmurono4oet  i3ildlaDrau pnu4texrircootlm  anvol()srxm(r3iy1ll nmiesa(f 2trur ;t4tpe io3tydlsDrlu snt)trtnir3iydlpD au o;s0 eum(o ou1alen fvils  2uaurpnu4aleo f3iyd aDumuvs;(0alxoxo3ty1faDran ilt0sruoimpnu4ll e ivt t)s2urxm ou1tleomictldfaDuaumo (0aeerxf iatomDrlivs;s)seuo(m ou1lpt lnvia(fsDtax  ou4oee moctltfs rau p;t)teenmf oydlaDrli o s seum(o iodolt lfet s) rtru pou4olxn f3tadls rmuvont0teeomf3oytlpDrlu i;s)srurirpiydlp emnctas)arumurpoo4aetoiictysfaDelnms;(0aetrxo3ty1la e nvo;s0sexmxm oo4openmfvtas)arrrurp;o1tlenio3tadfs umnvs;(4trtoxr3oatom rln il(  2xrxo iudal n fvsas)aDuaxmpnu1oeeoifctatfsDum( pnt)trxnxo3oa1lptr n s;() rxo(r ou4oltemfcsa( aDtm(r oo0apeo feild m raumon() etnif oo1fatrlies;s)t2xr(opnodol elfetatfaDuru  ;o0tpxnmoeiytfaDean p;t)altoxr iadop  anvo;(0 2tmiopoodap  lfcias)arum(m ot1oexnif3ildfs2elumon()altnmr iodopDe neslt0 ruoir3oo4al nlnvs sfaDtax  no1apt ioctasfa2ea(mo;(0 rxrxo3oa1fpDelivs;(  rtmio3no4om elicta()artr(m ou0tlt io3tadfa um(mpnu0teeoxf totlpDe nei;t0trum(m oy1op nlnet t aDtru onu4apt mi3iad m rmn s (0areomf3iy1fpD ai sl( trtoir iu4op n fesas) Dtmur no0aetnioctlsfs2elu o t0 rtrif iytomteaiei;(  exmirpoodape lfesls  Dur(rpot4tle ifeias s umumo;u4 rxomr3tadfpD  uvslt)srxoxm io1ope  ietas aDumu p;o0teeomfciyd sDuanvs;u)tlxnir todomDelnvi;s)texrxm ou4alt  ivta( sDra(mp;u4aeeomoeildlmDelumpn()alxomr oydlmD liei t s2xm(o iu4lme mfei () rrmxro;o4oeeo oetys s rau snt4 eeoif3ta1opDrln s s)tetm(o3nodlmt  fet t)aDururoou0oetoii3iydfm eaump t)treoif tadfaDeaivi t) etoirpoy4amtnlies t)artmxr no1oltomiciyt m2el(vsnu0alxnmrcty1omt aues s0tetmxo3ou1lpt lnvilsfarrmu  ou1tpx iociat sDeanvsnt0alxrmf3oytoa e nes;s) etmxm3iy1lptnmnetlsf Dtaxrpnu4tlt ifeiadls2el(von()trxoif ty1fmtrau s s  2urir nu1apeemnvs ( srrm(r ot1ole moeils sDem(vpnu0aetnmo3tytlm r ueslt  exm(rpiodlmtn iet s sruaxmoot0texo ocias aDra(vo t4 leoxrcootfm   i o;t) etrxo io4al nmnvs ()aDrrumono1opxn feiasfa ulumon(4texrir3oa1lm   ivolt s2ur(opnu1am  mfei ( a2rrxr ot4tptnmfcilsls ra( snu)tleoxociy1laDeanvo t  exo(mpoy4lmenlfcslsfa2urxrp;o1texoifeiatlaDra( p;u)texrmocoy1omD lnvi t teur(m3oo4lp emicia( arumu poo1oexoioeiadlm ua( s t)alenmociotlpteln s;(0s2trimpou1amtelfvia( sruaurpnu1oex mociyt m2rmuvs t0tetnmr3io1latr n ilt0teum(r iodlm e ivtas s2rmxrp;o4aet miciyd m2rlumon(4 etrmfciy1lptraivs;s) exrxm3oydapen ies t) Duru o;o1apenii3iatfa2um(vs;()areomr3tydfmte n slt) rtoio ou1ameelici t)sDtrx p;o0tleoifciyt s2ul(monu)aetomr3oodlptr nei s0 rtmiopnu4op nlfcs tfa2urump;u0texn f3iatlmDua(ms u)tlerxocoydla rau o ( t2trio ou1ll  mncta( sDrrxro;u4ape iiciatfa emnvp;t0tleoiociodop  auvs;s0seumio3io1oleemnetl() Duaum oo0optnmoeiytla2emuvo (0tetoxo3ootlatrlnvolt)srxo(m3oy1lpe mictlt)s2rmu pnu4aeto fctls mDum(vo;t)artrxr iy1optraueslt0t2xmxo3iudol n fetl( a2trx pou4tet  fctltfm um(vsn()texomo3tadoa rln slt trxriopiy1am emfvi (fa2urx  nu0olt mietysfaDeaums () ltomfcio1optrai o ( sexrio iu1lme lfetl()arumxroot0opeoio3iat sDumnmo;()alermrcoodom e nvo;t)srurxrpiodlptnmfeta()sDur(r nt1opxo fctys a elnvp u) eenmrciatfa rau ilt setoio oydal emneil(  Drmx  ;u4opx mf3iyt a2ul( s;(0aetomfcoa1lpt an i (0trtrxopiu4llenmfvta( sDtax o;u1apenmfciasla el(vpnu) rxomrciodomDeaivo;t  2trxm3iu4omen ies ( aruaxmo;o1oetnmfctadfm rln s t0teeomociatlatrluvil( srur(m3ny1lle micsl(f Dua(m ou4opt ioeilt s el(vs u4 ltrir iy1oaDrlu i;t)teto(opiudamtnlieil( artrx o;u0alt mfeilt s emn snt) rtrmf3ta1oa e u s;()s2urim iudopeelneslsf 2rmxm oo4tptn ociyd sDua(mon()texnirciydlpDrli s s0setrxo iudll elneslt) 2rr(mpou0opeoio3iadlmDrl( on()alermf3oytfp elivs s0trumxo iy1optelneslt arra(moou1tpeo ociyd s2rmnvs;t0artnif3ootlmt anei s texmir iodal   nci s)srumur no0optomoeiydfm2rluvs (4tltnxfcoo1op r i slt sruriopny4om n fes sfa2rru o;u1ape  o3ilt mDra(vs;t)alxomo oydlaD  u olt s2tmxr3nodale mnvia()srtru o;t4olxnif3iysls2eanmpnt)trtniocoa1opteanes s
\ No newline at end of file
@@ -0,0 +1 @@
+ueo ()s2ur(o3no1oleemfes sfa2raur ;u4aexoif3ias aDrm( o;t)alxoxr iatfaD livs t0 exrxm3ou1altn feslt) 2ur(r nu1tpx  f3iyd m2ulu snt4teenxrctatfm  ln sl( texriopoudopt  nvtl(faDuax  nt0altnmi3iadla2ulumo u4 rtrxoctodfpDeln olt0 rurxo iudlmtnmieiat)srrru onu0altomf3iysls2ua(vs u0 ltrxo3iotfmteluei;()teumim3iy1aleemictls srta(r ;o1oeenmfctltfaDel(vp (4tltrxfcta1latr u o;t0setmim iy4lp e neta(  2uaumoot4alto feilslsDelumpnt)aeerxf3oydlp   i s;s s2xmxo no4opt  fctatfsDumxmo;o1oleo fciltla2rau o;u0 lxnxf iydlpt lneo (0 exrio3iu4ap n ncs t)s2tr(m ot4oeeo i3tas m ean snt) lermo3oytla  auvs t) exm(opou1lmtnlnei (fs2rrum ;o4alxn ocildls2elnvo;t)alxomr3oadlmDeaieo;(0 rurio3oo4oleelfvtl(f Dtax o;u1olxo f3ilt a rau s t) exrmo to1fpD luvils)trtoxm3oo1lpt  nvtat)aDra(rp;t0oeenii3tls a ranmp;t4trxrmr oatfatr i olt seumiopnydal nmnviltfaDtmx pou0altomo3tlt m ra(vont0trxomr3totlm eai sl(0 2xm(mpnu4ale  nes sf rum(mo;u1tltn icilslmDrmnms;u0aeeoio ty1la eanvsls)truo(opoy4lpe  fesas  rtr(rp;o0tpt moctatlm elnms;t4 rtnxf oo1lpD  i sls srurxopiy1lptemicslsfsDraxm nu1openmieiltfs eanmo (4artrmfcoadomtrlu ilt  rxmio iodape  iviat sDur( pou0alxoio3ils m ua( p;u)arxoiocty1la rliei (0s2trim3ou4llt lnvi sfs2tmxmpoo4texomi3iydls eaump (0treomo todfa eau o;( t2xm(m3iydamte ncia( arurxmpot4texn ietyt s2ra( pnu0 ltomo3oodfmD aueo;s t2uoxm3nudaptemivi t  Dtmu  nu1aetnmfeiltlaDumn onu)teermrciatfpDelnvs (0tetr(opiudol   nei sfa2rm( oou4altnifctls sDuanvp;t0tetnir3oytomDr n o s0sexm(m3no1llte icsas  Dtr(  oo1alxn f3iltfm ra( o;t0artnmf oodopt anvsl( sruoxm oodal  licsl( aDuaxroou1apxnmocild m el(mp;()tetoir oo1omtr n i s0 rtoxopny4ap   nct ( srtm(mo;t0aet io3iadlm2rmnmp u4 exrmr oytlatelu i s0teur(r iu1al  licsat)s2um(  ;t1tet  fctaslaDulnmont0arermocto1fpDrluvil()trtrim nu1ap nmivta(fsDta(mo;o0aetoii3iydlmDulums;()aeerif3ty1laD lnvolt0trxmxrpiy4lm  mies (faDuaur ot1oet mf3iys a2emnvon()aetoxocoo1lpD auvo ( tetr(o3iydlmt lfvtltfsrra(rp;u4tlxnmf3tlslm2ulnms;t)teeomr iodoaDe u ilt0 2uo(o3oy1amtelnvi ( aDtax  ;o0tlxo oeiyt aDemuvp t)artoio3iatlptrln i t0s2uriopnodomt  nvslt)aDrm(mo;o1olenmfcildlmDraums u4areoxf oo1opDelnvi s seurxm3nudlptnmfci s)sDtmu ont0opt  iciatls ua( s t4aeerxr tatfpDe i i;t)s2umim3oy1lleelnvtltf 2rmuronu1tpt micils m ra( on()texomrcoytlaDraivo;t) rum(mpiu1omt mivta(fs2tru ont4tlto feilsfaDrlumpnt0 lerir oa1oaDe n i (0 2xr(opnodap   nciat  ruax  oo4tetnmieildlsDea( on() rtrxociatomt livol(0sexo(r iodlpen ictasfaDtmu oou1apeoio3tasfa2eauvpnt4 renir3tadfaDraivolt teum(o oo1ol n feiat)sDrr(ro;o1tpx  ociydla ra(vs;t0tetoir io1oatran s;()srxmxrpoo4lmenlfetl()a2tax  ;o1apenmoctysfmDranmonu0tetoio todfa  lnvilt) eurxr3iu4lp elivils sDtm(mo;u1ole iieiad a2eauvonu)tlerif ia1fpDrln ol()seuoim3no4lltn iciasfaDumxrpnt0tet  o3iydla ra(vont0altoxf3ta1lpt lu ol()texmxm nodoltn feils srtm( pot0oetnmfeiad sDuan o;() exoifctadlptraues;(  2uoim iy4amtn nviasfarrrurpnu4olx mociytfa em(ms u) rxnxr3oatfmtr ieo;t0 2uoxm3iydomtnmnvi tfsDuaxr nt4oexomietyslsDumnvs;u)trtrmf iydlpDrln o (  rtmxm3io1ll  lnctat  ruaum ;u4tlxoif3iad s rl( s (0alenxo3iadomDrlueo;(0s2uo(m iu1amee icslt)aDrrxrono1aptnmo3iad m2raums;u)tltomfctotfp e ivolt srum(m nu1apeemieiatfa2rau pot0texnio3iyd sDuaumont0 rxoxocoo1lmte i o s0 rur(r3ou4al e ncia()arta( o;t1tlen octltla2rmumont4 eeoio oadfatrlivo (  euoim3iu4ap elivtas)aDrau  oo1aleo o3iltlm2ua( onu) rxnifcoatfmtelneo ()setm(m nydame lfcilt srrmx pou1tlx mfciytfsDul(mo;()alxnmociatomt  ivolt  exmim3iudap emncsls) Dua( ooo4ale io3iltfs rmnms;t) eeoir3totopD livolt) 2xmir3ou1al  miciltfsDtmxr nt4olxniiciydfm el(msnu) etoif3todoate ues;()srurirpnudlmenlfvt () Dtrxmoot0tex ioetat s raumpnt4aeenio3iytlat lnvi;s s2xm(o ny4opte nvs ( srtm(mpot4tpxn i3tytlm emnvp;u0altomocoadlatraieo (0 2xrxo3io1ole mnvs (fs2trx oou0oltn octadlm rmuvp u0aexnxo iadfmDrln i;s t2toxo3iodalt mnvtat)aDumx ont0ale moeiytla umums (0 reoxrcoydfaDrlnvolt trxmio io1omtnlfvtls) rrrxr nt1apxoif3tlsls emnvs u0teenmoctodlptr nes;t0 rtrio oo4lm n ivilt)a2tmu onu0tpeo fctltls2umumo ()trenmf3oo1lmD  neil()t2um(o3no4lmtn ietasf 2rrump;o0alxo o3iyslmDem( o;()arerxf3oytlaDean s (0 exriopny4al  mivsat)srumxmpnu1tle mieiytfs rmn onu4aetrmf oa1laDeaivslt0trxrim3nudllenlics s) Dtm(mpno1alt mieiatfm2em(vp;t4tlenxocoatlm rauesls0setriopoydameelivtlt)a2rmxmoou0tpxomociyd mDranvp t)tleoxo totlpDrai ils)s2tmxrpoo1oltnmies t)arrmumpot0oleoif3ildla2umu s;(4 etoiociy1fat anvo ( teuoxm3oo1ap  lietat)aDra(mono0oltn iciysfm2eanmo;(4 etrmf iadfa  ln s;t s2urio3nu1lpt  fcsasfsDurur nu1ole moctltfa2uln pnt) lerir3todoa r iei (  2urirpou4ameelfvtasfs2rru p;u4tlxnmfeilt aDea( on(4trxnxrcoatfa  luvs;s0t2xoim3iy1omeemfetas)s2ra(ro;t0tlx ioctytlm um(mp u4aexrmr oydfm elieo;t) exoxo oudom  mfvta(f Dtmur ou1olxnifeilsfsDrm( ont) reoxocoadlp rlivi;t) 2uoir oydlpt lnes s)a2um( p;o4tetn ictydfs emu snu0 ltomrctodopDeaieils  2tm(o3iudome micsls) rrr(ro;o1oeeniicils sDeaump u)texnmr totom   ivs (0srumxo3iu4amtn net s arrru  ;o4aexo f3tltlsDran o t4texnio3ia1lm raiesls0texrxrpno4amtelfctls  2tmx p;o0aet  fetlt a emu p (4tlermrcoy1opD ai o;s  2xrxo3nudam nlfvtat)s2rmu  ;t1aleoifetad aDranmo t4trerxo3iadomteluvil( s2umxm iydal nlictasfartm(r ;u4oet miciyd a rmnvs (0 ltnxf3totop rluvs;(  2triopou1om n iei tfaDumxmoou0tlxnmfeiaslsDumu o;t4tlenmoctadlpDran s t t2uoim3ou4lmee iet s  rua(  ;u4olxoioetytla2ea(vpn(0 rtoxf ootoptrln s s  2to(o3oo4apeemnctl() 2raur ou1aeeo iciydfsDem(msnu0trxoxo3oatlpD ai ol()texo(m3iu1lme  nvsatf 2rrxmpnu1tlx  feiadfs ranvp t)trenxr3io1omtr u i s0setrxm no4lpenmfesasf 2rm(r ;t1tetomiciysfsDulnvs;t)texrxfcoa1laD au o;() 2urimpnydap emietatf Dtr(roou1olen ociadlm2uanvont4tltrmocta1lmte n sl( srtoxo3iydapt mfctas s2rmx  ou4tlt mo3ilsfaDem(ms ()tleniocoatfatrau s;s s2xrio3ny4llt  nctat) Drr(rpno1optnmieild aDuauvpn(4alxrmr oydop e uei s trxoir3iudoltemivsat a2urx p;t4tltomf3iatla2um(vs;t) eenmf3ootfatelnvol(  eurio3iu4llee ict s)sDrr(rpoo0aetniieiys sDrmnms;u0aeeoxrcoy1fpDrau i s0t2uoirpny1lleemfvta()aDrrum ;u0tptniiciydfa2uaumont) rxrmf oydoptrlues;s0seumxm nydopen fes t)arra( oou1aptnio3iyd s2uanmp;u4aetrxr3iydfm  aivs;t) exrimpny4apt  ncia( s2tmxm ;u1aexoifcias m rmnmpnu4alenxo iatomDraies;s  etrxr3ny1lpe mfvsls  Duaum ou4altnmoeiytla2ean p (4altoxo oo1fp rlies t s2xoxr nu4lle mictls a2rru  ;t0aexniieias m2emuvp t4 lxnmf oatlmtraieo (0 2urxo3oydolt lneslt  2tr(m nt4optnif3tld sDum( on(0 etrxf3oy1lm   ivilt0srurxm oydlp e iei t sDrrxm ;u1tlenmi3ils s2ra(mp;u4tetnxo3tytlaDeanvolt) rxoim oodlptn ietl(  2urxrpoo1tpeomo3iyd a rl(vp;(4aetrmf3to1oatrau o (  eumio ny1lltelfeia( s2rrurp;t4altnmo3tydlm umums (4tetnmr oa1fp  anvo;t0seuo(m io1am elnei sf 2ua(ront0tlen f3iltfs2ranvo;u4aeenircio1fptrauei;s0s2xrxr3iu1opt mnvsls)s2rr(r ;t0teeo icildlm umuvont0trtrmf todfaDrai sl()t2uo(mpno1lm nlnvtltfa2um(m oo0oee mfctlsfaDulums;(4aexoxo3oo1oate ieo;s)s2uoxr no1omtn iesa(  2uax o;t1oetomieiasfs rl(vs;(4aleoxo todfpte u ols0texmxm ny1altnlnetls)srrrum no1oeeoiociasfm2eanvs (0 rxnxo3oodfaDraieo;(0teuoim ny4amee netas)srum(rp;u4apeomociyd a2em( s;u) etrmfctodfpDr n i t seuo(r no1am  mfvtasfaruax p;t4aexnmietyt mDrlnms;() reomr3oy1fpDrlues;(  2toxr io1ap n ieta(fsDtaxr oo4aptoio3iadfm elu s;(0 rtrmrcoy1latr u sl()s2umxmpno4aptnlnctls  rrmx p;o0tpx mictatfs2uluvs (0alxnxf3iodfp r ues ( s2tr(rpno1llt lncslt)srurxm no0apenmi3ildfm rlu p (0arxnxoctodlp rlneo ( trtmxrpio1amenmnvsa(fs2uau pnu1aexnmo3iyt sDulu s (4 lerxr oatoa eaivsl()texr(o3ny4ameelics sfsrur(r nu4tlt  fciat aDrl( ont0 etrifctadfmDr nei;s trxmxmpoy1lm nmfet sf rtrxr ot4oleo ocils s ranvp t4 leoif oodfpD auvs s0trum(r3nu4lltnlieiasfsrurumo;t1oeeniieiydls2el(vs;(4teenircto1op   iei t0seumimpoo4altnlici sfs2rmxmpnu1tlto ociat s2rmnvs;t4 rxrmf3ia1fpte neil()t2um(r3iydomen fei s s2rruro;t4tpto oeiatfa umuvs u0 eeoxrciodfpDe i ilt)t2umirpio1oltnmfetl(f 2uaurpou4oltnmfctadfm ranmp;(0 rtoxfcoytfa ran ils0 rtoim oydal nlfvt (fa2urx pnu0olt mi3ias a rauvo ()altnio oodlp r nei ()sexmir oy1om  lncs t)sDraxmo;u0oex ioetysfs umuvsnt4 ltoxrctadopD lnvol(0texmxm oo1lme  fvs t s2rm(m ;u0aetn i3tysfm2uanvp (4texnmrctotoptr u s ( t2tmim iy1ol   iet tf rururpot4aetnmo3tltla2rm( o;u) leomfcoodfp r u s s)teuoxm oodlmenlfci (faDta(r nt4ale mfcias s2ulu snu4 lenio3oatlpD au i ( srumxrpiy4openlncs s) Dumu  ;u0tpxomfeiyt mDua( s;u4 rxoxocoydom e nvs (  2xo(rpiu1op nlfvtat) Dtrx ooo0tetniieildfsDra(vs t0aexnifcio1fm rau ilt)srxrxopnudlmte fcsls) Dum(root0opt iiciyt a2uau s;t4tltomrctydop   ieo t0trtrxopou1ape livia(f rumxr ;t4oltn i3iytlaDum( s t4tlxniocto1fp r i s;( seur(o ou4alt lnctlt  Drrur ou1olxnmieiltfa2eanmsnu4tlenmr3ta1fa raneslt)trumir ou4lme  ncs ()a2urur ot1tle mo3ilsfsDua(ms;(4artoifctytfm r neols srxo(o oo4lpee fei ()aDtaxmpno4oexniiciltfaDumn o u0aexnio iotfpt lieo (0trurio oy4ol  mncta(fa2ua(rpnt1aet  ieiasls ea( snt0aetnxr oo1oaDraiei;s0srtr(r3nydllte fctlt) Draur ot0apt ifctydlm2rm(vonu)tetnmrcia1lmD lueo t0srtmir3nudoltemnctlsfa2trxrpnu4aetoioeilt m2rm( o;t0tlenif3oadlpDranvils tetmxo io1omenlieils  ruax ono0tex mfcias a rl( snu0texrir tadop elneo s0t2xmirpio4ll emfcsat)aDrrurpoo0aet iietadfa eauvp;t0alxrir3oatoa  lu olt  rum(m no4ll elictat  rta(r oo0aetomictyt m eauvo;(4 eerxr3totlpD aieslt s2xoxm nudapeelfet t s2raxrpou0olxn ieils m2umumo u) rerxf tydfa  aiei;s)trum(rpiodllt livsl()s2tm(moot1opxomicilsfm2umnmp (4tltniocoytfaDelieslt) eum(r iy1oleemfvtas sDtmumpnt0opx io3tadlaDumnmo;u)teeoxo3tatlaDrlivs;s  2urir oudomt  feilsf 2umx  ;t0ale if3tas a2elu pnu0treoifcoatlmD  uvs (  eum(m oo1om e fvsat a2uaumpot0aleoiociydlm2ean s;u0tltrmocoa1fateaivo ( s2xoxo no1omenlfvta( srtr(  no0ale ii3ildlmDem(msnu4 lxrxr3iytoatrauvo () exmim iy1alen ivsatfaDua( pou1teeomietlsla el(vp;t4tetnmr tatfp e neo t0s2toxopoodlmtnlnvs tfs2rmx  nt1tlx  i3tat mDra(mpnu4tetrmfciytoaD lnvs s0 eumxm3iodopt lncil(  2urxmo;t0tlen oetlt s ea( snt0tetnio ty1fmD  i sl( trtoxm io4lpee nesasfa2rrurpnu0olen oetysfa ulnms (0tlxnxo io1fa rluvs s0 etmiopou1apenmfetl( arrmxmpno1olen fcildlaDranmonu4teeoxf oy1lmtr u o;(0t2ur(o3iy4llen ivslt  2trx oou0alen oeiatfm emuvpnu4tetnif ia1fp  lueo ( setm(o oo4lle  fvi s s2rr(ro;t0tlt ifciatfa2uan p (4 rerirciodlaD li ols) 2trimpnydam n nvsat)sDtmx  ;o4opt  i3iydlm2uanmpnt0aeermfciy1oate iei (0tetmxmpio1apeelfesas)arum(  ;o0apxnmi3ilt s2umn p ()trenxocoo1lmD an i () rtrxo iudom nmfvi ()s2rr(m no4aex mi3iad a2rlu sn(0 eerxr3to1optelies t0 rum(rpoydlptnlnetas s2tr(  ot1apxomf3tltfs ul( sn(0aexomr iytomD anesls) 2xoxopnydopee ivtatfsrta(m ;o0oeen o3tls s2um( sn(0tlxoxo iodlaD lnvi t0 2trxm3ny4oltemfctls) rrau ont4aetn fetytfsDemnmsnt0 rtnxf3oa1lmtr u ilt) rurim3ou1ol  lfet ( s2umuroot0ole mo3iyt m rlnvpnu0areomo iytlmD  ivi;(0teumir io1ape  nciat) Drmx  ot0tpt  oeiadls elnmsnu0alerxo oatlat lu s;( srtmxm nydam elfcils)srum(r nt4texnioetytls um(vs t)teenxociytomtr u o;()seur(o3iydamenmnvt s  2raumo;o4olxomietatla2rm(vpn(4 exrmoctydopDelu s;t sexm(o no1ol   nvs (fs2urxmo;o4oeto iciyd a2rlums;t4 exnio3oo1lpteli o;s0sruoxm3oy1op  mivtls  ruaump;u0tetomfetlslaDeln p;u4 rtnifcoydlateln i;t0 rxmxm3ou4amt miciasfsDtr( p;t0ope ioetlt a2ranvo t4texomfciatfm  luesls  etrxm3nydal emnvia(fs2rrumo;t4oex mi3iydfaDuanmo u4tetnifcoodfmDrluei;t)s2tmxmpiodol   iei sfartmumpnt0tpxomieiys sDuauvsnt0artoif ootlmtelieil(  eurio ny1lpenmfeslsf 2umxront1ape  feiyslm emn o;u4aexrmf iodoaDr u sls) 2to(mpno4alen fet s)a2tm(rpnt4alxnmfetlsfsDranmp;()artnmo oa1lm  lu o;s t2umirpoo4olen ncs s) rtrumooo1apxn fciyd a ua(ms;()aleomo tytlpt  neils0srurio3iydap nmivsl( s2rmxmpoo4tet iociytfm2ea(mp u4teenircoodfpt  n o;t0 etoxr iu1am nlfcia() Drr( oot1tpeoio3iad s2uan p;t) leoio oytomDr uvo;t0trxrxm oo4lm e nvtlt  2raur ot4olt iictadfm2uan pnt) eeoxocoatlp rluvo;( srurio3nodope lnei (  Dumxr ;t0aex ioctlt aDumumsnt4aetnxrcoy1omDeli o;s)teuo(opou4amtn ncsl(fs2tr(mpou0opx  ietysfs2ulnms u4altoir3oydfp e i s s)trtoxo3io1lm elfei (fsrua( oot1texoiociydfs em( o;t0tlenir iatoaD anes;( trto(o oudllt mnes t)srtrxmpnu4oleoiieiasfa2umu o;(4 exoxrcta1omDr n olt0texoim3oo1am emicslt arraumpnt0oltomieiytfa ran s ()tltoxfcta1fm  liei;t)s2xm(m oy1lm   nvil(f Dumuroot0alenmfeiatfsDua(ms;()tltnmrciytop rlneo t)srto(o iy4optn feta()aDum( onu1ole moeiyd m2eln o;u0tetomocto1fpD lnvi s) eumio3oudomtnmnviatfs2uru o;t0texomfeiadlsDelnvp u)texoifcto1lmD lu olt) 2trir3iudop e ivil(f Draumpnt0olxnioeiltlaDemnvo;t0 ltnir3oo1fmt li s t0tetrim3iu4ll emneia(faDtr(rpou1tltnmicildla2el(mo;u0artoxocia1fpteauvs;t0tetmiopnu1aptelnvtat s2rau  ;u0aex ifeiysfm2ul(mpnt)arxnxocoydom raivolt)s2xoxr oy4amtemncil( a2ur(mo;t1tlxnmfctlsfs ra(mp;(4tlerir3ta1omDeau olt trxr(m nu4apt lfcsasfsDtr(r oo0texomfeildlm ua(vsnu)aexrmr3ootla   i i t  rum(o3oodllenmfvtlt)a2rrumont0ale moctysls2ulnmp;u) eenmr todlp   uvi;t)sexr(o iudolen ies s aDrmx  nu1altomi3iytfs rmumsn(0 exrif iy1lmtranes;t srtr(opoy1lmtnlfetat  rrm(m ;o4opt io3iadfm rmnvp;t0alxoifcto1la  lu s;s0t2triopiudomtelfeias  Dtax pnt1texomictytfaDumn p u0texrxf tydlaD  ivo;t0trum(r3nodap nlics ( srrmx p;t1olx  i3tat m rm( o;t) lxoif3iy1lat  nvi;s) eto(r3nu4am nmietasfsrrrum ;o0olenmfeiatlm2ulnvo t0teermo oo1laDelneslt)s2xmim no4aleemfcs tfaDtr( p;t1olx ii3tlsfsDem( o;u0aexrmociydlptelueol()srtmxrpiudlp n fvslt  2ur(rpnu1aexnifeilslaDranmo;u4tlxrmfcoadlmtrlnes t s2urio oo1lltn fci () 2tru p;u0tltn o3ias a2ea(mp u4 lxoiocootop r uvo t) 2xr(m ou4lmtemnctl(fs2ur( ooo4ale  ieilsla2um(ms u)trermo3ty1om  li s s) rxoio ou1lp elfcslt)artaxm nu4tlxnii3tasfa2uluvp;t0 reomo3iytoatrlu s;s0trtrxo3iodolt  nvil( sDtr(rpot0opxoii3tatfm uluvpnu4alerxfciytlp  anei;t)setrio oudoltnlivsls)arum(r ou4tpt  oeiltlm emnmp;t4 rxoxf3ia1fatelnvol( seuoim3iu1alen iviasfs2umxro;u1aleomictltlm ua(mont0aexoxr oytopD aneils)seumir iu1ol emnet () ruaumoot4tlen f3tlt m2umnmp t4aexrxo3oadom rluvolt t2to(r io4om  licil( s2tmxm no1oet  fciytfm rl( p;u0arxomoctytlaD  i i;s  ruoirpio1apte fcta(  rtrxrpnt1tlenmi3iadfm2ua(von()tleoxocoydoa  lnvo;( teum(r3iodop   fvta(fs2trxr nu1tpt mfciyd m uanmo;(4tlxoxociy1la   ieils)srurim3iudlltemfvsatfsDrr(rpot0optnmi3iltfa2rm(vo t4tetrmrciydlpD an i t0texrxmpiodamenmfeia(fsrraxmo;u4oex  f3tydfa2umumo (4 rxoio3ootopDe i ols) eurirpiy4al nlfes sf 2ta(mpnt4oexo ocildfm uau pn()tlxrxo oodfaD  ivs t t2urxo iy4ap e nciat) rta(moot4apx ii3iasla2em(mp;()alenxfcoy1oaDeaies (0sexmim oy4lm   ivi t a2rrxronu0oltoiiciasfa eanvpnu)artrif3oydlm  ai o;t) 2tr(o3iydalen iviatfarraur nt1apenmieiatfa2rauvpnu0 ltoif iy1faD an o () etoio3iy1ol nmies s s2umxrp;o1oex  oeiytlaDra(mo t4 rtrxr3todfmDelieolt0 rtmxo nodamee fctas  rtaumpnt4tee mi3iysfsDean snt0artoif totomD anvs;t0setm(r oudlpeemiesat  Drru ono0aleoifcilsfm uluvo ()artoxocoytoa  auvils srtmim nodale mnetl()arurxr ot4aee mieilslm2ua(vs;t4aeenxo3oodfmD  uei;t t2tr(opnu4om   nes s)s2umu ono0tetn i3tadfsDrmn o t) rtnxf oo1fp  aivo;( srxr(m iydlp nmnei ( s2tmx pot1tptn fciadls ulu pnt4 ltnifctatopDe nei;s  eum(rpnydll nlfcil(fsruaum no1tpto i3ildls2ra( on(0arxoir ty1omDrlueo;t srtr(r iu1apenlfcsl(  rrm( pot0tpt mf3ilsfmDeanmo u0 rxomf iy1lm rlnvs t  2tm(r io1omtnlnvsatfsDuax pnt0tpt  f3iys mDem( on()tlxnmrciytoat  ieo;s0trtm(m3ou1opt miciat arurxmo;o4tpt if3tltla uau p;u0arxnxf oydopDrlnvils)t2xo(r3io4ap  mfcta(  rtm(r no4tle io3ilsfa rmnvp u)aeermo iytlpDelu i;s0sexo(r3ou4ameemicia() 2rr(mpno4oet iieilslm uaumo t)trxrxr3ootlpDelies s0t2umir ou4om n fctlt) rtmxmp;u1teenii3ils s ulnvp u4aleomo3oo1lp   nes;t) rto(mpoo4aleemfviat aDuax  ot4teto feiatfm ean p ()tlxnmf iatfat aivs (  2toxo oy1ol nlnctlt) 2trum ;u0tee moctasls ra(mo u0 rtoio3iytopt  n slt s2urxo ny1am n nci s  rrrx  nu0tle moetlt m uanms;t0 lxnxr3iydfm e ieolt0teto(rpnu1alt  ietat artm(m ou4openmfctltfs2el( p;u4altrxr to1omteaueo;s  exmimpiy4omt  fvt ()sDrr(mo;u1oex if3tydls2emuvs t0alermrcoytoa rai o (0srtmxopno1al  mnesltfaDrru pno1aexo i3iyd aDeau s;(4 etnmf oydoa r neol(0s2xrim3nodope  ies (fsDum( ont0texnifeiytfs2ul( o ()alxrif io1fp  ai o;s trtrxm3ny4apte fctatf 2umumpoo0oleniieilsfa rm(mpnu0texrxr iotlaD  ieo s0texrirpno1lptn iesls  rum(mont4oltoiieils sDemn pnu4arxrxoctotlmte uvs;s)s2xo(r3no1lmtn icil(  2tmumono0tpxoifciltfaDum(mo;u)areoir3to1omteai i;s)sexr(o3oudlm  lictl( sDtaump;u1teenmfetytfsDrm(vpnu0alxoif ia1lm elieo s0seurxo oydom elfvsas) Drmxrpou1altnioctltlaDrlump;(0 exrxo3to1la e i slt)t2urxo ny1ame lnvta()sDra(  nt4oeeo ocild m2ea(ms u4tlxnif3iydlm   uvolt  2urxm iudomenmnvs t)srtaxm ot0optniiciydfm ul( pn(0 ltnmf oatlm   ieol()s2uoxrpou1op e nctlt artmxro;t0oee  ieildfaDrmums;u0 reoif iotom   n ils  exrxm oy4lm elfvt t) 2tmxmpnt4olxo icild s2uluvo;t0alxomocoo1lmtraivslt)trxrxopoo4amtn fcils)aDum(mooo4ole  fctys a2um(mp (0 lxrxf3oytfmDraues s)s2ur(o oodlm elnctl(f rurxmoot1tlen f3iyt m ul( p (4tlenio3iotomte uvo s)t2xo(m iu4aptn nvsa(  2taxroot0aptomietydfs uln p;t)teerxf3todlmtr nvi s t2trxmpiy4amt mies s)srururp;t1olxoii3iadlsDel(vo u4tltnxr ta1faDelieo;s  exrxo3iu1lm  mnesls srrmx  ou1tpenmicils aDel(vs;u)tleoio3oatfm r ies t) ruoirpny1lpt mneslt) 2urur no0oex mi3ild m2emu p;u) rtrio ootfmD  ies;t0 ruoxopny4omtnlfvsa(fa2ur( o;u1tlen oetadlm elnvp t) eenxf3oa1lp   uesl(0teto(r3nydol nmieils)artax  nt0tpxo o3tydfa2uanvpnt)tlermo tytfp rlu s ( srtr(r ou1ame mfvtas  rua(rono1tleo o3iadfm2ulu pnu0texnmo oo1lmDeliesls)s2umxrpoy1oltnmfesatf 2tr(  ou4olxo f3iytfmDel(mont0tltoifctytomtelu i s  etoxmpoodap n ivils  2rmxrp;u4alx ioeiadfmDran pnu0trenmf3oy1laD  nvo (0seuoxo3oo4om n fesas) rra(r no1ole ifcils m2raumsnt0trxrio iydopDe neslt) euoim nudopt  fetat srtr(r nt4opx ifetytls2ean sn(0tlermoctodfpDraueo;s) rumxopou1ame lfvtasf 2tau  nt4teeo ictatla2ulu pnt0teeoxfcoy1fm rlues;t  2um(r iudap nlics s)a2taur ;u1tlxnmf3tasfsDrluvo () rtrmrcoodlmtraneo (0srxoxmpio1ape lfcias s2ra(mpno4tetnii3tytla emu s;u0trxoxf3iotfa  auvo s)srurxopoo1olte ieiat) Dtmur ;o0opxomoeiysfsDuanmpnu0 etriocoo1opDr u sl( trur(o3iydll e ivta(f rumuroou1tet io3ilt sDra(vonu4 rtrif3tytom e ivs;s0 exo(r iy4alte ivtls a2raxm ;u0teeo i3tltls emn p;t4tltoirctodfatrauvi t)s2umxopiy4olen ics t  Duaxmp;u0tptnmfctydfs2el( p;u)aetrio ia1fpDeaieo;t0 2umxopiudlleemivi sfs2urxmpoo4aetomieiltfsDrmn p ()trtoxociy1oate nvil( truo(rpiy4om n fci t srrru ono4tpxn fciltfmDulu s;(4 exoifctytlp e uvo;t)trtmirpno1aptnmfvsatfsDrmumpno0tetn oeildla2eauvs ()trxoxfciytlm elueo s0tetoir ou4lltnmnetas) rra( pno0tle  i3iys m ea( o;u) lxrio3oadlpDrlnvslt0s2umio io4lpenlieia(fa2umx  ot4aptn ieiyt m2ea( on(0 etnio oa1lptrauvi t0tetoirpnydole  fvs ( arur( pnt4oexoiiciydfa rlnmp t) ltrxo io1lpteai i;(0trxoio iy4ameemiciasfsrum(r ot0tleo fctldlm2em(mo;u4tlxrio oadlat  uvo;()s2tm(mpnu4aptelfesl(fs2tm(mont0opxn i3iat s elu p;t0altnxrciatlmD liei t teumio iu1lp elfvs sfartm(rp;u0alxomoeilslmDuau snu) lenmr tatfaDelneils) rxrim iydom  miviltfa2tr( p;o4oetn feiltls uanmo u4teeniociotlp eanvil(0t2xr(mpnu4llee feiat  2trx pno4tlxomf3ildls ul(vp u) ltrifctytfa  ai sls)setm(o oodlltnmfetl(f Dta(  nt0tltnmietysfmDrlu p;(0 exomrciy1lmD ai sls0trxm(m ny1alenmfvt t)aDur( pou0teen oetadls2emnms (0tlerxr3oadopte ivo;(0 etoim nudlle mfctls)aDum( poo1olt  fctytla ua( on(0 lenmf oa1lpDrlneo;s) etr(m3nydoltnlfci tfsrtmxm ot1aptnmieild mDrlnmo () rxnir3iydfp  lneo;(0teuo(m oy1om  livsltfsrraxrp;t1aetomieilsla elumo;t) lxnxo3ty1oat  nvs s s2urio3nu4omtemfeilt sDurxr nt4aetnmi3tad aDra(vo;(0tleoircio1lptrlu slt)trtoxo3oo4aptnmnct t) Drauronu0optnif3ildfa ul(vsnu0 rxomf tydlatr n olt  exm(m oydal nlieias)s2taxm ;t4tpe  ieildfa2emnvp t)tlermf3to1fmtrauvo;s)t2umir3oy4ap  mfcslt) Duau  oo1oex ifciasfs um(vs (0 exrmf3iatlatraueilt) 2umim iu1altnlfvt s arra(mp;t4oleo i3tlslsDuanmo;t0 eeoxf iy1optrai s;s t2trxm3oy4omt mieilt)s2rr( pnt4tleo o3tasfmDrm( o t4trtnmocoydlptr u sls texm(r3nu1omtnlnct s)a2rmx  ;o0tltoifcilsls rmumsn() eenxfcoy1fat aivo ()s2um(rpoodlltnmncia()sDtmxm ot0oet mf3ilt s ulnmp u0 etomrcoadoa  aivils0tetoim3ou1apeelfvslsf rtm(r ot4aptn ietad aDeanvpn(0 rxnmf3iadfaDrau sls0trtoir3no1ll e nci ()sDtm(  oo0altnifeils s2rmumsnu0trtrif tydfateluvo () etr(m3ny4lmt mfesa( sDrm(ro;u0tltnifeild s2ran s;(0 reomf oodfm e iei t0 rxoio oy4omtnmfcilt arum( poo0tpt  ociytlaDuau snt0aetrmr3tydop   nesl()texo(r3oo4ol nmneslsf 2uaxmo;t4apto octlt a2eau s;()aexoxo3ootlmtrauei;t)sexm(r oodolee ivsas)a2tmu ont0tlxomi3iyd a ul( p;t4tetnxf3todom r i slt)teurxo3iy4alenliei t)artaxmpoo1altomieilslm2ran ont)trermf oytomDrli i;() eumir nydop  lfei (fsrtrx pou0alt  i3iat m2rmu pn(4 eerxrciytfmDeln s s trxoimpnydolenmfcs t  Drr(m ;t4tpxnmfcilsfa2ulnms;(4altomf3totfmDeaieol(0 rto(r3ou1lm emncslt a2taurpou1oet io3iad a2rln s;u0 lenxociadlmD lneo t0s2tmxo3iudlpenlfcias  2ta(rpoo4aet  o3tyd a emnvpnu4 rtoxocta1oateli sl()srxoir oy1lpt mfctat) Drmx  ou1opx mo3iatla uanmo (4aexnircoadomDeai s;t)s2trxm oy4ll elivt t)arururooo1tee iietlt aDranms t)tetoxr3tatom   neil(0teuoir oy1op  liviat  2rmu  nt4tle ioeildls2ra( p (4trtrmfcoa1lp eaieo;s) rtrxopnodlpe  feils  Dum(mpot0teenmietadlaDemumon(4aexoio oadfa r n i;()srtoim3no4am n fci t s2rmxmono4tpx iociad m2el(mon(0tlxnmr3oa1lmtr uvsls)trum(m3iudlptnmncil( s2rau  nt1opx iieildls2eaumonu) rerircoy1fm  livs (0trumir3oodlpen feta(fs2rau  ;t4tpxomo3iyt m2em(vsn(0alenmfciotfmD  ivs ()teurir3nodalenmfvsa() 2ra(rono0teeoii3tatfsDem(vo;u4 ltrmocoy1fpt ai o;( s2tr(opiu1al   nvsltfsrurumoou4open ietas a r
\ No newline at end of file
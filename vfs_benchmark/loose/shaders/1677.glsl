@@ -0,0 +1 @@
+ivi (0 exrxo3oy4olee neslt srurum ;u1tlenifctyt m2umn p u0 exnmr3iytfmt lneil( t2to(m3ny4apeelictat sDuau o;t1opxniieiat s rm( p;(0 rxoxfctydlaDeaneols)t2to(m3iy1op elnvilt)sDur( oot0aee mfciytls2rlump (4trxrxrcoytfp r uvi;s srtr(opiy1ll elnviat a2ur(m ;o4tlxomo3iatfaDranmo;() rxoifctydfmt an s (0 rurim nudll elfci sfarur( o;o0aptnmo3iydfa ulnms t4 eerxrctodoptr uei;(0t2xrxo3no1lpeelneslsfarua(rpnt0aexn o3iys a2ulums u0arermf3oatfm  luvs;s)sexrxo3ny4alt licsl(fsDrm(mpnt4apeoioetyd a rmuvs u0teeomf oy1fpt lnes;t0teuo(rpio4ap elnvs (f rraxr nu4aet ii3tadlm umu snt0aeerxf3tadfmD au o;t srtrxm io4om emfcia( a2urx  ;o1teen fciasfm ulu p u)trermr ootlp r ivol(0 etoio io4ol e ncs (f Drrxr nt4aptn i3tadfa rmn pnu) renmo tatlate ivi;t)texrio nydaltemfviat  2urx  ;t1alx io3tltfm2ra( o u0 exomf iy1fpD au o;( t2um(o3iydalt  nvil()s2tax  oo1oex  i3iydlaDemuvonu)teenxrctatfmDrai ilt trxrir ny4opee ncia(  2tmu ooo1alen f3iysfaDum(ms;t0aeeomo3totfm  aueol(0 etoimpiu4openmfvsls) 2ta(m nt1alx iietat mDumumpnt0trerxf3iotfpt an i;s0 2uoxo nydll elicsat) Dta(mpnt4tex moeias s2ul(mont4 lxrir3ta1fa  aivi;t0 etrxm io1ap  mivsas)a2trxr no4oetn o3ilsfsDemuvpn(0 exomfctydomDraivs;s)seto(o3oo1op nmfvs () 2rrur ou4oltomo3iatlm ulnmp;u4 lxrmo ta1opD  nvo;()seum(r3iudlm nmivi (f Dtr(m no0aptnmfciadfm2umnms;u)teermo tadom rln ol(0 2ur(mpnu1lp  mneias sDrmxm oo1aptoiociyslm2rauvo u0alenmo io1fpDr u i;t trtmir oy1amt lncta()sDuaxmpno1opto o3iadfaDrm(msnu0 rtomf3tydlaDeanei;s  euoio oo4aptelfet t sDtm(monu1optoifetyd s2rmn s;u4 ltomrciy1opteai s t teum(rpiudapee nesat  2umxmono4aexo ieiltfa2rm(mp;t0 leomr todfmDeaieils sexmio3io4apt  ivi t)sDum(r nt4opxoii3ilsls em(von(4aexomo iotoaDe iei;( t2uo(m3nudll emncsas s2rru ont4tlx ii3iad a rauvsnt0 rxnmr3oa1fmDrlieo;t) 2tmxo io4lpe mfetls  Dta(m nt4ope ii3iaslm rlnvon(4tetnxr oo1lmD  neil(0s2umxm3io4om nlfcs t)a2umxm nt4tetn oeiytfm2ulnvonu)trxomr3ootoatr n o;(0sexoimpio4op e nesasfaDta(ronu1tltomfeiyd sDem(vp;(0texnxf oytfpt auei (0setrxm3iydomt mnes tf 2tmxrpnu0oeeomietyt s2rm(mon(4 leoxo ia1oat lu o s)sexoimpnu1lleemicia(fartrxro;t0optnmfetls m rmu o t0tetrxrcty1op   nvil(0t2xrimpoy1optn fesatf Dtr( pnu0apeo ociatlaDuluvp t4aeeoxr ootomD ai s;s)setrim ny4lp elncsa(  Dtmx o;t1oex mocildfmDeanvp t) leoioctotfatrluvi;t trtrxr nu4op elncsat)artmuroou4optnifeiltls2umums;u4trerifciatlatr nvil()srtoxopoy1ll e ictlt a2trxr ou4tee ii3iltls2umn snu4areoxf oy1omD  iei ()t2to(o nudale mnci (fartm(m ;t1oltnifetldfm elu s;t0 reoifcoydopDe ies t0trtmxr3oudamt  neta(  Drm(ro;u0ale mi3iatfaDrlnmp u4arxrio oatfmtrlueo;t)trumir iu4ol n ictl(fsrta(  nu1tet  o3ildfa2rm(vo t4tltnxf3oytlpt aieslt  2toxo3iodll nmivilsfs2ua(  ou0alt  o3iysfa uanvp;u)alxnmoctotlpDe neol( s2uoxo3io1al nmivsls)srumurono4teto ocildlm rm( o;(4trxomocoa1fmtrlieo (0tetrxm iy4lm n ivtas srtm(ro;t0oex  f3iatla2rlu snu0tleoxr ootoptraivslt  2uo(m3iudap emfeta(fsrra( pot0tpx  fetlt m rau pnu0alerxr3oatfmDeauvi;t  2tmxr3ny1ll  mnvsatfsDrmur nt4tlen fctldlaDemnms () etnio3totfpteauvo;t0seuo(r3no1altn fes ( aDrm( p;u4alxnmfeiatla ulumpnu0teenmo3io1opDr uvi;s setoxopnudape mnei s sDtrxro;t4tet ii3ildfs em(vs;t)altrmf3oadomteanvi;t)srtrxo oo4openmnvi t)aDtaxmont1oltnii3ildfs2uanms u0artrxr oatlptr i s (  2uoxr iudaltnmncs t) Dta(rpno1oetomocilt aDrauvsnu4alxrmr tytfmteaivi s0sruoio3io4ll n nei ()sDrmuro;o0opeomf3iadfaDra(vs u0tleoir tydomteaneol()t2xrxr3iy4lptn ics s) Drru p;t1tetnifeiltfs raump;(0 rxnmf3tytfaD anvi t)s2urxmpou1amt  ncsat aDum(m no0aex  fctldfmDrmnvsn(4tetnxf3iydfat livi ()trtmim iudameemfviltfsrrmu  no0aexomi3tatfs rm(msn(4tlenxrcta1laDraieils)t2to(mpoydame lnei s aDua(moot0aptnio3iysfs umumo;u)arxoxr3iatlm  aivo s  2uo(r nydllenlnesatfaDrmxrpoo0tlx ii3tys aDrluvp (0tlxnmo oydlmDelu s;s)texrxm no4lpe livi ()arrauront1oexo o3ilt m eluvo;t4altnifcoydfmDe uei s)seurxm iodal n nvtl( s2ta(rp;u4tleomictatla2emnvs t0arxomo iadlaD  ivi;t  2tm(opnydoltelnctatfaDuaurpno1opt  ietasfaDumums u0teermf todlatr uvs () 2umxopiodamtnlfetat)a2rmu oou0opt  f3ildlmDulu p;(4trxoxr oatop ranei;s0s2urir3iu4amtelfvt s)srtm( o;o4tlt iiciatfa umuvp u0 rxriocia1op rluvs s0texoim3oy1om emfvsl()artm(rpot0openio3ils aDua( pn() ltrir3iotoaDeaivi;() rtmxo ou1omeelncs s  2tmxmoot4tetomi3iydlaDem(mpn(4aeeoxo3iydfp rlu o;(0 etoio3oo4lptnlfctl(fs2ua(m nt4altoioctld m2rluvp (4aleoir3io1lp eai o ()truriopio4am  micia(faDrr(mpnu4tex iietlt m2eauvsn() reoxrciydopDr ueils)srurxm nu4lmen nvslt sDraxmonu4aeenifcildls ua( p;u4teermfcoo1fat  i s;(0 2xrxr3no1op elfvsltfsruax p;t0aeto f3iydfs2ean p (0 etrmf3totfp rli o;() rur(o3io4lmt  ictls s2rm(  ;o4ole iociasla2umumo (0 eeomr3io1lat  uvo ()srxoir3iy4oltelfvtltf 2tmx  ;t1ole mictlt aDrm(ms t0teermocootomt ai sls)s2tr(mpiudol   nes sfaDrmurono4oetn iciysla2umn p t)tleoiocoydopt aueo s0 rtm(r oy4olt lfvsa(f 2tr(rpou4aptnifciydlmDrau o;t4arerxo totfptrau s t0seuoxo iodamt lfetl()aDumurpnu4aee moeiydfa2elu pn(0aleoxo3ta1omtr nei;t setmxm3io1lp   fvilsf Dumur ot0alt mi3iatfs2emnmp;t4arenmf iotlmD  nvsl(0trurio ou4omenmnvt sf 2ta(mo;o4optnio3tasfsDul(ms u)aetnxf3iotopt  ueo;()seurxopiudopen nvsas  2tm(m no1optnmociad sDemnmo;u4aetnxfcoatlat  ieo;t0t2tmimpoy1lltemivsl(fa2rrx  oo0tltnmf3iyslm2uluvpnu)alermociatfatrln o ( trtriopou1lme  fesl()s2tmx  ;t1opt ioctat mDrln s t)arxoxf totomtrlnei;s)trxo(m3oodll  lfciat  2ur( onu0openmoctltfsDulnmp;t4 ltrmr oytoatelueil()trxrim oudam emiet t) Dumuront1optnmfeiytls uluvsnt0 eermr3oatfmDr n o;( trxmxmpny1op elnei t)a2trx oou0oeeniocilsfm ulumo;u4texnmo3totfa  luvo s0tetr(m3no4llt  nct () rrru  ou1oex  ociadlm rmnms t0 rxoio3oadfm  lieol(0srtmio3ny4lpt  feta(f Dururpnt0aleomf3iys sDea(mp;t4 ltnmo3iy1oa   nvs;t  euoimpiudlp   fvtltfsrumxr oo0olenifcilsfm rlu pn(0tlenxocoytoate ieo t0teum(m3no4optn nvias) Dtrum ot4olt  f3tyd aDraumsnt0tetoif todop eaivsl(0 2um(r3iy1ll nmfci sfsrrrump;o0texomieiysfs rlnmo;t4 lenmo3oa1optrau o;t) etrxo3iydale  ics t  2trxmpnt1opeoioctldlm eaumpnu)aeermocoo1lpt  nvi;t)texoxopio1op nmnvtlt) rtrurono0tpeoifctytlm rluvont)altnif3tatomtrli ilt0 etoxo3iy4om n nciat)aDra(mo;t1oleo ieildfm rl(msnu4alxnmocoydfmDr uei;(0srumirpio4op nlneiasfaruauro;u1oltn f3tyd s rmnms;t)trxrirciytfaD lnesl() rtoiopiu4lpt  ivsas s2uaxmpou1tpeo f3iysla rm(mo (4teenmo iytlm r uvs;()seur(m oy4om   ncs t) 2tm( ooo4tptn feiytfsDrau pnt0artrxr to1om eli ils) 2xoxo io4apenmncils) rrmu p;o4oeto oeilslm ranvo (0aleomrctotoa raivo;(0srtoir iu1llen nesa()aruaxmp;t1apt mocias s2uanvsn(0artrxrciotlm e ivs s s2uoxr3no4ll  mnct ( aDtrxmono1tpe  octydfm2umu p t0arermo3ty1oa e nvi;s0 exoxr nudamen netl(faDrmu p;o1oeeoiocilslm2emn pnu0 rermr ty1fateln ilt tetm(r3nydapenlictas srtmu ooo4alen i3iytlaDulnvs u)alxrif3oo1lpte u olt)texrimpoy1opt  ivil( aDuau poo4tlxomfeiysls emuvsn(4 exrmo oa1oaDeluvslt0trur(o3oydomtnlnesasfa2trumoot0texnii3tlslmDrmuvs;(0 lxnir3oy1omt aivi (0 exo(m3nudlmen ieslt s2tr(mo;u0alxoioeiytfsDua(vonu4altrirctatlm   nvil(  eurim oodaltelnei (  Duru  ;o1opeoioetyt m rmuvo;()arxoio3oo1fptrau o;t) ruoio3iydam nlnvsa()a2rm(m ;u4openifciad aDuluvo;(4 eerir iodfpDrlu o t trurxm ou1lpeemneiatfaDtr( ooo1aeeo oetad m2ulu s u)tetoxo tydlmt aieo;(0s2ur(r iudlltelncsl( arraumono0apx  octld m ua( s;(0 rerxr3ia1om rlies;t)trumxrpio1oltemfeil( sDua(  nu0tle mietltlaDraump () exnioctytfmte u ils t2xrio oy4ameemfvsl(f Durxmont0tlx  ietltlm eauvo;() lenmoctodfm eai o;() 2xo(rpoodaptnlnvs s a2raxrpno0optnmfctyslsDelnmo u4arxnmociotlmD lu o;s0srxoim3iudolenlfcta()artaurp;o1aptnmociyd mDua( on(0 rxoxocia1latrliei t0trxr(r io4olee neilt aDraxmo;t1tlx  i3tyt s2uan o t4tleoif iatlmteanvs t0 2xrxmpnu4apt mfetl()arua(mo;u4tpxnmictlsfm ulu s u) rtrifctodfmDe ies;(0texo(opno4olee fcslsfs2taxmpou1aptn iciat s elu on()aexnif to1lmD au i;s  2uoimpiu4op n fes (  Dtau  oo1tleo ieiyd m eaumpn(0trxnmociadlatr uesl(0 ruoxr iu4lpe mfvsa(  Drmu o;u4tlto feiydfs rau snt4artnmrcoodlpt  nvs (0srxrxr3iodll  mietlt aDum(moou0opt  icias s2em(vs;(4texnxo3iodoatrlu i s0 rtrxm iy4ap emfvia(fsrtrxmooo0aeto o3tas m ra(mp (0aetoio3totlpDe uvils0sexm(r3oo1ol n iet tfsDua(m no0apt mieildfmDuanvsn(0artnio oo1laDr u i;s)sruoxo3oo1ape  iciatfaDtmum ou4olx if3tltfm2ua( snu)teermf3oadla  lnei () rumxo3iodope lncta(f Dtaxr nu0oeenifeiadlmDeluvpn(4 lxomociatlpDr n o;t0seumir io1altelnvsls sDurxr ;o0texnmfctys aDelu o;t0 renio3oa1laD an s ()trtr(o3ou4llenlivs ( arurxro;u4tpe ifeiadfa rauvpnt)texrif tydfmt  uvils t2toirpou1omeemiei sf 2rau p;o0optn ocildlsDuln o (4aeermfciadomtrli s (0srxoimpny1optnmnvt (  rtmxrpnu1olto i3iasfm2emuvo t0 rxnxo3iy1lpt  ueo;s)t2xr(m iy4amte ncilsfsDtax p;o0oeeomocild m2ua(mp;t4aexoio3tydlaDraues;( texoio no4aleelnesa(faDra(mp;u4texomicilt sDeaumo t)tetrmf3todfmt liei;t0 rtmxo3oo1apte ieilt)sDtmxm ou4oetoif3iysfaDea(mont4trxoifcty1fa eaies t)srxoxr3io4lmee ncs sfartr(r nt4aetn fcilsfa ea( onu4texrir ta1om elnvsls) exrxr3nodlp emnvsl()arrmxmpot4tpe io3ils aDua(ms;u)arenxr iytlatr i i;( sruoiopnydlmt mfesa(fsrur(m nu0tlx mf3ilsfa2uau o;t0tetnxf3tatom e neol(0srtr(m oydlp emieiat)s2ta(mont4tleoifctytls2emn o ()aetrif oy1omt au s t0 etrim oydom elfeiat srrmumpot1altoiociyslm ulu s;u)aexoxo3oytomtelivolt seur(r oudomee ivsl( artmu pnt0aetniocils aDrmu s;u0arermr3tadfm r ivs;( srtoxrpiy4ap nlnct t sDrmx oou4oetn feiasfaDumu pn(0 lerifciotla r ieo;( sexm(rpoo1lltn ietasfsDtmum ou0tlx io3iysfa2raums u0aetnif ootfpt  i o;t)tetoir3oodll n ivt ()s2urxr ot1tlenii3ilsfaDrlump () rermoctodfp  aivo;t trto(r iodalt  nes tfa2urxro;t4aeeo ociysla2rmn s u4 etrxr3oo1opDrli s;t)trxr(m3iodal emfci t) 2uaxrpou1aex  f3iadfa2eln p;u4alxomo3oodom rli s;s trxoim oodomtnlfetat a2rmxm ;t0oeeo ieiyslmDrl(vo u4texoir3tytfpD  ivi;s) rtm(opou4amtemfcs t)arrrxro;t1oee iiciyt sDrmu s (0teenxocoodfp rlivo t0 rtmxrpiudomtn fvtlsfsDrm(r ;o1tlxo f3iytfm elnvsnu0tetrifctatomDr nei;s) rtmir nydomt mics tfa2uru  nt1olt mociaslm ul( ont0trtnmr oydoptranvi;() exrio iu1apeelfcsls)aDrmxmpot1oltoii3tas sDea( o t)aexomf3oo1op eli olt0 2toio3nodalenmncta(f rrrx oou4tle moeiys sDrl(vpnu4tlxnirciatlm eanvi t)s2tm(m3iu1opte ietls  Dta(monu4aeeomietaslm2eaums u4 etnioctytoaDraueo;t)t2uoxrpny1am n nvils)a2uaxm oo4alt  oeiyt s ul(vs u0alenir to1omDeai i ( seto(m iudol  lfcs s a2uaxr ot0oexnifeiysls ua(mpn()trxnifctadfpDeaues;t) eurim oodaltnmfvt sf 2ra(r ot0oee mf3iyt m2eluvs u0tleomr3ia1fa elieils  2toxo3nodalenmfcilt) 2uaump;t4alx  oetyd m rluvo () rermo iydfaD ln slt0t2tr(m3iy1opt micsat)a2taum oo4oetoifetlsfs2em( p;u0trxnmfciatfmt lnesls) exoir ou4oltnmieilsfaDtmx  no0alen f3tad m2ra(vsnt)aleoxr ta1lm eli i;s setmxrpio1lle lfeiat  2tm(root1apeoifeiat a umu p;u4texoircoa1lp rauvslt)s2uoirpiu4lleelivi t  rra( pnt1oetn iciytfm2emnvpn() rtnmo oodom   i ol( s2trxo no4omt mfcils) Duru p;u0aex mociltla2ua(vs t4trtnif3oa1fmtran olt)tetrim iu1lm e ieias)srrr( pnu1tlt mf3ildls eln s t4 rxnmociotlpDr neols0 exmxr3iudoptnmfvs s arur(m ot0oltnifeiyd s2rlu p;t)texomociy1lpDeaneilt)tetmiopny4lpenmnei t aDtmuront0tpenif3iadfmDrmnms;(0arxoxocootfmt  i i s0t2trxopny4lltemfvt t s2um(r ;t1tpeo fetydlsDrauvpnu4teenircoadfa elivs t) eum(m ny4apenlnvslt s2uaurpno4tetoio3iysfs el(mpn(4alxoiocio1fm rlivol()s2urio3iydlp emnciat a2trxmpnu4tleomiciyd sDem( p u0trxrif iodlpt aueslt tetmio iy1opeelivias) rtrum ou1olx  o3iasfs2emnvp u0 rtnxr ia1lpDranvi t)tetmir no4oltnmivsat sruru ont4opt  ictlsfm2elnvp u)arxrmo3iy1opD lnvo s t2xr(r oy4am nlfeias)aDtaxro;u4ale mietasfm2ranvo;t)teermf3oo1lpDrlnesl(0sexo(mpiy4op n nvtls) Durumono4tetnioctysla el(vpnu0aexrmrcoa1fptr ivi s) 2tr(mpiudlpte fesltfs2um(r oo4aexoifctlsfmDuauvp u4aexrmf3oadoatr i s s teur(r nu4ll elfvilsfarrm( ont1tee if3iys s2ra(vo;u4 exoxfciodom  an o;(0s2xmim oy4lmt mnvtltfaDumxmoot4opeomf3ias a rl(ms t4 lenmfcty1opD  uvo;(0 rxoir iudam n fctls)s2urxroou4tlx mo3tlslm2rmu s;u)tlxnxo3iotfpDranei s)trtmxrpoodoptn fctlsf Dumu  oo0opxoioctyt m2rmn pn(0 eeomo oy1op e neo (0 exmxrpoy4amt lfciat) rtrxmoot4tet mo3tad m el( p u)trxomo3ta1omDrlu i;s  etoir no1lmt lnvta()a2umur ot0aee iicild sDrmuvo u4teenifctydlpD auvi t trur(opiodaltemfesatfs2rrump;o4oltomociltfs2umnvo (0arxrxr3oydfmtrluvs;t) ruoxrpiodolt mfctas srur(mp;o0tetnif3ias sDemump;t0 rxnxf tytom e ieilt0sexmxm3iudoltemicslt srrmu pou0oetniiciadfm2ulnmp;(0aeeomf oytlaD livo ()trum(opnydalt mies sfa2urx p;u1openioetltlmDrl( s (4alenmo ty1fmtrai s;( t2xm(mpou4ope lfvtlt)artmxrooo0olx iociat sDumnmo (0tetnmfcoytfmDrli ol( tetmxm io4am elneiat) rurxm ot1tetniietltfm2ea(mo u)artoxf oa1lmD au i;t)teto(r3iy1lmtnmics t)srtmxr oo1olxnmfciltfa2rl(vp u0 eerxo3oodfpt anes;t teto(m iu1lptn ies (fs2rmxrpnt4aexoif3ilsls2el( ont)tlxrio3iodlaD  u o t teur(opiy1lpte ncsat srtau pou1alxn f3iasfa2emn snu) eerir tydopDeauvo;t)teum(o3io1ome mies tfa2rmx onu0tpxo ociytla uaumpn() rtoir3ta1opD  uvil()s2xmxo3ou1op  lfeilsf Dtr(mpou0tlx mfeiysfm eln on()altrif3oadomtrlu i t t2uoim iu1al n ivta(  rtm( oou0apxnmoeiydfa rauvp;(4alermf3io1fptraiei () etrio3iodomtelfei t srtmurp;u0tlxomocias s2umumo;t0aexrxocoo1opt  ivi s)s2umxr3no1om  lncsl( s2rrumpnu1aet mietysls2ranvs;(0altrio3oodoaDelnvil()sexo(o3io1amt mfeia(faDrm(m no1texomo3ild m emnmpn() rtrmr3oydla elneo ( srtr(opiydlleemncs t)s2ta(  ;o1tet ifctlt m eau pnt0 etoxf oadlpD luvo;t seur(o no4altn nciat arumu  nt1aeen oeiat m rln s t0alxoir3oatfa   ues s)tetoiopiu1lleemncsas sruaxr ;o4opx ioetydlmDumn ont) etnmrcty1faDeai i ()t2xrxopio1alte ies s)a2rmumoot1optomieiadlmDrm( s t)arxoif3ootopteanvo s  2xr(o ou1olen netls aDraxr ;u4aptomi3tydlmDrauvp (4trxoif3ty1fmD  u ols) 2ur(r3iu1ol nmnei s) 2taurp;u4apx iociytls rln snt4 rtrxocia1fp e uvo;(0texrimpnu1om nlnvs ()a2urxr nu4aexnmieias s umu o (0alxnmo3iydfmtrau s;t t2xm(m ou1lltnmfcslt) Dtru  nt4alenio3tltfa rmn s t0 lenxoctatla r nvi s0t2tmxm3iy4omtemnci t  rum(m ;t4olenifeiydfmDrl( o t0aleomociodfpDeanvo;(  rtoxrpno4omt mivtl(f Dum(moou4oltnmocild s2um( s;t)altniocta1la elnei;(0srxoirpio4lmen ict s artr(monu1alxomictatfm rauvs;u0 lxrxfctodlpteanvo;(0teuo(opiu1lpenliciatfsrtrxmo;o1aexn fetldfm2rmu snu4 ltoif tadfaDeaivs (  etoimpnydlp  liesl( a2rrxmono4aetoioeildlsDua(vp;t) exrir ta1om e uei t0setmxr io1ll elnet tf 2ra(r ou4alxo oeiytfs umuvs;()tlxnmfctatoa  lneols0seuriopnu4alt mfciat  2uaur ;t0opxniieiyt aDrl(vp;t0 ltrmrcty1laDelu o s trurxmpiodaleelicsa(  2ur(m no4aexomfetytls2emn onu)arermoctadfm elues s  rumirpoo1amenliesasfs2taur ;o4tpeoif3ias a rau o;u4trtnxf ty1lpD aivo s0t2xmxr3no1optnmfeilt s2ra(mp;o1apxnioctldfa ulu o;t0 etrifciytlaDeln s;t0s2xoio3oodolen ncslsf rurx  ;u0optn fctydla rau s u0 rxnio3iatomD au o (0s2to(opou1amen ncia(f ruaxrp;o4oeto ieiasfsDrm(vs;t0 rxomrciydfp r nvslt t2ur(mpiodomtemivtas  rur( p;t1tlx  oetytla elu snu) rtnir tadfpt auvi s trtmxo3oudoltnmfei sfsDta(r ;u1openiietas s ra(vs () lxnifcoa1lptrlu ils0teurxo3nydll e nvsl()aDraurono4tleoiieiadls2emuvp;(0 etnxoctydfmDr u o;t0s2tm(r3oo1ame  ivsa()aDua(m ot1aexoiictad aDuaump (4teerxf oodoaD ln olt sexoxr3iu1alee ivsa(fsrumx  ot1oetn oeiltlm ulu s;(4treomr iydfateaieols0trxmxrpoo1lp e fci (fs2ra(r ou1oeeo ictldfm2umnmp;t0 leoio3iy1fateliei t0 exm(rpoo4alte fcils s2tm( poo0tetnifeiatfs2umump;t4texnir3oydoaDraivi;t0setm(mpiy4lm   fcsl(fs2tau poo4apt iociytlaDemumont0texomr3tatopDelu s t0 rtm(o3iydlp  mivtl()sDta(rp;o1teeniieiysfa2rluvo t)trtnmr iodlaDe u i s)seum(o io1om e fvt (fs2rrxmoou4aptnioeiatlmDranvsnt) ltrxf3tydlaD aneolt0 2ur(mpou4lpenlfvs ( s2tr(m no0aetn f3tlt s elumo;()arermo to1om r u s t t2xoir ou1ol   neslt  2urxmpnu0oltn f3ildfs rlumo () rtoxr tydop elnvi ( seto(mpnu4lm e fctas  2uax pot1alx mociasls ua( p;t4tetrxf oadlpte neo;s)srxmxrpiydlm nmiei sfs2tm(m oo4olen o3tadla eluvo;(4 lxnif ia1opt aues t  rtm(opny1amte ieils)a2ta(r nu4texo f3ild s eanvsnt0 exnmf3iy1latelnvs;s  exm(o ou1am   nvsl( a2tau poo1opxo octad s eanvon()tltomf3ootfm r i o s0s2urirpnu1aleemictls  rurur ;u4oexo ictls m umnvp;(4altoif tydlaDelneo;s s2tr(m3io1lp elfvs tfsrraump;o1teeo fciltla ranmpnu0trerir tytom  ln i;()trtm(r oodlm n fvta(f rum( o;u1tpenif3tad sDem( pnt) eerxrcty1fmt  neslt t2urirpoo1omenlneta()a2rrxro;u1opto i3iysfa2el(mo u0 rtomrcoydlpDr ueo s)trtmim oodlpeemici s  Dtru onu1tlenii3ias s ranvo t0artoxociotoa r ueilt)s2to(mpiydll elfet s) 2trxro;u1oleomo3tatfs2rm(vs (0 etrmr3oa1fm raiei s)srtmxm3iudamt lnvtl()aDtax  ;u4aptnioeils m uau p;u0trxrmfciytlat li o;t0texoxrpoo4al n ivsl(f rtrxmpot4aeenmociltfs2uluvon()alxnmr3ty1fa  livs t0texoio ny1lpe  icia()srtru pno4tpx iociadfmDum(vp;t4trerif3io1fat anei;s0seuo(opoydaltn netas aDtrxronu1aeenifeiyd aDrmuvp;(4arxnmf3tytoa elnvi ()s2umxrpny1am  mictat)sDtmxroot0tpxomf3tydlm2rln snt)artnxo3ta1oaDeai ilt seto(r3iudapenmnvsas a2raxrpoo4tle mociat sDemn ont0tetrio3oydlptrlivi;(  etoir iy1llt  ictat aDtm(rpot1tetomoeils aDem(mp;t0 etnxf3oodlpDean o;s  2urxmpny1ll nmfes t)sDur(rpot4tpeniieiatla uaumo;u4 eenmfcoa1fmD anesls)t2xoio3oudaltelnvtl(farrrumoot1alenio3tydla rau s u)treoif3oa1lptr nei ()sruoxrpoy4lpeelfeta(fa2umxr oo0ope mfctltla2eanvsnt) rxoxf3ty1oaDeauvs ()teum(o3ou4amt mieta() 2trxrpoo1oetomoeildlmDem( s;()altoif iatfm   n o t seuoim ou1op e fvtl( sDtaxm oo4tleo feiasla elump;(0artomr oa1oat an s;t  2tmxo3iy4ameelfcilsfarua(rp;u1olxoifciytlm rln sn(4altoxr oa1opDr nvs;s srtr(r3oy4ape mivilt  rtr(roou1tpen oeiasfsDea( p;()tlenxo3tydlaDelueo t0trto(rpoy4lp emneslsfsDrmx oou4oex  ociyt s ranvp;u0 rxrirctatlpt lnvi ( teumim3ou4aptnmncsatfarrrx onu1oetn o3iydfaDemnvs (4 lxoxo3ty1lmtrlies ()t2xoxrpiy4lpte fctl()sDtrxmp;u1alx ifeils a2emu onu0tetomo3tatlp raivilt) rxmxm no4ll e iei t)a2uau onu1tpxn iciasfs rauvont)alxoio3iydfm rli s;t)trtoxr io4al   ivilt)aDtax  oo0altoiictlsfaDulu s (0aetomf3iytopDrluvi s)seumxr3iu4lme mnei sfsrua(  ;o4aee  i3ils aDumnvs (4tlxomocio1optraivi;() 2urio3oy4al nmfet t  rra( poo0tlx iieiydls2rlumont) renif3iytlpte neslt srtoir iy1alt mnci tfa2rrumoot1aetomo3iat m2uluvsn(0trxoxfcio1fpte nvo (0sexrir iy4lpt mivil(f Duru ont0apxn feiat sDrmnmo;t4 lenif ia1om elu s ()trxoiopoy4ole lies sfsDum( ooo1teeo oetldla2elu s u0 exrmo3ty1lmD  u il(0 rtm(m3iudlpeemnct t)aDuax  nt4oexnmociad s rlumo;(4 exrmf oatfpD lneilt0 euoir io4llee fvsa()sDuaxrpou4tlxnifciytlm uanmsn()areoxr tydlmDr uvilt0setmir iudopt mncs t  Drruroot0alxn i3tadlsDua(vp t)texnio3oatla rluesl( sexo(m3iu4ome liesasfs2raumpou1texnmi3iadfsDran o (0 etoircoa1omtrlivs;t) eurio oo1llen fvsl(f Duaxm nu0teeoii3ild m2ulnvpnu4 exnmr tydfmte n i;()texr(rpiydlm nlnvias s2um(rpoo4ale  oeiatlm2emumon(0 lxoxf3to1laDean i;t sruo(mpiu4ol nmivilt  rra(  ;t4aetnif3tytfa elnmp u0aexnmociytfm  luei ( t2tr(mpiodam elfeilt)s2urx  ;o1tpt ifctasfm umnmp;u)artrmo3tydfpt livols  rxoio3oodapeeliesls)sDtaur nt1tlenifctas aDranvp;u0aeenio3totop rlieo ( t2urxo iy4al   ivsa()sDurx ont1aexoifciytfm rl(mp ()trxoio3tytfmte u o s0s2xo(mpny4omtnmfesltf 2trxronu4texn oeiysls elump t4texnio3iy1fm rlu o;( sexmimpoo4al  lfeils)srraumoot0aeenii3tlslaDrm(mp;u) exoifcto1fa  lu o;t  eumxrpnu4lm emicsl( s2ua( pou4openio3tydls2rmuvp;t0 lenmf tatomtelues;( sexr(o3oy1lm emnviat)arumxrpot4teeoioctasfs2eln o;(0trxrir oatfatrlnesl()trxoio3nudlmt lfcs sfarrau o;u1tpx ifetltls2em(msnt0areoxo ta1fmte nvi;t srto(mpio1lmt  ncsa(fa2ta(rp;u4tpxo i3iytfm2um( o;() etrxr iadomteli o;(0 2tmio nydopt lfctlt)a2rrx p;u4olx io3iad a ua( pnt4tlxrxo3tytfmtrlueol(  rumxr oo4lltnmnes s)sDtm(monu1tetoioeiysfs2um(mo (4tetomr3iytfaDe n ils sexrim3oy4lp nmneilt) Drm(r ot1oeenmoctltlaDul( ont0trtoxocoodlmt  nvils0truoim ny4llt lncs (fsDtaxrp;o1aptniictld aDrmnmo u0trerio oatoa   ieo;( t2trxo3oy1ope lnvs t aDuru  nu0tetoioeilt m rm(vo;t) ltrmo3tytom e i o;(0setm(mpoy1ol  lfctl(f 2uaxmo;o1aleoiictysla rl(ms;u0aeeoio3iodomD li ol( t2toir no1lp  mnvtls s2rrumo;t0aleo oeiatfs ea( snu4aexomrciodfpDrlnvo t  2uoxr io1alt mfes tf rrm(roou0oltomociyt a ranvonu0arxoxf iatopt  nvs;s0 rtmxo io4alee fesl()sDrrumpou4teen feias aDra(monu0treoxrciy1oateln s s0sruo(o3no1optelfciltfsDra(mo;o4opxoiociltlm2ul(vs;u0 reoxr3oo1fp eanvi t0s2xmxr no1lpee fct sfa2ta(ro;u4tetnii3ildfs rlnms;(0trenxfctotlpD au o;t0srtr(rpoy1ol elfvtlsfarurxr nu0oexnio3iydla ulumpnt4 rxnio3tatom rau o;( trxriopoy4lpeemfcia()arua(m ;t1tptomf3tydlm2rmn o u0texoxo3totfmtran slt trxmir3io1lpt  ietl()a2rmxmont1opeo ietys m emuvp u)arxrxo3ootfpDe nvo t0setr(r3nudlmtemnei t) Drm(rpot1aptnifctasfs rm(ms;t4alerxo3todlpt lu i;s0srumxm3ou4apenmfvtat)sruru p;u0alenio3tydlaDrm(ms;t4 lxoxo3tytlpD lueil()teuoio3ou1lmtnmnvi (  ruaxrp;u0opx mi3ias sDra(vonu)alxnifcoo1fp e uei;s sexmxopiodlpeemncil()aDtm( o;t1oltnifetatfa2umnvo;u4 eeoxocio1lpDe n i;s)teur(rpoy4lm  lnesat)a2tmu oot4aexnii3iyd mDrlums;() exrxfcoydlpD  nei;( trtoim iy4lpe miesatf Dtrurpot4teenifcild sDrm(mo t4aeenmf iytfatelnvi s trto(o3nu1al   fciasfsrtruroot1aleo oeiadlmDulnmsn()aexnio todom r ivs t  etoxm nu1omtelnvias)aDuru  nt4tlx  feiltfs2ranvp ()teerxo3oytlp r i o;( trxo(opoy1apeelnciltfs2rruro;t0tlx ioeiatlm ul( s;(0texoxo iotlmDran i;(0 etr(opnu4amt lnvs (  2rmurooo1apto ictysls rl( onu)trtnmr iy1fptelieols0 rtmxr3iu1opeelfet tf rtrx oou1opx mieilsfm2uluvo u4alxrif3oadoa r neilt0seuoir iy4apte feias aruaxrooo1tpt  ieiltfa rm(mp;u4artrifcoydfa r uvo;( texmiopiy1lp   feiat  Dtax  ou4ope miciatfs2rmu snu) etomf iy1om elnvsls  2xmxmpoydlptnmfvsatfa2ur(rpnu0oex  ieiadfs2rm(vs;t0arxoxr to1om r nei;s) 2xr(m3oudaptnmiviat  rururpoo1tpxo f3ild a uan pnu0alxomf iotfptranvil( srtmim3iy1apeelfci sf rurxr ;o0tlx ioeilt mDumn o;() rerio iytoateaivs;t trxr(rpiy4apee fct t)artrxm ou1tetnii3tld m umnmo;u4trtrxo totlpteauvo ()seto(m iydoltnmicil()s2umu p;t1tpt ii3tasfm ua(ms (0arxnmfctytom eauei;s teuoio3io4lpeemicilt arumu ono1aeto ictatfaDrmu o u4alermo oa1fatrln o;t)t2trio oy4lpee nctas sDrax o;t0tlenmoeiydls2ua( o t0 lenxfcoo1lpDraneo;(  exoxr3iudlp elncs t)s2rm(roou1oexomicilsfa um(mp;() exoiociatfaDrau o ()sexrxr3nydlm   fcilt)arrm(ro;u4openioeiys mDrmnvs u0aetoxfctotfp e n sls  2uo(m3ny1omen ncsa(  2uaxmonu4aleomieiytla emu p t)aetnir3ta1fmD  uvs;s)texrxr3oo1lpenmivils a2tr(m ;t0aex  feiadlmDemnvo t0arerif3iy1oat  uvs ()s2um(m oudoltnlfcil( sDumxr ot4tptnifetadlaDulnmont0trxnxf iotfate uvo s teumim3ou4om emivsat)a2tmxr oo4oet iictltfmDrluvonu) exoio3iydopteluvo t) rxoir iy1op  mict ()a2rau pnu0aeen f3tys s umnmo;u4 eenmrciy1laD aneo;() euo(o3ou4ol nlfetl(fsDraumoou4alxn ictld mDra( o ()texoxo3oadop e nei t srtoxm3ny1ll n fvtas a2trxr nu0aee  fctltfm2ul(mp;u) exniocoydlmt livo;t0 rxmio3iudlltnmies ()aruaxrooo1aetnmietysla ulnvs;(4aeenmf3iatom  aueo;s0t2ur(o3ny1lle  icsl() rumu o;o0olt  o3iad s rlnvo (4texrxf oydlmt  ueils trumiopoo4lm elfvilt aDurxmpot4alt  iciadlaDuanmo t) lxomrcia1lmt lneolt)seuoxr nodlp e nctas  rrmu  nu4tpt mocild a2uan on(0 rxrxocio1lpD anvslt  eumxm3no4lpte ncias)arta(rooo4opeoiociydls rm(vs t0teeoifcootoa   u o;s0srxr(o iy4oltemfesa( aDuaurpno0oexomfctytlm2ulnmsn(4alxomf3tadfatelnvsls0 2urxopoudapee fcsat a2rmumo;t0tle  feildfa2rl(vo;u0 etnmrctytlp r i ols)setmio oo4optelnct t)s2ur( pou0oexomictys aDrmump;u0treomrciytfa eli s;(0teumir3ou4olte fvtltfsruax o;u0olxoiietlt mDrlump;u4trxnio3oatopte ueilt)srxmxm3ou4alen fctlt)artrx pot1aex mfetldlm2ean o;u) etoif todom   uvs ( srxm(m iy1omen fcils) rrru  ot1opto iciadlaDeaumo;t0 rxrmo iotlpt lneil( trxmxmpny4ap   ncs tfsDtrumpou1tetn ietlsfa umn pnu4aetrxr3tatoaDr uvi ( teuoxmpiydlm nmicsl(farurxront0aetnif3iydfs2rmnmp;t0 etrir oo1fp eauvols  etrxrpou4apee fetls)aDra(moot4texoifeiltlm ulumo;t4 ltnmfcoo1fa rauvo;t)srxm(o oo4om nmiviat)srumu  ;o0tpxnifeiytlaDua(vp;t0 eeoifcoadfaDeliesl( setmxr3nu4al   ici tf Dta( ooo0aetnioctls m2rauvs;u) rtomf3tytomteli i t)seuoxm3no4lmt miet t srumxro;t4tltn ictyt m ra( o ()aetrir iadoatraues;(  exo(r3nu1al  mfvta()sDurx ono1altoio3tys a2elump t)tlenircoytfa  au slt0tetr(r no1opt  fei ()a2rrxroot1tlt mfeiatfaDulnms;(4 exrio ia1lmtraues;t texo(m ny4al nmivsl()srrmum ;u4tptnmf3iadfaDumnvpnu)trxrmr todomtrli o;(  etrxr3oo4ll e ivi s aDta(ro;o0texoiociltfmDea(ms t0aexoxo3oo1fmt  i o s0 2xo(o oo1am  micsls  rraurono0tle  iciysfmDelu snt4trermf oydlaD luei t t2ur(r3nydape  icsls) 2trx o;o4tpen f3iysfsDrm(mp u4trxnmocio1faD lnvolt)t2uoxm3nu1olee fvsas)s2rmxr ot1oltoioeiys m um(vp;t4 etrxr oadomDrlivil() etrirpnudol nmnvs s)sDtr(  nt1apx  fciys m2ra(vo;(0altoxoctotomD liei t)srumimpio4llt mietls  rtrx oou0aptnmf3tytfs uanvo;t0 exoio iadfmt lieo (0s2um(mpnu4amte fvsasf rtau  no4apt  oeilslm emu p;()aetoiocio1opDranesls0 2uo(m iy1ale  ivsasfarua( o;o0aptnifciltla el(mp;(0 lxoxfcty1omtr ivils0teurir3nydame mivta(  ruru o;t0apt ioctytfa em(vpn(4 eerxr3ia1oaDr ivo;s0texmxo no1apt mfes sfs2rm(mont1olt if3ildlmDul(vp (0 rxoxrciydopt aieo;s  etmxm3oodlmt mfetlsf Drrxro;t0aptniieiad s uan pn(0 rtrio iydlpt aivo;s) 2xm(r oo4ll nmivi ( arururonu4texn fctlslaDel(vo t0 reoxf todopDe ues;() 2xo(rpoy4am  lfesat  rrrxro;u0oetoioetasfsDuan sn(4 etoir3todopt  i o (  ruo(rpoodape  nciltfa2rmx pot1teto feilsls rmu onu4aetomr3oa1lpDeanvo s teurim3oydlpt mfctasfaruau p;u4tle  fcildla ea(msnt4 rtoif oydlm  li o;s texoimpoo1omt  ivta( sDumurp;o1tlxo ieiaslmDeauvpn(0arerxfciodomtrli s;t)sruo(r3nudoltnmfvi tf Duaxro;u4apxomoctatfsDuluvs;u4 etoifciotlmDe uvs t)t2tr(r iy1opt lieilt)arrrx o;t4alto o3iatfs eaumont0teenir3oodom  anvolt0 2xmio3oudol nmfeia()sDrmurpoo0tex ifeiytfm2el(msn() eerxrcio1omDe ivi;s0truoxo no4lm  lietlt arrr(m oo0olt mictyt mDuaumo;() lenmr oodoateluvo;s) 2trxmpnudalen iet s  Dtrxm ot4aeeomoeiatlaDulnvs;()trenmfcoadoa rau o t0s2trxmpiy1lpte iet s)s2rmumooo4apto octad m2emuvs;() ltomf oatla eanvs t t2xo(r iodal emicsas) 2rmur ou0oleoifeilt a2ea(mp;u0texoxocoydlpDr n s;()t2toiopnudlpee ivt tf 2rrxroot1ole ifeils a rlnmpn() rxrmo totfm   ueols)s2ur(o3nu1ameelfetasfs2umxmo;t4tlxoiieilslsDel(vp u) rtnmr ia1oa  lnvi;s0teurio3oy1llenmfci ( sDra( pou1tpenifctatlmDea(mon(4trxrmr tatomt livs;t0 2trxr3io1al elfeslt aDurx  ;u1tlto icils m rm(vp () rxnir3iytfa e i i ()setoirpny1ap  lnvilt artru poo0teen fciatls ua( p u)arxoir3oadfptranesls0 etoxo3oudapenmnetlsf rrmxm ;o1aexnii3iydla2uln s t) exnmfctydla rlneils0 etr(r no1om elivt (fa2ur(rpot1olt  i3tydls2emn snu)texomrcoatlpteaivi s0sexmxm3io1amt lict s s2rmur ot0tetnii3iaslm2elnmsnt0trenmf3totfmDr ies s setoio3iydamtn iciltfaDtm( ono1olxnioetadlm2ulumonu4trtnif3todlpDrluvi (0seum(r oy4ame mivsl(fs2rr(r ;o0aee io3tltla ranmpn(0texrif3oatfm rau s;t0 2ur(o3ou1lm nmicsatfs2rmur oo1tee if3tld a emnvs t0 lxomfcoadom eluvslt)setmxm nudlltemies s)srtr(  ;u4oexoiociysla ranvo;(4tltrmo3io1laD  n i;()teuoir3ou1lmt mncslt  2um(m no0tpx mi3iat a2emnmo u)tleoio3tydfm elnvo (0s2xrxrpiudlp e fes s) rrrx  ot0opeomoetyd m rmuvo;t)alxrxo to1oate nvs;t)srxoim oudlle licsat) Dta(rp;o1alenioctasfa2uauvp ()aeenxo tydlaDr ies t0s2umim no1ll n nvsls)a2ururpnt4tpeomfciatlm2umuvo u)tlxoxocoatfmteai s t0teuoxm3iodal nlfcsa( srurumpoo0optnio3iyd s rluvo;u4arxnifcoadfpDelivo s0setr(opiudom emfct t) ruaurp;u0alenioeias mDrlu o ()treoir oydop eaivi;( trxriopny1al elnvtlt srrm(rpot0oeenioetld sDel(vonu) lerif3tatomt ai i s0setrxr3nu1open ictls)sDua(roou4oet iicias m2emnmon(0altnmociodlatrauvolt s2xr(opiudlp n nvi () rrrx p;t0texomfeiad m2rmumpnu) lxnmoctotlate uvo s)s2to(o no1al nlieiat) 2rau p;o4tlx  fctys s2em(mpnt0 lxnmf tytfp rau s;( seumimpnodlmtnmnct sfsrtau o;u0aeeoio3iat s elu o u)texoif oa1fpt aueols srurxo3iy4altemfei t)srur(r ot0tlenmi3tyd s rmu pnu4 rtnxfctytom   i i;t0s2tr(r3ny1llteliet t  rrmu  no4alxnmoeiaslmDumuvp;t0artnmf iotfpDranvils) rtoxmpiudlmtelivs ()aDta(r ot1aeen feilsls2eln o;u4 lenifcoo1fpte nvi ( texrxm iudapeemnci sfarrruronu4tlx miciydlm ulu o t4trerxr tydlaDrli s s sruo(r nudoltnmfvsls)a2rmx  ou1teeomf3ild sDrmumpn()tltrxfcoa1lpDraues t) rumxo3iy4om  lnvias a2rm(rpoo4tpt miciatfsDrluvsnt0trermrcoy1fp elueo t0t2tmxrpio4olt mnct tf rtrurpno0aeenmoeiyd a2em( s;(4 ltrmr3todomt  u il(0s2toxm3oo4lp nlieias)a2uaum nt1teen iciysfm el( p (4aexrmocootfpteln o;(0seum(mpiu1ome  ivtls srum( pot4aptnifeiltfsDeluvpnt0 rtomo3ta1oa   ueils t2xr(o3nydop nlnetl(fartau  ;t1texomietlt a rmn p;()tlxnxr oa1lp  lnvs t0srxr(mpio1omtn nct t) Dtmxr oo4aetnmf3tldlsDua( snu0alxnmr3oy1laDr n ils0tetmxm3ny4ol n fvt s) rraxro;t0tptoii3tasfaDelnvo t)trxnio oodoaD aneslt0 2uoxr3oudlpeemivt t)a2rmxmp;u0aptomoeiltfs ulnms (4tlxoxfciodfaDrauvo;s)sruoxr oo1alen feilsfsDtru pno1oltn i3ilt s umuvo;u) renmo3io1lmtrli sls)s2tr(o oodope  ics ( a2urxmooo0apxn ieilt mDul(vp u4arenio oatlmt auvsls trxr(o nu1optelncsas srurx o;t1apenmo3tatla uln s;t4arenio3oatfmDeai slt0 exrxmpnu1lme  icsls)sDtm(rpnt0oltnii3iys mDul(mp u4 ltnmf iytla  lneolt  2urim3nodlptn fesa(f Drmuront0apxomfetadfm2ean o u0altoiociy1lp   nvs () rtr(mpiy4llee ietasf Drr(rpoo0oex mociysfm2ulu o;u) rtniocoadlmDr nvs t) 2um(rpnudol  mictat s2raxr ;u1tpxniietltls em(vo;t) rxrmr todfpDe ueils  2xoiopny4omtnmieils a2taxmoot1oeenmo3ildla2ulu s;t0alxomf oytfat aieo s0 etmio3oy4ol n ictat a2um( pnu0altomociytla2rl(vs ()arxomrcoadoa  lnvs;(0 rumxm3oydapenmfci ()aDtru  no4oetomieiyt s ul(mp;t) lenxrcoadoaDeanvslt0 2xrxr ou4lmtn ncsat aDuax  no4aexo iciytfm el(mpnu0aeeomo tadfa eai o ( seto(o3oy4lm elies ( artmu poo4apxn iciysfa eaums ()teermr3iadoaDrliesls  2xm(m nudll  liei t)artrxroot1olx mieils s2ea( o;t4 lxoxo oadomt lnesl(0setoxo ny4llt mnvtat)s2tax o;t1oleoifciadls umuvo;(4tltoxocootfmtelieo s t2uoim3oo1opt mivi s)aDtr(rp;o1tpeoio3iydfa2umn s;() ltnxocoadoa e neslt s2urir ou4om e ncs ()aDurxrp;t4tpe mfciat aDrl( pnu)alenmo oy1optelneols  etmxmpnydlmt liesls aDtrumont4alxn ociysfsDrmn o u)teeomf iotfpte i i s0s2xmio iy4omenmnes (  2urur ;t4aleomi3iltls rl( sn(4 rxrmf oodfatrln s ( srtmiopnydll e iesl(fartmx  ;o4tetnmfeiytfsDum(vs (4 eermo3tydop eanvsl( s2xr(o nu1ome mnetlt a2ur(rpou4aptn oeiad a ulumonu0tlxrxr3oodom  luvilt0srtrim nydomt lfciatfsrrrumo;o0apenio3tytlaDua(ms;u0tleomf oy1fp eaiei ()t2tmir3iy4lpeelfcsl(  rtrxm ot0aex  o3tlsls ulumsnt4teermfctatfpDelu ol(0 rxoxopnu1lmt  netat srumump;o4tleo ietld s rl( s u0teenxrctatlaDr u s;() 2tmim no1apee fcslt sDrrumoot1ale  i3iysfm em( o t)trtoif oodfptranvs;() rxr(opno1ol n fvtlsf 2rru  nt0tpxo ociltfm2emnmo;u)areoxfcoadop ran i;t  exoxo3iu4op n icil()s2trxmp;t4tlxnmfeilslmDean s (4 lxnxo iy1faDrln i (0seuoir iu1al nmneia()aruau pnu4tpe mo3iydla2um(mp;t)tlxnmr ty1lp rluvsls tetr(opnudlpe lfvtas arumuroot0aetn oeiydfs ulu ont4 exomr3tytfp r i i;(0 etrir3oudlptnmfvi ( artaumono1tltnmi3iatfm ranvon(0tltrxf iadfpD  i i;s teuo(m3oo1lm nmnvtlsf rtm( p;u4opxomf3ilsls2ean s t0trtnmo3oo1fa rluvsl( srxrimpnu4al n ivi t) Dtmxmono4oeenmoetydfs ea(mp;t4treoif3iytfpt  neil()trtoxmpnu1omenmnvtat  Drrx  ;u1tetoifciaslm2ulu onu)trtrxfcoadomDr i o s)t2xr(m nu1amt lnvs t sDraum oo4oeenmfetas m rlnvsnt) reoir3tatfaDe u il(0t2tm(r3no1amenlnvs tf Dum(mp;u1tpt iieildfmDum( p;t)altrmf oodlp eanvsl()t2uo(mpny1lmtnmiesatfarrmx  ;u0aexo ieiatls2umnvp u4 reomfcootopD  i s s s2xo(m ny1op n nei (faDraxr ;o0apxn ocils m emumo;t)tlxnxo oa1fpteln sls0 exr(r3oydlm nmicsl( srtr( ooo4aee mocilt sDua(vo u4altnmf iydfp e uvs;s)teumiopnu1amenmivt ( aDrmumpnt1alxn ieiatla2uaums;t0artnircio1lm r nvi (0t2uoxm oy4al emietasf 2taxmono1tle  iciasfs2ranvsnt4 lxoxo3oo1op rlu i t texoiopnodolen nvt s) 2raxmp;o0aexnif3tlsls ua(vsnt0aeenxfcoatlp   i s;t  rur(r oydal n netl( aDtr( pnu1aeeomfeilt m ra(vo;()texoir3to1faDeli olt t2xmxm no1lleelictlt  2umx pno0tex iieias a ulu o (0trxoxfciodfm r neo t)seuoio3nodamee ncs () 2uax ont0alxniieiadlmDel(mp t) eenif iadfm rln ols sexrxm3no1lltelnctls)sDtmu pno0aeto feiltfmDrluvp;t4aeerxrcoadfpteluvil(0tetoim ny1om elfvtls)sDtaumpnu1aexnioeilt a el( s t4texnio tytfmtr ueols0 exrxmpiydlptnlietlt sDur(r ou4tlt mietydlaDul( snt0 renmf3iytlmteaiei t  eumim3iy1alte nesasf 2rr( oou1oltnio3iysla2emump;u4texomr3tytlpt lies;() 2toxr no1lmeemfvs s)arrmu poo4aex miciysls2el(vsn(0trenmo3tadom raivi (0 rtmxr nu4amenmfvt s artrx pno4tltomictldlm2ua(vp;u0 etoxo oadoaDelu il( texoxo3iu4olt mnvs s sruau p;o1apxnmi3iatlmDrmump;() reomf3to1optelu s;t)texrxr3io4lmeemivt sf rur(rpnu4oee iietatls2ranmpn(0altrxr3ootom r ivo;t)srum(opiu1omtnmnci t srurxmoot4tltn fetls s2uauvpnt0 ltnxo3tydoa rlneo t) 2xmiopiy1lp e nvi (  2rmxmpno0tpxn f3tydla ra(vpn(0 exoxo oodop  ln i (0t2umxrpno1opt lieslt sDrrxm nt0tlt ifctydla2emn snt4texnxrcia1fp  ai s;t) 2xm(mpnu1aptnlfciatf rumuroou0opxn i3tad s2el(vo t4 rermo3oo1lpDr ueo s0 ruoim nodole liei (f rra(moot0texn iciatfmDem(ms;t)aetnmo3ta1fpteliei;(  etrxm iydaptn fcs tfsDuaurp;u4aetniieiad sDum( ont4 lxoxo3oytfaDelies s0teuo(r io4ap   fvil( a2ra(rp;t4oetnmfciys a um(vs t4aeeoiocoatfaDraueilt  rxrxr3ny4llenlfcsas)artrxmpou4aeeomo3tysls2uan p;u4 exoxr ia1opD auvs;t)t2xrxopou4lmee ivi sfsDrr( ont0apxoifctytfa2rm( o ()areoir iatopteau olt0t2tmirpoodlp  lnetltfaDtr(mo;u0tpxnmfeilsla2eanms;u0texnxf iydoat liei;(0texoir oo1lpte ictltfa2rax p;t4alxn o3iyt sDuln o ()trxoif3totlm  aivi ( srum(opiudapt  icia(f 2rmxrp;t4alxnifciltla rmnmp;u0texnif3ta1op  ai i;() 2ur(opnu1amte fvsas  rrauront0alxn ocilslaDea( p () exrmr3oo1oateanvil( trxmio3iydlptnmiet (faDrm(mp;o0aet mociatla2elnmsn(0arermf ia1oa e ues s0srxmio iy1omt  net tf Drau ooo1oetnmfcilt s el(vp;()tlxnir3oodfmDr uvi;s)t2to(m3nydllenmieslt) rumxm ;u4alenmo3iytlmDrluvo;u4tetrio3totfa  lnes;(0t2to(mpnydlp e ncias sDtr(m ;u1alx  ictatlmDulnmp ()texrioctadfpD  uesls)t2toxo nudal   ictl(fs2urx pnt1olxomieiytfs em(vs u4aeenif3ty1oaDelneo t)seto(rpno1ll n fct (  2um(mo;t4oet  ociatla2ul( o u0arerif tytfmD  uvo s  exmxr3iy1omenmfcil( arrmxm ou4alenif3ildlsDea( o u4arerif oatlpteanvs;t  exm(m oo1open fcs (f 2rrum nu1opxo i3tad m2ua( o;t0aexomr tatlat an s ()tetrim oo4ale mfcilsf rur(rp;u4tpxnmo3iadls um(mp;()arxnxr iadlm r ivs;t)srtr(r io1op  mneta(fa2umumo;o1apeo ociadfa2ea( pn(0artoxocoa1laDeli i;s) 2xr(m3no4ope lnetlt artrx pnt0tlx  iciatfmDrm(vp;t)trenmocoodomDeaieslt) rxmim3io1lpt mnciasf Dua( 
\ No newline at end of file
@@ -0,0 +1 @@
+u s ( seuoxo oy4lltn ictat  2tr( ono1tltn fcild s emnmon(0tltnio totomDeaivs;s0 rtoiopiodlmeelfvils)sruau o;o4optnif3tltfmDeanvpnu0 exomfcoadop  livs;s0 rto(o nu1ape lfvil( aDraumo;u4tetnmfciasla rluvo u)tltnxr3iy1lp   iei t0srtrim3oudamt  ivs t)s2tmuro;u1aex mfciytfsDrm( o u4artomo to1fp   n ils0trtmxm oo1ol emfcilt)srraxrpot0tpe io3tydlsDranvo ()arxnmf oa1fm e nvols) etmxr3nydap nmfvslsfsruaurpou4tpxnmociltlm2elnvo u) leomr3iatfm elu slt)seuoxmpno4lmen fcsltf 2rrump;t1tpxoifctydlsDrlumpnu0 leoxr3iatlptr ieo (0 ruo(r3oodopte fvsasf 2tr(ro;t4aexo f3iltlaDelnms t0 exrio3ia1lm e u s s0t2uoxr3io1opte fctasf rumur ;t1alxo fctasfm rlu snu0tetnif tydlaD  ies;()setmio iudlpte fvsls)arrau o;u0oltn o3tat sDulnvsnt)areoxr oa1omD auvi;t0truoxr iy1llt mietas)aDrmx  nu1tpeoiietls m rauvpnu4aetnir tatoa eai o;t) exo(m3ou4om elncta( arrrur ou1aexoif3iatfm rl(ms;u0 eenxfcio1lmD lu il( truo(m nydop  lfet (fsrtr(m no1oltomi3iatlmDulumsn(4 exnxociytopteauvo;( srxmirpiudopt micilt a2ua(roou1tpxniieiaslmDumuvpnt)artrircootfmD an ol(0s2xmxr io4omt mfctls) rrru poo1alxnio3iytlaDrm(vsnt)treoxo iytla eaivslt  ruoxr3ou1amtelfvt t)aDuaurp;o1opt  ictydlsDul( pnt)teeriocio1lmtraueil(0 2xmxr3iy4olt  ietat sDur(m nt1alx  i3iat mDumn s ()teerioctatlpt  ueo t0trurim oydomtnlnctat  Drrx p;u1tpeomfciatfs2ulnvo;u0areomfcoatla  luvo;( setmim3nu4alee ictlt  2rax ono0tptnmo3tasfs em(mp;u4arermoctydla rlnvolt0s2toxo iy4alte fvs s aDtrxr oo4olen oeiadla2ranmo u4aetrmrciy1fpt  nvsl(0seuo(m3oy4ame  ietatfaDrmxm ;t1oeenmoetlt m eln p;t4 reomrcoo1fp  li o s0srtmxr oudomeemnct s  2rrx p;o4tltn fetls a2um(vp;(4trtrmr iadlm   ivi;s)t2umirpnudopeelivs s  2rauro;t1oee ii3tatlm2rm( snt4 rtoxo3tydlpt  nvils)s2toxo nudlp  mfcia() Dumx  ;t4alt  ieiyd m rlnvs u0arxrxo3oo1fm  aueol() 2toxr ny1lmeelfvia( sDtm(ro;o0aexn o3ildlm2ra(vo t4tlxrifcoadomDeln i t0teuoimpou1olee nesa(fs2umxr oo0tlxnmfciatls2em( snu4arermf iytfa rlivo;( srumir oudlpte net (fa2rmump;o4tlxnif3iat sDrm( pnt4aetomr iydlaD ln o;(0seum(o iy4om nlnvi t) rumur no1tleomieiltls em( s;u0trtoxrctydfpDrluvi ()trum(m3nu1altnmneiat a2rm( ont0tlxnifctat mDuaumpn(4tlxoxfciy1oaDeaivo s0s2tr(m3oy1amtn fctl(fa2rmxrp;o0oltoioeiad mDumuvsn(4tetrxo3iadlpte ivols seurxo nodamee ieta(  Dtm(ro;o4tet  i3tyt sDemuvpnt4texrmfciydopt luvi;t)srtrxo3oo1lmenlfesls)arrmu o;t4tlt  iciyd mDem(vs ()tltnxfciotom ranvi;s0setoxm iu1omtnmfci t srrr(m nu1oet iietyd s2elnmont) etnmr3to1faD lu ols)texo(m io1opeemiei t sDtrxr nt1aetnmo3iat sDran s;t) rermo3tytlpD livi;t)trxrxr3iy1omeelivilsfs2trxrpot1opt iiciyd aDem(vo u)tlxrmf iotlp rlieo;s  2xr(r3iydllt livsls) rum(m ot1olen ieiydlm2ran s;t4trtrio3tatoat  uvi ()trxmio3iydomte fesl(fsDraumonu4aexniieilsfs2rlumon(0arxoio3tadlpDeanesl(  rurim3io1opt lfctl(farta(mp;u4tetnmoctys sDuau snu)trxrmo iodoa  auvol(0 rxriopiudomt miciasfa2taxrp;t4olt ifeiasfm ean s;t0texnxrcto1faD  u i;(0setoxo3ny1om emivtlt) 2ua(mp;o0ape if3tydlm2rauvp t0altnmo3iodla e ivolt  rxm(mpoo1lme mictat)sDur(mpnt0apx ifetyt a rlu s (4aeerif3iydlpDelu i t srtrxopoo1ap  mnvtl()aDra( o;u0alen ociltlsDrmuvp t4tlxoio3ia1lp   uvo;s  2trxr3io1altnmfci s)srra(m no0oetoio3tatla em( o u0 lenmfciytlmDeanei;() ruoim3iudapt  icslt a2tmxm no4apeniietltfm umnvp ()aexrxr3todlp r nes t srxo(o3oodap elfet tfaDtr(mp;t4teen oeiadlaDelnvp;u4aexrmrciotlmDr ivsl( s2urir iy1ome mnvs ( s2ua(r ;t4tlxnio3tld mDuau s u) lenxr3iydlateaieo;()teuo(rpoy1am n nciat  ruaxmoou0tptnif3iltlsDemnmo t4texnxrciodlmtr uei t)srumim3no4lpeelfctltfs2rm( ono1altoioeiydla rmn onu) exnxrcta1fa  aiei s srxm(m ny4lp  lics ()sDua(r no0olenmf3tasla2elu p;u0tlxnxf3io1omt  ueo;s)s2xmim ny4alt  ivtltfsrrm(ront0olt iictasfmDrlnms;t)altomf oo1fa elu o;t0s2trxo3oodoltn nvsa( sDraum ;o0altnmociyslaDem(mp;u0 rtrxociadomteaieo;(0tetrim3nodlleemnviasfs2tm(mpot4tpto o3iltfm emnmpnt0texnmf todfatelueil(  etm(o3iydoptnmneia(f rraxm nt1ale moctadlm2ra( s (0artoifciytomteanvs;t0t2xrio io1llt licsa(farua(mooo0apenmietld mDelumpnu4 rxrif ootomD li i s  rurirpny4lm  lnvt () rraxmpnu1tpxn o3tyslsDeluvpnu4artoio iadomtelueslt0 rxrio3oy1opt miei s) 2ua( ont1opeoifeilt s rmnvs u4aleoxf oadoat aieo;()texmxrpny4ap  mivsls artmx  no4tpeoifeiyslm ua(vs;(0arerir oo1lmt aivo;t0 eto(r no1olt mivils) 2rmx ono1tpxoii3iltfmDumumsnu4 reoiocoydfmt lnvs t0teurxmpoo1ope lfcs sfarur( pnu4aptn icilsfa2elnmpnu) rxoxf oytla  aieo t0srxm(o no4amen fciat aruaum ;u1tle moetas aDulums t)tleoif todomD anvilt  exmxm3oo4llenlnci ()s2taur nu4apxn i3tlslm rauvs t4texrxfctotfm   neil(0trxoxo3oo4lpt  nvtl()arrmx  ou4alt io3tltlm rlump (0tetrir iytoa rliei;t t2umir nydomte ncils  rtaurono4texomi3iatls umn p;(0areoxrctodlm e ivs t)srto(r oydamtnlics s) Drr( p;u4aexo ociatfa2rm(mp t) ltrmf3iodlatean ol(0t2trxr iy1am n fvilsfsDta(rp;t4ale  feiat s eauvonu0treoifciatoaDrlues;t tetrxm iu4lm n ics ()srtaxm ;t0ale mi3iaslaDeanmonu) rxnmfciodfmteln i s0tetoxo3nudom elfcsl() 2ur(  ot0apen o3ilsls eau o t4arxoxf3ta1oate nvilt) exrimpny1ol elnetat)arrmxrooo4olt mfetad aDrm(mont)trtnir iatfmte ueils0texr(o3oy4ap  mfvs sf rum( p;t1alx mfcilsfm elnvo;t)trtnif oatlp r i o (0trxo(o3iudal emnesa() rtmurooo0alt mietlt s2rmnvsnu) rtrmocto1lpt  nvo ()sexo(r iu1ole lnvsatfaDtm(mpno1texoii3tatfs elu pnt0 etrmf3io1lpDr ivi;s seuo(o nu1ope  fctltf rurxr ;u4apeo i3tltfs ulumo;(4 etnxrciydfm e uei t  rtrim oydlmenmnvtl(fs2tr( p;u1tpt moetyd s em( s () eeomf3oatfp rau o (  exm(rpno1ll elietasfs2tmxmo;o1tleo iciyslm2elu pnt0areoxfcoa1om  lnvil(  rtmxrpny1ome mnciat  2taum nt4opt ioetytla2ea(vs ()treoxf iydlmD  iei () ruoxo3nydomenlivsas) ruaurp;o0opxoio3tlsls ean pnt)aexrxrcia1optelnvo;(0truoim3iu1apen ietasfarrrxrpnt4tlx mfcildls rmuvs (4tlxrir iy1om r ues;(0 etoxr3ny4lmeelivsat)aDua(m nt0tltomictas mDeauvpn(4tleoifcta1lpteln o;t0 2umim nudlme  feta( a2raxrp;t1teeo ociadlm ul(msnu4alerxf3to1om ran ols0trtrxo oy4altnmfeta(f Draxm oo1apxniociadlm2ulumo t4 exomr iytlpDraneilt t2xrxrpio1olenmncslt  rra(mo;u1tptnii3ilsfs2eaumonu4areoif3tytom r ivs;(  rtmim3io4llt mncsl(faDrrur ;u1tpt  ieiytls rl(vpnt) rxnir3oydlmtr uvs (0 eurimpoy4al   fvs s aruau  oo1texn fet
\ No newline at end of file
@@ -0,0 +1 @@
+nesl(0seumiopoudaptnmieils a2umu  nt0oetoioetasfs2ea(msnt4 lxnxf3iydoat ln ils0 2to(r3oo1openlneilt srtrx onu4tlxo i3iltfm rau pnt0 eenmr3iytlatelu o;( trurxopio4om nmneslt  Dumump;o4opt ioetydlm rm(mon(4tlenxr3totfpteauvs s setr(mpou4lle  fcs () 2rru  ;t0oexnmi3tys m rmnvs u)alerxrcty1lmD lnvs t) 2xrir3no4amen iciasfarum(r ;o4open fetyt mDran s t)teeoio ia1op eanvo (0 ruoimpny1ap  mfetatfsDrau oou4apt io3iyt aDeanvon(4teenir oo1lpt lu i t)s2toxo3no1lmtnlici s) rumxmp;o0opxo o3tytla emnmo (0 exrmr oodoat luvs;s srxmimpnudll nmfet ()srra(mpoo1apxoif3iadls umnmp;u4aeerio3ia1lp   ivi;t0sruoim nydlm  mics t)aDtaur no1olenifetytfmDum( pnu0altriociotop e neo;s  etrir iy4llee ncs t) 2raumooo4olx moetldlm ra(vp;(4tlxomo todfmtelies;t0texoir3oo1ap nlnct t)aDta( pot0oee ifctytfa ean ont)texnifcoydlaD livi (0 rtmim iydopen ivias)s2uax p;o1apx micildfsDel( snt4 rtrxo iotfaDeai ils texrio3oy4lpen net s srumxrpnu4alx mf3tat s2umnvp t0 etnxf3todfatrlueil() rtrxr3io4opeemivt s)srua(mp;o4oetnioeiytlsDul(vo t0 lxoxr3to1lpt aueo (0truo(m no1lmt lfeslt) rtrxmoou1olxnmieilsfmDemnms;t)aeenmf tytlp   ueo t texmxrpiu1lm elictls  Dumumonu4alen ietltlm2emu s;u4aexomf3oo1fp  lueol( s2uoxr iydll nmivils  rtaxrpno1tptomocilsfs rlumo t) lxoirciodlatrlneo;t) 2xmir3oudaltelnctat artax  nt4tpxoif3ias m ulumonu4altrifciytfpD aues t) 2tr(r3ou4altelnvia(fs2urxr nu4oetoifciatla ra(mo (0 leoio3oydopD lu o;t0t2trimpno4op nlictl(fsrum( pot1tpe iiciasls umnvo;t4texoxociydfp  aivo;t  2tm(o ou4ap elnvt sfaDua(mont1apto fciltlm rm(vo () eenif3tytlp   nvo s)t2umio3no4lptn fesl(faDurumo;o1tlxomo3iltlaDrmumsn()aetoif tatlmD  u i;() 2xmxrpiodlpt  ietl( a2ta(mpot4oltoioeiltfmDul(vp (4trtriocoy1fpD livolt) 2um(o iodoltn ivsat) rtau  nu0olx ioeiysfs ran s u4tetnifcoy1omDr nes t  2tmxo3oo4ope mictat)sDrau  oo1apen feiysla rauvs t0 reoir3to1oaDran o;t) ruo(rpoo4alenlnvtatf ruru pnu1oetn o3ilsfs2eluvs;t4alxrxr3oodop e ies s0s2urimpny4lmt mnvtltf 2ururo;u0alxomo3tydfaDuau p u)texrir3ia1optraiei;( srtr(opno1ap elfetatfarum( onu0tpto feiatlm em( onu4artoio3iatlpD ai slt)s2xmxm3oo4aptnmnvtls  2trxr ;u1aeeo o3iatfs2em( s;t) reriocoydfptr ivi;(  etm(rpio1am nmfvtatfs2rmuro;u4aptomfciyt m ulu onu)treomo iy1lmDe nvils trtoio3ou4lmeelnvtl()aDrm(mpnu1tleomf3tadlaDuauvo;()teermfciodlm   uvils srxrxr3ny4amt lfvia(f rrrxm no0olto icias mDrm( pnt)trtrmrciatomD  ivs;t) eto(m3oydal e fvsas aDra(  no0tlenifctadfs2emn pnu0tlenxf totoa  ai i;t texrim3oydal n neiat aDtrumono0oeenmietltfmDul( s;t4trtnxr3io1opteaneolt sexmir3iu1ale mfeias a2uru p;o1alt  ociydfs eln p;u0aeeriociotfatranvils)srurim3oy1ope livilt artaxmpou4tle ioeils aDua(vpnu0aetrir tatlpD luvol( trurio3iudam   fci () Dra(rp;o0ope mi3tys s2rmuvsn(4 lenxr todlptelivs s)t2xmirpiydlpenlnvt sfarrmum ot1tpe mociytfa el(vont4 exrmrciy1lp rln o t)teurxo3oy4lmee fcsat)a2taum no1teto fetldfa rmu s;t)aetoxr3tytlpD  ies;(0 2uo(m3oydlltelnctlt srtau  nu4opt iieild sDemumo (0 reoif3oo1lp elu o;(0s2toxrpny1amt lfctlt)a2tr(rpnu0tetomiciysls2el( p (4arxnxr totfm raivs;s trtoio3oudlpenmivt s arrmxrooo4teeo i3tadla rln pnu0tetoxf3to1omt  iei ()t2xmxopoy1olt mnes (f Dtm( ont1ope  o3iatls2ranvo;t)arxomo tatlp   ivs (0trto(opny4al n nvi ( artrx poo4tex moetlsfmDrl(vs;u0 etrmo tatlat  ieol()truoir oo1alt mfct (f 2urumono0apxomfciadfm2rauvo u4 eenxrctytlaDrlivol( setrxm oy1ol   iviasfsDrmumoot1oee  oeiasfm2ul(vp;(4 eerircoodomDelieol( s2xrirpou4omt lfei tfaDtm(mp;u1tee io3iat s emnmpnu0tetnmoctatoaDean o () etr(r3ny1omt mfeia(fsrurxmo;u4aleo f3ilsla ea(mo;()arxnif io1lmDelu slt) rxr(m nydllte fvtasf ruaxr ;u1tpt ioeild aDelumon()tetrxr oo1fa e i ils0 2umio3ou1amen iet (f 2urumpot1aleo f3iad m elumo;u4texoifcoadla  lu o;() 2xrim3oydlmte icsl( a2rau ont4aexomf3ilslsDemnmo;t4artrmf3tydlp eluvsls)t2urxo io4lpte ivt ( a2trxm ;t4opto ictyt a ul(mo () rxnif3oytfm   ueil( seuoim3iodap n fet sfaDrr( onu0olxnmi3ils m emnmo;u0 exrio3oatfpD li ils trurxmpiy4lpt lietlsfs2ra( poo4optomo3tadls um(vo;t4 rtoxocootlm  auvsl()trxmxr3ou1ape lnesl( srtrxmpnt1altn ieiatfs emuvo u0 lerio todfpt  ueo;(  ruo(m3oudop n fei sf 2umxm nu4oltnmictldla2el( o;u4alerxfcia1opD  n s;t0 rur(opiy1lmeelnes t)sDuru  ou0tltnifcilt a2ua(vpn(4 lxrif oatfp rliesl(0 rxr(opoudop  mfct ( s2tmuroou0tpeomfetld a rmumo;u)trenirctotlpDe u ol(  ruo(r3oy4al nlfvsat  ruru p;u0texnmfciadlaDea(vp t)tetrxf to1omt ai o s s2xmxmpiodoltn ictat  2urx oou0tlt mf3iadlm2ea(mo u0trxoio io1omt  ieo;( t2tmio3no1lp e fvilsfaDrmump;o4apen fciydfs rmnvo t4 exrxfciadlpDrln slt) 2xoxr iodap  livsatf Drmxrpno1olxnioetydfa elnmpnu4tleoxociodomtr nei s) 2xoirpnudamt mivtls  Dtr(mpnt1optnmociyd a2eanvp;(4 ltnxrciytlpt  u o;s  etr(r3nu4lm nmiet s)aDtm(mpnu1aptomfeiys s raump;u4tltrmo3iadoa eai ils0sexo(r ou1lp   nctas)sDrmx o;o4tpeo f3ild s rmu p (0 lxrxr3iodla  livi ()trtrxr iy4llenlietatf Duau pot1apxnioetad s2uanvpn(0tltoxf3oodfmDrai s;() 2urim oy1al nlietls arurx  ou0tlxo ocild aDrmu pnt4aetnxr ta1faD  ivsl(0 rxmxopio4amen fct t srur( ono0alxniieiadfm2umu s;t4 ltniocoadlatr i ilt  2uoirpoudamt lnvs s)a2rruro;o1texoiictasls2ra(vo;(0trtoif oy1laD  ueo s s2xmxr3nodam  mfetat)sDuax p;t4tpen feilt s ran o t4arermrctodfpDrlies;t) eto(opny4apt mfvsl(fsDra(r ot1aptnif3tltla rmnvs;t0aetrmo iytfat  iei;t0t2xrxo no4am  mnvtl( aDtrum ;t1aexnioetld a umnvs (0 ltrxfcia1oaDrlivs s) exm(o3nudom   ncs s  2taxr ;t0oltomf3iys m2ua(mo;(4arerir iatlp eanvs;t)sruo(r iydlm  mfei s)aDtm(m no4alx mf3tytfsDuluvo;t0aexrmr3iodopD lnvsl( sruoir nu4ol e ictl(fsrraxmono4olxoiieiat a2rm( o;u) exoio3oadoa eauei;(  etm(mpny4om   iviltfartm( p;u0aptnmf3iatla ul( p;(0tetnif3iatla rlueo t0texrxm3ny1apte fvia(fsDumxronu0tlxo octatfa2rm(vp ()aexnio3oodfpDr ivo;s)trxmxrpoy1llte iesas) 2um(r nu4aex ifeiadfa2uauvsnu)aetnxr io1lmD lies;( trurim3iodll emnvta()aDtmumpoo0texoifciyd aDrlumo;u0tltoxfciytoat ln o s)tetr(opiu1op   ivsas)s2umxrp;u0aeeomf3tltlm2uanmo;u)trxnmr oo1lmt aivi;t)s2toim3io1ame lnci ()a2um(mpno4tlxnifetldlmDeaumo u4texrmoctotoa raues t)sexmxopnudlpt mncs s)aDua(m ot1oetnif3iydls el( on(0tetnircoadoa  livs t) eum(mpiy4opte ici t  2ur(m ot1aetnmoeiatla2em(vp (4aetrmf3iatfpD  ivs s trum(o3nu1altnlivilt)artax o;t0oltomoeiaslaDemnvp (0 exnir3oodlpDrlnvols) ruoim iodlmtelfct ( arrm(r ;o1teto i3ils s elu o t0tetrxo iytfaD auvs s  2xoxrpio4ome  netat  rtmu onu4tlt mf3iltfm2ua(vo (4arxnxr3ia1oa eanvs (0trtrir3oudlmeemies t s2uau  ot0tlx iictysla2ra(vonu)altnif oytfmD  n o t)t2xr(r3nu4lmtemietas  rtmx  ;o1tlx  f3iadfm ua(mo;t4 etrxf oytlpDeanes;()s2uoimpoydop emiei () 2trum ;o4oexnmo3tytfsDumnms t4 eeomocoa1op   i slt)t2tmir nudamee fcs s) Drax o;u4oltnioetlt a2ra(mo (0tltnmrcoy1oa eanvs;(0 2tmxmpoy4opt lfvslt  2tmum ;t0opt  ietldls2umuvont0aeeoifcoa1faDean ilt)seuoxm ou1aleelnvsl(f 2trur ;u4oee mi3iyt sDrln s;t4aexomo3oytlp  ln i t)s2xo(mpnu4lmt  ivilt)srta(mooo1olen octytls rm(mpn(0arxoir iydlp e n ols  2xmxr3nudame lfcsat s2taum ot0texoifeildfmDul(msn() leoircoadlm   neolt0 rto(r nu4ll  lneiltfs2taurpnu4apx iociadfm2em(vs;(0treoxo3totoaD  i s t t2xmxo oo4amte net (f 2ra(rpoo4olxo o3iydfm emn pnu4trtrif tydfpt aues;t)s2um(rpou1ameemfcs s  rrmx ono4olenii3ildfmDrmnvs;u4tlenmr to1op rai sls srtoxo iydop   icil( a2ta(mpou4opto ociytla2um(vo;t4aetnxo tatoptelnvo ()s2trxmpiy4optnmivias a2tr(monu0tet if3iasfmDuan o t) renxf3oy1om raieslt0sexo(mpoo4altnlfvias srumxm ot0tlxniociadfa2uauvs (4aeenmo3oytoatrlnvsls teuoir nodlpen fvs s)srtm(rp;o1oexoii3tldfa2umn on(0aleomfcoytla raivi;s) rtmim3io4amtnmfei tfs2tmxrono4tlx mi3iasfm rl( sn(0trxoir3tadfpDraivi t0texrxm ou4op elfes t aDrmuroou4tlxo ieiyd s2ul( s (0alxoxfciy1lm rlies;t s2xmxmpou4ole lneiatf Durur ;o1open ieiytls2em( p;t4arxrxf3oadopteluvilt)t2uo(r3oy1al nlivtls) Drm(r no4tltoiieildfs rlnmon(0trxrxr iodfmtrai o s sruoxr3nu4om   fcsat)srumurono1optn ictasla emu pnt4tlxrxo3oydoa rluvi;t)trtm(r3io1ap emnvs tfartr(rpou1aexn ieiltfm elumonu)aeenxrctatomte nes;t)texrxr nodaptnlnvi s)s2rmx oou0ope iociltfs2rl( o;t0 eenmr iadfa eai o t0 ruoxo iodlle  iesls)sDuaxrpou4tpenmoetytlm raumo;t4aetrxf3oo1fpteaueo;( s2xmiopno4optnlfvs ( aDrmxro;o4tle moeildfm ulumsnu)arxrio ia1lmDeluvols)teurim nu1olenlncsat s2rmxr ou4aet ifctas m emnvo;u0teenxoctatoat aueslt0setoirpno4omtnlfctlt)a2taumont4aeenii3iltfaDemnmsn()aeeoxo3iodopDelues;()t2tmxmpoy1omtemnvsltf rur(m ot0tee  ietltfsDem(monu)trtnmfcoodop  au o;t)srxoxmpiodalenlnctls)aDum(  ot1aptnmieiysfsDum( p;u) rtomf3todfpD  i ilt)t2tmio3ou1lltn fvs (f rurx pnt0opt mf3iad m ul( o (0altrifcta1op   ieilt)t2tmxrpoodom emivtas)srumxmpou1tpxnmfeiat s2eanvsn(0teenxo oa1omtelnes;(0 etoxr ou4omtn ieiasfsDrmurpno1aexnifctatfm2ran o;t4tltoxf iydfa rlivi (0s2xo(r3iy1lptn ivsatfarum(roou1tlxnmietyt mDranmp (4arxrir ootfa  aies;s  2xmimpiy1am elfes () Drr(m ou1apt mfctld a2elnvo (0 lermfcio1fa eln s (0 2xoim3nydlm emfci t) Dua(m ;t4apt ii3ils s rmnvs;t)arerxo io1opDr n ils0s2to(o ou1ape  ivsasfs2tmxr ou4oltoio3iad s2rm(mp;u4 rtnmo3oa1lpDrlneilt)srurim iu1lmtn iei s  rumu p;o1tpt mietydlmDel( onu0 leoif oadlp   iei;()srurxm nu4opeemnvtlsfa2taumpot0teeomfeildlsDulu p;(4trtnxo tydopDr iesls)s2uoio3nudlm emnvt (fs2tr(mono1aee  octydfa el(vs u0alxomf3oa1oa  lieo;t  2xr(m oy1am  mivtas)sDtmuro;u4oexomiciat a rmu o;u4 lxnxoctatop elnes;t teum(o3oydopeemnes s)sDua(  ;t0opx mfcils m ea(mpnu0 eeoir iatoaDeliei;s)srtoir3nydlp  mfesl( sDtrum no0aeto oeiatfaDua(von(0tltnxfctydfpD lnvs;t  2xoxm3nu4al nmneta( s2taump;o1altn ietlslaDum( s u) ltrmf ootfmDeauvi t teuoxr3no4ome mnvt (  2uaurp;t4oexo f3iysla2eanvon()aetrmo3oadfa raueilt0sexr(m ou4lp emnvsas) rtrx ooo0tlen ieiat sDel(vs;u)alenmo oydlat aieolt0s2to(m3nodamt lietl(fsDtrum oo0oexo o3tytfs2elnvsn(4tlxomf iy1laD  uvsl( texrxo ou4opt  fes t)sDumx pnt0aptomi3ilslm uanmpnu0 eeoxo3iydlm  ai o;t)truo(mpio4openlfet () rum(mo;o1tlto o3iysls ran o;u0 rxoir iadomD lnvils)seur(m io4alee nvt s aDtaumoot4tet  i3iytls uau snu0arermo oatla ranvol( s2xoir oodap emfvi tfsDur( poo0tleniocildlm ra( s (0 eermo3iatlm  aivils)setmio3oydapte ivsat s2rmx  ot4apxnmictys a uaumsnt4teerif3oodop rau ilt)teur(o3io4apenmfeil(fsrrmxr no4aex mfcils mDrmuvs;(0teeniocto1omt  ieslt)sexrxopnudomee ivsa() 2um(r ou4tlen o3tld a2rlu p;(4alxoir oytfp rlueols trtrxm iu4alt miesas a2taxrp;t1tptoiieiytla2rmnvs u0 etrxf oo1oatelnvsls) 2tr(m ou1lmt livsas srta( pou4apeo fctadls eanvs;(0artoir3oatfm   ivsls) etm(mpoydomee fet ()sDtr(r ou1tpe  ociydfmDra(mp u4alerircoytlp elu il()seum(r oy1altnmfeslt)s2rrxr nt4optnio3iasls el( o;u)tlerif ta1omDrlieo;s) 2toim oudomtnmncils)sDraxmpno4oet mietasla umnmpnu4 lenxo3oo1lp eli i;s)t2tmxmpoodlpt livsas)s2uax pnu4tlxoioeiad s2emnmp;t4tetomr3totfatran sl() 2xoxo iu4lpt  nvilsfs2uaxrp;t0tpt iiciyt a ra(vpnu) lxoxf3iytfaDe ivols  ruoxr ou4olenlivsa(faruax p;t4apxniociltfs2ra(vo;(0 etomf3totlatr ueo;s  rtmxrpiy1lm n iesls aDra(mono4oltnmfetysfs em(ms () reomfcoydom eaueolt tetoim oy4am  mfvia(farrr(r nt0apto o3iytfaDulu sn() ltnxrcto1lmDrauvs;()sexrxrpny1ome mivi sfa2tru pno4alxo iciaslm2uaumsnt4alxoifciotfat auesls  ruo(rpiy4am emfvtl()srrmx pou0olto o3iadfs2ra(vpnt0arermo iodfmDranvo t)texoir no1olenmnvsas) 2tru p;o1tleomfcilslmDran ont0 leoircoa1la rli o;(  ruoirpny4lltelieia()arur(roou1teen o3iytla2rlnms u0teenmociadfaDeaieo s0trtoirpnu4op n feilt sDtau pno1altnmietysfmDul(mpnu0tlxoxociatlaDe n s t0 rum(o iy1am  mfvsltfsrrrxrpnt0tlxo f3tydfm2ra(monu) lxrif3iytfmDelnvsls)srtrxrpou4ll   neil() 2tau o;t0alto f3ilt s2rmnvp t4 lenxo totlpt  uvols t2toxo3ny1al emneia(  rrrumono1teto i3iytfs2elums ()altnif ty1fmDrlu ol()tetmxrpou4omtnmnetl(fsDur(  no4aeeomi3iltfmDrln s t)texnmr3oydfmt ln i;t t2xmimpny4lmtnmfvsltf Dra( pno4tpenmieiat m ua(vs u)texnmrcoydoaDrau ilt0seto(mpoydlp  lfetlsfaDraum ou0opt  ietytfsDranmo;u4 etoif3oa1late neo;s)sexoxo3iy1op e ivta(  rra(mp;o1apeoii3iadfsDumnvs t)aeenir3oodomDrlnvi () eto(mpny1optnlncsl() rumxrp;u0tee mi3tldfa2ranvs u4 rxrmo oatfm r ueolt  eumirpoy4lm nlfei tfsDrru ono0alto fctlslm2rlumo;(0 rxomociadla  au i;(0trum(opoo1lpeelnciasf Dtrxmo;u4teeomi3iysls rmnvsnt)alxnmo iy1lm e neil(  2urio nydapenlieta() 2tm( o;o1oeenmo3iydfs2ea(vsnu0 lxoxr3to1faDrlueslt) rtoxr ou1lptemivt t) 2ta(mpou1tpe ifeiydls rm(mp t) renxrcoytfpt  ivo;s  eur(r iodol nlncia() Drru  ;o0aexomocild mDua(vo t) eeoxo3iotlp e u i;()teuo(r3nudam n fciat)a2urx pnt4apxoiociadla uau s t)altoiociatla rauei;() 2trxmpny4lp elnvtl(f rtrxm nu0apxnif3tas a2ran snu4tetnxrciytop rau sls) etrio iu4lpe miet (faDrmx oot0apxnif3tyd s umuvs;u) ltnxfcoytlpt li s;s  rxo(r oy4optnlfvsas s2tm(monu0tltoio3tlsla2eln pn()tltnio3tydfmtrai ils)s2tm(m3oudlmeemies ( s2rax  ;u1tex mfeiat a um( s;t) lxriociy1fmDrlueo;s0teuo(o ou1oltemivilt) 2urumooo4olxniieildfmDrmuvo;t4 rxoio todoaDelueil(  rxo(o nu1al n ncs t aDtrum ot4alt ifetatls eluvp;(4areomr oydfp rlueol(  etr(r oodlptn nvt s)a2tmxrpnu1alto f3ils a2rmuvsnu0 lerxfcoydlp   uvo s t2xrirpiu4lptelicslsfs2uax o;t0aetn feilslaDumnvo u4 eerxo3ia1omDrluvs ()s2trxm3nudlmtnlnei s)artru p;u0opeoif3iys sDumn s;() rtrmoctadfm  ai il(  2umio nudlpe lieiatf ruaurpoo0altn f3iaslmDeluvs t)trtomf3oa1lateli ols) 2xr(o nu1llte fetls)sDta( o;o4ale mi3ils m ra(monu0 reoxf3iatfaD aneo;(0t2xoio ou4apeemnciat) Drmxmpno0ope  iciatla eau s;(0 eerio iy1faDelueol( s2tmir iydomen fvtat artm(m ;u0apxoifciytfa umnmo;t4 exomf tadoa e n sls tetrxr nu4al emieta(fsrumurpno1aeen ieiyd mDemuvo u4tlxrxfcoatlptranesl()teur(mpoy1altemnvs s arrm( p;o1tee  oeiltfaDrau o (4aetomrcto1lpDr ivils0 rxrxo iu4amtnlnes s)arrau  ot4aptomieiat a elnms t4artrmo3tatopt auvol() rxrio iu1lltn neilt artm( poo4tlxnmfciaslmDra( o t4 rtnxo ta1fpDrluvo ( texrim iy4ap emnvsa()a2umxm ;u1tptnii3ildla2elumsnt4 ltrirciotop r uvs t)teurio iudlleeliesatfs2uau pou4aex iieiytfsDem(vo u)tleoxo3iotlm r i i;s)sexr(o3no4ll   feslt srraxmp;o4alen i3tltfsDrlu p;(4trenmf3iydomtean i (0s2uoim ny1alee iesa()arrr(rono4tpeomoeiltfmDea(vo;u)aeerio3oydfaDe uvo;t texm(m3ny1openmfvslsf 2taump;o4alxoifeiatls2ranmp;u) rtoxrcoytlm r u o;t0trtrxopoy4lp nmnetl() rtm(mont0opx ioetldlmDea( p t)alenxo3iadfmteaiesl( trtoio oudomee fvsa(fsrtrxmoot0texo ietld a2ul(msn(4trxnir3iodlptr i sl()t2trim iudomee fcsls) 2ur(m ot0ole  f3tas s emnmpn(4 lerir3ia1late nvs t t2um(opio4optemivsa() 2tmu oou1olenmocildfsDuaumpnt)tetoirctadfa   n o t0 eto(mpoy4om  lfetl(fsrrrum ou4oeenioctyt sDeanvpnt4texnmoctodfpD  neol(0s2uoxmpou4lp  mfet ()a2umu  ;o4teeomfeilt m2uau p;u0 etrmf3ia1lpD  ues t s2tmiopou4ale mfeias sDta(rpou4oexnmfciltfsDulnvo;u)trerio3oa1fmtrlies s)s2uoxopno1omte ivsat  Dtmx ont4apenioetldfsDumnmp;u0 etrmo3ty1lptrauvs (0 2xrimpnodale lfesasfsrtrumoot1tpxn i3tltfs2ranvs;(0altomr3oodomDeluvilt0s2ur(o nu1omt  icilt)sDurxm nt4alx  ocilt mDum( p;t) eenir3tydopD li o;t t2tm(r3oy4al n ictas)s2tm(rpou4aeeo ietydla eluvo (0artrmr ta1op eai s;t trto(rpiu1ale mnvia(fs2rrxm nt0tpenmieildlsDel( p;t4tltrir3iytfaD  neo t  rtrxo3nudol nlfetat sDum(mo;o1apxnioeiydla rau pn()trenxo3oydlmte u i;t)t2xmxm nudop  lfcsltfarrm(rooo0olxo ieiaslm eanmp;t)tltomr3oy1lm r n s;t teurxm nydoptn fctls  rrm( pot1opxomoctys sDumums;(0 lenircta1fm elivo;s0s2toio3oo4oleemfcilsfsDrrumpnu0tpeoio3ildls2eluvont)tltrircty1faDelueo;(0 etoxo3nu4om  liciasfa2trxrpoo1tex if3tad mDuauvo t0 ltnmo io1fmDeauvo;t)trxmir nodameemnviasf Drrx p;o4tptoio3iydfsDeauvp;()tltnmfcto1optraivi s  rurirpiydol n fciasfsrurx  ;t1tlen oeiatfa uln snt0tetomf3oytlaD aivs ()srtoirpiy4ape licta( arrmum oo1tlt mfetldfsDuauvo;(4teenirctydfpt luvil( trtm(opou4am  mies t arrr(mp;u0aexomo3ias s ra(vpnt)altomf3iytlmDelu i;s)s2xm(o3iydale  nct t)aDtr(rono4tptniociydls em( sn(4tlxrif3to1lmte nvs s0srtm(rpiudopt  fei tf Drrx pnt0tpe mieias mDumnvo;t)tltoif3todfaD lueol(0 rxoio oy1aleelneia()srtaxroot1opxn f3tas a rau s;(4 rtrir oo1omt lnes s)s2um(rpio1om emici (fsrra(mpnt0alenmieiydla2uln o (4trxnio totfpDrluvolt trxmio3iy1op  livia( aDraumonu4oeenmf3tas sDrluvs;()aeeoir ty1fptraivi;(0t2xr(mpiy1ap emiesl(fa2trur nu0opeoifetadfa ra( snu)areoxrcoytlp eau olt tetmxo iydomt mieiat)a2umx p;o4olenio3tat s eaums;u0artrxocto1la  aieslt) eurio3io4alee ietlt)s2tr(mp;o4tpeo iciltlm2eau o t0tltoio3ta1lp e ueo ()t2tm(rpiy1apt mfetlsf rraxmono0tee  feiytlm umuvo u)alxrmf iytomtrlnvs;t  2tm(o iydlle mnctasfartaxmoou0opxo ieiaslmDua( ont0trxrmr3ia1lmDe uesls t2toirpnu4altelncslsfs2raxmooo4opx mo3iyd m emnvp (4arxnmfcta1laDelnvo;( seuoxm3iu4lpe mfcsa()aDtmum no1olxomo3tasfaDemnvonu0teerxo iytlmDraneo;() 2xrxo3oydllenmnesa(farrmur ;t1opt  iciatlm2emu o;u0altnxo3todfmt aieil(0 euoxr3iu1am   nesat  rtmxmp;t1texnioctysfm2elumo;t) rxoxr3todoat aivs;() rxmxmpou1ape  ivsls aDrrxm no0apeomieiaslaDrm(vs u4texrirctodopt  iei;t setoir iudale livtas srrr(  ;t4olxoiietldlm2ra( s ()trtrxo totfm raivs;s) 2uoxm3ny4om nlicsa( sDtaxmonu4tpto fciydfa2rm(vo;() eeomr3iotfpD lneo s0setmxmpio1lleemneslt a2rau  ;u0aexnmi3ils mDel(vo t4trxnmfciodlpt  nvo s t2to(mpoo4lp elncta()artru pou0tpxnif3iys aDuau pnt) etnmrcoadlp rlu il(  2tmirpiodom e ivt tfaDtm(ro;o0apenifciadfm2ul(mo (4arenioctatop rlnvols) 2xr(o oo1oleemnviat)artm(mp;u1tpenioetytfm2rlu s;t0tlxoxr totomt aiei (0t2xrir3ny1omtn fes () rrmuronu1alx mfctys sDum(ms t)tltrxrcoy1latrlu sl()s2xo(r nu1lp  mnvtl() Dta( o;t4aee mictysfaDeln o;t4trerxf totom  lu i;s teuo(r nu4alte net tfs2rmur ;u0tlx mi3iad m elumon(0tlerxrcta1fa   ieol(0setrio oy1llenmicsas  2tm( pnu0alenmo3iasfm2eau s;t)trtrio3todlmD li o s0srto(opoydlmen fvils)sruauro;o1opxomi3ils aDrmu o u0aexrxf to1opteaieo;t  euoxopiudlptnlfetl(  2uaumono4ole mi3iasls em( s u0tlermocto1fp eli sl(0s2umimpnydamte ietas arrr(mpot4oleoif3tas s el(mpnt0trtoxf3to1oaDe neols0 ruo(r3nodom elnciat)s2tm( o;o4tlx  ieiltfs elu onu)arenmfcoydlmD luvo;()texrxm3nudom emnetl()sruaxmp;o0oetn ieiad a2raumsn(4 lerxociatla ean il( seurxo3iydap  lnesat  2rmur nu1aexnmictasfa2umums t4tetoir tytfpD  uei s0 ruoxm3oudlmt liciltfarta( o;o4oeen f3iltls rmn p () rtnmr3oatoaD  ivs;(0trxrir3iy4op e icsls) rtaumo;o4olxnmietadfa el( s u)aeerxo ty1lmtr ivi;( s2xmim3oo1am elfvtls  rtm( pou1alenmo3iasfm2rl(vpnu) etnxo iytlaD ai s t seum(mpiydamte nctatf rrmu  ;u1tpe io3iltfm rmnmo;u0tetoirciotfp   nvi s)s2toxo ny4oltnlnvtat  2tau poo0altomo3iydlm uan pn() exrir oatfpDrlnvo s0trtrxr3io1apee ivi (farra(m no0tex  iciys a2em( o;u0aetrmfcto1latr uesls) 2xr(opoy4lpe  neilt)aDrrum ;u0olto fciatlsDrlnmp t) exrxfctytfpDe u o;( s2uoxr nu1al  lnvs sfs2uaumpot1tee ioctlsfm rauvp;t0arxrxfciytom  ln s (0texm(o oy1am emnesat) rur(m ot4tlt  ieiatfaDrau s;u0 reoxf ootlate ivi ()trxm(r3iydameemfeil( a2tmxmpnt0tlenmociysfs2ranms;t4 lenxociatfpDeaivs t0 2trxrpiy1lp emfctls arur(ront1teto ociltls2ea(vonu4aeeoircia1op eliei t t2urirpoydaptnlivsl(f 2rau  oo0olxomocildfm2emn o;u)teerxocoy1lm  aivs;s trumxopoy1opt mfcia(  2umx p;t4tetn i3iadlmDrmuvont4altoxrctadfat livs;t) rxoimpny4lmt  fvsat)s2urumonu1alen oeiasfa emums;u4 exrmf iy1fptelivs () rum(o3io1alte fcsl(fsrtmum nu4teeniociydfmDean s;u4 exoxo3iadlp   n o t truoxr3io4lleemivslt  Duax  no0tee iocild a umnmp;u)aexomrcia1lpDr u i;s) rxr(m iy1ome mfesa( a2rmxm oo1aleoiictasfa2uau p u) ltrmo3iodomteanvs;()sexm(mpoodalenmnetatfa2um( o;o4tpeoiietatlsDemn p ()areomo oodfateli sl(0t2umxrpnudopt mnviasf rurxmpnu4ope ifeiltfs uanvpnu)trtoif todomD  ieo (0setm(m oo4op n fctlt)srtrxm nu4opxoii3iadfm2uanmo (0 rtrxr3oydom  lneilt)srxoir nudap elicsatfarumxmoou1tpxoiiciytla em(vo u0 lerio iadlp rlies;t)sexr(m3nydap elnciat)aDuax  ;o4opx if3iatfm uan on(4 exrmr iytlpD au ol() rxo(m no1omt micia(f 2umum nt4opeomfeiltla2emnvsn()arerxo3ia1omtelneo;(0 2xo(m3oydomtn ieil() 2tr( o;t1oeeo f3iydfm el( s;u4tlenir3ootom r ueo;t)srxo(o oodol nmfcs t)a2tr(rpot1aex iicils aDrl(von(4 rtrmocoo1fm   n i (0seto(opoodopenmfesa( artruro;t4alto fcils m2umuvont0tlxrmf iadlmt livs;t s2to(o nudlm e ietas) rurx p;o1oleo ociasfm2uln snu4 reomf oodfmDelivo t)teto(mpiudlltemiesl(f 2uaum nt4tpe  o3ilsls2eanmp;()arxoxociatfpD an i ()s2umxo nodlpenmnvsat sDua(rpou4teto ieildfsDelnmp;t)texomo3iadoaD lueils0setr(m oydopte net s aDtaxrp;t4opxomiciat s2eau s;()tlxoioctydlm rlneo t t2tm(o3iodlltnlics (fa2trx onu0apeo ociltfaDean o u) etrifciytfm e i ol(0 rtmio3oo1lm nlfctasfsDrm( ooo4tlxo f3ias sDuanvs t0aetrxf ootfaDe i sls0 rtrir3nudlpt lnes s s2tr( p;t1apt  ocild m rlu pnt4tetnxf3iy1lptrln i;s seuoirpoudamtnmfeias aruaump;t4teenmfciltla rmu o;t) ltnmocoo1fpt lueil()seuoxr nodopt  fei s)aDraxmpnt1aetnioeild a2eaumpnt) rtoir3iadfpDelu sls0t2xmir oo4ap emnciat) Drr( oou1oee iieiatlaDrl( o () rxnir oo1oaD aueils0 exmirpoo1lltnmnesltf rtmx pnt1tetnmiciasfsDeanms t) rxrif oytlaDeauvilt0 exo(r3ny4om  mncsatfsrtaxr no0altoifeiys s2em(mp t0arxoif oytfmtr ieo;t)sexrir no4lmenmncs t)artaur nu4aleoiicilslmDul( s;u)aeeomfciadlm  luvo s)truriopoy1lp n fcias) rtr(rpnu1aetnifetadfmDrlumont0 etnxociy1lpte u i s)texmimpiodal   iviatf rrmu ooo0tpeo feiyd m ean sn(0 renxf3iotfm  an o;t  2tmimpio1lmee fvtl()a2taur nu0opx  ociatfsDrluvs;u0arxrxo io1latrlnvo;s) 2uoxr3iu4altnmnvsa(fsrrmxr no1aet  i3iasfa2rm( o u) lxnmrciodlpDelnes t0 rum(opoodopt  netas  2umum nt1tle mietasls ulumo u4 lxrmf3to1omtrai s s) exo(m3ou4am  lneil( sDum(moou0apxnmfcilt a2rmn s;(0 etrir tadfm  livi;()s2tr(m3iu4lltemietl(f Dta(rpnu4tpx  f3tld a rlumo u0arxnif tytfa   u slt) exoxr nodlle mfeia(fsDtr(roou0tlxn i3tlt m2eauvp (4trtrmfctytfaDrlieo t trto(m iu4ol nlfcs t  2ur(r nt4olxo ociasfaDul( o;t0tltnmo3ty1lpte ues t0trxo(mpio4apt lncs sf Dtmxr ou1aptnio3tltla2um(mp;(4texnmr tadom ranes s0tetrxm nudomtn fvsas)s2uaum ;t4tpe  o3iysfs2rmumpnt4trtoxfciy1laDean s;()trtmxm3nudlmenmnvsltfarur(r oo4apeoioeildlm eanvon(4texrmfciydlpDr ueslt)seuoir3no1alt lnct sf 2rmurpoo1tpt ii3iatfa2rmnvo;()trtrio iodlaDe ieo t  2xm(r3oy1lp n ict t)sDrmx oot0apeo feiad s2rlump u0aleoxr3tytfmDrai i s0 rxo(opiudoltnmnes s sDrrumono4alt ioeias m ulu p;u)aexnmo tatfm rauvo s0 etmio3nudlp n ieia( sDtrx oou1tlenmfctls m2emu pn() leomo iotoaD lu ilt  euriopiodapenlivsas  rumxmp;o0teto fctat s2rauvsnu0 exnio3tytfpDeau s;s0s2tr(rpiudam   fctat)sDtm(m ou1oexnmoeiytla rlu p ()aetoxoctadlaDr uvil() rtm(o3iy4lm nlnvt s) rrax poo1oexomfciytfs emu ont)altoxo tydlate nes t  2toxr nu1ol e nvtlt)sDraxro;u0aptn oetydfm em( p () lenxr3iy1oa  ai i;s)sexmxopnodomtelietltfaDuau ono1tlx ioeiytls uauvsnu)areoio ootfp rln o t) eto(m3nydlleelnvtl( artmu pno1apxo f3iysla2ulnmo;u0arerxf3oa1opDr uvol( seto(mpiodapee ivi () Durumoou4apt ifciadfsDul(vont4 etoif3tydlmD aieolt)t2uoxr3oudlmee ncil(faDum(mpou0teeomo3iltlaDel( p t)alxoirciotop e uei (0 exo(opnu1openmieils)a2tmu o;o4olxoifciyt a2rlnmon(4 exoxf ta1fmDranvslt)texrxm iu4lm e ncta(  ruax  ;u4opto o3iasfaDeauvp;u4tltomf3tadlpte ieo (0 2tmio3io4open fcils artaur no4aptn f3tyt sDuanvont0aetomfctodfptr nvi (0t2xo(opoy4lmee ivsas)srrau  no0aptnmfeiltfaDulnms u0teenxr3ty1fmteaivo;s0 euoir ou1alt lneil(fsrrrx p;u4opxoio3iltlm2umn s;(4 reoio3oytlat  ivsl(0srurim ou4al n fcs ( srrmxroot1aetomoeiltfsDeln ont0aleoif3oydfmtr ieo;t)tetoxm3io4amtnmictl(fa2rru  nu1aptniocild sDeluvo;u)teermr oodfpD aivil() 2xr(m ny4ol   ictas)s2trxmont1opt mfciyd a2ulu o (0artrio oydfp  anvslt  2xr(m3nodlme mivs t  rta(mp;o0apenmociad m el(vp;()trtrio3ta1oaDeai i;() 2trxo3oo1al emncsl(faDumum ;o4tleniieiysfa2rauvsnu0tlxrmociydlpDr nei s0t2ur(r io1lp nmfctlt s2rmu p;o0aptnmieiysfs emnmp (0texnxf iotopD  n ils)trtmimpny1omeelnvi (f rraurpoo0aexn o3iytfs ul(vo;u4 rxriociotopteaieo t trumim3iudopt mnvia(farraxmo;t1alxoiieiatfa2ranmp t)tetnio iytfp rai i;( srxmxm3iu4altnlicilt  ruax onu1apxomi3tad sDrl(vsnt)tetrxf3ootfa   i s;s) 2trxr3nodom n neiat)a2rmum no1aptnmfeilsla emn p t) ltrif3tadfm elivs s)texmxo3nodoleemiet (f Dra(  ;o1aee mf3taslm2rmnmo;t4tetrir3tatlaDr ivs s0srurimpiy4om  lneiltf Dua(r nt4tpeomfcias mDrlnvpn(0tlerif tytopDe ueolt)tetmio3oy1lptnlfeil( sDur(m ;u0tpt iietlsfs2rauvs;t0altoxf oatlpD li s s teto(opoodapte fctltf rta(ront4olxniieilslaDumumpnu0 eerirctydlpt lues;s)srurim3ny4ap e icta(farurxm ou1oee ifctldfa em(vo;(0altnircoatop elnvo;() rto(o io4al  licsas)sDrmu o;t0oleomo3tydls2um( pnu4tltrmfcia1fp eai i;t  2uriopnodap nlneiltf Drauront0alx  ociys s2rm(mo;(4arermf iadlpteluei;s0trxo(opiydopee ictat)s2tmu o;u4texn octys s2eaumsn()altrio iadfmt  ivol( trtmxo3iodom   nctltfa2umxrono1tex mo3tydls2rmn p () etnio iytoatr u i;t0srxo(r3iodlp n ici s)sDrrx o;o1tpx moctlt m2em(vsnt0 lxrmf3ty1fatrlu i s  rumimpoo4llee nvta( a2umurpot4tet mo3iltlm rmuvs t4 eenmo tytlm  an olt0s2xrir3oy4lp emnci s aDumu pou1altomiciatfs em(mp;u4 lenxf3oadomt aneo ()seur(opiu1openmfvsls  rum( o;u0tptnmietatlm rm(mp t0artrmf3oatfm elnes (0sexoim3iy4al nmies t aDrr(ro;o0tpto oeildfs2elu onu4trxrxrciotfaD luvslt0 eum(rpiodlleemnvslt)srtru  ;o1tetn fctasfsDum(mpnu0 rerxo3tydfp   i ilt  rxmiopou1lpeelfvtl(f Dtm(mpnt0opeoio3iltfa eanms ()texoir io1fm rai o;s)t2toirpiudapt mfvs tf Dtmumo;o4aetn i3ilt m eanvs u0alenxo ta1fmtrln s;t)t2urxopoodlpeelfetas artrxrpoo1tleoif3iyt m eaump;u4trxrircoydlat  u i;()srxrio oo4lp n ivi s  rur(  no0texo icils m2emu ont0 exnxo tydlaD  nvo t trxo(o nudomtelfvta(faDrm(  nt1alxnmfetyd a2ua(vo;u0 lermr oytlm ranvi t)srtoimpno1op nlfct t  Dtax p;o1tlenmicildfs2ulums;u4areoxo3oytlmte n olt sruo(o3iydopenmivt s  rur( o;u0tleoiiciadfm rl(mon() ltnir iotopDe n ils texrir3nydaleemnctl( aDrrumpnt0teeo ieild sDem(vsnt)artoxr iydfatean o;s)t2xrimpnodlpte icslt)sruau onu4tlen o3ils mDrmn s;u0tetomf ia1opDe nvi t)setmxm3io4optnlnesl(f 2rm(rpnu1tpt ifeiyd m ua(ms;t4aetoxf3oytom eai ols) etmxopnu4op n nvsas  rta(m ;t0opx ifciytfmDum( o;(4teermr oa1lmtrlnvsl(0 exrxr iu4alenlnei tfaDuaxr ot1olt mo3tat m rlnmo t0 rxnmr iydom r i sls0tetr(m3iy4ome lncil(f 2tr(rpou4texo i3tysls umuvp;u4aleoxrciadfmDe ies;(0trtm(rpnu1ol emiet sfs2ua(ront1apt miciasls2rmumsnt)alxoir3oodfmD  ues;(  etmio3nu4llt  ivtat)aDtrum no0alto octas m em(vont0teenif iydop r ueo;() eurxmpoodape mfesl()artmxm oo0optn feiasls2rmnvs;t0alenxr oytoaDe nei;t  2xrim3nodllte nvsls)sDtaumpnu1oleomfciad sDran o ()tlenmr tatop e nei s) 2xmxo3ny4om  lnvsa(f rtm(rp;u0opxnmfetat s emums;u)trermrctotom r nei t0srtoirpnudlm nmivilsfsrraumo;t4alen fctat m2rm(ms;u)aleomf3ootoaDr neilt  rtrim ny1lmt lieslt s2taxmpou0tpeo ociyt s2eaumonu4altomr3ia1lateli i;(0 etmxopiudam elfcias s2rrxrono0oleo ociadfs2rm( pn() lxrio3oatopD ai o;t0 rxmim3ou4om   ictl()srtmxmp;u4altnif3tls sDrlnvs u4tetrio3iy1fptrluvi s srurxr iy4alt mfcslsfsDtaxmp;o1optomociad s2rluvsn(4artrmf3iotopDe ues;t) 2tm(o oy1oltnliesls)s2raump;o4aetnmfeiytlmDrlnmon(0alermocoa1fateanvi s)t2xoir3oudope mncs sfaDumum ;o1tet  fctat m2rm( o;u)tlxrif3to1la e u i s sexr(rpio4al  livia()sDur(roou0aleoifctlt mDrl( s (4 lxnmo todfpDr nesl(  2xo(r iydlm  mfcs t)a2tru o;o4oeeniieilslaDuanvpnu)arxnmfctodfp  an olt0tetrirpnu4lle  iesa()a2urur oo4optn f3iat a2rmumo (0areomocto1fm  anvo ()seumxr nodam nmnvsl(  ruru onu0tlt  o3iytla2rm(von()treomoctadoat aneo;() 2toir3nu1lpenlfvsltfsrururont1aexn feilt a2rauvsn(4 ltrirciy1op eaieilt trxoxrpnu1omtemnvsat sruau  nt4ole mfeildfmDemuvsnu4aeenioctotoatr i i;()trtrxm3nu1opee nes ( s2raurp;t4oet mfctysla2rauvs t4arxrxr3oadoatrluvs s)sruo(r3ny1op  lfcslt)aDta(rpou0ole mfeildlm rm( s (0arxomo3ootfm   u i;s0 2xoiopoo1openmnciat) rtmxrp;u1opxoioeiysla2umuvp t4aetoir3ootfa  lieo ()texoiopoodome  netls) 2umxronu0alt  f3iadlm raumont0 rermfciytlp e nes ( sexm(opnu1ome micsltfsDum(  ot0aeto fcilsfs2ea( snt4areomf iotopD  n ols0texo(rpoydopt lnes s srrru o;o1alt miciysls eanvs t4 etnir iadlm raivi t0srxmxmpny4lpt  nvt t)srrrum nt1oee io3tytlm emnms t4alermfctytlptelu s ()trxr(o3iodame lfct sf 2rmx  nu4oee mfetltfa el(mp;(4aetomrciy1fpt  uvo;s srtoxopnydolenlieilsfa2rr(mo;u0olxomiciys a2eaumpnt4 eenioctatoaDe nes ( teto(m3iydlmtelfcia(  2trurp;t1opxn i3tldla2rmn p;t)trtrxf3tytoaDeln s;s0 eur(o3nu1lme livi sfarumx o;t4oex  f3iyt mDranvo;t0arermfcta1laDeanvs t0srum(o iydalee feias  Dumx poo0tptoio3tysfm rmuvon(0alerxfciytomtrlieils0srxr(mpny1olen nvsls)a2rmuro;t4tlt  fcilsls umumo u4aexnmo3ootfpt luvils sruoxm3ou1op  mivslt)artauroot1olx 
\ No newline at end of file
@@ -0,0 +1 @@
+nvsls0s2urxmpio4lm  mncsl()aDtmumpou1ole ifciysfaDrau o;u) exoxr3todlaDranes t0 rtmxrpno1ll  lfctlt srraur nu0aleomo3iyslmDean p u0arxnxo iatlmtranvol( s2uo(o3iydopee nvt sf 2urxmo;u4optnmictltlmDeaumo;t) renmociydoa rlneo ()t2xr(r oudoltelnvtl(fs2uru pnu0oexo oeias s2emnvo;(4trtomocto1faDe ieo t s2urxo3iu1lmen nct s) ruau oot0tpxniieiytfm2ea(ms (0trxnmo totlm r ieo;s s2xrxm no1oltemivsat)sDrr( p;t4teeniieiytfm2eln pn(4aexrir3tydlatelivo;() rxmxm oo1lp e ictlt)sDtrum ;o4tetn i3ias a em(vp (4arxnio io1fat aivs;(  2umxopio4aleemfcta(fsDtax  no0opxniiciatlsDua(mont4 renmo ty1fmDrau s t truoio nu1ope  ici s artaumoot1optnifeiasfa umuvpnu)aeeomfcoatop e i o s setr(mpnudlpt mnci ( sDrr(r ;o0alx io3ildlaDrl(vsnt)areoxf3ty1op rluvsl( setr(m oo4ole livsa()a2uru ont0apt io3tatfs rau o;u) rxrxf3oydfate uei s)srum(o iudlpeelfvsa(f Drax  ;u4alxnmo3iatlsDel(mp;(0 lenxo3ootomD anvo ( srurim3oy4ole lfeia()a2urump;t4tlxomiciyd aDrluvsnu4aexoxfcoodoptrai i s t2tr(o3iodole licsa()s2rr(m nu0alt ifeiat a uluvpnt4tltnmocio1lpt  iesl()srto(r ou1altelnct sfaDumurp;u4oltnioetlt s2ulnvs t0trenmr3io1lpteauei;() rumirpnu1om  licslt)a2rmxronu1teenmi3iadla2rmump;u4tltnir ia1fp rauvi t srtoxo iydll elivs tfsDrmur ;o0texomf3ildlsDranms;()tetomr3oodoatrlneslt texo(rpiu4aptelivslt  Drmu pot0oltoiiciaslmDuanvp (0 leoxrcoytomDe uvolt0 etm(rpou4lmen ivi tfaDraum ;o1aee io3ildlaDranmsn(0altnir3ta1lmDr uvi (  rumir oo4ap  mfes tfsDtmu  ou4tet ifctld a2el( s;t0aleomo iy1fmDraieils  eumxm iy4lmtemneils) 2tmxm oo1ape  ociytls2uaumo;(4 exomo iadfatraiesl() etr(m3ny1ame  nesa( aDtrur ;t1oetnmoeiyt s2uanvo t0arxrif ia1lptrliesls0 exmir oudlmt licsl(fsrtrx  ;o0alenmieiadfaDrmn s;(0tltoxf3tatlpt an s s teum(o iu4lpeemnesls srumx pot1olxnio3tas s2rmuvp t0trtrir totopDe ueo () 2uoirpno4apt mfvils a2raxm ;u4olx mfctadls2emuvo;t)trtomfcia1late i ils0 etoimpny1alt  feils)sDtm(rpnu0tpxniiciys a2uluvp t) rxrir3iadfptelu o (  etmxo iu1oleemnvsas)sDrauront4tet mi3iydls ul( s;u0artrmrcoodfptrlu olt  etm(o3nodlmeemncta(fsDumxronu1aptomf3ils aDeaums;()tltoir oa1opte i o;t) 2uoio3ou1ameelfeil(farrrx p;o0olxn fctlt s2em(mon(4 lxnxrcoy1oaDrlnes;() etoim3ou1olee fctls a2urxrpnu4tleo fciasls2em(msnu0 rermrcootfa  anvsls0srxoio iudaptn fvia()sDrrur oo4tlx  fciydfa2rlnms u) exoirctydoa e n o;s0 rumio iu1olte fct tfaDta( ooo4oex mo3iys aDem(vo;()alxnmfcoa1lateli il(  exo(r ny4ale mncsls arur(m nt1olxnii3tytlmDea( o;u4altnif3tydfp   i sl( t2trxmpio4lmeemfct ( sDur( p;u0alxoiiciyd m2umnvp;()aexnif ty1lmtrai s t0tetoio ny4apt  fvt tfsrrrumont1aeeomiciatlaDrlu o u)arenxf3ty1oaDrluei t)setmxm ny1op eliesat  Dua(  ;t4ole mfciat s uanvpn(4trtnmr oydoa r n i;(  etmim ou1lpen nvsls artmumo;t1opt ifciydlsDea(vo t)trxoxr oytomDeai sl(0 2xm(r oudolen nci s arrmxronu4optomieils a2rlump;()trtnmo3oydlpDrlnes t  2tmio oy4lp  mncsltfaDtm(moot4aex  ieiyt sDelump;u)aeeoxr totlp eln i t0s2to(o nu1lm  lfctatfartr( pnt4apenmieiydfs2rmn o;u0 reomo iadlpt anvi t)trxmim3iy4omt mfcil( sDuaur nt0tlt miciys m2em(mont)alxoxr totoateanvs;t0trtmio3oodalte fvilt artrumpno1tlxnifctatfa eanvs (4artnxr ty1la eau i t0t2toim3nu4oltelnesa( sDrrxmpnu1tlx mfcils m rlnvs;u0trxnif3oodlm   ies s0teumxo3nydomtelivias  rra(rpot4alx  oeiat m ranvo t4aexoxf3ootfp raiei (  rtm(r3oy4lle  fcia( a2ta(rpnt4oee ii3ilslmDrauvo;() lenxo3iodlpt an s (0 2ur(o3iu1ole mfvs (farum(  oo1tpx  feiys mDea( s (4trxrmr3oa1fpD  ues;t0 rum(o3no4lpenliesl(  Dumxro;t0tle  oeiad s um(mp (4artnifcoytop e neolt)srtmxrpnu4ol emfcsl(farurxm no0tpx  oeiat s2emumo t) ltniocoa1fmD  ieolt srur(m io4altelfcs s aDuaur ;t4tetomi3tyd a eauvo ()trerxo3oodop   ivo s)srumxmpoodole  ici s)sDtru poo4texnmieiltla2umuvp u4 ltrmf oadoaDeaivols  etrxo3oo1ll  liei ( a2tmxmpno1opeoioeias sDrlnvs t4 eeomociadfm  lnvslt) rxm(r3nodlm nmivs ()s2rm(  ou1olxoiieiyt s rm(mo u) rxnmf ty1fmteaivi;t  rur(m nudomtnlicsa(fa2raurpnt1alxniictadlsDrlnvo;t0 ltrio iotlatelu i s0t2urxr ny1omt mivtas s2tau  no0olxoio3iytlsDuluvpnt)artrxo3oo1opDe iesl(0s2to(m ny4altemfvsa(f rraxr nu1aptoiieils a2umums t) rxnxf3tatomtraivi;t)s2urio no4omen ietas) Dumu  ;u4oleo f3ilsfaDra(vo t) ltnxrcoadomtrauvi;t  eum(r nodapeelfcsltf Dua(moou4tptoifetasfm eln o;(4trxnir3todoaD lieo;s) eto(o no4al elfeil(f Dua(  ;t4aleomo3iadlm2rm(mp (4 rxnmfcoadlaD auvi s0 rxm(opoodll  mfvs (  rurxm ;u1aeeomo3iys mDel(vpnu)alenmrciadfm elueolt  2uoio iy1ol e neslt)s2ua(rpnu0oee  fetyd aDuanvp t) exoxocoo1faD auvo t0 2xrir3nu1aptn ivtat)sDraxroot1alen iciadlaDean pnu0 leomrciotfmDe uvol(0t2xrim oo1ap elnetatf rtrxr oo1tetnifctytfa eauvsnt)tlxnir oo1fatrluvsls t2xrio iudlmtnlicias)aDtax onu4aeen iciatla2ean o u0aetoxociydlp  lies;( t2xm(m3oodopeemfvil()artaxrpou0tle  f3tlt sDuan p;t)alxnxr oatomte uvs t texr(opoo1amee nvs tfs2tmumpou0optomoetltla2umnvpnt) ltoxr3oy1fa  ln sl()setrxopio4aleelivsls  rurxronu4opxo o3tyslsDua(ms;()tlerio iatopDeau s;t)s2trim nudome  ivsltfa2trumont0olxoio3tlt s2el(ms;u4artnmo3iotla ranvi;( t2tmio ny4lp nlfvtl(fs2umu ooo4aexoii3tadlsDuau p;t)trtrif3iadla  li o (0 rtmxrpiu4ap  lictas)srtm(mp;t4optoiieiytlm2el(mo;u)texnif tatopte uvs (0s2trxm3no1apenlicsa(  2rrxr nt1tpt mfeildlsDrluvp u4tetrxocoodfpte ies ()t2tm(r iy4lltemnciatfartrumo;t1aleo ieiatfmDul( p;u) etnxr ta1oa rlues;s0 rumir3oy1altnmfct t s2ur( onu0texoiociytfm elu o u4 exrmr tadlpDrlu i (  rurxrpoydolte fetas)srrr(m oo0aeen i3tad m rmn p ()tltrxr oydopDrlnvs t0sexr(o iudoleemieia(f Draurpoo1aleoiictld a ra( o ()areoxo iatlptelies t)sruoxm oy4lp e neta( artrxm ;t4aptnio3iatfaDem(mont) etoio oo1opteaues t  etoir3nodoptemnvsasf rtrum ;u1oexn feildlm2ea( ont0 exniocio1oa eauesl( seto(o ny1lmtemict (  rraxro;t1tpx  f3iysls em(mp;(0 rtnif iatfpte uesls trxmim3no1openmfesas  rrru  ;t4apxnio3tld aDulumo t0 eenirctatlm r nvi;s)texrio3oy4llt mnvt ( sDtauro;t4texomi3iaslm um( snu)tlxnxfcoadlpD  ues s0trxm(o3ny4omtn ncilt  2raump;o4tex  i3iadfsDranmp (0alxrmo io1faDran o;() 2tmimpoydolt licsas) 2tmurp;o1altoiicilt m rlnmo;t)tetnxrciodfpDeaivs;t trxmimpno4lptemfvsl(f rrrxrp;o4alenmfciasfa2emumo t4aetrxo oodlmDrlneilt0s2uoxm oy4opeemncsa()sDtaxrpot4opxomo3iatlaDemnmonu)aexoxrcoa1optrli o s  exrir nu1amenlfei tf Dtr(rp;o0aetnioeiadlm rlnmo;t4trermfciotlpDraneilt)teur(r oodaptnmnesl(f rtrx pou0oleomoeiytfsDra(mo u)trtriocoa1lat  i s;(0 2toimpou4altnmfctl(  rra(moot0tpe  feiadlm uanmonu0 exoxf iodlp e nvi t)srumir3oo4lpeemnesat)srrrxmp;o1aexn o3tydlm2emn o u0 etnmf3oo1fpt  uei;s  exmxm3oodom n nvias)srua( pnt4alx moeilt aDrauvsnu0 etrxr tatfp e ivo ( setriopiu4lp emnvia(farurxro;o0oeeo ociadfm2raumonu0 exoir ia1fpD  ues;t0tetmim nudll elneil() Dumx ooo1altoif3iatfs2emumsnu)tlxnifctatop   nesl()tetmxopou1om elfvsl( aDtaxrpoo4teenmoetadlm2eanvo;t)teerxf oadfaD  ueo (0t2umxo3nodlp  licta(fsrrmumpnt4aeeoii3iasfa2emuvs t0 lxnmr3iy1lateaieo;t)s2um(m oodlleeliet (f 2ra(mo;u1tlt iieiysfs emu pnt0tlenxr oytoptr neo t texmxmpno1aptelivi (farua(rpou0opxn feiasfs2rmumpn(4aexnxocoytomDrauvs;s0srtmxmpiu1opeelnesat a2umurooo0aleo f3ildla ran p;u) exoxfcoadom rluvils teur(opiodolt mfvsatfs2umxr nt0oet  f3ildfa ul(vs;t0trxriocootlp e nesls t2umxmpnudllenmfvsasfs2uauroou1aleniieils mDel( pn(4tetomocoytfmD anes ()t2triopoy4lp n ivtls) Drrurooo1tet  f3tlsfs2rlnvsnt) lxoxr todfm eauvo s0s2toir3ny1olte fetl()srtrxrpno4tlto ieiytfm2rmu p;t4 ltoif ootfm rluvs (0teumir3iydoltemies s srur( p;u1tpeoii3iysla2rmumo;t4artoio3oa1oate n o s)t2uo(r ou1amen fcias s2ua(ro;o1optnmfctytls2um(vs;u4 lxrxo3tatfptranvolt)t2toiopiydop   net s)s2tm(mp;t0apt ioctyslm ea( p;u)tlerxo iotoat an i () 2xoir oodap n icta(fs2umurpno1aeeo iciat mDum(mp t0 lenirciytom r u ils)t2xo(opiodape lict ()aruaxr nt1open o3ils m2uan pnt) lxnxfcoadoaD livo s)trtm(r ny4alt  nesl()aruaxrpoo1apxnifciat s rlnmsnt)teeoirctadfmt lieilt) exmxr3io4optnmnci (fs2tr(  ;u0aleoii3iyt a2emu s;u)tlxnir todlm rau o t0teuoxo3oodale  iviatfarrm(mpot4oet  i3tas a rlumo u0trxnmf3oadfptr ueo;s sexr(r nodlm emfvs t  2rmurp;o4tltnmociatfsDrauvs u0tlenif iydfpD ln olt0t2xrir nu4olee fvt ()a2rrx  ;u1ale mfeiaslmDra(mo;u0aexnmr3oy1late nvo ( teumiopnydolenmivtas)sDtrum ;t0alx miciys aDelumo t4 rxrxo3oa1laD lnes;s)s2xrir3iy1aptelnvsasfsrrrx pot4olxoii3ilsls2eanvo;t4 rxoxrcia1optelieils trumim ny1omt livt t  2taum nt0olen oetadlaDumnmpnu0alxnioctadfmt li ols0texr(r iu1apt mieil(  rtr(ronu1tetnii3tatfm ul(vo;u4 lxrxrcto1omte n slt sexo(r3oydal   fvils) rta(r ot1aetnifctyd m umuvo u4 rxomr totfateaueols0 eur(o nodam e ncil(f Dta( oou1teen fetysfa2uanmp;u) exomrciydopDraneo s)texr(rpou1lp emneta(fsruax onu0apeoiiciydfa2um(vp t4 etrio3oo1laD lneo (0texrim nu1lpen nvil()srrm( o;o1aeenioetatfm umumo ()trenifcoadlpD lu s;(0 rtmio3io4olen fci tf Dtax  ;o1opx  ociad a2um(vp;t4 rxomf3tydfaD luvols srur(m ny4amt micil( arur(r ;t1apeomicildfsDem(mo u0 reoiocoadfmD aueo (0teto(opiydapee ietlt s2uru oou1oexnmoeilslm elu on()texnmo tatlptr uvol( srxm(rpoudomeemfvt t  rurx pot4aetomfetydfm2rmumpnt) exoxrcoodopDe uvsl() rxmir3nudol nlncia( a2raumooo0tlx  feiltls umu o;u)trxrmr oa1fmt  n o s) 2um(m iu1apee iei s  rum(m nt0optn o3iad a el( o (0aeenxrctatfm e n i;s)setoxr nydomtn net tfarumxmp;u1tptomfciyd s2el(ms;(4tlxnir oa1fa rln o;s)sruoxo oodoptelivias) 2rau ono1tleo ictlsfa2raumo t4aleoxr iatfmD aiesl(0 rum(rpnu4alen fctat  2uaum ou0aeto f3tas s2ua(vp;(4trtoxr totlm  anvo;t0seumirpoy1oltnmfesasfs2trumo;o1olt io3ildls2ul(mpnu4 reoifcoydlateai o;s) 2umxm io1apenmieils)sDtr(  no1oet mfetldlm2uluvon() reomocoytfa eaies;s0srtrio3nydamenlfes s aDrau  ;u4open o3ildfmDul( p () exomr3iydfa  aneolt)t2tm(o3oy4apeemfetasfaDumum oo0apxn o3ildlaDea( snt4texnifcootlp e uvi (0seuoir iudomte fvia( artaumoou1aeeoif3ild m2ea(ms;u0treoir3oa1oa  auvi;s0sexmxo3ny1apt  fvta()srumur ot4ape iociyt mDel( o;t4artnxr totfpte uvo t0 rurxr3ou4lptnlnvsatfsrrmxr no4oet  ociyd mDulnvsnu) eeoio totfmteauvo s0 2tmio3io4lm  lnes s)a2rmumpnu0tle ii3ilt mDran o;u0trtoircta1lmD  u o t0s2um(rpou4am nmiet tfaDrmxmoot1tpe mictlt s el( s t4 exnif oatlm   n ols trxrxm ny1amt mivtat s2tmxroou4tleo feiytfa2rm( o (4teeoirciotomDranvo ( texoxm no1oltn fci ( srrrxm ;t4tee mi3tld s rm(vs u)trxrir iytomDr i o s0t2urim3oo1lpeemnei (f Duru p;u1ope ifetltfm2uau s;t)trxnmrctodfmtranei;(0 2urxr iu4lptn fvsas  Dtaxrp;t4alt  o3ildfmDrau p;u4teeoiocoo1fmDeaueo () etrio3iu4olen net ( srua(  ot1optomfetldfs el( o;u4 lxoircoodlpDeaivs;t0 2uo(mpiydam  mnctl() rumum nt4apt  fcias aDelnvonu)tetoio iatlm  aies s0truoirpnu1om  mfesa(faDtr(m ;u4tlxoiictltlmDel(ms;(0 etomoctodfaD au s;(0t2tm(r3iodam elnet ()srtm( oot4altniocilt s2um(vsnt) renifcty1oa eauvs;(0 2tmxr3nu1optelnvtat arrm( onu0oex  ieiat s2rlnvpnt0 reoif3ta1om rlnes;()setoio3nudlme mfes (f 2ta(  ou0tpeniictytfmDrln p;t) ltoir iatoa  lnvo;(0sexrir ou4omeemfciasfartmumpnu1apxnmiciytfaDeanvo;(0arxoxf oo1fmDraieols  ruo(r3oudlpenlicsa()sDua( ono4oltnmocias aDel( s;(0aetoioctodlp  aiei;s t2xoirpiydopt  fcslsfsDua(roou0apxn oetytfa2emumpnu4aetnio3iy1fmtrau o;t  exo(m3iu4aptnlicta(fa2uaumoot1tlenmf3tadfsDra( s;()artomo3tytlaD lnvo t truo(m3oo1apenmieilt)a2rax  ;u1tle io3iytls2rmuvp t4 etomf iy1lm   ieo (0 rtmir3oodam emnctl( a2ra( ooo4texomfciyd a2el( s;t)alxomocoadlmD li i () rtoxopoudameemietatf Dtr(r oo1open fciasfsDrm(mo;t4aeeomoctadfmtrlivi (0sexmxr oydam  lfvslsfs2rrurpnu1aeeomi3iyd m uaumo u)aexrio3oydoat luvols0seuoir3io4llt  fctl(f 2rmum ot4apx  f3ilt m rluvp t0 rtnifcoy1fmt luvo ( srxr(m3iy4opt licsas)artmxmont4teen ictatfa2rmn pnu4aetnxf3ty1oa  lieo () etoxr oy1lltemneilsfsDtrxm oo1ape mi3iadfs2ul(mp (4artnxf oadfaDe nvi;s  rxmxopnudapenmiesatfa2urxr oo1teeniicias s2rmu on(0 ltomf to1lmDe ues;(0s2tmxr no1oltelieta(f 2trx ont4texnmi3tyd s2rmuvo;t)teeomo3tytfa  lneo;(0srtm(opoo1omee ietltfa2rau p;u4oltomociys s2ul( s;t0 rerir3oadfmt livs;(0s2xrxo3no4ale lfcslsfa2tmu oot1oleo ociasla ra(mpnt4altomf3iatomDrauei s)setoim iodopee icslt  rur(  oo1tee  f3iydla uau p t) etrmo tatomt au il()setoio3iydll   ncilsf rrmxront0tpx mo3iytfmDrmuvo;t)tlerir3oatlaDraieo;()sexr(m oudomtnlieilt srtaxroot0opt iocils mDel(mpnt0 etnmo3iodopDranvi s)teuo(mpou4ap  lneta( arumxr no4aexoiociytfs el(monu4tlxnxr3tytfptelivolt)t2ur(r oo4lmt  netlsfaruaum nt4tlx mietldfaDel(ms u) exoxf oy1latrlivo;()texrim oy4am  mnct s)s2uaxrpno4altoioctyt a2elnms;(0alxnmf3ta1fp raueo;( t2tr(rpou4ll  miet t a2uaurp;o0tetn ieiadfa2emump;t4trtnmociatomDeau i ()trumim3no4olt mici sfsrtru  ot0alxnmf3ildlm rln s;(4 rxnxfcoo1faD  neols) rxmir3iydop elict ()sDua(mpnu0ape mo3tltlmDul( p ()tltrio tatlaDrai i t)texoiopnu4lmte fesa(  rra(rpnt4ale  oeiatfs eanmont4tlxoir3to1faDr ieols0teumxopnodamt lneia(fs2urur ;o1tlx io3iad s2rmnmp;(4 exrir3tytlm elues;s0t2xoio oo1oltemnviasf 2uaump;u0tex mf3tat s2ra( s t)teenir oatoaDr nvils0trtrxmpiy1apt  fciat  Dtrurpoo0ole if3iytla ul( s ()arerxr3oo1fm   uei;t)s2um(o nu1llt lietls aDtrurp;u0aleomi3iadfa2emuvo;u4 ltnmr ty1laDe n o t)t2um(r iy4lltnmnvi s) 2rmx  oo1teenifciaslsDrmn o;(0tlenmociytomt lu i ( s2ur(o oy1lmtnlies (faDtr(r no0tet  f3ils m emnms;() eenxf3oo1fpD ai s;t)trxmxopno4llte ncs tfsrum(  ;o4tlxn feild m2ea(mon(4aeenxo3iatfpD  neo;s0srurim io1lltn fci ( srrruront1tetn i3tlslmDemn o (4aexnif3ia1lat anvs t0srumim3nudapee ietat) rum( pnt1alt iociadls2eau o u) exoioctotom e uvs;(0 exoio3ou4lpe livtlt)arum(roou0openioeiltla ul(vonu4texnmoctodlaD livil() 2uoxr ny4lle lnes t) Dumu pou4teenif3iat m2ranmp (4tlerxr3oydfa  luvs;s) exmio3ny1amtnmnes tf Dra(ronu1aex  o3iatfs ua( p;t0 exnmr3iy1opt  uvo s0setmiopny1lmeemivsasfa2rrumpno1tlt  f3iltfmDeanvsnt0alxoio oa1op  lu o;() etr(o3oo1am nlfvs ()arumuroot0tetn oetls mDranmp ()trenifciadlmtran s;(0 2xmxmpny1ape  ncslsf rtm( pot4tetnio3tlt aDumuvp t0treoircia1oate uesls srtr(o3iu1lptemfcslt s2ra(  ;u0openio3iadlm ra(vp;(0aetomf3tadlp e u ilt0seum(m3io1alenmivi (f 2umxm ;t4aetoiociydlm emnvsnu)alenxociatlmD  uvo t)t2toir3nudoltnmnetat)artrumpnt1ole ioeiasla rln pn(4tltnircty1opteanvi s t2to(mpoo1alt mfvi t aDumxm nt4optoio3iysfaDea( p;(0trerxr ootom  ai i ( trurxo3oydlpee ivias artaum ;u1tlxoifcilt aDem(msnu4 renir3iodfpteanvi t)s2xr(m3iudlm  mnesa( sDtm(mpno1optnif3ild a2um(vs;t0aetrif iytlm   ivils0 exo(mpny4om nlicsltfsrumxro;o0tetomi3iasls2rm(vs;u) eerir3tytfpDelueolt)srur(opoo1ole mncs s)aDraxmpoo0oltnmf3tldlm umu s;t)artomf to1optrau o s  2trxo3ny4omt miesls)a2taxrooo1olt  ieias s2um( s;() etnmf3oa1op rauesls0 eto(rpiy4lme  ncs ( arumurpno4olxn ictatla rl(vp;(4aeenxf iadlatraieo ()teum(r3ny4lmtnmivsa()a2ra(mpoo1texoioeilt mDrln p t4 rtrxo oadlat  ieo;t0teto(opoo1ole  nvtl(fs2uax  nu4opxo f3ilslaDuauvpnt0trtomociadomtrluesls0srxmxopnodap emfct () Durxmpno1olt  f3iys s2ulnvs;u0tetoif3oy1opDe nvs;s0tetmirpny1lle mnvias)sDrmu ont0optnio3iatls2emumon(4tlxnmr iytlpD lneil()teuoio io1ameemfvsa(faDumurpno4ole iocils m umnmp;t4alxnxf oadla elnvols  ruoio oy4ll elfvi ()aDua(rooo4tlxnio3iys m um(mo (4aeermo oo1omDr nvo ( tetmir nodaptnlicia(f rururoou0ale  ieias a em( pnu0tltomr3to1lateanvols) rxmxmpnydol  mncsl(f Dum(roou4alxnmictlt sDrmumpn()aetrxf oy1lpD  ivol()s2toim3iy4amtn nvils)sDurxmono4apx iieiytfsDum( on(4 rermo3oadfpt anvi ( tetm(o oy1op e fes s)s2taxr nu1texo fciyslm rm( s;u4trxnxocta1opD  ivs t  eur(m3oodop e fvtasfartaxro;t1altomf3iatlmDeanvp;u)aetrmr tadlaDelueslt t2tr(o iy1lle lieilt arurxmp;u4opto f3ilt sDra(mp;(0tlenif oy1lptrlnvs;s s2urio oo4altn fvil(faDur(moot4tlxnmoeiys mDean p;(4altriociadomte nvil(0 euoxr ou1ol elicta(  rra( onu4tetoioeiltfa2rauvp t) etrxo3oytlpDelivol(  rxr(r3ny4olt  nvtl()a2ua( p;t4openmfciatlmDranmo;u4alxomf tadomDr u s;s trxr(m3iydoltn ictatf Drau onu4tlxo o3ils a2ranms;t4 ltomf tadlpD  uvs;s seur(o iu4olte ivt s  2urxroou1openmictltfsDeauvp u0aeeoif tydop e u sl(0trxm(rpou4lp  livta( sDtrxr nu0apt iieiys a2eanvo u)tleoio3todfpD ai ilt  rtr(o3oo1altnlnct ( s2ur(mpnu4oeenmf3iatfmDrln s;()teermfciadfate ies;() ruo(m3io4ap eliet t  rurxm ot1tee moeiyt a2em(mp;t4trermocty1lp rai s;s0teto(m3iu1lptemfes tf Dtrx  nu0apx ifeiydfs rauvs (0aexrmo tadopt li s;s) euoimpoy1openlicsl(fsDrm(  ;u0oltoioeiydfm ul( p;t4 lxomo3oadfmtr u il(0t2toirpiu1om nmiesl(faDraxr ;u0tpeo i3tasfm ua(vsnt)altrmo3io1fp rau slt0tetmim3iu4lme mfcsls  Dtax  no1oltnmo3tad sDraums u0trenxr tadlpt ln o t teur(mpoy1olte fvsl(  ruau o;o4tlxomo3tlt aDem(ms u0aeermf3oadlaDrau ils0 2trxrpiu1ope mfes s aDumxm oo0texn f3ilsfa2ua(vp;t0aeeoio iadlm e i o t0 rxmiopnu1optemiciasf 2raxmonu1oetoioeiat aDuaumo;t0 rxrmrcoytlpt an o;(0srurim3io4apenmietat  2ta(mp;t4altoii3ilsls rl(mp;u)aexrmr3to1fmD au i;t)srtrxm3iudopeelncs (  2trur nu1oee miciltfa2em(vo u0texrmocoodopt li i;(0 etoxmpiu1lmee fesat  2uaxronu4tee if3iytfs2ua(mp;(0 renifcia1oa elnvsl()teum(r3nudopee fcsat)a2rrxm ot4apenmo3tltls emumonu0arxomo3oydlm rauvo (  2umio3nodlm n nviasfarur( ooo1tlt iociyslaDrlu snu0altnio3tytfm  aueolt)t2tr(rpoudom e fvtltfs2ur(rp;o4oexomo3iytlaDrluvs t0 etnircoy1fa  livo (0sexmiopoo1ame micils)aDuaump;o1tlx mo3iltfsDuau p t4arxoir3oa1opDe u o;(  rumio nodopenlfctl( aruaumpno4alenmietlt a rlnvp;u)texomo3ty1lm rlnvo () 2toimpou4amtnlfes s a2trxmp;o0oltoii3iytla uaums;t0altomrcoatlm  luvols0 rxmxr3oo1op emict (fartax  nt4oee  i3tat m rln o;u) rerio ia1fm e ueo ( teum(mpiy1olee iet () rumxmpno1aleomi3tyt a ranms (0 exnxo oodlm rlnesl(0s2xmxrpoo1lp  lfcs tfa2urxmpou4aptomo3tytfaDrl( snu0aetniocoo1fmt ln i;(0truriopou4lptn ieiasf 2rrxmo;u4oeen o3iytfm uauvs;(4arxrxrcootlmteaieilt0 rxoio iydalt micta()aDrm(r oo4apto icias m uaumpnt)aexrir3io1laDe n i;( teumir iydlmtnmivsa( sDua(m nt1ole ifeias aDrlu o;t)aetnio oo1faDelnvo;()srtmxo3oo4lpte nvtlsfaDumx o;o1tetomoeildlm2ea(vo;()tltrmo iodomtelieolt)setr(r ou4optnlfet tf Dra(mooo1oexn iciydls ul(vo u0texoir3iy1la  aivi;t  exr(m iu4opt  fvs (  rurx oou1aetnmi3iysfaDuan p;(0tltoxocto1fpt ai i;s truo(o3ny1lp nlfcsl(  Durxroot4oeto ociad m2ranvpn()texrio3iy1faDr u i t seur(mpoudlpe mfcsltfarrmum ou4alxnmoeils m2umnmont4trerxf tatopDe nes s)tetriopoydal   neta(  rtmxm no4aee  ociydlsDrauvo (4arerifcia1faDe ueol(0 2toxo oo4lpen ics (fsDtmx  nu1tlxn o3tlsfs eaums;u0 rxoxr ta1fm   neo s s2tmxmpou4lle lfvtat)s2taurooo0olx mi3tldfsDrl( s;(0trxrmf totlptrlues ()teuoim3oy1ol nmivias)a2umum no4oeeo ietls mDeaump u4 rtnxr todlm rli o;t srxmxm3iodll  lneia()srtrx  oo4tptnmfeiysls2rl( p;u)tetomf3iytop r n ols0teumxopiodopee ncsasf Drm(ront4olt miciasfa rm( s;t)trtniocto1faD an i s0t2xriopiy1olt  ivi s)s2tmxmoot1tltomiciasfm2umnvsnu)tltnxo to1lp raues;()trxm(opnu1olenmnvtatfaDumum oo4opeo ictaslm emn s;t4alxrirciytomD lneils  2um(m iodlpenlfetlt)arrmx o;u1aeenmf3iltfm2ranmo;t)aeermo3iytlmt  nvi;s s2toim no4llenmfetls sDtrur nt4apxoifciasla um( pnu0 rtomr3oodlptraneslt) rumxopio4ll  livi s srtm(  ;u1tpeoioetltfmDumnmp u4 etnmr3oodfmD lues;s0t2xoiopoodlm  mictlt)a2uru  nt1alxoiietytfm ul( o;(0artnmo tytlp r uvo ()t2to(o ou1lmtn ivs ( aDur(m oo0tetnifciyd s rln p;u4texrmrctytoat  n i t) rurxrpnudop emicias)srrr(  ou1alen oetlsfm2rm(mo u0artnxfcoatfmDr ivils)s2uoir oy1lpt mfesas) 2rm(mooo1olenmf3tytfm2umu o;(0tlxoif ty1fm elu o t0srum(r iu4am nmicta()arrm(  no0apxnmoctls a rm(vsnt4aleoxoctotfmDe n i s s2xmiopoudolen ictlsfa2rm(  oo1tptomoetat sDrm(vs;()arxnir iotlpt liei ( srxrxmpoy4om  lnctls s2tr( poo0tpt io3iydfs2rlnvo;(4 exrxr oatoat aivol(0t2xm(mpiy1lp  lfesas)aDrauro;t0oltnmfciadfa elumo;(0aeermrciodoatrlu o;t0srtmxopiy4lle  nvs s a2umxronu0alxoiieiydfs uln onu0altoif3iatfmteln s ()sexmim iodllt  iesat aDtaxr oo4altoifctatfsDeau s;(4 rtomrciy1fpt ln slt)trtmir3iu4apen fvi sfa2umx o;u4oee  f3iat sDrlumo t4areoxociatop e n il() ruoxm3oodam nmfct () Drax o;u1tetoifeiytlm2elu pnu0tlxnmociadfmDeaies;s0t2umio3ou4oltemfvsl(  rur( p;o0oltn f3iadlmDelnvpnt0 lxrxociodfpDeau s s) euoxm3oydolt lfci (f 2umumpno4aeeoio3iydfa ul(vo;t)trxnmr oadomD lies;s srtr(o iydom nmieia(  Dra(r ou1opxnifetad mDeanvsn() exrxocta1lmD an o;(0sruoxo3iydlltn ieias srta(m oo4oexo f3iadls ranmsn(4trxomfciodlpDeluvilt)s2xoim3iy1alen fvs (f 2taurp;o1aet mfciadla ul( s ()tlxomrciodfpt aueils0srxr(o3oudoltnmfvilt)aDrax pot1aleomoeiytla uanvp (4aetomoctodfpt  neo s0 rxmir3no4oltemnet t  2urum nt1oltoiocilsfsDulnmpn(4areoxf iotomD  ueilt teuoir3ou4omtnmivias  2taxm nu0aptnmi3tad m2ul( p u4teenmf tatfptr n o;(0sruriopoodllee netat)arrmu ono0tptnifeilsls elnvo ()arenxf3totla e ivs t s2ur(r3no4amt  nvta(fs2rmxmpot4olxo fciatfsDem( o t4alxnxf todlm rauei;()setmxo oo4olt  nvsas) rrru pnu1apx moeildlmDeaump;u4tleoxf3totom elu o ()trtmirpiudolenmiesat) 2rau o;u0olen iciyd a2ranmpnu)tlxnxrciadoa   uvols setm(o3oudlltnlnvta()srtr(m ;o1alx ioeild m2rmn sn()alxnmr iy1lmDraneo t srto(m3io4lp  lfcsat)srtruront0aeenif3tldfm um(vonu0texnxoctydfateaneo;t0teumimpno4ape mfvi (fsDurxmpnt0oltniieiysla elnmp;()aexomrcoo1fmtelnei;t0sexoirpoudome  neta(f rta(mpnu0aptomociasfm rmnmon(4 exnirctotfp rau sls0 ruo(rpoo1lpe  iviltfaDrr(mp;o1alxo octlsls2umnms;t0 etrxociatfm raueslt srur(opiu4ome  fcilt artmx ooo4opt ioeias m um(vo;(0 ltomo oytom   i ols teum(o no4amtemfesl( artrx o;o0tptn fciadfs emu s u4arxrio3todfpDr u i;t s2um(rpnu1lptnlfei () Draumpot0aexn i3iatfm rlnms u0 lerxo iy1fate ueo ()srtmxopoo4aptnlics t sDrax pou1olx ifetys s2el( on()artniociatla eaueo;s0t2xoxm3oudlmt  fvsltfs2rmurpnu4tpxomoetat sDua( pnu4 reoxr to1fpDeanvsls)s2xrxr3no1llt lfct sf Dta( oot4aee iictatlm ua(vpnt0 lxoxf3oodomDrlies ( setrimpiu4ap nmnctlt)s2umxm nt1tptomoetydfs ra(mp;(0aeerir iydoateluvs;t0s2umirpoudaltnmfeslsfsrrr(mo;o0optoif3iytla2ea(ms (4trenmo3iy1fp   n i;(  rxrxo3ny1optnmicils)a2trxm ou4oet ifctytfm ulu p;u4tlxoxf to1oaDrluei (0 2uo(rpiy4omenmnci tfaDra(mpoo0opxomieildfa2uau s;t)arxomf tadoat  i ol(0s2umim3oudame mieilt  rraxmo;u0aexo fetldlsDra( p u0trtrifciatlpD li s;( srumim iy1ame lies sfa2taxr oo4apxnifeiltfm rmnvp t) ltnmrciydfpD au o;t)s2xoxm oydamt  ieiat) rta(mont4apx  f3tytfs2rmu s t4aexrxrcoydlm rln ols srxrimpoydap n fvtas) rtrumpnu1apxn f3tadfaDrmnms u)aeerxfcoadop eln o s0teuoio no1amenliesl()arururo;o1apx ioctydls2ulump ()altoxrciydoatraueo s)t2xmio3nu1ol emfvsa(f Dua(r nt4aexn ietlsfmDuan s;t0 eeomfciodfatrauvol(0teurxr iy1op emncsas a2trxm ou4aee  f3iyt s umnvs;u4 eeoircoatlpDrln ol()srxo(m oudom nlfvilsf rur(  ou4olt moeias aDemnvs () renmf ootlate ueil(0sruoio3io4al   feilt srraxmp;u1opt ioctyslaDemuvont4tlerxoctydlp rli ol( tetr(m3nydomeemfeilt)a2ua(  ;u1opto ocilsls rluvs;(0 etomo3oadfmt aieslt)srum(opoodome mfeta()s2ua(mo;t1alen iciadlm eauvs t)tlxrxrcty1fmDrlu ol()seumxr nydaptelfvsatf Dra( o;o4opt mietyt s2ul(vo;t)treoxf3tatlmDe i i s0sexmxm3ou4ap  mivias  rrmurpoo0ale mfeiytls2rlnmon(0alxomr3io1om eanvo t0 euo(r3oo1ope  ictat  2urum nt4tlxn ieiat a umuvs u)aexoxf tatopt  u o t)t2umim iodlm nmnes s) Dum( o;o4ope moetydls ran pnu0aleoxo3iytoaDeaneolt  rurim oy1al  lnetat)s2uauro;o1aptnifeild a2ra(vonu)areomfciotfpD  u olt  2umio3iodlmeelieiltf 2trumo;u1aeto icild aDrau sn(4trxomo3io1opDe n i;s texoxrpiydamt mnci t s2ta(  no4oee  feiltla ea(vo;t0 lxrmoctatla e i sl(0seuo(opoodolee fcil(f 2trurp;t4apenmf3tys m eanvon() exoxfcty1oat aiesl(0 rxr(opno4lmtnmieiatfsDuaumoot0tlx ifciltfa em( s t4alxrxfciy1optelieo s  2urio io4ope mfvs t)s2ua(r nt4oeto feiyt aDum(vsnt)aexoircoytlpDeluvsl() 2tmirpoudllte fcs s)srtaur ;t1opxomo3iad m eau sn(4artnxo3oytfmDr nvs;s)srxr(opno1aptnmfcslt s2uaumpno4apenmi3iyd mDrmnms u4texrio3iatom  ai ilt0 rtrir oy1ll n neil(f 2rruro;t1opxo oeiysfs2um( snt4 reoioctatop rln il()s2ur(m3no4ale lfesatfaDuaum no1aexo oeiadfsDumums u0tetnir3iydopte i i s t2trxr3ny1omtnmfcsa( a2tau ono4ole iieiytla uln onu0 renmf3iadlateai o s0tetm(opnudlltelnvi s)sDrmumoou0oltnmf3iadla2emuvp u0 ltrmo ia1lmteaivilt0 rtmxr3nu4lltemfvsl(  ruaum ot1aexnmfctlsfa rauvo u4 exrmr3oytfa raivs;( s2tr(m nu1altnlivs s a2ua(mpnu1aex iociydfmDrm(mo;t4alxrmr iotoa  livs ( sexoxo3iodol emncs s)artm(monu1apeoiiciadfa2ulnmont4 ltomfcoydlmD aivi;(0teumxr3iu1altnmnei tfa2raumpno1tlx mf3iysfm2uanvo;u)aexoiocoatfpteaneil(0 eto(opoy1ol e neil()a2tmxmonu0tpeo o3tad m rlnms u4trtoio oodfmtrai i t0 etrxo iu1apeemncsa( arumuronu4oetn fctys mDea(vont) rtrxrcoytoaD  uvi t)setrxr3oo1apte nctat)srraxrono4tpenmo3iydfs elnvs t) reoio3oy1fmDr i o s)t2to(m3oy4lpenlfeta(fsrrru oot4tptnmo3ildlmDul( s;u4trxomo ty1opD  uei s0s2uoxmpiydomenlieil(fs2urxr ot4tltn ieild s2eln pn(4 lermo todfat au il( t2xoimpiydamtemnct tf ruauroou0oetomicilsls ran snu)arxnmr3oo1fpDrli o;t0teumiopou4amenlivsatfa2ta(m no4alxnio3iltfs2eluvo;u)tlxnxr3oytopDeluei;s)t2uoio io1altnlnvil(faDtmxrpno0altn fcildlmDemnmont4 rxomocto1omtran ols0trxm(rpiodapee nvt s)s2tau onu4aee mf3ias s ean p u4 lxoiociotlpDe ueilt t2xmim3iydlp  lneiat  2umxrooo1apx ifeild mDem( p;(4tlxnifctydla rlieo;s0setmxm3ny1lm nlfvsl(fsrurxmooo1oexoioeiadfs ea( s (4areoiocto1lp eau ils)texoxrpoudlm emfvt (  2rax p;t4tleoioetytfmDranmo;t0altriocta1fa rlieo;t  etoxr3ou4ll emivil(f 2ua(m nt4tleoifctyt m ul(vs t0trxoxr3oatlm eanvi s)sexrir oudlp  licia( aDrax  ou1optoiietyd a2ua(vp;t)arxomo3iytlpte n o;s0t2tr(mpiudlme lfvi t  rrmx  no0oeen fciydfa uln p;t4tlermo3tatoat ln o;t  2toxmpny4lmte fetl( a2uaxmonu4oeen ietlt a2ra(vp t0texoioctodfm  li s;t)t2xrxmpoudlmt  fes ()sDrax p;o0ale  f3iydlsDeanvsn() rermf3oadfpD aivi t0srtr(mpoudopte fvs t s2tau  no1oet  fctyt mDeauvpnu)tltnmr3iodlaDran s t) etrir oo4altn fei ()aDtmx poo4tltnmo3ias m2elumo;t0tltomocoytlatean il(0trto(m ou4op   ieslt aDumx pou1tlt ifciysfmDuau p;(0altrxo oydfm   ivol( texr(m3iu4llt liesltfsrtr(moot0tpt io3iys s2ea(mpnu0aeenifciodlmteauvsls)texoir3iy1lptnlfvsls arrr( o;o4optn fciatla emu p (0aetomf oa1lpD  i s;(  2xmxr oo1ap elnct s aruaxmp;t0alxomi3iysfm2rmnms u0 eerxo iodlp  liei;t s2xmxm3oo4ole mici s)a2rrxrpot0tpto ieiat s ea(vp u4 eeomf ootoaDelieolt0 2xrirpoydopen fet ()s2rmxmo;t1teeoifctys s2rln p;u0 reoio3tatoa e uvi s)t2tr(opno4apen ici (faDta(mpnu0aexnii3ildlsDua( sn()arxoir iytopDranvs;t)trxrxmpoy1omee iciat  2trx oot1olxoifeiys aDua(vs;u0trxoir3iytfmte i i t) rtoxmpoy4op  livta( sDtaumo;o4altoiictydfa ea( o u0alxoxr oo1fp  lnvs;s0trxoio oy4lpt  ivsat)srtr(  ot4tpx if3ildlm2rluvo;()alxnir3ty1fpD aivi;()t2tm(m3nu1am nlivtls s2taxrono1ape ifeiad a rmnmp t) ltnmr oadfatr ivols)teuoio3iy1llenmfvils) Dtauroot0tlen o3iydfsDrl(mpnu0arermrciadlpDeau o s)t2uoxm iy4optnmnvt tfsDur(r ;t0tex iieiatla2rm(vs t0aetnxf3io1fa   uvols0srurxopnu1amtelfvtat)arrm(ro;t4tle  i3iytlm2rmuvon(0teenif oydlaDr ueol(  rum(rpiudoleemiesat aDtaxr ;t0tetoif3tas mDrlums u0teerxo io1lmDrlieils trtrxrpny4lle mfcsls aDrm(mpoo1optnio3iyd a ua(msn(4 rtnio3to1fmDr ieol() eto(opiudlmt  ict ()sDrax p;t1aleoio3tld a uau snt)aetnif3tydoate nes;s0 2toim oo1lle mfvi sfsDuaxrpnu1olxnmfciatlsDeanvo;u)aeerir oydfm  anvi ()seurim ou4am e fcs t)artax  ;u4tltniieiltfm2raumont0tlenmo3iatomD ln s s)sexm(opiy4omtelfvslt aDuaurp;o0apto octysfsDuan p;u0alxoio3totoat  uvs;(  2tm(r3nu4lle miei (fsDrmxm ;o4tetniiciydlsDean p;(0trxrxf3ootfaD  i s;(  2xrimpoudlpeemnvtl( a2trx onu1opxnmieiltfs2ua( onu0altomf oatfatran i;t)srxoxo oo1am n ivilt)a2tr(r ;t4alen ieiasfaDran sn(0trxrxf oy1lmDeaues;t s2uoirpno4lltelneia( arurxmonu1altomfetyslm2elump ()artoxfciotfatraieo;(0teumxmpny4opee neia(fs2rru  nu4tpto icildfa2ranmp u) rxrmr todfmt anvi;s) 2xr(r3ou4lle micsatf Dtm(ro;t1tltniicildlsDrmuvs;u4 renifctadfptr nvo;t)trurir oydol nmnesas sDra(rpnu4oee  ieiys sDuanvp;u4arerxr3iotfa rau o s sruoxm iodoptelnei t)s2tm(  ou4ape ii3iad m2ua( p u) rerxr3tadfaDe uvol( trxr(r ny1amtnmfes s)srurumo;o1aptomoetadfaDemnmp t4 etrmf oadfmDe ueolt)sruoxopiu1ll  mivt s)sDrmuro;t0aexniieildlaDuluvp;()aeeomocty1laDe ivsls0s2toxr3nydap  lietls arumur oo4tlenio3iytfa eln pn(0 ltoxf oytom   i s t0srumir ou4ame livtasfa2umxm ou0olxnmictldfa ranvp;u0texnxf3totlmDr ivolt0srxm(o3iy4ale mietl()aDumumpnu4optnmoctltfs ea(vp;u4arxnir tytfmDeauvs;s  etmim3nu1llenmictltfaDrmxro;u0tet  fctatlm2uan p u4 rxrxo3oatlatraues;t seumimpno1lm   nes ( s2ra(  ;t4tpe if3ilsfaDulnms;t0trxoio iy1la  auvo;s0 2xmim3nu4lmen ivsl(f ruaxr nt0tetoifciydls ranvs;(4texnif3iydfmtranei;t)srur(r3iy4am e nes s) rtaxro;t0optn f3tysfs2emnmo t4 rtrxo3iotfp  luvi;(  rto(opoudap e fvtat)aDur( onu1oetnioeiatlm2ra(vs;t) ltnmfcoo1laD luvols0seumiopiudoltn iei t) Drm(rpno1tleoiicias m rl( s t)tlxnmf3totlm  au i;()srxo(rpiudlleemiviltfarum( pot4olxnioctytfm2ean pn() ltoif3iy1lmt lnvi (0srtr(o3iy1apeemfci t  rumx o;o4tpeoifctls a uanvs u0 rxrir oa1opDe ies;t0trtmimpny4op n fvt tfsrurx o;u1open octldls2em(mo;(4trtnxf oydfa eauvsls0s2um(opnudllee fct () Dtm(r oo1aet  iciatfs2eanvo;t4aexomr3oy1faDr uvi t  rxmxo ou1aptemivsas sDra( pot4opt mi3tltla2rm( snu)alxnxf oatopD livs t t2ur(r oy1ale lneias aDrmur no1aeeniieiys s2uln p t)aexoifctodlmteln sls tetoim3no1apt mnctls  2trx  ot4aleoio3ildla2rln snt)tlermocoo1omt lneo;() rtrxopou4olen nctls) Dumuro;o0aex iietls m uan o;t0trxrxociydfaDr nes;()s2urio oo1lltnlivias) Drrurp;o0tlto i3iyd m2rauvp;u0tetoxoctotfmDe ieolt) rtoxrpoodole mivsa() rum(m nu1tee mo3tlsls2uanvp t0aexrirctodop rln i;t srurxo no4optemfes s  2rauroot1alxnmf3iat mDean p u0aeeoxo ia1lmDelivsl()t2toir iy4lptn fesa()artrx onu0apenmiciys a2el(mp;t4 eerxfcio1om r ueils texoxopoydlpte fetlt sDraurpoo0optoif3iatlmDrmump ()aetnxr totom e nvols) euoxrpnudop   fes (faDtrxm ;t1aetnioeiasfs elums t)tetrifctodlm rai s s0srxmxr3ou4ap elfesl()a2tr( pou1tlt iietyslmDrlump t4altomo oa1faDr iei s)seur(rpio4ome  fcs t srtru pou4apx ioeiydfm ran p;t0treomr ia1fptelu o ()teumxr3iu4ale mfetltfartr(rp;t1olxomoeiyt sDrlnvp ()trtnmf iytfm rlu i (0 2xrxr3no4lptnlfeia()s2rm(m ;o4oetnmi3tatla el( p (0tlerifciodopDr nvo t  2umimpiu4optnlivta(f Dtrx o;u4oltnmieiat sDrmn o u)trxoifctadopDr nvils0t2uo(opio4lltnmfeta(f 2rrur ou1aex  ictadlaDran s;()trtnifcoa1oatranvols0 rxmxmpiy1lpeemicias) Drrxrp;t4tex iictadlsDeauvo (0aleomr oodlmtraiei s) exm(r3ny1ll  lncil(fa2rax o;u0tlen i3ilslm elnmp u4artrir3tytfm rauvs;t0 ruoxm io4omtnlnetlsfarrru ono4tpeo o3ilt sDem(vp u4tlxoxrctatlate u i (0trum(o3nydopeemfvi tf 2rrxm oo4tpx  ictyt aDemu snt4tleoxf todfa  an slt0 exr(rpnodlpt licia()a2rrxm oo1alt  feiyt a ean o u)aexrmo3ootfpDeluei s teuoxopoy4lpeeliei sfa2tax ono1olenmfeiatfs2eau s u4trtrmr3ta1fatrlnei (0 etmxr nu1alte iesat)sDuaxront0tlxnioeiadlm2uan o;(0tlenirciatfmDelieo s trxmirpiydale lfvta(faruax  ot0ole mfciytla2rmuvo (0aleoiociytlpte nes s srtrio iudolt licsl(fa2trumont1oet  fciyt a rauvo;u0 exrif3to1omDe ies;s)t2tmxo oodolt mncilsfaDrrx p;t0olxn o3tldlmDeluvp t) rxrxrctadoa   uvs;t) 2ur(r iodop elicias)aruax pnt1teto ieiysla ua(vsn(4tetoxociadfpDeaieolt0srtoxmpnodoleemivs s s2rm(rp;t1openmo3iadlmDemnvont)trenmrcoy1opDe i slt)srxm(m3oodlptelnetlt sDtmxro;u1tpeo ietyt sDrm(mp;t)tlxnxr3ty1fmDelu i (  rxo(o oodlp elfvilt)s2tr( o;o1tptomfciad a2uluvp;t4aetnmrcoy1lmDelivslt  etoiopoo1lmte fci sfa2tmx  nu4oeeo feils aDemnmpnu4 ltrio3oydla eaivo (0sruo(mpiodoptemfvia(fs2trum ot0aeto f3ilsfaDemnmo;t4 exnxrciodoaD lueo;s)s2umxm nudlleemnetat aDurxront4tpt  feiys mDrln p;t0teerxo oa1fp  livs;t) rtm(m3iy4am nliet ()sDrau o;t0oee mi3iaslm rmuvpn(4arenif3iytfa r ueols texo(r io1opt livsa()aDrr( p;u1altomi3tlt aDulnmsn(0 ltnir tatlp  li s s) eurio ou4omtnmnes t)artru  ot1openif3ildfs2uauvo () rermf3iytfa  aueo;t0trxr(opiodopenlnvtlsf rumum no0olx  i3ilsfmDrmu snt4tlxrmfctytlm r ies s0texoxrpnu4lptnmfeils srraxrp;t1teeoiocildlsDean p t)trerxf3iotom   ivi s0s2xo(r nodlltnlnvsltf Dumumont0oet  f3iytla2rm( p;u0teermo3iodlmt  ueo;()s2ur(o3iu1ale lfcsa( sDrr(ro;o4teen oeilslmDrln p;u4artomr3oodoaDr nvs;(0setm(m3oy4opeemnvia(f rurxront1tetnif3tatla ulu ont4 eenxr tatlpD auesls  etr(m ny1omte fcs (farta(mp;t0oexnioeiasfaDeluvo u)trtnif3tadomDr u s;s0trtoxr iodlltelfvt s)artrxro;t0tpeo i3iadla ea( s u4alenifcta1lpt  nvs;t0s2uoxo3iudal e nctlsfsDua( ont1tleoiieiysfaDrm(mpn(4altoirciodfmDranes s) 2tr(opnu4ame  ivilt)srrr(m ou0openifciasfs2umu snt)tltoioctatlmDe u s ( t2toxopnu4oltemiviatf rumu oot4ape ii3iltfm2rluvpn(0trenxf3iotfmDrln slt  rtoxo3iy4optnmfes ( s2uaumooo0alen octytlsDrm(mpnt4aeerio3iotlaDe ueil(0sexmiopnu1lle  fct sfa2ra(roou1tlt  fetytfs ea( o u4aetnmf3oy1fat aivi ( texr(o3oydapte ictat aDrm(r nu4olto oeiytlsDumn on(4 rxnioctadlat an slt)srumxm3iu4al  lnvt (faDtaxmonu1apx  ietldls2umn on() rtoio3iatlmtraieo (0srxmxrpiodaltn fciat aDrmxr no4oex  oeils s2um(ms ()tetnmf tydlmtrln il(0srxrio3iy4lle  ncils)a2tm(  ;t1apxoii3ias sDeauvo u) lenmrcootomtr ivs;(0srxr(o ou1ameelictls sDtrx  nt4opt  oetysls rlu p (4trermrcoo1laD  nvi s) rumio3no1al nmfei t)srrr(m nu1tee mf3tlt sDuanvs;u) rtrmfctotopD  ieo ( t2uo(r3nydal e nvsas) Dtr(m ;o1tle  f3tldfa rm(vp u0 rxnmo3iy1lp  ai il() 2uo(o3oy1ole  nei s  rrax pou1apeoiociadla ulu ont4tetrxrctytopDeaivil()trtr(rpiy1ap elivilsfa2uaxr ot4tpx iietydfaDuaumsnt0altnxrciotfaDelieilt  rtmio no4lmtelfcta(fs2tmu  ot1oexniietls aDran sn(4 lenif to1op   u s t0srumxopio1lltn ies t)aDrau p;o1opx iiciltlm ea(vo;t0 etoxociatlpt  n s ( s2tmir oy4ame lncils)aDuax pou1tlxnmi3iysfm emuvo;t)trtrmfctotla   ues ( srumim nydal e fct ( srtaumoot1tle moeild sDran onu)arxnif3oo1fmDrlnei;s) 2ur(rpoodope  ivils)a2ta( o;t1oexn fciasls ranmp;t0tltoxociatlat  uei;( t2trxo oo1lp e fvta(  rtru  nt4ape ifcildlm2rmu o u)trerif iodoa e uvi;t)s2tr(m3oo1ol  mncil(  2ra(m ;o0tet  fetasfa rmnmp t)aleomfcoa1fp rlu i;t0tetmim io1optemfctas)arraxm ;o1olt  i3iadfsDeanvp;(4 lxnxrcta1lmte neils trxm(m3no1ape mietls)arrrxmpnu4apt iieiyslsDuan s u4 eenxo oadfmt  ies s  2xoxm iy4ame lictl(fsrur( p;u0tee mociyt m eau onu0 rtnio3ty1lmDrluvi;s  2urxmpiydom emivslt)a2tr(moou1alt  octas a2umnmsnu4tlenmrcta1fa elnvi;s trtm(rpou4om emfvtlsf Dtmumo;o1optoiociatfs2uln onu4 rtrmf totlmD ln sl()teuoxo oodlleelietas sDtmur oo0apt io3tltls rmump u) rtoxocty1fmD  u sl(0trxr(o oudamtnmnes t  rraurpnt4alx  o3iatlm2uauvo (4areomfcoadlmt aieol()t2to(r3nu1amt  fvs (f 2rmu pot1tptoiicildlsDrauvo;u4texomociadopt ln s (0trtr(r3iodomeemivt s)a2ua(mpnt0apenmo3iydfm el(vsn()treriociytfmtrauvi ( s2um(mpiy1amen fciltf 2tm(mp;u1tet mieiysls2elnvpnt) ltomrcta1lpt  nvo;()texo(r no4om n iesat) rtmxront4oleo ociad aDumuvont0 lxomr oodfpt lnvo s0 etr(m3nydlp emfesatfartaur ;t4texomf3ilsla2ul( snu4 lxnmrciy1oa eluvo t)t2umxmpoudll e fetatfs2raxr nu0aet mfcilsla umu s u)tlenmrcoadlpt an ol( srxo(m3ou4amenmfetl(f 2um(roou0oleniieiltlsDemnvp;t) leoxr iatfpte n ilt s2umir iy1lm n feiat sDrm(r oo1tet  ociydfs em(vs;()aeermf totomDrau sl(0teurxrpoydom eliet tfaDtaumooo1tptoii3iadla umnvont)teeniociodom  aieols  rtmir3oodlp nlfcsas  2ta(rpot1teeoifetadfa rlnmo;u)tlenio ootfp  au s;s)t2uoio3iydopte iei t)sDrrxronu1oet  fctasls2ranvs t4tetnifctodop e ivi;t)sexrim iy1lmt  ieslsf Dtr(mont1apt io3iadlsDuanvs u0 exnxf3io1fateluei (0texoim iy4lm  mnei ( sDrm(rp;o4tlx mf3iydlaDrmnvs (4 lenif3iadfa r uvols sruo(rpoydap e iesls)sDurxmont4teen i3iasls2ra(vo;t)alxnir3oytoa eauvi;s0 rxmimpiodoptnmiet tf rurur ou0oetnmo3tytlmDrmnvo ()alxrxo3oodfp  luvi;t0s2xoxm3ou1ll e fes ()sDta( pot0oet mietasfm2ra(ms;(0artnxf oatopDe nes t  rtm(r3iy1op  mfvtl()s2ta(m nt0apxn i3ilslsDea(mont4altoir3oodfmteaneil()seurio iy1ame livia(fs2urxm ;o0alxo ociys a2rmu o;t0tlenircootoa e neo t  rurirpiydlm n net ()arurx pot0tet  ieiltlmDelums;t4 ltomo iadoaD  ivi;(0t2ur(m3iy1omt mfeilt)a2umxmono0olt mfctls a rlu sn()tlenio iodlp   i il(0texoio3nodlmen icil() Dta(ront0tetniiciat a2ran snt4tlenif iatom r i o t  exmxr ny1llenmieiltfsrumum nu4apeomo3tatfm rmn on()aexoxo3iodlm e u o;( t2uo(m oo4ape lnesat) 2umxmo;u1alxnmieiadlaDea( on() etoxf3iy1oa eaieols)trxmio no1al  lneslt aDrm(  ot0oexnmoctld a2rau s t0tetnxf to1lp raies s)truo(r iudopt livtat) ruru pnu1tpxomi3iasfm2uauvpn() lenif iodomD lieslt)t2uoxm ou4lpeemneta() Dumum ;o1olx mfcils m2umnvo;t4aleomrcia1fateliei s0 etoim3io4omee fctlt srumxrpou4aeen fciys s2eanvs (4artnmrciotfm   uvols  etrxo3oy1olt mncs () Drrum nt1tpxoifciasfa2rluvpn()trerio3ty1oa rli o;( teumim ou1lpe  ics ( sDrmx oou0oeeo o3iyt aDumnvp u)tetnxr3iytlmtr ivo t seur(opoy1am emnvils)sDtruroot4apto iciltls rmnmpnu)altrir3iotomD aneo t)srtmxm nudape lnct s sDtr(rono1apxn ietlsfs rl(msnu4areomocootfpt  u i;( trtrirpiu4ol nlfvtasfarurx o;u4alxnifctyd s eauvp u)texnmf3ta1lmtean il(0 2xr(r3oo4lleemfei t)srum(rpot4oexnmfeilslaDumuvsnt) ltomf tatfp  au i s  etm(opoodaptnlnvia()aDrmxm ;o4oex  ocilt a2ul(vsn() ltrmrcootfptrln i s0 2toxr iy4lm n fvsa(f rurxm nt4tle ioctltla rau snt4aeeomo ta1oa elu sl( s2uoir3io4omeemfeilt artmx oot4aee moetadlsDeaumsn(0tlermrciodom   n o t)setrim iudol e fci ( a2rmur ot4altn ietldfa ua( s ()tlerio ia1fmD an i s trxm(m3iy4llt mfvta(fs2tmx oou1tltnifeiys m2rl(ms (4 lxnxr oadopDe n i s  etrxmpoydolt lnvs tfsDurxrpnt0tetomfeiatfsDrmn s ()tlxnif3iytfaD lueo s  rxmxmpny1om   fes (  2tmu pot4apt  o3iytlm2rmump;u4 ltnxoctadfm r n s s s2tmim3nu4lpe livs s srrmxm ou0apto f3iad m umnvp t0 lerir tadfmD livo t0 2umim3oydopeemivsat srtmx onu0oltomoetaslaDemu s;(4aetnif iadoa raivil(0sexrxr iu4ame  fvilt)artrum ;u4ape  ieiydls uaump u) lxoir iytoat luei;s0srto(o3no1ol elivia( aDrmxront0olenifcild a2umnms (0trenxfcty1laDran s;( trxo(m3oydaptnlicsat a2taxr no1apx iocild m ea(vo;t0trtomr ty1oaD  n s s0 exoimpny4ole micil(  2raxrp;u1ape mf3ias s2uaumo t0alxrmf3oydfpD au ilt)tetrxrpiudlltnmncsa( srurxmo;u4aeenio3ilt s2umuvp;u4tlxnxo3oodfaD aues;s  rtmirpou4lp e fei (  rrr( ont0aetnii3tldfmDuanvont)tetnif oydlp   nvo;t texrxr3oo4lp e ivtl()s2umuronu1tee  icilsfa uau p u4treoir oo1optr i i t) rtoxm iu1oltelivtat a2tmurono1opx micild sDul( s;u0areomo ia1la  au ilt0tetmir oy1olte nvtltfs2ra(mo;u4aexomi3tas a2eau o (4tlxoir ta1fp  lnvo;(0srtm(o ou1alt mietlt a2rmxm ou1oexomfcilt sDelu p;()trtnxo3iy1laDelieil(  2xoxo ny1lme  nvi (fsrrm(mpoo0open feildls2emnvp;u)aleoifcoytlmt luvo t) rtrxmpnudlm  lfviltfaDrrxr ot4tpe  oetltfs ua(mp t0altrif iydlaD  u ol( teuoim3no1ap emict t aDrrumonu4tpenmfcilsfs rlnvs (4 lerir oodfpt au o t) euoim3oodapt lnes (fs2umxr ot0opxo oeiad sDumnmp;u0aexoiocoydfp  lieolt) rurirpoodamtemfvi t)aDtau p;t1aexo feilsfm2uluvp;t0 rtnmo3totfpt lueo s0t2um(o io4ameelnei s  2umu pou4ale  oetyd sDrlu p t)alenxfcoadoaDraueo;s teuoimpoy1lltnliesl()aDtmum nu4aexomictls s2ua(vo;t0 exomf3oydfmtrai i ()texo(r oydal   ncslsf rumumo;t0tetn ociatlaDran pn() lermfcta1laDelnei s  rxoir nudal nmfvilt)a2rr(  oo1tpxn ociatfa eanms u4 rxnxo3oytom  ai ols0truoxo3ou1aleemfvs (faDur(rp;t1teeo ociydls2emnmon(0aetomocio1laDean s;s srtmxmpoo4aleelnctat  Dtauro;u0tltomoetadfa2ra(mont) reoiocoa1fa e uvs;(0s2uo(o iu1lltnlies t  2tr(m oo0aleo feiadlmDul( on(4 ltnxr3iatomD li s t0setoxm io4llenmnvsl(farua(rpoo1alt mfctlsfa ulnmont0texrxr iy1laD lies;t) eum(opiydol n fetltfsDtaxr nu4tlt  feiyd s em(vp u4 rtoif3todfatrlu ols0sruoirpiy4ale mfetlt  2trur ot1ope moeias m eauvp (4 reoio oy1lp e ivi t)texrim3iudlpe  nctlt)aDrm( oot0apx  fetlsla um(vp;t0 eermo3tadop rlnvs t0seuoir3nu1lmenmncs s) 2ua(m nu4aet miciadlm ra( p;t)teenxf tatomDrauvs s0t2xmio3nu1lmenmicsltfs2rau  nt1aleomoctat mDeaumon(0tetrmr3iatfmt livil(0 2xmxm3nodoltn ietl()artmxm oo0apx mfetaslaDeaums u4altrio iatfaDraneo;t s2um(o3nu4am emfvs ( aDtrxronu0opeo oetydla uanmo t) lxnirciadfpD aiei t) 2trio3oy1omenlnei tf Dra(rooo1aee io3tatlmDrmn on(0 rxnxo oa1fpDeai o t) exmiopou1openmici s  2rmx p;t0texoifctatfm2rlnmo u4 rerir iytoat aueo;s0trxr(opnodoltn nesat  Duauro;t0opxn i3iydlmDel(vo u0 lermr ta1oa eanei;t s2triopou4om  mfct (  rtmumpoo1tptn f3tlsfm2rmu ont4 etrmo iadfpDr uvi t  2to(o3ou1omen fvtat)arumxmpnu1tpx ifeiasfm rl(vpn(4 renxr3iotlp e uvsl(0trxr(rpno4optemnctlsf rum(ront1aetomo3iyslm2uanmp;u4tlxomr totlaD  u s s0 2xoim3iu1llee feil(fartaum ;t4tex  f3iltfs2umuvp;u)trxnxf3iotlate i i t  rxrimpnodopenmfvtlt arta(rpou4olto o3ild s2rm( p t4teenif ia1oa eanei;t)s2tr(rpiu4omen nci s  Drrurooo0oee  o3iytlmDum(vo;(4altoif3oatfpDeanvolt)sruo(o3iu4amenmivs tfsrurx  no4tpt ifctyt sDuln s t4aexnxo iytfaDrlu i s)tetoxr oo1om eliesls sDum(mpou0tpt iocildfmDemums (4artrxo totop eaueo;t seum(rpnu1ole lnciasf Dua(  ;u1optnmociatfm2ea( o;(0 reomo oadopDrauvs;()t2trim ou4am elfvtatfs2ra( onu0alen octldls2ea( s;u) reoio oytfm   ueo;s0 rur(mpiydll emnei ( artrxr nu4aetn f3ild s2uanvp;t) rtrif3oydfp  lnvils0t2um(o iodlpeemfviatfa2ra( oou4tlxomociytfsDem( s u)tlxrir tadla r nei s)truoxo3nu4lmtnlfvil()artaum nt4aetoiociysfm eaump;u4arxrmociatlptrai s;t)texoxr oo1lmte nes tfa2um(mp;u0opeoiietltfaDeanmo;u0tlerxrctydlpDean o;t sexmxo no4lle mfvias srrru p;o0olxomiciadls2emnmpn(0aexnxf3ty1fmDelueo () eurxr3oo4omeemicta()aDtmumo;t1alt iieiltls2umumpnt)artrxrctydoaDe ies;( teurxm3nodol elnvsl( arumu  oo0opxn fciyt sDelnms;u0aexrio3iatomDe uvi s)trxrio3oo4am   ncs tfs2tmx oou1tlto feiadls ua(vsnt4tltrxf3oa1fm  anvolt) 2tmio oy1al emfci t) rtm( oou4alxniociatfaDem( o u4aexniociy1fmte uvi s0 2umxm oy4omenmfes s) Dtm(r ou1opx mfeiyd s rlu sn(0 lenirciatfm e nvi s)t2umirpnydap nmnvs t)aDua(m nt0aetn f3iad m2umn pnt0texnxr3tytfpt luvi s)srurirpiu4ll nmfctlt  ruaxr ot1tpt mfciyd s2elu p u0teeoircoydlmDr i olt  2ur(m ny4ap n fvs t)sDtaxrpou4tpx mo3ilsfa rl(mp;t)aexomrctotoaDrli o;( t2uoxrpny1lmtnmies ()srtrx oou0aeen ictadfa2ea( ont4 rtnmr ta1la rluvols  rxrir3iu1ll n netlsfarrrx onu4tpe ii3tys sDuluvsnu4 lxoxf ta1oa  aues s  2xmxo oo1ll   icsa()arumxm ou1ape moctytfaDuaumo;u0alxnmo tadom ranvs t0t2xrxm oy4opte nct sf rtrx pnu1optnmfeiasls2eau pn() rtoxfcoadfa  lueils  2uoxo io4ll   fvi s srtaxm ou4oex if3iasfm rmnvs;u4 rtoxr oy1fpt  uvs t0sexr(opoy4lp  lfvtls sDtmump;u4olxnmf3iytla rl(mo;t4aetrxf3oydlmt an o t0 2uriopnudap  mnvs (fsDtrxrono1tetn octatfa2em( pnt4tlermr tydomDeluesl(  rtr(r no4lmee fvslt  2rrxrp;u1oex  feiasfa2rmnmo;u4aleoio oydomD li ils  2to(rpoudlp e nvsls)arururpnu0aet mfciltfs2el(vp u) eeoir iydfmt aivi;t s2xrio ny4altelfes (f 2ra( p;t4apxnifctltfs2umn o;t4aexnxf oo1omt ln i s srxmim3iydlpeelicias  rtaxrpou4optoifeilt a2rluvp;(4trtrxrcootlpD  nvs;(0 exoxrpnydll n nes sfaDtr(ronu4apt  i3iltls2ran snu0 rxomf3ia1lp elivo;t0trxoxm3iy4lm nmfcsa()srta(r ou4aptn i3ildlsDem(vpn()arxoxociodfpDr ieilt trurim ny4ol elicta( a2tr(  no1ole if3iltlmDrm( s t4 lxrmfciotomt livil(0 rurio no1lmee netat a2rrxmono4texomoetydfa2rauvpnu4 rtoif ty1oa elnvi ()t2xrimpno1omt liesat)a2uau o;t0tpto oetadls uaums t0 etrxfctadoaDrluei;s0srum(r nu4apt mfvi s)srurx ont0olt  oeilt a rlu o (4 eenxrcoo1faDran sl() 2umimpoudal nlivtl() 2raxmp;t0oetnmicilt s2umu o (4teeoxo3oatfm  an s s) 2urxr3ou4lleemietatfs2raur no1olenio3ias a2umn s t4tlenxf iotlmtrli i;()seumio3oo1lp emict tf 2tr(r no1oetnmi3tltlsDuluvpnt0 exnmocty1laDeli sls)srtm(m3ou1ape mivias a2ur(r no0tle moctltfs2el(mpnu4treomo oy1fp e ueo t0trxm(rpno4lm  lietls aDta( oou1altoioeiasls2rlnvs;t)aexnxf ia1fpD lnes;t) rtrxm3oy1op e ici (fsDtr(m ;o0aptnioeiyslmDelumpn(0 rtnxr oydla  au ols0 2tm(o3iy4am elnvil()s2urx p;t1tlxn o3tyslm2rauvsnu) lxoxo3tydfp   ivs () exr(m3ny1ol e fetlt) 2ta(mp;u0tet if3iadfm eauvs (0teermf3ta1op elnvo;s0sexrir3nudlpt lfei ( sDraxr oo1tetn fciytfm umnvpnu)aeermr3tatom   ueilt0 2uo(m oy1am  mfvs tfsDtmu oot0oexo i3tasfa2rluvont0 exnmrcoa1fm r nvo;s0t2xoim oudlpenlnesasf 2ur( ono4oltnioetasfs eauvs t4 lenxo3iadfpDrau ols  rumir3no4om elivtlsf rtm(mp;o4alt  ieiyslmDumn s;(4 rtrxo3iatfp eli i;t)teuo(m3iu1op emiei s  2uax ono0opxn oeiys sDrau ont4 rxomf3iatfateln o;t)trxoir3ny4ame  fvi ( s2rmumpno0ope  fcilt m em(msn(4alerio3iy1fm  luvil()sexr(m3nudolee nvta(f 2tmx o;o0oleomo3ildfsDumu on()aleomrciydomt  nvi;t0 rxm(opno4ame  fvta(fsrurum ;u0texomfctldfm umnmo t) rxnxr to1fm r nvs t s2uoir3oy4alte fctas)sDuaurono4tex if3iys mDelu p;u4trxniocootopt au ol()s2xoir3oy4olenlnci (f Dumu poo4tlx  oetytlm2ul(ms u0aleoxr3iotlpt  u sls s2urxo3ou1ll  mfctasf 2um(rpot4oex mi3ildlaDrlnvont)tltomr iotfm rlnvo t srtoirpiy1optelnvs (f Dur( o;u0texomf3tld m2umuvpn(4aexnmf3oatfpDeanvils srxrxo ny4aptnmivtl(f Dtax pou1oee micild mDumnms u4 rxrxf tytoptr ivo s trtoxr ny1op elncs s s2rmum no4texo ictasfs2umuvs;u)altoir3oodfaDe ieo s)s2uoiopny1oleemfcs t)a2rau ont4oex ii3iyslm2rmuvs;t) rtomf ia1fmt  nvols teuo(rpiodlleelfct (faDuauro;t1aet mi3tld s2umuvpnu0teeoxrcoytfpt aivolt  etmimpnu1alee ncil(fsDrr(ront1ape mf3ilt s2rmnmpn() lxrxr3oodlp rlnvo;s trum(r nodlltelfcia(faDuax o;u0aeeo oeiatlsDrlums;(0 rxrmf3tadfa rau s (0trurxm iydlmtemfciasf rrm( ooo1tlen i3iltfmDel( p;t0 lxoif3totoatr n o;()tetr(o3no1lp n feiasfarrmu pnt1oeeniieilslaDua(mo u4 lxomf3totfptrln o (  2to(o oy1om emics t)s2uaxmp;t4tex mi3ildlaDrlnvo;t) rxrmr3to1optraivi;(0sexrirpio1apenlieta()artrxrpoo4tpxoiieils mDem(vo;u) etriociydfateaivo;t)t2uoir oodap n fctl()s2tm(rpnt4ape  fctls sDeau o;u4 eermfciatomtelieo;()sexrxm oy4opee ncsa(fa2um(rp;u4opeomi3iysfsDra( pnt0 rxrxf3todfp rlu s;s0t2urxrpoodol nlfvsas  Dumumo;t1oexnmoeiysla2eanvo u0trt
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t) exr(o3nu1alte nes t)srrmx  nu1tpxomo3ilt m umnvo;()arxrxociatomD  u s;t  rtr(m oo1ole  fetltf Drr( p;t4tleo oetatlm2rlnmsnu4tlxnxrcio1op  luvolt0 2umirpnu1al  miet tf 2ur(rooo1tlx  o3iyt a2eanvs;u4tltrif iytomtr n s;(0trxoimpiy4omtemnvsat  rrr(mp;o0aleniiciyd m ul(ms;(4teeoxr3tadlpD  nvo;()t2trxopnodape  ncslt s2raxrp;u0alx iieiatlm2rm(vonu) etoio3oytoaDrli olt  2ur(mpoy4op  lfvt tfsruaumo;u0oetnii3ias m um( o;t4 exomoctytopD ai olt0srtmim3no1lltnmfvt ( a2tmurpou4apenii3iltfaDrmnmo u4trxrxrctytop   n o t0 exoxo3io1llenmivsa() rra(r oo0ope if3iad a emnvp u0tlxoirciatfmD  ieols0 etmim oy1lm elivs () rumxmpou1olen feiyd aDulu o (4aeeomr to1omt  i o t0trxm(o ny4amtnmivilt)a2umx  ou0texnifcilsfaDum(vsnt4aeenxrcto1fatranvi;( trur(r3oodoptelfvsa(fs2rr(rono1texomfetltfaDrm( sn(4 reoxf3ia1laD lu o;s0trxm(r3ny1ap nlfctltf 2rau p;u0aee miciatfa2rm( s;u4artoxo3ootlmteau olt  euoxo nodop emnei sf Dtru  ou1olxo iciad m2eanmo u0tltoiocoydfpD auvs;()srxoim iy1oltelfctl() rtmu pnu0oet ifciltfm2rlnmsnt4arxoif oatomDrlu o;()seuoio3no1opee netlt)aDum(mo;t1alen fctldlmDrlnvo;t)trtnmr iadop r i s;t s2trio3iudlpen fctls) Drmumpoo0oee mo3ilt a2ea(vs;t)arxnxf tytfat  nvi;s)texm(r3io4ll nmnci t srtr(  ;o0texnioeiasla emn s;u0teermrcoy1op rlu s t t2uoxr iu1opeelfcsls s2tr(mpnt0aet mictydlsDranms;t4altnif to1la r n ils setoiopno1ame  neilsfsrumxmoou1tpenmf3tltlaDrau sn(4tlxomf3oodlaDe ieolt0t2xrirpnu4am nlneta(fa2rrum nu1oltomo3iydfa2rluvp t4 eeomr oadfp rlnes;t0trtmxr ou1ll  lfetas s2um(ront1opeomietytfm uln pnu) exoio3iy1fm  ln slt srxrio iydlp elfvilt s2ta(rpoo4tlt  ictlsfsDumu s;t0aetoio iytfmtr uesl()srxm(opio1amt mfvi ( srraxronu1alxomieiydlsDrln o u0 eeoir oa1fm  livo;t t2xo(r iodamenlics () rtm(rooo1ape mociasfsDrl(vp u4tetoir3tatfate uvsl(  eur(o oo4omtelnctat)aDumur oo4olxnmoeiat m2emums u0trxomo3iytlptr nvo (  2urim3oo1alee neslt  2rrxr nu4apt iieiasla2umn pnu0trxoxo iydla e iei;()sruo(r3ny1oltnmnctlt)arraum nu0tlxoifcilt s uaums;u4tltomr3tatfpteluvs;s)sexoxm ou4lm n iet sf 2urxm ;u0apxnmoetytfm eaumon() leoxocoydoaDeln ol(0seurxo3ny1alt mivsa()aDrrx  oo0tlto f3ilt mDuauvpnt) lenxo iytomt  uei;s0sexm(m3no1lpenlfeslt)aDum(ro;t4opx ifetldfaDul(vpnu)tlermfcio1omteai slt)trxo(opiudoptemfcilt  Drax  nu4aptnmf3tys s raums;u)trenxocoodfmtr u s t0trxmxm ou1amtnmncs t)s2ua(moot4teenmfciyt aDeaumpnu0tetnxr3tytom   i ilt0 exmim iu1opt lfcslt) 2tmxr ot4tpt ii3iadfmDeluvs t)treoxo3oatlaD  u o;s0trum(o3ny1om elicia(f Drm(root4tpxo octasfa2ran p;() lxrxo tatfptr uvo;() 2uoim iy1ale lnvt s sDrmurp;u1aetn f3iasfsDuan p;u0arenxf oy1opDe ueo (0 2umim iy4lptnlnvtlt) Draxmpnt1ope mi3tasfsDranms;(0tetrxfciadlatelneo s) 2ur(r ou4am nmies s)arurxmooo4aexo fetys aDemn s;(0 eenxr3to1fmteliei;s s2umxo3iy1am  lfvtlt sDrmur ou0aeen fctadfsDrlnmo;(4altoio3totlm   ueo;s)t2uo(mpoo1oltemfvtlsf 2raumpou4tlxnmiciltfaDrmuvo u4arenmociatla r nvo;s0texoxr oudal   fesas artrx  ;t0apx iieiyd m rl(mpnt) lxoxr3iotfmtr n s;()texmir nydol nlfvias s2ur(m oo1openifetldla uauvo;t0tlxoxf3to1fa ranvs ( teto(o3io4lp emnci () rtaumpnu1aptnmfeils aDrlnmo u0 rtnxrcia1opDraueo;t setriopiu1ll emnvil(fa2ururpnt0tlxniieiadfa emnmsn(0 eermo io1fa  lnei;t setm(m3no1lmtemivs s  Durxrpou1tltnmieiys m ran sn(0 rtnmr iodlat an i;(0t2tmxm3ny1al   ictltfsDrr(  ;t0teenifctat sDrlnvsn()arxomo oodfateaivslt  exrxm no4lmtnmfes ( s2rrxm ;t4aeto fciat sDemn p;t0texnmf todfp e i s s) ruoxm nu4op n ics tfaDrm(  ou4tptn iciyt m2ua(vp;t4trerio3iadlmtraueol(  2to(o oo4al  mivi t)s2ua(m nu1tex  feiadfmDrmnmp;t)teenmf3oodfm ranei;t  rxo(r3iodamenlnvsat  Dtmump;u1opto ieiyt mDuau ont0trxoxoctodla  aies;()t2tmir no1lpe  fesa()arurump;u0oexnmicils s2umnvon()tlermocoodom   ues s)teumim3iu1al emicsl(faDta( pnt0aexomieiad m2el( pnu)tlxnmf3ootlp eaneslt0 exm(o iu1apee ies t a2taxr ;o1aleo f3ildfs um( s;() lenmfcoydomD aivo;s) eumxopoy4lm nlfct tfa2um(rp;o0tpxnmoctyslsDrmumpnu4aetnxr oadla r nvi;()teurxmpny4lp nlfeils) 2tmumpoo4oeto i3iydfsDeanvsnu4teerio3oadoa  anvi ( tetoim3iydlm  mnes (f Drmurp;o0oltnif3iys m rmuvo;t0tlenio ty1omtrlivo;t)trxoir nudopt lncta( s2rrxm ;t0tpxn fctysls eanvo;(4altrxfciydopDraueol() rur(o oydop n ivt sfsDurxro;u0aleoio3tldlmDuan o;u)tetrif3oo1late n ols0trxoxrpno4amtemncsas) rtmuroou1apen ieiydlsDuanmonu)arerxfcoytfpt  ueo;t0setrxm oodopenlicias) 2taxr nt0oleomi3iyslaDrlnmp;t4 rxoio to1fp e ueols0srurxm3ou4om  miesls)sDtru  oo4tpeo ieilslaDel( o;t)tltrxf3io1faD lneo s t2xrio ou1ope lneilt aDrru ooo4ape io3iad a rln snu)trxoxocio1lpD ai s t)seuoiopiodlleemiesl( aDtrurooo1aeenmo3iatfm ea(msnu0altoircia1omDe n s;t s2umim3ny4lmen fcta( srumu pno1oeenmictlsla2uanmo;t)tlenmo tatfpt  iei (0t2triopou4omte ncsls arumur no1olxo i3tasfmDulnmp u0 etrxfciadfat lneo;t)texmxo iodlm e nct ( aDrmxm nu1tpxomfeilsfaDuau onu)alenmr3oatla  aneo;t seuriopiy4lm e feilt) rtr(mo;t0aeto oeildlmDelumo;()tetnmo3ootfpDe u s s srtm(opoo1ome licsatfa2rm(rp;t1aexnmietldlsDrm(mp;u4aetomr3to1fa   i ol(0 rxm(m3nu4al n fcsatf 2ur( o;o1apenmf3iat a2rlnvs;(4trerxr oa1lpD aies ( tetoxr3iodomenmnesa( srrau  no0aeeoii3tls a2eluvonu) ltrxo oy1omDeluvils) 2xo(r3iodaptn nvil( srrm(rpnu1oeto ieildls2um(vonu4 lxnxo iy1la  li s ()t2tmim ny4lptemfcia()srua(mpou4opto oeild a ulnvs;t4 rtnxrcoydfmtrln s;(  2to(m3oo1amtemivsat) 2urumono1aex moctatfm2rm(ms;(0arxrxrctadfpD ai o;s s2um(m3nodll  miei ()sDuru o;t4ape  fctls a2ulu o t0 rxniociodfmtr uvslt trurxm3iudopeemicslt sDua(mo;o0ape  i3iys s2rl(vs u4artnxf oytlat anes;t) eurirpny4omeelncsls a2tru  nt4aetoii3iaslmDuln p t0tltrxrciy1oaDe neo (0 rxo(r3oo1apeelivtl( srrmur nu1oetomiciyt s ulnmpnu0tetrmf3tydoaDr iei;(0 eto(o io4al  mncias  Dtmumpno0tptoiociatlmDuluvo;() reoir3totlp eanvo s)trxm(o3oudllenlfetls  2tr(ro;u0oleo icilsfsDua( sn(4 ltnxr3ia1latr uvo ()sexmxopiudlm e fetltfaDurxmono0tlen f3ildfm2emu p u0trtnircoo1lp ranvslt) exmim3io4al   nct (fa2uru pnt4ale mietld s elnvs u4aetoxr ta1fm  lnvs;s)s2xoxr3oudamt  nciatf rrrumoot1tltomo3tydfs2elu pnu)trtnxo iodomD li sls)s2toimpnu1lp nlfvta( s2taum ot1tpt moctldfm2ulnvp;(4alxrmo ia1fpD lnvil( s2uoiopnodllenlfci sfsDtaxmpno4apeo i3tadfm2ul(mp u0treoircty1oateluvi s)seuoxm oy1lle liesltfaDum( poo1opx iicilt s2elu p (4aeeoxfctotfa ean i ()seum(opiy4amee icsas  2taum no1oeeoiiciyd s2ul( p u0teenxf oytoatrlu olt) rxm(o oo1amenlivs sf 2uaxm ou4apenmfciysfm2em(ms u4 rxnircio1fatrauvo;(0s2xrxmpiydalenmnvtls)s2ta(m ot1alx mietltlsDeauvs;(0 lenmr3iodfp r u olt0 rtm(mpoo4amt mivs t)aDraxr nu1aeenmo3iadlm emn p;t0altrmrciatlp e uvi;s0srtrir ny4lp n nvtl(  rrm(  ot4aeenmf3tasfm2umnvon(0alerif3oa1lmDr ies;s0 2umxo iu1lpt mfci t)aDtmu ono4aexo oetys a ea(monu) etrmf iatlateln i t0teumxr oy4olee nvs sfa2rr(m ou1tltnmi3iatfm uauvsnu0aexrmrcoy1lpte u sl(0srxoirpoo4ope mfvslt  Dra(rono0aeeoioeiadfs ulnvsnu) lxnxo3iatfpD lneolt) euo(o3nudlme livs sfa2rmurpnu4opeoiiciydlaDrmnvs u4texrxf3oydfat auei;s s2xo(rpiu1amtnlici t srrr(ronu1tet iieiltfm2ulnmp u4alxnxr ootlpD ai sls0 exo(opio4llenlfesas)artaxm ;u1open ieiadlm rlnms u0aeeoxr tatopDeauvols0 2xmxm3oo1ll e fet t s2rrxro;o4ope iietad a ranvonu0teenmf oo1fm   i s (0trumir oo4om   fvi s) Dumxrpou4opto feiyd m em(vo t0 etrio oa1oa   uvolt0t2tmiopiudlm emnctls srum(r nt1tpx  o3ild sDrl(mo;()teenmr oatfpDrlivols  exoxm iy4llee nvslt  rrr(moou0optoii3iltlm rm(vpnu0trenirciodomtrai s;(  rtr(o3oudop emnci ()a2tr(mpno1tet  ociytls ulnmo u4trxoxr oatomt luvolt)trurim3nodol emfcsat  Dtmx p;t1olxnif3iadlaDulump;u)tlxoxocootfaD lueo;s  eurir3oudolen feilsf rrau  ;o0tptn ociytla emu s;() eenmf3ta1lpDr uvslt0 euo(o iu4amenlfei s)sDuaxm nt0altoioetad s ea(mon(4tetrxr3oa1lp eai s;t)seumimpou1ape lfvia(fa2rrxrpnt1tle if3tlsfm rl(mo (0aleoxf3oo1lmDr n i s  2xrir3io1al  lnet t  2urx  oo4tptnioetadfm el(vo;t0alxrirciotopD anvsl(0 exoxrpiu1lp n fctl() rtrum ;o0oexnio3ilsfsDel(mpn(0texrxr3oodfmDeln ols  2ur(r no4lme  ieilsfaDrmu  nt1tetnmfciytls2eanvpnu)aetnxo io1fp elueo;t) eurxr3iy1omt  fetltfaDtau  nt0oleoiieiadla2eanmp;()trxrxf3iy1faDe i o;t0 etrxm oudam n nvsa(f Dumumpnu4ope  oeias sDra(vs (4alenmr to1fpDr ieilt t2uo(r nodale  ics ()sDta( p;u0apenmfeiydfsDuauvonu)tlerio oy1omte ieo s  rtmxopoo1apenlict tf rrr(rono1opeomfeiyd s2um(vonu0aexnio iodoaDranvi s  rurxopio4ole  fei (fs2tr(rpnu4aeeoioetas mDemuvsn() exomfcoydlaDeaivi;s)t2toimpoodlmt mici (fs2tm( o;t4teeniiciasfs2umnvo;t0artrmr3oa1lat lieo s0 rxm(o3oydomenlict ( srumur nt1ole ifetltlm ulnms (4tleoxrcta1fmDr nesls)trumxr io1opee fesltfs2rax  ot4opxoioetasla ulu on(0 rtrmf iatlm rlu olt s2xo(o3iy4oleemieiatfaDtm(mpno4tetnmfciyd m elums;t)aetomrcootlpt anei;(  etm(opny1ll nmnvs s  2ua( p;u1oetoiociatlsDuau ont)altomo to1fpDeaueo (0trtmxm3iy4omtnmfviatfsruau p;o4oet mfctytla2em( p t)tltrmf3iatopDrai s (0 etoim3oy1openmncilsfarrrxr oo4tpx  iciydls2em(vpnu0aexoio3oa1lpD lnei () exmim3oy4ale mieiatfsDumur ot4tptn ietas a2ra( s u)trxniocoa1lpte ivol()srumxopiy4ome  ict ()aruaur ;u4tpe mi3iyd a ul(vonu0 rermf iodfmtelu ils)s2urxmpoo1ape  fvt ( a2rrumo;o1tlx mietadfs2rauvs t)aexrif iadlatelueo t0s2toxo ou4aptnlfet ( a2trxront0olt micildla em(mpnt) renmrciodoptrlivi;s)t2tm(m io1ope  fes t)s2ua( o;u0opto ocildfsDuanms;u) exoxr oa1oa r ieo t)tetr(o nydom  mfvt () 2urur nt0tlt ifeiydlsDeluvp ()aetoxrciy1fmDr u o s seuo(o nydal elfcs s  rrm( ooo4optn ietytla2elnmsnt4artrmociodfa r ivs t)trxr(o3oo1op n ivsat a2um(mo;o0apxo octltls rau p t4tlerir io1lp   i s;s srxmxo3iu4lmte ietas)srum(moot0oeen iciasfm2rm( o;(4tlermo3to1opt  uei t0trtrio nudol nlfctlt)srrm( pnu4tpenmfctyt s ra( p;(0artnxf3tytlaDelu i;s sruoim3iy1op emncilt)sDua(rpot4olxo fciltfaDulump (4texrmociy1fp  lnei ()texoio oo1alt  fet t) 2ra(m nt4oltniiciytlsDua(vpnt4aleriocty1fmtrauvolt0t2urxm ny4lp   nei ( s2trx  nu1olenmf3iytfmDemn o;u0trenmo3iotlmDelneilt) eurxo3iydalen ietas aDtmuront0oee  i3iysfm2um(mon() exnmfciytop r iesls)t2trxr nu4lpe  ieia()srua( oot1aee ii3tadfaDea( pn(0trtnirctodfm   ueil()trxrim3oy1ope lfvt t)srumx  nt0oeenio3ilt m ua( pnu0tlerif todla eau i ( s2xrxrpiydllen feils  2uru pnt1apenioeiytla2uanms t)arxrifcoo1fpteai ils)s2urxr3oudllenlietl( sDtmumoot4alx mo3iys s eln p;(4arxnxr ta1fpD  nvil(0teuo(rpnudale  fvs s sruax o;t1olto f3iatls2em(mo;u4artomrcoatla   n s s0tetoirpiu1alte ivia( s2tmu  nu4aeeniicilslmDemumo u)texomrcoo1oa elivo;( s2ur(m3iu4llt  icilt aDrm(rp;t4olx ifetld s raumsnt0teerxfctatom elnvi;s) rxo(opnydlm n fcslt s2rmxm no0tetn oeils a um(vpn(4 rtrio ia1fm e ueilt trtmxo oo4omtemfes sfs2urxrp;o0oee  ocildlmDeaump;t4alxoxr iatfmteai s s)srtmim3no1olen ncslt srur(  oo4aex io3iys mDra( o t0 exrircto1opDeaiei t trtm(o3io4openlivsls)arrm( pno1oeenmf3ilsfm2uaumo u4trenxf oatfmDr uei s tetr(o3nydlltn fes s)arrrxrpnt0oexomo3tlt s rlu ont0aetrmr iy1om r uei t  exr(mpnodlm nlivtat) rra( pou4apx micilt a2umnvp;t0altoxo3tatlpte nes;( teurxrpnu4lmen ncilt)sDtaumont0tlxniietas m2rlumo (4 rxrmo oydop r uvo;s0trxoio oy1al emfvt tf Dtm(r nu4apenif3tatls ul(vsnu4alerxf ty1laDr n i t0s2xr(o3oo4am nmfvtl()sDrauro;t1ope mfciys mDrmn o t4 lxoxr oatlp e i il()s2xmir ou1al  mfes t  2rmu o;o4teto fctydla rm( ont0 ltrmr oatlm  aivsl(0s2to(m iy1optemiesltf 2ua( pot4oeeo ieiadla ea( ont) etrmf iatfmDrlies;s0 2xmimpiodopee nvs t aDrmxrp;u1oex  icilt aDean pnt4 ltrxo oatfp rlnei (  eumxo io4op   ivt t arrmum ;u0opt  i3ils aDra(vpn(0texnxrciotlptrlivo;s)trum(r nu4omtn fctatfsDraxm oo1tpt  icilslmDra(monu0arxrmo3todoa r ivs s0srtm(m ny1altn feta(faDrmxm ;u1tlx  fciat a rlu p;t4texrio3iytoa r ivilt s2tmim iydal  mncil(f 2taxrooo4aleo feilt sDrm(vp (4 eenio3tatfp rli i;s s2tmio3iodapeemnetat sDrrxr no1oet mfetldfa2um( p;u0areoxrctatoatrlneo;s0 rtr(m3nu4optelnvtlt artaxmpnt1apt  ieiatfsDum(vo;u) ltoifctytom  liei;(0 eumiopoodam elfvt (fsrrru pot1tleo feilsla2uln on(0tlerir to1fm ean o s) 2tm(m3ny1ol nmfci t aDtaur ot0tetomo3iydlsDrlumpnt4artomr3iatfm rluvi t trtm(opiu1ap n nvt (fartruro;u0tlx ii3tadls2ua(ms t0texrirctadoaDe i sl(0 2xoxm nudllt  icslsfsrrrxmpnt4texomf3tadls emnvp;t4artrio3totlaD  nvs;t srtmio3ou1amenlfet t  Dtru o;t4oleniiciasfs2ra( p u4 etnxf totfm eau il(  rtoxo3iodol  lnesasf rtaxmoot4openif3ilsfsDrlnvp;(0trxnif3totoaD  nei;t) etrxmpoudlm n ieta()a2taump;t1aex io3iytfmDeaumo;(0 leoxo3io1oa  lneo s0tetm(o iu4llenmnvslt)arurur nt0tetnioetad aDrluvs;(0texrmf3oo1laDr ivsl(0 euoxo3iy4amt  fcilt) 2raxmp;u0aeeoifeiydfm uanmon()aexnxo oatomDr ivs;t  exrxr nydaltemfct s sDtrur nu0tpx  fetlt sDemnmp t4 eenioctatlmt lu i;(0trurxm3oudoltnlfvia(fsrtrx onu1oeenif3iltla rau p u0 rtomfciatfm elu i;s s2urxmpnydameelivsa(  rraxmo;o1oetoioetatfs ulnvs (0tlxrxr3iatom e nes t)s2trxrpou4omt lictltf rrr( o;o0tpenmfeiadla2rmuvsn(0teerirctotfpteanei s0 ruoxm3oudom e nvtasfartr(ro;o1apeoio3tatlmDelnvp u)teermf3iodoptrai s ()texoiopnu4olt  ncilsf rta(mpno0apxn f3iadfa ra( on()tltnmr oodlp raieslt)trumirpio1lltn fvtat arrmxmo;t4apx mieiltfsDranmo u4arermr iy1opteluvi;()sruoio nu1lle  ies (  Duaxmpou0tptoiocilt a ua(msn(0arenxr3oadoat lies;s s2uoim3nudome  nvs sf 2tm(mp;o4ole  fctydlmDem(mp;t)arxnxf oa1faDr ieo;t0texoxm3iudole mnvtl() rrmxmono1texoiietldfm2umump t) exnmf tydopteluvilt trurxopnodom   ivtltfs2tau  ou4alt if3iysfa2umuvon()artrxfcoydfmtraieil()tetm(o oo1lpt lnet t) Dtmxro;o0oleomo3tydfm2ean sn(4aexnio oydoate ieslt s2xrio oo1lle lfctat aDur( poo1tle ifciytfs um(mont4aexrmociydomt  nvol( truoirpio4lle  nctl()s2ua(r ou1texnioeiad m rluvo;u4tlerxfcootom  lu olt0 etr(mpoudam nmiciatf 2rax pnu4aex mietyslm rmn p (4 exnxr3oadop eaivo;t tetrio3oydapenlfvta( aDrmxr ot0tlxoio3tydlm2emumo u0 rxnifciotomD lieol(0 etrir3oydopee ncsls)a2umurooo4oleo oeiys a2emnmp t4texnir3iadoa  livolt) rxoir3ny1omtemivs t arua(rp;u1alen i3iys m rmu o;t0 reomociytlateanvs;()s2toim3ou4lp  liviat)arraum ;t0apenif3ilt a2emn s;u) eeoio3oydfpDelnvo;s srtmir3nu4apte fvsa()aDtmxm ot1apeo fciad m2ulumo (4 lerxrcoatfpDraivslt0texrxm iy1lptnmfetlsfarum(mo;u0tlx mo3ias a elnvp t4artomo oadfmDrlieo t0t2tr(rpiu4ale  nct sfsruru  no4tpxo feilsls2ra(mo t0altrif todoat anes;s0texrxmpou4op  mneslsfsrtmxmp;o1tpenmfeils aDrl(vsn(0aleoir to1fateliesls)setmir3oy4lmtnlfesa( sDtr(r oo0tex  ietas mDel(vp;u)trtoirciatlptrlnei;( s2tr(r ou1ll n iet s)artrumoot4aet  i3ias s ea(vs (0 exrmfcoatfaDeluvols)srxo(r oo4al nlnet (f 2raxm ;o0alt ifciltlmDrl(mp t0 rtrmr io1faD aivo t0t2xm(opoy1lmeelictl(fsrumxm nu0teeo f3iltls2eauvs;(4altomo3iatlpteau ilt teuoim oo4aptelnes t)sDurum ;u0olt io3tysfs2ua(vp u0arxnio3ootoa   n ol( tetoxo nodolenlivt ( s2um(  oo0oeeo ictatfmDem(ms;t4 lxrmo3io1fm rln s;(0 etm(opio1apte ncilt  2tm(rp;u0tlxn o3iasfs2um(vpnu0teeoiociodopt luesl(  eurio no4opte nci ( aDuaurpnu0aptniiciyt aDul( p t)tltomocoytoa raneils)t2toxm3no1lp   icta(farrrxmpoo4alto fctad m rlumo t4 lenircio1fpDrai s;()truoim nu1ap  lietas arumu o;t1tee mo3iydlm rln pnt4trenmrcia1lp rli ilt trurxmpiy4al  mfetls)s2uau  ;t4apxnmi3ilsfm2ul(msn() lxrxr3oa1lmDr uvsl(0s2xr(opiudameemivtlt  ruaxrp;o1opx  feiyt mDuan o ()aexnif3oy1fpDrln slt) etmirpno1lp e nvil() 2trxr nu0aet ifciat m2ra(vont4trtoifcoadlmte i s;()srum(opny1alt lncsa(fsDum(  oo0tpeniicilslsDrmuvs u0arerxrcoytop  livo;( sexm(r3oo1lpenlnetlt)aDtmurpoo1oex mieiasfm rl(vo u0aetrirciatopDrln s t)trtrxm3nu1omtelictls aDrmur ot0optomictyd m2elu pnu0 reoircoatlm rlneil( texoir3ny4omtn ivsltfartaxmono4aet  oeildfaDrmu on()alxnir3ootlat an s s teum(opnodalt lneilt) rum(mpnt1apx iietas a ulu pnu0teeomr iotfmt  u s;()s2xmimpou4ll  mnetls)sDra(mpou4ale mf3iyslm2emn pn(0teenxo oo1fmt aneo t0truo(m nydlmt mnctat srrrumoot1tlxoif3iad m2uau s u4teenxf3iodfp rlivsls  2xoxmpnodll emicia( a2um(mpoo0oexoio3tysfsDean o;()arxomo to1fpD aivo t  rxo(r3oo4lltn fvslt aDtmx pou1tpxomfcildlaDean p;u)alxnmo iotlpteaivs t)s2tmxopoydlm n fvs s)a2rm(rp;t1tlx  i3iltfs rlnvpn(0altrio3todlmDelu ol( sexr(o3nydom e nesl(faDraump;o1altn feilsls2eau p (4aeeoxr totlaDrluvo s0 rxoxopnudlmt mfctas)s2umumooo0apeomieiadfmDum(mp (0trxnmfcoadoaDelnvslt) 2tm(r3iu4lme  feilt srtr( pno0texomocilt m ra( s;(4aetnirctotom ranesls  ruoimpoo1am elfesl(f rrrur nu1apxnifctatls rl(vs;u) etrxrciotfp e nvilt)s2xrxopou4omtelfvslsfaDta( oou1oetnmieildfs2eaums;(4aetrmr3totfmtelneils srum(o3oy4lleelfvi s a2rr(moou1tpt ifeiat a uln s;() reoxr3iatfpteai ols0t2uo(mpoy1amt mictltfa2ua(rp;u1tee io3tldfm2emnmp;(0tetnmr3tydlmtranvi t0 rxmio io4amt  iet t  Dtm( oou1tle iictld m2emuvo u4trtrxf3ty1lp ean i;t  etmxmpno1oleemictls  rumu ont1tpto o3tysls em(vs;t0aeerio iydlpt  neo s t2urir3oodomt mneilsfaDrrx pno1teto o3tldlm2umnvs t)altrif3io1fptelies t)s2urxr3oydoleemici t) rtrx onu1tpxo fctldlmDel( s (0 rermocoo1omDraueilt srxo(m ou4llenmfeils  Dumxm nu1apt  fetat a rmnms;(4tltniocto1lm   u s t  2tmimpiydomtn nvsat)a2ua(mpou0ale io3iatfs2rauvsn(4 eermr tytoatr ieo s)sruo(o nudamt lncsl(f 2uau ooo0tleo fciadls2um( on(0 eermf oytlm  anvs t)sexrxmpiodap n nesas)s2urx pnt1olt  octltlsDra(vp;(4 eeoxf iydoa elues;s)t2tmxr oo1omte iesa(f 2rm(ronu4olxomoeilsfs2rmnvp;u)artnio oo1oaDrlu i;t0seuoxmpno1ll nmnetl( srum( p;o1tetoioetys m el(mo (0tltrmf3oodlmt li s s) rxr(m3ny1apte fvsatfsDurumo;u4tle mfcias sDeauvp u4altnir3totlpDelieo;t tetoio3no1amtemfctlt) rrmxm ou0olxomo3ild a2rlumpnu4altnifcoo1fateauvol(  eur(r3nu4lpenlfvt (faDrrx  ;u4oltoiociatfs2uau snt0alxnif iadla elneol(0sruo(r oydapte fcsat)a2rmxro;u1apenmicildfs rlnms;t0trerif3ootfp  lneols s2xmim3oy1ll n nvtltf rurxroot0teenmf3tldfs2ra(vsn(4aleomfcoa1lm eau ils  rxo(r iudlm e nvia() 2rr(ro;u4tpt ifciat aDel(mo u4tlermrcto1fp raueslt t2xmimpoy4olenmnei s  Dur( ont1apxomfctatfm ra( o u)tlxomf3oytomte nvs ()trtrxo io4lp n ict () Drmxr ;u0tee mociasfaDrm(mp ()trermo io1lm  livi () rtmir ny4om  mieta( a2trumo;o0alx ifciasfaDeanvs t4 etrifctatfm   n o;(0t2urxr3ou1opt mietas  rrr(mp;u1teeomfciyd a2rlnvs (4alerxf io1fm  li i s0 2toimpiudlleemfvi tfsrrmx  ;t4ope mfetltlmDrauvo;(0aeeoxf3oodfmtelnes;()srur(o3nydolt mnesa()a2tmx p;o0ope  feiltls rluvsn(4 rxnxo3oadla rai olt0 2xmir ou4ll elncs tfaDrm(rpot0olt ioctat sDrmuvs;u)trxoxo3to1oaDranes t)truo(r oodamee fcs ( srtmu oot1tlto o3iltla umumo u4 eermr3oytfmt  nes;s) rtoir3oo4lmt micslt srtmu pnu0olx  iciatfm rl( s;u4 ltnxr3ootlpDeauvo s)t2tmim3iydalt mfviat s2raurpno0apxo ocilt sDran o;t0 eeoir3iodla r ivo;t) etmxm nu4ol   ncslt) 2uax ooo0tlt  fctltfaDeluvp (4 renxf ia1fpDe ieolt)srxoim io1olt lnci t)srtrx  ou0olenmfeias s eanvs;u) rtrmr3iotfaD lnvi;t0trxrxo oudalt mfcta(f rraxmono0olxo fctltla rmnms;(4altnxo oy1om eauvo (0 etrimpiy4lltn fctls artr(mooo0aptn f3tldfa ea(vp t4tlxomf3tatlaD lu o;s0teto(o nudllt  fvsatfarrmxr oo1apeo o3ils s2eaump t4trtnif3oy1oa elnei (  euoxo3iu1al   nvia(f rra(mont1tle mf3iadls2uln p t) ltrxrciatom  au s;t0srxmxr3oo4lmtelivtl(f Drmu pno4optnifciat m2ua(mo;u4tltrxr iotlpDr u o s srtoxm io1optelncia(  Drax pno4ape  i3iysla2ul(vpn(4 lerxfcto1opt  iesls trxm(r ou1apenmfcia(f 2tru  ou1olt  feiysfaDul(vs t)areoir iydlmtrau o s)trxr(mpiy4omee fvsl(fs2ta(rpot4ole ioetatfmDemuvonu0areomociatoaDr iei t t2tm(m3iy1alenlnvsl(f 2rmxront1oexoio3iadfm2uauvo;(4 ltnxrciadfa eluvi t0 2uo(m3iu4om e nei tfsDrmxm nu1opeomoctldfs2elu s (4arxnifcta1opt  n s s tetm(m3iydlm e ietl(  Drax oou4alx  ociytlsDua(vs ()arxnxocoo1lmtr u i;() eum(r3no1ol emivias)aruaump;o4aptniieiydls2rlnmo;(0tlenmo tadopDr ivi t t2toiopiu1apt lfcta(f Durumpou1tlt ifcilsfa ra(mon(4altnxr3oatfptelieo ( s2umxo nu1lltemiesltfs2ua(r ;o0oex mociltlmDumnmp u4trtnxf3iodom r i o () 2urxr3iydom emfvs () Dtmur oo4ole  o3tltfm2el(vp;(4trxoxfctadfaDr u s ( seuoirpnodlpee fetl()s2rmx  nt4aexniictyd mDeanvs;() renxocoo1fmt  ivslt setriopnodll n icsasfarrr(r nt1tpto octyd sDuanmpn(4tetnioctytfmD au s s0 exoir3oudomenmnetl(  2raxmo;u1tetn ictad aDul(vo;(0trxrxr3ootfpDe ieilt s2trxr3ou4ap elfvia( a2raum ;t0opxn oeild m2ul(ms u) lxrmrcty1fm  ln ilt0teto(rpoy4alte ivta(fsrur(mpoo1tex mi3ildfs elu s u) rtrmrctodop elueo;()srxrxo3oy1op e nvs s srrmxr ot4teenmietlsla2elums u4 rtrxr oo1lpDrli i s trtmimpiy1amtemfesl(  rua( p;t0texoio3iydlm ul( p;t0 reoio tatfp rlnvs;t0t2xoimpnodlle  ncs ()sDurx ono1olxomfetat s umuvo (0aexrxr3ta1omD  n i s texoxr oodlpen nei tfsDtmump;u0tpt  feiltlsDemu p;(4 lxrif iatlpD aneolt0tetoio iydapeelicsl(  Dtaxr ;o1aleomieildfa rm( o;t0 lenio oo1la rli o s) etmim3io4am n fcsl(faDtm(rpno0aeeo o3iaslmDulu sn()aexnmr iydoat auvils) 2tr(opiudamtemnesat)s2rmxm oo0oee mo3iatls2elnvsnu0 rxoio iotfm eau s;s) 2trirpio4oltemnvta()srtmxmoou1aeto ieildfs2elnvp (0tltnir iatfa   nei s0trurxm iy4amtnlncslt) Drr(r oo4tlx ifciltlmDul(ms (4 rxnif3iotfateln sls0seuoxmpnu1oleelfvtl() rrruront1tptomfeild sDelnmo;u0 lerir oytfmtr uvo;( t2urxr3io4ap   iviat) 2raum oo1aetniieiydfs2rmumpn(4altrir3ia1fp eau o s)texoio3oy1ap emnvslt aDrrum ;o4teeoif3iydfa2rau s u0 lxrxfcoodlm elnvi;(  2xm(r iy4opeelncslsfarrrx o;o4open ieilt s2rau s;u) rtrio oytfpt  neo;()srxrimpiy1am n fvsasfsrtr(  ot0ale ifetldfs rln p u0 rxnxf iatomtraivilt setrir ny4ape  fvias aruau p;t0aeenmfciltls eauvo;()tleoiocia1oaDeanes;s0seur(m3iu4ameemfvsltfaDur( o;t1apx mociyslmDra(mpn() renmo to1fmtrli o;t0sruriopoudame mici ()a2umu  nu4tpen fciltfm2rau p (0tleoir3oydoat  uvi;t t2urimpio1ll  mietls) 2tr(m nt1tlxomictldlmDrmn o (0alxoxo3iadlmDeaieo (0 eumiopnu1oltemieilt a2ur(rpoo0tpxnioctadla rluvp (4 lxoxr3todfp eli s;()t2uoim iudllenmfcsatfs2ra(  ot1tpenioeiydlsDrm( ont4alxoxrciydla   u i;s trxm(r3iodame mfvia( sDtrxro;o0aet  ocild aDumump;t0treoir oatoa elneol(0s2xm(m oo4ol e iet (f 2urx ooo4tptniieiyd a rau o;t0tltoxfciodfa   n s;(  eurxopno4amtemfvils  2urx pnu1alt  f3iaslsDeanvs;t4 rxomr ta1fate uvol()seur(rpoudome  fet ( s2rmumpot0alxo oeiasfs ulnmp u0trxomfciytlat  ivi t setrim3oydll nmnvt t arrmx  ot4aeeo i3taslaDel(mp u4artrmo3todlat auei s)texr(r3iy1alenmfes t aDumxrp;u1alenifetydfaDuau o u)aeerxoctadlm eauvs t0 exoxopou4ole lnesltfsDtaxrpno1altnmfctys mDum(mpn(0 reoif ootoate nvi;t0t2xmxr io1amtelnviat a2taum no0teenio3ilsfm2eln ont0 eeomr3ia1lm   ivolt trxmir3oy4omtemivsl(fs2umxmono0tpt moctltfa ranmpnu) leoiocio1fm rli s s0 exoimpny4alenlfci (  2rrum ou4alxo fcildfm rlnmp (0trtomrctydopte u o;(0setmxm oo4lptelivilt) Dumu o;o4optn feils mDuln pn(0tleomrcoo1fmDeanes;s  2um(m ou1lpe lfctltfs2trxm oo1oet  i3iltfm rl(vsn() lerir3tatfm  lneolt0t2xm(rpnudomen nes t  2truroou1optnmocildla ra(mpnt0tlerxf3iotoat  ieolt0srtoir3io1altnlfvi () rtaumpnt0aleoioctyslsDuaump;u)tleomf3to1latelueol(0sexo(r oudllenmiesatf 2rr(m nt0optnmociadfaDran o;t0alxrmoctotfm rai o ()sexr(o io1ome mneta()srur( o;o0tpto fetasfm2ul( s u) exnxfciatla   u s (0 2tmio3ou4ap   fctas)s2ta(rp;t0aee  f3tltfm rl( s;()arxrxrctytlpDe n o (  etmxo ny4am  licsas) 2rmxmpnt4optn i3ilsfa2uauvs;(0aexnmoctodomD lneslt srxrxopio1am n fvia(  rtrurp;t0aeeomictasfmDumuvs t4 ltniocoatop r i s;s0setoxm3ou1lmtnliet s)s2rauro;o1tpxoioeiat s emn onu)aetrxr to1lp r n il(0 etm(m ou1amt mnviat  2ur(r no0aet  ictysfs rmn p;(4texrir tydomt  nvs;t)s2ur(m3nodamte nci () 2ta(root4ape  f3iysfmDuluvp t4 exoxocoatfateau i s0 rtmxo io1lpt lfctlt) Dtrx o;o4tlx  ieildls em( on()texomrciy1lmteai o;( seurxr3iudop  lfeilsf rtax ono1tet mo3iat s eau pn(4 lxrmr oa1lm ranesls)t2uoxr oy4altnlicsl(f rurx o;t0opto fctldfm ra( p;u4 eenir totlmtrlnesls seuoim iodll nmics ( srrmx p;t1tleoiietys m2ra( pnu4texomo tadfateauvols  rtr(rpno4om  lnct tf Drm(ronu4tptn fetlsls2raump u0 rtoifcoa1lm ranvi s)trxr(m3ou4altn neil(faDurumont1tlxo i3tls mDrlu pn(0aetnxoctytla eli ols srum(m nudll n nvsas)a2rm( ont1aetnmo3ilsfa ranmpn(4 ltnxo to1lpteluvo ( texmim3iodlleelfetls  Dtr(rp;t4teeo i3ils m em(vp;(0 rxoir3oo1la ranes t)sexrio3iodlle micsat)aDra(rp;o4altn oeiasla2eau p;u4teenxocia1lpDelnvi (0srumxo oy1ole  fvtat) rrax  ot4opt moetadfmDum(vpn(0aexnir3to1om  anvs () 2xr(o iu1lp  lictas)aDtmumo;u0tlen fciys s2rl(vonu)teenxo iotlptrli i;()truo(r3nu1lpe  fci ( sDrmurpnu1opxnmo3iltlsDel(vs;u)altrmf iatfmDr n i;s)trtr(m oudlmee nvtl()arrmx  ou0olxo i3iadlaDuan p;u0trtnmo3tytla  lnvo ( s2tmiopoudomtelfvslt) 2urxm oo0opxn icilslm umump;(0artnxfcta1oate ivol(0s2urimpny1omenmicsls  2ra(m nu4olx iieild a2rmu on(0 lerxo tadopDe i s t t2toxr nu4alen ivils a2tmx p;o1tlx  oeiat sDemn p;(4 etoxrcoytlmD aiei t0srtoxo no4om elnetas)s2raxr ou0aee  oeilt s rauvpnt4arenif3oy1lmt auvs t)srxoxrpno1ame  ivs ()sDrmu  ;t4apxo ieiytls2rl( p (4 ltrmrcoatopDe i sl( teto(mpno1lle mnvsa() 2raur ;o1aleoifeiadfs2el(mo;t0teeomr oytfaDrln s t)t2umim3iudale mnetas) Dtmu  nu1alxnifeiytls2rmuvsnt4tlxnxr todopD lnvslt t2trxr3iodol nmfvt t)aDuau p;o0aee  oeiasfm2eau o;t0 reoif3oydfpDrli s (0 2tm(opnudalee nvil( s2umump;t4tetnio3ilsfm rm(mo;()tlxrxo totfpDelnvols0trumxm oo1lmtnmncils)aDurumoou4tptnifctatfa ulnms;() rxnxo3iatfp r i il(0 etm(rpiy1om emictatfsDrmxront4alxn feiltla uau s;(4arxnif iydopD ln olt t2urirpoudol elnetls)sDtau p;o1apen fetyt s2um(vp;()texoif oadoatelu il(0 rtoim3ny1lm n ics s)srraur ot4aleomf3tytfsDrl(vs;u0 ltoiociotopDeli ilt s2xmimpnu1optnlivsat sDta(ro;t0tpen icias mDeaump;u0 rtnxo3iytoa raueslt srxoirpiu4lmtelfcilt)aDumumonu1alxnmociadlm2rl(vp;t) exnxr3oatlm  ln ils)t2uo(m3oy1llen nesa()s2tm( p;o4alx mo3ias a2ul(von(4trtrxf totlpDe uvs s s2tmirpnydomenmiet tfaDraurpot0ole  fciyd sDum( pn(0trxrmo3todlptelivi s0seuo(rpno4lptnmneslsfs2rmurpnu0olx ii3ildla rlnmpnt4aleoir totoa e iei ( trxm(r3nu4am n fei t aDurx oot1tlto fciytlm ul( o;u4artnxf oodfa e uvi s)seur(o3no4opeelfeilsfsDta(moou4tlxnifetyslmDem(vp;u) exnxocoydla  aieilt)trtrirpoy1omtnlncs s sDtmum nu0tetoifciadfmDem(ms t) lenmr oatfm e nvs s setm(r3oy1olte fcsas  2umu ono4oeenmoetldlm ranvs;u0 lxnxocoo1lm  au ils setoio oydlp  mfvs sfs2tmum ;o1oleomfetyd s uau o (4trermo3tydfptrli s;s)trtoxopoudaleelfvs () Durxro;t0aetoifciad sDemu o;t)texoxo3tytlpt lnvi;t)seumxrpou1lpe lieilt aDrrxr ;t4tltn i3iad sDrlnmo;u0tltnmr3ootomt  nei t)srtrimpiodllte fcs ()aDtau pno0alx  octldlm ean ont0 exnxo tatfaD lu s;s  2uoxm3iydlle lnei sf 2rmumpno0tptnmiciadls2ra(vo;(4trtoio iytop  ln s;t  rto(rpoo1lm  mivtas) Duau pnt0olen iciaslm2umuvp;(0aeerir tatlmt aueo;(  exr(r3iodlpee fvs tfaruaxm no4oleo fcilt m rlu on(0altrir3oatfptrau s s0tetrio3iudlle mnvia()srurxm oo1oleoiiciatla umuvsn(4aleniocoydfpt  u s s t2toxrpoodlp e fes s)s2umxm ;t4opx micils s2eau snt)alxrif3iytfa rlieo t0 2urxr iudll   fet ( sDua(ront4aex  ieiysfmDuln o u0 renmoctatomte nvi;s)texrio iu4lmt mnctat a2um(r no1oetn iciadlsDuln p u0aexrircoydfatrlnei;s  2ur(o3oo4olenlncilsfarrmx p;t0tltniictlsfm2ranvp () exrmoctatlp e n o () 2tm(opiodamt lici tfarumxmpot4optomiciadfm ua( s;(4aexoiociodlaDe ueols  rtm(rpnu4ap e fcil(fa2taump;t1tet mfeils s uluvs u)aexnmrciy1omD  nvsls0s2to(o3oo4omeelivs s)arrr(mpnt4tleomiciatfs2emnvp;()tltomrcoytla r n i s setoimpiu4altemnvs (fs2raxmoou0alxn f3tys m2uauvon()arerxo3iotom  li ils)setm(opoy4lme lfeiatfs2tr(  oo4apenifeiatfmDra( p;(4teerxrcoytfptr n o s trtoxopno4om  lfcilt)arta(mont4tlt iociytfmDrau o;u0treomf totoa e uvil() eto(m ny1am elnvs ( a2uaxmonu1altomieilt mDemuvs t0 lxrir todlmDraivi t) 2urirpoo4ap n ivsa(faruaum no4oltomfciydla2rlu onu0 rtrmr3ta1lm  lu o;(0trxmxm iy1ol   ietl( a2tr(r no0tpeo oeiad mDrln s;u) reoxfciodfmtrauvo;(  rurio3nodopeemicslt) rum(  ot4tee iieils a2ea( onu4aexnmo ootlp eaieo;t) etrxopny1ol n ics t  Durumo;u0alenii3tltlm um(vo (4areoif3tadfp elu o t  rtr(rpoo1ap  lfetatfsDraxm nt1optnmf3ild s2rauvp u0 rermr ty1fmtrluvs s0s2umxrpoo1lm e nct tfsrtrumont0aexoiieias m ean on() eerif iotlpte ieolt teto(m ou4altnmncs (fsrrm(mo;u1tpx  oeiysfs2rm(monu4tltnif3iotomD li o;( srxm(mpiu1al elfcs sf 2ta(m ot1apen f3ildlm2umnmsn() ltrif oytfpDrlnvslt0 2tmir io1olte ict sf rrauro;o0tlt iiciydlmDua(mo ()aeenmfcia1lpDe neils)t2tmxopnydaltemivtat) 2rr(m oo4tlxnii3ildfs2rlnvs u4arxomo3oodopDeln o t srxm(mpnudlmt lieiatf rta(r no1tpxomfeils s rlnvonu4aleoxrcoatomt  u i t)trxm(r3oydll  mfctatf rua(  oo0apeoio3ilt a2emnvpnu)aetoifcoatoaDelivi (  eumxr nydlme  iesl(f Drr(r nt0opxnmi3iydfm rmnmont)treomr tadomD li il(0trtrxmpny1lp  mnetas)s2rmxrp;o1tet  oeiad s ea(ms u4tlenxf to1omt lu olt trxrim3iu1ale lfeslt s2ra(mpoo4apeomo3iltfa rau o;u)trxrio io1fa eai sls t2trxo iodomeelnvi s aDuaum nt4oex  i3tlslmDemn p t4teermf3iy1oatr ieo;()s2xr(m oo4lptelivt ()srurx oou4oleoif3iltfs2em( o;u0trtnio3ootoateau i;s0 ruoxopio4omenlfesa(fs2rm(  ot0tptn fcias a2um( p t)altnif io1latrlivils t2xoim iy4lm emncs ( a2ua(rooo0olxomiciadlm2ra(mon(4aeerio3ta1omDrlieols srurim3nodap   net t s2urumpno1tee mf3tydlaDrmn p;t0teeoio3io1omte ueil() rurim3iydopte net tfsrrm(mp;t1apenmiciysfa um(vs t)altrif oa1op  auvs;s  2uoxm iu4apen ivia(  Duaur ;o0tet mieilt a raums t0teerio3ia1lmDr u o (0srurxr3iudope lneta(f ruau oou1olx ifetaslm2rm(vpnt0 rxrmf3oydopD  nvs t)t2trxo no1ll elnetat)srtm(m ;o4tpt mieiytlm2eanmo u4 rxnxf3totfaDe uesl( srumio nu1lm e feil(farrrurpnt0apt  oeiatfm2emums;u4aexrmo3oytoatr i ils0t2xo(r oo4op nmfvtlt  Dum(r ;t1aexnmfeiltls2elnms (0trxrmf3iydlp  an o ()tetoim3iy4lm nliciasfaDrrxro;u1oetnifciydfa2um(msn()tltrxrctatlm rlnei;t trtoxmpoy1lle livils  2urxmpnt4tee  fetlt a el(msn(4 lerio iodomDe uei (0texr(opoydlptelivsltfsDra(rp;t0oeeo oetad s2rlnvsnt0arxrif oo1fpteaivi ( t2trxr oo4oltemnesas aDum( ooo1aet if3iysfm rl(mp (0tlxoif ootfp ean o (  rto(r iy4al elfcsa( a2rau pnt0aeeniietytfa2elums u)aetomf3to1oat lieo t0t2tr(opiudaltemfes sfsrur( oou1tpe mietlsfm2emnmsnu)tlerio3iotom e ieo (0srxmio3oy4lmtn ncsa(  2rr(mpot0alto fctatls ua(von(0areomr ootlp   uvs (0s2to(rpiodop elfvilsfsDtruro;t4apx moeiadla2ea(mp u4altnmf tydlm r iei s)tetoxopnu1lm elfvtl() 2tm( pno0tet iociltfs uanvpn()aeeomrciodoa eluvi (0srtoxr3oudolee fvt s)aruru ono1apeomf3tltfa ulu snu0aetnxr todom eaueolt0srtoxm nodopeelfvsltf rta(mpno1opt mfctltfaDemnvsnt) reniocoytopte u s s0srtoiopou1amte fviatfs2rm( pnu4apt  ictls s ulnvon(0 rxnmo3oa1omDe nei s)sexoio oudapte fvsl()arraumoou4apxn ictldlm2uanvpn(4artnxfcoodfptrlu i;()srxrim3iy1alen nci sfs2umxroou1aex ioctytls em( p ()tetnifcto1lm r uvi;()s2xrirpny4omtnmicsl( s2uru  nu0tlt  fctytls ulnvs;(4 eeomo totoaD anvilt0sexmim oo4lp  liet (  Drm(rpnu4tlto o3tadfmDul(vonu4 renmoctydfa eluei;s  2uoxo io4ap elfvt (fsDtru oou0optn feiatfs2uan s;(0altrir3ootom r ieo t)srurxm3ou4llen fei tfsDrr( pnt1tpt mfeilsla2emu p;u) rtnio todfm elnei s seto(opno4lme mnetl(farum(rp;u4tlxn oetlsfs rlu s;t4 eenmfctydfmteluvi ()setmim oo1al nlncta(fsDrrx o;o0tlxo ociatfa ua(mpnt4teenxocta1omDrau olt)seurir oo1optemnei tfsDrm(r oo1tle  f3iadfs2rau s;t) exnifctotfmt aies s sexrxo io4ap   ncs s sDuax  ;t1aptn oeiysfs2elnvp (4alermo ia1op rlieol() rumim iudape lnciatf 2tmxm ;o1apeniociytlm2emu snt)texoif3totlmt  n o;(0teurxm3nu4al nlnci s arurxmpot1tpxo fciatlmDumnvo (4trtoifcto1lpt aueo (0texm(r3ou1lptemfeil(f Drr(  oo0tlen i3ildfm rmn o;u4 lxomo ty1op  livs s)srtmim3iu4op nlfeil( sDta( pnu4opxoifctat m2ra(mp (4tlxrxfciytla rlu i;t0 rurio3nydaptn ivsa(  rum(r oo4alx  ieilslm rluvonu)altomr3tadfaD ln o ()srtm(mpoo4ol  mfes ( s2tau o;t1tleomoeiysla rmu o;u4teenxr oy1oatranesls)t2xoxm3no1olee fcsa(farrrxrpot0aexomoetaslaDulumo;t4aexrmfciy1fmD aieo;t0s2tmxo iudap nmfctas a2taxrpot4alxnmi3ildlmDran s;()altoif3iadlmDelu i;s teuo(r3oo1op nlicsl()artmumono0tex  ociysfm2rl(vsn() etrmo3iadfmt an i;t  etmirpou4op elfesls) rur( oou4optnifeiasla2uanvs ()aexriocta1opDeli s ( setr(o oy1omtelieias sDtmumoot0tltn oeils s rln s u4aetrio oy1fmt livo;( teumxr io4lpee ici ( aDra(r oo4opxoifcildlm umumo u0artrioctotlaD lu i t s2xmim3nu4llenmnvsl()s2taxrpnu0olt io3tysla2umuvo;t)aeeomociadopDrlueo;t0 2um(r io4ap   fet tfsDra(ronu0tltnmfciadfa rau s ()trtoio ia1la e ueo;s t2xmio3iu4ap e nvtltf 2taxm ;t0olt  feiytlm um(mp;t)aeeoxrcio1fm r uei;()srtriopno1ap e neils aDrr(mp;u1oetnmi3iltls2raumpn()tlxoircoatoatelivi;( srtr(mpnu4optn fesa(f Draumo;u0apx ioeias m2rln snt4 ltrmf3todoaDrlnvo (0t2xrxmpoudamtemfeia(fsrrmu ooo0alxoif3ildfs uaums (4 rtrxfcoy1fate n i (0 ruoxo3iy1aptelnciltf rtru onu1aex io3tasfa2um(vsnt4aeenir todfmDraues ( trxoir iy4al  licilt  rrauro;u4aexo ietydfm2elnmo u4teenxf tatfpD aieo t truoio3io4am elnesa(f rrrurpnt4alen ocilsls ea(vont4 rxnmo3iodfa rln o () etrxopoudolt  ietlt  rrrum no1teenifeilt a emnmpnu4aleriociotlp eai olt) rtmxr3oo1ll emneiasfs2rr(  nu1oeenmietas aDelums u4aexnif oy1fmte ieo t)s2xmir3iydal  mncia(  2ra(mpou0oexoiietldfm2ulumpnu0 etrmociotlat  ivi;() exoio3oy1am n ivs tfsrurx  nt0tee  oeiltls2ua(vp t0tlenxfctytfpD  uvo;(0teto(mpoo1aptelnes sfarurxmp;u1tptomoetysfa2umnvsn(0tlxrircoy1oa e neo;t)t2um(r nu1op elfvt s)sruaxrp;u4apxnmieiat a rl(vs;()aexoir tadlmt auvi t)s2tmiopny4omt lieta()aDtau o;u0tlt iieias m ulumo;u4altoxr iy1laDeaies s)seumim ny1lmtn feil(  2um( o;o4apenmfciltfmDrmuvo u4trtrmf3io1oaDelivo t t2to(rpoo4aptemivs sf 2taumonu1tetn i3iadfaDel(msn()trtnif3ty1faDraivo s srtr(m no4llt  ncsat a2taurp;o4optomfcilt m uaump;t)texomrcootoatr neolt) 2ur(o nydol  mnctasf rraur ot4ale mfetytlmDrmnmpnu0alxomf tatla r uei;s)trxrxm3oudopt lnct ( sDtmu p;u1alen ieias a2rmnvp (0 ltnmfcoadoa e n s;t)seto(r iy4op  lfvsat)s2tr(rooo0opxomf3ilsla2uau p;t4 lxomfciy1fmt  u s t trxr(r3io4op emfetas a2ta(r no0aptnioeiys s2uanvs (0tlenio to1omDrluvils texrim oy1ap  mfct sfaruaxrp;t0opt moctyslm um(mpn(0aetrmf oa1lmt  u o ( t2xmio3oodap nlnct s) rrax o;t4aetomieiatls2uauvo t4arerir oodop r nvs s truoxrpno1ome lnvta(faDurum nu4tlt ifetatlm2ean s;u0 ltrmf3oo1la r n s ()tetmxm3iudome lfcsls) rrmxmono0teen octys s uauvo;t)arerxocoytla elneilt)t2xrxm3iodopeemfcsl(  2uaxrp;t0tetn oeiytfm2rmn s u) lxoio3oa1lpDrli sl(0setoiopnu1om   feilsf 2rr(m ;u0tetomfeiyt s2umn o;() exomr3iatopte ueo;t)setrxopoo4am emnvtatfsrtaum ;t1alen oeildlsDrlnvonu0treoio oydoateauvi t srumxmpny4oltnmneslt)s2ur(monu4apeniieildfs2ean on(0tlxnio iy1op eauvs t teur(o3iodam n nci (fsDrr( ont4tlenmicildfa2umu pnt0alerif3ootlpD lieol( seto(r3iu1olenmnviasf Drm(rpot1tpxniiciad m2em(vo;u0trxnir3tytfatr uvs;s s2xm(mpio4ap  mnvs s aDrmum nu1olto oetytls el(mo u0trxrxo tadlp e iesls0seur(m3iu4ome  nvtlt) 2trxrp;o1aetnioetadlmDrl(von(0artnmf io1lmD anvs;( s2umiopnudop e nvsls  2tau  ;o0oee mfciyslm rmn p u)tetrmf ta1lpteauvo (0seumio3iodolt mfcsas) Duauro;u0tpe mfeiys mDeluvs (4artnxfcia1omt lueslt0srurxmpnydllen ivtl(fs2rmur no4aleo ieildlm2em( o u0tltnir3todfpt ln o (0 2umxrpiy1op elncta(  rrru p;u4opxomo3iyslmDulnmsnu) ltrio oatoate u olt  ruo(m3nu4amtn iei ()s2trxr ;t1tpxnii3tysfa ranmonu4 lxnmfcio1fpDrlieolt) 2trirpoydal n nct (f 2tmxr no0aexoiicildfa eanmsnt0tleomo oadlaDeai o;s) rxoirpoo4omt lnctltfa2uax p;u4oexniieildlmDemn p t) rtrxr oytoat  uvo;s0trxmxr oydlpt  ncsatfarrmxmoot0tetoii3iytlaDra( s t4treomf io1lm eaueo t  rtoxo io1lp n fei s)aDum(r ;o0tleo ietlt m2eln sn(0tlenxrciadlaDrlieilt)t2urxr oodol e iciatf ruaxr ou0tle mo3tasla elu p (0treoif iadom rli i;t0srtr(m3iu4amtemfcsltf Drmu  no4tpeo i3iadls2el(vsn(4alerxf oo1lmDr ivs;()trtoimpoodlle mici s)a2umur ;o4olenmoeiyslaDumn o;t4aeeomociytoa  livslt) 2trimpno4lptnlnvtasfaDur(r nt1altnii3tydfmDrmnvo t)tltomo3oodlat ln ols  rxoxrpno4oltn iet s aDum(rp;o4alx  ociasla2ean s (4tlerif3iodfmteluvo t0 2toxmpny4op e netat) 2rm(mpot1oltnifeilslm ranms;u) ltnircio1opD  ieolt setrio3oo4ale lictlt)a2rruro;o1oetnmfetyt sDul( s;t)arxrxf3iytfm  lu i s trumimpiodome mivt (f rrru p;o0oeeoiiciaslaDrmuvs t4 lermrciytfpt auvols0s2ur(opno4omt lnes t)aDta(mp;u4opt moetadfaDra(vs;() lxnio3oa1lp eln o ()s2umxrpoodol nmnvslt)s2rrxr ;o0oexoioeiys aDulums;u)tltnxo3ia1om eluei;(  2tmirpiudoltnlivs tf Drmumpou0opt mocilsfmDea(vs ()texnifcoydfpDraivi s trtr(o nu1olt  fcia( a2ta(  oo1oetn ocilt mDemnvo t)aetrio tydomte nvol()srtmim no4lmeelnes ( sDtr(m ;o1opxomieiadls ua(vp u0tltnxo3iytomt ai o;s0trto(r oudlp nlfctltf Dur(rono0oexomfcilslm2raump u4 ltoioctatlaD luei;s0setmxopny1ap e nvtl()aDtrxmonu1tlxnmocilslsDrlnvpnt)alxrxo3iatfptr ivs;(0srtr(m iy4apeelfvtl()aDtaxmono0ape  i3ils m2emn snt)trtrxociatopDrlu s;t0s2uriopiodlltnmfvtls aDrax  ;u4tet  f3tas mDuluvpnu) rtoxo3ia1laDraivsls0 eur(r3oydlm elici sfarraxmo;t0tlxn i3tltfa2el(vs;t)texnxocty1fmt aieil( trtr(r ou1amen fvils  ruaxrpou1tetomfeiadlaDrlu s t4arermf3iodop rluvi;(0 rxoxmpnydaptnlict tf 2rmu  no1aee io3tld s uan o;(4treoio ta1op  an sls) rtoim3oo4ap n nviatf rrr(mpnt4apenifeiytfa rln p;u) eenxfcoytfmt  neslt0 rumxopoo4omtn ncsa(  2raxmo;u1alx  f3ildlsDua(msnt0artnifctodomDeli s (  ruoxo nu1lmtemicias  ruru pnu0tpx ifeiasfmDrm(msnu4 rerxo3ootoa   nvol() ruriopiu4lpe mnvi tf 2uaxront0teenmieiad a2emuvo;(4 ltrxo3ia1fmt  n ils)srtriopiy4altn nei (  Duaurpoo4tpt  fciydla ra( o u0trxnxr oytfpDrauvo;()t2xrxr3io4omen fctlt) rrmumo;u0opxo oeiys s2ulnmp;u4 eerxo oo1lpDr n sls0 ruoio oudlm nlfctas a2trurpno1tee moeiaslm eanms u)artoxo3tadopteaivolt) rtrirpoodamtnlnvt sf ruaxmoot4oetomf3iys a uln p u4texrmo3ta1oa rluvilt) 2xrim3iu1lmenlfvt (farrrxr ot4altn i3iaslm eauvp;()aeerxf oytoat anvslt0truo(mpou4ap nmivt (faDurxr nt0tlenmi3iytfsDrm(mo;u0 reomfciatlmte i s;t0srtmir3no4omt mneiat)a2umu poo0tex ifeiyd a2ua(ms;u)texnio3iy1fm   iei t sexr(o io4aptemfesa() 2tm(ront4tltniociadlaDrlnvo;t) lxnxo oa1fpDraues t texrxo iudll   fet t) Duaxr ot1texoiieilt sDuauvsnu0trermo to1lateanvs;t0 etmiopoydomt  fvsasfarua(m ou0tltnifetldla2rmu s;t4 etomf tadlate uesl( sexmxr nu1aleemnct t)a2trumono4oltnmieiltfa2ua(vsn()trxnif3iotlmtrlues s  2xoio3iodaltelfes s)arua(mpoo1aex  fctyslm emnvo () rxnmo iytlmDr n i s0seuoxmpny4oltn ncsls  2trum ;u4openmi3tat a uanmp t0altnxf3ty1omDranvil(0tetmxm3oy1ol  mfvsasfa2rmxmono0tpeomi3iysla emnmp (4 lerxo iadomDrlnvo t)t2trxmpiodol  mietls)aDraxroou0aee moetadla2umnvp u4tlenmf to1lm   ieolt t2xrim3oodll nlnet s)sDtr( pou4aleoiieiytlaDumnvo;t0 etoif tydopD anei (0setmxopny4lp e fvtltfs2urur oo4tex  i3tasfs elnmo;t0teerif iatlmDr i o t s2um(o3oydlpe  nvsat sDuax pnt0tptn ictasfa2eln snt4tlermfcoydoptr ivi t srtoxr io1omtnmict s  rtmum nt0oexomfcildfm ea( ont) exoxfctydfaDeauei;( setrxrpoudlptn net t)s2tr( onu0tpt ifcilt sDuanmp (4aexoircoydlm elivs ( truo(mpiudaptnmieiat sruru pnu0aex mietldlmDua(msnu0 ltomrctodfp rlues s0texoirpiu1ll  miei (f rrrxrono4teeomieiatfs ea( s;(0 etnmf3oydfa e ueslt sexoxmpiodoptemnctltfsDtm(mono4apt iocilt sDel( o u4tltomo3ty1lptraueilt) ruoio3nydopen nesas) Dur( ont0aeeniictadfaDrlnms;(4trxoio3io1op e ivs ( teto(mpoo1ll e neils s2rmxm ;t0tleniociytla ulu s t4trxrmf iydlpte ieo;( sexmxrpiu4amee ivsas  rtm( o;u0aexoifciltfaDra(vpnt)aexoircia1lat  ies;t)t2um(opiydlme micslt s2um(mo;u0oet ifciltfa2em(mp u4trenxocoadopDeanei;s)trum(r iu1ale lncsat) 2tmu  nu4alenif3iad m2elnmo;t)tlenxr iatlp eli o;t seuoir3oodlle mfeslsfarumumo;t0tpeo i3ildlaDeanms;u) ltomocootom e i ols)trxrxo3ou1lm  lfei (fa2raxr ;o4aexo ociat s eln s (0 etnxr ty1laD livi ()t2xrxrpiy1lleemnct t s2um(mo;o4altoif3tyt a2uanvp;()tetoxf tydomt auvilt  2xrir oodolenlnci (f 2uaum nu1opx mietyd s elnvsnt0artniociodoaDe uesl()s2toirpiydom  lfetl()sDurxrp;o4apeomieiasls2ul(vonu)alxnxfctadfptranvs;t  rumxm oudll  livi t s2rr( oou0tex ii3iadfs2umumsnt0arerxo3io1lm elu s () 2uoxo3ou4altn fctlsfarrm(mpno4aptomi3iadlm2emuvo;u0altoio oytlmtrln ils0t2tr(opoo1amen ivtl()s2ta(ro;o0oex iietad m elnvp (0trxnxfcoa1lp ranesl( t2trio iu1am  lnciatfa2ur(r ou0aleniieiys mDuaums;(0tltoif3todfateaneilt)srxoim3nu1olee neslt  2ta( o;o4olenmo3taslmDrm(vs;t4aetoiocto1optrau slt tetr(m nudameelictas) Dtmu p;o4tlx mieiasfa um(mo u0aetrir3oo1lmDeaivs;t)srum(mpny1oltn nvsas) rumu poo4alxnmoetyt mDeanmo;t)tlxnir oadfmte nvils t2um(rpio1ll   netl(fartmum ;t0teeoioctadla2ua( o;t4 exniocto1lpD  uvs;t0t2urio3iudll  mfciat a2tau  oo0teto icils aDumuvs (4aetrmf todfpDranvsls  rtr(m3nodlm n ietltf 2umxr ;o0oleo feiasla elu s (4texomo ootopte ieilt srtoim3no4lmenmfct sfsDrru  oo4opxnmi3iys a2uaumo;(0tltomocoydom r uvsls srxrxm3ou1alenmnvs s) rtm(rono1oleo octydla2el( s;u)aetrmr iadla e u ol( s2trio oodop elnvi ( a2trurpoo4teenmieiydlmDea(mp;t) eerio3totla elieo s)setrir3ou4lptnlfvias arrrxr nu1tlt moetlt m2el( o (0altomfcootfpDrlneils t2uo(rpnu1alt livsa()s2umu  ;u4olx  oetyslaDuau o u0trtnio3oatlpt  ivo (0trxmirpio1oltn fesa(  rur(m ;t4tetnioetltfa emn p;u)treniociytfpteai i;t0 rtrir iydam e nvs ()sDtauro;o1tlx  ociys s elums;t4teenir3oydomt  ivslt0sruo(o no1lp   fvtlt aDuaxmono0opxnmoetldfsDea(ms ()texoio3iytop raivi s0s2urxr3oudlle lnetlt sDrmu o;u1tpto fetyd a rm(mont0 rxnmfcoo1op e ues t  2tmxo iu1lmteliesls srrm(roou4tle mi3iyt m elu pnu0trtrmrctydlm r ieil(  eurxopoydomeemieia(  Drrx ooo1optoioeiad s2uan p;t4tlxoif3oa1op  li s;t0 etrxrpoodol eliesa( srrauro;u4apt mfeilsfm2uan o;(0 exrmocoatlaDrlies t)tetmimpoy4omee fvs (  Dra(rpnt0altniictldla ra( o u4 rxrxocoytlmD li s;s) exr(o3iydoltelnei ( s2urxm nu4aex  ieiytla2rmn p t4 etoxr ootop  aivs ( s2uo(o nudoleemfetasfs2ur(mpnu1oet iociatls uanvpn(4tlerxfciytfptelivi;t) rtmirpoydome lfcs s  Dtm(moot1tpt  fetad mDem(mo;u4treoxr3iatlp ranes (0sruoiopou1lle  nvsa(f Dtaur ot4olxnmfctlslm2rmuvsn() lerxo iotlp rlneols srtoiopiodal nlfcsl() rtaumooo0oeeoio3iydfs2rm( pnt0alxrxociadomDrlu i;()setrxm3oy4oltn ieias)aDum(  ou1aetnmoetydfm2eau s u0 rxrxoctodop e ueilt0 etrxopoodapt mnesls)s2rr( o;o0aetnif3iad a2rluvsnt0arxnmr3tydomD lieo;s texmxopoo1ape mfvs s) Dtru onu0tle  iciad mDemu p;t0 rxnmo3oa1opDrlnvils srtmxr3oo4lltn fvsat  rumu  ;u4alto oetlsfs2raums t)tleoxoctadopDrlnes s)trtrio oy4openlfvsa() Drmxmp;u4apt mf3iytla eluvp t0teenircia1fpDrluvilt)teurio3ny1ol  lies sfsDumur ;u4olxnmieildla emu sn()trtoxr todfp  lnes s0 exmir3iu1lptnmfcia()s2urumo;t4oeeniociad a umu s (4aetrircootlmtrlu ol(  2umxr iydlm  lfesltfsrum( o;o1aexnii3iysfaDrm(msnu0tetoif oy1oaD lnei t  ruo(o ou4amtelies t) rurxr ;u0opxnmf3iasfs2eauvp u0 eenxfctydomDr n s s setmim ou1lpenlieils) 2trurooo1tex ioeilslm2eluvs t0arxomr3io1op e uvo;(  exrxmpno1omen icsl(  2rrurono0aexnifciysfs rmn o t) rxnmr3iotfmte ieo (0 2urxo3iodlpt  feia( a2umu oot4oet io3tytlmDumn p t0trenmrciodlp  lnes;t0texr(r oo4aptn nvi ()s2uaurpot1tpxo f3tydfsDrmuvs u0 lxrmo oadfpD  n s;( sexmxm3oo1amtnlnvtlsfarra(r ot4aexnifetasfsDeanvp;u4treoircootfate nvi (0 2xoimpno1ame  netas)srtax ono0tpt  o3ilslmDrauvonu0arxnmo3to1om eanvsls srtoirpio4aptelivtltf 2rm(mpnt4opt  f3tysfaDuaumsnu)alenxr iadlateaiei s)sexmxr3no4ole mfvi s) rua( p;o1teto ociatfa2rluvsnu)aexrmr3ootlmtr nvi (0t2toiopoy1op e nvt t)aDtau oou4tle iiciydlmDulu p ()teeoir tadoatelneil(0srxoim3ou1llee ivsa(f 2tmumoot1aet mieiatlaDulu o ()alxoiocty1oaDr n s (0 rtrxo3ny4ol nmivtlsf 2trump;u1opxn fetysla elnmo u4 reoxr ta1omDraneolt0s2trir nudlmtnlfcias s2trur oo4tlen f3iltlm emnmon(4trtomr iotfaDe ivs t)seumim3nydame  nvt t) rumump;u1tlxn fciys m2ra( p ()tlenmr totlat livi t  rxoxmpno4opeelnetat srtrxmpno4oeeniictlsfm emnmp;t)aexnxo oy1opt aivi;s sexoim3iu4omenlneil( artau pno1aptomf3tldfsDemnvsnt4 lerif iydfptrau s;()t2tmxo nu1lm   nesasfs2rrxrooo4tex iocild s2emu snu0artnmf3iytfmteanvols)s2xoir3iu4omt lfesl(  rtmxmp;t0apto i3tldfa2ra( o (0 exnmo3to1lp r uvsls0s2urir nydlp emivilt) Dtr(  ;u4teto f3ils m eluvo;t)artnif3ootfa eluvs;t0sexrirpoodame  ivta() 2umxmpnt4ole  fetlsfmDemnms t0arxrir iy1opteai i s0 2umio3io1olte fvi s) rtm( pou0tpeo oeiytla2rluvs (0treoxr3oydopteluvsl( s2tr(m nu4oltemicsatf 2tmxm oo0olenmfcias aDemnvp u4aeeriociydomt lues t0 2trim3nu1lp emfeslt)aDra(mpot4apt mi3ildls2em(vsnu) etnxrcty1lp ranes;s)seurxm no4omen icsa()aDumu o;u0tltnmicils m2umumpnu4 rxomociotlmtr ivslt0srtrimpou1opt livs sfarua(mpnt0optn o3iys m2ul(ms t4 leoxr3totomDrai sls) 2urxrpou1lmtn ieils)sDrrx oot1apx  fetyt m ul(mpnu)tlxrxo tadlpte neo s) etoiopoo4ope  nvilt  Drax pnt0teenmociytls umn onu) ltrmf tydlmt anvols)sexmio3oo4omte ivt s) ruau p;o1aleo feiasfs2rln s t4 rtoxf3oydlpte nvs s0 eurxrpnudamt lfct t arum( p;u4ole mf3ildfs uaums (4 lxoxoctytomteluvsl( s2tm(opnu1llenmnes sfaDum( p;t1opeo o3iltlaDrlnvo;(4 rtrir3ia1fmDr uvsl()trxrim nydlmeelncta(fartrxrp;t4tptoii3ilslmDum(vp;() ltnmo3iytfmteaneo ( sexr(o oo1ame  ictlt arumx o;o1alenifctadlmDelu o ()alerio3ta1la   ivo (0s2xoim3iodap  mivtltfaruau p;u1tpt  i3iyd s uanvs t0 ltoir3tatfpt  i s;s0setoiopiodlle mfcs s) 2uaur ot1aetnmf3ilsfm ua( s;(4trtoircoy1optraivo;s t2xm(opou1omtn nci s)sDur(mo;t4tlxomociatls eau o u)aexrir io1oaD li s s)srtr(r3oydlle lictlt)srurx pou0teenii3tys sDrlnmp;u)trtomr3tatfmt ln s;() 2umim3no4lm e fvta( aDtmxro;o0alxnifciyt m2ulnmo t)trenir oydlm rauvi s)t2um(rpny4lpenmies tfsrra( oot4oeeoiietydlsDelums;u0 etrxr oa1la elues;t0 rxrir3oydaptelnciat)arumxr ;t4aee moetlsls2umumo;u)trerxrcoydlaD  ivs;()seur(r3oy4amte nctasf Dum(rpno4aexnmf3ildfs eanms;t4tlenxf oa1fptrauvolt  2xr(o3iy4opt  ictltf 2taxrpou4ale iicilsfa elu p;(4artrmocootop   n s (  etoxo nu1om n ivtltf ruaxm oo1oetniiciyt s2eau s t4trermocto1lm e ues t0 2xrxm3iudole lfvsltfsDta( ono1alx iieils mDrmumpnt) etoircoydlmD auei;s  exo(mpiu1al   net t)a2taxmo;o4oetnmf3iadls ua(mpn(0 rxomociotfpt ln ilt0 2urir ou1oleemfes t) 2ra( oou0apeo f3tydfmDrl(vp;()arenmrcia1omteai s;t0srum(opoo1lmen feilsfaDtm( ont0olxoioctadlm2rluvs;(0 lxrmo3oytomt aivs ()s2tm(opnu4ole lnvtl( arrr(ro;t0tlenifeiat sDumu p (4 rxnmo3oytlateaivslt sexoio3iu1lp elicilt s2rrx oou1oltn ieiasls el( pnu)tltrmo to1om rluvo s  2umxr3io1amt  fvilt  2uaum nt1oexoioeiyd sDeanvsnu) rtrxf tydomDrluvil( seumimpnodop nmfeils)a2umu  ou4aptn oeiadfsDeau p;t4tetrxo3iatfaDr ies t)trurimpnudlm emfvslt sruauronu0tleomfeilslaDulnmp;u) exomo todopDrauvil(0s2uoxo ny1lle  nesas  rtmu pot0olx  oeiytlm2ean ont) rtoxo oo1fa elies;s) rumio3io1lltemfvtltf Dumxroou0apt  i3tytlm ul(vsnt) lxrio ia1fa rai s;t)t2um(mpiy4lpen icsa( s2tauro;t0tetoioetatlaDrl(mpnt0trenxf3tytoaDe i s;t0s2xo(o iy4ol  lfctltfsrur(moou4tpenifetys aDran p;(4altomo iytfa  livo (0sexmir ou4altnmfcsa(fa2ururo;o0tptomi3tasfm2el(vs t0tlxrir todlmt aivi (0trumxo oy4ale lfvtasfsrtrxmoot4aptnifciyt a2umn o t4 rtnmo3iadoa rlnvi s)truo(rpnydope  nesat  rta(  ot0oltnii3tldlmDeanms;(4 ltrif to1lmD aivsl()teuoxo3iy1ape mfvt tfaDrmxrpou4alenmiciasfm2ua(vpnu4teenmfciytlm eluvo;( teto(m ny1amt mivt s arurxm no0opxnmfcilt a2uauvpnt)altrxr iodlat lieols0trxrxr nudlmee ieiatf rta(  ;o1tpt moeiat aDra(mon(4 etoxo3ia1lat aueil(  exm(r3io1omeelivt s srtmxmpoo4alto fetld m elums (0tetnifciytlaDr i i (0 rxoxrpoo1amtn ncslsf 2ururp;u1olt moctytla emn ont0tltrmf3iydoaDeai i (  rxo(m3no1olt  ivtl( arum( p;u0ope mieiltlm2ean snu0 exrxrcta1lptr u o s0sexoxm ny4al emnvsl() 2rrxro;u0tetomfeiydfm2umumon() rtrxo oatla e ieil(0sruoio3iu1ll  mnesa( artrumo;u1olxniietls m2emnvonu0aexoxr totfp elnvslt)s2toxopiy4lltn nvsasfsrraxr ;t1tet mf3tadlmDuanmont) lenxrciy1lat ln sl(0trtrirpoy4aleemneiltf ruax o;t1aetn ietadfmDem(msn(4arenifctotlm   ivolt trum(rpiudlle mfctlt  rurxmp;o0tltnifeiltlsDrlnmpnt) eerxr todlaD lnvo t0sruoirpnodll emfesa() 2tmx ooo4tlen o3iysfsDel(vs t4altomrcia1fp rlnvslt0 2tmimpiudal e fvt ( s2umxmonu0tlx iociytfsDrmnvo t4 etomr3oodlm e n ilt0t2to(o3iodopenlfvsls) 2tr(r ot4tpt iiciydlm2ul( ont0 etrmocoatfa eaies t)s2xo(m3nu1lmte ivil() Dra(m nt1apt  iciltfs2el( ont4 eenmr todlpDrau o t0seurimpiy1ll   fesas artmxm no4tpto ociltlaDuanvs t0tlxoir iy1lp eanvols0 eurxopou4oleelfvta(fartr(r oo1tpt moetldla uauvsn() renmfcoytoatrlies s0texr(r no4am  mnvi (  ruaxmoou0tet mi3ils aDelnvs;u0texnmocty1laDrlnvi s)s2tm(rpoo1ll nmfcia()arua(mono4aleniiciasfaDrm(vo t4tlenif3iytomDrli o;(0 rtm(m3nudol elnes s) rumu  ;u1tptn ictat mDul(vs (4altnmrcta1lp  lnvo t0srtr(m no1lmtelics sfaDum(m no4apeomoetltfm rmuvp t)texnxf to1lpteaivo s tetmimpny4amtn icsas sDtax o;t0teeo f3ias s ul(vp;t0tltnxr3tatfatrau i;s)trxr(opno1ome mfet sfaDtm(mp;o1altnii3ias s emumo u0trermr ootlpD luvslt t2umimpou4altn fes sf 2rau  oo1opeo octls sDuan p ()aexomfctotomD  ies s srtrxopoy4amt  fci (f rrmur nu4texnifctldlmDumuvp t4aeerio io1fa e n o;t)sexrirpno4am elici ( s2rr(  ;o1tptnmf3iydfs ean snu0tetnxf oydoate uvi;s) 2xm(o iodoltelnct tfa2taxr ;t0aleoifetasfm2umu p;() exnxfctatlmt aivil() rxm(mpio1ol emiviat)s2taxrp;u1tpx mfeias sDulnmo;u4texoxo3oo1oatrlivilt  rumiopio4lm nmnct s  2um(r ;t0alt micils a umnmp;()texrxf iytop  livi;t srxmim3ou1aptnlfeta(fs2ra(m ;t0tet mo3tasfsDrl(vont4tlxrioctydoa rluvi;( sexr(rpiy4op e nesasfa2ra(  ou4tpt mictydfa2el(vont) eenirctatlmD luvs;t t2urir3ny4am emivias  2urxroou4tltomo3tas aDuluvp;()tltrir3tydfatraivsl( seumxo3oy1am nlnvs ()a2taxr ;t4oexn oetlt aDrmumsnt0 ltnmr tytfat livil( teuoiopoodlpenlictatf rtaump;o1oleo fetaslm2rlums ()tlxoir oytlp rlivils)srumxopnu4al   nvtl()a2rmum ou1tetoif3ildfm emnms;()tetoxo3tytlp rlu sls s2to(r3iu4altn fvil(f Drmumo;o1opeoifeild m2ulnvon()altrir3oa1fatrlnei;(0truo(o oo4am e ietl(f rtmxmpoo4ole moetadls ulnvp (0 ltnxr iytfm rlivi;s)t2toxrpno4om n fvia(fa2ta(ro;t1olx  ieiadlm2rl( p (4arxrio3oo1lp elnvi ( teuoir3ou1altelnvilt  rtmump;t1alen o3iad aDeanvo;u4aeenxf3iytfptrlu sl()teto(m ny1al  mietlsf Drm(rpno1teto iciat mDuauvsnt)alxrifcty1lmt livils)trum(opno1om  mnei t) rtr( oou0tlx ioeiys a em(mp;() exoxociy1lm e uvs;t0s2urxo3oo4olt  fvsasf rtr(r ot1oexomf3tad s2rmn s;u4aetoir oatfp rau s t t2xrirpoudalenlictlt)aDtaurp;t4aet  fetatls rmu s;t4alxnmo ootopte uvs;( setrxr oudop nmictas a2umu pou4opt mfeiaslaDel(vpnt0 renxr3oa1lpt liei;s s2tr(mpio4aptnmfvsa(fsrtruroou1aleo oeilsfsDemnmsnt0trermocia1lpt aivi ()tetrim3io1aptelnetat)arumxm ;u0apxn octydfaDrauvs (0 exnxo3io1opD aivolt)tetoxrpou1lp elncsa( srurumoot0olt mfciyd m rlumpn(0 eerxf3oadlm elivils0 rurim3oudop   nci s)s2trx  no1texnii3iasfa2rm(vo;(4altrif oytlatrli s;s  rurxrpiu1lleemfvia()aruaxmpot4tpeomfeiasfaDemumon(4 lxrmf oy1lp  luvslt) etmxm ny1opt lnctlsfsDtaxroot4aetnmi3tld a um(vo;u4 ltnxfcoadoat li o;( teuo(o3iu1llt  ncsls s2umumo;u0apto ociyd s2uluvp;(0alermf iytopte uei t) 2umxopiodomt  nesa() rrmxrpnt1optoii3tldls2rlnvsnt4tetniocoo1fpt  ivo;( t2to(o3no4lm   fei t  Durur ;t4aeeomoeias m2eanvpnu4alerxf3ty1lpDeli s;() 2xoxm oy1lltelfcslt) Drr( oot0aeenmf3iysfm2uaump u4alerxocty1oa  ai ol(0 eum(m nudllt lneiatfsrrrum ou0tpxo oeiytlmDumn s;()alxnio3to1omDeli o t teumxm ny4ap  mncilsfsrra( oot4opxnmoctldfm2umnms u) lxoifciy1fm r ieo t s2xm(o oo1olenmfvtatf Dta(mpno1altoiictatfaDean pn(4alerio oodfa e n slt0 rxr(r nu1amtelfeilt s2ra(  nt0apto ictlsla uluvo;t4 lxnir ty1omt  ueolt0 euoir3iu1lme  feiltfa2ur( o;o4optomfciyslaDranvs;u4altnxrcoy1opte ivs t)setm(r3io4lptnlnvt (fsrtmurpnu4tex mf3tytfaDemu o;u)tlerir3oadfaDeau i t  exmxr3oydomeelieias s2tmurp;o4tpe  ieiadlmDua( p (4tlxoio3to1la eanvi;t) exr(r3nudal n fvs s)sDrmx oot4texoio3tldfs2uau s;t4artrmr3io1om   n i;s s2tr(mpoydam e net sfaDtaxrpnu1tpxomf3iydfmDeln o;(4teeoxfcoatomDraivil() 2trirpnu1llenlics ()srumum ot4tetoifcilt a2ul(vp;u) ltnxf3ty1oat lnvsls)tetm(mpno1am nlict t  Dua(  nu1oee mieiyd a ulums;(4tltrmf3iytfm elnei t seurxopou4altelnei (fartmx ooo0olenmoeiydfm2rlu pn() rxrxf3ta1lpD ln i s  2xm(m3io4lmt mfet sf ruru pnu0tlt  f3iytfs umnvp t)trtrxf3ta1oaD aiesl(0teurimpnodol elfes t)arurxm ou0oeeo fctld aDemumonu4 lxrircoa1lpDrauvs;s) 2tmir3nydlpt lfvs t  2tax onu4apenmo3iltls2uauvp;t0trerif3tydfpDr ueol()srtmxo no4llen fvslt  2rrur ou0alen fciatls ran o t4arenif totlm raiesls)trtmxo iy1lp n nci s sDta( poo0optoifcildlaDuaumon(4tltrmrcoo1lm  lues ()srurxm3nu4lm  mfcia( aDtmxrono1oeto oeias m2eluvpnu0aexomr iytlmDrlnvi () eum(mpoo4openlivi s sDtaxrp;o1olt  f3ilsls2rm(vo;(4 ltrmrcto1latrlneils)t2tmxm3oydomt  fetat)srrrxr ;t4apenioetltfmDuln s u4 rxoio3tytlmDrlieol(  rumxr3iy1omee nvs (fartr(mpou4tlxoifctyt m elnvpn(0trerio oydfpDraiesl(0texr(rpio1ll   fvsatfaDtaxr ;u4opeo o3tlsfsDel(mp;t4texrxfcto1faDe n ol(0trxriopiu1op  miciasfa2tm(ront0ope micild a2eluvonu)tlxrxf todfmDelnvil(0 2urxm3ou4ap n fcsas a2taxr ou4oexnmfeiasls elu ont) reomo tatlpDr nvi;t tetrio iu4lmtnlfet s)sDtmxr no0alx mfciadfs ran o t) etnxr tadomteln o t) eum(mpnu4oltnlnes (farrrxmpnu4oeeo fetlsfm emn p;t) rxomo3ia1fmt  u i t)trumir io1lm e ncsasfaDrrxm oo1optn feildfmDemn o t)artrir to1lmteanvo t0srumxmpiy1opt  nviltfaDrmxrp;t0apxnifeild m2ua( p;t4tlerxo3tatomDranes;( srumio3io4llee icsltf 2ra(mo;u0tlxnmf3iltla2emu s;u0trxrxr iydfpt aies (0trxoxopoo1ol  mivtatf rrm(  no0ape  oetld s rmn s;t)tleoifciotfmDraivsls trxmxm iu4olt mivia(faDrrumpnu0tleomfetatlaDumnmpnt0aetnxrcto1op   iei (0seurio oydlmt lfcsat srra(r no4opxoifciltls uaumsnt) lxoio3oadlaDelnvsls s2trxr3ou1omtn nvsa( aDur(r nt4oee mf3iasla eaumo u) rtoxo oydfptelivil()setm(m io1am emivtas artru pno4oetnioeiydfa uanms u4 eeoxr iatlat an ils0sexmir3nydll elieils)arur(m ot0apxoif3tas aDrmu onu0 lxoircoo1fat  nei (0 exrxm3io1op nlnct (fa2ta( oot4alto ieiat m el( p (0trerio3oatopt anesl(0t2xm(o oudol n nvtat sDtmxrpno0oltnii3tys mDua(vpnt0tetomr iotlptrliei t t2xo(r iu1am  livtat) rurx oot1tlxomociadfsDra( onu4aexrxo ia1lm e i i ( teto(o3nu1ame lfeias)srtr(root4tptomi3iasfs rlumsnu0tetnioctytomte ivo;(0 2xr(o oodaltn nctl(f 2tmur nt4apen i3ilsls ul(mp;t4aeeoircoo1fatrau slt) rxoxo3iydope  nct t) ruaxmonu0tptoiieias mDrau o ()texnif tadoptelnvi;()seurxr3iy4ole lfvtl( a2uru pot0olt moeiasfmDrl(mp;u)alxnifctadlmD  ieols) 2um(rpnudam emfvi (fartmx pnt1aee mociyt m ua( o u0alxoirciodfateaneil()trxmxrpny4lp e ici s) Dumxront0aetoio3tysfsDrlu ont4aetrif oy1lpt lnei s sexmxmpiydop nmncsas  2raumpnt4tpx mi3iadfm2rln on()tetomfcia1fpt  nvo;s0trxrim ou4al nlfes (fsDumxr ;u0apeo f3iyd a2eanvo u)teeomrciydlpD lueo;t  ruoimpoo4al elneils artm(mp;t0oeen oetls a rm( s;()altnio3todoate ieils)tetr(opny1al elfetltf ruaurono4openioeiytfs2uau o (4alxrmo ia1oaD  uvols)s2xr(m3oo1ope lnvi ( s2tmu pnt1oltn o3tls sDua(vs ()trxnir3iadomD aneo () rxmio3nodop  lieilt  2ra(rp;t4aex miciytlmDua(mo u4tltrxocootopD  n s;s0s2to(m3oy4op n fvta( srrr(ronu4alxniiciytfmDul( o;t) leoifciadfateau sls s2xoimpoo4al   iviat) 2tr( pot1tlxomoeiat mDel(vp (0 lermr iotlatraueols sexrxr3iu4aptnmnvt ()sDrru pnt4tptnmo3tlsfs uaump;t4tetomfcoa1fpteluvo;s srtrxmpiodlm emfvsat) 2raumpou0opxn o3ias sDrmn snt0teenxr oodfa eluei (0texo(r3ny1om e nci s  2tau pnu4tpeo i3tltls umn s u4altoifcoodomt  iei;t0texrxrpiodlmte fvi (fa2umx pot1oleoiicias mDuauvpn()trtrio todfm  au ols0setrirpno1lmte nes sf 2uau oot1oexo ietatfs rmnvpnu4altoxo3iy1faDe i slt)srto(opnu4apenlictas srua( onu4optoii3iasls2ulumsn()teeoiocoadfmDrlneo;s0sexoxr3oy1lp e fcs t arrm(rpot4olx mf3iydlsDuauvp;()teenxrcoodoaDrlneo;s)trumio nodlmte icil()sDrr(rp;o1optoifciat m2ra(mo;(0teeoif3todfa   i i (0teuoxr3ny4ameemneilt  2trxmo;o1tltn icilsls2umuvon(0areoxocoatfp rai s (0 2um(r3ny4ole lictatf 2rr(rp;u4aleo iciat s ua(vo;(0 ltrxrcoy1fate i i;t0srtmxm iy4lpeelivtl( a2ra( onu1tpto ictldfm2emn s;(0arxoioctatoa e iei;s)sexrio3oo4lpt licsasfsDtrxrpoo1opxoii3tasfaDuau o;(4tlxnirctadfpt au ils) rtoxo3iudlleelfetatfaDuax poo4alxoiiciytlm2eauvpnu4aetoxfctotfmD lu o;() 2umim io1lmeemnei tfsrum(r ;u0aptomfciyd s2ran o ()aexrmf3tadlpD  u s t)s2xmxmpiydlm emncil( sDraum oo4oee  iciysfaDelu onu)altrmo3iatopD  neils0t2tm(r3oo1oltn ncilt) rtrx oou1apxnioctadls um( pnt)arenmocoatoptelivslt seurim iy1omt  ici tf ruaur ;u0aeeomiciltfa ra(vonu4aexrir ia1fpD lnvol(0texoxr oo1olenmfvi t s2tmumo;u4apxniiciltfmDrl(msnu4teeoxfcootop r u ols0trtrxr iodol n iesa( srrmxmoot0olenioetyt mDrlnvsnu4aetoxfciytop ran s;( teto(o3iu1am emiesl(fsrra(roou0altnifciyslm2ua(mont0tltnxf3todfatrlnvs s  exmirpoydopee fvi t)srua(rp;o4opx iocildfa2ea(vonu4 lerif oatfmt li s t)tetoiopno4aleemfcs tf 2tmxr oo0oee  fcildla2umn snu4artnxociytfmtean o;s srxrxmpiu4ap e ics sfsDtm(rono4oeeniictltlm uln o;t0alxrif to1op elivilt  rxoxr ou4oltelivt t) 2rr(moou1aex iictas s uauvs;t4tlerif3ootfmtrlivo;t0 rxmxo iy4ap  mivs sfsDtrurpnt0tpeomf3ild m2umnms u0aeeoif tytfmteaueilt0s2uo(o3oudal nmics t) 2rmurpno4aleniieiatlmDrau o;u4 rerxr iytoaDraiei s seto(r oo4oltemfctl(faDuau o;t0aee  ieiytla el(vp;u)aeenircoatfa e i s s0srumimpno4ope  ivi sfarrrumpot0texoiictasla2emumsnt4trtoir3oodlpDe n i;(0trumxm nudlmt mfcsa(  Draumpnt4oeenmfeiltls2ean sn(4trtnio oatoa rai o s) etrxo io4op emfetls) rumumpot0olen fetatlaDeaump t0aexnmf iatfmDr i o;s0trxoxm iy1amtelivsatf rra(r no0tee  ociysfmDum(mp;u)tlxrmfcto1lpt anvsls  rxmiopoo1al n ivsat srtmxronu0olt ii3tysla2ean p;t)aetnmr3oydop   nes s0 2tr(o oydole miciat a2tm(  no1tpxn fctlslmDumu snt)arerir3ty1lmt ai ils trto(opiu4amee feiat)aDra(m ot0openifetldfa rlumpnu)altnio ty1lmtr neilt0 eurio3ny1llen ieiat) 2rmur ;u0tleomfctatlsDrauvp;(4teeoxr3ty1lat livilt)texmxm3nu4oleelncsl(faDrax p;u4tltnmietyd m2rmums (0altnxociytfmtr ueols t2tr(r iy4ap e ieia(fsDrm( ont0tpe  oeiatlaDul(msn(0texrxrctatfm r nvi;s  2toxo3no1lle  ncia(fsDrmx  ot1opxoii3ild m uanms;u0 exniocoa1oa eluvi;(0trtmxo oydllte fciat)srtm(  nt1texniieiysls uln p () eeoircoy1lp  an olt t2xr(r3iodale mnvt tfa2tmurp;o4apen ietlsfa2eanvonu0aeerir3oatfaDrlu i;s0 rxoim3oy4om  lietlsf rum( oot4tpeoiieilsfm rl(mp;()tlxrmrcta1lp   ivolt0s2xm(mpoo4ol emncsa(fsDra(mpot0apenmfcilsfa2rlnvs t0teerxo3tydfmDeluvi;t seuoxr no4amenlfcsl()aruau poo1apenifeiydlmDrmnmp;t0tltnmoctydomt  u s;t0t2urio iu1ape lfvsat  rrrur nu0opxo f3ils a rl(vpnt) reomo totlaDrlueo ( srurim3oodlpenlici sfsrua( onu4tlx ifeiyd aDrlnvp;u4 reoircio1fmte n s;t0truo(m3no4lptn netls)srumu p;u4tpenioetlsla2ran o t)arxrmf iodlm raieo;(0texmir ou1al  lietas)s2ur(r ot0oleo oetaslsDran pnu)tetoxo ta1omt au s ()s2umir nudome mivias aDurx pnu4tpeniieiyd mDraums u4aleomrcoodfa rliesls)teuoio iy4alt lieslt) rurxrp;o1tex mi3iyd sDelnmsn(0arxnifcta1la rlnes (0t2tmxm oy4lm emict s)aDumx o;u0openmo3tyt a rmn s t) etomfctotfmt anesls)trxoir3nu1op nlivtas) Draurpot1tptnmfctas s2emumonu0aexoio iatomD li o;s) rtmim nydalt  ivtas  rumxmo;u1ole ii3iytla2rmumon()tltomfciy1opt au i;( s2uo(r oy1am nmietl(fartrx  ot0tlx mi3tys mDuanms;t)tlenio3iodlmDe u s;s s2xr(mpny4altelnvi (fs2rrxm ;u0oeen ietldlmDrlu on() leomf oo1lat anvsls t2tr(o3nu1oltelfviatfsDur(mpno0oexn i3iat a2ul(vs (0trerio3iotoa rln i;(  rxoxr iy1lpte nvs s) rrmxmpou0teeoio3tatls rauvp;t0 exnir iotfaD lu o;s0t2tmir ou1lme lfcsas  2ta(  no0tltomo3tld sDemu pnt)teenif3oytfpD  ues (0 2toio nu4amtelieiat s2raxmpnt0tlxn o3iys aDrlu snu0tltriocoadfpt lueo;t)t2um(r iudap elnctas sDurx oot0aleomfciad a ean o t4aleoir3iodlmD lies s) exoio3io4ap n iciasfsrtmx o;u0oeeoioeild s2eanvon()altrxr3iotlaDelu i ()setmimpiy4ole mfvt s)a2tmxronu0tlt  o3tlt sDel( on()alxnir3io1lp r uvi;(0srxmimpoo4lmee nvt t sDtrx  ot4alxomiciatls2umnvp u4 eenxo tytop   neo;( teurxo iy1amte nesl() rtaur ot0opx  o3iat a2ra( onu0altrxo3iy1oatr ivo s0 rumxr3iu1amte fctat)a2tmu  nu1ope  fciatfsDuanvont4aetrio3iatfmt  neo (0s2xmxr oudapee iesat)arur( pot0tltn i3tatla2emu o;u4trtrmrciatoaDrai il(0teurxo nudlm emneil( arurx o;t4oltn oetltlm2umnvp;() ltoiocty1lateauvi;t)srxrio3iy4op nlfvsat sDra( pno4alxoiociydfmDemu o u)trtnxo iotfpD anvo;s  2tmim3io1am elnvtlt)artm(mo;t0aexomf3tld mDrl(mont0tlerxf3oy1fa eln i ( sexr(o3oodlltelncslsfaDtaumo;t1oeeoio3iyt m um(vp (4 eerxrctytlm rliesls  exmimpnodoltelivtl(fs2umu p;u1aex  oeiat sDrlu s t0arxnmocoo1op raivs;() etoxrpoodamtemnet s artm(mp;u4oeeoioeilsfm rluvo (0 lxnif3iytfatrluvolt)sexrxopou1opee iviasfa2raumpnu4apx  iciyd s rmuvpn()tetrxr oydlaDr uei s seuoxrpiydale  nes s a2rr( o;t4tptoiieildlm uaums;u)aexoxr to1lptraneo;t)texo(r3nu1ol  mfvilsfsrrr(moou0apto f3ias sDrl(mp;(0 lxrxo3oadom e uvolt0t2uoxo nu4omte nvs sfa2ur(roou4olt ifetysfa umnvsnt4alxrxf tadoatelu s () 2urir3oy4ll nlfvil( sDtmump;o0aexnmiciltla2ulnvo u0alxnir oodlatelieilt) 2umio nu1amt mncs s sDumurono1altomoetlslaDulu o ()tetnio iytop  lnvolt  exmxmpny1om  mfcils a2umxmpno1oleomietadfsDrauvp (4teerxrcto1oaD lnvils0 2xm(mpiydol n ictas artmur ;o1opxnmfeiydfaDrlnvp;(4 lenmo3oydfptelnei;s0s2umxo ny1amt lfcs t)arra( p;u1alxnmoeiydfm uauvp t)texoif oy1omteau ol(0setmxm3io4ale lieilt)srurum no0tetoioeiysfm emnvp u4treoxo oodopte ues t0trxmxmpoo1lleelfcta( srrmxr ;o4aeeo fctlsfm emuvsnt4texoifctotlmDr u s;( sexr(mpoy1lp  lfvsatf 2tm(m nu0tpxo o3tlsla eaumsn(0artrmr3tadfpte u o ( trurxm3oo4ol emiei ()srrm(mpot0tetnmoeiatfm uaums;() rxoir3iytoat  i olt s2trxr oodolen iet s  2umxroot4oetnmi3ildla2ranvs;t)tltoxr tytopD auvi ()texr(mpiu1lp elivsl(fsDrr( p;o4tptoiictls m um(mo;()trxnmo3tadfmDrai i t)tetrxr oudapeemnesa() Dumx onu1teenmfciys s2uaumsnt4tlerxo oy1lpD luvi s)srtriopiy4ole  nci s)s2tm(m ;t0oex moeild s2rau p;u4tlerio3ia1laD  uei;t0srtrxo3oudameemfesa( a2uau p;u1tpt  f3iad m2rmnmon(0 rtrio3iodomDr ieo;( srxm(o3no1amenlieia( s2umu p;u0opeomf3iadla ranvpn(0trtrir3ty1lmtr ueo t  etrio oo1lle lnetl(fa2uaxm ou4ape  feils s2rau o t) lxrioctatop  ai i;s0 rto(o iodom   nei ()a2tmxrpoo4optnioctat mDrmump u)trxrir3io1lptelieilt0trxoxm3nu1omenlfvtas) rtaxmp;o4alxoioetyt sDuauvpnt) ltrxf3iatlmte neol(0sexm(mpiy1altemncs sfsDrrxmo;t1opxniiciltfm rln snu4 rxoio oadlpD aivsl(  2ur(r3nu1open ivi sf Dtmuroou4aleoii3iatfmDrln pnt0 rxrxf oatlpDraneo;s)srxrir3iudomtn nctas)sDtr(m ;u0oetn ocilsfmDul( ont0areoxo iydlpDrauvo;s)trxoio iy1lmteliei s arumumont1oee  oeiydla rmn sn(4aexoio iydlmDrli i t trxoxr iy4llt  iesa( srrrurpnt1olxo ietatla emuvp;u4teenircto1fptr uvolt)srxoxm3io4aptelfvs s)srumxront1aetoifeiat mDul(vonu) rxnio3iodfateau s;t) eum(m3io1am elict tf rtr(roou1tlt ii3iat aDemnvp t)trtrmo iytlmDeaivs;t teuoio3nudame lnvsa(farrrxmo;t4alt io3tysfa eln o;t) lxomo oadlmD  ieolt0trxo(rpiydomen fviat)sruau pnt4tptnio3iad s rlu o t0 reomo3iatfaDeli s;s t2tmim3iudomt mici tf Drau poo4oexnmo3tltfmDran s;u) exnmr tydlm  auvs;s)s2umio io4al elici s) Dtrurpou0optnmo3iatfs ul(vont4trtoxrcoatlpDr neols sexoim no4lm e nvsa(fsDrmum no1apeo fetas s emnvs;u0arxnxf iodom elnvs s)t2to(r3ou1oltelnetlt)sDtmx  ;u0oeeo ociydlm umu p (0arxoif3ty1la  luesl(0trxrio io4omt lfcsas  rtrur ;t4apen iciysfs rm(vp (0tetrmr3tatla rlivslt0 2to(m oy1opt mivtltfaDua(r ;u1aet moeiaslaDra(vo u0 ltnmf3oodfpD anes t0seuo(m3oudomenlfeils arrmxr ;o0alxnmfetydla rlnms (0 rxnio oadfm elnvo;t0srtmir3ny4apt mfes ()s2ururpnu1apxn o3tysls2el( s u) etnxr3oa1faDr uvs t  ruoxopiodol emfetl( aDtrxroou1tltoiieiytls ra(vsn(0 etrxf oatla ranei;( s2trxm3nudaptemneils aDrm(ro;t0aee mociatla2uluvp;t0 eenifctytlmDe ueo ()t2umxm no4omtn nesls) 2rrx oot4oet io3iatfa em( s u0texrif ty1op  auvo s  2urxr oo4lmtemicilt) ruaxro;u1oetn ieilsfmDulnmp t) lxoir oadfatr iesls  euoxr io4am   fctlt) rrmx pot1opxoifctldfs ul( pn()trtrxr3iy1fpDrlnvi () 2tmim oudlm emies tfs2um(mono0tle iociasfs2rln sn(4tltoxf3iadomD ln i t)sexoirpou4oltemieslsf 2umxm ;u0teen fciasfs2umnvont4trtomf tydfaD luvi t  2tmxrpoodomenlieta()a2rmu pnu1aetoiieiasfs uaumpnu4trtoio iydlaDrai o ()sexm(mpoydll  mivtlt sDrmx p;u4olxo ieils sDumumo;t)alxrir iodomtr uvolt0teur(r iu1opeemfesatfaDtm(r no4tptoio3iytlaDuanvpnt4 etnxo io1om  aiesls0 2umim ny4omen ietl(f Duaurpou0aeeomi3iytfsDulnmp t4artoxrciodlmtean o s srtmim oudll e fvt t) 2umum ;u1texoiocildfa el( p u)artrxocoa1optrln s;s0s2tm(m3iydll  micilsfsrum(rp;t0aetoii3tydfmDrlu s;u)tetoifcia1fm   i i;t) 2trxopiydaptelnvt ()a2tmuronu0ope  i3ild aDraums;u4tlxnif3todoaDr ieslt) rxo(r3iu4lptnlncslsfsDtmxrp;o4olt mfctltfm rlums;t4aexrir iotlpt li ols) 2tr(o3io1ol  livta()a2rau  no1optn ociysfa2rlums;t)tlermr3oytfa r u ol(0 eurxr nodomt  ivtlsfsrtrumoot1tlxnifetysla2emnvs u)artrxo3oodomt lies;(0texr(r oydal emnviat) rur(mp;t4olt moeiaslaDum(mp;u)artoif3ia1fa e i ils  exr(mpiy4omenlnvi s s2umum ot4ale iieiatlm umu o;()texrio iodom eaneo;s)sexmirpno4lmt  nviat a2ur(r nu4aet io3iysfsDrmnms (4arerxf ty1oaDran sl(0srxm(r3oudopteliviat)aDuaxrpot4apto ociysfa umump;(0arxrifcto1fateluvo t) 2uoxmpny1opeelfcta() rtmxm ;o0tpe  feiltfa2uan s;(4aeeoio3oa1faDran ols)tetm(m io1oltn fcsatfarrmu o;u0open i3ilsfmDrl(vs u) rtniocio1lmte n ilt0 rxmirpio4omt  nesls a2ua(mo;u0tpt mf3tasfsDuanmon()trxrir3tadoa rln i ()trumio oudlltemivi tf Dumx  nt4altoioetadfmDean pnt4alenif iotfaD aneo;s  2umiopnudope lfcs (  2rmxmpot0tlt mo3ilt sDel( p () rtoiocoatoa  lu s;s  rtrxr3iu1aptelnet (  rumxmpou1opxoiociad sDrl( s;u4tltrxfciytfa eaiesls setoxmpiydap  mies t  Drrumooo4apenmoeiadfa rlu pn(0 rxnmrciydla elneols0setm(rpiy1ame liesls sDuau o;t0tle miciasfs rauvpn()aexoxo3oodlateliei;t)srxoio3ny1lp e nvi t sDtrum ;u1tlxnmf3tasla2elnmo;u) reniocoy1fmDrlneils) etoimpoydlmtnlnct tfaDur( o;t4alxn oeiasfmDrln s u4aexomfctodomte u sl() rxmir iy1op  mfvtasfarum(  ot1aee moctatls2ua( onu)aeeriocootfa rlieo t sexr(r io1am nmfei () Durx p;u0oeen ieiad m em( snu)alxrmo3tatlmDr ieo t)s2triopio1lp emfeias) rrr(ro;u0tltn fctytfmDea(vs;u4 rxrxf3iy1lpDeanvi;(0srxmxopnydameemietasfsDrm( p;t4alx  fetyt m2eau s u) lenxfctotomt  uvo;t0t2uo(o3nudam n ivia(  2rr(r nu4apxomi3iasfm2ulnmonu0alxoifctotlm   i sls  rtrimpoydoltn icslsfs2tmxrpou1tpt ifeildfs umuvo;t4tleoif3oa1lm  lu sl(  2uoxrpou1ole  fvs ()aDra(r nt1oexnmfctas sDrauvs;t0aeenirctytfm elu il(0srxoio oudom  livtat arra( o;u4opeomo3iltfs2eanvp;t)alenmfciotfmteai i;(  exoio3iydamte fes s srra(moot1texomfciasfmDemn pn(4tlenif ta1fpDrlueilt  etmxopiu4aptnlnvsat  Dur(mpnu4oex iictatls uln o u)trxnir io1fmtr u s;t) rtr(opoydop  micsl(  rur(roou1ole moetydfsDum( o u) eeoifcoatfmteaivs s)setoir3nu1am   iesasf 2tr(  ot0aeenmietytls ranms;(4trtomo3ootoa elnvi s sexmxmpoudap n nei t)sDrax  ou1texo ictysfs2rmuvon(4arermfciytop   uvs t  2uoxm iydalen fcs t  Durumo;u4altn oetlt m ul( pn(0tlerxfctadoate ueol(0 etmxmpou1llt  iviasf rta(r oo4oee miciyslm ua(mon(4artomr3oy1lpDr nvs;t0srtmxrpnydolt  fet s)s2uax onu1oltoiictytfa uau o;(0 eeomo3tydoat auvsl(  2xrxr3iu1omee ics s s2urxrpoo4apeoif3ilsfaDrmnmsnt4trtrmr todlmtranvil()t2xo(o ou4lp emfcil(fa2uru oot1oexnmoctad aDua( s;t4aeeoif3oydlpte ues s trtrim ou4lmtelfcsl()arua(ro;t4altoif3ildla eanmo;t4arenif iytlaDelnesls trtmxo3oodlmen nvs () 2rm(m nu4alxn fetadfmDeluvon()tltrif3tydlat  ies;t)s2umimpoudlme mieil( arur( p;o1aleo ietad aDeln s;() etoir3ta1fmDeanvo s0 rumxm3no1am nmnctas a2rmu  oo4opt  i3iadfaDrauvp;(0 rtnxf3ia1laDr ueo t0 rur(r oo4al e ieias  rtaxrpou0opxoiieilsls2emu pn()tlxomf oytlp r neo;() exoiopoo4lmeelict ( aDrrxr ;u4tptoifciatfm rl( pnu4texrxo3iodlmtrlieo;s)s2urirpiu4am e nei (  2rmxr nt1tpxomf3iydfa ulu o (4aexoxfcoytlmt luvs;(0 rxm(r3oo1ap emfet (farta(mont4aetn f3tydlm elu pnt4tlxnir todfmtelivi s) 2tmir no4omeelfcilt)sDurumont0ale iieiadlm2uau on(0 lxnxociodoptrlnes;t seum(m nydlm emfvia() 2taxm oo1tltoii3iys aDrau p;t4 leoif3iotla rai sls0srxmiopoodlm   nvslsfarumxmo;u1tpt mo3iydlmDulnvont)teeomo3to1oat an ils)trxo(opoy1alt  feias  rumu onu4olxnmoctadfaDem(mp u4tetrio3oytlaDr nvi t  rto(mpou1alt  ivs t) 2urxrpou0oexomo3iat a2ulnvs;t4 rxoxf ootlaDelivs s)seurirpiudlmeelncs sfs2urxr ;o4aexo ietytla ea( ont0 lenmr iotlmtraieo s srxoxr oudopenlfesatfa2rrump;o4tee iocildls elu on(0alerxfcoydop e u s;t0trtoio iy1optelfcsl( s2rru pou4opt mfeiltfm2ea(vonu4tltrif oy1opDrliei;()t2trimpiu1alt  ivslsfaDtaxm no4olt mfciyt a2elumo;u0 ltoio ia1omDraneil( s2xmxmpny4al emieta(  Dtau ono4apxoii3tytfaDua(mp;u0aexomo3iy1laDean i t  eumxmpiu1am   ivtasf rum(m ot4aexomi3iys s rm(mo;(0texomfcoodoaD ln ol(  euoxo3iu4apenlfeilt  rtmxmont1aptoiocild s2elnvo t4 exoxf3tydfmDeai ol(0 rtmim3nu1ap  lies (f 2um(  ot1tpt mieiysfsDemnmonu0 lenxrcta1oa e nei (0sexmir iy1oleelnci (  2tmu ono0apxn fctad m2elu snt0 rxoxf3tadopD  neo;() exmxr oo4omtnlics () Dtmur ou4oetnifeiys aDumu o ()aeenmr io1faDeanes;( trtoir oy1aptnmieslsf rrrxrpnu4teenmoctldfm2el( o;(4aetomfctatfatelu s;t)s2toim nodop   nvta() rrrur ou0aex mieiatfsDelnvo;t4aexnxf3io1fpDelueol( s2xoxm3nydameeliet t)a2um( p;u4alenio3iad a2em( p u)alerxf3iatop elu olt0trtoio3nodlpenlncil(faruaxrp;u1aetomi3iadlmDel(mp t4treriocoodlp elu i t0texm(m3oy1ame mnvtat) Dtm(mp;t1tptn fetysfs ean s ()aexoio3tadop   u s t)texo(opiu1lpeemnei tfarrm(ront4oee io3iaslm ua( s;(0 exnir3ty1opDean ol(  rxrio3nydole mncsatfa2ururpot1oltnmieiyslaDem( sn(4arenmr oodoaD ln o;t)srtrimpiy4ap e ncils aDrm(mont0oex  f3iadlm umumo t)tetoio oo1fmDrlnei;s0srxr(o3oodopen iei tfs2tm(rooo1ole  fcildlm rlnvs;() reoxr io1la ran s;s0trxoirpnu4lm emfcta( a2taxm nu0tet miciatlm ua( onu4 ltrmo3oytfp r ivi s srxm(o iu1llte iviatfarurumpoo0aetnmoeiat m ulnmo;u4 rxrif oo1oa r ivs t  eurim3no1llenlnviatf 2ra(  ;o4apx  fcias m2ra(vs;() eeomfctadomtr u slt  rtrxm3nu1lptn nctatf 2tmx pou1apeo ieilt a2eln o u) lxnmf oytoat  n slt0texr(m ny4ape  fcta()s2umxmpou0tpeomociasfa2rlnmsnu0 lxoxo oydla ean s () rtrio no4al nmfetls  Drrxm ou0oltomi3iatfs2elnmo t0trtrmr oydfatranesls s2tm(r iudllenlnvia(fa2rrur no1apx mo3ilslsDulu on(0artrir3tatoaDr ueols  2xrxr oo1lme mncsat)aDtrum ;u1tlxoiieils aDeauvpnt0artoiocio1faD anes () eum(r nu4ale lfcslsfaDumump;o4aex mi3iasfmDel(mo u)teeomo oatfmDrau o s trum(o3iodaltemnvsa( s2tm(mpoo0oet ifeiyt m rl(vp;u0 rtnmrctadfm rln ol() rxmirpio4alee iesl()srrmx  ;u1aexnifetls aDelumon()alxnxo ta1op raueslt)s2xo(o3oudope licsls s2ra(rp;u4ole ifciadls elnvs;t4aeeoif3iadopDraivs s  etoxm3ou4ameemnesat)s2tr(mpoo4opxomo3iydls umumonu0alenxf oy1oat anvi;t)t2xm(r oudopt  nvslt)a2ur(m ;u0ole ifctlt m2ra(vp;u4 eenio iadfaDrlueols0s2xoirpiy4op   fvs tf Drmu o;t4tex mfetys sDelnmo u0 renio3iadfp   neo s)srxr(o3oodllen fcilt  Dur( pou4tpeo iciatfa emu p;(0 rtoxo3oy1fpDran o ( srumxr3oy4omtelfcias)a2ta(r nu4oltnioetlsla eln p;u4altoiocoo1fpDe neo t s2ur(o iudolte fvtasf 2rr(moot0tee  o3tydlm rlump (0artnxoctadlmt  n s;s0sexoiopoydlptemiet sfa2rrurooo4altoio3tadlaDrmuvsnt) exoio3to1lm   ivs t0s2trxr oy1apenmict ()aDtr(mo;o0aee  fetyt m2ul( o;t0 lxnxr3oy1lmteai i;s0s2xm(m io4om emnci t  2um(m nu4openmfeiydlm emnmp u)texnxfciydop  luvsl(0srxr(o3oydlmt  fes ()sDrmxrp;t4openioetydfa2rmump t4trtnxfcia1fm r u s;s  2xmim ou4ome  neslt)a2ua(moot1tlt iieiadls elu on(4aexnio io1fa eli o;t  2toimpny4ole mfci s a2um( onu1oexn i3tyslaDra(vs;(4aleoxr3oo1fpD aneil() rxr(r3no1omtnliei (  2umx pot0oee mf3tld aDrln p t0texrio oy1lat anvi;()t2uriopny1alt livtasf 2tax  nu4aexnmfciadfm2umn on() rxnirctatlpt lu il() exr(m no1opeelnvtas) Drmx ooo1oleo ociadfaDul(vpn()altnmr iatomDrauvs;s)t2ur(o ny4lmee icsa( sDraum ;o1optoifetat aDrl(mp u) rtnmo ta1fpDelieils) eto(mpiydlpt mnvsat arta(rpnt4apxnmfeildfm2raumo;(0alxrxf3ia1omDrai ol( s2uo(r3ny1apt mivsa( aDrm(  nt4oee mf3tydls2rlnms;u) rxoirciydlaDrlues;t trtm(m ny1openmfctl( s2rm(rpno4olen ictld a2rlumo u0arxriociy1om ranvils0 2toxm3oodalt lnvsas  rtr(moou4oexo icias m2umu s;u4 ltnxo3ta1fa  lueil(0s2xrxrpou1lptelnei t aDta(mp;o1alxnmfeiyslm rln o;(4artnxrcta1oatraneslt0 rto(m3iy4amt mfetls)s2umxrpou1aee  ociadfm rlnvp;t) etrmf3oatomD aneilt)s2urir ny1apt mfetl()a2ua( p;t0opxoifcildfsDrmumo (4trxomfcty1lmD anes ()t2umio nodom nlfes sf 2tmxrpot0teto ociadfa2ra( snu) exnmrcty1fpD lu ol() rumxm3io4aptn ncta( a2tm(mo;o0tltoif3tasla ea(mpnu4alenirctydfa e neo;s s2umxr iy4l
\ No newline at end of file
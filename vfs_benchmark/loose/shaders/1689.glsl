@@ -0,0 +1 @@
+u s (0 2toirpoo4amee nesls) rtrxmoot0apxo ieiydfsDrlu p u) leoir3iodfatrli sl() eto(m3io4lmee netltfaDtmurooo1aeenioctyd s2um( o;(0aexnmr totop rauei t)t2tmimpoy1op n fes t srta(rpno4aeen iciys s2ranmont4aetnmrcoa1fate i s;(  2umio nodlp nmivtltfarururoou1opt ii3tasla2el(vp u) exnir iotopDeai s;t0teuo(rpno4lmeemnvi ()aDrmu  nu0aeenmo3iyt s2uluvpnu0 lxoio3todfa rliei;t) rto(r oo1am nmiciltf Duaur no1oet  fciad aDelnmsnt) eermo ta1lpD aies t) 2trxr nudll nmnetltfsrtr( oot4aptnmfeiytlmDran sn()trtnircoatlpt auvolt)teuoxr3oy4ape lfctasfs2taxmont4tptn fcild a2ra(vp;() eeoir3io1lat  i i (0trxmir ny1am n fvslt)a2tmum ot4ape if3tydfa2um(vs;t0texoio iydlp r u slt t2xrio nu4aptelnviltf Dum(rpnu0olto f3tydls rlumpnu0aexnmr3oydlatrlivi;(0setr(opiy4om  lnvt ( a2raxrpou0aexnifciat a2em(von() exnmf tatla  ai o ( setm(rpnodopt lncilsf 2rm( o;t4tpe  feild s2ranvp (0 rtrxr totfat lnei;s0s2urxr ou4lptnlnvia(fs2rmx  nt4tetomf3iltlm2rmuvpn(0 rtnxr oy1fmtr n il( seuoio oydlltnlnetl()sDrmur ;t1apxn o3iad a2uaumonu0 exrmf3oodfp rauvol() rxrimpiu4amtnmfct ( srrmxmoot4ope ifeiyt a2elumont) ltrmfciytoateaiei t)s2xr(rpoo1lm  mnetlt aDum(r ot4aet if3iat a2uanmo u0 lxrio oatopD an o;( s2umxopoydal nmivt sfa2rm(mo;o0oleoifciad s eluvsnu) lxnxr3oodlatelivi s)srtoxmpnudomenmnet tfs2rm(rono4tpt mfetasfm rm(ms ()texoir to1fp rli ols  2xoirpiydal e nesasfa2rmu onu0tetnmoetatfm eanvo;t)aexnxr tatfatranvslt)s2uo(o io4lme  fvia()aDum(mp;t4aexn f3iasfaDul( ont4 lxrio3todom r u i s)s2xmxrpnodlptelictlt)artmxro;u0apxomfetydla eau o u) etnxo3ta1oaD ln ol(0 eto(o3ou1ap e nvils)srrr(m ot0tptn feiydfa2elu on(4trxnxf3tadoa ranvo;( texmir3io1optnlfeia()sDrrxr nu4oltnmfctltlsDrmuvs u)tltnif3io1oaDraivi;t teto(mpoy4lm e neia( artrumo;t0apx ifciaslm2rmnvon() rxrmocty1faD  n olt0sexm(r3nydlptn nes (fsrrr( pnt4ope mf3tadfsDrl( pnu0 rxrif3io1fm eanvsl(0s2xr(o oy4altnlicsl(fa2uru o;o0aetn i3ias m2umn pn(4 renmociytla rln i t)sexoio3io4om nlicil(faDum(ro;o0aee moeias a ean o;u) eermociadfa eaues;s0s2xoio3nu4amee ncsas  2uru p;t1tlt if3tydfa2rluvpnt4teeomr3ia1fpDr u s t)sexm(r3oy4ll   neslt  rrau p;u4tlx moeils a2uau p t)arermrcio1fmte n o t trumim3oy1al  mivi sfsDumu poo0tee ifctyt s elu p;u)aexrio oatomteaivs ( s2tmir3iodlm  lfctasf rrm( ooo0oexnmictyslaDrmnmp t4 eeoifciotoaDranvo t0t2xo(o oo4lmen fetat)a2rax  no4tptoioctytla rmu snu4 eeomrcoo1fpD li o s setrxr3oy4llen icias)a2tm(rp;t4altomfctysla ean p ()tltrmocoy1lm e ueo;t t2um(r3nu4omtn nes s  Drax  ;t0altomiciatfsDrlu o;t4alerio3iotop e ues;t0 2uo(o3iydol n iet t) 2urxr oo4aptnif3ias sDeln p;t4tlermrciytlm  aueilt  etrxopoodam nlfcsat)artau  ou0ole  f3iasla ean o;u4trxnxfctatfmtr uei;()srtr(r3nodoleelfes t)arrr(m ;t1ale mo3tlt s2um( p;t0alenio oytfm  an i (0s2toiopnydol elnci t) Dumx  ou0opt  i3tysla2eau sn(0arxrirciodoptrlies s0setrxo3oy1om  lfeiatfartaxr ;o0oet moeiltla2rl(vo;u0alenir3oydop r ivs (0sexoxr3no1lltelivsa( srur(m oo1teeo ieiasla2em( o u)tlxomr tatoptrauvolt s2tr(r3iydamte ies s)a2rm(mpnt0aeen iciys a2umumo;(4aeeoxfcia1opDrlieo () eumim3nu4apenmfeiltfsrrm( o;t0alxo oeiytfs uanvo;(4arermfctotopDe ieo;s)sexoxo3iodoleeliesa(fsrrauroou1ole moeiyd s2umnmsnu0 ltrirctotlp e nvil() rtm(opiu4aleemneslsfsrua(  ot4oleo o3iytfa2ea(vp;(0alxnmf oydoaDrlu ol(0teur(rpoodop  lncias  rraxrp;t1optnmoetlsla um(vp;t0arxnmr iydlptelneo;s0trtrxmpnudlmeemfvtl()sruaurpnt0tleoio3iyslaDul(mpn()aetnir3oydlm rlieo s  eurxm3iydlltn fcta( arurxmpoo1tet  feiasla uanmp;t0tetnxr tatlpDeaivo;s) rxoimpio4llee neils)srrmx ont1tex ioetytlaDrmn p (4areoio iydlmteanvi;( trurxm nudlptnmnes s)s2raxmo;o0apxn ietldfs ul(mo;u0tlerxr3tadlm rli s t)s2uo(r3nu1ol  lies (f 2taumo;o1tlx mocilslsDuau ont0alermocoatlm r ivo t) rurxm ou4am n fcsat)a2um(rpoo1teen ociltfsDrlumpnt0trtnircoadomtran o;t0seurxo3ou4ol emfeslt  2uaumono4oex  ictldfs2elnmo (0aetnxo ty1fmtr u s;s0s2xriopnu4om nmiei s)aDtrxmoou1ape  o3iadlm2rl(vont)texrxrcoytlmDe i i s0 rxrirpoodllt  nvslt)arra(ronu4tpe mf3tatlm2rluvont0teeomo3oy1fm rau s;(  exmio nu4lp nmnet s arrrx poo0oleniiciaslaDemn pnt)alxomociydlmD anei t0seum(rpoo1lltelieil() Dtr(mpou4aleniictldla ua(msnt4aleomo3iatfpD  nes t0tetr(o3nodoltemnctlsfa2rrumont0olt mfeils m2rmuvo t)treoxocoadfp rau i t)srxrxr3no4alte ncsas)s2rrxmooo0apt mocildfsDul( onu4 exnxo3oytomDrluvo t  2toir3oydol e ivils)srurum no4oleo fctadfs2ua(vs (4arxoir3oytfpD  n il() 2to(rpny4lltnmfvtl() Dtru oot0aeeoifciltls2uan s t4 exrxocta1la  lieils0 exoir3no4ope lfci t  rumxmpou1optniociatfa2ul( s;t0 exnir3oadoaDrauesl() etoim3ou1lptnlfvt s s2tm( o;t1aeenmo3iytlsDuanmp ()alxrmo iatfmtrlivols texriopnudlmt  fesas)srua(ronu1opxnmociad s uln s;(4 ltnmrctytlmDrai i;s) ruo(mpou4oltemiesls) 2tmumoot1tlxn ocild s2emu p;(4alenmr oa1opteluvsls0seurxrpnu4altn icsatfsDrru pnu1opt iictls s rm(mo;(4arxrxo tytlpte ies () 2uo(o iudlpt  fei (fsrtr(m ot4oet mo3iytla2uluvp;u0altoio3oadfa elnes;( s2tm(rpoy4open ncilsf rrrxront1olxnif3iydfm ean o;u4 rxrxociadlatrln s s0t2xmim oo4amte ivil(f rtaxr nu1alt  iciydls2um(vont0trtomf3to1optrlueo (0 2xmio3oy1omenlietat)aDtr( pnu4aex  iciad a emn on()altnxf3oadlmt  uvo;t  rxr(mpny4optnmfet sf Duaxro;t1tpxniiciltls rm(mo u4 rxoxo iatfm rlivo;s0 exo(r3oy1lm emfei sf rrrx ont1aptoio3ilsfm2rm(vpnu0tetrxoctatlmtraneils0 rurim3oudalenmfvt s  2rrur oo4olt mfctyd s uanmpnu4 etrxf3to1fpDeauvs s seto(m3oydol nlneslt)aDrru pno0oleo o3tytlm eau o u)aeeoxo3tadla e i s;s sexm(m nu1olee ncs (  rtmxrpnt4aleo f3iltlm ua(mp (4areoif3ta1fatrau ols) 2xmxo3iu1amenlfvilsfsrrr(r ;o0alt mf3iysla2rln o;u4artnmr3oy1faDr ivi t0 rtr(r3no1llte iei tfs2ta(  ot0texn i3tad aDuan on() leomo3oatfaD auvo;t) euo(o no4opee nei t  Duru o;u4opeo ociydfsDrluvo;(4teeoif3iodfpt  i i ( s2trxo3iy4olenlietlt) 2umxront4alt mo3ilsfa2ra(vs;u) exnxrctatfp rauesls trxo(r iu4lltn net sf 2rmx  ou1oee moeiysfa2rlnvs;t)treomocoytfmDeluvi;( sexrio nydlm nmfetlsfartrxmoou4aet  ietas m rl( ont)trerir3oytlmDrluei;s  eurirpnudame lfvils) Dtr(root1oet iieilsfmDua( sn()aeenxoctydlmtraues;t  2umim3nodomtemfeiasfsrumxm nt4tpeomiciytla2em( o (4alxrxo i
\ No newline at end of file
@@ -0,0 +1 @@
+nvilt  2uoiopiy4alte fvs (  Drmu  ;t0aetomf3ilsfa2ranvo u4trtoxocoytfmteluvsls0s2um(r oy1ll n iciltf 2rm( pot0ape if3tytfs umnms t)arerxociydla e nei;(0srum(r oy1lltemivt sfsDum(r ;o1aexnmfeiys a ulnvs;u4aexnifcto1oaDr i s;s) 2toxrpoydllt  fetlsfa2tmx ooo4alenmo3tltfs rmumo u)tlerir3ootlmDrluei (0 2urio3no1apeelici sfaDrrumpot4tpenmoctys s2rm(vs () exrxo3oy1lp rau ols0 2xrxr nu4om nlnvtasfs2umx p;o1alxomoctasla uan onu4alxoxfciydfmDe n ilt)t2xmxopoodlmtnmnvsl( s2rrx pnu1oltn fetys a2rlnvp () ltnmr3tadfmDrlieo;( texrir3oy1ope mictlsfaDraxroot1alto i3tat sDrmumpn(0trermr3iadlmtraueo (  rtr(m3iydoltn nctat) Drru  ;t0tlx  ociaslsDrau pnu) rtriocta1fp rau i;s)s2xmxmpiu4ap emfesl( s2rmu  ou0opxnmo3iltfs2ean s;(0alxnxf iotom eli ol(0 eumxmpiydopee ncsasfaDumumonu1apto oeils a2rlumo;()tltrmo3iadfa  aivo;(0 exm(m iy1amee ictl()artm(  ot1tet  iciyt sDua(mpnu) exrxr totop eaieo t0setoxmpny4al elics tfs2tru poo0olt ifetldls2eauvp;(4aexoxfcoodlaDe ieolt texrxopiu4lm  mfvi (faDrr(mpoo0teen fcild a2ra(mo;()aleomf io1fmDelues t  etrxm3nydalenmnei ( s2urxmpnt0oeenioctat aDrln s u)aeenmrciatomteaivs t t2tr(o oo1om  mnvs sfa2tmu p;t1oetn o3ilslsDeau s;t0tetomrcoo1lmtranvo;(  eurxo oudomte fvs t) Dra(mp;u4tpxnifciytlmDea(von() reomf3ia1fateliei;s0 rxoxo3iu1optn ncs s aDtaxrpnt1tptoiociltfsDemn s;t0trtnxr to1laDr i ilt0 rxmxm iydlm n nvt ( s2tmu pno4tet ifeiasfa ea(mp (4aexrxo oy1lpte nei;s srur(opnu4om  lnetl(fa2uaur nt1alxnmo3tltfs rl( o t) lenmf oo1om raueol(0srtm(r ou1apenliei t sruaumpnt0tet iietasfs2emums u4trtomo ty1op eai o s)s2uoim oydomeemfetls) rua(ro;o0oeen f3iadfa uau o u0aexnmf iydlpD au i t)t2xoiopnu4ll nmnei t aDrmur ou1altnifcild m ul(vp;u4artomfctytfmD anvs;(0trurxr3oy1om emfcta(  Draxmp;o0tpxnmfciadlmDrluvonu4arerio3io1lmtr n i;()texmimpoudlptnmfci t) ruax ono4opeoif3tasfaDrau p;t4aexnxf oa1om ran il()trtoir3no1ole  nci s  Dtrxrpno4tlt ioeilsfs2umn p t4 ltnioctatopDr n i;t0t2xrxo iudapenmfetasfa2uaxmpot1altomociyd s2rlnms t4texrxo3iatfpD livs;s  exrxo oudamee icslsfsrtmxroou0oeeoioeiyd s2ea(mp;()tetomrctotfat  nei s setoirpoy4ope  icsa(  ruax  oo4texomoetysfs2rau p (4arenxo tytopDe ivol( tetmxr3iu1openlicsls  Draxrp;u0apxniieiltfm2umnvsn() eerxo totom  lnvs t  rto(opoy1am n fvsa()s2urur ou4tpx if3tltfm2emu pnu0tlenifciotlpte nei;()srumxo3no4lptn netlsfa2tr(rp;t1opto f3ildfsDuau p;t4 rtomfctodom  lnes ()s2xrio3oo1lm n fvtl()a2urur nu4alxoioctadla2eauvp (4 eenif oatoaDeluvi (0trxrim oy4lpee fctlsfsrrmu ono1tee  f3ilt m ran o u) renmfcoatfm eli s (0srxmxm3iodop   nvtls)aDrrx pnt1texnmociys a2rmu s u0aexrif3ootop rlieol() exr(o3iu4olte ieiasfsDrm(mo;u4alt  oetldlaDem( s;()tetrxf ootlmteai s (0t2xm(rpno4lp  lnctl() 2tau p;t1tex  i3tldfmDemu s;t)altomr3to1lpDrlueslt) 2tm(m io1ameemict s) 2ur(mo;t1apto i3iasfs umu p;t)trxoxr3tadlmtr u o t) etmxo3ou4llee nvsasfsDrrxmonu4aptn fciasfmDrmuvsnu) eeomf totoaDrlivi s trtr(r3iy1ap  lnes t s2uaumoot1alx mfeiytls2ulu o;t) etrif3iy1fpt  iesl()srtoxr3no1ameelict t arrrxmonu1ope iicildfm ranvp t4 ltoircia1opt li s s texo(mpny1lm emfctlt  2trxroou0teenii3ias s rm(mp;u0aexomr iatomtrai s ( s2umxm no4lltelivils)s2rr( o;u1oetoiiciydfm2rluvsnu0 leoxfciotoaD ln i t0t2tr(o iydlm  mfvt t  rur( ono0oltnmfciydls uauvp;u4texnmocoa1fpDeli ilt t2tm(m no4lpe livtl()sDumx  ;u4aex micilt s2em( p (0alxomo3iy1fmDe iei s sexrxopio1aleelics ( aDtmxroot4olto ictld a2ulu snt)tlxrir3iotfp eaneo ()seuoxrpiu1lmenlneslsfs2trxmonu0tpeoii3tydlmDem(vo;u4trxomf tadfmtr iei;t0 etoio nu1am e fvslt)aDur(  ;u0tpt  octyd sDea(vo (4aetrmf ia1opD auei t0sruoimpio1am n fcs t a2tm( p;o1olxnmietadls2umnvp;t4alerir3tytomDe nei;s texrir nu1openlfvsat)sDtmu oot0tlt  oeiltls2elumpn()altrxrctytfmtelnvsls0teuoimpoodol nmnct s)arur(mo;o4opxn ietldfsDum(vs;u0aetnxf3oo1fa rlnei;s0srxr(m3nu4lmt  fvta(  Durxm nu0tptnioeiyt s2ran s u4artoxo3tadfmDe uvo;t0trxmxmpiu1opt mfvt s s2raxmono0tltn o3ilt m em( o t)aexnxr3iy1om  lnvs (0 2toxr ou4lpee fei s s2taxmono4aexniocias m2eauvont)tltnio3todlaDraneslt0seurxo oodolt mies ( aDuru ono1tlxn i3iltfm rlnvp t)aexnxr oy1fat livs t0srumir nudoptemiei s s2ur(mo;t4teeoiieiasfa2umnmonu4altomr3ootlateaivo t  2xriopiodolte ivslt)sDurxr no1olenii3iyt aDemumsn()areoxrciodlmDrai sls0seuo(opoo4op  mivs (fa2urumo;t1ope  feiyslm emu p;t)aeerir ta1fa e uvs;(  rur(o oo4ll  lnetlt sDrrxro;o4tlto o3tldla2ulnvo;t4 lxnif3tadlaD  u o s)trtmxrpnu4opee nvs tfaruaur nt0tpenmoetls m2rlnmpnu4treomf oodoa eau i s) 2urxr iu1lle lfvi () rraur ot0tlen f3tas a eanmp ()arxoif oadfaD ln i s)trxrir3oy4olen iet (f Dumu  ;t4tltomi3iytlm uluvpn(4 leoxf oodfaD ln i;(0 ruo(r3oodam elfei s sDurx poo0tlxnmi3iysfm ulnvp;u4 lxoir iodfm  lieolt  rurxrpiu4amtn neia()s2urumpnt0tptn i3ils a em(mp (4 lxrxfcoadfatrai s s  rtoxr nudamenlfvslt)sDrmxm ou4tpeomo3iytfs2uanms;(4arerio ia1fmDelieo (0srtmxo iudlpenmietat aDtrumpnt0altoifeiasfa2ulnvpn(0aexnmrcto1faDe i s ( s2uo(mpiy1ope  icsl( a2ta(mooo4tee mi3iltlaDulu s;u) lermr iadlmtr uesls0s2uoxr3ny1amt liesatfarua(m nu4tpt iietydls rmump;u4trtoirciatlaDrlnvils0s2umxr3iodole lnesa( srurx poo4oeen f3tasfa2ulnmo t4 lxrxociatla elneils0seur(opno1llte ieiatfarrax p;t0ole ifciasfm rl(msnu0aeeoif3ty1fmtrlivs;s  rum(m3iu4lp   icta(f rraum ;o1texoiociatfm2umnvp;(4alxoir3ta1la r ueo;s tetmxmpny4olenmfvt t)s2trxm ou1tetnmi3iys m2ean o (0aexnxr3oy1faD an s t  etrxr ny4ale mfcil(farrr(  ;t0tex moeiadlm em(vo u4 rxoxo oa1lmtrauvil(0trxoim oydlpte neiasfa2rm(rpoo4oetomfeiydfm rlu p (4 lxoxrctytfp rln o;()trxo(opny4aptemncia()sDtrx p;t1tlxnmi3tyt mDem(vpn() eerxr iatlatr i i s0seto(r3iydoptnmnvias artr(mono4teen iciad s ulnms;t)aeeomrcoatla e ivils teurimpoo4ameemnvt (  2ur(mo;u4tltniietysfs eln p;t0 leoxocta1optraivs t0srtoio oo1amt  nctls sDuaxrpnt4tptniieilsfsDulums u) exnmf3tytopt aivs s)setrirpoodlp  lnctls) 2tmumpot0oexnif3iydlsDra(mo;(0trxrxo ia1fmDe n i t)trurxmpno4ameelfctlt)sDta(m no0ope io3iydlsDem(vo;u4altrmr3tytfa e ues;s seto(r3oy1am nlicsltf 2raxroou1opto oeiaslaDean snu0treriociodomDrau olt0srumiopnodlm  mncsatfs2umxrp;t0aeeoiociydlaDrlnvo u4aeermr3io1opte n i ()seuoio3oudlmen ivt s srrm( oou0oeen o3iadls ranvs u0tlenxrcootlaDe ivsl()srumxo3iydamte fct sfs2ta(r ;u0aexomfciys aDuan p u4tetoio iydfpt au i s0 2xmxopiy4op  lfes (fsDur(mono0alxomoetadlm ua( snu0 etnircio1fptelieo;t0 rtrxopnydapee ietat)srtm(r ou1tlxoif3ilsfm2uanmsnu) rtomr oo1fatelu s ()trurir3iy4omtnmiei (  rurumo;o1tetoifctad mDeln o;()texnmf3ta1lpDe ueo;s trtm(mpnodamtnmnvils sDumurp;o0aptnmfetydla uluvo;()aleoxfcia1opteauvs;t seur(o3iy1lptnlfcslt) ruaxrp;o4texnmfetls a2umnvp;u) eenif3oydoaDr uei;() exmxopoydam n nesl()s2uax ooo0texomietysla2rl(vont)aexrxo3totoa  livslt) 2ur(m ny4ol n fctlt sDtr(rono0alxnmoeildfaDrm( p;u0 rtriocoy1fm  lneo;s)teuoir3iy1amtn nesasfsDraxm ot4apxomf3tyt m2um(vont)aleomrctytom elu i s srtoxr nudomt lictas aDuau ono0tet miciyt m2ua(vp;(0aexomf3iodlpD  ieolt trxoim iy1amtn iciat)s2ua(r ;u4ale iietadfs2ul( snu4arxoxf3oydfpDr ivi;s0 rxoxm3oydom  licilsf 2taxm nu4oexn ieias aDrln s t4trxomf iotfmt aivols texoim oy4op nlncsatfaDtr(mono4opxoiiciltfm umnvs;u)texoirciatla  anes s)tetoxo3nudaptn fvi sfa2urxront1aleo oeiyd m rmu o t4arxrif to1lmt lnes;s0 2urxr iu1ope  nciat  Dtrx  ot4tpx mociydlmDum(ms;t0 lenmo io1op rauei (0tetr(m ny1ol emfctls) rtru o;o4ole  fetadlaDuauvpnt0aetoxr iodfpDe neil(0seuoxrpoy4ll nlictatf Draur nu1aptnmieiasfaDuanmsnu4 rtoif ta1lmtelies;()teumiopiu4om   ncil() 2raxmonu1oetomi3tasla ran p;t4 exnmo3iatlp  ai ilt0 rxr(rpiu4llt lfcsatfs2tru  ou1oleniiciytfa2eauvo;u0 lxrxf3to1lmt aivolt)trtr(m nudamtnlieias srtmum ;o1opxnmo3iysfs ul(mp u)tlenmf oodfaDeai o s0t2umxm3ny1omenmfctlsfsDumumooo1aee  i3iyslm eauvp;() rxnxrcia1fpDe n olt0s2urxm3iudopeemnvt ()aDrmxr ou4opx ifeiatlsDumump;(0aeeoxf3iytomtrli s;t) rtrim3io1lmt  nvsatfsDra(rp;u4oleo feiadfs2ea(vo u4alerxo tydfp e n o;(0trumxmpnodolte ncsas)sDrmxro;u0oex  f3ias mDum( s;t4artrirciadoatranvs;(0t2tm(opny4ole  ies ()s2uaumpnt4oee  f3iasfm elu p;t0tetrio iy1la eluvols  rxrxrpnu4llt lncil()aDum(mpnu0oltomo3iysfmDua( snt4aexrxo3iy1lmt aivs t) exoxo iy4opt mnvs () 2uaxm ou0optn fctltfaDulumo t0tleoxf3iydfpDeli s;t)teurxm3iudlp e fci ()aruaxmo;o1apx  fcias aDeau snt) rtnmo3oo1fm rluvi t0t2tmxopou1aleemicilt) Dum(rpnt0texn iciatla2umnms;t)areomf3iadfmDean s t seuoir iu1ape lict t  rrr(mpnu0apxoifeild m2eln o;t4trenmfcoatfpD lies ()s2xoirpio4amenlneils)a2rax  oo0oetoiictls a2rm( p u0 etrxo3iy1lptrlu i;s srumir oy4lpe mnciasfaDtruront0opx  ociadfs2elump t0tetomf3tadlateln slt texrir3iudol   nvslt)aDraum ;o1tptoioeils m2ul(vp;u4treoirciodfp e n ol(  2xo(o3ou1amen fci (f Drauro;o0ope moeiytfm rm(vo;t0trtnmfcoo1latelnvil( trxrxrpiydam n nvs s a2uaxrp;t4aet  f3iydlm2rm(mp u0aleoxf3iydlpDe iesl() 2xmimpny1oltn nvilt  2tax o;o1tlx moeiasls2el(vpnu0 lxomocoodoatrauei;( srxo(o ou1lpee nesls arrm(monu0alenifcild s2emnvo u0treoxr3ty1lmDrlueols0trtoxo3iodamenlivsl()a2raxrpnt4opeoiociatfa rm(mp;(0artrxfcoatoaDeauvs;s0truo(m3oo4lpe  iet ()s2trum nt0tlen icilsfmDra(vpn(0alxoxf todlp rln s s)t2trir no1ope  fvsasf Dtaxmpnu4olxo fciasfm2ul(vo;u0arxrmoctytfaD livs s) 2uo(r3ou1ol emnetls)srurxr ;o4altnmiciad s emumo;t4tetomf oatopt  n o ( sruo(o nu1ll elnciat)aDtrurono1alx ifciasls2emump t4altrxf io1lp eai i;t)trxr(opiodomtelivs s)sDuaurp;o4oex iieiatls2umu p u)tetnxo3iy1fp e n ils)teuriopoy4omenlivi sf rurxrp;o4apxnmf3iadfsDumuvs;()teeoxo ty1fm   nvi t0 2xmxopoudopt  ivtas sDtmxmp;u1ape ifctydla elu s t0 exnmo3todfm eanvolt0truo(o3iu4oleelncta( arua(mo;o1tlx  ieias sDuanvonu) leoxf3tatfm rlu olt0 rumimpno1lp e net t  rrrx  nt0ope moetatfm2rl( s u4 lxomf3tytoa   nvol(  2ur(r iodop   nciatfsrumx onu4oleo i3iadfm elnvpnt0 eenmo3tatfmtelivsl(  2urxo3nydomtn ictas  rtr( poo0olenio3iys a2rl( pnu0 lenxrcoatom   ieilt)t2umio3nu1lpeeliet (farrr(mont0tpenmoeild m2emums t0 lxnir ia1op eau s t t2urxm iy1opee ictas aruaumpnt4olenmoetls m rm( pn(4tlenxo tydomteauei (  euoxopny4am e nct s aDraxrpot1tpenioctltfa2ran pnt)aetrxf3io1oat lieo;()seurxo3iy4ape mncs t  Draxroou0alx  i3iyslaDum( p t0 lenxo3tydfa e ivi (0srtmiopio4lm  lfviat aDur(ro;u0tlx mieiltls2ulnms t) rtomr3totomDraieil()sexr(mpio4ameemnci s sDraumont1opx  ietlslm rln p t4texrxf3oytoaDeauvols0 2um(mpiudlmen ieiatfs2tmur ;o0aexomietadls ua(mpn(0tltomo3totfp e nvs t0 exmxm no1aleelfviasfa2tru  oo4oltnii3tys aDrmumo;(4aeenxr3oodomtrluvi;s truoio oy4lmeelfct s)srumu pot0teenif3ils mDeanms;u4 eeomf oytla eanei;(0sexo(rpiy4ll   icsa()sDumu ont1tee  f3tydla eanvp;t0 etoxo3tadlpD auvs ( s2xoim iu4optn fet (fs2ta(mo;u1apx if3ilsls ra( ont) exrxf oodfaD  i i;s trum(r ny4al  lnet tf rra(mono0ale iieiadfa2uaumo t0 leoif tatfmt  u sls) rumxrpoo4lmenlieias sDrrxm ou1tlxnmi3iadlaDea(mp;t4trxnxr3oa1laDr iesl( teuoim io4ap nlietlsf 2uru ono1apenif3iyt a el(mp;(4trxoxo3io1fm r uei;s  exmimpnodlpe  fvt tf 2tmu  no0oexoif3iasla emnvs (0alxoir iodlmD  ueils)sexrxmpoy4lp elneilsf Dtr(  ou4olt  oeiasfa rmn o (4alerircty1lp rau ol(0 2xm(m iu4al  lnvslsfa2tax poo1apxomiciyslmDrm( s u)alenmrciadfmtrlneslt sexmxo3no4aptnlncs t)s2tauro;o0tex  o3iyt a ea(vont4tltnif totlaD anvs (  exm(r oo1op e nct ()sDrruro;o1aeeniictysls rmumsnt0 reoioctotlate ues () exmio io4ll e neil()artmxmooo0optnioetasfm ulu p;t4teeomo3tytopDrli o s srxoiopiudope mfcs t artmum ;t1oetoioctysfa uanvon()aeerir3oadoa  lu o;t  2trxr3ou4apte ieias)srtmxrp;t1opt  ociytfa elump;t0areomr3io1lpDraueo;t0seumio3ou1aptnlfes s)arrrx o;t0aeto o3ias aDrmu pnt0 rxoxr3iy1oa ean i s0texoim3ou4am  mneil()sDtrur no1oltnif3iatfs rmumo;(4tetoxo3oodfatrlueo s0srxmxm nodapen fetltfsrtr(r ot0tetomoctatls2uau onu)aexnxfctytlm e u o s0setriopnu4lle  feia( sruaumpot4apto feiltfa2ulnvs t4texnxfciydom rai i t0 rumxo iy1am  mfetat sDurxmpno0opeoii3iltlmDua(vont4alenmr tatfaDeli o;s0t2toxmpoy4lp elnvsatfs2ur(ront4aee mieiyt s2elu p;u)trxoircty1opte u o;( sruo(r3nu1olt miei t) rta(ro;t4tltnmfciltfs2rlnmp t4aetnmf3to1omDeluvo s0 2ur(m3iu4aptnmnei ()srra(  no4optoioctad m eau p ()tltrxr3tytfptelu o;()srtmim3nodamtnlnvi s srtrx pnt0opxo fciysfs2emnms;(0arxoif tatlmte nvi ()sexo(r no4omtn ietls)arumxrono1ape mfciatls2uaums u4 ltnmf oy1omtraues t0texrxr iudlleelfet t)s2tax onu1optomf3iytla2ulump u)areoiocoodlaD  iesls  2uriopiy1ol emncta( s2taxm nt1aet ioeildlmDrmn o (4tlxomr todfpDranes;s)teuo(opio4optnmnvilt)s2rrump;o1olen i3ildls ranmp;(4 eerxrctodfaDr u s s0 rtoir oo1ap nmfeils arumurpoo1oltnii3iytla eln s (4 rtnio3iatfmDranei;t0texrir no4lmtemfvs s s2ra(m nu4tlt  ictyslm umnvp;u)arxrmf3tydoptean s;t  rxo(o3nydll   fcils  2rr(mpot4tetomfciys mDuluvo t0tlenmr3tydfmt anei;(  rtm(m3oydomenmneilsfarrm(m no0oltoioeilt a2ra(ms;u4aetnir3io1opteluvslt t2uo(m iy4alenmncsat aDumump;t4optnmi3tyt mDelu p u4areoxr3iydoatelu s;s0 exrxm3oy1ale mfesatfsrum(mp;o0oee moctyt mDelu p;(4 lenxf3oa1lpD auvi;(  eur(mpoodaltnlics ( srtrur ot0altn iciat mDemn s ()tltnmocoytoatran i t0 2xoio3iudame mies ()sDururpno4tptoifeiltla eaump;u)altoxrciotom r i ilt0trtm(m3nudale mfvilt srumu ont0opeomictysla eanvo;t0teenmoctotoa   uvil( tetrxopno1am emneia(fa2rmurpot1tlxo f3iat sDrluvonu0 ltnxfcootlp ranvo;s)seur(rpou4lptnmfei ( s2tmu  ot4aeenmi3tldfm2el(vp u4treomf iadom  aivi;t)srxoio3iodlleemnet s) rurxr nt4ape  i3iasfmDeluvo u0altoxrciytoaDrai olt) etmxr iodop emnvi t aDtmx  ou0aptnmi3iltls2ua( pnu0arenmocto1opD  neo;s t2xrxmpnu1olenlivt (fs2uaxmpou0altomiciatlm eanms;(0 rtnxf iodlm  au o s  2xoxmpiy1alenlfctltf Drrum ot4aetn octldlmDrl( s u)altoif io1oaDe u i ()trtrirpiu4omte ivsas s2um(mo;u0altnmocilsfs ran s;t0 etoiocoatlatrlieo;t s2xoxopny1apt  fcilt aDraxro;t1olenmfeiyslm ra(ms t4artoifciytlptean s;s)t2tm(r3iu4openmnvs (f 2rmuronu1aexn i3iasls2elu s;u0trtoxf oa1op rluvi s0seuoxm iodaleelfei s  2rmx p;t1tltnmf3ildfm rl(ms;t) eenmr3iadfm r i olt tetmxo nydop elfvi (f Duaxrooo1optnio3tadla rlu o t)tltrio iodlp ranvs t  2xoir3no4ll nlfcsatf Drrur oo1aptoifeiatfsDeauvsn() lenircootoat anvi s  exrirpou1lpeelnci s)s2ta(r ot4opx  ieiadla2ua(vo t0aeerif ty1fmDe ieo s) 2urxr3iudomee nvsls)srrm( pot0apx  fetyt mDrm(ms u4altnirctodla r ivs s)setmir ou1altemnet (fsDurxmooo0tleoifctadfa rauvo;u) reoir iotomteluei;s0 rtrir oy1altelieil()aDtmu  oo1alxniiciytfsDumums u)arxomr ia1oate ivs;s0teumimpnu1omen feil( artrxmooo1apt mfctat aDeluvpn() lxrmo3oatfaDrauvs;s t2xoir3io1am  mfesas artmumont1opeoifeiydfaDeaums;(4arenxfcoy1opteauei;s srurxr oo1llt mivslt) rumxmo;u4olxomietat mDrm( o;(0texrxr totfm eaivs t  eurxrpiodll emict s aDtm(r no0tleoii3tytlm rmuvs;u0altnmf oa1lm rlieol(  2xoim oudlmen netat)s2rr(r ou1oltn feiytls2um( on(0alxrxr tadfp eli s;t0srtoim oy4lm emnviat  rtrxroot0apeoifeilsfs2el( s t)trtnmfctatla  lu s;t)teur(opiy4apeemnci sfsDurxr ;t4teto feiydfa el(vp;()trxoio3todfp r nes s)srtr(m3ny1ale  fes sf Dtm(moou0apto feilsls rm(vont0 etnxrcoytfat  uvo;s)sexriopnudll emfet (  2rrxm oo1oexn oeiysls2ul( s t0texomrciodopDrluei t)s2xmxopnodoltnmfviat s2taur ;t0ale mieiydfa2rlumpnt0artrmfcootlaD lnei;s  rurim nu1am emfcsas)aDtm( o;t1tpto feiatls2elump;t4tltomo3oatlm e i slt sexmim3iy1om  lnciat aDtru p;o0tpenmfetad aDea( o (0teenxocto1lat aivolt) eto(m3ou4ol n iei ( arrmur oo1oexn fetyslm2ea( p (4trtoxf ia1lpteaneslt)sexmxmpiodlpteliesat) Dtmu  no4tpxnmoetldla el(vs;(4alxrmf3oy1om rauvi;t0tetrxo iudomtemnvsat  rua(r ot4ape  ieiad sDel(vsnt0aleoirctotfmD  n ilt)tetoxo3oudlleemivi ( a2ur(  ;o1aptniieiadfa um(ms;(0teerir3io1lmDe nei t0 2tmiopiy1alt mfesl( srra( ont4opto fetatls2ra(mont)aexoxf3iytfptr u o ()srxr(rpiy4ole lnct ( sDumur ;u0tpxn i3tyt a eln o u)trenmf ootoaDrluvols trxrxm iu4amtnmncia(f rrmxr nt1altniicild sDuau sn()alxomf oodomDrlivo t0tetoiopiy1ome liet (fsDtmx ooo4oex ioeildfmDeau o;u)arxoxociotlm   u i s0 2urxr nudll   ies s a2rmumpou4apt  i3ild m ran p () eerifctytfat  nvsl(  2um(rpio4lmtemfeiat a2urx  ou1tle  fcild mDrluvo t4 rxrxo3oy1optelivo;s0setmio3iu4alt mivi sfartr(mpoo1ole mfeiat sDumnvp t4alermo3ta1fm rli o;()seuo(o nu4openlivsa()aDra(mpoo4tpto o3ias s2ulu s (0 eenxf oy1fp rluvsls)sexo(opoo4om  mnesas)s2taurpot0teeo o3ildls2ua( snu0trerir ty1fmD aivil( t2umim3oy1op nmfci s artmxmono4tetomoeiys aDumnmp u4 exnxo3iydlpt au olt t2xoim nudllen ivi t aDurxr oo1oee  ieiyd m2el( snu0trtnxo3ootlp r ieo;t truoirpny4op  lici s)sDrrur nt0tlx mo3iatfs2elnmo (0 renmr3io1omteanvil(  rtmio no4amtnmneiat)sDum(r ;o4alx  oeiat a2emn o;(4 rtomf oodop ranes;s)s2xoxo oo1aleelics sf 2rax pno4tlt mi3tadlaDrmnms;t4aeerxociodfmDeau i (  2to(opny1ll  lfvsa(  rta(m nu1ope  feils m2rlnmp;u)treomo ta1op ranei;t)s2uo(rpiydomenmnetlt arrrxrp;o4opeo fciltlm2umnmo (4alxnmf3tydfp   uvi;t0texmio3oy1ame  fetlt  rrrurono1tpxomieias a eln s u)trxrir oa1lmDr n ols trtr(o3oy1optelfcsa( aDrmu  ;o1olxomf3ias m em( s t0aleomo3iatlpDrlivols t2toxo3ny4ap nmivsl()s2ua(  ;o1openif3tlt sDem(vonu)texrir oydfpt ai o t  rtm(rpno4olt mfei s  Drmurpoo4alenmocils aDum(mon(0 rerxo3oodoaD aies;(0seur(r3oodomen fetls)arum( o;o4aex ifeiasfa2umn p;() exoir totomtr ueolt t2um(m3oy1om emfesas arur(  no0tlxnmoctad a emnvo t4 rtnifcia1fm e nvo (0t2xmim iu1lptnmfcs ( sDrrur oo4tetnio3iysfm ua( o;t4 exnxf iatfmDr ivslt)tetmiopiy1ap elnvt sfs2urump;o4alx moetat aDum( sn(4tlxoircoodlm   i o ()trxoxo no4ll  mnet sfsrtr( o;t4tetnifciydlm uln snu4 rtrmo3tatfmDrlu i ()s2tmio nu1lle lfcsls a2rruro;o0aexo ieils s2umu s t4 ltnio3oodopt  n o (0t2uoir3oudolenmneilt)sDrmxront1ope mo3tyd mDrl( o (0alermrcoa1lpD au s;()teumxopoudol  mnci s srtax ono0oeeo o3tadls2em(mo;t4 leoir tydlpteluvo t  rxrir oudlp emnvta(f Dum(r ou1aeeniieiyt s rm( o t4 rxnxf oa1lp rlneo;t0 2uo(r3ou4amtelneiat s2rmuront1apx  ocildfaDuluvp () exrmfciotfmDraies;t0t2tmir3oy1al e ncta( a2tru  ;o4oeeomi3iatfa2rm(vp u4tlenxfciadlpteaues;() etrxrpoo1lpe micil( sDtm( p;o1opeoii3ilsla rl(vpnu0aleomo oatlaDr i s s)s2urim nu4lltn ics t sDrrx onu4oleoii3iyt a rm(vs t4tlenxr3oytla raues;()teum(opnydlltnmietl()aDurx  ;o0altomieiydla2rlumonu4tltoir iydomDrli s t0sexmxo3ny4al elnct tfaDtrurp;t4tlxnmoctltfa2em(mont)altnmocoa1faDraiesl(0 2xrio nu4lpenmnvsat s2tau  ;o4aleoiieiyt s2um(vsnu0 lxrxo3tydoaDe ivo t  rtmim oudape lfcs t)s2umumpnt0ape mociltfs2ua(mp;u0alenif oa1oaDelivolt0s2ur(o3ou1lme  fct t)sDrr(  oo1olxniictad a2emu s;u)artriociy1la  aivo s  euriopoudoleemfvta(  2ua(r no0aet mfetys s rauvo t4tlxomo3oa1fa rlnei s0srxoxm oydlptn fcilt arumurp;u0tetn fctld a eln pnu)aetomf3oydlm  lneo s) rur(mpny4lpeemfvsls)arrmxroou4tle ioetltlaDrl(ms;()aeenio oydlpDeln sl() 2xm(rpiydllt  nesas)sDrm(  ;u4aexo oeiyt mDul(mp;u4tlxoifciydopt lu i;t) 2xoxr oo4al elfesat)a2uax oot4optnmf3iytfm2ua(mp;u4 lenmr iytoptelu s s)texoxo3no1al nlnei () rumum ou4apt iietyslsDeauvpnt)aeermociy1lmt  neo;(0setr(r3iodlptnlnvsls srtmum ou0aee  ociltlaDelu pnt) rxrio3ia1op rli s;s  eto(o3nodopeelnviat)a2umur oo1aetnmoetyd s elnvon() leoxr3ta1oaDr uvil()t2tm(rpiodlleelnct () 2trxrp;u1apenifeiydlm2rl(mp (0aeermf3tadoatrlnvi;t trtr(o iudamtn fes s  Dtax pnt1texn fcild aDeau p;t0 renifcty1oat ln o;s  eurir3ny1oltnlncia(  2raumpou0aptniocilsfa em(vs t0artrxfcoytfatrauvilt0 exmxr3ny1optemivils a2rm(mo;u4apxn ieilsfa rauvpnt) rtrxr3oydlp eanvs s s2xmir nydomtnlfesltf rta(  nt4tet mi3tls a rl( s u0altnmr3io1faDr u i;t trtmxmpiodlltelivs s a2tm(rooo1alxomfeiydlm rmnvo;() lxoxo3ia1latrli o t setoim iudape lfvtat)srta( o;u1apen feiat s um( o;(4texoxr oy1opDe ivo;t0trxoim3io4llenlneia() 2ua(mpnu1oeto feiasfmDeau o;t0 exnir to1omD  ieo;t  ruoxo oudole lnei tf Dtaxmpnt4apenmf3iyslmDrl(mont)arxrmo oodomt  n i s s2umir3oo1apt mivsas sDur(mpou0altomicildlmDeluvs u0 ltoifciydoate nvils trtoirpoo4lpenmieils)a2rmxmonu1tlen fciytfa2uan p;(0alermf3tadlp  li sl()t2urim iu4ll emfcs (  Dtr(ro;o4oetoiociltfa ua(mo t4 lxrmo3oodlmD  u o;t) 2xoim nydlleemnvs tfarta( pou4apeoioctyt s2ra( snt4arxrir todlate ivolt0texmim oydole lnei s)srtmxm oo4tpt mf3ildfaDemn onu4 eeoifctotom r u o;s) 2tr(rpio4op e ietasfs2urx p;t1opxnmf3ilsfmDeaump;u4tetoxrcoodoatelivi s0srur(o3io4lp   nei ()a2tru pot1altnmfcilsla2rlnmpnu4arenmfcoa1fate nes s t2tmiopoo4lpeelnei s) rtrxro;o1apx  oeiydfm ea(vont) rtoxf3ia1op eaivo (0 rtm(opiu1omenlfeia( srur( pnu4tpx mocils a2em(vpnu) renmf iadlatelues;t0 rxrim nydamt mfcs s)a2tru ono0texomi3tldfaDranvs (4alenxf oadlmDr ivslt) rxrir oodaleemicsltfsrtrx ono0aetomieiasfm2ua(mp t0 lxnmo3iy1faDraivs t0trtoxr3oy1omtelncsls  2umu pou4apxo f3ild aDrlu p ()aetoxo tytop rluvols srur(r iy4omtnmies sfs2rmxrpnt0tpxnmo3tltfaDrl( s;u)arxnxo3iodopteaueslt  etoir3io1omtelies sf 2umx  ;o4tpt mi3tatfm2emnmo;()tetoxo ia1omtelnes;t  exrir3oo1lpeelivtl( aDum(  nu0alenmo3iadfm rau p (4 lxnmoctydfpDe ivslt0sruoxr3iudap   fvi t  rtmxrpoo4opxomfctldlsDrmumsn(0aetrif to1fmDrlneo;t)setr(r3oudapen ncias a2ururonu0tpxn octatfmDuanvo;u4trtrxfcoy1fptr u o;s srumir nu1optelivslsf rtrx oou1alx  oeiyt aDulnvsnt)aeenxo oatlpD aivo s srumiopoydamtn nvta(faDua(  ;o4texnmicilslm rlnms t0tetnmo3oy1optr nes t teuo(mpoy1ll nlnctat) 2uau  ou1olx  f3iasfa2rlump;u0teeomf3oa1opDeai i t0 rtr(rpoo4lpen nes (fsrrax ooo1tpe iietadfm2umn p;() ltrir3iydop  aivslt)t2toxm oudlptnlivilt)s2ra(rpot1alto fcildfm rlnvo;t4 etomo3iy1lptranei;t0trtm(m io1al n nvs s)aDurxronu1tlt moeildls um( o;u4teeoxf3oadopDeaues ( s2uoim3oy4opeemivia()aDrrum ;o4oexoioeiltfa2rlumpnt0aetoxo3iotop eln ils sexoim3no1llen nvtatf rumuroou0texn ictlsls uaums;t4altrir3oydomDrli s;s)s2urxmpoodal emiesas  rrmxrpno1tlx io3iltfmDelu p (4tlxrxo3oytop r u o;t s2trxrpno1apte ncsl()sDua(mpno4tex ifeiys s ulnvp;()trtrmo3iytoaDe i s;( s2trxm3oydlmtemfci (fa2ra(mo;t4tpxnmoctlsfs2el(vp (4arxnxfcia1lpDelues t trtm(m3nodlpte ivil(fsruau onu0oeeo o3ilt sDrlumpnt)aeeoxo iydomtrluvsl() 2xrir3ou4al nlnvtls  rtaurp;u1tptniietlt m2ran o u)arxoxrciy1opDrli s ()seurim nydlp e fvia(fsrtrx  nu1texnmoetysls2rm( s;t0aexrxo oodlmDranvs;( srtr(m3oo1lpeelfctls) Dtaxmo;o0teeo fcias mDulnms;t4alxnir3todoa rlies;( srxr(opny4opte ncils)a2ururpoo0oltnio3tldfs2rln p;u4 exrifcoadfmt  i s;()setoim oudlle licslt aDtrxrpoo0optoioctytfs el(vonu0artnmf3ia1opDrlies t  2uoio3iodamt miesl( a2ur( pou0tltn i3iysfa2uau p u0texrxr iotlaDrli o;(0truo(r3oy4oleemicsasfa2urxr ;u0texo o3iad a2uanvs () lxnxfctadfat lnvi s trtrim3nydllen fcsatfsDuaumpnt4tex  o3iys aDuan o;u0trtoxrciodopDr nvi () 2xm(o ou1ap emneta()arumx ono0opx moctldls2em( p (0tlxnmf3tytfaDe neo s t2uoim3oudlpeelncs () 2rrxmpou1olenifeilt s rlu p;t0arxnxr3iytlpD  nvs;s  eumirpou4apee fctlt aDrmxm ot4opxn fetatfa rmn pn(0aeeoir iatfm rlu ils)seurim3oydlpee iesa()a2trx  no1tlxn feilsfs umuvs;u) lenmfcoadoa rln i;() 2trim oudlp  mfcsls arrax  ;u4tltoioctld aDrm(mp;u0trerif3tytfaDe neo t0 2trxm oo4ol n fcils)arrmxmp;t0apt iociasls2elnvsnt) exnmocty1oaDraiei s) rxr(r3iy1alt lnet (  Dumx pot1tetoioeiasla rm(ms ()tlxoxo3tytfa r neilt)trumio3oy4omenmfctat aDtau o;t0opxnii3ilt s ra(vo;t4alxrxo ty1lp  luvi (  rxoimpio1ope mncsl() rtrxrpou4oeeo i3tadlsDul(vp u4 lxnio todoaDeai ilt trurxmpoydole mfcsatfsDrmxm oo4alt  f3ild s elnmo;t) exrxr tadomD au o s)srxmxm3oy1lp  mfesls  2rmum ;t4ale mocils m2el(vo;t4aetrxo3oydom  aiesls0trtrim ny1ole  fcsas)aruaum nt1altoiieiyd mDuanvp;(4texomo iotfa elueol()teumxmpio1alee neiatf ruru  no0tee  ieildfsDem( sn()aetnmr tytomDrlu ilt sruo(rpiudom  lnciltfaDta(mo;t4tlenmietadlaDrmuvo (4tlxrmf iydfatr uei s)teuo(r3iudlme  ieslt) rraxr nu1optn iciytls eaumsnt)altrio tytlmDranvi;()t2xr(m3iy4llt  fcs tfaDurxmont4tet  iciad mDeln s (0tltnio oadlmDeanesl(0trxo(r3io4al elfeil(  Dumx onu1aeenmicias s eanmp;t0tlxnxf3oy1opte ies t truo(rpny1al elicslsfarta(mp;u1texnmocias m2eln snu0tlxnxr iodlmDe i ols sexm(m nu1al   ici () 2uax p;t0apx mfctatlsDeluvonu4teenxo iytfmtrau i t t2uoxopno1ame  ncslt)sruau  ou4optnmieilsfs2ranmpnt) lenxr3tatoaD  neo;t0trto(opoo1ll  mivi t a2uaxmoou0ole  f3ilsfs2uan p;t4aetoxf oa1oa elueo ( texmimpno4openlnesa(fs2ur(ro;u1ape ii3iasfsDrau o ()artrmf3tytla rlnvo;t0t2umirpnodoltnmfvtltfsrtr(r oo1olxn fetlt aDrm(vpnt4trenmocia1fpt lnvi;()setr(m3iy4oleelncsa( artau  ;u4openif3iytla2em(mo;t)trermo totoat  iei;()teur(mpiu1lleemieta( s2rr(m ;o0aexnmo3ilsfaDelnvon() eerxfciodla eau sls0texr(o3oydoltnliet ( srrrxr ot0tlxo f3tas s2emu sn()altoio iadom r uei t setmir oy1amen nvsatfa2rrxrp;o1oeeoiociysfaDeanvo;(0 rxrif iadlptrli i;s)t2uoxr3nudlmee fci sfsDum( oot4apt ioeiydla2rm(vo t0aeenxfcio1lm r nvo ( s2tm(rpou1ap   ivils) 2raxro;u1oeto iciyd a eau p u4 reoxfcoatfmtranei t)s2uoxm nydlpte ici tfs2umump;t1tltomo3tldfs2eauvsnu4 leoxociadfptraueil(  2tr(r3nydlmeemfciltfa2tmuro;o1opx mfeils a umnvpnu4 rxnxoctytom e ivi () rumxr3oo1amenmici () Drmx  ;o0tet moctyd aDumu pn(0tltomrcia1fmt  ivs t0texrxr3nodamen ieia()a2ururo;u0apen i3tldlm2el(vpnu0 ltoir oatla rauvo;t0 exrio3oy1aleelivsl( a2ur(moot4tpx mo3iytfsDemnmo;u4 reoxr3io1fmteluvs;s0trxm(mpiu1ll nmfvt t)arua(ro;o1tpxnmfciltfm2ul(ms;u0aetrxr3tytop eanvilt  rxrirpou1lle  fesa( arrr(mo;t1opxo icias m rl(vp t) etrio3to1fm  luvol( srurio3nudomenlnvslsf rumuro;t0alenmf3tasfm uln sn()alxoiociodfm r uvsls0srxoxmpnu1ape mfetat  2taxro;t1olx iietydfm ra( sn(0texomf iatlmtr nvo (0 rtrirpno4omte iet (  rumx  ;t4aet  i3tyt a elnmsnu)alerir3tatomt ln s () 2um(m3no4ole mfesasf Draxmoou1aexn i3ildla2em(vp u)areoirciadomDrli s;( srtm(o nu4lltemivs (  Dua(m nu1opxomfeiydlm uln o;() reoir3iadomteauesl( tetoir io4optemfei sfarra(rp;o1oeeomieiasfaDum( s;t4trxnio ootfpte i o t0 ruo(opnudameelfcilt)srra( ont0tpx moetyt m2rm(ms t0 rtoif3iydomDrai o;s0s2urio3nu4openmnvsas)s2ta(rpou4olt micias s2eanmp t4 ltoio iytla ranvolt texmxopoodlptnlfeta()s2tmxro;u0oexnif3ils m2rmn s u4 rerxocoa1fmtr n il( texoxmpnodolenmncslsfarururo;t0oltn o3iydfs ran p t0 rtoir3oy1op  lnvolt)setrxmpnu1optnmivtasf Drr(m ot4tlx  o3iadlm ra(vo (4 eenir iydlatr i i s sexrxopnydllenlfcta( sDtaum ;o0opxoiieiyslaDrau p t4 etnmrcoydla r uvs;s trum(opnydamtnlfcs t) rrau  ;o4oexo i3tasls2ul(vsnu0artnir3oy1lmDrli ilt trtrxr3oudal nlfct ( sDtauronu0texoifctltlaDrau p t) leoxrctadlate u ols seumxo nydal nlfesasfsrrmuro;t1aex mo3iat s ranvsnt0 exomf oo1fa e i o;s)teumim3ou4om e ictasfarra(  ;o1tpe mi3tasfs2ul(mo;(0tetoxfciodomDranvo;( setr(o iu1lm e nct s  rumxrpno4apt mi3iad m2rl(vp u)tlxrmo3oadoa raueo;s t2xmxm3no1ap nliesl( srtrurpoo1altnioetaslm2rlnvsnu) ltrmo3ty1fat  uvo;t0t2um(m nu1apen neils artmxmo;o0tlx  feiat aDem( pnu0tlxrio3totlat  u ils  2uoim oy1lmtnmnvt t srtm(rpoo4opxnmo3iltfaDrmuvp;t4aeenxocoydfmDranvi;t0s2tm(r3oy1op  lnvil(fsDtmx p;t4alenifctat s2uauvs u4 rxnxf totlaD  uei;t)trtrxopnudal nlfcia()arra(mont1oee io3ildfm2elump t0 lenxfcootopDrlnvi t) euo(opny1optnliesl(fs2umum ;o1aptomiciysfs2ul(mp (4texoxr3tytfpD lu sl(  rtrxm oo1olee fcsltf Durx onu1apxnmi3iyslaDrmnvo t0artrmr3totomD auvs (0 eur(o oy4lp nlnes t)aDur(m oo4oetomo3tas mDulu o ()aexoifcta1fpDeaueo;t0 2uo(o oydalt mfetlt arrm(ro;u4ale  fciatlaDemuvont)arenifctytoaDr uesl(  2uoxrpnu1ap n iesls srtr(rpou4tltn o3ildlaDea(vo (0 lxoxf3oo1optr ivils  2uoxr ny1altn ivtl() 2umu  nt1texomi3tas sDumuvsnu4altrifciodoat  u il()s2uo(opiy4al  mictls) 2uru oot4oeeo ociytfaDrmnms;(0 reoif3oo1opD an s s trxmiopiu1amtemfcsl( a2ta(moou4alt  o3tys m2rlnvp () rtrmr3oy1omDran s s0 ruo(opoodaltn nvil(fa2rrx  nt0aex mf3iatfsDuaumpn()tlxoxrciadfm ran ol(0setmio3no4alte fvtlt artr(m ot0aex mietydfmDrmu o t) eeomf3ta1op rln s (  rtoxr iu4lmte feia(  Dtaur ou1tlt iociyd s2ra(mp;t)texoio tydlatr uvsl()t2um(rpiy1al elfet sf Drr( p;u0olx  ieiydfs2ranmp t)altomrcoodoa r i i t)seuoxm iydlmtnmfci ( sDtrurpou4tpxn oeiltfsDrl( o ()arenifcoy1oa e u o;s0trxo(m3oudlltemnvsat) 2taxmpou4aet  feiyt aDrlnvo;(4teeoif oatoat anvol(  rxr(m3iodlltelfvil( srrau oou0tpeo fctydfsDrmuvp;t) eenxo to1omtrlivi;s sexmirpnodom  lnci () 2tm( ooo1tpe mo3ildfs ra(mpnt0tetrmo3oatlat  n i t  etriopoodaptemnvsa(  Dua(m nu1alxoiociad aDuanmo;u0 exnxr tytopt  uvo ( trto(m iodap n ncil() rtaxro;o4opx if3ias sDrmnmo t0tltrxrcootoa eai il(  2umxm3iu4altemfvs tfarrm( poo0opxoioctad mDulu on(0alerxo3oa1lmt aues;t0t2xr(o3oo1ameemicsls)a2rauroou1tpe  f3iyt mDul(vpnt0trtoif todfmte nvolt) 2tmxm ny1alenlietasfaDum(m ;u0apxnmoeiatfa2rln p t4arxniocty1lmDrau i;s0setr(r oy1lmtn fes tfs2ua(rono0tet ioeiytfs em( o;u0artrmf totlaD  nvo;t  2xmxrpny1ll nlics sfaDrrx pnt4tlenmf3ilsfs2rmu pn(0teerxr iytla  lnvils0s2umxr3io4ale  ict t)sDumuro;o4aetniieils s2uluvp (0aeenxr iadfpDe nvils) rtrirpoo1llt  ncslsfsrrmur nt4tlt mieiadfsDul(vo;u0tltnmfctotfa elneol()s2urxmpou1ale lfvsas)arrau  ou1teeoiiciatlm2rmn s t4alxoxr iytfm  aieo ( t2xoxmpiu1ome  fesl( sDrmu  nt1apxo octad mDumumo;t4alenif3todfmte i i;s)texrio oo1ap nlfcsltf Drmxro;o0teenmoctlt sDuau sn()tetomr3tytoptean o ()texoir3nu4lp emfctlsf Dtrumpnt4tlt  ietytfsDrmnvon(4 renxf3ta1oa eauvil( seurir3iy1lpt mnctlt  2tm(ro;o4tet ioetldlaDrmnvpn(4 leomrctadfa  ln sls) etmxr3iu4opeemivta(faDtrxr no0opx ioeiyt aDrmump;u4tlenxf ootlpD auvo;t  exmir3oy1am emietl(farra(root0aptn ietas sDrm( s;u0trtrmo iydomt livslt truoirpnu4lpt lfct s)srtrumpnu4tlen ietyt aDua( s t4 exoif oo1fm  lueol()teto(r iy4alenmfesasf Drmu p;o1olt mfcias m emu o;(0alxrircootomteaivi;t s2urxo3io1lpt mieta(  2ra(r ;o4tetoifctatlsDem(von()alxoxoctydlmtr ieols sexoxrpio4lptnlictlsfsDur(r no4ale miciltfs elu p (4 lxrmr iodoa e neilt0trtm(r nu4optnlncsas srtrurp;t0apt iieildfa2el(mo u)alxrxrcoytfm   u ilt0trum(o io4olt mfviatfa2taurono1oltnmictlsfsDrl( sn()trxnmr oatfpD  uvils0t2um(m nodapenlncil(  Dururpno0tetnifetysla2uau ont)alerxo oydfptr nes;s0 2xmxo oodopenmfvsat)a2rauroot1tex mi3iat mDelnvpn()aeeoxo tydlmDr uvsls0 2uoxm3ny4lpen nctlt s2rmumoou0ole ioetyd s2emnvp;t0areomf iytomDelu ols)s2xmir ou1ap  micta( arraxr ;t4tleo i3tls aDean pnt0 rxrmf3iotomD li i;s  2xo(r nu1lmtn fcs t)sDtru  ;t4altnmieiysfsDrl( s ()trxnmf3tadfm raivs;()trxmxo3oy4ape lici t aDrrxr ;t0tlt iocildfa ul( s t4 reomf ootfpt li ol(  ruo(r ny4openlnes sf 2ua(rpno4apxn ieildfm2uanvon(0texoxr oa1oaDeaneo t texrxo oy1lp  liviltfs2rm(root0oeeo oeiytlm ul( o t0 exrir3iadfpte ueo;t) rtrxmpnodlmtnmfeil() 2rax p;t0aptn feiydla2rlu o;u4aleoif iodop eaivsls0 2xr(opnu4ale lfvsltf rtaxr oo1altnio3tyslm2uln sn(4 leoir3io1fmtrlnvi;(0 rxmxr oy1op elfct ( srurxr nt4apeoio3tldlmDuanmo;t4tetnifciadfpD  uvsl( sexo(o nodapt lfvt t)a2rmump;u0tpe ifctadfsDuluvs;(4 exrif ty1lp elivslt)trurim3nydope  ivs sfsDtm( ont0tpto feiyt a2eaumont)artrifciy1fpDraivs s) 2toxmpiydole  nvsl(fa2tr( p;u1tlx  feiasfs2rm(vont0tetoxfcio1fp  an i (  ruoxm nu1olt  icias)a2ur(  nu1olt  octytfa rlu o ()tltoxf3oa1lmt  uvi;()srtm(opiy1om n ivtasfa2uru ont4tlt  oeiltfmDuln o;t0 etnxf3ootfpte ivi;t)trtmxo3io4lm  mnci (fartrxmpno1oex ifciatls2ra(mon(4aexoxo3tytfpD  uvs s) rto(r3oo1ome lietl(fs2tmxrpno1tpx  fetyslmDumnmo;u4aeenirciadfpteanvo s setrxr3iy4altelies t)srtm(ront4aptnioetysfa2el(mp (4trenir oatomDe u i;t srtmxr3iu1ap elfcia(f Duaumoot4altoiieiydfmDum(vo (0 lxrxr ty1lp e i i s0sexm(r3oy4amtelies tfs2tm(mpoo0tetn ietyt s2uau o u4 rtrif totlmt luvols) rto(opou1open fvtlsfsrtaxmpou4apxn ictldls2emn s;()alenmf3oydlmDr i o s0texrxopnu4omtelneia(  rumumpnt0aleo ictlt a emnvo u4 etoxr3todlm e n i;( sexrxr oudlmt miciasfsrtrxmoou4apeoio3iatfmDrl( pnt)texoxo to1opD  iei;(0teum(r no4ol e nct s aDtr( ono0teeo i3ilt aDuln p;u)trtnmrctydfa rluvi;s) rxoim oo4omte iesa(fartaurpou4alen ietls sDumn sn(4arermocta1lat  ivi;s)sexmxrpou1lme mfetlsfsDrrurpnt4oee  fetyt m ean s u)trtoiociatlaD  i o (0seur(o3iudaptn nctas sDum(rpnu4ale ifeilsfm2eanmsnu)artnxo oy1fa rlieo ( srtrio nodlltnlfvsasfsruau pou1aeeomociatla elu p;t)tetoir to1lp eluesls0t2umir3iu4ap emfci s)s2ur(rpno4aet if3tls aDrl( o;t) ltomociotla r nvsls)s2xoxo no4al eliei ()srra(mpnt4apenifcilsla2rluvon()aeenif3iytfptr uei;(0 exm(r3oy4ape mfctat aDuau  ;t4texnmieiyt m2emn s;u4 lxnmr3iytfm r i i;(0srumir3oydllt lneiltf rtaxrp;t0tpxnmf3iltlm2elnmpnu4 eenxrctodomtrlnvsls)setoio3nydol e nci t)a2rau  ;t0olt moeiad a2uanvo;u)artnio3todfmt lneols) 2urxrpoo4om n nvi sfa2urx  ;o1tee  i3iyslm2uln s t)aeenmr iadla raueo;t0sruoxmpny1ope  nvi (  Drmxm ot0aetnmfciasfmDuanms () etomfciydopteluvs s)srurxr3iudllt mneilt)aDumu  ;o1tetomoetydfm rmump;u) rxoxrcoadfm   ies;s) 2uo(o3nudap nmnci t  ruaum nu4aeeomf3iyslmDrmump;u)trenio3iydopDe neols0srxmxo3nydlp nliesasfsrum(monu0aeeomo3ild sDumuvp t0aexoxocoy1optrli s t  2xo(o3ny1al elncs (fa2raum no1oltomfctys a el(ms u)tlenio3todoat lnvs;(0t2xoim iu1open fvsl()a2rr(mp;o0opeomoctyt sDuluvpnu) ltnmr3to1op rauvs;t trxoxo3nudapenlictat)a2rmxmooo0tlxo ieiyslm2rauvsnu4tetrmfciotlp e ueo;(  etmir3oy1ol  mnetat sDrr( p;o1aex  oeiasfmDra(mo (4aleniociodoaDeanes t0s2xr(r ou4lmt livt (fs2raxm ;u0tpeoii3iydfs eluvo;() exnmr iadlaD ln s t truoxopny1opt  fci () Durx  no4oltnmfciyd s2rmu p ()alxnxo oydopDelnes (0 etmxopiydope liei sfartmumono0apxo ieiatfa2ean s;(0 eeoif3todopD lu o;s sexo(r3oydoptnmfctas)a2ur(monu4optomocils m2rluvo (4trxnxr iydom rli sl()t2tmxrpoodlm elncs t)aDtaxmo;t1oexomfetlsla2rl(mp t) lenio oydfpt auvi;(0sexoimpio4ame  ivt sf 2ra(rpnu4tpeomo3iyt aDuanvonu)aexoio3ootla e i s;()s2xmxm ny4lm  liet ( aDrmx o;t4oleoifeiad mDumu o (4tlermr3iadop  aivolt0trxrxmpoudalt  icsls) 2tmxr nt4openmoctyslm elnvp;u4alxrmr tytopDeln ils)s2xmxm3io1apee ncias srraxrpoo4texnmi3iatfm2uauvs (0alxomf3tadop  aivi;s)srumim3oudll n ncs sf Dtaxmo;o1aee iiciadfm2rm( p (0trxrmr3tytfat  u olt)texm(m iy1apt mfes t)a2rrump;o4ole mf3iydfa2emnvs ()tlerir oytfa   ueil(0tetmxm3iodllt  fcsa()aDtrx o;t1oeeo ieias m ul(mp;u0arermf tatfat  u i;() 2to(r3iydol  lncil( artax ont4tpen f3ild s2emuvsn(0 lxomf3tytfm   nes;s sexmim3nu4lpe mncta( a2ua( o;u1teeomoeiad s2rlnvs ()areomrciydoa  an o;t)tetm(r oy4lmeelncslsfaDua(  ou0olxomicildlm rm(vs t4 rtnio oa1lpt lies;t0srtmim iy1ame mfeil() 2tax poo1teenmieiasfm ulnmo (4 rtoir3iotoat anvi (  2uoio3nu1openmiviat a2um( o;u0tet ioetlslaDrlnms;u0trxnmociadop eli o ( teuoxm3io4lp   ivt t) 2trxm ;t0oee iictlslm2rlu snu0texrmo3iodfptraueolt)trxm(m oy4ape liesls) Drr(rpnu0tpeomi3ils mDua( p;u0 rxrmoctodfmtran s t  exmimpnudllt  ieslsfsrurxr ot4optnioetatla ua(vpnt)arxnmfcoadfaDe neols)setoirpny1ale lfet (  2rau o;t1tlx  fetas m2uanmont4artniociatla  auei;t)t2trxo iy4lptn nvi s)aDra(rpoo4apenmi3tlt s rmumo;t0alxrir3tytfa eauei t) rxoim3iy1ol  mfes s a2tm(r ;t1altomicilsfs2ua( snt4 etnmf3ia1fmtr ivi (  2uoim nu1apen fcs (f 2ra(r nt0tpe mieiyt m rl(vo;(0texomo3iatlp   ieo;t texmxopiy4llenmfesasfaruaurono0oex io3tasfmDuau pn(4 lenmr oytomD  i ils) rxoim iudole  ieia()srra( p;u4tltoioeiytla eaumonu)trxniocoytom r n sls teuoio iy4olte fcia(f Draumpot1tlen feiydls2ra(vs;t0 exnmf tytlmt auvils  2to(m no1aleelnctl() 2rr( ono1tlenioctatlm rm(mo;(0 rtrxf oo1late n ol(  2xoxm nodalt lfeia(  rtmx pou0tle  fciatfm2emu p;t) lenircoydfpDrlivs;t) euo(m3io4optnmfesl( aDtmxroou0aexnio3ilslm um(msnu0 rerif3oa1omD  nei;(0 rtoxo iu1ap nmfes sf 2ur(m ou4tetomociltla2umnmo () rxoir oodfp e uei ( srxriopio4olen fei () Drmxr ou4tpenifeild mDemump;u) rtrxr3ia1lm eaivo;()s2xo(o oudlme livtlsf rtaumoot0tetnifctldls emumo (4aetrmoctadfaD anvs;( t2tmimpnodom n nctlt sDrrx  ot0aex if3tadla2ulums t0aexrio oadfmt auei s teuoxm oo4aptnlicsls a2tm(moou0apx mo3tyt s2ul(msnt) lenmf ia1om  lueslt)sexo(m3io1al  mfes s s2trxrpot0alxoifctasls2ulums;u0artoio oadfp r nvilt) 2urim io1opt lnctl( arraxmpno1alxomictytla ea(vp t4trermf3oadlpDelu slt s2xrxr iy1om emfvias a2tmx  no4oetn i3ild s2raums;(4 exnxo3iadop r ieo t0 2uriopno1lpenmncsa(faruau p;u0oet mfeiltfsDum(mon(0alermo3oadfp eau ilt s2xrim oodaptelictltf 2umx onu1olx mi3ilsfmDelumo u4tlenmr ta1fatranvs;s) rtrio3nu1omeemfvil()sDum(mpno4tltn feiydfaDrmnvs u4 eermf3oa1lm  lneo;s sexmxr iu1opt  iei (fsDtaumo;t0tlt ioeiatlmDua(mpnu0arxnir3oatfp elu i s) exoim3oudapt lneias) rtmu o;o1aexoioctlslm2umnvp;t0arxrmfciodoa e u s;t srurxo ou4altnmfvil(  rua(r nu4tex mieiltlaDumu snt0 rxrmfciotfaDrauvo;s0 rumirpoudam  mfcsls sDra( oou1aetomi3tls mDrau snt)arxoxf iadlpteln o t)srtr(m io1apt  fvtlt sDrmxmpnu4aexoiietlsls emnms u0artnmr3ia1omteaivols seuo(opio4ome licils  2ta(ro;u0opeo ocias aDulnvsn()areniociadopDrli i (  2to(opio4oleelnvilsfarum(r nu1oetoif3tldlm uanvo;()alxomrcty1la e n ol( srumxm ny1aleemfviltfaDur( onu4oet ifcildfa2ulnmp;(0tetrxr3tydoa raneols) exm(m oodllte fvt (fs2uaumpno0apx mieiysfsDuanvo;(0 etrxocootfaD anvi;s srtoxr3io1lmee nvs (fsrum(monu0apt  fctyd m2rlumont4teenmfcia1lmDe ues;s srum(rpoudolee netas)srtmxr ot1apxn fctydlsDrmump u)alxrxrciy1lmtrai ols0 2tmio iy4lm elies sfaDumur no0oetomi3iysfm uln s;t) lxrxf3tatopDe neo;s0 2urxmpno4am  miet ( srrmx  nt1apxo ieilslsDem(ms;u) etrxr oo1opDr u il( t2xrio nydll  lfvilt)arumuro;o1ale mo3iydlm2uluvo ()arxrmrciy1fm rlnvil( srurir nudol  micsat)s2ra( pou0tetnii3ilsfa rmuvp;u4aexnmo todomtr uvs;()setrxrpiydol   ncslsfsDrrx ooo1tpe if3tasfa ea(mp (4 exrxr oytfpt lu o t0srtmxo3nudamt  feils) 2tax ooo1tlto f3iasfs2raumonu0 exoxo3oytfp eaivo t0t2uriopoy4lleemfcta(f 2uaxmp;o0tetoii3tadlm ul(mp;() lxrmr3iy1oa r ues;(0sexoxo3iudam  micil() 2umumpou1aetoiocilt aDuau s;t4 etoiociodfateaiei ()sexm(rpiudomt lfvtl()artau p;t0oexoifeiad s2em(ms u4tltoifcoo1fmteaueols0trum(m3no4alee fcsltfsDuaump;o0aetnmfeilt m2ua( o u)aeermfcoo1omtrai ils  etrxo3oodlpee icils  2ra(r ot4oet mieild aDeanvsn()texnxfcia1fp   nei;s0trtoxopoo1am nlfei sfsrrr( p;t1tptn oeiyt aDrl(ms (0 eerirciadlatrai s s0seuo(opiy1op   nvi tfarua(mont0ope iicilt a emumo;t4tlerir3oydopt  uei;t  2xoxr3oodoltn ncsa( srrrxrpnt1altn oetad s elnvs t0 lxrmocoydfpDelneo;t0 2uo(m3nydam e nvsa()srrmxmoot4ope ifctadfs2ean o;(4aetnmrcoy1lm  li s t  rxmimpnydoleelnesls  2tr( o;u0oetomiciydfm2ul(mp (4 renir iy1lptrlnvsl( srxrxr io4amen ieiatfsrumxmpot0texo ieils a2rln p;(4trxoio ty1laD auvol(0tetrxr oodlltelictl( arua(mo;t4texo i3iasfs2eln p (4artoiociy1lat  n sl( srxmim nydlp emfvslt)artmurpno4aet ifciydfa em( pnt0aeenio3oadlptraivs;s)texrxo io1lltn iei sfarta(mooo4tpen ociysfsDuanvo (4alerircio1lateauei;s  rum(r3ny4omtemictas) 2trumo;u0aetn fciysfmDumums u) eenxr oydfpDrlnes;s  exmxrpno1omee fcsltfarumumpno0tptn fetatlaDean s u4 lxrmociodla   nvi t0 2toim no1om n icta( sDur(mpno0texo ociasfmDumn p;u0aleomrctodoa r uvo;s0t2tmirpou1lm n ncsl( a2rm(rpno1texnmf3taslm em( p (4 etrmfciytfaDeli o t0s2xoxrpio4olee nctl( srtru  ou4opt  fetatfs2uauvon()trerxr3ty1lm  auvs (  2uoxr ou4oleemfvs ()arrm( pou4oeto f3ilsfmDuauvp;t)tlxnif io1optrluvi s trxrir3oudlm  miesl(f Dtax  oo0olenmo3tasfs2rlnvon(0 lxrxrctodfpD luvi;() 2uoxo nodap elfei tfa2tru pnu4apxoifctysfm2rmu o t4 exnmrcia1omtr uvs;s s2xmxopiu1omee nvi t srururpou1apxnifetlt a2ua(mon(4aeenxf3iatlaDe iesls0 2tr(m3io4om nmneil()aDrm(mpnu4aee mieiadfs ra(mo t)altnxf io1la eau o s  2xmxr3no4ll n ivta()a2rmxmpou0ale ifetasls el( s;u4 exnif tadoa rau i;t)sexo(o3io1lpt  icia()aDumx  oo0apxomiciydfs ul(vo;u) exoxr3iatfmDe nvi (0srumxm ou4ameelncia( srtmu p;u0aetnmieiyslmDemnvo;()trtnxr tatfa eaieo s)t2urxm oydalenmnes s  Dtmuro;t1tltn oetytlaDrm(vpnt) rxnirciadlmDrau sl()sexr(r iy4omenmieta( s2trurono4tleniietydla2ra( s t) exnir3ootomD lnes () etoxrpoy4apeelivsls) 2tmxmpno4oexomocils mDeauvon(4tlerio3io1op ran ils) rto(m3iu1lltnlnvsl(f Dua(mo;u4tptnmoetasla rauvs;u0alxnxf3iydop   ieo;(0 rurim iu1ol  mieta(  rtax p;t4opxo fcildlaDrmnvon(4altrio to1fat  nei;t)s2uo(opio4amt  fvs (  ruax pot4oleomo3tysfa2emump;()arxnifciodlpt  uesl(  rxoxo ou4oltelicsltfsDtmxmp;t4aetnmieiadla2ulnmon(0trtoxf iytlaDeln il()s2urxm oodom nmfvs ()arururoou0tpx  oetad a ranvonu0aetrmr oytfatrauvo;(0 rumio3iudlpeelfesatfaDtru  nu0apeo i3tadlmDel(vs;t4areoiocoy1fa rluvi t0trurxo oodaltnlfcsat s2raum ;o1teeoiociadfs2el(mo (0tlxoxr ootfm  liesl(0tetoir3io1alte ivs t)sDrmxmpno0apenif3tasfmDeln o;t4 exrmrctotoa   ivs ()t2xoxo3oo1ope  ncslsf rumumpnu1apt mictyslm ea(vont)aleoiocto1faD  nei;t0 2xoir ou4ap e net s) ruaur ;o1aexo ociys m2rmuvon()aeerircoa1lpD  n i;t0seumim3ou4om elfcsas aDuau poo1apxn f3tydla ua(mpn(0arxnif3tatopte uvi s  2xo(o nudolenmivil(f 2taur ;t1ope iieiaslm em( p;t0tlxrxf3todlpD luei;t) 2tr(r iu4olenlfciltfa2trxm ;o1tlxniietat sDem(vont)trxnifciodfp   u o ()s2trimpoy1op  livsl()sDururp;o0teto fciasfsDumnvsn(4 lxoio to1omDeau i t0 2tm(m3oydlp n ics tfa2tmur ;t4oeeoiociyd a2ul(mo;(4aeenmf3tydfaDr u i;()trurirpiu1amt licsat) 2uau o;t4tpeoifciad a2rmnvo;(4 ltnircta1opDraues ()texoxrpny1omt licsas s2tm(roou0alxnio3ilt m2rm(msnu4 renio3ia1opD an i ()s2trxr3io1opt  iei sfsDra(mooo0oet iiciaslmDum( sn()texrmocta1fm rli o;t0 2toim3oo1lptemncias)sDua( o;o0opeomfeiytla ra( on(0arxrxr todoaDrau o ( t2tmxo no4llee fctlt a2uax ont0ape  oeiltla2rm(ms;(0artoxo ta1lpteaivi s0 2xrxm oy4omeemnct sf rumx  oo1oexo iciatfm eanvs t4tetrxfcio1oat luei;(0sruo(m3io1ap elivsa()arra(r ot1altoifeiyd a elump;t)altoirctytlpt lu s;()s2xmxm3iy1amen nvi (fsrur(mono1tpxn iciydlaDean pn(0 eenioctodlatrau ols)seto(o iy4olenmneil()arta( ono0oexo fctld sDel(ms (4aeerirctodfaDelies;(  rtoxo ou1lmt lnciasfsDta(  ou0ale mi3ilt sDemnms;u0teerio iadlpDeanvils)teuoxm3oo4oltelfei s)aDrrumo;u4opeo oetls aDra( p;(0 leoxo tytla   nvs ()t2tm(rpiodomtemncsasfs2rm( o;o0oexnmocias s um( s t4alenmr3todfmDelivsls0srtoxrpiu4apt  nvtat) rtru ont1aeeo octatlsDrmnmp ()aetnxo3totoaDrlnes;(0trxrim3io4al emivsat aDuaxm no1ope  feiatfs uln s u0alxnircoatoa   uvs;t t2toxopno4op n ieils  2tau pnt4tpxo o3iadls2umn snt4tltnxo ia1op ranvsl(  rto(r iu1lme  fci s aDtaurpno0ale mo3iltlmDranvo t4 exomf ta1lpte i i s) 2xoir iu4lltemnvtls aDtrurp;t0alxnifeiaslaDrmumo;(0tlxnir3io1fptr i i;t)s2uo(m3nodalt micsatfarurxmont1olto i3iydls umnvsnu)tleomrcoo1om  ai sls0srumiopiudapt micilt  rtrx pno4tleomfciltfmDrlnvon() exrif ty1optrai s;()trxmiopnodol nmictl( s2tmx poo1tltn f3tydla rm(ms t) lxnir oadoate uvs t sexm(m3iodlp elicils)srua(  ou0teenio3iydfmDrmn o;t4 ltnif3oydlptranvilt)sruoiopio4ll  miei (fsrtmxm ;u1aleomo3tlslm2uan pn(4trenmrcoa1lmDr n ilt)trxrir3nudamt mici t)aDua(r ot1aleoiiciadla2rmnvs;u4texnio oo1lm  ai sl(  eumirpiy4lm   fesa(fsrrrxm ;o4apenifcilt s2uau p u4tleomo iodlmD ln o;t)t2tmxmpnydlle lncils)aDurumoou4tpe  ietys a rm( p t)treoxr3oa1fmtr ivo ()srurxm3ou1ap elfes (fa2tmx ooo0apt mi3iysla elumsn(4aeeoifcoytfpt auei;t0texoir ou4altnmivs (f rumu o;o1alt mfeiydfmDea(vp;u4aetoxociydoaDeluei;(  rum(m ny4lp nlneilsfsDtau ooo4tlxoifeiaslsDumnvonu4teerifctytfpteln i;(  rxo(m3nu1olt  ivi t) Drmumpoo1aptnioctydla elnmo t) eeoxo oodlm  livi;s  2xmimpny4op   nei t)s2raxrpnt1tpeomoeiyslsDemuvsn(4aeenxo3to1oate nvsl()srxmxopiu1ol elnvta()a2urxm ot0aee mfeilt aDumu p u0teermf3io1lp raues t)tetmxm3iy1lltelnvils artmu  nt0tleniieiatfs2um( on(0arxnxrcoy1opD lnvs;s)s2tmiopiydalen ivslt s2rmxmono1oltomoetadfs rauvp;t0 rxrio to1la  lu ol(0srxrxopnu4amee fcsatfsrra( ooo0tltniociat m rmnvpnt) rtrifcoadfmtr ueils0s2umim oudole  ietas) Dtm(rono0aetoif3tyd sDuanvo t4 lenif3oatom eln il()s2xmxr3io4al nlictls) Dua(rpnt0apx  ieiat mDemnvp t0tleoir to1op  lu i ()texr(o iy1open ict s aDraum oo4aetn feiysls2um(vont0artnio3todfp rli i t0 2umxm no4alt mfvsat)sDtrxmono1aetn fciatfmDea(vp;u)areomf3tytom e nvs t t2xrio3no1ol  liet ()s2um(rpno4alx  octltfsDul( p;()artnio oy1lm eau ilt)trtm(r3nydop  micslsf ruau o;t1ole ifeildfs emn s;u4 rtoifcoa1faDrlnvi;s0seurim3no4alenlnetlt s2rrx pou0opxnmicildlmDranmp t4 ltrmr3iy1oat  n sls0t2trxr3io1ll n fvslsf Dta(rp;t0texoifctlt a uauvs (0trxrxo3iotlmt aneols0teurxm3no1llenlfet tfartaxrpnt4aee  ociydfs rlnvp u0trtoxrcty1lpD  neolt)srtm(o3ny4lle mfvt t) Drau  nu0alxniociytlsDrlu s ()treomfctatfm   ies;()teuoir iu4optnlfvt s) rtaumpno0tle miciytla2rlnvo u0 ltnxo iytlmtelues;t) eum(o nu4apeelncta(fsrua(m no4aptnmi3tasfs rmuvp;u4aetrioctodlpDean ilt)trxmxrpoo1lp emfvsl( s2um(rono4tpxnif3tadfs2ran snu0treoifcto1fpDrlneo t0srtoir3iu4alen neta( aDur(mpnt4apeo ieias aDeanvs (4tetnifciytlpt an i;s)tetoxr3nodlm  mfesat)arua(mo;o0tlxo f3iyt m eluvo (0treoxr3oadfpDr uesl() etrio iu1lltnmicsas aDta(r ot4opxo f3iltla ul(mp;(0aeeomo oodoaDraivs;t texoxm iy4amen fvslt)arrau  no1apxnifcilsla2emuvonu)tlxrxo totlm  ai ols) rtrimpny1ll n neils)sDrm( pnu4oee ifetatfaDem(vsnt0 lxrxf3iadfptrli i t tetoir3no4apeelnvtas s2ua(m nt1tee  iciad s eluvp;(4 etoxo3oatlmDr nvol(  exmio nudameemnes tfa2tmxmpoo0aee ifciltla ranms;u4arerxrctydfp eli o s0trur(o3no4op nmieil( a2ua( o;t1tpe iieilsfm ranvs (0aexnxf iadfpt li o s)t2xrir ou4aleelfvtlt  2uax  ;t1oet  feias m2um(mont0teerxf todfp r iei;t) rtm(m ny1olte fvt s)s2rrx p;t0tleomoeiyt m2rlu pnt4 lenmf oytfptraivs;t0 exo(rpiodlleelneil(fs2rmxrp;u1optomi3iyt sDuau o (4arxnmrciodlmD ln s;s0tetm(opiy4ame lnes t a2rmx ont0olt ifeiyt a2eaumo;t0arxrmr3oa1faDrlnvo;s  2umirpiy1lmeelfct ()a2umu pot1oltn o3tat a ul(vp t4aetoif ty1la   ieilt)srtrimpoo4lmt livi () 2rmumo;o4ale  i3iatla2uan o;u)alenmr iatoat anei (0 eum(mpiy1ope mnes sfsDum( o;u0aleoio3tysfs2rlu o u0aetnxr oodfmDeaies t)s2xrxopny4alt  ictl()a2rmxmono4aeto ieiasfa eanvs ()texoifcoodoaD  ivi (0trxmxo ou4ol  lfesls srta( ooo4opt ioetydlaDemu p ()trxnxo3iydoa   ueo;()t2xmxopoudlmenlnvslt) Duru o;o0opt mi3iydfs rluvo;t) lenxr3to1fm   n ils0t2urirpio1omt lnciltfsDuru o;o0tlx  o3ilsls2ran s;u0 eeomo iodlmDr uvsls0srto(o ou1lleelfci sfartmu oot1olx mieiatlm2ra(ms t) ltoiocoadfptrlnesl(0texrxr oodol n fcslsfsrrr(rono4alto ociytlmDea( s;t4 lenmo3oadopD anvilt0t2xoxm nu1alte fct tfsruaum oo1alenmo3iat a ua(vo u) renxr ty1la eluvo;t s2xmxmpiu4olt lnctasfa2trumoou0altnifeiysfa2um(vo;(0aexnio3ta1fmDrliesl( trtm(rpoy4ll emfctl( aDua(r ot4ale  fciad mDelump u0 ltrir3iy1fp eauvo t0s2toim no4ame  icilt) rtaum nu4alx  fciysfmDem( pnt4 lenifcta1la eaieolt0texrir oy1lmenmietlt) rra(m no4oee ioeiadfs2rluvs;()aetrxo totfmDeluvo;t)t2tr(r iu4apen netatfsDtm(mpot1oeto ietlt mDrluvo;t)trxomo oatfmtelnvo s)t2urxr nydopt livs (fs2urumpnu4tpenmi3iat m2emums;u)artnmr3iytfatranvil( seuo(m3nu1olt lieiat)sDtmump;t1oeenmo3tls m2elnms;u)trtrxo3iatfmD  ivo;s  etrxr3oo4amt licils arum(ront4tltnmoeiyd m eanmo;t0aeerxr to1fmD lnvs;t0seuoxo ou1opee nvi s)aDtaurooo1tetoifeildlmDrmn p (4 renir3iy1lpD au ols  2xo(m nu1lleemict tfsrrmxrp;t1tltomiciadlaDua( s t) etnxo totlm  ai i s trxmxo iy4am   iei s) 2umxroou1tle moetltfaDuln ont0arxrmrcootomDeauei;(0sexmxo iu4oltn ictat)s2rr(m nt0alx  feilslm ul( on(4alxoifciydopDe ieo;()sexmxm3oo4lmt lfcta()srtmurono4aptn f3tat s2eln o;t0 eenir oytfatraivi t0sexrxrpiu1llen feias) Dum(rp;o1tpt mo3tytlm rm(mo (4artrxo3tadlpDeln i t0t2tmir iudopenmfvtlt)aDtru ont1oee if3tatlmDuanmont0treoir oy1om   nvilt0 rtmim3ou1olee fct () Dua(mp;u1tlxniociytfmDuauvs u4artnmo oo1laDeai slt trtmim3oydal  mics s a2tm( poo1oexoiieilsfsDua( on()trtnmf ta1opDraivs (  rum(r3oodole mict s  Dum(mpot1oetnifcias m el(vo;()aexnmrctadlaDe nesl(0trumxrpou4lm   fesat  Dtrxr ;t1tltoifctytfa uaums (4 ltnifcoatlmDr ues;s  exr(r iu1lm nmnvsa()s2rmur oo0tlt  i3iltlm rauvpnt)altoif3ia1latrli i;s t2umxm3no1apee iesat aDuru pno1tpe mietysfm2ul(vo;() eerif3oatoaDraiei;t tetoxr oo1lpen fctas) rrrxmont0tltnmoetldfa2uanvp;t0arxnxfcootopD luvi (0srumir3io4lme lfctatf rrauroou0aee  f3iytfa2rm(vs t4treoifcty1opD lueils0seur(opnydomen nciasfsDtm( poo0openmfctydlmDeanvp (4tetomr3tadoa   nvslt0t2tr(o3oo1aptn ies tfaDuau p;u4optn f3iad m2uanvont)aexomf3iy1fmDelu i s0t2trirpiydapeemnesat srtr(mooo0oet  icildfsDemn s;t4tleoxo3oadomDe ivsl( sexo(m3io4ll nlfeilsf 2raxmpnt1opxnifeilsfa2rl(von(4tetrmf tatom r ies s0s2tr(r3no1amtnmncil(fa2umx  ;t0tlenii3iadlm ua(msnu) rxnxocootfmDeauvo s srtrxo io1lmee fctls  Drrumo;t0apx ifetatfm rluvp;t) etnxf oytla eli olt0texo(m oudlleemfciat  Durumpoo4aexniieild sDum(mo u4aexnxo to1fateanvs s) exo(o ny1am  mnesltf Dra( pno1optnmfcild sDraums t0 lxoxociadlpDeai o (  2urxo oo1ape mivi s  rtr(mpnt0ape  ociyd s2eanmp t0aexoxrcoy1om raivs;() rxrirpiodaptelics () rrrxmpoo0openmfeilt s um(vs;t0areomf iodlaDe n o;() rxrio ny1aptelncsatf Dumum no0tltn oetld s rlump t) ltomr to1fmDelivo (0t2tmirpoydoptnmfet () 2urxm ;o0opeomieiyd a2elums;() renxo3tadlaDr nvo s)seumirpiodomtnmfctas)a2rrxmp;t1texn ieiad sDumn s;(0 ltnio3ta1fmteaueol(0seum(o ny1amen fei (f rtrum oo1alenio3iltls el( o u0tlxnmr ty1op rlieolt0 eto(m iu1ll  mictls  rrmxrpou0oeenifeildla2uaump ()texrxfctatoat lnei;s sexm(mpoydoltnmnvi (fsDtrx pou1ope if3tas a2eluvo u)alenxo oydfat  i s;t0s2triopoo4opeelfei t  rurur ou0apx  o3iytfs uaumo;t4 lxrmr3iotlptr nvo;t  rto(r3oodlm elivtlsfs2ua(r nu1aeto o3ils mDumn ont4alxrxfctatfatraivils)tetrxm oo4lpe lnvilt)srum(mooo0oeeomoctldlm2eau p u4tlxnircoytop eli i;()s2urxo oo4amen nct s)aDum( poo0tle iietytla elump;u0artrir3oydomDelies t0 euoim oudoptn fvs s)aDrm( oou4tleoifciaslsDea(mo;t0altnxr3oodlmtr ues;s0srxrxr ou4apeelicsa(faDraurpot0aleo ictltfm2rmu s u4arxnmocootfp  auvi t)sexmxm oodolee neiat  2raxm nt0aptomo3tytla2uan p;t)aexnmrciytomteli s t0teuoxrpnydlpt  ictat)artmx pnu4ope ii3tltfsDran p (0alerxr3oytom r iesls)srtmxrpnudlmt  ictasfaDuau poo4teeo o3tytlaDuan p;() exrif io1lm  anei t) rxoir iudome mnvsasf 2ur(mono0opx miciytlsDem(vpnu0tetrio iatlmtrauvil()t2xr(mpoudll nlicta(faDraurpoo4tlto o3iytfm2el( s;(4teerif3oadfp ean s;s0 2tr(r nudoptnmnvia( arrr(  nu1tleo iciyd a2ulums;(0alermr3todlp elu sl()teumiopnu4omenmictls)aDtax  oo0teeo i3tyslsDrl( onu0teerir3oydfmDe nesl(  rxoxr oo4llte nvsl()s2rrx o;t1ole iicildls2elu s () etrioctotfpD  n i () 2uo(opny4amen iciltfs2rau ooo4apenmfetysfa uan o t) leoif3oy1fp e nvs s  2xmirpno1ol n neslsfarrau o;u4aexoiietld aDumuvp t)tlenxrcootlaD anei;t0s2tr(m nydapenlictat)aDua(mpno0olxo oeild aDrau o;t)arxrir3iytlatranesl(0seuoxopio1lptnmfetlt srurxm nu0tpxn feiasfmDrlnvo t)tlxrmf3ootoptrln i t s2xmxo ny1apeelfvsltfsDtr( oou4tpt mo3ias s emnmp t4aeenmfcootop  aues ( sexr(r iy4amt mies s a2rm( o;t1apeo i3iyd s emn o u) etrxo3todla rai ols) rumxr iodlle mfes ()sDtrxr ;t1tleniociatls uln o t)aeerxrciytomte nvil(0 2xrxo3oydlpt micia(fa2taumooo0alxn f3iatfa2rm(monu4 rtnir oy1oa  an i s0 2xoirpoydaptemfvsat artmu ont4tpenmoctltlaDemumo;u0artrir3ootfpDe i i;s s2toir3oy1op elfciasfaDtm(m oo0aeeomieiasfm2ulnmo u4 rxrmf ia1fp  luvo s)trumxrpno1am elictltf 2rmurpoo1altoifeild aDeanvpnt) lermr tatlmD  nvi s trtr(rpiu4lm  mfctat  2umxro;t0tle ioeiltfmDrlnms;u0 rxomrcoo1lm r n slt) 2tm(o oy1omte fvt ( sDur(mp;t4tlt ioetlslmDum(vp;(4artnifctydop   n o;t)trxrxm io4lptnlivil(  2uru  no1open ociytla ulumonu4aexoir iydlm eanei;()srxo(m3iy4am n iesls)sDtrx pou1alt mo3iltfs2emnmp u4tlxnxr oodlp eanvo s0 2xmxo3io1am emneils)aDrmx pot4open f3iltlsDem(ms u0alxrxociydlmt  ieil() eurxr oudopenmieia() Dua(rpno0opxo oeiasfmDua(msnt0 ltrmo3todla  ai i s0 etm(o3io4omtelneiat  Dumxmoou4tlto fcilsfmDua(mo;u4 renif oadlpDr ies;()setr(o3ny1lpe  fesls)a2taum ;u0teeoioeiydfaDelnmo u0trerir3iotfp  luvs;t)srtrxopoy1lptnliciat) Dra(rpno1olto ieildfmDumuvs t4arenir oa1fmte i ils0s2uo(r3oy4altelneia()srta(mpno0ope  o3tydls uauvon() leomf iydop eau s;s0t2xo(m3io1amte nvta(fartr(r no0aexoio3ildfm raump;t)alxrxr3iodlp elneslt) 2tm(mpoodam   ici ()aDrr( onu1aptomiciydlm2rauvo;u0 ltrifcootlatrlnei ()seurxm3oydllen ics s a2rrxmo;o0ape  fciatfm uau on(0alxnif3iydfate u s t) exo(o oydam emivtat)arrrx oot4tleomiciatls elumo;u)altriocia1fp   nvs t sexo(m no4ll  mnes ()s2uax p;o1opxnmfeiadfm rluvon(4 rtoxo iodlaD lnvs (  rumxo3oy4lm e neil() ruaxr ;o0ope ifciydfa umu pnt0tltrxocootlmte ueol()trurirpiodamte net ( sDumxmo;o0aetoioctad mDum(vp;u) exrmo ootopDrln o;s0s2xr(opoo4lm elnvt (fartrx ono0open oeild aDea(vonu)tlenif3tadlp ran ol(0s2urir io4ol elfctat) rumur ou1aetnio3tldfaDem(ms t4 lenxf3oo1latelues;()texrim no1llt mnvtatf Dtm(m ;u4teeomi3ildfs eauvo;u0 rtrif oydfa r n s s0trtr(o nydap nmnci t arrmx p;t0apx  oeiysfs rlnvo;u0trenmrcto1fpDeluvo t)t2xr(r3no1apeelnctasfaDum(moou1tpt mocils s2ra( o u) lenircoydla eaies ()s2to(r oudlpt mnesls) Dtax onu0alenmi3iydls2uanvonu0trxnxo3iodfa e uvo;t trxm(rpny1opeeliei () Dumuroot1tpeomf3ildfs uln s t0tetrmr tadfateluei;(0 2xo(o oy4om emfvia(fsrrmxrp;u1tptn o3iysfs2rmu o;(0aexoiocoodoa r ueilt sruo(o3oy1lpt  ivsl()a2urxr ;t0oex iieiyd m2umu p;u0alerxfcootfp rlueo s0 rtr(r iodom nlivi tfs2tm(  ot1altnmociltlaDel(ms (0 lenir3oytfaD aivilt0 2um(opoy1lpeelictl(f rra(  nt4apx mfctadla2ulnvp t4alenir iydlatraneils srurim3iy1ope  fcsat a2rrumono1oleoioeildlaDrmnms;t0 etnmr3tatfpD lneil(0trtm(rpnu1lmeelietl(  2uaxr nt0opxn f3iyd s2um(msn(0tetoiociytlm rluvo;s0 rxr(o3nodlm e fetls)srtmumpno0tlx iociyd a2emn s u0 rerxf3tadfp r nei;s0s2urxr ou1olenmfeslt) rum(  ;t0tltomiciad m2rm( s;t0aeermr ia1fmDran ilt)t2uoxr3ou1lm   neilt  Drr(m nu0opxnmictatlm2uauvpnt0altoir ty1lmD  i sl() rxrxm io4lm  mieia() rtm(  nu1oltn i3iytlsDel(mpnu)texrxfcio1op elu s (0 2xo(opiydalen ietlsfartru  no4tpeniociydla rmnmo () rerifctydfp  lu ols)seurir3no1am emnesas sDtrurpno0tex  i3iat mDranvs t4trxriocto1fm eln i t seumim oy1ol e net t)s2ra(r ;o0tleoiictydfa2umnmp;t4 rtnifcootfm rlueo;t0 2ur(m3iu4open nei s)s2ta( o;o0ale  feias a rmuvonu) etnmo3ootopteanvi t)srto(r3ny4lpe  ieils)srraumonu4tle mo3iatfm ulu snu)artrmocoydfm eaiei;s)truo(r3ny1ope mnesa(faDur(mpoo4oetnmi3iys aDrmnvsn()teenmf3tytfptr nvi s0trto(mpio4oltnmneta( srtaxroot1tptnmfetld m ra( p;u4alxrmf3totom elueo;s t2um(o3io1lmt  ncias  2umxrpnu1olxn f3iydfa rmumpnu0aleomf iodlaDrau s ( texmxm3oydlltnlneslsf 2raum ;u1opx mf3ilsfa2ua( p u4 exnxo3oydoat lu olt)t2toxm iudalee icsls sruaum oo1oetomictasfa ra(ms;t) rxrxr oydom eauvo;s)sexrim3ou4ame  fvsa(  2tmx  ot1apeomi3iytfa rm(vo t0 reomfctodlateln o (0s2xoxo3iy4lltnmfcilsf 2umu ono4tpe mo3iadfm uauvp u4tltrif3tadlpDraieo ( tetoim oydlm nmicsa( a2urxr ot0alenmociatlmDumu snu4 renxr3tatfptrlivi t0 etoio3io4omtn fctls)sDtmu pnu0olt mictat m2eauvo;t0 rtriociotoat aiei s) etm(mpno4lltelieil()srtrxr ;o1alxn f3tldfa2eauvp u4tltoio3oadomt aivo s0sruoir3ny1lm emneia(f Dur(mont0apeomfctyslaDumu sn()texnmfctodlateaieil(0t2xmxr iy1op n ies () Dum(m nt0aexo fciatlmDeluvo t4 rtnxo3oytfmt auvi;(0trxr(r io4ome mfesls  rurxm ;o0tptnmieilt s uanvonu0trxoxo totfptraneo;s0trxo(o3iu1lmt lfetl( s2trur ;u0oee mf3iltlaDuanmp;(0 ltrmo3iytlpt au sl( tetmiopno1lmeelicsls  2rr(m ;u1apx ii3ildlsDumumonu)tetrmociodfpDrlueolt0 rur(r3iy4al  mfetls)arrmu o;u0opt  i3iys a ran o;t4trtnxoctytfat ai s ( t2xoir oydolenlfvs t)sDtmur nu0aexomoetlsls emnvo u4 rtrirctydfpD  ivilt0sexmio nu4ll e nesas) rtaurpot4altoio3ilslsDeluvont0altoifcia1fa r iesl() etr(mpiudlpte ivs t) Dur( ono1oexnmo3tlsls emnmo;(0tlxrxr ia1omD luvi (  rtmxr3nydop e nctas)srrru  oo0aexnioetld a umumo (0tetrir io1fm raivslt0sexrxm oy1amen nct (fartm(m ou0opx mfetysls rmumsn()areomr3iytlmtr uvo s  2umxm io1aleemictas arur(moou4opt iietytla uluvo u4tlerir3oy1latelnvi;t0srumxm nydolt lfciasfsDtax p;u1tpen feilslsDrm(ms;u0alenmo oydoaDran s;s) eumim ny1lm e nes s)a2ua(m ;t4aexniieiat m2em(vs u)arxoxo iytlmDelieils0 2toir3iudoptemfviltfsDtrxr nu1alt io3iadla ra( pn(4aeeomfcoydoaDrli slt0 etrimpiydlm n fvsa(fsrrmumpoo1alt  i3iydlmDul(vsnu)trxnmo iytfp  lues t0t2toim iydomee ncs t)s2umx ono4opxn ictltlm2ra(vp;(0altnxo3io1oaD anvsls0trtm(rpnu1ape mnvil() 2rm(rpno1aee  feiltfm eanvont)tetrir3oatop   nes;s0s2trim3iy1lmeemfvtat) rua( p;u4olt  fetyt m umn p t4arxnif3iotla rli i;(0srurxm3iudolt  fvs s)artm(mo;o1tee ifeiltfm2emnmo;u)tltomrctodop rli o;(0 2xo(mpou4olt mnci sfsruru pot4aet moeild a rln snu4 lxnxo to1fmDean o t0setrxrpno1apenlivsa(f 2rm(mp;o1alxomfciad a2um( p;u) leoif3iy1la  aiei ( teuo(m3nu4olen nvt ()sDumxr ;u0olxnmociytls2ea(mo;t0areoif iadfptrluei;s t2tmxo3iodop e fciatfa2tm(r no1tpeoioeiat s2rlnvpn(4alxoxr tatlpDr nvs (  rxoxrpny4olt mict ( srrm( pnt0tpx iieils m ul(vs;u4altrmrcoodfa rlieols srtmxmpoy4ap elnesltfa2trumpou0alxnmoeiatla um( s;t0tetoif3totfp rlneslt)seurxo3oudam  mnvt t  2rr(m nt4aleo ocils mDea(vpnu0 rermf3tadoat auvo;()seto(o io4omeemiei s artmum ot4olto o3iltfs2ra( p;(0alermr iydfaDeauvs t teuoimpoo4lltn neias sDtax o;o0ope iociltls rlnmsn(0 eenxfcoodoaDrli s;t) etoiopoy4op elfvia( sDrmu  nu1opt ifeias s umnvp u) eermr3oytfa e neo;t) eto(m3io1lmee fesas) Dtm(moot4oeen icilslm rlu p;u0aeenxo oydopt aiesls srtr(o no4op nmiviat s2ur( oot0tlto fciys aDeau ont)artnmoctatoaDe i o;s)t2uoxr nudlleemict s a2rm( pou0tpx iocilt m uaumo t0tlxrxoctodom e nvs t0s2tm(m3oydam nlnes t) Dtm( ont1olx  ietydlm2ra(vpnu4tlerif3iy1lm e nesls) eumxr nu1op nlfesas)aDum(rpnt1aptnmieiaslm2eluvo u4aexnxf3iydlm   uvi;t s2um(r oo1optnmnctat aDtrurp;t0oex  i3iltlm rm( pnu0aexrmocta1opD lnvs (  ruoxr oydap emnet tfartmxr ou4olx iiciyd a2rmnms;t)trxniociytfpDe uvi;(0 rtr(m3no4lp e feiat)srtmxmo;t0tltnio3tlsfm2uauvp;u)alxoiociydfat auei ()s2xoxo ou4lmtnmnctlt s2ur(m nt4aexomoctyslmDrl( p t)treomf3tydoaDe ivsl() 2ur(r oy1lp elivtat artm( pnt1apxnifeildlaDua( p;u)trtnxfcoo1oatean o ( s2xoiopiydolen fvsat)s2tmxmpot4oetoifeias sDra(vp;u) lxrio tadfpD aneo;( trxriopiydlm  mnes ()aDtrxr ;u0apeoio3tas aDrlnmonu) etrif3oodfaDr u ilt) etm(o oodlm n nvsa(f Dua(ro;u0tleo o3ilsfsDemump (0 rxoxf3ta1fm r ivolt) 2urxr iydal n icils) Dtru onu1ape  fetldls rlnvs;t0tltnmr iytlp   u s;t0texmio nudol  mfvi t)a2trxmpnt1texnmoctldlsDeau o;u0alenmf oytlpteaueols texm(o ny1ol e icsl(  rtmurpnu1tptnmoeiadlm ul(mpn()aetomf3iotop  ln olt) eur(o3oudam e fctlt) 2ua( oot4olxniociasfs2ra( s (0trxnxr3oo1la  li s ()texr(opiy4om   nvsatfa2tr(m no0oexniiciydfa2rmumpnt)aexrxo3iotlmD lueils) ruo(o3iydopeelfcs () Dtaur oo0tlxo feiytfsDelnvo (0trenxf iadfaDeluvi;()sexmxopiudolenmivtasf 2uaur oo0apt  fctasfsDuanmpnt4 etoiocoydoptelu i;t  2tmxmpoo4alen ieslt)sDrrx pno4tptomoeiyd m elnvp;(4trtrmo3iydlmt  ivs ()s2xo(r oo4opt  ncs ()srraxrpou1aeeoif3ildfsDrm(vsn(4 rermr3ia1fp  liei;()tetoirpnu4lm e ivi tf 2urumoot0apxn oeild mDumnvp (0alxnircoa1fm r u olt)trtmio iydlpeelnvs ( aDuau onu1alxo fciytlm elu o u)teenio oatfmDrluvo;( trxr(opno4llte ietls aDtau o;u0alxo f3tldfm2emn p;u) lxomf to1oaDr nvo;t0 2tr(opiu1ap   iei s sDur( o;t0teeomieias a2elnms u4trermo tadlmt  nvsls  2toxo3iydlmenlict ()aDur(moot1tleomictyt sDrmums t) eerxf3iotfaDeai slt)texoir iy1lpee fvslt s2ua(rpot1apt io3ilsfs2rm( ont4 ltoir totfpt lieols)s2xmiopnu4altnlncta( srua( ooo4alxomietltfm el(vsnu)arxomr iadfmD anvo;t)t2tr(opnodlp e nesatfarur(r no0tlx io3tltls ul(vo (0aleoxo3tatlm r ivi;t0trur(mpoy4aleemfet ()srumxr ;o1oet mo3tldlmDrmuvon(0 lxomr3to1oaD  uvi;t) rtmio oo1ll  mfvs tfaDtau  no4aetomieiydlm2rlnvo;()alxoxr3iodfpDrlueslt0seumimpou1op n feias)a2ua(roou4apto f3tasfm ra(mo;u)trtnif tatfm  au s s) eumxm3nu4lpte nei s)a2tm(r nt0ope moctys a ul( sn(4 rxnif todopDeliei;t0 2triopio4oltnlfvtlt) 2tax pnt4oleoioctad mDuanvs t0 lenmf3tytla  lnvi;s  rtr(opiydomee fei t) 2rrur nu0tetniiciytlsDul(vonu0texnxrcto1lat  neils0tetmxrpio4ape  fct tfsrumur ou0apt miciys a2ul(vsn()alxnxrcoa1om eluvolt0t2trxopiy4open fvilt)arraxront4apeomieilslsDem( p;()areoircta1fp elivils) rtmim3nu4alee fetl()sDuau pot1tltoiociatlsDemuvp u4 ltomocia1fm r n ilt0 2urxr3oydomen nvt t)sDumur ou0open feiytla ean s;u) lxomf iotfp rlies t  rxoxr io4ol emnvslt) rtr(m oo0olxo feiys sDrm( o;(4 rerxr iadoa rai il(0 rur(mpno4ap elfvi t s2rax  ot1tptomoeiasla2rl(vonu)tlxrmfcoydlpt aneo;t srtoiopno1ap n nvsls)aruax onu0tpx ioetat s elu snt)tlxnmrctotlp rli sl() rxoir3oodlm  miesas a2trx  ou1optn ieiatla2emu p u4 exnir iatomte n s;s  exm(r3nudop nmivtls) Duru p;o0ole mfeilsfm ea(vsn()alermr3iodomDr iesl(0sexrxr3iy1op  lncsas srur(m nu0ope  ictldfaDumumo;(0 renircoatla rlu o t0trto(r iu4ap nmnvi s)aDuaxm no4aetnmoctldfm umn onu0teerio3oytoa elnvo s0 2xoimpoo1am   nvslt srta(root4alto fciatlm eauvp;(0 lxnmfcia1fatelu i;s0 euoxm3nudlpt  fct ()s2urum nt4optn f3iatls ran s t4 renio3iydlate n ols)teumim oy1lpen ivi t)a2raxrono1oex iieiyd m ranmpnu)alxniocoo1op e nes;()trtmxm oudlpenlnvt (fsDrmumpno0tee  f3iydfaDrmuvs;(4artnxr iydoaDrli i;t  exm(r ou1apenmneiltfarrmurp;t0opxoifciltfm2eln o;u0 exnxrciatfatrai sl() exoxrpnu1lm n ivtas)arrm(  no1oetnmieiydfm2um(msnu0 etrif3tytomteauvs t0srxrxm3oy1op nmfcsl()a2tauro;t1olx iiciydlsDua( o;t4arxrif3iatoatrlivsl()s2tmio3no4lm nlncilt) Drrxr no0aeeoif3iytfsDem(msnu)aexnxo oatfpteliei;( t2uoxo oodlm  licilsfsDuau  nu1tetoifciysfaDeaumpnt4tlxoxocoydopD  ivs;s t2trxo oo4altelfeslsf Dtaum no4apxo ociytlm uan o;u4 rtrxf ta1lpteaueo;t  eum(o nydap e netat arurx ont1tle mo3iadfs rmnmo;t0alermo3tydlmtraues;s)trxrio3ou4ole mfeia(f rua( p;o4aetniietad mDea(ms;(0trtnxf3ty1la e n ils srumir ny1ale  ictl(fa2ra(r no4tleo ictltlm ulumo (4trtnxo oa1lp  ln i (0 eur(mpno4amtelfvtatfsrtmx pno4oexomicils s emuvpnu) lenio iy1laDraiei t trtmxm3ou1oleemnciat) rururpnt1tlxn f3iad m rln onu4altomr3totfaDrauvs;t0srxm(r nudolenlfvilsfarraxrp;o1tpt mo3tys s um(msn(0tlerxfciadfaDeanes (0s2xmir3oy4om n icsltf rtr( o;u1tlenii3ilsfs ul(mp (0aleomoctytfpte nvs (0 exoxr3io4al n icta(fsrumx o;u1ale if3tyd sDemu p u)tlxnxr3iodlm   nesls0 ruoiopnodomeelfvi (fs2tmxmoot4aleniietytlaDuauvp;()texoif3ta1fp eli olt0 eurxr3io1ome lneils  rtaurp;o4opx ioctat aDeau p t)arenxr3ootop r uvi t0seurimpoudap n nciltf rrau  ;o0texn o3tltfs2rmn s t0 rxrxr3ia1fpD luvs ()trxrxopiu1omeemietat sDurxmpot1alt miciys s2ra( o t0 rxomr oydomtrlies;(0 rtr(m iydaleemneiat aDua( pnt0tpxo fetytfm ua(vonu0trxomo oatfa rlueilt0setoxo3ny4op nmivi tfs2uaxmpot4tpto feildlm2um( o;(0 lxoxr3tadla   ivi (0 2xoxo ou1omt lnvia(fsDrmuro;u4apxnmiciys m rmn p;u4trtomr3tytlpD  uvs;t0 2uoir3iu1llenmivia()sDrm(mo;o1altnio3tldlm2rl(mo ()alenifcio1lpD lnesl( trum(m3oodlmtn ivia(fs2ra(r ;u0alxoiictasla rlumpnu4trtnir3totlpDe ivsls0seuo(r ny1ameemivs () 2tmuroot1apx ifciaslsDemnvs t4 rtoxo totopD aneo;(0 etrim iudllenlnvta(  rtrumpot0tltomf3iyt a em(vo;u0tltnxocio1omt anesl(0 rtmxopoydlp emncsasf rta(ro;t4tlto fciltfm el( s;(0 lenif3iydla elues ()teuoxo3iy1ol emfei tfaDtau ont1oexoio3iydlmDum(vp;(4trtnircoy1lpte uvilt trxrxmpnu4lm  lnvsa( sDum(r ;t0tle mf3tatfa rm( p;() lxnmf3tatfat anvils0trxrxm3ou4llen ivtlt a2urur oo1apx mfeiyt s2rmn sn() eenmo3io1opDr u i;(0 euoxr3ou4lleemncsas) Dum(ro;u1tpxomfcild m rlu p u4 ltoirciotlpteai i ()t2urxo iu4lmtn nvsls)arumxrpno1tpxnifctlsla2um(vp u0texrifctodomteln s t)seuoxopoodap e fcilsfs2umumpno1tltnif3tyt aDrm(vp t)texoircoa1omDeauei t teum(o iy4ale  fvs sfsrur(monu1apx  fciadfs2umuvsn(4 rtomr iatopteai ils) rxoxmpoy1lpeelfvi t s2rmu p;u0oltomfcild sDumnvo u)areoxf iotfp elueil(0teto(o3oydam elncsa(  Drruroot1opxnmictad s em(vonu4altnxf iotfa raiei t0 eumxmpou4lmeemncsatfsDuax o;o4teen fetys a umn pnt0tltoxociydop e neols)t2xr(m ou4amtemivs s aDumuro;o4tlx  i3tas a ulu o u)aetrmf3tydlm e i s;t) rxrim3no4lmtnmivtas  Draurooo1opeo ietlsfm rmu s;u0 lermf ta1fmDeaneo t0t2uoiopny1apenmnvtat) rururpnu4olen f3ils m ul( o;(4 eeoir3todop e ieo t) rtmxmpio4llt lnvias)s2urx  nt0aetnifetytfa em(vsnt4aetomf iy1fa elu s t0 rtrxr3no4llt lnctas)arurx o;o4tlenii3ils sDemuvs;u)aexnmr3iotlmteluvo s srtr(r3no4opeemfesas)srtmx pnu1teeoii3iatfs rlumo;u4 ltnxf3tytlm   u s;t0s2trxr iudlm nmnvsls) Dtau  no1olto ieiatfsDrlumpnu)arermfctatfatr i s;s) rtrio iydame licsltfa2umu oot0tlt ioctasfmDrl(msnt0 lenmr3iytop e u ils)sruoxm nu4lpeelneil( a2rmxrpou4tetomiciat s ul(vp;t) rxnxrcta1la r iei;t  rxmxm3iu1ale mncsatfsDtmumont0apx  octydfm el( o (4 rtnmf oytfptrlivs t  etoxm3io4ol n ietls)a2raum no1apen fetad s2ranvpnu0aetoifciydop eauvo t t2tmxopou4op  lfes ( sDtau ono4teeo fctyd s2elnmp;()aexrxrciodfm   i sl(0 rtr(m nu1am n nvtls  2umu o;u1aexn o3ild mDeanms;u0 eeomoctotfmt lu i t0 rtmio3oy1ll elivt tfsrur(m oo1alxo i3iatfa emnvpnu0treoifciydopte ieslt) rum(mpnudlp nmfvils artmxrp;u1oexo ociyt m2elnmsnu0trxnir3ty1fa raiei s0 etoxm oodomen ncslsfarumumoot1tle  icild m elu sn(0 rxnif3to1fpDr i o s srur(r nu1ale  ivtlt  Dum( pnu0ope mfeiydls uanmp;()arerifctytlm e n i;(0t2urim iodopt livta() 2tmu pno4alt  icilslmDelnmp u)tltoxr3iydop  auvo s)trtmxm nudapt mnci s)srumu  no1apxoiociyt mDelu pnu) rtoiocoa1faD lnvslt0 rtrir io1opt mfvtatfs2tmu  ;t4tleomictlsfa2ua( snt)altrir iytomDelneols)s2xmio nodol  livsat)s2rru pnt4apt mf3iyd m2ul( o ()alenxrctotoat  nvil(  2um(m nu1amtemnetls s2trum oo1oltnioeiyd mDul(vs;u)tlxnmo oodfpDelnei;( trtoxrpnudomee fcia(  rtr(mp;t0teeoii3iltlaDum( p t4 lenxocootoa eaueo t seto(r3oy1ameemivslt)sDta(ro;u4ape  iciysfaDemuvs ()trtrmf3oadop e ivs s0 eto(r no4am n feia( s2rax pou0aexo ocilsfs ran o;u4 leomfcoadoa rlivi s0tetoirpou1ol elfcsltfsDrrur ;o4oex  fctadls2ran snu)arxrxo3totfpt  i ols)teumxopno1ol elnetat) Dua( pnu0aetoifciadfa2uanmp;t0tltnxr to1fmt  uvs s0t2trxr nu4lltnmivi s)aDtrump;u4tlxn f3iyt s rl(vp;()texomociy1fpDelivol(0t2umiopoo1am n ictlsfaDrmxmp;u1apenmfetatfs2rl(ms;t)trtoxf iy1laDe neols trurxo oydop   ivils  2rax oot0tlt  fetadfsDeaumsnt)trxrir3iydlmte uvs t0trtr(m ny4lmtnmiesat) rtrxrp;t4alx mfeiyt s2rm(ms t0aeenmf3ootfp   u s ( seuoimpiydlmenlicsat)arrrxmono4aptoiieild m2rluvp t0 eenmocoa1fpte ieo;t0s2xrio3oydlm n feiat) rrmumpou4olx  icilt aDra(vs t4 exoiociadlat aueo () 2xoxmpoudam e iciat  Dtaurpnu0olt ii3iltlmDrmump;(0texomociy1omD anei;s0 rtr(o no4amen ivil() rurx oou0tlt iieils a ran s;t0texrxfciodlm e u olt0 exm(m nudlltnlictl(farrmum no0oleo feilslmDrmuvp;()arxnxrctytoate i s (0trtm(opoy4am nmncsatf Drm(  ou1alt mfcias sDumnvp () lenxr3io1lpDeauvi;s0 2xrim3ny4lleelfvs sfsDta(r ot4tex mocildfa eln sn()tlxnxf3io1fmDrlivi;(0truoir no4oltelfei tf Duaxr ot1tetniieiatfaDuanvp;(4altrif3tytlm eaivilt) 2uoxmpoudape  fcsl(faDrmx ono0opxoiietytlmDuanvsn()alenmociodfaD  neols0tetrim oy1amtn ici s a2tr(r ;u0teeo o3ils m emuvs;u)alermo3iodoptranvo;() rtrimpoy1ol  mfeia(faDuaxr ;o1oeeomf3ils s umnvo t4 eermrciytlmtrluesl( s2xmxrpoo4om nmnes () rtr( oot0teeomo3tydla rm( pnu0 leoif oydoptrlues s0 rtoir3nydal elfcsl()srtru pnu0alx micils aDeaumsnt4tetnirciydfmt li il(0 2trxopiydale mivtl()aDrmxr ou1tle ifeiydfaDulu on() ltoir3totomt livi;s0 2tmirpiydapen ietls  rtmuro;u1oee ifctys s ea(ms (0 eermo3oadlm eaieslt)sruoimpiydlleemics t  Dumxmont4tleomiciatfs rluvon() etrxf to1lp  auei;s)tetmxmpiu1ameelneils  2ra(roou0tle ii3tatfm2eanvpnu)tleoif3iodfp e i i t)srtr(rpio1lltn fetasfaDtm( ono4aetomfciatfs ran p (0 exnir3oo1fmtr nesls) rtmxm iydam n feta(f 2urx pot4olxo icils s2eaump t0 lxnmr3oodomtelnvs (0s2umxm iu4lm nmnvs tf rua(m no1opx io3tldfm2ran o t0altrmf tydomtran i (  exmim iu4ol  mfeias srraurooo1aptnmoetytfa elnvo t4arxoxociadoa r iei (0 eum(m ou4ol emnvi t  2ta(r nt4aleo f3iadls ua( o;(0aetnmo iy1faDeaueolt0setrxopiy4olte ivsa( s2ra( ont0opeomoctlsfs2ulnmon(0 eenif3ootoa rlnvs;t srurxm ou1apt mieias)srum(r ou4tlt if3iytfm2rl( on() lxrir ootlm rlnei;(  rtrim nodolen ietat artmxmoot4aeeomf3iys s uau p;u4 leoir ta1fmtranes;( t2xmxr ou1al  mfct tf 2rmurooo0tlt  icildlm eln p t0tetoxfctodomteaivo;t  2tmxm3nu4alt lnetasf rtrxroou1apx mfctlslmDelnms t0aeeriocio1fm elu o;()t2to(r3oydapenmieiltfa2urxr ;o4opto ictltla2ul(vp;() lxrifciadomtrliei;( seuoir iu1aleelietlsfsDtrxr ;u1tpxo ieiltfs el(vo;t0 ltrmfctotlptrlieol(  2toimpou1lptnmfctlt) Duau o;u4tptnmi3iatls uanmo t)alxnir ta1lm   i o ( trxmxmpoo1al nlfct ( a2tru poo0tltoifciatla2ulums t0 lenxo3oydlmDeaues t srxrimpoudlmtnmivtasfsDumu p;u4apeoifeiasfsDulnmp t0aexoxrcoydfat  n i t0setr(r ny1apeelnvtlt  Durxr ot1apxo ieilslmDumnms;u0artoxo3io1fp rlnvs;(0s2trirpoydoltnmfviat aruau pnu0aex ii3ias m umn o () ltnmr tadoptrln ol() rtm(rpou1ale  ici tf rrmu pno0tlxn f3ilsfa eauvs t0 exrmociotfptrlues s0tetmimpiodlptemfcias  Duru p;u4oeenmo3iadls ul( o u)tltnir oodom e nes t0 eumio oydlptnlfeslsfa2tm(m ou4oexn f3iyt s2ulnmp;(4 lenxo3iodfmDeluei;(0s2xmxopiu4amtnmnvt s)aDtmuro;o0apen feiys a2el(mp;u0trtoxocoadlp e neils  eto(r3ny4ap   fei t s2rrxmpno0opxo o3ils m uln o (4tetomrcoadlpt an i;s) rxrxmpou4opt lnct (f Dtax  no0tlxniictasfm2umn p;t4aeenio3oytfat lues;s) rxmxr nudlm n ies sf Drmxrooo4tpxn f3tld m umu p;(4 renif3to1lmtrai ilt0texmiopnydllt mncils  Dtr(r nu1oet iictysla ra(vo;(0arxomo3iadfp rlues;t) etoxm io4ameemfetl() Dtax o;t4tlxo oeiadlmDelnvon(0arenxr3ia1lpDe n ol( srxr(r oydapt  ici (fa2uaurp;o1oeeoifciysfs rlu p ()tltoirciodoa rau s;t) 2trxmpoy1lmen nvil( srur(ront1aeenioeilsls2eau s;(4aexrmf3ootlatelues t)s2ur(m3ou4ol nlnct s sDtrump;u4aex  iciysfm ua( p ()artnir oa1late ies s  euoxrpou4alenmfcils s2umu pnu4tlx iociltlmDemnvs;t0tlermocoytomDeln ils  2xoxrpiydlpt  ivtlsf 2taxr ;o4tlxomieils mDean pnu4 exnirctotfmt  n ilt) euoio io1omt lncta(fs2rm(ro;u0aeeniieiatlaDuaumont4 lerif3tydomtelnvo t) 2xrir oo1aptnmfes sfs2raxr ;o1aee ifeiasfs rm(mo;t) rtoxo oa1fp rli 
\ No newline at end of file
@@ -0,0 +1 @@
+ieolt  2tmiopio4om  lnvsa() rumuroou1opt iictlsla rlnvo (0aeenir3ty1fpDrli i;( seumxo iu4alenmfesl(f Dtrum ;o1tlxniicilsla2umuvp;u4aetrmo tydlpteln i;s0texrxrpoodaltnlivt s)a2tmuront0apx mf3tydfsDranmp;(4 ltnio3io1omD aiei;t)trxo(rpiudlpt lfes sf 2raxr ;o1tltnifetad m um(vpnu0alxriociotopt li o t t2xm(o3io4ameelici (faDrau oou1oeto oetaslm rm(mo;(0trermo3io1lmteli olt  rxmxrpno4apt  nvslt s2trumoot0aet ii3ildlaDrluvon() lermr oa1fatelies;t seuo(rpoy4lm   nvslsfs2taxrono1oee iicildfm2ean o (4 exrir3ootfm  auvo t0 euoio3oudllt  fcta(  rtr(mo;t1tet moeild s ulnvp;t) rerxf to1oa e i slt) 2tmxr nu4am   ics sf rum(rono1optomoetysfm2eln pnu4aeermrcio1fpDraivslt)trxrim iydlltnlnesls) Drru ooo4ope mi3tysfsDrlnmon()aexnxf ty1fa  li o (0 etmxr iu4ope mneslt a2trx  ou0tlt ii3iysls2rlu o (0aexriocoydopt  uvo ( seur(r iu1lm nlneslsfsrumu oou4open fciydla rm(vonu4altnmr3tatlp   u s;s srxm(m3ny4am emnviatfaruaxm ou0apen feiltlsDrlu p t4aetoir ootom  aiei t0 rtrimpiydol emiesl( a2ta( ono1oltnif3tydfsDean s u)arxnxrcoo1omDelu s;s)sruo(m3nydam elfctls)srtauro;t4oex  i3iad s2rauvon(0 lxnxrciotlm eanes ()texm(opnu4lp  lnctatfartrurpot0tlxnmi3ias a uauvs;u4aetnirctadfp   neil(0 eumxmpio1lme mnetls srur(monu0tlxn oeildfsDumnmo;t4tetoxo3oa1lmD  ivo;t s2tmxr3oudomt lfvs t srra( ooo1texomf3tytls2umnmp u4treoxo ootomD ln olt)s2xm(opoo1amte ies ()artmur ;o1tpxnmo3ilt a2umu p;(4 rxrxf io1omt  nvs () rxoxopiodoltn iviat  2ur(monu0oetn iciasfsDrln pn()aeeoxfcoa1lm elueo ()trxr(opio4llenmncils  Dtau  ;t0alt iiciytfa2rmuvo (4 etomo3ia1op ranei;(0s2urim iudomtelfvtlsf Drmu  nt0oexomocilslsDem(ms;u) renif iytopt au i ( setrxr3io4omeemfetat)a2rmx p;u4teeo i3iatfa2umnms;u4 etrmrcty1lp rai slt0 2xr(m io4omtemivt s)a2ra( poo0aex  fciyd a2um( onu)aexomr3oa1fp  luvs;s0s2trxopnodam nmfcsls srtmx  ;t1oeeomfcilslsDrlu o;u4artomo io1la ean o;t)seto(m iu4lmen fciasf Dtau  ot1aex ifeiytlsDrauvo;u)trenmo3tadfmDrlueo;(0 rxo(o no1alt lfetlt arrm(rpnu4tetnmiciydla umnmp;u0 exrxo iytom eanvi t  rxr(opou1lptn ictl() rumump;t4teto i3iysfm em( s t0arxniocoy1oateanei t trxmio3iy4am emnesa( srurxmp;u1ape  feias s rlump t)aetrifctytlp  lnvslt0 2urxo3oodamte iet (  Dum(r ;o4olx  fetytlsDumnms;(0 leoxo io1laDeaieo (0tetmio3iy1aptemivia(  rua( ont0tpe moeiatfm ranmsnu) rxrmf to1om eln slt)sexrirpoy1am nlivia( a2um( p;u4tpxn fciatla2eau s t)arerir3ootopt aues (0s2toxm3no4lleelfvi tfs2rrxr ;o1alenio3tasla2rmu o t)tlerxr oodlatrli i s0sruo(o nydomtn ivta(f 2rmx ooo4oltomoctysfmDrluvsnt)aetrxrciadom  li i t  rto(r3iodop nmfvils)aDumumono1tpx io3tatla rmnmo t4 etrmr3tatlptr i ol(0 2umxm iu1op  livilsfaDumu onu0oetomfciydfs2eanmon(4 reoio totomDelu o s s2uoirpou4amtn nci t sDtmx  nu1opeomoeiydlsDrm(vsnt0arxrxrcoy1om  li o ()seuoxmpiy1op n nct s) 2raum oo0tpe miciatfm elump;u4 reoxrcoytlat  nei;( srtrxr iy1alenlfeiltfaDuaxrp;t0oleoifeiyt m eau o;u0teerxo todfptraivi t)srtr(o3iudopeelfet tfs2ta(ronu4tetnio3ias s ra(vo u0trerircoadomDeanvi s)teurxrpnudam  mncs ()s2urxrooo4alenii3ils a2emnmp t0trerxf3iydfmt lueols0 rxoir3io1omtnliei tf rumumo;u4alxnmoeiytfaDea(vo;()alxrxo iytlm  luesls truoxmpiudlmt  nvtasfsDtm(mo;o0texnmi3tydlmDem(ms;(4 leomf3oa1fp r u o;s) rxrxmpiy4lm elnvs ( srra(  nt0tptomfetlt s ua(vs u4 rtrxf ia1omt liei;s)trxmxrpny4oleelnvta( srua(rp;t4aee mfctyd sDumn o t)aexoxrcoodomD  nvi;t0 rxmir3ny4oltemncs ()a2taurpno4apxnmociaslsDuaums (0arxnircia1om  anvi s t2uoxm nydomt mnesl(farraxr ot1alenio3iat s2um(vp u0artrxo iy1op r nvi;t s2xo(m3iy4lmte feslsfsrrmu pot1olenmi3iysfa2umnmo;u) rtnir3io1la rluvs;t) euo(rpou1ll  lnes sfsrtrxmoot0aex iictas mDuan p;t4teerxo iy1omDe ies;()trtmxopoo1lleemfeil(faDrax  ou1aptn i3iadfa ul(vsnt4aexrmf io1lmDr i i ( t2umxopoydlmee fvsa( srtrurpoo1tpx  icildfmDrmuvp u) lenxo iytlateaues;t texm(opno4aptn fvsas  rta( p;o1tle moeiytfm2el( o;t0tltrmrctatop e uvi;( truriopno4oltn fvsa(fa2tm( ono0tltnmiciyt a2uaumo;(0 rxnio iytlptelieo;s0t2xrxrpiy4lle lnet t s2rr(rp;o4aet  oeiydfs umn s (0arxoir oy1lpDeau o;s t2umim3ou1amt  ncia(  2ua(  ou1ape  iciadfm ua(mp;u4teenio3oodlpDrli olt0 2uo(m io1apeelneilt  2tmu oot1aptniiciasls2emu ont0aexoxf3iy1fm  anei;s0 ruo(opiy1olee ncsls  Drr(m ;o0tpenmfeiydfs raumon(4 ltrxr oatlp  auvil() exrxrpny4lltnmfviat)s2raurpoo0tleomfeiyd m em( o u0treomfcia1faD ln ols)t2xrir3nu4am e nci sf 2tm( oot1apx mieildfsDrl( s t0 lxrxocoodomteai olt0srurxrpiu4lmtnlictltfaDumxmo;o0opxo ieildfaDea( p u0 exnxrciydfaDr i s (0 exoxr oudom emfetat) 2tm( pou0olenii3iyd m umu p;t0 eerifctydlp e neo;t trxoxrpiu1op emivtl(  rra(mo;o1tpxoioctytlmDemn sn(0 etnmr3iodfmtraies ()seuo(r3nu4llte ietatf rta( o;u1ale miciltfs ranmsnu) ltrio io1la ran ols0 etrxm3ou4ll  lfvsasf 2tru ooo1apeomoeiytla2ua( o;(4arerio3tatop r nvs t trtoxrpiu4ol nlncsas)s2um(  ;t1oexoiocildfaDemnvs (4aexrmocoatoaDrluei;(0trxrxo3ou4lpt mfvi (fs2tmurpoo0olxn feiys aDuluvs (0aetnxocta1fmt li il(0 2xoxrpoudlpt mnesa() Dtrxroot1aet ifciad mDum(ms;u)trerirctodlateai o;( teto(o nu1omtemiet (fs2tax  oo4tlx  feiysfsDean s;(4trerir tadomte ieo;t s2toim oy1alenlivil( s2rmx p;t0oet ioeiysfa2em(vs;(0 exnxrcoodlp rlu slt0srumir3oydlpte iei (fs2umxmont4tpt mfctasfm2rm(mp;t4alenmfctatfmDrlnvo;s0sexrxr iy4omtnmnvil(f rur( pno1tpeomfcilt s2rm(ms (0trtrmr3ootlm r i s;( t2trxr3nydllee fcilsf 2rrum nu0aex ii3tldlmDrau on(0 rxrio3tatop raivo;s0t2tr(m nydll nmfvi s  rtrur ou4aetnmieiyd m uau s;u) ltnxf oodfaDeliei;s0s2xo(mpiy4llt mfcsa( sDrmu  no4tle  i3tldfa2rmuvp;(0trtrmo iotlp  aies;s)trtrim iu1ll e fvtl(f 2uauro;o1alx  i3tlt a um(ms;(4texoxo3oy1lptr i o s  exm(o3iodom nliciat srumx o;t4aee io3tytlaDul(vpnu0tlenmociadfmtean o;t0trxo(o iodlmenmiei tfsrrm(monu1aleoioeildfsDua(mo;(4tetoif iydlaDr neols) rxmim nu4oleemfet sfa2rmur ;u1tee ifetatfs2uauvsn(4arxnxo3iytfmte iei (  rxm(m oo4opeemncs t  2rmxr ;t4ole  oeilslaDean onu)aeeomf to1fmD livs s0 exm(m oy1am   fesl( artrump;u0tlxnio3iltls2em(vonu0trtoxr iodfpDr ivi;s0s2umxopiy1amenmneilt  Dtm(m ;u4tetn o3iyd s emu o u)tltrir3totlatrlnei t)s2tm(r3nydol elnesat  Drr(r oo0tpxnmiciytls2ra(ms u4aexnxr oytlmteliesls  etoxrpno1am elneslt)artaxmono4tet moctls sDul( snt) renxo ootfm e i o;s  exrim nu1ll  mncslt aDta(  oo0teeoioeiadlsDemuvs t4artnircoadla rli il(0teur(mpnodop elfvs t)aDurx p;o4tlxnioetyt sDuauvp u)aexoiocoatlm  anei;s s2xoiopoydop   nesat aDtr(m ;o4olenmfcildlaDrmu s (0 rxnmfciy1la elivo;() etoxr3oy1amenlivils aDtrxm no1ope  ictytlm2rl(vo (4 lxoir3oydoatrlnvs;t)srxm(r3nudlmtemfcs (  rtr( pnt4olt mfeiatfs2ea( s u4aexoif3oytfptrlnei;(0trumio3io1ap  licsat)sDum(ronu0teen f3ild s em(ms;u) lermfcoodfptrlu s;(0sruo(r iudlme lfcsls) Drm(r nu0oee ifctas a em(von(4teerxr oatlmtr n i;t)sexoir nudlp   ivtlsfsDtmu  ;u0tex io3ilslaDranvp;u4arxrmr ta1fpDeaivo s setmio iydlpt  fvi (faDurxrpno0apxomo3tys m2ranms;t4texrmfcoadoatrlnvsl()sexmxopiy4ap nlics ()aDtrx  ;t1olto oeils a2um(vp;(0arenxfctytlpt aneolt)t2toxrpoy4al elfcsa(  2raxrp;o0oee  octydla em(ms;t0aeenxr3iotla  lu ols setrxopnydlm e nviltf Drr(rpoo1olto i3iatfmDrlu o;u0 lermoctytomt lieol( t2toimpiodopen fesat sDuaxmp;u1apx  i3ildfa2elums u) ltrmrciy1oaDe ueo;s) 2ur(rpio1apenlnvsls  Dtr( oou1opx miciadfm2umnvp;() lenif3tytfmDe nvol(  rtrxmpiodamtn nci (fsrtr(mpou0tex miciasfs2umu o;t0 lerxr oy1fptelu i s) etrxr3oudolenmnvslsfaruau  no4apenioeiydlsDel(vs u4aeenxfcootlp r ies;t srxmim iu1lme  feslt aDrru p;o0tex ioctasfa2rauvp;()trxrircootlatrli o;(  rxoxopiu4op emicsasfaDtr(mp;u4apenif3iasfaDuau s;(0 eenxo oatop raivs t)srtoxm nu1ll e fvt tfa2rrx  nu1tpx  fetltfa2rauvsnu)texnio3tadoaD livi;(0trtrio iodomen fcias aDtrx  nu1oexo oeiasla emnvs t4aeermo io1lp  ln ols)setm(o3ou4ape mnvs sfarum(mp;o0alx  oeild m2uan o t)tlerio3iytfpDe ueilt t2xrirpiy1lpe licil( s2umx p;t1altoiietatls rmu snt)aexoio ootfp r uvils0trurio iodoptnmnctl(  Dumxm ;t4oltoifciat s2rl(vs;(4arxrxrctatlmDelnei;s  2to(o3oudom  mncilt  rtmxr ;u4oetomi3tlsfa em(ms;u4trtrmo3oodfpD  i i t  rxr(m nudam  mfes ()sDur(r ot4tpxn oetat mDra( s u)tetnxr3oo1latr n i;t) 2umxr3ou1am e ieils)srua(m ou1olxn fetlslaDeln onu4altnmrcoydlmDrlnvolt)setrirpnudalenlicslt arururono0oleomiciasla2em( pn(4aetrioctadomDeai i;t0 rxmxm iudolt lfctltf rtm(rp;t1olto fetltfa emuvp (4tltrxfcto1lptraies (0tetrxo3nydolt  nvt t)sDur(r ;o1ape mfciyd mDumu on() rtomr3oy1fmD anvsls  eumimpiy4al  mfvt s a2ur(mpno4tlx mictltla uan ont0arenxfciatfm ean ilt)t2xo(rpoo1oleemnci s)aruax p;t4olx  ietldfs el(mp;u4artnifctadlmt lnvo (0seurxr3iydal  mfct t artmxr nu4ale  fciytla2eaums u4 lxoio3oa1om rlueol()srxo(rpiy1omeemncslt a2ta(m ;t4tlt ioeias aDrmn ont)trtoiociytfpDranei (0srtr(o oo1ope  ieta(faDur(rp;t0oexoiietyt m rlnvp;()aeeomo todla e uesl(0s2toir io4altemiesas)sDrrxmp;o0tex  o3ils aDua(mo ()trxrxrcia1oat luesl(0 eurio3oydalt mfvi t a2um( ono4ope  fetadfsDuau p;u0aleoio3oa1fpte nei;s0t2xrxm3io4lp e ivia() 2uaumont1olxniieilt sDel( p t4aetnxo tydlmD  i ils0srxrir ny4llt  ieil(  2rrxmp;o1alx  octltfs2um( onu0 reoxo ootfpt livo s0trurxo3nu1om  lfet s sDta( onu1olxoii3iytls2emn p (0alermr to1la e ies s)tetm(o iodlm  mivia()a2rmxm ;u1apt  f3ias a2ra(von(0 lenmrcoytla rlnei ()s2ur(m3no4lp  lnvi ( s2rrxr nu1oeeo f3iadlaDuanvo u)teenir iydfm rlu i (  rtr(m3iu4amte nesa() 2tmumpnt4aeen f3iasfs2rlu o t0areoio3oa1latrlivs s trto(mpnu4alt mfvi s s2tm( p;o4aee  ietatls uluvsn(0tetrir iatoatr uei;t0sexoirpno1optn ivi s aDtmu pot0aeeomfeiys mDulnmo (0 eenio3tadfaDranvi;t srtrxr3oodoltnmicsas)arrmx  ;t4tlxoiociatlsDrm( ont4tlerxrcoytomD aivols)trumio3oudlpt micsatf rtrxroot0aee io3iat m elu snt)teenir3oy1om ran s t  exmiopiydam e feil(f rrr(r ou1teeomfctytlsDua(mp (4aexrioctotopDr ivilt0t2uoxopiu4omtnlivsasf 2umumo;t4oexn fciydlaDrlumpnu0 rtrir oatfatr u ol( teumir3iu4am  lnctat sDrmx pnt0optomo3iat m2rlnmp;t) rxrmfctodlaDrln il(0 2uriopnu1optemicsat aDuaum oo0alt mfctad s rm(vs;() rtoir iotlaDeaiei;(0 2xmim ou4amtemictls  2umurono0opt io3iadlm elnms u) lxrmrciotom r uvo;()srxoxm iy4aptnlivtls) Duaxm no0aetnioetysfa2umnmon() lenxr oa1oaDean s;s0 rumxr3ou4altnlivs s a2urx  ;o4apxomfciasfaDum(mo ()aexoxo3iydomtrln sl(0 rum(o3iydolee icslt) 2tmx o;o1opt iociadlmDea( p;u0 etrio oatomD ln i;t)t2to(rpnu1apeelivi (  2uaxro;u0tpen ociltfaDrmu o;t4 lenxr iodfm r ivs;t  2tm(r iudap nmnvt sfarraxm ;t4tetomociys m elnmp t0tleoiocty1fp eaueo t  rxoxm nu4lm nlieiat) 2trxmpoo1tleo f3ilsfm umnvo;t0 rerir3iatlpt ln ilt)tetoir nodlpt mivs tf rurxrooo1openmo3tat a2emn o;u)altnxocoatomDeluvs ()t2ur(rpiudomee ncias a2rau o;u4openmiciysls2rl(vs (4trxnmr oo1fatr i s t  exrir oydam elnctlsf rraurpot4alenmfcils aDel(msn(0trxnxocootlatr nvslt0teumim3ny1oleelietls)a2umu o;u0teeomieiatls um( on(4 rermo oa1la  lieolt)trum(r3oo1oltnlnci s) Dtruro;o0oee  fetltfm el(msnu4tlenmr3to1lmtelnvo t seuoir3nu4aptnlieil(faDtrum ou1tpxo oeiyt aDea( s;()trxoxrciy1oa r u i;( srur(m3iydol  lfcilsfarur(  ;o4apt if3tysla2emu ont4aeeomo3tytlmD lneols s2xo(r3ou4om n iesa() rumxr ou4texnmfetldfaDemump ()texomfcoatomtelnvo;t) exo(o3ny4ale  nci t)s2tm(r no4oetn ociatlsDrmu snu)arenmo3totfa elieo;t) euoxr io1aleemivi t)sDua( oot4aet  o3tlt m2rau ont0artoif to1laDelnei;(  eurxo3iodll n iesa()sDuru ont1alenioeiad s2ul( pnu4trxomocio1lmDr ues;t0 rxoim3oudamtnmfcslt arur(m ot0apt  o3iys s2ul(vp;(0aetomoctydfmD livi (  2xmim3oy1om e ncias)s2rru  ;u1aet mociytfsDrauvp (0trxoxfciatlpt an o ( s2uoxr3nydoptnlfvta(  2rax  nt4tleoiocild aDelu s u)teeomo iotlpt aneols0tetm(o ny4aleemivtl()artmx pnt4aptn f3ilt mDua(vo;t0tlxrxr3to1op eln o ()s2umio3iu4aptemnvil(faDra(rp;t1apto i3tldfs ua(mp (0tltomfcoytomtr i i t0 eur(o3ou1lmt lnvtlsfa2ururo;t4teeomietld sDuau p t4treoxf iytlmteli ilt0trxmim3iudll nmfvt (fartrx onu1apx micils a2rmnmsnt4aeenxfctytlmDelu s (0trxr(r3no1amtnlicils arrau oot1alx  iciyd m rlnvs u4trenxfctydfa   uei;t) rurirpno4ame mneilsfs2ururpno1openmfeiys m um(mp t4 eeomf3iatop raneo t0 2tmxr3oy1op nmfcs ( arur(r ;t1ole ii3iatlsDumn pnu0trenir oo1laDran i;s0 2xrxm nudom emfei t a2ur(mpoo0aptoio3tysla umuvp;u4tltoxr oa1op eluei s srxo(o ny1omtn fviat)srumumpoo1ale  f3ilt mDumumo u) lerif oatop rluvol()seumim3nodlptnlivsl( sDum(rpou0alxn i3ilt a ulump;t0 ltnmr3oy1fateanvslt)srxoir3io1aptelfesl(  rrmum oo4olen ieiadfa2rmu s u0altnmrcoytfm r ieol(0 2uo(opny4olt lfeilsfa2raxrpou0alxo ictydla rmn pnt4 etnir3to1lmtelnvils  rxr(m3iy4ap n nct t)arrau  oo1oex ifcilslsDelnvsnt0 ltrxo3ty1fatranvsl() etoimpnu1lle mivtl()srtmu p;t0tex ioeilslaDra(mp () leomociytfatranesl()s2ur(mpno4lpen nctl(f Dtm(m oo1tptoifctas m2umnmo;t)altrxr3iatop  livs;t0 rxoir ou1omee fesl(f rumurpoo1oleoio3ilsfaDuaums u0 exomr io1lmDe u i ( texmxm3oy1llen ietlsfsruau  no0tpt  fctysla uanvpn(0teeoif3io1lp e ueils) rxm(m nu4ll e ietl()arua( o;o0alx mfetytlmDrl(vp;t)tetnif3iadlp rau i;s0s2xoxopnu1opt  ieil() Dtmxm ot4tpe ifeiydfm2ranmo;u)arerio3tadfmDraueo;s srtoir3oudoltnmnctatf Drm(mo;o1olt  i3iaslsDul(mp;t0tlenxf3oytfp rlies (0 exrxmpio1ape  ivias)s2raxmont4aee ifcildlaDrlu o ()tlxnirciy1omDrauvsl(0 exmirpou1lpe lfeias  2rrum ;t0olxn feiyd aDulumo (4trxrir todlptrauvo;()t2trxr oy1apt  nesa() 2ua( p;o0aetn octaslm2eau on()trxoxr iy1optrli slt0srtmirpnu1omenliesa(fs2rm(r ;u1alxo i3ildls uaums t4arxrmfcoy1opt an s;s)setm(o3io4omtnlictl(fa2tmxrono4tpto ociad a2umn s;u0alxomr3oa1lm  aivo;s) 2xmio3nu4ope  nct sfaDtmxm ;u0aptnmfetldlm2ulnvs u0tltnmrctotfm eaivs;(0s2xr(m3iy1lptnmneilt  2tmu p;t1aptoio3tatfs2emuvsnu) lxrir todfaDeai o t0s2uoir iy1lptnlivtls artr(rp;t0olt iiciyt m umn pn()teeomrctytlatraneo;t)trur(mpnydaptnmncs s aDrau pot4aptomi3tatfa2eaumo u)tltrir3oodfptrau sl(0trtr(opiu4lle livi s srumxr nt1opeo oeiydfa ua(mo;(4alxrif ty1fa e ues;(0tetm(r3iydlp e ietasf rtmurooo0ole ifetyd s2ulumo;u)aleomfcoatla   u o t)trtoxo iy1alt  ncilt) 2urumpot0oltn o3iat s rlu p u0trenif3oo1oa e nvi;(0s2uo(m3oo1aleelnei (fartmu p;u1olt  oetat a ulnvs t4teenxo3oodopte u s (0 rtrim3oydll  mfvtat sDraurpot1open oeild mDemnvp ()arerxf oy1lmtr u o;t)s2umim3nu1lltnmfesas)arrrurpoo1tleo o3iatlm2ra( pnu0 ltnmr iodlm ean o (0s2trio oo1amtnmncs t  Dra(mp;u0tee ii3tadfs2elnms u0artnxf3io1lpteai il() rtr(m oudomtnmfeslsfa2ta(rpoo1oltn fcilsfs emu s;u)teeoir3oo1fmDe ivi ( s2tmxopou4ape lnciat sDum(mooo4aeenifctadls emnvp t4altnmo3tatlpt  ivs (0 eurxo3no4optemnesl(f 2tm(moot4tlen iciysls el(vpnt0texnir3tadlpDelu s;s) rxoio3ou4lp n ncsls arumxmont1aetn fetytlaDrmnmonu4 ltoio ty1oa eln s (  rtoxopiydam e fesltf rururooo4alen i3iltfmDeau onu4 lenif3totlm r uvol()texrirpoudlp emneta( aDtrxmont4oee  ocilt a ran o t4trxomf tadoa r ivo s sexr(m iu4oltemnctl( aDum(mp;o0apeo fctat aDem(mpnu0treoxf iytlmt  i sls setrio3iu4ol   ncs tf Dtaurp;o0aee ifcildlm rmuvsn(4 ltrio3oy1fat  ies (0t2um(r3no1lltnmnvtasfsDum(m oo0olx  f3tyt sDumn s;t0texnmr totfmD aivilt  rxr(mpoodal nlfeiasfaDurur nu1opxoiictasfs umuvsnt4arxnxr oadfp ranvi t t2tr(m3oydlmen fciasfaDrm(mpnt1tltnmoctytfsDumums u4treoif3tydom eauvi;t)t2toxo3iu4lptnmieia()a2tr(rooo4ape  oeiat a2umnvo;t0aexnxrciy1fa e u sl()t2tm(mpiydamte nvsat sDuru o;t4tpenmiciltfm emnvp;u0 rtnio3iadfmteaivs t srxmio3iu1ll  liet s  rrm(r ;u0teen fcilslsDua( onu0alxrif3tatlptr nes () 2xoirpnu4amtemnvi tfaDtaumo;u4optnmocildls uan s ()altrxrciatlaD  i o;s truo(opiudol nlfeilt  2urum ot1aexnmictldla em(vs t4tltrmo3ootopDrai s s0 rur(m no4al emncil()s2taxmpnu0apeoifciasfmDrmn sn(4artoxrciatoatrau i t0 exmxrpoy4lme lnei s s2umxm oo0tltoio3tatfa raumsn(4 ltnxr ty1oa ean s;t) rtrim oy1lmt  fet ( arrr(  ;u0tex ii3iasls ua(mo;u) exomr oodopD au o t)texrxopou4amt mnei t  Dta(mooo4aeenioeiydlm rmuvo;()texoir3iadop e uvsl() 2tmim iy1am  mfei tfsrum( oot1tpxnio3tat s umumont4trtoxr3iydom e neo;s0 rxm(rpiu1lptnmicilt) 2uau oot1ole  ociasfm2rlnvs t)trxoir tytop  ln s;s0trtrimpno4aptemfci t)sDuaur ;o1optn oeiyt m elu ont)artnxf3oydfa   u o;t0texo(o3ny1ol e fciltfs2taum oo4apeo f3tadfa2um(vs;(0 etomrctydfat  ivi (  etoio3oy4optnlics (faDur(m ou1tlx iicildfmDemnvo;()aeermr3to1fmD ai o;s trxo(o no1omt lfeiat)srtm(m ot1aeeoii3tysfm ea(vp;t)tltnxr3oo1la  ai o (  ruoim3iy1ol e ics t)sDurxm ;t1tpeo oeiad a uanvp;t)tetoif ta1lmt livi t  2trimpiudlm elneta(  2ta(  ou0openii3iatfs2uauvp;(4arxrxfctatoaDelu o s)sexr(m nu1op nlfviatf Dtr(r ou4apeoiietatfsDrm(mo (4 leoxfciatlmD livi ( texoxm3ou1ap emnvtas arta(moou1ape  ieiadla rmuvsnt4trxoxo ia1omtr nvi s) 2toxm iudol emfcia(  rtax pou4aetoii3iltfs2rlnvp;(0 reoir ta1oa rlivo t0 2tmim oudaltemfesa(fa2raumoot1olxnii3ildfmDulumo u4 lxnifcoytlmDeau ilt0 etr(mpio1am nmnes s)a2ra( pnt1aeeoio3iytlm2ra(vsn(0tlerxrciadop elivs;t t2xoimpoudlmtelnvilt) rtm( ont1apx mi3iltfa2ran s u)artoif tadoatr nes s) 2urimpio4lp elncsatf Drruronu1teenmiciatfaDrln s (0areoxf oydfmDeauvols0 eum(opoudamt mieiasfaDurx ono0apxn ietytfm emn p (0aetoxoctotomDr ivilt0sruoxo iy4lpen ivsl(  rtruronu0tlx ifetlsfsDrl( p;u0trxnifcty1lat lieil( teuo(o3oodlm e fvi t)artmur oo0ape io3iltfm2umu p t0aexnmo tatoptrlueol( seum(r3oo1aptelneslsfsrum(r nu0tpt  iciydls2umu o;t) eeoir3tytfptrluvs s0trxrimpnudameelivtltfaDur( pou0optnmi3tldfa2rmu ont0trxnxo todfmDe u i t t2xmxo ny4amen nvsa()aDua(mo;o4aetomo3tldfs2ra(mp;(4 lxrio3ia1omDraivi t srumxr3iu4lm  mfvsa(fsDtaumpou4texomf3tadfsDeanvs t4 rxoxocoy1lp  ln o;s)t2toxr oo1op  lieiltf 2ta( ooo1teto ieildla2ulnms;()teerirctydlp r ieol(0t2xoir oy4lmte fvt (fsrrmxr ;o0tpt  f3iyd sDuln o;t4 rtomfciydfmDrlueols)s2urim3iu1olenlneiat) 2um(ro;u0oexnmi3tld s2ranmo t0tetnif ia1opD luvolt)srxr(r3iodalte ies s s2trxrooo1opx io3tatfsDrauvpn(0tetrio3oadfp  aivo s)seumiopiudale mietlsfarurum ;u4opxo feiyslmDeau o;u4tetnmo totfmDelieol()t2xrir3iy4lmeelivi ( a2tmx onu4ope iieiys s rm( sn(4tleomo iy1op  aneils)t2toxrpny1ame mnesls  Duaxm ;o0tlto icilsfa2el(mp t) leoif ootfmt anvsl(0 rtrxr iu1lle  icsltf 2ta(rooo4teeomfciltfa ul(mp;(4alxnio3oatoateanvi;(0 ruoxopoy1oltnlfcsls a2ra(r nt4aetomo3tatlaDeanmsnt) lxoifcoodomt livslt0srumimpnodoptelnciat)sDrmxmpoo1tlt ii3iadlm2umnms t4 etrmfcoytlp r uvi;s0sexoirpnodaptemfvsls aDurxrpnt0opxn ictaslmDuaumo t)tlxnmfctodlm   iei;(0t2xoim3iy1lm nmnvia(  2ta(mont0olto iciadfs2rmnvp;u4tlxoio3to1lmDeaueo;()srxrir ou1lmenmieiasfsDurumo;o0oeeoiieiatfs ran p t4 lxoxfcoadlpDranes t0 2xrxr3nu1omt  fvias)sDua(  ;t0olxnmictldfmDumu s;()altomo3oa1fmteaneo s  2tmxmpoudlpe licslt) Dtax  nu4alx mfciydfmDul(ms u4tltnmfciytlaDrliei () eur(m nu4ll  mnctl() Drau oou1apxoiiciltls rlnmo;t)alerxr3iydomte uvs;( sexrxr ny4apenliet ( a2rr( p;o1apxnmi3iadfmDelnvsn(4teenxr3tydlatrluvsl() 2xmxo3nu1lp nlict t)sDrau  nu1tpx if3tltfa rmn p;u4texnmo3tadlateai s;t0trtrxm ny4ole  ivia(fs2um(mpoo0oee moetld a2elumo u)treoxrciatlateauvil(  etoxmpno1lp  mncils) Dtmxrpno0tpe mietys sDel(mo ()aleoifcoo1fm   nvol()sexoim3no1apen ietasf rtaxmooo0aet  octysfs uaumonu0tlxrmfctatlaD aivsls)srumxr3oy4ope mivs tf rra( o;o0ape iietadfs2rl( o;(4 exoircty1lat  ivs;s) euoxmpiy1oltnmnvils)arta( p;o4tpenmoctys mDua(mpn(0 exrxr3to1la rluesl( trtrxr no4op   fvt tfsDra(mono0olenio3iadlsDea( pn(0 ltnxf oa1oaDr u s (0t2xrxm3iy4omte fvil(  2trx ooo4apx iietat s2el( o t0arxrxr iodomt aneils0seur(o3no4altelnvils  rum( onu0alxnmietat s2em(mp;t4 reoxf oytomteli o s)teur(opiy1ap  lietl(f 2urumonu1tet  oetad m2rl(vo;u4trxnmr3oa1lpDr uvil( sexrxo no1omeemivs (  Dtaumpot1tle ii3iadlm2umu pnu) rerif3tydfaD auei s  eumxrpiydamenlncslsfaruau o;t0oetnmfeiytlmDemumonu4aetrio3oy1lpDe neo s teuoim io4altnmict ()sDra(rp;o4oetn fcildla elu p;t)tetnio oa1om e nvols)setm(opno1lmte fvt (fs2um(m ;o4tpxomictasfs umn pnu)tetoir3tadfa e ueslt)trxr(o iu4omtn neiatfarrrum ou0olxnmocildlaDum( p (0altnmo iytop   neilt  eurirpno1apt lfcsa(fsDtm(mo;t1tlt  feildfm2elu pnu)aleomr3iadlaDranvols srtmxmpiy1aptemivsls a2urur ;u4apen f3tlslm rl(vsnt)texrmocoa1lpDeaies t)trtrxr3ny4om  liet sf Dumump;t1aetoii3tyt sDumnmsnu) ltomo3tatfa ranvs s tetoim3no4altnlfcsl() ruax  ot0oetoiicils s2eluvo t)alxrmrcoydlpDrlivsls seuoxopiu4apee net s  rrrur ;u0oltoii3tys s2ulu s;u4 lenxr3oy1fa e neols)s2tr(o3iu1op   iei ( sDtmxrono0aexniietyt m eanms t0 leoifctatlm rauvo;( setm(o ny4ll  lfvtlt  2ururp;u1tlxn ieiysfs uanvo;()aexnif io1op r neil(  2uoxmpoo1ole lfctat  rum(ront4opeomictltlmDulnms;u0 etoxo iodfmDrluei ( tetoimpnodlme  nvsl() 2tau  ;o4olx  octltfa umnvsn(0tlxrmo todla   uvo s0 etm(o iydapenlicsls)artm(mooo0tee ii3tldfaDrlums;u0altrif3iy1lmDrlues;()t2toio iy4ol nlfvsat) Drax  ou0tleo i3ild sDulnvp (4aleoxrctydlm r neils teto(r3ou4ame lfeta() rtm(  nu4ole ifcilsla2eauvon(4 reoxo3iytoaD au i;s seurxr nudapte icilt  rtrxmont0oex  fciydfa el(mo t4teenmfcoytopDelnvol()srxo(o3iydopeelivta(f rta( oou1tle  i3iadfa2ulu s;t)tltnxoctatfpD lnvolt teuoxr3no1ll  mfei (fsDrru  no1tlxomieiatfsDem(vo;t)trxnxfcoytfaDe nvi t0 2xo(opiu1olee ivtatfs2urxmpot1opto octas s2uanmo t0 etnif ta1oate i o ()t2xm(opiudlpee icslt) rumxmoot1aptomfetaslsDrm( snu0alxrxo3tytomDe ueilt  2tr(rpoy1aptnmncia(fsDtrxmpou0alxo oetltfs2ulnmp () exrif3oadopD  uei t teuoir oydop elivsls  Dtr(rpnu0tpxn oetld m umn snt0alxrio ta1om elnvi;( teuoir3nudlpeemneias aDrr(r ;u0aetomo3ilslmDrm(mon() ltnif ia1fm e u o ()srtoimpnudam e fvsat)a2umumo;o0aeen ictldla2ulnmp (0tltniocoydlmtrlivsl( t2xmimpiu4op e ivsls aDua(  no0aleo ociadla2rmnmo;t) rxnmo3oadoa raivs;s0t2umiopiy1lmenlfcta(fs2trxm nu4oeeomieilsfaDran s;t0artoirctatla e nvol(0srxmir no1openlietlsfarumumpnu1tlen o3tasls rl(vont)texrir oydop rlnvo;s truo(r iu1lle lnvils arraum oo0aee moetydfsDumn o (4alermo io1lptrlu i ()teuo(r nydaptnlnvsatfartmu onu1tetoioeiytlsDrlnms;t4 rxnio iodopt  i slt tetm(r iodameelivi s artaxm ;u0opeo octltls2rlnvo u0 ltrmo3oadlmDr nvol()t2tmxr oy1lpt mfcslt)sruaurpno1olt ifeias a ua( pnt0 exnxrcoy1fptrlueslt0t2uoxr oudalt  net t a2rmx o;u1oetnmi3iat m eln o;t0 ltnxr3oatomt aneo ()srtm(m3ou1ap e nvsls)srrrxm ;o1tle micils m emn onu4artniocootfmt  nvsl()tetmir oydomenmfeia(  Dtmuronu0alenifciasfa2ulump t0tltoir3iadfptr nes;s srxmio oudopt mici t srtr( o;u1tpto o3tydla um(vo u0tlxnmo tatoatr ueols)s2uoiopiu1op   fesl(f Duaxr ;o0aee  ietytfaDuln onu)tlxoxr ta1fateli i;()tetmxm iu4amte fvt (  2ra(mpot4tlx iictysfs ul( o t) ltnio tadlat ln s s)seto(m3no4ameelnesls a2raurpno4olt  f3ilslaDem( sn()tlxrxr3iytfaDran i s0t2ur(o3iudam e fet (f rum(r ;o4tpt mfeildfaDul( o;u)texoioctadoat lues;t seum(rpoydoltnlnet s)a2umumoot1aetnmietls mDulumo;()aeeomrciotlm r ivi;s) 2uoxopiu4ll emnciasfs2umxm no1tlx ioctas m rm(vp u4 renif tytom  lues s  eumir3iu4ll nmiviasfs2umumo;t0olxo fetad m ua( p t)teenmo ta1fa eau s s trxrir3oy1op   fvsas a2urxm ;t1oltoio3iatfs ul( on(0teerxf ootla  lueil( trxrxr3io1oltelnetlt s2rrx o;u0teen oeilsfs ul( s;u)trxnif ootfatrluvo;s) 2xrir oydllt lfes ( srrr( pou4oee  octydfa emump;u)tlerif tatop eauvols)srtmxr ou1am n icslsfsrrrx o;o4oltnifciatfm eau s;t)arxnmociatlm r uvolt)t2xrxo oo4llt  ict tfartaur no1oltnmocild mDea(vp;t0tltoio oo1fmD  ues;s trto(m iu4amtemnvias)s2urxr ;o4altnmfcias mDeauvp (4 eerxf tadfm e n i (0 etr(m3oy4altemfvtl( sDuau  ;t4tleoioeildlm2rlumonu0 reoxo3ta1fpDe nvo;( s2umxopno4al n iei t  2umu oot1oexn fetatlm2emn sn(4 lxrxfcootomD lnvs (0 rurxr3ny1ap nlfvs t)sDrmx p;t1alxoio3tydlm2ran p t)alxoirciytfmteanvi (0teum(opio1apteliei s  Drrxm oo4olen oeiysfs2rm( snu4 eerio3oadfmt  uvil(0t2tm(m ny1om emfeiatfa2rru o;t4altn i3iysfm um(mp t) rtriociy1laD  ueolt0 2toir oo4ol n ivs t)arraxm ;o0opx ioeiasfa eluvp (0altomf3iodopD li o ( t2uo(mpnodol  livil() rururp;u4apenmietytfs2emump;t4trxoxr3todfp r ueo ( t2to(m nudole mivtls aDum(r ou0openmf3ildfsDemnmo;(4teeomfcio1oa  lnvols)teuoxo3iu4om nlnvia(  2tax ont1tlxoiocildlsDea(vs;u0 renio tadlm eanvi;(0 etoim oy4lptelfciltf 2rm(mpou1tetnmi3tltfm ran o u0aexnmoctadopDrlnvo t)tetoir ou1ale lfvt s arrrumpou4aleoioeiyslaDuanmsnt4 ltomr3iytomD  i slt0t2umxrpnodll emfetas)s2rmurono4aptn f3iad a em( pnt)aleoifcoo1oa  lnvolt)setmxrpiy1llt  nei sfa2urxmpnu0aetoif3ilsfm rauvpnu4aexnmfcoatfaD  ivolt0 2to(o3oudame  ieil(fsDur( pnt0ape mf3tyd m2rmu p u)alxnif oodla  lneil(  rxm(m3oudlptnlfcil() rta(rooo1tpe mfeiydlmDrl(vp () eeoircto1lm   ivo;t0 2umxrpio1op emnviat) 2ur(  oo0alxo ietlt s2umuvonu0altnir ootfpt li i;()trurir3io4ole mfci ()srraump;o0tptnmieiyd a2ean sn(4arenmrcoy1latelivo;t0s2uoxo3no1lpee fvsls aDur( oot0apto fciyd m rmu o u4altnmo3tatlate i sls) rto(rpio1alen feiat a2tm(mo;o0tex  icias s eanmsnt0 lxnxociydla rau i s0texmirpiy4lpeemivslt) ruauro;t4opeo o3tlt sDuanvs;t0aleoifciytfatr uvo;t)srumxo nu1lp elfei t)a2tmuro;o0tlt mi3iasfs ulnvsnu0alerxr3iytlmt lnvi ( srur(o3no1lltn nvs (fsrtr(rono1altniicildlm ua(vo;u)trxoifcto1fpD an i;s)texoxo3iodll   ieias)sDtr(mpou0tptoioctatlsDrlnvsnt4aeeoxr3iodopte u s t)trxmxm3ny4lpe lfctl(faDrrumo;u4opto ietls a2emuvp t)aetrirciotfpD anes;t  eur(m io4llt lneiat)a2uaum ;o1ale mfciysla uan pnt)arxrir ta1fat lu s;s  rxrir ou1omt mict tf Dtr(  nu1optniietys s rm( ont0artrmo3tatoatr i i;s0s2tmim no4alenmfvt sfsrrauro;u4tlx if3iytla eanvs;t4trermf3ootla ean o t0s2xo(m no1am nmivt tfaDua(mpnu1tlxomieiysf
\ No newline at end of file
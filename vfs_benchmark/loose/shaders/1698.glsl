@@ -0,0 +1 @@
+nvo;()s2urxr iy1lptelfetls aDra( p;t1olenmf3tldfa el( s (0 exnxo3ootom eaueo ()setmimpno1ale lfvsat aruaurpou0oee moetys sDul(mp;u4 ltomr3to1lmteauvslt)t2toirpoydomenlncsltf 2urxr ;o0aet  fctatla2eluvsn(0artnmo to1fpDeanes (0 2umxm3iodaptnmfcta()a2tr(rpot1tptomiciaslaDrl(vsnu)aetnxo ia1lmDran s;t s2ur(opou1oltelnei (f Drmurooo1alenioctldfm emn snt0 eeoxf3iatopD aues t0s2xmxm3no1altnlfvs ( s2rru pot1olxo o3tldfmDraums;t4aexnxo3iatfpt anvo t0tetoxm3iu4oltn fetat) rtmu  nt1tpxo i3ilslsDuanvs;u0trxnmf3totoptrluei;s) 2tmimpnydapeemfvtls srtaur ;t0tlxoifeias aDra(vs;()tetomfciytlptr uvo;t  2um(o iudaltnliei ()srurxm nt0opx mo3iadfaDumnvo u)alxnmo3io1la raivi s  rtm(m3iy4lm elicsltfaDumurpnu1tex ii3iytlaDumuvs;t0 lxrio tytfp   uvilt  rumiopnu4opeemici t) Durumoot4texnmociydfm ulnvp u)arxnxo tadfaDrlnvsls0trtr(o oy1lp   fvi ()sDtaxr ;t4aeen o3taslm elu s;t4alenmr tydopte nvi s0 2ur(m ou1ll n ics s a2rr(roou0aptoiiciasfa rl(ms;t0trxrxo3oytfmDe n ilt  2tmxm3oo4open fcsas)arrax pot1opto feilt m2elnvpn(4areoxr tydfp  ai s;t0srxmxopoudome  ivtatfsrtru pnt0apeoiociad mDrm(vonu0 lxnio iy1fmtran i ()seto(m3no4al  liei t aDraur ;u0aptn fciltfaDrauvsnt0arerxocoodfmDr ieil()t2tmxo oy1lm   fesas  rtm(mo;u0tpxn ictatfs emn p;u)arxnxf3totlaDrluvo;()s2urio ou4op nlfcsltf Durxmp;o4tlx  ociad m2ea(mp t0 etrxf oydomDrlivs t)trxr(opio1alt mnci sfa2uaxroou1opeomi3tyslm2emn p;t4arerxf3iodoptelivilt trurxr iodam nmfvilt) 2trxm nt0alenmi3iyt s2rmu s t0tetoio oytom eln sl(0t2umxo3iu4amtnlics tfarrrur ou4oexnmociydlm ulu pnu) renir iydla rluvs;()srumxm oy4opee nviat aDurumoot4altomfcils s em( sn(0texoxr3oadlm  aueo;s)t2xo(o ny1ap nlfcia(  Duax  ;t4tltnif3tat m2uanvs;u4altnmr3oy1laDeluvs ()sexoio3iu1ome  nct ()arraump;t4texoii3tas a elu snt0aeerxrciytfmtrauei;(  exmxrpiy1ll nmfvi tf Dururpot1oet mieilsfa ulu o u0aexnmo3iadfpDeauvi s0trtoirpio1llte nvsls aDrmxronu0tltnmfetytla2ul(msnu)aetnxr todla rlueils)s2urirpiy1ame lnci (f 2rrxrpno0tet mfeiad mDuan p;t)trxnxrcoa1omD lnvi t  etoim3iydapeemfvil()aDrm(r oo0altn i3tlsls2em(vo;(4areomr3oa1oa rai slt0srur(r3oy4omtnmnvta() 2ra( pno0teeomfciatlmDulums;u)aexrio3iotfpDeanvo;s trtm(mpio1ale  fctas  Dumu pot0tpxomoeiad s2emnmo;(4arerxr3ia1lptrai sl(0 exr(r iu1amt lnci t) Drmxm nu0ale  ictys sDelums () rxnxf3totlmteli olt  etm(r3io1ap n ictas)artm(mp;u1apxn o3tyd a2umnvp (0tleoxrciotlpD  n o;t)teurir iy1ole liciltfsDtauroot4tltomoeildfsDrm(mp u) exnmrcoodoate uvi;( seur(o3nodoptemfvilsfa2ra( ont0oexnio3iysfa2em(vonu4tlxoxo tatop eli o s t2xmimpoydlpeelivta( s2tmurooo0aee ioeilslm ua(mo t)aleoir3iotom   neol(0 2to(rpiu4opt  nctls) Durum ;u0aleomoctasls emn p t)tltrio3iotlpDeaivi;s)s2ur(o ny1ol nlnctl() Dtaxro;u1oexn o3iys mDelnvp;(0aexrif3iydomtraies;(0srumimpiu1amt lictltf Drrx  no4apt mietaslm raumonu0aetrmf io1oa elueol()trtrxmpiydale mfvi t  2tmump;u0oexnio3tas s em(vo u)tltnxr oodomt  iei t)tetm(o iydlpenmfvi ()srtr(r ou4teenif3iltfm2ul(vsn() lerifciydfaD  ivolt sexoxmpiodol  lnesa(fsDrrx p;o1oeenmoeildfa rl( o t0tltomo oy1latrliei (0tetoir3nodaptelnet t srtmxr ou0altnmoetyd a ea(ms;(0alxrircoadomteaivi;() rxr(opio4aptelieilt) rraum ;o0opx moeiytlsDuau pnt0trtnir tatoatelnes (  rto(r3iy4lme  fvs ()arraum ou1tlt mf3ilsls eaump;()aexoxf3oytom  aues;s)trtoxrpnu1ol  mnvi s aDta(mpou4tlt  ietysfs2uanvsnu0altrifcoatop  aivols0setrxm3iu1lm nlncs (fsDtr(rp;u4opto fctaslaDeln o u)trxnio3oatfmDe n o t0 rtr(m no4lmtemfvi t s2uaxrpoo0ole mocild a um(mp t4tltrxfctytfatr i sls0 2xmimpnydomtemivsa( s2ta( ono0teeomfeils mDel(ms ()teenmocoa1om  anvs s)tetoxm nydamt lnetlt srurx pot4oexn i3ilsfmDua( o;(0aleomrcoytopD aieo;t0teumim oydap emfei s a2ra( onu0apx  icias sDrmnvpn()artoxoctodlatr n i;( srtrir3ny1omt  nctls)sDum(  ;u1apx ii3tlslmDean p (0aexnxo oa1fmD li il()s2xoxo ou1alenmfvilt a2rrxroot1tpt io3tlsls2uauvsnt0trtomr3oodfpDr n s (0t2to(r3iu4omtelnesa() rtmumo;o4aex ioeiyt s2ul( p;()aexomf3iy1fpteluvi (  eumio nu4lp n ivtlt)aDtmxm ;o1texo feiydls2emuvont4alxomr ty1fatr ivs;() etmio3iudll elnet (fa2urxront0aleomfctasfa2uau ont)trtnxf ia1lm  livs (0 eur(rpny1lm e ncs sf Dtmurpoo1oetnif3iytfaDum(mp;u4trenmf ootlp   ueo s setrirpnydamt  fcsas)a2rmxm ot4aet  octls a2umnvpnu0trenirciatlmDeauvils)trtrir3oo1om emiei (f Dtaxm nt4altnmoetls s ua(ms t4 rtoif3tadla rauvo s0 eurir oo4lpe  fcsl(f 2ua( poo1teto feiadls2rmuvs u0altnxfciatlmtr u o () 2xoxrpio4lpeelfeilt)sDtaxr ;o0aee  feiat a2rmnvs t)arxnxf3oadfp  livslt s2xm(mpoudll n ivtlt a2taxront4aee ioetltfsDraumon() rtnir3iy1fmtr nei (0truoim3nodal e icta(f Durxrpoo4oex  f3iyd aDrl( o;(4alxrxrciytopt livo () ruo(r3oodlmenlnvs (  rra( ont4alen iciytlmDelumo;u)artnxrcoytom  au ols t2xr(mpiy4alen fctltf 2taxmp;o4oleoiocils sDran pn(4 eeoio3iytfm e nvsls0 2toirpiy1lleelfviat)a2umxr ou1aeenmfeiyd m ranvsnt4 eerxf3tadoatr nvslt0sexmxopou4am  lfesl(  2ua(r nt0texnif3tltfa el( s t0trtoxfcoodlateauvi t0 rxr(mpiudap emneia()srta(  nt1optoioeilsfaDemn s u4alxrxociydlmD  iei;(0srxm(mpnydapt lnes ()s2trxro;u4ale mf3ias a umumonu) eeriocootfpt lu i;t) rxoxr3io1lptnlictl()arta(mont0apxnioeiyd a2rau pnt0 exomocta1lptrauei;t s2xmio iu1lmeemnesls  rrauront1tle mieiat m eauvp;u4teeoioctadfaD lnvi ()truoxopio1optnlnesa(f rtrurpnt1tlxnmfcildlsDrlu s;(0 rxoxf iadfpD  i i t)s2umio oo4olenmfvtat)srta(m ;u1aeenmfetatla rlums u0arxoxf oo1fpt  ies;()tetoimpiu1ope  fci t)srtrur ot4opxo i3ilt s2ulnvo;(4tltrirciydfaDrai o;( t2xmxr ou4oltelics sfsrumu o;u0aleomfetlslsDrl(mo;u)tlxnxo ootom   i i;() rxr(mpoy1opt mnctas) Draxm no4olto icias a ranmpn() rxrif tydoaD lu i;s  euoxr3oo1ap  lnciasfsDrau p;t4oexnioetydfa2el( onu) eeniocty1faDeanvo;( trxmxopoy4optnmnct t sDumu oou0aeto fciltla2emnvp u4 etnxrciotfm ran ol(0tetmim iu1lltn nesl() Dtr(monu4tlto o3iad s ul(vp t4tleomfciytfa e i s s  rtoxrpiodap eliviatfsrrau o;o0tlto f3tydfm2ranmo;()alenxrcoy1lm  lnvi;s0 2xrir ou4lp elfeiatfs2ua(ro;o1aetnio3ils aDulumo u4trxnxo oo1faDelivsls0t2uoim3ny1ole  fes (fsrrrxrp;u0aptniictlslm2raumo (0areomf totlmtr neils t2xmimpoo4lmeelicsas srtrur ;o0opxomf3tyt s2rlnmpnt4 lxoxocia1fmD li i;s0 rxo(r oy1lmtemivsat  rrau p;o4oexoio3ias a2rluvp;()alermr3iy1lp ean o s)truoim3no4olte nvt ()aDrru pou1tex  f3tld a ea( o;t0altrmo3oy1fm eaies t trurxm oy1lmt mneil()arurx pno1tpe mi3iyd aDrm(vp;u)trenmf oatfmteliei s0trxoxo io1lm nmiesatfs2ua(  ;u1opxnii3tltla emu o;(4 rxnmo iatom rau s s)s2tm(o3nu1opeemnet s)s2ua(mpoo4apxoifcildfm2elu s;t4alxomocty1opD lu o s trxrxo iudlmtnlneslt  Drax  oo0oltoio3iatlmDel( pnu) exnmo todop  ai i;t0s2urir3iydaltemfci t  rtrum ;o0opxomietadfm2umu s;t4trtrmfciy1lpDr neo t0tetmxmpiy4ll nlncils  rrmxmp;t0alenmfciltfm2umn o;u0tlxrioctytoaD lu ol()trum(m3ny1ol elfesls aDumumpou4oeto ictadla ranmpn()alerxr3iotom e n o (0 2xo(opno4op nmiesltf Dumx  ot4tlxn oetas s emu o;t4 lerio3to1lpt anvo t) 2umxr no4lpee fcs s) 2um(mont4aexo i3tytlsDel( o;u4teeomrcio1lmt au i;( tetmim3nudal e nci tfaDurump;u0teeoiictltfm rlu snt0alenxo3oadopD  i s;t) rumxmpoo4amte feia(  2ua(rp;u1altoio3iys a2elu pn(4alerxfctydfmtrln ols  2urio3ny1apee ietatfsDuaxmonu4open ieilsfm2rm(vs (0trerif3iotlp eli s ( srxoiopiodlltnlnctl(fartmurp;u1tle  fciltfm2umnmo;u0 lerir3tytomDe ivi (0s2um(o3nydopenmnvtls) Drrxmp;o1alen fctat a2rl(vp;u) exrir3iy1fp e ivsls seurxo3no4alenlfei ()sDra( pnu0oet mf3iysfsDrmumpnt0 lenxf3ta1faDe u o s  etoirpio4lm   ivsat)arra(rpou4texn iciad sDulnvo ()tlxnmo tydoa eaueo;t setrxrpiu4omt livsat)srta(mpnt1apeniietld s ulnmpnu0 rerxfcoytom e i i s) eumxrpnu4optnmfctlsfaDtm(rpno0tpt mf3iadlm uauvsnt)tltnxfctytoa r neo;t srtriopiy1olenlnci (farta( poo1aet iociytlm2elnvsnt0arenxf3todla r neolt)s2tmio3oudomeemfvtl( srurxm ou4apx iietlsfaDrm( p t0trtnio3totlmDrli sl(0texrio3ou1olte fvias  2tru oou0tlt  ociatfaDelu s;() rxnxfcoy1lp eluei;s) 2toxrpiu4lme lieil( aDum(rooo1opxnio3iytfs umnmo u4altnif3ia1opD  i o s)t2xoimpiydllen iesasfartmx onu4alenmoeiltfa ul(ms;(4tlxrxo3ootla rluvi s trtrxr nu4lmt  nesat) 2rmxmo;t0oetomietat m2rm(vp u)texrxr3oy1lpDe nvo;t srxmxr3no4om  lfvsa(fsDtaurpou0tle ii3tys s ranms (0aeeoio oa1la  lnei;s) eumxopoy4ap  mict t)arumxr ;o0ope  i3ildlaDuanmo u0aexnmocty1fatranvo;t  etr(r nu4lle  nvslt sDtrxrp;u0aee ifciasls2rlump u4tlxoio3ta1faD  uvo;t texmir nydamen neias) Dtm(rpou4opx iietydla umn p;u4aexnmo todlp e ivo t)srtoiopiydope lfcsls sDur(r oo4alen octltfmDrmu s u4 rxnxr3todlp  luvo s0tetoxm3oy1lm n ivi t)arrrx oot4alxoifeildlm2um(mpnu)alermf to1oat auvils0s2uo(m3nu4om n ies s)a2urur ;o1aet if3tlsfa2uanmo;t4 rxnxo3totfm  au s t s2xmim oy1lpen nvtlt  2tmxro;o0altnifeilt mDumnvpnt)trtrmo ia1fmtraues;(0 2tm(m oydal n nvsls artmurp;t1alxoiiciltfa ul(vonu)alenif iodlpDrlneslt0 exrim oudoptelnvs ( arrr(m no0opx micildfs umnms t)tlxnmf3ta1lm rli s;s) euoim no1om emieia()sDrm(r nu1opxomieiadfa elnmo u4 renxrcoydla eaneolt0t2xoxm3nodaptnmnvsasfaDrmumpno1tlenmi3ilt m elums ()artnxf oydfat anvsls)tetmir3iodamtelictas)srtm(root0optnifetasla rmump t4 lxomfcia1la elneo;s0trum(rpnodop  lnei t  Dtr( pnu0opeomfeilsls2umnvp (0aexrifciy1fat auei;t trxoxo3ou1olte fvias a2rrx ont1teenifetltlm2rluvsnt4aeerxr3oadoaDr u s s srxrxmpoudoptemnei s a2rr( ont4aeenii3iyd m rau ont4 rtnmrctotfpD ln s;t)trto(m3ny4alenmfvsasfaDtaum nu1alto f3iaslmDranmonu0 lxnxf ta1lmt aneols) rto(r oudllt  fvtasf Dtaurp;u1tlxn i3ildfs rm(ms;u4 etnxo3oydopDranvs;()texoxmpoy1lleelncias)sDraxm no1tpx iociyslsDranmo;(4tleoif3iy1lmteln i ()trtrxr3nodlp nmfesa() Dtm( pnu1tlx moeiad s2emnvp;(0aetnxf3ia1oaD  u i ()trto(m3iudom nmics s)aDtm(m nu1opx mieias m2rmuvo t4 eerir3oatoatelu o s seuo(r3ou4opeelnciatf Drru oou0open f3iyslmDrmn s u)tltnxrcta1fp   uvsls0 2tr(m no4lmee fesls)aDuaum nt0aptnioeiys s uanvonu4tetrif tydlp eai o;t) 2umxmpiydame lncs tfsDrau oou4texn feias a rmnmp u)aetnxfciatomDelies;( seurirpiydamt  icil( sDrrx pou4altoio3ilt sDrlu o;u)alxoirciadlm  ln o (0 exmxr3ny4ome liei tfs2rmx pno4oexoifciasla um(vs u0 ltnxo ta1fa e ueol(0 rxrio3ny4lmtnmfct tfs2ua( ooo0opxnioctltfa ranmp u4aexoxr oydlptrln s;t s2toir3io4ameelfvsat)arrr(moot0tpxnmfetys a um( o;(4alenmf3tadlat  i i;( trumir oy1op e ivs s  rrru ont4oet mfeiatlmDeaums u0arxnxf3ta1lp  lneo;()sexrxmpoo1ol   icslt  rumxr no0altomf3iatfaDul(mp;(0aexnxr ia1oa rlnvo s0srxm(o iudlpe mictltf 2tm(mp;o1oetnioetldfm eanmp u0trxoxo oa1fatrlivi;(0trxmxo iu1ope  fvia(f Dur(m ;u1oexoifciysfa ua(vo;u4altriocoy1la e neslt0 rtmim3oodalee icta(f rumu  ;t0tetomf3iatfs2rmu o u0altrxr3tatfaD aueo;s s2trio3nudlm   icta(  Dta(r ;t4aet mfeiad aDeanvsnt0texrmo oodop  aivsl(0seum(o ou4llte nes ()aDumumont0aeeo oeias aDrl(vo u4tetoif oydlp  ai o;s0s2toir3iy4lme mies t) rrax pou4olt miciasls ranmsn()tltrxoctydlpDe nvs;(  exrim oy1amtnlncta()aDurumono0tpen ieiad a elnmsnu)trtrmfcio1oateaues (0s2um(rpoo4ap nmnet sf 2taum ;t1apeomieiyt m2elnvp u0 rtnio iotlp  lnvo ( teur(opno1lpe licsas sruaurpoo1opxomfeiadfs2raump;(4artnxr iydomDe uvil(0setm(opio4lmeelfvtasf rrr(r ;u1opeo iciasfa2uln p u)aleoif oatlp rlneo;(0t2um(opiy1ol nlnvsas arrauroou1oexn fciydlsDranvsnt)teenif ia1latr ueslt) rxoxm nodlpen fetlsfa2rmumont0tetnmfeias sDul( p ()aetomr todlaDe i s t0 exo(o nu4am n fcs ( a2ur( pou4oexomi3ias s2ua(mp u0 exnxo oadfat aueo;( trumxr iu1al  lnetl( arra( oot4aleniietlsfs uan p u4aexrmrcootla e uvi s s2xr(rpno4olen fvils  Draxm ;t1tltn ociytls2em(vs u0artnmf3tatoa raivo;s srxrirpnodlmenlnvt s)s2umu pnt4tlxomoctyt sDumu ont4aexrxrcoatfate u s t  2umxm iodlpe  feslsfsrrr(mpou0olenmf3iasfs2uau s t0alxomf ia1oatean olt0seuoxr3iy1omen fci sfaDum(r ;u4opx  o3ilt a el( o u4artoir3iy1fmDr neo;t t2xrio no4olee fetat)sDtm(mp;t0oexn i3ilsfm2rlnvp;t4aexnmf3ootla elnvi t0sruoir3oy4aptemivta(faDraxroou0tex ii3ild a2raumo t0 eeoxf to1fateaivs;t)teurxr no4llt  fctasf rra(mpno1tle  ieiytfm2um(ms;u)aexnmrctydfmDrlnvo t t2tm(m3nudam n ici tfs2trumpou0tpt  f3iad a emuvp;(0aexrxo3oydomtrluvs;()texmio3nu1ameemfct ()sDumu pou0apx iieiltfa2ul( o u) ltnirciodlaDrln il(  2xmxo iodlp  mivsatfarrr(mont4alenio3iatla emnvs t4arxnifciytlat an s;s srto(rpnu1lpeelictat artmumo;u1tlt mfciltla2emn p;() rxoxrctytlm   uei;t) 2tmxo ou1lpenmfeil() Drr(mo;u4aptoioeiyd a rl(msnt4aexomf tadla rlnes s t2xm(rpoydamt  neilt)a2tax pou4apx mfciytlm rmuvs;t0aetnif3oatopDrlu i ( s2to(m3iy1llte nvsat) 2taump;t0ole  oeiydlsDuau s;()tlenmociytfp r i i s0 exmirpny1lmee nesl(fsrtmxro;o1tptnmo3tltla2rl( p;()artrio3tadfmDe uvs t  2tmim oy1ol nmnetatfa2tmumpno1ope  feiasfm2ua( s u4 rtoxo3oodoa e n i;s)s2tmiopny4lleelfei ( sDum(m ;u4apeo oeilsfmDuanmsnu0arxrifciadomteanei;()srxrxr iu1ole  nctas arta( p;t1tlenifeiydlm2ulumpnu4trerir totoa eaivils)t2ur(opnodamtemiei s arrrxro;o1oeto fcildfsDrmums u0altnif3ootlp   n olt  2umxo no1lleemncils  2raxmo;u0opto fcildfa rluvo u0 lermf3iodfate iei (  rxr(m3nudaptelfeilsfsDtau  ;u0apeoioeias m2uaums (0 rxoircty1lateliei (0 rtoio3nodoptnmfetasfs2tmxm nt4tpeoii3tyt a2emuvp;t)altnioctytlmD  uei t  eto(o iudolenlict tfartr(rpno4aeeniieiyd sDeanvp;t4altrif ty1omt an i t)sexmimpiy1op n fctlsfs2rmxrooo1apto fctytlm ua(vs;u0 leoxf ia1lmtrlnes;s0seum(m iu1ape licsat) Drr(mono1oltnif3iltfsDrau o;t4areoirctadfm   ieil(0 2toxo3iudamt miciat aDtmumo;o0oeto oeiatlm2ea(ms;u)altnmf tadlpD anesl()t2urxrpiydome lfvsls) rta(mo;t4opeo o3iytfsDumnvo;t4texomf3oatopteanvsl()sexoim iu1apee icsatf rrru  no0olt moctatls2um( s;u0aleoirctadlmtrau sls)texrimpny1olee nvsa()aDuax pnu0alxoio3tytfsDrmu on() rxnmoctadomt ai o s) rxoio nodaltemiciatfsrtrx pot4apx mfctls s umnmo;t0 lxrmr3oydfaDr neslt0trtm(mpou1oltemietas sDurxm nt1tpxn ictltfaDumu p;u4 eerio iy1fmt aivi;s0sexo(mpoo1lltn feil(  Drru ono1apx iieiyt aDulu o;u) exnxo3tadoat  i o;(0 rtrxo3iodaptnlicil(farta(  ;t0teeo ocils a2elu o u0texrxr iatfatrli ols  eto(o3no1am  lnvil() rumur nt1oltoif3iasfa2ulnmp (0aetnxo3oytfaD  i i;s)texrio3iu1ole  netatfs2umurpnt1ale iiciysla2ulnmsn()trxnmr oatlaD li ils0trtm(r3io4apee fetas s2ra( p;o0apen o3ildfs el(mp;t4texnmr3ootfaD  ivsl(0tetr(opoo4lme  fcsl(farrmxrpoo0ape moeiasfm2umnvpn()aexrmf to1op e i s;s0t2uo(mpoudamenliei (f 2tmxronu4aleomieiltls2raums;u) reomo3iy1fatrauvi s0srxm(opiy1llt mnvt tfs2rmx poo0optnmiciadlaDran o (0tetomf3totfmD aues (0s2umim3ny4alte ivt tf Drm(ro;u4tex mi3tyt a2rau p;u0aetrxf3oatlmt auvi;()seuoim nu4ll  lncia()srumurpno4tle mfeiyd aDuanvsn(4alxrxr tytfmteauvsls) 2trxopnudal elfvt t srraxrpnu0oltoifetad mDran pnt4trxnifctatopDrln s;s0srtmxrpoo4lmtemfcta()sDrmump;t0aeen feiys m2umump;u4artoxo oa1lp  luvo;s  ruoio iy4al elnei (fs2rru oot1tpeomocilt sDemn p (0 ltnio iotfa rlu s;s t2tmxm3oodaltelfct (f 2rau p;t4aeeoio3ils mDem(vont4 eenxo ia1lm elieol(  rumxmpnudame lncs ( aDtau  nu1tpxoio3tltlaDran s;u)alxomr oatfm   n il() rtoxmpio1lltnlfcs sfa2uaumpnt1opeomoeiatfa2el(vo;(0artrircoo1opD lneils  exo(m iu4ape lfeilt) Draxmonu1ole iiciys a rlnmp (4 rxnmr3iydfp  ai il( setr(rpoudapenmnvtat artmxmp;o4ole mi3ildlm2em(mp;()texoxf3iatlpt an s t)texoim ny4amtemfvtatf rurumpnt0oeeomicildlaDel(vpnt4altnifciy1lpDrlueslt0s2umxo3oo1lpen neiat)a2ua(mo;o4tle iieiat mDelu o t) lenmf3todlm rlnvo t)s2umimpnudaptn ncslt)sDuru pot0tee  o3tlslaDra(vo;t0alxnxfcto1late ues t)s2toxo3ny4lptn ici (fsruru p;t1apxomieiys s2el(vo t) eenmrcia1op   n o;s  rurir oodol emnvs sfa2rr(r nt4tex io3iydla2ulu on(4aeeomf3oa1fmtean s;( srtrxrpoodop nlietat)sDtmxmo;u4aexo oetadfa rmuvo;t0 leoxocta1omDeluvo (  2tm(mpiydape lnctasfa2ra(root0tptnmf3iysfa2elnmp;t)trerxr oadlat  neils  rtmir no1al elnct t  rtmxmoot0tptnmfcilsfm ra(monu4 ltnxf iodlat  u i t s2tmxm3ou4lle liei s)arrm(m ;o1ole mfetytla2ul( p;u4tetniociytla eai slt0 2ur(m3io1olenmiviatfs2rmumo;t1tlt  fcilt sDrln pnt) lxrmr3iodlm  au sl()seumxopoydop emnet t)arururooo4texnifctysls2el( onu)aetoxo iatlpDe ueilt0 rxoxopiydlpt  nvias) 2ua(mo;o1opxn ieiaslaDrmu snu4texomr3tatop   u i ()trtoxo nydol e fvtasf Dua(rpnu0optnio3ild m2ranvs (0arxomr oa1fmt  uvo;t)tetm(r3ou1omenmfei t sDrax o;t1tlxnmfciysfmDelumpn(0altnif3to1lm  an s;s0setmxo3nudolt mfvslt)aDtmurpot1ale ii3iyslm2ra( pn()arenmr oydlm e neilt srxrxm3nu4omee nvt s)s2ra( p;u1aleniieiasfa2ea( s;(0 etnmfctodop e i i t)t2ur(o3oydape livsltfarrr(r ;u0texomiciat a2umnms;(0 ltrmrcta1lpt ai ols seumio3iu4ll   ivsl( srtm(m no4openioeiltls2emnmon(0 ltrmr3tytlmtrli slt)t2uo(m io1lm emivsatfa2rmxrpnu0openmf3iatlsDeaumo u0teenxr iotfpte nes t) ruoim io4lpe  ivsl(  Duaxmo;o0tetn icild mDumnmsnt4 ltomo3ta1fa  aneil(0t2xmxm3nodapt lfctatf Dtr(m ot1teto ieiltlm rm( snt0teerirciydlaD  i s t s2tm(o ou1lmtn fetlsfaDurx  nt1tetoifctls m2rm(von(0texoxr totomDrlivilt  rurxo3oy4optelncs (fsDrrum ;u4tex  fctyslsDua(mp t)alxrmo3iydoa rlueols0texrio3oodapenlnctat srtmurpot1apt mo3iatfa emnmp;(4trtoxo totlaDelu ol( srurxo3oo4apt  ncia()sDrmuroou4tpxn oeildlaDumuvp (4trtnmf3iytoaDeaivi;t) 2trimpiudllte fvias a2trxrpnt4tleoif3ild a2rluvs;(0tltrxr ia1lm eanvo t) 2toxopnu4ope mfctls)a2umx  no4tle  fetytfaDra( p;u0tetomf3ootlpD livs t0 2xoim nu4ol elfvs s) 2tru pot0oexn iciad aDuaumo;u0artoif ootlpDran s s0sruoimpoo4lpee fctls srtaum oo4aee iociydfm2ul( s (4aetrmo3iydomtelivsl() 2xrir3iydomte ivia( aDur(r nu1oet  f3tlslaDeau s t0 renifciotomt lnes s)t2tr(rpny4olenmfvs t a2rauront1olxn iciytlsDua(vpn(0trxoifcoa1oaDe uvsls)sexr(o3nydolee ictlsfa2ua(  nu0olx mfciltfs2uanmpn() rxoio to1fmtean o () exoxrpoy1lm n nctl(faDumxmpnu1oee iociatfmDulumpn() lxoxf tytfmtelieolt trur(r3iy1lmeemneil() Dum(roou1aeeoio3ilsfa2rauvp;u0 rtomf oadopDeai s;(  euoir oydamtemicslt arurxm ou4ape iicias m umu p;u0aexriociodom rliesls t2tr(r3iodale lfeils) 2trumpoo4apxnif3iyd m2rmu ont4aeenio oytlm  aneilt0seuo(rpny4lmee ncils  2um(ro;o0opeoiictas aDemnvsnt)alxoir3ty1fpt au o;() exmxm3no4ope lfcta( artau  nt1optoifctldfa2em( p;(4 lxnif3oodlmD  u ol( s2trxmpnu4lm n nct ( sruax  nu1altnmfctldfmDrlnms;()artnmo oadoatelnvi;t)s2tmxm iu1ll  mfvt t aDur( ono1apxn f3ilt a elump;u)aeeoxf oytlateanes;t  ruo(opnudlp  lfes ( s2rrur ot0texnii3ilslmDranmpnt)trtnirctydlm e ieilt) 2xr(opou1ll emnvsl() rua(mono0aleoiictlslm uau o;(4 rtniociy1omteli ils)teumio iy4aleemictl(f 2tm(m ;t1optoifeiltls rluvo t0tlenmf ootopD lneo s srxmim ou4lleelnctls  2tru  ;o0tpe  ieiyt sDemu on()trxomr io1faDelu sls0t2xm(m oy1lmen ivs s sDrax  ;t4ape mietyd s el( o u)trenxrcty1lp  aivo s0teto(m iu1open icsat)srtrumpnu1tpeoioctatlsDrm( s () eenmo ootlpDe ivsls)t2tr(rpoy4amt lfeilt) Dumxro;t0olx  ietyt s2rmnvs u4 reoir3totfmDranei t) 2tr(m nydale  fct s)arrrxront4aleniieildfm emuvsn()teenifctytfpDelu s t) eurio iudapen ieia() Dtaur oo1apxo fctytfm2el(mont4 rxoio tytfp  auvol( teuoxr iy1oltn netl()sDum(mont1aeto iciytlaDumnmp;u0teenmrctydoaDelivols) exo(r3nodop nmncs () 2ua(m ;u0tpenifetld mDulu on(4 rtnxf3iodlaDr n ol() 2tmim3no4olenmivsl() rrruroou0aleo ieiltfm2rlums;(4 lerxf ta1om  aivo;(0t2xmxmpio1om emietat)a2taxro;o4oeenmictltfsDemnmsn()aleoifciytopDrau o;( srum(o3ny1om nlfcsl()aDum( ont4alxomf3ilslaDua(vo (0 lxomfcootfa   ieo;s srtoir iudomtemfci t s2raxmoot0tptoioeiat m2ul( p;u4texoxrcoa1omtrlues s0t2umim no1lptn fetat)aDuru  oo4opeo icilsla elnmp u)tlxoxfcoydoaDeluvslt0 2tr(r no1op   ieil(  2rr(m oo0aetn o3iadfs2rluvs ()tltoifctodfmD au ols0 2tr(mpoo4alt lfvs ( srta(mpoo1alenmociyd s2uln pn() lerifciydopt aueo;t0t2xoxopio1aptemietls aDtm( p;u1aeen fetltlm rluvp (4 rxoxr3oatomteaueilt0 exm(r oodlm elivtlsf 2tr(mont1oeeoio3tytfs umu o;t) lxoxfcoy1omD an o;()sexrxo oo1aptemfetasfsrumum ;u1alxoifciydfm el(ms u4 reomr3oy1lmDe ies t)t2um(m3oo1lm elfes ()aDrmumo;t0teeoifeilsla2ua( sn(0aetnxocio1laD aivil(0s2tmxo3oo1ame  icia(f Duru  ot4apeo ictltfmDul(msnu) renxociadfaDe u o;(0teum(r3ny1amt  nesl(farrmx  ;o4oeeo fcildla2rmu pnt)texoxf3iydfpDelues t0trtoio3ou4lmt mfctlt s2ra(r ;o4aee mfctls s uaumonu0tetoio3iy1fp ean i;t trto(m ou1lmtelfvslt  rrau ooo0aetomietlsfmDuanmp u4artrxocoadfmte u i (0s2xrxo3oudalenlivtlsfarrr(rpnu4oltoif3tys s ean o (4 reoir totomtrai slt0 2tmxmpoydamen ivs t  rrr(mono1openioeilslaDuluvo () lxnmf oytfatr ivo;s teur(o oudlmtelics t a2rr(mono0tpenmfctldfm2rmu p;u4 ltnifcoodfmD an s s s2umim iu1optnmfet t)aDtaxmont0olt  f3tadlmDea(vsn()aetrmo to1lmtran slt) eumimpnu4ap elietas  2urx p;o0teeomoeildfmDem( snu0aleoxoctodop eanvo (0s2xr(o3ny1ol nlneiat)aDtm(m ou1teenmocias m2um(vp;t)tleomf3ia1lp   u ils0trxr(opnydlpt  fvsltfsDtmumo;o1oeeomoetatfm2ulu p;(0areomo oatfp  liei t) eumxopoy4apenmnvsl( a2umu  ;o1aex  ieiadla ulumonu0 etrmf3ia1fp rlnvil() rtrxr3nudomen nci ()aDuauro;t0alt  fetasls rau p;(0trxrmf iatfa eauvils0truoxo nu1lpte fvtat)sruaxrpnt0tle ioctytfmDrmump;u4 leoio iadlmtr u i;(  2ur(r3nodamtnmivil( artmxroou4opxnifcild sDumn on() ltrif oydfa rluesls0 eumxmpiy4oleemict (  2ra( p;o4texomo3iatls2ra(mo;u0 eermfcoadfptrauvslt s2to(mpnu4llt mfcilt) 2rmxmpot1apen feilslsDuauvsn(4 exnmo io1lat au i;( srumxmpnydalt micsls)artm(r ;o1optomi3ils mDelnvp t4 etoirciotlm  ln o;s tetr(o3ou4lltelivilt sDrmxmo;o4apt  oeiyslaDuanmo;u0arxomr oy1fmt anvi;s0tetoio3iy4al elnet sf Drr( pnu4oex  ictatfsDrlu s u4alxrmo iytfpt au ols)trurirpnu1opee fvsls  rtmu  nu4opxniiciltfs rauvs (4trxrioctydop e uvi t)teum(o3ou1lptelivi (fs2rm(r ;u0tlxnmociatfa2emump;u)texomr3ty1laDranei t)s2urio3nu4ol  lnvt (farrrxmo;u4aee moetyt sDemuvo;(0trtrmr3ia1fa  lnei;s) 2to(o3ou4lp emnvt ()aDua(r ;o4tex iictytlmDemuvs t0trxrir oadfpte ueilt  2tmxr3io1lpen fei t a2rr(moot0tetnmociatla2raums;() lxnmr3io1oa   ieol(0t2tr(r3ny4lme mfvi s) rta(r ou0tpt moctys mDrmuvp;()aeeoif tadoaDrlnes;t0seum(o ou1olee netas  rrrxmoot0apxn icild sDum(ms;u4 lenxoctydlmt auesls) 2xr(rpoy1lpe mfcta(fsDrmxrpnu0tlx  i3iyslm2ua(mo t4 eerxfcoytfatrln s t0trto(m3oodap  livsl(  2umx pnu4tpx iieiad aDumums;t4aeeoio iy1fm  lueo;s) 2xr(mpiodllenmfvsas)s2ua(rpno0oeenmoetaslsDrmuvs t4aexoifciotoate nvols)seurxo nydolee ivils) ruaurpnu0opeomoeiydlm2rlnmo;(4tltriocoo1faDrau i;s t2uoim oo1am emn
\ No newline at end of file
@@ -0,0 +1 @@
+n i;(0sexrimpoy1amte feta( a2ta(  ;u0ale mfeiys aDel(vont)alxrmr3ootfa  li o s0truoxo3oo1lmt  ivtls)sDururono1opeoioetlsls eluvo;t0 lenmocoodfp  aueils t2trxo iodlpee ict s)arra(  ot0teeoifciat s2rau s u4aetomf3todoa eai o;(0 rxmio nodalenliet t srtrurpoo1apxomi3tyd m ea( o u0alxnio3oa1om   ies s  2toxo oo4am  miesatf 2ua(  ;t4texn o3iyd mDem(monu0arxoiociy1fpD lu ols0trtmirpoydamtnlici (fsrua( pou0aex ioeiydlm ul( o;t) ltrio3oodlm   i o s0 2xoxr io1am n ivs t arurur no4aeen f3tydls2umu snt0 exnif iotopt  n o;()tetrimpiu1lptemfeslt)aDtrxrooo4apt iictlsfs2eln pn()alenio iydlpDeaueo;()srtrxm3ou4olte netlt s2ta(rpnu1oex moeiadla rmnms;(4trxrxf3oatoaDrau o t truoio3oo1llee ncsa()aDrrurpnt1opeo fcildla2uan pn(0alxrioctytfm ean s;(0truoim3iydomen ivtlsfsrtm(ronu1texnmo3iyslsDum(vs;u0tltoxo oytfatraiei t0t2ur(r3oodomtemfetltfarra(r ou1oee if3iadlm2rm( ont4trtnir3tatfaD lnvi;()tetrxo nu1omtnmfct s srur(root0tle  iciltfm ranmo t4tltnxr ootfpt  ies;s0 eumimpiy4ol  mnvs (faruaum ;o4teen i3iyt s2ra(monu0trtoio totlp  luvo;( s2umxr io4lm   ieia(f rraum ;o0aet moeiltls ea(vont0artoifctytfaD livo t  2xr(mpoydlmeemivsasfsDrax pno0apxomi3ils mDeaump u)arxrmr3ty1faDe u o;s0 2tmxm iydlmtnlieslsfsDumxm ot1ape  o3iad s2ua(vont4 rtnir3oatop elues;()srxmxmpnu4ameemfci sfaDrr(root4opt mfeiltla ranvp;t0 eenmociodlmtelu i;t0texm(o3ny4om e fes tfa2ur(ro;o0aleo iciytfs2rln o u0areomf3ia1fpteanvi;s)sruoxr oydlmee ivi ( s2uax oou4tlxoiieiyt a2rl(vo;t4arxrmf iodlp  ln s () 2xr(r iy4amtnlfvi () 2tmum ;o4tex ioctldfaDemn p t)alxnif3tytopDe ies t) rxmxrpiy4lltn ncias srtm(rpou1optoiictys s2rau o t4 lxomo3totfpteaueol(  ruoxo3nu1llenlnesat  2rruro;t4tle  o3iatfa rlu p t) etrxr3oo1lp r n o t) rtoxr3oydll n fcsat) 2rmum nu0tlt  f3iyt m2emu s;u4 etrxociadlp elnvo;s) eurir iodaltnmneia() 2rm(ro;t4oexniiciad s2eanmo;u) rerif to1lptraieo t  rxrxm oo1apenlnctl(  2trxm ;o1tlt iietaslsDelump u4tlxrifcootopDeanes;t)s2to(o oy4alenmfcils  2trxr ;o1apeomieiltfs umnvo u4tlxrir3iydfp e nei s teur(r3nudoptelfet (fa2um( ont4apxomf3iatlm2emu pnu4artrmf3oodfa  luvs t)s2tmxmpnu1am  lfvils)sDrrx p;u1altnmi3ils mDuluvsnt4tetnmocoydlaDr i sl( trxrxo oudlle lieilt)artmumonu4oetnmi3tyd sDum(ms u4 lerioctodfa rauvol( srtmxr nudopeelfcslt  rururo;u1aetomfetatlaDrm( ont0 rtnifctatla e ivi;()srtm(m3nu1llt mfetlt)srur( ont4ope mf3tytla2rlu onu0artnxo3iy1opteanes s) etm(r3nodap e fvtlt s2urxr nt4tlt ifctatfa2eaumpnt)aeeoifctytlptelueo (0 rumxopiy1llte fci (  rua( oot0optnmfciltlmDel(vo u4 rxnmrciodfateauvi;( s2um(r iy4ome lnvtls s2rrx o;o1tpeniiciat s2el(mp;t)artrmo iotlmt  ieol( tetmxo3iy1am nlfvslsfaDtmuronu0alxn oetldlmDel( p u4tlxrifctytlat  n ils0 2tr(r iy1altemnvs t  Durx ooo1tleo ietatfa2rl(vs u4 exnmo3iy1lp e n s t)srtr(o3oy4lp  lnvi t)a2ra(roou0aexn oeiyt aDrm(vs t4 leoxociatoaDelivo s0srtmxopnu4altnlivilt srtax  oo1texnif3iaslm eau s;t4aeermociydom eanei (  rxoir3oo4amt  ictas artmu oot1teeo f3tat a2rluvo () etnxo3io1fmte ivs t0s2umir ou1am  lfvi tfaDur(  nu0tle ii3tlsls2rlu snu)tetoif3oa1laD  ivolt0 2toxr3ny1llte ivt sfsDtmumont4olt mocilt aDean s;()trxnif3iatfaDrau s;(0 rur(m3nudape lnvias)s2urxr nu4texoioeilt sDrl(vpn(4altrxr oytoa eanei s0trxoxm io1op e iet s) Drm(r ;t1oetn i3ildfa uaums u)texnxo3tadfp rlueo (  2trio3no1aptn feta(fs2ur( ono0oeenifctlsfm2rm(vp u4 lerxfcoodfp  lnvslt)s2tmir3oudlleeliviasf 2rrxm ;u1olx iiciytfm uln s;u)trxrmfcia1oaDr ues (  eur(m no4lltemneil(  Drr(r ;t1tlt ifciat aDem(vpnu)texnxo iadomDrai i;(0s2ur(o ny4lpenlfcil() rrau  ;u0oeeo ociaslm umuvs t)alxoxr3iatfmDrauvsl( s2urxrpou1apeelfet sfarrrurpno1tlxnifctltla rmu p;()artomocty1oat  nvs (  rto(o3iu1ol  lncsls)srtmxm ;o0aexn i3iadla ul( p;u)treomf oydla  au i;s  rtrxopou4amt mneilsfa2ua(mp;o0apeoif3tlsfmDeaumpnu)aetrmf3ootlate ieils0srxmir ou4aleemiesl(fsDrrump;t0apt mfctysfa rmu o t0 leomf3iydfpD  u o t0sexo(rpoodol elfeia()aDrau p;u1aexniictyslmDuluvp t4alxrmr oatfa rluei;(  2tr(rpio1alt mncils)sDtaumont4ole  octadlmDulu sn(0aeeomr3iy1fa rlnes s)sexoir3nu1omenmneia(fs2ta(rpnt4tpxnif3iatlmDuanvp t0 rtnmf3iytoateai sl(  2uoim io1openlnet sf 2ururoou1opxnmiciltfs rau o t0trxrxf3iadoatraieo ()s2tm(o3ou4lle miei sfa2trumpot1aptoifcias s2rauvsnu4 rtnmo3ta1lmtrlnvolt  rtmim3nu4omenlicsls  rurxr ot1tleo ieiysfm ul( ont4tltnif oo1optraivsls s2tr(r3io4ap nlivtls s2trumpou1opeomfciat m2uln o;(4 rxrir io1oa e uvils)t2xoxo ny1al  mfctl( srrm(rono1tpeomietyd a umumo t) exrxr oadfm rliei;s teum(o ou4lm nlfcsat artmur ;u0oeto iciasfm2elnmp (4aexomocoatop  li ol(0trtrxr oodamtnlivtl(f rurxr ;o0olxomociytfs ea( o t0tetrxo3ootfaDr u ol( sexr(o3iy4alte iesl() Drrumpot4aleomo3tys a rlnmo u0tltrio3to1lm r nes t s2xoir ny4ame  nvilt sDtrxmpnu0tpeo octatlmDemnvp t4altomr3iadlmD anes ( s2to(m3ny1op  lnetls a2raurono4tle  iciyt mDrl( p u0 rtoif oydlptrli olt)s2umim iodopt lfvtatf Drmumo;u0oexomiciydfaDra(monu) eenif3oa1omtran sl( srxmxmpno1olenmnvsas srra(r oo4oetomfciaslmDrm(mpnu0texnmo oy1lmDrau o;(0s2xrim oodopte ivslt) 2urxrpou1tex  ietytfa emump u)artomociydfmt  i s t0tetm(m3nu1lmee ivtat)sDumx  nu4oeto i3iatlm2eauvs;t0altrxo ootop  lu i;t trxoxr nu4lpe  ncsl()s2umur ;t0oeeoifciatfa ra(mo ()trermo3oatomteaues;s)t2trim oodam  mfciltfsrta(m ot0opx miciatlmDranvs u0 renxf oatom e ieils seuo(mpiu4ap nmfesas arrr(  no4aleo icild a2rln snt4 rxnxf totlateai s;(  euo(m3nu4ol  lfvsls)arurxr ;t4aptomfctys a2emump;()tlenifctydomD lnes;s sexoio ny1olenmivsas)arrr(mono0aex ifeiytfs um(vpnt0trenmf ia1lptr i i ( tetmxo nodlmeelnctas) Duru o;u1texomfeiad mDemums u0aexomr iodlmtraivols0 ruoim3ny1omt livslt s2umxmpoo4tle mf3iltfa2ul( snt4alxoifcoo1lat  uvs t seum(mpny1oltnmfvsltfa2tmum oo4oexnmoeilslmDulumo u)aeenifctodlaD  nvols s2xmxo3oy1llenlnvs (farum(  nu4tptn fcildla2ul(mpnt0tlxoif to1lp r i i;s) rxo(rpoy1al n ivtas) rtax  ou1openifctydlsDem( o (4altrxr oydopDrluvsl(0sruoxrpiu4oleelivi ( arumxmpnt1tlxo f3tatla2rlnmp () ltoxo iodoptelu il(  etoio iy1lltn ict t) 2ra(root1ole  f3iys s ra(vo;(4tlerio3iydfp r n s;s  euriopou4lpt  ictlt)srtrx ont4ole mf3ildfa eanvonu) lxrirciotlm  luvo (0truoxr io1amt miet sf 2ta(m ;o0olt mi3tytfm rln pnt0altnxo ty1opD aiesl()t2xoio3oydapte neil()a2raumoou1opxo ociyt mDrmump;t0alxrxr oydlate ueol() 2tmir3oo1omtnmivt ()sDua(ro;o0tpeniiciysfs2ulumsn()aeenxfctodop   n ils0 2triopoo1lltemiviltf Dumuro;t1tpeoifciysls2uanmsnu) etomoctodoaD  nvo;()t2urxopno1lptnlics s  Dtrur oo4teenmo3iasfaDrlums;(4 rxomo ootfp   nvo;s)teumimpiudole lies t  Dur(  nt1aleomoetls s2um( p u0 ltnmoctadoat ai o t0trxmimpou1opte nvta() Dua(mooo0oex  i3iyt m umnms (0teenmr io1fa rauei;()truo(m iy1om elics () 2uaxrp;u0opxn fcils a2ran p;(0aexrio3iotoaDeli s;( teurxm3ou4ale  net t)sDumx pnt1alen iciyd mDuau o (0 rermfcoo1lmt li o;t)trtoxr3nodop  lncs t)aDuaxmpno1tlto oetys a2rl( snt4artrmr oadlpD  nvilt t2tmimpiu4om  lnetls aDraur ;u4alxnmf3iadlaDuaump;t0 rtoxfciatop rlieo s)srtr(r oo4ap emnet s)arrrx o;u4apt mociyslm ulnvo ()aeenifciotom  lu o t)t2trxr3ny1am nlneta( srumumoou0alxomociltfmDumumsn()arenifcoa1omtraivi t sexo(o io4lpte nct t  ruax onu4aetnioeiys s rau p t)aetoxfcoodfaD  uvi ( texrxm3nudape mnviatfarumur ;t1aeen feiat s eanvp;t4trtnxo3todfpDr n s t)trxoim nu1lleelncil(  Durumoot1tpen ietyt s uau s;t)aetnxrcto1fmtr uvi s  exr(o oo1ap elnet () 2rmumooo1altoiictltfmDemnms;u0teeoio oa1opDe ueils)texr(rpiu1llenmfcsl( artmxrp;t0alto f3tadls2ean pnu0texoxo oo1fmtelu ols0teum(o iu4ll nlfcsl( srur(  ot1oltn oeild a ea(vp;(4 reoxr3iadla rluei () rxrir oy1lp emfvsas)srtrx  nu1tlx ifetyt mDum(ms (4 eenir3ty1opt  u sl()texrirpnu4lpen ncs (fsruru o;o4tpeomfctydfaDrmumo ()tetnifcty1lp eln o t  exoxm3iu1opeemnesl(fsrrrxmp;u1tlt mieiydls elnvpnu)trtrmr oytfpDeli i;s truoxo3oy4lp e ivi (  2uaumpot0alxnifeias s2emu onu)artnxo3oadlp e ies (0 eur(o3io4ap e ivs sfsDrmxmoot0opxnmietys aDumuvo;() etrmr iadlat lueo;s  rurio3ny4lp nmfvs t arua(r oo4aex iociltlsDelums u4tlxnmocoydop eaueols0 2xm(r oodlmtnmivsl( arrr( pnu4alxnmoetad aDuau o;(0trxniociotlpD  u i;s s2xmxopio1ome lnci ( s2tm(m ou4teenif3iaslm rluvsnu0 rxnio3ia1laDelnvs ( sruoxo3oodoltnmfvia(  Dra(rono0oleomi3iadfa rau p u)arxomr3oy1om eauei;(0setm(m iodap  livias  Drm(r ;t0apxn ocilsfm2em( o u)teeomfciatfatraiei;(  eum(opiy1lptnlivtl( srrau o;u1aetnmfctyt s2rau s u0 rxomo oa1latr n o t)sexm(m3oy1ope mncs t artrxr nt0tptn oetas a ulnmo;(0tetrxrcty1fa eaivs;( teur(o io4lp emnvtltfaDtaumo;u4oee mictyd m eln s t4arenio oatopD ai sls)texr(mpiy1lp   fvsa( arrax pnu0aetoiictydlm rluvo;u) lxrmrcio1fa  lies ( srtmio3oodlm elncsl(f rtm(rp;t4aeeoiiciytfsDuan o u4artoxf3ootom   uvols  2xo(mpny1amee fetas a2tm(m oo4teeomi3iydlm elumo u0texnxr totoatrlivs ( srumxo3ou4ameelncilt s2tmum oo0apx  icildla2ulu s;t0aleomr3iydlm ran olt s2xoxo3ou4alte ivsa(fsrurxmoot1aptomoeiydlm2em(mon() eeomrciotlat luei () rto(mpou4lmtn fet (fsDtmx poo4tex ioeilt aDrmn snu4teerif ootoaD ln i s) ruoio3iudlm elnvtl()sDrrurpnt1texo o3tydls2uanms u)tlxrxrciydfm raneilt0srurxm3iu1ame lnvi t)arrr( o;o1olxn feiytls uaums;(4 exrmr oo1oatrli o;t0srxrxo nydol elfei ()a2trx o;o1tpe  oeild s2el(vs ()tleoif iadfpt  i ils sexmxo3nu4ape lnvi tfarrrxr ;o1oexomfctyd sDrl( pnt4aeenmr3ootfate u i t trxr(r ou4alte iesasfaDtau  oo0optnmoctad m2uauvs t0 etrxrcoodoat ln o t  ruoxmpnodol e fetltfaDum(  ;u0apt iietyd m2ua(mo u)texomf3oatfaDeli s;s trxm(o iy4ameelnes (fa2tm(mpno0opxniictlsla2eaumsnu0 eenmfcootoate i i;t0seuo(m no4ll emicsa( s2raum no4apeomieiys aDuauvo u)trxrif oatlmteanvs t0teuo(opnudol   fci s) rur(r nu1aeenmi3iatlmDulump;u)alxoifcty1opDeaneols0teuoim3nodape  nctlsfa2rauroou0apxomf3tysls2umn pnt4tetoiociydfaDeanvi s t2to(o ou4lme mfesat sDtmx  ;t1aee mi3iatfm uau p;u4arenmocio1fp  ai i s)t2xmxrpoodlmeemivta(  rtrurpnt0aptniictlt aDrmnmsnt0trermrcty1optr ieil(0s2uoir iudapenmietas) rra(mp;o0altoiocilslm2eanvo (4trxnif3iadlmDr ues () 2xr(m3no4op  lncslt)srurumont1aeto i3iatla2eln onu) rermo3oadopDrluei t0 2xrimpoo1ll emneta()sDtrumoou1aeenioetldfmDrm(vp;u)alenxr3ta1la rauvo t0s2uoxo3no1aptn ics s)s2tr( o;t0tex ifctlt mDul(vp;t0tlxrmocoytlmt  uei () exoxm iydlpt mivta( aDtm(m ot1apen ieiat a2eaump u0 exrmo iy1omte nei;t) rtr(m3nodop  mnvtls)sDtmumooo1tpxomfciytls elnmpn()teerxo io1fpDe uvslt)t2ur(mpoy4llt  fvtls  Drrum ;o0aetn f3iyd s2um(vont)altoirctodomtr neil()trum(o3oodlp nlfct s)sDtr(mpno1apt moeilslaDeluvo;t0 exrirctydomD  nes ()s2tmio3oy1llt lfvsas) Dur(mpoo1tpeo fciltfm uanvsn(4texoxoctodop eliei;s s2ur(r no1ole  fvtlt a2rrxrp;t0ole  i3iydla em(mo;u4tlenxocoydla raivs s0trxmir no4ome lncilsfs2taur ou0tpxomoctyt s rlu on()alxoxo oa1fa r ueo;s t2tr(mpoy4lmt lictl(  2umumono1alto feiatfaDrln p (0aetoxf iatlaDr u s;t seuo(o ny1altelies t  Dua(m ;o1tptomo3iatfm rauvo t)tltomo3oo1lmt  n ilt s2tmim iydlpenmivs (f 2tmur ;o0olen iciadlmDrlnmo;u0arxnmr iadlmt lu s;s0 etrio3iodomt  ictatf 2taxr ;t4ape mietldfs2ua(vpnt4tlxrio oa1omteaivol(0 ruoio nu4openmfctlt sDrau ont4aleomoeiltlsDranvsnt4tltniocoydfp e u ilt)s2xrxr3no4om e net t) Drru  ;u1opeo o3tltfs elnmo;u4trxoxfcoy1fm eanvo;( s2xo(m oy1openlivs s) Drrxroou1oetoif3tysfm rm( o u0 rtniocoadfaDrlnvo t  etr(mpiy1ale mictls) rumx  no0ole miciasfa ean s u4arxnmf iydop rlnvsl( trxm(opiydlptnmiet s)artrurp;t0oet mfciad sDrm(vonu4 reomocoytfaD  n s s)t2xmim3iy1lltnlfet (  2ur( pno0optnifciyslm um( s u)tlxoxr3io1omte u i;()s2tmxo3iy4optnmfvs t)arrru ooo4tlenio3tyslmDemums u4aetomf3ootopDrlnvo;s0teuoir ny1ap emfviat s2trumpot4oltoiietld aDumnms () rerxr3oa1lmte nei s)t2xoim3nudopee fcsltf Dtaum nt4alt iicias mDeanmpnu0 exoxoctodfpDe n o;t0srxmiopno4ll e ies () rraxmp;u4opx  ocils sDea(mont0trxnxrcoytopD lieo t setoxm3iu4om elies s aDuru  oo0oeeoio3iyslm ranvp u0teeoxo oy1la rauvi;s t2uoir3iudamtn nesa(fsrurx pot4olx  ictlslmDuaums;(0 exomfcoydfa  aieils  exoir nu4lm  mfcslt)s2rau o;t4tpxomoetld s uanmsn(0treomfctytlm raneilt s2xrim nudomenlnetat)srraxm ;t1tetnmietltfa umump ()aetoxr oodom eli s (  rxmir3nu1olt  nesatf rur(rpno1tlt  ictld s2ul( s;(0alxomo3oatoa r n i (0texrim3io1omtelnei (f 2urx pnt4opx ioctyt sDulumpnt0tltnmrciytop  ai olt trtoirpnu1lltemfvt () rumump;o1apeoiociasla2umn s;t4arxrxfcoodfp eln o ( seuoio iu4lmee nesltfs2rm(m ;u4aet moeilsfa emu onu4alermocta1op  livols srxoxo3iudam nmfeia(  2taxm no4oeeo ociltfs2umums;u)trermr iotopDe nei;t0srtmiopny4aptnmnvslt  Dta(rpoo4tlxoiicils a2emnvs;u0 exomf3tydoaD  ueo;()sexmiopnodll  mfvtasfsDuau o;o1oeeo oeiasls2umn o;u) rxrmo3totfmt  n slt texr(m3iodapenlicta(  Dra(m ;t4tlxomi3tytfa2rlnmp u0teenir3todfmDrli i ( tetrio3iy1lpt mnei sf Dua(mp;o1aexnii3iysfmDrlnvpnt4arxrif3io1fa rai il( s2tmxopny4ll e ncs ()s2tmu oot0oet ifeias a2rm(von() rerir3iotlat  nes t)s2xr(o3oy4lpe lneil()aDum( ooo1apxn i3iadlm rmn s;(4alxrmr todfmDr iei;s) rumir3oo4ol elncs s)sDum(m ;u0ape moeiydlaDum( p ()aexrmrctotfmD anvi s0 rtoxm no4ll n nei ()sDrmx o;t4olx moeiytlaDrlnms t)tltoio oytoatrlnvs s) rtmio iydlm e fctls  Dtau  ;t1opxnmfciadls ea( s (4altoxr ia1fp eluvi t)setmimpoo1lpee fvsls a2urxmoou0apx ioeilsfs rluvp;t)tlenmr iatfmDrlieolt0s2urxm3oo1olt mnes ()srumumpnt0teeoifeildla el( p;t4 renirctatfaDraivolt)srtoirpiu4om nmnvslt) Dtauro;o1tlx  ictyslaDum(ms ()tlxnxr3todla  lues (0s2xr(rpiodope lici () 2rrxmpnt0tlx mo3tld m2raumo (4altoxo oa1fp  au o (0 etr(opno4altelicia( sDrm(mooo4apx moctlt m rmums (4 rxomo3ootla elnvils0teuo(o3oy1olt mfvilt  Dtr( pou0aetnmf3tls a2ea(vp;t4 lxoirctadoat  i sls0tetmxm ou1lpt licias arrmu  ;o1opx ii3tydlaDea(vo (0 leoxo3todlm e uesls trtrxo nu1aptnlneilt artr(mp;o4apenmietytlm ulnvp;t)aexnxoctytlmt lu i;()srxmxm3oo1om  mnesat s2tmur ou4teto f3tyt mDrmuvsnt4tltnmo oodlpteli i;(  exmio3no4lmen ivi tfa2ur( o;t1ope mf3iyslmDemu s;(0texrio oytom  luei (0t2xrir3nydlpt  fvtls) rtmu ont1texn fctyt s2raumsnu0artoxrcoydla rau i ()srurxrpiy4om n icsasfsrtm(roou1aptn iciadfs ulnms t0aexoxr ia1oatrlnvs s0 2xmxr oodole lfvi s  Durxr ot4tpx iieiad aDem(vs;t4artniocty1oa r ies;s)trtmxo no4ll  mnvi ( srurumpou0tpx iiciasfa uauvont4 rtnxocoatfa rliei;s  2xrxo ny1ole mfcta() rrr(mo;t0aptnii3tat a umumsn(4tetrxr oo1om rai i t  exoxm iu4llee feia( aDumxm no4oetnmo3iatls ulums;(0 eeoxr3oo1lpteanvsls) rxo(o3iy1lmtelivias aDua(  nt4aptn f3iadls rm(vp u0tetomr oadfpt ai s s t2trim nydal  liei ( a2umx oot4tetnioeiltfm2emnmp ()tltomr iy1oaD aieils0texr(m nu1ol emicta(f Dua(mp;o0oee iictyt mDranmp;() rtrifciydlaDeluvs t) 2xmxr3nudlpe  netlsfa2ra(mpou0tet iociytlsDuauvs;u4tltnxocoydlptr ieo s)seurxr nydll  mnvtls  2rrx pnu4openio3iltlm2ean snu0aexrmociadfp   uvs ()truoxrpio4aleemfcsat)srta( p;t1olx mo3iydlaDum(vs (4aeeoir3oydlaDr uvo s0s2trxmpno4ome lnciat) 2tax p;u4oltnmi3tlsfsDrlump (0 lxoif3to1fm  aues;t)s2xr(r iodamtn ictl(  rrrxr ;u1ape mo3iysfsDem(msnt4trerxoctydlm elieo (  exmir3iudolenmnvtlsfs2tau  ou0aleo feiys a em(vp ()tetnmf3oy1fpt lieo;s0t2tmio3oo4amtnmivs s aDta(r ;t0apt mfciyslsDra(vs t4arerxrctatfptr neo;(0tetrimpno4ll emfvi () 2ur(  no0tetnioctyd mDelnvp ()trtrxr oytoaDe u il(0trurim3ou1opeelivilsfsDrr(m ;t4tpe  fciaslm2el(vo;u4 rtnmo io1fp e uvo;t0trtoiopnydom   ncil()sruaxmpoo1alxoifciat s2elu s;t4tleomrcio1lmD  ueil()srxmir iydole  fctat) Drmxrp;t0oexnif3tydla uln pn(0 exoio iydlpDeaivi;s)s2toiopny4ale livil( a2trx oot0tleomfetydfs2emumpn(4texrio3iytoat  u s;(0 etoim3ny4apt lnvsls)arrru o;t1olenii3iys s rmu s u) etnio iodop rli i;t  rum(o3nu1lpe  fcs s)srumx  ;t1apxn f3tld m2uaump;u4arxoxfctotoa rlu i;s)trumxr nodameelfct (f rrru pnt4apx  ietyslm2eaumpnu4artnxo3oy1fm elues;s texoimpoy1optelivils) 2rm(r no0oee ioeiadfm umnmo;u)teenmo ia1faD  u o s t2toim iu1aptnmivt ()aDtmu onu4altoii3iysfs2rlump u0 eerio3iatfat anvs s0trxmxopiy1ol   icsat)aDrr(rono0aeeomi3iys mDrlumont4arxomocootoa r i i s0 2tm(rpnu4olt livs ( s2rax pno4tltnmietadfaDelums u)trtomf3tadlp elu o;s srxo(m3oudame  nvs s  rraur nu0aeeoiieildlaDrluvo;u)tetrmr to1fp e uei;t0 eto(rpnydllte ivt () Dtaum no0apeniietytls2rlu snt)arenxf todoate ivol(0trtoxm iy4apeelivsa() rtaumooo4tetn i3ilt a2ra(vpnt0 rtrxfctydomtraivi;(0 rtrxrpio1opt  nvta(fsDrrxmpoo1tle ifeiytls2uauvont0teenmr3iadopD auvo;s) 2toio oydlp nlneiatf Drrum nt0apxniocilsla2elums;(4 renirctatoaDelnvo;t trxo(r3iudlmt  iesltfsDrau oou0opeomi3iasfs2um(vpnu) etoiocia1omtr ivi;t s2xoxr iodlme mncsa(  Drrur nt0oet mi3tldls uln o u0tltrxf3io1lp   ues ()t2umio3nodoleemivilt) Dtmxrp;t0tee  feias m2eln o;u) eenioctytfa  anesls)trtrio no4ol elfcilsfsDrm(root1alxo iciltla2emump;u)teermfciadfptrauvi;(0seuoio no4ll  mneilsf 2urx  oo1tpxoiiciysfmDelu pnt0 rxrxrciatlm  lneilt0s2ur(r3no1altemnct t s2rr(mono4tlx mfciys a2ua(vont0tlxoircia1oaDe u o;() rumxo ou4ll e fctlt sDur(rpou4olt iociytfs2eanmont0tetrio to1fm e nvs ( trto(rpoudlp  mnesas a2ur( onu0optnmf3tasla uaumo () rxoxociy1fmtrau i s texmxopio4ap elnvt (fs2ta(rp;u4open feiyt a2rm(mo;t0 rtrxo iodfmteai i;()s2um(o ny1ole lfvtl(fa2rrump;u1aleomi3tytfs emnvo;t0 reomr3io1op   ivs ()setoimpnu4altelneta()arurx ooo0oltomo3ils mDul( pnu0tlermrcoa1opDrauvs s0s2urxm3iudlm n fcta(  2rrx  ou1apxn ociaslmDumums ()aeenxr3iadlp  aueo;s setoio3iydlpeelnvsl() rraxmpou1alx mictasfm elnvon(0alenmrciatoptelueslt0 etoio ny1ap emiesltfsrrax pou0tpe mociatla el(mon()arxoif3totoate ieo;(0 2urio3iydll nlivtas srtruront1oeto iciys m2uanmo;(0 eerxociy1latelu s t  eurio iodoptnmfeias s2umxr ot0tptoifeiyt a rlnmo;t0artrxo oodlaD anvs;s t2urxm3nudoptemicils)aDururpou0tlt  i3tadfaDrl( o (0 ltnio3iotoa ranes;s  rtr(rpiu4ap nmfctls)a2rax  nt4tpt ioeiasfmDranmo ()tetrio3oydfm r ieo (0seto(rpoy1oltelfetlt) rtm(r ;u1olxo ieiltls2uau o t4aetrxoctodfatrau s (0 2xo(opno4ap  lnvsat aDumxr nt1opeomoeiltlsDuau s (4 rtnmr ta1opD  ieil( t2xmim ny1am emneta(  2tmum ;t1aetnmfciatls rln o t4trtoifcty1fpt lieolt) eumxopiydopte ieias) 2umx pnt0tlenifeiaslm el(vp u4aexoifctytfptraies t0teum(o oo1lp n fctas aDta(ront4tetomfeiatlsDel(ms t0texnmo3iy1fm r n olt0s2uoxr ny1ale mfciat) Dur(mpoo4tlxomiciadfmDrlumsnt4tltoxocoytlaD  nvs;s) eurxo nodlpee fvslt) Durum ou0aetoifetlt s2elnvo;t)trtomo iotlm eaueol(0texoxm3io4ol elfcs ( aDtmxm nt4aexnifcias a eluvo u)aeenxf3totfa r uvsl() eurir nu1opeelnci s aDuaxr oo0apen f3tas s2um( p t0 lenxr oytomt anes;(0 euo(m3nodal nlictlt)srrr(m ;o0oltoifciatlm ea(ms;u0 etnmf oadfmte n i ()tetm(o3nodlpe lneilt)aDtruront1olxnmoeiltfs2ea(vs t0 eermf oodfmD anvolt)srtmir nu1alt lictat)a2umu  ;o1openiocias aDuauvo u) lenifciy1laDeln s;t srtm(opiydolenlfes s s2rm(ro;t0tpxnmfciys s2el(mo;(0treoir3totop  lieols0 etoirpnodop emnct s srtm(rono1teeo ieiasfmDrln s;u0trtoxr oytfaD ln s s  rum(r3ou4lmtn fcs t  2rrx  ;u1ale mfeiysfs2uauvs t4 rxrxrcoa1opDe ies;(0 rxrxm io4am  mncsasf 2ur(m ;t1ope iietysfs2rm(vp;t4tlerxfcty1opt  i ilt  2urxm3oy4ameemnvsa( s2taxro;u4openmoetlt s rau p;t4tltrmr oydfm r iei;t)sruoxrpoydaptn ivtasf Dtr(mpnt4ale mf3tydlm2rl(vs;u0artrio3oy1lmt li il( t2uoirpiudolt lfcias)s2uau o;u1tlxn oeiadfs2rm(vpnt0texoxf ootfateanvols trtm(m oo1lm  livi t) Drmxm no0optomicild a2ra(mp;t0aexoifctotlaD  n o;t0s2uoxr oo4om nlicslt  Dumu o;u1aptoii3tydfs rl( pn(0 rtomf ootlmteanvs (0 2tmiopnudlpe  ncia( sDtmxront0alenmi3iatfm rlumo t0 ltnifciatoa  lnvi t)srumxopoodaltemnei t a2uax  no4opt  oeiasla rmn s (4tetoxr3oydoa rluvs (0teto(o3iodopt lieta(fs2ra(mpnt4texo i3iltlsDuln on(4trenir oytfateauvils  rtoirpiodlp n ics (fa2urumpnt1ole mfeiyt m eanms;u4teeoxf oodfateliei;s0 exoir3ou4op   fctlt)aDtm(rp;t1aeeo fcildfmDrl( o;t4arxnircoadfa eluvs;()s2trxr3iodom  mivta( sDum(m nu4aleniieiasls2eluvo;u)trxnmfciadfpDrauvi;t0tetr(r nu4opee ies t)aDta( p;t4tleoii3tatls2em( pnu0arxomr3oytom eliei;(0srtoxr iudam elnvsls)s2tr(  nu1ole mfeiyd mDra(mp;(4 lxnmo ta1fmt au o ()trurxo3iodalt mfvi sfartau o;o0oee mo3iytfa umn o;u0trxomf3oydom  li s t0 2to(m iy4lp e ncilt aDuax pnt1texo octatfs2umuvsnu4altnmfcia1fmDeluvolt)seur(o nu4om n fvi s) 2rm( o;o1oex ii3tyt m emn p u4 ltrxfcto1lmDeanvi;s s2umxr no4lle micsls)artau pou4aexomfciltfa ulnvpnu4altoir3ootopt  u s t0 eto(m oo1oltnlietls)s2raurp;u0tpeoioetat s ranmo t4tlxoxo3iodfmDeaiesls texo(r nodop emfcs s)aDrrum oo1aptomociydfaDelums;t)artnir iy1lp  lnvo;s  2xmio oo1lltnmnvtls  Dtax onu0aptomfetytfs eluvo;() reoxo iytfmDr u s;s) 2xrir3nodlmen feil(  Dtrxm oo0aet ifcilsls umumo;t0altomo3iatlmD lnvo;s0 etrio3ou1op   fvias)a2tr(r nt1tlx iicilsfaDel(mpnu0arenmr todlp rai i;s setoxm3iy1al  mfesat srrau pnt1apxoio3iad a2umnvs u0aetnmfcoytlp  ai s s setmxopou1lmtnmfvs ()sDtaum ou1oltoif3iasfaDrlu s u4teenxo tytlaDeau o;t0teumim nydoptemfesl(fsruaxmpou0tlt moetatfs ul( snu0tltrxo3iy1lpDe neo () 2xr(mpoy4lmenmnvsat) rraxmoou4tptn fcilt sDul(vo t4altoio3oo1oatraneilt0s2xmxrpiodoptnmfcil(fartrxm ;o0tle iicilsla2ua(vp;t0 lenmrcoadoaDrlueo;s srxrimpnu1lmte fvil(faDuaxrp;u0alenmfctldfaDranvs;u4alenxrctatoate n ols)srxoxm oy4lp e ictls)s2ra( pnu1tee iictldlmDrlnmsnt0 ltniocoo1fmte ivils0 exoxopiydoptemfeia(fsDtax pot1olx  octltls ul( pnu) lxomfciytom   uvs;()s2xrxo3iydal  lictat)a2raxrp;u0apto fcildlm2ra(mo;(0alerxf tytomDeluvs s)t2umimpoudlle mnvt (f rurx pou4oetomi3iytfs eanvp;()trenmr iadop  aivo t)s2urir3io4al  lfeil( srtr( pnu0oeeomfeiys sDelnmpnt0trxnmr iotfm eai s;s0 2umir3oo1lp nlieiat) Drr(r ot0apto fctatlmDeln o;(0arxomrcty1fpDeluvs;()srxmirpnodapen iei (  Dum(mpoo0olto oeiysls2ea( o t4aleomrcto1opDe n ilt0setm(m iodlptemfcs ( s2rrx pou4tex  f3iatla rlu snt4 eenif iadlmDelnei t) 2uo(m3oydllenmivsl(f 2ra(mp;u1ole  iciytla uluvs (4tlxriocootlmt aivol( s2umirpoo4aptelici s)a2ua(m no0apx  ietasfa ra(mo t0teeomr to1oatelnvs t)seum(m oudale  fetlsfsrrm(r no1tpe  i3ilsla eln s t)altoxr3iytfaDeauei;t0t2trim iu4omtemfvsasfa2tm(mpou0oee mocias mDulnvs;()aetrmr3oo1op r ivslt)trum(opnydolt mfcsls  Draum oo4opt  f3tysfs em(vpnt)tltoxocto1faDranes;t)teumim iy4omeemneils s2umurooo0tpx  ociadlaDrm(von() rxnifcta1lptr ivi;t sruoimpnudaltn nvslsf rraxm ;u4alto ietld a rmuvo;u0 etrmfciytomDeaueo s0 2uoir oo1ll  lnetas  Drmx  no0olx mo3iadlmDumn o;()tetrxr ta1fptrlnes t)trum(rpnu4openlnet t a2rm(mp;u0tlxnioetydfs2rln sn(0aetrmf iadlateln s;s)trtm(m3ny1lp  mfesa() rtmxmoou0tlxnmiciltlm emnmont)teenxrctatopteaueslt)s2urxo oo1lp e ieslt) 2rr( pnu4apxn o3iydla elnvs u0aetnxf3totopDe ueol()srumxo3oy1aptn ivsas)aDra(m nu0olxo iciysfm el(vp;t) reoxo3oatfaD  n i;s)seum(o3ny4oltemivsltfs2uaxr no1opeo f3iysfsDraumo;u0trtrxo3ia1omD  n s;t0s2tm(m3ou1olt mfet sfa2tr(root0tlt  f3ils a eln ont4altomr3io1faDe i i s0s2uoim3ny4optnmivtl() 2tmxr ;o1tle  icildfsDelnvo ()tlerxocto1fmtraneilt t2urir3iu1ole  ietl(  rrmxm ou1ope iiciys sDem(ms (0texnxr3iatop rliei;t t2xrxrpnu1apt mfviasfs2taxro;t0aexniicilsls2ran o u0artnmf3oydop rluvo;t truoxr3ny1al elicsl( srrr(rono4opxnioeiys sDuan s t0aexomrcoy1fat  n o;()s2to(rpoudlm   iesltf Dua( pot4apeo ieiatlmDel(vp u4 exomocoydlm rauvs (0 2xmio oy1ll  mfciasf Drmx pnt4tptomfctyt s2em(msnu0tlxomocio1omDraues t  2um(m nu4llee nct t) Dtaumpou4tetniieiaslmDumn snu4 rtomocto1faDr neolt)t2uo(opou1ope micilt)a2rm(rp;u4tpx  oetadlaDul(vp t)trxnxrctotomDran o;t)seurir3nu4lm nmivs sfartm(rpoo1apx iieiysls2ul(vs u0 rerifctadlmDrln o;t0 etoxm3oodoleelnvtl(farta(monu0oex ioeild mDrau snu0trxnmf3oodfmte uei;s0setrir3iydaltn fciat) rrau  ou4apxo feiatlm2uau pnu0artoir3oy1op raies;s0sexoxm3oodlm n nvtat s2rrumpoo0tee ioeiltls uln s t0 reomf oodfpDr nvo;s)truoxm3iodapee ncils)srtru  ;o1teeomi3tydfaDrau s;u4 rtomo oy1fatelues t0t2xrxm3nodapenlivi (farrrurono1altnii3ild mDeluvs;u0tlxrifctodoat ai o () rtoxrpoydalenlnctatf rraxronu4apxomoeiadlsDel( p t)texnmo3todoaD  uei;t)trtmirpnodomt mnvsat) 2tr( o;o0oee mf3iydfs um(ms u4 rxoxo todlptranes () exrim io4ll emivi t artru oou1alxniieiadlm rauvo (0aetomf3iytfptrauvo ()t2ur(mpio1omtn nviat)aruau onu4tlx  oeiadlm um( onu0aetrmr ta1lpteln slt trur(r oydlleelfes s a2tru pot0apt  ocild a2umnvo (0tetomfciy1laDrau ils0t2uoir3nu4am emfcia(fsruaum ;o1tpxo o3iltfsDel( snt)aexnmo3todlateaivols) etrim3oodalenmiet s  2tmxrooo4oexo fctyslm2rm(vs;(0treomrcoytfmDeln i;(0 2ur(opoudamenmieiltfsDrrum oo0oeeoiietadfa2el(mp;()artnxocoytlpD aiesls)s2xmio no4lptn feta()srrmxront1tlt mfeiyslaDelnvon(0aexoxo3oy1lmt livi;s0tetmiopiu4lme  ncs (fartru pnu0tltniiciltfmDua( p t4 ltnmr oo1lpDe u s t trurimpiu4am n ivsatfsrurump;o1apeniieiatlm2uluvo;() eeoifcoy1lmDrlieol(  2to(o ou4oleelfviatfs2ta(rp;t0ape moctatls ulumpnt0 lxnif oo1op eln s;s0trxo(m oo4alt  ivtatfsDumxronu0altnif3ils aDrlnvo u)arenxf3to1oate nvs;( t2xoxmpiydlmenlneiatf 2tr(m ;o4oexnio3ildls2rluvpn(4 rxnxo iytlaDeauei s)t2xm(m iy1lltnlietatfa2tmur nt4aeeo oeildfs2ra(vs;t)tlxrxr oa1fa rlnvs;( s2trir3ou4lp  livilt srurxm ;u4teeomictadla2emnvp u)aleomf3to1fpDr i i;t0s2toxopoy1lltelnesl(fa2ra(rono4teto feiad sDulums;() reomociadfmDraieols)srto(rpoo4oltelietasf Dumurpno0olxoioeiasfa rm( o (0altomrciy1fmDeln sls)t2to(o3oy4oltelfvta(f 2rruro;t4oet io3iys a ranmp;(0artomf ty1faD an il(  rxm(o3oydopt  nvta() rtmxm oo0optomo3iysfaDrlu o u)trxrmf3ta1fa raies;s  exm(opnudol  mfei t  rrm(m ou4aexo o3iydfs2elu o;t4 lxoxfcoadfmte ieo s)srurio3oy1omtnmfesl(fa2tr(mont0olxo ociasfmDeauvs;u4tltoxocta1lmtr ieo s0s2urxm3oodal elnctatf 2urur ou1olenmoeiydlmDel( o;(0trxriocoo1fa r i o t0 rumxr3ny1lmen ieilsf rta(m ;u0optn i3ils s2ul(vont0 leomr iotlatr ivo ()sexrimpnu4aptelnvsl()sDtrur ;t1olx mo3iyd s eaums t4altrxr ia1op  li il(  rtoxo iodal elnvtlsf rraumono1ole iieilslmDrlnmp t0 exoifcto1oaDe nes t) rtrxr nodlm elncta(  2rrumonu4tpxn f3ild a ul(mpn()arerxo tytop e u o;( s2tm(o oy4al emfvia(  2trum ou1tpeomo3iytlaDea(mont4aexniociytlmteaivi;t  exmxmpnu1op emfes t a2um(ro;t4tpt iictadfmDua(vp;(0arxnxrciadlm rai s;s)sexm(o nu4amt  ivsls)a2umxro;o1oex  fciltfa el( o t0 rxrir3io1laDe u o (0 etmir io4al n nvs s)srrru  oo4tlenii3ilsla uluvsnu4alxomocoo1om e u s s0 2xr(r3ou1ope lfcias arta(mono0alt mi3tatla2ulnvsn(4arenmo3ta1oa  lueols0teumir io4apt mfvt (  Dur(mo;u4tleoii3ias m2um(mpn(0trtoxf tytopDraivi;s  rtrxm no4aptemneia() rurumonu0opt ioeiadlmDra(vo t) ltrmr oatfp eaieslt  ruoim iudll nmicslt) Dua( o;u0aetoiictytlaDuau o;() rtnmo io1fmtrln o;t setr(opnu1am n fct (f rumuroou0olxo fcildfa rlump;t)tlermf ootfaDr n i;t  rtmxrpno1ope mnetls)s2um(mo;u1olxo o3iasfs2ul(vsn()trtrmf3tytfmD  neo t)sexrio3no1alt mivsls) Drr(rp;o0alxomo3iatfa2umuvont4teeoxr todoaDe ivs;t  2ur(o3oy4lmt miesa() 2tr(r ;u1aet ii3iyt s ua(mo () exrir3iytlmteanei;s sexo(opiu1am   nvs tfs2tr(r ot4tpxn o3ildlmDulu o u4trxomfcoatom e nvol(0seuoxr3ou4al n fctl()aDtm( ooo1opx  o3ils m rlumpn(0 ltrir oatomDrlues ( sexoir oy4ll  mictls)srumx oou1aptnmoeilsfa2umumon()arxoxr todop ranvilt) 2umxmpou1opee nei (f rrm( poo4apenmfciatla em( p;t0tltoif3totoptean s;s t2xo(o3iudllen netl()a2ururpou4olxnioeiat aDra(mp;u0alenxf3oadfm e nvi t) exoxmpio1opt  ivi s s2ururo;o1opxn f3iys a2umnvs (0tltnmr3to1opt  iei s s2urir3oydal  mnvt (fs2tax  ot1tlxomf3ils mDel(ms t4tltnmocoy1lm eanvi ( srumimpiudllt mfctlt  2um(ront1ole  fctadls ua( o u4altoxr3oadfmt au ilt tetm(r3iu4lltn ivslsfa2rmxm ;o1alenmieilsfaDeau snt0tlxomo oo1opt lieols seuoio3ou4alt lnvi t)a2um(rooo0ope ifciyt m2ea(mo t0tltrio3tydla rlnvo;t)seuo(o3nydom e nesas) rtrx p;t0oetomfetat s ua(mon(0altnmoctydlpteaivi t0srxo(rpiy4apen icsl(fsrtrx oou4aex io3iatfm2eau ont0alxoxr iodlm rlneils teurxm3oo1lm nmfvtat  2urxrp;u0aleoioeiadfm rmumsnt4tltomf tytlp eli s s0s2tm(o iu4ope  fesa(fs2tax  oo4aeenioeiltfaDuan s (4trermf totlmD au o s setm(mpnydoleelicia(fsDtr(mpno0altnif3tysfa2elnmpn(4 rtrio3oa1lmt aieilt srxrimpou1lm  livtlsfaDumxrpno4aetnmoctas m eln s;()trtrxrcoo1fa rlnes s0s2uoxo iu4op nmncsat) 2tr(ronu1olx if3ils aDranvp ()aeeoxf3todfa ean o;t s2uoxm iu4ll nmfvi t)arur( o;t0aexnmociydlmDemuvo ()treoio3oodlm rluvs;s0srxmxr3nudlmte ncils  Dumu  nu0oet  i3iydfsDeau o u)aetrmo io1lmtrlivi t)sexo(r3iy4amt  fes (  rrmum ;o1tpx mf3ild sDua(vpnu0 rerir oatopDelnvs s s2trio io4aptn fvil( arrrumooo0open o3iat mDuanms;t4aeeomfcoatfaDrlnvo t0s2uo(m oo1amenlietl(  ruaxmpoo0teenif3iad aDrlu snu)trtoif3tydfmDrlnes;t)tetrxm3iu4op e fcsl(fsDrruroou1opt iieiadlmDelnms t0altrxf oadlate u o s0 rxoxo3oo1op emfci tfsrtmxroou1apxoif3iyt a emuvs (4 rermr tatoat  u i t0s2xrxrpio4op n fct t)a2tmx  nt1aeenmieiydls emumo (4aetoif iodlate ieil(0srtoir3oy1aleelfesasfartaxmonu4tlenmo3iasla rlnvsn(4 eeoio iadop rauvo s0s2triopno1lle mfcil(fsrrm(mpot0tetoiieiltfm2rln pnu) eermf totom  lu ilt teumio oy1llt mnct ()s2tm(r ot0apx if3iat a2rlnvs;u0altnifciytoa elnes s) exm(opio1ol  mnvi t  Durx oot0texnmf3iytfm uln p;(0trxnio iydla rln o;s s2urimpou1lltelfvslt)s2tr(  ;u0tpt  feiysfs eluvp;u4 rxnxo3ia1opD aieo;s s2uoxmpiu1lpt mnvs s  Drauro;t4tetniieildls2ua(ms;()arenmf3ootla  lu s s t2xmxr3oo4lm nlivtlsf rtmxmoot4tptomi3ilt mDranvp t) exnxf3iytopDeanvi;s t2toim3io4ame mfct (f 2urxrpot0olt moetytfs umuvo;u)tltoxo oy1la r iei;s0srto(m3iu4oltnmiesa()srra( pot0tptoifeiysla2ua( s t0 exnifcoo1fatelneo ( teum(opnu1lmt  icta(fartmuroou0apeo ieiasfm2ua( pnt) rtrxf oytopt lu i;t  rtrim3nu1ap elfviasfaDrmu o;o1olt ifctat aDea(mont) rxrmr oa1fmteai slt)sexrim nudlmtn ivtls  rrrurpnu1tee mo3iltfm ra(ms;u)trtrir3tytop  lnvi;t0 rtoio3oydomeemfvtasfarum(m ;u4optoif3iat m rlu sn(4 rtoircootfm  ai s;t srtoirpiu1ol  mnci sfaDraum ;t1ole mieild a emn pnt4 lxoxfcoo1la  aieolt0 rtmxo nudomenmfvta() Dtmx pnt1olxnmiciydla umnvo ()tetnmocoadla raivo t)t2xrxopoydopenmfeiltf Dua(  ;u1oleo fciltlm2em(vsnt4 reoif tadopte nvsls0tetmxo3ou4olenmieia(f 2urxm no1ole mo3tas aDelump (0tleomr tatlmtelivo;t) rxmxo iy1oltn fvilt)sDrrxr ot0tltomoeiaslm2ean on(0arxnir iadlaDelueo t)t2xrxrpio4ol e fviatf 2taumonu0open octyt aDumumpnt0trxnioctotom   ieilt srtmxo ou1apt mfcil(faDurum ;u1altn f3iaslm rmu p;() lxnxocia1omt au i;t)srxm(o iy1ol nmfetlsf Drmumpnt1aptn ociasls2el( s;(4aexnirciatopDr i s s0trtm(m3no1om elnvtatfsDua(  ;u0opeomociatlmDua( p;t0trenirctadfa elu s;s)t2to(m3iy4lm elnvsa( srtmx oot0aeeniiciydlmDuanms;u) eerir to1lpt ln i;t)trxmirpio4lmt  fvt (fa2uau  ;t0olenmicils aDeau snu0alxoxo iadfa   n il() 2xm(mpoy1lp nmict t sDumxmoou4oetnmo3ild a2rlnvp (0 ltriocoo1lmt  u s;t t2xrxrpnu4lmee icta( artruront0texn fetldlsDul(vs () etoifcty1fat  nvil( sruoxm oydomenlivs (f rrm(m ;u0oee iietlt mDuauvsn(0texomo3oo1optelu i t texo(o3ny1lpt livslsfsDrruronu4optomf3tytls ua( snu0aetoxf iytfptelnes ( s2tmir3oo1om e iet t) 2ta(r ou4oleo i3iysfs2ul(vp ()aleoir3oo1fp  livs;t teumimpiu1lltelicil(  2trxmpno1tet  o3tyt a2em( on()arenmf3iytla raieil(0s2tmxrpio4lmenmnvil(  2rr(  no1oex iociat a2el( snt) ltoxf3iotfm raues;t) 2tm(o oo4lptnlnesls)arra(ro;u4ape  feias a rau on(0tlenxfctotfptelieslt0 rtmim3nydoleemnvia() rrmxr ;t0aptoiociydfs2el(vpnt0treomr iydla eau sls  exmio no1apt mfvtlsf Draxr ;o1olto ociad s umu o () ltrxr tatlm r i i;s srxrxo3oy4lpe mici t) 2taum ou4opt  icilslm2ulumo (0 lxoxr todla ean i t0 rxr(r3iy4om e nvt sf rtr( ono1tleoii3iadls2ua(ms;u0 ltrifcoo1fpD luei s seumim3iy1lp   ncia( s2tm(mpnt4aee  fctlslsDelu pn(4 ltrxfcoatoa r nvi t trur(mpiudom emfcilsfsruau  nu4oeeomo3iys sDea(vs (0altrirciy1oaD  nvilt trum(m3ny4lptemfcs tf ruaum no4oexnifctysfmDulumont0 eeniocoodfpDrai s;()srtr(rpio4oltnmivias aDuaum no0tptnioeiltlmDrmn ont0tltoircoa1fpt  uesls s2ur(rpio4olenlnvi ( aDtaxrooo1olenioeiydlmDrmnvs;(0alxomo3tatla eaieo;( texr(m iu4ope mictlsf 2tr(r ou0tlt ioetls m2ulu sn(4 lerxr3io1lpDrli o;t trxmiopoudlmee fci t aDuaxmpnu4alx iieiydla2eanvpnu4 lenxr iodoa eli s;t  eurxr oo1ale  fvsatfsDrmxrpnt4tpxo octyd aDelumon() lxomrctydopte ies;t0texrxm3no4ll emnvtlsfaDtaxmpnu1aptoiociyd m2elnvpnu) reoirciatfatr iei;t  2tmxm3ny1apen fci tf Dtaxmp;u0oexoifciytlsDumump;t4 eenxocoytfpteln ilt)sruoirpio4lme lnvs t)sruaumpou1aee ifciys s2ulnmsnu4aexnif3oadom eaiei t0s2trio oudap   netl(fa2tau onu0texnioeiadfmDeln s u4aeenmociadfa r ieslt t2toio3ou4ap  mivta()s2urur nu1tpeo ocild sDeauvo;(0aeenxr3to1op e i ilt t2urxo3ou1lm elfciat)srur(r ;o1alt  oetltfs uauvp;(4 etnxr3ia1lpDeaivs;s0s2xoim nu4aptnlivtat)sDtm(m ;t4opto ietytla ulnmonu0 lxniocootom  aneils)setrxo3no1lm nmicsa(  Duru pot4oeen feiys s2eanvs t0 lenxfctodom rai s s)t2tm(m3io4ll nmnct tfsDur(monu1oex  o3ild m rmu ont) lenif3iytlm   u s;s) etm(r oy4oleelicils)aDtrumonu1optn oeias mDuaumonu4arxrxo iytoa eliei s) exo(mpiu4apt  ncslt sruaxmpno1aleo fcils m uau ont0arxnioctotoa   uvs s)setrim3no4lm  mnctatfa2uaur ;t1olto oeiltlaDum( o;t4teeomociytfp rliei;t0s2xr(mpiy1am elncias)aDurxmpnu4tetniieildfsDul(von(0altrmrctodopt luvo;t texrxm nodam elnci t)s2uaum no0ope mictlslaDemu s t) lxnmo3to1fateli ol( sruo(opoudolt mncs tfaDra( p;u4aeeoifciydla rlums;t4aetoir3tadlmte uvo (0tetrxr nu1om  livils  Dtax ont0oleoioctat a rmnvp t4aexnxr3totfptean i s) euoxo3io4lmtelivtls)artmxm ;o4altomocilslsDrau o;u0aeermf3totomDe i ils)sexm(rpiodlm  lfesltf Dtaxmo;o0opeoii3iat sDuau s (4 lxrmf oodomDe nvi;(0 etmimpnydlmt mivias srtmu ont1alx  fciadlmDum(msnt0alxnircoo1fpte u o t t2uoxr3oo4omen ict ( a2ur(moou0oetoioeiytla2ea(mp;t)aetnmfcto1op e ivi;t0sruoxr3oo4llenlnvsltf Dtmu  ;t4apx if3tls mDea(mpnu4texnifctodlpDraneo;() rurxr3nudamee feil(fsDuauro;o1tle if3tatfa rluvo;u0 etrmf io1fatraivsl(0 2xm(r nu4opt lnvil(fs2umurp;o1apxn o3iysfs2raumsn()tlxoxf3todlp eluvsls) 2xmimpio1ol n neiat arua(r oo4openif3tad sDran p (4artrxf3to1lpDe uesls0texmio3iy4ame  fctatf Duru  ;o4tlt  octadla em(vsnu) lxnmr3oo1fa elneo;(0 2xoxo3nodlpte nvi t) 2trx o;t1aexoiiciysfa2eluvpnu0 rxnxocoatop rluvo;(0 2um(opiy4lptn ncilt  Dtmu  nt0opt  o3ild mDeanvpnt)aeeoir oodlaD aivi;(0teum(o oodaltelfci s)srtru  oo4ole ioetadfm2ranmsn(4 exomf3ia1fm   nvilt  exmim iy1lmtn icsl(fs2um(m ;u4alxoiociyslm2emump (4altoiociy1laDe n s t teurxopno1ol n fei s artmumonu4alen oeiad s2ea(mo t4 rxomrcia1fmt  i i;s)seumxo io1ap  mnciasfaDrrxr ou4texnif3tadfa2rlnvo ()tltnirctadfm eaiesls srxm(m3ny4omtelnesa(fsDrru ont0tlxnmf3ils m umu snt4 rtrmr3oo1fmDeai s t  euoirpoodomtn nesat  2ra(mo;t4aeeo i3tatlmDum(mpnu4 exrmfcoa1lptelues;s) eum(o no1lmeelfei t a2umuronu1opt iiciysfm rm(mpnu)tlxnxr3ootoa  luvol(0tetr(r iy4ol emiciat aDuaumpoo4texnifetat sDum(msnu)altoxf iytlmt  nes;s) etm(o3iy1lpee nct t arrmu ooo4ape miciys m rl(vs (4trtnircootlp rluvilt  rxmio3nudlmenmnvia()arrau p;o4opeomoeiyt a ra( o u)aleoxociodlatelu o;t)srtriopoydlp   icilsfarumxmpnu4alt ii3tydlaDem( o;t0arerirctadopDeanvi (  rxmxm nodlmtnlnetl()srur(m ;o4oleniociatfs2uluvp;t0trxoxr iytomtraiei;t sexo(r iu4lm  mnvsat srtmu  oo4aetn ociyt sDrmu p t0 rerxrciydoatraieil()srxoiopoydom  livtat aDtau pnt0opt  ietadls2umumo u0artnxocta1fm  ln i t) ruo(mpnydllt lfvias sDumumont1tex if3tld m rl(mo u0 lxoxf oydfmDelivo;t)seuoxm3nu4apen ict s)a2rru o;t1tpeoii3iydfa2umnms;u0aetrmr3oodop eai il()trxrxo3oudopt liciltf 2tauro;t1opxnioetatlm2rmu p;u0teerio3iy1laDrau sl( sexoiopiodom nlnvias)a2ururo;u0tpe ifctydls rmumpn() rtoxf3iotoatelnvs t0srxrim3io1lmtnlnesl()srurxm ;o4alxomo3iyd s2eln pnu) lenif3oadoa e neol(0srtm(mpiodlm   fcsas) rtau pou1olx  f3tas a2rau s;t) eerxocoydfptrln i t0 ruo(m nudale  ncs t a2rr(mpou4tpxnif3tysfsDumnms;()trxoxrciodfpDeln i t t2umim3nu4om emfviat)a2rax ont4aexomi3tldlaDeanvs t0arenif3oy1faDr iei (0s2umxo nudam  micsat  2rrxronu4tltomociatlmDum( o;t0 eermocty1lp   n o;() etoxopoy4lmtn fvsa(fsrumx  no1olt mietadls2uau pnt0 rxoxoctytomD aies;(  etrxm nydopeelict s)aruax  ;t0opx  octat mDeau s u) lxoxf ta1lat  uvo;(  rtr(r ou1omeemietat) rurx p;t4tlt mfetysls2umu pnt4tlxomf oadlmDeaies ( setrimpoy4am nmieia(fs2uax pnu1oee  f3tlsfsDumnmsnt) exnmf3tytom e uesls  2uoir oo1lm  lfcsa(f Dra( ono1tetn ocils s rluvp;t) rtoxfcoo1lat aies;t trto(r nodll nmnetl() Drru  nt1tpxomo3ilsfm ran s;t0tetomo oytfmD ln ils setmirpiu4lmeemfvs (fa2tmu  ;u4tpe mociydfsDea( p u4 rtriocto1fmtr iei;s  2trxopiudap emnesat) Dtrxm nu1apenioetld m2umnvo;u0alxrmr iatfmD liesls  rum(o3iu1op   ivslsfsrtm(mpnu0oetnioeiasfa emuvs;t4tetrxo iadfp r neols sexoxrpiudll e fcias a2uax pou0oee  ietltlmDumuvs (0tltnio oytoatr uvi s0setoirpiudll  lfcslsfartrxm ot4tee mfctadls2emu o t4 lermr iotla  au o;t)srxoxm3io1om elicsat) 2ua(r ;u1tee io3iltfs elu s;t0 eeoxoctadomtelueolt0texmxo3iu4lpte iesasf rumumo;u1tlxomieiys s2emu s;(4arerxrcoo1op eln i;t0seuoim oo4ol  mnvs t)sDtrxr ;t4tptnmf3tlslaDrm(vo;(0tlxnmf3iytfp rliesl()trxm(r3iu1amtemncs (fsDrmurono0texomfctadlaDeanms t4altriociy1oa   ues s s2xoxr nu1oltn ncslt)sDtaur no4olt iictadfs2um( s;(4 rxnxfctatlatr ivo ( teuo(r3oy1alenmnesa( a2rmxm nu4apt if3tlslm2el(vpnt0tetomrctodfmteaivi;s) rxm(r oo1lp elieta() Dtrx  ;u1opxomieiyslm2rm( s;t) eerir todfpDe ueo;()setrxo iu1ape lici t)sDumum nu4tleoif3iatla ua(mo;() etoxr tadlmt  iesl() exr(opiu4opee ies (fs2rax poo4ole  oeiytfm2eanmsn(4aexnio to1opDeanvs;( s2xmio3ou1lpt lnvtas  rumur ;t0texnmf3tyt s2ran s;u4trtoio3tadop e i ols s2xr(rpnudape mnvtl()artmump;u1apeoifcias sDulnmo;(4 ltnxo3iodfateluvi ()setrxo iu1amtemneils) rurxrpnt1apx ifctltfs ean o;u0tlxomrciodop  aies;() etmxopio4omtnlncsat) 2rax pou0aetnifcild m em(mo;(0aleoxr oadopt  nvi s)trto(o3io4omte fvtls  2uauro;t0tltoio3iadlsDranmp t)aleomo tatomD  uvslt t2xmxrpiudlpt mnvtl() Dum(mp;o1oetomo3tyd a raumont) lxnxf oatlmD  u o t)s2xmxmpoo4alenmfvils artrumoou1tltnio3iyd a2rlu ont0 eerio3oy1fm  anes;(0srum(r3oy1lleemncs t srra(r no4altoii3tyt m2uaump;(4 lenxf3oytfaDelivi t)teuoir3iydol   nvsas sDuru poo0altomocils m2uauvont)trtnio oodoptrauvs;() eto(r oydaptn fvs t)sDraxmpoo0tpx mf3iytlm2eluvpnt) etomo3tydom  aivsl(0trtr(opiu4omt lfci ()srtax p;u1oeto ociatfm2rauvpnu0 eeoxrciy1fp rluvi s0texoir iodape mnvtl( arur(roou4tpt mietas sDuauvp;u0 reoif3oatfmDr ies;s0 eum(m iudap   iciatfaDurur nu1opxnmociatfm2rmn s;u4 rtrio3oatom   n s;(0s2urxr3iy4lmt lies t)sDum(m ou0oee mf3iys a rm(ms t4aeenxf3oo1lp r i o;(0srtm(m3iy1lm  liviatfartr(  ;t4teto ieiyd m2umnvp;t0trtomo iotfa  li sl(  rurxr3nudllt  nctlt aDrau pot0opxoii3iadla2rl( p;t4arenxo iadlm eai s t  etoxopiudame liesat)s2ra(m nu0altnmoeilsfsDrl(msnu)treomfcia1lmtelnei;s) rumxrpny4op n icsa()aDta( pou1openii3iltlm2rm(vs;() rtnif3tytlaDeaivil(0sexoim oy1lpt lfvt s)sDrm(r ot0opx iietyd a rlnms;u)altnxf iydomD anvol()t2uoxo io4ap elieslsfarrr(rpno4tex iocildla2um(mo () rtomoctodlp  lnesl(0 2umxm nydal  mncsl(fa2ur(r nt0oeeomoeiytls uluvpnu0tltoxr totfmDe i ol() rxo(r ou1amtelncias) rtm(rpou0tetn ieias aDelu pn() ltnmo oodlmDr uvi;t0texrxopnodop   neia(  rtaum ou4olx ioeiat a2umu s t)tlenxr3tydlm raies t0trxr(opoodomtemnvsls)a2ta(rp;t0olenioeiasfa2ea(vp t0alxoio3ootoaD livo;()teum(o nodlle  icslt) Drru  nu4teen icias s2el( snt4alenio iytfa   ivo;t)t2tmio nu4omtnlnctl(fsDumum ou0oee io3ildlsDel(mpn(4 renxf3oytfp e ivi;t) rxoxr io1ll elncta()arumump;u0aptomi3ildla el(mo u)altoxr3ia1op raivs;s t2xrxopiu1am nmfet sfaDuaxrp;o4aet  fetasla ranvs;t0trxomf3iydoa e n sls0texoir3io4lp emncsa(fs2rmurp;t1ape ii3iltlmDrmnvsn() ltrmo3tatlptr ieo s  2uo(m oy4ap e nesls)aruru p;t4tle  octys m em(msnt4aleomo3iodlmDeluvs s  rurio iodaptn icilsf rurxroou0tpxnmfctaslm2raump ()aexrxo io1om  ln i s)trxr(rpny1ape livilt  Dum(r ;o4tlxoif3iyt m eluvp u0tetrif3ia1fate nvs (0 ruoir oo4lmt miei t)arur(mont1opeo feiadlsDulnmont) reoxoctatomDraiesl() rurio3nodal elictl(faDuru p;u1tleoii3iyslaDumnvo (0 eeomrciodlmtran i;s0 exrim oy4lmtn nes tfa2tr(  ;u1tex  oeiasfm2em(monu4texnmociytoatr ueils0trxmir3iudomt  nci ( a2ta(rpou4aptoif3tydla rl( s;u0aetomr iy1fm raieils t2um(opno4lm nmfvsls)aDrmxrpnu1teen ieildlmDrlumo;t0tlxrxr3todfmt  ieol()s2xm(r ou4oltnmieils)aDtaurp;u0alt  fctyslaDel(vs;(4 rtoiocty1lmD anvilt t2toxo3iy4opeelieta()s2rru ont1apxoifetls s2ulu on()artoio3ty1omtrluvsls0teuo(m oo1lpen iciat)srrax ono1alxnio3ils a2uluvp (0tleomf iy1opDeanvi s0teumxm3oudal e ictltfs2rrxmo;o1aexomiciat sDul(vp;u) etoir tytfaD livs ()srurxm3iy4aptnmnctls) Drauroou0olxnmiciadfsDulnmo;u0aexrir3oa1fateaivol(0 eum(opiudoptnlfvtls) 2rau o;o1aeeomociys aDel(vsn(4 rtrio oydfm r ieo (0 rtrio nodam  micta(fsDtr(monu0oet mo3iydla ranvs;t4texoxo ty1lpt  i o s0srxm(r3oodal  miesas a2uau  ;o0aetn octatlsDel(mp t4 etoxf ta1lp   u ils s2xmio3no1apeemneias s2ururp;t1oexn ictas a2el(msn() ltnmfctatlm r ueol( t2xrxopno4ale mictl() rumur ;t4tleo o3tldlaDum( sn(0 eerxociytfp r ivs t0 exoim io4lm nmfvsas)srrrurpno4tpeoif3tlslaDrm(vpnu0tlerxf3todopte i slt trurir3iydapee nesl( srrm(  oo4tet  octldfs elnmpnt)artomr3oo1opDraiei;t  exoirpiu1ol elfvsa()aDtmumoot4altomiciad m2umnmp u0tltoio oydfaDelivi;t) etoio oy4alt liei t) 2rr(rpnu1tpenioeiysla ulums;(0 eermf3ta1opte ies;() rtoirpoydlm emfei ( arrmxmonu0tle  i3ias mDel(mo;(0 renmo todop  auvs;( sexmxr ny4ol nlici s s2um(moou4oexo feiat a2eauvp;(0 renif tydfp   nvs ( s2uoxmpiodlltelfvt (fa2tm(rpnu4ole if3iat a uanms;u0arxrmrciotfaD  ueolt texrxo no1amenmict ()arum(rp;u0tex  ictldls eluvp;u4arerxr3ta1om e u i;s  rtmim iu4optnlfcil()a2taxmo;o4olxnii3tatla rmnvo (0arxnmo oatla r uvs (0srxr(o iy1lptnlfcs s)sDraxroou4tetniieils a ul( s (4arxnxo oy1faD lieo;s0t2to(r iudalte nctat) Drm(mpnt0tltomociysfm um(vp;u4 leriocoydfp rauei (0 2xr(opou1ap e ivilsf Dtauroot1oeeomfciadlmDel(ms;t4aexomrcoadfptrlu olt s2xmiopiu4amt mfcsat  Durxm nt0alxnmf3iatfmDea( o;t) reomr oo1fm  li s;t) 2xr(o nu4ale  fctl(fa2raum no4optomo3tldfm umnms t)artomf3oytlatrliei (0texoxr nu1opt  ncs (faDraump;u0opxn ietas aDumnms;(4 lenmr tytomD  uvi t  etmir3oo4op emieiat aDur(m ;o0ale  o3iysfs2rl(mo t0tetoio ootlatrlu ils) eurxrpnudaltelieslt)aDtrxr oo1oexn iciat s umump;t0 rtrxf3oodom e ivo;s trxrim nudllteliviat) 2urx p;o0oetnioctysfs um(mpnu4aeeoio oydlm rlneols0 rxm(m ou1ome mncia(fsruaump;u1ape iietysfm rl(vs u4 rerio oodlpDeanes s)trxrir3iodlmenmnvias) rraxm nt0openioetydfmDuaumsnu0tlxnxo3ta1fpD luvsls0sexm(m3iodomt lieilt)sDtrxmoou0apxnioetasls2ul(mpnt0altrmr todfptr ieilt srtmir3io1am n fesls)artmx pnu1oltn oeiydla2eluvont0 renxf3to1opt lieo t0sexrxr no4ope  ictlt) rrmump;u0opxoifciys s2emuvs (0areoxfciy1fp  aivsls0 2xr(rpnu1omt  net tfsDurx pot0tpx  o3iatla2elnvsnt0artoxrcty1lmteaneilt s2umxm oodam nmieta(f Dur(r ou1tlxn icildlsDrl(mp;(0arxnmrcoa1om  li i;( tetrio nu1al elnetat)a2tax p;t1oee ioeiyd s rlump (0aexomocoy1op eaivi;s) rxmxrpoudom nlicilsf 2tru o;u1oltnifciys sDrln o (4alenmo oatom  luvol() 2tmim3nu4am elnvsls) 2rrxmpoo1tptomf3iyd mDel( o ()aeenio3ootopt lnvo s0 eumxr3oudlmtemfcil(f 2raxro;t4alxoiieiltfsDuauvs;u0tlxoxr oodoat aiei;s)seuoxm3no4olen ncs sfsrtaxmo;u1tex mictydls ranvp u0trxrmfciadlmDelneils0 etmim3oodllte fesas)s2tmumonu4apeomoetlt m2rmnvp;t) rermfcoydlaDran s t)sexoxrpou1lpte fcils)s2ta(rono4ole mfcias aDemump u0tltnxr3ootomte ieil( trto(rpiu4olt livi tf 2tr(  ;o4aex mfcils s uanmp;t0 rxoif ia1opD auvi;()trtmiopoo4lmte fvsa(fsDrrx ont0tltnmo3iytlm2raump u4 rtomr3oa1lmDran o t)t2ur(rpio4ome lfviasfsDrm(ro;t0tle  iciatfmDea(ms;u4tetnio3iatfpDrli s;() rurir3oydoltn fei sfsDurx  nu0oleoii3iltla2eaumont4trxriociatfa e ieols) 2uoir io4ap n neias) 2tmx  nu0oeeo fcilsfsDem(msn(0aeenir ootomtr nvolt  eurxm oo1omt  nvta(  rur(rpoo4tpto f3tlslsDelnms (0tlxoxfcootlatraivslt  rtr(opiydame  iet s)arraxmono1tex mfeiatla2rau snt0artoxrcoadlm eaivs s0trxoimpoo4lmenlnesl( a2ra(rooo4oeenmoeiyd aDrl(vsn(0trxomfctytla   ivols) 2xoirpoodalt mieiasfs2rm(rpnu1tet mieildls rlu o;t0artnmf oa1lp   nvol( srxo(opou1om emncsls s2rmx poo1apxomo3tat a2eluvs;u4 leomf3oy1la elueilt)t2xm(r3ny1lm nmnvsls s2trurp;t4aetnioeild s2ra(ms u4alxrir oa1fa   u i;s0 2tmxmpny4ol nlietas)srur(mo;t4oexnio3ildlmDrlumpnu) lenifcta1fm e n s t)sexm(mpiu1op e fct t)s2taxmpno0oeeomo3tad a el( s (0teeomr todfm  an i t0 euoimpiy1lleemiviasfaDumxmo;t1tpe  ociatfm umnmp u)tetoxocoa1oa rluvi () rxr(mpiy4lmt lfei ( srumxmpno4alt iicildls2eaumo;(0 etrxo iytfa  au il(  2uoio oo1lptnlncsat srtm(ront0oex mf3ilslm emnvs;u)tlxnir oo1omteau o s)seuoir3nudam  lieias) Dtm(  ;t4oleomieiyt aDrmnvo t) etomfctytlp  auvs s0 rxoxm oudal  mivsl()srtru pno4alxo oeias s2eanmsn(4alerxr3io1fmt lueol()t2umxrpoydaleelnvi t)a2ur(rp;u4olx micils sDum(vpnt0trxrxrciatfm ranvi;t  eum(o oy1ol e nvs s  rra(ro;o4aet  ictlsla2umnmp;(0alerxf oatoaDeau il() 2urim3iy4amt  fcta() rtrxm nu0tptnii3iyd a umnmo (0 exrif3tydlpt anvs;t sexmxm3ny4alt mieta( sDrrumpnu4aet  iciltfm rmnmon()tlxrmo3oodlpt  uvs;s seum(m3oy1lm nlnctatfaDrmx  ot4alxn octasfa emnvp;(0 rermocoytom   i s;(0s2xmiopiy1lm elnviatf rua(mpoo1tpxo ictydfa2rmnms t4treoxocty1fmDe n ils tetrir iu1ape  fvi s s2rmumo;u1oltniietltfa2ul(vs t) rtnir3to1lmDeanes s t2tm(m3oy4alte ictl(fs2tmxront4tltnmociytla em( sn()altoif3oodfpt anei;s  exmxo ou4oltn ieta(fartax p;t0oex mfetaslaDranmo t0 eerxf3oatomte ies;t0t2xr(m ou4om  mfes (fs2umx  oo4aetomfciadfs uauvs (4trenircoadopDrlneslt  2xoxr ou4ol  micsl(fartmu  ou4teeo ocild m elnms;(0artrmr3iotfatr ueo s  rxmiopiodape  neias)sDurxrooo4apxn f3iatfaDrln s (0trxrxf iy1fp rlu o s)t2xo(r oy1apenmfctlt)srtmur ot0teenii3tadfaDulnms;u)tlxnxr iatfmteaivs () 2urirpny4lpte ncilsfartaxm nt0olxo ociatla rm(mp (0trerir io1omD livols  etm(mpnudllt mnvs s  Dtr(m oo0ape ifciys a ea( snt0aetnxocta1la e iesls)trurirpnu4ll emfviltfsrtrump;t1tpt if3iad a ul( o t4teeriocoytlmDeaieol(0teuoimpoo4opt mivia( s2tau  ou1teeo f3iydfa2ra( o t4arxomo3tydfpt aiei t  2xo(m3oydlp emnci (fsDtr(moot1ole  ieiytls2ea( on(4tlxnmf3tydopDe ivi;s s2xoio nu1ap elfci t aDuru o;u4opeo fciasfm2rl( onu)tlerxoctodfmtraivi;s)sexoxm iy1lpe  ivi s)arrm( ont4oeto ietltfa2elump;t)tltrxr3oa1lmD auei t)t2urio3iu4ale  fviat)sDuaumooo0tlen octld mDumn s (0aetoxfctotfm  aiei;( s2xmxo oy4lm   neilsfsrua( oot0apeoif3tadfs um(mo t0 rtoir ia1op  lnvo;(  rumir3no1lp nmfcta() ruau pot0apxomf3tydlaDumums;t)areoxfctytopDeanvs;s  eurxm iu4llte icia()sDraumooo4aex mictadlm ra(vsn()altoxfcoydop elnei (0t2xoxo3nu4llt  netls  2tau pou1oee  o3tysfmDeanvo;u4 lenmf3iotlmDrai i;()t2tmxo iodapt  nviat) Dum( onu0opto ietltlaDrmn s t)texoif ty1oateanes;()teuo(m3iy1om eliciatfaDrmu poo0oleoiiciysls uanvs;(4texoxoctydlateln s;s0texo(rpio4omeemnes sf 2uaumont4tee ii3iys sDea( p t0altnir3oadla  anvs;s0srurxmpiy1opeemfvslt  2umu ont0opxo fetldfs2ranmo (4trtrxr3oy1fm  an sl() 2xo(m iodale mnvslt sDtmxr oo1texnmi3tysfa2ulnvon(4tlxrmo3ta1opDe u o s) 2uo(m3no4al e ivi sfsDrm(ro;u4alxomfcilslsDumnvpn(4alerir ty1lateanes;()srumim3no1ol n nvslt srrax oot1tpen f3ildlsDrl(vp u)texrio iytlptrli slt  rtrimpnodolenmnvi ( a2rrxro;t0olxnifciltls2elu s;t)teeoxr ia1fmDr n ilt)seto(rpoydam nmietls)srta(rpno0tee  fciatls2rm( o;u) renifcootlatr ieil(0setmir iydolt mnctas s2tmu  ou0aetoiietls s elnvon() etrmo3oodlmDrli s;s  2umimpoodlpenmfcil(farrm(rp;t0tlt  fciytla2ean p;()aetrmf oa1la eaivi ()t2urxrpny4aptelfetl()a2ur(rpou0apxnmfeiydfs uln p;u4arxrmr totfpte u o;t0 eumxm3oy1lpe lfcil( aDrm( pot4tleomf3iatfs2rlnvp;() rxoir3ta1opteai s;()s2ur(opoudop n iviat s2rr(m ;t4aleo i3iyd m eln s t4 lerio3ootfm  ai sl( trtrio iydlm  mfeils srtmxr nt1tetomictatls ea( on(4altnxo tatopD auesl()tetm(m iu1lpeelivilt arrrxmoot4ale  iciat mDuanmon(4teermfcoodlaDeanei t)teuoim3oydlpe lnctasf rta(m ou1olxnii3iysla ua(vo;(4 exoir oa1opt li i;(  2xo(mpiu1ape micsl(f 2ra(r ;t1tltnmfciytfa2ul( s () renmociydlaDeluesls  rur(m3io4apeemnesasf 2ur(mont0tlxnmicilsfmDua( o;()altomfcoadla eaneslt)sexm(mpiu4aptnmnci t)sDrm(rpnu4alenmfetldls umnvsn(4texnio iadfp  lueil(  2toxmpiu4lme lfvtl()aDum(ronu0olx mietyd m rlnvs;u4altoif tadfate nvi;() ruoir3nydlm n icsl()arta(rpno4ale  feiat s rmnvp;(4 reoxf ia1lmDe n slt  exrxm ou1opee fvi (fsrtruront4aet ii3iydfmDra(mo (0aexoxo3oadfpDeauvols s2urxm3oo1opt mivsls s2tax  ot0olxoiiciaslaDrmuvpnt0aeerxrcootfa e ueo ()setmimpiu4alt lneia()a2trxm ;u1oeto f3ias s2ulnmo () eerir3oydfp r neo;s srtoxopoudopen fcs s  Dtrx ono0ope  fctad s ranmpn(0trxnxociotop   ieil() exrxrpiudapeelfvia( a2ur(mpno1texniictatfaDean p;t4trtnif3tadfpteauvo;(  etmxm3oodlp nlfeia() Drm(  ;o0tlx  fetad m2uanvonu4aeenmo tatfa ran sl(0s2urim ou4altn fetlt)artmxmpnt0oltnifciadfmDem(vo u0aexrir3oy1fatr nvi;t seurir3oydolte fes sfs2umx oot0apt  oeilsfs2umuvs;(0trenxf3iotlp ranvi t s2tr(m3iodape mnetls)a2rrx oot0tleo ociltla uau o;t) rtrirciy1fm r n i;()trxr(mpny4ome lfvils)a2rmxrono1alxn f3iydla2emnms;u4teenxr3totoatraies;s0texrxm3ou1amen ncslsfaDum(m nt4aex if3tytfs2rau s;t4 rtomr3iydfmtr i s;t srxr(mpiu1om nlivilt  Dtauront0aeeomietysfaDra( p () rtomrcto1faD lnes s0s2tr(o3iudlm emneiat  Dta(  ;t4tpt ifeiadla el( p;(0 rxnir oytoa raueo;t tetrxm3oodaltnlnvsas  Duau pot4alxo fcilsfm em(ms u)alermo iadfa  lueilt s2tmxr io1lp nlfet s)artmur no4altn oeiasla ran p;u4 ltrif3iatlm e n sls sruoimpio4oleemfei tfsDumu pot4tpeomiciadlm um( p t0trxoirciotom e nes (  etrxrpno1ope lnvi t) Dtax  ;o0oexoiocias aDulu p (0tlermf totopt au i;( trxmxmpou4lp nmfes (fsrrrxr no0tet mo3tldfs umnvo t)tetnif iytop eli o (0t2urxrpoy1ole mivs s)aDtmuro;o0altoifciadfs2uauvo;(4alxoxo iotfmt luvo t)trxmir iudopeemfctatfs2umu pnu1texoif3tysfmDemu o () exrir3ootfaD  i i t t2tmxrpio1am elfctl(f 2tr( ont1oltnifeiysfmDean pn()alxoifciadfm eaneo;s0t2xoio3nudoltn ies sfs2rrurp;o0tlenifciyt a2uln o t0 exrxr3ta1fmtr ueol(0tetoxm3nydol e neilt s2ua(mpot0tlxomoetadfaDul(msnt4aeenmo3ootoaDean o;(0srumxopno1ll n fvia(fs2tm(rp;t1ape  o3tydfm2elnmo u4 etrifcoadfm rauvs ()t2urxm3iu1ap e fcils  Durx o;u0olen i3iatfa um(mpnu4aexriocoo1fpDrlnei s0t2toirpio4lp nmivi t)s2uau  nt1ape  i3ilsfaDulumo;u0teenxf3iotlp elnvi;s trxo(m iy1lmtn fvsl(fa2rmx  ou4aex  octydfa uau p;(4arxrxr3iadomD lnei t trur(m3ny4op e fei (f Dtax  nt1tpxn fciytfsDrl(vonu4texnxf ia1fpt lu sl(  etm(r3ny1lmtelicilt s2truroou4ale iieiyd aDrmu s t0aetoxfciadoa eln ils setm(m oo4ap n ietlt)a2trumpno1oex mfctadlm2em( snu0aetnxfctydlpt  ues;(0seuoiopno4al  lfesas a2uau oou0apeomieilsfs2ea(vonu0aexnmo ia1fa ran o;t)sexoxm oo4omeemicsatfartr(rpoo0texnmfctysfm rau o t0alxnmo iotfpDeaies t0teur(opoodal emietat)a2ur( ono0opt  fctltlmDum( sn()aeerir3totfatelivs s)trumxopiydapenlicia(f 2um( pnu1apxoio3ildfmDrm(msnt)tleoxocoytop rlneo;s)teuoxm3iudop emfeta() rtru poo0optoiicilt m2elums t)trtnxr3tatlat  ieilt0s2toxr iodll  lfeias) Dta(mo;u4tee ifctadfa rm(mpnt)texomf3oytoatrlnes;t0tetm(opiydlp e ivs ( aruaurp;u4oetoio3iydla ean o u4 ltrir3iy1fatelieslt)setrxopnu1lmtelfvsa() 2ur(rpot1tle  i3iadfmDem(mo (0treoxfcoodfm  ai sl( s2uoxr iu4oltemiesa()aDrm( pot1opxn ociasla rmnvpnu)aeenioctytopD  uvs s t2tmxo iy1oltelictat) Dta(rp;t4oex if3iydfsDum(monu4teermf iotlpDrlu o;t t2uoxm iydaltnmfct t a2rruroot0aex iieiadfaDel( pnu4tleomr oo1om raivols)trurxo3ny4lm   ivi ()sDtmurp;u4tpenmfctadls2umumo u) lxnxo3iatfmtr ivsls)teuoxm3ou1al  lfci (faDum(  ou1ale mi3iad s2elu onu0tlerxo oo1oateaueol(0texrir3no1ap emnvtat)srtau oou4aptomieiltfa elnmon(4 lxoxrctydfpte i sls0seumxo3iydlp  lfcsls)aDta(moot0optn f3iysfa2rmnmpn(4texnifciy1om raivilt) eumir3oodam  mnvi ()artr(moot1open iciadls2eanmp;t4alerir3oo1op elnvil()srtoxmpnu1lle miei ()artrxr nt4ope  octldfmDrmu pnt)artnxo to1optrlivi t0teumxrpoodaltn fcta(farrmxroou4tlxn ictas s em(mp;(4aetrmfcoydfp   neolt0s2xm(o iy1al   ieslt)arumx  ou4oexoif3iatlm ulump;()trenxoctydlp r n i;t)sexoxr3oo1ll nmncils artmxrooo4oetnioeiatfm rmn p u0alxoio3to1fatelnvolt0srumxm iudlm e feilt sDra(m nt4tex  ieiatlmDum(vpnt0altomf iydopD  ivslt srxrxr oydopenmiet () rrrur nt4tpx mociltla eluvpnu0arxnxf3totla elueo;s0 rum(rpio1ol emnei (f 2um( o;u1opxo feilt m uauvonu0 ltrxrciy1oaDrln i s)s2xrxo iudomtnlneia()arurumo;t0teenifciydfa2em(mo u4treoifcto1laDelu i;s)s2uoir nodopeemnvtas) Drm(r nt0tpenmoeilsfa umn p (4tleomocoytla rai s t0 exo(r no1ole mneia(fsDrrumo;o1oleoifetas m2umu o u0 rxomo3todlpD li i t teumxo3iydom emiet sfsDra( ono4teenio3tldls2eluvon(4alxrmo3todlate uei () 2tmxr oo1op e ivs tf rumxrp;u1altomfciadlmDul( p;t) eeomf iodlptr uei s) eto(r3iodllenmieils)aDtmu onu0aeenmfciltlm2em(mp;()tltrmr3oadlpt lnvo t0trurxopnu1aptnlict (f Dtmu pou0oex ifeiydlaDea(mont0texoir iadomteanvsls t2xr(m3io4apte fvt sfartmx  ou0aeeoiictls mDrauvsnt0 etrmo3ta1fateanvi (0s2tm(o3no1omtemivt s) Dtaxrp;o1apxnmfctlsla2rl(vpnt0trtoircoy1opDran o;(0 rurir iu4omee fci sfarumu  ot1oee mf3tatls umnmo;t4 lxnxociotomDe ivo s  eurirpiy4am elivta( arrm(rpou1tee miciatlsDrlu on(4 etoxfcoa1faD liesl( s2xrio ny4altn netls) Dra(r ;t0oet mfctltfs um(vp;t) reomrcio1la elivi t0trto(mpiy1lmeemivt s)a2tmxroou4tpxo ociysfa2ulu p t4arerirciy1faD  uei (0 euoxr ny4ol   ics sfaDtm( ooo0texomicildfa emu s ()treomf oadfatrau ol(0 rxr(opno4aptemfetl(fsDuaumpnt1oltn oetydfa uau o t0tltoir3oo1opD lneo;s) rtoim iodlmtnlietat) rum( oot1opx mf3iytfm rlump t0tlxoxf tydom  ln i t) 2umxrpou4amtemivsas) Duaumo;t4tptomieias mDea(vpnt4 reoxfcootfmDe ivils) rtoxo3oy4oltnmfeil(fsDtm(r ot4opxnio3tytfs ulump;t)aleomo iodlmte neils) 2trxr3ny1al nlfeil()s2tax oot0apeomi3iatfa2rl(ms;u0 rtnifcootfmDean o ()srurim3nydol n ncilt) Dua(mp;o4aleo ocildfa2ul( o;(0trxrmo3iodfat ai o t s2tmiopnu1op e ies s  Drmxr nt1tlenmieilslsDrmuvon() rxnifcoo1lm   n ils  2xrir3oo4lmeelfeiatfsrtmx  ;o0tpto i3iyd mDuaumo;u4altrxo3oo1omtr uesl()srtrim3ou4ll  lneiltf Drr(moot4aptnii3iasfsDrlu o t0 rtrif todfmD  uvo;(0t2xm(o3nydome licsltfsrrr(m ;u0opxn fetldlmDrlu s u4tetnmfciatfpDeli i;s)teumiopno4llee nesasf rrmx ono4aptoiictasfm rlnvp (4aeermocoy1lp raieils seuo(m oydapenlfeiltfsDtrxroot0tet  f3tld a rm( o t0aetoxo tytopDrlnes ( t2tmxo3oo1lme mncia() Dtaumonu4opt ii3ildfa rln pn()trxomr iy1opD  ivi;t) exm(m3iy4llen nvsa( srtmur ;o4alxniieias mDra(mp;u) lxnio3ia1om e u ols trto(o nu1lp  mfct t s2rmxro;o4aeeomieiydfa2ranms;u)trenmfctotopt  ueo;t srxm(m3oudam e iesltfarrr(mpno0oex  i3iyslm eauvp;t4aexrxr oy1fat ln s;s0srtoxm ny4optemfvs s arra(r nu1opxn oetltfm elums u0tlxrxfcoo1opte ivs t0 ruo(opoy1oleemfvtl( arrr(rp;o0texnifeiadfm2ra(mpnt) etnxf tydfa r ivsls srxrxm iu4alt lieilt a2urx  ;t4opx  i3tadla2rl(mo;u4aleomf3iatfat aneol()srxmxr3ny1ol elnvslsfsDtmumoot1ape if3iatlm2uauvsnt4tlenxfciy1fpte iei;s  rxoio3oo4op   nei ( aDtax oot4alxnifciltfmDea(ms;()aetomfctydlpte uvi t) 2xo(r nu4opt  ncils s2ta(  nu0tpe mfeild sDum(ms;(0teermo todfaD luei s)t2umiopno4oltnmfeil()s2tax pnt4tlxn oeiltla rau o t4altrxfciadfm elnvols0s2xoxr oy1op  lnes (fa2trxmoou4oeen ictydlm2emumonu)altoio3oa1om elieo;( trurir iu4om n nvtat) rtaumono1tetomociyd sDelu s t0artrir3oadfa  auvs s  exoim iy4lmeemics (  ruaump;t1aptn i3ilsls ulnvp;u)aexrxr3iydlpDrli o;s)seurxr iydape lnvs tf Duaxrpnt0tpto fetydla em(mpnu0trerxocta1oa ranei;t0srtrxrpiu4am n fcs (fsrurxm ot0tlx mi3ilslm ua(mont0 rxnmrctotopt  i slt0 2urirpno1alt  nvs t  rrm( onu4opx mociyt aDelnvp u4altomrctytlpD au s;(0teurirpiy1ap nmfesasf rtrxr oo1tetnio3iasfaDemums;(0tetnxo3totfa rluvi;( s2xoxm3iy1apt mnetat)s2taum ot0ape iicils mDrm( s;u4aetomf3iy1fateau s t0s2xm(r oudal   net ( srtruroot0oeeoif3ils s2eln p ()trtoifcoatfate ies s0 eurim3ou4alen ictl(fsDtm(mpno4tpeomf3iytls rmumo;(4trxomf3oo1lp e u s;s)s2ur(r iu1ale mivt s s2rrxro;o4oetoio3ils s um(vp u0tlerif iadfa   ivsls) euoxopiudlpe  neils  2umxmonu4alxn feiatla2rmnvonu0alenxf3iy1fpDe ieo;s s2trxm ny4optn netas aDurx o;u1opxoifctyslsDeanmpnt0areoif3totoat  ueo s)setmxo io1om  mieias sruaxm ot1apx ioeiad m2elu s u4 rxrxoctodop eaueils)setrxo3no4olte ncil(fa2ta( p;u0oee  i3tld m2eauvs ()tltrxf oo1lpDr u s s0t2xoxopiydlm  mfcsl(f Drr(mo;u1opt  o3ild m2ea(monu) ltrio iatomteanei;s  2uoxrpoudlle mnct ()sDururp;u4apx moeiyd mDea(vo;() ltnmo3oa1omt auvsl(0 rurxmpoo1ll   fvs t sDtrxmpno0tpen i3ildfs emums;u)alenif iadfmteaueol(0 rtrio iu4lmenlnvtas) rrrxroou0tpe  oetas a2rln pnt)tetoir iotfmtran i s0trumxm iodoltn fvi t arrmump;t0tle iieiadfsDel(vp u) reniociotla  li olt0 rum(m3iy4lme livs sfartm(mooo4tle  ictls sDrauvo () eeoifcoy1omDeanvs s)trtoxo3nu4omen icsls)a2raxr ou1olxoii3tydlsDeauvo;t0treriociadoaDeau i;s)trtmir iu1omtemnes s)aDua( o;o0tptoii3iadlaDumuvs t)tlermf3oy1fat ln i;(  rurxo ou4lp n fvta(  rumu p;u4aetomo3iyt sDrmuvs;t4tetnxf3iytlpD an s;t0tetmim3ou4lleemicils sDumxm ot0opeo ieiltlm ul(vsnt)tleoir3tydlp r nvo;t  2to(o3no1alee ivs t)srrmx poo4tpxomfcildfs el(msn(0 ltriociotlmt ln i;(0t2trxmpoudop e ivt sf rtm( pnt1aee io3iad aDrmu s;u0 lxrmfctadlmt ai s;t s2trxm3iudalenlnesat)a2umxmonu0tlt mfeiytfa ran s;(0tltrmfcto1oaDelu o t0sruoirpoy4lpen nei t) Dumurpnt0oeeo i3iasls2rluvp t)tltnxocoytlmDe n s;t)s2tr(m iy1ap elnvs tfa2tax pot4alen fciasfs ra(vo;t4alxrmf iydfm  lnvsl(  2xrxm3nu1lmenmics s  2tauro;o4tex iocils mDumuvo u) ltrio3ty1fmtr u s;t)texoio no1al emivslt) 2tmxmoot0tpto o3tys a uau s u4artomo3tatlpD  i i t0tetrirpiodapeelnctls) 2trxrpnu0tlx ifeiys a raumo;t)trxrmr3iadfpt livsls teumirpno1am nlicsl( sDua(ronu4ale ifetadlsDulu o ()trxnif3tatfptelivs ()trumxo3ou4optnmfcsas  rumum ou4oetoif3ildfa uluvs;u0trerxr oadopt  ivsl(0 etrim no4olt  ivi ()srra(m nt0aptnio3tasfa2ul(mo t0 etoxo3tadfptr nvs;t)trxoxm3iudoptnmivsat) Dtaxr oo4tetnifeiyt a2ul(mp u4tetnif to1opDeluesl()trtr(m3nodolee fcs s  2rrumo;o4opeo o3iat a2emnvp;t4trenxfcoo1lmD anvo;t  2toxopiy4op elivia(farurur ou4oex  o3ild aDumnvp ()aetomf3iadlp  lu ol(0trtoim iodalen feiat) rur(  nu4optoifciaslaDulump;u) reoxfciydlp  ai o;s0s2xrim io4lltnlivsls arraur oo1olt  ociysfm2um( pnt)alxnxf tatfaD lues;s0 rumxo no4ol elici t)s2raxmoou0tetoii3iatlmDulums;() etnxo3iadoaD lu o s)sexm(r3nodamenlivtls)s2ta( p;o1opxo i3iys mDel( snu)artrmfcio1lat aueil()s2uoxmpou1lptn nvtltfsrumxro;t1alxo i3tlslm rm(vo u)trtoif3tydlpte nesl( seuo(m3iu4al  lies (f Dururoou4tpeoii3ias a rlnmonu4trtomfcty1om  an s t)srtmxo ny4apeelfcils)arta(mooo4tltnifeiyt a2rl(vs;u4alxniocoytfpteluvi t0texmxmpiu1omtnmncils  rua(rpoo0aptomfeiyslsDumn p;t) rtoifciatopD an i t trxmio iodam e fcil()a2tmxrpot1olxoii3iltfs2rauvs (0tetrxf oytlpDrlnei (  rurimpou1op nlfvias a2umum ot0tpxniietls sDem(ms u0altnxrctadfm eaivsls0teuoxr oo1lmt lnct tfsDrm( pot1tptoiiciytlm2rm(msn(0altrxocoytop   ivsl()srtr(o3iy4omtemiesa( srtr( poo4apto oeiyd sDulu pn(4 eerir tatlm e ieo t0trto(r3iu4amtnlicslt)a2rmxmpou4tpx mictlt m2ra(mpn()altnio3totlm   ivi;t  eurim oodol nlnvta(fsrrau onu0apxo icils aDranvo u0 reoifcoytoptean s;s trum(r oydopee fctas) Drru p;t4teeoiieiydla2rmuvs u) renio3oodoateaueo s) 2toiopiu1omeelfes ( aDurxro;t4ape mf3iasfm rmnmsnt0aexomr tydom  lieo;s) etrio3no1apeemics sfa2taxm ot1oee miciltfmDrlump (4tetomo ootfpDe n sls0t2xo(m ny4am   fcsa() 2tr( ono4alxn f3ilt mDrl(vo;(4teermo3oytlmDe ieslt0srxoim3nu4ale mivsltfsrtr(r nu1teenifciatfmDea( s t0aetnxr oadlatr i sls seurxopny4lpenmneslsfa2tmx  nu4oexo ieias mDrlnvo;t4altoxf tydoaD lnvs;t sexm(mpiudlptn iesltf rraxmoot4tltomo3tld sDem( snu)tlerir iotlpteanvilt)t2um(o3no4lp nmneta() Dum(m ;o1tlxn octatfs ul(mo u)altrxrciotlpD lnei;( seto(opou4lle  ivtat)s2rm(mo;t1teeoioctysfa um(vpnu4areoifctatoaDr neo (0trur(opio1oltnlfetl(  rrrx oot4olxnifeilsla elnvp;u4aexrxr todopt  nvo ( seur(m oo4oltnmfei s srrrxr nt4tlxoio3ildlm rmnmon(0tlxnmr3oodfmtran sls0trxo(o3nodole mncs sf rrau pnt1oexn feilt sDuanvpn(0aexoxf ty1lpt aneolt  2xmxmpoy1am  mnet ()a2taump;u0ole ifctlt s2eln p t0alxrifciotlpt li ol(0 euoxopio4op e nviat)aDtaxmpoo1optomieiad s2um(mp;u0artoio ootlmDrln sls0s2xr(mpnu1am e nvsls aruaumonu0aexnii3iat a2raumo;u0trenxf3totlm r ies;t s2tmxm iu1omt mfeslt)a2ua(moot1apen iciltfsDeluvp;() lenxfcootlm   uvils trxr(o3iu1llenlicil()sDrmxmont4opxoiociydfm2uaumpnt0teenmr3to1opD ai i;t) rxm(o3no1am nlivtls sDuru pno1alxn ietad a raumo;u)tlxrmo todoatrau o;(0 2xmir io1ope  nesl( sDrr(m nu0aetn oeild aDua(msnt)tetrmocoytomteluvs;(0 2uoirpoo4open ieslt)arurxmpot0olxniicias s ul( pnt)tetomrciytomteluei;(0trtrimpnydlpt lneslt)artm(r nt1ape  icilslaDulums (4aeeoir3oa1fpDranvo;t srxm(mpoydllt mnctat aDtmxm no0tlt  iciyd sDelnvpnu) eeomo totopt luvi;( texm(m3iodlmtn ivsat) 2umu pou0tlenmfciadfmDumnms;u)aexrxo3oadfa e ueolt0 rxo(opiy4ale  fvsa()a2umum ;t1oeen feildfs2ra(mpn(4teerioctatfpDrln o;s) 2urirpiu4ame licsls)arrmxmooo4tpe  iciytfa2eaumo;() eermocoo1fatrln ilt)sexoimpio1am n ieilsfsrrau poo4ale iictysfa umnmp t)trtomf to1opt  i o t  euoim oodam  liciat)a2raxrpnu1optoif3iytls eau p;t0aleomr3oytla   nes;t0 2ur(m3no1lp elneiat)srrmurp;u4oetnmo3tlslm2em(vs ()arxoir3ia1fa  li i;(0t2to(m3iu4aptnlfesl(fsrtrxr ou1aetoii3iytlaDem(vs;u)trxnxr3oo1fmtean o;t  rxm(r3iu1om n nvta()arumu oou0tee mi3iadla2elumo u)aetrio3tadoa eanvi;t0s2toir nydoptn neslt)arrm(r ;u4oet mictytlm rlnvonu)trtoxrciodfaDranei;t0sexmiopoodlmeemicsa( sDrr(ro;o1olxomf3iyslsDuanmo;t4altoxr3oodopD  neo t trxm(mpiy1lm e ies (f rtr( o;o1teeoif3iatlm2rau s;t4texnmf3iytomtr iesls) exoxo3oy1lpte ivsltf 2taur nu4apx mieiatfm2um(monu4 exnifcta1fa  an s;()trumirpiu1opt livs tfs2rr(mp;o4alx iictyt a2rm(mo ()altoir oy1op e ues (  2uo(mpny4ame lncsas)srur(m nu0tee ifeias m2emn s;(4arxnio3iatfpteluei s)texoxm oo4lpe lncilt) Dtr(mo;t1alen ociadfs2ea( o u4 ltnxf oatfa  aies;t0texmim oo1amte net s) Dtaxrono1aeeniiciasls2ranmo;(4tlxoircoo1fm  lu s;()s2umxr3iudam eliesat) Drrur no1olto iciadls2um(ms;(0 rxrxr iadlp rlieo;( t2uo(opnu1op  lies ( aDra(m nt1oleo ieiadfm eau on()arxnxf oodoatr uvsl( srumxm3nu1amtelfeias  rtmumoou4ope mf3iat m2umu s;u0 etoxr3iadfp rauvo t)tetmim nodap e iesls  2ururono1alt io3ildfm2ul( o;t0 etoxoctodlp  li s s0sruo(r3oo1omee iesl( artau onu1oee io3iyslm ra(mon(4artnif3tadlm eanei;( teto(o3ny4omtnlfeia( srtax pou4tpxo ieiatlm2ulump ()tlxrio3oy1opDran slt  2xmxm nudal  miet ()artmurpot0opt mieiytfm elnmo;u0 eenxo3iodfpDrai i;(  exr(o3iy1ame lfet t)sDrmu pou0apx mi3ias m eaumont)tltnxo tytlmt  nvs s setrio ny4ap nlictlt a2ra(m nt0oetn octld m2ra(vs (0artnircto1fmt  nvi;(0 2uo(r iy1ame lfvt s) rrrxm nu0tpx  i3iydla2umnvp ()arxnxr tytlpt aivs;(0s2xmim iu1omt lfci ()a2umumpnt4opeo fctadfm umn s;t0texrmo iadfa r u s;()setoim iu4ol nlivtls  2tm(  nu4apxomi3iad m rlnmp;()aexriocia1late ivi;( trurir3oydlpe lncslt)a2trumpot1aexnmfcilslm2elnvo u0tetnmr3iodomDeaivo;s0setr(m ou1al   fvilt s2um(ro;u4olenii3tytfs elumo (0tltrxocoy1op e n sl(0srurimpoy1ll e ivi s) 2rauroou0tpe  icilt s um(vp u0 etnxfcio1op  anesls  2xrxo3no4lmt lieiatfaDtrx  ;o0altn oeiad m umnmo;t) lxoxf3todfaD  i o s tetm(mpoudllen fvtls  Dumurpnt1olt mo3ils aDulnmon(4aetnxf iotfm rlnvi;(0tetmxo3oydamte fcslt)a2tr( oou4aeenioctaslaDumn pnt4 lxoxf ty1lmtean s t)tetmxo3oodlmt lneilt srraumpot0aexn ieildfa umn snt4 lerxf ootop  aneil(0 2um(r3nydlm nmics tfaDua(ro;o1oltnmiciasla2rau sn(0altnif3tydopDraivi;(0 rtoxo3oy1optnlnesl()sruru o;t0tltoif3taslm2eaums;u0aetrif3io1fa eanvs s)t2trirpny1alen fvtls s2ua( p;u4tpt mo3ias a ua(ms u4arxnio3tadfpt auvo;s) rxr(mpiodam   iet t artrx  ;o1ape mi3tydfaDeauvsnu4aeeomf iydfmD liei s  etoxo iydapeelfesls)s2umx pnu0alxn f3iysfm rln s () lxomociy1fat lieslt)texoio3ny1openmnetltfsDtrum no4olen fetysfm em( pnt4texoxf3tadfateaivo s0tetrxm ny1llenlnvslsf Drmx pnt4tlxnmfcild s emumsnt)tetrmr3iy1lat lueo;t s2urxo oudalt lnvia() Dra(rpou0tpe  ocils m um(mo;()alxoxrcta1oa rlnei s)sexo(m ny4lm emnetat  Durxmo;o4aleo oetlt m2rl( pnu4 etomrcia1lp rln i s)srxoir oydale lfct ()artaxmooo0tlx  ocilt m elump ()trenifcoydlpDr ieslt srtrir iu4llenmfvil( a2urxm oo1tptnmocild s2ranvp;(0tltrxf to1laDr ies;t0sexr(mpny1omen ivtasf 2ur(m nu4tlt  fctld s uanvs;()aleoxr iadomt  i ilt t2xrxmpoy4lmt lfcilt  Dtr(r ;u4texomfeiytls ea( snu) renxocio1lpt  ieo s0 2xr(o3iodlpt lfvtltfarur( pnt0tpe mfeilsfs rmuvonu4altnircoy1faDrau slt)tetm(o iudome miesl()srrauroot1tltoioeildfaDeluvs t4tetnmr oy1opD lieo t)tetmio3nudlme mfcsas) rurxmp;u0apenio3iydls2uan pn()aexriocoytlp e nvi;t  rtrxr io1lm emnvia()srumx  ot4ape mieiydlm2ean p ()tlxrxo3to1lm rlnes t)t2xr(m3iy4aptemicil()aDtm(rp;o4ope ii3ild a2emn s;(4aexrxocoytopt  neil() rxrxm3io4omtemfci (fa2rrum oo4apeoifetys m2rmn s u)tetniocia1fpt auei ()t2umxo3oy1al  mnct ( aDraxr no0tlxomo3iyt a2rlnmsn(0tleoxr3iotlpt aneil(0 etoxo oy4lmen neilt  2ta(m ;o0aleomf3tad a uln o (4trtrxfciatoptelu ilt0 etr(opoy1lle micsa()aDrr(rpot0apx mi3tyt m rm(vs u4aetrxo3tytla r nes;()s2xo(mpoo4ameelnvi ( a2raurp;u4tee iiciytlaDrmumo u) eenmo3tatfaDe ivo t0 eurxopiudomenlici s aDtru poo1olx ifciatfaDuan o (4 eenir3tatfm r nvi;(0srumxrpnu4ome  ivsatfs2uaumont1tpenmf3iasfs ranmpnt4 renmo oydoaD  n o;()truoxmpoo1opee iesatfaDrm(mpno4ope mo3tldla2eln p;(0aetnmocoytlm   n s (0 eur(rpnodol  mnctltfaruru  ;u0alt io3ilt aDelu snt0 rxrif3oy1fmDrai il( seur(opiydap   nvia(fartrurpnu4teeomoeiyd mDulnvo u0trermocoadfmD lueo t)trto(opoudal n ictasfaDtrxr nu1apeomf3tlsfsDemuvon() etrmf to1lpDeli i;t texrxm iy1lltnlnvs tf Dtmur ;o0tlxnio3tldfs2uln p t4 ltnmf3totfa eai sls  rxoim oy1om   fvtat  Dtau pnu4aet mieiaslm2uanmo;(0altnmo3tatlmtraivo (  rtr(m ny1lm nlnct s)arrm(ro;u1tpeoio3iydfm ulu p u4 lxnxr3oatfmDean o t0s2tmimpoy1ap nmivs sfs2ta(ronu4apeoioetatlm2umu pn(4 eerifctodlaD lneil()srtoirpiydapt mnvtat)aDtm(mp;t1oetoiieiltlaDeln pn(0 lenir iotoaDeai i t setmxrpoudllenmfet t)aDraump;o0tlx ioeiasls2el(ms (0tetoio3ty1lmDeanvo;(  etmxrpoy1ome  iet (  Dururpou0alx mo3iat a2ua(vs (4tltnmr tatlateau s;s)srum(m3no1oltn fesasfsDta(ronu0oee ii3iatlm em( p t4trtomrctydlaD liei;(0trurimpno4open neta( sDraum ;u4olx io3iytlm rmums;u)artoio3oo1fpt  nvo t  2toxo io1ap e nvi s  rtr( ono4oexo f3tltfmDea(vs;u0aexoxfcta1oa rli i;(0s2ur(rpou1optelnvi s srur(roou0apxn ociyd aDeluvp t0 etoir3tatom  aneslt0 rurir3no1lm nmictatfsDtm(r ot4olxnmo3
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t0texmxm3iu1ope mfetas  rra(r oo1aptnioetasfaDrm(mp u0artoxo3iotoa  aieils  rtm(r3oy4amenlicsat sDtrxrpot4aeeoif3ildfa uln p;t0artoxfcoytlat  ivi;s) exm(o iy1op   fei sfsrraurpnu1oetoiieiydfa2em( s;(4trtnmo iydlpDran i;s)s2tr(m3oudll emnvsa(  Dua(r ;o0tlxomocilt aDuln p (0 rxnmf3oa1fat ai il(  2trxm3nu4ale lnvt () 2tau pot1alxn i3iytfs2um(vpnu0aexnir iadfatr nvi t0 etmim iu4aleelfeilt)srur(r nt0tltoio3tls aDrl(vo ()aexnxo ia1lmtrliei ()t2xm(mpnudlmt  nvt t srtmu oou4alxnmo3tydfsDrm(vo u0aeenmo to1opDeaieo ( t2trxrpou1lptemivt t)srtaxrpot1ole mociatla2rlnvp;t)areoxo ia1laDr nvo ()trxo(m iy4lp elfcsa( srur(  nu0opt  fetad s2ulnms () etoif3oo1lm eli s;() 2xoir3ny4lmtemnci (farrr(monu4oeto fciys sDrau p;t4 rermr ootlp e ivs t)sexrxr3nu1omtn ictl( arur( pnt1altoifetlslmDua(vont) lxrif ta1opDeauvo;t0s2to(m3iudale mictl(  Duaxm oo0aexo f3tasfa2eaump u4tlxnmfcty1oat lieol()seuoxo3oodaptnmfvtas)arraxmpno1oee mfeiadls2emuvp t4arxrxo totop eaneo;s sexr(r oodlle lnetas arumurpnt4openmfetas aDrln snt4tlerir oytfpDe ieo;(0t2umir3ou1lmtnlnvsa(f ruax  oo1aet  ocilslm rmnmo;(4trtoio3oodlat lneo t0 2xmim3iy4oleelieslt  Draurono4teenio3tldlsDemnvsn() exrxoctytlptrli o;t  2uo(o3iydal eliei tfs2ua(rpou4opeoifetls m ul( s;u4tetrifciydlmtr nvols0srurxo io4lpeemfvsatfsDua(m ou0tpxoifeiydla emumo (0texrirciytom  lnvi;s0s2uo(m iu4ll nmnvilt) rurxro;t1texn ieils sDrlu o (0trtoxrciodlm   nei ( s2xm(o io4am n fcs (  rurxm ou0aetoiictadfm ulumont0 eerio tatfm e u s t)sruoxo iydlm n ieilsfaruaxr ;o4alx  icild aDumn snu4 reomr oytlat  ies;s)sexoxr3oy4lme lietl() rrau pou4alt  iciytfa2rau pn(0trxrmo iytla   uvolt) etmxrpiodal  liei s  rraxmo;t1ape  ociasfm2uan p;u0aetoirctytlpDelneo s) rxmio iy4om n ict (f 2ra( pnt4tle moeiytfmDua( p;t) rxrircoytlm r u s;t)s2xr(o nu4lm e feiltfartmxrp;t1aleoioctyt m2ran pnt0arxnmrctatlm r ues ()seuoxo ny1ol n fetatfsDua(  ;t0tex mi3iltfa elump;t)artrif3oodlpDr uvs s0s2tmxrpnodamtnmnetatf rurxrp;t4apxoiietysfsDrm( o;t0artrmr oo1fpDr neo;s  rur(rpnydaptnlnet tfa2um(  ot0altnmieiyd m elnmp;()trerxf oatlmt  nvo;(0seum(o3no4amen iciatfa2ururpoo4teeoifeiatlsDuluvp;t)tltnir3tydfa   i s;s  rtrxrpou4aleelnet ()aruaxmpno4aex mfciys s2umnvs;u)texnmr iydom  aies;t)sruo(m iy1optn ivs t)aDur(m nu0tpeo i3iyslm em(von(0teenmoctydlm rauvo s0 2xoir no4llee neiltfarumu onu4opxn i3ild m emu o t0altrxr oodfptrau s s sexrio3iu4lpeelnet sf 2trxro;o0tpto oeild sDemu onu)alenmf3oodlpD  ivi;t0seuoxr oudamen fcsls) Durx ooo1tee mieiadlsDrln o t)tlxoxf3oatlpD lieo t) rxrir3nydllenlfetat)s2tru  ou0openiicilt m umuvp (4aeeoxoctodomteaneilt trtrxo oo1llenmfcsltfarururoot0tet mo3iytfs2umumpnu4 reoio ootom rau ols) rxoim3iu1llenlneslt  rum(mont0alxomocilsla2ulnmon()alermf3oo1fpD auvo t)texm(m nodol elnei t) rta(rp;u1aee  f3tyd aDrl(vsn(0aetrir iotfatelivsls)s2xr(mpnodome lfct s)arur(rooo1ole  feiydfa2ea(ms (0altoif ootopDeanvs ()sexrxrpoudal n nctls srum(r nu4altn fciasla2rm(mpnt4aeermf3iatfpt lneo;s trur(opiy1ol nlfvi (f Dtru  oo4oetnmfetysla emnvsnt)altrxr3ty1lmtrlneo;s0trto(o3oy1amenlfviltfaDuaxm ou4teto i3tyd a2rlnms u4trermf3oatomt lues;()s2uoirpiudopt  ies (fa2rrxr ;o1tpx  ictydla rluvsnu0 exnifcoo1fp e nes s0 2um(m3iu1llen ncsl(  rtrxmo;o4ale  octad m eau p;t4texnir3oytlmDr nvil() rum(r oydlpe mfvs sfa2ur( oot4oexomi3ils m uanvp (4 exrxfcoatopt aneo s) 2toirpoo1alte iesls)srrrum ;o0aetomfeilt m umuvsn(0tleoxoctatfmtran o () rxr(r oodop nlfesat)aDra( ooo4opxnmf3tlsfm ra(mpnt0 etoif3todopteaivi t)s2xr(m3oydoptelneilsfsDtr(  no0aexoiictyslm ulnms;u) rtoxrcoytfmD aneol(0teuoio oo4llenlict (fsDrruronu1alt ii3iad aDrmn onu)trtrmf3tydoat  i i t0 rtr(m3iy1al emnvt s arrm(mp;o0alto feiat sDelnvpnt4 exnxr3to1fpteauesls) rxo(rpnudamenlfeiltfarum(m oo4alxnifctytlmDuanmo;u0 rtoif ta1fpDe ues ()srtm(o3iu1lp  liviat artmxm no0opeomf3iatla el(ms;t0aexrmf3tytomtrliei s0t2xm(rpnydapenlictat) rtr( pnu1oet mfctat s uanms;u0altrmr totfp r nvs;s srum(opiy4ameemics (  2rr( oou1oetn oetyt m2uanvp;u)altoxr oodoa   iei;() etoio oydlm   nvtlsfaDrmum ;o1opeomiciatfs rau s t0 leoir3io1faDeau i;s)trtoir3nodam emiciat)sruax pot0oeenif3iadlsDrlnvpnt0 etnxfciodlaD  u o;()trurxm3no1ap nlnvi s sDtmxmono0tptomfeiysfm2rlu s u) rtrxf totlmD anei () exr(r nu4lp nmfvt (  Drmurpoo0tptnmieiltfaDumnvs;t4 etnxo ta1omteau o t t2toir no4ope miesas)srrrumonu1teenmoeiltfsDelnmo u4 exrif oadoptrln o;s0 2uo(r3iydomtelivil()arrr( p;u1aetnmictat mDuln o;u0 etoif todlmDrlneo;s texr(r3io1llt mivtlt)s2tmxrpot4tpxnmi3iasla2umn pn(4tltoxf3ia1fptr ies;t0teumir iy4alenlfctasf rtmx oou0optomi3iysla rauvon(4areoif3totoa elneo;t sexmir iy4op   feilt sDtm(m no1oeto fetld sDraumon(4arerif iotomDe nvi t srxrxr3ny1lm  mfctas)a2taxmoot0aptn fciytlm uanvsn(0 etniociydfm  ai s;t)t2to(m3nodlme  ieil() 2uax  ;o4texo feilslm ea(mo;t)texnio ta1lmDr i s (  eumio iy4am nlicil(f Dtr( p;o4optnifeilsla2umuvo () rerxr iodomtelneilt srxmim oo1lpee nvtls)a2tmxmp;t4tpe  i3iyt mDean pn(4tlerir iytfp e nei;s)srtoxm3iu4amt lfesat) rumur ;t0oleomoctaslmDum(mpnt0trerio3ta1oat lnvi s srtmxr iu1olt  nvsa(farur( o;o0tlt  f3iyd s eluvsn(0 ltrxo oodlat  nes;(0s2xmim3ny4ll  mfet t a2trxrpoo1alxoifetyt a2umuvp;u) etnxr3ty1lm e ueo
\ No newline at end of file
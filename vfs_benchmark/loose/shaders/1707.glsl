@@ -0,0 +1 @@
+neo;t texmio oo4am  mietlt)a2ururont4tlen ieilslm ra(mpnu) eerir3oydfa   u s ( s2umiopoo1lptnmivtls)srta(  ;u1tlxomoetys sDea( p u4tlenmf oytfatranes t)teto(r oo4omtnlfeiatfaDrmx ooo0aexn ociydfs2eaums ()tlxomr3oa1oa e iei;t0texoir3iodlmtnmictat)a2trxmooo4ale ii3iasfsDeau on(0artnio oadom ean ols0 exo(r3nu4omeemivt (fs2ta(rp;u0apxoii3ias s ean s;t4teeoirciydfmDe uvi t texo(opiudole  nct (farumxm ot4tle  fciadfmDumuvsnt)aeerifctydopDrai il(  eto(r3oy1am e fes t)arrm(mpno1olx  icias sDulump;u)tlxrmf3iy1latr i o s tetr(r iudlm elivil()a2rm(r no0tlxniiciatfm2rauvp;() lxomrcoadlmt au i s t2ur(opio4ap eliei s)a2tmxm ou4apt  ietadla elnvs;t0tlxnxo oatfmDrlueils0srxo(mpiu1ale livi t arrru onu0ape moctatfa ean o;t4texoxociatlm eaueo;()srtoxopiy4ll nmieiasfs2ra(rono0aex iociadla2uan s;()aeenmr ia1lpD ai o t0s2tr(opnydamtelnei s)sDua(mpou0tee io3iatlmDum(monu4tlxnmo3to1oa rln slt t2toxm3oy1omen nviat) rta(rooo1optn icilslm ea( s u4tlxrxr tytlpD lues t0trxmim3oy4altnlics tfsrtrxm nt1alenii3ild a emnms;(0aleoir3ia1fpteluvs ()texmxopiu4ol   nes ( a2rax pno4oetomoetlslmDua(mp u4 ltnmrcootfaDeauei ()s2umiopoy4olen nci s srur(m ;u4olxnii3iaslaDuln p;u)treoxfcoydlp elu i;s) 2toxr3iu4lmt mnetasf rtau pou0tpeomicilt m2um(vs;(4trxoio3oadfptr i o;s)sexm(mpoy4open ietlt) 2tru  no0olxnmf3tls aDumumo u)arxoxr iotfmD  u i;() rxoxr iu1ol  mnetas  rumxroot1tptnmo3ildfs2rluvp u)tlxomf3to1oatelneol( trum(opio1amtn nct t)s2trxmpot0tetn ieiltls eauvpnt)teerir3oytfmtrlueolt trxmxopno4ome mivi t sDtmump;t0aleomi3iydfa eauvo;u0 lxomr3todlatelu slt)sruoxrpiydapee ncils  Drmu o;u4tpeo fetadfaDel(mo u4altoif oo1fmD  i s;s  etrxopoudlpt lncsl(  Dtr(mp;u4opx mfeiyd s eau o;t)alerio3io1fpDraivo;( teuoxm io4lmt mfvta(faruaxrono4tptoio3iltla elnms t0arxoxo3todlmD aieslt)sexoim3ny1lme mietlsfarra( ooo0texnmieiadfs2eanmp;(4treoio ta1op raieol()sexoimpiy1aptelfvilt aDua(rooo0altn i3iytlsDel(ms u4 rxoxfcoo1laDrlivilt  etrxr3nudaltnmnesl(fartr(m ;t4oeeo fciytfmDrlu p;(4 leoxocoadoate u i t)srum(rpio4lle  nvtat) 2tmxrooo4tpto icils s2rlu o u4arerxo3tydlmt lu i s0s2um(opno4lp nmfvtas aDtau o;o4aleoioetyt aDuln o;u4trtoxrcto1fate ues;t)teumim oudlm nmneta()srum( oou0tee mfeiyd a rl(vo u4 reoxr3ia1op raivils) eto(m oy1opeelfct (f 2tmxmo;u0ole  o3iytls2emnvp;u0 rtoiocoydlaDe n s;() rxoxr3iudlmt  fcs ()sDtm( o;t0olxn feiltfmDuluvpnu)arerirciodfat  ivi;s trxrio nu1amtnmivtasfsDumumpot4tpxomietldfm2emnvp (4 etrxr3ta1op   ues;(0teto(opoy4lptelfcils)aDuaurpou1tpxoii3ilt sDul(vsn(0aeeomocoodoa elnvi s0s2trim io4apee fesatfsrrrxrpoo4aeto ictltfm2rmuvsnu0 exrir iotomDrlu s ()trtrio3nydlptemnesa()aruaurpno0tleo i3ias m2umuvo;u0 etoio3iytlptrli s ()seuo(opnu1op nmncs (f Dra(r no1opx ifciydlaDrau p;t0arxoxo3oatfpte ieo (0srurir nudal nlnet t)sDrm(m no1oeenmoeild m2ulnmpnt)artnxr oy1fatr nes;s)s2umiopiy4ll e fvtatfa2ra( p;u0tltnmicildla uanms u)tlxnxr3todomtrai i t trtm(r iy4op elnvt tf rrmumooo4opxnif3ildlaDumuvo t0aeeoxrcto1op  lies (0texoxrpoudom e netl()arururonu4tpxniictys m2eau p t0texrmfctotfpDean i;t)s2xmxopiydomenlneiasfaDrruro;o1olt mo3iyt s2uluvpnu) ltnmocoydop  lieo s) eumir iy4am  lictlt arrm(rp;u0oexn ietlslsDuauvs (0tlxomfcoy1oaDr u ilt t2trxmpiudomenmicil( s2ur(rpoo1oltnii3tlsfs eau snt0trxnmo3iadfm eai s t  euo(mpiu1omtnmivsa(fsDrrxrp;t4opx iiciadfs2umu pnu)artomr3iodfmDr n o;() ruoxmpoudomee nvsat a2truronu0opxoifciltlaDul( pnu)tetoxrcoy1fm eaies t seur(opiudap n ict (fartaur ot0apx  oeiadlaDrlums;t)tlenxfcoo1lmDr i s t)s2xoir ou4opt mieia() 2tm(monu0ape  fciatfs2em(mp;(0tleoxf tytfpDr u i;(0sexmxo3nydlle lnct t)srrr( ont4tptoioetatfaDran on(0aeeoir io1laD lu s t)teur(r3io1altnliciat s2uru  ;o4tltniieias a2ul( s;t4trxrir ootomteln o ()trumxo iy4lp  mfes s arur( o;u4alt mf3tysla2uau s;u0tleoxr3iy1lm   n slt0srto(m iydol emnvias  Dum(m ;t1opxnifeiltlm ran s u4areomo oatoatr uvi s0teumim nodap e nesl() rtrxm ou0aptomoeiytlsDranvon()aetoifciy1op rlnvolt0 2xoir3io1ap nlfcils artm( poo4aee ii3iytls2ranvo ()aexomr3iy1omtran s t) exoxo no1ol e ics sfs2rr(mp;t1tpe mi3tldls um(vpnu4altrir io1fmtr nei;t) rur(o ou4amte fvi sf rrax pou1apxn feildla2eluvp;() etomf3io1lpDe ueo t)trumxopoudalteliesat arumu o;o0opto iciatfaDra(vo u)altrmf ootfaDr u s;t  rxo(m3iu4olte ivtas  Dtrum nt1tet ifeiytfmDra(mo ()aexnmo tydfp  aivi (0 2urim iu1ale  iviat arra(  ;o1tlto octltla em(mp (0tlermocoa1fate ies;()srtoir3oodome  ieilt  Drr(  ;t4oleo o3tytlsDrmumonu) etnmf3oydlpt  uvs;() exo(m nu1optn ivt (  2rmxmooo1aex iietldfa ul(vp u4tltrxo tadfp e ueo;s texrxrpno4ope mivtl(faDumxm oo1oexn oeiytfsDrlu snt0 rerifciadlpD au il(0srxm(o oy1omen fvs t aDur( poo4texn iciyt s2emuvo;(0aeeomf oodoaD  ies;t0 etmim3ou1olenlnvt s)s2ua(mpnu1openmi3ilsla emn onu0tltnxr3iytlp eai o (  exrxm3ou1ame mietl(f Drr(m ou0alt moetlslm rlums u)alxomr oytlp elneo;t0t2uriopno4aptn ivilsf rra(  nu1altoifeiys sDum(ms u4trermrcootomD ln i;(  rxr(r oydlp   icia(fsDuru  ;u4oex ioeils m2eanmpn(0 exrmocoy1lpD luvi s0 exr(r3io1lleelfvi (fa2raxmono0opeomoeildla um(mon(0alenmo3iytfpteau i;t t2xmio iydaltnlictatfs2rru o;o1ale mociys mDumnmpnu4 etnioctadlpDr i i;() rtrxm ou1lltnmfviat)s2trumpoo0aee if3taslsDuauvsnu)trerifciadlmt livsl(0trxoxrpnydapt mfct s)sDtauronu1oexoifcilsfmDumn pnt) lxoxr3oadlm eau s (0 eto(r3oydlptnmivtl()aDrrxmpou4oeeoiietydlsDuanvp;u)texrxo3oy1om r uvol(0 euoir3iodaptn fct (faDta(rono4tlx  o3iys mDeauvp;t0artnmo todlpt anvsl(0t2tr(opnodaltemfei (  rua(  ot1tleo i3iyd m2el(ms (0teermfciodlm  ln o s0s2umxr oy1amte iesls  Drau  ;o0alxo fciltfsDelnms;t0 etrmo3tytlp elnvo t s2xmxmpiy1ol n fvsls)srtaxmo;t4teenii3iltfa uln ont4aleoio3tatomteaneilt  rxmio oy1om  lfctl(fa2urur ou4aexn feilsfmDel( o t)aleoxr tadfpt  ueo ()texmxm3oy4ap   ncia( a2rru  no0aexo ictadla2ua(vsnt0arxrxrcoa1latrluei t texm(m3ou4apen ncs t)srrru p;o0tee  o3tydlsDemums (0tetnmrciydoaD auvs t0 2umio nudlm e fvtasfs2trxmpou4apeo f3tadlaDeln pn(0 ltrio to1oa rln i;( trxo(r3oodolen fct t sruaxro;o0tlto ieiat s rl(vp t)aexnir ootfpD luvs;t trto(o iudlp e fvtls sDtau ooo1oetnmictadlsDelnms;t0 rtnmo todlmDe i s;s0t2tr(m3iy1am n nci tfarua( p;o4oexomietltfmDul( s ()alxoircoa1oa rlnvils0 2tm(opio1lltemfcils)a2rr(m ot1teeoii3iytla uluvo u0arenif tatoat ln ilt  rurim3nodomtemnes s) 2raump;o0olx  oeilt a umn p;u4texrmr oo1fm e ieols) 2um(m iodlle  fvia() rta(m ot1aeenmo3tldls2ranvpnt0 exoxr oadfptelneols0sexmir nudapt  feilt sruru o;o4aptnifctls m2umu s;t4 lenxf oydfmD au o ()trxm(m oudomtn ivsatf Dtmx o;t0oeen f3iad aDum( on(4 eenmo oydoatrlivo;( s2tm(m ou1opt mfetlt srumu o;u1open ieiad sDelnmp t0tlerxf iodlaD aivslt0srur(mpnu4op  mnvsa(fsDrauront0alto feiysla rlnmpnt4aeeoxr todomDr u i t  2tmimpno1aptemicsat)a2tmxmpnt4alxo f3ild m rmump u0 rtnifcootlaDranvo s trxmxrpiu4ll nmfetl()s2taxmp;u4oexniieildls em(mp;t0alenirctodfa   ivi;()srum(o3oo1lmtemivtat)s2uauro;t0alen ieiyt mDumnvsnu4arerif3ootfa rau o;t0 2um(m nudol e iesas) Dua(mp;u0alxomf3ilsfs2ean pn()tltoif iytlat  i o ()seurim3io4ll n fvtlsfsDtmxrpnu0aptomfeiatlaDumu o (4 lxomf3iotfptr ivi;s  eurirpnu4ol   fesat arrm(mp;o0altniicild aDemump (4artomrcoatfmDe nes;t trumir3oodlpte iesatfs2urur no4tle iictadfs2rmumpnt4 rxnxociadfaDraivs;t  2tmxo3iu4ol emfcsasfa2tm(m no1openioctas sDul( p;u4tlxoir ia1lptraivs s0 2xmirpiodlleelfvi t aDurxm ;u1alxo o3tat s2uaumpn() exnxf todfa  aues s  2urxo3oydameelfvs (f rrru pnu4aptoiiciadlmDuauvo (0texrmf3totoaDr n i () rurirpiu1apte feiasfsrumumont0oeeniociytfm uanvsnu4arerxocoydoaD livs;s)trtrxm3nydal elfesat s2tauroot4tetn ieiysfsDrl(vont0 reoxrcoodlm rlneo;(0texmxo oy4olenmfvs () 2taxmp;t4opx mfeild a2uln snt0trxomrcio1lptrlies;(  etrxr oo4lm nlnvs t  rua(rooo1alxomfeiaslaDuan s;t0trxrio totoa e n i;( s2urxr oy1ol nlnetlt a2raum nu4tpxomf3ilslm umuvon()arxoio3io1oaD lneilt  rto(rpno4omt micsl() 2rrumono1tpt  f3iys m rln s;(0tlenxociy1oat  uei;s0teuoir oy4op emfctls)arrrum ;u0texn ocildfaDrln snt)texrmocoytfa r n i;t  2xmxm3ou1op  mnci s)a2raur ot4aptomoeiasfs umn pn(0 ltnir ta1oat lueols0s2umirpou4amtemfet tfa2truro;o1aex mo3tysfaDeaumo;(4 eenif oadomteliei s) etmir3iy4lptn ici ()srtm(r ;t0tlxo ieiltfa2eau o;t) rtomr3to1laD  ivo s0srum(r oudap  lnvsas arurxrooo0oleo ociadfmDra(mo t4alxnxr tadop e ieilt) rto(m oo4lmenmfvsls  2uaxront4aeeomoeiydlaDrl(ms ()trerxo3oydlmDranvils0sruoir3iy4llen nvtlt  rtru oot4tpenioeild mDrmn s;u4tltoxf3tadfm eauvo;()t2xrxmpny1amt mnetas)sDtaxmo;t1oex io3ils sDrau pn(0alxnircootomt livs t)sexmim ny4ol nlivi (fsruaurp;o0apeomiciltlm2emnvpnt0teermf iydfm  lueils trtr(mpoy4omt mfvt s  rrm( ono4tpe iieild mDrlu ont)teeomrctodomtelnvs;(0seto(mpoo4lpt mfesa(  rrr(m nu4tex iictld s2em( s ()aetrmr iydfm raneo s trxo(rpoydalt lfeta() Dtaumo;t4aet io3iytla2um( p;u4 rtoxo oytom rai ol() rxmim io1oleelfetl()s2tax o;u1opeomoeiytla2ean snu0 ltomo3oatfpDe ueo t) 2umir ny1al n iesat sruaumpno0oee  fetyt aDumn sn(4treniocoa1fmDe ies;s)s2umxo no1ll   fct (fsDrmx onu4oex ifeias m2ulumo t4 ltoxocty1op  lnes;t  ruoxo3iudole licslt)srumumo;o1tleoioctltfa emuvonu4 lxnif oatlaD auei;t0 eumxmpiodamt lnctat arrmxr ;u4oeenmictltfsDemu pnu0texnmr3tadoa ran i s)trxrxopiy4am   ivslt)aDrauront4tpe ifeiys a2emnms t)alenif3io1fatr ivs (0t2umxo iudll nlfviasf rtr(moou1tpx mfetlsfm2rlnvs (0 exoir3iatlmt  u i t)teur(r3ou1lmtnmicta(  2rmuroot4olxo ictydfsDeauvpnt0arenxociadoaDrauvo;(0teuo(r3oudop nlivsa() Drmx ooo4openioctydfm2rlnvpn(0 reomo io1oate uvi;t) exo(m3nu1lltemieias)artmump;u4apenmo3iltfs emnmo (0trtomfctotfm e u olt0 rumxr no4lpe  fvs (fs2rrxrp;o0tpx moeiysfa2rmu s t0tlxrxrciytfaD aivils t2xm(rpoo1om nlfei t  rur(m oo1oeeoifeiyt m2ulu pnu) rerxo3oodfp  auvils0srxoxmpny1op nmnviltfarururoot1tlxnifeild aDra(vs t4altnmr3oytla  an s (0s2xrxm nydlle lnesl() Drrxmo;o1tpx mi3tytfa ranvo u4 rtnmr3iytfptraieils)setoxr3nydlmte fct () Dtrx oot1aexo ieilt a2uln o;(4treomfctytfaDe iei t0s2uoir nudol e fviat) Dtmxrpou1tpeo oeiadla2ulu s;(4trtoircootlm eauei s)teumim ny4ome mnviasfs2rmxrpno0opxomiciatls2rau p u0 rtrxrcoa1fm  ln sls tetrxopno1omtn fvsasfsDrax o;u4teto i3tadfa umnvp;(4trtnxociatlptrluei t)teuoxm3nydlmen ict ()a2ua(r ;t0ape mociadlm2ua(vs;u4alxoxr tatom eluesls0 ruoirpny1lltemfviltf rumx ooo0oltoifetlt sDua( o;u)tetrir3tadlmDrlneolt) 2tm(r ny1al nlfeils a2ra(r ou1apxnmietat m elnvpnt4aexnir3oy1oatr i i;t)truoim ny4lmt lnes s s2ta(m ;o0aleoioeils mDuluvpnt)aeeoio3io1fptrlnvi;( seuoxr iydopte fcslt)sDra( p;u0tle  i3tlsla rmu snt4alxomr tadom eaues t0teuoxmpoodolt mfvtatf 2raurp;t0tltnioetadlm2rl( o u0arerxr3oadlm   n s;()teumxm3oy4lpenmncslt  rraxmpnt1ope io3iasfs emu p;u)tetnmr oodlmDelivs;t0 etmim3ny1op emnetasfsrrmur ;o1opx iociytfs2rmnvp;(4 lerio to1fp eluesls)srtrim3oo4optn ivtlsfartrxr ;t1alx if3tys sDel( s;t0aeerif tadlatrln slt  rtr(mpiy4opeemfvil( srrrxm ;u0altnii3tlsfm2ean p;t) ltrxfciodfmt  uei;(  rtoio oo4optnlnvsa()sDtrxrpot0oeto f3iydfaDul( snt0arenxo3iy1oa elieo t setoio3no1lltnmncil( srumxmpou0tpt  feiadfs emumo u0alenirctatop  au o;s s2trim3oo4oltnmncs (faDtaurp;o4apeoiociysls rlu pnt0 lenir ta1lp ranvsl( srxoio oodlp  lfvi s artmumpoo4aleoifeilt s2umums;t)areoxr oytoatran s;s)trxm(r ny4lpe liviatfaDrm( onu0apeoiiciatla rl(msnt)tlxoxfcoy1fmDrauvolt)tetoirpny1ale  nvi (f rurumpnt1olx mietldfmDuanvp u4tlxnmrcoa1opte ivi;t setoxo ny4lmtnlfesl(fa2rmxr oo0aeeo ieilslm emuvsnu4teenio3todoa rauvols0srumxr iu4oleelfctltf 2rax ont0oltoiietad a2ea(von() leoifctytfpt livol(0s2xmim iu4optnlieta() Drrur nu0tle  o3tadfm um( onu4 exrxo3ia1oaDrlueo;(0tetrxmpiu1ame  neil( srra(  oo4opxnmo3tasfa2em( p (4teenmf3tytfa e ueilt)sexmir3ou4omtn icsa(f rtmxm ou4aexo ociatlmDuauvsnt)tlxoxo3oadfat  ies s)s2uoir3io1opt  ies ()sDtax ono1apeo fetad a2ean s t)tetrir3tatoaDran i ()t2xo(o iudll elictas  2rmx p;u4tlenii3tlsla2ulums;u4 rtoif3tatoat  n o;( t2xrir ny4lle lnci t  Duru  nu4tpx iociydfsDran o;t4trerio oo1oa  auvo;s)trtr(o3iy1alee iesasf rta(r ot1olxoioeiat m2umnmonu)tlxrmf iatlm rln ilt sexm(rpnu4lltelietat aDta( oot0ale moeiltfs2umn o () ltrif totomDeluvo t0teumim3iudop nmfctltfarua(m nt1tlx  i3iatls2rl(vs;(0tlerircootom   ivol(0 exmxm3ou4opt mnvi t s2uaxroou1tpt  fctlt mDemnms;u4aetrmociy1omteanvslt0truo(r io4lmte ivilsfsDrau ooo4apx iociltlm2rmump;t4tltnxo3iotlpD anvil( t2um(mpoo1omeemfvias) rtrxmo;u1aeen fctysls eln s;u)alxoifcio1faDrluvs;s setr(o ou4apte icslt  Drr(  oo4alxoiieiatls uln pnt0 lxrircto1oa  auesl( trurxr iu4oltnmicsls) 2rmx  ;t0olen ietltfaDranvp;u0 rxrir3tytlpt  nei;s0srxoim3ny4lptemivsls  2rrxr nu4olt ifeiasfsDulumonu0 ltnmr oydfa eanesls)t2uoir3nu4lm e icsasfaDrmx onu4tpxn i3ilsla uan s;(4aetrxf3ootlpte i ols trxmio3oy4opte nct ()s2tr(  no1aptomocildlaDea(vp (4trtomr oo1lmtr uei ()setrxr3oo1lp   nvsa()artaxmooo0tetniieiadfm elumo;(4tlermf3todopD luvi s trtoxopno1omtelnvta(  Dta(  oo4texniiciyd a2rm(vp;t0 lxrxrcoo1oaDeau i s s2uoxo3nodllte fci tfsDrmu ooo4ape iicild sDua(ms t)altnmr iy1omD  u s ()srumxr3no4opeemivtl( a2raxrpoo4ole  ictydls eau p (4alxoxr todoa   ies;(0 rxm(opiydal nmnes tfa2trxr no1tlt mieiad s em(vo;()aetrif oadfatelueo t  exm(mpiy1ll nmics tfaruaxrono4tptn i3iatfm eaums;u0altrmfctytfpt lneolt trtoirpiu4om emfcta( a2taxr nt4tlenmo3ils mDrmu o;u4 rtoxr tadfp  livs;(0trtoio3no1op e net t) rtauroou1aee  fcias a2uauvpnu)trxomo3ia1omDrlnvols  rumir iu1olte icsatfaDraum no1teenmietaslsDumnvp;(4texnio3oadlpDrliei;s0 2xoxopiydol   ivilsfarraurp;u4optniociltfm ul(ms t0alxnmf iotomtrln o s0t2xrxmpio1alen ietlsfarrrxro;o0tet io3tat sDelnvs t)texnmo tydlp eai i t0srto(mpnu1om   fvtas aDtmumpot1opx iicild sDea(vpnt) ltomo3oytfpt ln o (0s2umim3ny4amenmneslt arua(roou1ole ioctldla2emuvp;u0texnifciydopD lneo;(0setrxo oo1lm nmfctat) 2tmx ono4teeomiciatfa eluvon(4 rxrmo3io1oa r nvsls s2uo(m3ny1om emnctl( arra(mp;t4oltnmoeilslsDumnvo u4 rerif3ootfm e n o s0 etrimpno1om elivi s s2raxr ou1tlt moeiat a2emuvo t0aeeoir3iy1opteanvolt0 rumiopno4am  mfct t)aDtru pou4opt  feils sDum(vo;(0aeenif tydfmtelu ilt)trum(r ny4opte fei s)a2tmxmp;u4alenmieiltls2elnmont)tlerxocoo1oa rlieo s) exo(o3oo4apte ivtas s2umu  ;t4alenmf3iltfs rmums;u)tltnioctotomteai ols  etrim3ny1ll n ivslt) rrr(rpnt4opxoioctydfs2ua(monu0 lxrmo to1lp elivol( t2urxmpnodoltnlfviat)srra(  ;t1alenmiciadla2emuvp;t4tetoxf3iydomD  ueo;s  eto(r no1optnmnet (fsDrmxrpou1olto f3tld s2uan p (0tlermr3oa1fmDrluvi;( setm(rpio1am nmictasf 2uru o;t0optomfeiat a2ea(mp;u0texomr iotlp eaieols truo(rpiodape mfctlt)srtmx o;o0tle  f3ilt a ua( o t0trxnmf3iadlpDr nvs;s0srtm(r iodlpt  fvslt)a2trum ou1apeo i3iydls2el(vo (4alenifciatlat aieil()sexm(o3oydom nmicta() 2rmx poo4oexoifetlt m2eaumo t0 rxrio ta1latrau sls0srumxopou4ale mfvi s sDtrxm no4aptoii3tysfs2ranvpnt4artoxoctadomt livo t  2uoim oy4lle lnvias srrr(monu1apt iociasfa2el(ms t4aexnmo3ootfaD  neo;(0s2xr(o iu1omtelfvsltf rtmxrono4olxnii3tls mDean s () etrxrctydoatrlnvo;t s2uo(m oydap  mnci (f rrm(r ;t1oee moeild a rauvo t0teerio3ta1latraivo ()trxoxr iudopt  ietas)s2trx  nu4tpxn ietyslaDul( s;u)treomo to1lmDeln s t0s2toxm nu1lmtn ict ()sDrm(m nu0apx  o3iadlmDuau s;()trtnxf ootomtr nvsls0t2tmxmpoo1lm nmneslt  2uru poo4tex iociadfs ulu snt)trenmfciatomDe i ilt) rtmxo3oodoleelfeilt)s2tru  ot4apx mietat a2ua( p (0aexoio3oodlaDran i;( s2trxmpio1ll n fcsat)a2rax  nt0tltomi3taslsDrl(ms;u0alerxf3oy1fa r u ilt)seur(o ny4aptnmnvslt  2tr(r nu1aex  oeiyt m emnmsnu4 rxoir iodlmtrau s t)s2tr(m3no4lm e ietlsf rtmumooo4opxomoetad m rm(mo;u0tlxomf3ootomD  ivs;( s2um(r3iu4ameemfetltfarrrx  ;o4apxo f3ild mDum(vp;t) etoxr3io1fatr u ol(0tetrxr3oo4olt  nvta(f Drm( o;t0tpx ii3ilslsDean s;t) rtniociatomteaiei (  rtoim nodamtemiesat)srtrxmo;o1tpxo fciad aDua( s;t4tetnmo3oy1fpteli ols0 etmxr3oo1ale  ieiatfartrum nu0tee  f3ilt a2umn sn(0texrmr3ootfateanvolt) etrimpoy1apt mfvi s  rur(m no4tlxniiciatls umuvo;u4 rxrio oa1laD au il( s2ur(o3nydll   ies s a2urump;t1texoiociydfs2ea(vo;u4tleoxo3oy1la ean s s) 2xrio iodlme  netl( aDtaumoot1texoiiciatfaDrln p t) leoxo iatlmtrlnvs s0 rxoir iy1opte nctls)sDtmxmpot1aex mfeiydfsDuanvsn(4artoio todla  lieilt0s2uoio3nudamt  nvia( sDtaurpnu0tpt iieiadfs2umu snt4tltrxo ia1fp eln ol(0 rxrxm3iydape mnetls)arraxmpnt0alx mf3ild a2ran s;t4texrmo ty1lptrln o;s setr(rpoo4apenmnvia() Drm(roou0oeeo ociltlm elump;u4 ltrxo tytfaDeanvi;( t2xo(o nydom n ies s)s2tm( onu1tpenmictlsla2uan onu)trtnio3iy1lmD lu olt  rtoxr3ou4ape  ivtltf rra( oou4aptniieiasfs ra(vo;()texnxr3ty1fpD  iei;()s2um(mpoodaleemncsltf 2uaurpno4aet mo3iytfm rm(msnt)artoif3iodop  lnvi;t) ruo(o iu1ll  lieia()sDtrxmpou1tlt  ieildlm rm( snu) etrir3ta1fmtelnvs (0 2urxm nu1olen feta(  Dtmxmpou0tetn i3iyslaDuanvo;()alerxr oytom ran i s0 2xrir3iodope lieilt)arumu o;u4alen i3iatfa em(von(0 lerxr3ia1fpDe u i;s0trxmxmpoydlme lncsl(fsrtrurp;o0aleomieiytfaDeluvo;t0tetrio iy1lp  anvs;s  rurir oodamtnmiei s) 2rr(mpoo4tpt ioetlsfm2raumo;t)artrmo iotoat ai o;t)t2xr(o3nu1altnmfcslt)s2rrxm no1optnmfcilt mDum(vp;u) lerif3todfateanes s srur(r no1amt mici t)a2rau pot1oexo feiysla rm( s;t4 etnxf3tadlp raivi;s) 2tr(opiy1apen fvtas) rtaumooo4alxn oeiatls rmn on(4 rtnif3iadoa  anvi;(0trtr(opoudol nlfctl(  rta(mpot1oexn oeils mDeaump;(0 rtrmocto1fpDe ieils s2uo(r3oodope mfesat)sDuaxm ;t0olen fcildfa ean o;u4tleoxo iadfm elu s;(0 rxrxopiu1llen fesl()arra( p;o0aexomoeiydfaDrmu o u4artoxr3oadlaDeaivi t0srtrimpoodlmeemfcia(faDta( p;t0tpe iiciys aDuanmo;(0 rtoxf ty1opDrlneo;t s2urirpou1lltnlfvt t) 2rr(m nt4tetomo3iyt mDul(vs u4teeoirciatfpD  ueols)trxo(rpny4lmtemieil()srtmu poo4apenmoctatfm rmnmon(0tlenircoa1fpDeai sl( teurxo3oy1lmeelics tf rumumpno4tle  ictltls2umn p;t4 etrxociydfmtraieol()t2umxr nudll   nctasf 2truroou0opx  iciltfs2ea(mo (0altnxf3totfmD li i t0srum(r3iu1amen nvi () rrru poo4alt mo3tadfm ua(vont4altnmo iy1opD an olt0s2uoim iy1omt  ivs (fa2tmx  no1tpxomo3tat aDran p;u4trtnmf tytlatelu i;()seuoxopoo4al  lfesa(  2um(rpou1aetn o3tltlm rlu o t)trenmo tatomD li slt trxmxo oydllt lfes s)sDrmu  ;u0aeeo feiaslm emu on(0 etomr oadfp rlnvs s  exmxr3ou1op n fcil()srtm(moou0apx ifetld a umn p;t)teerxf3oy1fp eauvo (0t2uoiopio4om elfei (faDuaxront4aex  ieiatlm rl(mon(4artnif totlatraueo t  2xm(o3ny4ap nmfvtls s2rmu  nt1altnmo3iyt m2umnvs;u)texnxr oy1om  aues;(0teto(mpoodal n nei ( srua(mpoo1apx  fciysfs2ul(mo;t0texnxocoa1oaD aieo ( srtmimpiudoptemnvtl()aDta(mpoo4opxomoeiysfm ea(vpn()tltnirctydfp eli o t) eumiopnodamen neiasf 2tmxr oo1tptomf3iyd mDeaums t4treomfcoatfmtelnvils0seuoxrpou1apte nctat) Dra( ono1ape  o3tltfmDelu s;u) eeoio to1lp eaueil(0 2tr(o3ny4ol nlnvsa(faDra(r no1ope ifciysfm rm(vs;(4 leoif3iotopt luvo;s0 etr(opnydol elivtlsfsrrr(ronu4aex ioctltfaDuln p u0artrmrciadfptelu o;t0t2xrim nu4alee nvtl()a2rm(rpoo4tlto fcild mDulumonu0artrmo iadopDeaneol(  eurxr iodoptemfvilt)arta(mpoo1tlx mfciyd s emn p;t4 rxrmfcoatlatr uei;s)s2xo(opio4altnlivilt a2uax oot1tex mociadlmDrln onu)arxrio3iotoat ai o;t)tetr(opou1amen fviat) 2rau  no0tltniociltfa ulnvsn()aeeomfctytomDrlnei s  2trim3ou4lleelncil(f 2raur ;o0oltn ieiytla el( ont0aeermfcty1lp   uvo;()truo(r ny1oleelncsas)aDtau onu4aeen ieiytfm eln s u) eenio3iadopteaiei s0setmxrpou1llenlfeilt)s2ra(  nu1tlxnmo3iat sDuluvo u) ltoxo iy1lm e i o;s teumiopiu4lmtemiesatfaDtaxr nu0apxoif3ildls ea(mp t) ltriocty1omDrln i;s0texoim3iu4olte ivt (faDtruroot4oet  i3tlsfm2eanmonu0tleoxr oodlptraiesl(0truo(m3ou4lm nmnviat)aDtaxmpno0tpen ociydlm2rm( s;t4tltrio iatomtrlneo s0 2xm(r3ny1lltnlncs () 2tmxr ;u1tpeo oetydfsDrau p;u0arxomo totopDranvi s  rtr(opno4al elncil( a2ur(mpot0teenmfciltfa2ra(monu4tlxnifcoytfmtrln s;( teum(r oo4lltnmnvil()aDururono1oeto octldfs2ul(vo t)teeoxo io1fpt luvs;t) ruriopou1ameemiesas arraxrp;t4ale mo3iad mDua( snt)arxrxo oytoa e ues;t0 etoimpiy4llt  ncslsfartrxmpnu4tetniociadfm2ua( s;u4altrxr3oytfa r ivsl(  2xo(m io1op e feia(fsDur(ronu1ale ioeiyd s uanmp (0tetnxocio1lp e nvi;t) exoxo3oy4am elfvilsfs2ra( ont1oleo octlsfmDrluvp;(4aetnir3ta1faDe nvo;t)srtoim3iydam   fvslt sDrmur ;t4opxniictasfa2elnmp;u0 lxoir3oa1lm  ai i;s) etm(o3oydll e ncs ( sDrm(rp;t4opxo oetytla2ra(mo;t0alenirciytfa raieils  2urirpoydlme  ieslt)a2tm(r ou0tet iictaslm2rl( p;u4tlerircoydla rau s t)srxr(m oy4ol nmfcsat) Dumu  oo1altnmictls m2rmn p u0tetomo oytfa rai i t0 rxmirpnodll emivi (fsruru onu4aexomo3iysla rl( sn(0 eenif3tydfaD  ies ()sexoim oydlme lnctltf 2rrur oo4tptn i3iatfs2ranmo;u0 rxoif ty1latran il(0srtmxr3oudamtelivtlt)a2trum ot0altnioetlt a2emu s t4trtoxoctotlmtelnvolt0srxr(rpio1ome  net tfaDrmu  ot1tlxomo3iatlm ranms;u)artrio totlmDeaiei t)seumxr no4op  mfeta(  Drrxrpno1tleo i3ilt a2uau s ()teenio ta1opt aieo (0trxo(r3iy4ole  icils) rtmu  ;t1aet ii3taslsDeanmpnt0tlxrifciadopt  nvi t0s2xoio oodopee ietasf rtmx pot0oexnmfetlt m ran p;t4 rtrio tadlaD  u ol(  2tmimpio4opeelivtatfa2rrx  nt0tpeoiociydlaDra( p u)arerif3oo1lp eluvs t  eumxm iudlpe mnvslt arurxm no0alxnif3ild m umn snt4areriocty1lp rlues;s) rur(m3iu1omtnmieiat)sDtr(m ou0tpt mietld s rmn p t)arxnxo3todfpte iei;s)texoirpiu4ll n nct ()arumumpno0aexn i3tyd m uluvs;(0 lxnif3iadlaD au i t  2xm(m3io1aptn ivs t)sDurur nt1oet mfctysla2el(ms;t0teenir3iatoat an s t  ruoimpoudop emiviatfarrr(m nt0oex iietysfm ua(mp u) exnxociy1fpDeau o (0t2tm(rpio4opte neta()s2um(mpou4olx  o3iatfaDua(vo;u) rtoxrcia1latr ivi;s setrio3oy4opeemieia() 2tmumo;u4tex  fciyt a2em( s;u0aexnio3oa1omD an o s)sexrxopoydlltn fesl(  Dtr( ont1olxo feiysfs2rlnmo u)tetrxo3iatla elu ols0sruo(o nu4lp nmicilt a2urx pot1tpxo i3iadfmDra(ms t0aeerifctydomt  uvs;s0trxrio3ou1om elietasfs2umumooo1oeeomfeiatlsDra( o;(0aexomo iydfptelnvi;t  etoirpnu4ap elictl( arumur nu1aexoiociatlm ra(vs;t0 lenxociydlpt  i s;(  2toxo3ny4am  lfesatf ruaxmo;t1ape moetadlmDumums;(4tetoir3ta1fmtr u ilt  exrxm nudaltn neiltf Dtmuroou1oleniiciadls2rm(vo t0tltnxr3oodlpD luvsl( trxm(o oo4oltnlfei t  rum(mpou0alxoiieildlmDel(vpnt4teeoxf iotlpDelnvo;s texo(r ou1apt mietlsfaruax o;o1opx  ociyd a rmu o;t4aetrxrciotfptrau ilt  2xoiopio4lmenlfeta(f Dtmumooo4olx ifctyd sDumnvs;u)trxrio3tatfaDeaiei;t)s2uoiopiu4opt  ncsat) 2tax oou4tlx io3iatlm rl( snt) reoxocoytoaDe i ols)srxo(m iodomtnlnvi s)s2ta(m oo0olt  fcild s ean pnt0 ltnxr3tadlm r nei;t)trurxr3iu1lpt lfctltf Dtmuront4alt mictys m umuvs (0 etnmfcoytfmDelu s;t)srxmxm oodol  lfvt ( s2ur(  ;o1tptniietadlaDrlnmp (0 lxoxrcoatomt li o t0sexr(rpiy4lle lfeias a2uau  ou0apxo ietad a2ulnmp () rtoifciodoate nvsls srtrxopiudllee fct s aDuaxroou1oleomoctasfm elnvont4 lxoir oa1faDrai i;s0t2xmio3oydlpee fetltfa2raum no4ape  oetaslm uln p;t4aetnio3iy1op rlu ol( t2uoxr3nu1alt mfcslsf Dum( ooo4opeo ietasfm rlumonu4tltomfciotoaDraiei ( srtm(o no4am emfvt (  Dtr(mpou0altn i3iytls ea(mpnu0arxomr3iotoptrlueils) 2xm(mpno1apenmfvtltfsrrm(rpou1opxo fctatfaDrmn s;t4artrmr3iy1fm rlnei;( sexm(r3nu4am  mfcil(f rtru  ou0teeomiciat s2eanms;u0alxnio3oy1fp rlnei;(0t2toxopny1ape  icilsfsrur(m ;o4tpx iietytfa2ranmp t)aetrif3oy1lpte nes;s)srxriopny4omtnmivtls)aDrmxrp;t4olxnif3tasfsDrluvsnt0aeerxf tydlmDeanvi (0setmio iydam  mfvs t)artm(  ;u0tpeniieiysla umump;(4altnmf3io1omDrau il( setrxo3nu4olt mfeta(farumu oot1alxomf3ilsfa2el(vsnt4altnmo totlpD lieol(0 rxrxm no4om  lictls)arra(m ;o4olto fctys aDem(von()trermfciodlpt  n o;t)t2uoir3ou1lm nmfviatfsrtaurpot0alx  oeiysfmDrluvp;u0tltoxo ty1lm ranes;t0s2tr(m3nodlpeemnct sfsrtaumono0alt iieilsls eln s u4tetnxrcoa1lpt auesls) ruoim3no1alt mies t)s2trx o;u0oexnmietls aDul(vo;t4treoxfcoatlate uvi s  exo(r3oodole  iet () rtr(rpot0tltn oeiysla2rm(mp;t0trtomo oo1la r uvol()seum(r iu1op e fvt s)a2uaxmonu4aptomfciadfsDean snt)altnmf3ia1lp  an s;t s2xmxr3ou4omtnlfet ( srrm(rpnu1tpenioetltfsDulu s;u4texnmoctytlmtr n i s0t2tm(m3no4alenmnes (  Drr(m nu1olt if3tlt s uau s;t4 lxniocoy1faD lnvols) eumir nu4aptnlfet ()arur(m ;u1olt  ictld m2elnmo;(4teenmrctodlptraieolt)setmxo no1alt  ivilt arra(rpot0alen i3iytfa ea( sn() rxrxr3io1fa   ueo;(  2xoxm3io1lme  fvsa(  2tru ont1apxoifeild mDra(vonu)trxoif3iadlpD  nes;()teto(opiy1al  mieils)sDraxm nu1tlenmoetlsfaDrau s;(4teeoio3io1opDelnei s0srur(r3oy1ol e nvsl()arrr(rooo4alenmieildlsDean snt)arenxo iadla rln olt) rtrxr3ou1al  mfesat)aDrmumo;u1apx  oetytlsDeauvsnt)tltrxr oodfp ran o;s0sexo(m nudomeemfvil() 2urxrp;t1aee mfcildfaDua( pn(0tltnio iadfa e uvi ()srxoio ny1ope mnvia(  Drau  oo1aex  f3iytls elnmp u0 rxomf3iytfmDe ieo;t)s2toxo3nu4op  lfvt ()a2tru  nu1aeeoii3ildls emn s;(4 eeoif3ia1op ean i;(0 2umio3nu4lpte ictl() 2trxmpnu4alt io3iysfm2ran pn(4altomfctodoateaues t)s2urim no1lp e ncs t aDrmumo;u1tlt  o3ildls2umuvpnu0alxoiocty1lm   i i () exmir oodlpt  fct s  2urx  ot4teenio3iadfsDelump t)trerif3oatoat ai o ( s2trimpiy4lpee fei ( arta(ro;u0olxn ociyd aDrlumsnt4tetrmr3tatlptrlivs;t) 2trimpiy1op emfctls)aDtr( ooo1tlenifeiytfs el(mp;t)arxnir3iodlmDean o (0s2trxm3iu4altnmfvs tf 2urumpot0tpxnmoctysla2rauvo t4aetrxociatlmt li o s)s2tmimpiudamtelfviatfs2rmx ooo1opxniociat s2ea( s (0trtrmo todfaDe nes t t2xoxm3iu1lp eliesat)arumxmpot0opx ioeiyd s ean o (4 lenioctotfmDrauvolt  rumir nu4lmte fcsa()aDurxr ot0tetnmo3iat aDrmu snu) leomo oodoa e u i;()s2xmir3nu1al nlivtatfsDrmur oo4ape mociaslm2rln snu0tetnirctadlptr uvsls0t2xr(o iodll elnci ()srum(m ;t0tetoif3iat s uau p;() lermf iodfmtrlueolt)s2tr(r nu1lm  lfvias aDtru oot4altomiciad s2ra( snt0 rxrxf3ty1lat auvo s0 2toxo3nu4optemfvsas)aDurxrpnu1teeo ictydlm2ulnvsnt0trenio iodoaDe n s;s0srto(rpou4ap n fvtat  rtr(m nt0ale io3ils a2rl(vp (0artoircty1laDr ieolt)t2xr(m iy4ale  nvt s)a2umu pou1open i3tysfsDuaump t)aetomfctytfaD lu ils)s2to(m3oo4ale licsat)srtm( onu4opx mf3iysfs2umumo;()artnmfcty1lat ln o s  exr(o oodope lnesas  Durumoou1olxoif3iltfa uau o t0tltnmf3ta1fm e neolt)trtrxm iu1apen iesls) rtau ooo4aexomf3iltlmDrmu o u4 rtoxf oadlpt auvslt0sexrim3oo1lme lfvt s)arraxrpot4oleo fcils m emn sn(0 ltrxfciodopDrlnvi (0t2triopoodll n ivsltf 2trxmpoo1tlx  f3iyd a rlumsn(0alxoircoadoaDelueilt)srxmirpiodope mnciatfaDua(ront4tee ii3iyslsDrlnvo (0areoifcoodfaDelneo t)t2trxm3oo4lpen ici sfsDtr( poo4aeenioeilt aDul(vo;u4altoio oadlpDrluvols)s2xoio ny1ll nmiesl( a2rr( onu0teenii3tydfa ulnvp;u0 rtnxr3todfmD lues;()t2toio3oodolenmictls artmx o;o0tpx  o3iydfsDrmu s u0teeoxocoytlmt  uvs;s) exrxm3oo1am   ictltf rrmurono4oexnmfeilt aDem(mp () ltniocoa1la eaies;s0 rumimpno4apenmivs ( arum(moot0tet iocilsfs ua(vsnu0 eeomr3oy1fmt au o s  etmxo3oy4am nmnesls aDtru o;u0alxnifctls mDel( s;(4tlxrxr ia1fp eli ols sexoxmpnu4apt lfeia()a2rm( pno0olx  i3iasfa2rm(vo () renmocoydlmDr ies t)t2xrim iy4ol e ivslt sDtax pot0aet  ieilt mDem(vs;u0tlxoxf3totlatrli o t0s2xoiopnu1ol   ivtat  Dtmumpou1aetomi3tytla2emnvp ()tltnifcoo1lpDrauvil() rum(r no1ap  livtasfs2rr(mpoo0tet moeiydlm ea(ms;u0tltomr3to1latr nvo;(0t2ur(r oo4lptelnes ()s2rax  oo4aexnifcias s emu sn() rermo3ty1latr uvsl()trumimpny1lltelfvi t aDumum nt4optoioetatfmDuanms ()tetrifcto1la  livo;s sexm(r3iu4ome  fei s artaxm ou4teenmi3iasfmDumu p u0trxnif3oodfateli sl()teurim ou4alt  nci s)aDtm(rpot0oleomi3ilt m2ulums ()arxoifctytoaDrlnei s) rtrir iudal n ncs t s2taxrp;o1oexnif3tltlm2ulnvp;u)alxnxo3oydlm r n o s) eurirpou4om elfcslt)a2rru pnt4tlen fciyd m2emn pnu0tltriocto1la eliei;( teuoxrpny1lme miei t)a2rm(  oo1apt io3tltfa2eauvo t4 etrmr iy1la eanes s0teum(o3oy1llte nvtas)artmuro;u4aetniiciytlaDemumo;(4aexnircoy1lmDe uvilt t2umim iydolt  ici tf Drm(moot1apeomf3iat m elnvs;(4alerxo oo1omD auvo;t t2um(r3iu1ol  mfvi (f Drmumpou4aptnifeiad m uln s u) exoif iydomteluei;t t2ur(rpnydll  lfvia(fsrrrxro;u0tlxo fctas mDemums;(0arenxo3ty1fpDeln i;s) 2ur(mpoudap   iet tfarraxmp;t1apeomieias a2ul(ms;(0aetnxr3oydlaDeau olt0srumio3iodop nmieia(f rrmu p;t0aexomfctltls2um(vs t0 eeoxf iydfpDe nvi ( tetriopno4aptemfvs tfaruaxro;u4teenio3iatfsDrm( pnu)alxnmrctodfm e ivslt)sexo(o ny4lpte icsa()s2urx pou4apx mociatls2ul( p;t0texnmr io1lp rlueols  rtrir no4altn iei s s2um(mo;u4oleo oetltla2ul( ont)artnxf oo1lpDrau o (  rxmio oo1am nlfetl(f 2trxmp;o1tlxnifciadfa uluvs;()trxoiocoadfate ivi t)s2toxr ou4amtelfeslt) rtmxr ;u4alx  oetasls2ea(vsnt)tetnxf oy1fatraivo;( texmxm ny1apenmnvtlt) 2rmx  ;t1aex moeiyt aDrluvo;t)tetnxociodfmte ivol() etm(mpnudlp e neil( a2uru poo4teto o3tls s el(ms;t)tltnxrciatfp  auvo t seuoxmpno1amt liei ( a2tm( pot0aptoiictytfmDum(vsnu0tetrio oy1oa  auvs () etrirpno4opt miciat srrmu p;u0tleoiociys m eanvs (0tltoir3oatomt au ols teumio ny1lpe mietatf 2rm(mpou0tet mf3iys m rau snt4 lxoxf iy1fa   n i;(  euoir io1omenmies t)s2rmumpnt1apeo fcilsls uluvonu)alxnxocoytlatelueil()s2xrxo3iu1omtelncsls artru pou0opt  oeiyslsDumn o;t0tetoio io1lp ran o;s0 exoio iu4lltelivsls  rtr(root1tle mfciltlm rauvon(4 lenxo io1lp   u sls0 exrxo io1apeelieiat a2uaurpnu4apxn ictydfaDulums;u4artrmr3ia1omDr u i s) rtoim3oodol nlneia( srrru  nu4aetomo3tasla em(mp;(4arxrxr tatopDraneslt) etoim3no1lptelnvsas) rtm(ro;t1aptoifciltla ulumsnu) eeoxr3oy1oa e nesls setmirpio4al   fvias aDum(ro;u4aex ifctatfa2rl(mo;u0 eenircia1fa  livs;t0 rxrxmpno4ale mfvsls)aDtaumpnt4aeeo ocias a eln onu0tetnxrciadfmtr i ilt0 rumirpiu4al  mneia(  2ur(r nu0opt  fcildfaDranvo;(0altnmr3ty1laD  n i s sexr(m3oy1amen fvt ( srrru  nu4teeniictydlm ul(msnu)alxrmf3tatlm e u olt  2tmxo ou1lm e ict ()sDumumo;t1texo i3iltfaDem( p (4altoir tadom raues;s  rxm(r oo4amee ics t)s2rrxm ;t1oexo fciysfsDel( snt0areomr tydfm  aiei s)tetmio no1om emietl(fs2uaxmo;t1alt ifeiasls emnvp ()trxrifciotopDe nvo t  rtr(m3ny4llenmietlt  Dum(  ;t4oeto ietadls em( o u4trerio3iotlpDrlieols)t2tm(r oo1oltnmicsa(  2tmur ;u0oetnmo3iad s2uanvpnu0tlerifcty1lm  lieo t)trtrxr3nydopenmncsls artaumoot1altnifciat s2ul(vsnt)trxniociy1opDeai ol( t2xrxm3oodal n fes s)aruax ono0teenifctydla ua( s u0 lenir3iatlptr neilt s2xoxr nu4ap e fcslsfaDrmx oot0tpx mociytfa2um(vo (0 lxnmo3ty1lm   ivs;t sruo(r nu4lpenmfeil( a2rrurpnu4open ietydls2eanvo;u0aexrif3todfmtr iesls texmxo3no1opeelivsa(f rtm(r ;u4tet if3tls aDumuvp () rtrxo3oa1laDean o;( trxmio3oy1llt mics t)sruax poo1oetn ieias m rlnvpnu0tltnifcoodlptean ilt teuoim3nu1amt  feta( sruaurpot1opt ifeiadla2uanvp;u0 exnmfctadfmt  uvs s)truoir3nu4ape mfvsa( s2rr( onu0openmoeiyt aDrln pnu4 rxrmfctatfmtrlieo s s2xoiopiu1al nmnctat  2raxr ot0apxo feiytlsDuaump;t4 eeoir iytfat ai slt0tetrio3oo4apeelncs (fsDum( pnu4teeoif3tld aDeanvpn(4trxnmfciodlpDeau o;( s2uoim iudlltnlneils a2raxm ;t4apeoiocildlaDra(ms u4 ltoxf iadom   uvo s  euoio3oo4apeelfeia(f Drru o;t4apx  i3tlsla rmuvon() rtnxf3oy1oa ranvo;s0srto(m3iy1omte nviatfarrr(rpou4oetnio3iltls2ulnmpnt0 rtoxf3oatlp   i o t t2xm(r nu4lpt lnetat) ruax  nu4teeo fctadfsDumuvs u4aetrmoctadfmte i s;t0truoxm oodlpt lics t  rrmurooo4teenmieildla2ra(ms (0aetrxf3ootlmtr i o (0trxoxo3iy1ap e nvtlsfsrta( pnt1tltn fetltlm uln o u) rxriociatopDeanvolt0sexoxo nu4alt  fvias  rurxm ot0tlxoiieiasfsDuluvs;()tlermr3ia1op eaues t srxoimpno4lpt  fcsl()sDrm(r nu4texn f3tls sDemumpnu) etnif3totlmDrau i (0 rxmxmpiudlmtemics (f rumu  nt0aexnif3iasfm2ran o;t) rxrmo oy1omtr ivo (0seumxr3oydlpe lneilt a2trxr ;t1apx ioeiyt m2umnms u)alenircoy1faDrln o;t t2toir3iy4alee ivias a2umxm ot0oexoifctaslm um( p t0 eermo3iatfateli i s t2trxo iudal   ivs tfs2urxmooo0ole if3iaslm2eln on()trtrmf iotoate neslt0srtm(r3iu4omt lnctat) ruru  nt0alxoiieiatfa uau s;u4 lxrif iy1fa eai o ( srxoim3oodol nmivi (fsDrru p;t4oexomfeiydfmDrlump t) ltnmf tatla eli o;t0 rxm(r iy4openlfvta( a2ururont4olx  iciat a2elnvo u0tlerxr3tydop rlieslt sexoim3iudaptemfci tfsruau ont0tetnii3ilsls2uauvon(4tetoio iotfmDeauvs (0trurim3ny4optnlfesl(f Drax  ou1tetomoeiytfa emnvs;u4alxnxr3iadomD  uei t srxr(r ny4al emfctlt srumxmo;t0tetn octys m2ra( p u)tltoxo iatopDeanvs t0seumimpiy4lpen nesa(fs2raxm ot0olen f3iltfaDrm(vsnu0 eermf3ty1oate ues;t  rtoxopou4olenmfcia(fs2tmxm ou0tlenmo3tlt a elumsnu0 rtoxrciotomtelnvi;s)srxr(rpnudopt  fetatfsrtmum ;t0tlxn f3tyd s2raums;t)tleoxo oodoate uvi;s)t2to(mpiu4ap elnei tf 2urx o;t4tlxoii3ild m2ea(vp;(0 lxrif3ootla eln ils) euoxo3io1aptelfcs s) rrmu  nt1open iciaslmDumnmon(4teeoxf3oo1lmte uvi;t  2um(r oodlp nlivt sfaDumxr ;u4olx if3tyt s ra(mp;(0 lermf oy1fp eln ols  rtm(r iu4lpenlncil(  Drrx onu0tle if3tadfsDumnvo;u4alerxrcia1la r neol( t2toxmpoydameemieilt  Dtaxrooo4tpe miciad aDumnmon(0altrif totlmt an sl( t2uoim nydlmtelfct ( s2ta(m ou0aptn fctydfsDelnvs;t) exomrcia1oaDeau sl(0tetm(r3iy1apt  nctat arrru poo1alt iociytfmDua( snt4trtoxf oodfat liesl( s2tr(m nodom   ivtlt)sDrruro;t0optn oeiyt s2rau p;t) rxnmfcty1op raivi s sexmxm no1al  lnetas  Duaumpot0tpx if3tldlaDumu o;u4 lermo todfp  ln s;s0 2tmir3ou4oltnmfci t) 2rmxroot1tex  i3ilt s rluvp u4teeoxocoydom   u i t s2tm(o iy1lle lies ( aDtr(rp;u0aleniictyd mDua( o t0alxrmrciatlaD anesls) rtoim3iudol emfctlt srum(rp;t4ape  octytlm2ul( s;t4 reniocio1oaDrlu ils0seuoxopoy1alen icilt) rurx pnu0oleomociytfmDrmuvpnu4alxoif3oatomt  i o s sexmio3nodlptn ivi ()s2taurp;t0tlx mfctyslm eaumpnt)arxoxfcio1fmD aues t s2xo(m3io4lleemietls) 2urumpoo4openmoctlt aDeauvsn()arxnmr ty1lm r nesl() etm(r no1lmtnliciltfaDurum nt0ope mf3tys s rl( o;t4aeenmfcty1oa eaieil( trxr(rpoo4lp  mfvsa(fsrurump;o0opx  feiltls2rln s t)tltoifcoo1om  luvsl(0 exmir oy4oltelivslsfs2umxr no0aeeniiciatfs em(vp;()teeoxrctatfm r i olt) euoir oy1omte fvt s srrrxr ;o4apeomfeiysfaDra(mp;t0aeeoxrcoodlpt  nvsl(0 rtmxr3oo1omenlieilt)srtau  nu1opxnmo3iyd a2ul( s u0 rermr oatla   u o t teurxr io1lmt lnvtl( s2tmx  ;t0olen i3tyd a ean p (4tlxomf iy1oaDr n slt0t2tr(r iudalee fesatfa2tr( o;t0tptn o3iyt m elu o;(0altoif3oy1laD  nvs s0trtmio nydlmtnmnctls aDrr(mp;o4aptomfeiltlaDelumont)trxrxf oo1lpD  n ilt0sexoxo3oo1altelfcsat aDur(mpno4apt mi3ildlsDua(msnu0alerxo iadfatr u i;()srtoxr oydlm n fvils)aruru  ;o4aeenmfciytla2eanms t4tltoxo oytomtr uvo s0 2ur(opoo1lle lfvsls srta(r ;o1oetniiciltlm eanvp ()aeeomfciatla  aivo t0 rur(rpiy1ll n nvtlsfarra(mpnu0olto oeiad m2rmumo;t4artrirciadoaD  nvo ()s2trxm nydomtnlicias  Dtr( o;u1apxniocilt s rlumont0trtrmf3iytla raneols) euoiopiudlpeelnvslsf Dua(m nu4oexniictadfsDelnmp (4arxrxo oatla r i s () ruo(mpoy4lpenlnesa(  rta( pou0tleoif3tltfm rmn s u0 eenxf ty1lat anes s0teto(opoydape mnetl()srtmxr oo0aetnifetatls rl(vpnu0artriocia1fatran o s trtm(o3nydomtnlivs (fsrta(r ou4oltomf3iltlm2ulu o t0trenmo ta1oa elneslt0texm(opiu4lmeemncsa(fs2rr( pot0altn fctasfs rm( pn(0trxrioctatopDelnesl(  rxoxm3iydome  icsas)arurxr ;o1opxoioctyd aDumuvs;u4 ltnifcoatfaDelnvolt) rxrxopiy1oltemnci s  Dtaxr nt1oee ii3ils sDua(vp;u4tlermf iytom rlivs;t0 2trxo iudope livt tfs2trx  ot0oltn oeiatfm2uln s u)tlxoio3ootomDrai sl()s2urxm3oo1al n ictas aDtrxr ;o4texo ocildla umnvont0aetoxo iatlmDe u i t) 2um(rpoodom nlnes s a2tm(m ;o4oexn ieiyslaDelnmo u) rtnxr3tytopt aivol(  rtm(mpio4ope mnetatfa2ua( o;
\ No newline at end of file
@@ -0,0 +1 @@
+ieolt0s2umimpnu1llee nes t)a2raxmpot4aeenmfeiltla uanms;u0aexnxo3iotfp   uvs t0teumio nu1lpte ivt t sDuru pou0tpenmoeild a rmums;t4aexoxf3tatfaD anvs s  2um(rpiu4al emfei (  rrrx  ;u4aleoifciasfs emnmp;u)altomf3iadfaDrau s;(0 2xoim3no1apt  fesat) Draxmoou4apx  f3iydfa rlnmpn(0alxoxf oadoptrluvo t0srxoir3oodom elfcia(fsrtrum no0ope moetlsla2umn o t4alxrif iodopte u il()srurio3iu4lp  mivs t)arur(  ot0oltomi3iadfm2uln p;t)tleoxr3iytlp  aies;( s2xmirpnodlpt mnvs tf rtmumpnu4tpto f3ildlsDrl(mo u)trxnio ia1omt an o;s0 rxmir nodlmt  net sfs2urx poo4tet  o3tltfm ua(vsnu4alenmfcoo1fmDeluesl() etrirpoy1apeelfvtas)sruauronu1ope  i3tatfa2umu s;t) reoxf3tydfmDeauvs t0sexrimpoydaptnlncs s s2taxmpno4optnif3ilsla rl(mpn()trtrir3iydopDrluvols setmxr io1am e nvsasf 2um( pno4oltnmf3iatfaDean s;t0 exrmoctotop  liei;s0texoiopnu4lptelicil( sDtru  ;o0oleomociadfmDea(vsnu4 ltrifciotlaDeauei;()srtmiopoy1llt mietas)sDtmurp;u1oltn oeiydfaDuau o;(0aexrxocoodlaDrlueilt)setmim oudopt lncsl(  Dra(rp;t0oet  i3iaslm rlnms;u)texrxf oo1lpt lues;s tetrio3oy4op nmfeilt aDta(roou1aee if3iytfa uauvsn()teeoxr oy1omt  nes;(0 2xmirpiy1lp   fes (f 2umxrpoo0aetn feiydfa2ul( o (4 exrircootla eaivi;s)srurio oydomee nes s a2tr(mont0olx mieiadlsDelu o (0alerxf iadlp e n o;t)t2uoimpnydol emfeslt) Durxm no4oet  ictytfa ean s t0trxnmr3ootoatrli il()srtmir no4lle licta()sDurxmp;u4opx ii3iytlsDulnvsnu0tlxrxrcta1om  lueo t) rxrxrpiu4ol n ici s)arrm( p;u0oetomfciysfa ra(vp u0 etrmfcia1optrluvo;t)teuoxmpoydam  lieta()a2tmxmp;o1openio3ilslmDum(mon(4aeenxocoydfp  an s;t)trurir oy1lleemivs t  2uaxr oo0oleoifeildfm2uan o u) ltomf3tytomDeaues t)sruo(r3oudopeelieil()aruru  ou0optomf3iytfa2em(mon() rtrif3oo1lm elivs t)s2tmxo3nu1lmtelnvs t)srua(  ;t4tpto fctad mDulnmp t)areomr3todomtr u ilt  euoir ny4opt mics ( s2urx ooo0tee ifetat sDumnmpn(0 eerxo ia1fmt  i s t setr(mpiydll elnei tfsrrr(root4alx iieiaslm2umnvp;(4 reoxfcoa1lm r nvi;s teumio3nodolt  fct sf 2ur(r ;t1olenii3ils mDrm(ms;u) rxomr3io1oa eauvs;t s2toxm ou1lle mfvtasfarrru ooo4tlt  fcilslsDulumsnt0alxnxrcoydlpD li i s0 rxmir3iu1ap emivta(  rra(m ;t1opt ioctlsfa ean p;t0 lxomo3totlmt livo () exrxm io4amt lict ( srrax  nt4apxoif3iltla2um(mpnt0aexoir3oydlp  livs ()t2uo(opiy4lme mfvi () rurxrpnt0apxo octasfaDrlnmonu0arxoifcoy1op  aiesl(0 rtrir iy1om  mies s)srua(mono0oetn feils sDrlnmo;u4 lenmr iatla   uvsls srtmio nu1optnlivils)s2tmurpnu1oet mictldfs ea( snu4 ltnircto1om raivi;(0sexo(m iy4al n iei ()sDumx ont4texnmfeiad s2el(mont4tltrmo tydlaDrliei () exr(m nydoltnmicsat srrm(r ou0tetnif3iydfa eln o u0trtnir3ia1opD  nvi;s)t2xrxm3no4ol nlfcilsf 2taur nt4apx ii3tlt m emuvo t4 etrxrcoy1oa e ueo s)t2um(r3oudap n iesa(f rtr( ont1opt moeiyslm rl(vs;u4tltnmf iodlaD  iesls0t2tmxm3iy1opte ict ()s2trurpoo4tlxn f3tadfa2uaumo t0alxnir3tytlatr nvs;s sexmir nu4olt lict s  rtmxrpou4tpx mo3iyslsDulnvp;u0 rxomr3oatlptraivo;t t2uoxrpny1lp n fcia()s2rm(r ou4apto ieiltfm2uau sn()trtrxo3oatoptranvo (0 ruoxo io4lmeelfetls)a2ta( pnt4aleomi3iys a ra(mo u4 eenmoctodla eaivs;t  2trxr no4altelnvtasfsDta( p;u0olxn i3ilsfm2ean on(0tltoiociydfptraueslt) eto(opoydap nmivsat) rtru p;o0tpt ioeils s2ranvo (0 leriocoa1fm  aieo;s)srxmir3oodom   nviatfsrrmxm no1oltn fetltla ulnvp;t0aeeoxr3iadlm elnes;t  2xrio ou1openlicia(farurumoou4tltn feiydlm2ulnmp;(4 lxrxociytoaDe n o s)truoxmpiu1apt  iciat s2rrxm ou1alx mi3tytlaDuanvs;(0alenmociytfpDraivsls seum(r io1altelnetlsfs2rax  ot0olt ifeilt s ua(vsn()alenmfciydopDe ueslt)t2triopny4olen nctls)a2ta(m nt1apx  ociadlm2eanmsnu)tltrmrctytlpDr i s (0seuoim ou4al e fvi t sDra(  nt4oeeomociytla emnmp;(4aeerir oydfmDrlu s t teur(m iudol n fvil( s2tru p;t4olto f3tlt s2rmnvpn()tlenif3tadfp  lu i t0 rtoir3no4lpe lfvilt)aruru p;t1tltn icilsls el( s u)alxrif oo1fatr u o;(0t2xmimpio1apte ivtas a2trx  nt0tlto octadls uln ont)tlxomr3ia1fmDeaneo;( setoimpoo1lltnlneiat)aDur(mont1apeomf3iyd mDran p;t4 etrxrciodoate nvs t)texmio3nu4lmtn fvia()aDtau onu0oeenif3tld a2em(vs;u)areomo3iodfaD  nvsl() etrir3oudamtelfvt tfsrrmu  ou0tpeo f3tldlm rm(vs;u)aexnxfctotoatrlu sls teur(m nu1ll e ictltf Drmumpnu4ope ifcils m ranmp t)artoir3iadlmt aivs;()t2xoio io4op   fvtl(faDtr( ono4tetoiiciyd mDumnvont)trxomr3iadlaDraieolt  rumxm3ny4ll emicta(  rtrumonu4oex  fetyt s elnms t0alxrxo3tatla rliei;(0s2umxm3iudop   nviatfs2uaum ;t4alxnifcilsfa rl(vo;() renmf tadlp eaiei;s)teur(m3io1olt lieil()a2tm(r no4tltomictyslmDeanvpnu4 lxoxr oytoa rauvi;()trumir nudllt mneiat  Dum( onu4tex mfciyd s ulnvo u)altoif3to1oaDeauvs (0 ruoxo3oudlle lfetlt) Dtau pot1olx mfetad mDemn o;t0altrxf iy1lp  lnvi;t texmxr3iu4ll emfci (f rrrur nt0apen feiytlsDra( s;(0aetrxocootfm   neolt0s2xmxm oy4lm  mncsas a2umumpnu0oleomf3tysfm2rlnmo (4 lerif oatfp rluvo;(0 2tmxr no1ale lietls)arum(r ot1tetnmoctltla2uaump;t)trtnxr3ootom rau o;s t2umxm3io1lpt mfct (  2ra(monu0aptnmfetlt s rm( o;u)tetoxr ta1fp r nvs s srtr(o3iydope lfcsl()sDuau pou1tlt iociasls2rau sn(0tetrxr3oatoatrluvo;(0trurxo iudllenmiciltfaDuru o;t0tptn iciydfa2uanvs u) eenio oodlpD lu slt0tetoxo3nu1llt  fvt tfsrtax o;o0tetnmoetlsfm ra( pn(4tltoxr ty1om ranvi;s)trtr(o iy1olenmfcils sDur( poo4opto feils s em(mp u0tlxnircoydfpt anes;t)teumxr oo1lmte fci s)aDtmx poo4tlxoifetad a umuvs t)alerio tatfp e i i ()truoio3iudopte fetatfsDra( pnt0tpe if3iad mDraums;(4 exrmo3ia1oatrlivo t0texo(o3oy1lp nlnct s)aDtmx ooo4tle mo3tadls2eauvp;u4tlxrxrctadom rli ol( trtoio3oydamtn iei s)aDrm(  oo4tpxnmf3iydfs2uaump t4tleriocoo1la eai s t)teurio3io1op elfei ()s2rm(  nu4optnmfctys a ranmsnt0 reomf3totopt  i o;s)trxmimpno4lptelfeil()a2taxrpnu4optomi3iytfsDrmu p u4texoifcty1fa   nvo;( texrxrpnudlp  mietls aruau ooo1aeeo ieilt s2eauvsnt0aetrio3io1fa  lueo s)texrxr oy4altemfvias)sDrmxrpnt0oet if3iasla ua(vpnu0aeenmfctotlmDe nvils0 exmim no4amee ieia() 2ua( oou0aetnif3iasls uluvs;() rtoir3tadomD auvo;(  2toimpoy1llen fvs ()a2tm(rooo4openmf3tldlmDulnmo;t4arermr iotfpte uei;t)tetr(rpiydlmtemictasfaDur(r ;u0optn octltfmDuau on(0teenmf oytfmt li s;t s2tmir3no4amen neias)sDtmxront1oexomoeias s2um( snt4aeeoir3io1omt  nvolt t2tm(r3oydopen fcil(f rtmx onu1oleoif3ilslmDrmu s t0arerir io1opteauvo;s  eumxr3nu1om nmneils  2trurpnu4apeoifetyslm2ra(ms;u0tleoxrciodomte nvol(  exoio iu1omtelfet tfaDrmu p;o4tptn fciltfa umnvs;u0tlerxrcoatlmt lueslt)srumir nu1apeelncslt) 2rmxrp;o0ale  ietlsfaDrmuvp;u4areomo tytlpteai sls  rtmxr nydlmte fvil()arrr(  nt0opx mf3ildfaDemnvont4arxrmf oy1lm rlnvs s)s2xmxr3nudam   fvs t  Dtru  ;o0aeeomo3ilt sDrlnvo u4aetnxf3iydoatrai s;s0 exrirpnydame lnetas  rrr( p;u4oeeo oetydlsDumnmo;t) rerio oatlmD livi s trtmxmpoy4altemnvtl(f 2rrxmoot1tex  ociyd a2eanmpn(0areoxf3tytlate nei;() 2xrxmpio1ol nmnes tf Dur(rp;t0tetn ieiasfs2emums;u0tlxrmf oo1oa eluvil(0t2xoxo nu1ope micil() Dtr( ono1ape  o3iydlaDul( p;t0 exoxf ta1faDelu il( trto(m3ou1ap  mivsls a2um(  nt1ape  o3iysls eau s t0aetrmr3tatfp  auvsls) ruoirpiydole mict (fsDurum nt0apenmfctlsfaDua( s;(4 rxomfctydlaD lies;s t2um(o3nu1opt mfesls  Dtr( oot0tpeoifciydls em(vo t4 rtoxo3iadla e i s s  rtoxr iydlptemnes () rtr(r ot0aee ifetld a2em(mon(0 rxomocoy1omte n s;t0trumxo oydllenlfci t) 2rmxmpnt4texomoeiyt a2rm(mpnt) lxnxr3ia1laDraies;s0sexrxo iy4lmen fei ()artmuront0alxn icilslm2umn pn()aetomfcoo1fatranvs;s0s2uoir3oo4alt lfetat  rurxrpnu4tee ioctls a2rmuvo u)aetnxr3oo1omDran i s) 2xr(o iy4ll e ncsa() Dua( onu1tpe miciat m rmump u0aexoiociytlp   ieslt) exm(o3ou1lpe  neils s2rm(m ;t1aeeoif3iydfsDrmu o u0aeenxf3iy1laDraneils0 2urir nu1lp nlfctl()a2rmx  oo4alt mi3tysfa2eanvp;(0tltnif3ty1fm raueil(0srumxo3oy1olt lnvt t  rrrxr no4tee mfctlsfs rmuvo;t0alxnioctatfpteli s;() exoio nu1op nmivias) Drrxr ot4alxnmiciltfsDel( snt4tlxrif iotfm e nesl(  2ur(mpnudom   fesat  2raum nu1optomf3tad sDrlnmp u0tetoxo iotoat  i sls0t2tr(o nu1oleelnes (  2rmxm ot0alt  f3iyt a uanvp;t) eermrctatlmD  n s;(  rxm(m nu1omtelncs tfaDur(rp;o1olt io3tysls rmnmp t4tlenifctodom elivi ()teurxr3nu4amenlivsat a2rm(rpnt0oet mo3ils mDrau o () lermfcia1om eau o s)s2uoxm iy1oltnmieil(f 2umxr ot1aleoif3ildfm2emn s (4aexrxociotop e i ils)trur(mpoydolt  fvs (f 2tm(rp;u1apenmiciyslmDelnvp;t0 lxnxo oo1omDr i slt0s2xo(mpny4amt  fetls a2umxmont4olx  iciasfm el(von(4trenifciydfa rln s;s0texr(m ny4optnlivs (  2raxro;u1olenio3iysfsDuluvs;(4 lerxociydfm  anvols0 2tr(r nudop nmivsas)aDrrx o;o4aeeomicildfm2ranmo (0aeenxrctytlp  livilt0 rtoiopio4ol emneils)sDua(mont1tpe mietatfsDeln p;t0altrxfcoytoaD auvs ()setoir iy1lme  netl( artaum nu4altnmfeiltfaDumnvpnt)tleniocoy1lpD  i s;(  2xmxmpoo4lptnlietl( sDuax  no4tetnmocilsfsDul(mp;u) rxoiocty1lm  auvi;s)trxmxr oo1ap  lnes s) 2um(r nt1alt mf3tasfaDra(mpnu) lxnxo3todomDrli i;s)tetoxrpoudomtn fci s s2trxmp;u0aptomocildfaDem(vpnu)aexnxfciodlpD auvs;(0 eur(m oy1apt mieia(f Duaxmo;t4alx  o3iadlsDra(vont0arerir iadomt li s;s)srtm(r3iu1olee fvtas)a2um(r nt1tetnmf3ildls2ua(vp;()arerxr3ootfp eaies;t0sruoim3oudom e fes sfs2tr( pno0tlxn i3ilslsDel(mp;u0tetnif oatfaD  nvo;()teuoxm ou1ap   fet sfsrrauro;o4aeeomoeiyt sDea( o u) rxomf3oy1lateau o s s2xm(m ny4al emfesat)aDuru ont0altnmietldlm ulnvpn()tlxomrctotlate nes t) rxr(m io4am  lnvslt sDtau  ot1ape  octadla ra(ms ()treoirciytlpDelieolt0srtmir iu4am nlnvt t  2rmx  ou0optnif3iydla2umuvp;t)aetnio3ia1lmt lnes t)trtmxmpiu1opeemics t  Draumo;u4tee ifetys m rl(mo;t4 eeomocoo1oa  lnei s)sexmir ny1opt  ics t) Drr(rooo0ape  o3tysfa2uanvo t4arxomr totlate nvilt)texr(o oodlm   nei () ruru o;o0oet mfcildfa2emumo u0trenifctodlp eanvi;t srtoxo3no1olt mnei t s2tmu ooo1openmieiadls umnvs;(0trtnxrcoadlaDrlivs t)srtoiopio1amee fvi (  rumxront1oee  oeiatls2umuvp;()areoxr3iy1oatean i s  2xm(o iu1ap e feiatf 2truro;t1aeeoiocildfa2ua( s u0aetoir3oa1lm raieols) 2umir nodomeemici s a2rru ono0olto feilsla2rmnvo;()arerif iytfmDrluvs;s) rur(o oo4lleemivtl() rtrump;u1tetn ietatfsDuanmp;u4aetnif tadfp   u sl(0 rxmxo nu4ol nmfet s) Dtaur no4tlt miciatfaDul(mo t4 lxnmo3tydopD auvols  exoxmpoy4lme lfeta(fsDraum ot4opxniictydfm2um( o u4teenxo iy1fm   ivo;s)texoim3io1ameelnes tfsDtm(mo;t1aptoifeiysfsDrlnmonu0aetoirctytlatraieilt t2tm(o no1lpt mnvs () rrrxr oo1tpto ieiys s2elnmo;(4 rtnio tatfpD aies t seuoirpnu1olenmfcils)srrr(rpot4aetomoetytla ua( onu4 rtrmfciadfmDrai ilt  etr(o nodoleemfes () rrm(m ot4aet  ieiadfa2umu o;u)arenmr3to1opDe n o;()trxoimpoydlltemiet t)sDtmx ont4altnio3iatlaDrau s;u0 rtnmoctytfpDelu slt srtoxopno1optn fciltfsrrau  oo4aexo fciasls2elumsnt4tlenircoodopDrluvi t)t2um(o3no1amenmiviat)s2ta(m ;t1tlt iictytfa eauvp ()aexrif ta1faD  ivolt0s2trir3nudole mnci s  2rauro;o0tpenio3ias m rmu on(4 lenir oa1op  aiei;(0 2umxo3iu1ap  lietas)s2urum ou0tpenmieiadfm2ulnvpnu) exrifcootoptrlnvols)srur(opno1omte fcsa(fsDrr(root4alx  octadla2umn s;() rxoxf to1optean o;s setrxo3nydam n nes (  2tmuroou4oee ifciydls ua(vpnu0areoifctodfmtranvo;(  eumxopoy4omenlnct ()srur(rpou1alenmiciad aDra( o;()artnmr io1laDrau s;(0sexmim3oudapt  ieilt a2tax pnu4opxo feiyt m2ulnvon()trtnmfcoytfa eaueols  euo(m3ou4omt mfvsl()sDraurpnt4tptniiciytls eanvp t4aetomf3oo1fmDeluesl(0 2urxr iu1optemfct sfsrrrumpou0tptoio3tltls uln ont)arenmo3iadfmtrliei t)srxoir nu1ole  nvtl(  2rmx pnu0olenif3iltlm2ulu s t0 ltomf oo1lpDr n il(0 etrim3io1altnmneilsfarraurooo4tlx  ociasla rlnvo (0texrxfctodfm elnvols0trtmxo3io4lm  mfvtlt sDrmur ;t1oltnmociasfa ra(msnt4trtoif ootopD liei t sruoxm iu1lpee ivslsfs2um( p;t1optnmociyd s ul(vpn(4aeenmo3oo1optelu o ()s2to(mpno4lmtnmiet s arrm(r nu1opt micilslm elumpnu)arxrxf3tytfaD aueo;( t2tmxmpiodalte fvsl()arrm(  ;u4apenmfeiasla2ea( pn(0arxoifctadlate iesls0trto(m3oydlp emneta(fsDtmx ono0aee  o3iatls ua(vonu4aeermocia1optr nei;(0 euoio3iu1lmenmietl( srtmu pno4olt ioeilsfa2ea( s;t)tetrif3tytomtrlneslt0trumxr io1altelnvsas srrr(ro;t0tpx iieils s2rauvon()texnxrcoodlat aiei;()srxrxr3ou4lltnmncias)srtax  ou1tptoiieiydls emump u4tltnxr iadfa eauvo;( t2xm(r iydal nmfetas sDurur oo4tet mietatfaDumump t4trenmr3oo1fa  luvi;s) exmxmpiodlleemiviat) rrau pno4oexnmi3iyt mDul( s;u4tlxrxrctadlm  lnes s trtmxr3io4op emfesat srrau p;o4teeoii3tltlm rau o;u0 ltoir3oytfp e nes;t) rtoiopnodlm  lfetlt)sDurxmpoo1texoioetls s uanvp;t) eeoxo3to1fa rlies;s)s2tmiopoydaptnmncils aDrr(ronu0olenifetad mDranmp;(0teerio3totfa rluvilt)s2uoio3ou1lmte ivi s sDtr(roou1apt  o3iatls rmnvs u4 lxrifcoadla elivi t)texrxrpny1ll emivsa(farurxr ;t1ope  i3ildlmDea(vs;t0tetomfcty1omt  ivi;t srtm(m3ou4ol e fcta(f 2taxm ou0tpe  fetls a rmnmpn()tltrif todopDelivsl(0 exm(rpny1ap elivtl()srumxr nu0apx  i3tlsfa2umnvs (4 eerif oatoa   i i;t)texmxopno4om nlnctl()s2ur(mp;o4texn i3tatfmDrl(vs u4artrmr3ia1omDraieo t)s2tm(m3iy4optemiet (faDra( poo4ale ii3iltla2um(vs u)aexoxr oytlaDeanvi;s0 2uo(r no1amenmnvta(  2rmx pnu4apen o3tyd s ea( p;t)aexrxrctatfpDeli o;s0truo(o3ou1op nmfcsa(faDumumo;t4alenmoctad m2rmnvpn(0alenmr3to1lmt  uvi s  rurimpny4lpe lfeia()sDurum ot4apeomi3ilsfm elumo (0artnmfctatomDeaneilt) 2xrxrpiodap nliei s srum(  ;t0oexo iciatls2rauvpnt) eermr3ty1laD  n o;t)seur(opio4ome  ics t  rrrx pnt0tpe  feias a uau s;t0 renmfctatlp ean ol(0s2tm(mpno1lmenmfctlt)sDurxrpnu1texoio3tyt aDelnmo;t0tleoir iodlp r ues;s srtr(o ny4llt mnvil(fsDuauro;t4oee  i3ildlaDea(msnt)trtoif3ta1lpDr neil( srumirpoudlmt  netasfs2um(mpoo1apxo f3tat m2ul(mont4trtoxo3oydlmD lnvs t)trumxr iudome mfet () 2umu p;o1altnmoeiasfaDra( pn(0teerio oa1oaDe iei;()texo(m nydal elfes sf 2rr(root1opeo o3iatfs2el(mp u0tetoifciatomD luvol(0 ruoxr3nu1ole lnvslsf 2umxm no1aetnif3iadfs uanvs;(0alxrxr io1lpDr uei;(  2xr(o io4opt lieiasf rum(ront0tlxo fetatla el(mpnt) renxocty1oa  aieo t)setmio iy4openmivtlt)a2umuroou1opeo ietyt a2rmuvp ()tetoio3ia1lp rlueilt tetr(o3oo4lp   nvtatf Drrxmpnt1olx  octlt sDra(mp;(4trenmf oo1faDe ieils s2uoimpoo4lmenmneil()sDra(rooo4oetniieiys sDeluvon()trermr3todfa  ai slt)s2tr(opoodomt lncia( s2urx ooo0tlx  i3ild a ea(mpnt4altrxo tadfm ran ilt)s2xrxmpou4altnlfeia(fsrrmxrpno4alxomi3iatls ul(ms () eeomfcootlaDeliei s)seumimpou4olte ncsa(f Dur(  no1aet micils a el(mp ()aeermo3tytfm r nes;s) rumiopoo1al nmfeia(f rra(  ;t0oltnif3tas s uanms t0trxnxfcta1om  aiei;( srtmxm3nydop e fcsl( srtrxrpot4apen f3iatfm ua(mp (4 reomf3ia1lmDelnvs;t  rxm(r nu4lmeelfviat arrm(ronu0tle io3tld aDemnmsn(0aexoir3todopDrlieslt) 2xmxm iydllt mies ()arua(m nu4texnmf3iysfa2ul( p;() rxrxo iotomDrluvi;()srxmxrpoydoptnliei s)sDrm(  nu4apenif3tlt aDrauvp u)alenirciytoaDrauei s0srurxo nu4openmieslt  2raxmpnt0oeenmfeiasls2ul(msn(0 renxf3io1fat  n s s)seuoxm no1amtelfvsl(f 2ta( pnt0texn ociltlmDeaumon(4trenxr oa1oa  auei;s t2xoxmpoydom elictls aDur(mono1tpt  f3iadfaDul(vp;(4 rtnmfcoytoa  livsl( trtrxopnydlp emicsa()artmxmpoo1oex ioeiydlm2em(mp u0tltoir3tatlaDeaueo;t  exmxmpnudom  lnctas sDrr(r nu4alxn oetltfaDemumsnt) eenmr3todfm rau il(0texrio3iu4am e fvs ( aDtrx p;o1opxnmo3iydfs emu s t)texrifciy1faDeaneo;t0sexmim3nydamenmici s) Dtrxmpnu1olxn feiasfm2rmn o;u4artrmr3iodfptr u o;t0 2tmxm3nodameemfeils  rrr(rpoo0aetnifciydfsDranvon()tlxrmo3ia1fp  an sl() rur(m ou1op e nvs tfsrrmur nu4aetomo3iysfsDea( o t) lxnmo3iytopD li s t  2xo(rpou1om n ncsat) 2umur ot0tleo feias s2uln s;u0aeermo3oytfaDeluvs;s  exrxo3oodlm emiesatfa2tax  ;t1altomietld m elnvpnt0 lxnircoa1fpDeaivs;() rtm(o3nudalt mivi t) 2rrumpot0olx mo3tyt a ra( o u0tlxoiocio1faDeli i s s2xo(m iodomeemictas  2rmx ooo0opeomi3tyt sDuanvs u)tlenir3ty1fat lnvo;()s2uoxr iudome micia(f 2ra(rp;o1alx mf3ils aDrln onu0 rermr3tatlp  li i s)s2trir3nudlmenmnei s)s2rm(mp;o0texoifetasfs ra(msn(0tlxnmoctytopDelu s;t texmxrpnu1op n nctlt  rrmu pnt0tpto fetysfs2emump (4 ltoxo tytopDraies ()trtrxr iodlleelfvs s)s2umumpnu4oexomicilsfm2em(msn(0aetomfcoadfa elnei ( seurir3iu1lltn fcs (faruau onu4tlt if3iysfa umu ont0 rerirciatfa r nvs;(0 exr(rpoy4ol emfeslt aruaumo;o1oee ifeiltlaDrmu pnt4alerxrctadoaDe uei;t  etrxo3ny4ale mfcslt  Dua(ro;o0oleo feiydlaDulumo;u0aetoxr3tytla eaneo;( srxoimpiu1ameelnei ( srumxrpno1alx iociasla2um( p;t0tlerxr todoatran olt0 etmir oy1opt livsas)sDur(mpno0tet mieiad a uau sn()aeeoif3ta1opDelnvs t  etrxr3oydlmtemnvt s) rrau pnu1texo iciytla um(vpnt0tlerxo3iodoptrauvi () rxr(o3oy1lptnlnesat) Dum(m ou0tltn fctlsls um(vsnt) leomo3iodopt ai i s) rxo(m3iu1apenmnes s  2trxr ;u0oeeo f3iatfaDuanmo (0artoxr3to1oaDrlueo;t0 2um(o3iu4lleelfeilt  Dtm(rpot4tex mfeiaslm2umnmp;t0 rxrxrcty1oat ai i;s t2xmxr iy1lmenlfcs ()sDurxmpno1aex iiciys s2ea( o (4arenio to1op r i i ( tetmir oy4apt lnes t)s2trumooo4olxniiciat aDrl(ms t) ltnxf3iytfmt luei;t s2tmxr3io4al eliviat)sDum(m ou0aex  i3tydls2ua( pnt)arerxf3oodfmDe nes t0texmim3iu1aptemnesasfa2urxrp;u0tpx ifeias s eln pn(4texoxo3ootlatr nvo s) 2xmxo3iu1alt  net s artax  ot1opeo i3tlsls eaumo t) rtomo oo1latrlivilt0truoir nydol nmneiat)a2tr(moot1opto fctld sDemuvs;u)altrmr3iotlmDrai sls0seuriopny4ope  iesat arra(ro;o4tex ifctlt m2rmumont4 eerxr oa1fm ran o;(0 eto(opiy1ol nlnes sfa2tmumpnu1tpxnmo3tld s2ranmsnu0 leoxo iotla eaueslt0 eumxrpiydaptemiei tfa2taump;u4tetn fciad a uau p;t) rtomr3io1opD  ivil()trtm(rpnodaltnmnei tf rtaxm oo4apeomi3tlsls2rmumonu4arxomr3totlpt auei;s t2urimpou4lmtnmfcslt) Dumxmpno1aptoio3taslmDumnvpnu4teenxfcoa1lpteaivol() exm(m3iy1olenmnvt s srtmumo;u0oltniocilsfmDranmp;u)alxnxf3totlaDr nvslt)t2xmir oodap  lneilt a2rru p;o4tlxnif3iydlm2uln o () ltomr iodlate i sls0trto(rpio1lmenmfvia() rua(rp;u4tpxnmoeiad sDrm(mo;t0 exoxf3oy1faDeluesls  exrirpiy1lm nlnvsat sDrax p;o1aptnmo3iysls uln p (4artoxfciodfa elu s () exmim3io1ll  mnvs (  Drau  nu1oetnmocils m ua(vo t)altoxrciodlm r ueolt0 2umio io1lltnlietatfsDta(rpno0opeo fcildlm2ea(vo ()aleoxrcoatom rauvo s0trxmim3iodope mivs tfa2tmurpnt0apxnifcildfs ul(ms;()alenircto1oaD  ivo s0srxmxm iydolt mieia(fsrrm(  oo4apt io3iadfmDuaumo;t4 reomociatom raivslt0srtm(m3iy1apt lietlt sDumum ot1tpe  feildlaDulnmo;u0tlxrmociytfatr iei;s0s2ur(m iu4am n fvs t a2um(ront0tee ifctyslmDumn o;u) rxnxrcoa1fp e n o t  2xm(r3oodame lietat a2rmumo;u4opxomf3iytlm eauvsn()aeenif tydomDrlneo;(0t2toxmpou4oleemnetl(f rtmxmo;o1alxnmictldfa2uanvont4tlxnxfcia1fatraivolt  2uoio io4apenmnvt (  rurx p;u4tpx  i3iys m2uanvo u4 etnxo3iy1lpt ai olt s2xrio3oy1al  lieslsfa2um(moou0texoifetas aDumuvo;u) ltnxf iadlmte nei s0 2xoxm3no4lm nmfeta()a2rrx pnu1texnmfetldfs ulnvp t0 lxrio3ia1fptr uvi t0 eur(rpnu4llte ieta()aDuaumoot0apx moeilt s2el( onu)aleomr tydom elu olt t2xrim nydaltn neiasfs2taumono0oeeomo3iytfm2uluvo;(4alerif3oodoaD livo;t0 2tmiopoy1lm n fcslsfaDtaur ;t1alx ii3iydlmDumnvsnu4 etomrcoydopDelueil(  2toir nudom  mfesat)a2taumonu1texomoeiydfsDuauvp;(4treriocto1op r nvi;s  exm(o iudlpe miciatf 2tr(ro;o1olxomf3ildlaDrlu o;u4alxrmfciydfmt livo s) etoxm3iudop n fvil()sDraumoot1olto ictytlm2ulnmp u) rtoxf oydlptelneo;()t2xoxo3nu1lp   fcsatfsrrru poo1aex  f3tltla elump u0tetnirctadlpDr uei;s) exmimpoo1ome mivt (f rtrumo;t4ole  i3iatfmDelnmpnt4 exomr oa1lmt luvsls s2xmxo3no1lleemfesa(fsDta(mont0tlx mfeiytfsDrmu p (0altnmocia1omDelivo t truo(o3oo1lmee iviasfaDtau p;t1tee mfetys sDumnvp ()trtoioctatoa eln i;t) 2xrxr iydlptelfesl(fs2taxmoot0aex  ieiyt s2raums t0tleoxfciotop e ueslt)t2xm(r io1omtemivsls)sDua( ont0aeeomfciatls2eau s;u0teeoxr3iydla r n i t srxmxmpou4ap e fetatfa2uaurp;o0tltn f3ildlm2emnmp;(4 reoir iatfp e u s;(0t2xrxmpnudllt  fvslt  Duaumonu1apxn f3iltfmDrmnvont4arxnxf oo1fmtr ueolt0 exr(rpoydll emfesa(fsDtrur ;u1aptnif3iytfmDrm( onu0tetnmrcoatfmDe nvi;t) 2xoir nydapenlfcs tfa2tmump;u0oexnio3iaslaDran o;t)tlxnmrcoy1oateluvi (0srtoxrpno4omenmnetat) 2tauro;t1tle  ieildlsDuan p u)altnmo oodlmDeanvs;t0 ruoirpoo1lp   nci s sDrm( pot0tpt io3tydfmDua( snt0areomrciadlpDrai i;( t2uo(r oy4aptn fvsas  rua(root0aex  ieiysls2uanmo ()tetrmr3totfmD auvsls srxrxmpnodameemncs ()aDua(root4aetomfeiadfsDeanvp u) etnmrciydlateau olt) eto(r3no1lme mnetlt) ruax pnt0openmicilsfaDraumonu4tleomr totfpt anvil(0 rtmirpoydlme mnvslt) Draumpnt0tpe mfeiadfm2el(mo u4artnir iytfa   nvolt0 eurir ny1ll emfvtlt sruaurono0opeomieiltlm2el(vsn(0 eenmrcoy1oaDranes s srxm(r oy1omtnlicil(  Dta(moou1aptn ociadla2eanvp;t0tlxnmo tytlmD lueol(0t2xoxo3oy4ol elfcias) 2ur(roou0altomi3iytlaDean o (4 reriocia1la e ivilt sexrio ou1ameelnvsa(fa2tmxmpoo1ale  o3iyt s ean onu4aeenio3tatop e u i (0sexmxo oodop emicia(faDtm( o;o4aeeniocilsfmDul(vsn(0alenmo oy1la eli i;t0s2xrxopio1amtnlnctl( sDrmxmp;u1oltnifciasla2uanmo t4aetomr3iotlmDeaieilt)t2uoio oo4am  lfcs t)sruauront0tpeomocilsfs2ea( p (4aetnif3tatop rlivo;s  rtr(rpiy4lleeliet (farrrumpno4oexomi3iyt mDumu s u)aexnmr tatlpD anvs;(0trumxm3ny1om   ici t)aDur(  nu4aleoio3ilt mDulnvs t0alxoxf ta1lptr ivols)t2xr(o oodlltnlnctat)s2tm(mooo0olxo o3iatfs emuvs;t) lermo3oydfpDrli o;t s2umiopoy4lle  nct s sDur(mpou1aexoif3ild s ulnmp;t)alxrxf3oatopte neils0 rxr(opny1ll n iesasf 2um(m oo4teto ieiltlm rau pn(4 rtnmociotfpDe ieilt  etoxopnu4lp nlfes tfarrmxmono1aleo i3iatls2rauvsnu0aleomr oatlmD au s;( srum(o oy1lm nlivi s)a2rmur nt4aet  i3iysls2ea( ont4 lerxo3oodlmDeau o t  rtoxm nydaptnmfvi tfsDuaxmoou1tlenmfciyslsDem( o u4alxoxr3tadlptrluvi t)srtmxo iydam nliesa(fa2tm(r no0apxniieildlm elnvont) lxnio oy1lmte u o;t)srxr(opnodape lnvs s)a2umurpot0opx  ocildfs uaumo;u0arxrxfcoo1fmDeanei s t2ur(mpoudolenmivsl(f Draxr nu4tet iociysla2ranvpnu4tltnir iotfpD aueo;(0texoxm no4op  mfct s a2rr(r ;u1oex iieiad m2elumpn(0arxnmocoy1om   n ol(  eurirpiu4apen fvil()aruru pot1ope mieils sDumn p u0 lxnxfciotfp  anvsl() ruo(m nodlmtnmfvsatfaDumu o;t1olxnmiciadlm ua( o u)arxrioctatfp   n o (0t2tmxm3ou4omt  fvt s artr(moou4opto oetas m emuvs u0trxnmf iodomD livols s2xo(o3iydamt miviat sDra(r ;u1tet  i3tad sDuaump u4 eeoxo3ty1late u ilt) euoxopoudlpe licsas artrurp;o0tlenif3tlsla uanvonu0alxnircoydopteli il()trxr(r iudllee nvsa()s2tmum nt0tptnifciatls2rln o;t4 ltoxfciytfp rli o;s)t2trio3io1opt lnvil(f rurx  ;t0apxn iciltlm uan o () rtoif oo1lmt  u i;s0sexo(r3oudop  lfviat) rua( pno4oetomf3tyslsDrmump;u0tleniocoy1lpt aivi t0setmim io1om elnvta() Drrx ooo0alenmfcias aDel(ms (0tltoxo3iodoat an s t) eur(o3ou4ap elfvtls sDraxm no0alx mf3tls m2umnmp u4texnxrcoodomteau i (0 rto(r iydap e nctas)srurxrp;u0tlx mfeils a2emnms (0aetrxoctatlpteanvsls0 2um(o oydalen fviltf 2tmurp;o0opt mf3ild m2el(mo t0trtoxf3iadoaDelnei s srurxmpou1omtemivt (  Dua(mo;u1oeenmociltfs ran onu4aeeoio oodomtrai ils)s2tm(opio4apenmfciatfsrrru pot4teenioetat a emn pnu) rxrir3oodfpt lnvi;t)teuoxopoy4altnmfet s)s2trurpou1alxnif3iys s um(mpn(0alxnifciy1oat lueilt  etoxr io1al e neiat)srum(mpoo1aeen f3iyt s2emnvsnu0tlenifctotfa raivslt0 2xrxopnodal nlncsls aDurxmp;t4aet ioeildfs umump ()artomfcoadfpt aneil( sexmio oy4op   ivtat a2umx oot1ole mictydlm2ul(mp () lermo3oatfp r uei;t)t2tr(r nodome lnvi (f Drr(  no0oeen feilt a rln p;t)alxoxfciydfp ran o s  rtmxopnydop  lietas a2tmx poo4apxnmieils s ranvo;t0artrmr todoate uvo ()seum(rpno4al nlfctas) Durxmpnu1texniieilslm2umn snt)trtomo3iytfpDeaiei ( t2umxo3nudamee fcsa() Drru  ot0apt  feiyt m rmnvs;()tleoifciadfaDean s s0trxm(m iy1lp   ivs sf rtaum ;u0tex mocias a2uauvont)artoxociodfaD  uvs;s0s2umxrpnu1lmeemncs ()aDta(mp;o0oeeo ictlslm ea( p;t4alxnxrctadfmt  u sl() exr(r ny1op e fvtl( aDuau o;o4apeoii3iaslaDrlnvo;(0 etomr3tytlatrliesls0 2to(r3iu4oleemictat a2tr(rpou0tlx  i3ias a ra(mp (0teenifcoatomDeli sl( s2umio3iudoltn fetlt  2umum ;o4aetnifcilsfaDea(vp () exnmo oy1lpt  iei t  2triopiu4ape  ncias aDraxro;u4apx iieiltla2ul( p;t0trtomfcoytopDr uvol(0 etoiopoudap  miviatf Dra(mp;t0tptomieiydfm2emnmo;t0treomrcoodlmtraueols0 2xr(o iudamee netls)arumumoou4tptnmicilslmDrl(vsn(4teenxo3todopDeaues;t)s2xmxm3iudameelieiltf rtm(rooo1tpt mi3ild a umnmp t0 rtrxfcoodop rlueo (0s2toir oo4alee ivsl(f Draxm ;u0tpx mf3ilt s eauvont0trtoxrcia1lmtranvilt  euoio oydaltelnetas sDtru  ou4alt moeiysfm ranvp;t4tlxrxo3oy1laDr i i s t2uoir io4apte nciat sDtm(m ;t0tpx iictyt m ra( p (0 etnmfcoatfpte ieolt0srtrio iu4olenlnvtl() Duaum oo0oeto ictld m ul(vpn(4arxrmrctotlpteluvi;s0teumxo nodamen iesl( aDrr(mono1alenmi3iyt mDelu pnt0treomociodlpDraivs;(0tetoirpiy1llt mneia(f rum( pnt1opxnio3ildls2uln s (4 exoxf3to1oaDeln ils  2to(r3nodlleelfvtat sDtm(m ou1tleomocias a2em( p;(4trenif3ootoaDrluvo;t0teuriopiy1opt mfvt t)artm(  ot1aet mfcias mDemuvo;(4aeeoif3oa1oat lu i s)srtrio3ny1omeelivsatfaDuaxm ot0aetnifetldfmDran pnt) exomo3oo1lpDr n i;s teto(o io1am e fei s sDrrxr no1tee  fcild s uanvo () ltoio tydfp e ieols) rur(r oo1op nmncta()sDta(ro;o0tlx  i3iytlm emnvp (0tlxoxr3oadlpD  i o;s texm(r3oy4altemivi sfaDumumpnu4oex ioetydfm eaums;t0 ltrmo3iodfaD  nvslt s2xmim oy4amenmiet () Drmu pnt0texniieiyd a ulums;t0artnmr3to1fat  n olt  rxoxo3oy1lle mnvil(fs2umxm ;o4ole  i3tad a rm( s u4aeerxf ta1oaDr n i t  2xrirpiudam  micsl() rtm(r ot1oex ioetaslmDrmnvp t4 rxrxo ootop rlueo;t)teum(m3iu1aptelivi tf Dtr(r ou4optnmfetat mDem( p (4 etoircto1lm r uvsl()texo(mpiu1amenlfetas) rra(mo;u1aptn fcils a2eaums u4aetnxf3oadlptr ues;( tetmxo iu4lptemneslsfartrumont1tetomociyt sDul(vp;t0aexoiociytlp rln s;t0t2uoxopiydaltnmivslsfarrr( ono1olx iieiyd s2em( onu)tlermo3ty1faD  ivo s0srxr(opny1op  mnvsa()a2rm( ono0oee iociadfs em(vp u) lxnio to1oatr u olt0trtm(r iodaltnmicilt  2tm(rp;o4oltn ictldfmDrmuvp;t0
\ No newline at end of file
@@ -0,0 +1 @@
+uei;s t2umxr nydlltelneiat s2rrx  oo1tlxomictltfsDrm(mo;t)altnifciadomte ieol( setm(mpnodalt livils sDtrxr oo0oexo f3iadls uan snt0tlxnif ty1fmD lueils s2xmir nydlptelfvslt)a2taxrpno4oee io3iys aDemuvo (0aexnxr tadfaDeluvolt srtriopiodlmt mfcils artau p;t4aetn f3iltlsDrau o t4 reomfcoodom r i sls s2urio iy1llenlivsat s2tru  no1tltniociadls ul(mo t0tltnircio1late neils  exrxr3io1ll  mivslt srur(mooo1aeeo o3tldla ranms;(0 rxomociatfa e u ilt0 2xo(r oo4olee iet tfs2uaxrpou1optniieils a elums (0aetnmo3iadfat  i sls  rxmim ou1op  mietat) Dtaxro;t4alenif3iasfaDrluvp (0 etrxfcoy1lptr nvo t0s2tm(mpnodlm e fcil(fa2tmum ;u0aeeo fciysfaDuaumo t0artrif tydoaDraivi;( srtmxm3ny4lpe  ncsls srrrumpot0altnif3iysfm2ranvp;u0 lxoxf iotom  lueslt0setm(opiy1lltnlict ()arraxmont4altnmieiydfsDrmn o u)tlxnmr3oodlpD an sls srur(mpou1am nlfcslsf Dtax o;o0tleo feiatfm rmuvo u0 exnmfctatfm  ai i (0 ruoiopnu1al   fvsltfa2tr(m ;t0aexnmoeiydls el(mo t0arxrio ia1oaDrauei (  2trxo iodame lnetls  Drr(m no0oetomi3iat a ua(mont4aeeoif3iadfmDraueo;() exmimpio1ol nmnet s) rta( onu4aeto ictydla2eauvsnt4 eenmo3iy1lp   nes;(0teumio oydomen ictls  Dta(mooo4tlx ii3ilt mDulu p;(4arxomrcoadomD  uei;t0t2triopoydap nmnvilsfsrta( p;t4tet mfetatfa rmu o;(4 rxnmo tatla   ivilt0t2toxo3oodal nmfct (fsrrm( o;o1tpxomf3ils s umuvpnt4aexrircoadlm rau ils)sexrxmpiodop nlnci (f Dtrumoou1aexomfciydfs ea(vs t)aexrif3iotlaDr nvolt)t2to(mpiydom   fes s) rrmxr nt1tetnioeildfm umnms t4 lenmoctadfa eln s;(0 2umir3oudolen icsat aDrrxm ;t0tlxn ieilt mDuanvonu0treoircia1faD  u s s0trtrxrpiy1lp emivs sfaDtax pou1tpto fctld s2um( o;u4aleomrctatom e i o;t)s2xmxm ny1ap   iciatfsrrmxmp;o4tlxo f3iat s raumsn(4altoxf3oydlpD luvilt)trxrxr oy1alee fvt t) Drrum ou4alx ifeiasfm2rlumsnt0 rtrmr3iydla  li o;(  rxo(m iydapt mfci (fsrur(mo;u0oet mf3ildlaDelnvs u)tetnxfcoadlmteai o;t)srxoiopiu1olte fcils) 2tmx p;o0ole mieiasfaDumumont0 lxnxo3oatlmte u o (0srxrxopiudale lfctls aDtauro;o4tlenmoctysfs uluvpn(4 leoxf3tadlpDeln i t srxmir3nudomtnlfvsa() rtm(  ou0tpxo fciatfm rlumsnu0artnir3tatfpDr ivi s  rxm(opoo1ap n fctas)sDum(rpot1olx ii3ias m emnmo;t0aeeomr oydfmDrli i;( s2xrir3oy4al nliciasfa2rm(  no0aet mociytfs2ul(vp t) ltnmf oy1omD  ivs t) 2xm(r iy1amee ici sfaDrru p;t1aetomoeiysfs2rmump ()aleriocio1lpD lu o s0t2xrxm3iudol emnet s artm(ro;u4openmocildls ulnmpnu) etoxo tatfm raivols0teur(r3iu1am e ieil(f 2uaxronu0oexo o3tas m elnmon()altrmfcoydlmtr u ol()sruoir3nodap nmfvil()aDtrx  ;t4oeeoio3iyslm ea(ms ()texnxf3oodoateln slt0 2uo(m3io1ameelnctas s2tr(rpnt0tptn feiadlm2rau pn()artrxociadlm eauvsls setm(m iudaltelicta()a2tru  oo4olto i3iat m eanvpnu0 eerxf oa1lat li s;s t2xoio oy4am  lnvslt)srrau p;u1tpe ioctas mDul(mp () etnmf oydfat aneslt0trxoxr3oy1al n fvia(fsrurxmpoo0tltoio3iltlm2elumsnt4 reoir to1laD anei s0 exrir3nodomee fvt s)arrrxmonu1aptn feiltfmDumumo;u)altnxr3ia1lat  ieilt0trxmxo3ou4amtnlfeilsfsDraum ;u1ope  iciytla ul(mp (4aetrmf tytoa eau s ()tetm(mpoy1lpenmnvtlsfarrm(m ou1opxnifciytfsDra(vs;(4 leniocty1fmtrai sls  euoxm ou4amtelnvia(fsDraur nt1aee ifcils s ran snt)arxoxr3oydfpDelnvol(  eurxo ny1lmenliesa(fs2urum ;o1tptnio3iydfsDelu o;t4 rxnir3todomt lieslt0trtrxo3oodameemnct t  Dtrxmoot1tle iietltls ua(vpnu0trxrxf3oatlmt  nvi (0t2to(o3oo1alee nvt ( artrxmpnt4tex ioctls s ua( on(4 rxnxf oatla   n i;(0trum(o3oodlmeemnci s) rtmx pnt0tlxoiiciydfa2rmump (4aexomf to1om rlnei;() 2tm(o3iy4lm   nvt tfaruaur oo4aeeniieilt aDrmu sn(4tetnmr oydlmD luesl(  rumiopio1lm e fes sfsDtmu  ot1optomf3tatlm rlu onu0alxoxo3iytlat lues;(0s2xoir oy4omtnlies t a2um(mo;o4opeo oetadla2rmnms;()teermr3totfp eaneo;s) 2trir3no1ame  iesatf Dtrx pnt4teeniieiaslsDrmu ont4aeeomrcoodlpDrlnvols0tetoio ou1lmt  iciasfartau  ;u1alx if3tld a el( o t4texrir totfate uvs;s0t2to(o3iu4omt lnctas)sDtmump;t4optn fciat m2rmnmo u4 leoio iy1omD  neo;() 2xoxm no4lmen fetas)arrm( poo1tlto ieild m2rlumont) rtrmf3iodfm eln i ()srxmir iodolt  nei t sDtax ont4olt mi3ias aDua(vo;(4altnir3tytla rliesls) rumim3ou4opt lici t sDtrurpnu1apenmicildfaDuau s;u4trxrxo iydoptr i i s texrimpny1optelfvsa() 2taump;o0olenmfctytfs em(ms;u)aeeoxo3oy1oaDr nvi;(0 exoxr oy1ol   ncilt aDurxmp;o4apxomieiytlsDel(vsnu4areoxo3ootfmte n o;s) rxr(m oo4ll nlivta(f 2tmum ot1tpeniociysfm em(vont0tlenxr oytfmDrau ils)srurxo3iu4al   nes t  2tmxm no1altn i3iydla rl( snt0tlxnifctodopD  uvo;s setoirpoydlltnlnvslt) rraum no0tlxomfetadfaDuanmp (4alxoif todfmDe ues;s trumxopnu1lltn fetltf rrr(r nt0apeoif3tlsfmDumuvo;u4artomf3iodom r uesls)seuoxr ou1omtnmfvtlsfa2rax p;t4aeeomo3ilsfa emnmo u0tetoiocio1fatelieols  2tmxm nu1am elfeta( aDrrxro;u0tpeoiieiat s ul(vsnu4 lenxocoodfmtelueilt0 2uoxr oo4amtemnci sfsrtm(mooo0optoio3tlsfsDemu o;t)treoxfcoytomDelivo t)seuo(m3oo1lpt lneslt a2rmu p;o0tptn fctlsfm2rluvs;u0aexoxr totfmDr neol(  2tm(r3nydlmeemfcsl()arrmu o;t0tpt mo3iydfs2ul(vp t)tlerif tadopD aieilt) 2umim io4omt mnetlt)s2ta(r ot4tltoii3iysfs em( p t4treoiocta1lm  lu o;(0 2xoxm3no1ll n iet () Drr( oou4olto ictydfa2ulnmp (0arxnxocoytfmtr i i;( s2xmim oy1alte nciatfa2tru poo4opeo octydfsDra(vs;u)aetomoctatfptelieo t0srur(rpnodol emneil(  2rax  ou1tltoio3tls a2um(vs;u)aexomo3ty1faD luvo t trumxr oo1om  lietl( s2uru pou0alxnioetysfm uaums;(0 rxrxo ootom  aiei;(0trtrxo io1om n fcsasf Dtrxmpoo0ole  ociyt mDulu onu4arerxr oydoate ivo;t seur(r iu4omt liciatf 2urum ot1optomoetadla rlnms;(0alermo tytoa raieo;t) ruoxo ou1lpenmfetl( arraum nt0tee iiciasfs ra(vs;u) rtrmo3iadlp raiei;(0trtoirpny4lptn nvt t)s2uru oot0apxoiociadla um(ms u)trerir3oodom e i i;t srto(r oy4openlfet ( aDtr(mp;o4tpt moeiydlmDelnvs;t)aexoxf3oodlm elneols srxmxo ny4lmeemfei sfa2umur nu4tle mfeiyd a ul(mpn(4trtoir tytopDeliesl( t2xoxr nydoleelictl()sDrrx  nt1aptn o3ilsla2rluvp () lxrmr3io1laDelivs s truoimpoudlp n neias)a2ra(ronu4tlx mictytlm2ea( o;(4aleomf tadfmD lneo;t0srxr(r nu4olen fctas)arumu p;o4apeomoeilt a2em( o;t0 etnxrctotfmtelies;s)s2xo(m iy4optelivs s)aDua(  ot1teto icilt mDrlums;()tetrxrctydfateauvo t s2ur(o3oudome  ictlsfsDrruro;o1oee iictatfm emnmpnu4 rermocoatfaDelivi s0sexmim3iudlptnmnviat) 2rr( oou4tltn i3tld sDua( p;t4 etrmf3io1oaDeaueo;t0tetmirpoy1ome lnvt t sDum(  oo1opt miciatfaDrlnms (0 ltnio tatfa e ueo ()srumxrpoy4optemiviltfs2taumono4tlto i3tas aDuaumo;u4arxoir oodfpt auvi;(0 2tr(o3iu4ol   ietat)a2taxmooo1oetn ieilsfa2emnvs;t0alenmf3oydfat lu sls0 2xoirpou4lmt  fvslsfa2ra(roou4apxoiictatlm rmnmpnt0trtrio oatfm e nvi;t)sexoxr iu1optemneilsfarrm(mpoo0altomietyd s2rau o t4artnmrcootfa  livs;(0trxmiopny4lm elivtlt) rra(mp;u1alt ifeiytfmDelu pn(4tetrxf iadfmDrlueil(0 2xo(m3io1apt mfeil( aDrrum ;t1tex mi3tyslaDulnvp;u4 reoxo3io1lm rauvs;( t2xo(m ou1ap n nesa()sDtrx ont1oeto ietadfa2uauvs;t0arxnmo3oodomDeauei;s srumim nu4ol nlieslt)a2tmumooo0ope mfcildfa ul(vs (4 exrxo oadoaDelueo;()teur(o ny4lm elneta()a2taxroot1tltnmo3ildfaDrlnvo;(0 rxoio iatfmte ies ()tetoxo3oydllen nvs s) 2trxro;u4apxomieilt sDemu s ()artnxf oytop   u ilt)sexoxo oo4lmte fes tfsDua(mpou1oeeomo3tls a2eau s (0aeenif ta1oat  neilt) 2umim3iu1lp  mfcslt) 2tauro;t0olxnifeiatfmDeauvp t)aetoxr3iytoaDelnvs t  rtmxmpny4aptn fviasfa2ta(mont4alxo oeiatlm2uau o;t0alxrmo3ia1omteaneo s  2xm(r3oydaptemivtas)a2rau pot0aexnmietys mDrauvpn(4texrxrciadfa rauesls0 2uoiopoy4omtemncsa()a2urx oot4olx mi3iyt a rmumo (4 lxoxfciytfa   ueo;s)t2tmir3oodam   fcta(f rtau pou0optoioeiydla rmu p u4aetrir3iodopDrli olt trto(m3iu4om   ieiasfs2tru  ot4ole  feiat a eanvs;t0tltoirciadop e n s;s) rxoir oo1aptnlies (  2rr( poo0aexn oeilt m emums t0 rtnmo3iodlp  anei s0seuoir io4llen iet ()sDrr(  oo4oetn o3iyt aDuauvp;u4trtrir oydla e ivi s s2trxr iy4lp nmietat)sDtax o;o4oeeomo3ils mDemums () eerxocoytfa r ueo;t  eurxopnydop elics () rtaxmoou0aeto oetyslsDel(vp;u4tleniocoytfptr ieilt0trtoxopoo4lp   ieiat)aDtaump;o0aeeomoeild m umuvs t) etrmr iytoa rauvo;t)srtrio3nodlmtnmfviat) 2rrx p;u0texnifetatfs rmnmpnu4tlxoio iodlmD  ieols0 eumio3iu4op nmnciat  2ra(mpou0tpt mi3iasfm emnmpnu4 exrir3iotomDr ueil(0tetmimpiydllenmiesat a2ur(  ;o1apenif3tytfs2umuvsnt4aexnmf oy1op  aieo;s)trum(r3nu1lme mfeil(  rta(mo;t0aex ii3iyd s rm( s (0teenxfciatfp e n i;t  2umxmpou4al e nvil()arrr( pnt1olxnmi3ias s um(mpnu0aexomo3ty1omDeai sls0trtriopnodomt lnvs sfa2ta(r oo4tpen feiydfs uanmsn(4aexnmfciotfpD lu o s) 2uoir3iu4oleemnesls a2rr( oot4aet  feiltfm rmnmpn(0alerirctytlpD lnvi;s)t2uoir3nu4om   ivi () 2rrx  nt4oet  fetaslm emn pnt0 rermoctotop e uvi t0teurim ny1ol nmnei sfsDra(m ot1ope mo3tltfa ulumsn() exomf3ootfmD ai i;s0trurio oudapte nctat)s2ur(r nu4tlen f3iatla2ulu o u0 ltoifcta1opD liei;t  2tmxo3oo1lmen ies ()aDrmu  ;o4aptomietatfa2uanmp ()tltnmfcty1lp rlueilt)s2ur(opnu1lmenlfcs (fs2taurpnt1tle mf3tatlsDrluvp t4arxnmoctytomt  u i;s seurio3ny1am e fetls)sDuru oot0open oetlsfa2rm( o ()tetrxoctadfm   uesls0 2xo(m ou1lp e icil() 2rrx oot4tee  feiytfsDrlump () leomo oy1oateaneslt  rumirpoudlp nlivt () rraumo;o4altoifctytls2rlumonu0treoircoa1opDe u s ()t2uoxopou1lpee feil()a2um( o;o0opt ifeilsfmDemnmsnu)arxnxfctodlmDrli s;s0tetoimpiu1ope  feslt)a2rrumo;t1oltoifciatla2rmu onu0trxoxf3tydfmDr ieils trtr(r3iu1lmtemfciasf 2rr(ro;o1teeoiiciadfaDranmp u)treoxr3oadfpD aivil()t2xoxo ou1altn fei s aDtmurpno1tpeniietad a uln s;(4aetrmo3tatoaDr neslt)trxrimpny1om nlnvsls s2tmumpnu1open i3ildlaDemu o (0 exrirciy1lmDr uvs;t setm(opny4aptn iet (  rtr( pno1ole mfciad m rl(mont)artoxo totfmtrli o t) rtrim oy1lpeelics s  Drmxr nu1olx  iciyslmDraumpn(0altnmf3oatlaDrai s (0 rurxo io4lm  lfesltfa2uaumpnt4texnmi3iyslsDum( on()alerxr3tadfm  ln ils)trxoirpnydam e nvi s arur(m no4teen o3iysls rm( snu)trermf iydlmDe nvo;s0t2tr(m3nudol e ictl()sDrmx  nu0tpxn o3tlslm rmu p;() lermrcto1omD ai s s teumxmpnudllenmicsat srtm( oou0teenifeiltfa2umuvp;u0 eenmo3totlaD au s;s)t2xmxrpiu1altnlieias  2rm(mont1tpxnmfciytfaDulnms t)artoio3iatoa  anvs s) etmxo3oydap  mnetas)s2ra(mooo0ale ioeiydlsDuln p u0 eeomf3tydomteaivi ()s2tmxo3io1lmt  fvt sfa2rr(m nu0alxomf3iad m emnvont4 ltoiocoo1laDe i ol(0s2urxr3ny4lm elici s)sDrmxmoou4apx iictatfaDelums (0tetrif3oo1omteai sl(0s2ur(mpnodaptnmncias srrr(  ;o1aleoifetad mDeanvpnu4aetrxrciotfm ran ils  exm(rpnu1llee neia( srrmurpno1oee mf3iatls2umumont0 renxr3oydla  lues s0sexoxo3nodomen feslsf Dta(  ou4opeoiieiyd a um(ms ()tltoxocoo1faDr uvs t0 exmim nydlm  mfet ( srraxrpou4tet mociytls2uanmp () ltnxrcoydomtranvsls tetmim oo4am emnct t)srraxm nu0aexo oeiat aDrmu o;u0 etrir3ootfmt  ieil(0teumim3oydoleelfetas)arrru onu1optnmiciat m eln p ()trtnxo tydlpt  u sls0srtm(m oo4al nlnesl()a2tmu oou0tet  feiys m uanvs u4altoxf3oa1om  auvi;()t2umxopiodlpt micta( s2ur(rp;u0opx iieiys aDrlu p;u4alerif3io1fpt  nvol( sexm(r oy4lmtnmivslsfsDum(  nu4alto oetytfa2um(vp u0 renxf tatlm ean i;t0t2trirpoo4lmtelnvtl()sDrax pno1apt ii3ilsfm2umu on(0artomfcoa1fat anes (  rur(opoydole mfcslt  rtr(rp;t4tlto fcilsls2ranmp;u4 etrxr iatlptrlnvs;()setoxm io1ope lieil()aDua( o;u4tltoiietlt a2rl(vp (4 ltnxrctytfaD livil()t2xoim ny1lp  lnvsls arrmurpno0openmo3iatfs um(vp u) eenmf iatlaD aieo;t s2toir3ou4oltemietl()aDrrum no4tlxnmociadfmDrlnmp;(4 etoif iotlat  neo t  2ur(r no1ameelfvs tfs2um(mp;t0oexn ictysls2ua(vp u4artomfcoo1fp r ies t0setrir3oodlmtn fes s)arumu  nu4oee mfciat s umnvp t4aeeoxo3oadfa rlu o ( srxoir3oodlmenmneia( arrr(  ou0tpeo ociadlsDelnmp;(4 exoxf3oy1opD  ivo t0s2tmxr3oodll nmfcslt aDta( pou4oexnioctlsla2el( snt) rtnmr3oytlateai o;s0setrir ny1apenmnvtl() 2tm( oot1olto i3iyslmDemuvpnu)trenmf to1opDrau o s0s2umir3iydoptelivilt s2urx o;t0aleniocildls2em(monu) lenifcoo1fpt ln i s)trtm(o ou1lpenmnvsasf Drrxro;o4tptoiociat s2eauvsn()tlxrxfctadfp  aueo t)srurimpio4oltemfviat s2rauront4opxo o3ilt mDuln ont0 rtomr oadfmD  i ilt trto(m3no1opeemicil()aDumu oou4altnmociasfs ra(mon(0altoir3oatlate ieil()s2uoio nodapt lneil() 2trumpou1openmocils s rmnmont0tleomrcoa1fmDeluvils  ruo(r io1lptelfcsas arumu oou1oltniiciyt m ean s;u0alxrmr iydfptraivol() rxoxm iu1omeemfes t aDtr(mpoo4alen oeilsfsDel(vp;u) rxrmr oa1fmDelnvs;t)t2ur(m oy4omeelncsls) rraxrp;t0aetn oetytfs2ulnvp ()artrxfcoodoatr u ils)sruoim oo4amen fvt t  2tr(mp;t4aeeoifcildfs2emuvp;u)trenmfciotfaDelues t0setoiopnudoltn ivsl( srtaxm ;u4alenif3tyt aDran p;()arxrmf tatlmtelnvi;s0srumxo3oo4lpte fcsl( arrru  ou1apt mociatfs2ulumo ()trenmo oytfa rlu s;s) eto(o nydaptelneia(fsDtax oot1aleo oeiytlmDranvpnu4texrmr3tatfm raivol( srto(o ny4al elfcsl( sDuru ooo4alxomf3ilt sDum( snt0 exoxrciotfaD  u o;()trtm(rpoodop n ncs s)aDrau o;u4tpxnmf3iyslmDum(mpn()texrif tatoaDeanvols s2xmio3iydlptelfct s s2tax pno4aptomfciydls2uaums;()alxoxr oodfp eanvslt  2urxmpnu1lmtelfvslsfsrurxr ;u0optoifetld mDuau p (4altoxf3tatopt  n o;(0trxrir oo4olen nesat  Durur ;o4opt mo3iatfaDua(msn(0aexrir3oo1fa elu sl() etrir3iu4lme lncias arrr( pou4oexomoeiyt s rau onu0 lxrxo iatfm  aues;(0t2umxr oodom emnvs s)srraxr ;t4tetomo3iad mDemu p (0arxomr io1lmteai s;t trumxopnydlm nlnciat)a2uaumpno4ale mfciytfm2eanmp u)trerio3oydfa e n sls0 ruoio3ny1aptn fci t  rtmxmpno4apeoifeiyslm eanms;u4alxnmfcoo1la rlies ( texrir nu4lm emfvtlt)a2rmu  no1olx ifeiasfmDua(vsn(4 eeomo todlmtrlnvi (0t2urir3nydam  lfvsat)aDumx ooo1tpe  f3tatls eauvo (4tetrxrcoodfpDrln i;(0trtmio3ou1lm emictlsfsDumxronu4teen ieiadla eluvo;u0 lxrxr3tadop  lu ols) euo(mpio1llte nei t)srurxmp;u4apt mi3tlslsDelnmp;t) exoxrcia1oate uvs (0 exoimpnydlp n fct t)s2tmxm nt4opxnmi3ilsfa rm(mpn()texoxf iytlp eauvo ( seur(mpou4ame  nci s) rtrxro;t4aexomo3tytlm em(mp;(0 rxrio3iy1fpDe ivsl(0trto(r no1lm elivtlt) Drmxrp;o4tpe mociyt a rmumo;()trtnio iadfa raueo;t trtr(m3nydom emnctls)aDrrxmono4alt  iciaslm2eanmo;() reoifcto1oate ivs s truo(o no4alenmfciat  Dumxm ou1olenif3tatfs rl( o t4 lxoio tytlm rau i;t texoxo iu4op  mnviasf rta(ro;u4ale iieiaslsDemn p;u0trtnxrcoa1fptrai slt tetr(o3oudlm nmici ( a2tm(r ou1apx  ietaslm ean s;t) ltoio3iodomDeau ils0 2tmxrpny1am e icil(fsrrau pno0oltnifcild m2rluvp;(0treoxr iadfpteauvi s)t2uoiopny1ol   ics t)artm( onu1aet mfciys m umu pnu4treoifctytopDelueo;s srum(r iydolee fetas)artaum nu0tlen fcils m2ulnvo t4trtomf oadlmteauvi s) eumxm io1op  lfvias  Drmumpou0olxn fciytfa2eauvs;() exoxr ta1fp elnes t t2ur(rpoo4lle mies ( aDra(m ;u0ale io3tadfa ulnvpnt4arenir tatlaDrauvs s0s2umimpnydol nlfvsl(f Durxr ;o4aexo 
\ No newline at end of file
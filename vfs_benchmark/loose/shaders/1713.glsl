@@ -0,0 +1 @@
+ivo t0 2xoim ou1apenmfeslt) Dur(ronu0opt  o3ilslm2rmnvs;u4artrioctodlpDeluesl() rxmxr oodlmtnmfeta() rurx  ot4aet ii3ils a2ran onu)arenxf tytoptrlivi s  2urxr3io1ame mictl()artm(m ;t4aexnmi3ias sDumnvo;(0tlxrxo iatlaDeli s (  rumirpnu4lpe licsasf Duau  oo1alx ifctltfm2uln s;u4trtoxf iy1oa rai il( trxrxopno4optnlncsl( sDrmumont1opeoifcils sDuluvp;(0aeermo3ta1fatraneo;t0t2toim oydalen fes ( arra(r ou0tpenioetatlm rmumsnt4tleoircto1faDe i o;t)tetm(m3nu4optelnvta(f rrau o;t1tpxn o3ias aDeluvs;t0tltoxf iodoaDe u o;s srto(r3oydopeemivsa(f Dtr( pot0apxnifetyd s2umnms;u4trenir ia1lmD  uvo s)trxrim3iu4lpte fvil() 2rm( p;o0tetnmieiysfaDelnmp;t)alxrir3ta1oa  au s;( srumxmpiy1lpenmfci s) 2taxmoou1tex if3iytlm2rau p (4 lxomfciodfp  ln s;s)tetrim3nydlpte fvsls aDtr(r ou0tptnifeiyt s2ulu p u)artoxo3oatoa  lneils)t2ur(rpnudoptelfcsa(farrmurono4tleoiictlt m el(vo () lenmf todlm  livo;s)setm(opnydlmen fvt (fsrtrx  ou4alxnifetls aDum( o u4 lenmo iodlptr n o;s0 2xmxm iu1optnmfcil() rumxrpnt4aetnii3tadlsDemn pnu0tlenmfciy1fmD aieo;s truoxm iu1am  lictasf 2ua(root4apx ifetydfm rm(vonu0artoio3ty1lp rauvs;t0t2urxopiydalt mnctls)sDuax o;u1tpxn ociydls2umu p u4 rxoirciydlpDrai sls0trxmirpoydlmt lnesas) 2ra(rp;o1tlxnmocilsfm2rmump;t4tetrmfcto1omDeln il() 2to(opiydalte ivslt  rtaxmo;t4apt iiciaslaDranvs u)alenxo oytlaDe nei;(0 rtoim3nudopte ies () 2tm(mpnt1tlxnmociysla2rm(vs t) rxrmo3iotopt lnvo;t0seur(m io1openmiesl(fsDuaxmo;u1tltnmf3tasla2emuvp;t0tltoif3ootlmDrlnvils)sexmim3iu4opte fvtas)srraxront0olt  feiltfs2em(vpnu)aeeriocoadlm  auvslt) ruoxo io1al nmncs tfarrmum no4tlxomociltla2um(vsnu4 eenir oa1lat anei s)srtr(o3ny1olt mneia()srua( p;t0apxomiciytfsDeau o;t4altrmf3tatfaDelnvil(0teurxopiu1lme mfcsas)artmum ot4openioeiys s2um(mo ()alxrmr oy1opD luesl(0sexmir3oy4altnlfei s) rtax pot1tpxn feiltls uau snu4 eerir tytomteau i t s2xmirpoy1ll e ict s)artax ono0olen feiytfa uaumo;()alerircto1fpt ai ils) 2xm(r oodop   ictl()a2umu o;u0aexnmietydla rluvo t0aetoio3oydfp  au s;t t2umxr3iodap emfei (f rrrump;t0aetnmietld a emu s (4aexrir iy1lm rlu i t)sexoirpoo1lmtnlfvs sfaDtmu pnu0oetn i3ilsfmDemuvs;t0 lxrmfciytlmD auvi t) euoimpno1ap  mfet s  Drmxrp;t4opx mi3iydfm2rmump;(4aetoiocoa1op eauvs t0 2trxr3oo1lm e icias)s2ta(  ot0tleomi3iat mDulu o t4alxomf oytlm  lies;t0teumxm ny4amee nvta(fsDrauroot0tpe mi3ilsfaDel( onu)aexnmo3oodoaDrln o t) exm(r3oo4aptnlfctl()s2rmxmo;u0tpenmicildls2ul(vo;t0treoxf3iy1om ean ilt0trurxrpoudap emicils aruaxroot1aexoioeildls um( s u4tleoif3todla rliei;t srto(m nodop nmics tfsrtruro;o0texoii3iasfaDulump;()arxnif to1op r ivs (0 etriopoudamee nesa()aDrmx oot4tpx mfciaslmDra(mo u)arermfcia1om rluvi;t0 2xr(o no1am nmivtl() 2tmxmoou0alxo oeiasfmDraumonu) renir oydomtr nvils  2uoir io1ll n icias s2ta( ont0apto octydlsDuau pnt0arenifcoytlmDeaivs;(0trtm(m no4amtemnvtasf rrax o;o0tlxnmietadlaDum(vont0artrxr3oa1fpD aies;t trurxr3iodll elivsat s2rr( oou1olxnmi3ilslm2elnvs (0trenmr todfmDranvs;t seur(mpio4ame mfcs tfa2taxro;u4opxo feiysfaDrmn o ()alxoio3ty1oa eli i;t t2umir no4lp nlivslt)s2tr(  no1aexo ieiltfa uauvpn()artnxr iy1lm e ivsl(  rxm(mpou1ap n nvsl( srta(r no1olxoifcildfs eauvpnt4 rxomfctydfmDe u i t0trxo(mpou4amee nes sf Dtmx onu4tpxomi3ilsfm2rln s (4artrmf3iydlmDran i t0trxoxm3nydoleelnvilsf Dtr(  ;o4tltoif3tas a2um(vp;t0alerio3ta1fmD auvi t)tetm(o3ny4opee fcsl(f Draxmpnt4ale  fetad m eanvp;t) ltoxr3oadlaD  nvo t s2toxo oydaleemfcsas) rumxroou4oetn o3tas sDrm( sn()artrmf3iodfp  aiesls)seumxm3oy4ape  nes s arurxm ;o1oexn fciyt s2eluvp;(0tlxoxo3oa1lpDelueilt)seuo(r3nudlp n ncia(  ruau oot0tee if3tldla uaums;t0 eerxr tatoaDe ivs s  rtoir3iy4ale mfvsat  rtmxrp;t1aetomfctydfa2ua( o (0 reoiocoa1oat anvi t)srtoir ou4lmeelnesls a2rmxmp;o1tleoifcildfsDemnvp;u) rtnmrcoodoatrai sl()seurxo3nodlpenlietas aDraur no4oex moctld sDumnvo;(0tlxrmo oydfatr nvi s0srxmxm oo1oltnmivils a2tru  ou4tlen i3iadlm rlump t)teerioctytopte i ilt)trurim3nodlpee icsat srumx o;o0alxnmoetydfa2ra(msn(4 exomf3oo1opteaueo;()trxoio nudam  mfvsls)a2ra(r no0ope moeiyd aDean s;(0tetomr ty1optrauvi;s)srumxr nodlm emneias) 2ua( pnt1aexoif3tltfm el( p u0 rerxrctotfpDeln ils  etoxrpoo1ap nmnct ()artm( pnu0aetniociydfsDea(vo;u0teeomo3oodfmD lu sls0teumimpno1al nmfvi t)sDrru o;t1tlx moctasfsDrmumo;t4alenxfcta1lmte uvo (  2xo(o oudlme micil()srum(rpnu0apt mi3iaslmDum(msnu4arxnircoatopt lnes;( setoim3oy4ope lnes () Dtr( poo1aex  o3tysfs emnmo;t4 rtomf3tydlatrluei ()srto(opou4ap   nci s)arurxrpnu4aptomf3iyd a uaumsnt)aeenifciydfpt  ieo t0 euo(m3ny4ole  nvs t s2rrx o;o4olxnioctys sDum(mo t4arermo ootfmt  uvi t) 2urim3iy1lltelnci (  rrm(m no1oetoifeiltlaDrmu o;(0areniociydlm  au o t0texrimpnodope  ics ( artmx pnu0tex mfeiadfsDraumo;t0tlenmfciatlpDraivi;s)s2toim3iudll   ics sfsrtaxrooo0tee io3iydfs rluvs t0alxrir iydlmtelnes;s setoirpio1om n nviat a2uaxmono0apxo o3iydfsDean sn(0 eeoiociydfpDeai s;(0t2um(o3iodlpt  nes tfaDum(mpou1texo i3ils m uluvs;t)tlxnxr3iatfp rlu slt  eto(r no1omen fcta( arra(m ;o0aet  o3tat m2el(mp;t4tltnmfcootla elnei;s)t2xr(o oy1amt  fcsat a2ua(mo;u1oexo ictltlsDeauvp;u4 lxrmocoatfa  lnvi s0srumio3iu4lpt mies tfartrxrpno1aetoifetltfm emn s (0 ltrxr3oytoaDraiesl() etr(o nydlm  mfctatfsrtmurpnu1aptoiietydfmDemuvs;(0aexrmocoatfaDraues;t0t2uriopiydomte ivsas  Dtau onu1texnifeilsfa2ul(mp;(4aexoirciytlmD lu ol(  2urxopoo1amte fesas sDrau o;t4oleoiiciatfa rlnvs t)alerxrcoo1om ran il() etrir oo1al emnct t)aDtr(monu4optnmfctadfa2rm( s u4trenxo3iodoaD auvo;(  2toio iodalenmfeia(fa2um( onu4opt iieiadfaDua(mpnt)trermocoadfat ln sl( t2ur(o iu4al emieia()sDraxm ou0texoii3iys s2uanvont)aleoxf iytfateli o;( s2uoxr3ou4lp e fesl() Dumxmpnt4teenifeiltls eauvonu0 etnxoctadom ean o;t teumir3oudalt livias sDua( poo0teenifeiaslsDra( ont)tltnxr3oo1fpDeli o (  etm(m io4lpt lfeilt) 2rru ont4apt ioeiyd aDrl( p;t)tleoir tatfm  ln s () 2tr(o nydolee neiltfa2ra(ront0oeeomictyt aDum( snt4artnir iy1laDeaieo;t t2uo(r3no1lpt mnvt (  rtm(  nt4tpe iiciadlm2ulumo;t) leoifciytop  aneil( teumir3ou1lpte ieil()a2rmx pou0tlx  oetlsfsDuln s ()alenxo3iodlptranvo s)trxm(r3iy1op   nci t a2ur(mpno1apx mf3tlslsDeaump;(4arxoxfciadfmDeli o t srxm(m3iu1amen nvt tfa2taxmono0olx if3iltfm2emn o;()tleomo ootop r i s;s srtoirpoy1ap   nvsat  2rrx pnt1oeenmo3iydla ran sn(4tlxoxociydlmD lu il(0 rurim oo1omeelieiat)artaurpnt4tlt io3ilt m2rl(ms t) eerio iydoaDranvol(  rtm(rpny1apt  ies t sDuru o;o0aptomi3iyt a2eauvs (0arermoctydlmt  ivol(0s2tmxo iodome  fcsa(fs2rru  ot1tetn icildfs2uanvpn() etnmo ta1fmD  n s;s) rxoxopiy1ome lici t artrxmpot0apx  o3tltla eaums u0tlxnmf3oatfateaneo;t0 2xoiopoudope livsls  2urumpno0oexoifeiltlsDra(ms;u4trtnmr tadfa  livi t setr(mpoydllt lnesas artmx oou0apxnmfcildla eln snu0aetnxo io1la eln i;s sexrir nu1alte nvsat  Drmxrp;u0alxn i3tlt s rm( s u)alxnmr ty1lpte uvi;(0s2xrxr iudome mnesl(  2trx  ot4alto oeiytlm2ua(mon(0 rtrmr totom rau s s)srtoxmpiu1lltnlfcsat aDtrx p;u4tlx  fcilsfa ul( p (0 lxoxocty1faDe ueo (0t2uoir iu4lmeemneslsf 2umumoot4tetnmiciysfa uanvsn(0arxomfctodlmtrlnvsl( setr(m io4llen ies ()s2tm(mono1ole mfciaslm elumsn()aexrxr3iytlmD lues s0 rxmim3oudlpee neilt) rta(mp;t4tpeoii3iysfm emuvpnu0 lxoir3oy1oaDeluvilt0 etrxm3oodal e iei ()sDuax p;t4oetn fctad m rluvsnu4treoxf3iotlm eluvi s0 eum(m3iu4amenmicta( s2tax  ot0olxomocils sDuln ont4tlerxrciytopDelnvs;( t2tmirpny1altn ncta( aDumuroot0oleomf3tyd a um(vo t4 lenxr iadop rlu i;s seuoimpiudllt  ieiat aDtmuronu4aex iiciyd s umump () lxrmfctotlmteaueo;(0trur(rpiy1olenmnvi s) rumx p;o0ope ifctlslm el(vont4 ltrir3iydlp e nvi s  rurxo3oodamenlictl() Duru  ot1aexomo3ilsfs ranvsnt0altrmocio1omtrli il(0t2um(o3iydom n fesas) Duau  nu1apeo fetasfs2ul(msnu0 renmfctytopDranvolt0srxrim oy4alenmnct ( s2um(mpou4apx  o3iasfmDuanvs (0 lxnxfcoatfpDr ieslt srur(m3nudll nmieilt aDumu o;t4oltnmicilsfm2ra(msnu0tlenmo tytomte nvs;t0srtmimpiy4omtnmneia( s2rmur ;o4tle ifetatlmDemn ont)arxrxrciatlmt an s;( t2toxrpou4op  mnvs s srraxrpoo1opeo ietysls uluvs (0 rtomrcoadlm elnesl(0t2tm(rpoy1lmeemnvta()arrau ooo4aptomfetldlm um(ms u0 renxr iydopDraneol(0teuoim3oy1omenlfciatf 2tm(m nt4opt if3iadlaDrluvo;u)arermocty1lmt luvi;t srurxr ou1op nmivt s) 2tm(m nu1olxnioetasfmDrlu pnt4arxnifcta1lpteau i s trurxrpnydamtelivta()srurum oo0tet mfeiasfa elu pn(0alerifcoydomtrau o ( trxoim oodoptnlicslsfarumxmo;t1oee ioetatfs rlnvp (4tetrxo iodlmt  u i;() eumiopiu4open nvil()arur(  ;u0apenmi3iytlsDuaumonu0artoxfcoytfaDrai o;s sexoimpno4lltn ieilt srua(mpnt0tltnioeilsfmDea(vs u0trxnifciatoaDeanesl(0sruoxm io1aptelieils  Dumx pnt0oltnii3tadlm ra(vpnu4arxrmo ia1latraneols setmir3oydomenlnetl() 2ta(mono1oexomocias m rm(vs ()tlxnmr oodfatr ivs;()t2urxmpnodaptn icsatf Dtmx ono4olt iiciatla2um(vp;t0tlxomrcootomte uvolt0 rumxmpiy4optemivi (  rrrumpno4tpxn feilslaDrmn s t0trtoxo iotfmtelnvo;() 2tr(opio4lmt lneias arta(  ;t4oexoifciatlmDelnvsn()alxnmf3to1fpDrln s;s trtmir oo1am emicilsfa2tmump;t0tpeoifciydfm ranvs u0tlxoifctotomteluvo;t srtoim oo1aptnmivsa()a2uaur ;o4oee io3iatfm2umnvp;t4tlxoxr ia1fmD au o;t t2urir3iu1om emfvtltfaDtr( o;t1tlenmieils sDrmumo t0 lenmf3iatfptran olt  2tmxr3nydaptnmnetlt artmxro;u4texn oeiys aDra( p;t0aexrmr3oadoa ranvilt0s2xoxmpnu1ole  nvtlsfsDuau  nu0oltn o3iydfs ranvont)aexrmfciotomt luvo;(0 rxrxmpnu1lm  mictat)aDumxmpnt1aetnifctad sDul(vpnt) rtnmr oatoat liei;s)t2trxopny1olee nvsasf rum(  ;u4aet ifctys m ran snt4alenmr3oa1oaDeli o s  2uoxrpoodal e fet t)arua(r ot4aptniocils mDrm( s;()tetoif3ta1optrlnes s  2uo(opoy1omeemnet s)arumxm nt0tlto fcils a emumo;t)arxoxfcto1lpD  n o;t) rumiopiy4amenlici t  Dtm(r ou0ape  fciasfs2rln s ()aetnxrcoy1fm   n i s)t2umimpno4ol n iesl(f Drmurpoo4aleoifeiysfmDemnmsnt4 etoif3ta1fmt  ivo s0 rtrim3iodapeemfesl( a2tax pno1ole mfetlsfs rlums t0texrmocoy1op rluvol()seumxmpnydope lncs t sDumxm oo0aptomieiasfaDemu p t4arenxf iodlmDeau i (  rtm(o3oodolen nvtlt) rurxrpnt4ape moeiys a2rau o;() exrmfcia1fpD  nvs;t  eurimpio1lmeelics s) 2raxrpoo1aet if3tytlmDem(mon(0 ltnio3ty1opt  nvs;( srtm(r3nu4lpen iei sf 2umumo;u1tlxnmi3tat a2eln s u) lxriocoadfm  aieslt)tetoxr3iy4lme mncta(f rumxrpnt4aptn o3tad s uan p;(0tlxnir to1fa  auesls seur(o iodamtemfvsltf 2rr(r nt1apxn octatlaDean s;t)aexnio3tytomDranvils t2toxmpiu4oltnmfcs ()sDtauronu0texniictadla2ulums;u0aeeomrcoodfm eaueilt) rtr(mpiydapt mneils)arrrxront1apeoif3tat s uan o;u)trxoifciodfptrlivi s teum(r oodamenlfvt sfs2uau o;t4tpe  iciasls uanvp (4tltnxf io1omt  i o (0trtrxm oudol nlivia( aDtr(rp;o0aex  f3iytlsDrmnvp;t4 lxomocia1lpteluvs;() rtrim3oydomt  fvi s)aDtru ono0opeo ociytlmDeanms (4 lxnmf ta1lmtranvolt seurim nydlmtnmivias) Dua(rooo1tle mo3ilt sDea(msnu) lxnxr tytopDelnes ( teur(o iu1am emivs sfa2rmx oot1altnmiciytfa eln p;u0tltrir3oy1lateaivsl()s2xmirpou4am e fcta()arrrur nt4oetnif3iltlaDulnms u4texomf3oo1fatrlies;t teurimpnodoleelict t  rrrxm ou4teeo i3iyslm2ranvonu0 rxrifctadlpDean o;(0tetrxm3oy4op n ivia( a2um(root0opxnmf3ildfsDeln o;u)arxoxo to1latr u ols)trtm(rpoy1ope mfviatf 2uau  oo4olxnif3tltfs2ulump (4 etniocta1la rln o;t) ruoxm3oy1ll  lnvtlt)s2um( onu0aetoioetldls2umump ()aeenio3oy1omtran ol(0srtrxo ou1lltnmfes s) 2rr(rpou4tpto oeiyt m2ran pn(4aexnifciytopD ai i s0 rtoio iodal nlnct s  rtax oot0alxoif3iydlmDean o t) leniocootop e nvi;t) rxoiopiu1ome  icilt  2tm(mo;o1alx ifcildfm2ra(vs;t0 eerxociodoatrln ols  exoim nodlpen fci t  rra( pnt0tptn i3iltfsDel(msnt) lxnmr3iadlpDraivols t2tr(r oudaltemneiltfsDtmu o;u0tlx ioetldls emnvp;(0tleomr3oodlpt  uvs ()t2urim3no4lp elfet s artr(root1olx ifcils s uanvon()aexoifcoadlp   ivo s)sexmim iu4am n icsas artrumoou1aeto feiat m2rm(mont)arxrxo iydla e ieo s)trumimpnodlle lncsas aDtmx oot4tlxnmoctadfs2eanvs;()teenir3ootoa   ues t texmxmpny4ap nlict ()aDum(mo;o1tet  icildls2rlnvs;(4 rtomf3oa1oa eln o s  2uoim oodopt lfct s aDrrxmono0optnmoeilslm umnms;t0 exoio totlptr n o (0s2tm(o nu1op nlnct sf 2rmu oou0oetnmfetasla2ulumon(0 ltrmociotfaDrlies s srumio nydopenmnvi sfaDtrumpnu1tpxnmi3iadfa2el( o;t4altoxf3oa1faD  nes t srto(r3oydomtelivil(fs2uau o;u4tetnifcilslmDuaumsn()aetoxr tydlpDraues;t0s2trimpnydal eliei t)aDraxr ;t1aet iocild m2ra(vonu)aeenio iotlpt ln sls)trxm(m oy4lmen fvia()srumumo;t1teenifeils a umnvpnt)tltnif tytfpt anvolt)sexmxr3nu1lp e fei t) 2rrx  nt4tpxnioeildlm eanmp t0aeeomr iytlpDelivols) eurio oo1apt miviltf 2umx  nu1texo ieiyslm2ranvsnt0 ltnircio1opD lu s ()t2ur(m ny1ap e nvs tf ruax o;o1texo ieildfs elnvo;t)tltomr3to1fatranes t0 euoxrpnu1ol n netlt)s2uaurpoo1tlxomfetlsls2ua( pn() lxomfcia1fpt ln o s0 ruoiopnu4lp  lnesat a2uaxr ;o4oexnmf3ildls2rm(mp;()trenioctadomDeluei;t)srtmxr ny4alte fvslt aDraxmooo1optomfciydla umnvont0trtrio tatopD  uvils  2xr(opoo4omtemiet s)aruaxmont1tptnif3iys m2emnvon()aleoifciy1omtrlu i;t) rum(opiu1ll  livtls)artrumo;t4apt  o3iadfs2eauvont)trenir3oa1fp  luvilt0srtmir oy1ol nlicil(  2umurpno1alxnmo3ildls rlums u4trtoircoa1op ranes;() etrio no1llt lncia( artmxmpot4tpeomo3iyt s2em( onu4 reomrcio1omtrlu sls t2tr(o3oo4lmt  ieia() Dtmu  oo4ole miciltfm2uaums u4 lxnmoctadfpDelueo;s)t2xoxr iu4llen nviat)a2ur(rpot0alt ifeiltla2ranmonu4 rxrxr3iatopD  ueo ( tetmxr no4altn nvslt a2tmx p;o0tet  ieiadlsDraumpnt0artnir oydopt  ivs t0 rtoim3iu1oltnmietas  2rm( p;u1tpxn f3iys mDul(vs;u) exoifcoo1fptrlneo;s seuo(opnodllenlies s aDtauroou1teeo ieiydlm ulump;()arenmf iy1lmD auvs;t t2trxm io1lpt micils)aDua(mpnt1aeenioetydfs rmump t0 lxrioctydlaD  neo;() rxoxo ou4oltnlfvt s)artmuroot0olx mo3ildlmDumn p u) ltnxr tytlpD anvo s0 2toxr nodom elfctasfarrrxronu0aeeniiciasfs ua(vsn(0trtrxf3tadoa eln s;s t2xm(o3oo4aleelicsls) 2uaur ;o4oeeo oeiat s2umump;u0texrif3tytom r nvols  eumirpnodal   neiat  rraumpnt1tltn fciatlm ulnmp u) lenxrcia1oa   n i;(0srtr(m3io4apenlivtlt aDumurpoo1aet  f3iatfsDelnms (0 lxrirciytoatr nvs;t trxo(r ny1lpenmfvil()a2tr(moou1aetnmoeiyt sDemnms;t4trtnioctatfp  lneo;t0texmxo ou4lltelnvilsf Dtr(m ;o1alx mi3ild s2emnvp;u4tlxoxo oy1lp rlieilt)trtoim3nu4lm elnvias) 2tm(r ;t4tpe if3iadla2ran s (4 ltnioctodfpteaueils0t2triopoodop   ivtat  2tmuro;t1tlx ioctydls umumo;u0texoirciodla elneils teurxopnu1ll emnctas a2uaxr ou0aex  fctltfm el(mp;u0artoxf ty1fp rau o;( setrxm ou1al nmnvtlsf Duru onu4teeo ieiltla2eauvo ()arerir3tatfp r nes t t2xmxm nu1lm nlieil(faDtrx o;o4apenmo3tatfm2ranvon()altnmo to1fmDrliei ()t2xo(rpny4aleemictlt a2uaxrpou4teto o3ilsfm eanmpn()areoio3tytfmt lnes;()tetriopno4oleemnvs tfartm(mp;o4aptoiieilt s2rluvont4altoxfciydoptrau o ()t2xo(rpio1lptelfet sf ruaxmooo4aee moeiysla2ulu p (4 eermo tadfatr ivs t t2trio3nu4altemfcta()s2rrumo;t1aexoio3tltfm2em( o;(0tlxrir3oydopteluvo;()srxrxm ny1lleemfcs tfsrraumpno1alen f3tyd sDum( s;u4tlxoxf3tydlp  aieols)s2xo(o nu4lmtnlnetl(f rrmur nu1ape ioctld a ul(vs t0 eerxo3iatfpteanvi;s0s2xrxmpiydapt  iesl(  2umu p;u0olenmociyt m2ua( p (0trxnxf ty1fmD lnvs;s)setm(m nu4ap  mivsa()s2tau o;o0oexnifeildlaDuln p;u4tltoxf3tydlp rlnvs () exm(m3ou1lpe lnesa(fsrtmx  ;u0opeomietaslm emnvo;u4 etnir ootlm r neo (0srxo(opoydapte fctat aDum( p;o4ape  o3tyd mDranms t)trtrmr3oo1lpD lnvilt0tetrxr3oo4lm e fvs t) ruru ooo1tetomociydfaDeau s;u4trtrir3oo1fa   neo;t)truoxr io4om nlfvt () ruru  ou0apx  oetyd a rau s t0aleoxf iydlpD luvi;( setr(o3nudap  mivilt)srua(r ot4aptn oeiasls2ra(vsnt0 exrxfcoydlpDelnei (  rxrio3nudlle livils)a2raxm nu1tlxoif3iasfa2eanvs u0 lxomr oatopteli o s)s2ur(rpny1lle  fvtlsf 2rmx  ;t4opto o3tat s2ranvpnt0aeerio iy1faD  nvols srxriopio1ol nmivtat)s2truro;t4aex  f3ils a2rauvp u0alerxf3iodlmDraivs;t)s2toxm io1ap  lfvi sfaDtaump;t0apxomoeiysfa um(vo (4 rxnir to1lat aivil( trxo(m3oydol emfcilt sDrrxrpot0tleo icilt m2ua( o;u) rxrmf3todfaDraieils)tetmiopio4ap nmfct (  rta( pot1optomi3tadlsDelnmo u0arerxf3iytopte nvols)s2uo(opoy1amtelnvia(  rtmx pnt1oeto fcild mDuau p;t) rxrmf iy1fateai i;(0seuoir iy1ope lnciasfsDumump;u0tptomfetltfaDea(vp u0 exnxr3iodfa  liesl(0tetmxmpno1ole mnetat  Dtmu onu4tpeoifeiydfs uln p (4aeeomrctydlmteln ols s2xoxo3nu1al nmnetlt) Drmu  ;t0ope ii3iatfa2rmnvp u0artrir tydlpDrlu o s0srxo(opoo1ole  nvt s s2umur ;o4apxnio3tlt m em(ms;t4teerifcoadlmtrauvo;( texmiopoodape lfesl() Drm(mpnt0texomoctatfa2eanms t4aexnxrcoytomt aues () ruo(o oydoptnmivtlsfarrax poo0teen feildls ra(ms;u0trtnmo3ta1omDe ivil()t2umxr3oo1omt  nct (fa2rm(moou4oeeoif3iad a2rl(vs;u0 exoif3tadlateli o;t0 rxoxr oydape mnesltfarrr(rpno1tee  fciys m emu o t0texrxfcoo1lmt  ues ()s2um(r nodaltnmivtls  rra(mont0optniiciyt sDem(msn()teerxo oo1omteai s;( trtm(r iu1ll   fetls  Drrur ;o1apeoif3ilsfmDuln p;u) exnxr3oytfmDe neo s0s2urirpoodoptnmivs ()sDtrump;o1opeoii3tldlmDumumpnu4texoifciy1lmtelueolt0t2tmxopiy1ape  iesas sDrm(  nu0teeoiieiytlmDrm(mo u0 leoiociydoaDeai ils)srtr(m oo4apt mfetasfa2ururooo4tlto ieiatfsDelnvo;(4tetnifctodoatrau ils0seuo(o nydlleemnes ()aDrm(  no1alenioeiytla eanvs u)teermfctotfptr ivo t0teuoxm nodamt mieiat sDtru onu0optomf3iadlmDrmn pnt4aexoiociodfmtrlivo;t) 2um(mpno1omte ncs sf Dtax  nt0aetoii3iadfs2el(ms;(4 rxoxr3oydoaDran o (0teumxo oy4lmee nvsls)aDra(rp;t4oeen ociyslm rmuvsn(0altrxfcoy1omDr uvs;s0 exr(opou1aptemnvi t)s2ra(r ot0tpxo f3tytfmDra( o;(4areniocoytfaD auvsls)sruo(mpiudomenlictl(faruaxmoot4tlto ietatlm umn s;(4aexnmfciadoa r ueils0s2xrimpny4lltnlicil()sDumxmoot0tlen iciaslm2ranmont) ltrio3totlm e ueo;() 2urimpoy4om nmfeslt s2rmu pnu0oeen feiltfsDul(vonu0texrxf3oy1omt lnes;s) rxm(o3iu1olenlnvtas) 2ur(ronu4oeeoif3iytlsDemn p;u4altrmf3oatfmDr n s;s) etmxr3oo1llee ics (fsrrau  nu1tleniieiadlaDua( snt0 exnxr3oodfmDran i ()setoxmpny4ape mneil() rtrur oo4aeto i3iltlaDelumpn(4tlxoifctatla e uvi t0setmxrpoo4aptelncsl(fa2tmump;u4apto ociytlm ua( onu) rxoir3tatopD ai sl( trxr(rpiu1ll nmnviatfs2rmumpoo4opt iiciadfmDea(vo;(0tleoxf3ootlmD lnes;t)t2xrxr io1oleelfvtl( srrm(rpoo4aeeoio3iltla2ea(vont)altnmrciydoaDe ueols  exmio nudlp emnciat) Drrxmp;o4oleoifciasfa uanvs;()trerxr ta1op  lu s;t)seur(o iodlmt  nvsas aDtmxmont4aex  iciaslsDulu pnt4aexoio iodomDrlu o s0s2urxm iu4lpt  fvtat) rrrxr ot0opxnmfetldlm em(msn(4 rerir ty1opD au i t teurim oo1altnmfci () 2uaurooo4olto o3iadlm rmu sn(4 ltoio iydfm ranei s0teuoir3iu1am e nvtls arurxmont0ape mi3ias m rmuvpnt0altnio3totfa eau o s trxmxr ou4ame mnctlt srtaur oo4texn octldfm2ulums t0alerxr iotomt livol(0 exrim3oydlle  icia()arraxm nt4oetn f3iys m eanvsnt0alxrxr io1fmDrlnei s0s2umxmpiodlmtn fesl( srrr(m ot4alenif3iytlmDuanvonu0arenif iadlm  livi (0 etrxmpnudlme mivtlt) Drrumpno4tet moctasfm ul(msnu0 lxrxo ia1op eln s s srxm(m nu4op   fctas s2uru  ;o4tlx iictltls2eanvs;(4aexnmf oytopt aieil()s2xr(rpio1ap elfvt (  rta(r ;u0altn ieiadls2rmumo;t)arenircty1optrli s;( t2tmxmpou4am nmnet t)artmx onu4opxo oeiysfsDum(mo;(4altoif iatlm e n s;t) etrxrpnu1ole  nvtlt) Dtrxm oo0tpe  i3iltls2emuvp;()aetoif tydopDelnei (0 2urxr3nu4am n nvtlt aDtaum no0apx  i3iatfsDeanvs (0arxnmr ootop   uei;()s2uoiopoudopt  nvta(fa2rax  oo0tlenmo3iatfm em( o t) exnxrctotlptrli olt)srxm(rpno4lltemfvs (fsrtrxroot0alx mi3iytfs emu s u)tltomr ootomD lu o t) 2to(o oydlltelnvs s srrrx onu1oee ioctasfm uln onu4trtnxf3iytlpD lnvilt s2tmir3nu1aleelivs t s2ra( p;u0olenmoctyd a2ea(mpnt0 exoxr3to1fmtr nei;(  eurirpnudalenmnciasfaDumur ;u0aptoif3iydfaDumu p t)trtnmrcoadop raivils  rumirpny4ope liviatf rumx pnt1texn o3ildfm umnvpnu)trerif oytfpDe ueilt t2urimpoodolenmictasf Dta( pot0apenmociltla ean snu)treomf3oatoaDe neo;s)t2xrirpnydllt mivtatfarumur nt0tlt ifeilslm umn p u)arenifcoa1latrli il(0 etoxmpoodapenlivi tf rtau oou4aet miciaslm rm( p t4arerxocoytlateauvs;() rto(opnu4lmtn fvta(f Drrxmpno4ale  o3tyd aDum( o;(4treomf3oy1om  luei s)sexoim iy1ap emfct s s2uaxrp;u1opxo ietld s2rmnms;t)aexoiociatlmt ln o;(0t2uoio iy4lpeemfeta(fa2raurooo1optn ictytla2elnms;t0tltoxo3totoptelneo s trxm(r oo1omt  ivslsf rurxmp;u1aexo oeiatfm2um(von()trtoxf tadlm  li s s  euo(mpiodape mneil( sDrmx  nu4tlxo fcilt m raump t0 lxnmr ta1la eanvo;(0seurimpiu4lmt mivsat  rrm(mpnt0alxn i3iytlm2ran p u0alxnif3totlmt lu i t)srxr(rpny4om elfcils  Dua( o;u1aeeoif3ilsfa2ul( s;t4aetnirciotlpD au o s  2xrxrpoydaleemieilt)s2umxm oo0tlt ii3iysls rm(ms () rtrxociodlatrlnei;s0trxo(r3nydlle  ncs () 2rrxm ;u0olt if3taslm2eluvp;u)tlermo tatfa  aues t t2trir3iy1ll e ieiltfs2rrxm oo0alxniictltfsDrm(vpnt0 rtrmr iytfpDr ueo t srtoxmpny4opeelnetlt)a2taxmp;t4aet  oetldla uau o;(4 rermf3oydopDelieol( trumio oudlp   nes ()a2trx ooo4aeenioeilt m rm(mp;()artomr totfaDranvolt sruoxm3ny4am nlnvtltfsDtaurp;t4alxnio3ilt s2rluvs t0alxrmfctytla ean olt)tetmir io1ap emneia(  2umx  ou0alxo oetadlm2rmnvont4texnio3iatom eai ils srxoxm oo4ope  icta( sDtmxmont0aee ifetydfm rm(ms;(4 exnxo3to1lm   nei;t) exoiopio1ame  ivi sfa2ra(mp;o0tleo ociysfa eln o;u)tltrmr tydlaDraivol() exr(mpou4ol   fcsa(farrrx pno0alxoiieildfs2ulnmo u0 lxrxo oa1latr i ils trtrio iodomt mnvtas)a2rrx ooo1opx mf3tadlm emnms;u0aeeoir oytlmDean slt texmxm3iu1omeemfet s)sDraxmpnu0oexo fciadfs rmnmpnt4aeerxr3iadomD ai o;s) rxrxmpny1lltelict s) rrru pno4oltomoctatls2umn o;()alerxo oy1latraiesl(  eto(r io1om e feilt) rrmumo;t4aetn ieils a2uaump u0 exrir3oatfaDraivo t0srxmxm3no1omt mict s srtmxmoou0texo feias aDrluvsnu0texrio3oo1oaDr i i;(0s2xmxm3io4apt  
\ No newline at end of file
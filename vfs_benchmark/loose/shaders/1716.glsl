@@ -0,0 +1 @@
+nvil(0seurxr no4oleelfvt s) 2tmur nu1tltnio3tltfa rmuvs ()altnio3iadlpDrau olt  euoxr ny4apt  iet t  2um(mpot0alx  i3tasfa2ua( s;()aleoxo oa1lp r u ils  eumxo io1optnmnctlt) Drrumo;u4tpxniietytfm um(mpnt0teermr tadfmt  nvs;t  rxrxm3iu1am nmfcsatfa2tmuro;t0tlt  o3iytfm2rmn snt4 rermr3todfpD  u s s)s2xoxopiydop e ivi () rumx  ;t0tlt ifetytfs eluvp (4 rxrir ia1lat  ueslt)s2to(rpio4opt mieslt)sDrmx pot1tlenmoctltla2uanvp;(0 rtnir3tatfmD au s;(0s2tr(m nodal e neils)aDrrump;t4oet  feiad mDulumo (4 rerxocia1lmt anvo s0t2tmim oy4ll elietlsf Dtrxmp;t1tpe moeiytla umu onu0teerxf3tytlatrlnvo s0trumir3nu4ll   nvil(f 2urxmont0alx mieiadfm ranmp t0artrio iadfaD  uvs s0 2tmiopiodlm  licilt)srumx pnt1apeo fetlt aDrm( p;(4aetomf ootoatelu o s)setmio3oy1al  lfcsa( a2trx pot0aptn iciltfaDuaumo (0 exnmfctodoa  an i;s) rxr(rpny4llee fviltfaDumu  nu1openiicilt s rlnvont0texnxfciatfpt  u i (0sexoxo iy4op   iesatf 2rm(  no4alenmiciyd mDra(vonu0aetnxocoytlmt auei s  2uo(o oo4al  mfei tf 2uaxr ot1ale  oetldlsDul( s u0artrmf tadomD  ivi ( t2urir iu4lmenlfvta() 2taxm ot0opeoioctas mDua( o u0trxoxrcootlmteaivs;t0 2umxo nu1lmenmiet t)s2rmu pou4oeen ociltfs2emnmpnu) etnio iatlp ran ol(0 rxo(r3nu4lpt lfvs s)arta(mpnt0aee mfciatlm2ulu o;(4tlxnircta1oaDr ieo s)sexoxr3ou4lleelncilsf Dra( p;o1opeoifetat aDuauvs;u)tetnmf to1lpDe i i;(0 rxo(mpoydomtelfes () rrrxr ;o0oleomf3ias sDum( o;t4tetomo3ta1fa e uvs t)sruo(r3io4amte ieils)s2tru  ;u0oltniictat m2ra(ms t4aetoif to1fm r iei;s0 eur(o iu1lleeliciltf rtmumoot0apx  ieilsfm2uluvo u0 rtrxr3ta1latrlnvolt sexriopio4ape lfvtlsfsDrrx pnt1oetomoctls m emn p () lermfciotlp   nvolt0tetmxm oudoltnmfetat arrr( ont1oee  i3iydlaDumn p t) reomr3tatfp  luvilt0sruo(mpny1amtnmnciat) 2tau o;o1tleomo3iyslaDean o u)arenxo3oa1fp r i o s0 etoxr3nodlme  ncs s aDrax  ;o1altnif3iltfm uauvo;(4arerio totla rlivs t setmio oo4omen iesat)s2uaxr ou1olxnmo3iasfaDuanmo;u4 etnif3iytoatelu s t srurxrpoy1lm nlfei sfa2rrxrp;u4olt  ieils m2raump;t) reomocio1omD li s;t t2xrio nu1am e ictatfsDuru ont4olxn fctld s rauvs u0arxnxfcoa1opt  nvi;()seumim nu1amt  ivs (f Dtrump;u4teeomfciydla um(ms;t0tleoxo tadfptelnvo;t)t2xr(m iodap n ncta()a2umxro;u1tpx mietytlm umuvs;t0 etnxf iadfpDe i ilt)srxr(o no4al nlneia( a2tru  oo0aeeoio3ildfm rmn o;() etriocia1lmt lieo t0setm(m iydlptnmnciatfs2tmx p;t1aptoif3tadlaDemuvs;(4texomf iatom eln s;(0sruoxrpny1llt  fcsasfaDra( o;u4optn ieild a2um( ont)artnxo3iy1opte iei s0 etriopio1openmictls)aDrrxmooo0aee  ociyslmDelnmp t)arxnxo3iotlatrau s s)texmxmpoy4lmeemnciatf rtrx  ;u0tex ifeild mDrmnvsn(4 exnmrcootlmD  ies;s sexmxo oodal  lnei s)sDtmx p;t0tlx mfctyslm2el( p;t4 ltoxf3oytfpD lnvs;()srumio ny4apt mivils)s2uauront1aeen f3iytfs el(msn()aetrxrcia1opDrlneo;t0 rtr(r3ny4ll   ncsa(farrm(mpou0oee mieiasfaDeluvs t4treoxf3oo1la  au il() exo(mpoudom elncs () rrau o;t4aexn oeildlmDeln s;t) lxrxr3oydoptrluvo (0srtmir oo4opeemnvi t)srtrxmoou1opx  o3iadfs2eaums (4tlxoxfcoatomt lues;s0t2umim3ny4alee nvtat  Duax  nu0tltnmoctas m2el( p;(4arxrxr oadfm r i il(  rtrxmpny4am  mivt ()sDraxront4oexnifctlt mDrm( pn(0treomo oodlaDe ieo (0trtmim iy1ll  lfvsls a2taur ot1altnif3ils a ua(vp (0 ltnif todfm rau ils  2trim3iudlmte fviasfarrrurpoo4aetnmieiasfa rmn on() ltnxfciy1lm raivs;s0s2xoxm3ou4om emicta(  rrmxmo;t1ole  o3taslm emums u0artoxfctytfpDrai o t0 2uriopno4amtnlieiasfsrtmxr ;t0oeenmoeiaslm emump;(0aeenmo oadlmteau sl(0srumxm3iodameelfetl( s2raxro;o1tleoio3ilsfa2ulnvpn()alxrio3oodoaDeaies t t2uo(opoy1al  lnvtl( arra(r oo1oleo ieiltla2rl( s;t)tlerircoy1fmDean i (0srtmxm3ny4ole  ies s s2tr(m nu1tlxo ictydlsDem(vp u4trxniociotlaD au il(0texr(r3iydop e nctasfsruru pno4texnii3tlt sDrlnmpn(4 rtoiocootfatelnvs;s0 2toxopiu1lmt lnvtls)a2tr(mpno0oltnmo3iaslm ean p t4 rtoifcoodfa ean sl(0trtoim io4apeelnvi tfaruaxm ;t0olen o3iytlm emnvpnu0tltrmo oa1op r nes;(  exmio no4oltn ivslsf rtaxroou4tle mf3ilsls umuvs;u4artnif oodfaDe nvsls  etoim oo1ap   ies t)a2urumont4tlenio3iadfm emnmsn(0tleoxf3iy1omD au ils0 etmim oudolt micsas)a2ta(mpnt4oexn o3tlt s emu p u0tltnxoctydlmDr iei;() 2xoxo3ou1lle lieta(fsrrau  no4oee mfeiat sDrm( snu4altnif ty1lpt aueo;s)srumxrpoy4lltelfcil(  Dumurpot1aptomi3tls aDrlnvpnt) ltrifcia1fp e uvslt trtmim3iy1ll nlnei (f 2rm( oou4texn fciadlsDumnvp;() eerir oy1lmD  n i t)setrxm3oo1optnlneslt  Dtm(r ;o4texoio3ildlm2umnvo t4arxriocoo1fpDr iesl()trtmxo3oudomenmfctas) 2rr( p;o4tex mieiasfa elnvs t4trtnxfciodopt livo;s0trtrimpnu4opte ivslt)aDtrum ;u4olx mfcilsfaDua(vs;u4texoxf ia1opD  ivol(0teur(r3iudam e fesl(f rumu o;u4texomfcildlsDum(vo u4trtoir3iydoptr iei ()t2xrxm3nydom nlnvt t)a2rr( ont4tle if3iatlsDemn s;t)texrxo iy1oa rlu ols)trto(o3oo4llt  icta()srur(rp;u1tet moeilslsDuau sn(4teenmo totfat anvo t  exoimpnodopt lnetat)arumx  nt1teenmi3tytlm rmuvs u4 exrmf oatomDr ivols0 rur(r oydlmeemnet ()sruax pnu0apen ociadfmDrlnvo (0trerio iy1oaD aues ( truoirpiodlm elivil( a2uaur nt1tlxnmoeiadlsDrmnmo;u4tetnxr ia1opDelnei;(  2uoimpio4openlnciasfarua(m ;u1aetomictldfa2elu s t) rxrxfcootfa r u o;s)t2uoxr io4oltn iei t)s2trurp;t1alxn f3tyd m emums (4 rtomr oatfp rli sl() rumxm oy4omtnlfviat) 2um(rp;t4ale ii3iatlm ra( p;(4trtrmrciatlmtr i ol( tetmirpnydll  lfvs s) 2rm( p;u4optnmo3iad a2rln s (4 eeoxo3oadfatraueols  exoxm oo4optnmfesasfaDta(rp;u1tpeo feiadfm2rmn s;(4tetnxrcoo1la  li s ( s2um(o iudlltnmics t)sDraxm ;o0olt io3iyt aDelu s;t0 rerxr3ia1optr nvs t0tetrio iy1amee fvt s s2rau pot4opt ii3iytlaDrl(vo;t4treoxf iodlpD  iei;(0sruoio ny4apt mnciat sDra(mo;u1tpxo fciys a2eauvs;t0teenxocoytomD lues;(0 2um(r3nu4ameemfcs (f 2rmxr ;t1alenifetytla rm(vont4aetnirctatfm rlu ilt t2xoim3iu4oltemneslsfaDuauroot1tleo i3iatfsDumuvont)trxnmfctytlmDe n ols  rxoirpoodolenliviasfs2tax onu0tlenmfeiytla ulnvonu4 rtnxr totfpD li il(0setmir3ny4aleeliesas)srrm(mpno1tpenmfeildfm uanmo;t) lenxr3io1optran o;s)seur(o3iodom nlfvta( a2ur(  ot0tlen f3iasla em(mo t)texoxo to1fmtrlies;s0seumxr3iu4llenlivs sfaDrrxmpou0altomiciydla2uanmo t) ltnxo oo1lpDrln il( t2xmimpoudape lies ()aDum(m ;t4teenif3iyd m umnvo (0 ltnxo iadfptelneilt)t2uoxm iy1ll nmfcslsfaDrr( o;o4tptomf3tasfa2raumo;u) rerxfcoadoptelneo s s2tm(mpiy1lp nmncs ()srrmur oo0apxnii3tys s2eanmo;u0 renxfciytop e n i (  rxoir nu4lpt mnesa(  2tr(rooo4opto iciydfmDem( snt4 rtoirctodfa   neo;s)t2xrxm3oydllt mneils)sDta(  nt1oeeo iciadfa emnms (4 rxnxfcoa1lmtelu ils) 2xmxopoudopt lncils a2rm(mp;o0tpxo oeiad s umnmp u0 lenxfctytoa  au o;t trxrxo3oy4lpte fcsas s2uax  ou0tlx  octatlsDrl(mpn(0texomr3to1oateau il( trumiopio4omeelnci s)arrmumono1tltnmfeilsls2elnms (0 rerxf oa1oa rlivils0 etr(mpou4lle licils)a2rmumo;o1aet iocildfs2rm(mo;(4tlxoif tadfa rlnvi t)srtoimpou4omeelict (fsrumu  ou0altnifeiatfa2ua(mo t)aeermo3iytlpD lnvs;()t2xo(m3no4llte ncsa(fs2umur no0ape  ieild sDea(vs;t4tlerxf oo1laDrau ol(0 etoiopiy1amenlivil( artr(ro;t0apxnmfctld a umu o t)teeriocoa1om e i s ( srxmirpoodame mfeia(  Dum(m ;u1tpen i3iytfmDea( pnu)tetomocoadfptrlnvo;s0 2toxrpiodopenmfes sfaDuaxm ;u1aeto feild a uan snt)trtrxo tadoatrauvo;t) exr(r nu4lp n fetl(fsDur( oou1tetn octad mDuanmo (0 ltomf3oydop r ivolt)srur(m nydamt  ictls aDrm(m ot1tetn fctydla rmnvp t4aetnifcto1fm   neo s0sexoio3ou4ll nmncsatf Drrumpoo4tpenio3tltfa rm(ms u0trermo3ta1oat  ieils s2tmxm oo1optn neias) 2raumo;t0tpx  ieilt m elu o u0alxrircootoa e n il()sexriopio4lptemfcsl( sDuru o;u0aeeomoeiyt s2rl(vonu)altomr totoptr n ol(0t2trim3oy4lpenmiesl(fsrrr( o;u4olxn o3iadls ua( snt4aeeoxrcoy1fat  iei t0 eur(o io4om e nvsat) 2um(mp;u4oeeoif3ild a el(vp;t4arermo3ta1lpD lneils s2uoxm nodlp elnvt () 2umuro;t1tpenmfeilt a rl(vs (4 ltomfctadomtelivs;t)trto(mpnudlmtemnetls a2ur( o;u1aleomieiyt s2ea(vp (4 exnxrciy1lm r ivi;s  rtrim no1altemicia(f rtrxmont4tpx io3tadls2ranmo u4 eeomo iotla raivo () 2urir3io4op e fctat)aDrru  ot1alxoiieias s ranvonu4tlxrifcoodla r n o s)texmimpiydalt livs tfa2raumooo1tltomo3ildls2eanvo u0aetrmr3iatfp r i sl(  2xm(o ny1llen ivsa()aDrrxr nt4altomocilt aDraumo;t4 rtrmf oa1lm eluvo t truoimpiy1ame  feta(fsrtmx p;u1oetnif3iydfm2emuvsnu)tetrirctytomDeluvilt0s2tmir nudom  lfes s  2rrx o;o4aeeo octas aDrlumo (4tltomr ia1la rli il()texo(m io1optnlict (f 2tr(ront0tpto fciatla2uanvpnt)arerif tydfmteaieil( texm(o no1lpt  ivs ( aDumumpno1oeeomoetaslaDulu p;u4arxrxrciydfatrlneo s s2to(o3iydomte ivsasf rraxront1aeto i3taslaDraums t0aexoxrctodfp  aivolt0sexmio oodoltemivt s  Drmu onu1tetn ieiysla2uanvp;t0tlxoirctydoptrau o;t) rum(o3iodll emnesa(f rraxm ;t1teeomoeiydfm2rlump;()arxrio tadfmDr i ol( srxm(o3nu1alen ivia(  ruaur nu4tptn i3iydfaDra( onu0 reoio3todfpD  i slt0setm(opou1am n ivsl(farraxm no1opxn feiydfaDem(vs t4tlenmf3oodfptr nei ()t2tm(r3ou1omt  nvtat  rrr(mooo0tlxnmi3iat m2umn s t4arxrmr3tytomt auvs s) etr(r iu1optemfvi s)arrmu  no1oexnifeiysfmDranmo ()alxrxf oodomtrauvsls setmxo3iu1openlnvsa() 2taxmooo1olxoioeiyslm2rlnmo;t4artrxr3iytoa  an slt  exo(o3no4lpenmfeil(faDua(ront0tltnmi3tasfmDuau o (4tlerxf3tytlmt anei;t0t2uo(o oudopt  nesas  Dur(rpot1apxnmfciysfm ea(mo;u)texrxocia1fp rluvi s texo(m nudopen ivt sfsrua(m oo0opt mf3iysfa2ea(vs;t4teerxr3ta1omD lu o t)s2uoxr iy1lpen fvi s a2ur(r ot4oee moeiatla um( s t0 rxriociotoa   ieo t0trtrxmpou4apenlfvtl(fs2uaxmont1opxo o3tldlmDumnms (0 rxrif3oo1fa  lneo t0t2uoim3oodam n fes t sDtmurpnu4aetnmf3ilt m ran on(0areoxrcoo1lpD lu o;s t2um(rpno4ol elfet ( aDrmum oo0tlen oetadfs ran sn(4 etrirciotoateanvslt teuo(m3nu4al elneil(fs2umur nt0tpto f3ilsfm2eaump (4 rtrio3ootlptrluvi t) exr(mpoo1lm   fesl()arurur nt0alx miciat m2rlu sn(0tltrio oa1lp e nvslt)trxmiopio4apt mivsat a2urump;u0aleomi3iadlsDuan s t4aetomocoadlatrlueol(  rxoim3iudlleemnvia(  2rmum nt1tptnifciytls2rauvs;(0 lermrcoydopt aieil(0s2umiopiudlme mfvsat s2raxm nt1tlto f3ilsfs ran on(0trenmf iy1lptranei;t) exm(opnydop e fvi s srtaxmpnt4tlxoiieiadfa2rlumo;u4teeoxf tatlatrau sl(0trtoio3iu4amt mfvsa(  rra(  no1olt  oeiatfm2ul(mp (4 eenmo oa1lpDe i il( t2to(m no1aptnlfesat  2urxr ;u4aeeo icildls2rlu s;t4tleomf iodlaDeaivilt)teuoio3ou1ll   ict s s2umu  nt1tpxomo3iyt m2ea(mp;()areomrcoodlpDrlu i t t2tm(r3nudaptnliet (faDtrurpnu0tpen o3iadlmDem( o;u0arerif3oydopDelnvilt)seto(o iudlpenlfcs t)arrmx  oo0aeen f3tytfsDuanms;t)aeeoxrcoydlp r i ilt0srto(r3ny4lpte neiltf Dtmuro;o4oetn ieiydfs ul( pnu) lermf3oatfpDelivo t0setmxopoudol e nvil(f rra( p;o1apeo fetyt aDulumo () lxnmr totlate ueil( seumim3nu1al emncsls)srtr(mpot0tet  o3tasla2umnmp;t0 leoif io1omD  ies t) 2xm(m3iy1lmt lnvsl( srurxmp;u1tlxniiciad a2umnvp (0tleomr ty1fm  aueo;s setoxm iudome  ictltfsDtru  nu4opt  o3tldfa2rmu s u) rtnio3totomD  u s;t s2urxm no4amte nctatfa2ua(mooo0opxniiciyt s ulums ()trtrmfctodlp raueols) 2to(opou1aptn nei tfsDrm(  ;t1aexn i3iaslm2elnvo t)trtnio3totlpD aivs;()seumxo3ou4ame lnviltf 2tm(rpnt4tlxo i3iadfs ranmo;t)tetrxf iodomt  ieo;(0 eum(m3oy4lpt  fes ()a2rmum ;o4alt if3iltls eluvp;(0aeenxr ta1omtrlieo;s tetrxopoydll  lfvi () 2umxmooo4ape ifcildfa elump;u4tlxomo3oodopteaneils0srtm(opio1ol emivtatf Dtmu o;o4aet iiciytla2rlnvp;u4aexrmf3oadfat ln i;t0t2tmxo oo1op nlnet t  Drmxmp;t4tpx micilsfmDelnms;u0tetoxfcoy1oaDeln olt)truo(m3ou4lm emfvil(f Dtmx onu0alxnmfctydls elu on(0 etrxo oytlat au s;t0 rxmxrpnydomeemietas sDua( onu4alto o3iadla rl(mp;t)aetomociatoat aues;s0trxo(r3ny1ope livta( srururpnt1aexo ieilsfs em(vs u)artnmo oydfaD  ivils)t2umio oo1ol n ici s)sDtmu  oo0ole if3tydfmDemnvpnu)trenxrciydfpt ai slt  etr(r3iydal  lfcils s2tmumonu4oexoifciadfm umumon(0altnxf3ootoptrlu i t)sexrim ny4aptn nct t sDraumo;u4tex  oeilsfm2ea(ms;u0 lxrir3iodfaD anes;s srumim3ou4ap e fct s)sDrrxmpot1apx mocilslsDemu s;u) ltnmr totlpD anvils  etrir oo1llenlivt s  Dua(m ou1tee  i3tydfs rlnvo u4 exnxfcta1lmDrai ol(0s2trio nudamte fctlsf 2rrxr ot1tle mi3tlt sDuau pnt4 etrif oodoatrlivo;t  rtoim3iudamenmfcils)a2ua(rpnt0opeo fciatfmDuluvsnu0trerxrcoytfpD lu o () etmxo iydlptemnetl( sDtmum ot1tpe mictld s2ra( o;u) etrmf3todopt li s;(0t2xoxrpou1omen nes tfaDra( pot0apxnmo3tyt sDum(vpnu4areoircoatlmtr n s;() 2xmio3oy4olen nvtas) 2tm(m ot1teeoioeiydfmDua(mpn(4 etoio3tydlaDeln i s t2umir iodap elnct tf 2rr( o;t1oltniiciysfaDrauvp;()trxnmf iadoa rauvo;s0s2xmir ny1opt mieil(fs2um(rpnt0aee iiciadls rluvo (0aexrio oadlmDe uvsl(0s2urxopiydopt mfct tfa2ur(mp;o0altnmociasfa2umumpn(0alenif3todfp eluvo;s0t2tr(r3ny1ap n iesl()sDrrx pou1oleomictydfa2ulumsn(0tlxrif3tadfpDeau s () 2xrim3nudlme lnvtat a2uru oot4tet  icias aDem(ms t0 rxnir iy1omteau s;s t2xrxo nydll  mneiasf rtrxmo;o1opt  o3iytfm ua( p;u4 rtomo3todlmDelu o s) etrxrpou1om   neils)aDtaxrpnt4aex mieilslaDrm(vp (4texrmf ootlm e i s;()s2trxr3nudome  netls) Dtau ooo0aexn f3tysfsDel(vo;u)texnmf3ia1lpt aivolt0teur(r3oy4ap n iet t aruaurpoo1opt mo3ils s2ua(ms;(4trxomo3todlaD  nvils)sruo(m iudllenlivtas  Dtmxmpou4opxn ieiys a2emn s;t0altoio oa1oa  lnvolt texmxm3oydll  mfcslsfa2ra(mpoo1aptnio3iyslmDrm(mo;u4tlxoiocia1fmD luvo t) exoxo3oy1om n ietltf 2ur( pnt0alto ocils m ea(vo u4alerxfcto1fm  ln o;()texm(o3oy1lleemfesa(f Draum nt4oeen f3iad aDumnmo u0 rtnif ta1lmtr ivil(0s2xoxo oy1ll   ncs t)srurur no1apt ioctadfsDemuvp;() rtomf3iy1om e u s t0 ruoxm3nudomeemnet sfs2tru  ou0aetn ociadfaDrluvon(0tleomr3oydom rluvo;t)t2trirpoudopt mfciasfaDur(mo;u4tex  o3iysfs eaump;t) etrir todoat  i o s0s2xmxmpnydlpt mnei s  ruax poo4altomf3iytlmDumu pnt0 rxomr todopDeai s;()sexmim iydomeemieia()srtr( poo4tetoii3ils a2uanvp;u4 ltoxo3iotfmtr ieil( srtr(opou1lmeemfet (fsDtaxr ;o1tlx  feils a ra(vont4alenio3iatfm eau s;t) 2uoim3nu4omtemiesa(farumxrpou4olt  feiysfaDrauvonu0trxnmr3oydlpDe u o;t0 2ur(o nu1alenmfvilt srraxmonu1tptnmictat sDemnvont)tetrmr iydfatrau i;()truoxo3oo1op elnvtlt aDururp;o4apeomiciatlm2ulu snt)treoircoytfaDe i i (  rxrio3iy1lme lict s sDra( pno0oltn ietlsfsDrm( s t4artrmf ta1fpD  uvo s)sexoimpnudom emivtat a2tm( ont4tptomoeiytfs rauvo;u)arxnifciodomtrauvi;t trumxm3ou4lm emfci tfsrrr(ront1ale  ietysfm2eaums () rtoif3iatlaD  nvi;s)t2xo(o nu1lptnmnvs (f 2tax pnu0aetomfcildlm ea(vp;u4arxomf ta1lmt liei s  2xoxmpio1om e neslt) Drmu ont1opx  fciysla2em(vont)alxrmo oo1fmtelivs s0tetr(o3nodom n ivsltf Dra(m nt1texoifeild sDrlump t4alenir ty1oaD lieo;( trxmirpny4al e nct (faDurumpoo0tet  ieiytfs2ran pn(4trxnxr3oo1op r ivs s)s2toim no4llte ies s  Dtmu o;o4openif3ilsfm2emn pnu0artrmrcoydfmtrau i t0truoim nodlmee nvtat)arumu pou4oex io3tltla2eau s;u4tltnio oatlp e uvi (0 eumim oy4lmeelfeslt)arua( pot0oeeo ieildfa umu on(0tlxnif3iy1faD luvsl( teurimpnodlp elfvias aDrmxrp;t4opeomfciyd aDrmuvsnu4 rxoxocoy1oaD  nvil() exr(m3iydlme lfesas s2ur(mo;u4oex  ociysfa2elu o;t0aleomocoo1lm rai o;s teumxr3ou1lltelneiltf Drmxr oo4apx  i3iltla ra(vs;u) exoxfcto1oatr uvilt0texo(rpou1llt miei ( sDtrur nu0tptnmfctat a uaumo;u4 exriociytlat aneo s  2xrir3io4lpenmnvsls) rraxm no1tlen i3tadfm2ua(vs;u4trtrmrciytoa e n i ()s2tm(r iu4ope lfesl(f 2taum nu0tex  ieiysfm2rl(mp (0tltrmr oatfaDe ieo;t trtoirpio4ap elnes sfs2tr( oou1alxn oetadla ulnms u0altnmo3oa1fpt lueol(  eumxm ou4al emnet ()aDtrurp;t0teenmfciys a2rmuvo;u)trxoio ta1om  li o;s0seurirpoodom nlfetls) 2ra(ront0opxn icilsla rmnvs;t0trtnio3ootoatelu ol( srxrxm nudolen nctatfa2uaumo;o1aeen i3tas m2ra( on(0 ltnmfctytfm e neil( srxr(mpiu1alt mfvs ( s2umumpoo1oexoii3tas aDemuvs u4tleoir3oatfm elnvs s  exm(m3iodlptemnes (faDuax  ;u1apxn ieiys sDeln p u)treoxfciadomt luvol(0t2uo(o3oydap   fct t  2raxrpno4olenmoeiyt m ea( s;()artrifcto1fat  uesl() eumim3nu1om elivi s)a2rmu p;o0apto fciydfs2el(vp;() rerxociodopt an s;(  2xr(r3oy4ll nlfeilt s2ta(ronu0aee moetas s ea(vo;u4 rxrmo iodfptranvil()sexo(o io4lmtn nctlsf Durx o;u4tet io3ildla rmuvp (0 lxrxo iy1omD lieslt  eumxopny1lpt mivsatf Duau  ;o4ape if3ild sDrmnmsnu)texoxo iy1lpD ln slt)t2umxo nudam e fvtlt)srrrum ;o0alenmoeiyd s2ean s t0altnxr iatlmDeanvo;t) euo(r ou4ll elietl( aDururoot1oeto oetls mDrlumo;()treoio3oa1oate neols0srxmirpiu1ameelnvtl( aDra( onu0aexn ocils a el(vo u0 etrmf3oadopDr nvs (  euoxm3oo4optemfct ( aDtm(mo;o1aptoii3iytla rlu p;u4 ltniocoytfa eaivs;s) etm(mpny4ome lfvs s sDtmxmpou1alx  o3iad s uanmo t4tetnmrciadfat  ieo;() rxo(o3io4op nmnes t) Drm(mpot0alxn oeiydlm ua( p t0 exnxfcoy1fpt livo;(  eumxmpno4omt mnvi ()aDtau pou1apxo ieiatfa2rmnmp (0 lermf to1fp raivi t) 2xoir ny4ll e ncia(  2tr(  oo0altn o3tatlm eluvs;t0 reoxo oatlmtr u i t)srurxo3ou1ap  mieias) rrru oot4aex  iciltls em(vp t4trtrmr iotfaDr uvs;t0 2xo(m3oydomte iesat)artax  nu4oltn ieils s uanvo;() lermf iotomte ieilt0srumir iudom  mfes ()s2rax p;t4oexoif3tatfa rln o;t4trermf iydoa e ues;() exr(mpno4omenmivs (fsrtmum nu4opxomoeiyslm2ua(vs (0alxrxr3ta1latr neilt) 2xmxrpou4lptnmieils)a2tmxmpnu1olxniietas mDrmuvs (0 etnio iadfaD anvol( setrir3iy1lm  licil()arrrxronu0oex  o3iatlsDeln o (4 eeoxf iytfptrlnvs ()t2xm(rpny4apte net t)artm(mooo0tpe mociyt m ranmonu) ltrxfcty1fm rlueo;t) exrxo3iy4al n ieiasfsDtrx  ;u4tlxomoctlsfs rm( pnu4 ltrxocto1fmDraueols t2xr(mpnodll nmict sf rtm( pou0aexn f3ilsla2uauvonu4aetnxf iatop elnes;(0srtmxo3nydam  lnvilt) 2urxmp;o1oleo ocilslm ua( pnt)tetrmfcty1lpte n i t0s2um(m ou4al n fviat)aDrrx onu4ape  feiatfaDem( s u4 leoxo oa1oatr nvs;(0srxrio oodap   iesatfa2uaur nt4tlx io3ildls2rmnmpnt4tltomo3oatoaDrlneol(0 2toxr oo1op elnes ()a2ra(mpnu1tptomi3iadla2eau p ()alermfcoydfmtr ieol(  rxo(m nudlptemnetlt)srumx p;u4tlxnmi3tatlm rmnms;t4artoio iadfptranes;t teurxmpnudal elnct () 2tmurooo1aee mf3tlt a2rlumo u4 rtrir3oytfp e ueslt  2uoxr3oy4lpen fcsltf Dtr(rp;u1olto i3tldfaDumnmpnu4aexnxr3iytomteaivo s srto(r3iodaptnlicslt) rum(ronu1alenif3tld s2rluvsnt4altrmrciodopD anvs;s srtmxr ny1ap  lncias srraum ;o4oee iietlt a eaumsn(4alenmo3oadlaD  ivi;t s2xm(rpnu4lme  nci (fartmxmooo1tlxniieiyd a2ea(vont) lxnmr3iatlp elueils) rtrio nu1omtn nesa()aDuaxmpoo1alt ifctatlm rm( p;t4artnmoctotoa elieo s trto(rpnudomeemnetltfsDtm(ront0oet  ieiyt s2emumpnu4 reoif3iodlpte ivil(0 exrxopiu4omeelfcsl(fsDum( pot1tet mo3iasla uluvo t4alxrmr io1lmt li ols  2uoir3ou1al elnvt tfa2uru  ou0openio3iydlm rmumon()tlxoxr iodfpteln o s0srtmimpno4lltemnciat)arum( p;u0tle  i3iyt m2ul(vont0aexoio oatop rlnvsls0setoio3nu4altn nctas)sDtmum nu4tleomociydfm emn p;(0 lenmo3iadlpDrlnes;t0 exm(o iudoltemnei () 2trxmpno4tlen i3ilslmDemn p;u0texrif oatomDeaneils sexmxm io1ap n nviltfsrrm(  no4opxn feiasfm uluvo;u4alenmo iatfmD  i ols trtoxm ny4lmenmnvsls s2rm( poo4optoiiciltla uluvs ()tlxrifcoodfp elnes t)tetm(rpoo4ll e fei s)a2tmurono1olx  o3tlsla ea(ms (0 ltnmf3ty1opt  nei t t2urxmpiy1am   fvt t) 2umx  ot1tlxn feiadfs2rlumpnu0 rxrxf3oodfp e u i;() eum(r oo4ape  nvs tfs2umur ;u0teto ictls sDranmpnu0arxrxfciatopDe nei s0teum(o no1am emnvsl(farumumonu1alx  f3tas a ea( o;u)tlxrio oo1lpDeaies s) exm(m3ny1lleelfciltfaDumxm ou1tle moeilsfa rl( o t)tleoxf3oa1lptraiesl() etrir3oodam  lnvsas) Dtrxr ;o0aex mfciydla rlnms;u4 rxnxo tatfpt livs s) 2umirpiudolenmfei t) Drmump;u1altomieiysfaDeanmpnu0 lxnmf oo1fatrln il( srtrirpnu4lmtnlncils)s2ra(m ;u1teenmi3iydls2umuvs (0tltnxociotom rau s s  rxoio ou1om  mnvi (fsrta( poo1opxniictydla raump;(0 exnmo oodlp elneo s)trurirpoodlpenlfcsasf rurx  no1aetnmociatla2ra( onu)aetrxo iotfpteluvi;s  2urxo3oo1lpenliciltfarrrxro;t0oltoif3tlslm2rm(vp u0 eeoxo3ta1laDelu o;s trtrim oo4opeelfetl()arrru oot1teeo fctldfs elnvp;()aexoxociatoatelnes s)t2tm(r nudlle  fvsls  rtmxrp;o1aeto fciasla2uluvo t4arxnxfcoytlpD  n i s0 eur(m3iy1amt mfet ()srur(mono1optn ieiadfa ulnmonu0tleomr3iydfa elies t)tetrim3oy4omee iei s  Drru  no4oexnifeiadfs em(vp;u0aetnxo3oytlmteaueo t0 2toxmpoo4al emnvs t)a2uaxrpno1olx mf3ilt m2ra( sn(4 leomfcoadfaDeluvs t0s2tr(m iu4omtnlneil( srur(r nu0oeen oeiadfm2ra(vs t4alxnxr to1latr nei s)texoir iudlmeemfetls  Dua(  ot0alt mfcilslm2eaumon(4alxnmo oodoaD  ues;()sexoxm3ny1lltn ivsls  Durxmont0oetoii3tas a2rlu p u)aetnmo3oa1lm eaueils sexoim3ny1amee feil(f 2umx  no1tptnio3iadfm rmu s u) eeoirciodfa r u ils0texmir3oy1ome lnvtltfs2rrurpou4ale  fciytfsDeau s;t)teermocio1lmDr ueol()sexo(m3iudape  ncs tfsrrmum ou1apeo o3ildfmDrlnvp u0aexrxo io1lpDraneo;t trtoio oo4omtn fvsa() Durxmo;u4aex  i3tltlm rmuvon(0trenxf3ia1oateln s;(0teuoxrpnu4omtemnei sfa2rau o;u4oex mf3tys aDelu s (4areoir3oydfpDeluvo () 2toir io4am   ictls sDtmu  ot1apt  f3tas m2ra(vs;(4 lxnif3totlmte nvilt0trxrxm no1olee ieiatfsrtr( p;o0olxnmietltls2elums t)aetnxr3oo1laDrli i;(0seur(o io1ll nlfesa(fsDum(  ;t4tle iocilslmDranvo;t4aeenmrciytfa   neo t0 exrim3ou1ol nlnetas  rtm(rpou0tex  ietadfmDul( ont4 etrmr3ia1fm  anes t) eurxm iodap nlfet ( s2raumpnu0tleo oeiasfa ea(vo;u4 leomr3iytfptrln o (  ruoxo no4apenlfvslt sruaumpoo4tpeoifcildla2eluvs;(4alxrir tatoa  aiesls0t2xmxm no1aleelnei sf rumu p;u1oex io3tas aDuanvo () rermrciotfaDrlues (0s2urim3no4optnlfeils  rrrxmo;o4texnii3iys a2ulnvs u4trxoio3tadlatrli o;t srtoxm iu4om  mfetat srra(mpnt0tet  feilsfm2ul(mo t0tlerxo oa1fa r ues;s  rur(opio4ale mneil(  rur(roou4oexnmietld a2uauvs;u)aeermr3ta1omteai s ()srtmxm oo4lpen ieslsfsrumumo;o0tlxn f3iad aDra(vo;(4aetnxr to1fpDrlues s0srxriopiy4ll nlfesls sDum(r nt1olxnmf3tysls2umnmpnu) lerio3iotoaDean ols0t2to(r iu1optemfviat  rurxmoot0tlx  ieiatfa2emump;(0alermo3oa1om elieol(0 euoim3oo4lle licilt) rra(r ou0oleoiocilslaDumu o u4tltnio3oatfp rlu sls0 eurxm3no1ale lfctas)srraumont4opeo feias m umn o () rtrif io1laDrlivo;s0t2xo(opny1lpenmies s aruru pnu1optn i3iytlaDrmnvo;(0arxoxr iotfmD lnei () ruo(o3nudale  ieiat) 2tmxrp;u0ape iietytfaDuanvp u)texomfciy1oaD anvi (0teum(r no1ll   nvt sfs2tmxroot1aeeoiiciadfm2umnvpnu)teenxo3iotoa rlu i t s2xo(m no4altemiciatfarumxr ;t1oeen f3iatlmDum(vp u4aeeomrciytlmteaivi t0srtrir iudol nmnvia()a2um(mp;u4aleomfctyt sDumu onu4trtnxr oatlm eaieo ()s2uoir3oy4lptemivi ( aDtaur ;u1oet  f3iyt aDraump;u4aetnirciadlp   neo t s2xoxrpiy1oleemnvs s) 2rrurooo0apx  ocildlsDra( onu4arenir3iytlaD lnvi t t2urxr iudapt  fvslsfs2trxroou1oexniictad aDrln s (4teeoxf tatlpDe ues s) 2to(r3oydop emncta(farrr( oou4olt moeiatfsDranms;t4 exrmr tytfp eaiei;s) rumxrpoo4opeemfcilt srra(r ;o1oeenii3iytfmDuanms u4 etnir3io1lptelnes;t)trum(o3iy4lpe  ics s  2ur(r ou4teenmicilsfs umnvpn()tlxnxr3tadoptr ueils  eum(m nu4openmici ()a2tmxr ou0aex moeiltlsDul(vp;t4tlerifciadlm eanvs t trtrxo3oy1apt lictlt)aDrrxr ;o0olto o3iytlm rm(mo;(0 renxf oytoa  au ilt0 2ur(m3ny4aptemics s) rtmumo;u4tetnifciysfs2rl( p t4aeenif todom rlu i (0trtoxopoo4lltnmiei tfartrxrono4alxomoeiytlm uaumsn(4alxoir tydlptelieo;()seuriopoo4omt lictas arrax p;u1apt  fetysfm2ulnvpn()trtrxr iy1opD lneo t tetoirpoo4amtemfvtas)a2taumoou1tle ii3ildls2rmu s;()tetrxo tytomD  u o;s0texr(mpoy4llen fet (fa2tmumonu4tle  ietytlm2um(vsnu) ltnxo todop  ln i;t  2uo(rpiu1ole  ivil(  Dtaurooo1tex  fciatlm rauvont4tetnxo oa1op  an olt0teto(m3iu4optn icslt)a2tr(  ot0ale io3ildfm2umump;t) rxoif iotlpDe nvo ()s2urxo3no1ope licta() 2ur(r oo4tlxniictlsfsDua( o;t4trerxo3to1lm   i i t)srtoim oy4ameelfvia(farua(  ou1aexomocils s uauvpnu) etnxrctadoa e neo (0trxoxmpiudol elictlsfs2ra(rono0oleniiciyd a ul( sn(4artnifcoa1late uei t)s2xmio oo4am  mictat)sDrr(rp;o0olxo ietlslm2umu s;t0tltnif oy1lmD lnvs;s)texm(m3ou4am elietat)sDtr(  nt4teeo f3ildls2rlums;t)tleomrcoytomtrlu i ()s2xmxopny4al  lnesl(  2tmuro;u1ole if3iydfaDrmn p t0tleoiocia1om elnes s)s2xrxmpiy1ome mfciat)arrax ont1teeoiictat aDranmp;u0 lenxr3oatom   ueo;(0 exo(opoo1ll nlnct t)s2ta(  ou0texoioctys s umump;()tlxnxoctatopD aues s texoxm3nydlm  mnesa(fs2ta(mp;t1ope ifeild s ul( s;u)alxrio3iy1laDe nvi t)s2xoxo3ny1lp nmnciasf 2ua(moot0altoio3iydlaDeln o t0alxoxfcty1opDeanes t) eurir3iudlpt  nei s  Dumx  ;t4tex mieiatfm rlu on(4altrioctodlaDeauvi;t texr(m3ou1lme mfvsl(f rtmxmpno1altomi3tyt mDrmumsnu4altoxo tatomDe i i t srxrio3iydop e fcsl()sDtm(rpou0apeomfeiys mDuau on()tetrmf3ty1omt lueo;s) rxm(r3oo1lp emfvsa( s2uaxro;o1ale  ocilsls2elu o (0alxrxrciodop rau sls)setmxmpiydlpee fvsas aDuax o;u0aexniieiasfa uln p u0 lerif todlmD luvsl(0s2uoio oo4lp e ncs t a2uax oot4teenmieiydfmDrm(vs ()teerxr ootlmtrlieslt s2uo(r3iydoltn nvt s  2tr(  nt0oexnifcilsla2el( pnt)aeermfciatoaDr i o s0truoxm ny1lmtnlfcia(  Dum(m oo4tpt mi3ild aDrlnvp u0alxnifciytfmtrauvo;s)t2trio oydlpt  nvtatfsDumxroot4apt iietldfm ua(vs;t)trxniocoa1fp r nvs;t0trtm(mpoy1opt  ivilsf 2uaur ou0tlxo i3iadlaDea(mon(0 lxrxr oytlaDr neo () 2to(m3oydlpenmivslsfaDrmur ;u1aptoif3iatlsDrmu on(4 lxnmfctodlpDrlueo (  eur(m nu1opt liei ( aDrm(  oo0olxn ocilt s elu onu)alxnxo oo1lmDr ivs t t2umxopnu1ole  fvtas  Duaxmoou1apeomi3ias m ea( o;t0teeoif tytopDelu o () rtoim nudal e ieslt s2ururp;u4aet mf3tld s2uan o;u0altnif io1lmtrlu i;t) 2uoxopno4llt lfcsas)artmxmonu0apx io3tldfm2ra(vp (0arxnxfciodfpt  ivi;( seuoxm oy1altnmfci (farurxm oo1alx iiciatfm rmnmo (4 renifcoy1fmDe u o;()t2toxrpio1lltnlfctl()arur(rp;u4opx mfcilsfm ea(ms () rtrif3iatomte iesl()trum(rpiy4om nmncia(f rrrumonu1oleomoeilsla2ulnmont) exomo3oytlp eln olt t2trimpnodom nmnci s)srurxmpno1aptn fetatls2umnvp;t4alxomf todopDr uvolt trurxr3oo4omtelfvt ()sDrau oou0opxomociatfa2em(mp;u0tlxrmf3to1opt  nvo;(  etoimpno1ome  nei ()a2trum ou4olto iciytlsDem(mont)tltoxr iy1fat  nvo;t0t2umio3nodlp nmieilsfa2rm(  ;u1apeo fetat m2umnmp (0aexomfcoatfpteauvs;( teuoim oy4omtemivsls  Dtru ont1open fetyslmDuln s u4tlermo3oadlaDelivol(  2trxmpoudolt micil(  rrrx p;u1aetomf3ildlmDrmuvp;t4 lxnmf3ty1fmte n s (  eurimpiy1al nlfei (fsrtrxmoot1tpx  fciatfsDuanmsnu0tlenmf3tydla e nvi;t) 2trir io1lleemfctat) 2tmuroot1aee  oeilslaDeluvs u4tlxoxf3oy1oa  an o;s0 eumxr3oydamenlfesas  rta( o;t4tee  ietatfmDem(mo (0alxomo ia1lp r ivi;s) 2xrxm io4lm elneilt  2ua( o;o1aexnifeiltlaDulnvo (0aexoio oodom r n o;s  etrio nudape  fesasf Dumxrpou1oexnmociydfm2emnvo;t)alxoxrciytomD lnei ()srtmxrpoo1al e fei sf rtm(  ou0tleo icils a ul( p u4 etoxf3oodoa e ues s) 2xo(o3io4am elnvsatf Dumxr ou0tpxniietatfa2ranmo;(0 rxoxocia1faDr i o;s  2umimpnu4olen ivia(fs2tmxrpot1apxomiciatlmDulu sn() exrif3ta1lmD ai il(  exmxr3io1lp  livs t)artaxrpnt0apt mfciadfmDemn p () lxomoctydopD aieo;s)srtr(o3oy4aleelictat  2rrx poo1oetoiictysfm2elnvs u4tlxrxrcio1lp eaneils t2umxopoodaptelnvi s) Drr(rooo4apeoifciat s ean p u0alxrxf tadopDrau i;s0trumxr3ou4am emiesa()arrru p;u1tex  iciys m2em(mo;()aleoio3oytopt auvo (0 rtrir3oudaptn nvtat a2trx o;u4oetoif3iatfmDemuvsnt) etnxfciytfp eai s s0seumir3oy4ol   icsls)s2ta(r oo1aet ioeiadls emnvsnu4 rxnio3iodfaDrlnes s0s2xoxr3oudaleelnvt (  Drru oou1opt miciytfmDra(ms u4trxnmf oy1omDe ivs;s) rxm(rpiu4lpe  ieil() Dtmxm ;o0aptnmfeiaslm rlumsnu)artoxocoydlptran s;( t2xrim3io4ol nlivtas a2tm(mono0olx mfciasfm2rlumo t) eeomoctodfa  auvo;t) rumxmpoodlme lnes sf Dururp;t1texn ieiltlsDrl( snu)trenmo3tadlaDe iei;t0 2xo(r3oy4lpeemfvsat sDumu  oo0aexniieiydfmDeanmo (4aexrxf3iodoaD  neilt tetrim iy4apte ici sf Drm(m no4alx micias sDeaump;()trerxr3tadoptelnvs;t)setm(o iodomtnlies t)aDumxmo;t4apxnmi3tltfs2ul(ms u) rtoirciotlp eaneo;s0setriopnodaleelietl( srrr(m nu1olxn icias mDrmumsn(0trxrxfcoytlm e n i;(0t2xm(m3ou1am   net tf Duru p;t4tetoii3tlslsDranmp;(4aetnxf totlaDrluesls0trxmiopiy4am nmics t)a2uru  oo4oeeoiociys m rmnmsnt4aexoxo oy1fpt an i s0srxo(o ou1opt mnvi ( a2tmu p;t4tltniieiasfs2emumo;u4trtrmrciodlaDranvolt) 2xmim3io4alt mnvsl()sDrmu pot4aexomoetadlmDulumsnu4tlxnmrciytopDr u il()t2tmxm3iudameemfcil(fsrumxmoou1tex  o3tasfsDelu o;u)artoxfcia1lpDrauvsls0 rxm(m nudapeemnet t a2rru pno1olx mf3iys mDemuvon(0aetnmocoydlmD  ueils0 eto(opny1ape mies () rrrxmp;t1open fciltfmDuluvo u0aeeomociydfpt  n i ( srxoxr iudale  iesa(faruaum oo4apenif3tlsfa2rlu s (0treoirciotla eaivsl(  rxrirpno4aleelivil( s2tmurp;t1tltnmociytls2ra( p t)arerxr3totlmt liei;t0 2um(opiudoptelics tfa2tau  ;u1ole  f3iysfa2ua( s;t4trtoircoydfmt lueo () rxmim3nu4ame  nvi ()artr(r oo1ape iieiytla2rmu p;(4arxrmo oa1opDe u ils)s2umimpio1op n fet ( aDum(rp;t1aee mo3iydlmDeaump t) lxoxfcty1late neo t0t2xrxopno1ol  lnvta(  Drmxr ot4aeeomi3iydls umn p;u0altomocoa1laD auei ()s2tmim3iu1am nlfcsls) Durumoot1tpxo f3iyt aDeaump u0 ltnmr3oy1oaDrlnvi;() 2toxo iudom   iet s  2umurp;o4apto ictat a elumo;(0 eeoxr3to1oatrlivil(0t2xr(mpiu4lpt mnvtls  Dum(r no0texoif3ilt m2rlnmp t4alxoio3totoa eau i ()t2xmio oodomeemiesas) rtmx p;t4apxomfeild aDrlumpn()artnirciytlpte uvo;s trxrxmpiu1om emicsltfsrumu ono4apx mfetydfa ranmon(4altoiociatomt luvs s0 2uoxm3nydll elnetls)srrrxmooo4oexn o3tldla2ea(ms u)tetnxf3iodlmt  ues ()sexrxmpno1lpe mfctas)aDumur nu0optoii3ilsfs el( on(0alxrxf3oatfp  aiesls  eto(mpoo4am   ies t) Drm(rpno1texnifcilt m2rauvs;t4trtoir iodfmD aivo t) rurxr iydll n ivil() Dtmuro;o0oltnifetys m2umu s t4 eerif3tadlmDr u s;t0 2trim oudoptnmics (fsDraxm ;t1aleomiciat a2umnvsnt)aexrmr3tydopDeln olt0sexoim3nydaleemivt sfaDtau pnt1alx mocild s umnmp t0texnmo ia1lpDelivi;s srur(r iy4lltn ict t) 2raxmont1tltn f3iytla2rmu o;u4tltrxr3iydomtranei;s)trtmxo3no1al n fvta(fsDumumo;u0aet io3tadls el( on(4tlxnmrcoo1om  aieo t0texmio3iu4omenmict tfsDrr(mpot0tpenmieiydfs2eanmp u) etoirciotlat livs ()tetr(m ny4om n iet s)sDtmu  nt4olt  f3tldla eau onu)altrxrciydfpt  n o (  rur(opiy1oltnlfviat arrmxmoou0opto fciyd aDrm(ms;()aeenir3tatoat lnei t0 rumimpiudlpte feta(  rrrx o;o0tpx moeiltfsDeanvs;u4 rtoxr iadfat lneo (  rumirpou1lm nlivt t)arraumoou4tex moeiasfm2uanvsnu4 lenif tadopDrau s ( srtm(rpoodaptn fvs sfsrum(ront4tpe mociasfa2rlnvs;(4 lenir3tatomD  nvo s)s2trirpiudapt mncsa() 2trurooo4tee  feildlm umu s t4trtoxo oatlat  ivs () rxoim3iydoltn ivt t) rta(mpnu4optniieiltfsDemnmon(4trtomf3oydlaD lieols trxrxmpiy1alenmnci s s2rmumpnt0olto ocildls2uanmp;u0 ltnmfcia1fmDeauvi;t0setmxo iy4al  micsl( a2ta(root1alenifeilslm rmn snt0trtnifcoy1op  aues t) exmir ny4al n netlt)a2tru oou1apeomf3iyslm um( p u4arerxrciytomtrai il( trxoio3io4olt lnvsa() Dum(m nt1tetnio3iys sDua(ms;t)texnmf3tytlmD ln o;( s2xmio ny1op  miciat)s2uaurpot0opx  ocilsfaDrmuvsn(4arerxrcoatfp eau i;t0seuoxo iy1llt mneiatf 2uauronu1aex mf3tytls2umumpn(0 etnmfcoatlat livols)trtm(mpiy4ol  lfeta(  rtmxr ;o4tle moetyd a2eau p;t4arerircio1fa rli s;(0 exoxo ny4ope mnet sfartm(mpou0tpenmf3ilt m2el(mo u4trxnio iy1fateanes;t0 2toxr oo4lpe mfesasfs2tr(rono0aet  fciatla2uln s (4tetoirctotlp elnvs s0s2tmim iy4alt  feiasf 2rr( pno0alxomietadla rlu pnt0 rxoxr3iatlp   nvi ()s2xmxm iy4am n fetlsf rta(  ot0aleoioeiysfa2rmuvp (4trtnif3iy1faD  ies;s)texrxr3oydope  ictl( artmx  ot1olt mfcild m rl(vs;u4 rxnxo3oodop rln i ()t2toirpiodaltnlfeiltfs2trxronu1opxnmoeiad s2elnvp u0aetnirctotfa ean o;t)trxmiopoodopeemicia(faDtru  ;t1opto ocilsfaDeau o u)alxrir ia1lp elnes ( texoxr3ny1lle mfvta()artaumpoo4opxoii3taslsDem(vpn() exrxr3iydomDelnvs;()t2xrxm3nu4olt lnetasf Duaxmono1olxomociltfm ean s;t0trenxocoa1omDrlieilt)sexm(rpnydolte fes s aruaumont0olxnmoeiytlsDrmn p t0 lerircio1lm e uvsl(  rxmiopoy1olenlfeils  rra(  ot4olto o3ilt s2rlums;t)artrirctotfm eln ol() rtrxrpou4am e fvil(fsDurumont0ole if3tas m uln p;u4 ltrxrciadop e ivilt  2umxopoy4lpeelnvsa(faDtrump;t0aet mo3iat s ul( o;t0 reoif3oytfaDe i sl( t2tm(r nu4alt  nviatfaDtrxmoou0tlxn feiytfa2ea( onu0artnmr3ootopDeln ilt)t2xrxr3oo1ole mfcs s)aDtaump;o1tet mfcilsfm emu o (4 eenmf iydopteln o (0srurir3iodapt mivta(  Dumum ou1opxomicildlaDean onu0trtnir3oydlptrlueilt)truo(mpnodlp   ivsat arrm(rpou0tee io3tlt a ranvo u0tltoiocio1oa   uvi ( s2tmio ou1lmtn ici sfaDtmxr nu0apt ifeiytfs2rmn o t)alxrir3oy1lmt lu s;t0 etrir3io4altnlneta( s2ra(rooo4teeo oeiad s2eluvo (0artrioctytfatrlu o;(0s2xoxm nudaltnlnvsasf 2uaxmo;t0oetoifctyt mDumuvs u) lxrmo tytop eli i (0t2umir3oodamenmnvsl( srta(mp;t1tle ifetatlsDem(vont0trerxf3ty1omtraneolt)t2uo(r oo4om e ncsas  2ta(rpot0texnifetatla umump t0 lxomf3oytfaD luei t) 2xrim iodlp emnct sfs2rrxmo;u0optn iciysfm rmu s;t)aexoir oodlm rlieo;t0texmxopoy4am nmnet s a2rm( pnt4ale  oetadfs2uanvo (4treoioctodla   u o;t t2xo(rpiodoltnlfvta()arrm( oot1oeto ociasls ra(msn(4tetomr oatomt  nvi s0t2xrxopiu4ame mieias)srraxrp;t0aptnmiciadfs2uluvo u4aeenxocoatoa rln ols0sruriopou1llenmnvslsfa2rmxm ot0ape  fciydla2umuvp;t0tetoxoctodlat lneils  2umxr3iydomenlnvi t  2rr(mp;o1apeo f3ildlsDul( pn(4 etrmf3ty1fp   i s ()seurxm3ny4lm n fvi ()aDta(mo;u0apxomocias m2emumont)tetomr3ootfp rlu o;(0seumio3iy4olt  ivs sfsDtaur ;u1olx  i3ildfm uanvo (4texrmr oa1fpD  n il() 2tm(rpno4lltelivil(f Durx pno4apxo fctydfm2ea(vo t) etoxf to1lmD lies () rur(mpio1ol emnct t)srumu  ;u4tex mi3iytls2um( ont)tetrircoy1oa eaieo s) ruoim iodoltnlics () 2ua(m ;t0oeen i3tls mDuan o t0tlxnio3tydlpteanvs;s teto(r3iu4llt  fviasf Duaxmpou1aptnmoctasfmDem(vont0texnmr3todlm rlies;()srtm(o3ou4lpt mivtlt  Dumurpoo0tetnmo3ils a2um(vo;u4teeomo tatla  auvi (  rumio3io1ll  mfcslt  Drrxr oo1texomi3ils mDeaums;u4aetrio ootfmteln s t  rtoxrpno4altnmictltfaDta( ono1apxo ieild sDrau s u)trtomfcto1om r uvilt)s2xrim3nu1ll e ies t aDrmu  ou4tet  o3iatlm ulnms;t4 rxrir oadfaDelnvol( teuoirpio1ap  lietlt aDrm(mooo0oleomo3tytfa ulnms t0texnxo3oatom elivi ( trurxrpiy4lptnmfvta(fs2rmx  ;t1ole mo3ildlmDumumpn()teenmfctadla e uei t trtoimpiu1omte ncsls a2taurpoo4ape mfetasls2em(msnu0altomo3oy1fatrli slt s2umxo3iu4lpee netasfarrau pno1opxnmicils s2el(mo (4trtrmr3oadfa   neils0 rtr(m ny1lpenlfcs (faDtr(r ;u4aee  iciytfs2emumsnt0alxriocoytopt anvo t)truoirpoodap elicsl()artr(r ;t0tleomictldla2rl( s;u0aexrxrciytfm e nvil(  rxr(o3nu1olte ivilt sDtmx  ;t4tltomocildla2ran pnu) reoxfciadfpDraivils trtr(r3ou4lleelnetat s2rau  oo4tlt ii3tltlaDuan snt4 leoxr iotlmtrli i ( t2xo(rpio1lm elncil() Dtmx p;o4oetoif3tyd s elu s;u)tlenir tadopDeanei ()teumxo oo1optnmnes (farrrxmo;u1olxo fcias m ulu o t4tetoif oadopDr nvi;t0setrxrpoo4lmtnmfet () Drru  ou0aeenmfeiys s2umn p (4 exomocoo1oaDeln sls0texrxm iu1alen iesas aDrau  ot1apeo ietydla2uauvpnt0aexnxf oadopteanvols t2xmio3oy4ole mics (  2urx oot1oetomo3tls a2rlums;u)trxnifciatom eli i t0s2toxrpiy4alt mncsl()aDumum no1opt iictatlaDumn p;u4tltnmfctydlpD lnesl()tetr(m iy1ale mncs (  rta(ro;t0tpe ifetytfmDraumo;t)trxomfciotfaDe ues;s)trxm(opoodlmen nvsas) rtrur ;u4oet  ietyd s2el( s;t0aeeomr3tydfa   ivi;t)srtmio nodll  micsl()a2rm(  ;o0tpe  f3tls m um( s;(0tetoxo3oa1lm eaneslt) exr(m3oydom emncsas) 2raum ;u0olen feiyt m ranms;t)treomo3iytopDrlu i;()srtrirpoo4lpeemivsasfsrum(mo;u1tetn i3iltfs ul(mp (0altrxrctadlmt lu ol(0t2toim3oodom nlivsl( artmurpot1teeo ietldfmDrm(mp t4 eerir iotop eauvo t trto(opou1om nlnctat a2rau  nu1apxnif3iyt s2rm( on() leoxfcoadfm rln o;t)s2xrio3oy1ll nmnvias a2rr(  ;o4alxn feiyd sDrm(ms u) ltnxf oy1fm elivs () 2uoio3nudlpt  fesasfa2rmu  ot0opeoii3iyd m2um(vpn()treoxr oy1fm  ln sls0 ruo(r3iu1lle  icta() rtaxmpot0oeto ociyslaDraump t0arxrxo oa1fmDrlnvo s)teum(o3io4altn ncsa()s2umum oo4teenmfciltls2elumpn()treoxo3iotlaDrluvs s0texmio nodomtnlfeil(farumxmp;o4tpx  feilsla2umnms t)alenio3oa1optr ues;s s2xoxo3no4al  lnciat arrmxrp;o4tpenmieiydls2eaumo t4 rxnif iytlm ranei t0seumim ou1lm  mfesls s2tm(rp;u0tetn fctatfaDua(msnu4teeomr ootoateluei (0 etm(r ou1lme lictatfa2ur(r no0aleo fciyslm emnvo t) ltnio tadlmtr i s (0 2xoirpiodomeemiviasf Drm(ro;u0tlenmf3tydlm ua(vont)aetoxf3tydfmt au ol()t2uoxo oo4al   ictl(farum(r ;o1tle iociad a2rluvo;t)trtomo oadla eanes t  2xm(o3oo1lp elict s arurur ot0aet  feiytfmDua( s t0trenxocoodoa   nvs;(0s2toxm3nu1ol nmivsl( s2taxmoou1opt  ocildlaDem(vs;u4 eerxf3todopDr ieo t0 rum(o nydam emnvia(  2tmur ;o4tlt ioeiysls2uan snt0trxnxo ootlatranvi s)tetrim iydope mncs s)aDuaur oo1oet  icildfa ulnmsnu) rxnir3ta1lmDe nvolt)s2to(m nydal nmnct ( aDuaurpoo4apenmietld m umuvo (0altrxr3iytlaDe n i;()s2ur(opno1ope  net ( srrrx pou4tlxomo3iatlm rauvo u0 rxrmf iodfm   i o s0t2ur(m oudlm emneiat)artmum oo0opxo ieiytfsDeln p;u0tetnxocoydlm   nvo ()setrxo oodlm elnet s) 2trx ono1altoioctadlmDeauvs (4altnxfciytfptrau s s0setoio3oydolen nvs t)srtr(r ;t4alt io3iadfm ul(vp;t4teermociytla eluvi;s)srtoxm3iu4lp n fct s)sDuru  ;o0tle mfeiysfs2umuvsnt)alermo todfmteliei;s srxoxmpiu4apenmfcias)arta( onu4teeomfeiatla rm( p (4 rxnir3ty1oa r ivsls srurxmpou4ol  mfei t srrrumpot0tlx mfeiyslmDrmnvo;u)alxrircoatfat  uvs t)s2tmim oy4ole lnes tfs2uru ont0olenmicilslmDumu s;t) lxoxo ta1lp e nvslt s2xo(rpiydll   fvt (faDua( oou0aptnmo3iad aDua( snu) rxnif tytlat  n s s)t2ur(m3no1om e iesat  Durumpoo0aptomo3tydlm umumo;t0 lxnmociodop eln ilt0trtmimpiu4ameemnvil(f Drrx pnt0open fcilsla eau o;()aexomo oadomDrln sls0trtoxrpio4oltn nesltf rtaurpnu4aee mfeiytlm2rmuvpn(4tltrxrctodfaD aivsl(  exmxr3nu4amenmivtlt)s2urum ;t1tpt  o3ias aDeau s;u4trermo iatlpte nes t  2xmxrpiu4op e fei tfsrrm(roou4apt  f3iltfs eluvonu4teermf3oadoa   nes;s) rxmxo iudam  mfviatfartrx  ot0tptomictysfm2uln pnt)trtnmrctotom r ivs;t  etm(opno1ape  nvs t) 2rm(root4alxnmocild m2eau p;u0tetomr ootomD  nei t0t2urim3ou1omtnmnct s) 2um(m ot1tltnmiciltls umnvsn(0 lxnxo ty1oat ai i s) 2xoim no1ole mietl()artru pnt0oltniicildls2uau o u4 ltrmr3ta1lpteliesl( teumxmpnu4altn ieiat)sDumuroot4oet moetat m elnmo;u4alenmo3oatomtelu o;(0trur(m ou1alt lfvsa(faDum( onu4tex ifeils mDuauvs t) ltrxo3iotoaD li o s s2xr(o oo1ope mictl(faDumx  nt1tle ifciasfmDeau sn() ltnirciytfp e uvs;( t2uoxo3iy4lltnmnvt () 2umur ;o4tetomietltfs2eluvsnu0aexnir3oa1faDrau s t t2xm(m3iu1optn ics tfs2uauro;o0aet io3iadfsDel(mpnt4trtnxf3to1lp r i i s0s2xrxo3nydoltelnvi t)a2um( ooo4alxn iciydlmDrl(mon(0 rtoxr3oodomDeluesls)seumxo3iu4apeemivtlsfaruru poo0opx mo3iyslm2rmnvsn(4trtoxf3tatfaDr ivo;s  euoxr3ou1lpte nvils)aDumxrono4teenmfcias s rmnvs t4altoxo3ootomDraneo s0 rxoir io4lm elicil() 2tmxm ;t0texn ietltfa2ra(mo;t)texnir ta1lpDeaues t)trtrir3nydameeliciasfsDtrumooo4ape  i3tatla2emums;()altrio iytfmteli o;( srtoio nydaleemieiasfs2rrxrp;o1opxo ocils mDrmu p;u)tlerifcta1omD  ueslt) etm(m oo1alt mfeilt)aDurx  nt4tlto i3iltla2eauvs u0 etnmr oy1fm eaivolt0srxoxopnydamee fvi s aDrmxmpno0tlx mi3iatfsDumnvs;t) rerifcio1oa  aueil( sexr(m nu4apt  netasfsDurumpnu4oet  feiad a2rlnmo;t) etnmfcia1oa rlu i t)srxmir nu4altnmiesas srtmum ;u1open f3ilsfa2ulu p (4altrmo tatop rlieils s2xmxopnu4alee ncs () 2trx  ou4tee  oeiat m emuvs;t4texrmr3oo1laDrau olt0 2tmxo3oydam n nes (fa2urx oot0alxo i3iyt a rln s;u0aetrxr ta1fate u s s srxrxrpio1alt  fcia()a2rm(mp;u4aeen iciatlaDrlnvs t) ltrxo3ta1op r nvslt0t2xrxo3oo4am elnvsa() rtm(r ot4optn o3ildls elnmonu4tleomo iotlptraneilt0 euoirpou1om e ivilt arum( oou1oleo ietls s elnms t)teenxr iy1optr ies;() 2toxr nodal nlnvtl()s2ra(mp;t1oeeoiictytfs rl( p u4 reoxo3oadoaD aiei s0trxoir3ou1ole liei t s2urx poo0olxoifeiatfs2ua( snu0 rtnxr3tatlaD  ueo (0seum(o iu1alte ies ( sDur( poo4aee mfetls sDeauvp u4alxnif3oadla e nvo;t)texm(opoydol nmfcilt) rum(mont0olt mociadla ranms;(4 etoxrcootlat ai i s) 2um(r3iu4lltn icsat) ruau  ot1tltn iciyt aDrluvp ()trtrxr3oa1opt lnesls) 2to(r ou4opt lncils)arurxmo;o0oee  ietltla2ulnmp (4alenio iy1lm eauvs;()s2ur(opoo1open ivsat) 2rmumono0opto iciyd a em( o u4 eeniociydfatraivs;s0srtriopnudapenlfesat)arumx  nu1alxoifetasfm rm(mo u)tltoxr3iadfp  aues;t  rtr(o3ny1opt  feils)s2tm(mp;t1altnif3tysfsDem(vo;t4aexnmo3iytlmD auvo;s0s2trxopoodol n ietls sDurum ot4ape ii3tatlaDelu s;t4artrio todlm raueo (  rtmiopiy1lmtn icias)sDrr( p;u0oleomi3iadfa2uanvpn(4tleoifcty1oa eau s;t0s2tmxmpoy4omtnmictatfa2tr(r ;u4ale  iciysfs2em(monu0 lxrmr3iodlpDelu i;s) 2xo(m io4am emici ()a2ta( pno4tltnmociatls2umnms t0 rxoxf3io1fmt  ivi;t trtr(mpiu1ap e ieiasfaDrmx o;u4openif3tldfm2emuvonu0tlermocia1lp r nvi;s sruoio3ou4altemivsl()sDtaxmpot1teto o3ilsls emnmo;(0 reomo3oytfpteanvi ()t2xmio3iudlleelfct sfs2ta(mpoo0aeeniociadfs rm(vpnu4 ltnir3iytlmDe n s;s0 etoxmpiydame  nvias) 2uaxmpno0apenmieilsfaDemumo;t4texnir3oytlaDr neo;s0texmxopnu1ol  lncilsfs2tmuro;o1aexomfeiad mDel( s (4teerxf ia1oa  anvo t  rxmimpiydlmte iciasfsDta(mpoo4oleo o3tlsfsDel(vs u4 etrxo oodfmte iei;t)truoxopno4ape lictasfs2urxm ou1tetn ietadfa2um(vs;u)tlerir tydfpteauvs;t)trxr(rpno4lmeemfvsl( sDraum ;t0aeenmfeildlm rmums t4 reoirciydfaDr i i;s t2tr(opnu1al  lncia(  rtm(r ;o0tetnmo3tad a ra(mp u4trxrxfcta1fpD lnvo;(  rurxm3iu1olenmiesat)aDrm( poo1apeniietlt s2eauvp u) lermrctotoaDelivo (0 etoxo io4olee nvt tfarrrurpnu0alt  f3iaslm2rmnvsnu4 exomfcoy1lp eli s;t0tetrxm3oydolt miei (  Dtrum ;t4olenioeiydls2ea( on(4 leoxr iotoaDrlnvols srto(r3ny1amtelfcsls)sDur(m nt1tlenmi3tyd aDuanvp;(4artrmo tytoaDrlivil()srtr(m iydopte fcsls) 2trumpoo0ale mf3iadls2elums u0alerio3oo1opDeli s;t)t2xrxr ny4olt mnetls) Dumxmpnu4oexoiociadfm2ua( pnu4teenxf3oatfmteai s;t  etrxm ny4amte ies tf Dumumpnt4tex mf3tlsla ea(vpn(4 ltrmf3ty1fmD  i s;t)s2uoxm io4op e fetl( s2tmxmpoo4tpto ieilslm rlnvpnu)arxnxo3iy1fmt  ieolt0setr(mpoy4op elfesl(fa2trur ou1olx  iciltfa emu o (0 ltoifctadfatraieo;t)trurir3ou1al  mfet s)a2rau onu0altnmieiltlmDulnmo;u4teeoxocia1omt  u s;s  rtoxr ou4am elfetls s2ta(  ou4texoiocild m2uln snu)aetnif to1opt li olt) 2xoim iydamt  ncsl(  rrr( o;u0tpe iictaslsDem(vs;u4 rxomrcoatfpt  i s;t0teumiopnu1lptnlfcia( artm(root0apeomo3iad mDrmn o;t0trermr iatla r ivil()s2trxr oy4omt  ici tf Dtaumonu4alx mocilsfs emnmo u4trtnmo3ootfpDrauei ()t2tm(mpnu1aptnlfvs t)aDtrx ont0tlxoif3ils a ua(msn(4tleoircia1la  lu ilt s2xoirpiy4ol emncil(  rtm(r ou1aeeomoeiyd aDrmnmpnu) lxoxr3iodlpD luvil()texrxo ou1optelncsl( a2umurpou4texnio3iysfm2rlnvs;u4texrxf3tytfpDeanei (0 eur(r nodop n icsatf Drau pou1tltnmietys mDulnvonu4 exomo3ia1opD lu i;s)s2uoim nudoltnlnetlt s2tr(rp;t1oleniocild a2rm(vp u4alermf iodopDeln s;s s2umio ou1lpt  nci ()srrr(rpoo4oet ifeiatls ulnmsn() lerxf iatla elnei;s0 rtrir3io4amenliesls aDumu  nt0oee io3tad m rlnmp u)tleoxr tydoatr ivi;s0 etm(m3io1lp  mncsas)s2urxm oo1tle mfetysfaDul(mon()arxnxfcoydfaDrau ils)seur(r iy1am  mfciat a2raumo;t4oetnioetadla2emump u) lxrmr3oadfmte uvi;()truriopoydolenliesat a2ra(r ;o1tlxniictlsfm rm(msnt)altoxociy1oa rluvs t s2xrxm3oo1llee ieilt  Dtmx  oo4apxnmi3tadlaDrauvpnu0 lxnmo io1fmD  nvi (  2xoir3ny4apt livs t) 2rm(m nt1tlx ii3iys s emn snt)trenxr3ootoaD an s;s)srur(opiydalte ncsls aDurxrpnt4opeomfetasls rm( p;u4 etniocoa1fmte i o;t srxmxr iodll   iet tf rurumo;t0texniictaslsDumnms () exrmf3oo1oa eaues t0setmim oodllenlnvi ()aDtmu oou1oetniietysfsDeanvonu4arermo3ia1fatelieo;s sexoim io4op  lneiltfaDum(ro;o4aexnioctaslm2raumo;() rtnmf3ootom  aivo;(0trxrxr io4lpte icsa(f Dtmum no1tpx  i3iaslm ea( o u4 lxrifcty1fm  ln s s tetrir iy1amtn nvsasfarumum nu0tee ioeild m emnvp u0aetrxo oa1opte uvo (0 2toxo3oydomtn nvsatfsDrm(mpou0apxomf3tld a2rmnvs t) etrmr ootoaDrau ol(0 2uoxmpio4apt licta(f rtaxm ou1opeoifciadfaDea( o u)tltrxf3iy1lp e u o (0t2xr(rpnu1lltelicsl()artmx pot1oet mf3iaslsDuln s t4 lenmr iadlat livilt)tetmxr ny1optemici t  Dtm(mpou0texoifcilsfsDeaumo;() lxrir ia1fmtraieslt)teurxm3oy4ole  ics ( s2ra(  ;t0olxnmocildls2raumpn(0trermf iy1lm r nvslt seumiopoudlpte nct tfsDrmxrpot4tleomo3iat s emump t0tlerio todlat  nvo;(0srxmirpnu1lmenmieiasfsDtm(m ;u1alxoioctltls umu o (0trtnif3ia1lmD lneil( srtoxo3io1ll emivs s) Duru  nt0aee mfctydfs2umn p () rtomo3tadfmtr nvolt)seuoim3io1lp elfctlt  rtau o;u4olxnif3tltla2em(mo;u4tlxoio to1opt ln i;s) euo(rpou1lle lieiasf ruaxrpot1tetnifetyd a eanmpn(0tltnxf3iadlm rluvi;t0t2toxm nu4ame mfetat)aDurxr ;t4aexomfetltlaDul(mo;u4alxoiociodoatean i t)srum(opoo1lpt  ncia() rum(  oo1opx ii3iatlm uanmp u4tetnio3oy1la rln il(0trxrim no4ol elfct sf Dumx ooo4tet mf3iytfa2elu p;u)treoxo oa1laDrlivo s)teum(o3oydlptn fes (  2rr(rpoo4opeoifcildfsDumu on(0texrmo3iadfat aues;t srtrio io1ameemfvsltfs2tmx  ;u4opt  feiydfa emnmp;t)tetrxrcto1oatrln o;t  2umxm3oo4ol emfvt tfsDum(m ;o1alt io3iadfsDeln o u)texrxr3ootfate iesl()setmxm3no1lpte fctatfs2tm(moou1aet  o3iys a2ulnmsn() lxnif oy1optrln ils) euoimpoo4omt  fvsa( a2taxmp;o0tpenmfeiysfa2elnms t4teermo oatfpD aivs t  euo(o3oy1lmeeliet t)s2tmu pno4tpxo fctad m umuvo;t0tlxnxf3to1la eau ils)t2um(rpiydlmeemnesl()a2rm(m ;o4opeomoeiltlmDra(ms;(4tlenmf todfp e nvo;()sexrim nodamtnlfcsa(  Drmxmono4oee  f3tasla2el( ont0aleoxociatoaDran ol() rur(opno4ape  nvi ()sDuaxm nt1aptomictys s ra(ms u0aexomf tydoa ran i;()sexrxo oo4ol emfcil(fartaxrpnt4aet  feiys m2ua(mon()tetnmr oydoaD ln s;( teuoxm3oudol elivtls) 2ta(  ot4ole  ictad mDelumsnu4arxnxfciodoat ln o;t0 2xo(m3iodaltnmfcta( a2tm(rpou4tlt mociasfm2ea(mo (4trtoxf3ta1op ranvi;t)s2xrxmpiodlp  mnci tf rta( ooo0tlx  o3iatfm ul( snu)tetoxrcio1lpteau i s srtoxmpnudam elnvilt)aDtmx poo1tpx iociadfm eanmo;t) ltrxr oy1oatraivo;( seuoxo3iy4oltemnvil() rta(  no0texo fctls s2rmumont0texnmo oodfm  aneols) 2tr(r iydop nmnesas)s2ra(mo;o4tex  oeild aDemnvs;t4arxoxocio1latelneils)srurimpio1opt lfciltfarurx  oo0aee mo3tltlm el( p (0arxrmf ty1op   nvi s0 exrirpoo4lltemfctat) rtaxr ;o1tle iociysfm ulnvp;u4treomo iatfm r i ols0seurio no1lptelivt sfs2rmu  ;o1alt if3tat a2emuvp () exoircoytomteaieo t t2xoim3nu4lleelivt tf ruaxrpoo0opxoiietldlm ranvs ()trtrxr oydlat  iei t)setmxrpio4lp  mnvsas  Dtm(mont4aex iieiyslm2emumo u)aexrio io1fpDe ieo s0t2to(opny4olee fcsls) 2uru  ;o4ole  ociatla2rm( pn(4 ltoirctydlp rauvo () 2uoir iu4lp e nvi s aDuau o;u4tpx  i3ildlm um(vp;t4tlenio ootom   nvil(0 2to(mpoodamt mfvsa( s2ra(rpot1tlxomfetat m elnvo (4trerif iatopDeli i (0srtrxm nydol  mnctlt a2rruroot1olto iciltla ulu s (4alenxr3tydoa   ueo t seumir3iy1lltn nct t)a2um(r oo4apeomi3iytfm eau p (0 exrmfcootlmteaivo ( t2toiopoo1amenlivta(  Dur(r ou1oex  iciat sDumumpn(0trermr3oydfmDraueils0 eur(o no4lp nlivsa(fs2taurpno4aetoio3iytlm ea(ms;(4tleoir3totfm elu s;() etr(r3iydomenmnei (faDum(  ot0aeenmfctyd s emumpn(4aexomr3ta1om  liesls)t2tr(rpiudlmee icsatf Dumur ou0tetniiciaslm um(mp;t4 eeoxo oodlptrluvi s0s2uoir oodal e ieslt)artmxrpoo1aexo ociat m ea(mo;u4trtrmf3oa1fm   ies s)teurxm oudlp nmfei ()arrr(r ;o1oeeoioctls s2ran p;() reoxf3iodoa e nvslt)trur(mpiudal nlfctl()sDum(rp;u0texnmf3iysfaDrmu s u0trtnif3ta1opDrluesls) rxmxr oydaltnmfviat  2taxrpot4aeeniicildlm eau s;(4tlxoioctydlat ai o;s0 rxoim3iu4amenlfvt t  Dta(mpoo1apeomfeiytfa ra(ms;t0 eeoxr oytlate nvs s) rxmio3iu1am n icils a2rruro;t1aexoio3tldlsDemnmo (4alxrirctatfp eanvo t0t2tm(m3ou1lltn fcsatfsDrrurpot0tpeo ociys mDumums;()tlxrif3oydomDe uvil()t2to(opoudlm   ivta( srtmu poo4ope iictls a rm(msnu) ltrmr3oa1fmtelueo;t) rumxo oo4apenmfet ( srtrxroou1aptomoeildfa2uau s;u)trtoir3iadlaD lieols) euoirpou1lpe lfvsa( s2rm(root0tpt  fetat s rmumon(0aeerxf3totfpt an s;t0s2xmir oy1om elfvsas a2tmum nu4tlxn f3ild a2ua(mpnt0trerxf to1latelnvo;t) eum(o3iodalenmncsa(faDuaxmont0ale  icias aDrluvon(0tlxomf tydomDe ivi (0srxmim3nudomt lnvilsfarur(mpno1olt mfeiytfa elu ont4 lxrmo oa1fmD  iei ()texmxr3oudol n nviasf rur(rpno1ole mi3iasfmDrmumo t0 rxnxo3todfpDeaivi t sexrxmpno1ale mnvt t) 2tr( p;o4alx  ieiytfmDelnms ()aetrircto1fatrlnei s0trumxm ny4lpt lfvsas s2uru p;t4aex  o3iyt s2rm( onu)trenxf tydfmD  uvol(0trxr(r oodllenlieiatfsDta(rpoo1opx  fctydfa ran p;u4artoxo iotlp   ies;t teumxr nydlpen ncil(fs2tm(ro;u1apx iiciadlaDul(vo;u4aexnmr oydopD livo;( seurimpoudolee iei t)srrr( oot1altn ieiat m2elu p t4artnmr iadlpDe ivi;s0 2tr(mpiydoleemfetl(fs2truroot0tpt  o3iys s ulu s;t) exrmo3ta1lpteli ol( sruo(mpny4alt lfesasf Dum(mpnt1tle ifciltfmDulnmp;t0artrmr3oo1fmte ieo t) 2tm(r3no4lmte neias sDurxmo;t0aexnii3iltfm um( p t4artnxoctytoateaivilt) etm(rpoy1lltnmieilt sDrmu pnt0tpto iciasla2emums t) leoir3iydlaDr ivol(0 exrio ny1apte nesls s2uaump;o4teeoifeiyd sDum(mp;u0alxrmr iadlmDeau sls)tetrxo3iudlme  ncsa(f ruaum ;t1teto fctatfsDeaumsn(4tetnir io1la rluvsls  2xr(r3nu1lmenlies t srtmxmpno0apeoiiciyt s em( pn(4trxrxoctydfmDrluvs s  rtoimpiu4llt  ncs ( s2trx  ot4tltn feildlm2emnvpnu0alenmf3oo1opDr u s;s) rxrir ny1lp  mieta(farrm(  nu0aeen f3tat sDra(mo (4tlenir3oodoptrauei;s)s2uoirpnydlm elicsl(farta(m ot4tlt ioetyslaDrlnvpn(4areomo3iy1oaD ai s () rxoxo3oy1om nmfcs tf 2tr(rpnt0tetnmfciyd m rlnvo (0tetnif oydopDelnei s s2xr(rpou1oltnmnesls)s2rrxmoot0tlenio3tytls2ean p t0arxrmo3oa1lmD  n o;() rxoxr no4lpe lnvsas aDtmxmooo4tex iieiadfm elump;()trtnir3totoa eaneols  exm(m oudlpenmiet sf rrm(r ou4tleoii3iat s2rm( snu4altrmocoydomD lnvi;()t2urir nu4al nlieslsfs2uaxmp;u0tleoioctas sDranmsnu4altnifctodoaDelieo s)seurxm no4ale  nes (fa2tr(m ;o0tpxoioeiatlsDumumsnu4altomf iatlpt  nvi;(  etoirpnydoltn ieil( srur(rono0opt  f3tatfs2eln p ()arerxo iy1opteluesls0 exmimpiy1altnmfet t  2umxrpou0alxoiociyd m eauvs;u)tleomo iadfpD au o;(  2urim3nydlle  ieia( s2tm(  nu0openifetlt a rmnvpn()trxrxo3oydomD anvi;s t2xmxr3oodoptn ivia(f rumu  ot0optomi3tld m2umu on(4alxomf to1lp rluvi;s)srum(opnu1alenlnvil()aDraxr nt1tetnifeils a ranmp ()aexoir todfmteauvol() rtrxmpoo4ol emnvi (fsrtmxrpot4oeenmf3iytlsDua(vp (0 exomf oadlmDr uvo;t) 2to(rpoo1ole lfctls a2tru p;t4oetnmfciydfm ulnvo t)alermr iodfate nesl(0srumir oo1alte nctas)aDuaxrpnu1opx ii3tydla uauvs t4 rerxf oadoaDe iesl(0 2xmxrpny1lm n ncilt  rrr(mpoo4oeen feiadfa rm(ms;() etrmo oytopt aieslt0srum(o iodalen fviatfsDum(r ;t0tex  oeild m ulumpn(0tltnio oadlpteaueo t  rtrxr ou4om  mfcilt sDtmu o;o0tlxo feiyt mDran pnt4tleoiocia1fa  luei;t0teum(m3nu1am elfet s artaxmoou1tlen o3tadls2eluvonu4aeenio3oatlpDr iei t) rurirpnodaleemnvsltf 2ururoou1opxn f3iydfsDuaumo u0 renxf3todlat li i s)tetmxo ny4am emfet ( sDtmu oot4oeeoiictytla rlnmo u4 lxnxr ia1latran il(0t2xoxopnu4lleeliviat s2uaurpot0apxoifeiat m2el( s;u0arxnir tydfaD livi s)t2xrxm3nu4ome  fvs t  2rax pot0tpto oeild a rauvp;u4alxnxr oytfa eaieolt sruoxr3nydame mfvta( aDtr(r ;t4oex moetad m2ul( p u4 eenir tatfm  livs;t)s2uo(o iu1ole  ictls srtrump;u4tltnmo3iytfa2rmuvonu4 etnifciydfmt  u ilt)teuriopiodopenlnvs t aDtmxmo;u0tpxo o3tlt m uan s (0 rtoif3oodfa r i s ( s2xo(r ny4amenmfvilt)sDua(  nu0aeeoio3tysls eluvp;u) lxnmf todomDeli s;(0 exoir3iu1lmtn iviasfaDrm(root0oet io3tltfs2elums t0 rxoxf3iodfa r i i;t)s2tr(m3nodllt mfet ()a2ra(r oo1opx  oeiyt mDemump t4aetnirciadlmtelivi;(0 eto(o3oydlltemiei tf ruru oot4aee mociysla um(ms t)altrmr iatlmDraueols0 eumxo no4oltnlfvtlt  rum(mo;t0tpenioctlsfa ulnvp;(4 rtnxo3oytfa  lneil( t2umiopiu4ol  liet (fsDrrx onu1aetomieilt s2emuvp u)trxrmf3iytlm e nvslt)trxmimpiy1lptn ncslsf 2trum ;o0olenmictysla2rlnvon()tleoif3iadlp  luei t s2xrim3oodam nlnvtasfarrmxm ;u0tle  f3iadfsDua(vpn() lxoioctatfmt  nei s)t2urxrpny4lpee net s sDuaur ;u0oltnifeilsls2ulnvs;u4 etnmr3oydlmD auei;t) rxm(r3no4al nliei ( aDum( p;t0oeenioeiysfa ean o;()tlxomfcoodlmDrlivols) euoxopoydlmen ncs s srtau  ;t4aptoioeiys a ea( snu) leoif iydlmtean s;( trxriopiy1opeelietas)sDrmur no4aeeomfciatla2ra( s t)tleomo3ta1omDe ueo t0s2xrxm3io1lleemivs s s2rm(  ;u4aex  icias sDulnmpnu)tetrxo tatla ran s;t)truo(mpoo4omen ict s)srurxm ;u4opeoioeilslm2emnmo;t4treomf3oytoaDe neols tetm(rpnu4ap nlfcia( sDrr(  ;o0aetoif3iltfsDrmumo;t0 lxrir3iydlp r ivils)tetmxm3oo1lp  livils  2umu oot0oexnmociysls2emnmo ()tlerxoctadlaDe i ilt) 2uoxm iy1lltnlies ()srtmumpnt0oltomf3iysla em(von(4texoio oodlm r iesls)s2xrxr3nu1lp nmici sf 2rr(rono4opeoiocias s em(ms u4tlxrxr3todfmteai il() exrxm nu4lm   neias srua(mp;u1opxnmoeiadfs emu p;u4teenmrctatoaDrli s t texo(m3io1omtnmietls)sDum(  ;t4aptomf3iasfs um(vs;t4tetrio3iytlmtelneo;s0 eurxr ou1lp  lnesas sDrau p;o0oet io3tltlm2rmump;u0artrmr oydlm r neslt  exriopoo1amt lfvs t  ruaur nu1ape miciltfa ulnvp t4aetomo ty1oat auesls)trum(o oodol e fvta(  Drmxmont0tltomicildla2elnmo t4alxomrcoatfp eli i (0t2tmxm oodol n ivs sfa2trurp;o1oeeo ietls s uluvp;(4aetnmf iytla eaueo;t)teuo(r3io4aleelivils arra(rp;t4apeomfeiyt s2eanms t0tetoir oatla ean ols0t2urxr3no4am  lfetltf 2rrxmpou1opxnmocild a2uaumo (4 exrxo3ootfp elu o t)srxrir ou4lmenmncia()a2ua(monu0tptnifcias m ean o;u4aetrir3oadlm  lu s;(  etmxrpoudamen fvsa(farumx pnu4tetn ictldls2uanmo;t0aeermrcta1fpDe uvs (  2tm(o3iy1aleelnvt (f rtr(mo;o4oexoiieiltlmDeaump (0 rerxr3oytfp rln sls s2xrir io1al nmfesl( arrmxmp;o0tpx moeilslmDuan p;t4tlxrxo io1fp rauvsl(0srumxr iy4amtnmicil(fsrtmxrp;o1tpeomietyslm ran onu0tlxnxo3io1lmt ln i;( srurxo3oydlpt lncta(fs2umxr ;t0opx mf3tys sDrmn pn(0 lxnir3oadop  ln i t tetrxm3oo4ape lfct (f Dtru p;u1alxoiictatfm uluvon()areoxf3oytla elnvols0s2xmxo3no4opeelfcsat)s2ua(m ou1tee miciydfa2ul( snu)aexnmf3oadoptrluei;t) rum(m3no1ll e ieia( aruru poo0tleo ictldlaDrm(vs;t)tlenxocty1fmD lieslt) rxrxmpiydom emfcsat)sDta(root1oetnmf3ilt mDemnvo u0aleomoctadfpD  uvil(0tetr(m iy1aptemfvsatfsrururoou4ole  feiadfm rau p;u0arxrir3iy1op rlues;(0t2xm(rpny4ale  nctas) Dtax  oo1tpen oeiadfs uau snu4texrxo iytoatranvilt) rtm(opou1alee icta()srtr( pot0apxoif3tls m uln s ()aeeomr3oa1fa  li olt0s2tm(m nu1omt lfcsat aDrrxmpnt1aexnii3ildfs emumo u4tltomfctydfpDe ivs s)texoimpiydopenmfctlsfs2tm(r ou0olt mi3iydlm rlu p;t0 exomo3tatlpt lu olt)teumirpoo1al   icils)s2rauroot1apxn fcilsfs2emnmpnu4 leoxr3oo1fmDe uvo;(0t2uoio oudlpte nct (  Drrxrp;t4aee mictatfa2ua(vs;t4alxnxocoadfmDeau s;()trto(opiodam   nct tfs2umumonu1apeomoeiasls2um(mpnu)teenif3oatlptelu i t  rtr(rpnodapte feiat  Drru pot1apeomo3ilsls2uln s u)tetnir tatoaDrlnvo s)srurimpnudlme  fei sfsDum( ono1ape mfciatla2rl(mp u) etrmrcoy1fat an i;( teur(m3iudap elieiat artr(m nu1teeniiciys m2rl(mo (0tlxnmr3oatom eau s (0 rurxmpoudap  livtasf 2ra(mo;u4opt ifeiyd aDeaumo t0tltnxo3oytlmDrluesls0 etoxr oo4llt  ictas) 2rr(rooo4tltniictlt mDea(vo u)arxrxr3tadfmDranvo s  2umxm3iudom nlicsas) 2rr( pot0ale if3iltfs2rm(vp t) exomrcoydom e i o (0 eto(opio1olenlivils s2tm(mpot4tlxomiciyd mDel(vpnt4trerir iodfpt aieo (0trum(r3io4lle mnvtasf Drru  no0aee mf3iad aDrauvp;(4arxoxr ootfaDeluvi;t) 2toxmpoodope  fet s srumur oo0tltoii3iys m2eauvp (4aeeoir tadfm rln o;t0setrxmpio4am elfctltf 2tm(  ot4alen oetltfs2emn o;(4tetnxrciadfa  livols0seumxr nudaltnlivtl(  Dumx  ;o0optniictysfs2ran pnu0texrir3oo1opte nvilt0 rur(r3oydlpe mivils) 2tm(m ;u0oltn o3tad a uln s;t) leoif iadfatr uesls)sruriopiy4am nlfvi ( sDtaumoot4openiiciysla2umu pnu4tltomocoy1fpD aneilt)s2xrirpny1aptemfetltfarraxrpot4aeeoiociyd aDem(vp ()trtoxrciodlaD livils0texr(m nudllee iet s  rrmur ou1olx  ieiydlmDel(mo u)aetnxf3oydopte ieo;(0 rurxr3iy4omenlfei t) 2umxm no1tptnmoeiys aDrmnvon(0areoxfciadopteanvs s) 2umimpno4ope  ietls)srtmuront0tpxn oeiysfm rm(vs;t) rxoxoctydfpDeaivi t)teto(o3no1ame mfvils)artm( o;o1tetomoeiytla um(msnt4aexrmf3to1fm   n o;()srxmxr3io4oltnlivtat  rrax p;t0aptnmfciat sDem(ms;u0 rtnmfctatlptr uvolt setoxm nu1open ivsat)s2ua(monu4aet ifctytfmDraump;t4arxriocoatlaDelnvs;s0 rur(o3iy1amtnlfetl(fsrraxr no1texnif3iysfm2rm(mon() lxrxfciotfmDraneo (  exrim nydalenlnctl(  2uaxr nt0oltomfeildfm2ulu p (4artomr ootla   u i;s seurxr3oo1amtnlnvtas a2um(m no1tlt  ictasls2em( s;u0tlxoxr3totfp   ueol(0srur(r oo1lmteliesa( a2ra( o;u4texo iciyd a2ea(ms ()arerxfcto1oat lies;t0sexmio io4opt lnei s srraumooo4aexn o3iaslaDuaumsnu)tltomo iytlpDrauei;t0t2to(mpiy1lpenmiesat)aDuaurpot4apt  o3iydlm ra(vp;t) renmfctodlaDeai i;s seurio iy4am n ici t)sDurumo;t1oet ioeiyt s ra(mo;u) exnmrciadomDrlu ilt seuo(opiodlpt  nvtat)sDrrx ono4apenii3iatfs ranvpn()texnxr3oydopt au i;s  rxrio oo1lmt mfctls)srumuroot4tetomieiytlaDemu snt4 lxoxf oydomD lnvi;t0srum(r3no1lp emfct tf Dtmum ;u1oeto o3iltfmDeaums t) exrxrciytomt ln ils)sexr(o io1opeemnctlsfa2tm(r nt4apenmf3ild aDra(vsnu)alenif oa1opDraiei;s trum(o3iydllee fctasf Drrump;u0aeenmieiatlsDra( sn(4tlxoxr3iotoaD aivol(0trxrxm3ou1openmneias  2raxm oo0oetnmieilt m2rmuvsnu0teeoiociydlatrlueslt0 2xm(o3oydomeelfvtltfsrrax  nt1tltnmfeilsla2ran pnu0arxoxr3iadoa ean ilt0seto(rpiudol elivias) 2rru  ou1tee mfetyt m2ua( p (0tlxrif iytoptr u s;(  rur(rpou4lptnlfctl(f rtrxmpoo0alt  o3iltlm2em( sn()texoio tydfaDe ueolt) 2xmio iudlptelfeta() rtr(roou4aet moctad m emuvp (4alxrxo iydlmDeauvo;t  2uo(rpoodal n ncs s aDrru oot1tpe  oetadfs rm(mo t) lermr tytfp eauei t trtm(mpoydomt mfet s  Dtmx oot4olx io3tyslm2uau p u4 etnmo totfaDrluvs;s0sexmimpou1ap   ies sfaDrmurp;o1alto feils aDea( s;(4artnxr oy1fmt lieil(0truriopou1lmeemfeiatfs2tmxrpnu1aptnifetydfs ulnvo;t0texnmo3oodopte u i;t0s2ur(rpoy4op nmnvsat s2um(ronu0texnmo3iydls2elu pn(4trxnxf3iotom e n i t)s2uoim3iydolte fetasfa2umx oot4apxnif3tyslm ra(mp;(0 eermf oytfpD  ueol(0sexmxrpoo4ap  mfvils a2trxr oo4oeto oetatlaDrluvs;(0 exoxo iatopt luvi;t) 2uo(m oo4ll elies s  2ra(m oo4apxoiieiat m rmnvsn()aeerxo tytomtranesls)sexo(opnu4altnlicia(  Duau ont1tpeo iciadfaDemumo;t0aexrmr tydfm rlueils)s2trir3ny4openmnvs (  Dtmu  ou4alt mo3tyt mDelnms t) renxf3ty1lmDelnvo t) 2xrim oo4alee ncs s) Duaxmpoo0aex mfcils s uan p t0tetnxr iodoaDelnvil(  etrimpiudaptn icta( srrax ooo1tptnii3iyd s2ranvp u0aetrmr oydlp eln o t)t2tmxo3nu4ll n nvtls)s2rr(mpou0altniiciadfm um(mo () rtomfcoodfp e ueo s trxoxr nu1lle  fesls)srta(r ou1opx moetasfa rlnvo t4 rxrmo3iy1laDr uei;s)s2ur(r iodamtnmiesas)artau ooo4apeoifctltlm2rauvsnu4aetoir io1lp e ieols) rtm(r oy1lltemfctas) Drr(rono1texo ietltfa2ul(mp t4 eerxr oodfa raieils0 rumio3iy1lm emfcias a2rau pot0oexoifetld m2elnmo;t)tlenxrcia1lpDe nvslt setmiopiy4opeelnvi t arrr(r ou4tpxnio3iatfs2ea(mo () ltrifciodlpt auesls)srxmio no1lp nmfctlsf rtrumo;o4alxoifetydfs ulu p;u4aexrxr ia1fmteluvolt)t2um(m nudlltn ict (fa2umxmp;u1oltomoeilsfm2umu o t)tleomr iatfmD  ueil(  2ur(rpoy4lpe mictas)sDurx onu4tpxo fetas s umumsn(0texnir3to1oa rauvi;(0t2uo(opiu4altemnvia()arurx o;u4tpto o3tlslaDeaumon(0arxrif oydomtr i i () 2umir3io4lp nlivil( srtmx p;o0opx  fciytls rlnvpn(4tlxnxo tatomtrlnvo ( sexoxo iudllen feils)aDtmxro;t1teenii3ilsls ra(vs;(4tetrio3iotla  lnvs ()s2tr(o iydamt  fet ()s2raumooo4tex  i3tldls rmnvo t4tltrmf iy1lpDelu i;(0srur(opiodlmtnliesatf 2ua( o;u4tptnmictldfsDeln pn(0trtoxocoydfmD  u s ( srxrxr iydol emfet s sDrrur ou0ape mfciasfs uln p u0 lxoxo ta1oa   nvo s)s2um(r iu4om elfvi s s2um(r ;o0teto f3iysfaDumumsnu) rxomo3iytfa elnes t)trxm(o no1lle  ics s) Dra( p;u1teeo fciad m2eln pnu4 eeomo io1op  aueo t) exr(r3oo4amt mnvsa(farumu pou1ope ifctas mDranmp t)trermf3todlmtrlneil() rurxrpoydll emnei s aDumxro;o1opx moetltlmDeanvo;t4teenxfcoytlmtrli s ( seurio3nudalenmivtl()s2rax  oo0oetoioeiydls em( pnt0aeenif totlp  ai o s0srxmxrpoy1al  livs t s2rmumoou1tle  oeilslsDrlu sn(4alenio3iydomDe ieo t)seurxo3oo4amt lfesl() 2umu  no1alxomociydla rmnmo t)aeeomf oa1opt lieils) 2uoimpiy1lptn ictl(faDrmu p;t4tptn fctat s eanvs (0artrio3iadla elueo;t)texmxm oy1ole mivtatf 2rmxrp;u4tleomoctldlsDrm(vpnt0tlenxoctodomtrli ol() 2trio ny1opee fct ( aDurumont4aexnioctyslaDel(mp;(0alxomf3iytlaDelneilt0trtoim3ou1llen nvslt)srtmum no4texniocias sDulump u0trtomo oatopD luesls0t2umio nudlltnmnet (fsrrau pnt0tptomfciysfa2rlums ()alxnif oadfatran s;s trxr(mpou1openmieias arurur ;t0apxn iciydfa2rmu o (4altnmo to1om  lueilt0srtoxm3nydlp emivs t)srrr( p;u1apeo fctydla2emuvo;t) exrxr3iotfmDe u s;t0trum(r3oydllt lfct sfaDtrx o;t4apt ioetys mDel(ms;u)tlxoxociotfa elnei;t)srxo(o nu4opteliei ( s2taxmo;u0alt  ietad m2ulu o;()areomr3to1fa rai o (0s2um(rpoo1ll e ivi t) Dtaxmo;t0opx ii3tytfmDra(ms;u0 etoio iadopDeauei;s t2to(r oodop nlfei s a2ta(  nu4oeeo f3ildfsDrmn p (4trxnmf3todlmteauei t setoim oo4ale mict sfs2tmurpno4optn oeias s elnms u0 rtnif3tatlaDeln olt0trxoxmpno4lle  ics ( a2ur(  ou0tlen ictld aDum( s t0aleomr3ta1omtrauesls0seur(r ou1lmtn ivil(fsrraxroot1opx mf3iyt aDelnmonu4 etoir3iodomD  uvi t  rumio3oydomtn fesl(f 2uaumono1apxniieils m2uan on() rxnmo oa1fa elneil( t2xmxm3io1alenlfciat) 2rmx  ;u4oexn octls mDrlnvs;(0tltnifcootlm   nvolt) eumiopnu4omtnlfeil(farua( pno4oleo o3tldfs uluvo t4tlxrmocoa1om e iesl(0s2xoxopio4lltelivia(f 2rau pno0aetomo3tyslm2el(vs u) eerio iatoaDran olt) etrir3oy1altemiviatfa2rau pnt1optnmo3iltla emnvs;t4trermfcoadomte u i s t2xoio oydap nmnet ()srtr(m nt0ole mi3iltfs2rln o u0tltrircia1fp rlneo s0s2xrxr io1oltnmnvtltfartrxrpot4aet  iciyt aDrlu p (4arerif3oa1fm eai ils)srxmxr iy1amee fvsat  Dum(mooo0alxomfctlslaDrm(vs;u4artrmoctytoptrli ils  rxrim nu1apenmfet ( s2tr(mpno4olxo f3iyslaDemnmsnu0 rxoio tatlmDelneslt)srurxrpoy1al n fei tfsDtmu oou1tet  f3ilsfaDumn p;(0tltrmfctydfaDraneols0 2xoxm3io1lltnmfctlt)aruaxm no0tptoiieiat s eanms t0 renmr3iytfp  anvs s seumxr oo4altnmfvtl() Drmxr ;u1ole  o3tltfs rlnvs;(0texomocio1omteaivslt0seuoir io1ome  iesltf 2urx ooo0apxnioetldlsDrmu snt4aexnxf totlmteaivilt)s2tmim oy1lme  fvtlt)sDrrxrpno4tptnmoeiysfa el( p u0tltoxo io1fmte u o s)t2xriopoydamtelncsl()s2uaxmono4aleo iciytfa2uaumon()arxrio3tadfmDranvolt trtoimpiodllt lnvs () 2tru pno4teen feiytfm em(mo (4 ltoif tydlm r ivils)srtm(opnydopte nctltfa2tmumont1open fciydlaDranvs;u)artoxrciydlmtraivs s trxrimpnu1ap emictls a2rmuront0opt mfetatlm umuvsnu4 leoxfcoatfa rauesls)trxrxr oo1ll   fesls) Draxmo;u4oleomocild a2el( s;t) rtrxr ta1la r u s s0teumim3no1llee nvt (  rrr( ooo0teto ieiaslaDul(vpn() rxnmr iy1op eau sl() 2xr(opiu1omenlicil(f Drmx ooo4texomi3tlslmDeln o;u0tltnmrcoodoptrlivolt  rtrxr no1ape lnetltfarurx  nu1openio3iltfa2uluvp;(0tetrxr oa1fm  livil()s2um(r no4lpe lnvt ()srtrumpot4aexnif3ildlsDrm(vo u4alxnxf t
\ No newline at end of file
@@ -0,0 +1 @@
+nvi s)s2umxm iy4llte fcslt  2ur(mpnu4oltnmi3tld s ulnvp;u)aexnif3tytoat  i o ()srxmim io1llte nctasfs2rrx pnu4opx ifeildfmDeauvp t) lenmfcta1opDr n o t)srxm(o3oy1op   fei tf Dua(mo;t0tpxn ocildfa uau s t0 rxrmr to1la eluei;s sexmir oydlle liet ()aDrmumooo0tex mf3iydfa2uln s;t0 lxnif ootfm   iesls) ruoimpiudlp e nvsasf Dtru p;o0tex io3iatfa eanmsn(0texoircoa1lm  li o t seuoxmpoy4oleemnvs sf 2rrumpnu4aee ioetyd m ranmont)tleomo oatfa   i s;t)s2xrir3iy4lle lfcia( a2taxm no4opx mo3ils s2ul(vs;(0tlxoxr io1oa  lnvs;(0 rumirpnudope mnvt s) 2urxro;o1oleoiociyd sDean o t4tetnmociytfaDrauvi;t) 2um(r iu1apeelnetatfa2tmu ont1tpeomi3tldlaDranvs t0 lxnir io1latr i ol()trxrxr3iu1lpeemiesl() 2rr(roou4oexnmoctasfsDel(msnt) lxrmr totla ranvs;() 2trxopoy4omtn ivia()sDum(rooo0ope  oeiatfm eaumont4 reoxrciytfat aues;t)s2trir no1oltnlfvtas a2raumo;u4oleo fciatfa2em(vp u0arxnxr3oodoatr nvolt teuo(o3nudlpe livta() 2tmxr ot0altnmoetldls ul(vpnt0 rxriociadlaDe uei;()setrim3nodlme lnvtls)srrr( ono0apxnmietysla2um(mpnt0 exrio iy1omDelneols) etm(r no1llenlfvi tf rrax  ;o4altoif3ilsfa ra(ms (4 leomrctodfmtraiesls  rtm(o io4lpenmnetasfs2trxmpoo0optnmoeiad m rmnvsnu4tltoxociydfaDeln slt)t2xr(m3oydop e nvsltfaDum(mo;u1oleo i3tyt a em(vp;u4tltrif3todla e nvo;() 2tmir3oy4al n ivtat srumurono4alxnii3tyslm rlu o;u) eeoif iytlm e nes;s s2ur(m3oy4opeelictasfsrtaxm ot4alt mfetat a uau snt)texoxrciadfmD livi t trtrim3no1opeemfcias sDum(mo;t4tex  iciad s ean p;u0artnxf iytla rli i;()t2toio3oo1ap n ncsa() rtmurono4alxnmoctld aDul(mp;t0tlxoifcoytfmD  ieils trtrim oydamtn fvsat  2rrxrpnt0tlt moeilslm2uau s () exoxfciadlpte ivilt0seur(opny1omenlies (fa2ua(m ;u0aptniieiydfa um(mo ()tlxnio3oatlat luvi;s)sexrirpoodaptnlfcslt) 2tm( ont0aet ioeiltfs2eanvs;(0 eenif3iatom  li s;( trxrim oydapen nvsa(farua(mont1teenii3tytfsDrluvpn(0 eerir ta1fa r uvi;s srtrxr3no4lpe mfvilt) Dtmx o;t1oet  o3tas m2ranmsnt4 renirciy1oa e n sls)sexmio3ou4lpt livias)srtaum oo4tlxnmfeildlaDraump u0aeerxfciadlpt an i;(0srto(r3oudol nlfvia(fsDua(m no4aptn feiyt mDuauvo t0 lxrxr3oa1lmDrau ols)srxm(rpoo4omtnlnetlt  Drax  nu4tetniietysfmDelu s u0aexrir oydfpte u o;t0sexmxopiu4amenlncslt  rrr(root0opt  ietlsfaDuln s;()texnmf3iy1faDelivs;s0tetoio no4lp  licta(farrrxmooo0oeeo i3iasfaDeanmpn(0 exrioctatomD  uei;(0truo(r io4opee ivslt)srrmur oo4aex moeiyslm rmnvsn(0 eenmo3oydfa elivs;t)texrir3ny1ale  ics s)a2rau  nu1apx moetasfa ea(mo;t0aeerifciotfp  anvs;s)teurimpny4ll elfcsl(  rrmxmo;o1optnmoeiyslm umn s;(4trtrircoatfaDe nvi s teuo(o oydlmenlnvtat)a2uau  nu1alenmicils a2ran snt) ltrmrcoodla  ai olt)setoxr3iudlmtn nciat artm(moot1ope  o3tasfsDeau pn(0arerxr oy1lpDe u s;(0teumio iydame  fet t) Dua( oou1tleomfeiysfsDulnmo t) exrif3ty1fp e nvil(0 2uoim3nydal e nvtas  rtaxmo;t0tlt moctltlm2umn p;t4arxomr iodfmtraieil(0srxrxr3iudlm nlicia(fa2uaxm no0optomfctytla umu o;(0altrifciydfaD  ueo t  ruoim io1ll nmnct t)srrmumo;t0aetoiieiadfs2ulnvp t0tlenmf3ta1omDeaiei;t0srxmxo3oy4lp e ivt ( s2uru oou4tlt ifetatfs2rlnmo;u) rxomr io1fpDeli ol(0t2toxr iu1omt  feia()s2tmx  ou4aeeoiociltla2emn s;()tltoioctytlpt  nei;(0 rtoir3oudom  mivs (  2uaxr oo0alxn icild m ulnvp (4arxnxr3oo1lpDe ies;s) 2uoim oydomtnmnct s  rtrur nt1olen iciytlm rmn o (4 rerif tytlpD  ieolt0s2tmxo nudome liviatf rrmxmooo1oeen oeiasfs2uan o;()tlxrif iadomtr nesl(0 rtrxo nudamtnlictasfaDuaxmoou1oee  fctydfm ra(vpnt4tltrxoctodlaDe i il(0 rtm(m oodamte nvsat sDumu  nu4tpenmoeiltfm2emnms;(0alenxfcoatla ranvi s0s2uoxr ou1altnlfvtl()aDua(m ;t0tet mfeiyslmDulumonu)tleoir3iodlmD auvi;s0srxoir3no4op e fctat)srtr(ronu1opeoiieils mDea(ms;t0tltoxo3iydlpDeli slt) 2toim3oudamenlnesas aDumxr ou4olen oeilsfs rmnms;(4treomf3iadfpDr uvi;t)t2umio3nydop e nvs s) 2rrx o;t1opxnio3iysfaDumnmo;t0 rtnircio1lm ean s;t) exrimpiydal e ietat sDtaxront0tpeniieiadfm uluvo;t)aleoifciy1fmtrlnvi ()sexo(o iy1lpeeliesltf 2umxmonu1oleo oeiadlm em( o;u0 rtnxf3ootlp rauvi;( trxrxr iydoptemfcsls sDuaxm ;t4tlxn iciys a2elnvpn()trxnio oa1opDrlivs;()texrim3oy1ap nlnct t)arrr( oou4open fctadls elnvo t0artnif iodfpDeai o t0seuoxo3no1am  lfcilt)sDrm(roou0aeenmoeildlmDranmpn(0 ltrmoctodlaD livo t)tetmim ou1amtnmfcil( srrm( pou1tpx ioeiadfm2em( on(0trtoiocty1fatranvols)sexoxmpnydolenmietlt s2umxrooo0texn fciyd sDel(vs (4aexrmoctatoat  ieo s)s2urxr no4ame mfvi sfs2umumpou4tle mi3iadla2umuvs u0artomrciy1oaDelnei t0trxmimpou1lp elfetl() 2tmxm ou4aet ifetatfm2um(vo;(0 lxoxociy1fm ranes;(  2urxm oo1ole lfcta(  Duaurp;u4olenifeiydlmDuaums u) ltoxo3oydfmt  ivols  ruoir nu1om emnetatf Dum(m ;u4aexnio3iys a rlnvont)alermo3tydfaD aues s0 etrxopou1alee fetlsf 2ta( ono0tlxnio3tlslm rau p t0 rxnmociodlmDe ieo s t2xoir3io1lm e ivtasf 2umuro;u1opt ifciad mDuanvpn(0artoxr oodlpDrai il()teurxo3io4olen ivsa()srumumo;t4tpxn ociyslsDra(vs t) lxnxociytfp rlnvs ()srto(mpoy1apeelnvsa(f rrm(rp;o4aet mictldfmDrmnvsnu)alermr3oydfmtr u i t teuo(o3iydlmtemics ( a2uru ono4ape mfeilt sDrlu onu4tlenxociadomtelueo t)setm(opiudaltelfeil()s2taxrpou0aexo ieiyd m2rl(vo (4aexnioctydlaDrlieils0 etr(rpnu1llt mnctl( srraxronu0aeeomieiadls2rm( p u4arxnxo ta1fmt an slt0 exriopoo1lpte fcils sDrr(ro;u1tlx  i3ilsla um( p (0tltoiociy1fp  aneols0t2umir ou4omenmncsas) 2umu pou0apt mf3iad aDrmu p;t0arerxo ty1lptr uvo s)sruoir3oodale liei (f Dumur ot1aetnifeiyd sDrl(vp;t)tetnmr ia1fatraues s  rtmxo no1omtelncil(  rra(m nu0altn fciasfmDrl(vo u0tlerir oatopt  ies s) rxr(o ny1alt lici ()arum(r ot4altniiciadls ranms t0tlermr3oo1laDean s;(0seur(r3ny4lpeemncta(f ruaxro;t4tle mf3ilt sDrmnmonu4aetnmf3oatop elnei;t0 rxoim iydopeelici s)a2tmx pno4aleniiciysfaDumumont0 exoxf3iadfm   ieol(  exm(r oy4lm elicias) Dua(mpnt0apeniiciyslsDrmuvo (4aexomr iydomD au i t0sexmir ny4lptelivtl(  rrmxro;u1alto i3iatfs2emumpnu) rxrmf ootfpte nvi;t0teum(opiu4om nlfvi t srtaxm no0oetoio3iltla2emn onu) lxrmf3oydfpt  nvolt) rxmimpoodlp elfeia(fs2tr(m ;u0oee moctldfa2rmu snt) ltomf oy1lmDr iei t s2urimpno1ame mnctlt) 2rmxr nu4tpenifeiatls rmu snt)alenxrciotlptr nei s0 2trxm nu1lp  lfci ()arrr( o;t0open feias s2ra(monu)trtoifciy1laDrlnvi;( s2tm(mpnu4lle livt tfaDtm( ont1opeo i3iyt s2rmumonu4trermo oadlmte uvi s0setmio iu1aleelietas)srurumpou1tetnmictltfm um(vs;()tltrmrcty1optrauei;t t2to(mpnodol elivs t) rtaxmo;u0alx ioeiyt s2umnmsnt0trtomfcoatlmD aneols t2trim3oy1olee fvsl(faruru o;o1oex ioetat aDumumo;(4 lermrciodopDelivolt0t2xm(mpou4al e feiat arrr( oou4tleo octad m uan ont4 renmr3oa1faDrln ols0tetoxmpny4lpt lnct t s2ur( p;t4ope mo3ils a rmnmsn()alenmo3oo1oa   uei;(0 exmxr nu4omtnlivsl()arrmumo;o4oltnmfctys m um(ms;u)aexnmf oytfat lnvi;t s2xo(opoy4amtemfei tfsDta(rp;t0tpxomociysfsDel(vo;t)alxnircoytfpDeau i;s0t2xr(mpoo4olte fctls)s2ua(r ot1alxoiieilsls umu s t4trerxf iytlatr ieil( s2umxo3oydoltnliciatf 2tr( ooo1apt ioctydlaDrlnms t0 ltoxrcio1opDr uvs s  euoxr3iydamtnmivtlt s2umurpot0oleoioetatfaDuauvpnt)teenmociy1lpDe ivo;t t2xrim ny4om nlnetl()srrru pot4aeeomo3tadlm2rau s;t4arxnmf3oy1fmte uvi;t)s2xm(r oo1olenlivsas sDtaxm no0tee ioetat m ul(vs () ltrxr3io1faD li ilt sexm(r3nydoptemnetas) rumu  ;o1aptnii3ilslsDem( pnu4alerir iy1lmt an o;s)t2urio3oy1aptnmfvs (faDurur ou0tpeomfciadfs rl(mp t0tlxrir oydlmD  nvo (0s2um(r ou1olee nvta( a2taurp;t4oltniiciadlsDranmonu4texnxrcoa1om  auvs t)s2toir3nu4lle  nesltfa2uau  no1aeto o3tatlaDemn pnu4 lermrciy1oaDrln s;s) etm(r3no4lpenmnvsas)aDtr(m ;o1teeo fetltlm eanvsnt4trerxr3totfmDelies;t)t2xmxm ny1lmtnlicsl()srrru ono4aee mo3iatfs umums;u)artoxo todlat auei;(0 2toxr iy1ap   ivi s s2tauront1tpt moeiltfm ulnvpn(4altnmrcty1la r i ilt t2xr(r oy4apen feilsfs2rrx pnt4ape mf3tydfa2rlnmsnt) exrmfcoy1fpDe n ilt0texm(o3no1ol   fes ( srtrxmpoo1olx if3ias mDel(mon(4 lxomrcia1fm eai ilt0teuoxr3no1lm emnvi sfs2ua(rono1teto ociat a uln s t4 eeoiocoadfa   nvo t) rxo(o3oy4ope mfeias sDurum nu4tpt  i3iatfm umnmo t4 ltnir iytlp e i s;( t2trxr3no1alee ieias  2rm(ro;o0tpxo fctat m ul(ms;u0trxoxo iatfpDran ils0seto(rpiy1omenlfvs tf Drrur nu0aptnio3tyd s2ra(mp t)tltnifciodlmD aueslt0teuo(r3ou1lpee ies sf 2urump;t4aex mo3iys mDelnvs;t)alerxf ty1fm e uvi (0 2xm(rpnudlm   fvt ( aDrauro;u4ole if3ildfs2ranvs;(4teenxr iytopD lu o;()seur(rpou1lptelfeil( sDur(m ;o0apxnii3tldfs2rmnmp u)trenxr oy1fmtelueo s)tetr(mpiydlpee ivias arurur no0oeenmoctadfm ea(ms u) lxoxoctytopD li o;t sexm(m3nu4opt lfvt (f Durur nu0tet  iciad mDemn s;t0 exnxr ootlm  aies t)s2ur(mpio4op n netls sDraumoot1aee mf3ilsfmDrmnvs;t0artrxf3iotopteln i t t2xmio iu4lmte ivta(f rumx pou0tpenif3iasfs2eaumsn(0arerxf tadlaDelu i;t)setmxr nu1lm nlfvtat arumump;t0optomoeilsla ulnvo;t)altomf3iadfm raneols)t2xmir ou1amee ictat)srtm( ono4tpxomieiydfa2rmumsnu) rxnxrcoytopt  nes;t)t2um(m3iudllt mict tfs2rmx pnt0tpxo ociatlm el( snu)tlxrmr ty1lm eanvo s0sexo(m ny4al  mfetlsf 2uauro;o0oexn oeiysfm2ranvo t4trtrxo io1fm  anei;(0 2uoirpoy4openlfct s  Dtr(mo;u0opxn f3iltls2rmnvp u)tltnmr oadlmt luvs t0s2tr(o iodolee ncsl( a2ur( pnu1optn octas m2rmumo;t0 leniocia1fp eai ols trtmxo3nu1opte ietat a2rm(  ;t4aptoifctadla em( o;u4arxrifctotlat lneo;s)srxoxopiu1lme mnctat)s2trx  no4opt  ociydfm em(vpnu)alermo iydomtraueilt t2trxo oudomte feias srta(root4oltomieiyd sDrlnvs (0 rerxf3tadfm  au ol() 2uoio oo1ll n fvtlt srrr( o;o1tpxo ociltfmDumn s;t) eenmo iadomDran ol(0srumir io1optelneslsfarurxm nt1opxomietytfa2emums;t4aeenio ootlp rau ils  rxrio oydap  lfesatfsrrm(rpno4tpt iicildfa2rlnvp;(4 renmr3totlatrlivols0t2tmxrpnudaltelnesls  rtmxmoou4tetnifcilt aDuanvsnu) reoxr oadfmtrluei;s)srtr(rpoudop nmfvs ( sDuaum ;t0ape mieiytfs2ra( o;(0aleoirctytop eaieol(0s2to(o oo4opeemnvt sfaDtau ont1tle  ociytls2ulnvo;t)tlxomfciodopt au ols  eurxrpiydoptemnvsat) Drrxr ou0aeeo i3iyd a2rlu o u)tetnxfcoodlmD lu s ( srxo(rpiu4lmtnmivtls)sDurx oot0aetomfeiltlmDuanms;()artnmr3iodfm   ieo;t  etr(o3nudop nmivsatfartaxmo;o0optn feiysfm2umnvp u4teenmo3oytoptrau i t) 2tm(o oydlmtelnet ( s2uaur ou0oee iiciaslm2ranvs;t0arerifcoatfatrauei () 2urxm3oy1oltn ivi sfsDrr(mooo0ope  oetyslsDrm( o;(0treoxf oy1fp ran s;() rtrir nodom e fesl(fsrumumo;u0oet ioeiatfsDua( o;u0altnmr3oytfp rauvo s0texrxm3ny1aptelict t)aDrrurpot4tlt  fctatlm2rmnmo;u4trtoiociy1lmDrai i (0srumxrpoy4ol elnvi s artmu  oo4oexo oeiyt a2umu sn()teenif3oo1omteauesl() exm(opiodaltelfcsatf rrrxr oo0teeomicils a2elu p;u0trerxo ty1laD livsl()tetr(o iu1ll emfctls)s2trx  oo1oetomo3iat aDranvs u) rtrxrcoydlaD aieolt)trxoxr nudllt lncslt)a2urx  ;o1tptomocildfa2umu p t0artrir oadopt  u ol() 2xmxm3nydame licia(fa2ua(ronu1tpx mfetatfsDran pnu4tlerxo3oydfp  auei;s  etr(rpnu4op nmfet (fs2um( oot1oltn f3iyslm uan snu0 etrxf iytom eluvo;t t2umxopiy4amtn nvia(f Dua( pou0ope  i3ils a2ra(mont4aexnmfcootomDrlivslt0 ruoxo oudopt  netls sDur(root4tltnmi3iltlmDrau onu0trerxocoytoa  anvs s0srxr(r3nu4olenmivt (  rur( ooo1aet  ieild m umn snu4tltriociadopt  neslt0setoxm oo4omtelietat  Dumumoou1tet io3tasfa2rmnvs;t0 exnio3oo1om eaueo s)t2xm(m3nudapeemnci (farra( p;u4tpe mfctytfs ul(vp u)texnmrciydla   nesls)t2um(o3iy1lm nmicslt)a2rr(ro;t1oeeomociaslmDua(von(0alxnxoctadlmt aneo s)t2tmio3ny1omt mnesat) Drm(rpoo4opeo icild aDrmn pnu)aetnif3ia1latr ues;(  rxr(o3no1lme mfct s)sDurx  nt1tlt  oetat m2eln pnu0 rtrirciytlp   ieo;( trxo(o3ny1lm nlfctl(faDrmumpno4tleniieiadla2umn pn()trtnif ty1fm  lneil(0s2toxmpnodolt  ivsa( srtmumooo0apxomieias aDrlumsnt4 rtoir3ia1op eluvs;(0 etoxo3ou1amtnmiei s)s2ta(mp;u4tpen oeiyslsDrm(vs t)trxriocoo1la eaivo;t0sexoxo io4ap elicta(faDuax pnt0tex  o3tld s rl( sn() etomf3todop rauei;(0texm(r3iy1lmt miei sf rta(  ot4aex  i3ilsls2el(vs u)texnmr3iytop  luvi s t2xo(opno1altnlfvia(fa2rm(mpoo1optnifctad a2elnms;t4alxoxf3tydoaD lneil( trxrio3nu1ll  lies t  rraxr ;o1tpxniieiydfmDrmnvon(4aeeoir ia1fmtr nvo;()t2ur(m ou1olenmfvils) 2tmu o;o4olx ifctasfs2emums;()alxrxfcto1lm rai i;s  exmirpny1alt mivil(f Dumurpno1tlt  o3iatfaDumu s u0 eenmo3to1fat lu s;s0trxmxm nodomeelieslsfa2ra(rooo0ape  o3iyd s rlu on()trxnxr oadoaDe nvi;() euo(r3oydap   nvtat) Dtmxr ;u0alxo i3ils a2uanvo;u4alenmf3to1fpt  ueo (0 2xoxr3io4amtnlnei t)artm(m nu1altn o3iytfmDrm(vpnu0tlxrmfcty1oaDrauvo;s0trto(o iu1ap   ies sfarraur oo0oltniiciytla2em(ms u4alxoio oatlpDraueo t t2urxopou1lmtelncsa( aDrruroou1optn feiad a uaumonu0tetnmf3to1om eaivilt0 rurxrpno4am emncs t) rtauront0oltomfctltfm2emumo;(4tlenmr tydfpDr i sl(  exrir3io1om nlfcsltfartru pno1tpxnif3tydla emuvpnt)tleoxfcoy1lmDelnvs;t0setoio3iu1op n feil( srumurpou4teeo i3iytls eanvs;t)teenmo3ty1lat ai s s0texrim io1omen ictas  Dta(r no0tltnioctld mDel(mp t)alxrmo oa1omt li o t) 2xmio3iu1aleemfcs t  Durxmo;u4opeo icilslmDemu p u0aexrxo to1lptrluei (  2urxrpoudamtn nes () 2rr(r ;u4texniociat aDrluvo;t4trxoxr3ootlp rluvslt) 2tm(mpnu4lpen nvta() rtrurpoo0optnmoeiasls rmn onu0teeoxr to1fa  li o;s)texm(m no1oltn fvils aruaumooo4aeeoioctatfm ulnmpn()tltrxo to1om raieilt t2um(o iydap n fvsltf rumumpno1aptomo3ilt sDum(mo ()arxrmrcoo1lateli ol()teuoirpou1omeelnesa()aDtm( onu0ope ii3taslm2elumo;t)aetrio oadlmtelnvil(0 etr(r3no1apt  fvt () rurxmont1oexoiociytfs ea( o t) etoio3oatom eli ols tetoxm3iy4aptnmies tfa2rm( o;t0tlxnmfetasfmDeanvsn(0trtrirciy1lp ranvo s  rxoiopiu1aleemnctlsfs2ua( ooo0opx mf3tytls rauvo t4aeermfciodlmD aneilt)setoimpoy1ll elncilt sDuaxmont1aeenii3iat mDrmn on(4alenif ootopDeai ols)trtmxopiodomt  fcta()a2uru oot0oex mi3iatla um(mp (0texomf tadfm eanvi s s2tmxm3oo1lmt  ics s) 2raxront4opx mieils s ulums;t)aetomfcoy1fpD luvo ()t2uoio3oo1lp  lietlsfs2uax o;t4texo ociyd a2rmn snu)texoxfciotop r nvs ()s2ur(r iu1aptnmivsasfaDta(m nu4oet micias a rlump (0trenif3oo1fpDrauvs s)srtm(r3oy1om  mneil() 2truronu1olto feiys a2uau pnt)alermrcoo1fmt aieo;s0seurim3oo1lpeemicsasfa2tru  no0oexn oeias s2uln snt4 etnxf3oodlaDr u s ()t2xm(r oodapenmfetls  rumxrp;o4tlen f3tyd mDeanmo;t4artrmo oy1laD aueolt0 2to(r3ou1omtnlieil() Dumumpnt0apx iicilsfs2elumsnt4artrmf3oa1fa   ueilt) rxrimpny1apeemivsls  rurur ou0tptnmfciydfaDeluvsnt0trenmf iodfptrli i (0teum(o ou4op n fviltfsDta(m ;o0optomociltfsDranms;u)tltnmoctodlp elnvo t)s2xo(mpiu1omt lfetas)s2uaxrpot0tpxoiieiadlmDrmnmp;t0tlxnxf3oodlpte nesls trtrir oo1op emfesls sDta(mpnt0olt  fctltlaDeau snu4 exoif3oy1lmt lu o;()t2umir oo4lpenmnetl(fsDraum ;t1tlx  f3iadfm2ul( o;t0aeeniocty1latrlnvs t  2um(m3io1optelivtat aDtruro;u1altoioctytla2rln o (4 etoxr iodfp eli o;s0 2urxopiy4omt  icslt)s2tmumpot4tlt mfetytfs uau s u0texoxr tadomDe ivs;s  rtmimpou1lpen ieia()s2ta(  oo4ole mfetadfa2umumsn(4 ltnmr3ia1omt  ivs;s0teurir3no1ll nlnvsls  2tmxmonu0alxomoetytfs ua(vp;u0tlermfctodom   iei;(0t2xo(m3iudlptnmictls a2tm( o;o0oet  fetys a elnvs t0aexnxr3ty1fat an i;s  etmxrpou4om   ieslsf 2urumpoo0ope  ieils s rau o (0texnxoctatfaDr ivo;()srxmimpoo1olt lfvt sfsDtru  nu0alxniietatfm rlu pnt4 lxrmr totfp   n olt)trumxm3oydlpe lfcil(  2ua(mono4olenifciydfs elnvs;(0alxoxo oodlp elnvs (0s2toim3iu4lptemnet s) Dtaxr ou4apeomiciytlaDeanms (0trxnmfcto1lmDrlnvsls0 rtmxo3ou1alen fvtas srtaxro;o0tlx  ociatfm2rlnvs;u)teeoxf3ta1om  luvo;t  2xr(mpnydapt lnes t sDuau p;u1apxomo3iasfa2uanmonu0aexnmfcootfaD  i o s)trxmio iydopenmivilt  2rr( pot0oleniieiadlm rln s t0 etnmoctytlm eau i;(0tetmxm3no1aptnlieta( aDurumonu4aleoif3iasla2rm( s () lxnir iodfpt  neo;(0srxrir nudap nlies s arraurpoo0tee  ieiys s ulnmp;t0alenirciadlp ran s s t2um(opoo1lltemictlt) rtr( o;u4apx  ociyd m2eanmonu0teeoio iydlate ieo t)teumir iy4lptnmnvtls  2rmumont0aee  feiasfa2ul(vpn(4aexnif tatoa rli sls trum(opnudopt livia( sDurum oo0tlen ictltfaDemumpn() lxnmo3oytopDr ueils)teum(o3no4ll nlieia()a2ra(  nu0opxoii3ildfm ran onu0trtnxociadopDe ieils0seuo(r3iodlpt lneilt)aDrr(ront1tetnioeils m eanmp u0trxrmfcoy1omtrluei (0 rtrxrpiodapee feias a2ra(mp;t1tpxoioeiltfaDra(vs u4 rxomo3tydlp eauvs;t) rtr(m3io4olee fvsls)sDur(  no4tle iictat s elnmp () lxoircoa1om  livs;t) eumio3iu1lleemncsatfaDrr(  ot0tet miciasfm rl( onu0texnif3oatlmDrlu ols0srxo(m3iy4lpee nct ( srtmx  no4apeoifeildfa2ranmpn(4aexrxf tadoa eaueo;( srxoxmpnu1aleemiei s) 2ra(moot0apxn feiat m rmnms t0teenifctydlaDe ieo;s)srtoirpoo1amt mnetas) 2umu  nt0aee  fciadlsDea(mpn(0 exnircio1fmDrluvi t)s2uoir3iy1om n ncias)sDrr(r ;o1apx mf3iys a2ulump t4aexrxo to1fmD aieols trxm(r iy1am n fet (faruaum ou1opt iocias a2em(msnt) renifcoodfa   u sl()teurim oy1ap emiesl( srraumpnu1apenmi3iyslm em(vsn(0tetoxocoy1fmteluvs s) 2trim3oodamen iesl(f Draum ou1optniieildlaDulnmpn() rxrxf ta1lpD  uei;t) 2urirpoo4optnmfes t) rrm( oou0tet  octadlaDrm(vo ()arerir3ty1fp ranvi t t2xmxr nydomtn fcsa( aruru oou1opx mi3ilsfmDea(mpnt)aetnmociatlaDeln s;s  etrxopny4amtemfcsa(f 2uru pno0tptn oetytlsDraumo (4arxnio3iatlp   iei (0seurxo3iy1ol nlivsas)srurumo;o4alxomfeiytlaDemu s;() rxnio3iydfm r ues;(0teum(r iy4llt licslt)a2taxm ;t4oet moeiltfsDrluvp u)teeoifciy1op elivs s t2xrxr oo4am elfesas a2rrurpot4tlxomi3tatfm2el(mp t0treoxo3ty1opteai s s0 exr(o iy4opeemfvi ()s2rau  nu0olt  ieiydla ranvp t)tetnioctotfatr neils) 2tr(m oudam nmnes (fa2rmxmpou0tet mfciad a uauvp (0tlermo oa1oaD  uvi;t)t2xmxm oy1op elnvs (f 2umu  ;u1oexo fcildfmDel(mp t0artrif ootoptrliei;(0 2xmirpoy4amte nctlt)a2rm(  ;u0tpx moeiltfs2rmn pnu0tleoir iadlpDrlu ols) etr(r ou1ll n fcsl( arururpno4ale mo3ildla ea(ms;t)alxrmociodfm  aieolt0s2tmxm3ny1ll e ivs sfsDtrxmono4opx iiciatfs2rmn ont) ltnio tadfmDeanvo;s) 2trxo3oy1omeelneta(farua( pnu0aleomfetas sDra( snt4 leoxo3totom eluei t teumiopio1omenmicsas) Dtr(mpno1oet  ieiatlm2emuvs (0 eermfctotla  an i;t)t2uo(o iudlpt lfvi t srrrum ;u1apenmf3iydlaDel(vo u4aetnxr3ty1lmD an s;()t2tmxrpiu1ope lfvs sfsrtrxrpnu4olt ioetydlsDrmnms;u4trtrioctotfm r nvols srtrxr ou1ome liet sfs2rr(mp;u4tet mictls m2ulu s;(0 rxrif iadlmte ivil()trtm(o no4apenlfvslt  rurx poo4tetomoetlsfs ulnmo;(4teenxf ta1fm rauvi s0trtm(r iydomt lfeiltf Duru o;u0texniociltlm2um(ms u)tlerir todfm elues;()trtoio ny4lm   fesatfaDtr(mo;t0tlt  oeiad s ulnvs u4 rtrmr to1lmtrlnvslt setmio3oydlpt lncsatfsruau p;u1aleo oeiyt a rm( snu)aleomoctadomDraivs;s)srto(r nodlltnlfciltfarua( pnu0apenioctlt s2rmnvpnt0teerxo3iotfm  an s s  rtmirpiu1lpe licsl(fs2tmxmpnu1ole if3tat m um(mpnu0tlenxr totop rlnei;t s2uo(r iu4ape  fvt tfarrm(mo;u4tpeo oetas s2em( s (0 rxrxf3todlpt auei;s s2umxm ny1lp nmies ()sDtmum ;o1aptnmo3iasfmDelnms u)aeermr3io1fat aues s)t2uoxmpno4opt mieta(  rtax pot0oltomoeiydfm uau p;()tlerxo iy1oa   uei t srto(m iy1ame lnci ( a2umxmo;o0olxn ocilsls rmn s;t0alxrif oo1fp eaieo t0t2xm(o3io4lp   fct t  Dra( pno0ole  feilsfa rlu o u0teenxf oydla e u slt sexoxo3ny1alen icils)a2ra( o;o1ope ifcilsla2rluvp u) lxrmo3oo1op  luvolt0sruoxo3ny4amte fei t aDtmu p;o4olt moeildfm uaumpn() exnircia1lm r ueols)texr(rpiu4omtemfvilsf 2rm(  ;o4aptnmfciydlaDemu s t)trtoxo3totomDr u s t0 rtmxo3iydaltn feslsfsrrrx  ;u1aptn feiltla2eln p;t)trerxfciydlaDe nvi t)sexm(mpiy1al emfvs t)srur(  ;u1aeto ieilsfaDrlu o;(0areoiociadom ean i;(0 2uoxopoudam e nvsasfsrtau  ou1oltoiictytfs2rlnmp;t)aetoio iydfm rau s ()srumim3iudape mivsas arrrxronu0aex mietlsls ua(vs;u0alxrio3ia1lmteli o;( trumimpou1ap nmncs (faDrr( pot1olt  ietldla rln s;u)aetoircoy1lm rlnvsls0 rto(r3oy1ll e ncil(fsrum(  ;u1aptn ieiatls2ea(vs t)tlxoiociatfmtelneo;s)t2xr(mpnudll  mneil()a2ur( poo1tpt  feiadlsDulu s t0aexnxr ty1fa  lieols0s2umio oy4op  lfetatf ruru  oo0opt if3iat a2eau o;(0tetnio3ootfa   ueil()trtoxopny4lmee fcsas sDuaxroot1oex mi3iatfs2rlu pnt0 rxrmociotop  auvi;()t2toxo oudomtn nesa( aDrmx o;o1tpen ocils mDrauvpnu4 rxniociy1fpD  uvslt  eum(mpoydlptn fctl()aDrmxm nu1opto iciltfa2uauvo;(0tlerxrctotop elu i t) rum(r3oydlptelncsasfartru  ;o0teen icildfa2rm( o;t4 etnxf3ootom e ueolt0trxo(mpoy1ame  neiasf rtaxro;u4texo fctysfm2umumpnt) lxoxf oytoateai i;s  rxoxrpoo1lmtemicils) Dum( pnt0alx  o3iat aDel(ms ()tlxomf oatop elnvols t2toxo3oydlmtelfvsa(  Draxr ou4tex  f3tydfs rmn s;t4aexoif oodlaD  u ol()s2trxrpnodlm elnvs t  Duax pnt1olt  i3ilt s2uanmo u0 ltnmf ia1oat livs s)s2urir3nydam emnvias) 2um(m nu4opeomociatfaDel( pnt)tlxnxo3tatlp  lu s ()tetoxm nudlp emfcs t s2um(m nt1oet mictldfs2um( s u4 exnmr3tadop   i i (0sruoir nu1olee nesas  2ta( pou4tltn ocildfa2rau o (4teerio3oa1fpD  uvi;(0setr(m iudomt  icils  2tm(mpnt1olxnioetyd a uaumsnt) leoxoctytoatrlu i;s  exr(r oudlme lfes sfaDuru pot4alx mf3iadfa2rmn sn(4 rxnio3oy1fptr ieol(  2umimpoo1lmee fet (f Duaxm ;u0alen iciadfmDumu p;t)trtoir3iodom raivilt)t2trxo3ou1lle livs sfs2tr(r ;u1aptniicilsfaDrl(vp;u4tetrircoadlpt anvs ()trxm(r no1lpenlnctl(  2taxmoou1oltn fciltfm2rmnvs;t0 rxoif3tadoa  luvi ()srum(opnu4apeemivt tfs2rrurono0ape mieiasla um(vsnu) eerio3oatlmD lnes s) rtr(rpoy1om elnvi ()a2ta(ro;u4aee  fetadlsDul( s;(4texoif3oy1lp  li i;() 2uoir iodom nlieiasfarur(mp;u4opeoioetydfa uanvsnt4aexoxo oo1fp rau s s)t2umiopoo1lm   fvtlt)artrx p;o0alt ii3iltfmDrlnvsnt)trerxr3oa1omD anei;( t2trxrpiy1lptn ncia()aDrru o;o1tetomfctydlaDum(vont)tleoirciytomt aneo;()truoir io4ol   ivs (f rraumpnu0tltn i3iltfa2rauvp u0 etnir3tadopD lnvs;t)s2xo(mpiodap   ivta(fsDraxm nt1tleoifeiltlsDranms t)tetrxrciadop ean i;t seum(mpiu4ameemict () rumu  ot0teenif3iytls2uauvo t4aetoxr iotopD auvs;t)teumimpiudlpenmivtlt) 2rrurpnu0teeomfciys m eluvpn(4aeeoxf iodfatrluvol(0srxmxrpio1ale  ictltfarraxm no4oetn feildfs2emu o;t) lxoxo3iadopDelueilt0s2tm(m3io4lm e fvtlt srurx o;o1olx  ociatlm2ran o t4 ltrmo iy1fm eanvo;s0 2xm(o3iodlmt  iei s) 2ua(m ;o4aex  octldlm ranmo ()trxoxfctydoateaivolt)teum(mpnu4lptelivi sf rtaxmpot0ope  i3iltfs ul(vpnu0tltnmo3iotfateln i;t0trtmio3io1alt  fvtl(f Dumxr nu1opto fctydfm rauvsn(0 exrxo3oodfmtran i t) 2uoio iu1lpte nctat s2umxm ;u0tee  oeiat s emu p t0tetoxr todfptr ivs ( trumir3iu4lp emiviltf 2rm( poo0oltnmiciydla2rm( p t4trtnxrciydfmtranei s  rur(r3no4aptn fvt tfarua(r nu4tetn f3iyd m uluvp;() lenmo3ia1fmtelnei;t texo(m3oo1lmeelfvt t)srua(m nt4oetn fctld m2uluvsnu0 rtrmf3tydfa  lu i s) 2urio no1olee ieia( arrmxrpoo0oeto i3tytfaDean snt4 eenmf iytomtrlnesl()t2toir nu4opee fvtlt)s2urumpnt0aleomociltfa2eau p (4 rxnxf iadom  aies;s  2umxm3ou1op elict (fsDraxrooo4opxoio3ildfm2uan o;u0altrxr3iytfmDeli s t0 2xo(r iodlmtnlnvs ( s2rax p;u4aee iietaslaDra(mon(4altoiocoydoa rlnvsls  exo(mpoy4aptnmiviat  2tr(m no0tetnifeiltlm2rmuvont0altrmo3iydoa e u s t  etmim3oudalenmnci () Drrxro;o0tptoiiciaslm2rm( o;(0 rxnmr3io1faDelues t)t2xrxm oy4am nlictas a2ur( pnt1tptomociltla2ra(mp u4trxrmf3ootfmteau ilt) exo(m3iydlp e icsa() 2rrxmoou0tpeo feiysls2umnmpnu)trerxrcto1faDe u i (  rum(mpiy1lptn net t a2raur nt0opt  ocilt a emnvo u0tltoifcoadlateln sl() rxmxrpoudop elnviat srrmur ot4texn o3ildfm2ra(vs u4tetrxfctytfm eai il(0 eur(opiu1aleemiei sfs2um(rp;t4olxomi3ias m2em(ms;u4texomr iadlp r u o t  2xrim3iy4olt  nei (fsDtm(r no1oetoiociysls uanvp u4 ltomociadlaDr i ols)srumxr iudolen iesat)arumxmpno0apxnifcildfsDra(mp ()trxoir io1la e uvsls0srurio iydap elnes ( sruau  no1teto fctytlm2umnvonu4 ltrxr3oy1fpt  iei;s)tetoimpnodapenmivilsfsDraxm ou1oleo oeiaslm ra(mpn(0tlenxo oy1op raivolt  rtoim no4optnlnesls) rtrxroou1opto iciadfa2em(msn()aetrmfctotlp  aiei ()trtr(opiu1lptelncslsf rrmurpnt4oleomiciad a ra(mo;t)alermf3ootfate nesls0srxrxopou1amenlnci t)a2ua(mo;o0aeeomo3tlt m2rauvp;u0aeenifcia1lm eauei;(0trtmxopoydapeelfei ( arraxmo;t0oeto ieiatfm emnvo;t4alenir iatfaD lu il(0texo(opnydap n ici s)a2rrump;o1alt iiciat a elumont0tleoxocoydfmD ai slt0 2ur(m no1al  lfvt () Dtmxmoot4tet mieilsls rmuvpnu4tlxriociadlpteauvo;s)trxmxmpnu1ole  nciasfa2um( pnt4apto f3tatfsDum(vp;t0alxoir3ootlpDr u ols sexo(r iy1ole mivs sf Dta(m ;o1tpeo ieilsfmDum(ms t) lermf3iodfptrlnesls  rumxo ny4amtnmieiat)srta(mo;t1alxoii3tysfs emnvo;u0tlxnif tatfa rau ol( s2tm(o3oo4apee ivia()a2ua(moot0apt  fetlt s ra(vsn(0tltrxr iadfm elnei;t0trxrxm iu1oleelnetas)aDtm( pnt4alx ii3tltfa ua( snu4aetrmo tydfmDr n i;t  eurxo3io1am n icsl( artr(m ;u0tlx mf3tas mDuau o t0trerio iotoptrluvs s)tetm(r3ny4lpe livsl( srururpoo1tet mieiltfm2rmnmo ()tltnxr iodopDeaivo s0 2trir3io1lpt mfcsa() 2tmxro;u1oetoifciadfs rl(vsn(4tetrxr3iodfptr nes;s s2ur(m3oy4lpenlfcils  2raxmoot0tlx mieiat a2ean o u0arxrmo oa1fpte u ol() exrim ny4al n fct s  Dtm(r nu4oeeoio3tysfa ranvo u4 etoxfctodfptr neol( t2xrxmpou1ap e ivsa(  Dtauro;u1tlt mociatlsDulump u4 lerif oadfa  aues t0sexr(o3iy1amtnlnvt ()s2taxmono0olt moctlt s umuvs;u4tlxrmo ty1fm  luei;( t2uo(m nodlmt mncias srtm(m ;u1oetomfciad s2rmu ont0 etoxocootoptrlneols srtr(opoy4omtnmfvsat  Dtmx oot1teenmo3tltfa emuvsn() ltomrcoatfp rln s;s)s2um(r3no1ame mncils srur(mono4tptnio3iasls2rm(vo;u)trtrmocoytfaDr ieo t) euoir io1ope  ieiltfs2rr(rpnu4tetnmf3ilt sDelu s;(0 lxnircootoa  aues;s trxoxopoo4lptelietltf Dtm(rpno1aetomo3ilsfa2ea(msn(4aleoifctatlpDe ies;t srtoimpio1lm elfv
\ No newline at end of file
@@ -0,0 +1 @@
+uvs s  rxrirpou1amtemfcilt) rtm(rpno0olxn ieias a2emums t)alenxociydlat  i ols0teurir oo4ap e fvilt  Drmxronu0apxnifetltfa2ua(vo;t)trtoifcio1fm eai o;t0trtm(o3ou1om  lneilt) Drmxmooo4aleoiieiadfmDrlu onu4alenmrctotfpDrli ol(0seurio nu1lmtemivs t)s2urxr ou1tleomfeiydfm rluvp (0tetrmr3tadlpD aneilt setrir3nydop e fesa(  2ururpno4oeen feiasfs2umnmont) etnio3iotomDrlivol( t2xoxm3oo1altnmnci () Drax pou4oltnmfctyt s2rlu sn()aetrmfcoatoaD  ies s0sexrxm3nu4olenlnvtlsf Dta( ont4opt mf3tltfs eaump u)alxoxr ta1oateaneols)t2uoir3oo4omtelieilsfaDuru p;t4aetniiciadlsDeln p;t)tlxnxr3iy1lmDrlu s;s s2ur(rpiodll elfvtatf 2ra(mooo4tet  feiyslsDuluvs;u)alxnxo iatom e uvil(0s2tmio3iydlmt mnct t  2tmurono1aptnio3ild m raumonu4artnmoctatfa rli ols) rxrxr nydoltelfeilt) rta(r nu1ole  octydfa ul(ms;(4treomo3iadomteaieslt) 2toiopio4lpen ncs s arrrxro;u0tlxoioeiat m rau s (0trtoircoo1op eln o;t0setr(o ny1oleelfvs s aDtrump;t4aexomfetltlm2rau p;t0tleoio tydfp r ivol()t2xmxo iydopeemiet t)sDtmxro;u4tlx  oetyt a rmnvpn(0aexrxf3ty1fp rli il()sruoimpoo1ll nlivt ( s2ra( pou4tpeomi3iyt m2rm( on(0aeenir iy1lpte n ilt) rtoxo iudaleelivsas artm(m ou0tee ifctls m ua(ms t0teerxfcoodomt ln i t0 rto(o ny1ole mieta(f Duax  ;t1ape miciaslm2elump;u)tetnxf oo1la rau o;t0s2xoio3iodam emiesat)sDtaxronu4opxnii3ildla2um(ms;u0trtomrcoadoa  lues;( t2xrio iodlpt lieta() 2ur(mp;u0tpe  ieiytfa2em( p u0texoxr iadop   n i;t0srumxrpiydll  mfeiltfsDurur ou4apxo f3iysfs rmuvs t4 rtnxo3ta1fmDrlieo s) etoxmpiudllt mnesl(fsrurx ono0opxnmi3iasfsDrm(monu) leoxr3iotfpt aneo;( t2xriopny4amtelncsl( sDum(r oo1opeomf3iydfmDra(monu)trxrmr ty1lm eau i ()srtoxr3iydllt lnct s a2uax p;o1oeen ociys a2emuvp t4 rxnxo3iytla eaueil(0srtrir oodal emiesl(  2rm(rpnu0tlxomfciasls2uluvp;(0alenifcoydfaDe nvo;( trtr(r3iodam  lfvil() ruaurpou1tpxo fctat m2rauvo;t4 lxnmo to1fatrlueolt trtmim3iudlpeelncs t) Dtmx ono4texoio3iadls2ranmp;t4 rtnxo3oa1lm rluvslt  rxrxr3io1om  mfvtat artr(r no1aet mocilsls2rm( snu)altnxf3totfaDelivolt0texoim oy1olee fctat)sDrmxmpnu4apx mfctysfm2um(mon(4 ltoxo iotfaD  ieils trxm(r3io1lltn fcsls  rumx  nt0olenmocilsfm rlnmp u0arermr3oydlmt  n o;()sruoxr oodamenlfeil()sDtmurpnt0aetn f3tys m umnmonu0tetoiociadlpDr n il() 2toxm ou1lptnlieiatfs2uru ooo0alto i3iadls2rlnmpn(0aetoxo oatoa e ues;(0trumir iy4lmtn iet s)aDrrurp;o4oexomfetldfm2umu snt)tltrmr iy1op   ieo t t2xmxr oy1lp  lnei sfsrum(rpnu4oleo o3tyslm2elump u) exoxrcoa1faD  neols sruoxr3iu1lm nmfcsls sDrmxront0olt iieiyt a2rlu o t) rtnxo3oy1fmtrln s () 2trir3io1lmte nvi (faDtr( ont1apx iicilt sDemnvs;u)artrmr3oodlmD luvo;t0t2uoirpnu1aleelneias aDra(mont0oee  icias m rlnmo;t0 rtrxo to1opD lieo;s) 2xo(o3io4ape mfvsasf Dtm(r nu1aet mf3ilsfa eanms;t4arxnifctytlp raueo;(  2xmir nu4op  lfei t)artrum ;u1oetn o3iydlm emums t4aetnmf3oodla   n o;t0s2umxo ou4lp   nvs tfsrta(ront0tltnmfeilsfsDra( o (0tleomociotopDrlueil(0srto(opou4ame lneta(fa2tr(rp;u4tpxnif3iyslm emn p;t)arenio iotlmDeau sls0 rxrxr iy1apte nvta(fsrrmur ;o1alt iocildla rmn sn(4aeenxr3ia1oaD aieil( sruoxr3oodol n nei s)artaumo;u4oexomiciyd sDra(vp t0alxrio3iotlpD  u i;s0 2trio3oy4ap   ictlt)srraxmpot1opto ictysfs uluvo;u0tetrmf oatfmtrlnei s0 rtr(m iu1alee nei (fsDtr(rpno4opxn feiad m2umn o u0 ltnxr to1omtelieo t)t2trirpoudlm  mnvtasfs2taxm no1alx moeiad s2uluvs t)arxnmo3oadoa eanes;(0 2umio io1apt  nvia( srtr(m ou1oeto feilt aDrlu o;t0aeerio3ia1fm  li slt t2trxo no4apeelfct sf Dtr(  no0aeeomocilt mDrlu pnt)altnxo3oytop r uvolt) 2xoio iy1altn feil()aDrau oou4tpx iiciydfmDraump;u4alxrmo3io1lpD  neo t)sruoxr ou4omteliei (fa2tau pnu0aexnmociysla uanmp t0arerxr iy1la raiesl(0s2urxrpou4apee neias)aDumurpot1optnio3iaslaDelnvsnu)aetomr3oadomDeanvo ( trxm(r3io1ap nmfvias sDraxmoot4oeenmfctltfm2emuvs u0arenxf to1lmDraivsl()t2trxo oodomenmfet s)s2rax ont1oeenii3iyd s2eluvsnu0areomo3iodlaDeanvs;t)teuoxopoo1ole  nci tfaDumxrp;t0olenmociadfs2rau p;() rtoifctadoaDrau i;t teto(o ny1am elnci t  rta( o;o4aex iietlsls2emnvs u0 ltnir3iy1faDeli olt texoxopiy4apenlicsas a2rrx pot1aleomfcils sDean o t) eeoifcoytfp elivi s0trurimpio4ol e ieiasf Dtmumpnt1ole mocils sDem(vs t)aexoxf io1faDrliei;t sexr(mpny4llt  ictasfa2uax pno0ale miciltla2rlnmsn()tlxrmociadfa e n s t  euoxmpnudlleelfct s a2umu ono0aetnmfciadlm rln o u0aleoxo iydfm rli o (  2trir3iy1apt lfeias) rtrur oo0tpto feildlaDuluvp;u4alenxrcty1lmDr ueolt0 exmimpnu1omt  fcsl() 2urumoot4aptoifcilsfm ua(vo (0aetrifctatlmD lnvolt  2ur(r3no1al e fvtls srtmxr ou0oee  i3iyslsDel(vont)arerxr3iydfp   u slt)srtr(m iudoltn ici sfs2rmurpoo1apxoifeiyd mDra(vsnu4 ltoxfcoodlmteaueo;()t2xrxr nodlle  fetlt)srumur oo1alxomfeiat m elu ont)tlerxfcty1laD  uei (0trur(o3ou4ap n ivsls)arrrx oou1tex  feiadfa2uan o;u0 leomo3iy1fa   nes;(0t2umxopnu1lp n nvi s srumxmp;t4oetomfeild s2rmumo;u)aeenmr ty1lmteaiei;s)s2tmxr oydlme  nvs (  2ururpot0alxniociad a2rauvon(4aetoxrcoodoaD auvsls) 2um(opou4oltnmivi tf Drrxrpoo0apxnmo3iadfaDrlums u0aetnmocoo1laDraneo;s0trurimpiu4lpe mnvta(f rrru  ou0olenioeildla2rlu p;(4 eerxo tydfmD  ies s0 2trim ou4ll elnct sfarta(r nu1ape mi3iadla raumpnu0 rtnmfciodoaD  n o;t  2xrxo3no1lp nlnvt (f Drmx pot0tpeoifctatla elnms () rtnir oatlaD  u sls0srumiopiydom  mnvi ()srrrxr ;t1aex  fetat sDrlums t4aeerxo tydopDrln o ()srtmir oodllt lieiat) 2trumont0tlt mietlslaDelu s;u)teeoxrciotfa e ivsl(  euoim3nu4optn neiat)s2rrumpou4aexnmo3tldfmDea(mo (0trtrmf3iydlp  lu o t)setrxo oy4amtnlncsl(  rtmu o;o0optomiciltfaDrmumonu0arxomfciatfpDr ieil(0 2xrxopno1optnlfvs t) Duru pnt4ope io3iatfa2eluvp;t4aeenxr tatfaDe neilt0setoiopio4olte iesl() 2rrxmpnt4olx  f3tasla2rmnvp t)trxrxf3tatfat ai ils) rumir3iu4optnmnes s  Dta(m ot1aex iociatfm2rmnmo t) ltrxr oadfmDr ueo;t) ruoir3iudlmenlictls) Dtaxrp;t0aexn feiltlm el( pnu)tltnxf iotom r ueo;s0 2urxr ou4am emfvtlsfaDtr( pno4olxomf3iys m2ulumo;() exomo iytom  liei;s  2xm(r3io1ameemiei t) Dtaxr ot0tleniictatfs emump;u4areriocia1lateauvo t)teto(o oudolee ietat) rrru p;t4aeen ocildlsDumn s;t0trtnio3oy1fptr nei;(0 rxo(opoo4aptnlicslt aDtm( o;t1tpxnmf3ilt aDranmp;t) exrif3oytoa   nvs s0s2xrir3iydale  nvtls) rrr(mooo4aexn ieiytfsDrl( s;u)aexrmocty1latelnvs s  2xmiopiy1opt lictas)arrmurooo1opxn oeiasfmDuluvp u4texnircoatfatelivs s0trto(r oodopte nvsas)sDuau pot1tlx  ietyt m2ean o t4trenmf oy1opDrai o (0tetrxo iydlle lnei t s2umxrooo0tlx  f3ilslm el(vp;t4 exrxo oydlaD  u s s) exoxmpoo1am  lnvtltfs2tr(mont4tptomocilsfaDra( snt0trtrmf iytfmt an ols) 2trxm3iy4llt mfctasfaDrm(rono0olt  ictadfa2rmuvp u0tlxniocia1opDr nvi (0t2tmxr3ou1apte iei t srur( onu1tpx  oeiaslm rluvs (0 rtnmo3ta1fmteanvs s truoir3io4lmtnmfcslt aDum( p;o0aptoif3tlsfmDeanvs;(0arenif to1opDrlnes;(0trto(m3ny1op emivtls)artmx pnt0aptnif3tyd aDraums (4artnxr3to1opDr n s t s2urio ou4amtemnvsl()aDtrxroou1alxomoeiysfm2eln snu0tlerxo3iytfpDelnvi t s2urio iu4al   fet sfartmxmo;t4tee  ieiat sDrluvpn(4 exomo3oo1lm r neilt)trurxrpou1omeelnvs ( aruauront1oexomietyt m ulnvs (4 rxomf iytop rai ol()s2urxo3oodaleelivil()srurx pou4opxo feiasla2ulnmpnt4 eerxrcoytomt anvi t  etrxr3nydom n iei ()sDum(ro;o1alen o3iytlm rau snt4tltoir ootlatr n slt  eumxopoydal  lfci ()sDtmu onu1opxomi3iltla2umn o;t)aeerir iodlptrauvo;t0srxm(rpiydolt  ncs s)sDtr( ont4alxoifctadfm elumpnu0trxnio3oytom r ieo ()sexoxrpno1llt mfesa(f Dtax pot0olxo feiatfm ranvsn()trxrxfciydomDr i i (  2umxopio4lle lfvias  rrau o;u1opt  ieiydla rl( o;t0tetnxrctotlaD lnes;s seumio nodop   netas  2rrxrono4texnii3ilt mDel(vonu0 rxrioctotlmDranei (0texoxm3oudaptn icias)aDraump;t0tptn oeiatfm rau s t0aexnmo oytoa raneo ( trum(opnu4amt mnctls) 2trxrp;o4alt mfciaslm2umnmo;t4tleriocta1oatrln i t seuoxrpio4amte feta(fsDraur ot4oexn feiytfsDuaumpnu4 reomociadop eau ilt) 2toxopoydopenlfvils sDrrurp;u0aeeo o3tls aDranvp t)tetrif iodopDeanei;s)t2ur(r3nudamtemivilt s2rm(mooo4tet  iciyt a2ea( snu)aexoio3iodfaDrli i;t tetoiopoy1op   ncsat aDuaumpnt1altn ieiatlm2eluvo t4tlxnmociydlpD  ueo s  eur(opnudapenmieta( arrrurp;t4teto f3iatlm ua( o;u) exoxo3oa1om e n ol()t2trio3oodal n nvias)a2trurooo4olt mo3tadfmDua(vp;u0aeerirciodfm e i o s) eurio nu4lpt  fesa()sDrrxm oo1opxomfcildfm rm(mp;()trtoxf tytlpte i o t0t2tmxm3nu1lleemfcs tfsrtmu p;u4oleniictytfaDeluvs;t4 rxoiocoadlaDeaueols) exmxo iu1lpte fvsl(fsDrrum oo1oex  fciydlm2el( onu4tlerxf tytomtelnvo t t2to(m3nodamee fetat arum( o;u1aptoioetls a rlu pnu0 rxnxf3ia1om   uvs t0t2xo(m ny1olee iet sfaDumuroot0alxniociys a2eluvs;u)tltoir ia1lp e ivo;t0 2toxo3iy1lltelnvtasf 2urxr ;o4opxn iciydfs uanvs ()altriociodfmDrlueslt  2tr(r iu1aleemneilt s2rrx  ;u1apt ii3tlslaDrlu s;u4 exrxf tadopD aiesls0tetmio3oodame mfvs t sDumur nt1tleoiieiyd a rmuvsn()tetriocta1la rlivs t0t2trirpiy4apenlfetas)sDraumpou0oexnifeiys aDrl( sn()teerir3oytom elu s;t0s2tmimpnu4llt mfvta()a2ra( p;u1aeenmi3iat a elnms;t) rtrmocoadlmD anesls0t2xo(rpiy1lp e fvia()sDrmur ;o4oexnmf3iasla eln s;u0artomr totoptelu ilt) rxrxo3iu1ll  livt ( s2rr(r ;u1oleo fetysfm ea( p;u4trtrmr oydfaD lu o t tetr(r3oy4ole liet sfsDtr( p;t1olxomociaslm uau pnt4 reoif3todoatrau i t0trxrir oydal nlnei (f rrr(r no0aptn o3ilt aDum(ms u4tlxnmr iadfpDrau i s)setrim3nudll elfctls)sDtm(ront1tex mfciytlm2uln p;u0aetoxr3totlptr ivo;()s2xoxo iu4ll e nvil(fs2uaxm nu1apxo ocilsfs2rlnvo;u) rxnxf io1lm e n i t)t2xrxo iu1omte nctas) rurx  oo0apxomoeiltfa el( ont0 lxnir3oydom rlivo ( teto(mpoo1opte iesa( aDrmx  ;t0optoifciadls rau pnu0aetomo oydom   nei;t  2toxm iu1oltemieils a2rrxmpou1texnio3iad m2ua(vont0tetrif3iy1la  lnes (  2xrxr nu4olt mfct t)s2ra(m nt1oltn ietldlsDemump;u0tlxrxo3oatfpDe u ols0setrimpno1lltemieilt)artaur ;o1alenio3tytfaDum( pnu0 lerxf3oa1opD  uei;s0setr(mpiodame mnvs t arua(rpnu4aet  ocildlsDelu o;(0 lxrxfcoo1fpD  u s;(0s2xoxmpoo1openlnvsl(f 2umx ono1apeomo3iydls2rmuvo;t4aexrmo ty1fatrlnvolt)s2trio3nu1apen neiasfa2rm( p;o4tex  oeiltlmDelu p t) lxnir ia1lpt liesl()s2toio iudlpt  icsl() rraxroot4tetomociasfs raumo t0 lxnif3iatfpD  n o s)srxrio3ny4apenmnct () Dtm(m oo4teto f3iydla2eanmp;u4treoxocoo1oa  aues;s trumim3oy1lme lfct ()sruaumonu1aexoifcilt m uau o (0tlerir3oydoa e nei (0teum(m3iudal  lfciat  Dtmxmoou4aexnifctatfm rlnmp;(0aeeoxf ta1lpt  ivi;t  eto(r3ny1op  liesas) Dtmxmo;u1oeenioeiasfs uanmsn(4trerxo iotoaD  u i;(0 etr(r iudap e nvtls)s2urx onu0opeo iciadfaDrauvs ()tltnmoctadlmD  uvsls s2trirpoo4opt  fei sf 2rmu oot4ale  ieiyt mDem(vp;(0aetoio3ootopDrlivs;t)srxmxr3ou4olen nci t)a2rax oou0tpenmo3tyd m uln s u4alxnmfcoy1fp eaivi;t)trum(r3oy1lmtn ivslt)s2rmxrpoo0oltoii3iltlm2umums t)alxoxo3tytfa e uvsl()sexmxm nodop  mfcsls a2umu p;u4apenmociysfmDrau pn(4texrxr3iodlpD aneilt)trur(r oo1alee fci s)aDua(rpou4oetniicils m uanvont0areoio iatopDrlies (  rxoxo nydomt  fes sfs2tru  ou0tlx  feilt mDrlu o ()aleoif3oydomDranvi s0teuo(m iu1ap e fvtls)aDum(ro;u0alxnmo3ild s umump (0tlermf iydlm   uvsl( sruoio nu4amt miesa(faDrm(  ;t1olt  iciadlmDrmums (4alenmr3iotoa e ivsls0 exmim3no1om e fvt (  rtrxronu4tltniiciad a eanmo;(4 exomocoodla elnei t)trum(m3iydoltn fet t  ruaumo;t0altn octyt aDua( snu)tetnmr3totoat  ieo;( srto(mpio4altnmfcsa()s2rrur nt4ope mfetld aDuau on()tltnmrcto1oaD lnvs t trtmio3oudal n fet t arrrxrp;u4olxomfciltlmDran p;u)alenmf3iy1om  ai i (  rto(opiy4lltnlnetls artm(mpnt0tpx mietadfm eauvp;(0aleoif3ta1laD an o;( trumir3oodolenmnvs s)aDum(mont4apxn o3ilsfa ulu s (4arxnxocoodlmD  ivs;( teuoim oo4opeelnesl(  rta(  no1oltnifetldfmDemuvsnt4trtoxf to1fatr u sl(  eto(o nu4apee iei tfs2tr(rp;o4texnifctas m eanmon(4 reoxociotlmDrli i;s)teto(r3iy4lp n nciltfsDuru  ot0tpe  oetys a2ulu pn()teerir3todfpD  ues s)t2xmir iu4ope mnvia() 2uru  nu1open i3ild sDrl(mo;t0trenmf oy1lp raueils s2xrxr nu4amte fvs ()srra(monu0teeoif3tltlsDrlnvp u0tlxrxf ta1fpD li o s)srum(m3nu4al e nvi ()a2umump;t0apeoioeias sDemn snu) eenmfcty1fp rai i;t) eto(r3nodop nlfci (f Dtmumo;o1aet moeiad s rmuvo;t0aetomf3oytlm r nes s) 2xo(rpny4om   feta(fsDrauro;u0oetniietls a rmnvsnu4aleoxf3oadlmteanvslt)t2xr(mpoydopte ivtls) rtrxro;t4tpxnmieiadfa rmnmp;(0artrmr3iatoptraneilt s2urio3iu1ap emfvil( s2rrxmpot0apeo iciysls um( pnu)aetrio3oodla eanvs;s)seumxm iudomeemncsat) 2uaumpou1tptnmictas m2uanmp t4altrioctodlmtr n s;s  2tmxo iu1lle lfct s)s2uru ono1apenmo3tas mDel(mp;(0aeenio oydoaD  i slt  rxmiopiu4ale  ivt t)srra(  ou1tltoif3ilt a2ul( o u)alerio iodomDr nvs;t  eum(m nu1amt  nesas  Dur(r ot4tpe mf3ias a2ra(mo;t)teerif tatom rlueol( t2tm(opno4lmeemict s)aDuax  ou0aptnmi3tlsla ua( o t0texoxo iatfpDrlnvo;s  2xoim nu4omtemfvtat)arua(mpnt1alenmo3iltla2uluvonu) rtnxfcoadop e uvsl( srtr(mpno4lltelnet (fa2tru o;t1olenifeiysfa emnvs;() rxrxr oydlmDe ieils teumim ny4ap nmfetatfartau pot1alxo octysls uan o ()teeoxf3ia1fmte ueo;s)s2urir ou4ll nmfvias)srrmumooo1aet ifcildlm el(mo;t)tlxrxf3oadla  luvils0texrim iudope  ncslt)sDur(m oo1apeomo3tlsls2ulu snt4treoif3tydlmtrli s;()setoxrpiu4lm e ivs t a2trxmooo4oeeo fcild a2uaump t) etrxf io1fmDrlu s;() etrxr3iudam e net t  rtmu  ot4oltnmi3iydfsDean on(4 rermociatfmtrauvi;(0 rxrxmpnu1ale  nvi (  2raxrpot4texomi3tadfm eln sn(4treniocoa1fm  an sls)t2xrxr oo4ol nmict t)a2ururpou4tpeo fciys sDrm( p u) lenxfctydlmDeai i;s sexoxr3ou4lpt lieias)a2urxmo;o0oexomi3iydla2rlums;t4 rtnmr oo1lmD  u ilt0sexo(o3nudope lnciasf Drmum ;u0ole  ietldfs2ea(mpnu0teenxo3iatla ranvslt seurirpiu4ap   fctl(fsrum(  ot4apeomocils m2rl(vp (0trtnxf iytomteaivo () 2xrio3io1am  mfvil(f 2umxronu0aetn ociasfsDrlnvp;t0trenxoctadlat  ues s0s2uoxr3ny4aptnlfvt s)a2rrxro;o0tptoifeiadfaDemnvp;() exoio3tatlmDelueo t0sexrxrpoy4amee fvtas)srrmx  ;u0aleomo3tat sDrlu snu)aleomr3iotlmDran s;t)sexrir io1amtnlivi s)sDraxrp;t4aet ioetlsfa elnvp t)aetnxrciodfmtrli ils seuo(mpno4ap emfvia()arururpot0oee io3iysfs emuvont)alxnxr tytfpD auvo (0 etmxo no1lmee nci (fa2rmxmpot1oexomf3iltfa2ea( s;u)treoxf tydlmDe ivs t t2xoir ny4lpe mictlt  Dumx o;o4tltnmo3tltfs ua(mpnt4trtoxrctodop  li s;t) 2uoim iy1lltemnesasf Dur(m ;u4texn f3ild sDel(vs () etomr to1fmt  i ols0 eum(mpoydalee ict (fsDtru  ot0olxomfctldls ul( onu0trtnmo3tydfatrli o;s tetoim io4al emfesas  rumumpot1olxn iciytfmDeln p (4trtrxrcio1om rai sls)trxm(mpiy1lm e nvi s)a2trx  ;t1tle ifctydla rlnms (4 rxoxrciydoa rlnes;() exrxm3oudll elnei s  rtrxmpnu4alto o3tysla2umnms;u)aeenif ty1fa  lu i;(0texo(m iodol  mfctls arumur no0texnii3tydfs2rm(vonu)tltoxo oa1faDr nvils0 rxm(mpio1omen iesatfaDum( pou1alx mo3iat mDrl(ms;(0aetrif oydlmD ai i (0seurimpou4olt lnvi t srtaxrpot0alxomieilsfs2rm(mo (0teerxo todfa eai o t  rtoio3oudlp   neiltf 2taum nt4olx ii3iat m2rmnmp;u4 ltriociodfmtelu s;t sexrxopiodll nlnvt tf rtau pnt0tle mfciasfs2rau p (0 rtnmoctotfpDrlu i;t t2to(rpiodlmtn fei s  2tax o;t0ole  fetysfa eau snt)altrxr iydla eaivils0trum(mpio4om elfvt t arumu pnt1ope ifeiltfs2ra(vp;u4tlxnir3tatoa   neilt srtrxmpoo4lp elfetas  2uaxmpot1tlt miciydlsDelnms;() rxomrcto1fmt aivo;t t2umir3oy4ap n neiatf Dra(ront0openmieiydlmDel( snt0alxnxr iotfm eau o t0 rurxm3iudop nliei sf 2tr(mp;u0tpxnmfctytla2rlnmp;t0tltoxf3oytoa e i i;s0srtrir io4lpenmncsa(farrmum ou4tlen feild a2ulnvs u) rerxrciodfpDr i ils0setoim no1alte fvil() 2tauront1tee mf3iys a2elumsnu)altomfciydom  lu i ()seumxo io1ape mfvtlt) Dum( p;o0oetnmictlsla eanmsnt4aeenmf oy1fpDeliesl()tetr(r oodlle lfvs t) rtmxro;t0aetnii3iatls2rluvp u4alxrmf3oo1fat aieol(  2um(mpou1ol e fetl( a2rmumpnu4oexoio3tatfa ulnvpnu) lenircoy1op rlieo (  euo(opio1amtelicta( s2ur(  nt1oetnmo3tysla eaump t4 ltnif3to1fp elivols)trtmxm iodal nlietat aDurx p;o0oee mfetlsfsDeauvsnt4trxoir3ia1lpDe n i;() etoxm3oudam   fetls)a2taump;o0aptnio3tytls2emu s u)trxrxf3iotfptran i (  rumim3io1lmt mictat)srtr(rpoo0ape ioeilsla2em( ont4arxrir3oatfpt luei s0 etmxr3nudaltnmiesa( sDum(ro;o1apxnmo3iadfaDra(vpnu0 lxomfcoy1fptrlnes;t  2urxo ou4oleelivt (farrrx pot1apt mieiat m uluvp u0 renifciadfa ranesls0 exoxmpoo4lmt mfet s artmx  nu1aleo fciatlaDum(vsnu0 rtomo oatfpte u sl( t2xmxm iodalt lfct (fa2ta(mono4oet mi3iad mDumumpn(0tetrxr io1lmtrli o s setoxo3iudlmenlncsl( aDrax oot1oleo fciytlmDum(vont0tltrxo oo1op e ies;()trxm(opiu4alenmivsat)aDrrxroou0aptniietldfa eauvo;t)texnir tydfa r neols)srtm(o oo1lm  mivi sf rrm(mpou0aptoiictasfm ranvp;t4 exrif3iytlpDrlues t0sexr(r3no1apt  fci tf 2ua( p;t1tet mo3iysfm rlnmpn(0arerio3oadoa  livs t trurxm3oy4lleemfvtlsf 2ur( o;u0tetomfciydfmDuau o u0 lxnxfcoadoaDrauvi s seurxm nu4llenmfcias aDta(rp;u1olxn fctlsfm uanmo;(0trxoif3todoatelnei s texo(r oy1ll nlnvsl() rrrur ;u1oexomieiat sDemn snu0 rxrxr3ty1om   n sl(0teurio oo4al n fctlt) Dua(mpou0texomieildfa2eauvs;u)aexrio3tatop eauvi;()sexrxm oo4apt lneta()sDuaxro;u1ole  fcias s elu s;u4arenmo oadfaDe i i;t sexo(m ny1lltnlnvsltfsDraurp;u4aeeomf3ild a2rauvp;t0 exnir oa1om eluvol(0s2xoio3nydale lfet sf rta(r ;t0oetn iciysls uln o;t4aetrmfciotoaDe u i;s t2tmxm3iudame  nvslsfa2uru p;o4tex mfctadlsDemu o;()trtomr3oydoptelivi;t0 2ur(m3io4amtnlfcsas  Dtr(m ot0tpeomfciytfm2emnms t0trtrxr3iotfpteaieil(  exmirpoydomenlfetltfsDrmxm nu0tpen iciytla2ra(vs;(0aeenxo oytopt lnvo ( t2uo(mpou4amen ies s srumum nt1tpe if3iydla umnmsnt) ltoir3ootlptelneo (0tetr(r3no1ape lici (  Dua( pno4tltomi3tadlm2ranms;()aeenmo oytomDr ivo;( srxmxm3ny1al emiesas)sDtr( o;u1tleoifciad a2rln p (4 rtnmfciytfpDeli o;( srxr(rpiu1lpe mivs ()sDrr(r ;u1oexn oeiys m2elnvon(4alermf oodfm rlnesl( sexm(m iodop nmivsls s2uau o;o4tlenmo3ilt a2emuvs;u)tetnxr3todlp  lneo;t0sruo(r io1apenmies s  Duaxro;u4alxoifciasfa2emn s t0tltrxfcoodlpDe uvs;( srxrxr3oydll n ncsa( aDumxr oo4olenii3ilt s2ea(mp;()trtomociy1fp   nvo;t texrimpno1am  micil(fsrtru ono0tlxoiocilsfaDrau s;(4aleomrctydoat lnvol()sexr(mpoy1lme lfesl(fs2umxrp;u0olxnioeiytla2ea( o;u4tltnxo3iy1opDe ies;t0 exmxr3io1ale  ivt t)aDrr(ronu1oetn f3tltfs2umumpnt4 ltrxf3ia1lm raivolt srxoirpoy1om n fet s  2uaurp;u0aee iociadfm2rauvsnu)texoifcoo1om rai o;s tetoxmpiudale mncsas aDtm(rpnu1aex mi3tld a el(mpn() ltnmrcoodlmte nvo ( srxmio3nu4omt lfct t  Dra(monu0tpt moctyslm raumo ()tltoxr3io1opDran il(0t2xm(opnodlptemfvsatfsDrmxm nu0aexoiicils a rm( on()tlxnxo3ty1omtelieo t0t2ur(opnu1omt livtat s2ta(m ;t4tee iiciyd aDumuvpn()aeeriocoo1fmt auvsls0s2to(opoydole  ici t) rtm( o;u0ape mieiadfs2ra(mp t)arxomrcoa1oa  an i t)texrxm3iu1op nmieils)sDtr(mpot4aex ii3ilsfs2rlump;t4texrmfciytfmDr nvil( s2tr(mpiu4lme lfvta( sruax p;u4opxnii3ild aDua( o t4aeeoif iotlm raivils)srto(mpoydal elieia( sDrr(  ;t4apx mo3ilt s2em( o;u) ltoio iydfp  lu o;() rto(opio1ole lfvi t)srumumont0apeomfeils s2rlump;(4 ltniocoytlm   ues (0texm(o3iu1apenlivtlt arrmu  ;o0tee mi3iat mDemnmp;t0tltnxf3totop   ueo t) rur(r nudll n fesls sruru  ou1oleomf3iytla em(mo;t0aeenxf3totfaDrlneo t0 rtmxo3oy4ll emfes s s2raxro;o4aeeo ictlslmDulu on() lxomo3oadfmtrlies t0s2uoimpno4ol n fei (fsrumu p;o4alx  o3ilsfa emu pnu0alxoif3ia1oa  lieo;t) eumxr oodop emics (f rrm(m no0tlx if3iytla um(vs;u)arxrmf3tatop   ieslt trxr(rpiy1lpee nvsas) Drrump;o0tex mf3iytfaDem( pn(4teeomo3iotfp e n o ()t2xm(r no1ale lfvt t)arrmumpoo0alx  oeiydla eanmsnt)trtrircoodfa eluvo ( texmxo3io1al   ncsls arua( p;u1olxo oeiadla2rm(msnt4trxoir tatoptr nvi t0srtoxrpou4al  mnet () rta(m ou4apenmieiadlsDrln o t)alxrifciotoa   ivols trxm(m3no1lp elnvsas)aDrr( p;o1tpe ifciadla emnvpn(0alerxfcto1fpteaieo t)trtmio3ny1ol nliviatf 2ra(rp;o1oex  fciytlm2uauvo (0 rtomf3oo1lmDeaneilt0 eto(opnodoptnlicias) rrruronu4opeo fciltlm ran s t4arenif3tytlp r ieo ()sexrxrpnudal elicsl(  rtmu pot0olx mfciadla ea( snu0tltoxo oytlpDe ivols0teurir3no4lltemncias sDumxmonu4tpenmietadlm rmn s;t0texoir3io1fmtean slt  rtr(r3nu4ole  iesas) rta(ro;u1tlenifciatfm umnvpnt)artrxf oa1op r u o s)tetrxmpoo1om nlnctas  Drm( ono0aptoifeiltfmDrlnmon(0 etrmr to1omDraues;t  rxm(o iydol nlivsas arrau ono0tpenmieias aDean p;(0alxrxocia1omtrliei;t)t2uo(r3iudoptnlfciasfsrtr(m no4teeomo3iysla2umu snt4 rtrxfciotlpDranes s)setrxm nodlptn fcia(faDrmx pnt0tpxomi3iydls2elnmo t0aeerxo3iotfp rli i;(0srxmirpio1olee ivsat artr(rpnu1olto iciltfm elnmonu)trxomo iodomtean i s0tetmimpiy1lmtemieslsfa2ua(mpnt1olx mictldfm2el(vp t4trerircta1oat anes;()teuoir iy1lm  mics s)a2rmu  ;u1oee miciys m ra( ont)tlxrir3iadlpDean o;s0t2xr(r ny4amt mfcils aDum( o;u0opeoiieias a2rlu p;t0tltrioctatfa  auvo (0t2um(m no4om   icilt) rurumonu0openmf3tydfs eln s (0 lxoir3io1lmDe uvo s0trurxm3iodop  mivias) Drauroot0opx mi3ils aDra(vo;(0trtrmf3oadoa rau ils t2toim3no1ole lfctl(f Dtmxmp;u0teto ocilt m um(mo u)artnmr ia1lpDeauvo;(0trxoxopiydoltn ivt t)sDurxmo;u1altnif3tas m2umnvs u)tlenxf iy1oat  n i;t0srxo(mpiy1om   netat srtrumonu4optomfeiadfa2ea(vsnu)trxnif oy1late nvo;s trxmio ou4lmenlnet (fartm( p;u0tleo ociltfsDuauvont)alxrmrcto1lat anvo;(0s2xm(opnu1aptnlfvtlt) Dtr(r ot0opxnii3iltfsDumn pnt0tetomo to1faD lueo t trxm(o nudal n ictlt)srrrxm ;t0oleoiiciyd s ea(msn()tetrxf3totfpD ai i ( teum(mpiu1omenlncsa( arraxmono4opto oeiydlaDrln s;t4 eenir oatlpD liei;t0 rurxm3oo4ol  mnci (fa2uax ont4apenioetat a2emnmo (0artomr oadomDeln i;t  2toxr3ny4llt mfciat) Drm( oot0tpto i3ias sDul(mpn() eerif3todoa eluvilt trurir3ou1al   ics ( aDumu ont4altnmoctydlm rln s;(0 lxomo iadfm  lnes;s)s2xmim iy1ap nlictl(fs2rmu ooo4tex mi3ild mDemu s;t0alenmr3io1fa e neilt  eurim3iy1llenmieslt srumurp;u1tex  ietatlmDua( s;u0 lerio oytomtrau o;s)srto(m3iy1op   nvta()srua(root0olx mfctld s2rl( p t)tlxrir3oydfaD aivols0teurxr3iodllen fctltf Dtau o;o0teto o3tas m ranms;t0tlxnir iytomDr uei;(0 rtr(opoy4ol elics t)a2uaump;o1aptn f3iysfsDrlu snu0 rtomfcto1lpt liesls0srto(r3oo1amenmfvtltfartm( poo0opxoiieiasls rlu onu0trtoxo tydfmD lneolt0 etmir iydll nmfviltf rtmu  no1ape  iciasfsDel(vs;(0 rxrxrctytfaDrauvi;t0 2xmimpoudlp nmfctasfsrtmum ;t1openmfeiat m2elumo t4 eermfcoatfmtrau s;t sexoxrpoydoltemietlt)a2umurpnt4tpeomieiytfm emuvsnu0 lxrxf iotfpD lnei t0seuoimpiydal  lnvt s a2tmum ;o1opto ieiad aDelnmo;t0arxoxo tydlm eanvo;t  rtmxo oodlmtn fesl(f 2tm(ro;o1tlen oetat mDea( o () rxnif iodomtelues;s s2xmim3oudoptnlnci (fs2rau o;t0oeeomociad a2ra( s;t)aetriocoydla   u ols  eurxr3io1ol nlivia() 2raurp;u0aptnmociltfa ean o;t) eenifcoadfmtrai sl()trxoxo3oy1am elivs (fs2tmx ono1oee mo3ild a ua( o (0tlxomr3iytfpDelu s ( texrimpio4lp nlivs ( aDumu pou0oeeoif3tytlsDrmuvs;t4altrxr3tatoptelivolt) exriopiodamenlfcslsfs2rm(m no4olx ifcils m2rln pnt)tetnmf ootopt auvols) etoirpnudlp elfcsas)aDtrxrpou4oeeoioetytfs ulu o;u) exrmfcoytla raieols0 rxoxo oudlmeelncsls)aDurxm ou1alto o3tad a rlumonu)aexoxociadoatrlues t)trxo(o no1lm emfeiat  rta(r ;u0altnio3ild a um(mont)tlermf3iadfmDean sls)srxoio iy4opee fet s)a2rmuronu1opxnmoctad sDulnvo ()aetrir oy1lmtelu ol()srumxr iu4om  lnviltfa2rrx  ou1aetoio3iys sDul( pnu4arxnmfciy1la   nvs t0s2urio3no1apenmfeil(fa2uax o;o1aexoifeiydls2rmnmsnt4aetomo oy1oatraues s0trurio iy4ap  liet s  rrm(rono0tlt mf3tls m um(vs (4aeenxr3tydlmt  u i s)setoxr3nudol  livslt)sDrmum nt0olxo fetyslm emu pnt) lxrmf3oadfm eli ol( truo(opny4ape mfctl( sDtau poo4olx mfciasfmDemump (0artnxr3oytfmteauvs;()trurxrpoydlpe lfci s arum(  ;o4oeenio3tyt a2uln on() rtnif oa1opDr neolt  2xoxo3no1alt lnvtl()a2uru ooo4apxomi3tasfs ulumsnu) rtrmf3to1fp   nei;t)t2xm(rpio1altemnei (f Draxro;u0oetomf3iat aDrlu sn(4trxnirciotfmDr nvo s  rtoxm3iu4lmenlncta(  2urxront0aexnifeild m2ua( p;u4tlxrmo to1fmtrai o t setoir nydaltemnvsl(f 2tmxmp;u4aex mfciltfm2umnmo t4 leomf tydfateliei;(0texrxrpoodopen neia() 2umxmo;u0tpt mf3iaslmDuaump t4teeoio io1fmD lnvs ()t2xo(rpoy4ale mieilt)sDtru  oo1oeeoioctatfs2rluvp;u4 rxnifciodfpDeauvi s0sexmiopno4lmee iesls) rtr( ont0oeeo feiltla umnmo (4tltoxfcto1lmD  n ols0sruoimpnydameemivia( aDrmxroot4apto o3iys s2rlumpn(4 renxfctatlmte uei;s)trxriopno1lm n ivtl()srtmxrpoo4alt  feiltfaDeau s () rxrxocta1oa raueil()t2trxmpio1lpt miesat)sDrmu p;o0alxnmociatls2umnmonu)artoifcio1op elu i;t)s2xm(m3iudam emnvtl(fa2umu p;u1olxomoeiytfa rm( o;t4trtoir ta1lm   n i (0texmirpou1lp emiciat)artaxrp;t1apx mi3tys m rmuvs;t4 exrio oadoa  lies;t)srumxo oy4ll emnei t  Durxrpou0aexnmfetytfa emn s u0 lxoxr3iotfaD  ivolt0t2urimpnu1lmtnmivtlsfsDrrxmont1tetomo3iysla2rlnms (4treoxo iy1optr ies;(  etoxr no4lpee fciatfa2um(rpno0optomf3iys mDua( p;(0 renir oytfa  aneo t0trum(r iy4omtelfcs tfs2rrxr nu0tee mfciysfm raumonu) rxnioctodfaDr ivo (0t2umio3oo1am elfcsat)arum( p;t1olt  oetadfmDum(ms (4arenmr iotom e i ol( srtr(rpio4ale  ivs (f rtaur nt1apenmi3ildlmDuau p () rxnxo3tydla r ieilt sruo(m iodoptnmivs (farraurpnt0oltnmi3ildfaDrlnvp (0trtriociydfa rai ols0trtoxr iy1om  livtltfsrtmx poo4tet ii3iaslsDrl(ms;()trtniociydla rli sl()s2uo(m3iodal n fetls a2umxr ;u4aet moeildlm2raums;t)areomr3to1fatrlu o t0s2urxmpny1alenmnet tf rtm(mo;o4tlx  ictatfa ul(mp t4artomo3ta1omtraneo;t) ruoimpiu4oltelfct sf 2uaump;u0aex iiciyd sDua( pnu) lxoxf3tatfptrliei;( t2tr(m3nodal emietl( artm(  ;u0oeenifetyslm rluvs;t)alerircio1faDrlivs;s  2trxo iy1lp  lies tfs2urx  nu0ole iictadfs2ua(monu0 rtnir iatlmD ln sls  rxo(rpio1ole  fvtas srtax o;o0aetoiociadla elu s;t4aetoir oydfpDeln s;(0truoxm oo1aptelnvtl(fa2rrx pou4oeto oetlsla ranmo;u)alerif3to1oatraneolt s2um(m3ny1lptemics () rtrxm nu0aex iieiadlsDrlumon(4tetoxr io1fmD lues (0trxoirpoy1lm  lfeia()a2umxmpoo1texnmictldla2uln p (0 exrmo3io1lp elnesls sexr(opnu1al  lnesas s2rmx  ;u1tltomieias sDrluvon(0alxrxocta1faD aneo;s srxoxrpnu1ol   ics t) 2tm(ro;o1alxn i3tys aDeau onu0aetnircta1omDrluesl(0s2uoxo nodam e fcsls)aDurumpoo4altnmoeild a2rm(vs (4trxomr totfm eanei;(0t2xrir iu4amee nci t)srtaxm ou4olt mo3ildlsDea(vs (0trtrir3oytlmDeau i s0srtm(r no1lpte feils srumxrp;u0tleomf3tat m2rmnmpnu0aeeomf3iy1op r uvo;(0srxoxrpnu4lme  fcsa(  2uru pnu0aee  f3tytfaDel(mp u)aeeomr3totfpteauei () euoxr3nydll   fvt s  rrmx oot0texo octatls ul(vs u) etomr tydop rluvs;t) 2ur(opio4lpen neil(f rumxm ;o4tlxo fetlsfm umu s;(4trtrxo iodfp r ivo s trur(opny4llt mict (fsDtauro;u4opeo fetytls ua( o;u0aetomrctydfaDrlnvol(0 2trxm nydal emfcil()sDtru ooo4apxo fctys m2elnmo;()artoirciadlpD lnei ( seumim io1lptn ietas) rraumo;o1oexnioeias s rm(mo (4 etomr3ootomD lnvs s)seumxo iy1aptelfetl()arrr(  ;t0apeomf3tldls rm(ms u0 etoiocta1faD luvo ()trxmxmpiu4lptn ivia(  rrmxm ;u1tee io3iysfa rmnmsn(4trxoir iytomDe uvolt srxoxrpny1ll   fctlt aDraumo;o1apxnmf3tltlm rluvs t) etomrciytfaDran olt)texoxo ny1lmee nvi s)sruaur no1oetnioeiltfa ua(vont4trerxr3tatlat lieo t t2umir3nodomeelfcslt  Dtr(r ;u1tltnmiciltfm2uln pn(4 etniocto1lpDeluvi t0srur(m3iudlptnmfctas)srta(m ot1tltn o3tydlmDumu o t0arenifciatlp   neo;t  exoxr3oo1optnlietltfarum( poo1tpeomfeiltls2rmu on(0artoxr3oodfm r ues s srxo(m nodol n fviasf rumurp;t4tltoif3tysls2rmuvs t)aexomo3oytlat ln o t trum(opoy1lle mivta() rrm(mpnu0aex ioeiys a2emumsn(4trtrif iydoaDrlieol(0 ruo(mpoudamt lfcia()s2ur(mo;o4tlxo f3tytlm2rl(vp u0 eenmfcoa1om  aues;(0t2trxo3iu1omt mict (  ruaxmonu4alxnmiciltlsDelumont) etnxociadfp r nvol()sexrxrpiy1al elfes s)s2tr( o;o1tpeomi3ilsla ea(vpn(4 rtnmrctadlptrlivi () exrir nydom elnvi s)a2rm(  oo4tlen i3iydfsDulnmp (0 ltnmrciotfat  ivslt t2tmim3iu1llt  fetlt a2um(  ;t4opxoifciatfa2ulu s;u0 etrxr3tytoptrlieols  2xrxrpou4omte fei sfartm( oot4aexnmi3tys mDelu s;(0tlxrmrcoadfm raueol(0tetrir iy1ale  fci sfsrurx p;u0apxnioctyd s rlumo;(4 renifcta1faDrlu i s0t2ur(mpiy4lm  livi (fsDtrurp;u1opxo o3tyt m2rauvo;t0 exrxrcty1op  auesl( s2ur(opoo1al   nvtatfa2ur(r nu4aetnio3iytls rl(mp;t) renxf3ootopDrai s;s) 2toxo ny4ale lict ()a2tr(  ;u4tee  feildls2uanvs u4 ltrxocoo1fate n o;s0t2tmxmpiodal nmiviat a2tau pot1olx ifctat s2um(vs;u)altniocia1fmtrai i (0s2tmxopoydlp   fciltfsrrmxm nu4tlx mieiadlmDumuvsnt4 exoif ty1opt ai sl( texoxm io4ol n nvtls) 2ururpot4alto iciad aDua( p;u) etnxf3iytoaD aiei ()s2umxr3oudap n nei sfartrum ;o0apt  ieiad m rlumsn(4arermocoo1fptr uvo;()s2to(r iudop n ici s)a2um(  ou1aet iietydfsDua(mo;t) eerir tatomDelnvsl(0t2to(mpou4ll emfct t) rra(monu1alen octlsfa2ulnvo;u0altrmr oa1oat ln o;s seurxo no4ap   fcs ( srrmu  nt4ope iociaslaDua(vo;(0arenxf3ta1lat aivi ()sexmxo iu1ap nlfvta()sDrmxmpnu1apx mfeilsfmDuanmp t0 rxoif3iytopt ln o t0srumxopiodam nmnei t)aDrmxrpou1tex  i3iatls umuvs t0trenmocta1oaDr nvs s  exoxmpiodlmtnlfesa() rraxro;o0opxnifcilslm rln pnt4teeomf oy1lat  ieo s)setoirpnudlle mnvils a2trump;u1teenmocias sDum( pnt)tlxniociotfaD aiei (0teuo(rpno4amtemivtatf rrru oot4aex mieiyd aDrln s u) rtoxoctatlm raivol( sexoio3nu4lpee fvs sf rurxr nu1ale ifeiadfs2uluvp ()aeenif iodlaD lieilt0 rtrxr3oydapeeliciat)a2rrur nt1ale  o3tasfm2rauvon(0tltoxr iadlaD anes (  rxoio3oy1lmtnmfcs ( arumxmono1optnmieiysla eanmon(4 rxrmr oy1oaDelieo s0seuo(opou4aleelfctat)arrm(mpot1oexnii3iyd m eau snu4texnmf3ia1lmt luvi t0srtr(o3nodlm emfesasfsDum(mooo0apeo f3ilsla2ulumpnu0trtrmr3ootfp raneo;()trxoxr3oo1lp elfvi tfs2raxrp;u4tpt  oetytls2ra( o;t4arenmfciy1oa r n ils setoio nodlpe  nct t)a2umu pnt0alen o3ilsfsDrl( p;t4 reomf3to1fmD  ivo;s) 2uo(r3no1omenmietasf Dum( pot1oltoii3iydfm rlu snu4 leoxr3iatfpD au s;s)trurxmpnudol elnvtatfs2um(  nu0tlxoifciytfm2em( on(0tlerxfcto1om   uvols) rxo(m3oo1lmte fvs s) 2rrur nu0teenmoeilslmDuanvsnu4treomf iy1op raneol(  etm(m3ny1omtnlncsa(f ruaump;u4opt iiciltls rlnvp;t4aleoxo3oytlp e iesl()sexmim3oydoltnmict (  2tr(mo;t0tpenmiciasfa ul( s (4altoxo3oodfp r n s;s)seur(opoy1llte fvtas)aDtrur ;t0apx iieiad m el(ms;() leoxr3oatlatelu slt0t2uoim oo4omt lfeiatfsDta(mpno1tpx ifetytls ra(ms;(4artoircoodoaD lies ()sruoir no1ll  liviat)aruaur nu4tlt  fciadlm2ua( s;t4 rtoxr tatlat au ilt)srtmimpno1ope lnctat)sDumumoou1teto f3tldls2ra(vp u0 lxrxocoodlmt  nei ()tetrxr3iodlmtelncslt) Dra(ro;u4teeo iciadfa2eanvp;u0trtrio oadfaDelneilt0texo(m ou4alen fvsls  Dtm( oou0tpxnmfcildfa rmnvon(0 exnxr ty1lp elu olt s2xoxm oy1ol elfci t) 2ra(moou1oltn oetltlm2em(vp (4aeeoxo3iydopDe neil(0 rxmxo3iy1ome lneslt) 2rr(rp;o4tee  fctld s2rlnvo (4tetnir3tytfa rluvo () 2xm(m3ou1op elnvtls  rumump;u0olt iietldlm2eln p t4 rtrmrctytomte nei s0sexm(opno1lpt mivs tf Durx ooo4oetomf3iytfmDeluvp;t) etnxfctotlm elneo;(0teum(opoo4am emfcsl()aDumx oot0alxnmi3tltfm2ea( o t4 etoxocoodomtranei;s t2tmxr3nydop elicia(  Dra(  ;o0oleomociyslm ra(vo;(4trxomocoa1fpD  nvs;s s2tr(mpoo1am elnciltf rrau o;t1apxn ociadfmDem(vo;(4 exoiociadlp eanvs;(0 2uo(o iu4om  mieias  2trumono4ape ioctytfmDra( o (0altriocoydfat lueols  2xrxmpny4apte nvtl( s2rr(m oo4tpxoifciyt a2umnvo;() ltnxr3oo1lat luvsls  rum(m ny1omt  feiasfaDurum ;t4alto ieias s2ra(vp ()tlermr3oa1fat lu s t  exm(opiy1ap n fcsat) rtmxroou1aexoiictyslaDrlnvp u4trxnxf3iadla   uvs s0 euoxo3iu4omtemnci ( aDtm(ronu1alt if3ias a umu s t0areomfctatlatelieol()trto(m ny4op nmfcs () 2trurpno4teeo ociasla2ranvpnu)trxnir tydfptr ies t  rtr(rpoo1optemfetlt)a2rrur ;u1aeen f3tld sDumnvo t0areoir3iadlm rlu ilt srxm(o io1al elneta(f 2tm( ono4apxnmi3tltfa2umuvp t4arxoxfcoadopD auvsl( trum(r ny4amenlfeta(fs2rm(ro;t0tpe  ocilsfa eanmsnu4alxoirciotfmDr i s;(0texm(opoy1lp  mneil()s2rau  ou1aptniietysfsDeluvsnt0trtoxocootfaDr iei;t)seur(m3iodam nlieia(f rurxrpoo0tetoiicildfm2rmu o t4 rtrxrctadla eaies (0 2tm(r iy1alenlfei ()s2trumpnt4tpenmfciydlaDulumo;u4trtoxo totom eli o;s trxoirpou4ap emncia()a2taumpoo1optoioeildfsDeau o;u)aeenmf3tadom  lu o;s0 rtmxr3oudll n fciatfsrumx  nt0tpe iietlsfa2raums;() lxrxr3iy1lmDe n o;s trto(m3oydal  miesls s2ra(  oo1alt  i3iatfaDeln s t0aleoxo ia1faDrlneo ()s2umiopny1aptemnei ()sDtr(mo;t1texnioetytfaDem( pn(0 rxnio oytfptelu s (  2trim3oydopte ivtat)aDtaxro;o0tleo i3tat m2elu p (4tetoiocta1fpD aieo s0 rur(mpny4ole mnctls)s2uax pnt0oltoiicild mDumuvs (4tetnif3ia1optran s;t trto(m3ny4lltemncil(  Dtau o;u0tlt ii3iltfs uauvon(4aexoxr to1lat lues s teuoirpiy1al e fcslt  rrmxmp;u1alxoifeiadlaDuln p t0arxomf3to1opDraieo;(0 2xmxm3oodoptelicsasfa2tax  ;o0tleo oeiytls emnvpn() rxnif3tydfpDrluvol()s2xrxo3oo4olenmneias srrau o;o1optnmf3tyt a umnvp;u)trxnmf oa1lp eanvi t trur(r no1lptnmnes (fs2trum ;t1oeeomfcils m eluvs;t)teeoif iytfmte ieo () etrxo3nodome  nei sfarrm(monu0alto ictysfmDul(vs;u)aeeoxo iytom rauvo;t0 eurio3oy1lptemfvia(f 2ra(  nu4ole  ieildfaDel(mpn(0 ltrxf oo1omDe neo t t2trim3nudap n fei (  Dtmxrpou0aexn f3tytlm2rau o;u)aeeoir3iadlm raiei;t)srtr(r oodalt mncils)aDtmxmpnu1tet iieilslm em( pnu4areomocoydlp  li o (0 2to(r3iu1alte fcil() 2trx  ;u1tlxnifetysfm2ea(vp;u4trermfcty1opt  neil(0t2um(opiu1ll   ivtls  2trxm ;t4apxnmi3iatfaDem(vonu)trxnir iy1omDelneo s0teuo(o ou1op emfes ( arumur nu0teeomo3tyd mDran on(4alenmr oytlmDeanes t) rum(o3oodopt mfeilt) 2tax p;o0aleoiieiasfs2ra(von()trerir oodfatrln o;s)srurxrpoy1am e ncta(fsDraxm ;o0oeen fciatfm2ua(msnu4trenxf oatlp ean i;()t2trxmpoudlp n iesltfsDraxrpnu0aleo f3tatfsDrmu s;t0 lermf oatfmtr ivo;s tetmio3oydop  lieia(  2ua(mo;u1tpxo o3iydfmDem( o (4arenio oytomt  ueo s) rxrxo oo1omee neilsfa2rr(mono4aexo iciydlsDra(msn(0 ltoio3tatopDrln ils)texo(r3oydalt  nvt (f rururpno4altoifctlsfaDumnmon()tltoifcoo1late nvi (0seumir io1lle lfeia()sDumxm nu4ale miciatfsDel( pn(4aleoio3iotlpteau olt trtrio3iy1apeelncsltfsDtr(rpnu0ope mo3tlslm em(monu0 rtomrcoatlpt  uei;t s2xoio nudllt  fvsls)artr(r ;t1tetnio3tad mDelnmonu4tlxomrcia1fpDr i olt0srxmxm3iydlm n nes tfsrrax  ot1tex moctad s2umnvp u0arerif totfmt lnvi;s)t2urio3oo1lp  mivs (faDuaxrooo1alt iiciadls rmnmp t)altoxr oodlptrlnvo t t2xrim ny1llt lfeiltfsDtax  no0opeo f3ias s2em(ms;t0 eerxrciodoaDeai s ( s2tmiopio1lmt lnvs t)aDtmxrpot4tptnii3taslm2umumont0 rerir oatfat  i i () rtmir oudam e ict s artm(m oo1apx mfeiysfs emnmp;t) exriocto1lm eaivi;() etmxopiy4apte iesls)aDrm( pno0tleomociltfm2umums u0aexnifcia1lpD auvils) 2xrio ny1omtelfctltfarra(  ;t4tee mf3ilsla rlnmo;u0altoiociotfptelivi;t) rxrxm iu4amenlivilt)a2uaxmpno1opeoio3tld a2emu pnu4tleoio3ootlmt au slt srtrio no1apeelivtat  2rrxmo;t0olt mictat a uauvp ()trtnxf ty1oa r i olt texo(o oo1lmee fviatf Dua(  ;t0oexomicils mDean s;u)teenxfctodfp e neils) rxo(r3ou4ome mfetlsfsDurumo;o1apenmictydfa rl(mo;u4 rerxrctodlp rau ols srxmxr oo1am   nvsas  2tmxr nt4olenii3taslaDrau s;t0arxrxrcoadoatrluvs;s t2xrirpoo1apt lnci s) 2rau o;u0tpx  iciydlsDrl( pnu)alxoio iadlat  ivo (0tetr(m ou4llte fctls)sDurx ont1apt if3iatfmDulumsnu)teeomr3iatomtraivi t texoxm3nu1am elnei s)s2tmumont4oleoiociyd m2elump;u4 eenxfcio1fa rluei;s texoxopnu4openlivilt artax  ;u4alt mociyslaDum(vsnu0aleoxf ta1lateln sls)srtr(rpoy4apee fct s) rurx  ;o4alenifeiydlmDrmnvo t0texoxocio1op eauvilt0 rtmxm io1oltnlivsatfsDum(rpot1tetniicilslm ra(vs t4tlxoio oy1faD  nei;(0 2tr(o oy4amtelnci (faDrmxr ou1oexnioctyd mDrl( snt4aexoir ia1lpDe i sls  rxo(m3oo4apee nvils  2rmx p;o4tlen o3iyd a ranvsnt0trtomf iy1fa  anvilt0trxrxmpnydol  livsas srrrur ou1tpeomiciaslm rl(msnu0aetnxr iodoa  lnvsls)srtrio3iudameemneil( aDrrum nu1apt mieiyslsDul(ms u4 eermocio1oat  i ol(0seumxrpou4om emneiat)aDtrxmo;o0opx  i3iadfs2rl(vp t0 ltrif3ta1lmD ai sls)texrxo oy4lp  mfvtasfs2urxmonu4oee mieild mDrmumpnu4 reoio tytfpteaueo s)srtoxmpio4olenmnesl( srtmu  nt0apx  f3ilt m ea(vonu0artrmo3iadfmte ieslt0 rxo(o ou4am nmnvtlsfa2tax p;u4optn iciydfa2emu snt0altnxf3iotlmD lnvi ()t2xoxm nu1lleemiesl( srrrum ou1altoifeildlm uanmo () lxoio3todoptrai i;t) 2xmio iu4al   fcs sfa2tax  ou1texnmf3tadfa2uauvo ()treomf3tatlat ai s;t) rtoxm io1am emieils  rumurpnt0tpeo i3iysls rmuvsn(4tleoir3oo1fpt auvolt s2ur(r nu1lle  fesa(f Dururpoo0ale  iciatfs rmu o t0 rxnmo to1lmD aueslt0truo(o no1amee neils  2tax o;u1olenmociydls elnmp;(0aexnmr3todfpD au i;s) eumimpoo1omenlnvtas  Dta(r ;t4alxomfeildfm2em(ms t)texrmoctodomDrlueo () 2umir3no1am  lnet t artr(m ou1alto ietysfm um(msnu0aeenir iatlm  ln ilt0 2toxmpny4ll nlivil()aDumxr no1oex ii3iatfsDemu s;t4aexoxr iadlmDelies ( s2to(r3oodlptelfvilt  Durur ou4openmfeiltfsDul( p;t)trtrmrcoydfat ln sl(0 rum(r3oodopen ict s aDrm(mono4opt miciltlm2umnvs t0tetnif3oadomDeaiesl( t2tmxo iydopenmicsltfarur(mo;u4aeen oeiatlmDumnmp u)tetnio3oy1faD  u s;s)srtrim3oy4lmee fvsasfsrumxmo;o1olt  i3ilt mDumn o;t4areniocto1fmteauvilt sruoxo no1ole livi sf 2rm( oou4opt io3taslsDrauvpn(0altnmrctotlp e uvi ( srtoxr oy4ameemicia(f Dumxr nu4ape mf3iydfm2emnmo;t4tetoxocty1op  auvsl(0srtrir nudameemnci s)a2rru oou4tex  i3iat mDel( s ()trxnxr3iodomDeanei ( t2xr(r3oydal nmnci (fsDumu  oo4tlt if3iysfa2umuvs u4artnio3oytlpDrlivs;s teuoxr3nu1opee nvt ( arumum nu0tle mietls a em( o;(0tetnif oy1oa raieo;s  rurir io4ol  livils sDrmx poo1alen fcildfaDrmu s;t) ltnmoctotlp rauvs s) rum(r ny1opeemfvi (faDraumpnt1tpxomi3ilsfa emnvo (4 exrxocty1lm ranvs;s)teuoir3iudomt lnctat sDurx  ;o1olto fctat aDuluvo;t) etrmf oodoa e u i t0t2xrim3oo1lmt lfctl()a2urur nu1tltnmi3iat sDea( p t4aetomf ootfmDrlnvsls0texo(opou4openmfcia( s2ua(m ot4teeoifeiat m2ra( snt)aeerio3iydomD luvi ( srxoxm3iu4lpe  fet () rrmxr nu4oexomf3tldfmDuln sn()alxomf3tytoate neo s0sexrio oudom elicsl(  2rmu pnt1olx ifeils s umnvo;t) lxnxo3iydfm raiei;t) rtoir oy4om nmfcs tfarrmurpnu1tpxnmoctasfs2umnvsnu4tlxoxo3ty1la   nvs;t0trxoxm no1lmee ivtls)sDrmxr nu1aet ifeiasla ra( snt4arxoxo3iydlatrai olt texr(mpoo4lm   fesa() rurx  ;o0oee iociyslaDuau pnu0arxnif3oytfp eaivil( trumxr ny4ol e fciasfsrrrxrpou1tee moeiltla2emuvs;t)trtr
\ No newline at end of file
@@ -0,0 +1 @@
+u o;s)s2xmir nu1om   fctas s2rmuro;o1opto i3iatlaDuaums u0tlerxf3iatoat lnvol(  eum(opiudamt  fctlt)srrax oou1texo ieilsfmDrlnmp;u)tetrmocto1lpD aivi (0tetrir oo1opt  fviasfsDurx  oo4tptnii3tltlm ulnvp;(4artrmr3iatoat ai i t0s2umxopiy4lptn fci s s2trxrp;o1opeoifctldlmDel(vs t4 rxoioctotfaDelnvo t0texrxo iu1lptemivs t arum(m ;o0tlenifctydlsDua(vo t)trxoxo3oodfp e uvil() exo(m io1optnlieias) Dtrum ou1optn iciatfm emump t4aeeomo3tydoateaivo (0s2uoir3nudlmte ivsa( aDtaumoou4aexn o3ilslm2rl(vp;u0trtnir3io1fmDr u i;s teumxrpiydom  lfvslt)s2tru pnu0tpxniicils m rmuvon(0aetomf oytlpt  u sls0sruriopno1omtn icils arum( ono4alxnioeiyt aDua(von(4tlenxfcoodom  anvsls)t2tr(r3iydlptemnetlt aruaxronu0tpxnmi3tytlm rm(vs () lerio oydop   i ol( trurxr3nu4alt mnvs t srtaum ;t1alxn o3iat aDemuvont0 lxrmo3iodopDrlivsl(0texoxopoo1om e fesa()arumumoou0altnmfeiatfaDea(mpnu) eerxr3oa1la elieil(0sexm(opoydoptnmneta(  ruau ooo1apeomictyt s rl( pnt4 lxoxo ootfp raivols0 exmirpnu4lptnmfvtas sDuru pou4tlen iciasfm rlnmsnt0tetnif oytfaDelu o t0 etmim3ou4opeelivils)s2rmump;u4aee iociysfa rln onu4tltomo oo1lptrlnvolt0s2xrxm iudllt micias s2taur ;u0aexoiiciad sDrmnms u0trxrmr3ia1opDeluvo t0seurxr3io4llenmfctasfs2uaxmp;t4teenmo3ilsla eluvp;(0 ltomf3tytoat  neolt s2toio nu1omt miesas  2tax pnu1altnif3ildlm rmnvp u0 rtrxo ootfate uvol()t2xoio3oy4omt  ictl(farrmu  ;o4apt if3tyd m rmuvsn(4trxomf oa1fa raivs ()t2ur(opoy1lmt licsas) rtrxmpnu1open fciydfa ulumo u4 lxnir todlpteaivs;( teumxm3nydlm  liei (faDrmurpoo4tptomoeiltfs emuvs (4tetoxo tadla eaivi;t0 eto(o3nu4ap  mics ( arrr(r nt4ope iieias a2elu s u4aexoif iodlpDe nvs;(0s2ur(o3io1ap e fvtas)a2tru ono4aptniociasfa2raumo u4aetnmrcoa1la eau o t0trxrxrpiodoltnlnvsl(  rua(root4openmo3iysfa2ua(mo ()texomfciotoptranvs (0srtrir3iudame lfcslsfaruax oou4oltniictldfs ra( snt4aleomr3oodlm rai i;()setmxm iydlmtnmfciasfarra( onu1olx mfeils mDrmn pnu0tltoxf3oytfa eauvils0s2urxrpnodllee nviat)aDraxr nt4aleoif3iyslaDrmuvp;t4 lenxo3to1lp rlnes;t0t2xm(m3oo4opte fviasfa2tmum ;u0oltnii3tldlsDem( snu) ltrif3tydlmtrauei t  2xrirpiudlpe  fetl(  Drr(mpno0tpe  o3iatlm2ea(mp u) rxrmociy1lm  au s t)t2xoxr3iodaleelnesa(  2rau onu4oet ifciasfm rlu snt4 rtrxfcta1oa rau i;(  rxoirpoodll emfes tfs2tm(m ou0aptnif3iyt m uauvp u4 ltnmf3oo1oa  aieo t)s2xoxr oy4olte fvsltfartmxro;u4aexoif3ilsfsDrmumont)texrmrciatfptrauei ()teumxrpou1ole lfei (  2ua(  nt1opx  ieiad s2elnvs;u4teenmfcoydfatraneol(  2xmirpoy1om   fvsa() 2rr(  ;o0tpt  o3tatfs el(vs t4tetrirciotoptelneo;s trxrxr3nydom n fvtatfaDrr( ooo4teto oeilsfm eanvsn(0aexomfctodla rlu s s)seumio3oy4ap e fei t) Drmu  ;u1apxoii3tyd a2rlnvs;(0tleomf tadoatr uesl(  rxoxm oudapenlivsat srrr( pot1tltomf3tyd a2rlnmont0 renif ia1fm eauei;s0 2um(r3iydlm e nvia()sDtaxrp;t1tpxnmfeiat sDrau p;(4arxnxf tadop elieo s0t2toxmpnydapt  fcias) Dumxm oo0tlxn feias aDua(vs;(0 eenif3totfpDe ivils trxmxo oudomt  neta( a2raum ;o1oeenmfctlt a2ea(monu) lxrmr3ia1lmteanes;t sexoxo3iodap emics ( arta(rp;o4tltnmieilslm2eluvsnu) etrmo3ia1faDr ieo;t) eurim ny4llee feslsf rtmumpot0aexnio3iytfs uau s u0 eenxr3oo1laDean s;s  rxrir3ny4lp nmfeslsfsrra(mpoo4opxn feiydls2uaump;u4tlxrxr iy1opt  ieols0 exmxopnudol eliciasf 2tmu  ;u1oee  ieiadfsDel( o t)trtomo3iatfate i s (  ruoiopiu1apenlnvsat) 2uaxrp;o4texnmoctad mDul(ms;u4trxrmocoydfatrau sls)s2xr(m ou1ame lneils artmx pno0aex mo3tydlsDeau o;t) lxrmo tadlmD  ivs;( trxmio3io1lltemfetas  Dumuro;u0tltoii3ildfm rm( o t4 rtoxf3oy1oaD lieo () 2xoxo3ou1lpeelfesl()s2ra(  ;t4tltnio3iys m rmumsnu4arxoif3ia1om eli ils)t2urio3ny4open nviasfartaxmoou1altn ociatls emnmsn()tltnmrciytomt lieo;s)setrxm no1lme mfvi () rurx  ot1aeenmietytfs2em( pnu4aexnircoodfmDeliei;()trurxo io4al  lies ()aDtmu o;u1aetnmietls m uaumo;(0areoxrciodlaD ai i t0srtmxmpno4am n ietatfa2rm(m oo4alen ieiytfa2umnvonu4altomr totfate uvslt s2xr(m3iy1ole lfeiatfs2trx pou0oleomiciysfa elnmo ()tetoir3totopDrliesl(  2uo(rpio1al  lics s sDrrur oo4oeenio3tysfm rlu o;t0aeenmfciydfaDraiei t0trtr(opio4alenmfcsa()artrxr ;o1alt  f3tytfs ra( p;u0 ltoir3ootomtrau i;s)trxmirpno1ape  ivsls  rururp;u0tpt  iciaslm2ra(von()aexoxfctadfm rln o t texrio3no1lmtnlnviat)arraxro;u4oltnii3tat s2ulnmo;u4artrxf3ta1om  anvs;(  2xm(r nu1lpe  ivslt s2trxmo;u0tptnmo3iydls2rm(mo () renir3iotoateln sls0sexo(rpoudop  livi t) 2taumpoo1oltnifctasfm2el( ont) etnxr3ta1fa rlu o ( trxrimpiu1llenlnei sfsDurx o;u4tlenmiciasfa eauvo;t0 etoir ia1fa  au s s truo(o3oudalt mivtasf 2tmum nt4oex iietasls eln s t)artoif iotoaD  u i t)sexo(r3ny1omeelfet t a2tau  ;t4oltnmoetltlm2eanmo;t) etrxr iotom rlu sl(0 2xo(o3no4ap nlnvtatfarur(rpou0tlto oeiytfmDrmnvsn(4 lxrir3ta1opDe uvslt0texoiopnu4lpeelict ( sDtm(mpnu1aex  o3iltla2ua( ont0trxrxocta1lmD  u o s t2toim3ou1llen fesas sDtmxmono4oltnmietldlm2rm( onu0tltnxrcoytfmtranvs;()s2umiopiudap  mfvt ( aruauro;o0altnifciltfm2umump;()tlerio iodoa   nei;(0setrxr3ny1omeemfcil( arururp;u1oexomoeiadfsDel( s (4trtnmf3iotfpD aivs (0 2xrxo3iudlm  lfcsasfsDuru pot1alenioeiltls2rm(mpn(0tltrxf ta1faDe ieol(0 etm(o3iodop n fvilt  Dumuront4tlxo ociaslmDrm(vpn(0aeerxociatfmD lu s;( tetr(rpiy1om elfes t)s2raum nt1opxn oeiatlsDeanvs (4tetoxo3ootoa eli sl(0sruoxr3oy4ap e ictl(fsDtr(mont4altnmi3tydfs eau p;u4aetomocta1opDr ues s  eum(o3iy1ll   netltfartm( pno1tpeomfcildfa2rmn o;u) leomo3oa1fm r uei;s  rtm(rpoydomeelnes t)sDuaxroot1tpx mictas mDum( s;(0trtoifcty1opte u ol( trum(m iodom elfetas) 2ur( onu0tptnmfetlt mDua(vpn(0 reomo3iytom r uvsls0 2um(r oudome  fci sfaDuaumpnu1altnmfcilt a2eau o (4aetnio3io1fm  aneo;t s2xrxr iydop nmfesa() 2tru pou1oex moeildfa2rmu o u0arxrxo oa1opt anei;s0srxmio3nu4omenlfcsasfaDum( pot1opt io3tadla rmn s u4altrmrciy1omDr n i;s)sruo(r iodopee fvs (  rrruro;u0aetn ieilslaDel(vp t)trtomr3todoa rln slt teur(r nu4ame micsas) Drmu ont0alx  iciasfsDum(mp u)texnio3ootfptrau i () rumim iy1apee nctlsf rurxr ;u1optomf3ilslmDel(msnu4alerxrcoo1opDeluvi;()s2to(o ou1altnlnvtl(fs2tax  ;o0altniieiatls2el(mo;() ltrmrciadfmtrlues (0t2uo(o3nodapenlicsasfarrmxm no1oet  iciysfs2ul(vpn()arenif iodom r uvi;t  2toxm3oodlp n iei t)srumxrpoo1ape  ociatfs2umu s;u4tetrxociadfmte i s;(0 2tmxr ny1ol nmivil(fartax p;t1tpe miciltfsDemn onu4 lxrmf iodlmDeanesls) euoxmpnydapen icslt)s2rrxr nt1oex mfeiys s ul(vp (4 reomfcoy1oa  auesl()sexoxr nu1aptnmiesl( sDrrum ;o1tet mfciadlm eln o () eeoxr3oatfmt anvi;( texo(r3oo1omte fcsa(fa2taxmpno1tlx iociysfa2umnms t0trtrio tatlm rlivs;s) 2umirpnu4alte feilt) rtmxmp;o0alx  fcilsfs um(mo;(0treomr3tytfpDe ivi;t) rur(rpny4om e icta(  Dumxr ;t0olxnmoetysls eanvsnt)tltrio3ia1omtr i s;() ruoxm3iu4lltemfetl( arrrx  nu1tlt  ocilt sDeau o;(0 exrmf3iatlatr ueolt  2xriopnu1aptn fct (faDrru onu4opt  fciytlsDem(mp u4 lermo oa1lm  lieils srtoxo nu1lmtnlicsatfa2ur(r ot4alx ioetyt m2ea(vs;t0trtnxo oodoaD  n ol(0s2tmxr3iodll emfci s)sDuaum nu1olto o3iltlaDumnmsn(4tleoifcta1fpDrauvo (0t2xoxopio1omt mfvsa(fs2raxrpot0oltoio3ilt m2emnvp ()alenxo3ta1lm e u i;s) etm(r oy4omt lnetls  2rrx pnu0oexoioetat mDum(vont0alxoxo3oodop r i o;s  rumirpnu1om  lnet (fsrtm(mpnt4opt iociltfm elumo ()alxrmocto1fm  anvo t t2xrim3nodop   fvs t aDum( pot0openmicilt m eau p t)trerio iodopDeai i s0srumxr3no1al   iesl()aDur( p;o4oleomi3tatfs elu snt0teermr oadomt ln s ( t2tmim ou4ll emiet ()a2umxr ot0oet  fciysfm ran snu0 lxrmr3io1lp ean o t)s2um(r3io1apt mivsat)s2ra(rpnt0alxnmi3tysls2ul( o t0 ltnir iydoaDelueo (  eur(r3nudamtnlictas)sDtrur ;o1oeto fciadfsDrau s u0tlxnxocoytom r nvo;t)t2uo(m3oy1ole lnvsltfartax ont0tleomoeiyt a2umuvpnu)texnxr oytlaDrlivil(  eumxr3iu1ap  mfctas) rua(mooo1tet mo3ilslaDrmuvpn(4trtrxr3oa1lm r n s t s2urim3oy4lmte nvt ()aDta(ro;o0oeto ieilt a2um(msn(0tltoioctotlmDelnvo (0s2tmxr ny4aleemieil(faDurxmpnu0oee mi3tytfsDea(mp ()teenmf iytop   uvil()s2uoimpoodam  lfvt ()sDurx  no1apeoiictyt s elnvp (0 lxoiociydom eaivslt0tetrim3iu1op nmici s)srraxmo;o1optn f3tysfa um( p;()aetrxr3totomDrlueo s0 exoxopnu1al nlfesltfartrxm ;t0tex mocild aDua( s (0texoircoy1lpD auvi;( t2tm(m3io4lmte iet s arur(  ou1tetoii3iltfm2rl( pnt0arxoxr oodlp rai s;s0 ruoim3io4ole  fct t sDrmx ooo4apt  ieild m2em(mo;(0tlerxr tydfm elieol() ruoxm ny1om nlfes t)aDtaxmpou4tptnii3iyt aDemumo;t4arenxf3tadomtelivil( sexm(o oo4al  mictat arrrx pno0aexo fctltfa el(vs (0 exnxo3todopDelnvs ()s2xmxrpiudopt mivsa()a2umxmp;u0optnmfeilslm ulumsn(4tetoio3oadoa  anvi;( s2trxr iu1lptnlfcslt aDrm( ont4aeeoiietydla2el( s t)aeeoxo3tadlmte u o s)tetoxo3ou4am nlfei ( s2ururo;o1aetnii3ilt a rlu p;t0treomo3tydlmt  uvi;s)s2tmxrpoodlpt  ics t s2uaxroot4olxomocilslmDem(msnt0trtoif3tadfpD  iei;s)s2xm(rpno1lm  lnctl(  rraump;t1tlto i3tltla2ul( snt4 eenmrcoytlp  aieils0 2umxm oy1op e feias  Dtr(mpnu0openii3tas m ea( ont)tlxoxo tydomtr uvs ( t2urirpiydome mici t srum(m oo4tpt io3iytfm uanvo;()trxrxf3totlmtr nvo;s  2toxm iudamtnlnetl(farua(mono0optnioeildfmDuau pnu4teenxf3oatop raneil()teur(o3ou1lpe mfetl(fsruax oou0aetoioeiys s rln s;(0altrxrcto1om rlnvo t0 exrir ou1apte fvil(fsDra( pot0oleo fctlsla2rmums;()trerir ty1oaDe ivsls0teumxrpou1lpeemicil( srtaump;u1altn oeias aDraump (4areoxo oadlaD auvsls)t2xmxo3oo4lm  mfvtl()aDraxrooo0teeoifeiat a2ulu p;u) rtrmf ty1lm raivsl()t2urim3nydlp e fvi s)aDumu pou4tltoiiciadlm ulnmo;() rxrxo tydoa r n s s0sexoxo io4am   iviltfsrtmu ont0apt mieildfa elnvo t0aeenxo3oydoa elu o;(0 exrio3nudolte fesa()srumu p;u4oeenmoctaslaDea(vs;t4aleomo3iy1la  lu o t0sruoim io4ole  icsas) Draur ;u4optnif3tltla2elnvsn(4tleoxfctodoa e uei;s0 rtmxm3iodlmt lfctl( aDtru o;t4altnii3tas m2em(vo;t0alxomo3ootfpD li o (0trtmim io4lptnlieta(  2urur nt4oetn i3iatfm rauvpnt4 rtnxfcoodlmtelieils  2ur(r3iu4op n icil( a2rmu  nt0tltnifetysfa2rmnvs u0 reomf oo1opDeluvi (0s2xr(rpno1lme lncsat sDur( ooo0apxo o3tytla2ea(ms u0aeenxo3iodfatrlueolt0sexmim3iodom elnciasfa2ra(r ;u4tetniociytlm elnvp;t4aeenmr3tytfpD lues;s)s2tr(o oo1optemics s  Drmx  nt0alen oeild aDeauvp u4 rermr iotoaD li i;s setrxm3ny4opeelietas) Dta(m oo0tet iieiydlaDumu o;(4altnifcoadlp eai s ( seumxopiy1omenlnes tf 2rmxmpno0tetnmf3iltfm el( o;(0aexnifciatlpDr ivolt)s2urio3iydamt  ictas)aDrrxmo;u1tetoiieiytlaDrluvs u4 etnxf iydla eliei (  exo(r no4aleemneslt s2rm( pnt1tlt mociat a umumpnu0 lerir3tatfmt  u o;s) eum(mpiudape mfeilt  rtm( p;o1tleomieilsla umuvo;u0tlxoxf iotfateaivi t0trxoirpoodom nlicsl()arrr(mpnt0tex  ieilsfm ra( p u4treoxr3tadoateanvils0 eumir nu4ale licsasf Duaur ;t4oex mfctytfa emnms ()tltnmf oatlmD li ols) rxrxm3nydapt mieilt)s2ur(mpot0ale ii3ildfm ranvo;t0alxnmo3tytoat livi t0s2xriopiu4am  mncil( s2taxr no4olxo o3tyd aDul(vpnt0arxoxo oadfm eliei t0t2xrim oudlmtnmnvtlt  2tm(rpou0ole ioctadls2ul(mo u)trtnir ta1lp rlnvs;()setoxr ny1lle  icsls) 2ra(mooo4apxnmietydlm elnvsnt4 eeomo iytfaDrai il(0trtoxm iodal elieil(faDumurpoo0apen i3tldls2ran s;u0tltnmrciatoaD ln s;t  exmxr oo1am elicsa( arua(rooo1alxnmoetldfs2ua( p t0aetnio3totla eanei () 2uo(m3ny4ole mivslsfsruaxmp;o4altomfctat m emumo;t)arenio tydlmD lnes t srxoio3oy4ale  net tfaDurum ou4ole  o3ias aDum(mp (0aetomoctydlat aues;t  eto(o nydaleemncsas) rur(r no0tltoifetlt m2umuvont) rtrmo iytlp  li i s0trtr(mpnu1lptn nct ()s2tm(monu1opeoif3ilsls2el(mp;(0trenxr oadopteaivo;t  2urxo3no1oltelieilt  Dtr( p;o0oet  ociltfm uluvo;u0trxomo tytlateliesl() etoim iy1aleelnetatfaDra(mpnu0apx if3iyt s2uanmo t0 rtrmo3tadomDrlueo;()teumxm iy1opeemnvslsfsDrax  ot0oltnioctadla emn p;t)altniocio1fmte ivils)tetoxr3oudol   ivslt)s2trx ono4oexo o3iydlm2rau p;(0 rermf io1fmt lu s s0 2xoim oy1ope mfvs sfaDua( pnt4tpenio3tlt m em(vo;(0tltnxo3iotfpD lu i;s trur(mpiudal   nci sfa2uru  nu0aetniociytla2umums;t)tltrmr oodoa  aivilt) rxo(rpnodameelfcs tfa2rmxr no4tet io3iat aDumnms u)arenxo3ty1lpD auei s)tetoir ny1al elfeslt) 2taur nt0apxo iciysla umnvon(4 reoxo oa1lp e ueo ( teto(r oy1lp emicil()sDtm( pnu4opt  ieiys a2rm(vs;t0aexrmrcta1fpt  uvo;t  2xmxo iodlltnmfctls) 2rrum oo4teen ociysfaDeluvsnt0treoxfctatoaDeanes s s2toxr3io4lle mnvtat aDrmumo;o4oexnifciatfs2rmn pnt0trerio3oytfptr n i;s)s2trxrpoo1amtelicsat) Drrxr oo0aptoio3iytfmDraumsnt4teeoxocoatoaD  iesls0 exoim io4om e net tfarur( ono4aexo ociysfaDua( p t)arxoif ootlmte i sls)sexoxmpiydape  ivtat srumxm ;o1ale  fciaslsDulu s (4teenmf3iatlm elivs;s trtmxrpoy4al   fvsls s2tm(  ;o1tleomf3iydlmDeau s;t) lxoxo3iadopD  u s s  rurxopnu4lptn ics sfarua( pot1aptnio3iyslmDua(vp;t0 eeoxr oodlm  lu i s0teuoxr ny1omt  ies sfa2umxmonu4aptnmociatla2rmums;(0tlxnmr3iatfmD  i o;t)t2trio oydlltn nvtl() rrrur ot1oetoio3tas a2uan onu0 exnmfcoa1fmD aueo () exoio3oo4lp nlncsat) Duau o;t1apt ifetlt a2umumsn(4aetrmr3iadfm eai s t)t2xm(m iu1aptemiei t arumumpou1openmf3iys m el(ms;(0alxomfctytoatranei;s)srxo(m no1omtn nes s  Draumooo1apt  oeiytlaDeanmp;(0tlxoiocoatfpDr n i;t)s2to(m3iu1lmt  fct s)a2raumpnt0oleo o3iatls ul( o (0teenio3io1lm eli sls0 exmiopoydoltnlfetls)arurxro;u0ope mfctadla2umu s;t4trxrxf iotfpDr nei t0trtrimpio1aptn nctat)a2umumooo4aptn o3iydls uauvo u0 etrif tadlmDeaneslt) eur(r io1omeelfeils  2uau p;t0open o3ils m2rau s t) renif oatoatr u sls0trxoxr no4lltnmnesas)aruaumo;u0apeoifcias s ranmo;t0texoir3iotfaDeluvs t) 2trxm nudlptemneslt)aDumx pot4olxnmociydlm emu pnt0altoirciytopDrauvi;t0 etrirpoy4op emici (farum(mpnu1tpenif3tysls2ulnvsnt0teerioctadopt  ivol()teumir oy1al  mneiatfa2trurp;t0alx iictyt sDranvsnu0 rerio ia1oat  ies;s)s2uriopno4lltn ivs t) Dum(r nu4aexoiociadfm rm( s;(0aetriociytlmDelueo t) 2xrxr iy4al  miei () Dra(  oo0oexn f3iltfs2uau onu)alerif3ia1omDr ueols)s2urxm3oudome liviltf Dtru pno0tpxnmietysla eluvo;u)tltrmr3oadfmDeauvs ( srxoxr iudomeemnvs t)aDrrx oou1teto f3iytla ran p;u4arerir3ta1latraieo s)s2ur(o oy4lpe lfct sfaDua( pot0aetn octls a2eanms;t4trxomf3oa1fptrau o ( trumim ou4lm nmnvsas) rurx oot4aeenifctyd s2ranmpn()aexnir3ia1fat  ieolt  2tmimpoo4open ici s)a2tmxmpnu0tptnii3tyt aDul(mp u4texrmf3todlmDelnvs (0s2xoxr ny1al n icsa()srta(rooo4tlx iiciltla emu o;(0artoif todfpt  nes (  2xrir oo1aptn icslsfa2umumoot4apxoifeiad s rmu o;t0texnmf totla  ln o s0texmxo3io4ome mfvias sDrmur no1opt ioeiatlm rl(mo;u0tltnxociotfmDelu ilt)seurxrpiu1op e nvias  Dtrxrp;u4altomfcilsfm2um(ms ()aleoiocta1fpteauvils t2xmxo3iy1alenmfvi t a2ra( onu0tle iieiytlsDua(vont)tlxrxr oa1fp   u s;t0sexoxmpiu4op emicsa(  rrrxrpnt1tpt iictys a2rluvo;t4 eenxf io1faDrlues;()trxrxm nodal   iei (faDurxro;u1tet moeiytlaDuln on(4tlxnxr totopDrauvi;(0 rtriopiy1ap e fci ( s2tr(  nu1apx  ocias s el(ms t) rermocoydfpteaieslt)s2uoio ou1omee nvt sf rtrx  ;t0opt ifctldfa rln p u4trxrmoctodfaDeaues;t)s2xrio3oodap elnetls  rrm(rp;u0aptn o3ias s ra(vp;(0teeomocoydfmtr ivs;s  euoxrpiy1lptnmnei () 2tr(mo;t1olt mi3ilt s ra(mo;t0tltoiociotlp eanvi s teto(r3io4lltelieia( aDtaurooo1texniiciasls ulnmsn(4tlenif3iytoaD ai sls) eto(m3oo4lm  mfvtat s2rm(mo;t0opx mfeiydfsDumumont4 reoxf3to1opteaueil( teurxo3ny1lpen fvsa(fsrur(  nu0tpeo fciys s rlnvs;u)trtrmf3oodfp  au o;()t2tmxm3nu1apt  fci ()a2trumpnu4aee  ietydls2emu p u4 lxoir3tydopte n s;()texoxr oy1lmt mietlsf 2taurpou4olxoifeilt s2el(vs u4altniociytla  lueo s) 2xmim3oodolee nvsas)aDtmu pou0tpeo oeias s elnvsn(0 rerio3ty1oa e nvi t t2xm(r3nu1ome  ivtas srrru pot1olxn ieiyt s ra( ont) eenmr3tydlat lues;t  2urio3oo1lle  nvilt  rtrxrp;u4aeenif3iatfaDeluvs ()trerif oytlatrln sl( texo(m3nu4olt mnctl(faDraxrpno0olxn icildfm2umu s;u4arxnmf oadomDeau o t0 etoxm3iu1lpt mncilt)srua(r ;t0tetoii3ias m2eauvpn()altoir iytoaDrli o;t0 rtoxo no4ape mfetls)artrxro;o0oeenifcias m emnmo u0alenmocoy1opDeli s;(0teurim3iy1aptnmieia(f Dtaumpno4tpxo ictltls ulnms;u)tleomfcootlm r nei ()t2tm(o iydaptnmnvsat s2raxrono1aptomietysfaDelu s ()tetnmrciadfmtrlivilt)t2xo(o oo1al  lfviatfaDtm(rp;u1oet  i3iysla rlu o u)aetrxo ta1fa raueo;s s2uoir no1ll n nvsa()a2tmxmpot1aet ifeilt s eln pnt4texoxr3tytop  anvo s) rumxmpio4om emfeilsfarrrumpnu1ale moctatls2rauvo u4 ltoxo3oo1oatraues;t trtmio3iodol  lfctat  2rmxrpnu4oleomoetltlmDuauvs;t4 rtrxoctydlate nvi ( t2toxm ou1omenmivi s s2raxmpot4aptomociasls2em( o;(4aeenif tydoatr ies;s)srum(m ou4ap nmnei s)arrru  ;u0tpx mo3ildfa2eln s;(0 renxf3totlpDran il()trumim ou4olte nvtatfsDumxmpou1opxnif3iltfm ulu pn(4trerxf3iatoateaivo;s0t2toimpnudlleemicsasfarurxrooo0tlt moctadfsDulu p;()alxnxo3ia1fateai i;t  2triopiudlp   feias  2tm(rpno4tpx  iciad aDrm(vpn()tlenxociadlatr nvsl(0t2toim3oydalte nvi s)aDtm(m ;o1texniiciatls2el(vp;u)tltrir iodomDeai slt truo(opio4lmt licilt  rrr(r nt1tpe  fctasfa umump;t4arxnmo3ta1lm eai olt0t2xrxo3ny1am nlncsasfs2ra( pnu0tleomieildfm em(vp u4 lxomf3tatomD an i;s) 2um(r3ou1lptnlicta(fs2rmx  ;o1tpe mociyt sDrm( pnt4 exrxr3oy1fmDelies;t0 rtm(m3ou4apeelietltf 2tmxmpot0opeomieiadfsDulnvp;() reoioctadop rln s s  rxoxr3nydlme mfetl() 2rmu p;t4tle  i3tldlm2rmn p;t)tetomo3tytfpte i s s) rumio ou4apen neiasfartaum ;o0aptomictad m em(vsnt4altomo3to1opt aies;() exrxmpno4lm   fetatfs2rrxr no4alxnioetasfm ea(vs u4tetnio3iy1fmDelu ols)s2xmxm3oodlp elivia(f 2urx  nu0olxniociltlm2rau snt0altnxf3tydfmDeai ol(0 2uriopou1ale mnctlsf Drmxroot1oeenmieiasfa2em(msnu0trxrio3oadfaDe nvsl(0t2xrir nudaltnlieia(f 2tm(rpot4teto f3tadfs eanmo (0teerxo iytop elieilt)s2urio3nudlm  mnei s) Dtru  ;o0texniociasfa emnvsnt0texoir iytfmte ueilt0seto(m3iy4lmen nvs tf 2rr(root1alx  ieiatls2ul( o;t4trxrxo oodfmteli i;t)s2xmim3io1apenlicsat sDta( o;u1opto octld m2emuvsnu4altnifcta1omD ai i;s  2toxmpou4llte fvtls s2ur(rpnu1tlenmfeildls ul(msnu0tlxomo3tatlaD an o;() rtrim3iu1lmt  nvt (  2trxm ;u1opto oeiytls2rlnmo;t)tltnxr3oa1oaD lnei;t  2xoxm3ny1ame  icilt s2ua(ro;t1tlx  ociltfs umn s t4tetnmf3to1fpteanvi s)t2uo(r3oy1oleelfciat)sDum(m nt1tpe ioctlsla ra( p;t4trtrxociydlpt  nes;t0s2toirpno4lp n fvilt)s2tmxmpou0teeoio3iatlm2elu pnt0aetnxr3iatfatrlnvo s)trtmxm nu4lmee fciltfs2rmumpnu0oexomf3iad a rlnvpn(0 ltnxfcoy1fp rlivols) rumxo io1lm nmncsltf Drm(  ou0oetomietaslmDrlnmp t)tetoxr3tatlptr u o;()srum(m3iudamtnlfvt tfsDuax o;o0alxniieilt m uluvp;u0alxnmrcootfateluvo ()trum(r3ou4llt  icil(f rtr(mpou4opt moeiadls ulnvonu4tlxomrcoy1lpt ai s (  rtr(mpou4olteliviasfaDua(mpnt4teeomieiysfs umnvon()alxnio3oo1fa e uvi;(0sruoxr no1ome  fcta()s2raxmpoo1tlt mi3ilslm ua( p;t4trtrxocoadlatrau ol(  eumiopoodop elncia( a2rax pno0tet  feiyt m2uluvp t)aetomr3tytfm e nvi (0 ruo(m3oudale lietas sDtmxmonu1aptniictlslm rl(ms;u) rtnxr todfp   ivo s0trxoxopnu4ll  mnes s  rrmum nu4opxomfeiat sDumnvp (0tltnmf3oytlaDr ueslt  rxmio oudoptnliet (farumxrpnu0opxn oetltlm2ea(vpn()alxnioctadoa   ieil( teumim3iy4lpe  icsas)a2rm(mp;o1tpe  ietldla el( o u)aeeoir3iatfat  nvs s t2uo(m ny1am  mfet t a2trxmo;o4oltnmiciysfa2ua( p u0 lermoctotom elnesl(  2trxo nodol elfet (fsrtaxrp;t4aexnmietlt mDemnmont4trenxrcoo1fpt aieo t)tetrxo oodoptelncsat) Dtrx oou4olt  oetlsla2el(vont4 rxrxfcoo1fpteanvs;t0 rumir3io1lltemivta( aDum(mp;o0aee  ocias a rmnvsn(0arxnxfctotomte u il()srurxo iudomtnlnctlt  Drmxmo;o1oltnifciatls ulnmo;(0alxnif oadlmDrlivs;( srxoxopny4altemfeias srrrur nt1apeomfeiaslm rau s u)texoxociydoptranvs (  eur(o3io4lm emnviat a2ra(m no0apx moeias aDea(ms u)teenirctatoa  aivi t0 rumxr3nu1olee nvt s)sDtrxr ;u1oet ifcias m2el(vp;t4 rerir3ootfptraivsls  2trim oy1ape lics (f ruax o;o0apt ii3iadfs2rau o;(0trenmo tadoaDelivolt)trtmiopoodal nlfct s) Dtaxm no4opx iictld mDea(vo;u4trxoir oadlmtr n slt)t2um(rpio4lptnliet ( aDtrxm oo0oeeniociatla2eanvo t0treomrciadop e i ol()setrxr3nu4ol emivtat)sDrm(  ot0tlx  f3iasfa emnms;(4aetrmfctytop   ueolt0 etm(rpiu1alte fvs (  2um(rooo1olxo fctytfsDea( s u4 eeoxf iodopDeaivi;(  exr(r iudam nlictl(fsrum(  no4oltn feiat s2eau o;t)arerircta1fptr uvs;t0t2uoimpoo1alenmfvt t sDuaxmoot0aexn ieildfm rmn sn(4alxoio3tatop eaies s0setrxr3oo1al   neils) 2ta( o;u0apxo f3ilsfsDrln p u4tlxomr iytfmDr n i t0s2to(m iodom nlivsasf Drau pno0tle iictltfa2rl(ms;t4 renxrciy1oa e n i;t tetr(rpio1optnmivsasfsrtaxm no4aeeo icilslm emuvo t)aetoir oo1oat  nvils  etm(opiudamt  ivs (faruau pnt0opx  feiyd s eluvsn() rxrxrciatlp  ln ils  2xrxo ou1lmtn fvt (  2tmxrpot0aexoiociytfm2rm(vo;t0aetrio3tydlm rlu o;t0 2to(mpoy4lmenmnei (f 2ta(mpot0tex moeiadlm el( o;t4aetomo3io1la rai sl()setmir3ny1omee neil( s2um(r no4apto oeild mDea(vs u0 ltrxr3io1fptr neo;()s2xo(mpnu1lmtemneil(fsrtrur nt1opxn icias mDrlnvo;t)aetomrcty1oa eaieils0trtr(m3nodaltemnetls a2tr(root4oexnii3tas aDranvp u)aetrioctotlmDelu ilt srxo(r3oy4ol  lietls)srtrx ono1apxnmociyd sDemn pnt4arxrxo oytoa rlnvi s texr(m3iodol emicilt aDtmu  ;t4olt mi3tls mDeln p (0 ltnif iadlaDr ieo;t)s2urxr3nu1om  lfesl(  rurxmono4tpt mfciydfm2eanvp;u0arenir tatfateau o s s2tmxm oo1lpe lnetas)s2rru pno1opt mociyd m2el( sn(0trxrir tatomt lneols)s2xmxm3io4lme  nvtat)a2urxm ;t1tpxnmf3tydls ua(mo;()tlxnir tatopt luei (0truoim nodame  iviltfaruru pnt4oeenmf3ilsfm2emn sn() lenxf3iadfmD  uvo t  rtmxo ou4omtn nvtlt)a2trxrp;o0olt mf3tatla2ul(vo (4trxomf3todfaDran s;s0truoio3iu1llenmnvtatfaDtauroou1tlxn i3iltlsDuau on(4tetrxf3ta1fp raivs (0 2trxo io4ol   netls  Draxroot0tpeomfctadls ra( s t4teeomr3oadlaD lnvo;s)s2xo(o no1apt mncs (f Drr(mp;t0oeeoioctadla2el( s t) rtomf3tatop   uvslt0srtoxm ou1lmeemnvt t sDtaurooo1opxoifcildlsDumump (0tlxrxf3oy1lptrli i s  etmxmpny1altelfcsls)s2tmx pot0opt iiciltla uanmo t) lenif3oa1lmteanes;s)trxoxrpoodomee nes (f Drr(rpnu0oltn iciysla2el(vs u4trerio3ootomDe u o s)t2xoxr nu4ll  lnet sf Dum( oot4aeeo ietatfs2ulums;()alxnmf3iatop  luvi;s srto(mpno4apee nvsas)s2taxm nt4opto ictyd mDel(ms;(0alermr3ta1lpDean il()teumxr oodllt  nct () Duaxr nt1tex miciysfa eln onu4aetoxf3tatfmtrluvs s  eto(rpiudamtemncsa(fsrtaur no0tlto fctadlaDeauvsnu)aexomocoa1lmD auvo;s0 2tr(r no1llt mietat)srrm(ro;o1aeeoiicild aDrmums;u)artnir iy1lmDelneols)teuo(r oodllt lnvslt)srraxrpnt1tetoio3tld s2elnmonu0 ltomf ty1fp rau i;( setoiopio1lpe  fcia()sruru pnu1tleomi3iadlm2ulnmo;u0teenircoa1opteau i (0srumimpoo4lp  lieil( a2rax pou0olxo ieilslm2ulump (4texnir3oadoa r i i;s seuoxr iu4aptemnvil(fartr( onu1tptoio3tydlsDea(mp u4tetrxr oytomD anvo;t)s2urxr3iy1omtnmivsls) 2rm(rpoo0olto f3iyd m2em(vp;u)trxnir3totfpteaueol()trum(r3nodale lnvilt srrmxmono4alto i3tatfa eau p;t4tleoxo iadfpt  ieolt0srtrxrpnu1lptelivtl(fa2rr(  ou0openioetls s2umumsnt0tltoxocoytopDrlnei () exo(r3io4om nlfvtl(fsrra(r ot0aptniictysfs2rlumo;u)arxrir3iodlpD lueo s t2xoir3iodop n ieiltfaDtrxrp;o0optnifeiytfaDrln onu) lermf oy1fa e n ilt s2xmxr3iudamtemictatf Dtrx  nt4oltnmiciaslm ua( p u4aetnio ta1faD au i;s)sexrio oydop elfvsasfa2ta(m nt1tlen o3tlt aDrmu on(0 ltoio iadom rauvils)srum(opoo1alt mnetltfa2rmxrp;u4oleomoetad sDuln p;u4tlermrciy1lp rauvi s0 exrio3oy1ame  iesas)s2rau  ot4tleniicias mDra( pnt4 ltnircty1lm rlneols0setr(o3io1amenmfesls)srrm(mp;o4aexoifeiatlsDrl(ms;(4alenirciatfp  li olt) rumxm3iu4op nmietls) Dum(roou1optnifeiltfm rmump;u) ltrxrctatlmD  ues s) 2um(m ny4aleemfet tf rtmx  no1tlxo i3iatfa2em(vsnt0 rerio ty1lpD ai il(  2trxr3io1ap e nviat  rua( ooo1tle ifeiat aDrlnvo u)altnmr3iytfmtr u slt)trumir iy1aleelnvslsfsrua( o;o4aetnmoetadfmDrmu s t0 etoif3iytfmD ai ilt0trum(o3iodlmt lfvias arumumpot4ope  iciadls2elu snu4 leomrctodfaD luei;(  2umxr3io1opte fctlsfa2rmu pou0tpxnifetatfm um(monu4texnxf oatfmDeau s;s)s2trxr nodamtnlnvs ( artrxr ou4opeoif3tltfs elnvsnu) rxrmf tytomD lies s) rum(o3nudoleemicias a2ur(m nu0apxn fctltlm ra(ms u4trenio todoa elies;t)t2ur(mpou1lmeeliei s  rumx onu0openiieiatfs2umnvsnu0teeoif ta1lp   ueol( seur(opnudlm n ncs (  2trxmoou4alt iieildlm elnmo;t0 ltrmf3tadfpD aueolt)setmxr3iy1lpt mieilt)srrmuroou1opt  o3tatls uauvsnu4trxnmo3ootlmteai i t)teto(r nodap e iciat s2raxrpoo4ole  ociysfaDuau ont) exnmr3io1optrlivs s0t2urirpoo4om nlfesatfsrtmx o;u0tet ioctysfs em(ms t)tltnmf oo1lmteli s;s)tetoim3nu1olenmnvs (fsrtauroot4alenmo3iasls ra( pnu) rtrxr ootfm r ieo ( seurxo io4lmtn ivi s)aDtr(rooo0alen fciatlmDrl( p;t)treoir oodla rauvol( s2uoim iu1lp   iet (f 2umxroot1tpxoiociatfa rl( o;t0arerxrcoytlat au ol() 2xr(m3oy4om n nctltfsruaxront1aex  i3tls m elnvp;(0alxrir3oa1op  au o;t) eumxo3ou1ll elfetls arrrurp;o1altomoetytlsDrmnmp t4 lxnmr3oytomD lu o t texrio3iudoltnlneil(fs2umxr ot0texnmietasfsDuauvpn()tetnmo3oy1lptraieo (0 eto(r3iy1amen ncta(fsruru p;o1tetn i3tadfm2rlnvon(4trxnxf totfmDelnes;s)teuoxm iy4opeelfvt ()srta(  ou0opx  o3tltla2ea(vo u4arenmocoatfp  auvi;t trtmir oo1lptnlfcsls aDum(rono1tee mfeiysla emnvo t0 rxomo3ootoa   uvs;t  rtoim oo4ll   netls arururp;t1tlen f3iydfsDuau o;u)artnxr io1oaDraivslt srumir3io1ap  mfvtas  2um(mpnu0texnmieilt m2rau pnu)trxnmo3todlpDr ues ()t2trxm no1ame  ivsl(fa2um(r ;u4alt moctydfaDea(mo;t4 exrmo3oodoat  ueslt0 rtoxrpnu4lpte nviasfs2urx  nu0aex moeiaslm rlu o;u)tlxnifcoodlat  nvo s0 rurio3iu4lptemiet t  Dur(m ;t4tpt ii3iltla2ea(vo u4 reoxrcootfm   n o t) exoirpiy1opeemnesl( aruaxmp;o1teeo feilt s2rlnmont0trxoio totlm e i s;()t2xmir3iy4lm elfvi t  Drau p;t1alxo feiyt m rln s;t4 leoio oo1lpD  uvo t sruo(r3nu1alt lnvils)srumx  ;u0texoiietydlm2ul(vp u4 ltrxo3oydopt li s;t t2tmiopnodopenmnetas) rtmxrp;u4aetnioeiydlaDrl(vsnt)arenio3iy1fp eai s s  2ur(o3io4ap nmfeias  rrr(r ;u1optnmi3tlt s rmnvpn()tlxrxrcootla r n ilt srurim no1al  lfvtl( srtmurpou0tpxomfeias m rl(vs () reoxo3iadlpt  i ilt)sexm(opiy4omtnmnetlt sDur(r ;o4teeomoetas a2rmnvs u) lxnxo iydfmDeaues s0srxoio ou4lptnlici ( a2ra(  ;t1texomociatfm2uauvsnt0tltrxo tytoaDeauei t)sexm(m3iudomeelnetl() Drm(  ;t0aleoiieiytfmDulnvpnu0aetoifcootop ean ils  rtoxopny1ome lfctatfsrtaur ;u1olxnmi3ilt a rmumo (4trtoir3ty1fmtr n sl(0t2to(r iy4lp emfcsat)sDrax  ;t1tlx iocias s emn p u)aeeoxr3iydom  aiei ()trum(opoydlme mict sfs2um( p;u4alx  fciydlsDea(mo;t0aetomf iadopDrln ol()srxrxm3iy1ol n fcta(fartrxrpnu0oetoii3ias sDemnmo u4altnxo iotfm eauvo;s  2tmimpoy1am   icsl( aDrrx  nu4aeenmfetatls ul(mpn(0arxniociy1op eaneils srxm(opnudoltnmfvta()sDur(  ;t1texomoeilsfm rm(vs u0teenmrctytoa r nvi;t0 exm(r3ou4om  licsasfarum(r nt4oet iiciysfmDuanmo;(0 reoxr3todlmteau ol( sruoir3ou4ll  mfeias)s2urumoou1tlto octydls elnvs t)tltomf iytoaDrluvols  ruoxm3io1olt lfei tfaDrm(m oo4tee ifcilsfaDrlnvont4altrmf oydoat au s t srtoxo3nu4amtnlnvia()a2umx pnu1oetniocias a emuvp;t0arxrxo oodfaD lu o;s) 2tmio3iydaltnlnei ( sDumxr nt1oltomf3tad s2el(von()aexoxr3oytlp eauvslt  euoim3io4ape  icta(faDrau poo0tetn feilt mDrl(mo t4 eeoircootomDeanei;s trtr(rpoy1op nmfvia()s2ta( p;t1tet ifetadfmDra(mp () exnxf3ta1fmD anei s s2xoim3no1apte neil() rua(mpnt0olxnio3tat a ranvp;t)areomf totlpDe u i t)s2toxopnydamt lfvsat)sDtrx  nt4oeenioetasfmDra(vp;u)trxrmfcty1lmD livo;t) exoirpoo4lmt  neias)aruaxmpou0opx io3iydlm uanvon()tlxrxo3ia1op r ivol(0srurimpiodlpenmfviltf Drm(ro;o4tlxn o3iadfs ea(vp;u)teeoxocoo1fm rli s ()setmiopiodome lfesltf 2umu ont0apenifciltlaDrmnmont) ltnmociatfp r ivi s0seumim3no1aptelnvsatfsrrrxrpno4aexn f3tadlaDeaump;u4alxrxo tadoaDrluei s) 2ur(opoo4lltn ictl( sDrrxmono0altomi3iatlsDuaumpn(4tetrif ia1lmD auvi t seuoir3iy1om  lfvsa(  2taxmpnu0aee ioctytfm2um(vs (0teenmoctatfatraivs;s  ruoxmpou4olenlfvta()sDta( ont1ope mieiytfsDrmnms;() lermf tadla   nvs (0t2xmxr nudal nliei s aruaump;o4apxoii3tatfmDelu o;u0teenmrcto1laDranei;( s2tmio3io1ap  mnesat) rur(mpnt1altn feiaslm2rmnmpn(0artoxocta1opDeluvo;s s2xr(opoy4opeelfesa() Dua(rp;u0olxoiocildla2rau p u) etrxr ta1lp  li sl() 2urxo3io1apeemici (  rrruro;u4apxnioetldfs em(vo;()trenmfciytfm  lieol() 2tr(rpio1llen ici s)a2trxr no1tpt io3ildfm elnmonu0aexnxr ootfa rli ils)setr(m3iydomenlnvsat) 2ra(m nu0alxoif3iyslaDrmuvo;u4teeoxoctotlaDr u olt0s2xoxr iu1opeelicias)a2rm(rp;u1alt mietldla2ea(mo u)teenif ia1oatranes s)tetmxopiu1olenlfvilt a2uaxm ou0tlxn fetldfs2ul(mont0tetomo3oa1fa   i olt trtmxo iydllt  fcilt)arum(m ;o1apxnmicilslsDemnms;()teeoio3ia1lptr neo;()setr(rpoo4ol emivt tf 2urxrpou0olxo i3tad a2ea( pnt)teeoio oadfateluei;s  exo(rpny1ap  mnvsatf rrrx  nu0aeenmociadla umuvp;() lxnio iodfa e ivils0 2tm(m oy4op n ieils a2tr(m nu1aex mfcilsls2umumpnt) lxrxr iy1fmDrlieslt  exm(opno1omeemnvi tf rraxronu4tee mf3tatlm2rlu p t0aeerir totlmtrli i;s tetr(mpoodomtnmivias  Dumumo;o0optnmoetad m em( s t) renxocoydlaDelnvi;s0 exmxopnydlmtemivsltf 2ta( p;u4teeo f3tat m um(vo;u0tltrxr3ia1lpDrai s;t)srtr(o3iydameemivilsfartm(r nt1alx  o3iysfs2elnmp;(0trenmf totfptr uesls  2uo(m oodame lfcs ()s2tm(mp;t1opxniietys m uln s (4 ltrxr to1lpD auvi;t  rtr(m nu4optnmneia(fsDuaum ;t0tltomociaslsDumnvsnu0trtnxfciatfmte u i (0texrxr3ny1lmen fcs t s2rmuront0tlxnmociatfs2um(vs;u0 etnmfcoodoa   ivi (0 2urio nydlptnmici s)aDuau o;u4tleniieildfa2elnmp t)trxoif iy1fm e ivil()s2um(mpoydlleelneiat) 2umu  ;o0tex  f3tat a2rmnvs;t) ltomo3tatfpD ln ol( srxrio iy1amenlnei ()a2urum ;u4apxo fciys m2ul(mo;(4arxomf3oa1fpDrlues s  2tr(o3iudlpt mnetl( sDuax pno0optoioetadfaDum(msn()trxrmr tytlp e ieo s0seuo(o3iudlltnmnvt sf ruaxmo;t4oexoii3ilslaDeaumo;()aetoio3oo1fa ranvs;s)s2trxrpnydaptemfeiltf Durx  nt0olxomfeiys a2ra(vo u4tlerio3oodlmt  i il(0t2xoir no1ameemiet tfs2rau  nt1aexoif3tytla ul( p;u0 exrmoctodfa rau ol(0srtmxo3oo4lle lnvs t) 2tau oot1oexn ieildlmDul( o t0trxrxo ia1lat lneslt)srtmxm3ou4al   fvsa() Durx o;t4tpx iieiydfsDea(mp;(0altoxr3iytlmtelnvs;(0t2urxo3no4ole lnvsas)a2rm( oot0tltniiciad aDrm(vpnt) lxrircoatlmD luvo s)setrio nodop   iesl(faDrau oou1tlenmictadla ea(mpnt) rxnmr3iatlp r u s (0texmxmpio1omeemfcias aDtax pou4aetomictltls rmu s;()arxnmr3oy1oa  au ol( setm(m oy4olt miciatf Duax o;t1teenmoctys m2ul( onu0 rtnmo totoaDrli sls0srtr(r3oydalee nvs () 2um(rpnu4tle ii3iasfa rmuvs;u)trtnmr3iotlpD anvol(0 rurxopiy4lpe lnvi (fartaxmo;t4opx  oeias aDem(vs (0aeeomo3iadoatrliei t)teurxo3iy4op n icsasf 2rmx ont1aexomoeild s2raumon(0alermoctatfm e uei;s0texr(opno4ll  lfcsas arrmxr no4aee moeilslsDrmuvon(4altoifctytomDraivo;( t2umim3iu1lpt licsasf 2urxr nt1texnii3iyt m eau o;t4trxrmf3iytlmte uvi;(  etoim oy4om  mneia(f Duauronu4alto oeias m2umnmo;u0aexoxf tytomD luvs;t) exmir3ny1omtnlnesl( sDua( p;t1tet if3iysfaDel(mp (4 etnir ootfmD  ieo;s  rxm(m3no1lm nmnctls  2umuronu0olt mi3tyd s ean o;u4aetnxr ootopDe nvs s  2toxr3iy1altnlnvil(f Dtr(mo;u0oexn ictlsfa rmumo t4texrmr3tydfa r ieil()srto(o nu1lp e icsa( arta( ooo1oleomo3iaslm uau s ()artoxrciatomDr ivol() rxm(r3oydlleelfctatf Drmumoot4aexo fctaslm umn s t)tltoif3iadfpt  uvsls)setrxm3iudapeemncsat) 2rru oot1aet moeiysfa rl( s;u0 exrxfcoodfat lu o (0s2xrio3io4ale lnvtls s2umum ;t0oetniociydfm2eln sn(0 rxrir ootopte neo;t0s2tmirpiy1ale mfesl( aDtr(r no4olt if3iyd sDrm(vs;(0trenio3oy1fa e ivi;s)tetrxrpiu4lle miei t  Durumpot1oltomf3iadlm elu o t4 exnxfcty1opDeaieils0sruo(rpiu4lme  nvs s)srtmur ;u4ole ioeiltfa2umump (4arerif3tadlptr ues;()s2umxrpiy4omtemnvt tfarur(r nt4alen ictatlaDea(vsnu4 eeoif tatfm elnesls)t2trim iudol  livsa(  Dua(mpno1olxoiociatlsDrl(monu4teeoif io1fpt  uvi t0sexmimpoydaptnmneiasfarrm(  oo1aetomf3tytlm uau o u4 ltrxo iy1fm elueol( t2trxm no1amenmfetltfa2ua(rpoo0tee ii3tatlm rmu s;(0aeenxr totfpte u o ()t2tm(mpou4lle mnet (fsrumu  oo0optn fctasfa2eanvs;u0trermf3iy1lp  luesls)texriopio1op   ict (  rur(ro;o1oet ioeilsfsDel( o u0arxniociytfa   nvil( tetoxrpoy4apee nei (faDrm(  ou4oetn ociaslsDum(mp t)arxoxf3oadfm ran il()teuo(r3oodlpt lncsatf Dua( ooo0opx if3tldfs2eln snt)texrxr3tatfatelnvs;s0trxmimpno1al nlies t sDtr( pnt1apto iciytls rlnmp t4aleoif ia1fa rlueo (  etmiopoodap   fes s aDumxmo;t1aeto ociydla2eau s u) lenxf to1opDelues;t)s2xm(m ny4aptnlnvtlt) 2rax pnt1tlt  o3tatlaDemnmont4aeeoxo iadoa elnvils srur(r oudllee fvsl(  rrrumpoo4tleo f3iydfa ul(mo;t4 rxoxocta1fmtr ueolt) 2uoxm no4omen fetatfarrax ont0tlen oeias mDua(vo t) reoio oy1fpD  nvo ( teuoxo3io1alenlietls)sruru  no0alto ieiydls eanmpn(0 eeomocio1la rau s;()trtm(opiu4ol e nct s)srrr( pno0aleomo3ildla2ulu p t4aeeoxr3iy1opDeai s s0 eur(opou1aptnlfeiat  rraump;u1tetoif3tytfa umnvsn() rtrir ia1omDeaneilt  rxmim3no1amenmivi ()aDrr( pnt0apeomo3tas sDemnmo ()tltnioctydoa e i o;t)texrxm io4lm  licsl(fartr(m ;t0apx mf3ilsfa2rmnvp;t0 ltoxf iotfpDrauvs ( t2xrir oydam nmneils sDrr( oou4tlt mieiytfaDel( p t)altrxocootop rlueo t)setmimpnydapeelfvsas)sDtr(mooo0altoiicilt aDumnvsn()tlenmfciydlatelieols)s2tmio nudom  licias)sDrm(m ;u0tle  ictasla uanvsnt0 etnif io1omtrauvs (  2tmxr3oy4olen fvia()sDtaxr nu0oleniietytfs uluvo;u4artrxfciotfp  li o t) ruo(m3ou4oleemieiltf 2ua( poo4apxoioeiasls2rl(mp t4altomr3oatfmt luesl(0 etmxo nydapenmivslsfsrraxmpou4tet  f3iytfa rlums;u0trtniociadfm eluvi;t0s2uoiopny4omt mnesl(  Drm(r nu1alx iietlt a rl( on(0 lxrio3io1faD  neslt) 2toiopoo4lmeemici ( s2ur(r oo1oltn ictatfs uln pn() etnir3ty1opDelies ()seumirpiy1aleemfciat  2ur(rpoo1oee mictys aDrmnvon(4arermf3oadlmteanesl(  rxrim3oodope  nvsa(f 2taum no0oet mo3iltla2emu p u0trtrif ia1fatr u i;( teto(rpnodlm nmivs s  Dtm(rpnt0opto iciad a rmumsnu) rxnxf3oatopt aiei;(  ruo(m3nu1oltelnei s)a2taxro;o0tpxoiociydlm rm( p t0trtnio tydlm   n ol(0s2xm(m3iy4llt  nvia( aruru pno4aetnmi3iltlsDemnmo t0 renmrcoo1op   uei ()trxrirpiydapt lnes t)s2raxmooo0apen ieiyt a2emnmsn(0tltniociodop   ivils  rtoiopny4lpeelneil(  Dumxro;o1tpt mfcildfs2umnms;t)arxnxocta1fm e ueo s) rxr(opno4omeemfcias)artax o;u0aleoiieiytls2um( p;(4teerxo oa1optelnei t0texoxo3iu1omtemivilsf 2ururont0oeenmi3iadfsDua(mp;u)treoir iy1lm  lnvi;s teum(mpio4amt  nes sfsrtaxrpoo1tle  ietatfm rl(vpnt4aetrxf oydlpDr uei s0trxrxo3nodopenlfeta(f Draxmp;u0aet mfeilt a em(msn(4alenio to1omDe u s s0s2xmxm3io1lp nlnciatfaDrmx o;t1texnio3tatfaDulu o;u0 rtnmocty1oa  ln sl(0setrir3ou1ll  mnetas  Drr(  oo0tleoifetldls2ra(mpn(0aexoif3tytfateauvi;s srxrio oy4lmenmncsasfaDtaxm ;u0teeo i3iysls rl(vpnt4trtnxrcta1lm eanvs ( t2trxm3nodaptnlfesl() rumu pno1tee ii3iadls2rauvp;() rtrif3iydoa rlivo;(0s2xoxr3iy1lm eliesas s2tm(mpoo4oleo ieias m eanmpnt)texoxo3oy1oa   ues;s texm(mpoudaleelieias a2rrxm ;u4aex  oetldfs um( pnt4arenxrctadoptrau s;s) 2toio3iy1ope lnci (fs2rm( o;t1ope mo3ilsfa2ranvo t4 lxomrcoa1fatrln s;(  rtr(opiudllt miviat) Dumurpno4tleoii3ildls2emn o u4arxrmf oadopt  nes t)trtoim3nudom e nctlt  2ua( p;t4tpxniictas s elnvp (4 eeoirciatom elieo s0 2xr(o3ny4lpenmictl() rrrxmoou4altomieiatfa2eanvo (0trxnir iatoaD  i sls0seurir oudolee icslsfa2ur(rpoo4tlx mfciadfaDua( ont4 ltnmo ta1lm  au i s0sexmiopou1ol nlfvtl(fsDrru p;t0oetoiiciydls2emnmo t4 etrxrcoy1lptrlu s t)trur(m3oo1aleemiciat  2ua(  nt1openioctasfs2rlu snt4artnmrcio1fm e ueo;( t2xrxmpno4ap nlnei s s2taxrpnu0oexomf3tltfm ulnvp ()aetoxr3iotlm   nes s0t2urxo3nodllte feil( sDrm(  nu0olenmfeilslsDrm(ms;(0 eeoifciadoaD lueolt trumirpny4alteliei t)srrm(r nt0alxnmi3ilsla2rl( o;t0arerir3ootlptr ivsls)srur(opoy4op  lfcslsfarum(monu0oetnifcils m emn s u0teeomrcty1omtelnei;s texoxo3oodopenmict t)srrmxrpot0aeto ociad mDrlu s;u)texrxrciadlaDranes;t s2tmxm oy4ope mneil()a2urxmpno0aex mo3tysfm2umu p;u)aexrifcio1fmDeai ils)trtm(mpoudal nlfvtatfaDur( onu4aexn ieilt sDem(vont)artrxo iodlpDraueilt)s2xmio3nydlptn fvils)sDrax  no4oeeomo3iydfm2emnms (0arxrxo io1fpD ln ols0trur(rpno1lmt lict t srraump;o0tpenii3ilt m2um( o;t0tleomr oa1op e ies;t  rtrxopoudapt miei s a2taurpoo0oeenmoctysls rm(mp ()arerio io1oateluvi s)t2urio iy1ll elfcia(faDta(m no0openif3tltlsDumnvsnu0 lerir iydoateln i (0teumxopoydapeemicil( arumum ;o0tltoiociydfm rm( s;()alenxoctydlateaivsls t2um(opnodlpe  iet t  Dtmumpnu0tpeomf3tysfsDelnvonu4 rtnxr to1op rlues ()srtmxr3iy4lmenmfcta( aDtrxm ;o4tpenmfciydla2rl(mo;()trenif oatlat aneo;t  euo(o3oy1ll  mfvi tfarrmxm ou0olxniiciys m rl( s;u)texoxo iytfmte uvo;t) 2xoxo nu1lme mict () rur(rp;t4tex mfetydls2ul( s u4aeenxo3oytlm eaneols)srxo(rpio4lp emfvias a2taxr ;t0oexnmf3tlsla elnvpnu) etrmr iy1lm eau s ( trtrim io4opeelfesa( s2ta( oou0altnmi3iat m ul(mp u0altrir3oydlmDraivo t  eum(m3iy1ame lfct sfsrrmxrono4tleomfctydlsDrl(vs;t0 ltnxr todfa ranvils) 2xr(r io4om e nvtat sDurx pno1tlt mf3iad sDeanmp () eermr tadomDe ivolt) eumxm3iudlptemneslt)s2ra(m ;t1tlx io3tydfm uln s ()aexnxociydomD lieolt)srxm(opny4ope mnet (  2umu o;o0oltn ieildla2rl(vs u0arxnmr iodoa  aneo (  2xrir3nudom e ictl(fs2um(ront4opeo o3iydls2eanmp (0 eeoxo3oodop eli ol()srtriopoo1ap  licsa(fsDrrxrooo1oexoioetaslmDrmu p;u) lxoxr tydlpDe ivs;t0setrir3ny4lmeelnei tfs2rr(  no1ope  i3ias aDumuvsn()alxoio3oa1op ran o t)s2tmimpiydop elfvtas)aDtmx ono1ape  i3iydfs rm(vp;t4 rxnmf3iotopD  i o ()seuoxo iodlmen iesl(  rtr(m oo4tex micils sDra(mo;t) eeoxr iy1lp r i i t)seumirpiodoptnmivtls) Dumxro;u1apxn feild aDeanmp t4 lxoxoctytlpD  ies;()tetm(r nu4ll emnvtatf rta(  ;t0alx ifctyslm2rmu ont4arenmr3todfpDe ieolt srxrirpou4lm elfei (fs2ur(  nt4oeeoii3tyt s2elumpnu0 exoif3io1omDe nei t texm(m oo4op  mivi s)sDumurono1tpxomociysfm2rm(mp;u0treomfciytlp rlnvo (  euoxm nu1llen iesatf 2rm(rooo0apxnio3tldfs rau o (4 eerio3totoat aueols0srtoxm io4ame  nciltfsDum(  nu0alxoifciytls2umnvs;u4tlenxr3tatlpD aies;s0sexm(o iu4amen fvi tf rrax pno0opx  i3iyslsDea(vonu4arxrxrciytop eaivo s  rur(rpoy1op   fcs tfsDua(r ;u4oee ifctysla2umumonu4tlxnir3tadlm e ivo s0srurxo nu4aleemfvia(f Dtrx  oo1tpenmfciysfs2rm( s;u0alxrxo iydopD auvo;() etm(m ou4am nmncia()s2raxmo;o1alxomoeiytfsDul(msnt)altnxrciotfm rln slt)trurxopiodopte fctat srur( o;o1open f3ildls ulu o;()arermf todopDeai o;t srurio iydape lies ()sDrr(rpoo4oet  ieilslmDean sn()tlxoxf oatopD li s ( s2urxo3nu4ap e ivi s)srtaxrpnu1tltoiietatfsDraums t0tltomo tytfateanes;() rto(m nu4apen ncias)srtax o;u1apt  octydlsDrl(vs;u0trtnmo oo1fpD  n i t) etmxopiy4amt  fei ( a2um(r ;u1oexnmicilt sDrl(vs (4tlxnxr ootomt liei () 2toxr ny4omee ivs s sDraurpnu0tee if3iysfa eau p;u0tlxrmo3oo1fmt au s;s0s2toxo io4lpt mnci tf rtmxr ;t1aee mfetatlm rlu snu0arxoio ta1omt  neol(0tetmxopiudalenlfvi ()sDuau pot0tetomfetat mDum(vpnt0 etoir oy1opDelu s s)tetoir nodllen fcsasfs2tax poo1texnmiciaslsDea(vs () exoiocio1la eln o;t s2umimpny1amtnmnvtatf Dtmx p;u1oeeomo3tldlm2uaump;u)aexrir oy1omD luvslt0t2trxm3iu1ope mnvi s a2ur(mpno4ole ifeiyt sDum( p t)tetnxocia1lptrluvsls  exr(mpnu1lmtelfvi t)sDtmx o;u0tet  ociyd aDel(vs t4teermo3tytoa rauesls  etmxm3nu4amtnlfcil(faDurxmpnu4tltnifetatlm uauvp t0aexomrcoy1fpDeluvo ( s2uoxopoo4lmenlfvs ()aDtau p;o1apt  ociasla2rmuvp t4 rtoir3oatlmteli il()srtrio3oy1am  lfctas) Dtm(rpoo1alt iocilsls eln s u) exnif tydfa  luvi;t tetr(m nodomen ivsa(  rtru p;u1opxoiieild aDem( sn()trtoxocoodomtrlnvi;( t2uoxo nu4ame lietat)artr( p;t1tleomietls m elnms t0texrircty1omtrli i;t)texoxr3oy4lm  lictl(fsDrr(mpot1tleo ieils sDra(vp t)treoxf ta1fmtr uvs (0 rurxm3iydale  fct ()s2rrx ooo1open octyt sDuaums t4 etnir3oa1lpte ieo;s trum(o iodaltemnct t) rumu p;t0aetn ieiydfsDem( p;(0arxnif oydfm eauvo;s s2xoio3nu4llt lfciltfaruaxr ot1aex  feiyt m2umnvp u4 etnmf3todfaDrai s;s truoim io4op nlncta() 2rr( o;u4alxomf3iyslaDul(ms;(0 renmo3oa1lmDe ivs;t0tetm(o oodome  ieil(fs2taxm ;t4aet  f3iasfmDranmo;t)aeerircoytfm   n sl( texm(mpiu1am n ivsl( s2rmxr no1apt  oeild a em( s t4tltnirciytom eauvo;(0s2tr(mpiy4lp emnctas aDumxmp;o4aeeo ociat a rluvo;u0teeoir3tydlmtrlnvs;s)trtm(o3nudllt mnviat)sDtmum no4aptomi3tys m2ea( p () etoio iadfp elnes (0 etr(r oydlpeemies ()aDtmxmpno1olt ifcilt sDrmuvs;u4tetnxf3oadfmDe n i;(0 etoirpny4olee neils) Drrur nu0oee  fciad mDemnmpnt) renxo iodfp r i i (0texr(m nodomenmfcta(fsDtrx ooo4teto feiadlm ea( p;u4aexnio oodlmteln i;t texr(o nudopt  fcsat) Drmump;t1optnmociysfsDrluvont0 rerif3tatfateaieol(0s2xmxmpiydap  lfeiat a2ra( p;u4tpxomieiaslm elnvo u)aeeomoctotopDraivo;() 2xr(m ou1ap n fcsasf Dtmxm ;u1alxn i3tlsfm2ulnvo;(0tetrxr todlp rluei;()trtmxr nu4lmeelfvtlt sDtr( pno1aleo fetyslaDum( pn(0aeeoxr3ta1la e iei;t) ruoxrpny1ol nmnvt ()sDra( pnt4alxn ociydlmDrmn s u0alxnmfcoydfm eaies;s)s2umirpnodolen ncilt)arum( poo0opeoii3iadfa rlu pn()trtrmf3ta1fm  lieolt0teurim ou4al nmnvtat)aDuru  ;o1ape  fciadlmDrl(vs t0arxoxo3iodlm eluvi s)srtoimpio1ol  lfcil( sDtaxr ;t4olenmictys s em(ms;t)areomrcty1lat lu ilt t2toxrpoo4op   ivtl(fs2ta(mo;t0opeomoeiytls2rmuvs u0aeeomo oadoaD lnes;t  2umxr oy4lmtemfes ( srtmur nt4tlxomo3tyd s rau s u)alenxr oo1fptrlnvi s0srxo(rpoo4lmtelictat)arrm( pnu4opxomoctyt m2umumpn() exomfcio1fatr uvo;t0sexm(opiy4aleemivtl( aDuaur nt4tlenioeiatlmDrmnvs t) eenio3oatfmt liei;t) rxr(o3nodaptelfetlt a2trumo;u1apeo fetysfa2rl( s;u0treoxo3tatom ranes;s0seuriopio4lmte ietlsfaDurxmo;t0texnif3iydfm2rmump () exnif3tadfmt auvs ( teuriopoodal nlivt t) Durxmpnu0tpx io3ilt m eauvpn()texrio iy1lpDr uvi t)trxmiopiy1am elfcils  rua(m nt0opx mi3taslm2elumo;t0 rtoxo tatfa  anvilt0t2xrirpoy1aptn icsls)s2uaxmpoo1opto fetatlm2rmnvo;(0aeeoif3iy1lmD ai ol()srxrxo iu4apt  iei tfaDrmur ot1tlx mo3iaslmDem(mo;t)tlxoir3iydopDeli s (0 etmxm oy1ap   ivs ( sruru pnu1aeeoif3iyd aDranms;t4 lenxfctatomD lnvilt0srtrio3oy1am nlneiat s2tm(rpoo1apto feilsfsDel(ms;t) lenxocoadfmte i o;t0sruoimpny1omeelneil()srtrxrpoo4tlx mfeiat m rau s;u0arxnxf oodomteaieo;t0 2toir iu1lmt liei s a2tr(m ;t0openii3tl
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt s2xrim3no4lp   ncs tf Dtmxrpot1tpxnii3iys sDuluvont4tlxnmfctydoptraivo t0t2to(mpnydllt lietls aDtmx ono0oexo f3tlsla2emu ont4tltomf3oatoa  lnvsl( s2urxo3oydome  ieias aDrax  nt1tpx  iciysls emnvp ()teerxf io1omDe ivs;t) 2xr(r3no1apen ivta( a2urx pnt0tlx if3ils a raums u4trxoifcoo1lptrauei;t  rtmir3nu1ameemiciatfaruaurpoo0olxomf3tatfaDum(vo (4texrir3iytla r i s s0 2toxo nydal nlneil(f 2rmxront4oex moeiytlm uluvon()tlxomrcoodfa eanes;()srtoimpnydllenlnet sfsDtau ont1tlxnii3ildls em( p;u4arenio3oodfa r neo;t srxrirpny1alt liet tfaDtmxmpno1apxniietlslaDuau p;u) eenxo3oo1opteanes;( setrio3ou1lptemfvi sfaDurx ono1apxn ictltlmDua(vs t4aeerifcty1op rlu ilt  exoxmpnu4omtn fet sf 2urx  ot0opto fcias s2rauvs ()texnxo3iodlpt lu o ( s2um(o iodllt  fvtl(fsrum(m ot1oet mf3iatlaDumnmsn(4tlermfciodla raivolt) eumir io4opt licsls) rraxmpnt4ape  feiad a umn pnt0trtnir3oy1fat an sls  euoio3iudolenmiei tf Duax  ;o1alxo i3ilt a ua(vs;()artoio3tytfaD au o;t0s2xr(opiydamt  nvia() rtaxmo;u1aex iociadlmDelnvp t4areoxo oo1lp  luvols  rtmxr oydll n ivi sf rurxr ;o4apxnmoeiadfs ra(vo t)texoxocia1lpD  u o t texoxm oo4lm e icilt arraur ;u0opeo o3iltfs ea( pnt0 lxrmo totfp e ues;t)trxoiopio4ome lieiasfs2rax  nu4oeen ieiydla2ulums (0tetomr3oa1oa r n il(  rur(r3nodlptelfciltf 2raurp;o4opt ifctad sDrmump t)texnir io1fateai s;t  rtmxopiy1lp elfvsasf Dur(m nt4tlen o3tat s rau onu4aetrxr3tytfpt anei;s)s2xo(m3ny4lmenmfcilt srtr(root0apen fetldfm2um( onu) etnmf3oytlpte u ils)setoxr nu1amenmicsasfa2umxr nt1tex mo3iad mDumn o;u0 lxrmf3ia1fat au s s)s2tr(o no4ol n fei t a2raxro;t0alxnmfetld sDulnms;t)texrxo3iadop r uvi t  2um(o ny1ll n nvsa()a2tmu  oo1aeeo ocilslaDumumo;u)trxrir3oy1op eluvolt0 2tr(o3ny1omtemieil( sruaurono1apxoif3iatfsDrmnmpn(0tlenmf oa1omD  ueol( texrxrpnodol emnvs sfarra(rono1oex  fciadfmDea(vpnt0 leomocoytfmt aneo s0teur(o iy4alee netasf rumur nu4oeto o3tat m rln pnt4texoir3tydfmtraues;t0t2tr(rpoy1ap elicslt srum(r ;t1optnmociytlsDuau o u) rtnmfcty1omD  ivs;t)tetmim3nydlptelfviltfs2ururoou4oleoio3tadlaDeluvo () rermfctadomDrlu i;t)srto(rpnu1llt  ncsas) 2ta(r ou4tleoioctys mDul(von()aeenxocoa1lpDrln o;t trxmirpnu4llen nvtl() 2ua(moou0olxnmo3iys m2ea(mo t4artnmr ootomD an o;(0srto(rpiy4aleelfei t)s2rax p;u0alx  ieias m elu p t4texrmocoo1opDeaivi ()srtoxo3oodlpe  iesls  rrm(mpnt4oex moetadlaDemnvp u0 lenmfcoa1laD  i s;s  2umim3nodap  lnctls  2rmxmpno0tlxomfctydfm raump (0arxnmr3oodlp e nes;t)trxr(mpny1olenlnvsl( aDua(rono0oeeoifeiadlm ea(vs;u4texnmr ta1lm eau sl() 2urxrpoo1omeemfvi t)s2urxrpou0apx iictytla eau s (0 renxrcio1fp rli o ()trxoiopiu4amt lfeiltfaDum(mpnt4teto i3ildlmDul(mpnu4 rxomo3to1laDe u ils)teuoirpiy1olte fvtltfa2uaumo;t1oetn ociysfa2umnmsnt)teerif3todlm raueo s sexoxopoo1llenlfvtlsfsrtmxront4optoiieildfa ea(ms;u4 lxrmo3totoa  livi;t  eum(r3oo1lme liciasf rtmxmoou0optn fetadla ra( p;t0teenmr3iy1fmt an i;t0trxrxr3ny1lle micsa( a2umxro;t4olxomo3tasfa umn o ()arxrmo3oydfaDraieo t0t2uo(o ou1op nmncia(fsrua( ooo1tpe mi3iydfa2rm( snt0aexoif3tatlaDr uesl() etoim3nudom emnei tf rrm(m ot4apxo ieiysfaDeaumo u0 rxoxf oadfateluvi () rtrimpiu1lmen ict t  2tmxro;o4tex  oeilsfsDrlnms t4aeeoir3oatfp e n ol()teum(o3ny1lp elieia() 2rru ont0aet  f3iyslm2eau s t4 lenmf ta1opDelies ( trurxrpoodopeemfeta(  rra(rono1oltnmi3tysls2uln s (4aeenirctydomtrli s t)sexmxm nudol  mivt s)sDtrx  nu1alxo fetytfm ulumo (0 etrifcoadlat  uvi;( truoirpou4omt lietlt)srrrum no4apxniietas s2rmnvo;u)trtnxr3oy1fptr neils seum(m ny4olee netlt)s2rrump;t0oexomoetat a2um( s;u0 rxrmrcoytopD aies;s)sexm(m iy1opt mncsls)srrm(mp;o0texo ictysfa2elu s;t)aeerifcoytop r nes;t tetmxr3ou1apeemfvtlt) rtaurpoo0aptomociatfs2eln sn() ltoirciydop ran s t s2tm(opoy4ap n fctltf rtrxmpno4tltniicild a emn s u4 etrifctotlp ranei t0texrimpno1lm nlictls)arua(mpot0olxomfeiydfm2rln o u)tetrmrcoy1faD anvils0trxmxm ou4omenmneils) Dtr(mo;o4oex iieilt s2uanvp;(4 eerxocto1fmtelnvs;(0 rurxo3iu4omen ivt tfarraxrooo4oex ifciydla umumo;(0trxomf oa1fa e ueo t)texrxopio4am n nvtat aDur(mp;t1tlt  ieiysls2elums t)texrxocto1la e ieol(0 2urimpnydomt miciat) rta( oou1oetoiieilsfsDrl( on(0 lenmf3ootoaD  u olt)trto(m io4omenmieils a2ua(r nu1oexn ocildfs em(vs;u4texnmo oy1oaDr nvs t0 rxrxrpnu4al nlfci t)a2rrur ot1alxo i3iysfmDrmnvo u) renxocoatfmtr n ol( truoxm3ou4alt  ies () Dtm(  ou4tpeo ocildfm uluvs;u)texnirciy1late iei;t)seum(r iu1lpe  nctlt aDrr( p;u0olx  feiltfs2eaumo;t0arenif io1omt anvi ( texrxrpou4optn ivsltfa2ur(ro;o4tex mf3tlsfm ua(mo ()arerxocia1lp e i i t s2tr(o3oudlmte nvs ( sDtrxmpnu4oleomf3iytfa emnvpn()arenio iytfm  lues;t) rxo(opiodaptelfvtas  rtmuroou0teeoii3iys a2uln s;() lerir oy1op  lnes;(0 eum(m3iy1am  lfviatf 2urxm no0aeeomociyt sDeluvpn(4 ltrioctatoa  auvi ( s2xrim nudal elneia( s2trx pno1olt  iciysfaDuan s t) eenmf3oodfp raues;t0 2umim oodom nmfetatfaDtmxm ;u1alxomietyt a ran p;t) reoio ty1lmDran ol(0s2xrim3iydoptemnesls srrmu pnu0oltnmo3iaslsDemnmonu0texrif3oodopt  uei;s0t2toxrpiydlmtnmnetl() rumxro;u0tptomieildlmDuanvo;u4 eenif oydoa r i s ( trxrxm3oudol  mfcia(fsDrmurono0alxomoeiydfsDumuvo;()altrmr iatopte i o;t)texrxr3nudlme  ies t  Dtr(mp;u4oex io3iydfs2uluvo t0 lxrir3oydopD auvo (0s2tmxrpoudll e ncsa(fsrum( pno0tex  octlt sDemumpn() etrxf io1omD  ivsls)sexo(r oo1ol emici s) Dtr(r ;t0ope ifeiat m em(msnt)altoircoy1opteanvi;t) rtoxopno4ol n fciasf rumu  ;u4aetoif3iatfsDeln o;u4 renxo3totfm r neils)teurimpoydam  mictlsf rum( ont1tltnii3tldfsDeluvp u4arxoir3iy1lm  lu i t0sexm(o3iu4lle lietat)sDuru  ;u1oltnmociydfs2um( s u4trerioctotfp rlies s0trxo(mpou1amee ict t)srumxroou0texomieilt m rlumo;t0texrxo tadfmtr ies t0s2xoim io4ap elivtls sDua(mp;o4aexnmo3iatfm2uau pn(0texoxf iodlp rln i;s) rur(rpno1lp  mivtltf 2uaum nt1tleo octysfa emnmo;(0trtnxf tytopteliei;s)s2to(r oo1lm  lncsat)sDtm(  ;o1tet  f3iltfmDrluvsnu)trtrmocoadom   nei t0 2tr(r3iu1lm  mncia()sDrr(rp;o1oee mociltfs rlums;(4aeeoxf3iy1opte i s ()truoir iudaltelics t) rurum ot0apto oeias mDuanvpnt4artrxf3iadoaDrauvs;t  euo(o3oy4am nmnci s) 2tru oou0ole ifcilslaDumnms (4tlxnmrcio1lm rlues s)texoimpnu1lpe lnctlt)arrru p;o1oexo iciytlm emn on(4aeeoiocoo1fptraivolt s2xr(r3oo4apt licilsf rurx  oo0oeeo ociyd aDumnvp t0alxoxrcia1fatraieols) etmir io1optnliesa()artru  ;t0optomf3tat s rmu o ()aleoxr iy1lat aiei t0t2xoir3ny4amt mivs t)sDraxrpnu1alx  feiasfaDuln snt)arxrif oodfmDran i t0s2uo(r3oo1lleelnesasf 2rrur nt0apxn o3ildfa ranmpnt4tetoxr3totla eai s;t)t2xmxmpio4lmt lietl()srra(m ;t4oetnio3tltlm2ul( p t0trerxr3iy1oa ran ol(0srtrxopiu1am n neia(f Drr(mp;t1tleo o3tyslm elu snt4alxnxr oo1fpDe uvi;s t2um(m io4ol nlies () rrmuront0aptomoctys mDumu s;u)arenif tytfpt li o t)t2umxo3oo1lltn ieiat) rrrx  nt4tlx ifetlslsDrl(ms;u4tlxoxr3ty1la  au i;s0srxoxrpnudameemivslt) 2raumono1olxn f3iyslaDumnmp u4aetrir3oytlat  neo;t) 2xm(opio1lme lnes (f Dua(mpnt4teeomiciltfs2ua( onu0 rtnxfctydfat  ieo t) exm(rpiy1amt  fes (fs2rrxrp;u4olxo octldlm emn o u0arxnmr iatlmte ivsl()s2xoxmpou4amte net s aruaurono1tltniociad mDuanvp t0trtrxr3iy1lp raueols0srtoxrpoy4lmtemnes tfs2tmu p;o1aeenmicild aDuan ont4arxomr3ty1lp   iesls0 rumxm oodopt lneia( s2rrur ;u4opt iietydfs ea(vs (4 ltniocoy1lat lieols texm(mpnu1lm e neias) rumumo;t4oetnmociytfa eln o ()aexoxf oatlmtelnes;s) rtoxm io1apen netl()srua(rp;t4tlx ifeiyd m el( snu0 rerxociytoptelivilt0 rtoio3nu4am e ncias)aDua(r ;o0ole moeilslaDrlnvpnu0 etnif oydopDe ivs t) 2umir nudaptn ivias)srtmu o;u1tpeoifeiad m2el(mp;t)trtnxr3tadop  ln i;s)trtr(r3nydam elicsa(  2rmxmonu4altn i3iadlmDeauvonu0tltnio tatlp  luei;(  exo(opoudllte icta()s2rmumpno4aetn o3iydfm2uanvo;u4aetrmo3tydfp eluei ( trtoxrpio1lme mnesat)a2uaumont1oleoifeiad a uanvs;(4 exnir3oydomD  uvo;t s2tm(r nudop e ici t)s2uaum ou1oexn ociasfa rmnvo;t4 lermr3io1oaDeaneo;s) 2um(r3iu1lpte ivsa() ruaum nt1oetnif3iadlm2uluvonu0alerxo iotfp eai olt  rxo(m io4omee fet ()aDumu  ;t1tlenmf3ilsfmDrlumpn(0 eeoxf ta1omDrln i (0 2umxo iy4ol nlnvi (faDra(  ou1alxn icilt a rauvsn() rerif3tatlaDrauvo;(0trxmir oo4altelicslt)a2tax o;u4tlt if3iltlaDuau p;()aeermf oydfmDeluvs s  euoxr3iudom  mictl() 2rm( o;t0aetomoeilt s2um(vo t4trtoio oytoa  anvo t0truoio3ny1amenmnesltf 2umu ont4aee  iciltfs rm(vsnu4aetrxr3oadlaDr uvils) rtoxr3oudolenmncsl(faDrrumonu4olenmfctlsfm2ua(mpnt0aleriocootlpD ai ilt0s2xmiopnu4aptnlfcs (fsrrrump;u1alx  oeiydlm eanmp;u)aeermfcoy1fpD  u s (0trxmxrpoy1lm  mfvsls)srumu p;o1apto fcildfaDumu ont0altrif3ta1omt aivo t s2triopoy1ome lieia(  2urum ;t0alxnmieiat s2ulu sn(0aetoxf3ty1fmtr nvo;()s2xo(rpno1al nlfvsat)s2uaxr nt1aee mo3iyd sDrl( s;(4trtnmo3tadfpteaivi;t0 rxoxm3oudom   ncta() 2rrxrpoo4olt  o3ild m2rlu p (4trxnir oydlmDrai ilt srtoio3nodope mfeil()artm(rono1optnifeiytlm ea(ms;t4aexoxf3ootlaDrlneo;s t2xoxr nu1amtnlfcils  rur(r nt4tet mfetldfm ea( s t0alerxocio1fpt livs t trxoxopoo4llt  iet s) rra( oou1olen fetysfm2uaump;u4 ltomociadfpDraneslt0 etm(r3no1oleemnvtasfs2raxr ou0alxnmieiltlm emuvs u) ltrxf3oytopD  n ols0seumim iydopeelfvt ( s2ra( pno4tle  feiaslsDel(vo;()tleoxr3ty1oatranei s)trtrir3oy1op  mnvtl(fsrum(m ;u4aexn ictytla eanvpnt)trxnif3tydomDr nei;t) 2urimpoo1amee fvtat arrm( pou0apt mf3ilt mDeanmo;u4aeenio iatlatelnvi;s s2toxopiu1ap emnvsat a2ur( p;u1aex  o3iyd a ea( o;t0trxomf oodopD  n i;()seuoxrpny1lmte nvias) rrmxm ot1oetnmi3iasfs ul(mo (4artnxf to1oaDeanvi t teurir3io4al nlfetls)a2tm(  oo0aptnmo3iydfa2ua(vont)trtoxf3todfmt  ues;t)trum(rpiy1aleemieilt  Dtru oot4aexomiciaslm um( s;u4 lxrir tadlp   nvo;t)s2xoim3iu1ol emiet t) 2rm(rpnt1apxomfcilt s2uaumsnu4treoxocoatopDelivil() 2xoxrpnydale  nvsltfaruaump;o1tee mo3ilsls ulumpnu4teenircto1lpte uvsl(  etmio oydolenmnetatf Dtmxm ;o0olt iociydls eanvp;u0 lxoxo oo1lat anvi (0 exrxopoydomtelnet s sDuaxm no1open f3iaslm2ran o ()artoifcootfp e n i ( t2xmio3oy4ape  nvslt)s2rrump;o0tpe  oetyt s2rl( s;u0altnmfciadoate u i (  rurio3nydop nmivs s) 2rau onu0aexnmi3ilslmDuauvs t) ltomo3tydlpDean sl()trtr(o oodapt  ies t artm( p;o1aleoiietas s2elu o u4 rxrxrctadfaD  n sls)sexmirpoudole lneil( sDuax p;t4aptnmfciyt a ea(vp;t0tetoxo3io1fmtrau s;(  2urxrpoy1op nmnet t aDua( pno4opxnmfeiadfa2ea(monu0texoif tydlmt ai s ()texrxo3iydlltemnesls a2ra( poo1tet micils sDea(vs t) rtnir tydop   ies (0 2xmir3nu1lp n fesatf Dtr(rpnt0apt  f3ils m2emuvonu0 ltoir3ootopD  i ils0 eum(opiodopenlfciasfaDrrxm nt0tet  icildls ul(mo t4 exnir3totop   n s s)t2to(r ou1op elicilt aDtrx pou0aet  ieiatla umnmpn()altoircoodlmDeliei s t2uo(mpio4ol n nesasfartmumpou4tet mi3ildlm2uaumsnt4 rtoif3tatoat  u i;t)s2xoxm3oo1oleemietas)sDrrurpno0tlxoif3tld a rl(mo;t0areoxo3ootlmDranes;()trtrim oo1ope  fciat aDrmxr nt0aexoioeiydlmDran p (0 etnxfctytfm rlnvo s0s2tmiopny4lmeelivia() Drrurpou4oet mo3iadfm em(vp;u4altnmo3iodlmt  ueo;s0trurxrpnydalee fvt tf Dtau p;o1aex  ieiysla2ranvs (4tltoxfciy1fat  u i;s srxrio3oudlmte nvs sf Dta(rp;u0optnmf3iatls2rlumo;u0trxrxf totlmDelnvols  rumxr3no4opte fci () 2ururpnu1tetnmicilsls ranms;u) exoif3oy1fptelieo () rto(m io1lm  mnctl(  rtm(m nt4tpxnmociltlmDulu sn(4altnif3io1optelnes;(0trxmxopnu1llt mnetlt) Dtm( pou4altomfeiydlm2ulnmsn(0alenxo3ty1lpDe u o;()s2xmxopiu4oltnliei tfsrraxro;o0ole mfetyd m2rlu o (0trenxo oa1lateanvo (  2xr(r3iydame lfvsat arrm( poo1olt ifetadls2ulnvo ()aexrmo3oydla ran s t0s2umxr3ou4am  livtls arua(ront1opxn fetasla uanvp u4arxomfcoatfm e n o t0 rxoxopny1ll nmfctasf 2tm(  nt0altoiiciatfm uauvpnu4 exomrcio1lmtr uesls0truoim iu4lm   ivsa(farurxr ot4tlenmociatfa uln pnt0tetrir tytlp  lueo;t  exmiopiu1alenmieils)s2ta(mpot0ope mfctlt a2ra(msnu0 ltrmf3iotop e nvo t0truoxm3no1lmtemncsl(f rtmx oot1aetomfeildfm2umn onu0trerif iadop  livi;() 2uo(mpoodamt  ict (faDrr(  ;o0altomo3iltlm2ua( o (0aexnio oadomteau o s)t2tmxr no1lmtn ictlt)artrxmooo0alxniociyd sDuan p;t)tltoio3iadfateaues ( trxoxo iydlm emfci ( a2ra(m ;u0oleoii3iatfm2elnmo;t4 exrxr3iy1opt lnei ()setoxo no4aptn ivs t)srur(mp;u1oet iiciltfaDul(mp (0 ltomr3iodoaDelues;s)setoir3nu4ale  neiatfsrtmxronu0tptoiocias a2rm(vo;u0aeeoxocia1latrlneils0t2uo(m iu4lp emfciasfsrrrumooo4ole ifetydla ulu on() rermrcio1lp elu i ()trurxo iu4optelnvt s)aDua(m ot1aptoiicilt mDelnmont0tlxrxr3tytomt lnvilt0setoim iu1aptnliviltfsrrrur ;t0ale  feild m2rlnmo ()tlxnmr oydoa  aivi (0srxoxr iu4open fetl( aDrmurono0aeenifcias m2ra( p u) rtrmocta1fpDranei;s0 2ur(m ny1lle mncsa( s2rmurpou0apx if3ild s2eau ont4 leoio3iadlm e nvols)seur(m3oy1lm nmfetas arumx onu4oeto i3tltlsDuluvo u0 exoio3oydfateln i t0 exrir no1lmen icil()s2rm(r no4oetnio3iad sDumnmo (4 rxrir tadlateln o;s0tetrim nudolt mnesa()srtrx  ;t1alto f3iydfm ua(ms;t) rtnifctatfptrlieo t0 eum(r nudlmenmfci t sDurump;t4alxomoeiydfsDrl( pnt)altnxoctotom   neilt0srurir3iodomtelietatfsDta( o;u0tltoiocils a emn sn()arxoxrcoa1om e neilt) etr(r3iy4ap nlfcia() 2urxront0teto oeiaslmDrmuvp;()teerircoo1op  livol()s2xm(mpno1om emfvtl(f ruau p;u1alt ifetyt aDem(vp;u0tltrir3iodop r n s () rumxmpou1lm  lfeiat a2tmx ont0olxnmoetlsla el(mon()tlenmo to1op elivs;(0 etmxo io4oltnmfct tfaDrrum ;o4texn oeildls ran on(4alxrifcta1optrlivsl(  etm(m3io1omte fetltfaDtrx pno4ape  ieildfm emu s t4altomf3ootfa elivil(0setrirpnu1lmte ncilt  2uaxro;t0oex ifeiyt mDua( s ()tlermf oy1lat aneo;s0setm(m3nu4omenmfvi (fs2uau ono1aexniiciytls raumo;()tlermocoodfmte ueil(  2uoio3iodom n fcsl()s2ra(  oo1altn o3ilt sDem(vs;u4 etoxo3oytfateliesls0 euoxr3nu4ol nmietls)sDtrur ;o0aet moeiat s2uanvsnu0 rtrxr oatlatranei;s0t2toim iy4am eliesa(  Dtrum nu0alxnmieiltls2eanms;t4 rxrxoctatfp ean ilt  euriopnu4lpee fvs t  2rmxmoou1ope iicildfaDrlnvpn()aetomrcty1optr neol(0 rxo(r3no4lmtnlfvsls s2uaxr nu4apxo ieiydfaDulu sn(0tlxoxr tydlptelu o t)seto(m3oo1ll   fvtatf Drmxrpnu0tltoio3ilslmDrmnmont0 exnxfciotfat  i sls  2tmxm oo4ol e fetlt) Dtr( pnu0tpeoio3iys sDuanms u0tleoio3ootoate ies ()t2urxm3nudalenlfvsls s2tru  ;o4tet  ieiydlaDrmnmsnt) rtrif3totopt lieo t)tetrxopou4olt lietls a2ua( o;t0aetn ieildlm raumsnt0 eenmr3oo1oaDe ueo s0teurir3io1alenlfvi t aDrruronu0tlx  f3tltlmDrmn pn()altnmrctadom  aueo;()t2trim3iu1olee fcslt aDua(r ;o0open ietas s2ul(vonu4tlxnxf totfmDrluvo t srxoir3nodlpe lncsas)artaxrpno1tlxniiciyt a elnvs;t4aeenio3todlateaueo t0srtmxo3iodoltelfei t) rrmur ou4teenmf3tas s ea(mpn(0trxnifctydom   n ils)setmimpnydlpeemfes (  2umum oo0olt  ietltlaDum(vo;t)tetrio iydfatr uvi;t0trurxopnu4lp emfeslt artrxmpot0tpt  o3iyt m ul( p;()aexoxr3iy1fp   u o s0 2trimpiy1ame livs ()arrmxr ;u1aleo f3ild a2emuvo;(0 etomr oa1oaD lu o ()sexmirpio4lmeelietls s2umu oot4apxnmfciatlm2ran s t0 etrif oy1fp rln s t0 2tmxr io4lpeemnes t s2umxmpnu1tet mocildfm el(ms;(4 lxrif3iytomtrlues ()t2xrio nydolte ieil()srurxmonu1opt mf3iys s2umuvs (4aetnir iy1lateli sls) etrxopoy4ale  nci tfs2trump;o0tpenmiciys a2umnvp (0arenxr ia1fate ieilt  eumirpny1lm emnctatfsruaxrpnu4oee mf3tydlmDelnms (0aeenxf3io1lpt lueo;(0 eumxr oo1lpeelnesls  Durxr oo0tlxoiietasfa emn ont4trxrxo tatfaD an ilt)t2xrxm io1om nlictasfsrua( p;o0aex  o3tlsls el(mp t0artoif3tydfateanvils trxoim3oo1ale mfeia()aDtm(mpnu0tpto feiadfs rm( s u)altnxf3iatfm e nvi (0s2uo(r3ou4lp nlnei ( a2tmxrpou0optn o3ild m2ranmsnu0 lxrif tatlaDr ieilt)srto(mpnu4opee nvt s  Dumuroot0tlto fetydla2ua(vp;t)tltnmo3oytlmDeaiesls0 2toirpiy4lm e fcsltfartax p;o4ole ii3iatlaDeln p t)arenio oydlpD li s t0 2urir nu4oltnlnvt s aDumumoot0apxomociat s2eln o;(4alxnircoodfp  li o;s0texoxrpoy1ll   fviasf rrau  ou0tle  i3tadls ra(mp;(4 ltrxr3iotopD lu o t0texr(r oydameelfetat)s2ta(  ot1teenmfciatfsDul(ms;u0tetnmr oydfa  ai ilt  eum(mpno4apt mnci sfsrra(mpou4tlxn fctltfa em( o () etnmo iy1fptr i s;() 2umxr3oodam nmfvi tf 2trxm ou1texnif3iytls2ra(mo;t) leoxo3oydopDrauvo t sexmir3nodap  lfeil(f rrau  ot1tltoii3tytlaDemumonu4 lxrxr3tydfateaivo (  exr(mpoydoptnmnvslsf Drax oot0open i3iys a ul(mpnt4tlxrir oydlm  liei;s) 2uoio nodapenmfetlt sruaumpnu1aleniictydlm ra(vs;()tltnioctydfpt lneolt0seur(r no4lleemfvt t s2tmxrpot1alx ii3iadfm uanvo u0tetrif3oytfpte i ilt0t2tm(o iy4om  miesl()srrr(mpou4apenmictatls2umuvs;t4tetoio3tydopDraueil(  2umirpno4alt lnet t arra(rpou1aeeomicilt m ran o;u4aeenmfcoy1oaDrauvo t s2xrxrpiy1ap  lfvtls  Dtmxr nu0tpxn fcilslm2emn p (4tltnxo3iytopt li o s trxr(opoydlpte neslt)sDuau poo0olxn iciytfa2rl(vs t0arenxo oadlp  lu o s  2urxo iy4apt mivi s)s2ur(mpnu1tex moeiytlaDrmu p;(4trtoif ootlpDr uvs s)srxoxo oo1am e nes tfs2ur( pot1aexoif3ils sDea( onu)tlxomo totfat  ueils)srxoio3no4lmtelncsl()srtmurpou4alxomi3iydfm2rau s;(4trxoio iadlpD  n i t  2uoirpny4lp n fctl(  2raxmooo4apto feiad m umn o;u4trtoir3todomDrai ilt  2trxopio4lm n ivt s) rrru pno4aleo oeiltls ea(vs t)trtoxo oydfatranvs;()teur(r3iu1omtnmivtat) Duau  ;o1oexomfeiys s2elu ont)texoxf3oatom  ln s;(0srtm(opnudoltelneil()s2tmxmpno4aexomoctysfs elu on(0altnmf3oy1op   u ol(0t2to(o iy1lme lfctlt)s2rr(moou0aptomfeilsla rlnvp;t) rtomfcoodoatrlu o;t  2xmimpoy4omtnlncilt)s2raxm ot4apx mf3tltla ra(vs;u) leoxr io1lp  li s;t s2xo(o nydolen fcs tf Dtr(mo;o0ope  iciatfa2umuvs;u4 etrifcia1lpDrlneils) etmir nydaptnlici (f Duaxmpno0olxomi3ias a2em( o t4alenmo iydomte i o;() eto(r no4alen netls a2uau  nt4tptomfetas aDuanvo t0 rtrir ootfa  lieilt0 rxr(r3ou1amt mncs sfsrurumo;t0tptn ociysls rlnms;u)tetriociytopDr ivi;( seurio iudlpt mfes s)srtrx pno1tpxo i3tlslaDul( snu4aexrmfcta1opt luvols)teuoxopno4ope mfci t)artmxm nu4tlt moctadlsDuauvo;(0alxoxociytfatean o s) rtoxrpnudap nlieil(f Drrxm oo1tltn i3tlslmDelnms (4 lxnioctatomtr n i (0seuoxrpoo4lm elict s  2rr(ront4tex ifeilt s2rl(mo;t) lxnircty1fmtrau il( s2trirpio1lm nmictl()aDtrxrpoo4aet mfciyt sDrmnmp u4tetrxociydfmt  ueslt  rtm(m3ny1ol n fes sfs2tm(mpno4opeoif3iadfaDemu p;t)tetrmrciytlptrlivs t)trur(o3iudopte icslsf Dua(mo;o1olxnmfeiltlaDrlump;u4texrmf3oo1omteaivo ( s2um(o iodlpt lnvsls)s2rmxr ;o4apen fctlt s um(vs (0trtnmo tadom e i s;(  2tr(opiu1lmtnmfciat  Draxrpnt4alto oeiatfm umuvs (0tetrxo iydom e n s t0 2xrim nudlpenlfeslt)a2um(moou0aeenifeiyt sDranms;u0 eenir3tatlm   ues s) eur(m oy4ape lfctas  Dtm( o;u1texoifetytfs2rln p u)tlxoir3ty1latelneols s2tmxmpnu1om n nci sfs2tm(m ot1opto iciaslsDrlnvo;()trermfcoo1lptr u o ( sruoxo nu4omtnmici () 2rrur no0oleomictad s emuvsnt)trtnxocoodfaDeauvo;( teuriopiodamenlfcs (fs2raxmont4oleoiicild sDuln s u0arxrmf ia1op eau olt seuo(m oudol elnvsa()a2um(m ;t4apeo o3ildfa eanvs;u4areoifcoydlptelu o;(0 2uo(mpoydolt lnvsls)a2urxrp;o0tpt io3ild m2emu p u) rtomr3to1lp eluvs s trur(o iu1ap nmiet s srrauronu1teeomociatfaDrlu p;u0 ltnxo3iadfate n slt)sruo(m3iu4optnlnesl(  ruaxro;o0texo ieiat a eanvp u) rxrxo tytop  anei (0tetrxr3iodam  mnvsa(fs2rr(rp;u0tltnmfciysfm2uauvs t) rxnir3oytoptrluvs;( s2xoxrpnodllt  feils  Draurpoo0teeo feiasfaDulumpn(0aetrmr3oytlmDranesls teumxmpiu1al  miesl()a2tmu  nu4teeo iciyslm2emuvp;t)trermo tytfm rauvo t0 ruoxm nudalenmnci tfarta( o;o1alto ieiltla ea(vo t)artoiocoy1fmtrai i;t sruo(o ou4lltelfctat)sDtru o;u0opx ioetasfaDrl(vo (4 lxoxr oatomtrlu i;t)trxmxrpiy1op n ncias  2tr(r ;u1opxomo3ild aDemnmpnu4tlerxr tydfaDr nvilt0trtmxo3iy1op elfcias) rumxmpnu1altomoctyt m2emu p (4trtnir oodoptrlneo;t0t2xr(r3nu1lp   ncia(  2umu pno0tpenmfciys m em(monu0treoxf oytfaDr nes;(0sruo(rpny1lptn nctlt) Dum(  ;u4tpenmictlsfs2ranvo;(0 renmr3oatfa rln ilt0t2tmim iy4apeemiet s srtm(m ;t0apto feilsfsDrln s;u)tetrmr3oa1lmD lnvslt)s2umxm iu1lltelfct ()srtaxmpoo1alt  ociysfa2raumon()alxnifctadlptelnvo s0 rumio3ou1lp   nvtlt  rurx o;t4tetnmieiaslsDean s t0aetrmfcoatoa raues;t0seumio iodapee ivtls)srrr(mpou0alx  fctadfa uanvp u0tetomocoatoaDe ieo;(0srto(opnudlpt  nci (fsDum(moot1texoii3tlt m ean p u4trxniocto1fa raneols  exmxrpio4om e fvsas artmx onu0tee  ociatfsDem( s;u)arermo iotfa  aiei;t t2tm(r3oy1lmee fci s) rra(ro;u1tpen oetatls2ua(vp;t0 rerir3iydfmteluvi (0seuoir oo4lmenmnvtl() rtrx  nt1oexoioeilt a2ra( o;(4trenxoctytlpDrlnvsls0t2umxr3iy4optnlnei s  2rmu o;u4altoioetldlsDuluvs t0trxrxfcoa1fa r u i;t0 rur(m3no1openmnciat) 2tmxm ou1tpe micilsfm2umu snu0 lxrxf3oadfp eln o t)t2tm(m3iy4lp emnvsas  rtrur ot4alen o3ils m2uanvs u4texrxr3tadfa   n sl(0t2ur(opny4apt  net sf Dur(mooo0oex  ietltlm umu on() rxomr3iatfpt lnvol( tetoio3oudllt lfvtatfaDta(rpou0ole  i3tls s2emn o;t)alxnif io1la  auvils setoxm3oodlmenmivt s srur(r oo1oexomieiydlaDelnmp u0arxrxo3ta1oa   ivi;(0s2trxr3iudalte nvtls  2rr(m ot1aexo o3tad mDem(mont4 rxnxr oydlmDr u ilt sexm(opnudllt  iet ()s2rax p;t0tee  f3ildls2rl( o;u4aetoio3oo1omt livsls seto(opnu4lmt mncilt)s2taxmonu1tpxomocilslsDranvonu) etnio ootlatelu i t t2um(r3ny4omee icsa( arrm(m nt4tee ioctyd m2emu o;t0tetnmo3oodfpD  n o (0 euoio3ny4ol nlfctl(f 2uru  ou1aee moeiltla ul(mo t0trtnxociadfaDrliei;s) exrirpiy4oltnlncs ( s2rmx o;t1opxnifciysfm ra( sn(0tlxnxocta1lat anes (0 eurio3iodlmtemictltf rra(mo;o1oet ii3iad s ea(mon(4texrxf3iydfaDean s;t)srxmxm3ou1lpenmiet t)aDtmumono1oet ioeiltls elums;()aleomo iydfa   uvs t teuoimpoy4lp  mivtlsfarrrxro;u4alxnmoetatla2ulnmo;(0altrmo totom   nes;()srxrirpny4ll n net s) ruaump;u1opeo oetatlm raumsn(0trtoir oatlpteaies;s0t2xr(mpno1om emncsl()srrmu pot0oleniictas m2umumo t0artnxf3iydom rauei;()trur(rpoodlm  lfcs sf 2rr(moou0oee  iciyd a2ra( p;(4alxoircto1latrln s;t0sexo(m3nudom nmieslt srrrxm nu1oltoioeiltfm2elums;(0 lenmfctodlm e iesls  euoir3nodame lfvt sf rrrum nt0oet mfetls s ran p;() exrxrciotopDr ues;t0tetmxm nu4ll emicta() 2taur ot4oleoifciasls uan s () rtoifcoadfmtrai o ( seuoxopnydam emfviasfaDua( pno1oetnmi3iltfs2um(vpnt0texoxo3iodoatr u i s)trxrxrpno4om elnei tf Duaxr ;u1apx moeiltfm uluvonu) rxoir3iodfatrluvol( t2toio3io4om emivils)a2ra( o;o1olxnii3iytfa2ua( s;u) exnir3iy1lpD livol(0 rtoio io1llenmncslt s2tax  oo0aee if3tldlsDea(vs;t) lerxo tytfpD  ivi t0t2xo(r3oodomeemfcs tf rraxmonu0aex mfetltlm emnmo u) etnxrcoydfmD ai sls s2uo(opoudlm nmnvt ( aDtm(  no4teenmictldfa uluvs ()aeermo iydlp raneo ( trxo(m ny4lpenlivtls)s2ur(m ot4oleomiciltfm ea(vo;(4arxoir ia1lp eln sls0 rtrio3no4al   ivs t  Dtm(rpnt1tpxo i3tys s ul( o;t0aexnmo3oy1fm  ln o;(0s2toxm iu4lmtn fct ( aDra(mp;t1tpx mo3tys sDrauvp t0tltnxo oadfm e u o;s teuoxopou1om e ivta()s2um( ono1olenmo3iydlm uluvo t0 lxnxr oo1lp rlivols0t2urimpnu4lltnlfei s  2ta(mont1opx ioeilsfm rl(mo (4 lxrmo oa1latelueo s0srurxo3io4lmtnlies s s2rm( p;t0oleoifciatfm2uan o ()trxrxr3oytla r uvo;()teumxm3iu1alt lfcsl(fsruaurpno0tpt  octasfm ua(mp;u0aexnircoa1lpteaneo (0teuo(o io4am n fvia() 2urur ou4tlt mieilt mDuau snu)texoio oa1fptrli sls0teto(o io4olt lncil()sDta(ro;u0ale  ieiat sDem(vpnu) lxoiociytfmD an i s0 2xrirpou1oleemici tfa2tauront1aee ii3ildfm2ua( o;(0teeomocoa1fmDe neo;t0seto(o3iy4lmtemics s)sDtmu  ot0tet mi3iyd m2em( o;u0trxoxo3iadfm elieo;t0s2ur(m3oo1apee ies (f Dtru pnt4apenmfeilt s ranvp (0tlenio iy1fmDelnvols  2tr(m iydlpeelnctl( a2um(mpoo0aexomiciyt mDeanmpnu0 reomf todomtelies (0s2xoirpoydaleelncilsfsDtrum ou0altoifeiasfm rlu o;t0 lxnxrciadlmD  i sl( srtoio3iudap n ncs t a2tm(  no0tpxoio3ild mDel(vpnu) rxoif ty1fat au o;s t2urim oydomtemics (f Drrur ;t4altnifeiyslm rmn s t4texrxo3io1fa r i i;() rtm(r3iu4apen fvia(faDua(mono4aexomi3iytls2ranvp;t0texrifcoy1om   n i;()s2ur(m nodop nmnvsl( s2ua(roou4tle ii3tydfs2emnmsnu) etrxr tydfp elnvi;s  rumirpoy1am elnes (  2ra( pnt0tlen o3ias a eanvp (0 reoxr3oydoaDeaiei ()trtr(m3no4olen ics ()sDur(rpoo0teeo iciaslm ulnvs u0trenio iatomDr u il( teur(r3iy4amt livt (fsrrau oou0tpenmieildla2ul(vsn(0 rtoir oy1omDelieolt0s2uoir3iudlptnmnvsas artru ono1olenifeild s rl(mo;u4tltnxr3oydfm   uvil(0seurxr iydapeelfetasf 2um( oot1tpto icils aDrmuvo;t4alenif iatla rauvo;(0t2tmir oudom e feil(f ruaumpoo0aee  ociadlm2ea(vo ()trxomf3ootfmteluvol()t2tm(r ny1al nlnesa(f rrr( ooo4teenif3tltfaDra(vo;t) rtrif3totlm eauvol(0 2uo(m3oodaleemict tf Dta(mono0tlenmieiadfsDraumon(0aexnircoytlp elneilt0 2xm(m ou1aptelfes ()s2rm(mpoo4aee iociadlaDrm(vs;u4arxriocoy1oaD lu ilt0 etrio iy1lm   nvi t s2rm(r ;t4tlto o3tyd aDrmn o () rtnxo oodlm e nvs s0texoxr3no4alee ietltfaDrauronu0oex mf3iys m2rau on() lxrxo oatoa  anvs s) rurimpno4ope lnvt ()a2uru p;u1oex io3tasfa2rmn ont0alerifcta1opt  iei;()t2to(m3oy1amee fvsa()srumu p;t1apt mfctls m rmumont) exnio iatop e i slt)sruoiopny1ol nmicta(f Drmx o;t1oexniicildls2emumo (0arxrmr iotlm   nvil(0trxm(opoo1lm elnet (fsrrr(moou0oetnmoetlt a2rm(msnt0trtrmr3to1fmDr n o;() euo(r ou1lpeelnet tfsDtax o;o0apeo i3tytlsDeanvs;u0trxoir3to1lptrlieo ( t2tmxrpoydlpee ies (fa2urumo;o0olt mfciatfa2ulumpnt4 exoxo iotfaD  i s;( s2xrim3ny1al nmfvt ( sDrau oou4oeeomfeilslm2rmump;t0teermo3tydfpteaneol(0 rxm(m io4lpt mncsl( srumxr ;t0alenmieiytls ea( sn() rtnif3iadfaDeluvs;t0s2tmxm oo1ol   fvsl(fsDuax o;t4tpxn i3iytlsDrmnms (4 lxnmrcootomD lueo (  rurxmpoydlm emnvia()arrru  ;t0apenmfciatfm2ea(mo;t) etnir3todomDeau o ( t2xmio3io1ll e ieta(f 2rrxmooo0openmociasfmDrmu snt0trtnmocto1optr u ilt)setoiopiu4lmeelncia(f 2tr(mpoo1openioctydfsDua( o (0aeenioctadfptrluei (0t2uoim3io4om  lfvt (  Dua(mp;o4opxn ieild a umn p;u0aeeoxociadom eaueo;( sruoxr oy1omtemnvsa()aDuau  ou1tpto fctadfm2rm( s;(0aexnirctotlmtrai i t  2tmxm iu1am elnvil()sDrmxm nu4oltomoeiltlm2rl(ms;(0alermfctatfmDr nvil()setrxr oo1al  lfvtl( aDrm( pou4apt mociltlaDrluvont4tltoircio1lpt au s;t t2uoirpno1ap n fesls)aDuru pou1tpeniociltfaDulnvo;t0 renifciotfaDe n i;s0teur(o3iu4al nlfciltf 2ua(rpou4tle mociysls2raums;t4aetnmocootom rlnvs t srumio3no4alte fetlt arum(r ot0oltomfetytfm ranmo;t0artrio oo1lat aneol()texm(r oudomt mict (fa2tmxmo;t1alt mociysls ul(mp;(0 rtrio io1lptrli o (0srumio3iu4altemivsasfsDumur ot1oee  ieiadlm rl(vp u4 rxnmrcoadoaDr n s;s)srxr(o nu4opt mfcs tfs2umu p;o0tpxnif3iadfm rauvs;u0arxnmrciotfa r ieo (0 rxoxopio1aptemfvsltfarrmxrp;u1oee  i3ilsfm eanvo (0treoxrcta1lp ran o s seuoxrpio4oltnmnctas  2tr(rooo0apxn i3tytlsDum( p t) lxoio oatop eluvil()seuoio3ou1amtelivs s sDraumpnu4apx ifctlt aDeanms (0aetnxrcio1laD  u ols)s2xr(r3iydol nlivt s) rrmxmpno0altnmo3iydfs umump;u) ltrif3oadlatelueolt sruoxo ny1lpt lncs (  Drmx  oo0opxnio3tat a rl( o u)tltrmf tytlate uvo (0trxoim ou1ol nmfes ( aDtmurono4alx  f3iadfaDrluvo u)tetnif3oatfa rauvo t0teuoirpiudamenmivtlsfaDurxm ;t1tlxo ociltfmDua(mp t0aeenifciadlate nvol(  eumxm iudom nlnes s)srrmxrono4aex  fetad m um(msn()alenmrciatlmt anei ()trtrxr oudlptelncsls)arra(m ou4aleomieilsfa2emu onu4trxoxo tadlp  auei ( texo(rpnodolt lncsatfs2tmu pou1aetoifetld m2ul( s t) reoxf3tydfat luvi s0s2xoirpoodol e icsat)s2rax  nt1olxomo3ils a umn o;t)areoxfctydomt lu s;s0 2xrxo3iu4apteliviat)arrm(rpou1opx ioctad a2rlnvp;u0tlenmfciytopt ln o;( t2tm(o3io4llt lfet s) Drr(mo;o0olxomicilsls2ulu p;(4alxoioctadomDe i i ()setoim3oo1amte ieiat  rrr(mpnu1tltomfciasls eau snu4teerxocoo1fatelu s;s t2xoxr iudll  mivils)a2uaurpnt0tlxo ieiadfm ran onu)tleomr3iydlpDr i ol() rxr(o iy4ameelfet (f rum(mpno4tpt  fciys a2el(vs;t4trxrmfcoo1lm rln s;s0 euoio ou1aleelfvt ( s2tmxm oo0tpt  i3ilsfs emumo t) eerir3ta1fmD auvil() 2tmxopou1ll   ietasfarta(rooo0oltnmi3tat a2rlumo t4 eerxf oo1oa rauvo;(0t2xo(opiydalenlnct (f Dum(mpnu1apeomo3iydfmDuanvs t) rtnmo oodopDraneslt0 rxmxr3iu4lpt lfvsasfa2urump;t1aexnmoeias s uanmo;t4 lermo iydfp e ieo s0s2tr(m3nudop   nctls sDrax  oo4tee  o3iysfm2ean p t) exomo3oa1lpDean o;s) 2xr(m oudomeemfvil(  rrmumpnu0olto o3ildls ul( s;(0trxoir iy1fat  nvo;s0tetrxrpoo1olenliesa(fa2umxm no1alenmfetlsfs rlnvs;(4texnif ootfpte ivo;t0trxmxm3oudllenlnctat)aDtrxrpno4opxniieiadfa2el(vpnu4aleoir iytfmDr u i t0texoxo oydom emiei t) 2rm(mpno0tpto iciad sDrmn s;t4tlxoxr3ty1oa elivi t0trxrxmpoodlle lnvtasf 2urxrp;t4texniieildlaDua(ms;t0 eerioctytoaD aieo;t  exriopiu1lltnlfvt t)s2tm( onu4tpxomfeiadlm2rluvp u0tlerxrcty1oaDranvo;s) rur(m nodlp elivi sfa2urxrp;o4tpx io3tyd m2ranvp;u4trenxo3todomDrluvs;s0t2toxopoodolenmfciasf Dum(mpou1tleoio3tys a rmu p (4 renmr3oodom ranei;t0teurim oudopeemfctl(fs2ua(rono1tltnmo3tlt aDrlu s;u) rtnxo3oydlaDrln i s) exm(mpnodape lncilsfs2tax  ot4tetnmfetlslsDuln o u4aexoiocia1fmtrluei;s0tetr(mpoy4optemivia(fa2uaxr ot4aet  oetyd s2rluvsnu)tetnir iadlm  au o;t  rur(o3ny1ap nmictls aDrruroot1apeoioetyd m rlnvonu0texrio3ty1oaD  u i s)s2xrxr3oy4olee icsls) Dua(mo;u4apt mfeiatlaDemnmp;u) rxnmo3io1late u s s)t2tr(opiu1lmenmnvt s)aDurxrooo4tetnmoctasfm2em( p (0teerxo3to1oa r n ol(0sruoio nudll   nesatfartaxr ot1tet  fciydlaDrau p;t0aleomocto1omt luvilt  etmiopoydlmee fcilsfs2urx  ;u1ape  ietasfmDrauvsnu) lerif to1om r ies t  exr(r ny4am nmfet (fs2trxm no1texoifeiatls emnmsnt0teeoxfcoy1fm eli sl(0setoxmpiodlle livil() Drrum ;u0ope  octydlm2emuvo;()alenxo tatlpDr nes (0sexoxmpnudopte ict t  2ra(  ;o0oltoio3iytls rauvs u) lenmo3iytopDr ies s0texm(mpiodomtn ncsa( aDuru  oo1aetoifctadfm rmn sn(0tlerxr oytomtraueslt tetmxopoy1om elnes t)aDtmu  oo4alt  feiat a2rlnmsnu)altrif3iydfm rln s (  2tmio3iy1lpeemnei sf rtrx pot4tpxnmfciltls ean sn()trtomrcoydlm  aues (0 2ur(o ou1lpee fesa(  rtmx  ;t4tlx ifeiyt s ua(vs;(0altnio ta1opt lues;()s2trim3iy1omtemfvia(fsDrrxrpnu0aptnmieiadlm2emnmp u0artrxo3tytfa  lues s  2uoir3nodlmtnmnct t) Dtmu p;u1oltoioctasfs2rmuvp;u) eenir totfaD ai i t0sexoxo3oudom  micil( aDum( o;t1aeeomictadfm2emnvp u) eenmf3tatlat aneo t0srxoio ou1optemfcs ()aDta(ro;o0texo o3tydfm2umn sn()tltrifcta1laDran s;( seurxrpnudoptelfeiasf 2trumpno1oeenmoctad s2em(vo u0teeoxo3oy1oaD  ueolt0 2to(opiy4ameemfvs ( srrmxm ot1olx mfeils a rln o;()teeomr3oy1opteaneilt seurio3ou4apenmnvtl()sDuaxmp;u0aetoii3iyt s2ranmsnu) rerxfcio1opteln o s  exmxr3oo1optelict t  rtm( oou1ale iieiytls2eanmo;(0 rxrmo3iatfpte neo s trum(r iudapt lnctatfsrraxmonu1aeeoiictysls2rlnvp;t)trxnmocoo1op   uvs s0 2to(opiudome lfcias) 2tauronu1aptn icildla2em(mp ()tleomr3tytopDr ueo t truo(m iydlm   ncsl( s2uaum ou0tetomociadla ra( p u0 renmfcoadlm e ues;t0seuoxopoodaltelfetl()sDta( o;t0tetn f3iad m ranms u0 rxnio3oadfmDrln i s0t2to(opiu4ol   ictatf Dtrxmont0tetoifctys m2rmuvpnu) rermo iotoaDrlieil( srxrxo ny1apenmnei s) rtmu pou1altoif3tys s uanmo (4altnio3ia1fa raiei ()t2um(m no4op e nctltfsrtax  ou4tlx ifciadfmDem(vs;(0altrmr3io1fpDrlneil()t2umim io4om  lfes ()s2ur( oot0oex  ictltfm rlu sn(0arxoifcoatfa eauvi s srtm(mpou1alt  iet ( aDtmu poo4tetomf3iydfsDrl(mo;t)aexoif3to1omte neo;s)t2ur(mpiudom  livsatfsDtaumpnt0altnii3iydfs2emnmo;u0 ltrif oydla elivo;t0 2trio3no1amtemfvsatfs2taum ot0ape mfcildfsDumuvp (0 eerif3iodfa   ivi s0 rur(rpiodopenmivsl(faDurxrp;o4tltn f3iydlaDuanmonu0tltnmrciatfat li olt)srurxrpno1ap nliesl()s2umx  ;o4aeto ociasfa el(ms ()arxomf3oa1lm   ies ()srtoio oudlltnmncias a2umumooo1teto icildfs umuvs;(4 rermf3oydopDelu i ( trto(m nu1ap  lfes sfs2rrx  nu0ale if3iltfs ulnvp;u4tltnif oydlaDr nei;t  2xrir oo4lmtnlfet (f rrr(rpou1opeo ociadfsDeluvp;t) reoxo3totoateli o ()s2xm(r iydllenmicilsfsDta(mp;t0ale  ietlslm2rln o (0tltnxrciatfpDeli sls)trurxopno1lltn fetlsf 2urx ono0oltn octldlaDrlump;u4 rtoxf3tadfm r i i s) exoir ny1altnlies s  ruru  ;u0apxomfeiysfaDel(mp t)aetomo3tatla  au ols)s2xm(r oy1optemnesasfsDua(m no4apxn f3tasls2uau onu4altnir3tydomt  uvi s0 rxo(opiu1aptelictltfs2ururpou1ope  fetld sDrmuvo;(0teermr3iotlmtraivi;t) rurxrpoo4ome mnvslsfsDrau ont1aptnif3tyslsDem(mo;u0aeenmf3iy1latrlnvolt) 2xmxo3no4ll nmneils a2ra(r ;t1tetnif3iasfs ua(vpnt4aetrif3tydfp  luvsl( sruoxm3iu1omtnmncias arra( poo1tle  o3iat aDrlumo t)tlxoir3oytfmtr nvs;t0 2tmxo3no1ameemfctl(  Durum ;o0tlt  octasls2rmumont4 lenmr iotlaD  uvilt)sexm(m oodlmtelneslsfaDraxrp;t1opx ioeiadfsDra(ms;u0 ltomo3oo1lmte iei;( srxoxopiudll nmfes tf 2ta(mont4optomo3tas a emuvo (4 exniociadlm e i i;(  2umio3iy1lltelicsls  Dtmx p;t4olxnii3ilt a eanvo t0 eeoxr3ootla  li o;()srtrxrpnu4amt mfvtltfsDta(mpnt4tlt miciadfm rlnmpn()trerxo ootomt  i s;s trtoxmpno4olen fesltfa2um(  no4oeenmociyt m rlu ont) exniocoadfaDe ieolt sexmxm3ny4ole lies sf Dtaumo;o0opx mo3iasfa ulu s;t) lenmo3tydlptrli i;(  exrxrpoodllenmfviatfs2ur(rono0aptomfeiydla2rl(msnt4 rxnmrctytfmDrlneils t2umiopoudoleemfvt t)arurxm ot1oeeoifetls s2el( o u0aeeoir iodfaDr i ol( trurirpiydllee neil( arta(  no4oeen i3tyd s ulu onu4aexrmr io1opDe u s t  2xm(m3nudope  fcslt) rtru  ;u4oexo fetytfaDrmu pn(4aeenio3to1fptraneil( teuo(rpny4lmt mfctlt aDrr(mp;t0olt ifeiydfa2emums;t4aexomoctytlp eln i s0tetrir oo1amtemfctl() rraxr nt1opto fetldfm2rlu s;(4artoxf3iatlpteluvi;(0s2trxrpiydal  lictlt aDtmum no1olxnii3taslaDeauvp u4 etrmociodop r ivi;t0trtoxo3oodll nmfcil( a2uax oou4opxnmfeiad aDem(vo u)aeeoifciydoptelnvi;s  etmir3iy4lmt mietas a2rmx pno1alx mi3tatfs uanvonu)alerxo3oadoatr ieslt tetoiopio4am emfcilt)aDua(rpnt1tex ii3iytls2umn o;t) rxoxr todfp r n s t)s2tmio3oy1lmtelfvtat  2tm(root1tetomi3iltfm ea(mo t4tlxnir3to1fp  aivsl() rtrim3nudapeemnvia()aDtmxm oo0opto f3tatfm el( p u4alerioctatopte nvs t  rxmxo oydolee ieias)a2tm(  ou1aexniieiat sDum(vs t)tlxoio totom eanvo s)s2urirpnu4apen feilt)sDtaum no4tlxo oeild m umuvs u0 lxrxr ta1la  anei;s0t2to(mpoudap  mfei s arururo;t0texoif3iatlaDea(vp;u0tlerxrciodfmDrlueol(0tetr(m nu1lp nmfci s) rur( o;t1tlt  oeiysfmDran o u)tlerifcoytlpt lu i ( srtr(rpiu1ale liesa(  Drrxr no0tpxomociasfaDea(msnt4 rxomf3iydlmtrlueols texo(o3ou1ap  mies ()sDraxr ;o0oetnmf3iytfm2ea( ont) exnxf3oodfpDe ueo s  2trxr io4ap   ivil(farrrx o;u1oexo f3iyt s2elnmp;u4trtomo3tydoptelivs;s0s2umxo nu1al e ncia(farrmu  no0apeomf3iys sDeaumpnt) rxnxo oo1lpD li i;() 2tmir3iy1ol n fci s s2rrurpou4oexn oeils s2em(vs t4alxnmo iatfatr ieols seuoir3oy4optnmivs t)srrrum ou0apx  f3tytfa2eanvp (0 rtniocto1lm e n i;(  exmxr3nu4alenmfesa(f Drmxm ot0teenioeiat s2uln snu)texrxf3oa1fm e nvols)trur(mpou1lm  livtat  Duaxm ;u4olen o3tatfa2uluvp;u0aleoxf todfmte uei s) etoimpiu4ole liesas) Dtax o;u4aexn o3ildfmDem(mo u)aetoxf oodfaD livi ()seumxopiudll   nvi t srtm(moot0olt mi3tltla2uan ont0areoxociydfp e ues;()s2xoxopiy4omtn fesl( sruaxmpoo4apto ietltla elnvp;u4teerxo3to1om r uvs t) 2toio3nydol   neilsfa2rrxront4opto i3tysla emu on()teeomf3iodomD lues;t)texmxrpno1omtn fcilt)sDrrum ;o1tetoifcils sDemnvs;t0 rermo oa1faD luvi () exrxopiu4lptnlivta()artr(mpnu4tee  oeilsfa2ul( s;u0tltrmo oodlaD auvsl(  2to(m3iy1aptnmfcsl(faDuax o;o4aptn ieiysfmDelnvs;(4trxoif3io1om rlueols t2toxr iudol e ictatfarrrxmoou1tetomfeiadfm umu o (4alxrmr oy1fpDrluei t0t2xo(m3nu4ll emnesat srua(  ;o1tpxnmi3tad a rm(mo u)trxnmf3oadfaDrlu s;( trto(rpoo4opt mnviltfsrumxm ;t1apt iociadlmDrm(vp;u4arxnmf3oa1fatr i i;(0s2tr(rpnu4ame lfvs ()sDraxm ;u4aleoifetysfsDeau o (0 etoxf oadoaDranei;t)s2trxr ou4om e feia( a2rau onu1apenifcils s2umu p t0tltomfcoydfmDeluvi;t  2ur(rpou4amt mfvia( srua(rpnu4oexomf3iltla2emnvpnu0artnif oadfp elnei;t trtmxo3oo1omenmictls aDrm(r oo4alxn oeiytfm rmnvo;t4alxoif3oo1omt  n slt0srtrim3nudlme mieilt)sDtrxmp;o0apxn o3iad m2el(mo;u)arxnxr oatlm eau o;(0 exm(r3ny4amtn nci s)aDumx  ;o1openiiciasfm2ran s t0 rerxf3to1lpteli s;s)sexrxm3iy1alt lics (fa2taurp;u0tle io3tlt m2ea(vp t0treomf3oytfm  aivi;s  2tmir3oo1al n iet (  rtm(mp;o4apto oeiadfmDumn pnt4trxoifciy1lpDr u s ()t2trir3nu1lpe lnet s)s2rm(mp;u4oee mi3tat m2uaums () lermf oydlp elueo;( srxriopoo4llenlietat  rtrxro;u0opx  ietad m2eln o (4altoxfctytlpDeln il( sexmxrpny4omen ncs ( sDtmurpnt1apx mo3tatlaDraumonu)teeomocoa1faDe u o;s)s2xoir ny4lltemnviasfaDtmxmp;t0tlxoiiciydfm emuvsnt)aexrxf3iy1oa eli ils)texmim3nudam emfeia( s2umu pot4alenifeildlmDra( pn(0aeenmf3iytlpDe i i s s2urir iu4lmt  ict ()a2rr( p;u4opxnioetytlsDumnmp;u)texnxr3oadoat  n i;t)srxr(o oo4lpe mnci ( artrxmp;u1tltomo3tlsfaDelnvs u4 rerio tatfa rauvi ( texo(r3oudlp   ncs tf Dumx  ou1aetnmietldfm2um(vpn(0tlxoxoctytfmtr i o;t0 ruoir3no4lm  mnvtl()a2umuronu0olt mi3iatlaDum(mp t0teerircto1oaDelivs t) rxoxo3iudap n ieta(fsrraurp;u4oexomoetadfm eauvs u4aeermrciotfpt  uesl(0t2toir iydoptnlnvt s)s2ra(  nt0alx  oetadla2ea(ms u0alenmfcty1opD lneils0 rxoir oudll  miciasfarua(ront4openiieiaslm ul(mp;()tetoirciydlm raieil()trumxr3no1omte fcsls) Drru  no0apxoifctltfs2uanvont4 leoifctadlpD liei;()t2tmxm nu4om   fviatfarumx pnu1tle ioctytlm2elnvonu)tetoxr3todlmte iei t  rtrirpiu1lle lnetlt)a2tru o;u4altn ocildlm2umnms (4 lenifcto1oateanes ( seurxmpnodllenlnesa()sDrr(r oo4opx ii3ild sDuanmsnu0aeenif tytlm eli o t)sexm(mpiodoptnlics t sDrr(mpot1tlxnioetyt s eau s;t4alxrio iotfm  aieo;(  etriopoy4omtnlneslt sDurxmpnt0tpe iietltlm2uaumo t0texnmr3ta1faDrliei;t)teurimpno1alt mfvtl( a2ta(moot0tpen icias sDulums;u4 exnmf3oytomD aneo;s0srxoxo3no4ll n iesas s2um( o;u0oee ifeiydfm rlnmp (4trxnxr todomt ai o s0teuriopiodoltn nei tfarrrurpnu1olenmfeilt sDranvon(0 eenir oodoatr ivs s)trtmxr ny1ape  ivt s)sDrmxm ;o1tpxnmi3iydla ra(mo;(0 leomf todfatrli i t0s2umxmpnydom   neilt)s2rmumooo1aetoioctytfm2emnmsn(4altoir3tydfp raivi s)srxm(opnu1am emies (fsDur(rpoo1oeen fciysla2rlnvont4aetomr oa1lateanei s seumxrpny1opeelnvtatf 2rr(rp;t4oetoifetysfs rauvsnu4trtoxr tadopD lueo (0teuoim3iy1altnmfeils aDrmxmpnt4oetnmfeiadlaDranvs;u4 etnxfcto1lpt an o;()trxm(o3oy4ole lfeia()aDrau pou4tpenmf3iytlmDuanvpn()tltrxfcoydfate ieilt0srtm(opiu4aleeliciatfaDtaxmo;o0apxo oeiltlmDrm(vp;t) rtnmr tadlm  aieo;t)setmxrpnudomt  ncia(  2uaumpou4olto fciatlaDuau o (0 ltoifciodla r nvs;t srtriopnu4oltnlncta()arurxronu1oeeo ietlt s2elu snu)trtomr3tytlp  lu s;s  rtoim3iu1lpeemfvs t srraxr nt1tlto feilsls eauvpnt)aetnmrctatomt auesls trtmirpiudoltnlfvsl()srurxr no4ope  ieiadlmDeln o;t0alxnmocoy1lm r i ol() rxoxo io1al nmivias a2tr(  ot0tlxn oetas a2eau o;u)tlerxo oa1fmtelnvo t0trxoxr iydomtnmnvil()sDurx oou1olenmf3iatfa emums;u) exrxr3oa1lm rluvo;t0trxrxr iodlm  liei ( aruaxm ;t1tex mietydfs2emn p (4artrxocoo1fpDeaneslt0t2ur(o ny4lle  nes sfs2ta(mp;o0ope  oeias sDeauvo;t0trtomr3iadfmteau ils  exm(r3ny1ap nlici s sDtmxr oo4altnmoeiyt a uln p t4tetnxo3iytla eaivil(0s2trim3iy4ape liei ( s2raxrp;o0olenmictadfa ranvo;t0trxnxo3oytoa elies;()teuoxm3nydapee nctas  Drm(m nu1apxo feiatfa rlumont0trxoirctydlateanvi (0 2xrio oy1lp n ictl( a2ua(r nt1aexn fciadfm ean p (4 ltrmo3ia1omteau o s t2xrxrpoudapeelivta()arrr(  ;u1aexnioetadlsDelnvpn()aeeoircia1fmt  uvo;s t2urir oy1olenmncs ()sDrauro;u1aexomietytlsDemu p;u4artrxo3iodlp elies;s) rumimpiudlptnmfes () Dtmumoou4olt mfctys a uau snt)altoif tytlp  ln i;s)teuoio nodlmt lieslt  Dra( oot1openioeiadla2rlnvsnu)tltnxfctadoateauvo;()t2xmimpoy1lmee fesa( aDrmum ;t1aexoii3ils m2uan s t0alermoctydomDe uvi;t0texrxopny1lpeemnesasfsDtrxmpot4altomf3iatls2rau p u)aexrxf3todlm  li s t tetmio oo4am  lfetls)srrmxmo;t1apxoif3iltfsDuanmo;t)trxoir oo1opD li o (0srto(o iudlltnlicils  rra(ro;u0oet iietasfaDuanvs;(0trenmfctatop e uvo;s0trxrimpiydol nlict (f 2rr(  nu4oetnmfcilsfa2ua(vsnu)areoxrctodopD ln o;s) eumxr oy4lpt lfvil( srrm( o;o1optomf3tyslsDeln p (4teermf3to1fpD  ueo;t t2trxm3oydole  netasfs2ra(  ot1opxn i3iasla el( o;u4tlxrxo tatopt luvilt)t2xm(o3ou1ape mfcil(faDtmur ou0aptomo3iltfs em(vpn()alxrxo3oodla elnes;t0trtoxm3iy1opt mfeiatfa2rrumpnt4tetoioctat aDra(vs;(0alenxr oydlatr nvsls)truoir3oudol n fetl( sDtrx poo0opx ifeilsls um(vs;t)alxoio3tatopDeai i s s2xrir3no4op   netlt)s2raxr ot0tlx  icilsfa2uln pn()aetoxr3oy1oateaivilt  eur(r3nydomtn ivsl(f Duru pnt1tetnif3ils a2eaumsnu)trxrmr3io1op ean s s sexm(rpoodap elfvtat aDtr(m ;u4teeoifeiydla2elu o u) renxo3oydlmte u i s0sruoio nudame mietlt)sDrmur oo1aleoifetlsfm uln pn()altrir3oy1oaDeanvo;t  rxmxo iu4ale lfeilsfaDtrxrpno1opxniietls s2rmnvp u4 rxnxo3oa1fp rauvs;s0trtmimpnudlp nlnvil()srrr(moou1tptoifeiltfs uanvo (0 exnxrcta1opDelu o (0t2xoir3nu4llt  nvsl() 2uaum no0oeeoifciytlaDraums;()aeeoxf iydoat aiesl() etrxo oo1ll e fviltf Drm(rp;o1apenmo3tysls2uluvsn(0 ltrio iatlm eaivi;(0seumxopno4alt mfvtls)s2raxmpno1oee  oetaslm umumo;t4alxrxfcoadopD lueo (0setoxm3nodal e nvs sf Dra(m ;u1aet  oeiadlm rlumo;()teeomocootfm r nei () rxo(r3oo4apte nvia()aDtmxrp;o4aeenmf3tlt a el(vo;u0aetrir3tatlat aiesl(0sexrxo3iudalenlncsat)a2uau ooo1alt iiciyslm2rauvont4 eerxo3iodfateaivols trxrim iudame mfcilsf rur(r ;t1oeenmoeiltls ua(vo u4arxnxr3tydlpD ai i;s0t2xrxopno1lmtn fesasf Dtmurpot1apeo o3tldfm ulumo;u)tleoif iadlptr uvils  rxmio nudaptemiviasf 2rmu pnt0tlxnmictysfm rlnmonu4 rtoir3oadoa eanvs;s t2xoir iodaptnlfes ()sDrmu o;o1tleo f3tysfmDemumsnu) etnifctotoa elnvol( teurxmpnudap elivt tfs2tr(  ot0oee mocias aDrl(mpnu4aetoxr tydlptrlnvi;t)t2xoimpny4lmte ivi s  2tr(ront1alt mi3iyd a2rmnmsn(0aexnxo oadopte iei t sruo(r3no1om n nvi sfa2trxmpnu1aeto fciyt s rmnmsnu)tetoxr3oytlm  ln olt0sexo(opiudol   ivsas s2umump;u0alt  o3tat m2rauvont0 exrxfciy1lm rln i s)tetoxmpny1omeelfvi (  rrrurpno1apenii3iat mDemnvo;(4aeenxr oa1omDrluvs;s0 rur(r nydlpen ieilsfsDrru ooo4apx ifeiad s raump u0tetnxf3iotlpDeluvi;t s2tmir iy1lptn ietltfaruaxr ot4apenmo3iltla2uan o (0tleoxocio1laDe neils texoim nudlptemnvsasf 2umxrpot0aptnmo3tlsfa2rluvs;u4trxrmo tatoptrauei t)tetmxr3iu4ap   netls)srrax  ou0oee mfctasfm ea(ms (0artnxo iy1fat li s;(0t2xrxopnydomtnmfctas) 2urxr oo4tpxoif3iadfsDeln o;(0trtrir oytomDeanei;() eurirpoy1ll  livtat  rrrxroot0alx mieiytls2rmuvo u4 rxnmo3iodoptrlivslt trtmirpoydll  mnesltfartrxrpnt4apt mieilt s uau o;t4 ltomfctotfpDraies (0 rurxr3nu4apenlncilsf rtrxmoou1apto fcilt a rm(ms u4altnmo3ootfpDe uvi;()trxr(r3iy1lptn icsas)a2trum ot1texnmociat a ea(vs u)arxnmr tytfp ranvol(0srxrir3iodal emfcsls)s2rmxrono0apxnii3iadfm2rl(mpnt0tetnircty1faDr ivo t)setm(mpiu4optemies (fsrtau  nu4apen i3ild sDra(ms t)tlxrmf3iatfmteanvsls)trxoiopoudomeemict sf rtm(mp;u4alenmfctatfs2raumo;t4 rtnmociatlat  nes;t0srxr(o nu1openmfcsas)s2trxr ;u1tle iietlt s um(vp;()tlxrir totlpteauvs s  rtoxopnydoltnlieil(  Dtmx  oo0apt ifeilsfmDelnmo u4tetnio iytfaD aneo;(0trxm(r ny1lpenlnei tf Dtaxmooo4aex mieiat a2umnmp t0aexrxo3ia1lp eai i;t0s2urxmpiu1op nmivsa(faDrau pot0tet mi3iltfmDeau o u4tlxomf3tytlp rlneo;()trtmimpiy4lpe  feia( artr( pno4tex mociadfs2um(mo;t)altrir3iotom eluvs;s  ruoxr ny4ol   ietlt arrax p;o4olxn fctltlm2umnvpn(4tlxrxrciadlmtraneo t0trxmio3ny4lp nlivi ()sDumum ;t4opt mo3tadfm2ra(msn()texnir oo1fa r ivs ( srum(rpio4lp   ivsas  Drauronu4alt  ocildlsDum( ont)tlxrmrcto1fa  lueil()srtoio iy1altemicilt sDur(  ou0apxnmfeiyslmDrmnvs u)arxrmrcoadfpt  nes (  etm(mpiu4lp nmict s) 2tr(mo;u0oeenmfcias mDrauvp ()trermociytlmDrlnvs s)trtoxm oodapte iet (f 2um(mpoo0oetn ieiasfmDeaumsnt) eerir iodfm ean il() eur(o no4ape  nvsl(f 2uaurono4oleomfciltfs ra(vpnu)artrio iydlmDe uvs t0trtrxrpiudaptn iviasfsDrrx o;u1tlx mfetadfsDuanmpn(4aetrxo3todfmtr ues;s)srum(o iy1ol  lncil(  Drrx  ;o1ale micilt mDemumo;()aetnir tydomtr iesl()seumir3iy1ale mfes (f Drmuroot4olt  feilsls2rlnmp;()trerirciadom elneo;s0srxmimpiudolt lies tfsrrmuro;o1alt mociydlsDranmo (0trenircio1omDe nvols)teum(r no1lp e nvia(  2ua(r nt4tetoiieiat a2rlnmonu)artnirciotlmte n i s s2tmir3ny1ole  ncs sfsruax  nt0tpt  feiltla2eln snt4 rtrio3iytomD  u o t srtoxo3io1am elncslt srurumo;t1oex moctltlm2rm(vs t4 exrxoctytfaDr iesls sexm(m io1llte feilt) Dtax p;t0oltn i3tydlm ea(vsnu4alxnir ty1omtrau o;s0 2tmxr3no4lmtnlfetasf rrmu o;u4alt ioeiatfaDuan p t0tleoir iotfaDeau s s0 2urio nudomte net s a2trur no4tpx  i3iyt m uauvs;t) ltoir3iodopt lu s;t0texrxr oo1lpeelneia()s2rr( o;u4tpxo fetltla2rmumsnu0trtrxr3tytlpD ln olt  rumimpiy4lmtnlnei t  Duau ono4tlx iieiadfa raump;(0alermr3iadlatr uvs;t tetrxm io1ll n iet ( a2ta(r ;o1opx ioetatfa umn o;() rtnio tadfpte i s;s)srtmio iy1ope lfvs t) Duax  ;o1tpe mi3iydfmDuanvont4 rermf oy1fp rai o;(0t2tm(o nodoptelictlt)arrmx oou4oleomo3ildfs2emu snu) rtrxf iytlat lnvol()trtr(mpoy1ame  nes sf Dtr( pno1oleo feiadfsDeaumpn()areomr3tydom  lnvs;t teurim3oodam  livt (  Dtru o;t4altnio3tydls rm(ms;()aexnmf tadomD livs ()texo(m3iy4op  miciltf rrr(mo;u1apeomo3tytlsDuaums (0 etnmr oydfpDr uei ()s2uo(o ny1llt licta( sDtmumpoo0tee ifeiys aDrm(vp (4teerif oatlateluvs;( teurim3oydllt  fvt (fsDuau p;o1aptomf3tatlsDrm( s t4 rtoxociydlp ranvsl()trtrxo3oy1amen fcsatfsrraur ;u1aex if3iytfsDem( p;u)trtnxfciytfptraiei;s tetm(r io1opeelfvtltfarrmum ;o0oet  i3ilsfmDrluvo ()tlxomf iydfp  aieils  2xoxrpou4omtnmfcsa()a2tmuro;t4tpx  fctld mDul(mp t)teeomf3tydoa  aueo;s0s2umim3oodol nlfcilsfsrtaxr ;t4optomo3iytlmDea( o;t)areoifcta1opDeln ols0 exoxrpoodlp nmnesatfa2tru  no0teeoiieiyslm2uluvp;u)teerio ty1opDrauvi;() 2xr(o ny4llt mfvtltf 2taur nu4tpeomfetyt s2em(mo;(4 lerirciydfaD aneols0seto(opou1llee fvslt arumum ou1ole iicils sDem( onu4aeenxoctydfmD lnvils s2xm(mpny4lltnmiciasfsrtauronu0tpt  oeiyt s em(vo () rtoxf3tadfmteliei t trto(o iy4omtemnvtasfa2ra(rpno4tpenmocias a2el( sn(0altrxfcoydfatrluvo;s0t2ur(r iu1apee ict tf Dtru p;u0open fetydfaDuaumo t4 rtnif tydomteluvol(0seurir oo4lmtelfci s srraump;u1tet iociys m ea( o;t)aexniocoadom rlnei;s)srumimpoy4llenlfesls artrx oou1oetnmieiyt a umu o;t0alermfcoydlatr nvs;() 2trir3io1oltelivtlsf 2ra(ro;o4tleomo3iltfaDelnmo u4aetoxf ta1faD auvolt  2to(m ou1lme mncsa( a2rmx ooo1altnmi3tad s um(vp;u0areniocto1oatrln o;(  exr(rpou4ll n icta(f 2urxmoou1alt ii3tatla2rau snu4alxnxfcoa1lmtrln i;s0 rxr(mpnu1lpt lfeta(fsDrmu  ;o4apen ieiatfsDeau p;t4 leomo iodfm  lnvol(0 ruoio ou4alenmfvtas s2urur ot0oex iieiyd sDrlnvs t0aeenir3totopD lueils0t2to(m iy1olenmivta( aDuaurooo0oltnmi3ilsfs2ul( onu)trxrif oydlaDe neo s) rxoio iu4llt  ictls)a2rmu  nt4tpe ii3tys s rlu p;() lxrif iadlpDeln sl(0srumimpoudlmtn nvsatfsrtm(r nt4tptn ociytla rlump u4 reoxfciydfatraivi;t0 eto(opoy1lp nmicils)srumumooo4aexn fetatfa rmnms;u4 etoxoctodop eaivslt  exm(m nydlp nlnctltf 2rax  ;u4teeoiiciys mDean on(0 rtnmf3oytoaD  ivo t)setm(opiy1omtnmfvsa()sDumxmo;t0aeeoifcilt a rmnvpnt)trtoxfcoadlmDelieo;( t2uo(m nu4lpe mfeia()srtau p;u0oeenioctadlm2rln s;t0tetnmr oy1fa eaneo;s  exrxr oydal   nciat a2trx oou1optomoeiys s umu onu4tlenio3iytlpDe neols0s2toim ny1amee nvsls)a2tauro;o0apxomi3iad mDemnvs;()trtrxoctotlm rai slt seuo(rpiy4oltelicsltf 2rrx poo1aeeomieiadlm uan p;u0tlenmocoytopD liei;t  2xr(rpio1alte ies sfsDuax  no4opt  fciysfmDrl(vs ()teenmf3ia1latran o s) 2xm(r iudalenmnvsls)arum(r oo4openmi3tas sDel( o (4 exoirctytopte i i t0trtrxo io4ol nlies ( srraxrpno4oetn ictls sDean o () rxnir iytomDrlnei s)srto(rpiodlm emfvsat artax  nu1oeeo f3tadla ean on(0tltnxo3oydop eaiesl() eurxopoodaltelncs s)a2raxmpoo0opxnii3iyt a uanmpn(4altoif ty1lmD  n s s0t2trxr3oodal e fvsl(f Drmu p;o1alxoii3tysla2em(mp;t0 lxnmo3iytop  lueo () 2tr(mpiu1ale miesat  2uaxmpou0tpeo oetat s uluvs t0aetoir3ootoaDrluvolt t2trimpoo4lpe mncta()srtau p;u0optn ieilsfa2rmuvpnt) exomr3oydlpDraueils)setoirpny4om nmneias  2tmu  ot1oex iieiltlsDemnmo;u)trxnmo3iotom raues;s0srxo(o3nydapeeliesa( aDrm(rooo1oex  i3iysfmDrmnvp (0trermr iadla e u i s) rtoir3iu4lle mieslt srur( o;u0optnmictlt a2rau p u4 lermf oydopteanvo;t0teuoxmpoo1lltn fcslsfsDtm( ono0aetnmi3iatfaDeauvo;u4texrxfcootlm  livi;s0s2xmxrpiydopen ivi ()artmumo;u0olxnmociatlm2eln p (0 eeoir3ta1fptean ols) 2urir3io1lle  nvtatf 2rr(  ;u0tpxnmo3iysfmDumn p;t)aetnmrctodlptr ivi;()trtoirpoodamtn iesas) 2uax ono4tpxomfetysfaDrmu on(0texrxr3to1lpD auvs;s0s2tr(r3iu1lpeemneiatfaDtm(mpno1oexomoeiatfm2um(mp (4arerxf iotlaDrlivs t seuoir oy4lme mivsl( aDua(  nu1olx mieiys m2uln onu) leomocto1oatean il() 2xo(opno1lmeelfvtas  2rr(rp;u1opto fciatfaDua(msnt0 etriociotom  li o;t0 2xoim3iu1openlnvta(f Drmu poo4apt  o3tldfsDuanmsnu4 rtrifciytoa ean sl()s2tr(r no4ap   fvslt s2rr(mpnt1apx  oeiasls2rlu onu)tltomfciydlmt aneol(0s2trxrpnodlp   ietatf Dtrx onu4aeto f3iatlmDuln o;u) lerir iodfmDrln i s0s2xoiopoodaptnlfeiltfa2rmumo;o4alxomoetad mDrm(vp u4 lenxr io1fmtean ol()teurio3nodom n nvtlt)s2ra(mp;t4opxnmiciaslm um(vpn(0 lxnmo ta1lp ranvi;s0 etmir nu1ap nlietlsfsDumxro;o1olxomociys a em(mo u0arenio3oy1lmtr n slt) eum(m3ou1lmenlfeilsf rrr( ono4optnmoeilt mDua( snt0trtoir3todoptelieo s)texoir iu1om elfeia( a2taur nt0tptnmfciytlm elnmo;t4aetoir3oy1lmt ln s () 2umirpiydlm  mneil(farua(monu4optoiociatlmDemnms;(4treoir ty1optean olt  rxrxr3oo1omenlfvils)s2ta(mp;t4aleomfeilsfa uluvsnu) lerif iotlm eanvo;(0s2toio3oy1lptemics s  2tm(moou1ope iociat sDrl( s;t0tlxnif3ia1lmDeai o;t) eumimpny4om  mfes s)aDraum nu1tex  f3tldlaDrmnmp;u)aetnmf oo1op e ieslt)tetoxr3ou4ol  mici sf Dumxmono0alxoifcils s rluvpnu0 eeoxo oa1lpD li s;s  2to(mpiydolte ieta() rum( oou4olenif3tysfa2ra(vp u)alxomr to1fmtrau o;t0sexo(r io1olee fcslt)sDraxrpno4aptoifcildfaDumump;(4 rerxr3ootfmteai i;t s2xrxo3iu4ale lnvsasfarra(rpnu0oleniiciysfmDulu snu0 eerxrciatomD lnvo;()trxrio oodopeelictls  rtrur ot0aetomoetydfm2ea(mo () etomr oadlmDeanvi;(0setr(rpnu4optemncs ( a2urxr nt1aee ii3tlsfm2umums;t4arermfctytop  au i s) euoir iydalt lnvtlt  rtmuro;t0tet ifcilsfs eauvp (0 etrif3oytlpteln o s)t2trio iu1al e nvslt) 2raxmo;o0alx mi3iat m ea(vo;(4 lxnxo3iadlp eluvs;t) 2uoxo3nu1alt mnesl(f 2rr(rp;u1oetoioeias a2el(mo;t4texrmociy1laDeanes s) etrxrpnydllenmieta(  Dtm( p;o0alenmo3ilt sDulnvsnu)aexnioctytlaDe uvol()teuoxo nydop  lnetas srtr(  ot0oet ioeilsfsDumu p;u4altrxfctatlaDe i ols0seuoxr3oy4om   fctls srumxr ou0opeoiieiadfs el(ms u)alenio3oa1lp e u sl( t2xrir3iy4omen nvi (f rta(m ;u0tlxn i3iltfm rmn p u0tlxnif3ta1op eli i t) 2xmio oodap nlfvtlt) 2rau  ;o4ole mictatfa emump u)teerir3ta1late i s s) rur(opoy4ap   feiltfs2rmxmo;t0aee iieiytlaDrmnvo;u)tltrio3oydfa  luei ( sexrir no4apt  fvsa( s2ua(root0alto octltls2ul( o;()texnmo oy1fa r nvo;t0 2xmxr ou1opte nvi s s2rmuro;o4olxo iciasla rlums;(0 rtrmr oytoate ies s setoxo3iu1lpen ncilt srtmxmo;o0tpxoii3iasfm rau onu4tltnif3to1opDrluvi (0t2tr(m3nydom   nvslt) 2uaum oo4olxoiiciad s ea( p;u4aetrxf3ty1oat ln sl()sexrxrpiu1oleelfciatfa2tm(mpno1teeomoetltfm2ulnmon() etrxo iytoaD lnvo (0t2xmim3nodamtn ici t srtm(mo;t4tptniiciydlaDem( pnu4texomo ta1oa ranei;s trur(r3oydlm emfvtat)srraxmo;u1optomietldfs2emuvo;u4 exnio3ty1fa   ivils) ruo(m3nudapen icias) 2ua(rpou4opxnifctltfa el( o (4artrir to1fpt  n o;s)t2uoim3io4al  livtls)arurxmo;t4aleo ictlslaDelu s t4 exrxf tadlate iei;s  rur(o iu1al nliesl( srrax pot4altoio3iatls uauvp t)aetoxf todlatrluvi s0texmxopno4omte iesls srrrxr ou0tlt  ictldlmDra(vo;t)texrxo3ia1omt lnes s srtoiopiodamtelfeta()s2raxmpnt0tltoiieiatfm2ua(vs;u0 ltrxf oy1fpteanes;(0texr(mpiy1open fesl(fsDurur ou4olenifetatfm raumsnu4tlxomf3ta1faDr u o ()sexr(mpno4alenmieta( srurumpnt4oleo feils a2rmums t)aleoxo3oytoatrauvo t0setr(opnu1apenlfciat a2ra(root4ape  i3iysls2uanvo t4teermr iydfaD auvs s)teumirpnudolt lictlsfaDtau ooo4oetn fetasls ea(vo;u0 leomrctatfa r i s s) 2xm(m3oudopee feta(  rtrxrp;t1ape ioctytlm2uauvonu)texrmf3oatfp ranei;t)s2uoimpiydlp e iviat  Draxro;o0ope if3tatfa em( p t) rtoxo iy1la r nvs t0s2toimpiy1am   ivtls)s2ua(r no4aeenmfeiatlm2eanvo;() leoir tydlptrlu i;s0 rxoiopou1al elnesas sDum(  ;u1apt mi3iyd a2emuvs (0arxnxf iytfmtean s () etrio nodoltnlfvta(f 2rr(mp;t0aetnmoctydfa eanvo t0tetnio oa1om  aivsls)sexm(opno1omtnlicta(f Dur(rpnu0tpxoio3tldlaDul(vs;u0texrxo3ia1omte iesl(0seuo(o3io4olt lfvsat)sDur(mooo1opt if3tls m2ua( ont)texnircto1oa r u sls0trurir3iydomt  ivsl(fsrtax ono4tee  o3iatlaDulu p (0aeenif3oo1op eluvi;t) euoxr3iu4lptn icil(fa2rrxrpno1tet ioctydlaDum(mo u4trtomfcoydop   uei t srxmxm iu4am   ivtas) Duaxmo;u1olt ifeildls2ranms;u0tlxoxr3iydla rau ol() 2trxopoo4lmen iet sfaDtaumont4ole  f3iltlmDel(mo;u0aeerxo3tytfpDrauvo;( s2uoir ny1om emfctl()arrm(mo;u0ope  fetadfa2el( p () leoifciodfpD lnes;()t2tr(opiy4am   fcsl(f 2ta(monu0tpto octydfaDrmn o t)arenxr3ia1la   u ol()texm(mpou1omee fvt (fs2rmxmp;t0opt mo3tlt s2umnms;(4arxomo iodom  aieils)teum(o3oy4lmen ivt sfs2tr(ro;o1alxniociatls rmn ont)tetnxfciotfp e ivilt s2ur(o no4lm elieia() Dta(ront0tetomi3tas s umnms t)aexoxrcoodlaD aivs;s setmim3iudamtnlieias)aDrmxroot4tptoiieilt s2elu s;u0aexrxfcty1lmD aueil(0s2xrio ny1al emncia()arurump;o4opxo octyslmDumu o;u0arxoif3oo1fm  aiei s)trtmirpnu4ame mivt s a2umxmo;t4tlxn iciatla2rm(mpnt)arxomf3oytfm eaiei t)sruo(mpno1openmiciat aDua(r nt1tlx  o3iltfsDuau o ()altoxr3oadfpDr ivs (0s2umxr iodap nlici () Drru pnt4oeenmo3iyt m ul(ms (4 rtnxfctodom rluvs;s truo(m ou1omen ictltfs2umxmpot0aptomictytls2ulnmp;(4trxrxr3ta1lm r u i;t)t2xrxmpiudop n nes (f rrmx o;o1texnifctlt mDrl( o;(4 lxomo oy1omte ivilt  2xrxm3io4oleelivtlt)srtrxronu0apx io3tadfm rl( o (4 rermf3iatfa rlivi t0s2uoim3io1lme  iviasfa2umum ou1tpt  f3tatlaDraump t0 eerxfcoa1oat lu o;t)seur(m3no1alt lfei sfsrtmumpnu0aptomi3ilt mDua(vonu)aexoxf3iytomDe nvs;t0srxoxopiydopte fvsa( srraxrpnt4tpen i3iatfs2ulnvont)tlenmr oydlaD lueolt tetrio3oo4omtnlics (f rurx  ;o1alxn i3iys s2uanmp t4 exrif3iydlmDrluvilt)trxrio iydaptn nesat a2ur(r ou0oex mo3tysfm el(vs;(0texnmf3oatomtelieo s0trumio3no1omenlncs sfs2rau ont1optniociltlm2umuvo u)tetnir oa1fmt  nes s0trtoxr3oo1ome  nvias s2tr( oou0tlxo fciat s ra( o (4aexrif3tytla   n o ()texrio3oudll  mneia(fsDrmxrpno1tex mfetasfmDemn snt0texomfctydfmDr u i t0 2toio ny1ap nmfesl() rrm(m nt1tlxnmoetldfa2emu pnu0tltnxo ia1lp r ivo s0seumxr3oy4omeemnvt t  2tau pno0alxnioeiyd aDua( pnu) lenxrcty1lp  auei;t0s2trxr3oy4apt  ictat aDtrxroot4optoiiciysfa ul( o (0tlxnio iydop e ivi s)t2toio3nu1lm e fet s srrmxr no4teeoif3iysfs2rmu p;(0 ltnxr3oytlp ran ols) rxmim iy4oleemnesl()a2urxmpot1aptnmoetyd a2eluvo (4 lenmo oodfpt  uei;t0 2tr(m3iy4op n icslsf 2uaumo;u0opxo iciydfs2ran o t)tlermf3to1faDr i o (0srumxr iodamte fesasf Dtax poo0tpe  f3iltlmDrmu snt) ltoxo3io1om elivilt0setoim nodlpee icta( sDuau pnu1tlxnmo3iyslsDea( o ()trxoxr ta1opt anvi;(0teuoxm io1ameelfvsl( a2ra( pou1apxomociyt a2umu p t0areoifcoydfmDr ues (0srumxr oy4lmee ict sf rua(m oo1optnif3tatfa umuvs (4trermrctotfa e uvsls trxmim oy1llt  fct ( sDtaxr nu4tex mfetldfm uanvont) leomocoodfpDraivi (0setm(m ny4amenmivi s) 2umu o;u4texnmi3ilsla2em(vp;t)texomocoa1lpt an i s) rtm(r nu4amee ietatfsDtr( o;o4aeeoii3tad sDemnvs t4tltnxo3oytlmtelieilt0t2umio3oo1alee nvs (f Durur no4opxnifeilsfs2rm( pnu0 etnxr3ta1late nvo;() exrim nodamenlncsl(fs2rau p;u4apt  ociatlm umuvp;(4texrxocto1omtrai ilt)t2xmiopiu4lmt lfcsas sDtm( ooo1oex  fctyd aDrmu o u4tlenxfciodlmD  n ils0 exrir iodlpenlfct ()sDrmumpot4tee mf3tytfm2em(mp;u0 lxoxrcoo1fpDeaues;t  rur(o3no1omenmfvtasfa2urxr ;t0aet iietas s ran sn() lxrxrctodoptrau o s0t2xr(r3ny4alen fetasf 2umxronu1aexnii3iatla2ua(vo u0texrmr3oydlmDrluesls0t2urirpio4lp nmfvi sfsruru  oo0tlx mo3tldlm2rmuvp ()arenxr oodlpDelues;s s2trxm no4omenlncil() rtauronu4optnifctadfm2ea(monu0 rtnxo iy1fa rau ilt0 2xr(rpoudaltnmnvt (fa2rm(rp;u0aex mf3iasfaDua( s t)texnio ty1lmDrlu sls0 eumxo oo4alenlnvsat  ruax pou4openii3iasfsDrluvs t4 ltnmfciodfptrlu s;s0texr(r3no4am  lnvsat)aDtr( o;t0olxnioctytfs2rm( p u4aetniocia1fm e uvslt)t2tm(opiu4lmt lfctlt  2uru  ;u0apx  fctat mDeanmo t)tetnmr iadfatelieol(0trtmxm3nodlpe mieils sDraxrp;u0tle  fciasfs2emu onu0 rtnxo iadlat aivsl(0texr(mpoodol nlnet (fsDuax p;t0alxn oetldlmDrl( o ()tltrmfcto1fp  an i s teuoxrpno4lpen ieilt a2tm(  nt4ape ifeild s
\ No newline at end of file
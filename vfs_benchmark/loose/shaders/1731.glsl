@@ -0,0 +1 @@
+neolt) eurim3oy1lmtnlieiltf Drmumoou4oee  oeiydlm ra(monu0alxrxr3iy1faDeai o t)srtr(r oo4lmtn ivta(  rrmu ont0ale  o3iatlsDeauvont4altrmf tatfm  livils  etr(mpnodoleelnci sfarraxrp;u1alt mieiadfa2rl(ms t0tetnifcoy1fa   uvils) rtm(rpiodoptn fcils) Drax oou1openioeiadls emnmo t4 ltrmocoo1fptelivs t t2xoir3oodal e ncil( arraxmpnt1altomoeils m2rmu p ()teerxrcoatfp r nvs;t texr(o3io1open nvilt)srrax ont4oex io3iad a ul( snu0tetnmrcoy1lpDeauvs s0trxo(rpoy4ll nlfeiatfs2raxr ;t4openmicildfsDum(mp;u) exnmf oytlaDeaivs t  exrim no1ap e fvilsfaDur( onu0apeo i3iadls ea(vs u)alenir iytfpD  ivi;s  exrirpoydalen ivtasf Draxroot0tltnmictat a2umu s () rtomr to1lmteaneol()texr(o3ny4al n ies s)aDrrx pnt1tptnmfetadls elnvp u4areoxf totlat  iei (0teurxm3iu1lp  mnciasf Durx o;u0opx  ocilsfs eluvs;t)aetomf3to1la eaivils t2urxrpoydlle micsl(  rrm(ront0aetn f3tys mDrmumont0 ltomf3tydfptelieo;(0sruoim ny1ame livtas) rrm(monu0texomiciyt m ua(vpnu0 lenxo3ty1fm ean ils setoxm3oy4omtelietas s2rr(r ou0aetomiciyd mDrau o t) rtrxo3iodfptr ivsl() 2xmxopoy4lm  mfesat s2rm(ro;o0teeoioctls m2uauvo (0aetnxf tadfmD li sl(0 exrirpny1lpt  iei t)a2rm(ro;o1tlenmi3iyt s2rl( snu0 rtrxr3tadopt aues;s  rxm(o3no4lm e ict s  rtru  nt1tet ifctatfmDranvo (0 leoiociodlpte ivs t)t2xrxo3oo1lpt mncsatfsDrmur no1tleomfciltla ea(mo u) lxoxo3tytlmD  i i t trtr(o3iu4lptnmietl(fsDurxrpnt4optoioetatls2emn p;u4tltnxf3ty1omDrlnvi t tetmxrpno1llte nvilt srtrxrp;u1tltn iciydfa rm( p;(0texnifcoatlatr ueo s0setrirpio4apenmnvtlsfsrtr(rpou4altn fciyd m emuvo t4 etomf io1fatelneolt0texmio3iu4lmen nctls  2umxmp;o0opeo i3tltlaDuau s;u4trtrxfcty1lpDeau i;s) rtoxo nudame  nvilt  rtrxmpnu0optoiociytlsDulu p (0 ltomf3tadla ranvi (0trtrxo3nudoltemnet ( a2rau onu0tpt  ieildls2el(vo;(0aexnxo oadfa r uvs t t2xm(r oodoltnmfet s)aDua(rpou1opx  oeiytfa2rmuvp;(4aetnir tadoaDrlneil( t2xoim3ou1olt  ici ()aDtm(rp;t1aet  i3tldfa2eanmo;t4 etnmr iydfpD lueo s)texr(rpnu4amee ivs ( srrr(mono1apx mocilslmDrmumonu)trtoir tytop e ivs t t2umxmpny4ale lfcta(  rtm(ront1olxo oetldlmDrmu p;(4 rxnmfcootla ranvi;s0 2urim nudam elfesasf 2ur(rpnt1opxn fctas aDuauvo;t4aetnif3ootfa eanei;s)tetoio3nudam n ieias sDumumo;u0opxn fcildla2ulnvp;u4aleomr3oadfpD liesls)tetm(opny4lmtnlivt s arur( p;o4oeto f3iyd sDrmu p t4aexnxo3iy1lpD  ieil( sexm(m3oo1ap  lieta(f 2raxrpoo4teen i3iltlsDrm(vs;u4aleoifciotfa eaivol(0 exoxr3oy1ope lictatfaDuax p;o1oeto f3tydlmDelnvpn() reomrcty1om elueo;t)teur(m oudllt  netasfsrurx pot1aexo oeiadfm2ua(vont0aexoio oa1fp  luvi ( srumim oydaptnlieil( arra( p;o1altniietlsfsDua( o ()aetrif3tadlm rauei s s2xoxr ou4amenmietlt sDrmumpnt4tpxnmi3ildfmDra( s;u4trxrxr oatlaD  uei t)texmxopoo1ol n fesl()arum(rooo1apxoifeiltls rl(ms ()arxnif iytfptr ueol() 2urim3iodlpenlfetlt)srum(ronu1oltn fcilslm ra(vsn()arxrxo totlaDelnei s)t2xoir ny4amtelnvilt)srta(r oo4aleo fciydla2elnvon() rtrmf totlp   nvi;s) rtmxo3iu1omtnlneiat)sDrmuro;u1apxnio3tadlaDumn p;t4areoxf oa1fm rau o;()s2xmxopiodaptnlnvi (fsrrm( poo4tlxo i3ils s rl(von()alxomr oodfa eau sls) etoir iy4lmt  nesatfsrrmxm oo1olt mi3tas s rmu o;u0texnmo iotfa  luvilt0 etmio iy4aleemivtatf rrau  no4tet mf3iyt a ul(vp;u0tltnmf3todfp rlu s t  2xoimpnudlm  mfes (faDtrurpno4tpe ii3iadlaDulnvp t0aeenxoctodlmD aivilt)t2xrxo io4aptnlncsltfarur(rpno4apt iictatlsDrm(mpnu) lerxf3to1fp  lueils  rurxm nydapenmivi (f rtr( p;o4opxn icias a eanvp;(0teenmo3tatoaDrlneol(0t2trim3nudapt  ncia(fsrta(r ou4apt  i3ildfsDeanvs;u) rtrmo3iatfpDe uvi s  eurir ou1lm   fcil()a2rmumooo0altn ociytfm2uau p t4 lxoif oa1fate iesl()srtmxr3io1lmeelnciat)sDrmxm ot0olen ictatlaDuau onu0trtnir3iadfa raieo;( seuo(o iu1ame  iesat aDur(  ;t0ope io3tysfa elu pnt0aexoxf todopDelnvo s)texm(r ou4olt miet t)a2tm(rp;o0apeo ieiatla rlu onu0 rtrmf3todomDr n sls texr(o oy1lm elncta()aDuax  oo1alx mi3iys sDrmuvp () ltoxrcoytfpt lueol()t2xo(o iu4opee ici t s2trum nt4oeto f3iadfa2eanvs t)arenifcia1fmteaivslt trurirpoo1al n ncil(f 2rau poo0tpe ioeiydfsDrlnvp;u4 exnxf3tytfmtr iesl() rurxopiydapt mnvtlsfsDrr(r ;o1aleomi3ilsfsDea( p;(4tltrirciodlpt lnvi s0 2trio3ou1amenmivt s arraum ot4tpen feiatfm2el(vo;u4arxrxr3oytfpDeanvo;t)setoxr3ou4al nlics sfsrta( pnu4olx ifcilsfm2rmumo;t) ltnmfctytfpte ieo;(0srum(r3iy1apte netlt)sDta( pnt4olt mo3tyt sDrm(vs (0 ltrmf3oatfa  anes s)seuoxr ou1lpe  iviat s2rrx p;u1opto fctyd m eanms u0aeeoxr3oo1faDr ies;s s2tr(mpou1oleeliviat) rrmx  ot0tex  fctysla2um( o u0 rxrif iotlmDe nei;t s2tm(o3ou4ap nmncs t) rtrum nt1tee  feiat sDumnvs;u4trxoxf tytfmt lu s;( teuoim iudamtemietls)aDum( ooo4apenmi3tatfaDuln snt)aeerxo oytom rluvsls)s2toxo iu1lptnlivs s) Drmu ont1opt iieiytfa2umnvp t0 lerir3oa1fm   u i t srxoio oudll e ivtls) rumu pno4alxoio3tad a umu o;u4treoxr3ty1omteanvols)srumxm oy4apt  net (f 2tmxmono1tle iieiydfs rm( s;u4arxrmfctadla  an i (  2xm(r3iu4am   fvi t  Dra(rono1tlx ifetys m ea(vsnt0tleomr3iydfm rln s s0t2urio3io1ome mivs t)srrmu oou1opx mfcildls eauvonu0trxnmfcoatfaDeau s t)s2toir3nydlm  mnvia(fa2trx  nu4ole  ieilt a ranmpnt0artomo3iotom eau olt0s2xmim3ny4opte fciat)arua( poo1aetn ieiat s elumo;t4trtrifciydlmt ln s;() rtm(o3iu1openmnvi s) 2rrxm oo4aeto feild a uau s t)tltoxrciydlm rlnvs ()sexmxr3iy4oltemivtlt)aDra(rpno1tlxoio3ildlm2uan sn(4trtrmrctydfmD lueo s srurxr3nydal elneiatfarur(ronu4apx ioctasfaDulump;(4texoif tadlatranei t t2to(opny4op   ivi s)srumxm no0optoifeilt s2eauvs;()alxnxf iotoat  u i;s  rxo(m3no4amenmietl()aDtaxrono0oexo ictltlmDuau p u) etnxr3iadfaDr iei;(0trumio3nodap  mnvt (f Durxrp;o0apen i3tltfs ua(vp u) renxf3ootlpte n sl( t2xoim no4lmen iesas) 2taump;u1oexn ieildla ulu pnu4alxnxrciotop e ies t  2xmxr nodomt  nci ( s2uaumooo4opt moeild s2uau p u4 lxrmfciadfm elu s;( trtmxm io1lpe lneiat  Dur(moot4opeo fciyd m rluvp;t) ltnxr3iydfmDr n o ()trtrxr3ny4olt mfctat s2uauro;t4teenif3iydla2ua(ms (4trxrxrctodoat  n olt0s2xoimpiu4lp nmicsa()a2uru onu0aee  icildlm uln p;t) rxnmociy1latrai ilt  exmxopoodamenliei sfs2taur ;o1tee ifeiydfm rmnmonu4 rtomrctytlmDeluvo ( srtoim3iu1opte fvt t)aDum(ronu4tlenmf3iadla rln o u4 exnxr3iydom eaues;t0sexrim oydaptn fcilt sDuaump;u1oltnmiciadfaDumu s;(0 ltrmf iytom   nvsls)srtm(mpio1oltn fvtasfsDumxr ot1aetomf3iltla raums (0alxoircio1lmD  nvi s0trtr(rpnudome mnvi ( s2rm(  ;o4opt  oetytfs2umu s;u4tlerif oo1lmteluvi;s sexm(m oy4llt mnvt t sruax pnu1tlxnmoeiysls2uan s u0trerifctydlm rlues s  rxr(r ny1llee ncsls  rrmxrpno0alxnmo3ias mDemnmp;t)trtoir3todlmD auvs;s) ruoir3oydop  lfcsa()sDumx p;u4alx  f3iatlsDum(mpnt) exnio ta1omteanvi ( sexrirpiydom e nci tfaDuau ooo4oex miciadlm rm(mont) ltnio3ootfm eanvs t0trxoio3nu4ale mfci (fa2umurpno0aptoiictadlsDulnms;u)tlermo iy1omt anes s)srumio3oy1lptnmfetas)a2raumo;t1tlxomfetasfs ulnmpn(4tetoxr oa1lmtelneo;t) rum(opnodlm  mnet tfsrtm(  oo0alxo oetad sDranvp (0trxrmr3iatoptelnvo ( srumir3oydap  lfvtl()s2raur ;o4tpt micildfa2ran snt)tltrxf oatoaD ln o ()s2toxm3nudam nmnetls aDrmuront1olt  f3tytla2umnmpn()tlenio iytlatrauvil(0trum(r oy1lpee iei (f ruaxmo;u4ape  o3ilt a rmn s;(0 ltoif oadoa rauvo;t)s2umio iu1lpt lfviat)sDtm( pou0tle  f3tat sDrln snt0tetrmr3ty1fptrluvi () rxoim iudolenlfei s arurx o;u0oetomociydfs rauvs () rtnxf3ia1fmD  ueolt0t2urir3iudalee feils arrrum nt0alt mociltfa ua(vp;(4 ltoir3io1fpD lneo;s setmir3nu4ame mneslsfsrtrumpnu0altnmfciydlaDum(mp t)texrmf3oo1fatraieils) rxrxrpnydll e nvil(fa2ur(ro;u1ole iociys m elnmo;t)texrmo3iodom raiei s tetmxmpnydaptnlictasf Duaxrp;u4opt  iciydls rluvsn() exrmo3oy1om  lnei (0tetr(m iu1ol   ieia(fa2tmurooo4aex mf3tadfsDrl(vs;u4alermrciydlmDrluvsl(0 2uo(rpny4olt  ivtat aDta(mont0tpxomoeils s2umnmo u0tetrir3iydlpDr u i;s trurimpny1omt mfes t)sDrr(mpno1tet iiciatfmDuaums u)trxrio3iotoaD lnes;() etmim3iudlltemnes s srumumpnt1texo feiydfm2eanvo u)texomfctydoptrluvols0trtmir ny1aptelfvia()srrmumpnt4tlto i3iadls2eauvont0 exomf3oy1omteanes;(0s2umio3iu1apen nvt ()s2taxrpou1tet moetyt sDranvp u4teenmr oa1opDelues;t trxrxmpiy4openmnvsa( arrr(mo;t1tet mieiytfm2emn s (4aexrxo iy1om rai ilt0t2xoim iu1lpt lnetls  rtrxm nt1opxo i3ils m ua(msn(4tetomrctydfpDrlu ilt trxr(m3ou4omtnlivsl(f rrm( onu1optn o3ilt m rmnvp u0 rtrmf oydopDr i olt texrio nodlm  mfeslt)s2urxronu1tltn f3taslm2ulnmonu4teenir3oadoa rlueils) etoxo no1amen ics s)arum(mono0tetomictatls2rlnmo u)trxnxo3oytfmt lueo s t2uoir3oo1ll emncs t)sDtmxro;o4alx iiciysls2ea( p t4tetoif tytoaD ai olt setr(m nodam  lfesltfarum( oot0oexo ociad m rmn s u4tlerif io1lpteli s (0s2tm(mpiu4altelict t sDrmx o;o1opxnmfeiasls ua(vp;t) rxrxrciatomtraieilt s2umxrpoy4lltn fet tfsruaump;u0olt ioetytlsDuanmo u)trtoxf oydlpt lnei;( trtriopoo4amte iesl()a2rmu  nt0tlx iietlslmDuan o (0 etoir ty1faDeaieo s) 2tm(opnudamtelfvs t) rtmurono0tpeo iciltls ul(vsn(0trenxrcoydlpD  u sls0 2umxopoy1llenlnvi (f 2raxr ;t0texn fciyt a um(ms;(4 rtoif oadomDrlivi;(0trtrxr nodaltnmiesl(fsrrax p;u0tpenmicilsfs rluvsnu) lxomo ootfatrluvs;t0seuoir3no1lpenlivsatf 2tau p;o1opt io3iydfsDeaumon(4 lerxf3tadoa e ieo;t teurxo3nudll e ictas  2trxm ot0apeoioeilt a umu s u) ltrmfcoy1la e nvsl( srtrir3iu4om  lfeiat)a2ur(ro;o4tpen fcias aDrmn o;(4arxomr3io1latrln o;s  rxrir3oo4ll emfetat)srurxm nu1oetnmoetadfm2ul(vs (4arerxociytfpt lu s t0 rurimpiy4omt mfvi (f 2tmu pou0texomfctysfs elu pn(0aexomfctatfptr n s;s0 2tm(r3nu1lle lnvsl( aDumurpnu4aeto ociytfa2rmnms;u)aeenxr3iotopteaieo (  rtr(rpiydlm  lfcsls)s2ur( ont1tpeomoctlslmDraums (4trxoxo3tydlm  lnei t0s2tr(mpnydlpe  fetls  Drr(  nt1aeeo o3tys mDua( pnt0trxoxo to1lm raies;s seuo(m io1lmt lfvsa(  Dtr( ont0opxnmfciytlaDrmuvon()aleoxfctatlp  aivs s0s2tmio3oo1oltemnctlt) rrrxm ;t1apeomoeilsla el(vont0trtrmf to1la rauvils0 exrio iodop emfvslt)sDrrurpou4oeto i3iyd s elnvo;u4 lxrir oadoatr ivo t)srxo(opiy1ap nmivs (  2rm(r ou4aptomf3iytlm2uanmsn(0 ltnir3iydomteliei;( setm(r ou4apeelnctat aDtmuront1apxn fcias m2raumo;u0treoxr3oatomteanesls0t2xrxopio1aptn fvs tfs2tr(mpot0ape miciltfa2ea(mon(4treoio todfa rli i;s0 rurxo oy1lp elfei s artmumono4teto ieiadfs2ranmpn() eenirctadfmDrlivsl( srtoxmpnu1lmtelnesasf Dur(r ot4alt moctadfs em(vo;t0 ltrxf tadfp e uvi s t2tmiopnu1ll e fvtlt)aDrau  no0tpto octlsfs rmn s;()altoir ootfate ivs (0s2xmxmpiu1aptemfet s) Dtauro;o1tpxnii3tltls ua(vpnu)artomr tydfm e i ils trxmiopou4ape lncta(farua(rpou1aetnif3iysfsDum(mon(0 lenxociodfm r nvilt) ruoxrpou1alen ict s)srrru pnt0olenioeilt aDrauvon()artrir tadlaDelu olt0srxmxr3ny1opte ictl( a2umx oot0tpenioetad aDel(vonu0arxrxf io1faD lneil(  2toim3iydop nlfcslt)sDuaum nu1openmoeildfm2ea( pnt)teerxrcoodlm elu il()s2uoxopno1ll e ictas a2rm(ro;o0oeen o3iltls2rlu pn(4 exnif oa1fpD luei;s  2xm(o oy4lm nlfct (f 2ua(mpno1aee  i3iys m emnvo u0alxrmr oodla elieols)trtmxr ny1om nlnvtlt)sDur(moou4opx  feias a2uluvp;() lxrio3io1fpte n s s0 2xoir iu1amenmfctlt) 2trumpnt1alxnmiciaslsDelumon(0arenif3tydom   nei;s) 2xrxm3iudole lfcsat aDuru  nt0tleo iciasla rmnmon(4 rtomocoatfateli s;s t2xr(o nydlme  ict sfa2umxroou0tlx  i3ilt s2rlnmon()aexrmo3tytlpDrauvo;s0 rurimpoudoltn iesatfartaumpnu4apxomoeildlmDuan onu0 exrmo3ia1oatelu sl(0 exr(m oodop emfvtl(faDrmu pnu4oeeoifeiydlm rmu s;()artnxf oydla  aies;s) rxmio3ou4ome micsas) Dtr(rp;u4tle mfciad mDra(vpnu4 lxoxo oadoa   ieols trtmxr3ou4opte neta(f rrrxr no1ole mi3tasfaDuau snu4aeenir3iydfp rlieo ()s2xrio3oy1ale  ivtl(fs2rmur ou1alt mociasfs2um(vont) eeoxf totlmtr i s t setoxo iydlp  lnvia()sDum(rpoo1openio3iytfsDemnms;t4 renxociydlmDraivilt  rtmiopiu4llee fvslt aDumx  ;o0alenmoetls m2rmumonu4trtoifcoatfateli s;s  rxm(r3oo1op n fetl(fa2uaumont4aetoifciytfs2ul( pnt4 eenir iydlmtraieo s  2toxr io4altnmfesl()arta(moot1oltomi3tldlaDulu o;(0aexoxf oytom   uvol()s2um(m nodlp nlncia()sDurx ont4tptoifeild sDua(vp;u)tleoifciydopt  nes ( trtrio nu4apee nvil() rtm( o;t4tpenii3ias a rlnmpnu0tlxoxo3iodomDeanvs s teto(rpiy1am elivia(  rumxm oo4tlx moeilsla umumonu0 ltoxf io1fm ranvs s0tetoxrpnydol nmfes t) rtrxro;u0aetn ociaslm2umuvont0aetrxfcoydfmD li i (  euoxopiydop  lictlsfa2tmu oou4olt  feiltlsDua( o;u)tetnif3oodlpDe nvilt0srxm(rpou1lmenlfct (fs2ur(  ;u0tetniieiltlsDuluvp t)alerxo oadom raieilt)s2xoxo3iu4apte iet (f 2tm(  oo4tptnioetltfmDumu s;u4tleoxfcoodlpDe ivs;s t2toir oy1ap   fviat)s2rau oou4oet  feiltfaDrln p u4 exrio3tydlat  u o s)seumimpiy4opee fvs t aDumxm ;u0olt  icias m rln o t)texnmfctydlpD luvs s) rurxopio4lmtn ict (f 2rm(mpou1alt  i3iasfs ea( p;t4 exnir oo1op r n sls  rxrxr oodlltnlneta()srtmumo;o1tee ii3ildlmDuan o;(4aeenmr3iydfp r i i t0texrio iodoltnliet (fsrum( p;t4ale moetld s uanvs (0tlxnmo3oytoaDr n o;t0trxmxo3iu4omenlfet (faDur(mont1aeeoioeiasfs ea( o;t)trxrirctotoaDrau o;s0trtrir ny1olte nci s a2trurooo0opxnmoetat m eanmo;t0 lxrmo iodom e u o;( teumir nu1opt  fvi tfartaurono0texo oeiasfa2ulu onu4arenxoctotfmtraivo;(0t2trxmpiu1lp nlncia(  Dtau o;u0aexnii3iatfmDuaumo (0aeenir3oatfmtrlnes t0teumiopiudop  lncsl( arurumpnt4apx ioeiad s elums (0trtnmfctydfpDe ies;t0t2xm(r3no1altnlnes ( s2rmumont1texoif3tysls ran s;(0 lxoxo iadfmt lu slt)srurxopio1al   fciatfsDtrum ;t1tlt miciasfa ul(von(4tlxrxf iy1opte ivi;s texrirpno1omenlies t srta( oot1aeeniociysls2uanmp;t0tlxoifciotfat lneo;s s2xrxo3oo1optnmivia( s2tr(ro;t4opt ii3ildlm2ea(mo ()artrio oo1oa ean ilt0truriopnudaleemnciat s2ta(r nt1oetoii3ils a2emn o (0 exoxociydomDr n i;s) rumim3iudlm n fvsat) rtrx p;t1tpenmfcilsfm2emnvs (0tlxoxr oo1fmt lueo s0trxo(mpoo1ap elictas srrau p;o0texoiieilt m2ua(monu)aeeomfctatfmte ieo t) 2um(o io1al nlieils aDua(mpno1tpenif3iasfmDeln o;t)texnif3iadomtraivi;s) exmxo3iy1olte icias aDumum oo0aee mo3ilt mDum(vp u4altrxrciodomD  ueo;t)sexo(o oy1opteliei (farur(r nu1aeeo o3ildfaDem(ms;t0alxoir iy1fm  lieslt  rum(opiu4altn icsl()a2ua(r no4tpenmf3iat a um(mpn(0 eenir3oy1oaD lieo;(0 ruo(mpoodll emiei s s2ur(r ot0texomociadfm2eauvp;u0treoio totlptrln o (  2umio3oy4ap nlfvs tfs2tru  nt4apt iicilsfs2um(mo t4teeoio io1fpteli il(0t2xm(o3ny4am nlnvi s)artmxmo;o1olxomi3iltfs2rl(mpnt)tlenio oodlaD luvs s0setrirpiu4opt mnvt s sDtmur oo0oexn ictls m2emump;t0aleoifcoadomDraieo;s)t2umimpou1omt lfcils)s2tax pnt4optniiciyslmDelnmp;t4 eermociy1fpDeanes;s srxm(m3oy4lptelneil(  Durxrooo0ape ioeiadlaDeauvp;u) rtnxfciy1fpD  n i;(0sruo(m iy4opee fetl(fs2tr(mooo1altnmfctls sDea( p (0 rxrif3iadomtelivo;t tetr(r iy4al  mivilt aDur(rpno4apt mfciadfa2uauvs u4 exnif io1fp rlu o s) rto(rpio1ole mnviltfarumxrpot4aptoii3iydlsDelnmpn(4tltoxocia1la eai ils) 2tr(mpiy4alt mietlt a2tmxm ;u4tpen ieiyt a2uln o;t4 lenmr3oydfmDe u o s) 2xoir3io1al elfvtltfaDumx o;u4openmi3iaslsDem( ont0aexnio tydlat ai i (  2umxmpnu1ap n net ()aDtau  ;u1oexomo3iytfs2em( snu4 lermoctatoptrlnvo;s)s2umxo3iy1ap nmnvt sfs2uaxmo;o4tpto fetyd s2umn p () rtnmrcio1fpt  i ils)t2xr(o3oudal e feils)artmu onu4opxoiieiytfa um( p u)alxnio tatfpteanvo;(0trtoirpoy4apt  fctls  rrrxrpoo0aeeo ietltfaDrau p u4areomfciytfat lues;( sruoxo3ou1lp  liesat)s2tau  ;u0olt  iciyt aDrmu o;t4alenir3oa1om  lnvi s trurxr3no4llt mfctltfsrrmu o;o1alen fctysfsDumnvp (0trxnxf3ia1omt  uvs t) euoxr3nodom elietatfa2trxrpou0opxoiieias m rl(mp u4teeoxfcia1lm  ai o;t0teumxo3nydlm   nvias)a2umumpot1alx  ieiltfa rl( p t)trxoxo to1omDe ivil( seumxrpiu4lpt  ncs ( s2urxmpnt4tet ii3iyd s ulnvsnu)aetrir tadlat luvi;(0srtm(r3oydlptnmfet ( s2rr(  ;t1aetoii3tyt s ra( ont)tltrifcoodlp eluvs (0t2toio3oy1lmeelicia() Draxmoou0apxnifcildla2elnmsnu) reoif oodomtraueol(0 rumxo3no1om  miet s srrm(root4tpxnmocilsfs emumont4tltrxrctotla elieslt  ruoxm3iy4optnliet s)artau p;t1ale mfciadfm2ea(mo u0 exrxr oa1la  luvo;t0 rxm(m no4opeelfci ()s2tm(r ;t0tlxnifctyd a rau pnt) lermfcoadfmtr u s ()sexm(o oy4lle lnvilsf Dtr(m oo1aet  f3tyslm rmu on(0trermo3totomtelivil() rurxr3iudamte icsl( aDrr(mo;t1aetnmfeiys a uan pnt4tlxnmocoatfaD luvs;s) 2um(m3oydlpt lfvt ( sDrm(moou0tltnii3iasfa rl(vo;u4 eeriocoadlpD au i;t0srtrxr nu1omte nviat s2uru pnu0alt mocils aDuaump;(4artnif3todlm eaneol(0teumxo3nudop elnet (faDumumpno4tpxomo3ilslmDrauvo;u4 exomociytlpte uvslt)texrimpno4ap emietls)arrrxmpou0aptn fciatfa rl( s;u0trerxo ia1faDean ol( trxoxm3nu1ap  lieslt) Drrxmpot4texn oeiyt s ua( sn(4areoxf3oatfm  an slt setrim iy4lm n icsa()sDrmx pnt4alxnmoctlt m um( pnu)tlxoxfctadlptelnes;( s2toxo nudlp nlnet t)s2ua(m ou4tlenmf3iytlaDrmu p;u4aetomr oodoa eaueo s0 rtoxmpiodame mfeiat) 2rrx pno1olxoioeildlm2rluvp;u0 lxrxr io1fpDeauesl( srxrxopoodlp   fvt (  2tau pnu1aptoii3iatfm2uluvont0 rxoxo iy1om r uvsl(  rtr(o3iudam nlnet s)sDrax  ou4tpto o3ilsla rm( pn(0treomr3ootopt luvol(0 rurxr3ny4altn neil( s2uaxm ou0oee mfctytfa eauvp u4 renxf todfaDrluvs s0seumxmpno1llen iei (fs2umu p;u4aleoii3ildls emnvo;u)trerio oy1omte u i;()s2uo(m ou4ol  livtlsf 2rru o;o4texo oeiysfsDum( s ()tltnmrcoa1la rln o ()s2xmxm3iudlp  lici tf Durxm ;u0opxomo3iatla2uaumo u0 eeoxf3iatfaDranvsl(0tetr(o iu1ap   fet s arrruro;o0apxo i3iadfm2el( s;u)aexnxfcoadom e n o t0 2ur(r3oy4ole  fes t arrmxrpnu1teto ociad m um(vp;t0 lerirciytop  livo;t0srxo(m ou4opte fvia()sDumurp;o4tpt ii3tltls ra(mo;t)aeerif3tadoatr uvo;(0 exrirpoy4lm nmivi (fsDrruronu1tlxniietadls2um(vo;(0alenmr ootoaD lieilt truo(mpiy1amte ieilt)sDtax p;u1alxomo3iyd a eauvo;t4arerir iydoa ranvs ()texrio3no1optn nct s s2ta( o;u0tpeo fciyd aDuluvs;t4arxoxo3tadfm ranes;t0setm(r nu4ame mfctlsf rrau o;u0aeeniiciadls2rauvp (0teenmo3oytfatr nvslt)trtoxo nudll  mnvtasf 2uru pou4tpxnmociadfa2emuvp t)alxomoctydomD livi s0s2toim oudop  lneiatfsDrru oou0oexoif3ildlsDeauvo;t)tlxrioctadlpDranvols0teuoxo3nodlp  lict t)aDrm(root1olt  ietlsfa um( s;t0 rtomfcty1opDelnes (0 etmxm oo4omtemnetatf Durxrpoo4olt iietadfa2umnvs;t) lenxr to1oate u sls)teumirpiodol emiesls srtr(r no1aptn fetydfs eanvs t)tetrxr3iadlat  i i;s0s2trir iodlmtemnvt t) 2umum nt1apxnmociadfm elnvs t)tetrir3iadom r ieo;t0 rxoiopnudlmtemicsls sDuau ooo0aexoiiciltlm2el(mo;t0 lxoxf3oy1omD auei;t truoim oy4amtn fctl( sDumu  ou4aex mo3iytla2ua( s;u0arenmo3iadlp   i s;( s2umimpnu4lltnmnvi ( aruau  ;t4oee  ociysla2ul(vsn(0tetoxo oydfm  aivi ()teumxmpnu4al  lfet s srur(  nu4olt if3iydfa2uanvsn() ltomocia1laDr nei (  euoxmpno4ap n iesasfs2tm(r no0tee mi3iyd s2rl(mo;t4aeenxo3to1laD lneslt0tetrimpiodlptelnctls srtr( pnt1tpt  oeiytlsDuan p u0aetnircty1fpteli i s srtrimpnudlp  liesa(f Drmx  ot1aptnif3tldla ra( s;t)tetrxocootlmD aieo s  rtrxrpny1altnmnctlsfarta(rp;o1ale mociyd mDea(vs;u)trenif3tydlpt  i ils  rxrxo ny4olte nct tfs2rrur no1alxomf3tys sDraumsn(0 eenmrcoa1oaD anvo;s0srxmxopoy4lmtelfct ( arumurp;u0oetniociaslm rmn sn(0texnmr tytfatr ieo (  exo(r3oudole  nctat)a2tmxrono1teen iciyslsDea(vs (0texnirctatfptrai i;( t2xmxrpoy1alen fvt s)srtrx  ;t4tleoii3tadlaDea( s;t4trxomf3oytopt lnvsl(0t2xoirpiu4ll  lfet t srumuronu4olxn oeiyt m ranmp t) renmf iodlmtr uei;t trur(m3iy1lptn ivtltfsDraump;t1tltn o3iad aDumumsn(0 rxoio io1lpte i s;(0s2toxo3nu4amtelnvtlt srumu  oo4apt iiciyd a2um(mp t4areoxr3iydfp r n s;t  exo(mpou1lpt lnct t)aDumxrp;o4teenmfctls sDrlnvsn(0 lxoio oydomDr uvsl() rum(opno4amte ivt ( sDrrx p;u1apxo ietls a rlnvs (0 lxnxociydomDelivols0 eurirpoy4lm  mivta( s2ur( oou1aet  oeiad a2emumpnt0 rtomoctatfpD lneols srxm(m oydaptemieils)aDtaxm ;o1oleoioeiyd mDrl( o t)texrio3iytlaDr uei;s)t2xr(opiy4om  mnctasfsrra(mo;t0oetoifetld s umnmpnu0tetomr oydoa raneolt0teumim3ny4ap elnvtl( sDtmuront4olx  ociasfa2ea(vs t0trtnirciotom   uvo t)t2ur(r3ou1al  lfes t)sDum( pot4teenioctasfs2rm(mo ()arxnio3tatoaDrauvi t0 rurimpou4ll  lneiatfsrtmurpnt1tlx  ieilsfmDemums u4 lxnioctadlmtraieil()trxr(r iy1ape lfcsat  2uauro;o4alxn fciyslmDuauvo;(4 exomocty1fpDeaueilt sexrio3io1lmt lfcil() 2tm(r nt0opeoiociltfa uanvs;t0trxrxr iodlm eauei;(  etoirpnu1am nmnci sf Drm(m ou1oeen o3iat s2ea(mont0trxnxf ty1omt aies;s)trto(r ou4lmtnmics () Draxrp;t4tex ioeiadla2umnvo;t4aetrmrcoy1fptr neol()setm(o nu4amte ictls  2rr(m ou4tltnio3tas mDem(mp u0 ltrif tatfa rauvo ()teuo(mpoudlm nlncta(  Dtrxr ;t1apt  oetasls emuvp (0 ltoxfciydfaDeau i t  exriopiu1optn fes s  rururo;o0texomfeildfaDra( p;(0 lerif3oytfm rliei t)trxoxopiydlm  mfvi sfartaxronu4tltomfctydla emuvont)altrioctadomt  uvil() 2tm(mpoydlp e fcs s srrmxr oo0altnmociltlm emnvpn(4aetnirctodlmDr u o;t srtrxo nydlmt  ivs sfarururo;t4oex  oeiltla ea( p u4artrxr oydfpDr ivi;t0 exmxo3oydlm n ici t) 2umx poo0tleoif3iatlm2ulumsnu0teenmr3tytlmte uei;(  2trio oydlpeelicsasf rtau ono0aee ii3iasfaDemuvo;u4 rxoxocta1la elueo s  rxmxopio1op emfcia(  Durxrp;o1oeeomo3tlsfa2elu p;t4arermfcta1fa rlneo s)texrim ou1amtelnes sfsrra(rp;t4tpxniietaslmDum(mo;()alenxf3iydfpt  ieil( srtrxo oydaltnlncilt)sDrru onu1tlenmi3ilsls2ean p;t)artrio ta1lp   uvols t2xo(rpiydomtemfeias arrax p;u1oeenmoetydfm rmn pnt) eeoxf oydfpDelivo;(  rxmxr oo4am   netltf rtr( poo4aleo octysfs ra(ms;(4 eermo oydoa  aieslt)sexo(m nu4ll  liet s)s2rm(  ;o4tpe ioctadlaDeanmsnt4trtoxo ootop  aivo;s  2xoirpny1altelfeias)srra( ooo1aeeomi3iysla ul(mon() rtomfctodopDe nvilt0 2xr(opiy1lp n neil(f rum( ont1tlenifetatfm2umuvsnt4aetnxoctytlmteanvsl(0 rxoim oo1amt lnetat sDtm(rono1tetomocildfs2uanmpnt) etnxoctodopt  ies;t0teum(o3oudop   fcsls) rumx p;u0tlt mo3tld m
\ No newline at end of file
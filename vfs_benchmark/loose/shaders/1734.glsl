@@ -0,0 +1 @@
+n o;() 2xoxrpoydop  mfes s  rtrumpot4tetomieildfs2em( ont)tetoxr3ta1lpDrlneo s trtoir iu4lpeelies (fartm(rpoo4apto o3tatfmDemnvo t4trxoio3iydoateauvo;s0texo(rpno1olee nei (  Dua(rpnu4aet ifcils s2rl(mo;t)trxnircoadomtran o (0t2xriopou1llen fvs sf 2tau o;o4tpx ifeilsfmDuauvp u0aleoif3oatlaDrlneilt0teumir oo1lme mivi (f Dtr(r nt0tlxnifetad a2umums u4arxnif iytopteai o;s trtoxo3oo1alte nvil()sDtruroou0opeo iciysfsDrl( on(4alxnmfcoydfp  aneo t0sexoir nu1op  lfesasfsrtr( ont0oet  fctytlsDrlu ont0 etrxf tatlmtrauvils) 2uoio oydlpenmnct (faDrr( p;u1tlenioetadfsDuau o;t4tltrir3iy1la  ai ils s2tmxo3no4op e neil()srra( poo1oexniictasla2el(vpnu0altomf3io1lateaivi t  2tmiopiydap  mncsatfs2rm(rp;o4apen fcilsfs ra( snt4trtriocoa1opD  ies;()trxmir oodal n netlsf 2ra(m nt1aeeo ocildla emnms;(0tlxomr3ootopte ivs t) exmxm oo4ol nlietlt  rraum ou0opxn fetydlaDrm(vp;t)aexnmfcty1la eluei;(0s2um(m nu1lmt lfci s s2rmxrpno1altnifeiatfs eaumsn(4 rerir3iadoa rln i s0t2xrxr io4olt mfcia(fs2taurp;o4alxoiiciatlmDul(vs;u)texomo3ia1fm   ies;s  rxmxo iy1olee fvt s)s2taumo;u0tlen ietls mDelu p;(4arxrxr3tydfptr u o;()tetm(m iudop elnvs s) Drr( o;u0ape  ieilt a2rm(vo;t0alxrxfciadoa e i o;(0 2trxr3ou4al nmfetl( arua(  ;u4tptn fcilt m rmump u4 lxnio3oadlm e ivol(0t2xr(opoo4openlfctltf 2ra( pnu1aptnioeiytfaDulnmsn(0aexrir iatoaDeluvo s)s2umxopiy1ol nlivtat)a2taump;o0texo i3iasla rmumsn()aexnxo to1fat ln i;s)texrim3nu4alee fct ()s2rr(  oo0aeeoio3ilt m rln s (4 exnifcoytlp eli sl() 2toxopoudlmtn fcsatfa2ra(  ;o0tpxo ieilsfsDemuvpnt0teerxr oytlatr ivi;()t2xm(o3nodalen fvs ( aDurxrp;t1aexoioetatls2el(ms;t0 eenxr oadlaD aneo t0s2xm(o3oudole  fetls srtmu oot4tet  fctat s rmnvp (4aeeoxr io1lmt an s ()seur(m nydlm nmfei () Drru  ot4altn i3iadls uanvo (0arxrio3ta1lp e u slt)srtm(m nu4omt licil(f 2um(moou1tpeniieild sDel( snt0trenxfciatop  aneo;s teto(rpou1llenlneilt)a2tr(m ;u4tle ii3iyt sDemn onu4 exrio3oodfpteaues (0srtmir3iy4olt  ncia()s2tr(ronu4oeen ieiysfmDelnvs;(0 ltnxo iy1lpDeau slt) 2umio3oy4lleemivi t  Dtax p;u1aexn ietad aDra(vs;(4tlxrxrciadoaDrluvs (0setm(o nodlm   ieslsfarurxrpoo4oeeo f3tldlm umnmsnt4aexnif3iy1la eaneslt t2xrxrpiu1omte icsas)aDrmxm no4tpt mi3tlsfmDeluvo;u4tltnxo3iydlmt  neols s2xoxm iu1apt lfcil()arrm(r ou4oleo fciatls2um(vp;()arxrxf3iadoptr n i (0t2tm(mpoy4lpe  ict () rumxmp;o0apxomoeiasfa ua(vsnt4artrxr oodlmte neslt)texoirpiodom  miet t)a2umxmo;t4texnioctltlm2rluvo ()alxrircoodfpDelneo s0t2uoio iodol   ies s s2um(rpnt1ale  ictyt a eaumo u0texrircootfp  li i;( s2umxo io4ome lfeiasfaDua(r ou0tee if3tyd s emn onu) lerxrcta1lmD ln s t  rtrxopiu1ap  mfcil() 2ta(r oo0olx io3tydfa eanmo t)aeenmo3iotlp eau s s0 exrxr io4ll  liet t)s2taxronu4tltn fctadfaDemnms () eerif3ootfpD  n il(0 eum(m iudlpe lfet s) 2trump;u1alxn fcias aDem( p u4alxnxf3iotlmte n ilt s2xr(rpnodlpt mfcs tf rraxm nt4apt mfcildfa2umuvsnu0alermf totopDeli slt texrxr3no1ome mncs ( s2uax ont4tex ifeiltfsDulnms () lxrmr3oy1fateauei;s seuoirpio4al elnetls)artm(r no4alxnifeiadfaDelu p u4arermf3tytlm rauvs t seuoxrpny4lle  ieiatf Drmxm ;t0oexnmfciadfa2el( p;t4 lxrxf3iytopD ai i;()s2trxm3io1lpenlfcsa( artm(ro;t1oltoifeiydlm um( snt0trtoir3oodoat  ivo t) etm(r3oodope mivt s  2tr(mooo4oexnmicildfs2eluvpnt4 ltnxf3oatomtelneils)sexm(o iy4ll e fes t) Dra(m no1tpx  f3tys s2umumo;u0arxnxr tydfmt liei;s  exr(o oo4apt  fcsltf rumxr ;t0alxn iciltlm2ranvo;(4arxrmr tadfmtrlneilt0s2xmimpny1lpenlietltf rrrx  nt0ope mo3tytlm2um(vpnu)trenif ootlm  auvils)trum(r no1omt  ietat aDtax  oo1altnmfciadlm rluvs (0teerir3oytlmDe neol(0 euoim iy1oltnlnetat)srrau  oo4tptniociatfa ua(ms u) exnif ia1lat liei;s0 rurirpio4olenmnvta() Drr( o;t4alx  ociyt mDumn s;u)teermfcootomtr n i;t0trxoxmpoy4ope mfvilt)aDurumooo4tleomfeiad sDrmu p (0altoxf3iodfmDelivi;() etoxrpiy1lleemfcil(  rtr(ro;o1ole moetytlaDea(mo;t)aetrxo ia1oa eluvol(0 rtoio oo4ap e nct t a2uru o;t0oex  ictldlaDum(mpn()aleniocio1om raiesl()srtmiopio4ape lnet t)sDuaumooo1teeo f3tldfs uan p (4teeoif oadlpDe nvi;()sexoxrpoy1apenmfcta(  rrru pot4oltnmf3tadla2rlu p;(4tlxrxr tadlmtrli ol( t2xmxo nodlmtn ivilt  rrru pnt4tptnmi3tadls elnmpn(4tltrxf iydop elueol( seumxr nudop emivtas)a2trurpnu1teen fctytfsDrln p;(0arxnio todoateln s (0 etoxmpnydoptn nvs ( aDumu pot1tptnmicias sDuauvs () lxoif iydlmt luvi;(  rtrir3iy4al elfei s  Dtmu p;t4tet if3iysla emn o u0 rtoxr iy1fpte ivil(  rxoxmpny4oltemfctl(fa2tmum oo0tlxoio3tys s2ean o t0tetomrcoadlateaneo t0 2urxo3io4lmenmnvta()arrax pou4alxn feilsls ul(msn(4aeenir oydlat aueol(0teumxr oo4al e iei sf 2ur(m oo4aeen f3iydfm2ulu sn(4trxrxo3oytopD auvs;t)trtmim iy4apt mncsasfs2urxrp;t0tpxnifeilt s um( o;u)tlenif iodoptr uvsl( srxo(r oy1lmtnmfes (  rtaurp;t4tle mfeild s2ul(vp u4texoxf oydomtelies;()s2trir3oo4ope  fcta()a2tr( pnt0oexo o3iydfa umu pn(0arxnmrcoydfaD ln ils)sexmxr3nydopte ivtl( s2uax o;t0oet mi3iasfaDrluvo t0tltoif3todlmD auvi s t2uoxmpoo4omtnlivtl()aDum(mpnu4opxo o3iytfa emn pnt0tetrmo3tatoat  nvols)s2tmim3ou1opt lnei ()arurx oou4aleoii3tytls2rlu s;u)aetrmfciotlmDeli i s)truoxo ou4ap n nciat  Dtau pou1apxoiietatlsDrau o;t0 rxnircoa1lat au s;s  rtmiopoy4am nmivsl(faDrm(  ;t4oeeoifciydlmDranmo t)tlerirciatlmte ieo;s)tetoxmpnydamee ivsas)aDuax onu1alto i3tatlm2uln s t)altomo3tydlpDeluvsl()t2umio oy1llt  fcs t)srtax pnt4oltn ieils m2ua(vo u) etomrciydfa  livi;t0t2uoirpnu1lltelncil( aDtrxmoot4ope  ieiatfs em(mon()aexrmfcio1fa raieslt)s2xmxm3io4ole miviasfsDrr(moou4tptn fctadfaDumumsnt0 eenmo3tadlpDelu o ( t2urir oy1opeelncils)arumx  ou1ale mf3iltfaDemums;t)tetnioctodfmte i i ()trum(m nudlmtnlfcsasfsDrmxmo;t0tleomf3iys s2ranvsnu)areomrctydfpD  ieil(0 2ur(r3oo1ap  mivt (  rra(rpnt0teto ieiasfm2rl( p u4aetoxf3todom raivo s)truoxo nydope mfvs s  2rax ooo4tltoiociyd a ra(mp t0tlxrxo3tydop  ai i s  2xrxm3oy4lp  mnvta(f Dtrumpot0tpeoiicilslm uau pn()trtrir3iotfp   i ol( setr(m nodal emfetasfarrmx pnt1oleomf3iad s2el(mp t4 exnmfcoa1faDrai s s s2toxo3oydlpt lfesa(f rur(  ;t1oltoiietldfsDrl( p;u0artoxo oy1fmt lnes;s sexoxo3iy4ome mfci s  2ta(rp;o0oex ii3tatlm2ra( s;()texrxo3oadoate nvol(  2tmxr3oodlm e fvsat  ruru pnt1olt mfctls sDulnmp t)tltoxfctydfpt ai ol( trtoxm3oy4altemnvslt srrrum ;o4alxn o3tys a2elnms (0tltnmr tatfmDeanvs;t trxoio nu1am   ivs (f rrr( pot0oex  i3tls m2uau o t) lxomf3to1lmtran o t0srxr(mpio1alee ivsatfsrta(  ;o4teeo ieiytla2emumo u0 rtnxf iatoaDe ivs;( s2umxopiu4lp nlnvia( sDuau  nu4tltn oeiydla ua(mont4 etrir3oydfmD lnvol( sexoxmpny1lm  lfvi s srtax o;o4alt mfciyslm umnmo;u)alerircoa1la raivils0tetmir3iodomt  nci (fsrur(rooo0opto ietldlsDemnmp;()aetrxociy1op rluvol(0 rxo(m3iudopte fetasf rrmxmp;u1aee ii3tldfm ulump (4 rtrmrcoadop rlnvi;(0 exo(rpny1al nmicilt srrrumooo4aleo i3ild aDeln p t) reomf3iadfaDeai s;t) rurxopnodom nlics (f Dta( pou0oltnmi3tldls ulnvo;()tleoif3ta1oatranvils0srtoxo3nudam e fctat sDumx pot1aleoiociat s2ul(msnu0 reomfctatopD  n i;t)srur(m oo1optnmnvilsfsrrm(  ;t4alenifctls a2eln p;(0arxnxo ia1late neil(0tetoxm no4aptemfvs s arua( onu1tpxnmieiyt a eanvp;u4 rtomf tadomDranei (0t2um(opoy4ope mnei s) 2um(mo;t4tpt  ietldla eaumo;(4 rtnmo3ia1fp eanvi;(0teurxo no4om nlivsl(fa2rm( p;o0aeenmf3ildfs2umn snu) ltnircty1fate uvols)t2tm(rpno1oltn fctas) rtau ont0aetnif3tadlsDrm(mp () exoio iytfmDe i o t0trur(opiu4ol emnei ()a2umum ;o1tlt iiciytla2umnmo t0 leoxr3ty1fpDraieols s2toxo ou4om  mfvta(fsrrmurp;u1alx ii3iadfa2um( s t0 rtrxrciy1opD ln ilt)teurxopoudlpee nvils aDumurpoo0oex mocils aDea(vs u)aeenxfcoodfat  nvs;t)setm(o oy1lmenlfciat) Durum oo4alx mi3iadfa2rauvs t0trxoxf3iatomt  uvsl(0trtrxopiy1al elnviat aDuaxrp;u0oee io3iltlm ua( p t4alenio3tydlatrlues s0srxo(opnydol nlnvs ()s2um(moot4apxnmo3iatfm ua(mp;(0 rtrmr3oy1optrluesls  eurxo ny4lpe liciat) 2tm(rp;o4teeoifcild mDrl(vs;t)alerxr iodopDeauvi ()teurxr3iodll n fetlsfs2rrxmpno1altomf3tadlaDra(ms ()texrir tydfmDeli o;s trxmim no1lmen fctatfaDuaxr ot0oex  ocilt m2um(vsnu)trenmo iydfateanvs t  2toim oo1apt mncil(fs2tmxmoou1apxoifciysla rl(vp u) lenifcoo1omDr ivols0 2xm(m iy4apen fvi t)a2trx onu0teeniictytls2rauvo;u4 renxociatfmD aivsls0trtmxmpoydaptnlneiatfs2urxrp;o1ale mfciyd aDuluvsnu)arxniociodoptean ilt0s2xo(r nu1lleemivsasf Dtmxm ;o1texn feils aDumnvp;() eeoxf3ta1opD  nvsl(0trxo(m no1oltn fctat srurxrpot0alx ioetld aDran sn()aetrxf3tydfmD aivs;s s2xr(m iudlmte icsl( srtrx o;o0tee mietlsla2elnmo;t0aeeoxo oydfaDrauvs;s  2xrxo3nu4llenmnci t) 2uaxr nu0oltomf3iys m emump;()tetoxrcootfatelu s s  rtrirpiudomt miet t) Drrxm nu0opt  ociysfaDrlumsnt4trtoiociotfmte ieo;s  rtmir iodomenlivsl(f 2ra(  ;t0aet ioeilt s2um(monu) renxf3oa1omD an i;s0srtoxrpoodamenlietasfaDuau ono0aleo fciatls um( pnu0alxoxf3oo1fmD  uvolt0 etmxr3iodapt lnesat) rumumpoo0apenmociad a2um(ms;u)trermf3tytfp  lu s;()teurxrpnu4optnmieiatfs2uauro;u4tlt if3tytfm umn pnu) rxrif todomDran slt0trxmxr3nu1amee fcsatfa2urxmonu4apeo f3iadla uln o;(4 lxnmfctydfmte uvi (0seum(opiydomtnmfet s aDua(mpoo4aptn f3iltfsDuaump;(0tlxrmrctatfateluei t srxoim nydlm n ivtltf 2umxrp;u0opx iictydfs ul(msnu0aexoir oa1opDelueol()trxoxmpoydope mfvtlt artmx  ou0oetnmfciyd a rau ont)tltnmrciadfaD  i il(0 2xrxrpio4amtelnvs ()sDuaxrpou1oee ifeiys sDul( snu0texnir iatfmte n s;s  exr(m3ou4al n nvi ()srumurp;u4apto ieias aDem(msn(4 lxomo tydopDrli sl()seumimpno4omee ncs (  2rmxro;u0opx mfciasfaDem(vsn(0artoio3oa1om rauesls0t2xrxopiu1alee ncsa()sDrrumpoo0teenif3ias s2emu o;u0 rxrxfciodoa   uvolt) 2uo(opiu4lmte iesasf Dtrxr no4aeeomietldfs ra(vpnt) rxomfctotlpDran ils0setoxm oy4op  mfeias s2rr(rpou1aexn iciys m2eluvo u)aeeoirciodoa rai i t  2uoxopnudamt mnvta() 2tmxrp;o4opto o3tldlmDel(vonu) eeoir totlat ln s;t texo(rpiy4altemicsat)a2trumoot4apto ocildfa umu p;t0 etomr3oy1fpD  uesls0srtoxmpnu1ll  livil() 2raurp;t4tlx  fciadfaDeanvo ()alenio ta1omtr i o;s  2xmimpio1lme  neta()arrmxrono4apenifeiytlaDumumpnu0alxnir oodlpDr neo s)t2umio3iy4lp  livils srururont4tee iietls s rmnvsn() etnmoctatomDeanvo;(0t2uoim oodlleemfesls  2umxm nu0aeeomictadfm eanvo;u0 etomrcoodfpDelnvsl(0s2uoiopoodalte fcilsfs2ur(r ou0alx if3iad m2ulnvp;u) eenifctodlmteanei;s t2tm(o3oy1amt mfei sfsrurx p;u1tpx moetydla2rauvo t4 exnir3oa1lpt  ivi () rtrimpnydal n ncil()a2rrumpno0oeeniieiyd a elu s t) lxrmf iodoptraues;(  euo(o3iu4ap  liesatfs2umum ou4teenmfeiydls2rm(mo ()alxrmfcta1op e ueo;t) rxrxrpoydom  lfvt t)aDum( poo0tlxnmiciatfa eaump;(4aeenifcoytfm r u s s) etr(r3nu1amtemnct s)a2uax o;t1tpxomfetatlaDua( pnt4 lxoxfciydlp elueo t sexm(mpiodlm n nctasfaDur( p;u1tlen iciatlaDem(mpnu)aexnxf3iotopDr ivs;(  rurio3no1lltnlnvia(f 2tmurono0apto f3iltfa2elnms;t)treomfciydoaDeliei t)trtmir3iu4ameelnvtls  Drauro;u1aexomoeiatlm2rln o;t)aleoxf3oo1lpDelueo;t) 2ur(mpny4omtemfcs tf Draxmpnu1tlxoiietatlsDrlu pnu4aetnmr iy1omt livolt) eum(mpoudol  livia() rua(roou1apto i3iltla2emnvo;t0treomf iodoa elivo;()srurio3iydapeemnviat)arrmum ;t4tltnmfctldfa2ean s;(4texoxrcio1fpD li sl( s2xo(r3nu1lp n ivs ()srtm( pnu1olt mi3ias s rm(vs;(0alxoif3oa1op elivo;(0s2um(r oo4ap nmfcilsf Duax o;u1alxoioctlt m2rlumo (0aleoif oatfmD livol() rxrxo io4omtnlfeta()s2rmur no0aptomietlt s2ul( snu)tetoxf3ty1lat anvi s)srum(opiy1op nlivslt sDraxrpnt4aexn oeiydla2elump;u4 exrxocoytomDr u o;s)s2xoxmpnodlp  lnet ( s2rrurpoo4teto i3iat a uau p;t0 etnmrcoy1opDrli i t0teur(m oodale  nvta( sDrmxmoot0ale mo3ilsla2eluvs;u0 lenio3ty1lmDelnvo;s sruoir3ou4altelnvtlt)a2tru p;o0apeoioeias mDrmumon(4 ltrio ty1oa  anei;( srum(r3nudamenlfvi s s2rm(rp;o0alxnmf3ilt sDrm(vp;t4aetoir3iatoat  iei;t)teurxmpoy4lltelivi tf rtmx oot0aex  fciyslaDraumsnt4trtrxocoydlmDelu ils  etriopoy1opeemnvs tf Dtmxm nu4oeeo iciydfaDuanms () lxrir3ootlp elues;s)seurimpiodamt mfcsas aDrr( oot4opxn octldlaDem( snt0tlxnxr totopDe uvs;()trtoimpnydlle lnctat  Duaumpot4tle iiciytla2rau p u0aexnmfcio1laDr neol()setoxm oodol e nes s a2um(rpot0aetnifctatfmDeaump;t)tltnif tytlm r ues;s) ruoxrpny1omt mivtatfs2uax  ;u0opeomieiyt a ean o u)aexnxr3oa1opt an s;t0teurirpiydape lncil() rtmx oou4apenmi3tytla uauvsn()aleoxr3tadoaD lues (0s2xmim3iydlleemnesat a2ua(r oo1tptomf3tyt a2ua(vsn()teeoircta1oate nvi;s trxmimpno4lpen ivsls s2tmumpoo0aetnmictld m2em( s t0tltnir3iy1fmD  nvo ( sruoxr iu4lp   ics ()s2uaurpot0alen iciytls2ul(mp u4trtrmoctytfpt li i;s0t2xrim oy1om elnvil()s2rau o;u1aeeo oeildla2ul( p;u0aetrmfciatfptr neo;(0 eumxo3oy4am  micsatfsrua(m ;o0alx iieilsfm2rm( s;(0aeeomr iodla rlnesl() 2xr(rpio4lmeemivi (  ruru onu1tpeomo3iytfmDrl(ms;t) rtoio todfmteau i;s)srumirpou1lmt  neiatf 2ururpno4aptnmiciadfm2elu s u4aetriocia1opDeanvs t)teto(m3oo4optnlnctlt)sDrmur ;o0opt moctys aDumumo;()tlxomr ia1lp e neo t)teur(o3iodllenlnvi tfsrtaum ;t0ale mfcildlmDumu s t)trtoir3tydfm  livo;(  rumir3oudlmtnliei sfs2taxrpno1opx  oetytlaDumu pnt4 lxoxrctytfmD lu sls)t2toirpoy1opeemictas aDtmxmp;o0teen ieiltla el(mon(4tetoxr oydlm   i i;(0t2to(r3oydalt lfcilt) rra(  oo4tet mfeiys a elump;u4 exoxr tytoa  lues ( trxrxmpoodamte fvs ()s2umum ;u1open octas a ea(mp t4tltnir iytfmteanesl(0sexoxm iu4apt lfctas)s2umx o;u1aptomf3iydlaDumnvp t4 rxoxrciydlaDrlivi (0trxo(o iy1ll nlnviatfarur(moou1tee  feilsfa2emumsnu)tetrif to1om   neo;t0 exmiopno1ap  mieta(faDtaxr nu1oeenmo3ilsls2rlums (0trenxocoy1fateln s (0texrio3iu4amt lnci s)aDta(  ou4olt  fciltla eln s;t4alxnir iadlpt livs;( s2xr(m3iy1optemfvtlt) rtaumooo0olxoif3ild m eanmo t)tltnifctatfpt ai s;s0teto(mpnu1lm   icsasfa2tr(mpot0opt ioetadlmDelumo u) etomfcoadla eliei;s) rurxr iu1ap e nvsa(fs2ra(r ;u4ole ii3iys m el(mon(0 eenxrcootlp rlueil( sexmim ny4al e ncilt)aDraxmp;t0tlx  fciys m2el( sn()altrio3ta1omDraneo t s2to(m3nu4lm emfcs (fsDtr(m no1teeo fetadls2ea(ms;t0 renxr3oydoa rauesl(0 2xmxr3oo1lp nmnct s aruaurpno4apeo fetytfs uanvs u4alxrif oydfmtrluvslt trumxrpoodom emnesls)a2tmxmpoo1apxnif3tysla2umnmsn(0arerif tadopDrlieols)s2tmxm3ny1lpee ivs ()arra(m ;u0tlxoiietldla emnvs;u4 ltrxr ootfp   nei t0 exmxm3iu4apenmiciat)sDta(m no4opeomieiysfm rlnms;u4arenmr tadlp eauei s t2umir nodaptelncs s)aDtau onu0aexo o3tatfm2ra( o () ltomf3oatoaD an s;() eurxr nydoltnlneilsf 2tm(rpnu0tptnmfctydla2emn onu0arerxf ty1fat aivsl( s2to(mpnu1optn fvsl(fa2rax ont4tlx ifciytfm2rl( p;(4teerxf3iatfaDrluvi;s)teuo(m nudlm  lfei (faDtmuroot4altn fetld s ua( s t0trermoctatlp r n o s)sexoir ou1oltnmfesl() Drmum ;u0tle  icild aDelumsn(0tleomr ootoaD  u s s)teuoxm nu1omtnlivs ( srraumpnt1opxn octatfmDulnvp t)aexnmf todfmtrlnei;()s2xr(m ny1lp nmies sfaDra(ro;t0oetniieiyd s2ulnmont)aetrmf3oa1omDrlnvs;t texm(o3oo4amte nes (  Duaxr ot1olt ioeiadfs rlu p;t4aeenxrciadfa   uvo;s)teur(rpou4ame lfvsat) Dtau oou4oltnioeiad s2rm(mo;u) rerifcootoa r i i;(0tetm(r3iodolenmfcilt)sDtr(mpnu4ole mo3iyd m rmu p t0alxrxo3iy1faDeauei;()trurimpny4apeemnvia(  Dra(  ot4tex iietyd mDrl(mp;(0areomo3to1lmt  uvo;t)s2xoxopno4altn ivsltf rtr(r nt0tpeoioeildfa2eanmp u)tleoir3oytlmt lu o t)t2uo(r nu1ap emfctat)arum(rpou4oexoio3iat s umn o;u)teenir oadfptrln il( s2xoir io4alen nctl()a2uaum nt1opeoifeias a rmums u0tlxoif oatlmD luvi t srtr(o3nudll elfvsl()a2raxmo;o4olenioetasfsDum(vs;t0arermo3oatfmtrln ilt srurxm3nudol n neslt) Dumxr no1alxomieias sDuan s t)aleoxf3oo1fmt lues;t trtmxrpiudap e iet ( aruaxmooo1optn fciatfs uln snu4teenir iy1fmt an i t  2xmio3oudaltnmiet s srtax o;u0oee  fetadfsDuanmp;(4altomrcta1lmtraueols  exoiopoydamenlfctltfaDumu o;u0apto ociyd m2ra( p ()aexrxf to1om eaneo t) etr(r3io1olen iei tfsDumxm nt1oltomf3tld m2rmuvo (0teenir todomtrlues;t s2xrir ou4amtnmfeiltf 2raum nt1aptn ieiad m eaums;u4artrio3iatlaDeanvi t teurio3nydam n fctlt) Drrxmpou1tet  f3iydlmDuau s;u4arxnxo3oatlmDeanvs;t seumim3iudol e icsas) 2uau pnu4tlxomfetlsfmDuaumont) etomrcto1fm eanvs ()seurirpoydaleelnviltfaDra(m nt4tetoii3tlt mDrauvo;u0 rxrxo tydlmtr i o ( setrxr ny4ol emncs sfsDrrx ono0olenifeiyt mDumnvo u4teeoxf3ootomt aneo;s trur(mpnu1ome mivi ( srta(m oo1alx ii3ilt m eanvp;t4trxnif3iodopD ai o s)teuoxr3nodomte nctat)sDtrurp;t1olxoif3ilslm elu p t)texrxr3iytfaDrluvo;( t2uo(rpoudale mncslt  Dtaxm ;u1alxnifetysla uanvo u0texomoctytlp r uvo t0 ruoxm io1ameemfct s)a2tmxm nt1teeo i3iatfa rlu o t0tetnxr3to1oateaieo;t t2xrxopoo4aptnlnvtasfa2umx  ou1aeen feils mDeauvsn(0aeeomfciydlpteli o;t t2to(m ny1aleemieil() 2tr( pnu4open i3ildfaDulu s t)tetoxo3oatfa e ieil()srtr(rpoy4alee fct s s2uaxmooo4tetomfctadfm2ra(vo t)artrxoctydfa   n i;s) etoir3no1ale mnetatfsrrmumoot0tee  o3iys s2ranvpn() eenxf iotom rai slt) rxoxrpoo4llt mietls)s2trx  ot4texomfeils sDemums;t4aeerir3iytopDr nvs;s  exoxm nudom nlfesas arraump;u4aex ii3iasls um( p;t4alxnxf iadfmD au ols  2urimpnodll   nvtlt)a2uaxm nt0tpx moetldfmDuauvo ()teeomr3tytfmD au s t s2xm(rpny1lp n netatfsrrr(  ;o1tetnio3iytlm ua( ont0arenmfctydfaD aivi;(0s2xrxo3ou4om emici ()srur( ono0aleomietld s eauvs u4 etnif oo1lm elneil(0srxo(o3iy1ap n nci ( s2rm(mono4tet  icildlaDra(mont0 leomrciotfptrlu ilt0t2xmimpoudal nmnctas s2uaum no4olenmieiat a2uluvp;(4alenio io1fat ln o;()trxm(r3ny4lme  nvil(f 2ua(m nu4tpt iiciydfs ra(mont0arenir3oy1optr ies;t0t2toxr iu4lpt lfesl(fsDuax o;o0tlt  i3tas s rmu snt0 rtrxr3ta1fpDeanvo () rxrxo3oo4am   ivi (  rtrurpoo4tlt  feilslm rmumo;()artrxrciytfpteln sls0 etoimpiu1ape liesatfaDuaxm nt4alenifeilsla2uanmonu)artrir ta1omt aieolt0 2umimpnydop   icilt) 2urxmpou0tlt ifctysls umu o t4 rxnio oodla eln ols teuoio oo1ol elnei (fa2tm(  nu4openmfeiatla2uaums (0artrif3oydlmDe n s;s) rumir no1op emnvsat  Duaum nt4oetomictldls2ran p;t0aetnxo oatlmt anvi (0teumxr iu4omte iet ()artr(mp;u4oleo o3iysla2ra(vo;u0aetnif io1fmtranvi;(  rtrxr no4omt mfvsl(fsrrm(r ot4optn ieiat aDem(vp (0arxoxo todlaD  n s;s)srumxm iy4ap elictl()sDraumpot1aee ifciydlm2emnmon()teermr iydlm  li i;s) eumir3no4amt mivia(farra(r ;t1ale mi3tldlaDrmn p t0 rxriociydoptrai s;t0truoxm iodolte fcs sfs2ra(roou1tpx if3iytlm2ra(vo u0tetnxfciy1opD luvi t0 2xmir nodapeemncilt)a2um(rp;o4tltnif3iysla uln sn(4 etnir iatom rlieo;t  rtmxopou1ol  livias)a2rrx  oo1aptnmictltfsDranvp u0texoiocia1op  lu olt trxo(m3nu1olee ncsas)a2tmurp;u0tle  i3ilslsDrmumo (4trxrxf3iadlaD lnei t) exr(r oo4aptn ivt ()a2ta(rp;o4apenmf3iyslm rm(vs;u4altrxf oatomteanes s)s2um(r nu1lm nlneiasfs2uru pnu1tpto f3iaslm2ulnvo t)aetnxr io1lmt lnei (0tetr(o3io1apen ivs t aDtr(m oo4apt  feilt a2rluvo;t)trxrif3oytfmDeanvols0setoxm ou4llte iet s a2tmu  nt1opeoif3ildfa ea(vont4aexrmrcoa1oatr ivols0 etoim iydolte ivsls  rrrx pou4olt ifeias m2rm( s;t0tltrmf tytlatraueslt0 rxoxmpiu4al  lieia(f 2uax p;u1oet mf3ildfm el(vo t0aeermfciotlpD  uvs;t0 rtm(opoudopt licia( aDur(mono1aexnmo3iat a2elnvpnt0aeermrctadfmDeaiei;()truriopno1am  lnvsa()a2trxmo;t1tpxo feilsfs2uluvpnt) exoxo3to1fm e nvo s s2to(mpoo1omee ietl( s2uaxrpoo0ape ioetldfaDel(vpnu)teeoxrcty1lat luvsl()t2toxm3ou4altelfct (  Duaxr no1open octld s2uaums u4altrxf oatlat lnvils  rum(mpiu1alt  fvt ()aDtmumpot0tet  ieiysfm2rm(vonu0tltoxrciatomt li i;s0 exrir3oo1apenlfcias aDua(r nt0tptoifctys a uanmsn()texnmo iotlmD  nesls)trumxo3oydom emivt tf rur(rpot1opeo i3iytfmDean o;(4 rtnif3tytfp r u o s0trxoir nu1lmenlivi sfs2ra(ro;u0aeen o3tyd m raumsnu0aetoxf oodoatelivil()tetoio3ny1am   ics () rrr( pno0aleo oetltlaDel(mo;u0 lenif iatoatrlueols0sexr(mpoudopte nvsas s2uax o;u4oex ioetlsfm2rl(vp ()aexrmf3oo1lm eanvsls)teumxr oy1apte iviatf 2rm(  ot4tpto iciadfmDuan ont0trtrmrcty1omDelueolt)t2tm(mpio4opeelncsl( srrmxmp;u4oleo iciad sDel( s;u0trxomo3tytfmteli il() exr(m oo4llte feslt) Dtru poo1oeenii3taslm2rl(vs t0 rxomoctotfptelues s) 2xm(o3iy1om nlnetasf rtrur nu1aptniieiatla2rlnvo;t)trxrmo iydlm rluesls texo(r nu1alenlfcsltfartaum ou1texnmo3iytla2em( o u)artnxfctatfaD anvs;s)srumxm oy4om nmivt s arumurpnu1tetniictadls rl(mo t0 renxo oy1laDr uvils)s2trimpnu1aptemfvsa(fa2tr(roou4oetnmfctasla ea(vp;(0tetomo tytlat lueo;(  2uoir3iy1lp   nviltfsDumu  ot1oet iocils m2rmnmo;u0arenmrcootlaDeln o t t2xo(m3oudlp  lnvi ( a2trx ont1tlxo o3tasla2raumonu0 rxnif3oo1lmDeau o;t)teum(rpiy1alt lfct t) rraxmp;t4tetniocildfa2umn o u0alxrif todomD auei;t t2xo(o3oy4alenlivsa( s2ua( p;t4tpxoiicilsfsDeanmpnu)aexrir3iytomDelneo;s0s2xrim nu4omt mfesls s2rau  ou4apto i3iaslm uluvp;(0tlenxr ty1fp elues ( trxoir3iodopenmncils s2ua(mpou0texnmfeiadls2elu s;u4 rtniocoatopte neo ()teumxo iy4om nmnctl(f 2ua(rpou1apenmfctadfs rau s;(4aexnxo iadomtrlueo (  euoxrpoudap emivsl( a2ta(mpnt4opxnifciaslsDemnmsn()texomr tytfm  auvsls0seumxm ny4lpt  fvi ( s2umurono0alen f3iat m2ranmo;(4tltoxf ta1la ranes t t2xoxr3no1alee ieil( srrrxm ot4oleomiciadls ul(vs;t)trtrmf iydlmt  uvol() euoxrpiudlm   fctat aDraxmpnt4apeoifetas s2ran pnu0 lxomfcootfmD aivo t texmxm3ny1lmtnlfvtl( a2tm(rpot4alx mi3tls a2rln pnt0 exrmo io1omtr uesls)srxo(rpiu4ap  mfvsas a2rmx ono4oleo i3tlsls umuvp u) rtrmf3tydfpDeluvilt  rxrxo3nudlmenlfctat) 2tau  ou0aee mieiasfsDranmpnu4tlxnmf3iodfmteaues t srumim3no4omeemnciat)aDta(m ou1tlt moctlt m rmnmp u4 lxoiocta1fmt  ues;(0t2xo(m3io1lp nmiesls) rrrumpno0aexnmieilt a rl( pn()aexrif oodom e nesls0 2toio3io4op  mnctat)aDrau  ;u0apx  ietadlm2ua( pn(0texrmf3oy1oa e n ilt0t2tm(r3nudole lfci t)arraxrono4oltnmfeildlaDuluvo;(4artnir3iydfpDrlneils0 rxmxo nudape lietltf 2trxm ;t4optnmfctldla emnvon(4 rxnirctatoptr ivs (  eumxmpio4olee icilt srur(rpno4aeto i3ildfmDrluvs;t) rtomo3iydlatelnvs (0 rxrim iu4oltemict tf 2urum ;t1aet ifctldls2elu o u4 eerxfcoydoat livslt)trxrxm oy1lltnmici () Dumumo;t1tlxo f3ils s2uluvs;u0 lenxoctodlpDraueo;( trtmio nu1om  mietls arrmxmpot0oet mfctldfaDrl( on(0aexoircoodlpD  uvs (  ruoim iy4alenmict ()arur(mpot1aee  ietyt mDum( p;u4aeenio tytoa  li ol(  2toimpno1apen feslt)s2tmurpnt4alxo f3tld sDumn p t)texnir3oytopt auvs t teto(o iu4ll nmnct s sDtmxmpoo1apt iocilsla rlnms t) renmo3tatfa rlivs ( teto(m3no4omt lnciat aruaxronu1tpeoiiciydfm rlumsnt0tlxoxociotfm  lnei t  rxmxo oudlm   fvt t) rtr(  ;t0olt moctyt m rlumpnt0 eeoirctotomDrlnes t  2xrirpoodopeelfvilt aDum( p;o4aetoiieiat m2emums;u) eeoxo iotfpD  u olt0texrimpno1om  mivs tfarur( pnt1tlto ieiydfm2ra(ms;u0 leoioctytfpDeaivsl(0sruoir3oy4al nmicsas) 2umxr ;o0aet mi3iyd m2ua(msn() eenio3oytop eliei t0sexmxrpoudam elicia( aDtru ono4tptnif3ilsfs umnvo;u4tlxrio3tadlp e ivo (  2xm(m3oy1om e iciasfsDtau pou0aeeo oeias a2ulnvs ()trxomr3tadlm rlieilt tetoimpoudol emfetlt s2ururpnt4tex mo3tysfsDelnvon()treoiocta1oa  livil()t2xo(o iudomtnlfetas aDtmumpoo1tlxomoetatfm uluvpnu) leoif3oa1opt  uvsl(0 2xo(opoydoltn fetat s2ur(  nt1oex mi3tyt s rlu s t0tetomo ty1fmD auvsls)s2xr(mpio4al elnes (  Dtaumpou1tltn f3iytfs rln o t4artoxrctodlatrau i s)trxrio iu1op nlivil() 2rax  ot4apeo i3tat m2em( o;(0tltnirciadfmDrauvo s t2tmir iodlptemfcia() ruaurp;u0alto f3iydfm2ua(ms () rtrxf oo1lpDrluvslt0t2tmirpiydomtnmics s sDuru  ;o4aptomociytlm2umnmon(0texomr oodlaD  n o () 2xmim iu1lpen fvi sf 2umu p;u4alx  fciatla umnvo u0arxrmo oatfmtrlu sls)setr(m oydom  miesls a2um(m nu1aptn ieiltfm uan pnu0trxnio3totfm eli s;s)srumxopoo1ol nmnvta(fsrtrumpot1aetn feilslmDel( pn(4altnmf iy1omtr u ilt  rxrxo3oudamee ictltfsDumu o;t0olx io3tys m2el(vp;(0teerxf io1late iei s0teuoxopnu1ll  lnviasf rurur nt1opx mo3ildfa2rm(ms u0aleomocoydfa r nvo t) etm(opoy1lle mici s)srrrxmp;o1alto ietadfa rmnmon()alxoxr to1lp  ai i t trtmxrpiu1olenmieiatfs2uau ono0apto octad sDrmu o;t) renxo iy1omDrli s;s  exoxr ou4lm nmiesa()s2uaxmono4aptomictys m ran pnt4 lerir3oatoptrlnvolt  rumxm3io1omtemnviatfsrrm(moou0apxoii3iys s eauvs;(0tetrmo iydfaDeaivo;t)s2uoim oo4openlnvs () rraum oo0oltnmictadfs2uanmsn()alermf ootfptr ieo;(0 rxrxm3io4lme  ivt ( aruru o;u0tlto ieildfa ulumo;(4 etrxocoa1oaDe ies (0 2xrxm3iydlmeelnctat  Drr(rp;u0teenio3tat aDrln p t)arxoxr oa1lmDr u s t0srtrirpny4lpen fetas  rumu p;o4altnifeilt aDean s (0trermrciadlp elivs;s)t2ur(m oy1apenlnvta()srraumpoo4oltomf3iydfaDuln p t0trtoio3iatfpD ai olt0trxr(mpou4amenmicsl()aDraurpot4tltniicias sDrl(mp u)artnxo3tadopt ai s (  exmxmpiydoltnmfvi (f Dururpot4aexo iciys m rlnvonu4tetoxo ia1faD ai il( t2umirpio4am e fvt () Drr(r ;t0tlxn ociysfa2ua( s ()arxriocoodopt aueil(0 2trirpno4op n nvtl( arraur ou1aetn fciltfa rmu p;u4altrio oadlpD livsls) 2xmiopiodamtemneta(fs2tr(rpnu1tpxnioctlslmDra(mp t0alxrir3iadopteauei s seum(rpiy1ame lnci (f 2taxr ou0alenmiciltlm ulnvs;u) reoiocoy1fm e nvslt0 2xm(opiudll elnvias) 2trxm ;u4oexnioetadfa ua( o;()alerxo ootfm rln s t s2uoxo3oy4omen fvslt srtmxrpnu4tlxnmociytfs rmnvs t) rtnxf3to1fmt  uvo s)tetmxr oy1alt  ivslt)srtaumpot0oeenio3tlt m2umu snu4artrxr3tatoaDrlu s;() etr(opnodomt lici s)aDtaxronu1aee mictlsfa um(mo ()altoxo3oytoat ai i s  exmxo3nu4lltemics (fa2tmxmpoo0oetn fetasfm2eluvo u4altnxf3iydoa eluvo (0s2umxrpiudll n ieil() Dum( onu0teeniieiatlmDel(vont0 eeomrcoy1op ran i s teumxr3oydal   ici s  Dur(r no0aeeo ietyd a2uanvont4 rxrioctodlat lu o t) eur(rpoudol n ivil(f 2rr(rpot0alx  i3iydlaDrm( p;(0trtnifcia1lm eliesl( setoxo3oy1ole  ies s sDuau p;t4oetniociltla eaumo t)artnir3oadfa elu s;s0 2xm(mpoodomt  fvsa()a2trxmpot4tpt mictlsfa2uanvsnu4altrmo3tadfpteaues ( s2xrxo oydaptemfeias  rua(m oo1aex iocildfa2eanmo u0trxrmr iadfm ean o;s  etmim ny1ll  liet tf 2umx pno1apxn i3iadlm2umuvo t) lxnioctatlaDr nes t)srxmxo3iy1lmeemivias)srrru ont1olx io3tatlm2rln s u0altrif3oadop elu ols0teuoxo3oo1open fvias a2rmur nu0aleo ieiasfm2rmuvpnu4 rerxr io1opDrau slt)trtmir3ny1ap elnetltf rrmxrp;u4tpxn ociasfaDeauvpn(4 eenio iotlp raues;t trtrirpiydopenlfcs s  2umxront0tlx iieiasfa2ua(ms u0tlenxf iodomDeau s t0 rtoxm nydll elnvi s)sDraxrpoo1apt io3ils a2uau p t0arenxr totlm   nes;t t2uoirpiy1apeelnvsa()s2tm( ont0oetnio3iasls2rm(vsnt0 rtrifcta1omDe ivi (  2uoir3oodom   feslt artmxr nu0tee ioctaslmDel(vont0alxrxf iotlaD aueilt)tetoimpiu1omtnlncs s)sDrru pnu4optn ociys sDelnvpnu0 eenxfctotoptrlivo;(0t2to(m oo4lptnmietl(fsrtau o;u0apen f3iys a rmump (4 etrxr3oydlmDraneols)t2uoxo iodome  fesltf rtmurpnu0tpxniietas s ua(mo;u)aexrmo io1oate u sl( trtmxopiy1ameelnct t)aDtaumont1opeomf3iltfsDelu ont0aleoxfcoa1fmDr uei s0t2uoxr iudoltn ivils s2ur(m nt4tpxomfetatlm rl(mp t0tlerxf3oatfpDr i s;t texrim oo4oltemics t)a2ua( poo0tlt iieiad sDua( p;u) ltnxrctatlmtrai ils0 etoir3oudamtelneta(f Duaxronu4tpe moetltfm2rln snt4arerxo3tadfmtraneo;(0srxoxopoudopeemfvta()a2ra( ooo1tpeniieiydla raumo ()alxomr3totoptr iei;t0 2urxm nu1omtn fet s srtr(m ;u4alen i3ilsfm umuvo;(0 rerxfcoytfptelnesls)trumimpiodameemivt s a2tmumpno0tlxoiictat s2rau snu)tltoiocoydfpDe ueil(  2trxo3ny1ll nmfvsas  2ua(r no4oleo octydfm emn s;u4tlxnmr io1omD  i s t)srumim iydlltnmnviltfaDtm( pot1tle mf3iys s ulump t)teeoif3tatlm  aneil(0t2xrio oo4olen ieia( s2rau pnt0aexo f3ilt a2uaumo (0altoxr3io1lpt  u o;t)s2urim iu4alte nvsls) rurx oou0tlt  o3iyt mDemnvsnt0 etrif3ta1fat an ols setrxr oydlmeemfvt t) 2uaxrpno1altomfcilsfs2eau o;(4aetnmocia1oaDelneo;s truoxr3ou1opt  fct () 2ra(m ot0alto fciasfa2emuvpn(0alenio3ootoa  lueo;s  etmxm iy1lle lieiasfs2um(rpou4tpeo fciys m2ranmsn(0teenmo3oadla e neo s s2ur(r3nodlm   nci ()s2uru  ;o4apx  feildlsDra(vp (0alxomr3to1oateai i ( texoxo3iu4apen fet (faDrmur nu4tpto fcildlsDran o;u0areoirciadlmD aneo t0teumxr3oydole micia()srrmxmpnt1aptn o3iyt m2uln snt)alxoxo iotopteaivo;s0 rxoxmpio1lle mfvtls)a2rruro;t4texomf3tytfa2elnmpn(0artrio tatfatelnvols  eumxo io1opte ncils a2tmxrpnt4olxnif3iyd s2um(vo;(4treomr3tadfaDr nvs () 2to(opiodlmee ivilt) rtru ono4olx  i3tadfa2um( o (0artoio oatfmt aivol(0 2xrir3io4om emfvsatf rtmxrono0oet  ieiad s2eaumo u4artnxf3oo1fmDeanvo;s  2xoimpno1oleelncs () Durxmpou0aetnifeiydla2uanmo;u4tlerxo to1latr uei;s)texm(m nu4om e neils)sDta(rpno4oeto fciydlmDeauvo t4 rxomo3oatoaDeauei;s0tetm(m ny1alenlieslsfs2tmurono0tpenif3iadls rln p (0tlenxfcoadlp  liei;t teurim3no4omeemfctl(fa2ua(  ou0olto octasls rlu snt)tlerxf oo1fpteluei;t0t2toxmpiudope  fvsls) rtrx o;t1tet  f3iytfaDeanmo;t0 ltoifcta1laD  nes t  ruoio nudlpen icils  rra(moot0apt  fetltlm umnmp;t)teenmo3ootom  auei (0tetr(opio4al  lfeslt)srraump;t1tle iietlslmDulums (4alxoir iotoaD auvols0 exr(r oy1lltemnviltf rrrxro;u1teen fetyslmDeaums;u4artnif3tytoaDelivo (0trtrir nu4ll nmfctlt) rurx pno1teeomfeilslsDrlump (0tetnxf3iatfm   iesls)seurir3iu1openmfciat srtrxrpnu4aeen ieilsfs raump;t0 eeoxo3ta1oa rluvils) 2um(r nydomte icslt srtr(mp;u0tpt  ieiyd a2uaumont4 renmf3ootfa r i s;s)tetr(mpoo1ope lietls) rurur ;t1openif3iyt a2ul( s;u4tlxrmfctodoatr u o;s srumxr3nydlpee nvilt)arrr( oou0texo oeiadlm uln onu0 exrif3iy1omDr iei () rur(o ou4ome mfvt (f 2umuroot1oleo f3iad mDuanmsnu0tltrxfciy1op  lu i;t0 rtmir3iy4ap n fvtls)aDtrurp;o0ape miciydlm2el(ms;(4alxriociytfmtranvo;(0t2toiopiy1opte iesls)arurumpoo0tpeoif3tytlm2uanvs;()arxoiocoodfa elu s t0 etrio3oo4omtn ics s s2rax ono1tex  f3iys s2emu pn(0texoifciadlpDrlnvs;t t2tm(mpno1ameemivsat  2umxmont4teeomieiyslmDumuvonu0 lxnif3oo1lat anvi;t t2ur(r iodopt  ivt sf 2tmurpno4opt iieiytfa ra( p;u0tleoif iydfmtr uvs;()s2to(rpiu1lpe mivs tf ruaxr oo1tltomiciltlmDrlnvon()aetnmf3oydfaDeaieslt  exoir no1ap emivia( arururonu1ale mo3iys m2rmums u4trxrif3oa1laDe ivo;s0 rxr(o oodope  ict sf rtr(mpno4tpen feiytls2rmnms () ltnmocootlp e i s;t srxm(r3no1ll n iesa(f rrmxr nt0tpeomfeilsla2ea(vpnu0 exnir3tytlpt aneils0sexr(mpnydolt lnctat sDtmu o;o4tle  o3tyt a uan s;u4 ltomf3oy1lpD  nei;()truoxr3iu1olen iei (  Dur(rp;u1alt iieiatlmDumnvsn(0texnxfcta1fpDe i ols s2uoxmpno4ameelncsas a2ta(mp;t1tlxo o3ildfmDrauvo;() eerircty1la  anes t t2uo(mpoo1lp nlncta( aDrm(m oo4opt ii3ildfaDumnvs;u4 ltnxr ta1fm eanei t sexo(m ou4ol emnes sf 2uax  nt4aet mi3ilsfm2um(ms;(4 eeoio3totoa  lnesls)srxoxrpiy1ap emivsat) rur( poo1oleo i3tasfm2rm( s u0aetrmo3tadop  auvsl(0 eto(r3iydomtelnvia()srurumonu4aeeoii3tadfa2elu o t0 lxrmrcio1oa rlivil(0t2tm(m3nu1op n icsat aDtru pou4oexoif3iys s um(vsn(0altoxr oa1fa rau sl(0setmirpny4ap  lfetl(fa2raurono1oetn o3tadfs rlnvo t)artnmo3iadfa e u i;s trurim io4ap elfetatfaDtax  ;t1tetoifetldla2uanmo t4areoxf3oy1faDeluei;s)tetm(mpio4amt mfvtlt)sDtau poo0tlxomieiasla2emuvsn(4aexnmf iy1faD li o s  eurxrpou1opt  fctas) Dumurp;u1alxn o3iytfsDemuvs;u)alenio oo1lptrlu i;t) rtriopny1lpe livtls aDtaxmo;t0aexn i3iasfa2emumont0tlermr ootomDeanesl(0trum(m nodomenmictls)srtmxrpno0oetomfciatls umuvs;(0 etrxo oo1fa r n s (0srurimpny1aptn nct s) 2taurono4opxnifcilt m el(vo u0texomf ta1laDeaneolt0trtrxo oo1lpe licslsfaDur( onu4oexn ictydlm eluvo;t)tltnioctatlpte uvs (0s2tr(m oo1lltn fci sfaruaumooo1tetn ietltfa um(vo ()texnxo3ootlmD an s;()s2uo(o ou1opt lncs t  Drmx  ou0olto fciatfmDum(ms u)altnio iodoaDelivi t seuo(opny4lm  lfeiatfsrtauronu0tleo ociydls2ran on()areoxocoydfm elnvs s0tetr(opiu1ole mnei sfs2tax onu1teeniociltlaDrl(vs u0alxnxo3tadoa   i i () rxoio3iudopte nvsl(fs2ur( o;u4teeoio3tysfsDem( pnt4alxoxocty1fmD lnvilt)s2um(opny4lpt  icsatfsrta( o;o4tlxn oeiyslaDra(vp;t0 ltomo3tatomt lieol()s2to(o3nu1om  lfvias  rtmx oot4texn iciyt sDuau p (0texoxf3ia1fmtrlnei;s srtoxr oy1lmee fcs tfs2tr(monu1altnif3tat aDul( snt4tetoxr oadomDrlnvo;() eumio oo4oltnmfvs (fsDrrumoou1olx  fciyt sDumums u0arerxrcoo1omteluvo;s0t2xmxmpnudlltelfctl()aDrr(mooo0tlxoifciat mDrm(vs (4arxrio3tydfa  au sls0s2to(m ny1aptemietls) rtmurp;u1tleoifctatfmDran p;u0alenio iatlaD lieil()srum(r no4op   iesatf Dumxm oo1tpe  i3ilslaDuluvsnt)aetnmr oatfa r n i;(0 eto(o3ou1llt mfvtatf Dtru pnu1tet  f3iad mDemums t4trtnio ia1om  luei s0teuo(r iudomt mfvs sf rrm(r ;o0optnmi3ilslmDulnmon()arerxr3totlmDe u s t0srxoxm nydol elfet t)srrr(  nt1tpenmoeilsfs rmumpnu)arxrmrcoydfa eli s t texoio nydlltemfci (faDtmx  nu0tpx ii3iys mDea( on()tleoxfcio1opDeanvo ( t2trir3iydlpt lneils sDraxmo;t4tltn fctytlaDumu pn(4trxrxfcoa1lateln o s0 2uoxrpiydlltemfvils)s2umu  ou0aptnif3tyd m rl(vo;()aexomfcoo1fmD  nvs;t)teuo(o3oo1omt mfetlt) rrm(rp;o1tex  fcilt a2ulnmsnu) rtrir3oadlmte ues s) exmxm3no1ope mieia(f rtrumo;t0tetnif3tltfa rmump u)trerxf3oydlat  n i;s  euoxm3oodll nlfvsat)aDrr(ronu1aee ii3tydlmDea( s t)alxnio3tadop raueo;s)trxoxo oy4lp nmivs (  Durx pnt4tee mieiyd m ulnmp;u0trerxf3totfmDeli s ()trtoim oodllee nvs s) 2umum no4oeto ietadfsDemuvo t)tlxnxf oodlpD  nvo t) rxoxmpio1ll elivi t)srrmurono0aetomo3tlsla2emnmo (4aeenxocty1oa ranvs (0 2tmim nodol   ivtlt) Drm( ono1tpxoii3tadlm2umn snt4trxomf to1fmtr uei;s) eumxo3nydamt lfet t srumx pnu4tlx mieiasfm2eau pn()tltrmo tatoat lnvi ()s2umirpoodlpeemiesat  2urx pou1alx ii3tasfm rlu p (0 rxnio todoa r u i;s)s2xoxo oodolt lfet tfsrrmx onu0apen fciytlm2um(vsnt)trtnmo3totlat lues;t0trtrxopnodal nmiet tf 2rm( pnt0tpx io3tysls emn p;t)aexnmo3iodlatrli i;t0tetrxo3oudapeelfcil( s2taxmpnu4tpenifetasfsDum(vsnu)aleomrctadfm r nvo;( trtrimpno4oltnliesls)srua(ro;o0aetomieiltfs rm( o (4aeenxfcoadlm r i o;()t2xr(o3oudapee nvtl(f rurxm ot0alt ifeiyslm ranmp u0trxrmf iy1faDraieo s srxm(opiu4ame mfvia( arraxmont0aleo f3iatla2elu o;t0tlxnmf totfmDrau sl() rtmxrpoo4lmte fesat)aDra(mooo0tet io3iltfs2ul( onu0texoxo3tadlpt aneo ()s2tm(r ou1lp   fvs s) 2uaurpou4oet ii3ils m rmnvs (0 lxnxr iatlmDelivi;(0 eto(r iydlm nmfctatfarrmur ;t0tlt  o3ilt m2uanmp t)arermo3tytfmt  nvi;t trxmxmpnudlleemfes ( artmur ou4tpxoiiciydls2umn s u4 renmf3tytlmDrlu o;t0 ruoxrpny4apenmfcil() 2rr(mpot1open ieilt m2ranmsnu4arxrio3ta1lmDelivols srtr(o nudolenlfvs ()sDtaump;t4teeomietytlm2ean o;t)arenxr oa1fmte uvsl(0 2tm(m ou4lle lfvil(f rtm(rp;t1aet mfcilt a ulumsnu)tlenxr iatom rln o s)srumxm iy1amtemfvilsfs2ta( p;u4aet if3iyd s rmn pnu0tltomf totfa rlu s t srxr(r3no1ap n fet tfaDtrur ot0opx  feiadfmDumumont)aetnmo3tydfa  auvol()tetmir ny1omtnlfeils)sDumur no4opeomiciatls2el(mo;t) rtnmr3oa1op eanvo;(0 etr(o oo1ap elfci (fsDra(mo;t4aleomfctat a2el(vs;u4teeomf3oadfmDrauvsl() etm(o3no1op  liesas)srrr( ono1tlxo iciydlaDuauvon()tlxrxr3iotlat aueol() exoio ou4am nmncsa( arraumpno4tpxn feiasfa umu o (0aeeniocoytoaD aivo t t2xmxo3no1olt mictasfa2rm(r ;t1tpx  oeiltfa rl(mo;u4trxoxr3oy1lat  neols truoxo ny1amenlnesltfaDuau pou0alt  ictyt m rl(vp;u4 rtnmociytop  lneo s s2tmxrpoo1opt livta() rra( p;t0oetnioetas aDelumo u0altnmfcoa1opt  ueols seuoxopoudame lnvtat)aDra(  ;t1alxomociasla2ean o;t4tlxrmr oa1fp  livol() ruo(rpoy1lltnlfvsl()aDrrum oo4tptn feiys s emnms (4arerio3ia1lp  lu i;s0trtmxr oodomt  fesat  rtaxm oo1tleo i3iydfa rmnmsnt0alxnxf iytopDeanvi ( setmxopnu4op elivi (fsDuaxr nu1tlxoif3tys s2ea(mp;t4tlxrmo3iodfaDrlnei;()trtmxmpiodamtemnvt tf 2ur(ront1ole  fciasfsDrmu o;t)aetoxf3iotom e ueslt0srxo(opoydlpe mnvt t  ruauronu4aex  fciat sDranvp;u)trermrctytoa rlues;t0 rtoxr3io4op nlnvtat  rur(r oo1tlenmi3iyd sDrluvs (4tlxrioctatfm eln s s0trtoxrpoo1amt mieilt sDuaxrp;u1teen i3ild sDemnmp;u)arxoiociydfm rlnvsls  2to(o io1al emfcsl(fsrtmuronu0tetniociad a2uan pnu)texrmr3tatom   nes (0 rxr(mpnu1lltemnvslsf rtax o;u1alt  o3tydfm2rmums;t4 eerxfciy1omtean i t)s2uoxr oodop emfcsls a2tm(mooo0tpxn ietls mDumums;u)aleoxo iodfmDe ivslt)t2xmxrpnudaptemfciatfsDur( o;o0optn feiadla rau o;u)arxnio totfpDe iei;(0srtr(opou1oltelfcs () Drrx ono1aetoiietls m2ulnms u0texrxo todlpt aneols teum(rpnodlpe mfetlt s2rr(  nt0tpt mf3tlsfs2rl(ms;t0trerifciatlaD  i il(  rumio3nodapen ieias)artr(mooo4ale  i3tltls ulnmp;t) ltomocty1opDeaivi s0t2uo(opou1amtn fcilt)arrru p;u4tlx  ietys a um(mp t4trerxf3iodfa rluvols t2tr(o3oydlp  livi (f 2urx  ;t0oltnmoeiatlaDumuvpnt0 etrir iy1latrlnvi;s0 rumxr nu1al elicsatfa2tau  ou1aee  iciysfm2uaumo;u0 renir tadfmteaivo;s)seumirpou4om  mfesatfs2ta(  oo4aptomociasfm2ua(vo;u) lxnxo3oadlp rau s ()sruoxo3io4lmt  fei ()aruaum oo4oeeo oetad a rlnvp u0treoir iodfpDrai i ()srxoxr oydomen nvsatf 2tr( pou1apx mf3tysfsDrmn pn(0teenifctydopDeluvs;s)trxoxopny4opeemfes (  Dtm( ono1oeto f3ildls2eln s u4 etrmociotom e i s t t2urirpiu4al elfcsa(fsrtru  ot0opto fcias aDumnvs u4treoif oadfp raivs (0 2uo(opnydom   ivs (farra(rpnu1texoifcildla2umums;u4 etrmfcoy1la   u ils) exoio3iu1lmen fvt ( a2tmu  oo4aptn iciltfmDel(vs u)alxnxf todlpteluvs;t0 2uoir no1amtnlivias)a2taumpnt4tetnmoeiasfaDemn snu0aeenmociadfm r nvo ( tetr(r nodomeelfvsl( sruauro;o0alx  fciadfm ul(vpnu)artrmo ta1faDe ivilt srtrxr3oudopt lnvilt srumu p;o4ale  fciys aDrlu s;u)alxnxf3oytla   nvsls t2toim3iu4lp  lnvt t  rtm( ont1aeeoiociadfs uauvsnt0altoiocia1lmDe uvslt seuo(r iydom nlfcta( sDumurpnu4opx moctlsls eanmp u)trtnmo3tatfptranvs (0srto(mpiy1amee feiatf Dtm(m ;o0aetomo3tadla uaump;t) ltomr tadfpD  ivo;s)trtr(mpno4ape livsls)aDtm(ront1oex mi3tytls uln p;u)tlxrir oydfptraueilt0srxoim3oy1optnmneias) Dtrxmpnt0oeeo octyslaDrm( snu4texrir3oy1fatrai o s0tetmxo nu1alen nvsls  2rau  ;o4alenioctadla2umumsn()trxoir tydoa r n ils  etrxr iu4omt mfcta( a2rrxm ;u4ope moeiad sDulnmo ()trerifciy1faD ln i;()trtrxmpou1opeemncia( a2rmxr nu1tleniociat sDulumo t)texoxr3oa1op  lu i;s  2xriopiodoptn nei t)srrau ooo4teenmf3ilsfm2em(mont4alxoxfcoy1fp r n s t  etoio oy4aleemics t)sDurxroou0tlenmfciasfa rau p u)aetrmr oo1fpte neo s)srxoim3oodlptnmfvi ()s2umxm ot0oetnmf3tydlm2ra(mp u0aeenmrciy1lp  lues;( trtmio3oudoptemfvias  2rm(mont0aeeo fctytfmDua(vsnu4 lermo ia1oate u olt)trxo(m3nu1ameelfei sfsDrruroou4oet if3iltfmDean s t4 lenxoctatfm rau s s  2uoxr ny1lpe liet (f rta(mpnt1oexnif3iatlmDumnvo;t0trxnmr iatlpD ai o;(0s2urxo3nu4apenlnei tf Dtm(r oo1tptnioetlsfm eanmpnt) leoxfcoydfpD  uvolt)srxo(o3oo1lle  ivtl()arurumo;t1aexoifetltfs ran o;u0areomrciotlaD  u slt0 rumir3nydaltnlneils)arrm( pnt1oexo i3iytfaDelnmon(0 lxrmr3ta1fmtraues t t2xo(m3no4ll emfvt tfs2ur(mooo0aeen oetad mDumu on()aeermfciotfp r i olt0t2um(m iodlleemnei () rtrxr nt4tpx ifciysfs2rmump t0teerxr3tydfmtraneol(0t2xrxr3iy4omtn fvtltf Dur(r ou1tpxoif3iydfsDumuvp;(0 etrxo3iatom   ivils trtr(m3iy4ame mietas  rtrum ou4opt  o3iys a2ranmpnt0tleoxr3oo1fpDelu i (  rtm(m3oo1ome mfcs t  Dua(r no0oeeo f3iadfa ua(vo t4arxnxf3ta1opD lnvo;(0trtr(opiy1am  lfvtl(faDrr(mooo4aetn ieils s2ulump t) rtnxo tydlmte ieols  rtr(m3ou4ol  lncsls  2tru oou0tpxn ociaslm eanmo;t0 eerircoodlpD aieslt0trxo(m3ny1optnmnesas)a2rrurpou0tee ioctyslaDran o u4arxnir ty1om  au s t  euoio3oy1ol nlfctls)s2tm(rpno4oltnmicild s2umnvonu4artnxoctadfp eanvil( setoimpou4om emncslsfaDtaxrpou4alxoioeiatls2rm(vsnu4trtomf3iatlp  lu ils)trxo(rpno1ap n fetlt sDua(ro;u1olxnmfcils s2el( p;t0 eenmr3iatfa elu slt0 exr(rpnydlp n feiat)srrm(moot0tptnmoeiydlm2ra( o;t4aexnmr oa1laD ai i (0 2umir oodapenliviat)a2tmuronu4oeenmiciasfm raums u) leoiocootfmDeli o t s2tm(mpny1lm nlfvsa(  Dtmumpnu1teto f3ias m2rlu p;t)artnxrcootop rlneolt0trtrxr3oodamen fesl() Duaumpou0olxn ictydls2eln ont)aexrircoydop r ivo s) euo(o ou1lmtnmfcia( artr( onu4aetn fciyslaDrm(vs () ltrif oatlaD  ieo s) rur(m oy4ome livtat aDuax poo4oleo ieiyt aDrl(vont)alxrir3ty1oa e i sl() etr(o iy4lpe liesa(f 2raumpoo4aeen ictlsla ran p;t4aexrmo3iadoa r u i t0s2xrxr iudolen fvtas  2ua( oot4tltoifcils a ra( o (0artnmrctodfaD  ueo t0s2to(opoydll nmfvtl()artr(r ot4optomoetyd s2rlu on()treomfcty1fpD  n o;(0 rxm(o3no4aptn iet s a2tmurpou0tpeomi3iasfs ea( p t0 lenmf3tytomD li i;t  etrxo3oodolt mfviatfs2tmumont0alx moctasla2uau snt4teerifciadomtrli ols)setrxr iy1amee ivils aDuau  nu1teeomoeilt a ul(mpn(4tlxomr3oadlateli o s0s2umim nudoltn fetls srtrxrpou4opeomo3tld m ul(mp;t4aetomocoodomD aivils)trumim3ou4opee iei (fsrrax o;t4tltoioctydla rl(vo;(0 lenio3io1fp eaivo;t)teur(m3oudap n iet (  2rrx  ou4apt  feiltfaDranvp (4 lxnxf3ta1oatrln s;s) 2to(r nydapenmneta( sruau ont1ole ifeiyd a2umuvs u0alxoxr3tydlmtr neo;( srto(m no1lpeelfvs t a2ta(monu4tpx  feiys a emnmp (4artnxoctydoptraivil()texrxr3nudomtnlnvilt  rra(  ;o1tpeo ietyslm2emuvo t)treoxr3ia1fm rlneol( srtoio3iudapt lies (  rrmxro;t1oleo fciad a eau p (0treomfcoatoa  livilt0trtr(m no4om emfvtl(f Dtrx o;u1tptn ociasfaDra( o t)alxoxf3tydoa eau sls) 2xoxr3io1openmnvt t aDurx pou1apt io3ias s ulump (0 lerxr oy1lmtean il()trurir ou4opte ncsls a2tmumpno1ole  feild a ranmon(0trermr iadlaD anvs;() eto(m oudole  fcilt sDua( o;t1ole ioeiys m um(msnt4aexnxr3oa1lmDrlnes t0tetmxopiudomee nvt ()artau ono1teeo ietatls rmumpn(0 etnircia1fp elueo () rxoxrpno1om  lnesat arua( pno4altn o3iaslm um(mo () eenxo3ia1fat anvo s)s2toxo oudlltemfci sfsrrr( ono0tle mo3iysla rauvpnu0aeeomf3oy1opDrlivo ()s2xmio iodlmtelies t)a2rm(m no1optn ietatfa2ranvsnt0tleomo to1lp rauvil( truo(opou1op nmfciat) Dtrxr ;u1apto fetltfaDumnmo u0tetoir3ty1optrluvo;s)texrxo3oydoltn fvs sfa2taxrp;o1altn f3iytfaDua( p u4tlxrxf3ia1opDr u o;s trxmxo io1lm n ivsatfsDtrx  ou1tee mfetlslm2uaump;(0teenmf3tatfat au s (0srtmim ou4oltnlfes tf Drax oou4oexoio3tysfm2rlnmsn() eeoxrcootlmDrai i;()setr(m3iy4alt mncilt)arrmu  ou1alxomociydlm2raump;(0trtrmo3todfmt  nvolt)trtoim nydame lnct tfa2ra(r nu4apenifcildfm rmnmsnu)tltnxo iy1fmte ieo t)texo(m3oydopt lietat)aDuaxmpou4olxnmfeiad a rln p;u) reomf oodopDeaivi s0 2xo(r oy1alt mnvs tfa2rru ont0opxniociydfa2rmu o;t)alxrxr iodfm ean o s) rxmxrpiudlleeliet t s2ta(m oo0tleo iciytla eanvs;u4aleoxfcto1fpDr n o;s texoxr no4amtnmncsas  rur(m ;o1aeto ieiyd mDeln pnt4trenmo ty1fmt aivo ( teurirpou1lmt  fvtl()a2tax  no1apto feiydfm2rmums u4arenir iy1lmtr n s s0t2tm(opoo1amt lneiasf 2raurpou4alenioetys sDua(mpn()texoir3totfmDe i ols texm(m3no4lmenlfeils sDrmumooo1aee  fetls aDean pnt0 exnxf oydfpDrlnvol( s2trir iydll  lnvsls)srtrxront0teen iciydlsDel(vpnt)alxoirciatom  au sl(0tetmxmpiu1omen ncsltf 2umxmo;t4tpen feiltfa2rm(vp;u0tlxomocoatop elneo t0srur(m3iydlm  miei t)sDua(rpou4oltomfeiydfm2uauvp u4aleomf3oodfmDe uvo;( tetmxr iodamt  ncia()sruaxrpot0alxn f3ias m rl( p (4altnmf iatlm e ueo;()t2xoxmpiu4ap   nvil( srra( poo4tetnioctas a2umuvo;t)tlxrircio1lptr n ols  2uoir iy4optelnesatf 2tmxroou4apx iieiysfmDeln p (4 rtomo iytlmt auvs s) rxrxr3no1op nmfctas)s2urx  ;t4aptn fetyt s2ua(ms;(0altrio totfm rlnei;s0srtmxopny1ame lnvt s) rtmxmo;o0oetn fctld a el( snt0arxoifcoo1omte ueo;t0setr(rpiu1lpte fcia(  rtr(rp;u0texoifeiad mDel(vs u0tetomf3ia1optrluei s) rxo(opnu1ope lfcsls)arrrx ont1tlxo fetld m umn pn(0tlenxfcoy1la  luvs s)trxrio3oy1ome mnvtat s2uaurp;u4openmiciat mDumn snu4aexnxo oatlmte i ols0seur(mpnudomtnlfvt sf Drau  nt4oetniiciytfs2uauvs;(4 lxrio3ta1la elivi (  etmir nu4lltnlnvsat  Dtauront0teen ocils s2rau o;(0 rxoir3iotlm raivi;()trtmxmpoodamen fciat)arraxr ou1oet mociasfa rm( snt)arenmf3tydlpD  ivs;s trurirpio1lm   fvta(fs2uau  ou1texn fetadfm eau snu4artomr oy1opDrln o;s0t2xr(o3iy4ll n fetlsfa2rrumpnu0tpenioeild sDrln p u4alenxo oo1om r ivil(0srxr(mpiodomee fvi s  Dtaumo;t1apt  i3iysfs2uaumont) rtoif3iydfaD  u ols0trxrimpiu1aptemfvtls)arururo;t4tex  ietlslsDua( s t4 lxomf3oatfmtranes;s0 rxm(o iodlp nlici t  Drmxm nu1oetn i3tadla em( sn() ltomr3iytlateluvs t0seuriopiy1alen iet sfsDtrx  ou1olt mfctys aDuluvo;u) rtomfctadoptrau o;t0 2urxr3iu1ope  fvils  Dtax pot0tltomictys s2rmu p (0aexoir oy1oa rlieo (0t2xo(o nydop e ieiatf Dtmumo;o0aee  ieiyslsDem(vsn()alxnxr3io1lp r n ols  rtr(r3io4oltnmfcilt) Durxm ou0oet iictadlm rlnvsnu)tlxnxociadoatr ieol()teumir oo4al  lnes sfaDtaxr ;o1tlxoio3tatfs rmnmo;t) rtrmr3ty1op  lu ilt teurio iudamt  iet ( s2rr( o;u0aexoifeildfa2el(mo (4 etnircoytlmDr iei;t s2to(o3iu4ap nlics tfs2rr(ro;t0olen o3iat s2uanmo t0alxoxr3tydfateanvo t s2toxopou4oleemnctas) Dtmx pnt1aee  o3iydfaDumnvs ()altnxo3iatopD luei s)sexo(o oodopen net s  Drr( pnu4altn ociydfs rluvs (4 leoir3todom r nvilt) rtoxo3oo1ape mfeslt) rraumpnt1olxoiietyslm ua( p u4tltrxfctodfa rln o;s)srxmim iodamte fvil()aDumum nt4alt  oeiadlaDeanms (0alerxrcoa1fmD  i ils s2xrimpiudale mivs t srtmxrpno4aptnif3tat m2um(ms;(0aexomf3todfa e nei;t) rxrxr oo1olenlncil(  2uaur nt4teto ieiyd sDra( p u4alxnxf tydfpD  ueslt)tetmxmpny4ol emfvs s artaumo;o0oexnmoeiadla2ranmont)teenmo iotlmte ueol(0sruoim oo1ol emnetl(  Dtm(mpou0tex ioetlt a2ranmpnt0trerif totlmtelivo t s2uo(o3oo1lle mfvtl(f 2umxmp;o4oeenmieias m umuvp u4aleoxfcoodlaDrlnvo ( sexoxm3ny1ll emncs t sDtmx oot4oexnmo3tytfa2rmu snu)trtrir3oodlaD  nvi t0srurxo3nu4lm  mfvs s)artau oou1opxnifeiyt sDuaumont4 reomr3tatomDe ieol(0 2xrir3iy4ol e ietls)a2umur ;o4optomfctadfmDra( s ()artnifcty1fmD auvs;s)trtrim no1lpt  icslsfsrtm(r ou1opt mfciatfa ran p;t) etnxo oydlmDranes;s  2urio iodlp  mfci s srurum nt4openifciyslmDrm(von(4texrir3iy1fmD aivi ()tetrxrpnydaltemfei s a2uaurp;t1olt iicilsfaDrmn s;()trtnmrcto1optr ies;( setr(o nodlm   iesat)srrau o;u4aleoifetyd m rauvpnt)aeenmfctodfpDelueilt  2urxmpnu4amenlfctas) rta( ooo0tleomfeiyd a2ran p u
\ No newline at end of file
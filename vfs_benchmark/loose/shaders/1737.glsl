@@ -0,0 +1 @@
+uvs s0t2to(o3iudapenmnci (f rtmxrp;o0tlxo feilsls rluvpnt) lenxr3oatomDr nvslt)s2xo(m oodllee nvt s  rumu o;o1tetn fciasfa2emn pnt) lxnir3tytfp e uei ( setm(m ny4lmtn ivsa(faDrax  nt4tltnmicilsls2uauvp t)tlenir3oytfm  aiei;()setoirpiu4opt mfcs (fsDrr(r ou4opx miciys sDranmont4aetoxo ia1lmt  n i (  eum(m3iodoleemicslsfsrtmu pnu1opxnioetaslaDuln p;t) reomf oydlaD  n s;( tetrxo3ou1lmtnlfei sf rtrxmpnt1tlxniociadls2ra(ms;(0tltomo3oytlm ean i t)tetrir3nudop n fcias)artrxr nu1aexn fetltfs2emnmsnu0 lxriociytlmDr i ils0seur(m3io1lle liesls  Drrxr no1opxoiociys mDemn p u4tltnmf3tatfm r iesl( sruoxm nu4aptn ictat  2rax  nu1oeeo oetasls2rlnvs;t4trxrif oodlaDrlieils0 rum(mpnu4amt lnvt tfartaum ou4apenifeiyt m ra(mo (0 lxnxf3oatlpDeaies;s) eumim nydomtnlivsat)s2rru oou0tpenmiciltls eanmpnu0areomoctadfm  lueils t2xrxrpio1lm nmneias aDrmxmp;o4opt mfetadlm2em( onu4aexrmo3iatoa eauvi;t0 rurxmpoudal nlnvta( arta(mpnu4tpe  f3iatfa ean o;u) etrio totoat lues () rtoxopoy4lltnlnci s  Draxrp;u0tptnmfctadfm rln s u0arermr3iydlmt an i;s)trto(m oo1ape  netl()aDumx  ou1tlxn i3iad s rmumo;(0 etrxfcoo1om eaneo;s0 etmirpou1lme mnesasfsDra(  ot1apx ii3iadfs2rmumpnt4 exrmf3oy1fatr u i s seto(o3oy4ap emfetas)aDra(rp;o0tlenmf3iysfs uauvs;() ltnmo iydopt auvo s  etrxmpio4llte fct t s2rrxr oo0apxnmociys a2rau snu4aeenxr oadoa e neo;s0s2uoio io1amte nvtltf 2rm(rono4ale mo3tlslaDemumpn()aexrif3totlp rauvsls texmxm oy4op e nviat s2taurpnu0apt mictyslsDrmn s ()aleomr3ia1lm rai ilt0 ruoxm3iu4al n neils)srtmxroou4aetoifeias m2rau s;(4teeoxf oatfmt ln i ()seumxm3iu1lmtemici t)srum(mono1openmf3ilsla uaumpn() rtrxrcootlp elu ol() 2to(r3nu4alt lictatfa2ua(  oo4aetniictat s eaump;u0tlxnmrctadfateaies;s0 2xrio oo4amee nciat a2ra(  ;o1aeeomi3tat m2eaumo;t0tltoif3tadomDrlnei;(0s2xmio iy4oltn fvta(fa2tr(  ot0apto ictytlm2rauvs;(4 rtnxociatfmteluei () eum(m iodapt  nctl()srtr(rp;t0aex moetasfm rau o;u)trtnxoctydlmDeluvi;s  rxmir nodom nmfvsas)s2rrxmp;u1teeo fctytlsDea(ms u4tetrxf3io1lmD lueilt0sexmir3oydopt lnctl(faDur(m ;o0aptoiocildfm rmums;t4 lxnmrcootom ran s;t)t2trxm3nu4lle lfcias)a2rmxroot0aptoii3ilt s2um(mo t) renmf ia1laDe u o (0s2xr(r3no1al  lictas) Dtmx o;u4texoioctlslsDulnmp;(0alxoxr3oadoaDr ues;( t2xoir ou4ap elivsa(fa2umur oo0opx if3ildlaDrmuvs;(0trtnmociotoptr u o;t0s2toim3ny4lleemnetas)a2tr(r no0oltoif3tldfaDuau o (0trxnmocia1lpDr ueolt  2xo(rpoo1lpe  nvtas) 2umur ;o4oeen oeiat s rmn p u)treomf3tadlmtr nvs t  2xrxr oydamen nvilsf rraxro;o0apen octatla elu s;u0 eenir3iatop eln s ( s2umxm3oo1op nmneiatf rumx o;o4oet  oeiaslmDuauvo (0 rtnxo oytfmD lnvs;(0setrxr3ou1amtn nvias  rrmuroot4apxn fciydfa eanvpn(4tlerir ootfpDr i i;( s2tmxopnudomt  fcslsfs2tmum ;o0tex mfcilslm ulnvon(4 etoirctydlpt aneols  etm(opiydllee icia(fs2uax  no4aexn oeiys m2ra(vonu)tetoircoadomD  uei s trtr(o no4ole lnvsat a2ur(mp;t4open i3tys m2rlnvpnt)texnircoa1laD  u ils0 ruoiopiy4lm nmfet t arrrxrpno1tlx  oetas s2ra(mpnu4 renxr todfatrauei s)seuoim3oydol elnct (  Dtmur oo4opt  feildfm ua(monu0tetnmfcta1opDeaiei;s srxmiopoy4ll  lictls a2rmuroou1aexomfctydlmDul(mo;u4 rxrmfcootlp  lieo s srurxmpiodlm  mics t) rtaxmo;u0oleo i3tlsfs2el(vp (4 lerxr oy1oa rlieo ()trto(r iydlpte ieslt a2tm(r ot0olenmo3ilslm2umu o;t4aeeoio oy1lm  lueilt  ruo(r3nydaptemfes s  rrrx oou0oee iietatfa2ulnvs;t4 lxoxo totfa rlnvilt)srtmim nodll   ici t) Drr(moot0tlx iictytlm2umnvp;(0 lxnxociytfaDrau o s  exr(o nu4alee iet () 2rr(rp;o1teeoio3tas a2emnmo u0 rxnmo3oodfp e u s (0 rumxrpnu1optn iesas srrax ont0oetoiicild aDelnms t)teermo to1lm e iei s  etrimpio4lpe lnvi sf Dtmur oo1oee moeiad s2rm( ont) exrxr3io1om r uei s)teur(r oudlptemfvtls)srurxronu4olenioetat aDemn o;u) rtrir iytoatr ueols)t2trxm iu4ope mnet ( aDrrurpoo4opto fciad m2ranvs u0alxrmrcootfatr n il(  exmxr3ou1lpeemneias) 2tmxronu4olxn fctls aDulu onu4tetomr ia1lpt ln o s)teum(r3oy1alenmnci t)sruaxro;t0tlx  i3ildfm emuvp t)alxomrcoo1lmD au o;s)s2trxm oy4al e ict s  Dtaxm ;t1apeoiociyd mDum( s (0 leoio3oy1fmtrlu o t s2toxr iu4lmee iet t  rra(m nt0aexn oetlt a rl(mp (0arxnio oa1fmtelies (0seum(r ou4altemfvtl(fs2rmx  nt1aee  feiad s2eanms;u4tlxnxocia1laD lueils srur(o iu1ll  mivs t)aDraurpno1olxn feilsfa2emn o;t0artnxr3iy1latr u sls  etoxm3oydamen ivil(f ruauronu0oee mietasls2ea(mo;t4 ltomociodlaDeanvilt)srxo(o3no4omtelicsl(  2rrx oot0tpe mocilt m2elu pnt)treomo iadoateli il( t2xm(o iy1lp n fvi tf 2ur( ont4tetoiietlslm2rlnvo u)aetomr3tytfmDeliesl(  2toxr iydlme mivsa(fsrraxrpnt0aee moctldlmDulu s (4aetrmr3ty1fmte uvi;s t2trirpoydop nmfetat)aDrmu  no0tee mf3iasfsDeauvp t) etrxf ta1laD li i;(0seuo(r oy1lpt lnct s)arua(rpoo4alxo o3tysla ul( o;t0tetoxo3oa1lmDr u i ( srumim nudlmtnmfesl() Dtaurp;t1tltoioeiat a2eluvp;u0tlxnifcoytfate ivs;s s2tm(rpoudomtnmnet ( sDum(mp;u0ole iicildfs2ra(mp;t0alermfciotom e neo s s2uoxo3ny4lltnmnes (f rtmxrp;o4tpxn oeiydlsDum( s t0 exrxocoytfmte ivs;s  2um(mpiu4lpe  nvs ( artm(mooo1tleo o3ild a ea(vs;t) rermr3iatomD lnvol(0tetr(m3oo4amen iviatf Dtr( pou1oee mieiatlm rl( p;t4 etnxo3iy1lmDelivi;t0seur(m oudale  icsatf 2ta(r no4tlenmi3iaslsDuanmsnt) ltrxrcoy1lmt an i ( s2tm(r3io1amtnlivs t) rtaxr oo4opxoif3iaslaDrln p;u0aexrxrcoydomt anes;s)sexmio3nydlp e nvtl(  rrrump;u0olxn f3tys a2ean p ()teerxf ty1fmD  uvi;()sexoxr3iudape mnct t)sDrruro;t1oet iocias s rm(vp u0 lxnmr iytomteaneo;t  2xr(o oy1lm emnetlt)sDumuroou4apxnifeiyd a2rmu p;u0 lxomo3oodopDeluei t  etoio nodomee nvsas artmxmo;o1opx miciydfs2rmnms u)tlermo3iydlmDe n sl( s2tr(r3oy4op  mnes s)srrr(mp;o1teeoifeiytfsDem( s;(0 lenmr iy1fmtrln o s)srtm(mpoo1lle mictas) 2tmxr ou1tpt  ieiat aDeau p;(0 eenio3oo1lpte i sls trurxm3iu1ll nlfvi sfarum( pnt0oee iieiltlm2rluvo;u0 eeoxr ty1lp r u i;s) 2xm(mpnu4altemici s  rtaumono1tltn oeiatfa ea(ms t) exoircoodoaD lu s ( texrxm3ny4alenmncs ( arurur nu0tet ifciltfaDranvo;u)tleomr3totom ean sl( s2tm(r3nudalenmnes sf Duaxrpoo1opt ioctasfm rmnmo;t0texnmrctydlmDr n o t s2uoio3iudameelnct t) 2taurooo0tet  oeilslaDul(ms t4tlxnxf ootfpt liei () 2toir no4lpenlics s artrumont1altniictlsfa ulnmp u0 lxnmo3todoatelnvo t)srtmir3oo1oltemfesl( a2ta(  ot1opxomi3tytlaDeaums (0 eerxo oa1fp eauvs;s setr(mpoo1olenlicils srumxm oo0open oetlslm2elumo u0 eeomrcoa1la  lnvo;t tetoirpiodlltelneiatf 2tmxmont0tex iocils sDumump u4teeoxf io1lpDeluvi;t trtmir nu1ale lfvtls)aDta(mp;t1aptomfciydfs elu p u0trxoifcio1latrau olt)texoimpno1op   fvtat)a2uaxmonu4tlxo ociyd m2ulnvpnt4 ltrmfcia1omDean i;s0t2tm(m iydom emivsat  Dtmu  oo0oeeo i3iydfsDemnvs u4alenxfcoo1lpteli o;t0seur(opnu1alenlfviat  Draumont0olxniietyd s2rm(vo t0 etrmo tytlaDr ivi s0 rxrxrpiudomtn ivta(fsDrmxrp;t0alxoioeildls2uan p;(0 eeomo3iatlpDelnvo;t trur(m3oodopee nvi tfs2rr(  ;t0apeoiiciydla el(vs;u4 rtnir oytom  livils)tetoxrpiy4ameelfei s  2tm(  nt4oltnmieildfa umu o t4trxrircty1fmD livs;t0s2xm(o oy4am  lfcsl(fsrur(rp;o0opxnmociysfs emump u4texomrciodomDe ivo;()seuoxrpoy4ome mictatfsrumu  no0tpxnmf3ildlm2ra(mo t4arerxf iydlm   neolt setr(m oy1lm  mnvt (  Durxmpno1alxnmfctydfs ranmpnu) lxnxr ty1lpDelnvolt0srum(opnu4ll emivt t  rrax o;t1tleoiictlsfa ranvp;u0 eeoxr3iotopt lneols)s2to(o oodale lfvtl( aruax ont1tlxo fciyt m uan s t4 lxrifciy1lmDranes s  rxmir iu4alt livil( aDumxm ;u4oeeniietydla um( o;()arxoircoa1fmDr nvi;s0 etrxmpiodol emnesl( sDtmumpno4tee  ictys s rmnvp;u4aexnif3iatoaDrlneo;t  rxm(m oy4lme lfcsatfsDra(mpoo4oltnioctytlaDran snt0 reoir3iotopDeau sls) exr(o3nudapeelnvias)aDrrxroou0aexniietad sDrmnvsn(4altnif3iytfm rlu sls)tetoiopnudole lfcsa()aruaxmono4alxnmfciadla uan s;(4 lenif iatfmDelneo s teurxm3iy1am nmiesa(  Dtm(r oo0optoifeilslm2rlu o (4tetnif3iodfaDr nes;t)trtrxm3oudlmtnmfet s aDtrumpno4oet ioeiadlsDrlnvo ()aeeriocta1lp rau ols srtr(o iodom elnvsa(faDtrum ;u1optoio3tltfs rmumo;(4 reoxr tytlm   nesls0srurio iodap nmies sf 2tm(m ou0tltoiociysfs2rm(mon()arenircio1opDe nes t)trtrxm nodll elicilsf 2ur(m ;o4tee mfetysls umumo u4 lxrmrcoytfmtrlu s ( t2toir3oo1apenlnesat aDraum nu1optomo3ilt a emnvpnt4 lenxf tadomt anei;(0 eurxrpiudamtelfesl()aDurxmp;o0aleo feiytfm2ra( p;t0alerxo oa1fp e uvs;(  2tm(mpiy1lpen ivtl(f Dtr(m ou1tpto ociytls2rlnvont4texomr oy1fa  ln ols0t2xoxopno4olt  fcs (fsrtmuroou4opx iietatls2ua(vs t4aleomr oy1oaDeaueils) exoio3oo4omtn fvs ()aDrrumooo1apenii3iyt s rlnmo;(4trerif oodla  luvol()trxo(opoo1omt mfes () 2umxroou0aleo ocils a el( snt0arxoir3iotomtr ieol() rtmxo3nu1lpt lneias srur(m ou0tetnmo3tyt a2rmump;t)aeeoifcoadfpD  ivils0 rxoxrpiy1lme lfcia( a2umu pnt4tpe io3tyslm rauvs;t) etnxo3tatfmte uvi;t0 etrxmpnu1lmenlncsa( arrru p;t0oeen iciasfmDrmn pnt0 etnmr totfatrauvi t) 2urirpio1op  mfvil(fs2uaumpnt1opt mociatlsDrmuvsnu0trerxo iatom r iei () 2xrimpno1oltnlfei t  Dua( p;u4opxnif3iatla2uauvsnu)teerxr iy1faD ai i ( srxm(o oo4lpeelnvs tfsDrru  ;o0oleomiciatlm uau o;(4teerif iytlm eli i;(  rxrirpny4al elivs tf Dur( onu4oex  feiytlaDrmumpn()teeoif3totlm   ues;s)srxrxrpiu1opt mfeias srua(m nu0oet  fctaslsDuau p (4 rtrir ootomDeaies s  rxmio3nu1lleemfeslt)arua(  nu0aexomo3iad sDumn snu) ltrmoctytlatrli ils  etr(r oo4llt lnvtat) 2ur(m ot4tpx ifctysfa ua(vs;u) lxrxo3oadfmteaieo t  ruoim ou4lle lieils) Dra(moot0aeenmiciysfaDrmn o;() ltnmr tydfm ean s () eurio3iodoltn fvi s  2raxmp;u0opeo ociytfa rau p;(4 ltoir oydlmD li o;s tetr(rpou4lptnlicils srra(  ot0alx  f3tyd a2rlumsn(0 ltrmrcto1fm  ln o;( trto(r3oodllee feia(fsrum(rooo1tltnmf3iadlmDel(mpn(0alenxoctydoaD auei;t)t2xoxo3iy1op nlnciasfs2uaumpnt1aee ifcild mDran p;u0 exnmr3oadom r ivs t0teumxr iudaptelfcsas a2urxm ;u4texnmietltlm2uau snt0 eerir3iotfa eanvslt0 rtrxrpou1llt  ncil() 2rrx o;o1alt iociatlm umuvs;(0texrmf3oadfpDrai i;s0 exrxm ny1lpt mnciatfs2tmxr ot0tltoioeild m umnvp;t4 lxoif3ootlp  lnei;s0sexmir3no4lpeemfvi tfaDumx o;t4ole mi3ilsfs2ea(von()aexnioctytomteai il()srtoxopno4llenlfesas  rta(  nt0tltomietadfaDrmnvpn()altnxo3ty1lpDr n s s)tetoim3ou4om  licsls a2rr( poo1tpx  fcias sDuauvpnt) exrirciotomDrlnvs;s0truoiopny1alenlfvi t srtaum nu0tex mfcild a2ra( p;t) rxrmo3oatomtrlu o;s s2toxo iu1amt  nei s  Dtm(rp;o4apeomi3iydfaDelu o () rxoxf oytfptraieils) 2um(r3ny1llt micilt)aDuru ooo4opto ociadlm ranvp (0teerxr3oytfp  aies;t0srtrim3iodomtnmnvtat) Dra( pnu4teeomoctltls rmnmont4 rtomf3oydop   ieils0 exo(o3iy4optn fct s aDtm(  ot1tleo f3iadlmDelnmo;u0aetoxo tadla  auvs t0 rxmxm3nudopen ncsl( srumx ono4alt iieild s ulumsnu)aexrmo3ia1oa  li ilt) eur(mpoodlm nlicsas)srua( pou4oet micildlmDem(ms;u)tleomr tadlm  an o;s0truoxo io4lmte fetasfaDrrxmpot4olenii3ild a2uauvsn(0 lermf iydlmDr ieils0 2umio3no4lmeelncs (fsDururpoo0alt ifcils a ea( p;(0tlxomo ia1lat aieols trurxm iy4ll  lneil()srta(rooo1alt iociltfa2rln p;t0aetrxo iydlm ranvo;( seumxo io4op  liet sfarumxr nt4altnio3tltlm eaumsnt)tlermrciotfpD aueils0srtoxo ou1apt  nvs s aDra( ono4tle io3tlt mDul( s;u4tlxrio3oytlptrliei ( trur(rpou4alt mivtlsfs2trxm ou1oex ii3iys m2rau s t)tlxnxocoodlmt au ilt setrir3io4opt lncsltfartrxmoot0tet  o3tltfs2rmuvonu0tltnircio1late ueols)t2tr(r3io1optnlfcta( sDuau oot0opxnifctydls2uluvs (0 ltrif oatomteaneilt0 2urxmpou1om  lnctl(fa2uaxm ;u0apxniieild a raumonu4altnxf3oadlpDelneo ( s2tr(mpnu4amenmieia(  rrmuront4alenmociad m rlnvp u)alxnio iy1lpDraivo;t0srxmir3nudomee fcs () Dtm( p;t0ole  feiysfs2ea( s;t0 lxoxfcto1omtraueo;s0trxrir3oy1ap  lnvi (  2trx  nu1apx  o3tysls umnvo;t4texomr3tadomDe n s t0trumimpnu1olt lnetl(  rumx  ot1olto feiat aDuanmp;(0 rtnmrcoydlpD liesls)trtrxm3no4apenmnesasfsDtaxm nu4oltnmoetas m ul(vsnu)aetrmo3ia1omtraueo (0tetrxm iodape mictas aDuaxmo;u0tpt mi3tlt aDrlums;()trtoxrctytom r nvsls0s2tmxr3ou4amt  nct sfsruaump;o4apto icias s2emnvs (0 lenircta1om r neils0teuo(o3nu4aptemnes s)arrrumo;o1tpe mictls s2ra(vo;u4 etoiocoy1lp  anvols0seurxo3nodllenmfvi ()aDuaur ;o4alt io3tldfa emuvp;u) exomr3oodomDeauvols srumim oydole  icta( aruaumoot1teenmo3ildfsDuanvo t) eerxrcoodfmteluvo (0seurirpio4llte fvtas aDumu poo0texo o3ilt m2rm( s u0 etnmrctotopDrluvsls seuriopnu1aptemfvil( a2rax p;o1ape if3ildls2emnvs (0trxnmo totoatrlnvo;t0sexo(opiudlpe livs s aruauronu4texn oeiasfs ra(mpnu4 reoir iadlpDe iesls t2tr(o ou1ame mfcs t artau  ;o4tpen feiydla2rluvo u0alerxo oy1fat lu o s)trtrir3no1am e nvs sfsrtrumoou0aeeomo3tatls2ranvp;u)alxomo3oydfmDrluesls srxrxm oydapeelncta() Dum(  no4opxnmieiydlm eln o () ltnxr iotfmtrli s t)s2xoxr iydlmen ivi t)srua( pot0aleomieiydfa2uln s;u4 lxnxocio1lmt aieols tetrxo ny1om  miet t s2urur oo4oltoio3ildfsDel(vs t0trxrmr3ty1lmt lieilt0 rur(o3no4om eliei s  rrruro;u1aetnmiciadfsDrm(vpnu0aetnir3oadfatean o;s tetmir oudll e icils s2tmxmp;o1aeeomi3ilt mDemuvpnu4altomfcto1fmDean ilt0 exrim3io4om   net ()srrmur oo0oet  iciad s2el( snt) rerxociodoat an s;t0srtm(m3ny1ape mnct t s2tmurpnt1opxnif3iadlaDuaumsnt) lermrcto1la  liei t) 2toirpiydlmee fctas) rtaxmpot1ale ioeilsla2eauvp u)arenxr3oadfp r nvs s0 rumirpou4lmen nei (fa2tmu  ou4tpxoii3tldla2rau p t4 rtrxo3oadlaD luvo t0s2uoio nudll e fctl(faDtr(r ot0tlxomieiyt sDrmu ont4teeoir3tatom ean i t  rtoxo3iudopeemfesl()sDrr(ro;u4oexo i3ilsfmDrmuvonu4 ltnxr ta1laDrluvo;s trur(o3no1lmeelicilt s2umx o;u0tetoioetltfm uanmo;(4trermo tydfpDeanvo;t) rxmxr3nodlm  lfvs s)a2taxro;o0oexomo3tld mDra(vpnt4trerxrcia1lm elivolt0 rxoimpiydll   nvta() Dtau  nu0oeenmo3iat aDrlumo;(0texrio3tatfmDrlu i;t)trtmirpny1ol n net t)a2trur ou4ope mfeiltls2umuvp (0aexrif ty1opDraivsls0 etrxrpnudom e ncslt  Dta(r no0tpeoiocild aDeluvs t4altrxf oatlp  au s ( seuoirpoodalee ici () 2tmumpou0aexnmo3iltlmDrlnvo;(4tltnirciytoaD anes t0trtr(mpoo4lpeeliesatfs2umx  ;t0aetoio3iyt sDrm(vont4tltnir iy1fmD  ivo;(0s2urxmpio4omenmieiasfartax o;t0oeeo fetad a2ua( s;(4treomfcio1opDr ivols)s2xo(mpnodomenmnvsa( srtaxmoot4apxn feiltla2ra(ms u) rxoxo iodlpDeaivols) ruoxr ou4optnmncias)a2urx oot4aeeoifcild s uauvp t4trerircio1lmDr iesl(0trxrim oudolenlfcsatfa2raxrpnt0oex  iciytfsDulnvsnu0teeomrctatlateli i s0srtoim3ny4lme mneiat) Drmum ;t4tpxo fciydlmDumuvpnt0 etrio tatlmD lu ol()srumxr ny1lle  icsl()s2ta(m ou1aex mf3iat a ua(vpn(0teerxr3iydfatrlu i;s0tetrirpno4lp nlies s a2umx pou1altn oeiyt sDum( s u4altnmrcoo1oateau s t0 rtmir3nu1ll  lfvil(farrm(m ot0oltoif3tlsla em(ms;t0tltoxo3ty1omDeaiei (  2triopoodlp n fvtltfartau oou1tpt  oeiys s2rl(vs (0aleoif3ia1lmD  u s;( tetrxr3iodlmtnlnciat)aDtrurp;o0teeo f3iatfm2ea(ms;() rxomf3oa1lptrlnvs t tetrxr ou4lp elnvt t sDur(mp;o1tee iietysfs2emuvo u0trxrio todom e ivs;()trxoio oudale  ivi tf rrmum no4aee  oetas s el(vo (4 ltnifcoy1lmDe neo (0trtoimpiudol emivt ()arumxmp;u0olxnmoetltla umn o u) lxnif3oo1lmteln i ( s2uo(r oy4lp  mnvtas srrr( pou1tlx  ietldfa ua(ms u4trxnmo3oatfptelnvs;(0 eur(o3io4al elnvt (faDtaumpoo0opeomf3iadls2ua( o u0aetoif3iydoptelu o s0seumimpio4apte nviltfsrrru p;u4aet miciadlaDua(vs;u0 exrxf tadfpte ueo;(  eum(o3iy1oltnmfvt t)s2rmx o;o1tlx mi3iad mDrmu snu0tetnif3ta1lmtranes;t)srtrxm iy1ope micils)srtm(rono4aex mocilsfm el(von(0 rerio todfp raivi s)t2xmxrpnodal nmicsat)a2taxmp;t1alt micildfa elums ()altnif3oy1lmtrau s;t0t2tr(r3ou1om   ietat)s2rr(mpot0tex ii3iatla rl(vp;t)tetoif ootoate n i ( sexriopio1apt  ieil(fs2uaxmonu1oee  ociyt s2uanms (0 renmocoatfptraivi;() 2trir ny1omt lfvtas)sDtmur no1tpx mieiyslmDeanmo u)aetrir3tydfpDr neo s) ruoirpoy4amt  iet tfsDtauronu0opt mf3iyd s um(vpn(4artomrcootoaDrln o;t) 2toiopio1ll nmnetl( a2tax  nt4tltnioetas s2um( o (4treomrcootfatr uesl( sexr(m3no1lmt  ici s) Dur(r nt0aex ifciltfa ea(vs;t0tetrmo tytoa e uvilt0 rtmir3nu1ll n ictat aDum(mo;o0tptniieiatfmDranvpnu0 etoxr iy1fmD lu i t0t2xriopno4lmeelfes s  2tax ono0opxnio3ilslaDuln snu)trermrcio1lmDr ivs ()trxoio3iy4oltemfci s)srumxr nt1texoioetytfa rau snt0 eenmocootomte nvs;s0srurim nu1altn icils aDumxmono0tlt  ictls m2em( o;u0aetomf totomD  ieo;t0 2xm(o3iy4olenmnvsas) rrauro;o4olen i3iyslaDelnvpnu4trtrio3to1lpDraneo;(0setrimpnudap elfesat)aDuru oot1tpx iietysls elnmsn(4 rtoir3oy1fatr i sls0teto(rpoo1lpeelnvsat aruaxr ot4opeomfciltfm2rmums t0 ltomo3ia1la raivo s0srumxo3iydal nlfcsa( srtrxmo;u4tlxo feiyslsDua( p (4alxrmf3oy1omDranvi t) etm(mpoy1ll  mfciasfsDrrur nt0alt iictad s2emu p;(4artomr3oatlmDe nvsls0 exrim3iy1op elfcsa(  Dur(rp;o4tpt  oeiysfm emnvo u4 rermfcoatfpteau i t) exm(m oy4apt  nvs sfsDur( o;t1tlenii3iatfsDrlump t4 ltoirctadla elnvsl(0 eto(rpiydope  ivi sfaDrrxmp;t4aeeomoeiat s2em(vo;t0arxrmf iatfmt  u s;(0 exr(rpou4lmeemieil()srurxmp;t0teeomieild s2rmnvsnu) rxoifctodfpD luvil()setm(opoy1alee fctlt) 2ua(rpnu0tlx  o3tasfa emumpn(4alxnmo3oodfmte ies;(0setr(m3nu1ol  lieias) rumxro;t4opeoii3tydla2rmnvp u)tlenif3oy1fm ran o;( setm(r3oo4ol nmfvsltfarur(r nt1olt iictaslm2ul(mp u) ltoxo3iy1fp e ivo s)truoir nydam n neias srra(m oo0altniictas s em(mp;u4 leomr oytfaDr uesls0t2toim no4alte fvta(f 2rmumpot4alt io3tld aDel(mp u0trenmf tytfa  aieol(  exrxr3iy1al  mfcs t a2ur(mp;t4olxnmfeiadla rmnmpnu) rermfcoytopDranvol( texrim oo1apeelietat  2ur(  ;u0tlx iociatla rmuvont4trtrifciydlpDe i il( trumxm3iudapeelies t) 2trumpno4oeen ietlt aDelu s t4 lxoxo iatlat lnvo s) 2xmim oo1lmtnmnctls) 2tmx  ;o1tlx mictlsfs2rmn s;t0texoir3tydoa   u o;s t2urxo oydole lnvi (  2raum ou1tpxo feiad m rlu o;(0 lxrmr3oytlat lueo;t  exrxo oo1om emnvt ()srtrxrpou0aeeo fciys mDemnmo;t4aeerxr iatfm e uei s0 ruo(r3ny4om   nesasfsrua(mp;t1tpenifetydfs rl(vo;t) rxnmf3ta1oa eli o s0srtoxm3no1lle  nctas)a2trxrpnt4apto i3ils aDuln snt4trenxfcoy1oaD aivo ( s2xmir oo4lmt  nvils  rrmur nu0apeoifeilsfaDemn on()trtnif iotoaDe iei;s srumio nydomtemnvias) ruax onu0tpxnii3tlsla uaumo;u)aetomo3tytom elieilt)s2xoirpio1am elncsa(fartmxmooo0tlenifcild mDrmnvsn() exnmfcootlpDr nesls0 rtoxr io1aptn ivtl()srua( pnt4aeenmociat a ea(vpn(0aeeniociydlmDran slt) 2toimpoo4lm n netas) 2ra( o;t0oexo ociadls2ul( o;u0 leoxf iadop rlivs;t0 rtrim3ny1llee nct ( arrmxrooo0apeo ictydla2eau s;u)alxrmociytlatr ueils  euoxo3nydapeelies s) Drmxmooo0alxoifeiytlsDum(mo;(4 ltrmr3oatfmtelieslt0 2uoio3iy4oltnmfvtlt)a2raurpou4ole mf3iyt s2ulnmsn(4 exrxf3ta1fp  au s () eumio3no4lmtemivs sfaruaump;o0aet iietasfs2um( s;(4alxoircoytfm  lnvi s0seur(m3iodal n fvia(f 2rm(mpot1tex iocilt m2ra(vo u)tetrxfciodfaDranvsl(0 2to(m3ny4ame  nvtls  rtrxrpno1aet  iciaslsDem(vs t0 reomf3oadfaDrli s (0 rtoxmpnydam n fet tfarururoou4alx iieiytlmDuanvp;u) rermf3ty1opt lies;s srxm(m oy1lltnlfciat a2urumpno4apx ifetas m rm(mpn(4artnmrciydop r n o;s0 etoxo3iodamtemfet tfsDrrumpot0apeo fctldla ra( pnu) rxnif3oodlpDeanvi;s0 exoxm ou1ole  iesa(f Dtmu  no0tpt iictytfa2rlnmp (4 exoxf oodla e ies t srxo(r io4ol e netas) Duaxm ;u0optoiictltlm2ea(vo;t4trxrirciotoptr i il( seuo(r no1oleemiet ( aDtaxmpno0tee mf3tld a2umu pnt0 exoio3oydoaD aivo t teuoio oy1ameemfvs t)a2ta(rp;t4tpt  f3iydlmDelumo;t0artnifciotlptrau o;() etoiopiy4omenlnvtat) rur( pnt4ole mi3ias a ranvs (4 etrxr tytfm r uei;t0sruoxrpoo4al   fcs ( aDtm( oot4aetn feiadfaDrau pnt0 rxrxf3iodfp rli il(0 etoxo3nodlmen fet t)a2urxm ot4tpt iicilt s2eanmpnu0tltrxrctytlmDe u i;()trurimpoy4amt lfesat)s2urumpno1tee ioetaslaDul( p t) eeomo3iytomtrauei;t0teuoxo oo1lm   ncsas)sDuru  ;o1alx moeiydfs2um( on()alenxfctytomDrlu s;() 2xoio oudol emicslsfaDur(m no1olt mociad a um( p u4 exoxo ty1lpte u o t)trumxm3oy4lmteliesat  Durx  oo4oleo i3tld sDel(mp t)teerif iytfatrluvols)setrir3iy1om emfcta(  2trx  ;t1oleomicildfs umums;t0teeoxr3oadlp ranei t)srur(rpno4altelfvt tfs2rrxmo;t4oet  o3tadlsDrluvs;(4tlxrirciatoa eaiei ()tetr(r nudlltemneils  rum(mpoo0ale mo3iys a ranmsnt) lermr3oatlm  anvilt0 2ur(r oodom nmicil() 2rrurono0teenmieias s emumsnu4texnxfciytom  aueils)s2xr(rpoydaltnliei t a2uru ooo1tex iieiad mDra(mpnt4aexoxocta1opte ues;s0t2toxm3nu4ap nmfctl( arrau pnt4aex miciat m rmn s;()arenxr3oatfatrlnes;s  2uoxo3nudlpe  nviltfaDtru  ;o0apxniiciad s2ean s t4texrmr oatoptrln o;t t2toxrpnu1apt micias) 2tm(mpnt1apto fctatlsDua(vo;(4 renxfcoo1fa  luvi s)tetmxm ou1oltemnvs s sDtrumpou0oet mfciydla emnvo u0tltrxrctytlpDrluvols t2urir3oudlm e neia()a2ua(rpnu4tltnif3iydfm umu p t)alxnxf ia1fmteluei s0setr(m3no4oltnlneiat aDrrxro;o4tpe  oetytla rlu o (4 etoif oa1lmt  u o;s t2urxo3oodll   fct ()s2ta( ono0oexnif3iytls elums;u)arenif oadoaDelu o s0srum(o3no4lp  mfci ( a2taumoou4tpt ifetlsfm emnmsnt4texrif3oa1fpDe i s;()trxm(o oodomenlnesls)srtaump;o4texn feiaslsDuluvo t4trermf totoptelu il(0 2uoxo3nydllenmivsl( aDua(mpno4aexnmi3iad a ea( snt4 etnif3ty1oa   uvi t0 exo(r iydlme  iet (fa2uauro;u4tlxo f3tadfs2umnms t)tetrif ta1lmt  u s t)sexrxopnodopt  fcia( s2tmxr ;t0aee mi3tltfs2el( snt4tetoxr3oatopD luei;s0tetr(rpoy4ll nmfeilt)s2ra( o;u0oee mi3iatfm rauvp;t4aexrmr oodom ranvo s)tetmxopoudlpee ict t aDtaumo;o4tlenmiciydls2eanvo t)tleoxociadlmD an o;s srum(m3ny4lp elnvta( arrr(  ;o4oexo f3tls a rlnmpnu)aexnirctatomt an s s) exmio3iu1lptn fet t)sDurxrono1tptn feilsls ran snt0aexrxr oodoaDelnvi ( teuoxmpoy4lm  livsl() 2umuroou0opx  i3iasls rlnmon(4 rtoif tadlmt lnvs t0t2xmir3oydol emnvs s  rrmur ;u1tet  feils mDrl( p t0 reomo ia1lpD aivsls)truoio io4ome mfciat)sDumxm ou4tpxn oeilt sDelu p;u4alenxf3io1oaDrai s t0 2urimpnodoptnlfcsls)arururoot0aetniicils m ea(vp;u4teenxf3iydfpt  uvs;s srur(o oudamtnlfvsls aDrmu ont1tpxnmfetltfaDrmu o;u0tleoir ta1lpt  nvo;t  etr(o3iu1al  lfetlt)s2ua(m ;u4aee  fciasla2emuvont0 eeoxo iadoatraieo;s  etrio3no1op   ici ( srtax pno0tlto o3tldlm2eanmsnu4trtrxoctatlate nvo;(  rur(opiydlpenmfeiatf 2ua(mooo0aptnii3ias a umnvpnu0aexrifctytfmDrlies;s0 exrxo nydome  fctltf 2taur nu1apxnmfeiytls2rln p;(0altnmfciy1op   n ils t2tr(o oy1omte fei ()arta(rpoo4opxo oeiatfs eauvp (4 lerxrcty1oaD aneolt tetr(r ny4olt mfeia(f 2um(  ;u1openii3iat a2ua(mo;t)trtrmr tydfptrli ilt0truoimpiudalee nvta()srua(mont1oex ii3ilsfs rlums u)altnxo iy1late ueols  rxoxr nudalen ieias  rra(  ;u4tpt ifeiydlaDum( on()trxnmo tadlmD livi;t)s2trxr3io4amtnlnesa( aDtru ont4aptnmoeiys m elu s u)altrxrcta1late n sls0srxrxm3no4aptn ivslt aDuaumo;u1alx  feias a2emu o;u)trxomrctotlmtrluvo;() rxoxr3io1oleemfvs s)a2tmur nu0tlt mfctad m ranms (0aetnmocoa1fa  lneil(0s2xoir3ou4openlnesatfa2tm( o;u1alx iiciadla uanvon()trtnio3oydlat aivs;()t2to(m iy1optemnctas a2ua(m ot0opeomo3tld mDeauvp;u4trtnmf3tydoaD an ols t2umxopou4al elnetlt s2uaxmp;o0texnii3iltla2ulu s (4trerir3oodoat  n s;t) 2xm(m3iu1lpt licia(f 2rrumpno4oexnmo3iaslm um(mon()aleoxr3iydlpte neo s seurio3io4olt mfcsltfs2rmx pou1alto i3iyt m eanmpnt0alxnxo tydop eluei (  2xr(m oo1ole  ncils)aDur( poo0ope io3ild a2ra(mp;u4aetomf tydlmt au s s0tetr(r3iy1am nmnet tf rumur oo1oexomfeild a2rlu o;()aetnxf oo1fp ean s;s)trurxmpoodalte fvslt  Dumum ot0tpxnmi3iasla2eaumsnt0areomo oydfmte nes (0setrxr3ny1alenlnvta(fa2rr(r no0oeeomfctyd aDul( p () exnxf iy1laD  u i;t) rumxm3iy4olee fvt sfsDra(rp;u1tle  oetatfa el(vp;t) rtomfciotfp r uesl(  rtoir oudom nmiciatf rrr(  ot1opeoifctat sDuln snt0aeeoxfcio1fm eaueo;s)srxoir3iu4lmte neias)artr(m ;t1tlx  fciydlmDulu onu) eeomrcta1fatraivs (0teto(o oy4llt  feslt)aDtm( p;u1tleo oeiltfsDelumont0tltomocoytopteau s;s0 rtm(r nudamenlnvs sfs2umxrpnu0tpx miciytfs2uln o t4aeenxr iydomteliesl(0 euoio3nu1op elfcsa(  rtrum ;t1apt ifctlslaDel( snt) leomrcoydfatrlneo s0 rurxo iu1llt  fct t  Drmxrpno0olxnmfeiltfa rlnvp;u) ltrxo3iodoaDrlies;()t2uo(r3oydlm  mictat)srtmu  ;u4opt iieiys a2ulump;t4aetnio3oodfateauvo t) euoio3oo4lpeemivta() rrr(rooo1aleo fetyd a2rmuvont4 etomf3iodla e i olt0srxrxo iudopeemivi ()arrax onu4ape  octltlmDea( s;(4artrmocto1fp elnvi;s)srxr(m oodop nmnctlt srrrur ou0tpeoifciasfm2elnmo t)texnif3tatoptr ivilt0trxoxmpnodll  mict t)aDrmu pot4ope  f3iadfs2umnvs;t4altnxr ootlmtrai sl( seto(r3nudame lnes s)aDuau ooo4alxomieiad m2rmu o;(4arenio3ootlptrai s;(0sexrir3io4om eliesas) Duaxmpot1oltn oeiytla ul( o t0tltrxr3iy1lpt auvs s  2tr(r3iy1lp n ictls aDraxrpno1opx  ietyt a2rlu ont) ltnir oa1op r n i ( teumxr io1openmictls aDururpou4apenifcias mDeln s;() lenmo3tatfpD li sls0s2trxrpoydlmt lfeia(  Dur(m ;u1tpeoif3iyt a eanmsn(4 lxoxr3io1la rauvs ()trxrirpio4olee fctl(  2urxmo;t4tpenio3iasla2uanvp;t0 exomr3oa1lat  n o;s0s2tmxrpnydapenlicil()sDtax  oo1apt mo3tldfm em(vont)alxnxrctadfpteluvs t0 eur(rpnodllenlnci t)aDuru pnu0apxomo3ild aDel(mo;()altoxr3ta1fmD luvs s)teur(mpnodal elnetls aDua(rono1teenif3tltlmDeanmp;t) exoxoctadlmtrauvolt srtmxopio1omeelnetat)artmxr ;t1texnmf3iatfm2elnmpnu0tlxomf to1omDranvsls)trurimpiy1ale livia()a2rruronu1olx  oetltfa2um( s;u) eenxocio1fat  u s t0s2triopny1llt mnetl(  2raxm ot0teeo f3iydla rmu pn(4arxnif oa1optrai ils0 2xoir3nydol nlics tfsDrax  ;o1opt mi3tadfs um( o;t) lxnif ootfmDrln sls)teumxr iudapte neta() 2ta(m ;t4tpen f3iys m elnvp;t) eeoxrciy1fmt aneilt) etr(mpoydlptn ici t  Dra(mpno0tet mf3tld aDulnvp;t0 rtoirctadomDeanei;(0sexm(m iu1lmeemivsl( sDrmumonu1tpx mfetytlm uau onu4 ltomocoadfptraivols)trtmirpoodale  ies tfarraurpoo4tpt mfctldfa rlu s () rtnio3ootom raneslt) euo(o ny1al  mnvs s  Drrx o;t0aex ifeiatfa2ua( o;t)tlxnir3oadfpDean o;( trtm(o iydamtnlfet sfs2umxmpot1oetomociatlaDem( sn()tlxoir3iytoat lnvi;(  rtm(r3iy1optnliet t)sDrmu pno0tlxniiciysfs2uln pn(4trxnxoctodfpD aiei s trxrxo oy1amtnmnes t sDra(r ot4ope mo3ild mDumnvp;u4tltoxfctodlaDrlivsl(0 rxm(o3oodlp n ivil(f Dtmxm ot1altn i3iadlaDum( s t4texnif iadopDeauvo s  exoirpnu1lmt lfesa( arua(rp;o1oltoiicilt sDem(vs;u0alermr iytopt  ies s0t2tmio oy1ap   ncil() rumurpoo4aeen fciydlm2umu o u4altnxr todfpt  i i (0sexrio3oydopt  ncils)aDrm(  ot0tpto f3iatfsDulnmp;u0aexnmfctotop  lu s (0sexoim ny4ll nmfct (f Dumxm oo0aeeomfeiasfm elnmp (0tlxoif3ta1omtrlieil( srxoxr3oudamee ncil() Dta(r nt4apx mociltfs2rmn o u4aexnmf3oatlmteli sls t2umio iu1lpt mfvs ()s2tmxr ;u0tetomf3tysfaDrmn s u)trenxocoatlaDr i slt teuo(mpnu1am n nct ()aDtr(r ;o4tlenmicild m2emu p u0trtoxrctytlat lnvo t s2xr(r3ou1optemfeils)aDrr(root0opeomoeiyd m uauvp;u0 etomr3ta1fptrlu i;()s2toxopny4opt mfvta()artr(m nu4alenmociat aDeau pnu4alxrio3tydom rlnei ( seumio3ou4ol   fcils sDua(mpoo4tet io3iydls umumsnu4 renxr3oytomDeln o t) etmirpny4aptemnesas  2uaxmoou1oetoifctadfs uln s (4areoioctydlp eau o s) 2tr(o nodame mieia(fs2rrurpno1apt if3iydla ul(vp (0trxrmf iadoaDelues;(  rxrim ny1lpt  ieiatfartmu  no1opt ii3iadlm ranmp u4aexomo oadopt  u slt)s2xmio iydomtelnciat)sDrrx  no0texoifctydfm rauvo () rtrmoctodfmtrlivol(0t2xoxo nu1ap n fcs ( s2ua( onu4tex ioctas mDua(vp;u0trxoif3todfat anvi;s0t2xm(o3nu4om   ies ()arrrumpot0tptn ietys m emump;t4tetnmr todlmtelneols)srxoir oydamtnmietls aDrmum oo1alt if3ildlaDrlu s;u0 reoir3iytopD lnei;()s2xrirpnu1lmtn ncia()srur(mo;u1oexnmieiyslm um( s (0 exnmr iotopteluvi;()srtoiopoydlmtemnvs s arta( o;u1apxnmf3ilt a2ulnmo;(0arxnmr3oodfa  aueslt0srxoim ou4al emfet s  2ur(m no0tlx micild a2uanvsn() rtoif3ty1fp r u ils)seuoxo io1lltn fvias  2raumo;t0oex  ieiytfmDum(msnu4tltrxo iy1fmD livs;() rurxo nu1llenmfcs t)s2um(r ;u0olto ictas mDrlnmp t4 lenmf3oa1om e ivolt0texoirpnodap nlnvslt)a2raxmonu4olenii3ilt sDeln pnu0tetoirciodom  aieo ( teto(o3oy4alt lnctl()s2ururooo4oetnmoeiadfs2em(mp;t0tltriocio1lpDran s s  etr(opou1lp emfci t  2trx ooo4ale  f3iatfa el( o t) lxomo3iydlmDrlnes t0t2umxmpny4altn netas a2umxmpou4oet  octlsfs2ua(vo u0tetnmo3ta1oa rln ils)srxoxm ou1al n ietlt  rtrxm no1tleo ictlt s2el(vo;u4aeeoir to1opDran s s)t2uo(m io1ale lfct sfs2rrxm oo0apt mi3tadla2uau s (0 renxf3oydopD lnvi t)seuo(m ny4op n feia(fsDtr(mpno1tet ioeiatfm umn onu)areoio oodfaD  uei;() 2xr(mpoodlptelfvtas)sDurx oot0alx  icildls2um( s () lenxr oydlp e ies t0 exmir3nu1lltn netat aDra(r oo1oeen ociydlaDemuvo u) rtrmo oydfp eanvolt0teurimpoydol elfetl(f 2urxro;o0olt  i3tyt s2ranmsnu4trenmr3to1om e nes;() rxrir ou1open ieiatfartaur nt4tetniociyt m2eauvp (4tetnmf totlaD lu i;(0t2uoxr io1omteliet t aDtaxrooo1tleomieiad m2umu pn(0 rtrifctydla r uei t0teumxopiu4om e nct t)a2trurp;o1optomfciytla ulnmp u4tleomocootfmtr uvsl(0 rxr(opny1ol elicta( a2raxmoou4oeto ieiadlmDemn s u)aexomf3totfptrlnvs;t)t2urim3no4op emnctls)aDtm(ro;o0optnmicils a2rluvo;t0 eeomoctydoa  lnesls0s2xmxr3ou1ope mivtls)sDtru poo4ole mfciysfa2rmnvpnu)treomr oatlm eli ols) 2umir iy4apt lnvia()artmxmont1oee mieiatla uanvo t)artomfcoadoa   ieo;(0 rtm(rpno4ap n iesl() 2umxro;u4tex mi3iydfa2rmn p;u4 lxnxfctotfmteanvi;(  2trir iydll emici (  Drrum oo0alt  feiltla2ea(vsnu4 lxoxrctodfpt aueo;(0 exmxrpiy1alenlivi t)a2ra(rono4oeenmoetlsfa2eau p (4alenmr3totfmDrluvo (0 etmxopou4alenlnci s) Drru  ;t1tex mf3iysls rm( ont4arxrxfcoa1la rlu olt0s2um(rpnydlmeemietls)a2rrur no4olen oeiadfs elu p u4aeeoio oa1faDeau s;t) rur(o3io4aptemies t) Duaur ;t4ale mo3iad s2ra( s u0 rxnxrciytlmtrlnvil()trto(r iu1op   fcil(f rumxrp;t0apxoifeiatlm2ra(mpnu)alerirciotoa elieo;(  ruoio iy1lpeelivt t)a2tr(mp;o4tlxniocilt m ran o t4arerio3totoa r uei;(  2toio3ou1lp e ivi t aDua(rp;u1alt mi3iyd a2emuvo (4aetoxf3tatlmDrln o;t)sexrxmpio4lpt  nvi t)a2ua( oou1opxomietlt m ea(mp;()alenio oatopDr iei;() 2xm(mpny4lltemfviat) Dtm( pot0opxn oeils a2ua(mp;t)teenmo3tydla  lu s;t)trtmxmpou1om  mivs sfa2uax p;o1aleniietlslmDraumsnt) ltnxfctytlmDrluvi;s srxrxr3iu4altnmfvta()arrrur oo0apxomi3ildfs2eauvpnt4texnio iatlpDe nei;()srurxo3nudamee ictls aDuaurono1tpenifeias s rluvs ()teenmr3ootfaDelnvo;(0 2um(mpiu1ome  nesasfs2truro;o0tetoifcild mDemnmp;(4tetnmr3tydfa rln o ()trtoiopiydlpt  nvt s) Dumxmpot1tee moetls a2rm( ont4trxomrcio1fmtrluei;s0trxrxo3nydapeemict ()srtrx ooo4apxo icildfa2emuvsnu4teermo iydfa e n o;t  exmirpno1lmtemieslt sDrr(rp;t1tpt iiciatls2raump;u) rxomr3oydfmDe i i;t  rxr(opno1omtnmfvsatfaDrmum oo4oexniiciat aDelump t4 rerxfctytoptr uei;s0 2xmxm ny4lp e nvtls)aDurx ooo1tetnmfctadls2rluvsnu4 rtnmrcoytfa  ai slt0 2ur(rpoy1oleelies tfa2umumo;t1olxomoeilsfm2ea(vp;u4 renifcty1omt auvols srxr(r3io4om   ivt ()a2tmxr ot0texomo3ilsfs umnmo;(0 rtrifcty1lateaiei s)trtrirpoo1ome lneil(  2ra(  ou4ope ioeiltfs elu s;u0 rxrmr3tydfpD  ivi;s) 2tmimpiy4lpeemnctls)sDumu oot1alx iicilslm2um( o;u)tleoxocoo1op   n i;s0trxrxr nodomenlicil()a2urxmo;u1tltnmfctat m2elu sn(4trxnmr oatfmDeli slt srxrir io1opt mnetas a2trxr ;u1tlt mo3ilsfsDrmnvo u)arerxrcoytla r i il(0trurir3ou1optelieil() Dtau p;u4optnmf3iasls rlumsn(4 reoio3ia1lpD lieo ()s2xmir3oydam nmnctas srrmum nu0optnmf3iltls2ua(ms u0tltoiociydlmDrlu s s seto(o oy4ll nmnesatf Dumu  ;t4tee moetltlsDelu pnt0 renxf3oatfp e u i;t) rur(opiy1ame  fvia(f 2rmxro;o1texomi3iytlmDul(mpn(0arxnmr3oy1fm eai s s)s2urio3nu4ol   fcilt) Drmu o;t0altoif3iadlm2eanms (0aeermr3ta1fmtr ueo t tetoxo ou1olt  net ()sDum(rpnu1tpe  ociat m eau pnu) etrirciy1opte u slt t2trxopnudamt mfvi tf 2tauro;t0aetoiietadfa2rau snt4aetnxo iy1fp  auvo;t) eur(o oodll  lics s)aDrr(m oo1tlxo fetatfs2rm( pn(0 exnif tytop  aivol(0tetrim oy4olt  fvilt  Dtmum ;u1alt mi3iasfaDrlnvpn()teeomfcio1fpD aieils)texr(o3ou4ll e nesl(farraum oo0apeoiieiys sDumnmp ()aexoxr oydoaD aneo ()s2xrxo3oodom   ietl(fs2rmxmpnt4alen feiydfs rl( p;(0 ltrxr ta1fateanvo;t)srtmir iu1omtnmnvils  Drm( ont0tltnmfciydfaDua( pnu0arenmr3ootfaDr ies;()t2xoio3oo1amtemnctlt)a2ua(r nt1texomo3ils s2ra(vs;t)aeeriocto1lm  lneols)srtm(r iu4op nmfet (fsDuax  oo0tlx iiciaslmDelnvpnt) ltnio iodopD  u s;t)trtrxrpoy1omeelnvilt)aDtaur ;o0oltoiociadls2elnvpn()aleoxo totlp rauvo ()texo(o3ny4ap   ics s s2tr(m ou0tpx ifetysls ulnvon(4tlxrircoa1fp e n s;t0 2um(opio4om emfviltfsrrr(  ;t1oeeo feiytls2rmnms u0aetnif3tytfmDeaivols)srxmxm3ou1op   fvtls arrr(r no0aleniiciltfs2rluvont0 rtrxr3iytlp  livsls)setmio3iy1ol n iet sf 2tax ono4olt  feiasfm2ranvon() lxomrciytfpt aivol(0seuoio3io1lm e neta() 2rmxmoot1apxn ieild m2ranms u4arerxf oytlp rlues;() ruoim3oodole  ivils)sDta(rpoo4tpxniicilsfsDrm(mo;u0aexrxo oydlp raivi (0seurxm3ou1oltnmivt ( sDuax onu4aetn o3ilt m ran snu) eeoxr iadfm   nvil(0texrxo3iu1lle mfei s) ruau o;t1tptn octydlm emumo u0artnmf tytlmDrlnvs;s0t2xrio3iudal   ivsas arta(monu0olx iieiyslsDuanvs u)aetniocoydla e u s;s) 2umio3nodamenmfetat a2rm( o;t1oeen iciyd m2rln o;t4tltnifcoatlatrli s s)texrio3nydap elnvtas) Dumu pno4tle iieildfs2ulnvs (0texoif3oatlp rlnvi s0texmim nu4alenmnvs ()sDumur nt4oeen fciat mDelnvp u)tltrxf ia1op  ln ilt t2toxmpoydllen ietl(fsrtm(m nt4alto ocildfm2umu snt0 etnifctatfpDelnvo;s seumim3io4lmtelneilt  2ua(moou4tleo fcildls eanmp;(0areoifcoadfmDraneo;s0 2tr(m ny4omeemivslt aDrmxmo;o1aptnio3tldfaDel( s t) rxrif3tydomteaivi;t  etm(o3io4ol  lnciltfarumx poo0alxn feiltla2ul( p;t0 renxf3tytfmDelivslt  2uoio iy4lltnmfeil(fa2ta(rpnt4tltnmociat a2em(vont4 rtnmr iydlatrlnes s)s2umxo iy4open ici s) rtmxmpno1oetomoeiysfsDuanmsn(4tltrmf iotfp r ues;( trtmim3nydlpte fcs ()a2umxm nt4olx ioeiyt s rmuvpnt)trxrio3oa1lpD aieol( s2uoxo ny4lpeelicslt) rrmuroou1oet  oetydfs el(mo;(0 eerxfcta1opt li s s sexrim3ny1llenmivi t) 2raump;u0opxomfciadla2em( s;u4 etrmfctydoat  nes;s) rumio oudalt mfvtasfs2trxmpou0texn feiadlmDua( p;()tlermo oy1laDe ivs;s) 2xr(r oy4omenlietlt  Dra(mpot4olxomf3iasfm rm(vpn(0arerxf tadomDeai o t t2uoir3io1olte fetlt artaxroou0tltn o3tadlmDum(vsn()texnxf oo1fat li s ()sruoxopoy4amt mncs s) 2rrum ou1oeeo ieild m ulu o;u4tltrmo3tytomDrai o t) 2to(o3io4lmtnmnviat a2tmu o;u1apeomoeiatfa2eaumpn(0tetomo ta1oa eliei t0s2tmio3oudome lnvta(  rumu p;o0aee  o3ilsla2uauvp u)texomf3iatom raueilt0texrirpny4lle lnes t srtm(r ;o1oeen f3iltfs2uanvp t4alxoif oydlp rlnvi;()setrirpnu1oleelivslt)aruaxmpno1olxn o3tadfsDuau pnu) lermo3oy1oaDe ueo ( s2xriopnu4omenlneiasf 2umurpno1tltn f3tadla ul(ms (4 exomf tatomDe ivs;t) rxr(o3oy1ol nmfvta( s2umu onu4apx mi3iyslaDrl(mpnu) lxnmoctodom rluvo;( setoxr3ny1omee nctas sDrm(  ;u1oexn ictys a2umnvp t4 renmr oodlpt livil()truoio oodol nmfvi sfarrm(rp;t1aexoiictydfa elumo ()altrxr totom elnvi s)trtoxm3oodlpt mfct t a2rmur oo0apenif3ilsfa2ua( pn(4aexnxocto1lpDr ues;s  rtoim3oodol elietasfarua(m nu0optniociysfm rmnvs;t4 rxnioctadlmD  i ols  2uo(r3ou4lpen ivsls  rur( ooo0oeto f3tas aDrau on(4 rxnif oatlpDeluvsls)s2xm(m3no1omt mnciat)arra(m ot0tetn ociydla2eluvpnu) rtomr iatomD auvo t  eumirpiu1ol elnvi sfs2rmxr ou4apen ieiyt m rl(ms;t)teeoifciatlmte neolt seto(rpoodalenlieta() Dtaxm nu4tetniictlsfs el(vsnu0 ltomf iodla  anvsls) 2urirpoudlltnmieils)srum(mooo0aee ioeiasfm umu s t4trerxr3tatfatrluei t)t2uoirpoy1ome  feia(  2trx ooo4alxnmoeiyd sDrm( o t4alerxr3tatfpDr uvs (0seurxmpou1op n fei ( aDrrxm ;t4oeeomi3tadla rl(vp t0 lerxrcoadoa elneolt) 2xmxrpiudol nmfet t)s2taur nt0oexo fctad s2ranvonu0treoxfctotfpt anvi;()texm(o iu4alt mfei t s2uaxronu4tptnioeiytfa umn ont0aetnmo3iadfp rai i s)seuoir nu4ap emiesl(  2raurp;t4opeoioetadlm2rlnms t4aexrircoytoaD li o;( s2umxrpnu1op  livt (  ruaum ;u0tptnmieias mDrl( o;()aexrmf3iydop   uvi;s)sexrxrpoodaptnmicta( a2um(  nu1aee ioctltfsDea(vsn(0tlxrmo3iatomDeaues ()srur(opiudole  ivt s) 2ra( p;o4tptnmf3ilt aDrmuvp (4aleoif iydopte ues ()t2urxo3iudlp e fcsas) Dtr(mo;o1tpt  o3tydfsDrauvp;t)arxoxf iotfpDrli il()t2umir3nodole lieiatfs2tru oou1tee mi3ilsfaDrl(vo t)aetrxf3tadlaDr n ols0 2xr(mpoydalee neslt)s2rmurp;t1tetomi3tls m2em(mpn(0teeomr totfmDraueil( trxm(rpiu1omeemncias)sDuaumoou1opxoii3iltfs ra(mo u0aexnmo iodoa ean sls0 rxmiopoudop   nvi t) 2ta( oou1tle iietaslaDrm(vs t4 lxnifctatoaD li s;( t2xm(o3io1opeelfcsat)sDta(mo;o4aetn fctlsfa2rluvp;(4tltnxr3oytfaDr uvol( seuoirpoy4lm n nesl(  Dtmurp;t0apxn feiatla2rm(ms (0trenifciytlmtr u s;(0t2trimpoodol e fcils s2ta(  ou0texo i3tldfs ea(vo u) rxrif oo1oa e i i t0s2xr(o nydomte fvsl( aDrmx ooo0tlx  ocildfa rmuvs;()trxrio3ta1fa  ln il( sruo(m3io4amt  fct (faDuaxr ;t1apxn f3tldlmDumnmp;t0 lerxf3ta1lmtr n s;s) rtoxr iy1ale lnet t aDuax poo1optoifeiatlm2rauvs;t0teeoxf tydlpD livs;t trtr(r3oodoleelncs sf rtmur nu1tlxniieild m rlnmpn() eerir todlpt livolt  2xrxrpoydaltemfvsls)s2raxmonu0tpx iictldfs rmu p;(4tetrio3to1op  lu slt)teumiopoydllenmfvsa(farurumpoo4oeeo f3iat s2el(mo;t) eerxr3iydla rai s t) rtriopny4ole  nciatfs2tm( o;t1alt mo3iat a rln o;u4trtnircoo1fateln s;t0seumim3iy4llen neia( a2umxrono4alxoiieiyt sDel(mo;t) lermr ootfa  lnesls0 ruoim3oy1ol  mivsa(fsDtm(r no4alen f3tlsfs2elnmp;(0tleoio3iodlp r iesls0teto(r3iydlm e nvtatf rtrumpno1aleo ietat s2el(mp (0 etnmr tytlaD auvs;t)s2xmxm3no4llee fvi s arraxmo;u4texnmi3iltfsDuln snt4aetnifctatom elieilt t2urirpoy1ole licil() rtrumonu1oex  octadfs2emn on()altrmo3tatfpteli olt) eurio ou1apeelfvtatf Draum no1alt mf3ildfaDumums u4arxrmo3iodoatr ieo ()t2xmxo3ou4oltn feia()a2tru o;t1opt  i3iasfm rlu p;t) reoif3oytfp  anvil(0srtrxm3nodlme  ivsa( sDuaxm nu1oetn feils s ra(mp;()trtnmo3oo1fmDr n sl()setrimpiy4lpenmfvias  Draumpno0oltoioeildlsDul(mp;u0aeenxr oatoateai s t seuo(opoodll n fcsa()a2urum nu0teenmfeiysls2eln p;t0aexnmf3tytoat aues t) rxm(m3oy4lpe lneia( a2rrumpou1oetomi3iyslsDumuvo u) eenir3oodlp eaneo;(  rtr(m nydlle mnesls sDrau  nu0aeeomf3ias m2ranvpnt4trtoio to1fp  lneols sruo(o3iodlp n fvslt  2trx o;t1olx if3tldlmDul( snu0 lxnio3tatopDraiei;s  rxo(o oy4om   ies ( a2tmur oo4apeoif3tydla2elnms;u4aleoio3io1la raneil() rtr(r oodalt lnetas)aDtr(m ;t4oee  oetyd m el( s t) rxniocto1lpteaiei s)seurim3nydamte fcsa( sDrmxm nt1opt  fcild sDrln onu0trxomrciotfm  aies t srtoxo3oo4lp nmieias)aDtmu  ou1tlxomf3tatfsDrlnms;()artnmo3tytoaDe nvs t0trtoirpoy1omtelfci t)srumuro;o0openmoeiyt sDumuvo;u0aetnmo3oy1op  aivs t0sexoim oy1amt  fctlt) 2raxr ot4aex ioeiadfa2eluvo t0tetnxfcoydlmDean o (0srxrir oudaptn fesatfaDuaxmpnu4teenmo3iyt a2ua( snt)aetoxrcoatlm eluei t0 2uoxo oo4aptn feslt)srrmuro;u0apeo f3iytlmDemnmo ()arxoxo todlptr nvs;(0 eur(o3ny1ale  iesa() rua(m nu0tlx mfciasfsDrmumo t4aeenif iatoaDrluvs;s seurxo oy4op elncsas sDtm(monu0tptoif3iys mDrlnmp;()tlxnmrcoatlpDe ueil( seuoxrpoo4lp  mfcias) 2ta(m nu0ale mociatfsDumumsnu4 rtoif ta1faDean o;t srtmir oodap  mieilsf Drax onu4oexnifeias s2ran ont4tlenxo tytopt auvi t t2tmimpnudlptelfes sfsDtax pnt1apxn o3iytfs emn o;(4trtoxr totlm rlnei;s0 exoim oo1aptnmneiltfaDtmxrp;o4optnmo3ilt sDrl( snu4 reoxfctotoaDrln i t0trxo(o3nydoltemnvias  2uaurooo4tpt mictlsla2rau pnt4tleoxf io1oateauei;()trxoimpoudlmt lieslsf 2uaump;t1oexoioctlsla2emu ont0artrmo to1lpDe n i ( texoxo iy4lpee nvsa() rra(mont0olx  f3tytls rm(mp (0texrmfcty1la r nvo s0srtrxm3iy1op nlnvslt) 2tmxmpou0aetoifciadfsDrlumo u)texoio to1fm  auvo;t)s2tmxm iu1lpe lfeils aruaur ;t4tle  f3iat mDrln p t4aeeoxf3tydfaD ai ilt0setr(o oo1amt lfeilsfs2ua(ro;o4tet io3iasfm2rlnmo;u0tleomo3iatfa   uvsl(0t2toir3ny1am elnvslt)a2ua( pnt1oexo ietat a uaums;u)alxoif tydfm rai i (0t2ur(r nu1oltnmnetas  2umu  oo0oee if3tydls2ra(vs;()teerxf3tadomDean o s s2uo(opoy1amtnmfvtls srtmxmpnu4aleniicildla2rmuvp;u)alenmr3totfmt lneo t)srumxrpnydoleelnct (  rra( ono0tpe  ociadfs rmnvp t0 eenxo oydlmDeanvils0 2xoxm3oo4lmtn fvslt)srraxro;u1aexoifctldfs2ua(mpnt)texnxr iadoaDr ueo;t texm(r iy1lptelfet () 2um(  ;o4tpeoiociytfa emuvo t0trtoiociodopte ueo;(0trur(mpou1apte ncsl(fsrraxmp;t1aex  o3tys a ulnvon(0arenir3tytfmtraivs () 2uoxr3nodol nlnes s  Duaxrpot0opxnmoeiasls2uan p;u4 rerxf3tytlaD  ies s)t2xr(mpiu1olt mnvi t  2rrurono1alt  oeiytfm ul( s t0aeeomf3oa1lmDeaueo t srxrio no1alte fvtls  Dta(ro;u1alxo o3tasls2umn s;u0 lxoio3iadfate uvs ()seuoxm iu1al nmivt s a2rrxmpno4tet mf3iadfmDrmnvsnu)texoxrctatomte ieo;s)srtrimpoy1lp e fciatf rtax p;o1apxnmieiys s2ra( p t4tleoir3io1om  lnei;t  etoim io4lmtn fctltfaDtrum ;o1aexnmicilt sDuanvon()teenio3tytlpt lu o;t)t2um(m oo4ap n ncil(f 2uaumpno1oee ifciatls elnms;(4 exomr3io1laDean slt0 etm(o io1amenliesa()a2ra( p;u0alxn feiyslm uan pnt4 exrioctatopDraueo;s)t2xm(mpoo4lpenlnet t)a2tmxmoou1oexnmietydfa ea(vs t4tltnmrctotfmDeauvo;t trumim3oudapen ncil() 2uaxm ot4olxnioetldfa2uanmo;t4alxomrctytop r i i (0setrim oudom  mivt ( sDurxmp;u1oeen ictadls2uanvp (4alxnxfcta1lpD anes;t t2uoxo3no1aptn ivi sf Dur(rpou1tlxnii3ild aDumu sn()texnmocio1oa  lnvs t0 2uoio iy4om nmfei s arumxmoou1oeenmociys sDumuvp;t0tlxnmr3ta1fmtelu o ( teum(o oydlp nlncslt)arrmurono0oee  ieiat sDum(vs;u)trenxo3oa1omtrlivi s) exoir3io1oltelfetl(f Dur(mpou4ale moeiltlaDem(vp (4alxrxrctydom raivols srxrim3oy1oleelfctl(f rtmumpou0apxo ociys s2ua(vs ()teenxf3tydlmD lnvs;(  2uoim3io4ll  lncia() 2trxronu4tlxnmfciadfs uaumpnt)tlxrxfcoydlp  aneil(0 2trir3iodlm  mfcsas)srrr(rpoo0olt mociysla ea(mo t)aexoxf3iodfat  ivil(0s2trxo oy4lleemnct (  Dur(  nt0aet mfetadfsDrm( s;t) eeomo tydla eaies;( tetm(r iu4am  miet s) rta(  ou4opx mo3iad m rlnvs (4aetnmf3oadlaDeln i;t s2umxrpiodame lnvt sf 2ua(  ;o0oexn feiytfa ra(vonu) eenmr3oadoa eauvs;s0 rxm(r3ny1lmenliviasfsrtr(mooo4tptnmi3tldfm em(vpnu)alxrif3tydop  lnvi;( srxrxr3iudol  mictltfsDta(mpou1aeenmi3ias mDelu p;t4aexoio3ty1fmteauvi s)t2umimpiy1lpt  nvta() Drmx pot4oetoifetldlm uanvp;(4alxomfctodfa eliei;s0sexoxopou4omtemivt ()aDrmxrpnu1olx  iciaslm umn ont4 eermf3iytomDr ieol( t2urxopnudal  mfei (f ruaxr oo0aex  fetat a2el(mo;()texoir3oodomDeai o;s  rtmxo oudopenmnvias)a2uaumono0teeoiiciatlm2ra(vs;u)artomf tadoptrlnvsls s2xrxmpoudolen ncta()s2tmumont1tltnifeiatlsDua(ms;u0altrxf3todlm  li o;()trtrir ou4lm  mnctlt)sDtrx  no1aleoiietld a2ean onu4tltnxrcoatlm  ai il( t2xoirpno4lpe mfes ( aDtrxr nu0tltnmf3iatfmDelu snu4 rtrif iotfmt ln o;s0srtmir iy4omtelnctlt aDrax pou4aeeoif3iasfs2umu s;u0alxnifcoa1omD  n olt srto(r3oy4altnmfvt ( aDrm(mpnt0opxnio3iytfa raums () lenir3tydlatr i o t0texo(m iu1lm nlfeilt)a2rm(m ;u4tlxo icildlm emnvs;t)arenif3oa1fmDrlu i ( t2tmio3iy1opt mnctatfsDrrx ono0tpt  f3ilslaDrl( o;u4trtrxoctydlm   nei;t0t2xmxo nodol e nvsa(  rtmxr ;t4tlxomietytla2em(mp;() rerio3tytoa   nvo;s  rurxr3ny1opte fetl( s2tmuront4altomociadfs2rauvs;u0arxomrcia1lpte u sl()srtr(mpny1altn nesa() rtaxmpoo4openifeilt sDulnvp t)teenmr3oytlmte nes;(0t2xrirpnodomee ivtasf rrm(r oo1optomieiysfm ulnvo;u4trenifctotfat  nvils0 eumim3nodamen icias) Drax ont1tpen iciysfm2ranvp (4trenmf oydfm ranvo;(0teto(m no1lle mfvs (f 2ur(rp;u1oetnioeiasls rm(ms u0aleriocoo1fm raivi t) eurxm ou4omenlivtls  rur(  no0tetnmi3iyd a2eln p u) lermf oydlmteai slt0texo(opoy1ap   fcs tfaDrmxr ;o4oeto ociytfm2rlnmo (0 rtoxrctodlp e nvi;t)srtr(o iodapeemneia()a2trxmo;u1tltomfcildlm2uan o t)alxrmr oy1omDeanvo (0 rumxo3iu1lp nlfvsltfaDtm(  ;u0oeeo f3iatfm ulumsn(0 ltnxf ia1op ranvil( srtmir oo1ome  nvt (  2uaxmont0aleoiietydfsDuanvp u4 etrxocty1lpt luvs t)sruoir oodomenmiciat sDtm(  ou1alt mf3tys aDum(ms;(0 reoio3oadfatrluvi;t)setmiopoydlmee ict s aDtm(  no4tee  fcils m2umuvon() ltoxr3oatfm r neol(0srxo(o3oydlltelneilsfartaum ot0alx mo3tyd a em(mp u4 lenio3tydomt  n slt0srxrio oo4ll nlnesls sDtrum ot1tleoio3tytfs2em(vonu0 leomrctytomte neo s0 rtr(mpno1al n ivias s2rrum ot0tpeo o3iysfm uaumsnt0artrmfctatlmt ln i;( trtr(m3no4lp e nctls arrru  ;u0tleo iciltlm uanvpn(0 ltnmr totlp rlnvs;t)t2trxrpiu1lltnmfvi t s2rmur no4tee mfeiysfs2rm( pnu) leomrcoy1opteaneol(  2tm(r oodam e ics t  Dururpot0tpto oeilsfa2emn o u0aexnirctadfmteanvsl(0seum(opoodamtelnetlt  2rmumpot4tpeniietatfa rmuvpnt) leoxr ootop eln o;s0setr(r3iydoptnlfeias sDua(r nu0tltnmo3iatls2ua(vsn(4 etnmocia1la  lies s0s2xm(o3nydamt  fctlt)a2rm(m ;u4tlx mfeiydlmDeau s;(4artnxf3tadfpte uvs;(0tetmxm iudamtn icsasfa2ta(r ;t1aeenifetys a2ea(ms;u) exrmf3iy1opD ai o (0srtoir3iu1llt lnetls  rrrump;t4olx ifetysfm uau s ()tlerir tadlm   ieslt seuo(o3iudllt lnvsl(farrauronu4apxnifeiatfa eanmont4 eenmo oadlmt lnvslt)t2trim3ny4omtnmfvsl() Dumx  ot0oetnifetasla2uanms;u4artrxo3oatfaDrlivo;s)t2tr(rpiodom nlicslsfsDtax  oo0aetomieiysla2em(mpn(0alermr oodlp eauvsl(  rxo(r nu4lm  mnctas s2tau  ;o1aleomo3iys a2emuvpnu0 exoio3iadfaD au olt0srtmim3nu4lpe  nvsl( aDrru  ;u1tltnifeiat aDra(vsnt4 eerio3todoat auvsl(0s2uoxm3oo1am nmnvi s  Dum(mono4texnmoeilsfsDrlumpnu) etoxr totfateau ols trtr(r3oudamenmnes t aDtru ont4apenifeiydfaDelnvp u4 rtnmo todfm eanvs;( srxr(m ou1lleelictltf rtm(r nu4opeomi3tyslm emump;t)arxoxr oodlmtelnes t texo(r nydal emfeilsfarumur oo0tle mo3ilt m2em(mo t4teenio oadlmDelies;s)texr(r ny4amtnlfvias sDra( p;u1ale mictatla uluvsnt4 eenmfctydlmDr nvi t)t2trim3iodlp n net t aDtmu ono0tpe miciysfm2ul(ms;t0tlenxf to1fm   u s ( sexoir3iudam elietat  Dumxm ;o1tleo i3ildla rmuvs;t4aetoifciotomt ln olt srxmxr3oy1al   fvsas)aDrm(  ot0openif3iysfsDumumsnt4 rxnircoadfm elueo;( tetm(r3iy1apteliet s  Dtaxrp;t4opxnifciltlm2ua(vo t)trenif oy1oa rlivols0s2xr(r3oo1om   nesa()srurxm oo4aeeomfeilsls elnmo (0trxnxrctydopteai o t)tetmio3no1oltnlnvias aDua(ro;o4tpxnmoetas mDeaumpnu0altoif iytfptrli ols0trumir3nydam elnvsasfs2rrurpnt1tlxoioetltls em(vpnt0 rerxrcoodlp r ivi s)t2xoir3ou1omtemfet s aDrmu pno1texn octytfsDulnmont)artnir3oy1la e ieol()srurxopoudope mncilsfa2rmum ;t4tle ii3ilsfmDua( p (0 rtnxocoa1late uvolt srurxmpou1lpte feias)arta( p;o4ole  oeild s rlnvs (0 reoifcto1fmDeanei;s0 2toio3oy1lmenlicias)a2rr(ront0tptn o3ildfa ul(vont)trtnmf iy1lp elneo ()trum(m nodolen iesat)srtmump;u1oetn f3ils sDul(vs t)areomr ta1lpDr ieo t)seumimpou1llt lfctat sDtm(r ou1ole  fcilt s2rlump;t) eeoxo3ia1fmt lu i;s seumim3oydam  mivta()arrr(rp;t4optoio3iyt m umums;t4arxnxfcoa1fmD  nvs s0setrxm3nu4omtnlfctltfs2trxroou4aet  o3ilslsDrmn pn(4 reomrciadfmD aivols0 euo(o ou1openlncs s)sDuax  ;t0aee  fcilsfa em( s;(0tetnir3oa1fp   ues () euo(rpiu4ol emietltf Duru pot4apt moctlt aDrm(vs t0 lenxrcoa1fa elu s;s)srtmxo3oo4altemivsls) Dur(m nt0tpxomociltlmDuanmpnt4aetrio3oodlat li s;s)trxoxm3iu4ll emfci t)aDrmxro;t4tpt moeiasfm2eluvs t0teenmf tadfmte i o;t)tetrir3iy1opee ies sfaDtr(rpnu0apenmi3tysfa2emnvon(4trerio iydlaD anvs;s0t2xo(m3iu4al n fcslsfsruax  ;u1alx iieiadla emn s (4alxrmr ty1opDrauesls  rtrxrpny1optnlfct s) rrau pot4apeo feildfmDumnmsn(4tetnxrctydlptr ivo;(0trxmxr nudom emiet tfaDurxro;o1tpe miciysfm2umu pnu)trxrmo totopDr u i t0texoiopio1lp emietat)srraxmpnu0aetomictyt m2emu p;t0tlxomr tatfptraueols srtmxm no1op nlies t a2ra(mont4tleoii3tldls eluvs;u)aetoxo oa1lmtr nei t0trtrim io1omtelfeiat) rrau  ;t1tet  i3tltlm el(mo;() exrmo3oytfp eau i s tetm(m3oydam   ivils) 2um(  ot1tpxomocilt sDrl( o;t0aeeoio iadlptrliei;t setoxopiudap nmfcs s) Duaxrono0aet moeiyslaDua(vp;u0 exoir iatfat luesl( teumxm nodll e iei tfs2rmur nu0tptomf3iytfm2el( snu4 ltnir3todfpD  ivs t  2uo(m no4lmen fcia(faDrmuro;u1openmf3tas m2umnms;(4trenif3oydopteauvs (0srxmxmpoydomee nvil(fartruront4tpxn i3ilt m rm( pnu0artnmr iotop raivs ()teurim3iudal nlivs s) rrau p;u4apxnmfeiytfm ulnvo;()aexrmr3oodom r nes;()texoxopio1ap emict ()aDta(root4tet ioeilsfm ean s;()teerxrcoodfptrlieils)trxmim3oodapen fetl() rtau ooo0apeoio3tadfmDeanvpn(0trtriocta1faD lieo s  etr(m oo1oltnliet ()a2rrxronu0aexomi3iytfaDumnvo t)teeomocoodfa eaneils0s2ur(r3io4om nmivsasf rurxro;t0tlxn ociysfm emuvon(0 eenircootfpte ieilt) 2ur(mpoodop n fvs t)artr(  nu4tlx ii3iysfs ra(mp;t4 lenmfcoy1lmt lnesls0sexmim iu4omeelfcsa(fsrumxrooo4opxnmoctydfa2ua(vp;t)tltnxo tydfmt ln s (0 rtmxrpiu1ap   ici s) 2uau  oo4ope mfciytfm el(msnt0tetnxoctadlp  lnesl(0truoxm3nudalt livs s sDtrur ;t1texn o3tlsfs2rmuvsn(4 exnmf oatom  li o t) etmxm nu4ol n fcs (  2tr( o;o1aee mociat a ulu s u0tetrxr3totlpt luvsl(0s2ur(m oo1ome  ivia( s2tr( o;u0tpxnmoctasfaDrmu onu4 renif oo1la  anvo;t0 2tmxm iy1amt lfeia()arrmx ooo4olxomi3tasfm emnvs;t)treriocto1lpDe iesl( t2umio3nydalen ncilt)s2tmum nu4aeeomf3tls s ul(ms;t4aeeoifciatfat lieils)t2uo(rpiudop n fvi t) Dumumoot1ope io3tat mDel( o;() rtnio tydlpDrlivilt)t2tmxm no4opeelnetat) 2ur(mono1oltn oeildla em(vo t0trenxf tytom   ivi (0t2xrio3no4alenlnvsat) Dum(  nu0tet iiciadfmDumu o;u0artnxf3ty1opDe ueils)srxmxr3nu4alt lfvtl()aDuax  ;u1oltn iciyd m2umump t)tltnxo oa1fpt livs t srtmxm3iy1lm e ietls sDrmxmono4opx moetytls emuvo;u) rxrio ia1lateai s;t0 rxoirpoy4omenmfvta(farra(mpoo0aleo f3tadfmDuauvsnt4tlxnir oatop   ies s  2uoir3oudll elictltfa2rru ooo4aetnmfciltls2uauvon(4aeerxf ta1opD anes s s2toxm3nu1omt mivsls)srurum oo0tpxnmi3tydfa emumo u4 etrir ia1opDeln s s s2xo(r3ou1apee ivil(fsDtm(rp;t4teeo ictadlm ranvsnt0 etrmf tadoateaues t0 rxmxr no1ap  lfeslt) 2rau oot1oltnmoctatla emu p;u0tlxnir oatopD  nvo;() rum(r3io4op  lictas sDtmur no1tptoifeias m umuvp;() ltomrcoydfmteai ils s2ur(r iy4apt mnvi t aDrrum ;u1aptomf3tlsfmDrln p u0 ltrmo3tydfmt auvils) rxo(rpou4om emncsls  rtm( pno4optoio3tydla umn s u)aeenifcoy1omDrli i t)texrxr3nydlleelneta()srrm(mpnu4texnmfetytla2emu o (0aeeriocoydlpD aivs;()tetmir3iu4amenlfei sfartaxro;u1ope iieiytlm ranmp;u0aetnxfcootfaD luvi s)s2to(o3ny4llte nvsa()srum(rp;t0aetnmfctasfa ran sn() lxrif3tadopDeanei;t)texo(mpoydolenlnvsl()a2ra(r oo0oeenio3iysfmDulu o;u0aetniocoytfa elnes;s)trumxo3no1op emietlt)aDumxm oo1opto fcildfm2um( s u0aexrxr3iodlaDr uesls t2toiopiy1llee ivtas) rtm(r nt1alt iocilt a2ranmp ()texrmfciodfpD anvi;t0 etoxrpoo4amee nvs ( a2raxroot1aeenmocildfa2em(mont4aetrxo3tatomt an sl( t2xrxopiudaptn fvtls)a2ua(mpoo1tex mf3ilt m uauvs (0tlenir iydoaDrlues t0 2tmim3oudaltn ivsl(  2uax ono0olx mocilt s2uanvon(4 lenxrctotoaDelu i;s  2tm(opoo1am elnvsas  rrrxm nu1alxnmf3tls s uau p;u) rtnmf3ia1lpDrli sl(0 etrxrpoo1lm  lnct sfsrur(rp;t0tpeo ociadlsDul(vo;()alenmr oydoaDraneo ( s2tm(r3ny1lmt  icta(fartmuro;u1alt mieildfs umnvpn(0aeenxf iodfa  luei t0t2uoxr oodapt  ietl(  2tau  nt1aetn o3iyt s el(vo;t4 eerio3iytopDe ivo s0 2xm(o nu4ale mnvtls arururoou0opx mo3tatfaDrmums;(4arxnio oa1fate n i t  rur(opno1omtn fes t  Dua(moot0opeomiciatfm emumpnt4 rxrmf3tatfate nvs s  2tmio nodop  livi ( s2rr(mpno0tpxn o3iatls2el(vs t0trtrxrciadoatraieilt)trur(r nudome lnvtasf 2umxmo;o0ole mi3tydfs ea(vpnu0alenif3iy1oa   ivi t texo(r3oo1llt  fcs () Dtmxr ;o4apt if3tldfaDrauvsnu4 exrmo todfateaieo t srur(o iu1altelncslt) rta(mpoo4tle  o3iys sDrmuvs;(4teeoxr iotop e nvs;t0sruoxr3nydlltelfeta()srrru pno4teen i3ilsls2em(mp;(4treoircoodfmteaues (  2trim3ou1lm  liet sfs2um(mpnt1tex io3iasla ea(vo;(0aleoxf ootlpD anvs s) exrxr no4lp nlivsl() 2urxm ;t1optnifeiytla ea(vont)aleoio3ty1la  auei (0sexmxo3oy1omeemieta(faruaxmont0aetoio3iatfm2rlu p ()arxnxfciytlaD aieo (  2xrxo3io1alenlfeils)aDurumpno4tlxnioetas m eanvsn(4trtrxr3ta1oaDe neils0t2uoirpiy1lleelicslsfsDraxr ;u1tltomo3ild m ua(vs;t)aeenifcoodlpDeaivslt0 2trxr oy4ame miet sfa2trxmp;u0opeo ieiytls2rlums;u0aeerxo3ty1faDeln ols0 rtrio ou1ol  mfvilsfa2uaxmpnu1aexnioeiad s umnmp;t)aexoir oydlmD lnvi;t0t2uoimpiydlltelictas aDua(mooo0tlxoif3iad m rl( s (4 lxoxo oytlmDrai s s0srtmio3io1ol elfvtlt)s2ur( pnu0tpto f3iysls2ua(vpn(4tlxrmf oadomD  uvi (0texr(o3oudamenlictls) 2rmxr no4tpt miciltlsDea(msn(0artrmf iodlatrlues s)trum(o iu4apeelfviltfa2taumo;u1aeenmfcilsla emnms t4trtrifctydlm  anvs s)seumio3nydape  fetas)aDtau  ;u1tpeo fetls sDelumon(4tetoio3todlpt  u ol(0s2uoiopiodlm e netls)aruax ooo4ole  o3tysfm2uaumsnu4arxoxr oa1lmtelivilt)t2xrim nodlp nlivta( sDtrur ;o4apt  i3tasla2umu p;(4treoxo3totoatr ivs;t0s2tmiopoy1lpeeliesat)aruaxmo;o0aexoiicildfsDua(mo (4 lermo oatlpDelnes (0 rxm(mpou4om e ietat  Dra(r no0alxo octadlm rmuvp (0trtnmr3to1lmteln o t seumxr3oo4oltnmfvsl() Durxroot0tptoiieiysfs2rmnvp;()aleomociytlaD livo t0seumxr3iy1op emieta(  rtmu o;u0oexomo3tytfm2rl(mp;u4artrxoctotopDe ivo t)tetrxrpiydoltemivtlt  rurumpno0opxo f3iatlmDra(msnt4trerif3iotoa rli ilt)trxmimpnudlmenlfctltfsDua(  ;u1oeto oeiadlm ulnvon() lenmo3tytlp  aneols)s2xoxm nu1ap nmfeta( aDum(mpou1tet iociatfs rl( p;u4aexnirctydopteau o;s0t2tr(m3oy4om n nvtlt  2rr(ro;o1aex  icils a2rmu p t) reoioctydopteau o s srxoxm3nudaptemfei sf Drr(m nt4alenmoeiysfsDrluvp t) rxoxfctytlmDeaieol(  exr(m nydolt lnvil()s2tru ono0oet mfctas s em(msnt4aexnmo iatfpDe i i;() rur(r nydop emfetlt aDtm(mp;t1oeenmieiad sDeln 
\ No newline at end of file
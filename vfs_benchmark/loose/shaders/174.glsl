@@ -0,0 +1 @@
+ies s0trxoiopno1ole  iesl( arumu ooo4oex ii3iatlm rmnvs;(0tltoiociydfpDeauvolt0s2trxm ou4oltnmiviasfsrtrurp;o4apenifctldfm emn onu)artrif tydlmt liesls t2xr(o nydll elieiatfsrtmxr ot0alxnmfeiys m2uanmpnu) lxrio3tatoa  aueil() rtm(mpiydlpeemiei s a2rr(rp;t4opt  f3iydfm2uln o;t0aetrxr tatom  au olt texmirpiydape  ivil( sruax  no1opxnmoctldlm umnmp u4arerif oodlat lnvi ( seurxo io1omeemies t)srtmump;u4apx iieiys aDean s;(4aeeomr oadoa  luei;s)srto(m3oy4lpee nei sfarra(  ;o1oexnmi3iad m raumon(0trtrmf3io1faDelnvi;(0t2toirpoudameemnvsatfa2tmum ou0olxnmf3tlslsDemuvpnt4 renxr oadfmDelivi;s) 2trirpny4amen nvt t)srra(mpot4aptoioctlt s2ranmp;u0alermocoytfaD lu sls srxoimpiodlp   fcia( sDrm(rp;o1oeenmo3tydfmDelnvp;t4altomociatfatr i i t) eumxo3ny4lpe lnetlsf 2uaump;o0apx io3iyd s ran p u0texnxfciodoa rluei ()sexoirpiu1amte ietas)arrau oou4apx  o3iadfm elumsnu4alerxfcio1la  aneo s0seurio3iodal elncsls)srtrx  ou4tlen i3tldfs emu onu0treomr iydoa   u s t) 2xo(opiy4lptelnci (  rraxmo;t4ole mf3tydls2eln snt0tltrio oytfaDr iesls) rxr(o3no1lmenmfeils  2tau ono1oeeo oeiyd aDulnms;u4alenxocia1opteauvs ()tetrir3ou4optelivtls) Duax oot4ape mi3ias sDuln p;t0 exoxf iadoat aivo (  rxmxo iu4omenlfvslsfsrurumonu1aptnmf3iytls ranms (0 rxrmfctadfmDe n i ( trtmxo io4alt lfvsatf 2rr(r ;o1aeenifciasfsDeanvont4 ltomr oo1la  ln o;() 2xrxmpiy4lle lfei tfa2tr(ronu4alxoifeiadfsDeluvp;(0 lxrxf3iydlaDraies;s  eur(o3oodlltelicilt) rururonu1tlxomiciys sDumn s;u4 eenmr iodopt  ivs;s) 2to(o iudlp   ivtl(  rrr(ro;o1tleo fciasla rmnmo;u0texrxoctydoaDelneo;t)srxoxm3iudap nlicta() 2taxro;o1olenmi3tyt a2emnms (4artnmr ia1omteauvo s)t2xo(opiodlm nlfvtlt  Drau ooo0openmi3iyd m rmnvonu4alxnxf3oodla  ln ols0 eum(rpnu4lmt  fcsas)aDumx poo1aleniiciad sDrluvo (4 lerio3oa1opD  u ols0srurxo3oo1alenmneiat a2rru p;u4tptn i3iltfa ra(mp u)tlxoio tytfmD lieolt)t2ur(opoydal nmfes tf 2um(  ot1tetomfeiltfm umuvp;t0tltnmfctydlmDean ilt)setoxo3iu4lptnlivsl(fsDumxm no4olxniieiysfm uln ont)areoxf3todomteaivilt  2um(m3oo1amt mics s  rtr(  ot4oexniociydla2ra( s;u0aetnif3ta1lpDeaues (0 2xm(rpnu4lmtnmncsl( artrxr ;t0tlxomo3iltfa2ra(msnu) etnxrcio1fat anvi;t truo(m nodlm emfeilsf Drrx pnu1tlx mo3tlslmDel(ms;() ltnmrcoy1fmDe iei;s trxo(m iy4lmt mfetls a2rax onu1tee ifetadfm rmnvo;t) rermf iadoptrlnes;t  rtrxo3iu1ap n fesl()a2raur ;u1altniiciyd m2rmu sn(0 eenmr tytfa r uvil() eumiopoydaltnlnvtlsf rtmxr oo4opxomf3ildlaDeanms t4tleomf oydoa raieo;s) 2xr(o3iodolenlfcsls) 2rm(r nu4tpe mfciadfs2ea(mp t) etoxf3iodlp e u s;s0t2uoim oy4am e iesas) Dua(rpot4alt  oeiat a ranms (0aeenifctotlp raies t0 rxmir io4ll  lnes (fsDurur ;o4oeto i3tydls2rm( s u)tlxnio totlpt  ues;t0texr(m3ny1optnmivt (f rrm(mont4oltnii3tldla rl(mp t)tltoxociatfmD anvs t)srurirpiu1lmen ici t)sDta(  nt1olxo o3iadfa2ra(von(0 eenmfcoatfmte ieol() etmxmpio1alt mfci sfsruau ont0tpx ioctatfa ulums t0arenifcto1omte neol(  exoim3iu1lp nmnvtl(fartrxro;o4alt  f3ildls eau s u4aexrmociy1latr ieo;s)t2tmxm3oy4oleelfcsl(  Drmxm nu0aetoifetad a um(vs;u0arenmf3ta1fa  li o s)t2um(opnu1al  mics ()arrm(mo;o0tlx mfciadfmDrln snt)alenxf3tatlptrlneo;t)trtmxm io1llenlncs ( s2urxr ;o0open i3iad s2elump;u) rermr3iydfpte u o t tetrim3oodal  lneta(f Dur(r nu0alxn feildfsDua(mo (4alxomo3oadlp rauesls)srxo(o ny1openmfei tf 2tax pnu4oetn ieiydfa2raumpn(4altrxoctadoa ean ol(0 eurir3iodal nmiesa()arurur nu4opxn ieiltfaDuan onu) exrmfciadfp r ieolt0setmxrpnodamtn ivtlt  rra(mpnt0olt  o3tad a umumont0texnxfctydomDr nei s)s2uoio3nudaltnlfet s s2tm(r oo0alxnmoetyd sDeanvo;t)arerxfcoy1oaDelnvo;t) 2tmxm3iodap  lncsltf 2ur(monu1oeeomi3ild a2rln s u0aexnmo3oy1lp eanvsl()t2tmim oodlptnlnvs t sDtaumoou1tpx iiciaslm2rl(mp t0arxrmf3tytlmte u s;t s2tm(opoy1lm e ietas  rua( pou4apxnif3ildls rm(vs u)texrio oy1om r u sls)seum(r3io4om  mncil(f 2uax  oo4alx  f3iytlmDem(vont4 eerir3oodlptr ivsls) rxriopio4lmeelfvsa( sDrmxrpnu1aexoif3iadlmDua(monu) rtnxr3to1omt  ieols) 2xmxr nudlme mnet (f 2umx oou4aetomicias s rmn ont)arxnxrcia1om e uvo;( s2um(m3oy4omt mfvi t)sDra(rp;o1aexnmf3tyd a2eau o;u4arenxo iodlmtrauei ( srto(o3oodole mnvsas) Dua( o;o4apto ociltfs2umu ont0 rxomf oy1lat ai ilt0 eur(o oo1lmtnmneils s2tax pnu0apenmo3iad m2eln o t4 lenxr3tytfpDrln i t0 euriopou1lp nmfvt (  2rmx poo0tpt  icilsfs um(mp;(0altoio3oytfatelivo (0srxo(o3oo1llenmivt t  rrru p;o1oltnmfetatfsDeauvont0 reoxf oy1fptrlnvi;t  eumxm3oydlm   nciat aDrrum nt1tltomo3tytlmDemnvo t0tetrmrcio1fatrluvsls) 2uoxo oudam emnetlt) 2ur(moou4optn i3tld sDemn on(0 lenircto1fmDeaiesl(0t2toxmpou4amte nvta(f rraurp;o4aex ioetatfsDelumpn(4trxrxrcoatom r ivils)srur(m nydole lfvil()a2ur(  nu4oltomieiatfaDelnvp u4 eenxfcoy1fpD aneo;t  2xo(m3iudop e nvia(faDrmur ;u4tlt  ietlsfaDrmumpnu)alxrmociotopD lu s;t) exr(m ny1op emnetat) 2rrur no1altoioeild s2elu pn(0trerxrcoydlatraivo;t0 exrio3iydole lncs t srrmxmpnt0alx ifeiadls2rmumo u4aeerxrcoy1fm r nvslt) rxm(r3iodom e ncsatfa2rrumooo0aeto ictld m ul(mpnu)texoir iadfm rauvs;(  2toiopnu1am  lncils)s2umxrooo1oet ii3ildfaDuau s;u0alermo oy1lp rlnei;s truoxo3oy4lptemivils)srurumo;t0tltn f3iat mDrl(mo (0alermo oytlmDe ivo ( truo(r3ny1am elfet t) Dra( ont4ole  fciadla ean onu4 renmrcoo1faDe n ils) ruoxm3ou1al elncs ( a2ra(m ;u0opeoifetadfm rauvp t4tlxnxo tydfpDeanvo;(0 exrir3oo1lp  mnciat a2uaumo;o1aetoifeild aDea(mo u0 ltoxr3oy1oaD  neo;t setr(o iy1lmte fei ( aDumxm oo4teeomoetasls2elu snu)tlerxocootfmD aivsl( texoiopiu4ap emfetat arua( pno0alen feiat sDumnmon(4 rtnio3ty1laDeluvil(0srtmimpny1opeemncil(f 2trurp;u4oex  i3ilsla rm(vp t)treoifcoy1lp r uvs s0 2uoxrpoy1om elfesas)sDrmuroou0tetn oetyslm elnmo;u0arxomrciodlmt  u o s0s2xmirpno4am  miesat)srta(  ;t0ale  f3ilsfa umu s;t4 exnmfcoodoat aivsl() exrim ou1ale mfeias aruru  ;t1optoif3iys s um( p;t4trtnmocoatfm  aneslt  rto(o3oydomeelnvs (  2trxr ;u0aeeoifciys s2ul(von() reomr3tadfmtr nvolt texr(o oy1ol   neils  Dtrur ;t0ole if3ildla um(mp;t4 exnircoydfpDeanesl(0 exoirpoo4lpe  feiat aruaxmp;u4olxoiieils s2eau o (0texomr iadlatrai sl( sexmim ou4ll n fesl( srtm(m ot4apt ifeias mDemumsnu0aetomr3iy1lmteanei ()texoirpoy4olee nvtasf Dumurooo4apeomfeiyslm raumsn()tlxoiocoatlpDean ils  ruo(r ou4lp emicil(  Dtr( p;u4opxnifeiydlsDranvo;t0 eermfciytla eluvo ( srxm(r3iy4lme mies ()artrxrooo0altn ociytfa rmn snu0aetomo3io1omt lnei s t2tmio nudolt lnesl()aDua(rpoo4alx mieildlaDea(vsn()alxrio oa1opD ln s;t srxmio ou1lpenmivslsfsDraxrp;t1tlxoiiciytfa2rmuvs (0 rtoir3oodlmt ln s (0 eurir3ou1ll nlnes ( a2tmu pou4oeeo i3iys aDrlu pnt)tetnirciadfpDrluvo;s)srto(r oo1lm emncils sDrauro;t1tpx mo3iatfmDrmnvpnu0 eenxf3tytopDr n il(  ruriopoo4lpt lnvi ()sDrrxmooo1aptnmfcils s ean o;t4aeenif oa1lm ranvs s  exoir iu4lpe lnvi tfsruaumo;u4tpe  i3tys s rmn sn() rxomf3ty1op eaneo;s)trtmxm3nu1aptelnctltf 2rm(r oo4oltomo3ilslm rluvo;(0aetomo oadlmt lu olt0srxmxm3iu4lm nmneil(fs2tmump;o4alxn icildfs2rln sn(0tetnxrcta1opt luvi;()trxoio3iy4apeelneil()aDum(m oo1aet  o3ias aDemuvpn(4aeenmfctydopt lu o;( trto(m3ou1ll n fetas srraumpno4aee io3iasfsDrauvo u4texnir3iytopDeau i;s) 2trxmpiu4lltnlnesa(f rrax poo1olx mfciyd aDrl(vp;()aetrio iadlpDe ueo;t sexoim ny1alt mivi ( sDrrum ot0alxomiciyd m em(vonu0 rxoxf3ootlaDran o t)srtoxopno4alte feiat aDtmxmpou1tpx moctasls2uanvp;t)trenif iodop  livs;t s2xrio nu1al elfei (fartm( o;u0oex mfciytlaDeluvp;u0 rxoxr3iytfp e iesls  rxmxmpiu1lmee nvi ()s2uau  ot0ope moeiadls2ra(vpnu0 rxoif todfatrauvi (  2xm(m nudlme  icsa(faDuaxmooo0teen octadlm rmn s t)aexoir oadfmtrlies;s)trtr(mpio4lptn ncsat sDuau oou0oeeomf3iasla rl(ms;u4 rtnxo3oy1oaDrai s s teuoxo nu4llen nvi ()aDrrx pnt4tetnmo3tatfsDrlu o (4trtoio3ia1faD lnei (0 2xrim3ny4llte netasf ruau oot0aexnmi3ilt s2rmuvp u0alenifciodlm r neslt s2xoir3nudape lfvt s srra(mpnt0opx ifciytfs eanmo;t4arermr iytoaD  nvi s  rxoim3io4apee fvils)sDurum ;o0alt mictltfm2rl( s;u4teeoio3iytlaD  ieo;t  exmir oodap n nvt (faDtmx o;t1tpxo fcild aDranmsnt) ltomo iotomtelueo ( t2xmxo ny4ap   netl( aDtmxr ;o1tpxnio3tlsfa ua(mp u0tlxrmocty1lmtran il() rxmxopoy1lptelfct (f Dtrx ont4tleo oeiltfs rmnvo;(0artomr iy1omDe ivilt t2xmir3iudop   ietlt  rua(mooo4tpenii3ildfs elnmp;t4treoio3iotoptranvo ( teur(opou4ol e netatfartrxmpou1apxoiociytfm eau p;()tetnmfctodlp   nvs;( s2um(o3no1amt  fetls  Dur(mo;o4tptniociyslsDelu p;u0 etnxrciodfpte ies;() exo(o3iudaleelnesas) rtm( pno1opx  f3tyt m ua(von(0aetnmr oy1fmDrai s;( t2tmirpiydole  nes s)aDtaur nu0olx  iciydfm uau pnt4 rerio3iadomtelueo s0setmir3nu1ap   fvtasfarur(mp;t4aexniictyd m em(vs;t)aeenmf iodlaD luvols seuoiopiodoltemnesl(  rrr(  ;u1olen fciadfa2rmuvs t0altrxocty1fmtran i t0 exrxo3nodalee iei (  2tm(m no1oex  o3iysls umu o u0tlxnxo3oo1lptrlneols)t2xo(o3io4lpte ncsl(  2rmx ooo0tpxoii3tas mDuauvs u) exnir3oa1lmt luvi;s trum(m nodapenliviatfaDrrumo;u1tlxnif3tyd aDranvs;u)artomocty1oaD au ols)sruo(m no1ap  mfcsa()s2rm(monu0tlto i3tlsfa2rlumo ()arxnioctydfm  an il( srtrim3iy1lm   nvsat aDtrxmp;u0oetoif3tat sDrm( o;t)tleoircoydfpDrlnei t trxoio3nu4lltnmfvils)sDumxmo;t1oex mfeiytlaDraums;t4aeeoxr oy1fmD  iei;(0 rxr(m3nu1ap emfvt (  rrmum ;u4tlxnmfciyd s2umums;t)tlxoxr oa1la e uvol(0teumxr3iudlptemnvils) Dumum ot1tleo ieiadfm2ulnmpnt4trtoxocty1omDraueo;s0tetm(rpoodomte ivsls)arum( pnt4tleo f3iys s2elnvp;(0 etomr to1fa   u sls)srtm(r3nudaleelnetasf 2trxrpnu1optoio3ilsfm2rlnvp;t) etnio oytfmte uvs t  2xoiopnydom  mfctas) 2ururpoo0tpto octyt mDel(vs;t0arermo oodlmDrln i;s)texrim3oo4ale mfet (  Drmxmp;o1altnmfciytfa ra(ms;(0tetoxo3iy1latelnvilt0texmim oodamen nvslt)srtr(m oo4tee iieild sDrmuvo;u)altoxfciodfa   i s t)srtrio3oodalee fvs () 2uau pno0tle  ietas sDrmu ont)trerxo3oodopDr uvs s) 2xmxopoo1lm  lfct t  rua( o;u0tpenioctas a2rln s;u4teeomoctotlat aivs s)t2xmiopoudam emnei t)srra(monu0olxn fctydfa um(msnu4artrmocoadop ranvils0trtoirpoodlpt  nesl()a2ta(  no1opxniiciadlsDelnvo u0artrmfcoy1oa   ueils  etr(r no1alt lfciatf 2uaxmpnu0tpeoiieiatfm eaumpn()tlermr3ia1lateaneo;(0seuo(rpny1olt  nvsasfsDtaur nt1opeomoetyt a2rau s ()arxrio3oatfp eli o;s0s2xm(o ou4amtn fvtl(f 2urxm ;t1tlenmoeiydfa2umn p;u4trtnio3oodoaDr u i;(  rxrim nudlmt mfvi (f rrru  ;u4tpt io3ild s umnvpnu4aexrif iotfpDr uei t0t2urimpiu1ape livsat  Dtaurono0tpen f3ils a rmnvo;(4tltnio oytom eluvil( s2xoiopoo1lp nlnct sfarrmu  nu0aleoiieiysla2raumo t4 exrxf3io1faDrlu s;t t2um(m3nudap e iei (fsruaxr ot4aleoiieilsfsDumnvo u)arxnircoatlmDr i ilt0 rxrxm iy1ap n nci (farua(ro;u4ope ifetltfmDrl( o u) lermr ootfp   nesls) rum(mpoudome lneiltfsrrru pot0apeo oeiyt aDranvs u0 etomoctodfp   uesl() rurxm nu4ll  lfcilt)aDururoou0alxomictatfs emn s;u0texrirciatoaD  ies s) 2xr(m ou1am n fes t srrau oou0opxnioctldfa elu s;()trtoxf oadoa  auvi;(  etrimpoo4lpenmfctatfs2ra(m ;o0olt moetas sDuan o u)tetrifcta1fa  luei;s s2umirpiy1lpt lncslt) rurxmpno4olenif3tysfm2ea(mp;u0alenxf tytlaD lueolt0truoir ou4omeemfesls srtrumoou1olenif3iysla2umnvsnt0 lxrmr ia1oate ueslt)trum(r3no4ap e fvi tfartax  nu0tlt iiciadlm rl( s (4aetrir iadomtr ivo s  eurim3ny1lmte nvs s)a2tmx oou0alenmi3iaslm2em(vpnt)aeerxfcoodomtr i o;s0trurxr oydap nmncs ()s2trurpot1oexo o3tysfsDum(ms u0 exrmociadlat lnvsl(0sexr(o nu4amee nesa( srtru  ;u1aexomicilsfs2eanvp (0texomr3oo1om eau o;(0tetm(r3ny4ol n fvt (fsDumumonu0tlxn fctls sDul( snt)tetnmocootfp elnesls)sexoxmpny4aptelict s s2trxr no1aeenmoeiys mDrl(vs;(4 rtnxoctodlat li ilt0t2xm(opnydlpe micilsf Drrx  ;t1texoiietld m2eauvon()tetnir3tydfp e n s;() 2xo(opoo1lmtnlfcilsfa2uaxm ;t4aeeo o3ilsla rlu s (0trtoir3oa1lmteauvolt  eum(o3oudal emnet (fsDuaump;u0apen ieiltlm2rm(ms;(4 lermrciatla  au o t)texrirpoydapte nvtas)a2trum nu1oexn fciasls rmumo;u4tlermrctytom eaueo;t0srtoio ou4lm emnvtatfsDumum ;o4oexo i3iatfmDel(vp t4alerif3tatlmtr ueo;s)tetoxo3nu1lle lici ()srtrxmooo1tptnmictat m ul(vo;t4 rxrir tatlat anvs;s) 2xmxm iodame  fet () rrmxmpot0opx  oeildlm eluvo (4 lermr iytoa elieo;t)srtoxm nydll  mfeil(faDra(rp;u1apxoiiciydfm eauvp u4alxnifciotfp eln o t0srtmirpiu1ol nlfcsas  Duau  no4ape  f3tls aDulumo;u4alenmf oytlpt anvi;(0s2umxopny1aptnlictat aDrmxrooo4teeoifetlslm elu p u4treoxocoa1faDeluvilt t2trxopou4lp nmivsat) Dtaurpnt1tpe  oetadlmDemums t4aleoxfctodfa raueo t0trxmimpnu4aptemivt s) 2tau o;u1alxoifetld aDua(vpnt4tlxrxfciy1oaDrlu i;s)t2trirpiu1aptn ivt (fsDuru pno4tlxnmociat sDul(vp (4 rtoxf oytlpDeanvi;s  rxoir io1ope  fvs t srum(ronu4tlenmi3iltls2eanmsn()treoiocta1latr i i t srtmimpoudlpe  ncslsf rrr( o;u4aeeomoeiltlm2raums;u4trtoxr3tatfmDe nei;s) 2ur(r ny1omenmies tfsrrauronu0aleo f3tyd a2ua(mp;t4 renio3ootfptrlnesl()sexmxm nodlmenmfet tf rra(mpno0tlenif3ildlm2rmnms (4 eerircootopDeln i;()s2xoio nu4lmtnmnvi tfs2ra(mo;u4aptnifetadfa ra( p (4alxrmfctytop elnes t  2xmxopoudll e ieiltfs2ra(moot0tlt  i3ildfm2ran pn()alenxo iotlm e nvo t0srtmxm no1ap  lnct (f rta( oou4tpeoifetydla2ranmsnt0teenxoctydoptrlneil()trumxm3io4op elncils) rrmumo;u1oleomiciysfsDumuvp;u0tlxomr3tytfpDe ivilt0sruo(o3oudlpenlivtls)artaxmonu4aeen fetad mDrl(vpn(0 rerxocoodopD aieo (0 eum(rpio4am e ncta()a2trur ;u4tex  i3iaslsDrm(mp;() reriocoatfp ran ilt srxm(o3oo4lptn ncs (  2rau  ;t0oet mieias mDrmuvs t)tetoirciadla eai ils)t2to(o ny4op  lfvtl(fs2uaxrp;u4oeenioctldlm2eaums;(4arxnir3oy1faDr i o t0tetr(rpny4op nliesat)srrmx  nu4opxnifeiys m2elnvpn(0tetrmfcia1fa r i o;s0 rxm(mpnu1lpeemiet (fsrumxmpno1tlxomiciytfa2uanmonu0 rtnxr oytfateauvi;t trxmir nydap elfci tfa2urxmo;o1aeto oetlsls ul(vs;t0 exomo ty1laDe n o ()s2xmim oo4ole mfvia(  2raur ;u4aetn oeilslm rlnmsnt)aetrmr iodlptelu ils0trxmim3oy1lm nmicslt) 2ra(rooo4ole  i3iat s ean onu4 ltomfcto1fpt lnvs s t2uoiopou4lpte ivi s)sDtr(moot1oeen icilslmDrmuvpn(4 rtomociy1lmD luvsl( s2urxo nodlme mivias s2uau  no1oetoiociat a2em( pnu0tltoio tadomDe u o;t0s2xoimpoo1apte ietl(fartrxr no4oetnmi3iadla rm(vp;(0areomrcta1oaD lneo;t  eurxo3oy4ale lfcta()aruax  ;o4oee moctys a eanmp () lenmfcta1fmD  uvil( t2trir3nu1lme  nctas)s2tm(  ot0oeeoiociad a rl( pn(4 eeoxf3iydlptr ues s)texo(mpnu1olenmnvsas aDtmxmpoo1opxomf3ils aDuau o t0tlerio3oy1om rliei;s)trxoir iudamtnmnvt ( s2ra(rono4openifciasfm2em( p (4tlenmr iadopD ln sls0t2tm(r iodlm nlnciat)aDumum no4olxniiciaslm2rauvpn(4trxnifcoatfaDelivi (  exo(m oydll emnvsas  Drm(rp;o1ope iieias sDelnms;u) exomo oodfm   ivs ( t2xoxo io4lpt lieiat srtaxr ou4tlenmiciatfmDrmumo (0tlxrifciodoa rluvs (0t2xrim oydap n fci s) rumurpoo0texomfctasfm2rmn p;t)artoxo oodoa   n o;( sexr(o3ou1lpeemnvt s sDurx pot1alx  ociydlm em(vp t0tlxoio ta1oatr ivsls0trxmio nudllt  icsls) 2rmxm nu4ale  ocildfm rmumo;(0alxoxf tydoa   nei;t0 2tm(o3nudop elivsatfsDur(r oo0apen i3iyt s ean snt) exnxr iytlptrai s s)s2umimpiodlpee nvia(fa2trxrpno1tee mi3iltfaDumn o t4trxnxr tatfm  aies t0 eumxr nu1lmt  ivsl(f Dumur ot4opt iiciasfs2uanmp;t4treoxf3iatlmt auvo s)teur(o oudlltemnci s)arra(roou1apenmfetadls ul( pnu4trxrir3oytop eli i;s0 2um(m iy4lp  liet t a2taxmpot4aexnifeilsla ra(msnt) etnio oatoaDraieo;s) 2xo(o oydlm elnvtl(faDtmuro;u1apx iieiatfsDuaums;(0teeniocty1faDean i (0 eur(mpnodomeemncs ( sDrmx  nt1tetoifcils mDul( o;t4texnmrcta1omtelneslt  rur(opoodam e fvia( sDua(  no4alxnmicias mDelnvo u4 eeoxf3ia1oateln o;t) rxrir nu4aleeliesls aDuau  nt0apt  fctaslaDuanvo u4trxnxf iodla  aieo s trxm(mpou1lp e nvia()artmu oot0teeomictls aDel( s;u)tlermo3iotfaD aueols)trum(o3iodalt mfcsa(f rtaxr ;o0olxo ictldlaDem( pnt4aexrmo3io1om e ues;t)s2xo(opiy1apt  nvsas)aDurx pno4oeenmi3iyt s2elu pn()aeerir iatlate ivs;(0trurim3iydop  mfvt ()sDta( o;t0opt  octlt a2ulu on(0 leoiocoa1laDrlues;s)trurxm3iy4op e fctls)srtrxm ot0alx mi3iaslm um( o;(0tltrifciotoa r u i;(0srtoxo3no4alt mivs tfartm( ont4aeenifctasfaDua(vo t0trtrxr iotomD anvslt0s2urir3oy4op nmies s)aDrmurp;u4opxomo3iatfs rm(vo u0 exoxfcty1fpD  ues s s2toxr iy1ole  ivt t a2tax  ;o1opx  ietlt mDea( snu) lenmf3tadfpt  neo t0srtoxo iy4lp  mnvta(fsDtau  ot0tlxnmi3ils a ua(mon(4tlxoir iydlp raiei;t  euoio iydolt lfes s) 2tmxront4apt mi3tytlsDemnvp;(0altrxr3tadlpD  ivilt) rumio oodapte fvsl( a2ta( o;o4oeenif3iadlaDra(vp t)arxnmrctatomDelu i s)s2urio nu1alt mivta(f 2um(ro;t0alxo feiatfs ean p u0 reoiociydlm  anei;() 2xmir iodlm emies s  rtmur ;t0tpeoio3tadfm ul(monu)tlenif iodoaDeauei;t  2xrxo3iodlm e icilt)arua( p;t4oex micildfa2ranms;()tetrxf3ia1fa eaueil(0 2xm(m oy1lm n iciat  Duaumpnu1oexnioetat s elump;()trtrxf iatfp rlu sl( s2xm(o3oo4al n ivta(f 2raxr oo0aeeoii3iat m ea( o;t)aeermo3iytfaDe ivolt)t2xr(o io1optnmfeilsf Drmx  no0oeeoifciad s2eln s (0arxoxrcoy1op eai s s)teurxr io1lptn fcilsfsDraxmooo4opxomo3tls a2ul( s (4 ltoircootfa eln i ()srxr(mpio1om  mfctl() 2rmumo;u1tlt mi3iltfm2emumo t)tetnirciytomteauei;()tetm(r nudom emieil() 2rmxmo;t0tpxomoeiydls ua(vp u) rtrir iadfa e ivi s  rxoxo nodam n ies s)s2rm( ont1texoioctys mDuauvs t0 rerir3to1omtrluvol()trumxmpou1alee fci ( arra(mpoo0tle if3tytfmDemu snu4 rxrxocoodlaD lnvi;t0tetrim oodlltnmncsl(f Dra(mo;u1tex moctlt m2ranms () ltnxr ty1laD lnvi;() exo(rpio1lpte netas) 2rmxrp;t1aptnmoeiyd a el( s;u) rxnmfcta1laDrlivs;t trto(r ou1ll  lnet s) ruaxm nu4aetniietlsfm ean s t4trtrxr ty1opDraies (0setrxo no4llt mfctlt) 2uaxrono0olenmocilslaDeau pnu0tetnioctatlp  aivo t0teumxm3iy1op elnvi (faDumum nt0teto feiaslaDeaums;t0aetnir iatfateauesls)t2tmxr iu1lmte iesatf rta(rpoo1tet iieiyt m2uln snu) lerxr3totlaDe uvols) rurxr iudam elfesa(  rraxmooo1tleomociaslm em( p t) rerio3iytfa r uvol( s2um(rpoydomte ies ()sDurxmo;o1oeeniociaslaDulnmp (4texnmr tydfm  auvs;(0s2xmxo3iudomt mfeiat  rum(m ;u4alen iciysfa2umnvp;t0 rxoxf oadfaD  uvi;(0s2xmimpio4ll nmici ( a2uaxr no1oeenifeiadlmDrlnms;u4 rxoxo3to1fp eanes;s0s2umirpiu1ll nlfesl(fs2raurono4oee  ictyd a2ulu pn() eermo to1fm r uvs;t  2trio iy4ameelfetls srumx  ;u0oee mfeias mDra( p;t) renxo todoa rln ol(0setrxm ny1lm emfvi s) rtm(  nu4oex mfcilsfa rm( onu)teeomr3tydopt auvo;(0teuoxm3iudll n fvtas s2rmumonu0aex mo3tytls2el(vo t0 etoif3tytlmDeanvi;(0 euo(mpnodlle mnvtas)a2rmxrono1tetnmociyt aDel(vpn(0trerif ta1la raivi;s)t2tmiopou1am e fctlt)arrmu o;t1oeenmfeilslm2elnvp t4 rtnmo3oatfmDr ies;( tetriopiydomtemicsa( arur(mo;t0apeo ictydlmDeauvs;u4areoircoo1lm elu ils)t2uoxr oydomtnliciat)sDtaur ou0opx  i3ilsfm2rm( s;(4aeerxr iotlpDr ues;( srtm(o iudoptnmivsl(f 2taxm oo4oexomociadlmDum(mp;()alxrif3oatlpD anvo;s  euoxm nu4ome mfesa(  rumxroot1teto o3ilsfmDuluvont0arxnio iytoa r uvi s trtrir nu4ale lfvtlt)sDrax  no1tlt mfciyslsDra(monu4tlerir3ia1oat an o t0setrirpnydlm  micilt)a2uaxmpot0oet ifctlsfs em( on(0 rtnirciytlp rlivi t)s2xrim3nodlm emicsas aDrrx o;o4opxnmi3tlsls2ua(mont4arxrifciytfpteauvi (0s2uoio3iydlp  mies tfarumurpoo0openmietasls rmuvon()tltoxociydoptr n ols)s2tmim3iu4al e icsas)sDrr(r ot4alenioeilsfm el(von()trxnio3oadfpD lnei t)s2xoxr3io1lp  mfcsat) Drrx  ot1tlxn ictyd s rlu pn(4trtnxfctotlp   n s;s  2trio iodlmtn fvsasfs2ta(r ;u4texo i3iasfs um(vs (4arxrir3ta1opte uvols)t2um(opoy1amtnlicil(f 2rmx ont1aexn fetld s rlumo u0 eeoio tatfp e uvols) 2ur(m3io4om   nci sf 2rmu oot4apeoii3iyslmDul( s;u4 rtnxf oo1opD liei t0srxrxrpio1omtn icilsfsrtrx pnu0aee mieiydfsDuln p;t4tlenmociodlaDe ivo;(  rxr(m io4alte nes sfa2um(roou1oex iieiasfsDumn o (4teenmf oo1oa eaivo (  2urxr3iu1opt mivs ( s2rrumpnt1tle iictld a2umn pnu4 eerif tytlaD  u ol(0 2ur(m3oo4om n fviat)s2rmxm ou0optnmiciltlm2rlumo u0aexnxo totlat anvolt)sexm(m oydllt lictl( s2raxmo;o1oeenmi3tadla2rmumo;t4artrifcto1opteauvo;s  etoxo iu4omtelieia() Dtr(ro;u1olt  ictldfsDuanmo u)arerio iatopD  u i ( trtmxr3iy1omtemnvtas s2ta(r no4alx mo3iysfm2em( s;u)areomo iotfm elneol( s2xm(o iu4ope mnvtl( srtmuroou0opt  f3ils mDuauvs;t)tleoxf3oadomtean s t0srxr(opoydalte fvilt)sruaur oo1ope io3taslsDrln o;t4 lerxocta1op   ies;s  etoxr ny1ome mfvt s)srrruro;o0texniieils aDemnmpnu0arxoio3ia1fpDr ieilt)s2tr(r3nudap emfes s)sDum(m ;o4tptomoeiyd sDrlnmo;(4artnmo3iytla eln ol()s2xo(mpoo1lpenmnvtlsf Dur(root4tlen oetyt s2ran onu) lerircta1lmt luvo s) rxrxopoydam nmfeias srrr(m no0ole  oeilsfa rm(mp;()artnxo iy1fmDr n s s  rxmxm no4lp  licias s2ua(mo;u4opt if3iydla rl(vs;(0artrxf oa1optr n i ()s2toimpoy4op   fcs () 2rrur ou1oltoiieiatls2eauvonu0tlxoio ootop   nvo;( t2tmxmpnudlp nlnvt t) Draxm no4opeomfeiadfm2eluvsnt0 ltniocty1fate nes;(0sexmirpiu4ll   iciltf Dumu p;o4alen o3tld a2eln o () rerir3oodlmteaneils0 2umxopno1lme  fvi tfsDrau  ;t1tlt iietltlm2elu on(4trtnif3tydfa rlueo t0t2urxrpiu1apt  ictas)aDrau o;u4tee ifeias aDranms;(4 rtrmociydfm  auesls)teuoimpnu4lm n nei ( a2trx oot4tex  f3ils mDra( p t0texnir3oadla eluvsl(  exmim ou4op  liciasfa2rrumo;t4opxoio3iydlm2rlump;u)texnmf3oy1opDe neslt0 eumim3io4lm  mfvsas  ruax ooo1tltnii3iytlm umnvo () lxrmfcoo1op elnes s)setoxm3iy1apt  ivias) Drruronu4altn fciatfsDuanvon(0 rerxf iydoa e uesl(0teur(rpoudlmeemfvtas sDurxront4tlxoif3tlslaDrl( pnu0 reomf iytfp rau i s truoxo3oo4apeemici (f Dtr(mo;u1tleniiciatls2rl(mo t4 leomocoydlpt  u i;t0 2xr(o3iu1lpt mieias srta(ro;o0opx ii3iltls2uanvs t0tetnifciatoatrai o;()trum(r3io1lle  feil(  ruaxm nu1tpenioetad a2elnms t) reoxr3oatom  aies;s)setrim oo4ol  lnvi ( srrmxmo;t1tpxo ociatlm2rlu on(4aexnmo iodoaDe uvo ( trtoxm iy1ope  fetltf ruaxmoot0tlt  o3ilt a uanvs;t)aetrxfciydom  aivo;() rxo(r3io4amt mfvtl(f 2rm(rp;o0olenmf3iat m2el(vp u4treoxf3tadfat au i s  2xoio oo1am  mfci sfarum(mpnt0oee  feiasfm uluvp u4aeenmo iodoaDeanesls)sruoim iodlpe livtasf 2tr(  oo4ale mfeilsfa em( pnt0tlxomocoy1lpDr ieo;t)teuoxr3iudopeelieiltfa2trxrpoo4alxniietls m emnvp;()alxnxf iadlmt luvsls  eur(m3ou1lp nmfcs sfaDuaxrpot0oexomfetad s2um(mpnt0arermfctatlpDrauvsls  etmxrpoodaltn fcs s  2umur nu0opt  f3tls sDuluvs;u)aexoxrciotlm eau ol( sexoxopno4ap   ncsltf rtr(rpoo4tetoio3iasfaDulnms;t4tleoif3iydoaDr ivsls) 2umxr oydom nmnet (f 2trum nu1tpenmieiyd m rl(vs t4arxoxr3oydomt  uvo (0texrxmpoudoltemiesl( artmu  ot1aptnmi3iysfsDem(msnt4teerxfciydlm  an o;s)t2uoxm3nydllt  iet t aDuaxrono4olt ifeils mDrlnvon(4treoxfciotlpt lueo t) eumxo io4ope lfeta(f rtm( pot0tetn ieils mDrl(vp;t)aeeoif iotlmtelu s s)seurxm oy1op emfvta( sDrrx o;o4tpxn f3tlt aDuauvp;u4 rtomf3ta1omtraivi;t0 2urio nu1opeemnvtltfsrtmx p;t1ope iieildfa2rmnvp;u0aeerxocootfptr u ol(  2um(o ou4llen fcsas)s2ra( o;t0tpx ii3iyd mDem( o t4trenxo oa1oateluesl( srxm(o3oudomenlnvtls)sDtrxm no1ole  ieilsla rln o;u)texoir tatlatraivs s)t2uoxo3iydolenmnet () 2rr(mp;o1oeenioeiydla eanvsnu)altnir todlpD  i i;(  2uoim3oo1ll  mnei s)srrrx ono0tlx  i3iasfs ra(msnu4 exoir3ia1oaDeli sl( truoir ou4olt mfvsa(fsrtax  ou0alx ifeiasla2umuvo;t0trxomo tytopDr i i;(  2tmxopnodoltnmietat  Drrxrp;u4ape mo3ild a2ea(mont4tlxnmrcoa1op  au sls)trtmxopiu1op n nei ()arrru ooo1alt  i3iadfm eln pn(4 ltrxo3oadlp  lnes (0s2uo(m ny4ll nmfeilsf rtmur ;t4tet  i3ilt m2umums (4tetnmrcoodfmteln s;(0sexoxopiy1omee fcsasfsrtm(mono1tpeomfetadlmDum( s u0tltrxf3iadfaD luei t srxrxo no4am  mnvtlsfsrra(rp;u4alxn ietydfm uln snt4aetrxf tydopDeln sl(0 2trxm3iy1ole mnvt t  2trxrpno4aptomoeildlm2emnvo;u)trtrif oatoat  ieols0 etr(r3ny4ll elfvilsfs2rax oot1apxniietasfs emuvonu) rxomrctadoa elivsls)sexmiopiy1lpt lieilt  2uaumoou0alxoifciadfmDua( p;t4aeeoxrctytfat aivils0s2urxmpou1amtn fvsltf Dumx p;u1aetn ieiytlsDuaumo u4trenifcoadlm rlnvi () rum(o3io1lpe lieil(faDuaumono0olxnmicilt m2uluvonu)aexomr3oytlmtrlieo t0seuo(mpiodom  lnvi sfsDrmumpou0oex  ocildlaDrmuvs;() lenio3oodfmDe ueolt sexmxr no1am nmfet ( s2rmxm no1aex iiciydla eanvo u) rxrif3oy1fa r i o s0srtm(r oo4am emici tf 2rr(mpnt0tpx ifciydfaDeanms t0tetnxociydoa eau slt sruoio3oo4ale lnvt s a2um(r no0alt iieiatfa2elu o;() ltomo iadoa elu sl( sruoirpiu4lp   fet sf 2raxr nu1tleo ictytfsDeaump t)aeenifcootlatean o;t0srtr(m3oydolt lfcil(f 2tm(ro;o0apxnmieild sDemu p () ltomocoa1oa   uei s0t2xr(rpnydlle lict s)sDtrum no0aexo feilsfs2ean o;t0aexomr iydfmtr u i s)srto(r nodlme  fvslt)aDuru  ;u0apenmocilslmDra(mpnu4alxoio io1lptr i o;s0tetmxm3oy1llenmfcsa( aDur( ooo4tpx  ictytlm2raums u) lxrxr iydom elueo;(0 2um(r3oy1lme lfeia(  Drrxmo;o0aetnmi3iys m ua( s (0 renmo3oa1fa eau i t srxmim3no1ameemfeslt) 2rmumpoo4tpxo oeiydla ra(msnt) etoxfcoadom r nvols trxo(opoudap  lfei (fsDumump;o0olt ifctytfm2ean pnt)trxrmoctytlmtrlivols  exo(m oo1ale livi ()a2uru  nu1opx  o3iad a2rl(vpnt)aeerxr3oo1fmt  uvo;t)s2xmxo iydlle  ict sfaruax ont4tptn fciatfmDumuvs t0texrmo oy1fp   n slt0tetmiopiy4ale  ies ( sDurxro;o0tpeo fciltfmDumu s;(4trtnif ia1oate i o t) eto(mpnydlltnlnvi s)aDtmumpno0teeomf3ilsfm2ra( snt4 exrmr3iotfaDraiesls)seuoirpoo1am elncias sDtax  no1tlt  f3iasfs2um( o t0tetomo tydla  au o ()t2uo(m3no1omtnmfeilt sDraxm ;o4ape mi3iydfs rl( p;t0tlerif ootfpD  nei;s0 2uoio ou4ll e ici t  Durum no1teto fcilsls2rmuvp;u4areomf iotfmDelnvol(0 etmio oy4aptemfcias a2raumoou1aeeo icilt s ean p;(4tlerxfctotfaDe nvi (0trtriopnydapte ict t)sDum(rpnt1tex  feilt a umu p (4 rxoiocio1om  luvil(0trtrxr3ou1llen fctl(faDtrum ;t0aex io3taslm2em( snt0aeenmfciytlaDeli ols teur(o3nu4oleelietl(  2tr( p;o4oeenmoetysfmDelump u)aexnirciotopteau i;t0texm(r oy1ome mneiltfsDtaxm nu0tpen fciyt a2rm(mon()teenif3iadfpDeluesls0t2uoxopoydoptn nei s aDumx p;u4tltomf3tld aDulnmp u)aetomf3iytlmDeau s;t trxmxo oo4al elivtlt)s2trxm ;o4tlxnmfctytlaDrm(vsnt)altrxf3oydla rai s;s  2xrir iodam  lfctat s2tmurpnu0aet  oeiatfm2em(vo (0texomr tytlpD  neo t0sexoxr3iy4lptemnctas) Drr(m nt4tlx ifeiat a rluvs u) rtrir tydfaD  i i t  rur(o3nu1ome  nvi t)a2rax onu4aex mfeiydfaDulu p;(0 etomocoytlatean s;s sexmxr oo1optemfcia(f rumxm ;t1ape  o3iysfmDel( s;t0 rxrifctadomtrau il()s2urxopiu4lmtemnct t  2umu  no1tlen oeias mDeluvo (0 rxomo iy1oate ieo;()s2toim oo4llenlnetlt srumx pnt1oleomoctadlm2uluvsnt4aleomocoa1fatrli ils)teurir oo4lpe mncil()sDrmxmooo1tee  i3ild m2rmu pnu4arxnir3tadfpD lnvi s t2tm(o3iudom   fvia(fs2raump;o1tet mociys aDumu onu0texrif3ootoptelneil( t2umim3nu4om  lici (fsrta(mp;o4olx mf3ildlm2ul(mpnt4arerif iytlpt lieo;t t2urxm oo4am n ivt t)srtrxroou0oexomi3iysfa2umums;u4arxrio tatoate ueo;s0s2tr(m iodapenmics s  rua( o;t0oleo iciasla2emn o t) rtnmrcoadlptean s ( seum(o3iudlltelietas  rumxrpnt4apt io3iytlaDul( s (4 lxnircta1la   nvo;s0 etoimpiy4al nmnvils) rurur oo4oeto f3iyd a elumo;u)aexrmo3todlpDeauvil(0 2xrxo iu4lltnmieslsfa2ur( ooo1teenifciadlm2eanvs ()trtrir iydop   ivi (0s2urxr3iy1ope  nci (fartm(ro;t1aptnmi3tltfa emuvo;t0arerir3tydfp   n slt0srto(rpoo4am elivi sf Dtmxmpno0aptoif3tls mDulnvo t) reomo3iodlp raneo () 2tmxm oo4ape  ici tfs2ua( o;t4oet mi3tadfs2ea(vo () rtrif3ty1oaDr u sls trto(m oy1aptnlncils)srrmx ooo1altoiietatfs2eanvon(0 etoif ta1op eanvs ( srxoxmpiy1op nmneta( arrrxrooo4olxnmieiydla2uan ont0arxomf oa1fmtrauei t)teuo(opio4optelicias)sDra(mp;t4aeeo i3iytfsDrau pn(4tltnio ia1lmt lnesls) 2uoxmpnu1lmtnmfcs sfsrtmx  ou0alx iieiytlaDrlnvp u)aexnio ia1lm r i o s setmxo3no1ap e ieiatf 2rmxmooo4aexn ietyd mDraums (4 etrio ia1opteluei;t)t2tmio iudaltnlfvsas)sDuau  ;t4ape mf3iasfsDrm(vp;u4trtnioctodfpD an ils)s2urio iu1ape mnviatf rtrumpnu1ope io3iyslaDea(vs t0tleoxf iotomtr nes;s s2tm(rpio1lm  lies s)artr(rpot4tpt iiciytla2uanvsnt0aexoif ta1omtelnvi;( s2xoirpiodoltnmictlsf Drru  nt4tlxnifcilt a2rau p () etomo ootfate ivs;s texr(rpiy4alen netas) 2ra(mpnu1tpxomfetys mDel( p (0aexnxo3oy1fa   i s () rxo(o3nu4omenlnetl(  Draumont0alx moeils m2umn s;() eenmoctatopDe i ol( truoiopnu4openmfci (fsrtrxro;o1oexo feias a um(vo t4alenxo3oodlm rln ilt) 2tr(mpnu1lpenmfvi t aDtmx onu1ale mfeiysls2rl( pnt0texoxo tydlmt luei;( s2urio3oudam  lfvt t) rurx onu0tlenif3iydlm2rlu s u4 rxrxfciodoa   ivi t0texmio3oydllenmfvtl() Dra(ro;t0aet  f3ildlm em(vp;u0 rtoiocoodlaDr ies;s  rtoimpiy4amtnmnctl(farua(ro;t1tleomieiat a2eluvp;u) ltnif oydlaDrlu i t) 2xmim iy4lpenmnvs s a2uaxrpot1opxomiciydfa2ulnvs t4aeeoxf3to1om ran ols trtr(o oudll e ictat a2rm(  oo1aeen fetatfs rlumonu)tlerir oadfptr u s s)texrxo iy1lmenlnvtas srtm( oou1oleo fetaslm2rmums;t) lxrxfciytopt aneol(0sexo(rpio1omtn nes ()a2raumpot4open octlt aDum(vo;t0 lenxr3oy1fmtr ieo;t srtrir3iu1lme mieslsfs2ra(mpoo4tpenmiciaslmDumnmo;()areomfctytfmDr neols)srxmir oodaptemnesas s2taumpnt4oetomoeiydlm rmnvo;(0 lxnxo tytfmD an s t  2trxr ou4olen ivi ()s2rrxr ot1tle  fctltlsDemnms;u4 exoir iydfmDeaueils  rtrxo io1oltn fvsl( artmu pno4oexnioctlt s2emn snt) etnxf ia1fpD ln o s)s2trir3iodopt lnei t) Dra(r ;t1aeenmicildfs um( pn()trtoio3totfa  au sls)trxmxm oydlp n fei ()srrmu  ;t4tpx moeiltfs elnmonu0tlxrmf ta1fpt luvo t) rum(r ou4llt lict (  Duru pnu0tle  fetatfa2rmu snt4aleomr3oodlmteanvol() rur(o3iudapt  fesl(  2taxroot1aee ii3ias a2rmn s u4trtoifcoytopt liesls) 2tm(r iy1lleelicsa( arrm(mpou1tleoiiciaslm2rlnvp u4aeenmo3iytfa  li ilt  exoxr iy1amtemivtltf 2um(  ot1tlt mf3iydla eau p;t4 etrxo3io1opt au i;t  exoxo3iu1omt  fes s)s2tau  ;u0apeo i3iyt mDrlnvo (4 rtomf iatopt  nvs (  etoxo oodom n nvt s)artaxmono1aex  f3ildfs el(vp;(4texnxo3ty1omt luei s s2tmxr3oydalen ivtat)a2raxmonu0ape  ociasls rl(vs;(4 rxnxr3oy1lmtr uei;s s2urir3nu4llenmnetas)aDurxmp;t1optomfciadlmDrmn s t) rtoxfcoa1op elueol(  2urxr3iy4lpt  iviatfarraur oo0tee ii3tadlm2um(mo;()tetnir3ty1lp r nvo;s  2tmiopiu1ll n ivils)s2tmxr nt4tpxo fctatfs raump t4tlerio oadomtraivi s0 rxrirpou1om nmivi ( a2ururono4tpe  octadfa ulu o (0altnircoydfm   u sls  2trir3iodalt mneias sDtm( p;o4opx ifcils m em(von(4tlxrxrcoadlptraueils0truo(r3oodomenlfet tfa2tax pnu4oeen oetldfa rm(vpnu) eerifctotla rauvo t)trxm(r3oy4lmee nvs ()sDurum oo0optomietasla ulnvp;()aexoxf oydlat anvo s0 rumxmpou4amtemfctas aDua(rooo4tpxomociys sDrluvsnu)tltnxfciytopDeaueo s0s2to(opiydaltemivs t) 2raump;u4tpe  i3tlsfs eaumo;u)treoirciadomtrlu i;t)srxrir3iy4op n nvtls s2tmxrooo0aetn feiys aDuau on()artnir3iodlmtraueol(0sruoim3iydaptnlfvs s  Dur(rono0altnmi3tas m emn s;t4arenxf3oydlpDe neo;s)seto(rpny4apee ies s)sDrmxrpou1texnmf3tltfaDua(mon(0teeriocoo1fmtrlivsl()t2xmxr ny1lpee fvi tf 2rr(rono4apeo feiad sDum(vo u4 rerxf3totopt auesls0sexmirpiudomeeliei sfartr(  nt0aptoio3ils sDrm(vpnu4 rxnmocoydlpDraiei () exmxm oy1al n ncsls) ruaurp;o4aee ifeiad aDuanvpnu0arenxrctydfat  nvols0trtrir nodlle lnvsa(  2urxrp;t0tpt  ociatlm2ea(msnu)teerxf tydfpte nvo (0texoio nydame  fvi tfsDrrxm ;u4aleo fetatla rmums;t0 rxrxf3oy1la rau o;t0s2umxo3oo1lpenmicsat)aDum( poo0aexoifetys s2umu s;t4 exoxf3iy1omt lu s (0t2urxrpnu1aptelivtl()s2ur(  nt0oex mfctat sDemu o u) ltnir oy1lmt lnvslt  rxrir nydlpt lnctasfsDta( pno4oetn ieiysfm2ua(vp;(4 exnio3iydfmteai s t)srxo(r ou4opee fvt s)srtaumo;o4opxnio3ild a ranmpn()altoio tatoat lu o ()s2xr(m3oydlpt  nvta()srtax pou0opxnif3iys aDrm( p t4 renir3ia1fptelneo;s  rxmxm3oy4omt mnvt t  2rmur nu4openmicilsfa2emu s;u) reoiocta1oaDr ieslt0s2xrir3ny4lp  mictlsf Duaxm ou1tlxomictlsfaDeluvs;u0tltnxr3iadop elneilt0trurxr nydllenmfesa(f rra(mpno0olxoifeilsla2el(vs t) etoif oatop  aueilt  exmxrpnydap n icsl( s2ururooo0oex ii3ild mDumnvsnt4 ltomociy1fmDelu i
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;t0s2ur(o oy1lpt mfeilsfsrrru  nu1aeeo f3tasfa2rm( p ()tlxoir oa1oaDean il()s2trxrpoy4lmt  feia( artrxr nu4apxnmoetatfa elnvsnu) etrmr iatfatraiei;t  rxr(mpoo1llteliviat) rtm(ro;o4apeoiietys s2ra(vpn() exrio3iodfpDr uvo t0trxmxmpno1ale  ivilt  ruaum ;o4oet if3iad sDran pn()tltnxf iodlm eanvsls)s2xrxrpoudole  ici t arra(ront4aee  ociatlm rm(msnt0arxoxoctodopt  nvo t) 2xrim3no4ap emfvs t  Dum(mono4texnifeiat aDul( o u0 ltnio3iodoa elivo;t s2toxo3iudlmte ici (f Dua(root0tetnmoeiydfmDeauvo;t0aeerxoctatlaDr uvs s) rtmxmpio1llte fctatf Dtr( ooo0apxnmietysfs emu pnu)trxrxo3tadfm  lnvs;s texoxr iu1ale mnctatfsDuaur ;o1tlt mocilsfmDemuvpnu4artnif3oy1faD livi;s) 2tmir ny4olenlfet tf 2urxrooo1alt  ieils a emnvs t4trtrio to1fmD  ieols) 2xmir3oydlmeemiciatfaDumum ;t1oltoif3tls s2eau o u) exoxr tadfptr u s t0setmxr ny4am  mict t sDtrumpno1alt mi3tyt sDrlums;(0artoxfcoytopD lies s setrxm3iudape lnesltfsrrru ont4aexo fetad mDemu o;(4 exrifctydlpD lnvo;(0 2tr(mpnydamt  iesl(  Dta(m nu1alt iociysfsDea( pnu)trxrir3todomDelueolt s2urirpnu1lmeemnvtlt) Draxmooo1aet  fciysla uauvp (4alermfcoatla e n o (0srxoxm oodoltn iesa(f Draxm ;u4oetoifciydfm2elnvo t)arenxr ty1lm eanvs s0 etmiopnydam  lfetls sDrr(m ;u0aexnifeiyt s2ra(vpn(4texnmo tatfm rlies;s  2trirpoo4om  mietas  Dtr( p;t1tlen ieild a2rmu p u4arerxr3oodlp eauvol( teuoir3iu1ll elnvtat)a2urxro;o0alenmfeiyt a2ra( p;t0teeomo3tadop  aivo ()truoirpoo4amt mfetasfarrrx p;u4tle if3iydls rm(vo;(4 rerxr iotfmDrlu i () ruoir3io4apt  ict t sDraurooo0alen feildfs2eanvsn(4trxoir to1lmDeauvs t0t2tmxo iudll e fct (fsrtm(mpou4apenif3ild sDum(monu0texoxr3ia1laDe u ols truoir oodolte netltfa2umurpnu1ole iietldfsDua(vp;t4tetoio io1fp e uei t0trtoxopiy1openlnesa(f ruau pnu4aeeniociyd s rlu p (0trxnmr to1lpteaues;(0 2xoio3iy1ameemfcta(fs2rmuront4tpt  ociatfa2uauvo t) ltnmo3iytoaDe n s;s)teur(o3oy1lptnlnvsas  2ur( poo4oet mietyslmDrluvsnt0aexrir3ta1op e n sl( trxrir3oodlm  lnct t  2ra(moot1oleomi3iysls2rl(vsn(0tltrir iatfaDr i olt) 2ur(r3oodlmt  fci sfaDtaxroou1tpxomfeild m2el( snu0 leoxr3to1la r u il(0 2umimpoydamtn ivias s2tmx pnt0oeeoii3iyt sDuaump;() ltoxocta1la  aneo t tetmio3iu1llte nvt t artmuronu0aee  feiadla2ea(mpnu4tlxomf3iodlp  aiei ()texoir3no1am e nvt ()artaxmp;o0tle  o3iydfs2rmumpnu4trtomr3oydopt an s s0 rtr(o io4apeelieils)srtmu p;t1aee  ieiad s2rm( o;(0aexniocia1fpD aueo;t0setmim ny1ome livi () Dtr( p;o4opxoio3tltlmDeln o u4 exrmo tytfmtrlu s;( t2tm(m3iodlm elnvt ( arra(m no1tpen iciysls2em(ms t0alxoif iotop ean s s s2toim iudol n fesatf Drrxro;t0olxoiicilslm2em( s t4tlerir3iy1faDrlnvo;s) etoim3io4lpeelncslt) 2truro;u0ope mociys mDrln s;t)tltnxf3oadfp r neo;t t2umxo oudapt  fet sfaDtrxr nu0aetnmf3tydlsDum(vpnt4 etnif3oatfpD lueo t0trtm(m iu4ll elneilt)a2tau  nu0ope ii3iytfa uan s u4tetrxr3ty1la eauvslt setoir3oo1opeelnes () rtau pou1aexoif3tlt m um( p;u)aexomo oodla e uvilt0texmxmpio4lmt mict s  ruaxmont0tptomoetadfsDemnmo;(0trerir iodlatelu o (  rtrir nu1llt mnci ( sDumu  ;t0aexoiociydfsDrauvs;t4aexnxocoatfmtrlieilt0trxrir nu4aptn nct t  2ur(  nu4aeeomoctytls uan o ()teerxf3ootlmtr nvi (0 rtmxo oudalte fcia(faDrmx  ;t4apeo fciltfmDrl(mo (0alenxf oatlp  livs;t t2to(m3oodlpt  iet t)arrmxmp;t0oeeomf3ilt mDelnvp;t)tleoxr iy1fpDeaieo;()sruoir3iodaptemivsl() 2rrxrp;u0tle mfeildla2uauvo t0 leomo todlpD  u s;t0trumir3no1amen nvt ( sDtmxrpno4oex mociat mDeanms;u0 eenmf3iatoptranvsls)t2xrirpnu4lltnmietlt)aDrrumpou0aee mfeiadlmDulnvo u4tlxoircia1fpteanvs t s2xmirpiy1lptemieilt sDumxmp;t4tle mfeiyslm2em(vs t)texoxo iytfmD  nei;(  rto(m3ny1llenlfcsl()a2urum nt4aptoii3iydfs2uaumpnu)tetnmo ta1faDr nesl(0s2toxrpoo1alt  neilsf 2rrxm nu1oetn i3iysfa2um( s;t)arxnxr ta1omDrli olt srxo(o ou1olt lnvias)sDur(mpoo0tle moetyd s elnmp u4tltrir3oydomD  uei s t2umio3io1al e fvt sfs2tm(r oo0tetn ietlsls uan on()trtrio3iodlp   i i t0 2tm(m3iy4optemncs () rurxrpou0oeenmo3iyslm rl(mont) reomrctatfatrlu i;t0srxm(rpoodlptelfcs (f rra(mont1tee  fctaslsDrau p;(4 rxnir iatlmtraiei;( trxr(o3iodll   ivtatfs2taum ou0tetomictysla umuvsnt4tleomocoodfmD  ieo;s sruoio3iy4olt mnesa(  2tr(  no1aexn f3ild mDua( onu)trxnxr3ta1omt  u sls) ruo(rpio4lmeemfei ( sDuaump;t1tlenifeiad sDul(msnu4trtrxo3ootoa ean i (0s2ur(r3nodlpt mfct sf Dur(r nt4alx  o3iltfa rl(msnt)tlenmf3ia1om  aueol( trtmir oy1om nmictas) rra( onu4alxo i3tasfs umn p u0artnio iy1opt au ols0 2trxr3nu4amt  fvslt) 2rrxrpou1tpxnifeiydlm ea( o u)texrif3tatfptrli o s tetm(m3iy1lm  mict sf 2ururpno4oexoiociydfs eauvon(4altnmo3oytlmD aieo;t0trtoxo iu4aleelfvtltfa2rr(mo;o0oee mfctysls ean pnt4artnmr3tadla  lnes;t setm(rpoy4al  mfvtat s2trurpou0openmf3iytlm ua( o u)tlenir ty1fp e uvo;( texoxr oy1ap   fcsl(fsrtmxm ou1aee miciat a uanmo;() exnmfcoatoaDr uvo;() 2ur(r3iu4omt  nesl(f Dtaxrp;t4aexoiiciaslm ranmo;(0 rxomr3tytfmDelieilt0 2tmxm oo1op nlnvilt) rrmurooo0apxnmfetlt s2um( p () rxnmo totfaDraieils) rtm(r nu1llt mneta()aDrmumpno0aptoifeiatlsDuaump u)texomrcoo1faD lieo t seum(o3nodlmtemnvt (fsrrrxmonu1olx  ociydfa umnmp;(4trxoircoadla rluvils  rur(o iydll elneia(fsDtaxr ;o4tlxnif3iad a um(ms ()tltnxf3iydlm  aneo;s trtrxr ou4omte ncsl(  Draxmp;u0apxn oeiyd m em(vpnt4tlxrxo ia1oatranes;s0 2to(r3no4oltelfeta(fs2ua(ro;o4alx  fetysfs2raums;u4teenio iatfa rlivs (  2um(r no4olee fcia(fsrurxm ot1teeo o3iasls uln p;(0trxrif oatlate u o (0t2ur(mpnydapenlfcsltf 2ur( pno4oet  ietytla2ran pnu4arerir3io1opt auvs;t  exm(m3iodame lnvta(f rtmxmoot4tlxo i3iltla2ranvs ()artnmf3iatoa   i i ( texrxr ny1amte fei ( sDtru  ;u0opx mf3tadfs ulumon(4trtrmo ia1fptr neols0s2ur(o3iudlm emfcia() 2uau pot0ope moeiasls2uauvp;u0trxrif3iatfmDe iei;s t2xmxmpiu4lmtnmicias  2raxr nu1aptnioeiltfa ranmo;u0texrifcoadoateli sls)sruoxm3oydalt lnctat)aDur(rono0tptnmo3tat mDel(mpn()teenio3iytoa elieo;t)s2toim nu1amt  ivta(  rum( ooo0tpxn f3tytfsDra(mp;(0 renxf oydfm eai i t  exm(r no4lpenmfes s s2ua(mp;o0tlt moetatlm ra( s t4trtrmfctydoptr i s ()sexoirpoy4alte netl(fa2umx ont4tpxoifetyslaDuanvp u4trenxr iy1opD anei s) 2xo(o iudaltelfvtl( a2rau o;u4altomi3ild m2rmuvs (4 lxnxf to1lm  lu s;s0tetmir3nudolenlncsas  2taur no0aeeomfeilsfa um(vs (0trtrif iodfp rlneo;t0 eurxrpoudol emfvtat)aDurum no1apxnmf3iltfs elnvp u)trenio to1lmDean i;() 2tmimpiu4lme lietl( aDuaxmpoo0opxnmoeiysla rl( p (4altomf ta1lp rlivslt0trumxm ny4llen fvtlsfsDrrx  ou1teto fctad m2rlump;(4altnmo3tatop rlnvilt srtoxopoo1al emncsltfaDrmx p;o0tpxo fcilslm2uan o;t0 lenio iytfpDrauvs;(0 2um(opnydop e ietas)s2ra(  ;o1ole  i3tas aDelnvpnt4alxoxf iytfmtrau s t)sexr(m nydap  mfei (  2tm(monu1olx ii3ilt mDumuvpn(0trenio ootfa  an s ()texrxopoy4amtemicia( aDumumooo1texo iciadla umums;u4tleoxo ia1fmD  i slt  2xr(mpny4ap e ietatfaDrruro;u4opxoifeiatfa rau snu)aeermociotlmteanvs;s)seurxr iy4ol emfvtls a2urxr ;t0altomfetltfa ran o u0aetnmr totlpD luvsl()t2umir nodoptnmfei t)srrmuront4tlxniiciasls2em( ont0 reoxf3todfpte iei;s  eto(r ou1altnlicil(f rrmum ;t0tpxomf3tysls rmumo u)texomf to1omte uvi s0 rumir oudlm  lnvt sf rumu o;u0tpeoif3tadls eanvo;t0altrxf3iydlptrlieo t) eto(o nu1ap   fvsa( sDrmum ;u1oetnii3tls m2uau s;(0 exoir3oy1laD  i s s0 eur(o3ou4ll   ieilt  Draxrp;u4opxn i3iaslm ra(vsnt) etnxr ta1oat livsls) 2urimpoy1lp e nctatfsDrrx o;u4texnmfctytlaDrm( s u4 eerioctotfmt luvi t)trtoxr oy4lpeelfvta()sDtmurpot0aetn ictatfmDua(mp t4treoxo ta1latrlneo;t0t2to(m3oy4lltnlfcsas)s2rr(r ;t0oetoio3tytlaDeln o u4 eeomo3oadoaDrlieo s0trxmim nu1om nmivtat s2urxmpnt4olxoiietasfaDem( snt4 lxrxf iatfmtr i o t0t2umim3oo1lp nmnesat) Duaxrono0aleoii3iytls uan pnt4tltoif3ta1fatr ueo t0s2xo(opou4alt  fcs t  Dtr( ono0oexnifetadls2elnmsnu) ltrmfctadopte ueo s)setoxo io1ale liviat srrmxm nt4aetomi3tlt a rluvo;t4 etrxr3iytfpte n i t srtoiopny1ap e fcsasfsrta(mp;o1aee if3iltlmDrmnmp (4 ltrxocoy1lm   uesl( trxoirpoy4lmee fvt ()a2ur(m nt1alen iciyd aDel(vs;u0 ltrxocio1oaDrli o;t0 2tr(r3io1ame lnctl(faDua( pnt4aexnmfctytfs uau pn()trxnxoctytlmDrlueo ( t2xr(r3iy4lp emfvils  Drmx ono0opto f3tldls uanvs;t0 lxrmr3iatfm  lnei s0trtoxo iy4amee nvsasfartaxmono4altnmieiytlaDul(msn()tetrmr tatlm eaieils teuoxr ou4opt mivs t)sDtax ont0aexomi3iyslmDuanvpnu)teenxocoadomt lnvols0t2xm(rpoydam  mfcsas  rtrx pou1tex mieilslsDemuvs () eeoxr3iatlptelueo t s2to(o3ou4lmtn fctlt)aDrm(m ;t0oee  oeiyd a2eln o (0aexoxfcootlat luvs;t0sruo(o oy1alen nei (fsrua(m nt4tlx iocias s rlu o;t4tetrif iydfmDr ieo ()t2toxm iy1oltnmfei (fsruru  ot0tlenmo3iatfa2rluvo;t0tlenmfciotfaDr n i t)srtr(rpoo1lmeemivsat aDumurpou0olxo ociysfa ua(mo;t)aexoif iy1oaD an s t) rxo(rpoo1am n fciat) 2rrumoot0alxn ocilsfa eln s t) ltnxocoytlp eau i ( s2tmxopiydlmtnlfvslt) 2taump;u1teenii3tat m ea( o;(0tlxoxf3tatfaDeanvols t2xo(o nu4ome mnvtlsf Dtaump;u4oexo ieiydfsDuaumo t4 etrircio1lp e uvs t0teuo(r3iu1ape lietls aDtm(r ;t4oeenmoeiyt aDumn s t)alerif3oatfaD anvs s) exoimpiy1ame  nes (fsrurur oo0opx iieiydfa2rmn s u4 rxoif3iatlmtr nvi s t2tmxopou1ap e icsasfsDra(ro;o1tpxniocilslmDuanvs u0 etrxocty1fpDeai olt)sruoxm ou4omeemivs s  Drauro;t1aet  icilslm uln onu0arxoir3io1lpDrlieo;s)srto(mpiu1ol nmncta() rurxr oo4aexo fetldfs2umnvpnt) exrmr3iy1lm rlnvs;( s2xo(rpiodlp nmfeslsf 2uaxro;o1aptn f3iad s2emu sn(0 lxomo oytomDran i;t0 2triopio1olt mnes s)srrmurp;t1aex ifcildfs2uanmp;(4 rxnio oydfaDraieils  etoxr3nodame mieiasfsDuaurpnt0teen fetatla2ea( pnu4 etoxr3oa1lm r nei (0tetrxrpoodom nlivils)sDrmxm nu1oee mfciasfm2ua(vsn() lenio oytfpt  nvi ( srtr(opiydam nmfviatfa2urxr ot0texn ieiydfaDuluvonu4 exnmr ia1lmte u ils0srtoir3no4lp elfvsls)a2umxr nt1tpenmi3ilslsDem(mo;t0tleoifcia1fp rliesl(0trxmxrpiudomte nvs t)a2ta(mpoo0tltoiociys sDemnmo;t0texnxo3tydoat an i ( t2tmxo io4ll emfvias sDua(mp;u1alxomoctltfm ea(vs u4 exomoctatfm eluvol(  2uoim3nydalenmnvtas)sruru pou1tetnmietlt a ul(vpnt) exrxo3ta1oatran i s0 2umiopio4ol   ncsl(faDtmxmpnt1olt  feiadlm2uanmp (0areoxf3totomDean o ( s2xo(m3oy4ap  lneilsf rrr(mp;u0tpe  oetls a2rmuvo;u0 rermociodla elnvols0 eurimpoo4ll   ncsat)srrmxroot0apeoiietytfa emnvo;(4arxnxf3to1op  aivsls0tetr(o3oo1ll n nvtasf rtmxmono4alxn f3iyt a2rm(mo;t0arenmf oydlpte nes;(0 2umxr oodlmt  fvt ( sDrr(ro;u1ale iieilt a emnvo (0tltrio3ootopD liei;s  rumxo nudomtelfci tfarta( p;u0tltn i3tltla2ea(ms;u4aetrmfciodfmDran i s)texoim nydoltnlivt t)sDua( ont0aetnmfctaslmDul( pn(4arenmo3io1lm r nei;t sexm(mpno4oltnmfcils)a2ra( ooo4aptomfeiysfa uau s;u0 ltomfcio1fa rlueo s0 rxmio3iu4apt mnvsa( aDua(  ot1olt ifeiadls2rm( onu) etomo3oo1opDe ivol(  2xoxopnu4op n fvs () 2tmx  nu0apeo fcilslsDrmums (4tleoif totlaD lu s t0srtrxmpiu4op emfvil(fs2ta(roou4alxnmfctltfm rmnvo u4 eeomo3ia1lp elnvi (0srxoirpny4ll nmfciasfsDtrx o;u4tex io3iasfsDuln snu4trxrir3iotfmDrai ols0 etrir3no1lpenlivtltf rrrumpot4tpxnmiciatfs rlnvs;()trxoxr3oadfpDrlnvol(0t2tmirpno4lpen nvsls) rtruro;u1opx io3tls m2eluvo t4 exrmrctatlpD auvil( tetm(m3ny4lmen ivt (fsrtrxmoot0texn icias mDulu on(4 exrifcoo1fateaivs s  2umim3ou4lmen fct (  2urx pnu4opeomoetlslaDumu p ()altrio3iadopt  ues;t0sexoir3iydalt  ici () rtm(mo;t1tpe iiciys aDrm(von()teenmo iadlateanvo (0sruoxopno1lle mncsa()sDrmxr oo4tlxomieiydfa2um(msnt4aetrmr3tadomtr i o;t  rxmxm iy4altn ncsa() Drrx oou1teen i3ias mDrmnvp;t0alenmo3oo1fm e uvilt0trtr(o no1llenmfci (faDtaump;t1teen o3iyslaDrlumo t) exrxr totom elneols0 exrirpiu4al eliet s)s2ra(mooo1apxn f3iytfm2umu s;(4 leomfciodfa eaivs;s0trxoxr3io1ameemicilsfs2rmuroot4aptomo3iltlaDulu o u0tetoif tatlpt  i s t  rum(o3no1op   icilt sDrax pnu0tpen i3iltfa eln pnt0 rtnxo iydoate uvi s sexm(opny4lpt mieiatf rta(r nu0aee ifetldlm um( s;t4trtoxociytfpt auei;t0s2toiopoo4aptnliei () rtmuro;t4alx mfciysls2rlnmsn()trxnxo iydlm e i s;s  rto(rpiu4ll elncsas) rtmu ono1apen feiatlm2elnvpnt4arxnmf3oadlmtr ueo;t0t2trxr3ou4lmenlncil()sDrau p;u4tpenif3tldls2uauvsn(4tlxnxo tydfp r i ols  rxmxr oodamt mnes (fsruaxrp;u4aeenmiciys a2elnmsnu)tlxrir iytla e u s;t0 2tm(r oy4lm  micsasfa2ua(mpoo1open fetasla emnvpnu0 rtoxo iodlptr u s;s)tetm(r iu1ap   fcsls)s2rr(  ;t0tex mo3iydla rl(mon()artoxo oy1late i i;t)s2xr(opoy1ll nlfeil( aDururpou1texoio3iatlm2rmuvpnu0 rxrxf3oydlp elivi s trtmxr io4omen nvta( artmumo;u1aexnifeils a2umnvs;(4aetoifctatfmtrauvo () 2xoxr ou4open nvilt  Dtm( pno0alxnmo3ilsfm2um( p u0aetnxrciydfmDeai o ()srumir ny4altelnci (fsDuaxmpoo1apenifetlt a2uauvp t0 ltrxrctytfptr ivi;t0seurir3no1lmtemfvs sf rumxm nu0teeomf3ild sDumnmsn(0alerxo3oo1fa  lneslt sruo(m io4opt lnct s arrm(ro;u1optn ictas a2uanmo (0arerxf3oy1la r i sl()tetm(o nudol emfetasfa2tm(r ou1aeenif3iad s ulump u4teenxr oydoaDrauei t0s2toim3oy1lltelfvi s)sDuaxm nt4tlxnmo3tysls ea(mo () eenio oydomtrlivilt)seurir3iy4llenmnciatfarum(mpot1openiocils m2el( p u0tltomf oo1latrli i;s)trtrxmpou1optnmncs sfaDrmu  no1aptomf3iys sDemn s u)aexrxr3iadfp eaneo;s)srto(m nodol emiet ( arrmxronu4apeomo3tytla elumsnu)texrif3to1fpte ieo t) rxoiopiy1omt lieil()srrrx  ;o0apx mfetadfsDra(vonu0trxrif ty1oatelnvi;s setrio nudlmte ivi s sDtru oou0apt ifeiltfs rln s (4 exomo3todlpD ln slt tetoir3oy1opee fcil(fsrtauro;u4tee ifctysls2rlu sn(0aexnxf3oo1fpDelnvo;t0s2urxo iudopt lfvtat sDtaur oo4olenii3iatlsDem( s;(0tetoxo iydfate i o;t0 2to(m oy1lp  mnes ()sDtmu o;u0teto i3iysfaDelnvo;u) rerirctodlp   n i;t0srtoxo3nudlp n netat artmu  ;o1olt  ieiad s emumon(4teeomr3oy1fpteaivs;t0trxrxm nu1olt lfvs s)s2ra(m nu1tlx iieiydla2elnmo;t4tetrio3oo1fa   ivs t0srxmxm3nu4ameemnet s s2tmur oo1teeoifctatlmDumumo;() ltoiociy1lmDeluvo s0sexoio3no4altn nes ( sDtmumo;t1tle  ieias m emnmo t)tlermfcoydomtrau i s)srxm(opoodamenlncia( srtr( pno4olxnmfciytfsDraumsnt4tltrxf3ia1fa eauei t) eurimpnydlpe mfesat)aruax pnt0aet  ocias m uau o;u0tlerxfciodom  au ol( srur(mpoy1lm nmfet ( s2tax oou0tlen f3ild mDum(vs (4tleriociydlpt  nvs;t0 rxmio3nudale  ncslt arrru  ou1aeen ictldlmDra(vs (0trxrmf3oodlpD  neo s) rxrxo iy1am elfvils) Drrx ono0olto f3ildfmDel(mpnt)teeomocoy1lptraueo t0 rtm(r3nudalt  netls)a2rrumo;o0optn iciasfm2uln sn(0 eenxr3iytfmD  u ols0s2xmxm nu1lptelfcils aDrmxmoou1olxnif3iasfsDean s ()aetomfcoo1fm   neo ( teumiopiy4ap nlfvsls  Dtrx o;o4tpxoifetydls ranvo u0arxrmocoadomDelnvslt t2umxo3io4ale lfvsa( s2urx pou0oexomieild aDemu p;t)tetnmf3io1omtrlu s;t)srxoxmpou1opee iesl( aDurxrooo0alenmfctltlm rm( o;u)teeomr3totopDeliei;s)trtrxrpno4om n iei s arraurooo0aptoioetyt m2emnvs;t4arxomo oatoa raies;()s2urxm ny4omte ieil()aDur(rpnu0apt mfetytlmDum( s u4 lerio3to1fp   iei t  2trim ny1lmtn nct s sDumuront4oex  f3tadls2ea( o;t0 etnxo todlptrlueolt s2umxr io1omt mieta(f 2rrumoou4texnio3iatlm ulnmonu4 etrmociadop   ivsls0 rxrxopio1llt lnvia( aDta(moou0tptomfeiadfm rmu p;(4tlxoxo3iy1lptraivo s) rtoir nu1llt lfesat  Durxm no1apx mieiatfm2uaumo;u0 lenif tadoa raueslt0 2umirpio4ol nlivtatfs2tmxrpnu1oltomietysla2rmnms;t)tetnir3to1fa  ai il(0srtoim oo1ole lfvsat aDtmurpot0altniictltls rmnvonu)aeeoio3oytoat aneo;()truoim3oy1ll  lfesatf Dtr(mpno4opxnmiciysfa eau sn(4 exrxf3todomtrauvs;( texoio3nu4om emnvtasfa2raxm ;o0aex  fciytlaDua(mo u) exnxo todomDeluei t0trtmim nu1alte nesat  Dtm(  nt4aeen f3iltfs emump t4 eenir3iodoaDeaieilt)s2xo(o nu1amt lnciat)s2taxmpnt0open ietad a raums (0alenif3tytoa ranvilt0srtmxrpnydllenlfcilt  Dta(r nu1oeenmf3iadlmDrmuvs ()teeoxo totlp r u o;t0teur(opou1am elfesls sDurum nu0tpt  f3ilt sDum(mp t0 rtrxo3oydfpDeanvo;(  2urxrpoydoleelnvtlt) ruaumo;u4alto o3tlsfm2ra(mp ()trenmf3totoa   ivsls0 rxoimpiu1ap e fcta() Dta(r ;u1tpto ociat a rau p;()aexomr3iodlmD lieil(0sexoir ny1ale mnvtls) Dururo;t0teeniieiytfaDua(von(0tltoirctadlpDr n i;( teum(m3iy4lp  mfcil(fs2rruronu1aetnifcilt aDuaumpn() ltrir oa1omDr u s;s srxrxr oodlleemnvi s srrmuront1apen fetls mDem(mont)tlxnio iydla ran i t0 2xmim nodom e ivi ()a2um(mo;o4teenif3iys m emu pnt4altniociydlatr uvilt srtr(r iodam  mnvil( a2rmx poo4aee  i3ild s el(mp;t0tltrmrciotfptelnei;s0t2xoxm io4ole mnct s arrmxrono0tlxnio3iyslm2rln snt0aeermr3ia1lm elivo ( srtrim ny4ap e ictat sDtaxr nu0opeoiietytfsDeaums t4trtoxo3iy1fpDran i s t2xoxr3nu1alenmnvi t)artruronu0tpto o3ilsfs2emnvpn() eeoxfctydlaDranes;( s2urir3oodlpe lfes ( srtru oou1apxomfcildfs el(vsn(4 etoxo3oadfmtranvo;s)sexrxm3no1alenmneilsf Durx p;t4oexnmo3iad sDuluvo u)artrir3to1la ranesls sexm(rpoo1apee fcilt)arta(mooo1alenifcilsfs2um( o;t)altomocootfa rlnvsls0trto(opiodlp   fvslsfaDtruroou1alxomociasls ranms;u4tlxnxr3oodla e nvsl()sexoiopny4op nlfeslt srtr( pno4opxo i3tydfs rm(vp;()artnxf3ootfate u s (0seumim oodamen fci ()s2urxm ot4alto fetldls2ranmont0 exnmf iotfat au i t  etrxm3nu4lme mfcsas)a2tr(rp;o1oltomociyt a um(vo;t0 eenio3ta1omDranvi t s2xm(m iy4lpee fvsl(faDuax  no0aleomi3ils aDelnmsnu) eenxr oytfp eaneo ()srxoiopno4olte nvsa(  rta(  nu0tee  ietld a eln p (4aeermf3oy1opD  uvs t0 ruoirpno4lp nmfctl(f 2tr(rpot4alxo fetad m2emnvs u0alxoxrcoytoate ieols srtoiopiydol  mivia(  rumx  ou4openiiciltlmDel(vpn(0trenxr3ia1faDe nvolt t2xo(m ny1lmee fvtatfa2ra(r ot4tpen f3ild m rm(vs;u4teerxrcoa1lm e i i t)teuo(rpiy4oleelnesl()aDrmxm nu0alxn ocias s2um(vp (0 rtrxf iydlaD aneols)sruo(mpoy4optnlnei (f Drauronu4oeenmieiytfsDemn o (4altnxo todlmD lueslt0 rum(r oy1lmtnlict s srtr(ront0tltomf3iat m el( onu)trerxrciodfa r ueil( t2xmxm3nu4ame lietls srtmxrpnu1opxoii3tat s2rmums;(0texoxr iy1lmDrlnes ( teuoirpnudllenlfet tfaDrrxrono0oleomieilslm rmnvo;(0 rtnxo3todlmtraieo s  rxm(o3iydlle mnvsa()artau pou4oltomoetasfs2rmu s;(0 rxrmf oy1op e uei t)s2xr(opoy4ol emfei tfarrmur ;u1texniieiydfaDea(vpnu4 lxrmf3totlpDr ivo;t  eumimpnu1ameelicta(f Drrum ;t1tpx  o3tys a um(mo;u)teerio iodfmDrlieilt  etm(r iudalt  fvt (fs2rr(rp;u0olxo ictasls2em(vonu4tetrxr tadom r ivsl()sexo(opnu4aptemfesa(faDuaumpnu4oex  f3ilt s2uluvp;() lxrir3tadomtean ils trumimpny1al emnvi tfaruru o;u1aptnmoeias mDeluvo t) rxnmfcto1op e nvolt) rtrxr3oo4am nmfeil(fs2tru o;t1olx iictadfs2ulnvs;t4trenxo3tatla rlies;t)srum(m3oydoptn ivtatf Dta(  ;t1ape moeiysfa rmumsnt4 lxoir3tydfpDr u i t trum(r3ny1llenlfctltfsDtrx  ou0apto ictltlmDeluvp;() eeoir iotfp eanvs s teum(m3oy4alt mnet t s2tm(m ;u0texo fctad s em( p u4trenxr oy1om   n olt0 rto(o ou4lpt mfesat sDra(m ou1apeniictyd sDel( s;(0alxnmf ootlatrau s t)t2to(rpoo4omt mncs t)a2ra(mpot0tpenmo3iyd sDraump;u)alxoif to1lp  anei;s)srxmir3iy1lm e ies t s2umxrpou4optn fcildlsDelums;u4aetomrcia1lmDrlies;t  2tr(m3ou4olen neta(faDrrx pot1altnioctyt aDrln s;u4tltoirciatla  auei t) etr(o iy4op emivi t) Drrurpoo4optnmf3tat sDuln s;t4altrxo3tytlpteaieilt)setrxm3no4ap  lncsat) rumxr ;u0olxnio3tas aDulnmp t) exnmr oa1fpDeau s s)truo(r nodal e ieslsf 2ururoou0aeen oetydfa rlumpn(4aleomrctytfmDelu s ( s2tm(o oudol  lfet ( aDrmxmp;o4aetoiociytla emnmo t4trerxf3oa1lpDe ivils trxr(o io4olt  fvia()arraum ;t0tleoif3ils s2umumo;(0 rtnir3iytlpt aueils)tetoio3nu1omte ieslsf Dtmxm ;u0oltnio3iydlsDel( snu) lxnxo3oydlmtr i o ()s2xmxmpoudolenlfcsat  2rmumonu4alenmi3iltfsDrmn o t4aeenir iadopDr nei s) 2xm(r io1oltnlici t  rrmx ono0apx mfciysls2elump;t)tlxomr io1lmD  ivi t0srurxm iy4ll   ieil() ruaxmp;t4alen ociatfmDrl(vs u)aeenxo oadlpD an s s0 2xoxrpno1ope mnesltf rrr(r ;u1tetn feiadlsDelums;u4arxoxoctytfat ai ils)tetoxmpio1lle mnci ()arraum ot0oexniietadfmDrauvs (4areoxf3oodfa  luei;s) rtoxm ny4lltn fci t)s2trxmoou1oeeoiicild a2rluvo t)artnir3iy1omD  n ols)sexmxrpnudamee fet s s2ur(  ou4tet mf3tldfaDua(mp (4arxomf oatop rlueo ()sexmxr3no1lltemfeta()srtrumono0tlenmoeiltfm rlums u4artoir3tatoaDeau s s  2trxrpoy1lpenlfciatf 2taxmont1optnmo3iytfa ea( pn()alxrmr3tatoa eaieo (0seuo(opiu4llee iet t  Dumx  oo0alen f3iadfm2emuvp;u) reoxo3oa1fm   u sls) 2umxo oy1lmt lfvi s)s2ur(rp;u1oet ifeiasla2ulnvsn()tleomo oadopDeai i;s0texm(opnudlptemnvtlsf Dtmxro;u0ole ii3tatlm2uau s u0artnmo tadfpt aiesl()seto(m3no4ope lnci s) 2urxr ou4tetoii3iltls umn o (4 ltomrcoytoa raivo;s0 2um(opoy1omtelivtl(fa2tau p;o0aptnio3iat sDua( s;t)trxrio3todlpDrau ils0 rum(m3ou1omtemnetat s2tmuro;t0aee mocildfm2rm( snu) ltoxocoadomD  i slt0srxo(r3no4am nlnes () Duax ono0oeenmietadla2uln on(0tltrxf3iodlateauvil()t2um(r3iu4am nmfctatfaDrrur ;t1oleo oeiysfa ea( pnt)teeoir tadlptrau s ( srtr(r oo4ll n fvsas)a2tauronu1optomfciysla2rl( snu4 lermf3oatfmt  u s s0trumxo3oy1ap e ncilsfsDtr(ro;o1tle ioeilt s2el(von() ltoxr3oydomD  n s t0 2uoxm3oodlmeemfctls)arrr( oot4oet ii3iadlm2em( p;u0trxniociadom rli s;t0sexoxrpoo4lm emncsls)srumxront0altn o3iysfs ea(msnt0aeenmf oadla   iei s)s2uoxo oudal  lnvilt  Drrx  nt1olx  iciasfm em(mon(0artrmrcty1lpt  u i;t)texr(o3oy4lp elncsas srta(m ot1optniociyt s2eluvo (4teenxrcio1fpt  nei;()t2xrir3oydlpe mnci s) rtrxmp;u1olen o3iys aDra(ms t)artoir3oadlmDrluvi;s)s2tr(r3iodaptnmnci t  Drau  oo0oee ioeiaslm2rluvo;u4 eerxf3tatoa rlues t  2tm(r ny1llt lfvs s)s2rr(  ;u1altomi3ils a2uanmonu)tlxomr tytfat  ueilt)setoxrpiy1omenmncsl()aDtrx pou1tet ifeiyt m uanvsnu0aleoxo3oadoatr ivi;(0t2toiopiu1om emivil()arrmxrpou0opt mi3ias m ranvs;u4 rxriociy1omD aneo;t)srxmxr oo4alt mfct ( aDtmxmpno0ale  oeilsfaDum( o ()trtrmr iy1fatrln o s  rxo(o3io4ol n ncslsfa2truro;o0opt  oeiysls2emnvp u4 leomo iotlp r ueo s0seum(rpno4lle  ictas srua( p;o1teeomf3iys aDrmnmp;(4trxrmr oatomDrau sls s2xoxopoy1lp n nvtltfarrr(mpou1oeeo f3ils m emu o (4 etoifcto1lmDr i sls) 2xmxr3nudome lics () rta(  oo0tpeo iciasla ua( s u) rtnxoctatop eanvo;t setrirpnydolenmnvs t) 2um(mo;o0tltomfeildls2uaump (0tleoxf3io1faDran s t srxr(o3iy1al elfctlsf 2ur( pnt0aet mfciltfmDua( s t0treniociadopteau o;s texm(rpiodop emnvtl(  rtauront4tlx iictlsfmDemnmp;u4 eenxrctytfpte u ils0 2ur(o3nu1op n ics tf Draxmoot1tet  oetadla emnmp;u)arermo3todoaD lnvo;t)t2xr(m nydll  lict ( sDrm(m ;o0oltomi3iat m ean snu0teeoio3ty1optelnei ( texo(o oy1lltelfvi ( a2raxr nt1olt  oeiadlm ulu p u0aexomf3todoa rauvo;( seuoxo iy4lmeemnvilt a2urxrooo0aptn i3iydls um( snu0artrircio1oa ranvs t) exoxo3oydap   feil() Dta(r ou0tlenmfciltlmDuanvsnu)teeoio3iydlmDeaueo;s t2tr(r ou4omtelfvsasf rrm(rp;u0oexnifctat s2umuvo;t0tltrmf iotlm  anei s)t2umxr nydame mnctas artr(rono4tlt  feiat sDeanvo t4 eerxocootom  aneils)trtr(o3no1al  lnvils)srrauroot0alxniieiatls el( ont0trxnirciotom rai i;t0s2tmio oo4lmt mneslt)artaum nu0opx mf3iatfs umumo ()teerif3oadlmDe ies;( s2trio3oudapte fei ( aDurxmpot0open i3iyt a rmnmo;u0altoifcoa1la elneil(0t2trxm oydomt mfesas  Dtau  ot4aexnifetyt m2uaumo t0 leomo3tydom r n o t s2tr(opou4lpt lfetat) rurx  ;t1oetomoeilsls eau s;u)texniociytfaD ln il()t2tr(r3nu1om  lfetls)arrrxmo;u0tlenifeias mDemu sn() lxoxocia1lmt aneo;s sexoimpio4lmtnlfcilsf Dur(mo;t1tee if3iyslmDumnmp u)treoio3iydfmt  uvs;(0t2uoxrpno4ape lfetat)arrmx pno4oex  ieias m ra(vonu4arxoxocootfmD  ues;s trxr(o iu4lltelfcil( a2umump;t4tlt mieiltlsDrmumo;(0altrmo to1fpD anvsl() exmio oy1lmeelicsas)s2rm(  ;o1olxn o3ildfa2eanmpnu)aeeoio3iatoa r uvi ( setm(mpoy1opeemfes (f Drrumpot0alx mocilslm2eanmpnt0teenmrctodopDrli i;s t2xr(m iu4ll  mnvta( sDumumpoo0tptn ietad m2el(vo (4 ltnmfctytomtrluvi;s)setmxo3iudap nlnei ( sDum(rp;u0optoio3iytfsDulnvp;t) exrmr3io1fm  anvs;(0trxm(opiy1op elieils)artrurpnt0tetnifctatlm ua(vp;u4 rxnxf oydlpD an s t)sexoxo3nu1llt mici s  Dtaum ;t1tpx moeiys m2em(vo t0tlxrxf totfpt aiei;s) exoir oo1ole lnes t  rrrxm ;u4aptoiictydfm2rmumonu0 lenmf ty1fmt ai i;t)setmxmpou4altemfvsl(  rumu  ot0oetn iciys m2rln s;u) rxnmr iotoptrlu sl( srtrirpnodalt livi t  Dur(mpnt4alenifeiydls rm(mpnu)trxrxo3ootlpDeauvils)teuo(r iodll nlfvs ()s2ta(  oo4opto f3tyt sDuan pnt4aexrmocia1lmteln s t) 2xoxo3iy1lmt mictls s2uaumpoo1olx  i3iadlm elnmsn(0 rxoxocia1omt aueil(0 2xr(mpiu4lm  mfvils  2tmur nt4oeeomfciatfm2eau p u)arxnmocoo1lpteli s t) exoiopnodomenliciltfsDum(ro;u0tlxomfeiyd sDea(ms (4aexoif tadoa  ai ols0 2tmxo3ou1lm elnvil( artrur ot0apxnmociyd sDrmn sn(0 etrifciotlaDranvsls)t2urir3iy4op  mneias srrmxm nt4aet mociat m rauvon(4artnif oatoaDrau o s0 rxr(m3iu4opt  fvs ()a2urxroou1tetn o3iadlm2em(vs t)aleomo3oydfpt  iesl(0t2to(o3nu1ap nlfct ( s2rm(  ot4aetoiieiyt a2um( o (4trtrif tydfpteai i t  exr(mpou4apt mfcils)arumxmp;t1aetnioeiysfs2elumo u4teerirctatom rauvo s seumxm3iu1olte ictas)s2ua(m ;t4tltnifciytla2rl(mpnt)tetomocoydlmtrlies ( t2urir ou4opt lfviatfs2um( oot0optn oeildlmDulu p;u4texnmf oy1fa  lu o t s2ur(m oy1apee ictlt  2rmu oot1tpx ii3ils mDrauvpnt0 ltnif3oa1lpD lnesls0s2tmir3iu4lltn fctat)arrmuro;t0aet ifctas mDraumsnu0arxrxf3to1fa rau i s0sexmxrpno4al nlnvtat  rra( o;t0tlxnmoctadfm ea( p (4artrxrcta1faDr uvo s)s2toxm3ou4ole lnctlt s2rm(m ot1aeenmo3iysls2rlnmo;u0texomo oytlmtrluei ( trum(r3ou1olee ictls)artmurp;o4apxo f3iasfa2ulnvp;(4texnmo3todfpDr ieo (0 2xo(m ou4omt mncilt)aDtrxm ot1alxo i3iyt aDrlump;u)tlermf totfatrli slt texr(o3no1oltn ncils aDtmx p;t1aeenmo3iytfs um(vp;(4 rxrxo iodop e i ols) etrxo ny4llenlnvtlsfaDtrurp;u4tet mieiatfmDelnvp (0teenxoctotopDeln s ()srxrxr iy4lpeemncsl(fsrumumpno4oltomoeiltls2rlnms ()alxrxrcto1oa eaues (  2tm(r oydllte ics sf Duaumpou1oex  ociasfsDrm(vo (0aleoif iadopD luvi;(0 rtmxmpoodam e ivia(farrru p;t0aeto f3ilsls ran snt) exriocoo1lmDrlies;s  euoxm3ny1op  mnci (fs2ua(rono4alt ii3iys aDumuvp u4 etrmocty1lmtrlu s;s0 rtoxr ny4lmtelnctasfsDum(rono0opxomfciyslm rm(mo t)teerio tydfp   ieslt truoio3iy1aptnmieslt  2rr(mont1tptomi3ilsfm2em(ms t0 rxrifcto1omt lu i;t0setm(m3nu4apee feia(fs2rr(mo;t0texomoctls aDuluvs (0alermrcio1fmt aivs;t  rumxo oy4lp  liet s  2tax poo1texomf3iyt m emn o t4alermo iadomDr ieils0teumir nodlptnlicsa(fs2tmur oo4olenmoctldfm el(mp;() rxomfcoo1fp   uvsl(0t2uo(o3oy4lm e fviasfa2tmuro;o0oltnmi3iyt mDeanvp (0trxoxr iatlpt lu i;()truoim oydamt lnci ()arrr(mpnt0ole iietydlsDem(mont4alxoxfciodoa   neo s0tetoir oudopt lnctas arur(rpoo0tet mfetltlsDel( sn(4 rxoiociydoaD  i i t teuoimpiu4omtnlivtlt srrmu oou4ope  fctlsls umu s;(0aexnmo3oadlm  lu sls0setoim oy1lm e ivi s  2ra(mo;t0aeto ictlsla uan p;u)arxrxf3oytla eluvi t0sexm(opiydlptn nci s  Dur( pno1tex mieiltfsDeluvs t) exnio3oa1lptrai i t)sexoxm iu4op nlncslsfaDuau pnt4aleo o3iytlmDeaums;u)trermrcoatfpD livil(  2uo(m3oy4lmt mfet ( a2urumont0oetniiciadla2uanvsn(0aeeomo3ootop eanvs;s0truoxo3oudopeelnct t) ruaxmp;o4aeeoioctys m elnvo t)arxrif iodoptrln slt0 rtrxr iy1op  mnei sf Drr( pnt1alxn f3ildlsDrm(mp (0tleomociy1fp r u o;(0t2trio3ou4lm nmfcs tfarua( pot4oetn fcilslm em(mpnu4 etoir3iytop  lu s;()s2toxm3ny1lp  lfctl() Drmu ont0ole  ieils a uluvp;(4trenxf ta1oa  li il( t2tr(rpoy1olt liet (fa2tmu ono1altomo3iydfa2elumo u4 exoifctatopt lneo s setrio3oo1openlnvia(faDtr(mpoo1alen ociytfm umn s;t)alerxr totomt  ueo;t texo(rpiu4apeemiesas)srrmx p;o0tlx  i3tlsfsDem(vo u4texrio3oa1fm e ivi;t0srto(mpio1lpeelnct t srtru pnu4apt ifciatlm ua(mp;t4 rtrxf todfm elnvi s  etrxo oydalee icil(f 2um(  ou4ale  ieiatlsDemn p u4 rermf tadlaDelneols) rtmiopoudop nlici s)s2ururonu4oexnif3iytlmDum(vp;t0tltrifctydlat  nvs s)srxrir no1lpt lfct s a2urx pnt1apx ifeiadfs2el(vpnu4trxnxoctytomt aivi s srxrxr ou1apee ivsatfsDuax poo4oetniieiyt m emu p;t) rtoif oadfpDelnes t)trurxopny1ol nlicils  rtr(rooo4aleoioeiatls ra(vs ()trtnxo tatfmteaivilt  rtoio iudale lfvs s  2tr(r ot0oex micils s2ulnmsn(4texrmf3oo1la  auvo t0 rtriopno1omeemivil( arrr( onu0aeenmf3tlsla ua(vs t4texnmfctydfa raues;t0srxr(r3no4apte ics (  ruaxroot0alt  fetldla2ul(vp () rtoif totlm eauvi s) 2toxrpiydlleemfvil() Drax oou0aptoiieiad m2uluvs;()areoxo iotfp raneo;( setmirpiu4lp n fesl(f 2ta(r ou1ape  f3iltfa ra(mpnt4alenioctotomD lnvo;s  2um(opiu4aptemfci s) 2tau  ot4oexo o3tas m2ul(ms t0 rxoif totoptr nes (0teuoxr3iu4ope liei t  2uau pnu4tleomf3taslm rauvon() exomfcoadfa eaivs;t0t2tmio iudaltemnvi s aDrmuronu4ape  i3tat m2ra(vs;u0 exoxo3iodla   uesl() 2trim3iu1al n fvtatf rum(ro;u0tptnmfeiysfa2uanvo;u) exoifcta1la  auvilt) rur(r3oo1optn ici tf rua(rpnt0olx mi3ilsfsDua( pn(0areomr3iotfaD  u s;() 2xmxmpoudalt  ivt tfarumx oot4tlenmi3tasls elu on() rxnxfcoadla  an sls0srurxo3oudopen nvta()aDtau pot4opto ictatla2uluvp t)arxomr tadfmt aivo s0trxmxopio4am  lfes t)aruau oot4apxomicias mDra(mo u)trenmf iytlptr ies;()tetm(r no4lmtnmnetlt)artrx pno1aetnmfciltla2emn on() lxnxf3ootlpDelneolt0srxoxo iu1opeemivsatf Dtrurp;o0aeeomf3ilt sDul( on()alenmo3oodfpDrlues;s) rtmxmpiydal  lnvia()artrxr no4tle mi3ils m ea(vo;u0arxnxocia1om eanvil()s2tmirpiu4ale lnvt ()srtaxr ou4ale  ieiydla2ea(mp;u4tlermo3oo1om   uvols s2xmxo3nu4amtemnviltfsDtrurp;u0tlenmfciydfs rmnmo t) eermocootomtraueol(0 euo(rpno1ape mnctls  rrru pou1tptnifetydlsDelumo t) rerxf3todoa eaneo;s)t2tm(opoudlmee fciltfa2rm(r ;u0oee  o3iadfa rmump u0trenifctodlmDeln o t)srtmir ou4lp elietasfs2urx  nu4oexnif3iytfsDean o;u0aleriocty1opD aueo;t setrimpnu4lltnmicilt)a2umu  no1tlen o3tytfm raump (0arenir totfaDe ivsls0srxoio iodap  lncs t)s2rm(m no0tpe mfcils m umnmsnt)aetoio iotlatraueo s  euo(o nu4optnlici t)a2rr(rooo0alen o3iadfa2ean o ()trerxf3tydomDr i slt)teumirpiy4ap nmicils  rumxr ;o0oexo fctytls um(vs;t) lxnio ty1oa rauvs;()tetr(m3iydom e neiasf rtmu  ou4olx moeiydfs2ul(vo (0artnmo iy1lmtrlu sl( srur(r nudape mnct () 2uru o;t0tlenmi3tlt mDran s;()altrxf3iotlp elies;()teur(m oy4ll elfci t) 2uru  ot4apt mo3iytfaDrm( s;()artnxo oa1fp rluvs;t s2xo(opnodll n icsa(  2tau ono1opto o3ildfa umnms;u0altoxr totfm r u o;()s2uoir3ny1ape lfet t srtrumonu0aptn icils m ranvp;u0 eerio tatfp  anvs;s)tetoirpoo4ol elnvta(fsDta(moot1oetnmoeilsfm rlnvpn(0trxnmr3oo1fpD  ivi;t  rtmxo3iy1optnmfeiatf rtm(mpnt4ape ifctyslm uaump;u) rxoif ootfptr i s;t  2tm(m oo1lm e ivi ( sDur( oou1tltnmoetadlsDrm(vp u4aetnxo iotopD aues;s)t2trimpoy4op emfvsl( s2umu o;o0alt  i3tyslsDulumo t0arxomrcoatom   nvi t)srxrxm iodomtelnvi ( srua(  ot0olxo fciadla rlnvp (4tlerio3tydlmDrli s;t0 2trxr iodap nlnesat srtr(mpnt0opeo f3tyd a ra(vs;(4alenxrcio1opD  n olt)srtriopiu1lm  lics tf Dta(r ou0aexomi3tlsfmDea( sn(4artoifcoo1fp e i sl(  exoio3ou1lp  lictls) Dumurpnt0teenmo3tat a2eluvs;(0 ltoif3tatfm   iei s t2to(mpiodap nmnvi ( a2trumooo0tpt mo3iydfmDean s () eermocoytomt auvs;(0 rur(rpiydlp e netlt aDur( p;t0ale  feiat s eanmo () eerxf3ootoa elivi;s  rxr(opoudlm elfcsls  Drrxmonu4tee  iciyt s2rmnms;u0 etnmf3oodlm  livo;t  rurxm oodolte nesat) Duru ono1opt  oeiydlm um(mp;()trenmr3iy1fmteli i;t0 ruoir3oydam nmfesl() Dtaumpot4ope  o3iltla2um(mpnu)treoxo iadfatr u i t0seuoimpiu1ope  ncsa() 2tmu oou0tee  ieiytlm rmn o u) rxomo3iotfp  li s;s0setmimpoo4apt mict tf Duaumo;u0aeeo octls s2ua(monu4 rtoxo3oodoa  livols trtrir oudlmte fvilsf Drru  ;u1olxo ietytfm rl(mp;t) etomrcia1fpDr neil(0 rtr(o iy4amenlfctl(  Durumpnt1tlxnmo3iysla2rlnvs u0texoio oo1oa e i ilt0seuo(r3oo1aleelfctatf 2rm(rpnt0tet io3ias aDra(vonu0 exnio3oadoaD livo;(0 euoio3nu4om nlicsl(fs2rm(root0oleo i3tlt m2rlnmpn()tlenxfcootlpte nvi;t0t2xrim3nodol e ieil(fs2umumo;u4oex  f3tasfa um( s;(0tleomf tytomtrlivi s  etoxmpiy1ope lnvia() 2rm( oou1olx mfetysfsDua( snu)arxoxr oadoa elu i s srurxo3nudlmeemivt (fartrxrpou1tlxo oetadlm umums;(0 rtnmf iodfa ean il()trtm(m3ou1lme  nvsat)s2tau oou1optnioetltlaDea(mp t4 rtrmr tatop elueo;t0tetrio3iy1al   fcsat artmu p;u1opxnmfetltls elnvp u0texrxrcoy1op   n ols srtoim3oodomenmnctat  rur( p;u4tltomicias sDum( p;(0 ltoiociy1faDrlnvil()srtr(m3iydlm elfesl(f 2raxr no4tpt mi3iatlm eaumon(4 rtrir3ta1optrlu o (0 2tmxopiodam eliei t)a2ua(  oo1tpen f3ilsls2uan p;(0 leoxf ty1omDrlu i;(  2um(rpiu4oleelfcta( s2raur ;t0tex mo3ildfsDrlump;()trermo3oa1omtelnvo;t  rxrxr ny4openlivtls) 2um(m nu0apen octytfs2umnms;u4tleomr3tydlaD aivsls  ruoxo iu1ape lieias)a2rrx  no4alt  fetasls2rlnmp t0 eerxf tydlmt ln ol()tetmiopiudom  lnei t sDrm(  no0ape  i3iadfs um(mo;t) lenioctydomDranvsls)sruoxm nodll nmnes ( s2rmx o;u0olx  ociltfmDemnvo t4aetnio3oa1lat livi;(0srxmio oo4om  mieiasfa2rm(ro;u0tet  f3tldla ua(mp;u4arxnio io1lm  liesl()seuoxr no4alen ics tfartmuro;t0aptn ociltfaDrmnmo;t0 rtnif tadfaD an ol() exmim3io1alt lieiat s2umxr ;t0alt moeiat a2emumsnt)alxomf3iotopDe u ilt trurio iu1apt liet tfarrr(mpou1aee mfeils m um(vo;(0 etoxrcoydomDr n i t)setr(opnu4openlnvias)s2rmxrpno4oltoioeiytfs2uluvs;(0 ltnmf3ta1lptr nvils)teur(r nodapt mnctls)sDrru  ou0aexniieild a rlnvo;t)alerxr iydfptr neils  ruoiopoy4lm emfvi (faDtruro;u4texomicilslsDra(mo;u0aexrxr3oydoaDr nvsl(  euoxm3ny1ape  ivi tf rtru p;o4olxomf3iadfm2emnvo u4 rtrio3ta1fpD an i s) eur(r3nydalt lfeta( srumx pot4oexo o3ilt sDelnvonu0arxnxr3tytfate neils)sruoir3nudapt mivs s arra(rp;o1texnii3tyd mDemumsn(0altrio3iydfmt lnvi s)setrxo oy1olt mivt t)a2trurp;o4oex mietysfs eaumo;()aexomocoa1fpt  nvs;s tetr(m oodlp  lietas s2raxm nu4aeeoio3iysla2ranvsnu4aexnxr3ty1om rli s;()texm(r3oo4oleelnetls s2taxr ;t4tleomo3tydlm ua( o t4 etnmo3oo1fm  livil(  exrio oy4lp e nvsas)s2tr( pot1tlt  oeiyt a2rl(von() rtnxr3totlpD lnvolt) rumxopoy1lle  fcsa()s2rrxrpnt0tleoio3tasfa el(vp;u) rxrxf3oodop eaueo s trxm(o3ny1ol nlivtasfsDumu  nu1ale iicildfs2ranmont4 lxomocoatopD lnes s0srtmir3iu1open fvtlt) Drrur ;t4oleomoetadfa el(vp u0 leoir oa1omDelnvi;t) ruoio oo1om nmivt ()artru pou4tee moeilsfm2umuvp;() etoxf ta1lm e uvsl()texmxm3iudal  lneias aDtaump;u0oleo fciatfa2emu p u0teenxfcoatlmt luvo;()teuo(o io4lm nmncsas)s2tax o;o4aet mo3iadfs2rmn ont4teeoxr3oodoat auvi ()t2xoxm3iy4amt lfcsat  2umur no4open fciaslaDran o t4 rtnxr3oo1laDeaieo;s s2tmxrpoudaptnmivil(faDrmx oot0tpxnioeiltlmDemnms;(0trerxf3iytopD  i i s0s2um(opnydlp   nci tf rra(mont4tptoiociatfs2el( o;() lerxfcta1omD livils setr(rpiy1oltn nci tf Durur ot1olx  fctysfa2rl(vp t)tetnxoctytlpDe uvo t)t2xrio nudaptemneslt)artrxrono1oet mf3iyd sDuluvo;t4 rxoxo oytfateauvsl( seumxopoydomtnmncsl(f 2tr(r ou4alx  i3tytlsDul( sn(0tlxnxo oy1om raues ()sexm(r3nu4am  lfciat)aDta(mpnu1oee mociys mDrm(mp u) renifciy1omt luvi;t t2umiopiy1ol elivs sfaDumx pnu0aexoiieils aDumums;t0aexrif3iotoateaivi;t  2uoxo nodlptelnci t srua(mo;o0apt ii3iaslm eanvon(4 etoifcoydopteaueo;(0teurimpoo1omee neilt)sDtru o;t1tpt mo3iat a2em( s;(4texomo iodlm  au o;( texmim oudol  livils  2tmu  ;t4opxomfetltlm rlu p (0trtrircoo1fp e uvo t0t2umir nu1ol n nctls)arum(mp;u1apen i3ildls2umnmo;u4 rtomf3tytoate neols0tetmxo iy4opeelncsat)srtr( pnt1altomfciltla2rauvp t)teermfciatlm eanes ()setrxm oo4llteliesa(f 2ta(ronu1ape  oeiatfs rln o u0 leoif io1lmD lieo s)srtoir nydam elivta( srra( o;u4teto fetls mDeaums;() rxrmrctydfaDr uvilt  etmxo3oy4olt mfeta(  2uax  nt4tpen ictad m rmnms (0 etnxo3oadlptelneilt0t2toxmpiudom elfesa()s2um(mpou1tpx iociadls2rmumo;(4 rerxf oydla  au o t)tetr(mpou1ope  neils)sDurx ono0tleo oetlslaDeaumpn() lxomr iytfatrliei;s)srtr(r ou4lle mivslt)a2um(root0oet mociyd a2eanmpnu4tltnmo3ty1la  aiei;() etmir iodole mnct sfsDur(mpnu1apx iietysla2emu p t0teenircto1lpD  uvs t)srumimpnu1lme lfvsls sDrr( oou0olx micilsfm2ea( snt) exrmr oodlp eaivo;( trxr(mpio4optnlieias  rrrxronu0aet  o3iytfaDeauvo;() exrmfcoodfm  lnvslt)trurxrpiy4ll n ncsl() Dum( p;t1oexomiciasls ulums t4aeeoxr3tytlaDraieo;s0t2trxr3oo1apeemnesls)aDtmurono4tpxo fciat m umump t)tetnmf3iytfa e uesls)trum(rpiydlme mnetat  Dtrx ooo4alxo feils s2rlnvp ()aeerxf ta1omDe uesls0srtmir no4lmenlictltf rrrurp;t0teeoiiciytlmDrm(ms;()aeenifcoytoat lnei s setmxr iu4ll e fvt t aDumumpoo1tpen icilsfm ranvsn(0 eenxfcoatlpD  neo;s)s2xrimpiu1lpen fetasfaDtaumo;o4opto f3tatfaDemumsnt) lxoxocia1lmtrauvol(0teumxm3oydlm e ieiat)s2tm(mpoo0olxn o3tydlm ulnms (0teeoxo oodopD livo;t teum(o io4lp   iesas)a2ta(  ou4apeniietltfmDem(msn()teenxr tadlpte ues;s sexriopoy1aleemnesl()s2ururp;t1texnif3iasfa uaumo;t0altoio iytlm r ieo;t) etmxm3no4op n fvilsfsrrrurpnu1opxnioctldfsDemnvp;t)aeerir3tatlaDr u o ()seur(o3oo1lmt mnei s s2umur ;u4oltomoeild a raumo (0tetoxf3iydlaD  neol()trumxr iu4olenmfvsa()arrm(mo;o1olxoifciatfs2emn pnu)trtomr3oo1la eln o;t)s2urir3oydlleelfctas  Dua(rp;o4opxoiieiadfaDemuvpnu)trenmr oytomt lueilt0tetm(o3io4amtnmnvia( srum( oou4tlt iieiadla uanvp t4 exnxo iatfpt  uvolt  2trxo3oy1lmeemnvil(  Dua(ront1tpeniieilt sDemuvpnu0 rtoio io1lp r i sl() 2tm(o oudamenlivi sfaDum( oot1tptnmfctadla2elu s (0tlxnmf3tadlmteai slt)setm(m nodllenmncias aDtm(  ot4oet mfetadls uauvs;() ltrio3ia1lmteanvo;t texrimpio4oleelivt sf Dtmxrpnt4olt ii3iadls2uaump;(4teeomo3oa1omtr ies;t  rtrxrpnudop e fvil(f 2uaumoot1apxomfciltls rmums;t4tetrircoadla elu ol( trtr(mpou4omenlnctltf rtru  ot0oeto ocilt m2ra(mo (4 rtomo oo1op raivs;( trumio3ou1omt mfvs s) ruaurp;o0oee if3tydfmDea(vpnt0aleoxf3iotoa  livol()tetrxopiudlptemivtlt sDtax  ;o0aeenioctadfs el(ms u4tetnmf ootoptrauvs;()t2to(r iy4ale mivsatf 2tr(  ;u0tpeo f3iys m ul(mp;t0 etnio ia1fpteaieils setmim no4ome mivsltfsrrr(r ;t4ope mfeiydfm2eanms u0 etnir3oytlmte u i ( t2uo(m no4aleelivtlt) Drr(r ;t0tet ioetadfaDumnvs t)aexrxf3oytfm rlneo s)teumim ny4lmtelfesat)sruax ooo0olxoiociytla2eaumonu) lxrxo tatomt aivil(  ruoxopou4alt lnetas) Dumu ont4oltoioetls aDumn s;u4 etrxo iy1laDrln olt0seto(m ou1olte nvs s s2trum ;o0oet  f3ilsfm ulu ont) rtnxr3oatlpt li s t)t2umxopnodlp elivsl(fa2tmumpnu0teto oeiysfaDuau o u0 etrmo3ootlp r ivolt0 2um(opnodal   icil()artau  ;u1tet mfeild m elu pn(4texoif ootfa   uvi ( srur(m ou4lm e fesas sDrmumpnu1tetomo3tydla2emumon(4alxnmfctotom  au o;t0 exoxm iy4ll nmfvtasfsDua( ono4aex mieiytfs2eanvs t4teeriocoodlm  lnvslt) rxrir3nu4lpee nvsl(fs2tmurpot1optniocilslm2rlumsnu)artriociatlaD lneilt  2tm(o3iu1al n fet s  Dua(mo;o4openio3tadlm2uanmp (4 rxrmociotoate u o;s) rxrxmpiudlle  nvtat aDtrur nt1open iciltfs uanvp;(0texrif3iydlmtelnvslt) euoio3oodllenlfes ()s2umxmo;o1tetomoeiasfaDrauvp u4tetomo oadlmtr u s ( trtoir nu1op nlivsa(fsrrr(m ot0aeeo f3ild s uln s u4tltnmo3todfmt anvs s)srurxo3oudalte ict s)a2ua(mpoo0texoio3iasfmDrl(mont4alerio3to1lm r iei;s  rtoxo3oudolenlivtls  rrm(r nt0opxo fciltls el(mpnt)trtnio iadfaD ln il() rxm(r iu1apte nes ()arra(m nt4oetomfeiytfm2ulu s;t4aleoif3iy1la e i s t0srxmiopiu1alt mnetlt) 2uax ooo0aleoiictyd a ea(vs u0aeeoxf3oytomt au ils sexoio3io4lmen fvtas s2rrxrpot4tpen ociyd m2umn onu4tltnxfcty1opteau sls)seur(rpno4lpt  nei ()a2umxm ot1tlxnifcils mDulumsnu0arenmr3oo1late uvo;s0trtrxm iy4olen fcias) 2rrxmo;o1teenmfciltlm2rmumo t)artomf3oydla eaueol(0t2to(o3nodlmt  nci tfs2ta( p;t4altn oetasfa eanmpn()alenif3oatlmDelneilt0 euoxr iu1llenmnvs tfsrtau p;o0olx mfctadla rmu p;t)aetnif totfmtrlies;s0trxr(m nu4lltnlfeias) rua(rp;o1ope mf3ilsfa2ulumo;t)tltoxf iodfaDe uvilt) ruoir iu4ll  lfctls)a2rrxmpnu0alen i3tadlmDrm(vsn() rerxo3ia1omD  uvs;s0 eurxopio1am  lieia( aruaxro;o0tlx mo3iat s rlumsn(4teeoxf ta1fmtran i;t0t2trxrpou4lm  miesasfs2tax  no4opx  i3iytfa uanmp t) rxoio3iodlmDraneols0tetrxo3iy4lpte ncs t aDrr(mpot4tlx  i3iltfs2umnvo u0tlxnif3todfmtelnei () etoirpio4aptnmfesa(  Dra( p;t1tptnmfctyt m2ulu o t4tltnio3totlmDranesls0tetmim oudome  iet (f 2tru  nt4tpx ioetad a2uanmpnu)arermfcoydom r iei (0sruoir ny4opeemnvias)s2tau p;o0olenio3iat m ra(vsn(4 etrif to1lp   u ol(  eum(rpio1omtnmfciat  2ur(root0optomicildlm2rm( s ()tltoio3ia1fpte n o;s  eumim3ou4olte nviat aDur(  no0alxo i3iltla2rm(vs (0aexrio3io1lmt aivi ()setm(r3nydol nlncia(fsrtm(mpnt0tltnmocilsls rmums;t0texoif oatfa  lieilt0 2umxr oo4lle  feiat) 2umx  no0olenmi3tas s2ulu p;()texomoctytoptr uvs ( s2xrio ou4apen ics sfsrrmur nu4tlx ii3tat s2em( s;u4trxrxf oytlmteaneils) rxo(r3nydllenmnctlt  Dtmum ;t4alenmfciytfm2uan p;t4tlxrxf3io1om elies s  eurxopnodal  mivilsf rtmumpoo4oetomiciatfm ulu p t) ltoif iadoaDrau i;s0teumxr ny1lpe mietasfsDrrx  ;t0teen oeias aDea(vo;(0 rxomf3oytlpteaieilt)trxo(o3iu1aptnlivs ()sDuaum no0tptnmo3ias a2rl( s (0 exoir3iotomDrlivi s  rtoirpno1al e ivia( aDrrurp;o0aetn fcilt s2uau onu)alxoifciotfaDeanesl( t2uo(m3nu1om e fvta() 2um(ro;t4tlx iictaslm2rluvo;(4 rxnxrciytlat  uvi;s0 2uoiopnu4altemivsas)srtaum nu4open oetltlmDuaumo;(4 rtrxf oa1omDeauvs t texo(r3nydolen fvsas sDta(mp;t1alxnmi3iysfm2rmnvs t4 leoxr tytfm r nvo s0 etmir3oudol emiviatfartau  ;u0aee moeias a2ean pnu4texnmfctatopt luesl()trtmxm nodam nmnvi s sDrrumooo1tlt  ociysfsDeauvp u) rxrif oo1laD auei s0tetrim io4ol  mfes t)aDrmx  ;u1tlx mf3ildlaDuan s;u4trtnxociotomDrlueo;()t2xr(m3nodlp  mfcsls a2umu ont4opx moeiys m rm(ms;u0teermrciy1opDranvs t)teurio3no4lptnlfvt s) Drru p;u4olxomoeiyd s2ra(vs t) exoio oodla r uvil() 2uo(r nu4apte feil( aDrm( o;o1ope ifeiltfs ul(msnu)trtnxf3todlpD  ivs;s  rxo(m nudlltemfei t s2umu  nt1openifcias mDuanvs;(0aetnifciy1oa raneilt0srxr(m3oy1apee ivils sDua(  ou0aeto ieildlm rlu o;()alerxfcio1late ieil( texo(r3ou1lp nmnciasfs2rmu  ;t4ape  icilslm emuvp;t)arxnxr tadlp  lu i s)srtrxm3iodal e ivtas  2rr( oot1apenii3tyt s2umn p;t) rtoir3todoat auei ( trur(r3iodapt mnvt (fs2ua(ro;o4alt iieiys s2emn p;u4alxrxocia1fptranvi t sexoxmpnu4amt mnesa(fs2trxm no4olx mfetad a ea(mo t)alxnircty1lpt lueo;()trum(mpny4alt miesa(fs2taxm ot1ole mf3tatlm2rm(vs;t0artrif3to1oa  auvs t)srurir nydale lnviatfarrm(moot0opxo o3tad mDraums;u0aeeoxr iytlm e nvs;t0t2trirpoodlptn nvsatf rtr( onu1optnmoetysfa2ea(ms t4 rerio iatfp  anei;( srtoxmpiu1llt  ncils)sDum( p;t0apeomieildla2ulu p;u) ltoio oydlp  ln o;t setmxmpoydll n iet s)srum(  ;t0oltn o3iat a ra(vsnu0 etnmfcta1optrai s;s) rxrir iudamtnmnvilsf 2urx oou4oexn oetadfm2ra( o u4 exnxf3iodfaD aues (0 2ur(m iudomee ivs s)arrmum nt0tlxoioeiys a ul( snu0aexnmf3oy1oaD an s;t s2xr(o ny1amtemicia(  Dtru ont1olen ocildlm2uau s;u) etoxo3iadfpD lueo;s0 rurim no4aleelfetat aDraxmo;u4opeomoctydlsDraump;u)aexrxfctatlmtrluei;t0s2um(mpny4om  micta( sDrm(m oo4tpeniicild m rmnms t)aexoio oydopt lnei;t)s2umir oodomt  icsat sDtaum ;t4alx moctys a2umu pnu4aexomr oodfp   i il()s2um(rpno4ameemnvt (fsruau p;t0aexoif3tys s ua( p (4 eermfcoodfaDrli s;(0setmir iu1ll  livsasfarrrump;t1tltoif3iys s2ra( s t0arerio to1lpD  u olt srxoxm iodomtemnvt ()artaxmpot1aet mi3tydfmDuauvs ()alxnmr3tatlmtr ivs;s srtoio3ny1ol   icia() rrmxmpnt0alto i3tyt sDrm(monu)tlxoxo ta1fatelivi s)t2uoxrpio1opt mfci t)srua(m ou0tpe ifeiys s2eluvont0 ltoxrcoy1opt  iei;()trtrir3nydope  nciltf ruax  ;t1oee  ociys mDul( p t4aexnio3oa1omte n o (0 2tmxo oy1altn nct (  2rau ono4alt mfciytfm rau s;t0 rxrir oydfpDeli sl()t2tm(r3oudlpeelncs tfaDtm(mo;t0olx mf3iysla ua( s;t)tleoio3oodoaD luvolt0t2xoxm3iu1ll  livt sfaDumxr nt1apx  iciad s umu sn(4arxomo oytla eaivs;s) euoxmpiu4altelfcslsfs2ur(m no0oeen iciadfs rm(mp u4arxomf3iytfmDeli o;t srtrim3ny1ol   fcil(faDuaxr ou0aeto oeiatfm2ea( snu) rxnir3oatlmDr i s;s)trum(m3nydopen nvtl()s2ra(m ;o4olxn o3ilt s uluvonu0 lxrmfciydfa  aivs t) rtmio oy4omt lnvt sfsrtr(root0alenioeiltfa2uanvpnt0trtrio oy1fmDeln i;s trur(o nudlpe  fvslt)aDtr(m no4ale iictld a ra(vo;u4aetoiociotfpDr ivi;( srur(o3iudoptemnvtl(farumx ooo0texnio3tyslm ulnmon(4tltoifciytlaDr i i;s0srtrxm oo1ll n ivilt s2ra(m ;u0olx mf3ilslm uaums u4arxnxr iytoat  nvo;t0teum(r oo4alenmiesl(f 2rauront1tle mociyslmDrluvon() etrmr iydlp  an s s s2uoxm3io1lm  mfcia(  Draumpnt4apx  fctat s2em(mo;u0 eeomo todfptr u ols0texmim3nu4am e fei sfaDtrx  ;t0aetomfciytlm rmu pn(0tltrir3oy1fpte uvol(0seumxmpoy4alee netl(fsDrrumo;o0aexoif3tat mDulu onu0 eenmo ty1fat lnvs;s0seumiopoo1oleelfes t)arrmx ont1teto ieiatlaDra(vs ()aexrxocta1fa rlueo;() etriopiu4llt lfeil(  2umx oou1tlt ioeiltfsDeluvsnt)trtnxf ta1lpD lu i;t) 2tr(opoodam  mfctlt) Dtrur ;u0olenmfetyd s emnvsnt0 exoif3ty1fatrlueols0srtoio no4ale  fetlsfsrtmum ;u1aeeoifctadfmDum( s (0tltnmf totoatr nvi s t2xr(r3iu4ll n ivtas) 2rrxm ;t1tpxo oeiatlm uan pn() reoxr iydfpteauvi () etmimpiy4al elnetas)aDrmu  nt4aexnmoctlsla2emnms;(4 rxrmr3io1om  lnei t srur(r iydol nlfei ( artaumo;t1ole mo3iytla rlnvs () lxnio3oa1fm rlu o;t setoxo iu1ole mnct t) Dua( o;u1altomi3ilt a2uan s t4 lermf3tadlp e uvo;t)srxm(r3iudal nlncs t  2ua(ro;t0aeenifetltfaDeau ont)alxoxf iodomDr ieo;t0 eumio3io4ap emfeia(f 2uau ooo4tlt ii3ilsfmDua(mo;t) lxnmo3oytfm eaivilt0 etr(o3oo4lptemieilsf rtr(rpou1aet mo3tydfm2emn s;t)altnir3ty1fm  aieil(0 rxm(o io1ll nmfcilt a2raxmpno0aetoio3ilt s ea( pnu4 reoiocoo1faDe ieo s0 etm(m no4omt lfcsa(  2urumo;u4aeen ieiltfs el(mp;t0alerxfcta1opDelivil()trxo(mpnu1ameelicslsfsrtrxro;u4apeo ieilt aDrln p (0aeeomo tydoaDeli i s s2xoiopiu4altelivsas arumur oo1tpenmieiyt m rmuvpnu0treomfcio1lpt  n i s trtoio3iydll n fesl( s2ra(mpoo0olto ictyt sDraumsn()aexoif oytoa  lnvi ()sexo(o nu4oleelfetltf Dumx  no0oltnif3tyd m2rm(mpnu0texoio3ia1op  ai i ()s2xo(r3no4amtelfvt ()srtauroot1aeen ieilsfm2emuvs;t0 lenifciytfpD aneols0t2xm(r iu4ap emneiltfa2tr(mp;o4opx ifcilt s rln o;t0alenmr tydoaDe n o;(0t2toim3nodapte ics (f 2uaxmpnu4tlx ioctadlsDea(vonu4aeenxf iatom rli o t) 2umio3iydll elnvsls s2ua(rp;o0tetoiieias aDrmu p (4trerif3iy1fate i s;( srxrxopiu4omtn nciatf 2tmxroot0tpxo ictatlm uauvo;u4 lxnif tydfaDe ueilt0sexoxrpiodop emivt t)arrmu o;o0optn ictas s rm( s;u) rtrio3iydlm rli sl()srtmiopiy4ll  lneils sDraurpoo4tpx  ieiad sDrl(mo u)altrmrctodfp  luvi;s s2tmxmpoy1lpte fvt ()sDuau  nt4tlxnmociadlsDum( p;t)aexrif tydfat  nvs;s seto(opoy1optnmfesls)a2rr(mpnu0tpxo o3tytla2umu s;t)teeoif ta1fatelieols  rtmxm3iu1opt livia( a2ua(  ;o0oexnmfeiysfmDra(mp;u0alxrifctodoat aieo;t t2xmimpou4aptn ncslt)sDumxr ou1teenifeiad s2eanmpn(0altrif3oatoa rln i ( trtmxr iudapen icsl()sruau  ou4oet  iciasls2eaumo;(0aeenxr3oo1opDr ues;() euoiopny1lm nmfetls)s2ua( ono0tpx mieiadfsDrmu onu)trtoxfcto1op eln ol(0sexoir3io1al nlfvsl(fsrraxrono0aetn fetlt s2ua( pnt0 lxomr3oa1latrli i s)teto(r iydam e fvtatfaDra(ro;t4alen i3ils s2ua(mp;(0areoifctytfm e nei s truo(rpiy1lp elnvtas artr(r ou0apenmo3ild m rlu onu)trenxfcoa1faD lieilt0trur(r iy1lle mfetltf rtmu p;u4aptoifctat aDeaumsnt4altoif3ta1fateauvs;t)s2um(mpny1ap nmivi (f 2uaum nt0ale moetadfm eauvs t)trerir ta1fmDeaneo (0seuoim ny4am   ics t  ruru ooo0opeo o3iltfm ul( o t4trxoiocio1lp ranvi;t srxrir ou1al n fetltfs2ur(mpot0teeomiciadfmDum(vs u4trxnmr3oo1faDean o;(0s2to(m no1olt lnvsl()srta(mpou1olxn o3tltlm2ulnvs;()arxoxr todfp rlu o;s srxmxr oydope  nvils artmxrpoo1tleo iciyslaDraumsn()areoif3iotom ranes;t  2tmim ou4lmtemnes (  ruru  no0tetomieiad a em( o ()tltrxr oadfpDr ivs;(0s2um(o3nydol nmnvt () Dtm( ont1apenmocilt a eanvp ()trerir3oy1omDelueo;()teumxopio1ll  lfcsatfs2uaum ou1texnii3iydlm2ranvo;()tlxnxocoytlpDraneo;( setmxrpiodomtemnvta( aDur(mono1ole  ociasla rmn s;t)aetnio3tytlatrluei t0 rumiopnudom e neias)s2rauro;t4aptnmfciatfm elu s;u4 exrxo3iotfp eluei;s)texo(r3oodllenmicilt)aDua( oou1tptn f3iys m2umump t0arxoircoatfptean il(  ruoxm oy4oleemnct sf rrm(  ;t0teeomoctyd a rauvp t)aetnio iytomDe nvo s)teurxr no1ll  mfcil( aDtmumoot0olx mfctys s ulu on(4arenmrcoy1fmte ivi;(  exoxo ou1lpte iesatfs2ta(r nu0teenmiciydls emnmo;u0 rtoxocootomt aivslt) 2umxopno1lpenmfvt t)sDtr(ront4olxoioetysfaDrlump;u4texnxo iydlmD  uvs;t  2tr(r3ou1ape  ivtl(fsrrmu  nu0tle mf3tld m2uauvpnt4 rtnmo iodfmDraivslt)trtrxr3iydomtnmnetlt)srtrxmono1aetomoetydfsDrl( p;t0areomo3tytom   n i;s)teurim oydoltnlfciltfsrrm(m oo0apxn i3iatlm2em(msnu)tltnxfcto1latelneo t)trumir3nodoptn ieil(fsDua(  ;u1alxn octydfs um( snu4tetomf3oa1fptelivs ()t2uoxo3oy4lm nlnvsls) ruau p;o0oexnmoctys mDumnmo u0alxoxoctotoaDe uvo;t s2xo(opiudap  lfcsas) rrr( o;u1oex mi3iaslsDulums;()arxrxo tadfm rli ols) rur(o ou4oleelivs tfsDta(r ;u1apen o3iydlm2uauvs t4 rxoxf3to1la rln s t0 2trxo3no4lpenmictas)sDrax  ;t1olxn ictlt s2elnmp t) leriociatop  aivs;( teurim io4am   fvilsfaDumxrpot1aee  ociatfs ulumpn(0aeermocoadom r n olt) eum(m iy1lptemfvsl()artm( onu1ope  ieiysfmDemuvo;(0tetomo3totfptr nesl(0 2urim3oy4lm   netasfaDrrumpnu1oeeoio3iatfs2rmnvp;u)trenir3ootomt luvs ()sexm(mpnudoleelfeilt s2ua(mp;o4oetnif3ias mDumnvo;t)treoif3ty1opt ln o;t) rtoxm3oy1lle  feilsfsrtm(mp;t1tleomf3ild s emn on(4artrif3ootfp ranes;()s2umxr3oydameelies sf 2raurpoo0olt  fciydfs2ra(vo t)tlerif iydopt ai ol( sexm(r3io1amen ncias)aDtau p;u1opeo oetytla ranmp t) ltnif3oytomDelnvsls)sexo(m3nu4al  mnvia()artmuro;t1opto ieildfs ul(mo (0 rxoxocoa1oa rai il(0tetmiopiodllen nvi (  Dtmumont1tltomoeiytfa rmump;(0arenircoadfaDr nvols truoim iydoltnmfct s  rrrx o;t0apen feiatla eanvp;t4 etrio3ootfmt an i;(0trtoim3ny1om  mncta( sDrmumonu4apxn octldfaDean o (4 lxoxf tydfmtrlneo;t0 2xrir io1ome  icsls) 2tr(m ;o1tltn feiatfm umnvsn(4altomo oytfa   i s t0s2urimpoodopenmivsas)sDrm( pot1aptomieiadla2rluvonu4trxrmfciadfm   uvilt) euoim oy4op   nciat) rur(root0olenioeiatfs2em(vp;u4 etnmo totlate ues t  rxm(m ou1lmeemietls aDraurpot1tlx  ictatls2rm( p;t0 lxnio3oo1omt  i s t)trxrir io4aptnlfeiat aDtaxm ot4tpeoiiciytfa el(mont) leoif oy1latelivo;t0 2xm(o iy1al nmfvi s)sDrr(mpou1aptniiciytfmDumn o u0teermrcta1oa  li i;s)texoxo oy1oltemivsa()srtr(mpno4tpxnmoctad aDelnmsnt4aeenmociatlaDr n o ()tetr(m3oydamenlnvsatf Dua(moou0opeo o3iadfa em(vpnt4tlxoio oodomtelu s;() 2umirpou1lm e iei s a2ra(moou1aetnmo3ilsfm2rluvp;u4aeenmfciydoaD lueo ( teuoiopny1omtnmncsl( a2raurpnu4tpto iciys s2ra(msnu0treoifcia1faDrlu o s)teumio no1am emieils)sDrmump;u4olx ii3iytfmDuau snt0 exrmo tytop ran s;( trxoxopou4ll elnvsa()sDrm(mpot4optn oeilsfmDuau p t0trtomocoy1lmtrai s;s) 2tr(rpoo4om emfct (  rumu ooo4alenmociltls emn p;(4tltnxf3iytfp e u i;t  rurim io4lm   nctat)sDtax pnt0tptnmietyd s2rmu p;()aetrxfcoytfm  aues (  exrxo oy1lmt mfci (fsrtmurpnu4tlen ieiltlm2rau pnt)tltrxf iatlptrln i s0tetrirpoy4apen fvtas sDraxmono1apx moetyd mDeaumo u4trtnif3ootomD  ueo;s s2ur(m iodol nlncil( s2rrumono4ole io3ilsfs2rlnvo t) lxoir oydlmt aieo;s0 2trxr3io1omeemnctl( a2ra(m no0apenioetydfs uaumpnu4arenmf3todoaD ai i t trum(opnu4ole mnctas)sDum(mo;o1tlx  fctysfa2em( snu0aetrmo oa1opD  nvo;s0t2uoio oydameemfviasfa2tax  ;t4tpx ifetadfs raums;u)trxnxr3to1fmDeai o;()seurim3oydll emfvsls  Dtaur oo0tpx mfeiadlm umn s;u4aexrmociy1oaD au olt) euoio iu4lmenlnesas a2urxrpnt4olt iociys mDuluvsn(4texnmr3oytoaDeai i;t)trtoiopou1am elictls)sDurxm ou0oeeo o3tltfa2el( s;(0tltoioctatoaDe uvsls0srxo(r3nydaleemfcsat)arra( ont4tleoiieiys m2emuvs u4artrmrcoy1fm  aneols) 2tmirpnu1llt lfvsl(f 2um( o;o4alxniociyt aDel( o u0texoxr3iytoaDe uvs s0srtmim3nydal  mfvtlt a2umur ;t4tptoif3iytfa2rm( s (4tlxomo3oytlmt anvils0 exmxr iudalenlics tfs2rru poo0aetn fetasls2eluvp (0areoif ta1laDeaiei t0 rum(m oodomtelietlsf rrmxroou1aeen ictydfaDrmumpn(0aetrmoctydop eln i (0tetriopno1lptn ictltfaDra(rpnu4opxnioeiltlmDulnvs;t0 exnxf3totfmD lu o;t t2tm(o3ny4ome  nci t s2rau onu0oexomo3tlsls ua( o;u4aeermf to1laD  n s;t0 exmxr ny1ale mies s srta(mpoo0tpt ii3iytfm uanvo ()alxnmf tytlpD ai s;(0trtmxm3no4ope lncsa()s2rmu  ou0aee  o3iytls eauvsnu4 rtrxf io1fmteli ils)srtrxr ou4optelictatfaDuaxm nt4teeniictltlm elu s;() ltoio3iatoaDrauvs t t2uoxopiudalt livia(fsDtmurpoo0aeto ietlsfm rln p;t4 exoxf3ty1lmt lnvolt0t2toxmpiy1lmtnmnvtl()aDta(mp;t4tpxoiociatla2em(mo;()texomf iatop  aueilt)s2umxmpnu1olte ies s aDtmumont0tltnif3iadfsDem(ms;u) eeoxo tytla   ivo;t0 exm(r ny1op e fcias)sDum(rpnu4oet  i3tlslm2rmump;u) exrxfcoo1lm raueslt0trxo(rpoo4ope lfcils  2ur(mp;t1aeeo o3iaslsDuln on(0altoxr oy1lpt  ueslt0 rurxo3nydameemnetl( a2urum ;u1tet ii3iytfmDuan p (4 renmo oadfm   n olt) rto(o3no1ll nlfvtas)sDumur oo4olenmfeildfm2ua(ms u4 rtomrcto1lmDe nvo;(0 2tmimpoy1am e ncslt)aDur(m ;u1olxomf3iasfm2uanmpn(4aetnirctodlaDe uvi s seuoxo3iudalte ies s aDum( oot1ole  octad m umn p t0teerxo oadopte uvo;(0t2xr(rpoy1am n fvtat) Dum(mooo1opxoiictydla2emnvs;(0aeeomo oa1fp eau o ()seto(o no4optn ieils  2um(mpot1tpt  ieias a2umnmonu4tetrxf iatoptrluei s) exr(o3iodame lfvs s)s2tm(mpoo4altnio3tldls ul(vo u0texrxrciy1oatran s t) exoxr nu1lmte fvi ()srurx  ot1altnioetyd aDean snt4 etnxfcta1lmD auei s0 rxmxm3oo1ameelieslsf 2tauro;u4apxo i3iadls emnvo;t0trxoxo iydfatranei ()srtrim3nu1om nlfcta()a2umx poo1tex  fcildfmDemnvs;() lxrxr oytfp e i sl(  2trxrpnydlpte fet s) 2rmurpot0ole ifetyslm ua(monu4 exrio oytoat  u ils)trxo(opnu4om nlivils)a2umum ;o1oeen o3tadlsDuanmo;u0altrif3oadlpt aivo t texm(r io4oleemicil(fa2rmxm oo4ole mfetlt m2eauvs;u0alxoxrcty1fa eai o;s)srxmio3iu1ameemfvtlt aDtauroot0apxoifciydfs uln snu4arxoxo3tatlmt aies t  rtoiopio1lme  ivtlt  2urumpnt4optomo3iysfa ulu p t0altrxr3oy1lat li s;t)trxriopnudome mncsas)sDrrxmo;u0optn ociyd a2eluvonu4 eenir3iadopteau o t)tetrimpou1ll nlnci t s2rauroot4texnio3iadfm2uan on(0trtoxoctotoaDelueo;s)s2um(o3ou1amtemietas  rtau  nu0optn ociatla rmu pn(0aeeomo3iatla   i i t)seurxr3no4altemfcil(  2taxroou1ape io3tyd s ra( o;u0 etnio3iadlmDeluvi t s2xrxrpou4ape lncias s2tru o;t0tleomictatla2umn p ()tleomo3oy1fmDrli s s0 2xrir ou4omte fct ( sDtrxrpno4aleo iciydls2uaums;u4teenif3tytfpt lies () rtm(o3nu4apeemfviat arrmxmpoo1aptnioctytla elnmsnu0 lenmr oa1fpDelu i;t0sexr(o oo4lp nlivtls sDuau p;o1teto fctltfa2ul(vs;() ltrmo ootfmte i ilt)t2xmir iodoltnmnci sf Dtrx oou0ope ii3iltls2ulump ()trerxo tatfm  lnei t  rtr(rpno4om  lnei tfsrurx o;t4apenmoctyd m2ulnmo u4trxrmr iodopteanvi (0 exm(r no1lmtn fctatfs2tmur nu1olxnioetltls2elums t4tlermf3iytomD  ieo;t0 2xrio io1om  mfvs tf 2rru  ou1aetnmfciasfsDumuvpnt0teermoctytlpD  ivo;s0srxmxo iudlpt  nvi ()aruaum nu1aex  ieilt s2raump (4teenmo iytlm r ueo (  exm(o3no1ol elfci (fa2tr(r nt1aleomoetytlaDumnvs;u0trxoxo oytlpD  uesl() 2toxm3io1lme lfetatf Draxrono0texoiietatla rm(msnu4aeenmfctodfptrai o;s)t2toxm oudlle  fvias)arra( onu4tex  ieilsfm2rm(msnu4treomr tydomDeauei;s)teto(m3ny4ll e fei ( aDraxr ;u4oet  o3iasla2uanmont) lxrif iadfatr ivs;t) 2uoim iydale mnctas s2rm( p;t0apx mo3iasfm emnvsn(4trenmocoodop rlieo;() exoxmpou1lleemivta(  Dtrx  nt1alxn f3tltla umuvo (4artrxo3oo1om eauei (0setoir3oudamt mnvt t aDua( p;u1oleomictldla eluvp u0arxnif ia1lmt auvi ( trurir3iy1optemfcs t sDrr( o;u4oexomociltlsDul(vpnt)tleoxr3tydop eaieslt0 eumxo3iu1oltnmfvta()s2rr( pno4oeeoii3iadls umn o ()aetoxo3ta1la rlnei;s0 eumim iy1openlivslt)sDur(rp;t0tleo f3tytls ea(msnt0 rxrifciytom elnvs (0seuo(rpiy4amenlfci s a2ur( p;t4opxnio3ilt aDua( p;t) rtrio3iadoa  anvo;(0 rtoir ny1amee fvtl(fsDtr( o;t1apxnif3ilt s ua(mpnt4artnircoa1fpt aivo;( trum(o3nydopeemfvtls  rtrxr nu1oltnii3iltls eluvo u4 etrxfcoodom eliei;t)s2tmio3nu4lmte icsat  Dtaxmpoo0tlt mi3iasfsDuan p;u4altrmo3tytlmteln o;( s2umirpnodll  mnei (fsrrrxr ;u0tetomo3iadfs2rln s;u) rermo3totfm  au o s0 2umxopoodol  lfeiltf 2ua(  ;u4opx mi3iatfaDuluvs u)aexrmf to1fmtrlivs t0s2toio3nudlpe mfetat  2tr( pno0oexomf3iltlsDumu pn(4trerxrctytfat  ieo;s)s2tmim3io4olenlfcsa(f rumurpno1oexomietysfa el(mo;u)trtomr3iy1lmD an o;t0 eumxm3iodomenliviatfaDrmum nt4olxn f3tydfa2rmump;t4areoxfciytlp  aivs ()seumio nu4om nmiesas  2rmx o;o4olxnmf3tasfm2um(vsnu0trxrxo3todoat lu ilt seurim3ny4om  mivt (fa2ur(ro;t4tpenmfciasfa uau p u0aexrmrcoodfa  lneo;()s2toim3oy1ol   fcsas)sDra( ooo0apxomocilsfm rl(mon(0texomo tatomtr nvi;s trxo(r3oy1apeelnvs s arumx pot0apeo ieias sDem( o u)trxrmf3oytoaD lieolt0t2toim oodll n netl(  2trxrp;u0oet  f3ildla2rm(vo;u)teeoxfctodfp e u s;() etoxo iodap nmics ( s2ra(  oo4altomi3iys m2raump u0 rtnmf totfmDe iesls0teuoimpiu4al n ivilsf 2urxrp;u0oet io3iltlm2rmu snu4aetrmo3oydomt lu i;s)s2toio3oodole lnetasf 2tmumpno1aet  ieiysfa um(vo t0 lenif tydlmDelnvol( srumir3oy1lle  nesl() 2rmx  nt1aexo f3tltfmDel(vonu0trxrmocto1lpDe i ols)t2tr(r oodlmt miesa(f 2ra(mp;t4oltomieiasla uaumsnu0teeomocia1fa eau olt0teuoxm ou1omt liesl() rrauro;u1oet  o3ildlm2eanvo u4trxnxo3to1op ran sl()s2xrxopoo1lpt mfesl(f rrr(rp;t1aexomietlt sDulumo;t4 ltomf oy1oatrluvo () eurxr nu1lle  nesl() Drm( o;t0altnmoctadfsDuanvpnu)texoir3iydop ean o;s) rtrio3oudaltemfet sfaDurxmont4oeeoii3iasla2umu pn(0tltrir ta1lp e ueilt) 2uoiopoy1ll nmieiat a2ur(  ;u0apeo o3iytfa rlumo t4altoxf ia1laDelu o s)trtmir3no1ll elneta( srtaxmp;o4tetoiociys mDea(vo;u)texoir3to1opt  ivsls srxoxrpoodlp n ivias)srrru o;o0tetoif3iat s2elnms;t0 lxrmo oytfaDean ilt s2tmxr3nu4lp n fetl()arur(moou0apt  oeiatfa2rmu sn(0aetnmr3to1optean o;( s2uoxr3oy1omtnlfvta(  rtrum oo1oetn o3iat mDrl(mo u)aexoxf to1lm  lieo (0s2xrio3oo1op nmncsls)sDtr(r ;u1tet  oeiyt mDrmnmp u4altnifciodlptr nvo;(0trtoirpno1apte fciasfarur(rpno1aet mi3iyd sDelu p t4 exrmrctodfaD lues;s) exmimpiu4olt mfctl(fsDrrx o;u4aexoioctat a eaump (0treomrcoydlmtelu i;t) 2xrxrpnu1ap n ici ()sDtr(mp;u0aee mocilsfs2emnmp u)texoxf3tydoaDrlnvo;()t2ur(o3oudop   fcslt srua(  ;o0tptoio3tatfs ean p t)arxrmf ty1om e nei ( t2xr(rpny1op nlnes t)sDuaxrpno4aleoioetldfsDean s u4 eenxr iatlmD  neo t  ruoirpoodol elfctlt s2taxm ;u0teto icildlmDuau o (0 lermfcoa1fptrau s;t t2xm(r iydomtnlfet ()a2urxmp;t1opt ioeiatls2um(vp;(0teeoir3io1lpDeln s;t t2xoxm3oy1omee ivia(fs2ra(r ;t1ape ioctadfa2rm(mp;t0 exrxfcio1la   neslt  2umxo oudom e ncsl(f rrmu p;u4opxo oeiyslmDelnvsnu)teenxfciytfatrluvils) rxr(r3no1om   net sfaruaxrp;u1tlt ifeild a uln o t) lxrio3tydfmDe n s (  etoxm3oudlmtn ivsls sDrrx ono0aeto f3iatfm2uauvs;() exoxf iytoaDr ueo;t texoimpoo1oltnlnvils srtaurpoo1olxoifciad sDra(vp t) ltomf3totomte i i;(0 rum(mpiu4lleelietlsfsrra( o;o1teeoii3taslm2umumo;u4areoio oa1opt au o;t)tetmir3iodolenmfvt t a2uau o;t0teenmfeilsfm2uauvp t)trtnmr3iadlpDrau i;t s2xrxm nu4al n fvsls aDta(mo;o0aleo ietatfa ulnvonu) lxnmf iatlptr iesl()s2xr(opno4op n nvil()a2ururo;u1texn ietasls umu o;u) etnmr3iodlmtrau s ( t2umxo3ou1lmee ieias)sDtmumoou1olt if3iatlsDeanvont4trxrirciatop rai il( sruo(mpno4aptelivsl() rra(mpoo1tet  feildfaDum(msn(0 eenmo3oo1lpDrau ilt  rxmxrpiy4lmtnlivsl(fsDrru  no0aee  iciatlsDua(mp (0tleomr3ta1laD  ivs;s  rtr(o nydolt mfesa(fsrumxmpou1opxnmicilslmDrln p;()texomf3totlptrli o t) rtmxm iudape  fetlsfsDumx pno0olxo feilt s rl(mpn(0 eeoif ta1oaDeai s s0 rtmxrpoy4omt  feiat)arra( p;t0tpxoif3ilslaDrm( o;()alermf iydoat aneil(0setmiopnu1opt mfvi ()s2raxrp;o0tptnio3iadfm ulnms;(4altrxr iadfpDrliei;s0texoio3oy1om   ieilt aDumu pot4altomi3ildfs2rm(msn(0 etomo3tydfpDrluei;(0srtrim nydoptnmncsas)a2tm( pno0tle ioeiytls eanmo;(0tlxnxo oodomt luvols0 exo(m iu4altnlfvsls arur(r ;o1tpxomoeiydls rlnvs;u)trtoxociotlmtraivo;s seuoxm ou4ole lictltfsDra(m ;t1apenmictat a emnmon()texrir3io1fm rluei t0trur(opoy4ameelnci s  rtmxrpoo4aexo fetlsls ranmsn(4 exnmo to1fm r i il(0truoxr oo1ll n icslt  2uaxr ot1alto f3tld m umuvsnt0tltriocta1oaDr ieo;t trur(r iy1ll  mfcias s2ur( ont0tlx ioctysfm2umumpnt)artnxo3oy1lmteln i;t t2xmim ou1olt  ivs () 2ururp;u4tpxn i3iltfm uanmp;()artrif3oytfa elivs;( s2um(m oydol  lneiasfarta(mpoo0tlto oetydls2elump t)areoxfciodopDeaivils)s2to(r oodame  nvtls) 2taxroou0tleomictld mDra(vs;t0trenio3tytfateaivslt s2urxm oy4olen net ( aDumxr ;u0alenmfeiasfm2rl(vpn(4 r
\ No newline at end of file
@@ -0,0 +1 @@
+nvs s) euoxopnu4al n neta( arrmx  nt0tpxo i3iytlm2ran o u4texrmocty1lm rlnvsl()trxr(rpiu1om nmfci sfsrurxmonu1tltomfciasfm ran o t)tlxnmf3oytla  ln i;( srurxm3oodllte fesatfsrrrxrp;t1aetnioeild mDrmn p;t)arerxr todfm  lueil( srxr(m3oudlp  miei t  rur(mp;t0aet ioeiydfaDel(ms;t0tleoxr ia1lm ranvi t0tetrxm iy4lmtnlictlt  rrm(  nt4aexomoeildlmDrm( s;(4arenmr3iatfaDelieil( sruo(r3oydapenlicslsfaDrax  nu4ale  ociyt s2elnmsnt4texrmr3oadfpD au sls)t2umim oudll n netlt) Dumxrpno0tetniictlslmDel( p t0 leoxo3io1oaD auei (0sexo(opnydomen iesa(farraurpnt4oltnmfciadfa elnms;u0 rerir iotfmDr u o (0 ruo(opoy4amenlnvs tfa2rmumpot4ope  ietasfa2rl(vs;t0teenif3totfm e n sls  2trxmpnydom nlfvils aruaumoot4alxo fetys a ra( o t)texoif3oo1la  luei t)s2toxo oy4aptn fviat) 2rmurpnt4olxo o3tysfs rlu p;u)aexrir oatlmD li o ()srurxo3iy4ale  icia()arur(ro;u1texnmfetysfsDrm( p ()aetnxr3totfat  ueo;s) rtmir ou4ol elivtat)a2uau  oo1ale iiciytfs2rl( o t0aeenif3oytfmDran s t0sexo(mpnudape lfvsat)aDtmxmpot1optnifeiydfsDeanvs t) etoxf totfptelnvols) 2xmxo3nodop nlnesatfaDum(rono0olxnmf3tyslmDuan sn(0trxrmf3oytop e i i;t  exrimpnodale mfct () rurx o;u1tpxnmo3tad mDul( s t0 etrxr tadom  anvsl(0srxm(mpoo4am nlnct sf rraur ot1teeoif3iatlmDemn s (0tlermf3oo1lptrli ils)trxo(r3oo1apenlivsl()aDtm( p;o4texnio3iydfm rauvo ()aexnmr iy1lm   iei ( trtoirpnudomenlfvi s srrmu  ;t0oet  oetls m rau p t)arxrif ia1lm r nvilt0 rtoxm nydlptnlivilt aDtmu pou0oleo feilsls2ea( p;()artoxr tatlptranvols) rtmio3iydam nlict (  2umxmont1tet  fetyt a eau s;t0 exnmr iydlatraivol(0trxoim ny1omtemfvtls  rtaumooo4aexnmo3iad s2umn pnt4 exoxr3oatoa   u s;t0t2xo(r ou4aleemfeta() rtmumpnu4aptniietaslmDrlnvp u)arxnmr3oatlptr nvi;t  exrio oy1amenmiviasf Drax  ou4tex ifciaslm2rlnvo;(0artnxr oatlm rln i;t  ruo(r oy4lp nmivi tfs2trxmono4apx mictyd a elums;t)tetoxo ia1lmtr u o (0sexoxmpiodllt  ivta()s2tmuro;u0tee  i3tlt m2uau p;u4trtrmr ty1lm  luvi s) euo(r3oydom nmict tfsrrrxmono1opto ictlt m eau p u4alxnmrcty1opDr ivo;()trur(r3oo4alt mivils sDtrxrpno0oltomoeiat sDrlu o;(4aexnxr3oydlp elnvsl( tetoiopny1op  lfvsasf 2rmu o;u0tle  icild sDumumpnu4trenir3iytfa   ies;() rurxr oo1ll  mfci (  rrau  ;o0oeeoii3iysfa2umnmp;t)alerir3iytfa rluvi;s)s2toim3nu4om nlncs sfs2rrxmont4ale if3iyt s elnvp (0 ltnxociatfmDrln i ()s2ur(r iu4lmeemfcs (fsrrrxmp;t4opxomi3tltfmDranvp;t0artoircoodop   i olt  2trir3ny1ole lfvi s  rtmurono4olenifeiadfa umnms t)tleoxfctadfp  an o t0tetmxr iodopen ietltfsrrm(m ot1aetn iciatfa2umnvo t4 rerif3iydoaDe uei s)t2tmiopnodam nlncil()srumu  no4oet iicildfs emnms t)teeoio3iytfa eli o s)t2xrxrpou4llte fes (fs2umxrpoo0opeoif3tydfm uanvp t4tlenxrcoy1laDe u i;(0t2umxmpoy1omtnlnct tfs2trumpno0tpx iicild sDumn s;(4 exomr3oodfp   neilt)srxrir3oydomtelivsas  ruau ono4oeenmf3tys s2rm( p (0trerir3tytopDrln olt0s2trxmpiu1ome mfciatf Dra( p;u1tptoiocildlm um(mo u)trxrmr to1opt livo s0teto(r3iy1ol  lfct t s2rm( p;t1optnioctysla2eluvo t)trtomo iy1lpD  neilt)trxoxmpnu4omenlici s) Drau poo4alxoifeiad m emn s t4trenircoo1omt lnvi t0s2umio io4lme  ivs ()srrmxrono4tlen iciadls ea(mo;u0 eerxr tydla e iei;t)t2xr(o nudoltelfvi sfsrumxr nt1ole  i3iad a uanms;u4artomocta1latr u ilt)srto(m3ny4altelfet t  rtrur oo1opxniiciys m2um(mo;t0arxnmrciadlm  livolt0s2toim3oudap n fvs (f Duaumono1tpto f3iaslmDumnmo;(0texrif iytfmDrlueslt sexmirpio1amt lnviat sDumu pot1oeeomo3tls sDua(mo (0alxoxr3oa1opD lueo s)t2tr(o ou1lltn nctl(f rumxm oo1aexn ociysfaDum(msnu0 rerxfcia1oa   n ol(0 etmir3oodope  ict (fartmxmpou4oee mo3iytfs ua(ms u) lxoir iy1fa r uvo;(  rtrxr oodlmtemnesa(  2tm(r ;o4apt  f3tlt a2emuvpnt4tltnir to1fptraivi;t)tetrio3no4ol  mfci tf Dumxmooo4tetomfetld a emuvpnu4areoxo3oydlmDelieol(0srtrio iy1ap elictl(f 2rr(mono1opxn o3tlslsDulumo u4alenxrcoo1fa raneols0 rxrxm io4oleemiesat)srtm( p;t1ole mietlsfa2uauvpn() lxnmr3iy1lm ranvs;t0 rxrxr3oo1aptnlicslt) Drrxm ;t1apenmo3iatfa rm(vsnu0teeomo oodoatelneo;(0setoxopnu4apt  ict s)s2taumoot4olto ieiadfsDeanvont)texrxocoa1optr neo;( seum(m nu4lm emietl(f Drrumooo0openmfeiltlaDelu p u0aeenxfcia1lpDraueils) 2xoxr iu4open fei ()srrmurpou4aleo f3iyt s rlnvo;u4teerif3tydfmt livo ( srxm(rpoy4al emfvsls  Dumxrpnt0oltoii3iaslsDul(vsnu)tlxnif3oodom eln ils t2xo(mpoydlmtn nctls)artau o;o1ope mieiydls2ea(vp () lerxf3totomtr nesls0texmim nodlpe lfeslsfs2tr( oou1aee mo3iasfmDuluvp;u)arxoxocty1omtr uvol(0seuoim3iy1ll emneils)srraumoou1tex iieilsls2umu s u0trtnmr tytlm e ivs t)sruriopiu1oltn nvs (farrr(rooo0alx ioetys s rmn o;(4aetomr tydop elneolt  rum(o io1ll nlnvsa(f 2tr(m nt0tpxnifeias s2umn p;t0texnmr oadfaDe i olt  exmxopnu1omt mfvtls)arumu poo1tet moetyt a el(mp (0aexrircoy1fa rlu s;() 2toim3iy4ol nlfctl(f ruau o;o4open i3iydfm2ua( s;u0 rtnif iadfm rai s;t0 rxoxm ou1olen icil() Dtr( pou1apeoiietlsfs2rmu p (0alxnmocoo1fm raieo ()trxm(mpou1amenmfvias)aDuau pou0apxn oeiltfs2elnvpnu)tetrmf ootlat lueo (0srtrxo ou1lptn nei s)a2rrurp;t4alenmo3iasfm2ua(vo;u0 exoir oo1omteli s t0truoir ny4lpee nesa(f Dra(ronu1tetnmi3tysfs eanvp;u0tlxnifctodlpt aivslt)t2xm(o iydopt  ivtls)aDtaxm no4aptnmieiatfm emnvpnt0 rxoio iodfat  i s () ruoir3oo4oltnlfvi t  Dtaum oo1tptnioeilsfm2ul( s u4 ltrxo tadla  an ols0 eurir nu1oltn fes (fartaurpot0oeeoio3iyd a ranmsn(4alxnxr io1opteau ils)setm(rpoudlm n nci tfsrtmxmonu1aexniieilsfa2rl(mo u0tetomocoy1opteaivolt) rurxm3nu4altnlivias) rurumpnt1tptoioetatls2rau s (0aeeoiociatla r nvs;(0tetmxrpou1olenlnctltfaDrr(r ;u0aexnmi3ils mDumu pnt0trxnir3iydfa  lnei;t)tetoio3iudlle lics (faDtrxr oo0oetniiciad m2eau s u0tetnirctatfptrli sls0trxrxm oy1omte iciasf Dtau ont4apeomfetlsls rmuvs;t) exnxo ootlmD luei;(0srur(mpoo4ameemivi s a2umur ou0oeenmfeiasfaDrau o (0trtnxo iotoateau ols0truoio oudomtnmicsls  2tmxmont1aetn o3iatla uanmont0 exoxr3iytlm  auvs;s)seumxmpoy4omtemncilsfartmxro;o4aeenmo3iatfa rmnvsnt4arxrifciydlpt auvi;(0seuoirpnu4apt lieias aruax p;u1openiieils m2ran snt)aeeoif iy1omDran ilt) 2tmio iudopt lici tfs2tmump;o0olx mfcilslmDea(mp;u0tlerirciotlpDelieol( s2urxr3iydal nmieils  Drmump;u0olxoiociysla2uluvpn(4texoif tatlaDraues s tetm(rpnu4ol e nvilt)s2ta(m ou4aexomi3tls s rlu sn(0arenif3oa1lpDr iesl(0 euoxm3nydame lnesls)sDurxm nt1opxnio3tlt m emn pnt)trtoir iy1lptraueils)srxrxrpoudom   ivi s  Dtaum oo0aetn fetydfs rlu p () etoir3iodoptran i ()seumim nu4lp e nvta() 2umumpno4tetn ociat m uauvont0tetrxocoa1fa eluvil()seurio3oo1optn fcil()aDumuronu0alxo fetls m2ulumo u)texrifcto1oa elnei t)srtrim nu4aleelfcslt  Dra(rpnt0oee mf3ild s eau p;()tetoir oydfp e u s t0trxo(opny1omee neta()arurxmo;o0aptnmociysfsDran p;t0aleoxo iydlm e ieolt0 euo(o3iu1ameemfcsa()sDrru p;o0aee moeiad mDra( o;(0alxoxo iy1lpD an ils  rtrim3no1llenmict tfsDtaxmpou0teeo fciadlmDra(ms u4 reomocoadomDelivols0s2xr(mpiodllenliesat  2tr(ro;u0opx moetatfmDrmn s u)aeerio iadopDeluvs s)tetr(m iudom e nvtltfaDtrumpou4tetoiietysla2rmuvpnu4arxriocio1omtran i s)s2tmxo3oo1lmtn ivils)aDtmxmpot4oetnioeildfmDulnvp (0 etnxr to1lpDrlivsls) 2um(o3nu1ll e iet (f rua(mpoo1olt ioeiydlm rau o u)texoxrcta1lmtr n i s) exoir3oo1olee fvs ( srum(monu1ole mi3iydfm elnmp;u) eermo3tatfmDran olt0srxoim iudlpt mfesl() 2tru oot1aptn ieildfm2ea(vs u0tlxnio3iytoa r ivo;t)sruoir iydlme lfcsl(faDtm(mp;t1tpeoioctls s uanmo;u)altnmfcoytla rauvo;()seumxm nudom nlnvi tfsDrmuroot0aptomiciydla ulu p;t0texomr iodom  lues s) etoirpou4altnmivs t s2uaur ou4alx  i3tys s2ua(vpnt0teermocia1fp rauei;()setrim3nodoltn fcsl(farraxmpoo0oltnmi3iatfmDuau sn()trxniocoa1fmDelnvo;()t2xm(m oodap  mncsa(fsDtax  ot1apxo fciad s2ea( o u0treoio3totopDe nvo s)truoiopou1ape  ivtlt)aDumur ou4apeoiicild m rlumo;u0artnmocoytlpDeauvo ()sruoxrpnu4lmtnmfesl(  rraxmpou1oeeomieiyt m2rmn ont0 etnxfcta1fp elu sls tetrxrpiudlm  miet tfarrr(  ot4alxomoctadlmDelnmo t) lxnxo3iydfmDe n i t t2xmio3ny4lp  mnvilt) Drrurpoo4optn ieiysls rau pn(4tetrmfctadlp   i sl() etmxo nudlmtn ies ( arrmumonu1apeo o3tlt m2ua(vo;()aeenir3ty1fpD  nesl( s2trxmpio4lpee ivt t)arumur ou1apxnmoctat mDraumpnt4tleomf3oytfmte n s (0t2tr(r3nudamtelncs s  rraum no0optomf3iaslmDua(von(4altoxf3iatomD  u o () 2xm(mpnu1ap nmivt s sDrmurpno1alt io3ilslaDra( p () rtrxrcty1fat  n ols) 2xo(o iydlleelivsl()srta(rooo4oeen oeilt mDrlump u4arxrmf oatlmtrai i;( t2xr(r iu1al   icils)a2rm(rpou1aeenmfeilsls2ranmo t4tlxrxr3tydlaDrluvi t0srtmxrpnydlleemnvtlt a2uax oot0olt mietldla2um(vo t) etnif3todoate ieols t2tmxmpou4op  mfesa( srraumpno0oexn octlsfs2ean s () renmo totlat lneo s0 ruo(o3ny1ol e net s)srtmurpnt4aet  ocildfaDuan s (4 rxrxfcta1opDeanvo;(0texrio3ny4amt mneil()srtrump;u4ape miciatfs2ranvpn(4 renxo3to1oa  aivslt)sruoxrpnodoltelncs s)artrxmp;t4alen octadfs2rl(vs t4artrif3iadfmte uvsl()srurxm oy4op nmiet s)arta(m oo0aetoiictldfmDum(ms;u)treoio totlat  n s t teto(rpiu1ome  fvsas)arumurp;o1aeenmf3ildls2em(vp;t) rtnmocoa1lpt luesls)tetm(o3iydlpenlfvi ()arumu  oo0aetoif3iasfm2umu s (4alenmo oy1omDeaivo s0trumir nu1lpt lfvs t) 2ua( pno0tpeo i3iltls ul(mp u4texomocoadoa eaues;()srur(opiudom  liesasfsrua(mpnu0tpxnmf3ild sDelnmont) rtoxoctodomt  neil(0srurxo3iudope  nvtas) Dumx o;o1opeoif3ilslmDulnvs t0altrif ty1faDrluvils trtoim3ny1lmee ncil(fsDuaxrpou4aeen oeiydls elums;u0arermo iotlaDeaivi;t)t2xmxr3oodlpee ncils)a2trxm ;t1olxomoeiadlaDrm(vp t0tltoifcio1fpDraiei ( trxoio oo1lm elnviat s2rrx  ;u0aeto i3iys sDeau p t0 leomo3oodoat lu i;t0 etoxrpiydomenlncs (fs2umu o;u4olt mi3iyd s2umums;(0 reoxrcto1opDelu o;s0texr(o nudal  lnei s sruaumpnt4apxomiciad a2emnvp u4teeoif3oadlmtraues s sexm(m3no4apeelivtlt) ruru pou0oltoii3iltfs2uanmon()trtomociatfp  li i;()tetmio3iydlm e fcils) Drm(mpoo1aptn f3iasls ua(mp u4tetomf3iadoa elnvo;s0teuoio oudll nlfcslt s2urxrp;u1apto iciadfm rm(ms (0tlxrmr tatopte uvs;t0 exmiopoodllee fciat arrm(  no4ole iociasfaDrl(vsn(4trenir tatopDe ivs (0 etr(r ny4opte fvi ()artau  ;o1opt  ociltlm umnms u)alenxr3oy1fpD anes;(0t2urir3nu4ap e feil( arurxm nu1tpx mfeiatfs uln p;u)trtnmo oatfa e nvilt srur(opiu1amenlnvt t aDumuro;o4opxoio3ildfaDrm( s;u)aeerxo3tytomtraneol() 2tmir io1lptnmivtlt sDrmx  nt0apx iiciadlm2rmumo;(0 rxomfctadlp  lu sls) 2toimpnydapteliesl(farta(mo;o4tlxnmoeiltlm2eln o;u)alxomr oadlaDraneo () euoxo iu4op  mivta(fa2tm(r ot1olxnmfeiyslsDrlumo;(0trtnxo to1laDr ivi (0trxoio oo4ap nmfes ( arta(moou0oee mfeilt sDean s (4 rxrxo3totlaDeluvo;( srxmimpno4lmtn ncsl(fsDtmx pot0tltomfeiyt m2eanvsn(0aetnmf iotfptr nvo s)seuoxm nodoptnlict t  Dra(m no0alto f3iasfaDemnms u0alenio3ty1lmte iei t)t2tm(rpnodlle  nvsls arurumooo0oeenif3iydfaDulumo;t4artrmf iytoaDrauei t trxm(r3iu1lmtn fvia( srua(mo;t1tlto ictytlaDemumon(0texoifciadopteai o;s0 exoxm iodal   nvtatf 2tr(mo;u1apeo oeiysfaDrmnmp;u4teerio3iadfm e uei t0srurim no1op nmivsls)s2ta( pnu1oet ioeilsfs2el(mont4 etomo tadopte ivo;t0sexrxm iodamenlnvtasf 2urumonu0olx ii3ildlm2eln on(0 leoirciodfmDrli ils  2trio ou1lmt livsas  2rm(m nt4aee io3iyd s uauvp;(0tetrmf tydlpD aueo s teur(opoy4openlicil(  2tmx  ;u0oee  fciltfsDel(vont0artomociodop  lueo;s)srur(m io4om n nci s) rtrumpnu1aptomoeiat s2ranms t0 lxnmocoo1fptelnes s)t2urim3nu4lmtemfvsat sDtrxmp;u1tlenmieiydfs2umnvsn(4aexrir3oodoa eliei t  rtr(r3iy1lp n ivsa(f rtrum ot4aexomociadlm2rlu p;u)tetnmf3ta1omt  u o s) 2uoim ny1ll  livslsf rtruront4opeomociys m ea(vs;(0alxrxo3oytlm elivs () 2xoxr oydlltnmici s  rrm( onu1opx  iciatfmDrluvs (0teermrcoadoa  lies;()trtmim iodap  lfeslt)aDta(m nu1tlt  o3tadlsDulnmo;t0 lxoxo to1opte u s;t0 2to(mpiu4om e nvslt)srrau ooo0altnifctld s2em( p;u4tltnmr3todfat an s t)t2tmxm oy4ame lfctlsf Draxm ;u1apeo oeilslaDea( snt4texnxocoydfmt ln i;(  2xm(o nu4ol  micsltfsDtr(monu0oeenmo3iyslm eanvont0 rtnirciydlaD  u o t0t2xo(opnu1llenlivia(  2ururoou0tpx io3ildlsDrlnmp t)arerxf3iatfaD aivi s) 2xmxm oudlle  nciasf Drmumoot1aex mfeias sDelums;u0 exnmfctotop raieslt0 2tm(rpiu4lptnlfet s)arurxmpoo4apenif3ild a2ulnvo;t)tlxriociodfaD  nvo t  rtm(mpoy1op   ivi t)aDrru pou0teenmoctatla eaumont4tltoif oadlatr iei t texoxr3ny4al nlivi s sDur(mo;u4texnio3iytfm rmums t) lerif3iotlmD  uvs ()seuo(o iu1ll e fct t  Duax  nt4apx mfeiatlm2el( s;u4 exrmo3oadlaDeaieo;t  exmirpiodlmt  nctasfaDrr( ont0tlxnii3iysla rl(mp;u4 rtomf ia1lat  n ol()s2xrxr3iu1lm  lfcil( arraxrp;u4apx  feilsla el( p;t0aeeomocootlaD au s;s0 2umim3nu4ll nlneiat sruru  ;t4oee  feiad a raumsn(4arxoio3io1la  ln i s)sruoio iudam e ivil() 2umu  nu0apenifetas sDrlnmo u0 rtrmr3oydfat an sl(  exrio io1am   fctls)aDtmxmoou1tlx iicilslaDrln o t4arxoxf3tadfp  anesls)srto(rpny1opt lnviat srta(moot4ape  ictaslsDrm( o ()texnif ty1fpDranesl()srxm(o3oy4optnlicilsfaruaumpnu4tee  ietytlmDuan p t4 lermr3to1optr nvo s) 2uo(rpiydlp   nes s)sDtr(mont4opxnmf3iatlmDran onu0trxnmr oo1fmt  iei s)setrxm3ou1omt mivsa()aDtaxr ot1olxnmi3tysfa umu o u0 rxoif tydla   uei s  2uoxmpnudlpe mfcsa(  2ra( pot4ape  oeiys m2uau o;u4 etrio3tydla  anvil(  etrio nodll   nvtasfaDtmxm ;u0tpxomociytls elums;u) rerio ia1omte n ils0texrir3oudlp n nvsas a2umumonu1alenio3ilt a ulumonu4aleoiocio1opD ai ols t2xrxopiy1amt mietl(f 2um(r ot4aetn octat m2rm( s t0 rxnmo iotfpte nes;s texrim nudlmtnlivt sfsrtm(r oo4oexnmo3ildlm2eanmon(4 reoxoctydoa eai s ( truoir iydalen fesls  Draxm nt1oeto o3tadls2ea(monu4 ltniocto1omtelivo;t  exoiopou4am nmfvias)srrm(root0teeniocias a em( o ()altnmo iatlmteliei;( tetrxrpny4lp nlfvt ( srumxrp;t1ope  oeilsfmDuaump u) rtoxf3oatlaDelueo ( srxmir iy4ap e nviat) rrm(mpou0oex mfciad a rm(mo (4 rtoir ta1omteaivslt seur(o3oydlp n nctltfarrrx  ;u0tpe  ociad s2ua( s;u) eeomr3oadfm ranes;s trxrir3ny1ame  fvs t s2ta(moou4aexomf3iysfs2rlnvs;t0 lerxfctotlm  livs;t) exmxr3iu4om nmivt t sDumur oo1oexnmfetas a rlumo;u4tlenif oodlpD lnvi;()t2xoio nudam  mnvils)srurx  no0alxn feils s emu sn() lxoio todlaD  iei t0 2ur(m nu4lmeemivtas arra(mooo4tlen i3iyt m uaumo;u)trenio oadlm r nei ( s2xrxrpoydapen fvilt srur(  oo0olen i3iytlm emn s;u4arxrxf oydoaDeln ols)t2ur(o nu4oleemfcs sf rrm(  ot1ale  ieiaslm2eaump;u4aeenxociytlpte ies;()trtrxm nu4olenmivsa(fs2tmurpno0texo f3ilsfaDumuvpnt0tlxriocio1lp  auei;t srxm(m3oudal nmici ()aDrau ont4tpxn icilslm2rl(ms;(4aetrxr to1latr neo ()seumxmpiy1lm nlivt tfsrumump;o0aee  feiatfaDran p u)tetnif iodfmDeluvol(0srxmxrpno1lmtnlfvsas aDum(ro;o1aetomieiytlmDemuvs;t4tlxoif oodfpDranvslt  2uoxr nydoltnmncsl()s2rm(moot0tpt mo3iysfs2umu p;()trxrio iydop eaieo;t0s2urir3iu4alen fvs s s2trx oou0oltnif3iat aDumn o u) etoxf oy1fpDe ueils  2tmir iu4lm  lnvta(fsrurx p;t1tpx ioctlt aDemuvsn()alxrmr todopDelnvi s) rxm(m oo1aleemnvsls arrmxm nu0alxn f3tadfs2emnmpnt0arxoxrcootfpD lnvsls0t2toxo oo4open nciasfsDur( pno4alenmfctyd sDrlnvo;(4aeenirciatfp eln i (  2uo(o oo4om emictls)sDurxmonu4aptomfctld a2ra(vp (4 rtoifcta1om   nvol( teumim3oy4openmiet sf 2tru  nt1tleo feildfa2ea(ms (0 etoxo3iodoaDraieols setrxmpnydameelfci t)a2rmumpnu1tleomieiysla2uaump;t4alenif oo1fmte uvo;s)tetmxo3oodaltnlfcs sfs2rm(rpoo1texomf3tls s2rmn snu0 lerio iodopD  ivs t) rur(r3io1ll   iesas) 2rmx pnt0apxnmicils m2emnvs u4 rtoxrcty1opt lu s;s0srumir io1lm nlfvt tf Drau  nt4alen feiad a rluvs;t4trxrxfcoy1lmDr u i;()t2xoimpiy4olte netas)aDurumpno1alenioetlt s ul( p t0tltoio oodfp rauvo;s0teurio3io1amen iciat  2taxmpou4olx mo3iltls2rlu p;t4alermr3oatlmtr uvs t seuo(m ny1am nlivs ()arrmxmo;t0aetnifcils m uau o;u4tlxnxrcoytoa r nvo t0 2xoim oy1ll emnvsa(f 2tau  ;o0aet mi3tatlm2ra( snu0 lenircoo1lateanvi (0 rxoxrpou1omtnlfeiat  rtr(  ;u1tpt mictltlm umu o u)trtomr totfp r i sl(0 2xrir iydlmte fvi (f Dtmxrpnu0olen fcias a eanms;(4 exrmo3oy1oaD ai o t0trxoim nodal nmfeslt sDumu  ;o1tpx  i3ildfa2rlu p;t)aetnxf3iytop eli s (  eum(m3nydlmte ies (fa2uaur ;u1oltniocils a eau s (4areoircoatlm  aivi (0t2ur(opoydlmtnmncs tf 2rmu p;o4olxn octydfa2ulnvo;u)aexrmocia1faDeai s;t0 rtoir nu1lleelnei ()srtm(  nt0oex mociatfa2um( snu4tleomo3tydoa  aneo;s0t2xoxm oydol  mnvslt sDrax ooo4aetnmfeilt a um(mp;() rtrxr3tytoat aies;s0t2urxo no4am  lictas  Drrxrpot0apeo fetysfs rmums t)tlenmrcto1lp eaues (0 eur(opiu1amt  neta() Dtmxr ou4aleo iciatlm2emu s;u)aetrirctadop  auvsls0t2xm(o3nodllee ivtlsfarrr(mpnu0tleoif3iat sDra(vpn(4alermrcootlmtrluvi;( seumxmpoo1llt  nvilt s2rmum ot4aex  ietysfm2emu onu0tltomocootop  au s;()sexm(m no4amee fcs (fsrtrxrp;u0alxnmf3iytfa2uanvpnt) renxo3tadlp   n i t trurim oydlmte fvi (  Dtrumoot1aleoiictltfs2umumon(0 rtoxocoodomDelnei;t)trtrio nydlmeelncsat)a2rrur nt4tpxoif3tytfmDum(ms;t0tetrir3oatopDe ivi;( srur(mpnu4apen nci sf ruaxmpnt0tpx  i3tytlm elu p ()aetrxr3iodfaDrln i;(  2umio3no4lpenmivs t)sDurx p;t0aeenifctls m2uaums u) etrmo tytfp e ivs t)teumxo3ny1am nlfvsls s2uaurpnu1alenmf3iatfaDem( o t) eerif iy1fmteln o;() etm(r3io4ope  fes s)sDtrxr ot4tpx ioctadfs2rluvo ()aleoif oadoate uvsls texr(o3iydole  nes (f rtauronu0tex  oetasfaDrmnmont0trtnmf3ta1oatranes;()t2xmirpoo4al emfeia( s2tmuront4oeen i3iytfsDuluvo;()aeenmo3todlate neols0srur(m nodllt lfviat  rtaumpnu0altoiieiydfm uan p;t4aetomr oadfpD luvolt)t2xrxmpoudolenlfcia(f rtmxmont1tptnmf3iydfs elnvsnt0 rermfcoo1fm eauvolt) exm(r oo1lmtemfvs tfs2ur(  ;u0oeen fctytlm rmnmpnt4trtrmfcoo1lat luvo;s)srumxr iu4lpe livils s2ur(mono1olen iciat sDul(vo;t) lxrmr3io1lp rliesl()trur(opoo1omee ivil() rurur nu1altomoeiatfaDranvp () etnif3oodfm  auvs;() exoxmpny1lmee fcsasfaDrm(  nu1aptn ociasfm rauvs;(4trtoir iodlat aiesl(0 2xoio iudlm emfei (faDtrxr ou1tlt moctldfsDrl(mo u4 exrio totfmDe neol()trxmirpno1oleelfetls) Dta(mont4aeenmi3tysla2uanmonu4teeoio3oy1faD  ues;t seuoim no1lpe mfetat) Duaxm ;u0tlt mieilsfsDuanmon(0artoxrciydoptr i i ( teumiopno1apen nes s) rrrurp;u0tpxomieiatls2rln s;u4 etriocta1opt ai i (0t2xm(o3ou4ll  mfct t a2rrxmooo1tpxn f3ilt m rmu p u) rxnmr iotopDr u o;t)sexr(o3oodome  fct t)arrrxmp;u0olen ictatfaDum(ms;(4 rtoirctodlptr ies;s0 rxoio no4al  lieilt a2taxm nt0apeo fciyd m2ran s (0 lxrxf tytom   ivi;()texr(m3iydap emfviat aDrruro;u0tleomi3iadfm rlu snt0 renifcio1laDelneo;s)s2xoxo nu1am nliei ( aDumxronu0apen iciytfm2emnmo (0trxnxr3oytopD  nei;t s2uoiopoydapte feiat  Drrump;t0apx iictlsfa uln sn()tltnif3oa1fpDeauvo;(0t2tmxmpnudop e ivtat)s2rrumpou1tle  ictytla2uln o;u4aexrxfciodoaDeau il()teurirpoodlle  nvt (  Dta(mp;o1oexoifeiatla2ean p;t4texoirciadlpteau o t)teumxr3oy1al   nei s) Drm(r no4aleomfciydlaDel(mo;u4trtomociy1om e uvo;t)trtr(r iydlp emfvt tfa2ur( pot0texnmoetldlm uln pnt0aeerio3ootlmDrli i ()srxo(m3nodamtnmnvi s aDtaxmp;u4olx  i3ild mDrmnvpnu) rxrxf oy1fmt  u s;(0t2xm(r3iodop  mnvils sDuax  ;t0oetn iciytla2uauvs u0alxnir ootom ran s (0trurxr3io1ap e icsasf 2trum nu0ale  i3iasfm eau p t4alerir3ta1fpDe i slt  etrxrpnu4ll e net () 2tmu onu1aexnif3tas m rm(mp;t) renmr3io1fm  auesl(0trumiopio4ope mfviltf rtrumpou0aleoii3iyt mDra(mp;t)texomo3iodlaD  iei;(0 eum(opnu1ole livsatf rtrur no0tet mictydfa rm( s;()arxnxf3iodla elies () 2xm(rpnu1oltnmfviat)s2rrxr no1tle  fetysfa ea(mo;u0 renxf oy1latraivi t)srumxr3iu4llenlncslsfs2rrxr ;o0tleo f3iatfa2uanvpnu4altrio3oadoa e neo () eur(opoo4lpt lfes t)sruru  oo1tptoif3ias aDemnmo;u)teerxr ta1oaD  n i;(0seurxm3oodomenmictas) rum(  ;u0ope micildfm uaumsnt4arxoxr oytfaD liesl(0srtmio3nudal nliei sf Drr(m oo4texn feiltlm emn p t4texoircootfmDeli s ()t2xm(o3iudlp  lfcils) rumu  ;o0optoio3ildlm ra(ms;(0tlerif3ta1optrlivils srxoir oydole  ivs ()a2umx pou1tptn f3iydlaDea(vsnt4alxoiociotfp rlnvo (  rxrxrpoo4ap e fei tfsDtrum oo0aee  ociad m2elump t4 lerircoodfpt  u i s)t2urio oydll nlnvilsfs2rm(mo;t0oleo f3iltls2ua( o t) leoxf3oatfpD lueo s s2xoimpoy1opt  nct sfsrra(ro;o4oltn f3ias s2um(vs;t4arerio iatfpD  neolt) 2umxr iudamtn net ( s2rau ono1alt ifetld sDra( o;t0trtrxoctatla e uvils s2urio oy4alt lici t) rrrxrpoo1tex moetltfm2em(mo;u0 rtoxr3oatoa  livs ()t2uo(r io1ll  lnvsa() 2ra(r no4tptnif3ildfa2uanms (0 eeoxoctotfmt  u s (  2trxo oo4ameemnesat a2raur ;u4tet ifetadfs rluvs;t4 rtoxr oodfm  lnvs;s)s2trim3ny4apeemnvil(  Dtmu ooo1tex mfeiasfa rmu p t0 rxrif ty1lm   nes;(  2xrirpoy1am  mivtat  rrmxm ;u1olxo ocilt s emuvs;t)tetomocoydom raivi;t trurxrpiy1lmte ivtls)sDrm( pno1apxn fciydla rluvo (4 renxf todom   uesl(0sexr(mpoudal   neta(f ruax p;t4tetomiciatfs eaumo;t0artrmf iy1fpDe i o s s2toirpou1lmee fviat)aDua(r ;u1olto fetls aDumu s t) etnxo3tadlm e ivilt) rtmio3nydal elietltfsrtrx p;t0tpx  ietatfsDel(vo;t0 ltoif io1lm elueolt0sruo(opou4ome lfciatfaDrm(rp;o1apeomocilt sDra( snu0 ltrxo3todfa ran o () rumir3ny4lltemiet tfa2rmxrp;t0oeto feiltlm uau s t0tltrircoatfaDeai i ()s2xrio3oy1ameelncsl(fa2uax poo1opt  feiyslm rln o u) etomr3ty1fmD  ueo (  rxmxopiodop nlfcsa( srtaxr ot4oleomieilsfs eanmpn() lenxr io1fptr ueilt0t2toimpnodlpenlfvilt) Dta( oou0apenmfeiasfs ea(mont) etnifcia1laDranvs;t0teurxrpoo4alt lnvsa(f 2rmu  ;t4tpe  fctys m ea(monu0texoif3ty1omt ln o;(0srto(r3oydlm e fvi sfs2rmumpnt0oexnmieiydfa ea(vsn() rxrxo3ootlpD an i s  exmxmpnu4lmenmnvsltfa2umurp;t4aexn ieiadla2uan o t)trtnxfcio1lmtran o;()t2xmxo iydom nlfeil() Dumx  ou1tleomocilt s2rau o;(0texoxf3ta1oa  au ol( teurxr no1ap e nvsas srtaum nu0aex mfeiasfaDrlump u)alxnxo3iodfm e neo (  2tmxr3oudam emnvil( artmu o;u1tle ifciaslaDulu o (0 rerio oo1op e uvols0seuoxo3io1ol   fctasf 2trxmp;t0aleomfeiys s2ranmsnu4tlxoxf3ootfpDr u ols)srxoxm3iy1amtn ivs (  Duru pou1tlxnii3tltlm2ranvpnt)artrxfciotoa rli s t0 rxr(r iudlp  mnvilt  Drr( p;u1ape mf3tldlm rauvo;t) rerxo3oytfm eanei;s teum(opiydlpe mnesl()sDtmx o;t1aex  feiytfsDrlnvs t)tlxnmr3ty1fpt  i ols0 eurxo3ou4ape  ieilsfsDuaumo;u0tpe iietldfa2elnmpnu0artrio ootlaDeli s;s srxr(o iu4alenmfct ()artr( o;t1oexomf3ias a2ulnvpn(0aexnxo oatfp  livil()seuoxm3no4omt  iet (faDraxr nt0aet  fctasls ean pnu)alxnmf oy1fateli s t texrxm3no1op e neils srta(rpno0tptniocildlm ulu o;(4alxrir tydlmteaieilt0truoir3oo4altelnvsat) 2ua( p;t1tlx  fctld s rlums u4aleoircoodla rau i;( t2xr(o iy1op nlfet (  2rm(m ot1teenif3tytla2um(vpnt)tlenmocta1omD  ieo () rtmxr iy4lmt mnvsat)s2raxmoot1tlx mfetyt m2umnvonu)tlxnxr iytfaDe n ilt0trtmim3nudlm nmnctasf Drruro;t4aleoio3tls mDra(vo;u) rtoxrciotfmD aieils0teur(r oodllee fvt sfarta( oou1alen i3tatls rmnvo t)arxrmo oy1lmt lnvs (  rtrxmpoy4ome lnvi t  rua(rpno1apxn ictydfa2rmn p t0 ltomf3iodom raivo t texoxo io1al nlfvi ( aDururp;t1apeo i3iyt m2eanms;() lxoifciadlmD  ies;(0 exoim3iu1ale  ici (fsrtru  oo1olen ietadfsDrlumsn(4 lerirctodopt ln o s sexo(m3oo1lleelncsat a2rmxmpot1oltnmo3tltlm2umuvonu)tlenxo3tatomte ivo;(0srum(r ou4ape mfct (f 2ra(mp;t4alxnmictydlm2umuvpnu4trerio todoa rln o (0 euo(opiodal nliesa(f rrm(rp;t1oexnmfciys a2rmnvpnu4arenxfcoo1lat lnes;()srtrxr3iu1alenmfeils)aDraxmoot0oeenmfciytfmDemn s u4trxoxr3oatfa rai o ( s2tmim ny1lpt mnci t  rua(mp;o1aeenmi3iyt aDrl(vs u4alxnxo ta1optr ieil( s2tm(m oo4openliei s) rtaur ot0aptnioetydlm emn p t0alenxfcio1fpDrlnvo;t) 2to(m3no1oltelfesasfaDrmuroou4tpenioctysfa rl( p (0artrmo3tydlmt livo;t0tetoim iodamtnmietatfarta(rp;t1aeenio3ilslm2em( o (0 eenxr3oa1lmtr ues;s0srtmxm no1lptnmfet t aDtauroou0opx  fciltla el(vsn()altnmo io1oa r uei (  2xoxm3no1omte nvtltf 2urump;o0ope moetasfs2rmn pnt4 etrifcoatlp rau s;s) rtmio3nu1ap nmietl() Dtaxrp;o1tpt mfetad a2ul(msnt0trtrxfcootoa   ieo s0t2trimpoydop n iesas) rtmumooo4alto feiytlsDea( s;t4tetrxfciotopD  iei;(0 2xmimpiydlmenmicias sDur( ooo1oeeo oeiaslsDul(vo;t)tlerif oadfpDrluvsl(0trtriopno4lpenmicslt) Drrum ;t0oee ioeiltlaDel( o u0aexrifcoo1fm elnvilt)trxoxo ny4omen fcil(fsDumxronu0oltnioeiyd s ul(vs;u4arxnmr3ootlat lnvs s trtmio ou1ll   fvtatfaDum( poo4oee  ociadls umnmon() reoif iotlatelu slt  exmxm oo1al  livia(  Drauronu1tet  ocilt aDrlnmon(4 exomf iatlaD  nei;t srumxo nydll emics (fsDumu onu4aee iietysfs2emumont4 eenmf3totfm   nvs;()s2toir nudlp n ncsatfaDum( pnt4aet mfeilsfmDrmu o;t4aeermfciatfaDe nvilt)trxo(r io4op nmncils) rua(rpnt0apenmf3iatfs rlnms;t0aetoxr iadopt livilt) 2umim nu1ll emivsl() 2rrxmp;u0aptnifeildlmDel(msn()tlxoif3tatlmt livols)setr(mpoy4lp  lncta( a2uaum nt1optomietydfmDuanvont)areomr3tytlm eaies;t0s2toirpio4oltelnvsa()srrrurp;u4apxo fciaslm ua(vpnt4aexnircty1fmDrlnvs;s)trxoim3oodaleelicsatfs2urx  ;t1opxomo3tlslmDel(mpn(4aetrmrcta1faD  u o s) rumiopnodlm nlivtlt)aDurx ooo4opx mieilsls ul(vp;(4tlenmocoodopt li i;(0t2urxr3io4al  mfctltfaDrrumpnu0oexo f3iysfs2ea( o t)texnxo iatlaD aneo;t)sexoxopiudoltn ncslt)aDtax  ;u4alto ieildlmDuau s;t4 exrxr iotfm  auvils)trxrir io1amt  nvs s)a2uaxmo;t4tltomfctlt s uln sn()tlenmfctodlmt anvs;( s2trio3iy4lm nlivt ( aDtr(  ou4alto fcilt sDemnvs t)teerxf3totlmDe uvsls  rto(opnu1ol eliesl(f rum( pno4aet moeilsfa rlu p;t)tlxnxr3ia1optrlneolt)setrim3iy4ol n nvs (fsrurumpot4teeo ieilsfaDranvp;(4 eenir iy1fa eanvs;s seurxr no4al n ies ( srrmx pot1tpx mfciyt a2rm( p;t)tetomr ty1opDr nes s0srxr(o iu1aleeliei s  Dta(ronu0alen ictysls rluvp;u4 ltrxr3totfmtranvo s0 rxr(r3oo1olt lfeil(fsruau o;t1openmiciatls2uanms u4 exrmoctadlatrliei t0s2umxm iy4amtn fcslsf 2tr(m no4oeeo f3iysfsDum(mo u0 lenxo tytlptrluvo t) exmxo3nudlp nmfeil(f Dra(moot1opt  octltfmDran p u0tetoir tydlatran s;()teto(mpiu4op emivsltf Drau ooo1ope io3iad m ulnvsn(4 exnmf totfaD  uvo ( t2umim3ny4op emfctltfsDtmxr no4tpxnmi3ild m2uau o u)alxoir3iydop  anvils)texm(r iy1omte fetls)a2rmum nt1tpt mociyd m2emu ont0alerxr3iy1fm r i i;()t2urxr3iodlmtn nvsas a2rmx pot1oleoif3iyslaDulu s;(4aeeoxf oytfptrlnvo;() eumxm nodomen fvia() Duaumoot0tle  ocildla2ean s;u)arxoio tytoatr ieolt) 2toxr3no4apt  ivslt) Drmxrpno1oet ifetat m2umn pnu0 ltomrctodlpte n i;t0t2xoio ny1ll  lfetl(faDtruronu1alx mocilslaDel(vp;u) rerxf ootfmDeaieils0sexoxm3no1lle mivi t aDtr(  ;o1tpxo i3tad sDrlu pnt0 eenmfciadfa r i s;(  exoxopoy4optn fvi tfa2tmumoou0tlxnmi3iys mDrmumo;t4arerifctytfat ln ilt) 2uoxrpoodoleemnesl(  Dta(mpot0aet  icils aDeln pn(0alenxf3oydlp eln i;s)t2tm(o iu4alenmivilt s2umxr ;u0oee iociat mDea(vs;(4 lxrmf oadlmteauvo (  rtm(r3iydlpt  ici t  2uau  no0aetn ieilslmDea(ms u) ltrxr iy1fptelieo;(0teur(mpiydlpt mncs sf 2uau pnu4tpxniictyslm2uanvs t4 lxrxo oydoptrai o ( texoio ny4alt  fvia( a2ua(rpoo1alt  ieiyt mDul( pn()trxoxf3tydlate n sl(0 2tmiopoodom nlfvil(  Dta(r no4teto ocils mDrln snt)trxrxfctydfa  aueil( trxm(m3no4lltelfciltfs2trurpno0aexoif3iyt m2ulnvs t0texrmr ty1lmD  iei;(0srxr(o oydamee net (faDrmum ;o1teeoif3iys a elu p t4 eermfctydlmD lneo s)seumio3ou1lmtnmfvt s  Duax  no0olx  o3iydls ua( s;()treoxr3oo1lmt  ivo;( sexmir3nu4op e fcsas) Duaxmo;u4alxo i3ildls uanmo t)texrxocty1oaD lneolt)s2urim3oodlle  ncta( sDua(  ot0tet  oeiadla emn p;u4areoir3oodfaDraiei s0 rxr(rpoo4op n nes s s2rm( o;o4tlxoii3ilt m elnvp u)artrifciydomDrauvo ()trxrxm3iydll nmivil() 2rm( pot4oeto f3iydlsDumnmsnu0trtrmo ty1lateauvols)sexmim3iu4altemnvtls  Drrx o;o4oeeniociysfm2ea(mp (4 eeoxr3io1fm   n ilt)teto(r3iy4olt  ncs (  rrrxr nt1oee  fctas m2rmnmsn(0 etoxf ty1fmDelueo t0 eurio iodaltnmivsl(  rtr(rono4oexomoeilt mDumnvs;()tlxoxr oydfm e nvo t0s2xr(m iu1ll emfes t) Dumx o;o0opt  ieiysfa eau p;() rerxfcoadfmt  uvils0s2xoir3oydape lnet tf 2ur(rp;o4aexnmi3ias a um(vpnt0 renxr3ia1oaDr ueils  2xmxopnydap emfvslt  2umurpoo4tpxnio3tydls rmnvs;u)arenmf iodoat  ivols  eumxr oo4op n ncta(f 2trurpot0aeeoifctltfs2eanvsnu0alxnxr3oadfptr i i s)trtmir3ny1lle lfvilsf 2ra(ro;t1oltomfciyd a emn on() rermo3tydfa  au o;t0 etoxmpnu1lm   fcs (f rtm( pno4oeeomociltfa2ulump t)aetrmfcoytop rauvo ()teto(rpou4lleemfctlt) Drr(root1apxnii3ild s2rln o (0alxrmo oo1op eaneo;( seurio3ny1amtnlnciltf rumxr ;t1tee iictls s emumonu4trenmr3ty1lmDrlu s;t0 rumxm3no4lm elfci s)arumxm ;t4opeomo3iltls em( snt0 rxomo3iydlm  ai i;s) exrirpoydlp n ict s) 2ta(ro;t0ole iieias m rlums;u4 lenxrcoo1lmD  i s;t s2trir oy4ll nlfvtl(f Dra(rp;t1tleo iciytfmDulump u) exoxrciatoa r u s s) etoxopoydomeemiei tfaDraxmonu0alx  icilslaDra(mo u4tltnmo3tydomDrlueolt  2uoir3ny1lle  fvtlsfsrra( o;u1oet mfciltlmDum(mp (0 reoif3iotomteaivsls)teuo(opiodlm e fesas)aDtaxrp;o4optoif3tldfa uau s u4trtrxr3tytfpD au ol() rxo(r3io4al nmietl(  Drau pnu1oltn ociyt mDum(mont)altoxfciytlaDe neolt  2uo(o3ou4omtn fesat  2raxr nu1olenmfetld a eanmp;(0tltomf totlp r nes;t0teumxr3oo4omeemivil( sDrrxmont0ole ioctld a elnmo (0trtrif oatfaDeau s;t trtr(m3ou4op   fct ()arrm( onu1aexn octld sDemnms t)artrircoytomtrau s;t teur(opoydomeemfci s artmum ;t1tpt  ietyd sDraump u4trtnxrctodlm r neslt t2xmxrpoy4amtelfctl(fsDtmxmpou1aexomoeiysfm2rlump t4trxnmr ty1la raivi ()setrimpiudope  fcia(  Drru pnt4aeeniociat s rmn p;t4tetrxo3iydopDelu o s)s2urxm3ou1lp n iet t  Dra(mp;u1tetnifciys sDulu s;t)trtrmociytla  aivsls  etmxopiudaptnlies (fa2rm(  ou1tpxnioctyslsDum(mo;u0aexnmo iadoaDe i olt s2xmxrpoy1omt lncsl(fa2ra(rp;t4apxomf3tytfaDumnmp;() eenxf io1fmDelnvo t)trurxr ou1lle mncsatf rumx ont0oeto iciysfa2em(vp u)aetoxo3oatoaDr uesl(0setoxm oydolt  ivsa()s2urxmp;u0aeto oeildfa2umuvo;(4 ltnmocoy1opDeluvslt0srumxrpoo1oltnmfcs t a2trumpou1opeomoetat s2rluvpnt)tetomfcto1omD aivo;(0t2trxr oy1omenmiviat) 2taxmont0texnmfciytfm2rmuvs (0aexomrciydlp  lnvs ()setmxo nu4ol emfcta(  2rrx  ;o1oeeo iciatfs2umuvo u4tlxnmf oodfmDelivs;s0t2tm(r3iy1amen ncsas)s2urxro;o0ole mf3tltlsDum( o (0 rxrmrctotfpte neols) rurxo3io4ll  lfes s)srumurp;o4tptnif3iys s2ulump;t)aetnif3tadfat  n slt seurxm3nydlmtemfetatf 2raxrpot4tleomfciys a ra( p t4tltnif oadoa r ieo t0teur(mpnu4ol nlfvtat sruax  oo1oeeoifciyt s2uau o;u0tlxrmoctotfm  aies;s  2trio3nodamtnlfvt s) rrrxm ;u1oexoiocilslaDumumo (4texoxr3iy1laD anvs;()trtm(o3ou4omenlfes ()sDtm(r ou1oee iocildls2em( o (4 lerxr todop r ivol(  2um(m oodaltnmfctat  2um( p;u0texoio3iysfaDemnmo (4aeeoxrcoytomDeluvi s) rtoxo iu4lp emnvi t)s2tm( ont4oetn fctytfsDrluvp;(0treomr tytla r i s;t) etrxmpno1olenmnet ( aDumxmo;o1optnmietatfa um(vp u0 rxomf ty1faDeauvolt) 2xoirpou1apeelfvt sfa2urum nt0optnifeiad m rl(mp;()aeenxo io1opt  neo ()texoio ou4ll elfeia()aDrrumo;o4aexo o3tys s2rlnvsn(0aetnio io1lp ran i;s0 etoxm3oo4omt livtltf Dururpou1aexnmoetadfa ean s u0tltnmr3iy1fp eanvi s)srxrxo iu1omenmiet ()artru  nu4olt  f3ildfm rmnvo u0 rerircoytfm ean s;t srxmir3oodlpte fet ()srrmxrpou4oet moeiatla emu snt4tleomo iodomDelivo;t)s2uoio3ny1optelnvsl(fsrtmu pot4tpxnmo3iysfsDulu s;()texomociatopDraivi;s)srtm(opiodomteliviat)a2trur nu4olen f3iasls2uan s;u4aeenxr tytoa   ivo;()srxmxr oy1lmenlfcs ( aDrm(ronu0texomi3iasfs el( p;u)tltoxrcoatlmt livils)sexr(rpoydllte ivs () 2rrxrooo0tleoioeiysfsDem( p;u0aetoxocoytfaDr ivi;s)srur(o io1lpt mfctat s2uru  nt0apx  o3tydlaDelnvs t0 etrxr iytoa elu s ( trxr(o iy4olen fci (fs2rm(mp;o4tpenmo3tadfmDelnvs;()aeeoif3todlpDrauei;()teuo(mpnudamee ivilsfa2rrx  ;o4apxnio3iyt m2emuvon(0tlenmf3iodla eliei s sexmxo3oydlmtn ivil()srrmxmp;o0tpx mieias s ulnvp u4areoir3oytlatraneslt  rurirpoudoptn nvsat  Drmu  ou4tlt ifctyd aDulnvs;(4 etomf ia1om  li o s trtmxo iy1amtnlfci sfa2ta(rpou1alen ietldfs2ulnvp;()arxrio ty1fp rluvilt)trum(o3nodllt mfvilt aDumxrp;t0aee  o3iaslaDelnvs;(0alxoxocoadfat au olt0 rxr(opoo1lpee nei ()s2tmxro;o0tpe  ociyd mDean p;u4alermo3ta1opDraivo;s  rxr(rpiodomen ncil(farumurpoo4alto o3iltfs rln pnu)tlxomf oodfptelies (0setoimpny4ap  mici tf 2umu oot0teenif3tydfm ea(vp;() rtrmr3tytomt livo s s2xmio nydopenlfctlsfarta(r nt0oeeomieilt s rl( s;t4trerxr3tydop   ivo;( srumir3no4ape  neia(  2uax  oo4aetnioctasfsDemuvon(0 ltoxf3totom rlnvolt)srxrxopoo4ll   fvtl()a2rrx oou4tptomieiytfsDranmo;(4alxomr3tydfptranvs s)srtm(m3no1ap  mnes s)aDrrurpoo1apxo i3iadls2ranvo t0aeerxrciotlaDr u s t)t2tmim iydom  mietas a2tau onu1tpto feilt m ea(vs (4arxomrcty1fpD an slt)texrxopno4oltnmictas  rtm( o;u4alt  o3tysfs eauvpnt4tltrxo iatoaDelivsls0tetoxo oy4ale micils)aDrr(mont4aet  ictysla rmn onu4tetoxr to1fpD aieslt)srxo(opio4lpe  ictat)arrm( poo0olxnif3iltfa2rluvo (0alxnxocootoaDrauvi;t trxo(opoy4lle  nei sfartaumont4opt moeils a2rauvp ()alxrxr iy1lat ai ols0trxoimpoudale lnvia(f Dur( onu4ape  o3iasfmDra(mp;t4teeoif to1lpt  ieo s srtm(rpiy4omte fvslsf 2taurp;o4oee ifciyslsDrl(vpn(4 lxnmf3ootfmDe neo s0t2uoim no1al nlivtatfs2rax poo1tptomfciys s2elnvp;()trxoio3iatlatelu o ()t2xrir iy4olen iei t) Dtrxr oo1texo octltla uluvon()arerxf3oytlm  aues t texo(m3io4openlfcilt)aDrrx onu4tetnii3iydla ulnvsnt0 eeomf3oadomDranesls  rto(o3oo1alt  fes tf rrm(  nt1tpxnmo3ilsfa uauvsnt4 rxomr3iytoptr ivo;t) 2xm(opny4lptnmfvsat) Dtm(rpot4oeenmieiydla uln o;t0aleomf3oy1opDr nei t s2ur(mpoudome mnctatfsDraurp;t4apenmf3iyt sDum( onu0aeenxo3ta1fa r ieol( setrxo oy1ap n fvtls  Dtruronu0ape iieilslm2elu o;u4alxnircoytoaD aivslt)seurxr3oy4ol  lfvtatf rum(ront0ole  fcildlsDrauvonu0 etrir3oy1lpte n i;() 2umim3ny4op elfcsa( sDrrxrpou1tex mfcildfs ulnms (0altoxfciytfp rlu ol()setrxmpiy4ll  lfcil(  2rr(  ;t0aexo fciydla2emn o;(4aetnif oadoat lneilt srtm(m nu4lptemnvt (  rtaxrpnu4apeo ieias m2emnvo t4 rxrxo to1fat aneo;t  exmim no1lp n nct t) 2ur(m ;o0oexo icild a2umnms;t4artrxo oodlmDraieo;s srxm(o io1lpen nvt t sDrr(mpou0opeo iciltls ulnmo t) rxrio oodfmD aueilt0texmirpoo1lmenmieia( a2rrxm ou0oex iieiatfsDemn pn(4trxnifcoo1fp rln o s0t2tmxmpnu1amt  nvtls srta(r ;t1oexn i3tlsfa2eln sn(0 etoircoydfmDeln i;s) exo(m3nu4ol  mies tf rtr( o;u1tpenmfeiltla emu o (4tlxoxf3io1faDeau s;( t2uoirpoo1omen nvi (f 2ta(ro;t4olt mo3ilsla2rauvp;u4tleoxf iadlp   i ol(0truo(m3io1openlncslt  rrrur ;u1texnmo3iltls rau s ()trtnxr3totop raueo;t) rur(m no1lm elnesl(fsDtaumpot0tex  i3tltla ean onu)tlxrxrcoa1fpt  nvs;t s2trio iydaptelfvsa()srtrum ou4apxnmfetadfa2uln snu) eerio3ty1faD li s;() exm(mpou4omenliei tfsrumurono1tlx  fciatfs emnvpn(4aexrmfcoydlmDelieil(  exmirpoodole mneslt) rtau pno1tle  fciyt s em( s u) etoxfciotfat li ols)srtoxrpiy4al   ieiasfsrtax o;t4oeto o3iysls eau p;(4artriocoa1omD  u s;s)t2trxr3iy4alenlfvil( a2tau ooo4tet  ietyt a2rl(mp;t4aeenxo iadoaD  uei;s s2toim3iy1al nlnvsltfsDtm( p;o4aeeo o3iadfs2elnvo u)arxoiociodomD li olt0 euo(m3iydom nmiesltf Drmxroou1tpxo f3ild sDul(ms u) eerxo3oy1lmt anes s)sexmirpoy1omt mict t  rumx pno0tee ifciatlaDranvpn(4 etrmf3tatlp  aivolt  rtmxo oudoleemfet t)srtaxmpno0aetoifeiat a2em( onu4 rtoif3oadopDelueo ()setrio3oudap e ictl() 2tmxm ;t1altomo3iatla rmums u)aeeoircoy1opDeli o t s2to(rpiu4olen fvslt  rraxrpnu0oltnif3tlsfm2rau s;t)trerxo iodopte u i () etr(o3iu4op e ncsas)s2tm(r ;u1oexo o3tyd m2elumo;u)tlxrmrcootlp e n slt)srxrxopoo4ale  fvtl(fsDuaumont1aee  icildls2elnmsnu0artrmoctytoa e ivo;s0sexo(o3iu4lme lfctltfs2taumpno4opxomfciydls ranvp;(0teerirciadoa rln o (0srxoxr3nu1ole mnvsasf Dtau  nt1altnmfetltls2umu s;t0 rxrxrciydla   uvolt t2to(mpou1lmtelfci s srrm( p;o4tle  o3tysfs emu pn()trtnmo iodfate ueols0 rum(mpio4ol nmfvsas sDrm(m nu0aexn i3iysfs2um(ms ()aetoif tytlm  aivs ()trurxr iydopeemfvia() Dur( pno1optn ociat s2umn o u0 ltnxo3to1la  an sl()srtr(mpio4apt mfct s)a2umxmooo4alxnmo3ils a2ranms;t0arxomr oa1fpt lies;s sruoio io1ap elncs (fsDrru oot0opxoii3iytls em( p (0aeerxf oy1lp e ieilt0t2urirpny1lpen feilsfs2trx pou4texoii3iadlaDel(vp t0aetnxociy1fpt auvs;t)trtmim io1ope  iesa( s2uaumpoo0apxn f3tyt a2umn pnt4tlenio tatfm   iei;()t2uo(m3oudap elncs () Dtaxrp;o0tpx  octls aDrmuvp (0arerxfcto1om rlu o ()t2xmxr3oy4ame  ncsl(fsrrau pnt1tle mociydls2emuvp t)tlxrxo3oodfmDrlueil(  eur(r ou4ol  lfei s)aDtm( p;o1altn iciltfs um(vont4arenxociadlpDrluesls  rtoio oodapt  iesat)srumx  oo1opt mi3iysfm ea(vo u4 lenxr oo1lm rln o s s2xm(m iu4ol   iet s  2taxroou4aetoii3tytfs emnvpnu)tltnmocta1fa elnvi t)s2xmxmpnodapenmfcsat s2ta(rono1aex  ociad s2ulump u)aleoxo iadomD lnvi s)trxrxm nodapt lfci (f Drr(mont0aex  ieils s2ua(ms;t)tltrifcto1oat li slt0 etrxr3oy1optnmnesl( sDrru o;u0tpxnmf3iadlm2rauvp () rtrmociatfp  an o t s2to(r3oo1ll e ncsas  rumxr no1tpxo f3iyslm2rlnmp;(4 rtnif3todlptrlueil( s2uoimpoydomtnmncias srta( pnu0teenii3iys s2ua(vsnt0 leomf oo1omtrlu slt0truoim3oo4olenmfvta()arraxrp;t0tlt iietydfmDumnmo;()arxomr todlpDr ieo;()setoxm oodaptelfvslt arumu poo4tex mo3tatfm rlump;u0tlxoxocoo1oatr n i ()t2xmimpiy4ap nlneilt) 2taxr ou0oetnifctltls ul(msnt4aeenmo iotomDe ieslt setr(mpiy1omen nctat) 2uaxm nu1optomociasla2eaumo;t) eermrctatomt  u sl( srumxr oy1omt  iciat srur(r ;o1tptn fctyslmDea(vs (4arermf tytfa  aues;( texo(o nu4ome livia( s2tax p;o0oet moetadlm2ean s;t4 lxrmr oo1fpt livil()trum(opno4opt mfeia(f rrax pou4aetn iciatfa2umu pnt4 eenmf3iatlaDrai olt0 2xm(o nydale lnesat) Draur ;u0tptnifciyd a rm(vo;(0aetrmo3ootlatrlnei s0s2to(opoydopenlfctas  2tau  oo0ole  iciatfsDuln onu0 etnmfcoodomtr ieo;()s2xo(opoodlltelivia()aDtrxrono1oeenmfcias m2eanvp;(4 exoxo3tatlp   uvo;s0s2tmirpoydapeelnvias) 2umx p;t0aptoioeiysls2emn o () rtrmf3todomtraneo () ruoim nodale mfctl(fs2umx o;o4tlxoio3iys mDrmumpnu)arxomr tytopDran o;s)t2umxo iu4am n fcs sf 2rr(mpnu0alxn fcias s em( o () eenifcoy1oa rli olt trxmio3no4optelfetlt) rta(r nu0aleomoetytls2rauvo u4 etrmo3oadom  an o t0trxrirpiodap  mnetlt)srum(mp;t4alt  ieildfm2eanmp (4 etnmociadlateauvi;s srur(o3ny1al elfvsls) ruax ont1tleo feiltla emumo;t0 rxnifcia1fp elnvils0s2trxm no1lm elicil( artr(m ou1oetn f3iaslmDuauvont4areoio oy1oat ln o s)setrxo io4lp nlfvtas) Dtmu pno4tleo fctatla rln o;t4 reoxr3iydoat aneo () 2toxr iu4llte ici t sDraumont1tptnio3tlsfs rmuvsnu4trtnmf tadomDr n il(0trumio iodamtnmfci ()a2ra(m ;o4tlxomfetldls rm(mp;t4teerif3ta1oaDeln ils s2xrio iodopt lietls) Dtmu pno0tltnmo3ias a2uau on(4texoxr3iatfp e u s;t truo(r3iu1aptn ncsl( a2uax pnt4apxnmieilsls2umnvo u0trerirciadfa  lueo;s t2xoxm3no1lmt  neil(f 2raxm oo0oeeo feiaslaDem( p;(0 ltrmrcto1laDraueslt  exo(opiu1ope lnvtasf 2trxmo;o4tlt ifciasls rln pnt4arenmfcty1oaDelu o ()s2toir ou4alt mncsasf 2ra( pot4texoifciatfs2ulnvp (0aetoio oodlat ln i ()trur(r3ny1lm  lnvslt  2urx p;t0oeen i3iltfm2uanvs t0tltoxf iotfmD lneolt0texrir3nu1ape lnctlt) rur(rpnt1aeeo f3iyslm2um( pnu) lermr oa1lp rauvi t trxmim3ny1apeelietas  2umxrpou1ale mf3tatlm2eluvo t) renircoadlpD  ieslt0t2xoxm3io4ome  fcsl( arrm(rono1open ieild m2raump;t4arxrif3tatlmteln il( trtrim3no4apte nctat) Dumxr no0opto iciadfaDel( o t)tltnmr3oatlpDeln ils s2to(m3nodol  lnvtasfsDtau pnu4opxnmfeild m2ra(vp (4areoxf oytlp eanvsl(0 rumio ou1am  mfvil()a2ur( ooo1aeenmoeiysfaDum(vs;t0 lxrmf ia1fatelivi ( srumirpio4om emicsat) 2rrur nu4aleo ociysfs2ra(ms ()teermr tytfpteanvi s t2umxm3iy1ome mnet () 2trumont4olt mo3iysfsDuanvont0 eerxoctydlpDelueil(0 eurio ou4omee nvsatfs2uaur ot0tlen o3tysla ul( p u0 leriocoytfpDeluvi;s  2umxo nudlp n nvilt)a2rr(m ;o0apt moctltfmDeanms;(4trtrmrctydomtr uei;t  2urxopnu1open fvs sf 2tax pnt4texo octldlaDem( o;(0 lxrio ty1oateluei;(0 exmxopnodllenlivias srrrxr ;o1oex ifetadla umnvpnt)aeenifctatlmD ai ilt0 rxmxrpoydlpe mivtl( sDtmu  ;u1alto f3iltfm2eauvo;u) leomrciytop   nvilt setmxr3oy4lpe lies tf rurx p;o4ale ioeiys sDemump;(0 exrmr3tadlmDrliesl()t2tm(o3oo4amtnlncsa(fa2rm(mp;t1tpeoii3iat a2rlumsnt0tlxnxocto1lp r u i;s0trtoimpiu4altnlfct t a2trumpno0tex  octld s2ul( sn()aexoxocoatopt  i i ( seum(m nydol nlietltfs2taxro;t1tpeomo3tadlaDrm(vsnt)tltoifciytlat  nvol()trxmxo3oydll  lfci () 2um(  ;t0tle mo3tlsfa el(ms ()aexrifcia1om  li i s) rxoxo oy1ale mnviltfsDtaxrp;t0olxoif3iyt m rlnms () lenmrcoatfm eaueol(  2umio iodalt liesat)srtrurpno4oet moctat a2rln s;t)treoir to1la  anvo;( texm(r ny4opt lncsltf Durumooo1texniieias a2rmnmo t4trenxrctytopD lneol( truo(m oo4ll e ics ( aDum( pot4oetn oeilt s ran p t)teerif to1omtrln s s) rxoxrpio1al e ics s s2trurp;o0tpxnifetls sDrmums ()trxoirctodla e i ilt0 rur(r3iydlme mfcil(fsDtrxmpou0alx mf3iasls2ran snu0aexrif tydom eluvs;s)sexo(r oydop nmfetat  Duaxm ;u0oetoioeiyt mDrm( pnu0aexnif ootoat au i;t)srtrxm3iy4amtnlfvil( artr( pnt4apenmi3iys m ulumo ()teeoxf3tydfa  lnvo t0trumiopno1lpt mfvta()sDrrump;o4ole mfeiytla ra(vp t)tlxrmr3iodomtrauvil() rtoxopiudam   icsa(  2ta(mo;o4aeen f3ias a uanvo;u)arxnifcta1la e ivs t) rxoio3oy4omt lnvsa()aDta( o;u0oex ii3iydfm2umnvo;t) etoircta1faDranes s) 2tr(mpoo4lptemietlt  rua(rooo1oexoiociatla2emu p ()texomfctydlatelu sls0 rurim3ou1lmeemfvil(fa2umurpoo4oexoii3iltls2uanvpnt4 rxnmrctatom  auesls s2xr(o3oodope  fvs t aDuaumoou1tee if3iadls2rauvonu4tetnxr3oodlmt livs;s  rur(r ou4oltemncsls)a2uru  ;u4tle mfeiytfmDrm( pnt4aexnmf iatlaDr ivo t) rtoio3nydomtn ncsa( aDurxmpno1tet io3tyt mDumn p;t)aeenmo3ty1optranvi t0trxo(o3oo1lm elfcs s)aDrrxrpnu1opt  ietytfs2el( pn()trtrmr ta1lmD  nvo t setmio3ny1lm nlfesa()sDtm(  ot4teen fciadfa rmump;u) rtnxr3tatfptraiesl(0 rtrir oo4ol  livs t) 2rmum ;o0apx  ictytla2ra(mo u4 rxnxociy1fa  livi;s s2toim iodop  livilt)s2ur(mooo1tex mfetltla2elnvp;u4teenifcoodlpt lnvs;(0 2to(o3oydope lfesatfa2rmump;t1aleoifetas aDuanmp;()aetnmocta1oaDrauvo s0s2uoir oydop elncslt srtaump;t1tpxoiiciyslaDua(von(4trxrxocoatlp   ues ()srum(o iudale lfeil()aDtaxmpou0aetnio3iatls2emumonu)trxoiocootlm r n i (0t2xmimpiy1alenmivslt) rum(rp;u4oetnmo3tatfa uanvp;()aeeoxrctadfm  livil(0seuoxrpoy1aptelnvtlsfs2taum oo1apxn oeildla2el( s;(0trtoxr iytfate n i;( seurir3no1lle  fcias aDra(mpot4aptoif3iydfa2rau p;t4artnir oatfa rli i () rur(o3ny4omtnlfetas) 2uaxr ;u4oeeomoeild sDumu o;u0teeomo3to1fpDelivo s0s2umim io4omeelivtltfarumumo;t0opto oetatfmDem(vsnu4tltomo iydfpt auvs t0 2xmxo io1ol  mieils)s2umuront1olenmf3iydfa2rluvs u) eenifcio1om elivs s srurimpiy1opee ncs t sDrm(rpoo0oetoifcilslaDum(mo (4aetrxr3ta1fpDraiei s teumxo iydal n neils) 2trxmoou0aptoifetadfsDrmums (4aetrir3todfpDe iei t)t2um(mpnudlmeemiesasfsDrruroot4oet ifetatfmDul(ms;t)altrmf tatlaD aies;(0seurim3oodaltnlfesat) 2ua(r oo4tpxn fctyt a2elums;u0 leoir3oytlp elueils0 etr(r3nu1omt  nci sf rtm( p;t1tpx  feilt a eauvp;t4 eeoxf3tytlm e nvils0texrir oo4lp  mivsl(fs2rruro;o4tpxomfeiaslaDulnvp u)tltnxfctotlp   ieol()setrxmpio4ol n icsls  Dta(r ;o1alen ietas m ranvpnu0 lerxo3ty1fa ran s t)s2tm(o3io4olt lici s  Dur(mont4alt ifeiytlmDrmu sn(4artnxf3tatom r uei;()seuo(m3oodlmtemnvtat aDtmxr ot1aeeomf3tadla2elnmont4artomocio1optrlnes t0trxr(m oy4lmte iet (fa2truro;u4oltnmieild a eln p (4 rtoir3ty1la ranes t0trtm(o oo4om emivs ( a2ra(rpoo4olxnmociatfs2rlums u4 rxomrcia1lmte neil()t2uo(r nu1ame licia( s2taumpnt1tlen fctydls2emnmo (4trerxfcto1om elivi;s texo(r iy1lmt lfcsas a2raxro;u1tpx  o3ilt s2ul(vo (0aeermrctatfmDran i s texmio3oodap   fvi t)aDrr(mpot1tleo i3ils mDrl( s;t4trxoxf3ia1oatelu slt sexm(o nu1oltnmieiltfsDur(mooo0texo fctytls rauvp;u4 rtnifciodfp elu il() 2toxo io4lleemncslt aDra(  ot1oetn f3ildla2elu pnt0 etrxr3ta1lm r iesls s2xrxm oudlpen nei s  Draum nu4opxo iciadfmDean p;(4arenmrctytlmt  n o;( srtoim nudaptemfcilt aruaxrpnu0opt ioeiad m2rmums u4trtoir oo1faDrau sl( trumim3oo4alt  iviat srur(roou1opxnifetytls2ranvs;u) lxniocoo1fmteanei;t  2xoxm oudoptnlivsls)sDtrx ont4texomieilslsDrlnvp (4 ltrif ty1fmDr u s;(0tetoio ou1op  mnei tfsrumu  ot4aetnmi3ils a uauvpnu) lenif3iotfp  lues;()sruriopoy4amenmnvtas)aDumxmpnu4tpenmiciat aDea(von() eerxf totfm e nei s) etr(m3nu4apenmieil(farrr( oot1tpeo f3iysla eanvsnu4tltoxo ta1laD livs (  rtrxo iudole lfei tfsDrrx poo0tet  oeiad s emumsnt4tetoirctadfm r i i;() rur(m iudomeelnct sf rrrx onu4oltnioetyd m2ea( p t) ltnir3ty1fpD  ivols0sexmxm3io1lm  lnes tfs2ra(r ;o1aexnmieildfs2rlu s ()aeerxo3oatop elu ols0setrxm nudameelfctat)a2rr( o;t4opxo octysfm uaump;u)altnmocootla  lneo;s) rumim3no4ole  fcils)a2rmxmoou4tet  fctldfmDrmnmon(0tltoio3tadlptrluvolt)trum(o3nu1lp e nct (f Dumxmo;u1opt mfciysfsDul( p t4trenxo oo1op e n o t) eumiopnodlp elfvs s) rurxmpoo0ale mfeiyd s2eluvo;t4tleomocto1fatrau ol()t2tmimpoo4lmt lnvil( s2ur(  ou4tetn icild m ulnvonu4areomo3oydlaDr n sls) 2urir iy4ap  lictas s2tmurpou0tet  fctysfm2uanmo;t)arenif3tydlmDr nvi s0teumim oudopenlnvsl(fa2ra(rp;u1tpxnmoeias a rmu o;u)altnxo3iadfa rlu o;(0 2uoir3io1ame  ivtl()a2taurpnu1apx ifeiyd mDrm(vsn()artrmo iy1fpDr nvslt0sexmim3iy4lleemnesl(  2rrxr ;t1tle iicilslm ulnmpnu) etnmf3ia1fmteluei;s)seumxr ny4amtnmnvs ( srtrurp;t0aetnmo3iat aDua(vo;() reoxrcta1laDeli i s)teur(m3oodopt lnei ( srta( onu1alenii3iyt sDemnmp;t4 eenif tydoaDeli i;(0trxmio3nudlm   ncilt aDumxr oo1teen f3iysfa elnmpn(0 etoirciotlatelnei;( t2umxrpiudaptemiesls)aDum(mono4oeenifeiltls um(vp;u4arenxf totfatrauvs;( texmxm iy1amenlfeslt)arurx p;u1apto f3ildla rlumpn(4aeerxf totlpD lies ()srur(m nu4omt lfesasfsDraxmono4aetn f3ildfa ulu s;u) exrmfciotoateau s;t tetm(m3oo4apeemictlt a2rmumooo4opt ifeilsfs2ulnvsn(0aexrmr3ty1lpDelneo;()trto(opio1lmte ivslt a2raxrpno1tet  feiyslmDrmu pnt) lxnmo3iatlatrlu sls) 2urxm3io4amenmicsa( a2urum nt0aex moeiatfs2ranmsnt)alerxf3iy1latrau o;(0seurxr3no1apenlnes ( a2rru oou0aee  f3iydfaDum( p ()arxnmr oy1fptr uvo;()s2urxr3iy1am  lnesls  Dum(mpnu0alenmf3iadlaDrm(vs u) leoir iadomDeluvi ()t2xmio3oodlme  ies s a2rmu  ;t1tle iiciytla uau o (4tetoxo iotfpt lnvo;s) eum(r3oydomtnmncta(f rtax pot0apeniociad m2rau s;t4 eeoir tadomDe ieo ()s2umiopoydope livta(fs2tmxrpno0aex ioctlt mDemumpnt4texomo3tydoateanvsls s2xoiopiu4lmt  nvtl( s2um(r ;o1alxn iciad aDean pnt0aexoxf todfpt  uvolt)trtmxm iydom nlfvsl(fsruau o;t1tlxn o3iydlm ul(ms t0treoif tytfaDe nvs;s  etoio3ou4apenlnvil(farum( ooo1tlenmieiydfa2emnvp;u4aetnxo oytfptrlnvo;t)s2trxmpny4am elnvtl(fartaxm no4tet mf3iatfs2emnmp t4tlerxr3iydomt lues;t0s2tmxo3iu4opee iei tfa2urxmoou1tpeo oetatfmDrmn o u0tlxomfctotlp eli s;(0 rto(mpny1lmtnmieia()sDrm(mp;u0tlxo fciys m2ea( s;u4tlxnmf3tydfa  ai ols) rxr(mpoodlp   fesls)aDtrum nu4apx moetld s2ulump;u) eerxfciydfat lieslt t2tmir3iy4llt  iesa(faruaump;u4oeto f3ils sDrm(ms t0 exrxfcoytlpDrluvilt0 exo(r3iu4alenlfctltfsrtrxm nu1olxnif3tys mDean p (0 ltrxr iotlm   ueils0s2toxmpou4lp n nct tfs2rmx pot1olt  ociysfm rmuvp;u0 etnir oadoaD  nvsl()t2uoxm3nu1lpee feiltfsDtr(  oo4oee if3ildla2em(vp u0altnmr tydlp  lneils teurxmpoudol elnvtatf 2rr(ront0tltn f3iadlm ul( p t4 leoiocoatopteanvo (0srtr(o oy1openlfvi ()arua(  ;o1aeeomi3iytla2ulu s;()trxnmfctodfaDelu s;s) exo(mpnu4apen ivslt a2ur(mpou4oleo ociadfmDumn s (0 ltrmoctatlptrln s;t)s2uoim no1alee fesas) 2rrx p;t1oex mociydfa2ran o;t) eenif3iotop rau ils0t2um(rpoo4ameemivta(fs2rrx p;u4apen i3iltla rau p;t)alermr3ootoptrluvols0texrxopnu4om nmnci s arur(r nt1aleoifciyd sDrlnvonu0 eenifciytomt anvi;s srtmir3iu1omtn iet t srtm(mo;t1opxoio3iat m2el( s t)artrio3iydfpDrli o ( trxoim3oydll elfvsls srumu o;o0oleomieiad m2rmuvo (0trxnxr iy1optr nvo;t srtrio iy4am elfesa( a2uru ono0aetoifeiysls eluvo;u0artoxo iotoa elivo (0texr(opoodlp nlneslt srrrur ou1optnmoetys s2umnmp ()tlxrio3ootomte i slt  2toxrpoy1aleelfvta(fsrta(moou0texomf3tld m umnms ()alxrio3oatlm  livils0t2xrir oo4lltn fcsls)sDum(mpno1alen iciyd a ea(vp u4altomfciydlpDrau s;s)srxrirpnudole mnesl(f Dra( o;t1aeenmf3iat m ran sn()texrxocoa1faDrlu ols)srumimpiy1oltnmfes () rum(  ou1aleoio3iat s rln s (4teeoxrcoa1fat  i i s)texr(opoudop n ivta(fsrta(ro;u4alxnmfeiysfa2emnvp ()artrxfcootlaDean olt)t2xrxrpiu1lmenmnvil()a2rr(  ;t0oleoiieils mDua(vpn() rtnir3iadfa rlueil( setrio3iy4opte fes sfarua( p;t4tptniietysfa2emnmsnt0trenif ty1lateaneo;(0 rtmxrpou1lpt mfcilt s2uru pot0tpx ifciltlaDea(mp;u0trenircoadla eln ils0trtmio3io4lpe miesa(f Durxmoot0aleo i3tltls rm(msn()teerxf3totfa e ivo;(  rum(mpiy1optn net s  Drrxmpou4apxn fcild m2rm(vs u) rtrxo ia1op r u i (0s2xr(opiu1openmict ()s2rr(  ;u4olxn fciad m ra(mpn() rxrxf totoat anvi ()t2xo(r oo1lmte fetat)srrau onu4olxomfeiyslm2eanmo u)tltrir3iydfat  i sl(0 rtoxo3nydamt lictl(fa2rmu ooo4oetoiicildlsDumnmsn(4 leomo3totla   uvo;(0srxm(rpny4alen ivt t)a2umu  nt1tlt ioeiaslsDra( s u4trerio3iodfmDe uesl() 2uoxo3nodlptnlncil()sDrmuro;t0aptnif3iatfa2ul( o;(0tltnif tytfp eaueil(0texr(m3iy1opeelfeta(f rtaxm ou0apx ioeilsfm emuvs u4aleoif3ia1oaDr nes ()tetmxm nu1ale lfcslsf Dumu  oo1aetn o3iyd a um(vp;u0trtrmo3oo1oa r nvs s)truo(mpiu4aptn fvtlt aruaump;t4apxoii3ildla ua( o t4aetrmociadoatelnei;( srtmxr iodlmtn fcs tfsDurxrp;o0olxn iciyd aDelu p;u0teenio iydfat lu o (0s2xmxo iu4opte feias) rrmump;u0olxnmociltls2umnms (0artnmr iydfpDeaivi;t0 rto(o3oodame lfeiat artmurpoo1opxnmiciat aDelnvpnt0 etnirctatlate i ilt srxoim3io1opeemnct ()aDtrumpnu4altoioctat sDeluvs ()treoxf iotomt  u s;(0trumirpoo1alt lieia(f 2rax p;u0optoiiciysfsDrmuvp (4 ltnxf iatopteaivol(  rxrxopno4ame lnetls)aDtr(rpno4olt mietas a2em( s (0artomocoadlpD aneslt0srtm(m nodop emfvt s  Dtru  ou1altomoetlsfs emnvs;u)altrif3iatlmt livi s) rurim io1ll elncil( aDrm(moou4opt ioctytlm2ul( o t4tltomfcoytop eaneilt s2tmxrpiy1lltn icsltfsDum(rpnt0tleoiieilt a uau s (4 eermocto1fateaueo;s)t2um(mpno4ll nmfvt sfarrm(mp;u1oet io3iasla2rln o;() renif ia1lpDean s;s0 2urio3oudalen ictls)a2taxronu4tle iicild a rmn p;t) eenxf3iotlmDelu i ( trurim nu4lp nmicil( srraxmpou0alxo ieilt m2rl(mpnu4teeomfciodoaDeanei ()texoiopoydap elnvs t) Draxrp;u4tptoifetadlm2ran o;u0treoxo tydfmD lieilt trtoxo io4lpee icslt s2ua(moou0aptomietlt s ea( o;()texoif iydfmtr ivsls0 rtoir3ny1oleemfvt tfsrrm(rooo0tee  iciasfm rm(msnt0tltrmf todomD liei s) eumir ny1omee fcilt s2rm(r ot0aptn i3ilt s2em(vs t4tetnmr iadomtraues;s sexoir3nu1lpeelfvias a2trxmp;u4apxn o3iytfs uluvpnu4 rxrirciotfmte ivs s) 2xm(r oodlme lnci (fs2tm(root4tet  f3tyt m ulnvpnu0areomoctytlmD li o;s) rto(opiodaltemnvt (f 2urxmonu0tpt moctls m2raums u0 eeomr iotlpt li s s0s2toxr3iodll nmfesas  2ua( pnu1aexomfciad a2ranvsnt0 ltoxf3iytfmDr ivo ()s2trxr ou1oltnmiei ()arrmxr ;t0aetoif3iaslsDumnmsn()treoif oadoat  uvi s)t2to(r3oo1amtnmfvsls a2rmu onu0oetnmo3tatfmDemnvpnt0 rtnmociytomteln s;s trtrir oy4ol e icsa()s2urxrpoo0aexoio3tyt s ulumo;t4trenxf3iytoatrlivi;t tetm(m oydamt lies (farumu pou1tleniietld sDrmu on(4 eeomociydfptelnvsl()s2trimpno1apeelnvsl( aDraxrp;t1olt mieiys mDelnms;(4 etrmr io1op ean s;s0srum(rpnodoptn ivtas) 2urxmp;t1optnmf3iydls2uluvo u0tlenmo iatla rlnvi s)t2xm(o3ny4lleemnct tf 2umurpot1teenii3iydfa raumon(4 ltomrcia1omtrln ol() eur(rpoy1olenmfcta()s2taurp;o1tpxomi3ildlaDuaumpnt0aleoxocoytfa rai sl(0texmirpiy1olt mfvi ( sDtr(rpot4altnmietadfm2uau pn(0altnmo oadop e n s () 2xoxm oo1lmeeliet (f rta(rpou1tpt  f3iytfm2elnms u0arenif ty1lmteluvs;t  rtoxo oydopte icsl(faDrrxr nu1oeeo oeildlm2umuvp (4aetnif3oatfaDraivilt  euoimpoy4alt  ivtl(fs2rr(  ;o4apeomfciydfa rl(vp t0 exrifciotfp  luvo;s0trxoxm oy4ole  nci s  Dum(m nu4oetomi3iltlsDumnvpn(4 etrif iadop   u o s sexm(rpnydoptemnvia() rur( ooo4tpx  f3tlsfmDul(von(4tetnxf oadfmD aneils)trxo(rpnydll nlnct t  2rrxrpoo0oleoiieiysla2eau p (4arxnmo todomD  ivi s0sexo(r oudolee fvsa(f rrrx ont4apx iociadlsDrau p (0 rxoif3totfp eau o s t2ur(o3io1altemfci tfaDraxro;u1aexn o3iytfaDum(mp t0aleoxr3oatfpDrai s;t trxm(r3no4ol nmicia( artru pno4tpx iiciyd aDel(vo t0aexoio3tatomtr ies;() etoxm3nu1ame mfei t) Dtr(  nu1apt  fctltfa2emnvpnu0tetoxf oodla   u s;s)s2um(m3oy1apenmfvt ()s2tmu oot4oleoifciyt s uluvon(4 lerif3oydfa rlnvs t)teuoimpiu1apt mnesltfa2rau oou1aleomo3tysfs2em(mp;t4trtomr3iydfmD luvs;t)setmio3nu4lp eliviatf rraxroou0olx moetadfa2uanvo;()trtrmf3oa1lm eaivo;(0t2um(m3io4apt mfesat)s2uaxrooo1oee ifetad mDumnms;(0 ltnifcoatomDr n ilt teuoxrpiudaltnlivilt)srtau  ot1aeenmo3tldlmDul(vpnt) etoxr3todfpt  ivs;()setrxm3iodalt mfvil(fsrumx  no1oet  ieiasfaDuaumpnu4 lxrxr3to1la   n s;(0 exr(mpio4omtnlicils arrmu pnt1aexoioeiadfs rm( snu0alermr3iodlpDean i;( sexm(rpnu4ll   ictatfs2raxr ;t1tpenmicild m2emu o u4trtrio3iy1fmte n i t teum(opno1opt mfeilsfaDuax oot1apeoii3iasls ua(vo t)teenxr ia1om  lnvi t0texo(m oy1lp e icslt)aDta(root4alxo iciadfs2elu snu)aeerxrciy1oaDeanvs;s0 exr(mpoudaltemfvsl()sDrmurpoo1oeeo fcild m eau onu4aexnxr iotlmtrlies (0sruo(rpiodole mfciatf 2raum ou0apxomf3tadlaDrmn pn(4tlxnir3iodfpteaues ( truoxo oodomtnmnetlt srtaxm nu1apx mfeiydfm ran p;t)alxrir oy1lat luvsls)sexo(m3nu1lmtelnvtasf 2uauront0alto oeiytls ul(vp (4aexoxfcoa1fm r u i (0seto(rpou1ope  fvtasfaDrmx pot0alxo feiltls2ul(mp u0aeerxf3tydlpte ies;(0 2umxm ny1amtemfctat) Dta(  nt4aeenmieiadla umn s t4altrxr tatfmt  u i t0seuoxm oodomeelici s)arrmxrp;t4oetoioeiytls ea(vp u)tltoifcoo1fpD  ieo (0t2uoim3iu4lp nlict tfa2rr( ono1apxnmoeiys m2umnvs;u4artoxr3oo1lateanvs;() 2tr(opoo1om emfviat) 2trxront4alxo ociasla2ranmo t0alxoxf oo1omD anvslt) rumxr ny1aptn nvilsfarraumont1apeomieiadfa elumsnt0aexrxo3oa1fp  ai ol(0setm(o iu4lm  lnctls  rtm(m oo1aexo iciytlm eau snt4arxomo3oydoptelieo s0 2ur(r iydll nmfvt () 2umxmpot1tex mociltlaDelnvo t)alxnifciotoa elivi s sexrxrpnu4altn nvt s  2rmumo;t1texo ociytls2ua(ms;t4 exoirciodom   uvilt t2uo(o3io1alt  icslt) ruaur ou1texn fetysfa ra( o;t0tetnxfcoa1lmD  uvo;s  exmirpno4opee nvils) Dtau p;t1apeomoeilslm ua(vo;t)tetnxrcoydfaDelnvi;()seuoirpoudlmt lneia(f Drrx  no1tleoiictldlmDemnmo (4 lermocio1la e i s () rxr(m ny1ope mivsatf Drau onu0altn oeiad s2em( p u)altnmfcto1fmD ln s;s)srxmxrpiy4ll elneilt srraur nu0opxoii3iad m2umnvsn(0aexnxf3oa1lm eanvs t) rurxrpoy4ap e fvs t)aDra(mont1alxniieiydfs2rmnmp u) etrxocty1fp e n sl()s2tr(mpny4lm emivta( s2rmumpot1texo i3iyd a eau o () lxnio3iydlmtranvi;( seum(o3oy1ol  mivsatf rtax poo1oltomoctlsfm uan s t)areoiocoadoa eaiei s srxrxo nu4ap emfci ( aDra(  ot0aexn ictadlsDea(mo;(0alermo3ootom  aieslt) 2xm(r io1aleeliei tfa2rauro;u4tpt mfeiys mDeanvonu4 ltnio3to1lp r i s s srurxm iy1lltelnesltfa2ua(r nt1oex miciytls2elump;(0arenmf io1fpDelnei;t  2uoxm3iu4ap emivtls s2rruront0aee miciys s ul( s;t) etoio3ta1fm e nes;s0 2xoxr3iydamtn ivt ()aDumxro;u0opx if3tldfsDumnms t0 rerxo oodlp r ivolt0 2toxrpoodale mnciatfsrua(ront1tpeomfeiys s2ul(mpnu)tltrmo3oydop elneo s0sruo(r iydope mieia()sruaxmpoo0tetnmfetyt aDemnvs;()teermo3oadom e u s (0setrimpiu1alt micsls aDum(rpnu4apxnmfeiyt mDelnmo u)aeeoio tydfa rln sls)t2xoxrpny4lpenlnct (fa2uaurpnt4altomoeiat s ra(mpn()teenmf3iodlpDraivs t) eumir oydomtelnci ()srtrurpot0oexo feilt a ran sn(4 ltoxf oytfmt  ieols t2urirpnudopeemfvils  rumxrono4oetomicils s2elnmo u4 ltoif3oodlp   nvs;t)setm(opoodal nmicsl(f 2tm(m ot1tlt mf3tlt mDemu o;(4alxnio3ia1oa rau o;t)trxo(mpou4lpen ivtatfaDrr(mono0aexn ictlslaDumn s ()tlxrmoctydomt lu o t)srto(m oy1lltnmict s  Dra(r ot1aet mi3tasfs ulu pnu4 rxriocoytomtrlues;(0t2urxr3ny1ole mnvi (fsDurx ooo0aex  ociad s2rlnvp (0teermr3oadopD an ils)sexm(m ou4ameemfesa(  rrru o;o1tlxo fciyt aDulnvpnt0teerxo3tadfat an o;(0sruoirpny1lpe  ieiat  Duaxmonu1tpxnmo3tydla2rmnvp t4alxrio3iytlmteanvs;(0trtmxrpiodlleemnvs sfsDtaur oo1tpe  fcilsfs ua(vp;() lxrirctydfp  lues t0texo(m nudllenmfei (  rurump;u1aexn oeiatfaDumnvp u)arenxr3totopDrlu slt0 2trio3nydll nmncs t) 2raxmo;t4oetn ieiytfm rlu on(4tlxrirctydomt  n o t0sexmxr iy1opt licsl(fsrtm(mpnu0aexniieiatfa2uanvpn(4 eenxociotla r ies t0texmirpiydol   neiat) Drrur ;u1tle ifciatlmDuauvo (0 rxnifciy1fa e u o s trxmim oy1lptelnesas) rumu  ;o4aeen ietld m umnmp;t0 rerircoa1fptr uvo;s0s2tr(r nydlm e nctlsfa2uau p;u0aetnioeildla2ra(vont0treoir io1latrlnvs s)s2tm(m3iydll  livsa(f Dtm(mo;u1ape  iciadfm rl(vs;u)tlenxf3io1omtr ueol() 2um(r3oo4lmenlieil()srum(mp;t1oetnif3ilsfm emn onu4teerxfcty1fa  luvo () etoxr oo1apt lfcsltfa2um( ono4tlen oetlsfs2ulnvpnt4aetnmr3ty1fmtrlueilt0 rur(rpny4ol nmfvil(f rrmxr ;t4tltomoctltls2ranvs;t0alxomoctatfmDrlivs t)t2trxo3oo1lp nlnetl(fsDtm(m ;u0aeenioeiad sDeluvo (0tlxrmo ty1oa  lneil(  rtrxo oy4lm elneias)sDraxmoou4tltnmietatls2ea(mo;u4artrxr tadomD  u o s)s2tmxm3iydol   ivslsfarrrumpou4alt ifetadfaDem(mon(4 rtnxrcto1lmDeln s t)t2xrirpnodlmtnlietas) Duru p;u4tltn feiyt sDelnms t0 lxrmrciytom rlnei t)trtr(r3no1ome livt sfaDtmxronu4open ieildlm raumonu)areoio3iytlm  aivs s)s2toiopnydomeelnci t artmx pno0apenmi3iydfm elumsnu4 lxoio tytfpt  nesl(  2to(o3iu4omtelfet t s2rrurpno4tetnii3tys m2ua( pnu0texnifcoytlm  aues;t) etrxrpiu4op n ivsatfs2ra(rpou4oee mocils a2eaump;u4trxoxf3oytom raueilt)truo(mpiy4altemfetat)a2rm(roou1tleomoctysfa2elnvs;t)trxnirciodoat  neol( t2uoxm3iu1olt  iesat  2umxr ;u0ape mociltfs ranvs u0trxrxfcoodfa eau i t0setmim iydomtn ivi (fs2umump;t1apxo ieiatfaDuau p ()teenifcootlmD luvs;( s2uriopou4lleelfes tfsrumu  nu4aleoiocilsla umn on(0alxomfcoadomD  neo;s s2xmxr3nudllt  fcsat  2tm(r nt1tetnmfciaslm2em( o;u0aexoif3ty1fmD anei s) exoxo ny4am e ncsl()sDrmxm ot4aetomieiydlm ra(mon(0tlerifciy1laD lu o;s  2xrio io1ape  neiltf 2trxr ;u4opxnioetat m2rlnvs;t4aleoxo3iytop  lies s)trum(m nudap  mnvsls arum(r ;o4alenifctasfsDrmuvo (0aleoxrcoo1lm  aueil(  2urxopiy1optn nvtlt srumur nu0aet io3iadlm rauvp t4altoxf3tadlm  luvilt trtoxr io1omtnliesls)sDtrxrpnt0alxn fcias a rmnvsnu0 exnir iadfmD  u slt s2um(mpno1lle lnci sfs2taxrpno1oee mf3tldlaDum(vs;t) eeoxo tadop  lu ol( s2xoir3nydllt mici (fs2uau  ;t1tleo octytlm rl( ont4areomfcoy1omteluesl( sexriopny1om   fetlt aDraum no0apen ocils sDelnms ()aeeoxo3iadfaDelnvo;t srtmio nydoptelneia()srurxrp;o0texoioeiadlsDelumo;u0teenmo oydlm eluvilt) euoirpoo1lptelfeslt)aDumu pno0tltomictydfaDelnvo;(0tetnmrciytlpt aneilt0 rtr(o3no1lm nmfvils)sDua(r oo4aetnmi3iltfm2emuvp;(0 lxoio iotfmtraues;s0sexoxopnu1ame  ieia()srua(moou1altn ociat a ran o;() rxnir3iy1faD auvi t) 2xriopiu1al elfcias) Dua(  ;t0alenio3tldfm rln s u0alenxo3tytoaDr i i;( t2uoir oo4omeelnet tfa2rm(mpoo4tlxnmf3iat a rm(ms t4arerircoy1oa r ueolt seum(opnodoptnlfeslt) rrr(mooo1aeen i3tysfm2rmnmont0 ltnxocootfmtelieil( seuo(m3nu1lleelfetlt aDtrxmpnu4aetnmf3iys a2eauvpnu4 renxr3ootfpDrauvslt0 2tr(o3ou1ap e ictl()sDrrx p;u1aexoifeilsfa2umumpn()trxrif totop eaues;t t2urxrpiu1lmee netls aDtrxmpnt0aeeoif3ilsls elnvs t4tltnxr todlmte n s;t seum(m iu4apeelics sf rtaxm no1oltnifcild mDemnmpnt0 rtnxr to1fm e uesl(  rtrio3io1lmtnmfvsat) Dtau pno0aexomfeiadfa2emuvsn() exrio iy1oa eli sl(0seumxo3nudale  ncta(fsDtmxm ot1aetoiociyd aDuaump u)aeeomo3oodlmt  uvo;t  rur(o oo4lp elieils) Dtax pno4olx ifeiad m eanvonu0 eenxo iydoa eau s s0 2trxo oy4amee neil(  2uau pnt0ope iiciasls2rln pnt0trtnio3to1oa eau i t)s2uoiopou4alen nvil(faDumxrooo4oex  oeiydlm2um(msnt) rtomfciy1op e i s;t)srtrio3oo4lmenmneils  Drmump;t4tpx ioetldlaDrmn s u4tetrirciatlaDe n i;t tetoir3io1ame lfetls srtmx poo1opt iietys a2um( o;u4trtrmr oatoaDeaueols0teuoiopno4ap n nvslsfsDtax p;t4tltoioetyt a2ua( p t)tlenxrcootlp rluvi;()t2to(o iu4lp n fcia(faDurxr ;u1aetn ociydfm2eau p;()arxoi
\ No newline at end of file
@@ -0,0 +1 @@
+ueils)sruriopio4amenlfesatfsrrmurpno0opt mo3tat aDulu pnt4teenir3ty1oaDe ueo t)seur(mpiydllt liesasfarururp;o0oltnio3iadls ea( p ()treoxrcoadfpDe u s s)s2trirpoy1llt  ict ( sDtmx p;o4oltomocildfa2ua(ms () rxoif3oytfateau ol(0 rtoiopiy4opee ivs tf Dra( ont4alx miciadfs2emumsnu4altomr3io1oa  auvolt0 etr(o3iudlm  liciat)aDrax poo1alxn ictad m2um(vs t) ltrxocoytlatr u olt)trtmiopny4om  mfeslt a2ur(mp;o4olx mfeilsla emumo t)texomrcoatomtrai s t0srtrxo ny1ape lfvtl(f Dum(  ;t1aex mieiysfsDua(mont0 rxoxf3totlp  aiei;s setrxm nodale liei s aDua(rpot1aetomi3iydla2ulnmp (4 renmr3oa1lp r n slt teuoxr3ny4lmtelfctlsfs2tax ono0aex  ieildfsDrluvs;t4texnxo3iydlaDeluvsl()s2tmir no4lmt  fcil()s2ua(moou1tpe  ociasfmDel(mp;u) lenifcoadlm   ivolt  rxoir ny4ape lnesas  rrmx o;o4oeeoio3iltfa ua(ms;u) rxrmf3iotomDrlivsl()texoim3iu1ll emfes (f 2trum ;t0tlxoio3iydfm eaumo t) rtoirctydla  luvi t setoim3iu1lmt  fciltfa2taurpot0tptnmo3tydlaDelu snu0tltnxo3oadlmtr nvo s0 2uoir3iudll  mncta() rururpnu1texnii3iadfm uau on(4areoxr3iytfa ean ilt0teurio iu1amtnlnvt s  Dtmxm ;u4tpe  octldfs2rlumsnt0trtnmr ia1faDrlues;t)s2tr(mpoy4lleelnciat) rumxm ;t1apto oeilsls elnmo t) renmf3io1oaD  ivs;t)tetmim nydlpeelietl(faDtr(mo;t1oeenmfctltfa2ean p;u)tetnmrciytfpDranvols0 2toxo nu1aleelfvtltf 2ra(  ;o1tltomictytfa2emu p;t) lxnio iytomtr n s s0trtoir3oy1lmtelfetlsf Dtmu  ;t4apx  i3ias mDelump u0alenirciodlatrln i;( seumxm3iu1lmt lnetl()artm( o;t1tltnioeiytfm ulnvo t) rxoio iytla elneo;t  exmxo nu4oltemicsas)s2rrx  ;t4aleoif3iatfm2rmnmonu) lxomf3iytfaDelnvs t t2tm(m3oo1op elfvi t)aDtaxr ;o0tlx  ieiytfs raumo;(4aeenmrcio1fat li ilt0 etmxopnu4lm   fvtlt)s2tru ont0tlx moetys aDrm( s;u0teenxo ootlmtrlneo t0 rurir ny1ole lfcia( arurx pnu1tlxniietysls2raums t0teerxo3to1fmDeaivi ( tetriopiu4llen fct s  2ta(moot4tpenioetltls2eluvp;(4tleoxf3tydfp eliesls0srxrxr io1ameemivs t aruaxmooo0alx iieiysfaDum( o u)alxnir totom   i slt)s2xrim no4altnmncslt artmuro;t0tpe  oeildla2rm(vs t0aleriocoydfa  liei t0 etmxr3nydlptn fvsat aDtr(moot4oltnii3tydlm2ua(mp;u4 lerirctatfpDe n olt) 2umxm3iodomenlfcias)aDumu pot4oeeoio3iydlaDeluvp t) ltnmr iytfmDeanvo t0 eumiopiy1amtemfvt ()arrauro;o4ole  oeilsfmDuln ont0alxnmo to1fpD  u ilt0 rtm(o3ou4amt licsas) 2trur no4tpeo i3iatfs ra(vp;u0texnxo to1fpDeln olt)seumxr ny1lmee fvtlsfsDururp;o0apeo ociatlaDeluvo t4 etrxf3iatopt ai o;t setmxr io1lp e ivsl()arumxmono4aeeomoetytfs el( s ()trtomf tydlaDean ilt)sexo(r3iy4lmt liet (farurx  ;o0teeomoeiyslaDrl( o;t4tlenmf3tytfp eanei;s trxo(r3ny1ole  ncta()sruax pou1tet miciyslm uauvo;t0texomr tatlmDrlivo;(0srtrio no1lp elneiat) 2uaumono0oexn oeils mDrauvo u) etnif3tatlatrai o s0 euoimpoydol   ivsl( a2um(mp;o1oltnmo3tlsfs uanmp (0 ltomf3oo1fateaivolt)trxr(r3ny4lpt lnci tfa2tax poo1oet  ictatfa uaums;u)teenmr3iytoptr i s;t0trxm(r3iu1ale lnetasfaDrmu pno0tpx  fcild s eluvs u0tltnxociodoa elnvils t2urimpoy4olt mnvtatfsrtr(r ;t4altoio3ild s2umumo;u0aexrmf iydlm eanes;t0 2xoimpiodllenlneta( sDur(r ;u1tleo oetasfm2uanvp t0 eeoxrciydlmDe ies ()teurir3oo4ome lfeias)artrx o;o1ope  fcilsfs rl(msn(0aeenxr3oadfmt aieil()trtm(o io1ap  mivslsfa2umxrpou4aee moctatls2ra( p (0areoif3ty1fatr nvo () 2um(opoy1lltnmfctl( s2taur nu4tltoifctydla um(vs (0 exniocia1la raieil() 2urir3no1ll e fvs s)a2ta(mpot4alx  ociydlaDuan snu0treoxf oadfmt lnes;s0tetmxo oodlm nlncils sDra( ooo4optoii3ilsfs rlnms (0alerir iotlmDe nvilt0 ruo(opoy4apte ies sfarur(m nt4aexomo3iyd m uln on(0tleoxr iodoaDeauesl(0 euo(o3nu1lltn ivt s)aDrrxrp;o0apx mi3tld a2rmnvp t4tlenirctotlpDelueo () 2toxr3iydol   ncsls)arrm(mp;t1oltomfeiydlm em(mpnt4tetomf3tytlaDrauesl(0 etrir3ny4olt mnesat) rtmum no0aleoiictls aDul( p t4 lenmf3ia1lptelu ol(  ruoxrpoy4op elfvs tfs2umxrono4texn iciyd s2rau s t)tlxnmrcootlm eau sl(0t2tmxmpiydap n fvtat) 2tm(ro;t4optn fciadla rmu p;()arermfciotlmtr n il( s2xr(m iu1lm   icta()s2tr(rp;t1oltniieiyd a2eauvonu0 rxrmf ta1fm r n i t0srtmir iu1lpt  icta(fa2rmx p;u1opx iociyslaDel(mo (0 ltrxf iadlat aivo;t0srtmimpou1lptelfvias)s2taur ot0aexnmoeilsls2uan s t0aexoxf3io1lpteli i;s0seuoxopiy4ll   ivias a2rr(rp;u4teto ocilslaDrmnvs;u)tlxrxf iatfpD  n s;t0trur(o3io1ll  mivs (fsruaur nt4oee ioeiat a2rmnmp (4 rtrio3todfpteluei t t2xr(opiodol elneilt  Dtm(ro;t4aee mieils m2elnmp t0tetoxfciatfa  luvilt)seum(opoo4optn feil(fa2ta( pou0apx moctlsfm ea( p;u)tltnxrcoytopDelivo () 2toiopou1llt mfvsls) 2rrumpoo0tleo ietytfaDulnvo (4 renxf oytom rauvi t trxoio ny4lleemnet () Drr(m ;u1opeo o3ilsfmDea(vs ()aeenio3oa1lpt lieils0s2toio3oy1om nlictls sDurxr no4apxo i3iysfm ean p u0trxnmoctotlpteln o t0 rtrxrpoo1oltemfet sfaDrrxroot4tptnmiciytls ea( p t0arenirciy1oa e ivo s0t2xrxr nodoleemfetas) 2raxrpnu4alen ieiadfm emu o (4tetoxf ta1lmD an ol( sruoir3nu4lpe  fci t)artaumoot1olenifetatfa em(vs u0aleoxf3iytlp eanvo;t0s2toimpno4lpeemnei sf rtm(rooo1olxoiociat m2eanvp;t)artoxo3iytfa rln o (  2xoim oy4om   icilt s2ta(  ;o0tee io3tydlm2ul( pnu)alenxr3ootomDeai i;s srtmxm iudolt lfvtlsf Dtax  ot0tptnmi3tldfa uauvpn()artnif tatomDr uvi t  rur(m3ou1omte fctls arurxmo;u1tee  feiyd m ua( on(0tleoxr3tadfptrlnvol( s2ur(m3iu4am emnes (  rrax o;o0opxomfciydla2rlumo;u0 etriociadom rluvo s setm(m3oydole lfcta(f Dumumo;t1oeeoifeilt s uluvp t0 rxrmocto1lpteanvs;t setrim nu1lmee fcia( aDuaxm oo4tltomfeiadlm2rauvp;(4alxnifciytomt auvol(  rtrirpio4am e nvsas)sDumu p;u4aexoiieiat aDemu sn(0aetnxrcoydlat  iesls t2xmir iodomtemfes s)artm(rp;o1opxoiociltlaDrm(vs u4teenxr3iy1lat an ils0teuoimpio1al elneia(f Draxmont4tleomoctydls em( s t4tetrir3oatla   n o;() rtoim no4ap elfvsa( sDrmxrpou1alt moetyslm2eluvpnt0 rxnxo ty1lat  u ols  2xrxo nu1oltemfeslt sDtrurono0tptoio3iatfa eaump;t4alenmocoa1fptr n s s0srxmim3oo1ll nlieiat)arrrxmont4oexo ieilt sDemuvsnt) rtrif3totfaDrai ol(0srurxopio1alte nctas) 2uaxroot0tlxn o3ildlm umn on(0alxrxfciodoate nesl()t2uoio3ou1ap n nvt t  2taum no0optoif3tys m2elnvo t0artoxocto1fmtean i s)t2trimpno1lp e fcils  rtmxrpoo1tltoif3ilt sDemu o;u0aetnif oadfaD lnei s0trumirpiu1opeelneias aDrau  ot4tleo ieildfs rlnmon(0tlxnmf3iodlaDe ivs;(0 2xoim3oydopte nvt ()sDur(  nu0tetnmociysls eauvp;u)trtoircootoaD  ieilt)setm(opio1al  lneta(fa2tmxrp;t0oet  o3tldfa2eau snu0 ltoxf io1laDrlieo;( trxmxm3oo4omt livsa(f rrax  ;u1tpx if3tyd sDrmnvo u0 lxrmo oadlmt li ils0 eurxo no4ole lnviat  Dtmurooo4tet ifeiytla rl(mp ()areoxfcoydlpDr u ol()texm(o3ny1olt mnvtlt)a2rru oot4oltn oeildfmDeluvp;()aeermr3iytoaD  u s s0trurxo ou1ale mnctas a2uaxmpoo0opto fetydla ean pnt0alenioctotomDeanvils0teurim3oo4ol n nei t)srraum ;u0tlx iociytlmDeln p;t0trerxrcoodlpteauesls0 etrxrpiudopen ivia() 2uax p;t1tpeomf3iytfa2rl(ms;t4teerxrcoodla rln i t seuo(r no4al   net t)sDraur ot4aexoii3ias s2emn s u0arxomo3iodoaDrai i;( srurio iu4ole  fcslt)sruax ono1tltn icias mDulnvo (0aexoxo3tydoa  aivols)trtmxm3io4ll elivt s)s2ua(rpnu0altnmoeiatlmDean o;t0trtnmo ty1la eluei;t)srurxo3nudameemnes s)arrau pot0aet  octlt a um(vo;(4trxrmf3ootfmtraneilt)s2trio iy4ll e fesat s2taxmpno1texo o3iadfmDemu p ()texrxrciodfa rluei;()trxoxo no4ap nmicias s2tmu  ;t0oltoii3tyd a umnms;(0arxrio3ootoaDrlu ols)s2xr(o iudlmtnlfctls)sDtaxrpnu0olxnif3iysfaDea(msnu4 exnircoydfm eaivsl(0setmiopoudal elicsat  rrm(rooo1oexnifciyd m2ul(vo;t) leomf3oa1faDe u i;s srxm(rpoy1om emfviatf rrrxmpou0tlxomfetatfs2eanmonu0tlenxo ty1laDr ues;() 2to(m3iodaltnlietat aDurumo;o1tltomo3taslmDrlnvp;(4aeeoxf oa1laDr i s (0tetr(rpiy1lm e ncs s)s2uaxmont0ale iociysfm2rmu p;t0altnxr iotlp  lu i;s0 exr(mpiu4am   fct (fa2tmurpnt1oltoiociytlsDuluvonu0 lermo3todla   u ils) 2um(m iu4op n iesa()arta(ro;o1oetomieiltfaDelump;u4tetnio3tytoptranesls0teto(r oodop elfcils aDraumpno1tpeomfeilsfs um(vo t) rxnxf3ia1fm rli ol(0truoxm3nu1ome mfes t  rrax pnt1aptn i3iydla2uln s u0 lenir3ootoaDraivi s) 2xmim3iudol  mnei sfa2trumpnu0apenioeilslmDemn p;u)tltomo to1fm e uvolt trxoxopoydapt mfet sf rrm(r ;u4tptoiocilt aDrm(mpnt) etomf oydopDe ueolt)texr(r3oudomeelivsl() rra(mp;t0apx moeiydls2ulnmo;(4tleomo tadom ranvi;(0sexmxm iudoptnmfctl(fsrra(mpno1aeeo o3tld s rmuvont) leomfciydopte ueo ( t2uo(m nudame lnvsasfsDua(mo;t1tpen ieildfmDuau o u0aleomoctydlat  i i s)t2uo(opnodaptemnvtlt)srur(roou1tleoifciytfs2umnmon(0aeeoxfciodlptean ol()trumxm3ou4lmeemieil()srtaumooo0opxoii3ildls2elnvont0aeerxf3tatlptrai o;(0 2trxopiy1lme  nvsas  rtrx ono1olx  i3iytlaDuanmont0treomr3iy1oatrai s;()setmio no4ol elivta( aDta(  ou0optn ictldls el( o u0 renmf oatopteluvols teum(o3iudolt lfct sfsrtaxmpnt0apx  fctlsfm2uau s t0trermf3to1fa   u s;(0sexm(opnudamtemiei s sDtruroot1tet iictasfs2elumsnt0 lxoio3tydomDelivilt) 2xo(r nudalee nesa(farrru ont1oltoioetys mDemnmonu)arenxf3oy1oat ai ilt trtoxo3oy4omtnlivilt  rrr(rono4alxoiictyt m uau sn(0aleoxr ootopt li i;(0sexrxr3nodomt lnvi tfaDtrumo;o0alt  iciasfm uau p u0tltomr3totla   neo (0 exmxmpiodlmenlfcs t s2uau  ot4aexnmo3tat a rmn s u)arxnmo to1fmtraueil()trtoir3io4al n ivtlsf 2taum ;o4tlt mietas m ulumo;u4 eeomf ta1fate neols)setrio3ou4llenmivsls srraxm ;t0oee ii3tltfa2elu p;u0artrmf3oytfmDr i ol( srtm(mpou1ome mfct s)artaum ;t4tet moctaslm rluvp;(4 eerxoctadomD lnvo;t)srxoxrpiu4lpeemnci t) rta(mpnu0apenmfctadfs uanmonu0tlerio tadop  auvol() 2toxm3ou1ap nlietl( aDtr(rpou1oltnmo3tyt mDranvs t4treoxf iy1omteau i s tetmir iydomt mnetlt) Dtr(moou1ole mfeiytfm2eln s t) eerxociodlmt lues;s0t2xmxo3iu4lle  fciat  2tmxmo;t4teenmo3ildlmDrm(mp;(0trtoxf io1om   nvils0 eurxr iy1altelictls)a2uau  nt0ale mi3ilt sDrmuvpnt4 etomfciatfm elneo;t trum(mpnydlm nmnvsa(fsrraumpoo0alx  o3iyslm uau snt0tleoif3iatfaDrlnvs;s0s2xoxm3nu1amtemfeta(fsDtru pou1teen ietysfa um( p;t) rtomf ia1fpteaneo;t)sexmxm oo4lmtelictlsfaDrax  ot1optnmociys mDumnms;() rxrxr3to1op  auvi;(0seuoim3oodamen fcias)a2rmuro;t1ale  o3iyslsDuanmpnt0 ltnxf iatlmt  u ol(0trur(opnydam n nci s aDuaurpoo0tetomi3tys s umumon(0tlenmf3iatoatrau s;t  etmxo iodomt mfvta(  Dtrur ;u0tltn feias m2ranvont) rerio io1laD  iei;t0trtmim oydaptemnviasfarrm(mpno0opt mf3ilt a uanvsnu4 eenmr3tatfa rli olt0 2xrim3oy1lm e neiat srrrumono4tpe io3tatlmDra( o u0 rtnif3oydlp   i ils)seumxopnu1ape mivsatf rraxm nt1altoifciadla rmnms;()arxrxr3iydla   i s;t srxr(mpio4al nmiei s)srtmx ono4olen ociydlm2emn ont) rxnxocoydfm rauvils0 exm(r3io1llte fesas) rrmx ooo1aexniieias m eanms t0trenmfcoy1op  livo t0t2xr(rpiy4op  mictatfa2umxro;o1tpxnmo3ilsfa2ra(ms;u)aexrxf io1oaD  u o t t2uoiopoy1ale mfcilt arrmx ont1oleoio3iytlmDrmn s (0altomociotomteauvs (  rumxmpno4ll n ies s)srtau p;u0tet iieiysla ua(mo;u)aleoioctadlat aieslt0s2tmxrpno1omtemnvils) rur(mpou1alenmieiltlmDrmn onu4trtnxocia1fpt an i t t2tm(rpiodal n nvsat arrr(mooo4opxn o3iad aDeluvp;(4arerxociydlaDrlivi s0seuoir ny4ap n fvtl(fa2trxmonu4aee mfctldfmDum( snu)texrir3todlm   ieol()seurio oudom emivtasfa2taur ;o0olt  f3ild a2umnmo t)teeoifctodomtelies;(0 2ur(r nu1lmt  iesl()srrr(mp;t1oex mi3tltfaDel( p t4trxrir3iotomteli olt sruoxo3ou1amtnmfcil()aDtmx ono1ape iietlsfm ulnmpnu4tetoxr3ty1omteau ils0 euo(o3oudlmt micias  Durxmpnu1opto fetltlm2ua( snt) renxo3to1laDrlueo;t) ruoimpoydaltnlivtatfsDua( ono0texnif3iydla2eln p (4trxrxfciatoa e u sl(0t2tmxr3iydaleelnet t  Drrxr ou0oleoiociysfmDemn o u0tlxrxr tytfaDrai slt  rumir3oy4lmt mnct s a2umx pot1tptomo3iyd mDrlums t) ltrmr to1oa ran il(0t2toio3oo4lmen fet t sDrmx  oo1olen o3tyslsDraumo;t4trtnmo3ia1oateaneslt0tetmimpiu1om e icta()s2trxronu4apxn ietls mDea( o u0tlxomfcoydfptelnvils)t2xo(r3no4aptnlicia(f rtm(r oo0altoiociltls ua( p t4alxoirctydopt livi;s)trxoxopoodole lieslsfs2tr(root4oltniiciydla ean snt4aetrxf3to1omDr uvo;t)srxmir oodomte fct t  Dtr(moou4tpxoioeiltfs2ua(vp t) ltoxociadfpDraieo;()t2xrxm3nudlltelnvs s) rtmxmoou1aex  ieildfm2ul( p t0 lerxoctatlpD lneilt s2xm(m3ny4opte nvia( sDumur nt0texomfeiltlsDrm(vs t) lenir3ty1fatran s;t sruoim iu4alt mnet ( srtaxm ;u1apt iociad mDrauvpnu)alerxf iytlmtelnvslt) 2xmir nydlptnlics ( s2tmxroou0tpxnmoctyt mDua(vp;t0 renio3tydomDeaies s) 2tmxr3ou1openmiviasfs2rrxr ot1olto i3tys aDem( o;t4 lenxfctodla rlies (0srxm(r3nu4lp  livi () 2rru o;o4aeeoii3iyd s2uln snt0tetoir3iadlpte neo t0s2umxr3oo4lm n net ( aDrmu p;u0aet mo3iydlsDum(vs;t4arenxocio1latrlnvs;t0teur(o3ny4lpee neiat) 2umx  ;t1opx ifetld s uau s;(0tetrmr3iodfat anvo s)sexmir3ou1lpe licsl( aDuaumo;u0alt  o3tldlm2ra(vonu4tlenmo3iydfmtrliei t)setoio3oudopt  ies s)arum(rp;t4tltoifcildfmDeanmpn(0artrmfcio1faD  ivo;(  rtoxm3nu4ll elicsls sDum(mp;t0oex mieiysfa uau o u4 lerxo3ta1lm  anes s)trtoxm3oydlpt mfcs ( aDurum nt1teeomf3ias aDulnvp t)aexnxr3todfmtean o;s  eum(mpiu1lmeelies ( sDra(moou0tpxo ieild s elnvo (4 eerirciadlateln ilt0trxo(r3oudopeemncilt)aDumu o;t1alt mociyd a umn p (0tetnmr3todlpDeanvs ( s2tr(m3iudaptnmivilsf 2rrxmonu0apt mieilt m2elu p;(4treoxf3tadlpDe neo;s sexrim nydopenmfvias)srtm(mo;u0teeniieiytls2ul(ms (4teermo ta1oa  aiesls)seur(opny1ap  lneils  2umur ;o0tle  feiatfsDul(mont)aexrxrctatomDrln s (  eur(m3iudol n fcias)a2ta(r no1oeto oetaslm ulnvpn()artoif3oydlmD aivo;()srtm(o3iodam nmictasfsrtrumo;u0optn ictatfs emu s;u)tltnxr tadlm eln ilt) rumxmpno4oltnmnvtl(fa2umumoou1tlxomocild m2uaums u)tltrio3oytoa  anvi s) exmim3iy4optnmfvi s)a2uau o;u0alxniieiytlaDum( s;t)arxnmo3iytlaDr i s;s0 2xoxm3no4lptelivsl(farra(  ;u0altoiieias a ea(monu0texrmo3iy1latrlneolt0srtoxm nu1aptn nctl(f Drmumoot4tltomieiaslaDua( o;t0alxriociydop eluvil(  etmirpio4llen neiasfsDum(  nt0oet  o3ilsls2rluvp u)alxnmrcoytop e ivo;s) rto(r3nu1amte ivsat a2taxmpnt0aexn icias aDumumpn(4tlxoio3iodom raieo ()t2toxrpno1ll emivil(fs2raumonu4oee iicils a2um( p (4 eeomr to1lpD  u ils0 exmiopiudal e fet ( s2raumono0tpxn i3tadlmDel( p;t) ltoif iatlmDeaivi;( tetr(r3iu4omt lfvs (f Dta(r no4ale ioctadfsDranmo () etrmocootop e nei t)trumir nodll nliciat aDtrxrp;u1aeen o3tls m2rmuvs (0 lxnxo3iotfmt au o;(  eumxrpoudll nlnvs t) 2umxmoot0aeeoif3tltfaDel( pnt0trtrxf3ia1fptr ieo t  eum(r3iy1omtelfetlsfs2tmu onu4texn o3iasfs rau pnu)artnmoctodopD lies;s)t2umio3iy4amtnmnesa(fsDrm(rpnt0tee  fctaslsDemuvp u)tlenif3oy1lat auvslt)sexoxm iudapt lneslt)srurx oot0ope ifctys s ulu pnt0 rxnio3io1fmDeai s (0srtm(r ny1omt mnvtlsfsrrrur ot4texo i3ilt s2emnvo t0tetomfcty1laDr n s;s0t2trir3iy4ap   nctl() Dtm(r ;t0oex mfeiytfs ran s u4 rtomr3ta1fa  livslt)trum(r3nu4ll n nesltf 2rmur ot4texniociatfa em(mp u4trenmo tadfpD lieols)tetmxr3no1lp nlictlt)a2rm(root1oexomiciad s eauvs u)aleoxrciadopDe ivi;s  eur(opiodomt livtas a2umum ou0tlxo feildfs ra(mp (0arxrmf3oadlpteauvils) ruo(o iudol nmictas aDumur ou4tlxomietasfa2uau o;u4aeeoir oytom  ai i t0seuriopnydol   ivs tf 2raum nu4texnif3iaslm uanvp u0alxomr tytlpDraueslt s2trir3oudaptemiviatfs2um(mont4oexnmi3iasfs2rmu p t)arxrmrcty1fpte n ol( srur(r3oo1al nmicsatfsDrr(m ;t4tlt io3iltlm2el( snu4 ltoxfctydoa elivi t0seuoim3oo1optnlfcils  rtr( o;u0tpxn fctyt a2umn s;() etnif3ootlp eli olt)t2urirpoydll emfvslt arraxmp;o1tpx ioctld s rmnmp;(0trenifcoy1lptraneolt  rurxm3nu4lpeelictas  Drr(rpoo1oetnifciyd mDua(vsnt0altoxr3oodfptrli ol(0setmimpiy1lptemicia( a2ra(m ;t0teenmietydlsDelnvp;(0 rerif io1latraueilt)teum(m3nudapeemietat)srrmu  ;t0tex io3tatfaDemu o (4aetnmocty1opt ai o;(0t2toimpnu1lltn nes s)srumxmpoo1alx moeiyd m ea(vo u)aeeoxr iy1omt ai i s srtmir3oy1lp   fetl(f rrau poo1oeenif3iyt s rm( p t)artomr oadfpDeau ils s2tm(rpiodom nlfetas) Drm(ro;u1olxnmietld a2eln ont4 rxnxo3tadlmteanvs;s  rtrio nydoltnlfvta(f 2urum nt4tpe  ieilsls2rlnvs;u)aexnmr iytfp  li o;( t2to(o3nodopt lfcilt) rrm(m ot0alxo o3iatfa emuvsn()alxomf to1lpD lnvslt t2urxr iydol  mnesa(fs2ra( p;u0tetoio3iytfs rm(mp u4artnxfciotlatraieo t0teumim oodlpe lnesat sDumxm ot1apxoiieiad a rmumsnt)altrif3iy1lm ean il()setmio3oo1optnmnesl( s2rm(ro;o4tlto ociys aDrmuvo (0 rtrifctydfpD  ivi ( t2umxm3nu4lltemneia(fs2uax ono4tee ioeiyt aDeluvo;t0tleomr to1oa rlnvs;(0trtmimpou1am emivil() rtru o;t4opto ociyd aDua( ont4artoir todomtrluvs s0t2um(o3oy1altelnciat)aDraurp;t1aeeoii3tyd sDra(mpn(4artrif iydfmtrluei;()teto(o iu4llee fei s) rur(ro;o1apx mfcias a ul( on(4altomo iodfm e ieo;t  rtr(rpio1amt  fcs sf ruru  no4oetnifeiasls ua(monu)teermr3oydfaDrai ol() rxrio3no4ll e ivs ()sDrm(m no1opx ii3iltfsDum(vonu4 exoxrcoadla ran o;s0t2urir nu1oltnmnvt t aruaump;t1aptomieildla uanmo (4tlxnmocoa1lp eau i t)trxm(o3iydopt mfctas)a2uru p;t4tle mfcilsla elumonu0aexrmo3oydlaDeau il(0texm(o3io4lle licil(  rumur nt4alxn i3ilt m uan p (4 rtomo3tatlpt  ueo;t trxr(o nu4om n ietltfsDtm(m ;u1oex mf3iasfa2rmnvs;(4tetnxoctotfmtelueolt0 eur(r ny1ap emfvtas  2uaxrpnt0tpt ioctldlaDum(vo;()arxnmr3tytfaD aueslt) eumxr oo1am emicia(faDrm(mpnt0tleoiocildfm ra(mpnt4tltrio todoateli i t)texr(m nu4alenlfcsat)s2tmxrpnu0tleo o3tytls ea(mpnt)areoxr tadlptelnes ()s2tm(o nu4ap emfctltf 2rmx pot4tltn o3tys a2eauvs;u4tlxrxrcta1faD au sl(  ruoxmpio1lmtemfvslsf Dtru onu4aet ii3iysfs2rmump;u)trxoircoodoaDrlu o s0t2trxo nodlp emicia(fa2rru p;o4oleo i3iyd a ulumsnt4areoxo oodfmD lies t srxmiopoo1ope  ivs t)srtrx poo0tpe  oeiyt a elnvonu4 etnxf3iadopDelueo t0s2xo(rpoodlp  lieilsfa2ra( p;u1tex mfcias mDumumont4 lxrir ootoptelnei s) 2xoxmpoy1omen ncsa()a2raumpot1tpeoioeiytlaDua( p t)trxrmoctytop rlnes s  2ur(r3nodamen nci t  2tax  ;u1ape  feiasfa2eln o;u0tltrmf3oatomtrlu sls0 rxrimpnudam   fciatf 2tm( pou4oltomi3tlsla2em(mp (0tlxnif iatla  ai o ()srum(m no4apee iciat  Dtrxmpnt0tex mfciys m2rm( pnt4tltnxo tydlpDeanvilt0 rtr(mpio1apt lfvia( sDtmumpoo1oexo ietatfs ranmp;u0 etnmr oadlpD  ivs s0 ruoirpiu1olenlnvt s a2tru pnt1tex ioetysfsDea(vpnu4aleoio ootfp elies s srxo(m3iy1lpt  fciltfarrax pou0tptniictadlaDemn o t4 ltoir3tydom rlneo;t0s2umxm3oy1ap n nvtlsfs2tmx  ;u4tpeo i3iysfa el(mo;t) rtnir3iodlmtr iei;(0texm(r3iodamte fesl( a2ra( pou0apx mo3iadlsDua(vonu4texnioctadfmDeluvi;s t2triopnu4ole  fvsatfsrurx o;u4texnmictat s2ul(mp t0arxoxrcio1oa   nes;t t2xmxm3oydlpee fet s s2raur ot0altomoctadfs rmnms u)aeeoxf3oo1latrlneol(0 2um(o ny1apenlicias aDtru pnu0opt  ictldfa2ulumpn() rtnxfcty1lateaieols)sexoimpnodop n fvt sfsDurx oou4ope iiciad a el( p;u0 rtrif3totlm eaieo t  rurir3oo1apenmfcs t artm(m oo4aeeomociytlm eln s u4altoio3iodfmD aivs;(0trxmio oudlmtelfctls)aDrrxront1aetn oeias s2umn p () ltrir to1fmDr uvi;(0s2trxo iy4amtemfvils s2raurpou1aptnifetasfa rlnmpnt)tetrmf3iydlpDr ivol() rxrxo ny4al  mfetat)a2umur ot0oexomo3tatfaDea(msn(0tlxnxo iodla elivi;s)setrimpoy4ap e ivs s) 2taxmpot4tlx if3iadfaDeau p t)tlxnif3iy1laDr u o;(0s2xm(m oo4llee ncsa(f 2taxmo;u0texoioetytls em( s u4 rxnmr3oy1laDrln i s0srum(rpiydomenmneilt)srumump;t1tle  iciysfs uluvpnt)tetoif to1oat aueilt trxoxr3oy1amtn ici t) 2ua(r ;t4aleoii3iat m2elnvs t0aexnxr oy1fpteaiei;(0 exrxr iodol  liesls arumxrpou4tpto ociydfsDrlnmp u4 exnxf3tytopt anvolt0 2urir3iydopenlieslt)a2ta(r nu0openifeiys sDranvonu4artnxfcoydopDr uei t)srumir3oydlpee ivsl(fsrur(rpno0tex  i3tysla2um(mo (4altrir3tytlatrli s ( seuo(o io1ap   nvtat sDrax  oo0oltn i3ildls2uanmsn(0artrio3totlm raies s) ruo(opou1lmtnmicsat a2raxmpnu1oexoifeiysfm2emumo;()arxrio3tatoptrai ils seuo(mpno1lptelnet s arrrump;o1alxo ictls a2el(vs;() exrmocootfm  li o;s0 2tr(opiodlmeemiciatfaDrrxmpoo0olt ifeilt s uluvsn(0arenif iydomte ivo t t2um(rpnodlme  ieslsf ruax pot4tlto octys a2elnvo t)aexomf3tatfptr uvs;t0t2toxmpnu1amtn ivsls)aDtmu poo4openmoctatfsDumnvs;t4 rermr iotfpD  uesl( srurio3ny4lpen nvsls) 2rm(ro;t1opxn oeiydlsDeln p u4trtomr oydopt  ieo;t) 2trim3io4lp elfes s)s2rmumpnu1teeomo3ildfsDum(msnt0 rxrxr3iatoa  lueol()tetrim3iodoltnmnvs tf Dtr(m ;u1oex  ictasfm2umuvs;() etomf oy1oaD  nesl( tetrxrpnu4lp nmnctat  2trxrpoo0tltoif3tldla2umumo;t)alxoxo to1faDrlu sl(0 rtrxmpnodop   nvilsf Draumoou4oetnmieiyd a2uaumo u4arxoif3oo1fatr i ils0s2xrxm3nu1omt mfetls a2ua(m ;t4ole moctld m rl(ms;t4 reomf3oatfpDr n o ()s2uoirpio1apenmnetatfsDurxmo;t0aeenif3ildlm2ra(msnu0areomo io1fa eanvs;t t2tm(m3io1lptnmnei sfa2tmurpnu0alxniieiasfs2eau p;u0aetrxf iydopt lneo;t0seumxmpio1amte iei sfsrua(m ;o4apt if3tydla umu s (4 rtnxfciadfpt aues s0teur(opny1lpe  icil(fsDtr(m nt1texoifeiltfa ul( p;t0trtoif3oo1om   n i;s trxrxr nu1ale mies tf rrrxrooo1alx ii3tatfsDrmnmo;u0 ltrirciotlpt luesl(0t2xmimpoy1lmtn nvia(f 2ra(rpoo4olt moetltlsDumumo;u4aeermo3oodomDrai s;s)trtmxm ny1olenlfesasf 2rr(roou4alenii3tydla2ea(mp;t0tltoiocto1laD  n s;t)s2umiopiy4lpte ncilsfaDraxr nu0teto ocild m eau s (4tetrxr3totom eaieol(  2urim iu1lpenmnes () 2uaump;t4alenmo3iadla ea( o (4arenxoctotfaD aueo;( t2xr(m3oy1omeemfvia( a2tmxmpou4aexnmi3ild a rl(ms t4trtoxoctotfa e u i s0 2xmio nydom nlnvsa()sDuaurpoo4tlxnmociad a2uln o t0artrircoy1fateaivi () euoxr3oo4lltnmnviasf rrmxm ;o1ope  oeils m ulumon(0trtrir3oy1lmt lies s) 2tmxrpny4lpt  fct s s2tm(mono4aex miciyd a2emu pnt)trxrmr3tydoatr nvi (0s2trimpoo1lm  lieil( srtaxm ou0oex if3iytfm rl(ms;t0 rtrmrctodomD luvi ()setr(mpiy1al emicilt)aruaxrpoo0opx  o3ilt mDeanms;u0trxrio iatlp e ivo;( sexo(o3no4amtnlfei tf ruaxmooo0opt if3ilsfs ulnvo u)aetrxocio1om e n s;()sruoim oodomtn iesat) Drr(mpnt1tltoioetysfa rlu o u)aeerxf3todfm eluvslt0 2umio3no1amenlivt ()aruaumo;t1apeo icils aDelums u4arerir oydla ean o s)t2trxmpou4ap  mnciat a2tmumpnu4ape  feiaslaDrm(vp;t4texnir oadfpD lueol(0sruoir oydlp n nvt (f 2rau  ot0tee mociytfm ea(mo;u0 exriociytoa e nvs;( trumimpiodlme  fctlt)a2um(m ;o4aex ii3iydfm ul( o;t)texrmr oatoptran s (0t2tmimpou4am   fetls)srua(root4aee mo3iasfa2umn sn(4teenmo oo1la eai o s) euoxmpnodom nmiesas a2taump;o4ale  ociad aDean onu)tetrif to1lp r u i;s t2tmxr nu1lm  lnetls) 2rru  ;u0aexnmi3tyd sDuauvs;t)arxnmr3oydoaD lues ()texmxo3oodamt  iei t)aDra(rpot1aeto octyslmDum( pn(4trxnmfcoadfpt  ueil(  2ur(r io1llte neiat arrmum nt1tpx ioetyslm rlnvp;(4trtrxf3iytlaDraivo t)s2xoirpio4alt  ivtatfaDtruro;o4tlt iieilslm2emuvo t) rtnxocootop eluvols)srxm(opiu1lmtemivta( aDra( pou0tltoioctyd a ul(mp u)trxrxrciotfaD aies;t)sexoxr3iy1op nlnciatf Duaxmp;u4apenif3iatlm rlu snt4 exomf todopD  ueil(0 eurio ny4ap nlivs (  2ua(  no1olxomicildfm2ulnmpnu0tltrxf tytoat auvs t0t2urxr3oy4omt mfcslt  2trumpno1tlxnmietasla2ranvp t4texrirciodomDe nei s)srxo(m3oodaltnmfci t)srta(rp;t4teeomo3iatlsDulnvp u)altrifctotla elnvi;()tetrxopiydlmenmivsat a2rmxmp;o4apxo f3ilt mDumu snu4tlenioctydlaD auvs;t0 etmimpny4lleelfci s aDua(rpno4aeeniocilt sDelnvs t0trtoxr tytfa e nvils)s2xrxopoo4omenmfvta() Drax  ;u0oex ifeiydla ua(mp;t0 rerifctytfmtrai o;t teurxmpnodalenlivt () Duru oou1ope ioeiad s ulnmont)arenxrcoadlp eln sl( setmio io1ll   nci s artm( ooo4tex mociytfs um(vs (4tetrmrcia1la ranei s0t2um(o3ny4apt lnvsatf 2tm(rpno1oeeoif3tasfs ea( p;(4 rxoxr3tadlm r ues;(0 euoirpoy1am e fcils aDua(mo;t4ope  o3iatfmDemnmon(0arerxfcoodfmD  nvslt0 rurxr3oy4lm emfes s)srtmxrono0opxn o3iydfm ua(vp;t0aeeoxfciy1fp rlueo s  etrxr3no1apt lieiltfsrra(rpou1oee ii3iydlmDelu snt)tlenmo3ty1fmDeluei (  exo(o nydope miet t  Dtrurpnu4apenmocilsfa emnvo ()aetnmrcoydomD aivs;s0 2xr(rpny1om  lncs ( a2tmuroou0oleo oeiadls2rauvs ()altnxo tytop  lu o t0 2toxrpoo4llen neiatfa2rmurpot1tlt mfeiltfm2rmn p;t4 rxrio oy1oaDelnvs t)trumxrpoy1ap n iet s  Dum(mp;o0opeomfciydlaDuanvo t0trxomfcoy1oat  i i;t truoim3iydolenmfci () rrrump;u0ope  feilsfa umumont4tetrxf ta1laD anvo t)truoim3iudolt liesat srtrx  nu0alxo i3tadls el( p;t4tetnxrcoatla  ln ols)trumir iydlpen icil( aDua(moou1oetnmi3tadls rmnmpnu0arxnmf3todopD li o t srxmxm oodal e iei ()aDraxmonu1tptn feias m uauvo (0tetnir tytomDe nvsl( s2uoir3io4al  lnvil()srrm( ono0tpx  octad sDua(mp;t4tleomo tadoaDrauvsl(0trtr(m3iy1ome mnvs () 2rr(rono4tpeoii3ild m um( p;t0tetnmr3tadfaDelu i;t t2xmxmpiodamte fcsa( srumu poo0oltnifeiysfsDea( p;t0alxnxr tydfm eliesl() rxoxm iodlleemnctl(f rrrxrp;o0aptnmieilt m ean s;u4texnioctydfa e ues;t0trum(r nudape mfcslsf 2rru  ;o0olxomoeiysla emuvo;(4aeerxr3tatlpD ln o;(  2um(rpno1lpe  ict s  Drm( oot0oee  oeiydfm2eau ont4tlxnio3oadfaD lu olt0 rtoim ou1apenlfvt t)srurur ;u0tle  o3tlsfa emump;(4 eeoxf tatfptr u i s) rur(mpnu1apenlfvtl()aDur(moou4aeeomi3ildlm rauvo;(4 reomo3todopD liei;s0 eumir3nodal nmfvsas) rraurp;o4tpxomi3ilt aDum(vp t0altrxo iytom  livi s)trxrxo3io1llt mneil( sDum(mp;o0tetn fetyslaDuaumsnu0 lxriociy1la eanvilt0 2toiopou1amt mneils artm(mont1alto fetltfaDrlnmsnu4artomfcty1fa ranvi;(0 etmxrpno4lp  mfcsa(fsrtmurooo1tet mi3iysfs2rau snu4 lerirciydfp  lneo;s  rxmimpiydolee nei s) 2uau  ;t0aetnmo3iytlsDua(mp (4 rtomo3ootfa raivols trtr(o3oo1opte ivi s a2tru ooo0olt  ocild a2umuvp (0trxnio3iadfmD  uvo t)t2to(r nu4lp nmfcsl( a2tm(rpot4tle iociyd m ean snt4trermr3oatom elueils  rxmxrpnydlmt  nvsa()srtau  nt1oetomfeilslaDuluvs;(0trxnir3oa1fptraieolt0sexmxr3oy4optelfct ( srtmxront1tex  ieias a2ranmpn(4tlenmo tatlatr iesls s2toiopiydlpe lnet sfsrrmu p;o4olto ictys m2ea(vs t0alxoio3iadfat  neslt) etrirpiodap elfvils)sDur( pno4oetomo3tys s elnmp t4 lxnif3iydlpDrln ils0 2ur(rpnu1ap emfesls srtaurooo0tltniiciadfa2um(ms;u4 rxomr oa1op  ai i s trurxm ou4ame  net t)aDra(ronu0teeoiiciyslaDemu o u0areoio oatoa eaieo s0 rxoirpny4llt lfcsls srrmuroot1tpe  f3iltfa uanvonu)aeeoif ootlmDr nvs;t srxmiopiy1apte nvia(  2um(moot1tlx ifetltlaDelnmp u0trtnxo3ty1fmtr uei t s2tm(opou4ope  nes s aDtaumoou4tex  f3tasfa2eluvo;u0 eenxfciatfptrlnvi;t0setmxo ou1om  micslt)srtaxrpoo0apxo ictysfs umnvp u)treoifciotopD ln s s trumir3iu4ol emietl()artm(m ;t4oetn ietysfa ulumpnt4arxnxf3iodop r i ilt)teurxm3oydopeelncs (  2rr(rpou1opeo oeiysfm umumo t4 rxrxo oy1fmt  uvsl() euo(opiodol nlivi (fa2um(mpnu4olt ifciadfaDeluvp u0 etoirctadoaD aivi s s2xm(o3oudopeemnvi (fa2um( ono0teen fetadls rauvsn()texnxr3ty1laDeanesl()s2urxr3oudlpen nviat sruru o;o0aleoifciadlm rmu p;()aeeomo3todlmtr nvi;t  rumxmpiy4al nmiesls)s2rmurpnt1olenifctatfsDua(vo t0texnxrctodfm ran s;t0 rxoxopoy4omeemfcil( arumu  ;t0apenmictadfaDul(vo t4alxrxfcoa1fmtraieolt sruoiopiu4ol elfvils srtm(r oo4tetnii3iytlsDulnmo;t0tetrxrcootoatr nei ()tetoxr3ou1am n net ( srrmx oot0texnifeilsla2rlu s t4artrmr3iatoatelieols0 2tmimpiodopee fvslt  2taur ;u1apxo i3tad m2rm(vp t4trxrxfcoa1fmDeluei ()sruo(o3nydlpeemfcilsf 2rm(ronu0oetomoeiys s uan o t) ltnxo3tadomD  n il()s2toim io1amtnmfesasfsDta(m ou1aetnmicils m2umn p u)aetoio iytfpD li o ( trurir3ny1altn fvtl(f 2taxro;t1oexnioctytfa2rlu p;u)arerirctatoa e nvi;s  rxoiopoo1om nmics s s2urxm ou4apt iictas m ea( p ()aeenif3oytomDr nvi;s teuoir nydlleelfeils)aDurxmono4tlt  ieiltlsDea(vp (4 etoir tytfp  aueo t  2umxmpno4openmfvs ( srumu  ;u1oex  octltlm2ulu p u4arenio3ta1fatelivo () rtoirpiy4lpte fcslsf rtr(rpnt1opeoio3iytla ul(mp ()aexomrciytfmDe uvi t)srtrxm no1am emncs ()sDumu o;u0tlxnmoctltla elums;t) etoif tadfptean o s0setrir nydllt lnvi (fsDta( oot1alxo fctad mDeauvp;u4teenmrcoytfmDe uei;(  rurxo3iu1oltnmnciasf 2umumpnu4texniiciydfsDum(ms;t0 eeoxrcoa1fm rau o;s)s2trimpoy4aptn ivta(fs2ur(rpnu0olt if3tatls ua(monu4 lxnircia1lpDraieols s2ur(rpoy4omtn ici t) rurxm ;t1tee moctat s2uauvon() rxoif3todomDrlnvs;(0srxmxopio1op n fvtat aDrru  ot1ale ioeiasfa2ulnmo;t)aeerxo oa1omt  i ols)sexmiopoy1lpe lfetltf ruaurp;o1aleniiciytla2emn o (0tetrxr3io1la rlues ()s2trirpiy4op   feils)a2rmu  nu1olxn octytls2uluvpnu4treoir tatoatr uei () rtm(r3oy4opee ictas) rrr(  ;o0tlenmfeiytfa2ra(mo (4trxoxo ia1lpteai sl()tetm(opoy4lmte fetlsf Dumxr nt1opxnifctys aDea( ont0trenmr io1lat  n s;s0trxr(m3iudaleelfesl( a2um( pnu4tpeniociatfa ul(ms t0tlxoir to1fa elivo (0texmio3oudlleemfesl(fartaumpnt4ale  i3ildfaDean p;t0arenmf3ootla elueil()texmimpiodam nmfcs s) Dtaxr nu4olt mocilslmDra( s;u) etomr iodlp   ivs;t)s2umxrpoydlpee fvsa(fsrrm(r ou4ape mo3iysfmDrlums;u)artnmocia1fm  an olt) euo(rpiydapenlfcsat  Dum(rpnu0alenmicild s2elnvp ()tetrmf oa1oaDrluei;s  2xr(mpou1opt mictlsfsDrrxrono0altoif3tys s2uluvp t4arxomrciatfp elues;s0t2tm(rpoydol   ieta() rta(rpnt4texnifetltlm ulnmsnt0arxnmf3ta1lpDeln o ()tetr(opiudop n nei tf rtr(rooo0tpt ii3iadfm2ul(mo;u)aeermo oa1fpDrlu sl() 2tmxo3nu1oleelietasf rum(mpot0tpen ocilt s2ul(mo;u0 exnircoadfmDeauvols sexmim3nu1lpeemfeia()artmu  no4apxo fctltls2rau p;t)trxnmoctydfa eaivsls) rxo(r3oo4llee ivt t)a2rru ont0aexn ictasfs rmnmsn(4alerxr3oy1lmDrlivo (  2urxm3oo4llte nei () 2tr( p;o4oeeoifetas a ea(vp ()trtomo todlaDe neolt0 euoxm3oo1llenmnetatf rumu o;t0olto i3iydfs2ra( pnu0arerxrcoydfpt  iesl( texrim3oydllenmivi sf rtr( pot1olt mfctlsla um(vo;(4arerifcoytlmD ln i (  rxoxmpoodap emiet () rtmumpoo0olto i3iydfmDea(von(0tetoxo3to1laDrlu s t srtr(m nu4ale mnei t) Dtrx poo0tle io3iadlaDrlnvs (0 lerircootop ean o;()t2urimpnudop nlictlsf rrmx oot1tpxnio3iasfm rm(mo t4arxnmfctatla raiei t  exm(r3nydlp  mictls  rur(  ou0tpx moeiytlaDel(vp;u0 rtnio ia1lpDeai ilt0t2tmxrpoo1ale lnctasf rrmur nu4apt ioeild m ra(msnu0 etrmr3iatfp  aivs s  2uoimpoydllee fesa()sDtrxro;o4tpeniicias aDrln p (0 eenxo todfm e nesl(0 etrxo3ny1lme  ietas)sDtaurono4ole mo3iyt aDeanmp t0areomf3oadomte nvilt0t2uo(rpny1ll  lfvs (fs2rm(mp;t4texnioctasfs emuvp;t0 rxoio iydom rau il(  rumxrpiydoleemicta()sDrax  ou4oex ifeiydfa elumo;t)texnif3ootlpDe nei;t)srxoxrpoy4oltemfeiatf Drr( ono0aet iociatls ul(mpn(0texrmr3ta1lmD  ivi ( t2umim nudlltnlncsls sruaxr ;t0ape mocilsla um(vp () etnxfcio1fpt  iesls texmxrpnu4lltnmiei (faruaxm ;t0tlx mo3tlt m rl(mp u0alxomo3ta1lp e nvs;t0t2tmio no1openmnet t  rrr(r oo1texoiicias s um(vsnt) renxrctatlp eaivslt  rxr(m iy4lmt mivtat)sDrm(mpoo4oet mfciatla2el( pn(0trtnxociytoaD  neo ()srur(rpoodlptelnesl()sDumur oo1oltoiictaslsDelu p t) leoxo ootfat  ivi;s)srum(m3iy1lptnmfcsa(  2uau p;u4altn i3tat aDrlnmo t0tltrxo3tadfpt an ilt  2uo(o iy4op emiet tfsDtmxmoot0optn feiytfm2ulu p;u) exrircoatlaD auei;t)trtr(m io4ll nlnctlsfa2ua(r ;t0oetnif3iysls el(ms;(0 lxoxf3tatoaDe i i;()teur(r ou4opeelivs sfaDrm(mp;o4optomoctld a rauvo;t0aetrxr3oy1la eauvslt) rxmiopiy1ameemfvsatf Dtrurpoo1aexnif3iys m rlnvsnu4trenmrctodopDelieolt0 rum(mpiudalen nvs t) Duaxrpnt0olx ifciytlm umu p;(0arxrmfcootlat luvi;s  2trim io4lmtn ncias)aDumum ;u4alx mo3tad s2ra(mpnt)tetriocia1fm  lneslt0 2tmir3no4al n neils arumxrono4ale iociltlm2eanvsn()tlerxr3todfa  lnvols0 2xm(m3oodolen ict s aDrrxm ;u1tlto ieiytlsDulumsn(4texoio tytfmtranvil(0texr(r iudlptelicsas  Dtaxmont0tet miciadfmDua( ont4 rxrio oadfm rai i;t trurim oodam elfet t  Dtm(r no1alen i3ildls em( s;u0 lxnmrcio1lp e uvsls truoir oodalen ivs (fsDumu p;u0teenmieiatla ul(von(4aetnxfctytlm eau ol(0srxrir io1llte fviatfaDrmxrpot4tetnioetytlm ua(vont)alxrmrcto1opDe ivi s0t2trxmpnudoptnmfesls arumu ono1apt  f3tytfsDrauvp t4 reomociydoa  li sl() 2xo(mpnodlpen iei (faDtm(mooo0tlt io3iasla2ea(mo u4trermr3totfm rlies;t0tetoxm ny1lltnlnet tfsDtm(monu0apt mocilslaDumuvsnu4aexoir3tatfaDeauesl() rxr(o ny4omen fvi sfaruax ont0olto oetas m emn s u0 rermr io1opDeauvilt0 rxmir3oodllenlivtasfsrur(mpnu4aee mfeiat aDulump u4tltnio3tytlateln i s  rtr(m iodaptnlnvslt) 2tax onu0tetnmi3tltfs2uanmpnu4teeoifctotlm raiei;s)trurio3ny4amen ieia( sDuaxm ou4aptnifciltfm2ua( s;u)altnxr iy1optrlnvs;s  etoxmpnu1lmtnmnetas) Draum ;u0aex ioeiys aDem(msnt4 rxoif oatopt  i o;t s2xo(r3ny4openmnvslt a2taum no1tptomf3tatfmDranvp;t4trtrmr3todfp  ai s s) etmirpoodlle lnctatfsrraxrpnt1oexnmietldfmDuauvs;t) reomf3iydopDrln o s0s2xrxr nydaltnmnesltfs2rmum ;u4olxn ocilt sDeau o;(4trtnirciodoaDelnvilt s2umxmpoydape  ivs s artrxmp;u1olx mietltfm2ua(mo t4 etrmrctotoa e uvs;(  2to(m3nu4al elfetlsf rta(rpot0aetnmieilsfa el( p;(0 rerxf3oo1om  luvi;t  eumxm iodlm nmfeil(  rtaxmo;t1tet  oeiatlsDemnms;u)teeoxf oodlm   u o;t) eumimpiu4lptemictls a2rmxm ;o0apenmfctys s2ea(mpn(4arxomfcoo1oa r uvo t0 2trir ou4op emfciat sDrmur no1altomoeiys mDum( pn()tetoxr3ia1fmDrlnvi s  2uoxo oo4ame livt s aDrmu ooo4oltn ieiatla2ulumo u0trxoir ia1opt lneil( trxmxm ny4alee fes s  Dta(mo;u1optomiciat mDrmu snt)trtoir todom  ln i;s) 2trimpoodomt mnvs s)a2umumont4olt  oetldlaDelnvsn(4 ltoxo iydop   n ilt)t2xr(m nydome mfcs s)aDtr( ooo4openmo3iadlsDeauvo (4tlxnmo3iydlaDeau o;( trxo(o3oo1optemfei s a2rmu  ;t1opx ioetys m2ua(ms u4aeenmrcta1opt auvs s)s2trxm3oo1ape lfcsa()aDur(rooo4tpeoioetydfa rl(mo t)tlermfcoadla  anvi;s0 2toxrpnodll nmivtlt) rurxront1ole ifciat m2rl(ms t0tlenxf3todfaDr n ols) 2urxr no4lltemfetas a2umxmo;u0alt io3iys mDel(monu0aeeoxf iotla e ivol(0srtr(r3nudop e fetl(fsDtr(ro;o1alxnmfeiatfmDrlumsnu0alxoio3oadlpD au i;t)seto(r3ou4apt lnvilt)sDrrurp;o0open ieilt s el( pnt4tetnmf3iy1op raieil(0tetmxo ou4op nlfetas)aDrmx onu1tpxn ictadfmDuan ont4 renio iytfa elu i;( sexm(o io4lmtnlncsa() rta(mp;t4tptn o3ias m2umn o;(4arermr oydopD lu i t)s2xoimpno1amtemnci s artmxmoou0tpt io3iad s rmu p (4 rerio tatlm r n il(0 2xo(rpoydap e fvtat sDtau pnu1tpxomicild s2rlu s;t4 leoxr ta1laD aies;t) rxmir3io4ale lfeils)s2rmurpnt0optn iciat mDuln s ()alxnircoydlp eli s;(0 2tr(mpnudamtn nvsl()arrmum ou1tet  oeiytla ea( s;() rermo3iytfmte nvi t0 rtoxo3nu1op  mivtlsfartmurooo0aetnmoetlsfm rl(vont0alenxf3tatfa  auvs t0teumir nydll nlnctls)arua(r no0oeenmiciltlm rluvsnu4aetnmoctadlpDe uei t  rxrxm3no4lm elfvtlt sDtaxr nt4oltn o3tatls2rmuvsnt4 exrir oytlmteai ils0srxrxo3oudap  lfei (  2tax p;u4apx  fetadfs uanmont0aeerxr3iy1fpDr ueilt s2trir3no4ap elfvi (f 2um(rooo4alxnifciasfmDeanvs u0arenifcoadfm   i s;s s2xoxm3oy1amen ivtlsfs2rr( pot1tpeo ietyslsDul(vsnu4 etnxociy1fm  lies (0teuoir nodoltelivi s a2tax o;o1aet if3iytfs2ul( pn()aetrxo3ia1lmt aivo ()truo(opiydal n nei ( aDum(mp;t1aeenmietydfs ra( s u0arxnmocoadlpt  nes t  euo(m oy4al  mivsltfa2urx ont4tlx ifetat m2eln p;(4 lxrxo3iytfpDelnvils) 2tr(m oudom nlfes t sDtrxmo;o4tetniictysfa2rm( o;t0tetrir oytomD an i;t0sexoir iodol e fetls  2rmxroou4tlenmieiyd sDel( p;u4tlxrio3iatomt auvils)seuo(m oy4lpe  ietatfaDtm(r ou0apenioeias a2el( s;u4texnmf3ootom e ieo t0 2uoxopnodll elfvi s artaxmont0aetnmfctldfs2uan pnu)tlxomo tytomDeauvo;t)t2xmio3no1al nmivilsfaDumumpot1oexoif3iltfs2rlumpnu4trtnxrctydoptrlivil( texmio3oo1lp nmfeslsfsDuru ooo1tpe mf3taslsDuauvp;t)alxnmr oydfm  livi s  2uoxopoudop elicsa()arumx pou1apto fctyd m2ean o ()arenio3oydom e i s;t0 rxmxm3nydomtnlfcsls  2urxro;u0tpt moetlslm2umnmpnt4alxnmrcia1fp eln o t sexoio iu1al  livtas sDtm(m no1alxn o3iaslmDranvs;t)tlxnirctotfpDelueolt trxo(m oo1lmen fvia(f 2ta(  oo0apxn ociaslaDulnvs;t0artnmf oydfat lneo;t srtmxo oo1lle  fet s)aDur(mooo0oet iociad mDrmu on()aexrif iy1lat  iei;( trtoim oydlpee ivtl( srumxro;t4opxomo3iysfa raums u0areoxr3todlmtelies s0s2xm(o oo1lm e fetat)aDraum ;o4tpto o3tlt s uanvp u)tetrmf3io1fpDran ols) exoim3nodlleelnci ( s2ur(  ot0alx  ietytfa2rm(vont4arxnmo3oa1opDe ivs ()trxmim3iy4omt mncilsfa2umur ou0optnmfciasfa umuvp;(0tlerifciadfpDrlivi s  etrxrpnu1lm emfvilt)s2tm(r nt0tpe ifeiatfa2ulnvonu4 lxrif3iy1opD  iei;s)s2xoxr iudol  lnes () rtr(rpoo1olenmociaslsDra(mp;u0artrmfciytlmDrln s (0 rxo(m iy1omtnmnvt ()artm(mooo4apeo oeiasfaDel(vo;t)aeenxo3iytfptelu ols)t2tmimpny4ol emfcia(f 2uaur oo0aeeoiociys m rm(msnu4aeeoio iy1fp e ivi s)seumxr io1op nlict tf rtauro;t0alxniiciyt sDuan onu4 exnxrcia1om rlneils)tetr(rpnu1lmtn ivsa()sDrm(r nu0alenmictldfm2ra( pnu4aeerio3iotoateaivs t0seto(mpoy4optemfvils) Dur(m ou4tpt mo3iytlm2rmnmonu0trxrio iodlaDeauvs;(  rto(opoydol nmivs t  Dtr(r ;o0opx io3iltlmDemnms;t) lermf3ta1optelues s0tetoio3iydap elnetat)a2ur(r nt0tltn fcias m2ranvo t4alermrcoy1lpte iei s tetmxr oo1om nmivi t  Dtruront1aexoiociat a2rlump u)alermr to1fptean olt t2xoimpoo4op  licsl()srrr(r nu4aex moeiltfaDelnvp;u4artnif to1lptrli ols  rxr(m3oy1alt  icta() rta(  ;u1tlx mi3tas m umuvs;() etnif totfp e ues t)s2xm(r iu4lpt  ivils artmur nt1apeo fctysfm rluvs;t)alxoircoa1laDelueolt)t2uoim3oy4aleemfvtltfs2rmxm oo1aetnmo3iysfaDeauvp;u)tetnmr3io1opte n ol( t2xmxrpou1al nlnetl()sDrrump;o1olxn o3ilsls eau p;()trtrxocty1lpDelnei;(0 exoimpoo4lpt lfvtls arumx  ;u4optniicildfaDemu o;t)aeeoif3tatlaDelu i;s0 rxo(opiydaltnmfvsls)arumumpno1ale ii3tadlm2ra(mp u0teeoir iy1optrauvo;t trtrio3oy1amte icta(  rrmx pot4alxoiictasla em( s u0teeoxr ia1omD luvi s srxrimpiodolen neslsfaDumxmpno4tpx ifciad m2ul(vo (0alxoxo3oadop   neo;t)s2xr(r oy1apeemfctls) 2urxm ;t4altomo3iyd a ra( pnt0 lenxo oatoa raivsl( s2tmxr3nydope  fvtl(fsrra(moot1tltn ictldfs2emnmpnt4arxnmo3ootlp  lueils0srto(mpiodame  neslsf rrmxmp;u0aex if3iasls uanmo;t4aexnmo3iytlm  lneo;(0 rtoio iu4op elnei s)arua( pnt0aeenmieiadfmDeau o t)trtnxr to1fpDraueo s0s2ur(o no4omenlivsa() 2rmu pnu0ole  o3ilt mDulums t0artrmr tydlp e nvsls trxm(o iudlpee fvsatfaDurxroot4apeomiciysfmDemn s;(4areomr3oodfm elnvo t trxoio3ou4llenliciatfa2uau p;t4opx  o3iatlmDem(mpnt0teenxr oodlateai i;s0setoxm3io4al nlnvs t srraxrpoo4ale  feiyt sDrm(vp;t4aetoifcoatfpt liei;( s2ur(m iydlpenmfes ()artrurpoo1aex  octysfaDrlumsnu0tetnxo iy1fateaivils)t2uoimpiudlpte fetas a2uaumooo0oexoifeiyd sDelnvo t4arxnif iatlmD  i s t0srxoirpoy1ll elnvias) 2raxrpot0openmociatls2rm( p;()altrio iy1lptr ies t) etm(mpny1ape  nvia()sDra(rpou0tptn ocilt s2rau on(4trenxf3iodom r i i;s s2xrirpio1ll   ivi (  2trxr oo4ale mictydls uanvsn(4 etnif3oy1lp eauvs s)trtmio3oo4opt licsas)sDua(  nu1apxoifetlt mDean s;t0tetnxoctotfp r ivs;s0t2ur(rpiydlmtnmnciat  2rmum ;t4tet  f3tytfs2ea(mp (0 ltrxo iotfp elu ols0 rxm(mpiodolt lfvilt)a2uru p;u4teenmf3iad m2uau s (0 eeomf3iatfp eai s;(0 eur(mpiy1ll emnvs t) rrax onu4tlt ifctas m2emumsnt4 exnmrcoo1lpt ai i;s0 eum(r3nydlm n iei sfaDuaum nt0oeeomfctlsfaDumu onu0teenmf3tadlp r ueo t)sexmxo iu1open fesasfarururpno0opeo fciasla2rlumpnt) rxomociodoat aueil(0texoim no4aleeliei ( s2umxr ;t0texo fciyt a2rau o t0texomf3tydoate ivi s0 rtoxrpnu4oltelnei s  Dtrxmp;o4tpe  fcils aDra(mpnt0arerxf3ta1fp rauvilt seur(m3no4altn nvs s) Dumumont1olx  ieiltfs2eanmon(0trxoxr3iydlpDelnes;t0s2xm(m3iu1lmenmnctat)arta(mpnu0tlx  fetasfaDel( pnu0 rtnxr3oatop rluvils) eurirpio4llt  ietl()sDta(m oo4teeniiciasfm2eaumo;u4tetnif iydlpD  n o t0t2urxrpoy4lm elics ()s2urum oo4oex  feiyd m um(mo t) ltrmfctodfm rlivo;( s2tm(r ny1ale liei s s2rrx oou4optnmfciatla2rm(mp (4 rtnxf3oadoa rli o;t0srtmxm iydapen nvsl( sDumxmpnt4tpx if3tysla2emumsnt0arerxo iadlpDr ieo;s sexrxr3nydomt  ieiasfsDtrurpnu1aex mfeiasfa2rl( s t4aeeoxfctotfp raivs t0trxmio3iudam   ieslt) rrmurooo1tpt  o3iydlm2eanmp;t) eenmr iotfaD  ueil(0s2xm(rpoy1al elfvsat srrrx pno4opeoifctydfm2emn p;t)tlxoifcoy1oatran i;s srtoim3nudlltemnes s) Draurpou0tpxo fctldlmDulnvpn(4 ltnmrciy1oaD aivi;t0setoxo io4lpe mfvsa(  2tmxm nu1oexnmfcilt aDrm(mp;(4tetnmo3iytlm e neo t)t2um(mpiu4om n ncsasfsDrrxrpoo4tleniociat a ean o t)tetomr iytomte u i;(  2to(m3iodlm  lict s)srtmx o;u0opt  fetlt s emuvo u4arenxo3iatomD li s s srurio3nu1alen feiat  Duaumono1oetoioeiydfmDrmnms t4treoir totlm   u i;() rurxo ou1al elfei s) 2uau  oo4texnmfctlslsDea(vs;t0altnxo3todlmt anvo (0sruoir3oy4op   icslt)aDrau o;o1tpt ii3iyt s rluvo;(4artnio iadfatrlivo;s)srxr(o3iy1opt  ncsa(  2tmu oot0aexniiciad s2ul(ms;u) lenmr ty1fp elneo ()t2xrxr3oydamenlfet t s2tmu p;t0apt moeiytla2el( o (4tltnmoctotlaDrli olt setmxo3io1lltn nvt ()sDrmurpnu0apx mociltlm em(vpnu0 lermo oo1opDelieols)trxoxmpiydop  mivslsfartr(rpot0tet iociasfs rm(mo t) exrir3oytfaDeluesls)trxo(rpno1omtn ivilt) rrru  ot1tptomo3iyd a2umn p u4aexnir3tydfpteli slt srtrxopoy1omee fctat sDuaxr ;o1oltnmo3iysfmDrauvsnt0teeomf3iadlpte n il(0trto(o no4lmenmfesls a2rmurpot0opxn oeiyslm rln pnt) lxoxo todlat  ueo s0sexo(rpiudole  fvsasfsrtmxroot1aeeo iciasfs2rm(mo;t)tleomocoy1fpt  uvo ()srxr(m3nudlp elfvtl()s2uru pnu0aptomf3iadlmDean s t)texomf io1fpDe ues;t0 rumxrpny4lpe lnvtlt)s2rrurpnu0aleo octlsfa rmnms;(4 etriocia1lmt lnes;(0 2tm(opoo1opte fvt (  2tr(m ou4aexo i3iyt sDrmu o;u4arxrif3oo1la elnei t)setmim3oudlpeemnvia(fsrrm(rpoo1tpxomicilslm emnmp (0alerxr3iytfp rlivi ()t2urxm no4om n icsatf rum(  oo1opeoioctltfaDemnmo;u0 rxoxf oadfa rauvsl(0t2toim3ou4opee netat) Dum( pot4aptnmf3ilt m2eluvsnt)arenxo ty1fpD  neo t texmxm iy4ll e nciltf rrmu oou4tlx ifeilt s rluvpn()tetrmfciadfate uvi t trxm(o3iydoptemfvs ( a2rru pno4tptn ietasfaDrau s (4 rxriociydfpteln o ()teuo(r iu4am elfcs tfs2rrxm ot4opxn oeiydfa eanvpnt) rerir3iydfpteaues t  2xrir3io1openliviltf Dtm(rp;o4aeeomo3iydfa2emu s;(4 lxnxo3iy1oatrlnes;()setoimpoydlm emncs (f rumurpnt0alxnii3tytfs2el(vp t0 eerxf3oadom eauvo;s)t2um(mpio4amt mnctasf 2taxroou4aex mfeildfs2rmnvo;t4 eenmrcoa1oaD anvil()srxrirpiy1ap  lfcs t) 2rrx  no0opx io3iyd sDrmnmp t) exrxr3oo1fpDe nesl(0 rum(r3iydlm  miesl() ruau  nu0tleo ieiadfa rmnmo (0aexrxr oa1lp   nvo;()setoxm3oo4lltemivias)s2ururp;u4tptomf3iyt s2ulump u4 exrif tydfpD  iei;() rum(m3ou4amtelnvi t  Durumo;o4olto ieildfs ul( p (0aetrmo3iydop  auei;(0 exmimpoodam  mieta(fsrta( pnt0opeo fciys s2eauvs t4arenmo3oydopDrluvil() exoio3io4altn fct s  rrr(mpot0oexoiiciat sDelnvp;(4teerio3tytfatr i o (0t2ur(mpoy1lmte ivs t arrmump;t4opx mf3iytlm2eauvp ()tetnmfctodfa r ueils)sexoimpio4apt  fvs ()aDumu  ot0tptn fctltlsDumn o t4trxnmo oytomt  nvslt)setrxm nu4lptemfei s)aruau oou1apxo feias mDelnmp;t0artrir3totfptrluvi;t srxriopiudoptnlivtas  2tr( pno4tltoif3iydla rm(vont4alxomf iodoa r i olt0t2umxrpiudome  nvias aDuau  ;u0tlx ifcilsfmDum( s;(4alxnio ia1fmDranvi;s srum(mpou4om  mnesa(faDua(ro;t1ale  ociydfa2eluvs;t0arermf3oo1fpD ln ilt)trxmir iy1omtnmnvsl() Duaum nu4aexomieiltlm em( pnu) reoif3ta1la rli i ( seuo(r3iy1ale mnvsl()s2uaxm nt0apxn i3iadlaDemuvs;(0altnmo iydlaDraueo;(0trtriopiodamt mfes (  Drmu p;o4oetoiiciydfs rmn on()arxoxf3oytfpt  ues;t0setrimpiu4ll e fvsas) Duaxrp;u0tpe mocias m el( sn()arxoif3oytfpD luvi;s)sexrxm3oo1amtn ictat)sDrmxmono0olx mfeiydfs emnvp t4alxrxf iydfmtelivs;(0t2to(r oydll e nvsa()srtrxront1aexnmfcils m2ulnms;(4trenif3oodfmtran ilt  2xm(rpou4al n fes (f ruau p;u0tpenifciyd a rl(mp u4arxnxo3oatfp rlnvol(0 exr(mpnu1om   fvi tfarta(root4aeeniiciys sDumn pn() rtoxfcoadlmD  nvi;s t2urio3nodalt mnvs ()s2ua(r nu1ale moeiat s elu ont) etoxo3ootlmt aieo;s)s2trxopno1lp   fvs tfa2trum ;t1oee  ietldlaDrmnmon(0aexoifctotoa elivsls sexoimpnudopee fet (fa2tr(  nt0apeoii3iysls emu snu0tltoir3oytlmD auei;s  exmim nu4lm   ietat  2umu  oo4opt if3iysfa rauvs;u) ltrxo oo1fateaivolt0 etrio iy1apenliesls) Dtmxmpot1tee  i3iatfaDemnmp;t0 exoifcoy1omDrln o s  eurirpiu4lpenmfvt s)a2rr(rpno1tltnioetat s em(mo;t4tetoxr oydlmt  u o s) ruoxo iu4lle  fcsa() rrr(  ;t4tpe iiciysls ua(vs;t0 rxomo3iy1fm elnei () rtmxm iu4lptelnvia(fsrurumpot4opt iiciatfs2rmn s;t0tetnxo iotomD ln slt truoirpou4lmte fcsatfs2rau p;u1aptoif3iys m2uanvs t0 lxnmfcto1oaD aivs t0s2to(rpno1om  lfcias)sDtax o;u4tpeoioctasfs elu s;t0 etrif3iydoa eaivols  2toim iy4ale  ncs t) rtm(m oo0oee  oeiydls rmuvsnu) rxrifcty1faDr n slt s2uoim nudoltnmictl( aruau o;o1ape ioeiadla2uau p;t) rtoio iatopt luvils seurim oy1op emfcsatfa2rmu poo1ole mf3tyslm ran p;t)trerxo oa1lmDe nei ( setoirpoo1lme  ici s) 2um(r ou1alxo feilslm eau p;()teermr3iydlatelivi t) rtrim ou4ol nmnesas  Dtrxmpno4opxo o3tys a2ranvo;u4tlxomoctotfp elies s srtm(rpiydlltnmfcia()arumxr ou0aexnmf3iatfm2ranmo u4 eermo iadfp r n i s)trto(rpiy4llenlicsas arrmxrpoo0tpto i3iltlmDemnvo (0aeenxf3oadlmtr nei;s srtm(m nudomtn fesasf Dua( o;u0aet  oetasfm2rlnvo t) ltnio oadlp e i i t)seurxo iu4omee feta(f Duax  nu0oetnmietys s2ua(vonu)arerxf iadopDr ues t0 2xo(m iudlmeemietl(f Duaxmoot4ope mociatls rau p (4tleomr3tydlptrliei s0 rtr(r3iu4am  lfvsl(fs2tm(mooo4teen o3iltfm2ul(vp t4tetnxr3iydlm   nvo;s trxoimpnodlptelnei sf rta(rpnu0tpxn fciatla ulu p ()aetrir oadoate ieo;t) 2tmir iy1om e nvilsfa2rmu  oo1oetnioetltla ulnms;t0texomfcootlm  lneo t0 eurirpnudapenmivtl(fsrumurp;o1oetn f3iadls2ulumpnt4alxomo3io1lp rln olt0texrir iu1omenlict tf 2tmx p;o0tpxnioetldfm emnmo;t4 eermo ia1fpDeaieol()sexrxm3oudap  mneiasfs2taur ou1alxomf3ils a elu o t) ltomo3oodfm  livilt trtr(o io4ol  mnctat)a2tr(mp;t0tlxniieils a ra(msn(0 rermr ia1fm ean o ()srurxm3ou4ll nlfesat)s2rr(moot4tltomf3ils a2rl(vo;u0texrxocoodlp eaivs s)s2toimpoo4lm e ivi (fsrra(m ou4tet mf3iltfa ua(vp;t)trxrif io1lat aivo s0t2xo(m no1ome mfvt s  2urumpno4olt mfeiltlm elnvont4 renxfcoa1laDrauvolt  rxr(r oy4alenmnesa(  2trxm ;t0ope mfctltfmDrauvo;t0 etnmo oatlpteaivil(0 2um(m3nu4omen nesl(fa2uaxm nt4opt  i3iydfm eln pnt4tlerio3iatfpt auvils)trtmim nodll emivtasf 2tr(mo;o1tptn ociltfa2ra(vp u4artnio3ia1omDe nei;()setr(m3no1lmtnmiviasf 2urxmo;o4alxniocilt a elu ont0trenmrciotfa rluvsls0 2xmimpnudamtnlnvt s  rrr(rpou4aex  fetat mDem( s;u0alxrxo oadom r i o () etrirpou4lpen nctasfsrrr(rp;u4texoiietatfa2rlnvsn(4tltnmociatfa raieilt0s2xmio nodop elicsl(fsDuaumo;o4altoio3iltla um( s;t) exrxociotlp elues;s)t2xmxm oydamtnlieta(faDtrur nt1altoio3tasfsDrauvpnt0teenio oydlm rlnvi;s sexoir3iy4omen ietl( aruru ont4opeo i3tldla2raumont) eeniocoydom rli o;s0srxoxm no1ll nlnesl(f rur(mp;o0olt iociltfsDrmums t4aetoir oytfp eluvsl(0 rxoxmpiydamt  ncilt) 2rrx pnt1aleoio3iad sDuln p t0trtnif iy1fate ivo ()seumxrpoudlpenmnet sfarrru  no0ole ii3iyslaDum(vo (4tltnmo oodfatr iei t tetoxr3iodaltemnctasfs2tr( pou1tpenifciysfmDrl(vs ()texnif3ootfa ranvs (0t2xoiopiy4lpe livt tf 2rr(rp;o0tleo feiyd mDulnvsnt4trtoir3tadopt aueil(0tetoim io1llenlnes sfs2urxrpnt4tetomfeiatfa um(mont0alxrxf3iy1lpDr n i;t0s2xrxo ou1apte ivt t) Drrxmpnt0aexoio3ilsla eauvo t4alenxf3io1lmD  nvo s0trtoim iydlpe mfcs (fs2umxmpnu1tleoiieiydfaDrlumpn()trxrmoctytop  luvil() rtmir3iudll   ivsltfs2taxr nu0oexomieiadfm2ua( s;u0tlxrxf tatfpt  i s t)setm(m3oydam n iet tf rra(mp;u4tpx mfeilslm2ranvp t)arermo iatfpDe n ol(0 rxmxo3iu1al   nvsls  Dur(rp;u0tpe io3tytfa2ra(mon(0 rxriocoo1fa eaivsls setoiopiydlmt livt sfs2umuront0tle ifeilt mDumnmp (0 lxoif tatlp eli sl(  rtoimpnydlpt  nei (f rumu  no4alx mieild s2em( s u0aetomf3totoatelneol(0seuriopou1op e fvs s)sDrmuroou1ope mo3tytfa2emums;() exomfcoatlm r ieolt)s2ur(o3nydolte fctlsfsDtrxmp;t1tlxoifeiatlm2ua( s;t0arenif tatfm r ivi;t trxm(rpoy1lltnmics t s2ra(rpot4aetn i3ilt aDumn s (4arxoxo iytfpDeanvslt0trxoxr3no1ole mfvias s2taxmpot4aeeo ietlt a el(msnu4 lxnmfcoa1la   nvi;t0teurxmpoy1lpenmncslsf rraxmpnt1tpeomietytls2em(ms t0teeomrcoatlatraiei s)trxmimpoodolenmncslsfsrur(  ;o1ope if3tyt m uauvp t4aetrircoatla   uvi (  2xmxr iydal  mfvilt s2rmxrpnt1olx iieiad mDrl(vs;u4teermf3ia1fa rln s;s s2urxm iy1al   nvsa( s2taxro;u0optomo3ilt a2uanmp;(4altnircoytfpD luvi t) exo(m3no1lmen fcta() 2rrxm nu1oexn iciysfmDeanmsnu0 rxrmocta1fmDe ueo;t0 2um(r3oy4ol  mieils aDuaxrp;u4tex  ociasfm rmnmp t0tlxnirciydfptrlu o ()srurxo ny1opt lneiasf rrr(mp;t0tex mo3iadla ra(vo u0 lxnmfctydlatr ivs;s0tetr(mpoudlm  lnesl( sDta( pno0tpeomociltlm rln s t)trtrmrctodlpteliei s0teum(r io1ame  ncilsf 2uau oot1oleo fetyslm emu p;u0 rtomocio1opD  i i;t0t2trxo3nu1lltemict tfs2uax  ;u1apxnio3tys s rlnmp;t0aetomf oy1fpt  u il()seum(o no4ol nmfvta(fsDumxmp;t4ape mfeiadfs2umnmo t0 etoxo3to1fp  liei;s)s2xoxo ny4am e ncsls)s2umurpot4aex ifcils a2el(ms;u0tlenmocootfp r u s;t seuo(r3nu1omenmies (f 2uax pno4oleomieildfmDelumonu)trxrmr iydfpDrai i;t0srxm(o ny1lpeemici s srurxrpno4oet iieiadlm2ulnmsnt)tlxrxfcoodfpDelneo;()seumim3oy4alenmnct s) Dra(m nu4tet io3tltfa umnmo u)aetoxocto1op elneo;s t2urxm3nu4al nmict t)srtm(mpnt4tee  o3ilsfs2ra(mo u0teermf3iy1om  li o ()setrxr3iydap   fvsat) rtr( poo1tpeniieiyslm2um( s;t0 ltnxrcootlmt auesls0s2trir3oo1altn nvt t) 2tmxm oo1opxnioetytls2ea(ms;(4 lermr3todoptr n s;s  rtr(rpno4apeelfeta( srtmxr ou4oeto fciaslm emuvpn()teenmf3oytom r n ol(0 rxmxm3oudamtnlncslsfs2umxmpnt4alx  icildls2ra(ms;t0 lerxf totla rai s (0 etoio io1openlnesasfa2um(mpoo0tpxomo3iadls2um(mp;(4 leomr3ootoat  uesl(  exmxo3iudlp  mnct sf rrm(rono4alt mociydfm2em( onu4arenxo oadopD  ivo (  etmxmpiu1lp e nvias srtax o;t1tpeoifetld a2ul(ms;(0 etomo3iatlmDrliei;s0trxoxm3oodlltemfeiat)sDrmum nt4opx ifeiatlaDrm( ont0tlerxo3iytlpDrlivi;t0 2umio iydamenmfvt s)a2taxr nt0oetoii3iadfmDuauvp ()areoio oa1fmD luvs t trtrxrpiydolenlnctl( a2rrx  oo4oleoiieiasfs2eauvo;u)altoxr oadomDraueo;t)trxrim3iu1op  lnvils) 2uaur nt1apto feiydlm rl( o;u0 leoiocty1fa eai i;() euoir3io4opeemiesl( arua(rpou1alx mocild mDraumpnt)altrxocio1lptrlu i (0tetr(o nodamen nct sf rrax p;u4openmfeiydfa rlnmp;t4aexoxf oydlm r i o;(0setoir3oo4apt  fcsa( a2urxroou4tpe moeiasfm rluvon(0alxrmf3oy1lp  aieils0t2toim io4lltn fct s srraxmpot4ope io3tytla uluvs t)tetrmociadoaDeli s t  rtr(m ou1al e iei t)sDtrxm ;o0apxn o3tys m ulu snu0texnxf3totfaDrln i t0 euo(o nydaptnmnctlt)sDraxmp;u0aetomfeiat sDrl(mp t)altrirciy1fmte u s () rxmio3no4am e fciat srrrump;t1tlxn feildla2um( s;(4trtrxf oatlate ies;s)trur(r3iu4om e ncs t srrmxm nu0oeeniieiydlm2rmn o;u0altrioctytfate ues s0 2xr(o nu4lpeemnci s aDrrxrooo0tlto i3ilt m el(vp u4trtrxfcoa1faDeau olt0tetmxm oy1olt mfcils  2urumpnt4opt if3iydlaDul(msn()texoio3ta1opte ivo ()t2xm(r iy1ameemncsatfartrxmoot0oeto fcildfs rmums;t0texnmr todfa eauvo;s0s2urxr3ny1lleelici ()aDua(mpot0oexnmoetlsla2ra(mo;(4texnmr3oodfpteaivi;t0 exrxo iy1ll  mnvsat arrrumoou1oet ifctytls2elumo u4arxoir tydla  an s;t texoirpnodalee iet t)a2tm(m ;t0oexn i3iys m2rl( sn(0tltoif ty1laDraivo;s)teur(r3oodlmt mfes tfartax  ;t0ape  fctys m2eln pn()artoir iodlptrluvs;( trtmimpnu1lm   fvias)aDta(mp;u4optn oeiyd m eauvont)trxrif3iodoptr n ols)trxr(rpnudll  livi tf Dum(rpno4optomo3iytfsDumnmp u0aetnmf io1fa  anvslt0t2tmxm io4amtemfcsa( srtruronu4apxomfctatlm em(vpnt)tltriocoydfptrluei () rtoxopiodlm emfvtas)arurumonu4aetn oetadfmDran s t0tltnir3iotomD  u i t0 eum(o3no1aleemfvtls)aruau  no4tex io3iadfs2rau o;u) rerifctydop eauvils) exoxopou4al  lictlt)s2taumpou0oex mociat a ua(vo;()trenmfcoo1lm rln ils)srxm(r3nu1omtn fciasfsDua(r nu4aexnmoetlt a2rmu s;u4alxoxo oadlpD anes;(0setoim3nu1ole micta() Draumpou4opxnmf3tas a rlump;(0 rtnmfctydfmDe uei;s0 2toir3iy1ope lfvi (  rraump;t0oexn feiad a el(vo;t) rtnmf ootla rln o t seuoirpou4om nlivt s arrmxrpnu1alx ifeiysfaDemnmo ()alerxo3iatfa rauvi t trumxmpiy4altnlivtltfa2rmumpno0aeeomictytfs2elnvs u)altoio oydfmDe nes;()tetm(opio4lp n nvilsfsDtr( oot4tee moetytlsDum( p;t0texrmrctatopt lu ils) 2xr(o3nu4omt micta(fa2ur(ronu4tee  oeiltla rm(mo;t4 rtomf iodoaD  uvi s0t2trxr ny4lmenlicia()arumxmpoo4tex  ieiytfs2el(vs t0 rtrxocoo1oa rlies;t  rtrxm io4olen fei (  Draurp;t0tpxnmf3tlt mDea(mpn(0tlxnif oydlm  lueo t)sexoim3iudlpt mfvtat)srtrxmono1opxnii3iytlsDem( s;(0alxrmrcty1fpDe iei;t)teur(rpoy1lme  nciat a2ta(rono4tlt  ieiydlsDel( snt4alxnmfcto1fate uvi;s)s2tmxo nu4lpt  fesl(  rua(r ou4olxomo3iysfaDemumo;u4aleoifcoy1lpDelneo s0 2xr(o3iudal  lict t)a2rmurpnt4tpx  o3iatfsDemu p t0trxomocootfaDrlu sl()seuoirpoy4op   ietat)arum(mo;t1olx ifciyd m2umuvsnu4 reoir oytfmteaivol(  2umir nudal  miviat s2rrumo;o1tle  oetlt sDul(msnt4 exoxfctotfpDeaiei t t2xm(r iy1al e icsa(fa2uaum ot4tlxo ictatfsDul(mp;t)tetnxfciodlmDrauvs;( srxrimpnodllt lfvs t) 2ur(mpno0tle  i3ildfs eanmsnu4 lxrmr tydlp rauvs ( texrxrpiu4lptemfes s a2rmxr ;t4oex  i3ilsfm2rm(vp t0aexomfcio1fmte ivs;t0s2ur(r3iydoltnlivia()arumx  nu0tex mfeiys a2eluvsn()aexrir oy1lateanvs;() rxo(m3ou4lptn fet t srtrx  oo0ope  o3tldla2ra(vp;() exrxfciy1latrlnvsls)sexoirpny4amtelnesls)sDrmum ;o4aptomo3iytfs2eaumo;t0 ltoir3tytlp r nvo;s)tetmxrpiu4oleemfetas arurxmpot1oeeo fetydfaDemn p t) eeoif todlptranvi;t s2tr(rpoy1omee fcsat a2rm(mo;o0alt if3tatls emu p;(4 exoxr iatom r u s;t  2trir iydal e nct s)arrmu onu4aeto fcilt m2eau s;t0alxrio oatom r ivs;s  etm(r3iodlp  lneiatfs2trxrpou4opxnmfeiaslmDrmn p;(0 etnxocoydopD lu s;s0 eurir oo1op emneia()aDrrur ou1ope  i3ilslm2rl( p (0alxomo3tydfm  lneslt0trxm(m3nodamtelnciat sDrru onu1olt ii3iat a eaumo u4tlerxf3oadfmDr ueo s0 euoxr3oy1apee fvsas)aruaum ;o4tetnioeiadls eauvo t4trxoxoctotoat  u s ()seurio nu4alee fct ( a2rm(m nu4aleo feiatfa eau o (4 rtrxo tatfaDe neo s0setmxm iudop nmnes tfs2rr(  nt0tpeomfciydlaDem( on() rtnmf ia1fm ran s;( teuoim ny4alenliei sfaDrrxrono4tpt mo3tadlsDelumo t) rxrif ty1omDraivsl()trum(o3nodom  licsatfaDuru p;u1texo oetatfmDrm(ms (0 lxoxo3tydom r u s s0trxr(mpiodoleelncs s)srumump;t1openmocild a2eanvo;t4 reoxo oatop elivs (  rxoxmpoo1lme  fct t s2uaump;o4altnmiciysfaDul( snt0trtnxrciotfaDrluvi (  rtm(o3oo1llt mnvslt aDraxm nt0opeoio3iydls em( p;t4aeeoif3to1fmDeli o;t0 rtoimpiu4oltelicias) rum(ronu1aex  fcilslm rlums u)aetoif3oadla   nvi t0s2trim3oudam n nvs tf Dtmxrpot4tpxnifeias m ua(vs (4 rtrxo3iy1fpteau s (  eumio3ou4openmivs (f rumu o;t4oex  iciytls ul( p;() rtrio ia1fmte uvo () 2xr(m iu1lpeelnetl( srta(mp;t4oeen feiltlsDuanms t)tltrmrcoodfp  luvi t0 2tmirpnodoptnlfvt t srtmxmoot0tpe  oeiad mDrau o ()tlxomr3iydomD ln olt0tetoxr3nu1al elicslt aDtmumo;u4tltn i3tat s2rm(vp u)tltnir iatomD livslt sruoxr3iudoptnmnci (fa2ua(root4aleo ieiadlaDea(vp t4tetrxf3oytfm   ivi t)t2to(mpiu1apteliet t)a2rr( pot4alt mfciat s rluvo (4 exomfcootoaD  ivi;t)s2xmio3iu4lme micsatfs2taxro;u0teenii3ildlmDraums ()teerifctydlpDelnvo;t) 2xm(r iu1lltemfet sfsDta(r nt4oetnmo3iltls2ea(mp;(4tetrmocoa1op  aivols) exrirpou1omeelnciat  2raurono1oltn o3ilt aDuau o;t4 rtnxf3iatlatr u slt)texoxm3nodopt  nct (  2rmx  ;u1tetn feiltfm2rmumpnt4teermoctydomt anvolt t2um(r3oudome  nctas)aDtrurpnt1olxnio3tys sDranvsn(0tlxoio3tatlm  luesl(0trxoir iy1lpe mfvtlsfsrrmxmpnu4ale  iciydfsDrl( snu0artoxo oodfaDeanvslt)s2urxr no4apenmnctas a2um(moou4oex iiciltls el(ms;(4aetomr3oadlmD anesl() eum(m oudlmenlnvsl() 2rau pnt0tpe mf3tad sDem(mp;t0alenxf oo1optelies;(0 2xr(r iu1lpt  fesls)sDurur oo1aeenii3iysls2rmn s;u0altnio oadop eaneo;s sexo(m3nudamtnmnvtat)arrmxmpot4optomociatlsDra(mp;t4tltrxocia1fpteln o (  rtoir nodameemfct () 2rm(root4opt  ociys sDuluvs;t0tlxnif3iy1lp raneo t t2urxm3ny4ll e fvslt)srrm(mooo0aexoif3tyt m elnvp;(0 ltrxo3ta1fat an olt)teuo(o iu4oltnmietlsfaDrr(m no0teeo oeiasla rmnvp;() rtnxo3oodfmtrlnvs t0setm(r ny4op elieil( s2ra(r ot1olxn i3iat mDeluvo;u)tltomr ty1lat  uei;t setrxm iu4altn ncs ()aDuaumpoo1tpenifcilsla2eluvs u0treoxocoa1omt  i ils)teuo(m nu4lptelfviasf Dumxront0opxnmoeildlm el(vsnt0arermr3iatom elieilt srum(mpoo1opee fesat) rurum no4openifeiysfsDulnvo t4treoir iodfa elieo t) etmxmpnudlm   nesltf 2ta(mpot4altnmo3iad s2ea(mon(4artomfctydoatranes;() 2xmxr iudlmtnmfeils  ruaxm nu1tpen f3iltfa ua(vp;t0 eenmr io1fmteluesls)t2xr(m3oy1lmee netltfarrmu ooo1tetniocils s rl(mpn()tltnmr tydom rauvi t) 2umir ou4ap nlfcsa()s2um(mp;t1olt  ociydfm rmn pnt0texoxr3iy1fate nesls)trxm(r3oo1lpenlncslt)sDur(m no1olt ifetlsls uaums t)trxrxo3iydfm rlu ols0trtrxopiy1lm  lictl( s2ta(rp;u4texo ieild m2ua( ont0tltnioctadfp   i s;t0 2xoxr3iodom n nvsls srrau p;t1aeen i3iltfaDemumsnu4teenxf3ootlmDeln sl(0sexoxr no4ll  lictls) rrrum nu4aleomi3tydfmDumuvont0teerifcoy1fate ivsl( srxoim3iodol emictlt  Drru ooo0oexomieiatls em(vpnu4texnir io1fpt ai o t)s2uoio no4op e ncs s aDtmu oot4apt mfeias aDrmu onu4 rtoio iadomte nvo;(0s2ur(mpoy1ole  nviat) Dumu o;o1aex ii3tls s2ulu o t4 rxnmr iotlm eaieo;s0 rtrimpoo1altemictat)sDrruront1tltomieildlaDeauvo;(4arenif oatoa  auvs s0seurxo ny1amtn ivi ( s2rm(m nt1oexoioeiltfa ea(mp u4 lxrmr tadom elueo;t  eum(r oodapt liesa( aDta(  nu4aleo fctytfaDranvo;u)tetoxo3ia1lmD lu slt0 rxrxr3ny1ome lietl( s2tmumo;t4tpxoifetasfmDrmnms u4aeerxrcoydlmte ueil() 2trxm3nudom  lfes (  rrmumpot0teeoio3iatfm2ra(mp () rxnmfcio1om   uvi;s0sexrio oo1llte fesat s2rrxrooo0oexnioctlt mDeanmpn(0teerio oy1optrlivol( s2xm(rpno1am emnes (fsrtaumo;t1optniocias m2eanmsnt4 rermfctatoa   ivo;s)srxo(o3nodole lfesa()aDrmxrpot1texn fetyd a ul(msnt0texoio3iy1omDrliei t)seum(opiy1amenmnvtls)aDtm(ro;o1olxoifeias aDea(mo t4texnxo3oy1laD lneslt0trtmio iudomenlfvi sf rur( pou0aeenmf3iad aDum(vp (0 eenifciytfm rln s;t0srxm(r iu4olte iciltfa2taumpot0olenmietatla elumpnu4trtnmfctytfpD aies s t2xmimpoodope  icta(f rurxr ;o4opt  i3ilslaDemuvs;t)teeomfctytlp  aieols)srtr(o3ou1alenlnvtlt) rrm( p;o4optomo3iydls rluvp;u4 rxnxr3io1fm raivol(0 rxrxrpoy1al   nvil(f Dumxrpno4teeo ietysfaDelu o;t0aeenxf3oodomtr neilt0 eto(o oy1open ietasfsrumu  ou1apx  oeildlmDumums t0 eenmr totfpte ivo;( trto(m3nu1llt mfctlt srua( pnt0tlxo fctltls2ran p;u0 rerifciydlmtelnes;( sruo(r oy4ame lnvi sfsDurxro;t0tlx miciytfa eaums;t)trxnmo3ta1lat luvilt0trxrxo3nydam nlnes t s2tmxrpnt0tpxomociltfa rmnvo;t0alxnircoatoa r ues;s)t2xriopnodap nmivtat) rtm(  ;t4ape  fetldls2ea(msnt0artnxocoydlateai s t0t2tr(mpoo4lpen neils)sDumx pnu0oee mi3iydls ulnvont4aeenio oydop e n i s truoxm iu1olenlieilt sDumxr ou0aptniietlsfs2uan s;t0 etrxf3oatfpDeauvolt  2xr(o oo1ol nmfvtat)arrr(moou0oetn f3tls s2rlnms u)areoxociytfptr ivils seumxm3ny1omt  fetl()s2umx oou1tpen ociadla2ean p;(0arerif oadfaD anes (0t2tmim ou4aleemies sfsDrrum ou0oleo icild mDemn s u4teenxo oodlatr ieo t t2xmim3nydlptnlfvsat  Dur(  nt1oltniictaslm emumsn(4 ltoxo oodfa  aivsl() ruoxr oo4amee ics s s2ra(mono1altomoeiatfaDrlnvonu0 etoxoctytlaDelu o;t)sexo(mpiodomtemiei tf 2um(rpoo0tleomocilslm2ra(vonu4trtoio3ia1optelivs s)srumiopou1lm elneia(fs2tm(ro;o0oetnmfeiat a ranvsnu4trxrxf iy1lat luvsl(0 2tmir3iy4lp e fvslt artmuroou0tetnmieils a emuvpnt)aexnmr to1fa eliei;t t2uoxr oy1lpte fctls)a2tm(rp;u1olxn i3tyt a umn o ()artnio3totlaDe ieo;s0t2xo(o no1lpt lfctl(faDtmx onu0alenmf3iltfm2el(mo ()teerxf oatop  ai ols0setrirpiy1al  lnet s s2tm(rooo0aeenioctyslm eauvp ()areoxrciy1fpDr i o;t  eurirpio1lpt mici t a2umxmonu1tpt ioetat aDea( p;t0 etnxrcoa1lp  lu i;( trtm(m3oo4lltelnet (  2ua(m oo4altniiciadls uluvsnt)alerircoo1om rlivi;(0srxrxm nydal elieil( s2tm(r oo0alx ioctysla rmu snt0 eerirctadlmD  u slt) 2ur(rpno4ll  mfetatfsDururp;t0oleomfciad aDeanmsnt4treniocoadlpt li il(0 rum(m3iy4lmeemiei ( arurx  ou4tle iociasfs2emuvonu) eerxf ty1om  lu i;t)truo(opnu4op emieslsfaDraxmpot0tetomoeiyd sDrau s t0trxrxo3oo1opDr ues s0trumxopnu1amenmfeiat)aDtrump;o1tlen oeiad s2emnms;u0 rxoxo3ia1omD  n o;( trxmimpio1am elfesltfa2uaxmooo4olen fcilslmDra(mpnt4 rtoxo oadfp   uei;t s2uoirpiu4llenmfcsas)srtaxmo;t4olxnioetysla2ranmp;u4 eenmr3iytlmte uvsl()srum(mpio4ale mncs ()sruru  ;u4alen ieiysfs rauvo;u0tlxnxf3iydoa  aiesl( s2xr(m3oo1lmt mncsltfs2ua(rpno0alxnifeiaslmDel( onu0 rxnxo3ty1laD li sls0trum(rpou1om n fcs s  Durxmpoo0tltomf3iytfm2ul(vonu0 rtomr iatlp  liei s0 rxrir3iy4llen fvil(fsDua(mo;u4olto ociytfs2ul( p (4 leoxrciotlpt  nvs s0t2xrir3ou4al elfvtasfaDta(rpot4tleo o3ildfsDra(vs t4teeoio3iytoaDe ies s0 2ur(o oo1om   nctat)a2raxroou4apx mieils sDeauvpnu) reoioctatlmDean o;()tetoirpiydolee nctls)sDtmxm ou0alx if3iltfm rmnmo;(0aeenif iodlpt an s t0 eurxm no4ap nmnctltfsrumxrp;t1apenmocilt s2elu p (4aetnxr iodomtraueil( teuoxm nu4altnlfeslt)s2tauro;o0oltoio3iys s em( s (0tlxoxf ootlmtr ivols sexmiopnodlp nmfctasfa2urxrpnu4aptoifetasfa2rm(vs (4tlxnmfciy1laDe ivsls  2tmxo iu4ap   fctat)aDua(mont0tltn ietat m2uaumo;(0arenxf3oytopDr ieilt)tetrxm3iy4ap elfvs ()a2raumo;t0tptomoeilt s umnmsn(0aexnxfcto1omtelu ols0trxrxm3oo1lpe lics ( aDumu p;u4apx  fetytlaDumuvpnu4 rxomr tydom  ln ol()t2urio iy1alt lnvtasfaDuaur ;t1aexn f3tltfmDrm( pnu0 lxoxo iy1laDe n ilt  rtrio oodamte fvtltfaDrau ono0oetoioctasfa2el(ms t) lermociydlp   nvo;()tetrir oydam nmnvsltfsDraumono0tlxo fcils a eaump;u4 rxnmfciytomD livolt)trurio3oudolte ieils srrmx p;u4openiiciadfs emuvsnu)arermrctadoptraivi t seurxr3nu4lleemivil(  2trum nu1aexomiciadls ean o;u4arenxo3oatfaD  n ol( seurxo oo4ape  fesasf rrrum ;u4oee if3tydlm rmuvo;t0trenxr3to1laDe nvi;s0t2xr(o3nu4opeemicsltf rurxmpot0olt ioetyd m ea(vonu4trxnircoo1omt  n s;t0 exo(r3iy4ope  fvsas)s2tm(monu1tpxniieilslm uau o u0altrxocio1lp   uvo;s)t2uoio3oydol nmnetlt)aDta(mo;u1aee mi3iadfa2ulumpnt0aexomo3oadfaDeli o;s  exo(r3ou4altnmictas) rraumpno1tex if3ilsls2ra( on(0 leriocoa1fpt lieo t)texo(m3no4ale liesls)aDraxr ;t1olxn ictlsla2umnvs;u0aexoif io1oatelu sls0trxo(mpoo1ale lfeiasfaDumxmp;t1texo fciadlmDul(vo;t4alerifctotfaD  ueols t2umxr iy1aptnmnvtlt)s2raxmont4olt io3tatfs2uln p;u0altrirciy1oa  ln o s0 rxo(r iy4op elnesatf Drmumpnu1teen f3ildlm rln s;(4 exrxr iydfptelivi;t0t2umxm3iu4al e nvil()sDurxroou4ope  ociyslaDemu s t)tlermf3ta1omD luvo t  exoxo oo1op  lfcilt  2raxrpoo1oleo f3tyd sDrluvo;t4aetnmr3tatoaDrluvs;s seurxopny1ll e nvias a2tm( o;t1oeeoii3tldfm ra( pnu4alerxo3oytomt luvi s)sexrio ou4omtn nei (f rrr( pot4apeoii3iys mDulu p u4trxnifctatfp rln s;t0s2trir3io4al nmnesas a2raur ;u4altomi3ils aDran p (0artoxf oodom  aues;( srtm(o no1ameelicsatfarumur oo4tlx  f3tls m eluvs () etrmr ia1fp  li ils trtrio ou4om   ivslt) rra(moou1alt ioeiyslsDuaumsnu4artrmo iadlp e n il() rxoirpnu4lmtn nviat)a2rau p;t1ope iicilslm elnmp;t0trxniociatlptean o (0s2tmxmpoy1ape mnvs sfsDrrurooo4tee mi3iysfm2uauvonu4teerifciytop raivo ()texo(o3nudlmenlfct sf Drrurpoo0aet ifeiasfa2rmnmpnt4 etrir3ootfm  ai s s0setm(r ou4omtnmnvtasf 2uax p;u0tltomoeias s uanvp t0artoir3iotop r ues ()seurxmpio1om nmictlt  2trurono0aet mi3iltlmDumuvs;t4altoir3to1lpDraivslt0trtoio oo4am emnvtat a2rmxr ;u0opxnmi3iytlm emnvp;(0 rxoifcoo1la   uei (0setm(m3io4optn nvsas a2umxro;u0alx io3ildlm2uaumo;()texomfcty1lp rlneolt0 2xoxmpiodolt  iet s) Draumont4tltomo3tat a2rm(vo;t4tlxomo iadlpt anesls)t2xrio oudapt  ivt t  Dtr(mo;o0aleomfciysls em(mont) rxnmfcoy1fpteluvsl(0srtoirpoo4op n ncslt) Durxm oo4tleoioetltlmDeaumo;t)texomrciodla rauvi s0s2tr(m3no4lptnmfei tf Drmxm ;o0apt mfctldls2ea(vo;t4treoio ia1lmtelnvslt0tetm(opou1am e ivi t arrmu ono0oet  f3iltla2umumont0 ltoxo3ty1omtr u o s0 2xmimpiy4omeelnes sfa2rm(m no4tpe mociyt s rau p;()texomfcia1lpDe uei (  rtmxo oy1oltemfet s aDuau oou1texn f3tatla uanvpnt0 exnifcia1oa e uvslt0 2xr(r3io4omtelfei sf 2tmxrp;u4oetnmoetatlm2eln s;t0 rxrmrcia1lpD luvi;(0 etm(o3iydlme lfctlsfsDtrurpnu0alx mieiytls2uanmon(4alxrif3iotfp eli s s0 rtoir io4lle mict s)s2urx  ou1tlxnioetasla uln p ()aleoxfciy1lp elivs;() 2toxopio4op  mfvil()a2umxr ot0openif3ildlm2rmu o t4texnxf oodfpDelueo s)trtmio oy4ol e fei (  Drmx p;o1opeo f3iadfa rln snu)arxrircia1om rlnvi s srtoim oy4llt mnvi sfsrrrx pnu1tpeomoeiyd m2uluvs t0trtnif tatlpDeanvs s) etrxo3iy1lmtn neias s2ur(  ;t1aex mo3iadls em(mo;u)trtoif3iy1fpD livo s)trurim no1amtelfes tfa2um(  no4tet mieildfa2uluvp (0 rxniociatopDelneols0t2xmim oodam  mnei t arrr(  nu4opxo oeilsfa umnmsnt0 eeomo tadfpt li o ()seur(o3iy1llee ici t)s2tr( o;t4alt mociasfm2umn o;t4texrmo oodop  anvo s0 rurir ny1ol eliesatf ruau o;u0optnifctadfs2em( s u0aeeomr3ootlaDeaivolt0t2urxr3no1ol nmfcsatf 2tm(rpnt4olx  o3ildls ranvont) exomr tytop rau ils s2tm(rpou1lmtn nes t)a2tmurpoo1aptnmicils a2umuvonu)tltnir iy1lmDr ivols)texoim nydope mnct t)s2ur(m nt4oee miciltfm rl(mp;(4 lxrxrcia1fpteanvslt) 2uoxm3iy1om nmicsa()arrm(mo;o4tlxn fetyslm2ua(ms;t)altoir3iodlpte ueslt0texo(opoydoltn ics sfsrur(moot4aet  ieiydfa2rlnmp t0tlenmr3iydla rlu i;s) exr(o3iy1ol nlnvias sDtm(mooo1oeenmo3tysla2rlu s;(0 rxoifcoatomtraies;s seuo(o iydap e icslsfs2um(rono1aeeomfciat a2ulnmo u) eermrcoodfpDrluvo s0s2umxr oo1ap emfvtlt a2taxrpno1alx mf3tytls2ulnmp;u) ltomr3totomD auvs s  rxr(r3iy4lm   ivi tfa2raxrooo0aex moeiasfs2ranms (4 ltrxrctydopD li i t0trtmir oydomen fvi s arum( poo1tlen i3tydfm ua( s;(4aeenif oy1lmt au ils teum(m3ny4ap e ivsl( artaxrp;o4tetoii3iysfm2rln s;t0artrifcoa1lmteau sl( teum(rpio1lpte fvt (  2tau  ou0tltomfciys aDeauvp u4 renmrcoa1fmt aivo;s0 rumxo ny4omt  nes ( sDumu pnu4tex mfeilsfaDeauvsn(0 lxrxr3oydoaDe nvo t0 2urir3oo4lpe  ietlt)aDtm(rpou0oex mo3iasls2rmuvpnt0artoxf3iy1oa e ieslt0trxriopno1op nlivs tf rtrurpot1apxomieiatlsDrlumpn() etrir ta1lp raieols0setoir iy1lle  nci s sDurxm nt0alx moeiysfs2ul( onu)teenxfciatopt anvsls0seumir3io1lmt livs (fa2taxr oo4aleoiociasls uluvp t4 rtrio tydfat au o ( truoxo3iudlltelfct t) rraumo;t4aex mi3tld s em(mo t0artnmo oa1laD  u i;(
\ No newline at end of file
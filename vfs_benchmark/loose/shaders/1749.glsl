@@ -0,0 +1 @@
+i o s0 2xmxmpnu1lm  licsa()srur(root0alxomoctls mDrlumo;t0alxoif ia1lpDrln o;t t2trio iy1aptnlnctlsfartmx pou0aet  ieiydfm2ranmo;(0 exnio io1lmDrlneil()texmio3ny1olt lncil( a2ra( ooo4alto feiad m eaumsn(0artoxf3oy1oa  au s (0texrxmpny4apenlnvs sfsrtax pou4tlxn f3ildlm2uan on(0 ltoxfciadom ean ilt)t2xrxrpio1omee ivslt sDtmumo;o0aexoiociyslsDuanms t) rtrxf3totfmte i s;s) exr(m iy1ap  lnesa()srua(rooo4tlt  i3iatfa2rmuvs t) exrxr3oo1omDeanvs;s t2umim no1op e ietas)sDrmum no0aeenmietaslm rmnmpnu0tetoxrcio1fa  aivslt seuriopou1apen netlt artaum ;u1tltomiciyd mDrl( o u0trtoif oytom e uei;s0s2tmirpou4amenmnesl(fsDuaumo;o4oetnio3iltlm eluvs t0trerioctydoatr uei;s0s2uoimpou4llte fcils) rrm(mont0oeenmfeiyt s2ra(vp;t0tltrxf3oy1fmD lneol() 2xm(m ny1apte nct (f rtmu pnu0tptoiiciyslaDra(ms u4 lerirciy1lm ranei t0trurxr oo1amenmivsa(  Dum( ont1ope ifciadfs uanvsn(0texoir ootfm eauvi;s0 ruo(rpno1optnlncil()a2trxmp;u4optoio3iltls el(vo;t)arerxf3iodfatrlueo;t)tetmir iu4opeemiesas) 2rm(m ;o4olxnmfciatfaDul(mp t0 ltoiocoodfpt  ivi s)tetoio3oydope mieilt)s2rrxm oo4ole iociysls2eau sn(0artrmr tytopD aueol()sexoio iudomt mietls) 2tr(mpnt0opeo ictat sDem(vp;(4 rerifcoadla eau i;() 2ur(r3iu4lpt mnet s  2rrumpnu4aee mf3ilslsDua( s;u0tlxoio3ia1om  ai sls  rto(r no4optn fet sfaDtaump;o0oeenio3iys s2eaumo;()tlxrio3ty1op raneo;() 2uoxopoudopen nct s sDtru o;u1tpt miciasfa ra(ms;(4tetoirctotlpte i i;( t2uoxrpiudamenmnet t) rur(mooo0opx ii3tysfm2rl( p t) renmfcty1omtrauvi;(0seumim3no4omtnmfet s)aDur(r nt1tlx  ociatla2raump;t4teerxo3iatopDeln i s srxmimpnudom nmfvil() 2raumooo0opxnioetatls umnvpnu4teermfciydop   n o;s seurim iu1op n ietl(  2rrx  nt0optniocilt s2eluvon()tltrxr tytlpDr nvsl(  rxmxr3oo4lptelivi s aDua(rpou4opt  i3tadlsDrlumo u4 reomr3ootfpDeai ilt) eur(m iy4lp nmfviat)srua(rpnt0apeomfcilsls um(vp ()texnmfciy1omte ivo;( tetr(o ou4al elnvi (f rtmu pnt1alto ieilsls2umump;(4 etrxf3tadoa  au sls0t2um(o3no1om  micias) 2rrur ;t1olxnio3tltfm um(ms;() exnmocootfaDrlueo ( setmxm iy1amenmietl()aDrrx  ot0apxnif3iys m2umnvp () rtnmoctytomte u o;( t2trir3ou4lp   nctas a2taxmpnt4alto oeiltlmDum( on(0aeeoxoctatlaDr i sl( sexr(m3iu4apte net sf 2tr(mpoo4oex  octldla2umnvsnt0alxoircoatfmte n i;s  rxo(rpnu1am nmieil(fa2rm(moou1apxnii3iydlmDumnmpnt)aetrxo todfmDelues;t0t2xo(r3iy1ol  lnvt (faDua(mo;o0tlen octydfa2um( o t0aetrxo io1lp raiei;t)teumirpoy1lmeelfet sf rua(  no0apt  iciysfs2ra( onu0tetnif todoptrai il()trumxm3nu1omeelnvias a2rmuro;t0tlxnio3iyt a ea(vs;u4alxomrciatlpDe ivo;t t2xo(m3nu4opt lfcia() Durumpoo1alxnmfetldfmDranmp;u0tlxnxr totfpDr u ilt)t2trxopnu1am emfeia()aDuaxr nu1teenifetad s emuvp;t)alerxocoytomD an o t trtoxrpnu1aptemfvil( aDuru  ;o1tpx  feilt a2rl(vp;u4alerxf oadopD lnvs ()srum(r ny1omt  nvt t)artrxrpno4aeeo o3tytfmDrluvo t4tlenio3iodfaDranvilt) rxoir3iy4opeemncsasf rtmx  ot4aex mfciydfa umn p ()areoxrctydop rau sl(  2umim io1lme liviatf Dua(rpou4aeeo feiasfaDua( p u4 lerxf3todlmD lnei;t0srtm(r3nu1apt  fetlsfa2tmu  oo4teeo i3iasfa2rlnvpn(4 ltomfcta1op elneo;t  ruo(r3oydalenmneslsf 2trxmo;t1open o3iyd m uanvp;(4aeeoif3iotop r neolt0srurim3iydalt mnvt sfs2ta(m ou0alt mfcils a2rm(vp t4 lxniociatlat lnvslt0 etm(o iydlp e fcia()s2rrx  ;o0aee  oetysla ra(monu4 etoxr3tadoaDeluei;() rumirpno4om elfcslt)artax ont1oetniieiyd s raumonu)alenmocoatfpt luvsl(0seurxm3nu4lp e fvt tfsrrm(m nu0oltnmicildfmDranmp u)aleomf iotoateanvi;(0trxoxr3nodapenlietlt a2rmxrooo4tetn o3iatfmDranvs ()arxoxoctadlpDeanvs ()seumim3ou4omtnlfcta(  rrr(mont4tpto oeiyt a2um( p;t4tltnxf iytfaDr i sls0 2to(r3no1op nlics sf Drax  ;u4tet mo3iydls2uauvon(4treoxr oy1laDeanvils0teumxr iodamt lfvtlt aDra(moot0oetomf3tas m ul(vo;u4arerio io1lmt lieilt0texrxr3iydap nmivs tfsruaumooo0oltnif3iyd mDulnvpnu0 exrxfcoy1fm eanvslt  eto(o ou4am  lnvsat)aDrrurp;o4tpt if3iatfsDeln o u0tlxnxo iotlpD  i s;s  rxrxm3io4oleelictl() 2tmxmo;t4olen iciltfs2umnmo;(0tlxnif iotfp  an ils  etm(r3ny1opte fetlt  rtr( onu0oetomi3iltlsDua( o t4 etrmoctydfpte i s (0texoxm io4ol emivias sDtmu o;t1aetnioetytls2emnmsnt)arerxo3iytlaD  ies (0srxm(o nudap emiciasfaDrr(mo;u1oleoio3taslaDrmnms;t4aeerxf ootfmDeanvsls  rtrxmpoo1lm  lfvt s s2taur nu0oeenmictytfs eaump;u4aeenxf todfmD ai i t  2xm(rpou4olt mnvtlt) 2tr(m no0olto fctadfm el(vo;(4arxnmociadfp rau s s  rxoim oy1opeemfvsat arrau oot4texo i3ias aDrm(vpnt0tetnifcio1oat lu o s)teum(mpnodoptn ivil() 2ururooo4oetniieiys a elu o;(4tlxoiocto1fpt lneo;s0trtr(o3oy1ll nmnciatfa2ta(r ;t4texniicilt m uauvp;t4aeerifcia1om raieslt  2to(m3nu4aptnlicil()sDurxm ou4oleoii3ilsfs eluvsn()trxnircoadom r nvs t)t2urxm iydoltemnvsl(  Dtaurp;t1olxniieiydfs rl(vs;t4tlxnioctydop eln ilt) 2xoxopnu1lpt mfetltfa2urxrp;o1aleo oetldfa2em( p u)aexoxo3ia1lpDrlivslt trumxr oy1llt  ici tfarur( ono0tlx  ieiydfaDelnmp;(0treomoctodom rlnvol(  2tm(o nu1lptn net ( s2rm( pot0tltoifcilsfa ua(vo u4 rtrmocoytfaDrlnvol() rxoimpno1ame  nes ()a2uau  nt0tle  ictasfm eanvs t0 ltnxocoytoa rluvo;(0seuo(o ou4lme lnet (fa2rmx o;o0apeomieiasls rau o;t0trtoxf iydfa elnvsls0 etoxo oo4lptelnetls) rtr(r oo1aeeniiciadfa emuvp t4 rerif3iy1fm  aueil()teumxm3ou1optelfvtas)aDua(  no4apxomfetyt sDum(ms u) exnio to1optrluei ( trxoxmpoodlmeemici ()s2tmxmo;u0oex if3tysfaDran p;u)tetoif3ia1lmteluei ()texr(o nu1omtnlnesat s2tauro;u4opx mf3taslm rm( s (0aexnio3io1oateaieolt sexrxm iy1lm nlnvt s arurumpou0oltnmi3tydfm emnmp t0 lxoxo3tadla e uei t0trtrxo nydllenmieiat)srtru  ou1tpto i3iasfs2eauvp t0 reoio todlpDr nvi;t sexrim3oo1lptnmfvtltf 2taxr ;o1olxn ieiasfm2umu ont0 lxnxf tytoaD  n o;s t2xoxm3oo1op emnvi () 2rax pnu1tetomf3tytfs elums;t0 eermo3oatfaDr ues;s teumxopoy4am nmfctat  Drr(m ot0altnioctat m eanmsn()artnifcoy1oa  aneo t0srumiopoo4omeelnvil(f rua(r ou0oee if3tldfmDrau pnu4 lerxrciy1oat auvs;()s2uo(rpoo1ame lfvtlt s2rrumont1texomoeiad aDul(ms;() etnmf io1faD luvi ( t2xmxrpoo1olenlivt tfaDtmumo;u4teto icilsls2ulu s u) reomfcta1oatran s s srtmim3ou4am emieta(fsDrmxmpnt4opx mfctlsfs2uluvpn(0 reoio oydoat  u olt srxoxrpoydll nmies t)artaxm ;u4alto oetasfs2el( o (4trtrxr3ia1fa rlnei (0trxo(r nu4aptnlncsasf 2rrx oot4alenmi3tytlm ul(vp (0 rtrmf tatfaDr nvi;t) etrxo iy1openmnetlt)s2taxr ou1oleomoctasfsDuanmont0 ltnio3iadfm eanvi s)sexoxo oodap nmfeiasfsruax  ;u1oltomfeiyd s elumo t)trermoctotfmt  uvo t0 rxoxr iy4apt livi tfsrur(ront4aeeomoeiaslm em( s () etnxf3iydomDr iei t)trxoim3ny1omtemfes sfa2tmx  ot1apxomfeils aDumuvo t4 ltrxf3iydla rauei (0 2uoxmpou4lle  nvia( srur( p;u1apt mi3iys mDuaumonu0altrmo oo1om   ueilt0trxrxo oydlp e feils s2urur ou0olx  o3tad s2rmums u0arxnxr oatfpteaivi t)s2xrimpiu4ap e fei s s2raxmoou4tltn i3tad m2ua(vs u4areoif3ia1lpDrlies;(  exmir3nu1omeelicsls)s2umumont0tltoif3tysfsDrlu o u4tlxrio3oytomt lu o ()t2xmxmpny4aleelnvsat aruaur no1apenii3iltfsDua(mpn() exrif oytfm elnvils0seumim3ou1al  mivslsf rrrumpou0opxo ieiys aDrl( o t0teerxociatomDrlivo s  2tmxr3io4lmtn fvsl(f 2taxm nt0olxn oeiyt s ranms t4tltomociatfmte n o t) rumxr iydllenmneias)a2umxmoot1optnifcilsfm2uau snt0altomo3oatfpD  nvil(0 rtmxopio1al e fcsls)a2tax  ot1oleoii3iys sDea(mo u4artoxo to1oat  u i;t  euoim oydlm nmfvsls)s2ua(rp;t1tlx  f3iytfm2eluvp t)altrmo ootfpte i o;t seur(o3nudom nmivi (fsrua(ronu0altomfcildla ranvonu) lxnif todopDeaueo;s) 2tmimpoydal nmivt tf 2uau  ou4tee mo3iytlaDran o;t)tltnxo oatom elu olt)t2ur(r3iodaltnlnvtlt  rrm(m ot0olx ifetldfaDeln s;t4texnxf iy1fp   u olt) 2xoimpou1alee ieias a2rm( p;o1tltnmi3iytfm2um(vo () rtnif3to1lm e ieolt  exr(rpoo1ol nmnviltf rtrxrp;u1tpen oeildlm2ra(vo;u0tlxnio oodlp raieslt)t2xrxr oo1op elfct (  2ra(mpou4tlen fetydla2ra(vs;u4texnifcoy1fpteli s s0setm(m3ou4lmeelnviatfa2ua(r ;u0aleoiieildlaDum( onu4alxoxfcootlm eaneolt) rxoimpoydol nmiesls srtr(r nu1tptniieiysfm2el( s u4 rtoxfcoo1fa elivils) 2xo(m3oy4lpt  fvs t) rrmump;o4oetn o3iadlaDrl(vpn()aexomo3ty1lm   ivo (0trto(o3io1omenmfvtl()aDuaxm nt0oeto ictltfs rm( snt0 ltnxo totfptrliei s  eurir3io1lpe liesat)sDurxrpnu1tpt ioctys m2ulnvs u0trtrio iatfmt an s ()t2tm(o ou1oltnmicil(fa2umu oou1olx  oeilt m2ean p t4teenio oydfa rlivs;()s2xmxm3nodom elncsa(f 2tr(r ot1ale  octlsfsDum( o t4 eenmo ty1lpDeauvs t)teurir no1ale mfvi s artrumo;u4tle mf3tltfs2ra(vs;u4tetoio3iy1lp eanvils  2umim ou1ole mnvsls) rrax pno1apxn fciasfa2ea( p t4 exoxrctatfpDraivilt0 2tm(r3iydol  mfciat)sDurxmoot4optnmictatfa emn o;u4 lxomr3totop e nvo;s  2tr(opoy1llte ncsls)aDurxr ;t1aexn ieilsls elnvs t0 exnmr3tytfp e neo t) 2urio no1alt lncs t)s2urx oot0apx  ieiltfa2ra(mo t)arermfcoodomtean i;t0tetmxr3oy4apt lics ( aDra(ront4optnii3iatla2uluvo ()tlxomocoo1fa elivs;s)t2um(o3iydap   ncslt)srraxrpot4aexomi3tatfaDrm(monu0artoifctodomDeaueil( setmxopnydape mfeils)s2tmx ont1tee mocias mDul( s t) lxoir to1omt  nvs;t0seumxr ny4lm n iviat) 2taxr oo1openif3iadls umu p;u)aetoif3oydfa  li i (0s2trirpou1apte fvsa( sDta( p;o4altn ocildlm2rlumo u0trxomfciytomte nes ()t2toxr iudlmte fesatfsrua(mpoo1alto i3iysfsDrln s;u)aeerxf3to1fmDeaivsls)t2toim3ny4omtelietas aDumuro;t1tlt mi3iysls ulump;t)teeoxoctodfp  au ils0seum(rpiu4lptn fcilt artmuro;t4oetomi3tldfa2ranmp;t4 eerio oy1oat luvo;t  rum(o oydllt  neia()srrrum nt0oleo o3iatfs2em(mp;(4aetnmocia1omDeauvs;s sexo(m nu4ape mncia() rumurpou1tpt  o3iydla rlu pnt)texomo tydfmt luei (0srto(mpoo1lltnmncilt artrx o;u1olxnmociytfs2em(ms;u)alerxo totlmteaivs ( srxo(o3iu1alenlnetl(f Dumu poo4oet  i3tysfs ea(vsnu)tlenio ta1fmtrauvi ()seum(m oodaltemfeias)a2uaxrp;o0tpxnmoctlslaDulnmo;u4aeenif oy1laDrluei s  eurimpiodlltn nvs tfsDum(r ;o0altomo3tlt aDumn snu0trtoxociotoaDrlnvilt)s2tm(opno4ame mfct sfs2tm(rpoo0aeeomo3iaslmDum(vo;t0tlxoio3todla rluvilt)teur(r3oodopenmfviasf rrrum ;t1tlx if3ilt aDuaumsn(0 lermr3iy1fp rlivi s s2tmim3ou4lm  lncs t srraxmpnu1tle mocilt a2emnvs (0 ltnxf totlmt livils  rumxrpiy4ap   fviat)a2urxr ;t0tlx iietytlaDra(mo;t4 renmr3ootfmD livo;() 2ur(o3no4aleemies t)s2rmumpoo0aexn i3ildls umuvs t0alxomr3tatlmDe ivs;s setmxr nydoltn fvsas) 2ur(mono1open ietlt aDuanvs;u4 exoxocty1la  auvsl(0 exoio3iodlmt lfcilt  2rrx ono4aeeo f3tlsfa2emuvp u4 lxnif iotlpt  i sl(0trxrim iy1amtemfvtatfsrtm( onu0tltn i3iadfs2ulnmo;(0treoxf oydlpt  uvsl( t2ur(m oy4lp  livsls  2raxmoot0aet iiciat aDul(vs;t) lxrmo tydoptrluvo;(0 rxrxmpoudlpt lncsa(f 2tm( pot0tpx  fciytla2ua(ms t) lxniociotomtr n i;t0trxmxrpoodamenlivt t)srumxmooo1oeenmoeiysfa2ul( o;u4 etomo ootfpDeau sls0 2toirpou1aptelieilsfaDtmuronu1aeeoiieiasfsDranmsnt) lerifctodoat ln i t0seuo(opiu4lmeelivia(  2umum ot1ole mo3iaslmDelnmont0 eerxr3io1fa r ies;t) rtmimpnu1lmtn iesa()a2tmxmonu0opx io3iasla uauvp u0 exoxo tadfptr n s s0s2uoxo io4op nmivsasfaDtaurpot0aleo i3iyt s em( o;u)tlenioctodlat lueo s  rto(r iy4oltn ivil(f 2rru  oo1tpxo oeiytlsDrmu pnt0 eenmr3iodlate n sl(0 2xmxrpou1lp e fetlsfsDtru onu0tptnifctytlm2el(mp;t0 renxr3ta1lpte uvs s0 rtr(mpoudap e ivilsf Drmxrpno0tlxoioetas s rl(ms t0aeerxf totomDraies;t  etr(o oo1aleelics tfsDtrurono4tpxn ieiatfm ulump u4arxnmo oodom rauvs () etoim3io1open feiatfsrtm(  ;u0oltnifeias a rauvp;t0aexrxo3tadoat  ivs ( s2tm(r3nudol  mfvt t  2um(r oo1aex ii3iysfsDrm(vo ()tltnxfcoodla ranes s0srxrxm nu4lmtnlncias  Duau  ot4tlxomf3iydla elnmsnt4 etomr iatop elivi s  etrxm3io1am e nei ( srurxr ;u0apx  f3iyt mDuan s (0tetoio ia1oat ai ilt texr(mpiy1altnlfet s)s2umuroou1tpe  icilsls2ua(mon(0alxomocta1oaDe neo;t0srxo(r3nu4alen neiltf Duax  nt1aee mi3iat m ulu s t4aeenxr iotlm  luvilt) exoio io1lm  liciat aDtr(mpot0apeo f3tldls uanvs t0 lxoio3oytomD li sl( srtmxrpiy4op e fvt t artmum ;u4texoiieiydlm2em(vo;u)aexrir iydoa eaneols0 exmxm no4om nmfvs t sDtr(rono4aptomo3iytlmDul(ms;(4 lermf3iotfa rlivs t  2uoxm iudolenmfes ()aDrr( pot1tltnmfctytfa em( on()trtoio3totfp r ivi;t)setrim3oodoleeliesat) rtrurpou0aptniociadla rau p;u4tlxnmocio1lmDrlivi;t0srum(rpno1lmeelnvta(f rur( pou1apxn o3iyt s2ua(vp;t) rxoxf3iytlmtr i s (  exmir3oy1aptn neil( arta(mpoo0alxomo3ild sDul(mpnt0aeeoxo iytlaDrlieo;( srurxm3io4lptnmnct t)srra( pou4texn feiltlaDrlnvont)tetrmf3iytfa rluvil(0sexrxopou1apenmivilt a2ua( pnu0oeeo o3iad s2uau o (0aexnxo oo1oa rlieo ( t2tmio3iy4alte feias a2umump;o4tleo fctld a ulu o t0alxrmf3tadfm   ueil(0sexr(o oy4ll elieils) 2tmur ot1altoii3ild a2eau o;t4teerxrctodoa r iei;t0sexrxrpnu1am emivt (fa2rrumpoo1tetoifctltla2rl(ms;()trtnmr3iodfaD  i ol( teum(o3nydlm  mfvtas  Dur(m ou0tlxnmfeiatfm em(mo;() rxnircoo1fp r neols  ruoxr3oodal nlneil(fsrurxm no4oeeo oetad a rmnvo;() renmf totlmD ai olt  rxoiopoy1apeelicias  Draumonu0oetn o3iytfs2emu p (4tetrxf3oodlp e ieolt0sruoxr3ny4olee fetlt arua( pno4tpxnioetydfaDul(vp u) eenxf3oatlaDr uei ()setoir iu4apeelfct s srtau ono0olx  o3iadls2uluvo;u4texoio3totfaDelu o;t) 2ur(rpoo1lpen nviat)arumu p;o4texnmi3iltfs2eauvont4alxnifcoodoa e uei s0s2xmxm3oodlm n fci s  Duaxrono1ole io3tldls ua( sn(0aexnmrciydoate n i (0 rtmirpnudapt  fcilsf ruaur ou1teto i3iasfa2eanvpn() rxnir io1fptrlu i t t2um(m nodlp nmncsasfa2ra(mont4oetn ictatlmDrlu p;u0artnmf oo1opte ieo;s0 2umir iodlleelnci () 2ra(mo;t4tptomoeiatlm2ua(mpnt0 lenxo io1oat  u i;(  etrimpny1altnmncs ( aDum( ono1aptn f3tlsfaDumumsnt)arxnxr3oytlmDelivo;t0srtrxr3nydomt mfvtlsfsDtr(rp;t4oeenmfeiasfmDrl(vp;t0tlenio3iydoateaivo ()t2toxo ny1lp n nvi ( sDurumono1oetoiieiaslm ran p () exrxo iatopDe ivs s0trum(o nydap e ietls) rtrumo;u0olxomfciytls uau p (0texrmf oo1oa r n i;s)srtrir nu4lm  lici t)arururp;u1tpenmi3tytls ulnmp ()tlxoxrciy1om   uvs;t)srxoxo nodaptnmnctltfaDtr(ront1aptniociysfmDrlu p () eermf iadom  aneolt) rtrxo3oy1aptemivils a2tmu  no0aeenmoeiadfs2rl(ms u4tetrxr oatomDelivs s srtmxrpoudlm nmfcsl(fsruaxmpoo1teeo i3ilslmDua( pn(0trtoio3iytfptrauesl(0tetoir iy4ap e fciasfsrumxmpnt4apxomfeiad s ra(mont4trxoxfciydla   neil( trxmim ou4olt mfes tfa2trxmo;t1altomoetltfm eauvont0 rtnif to1faDraiei;s0 2xrxmpoudoltnmieiat) rumumont1tpxn ociyslaDemuvo;()alenir3iytlmt lies;() 2xoim io4altemnviat s2uaurpoo0tlt if3ilsfs ua(vp (0aeerxo3tytlpDran i;t0srxo(o nu1lpeemictat  rtmur ;o1oltn feiasfaDrmn sn()trxoif3iydlmtrluvs;s0t2xmxr io4lmtn icsltf rta(rp;t0oexniictat a emu o;u)aeermf3to1fpDeau i;( sexo(opoy4aleemfeils aDtau pot1olxnioetltfsDua( o t) ltomr3tatfp eanvsl()truoimpoy1amtemnesa(f ruaxrooo1aetniietlslmDem( p;t0aeeomo ia1fmtr uvsls) 2urimpnu1alenmfesl( s2rm(  ;t4oetn ociat a eauvp;t) rxrxocootlmtrauvsls t2to(m3ny1ome mnvslt  rrmu  ou4aeto oeiydlaDuau o;u0aeerxrctydomt  neo ( srto(mpiydoltemfvs s) 2rrxrpnt0tpenmfcildlmDeaumsn(0tetrmfctatopDeln slt)t2xmxm3io1apeelfcils  Drau  ou1ale mfetld mDrm(mon(4aetnirctatom ean s;s0 rtrirpno4ll emfeiat)srrmxmp;t1altn ociltlsDeln o;u0 ltrmrciy1op  lueil() etoim3ou1al nlncsa() Drmu p;t1altnmfeiltlm2umu s;u4tltnxr tytlpDelu o (0t2trxo oo1ole lfet s)aDrm( ont1oex io3iysfa ulums (0aetoir oadfa  auei;s  rtmiopiydolenlivi s)arrrur nt1tetoifciaslsDeaums (4trxrxo oatlm rlu i s)s2xrxopiudlp elfvs t)srumur nu4tlenmo3iadls um( on(0texomrcty1optran s;s)t2ur(mpnu1lmtelnctas)a2tau  ;o4apen fciytfs2uan o (4arerxf3oadfp eaivils0trtrirpou4omeelfvils)a2uau  ;t0oet  oetatfs2umums t4tlxrmf3ootoaD ln s;s0seumir3iodlptemfctlt) 2ua( oou0ape miciasfs2rmu snu4trtoxfctytlpD livi ( s2tmirpnodom  lfes t aDurum oo4ole mietatlaDrm(mo u4 reoio ta1om   nvil(0s2xoxm iudolt mneiat)a2trx poo4open icias sDulumon(4areoio tytlmDeauvslt0srum(rpno1ape mfvsat)aDrrxrpno1optn oetysls elnms t4alermrcto1fpDran i s trtmxm3iu1omte fcil()sDtmx poo4tleomf3ildlsDumnvpn(0texomoctydfpDrlivo;(  exmxr3oudlp nlneta(fsrrmxm oo1apenmfeiytfaDranvp u4 rtrmo oo1lat ln ol(  eurio3iodam  lnvs (faDumum ot1oeto oeiysfm2rauvp;u0teeoif totlpDrlieo t0 rur(opnudol e ivils) rraumpnu4olenii3iytfs rl(vsnu)trenio oa1faDelu i (0 etm(rpnu1lpte icslsf 2tmxrpoo0oltnmfciltfsDum( s;t0 eeomf3iy1fp  an o () rxmio ny1omtnmfci ()sDumumpno1texniiciat a elumsnu)texnxrctydop  an slt0 2toxm oudame  iesl(faDrmxmpnt0oltomfctasfm2ean snt4 exnxfcio1fpD aieo;(0trumxopiu4op  livia() rrm(rpou4tex moeiasfa ea( o (0 eeoxfciodlat  ivs;()trxoxopou1ope  fesa()artmu pnu1tlt iocilt m rmump;(4 exrmo tatomteanei;( sexmxr3ny4amtemncslt)srur(rp;t1olxnmictlsfmDeluvonu) ltnxo iytfateau i t) 2uoxo3nydlmte fvtl(fa2tax oou0tlt mf3tat mDrmuvs;u)artoif3oydlp eli i (0 2uoxr iu1op n feias  2ur( o;t0tlt  o3tyt s2raumpnu0areoio3todlmDrln o s0trumxm3iu1ap nmfvsasfsrrau  ;t4ope  f3iaslaDel(ms;(4tlenxocoodlp rlieo t  rxrxrpiudapt lfcsasfaDum(ro;o4aee  ociad s rmumsnt)alxoxo iodlm  li s s  eto(o3io1ap n fesa(  2taxmo;u4alenmo3iyt m eauvsnt)altriocoatfm r nvil( tetr(mpny1optemfes (f Dra(m ot4aee  oeiysfs2eau p;u)tetoircoo1omtranvsls) 2trxr3ny1ope mivtl(  rrr(rono4aexo o3tasla2umn o (0trerxo3io1optrluvo;t)texoxopoudolen ieil()a2rmxrono4tlx  feiadla uln s;t) lxrxo3oa1omtrln i s0srxm(r iydlltnmnvs ( aDumxrooo4tetnmfciat sDuauvo (0aleoxf iadlm eai o t) etmxo ou1olee nciasfaDum(r oo0opeoiieildfa2ul(vsn(4texomf3iytomtr uvi s)t2tm(r3nu1al emneslsfa2ra(m ou0tlxo i3tatfsDumu pn(0alxoio3iy1fp  aiei;s trxrim3io1ol nmfci tf ruru pot1oexomf3iatfm2eln p u) renxrctadoateln s;t s2xr(o3nu1omte nct (  Dtru  ;o0texo oeiadls rluvon()alxnif ia1la   uvo;s0 2xo(opoy1ol n fcsas aDurxmp;t4oeeomf3tydlmDuau o t0 rtrirciytoatrlu s ( s2uoxm3iydoptemfcslt  Drm(moot4tptomocias a2eluvs;u4texrxr3oa1lmt lnvi;(  2um(r io4lltnmieslt) Dtm( p;o4olen ociytla eln pn(4artoxrcoy1latr ueils  etr(rpiudomt mnvtls  Dta( oot1texoiietls mDelnvp;t4arxnmf3totoat  ivo s)t2umio iodamt miet ( srurx  oo0tlenmf3iytfs umuvsn()arxomo ia1latelneslt0s2xrxo3iudame mfvsasf rrrurpno1tpeomoeiasfs2ulumsnt0 rxnxrciy1faDe n s s t2xoxr nu1lpeelfeiat) rraxr nt4olx iociatfs2ea(mp t0trtrmo oatlptr uvolt  2triopoydom   ictat)s2urum ot4ape mo3tytls elnmp;u) lenmr3ootlaD lieslt0s2xoxr3iu1ol   neilt)arrrxrpnu4tpeoiicildfm ra(mo;u0 etrxr iydoat luvo;t0teuoxr3nudoptnlfesa()srumurp;o0oexnmieiyt a2rlumpnu) eeoio ty1lmt  iei;t) rum(o nu4lptnlfvs t)arraxro;t4tpx mfcildfs2rlu s (4trtrmr3tytoptranvs ()trtriopoudape  nvsa(  2rmu  oo0tleoio3tat s2rl(vp t)areoio tatfmtrli sls  rurimpnodll nlfeil() Dtrurpot0olto ieils s2ean o;u)tlermo to1lmtranvils0 exmxo ou4om nmiciat  Dtmxrp;o4texnmi3tysfs rauvsn(0 reoxf oy1opDeanesl( teumir3nudomen ieil(fartmu o;u0opeoiiciatla ulnvp;u4areomocty1la rai ol() rxmim3oodom nlivtlt)arrru  ;t0aptnioeiasla2uauvpn(0trermo ty1fpt an i;(0 etr(o3io1al e ici s)a2uau  nu0oet moctatlm2ua(mp;t0aexnio3iydfa eaivi t t2xoxm3iu4al  mfesat aDtax pnt4oexo f3tadfm2umnmp;u0 ltnmf ta1fm rai s t0seto(r io4lm   ictls)a2rr(r ot0tlxn fetls mDeln pnt4aetomf3oatfaDrauesl( trxrimpoydlm nliesatf 2rr(m oo1opx ifetldfm ua(mont)teenmr3iytlat auvo t)trtoxr io1lmt mnctlt) rra(m nu0aet  i3iysfs rluvp u)trtnio oodoptrlu sls)s2urxrpou4lm n ivi sf rrr(moot1aeeoii3iad m2rmu s;t4altrirciy1latr i olt  rxrirpoy4opeemivils aDta(rpou1oex mfciasfaDuan sn()trenmo iodfptelivi;s0s2xo(o3ou1lmeeliviltfsDur(rp;o1opx ioctltfm rm(vo u) exoio iadomteaiesl()s2tmxr3nu4lptn icils)sDtmurono0tpxniieilt a2ra( onu4tlxoxo3iotfm  li s () ruo(rpoudoleelnvtatfsDra(m nu4tpenioctls a rmumo t)altnifcoodop elivo t  rtoxm oydal  mnviltfs2raxrpno4apeomfcildlmDelumpnt) lxrxf3iydomte u ols0srurim3oy1om n nes t sDumxmo;t4ale mf3tadla2rlums;t0aeerifciydomDe i s s  2tm(opou1lm eliet () rtrxr nt4aexn ietlsla ulu o (4 lenxo oodoat lu il(0t2uoxo3ou4olee icsltf 2trur no0aeeo f3iltfaDraumpnt0teerioctatlp e ieols  rtoir oy1am elncsa(  2trxmo;t4aeeomictydfa ra(vpn(4 etoxrcoa1opte nvsl()trtoxr nu1ap emfctl(farrm( onu4aeeomoctltfa uluvsnt0trtrmf oytlmt  ieil( teuoxmpoodapt mfvtlsfsDrm(r nu0oexomo3iasla2ean snt)alermrctodla elues t trur(r3oudamtnmfvsat)srumumono0tlxo fcils m ulu snu0texoio3iydfmteaues;t  rtmirpoy1llt mnei s)sruaxr ;o1apto ieiasfmDem( o;(4 lermociatlaDe u sls)t2uo(m nodapt lnctl()a2rmx pnu4aexoii3tltlaDrauvo;(0 eermr oa1oa  aueo s)s2tr(m oudll emncs s) Duau ont4tlt  iciyslm2ul( s;()teenxfcoa1lmtrau i;s)truoim3io4olt mfctas)s2um(mo;o4tet mo3iltfm rmuvs ()treoxf3todlp raneslt)srxmxo oydamte ics t)sDurx ont4tpeo fetat m ulnvo u) ltnmrctatlm r ivo;t0seum(m iy4am elics sfartmur no4aeeoiieiltla elnmpn(4treomrctadoaDrauvo t)srxoir nodop nmnvs sf 2rr(r ;t1oee mfctydfm umump t0alenxo3oa1opDe ueolt trurio no1om nlfct s) rtaxmo;u4aleoiietad aDul( sn(0 ltnmo3iodlp eaivsls)trurxm3oudlm  lnvils)artaumpou1tptnif3iat sDeanmsnu0 exoif3io1omtr ieolt) 2tmxopoo4om  livt t  2rm( oot1tee mo3tld aDea(mo (4tlerifcoodlmDeauvols t2um(r3no4aptemnes sfs2rrurpnu4apx  oeilsfa rl(ms u0teeomf ty1fpD  uvs (0 rtm(rpnydalenlfcsl( aDtmum nt4tetn fciad a2rlu o;u4 leomf tatomDraivs s0srtmim3nu4ll nlfvi s sDtaxr ;t1aeeoiieiasfaDuaump;u)aeenxf3ta1lat  ies;s)t2uo(mpnu4opt lieiltf 2trxmont1tetn i3tyt m ea(vsn(0aexnmr tatfmD aiei s0seto(m oo4lp n nvsltfsDtrxrooo0teen i3iltfm2emuvs u4trxrxr3oy1la  an ils setoimpnodlle mncs t  Dur(  nt0altomoetad a em(msnu4aexoxocoadoa  au o t0srxmir ny1op   nesa(fsrtr( pot1opx ioeiyd m2emu snu4alxrxrciodlpDran olt trxmir oo1ap  mfciasfsrur(mp;t1aeeoifctlsfaDuau pn()tltnir iy1lp rauvs t0 etmxr iydlmt  ncs (  rua(m oo1opxomoeildfa el(mp;(4 leoio oa1lmD liei;t0s2to(o3iu1alenlfvilt s2ra(r ot0tlen f3ilsfsDua(vs;()aetrxo ta1lpDranei s)trto(r3nu1olenlfvt sfsrtrxmont0texn fciyslm uluvp;t)trxoirciadoatr uvs s0 2tm(m3nu4ol  mfcta() rumx p;o1aetnioctatla ranmpnu)trtrmocoy1fp eln i;( srxriopny4apenmiei tfs2ra(rpno4alto oetlt m uanvs u4tetrxocia1lat luei;t t2uoxr ny1lltn ictat) 2tax pou1aeeo feiatfm umu onu0aexrxociy1late ies;( sexr(m ou1lptn ieta( s2tr(  ;o1ole mfeilslm rl(mo;u)aexrmr3oo1lpt aivo t t2um(opiu4ope licsasf Dua(m oo4oetn octyd s rl(mo t0alxrxf oodlpt luvols) 2to(r3iy4lleelicslt) rtrur ;o4tlen oeils m elu p (4teeomf3oadomD an o s)texrxo iudlme  ict sfsDtmxmpoo1ole  ictltlm elumo (0 rerxrciatfmDelueslt  euoirpiu4amtnlici tf 2trxroot1aexnmfctyslaDrmu o;(0 eermf3iodomt lneilt  2tr(m nydamt  fvt s)arraumpot1tlx ii3iysfs2ran s;(0tetnmo3todfptr u o t)srxr(rpno1llt  ivia( artrxm nu4oleomieiysla rlnmsnu4 lenxfctodfmDelu o t texrio3iu1lmen fvt s aDum(rp;u0teen oeiytfa2rlnms t4 rtnmr3oadfat anei s0 exrir3ou4lptelnviat  Drr(mpno0olx if3tatlaDum(mo (0trtrmf totfpt  nesls)sexmxo3iu1omt mfviatf 2tm(r no1tptomfciasls2ul(mpnu) rxnircoadfpt  ieil(0sruo(mpoo1omtnmfcsasf Drrumoot1tle moeiytla2um(vp;t4arxnio3oatlm eai il(0sexr(o3no4lm n nci s) 2rrxrpot4tlxn f3iysls elnvo (4aeerio3ta1laDraivslt0 exoxrpoodam  mietlt) Dtaurpoo0tpe iietltfsDumumo;u4trtrio3oytomtr nvo s)trum(m iodoltelfvsasf rtm( poo1tltn oetytfm ea(vo;() rermrctadopDr u s;()t2xo(m3iu1ap nlicsas) Dur( ont1olt mfeias aDumuvp u4trenmo3oo1lm  livslt trxrirpnu1ll   neias)aDta(mpot1oetnifeildfmDra(vp ()alermr ia1lpt anvo;(  2umxrpoudll e nvtlsfa2tmxm ;o1ole  i3iys sDum(mpn(0 exnxf tatfa e u i ( t2xm(opno1amtn fes sf rua(ro;u4altn fetlt a uanmsn() renircootlpt au s () 2xoxr no1amt  nciasfsrumx poo0tet mociasfa el( s t4texnxrcta1fpte uvs;( setoxopoo4ope  fcia(f rrr(r no0tpto f3iys aDelnmsnt)trxrmr3oa1fm  au s;( s2xr(mpoy4al  mnetatf 2tm(  nt0tlxo oetlslsDrln s;u4tltomociotomDelivs;( texo(rpoo4opt  nvi s s2umum ot4optnmf3tlslm ea( sn(4tetniocio1oatrli i;()t2uoxm3nu4lleeliei (  2tru  ou1tltniietyt aDraumonu)areomocoo1omt  ueo s0s2uoxmpio1ap nmfei (farrr(rpnu1tpe  f3tad sDuluvpnu4tlxnif iadop   i slt0 etmim3io1altnlnvs tfaDuauro;o1apx ifciltla rau s t0alxrxrcoadopDranes;t) ruriopio4lptnmictl(  2tr( oou0tlxoifetys s2uauvs t0artnmo3oodoaD livs;()srxmxmpiydlp e ivs (fsDrm(r oo0aexnmfeiysfs2ul(vsnt4alerircoadlaDrlu s s0 etm(m3nu4olt mfei ( s2ta(  nu1oee ifeiyd aDrl(vpnu4 exnircoodom  livils) rtmim3oudape  fci tfsDumx  ot4tpxnmo3iyd s rluvo;(0trxrmr3totlaD ai i;s) etmiopou4lmtn fvsls) Drmxmo;t1opxn ieiydfmDua(mp t0 rerir oo1oa elieilt)srumio3iy4omenmfcsl( a2uaumpnt4oleniieilsfs2uln o u)trtrxrcio1fm   ueilt  2uoxr io1lp emivi () Dtaump;t1oeen fctld a2rl(mont)arxnxrcto1opDe i i ( teuoim nydal  lnesas a2ua(m nt4olx mieias s2eau o;()aetomrctadfaDrauvil(0trtmio iodomtnlnvt t)aDtr(m ;u0aeto oeiydlm2um( o (4 eeniociy1fmD li sls setoxo oudlmenlivtat) Duau p;o0alx ii3ias m uanvp;(4tetomf oy1opteaivo ()teumir3iy1alee fviasfa2tm( pnt0optn fetadls elnmsnt0 rxnmr tatlate iei;t)teurio iodopte fvtlsf Dtax  ou4tlt  ociadfaDrm(vo;u)alxoiocootlpD aies;( texoxr3no1am e nct () rrmxmo;o4oleomoctys a2elnvpnt4aexoifcoydoaD  i i t sexrxrpoydole  nesat sDrax  oo1tlx  o3tytlsDuanmonu0 lxoxr3oadoateli slt0texo(r3oodll emietl(f rtruroot1tpt ifctatfmDulump;t)treoifcto1lp  auei t0srxm(o3nudaltnlnesa(fsrurxm ;o1open feiadls rluvp (0teenxf todfpDrliei;s0t2xo(r ny1ll   ncilt sDtr(  oo4opx  fciatfa rlnms;(0 eeniocoytlp   u ol()srtmir3oo4lpee ivtl(fa2tr( pnu0opxnio3ilt a2rlnmsnu)alxrmrctytfatelivolt tetoim3nodlptnlnvt t) rrmxrp;t4alxn f3iaslmDra(msnu4tlxnmrciytlpD livilt0texo(o3oydol emfct s arur(mpoo0oet iiciadfm2uauvo () rxrxr3tadop e uvo () 2um(m3ny4aptemnvtas artrxm nt0tpe iiciat m2el(mp;u) exoxo tydlm e nvo t0seumir3iydlmtnlnesat srrru o;t4alen ictas a rauvp;(4arerifcootoaDe neslt)t2xoim3nodop  lnei t)aDrrxr nt0apt moetatfs2umump u)treomr3ootoptelnvs t)texm(r io1lptn nesat) Dtaxrpnt1tet mociasfs2rl(mo;u4tlxrxo oytfmDean s;s0trum(mpiy4om nmnvi s  Dtrxrp;o4oleoiociyslaDrmu p u) exnmr oy1fa rlnei;t) etoxrpio4al n ictl(farrau  no0oetnioeils s ulu o;() etoio3tytfat  ivi;t s2to(o oy1ale lietls) Dum(  nu1olxoiieiatls2el(vp;() rtrio3todfp   uvs t trtmxopiydoptelicilt aDrmu pnu0apto f3tadfm ua(vsnu4tlxrmfciydlmteli ilt0s2urim3ou1aleelnetls)s2umxr ou4oet mictldls2eluvonu) rtoxo3io1fatrlivslt) rxoxr oodlpt mfesatfsDtm( oou0aee mfeiat sDua( p t4tetrxf3oodom  li o;(  rtrxmpoodamtn nes () Drrurpnt4olt iiciatla2rln pn(0trtnxo ta1fpt aivol(0trur(m io4ll   ncia( a2ua(r ;o4aexoif3ilsls rm( p;u0 eenio tadfmt  u o;t t2xo(r nydlptnlfct t  rta(rp;t4optnmi3ilsfm2rauvo () ltoifcia1fp e neilt)trtmiopiy1ol  mfvtls srrm( pot0tlxniieiytls2eluvo (4treniocoadopDe iei s teumxr oo1lm   ivsat) 2ua(  ;t1alxn iciytfaDel(mpnt0 ltrxr3iatlaDrluvs;t0t2urim no4ome mnvil( aruauroou4tee io3tlsfmDean sn(4aeenxfcoa1lmte ueol( teumxr3nodam   ivsa( s2ua( ont1alxo octls m ranvo u)arxnxo3oatfaDraiei t)trxoirpio4ap e fciat sDtmurono4aex ifeildfs rmnvonu0areomr iadfptr nes;()srumir ou1al emnvs s a2tauro;o1tptnmieiasls2elnvp;t4aeenif iadfmDr nvi;t teumxr oodom nlnvtas)a2um( oot1aeeoif3iat a2rmn s;u4aetrxf3tadlaD au i;s0s2urxrpoy4aleelfctls srrm(  ;o4apt  oeiasla2rluvp t4aeermfcoydfpD an s t0t2xrxo ny4ap  licsa( s2umx ooo0tlxniictlsfa ua(vo;u4aexoif iydoaDrlnvs;( seurxm3ny4alen ieil()srurump;o0opt moeiys a2rauvs;u)trenmocia1fpD  uvil(  2um(opoo4apt mfei tf rrmumoou4alenioeiytfa2em( o;u)altomr iotfm eaieo;s srxoir3no1lleemfeslt  2taxm no1tee  o3tadlmDuluvp;u4 exrmo to1fmDrlieo s0t2xmxrpoo1omee nctls  2uauro;t1tet mieiydfmDrm(ms;u0aeenif3oo1opteai s;t0t2trxmpiudamtelnvsl(fs2tm(  ;u4tpeomfetltlsDumu o;u4alenxfcoatlmt lnei t0 exmxm no1lltnmiet ()s2rmxrooo4aetomieils sDrm(mp;t0 lxrmr ty1fm eanvo s0 2xoir oo4op e ictasf rum(rpoo1tet  i3ild m2rln pnt)arxoiocia1lptranei ()trxo(r3iudamee iet (fsDumu pnt4aetomiciatlm el(vs;u0trxnxo3oa1lpt  i o;t teurxr ny4opt mnetl()sDuau poo4alto feilt m2um( o;()tlenif ta1lm eli i;s) exr(r oy1lme  fvil(  rrmur nu4tltn i3iatlaDuanms u0 ltnio ty1om elu i;s0seto(opoo4om n ivsat)aDraurp;u1tlxomi3ilsfsDul(mp;u0tetnxr oo1omD  u o;t0setmim3oudll   feiasfs2uax  oo1tpxoii3iasla el(vo;u4 reoxfciatlm  luvs (  2uo(m oy4lm nlieil()s2ta(mp;o0aetnioctadfs2ran o;() ltomfcoadfptrlnvo s0tetr(r nydapt lneia(f rrm(mpou4tlxo ieiat s emuvo t0texrxoctytlm e uvol() etmxr oo1apeemnetlsfsrtm(ronu0aeeo o3tldla2rau s;t)alermf3todfatraneslt0truoiopno1ol elnes t)a2tm(mp;u0aexnifciysls rluvo;() rxnmo ia1omDeaneils tetmxmpnodap nlieslt a2urxrpnt1openmoeildfsDrl( o;t4 reoxrctytfpDran ilt)sruoxo oy1ll   iet ( a2trxrpou0aet ioctltfa2rm( snt0 leoifciadoptr ueils teumim nydape  fetls s2uau p;u0aexoiietytfaDuan o u)areomr3iatlm eauvols seuoxr io1lpenlieiat) 2urxmoot1aetn oeiatls rluvp;()tlxoxocty1oa   nvs s)s2xm(mpoudomte ivtatfsruaxrpoo1aexo i3ildls emuvont)trtoxrcoytom   i o;t) rur(rpny4lmt lieils  Dtaxront0altnmfciyd a eau o;(0tlxoxr3oodfa  lues;t sruoio iodlp nliciatfa2taxrp;o0apto ictadls rl(mpnt) etrmo totlmte uvi t seuoir nodll e nvs (f ruaxmooo4tptnioeiltfs ra(mo;(0areoxfcta1om   ivs;s0texoxr iu1lm  mict tfaDtaurpnt1tet mfeildls rmumsnt) leoif3oatfmte ueolt0sexr(o nodll e nvsl()arur( ooo4tltoiieiaslm2rmuvs (4 rtnifctydfaDeai ilt0t2urxr oo1al nlnvils s2um( onu4oet iieiad a2rl(mp u0aexnxf iy1oaD liei t trumxr oydal emicils)srtrxrono0tlxomi3tlslmDemu p ()arenmoctatomteauvs ( trtm(r3iydom  mfvta(  rrmur ot4alen ictytfs umnvs;(4 lxrmo oatfmtr uvs;t trxr(m nu1lltnlnvtls  2rm(m oo0tpxomoeiatlm2emn pnu4alerxo3ia1fa  aieo;t0 2xrim3oodomtemici s artaxm oo0ape ioeildfa ranvs;(4trxrmrcoa1fp eanvsl(0 rto(opoo4am e fci sf Dtr(mpou4tlto f3iasfsDemu s;u0altnir oo1omt  neilt trxoir3ou1alenlieta(fsDtr(roou4altomi3iydlmDuan pnu)tltnmf tatoaDr u i;t0trxoir3nu4opte nvs (fsDrrxr nt0tpeniiciyd m rmu s t0 rxrxf3oodla eli ils)teuoxm io4al n fesas)sruau p;t1opxo fetytfmDrl(mo;(4arxnmo3oa1fmDraueol(  etr(o oo4lltn fvi t)a2rmxro;t4ole iiciatfs2rmu s;u)aetoxf ia1fpD luvslt0 2uoxmpiydll elnetas) 2rau ooo1oeen f3iyt m2um(ms;u4trxnxrcia1lpDe ies;( s2um(o3oydomenlicsltf rtr(m ;t0alxn feiydlaDrmu ont0 rtnmo todopDr nvs t)srtr(r no4llt lfetl( arrrump;u4tpeoiictadls2uan s;t0 lxrif to1faDraivs;t s2uoirpoo4om emncslt) 2tm(r ot1aptoif3iytlsDemums t)trtoxf iy1latrli s t0 2tm(m iy1lpee fcsat)arrax  nt4optn ieiatfs rmumon()teeriocoo1fmt  nvs;s s2ur(m oo1lm nmnesa( srtaxr nt1aetnmo3tyd s emn o;t)trtnmrctotfmte uesls0 etoxm oodam  lfctl()aDtrx o;t1openmocilsls ra(msnt0 ltnmf io1faD lneolt  etr(rpoudope mnvtas) Dtrxr no1altnmoetaslm rmu ont0tlxrxf oy1opDe nei () rto(r nodom   ivs ( aDrmxrpot4aexoiieiys m2rm( p t4 rtoxr3oodlateanvs;()srtrxmpno4lmt lictat) 2uaumonu1aeto f3iasfaDum( p (0alenxo3io1lm  livslt0s2xoxm3no4openmfcsa() Drm(m ;o1tpeomi3iytlmDrl(vsnt)trxrxr3oa1oat auei;t  exr(opiu1al nlnvt s)a2rmu  oo1tlx  ieiaslsDem(vp;u0teeoxocia1lpDelnvolt0s2trir io4oltemivi s s2urxronu0ole iocilsfs uan ont)trxomfctotlat ai i;t0 etmxr3ou4ope mneslt  rur(  ;o0olxnif3taslm rm( o;() rermfcoodfm  lneil(  2xr(r3oo1om n nvilt)s2rau  ;t1tleo iciad sDeluvo (4aetrmf to1lp  lieolt seum(m iudlltelncs ( aDra( ont4tee ifcild aDua( p t0aeeoxfcoodfat lies;s)srurim3ny4llt  fcsl()srurx  nt1apen o3iadls emumo u4 reomf ty1optean ils) 2tmxrpiu4alt  fcils)sDur(r ou4alxo o3tytlm em( p u4 rerir iydop rau s;t0trurxm iu4amt mict () rrmumoot1aptomocils s2umuvs t) rxrmf3io1oaDeauvs t)setr(opoudlp e ivs t) Drm( o;u1tet  i3iat m elnvp;()aeenxrciydfpt anvols)t2ur(m3iy1olenmneiat) rta( ooo4tlxomi3ild mDrl(mp () rtoio3oatfate i i (0s2urxr oy4ap n fes sfarra(r ;u1alto o3tlsfa2ranvp;u)aexnir3iotoatelues () exo(m io1omen fctl(  Drrumoot4ope iictldfm rmnvp t) reomr tatoaDeai i s) etmir3iudope lfes t)srumu  ou1aetoifciatls uluvp;t0trxrmr3ta1lpDelu o;s  euo(mpiu4al nlnvslt artrx oot0tpx iieiysfaDem(vs u0aetoxfctodla rau i;s s2xrir iu4apt mfesa(f 2urum ;t1tpxo ieiad aDrau pnt) exoio iodfptr nvi s0trxmxrpio4open ivtl(fartrxm ou1opt mfeiydlaDem(vp u0trermoctydlm raueols)s2xoxr3oy4optnmneias  rumx oot1apxomieils m rm( pn()aeermr oydlmDeli olt0teto(opnydomtnlnvs ( srtaxro;o4altoioeilslmDumn p (4aetoxf3tadopt anes t srxr(o iy4ale livsa()s2ururpoo1tlt iictys mDeluvs t0altnxr tatlmDeau ilt0seumir oydapee fesl() Drmuroot1alt mfctlslm umn p;u0 rtrif3iatoa rlues;() 2xo(o3io1ol e icta(  Dtr(monu1aex mociytls elumpn() eerio iotfp   nvi;()t2tm(r iodlp emict () 2taxrp;o1aet iiciysls2rm(mp;(4 rxnmo iotfaD luvsl(0teto(rpny1lp elicslsf Drrxmp;u4aeeomfcias s2elumonu0 eenif iotfa r n i s)sexmio oy4oltelfet s sDrrx oou0apxo feiad s ranvo (4areoircoy1fpDeln s;() 2uoirpno1amen ictlt) Drru ooo0oeenmictls a2eln pnt) rtrio3iodoaDrlivo;s)truoxr nu4ll nmnvt (faDua( pnu0aetn f3iytlm ra( p;(4 rerif oydfp ean sl( texoxmpno4op nlncsas s2tmxr ot4tet mictytlm2ul(vsnu4 exnxr oy1oa e neol(  2uoxm3nudop  mfvtl(faDtaurpoo4oeenifeiytfs ra( p u4artomo3tydfpDrlneilt)t2tr(o3io1ol n fci ()srtr( ont4oleomociytlm2ua(vo;t4tlxrmfcty1om  aivils) 2toxmpou4amt mfesls)a2urxrpno0open f3iatfs elnvs u0tlxoxf3ty1fp r ivs t  exoxr3iy1lmt  net t)srtr(r ot1tetnmoetytls2rmumpn(0tetnmoctatfatrauvo;s0s2trirpio1lm e ivil(f 2taxr ;t0teeo i3tyd mDua( on() ltomo3iytlpt lnes s0 etrxm3ny1ome  neia( srtmxroot4ape mfeiys sDul(mp;u0trenir3ty1latrauvs ( seur(m3nu4oltemncsa() 2trur ;u4tlxo f3iysls2ra( o;t0 exomrciatfaDeaies t0sexmio nodapte fct (fs2rmur ;o0tlt  ociyslaDelumo t0tetoxrciy1lpDr ueo;s0sruoxo3nodlp   nei t sDum(roou1tpxnmo3ilslaDumn p;t0altrir3todfpD lneo s0 rtmim iu1ame mnei t aDurx  ;u4tlxo oeiltlm2rmnvo u4tltomociotfat luvo ( s2xrimpou4am emfei s srua(mo;u1optnmoeiaslaDean s;()alxnxr iytfp   uei ()t2xoxm3no1llte fvt ( sDtrxmo;u0texoiieiydla2eau p;t0 leoxfcoo1lpt lnvsl( srxoimpoy1ol nmictlt srurxrpnu4aptomo3iatfs em(mo;t4teeoxr tytomDranvs t texr(r ny4olen fvi t  rrm(mpou0aeeomi3iydfs ean p;() etnxo ia1fa e ivi;( sruo(rpnodolee netas)srrm(m ou1olxomi3tysfs umu pn()alxrir totfaDranvo;s0 rxrir oo1apenmfet (fsDtr( pnt0tex  oeiyd s2eanvon(0tlxnif ootlat anei t0 euoio ou1lle  fctls) Dtaxro;t0teen oeiadlaDrlump;u)arenxrcoydopt auei t srurxm io4llt  nvs t s2rrxr ;u1tpxoifetysfm2uanvp u4tetnif tadlptr i sls0t2xoxopnu4lpenmncs (f 2um( o;u1altoifcias m uln p (0teeoif ty1fp  lneols) ruoxr nodlpe mfvta()a2tru pou1alt  oetlslaDea( snu)trxrxf3tatfpteluei t  exmxrpiydlmenmfvsltfs2rmxronu0opx ifctls s umu p;(4 etrmf3to1fatr neils0t2trxo3no4amen iviltfa2rmxm ;u4tle iociydfmDrmu s;t)alerxfcta1fmt aivslt)t2xmxr nydap nlncs tfsDtru  nu0oleo feilsls2eanvp (0tlxrmf tatlm e neo;(0srtm(opoudlme mnesl()s2umumpno0tlxomociyslmDul( p u) rxoircoo1op eai o t0setrimpou1alenlietl( a2trurpot1teto f3iydfm ulu o u4 lxoifcoatfa  auesl()t2xrxo3iy1amtnmicslsfarur(mp;u1tee mi3tyslm elnvp;u0 eeomfciatopDeliei t0t2umir3ny1am  lictlt sDumumpnt0aetomo3iasls eanms;(4alenmocoy1fmD lnesl()t2tmirpio4lltn iet sf Dur( ono1tpenmieiatla2rau s;(4altrmfciadopt li i;s trtr(r ou4lmenlneta(farraxm ot0aptn icias a ua(mpn() leoxf3oy1fpDrlivi t srumxr ny1apeemivt sfartaum no4aet mfeildfs ra(vs;t4trxnxf3oy1lm  aieo t trxr(opou4ap n nvtltfs2taum nu4oex  fcils a2uauvs t0aeenxo iotfpDe u i t0 exr(opnu4optnmies t)s2tm( p;u4tlx  o3tldfm eauvp () rxoio3totoaDrln i;() ruoxo3oydamt lfctasfsDrr(  ;t1tltoiociltfmDrauvo u0 rermr ta1lm rai i;(  etrio iu1ap  liet s aDtmxm nt0apx  octldls rlnvonu) ltomr3tatlmDr u o s)t2uo(m3iy1omtemfvi t aDurxmpnt0oetomocild a em(msnu0arxrxf oydlmt lnes;t texrxo3io4opt mietat) Dtmur no0tltomfeilsfs2ul( o;u4tetrmfcoy1lmDr ivils0s2umxmpny4omte nvi s)s2uru  ot1aleoiictlt a eaumpn(4trerir oytlm rlnvs t0texmirpoo4lm nlneilt) rum(moot0altnmieildfs2em(mont) leomf3to1omt ai o;s)teurxm nydal  mfvi t a2tmum nu4tle  i3iydlsDrluvo u0 rxnirctytlpD  nei ()srxoir3oydape lieia() ruaum ot0tleo fetld aDelnvpnu0tltrio3tatfateluvo t  2xm(m ny1omt mfesas srtmur ;u0tle  o3iasfa2ua( p;t0 rxrir oytlaDr nvo (0seumxm3iy1olt  nvi sfaDuaxm nt0tptoiieiadla uanmp;(4 ltnifciadom r neol() 2tm(o3ou4al nlfet t)sDraumonu0aee  fciysfs eluvsnt4 ltrxr3oo1latrli sls t2toxo3oudlpeemict t) Duaxm ;o4apen feiyt s2el( s;(4 exomfcto1lptrlu i;s srxmio3ou1apeemnesa(f Dtr(mono1tpxn fciatfs umuvon(0artnir3todlm e ieo s0srur(m ou1optnmfeils s2tau  nu4tet ioeiydls emn sn(0 rerxf3iotoptrlivs s)tetr(r ou1aptnmicils sDrmu pnt0apxniociltfs ra(mpnt0aexnif3tytom e u il(0t2xmir oo4apte fcil( srumxr ou1tltnmo3iltfmDrl(vo (0trtoxf3iydlptr nei;(0t2xoim io1ome mnctls  Dtm( pnu0tlt miciltls elu s ()arerif3iodfmteaivo;t)sruo(m3no1ol elieslsfarta( ono1tpxnii3tyt m2ua( pnu)aetriocootlp  livs s)trur(o iudal   ivsls aDururo;u0tle mi3iydfs2rmnms;t0tetrir3to1lmt  ueils) 2urxm3iodamtelncil(f Duau o;t0aee if3tys s ra( snu4aetrio oytfa   nvi t t2to(o3oy1amtemfetas arrru  nu4alx  ictys m umnmp t0 etoxf oy1opDean il( teuo(rpoo4lltelnetltfsrtm( p;o1ope  iciltlaDrl( pnu)trxrxf3iadom eanvols)tetmim no1amen neslt)s2rmxmpnt1alx mo3iadls2rln o (4aeeoir oatlptelieo;(0trxoxm3oy1ll   fcsl(f Dtrx  nt1aee  ietlt m umump;u) exnmr iodlpteanes;s0s2toio3oudlm   ivias s2taxm ;o4olt ii3tysfmDem(monu) rxnxf3iotomtr ivi t)seuoxm oodlleeliciasfs2rmxrp;o1aptomietltla2rl(mo (0tltrxrcoadomDr ues (0trxm(m3iu1op e iei tfs2rm( poo0apx  iciasfaDeauvo t4alxnioctydfmD lu i;() 2urir iodapte ivs s) Dumu  ou4texo f3ilt sDuluvsnu)tltoxocoy1om rlnvo ()trxoxo3ou4altn netltfs2rrumo;u4teto f3iat sDean snt4areomrcty1fa eluvslt0s2uoxm3oy4llte nei ( a2rmur ou0alt mi3iat a2ra(ms;u0artrxfcto1fp e ivs;t)srxmir oo4al  lfcilt  Draumonu0ope mo3tydlmDrl( s;(0aexnmo3oodoaDeauesls0s2xoxr oudlmtn nvi s)sDuaxmont1aet  fcildla uauvp u4 lenxrctotlmDr nvsls)s2um(o3oodapte ivsls a2taur ou1ape mfctad mDel( pn(4 rtnxfctytlmDrluei t0setoiopoydlpt  ncsat  2urumpno4aexniieild m2rau o;t)trenxr3oatfp  auvil(0 2tm(mpny1lme  ictasfs2umum ;u1tet if3iysfa ulnvpnt)arenir3ia1omteauesl() eumxm3iydapenliei (  Dtr(  ot4alxoifeiat aDranvsn() lermfcootomDrlieo;(0 euoimpny1ape  neiat) rtax  nt4aeenmfeiydfmDul(msnt)tlxoxf oy1fm rlivo ()srumiopio4llee ivi s aDtaxrp;t0tle mociydla rauvpnt0trxoioctadop  ln i;(0 2umxr iy1lp e ici (  2rrxr ou0aetnif3ild mDran s;(0 lenxo iotlateaueo;s s2to(o3ou4ale lfcsa(  2taxmpnu4oltniiciatls uau ont4tlxnmo3iotlp rln i (  etmim nudam e ieil(f Drr(  no1aeenioetytls2emu p;t4alxoxr3todop rlues ()sexrxopou1openmivtlsfsrum(  nt0alxnif3tat s rlnmpn() lermf ta1op r uvo;t sruoir3no4om  lnetlsfa2raxm ou1aetnifetls a2eluvpnt4 ltrirciatlaDrlu i t)trumxmpiudaltnlfct t)s2tm(mp;t1aetnmociad a2ea(mo u4alxrmr3ia1oa e nvi ( s2xo(mpoo1opee fvslt sDtaumpot4tee mfeiys s emn pnt)altnmrctadomDe neo s setr(o oodape  net s)srum(r nt4tetn o3iysfaDrlnvo;u0areoxoctodop eanvs;s s2xr(mpnudal   fvtls artr(moou1aetnmfciytfsDea( o (4aexoir3ta1op eau s;t  etrirpny4om  mnviat sDtrx  ;o4optnmfeiadfaDeluvsnt4tltomr oy1omDrlneils)trxo(o3oy4ope lncslsfarrr( oou0tpxniietaslm2rluvp;t0 exomrcoadom  lnvols0 eumxrpoy4omtemfvilsfs2tau o;u0ape  o3iydfsDeauvo u)aetrmo3oydfaDrlivs (0s2ur(o nu4lmenliesa(f Dtmxmp;t0opxo fciltlmDrlu on(4altrmo3oydom  ln ils0truoir3iy4om  micta( artrxrp;u0ape mieiyd m2rmuvp u0tltomocoo1lm rlueols0sexoxm3ou1ome  nesls) Dta(r ;t1alxnmoeiytfm2ua(vp u)texnxociodoat  u i;()setrir3iudome  ivil( aDtaurpnt1apx moctadfa2umu o t4altoir3oa1fmtrln slt srtoim3iodaleeliei ()srrr(ro;t4tlx iociys mDumumsnu)tleoif3totomtr ieo;t0sexrir3iu4om nmneils  2tr( o;t0alxn f3tlt s rm(mp;t4altrif to1optraueo;t0teuoio3iu4optelfvia(  Drrumonu4oet if3iadfsDelump;t0artoif3tatoa   i s;()srumxmpnu4ol  mfcsasfsDum(rooo1olt  fciydlm eaumo t4aetrmfcoydla  aieil(0 rtriopiodal nmivia(  rtrxrpno0aptn ieiydfmDumn p;t0arxoxocoo1opte uesls)s2urim3no4ame  fci ( sDrrx pno0alx  fciaslm ean pnu0tlenmr3iydla   uvo;s srtoio oydam emneiat)s2rr(r oo1tet iieils sDrauvs u)altnmo tatlmtrlneo s)sexmxm3oy4apee nvsatfa2urx poo4ole  ieiyd aDuanvpnu) eenifctotfp rauvo;s trxmio3nu1ale mivia(  2tm(rp;t4oet mi3iltfaDrlnmsnu) rtrmfctotla eauvi s0srtmxo oodlmt lnei (fa2tax poo4tpto oeiad m2uanmpn(0aetrxocoy1om rai i s s2tmxopnudole  neil( aDtru  nu4aexniociysfa rlumonu) reoio3oodfmDrli il(  rxmimpio1lltn nes t)aDuaxrpnu1openmo3tys aDel(vsnt0tleoif oodfp eanvil() rxrim3ou4om emnvsls arrmxmooo1apx mfctyt m uan o;u0 ltrxr iotopt liei;()s2uo(rpoydamt  fcsasfarua(mpot1tlxn feiysfmDelnvont4 leoxo iytlaD livi ( s2um(o3iydalt lieiasf rum(r ;u4oeeo feiatla um( sn(0tltnxf tydfpDran o;(0 exoxo3no1ame  fctlt aDrrumpou4al
\ No newline at end of file
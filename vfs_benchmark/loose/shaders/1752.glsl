@@ -0,0 +1 @@
+u ils) rxo(r3nydap e ivsl(fsDtmu  ot4teeoiicild s rauvpnu)artnxf3oa1lm  li ilt setrir3iu1om elivsat s2rrxm oo4oex mf3iytlm2rmu onu4 eenifciytopt aneilt srxo(r ou1opee feil(f 2ur(r ;u0tpxomfciysfm ranmonu4trtnmf3oy1faDr nvolt  exoio ou1optn nvil()s2ra(  nt0oeeoioeiltlm rmnmsnu0tltrircty1faDeaueolt s2xo(rpnodam  lnvta()aDra(m oo4oexnio3iyt s2ran pn(0 rxoxfctodopDr iei (0texrir iu4apt lfvt (  Draxm nt0tptnmieiatla2uanmp;(4areoiociatfaDrlivs s trxo(rpnu1lp  lncs ( a2ta(r ot1apx mo3tadfsDrmn pn()teermr io1lpD  ies s setmimpiy4amtnlfvslsfarumu pnt0apenmo3iysfaDeanvs u0 rxnmo3iadlpDelnvo (0srumxopiu4apenmncsl()srum(m nu1tee  ociasfa um(mo;u)teenxf ta1lpD lieilt)tetoxm nu1omtnmfvilt)sDrrx p;t0tlto ietltls ulu o;t4 eenmf3totfm e uvi ( srxo(mpnu1ape lfvi sfaDumu  nu4oltnmo3ilslsDem( s;t)artoif iydomD aneols trur(o3io4lp emfvia( s2truronu4tpt iociytlmDuanvp;t0alxnio3oo1om   nei t)tetoio3io1omte ieilsfa2tax  ;o0oltomoetldfm rmnvp;t) exoif oadomt auvsls setr(r3iu1ll  mict tf Dum(r ou0teeoio3iadls2rlumpnu)tltomo3tydfptrlueolt)tetm(opoy1ll n fvtl( s2ua( poo1tlxoii3iat s emnvpnu)tetnmrciydop   n slt  2tmxm nodomtelfetl(f Dtrxmo;u1oexo octaslm em( s;(0 etoxr totoate uei;s) rxoio3oudolenmnvta()a2uauro;t4opxomo3tyt s2em(vsn(0altrxo to1fmt auvo;s seum(r ou4alt mncias artrurpou0aetn i3tydlmDra(ms u4 etoxr io1fp ranes t  euoirpio1opt lfvil(fsDrrx  ot4tlxn i3iytfs2ean s;t4texrxfcio1opt lnei;s t2umim3ny4olee ict () rumxmp;o0alxnioetysfa2rlnmsnu0treoir ootoaD livo;s seurxr3ny4al emnei sfs2taump;u0alt  oeiltlmDeanmp;(4texnxrcia1lateluei t0sruo(r io4om elnet sfs2tau oou4alto fctaslm2ea( o;u4arenmocoydfpt ai o s  2trxr3oo4llte neiat sDtrxmo;o0tee iicild s eluvs;u)altnxo3todoptrluvo t)tetrir oy1amtn fcsasfs2ua(r ot0oet if3tlt m ra(vs u)teeoxr oatla r nvs (  2to(m io4lptnlfci sfs2ur(m nt0aee  ieiadfm2ul(mpn(4 etrxf3oo1fa   ues;s)trurim oodlmt mnvs sfa2urxm nu0tetn ociad a2ea( s () rtomo oadoatelieols t2xrir iudalen icsl()sDumx ont0olt iieilt s2rmnvs;t) leomr3oo1fpD  uvs;() 2urirpoo4al  licsa(f Duax  ot0tpen fetytfsDranms t) lxrxf io1fpt au s;t0s2umim3iu4apenmfvs t sDua(r oo4oetnio3iyd mDran o t0 exrio3tytoa  luvils seumxm io4lpt lnct () 2rru pno1apt mo3iad sDran s;t4 lxrmo3tytfm   nei t)t2ur(m no1alenliei (fsruru  oo1alxniiciytlmDulnmsn(4 etomf3oadfa  lnes;s0 eumxr ou1oltemicta(fsruru ono0aex  icils m2ua(msn() exoxo3oo1la eluvo;()seuoio nu1ape livil(fs2tax  nt1tpe moeiltlm umu s u4trxnmr3iotomtr uvil(0setr(m no1optn fet s artm(rpoo4olen fetltls2em(vs;t)areniocoy1lpt  n slt sexr(r ny1ope mieiasfarumuro;o0optnmf3iytla2eau p (4aetrif tydopteanvo s) rtmxmpio1lm emnetasfa2tax pnu0altn fetld sDea(vp;u0tlermf todlmtrli ols0truo(r oudol nmnct t)s2ur(  ;o0oleniicias aDrlnmont) exrmo3oodom r ueo;s  rxr(r3oodlle mivias)a2ua(r nu0olt iieilsfaDuln s (0artnxf3oydom r ivsls trtmxmpiudaltnlnesltfs2taurp;t0teto fetldfaDrl(vo u)tlenif oodopDeaivilt  2xr(rpiudlpee fctatfaruau  no1optoifciytlmDel(vo;u4 rxrmo oydoaD aivils0texoio3iydamtnmnetat) Duaxm no4oee iietadfs emnmpnu0tetnmf tatlpt au o t0 eumxo oo4ll nlfvias artax  nt1alxomoctld mDuanvs;u4 lxoir iy1lpte i s;s)srxo(rpou4om nmnvtasf ruaurpoo1aptnmoetad a2ranvo;(4trenif tadfaDe ivi;t)srurir3nu4alen icil(f rraur oo1opxn feiadfaDranmp u4aexnir3oo1op e iei (0seum(rpnu1ll n nesat  2ta(ro;o1ole  feiytls2emuvs;t4alxomf3oodoa eaneils) 2xrim nu4om elietltf rtrxm ;t4tlen fetysfs2ranmp t) rtrmf3oytopD aieslt)trxo(m ny1olt  nes ()a2raxrp;t1tpeo f3iyt a ul(mo;t4tleoxo3oodlpDeluei s0sruo(r iodol   nvtlt aDta(mp;u1apeoifeiatfm2emuvp u)trtnmo tatfaDeauvo s0trtmxo nu1olee ivsl( a2umu pnt0tpx iociatlm2ulu s u)teenif3ty1oatrlnvols)t2xoxo iy1lmeelnvtat  Dumx pot4tet moetysfmDraumsnt0 ltnmr3iy1opDranesls) rtrxr iudole  ncils) rtaxro;o1aetnifeiatfs rmn p u)tlxrmo3tytlmtrln ils0seur(r3nu4altelfvt ( sruauront1teeo o3iasfaDel(vonu4 rtoif iatfateluvsls)s2xrxr nu4aptnmnet s aDuaxrpno1optomo3iydlm2emuvon(0aetnio iotlp elies t0t2xmxm iy4lme lfvtl( sDraxmont0opt iicild aDrlnms ()arenmf totlmD luvsls0trtrimpoy1om elncias) rraurooo1tpe mociyd m uauvp ()artomfcoydla rlu s s0s2toir3nodolt  nei t) 2uaur nt4oexnmiciaslm2ua(msnt0 etomr iytfmt  u i t0setmxo3ny1ll  mfeiasf Drrxr ;o4opxnmfeiys a rlu s;u) lxnmo3oytlmtean s ()t2xm(o3iydlle mfvi () Dta(r ;u4tee  ietydfa el(ms u0 rerxr totoa elu o;t0 2trim iu1lpeelietlsfartmxrpnt0olenioctytlm2eanmsn()arxnif oytfateai ol( teuo(o3iy4altnmnesas srtmu  ;t0opeo oeiytlsDrlu p;u) ltnxr oa1omt  u slt trur(rpiu1al emnci s  rtaurono4aptn ictadlsDuanmo () exrxrciotlateauvo (0setmxo oydol nlfcia( aDur(ro;u1tetoif3iyd aDean p;u) etnmr3ta1opDeanvo (0seumio3oo4ale  iviat  Durx  ;t0aetniiciad m ra(mo;(4tetrir iodfate u il( srtrxo3oudol elieils artr( p;t1teeoif3taslmDum( p;(4tltnmr totlpD  uvi;(0trumxo oydopeemfviasfaDuru o;o4alt  i3iltfa emump (4tleoxocoy1omD auvi t  rumxmpou4lltn ivt ()arua( ooo0tpeo feilsfa2ean p;u) ltnmf3oa1fp  aies;( setriopou4olee nctl(fsrtaxmpno4tpenmfctlsls2rmu s;t0alxomf ta1omDe uvilt  2xmir iu4llenlies ( a2ur(mo;t4oleo oetldfm elnms;u) rermocoo1laDr u il( srtmirpny4lle mnetls)a2rr(mpnt0apxoiieiytfa ranmp u4altoxo oo1fmteluvo t  ruoir io1amenlneia(fs2uru  nu4opxoii3tld s2rmn p u0artoxr oatlp r i s;(0seuoio oo1opee feil()a2ua(r ou4oeen i3iat m emums u4artnxfciotfp  aivils)tetr(r3iodomen fvil( s2ur(moou1ole  ietldfs emuvsnt0trtomo todom r uvi;(0 ruoxm io4ame mnviat)aDua(r ot1oleo oeiyt a2rlnvo;t4 rxrifciy1oatranvs s) euo(r3oy1am nlfetatf 2ta(ronu4altoifciytlaDua(mpnu0arxoxr ia1op  lieils0seurxr3oo1ap n fetls arua(mp;u0olen ieiatla rln s;(0 rxnifciy1omteau slt srtr(rpnodapenlfvtlsf Dtrxr oo1tltomoeiadfa2rau s;t0alenio3oa1lp e u i t0 etoim3iodlme livia( aDum( ont4tee mf3iltfsDulu pnt0 ltrxocoadfpDeaieilt0trtoir iy4omt lfvslt  rtrxmooo1tex if3iydfsDulumpnu)texomfcoatfa  aivi t) rum(o3iodamt lfcs ()s2umu pou4alx  ieilsfm rmu pnt)trermr ty1lmD ai il()sexmir oydamtnmict (fa2tmu onu4olxo oeiatfm ul( ont0 lenio3todfa e uesl( trtmim3iy4lleemfcia(f 2trur ;t4tlenif3iatlmDua(vo t)tlenmo iotlpteau s;s0sruoimpio4lpt mici t sruax oou4aetnifciytlmDum( o;t) rtnmociodlmt lu slt)t2tm(opiu4ome lfei t) rrmum oo0tlxnmietyt mDuaump;() rtrirctotoa e ues;t  2uoxmpno4omt mnvias) rrrurpot4tlxo feiadlm rmuvp;t0tlenio3oydopDeluvo t  etmimpiydap elieilt)artaxr ;o1aee mfeiadfmDeauvon(0texrxrcta1fat aivolt) 2xmir oudlm e nvta(  2rm(mpnu0aexoifeiasfsDuauvp u4 lxrmrcto1lmDr ivs;t) rxr(o3iydlleelicia(fa2taxr ou4tlxn o3tydfs ua(mpnt0 exrxo iy1fp elnes;()trxo(opno1al  mict () rtrxroot4altnmiciltfsDrl(mo u0arxnir oo1omDr n s;s  exo(r oudol emietlsf rraxm no0apeoiicildlm uln p;u0aeenxfcoy1fa eln i ()t2xmxr nudop   nesasf Dta( o;t0oltnii3ild a uauvo u4 lxnioctydomtrliei t)s2uoxrpoydlpt  neia() Dur(ro;t4tee if3tysla eln s;u)tlxomf3iydlatelu o s s2xoxo3oo4lpt  ietls) 2um(m oo4tlt mfetydfm2eau s t0altnir3ootoat au ils0 exoxopno1aleelicils a2umu  ou0aeeomictad s umu pnu0 lenif3io1lp  au i () eumir3iydal   fes t srumum ot1oexniicias aDumuvs t0aexnif3tadlaDraies;(0trto(opiy4lptemnesas)sDraxmo;u0opx  ieiys aDrlnms;(4texrxo3iy1fmt aueo;s  rxrxopnydol  mfesas  2uaur ;o1tpt  feiaslm2ea(vp;u0aexoxfctytoaDr i s;t) rxrxmpno1ol emfvs s srumxmpno0tpeomoetyt a2eln o (0 lenmo tatop eauei (0setrxrpny4opeemfesa(fsDtmur ;u0opxo octys a2um(mp;u0arxomr oytlpt  nvi;(  2xmio nu1ope mnvia() 2umx p;o0tlx moeiydlm elnvp (4aexrirciodfatrlivils) 2xoiopio1omeemfeta(  Dumu pno1oex iieiltlmDeluvo;u4teenio3oytomDrlnei t) 2toio oo1opt  netl( a2ua(  no1apxn f3tyt sDumu s;u4artnio3oydlp rli i s0 rxm(o3ou4ol   ivta(  rraxr oo4tpe  ocias s2uan s (0aeeoio3ta1lat luvsl( srtmim iu4al n fesatf 2tmxm no4optomo3tyt a2uan pn(4trerifctytfa r uvo;( teur(opiy1ame  nct t sDumum ou1aptnmfciyt a uaums;(4 leoxocoadom  aieol() 2umxopno1alee fcias  rtauront0tptoifetldlsDuauvs;(0artrifcty1omDean il(0srxoxr iudameelivi s)s2raum nu1tptnio3tys s2ranmsn(0aexrir ootlat  u i;(0t2umio nydape  nctlsfsDtr(  ot1apxo o3tadfsDulu snt4altomr tatfateaivo s) 2xoio nudapt  fctls  2um(mo;o1apt mf3tatls elu snu)arenmrctytfmD lnei t  etmxm3nudop emict (fsrtaxmpot1alxnifetydfaDrmnmp (4treomocoydfm  ai sls) rumir iy1amte fesls s2rrxm nu4ole  feilslm2emnvs;t4tlxoirctotlmD  iei s  exoimpnu1lmen ici (farta(rpnt4apen o3ilt s el( s t) reoxf3tadop rlivo s0 rxr(r iu4apt  nci sfaDurx  ou0tlxo f3iytfaDumums ()aexnmf3io1lp elues t)seuoxm3iudale mnei t)aDuax oot1alxnmf3iyslm2rauvp;u4trenmr3tydoat an i t0 2xmio ny1lpeelfeilt aDua( poo0tetomi3iyd a emums u) etrircoadlpDr nvils srxm(r3ny4ope mncsat)sDrrumono0apeoioeilsfs2emnmsnu0 rtnif oytfa elivslt0 eto(rpnu1om nmivtas) 2ua(m ;t4oleomo3ils aDuaumo;u4artoif oo1op eanei;(  2trir3nu1apt  fesls) 2umur ;u4tex iieiltlsDrln p ()texrmo tadop e u i;s0 rumim3nu1lp  lncsls arumu  ;o4oet iociys a uaumsnu4 rtoxfciy1fpDrln s;( t2tmxmpoydlmeelict s)a2trxr ;o0aetnmfciyd s2ua( on()tlxnmo totlm eaueo;t0setrxm iy1ap  mfet t  2trx  ou1apeomictatfs umu s;u4teeriocootfaDelueils s2xoxmpiy1al  mncsl(f 2ua(  nt0aptnmfciyt a emu snu)artomf3tadlp rliei;()t2umxr3no1ope mfcilsf 2umu ont1aetomfetldfa rl(mpn(4treomf3totlatraieo (0t2uo(mpiydale  nct ()aDtaumpnt0olt  ociltfm ranmont0tetrmoctadlpt au i ()trtrxmpnu1llen ici tf rraxr oo4alenmfctad a2umnvo;u) rtnmfcoytlate ivsl( setoir nodole  fctas)s2rauro;o0oexnmfetlsfs ea( p;(0altnio3oydlptrai o;(0 2to(m io4apt  net t a2raxro;u0ole mfcils sDean s ()altnir3totfm  auvi (0 2xmiopoo4apenlieslt  Dtmx poo1opxn fetldfsDrl( p;u0tlermr ia1fa elnvs t0 ruo(m iy4lpt lfcsl(  Dtrxr no0apxomicildlm rmn ont0tlenmo3oy1lmt  nei;s)t2uoxm oodll   fvslt s2rmur ;u4oexomfeiad aDuluvp;t0 ltnmr oydfpDeaneolt) rtmxrpou4lpen fet tfs2tmx ont4tptomi3iytls ul( p t4arxoxocoodlp elu sl(  ruo(mpno1lle  nvs (f Durur ot0aexo oeildla2uau s;u)tleomr ia1fa r nvilt teurxrpou1alt liet ( sDtr(  ot4tptoiieiatfmDulumo t0 rtniocoo1la   n ils texmxmpoy1amtnmnvilt arrmxmpot4aet  f3iysfmDrlu s u4 exoio oydop rln i s0 euoio3nydameemici s s2umu ooo1oet  o3tadlsDrmn o;u4alxrmfcoa1la e u o s)teuo(rpio4ome lnci ( sDrau oou4olt ii3tys a el(mp;t4aeermrcootfat livil() 2toim3iu4amtelfcslt arrrur nt0aeeoii3tltfa umuvp (0artrmo3tatfat  ivo;t texr(m oydlleemfcs sf ruaxmonu1tpeniictls m ran o;(4 eeoxfcoadfm  anvi;s0 rxmir oy1al e icsa(  rrau  ou1oeeomf3iadfm2emnvs t0teeoir oo1lpDrlneilt0 eumiopiodap emics ( s2uaxr ot4tet  f3tasfsDulums (4trtrmf iotfmtr uvs ( trtrxo oo4omenlfcsls)srrm(ro;u4apen f3tysfa2rmumon(4trenxr totlpDeaneo (  rtm(m ou4ap   ieiat)sDrmur no0aexniicils m2em( sn(4areomo3tatoatrln s (  euoxrpoo1opeemfvslt artm( ont4optomoetls a ul(mp (4aexomo3oadlp e nei t0 rum(r oo4apee fvt s  rrax onu1apxn iciyd s el( on()aeerio3ta1opt  ies (0 rtoiopiudol emivi (faDuau poo1opto oetadlsDra(mo u)arxoxfcoatla  li sls0 2tr(rpno4omee ivt s)aDur(rp;t1tpt  ieildls2uanvsnu4 eermr3io1fmDraivsls0trtmxmpnu4om  mnciltfa2rmump;o4tlxomocilt aDea(mpn(4alxoxrciadla elnvo ( seumxm iy1ome lfvias  rrrum oo1olxnmfeiydla2emu s t)aeeomo3totfm e i i s0 2trxmpiu1ol nlfcsat  Drauroot0tlto ociyt a2ra( pnu)trenxo totoptranei;t setmio iu4lmt mnci t sDtmx ont0aeenii3iyt a2em(msn()arerir3oytfaDelueol(0seum(rpoudlmtn fcias)s2taxmpou0altnmoeilt m2ranmsnt4trxrir iadfp ranvo;()s2uoimpnudop emfesasf 2rmx oot4oetomieildfs el(mpn() rtomo3ta1fa e n ils s2um(m ou4alt  fetlt) Durumpoo0ole  feilt aDum(mo;u4texoiocoy1faDr ivo t)srxr(r3iu1opt lncs t  Drm(rp;t4alt io3tlsls ulumo t)aexoifctytoptran ilt)tetm(o nu1opt miei s  Duaur ot1tptniociad a rluvsnu)tltrio oy1op  ai sls setoir3io1altnlnvs s arurxr ot0apxomfetld s rln pnt0trenio3oydom e uvi s0sruo(rpno4oltelfvt t aDur( oot1oee mi3tatlsDelnvpnt)aetrmfciy1lp  lnvi t0 2uo(o iydamt lfeils  2rmuronu1oetn oeiat mDeauvs;t) rxoio ootlpt  n ils)sexmimpny1lp elfesl(fa2umurpot4oeeoioeild sDra(mo;u4 etoxr oadlptran o (0srxr(m oy4alt lnes t)arumx pnt4olen fetys aDrluvo t0 rxrmoctatopDe nvilt) rurir3iu4lmt miciat)aDra(r ot4tle  fetadfa2ulnvo;t)aleomf ty1laD  n ols0srumxm nu1amenlnvslt)aruax onu4oee ii3tadla elnmo;(4 rxoxf3oodfm elnes s  ruoir3iu4altemietl( s2raxmooo0aexomo3tydfs2ulu s;u) lenio iy1lmDraiei;(  rxrxo oodol n ivs () rtrx ono4oltnif3iytfm2elu o u) ltnir3oo1lpte n i s)seuoxrpiy1amtnmicsl() Dumxmo;t0altniieiytfaDemnms;t)alenmf3iodfp rauesls0 rtoxr iudopte ies s)sruaump;o4alen fciasfm eluvo u4alxnxocoodop   i ols setmxo oy4lme  neil(fsrtm( pno1tltoioetytla eanmpn(0arenmf oatopt  u i;s0trur(m3oy1lmtelivt t) rta(  nt4teenifeiyd mDem(vsn()teermr to1lpDrli i;(0texoim no1oleemnvias) Dururpou0tpx mfetatfa2umuvsnt4altnirctytoatr neo s t2tmxo nydopee netlt sDtmxmo;o1tpeomfeiys s2rmnmp;t) lxriociodop elivolt  2uo(m3iu1om  lnvi s aDtrxr ot4tlxomictlt m2ran ont4artoioctytlaDeaies s)trtoxo ou4altn fcslt) 2rr(mp;u4apt io3tldlaDumnmpnt0arxoxr3totlm e i s s  rtmio3iy1lpt  fvt t srrr(rp;u0oleoifcildfmDeau o;u4aetnxf io1op e u sl(0 rtm(rpoy4lm nlics t)s2uru onu1oltn octysla rm(vp;u)alxrxf tydfptelieo s0teuoxmpiodom e ncias) Dtaum ;u1tetomictys s2raumsnt4tltoio3io1lmtrlu ols teumxo3iu4om nlncils)arumxmp;t1tlxnmfciysla rm(mp;(0 ltnirciy1lmteli ols0s2xoio3oodalte nvi (fs2urxmpnu1opxo o3tyslm2eau on(0trxrirctotlm e nvi;t setoxm nodllt liet s s2rr(rpoo4altomf3iltfaDea(vo;u0artnio3oa1oaD  ivi s  eumio iu4oltn ivtasfa2tau ono0optnmfetas aDea(mpnt)tetnif iotla  ln s s)texrxo iy1ap emfcs tf rrrxrp;t1tlenifeiyd sDel(ms t0 exrircty1fa  lnvsl()teur(rpoydlmtemnci tfs2rruroot4tlxo o3tldla rluvon()alxnif oydomteauei;(0sexm(r3iy4ole mncil( srtr(rooo0oleo feilt s2ulnvp t0altrmrcoodlaDraivo s0s2xrxmpiy4lptn nvtas)aDta(  nt1tle miciysfm ua(mp u0areomr3tatlm r u o;s t2xrxrpoo1am nlfcs ( artrxrpou0aetnmicilt s2emuvs;u)aetrxo3oatomt aieils trxoir ou4altelncs tfsDrmx oou1tlenioeiadfmDeau s;u0trtnir to1opDrlu o;s)truo(m iydomee icil( s2uax  ou4openiocilt a umuvonu0texnio oatfmtr ivs;()teuo(m3oodlp e nctl( artm(ront4optomf3iyt aDuanvo (4trxrxocootoa   i s (  rxr(opny1aptnmncta( s2tmxrpnt0aee  iciys m um( p;t0 exrxo todlaD  i o;t) 2uo(r ny4alt mnei s)a2tax  oo0teto f3ils m2raumo t0tltrioctotom rli ilt  eur(m iy1ale lnvi s aDuaxmpot4tltomo3iys mDrmumo;u0 rxrxfciatomDe uvsls0t2xmxmpiy1ap   neta(f 2rm( o;u4tlen octaslmDum(vpnu) eenif to1lp r uvo t)srtmio3iy1ome lfvt ()s2rmxronu0tpx mieiltfs2emnvpnt) rxnmr tatfaD aiesl(0t2xr(r3iodop n nvtatfsrrmu  ot0alt mfciytls eanvs ()alxnirciytfpD auei;()t2umio ou4ll nlicias)s2ta(r ;u0tptoii3iytls em(vonu0 lxoio3iadlmt aues;() rxrim ny1altemiei s)s2taxrpou1tltnifetydlmDuanvs;t4texrio oa1latrluei s)truoim oy1lmt mnviatf 2uru  no1teeoiieias aDranvs u4 eenio oydfaDeanvi ( sexo(m3oydllee nvi (  2urxro;u4tltomiciys m rau p t0trxnircia1late nesls0 rxr(opny4ole mieil(fsrtmu  ;o0opto ieiadla rmnvp;t)texnmr3ta1fatelivo;s)teum(r nu1llteliesls a2taxrooo4texnmoeiadfm ra(vo (0tlxrxf3ta1la eaiei s sexoxopoo4lme lnetlt)a2rrumo;o4ole mieiltla2ran ont0 exnxr3iatlp elueslt0t2urir io1lpeelnvta(fsrtru  nu4tlenmi3ildlm ua(vo;u4 ltnmr3ia1fp r uvo;(0s2tmxm3iodol nmfcia(fsDtrx  ;o1opt  f3iyt a rauvp u0teerxo oytlatelies;( trxoxopnydomtnlfeilt srtrurono4teenmoeiatfsDra( p t)texomf oydlpD auvi (0texo(m oudaltnmics sf rrrumpnu0opt ii3ias s2um( sn()tltrxrciadlp eauei s  ruoxopiu1amenlics (farumur ot4tex ii3tls m2ua(mpnt0altoxr3oy1fpDe ieo ()trum(o3io4opeelfcslsf rur(rpou4apeomfeiys s ranvs u4trerxr3iytoptran ols0 etmimpoo1ap elnetasfaDuaxr oo0opxn ictltls elnms u)alxoif iydfm eluvo s)truoxr3iy1oltnmfvslt)sDrrx pnt1tlt ioeiasla umu onu0aexrxo3iotomDelivsl( t2to(rpny1am  lfeiat  rtmumono0tpenio3tatlsDra(mpnt0alxrir3tydlmtrliei ()teur(mpno4lpte iesls sDrru poo0tptomieiyslm ul(vp;()areoir iotoat lu o s)trxmxrpnodomee ncsl(fsrtau poo1teenmfeiatla2emn p ()teenircty1oatelivs;s s2urim iydop   nctasf Dtr(m ot1aetnmi3tydla2umnvo;u0 reoir3ootlat aivsl()tetr(m3nudol nmnvilt aDta(r nu0apxomictadfm2eln pn(0alerio3tadlptrlneolt) eumxm iodlp n iet s a2uaump;u1oeto feild s2uanmsn(0teermfctytlmteauei;t  euoir ou1lpen neta( a2rru  ot0apt  fetlsls rl(mon(4tlerifcio1lm elivi s)seumxo3iy1omen icta(fa2uru ont0teeo i3iyt a uau o (4 etnmf iatfmtranvi;t0t2tmxo ou4ame  ieta( s2ururoot0alxoifetldls rm(vo u0tetrio3tydlpteaues;()s2uoxo nodaleelnet t a2raxrpoo4alxn oeiyt mDeauvsn(0 rtnmo3iodlat lnvi s)srxmio3nu1lpenmfcia(fs2ua(mpou4oee  o3ils m2uanmp (4 rtnmocoatlpD liei t0t2uoxo nydllen nct s  rtmxmpot0aeeomietat aDumnms;t0aetrif3ootoa eaiei t seuriopiy4opeemiviatfs2umurp;o1opt  o3tytfa uanmsnu0 ltoxfciy1fpDr nes;( s2urxopoy1optn fetatfaDtaxrpnt4tpxn oeiasfmDuan snt0tlxrifcoytlmtraueol() 2trxo3no4lm  liciasf Dum(  oo0olxnif3iytfa2rlnvo;u4trenifctydfmDelnvols s2tm(mpio1lpenlnviat aDum( p;o4apx mo3iasfs2ua( on(4tlxnxr3iydfa  aues;s)s2urxr3oudll  micslt  2um(m ;t0apt  i3ildlm uaumo u0 lxrxr3oadlptr i s;( trumxrpoy4lp  mfetltfsDtax  ot0olx iieilsfs2ua(vpnu0tltoif oodoatelues t) exo(opnudlmenmneil(fsrtmx o;t4aet mf3iadlaDemuvsn(0arenxr3iadlat  nes;t)texmim iudolte iesa() rtmxr nt0apen oetytfm rau s;t)aexrxr oy1optraues;s texr(o3oo4lmt  nesa(  rrmumont1apt ifcilt a emn s () eeoxr3oydoatelueo s t2xm(rpou1omeelivtlsf Dtauroot0opx  icilsls2eauvs u4altnmo3tydomD li s;t) eto(opnydam e fetltf 2tax oot4texoifeiydfmDrmn p (4aetnir oadfpD anvols  2toim oo4apee fei s)s2rr(mo;u1opxomfeiaslaDulu pnt0tlerio oo1lmtr neo ()t2umxmpio4lp n ietlt aDumxmo;o1tleo feiyslm eauvonu) rxrio3tytfpDeaieo;s  rtoirpio4lmtemnvslt)s2urx  ot1aetn ociytfa rl( pn(4aexoir ia1fmt aiesl(0t2xmxm3ny4lp e nei t artrumoot1tleomo3tyd s rauvo () eermr3iydlmDrli i;() eurxr oo1lpeemicta( srrauroou4olx  f3tytlmDulumpnu)alxrmfcta1lmtraues s srxmiopoudal nlivtls)s2rrx  ;t1olxnmo3tldlaDra(vpnt) lxomo3io1fat  uvolt  2ur(r oudal e feta(f rrmumpno1ape  o3tasls2rauvsn() lerio to1laDr ues s) rumxr nodllt  fciat) Drax  nt4aleniietyt a2ulnvpn()tlxnmr3tatlatrli i s0 etoxmpoy4omen fctas aDrrur oo0aexnifciyd aDrmuvsnt0alermo ootoaDr ues;(0trtrimpnu4lpenlieslt) 2ra(mp;u0olenifetytlmDrlnms;(4 rxnmrcia1lpDrlues s0trxoio ou4ll   ict t  Drax  nu1tpx ifciyt m em( p u) rermociodlpDran i t s2xmir ou4omee nesatfsDrm(mo;o1tpx  fciyd a2rmnvp (4 lermo oodlptr iei ()texmimpoy1op  miciasfa2ururpou0tex  ociytfm2ra(mont0 lxrxrcoatopD  u i t0s2ur(mpno1lmt liet tfsDraxmoou4tpen iciad a2ua( s;(4 eeoxf3oa1lm eanvo;s0t2uoio3oy1amt  fvia(f rtr(  ou1oeeoiieiyd aDuln ont0 lermo oodlm e n sl()s2xrio3io4am nlnciasfsrrrxro;t4opxnmi3tytls2rl(mp u)arxnmf3oa1fm elivo s)t2tr(r3ou1lm   fetl(  2urur ;u1aeenii3iys a ua( p;t4 eermociadomteaues;s0 euoio3iu1lm e ieils)arua(mont0alenioeiysfsDem(vpnu)altnifcoodlp  aieols0 rxo(o3iu4amtelfeilsfs2tmuronu4tetoioetas a2emumo t4altrxo3oodlmt  i ils  eum(o3nu4lptnmivsatfa2umxr ou4olen f3iat m rlnmpn(4texoxocoy1lateauvol( trxrxo3nudaptn nvs (  Drrurpno4apxnmo3iyd mDemnms t0aeenmr3iatlmtr n i;()srxm(m3no4lm e fct t) rtaur ;u1tptn o3tasla ranvonu4aetnxr3iadlmtr ieo t)t2xmio iy1optnmivs sf Drmxrono0tpxomicildfaDua(mp (4trenifcoo1omDe i o t)trtmxr nudlmeemfviat) 2tr(r nt1alxnmo3tltfmDul( pn()trenxo3iy1oatrli i s0 etmxr nu4oltnmnetas  rurxmoou1tpt iietad a um(vpnt4tetomo3ta1fptrln o;(  rtm(r3oy4lleelictls a2tax  ;t1opxo ietltfsDemnvsnt)alxnmfcoydlaD  u s s)srxrirpoodol nlfeias)a2ur( o;u0opto i3tatlm rm(ms;u4alerxr3iy1laDeaivols srtmiopiodam  lfcil()sDuru  ;o0teeoioctys m ra(mo;()tlxrxf totfm   ues;(0s2um(r iu1lp nmivias)aruax pnu4tlx iociltlm rlnvp (0aexnmr ootlpt li i;( srxmxrpoo1omenmnei () Drrxmp;u1aet mocils a ua(mpnt0 eermr3iodla  anvils srtrxrpoo1ope mncias)srtaumpot1olxomfeiysfa uluvp t0tltoifcoa1omtrlu olt)s2umxrpoo4alee nctls a2ra(mpoo4oleoio3ildfm umnmp;u)artnmo3tytlateaneil() eumio3ou4altn neilsfarta(m ;o1oetnmfctltfa ul( s u)tlerirctadomtr nes t t2uoxr3ou1am   iesat srtmx oot0apt mi3iydlaDrmuvs t0alermf totopt lnesl()t2uo(m oo4aptemfvsatf rum( pot1oltnmi3ilsfs2raump;t0 rxomoctytfpt  ues;() rxoirpoo1amt lietas aDta(ro;t1aexomictyt s ra( s u) exnxrcoy1fm r i o;t0s2xo(r3io4lpeelivt s  2trxro;o1tet iocilslm2ea(ms u0 renif3oadlmDelneslt srxmxopiy4ll  lfei t) Dtrur ot1tlxomfeiyslm elnmsnu) lenxfcoa1omD  ieo;()t2xoim ny4lmte nvtl(f 2ur(root0oetnmi3iad s2rmnvs;t4tltoxf todoatrau olt  eur(o iy4olenlnet s) rrmu  ou0apxn i3tasls ul(msnu)aexrmf3iy1fm e i sl(0truo(r oo4lm e fcs sfsrtru  ;o1tpxn ociasls2ra(mp;(0 eeoifcoo1lm e u o s0 rxoiopiodlmte fctatf rtr( o;o1tlto oeiydfsDeanmpnu0 etoxrcoo1fpDeln il(0 rurir ou4lptemfvtlt a2urxr ;u4tlxn i3tltfaDemu s ()artrirciotfa eaues (0 2umxrpio1alee neta()arurxmp;t4tpto ietad s2ua( pnt)alenmr3iodlp   n o s) etoio oudll  liciat srurxm nu0olxnifctldfaDemn o;() ltoxr3iy1op   nvils teurxr ny4lme  ivsltfa2rmx o;o0texoiictys aDrln on()arenmf3tydopte ivi;( tetrxo3nudaltelfeslt)sDuax pou0teeo ictytls2uanvpn(0trxoxr3ootfpDeln s;t seumxo nu1lp e fvta(f Drrx  ;o1apx  iciasfm raumonu4tetoxfciotlm eaneilt0srxmxopoudomtelict sfarra(mp;t1opeomiciydlmDrmnvo (4 lerio3iydfp rli s;(  ruoxmpiu1al   ivia()sDrrur ;t1aptomietytfa2em(vsnu)trxoxfcoadomteln s;t)trumim3io4lmt  fcs t) 2rmumont0tltnmoctasla2ua( o () eenio3oydfm  lnvo s0sexoim io4opte netas) rtaurpoo0texomi3iyt aDrmn pn(0tlxrmf3todomD aneil() rto(mpoy4lm nmivtlt srtrum no1teeniieiltls umnmonu)aetnmo3tytlaDr i slt)s2urir3nu4lm emncsas) rtax  nu0tltn ocils s ul( p t4alxrmfctytlaDrlnvols)t2ur(r3oodol n neils)a2rm(mpot4apxo oeiatlm emnvsnt)arxnmf3todla rluvi (0 rtoxo oy4lptnmfcsas) 2trxm oo1tpx ioetysfaDeanvsn() lxnircootoaDrli o;t) 2ur(o3oodlmt lnvt sfa2umu ono0alxn f3iysfa ul( p (4 lxrxf totfptrlnvs;t t2tm(opiudlme lfct ( arua(mont0oleo iciadls2uanms;t)aeermr oadlpDrlues s0srto(m3no1ope  ivi () Dta(m ot0ape io3tasfa2rau s t0tleomf io1om elnei s)s2urxm io1lm nlfvtasfa2raxm ot4aeeomoetlt m el( s (0alxnxf todfpD ai i;t0 rxo(opno4aleelfet s)sDra( poo4ope ifeiyt a ranmsnt) rxrir to1lp elueo;( t2xo(m3iudaptelfvsa(f Dtm( ooo1olxoio3tad a umn snu4 lenxoctadlaDean o s)s2uo(rpoy1om elfcs tfaDrm(mp;t1tpt mfeilsfm2uan o u0trerxf3to1fp rlnvo s)setmio3iudomtn nci (f 2um(root0apxo oeiasfaDrauvsnu4artoxr3io1opD anvo;() 2tmio3nudale  iviat arur(roou0apeoifeilsls2uanvp (0aetomf todlm e i o (0s2uo(rpnodlm nmfes () Dtmump;o4tlto fciasls2rmu on(0trxrxo3iotoat  i i s0tetoir nu1am  mnes sfs2ua(m nu0aleomfetls m uanmp;(4tlxnxoctydlat  ivi t0 euo(rpoudlm emfet (f Dtmu p;u4aptoio3iadls ean p;(0 lenxo3io1fpDe n slt)srur(m3nydoptn ivsa() rrm(r ;u1tle  i3iyt aDuanvo;(4teerxf oo1om elnvslt seuo(m io1ope  ncsatf rtaxr no1texn o3ias m eau p;() exrif3oo1lpDelu i ( texr(m nudlle mfei s) Duau  ou4aeenifetld aDrmn s;(0 rxnxrcoytoaDe n s;t)srxoxr iudlmenlnetat aDrm(mpoo0aee mieiat mDul( p;u4trtnif todfp rlnvi s0 2urim3ny1apeelieil(  Dtau p;o4tpe iicilsfa2rln o;t)tltoif iadfmtr i o ( truoiopnydolenmfct t s2ua(r ;u0altomi3iasfm2uau pnu4arxomo3iytlmDr ivs;s texm(opoo4lp e netat artm(mpot4ape mf3tlsfaDemn p;() exnxfcoadfpDr n ol()t2umir no1oltelfei t  Durx  no1aexnif3ildfsDum( ont0artnxoctodlatrauei;s t2xoxmpiudomt  icta()aDur(rooo1tle  oeiatlaDea( on()tetnmr tatlpt livi s)t2toir3no1op  mics ( srrrxroou0tpt ioeiytfa rmnmsn()artnxf3ty1fm  lnvo;s  2uoir3nydopt  ivs (fsrrr( p;t1tpto icilsfa rl( pn(0 etomf oadlaDrai s;t0texmxm no1apt lici t)sDta(mpnu1alenmfetldls2ea( p;t4texoir3oytlmte nvs;()texm(m3ou4omeelfvi t)aDrr( ont0alto fctlt a ean snu)teenioctodfa  livs t0 eto(opoo4lp  mfcs () rumxro;o1alx mietytfs2em(mont0 lxnxf3iy1lpD aues ()s2xoxmpnodlp nlnet tfsrta(r oo0optnmi3iyd a rlu s () etomr3io1lp eau i;( tetr(r no1lm n fvsls) rurum ou4aleo feiad m umuvpn(0altnmo oadfmteln i () 2umir oy4om e fct tf rtr(mpot0tex  ietltfm2rmnvp t) rerir3iatfp rlneolt0srxmxmpny4ll e icilt) Dtmxrp;o1alxnmf3ilsfs2eluvp;(0 leoxf3oydfp rlieo s0t2tmxo3ny4op n nvsl(fsrrmxmo;o0aleo ociltfsDul( p;u)aexnxo3iotoa e ivs s0t2uo(rpio4lmee nctas)srta(  oo0apenmocilt sDel(vonu0 rtoxr3tatfa ean o s0 2urxmpno4lme  nvil(f rra(m nu0apx  o3iltla2ulnvs t4 eeomf iadfp   ueil( texmir3ou1lp nmfcias)arua(r ot4tlen fciydfsDeanmsnt4 lxrif3iytfpDelieslt0 rumxm3oydam emfctat aDtaxr nt1tpx miciat s2rln o;u0 rxriociydopDr ueslt  exrim3oydameelivils) 2rrumoou0oltomfeild aDuluvs;u4 etnmf oatlpD  nvols srto(mpoudapenmivs t)s2taurp;o4tlx mieiys aDra(vs;u4 etomfctatom raieo;t0s2xoim oy4om nmivtl(farumx  oo1oltoif3tytlsDrlnmo t0altoxo3todom rlnvi (0trxo(mpnydllte fvsl( aDta(mooo4oexoiicias sDemu s t4 eenxf tydomtran o;t  rxmim3nu4lme livil(farrm(m ;t4olxn f3tls aDua( onu4 ltnmo3iadfa eai sls  2urir3ny4ol elnvs ( aDra(m ou1tltnmfetyt m elnmsnu4texoir3ia1omtrli ol(0 etm(o3oy4oltn ieia(faDrrx pou4tpenmo3ils a rl( o u0 eenmrcoatoaDeln s t0 ruriopoo4lmtemfcsa( sDtr( o;t0tleomfciat aDrl(vo t) lenxr io1faDelivi;s) etmxo3nudlme mfesa(f 2tr(rp;o4opt moetysls2umnvpnt4trerxo3oo1lp e u o;(0srxmxo ny4lpe livta()s2ra(m ;t1tpeomfeiad a2umnvo (0artrircoatfm eau i t) rtmxo3nodal nmnesat aDrruroou0aeeo f3tyt aDemu p;t4 eerir3iydom e ivol() rxmxm3oo1lpee ivils)sDuax  ot0aetnmoeiys a2ranvp t0 rtrmoctadfa   nvsls0 etmxm3iudop nlieia( aDrm(mpou1ape mietadfa2umnmpnt)tlxniociodlp  lieo t trtrxrpnydlmen nvia(fs2ta( pnu0olt  fciyslm rmuvo;(0 rxrmf iydfp elieo s  2xmir oudome mfet (fs2uau  ;o1oltniicils a ean s;(4trtrir tatlpD aieilt texr(rpiydlpt lfetls s2um(ro;u0tlxn oeilsla2raums;(4arxoxfcootomD  u s s0 rxr(m3ny1ll n fvtlt) 2urur ;t0tet miciltla rluvs t0 lxnxf3oa1faD livi;(0teur(m3ny1oltnlicsls)aDra( oou4opxoif3iat sDel(vsnu0 ltrirciy1fatran o t0setr(m3io4apenlict t sruau  ;t0tleomiciyt m2rlnvo;()aetnircoa1lp  ln s;t0 2uoxr3nydll emfcs (faDumum ;u1olxnmiciydlm elnvo;t) rtrxr tytopt lneils teum(o3nydlm emnes sf rurum nt0ape moeils m rmums u)artnmfcia1fptelneslt) eurirpoo4alt  fcta(fartmu  oo4tlxnmiciasfs2eanvp (0 lerxo to1oa r nes () rxoir iy1ll nlfesa(fs2uax pnt1apxnmociasfa umumsnu0trenxo iatlpDr ivi;s  etrxo nu4lpenlfcia(fa2rau o;t4oex mi3tldlm umumo u4arenxf oodoaDe n olt setoxo ny1omt mietatfa2uaxro;t0olto fctadlaDum(mpnu) rtoif3iodfptrlueolt)s2uoirpiydome lfvslsfarum(mo;t1alenifeiatfsDua(ms;t0trerif3oy1fpD aivs;s)setmxo3iy4optemfvsa() Drmurpot0aetomfeiysfmDul(ms t0 rxoif3tydfp e ies s  2xo(r iydlpe lnvsl(fa2taump;u4aeto octlsfsDrmu o u) rxomf oydopDr uvo;t0 eur(rpiu1opt lics s sDrrumo;t4oetnifeiydfa eln ont)arenmfctadlpDrluvo t) rxoirpiudlm  miesltfaDrr(r ;u0tlenioetytfaDelnvp t0 rxnif ootomDr n olt srurxopnodapeelfesatf rum(mpnu1aptn feiyt s2um(mo u4trtrircoa1fm rlu ols)srtmxr io1oleemieils)s2ua( o;t1apxniociysfm ua( s;t4 ltrifciatopDr u ilt0seuo(o oydamen nesls)srta( ono4olen oetyt a2elu snt0altoxr totlaDean o (  rur(r nu1oleelnes s) Dumxrpnt4aptn f3iasls2uanvp;t4arermfcoodfmDeaneo t0 2trxr iu1ol nlfcias) 2ta(r ;t4tlx iieiasfs2eauvsnt4 lenmrctatlmte n ols srtm(m3nu4llt lfvslt)a2umu  ;t0alx  fetadfa rmumo u) renio3todlmDelneo;s)t2um(m3iodlp  lnetlt)aDua( p;u0altoif3iadfs rluvs;u4trxomr3ia1lptr uvo t)s2toxo3ou1apt  fei ( s2ur(mpnu1alen oeildfm2ua(mo;u0arxrio3ta1fmDr ivil(0trto(o3oudameemneia() 2tau  ot4tlx  iciytfm eauvs;t4 etnmo3totop eaivs;s)trxmxm nu1opeelfvslt)srtmxmooo1tle ifciydlm uauvs u0aleriocta1latran ol() 2um(m nydlpeemiesl(fsDur(ront1tpen o3ias mDemu s ()tlenircta1fpDeauvi s)teto(opio4amt lieils)arrmxrpot0tleo fciyslmDumuvp;u) rxoifciytfa rlivo () 2xr(m no1ape licsltf Duau  nt4ape iocils s ea(vo u0 eeoiociodoptraneol(  euoir ou1ome mfcs ( a2ra(r ;t1aptn ictyt s ea(vo u4 exnio3iadom  auvi s0 rumxrpnu4lle mietl(fartm(mpnt4teto f3ildlmDulnvont0 eerxo iy1fmt liei;s) 2xm(o3io4apt mfci t)artr( ont4tpenifciydfs2ran snu0trtrmf3iatlmtrlivs (0t2um(rpiydlmt  fet ( arrrum ;u0apxo ieildlmDeluvsnt4 rxrircoa1fa   uvo;(  exrimpou1am e nvtat) Dumu  no4apx if3tls m el( p;t)aeeomrciydlpte nei;() rxo(opoudapenlnetl(f 2tm(mp;u4tex  octyd sDeanvs () rtnxo3iytopDean s t srto(rpoy1ap elivsas  rur(r nu0aexoif3iltfm eauvp () eerir3tydfa eluvo s0 2xo(r3oodameemivtls)srtrxr ou0oetomf3tlsfmDrmnvs;(4tetoxo ta1oate n sls  eto(o iydapee nviltfa2rmxmpou1aptomociasla ulnmsnt)alenmf iodomte u o s0setoxo3oodope lnetls  2raxrp;t4tle mociyslaDrm( onu)arxnxo3ty1lp   uei t)s2urxrpoo1amenmfvils sDtaurpot1alen ociadfa2emnmp;u)trtnxf3oatfp rai s (0 rumimpnodaptnmieslsfsDuru  ;o4tee iictytfm2umnmp;u0 leoxo iy1la r ivi (  rum(o3oudopt  fcsl( artmxmooo4tpx mi3iad s emuvont) eenifctydom eaivs t0srtmimpoy4lle  ieiltfsDrmur oo4oet if3iasls2rmn onu0trtnif3oa1oate nvi;( srxoir iodamtn feil(fa2um( o;u4apx mfcilt s2umnvo;t)areoxf3ta1lmDrlieils)t2xr(rpio1oltelieilsf Dtmxr ;u1alt moeilsfa2em(vsnt4alerio3oatlp  liei;t)srtoiopnu1alenmfciasfaDuaxr ot0aptn ieildfmDeanmpn() exnxf3iadfmt aiesl() rum(m3oudopeemics s) rrm( ono1alxnmociatfs eanmp u4aleoio3oydomt  neo;s s2urio3no1olenlnviltfs2um(rpnt0ole if3tls sDrl(von(4tetnir iytom elneolt) 2urxo3nu1llt  icsls a2rr(roou4aetn o3tldlsDuan sn(4 renxfctatfp eli il() 2trxo3nu4ol   fcilt)arumx  ou0teenifetltfa eln s;t4arxoif3oadlmte u i s0sruoxo nudaltn feiat srtaxrpnu0optnmfciad sDul(vp;()tltrmf iytfmtr nvi;(0srtrxmpnu4llenmieslt  ruru  no0oexnmi3tytlsDrl(mo u4aetnif io1fpteai ils  euoirpnydapt  fvi ()aDtaxroot4opeo oetys aDrlums t4 rxnirciatlaDe nesl(0t2tm(r oydlp n nvsltfaDrr( pno0oet  ieiys m2rlump;t0altnmr3ia1lm rauvi;s  rxmim io4olt mfvsa(f Duax oou1apt iietadfa rmumpnt) etrmo3iytfpD lieo;t0 eto(m3oodlpe lneias  rra( ono1apx ioctld s rl(vo ()trtoif3ia1fpD livs ()s2xm(r oy1lpe lfvsls)s2rrx  ;u1tetomfeiasfm2eluvs;()trtoircoy1fmt  n i;t seur(o iydopt miciasf Dtmu onu4apenmfciytla ran s;u4 exnifcio1faD aneol(0s2um(rpio1aptemics (fa2urx  ;u0oexoifciad m emuvpnt0tlerxrctydfpt luvols0srxo(rpoo4llt lnesa(  2urxrp;u1tex  ietlsfa2umuvpnu4trxrxocoydfp ean i (0trur(r3nodlltemnvt t) Dtmumoot0openifciltfmDeauvonu)artoxr iotoatran s ( t2tmim3no4apeemicsa(f Duaxro;o4oet  i3iad a elnmsnt0trxnifciy1om  au s;t) 2xoxo iu4lmeemfctatfa2tmuro;u4oet  fcildla umuvp;t) lxrir tytla e iei s teumxo io1lp nlfvi (f rtru pno0aeeo octatlmDemu p;t4tetrmociytomteai o t0 etmio oodape lneil(fsrumxro;u1optomfeiyt s2eaumon(0trermo3iotlmtr uvs t0 rtoxrpiy4llenmfcilt sDur(rp;o0tptniicias aDua(mp;u0tlenio ia1lptr ieo;t0 exo(mpoudom nlnesas  2rr(rp;t4aetnio3ils a um(mo;u4alxrmocoatoaD luvolt seumxmpiy4op nlfetas s2uru p;u1apt io3ilslm2elu o;t4aetnxr ta1lm r i o;(  rurim3nu4op emfet sfs2ur(mpou4aetn fciadfm ua( ont4 rtnir3iatfmDraivs s0s2xmxr3oy4optnlict tfsrrru o;t0aleoioetltlaDeln s;u4altnxf tytlmtrlnvols0seur(m iu1al e fetas  rrau ont0oexnmo3tysls2elumo t0trtnmf3tadla raies;( seumiopiu1omeemnci s)artau  ;t1tpx  oetasfa umuvp (4texoio ootlptr nei;()t2umir oy1lme mfcs tf Draxrp;t0oet  fciydfm2em(vo;u) rerxf iatlm  li o;()seuo(rpoodolee iei (fa2tauront1apx mietld m ulumon()tlxoxf3tatlmtrli s;t0truoim oo1lmeelivi sfs2taump;u4texnmoctytls ua(vp;u4 rxrmrcoytom rlivs;(0teuriopnu4apen fetls)aDtmu o;u1tleoioctlsla um( p u)arenio3oydfm elu ilt)seur(rpnydamtnmies tfsruau pno0alxnmf3tls s2em(mo u4 rxnmr ootoa raivi (0s2tmio ou1amtn ncilt  Dtmu  ot1tpx mi3iat m el(vsnu)trtrmrcio1lpDrlues;s t2trir oudol   ivsls srum(ronu0opeo fetldfaDranms u4 rtrioctotom ranei s s2trxrpoo1alee nct t)srtrxr ou4tpt  i3tat aDua(mon() etnirciodfmD  nvi (0 etmir3iy4ameelfvsls)a2tru  no0optnmoctltfaDuau p;t0arxnmf3tydlpDranvo;s seumir ny1lpenmnetlt)a2uaxmo;o0altomietys sDemnvon(0 exomrcia1fmte u o;( t2umim3ou1lltemnci t  rtm(  no1oeto i3iatls ra( p;u4tetoxo3to1lm  aues s0teurxo oo4am emfesas s2rau onu1olto oeilsfmDuan s t4aetrircoy1opDeln i t)setr(opiydlpeemiciatf Drax  oo1altnif3tatfm umn pnt4alenircoa1la e nvsl( t2trirpio4lmtemfeils  2rmumpnu4tle iocildls2ran onu4areomr3oodlpD aivo s0s2tmiopiydalte feta(f 2rmuront4oetomo3tldfm2raump;t4 rermfciy1op rlnei;t  rtmio3iodal emnei s s2uaxr nu4tpxn ieiyt a ra( s u) eeoio tydoptrai ols0seur(r3ny1am elfct (faDurur oo4tltn i3iydfaDelumon(0trxnmf3iodfat lueilt0 eumirpiydomtelivsasf rum(r ;u1tpxnmoetltla2rm(vsn(0altnmf ta1fat aiei;t) rxr(m ou4alt  ncia( artaxm ou4tlxoifctasfs2rmumpnu4trtnircta1fmDr iei;()trxmxo oudopee fvt () Dtrumpot4tlt  ieiydla2rlnvo;t0 eeomocoadfaD anei;s s2xoir3io1lm emiviat  2rmx  ;u0tlenmf3tatfaDuan o;u0aetoioctadfp  lnvol() 2xoxm nu1am e icil() Dumump;t0optn ociytfsDumnvo;t)teeomocoy1omteanes s sexmxo no4al emneilt aDuaum oo4opx mf3iasls eanms t4 renir3oydfpteau s;t)tetoxrpiu1ap e nctl()srta(mpot1aee  f3iltlaDemnvo;u)trxrmfctadlm r nvols) rxoxr3iy1op emfvslt arrmxrp;t0optoif3iad mDumuvont4tltrxo oodlmDeluvs;t truo(mpiudope liesa(f rum(rp;t0olx  o3iysfmDum( s;u0arermr oytfmDr uvs;s0teto(mpno1op emnei s srtmurpnu4olenioeiys m ranvo u0 eeoir3tadlp   uvo;s0trtoirpoo4lltnliciltf rtr(rp;t4aex mf3iadlm eau s;(0 rtoif oo1op   ueo;t)srurio nodaptn fvs ()srtmx pnt0apxnmfeiatla elnvp t4artoio3oatomt luvs s s2uoxr3no4ome mnet sfs2uau  nt4apto i3tysfm2ul(vpnt4 rtnmocta1fm elnes;s)s2tr(rpiodomen neslt) Drrxro;t0apenifeiadfsDuan o;(4aexrmo3oa1la  lnvi;t  2xrxmpnydlptelneils arum(r oo4ape io3iatfa ranmpn(0alenio oytfa rlneo;s tetoxmpnu4oltnlnei t)srrrurpoo4aptnmicils sDel(vs;(4 lxnio3iydlmD aneilt  2trxr3oo4olt  fvtl( s2ra(roou1tpt moeiad a2rm( p;u4trxnxo ootoaDeauei t0tetrirpoy4ll e fes sfaDtm(mo;t0aeeomieias s2eln p u4aexnmo3tydfaDe u i;(  exm(m3no4lleemfcs (f 2umxm ou1oexnio3ilsla2em(vs t4arerio3ta1laDrlu ols) 2umir iodamee ivt (f 2rruro;u4apeniiciatfaDelnvonu) exrxr oodfaDeanvslt)tetm(mpnu1op  mnvil( aDtax ooo4teeo f3ild mDem( p ()teerifctotom elivslt seurxo3iu4ol   fcsatfsDtrum ou4aleo octltlm umnvpnu) eeomf3oydop rluvslt  etmio oydap elfcs t a2uru ono0altoioctadlm2ra( o t4alxrmo3iodomDraneo s0texm(m iodapt licsltf 2tmxm ot1oee  i3ias mDelnmon() exrxo3oatfaDeli i (0trurir3iy4op  lfvsat s2um(m ;t4altn ieiadfs rluvs ()treoir iydopt  i slt trtrxm nu4omtnlnet ()arum(mono1texn i3tas mDrauvon(0artnmr iadfat  ies (0 rur(rpiu1amtemiesa(fs2rr(  oo4aptn i3iat s2umu s;(0artoir oo1fmt  n s;s)teurio3nodlm  livsls arraur ;t1tlx mfctls a uluvp t) etrmo oydlpt li ilt0teum(o3oydope miet t s2rrur nt1optomoeiyd sDel(vp;t0 lerxociydopDeaues;(  2xmim ou4lmenmfcias) Dumumo;u1tlto o3iysfs2el(msnu4 etnmocio1laD lieo;t0trto(m oodap n nvs (  rtrx pnu1oex  o3iytla uaumont4 leoir3iydfaDr nei (  rtoiopoy4oleemivtlt) 2ra(rp;t4aet iocilsla2umuvon(4trxnirciy1om   nvo s sruoim3io1aleelicta()sDuaxmp;o4olx mo3iat m rl( o;t4trxrmrcoatlpDelivi (0t2urxmpnudale  iei t sDta(root1tptnioeiadfsDum(vo u0alxoio3ootlm rli ils  2umir iy4lle lfesl(f 2tmxr ou0texniietatlsDra(ms u) eerif3oodop raueo s  rumim oo4ape lictasf rrm(  ;o1tetnifeiadfmDra( o;()tetnmf iytfmte ieols  2xmir3oudop nmfvsl( a2uaumpoo0teto fetyt m ul(mo (0 etoxr to1lpt ai o;s)t2uo(o io4olee fctl() rtaump;u0tlxn ociytfmDul(ms;t4arerif oytlp   uvi;(0 ruoxm3nodomenlictls sDtmum oo1tltoiociyt s2eaumont4tltnxr to1fptr u ol( truo(opnydll   ictlt)aDraxrono1tlx  ieiytlm2eln o;t) rxoir3totfpDrlieil( truoxopnydlle lfeil() Drr(m nu0oet iiciadfs rauvp;(0 etnifcty1la r uesls) 2urim3nu1olte feilt srumu oou4oee  i3iytfs2uanvs t4 lxnmocoodfptrln s ()s2xmim iudaptnmnvilt sDurxmo;t4tlto ocild aDrauvp u4teerxf ty1oaD auei;s0t2xmio oy1ol  lnvt tfaDum( pnt0apxnio3iytlm2ul( s u)artomf3tatlm eanvsls t2urxopoo4oltelictlt)a2tmuroot0tlx mi3tys sDelums (4 lxoxoctadopt aivslt0truo(o iodaltnlnvsa() Drmur ;o0tlxn ictat a emuvp;() ltnxo tydfpDeluvilt0t2tm(m iodalt  iesasf Dtr(  ;t1oex iiciasfa ua(vs;t4tltrxrctytfpDeauvilt)sruoim3no4apeemicias)a2umum ou4tpeoif3iltfm2rm(ms;t4aeerxo3iodlpte ueol( srxm(m iydomt lfctl(  2tr(m oo1altnmoctatls2elums;(4tltoxfciotopteau s;s0sexoio3oo1omt lnvsa()artr(ro;t4tetoifeildlm2emuvsnu0tetrio tytlpDr ueilt0 rxmirpio1lm  lnvsa( sDrmurpou0tpe mfeiytfmDumu p;u0 rxrxocoydlptr nei;(0teumxm3iy4ll emfei s aDumumont0tlxniociysls2ul(mo u0alxoxo oydlat aivi () exoxr3io4ale mnetlsfs2tax  ;u0altnif3ildlmDemnmp;() rtnmr3oodom   nvo (  2umio3nydome mneiltfs2tru o;t4apt  oetas a umu s u)arxrmrcoy1lmteai s s) rxm(opiydap  mnetlsfarurx  ot4olenif3tldfa2ulnvo (0aexoif ty1fmDelivs;s  etoxopoo4ameemnet (  2ra(mp;o0tet mictydfa ra( o;(0 eeomr to1fpDe nes;(  exoirpoo4op n ncs sf rtruro;t4tle miciyd m2rmums;u0 lxoio ia1lptraies;t0trumxr nu4amtnlfvi s)arra(m ;o0tlen octys m ea(mp (0altnmr3oydom raivi (0srxmxr3oo1om  mfvsls srur(m ou1olx  oeiat a2em(vsnt4teeoif3iydfmDeaivols0seuoir iy1opeelfvt (  rrrumooo4oltn icilsla rl( o t0arxoxf3oytom eluvi;s0s2urim nu4ale lfeta(farrmxm nu1teeoiiciys s ul( p u)tlxrmf3oatfpt li sl()trumxm io1omt mfcsas aDum(rpou4teeoioetad a rl(ms;(0 rtoifctodlatr uvil(0srumim3ou1lpt  netls sDtau ont1oeeoiociadfm2ranmo;u4aexnir3oodoa  ln s;s  exm(rpou1llenlicsas) Drmxr ;t0apenif3iydla2emuvont4alenxr3iodla  auvi;t)seuoxm3nu1llee nvtlsfsrur(mp;t0oee  ociytlm rl( p;u)trxnxf3iotoat ln i () 2xoirpiy1ole mietlt)sDurxr nt0olen ociltfs uanvpn(0 rtnmr oo1op elnes;(0sexm(rpnydomtnmncs ( a2tm(ront4teeomf3tat mDrln p u0texnmo totfmD  nvo;()sexmxo ou1al n fcs ( sDraur ou4teeniieiytlaDrluvsnt4 ltoxrcoytoat auvi s srtmio3iy4optnmfei s)sDrmxro;u1aexnifeiltfmDuluvs;(0 rxrir3ootfa rlues t)s2ur(m3iu4omeemfcilsf Dtaxroou4tpenmieiasfa2rm( on(0 lxnif3iadlm   i o s)trxmir3oy1om  lnes sf rrr(m ot0tlxnio3tyt m2eln s t4arxriociodoat  n o;(0 2tr(rpiy4ol n ivsl(fsDuau  ot1opt  f3tasfsDul( onu0alxnif oo1omtrlnvo t0srtoir iodaleemnvil()sDumumooo0oexn fciydfsDrm( sn(4arermoctydfa rluvs ()t2xoio3no1amtemncia()aDuaxrpot1oleoifeiaslm2uauvont)texnmfciytfpDr ueo t0s2xo(rpny1om n fci tfsrurxm nu1tlx  iciaslmDuln p;t4aleomf3iodom e n o ( setmio3oy4lme  ncia(f rrrxrp;o1aeeomo3tltlm2um( o ()aexrio3tatfat lnvo;(0 2xrio iudol nlfeta( sDrrxrp;u4olxomoctatfa rmuvs t)trxnmf3tytom ean o s0 2xo(opou4lpe lfcilt aDrr(mpoo1opxnmfciydlsDelnmsn(4aeeoif3oo1fm eaieil() rxmio iy1aleemfvs ( s2um(r ou1apxoiieiydfa raumpn()altrxf tytlmD luei;( trtmir io1ol nlfcsl() rtruro;u0tet io3tys aDemnmo;()teenxo tytfa rlivo s trtr(r iu4olte ncias) rur(  ;u1tlx mo3ilt aDeauvpn(0tetomrcoa1lmDeluvi (  2xmirpio4opt mfet sfaruauroou4alxomf3ilsfs um(vp u4artriociatlm eaivo t)srurxo ny1lm   fci t)s2uaur ;u1aeeomociad m2elu snu)aeeoir3tytfa elivo s  2xmxo oo1am n nct s  rtauront1altomociysls2rl(vont4aeeoxocoo1omD livi;t teuoxopny1omee iet (fa2rmurpot4tptn oeiyd a2uluvon(4aleoxr3to1lp  li o;() etr(rpno4amenlfetat aDuaur ;t1aeenioeilslmDua(ms;(0arxomo iadfmD li i () 2uoxm oo1amtemictls  Dtmxmpnu4tpxnmfeils m2ul( s u4trtnir tadoat lieo ()t2umxo3iudop   feils sDumxmpot4apeo fetlslm2rl(mpnt4alerircoa1fp e ues;t0texmxrpio4olenmnctls)s2trurp;o4optomo3iasfm rm(vpnt)aeeomfciatoaDelieil(0sexmir nu1ll n fviasf Draxmpou1opt mfeildfm eanmp t4 eerxoctydfptr nesl(  etrxm oo4opeelnvsa()arrr(rp;o1alxomictldla2rlnmo t0aexoxo oa1fp  lneil( t2ur(o3nydapenmiciatfaDum(m ot1opeo i3ildfa2ean pn()trerir3to1op eluvols)texo(m3iu1amee fet (  Draumoou1tpe ifciltfaDeanmp;t4alermf ia1om raivo;()trxm(o3iy1ll nmfetatfaruru ooo1apt mo3iytfa2ul(mp;t4 eenmr tydla eai i (0teurir3oo4llt lnet ( arumurpno4apeoioeiadfaDem(vsn() ltnmfctotfa  an sls0truoxr nudop n ici sfarrrxront0opto ictat m ulu ont)tltnioctatoate nvo s)t2xmir oo4am nlnvi ()srtmxrp;t0aeeomociydls2emuvpnt)artomf3io1lpt an o;t  rxm(opiodll e ivsat  2uaurp;t0open ociytla2umumonu) lxrmfcoytfaDeaieol()trtmxrpiy4ll n nciat artaxmpnt1oeen oeiyslmDea(vsnu)aetnxr tadlpDe uvs;()trtm(r oo4al elicils s2rauronu0oexomo3iyslmDrauvp (0aetnircootopDrau o ()srtmxrpny1op elici s) 2rrxmp;t4oetn octlt m2rmnvpnt4arxnxrciatoptr ivs t  etmio nu4altelivt (fsrurx pno0opeoiocilslaDul(vp;t)tleoxr3ia1fp raies;s0srxrio iudal e fvtls  Dtmxm no4oltnmfcilsfm em( p;t0trtoir3oadoaD livi (0s2xo(m3iu4ameelicias  Dtr( ono0tlto feils aDra( o;t4aeenxr oa1omtrai o;s)t2umiopnodamee ivtl(  2raumonu0teeniieiyd s2ua(vp ()tlenxf to1oa rauvslt0trxo(o ny1lme  feiasfa2urur ot4tetnio3ild m2em(ms u4teerio3iadfmte ivi;t setmimpiydlpt mfvs ( s2taxm oo1oetnmicias a2uanms (4 ltoxoctotlaD lu ol() ruoirpnu4aleemictlt)arum(  no0ape  f3tlt aDemuvo t0teeomo3ty1fmDeai o;() rumxr iydolenlnvs sfsrraur no1oeeomfciltlsDuanms u4aeenmrctydlaD liei;t  2xo(mpnu4op emfctl(fsrua( p;u4alxnmoctadfa2rmnvp u)tetnmocty1omDeli s t)s2uoxr no1ope lnes () Drmum ou1aex ifetld aDrln s;u0 etrmo ootomDeau ilt)texr(o3iy1optn iciat artax  ou1aex if3tydla rl(vsn(4 eenxocoadfmteanvo s0tetrim iodlp  lietas  Drmum ou4tet moctlsla rmumpnu4altrmrctytoptelivo;s0 rtr(r nydlpt lfeslt  Dra(m ;t4apeomieiysfa ran s;t0alxomfctadlm e u ol() exrio no1apeemncta(faDuaumo;t4opeomocils m2elumpnu)aexoif3tydlpD aivs t  rxo(rpiu4openmfvtlsfsDtaxm nt1oee mfeiydfs2rm(ms;(4 rerir iy1lpDrln s ( sexr(mpoudlp  livt s sDraumooo1aleo o3tltlsDemnmo t4aeeomo3oo1omDe uvolt texmxr3iodolte feta()sruax oou0aleoif3tadla rlnvs t4altoif todfp e ivo t) 2um(o iydam n fei ()sDuau ont1tleoiieiyd sDemuvs;(0arxnmr oytomDe uvo s srxrio iu1lle lfvsls s2truronu4tpxn i3iydfsDrl(mp u0aeerif oy1fa r nei t trtmxmpiudopeemivta( aDua(  ;o4teto icilslm2uanmp u0tleomo oydoateau i (  2xm(mpoodap e feiat a2rm(  ou4tet iocils m ul(mo;u0trerircto1fa r ueils0texmxr no1al  lies (fs2rrxmo;u4apxo octltfaDranvont0trxnmo3ia1fmDeauei s)srxrxopiy1olt lfcs s)a2raxro;o0oee moeild aDrmuvp;()trerxo3oodomt  i sls t2xoim3ny4omtnmnes () Drmum nu1opx  ictas s rmu o;(4aeenmf3todlaD aiesl()s2xrir3io4lptelfvil()srumx pnt4openii3tas a2rmnmo t4 etoxf oodopD  ivs (0 2tm(rpoy1al n ieils s2rru o;u0aeto ociltfmDuan o;t4trtnxr3oy1opDeln o s  eto(r3ny1alenmivia(f ruaur oo1olx  oetatlm2rmums;(0aleomo3totla eaieo;t0 2to(m3oo4ol   net ()a2rax onu1oeen f3tldfm elnmsnt4texrio3iy1fmte ivo t) rumxo3oo4amenmfctat)s2rrxront0tex ioeilslaDeluvsnu0 rtomrcoadfpDe nvils0trxmiopou1omeeliei tfa2um(ro;t1tlx mfciysfsDrlump (0tltoio3ty1faDeauvs;t0 2to(o iu1ol e fctlt)srrrur nt0aet mo3iadfsDemumsn(4aetrxr3ty1la  au o s texm(m3iudol emictasfsDtaump;o0apen ictlsfmDum(vsn()aleoif3totlmDrlu s ( srurxo3oy4am   ies s s2umx  ;t1texoifctad m emnms (4tleoxo oodomDeaieols)tetrio3nu1omenlfci t) Drm( p;o0tpxniociydla2rm(mp;u)aeeoio oatfpteanvilt  rtoxm3iy1ol eliesat aDtmx ont4oleomo3ildfs uanvp;t4 etoxocoadla   ueol(0 2tm(r3ny4lmtnmics sfa2tmum oo4oetoif3iadfaDem( s;u4teeriocia1fmDeli ol(0t2xm(o3no1ap emfciatf Duauroou4aee  ieiysfsDrmnmp u) rtnif3oydfa e n i t)s2toimpnydlleelivs ()aDtru ooo0apenifciyt a2emuvsnu0arxrmr iodfpDraies t0 2ur(m3ny1opt mneilt) 2trxmoou0opx  oeiad m rluvs t)tlxnxocty1lptr u olt0t2tmxmpoodlmte ics (fa2rau p;o0ale  i3iyt aDuaump u)teerio3oa1lm r uvo t0sexoio3ny4am e nvtat  Dtaur ou4teeomf3tltlmDelumo;u4aleoir3to1fpDe i o;s0truo(opio1al nlicsat) 2urx oot1opxo o3tltlmDul( o;() rtoif3iydom r neil(0 2urxm iydll emieil(fsDumurono1tex mf3iltfs ulnvs t4 lermr3totfa  lu s s tetrimpoydamt mncs (fsrua(  ou4aexnioetld s elnmp t)aetrmf oy1fmDrlu sl(0s2xm(m3iudameelietas a2umuro;u1alt mf3iatls2rl(vpnt0 rxoio todoate u s (  2xm(mpnudap nlncils a2taumo;u1apt ioeilt m2ran pnt)alxoxocoy1lmt ai sls)setr(o oodomt lfvsls)sDurxr ;o0aleo i3tytlmDum(vs;()tlxnxf totomDrln ils)s2umxr iydoltnlnvtlt)srrr( o;u4aleomfctatfsDeln p u0aexnxo oydoat lnvs s)t2xr(o3oydaleelnvtls) rtmur ;o4tleoiietlslmDuauvsn()aeerifciydlpte i i (  2tm(m ou4oltnmfesltf 2rmxm oo0tpxomi3tadfaDem( p ()aeeomf3ta1lmte ieilt)t2to(rpiydomt mfetatfarrmx poo4tlxoiiciyt aDrl( o t0tltomo iatlaD anvolt0 rtm(mpoydole lfctltfartmxmooo1ole mo3iltfs rmu s u4trtnmf io1laDrli olt)srtr(r3nu1openmfvs t  2rmxm ou0aleo o3iatlm2em(vo u0 exomo oadoaDraiei s)setmimpiodap  mict t)aDtmum nt0oeen feiytla2rmump;() lxoif3ootlpD aues;t) etoxo iy1lpen icsa() 2raum ;u0ope mo3iat s um(monu4tltoir todfmDe i ils)s2tmxr3nydape  nciat srraum ;u0altnmociys mDeln pn(0 lxomf oydlatraueo t0t2xmxm io4omenmieil()aDrmxmpoo4tpen f3iatfmDumnvs;(0 renmrcoodlaD  uvs;s  2tmxopiudlpen fci s srtm( pnt0oee  ictytlmDeau s (0aetoirctodoaDr nes t teuoxmpou1alte ivsatfa2uau o;t0tlenmo3iytlm2rl( on(4aleoir oy1fa rauvo;(  ruriopou4apeelnviatfaDua(rp;t4teeoif3tytfa2emnvsnt0trxnxo3oatom  au o t  rxo(rpoydoptelfeil() 2tmxrono1tex ifciatfm ul(vo;() rxnxrcta1opD lu ilt0 2xo(opno1lmenliesa()sDrrx  ;o4oeeoifeiltla elumpnu0trtrio oo1optranvs;t0 etrxmpnodlltn fct tf rtmump;o0ope io3iaslm ulu p;u4 rtnir3oatlaDe ivsl(  2ur(rpiydoptelfvilt)srtru ono1teeomf3iyt sDrlump;()alxomr oy1lpDr ues t)s2xr(opnodame mncsat s2tau  nu0olto ictydlaDrmn onu0 renmo3todfpDraivs;()s2xmxr3no4al   ivi s)a2rr(m oo1tex mietad s2rlnmp (0texrmfcoydfpte neo t0 rxo(o3oydlmte nci t srur(  ;t1teeomf3tldls2uaump u)aetoxf iatoaDr nes;t s2umxo iy1lptn fvtatfsDurx pnt0apen o3ilsls ua(mo;u0 lermfcoatlpt lnvil( t2uo(m oy1optnmfvtl(  Dtaurpno1oex mfctytfs rl(vp;u)tlxnio oydlatranvi;()seuo(o3ou4lltemncsatf Drm(rpno1apen i3tldfm2em( p u0 rtnircoy1laDrluvs;()setmim3nu4openlfvi t aDtm(ronu1tet miciys s2rmnmont0aleoifcoo1laD  uvi;( t2um(o nudlle lfvs sfaruau  ou1tetoif3tasls rmump u4treomfcoadlat liei;(0teuoxmpoo4ap e fvs (f Dtmurp;u0alt if3iadfmDua(ms (4altnir3iy1lp e i o t srtoxo3oodap emivt t aDtr(mo;t1texomfciatla2rluvsn()texomfciotlatrlnesls0 rxr(m3io1lleelnesas sDua(r oo0aet  ociatlm2ranvp u4artomo3io1fp ran o;t)seurxm3iudaptemfet s)sDuaur ;o4teeoiieiad a eanms;u4 renir3iatlm  anvo s srumir iydaptelfcil(f 2raur ;u0altnmoeiasfaDumn p t)aeenxf oo1fm r u i;(0srtmxo3io4lmte ics s  rrrxroou4oetniietyslmDranmonu4texrxf iotfmD ai ols0 etoirpou4lp elivsl( arua( pnu4oetnmietldfa2ulnmp;(4arxrio iytopt anes () euoxo oo4om elfes sf 2rrxmp;u1olen i3tadfs2ua( snt)trtnmf3oo1opt  i s;s t2toim3oo1am  lfctltf 2trx pno1oetomieilsla eaumont4aetrmf3iy1opt auei;s0t2xmxr oudlmtemiviasf 2rmur ou4optn feildfm2emn p;t4altoxr tytfpt an i;(  exoim iu4op  lneslsf Drrxrp;o4tpx mfeiyd s uln o u4 rtnmrcoadoaDe n i;s)seuoio iy1amt lfvtltfarumum ;o0ope  f3tytlaDuluvp;u0trenxr3tadfm  auvi;(0 rtmxm iu1olte fvi (  2tax onu0aex  ictytfs um(msn()alxnxr3iotlmtran ol() rtriopio4lmtnmfcsa()aDrrx pot1aleoioctlslm emnmsnu0teerxr3iatfpDeln s ()setmiopiodalt mfeil() 2rm(rpnt4oeeoiociytfa2ra(mo u)aexoio3tatop e uei ()truoxo3iy4ap nlnvs (fa2rr(mpot4openmfctytfaDrl( s t) exrxf iadoptrliei;s0 2uo(m3nydop nmictasfartrx ooo1oet iocildla2el(vp u0tlerxf3oytoa elu o;t0 rum(r3iu4aptnmfvsasfa2ua( o;o4tltn oeils s uanmp (0 exomf iodoaDr nvols)srtrio iu4ole mictl(  rtrxmp;t0opxnii3iys m2rl( p t4tltnio oadfaDrli i;()teumir3iu1ll elfvia( srtrump;o1aex iiciat s2eluvp t0trtoifcoo1oa rau i;( srxoxr3nodlpe mnvtl( sDraxmo;o0aexo iciyslm2rln pnu)aeeoio iodfmt lnvi;t0s2to(mpoydomenlicsl(f rtru ono4olen ictysfsDranmp t4 exomoctytfat  i i t)truoim3io4lmen ivt tf 2ua(r ;u4tet ifctldls uluvp;t)texoxo ty1opte uesl(  rxrxr oodlm  mncsa( aruauro;u0aex mo3iasfa2rm(vo;()tetrxr3todfatrli o t0s2ur(mpoy1lpte ictl() rurum ;u4tpxnifctyd a2rmuvs u0alxnmrctydoa elieo;()tetmxr3nodal   iesas) Dta( p;u0opt ifetatfmDulums (0aexoxr3iy1faDrluvilt seurxm3no4lmtnliet s) Duax  no4altnmiciad s2rluvo;(0 leoxr3to1omt lnvi s setmio oo1omenlfetlsfsDra(mp;u0apxniiciadlm2rmnvpnu0artnio3oa1oat auvsl(0 eum(m iu4ol e nctls) rtr( oou1opx ii3iydfmDemn s (0teeomo oo1fmDeaivo;s s2xmxopio4optnlieia() Drrx  ;o4apen fetldla ea(mp t) eermr io1fm   ivs;t0trxrir oy4apen ivtltfsrrr(mpot4aleo ociat m2ulnmo (0alxnxfcoydoaD aueilt0s2uo(opiydlpenmivs sf rua( pnt4opto ieiatla2rl(vont)aetnmo oydlpDeaivil()tetoirpiydopen ncsat aDumxmp;t4alenmociatfaDrlumpnu0artnmfctodom elnesl( trumir ny4lm  mnei s sDrrumpou0alxoiieils s emu on()alenir3iatfpD aivs;( t2umxm3ny1om e fetl() rrrumont1alxniieils a emuvp (4aeeoxr3iy1lp  aieols  exrxm3iu4apeelfesat) rur( oot4apto f3iasfa uln p;()tleomr3iy1fpD  u ols) rxrim3no1aleemfci s a2umxmpoo4texomfetys mDean s;t0 rtrxocta1fptelieo;s)trur(o3oy4ape mnviasfa2um( o;o0aptniieiydfsDem(vpn(0tetnif3ty1lpD aies;t0sexoiopiu1ap nmnvs s)srtaxm ;u0tet mi3ilsla umnmpn()arxoxr3iotla eli ilt0trxrirpoodap nlfcilt)s2tmu o;u0tee  ieiydlm2uln o (4texnio totopD  uvs t0t2tm(o ny1llen iesas srrr(m ot1alt  fciytfsDemumo t0altnxr3ta1om  lneol(0texo(rpoo1lltelnetat) Drrum ;o4optnmieiyd aDranmsnt) rxnxo oa1lpte nes ()trtoxm3iu4lm nmfci sfsDrrumooo4apeo o3tatla ea(vs;t0texoxo tytoate i i;s)srumirpiodaptn ieil(farrau o;t4optoifcilt m uluvp;u)tlxnmr3tatfaDrai s t)t2trxopno4ape  fviltfs2rr(m ot0tet mociyslm ulumo;() ltrxfctodop rau o (0srxr(opio1lmenmict (fs2rmumpoo1aeto ociyd a2ra(vo;u4trxnmf3ty1fp e nvi;s0s2tr(m nu1ol e ictat)sDurxmo;u0tltn fciyslm2umnmo;t4 rxrmf3oa1fmDe u ol(0 2toimpno4lp emneil( arumxrpno1oeeo ieild s ulu p u)teerxf iotlpDeanes;t0seurirpoudlpe lfeslsf rumur ou1tpen f3tas m ua(vpnt)tetnxfciytfaDe nes () 2uoxrpoydaptemfct s)sDrrxr nt1opxo i3iysls2ua(vsnu0altniociydlm  li o t0truoio3ou4lm  mnct t)s2trxro;u1alen f3ilt aDul( pnu)aeermfciydop  anei ()s2xoxo3oydaptnlicsa(  Drrxroot0aptn o3tyd a ra(vp u) exnio3oatom eln sl( t2tmio ny1al e fvtls  2trxmooo4openiictatfs em( p;()aexrio totfmDelu i (0sruriopiy4lmenmfvtasfsrtruront0tee iocilt s2ulump;t0tetnmf3ia1lmtranvi;t0setr(m iodlptn fcil( a2trx onu4aeto o3ils s rln s u4teeomo3tadfat au il()texoimpnudlpe lneilt a2rmurpnt4texo ociasls2rmnmo;t4aexnio iadlpDr nvo;s)sexrxopoodamtnmnvtas srrm( o;o1aeeomi3iltfsDel(ms (0tetoxf oo1fatranes s0 euo(r nudalenmici (farrr( p;u0aeeo ocilt m eanvp;t0altoxr to1omDelieo;t0s2uo(opiudapenmivsat  2umx p;u0oetn fciadfaDeauvs;t0 reoxf3ta1oat  neils)t2trim ny4om  lnvil( sDuaxmo;u1tpxoifeiytlm2rm(vs;t4tetomo oatopD aueo () rtrxmpio1ame mivsls)a2tr(m ;o0olxo iciatlm2elu p (4 rxnxo tydom eaieolt s2xoio nu1lpt liesa(  2ur( ont1aet  ocias m rluvo;t0arxrxrcta1om eaies;(0s2xoxr3no4lmtelivslt sDumx  ou4opto f3iat aDumnmp u0 rermf3iotoa e ueo t0 rumxm no4lm e netls srumur no0olenmo3iyd a rm(msnt4trenxo3ty1lateaivs ( seurim3oydap emicia() ruaxront0oleniociat m2elnvs (4aetnmf ia1lpDr ieil( s2uoio oudom elfvsas)aDumxrp;o1opxnifeild sDraumonu)alxoxf3iotop eauvi;s  rxoirpoodlmenlnvt s)aDurxr nt4opxo f3ilsls2em( o u4tetnio oadfm  liei s)tetrio io1oltnmnvslt  Drau  ou0aleo oeiydlmDul( p t0tlermfcoo1lp   n o;s)seumirpio1om  lnet s)srtrurpoo4teeoifcilslm um(mp;()alxnmr iatop elnvi;s  exoim nu1om  mfcsas)arrrumonu4tltn fciytlaDulnvsnt0texomo oatomte nvo;()trxoir3oo4op  lfcs ()arrrxront0optnmfcils mDemuvont)aleniociotfpt ln ilt0seuoxr nydomenlnetat)a2ua(r ;o1opt  o3ildfm el(msnu)alerir3iy1lpt aieo;t0 2trio oo1lmeelivtlt)a2urx pou4olto feils a2emn pn()tlenif oydomtrluei;(0setmim3nodlptemfvtat) Duaurooo0oeeo ictad sDemnvo;t4trenif3tydopteanvolt)s2to(o nu1lmeemnesls) Drrxmpot4aet mi3tytfs2uau s u)trtrmo oa1fpt  ieo s)teur(r nu1ll n fesa(f Drmumpnu0tpenio3tytls eaums t0 exniocoy1faDeli il( srtoxopiodope mnci (fa2umu  no1tlt if3tydla rmuvs;(0tleniociotfp rau o;( t2uo(o3nu4lle mictas) 2rm( o;o4apx ioetldlm2eanmo;t4trxnir3tatfmDe i s;(0seur(r no4lltemnct t)s2tr(m nt1tlxnmfciadfsDumnmp ()artnxo iatla eaivo;s s2tr(m ny4lm nmiesatf 2tmxrpot1opeomietld s2eau on(0teeoircto1laDe i o;() euoim iodomt mfvs (fa2tmumpnt0aetnmociydfa rlu s;t0 rxnmo3iatlatr n s;s0srxoxm3iodlmt mfes t  Dtrxmpnt4oex iietyt s um( p u0tlenmf3ty1fmDraneolt0trxmxr3oo4openlivsltfs2rmxm no0alxnif3ildls2uanmpn()aexoxo iytlpD au s;t)s2um(r3ny4op nmfvs s  rtax pno4aleomo3ildlm emu snt)artrmocto1opteauvs;s0texoxo iy4op nlictatfa2um(mp;t0apeo feildfaDul(mp;t4aeeoxocty1lmD  u ilt)srtr(o3io4am n iesasf Dtmxro;o0apx  fetas m ua(mo;t) etoio todfptr nvo s  exoir nudom nmnvtls aDrmxmooo0tpxoioctytfs rm( pn(0alerir ty1oate u o;t  rto(m3io4lmt lfeslt) Dtmurpoo1oeeo f3ildfs rm( snt)trtomr oo1fp rau ol(0srtmim nu4olee iciasf Dtau  ;t4tex  f3ilt s2ranmo;()tltoir3ootfpt lueils)sruoir3iy1am n nct t)s2rmurpno4oleoif3iydlmDra(ms (4 eerir3tytfmDeauvo;(0trxoimpiu1olt mnvs s srrrur no0tlxnioctld a eaumsnt4 rtnifcoa1fa rlivils srxm(r3iudlpe lnct t)sDtrum oo1tlxomietls aDemnmp;(4 ltnmr to1lmt lnvs (0 2trir3oodlm n fes t) rumum oo0olxnmieiasfm2rlnvon(4 renif oytomDrluvo (0 eumxopiy1ale mnesa( aDtrxmpot4altniieiltla2eln o u0 renmrcoy1laDean ilt)texo(mpiodolt mfciatfa2tr(mo;u4teenmfetyslm2rmnvs;t0aeermf oo1lm ranvo;s) 2tmxo oo1al emnetltf Dum(m ;o4teeo octas m eanvs t0trtrmr3tytlm   uesls0trxr(rpou1llee fvt t)srumxm ;o0oex iocilsfs2eluvp;u0altoioctatfa eaiesl(0t2umxopnu4ol n iet s) Drrx  ;o0alxomictatfaDra( o;t4 rtnxo ta1lat lnes s)t2xm(o oy4ole livi ()srtmurp;u0optn fctadlsDra(ms;t0 eerxo tydfa elieo;(0 eurxr ou4olee icils) 2urumoou4tee  ieias s2rmums u0 etrifctytopD lnvolt  2tmim oo4lmt mfcilt  ruau oou4oleo ieiytlm rl( p;()aeenio3tadoaD  n o;()trur(rpny4omt mnctat)srurur oo4oetnif3ild a2ea(vo;u) lenio3oatomD aieo t0s2ur(m3nu1llt mfcsas)s2uau  ;u1teenii3tltfaDel( p;(4 lxomocoo1fmteauei t0s2trxrpoy4om   fcsls a2trx ont0altnif3tlt a2rmnvs;t0alxrxrciadlmD lnvs (  rxrxr nodap  mnvi t aDrrur ot4olenmfciydfmDua(monu)aeenif oytfat anei ()setmxo iodalt  fci s sruaxmpnt4oexnmfetysla ra( onu4tlxrxo3oy1fat ln il( trto(r3oo1ome  fei s aDur(moot0oeeo i3tltla2um(mp u) lerxo3iydlaDranvil(0truoim3oydop   ieils)sruaxmo;t4aexo o3iyd s2uanvo (0 renxo3ia1om rluvo;t0sruo(mpiudope  nctatf rurxmo;u0tpx ifetltfs elu s;(0 etnmf3tytlat  ivo;t trxr(o ny4ol e fes sf rtmxrp;u1tleoioetysfm2emumpnu4teenio ty1lptraneo s  etoxmpnydlpenliciatfs2taxmpou0tltn ociytfs uanmont)alxnxf3tatfmD  nes;(0 rur(rpiu1lmeemietas  2ta(r no4teto f3iasla eln s;t) etnxf3iydlmt  nvi t t2xrio no1om n fesls a2uru p;t0aetnmoctat s2eanvs;u0alenircio1oaDeluei;t0sexmxr iu4ol e fci t  Drruront0aexn fciydlsDeaumont0tleomo oatfa r n s;t)trum(mpiu4am emiei ()s2rmu  nu1tpxnif3iysfm2umu p t0aeenxo3ia1fmD lnvs;t  rtoxm3nodom n nvs tf 2raxr oo0opxo o3tadfmDul(mon(4tetomr ootopteaieo;( t2uoio oo4amenlfci s)srurxm ;u4tle miciydfsDum(vo t) ltoxf oodlmtraues ()tetrim3oo1al nlict s  rtaump;o4ope  fciydfa2ul(mont0 eeomo iydla  luvo t s2uo(o ou1ameemncsasfaDtrxmpnu0teenmi3tadls2ran s;(4alenxo3todlpt  nesls) rtm(m3nudop emics () rtrum ;t4aex ifcias mDeauvp t0artnio iydla elnvsls trxo(m oo1ape mnctlt)s2trxr nu4tltomoctys s eanvont4 exoxr3todfpt  uvo t  rtmir3iy4lpee ict tfaDrm(mpnu0tptnmfeiysfa2rlu o;t0 lenxfcoa1opDeai i t)s2xmxo oo4om e fvtas s2tmx  no4alx moeilslmDemn o u4alxrmfcoatoptelnesl(  rur(r iodllenmfvi ( sDta(mpot1tlt  fcildfs2eanvsnu)tleoxocoo1fatelu i s0t2umio3iy1ol elivs tfarurum ;t0ale ii3tldfaDumnvp (4aeeomf3oo1oaDrau slt0srur(r nydal elfesatfs2rr(mpoo4oltnmi3tadfs2ulumo ()aetnxrciadoatean il(0texrxm ou4am nlfvsls)arra(mpot1tet iocilsla ua( p;t)artrifciytoa   i o t) 2urio3ou4ole mivils)sDra( pou1oexomo3iyd mDeluvo;u4 rtrxfcta1lmtr u s;()setr(rpnydolt livsltfa2rrxro;u1tpenmfcild aDua(vp t) ltrxrcio1omt aueols s2uriopnydap nmnct s srrrump;o0opx  ocildfmDrlnvp;u) eenir3oadfa  au s s0t2tmxo no4om emfesat arrmu pno4tptomociad sDrlnvsn(0 ltnioctotlpDeanvslt0trxoir3oodamt  nvtl() Dra( poo4altnmo3tysfaDrlnvpn(0 etoir oatfpD aneo t)s2tmxm3io4lpt mivsa(fa2rrurp;t1tle iictysfsDrl(vs u)tltomf3iy1om e u i s)srxo(rpio4ale mncsls arrax oou1tpeomfciatfm2rm( p;t0trxnxf3iy1la rln s;()t2umirpiu4lmenlncsa()sDtm(m nu0apenmf3ild mDemuvpnu4 rxnircoydfp eai il()t2xrimpoodam nmietas)s2urump;t4aetnmi3tydfmDemu pn() rtnif3oytoa rli ilt)t2umio3oudap e ics sfs2uaxmp;t4oleomiciasls2ulumpnu4 rtnioctytomD  uvil(  rtrxo oo1lme mivsa( arta(monu0alxn oetltls rmu p ()texnirctadoa  ai i;s) etmim nudll emivs t  Draxmo;o0tpxoiocilt m2ua(mo u) etrio3iotfaDe nvs s  rxm(o iudalenlfcsls artm( ont4tetn ieias a uaums;t4teermo oo1lmt  n sl( srtm(opoy1lltelics s aDtru poo0tptomi3iytls2ul( p;u0 lxoifcootfaDraneils0t2xrim nudame mfvil( aDtr(mooo4oet iieiysfa uln p (4tlxnio tadopDelieo s0t2umxr iudlmeelfciltfa2trx  ou4apx  octlsfm rln o u4trtomo oa1fm  livilt  2uo(o iydlp emnvsl(fsDtax oou4apen o3iys mDul(vp u4 lxomr3oytomt lnei;s)sruoxopiudal  liviltf rtrxrooo0aee mi3iytlm umumpnu4texrio3ta1fmt  uvs () 2toxm3ny4lmeelict s)sDrm( o;u0alen o3tldfsDuau o (0altrxfcoodfa rauvolt) rxr(mpnydol nlncsls srtrurp;t4oetn fctlsla2uanvo;(4 rtrmr3oa1faDelnes;t)seuo(opno1lmtemivs ()a2umumpnu1apeomf3iatla2em(vo t4aetrxr3io1om   nvs s0seumiopoudam   ict ()sDrax o;t1tlxo fciasfm umu p;u4tlxomf iotfmD  neo t)srxm(r3iu4omt mfesat s2um( oou0tee mieiyt a2raumsn(4teerio oo1oat aieil( texoxrpiodopeeliei ()a2raxm no4apeoiociat s2umnmsnt0trtrif oo1fpte uvslt) ruo(m oy1alt mfesat  Drm(  no1apeoiictadlsDranvs;()alxrxo3oodopteai i;(0tetr(r3iu1amt mici tfsDtm(rooo0alto f3iytla uanvs;u4aexnir iodlat an i;s)seuo(m3iudom eliet ()a2rru poo4tet io3tlt a2uan sn(4tltoio3oy1op e uvils)s2trir nudolt miesas  2umxro;t1aexn f3tldfs eaumon(4tlxoirciodlm e ivol()truoir iydlp elfvi (fsDur(  nu1tptnmi3iad s rauvs;t4teermociatoatr n s (  eumir oy4omtnmnviat)arraur oo0tet  f3tatfm ua(mo;u)teenif3ty1oatrlivo ( teto(o3iy1alee iesatf rur(  nu4oet  oetltlsDemnmont4artomo3iadom eai i;t  etoio3nodamtnmnvtlsfs2rr( ooo4tex io3ias s eau s t0artoifcoytfmt liesls0tetmxr no1ll n fvi (  rraxmo;o0tpxnioeilt s umn o;()arxrmociy1omte nei (  exmim3iy4om  miei (fa2umu pnu0apenmoeiytla2ra( ont)trtnmo tydoateliei ()srxr(rpnydll  mfctlsf Dtau  ;t1tetn octaslm2emu o;u) eeoxo iydomtean i (0trurim io4ale lfes s  ruaxro;o1tpeo ietltfsDul(ms (0 rxnxociatlp e nvol( t2uo(opoodlmt lnvs (fsDtrxr ot4apenii3iadls em( p;t) lenmo3oodom eluvolt)t2trim nodlltelfei sfaDraur ot1oltn fctat a rln p;u4areriocto1fpt lues t trxoxopio1omee nvt tfartau pno1tpe mfciydfs2umnmsnu4treoxfctotoa elnes;s0 exoxm3ou1ll elivt (f 2rr( p;o4oetn f3tadla rl(vp u0 rtoxf3tatoaDrai ilt)texm(rpoodllt mfvias)a2urxm ;u4oeenmietysfs2uau p;t4arxrir tadfmt  nvils0trumxo3oydopt micilsfsrrrxmoot1oetoio3iydls umnvs u) rxnio tytomD aiesls srxrxmpoy1ome  ieils) Dtruroou4aexoioctldls2ranmont4aetomr to1opte u il(0 eur(r oydolenlfvs ( a2rrxm nu1tptn ictlt sDem(monu)trtomf io1op ran ols0srtmio nu1ol nlnviat s2umurooo4oetn octysfm2ran p;t)trtrmr oytomte uvsl() 2xoio3oudlle  icilsfarurxrpnu0aexoioetlsfaDumuvs t)trermo oytfmD lu s;( tetoir oy1ale lfviasfarrr(m nt4olx moctatfsDul(vp;u0aeenxoctytfatranvi;t  2xo(m3iodomen nvils  Dtrx  no0tleomictlsfa em( onu4 etnmocty1fm r ies;t  eto(opiu4al nlfctasfa2ua( o;t4opeoiociad s2em( s (0tltnmo oydfmDraneilt trxrxm oy4optemnetl()aDum(rpou1texnifetyt s2eanvo;()texnxf tytopD ai s s)tetmxo ou1am nlivta(  2umu pno4tlxomf3tldlmDuauvo t)aetniocoa1lmt ai il()s2xoxrpno1amen fet t srtm(mo;o1aptn f3iatls rlnvo (0altoio oy1latrauvs (0srumxopio4ole lies tf Dtrx ono0oexomieilslmDem( pnt)treoxfciodomDrluesl( srumxopiudlpt lieia( srurumooo0tptoiocildlsDuanmp;u)trtoxrctotoa e ueol(0seur(opou1lptelfei s  Drmxmoou1oexniieiys mDel(vp u0 eeoir3oydlat au s;t0tetr(m io4omtnmnctlt a2umum ;t4oetn feiyd m2el(vsnt0 lxnio3totoa   nvol(0 2tm(r3ny1op emivs t s2ra( pnu1tpe mf3iytfmDuaumo u) rtnmr oadopDean il(  exrir oo4ll nlfvil( a2rru  nu1oex if3tydls ua(vs;u) lerio oo1fmtelivi s  2uoxr iy1lm n iei tfaDta(mont1opxomo3tld aDrm(mo (4tltrxo oa1oa e i s;s  rumxr iy1lp n ivi s) ruru ooo1opt if3iyslm umn sn(4 eermfcoydlaDeau i s0srxriopno1ap n nes tfaDurxrpoo0tptoioetadlm2uln s;u4teenmf iatfaDe u i;(  2xoxr3oodal nlivilsfs2uru  ou4aeeniiciydfm uau pnt0teenio3oydoa elnei s)texoimpnudop nmfcsa(f ruaxroot0altnmoctytlmDrmump t) eerif3ty1lmteaivo;t t2xoirpiu1apt lietas  rrru pno4tleniicias m2emnvo t4altrxr oatoaDelivols)s2tm(o ny1apte nci tfarrm( ont1tlxo o3iadlaDrm( o () lerxr3iadlptelneo;s0trto(m3ou1lmtemneta() rraxro;o0tltnmoeiasfsDuau p;t0alxnxo tadlat  u i;t setrir oo4lm nlivtas s2rr( pot4apto fctat s uauvon()altrmo io1fm rln slt0t2tmxm io1opte fvslt  rra( ooo1aleoii3iatla rm(msnt4 leoio ia1oaDr nvi;t0 exoxrpnu1oleemfvtas  Dtaur ou0apx  ociatfm2el(vsn(0 lxnxf oatfp eanvs;t)srumxrpiu4oltn fcilsfsDum( o;o4tptoio3iad aDul(vsn(4arxnmociadlp  an o ()s2xoir3nu4lmenlncil()sDtr( pou4aeenmi3tls mDran o;t0altnxf iodlpDe u ilt0s2toxo3oo1op nmfcsat)s2taxro;u1alxoii3iat m uanmo;t0alermrctytlmtraueo s) exoxopou1am  lfcia()srrmum oo0aeto feiydfsDumu p t) ltnxr3iotfptr u s;t s2xoxrpno4lpenmiei (f 2tmxroou0oltnii3iydfm2el(mp;u)tleoif3oa1fpte uei t)s2urimpiydal nmnctas)s2tr(r ;u1aee mo3iasfsDrm( sn()aetoio io1faDeaiei (0texrir nudoptnmnvta( a2urur nt1aleomoeiytfaDrl( p;t0 etnmocoytlate uvi;t tetmxrpnydal  mfcsltfartmx oot0alxnifetltla2rmu p;(0aexrir3io1op elnes t  rxo(rpou4ol nmfvtlsfs2rr( o;t1aetoii3tatla2umuvo;u4tltoifcia1lp rliei;s  2xmio3io4lltnlnesa(  2tax oou1tpe  ieilslm elnvpnt0aeerio to1faDr i sl() 2uoim3nudoltnmncslsfaDrm(mont1aeto o3iadla2rmu s (0 eenmfcoodfpDrauvi;() eurxr ou1omenmneiat srtaum ;o1tex ioetytfm rmuvs;(4artrxr ta1lm  ln s t) 2tmim3oydopee fetl( s2rm(moot1aet iociatlaDean o t0tlenxr tatopteaivo;t) 2uo(r3iodolenmfetasfartru ont4tltoiietadla ean p;(4arenxr oy1fptranvi ()trurxrpnu4am nlieil(  2rru ooo0oexnmoctadls2ran s u)alxrxf iy1fm   uesl(0t2um(o3ny4lmee iesatfa2tr(mpou1tle  ictlsfsDrmnmo ()aetrio totom e ivi;( setmio iudamt  nctat aDuaurpno1aetnii3ilt aDul(vo (0tltomf ia1lmte uvsl() 2toxr3no4ol elfvi tfsDuaurp;t4oeeoii3iyd sDelumo;u4trtomr3iadomDelivols  etm(r oodlpt lnesasfa2tmxmpno1olt moctls m2rl(vonu) rtoif3io1lp raivs ( srumxopiydllte nvsltf Dta(  oo4teeniietld aDum(mp u0 reomo3ty1lmtraiei;t0sexr(mpoy4ap emietas sDtr(mpoo0tex ii3tytfaDrm( s u0 exnxo todom rai s;s  etr(m iu1lp elnvt t  Dtaxmo;o4optoif3ilsls2rluvpn(0trtrir tytoptr n olt teuoir3nydole miviasfaDumuronu1oltnmiciad a2em(vo;u0 rxomocoodomDean sls)trxrxo3nudom n fvs (  2tm( o;u4aexo o3iydfaDemu o;u) ltnxrctodopt anvi s0 exm(o3oo1aptemfcs t  2rmurp;t4oeenmfciydfsDeln o (4 exomo3oadfmDeliei;t)trxoxo3no4lp  lneias  Dta(rpoo1ape io3ilt a2ulu snt4 etnxr oadfatr n ils0 2tr(opoodomte fesa(faDrrum no1apenioetyslm2ua(ms u4altoxo io1lpt  uei;t)t2urxr3nudllen fci s arraxmonu0alxn i3iadlsDelnmp t0 rerxocoodla eanes;s) exrir oydapt mfeta()aDuax oou4opxo iciatfmDrl(vo t0tlxrif iotlat lneil(0 ruo(m oydlm   fcsls) 2rrxmpnu0oex mieiatls el(ms (0 renircoatom elnei t  rxoxr3no1op nlfvt s srraxr ;o0apxo fetadfm ea(vo u0aetnxo ootom   nes t)trumxrpny1ap n iesl(f 2ur(r ;o1tpen iciyslsDem(vp (4aeeoif totlmDelnesl(0 exo(r no4al n iet ()sDrr(r oo1tlenmoeiyd aDrluvon(0texnmr3oadfptraiesls)s2trxo3oo1omtelivias srtr( o;o1tet moetadfa rm(mpnu0tlxrxrcty1lpD luvslt t2xmio3oo1ll nlfetl() 2ta(rp;t4tlxomf3iad a rau o u4aexnxf3to1oat lueilt)srxo(opny1am  mfvil(fa2tax ont0tetnmoctltfs ul(vp t4arxnxfcio1lm  liesls0 ruo(m nydlmeemnviatf ruaum ou0ape  oeiasfmDemnmsnu0teenif tadfm rauvo ()trurxopou1om emnvtasf 2tmu  ot0olxoiiciad aDelu s;t)altomf3todla r neo (0sexrxo3iu1am e netltfartau p;t4opeo octys sDulnmo (0texnio3totfa  au i;( sruoxrpnydllenlivsat)a2ta(rpot0tlto i3tlt m2rmu p t4trxnircty1fa  luvs;(0t2tm(rpiy4apte iesas)arur(roou1openmfcildfa2ua(vsn()texoircty1fp eau s;()t2xoxmpno1ol nmfvtat)artaur ou4ale ii3tysfs ea( o;() rxrif3io1omt anvolt0seumxopio4opt mnvi (fsrurumpot1aetniiciydls um(mo ()tetrxr todlpte nvs t) etoxrpny4op nlncil(  rur(rp;u0aptnmfciytls umnvpnt0 eermo io1fa  livo;t0srumir3iydapenlfvtat sDumxr ot4opeo fetltlmDumuvp;(4 rtrxf3iadopDelueil(0 rxmxo io4altemfvi ( aDtmurpou0aeen oetadls uln p;t4treomoctotfmD  n il(0 etoimpiodll elnctatfsrtr(mp;t4tpxn f3iltfs2umnvo;()aexrxocia1lp r n ols)t2urirpoy4lltelnet ()a2rm(mo;o0altomi3iytls rlumonu0texoxrcoytfpDrauvo () etmim iu1op  lfvt s a2rmu o;o4apx ioeiaslm2uau pnu) leoxr3oy1om eln s s texmio oudolte fviltf rrr(rpoo0tetnii3tlslmDrmnvs (4 rerio3io1latrau i t)seuo(r no1optnmicil() 2raum nu0alen f3ias m2ua(ms;(4aleoxo3oy1lmt aneil( sexrxmpnodamtemict s) rrmumonu0tlenioeiydfm2emnmpn() lxnmf ootfmt aneo t0srurir3iudopt miet sf 2taxr ;t1openmf3tldfa2uln ont0aetnmr3io1lpDe i i t)seuo(o3oy1op n fvtl( a2tmxmont0tlxomo3ildfa rlnvsn(4 lenmr oatomt luvs;( t2trirpiudamte fcslsf Duaxm nt1tex iociydfs2el( p;u)trenif3oo1op   u il()seumxr3iydlptn ictas  Dtaur ot0ale  fetys mDua(msn(4 ltrif tydfmteai o ()texr(o nodopenmietl( sruau ooo1tpxomi3iydlmDumnvp u0alxnirciotfmte n i;s)trxmxm nodlm nmfet ( srtr(ro;u4olenifcildls2rmnvp (0 exnxoctatop rlu i;t s2uoxrpou1ll   iet s sDumxrp;t4aeenmocildlm2emuvp;u0 rtrxf iytop raues;s0 exo(m3iudap  lnetlt)a2rm(roou1olxo f3tasfm2rmuvon()texnif to1lm rau il(0seuoim no4om emfeia( aDua( onu0tpx ifeiasfs ranmo;(4trenxf totlmt ln i (0t2xoxo3iu1op n ictlt srur(r oo4oeeoioeild sDelnmo t0tetrxfctadfat aiei;(0 2tr(o3oy4om elivia(f 2trxr ;t0teenioetlsla2emu o t)tlxomrciatfpDrluvi;s)tetmim oy1lpenmfetl(fsrum( oou0apxnmietad a umn pnu4artrmr ootomt lu o t)s2toxr3oudape micsat aDrmxrpou1oex  feiltlmDuan s;u)artrxf oatoateanvils)tetm(r oo4apee ivs (faDrm(root0tleoio3iysfs ranmpn() rxrifciadlpDe nvo;s) exr(m iy1olenmnesat a2ua(rpou1aetnmi3iytls2rluvpnt) exomocoydoa   n i ( t2xrim3iydamtemietl( a2umumont1oet mfeiasfa2ua(msnt)texrmr iotfat  ies ()trxm(r3io4lmeelivt t)srrax p;o0tle io3tatla2el( o;u0 ltoifctodomDe u olt setoir oo1amt  fei tf 2raumonu4tpeo f3iadlaDua(vo;()texrmf3tadoptr i s s0trxr(m oudoptelfetlsfs2trum ;u4oexomicild a um( snt) ltrmo3iydla   nes t)t2tmirpnodamenmnes s srumumoot0oexomo3iytfmDrauvo;t) rxrifcto1fpD lnei t0texmirpiodol nmfes s)sDurxmp;t0aee if3ilsfa rlnmsn() exnxo iy1optelivs;( srurxopno4amtn nvt (  rtr(r nu0ope iieildfs um(vo;u)artrmo3iytom  li o;t) 2uoir oy1amen fesl(fa2umxmpou1texn fciatlm el( o;(0trenmf iadfmDelnvo s) rxoxrpoydlptnmicsat aDuaumooo4aet iiciyt sDulnvpn(0aexomo iy1fmD lieolt0sexmxopiu1amtnlfctls a2raum nu4teenii3iydfs2rlnvo;()aetrio3oo1omt an o s setmxm ou4omeelfvtlsf rtrxr ou1texnmictydfs emuvo;u0trtnxf3oadlp   n o;s0setoxm oo1lm elfetltfaDumxm no1tlx mf3iasls ua(monu)arxrio3iatfm rlnvs () euoxmpou4op elivs s)aDururpou1tpen octyslm umnvp;(0 ltrxr iytlaDeaneo ()srxm(mpny1lmte nctatfs2tmu  nu4oltoiicilsfaDelumo u4 lxoifcootfptean slt  2xr(r nodal emiet t)srrm( ont0tltn oeiyt aDrln ont)trxoxfciatlm e nvsl( srxmxm no1am eliciat artrum ;t4ape ii3tas m2ea(vo u0 lerxrciytlm elivo;(0trtrirpno4alen ici t)sDrauroot0texnmietlsla2ua(ms;t0treomr3oo1fate nvols)trum(r no1lm e fcia()s2rrxroot0tex mociyt aDem( o;u) rxrmf tatfp raneslt)teur(r3oy4am   fviltfaDuaxrp;u0alt mf3iadla2ul( snt)alxoirctodfmtrli i () 2tm(rpiu1lm  livtlt)sDrm( ono1alxoiocils m uluvo;()aeenxocia1oat  iei s trumir3iodoltnmneias)srrrurono0tleo oeiadlmDul(mpnt4artoxf3io1oate uei;s0 rur(o nu4amtelfcilt  rum(ro;u4tee  feilsla ul( s;t0texoxocoodla ran i t s2umiopiy4lp elnvtlt)artaxm nt4oee  ictas s2el(mp u)tetoxoctotfat  n ils)trxrxm no1amte nvsas) rtmxrp;t4tet  ieils m2ea(mpnu) lerif ootop elivs t0srumim3io4om e fei (f 2tmxmoot4tlenifciadfm2rl(mp t)trenio3iadfmDeaieils0seumim nu1am e fci s  Dtr(  ot0alenmoetys m2em(ms;u4arxomr oodlpt ln o s) exmxmpnu4amee fviltfsrtr(mpoo1tet ifeiatla elnmpn(0artoif3oydom ranvil()tetrio3iy1altemfcs sf 2tr(  oo0tltnii3tydfa em(vo ()trxoxr3iotfmtrlneo ()tetr(rpiu1apenmnvtas  Dur( oot0alenmi3ildfa2rmnvp;(0areoxo3oatfatr ieils sexoim no1alen fcia(f 2taur nu4apenmfeiyt sDeln p t0altnmf3oadopD ai slt setriopiydal  lieia(  2rrx  ou0aleo icild m2rlu snu4altrio3iotfp   u il()texmxopoy1ol e fcta()artr(mont4tptnifeiltfs eanvs;u)aeenmo oydlptelu i;(  exmir iy4apeemiet () 2ta(mo;o4texomoctatls emu p;u4 lerif tytomtrlieo (0teumxmpiydom  mncslt)a2ua( oou4ape  ieild sDumn o (0 eenxr3oatop elnvo s)setoxm3no4ole lncs (fsrtr(mont1oexnmoeils a2rmnmo u0tleoifctadfm  luei;()trurxo3oo1llte nct s  rumxrpno1opeo i3iytfm2uanvo;()trenmf3ta1lp eaneo t s2umxo3ou4ale lfvi t  2ta(moot0oet  fetls sDuluvo t)trtoxo3oy1fpD lieo;(0trxrxmpny4lm  micslt aDuaxmpot4apx mfeiltla2emuvpnu4 ltoircoodoaDr n s t0 rxoim3iydlmeemfetat)artmur nt0texomieiyd s2elu o;()arxnxrcoy1lptr ies;s tetoxmpnu4lm  lfvsa( srrax o;o4opxo ietat a ran s t4 eeomo3tydfmteaivsl(0teto(m3iodamen fvtas)sDurur ot4aexomicilsfaDeanmp;t)texoif3oydfa rauvs s)texm(opno1op e nciatfarrr(mo;o1oee moctatfa2rluvs t0 renio io1la ran o (0 eto(o oudlltelfcsl(  Dtax oou0apxomfctad sDul(vp (0 lerxr iy1opDr neolt)s2uoxm3nudoleemivt sfa2trur ;u1olxniociat aDra(ms;u)tleoxrcoydlpD luvo;( t2xrxo3ny1oleemnctls  2rm(rp;u0oetoii3ild sDranmpnt4texrxrcoy1fp rliei;(0seurim3nu4amtemfcslt srrm( pnu0oltn oeiasfaDea(mo;u) lxrir3ootfp e neils0t2um(o oo4lpt lnesa()s2urxm nu0alx  ieilslmDumn s u4texomf oa1optrli i s t2xm(o nodom emncils)srtaurpou1ope moeilsfm2rl( sn()trxomo oydfm   iesl(0trxmxopnydlm n fviasf 2ua(m nu1oltnmiciys mDumnvs u) etoxociotlateluvi s  etoir3oodlpt  nctl( srraumonu1alxo ieias m2umuvs t) reoxo3tatfm e neols s2xoim3ny4opeeliet (f 2tmxrp;o0oleoifeiadlm ua( o () rerxo tydfpDraivs ( s2urirpio4lmeemfcils)a2tau  ot4tpe  ietls s2elnmo u) renio iydlaDrluvs ()t2tmxr3oo4al nlfcil()s2taurp;t0apeomo3tysfa rmuvo;t4 eeomfcoatlatraivi s sruoxm oo1ol n fvilt s2rr( pno0tet ioctysfmDelu p;(4altnxr oodfaDrli o s texoxm no1aptnmnvt (fs2tmxmono4texo octaslmDulnvs (0texoif3ty1op e nvs;s tetoxopoo4llenmfct t  2ra(mpnt0apxomfeiydfs em(vont4aexrmr to1fp eai o;(  ruo(o3iudlpeelivtlt)s2uru poo1apto oeiltfaDel(msn(0altrmo oadopDranvil(0 2uo(r3nu1ap e nei t srtr(rpot4tpx moeiyd a ranmsnt0 exoxf3ty1lptrlivslt sruoimpiu1op elncilsf Dtmxmono0tex mf3iytla uluvo;(0alerio3tadfmtraieo;(0truoxo3iu1amenmivslt srumum nu1aptnio3ias m rm( pnu)teermoctadopDelneolt0s2xmxm3oodomt  nvi (f rraumpot4tptoiici
\ No newline at end of file
@@ -0,0 +1 @@
+n i ()s2toxm oodaltnlnct ( arum(m ot1tlxo feild a rmu s t0tetoir3oodla rai s;s trxrir3nydlleelfetls) rtm(mpnu1aetnif3tltls ulump;t0alxoio3oy1fmDrlivols0 ruoxopiy4llenlicsl(  2uaumono4opxomictysfs el( o u0 eeomrctydomDranvsl(0 rtmxopiy4ap  lfetl(  Dtax pou4aexnioctadla uanvpn(4trtnxr3tatfaDeau s () 2trxm3iy4lmenlfct t)arrr( o;u0oexoiocilsla2ranvp u0trxomo3to1opDelnvo ( seumxmpio4oltnlivs s  Draxr ;t1apx io3tatlmDra(vont) etrxo3totfa raiei s0srtmio oy1al  lfct (  2ta( oot4olxomfeiatfa2umuvo;u0 rxnmoctatfm r ieo;t sexr(mpnodalenlivsasf rum(r ;u1ape  octlsfm rl(mpn(4arxrio oydfmDeauvs;s0 exoim iy4opte ieilsfarraumpnt4tetnifeilt a2uauvo u0tleoxr oatfa eai i (  rumxr3iu1op   nvilt) Dur( ono1opeomfciydfs2uaumo;u4arerxr iy1faDeanvol()teur(r oy4aleemnvs (fa2umxro;u1aexnmfeiys aDem(mpn(0arxrxf to1fmDraues (0 2xr(o no4lpt lncs ()aDrrum oo4altnio3iatfs2um( pnt0artnioctatfm rlneol(0 exmim oudlm emieiat) 2umxr ;o1oeen oetltlaDuau s;() rerxfcto1oaDe u s;(  ruoxr3nydamtelieil( sDrr(mp;o0apeoifeiytfa um( ont4arxrir iotlmD  uvo t)s2uoxo3iu4op elfcs t a2tmx ooo4oetoiieiatla2ranvpnu)tlxnmo totfptr uvo t trxrxr nu1lp   fvtl( aDurum no4apxnmieiltfs2rmumo ()tltnmo3tytom elnei;( setrxo3ou4ll nmieias a2um( pou0ope iiciaslm2em( o;t0trenxr ty1omDr uvs t0 rtriopoo1ole mfvtlsfa2tr(mpot1tee mo3iydfa rl( o (4aeerirciytop r nvi () rurxo3no4amt lnesa(f Dtmum ;u0oee mf3tys a2uau ont4 lxnmr3todlpDrlu ol(0srto(opnydape  nvi t)a2tru  nu1aee mf3iytls rmnmo;(0aetnxr3iytlptrliesl()texrxm3ny4lpen ivt (f 2rru ooo4aeen fetydlsDea(mo;u) eenif3tydla  aivil() exoio oo1ope  icsas  2rrxmoou1olxniocilt sDra(vo;u)texnmr iydopD  n o s  2trio3oy1aptn fctatfsrra(moou1tpeoiiciatfmDemumpnt4trtnmo oydomDeluesls srtr(rpnydoltelivsat arrr( ono0optoiiciys s rlnmo t)aetoio3iy1lmteli i;t0 etoxmpou4amtelncsas)a2ur(  ou4tptnioetlsfa2ranvpnt4aexrxr3oo1lmDe i i t trtmiopou1lptelfet t aDuaumo;u0tpt  oetatfa2rl(monu) lxnxf3oa1om rlnes;()s2tm(r3oy1op emictat arumxmo;u1opeo ieiasls eln p;u4 eeomrcoadlm e uvo;(  eurim3iu1ll  mfvslt a2uaxrpno4olx mi3ias m emnvo u0arxnxf io1oaD  ivi ( seum(o no4lpeemncsa(fsrumx  ot0teeomi3tasla ulnvp t0trerio io1op elivilt0s2tr(rpny1ap e fvtl()aDraum oo4tle mieild m umums;(4 rxomrctodfmt livi t) eum(opiy4lm  mieta(f 2um(  nt0tleoii3iys a ua(monu) etnxo totoat lu s s  eumim nodlle mneia()aDraxm ;t4altomfeiyd a2rm( sn()trerif iy1opt auvols)sexrxr io1lmtn nes tf Dur( p;t1aleoiieiltfa uanvs u0tlxrxoctatfpDrlueslt)srtr(r nu1lpenlivsas aDurxrp;t4apen fetld a umn p;u) eeomf oatoaDr u sls sexr(m3iodlme lict ()arurxrooo1apx  oeiytls2umump (4 exoxrcty1op rlivolt0 rxo(m nydalte nci (farum(  ou1alx  f3iyd m rluvo (0arerif iytlatrlu i;()srtm(opio4alt mncsl()artmxroot4opxoifeiadfmDem(vp;t)aetrmfctodlaD an i;t)t2xmxr3oy4lm e ncsls)aDtmu p;u0tltoio3iytfm elnmsnu4altomfciatfa rluei;s0trtoxopny1ll elnvt sfsDtrxm ;t4aee mfciytfm eaumo u4 ltnxoctotlp ean o s seuoiopnodapee nvslt) rta(r nt4olen ocildfs2umumsn() ltomocoo1fa rlu i;(0srxoio oudlp  lneiat a2uaxmoou4oetoiociadfs rlnmo;u)aeenif3ia1omDean olt0t2uo(m3nu1opte ivtlt)a2rr(mp;o4olx ioeiyt m umuvon(4tlxrirciotoaDeauei;t  ruoim nodaltn ics ()a2rrx  no1tex iictysfaDra(vont4 etoxo3totfpt  ueol(0s2umio oo1lp n ieilt)aruau  no0aetnmoctldlmDemuvonu0arenxf tydop e ivo t t2ur(o3nodom  lfvi t)aDtmum ;u1optniicils s uaumo u)aetrif3to1fatelnvi;s)s2umirpiy1lptn ies s a2tmump;t0alenmiciadls rmuvp t0teermfciadopDrluesls  exo(mpou1llenlies (  rumxr ou0aetoii3iad a uln p;t) ltrif ia1fptrlies t0trum(mpnu1omtnmfvi (fsrua(rooo1aet mo3tat a rl( pn(0aexoioctatlm  aueils truriopnu1ale mies sfs2tax ooo0alx mo3ias s rmu onu)aetniocoodlpt aivo (0 eur(mpnu1lpenmieil(fs2ta(rpot1aet  feiys m2uauvon(4 rxoxociadlp e ueslt0 eurxm3nudopee ieia(f Dur(rpnu1tleoif3ildla eluvpn()trxnir3oydfp elies (0sruoim nudopenmfctat)a2rrx  ;o0oetn feias a emn s;()arenio3oo1la   nvslt0 rxmxr3nu4ap e nes ( aDta( ont0apen ieiysfa2umnmp u4trxrmrctydfpD luvs;()s2xmxmpiydal  miei t) Dum(  ;o4aetn fctlslmDemnmp t4altrmo3tytfat ln ol(  exm(rpiu4altnmnvt sfartrx pnt1tleoiictat s em( o ()altomf3iadfpD  n il( teumio3nydlmt lnet t) rtm(rooo4tltomo3tyd s uau snu4tetoxociytopDrlnes s)setriopiu1lptn fetasf rtm(m ;u4oltomfeiat m2ulu o;t)aexnmrciydop  aivo s) exmxm iu1op eliet sf 2raxmono4oltoiiciydls2rm(vp;() rtrir oa1opt livs;s0s2trxrpiodoptelfetltfartmxmooo1open feiltlaDeauvont0 etrio oytopt lies;(0texm(m3nudolt  ieiatfaDra(  nu4alt ifeiadlm2rl(monu4tlxoio oatfm eai s;s)truoim oodlme mivtat a2rau poo1aptnii3ias mDranvs;(4areoxo oo1lat  nei;(0seuoio3io1olt lnci tf 2rmxrpno0aetoif3iltfs2rl(vsnt4 rtrir iotlmDraieilt0 2xr(m3nudoltelneias arraxmpno1aptomiciysla ea(vs;u4trenxr3oydomtean i ( s2urxm ny4apeelnvslsfsDurumooo4apt ifciltfmDul(msn(4tlermo3ia1fpt auei;s s2uo(rpiu1lp nlnetas a2trumpnu1tpx  feiltfs2uluvs u4 ltrmfciy1la rluvi;s0s2toxm3oudomeelict (  2ururpoo4tpt ioeils s2rauvont0alenmfcoodfa eaieol()t2ur(rpoodlpt  ivtlt)artax pno1oetnmoeiad a umnvsnu0 rerxf3tytfpteln s t0seum(o3io1lmtelfcilsfsrumxm ;t0tleomo3iysfm2rl(vp;t4 exnmf oy1omt livslt0 etrio3ny4olt mivi s a2ua( o;t1tptoioeiad aDuanms u)tlxnxfcoydfpDrlnvsl(0sexo(rpnudomt  netls s2raxroot4tlt iociltla ua( o t4teenmrcoodlaDr nvs;t)s2uoxr oo1lltemiciat)aDraxmoou0oltnmoctlt mDuln pn(4trtnmf3io1lat lneo ( t2umxr oy1olee nei sfa2rru oou4apx ioeilsfsDumnvsnt)teeomf3oytom ran ilt0 euoxopio1am e ncsas)s2um(  oo0tlx mf3iat s2em( onu4teeoifcty1fmteli o t)trxoim3oydllee ncsltf rrrurono0oee ifetld m2eanvs u0alermf ootopD liesls) exrxm oo4lmtelfcilt arrax o;u4aex ifeiat s2ra( snu4tlenxo totfptelnvolt) exr(rpnydlm nlfvt s) ruaurp;o4alxniieiltfa2ean s;u)tetrxfcoo1fmDe nvi s)tetr(m iy1op elneta(fsrurxm no0tlx  oetlt m2emn p;u)alermf oadop r n ilt0texrir3nu4apte fvs t  rtr(root1olto o3iyt m ulnmo;u) reoxfcia1omtelies (0t2umiopou1lmteliesls)sDtm(  ot1aeenmociatfmDrmnmo u0altoif3iy1lmDeln ils0t2umxo3oy1lmte fvslt)srraxmono0tlt  f3tys mDul( p (0 lxnio3iydlmteau s;s s2umxm oodom elfeta( s2rrx  ;u1texnmictasls2em(msn(0 lxoxf totfp   ivi;(0s2xr(r3iodlle mncs (fsrur(mo;o0apxnmietad s2ua(von()trerir iodoa raiei;t  etoxm3io4lmtnlnct (faDum( pou4alxo i3iad aDelnmp;u)aleomfctadlmte i il( trxo(m3io4lme  feslt sDrmx o;t1texo fciydfmDumumont)areoircoa1fptelivsls)sruoiopiodoleemnctltfarumu pnu1tleomoeiasfaDrm(mp;u)arermr3iytfpDraues;t0trum(o iu1lp e icta() 2tauro;o1alxnmiciasla2ulumonu4tetrmo3io1oat li i ()t2xr(m3iudole  iesa(fa2ta( p;t4ape  i3taslm el(vs u4 lermf3ty1oaD aivo ( seuoim3oydalenlfcilsf Dumurpnt0tpxomo3tadfa uaump t4arenmocta1opDelieolt srur(r3ou1lle mneias)arraxmpou0tltn i3tys mDuau s (4trerirciadlat ln o s0 2trxm oy1oleemfcsas) ruaumpot1alt ifciadls rm(von(4 exnmrctadlp eauvo;(0 rxoirpnu4am  mnei (fa2rrxmo;t0alx mo3iadfs2emu o;u0areoxf3ty1faDelu i;t) 2xoir3ny4omtnlicta(  2umxrp;t1tex  ociys a uanvp;u4tleoif tadfa   ieil()trurirpno1om e ieias) Drm(moou4teeoioeilt mDea(mo u)alxnmr ta1om rluvi;s0seur(r3nudlm n ivsas)s2rm(r ou1aee mfeiatfmDelnvo () exoif oy1optraivs s0 etrxopiodopee fesa(  Drmxmpnt4alxoii3iat aDuau s;t)aeenxf3tytom raueols0 2xmxo nodopee nes t) 2ua(rp;u1aet  o3iadla um( on(0tetnir3iy1optraiei;()texoim3nu1op  mfvt s)srra(rono4tpx  i3tld a emnvp;()aeermfcio1lm eli s t  eumxr nodomtelnes t  Dtrur ot0aex  i3iys mDel(vo;(0 leoifcto1oatelueol(  eur(mpny4ole lictat)s2raumo;t4tle iociytla2emums t4tleomo oydfpDeai il(0srur(o oo4ole  neils  Dtrumo;o4aet  f3iyt a2emnmp ()alermr iotlm e uvs;(0s2xrio oo4lmenlivslsf Drru onu1olxn icias s eau snu0tlenir tytoaD  nvi (0t2tmio nudamtnmfcsa(fsDumx pou4aee  octatfmDumnmo;(4 exomfctytoa   ueilt0 2uoio3iudol elnesasfarrmx o;t0aetoifeildfsDeanmo;(4teeomf3ia1fp raueslt)s2uoxmpoo1aptnlietas a2ua(r ;o1tptnmiciytfs2rmn s t0tltoxfciydfm rau s (0sexo(m3nodopeemnei t)sDum(ront1tpt mi3iytfs emuvo () exrio3iy1fa   ues;t)t2trir3oy4lp n nes s  2rrur nt1teeo ictasfm rm(vp;(4 eenxo3iy1fpte ueo t teumiopoudlmtemivsa() rrrxmp;t0texo f3tytlm2ul(vs ()texnxfctadlp eaivi;(  rxoiopoy4amte nei t srrm( p;t1olxoiieiyd mDrm( pnt0texrmf3oytopD  ivi s)tetoir3nu1al n nvtlt)arur(m ou0teeoio3iasfm2ran on(4 rerxrcoydoa  aivsl()s2xr(m3iudap e nciat)aDtaxmpnu4ole mietat m um(ms (0 eenircoydoptelieo;(0sruoio3no4lm nmieias) ruaxmonu0tltnio3tldlm ua(mont0tlerio iytopD lueolt0 rurimpiy4lmt livtat sDrrump;u4aee mfctas m2uanvpnu0aeeoir3iatfmDrli o s sruoio3iodamt mfei s)artmx  ot0oeenif3ilt m2uluvon(0alxrmo3iy1la   ies ()s2toxm nu4llt  nvsa(f rrruront0tle  feiysfsDemn o t4tltomociodlm elnvols0s2uoio no4lp emicils)srua(m ou0tpxomi3iyt mDuanmo;u4aeenir3iydlmt aneo () rxoirpiu1op  liviatfaDtaxr oo4tpeoioctldfs rlu pnu) etomf3todop   nvs t  eumiopiu4apenmfvi t aDraxm ;u0alx mfetydfaDem(vo;t)texomf iy1late ies;s0 eurxo3io4apee nvtat arrmu pou4optnmoetadlmDean s;u)tleoxo3iodlm  an o ( trum(m iy1om  mieias) 2tr(r oo0tltomicilslmDranvonu0tetniocoydfp rau ils) exoirpiy1op emictl( arrmu p;u0tlx  i3ils a emumo u) eeoxrciodomtrln o;(0 rtoirpou1lm elfci (fsDrrxmonu0opxn feiydlsDrau p;u0 ltrir3oatlmtraneo t0 2uoim3oo1am  lfvs (faDraxr nu0aex io3tysfa eln o;u4tleoxrciy1om rauei s)t2toxo3ou4lpenlfci s)s2uaxm nu1tpto f3tas m2ulnvsnt0 exoif oatopDrlivs;() 2tr(o nu1altemnetas)sDrr(mooo1alt ii3ils a rlnmpnt4tltnir3oo1omDeaiei (  2tmim nu1lp  mictlt)sDtmx o;o4oet iiciydfm2ulumsnu0 lerifctodfaDelnvolt0 2urxm3oodop  lnvs sfaDtm( o;t1opt  i3iyt mDrlu sn(4areomfctatoaDean il(0srxr(opoodom   ivs (fa2rmump;t0opt io3iydfs2ul(mo t)altoir tydfp rlu s t) rxoxo3oydam  lnvt t)a2tru  nt1tlt ioeiydfm ra(vo ()trtomfcoodoat ai o s0 exr(o ou4aleemictat  rtrxm ;o4alxo fctas a2uluvo;() etomr3tatfm  livo ( tetmxmpnu1lmt  icslsfa2raump;u0tpen o3tydlsDrmnvont)alxrxrcoy1lpt livols  2trio nu4ole  ies ()s2rmxr no4tee ifeiytla rlnms (4 exnio tadomD  neolt0 ruoxo iy4oltn fvil()s2rrumpot4oexo ietlsfs2rmuvp;u)alxnxf3ootlaD  nvs;s0s2umxrpiy4amenmicias  rra(rp;t4aexoif3tytfa ul(vsnt)treoir iotfaDelnei (0trur(mpoudomenmieilsfa2rm(ront4olt moeias s ulumo;u) etoxf3oytoa elieslt)s2triopno1ameelncsls)a2rmxmpot0opto iciysfm ra(vs ()texnmfctadomtrlivsls) rto(mpou1olenlivi (f rta(r ou0aexnmf3tlsfs2emnvon()tlerxrcoatfa   uvo;() 2tm(r3oudoltn nesatfs2um(mp;u1aptnmietltls ranmp;(0areoio oytlptran sl()srur(opoodlm nmfvia( srururoot4aee mfcilt m2rlnvs t) etnmo oatoa rau ols)seurim3iu1llt mivilsfs2tru pnu0ape iieiltls2ranmsn(0tlxnmrciy1laDe ieo;(0t2toiopoy1ap   ieia()s2taumont0tet if3tltlm rmn ont) etoxf3ia1lmDeaivi;(0trtr(mpiydlmen nctasfsrtauro;o1oetomfctys aDua( s (4 rxomocoy1oate i s t)trumim no4ape mfcsls)srrru  no0tlxomi3ias s2em(vpnt4 ltrio iatlpte uvolt)tetm(o3io1llenlieilt)aDrr(  nt1apxoio3tytfs2eanmo;u)tetnmf3ia1omDean slt0 2xo(mpoo1opte nvsas s2umx ont4teenio3iat a umnvp u4aexoircto1op eaneo (0s2tm(o ou1opt mfcs (faDraur ;o4olt ii3tytlm rm( pn(0altrmocoydfaDeauvo;( trtmxmpiu1lmtnmicsas  rtmxrooo4tetnmoetas a rmuvs t4 etrmo3ty1fatelu olt0srumxo3io1lm e ics tfa2tm( poo0aeeomo3ildfs el(monu0tlerir3tadopD aneils  exoim3iu1amtnmictltfsrtru o;o0altn oetyt a2eaump ()trtrircta1omtelnvilt0t2umir3oy1lpeelnctl(f ruaxmpou0tltomociad s rlu onu4texoxo oadlmtr neol( srur(o iy1olt mfcs tf 2tr(ro;o0tptn iciadlm2ean pnt0texnmr iatomteaivs s trxoxopoudameemivias)a2ur(rpot0oleomf3iadlm2rmnmsnu4trtnxocio1oatrli o;(0teto(opny4lp  mfvs s s2ua(mpot1oeto i3iltfaDrl( o t) rtrmr iydoaDeaivi;s0 rxmimpoy4lp nlivia()aDtaxmo;t4aet  fciysfa rau on(4 rxomf3totoa e uvsls  ruoxr io1lmtelici sfsrtr(  oo1opxn icildlmDrlnvsn(4 reomo oa1fmtrli o;t0 2tmxr3nodlptnmfeias) 2ur(roou0olenmf3ildla2uanmpnu4aeeoio oodlat auvs ()s2toirpiu1altnlfcsls a2trum no0alx  iciltlm2ulnvo (4texoio3iydfatean ils0texr(o nu4omtn ici t  Dumxmo;t1alenmi3iat sDrluvsnt)texnif ia1om eai ilt)s2umir3oy4apt  fctlsf Dumxro;t1tlx mf3iyslm2eau snu)tltoxr3iodopD luvi;s  2xoirpiu1al e nvt (f Dta(  nu1olxnmo3iasfmDuan s t0 rtrxr oydfptrli o;s0t2uo(o nodlmee neslt a2rr( oot0tpx mieiytfs umn onu)arenmr tydomD livil(0 2um(opnu4olt mivil() Duau pno0tltoifeiydla2ea(msnu0 etoio iadfm  li sls)texo(r iydamtelncilt  Durumooo4texn icildfm emumon(0areomrcoa1fpt ai i t0seurxmpoo4lp n fvtat sDum(rono0aleoioeias s rl(ms;t)alenxr3oodopDe neo s0texmio io1lm nmiei (faDrmx  ;u0apt  ociad sDel( p t0arenio3tadfpDeaues s  2ur(m3iy1amtelfvi sfa2uax p;o0oeenmictas s eauvpnu4teeniociytlaDeanvi s srurio3iu1op nlfcilt aDtr(ro;t4oexniieiasfs umu o u)teeomocoodlmD  u olt s2uoxm iu4apte iesl(fa2rmxmpno0oetnio3tas a ra(vo;(0 ltnxo3oa1opt  ueo;t0 etmxo3ny4amtnlivsl()s2ur(  ;t1olxomieiad a2umn o;t)aeenif3oadfm raiei;s) exoxr3nu1op elics s) 2taum nu1ole  fetltlmDrlumpn(0aetoio3iydfa e ues t)t2xoio3iy1oltemnes (f 2rmx pnu4olx  i3tyslaDuauvs u)tleoxfcto1lmD lnvols0s2xoio3iy4om   ieils s2raxr oo1alxoiociysfm rlu o;t4 lxnmocoytfm e ueols0 ruoiopiodopenmfct t  Duru pot0optnio3iydla rl( ont)arerxfcty1fpDe i s t srtmxr3iy1lmtemieslt)aDrmxr nt4opt iietlslm2uluvsnu4artnmfcoadomt anvo;s  2uoimpiudal  mfcs s) 2uaumpou1tpenif3iltfs2elu s;(0trtomociy1lp   ueo ()seuoir3io1llte ictl(faruaurpot0apx moeilsls2ea(vo (4 eenmo oatopDe n s () exoxr3oo1lmeemnet (  rtax  no4apeomieiadfaDeauvp u) ltrif3ootfpDelivi;s) eurimpiu1omenlnet t  rrru pnu4tleoiieiat sDra(monu) etrio iadlpD lues;s) 2urio oo4llt lfvtlsfartaxronu4alxo ictas a2rmums (0 lxnxf tatoaDe nei;s)t2tmir ny4lm n iei s a2rrxr no1apxn ociltfm2ea(mp;u0 rtrxf oo1lpte i o t)s2tm(r no1om   fci sfs2ta(m nt1tpxn fetas aDea(vs;u0tetnmfctatlpDe ueols texrxm nu4apeemnvilt  Durx ont0oetnmiciadlsDuaumo;u4teenxo tydfat au s;(  etrir iy4lmtelneiasfaDtaumpno4tpe mictysfsDrauvsn() exoif ta1fmD lneo;s0 2umir iy1ol  mnei tfsrtr(  ot0tlx  feiasfmDeau o;t4 leoiocia1opt aueolt)srxr(r3nydomtemncils)s2umurono1aeeomo3tldfaDulnvs;()trenmo oatfat lieslt  rtm(rpiu1opt  fvil( sruaxr ;u4aeen oeiad sDuanvp u)tleomf3iadoat auei;s0 euo(o oy1alt lfctls)artru  nt4openmieiatla ulnvo ()treoxo3ty1oa  livi t0 rxoim iudomen ics s  Dumu p;t1tet mo3iyt s ean p (4tltrxo3ia1lp elnvol( tetrxm3oy1ll elfvt ()arur(r ;o0tpeomictys sDrln snt4tlenmf3ty1omteaueils) etmimpiy1opeemfctl(fa2tmx pnt1tltnioeild a rau sn(0alxrmf3oatla  lneol(0 2ur(o3no4ape  iviatfs2uaump;u1alt iiciydlaDeaumonu)tltoiocio1opD  n o;( srxm(r oy4lp nmnctatfs2umur no0tpto oeiat a elumont) etomrcootomt auvi;( tetr(rpoo4ame  netl(faDtmx pnu4aexomfeiadla rmnvs (4 lenxfciotfm rauei;s srur(r3io4ll nmivias srumur ;o0texn o3iytla ua(vo t0 exoxrcio1faDe u il( trxoxo3oo4lptnlnvtatfsDumumo;t1tet  o3tatfaDea( snu0arxnmf3tydlpDeaivi;s0 exoxr3nodap  liesa()a2rm(m no0oex mfctlsfsDelumo u4 lenmf3tatop ran sls0seurir ny1op nmfetls sDumx  ot1oet  f3ildfmDrauvont4trermfcoytfatean s s0t2urir ny4ll  lici t)aDtr(ront1tptnifetltls2rl( o;u)tetoir3tytfaDrlnvs s0s2trxrpno1opt  nvils)srrruro;u1altoioeildla uauvon(4alxnif totoaD livi (  2umir3iu4op  lfcils sDrrxmpno0tlenii3iytfa2rm(mpnu0tlerif oatoptraueol(  2tr(m ny4altnmfcslt)a2tm(ro;t1oltnmf3ils s rl(vp;u) rtrxo ta1fpt ln i s)trtr(m nydlp emnvs s  Drr(rp;t4aexoifetytla2elnmp u4 exrmrcoodlatr nvs;t)trur(r oo1ol e ieils) 2rmx p;t1alenmfetyd s elnvsnu4 leoir3ia1oa elnvi;( trxmim ou4lpt lfes () rtaxmont4tltoioetldfmDrau s;t)aexrxociodfmD ln i;s0srxr(o3oodlp e nvsasfaruau ooo1apxo i3tytfm2umums t0treoxr3ia1oatr uei;(  ruoim ou4al n fci t s2uru ooo4olxnioeiadlm2ea(mp;t4 lenmfciytlaDe ivi s0texrxm3iudomtn ietas)aDraxmoou1tpe  f3iytla rau p;u4aexrio3ty1om   nvol(0trur(r3oo1ap  mncta()s2um(mpou0oeeoifciatlmDelumon(4 leoircoatfm  li o (0srtoim nu1llenmictlt aDrr(monu0alxomicias a2ranmsnt)trtomo ia1fmD auvol(0 2urxrpiydalt  neta( sDrr( oou1oee mietaslsDrluvpnt4altrmf oydla eaneo s trtm(m nu1lpee ieil()s2tmu pnu0ole  o3tatls2rmn onu0 lermocoadfpDelnvs;t0 2xrxo oudlpeelivi s aruau  ;t1tex  o3iatfa rl(ms;t0texrxf3oadfmD aivil(0setoir3io1ame mneslt)srta(r ;t1altoiicild a2el( s ()aexrxrcio1faDelnvolt) exoxr iu4lleemietas a2umx ooo1opto o3tat aDuan s (4aleoxo iatfptr u ol(0t2to(r3oy4amtnlieta(fsrtrx pnt1tlxnioctyd s rlnmpnt0trenir iotlateln s () 2tr(o3iu1lm   ivilt  Dra(r ;u0oet  ieiysfm el(ms u0 rxoir to1lmD  uvs;t0 2trxo oy4ole  iesltfaDum( pou0alt moeiydls uanvo;(4trerioctytlptrlnvils0srxrxm3io4op  mies ()sDrmur nu4tleoiieiadla2um(ms t0trtrmr3iodopt  i ils) rtoir3oo4ap nlfctltfsDum(moot1aetnif3iyt a2rmnvpn(4trtoircoadom elies (0 exoio3iu4ape livt (fsrrrx p;u0opxniocilslmDrluvpn(4altnmo3totop r n s t0srxr(r3iu4lpee iesl() Dur(mo;u0alt  f3tlt s eluvs (4trxomfcto1lpDe n i;s)t2trxm3nu4ap  lnct t) rtrxmooo4aetn ociydfs ra(ms t0 exnmf3tydoat lueo s0 2xmxr3ny1oltelnes sfs2rm(  ;t1oltoiietydla2rmumo t4 etrir tytfm rau o;t texrxm3iu4op  mnesls)srta(moou1tpt ifcildfsDuan s;t4tlxrxocootoate ivo s0trum(o3nydlpt lfvi s)arrau  ;o1oetnmoetat s um(mo;(4 exnxr3todlp  lnvi ()t2um(opio4amtnliviat  ruaur ou4opxoif3iatlm2ua(monu0aeenxr3ootoat  i i;() etoimpoodame lfvsat s2tmxm ;o1tet  i3iasfs2ra( p t)arxnir io1op  an o;s trtrimpnu1al n iei t  rua( poo0aexoiieiatfmDra(vp t)trxriociotlateaieolt0trtmxopnu4lmee netat) Durumo;u1apto fcilt s2ea(mp;(4alxoio3ia1lp r uvslt0tetrim3ou1om n ieia(faDrr(roou4ope  o3iytla rmump;u)artrmr oa1la r n ilt  eum(mpny4lltelnvi () Dtmu p;t4ole  f3tadfa2elums
\ No newline at end of file
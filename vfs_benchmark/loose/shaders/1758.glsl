@@ -0,0 +1 @@
+iei;s0seuoxopnydlmtn icsas) 2raxmpou4aet  oeiydls rmn o u)artomrcia1omt  uvi (0srurirpnu4olte fct sf 2taumpno1olto ociad aDra( p;t0texoif iotfp r neolt)srxo(m3nydlp emivilt) rurx p;u4alt mo3tytfm2ra(vs;(0 ltoxrciytfmD anes t tetmio ou4opt lfcsas)sDumx  ;t4aptnifciyd a umu ont4 ltnmfciodlpDr n s t) 2xo(m nu4op e ncil(fs2umurpot1aet miciatfs2um( o;(4teenxrcoytlpte uvo (0 rtoiopnudalt miviat)arrmumpno0apt iiciyt s eluvp;u)tlenxrcta1lm e ueilt)sexm(o nu1lme  nvi (fa2umurp;u1tlen f3iasfsDrluvs;u4 ltnif iadop rli sls srtrxmpiu1olee ncsa( srurxroot4oee ii3ildla2ul(mo;t4 leniociodfp r u o (0srxrimpoodap e neias)a2rmxmo;t0oeenio3iltls ea(vo;() leomr totomDe uvi ( s2xrio3ou4lmeelici tfsrumum ;t4tet ifetldfs2uln o u0alerxf oytomDr ueol( t2xmxopoo1lpe  fci s) Dum(  ;o1aet moeiat a2el( sn() etrio3iytlpD  n i (0teurir oydamt lnei s)s2rrumo;t4aeeniieias s ulumon(4texrmo iodlm rluesls0 2to(m io4ame lnci tf Dra(ro;t4teeoio3tytfmDeanvo (4alerio3iatomteaivo;t)t2umxm3oy1ameemiesa()arrr(  ;u0tptomo3iadfm2rmumont) etrmr3totla  aueilt0 rtrxo3iu4lpeelnes ( a2rmumpoo0aex  oeiadla ul(vo t) etrio3io1om  aivi t t2trxo3no1omtn fvia(f Dua(ront0oltn i3tlsfa umuvo;()treoxf3to1oa r ueo t0seum(rpnu4ameelneils a2urxr ;o0tetn octytlm rmumpnu)alxnmo3oo1lpDrau s s tetm(o3no1ol elivtas  Dtaxmo;u4tee  oetlt m emumo u0trenmo3totla rau o;s)srtmir nydlmt lfvt (fsDumur nt1ape ifetydfsDuaums;u)trxnircoy1laDe ivs;t  exrir iydlp n ncs tf rurxmo;o0openmiciatfsDeanvon(4trtoir3ty1fpDe uvolt)sruoxm no1optnlivsltfaruaurp;t4tltomietysfm rmn o;t0altnxo tytopDeluvi;(0s2xm(r ny4oleelnvs s a2ta(m ot0tpxoiieiydlmDuauvont4 rxrxf3iadopDrlu s;()trtm(mpno4lmtelfciatfaDrmu p;t0tptnif3ild aDrln o ()alxnmo iytfat lueslt s2um(r iy4lme mivslt)aruaurpou0ape miciytfa ul( o t) renmr3to1om ranvolt t2xr(o3oo1al emncia(  Drau pot0tpxnmfctld a ea(vsn(0tlenxo iotlmDr n ol()srumxopoy1lpt mietat srta(  no4optoifciltlm2rlu o;t0 lerir3iadlptraueo s)s2tr(r3io1am n fci t)aruaxr ot0tpxn i3tatla ean onu)arxoxo3oatoate uvi;(0trxr(mpiodome mfetas) rurx pnt4tpe  octytfs2emnmp;t) reoifciotlm  li il()srto(rpno4optn ivt t)arrr(rp;u4alx mfeiyslaDemn s (4alxoifcoa1lmt  nvs;(0s2ur(opiy4lle lncsas)artru ont4apt ioetadfsDemnms;u0 eerxocoydoaDrlivs t) etrirpio4amenmict (  2tru o;t0teeomfetltlaDrmu s u0aetrmr ta1oaDe iei (0teuo(r oy4lmenlfesl(fs2uaxm ;o0altomociat s um(mpnu4trxrmf tydfmD  ies;s) etoio oy4lptnmfvi (fsDum(mp;u1oex iociytla rl(vo (0texnio3oo1fpDelu sl( seumxm3ou1lm  mfviat)sDurx  no1tpt mfetadls um(vpnu)altrxfciodfptelueils)t2urimpiydapeelicta( srrrxr ;o1olxn feildlm rln s u0texrmocoodlm r nvols)s2xm(opoydlmen ivia()sDuaurpnu0tleomo3iadls2emuvs u0 etoir3totfptrauvs ( trtmir oodamen ivil(fsrtrxmo;o4aexoifetltlsDul( p;(4trenxf3oydom  li s (  euoir3oo4lptemivs sfsDrr(mpou0aptnioetadls eaump;(0artrifciy1op eluvo;s)t2toio nodlp  lfctls aDumur ou4texoii3iatfs2umu o;u)arerxf3ty1oa rlnei;t0 rum(m3oodlp emieta()s2rr( pot0oex  fciad s ranmp t) rxoif tydfp rluvils0trxmimpou4lmenmfcilt) Dta(rpou1opx io3tyt s rmumpn()trxoio ia1la raies;t)trxrim3iudaltnlfeils)s2taumpnu4tlt ii3tltlaDua(vs t0tlxomf3oatlmD auvs t t2uo(o iu1ale lfvi tf 2rmx o;u4tlx  iciyd mDranvs t4trxoxo3iodlp rlnvo;( trxrxo3nodomeemnesa()srrr( ont0tptn oeiydlsDulnvpn(4treriociodfpDe uvo s  etoio oy4apen ncias)srraum ot0aptomfciytfm rln o;u0 lxrir3iodfaDeauesl(0texoxopny4lm nlfvi t s2rrum oo1oeeoifctltfm uanvsnu4artomo oatfa e uvil( s2xmir oy4ape  nctl(f Drau pnu4apen octasfm uau s;u0alerio3oadfaDeaivs;t0trxrxrpio4amt lnvs ()sDtm(ro;t1tet iociad mDemums t) eenif to1lm e ivs;s) 2xmirpoo1ap  lnctlsfsrtm(  nt4olxnmoetatfsDrlnms t) eenxo iatfmDeanvi s seumiopiy4lmtelncsatfsrtr(r nu0tetnmi3iydfm2emu pn(0tlxrmrcta1fpDr ieslt) etrxr3nydolen iei tfs2ua( o;t1texn ictys s ra(msn(4 ltrif oytlpte ieslt0s2toio3iu4ale mfvslt)aDrrxrp;t4tetnmieiydfa ua(vs (0 eerxo to1fpDelueil(0trto(r3iy4lp nmncsl(f rrrurp;t1opxniietyd a2rmuvs (4 ltrxfcio1la rli i;() 2tmxo3oo1ol e fet (f Duaxm ou0opxoifcils mDeaump;()aeenmr iytlpDeluvs s  rtm(r ou1apt lnvi s arra(roou4aexnmiciytlm2rauvonu) eenir tytfat  nei;s)teuoxr iu4lp nmics s aDrm(ro;t4olt iieiyslmDemumo;(4trxrmfciodfat lu s;s0s2xrirpnudopenliesat)s2trx p;t0aee  iciadlmDrlnvo;u)aetomr oy1oaDr i sl(  rtm(o3iy1lmenlfvil(  rrrxmpno0tpeomf3ilsls2eaumo u)aexrir iotoptranvi () rxmxopiodalt livtatfs2rr(mpoo1tpto f3tadfs raumpnu4alerircoa1lp ranvilt seurir3iu1llee ivs s) 2tmxrp;o1teenmi3tldfm elnvs;(4aeermociadomD auvo t)trur(o no1oltelictl( a2rm(rono0aleniictysfsDel(ms (0tltomo3ta1opteai i t tetmxo iy1lpe lncs tf 2umur oo1opxnmocils m rlnmp t)aleomocoy1fat  n s;( sexr(o3iy4alt lieia(fsDuaxrpno0aex  oetyt m rlumpnt)tltomf3iodomDe uvi;s s2tmxrpiu4llen fesls) rrr(rono4alenifciadfs2ea(mo;t0tlenmf ta1oa eaieo;( t2tr(mpiu4am nlnesat srrm( oou0teto ieiltla2rm( o;u)treniocoodoa eln i;s0trtoxm io1ameemnvtat)artrx  ou0ope ioeiydfaDean ont4 reoxo oa1oaD li sls)teurir iodlmen ieia(  2rrx pou4tetomoeild mDum(vp;t4trenircootomDr ivilt)seuo(rpiodoltemfcta(fsrtr(rono1apxo ociasfsDuau p t0texoif tytomDeau i;s) eur(opiy1ll nlfvilt aDur(  ;t0oleomf3tytls2elnvon()alenif oodfp r i ilt  exoiopiudamenmiesat aDrmumoot1tlenifctadlsDrm( ont)tetnxf iydoaD  ivslt) eum(rpoudap  mivsatfsrrmxmoou1apen iciadfsDra(mpnt0arxoio oodfat anei;t)teumxr oo1om n fes s) rtax p;o0olt mfciydfm2ulu on()treomo3oa1lpDrln i t trumir no4lpen fesl( aDtm( ooo4tlx  fciadfs2rln p;(4 lenir tydlpDrluesls  eurio3nydop emfvsa() Draumpno4aleoifetasfa ua(vs u) reomrciydlp elneilt srxmxo3iy1ap elfesa(f rraxrp;t4openio3tasfaDrluvp;() rxomrciadlpDranvs s)srurxo3oo1apenmnesatfaDra(monu1tpx io3tyt m uanvs;()arenir3oatfat  ieo;s0t2xoxr no4amtelfesasfsrurur nu1aeto fetldfa ulu pnu0 reoxo3tadomtr ieo t0s2xo(rpno1omtemfes s)srurxrp;o4oexo fciatlmDulnvo (4tlxnif3oo1faDrlu o;t)t2trxo3oudop  lfvs s arrru  ;t1texniietat a2rmu p (0areoir3ootfp elivi ( tetoxm nu1ll n fetat sDrr( ont4alenioetldfm ul(vs;(0texnif3iatfmD lneols s2uoxr3oo1al e ivs tf 2um( oou1tle ifctasfm raump;(4 rtomr3ia1faD lueo s) rtm(mpiy1openmieilt  2tax pou0opt  f3iasls2eauvo u0tlerxf3iytlaD ai i s t2trio3iy1llenlictls) rur(mont4tlt ifciyd s2ra(vs t0tltoir3tytlmD luvs ( seurxm iodlp e nct (fartrum ou1ape mociytlaDrauvs (4trtrmr ia1opDeaneslt0s2uo(rpoydalenlncilt)arrrxr ;u0olxo o3iytfaDeauvpnu) etoif oa1lptraueils) eumxrpoy1llt mfvtatfs2rr(mpno0tlt  i3tydfsDranvo (4 rtoxo3iytlptr uvs t0setrxm oo4lptn fvil(f rtaumooo0aptnii3ias m2ul( p t)arerio oy1lm rluei;t setrxm3oy4alt lneta()srrmxr nt4alt ifcild mDemuvpnu) exnxoctodlatraueo;t0trumxopoo4amtnlnvils a2ur(r oo0alt mieiad aDuaumont)artomr iadlp r u i;(0seum(m ou4alt  ivt (fa2umurp;u0apt if3ildfa2eluvs t4 rxomo tytfm  lnvi;(0trxrxr iudoltnmfviat  Drm(r nu1olxn ietytlmDum( sn(0aleomf3oatomte u s;()sexrirpiy4apt  nct ( a2ur(rpoo0tltn oeiat mDrauvp t) ltrxf iy1fat anvo (0setmxopiudoptelfeslt)srrmxmp;t4aleniietlslm2el( s;t0 eeoio tytfmt  ieo;t  rumir nodlmee ivils s2rrur ;u0tetomieiad m em( o;u)texrmrcio1fmDe ueo;t) 2xoxo oy1ol  lfcsasfs2tmur ;o4aexniociltfa emuvpnu) rtomocta1opD aneilt teurxopny4altelnvs s)sDumxmp;o1apxoif3iyt aDrau s;u) rxnmo todlp eli i;(0srxr(m3nodop nlfcilt aDuauro;u1apeomf3iys s2umn s;(0tlenmociy1lptrau ils)srxo(o no1lpeelieias)sruaxmooo4oex mietytfm el( o t0 renmr ta1la eaueils)seuo(r3oodll   fesa(f rum( p;t1tlx ifeiasfsDelnmsn() leoxr3iatlatrlnvs;t)s2uo(m3iy1lmtn icsasf 2ua(moot4teeoiiciyt s2emu onu4trxnmf3oy1fmD lu s t0trto(o3no4ll   fet tfarrruronu1teenmfcilsfm2emu sn(4 lxoio iodfmDr n o;t s2uoim3nu1llt mivtlt)s2taum ot0tpeoifeiys mDrluvpnu0aexnmrciotopDe nvi;s) rumxopnydlpt mietl() Drmxrono0apt micils aDrlnvp u) rxomocoy1oaDrauei;t)trurio3iy1olte netl()srtaurp;t4apxn ociatfmDean ont) rtriociy1lmteai ol(0texmio nydalte ivsl()aDumum ;t0aexomo3iydfsDua(ms (4 reoif io1lpt anes s0tetrxm3nodomeelneiasf rrrurooo1tetn oeiytfsDelump;u0trtrmrcoy1op eln ils0t2uo(m iydope lictatf rrmx  ;u1aex mieilt mDrm( on(0 rxoxf3oatoptraies s0t2uoirpiudlltn nctl(fa2rr(rpnu0tleomieiasla2ra( onu0tlenxf3ootopDeaueslt0t2xrirpiy4ol emnvtasf rrrurp;o1tet  fetyd m rlu ont4 eeoif ty1laDeauvol( setoim no4llt  fviasfs2raxr no0opt mociyd aDrlu o;t4trxnmo3ta1laDe ues ( trxmir oy1optn iciltf 2rm(r ot1alxomicias a ulnmo (0arxrmf tytfaD  n s s trxrir iy1lm e nvtls) 2ururp;o4tex mi3tltfm2em(vo;t)trtnmr3oydop rliei t0trtoxo3nu4oltelicslt)sDurxrpnu0tpxo ieiysla uanvsnu) leoxo3iatomDe i il( seuoxm oo4omtn ict tf Drm(rp;t1aeeo feiltfa rl( s;u)teeoxf3oydlmDe u o;t0s2trxrpoy1lpte iesa()srtauroot0aeenif3ildfs2rl(mon(0 rxnircoadopDr ieol() 2ur(r iodamt mnet (f Dur(ronu4tex mi3tysla2ua( o;t)arxrxoctodfm eaueo s) eumir ou1ap e fcs (fsDuax onu1oetn feiasfa2uluvs u4aetomoctytfaDraiei;(  rtoio no1lp elfei tfaDur(mp;o1ope if3tatlsDum(vo;u0aeeoxo tydfpDrlneo;t)tetoir3nydopt lfvsat)aDuaumpnu4optoif3tltfs rl( p (4alxrmf3oo1oate uei;(0trumxr3iu4op  mneiat  Drr(r ot4tpeomfeiyd aDumump ()altrxr3tadopte ivi;( t2xo(r oy1olt lncs (fsrrmxmoou1opeoioeiydfa2elump;t4treoir oatom  livs;t  2tmxo ny1lpe livtatf rraurp;u4apeoiiciatla rauvsnt0tleomfciydlmD  ivi s s2um(r no4alenmnvs (fsDtmxr ;o0aeto oeiadfaDeln s;() rxoir3to1faD lieo;s0 2tmirpio1ame lfvs s  2uaxroou4oet mfctadla em( o u)trtoio oo1oate n s;t) exoxm iu1amen ictlsf 2tax o;t0tleo oeiltlm2ra( s;u4 exomfcia1laD  i i s) eumim nu4ol emfeia(  Dumu  no4tptomieilsfmDemump t0tlerif3oatopDrlu i;t0srumir ny4omtnliet t a2raumpnu1aex if3tyt sDrmu pn(4texomo oo1fmDelu i t0setm(rpou1op   nvtasfsDur(mpoo0olxnif3ildlm rln pn(4aeenifcty1fpDraivsl(  2xrio3nu4am  mneil() 2uaumont4opxoiiciytls2rmu sn(4arxriocoydlaDran o;t teumxmpoydllen ics sf 2tmxr oo1oet iicils aDrmumont)altnmfctydfpDeluvsl() exo(opnu1lp  mnet s sDrrxmont1aeto fciytfmDemn p u0aexoif3todfp r i o;s0 2xo(m3no1alt  fvsat) rrmxrpot4tlx  ieiltfa2el( p;u0 exrxr tatlp r i sl()setoxm3oo1olt  fcslsf 2ururooo4altn iciatls2ulu s;(4 reoxfctytom  aueil() 2xrim no1amtemivtl(  rumx  ;u1aetn o3iltfs el(msnt0tetrmf3todfp  lnvo;t  etmio3oy1ap  livi (  Dtrxmoot4apxnmictydfs umnms;u4arxomfctodlmDrluvilt texo(m oy4ol   nvi sfsrurxm nu4oltoif3tadfa2ranvp t0alxrirctatoatelu i;s teumxo oydolt liei tfaDururont0olx if3tatfm ulump u4trxrxocia1fat  i ol(0 2urio oo1lp e ies () 2uaxr ou4tex  fcilslm2emnmsn()artnmfcoodfpt au i;s  rumxopno1lmt mivia(f Dtaum oo1opt ifciydfa2ul( pnt0alenxr3iotomD  ueolt)trxm(opiy1lm e iet s)sDta( pno4alt mfeiys m elnms;(0tetrmfcty1opDrlieo;()texrimpiudapenliesls) 2tm( p;o1ope  ociasla umn s t4 lxrmr3iadfatr neols  exrirpio4llenmnetat a2raxront4aetoiictls sDuln o;()arxoxrcio1lpDrln sls0trxoim3io1amtnmivsa()sDuaump;u0ale iicild a2emuvo u)tlxnio3todoat  uvi;s0 2urxo ny1op emfct s s2rru  nu0oetnmocilt sDea( ont4 rtomf3ty1omtrln i;(  rumxm iu4lpenlivtl( srrmxr ;t1oetniicildlsDul(vs (4 exnmr3tytlm rlueslt)tetmxo iy1lmt livta(f 2rrxmono1tet miciys m2ua(vo u0treomr oydfmDe uei s0 rtm(m3iy1ameelfcsa()srrax  nu4oltnioeildlm em( p u4 rxnmf oydfp  aues;s0seuoxm3oo4omtnmfvta( a2rrumpoo0oex ifetatlaDeluvo;u4 rtoxocty1fa eaneo t0srxmim iydlm emneta() rta( oot4alt  i3iaslaDemuvs u4trenxf oydlmDelivsl()trtm(mpny4llen ieia(f 2rrx ont1tpxomietat m rmums ()altoioctodomt aueols setrxopiu1ol e nvtl(  2umxr ;u4aexoifctltla rmnmp u0 lenifciotoat ln i;(0tetrxo3nu4opee neil( a2tmumont1opt moeiat s2ea(mont)tlxnir iytoaDeln o t) exoio iu1oltemfvil(f 2rmu o;o4apxn ieiydlmDrmn p;u)teeomf iadfmDe u olt s2uo(o3iu1opeelieta()s2tmxm oo1tltnmf3iad sDra(vo (0tlxrmf iadop rau s;(0sexrir3nudomtemfcta( a2urur oo0aptomfciltlm2rlnvo u4 ltoifcoy1fa   nes;s)seuo(opiodlp  mneils)srra(rooo0optomo3tls a rmump;t)arxrmf io1laDran o;t0 eurxr3iy4ame  nciltfa2tauro;o0tlx ifcils sDemu o (0 rtoxf3oo1fatelneslt trxoim io1om e icsl() rurxronu1aexoii3iytlm2ra(vs (0tltnxf3oy1omt aivi t)trxm(o3oudlpt mfesa()arur(rpnt4apen oeiatla ea(vpnu)aexrxf iy1fmD  u ols truriopio1omeelicsat)sDrr(rono1opeomoetytfmDua( o u4alxoif oatlp r i sl(0 etm(o3iodll elfcsltfsDua(rpnt1tex  oeiydlsDeluvonu) rxrxf3ta1oaD livo;(0tetrimpoydopee iei ( s2uru pno1apxomi3tys aDelu on() rxoxociadfptrln ol() rumim ny4lpe mnvs s)artrxmo;u0opxn ictyt m2eanmo u) exrio3totlp rai i;()tetrxrpiydlmtnmivi sfaDua(r ou0opeomictltfm2rmn p;(4 lenxociatfpt ai o t t2umxr oo1op n feta( sDumxront4ape  oeiys sDemuvo t0trtrmf tadoatrlu o s  rtmiopio4lm   fvt t)s2rrxmo;t0ape moeiyslm umu p (0 eeriocoytlpte uei;s teuoxr nu4lpee ivt (farta(m nu1aet mi3tysfs2eau o t0 rtrmocootfpDrlieil(0 rxrxo3oy4lpe lnvta(fsruaumono4oeto fciat sDum( snt4trxomf3to1lmt lueolt0 2ur(r3iudopenmictl( srua( onu0teeoiietyd mDem(mpnt) rtnmo iatomt ai slt)srtoxo nydalenlfvt t)sruau  no0apeo ieiad a rmnvpnt4aeerio3ta1lmtrai i;()srxo(mpio4om   nvi t  rtm(r ;o0tle ifeiyd m2ua(ms t4 rerif iadlmDeli olt) eum(o3oo4omt liesat  rur( ooo4olenio3iyt aDemn o;()trtnxf oo1lateauvi;s0t2xmiopiydll elieia() 2taxrp;o0olxn ocild sDemnms;t)tlxnmf3oadlmDeln s;()t2tr(m oudlpeemivi tf 2uau  ou4altomociat a2elnms ()tltomo3todop  lnesls trxm(opno1apeelici ()a2ra(monu4openifciydlm2rl(vsnt)tetrmr totlmD anvo;s0t2tr(o nodaltn fvi s a2umumont4apx mf3iasfsDum(vo;t0arerio ta1oa rauvo t  exrirpiudlme lfetls) rrmuronu1olt if3tysfsDemuvon()trxnxo3iytfa e ies ( t2xrim ou1lle  iei t arurx ooo1tltniictas aDumn onu4 exnxfcoytlaDeauvsl(  rtm(m oudlp nmnetls arua(rp;o1apeo octyd aDrlu o;u4 etrxf3iotlpt  u i (0srxmimpiodamenlivil()arum( p;t0oex ifcilt s emn s u)alenirciatlmD  ues;t)srumxo3iudomeemfesl(fsrtm( o;o4oetnmoeiatlm rlnvs (0arenxf3ia1la eaivils t2uoiopnu4lmen fesasfaDumurpou1tetnmo3tyd m2rmn onu0 rtnmfcto1fa r ivols0t2xrxo iy1op nlfeils)aDrrxr ot1apxnmfctyd m2rmuvs;u0tlxrmf3to1op  lu olt0 rtoxopno4olt lfeilsf Dtru pou4optoiictltlm2ul(mo ()tltniociytop  auvils0 2xmir3oydap   iei t  rum(mo;t0tet iieiyt aDumuvo;u)aexrxocio1oa   u ol()srto(m ny1ape  fetatf 2ur(r ;t4ape  feildfs umu p;(0 lxrio oy1omDrlueols0srxrir oudaltnlics tf Dta(mpnu0opx iictlt a2ulnmo (4 etrio3tatop e ueo;t trxr(rpiudlmt lnei t arrmurooo4tpt moeiadlsDua( o u4 eeoio tadoptr n o t)srxr(r3ou1alen nciatfaruax ont0tle moeiysfmDeauvs (4 rxnmrcoo1lmtrlueo;t)t2xr(opiu1om   fetatf rumx pou0tlen fciatlmDulu on(0aexnmocoy1lm eanvol()setoxo3oo1oleemfeta( sDtrx pou1oexniietydfa umn s (4trtnir3tadom  au i;t)sexoio nydamtn fcsa(farrmx  ot4tee  ictltfaDulnmonu0teenxociadfm eai i ( srxoim3nu4op elnct sf rtaxronu4apeomo3ild a2ulu p;(0 rerxo tadlatr nvi t trxr(m nu4op  mnet t)aDtau o;o1olxnmfctat sDrm(vs;(4alxrir3iodopDrlu i s0trxo(m3oo1omee nesa(faruaumono1ole moeiat s2em(mo u4trtrxrcoa1fmtr i o ()srxo(o iydap elfci (fartrxm oo0tpe iicilt a2eanvs t)tetrifciatfpDe u o;t) 2um(r nudamtnmivtlsfarrmxmpoo0oleomfctysfsDrln s t4 rtnxrciodlate neils) rtrxm iy4ol nlfvsasfaDtr(mont1tlt  o3tls s eluvo ()alxrif3tydlmDrlu il(0 2trirpnydll elietas  rua(ro;u0oleniocilsfs ulums;()arenxrcia1fatrluvo;s)sexrio3nodlme licsa(farurur oo4oeeoiictldla2rl( pnt4trenmo3oo1fmD ai o;t0 eum(m3nodomen nct t arurum oo0tlx  oeiad s el( p (0arerxoctydlpDranei s)texrim iu1altemncs sfarurxmooo1oltnmi3iaslsDrlnvonu4aeerxf ia1fpDr i ol() 2xmio oodolee nvi s)artaxr ou4tltoifcildfs2emn o t0trtoiocta1fat au ols)t2toxm3oo1olteliciasfsDtaxrono0oetnmo3iaslmDel(vo u0aetnif iydfatelnvi;s0 rtr(opoudalee fcs sfa2urum ot0alxo iciyt sDeaump t) rtoir ia1faDr nvolt) ruoxo nydllt mnvta(f 2tm(rpnu1oeeniieiasfs2uln o (0tetnif io1op rln i;t  2xrio ou4olte fvsasfsruax  oo1tlxn ociltfsDua(mo u0trxnio3to1faD aueo s  rxoio3nu1amtnliesl() Dtm(rpnu0oexnmi3tatfsDumu snu0texrmo3tydop e ivo (  exo(opno1lpe  feiat arta(mp;o0tptnmfetatfm2eanmpnt) exrif3oy1oa   nvol() 2tm(opoodoptn iei ( sDtmxmp;t1aetn fcils m umn pnu0teeoxo iy1lmDr u i s0srxrimpoy4lme  ics sfa2trumpnu4aexo ociytfs uanvo;(4teerifcoo1omtrluvsl(0t2xoiopiudalt lnctasfa2rmu o;o1tee miciydlm2ul(mp t4trtrxf3tydfaD  i s;t0teuoir io1lp  mfvt ( srtruront4oexomo3iydfa ean pn(4arenmrcoytlpD lueolt)t2xmirpiodol nlieiat s2umxmpno1ole mfetasfaDrmuvont0aexrxf3ta1lmte nes () ruoio3ou4lpenmnvs tf rrm(  ;o1oexnifciyslm rmn ont4 ltrxr oa1om ranei;( setm(mpoo4omt lnet s)a2rau  nu4ole iieias mDrmuvsnt)tltoir todfm  auvo ()s2xrir3nydolt  iet t aDraur ou1oetomf3tls m ulnmo t) lerxf3iytlaDranei;t)t2uoio3iudomen ics (fa2ur(  ;t4opx  feild s2eluvonu4 lxnifctytlmD  uvs s0setoxmpoy1lmenlneil( sDtrxm nu1tpxniicilsfmDeluvp;()aetrioctotoaDraieo;t)t2xoim3iodoltnlnesls) ruax o;u0aexoio3tysfa umnmp t)arenmrcta1fm  ai ilt  rum(o no4olt lfvs (faDta( o;u4oee  o3tysls elnvsn(4arxomr tytfp eaues;(  ruoir3oo4optnmnesatfa2urumoot0tptnmf3ilslsDelu p;() ltrif3tydfmDelueilt  rxm(m3oy1lpenlictls)aDrru  ou1tlenii3tls m2ea(mo (0alxnmoctotfm elivs;t) 2trxmpoy4lmenmnvs t srrru o;o4tltniociadfa2ulu pnu) lxrircia1fpDr uesls  eumxr io1ome mivsltfa2trur oo4tltomiciys s2eanvo;(4tlermf iydfptrlieolt0s2uoio iudap  mfet (f ruaxr ou0alt io3ildlm2umu pnt0aeeoif3ootfpD  u o;s sruo(r oo4ope mivils aDurx  nu1oetoif3tls s uluvs;(4aleomf3ootlm e i s (0s2umio nu4oleelietltf 2tm(r ot1openmf3iydfm2rmuvo u) rtrxrcootla  au ilt0setoxm3ny1apeelivsltfs2ra(mpoo1opx mietad m2rau pnt)areoif3totom   uei;t t2xoxmpoydolen net (fartaxr nu1tpx mociaslm ulu p t0trxrmr oodoaDeanvo t0tetmir nydapee icsltfsrrr(rp;o4tetomi3iadfa um( pnu)trermo3ootla r n s t)t2urxm3oydlpte fct tfsrraxr ou4aetn fctas a2rlu s (4 eenmf3ia1fp  lueil(  eurxr3oy4amen nctat)a2ta(mpot1oleniociysfaDul(msn(4trxnxociydfmDrlueo ()s2um(r oy1ol elfei sfs2urxro;u0tpenioeilsfs em(vo;()altrxf oo1oaDran s t)s2ur(r nodllenmivta(  Drmxmonu4apx  fcils m ea( snt)trxomo3to1fat  iei;()s2umxm ou1op nmiesls)artr(monu0aeeniociytfs ua(vo u0aexnir3ootom  aivs;() 2urxrpnydlltelict s)s2tmurpnu0tetoiieiysla rlnmon()arxnif oa1opt livsls0 rtm(o iu1omee nvtas aDrr(mo;t4alen f3tadfm2rmu sn(0trxrmrcoytomDe ieolt)trtoxm ou4omenmictltf 2ur(  no0alxniociyt aDrm(mp;(0 rtomo3iy1fa r i i;(0teumxopoudoltelfvs s  2taxrpnu1tex  ociatla2raumsn(0aeeomrcta1lp   nvsl(0srxmiopnu4ope lnvs ()arraumonu4ole miciyd s ea(vo t0 rxrxfciatfaD au s (0truoiopoodlptnlfet s)s2umxm oo4tpxoioctlt s em(mo t0tetoxociatfmt ln i t0t2urimpnydlm e ivi tfsrtrxr nu4aleniieiltlmDrln o t0arxomr3oydfaD lnvo s) rtr(o io1open nesa()sruaxrpou0apxomi3iasfm2ean s;u0aetnif3io1faDe n i;() rxr(m3nu4lmeelicsa(f rumu  ;u1tptnmiciadfm ua(vs t)trxrir iadom  ln i;s seuoxmpio4lpt mfct (fsrtmx poo1apto feildfmDua(ms;() etrmr3ty1fp eln slt)teuo(r oodolte fetlsfsDtrxrp;u1texnio3iydfmDrmump;() eenmo3iodlpDeluvil(  rxoxo3nodolt  icia( s2trxm ;u0opto ieiadfsDea( o;t0 etrir3iytlmDrau i s)trxrio ou1olt  nvtas)srururont0tltn ietltfmDea(vo ()tlxoircty1opt  n s t t2to(opoo1lmtemfctl()aDrrxrpot0teenmietyd sDrm(vp (0alerio3tadfa rlu o;( t2tmxm3oydlle lici t)s2umx o;u1aex iietasla ea( pnt4 rtnio to1fpte neils t2toir io1lpte icsat)arra(ro;t1opx  ociydlmDem(mp u0 exrir3iotfaDraues;(0 etrxo oodlp emnes (f Dua( p;o0tleoifetysfa2eanms (4 exnio3io1opD aies;s0t2toir oudapen icil(f Dtr( pno0tlx ifciatfaDul(vs u4 lxnxrctydla elivs;() rumxr3iu1ap n iciat)aDra( p;o0oetoiociasfsDum( s;(0tlxnmocoytfptr nesls0s2xr(mpiodam nmivs t sDrrxr ;t0tee  fcild mDuaump;() etrxr iotlpD anei;s0t2xrxm nu1lpt mfct t)sDrrxmonu0opxn i3iyt sDeanmp u0arxnxrciatlmDe n ol( texmxrpnydomtelivtat)a2tmx pnt1oexo i3iasfmDraumsn() eeoxfciotlmt  nvo s)t2umio iy1ole  fcsls) Dtr(ro;o0oeen feiatfmDeln pn()arenmrcoodfat aivo;( s2um(o iodop n iesasf Dtrxmont0aeeomoctadlsDranmo ()teenxo iadlaDeanvo;(0teur(m3ny1om   fciat)a2trx  nu1oeenmfctyd a2rlnvp;t)aleomrciodop eanvilt t2tmir no4al e nvt t srtmxmoou1olt mo3tyd a2em(vo () etoxf tydlp  auvs;s s2umiopoodllee nctas) Dtmx o;t4aptn ocias a rln pn(4tlxoir iadlmteli s;s)seur(m io1alteliesl( sDumxrpno4apen o3ias m eanvo u0aexrxf3tatlpt  uvol(0 2xrirpny1op  mieiatfa2rmu pnu1alxo feiatfs2rln p;u) rerifcoytlaDe uvols srxoio io4lptemfvtas)arumx p;t1apt  feiaslmDraums;u) lxrmociatlmD  ueo (0trxm(m3iodlpt  ies t arta(mp;u1aeeomieildlmDumu snt)teenxocia1omDr i o;t  rxo(o3iu1alee fvsasfarrm( p;t0tlenmictltls el(vpn()arxnxf tydfaDranvo;s  2xmxr oydal emfctl(fsDrmx p;o4tetoiieilslaDelumsnu) exnmf tytfm   neo;t)t2uo(o iy4lpte fet tf Dtm(mo;u0teen ocilt a2ul(mp;t) exrir iy1fa eluei ()t2xr(o iu1om   ncsl(f rrau p;u1texoifetytfmDrlnmo;(4alxoifcia1lp eau sl(0 2urxr oy4om e nvsa() Drmu pnu4oexn ociadfm2rln s;u0trxnirciotfat luvi s) 2xr(m3iu4op n net s srrru p;u0open fcilsfmDumump;t4trtnmf ia1lmD  n s t) 2to(opiu4opt mfcsltf rrmx  no0tlx mf3tldfm el( on(0treomf tadop eau s;t)t2um(o3nu1ameemncs ( srum(rp;o1tltn ictlsfsDranvonu0 etrmo3tadlpDelnes;s t2xrxo3iydamteliei (f 2ta(ronu4alxo ociasla ulu o;(4 renxf3tytfpDeauvolt)truoxrpnu4olte fei (  2tm(r nt0oet iictydfa elnms;u)arerifcoatlaDelnei;() 2uo(opnu1lltnmfcsatf 2rmu o;u0apx  feils s2eluvon(0trenir3ta1laDe i ol()sexo(rpiu1ape lfctl()aDrr(rono0alxnmfeiydls2rl(vo;(4tlxoio3totfpD lieil(0 eto(r3iudop   fet t) rum(  ;t1aee  feiadlm uanmonu) rtrxo oa1opt  i i;(  ruoxm3iy4alenmncsat) Dtru pnu0tex mfeilt m2ra(mp () reoif oydlat  ueols  etm(o no4lleemfeslsfsrumum ou0apx if3tlslaDum(msn(4aetrxrciatfa  lieo ()texriopiudlmeemietl(fa2rrx o;o4opt  ociytlaDem(vp;()alenio3oa1op eanes s)s2urxr3io4aptn fet t a2uaxmo;t1aeeomoetasfaDrmu p;t0tlenmociytfpDelivi;s  eto(o3oo1lm elfctl() Dtm(ront0ale io3tltlm uanms t0trxoxo3oatfm r ivils srxo(m3oydam  mfet tfsDtau  ;o0alto i3iasfs2el(mo;t4trerif3oadfp r ueil() 2umio nodalen iesl( sruru poo0tlt mfciasfm rauvp (4 rerxfcoydfm  luvils)t2xm(o oo1omt mict t)a2ur(m ou4tetnmi3tlt s em(mo;(4tlxnmf iotlaDrau s;s0 2xo(o3iy1lmtn fviat) 2urx o;u4opxniociad aDrl(mpn(0 ltomrciydlpD lnesls trxm(r3iydaleelncs t)a2ur( ooo0altn fetydfaDelnvo t0aexrir tatomD  uei (0srxr(mpnydam  mfetlt  rra(  no4olt moetysfa2eauvo (4texoio3ootlptrlnvo t  rxmxr3oo4om nmfet (fartmxmo;u4aexomf3iysfsDrmn s u)alxrxocoadoat lneo ()srxm(m ou1ape  fvias s2ur(mpno4tlt  feiysfmDrmnvsnu4 reoir iydfpD luvilt0s2toiopoy1opt  fviasf 2tmxmp;u0tpe io3ildls umumo u4 etomf iatfp rlu ils t2umxo3oo1ll   nei tf rtaxmont4oltoif3iadlm ulnmp (0trenxr3oatfpt ai o;t trtoio nudoptn fvta(f 2umxrpou0aptnmfeiltlm el(mo (4 reoxf3oodomtelivi ()sruo(mpnudam n fcias) 2tmu pno1alto ieiyslm emu o;u) renmo iytopt aiei;t)trxr(m3nu4lpeemieslt)s2uaxmp;t1ope io3iytfm2ra( s ()trxomf3oy1fpte uvi;( trtoxo no4omenlfeil(fartm( oot1olxn oetydfa ean p t)artoxocty1fm e nvi (  ruo(r ny1om nmnciat  Dtru pnu4tpeoif3iydfa2ranvpn(0 lxnmo iodomD aueslt0t2tmxr3iy1op  mnct tf Dur(mpot0aexnmieild a2ua(mp ()artnxr ty1lp elnei;s0 rxrxo io4ameemiviltfaDrrxr ot4oexnmociyd s ea( p u0trtnio tytomteluvo;s) 2tmxr3ny4lptnmnetls) rrru oou4tlenmociyd aDua(ms t4tltrio3oa1laDe uvs;t) rto(mpnodolte nviasf rtr(r ;u1tlxomfciadlmDean snu)teermf ta1la r ieol()texrxopny1lle  fes s)sDtmxrpno1aet mieiydfm2ua(vp t0alxnmrcoodlm rluvo () euo(mpou1olee fctatfa2ra(rpoo4texnmieildfm2emuvs t) ltoircoydfa rlu il(0trumirpoo4ll  lictat) rtmur ;t0apeoiictat s ulnmp u) ltnir oydlaD  u ol() rxoio iu4ameelfcilt  Dta(rpnt0tltn iciasla eaums;u0tetoxr oadfa rai ol(0trumimpoy1omt miet t) Dumxrpoo0texomf3iat mDrl(vo;t4aetnxfctotfp   u i t0s2xmxm3ny1lm elfei s  rta(ronu1oexomo3tyd aDuln o;(4 exnmocoatlaDeli i;s trto(o3oo1lleemnvsl(  2umx pot1tex ifeiysla2rmn o;t)tlermoctytlmDean i () rxrio oodoptnmnesa(  rrmu oou4aexoii3tltfs eln p;u0altoiociatfm e n i s0t2xrxrpno1apte fcsl(faDurum ot4aeen o3iad m rmn onu4arxoxr ta1fpteanvslt0 rtmxr oy4ome mfvsat  rtaump;o1aptomoeiltlm2ua(vs u0altnirctytomtrau s t teuoio3nodomt  ncsasf Dtau  nu1opeoii3ias s ra(mp;(0tlxrxocoo1optelivil(0t2to(o oy4oleelieilt  rrrum ;u0tpeoiieiysfaDem( p;(0trerxoctadop rlivi s truo(r ou4ome mneils)arur(mpnu4oeeo f3tldfsDuau o t)arxrioctadoa e ies;(0 rto(m3oy1omte ncs t)aruax pnu1oet  ietlt a2ua(vp;(4tltrio3oo1fmDr ieo ( s2urxmpnu4op nmncsa()s2tr(  ot1aptn fetldfa2rmn p u0artrmo3oa1lpt  neo;()trumxr oo4altemfvil( aDtrxrpno1ale  i3iyd s eauvp t4aetnmr iy1la rlnei;s setmxo oo1oltnliei sf Dumxrpnt0tpen ietlsfm uanmonu0teerxocio1lm  lnvslt0srto(o oo1lme lfviltfsDumxmo;t1tptnmfcias s ranvpn()texoif iotlmte ies;s0s2um(r3oo1opt lfctas) Draxr no4oetnmo3tytfsDumu s (4tlxomrciadlmDe nvi ( s2xoimpou1am elnvi t arrax o;u4oeeo fctyt sDra(vs u0 ltrxf3oa1fp eaivils)s2ur(opoodopen feslsf ruau ooo0aeeomo3tatfs raump u4 lxrio iatfm rlieo ( s2xmxrpoodom n neiatf 2ua(  nt4opxnmfctatfs rl(vs (4altrmo3iotlmtr n i s) 2trxmpnu4ap  lfet ()aDtru  nu1teen oeiys m2umn ont4 exrirciydlpDeauvo;s sexmxr3nu4ope  nvs (f Duaum nt0aet io3tatls rmuvon(4trxnxo io1om elieils teumxo io1oltn iet ()a2rm(rp;o0aex mo3iat mDra(vo;t)texnmf ta1oateau s s0t2uoirpno1optnmfcilt  Dra( p;t1opx  o3ildfaDumnmpnt4arermo3iy1fa r nvols)trtmxrpou4alt livia()a2rr( o;t4aeeomieils a rau ont0aeeomrctadfpt lneils)srxm(o3nu1ame miet s) 2taxm ;t1tlenmi3tytlm emnmo;(4artoio3oo1fmt  ivo (0s2uoxo iydamtnmiesl()s2rr( oou1tptoifeiydfs rluvo;t0aetoxo ty1oate nvi;()t2to(m3ny4ol elicsa(fsrumu p;o1teeo fciyt m um(vonu0arxomocootomt  nvsl(0 2ur(m3oy4omenmnctat)arumur ot0aeen oeilt mDum( p;u4altnxoctodop rlnvo t) eum(r3iydaptelfcs sfs2rrxmooo0tltnmictltfaDemums;t4 eeoif tydfpteluvsls tetmxr no1lmtemieias) 2rr( ont1aptoifctltla2eln o;(0tetoiocootomte n i t)s2xoim3oy1openmnvi s sDuaxr oo1tet moetld aDelumo ()teermrcoatoate ies (0t2tmxmpnudlpe mncsa()aDta(m oo4texn i3ilslm2ran p;u0arxnmociadoaD an ilt)t2urir3oy1ll  mncsa(  rrr(ronu4oltnif3iys a2eaumpn(4 etrmo3iy1lp eluvo s)texo(m oudlmt lfeia() 2uau ooo0optoio3iyt a2rmnmont)tltomociytop e uvols)srtoxr3iydaptnlfcsat) rra( ont4tptn o3iasla2rlnmp (0 etnio totomD auvs ()seum(r ny1amtnmnei s a2um(  ;t0oex ii3tatfm2ranvp;t4 ltoircta1fpte uvo;(0truoio3iydoptemfvi ( a2tax  nt4tpxnmocild m emu o;u0 rtoif ootoaD aneils)trxmiopoydlp nlics s)srua(moot4olxo ociytfa uau o t0artomfcty1op rlu ols0 2xoxm3iudll nmietl( arta(r nt4oexoio3iad aDul(vont4trtoiocoatoatelneo s) etoxm iu1lmt  ivsls artmxm nu4apxn oetasfs rluvonu)teerxf3totlaDeaivs;( sruoxm no1lpe mnvia(fa2rm(ro;t1aetn feiyt s ua(mo (0tltomr ty1opt aivo;t)trtmxr oydomt liesls  rrrx  nt4ope iictyslm uaums;u)trtnxo oodlmD ai o t) rxrxm3io1op nlfvtas  Dtr(mp;u4olto oetltfmDulnms;(0alxnmr totfpD auvs;t0t2xr(r ny4omee nes t  2trumoot0tle mo3iyd sDrm( o u0tlermf3oo1lpDranei t  rum(m nodop e nei ()aDrau  nu1olen ictytlmDrln o;t4trenmf3tytfa r ivs;t)s2xm(mpoo4amte netls  rumump;t0tpeo o3iydls uluvonu0aetomfcoydomD  nvils) rurir3iu4omenmivt t)aDrmum no4tpenmieiat a rlnmo;t4 ltnmfciodfp eauvs;t)truoxr iydom  lfet sfaDtmumo;t4aee ioctltlm2em(vsnt4trtomfciadoaD lieo;s0teum(m iydop emnvs () Dta(r nt1oeeo ictldlaDrlumo t4artnmr3ootfp e uvslt trtr(m3nu1ll elfetl() 2rm(m ot0ale mf3iat m ea(vsn()tetoxf3oodfaDrlnei t srum(m3oo1ome lnetasfa2ra(  ou1ole mfeias m2ul(monu4aleomf iydlate nes;s)s2urxr3ny1amt liciltfs2umx pno1apto o3ils m2umnvs u)altrxf oytlaD au o t0srurxr ny1omenmivilt)a2tr(rp;u1tpt mociysfs umn p u)teeoir oydlp eai ilt srxo(r no1ole mfct tfsrtau ont0teeo feiyslaDrluvp;(4 reoxf3iytopt livil(0sexo(o3oo1ap  micias)arrauroou4tpt mo3ild aDuan p t0 ltomf3tydoateanvols tetmir3ou1ap  mfvsa( srur(rooo1tpeoiociysfs2ulu p u4aeenio3oydfmD  n olt0srtoim iy1alenmici t)s2uaurpoo4olx mf3iat m2umuvp;t4aexnifcto1omDe uvols)trur(m3ou1om  lnvsl() Drm( onu0tpt ioeiltfs ua( p;u) rtnmf oodlaD lues;t  rtmxm3iodale mfvi s  2umu  no4ape io3iltlsDuanmo;u4 exoiocio1op rlueolt0 exmimpiodomen nvsls) 2rrump;u0aptn fciysfaDemuvo;(0trtnir3ta1op  ln sls0setmxr3no1ape mict () Dumurpno0apt  fciadlm ra(vo;t0 exoif3oytfa eauvi s0 exrxopoy4lm nlnvils)s2tmumpnu1tpx mf3taslaDum(vpnt) exoiocootomDe u olt s2uoir3oy4om n ivtlsfaDrmx pno4tpenmfciyd a2rmnvs t) renif oatoaDeli s;t0 exo(r3io1opee iet t) 2uru p;t0tlxo f3tltla2rlumsnt4texnxf to1latrli ils0 exoxm3oudam  mnvtlt a2ua( o;o1alxo o3iad a um( sn()trermf todla r ues;(  eumio3no1lme mnci t sDtaur ;u0tpxnioeiasfmDelu s;u0tlxnio oodop eaivs t0 rtoim ou1apen fct sfsDuaxrpot1olx io3ilsfa2uan s t0 exnirciatop raieo;t0 rxm(rpou1omtnmnetas a2rmx  nu0ape  o3iat a elnms;t4aeerif oatfp elivs;t)t2xrxo io4llee ictat) Duau p;u1tex mictytfs uan p t)texrio3oatfa eanesl()t2tm(m nu1olt licil(  2rrxroou1alxomoctldlmDean s;(4arxnxf3iytlmD luvo s0s2urxrpou4apee ici t a2rau ont1aptn ietld a em(vp (0arxoxrciatoptr n slt srurirpnodolte fetat srtax p;u4apxoifcilt a2ran p;t4trtomf oadlmDeai o;( teumxm3ou1olenlnviltf 2tmur ;u0oleoio3tyt s2ua( p t4 lerif oadomDr i sls srxm(m oydlp nlivta()s2urx pnt4opt  fetysfs rm(vpn(4 etrxfctadlp ran o;()s2toxm oudlltnlfci s)a2umum ot1oexniicils a ranmsnu) renxf totomteauei;t  rxoio no1apeemnvtas sDtm(  nt1alx iociadfs eln s
\ No newline at end of file
@@ -0,0 +1 @@
+uvi (0srtoimpnu4llee ivil(fa2urx o;u4opxnmietltfa2ea(vp;u4aeeomo3oodfpDrlieo s0 eurxrpny1lle lncsltf Dta(  ;t4tle mf3iyd sDumnmpn(4altriocoadfmteaieolt0srumimpiy1ap  mnvtas)artru pnu4apenmf3ilslm elnmon() etniociotlmt  i i t0t2xm(r iydlpee nvtlt) rtr(  ot0tlen octas mDemnmo;t4tetoioctatla e i o s  euoxr3oydlm e nctl() 2trx ono0apenifeils a ulu p;(4trtoiociy1opDr uei s0s2toxmpoudalenmivsas  Dua(rp;o0tetniictysfaDemn pnu0aetrio oatomte nes;(  rtrim no4amt miei () Drau pnt1opx ii3iasfm2uaump (4 eeomo ty1optrauvi;t t2um(o io1lptnmnes sfsDrm( o;u1ape mi3iytfs ua(vonu0 leomfcty1omDr nvo;s  2xrxrpou1ol nlfci ()s2tm(rpnu1oetnmf3iasfs ul( snt4 eermf3to1lmDrlnvs s0srxmir3iy1lm  lfeslt)s2raxmoot0apt  f3tltfa2rmnmp;u) rxoircoodlpt  u ilt texrxmpiodomt lncs (fsDur(  nt4tlenif3iad m2ul(von(0teenmr3todlm   n o ()t2uoxr oydop  lfci tfsDra( oou0tpx mf3tat s2uaump;(4 exnif3oa1oaDelu i t)srxo(m iu4lpe mfeilt)sDumu oot0alt mf3ildfa ul(mo;t4 eerxfcta1omt auei t srumxr ny4lltnmfvsat)s2ta(  ot4olt  fcildfaDea(vs ()teenmocty1fmt ai s;s0 rxr(mpiy1ape  ivs t) Dum(mpnu1tptomfeiydla ra(vo (4trtoxf3oydoa rli il() eurxr3ny4oltnmivilsfsDtaumoou0tlx  oetldfsDelu s u0tetrio3iotlp rln s s0trumxm3nu4ap   icia()sDrrur nu4tptomietyt m2emnvs;t4texnmf iy1omtelieol()srxr(rpny4op nlfcsasf 2umur ;t4alxoifetadlmDemuvsnu)trtoio3oatoaD  uei s0s2umxr oodol nmfctl(fsrraumo;o0olxn fcils aDea(vsnu0 etrxr oatlp elnvsls  rtr(r iy1lpe mfvsltfsDrm(  no1ope  i3ild m2emu o (0trtnmrciotopt ai i;() rtmxr3no1ll   net s sDrruroou4tet  oeilslm2el(vp;() etrxo3oatlp rlu i;t truoir3iu1lp nlneilt)s2rrxmp;t0aexn feiyt s2raump (4alxrxrcoy1om eli i;t) 2um(r ou4lmenmfeil(f 2rrxr ;o0aeeomoctldfm raumo (4aexnmfciodlpte ivs;s0setoim3iodal e fvsas sDtm( ooo0oleo f3iydfm2em( o t4 lenmfcoadlpDe ueil()seurxm3oo4lmte ietas) 2rmxr ot0optn f3iyt aDumn o;u)alxrir iadfmtelieils)s2urxr3ou4optemncs s arur(rpot4tpx iieiytfa uan s;u)artrxfcoadlpDranes s) ruo(m iydlpenlivil()artaxmooo1opt ioetat aDumnmpn(4trxnxf3totlmDeln slt  exoir3iudale  ieta( artr(rpnu4oetn feiyd a ua(vs;u0alxrxrcoodfa   ivilt trur(m3nu1am  lfvils  rua(mpnu1oleo ictyd s2rluvon(0 exrio todom  anei (  euoxr ny4ap nmncia( srua(monu1tpxomictlsls2uaumonu)areoir3ta1opte uvs;()sruoxopio4lme lfvsl(f 2urur ;u4apeo i3iys mDum(mp;()arenmrcoydomtraueo s  rtmio iy1om nmnetat) 2rmxr no0oet moeiatfs eanms;t4areoxf oa1lp  aivs s s2toxmpoy4oltn fvi t  Duau pnu1opxn f3ildfs2eau on(0teeomo3oa1lmD  ivs t  2umim3iu1lmee icilt)arum(ro;o1oetnioctls a2umn ont4alxomr3todfp  luvs;s  rtoim3oy1opeelietlt)a2ua(m ou1tet moetys s eluvp;() rtrmr oadfmDr nesl(0s2umiopiu1oleemfetlt  rtrx ont0texo i3tlt m2rm(vp;(4altoir3iotfpD aivi;s0 euo(m3ou4apt mies t) ruax poo0olx moctlt m emnvp ()tlxoioctodfmDrlnvs s t2ur(r3oy4ll elfcil(  2rmur nt4olx ifeiltfs2ua( snt) etnmrcty1fm rai s;s)tetmxmpou1ll elfvtls a2ur( p;t4olxn fctytls eaumo t4alxrmf3oo1lm e n o s tetm(r3io4alee fcta( s2uaur nu4aexnifciatfa2umnvp u4 ltomrcoy1lp eanes;s0trxm(m3oy4lp n fcslt)arrm(ronu4tlen ictld sDrmuvo;()arenif3oodfateaivo (0s2xoxopiy1lltnlfvsl(fa2tm(m ;t0oex  i3tldfm2rl( o (4artnio oo1omDe uei t  etr(m io1am e iei sfsDtruro;o1tpxoiociytlsDumnvo () lxnirciodfp rlnvi s0srtr(r oydomenlnvsasfarta(mp;u0tpe ii3iydlm2emnmp t4tltrmfctodoatrauvo;s) etmxm3iy1op emivsl( s2rmu pnt0oexniiciytfmDeluvsnt)arerxo oodom elnvol()srxo(r oo1llt lietat) rua(r ;u0tetnif3ias a2eln s;(4aexomo3tadoptr ues;( seumxo3ou1om   neta(fa2trxmoou4opxn f3ias a emnmpnu)artrir3oy1lmDe n s;( t2umio3nu4ll  mneslt)s2um(mpnt0olxnioeiatfs eluvo;t0trermo ta1omD aiei;(0srxm(opny4alenmfci t)artaxmpot1tetomo3iytlaDrmu o;u4 rxrxfctodlpt  ueolt)texoxo oodal   ics (faDrmxront4oltomfciltlaDrlu snt4alenirctadlpDe n s;s0s2tmxr oodoltemnes t) 2taxrpot1optnif3iytlsDum(vpnu)arerxocoodopDrli ols0teum(r3iydapenlfvi s a2rmu  oo4tet  ociad s2uan o (0 leoxf3oydfmDrauvo t0sexmirpny4lmeelfeil() rtmur nu1oexo fetlt a rlumo;u0trtrxr iytfmt lnvsl()tetmio3iy1ol elfctat)a2umu  ;t0opeoioeiasfsDumnvp;t)tetoxo3iodfp elnvs s seuoim3iydop  lfeslt)a2urxmooo4aleniociydfa2em(vs;(4treoxf3io1fmDeaiei (0teumio3nodopeemnctlt sDrrx  oo4tltnio3tasfa emuvo;t0 exnircto1lm  auei s)srurir3oydoltnlics (faDrmu  ;u1apxo fctltlm2uaumo;(4arermo3ty1fp eanei;(0sruriopiu1optn icslsfa2umumpnt4opeoifeilsfm el( p;t4trxnmo ootfmte neslt)t2xmxr3oo4al nlfci (  rtmu  nu1tetoii3iad m umnvp;u4areriocoa1lpD an s s)s2xrxr no4ame mfvilt) 2tmxmonu0aeeomfciltlmDrlumo;(0 rxnxf3oo1fmDrlueil()seuo(rpnydlp n iesls a2tmumpoo4aexnio3iytla rau p;u4tlerir oadfm eaieilt) exr(o3ny1lm nmnvtls)s2raur ot1ale mfeildfa rmn s;u4 eenif oo1op rlneol(  euoxr ou1aptnlncta( a2ur( oou0tet moeiydfmDuln onu)tlxrmo tytoat lies s0srxrir3oo1aptnlfvsl() Dur(rp;u1olxoiietys m2ranvp;t0trtrif ootomtelies;() 2umio3iudlm emfcils)sDrm(  oo0openifciltfm2em(mp ()tetoxf3iy1opteanvo;(0 2xrxr nu4olt  nes s srrr(mpou1ope  iciadla2rmn snt0alxoio oadfpD  ueo;t0seurxr3ny1ll   iei t  rraumoot1olxnifcilslmDra( o (4aetnir3oadopDe u ol( sexo(m oudol e icsa()aDumu pot0apeomociytlm rlnms u4texrxf3iatfp elueil(  rxoxmpno1llen fetl()a2umx pnt1tpe  ieiysla2rauvp u4trtnmrciydfmteln s;t0t2to(o iu4llenlfeiatfsDumx pot4oet mfciadfa2rln pnt0tlenif io1lm  lu i;t0 2xo(m no4ap emieils aDrm(mo;o0aex iieilt s rmu pnt4aetoxf3todfmD luei;t0s2uo(opoo4llen fetlt s2umurono1oeeniietldls2rlnmp t0aeeomf3oydlaDe nvo;(0tetmxm nodamen ies tfa2tmx o;u4tptn oetytfa2el(mo (0aexnifctadopte nei (0 exo(r ou1ll n fcsa( s2tm( oou1tptoii3iatfaDelnms t4aeenmf oa1opDrlu sls s2xrxopoy4lmtn feias) Durxro;t0apenifeiadls ra( pnt0trtnxfciodop  ln ils tetmxrpnydlp nmfctl() 2uaxr oo4oexomi3tasls2rmn pnu) rtoirciadlpt aivo;s0 euo(opiy4olt mncil(fa2umxm ;t0tlx ioetas s rmu o;t) eermf3iotfpD  u s;t0srur(r3iy4lle  nei sfaDtaumo;t4tpt mo3iadla2em( p t) rxnmo iadla elivi;(  2xmirpio1op e iesl() 2trumpno4alxomieildlaDra(vont0arxrxr todfm rlies;(0srxr(r io4ol  lics t  rtr(  nu4aet iietlt mDranvp;u)altnmf3iydla eln olt)teum(m3oo1am   ivs s)s2trxroot4oee mociasfaDuln onu0 lerio iodla r ivsl(0 exo(mpiydomtn nviasfsrur(  oo4tetn oeiltlmDulu o (4aleoxf iadla eaneo s  2xm(mpiydamen icias)s2raurp;u1tpen o3iatlm uan pnt)teeoxfciydoa  lu sl() 2urim3oo4ome lfvi (f rtr(mpnu1tlx  o3tat sDrmuvsn(0aeeomr iy1fmte neol()s2xmxopno1am   nvtl()a2umurono0ole mietadlmDeln on(4artoxf3ty1fp eaneol( srxmirpoy1olt mncil()srtax pno4tet iieias a uanvs;(4tetnmoctatfmD li s;s0truoxm oydolte fvt tfa2trur oo4tetn o3iydfmDrm(vs t0arxomf ia1lm eai s;(0s2urir nu4opte fet (f rumx o;t1oexoiieiyslm ra(mo t)aetrmocoytomDeau i;s)srum(r oudamte feiat a2umxrp;o0tlt  ociat a ul(vs (0alxrmfctytfa   u sls0 rum(m3oydoptn ieil(f 2raxmpou1alxnmietltfa2ra(ms ()aetoirctodomD livsl(  rurxrpiu1oltelnvias)srta(m ot1tpx mfetasfa um(vp u4alxrmr totoptranvils0setmxr3nu1llenmncsl()aDrr(r nu4tet ioeias m2ea(mp t0alxoif3ta1fmtr iei;( setmirpoudolt mnvt t  rrrx p;u0tpx mfeild a2emuvo t4arenifcoydlatrluvslt t2xmio io1apte fesltfaruaxrpnu1aeenio3iltfs2um(mpnt4areoiocoa1laDeau olt)s2toir3iu4lpte neiat  Drrx poo1tlen f3tys mDemums;u0 reoxociytlm rlnvsl( sexr(r no4lleemnviatfarrmu pno4apeomi3tasfm rmu onu0alenmr ia1la  auvs t0s2xrxo nu4alee ics tfsDtrump;u4opx  iciyd mDeln p (0tltoio to1op e nvs ( s2xm(o nodaptelietas)a2taurp;t0teenmociyd m ranvo t)alermf3oytlm  aiei s trtmio iudamtelnvsls)arurum nt4opx  oeiyt a em(mo t4tltrio3oy1lp ean ilt0trxrxr3oo4ale mici sfaDrmxronu0tpto f3iasfa elumon(4 eeoiocoatlaDeanei;s)sexoxopoo4al emfetls  Drmu p;o4opxn ietls sDeau pnt4tltnxocia1fmDelivi;() 2to(r ou1ll   fci () Draxm no1tpt ii3iyslm umu snu) ltnmfcoodfpD  i o (0srtm(rpiudope  nvsa( sDumumo;t0tle io3iydfm el( pnu0trtrio tatfp r ivols)seum(mpoodll n ncs s) rrau ont0opt iociydla ul(ms;t4 rtrxo3io1fpDr ivi (0t2ur(mpnodlme mfetat srurxr ;o0optoioeilsfmDum(von(4arxoxoctydlm r ieo t seumimpoy4lp  lieias) 2ra(r ou4apx moctysfs2ra(vo u4teeoiociytop r n o ( tetr(m3oo4lmtnmivtas srrrxroou4olxo fetyd a2ul(vonu0altrmrcio1lptrluvolt0s2tmxmpno1am  liesa( sruaumpou1oexomoeildlm eau p u4 lxrifciadomt  i s t) 2um(o nudopee nvt s) Drr(  no0tptnmi3taslmDrmumo;u0trenmrctatomD anes t) etoir no1lltnmnctlsfsDumxr oo1aee mocilsls emump (4arxoirciadlptrauei t0srxo(r iydomtelfcsltfa2rmuro;o1tetniictls m ea( p t4 rtnio3iytop elies ()srtmxm no1om  liesas)s2taumpno1tptomoetatfa um(mpnt0aeenif3iadfm eaivi;() rxoxr iu4lp   fet () rrm(mooo0tlt if3iltla rauvp;t0tltrmf oadlaD luvo;( teuo(r3nu1op nlieiatfaDtaum ;o0aeeo feiadlm2eau p t4tltnmo3totlptr i o;(  etoio3ou4am  lfctltfaDtaxmo;u0texniiciadls2emnmp (4 exoxocoatoateanei;t0 etmxr iu4opeelnvta(f Dtmur ou0alxnmf3iadlm emuvpnt)tlxoio oatomDraivs;s)teuoxo nu1altelicia( srtaxm ;o0tex io3ilsfaDumnvpn()altnmr3ta1oatr uei;t  rxr(opiudop   fcia()arra(r ;u0aeenmfcias m eanvp;u4trtrxo3iydlp   neslt0 2xm(m ny1amenmfes () Dumumont4tetn ieiat s ulnvo;u4tetnxfciadop rlieo;t0truoxr3oodlpeemicsas) rrrx ooo4olxnioeiyt s2ea(mo;t)tlenioctytopt ai o;s)teuo(rpiu1am n fctas a2ra(m nt4aex mfetlsla2rm( p t4tltrif3ia1om rlivi ()s2urxr3ou4lmtelnvi (fsrururo;t4openmf3tatfa ua( sn(4aetnmo3iotom r ueo;s) eurio3ny4ome  nvt ()arrm(ro;u1oetnii3iydlm2ean o;u4altnif iy1fm r i olt0srum(o oo4alee nctl(f Duru pnu0tptn icias mDuln o t) renxr3ootfa  auvo s  euoxm3nodomeelnvi tfarrmu ono4tpeo i3ilsfmDra(vp t0tlxnmo3to1fmDeln o ( s2trxrpnu4optnliet ()a2trxrp;u1tlt  feiltls umuvo;u) exoio ia1lateau o s tetrirpoy1ome mivtas)a2tau p;o1olto fetyslmDranmsnu0 ltoio3io1oatr uvo;s) 2umxm3iy1op nmnvtlsf 2ra( o;u4aetoiiciat a uln o;u0trenir oadop  anesl()trtm(r iy1lle  ncsltf 2umxr ;o1olt  ociys mDul( o u4 ltnir oydoa  lueo;( tetr(m iu4apeemncsat)sDtrxmont4olxoioetytlm ranvp;t4 etniocty1omD ln o ()t2umim iu4apte nesa()arrmu ooo1tpxnmictadls uaump (0trtnmr3oo1fp e i i;t0s2xr(o3oydapte fvsa(f 2trxm nu0olt mo3iydfa2em( on(0 rxrxocia1omDeanvilt0t2tr(o3oo4al emfes (  Draxront4alt  feiat m2umu s (0arxrmo3oa1opD auei;t0seurxo ny4ol nmietlsfs2raump;t0oee  iciysfm2em(ms (0 leoxo3ty1omD lueils trurxm3oo1ol e ietlt arrm(m no1aex mfctlslmDumnvsnt4texnmf tydlpD li ilt)trxr(o iu4omtnmieta(fa2ur(rp;o1oeeo fetlt a2elnmpnu4altrmf io1opD liei;t truoio no4op  lnvsa(f 2rrx poo4tlxn icils sDrl(vpnu4teeomo3iy1fatrli sls0setr(m oodop e ncs (farrmx  nu1tltomieiasfa2ranmsnu)tleoio3tydlmDr nei;t seum(o3oudlpeelfvia()s2tm(  ;t0olenmfeils m2ea( pnt0arerifcoa1faDrauvils0 rxm(mpny4llenlivsat artmxm ot4oex mf3tlsfm2el(vo u4trxomf3tytla  livs s0 exoxo iy4llte neia( a2tr(mpno1tex  o3tytfsDum(mo;(4arxrxr3tadlatranvsl(  rtr(r nu1aptelnesa() 2rr(mooo1alx  ieiatfa rlnvp;u0aexoxrcoytoa elnes s sexmimpoydlle livilsfaDtaxmpnt0tpe  fctyd m umnmo;(4artoxf3oadoaDrlueils)s2tmio oydll elnvta( sDtaxm ;t1oee  f3iytfs ra(mp u4aeeoir oa1opte uvi;()sexr(opnu4lp  lnvias)s2urxrpnt1teen o3iltfa uanmpnt4tleoxrcoo1fpD ai s s)truo(o iu1lp   nctls  rumu ono1altnmo3iysfmDum(vs t4tltnxfctytfpDeanvo;()trtrxrpnodolee fctatfaDrm(rpot0oetoif3tat aDemnms t4arenxr oadlate nvo;s0t2xmxo3ny1apeelnvsasfaDrax poo1texnmfeiatfm ra(vo;t0trtnif3oydlmteliei;(0s2uo(o iu1ol nmnvt sf 2rm(mp;u4tltomfciaslm2ean pnu4 rtnxo3ta1la eai ols texoxopny1olenmnct ()a2tax  oo1tet  ictas aDem(mp;u4 rtrmrcia1oa e uvsls trtrio ny1olenlfcs (  Dtax  ;t1tle iieilsls2rmnmont0 eenmfciodopDeanei;t)trumim oo1lmt livt (faDrrum nu0aptoiiciytfaDem( p;(0tetnmr oydopD  nes t s2um(r oydllt lnesl()sDua( pnt0apeoio3iys sDul( o t4tlenmr3to1fpte ieo (0sexoxrpnodll nmfciltfaDuaxmo;o1opxomfetyt mDrlnvp ()aetnmrctodoptelu o;()tetoxopoo4amtnlivsls a2rm(r nt0olxn o3tat m eaumont)altnirctadlp rlnei s)tetmxm iudlpeelies s)a2umumpnu4tee ifciyslaDulnvp;u4aetomf oo1fmDe neols  exoxmpoodaptemneiasfartruronu4oleoifeiltls rlump t) ltnir tatlaD  ies t) etoxo3ny1ape  ivtas sDrmxm nt0tlt ifetlsfs rmnmpnu)tlenxo ty1fmDelu olt0 exrxrpnu4olt lfes t)sDrmxr ;u1opxn f3tydla ulumpn() lxriocio1lmtrlneo;s0texrio3oydol emies (  2umuront0opeomfeildfs2ulump t0aeeoxf oadfaD aues t  rxmxo3oydlmenlivil( a2ra(mpnt1tpen fctysfsDea( p;t)altnmo ootomtelu i;s texoxmpny1omte iei t srumx onu4oeeo oeildlm2emn snu4 exrmociotlpt luvs;s)t2to(rpiydlm n fcia() Drax poo0alx iieiys m rlnms;u0altrmo3io1fatelu s;t)setr(o ou4ole  ivsasf 2urumpou0oetomoetat m eauvo ()tetrir3oatlaDr uei;s  2xrim3iydal  lfcil(fs2rmur ;u1olenifetas a2em( on(4altoxfctydomte ivs t)trto(o oy1am nmfvi t  2umur nu0tpeomoeiltlsDrlnmp t0teerif oodfpDe u il(  eurirpou1lmee icsl( s2taxmp;u4aptn o3tltlaDuauvo;u)tltrif3totfmDrlnes;()trxmiopnodop e icilt  rrr( ont4aptoifeilslmDrlnvs (0trxrif oodopD li ils)teum(o3nydamtn fes t  rrruronu1tlx ioctyd m2um( o;u)trtomfcty1fmDe iesl()sexo(m oo4lmt  feia(  2ta(r oo0apt  feiad s2raumpn()trxoxo3iotfaD  uvo;s)trxoxo oy4apee ici (faDumxm ;u0oetomo3iytlmDean o;t4teenmo3tadfpDeauvils0 eumxmpnudlmtnlfvtlt)s2urur nt4tpxomfctasfa2rmnms;()alerxr iodfa   ueols) rur(r oy1lpen fvsls) Drau pot0tlxnioeiat m el(ms;u4altrir3oa1fa  auei;t0seuoxm3oo1lpte nvtat) Drmxr nt1alt mfciatfmDuan pn(0trxomf oa1oa e uesl()s2tmxm iy1omenmivtatfsDurur ;o0olx moeiadfmDelnvonu4altnio iadfp  aivi;t0sexrxr iy4am nlfcsls aDrm( p;u0tpx ii3tls mDulu on()teenxr ia1fpt anvils0seurir nodal  mfeta(f Dum(mp;u0opeoio3iadfm ulumo u)texrmo ty1omte uvi t trtoxopnu1olt lnvsl( aDrrx o;o4tlen ociltfm2ua(msn()arxnxr3oodlmte ivo;s0tetm(mpiudam e nvs (f rurx ooo0apeo f3ilslmDemnmp;(4 rerxfcia1lm   ueils teuo(r nu1ol nmnesl(f 2rrumo;u0ole  i3iltfm2ulu p t0tlerxo3iadlm rau o;t0 rxmxr3nu4lm emict s srtmxr ;o4optnmfctytfa ul( p u0aetnmocoadfp elu ils)sexmimpnodolenlfeta()sruaum nu4alx ifeiad mDelu o (0teerio3oydoaDean s;s)tetmxr3oo1omtnmivi ( aDtrxr oo1opx  ocildlsDrm(vp u) rerio oydopD  ueo (0tetoiopiydlltelncsa( arrrum nu0ole if3iad aDrau on(0artnio3ia1fptrau ol(0 2tm(r nu1op n iesls)a2rrx  ou0aetn fciydlmDranvo u0treoxoctotlmteanvi t s2umim iy1lpenlieiatfaDtmxr nu0tptn ieiadfs rl( snu0teeoio3iodopt luvs;s0texrxrpny4am n ies ()srrmxrono4tpt mfcias a umnvon(4arenxf3to1lat luvi;t srxmxo3oudameemnvsl()sDrr(rpnt0oee mo3tyt m em( pnu)alenxoctadlmD  n o t seur(o ny1omen icslsf ruaumono0tlto ieiasfm2rlumpn()arerxf oadoa  ln s;t0tetoxo iu1amtemfvs tf Dtrx  ;t1apxnmietlsla ulu p (4aeerif iydoaDean il(0 etmxo3iu1lp emnes (fsDum(m ;u0opxomf3tld s2eanmo;t0teeoxfcto1om eaivi;s tetrio ny4am emieil(farua( p;o0altn fetyslsDranvo;t)alerxfciytlm raneils  2xrimpoo1llenmncsls  Dtau o;u1oee ifeiltlm2ra( p t0aexrmr3iatlaD aneilt  rxm(o oy4al elfctat)srrr(mo;o1alt mieilsfa2emu p t) eeoir oy1fat auesls0texo(mpno4alee iesa()srrrur ;t4ope  f3ild a2ranmo;t)teenmrctodopt ai sls0srxm(rpnudolenlncsa(faDtrur no0tpt mietlsfs2umn p (0tleniocio1fa   iei;t0 exo(r iu1ll nmnvi s) 2urx ooo0tle ioeiys s rlums u4trtnmrctodomDr iei;s0setm(rpnu1ll e nes s) 2uax ont1apeniieiysfsDemn p;(0aleomo3iodfa   ues (  2urxr nu4om nlnes ( artm(moou1alxnii3iys a2ran pn(0trtoirciytfa rluvo t0trum(r3ny4openlnctltfsDta(mooo1optnifetas s2em( ont)tlermr todfmtelneo t0srtm(opnu1ol emncilt  2uaxmo;t0apto oeiltfa2ulnms;t0tlxrir ia1latraneo ( s2umxr nu4ol nlnctasfaDtm(root1tpe if3tatfs2uauvp t4texoxo3ia1opD  u slt0 rtriopnodolenlicsls) rtru p;u0olenio3iytfs ranmsnu0arxnmf3ty1omDraivs s t2xo(m no1lpen ieiatfarraum ;u0aet  ietadfa eln ont4 etnir3tytlmtr ivs;( sexr(rpiodlpt mnviat) Duaurp;o4apeoio3tatfm2eauvp;u4 eeomo tatoaD luvol( teumir nodaptnmfcsls) 2umx o;t4apeoiieiltfa rlu ont4tlenir tadomDraivo;( s2toxmpny1lmee feia() rur(mpoo0tpxnmociaslmDrlnmpnt0 lxrir3tatoa r n s t s2uoxr oo4alt micils aDurumooo1aexn ociytlsDelu p u) exnxf3oa1late n s s)seurimpou4op nlnet () 2tr( pou0tptoio3tltfmDel( p (0 leoio tytfaDelues;s0s2trxr iy4lle mfvt sfsDua(mp;o1tlt moctatlm emnvp;u0 renmfcta1om rln o s t2uo(rpny1lleeliei (fsDtau  ou1tetniieiydls2ul(von()alxnmo3oydlmDr ivo t) eto(o3oudlp  lfctls artm(r ;o1tpxnio3ildfa ran o (0 etnxf oo1lpDr uvslt0trxrio iudamtnmietlsfaDuau ont1tptniicild m2rau p () rtnif3iy1fmt luvi t0teuo(r3nydal   ivias) rtrurp;o1apxnmf3iadfa2rmnms u4 eeoxrctotfmD aneslt) 2trxo oydoptelict t  2uaxmpou1olxnmieiyt mDrl(vs (0altoxr3iytfpDeauesls s2toxm ny1ll elfet tfa2ua(  ou0alxoiociltfaDeluvonu4 etnif iy1fmDelivi;(0t2uo(m oo1omt mici (f Draxrpot1aeeomf3tld m uau p t)artrxf3ootoatrlnei;s0texmxo oy4ome lnci t) rur( o;o1oeeomf3iltfsDemnvp u4tetoif3iatopDe u s s0 eto(m3iu4ll nlncs sf Draxmpno4tlxomi3iadfmDua(monu) lermfcoo1oateluvs (0trxrxrpiydolenmnes t) Durumoot1ale  fciasfm rmuvpn(0alxrxrcoatlaDr i s;t) rtr(o3ny4am elfcs t  2tmu  ou4aptomfeiyd sDulump (4trxoiociodfpte ues;( setoio3iudomtemnciat  rumu pno1tptn oeiadlm rmums;(4artnxrcoadfa elues s)trtmxo3iu1ol n ict t  Drm( p;u1texnio3ilsla2rl(ms;t0trtrxo oodom  ln sls seumim iudlltnmfesasf 2tm(rpnt0tet mocilt s uauvp (0arxomocoodfa  an o s t2uoiopnu1op  mfetl()srrmumo;o1optnmicildfsDulumon(4tleomo oy1opD  u i;t)t2um(o3io1alenlncs t aDuaxrooo4olxoiociasls rmnmp;(4artrif3iatfpD luvsls0 eur(o iu4am elfviltfa2rmx pnt4optomietasfa2umumpnt4tltomr3iatlmD  ieo (0seum(r oo1ap   nvsat) Dra(ro;o1tleoiocilsfa emnms t) lxnxocoodlaDelu ols0 exmxo3oy4al nmnviltf Drrumpou0oee ifeild s2eanmpnt)altrxr oa1fat  nvo t  rtm(r nodomeemieslt) rrr(mo;u0tlx if3ild s ulnmo t4alenxfctadom r ues s)srtmxr3io4omen ieiatfsDurxm no4tlxn ocias sDulnvon(4trxrmo3iatom ean i;t0sruo(
\ No newline at end of file
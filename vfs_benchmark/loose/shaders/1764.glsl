@@ -0,0 +1 @@
+neols0 2xm(o oy1olenlfctl(f 2rmur ;t1opxnmfciatfsDum(mont) rtnmfcoy1optr nvslt)t2umio3nu4ope mfet sfaDuaxrpno4tpen fcildfs2ranvs;u)tltniocty1opD lnes ()srtmxopoo4lmt mnetlt a2rrumpot0oee  octad a2umuvon(4arxoxo totfpDr i ols)srxmxrpiudlp nlnvia(fsDra( pou0tet if3tldla umump t) etoxr3totlp e uvils  exrir no4llt lnet tfsruax oou0tlxomf3tatfm2ran s t0tetoxo tytomDe i i ()sruo(m3iu4ol n iet (faDtaum ;u4aleomo3iys m um(vs () rtrif ootom eaiesl( trumiopoo4opt livs t  rtm(roou4apt mfeiltls2ulnvont)tetniocoy1optrlu s t t2urir nydome  fei ()s2tau pot4tpx ifcias sDumuvon(4altnir ty1om eln ilt0s2trxm3iodlm  lnci s s2ur( p;u1alxoio3tldfm uluvo;t)tlxrmociy1lateanvilt seumio iy4lpt lfes s a2rmurpoo4aptnifeiatlm ul(mo u0 eenmo3todlp ean s;(0 exrio oy1omt  neslt)s2tau  ou0opx iicilslaDrmu pn() rxrir3tydomDelueolt) etm(r3oudop  mfvtas)aDuax pno1alxo oeiatfmDelnvs (4 lerxr todfpte n ols t2trxm no4ll nmnet sfarumx pou0tleoiiciltla rlump u0 lxoifcootla rln slt0 exoxo3ou4lpeemnvtl(f 2tmu  ;t4tle ioeiysfa rlnvsnu0altnxrctydlat  u o (0truoimpiodlm elnvsa()s2urx ont1olt  o3iyt sDel(ms t0arenir oodoatr ieolt0srto(rpoy1lmt mnvtasfaDta(mo;o4aleomi3tls aDran s ()areoircoy1opD luvsl(0s2xo(mpno1lmtemfci s)arur(ront4oleo fciat s2um(vpnt0 eerxf tytfat  nes;()trxoxopoo4lle lnvil()a2umu p;t1apxo i3tadfaDeanvpnu) renmo3iatlmteau i ()tetr(m3no4amtn nvtlt)srurxrp;o4tpt mi3ilslm2elnvpn(0tlxoxo oadfmteanvo () 2xrxopoodom e icia(  rumum ;u1tpe mfetad a rm( p u4 etrirctodom rlueo;t)teumxo3iodll nlfvsat a2ur( poo1tptomfcilsfs2ra(msnt4texomrcoadfp e u s t) 2trxr3iudlmtelnviat s2raur ;u1apxnmfeiaslaDua( s u) rxnmrciydfpt  n o (0 2urxm3nu1ll elnvi ()a2rmxrpnt4aetnmo3iyd aDrl(monu0 rtoxocoatla  luvo s0setm(o oodal  lnvilt)arumx pou1aexnmf3iysfaDem(mont)aexnif3oa1la elivo () etrxm3ny1omte fcta(f rtruronu1aexomi3ilt aDumnvp (0 eeoircoy1laD anvo ()sruo(o ou1am nlnctas) 2tru  ;o4altn o3iyslsDeanmp (4 lerir oatfmteaueo t  2trir iy1lmtnmneslsfs2tmu  ou4olt io3ilt s2ra( s t0 ltnxrciy1lmt luei;(0truoxm oodole mncsasfsrta(  ot0apeo fctysfm2rl(ms t4aexniocia1lat lieo t)srumim oo1apenlncs s) Draxmoou1apenioetls m umn o;u0 reoxf3ootla rlieo (  2trim oo4om nlfeil(faDrmurpnt4oetnmieild sDem(vo;u4 exrio tatoa   ivs t) rxmim3no4lme mivi t sDrruroot0olx mo3tldfm ranmsnu0alenxr tytlp elnei t) exriopiy1alte fetatfsDuax o;o1tee mo3iasfs2ranvo;t4 leoxo ta1lmtrau ilt  ruo(r oo1op nlics sf Dtau pnu1aptn ictysfsDran s u)aetnxr3oydfpte n i;s0trum(r3oo1amt lncil(  2raxro;o0opeo ictydlsDrau p ()tetrmociotfp rai sl()t2tmimpoodlp e ivsas  Dua(  ;o4apxn ociysfmDuanmsnu4tlxnir3oydla rlivo (  rxrimpou1optn fet s arrrxmp;u0olenmfctytlm elnmsnu0 exnir3to1opDeaies;s0s2toirpoo4om emfvsat a2raxr ;u4alxnioctad s umn p (0trtrmo todomte i sl()trtrirpnodom n neiatfsDum(  ot1alxoioctysfsDeluvp;(0 renmr tadfpDrlieo t) rtoxm3nu4opeelfvsas sDtmu pno0tpx  feiadfmDrmnvo;u0alxnir iotop   u o (0s2ur(m oy1alt miet sf rtru  nu1tpt  ieiydla rauvs u4 leomr3io1op e nvo;s trtrir3iydoptnmfvsa()a2umx  no0tetoif3iydfmDrau p (4 exomr3tatfmt aues;t  exmxrpnydamtelfct tfaDtmum nt0tlenmi3ildlaDum(vp;t4arermrciadlp eaivs t setm(mpio1optemnvsls sDtr( poo1aeenioeilt s uan p t0tlxoio3iotlmteluvolt t2um(o3nudom   iesa(fsDtax pou4aetn fciyt a rmnmpnu0 etrxf io1oatrauvs;()t2uoio3iodlm nmfeilt) rurxrono0olenii3iltfa2ra(vs;(0 leomoctodlaDeanes;( t2xoio oydop nmfvil(fsrrax o;o0tee mi3tytfs2emnvs u)trxrif3iadlm   u o s0 exoxopiu4lpeemncia( sDurxmo;o4aeeo f3tadlsDumnms u0 lxrmrcoadlaD aivo s)s2uoxr ny1lpt  ict (fsrrmum no0aetnmfciytlm2emn o;u0altnmr io1lmD  i o;s0srtoiopnodolee ieia() rraxr ;t4tltoiieild m rl(vo t4tleoxr oadlmtraneil(  eum(opnudomtelfct s  Dtmu  ;o4opto o3tltfa2um( onu0trtrxr3oy1lmDelnvi;s0 rxmio3nu1lpe mnet t s2ur(r ot0aetomf3tld aDelums t4tlerirctytfmD lnes t)t2tmirpiy4apt licia(faDtr(  ;u4olt  ociatlaDran p;t4 exrioctodoat  u ilt)s2umio oo4aptnlfesls  2raxmpnt1alxoifctldls2emuvo u0arenmf3oatlpD anei;()s2xrxrpoodame  fct s) rtmurpno0oetnmociat sDumu o;(4 lxnmo oy1fa ranvsls)sexm(mpiu1ll emfvtat srrrxrp;u1tetoif3iysfs2rln p t)aexnmf3oa1op r neo t texo(r3io4op emnct sfsDtr(ro;t0alxnmi3iydfs rm(vsn(0arerio iydlm  ln o t0tetoxo3nu1om nlivsasf 2ururo;t1olenioeilsls2um(mo;(0trxnifctodfaD luesl( srumirpiu4lm nmfctls)s2ra(mpou0optoio3tydlmDulump;t0 exnmr oatfm raieo s)tetrxr3no4optelfes t  2ta( pot0ope  feiadfmDumu o u) renio oo1lateai s;s0trtm(opoydamenlfeilt arraur ;o4texo ociltla2rm( o;u)trtnio3ta1faD  i o t)s2uoio3io4apeelfcta()aDur( o;u0alenmoctltfs2um(mp (0 exriociytfp   iei;()sexoimpnudolt  ietl(  rurxrpoo0oleoiociasls2rmnmo u4alxniociatfpDelneo;() 2umirpno4olt mieia()s2taxm oo0olx  o3tad m ra(ms;t0alenxr io1fmD  u sls) 2trxo nydameemfetlt)srur(mooo0oex  oeild aDuanvs;(0aexnir iydlp rauvo;(0 euoir3oo1om nlfeiat) rtaxr ot0alt  fciatlmDeln s t4 lxnio to1fmDeanes ()srurio io1apte ncilt  Dtmuroou4olenmi3iyt m ulnvs;t0alenmo tadfm rluvi;t)t2umimpnodlmtnlfci ( arur(rpnt1tlxn oetad a rln o t)alxomf3ta1fpte ues (0texo(mpio1lltnlietlt  Drr(ro;u0aex ioctydfmDemuvsnt4 leomr io1fp   ieo t trurxmpio4lltelicil() rra(mpno4oet mfeiyd m um( p;u)tlxrifcoadfpDe ivs;t) ruo(opio1omee ictlsfsrumxro;u0aetoioetytls2ul( o;u4 ltrxrcoo1omD anei;t t2umio ny4olee fvi s) 2trumpou1ole  ictltfa2uln s;u4alxnxociatomteanei;s)t2to(o3no1lmen ncsat s2tr( poo0tetoiiciatfa2eanvs ()alxoir tadomtean i;s0seum(r3oy1olen fesa()s2tr(rpou4opx  i3iyslm eaump u) etoirciodfpD li s;t sexmiopoy1am n fet tf Dumxmono1aee mf3iydfa umuvo;t0texnif3oatoptrluvo s0trtmxr io1amt mnes t aDtmu p;o0alenif3iatlm2umu pn(4tetnirciy1fatraneilt)t2xmir nydalt  ieia(f 2taxronu4tpt ii3iysfsDranvo;(4aexrxr ia1lpteaues;()setoim iy1amenmictl( s2rruroou0oee ifetyd m2rau pn()alenif3iodoaDr u s t  2umio nodlmeemictasfaDrrumpou0alxomfctytfmDulu s;u)artrmf3iatfaDr uvs;s0srum(mpny1al  lncs t) 2uru  ou1aptoifeilt a el(mo;(4trxoio3tadlat li s ()setr(o3nodame  fes s a2rr( ont0ape ifeiatlsDran s;(4treomf3ta1la  aivi;t0seurxr oo4lp emfct s artrxrpou1tet  i3iltlm2eanmsnu4texrio oo1lpt lnvilt)sexr(opno4apte fvta(fsrum(  ou1aee  oetat m emump;t0 etnxfcoodlp  lies;(  rtrxo ny1lltnlfctas)sDrrxmp;o0open ieiasls2emuvo;() rxrmf3ia1la rauvi;t0 rtmxo oudale  ietlt) Dua(r ;o1opxniociysfsDem( s;t) eermocta1lmt  ies (0 2xmim oudlltemneiltf rtrur nt0apeomoetldfmDum(vsnu4tetoifciotlpt lies (0 2xmim3oo1lpee nvtat)sDtmur oo4oex ioeiys m uluvo (0alermocta1oate nvils0s2uo(rpoudalte nei ()srta(  ou1aeeomociys a2eaumont4 rermfcto1fa  lneo;s)setrxr3ny4oltemnciatfsDtaumpno4oetoio3tadfs2rauvpnt4 rxrif totfa   nvols0 euoxr3ou1lmeelfvtl(fartrur oo0ape ifeild s2umn on() eeomfciydfa  anei s) 2xrxrpoodlme lnetat) 2tm(rpou0apeomoeilslmDea(mont4 eenmr3io1lmt livol( trxoimpiy1aptnmiei sfs2ururp;u4opxn o3tys mDelu pnt4aexniociotlp e i slt)setrxr3no1alen fvils s2tmur oo1oet mietas m2ulnmo (4 ltnmfcoy1oaDe ieols0t2toxm ny1alenlfeilsf rrrump;u1aee mociytfaDemumsn(0teeoxfctydlaDe nvs t0t2toxrpiodolt lnei s)s2ta(roou4opto iciasfa2rmu p t4altrxr3to1lmtrli ils)setoio3oudlm n nesl(  Dumxrpou1ole iiciadls2ul(vpn(4artnioctotfa   i i;s0 etr(mpou1omtn fvsls  rraxmp;t0olxomfeiytfa rm(msnu)trerxfcoy1omtrauvsls0srtmxr iu4omtnlictls)arum(r ot1aptomfciltlm umnvpn() ltrmr oadfat  i ilt trum(mpiodope lfeiat aDtm(mpou4opeo fetatlaDrmn pnt) rxomf3todopD lu olt)s2trimpiodllt  nvi s  2raxm nt0oltomoeilt s ra(msn() rtnio iy1om  ln sl(0 2toxr ny1opt livs (  rraxmont0alenioctasfs2rm(vs;u)texoirctodfpteanvo;t)s2toim oo1om emivtas) 2raxmono4tetomocildlaDrluvsn(0trtoif ia1fmtr uvs;()t2tmxmpnydope  ictat aDrau  ou0tptnmf3ils a rln s;u0tetnxfcto1lmDe u slt tetmir oydll e ictls)arururo;u4aeen f3tldfs eau p;t) renmf tadoaDelnvol(0sexmim3iudom   iei (f 2urxmp;o4apen fetadfsDemu o;u)areoif io1lmt livo;( tetoim oy4omenliei ( sDtr(rpot4teenmf3tatfa2umnmsnt4tltrif3oydfpte iesl(0 rtrxo3ou1lp emieta(  Dtaumoou0tltnio3iysla ea( o u0trenxocio1fmtr n s t)srumim iu1omenlnctatfarumu ont4apt io3ias a2emnvsnt4tlxrioctadfaD lies;t)trxrim3nydlmtemneils  rtmxmpot0teenmociltlaDum( pnu0 exoxrctytlpD lies t0 2tmxo nydlmeemnesl( sDtm(rp;o4apxn f3tysfs2ra(vs t)aetomocio1lat an ilt0t2trir3ou4amtemnesat a2rmur no4opt ioetldfm2eauvs (0altomr oydomt au olt) 2xriopiydoltn iet s s2rr(rpou1aexn fetls s2ranvpnt0alenmf3iadlptranvol() rxmxmpio4ol elivtat arur(m nt0tlen ociaslmDelums u0tltomr iadoa  anvo;() euoio no4lm nmicia( sDrmxm nu4oexn oetydfs ran o;u4aeerif oodlmDean s ( t2xm(opiy4ll  mfvtas) 2uru ono4aeeomiciydla elnms;(4tltnxo3oadlaD aivsls) rtrxm oy1am e netltfa2ua(  ot4tlxnifetatls umn s;t4 leoifciy1fptrlueils t2umim3iodaltnmfet s sDurumpoo0apto f3iadla2rm(mp (0alxoio3to1la elivi;s s2tmio3iodapenlfctl(fa2taxmpnu0aeeoio3iytfa2rlu p u)texoxr oo1fp rluvslt  rtrim3nu4lmtemfvsatfs2tmumono1tlxoiieils m2ulu pnt)aexoxf3iytoaD  ueslt0 2xrxrpio4oltelnctl( srtaumo;t0ape mfeilslm2rlnms t0 etnxfcoatfmtr neol(0trtrxo3nu1aptelictlt)arrmx  nu1tpe ii3tysfmDel( s (0tetrmo3ty1lat au ol()srxoxm3oo1lp  mfeil(fsrum(r nu4oleo o3tltlaDulums;u)aexoir tytop r neilt)srxm(opiydapenlfeil(farurxmonu0alx if3ildlm2emums;u4 ltoio3iy1fmt aiesl(0seumim oudap emnesa( sruru o;t4aetomietasfm2ulumo u4 etoxfcoodlpD  uvi;s0srtoiopnodol emicia(fs2trx  nu4tpto f3tatla uanvo;()trxnif io1lm e u o t)s2tmxr3no4al e nvs s artm( p;u0tle moctldlm eaump;u)aexrxrcia1lp eluvslt0srxmio3oo4ape lnciltfsrrax poo4tle mfeiatfaDem(msnt) rxnmrcty1fpt aieils0 2umxm3ny4ape lnvias)sDuaxmono4olxnmociasfa eaumpnt4artoif ootlpD auei s0 rxm(m3nudamtn fci ( a2rmu pot0oet ifeiysfmDulnvon(4 exoio3tatfatr n i (  eum(r ny1lpt micsl()arrrx p;t0opt mf3iyt a2rauvp;t4altrxrcootfat livi ()s2um(rpno1amt lfei ()s2ra(mpnt0tlx ifetadls uan pnt)aetrxr iy1laD luei;s)t2uoxrpnudopt miet t)s2tmuronu1tpxn iciat a2emnmp;(0texnircio1fa  livo;t0 exoxm oy4lm e ncsltf Durumpou1opto oeiyslm eln s;t0tltrmo oy1fpt  nvo s trxo(mpiodaltnlicils)s2urxronu4oeenmo3ildfmDemnmp;(4tetomf3todfa  luvo;( teuoimpoo1ol emfvi s  Dua(  oo4tee mictat m2elnvpnu4tlxoif3iy1omtelueol() 2to(m3oydol  mnvta()sDuaxm ou0altomfeiyd m umnvp u0 leomocta1lptrli olt)srum(o3nudlm e ivs s)s2taurooo0aleo ietat a2umn p u0tltnmrciotoaDraivil()trtrxr iu1ap n feilt arrr(rpno4tlt  iciadfs2rmnvsn(0aetrio iy1laD lueil( s2trxo3iy4altn nviasfsDum(rpnu1oex mfciyslm rlnmpnt0 lenircia1fateaieo;s)texoimpio1am nmictltf rtm(mont4oltomo3iaslm2ua( p u)teenmr3tadoaDrluvi;t0texmxr iy1om nlieslsf Dum(  ;u0tlx mfeiys m ran o;t0tlxrxo to1fm e uvs s teurxo iudalenlfci ( aDrm( oou4ape  o3iaslaDrm( p u)trerir todlm  an s s0 etriopnu4omee iei s)s2rm(moou1aleomi3iysfa uan s ()artoio ty1lpt anvslt  2xoxr io1ap nlieias a2rmxr ;t1aexn iciasfs2rlnvont0tlxrxr oodfptrlueolt0 rtmirpnu4lmenmicsls  2ra(ro;t4oltomiciasfa2elnvsnt)trermo3tatlp eau o;s0 2umxopiy1ol n fvi t  rtrxmpoo0tptniociltfs2rmnvs;u)tlerxf3oy1fmD auei s0 exo(r oy1omt mics s)aDtaxr nt4oexn ietlt sDel(mo u0 eeomfciytfmD an o t  rurxm nu1apee ietat)aDrru  oo4alto i3iat s2ea( o t4teerxo3tydlmteaies t0t2xr(m nu4lltnlnvs s  2uau p;u0opto i3iadls uan s (4tlenmr oy1oaD auvils0sruoxrpny4ame lfvia(fsrrmxro;t4aee iociysla elump t0aetrxf3iotlpDrau olt) rurimpno1lm elnct t sDta(mpou1opx mociytlm2ra(vsnt0 eenircoy1fmt aivi;()t2uoxo nudlltnlfes s srtmum no1tpxomi3iad s2ua(vpn()altrmr to1fmD livs;t) 2tr(o nudop elncils)arum(m ;u1tetnmieils sDemnmpnt4 ltnxrcoodfpt lnvsl( seuo(rpnu4lp  lietlt a2raxrpnt4texo o3tatlaDuanmsnu)alxnxociotoaD lu slt  rxm(opnu1omeelicsasfa2umump;t4apxomfciyslaDem(ms;()arerio3oo1fmD li i s)s2xmxo3no4apeemiviatfsDrm( o;u1apt  oetatfsDelnmsnu)aexrmrcoo1la  livo;( teum(m3io4lmtelfvtat) rtr( oou1optoioeilsfaDuan snt0 eerif tadla ran i s0 2xr(r iy1opt  fcslt aDururo;o1tlx iictatfs rauvp;(4altrxr3ty1omDe nes;(0 rxoxmpnudamee fvtat) Dur(rpno4opeoii3iydfm2emumon(0arxrxociadfm rai o (0teuoimpiy4om nlfeta(fsDrrx pnt1tee iietys aDrlnmon(0arerxociy1omte nvsl()trxoxm ny1op nlnci tfaruaxm nu4alxniicildfa elnmp t0 reoxr3todop elnvi (0srurio iudopeemfvs (fa2rm(rp;o1tlt moetyt aDrauvo ()teeoioctydomtelivo;()sexrxo3no1olen ivtatfartmx pou4oltomf3iyd mDeauvs t)tetrxocoydlatran sls) 2xrxopoudlmeelfvtas s2ur(ro;o1oexo iciyd mDrluvpn()tlenxfciadfpte neslt  rtrxo3iudllt micsas)aDrrxm ;t1apenif3ild sDrmnvp;u0 leoxo3oytfptr ies;t)srumio ny4ll  mneilt)aruru ono1aet  fctlt sDrm(vo ()tlerxrctodop eln o;s0 rxoxmpnodllen ivtl()aDurumo;o1tpe  o3iat mDem(mo;t)tlerxr tadlmDe uvs ( t2urim3ou4lmt  nvs sfsrrr( ont1tlxomf3iydfmDran o;(4trermociodfat li i;(  2tr(m3nydap n ivsl(fsrua( pot1aee  icilt a2uan onu0tltoxo to1laD auei ( t2tr(r3nodlmeelncsltfa2rm( p;o4oeen iciys sDumuvo;u0texoir iotfa  ai i s srtoimpiu1opee fes s) rua(rpnt4tee mociysfmDeanvo;(0alenmrcio1fmDr uvol(0trxoxm oodalte fvtlt) Drrx  ;t1tlx if3tydfmDra(ms;t0trxomr ty1fmDrau s ()teur(rpny1lm emies (  rrm(mpot1tltoiieiytfmDrm(von() rxomr todlaD auvi ( texr(r3oydolt liet (  2rmur ot1tpt mfciad sDrm( on(4 lxomrctotoaD  n s;t)teumimpio4lpt mictat)arua(rpoo4tlt iocils sDemnvo ()teeoxo iy1opt aivs;t)sexrio3nu4altnmies (f rrauro;t0alt mo3ilslmDeaump u4tlxomf3ootlm eaueols) 2xmxr3iy4oltn iei (fsDuaxmp;t4tle  f3tys m raums;u0tlxomo3iodlmDeli i;t) 2tmir3nydomt  fvsa( aDtmur ;u0oeenmfetyslm eau ont4alxomrctadfaD  nei s srur(o3oy1al e neiltfartax p;t1tlt mfeiyt aDrmuvs;(4arxnif to1fp elues () ruo(m nydllee nei t s2rru pnt0tpx  fctas sDeauvpn() lenif3iy1la  anvslt0 2tmim3iu4amtemnet ()arraxrono1teenmociatfs ea(mo;u4 exniociodfmtraivsl() eurir3nudame liesl(  Dum( pot1olxomo3iys mDemn o;t4tltomf oatoa e ivi;s teurxm iu4opte ivi sfs2um(ro;u4aex iocilsls2rmu s (0tlxnmociadlat ai s s)seum(r3nydomtnmfvia(fs2rax p;u0aptomi3iyslsDrlump;u0aeeomr tatfpt  nvi;t0 2urxo3ou4ll  lfvsl(fa2rru o;u4tle mocias mDeanvp;t0 rtnmo oadlpt  i olt0srxrxo iy4ll nmicsls aDra(rp;u0alen fciadlaDrauvp;u4areoxo oatfaDrli ols t2um(mpoo1ale lieiatfsDrmum oo4aptnmi3ildfs uan sn(0treriocoatlmtraivilt)t2ur(mpiu1lp emnvias  2uax pno1oexo ieiltfm2eluvon(4altrmrciotla r n slt0setrio io1lm  lneiat  2tr( pno1teeoioeiat m rauvsnu0tlxnmf iotfmtrlnvi;( srxoir3ny4llte ietatf Durxrooo0aeeo o3ilt a2rau snu4 renmrcty1faDeaneo;() 2triopoodoleelfcilt)srra(rpnt1tle iociyt s2umumsn(0trerxf oodop r ieils0teum(opiydlltnmnesa()srtrurpot1aeeoii3tydls rln onu4aeerxoctatoateau o;t0t2toirpnu4lmee ivi t)a2taxrpoo1tleoif3iasfmDumuvs;t)trtoio3oadlaDean i (0seum(r iy4aptelfcsas)srrm(m ot4aptn f3iltfa2ea( on(4 ltrifcoydfa r n ol(0s2xrim3iodlltnlivtl(faDurur ;u0apxnifctldfs umu s;u4 eenifcoy1opteai s t t2um(o3ny1opte icsatfarrmx  ot1olenmociasfs2uln o;u)aleoifctotfm  lueo;()trto(r nu1lp  mnvs (fs2raxrpnt1apenmo3ildfa ra(vp (0texrio3iatoa eaivils0s2umim nydam elietl() rtax  nt1alx mfcild m2ua( o;u4arerxocootop rauvilt)t2xmxo3iydapt lnvt ( a2tmxmpou1aleoio3tldfaDrmums u) lermfctotlm   n slt0srurxm3nu1al  miei t)arrmuro;t1aeeo o3tldfm el(mp (0 exomfciytlaD an ils)srumxo iodlmt mivs sfs2tmxmpoo0ope ifctatls ran s;t) ltomocoatfmtrluvil(  2tr(m3ou1omtemnvilt)srtaxront0opx mfcild m2uau s;u0tlxrmf iodfaD  nvols)teur(rpnu1om eliviat) Dur(rp;u1oetoiiciat aDrm( on(0alxrmo oodfm eluvil(  2toxr io4lmen fvilt  Durur ;o0opeoiictadlmDeluvs;(4tlxomf oo1fmD lnvi t0trtrim3oo4op n feiat artrurpot4aexnif3tlslm2eaumsn(0tltoir3iodomDr nei;() eumir nu1lm elies s)s2tm(ro;o0tpe  f3ilsfaDranvpnu)tltrxo todfm eanvi s) 2xm(mpny1op  miciat) 2ur(rpno4oleomiciltlm2rluvpn(0alenif3ty1fat  nvols0 eumim ny4lltelnvil()aDtmxro;u4olt iieias aDumums t0arenio oy1lat  ivslt  rumxm no4opee nei () 2uau o;u0tltnifeilsfaDumuvsn() exnmocio1optraieo s trxr(rpoy4apenlivi ( aruaxmpot4ole mictydlm umnmsnu0 ltnio ootfa r n o;t  2uoxrpoydoltelnvs ( sDtrumoou4teeo iciyslm2umnvsn(0 renxf3iy1fmDe iei;( s2trio3no1open ivsas)a2uax ooo0ale  f3iatfsDelnvpnt4trtrxr ia1fp r iesl(0trtmim io1op n fci ( sDurxmp;t4opxo iciltfm2rm(vs t) lxrxo ty1lpDrlies;s  2trir3iydlltnmfvta(f rtaumoou1oexn ieiad sDel(mont4aetnif3iytoaDrln ol( s2umio ou4omte ieiat srur( ono4texn fciatlm2eau onu4 ltoir3oo1la   neo ()texm(m iu4altn fvsa(  Drr(rpot4aptniiciys a2emu s (4areoifciatom elnvi t0s2uoxo ou4lmtnmfesl()sDrau  ;o4aexo oeiltfa2elu p;u4trtrxr oydfpDrlnes t0sexmxm3iydlmtnlncsasfsrumu pnt1tet mo3ilsfs2rm(mp u4arxrxrcoydfm rlu i t) 2xr(opny4op e ivsls) Drr(m nt4aet  oeilsfm2uln ont4 exrifctydlpte ues;(0srum(r3ou4opt liesatfa2rm(mp;o0tleo ocias s2rmnvo;u4aeenircoatoaD  uvil( sruoxopoo4lm  mies ()s2trx o;t4ole mieiltla rmnms () reoifcoadlp elies ()s2uoim io1lpt lfctls a2ra( ono0olxn ieildfa2rau o;t4tetnif iydla eaues;t  2tm(mpoo4ap nlnvta() 2tmumoot4aexoifeiysls emn on(4 etnmr3oo1faDe nvils)texr(opio4lp emivtl( a2raur ;u0oeeomi3iydfa2rmu s;(0treoio3tytlmtr i o;() exoim nu4lptemfeiltfsDtru onu0aeeomiciatla2rm(mp;u0 etomo3oodfa ean i;( s2urimpiu1ll   nvsl(fa2uau o;o0tlxnmoetlsfm2uluvon()arenmrctadomtraivi s t2xmirpnydalee netls  rrm(monu4aeto i3tasfmDrl( o;t)trtnxf oydopt auesl( texo(r3oy1lmeelfctls a2taxmpoo4tltomieild s um(ms u0trerxf oodopD  i o t0t2xo(opiy4openlnci tf 2rax  ;t4altn icilsla2uanvpnt) etoir iadfateau s s)teuo(m3ou4ame licia(f 2tmumo;u0oex iiciytlaDeluvpnu)alxrxf3tatla eau o s) rtm(m3nu1am nmncs ( sDua(mono4teto feiltlsDul(mo;u0 etoio tytfptr i olt0teurxm3iudll e fvia(farumxm ou1tex  feiatla ean s;t4tltrir iydlaD anvs;s0s2urxrpnudop e feiasfarraumpoo1opeomo3ilsla2ua(ms;u0alxnmrcootlp  livsls)s2uo(m3iu1opt mieil(fs2uax ont0oee mfciyt m2eanvpnt0tetoxr3oydfp rlieil(0t2xoxr iudlmt  fctls aDtrxrooo0apx ifctyd sDel( s;(0tlxoxrciadomt an o;(0truo(m iu4am  lnvtls  rra(ro;u4tptnmfcildfs2em(vp u0 etnxfciydlptr ivil(0trxoio nudlptelnvil()sDrm(rono0ole iociltla ean onu0aeenxo todfa eaies s setoio io4ope lnct t sDtrumono4tpe  fetldlmDranmont4 eenxocty1fp ean slt0sexr(m3oy1lp elnvtl(f rrau oot1tlenmfeilslm rluvo u4tetoxociotlateau s s s2tr(o3iy1opeemnvsls) Drmumo;o1tpxnmfciltfm umnvpn()alxrir3tadfm r u sl( teuo(opiydap   ivtat  2umur ;o4alenmieiatfsDumumsnt4arxnxr3to1fm   uesls0tetmio no1optelnei t srururono4olto fetlt aDulu s;u) ltoir3oytlm  aneo;(0 exmxm nydlltnmfvsls s2tau oou0tlxnioctadlaDum(msnt0aetnmrcoo1fateanes;t0 rtoxm3iu4lmt mneia()aruaxro;o1olt mictltfs2rlnmont0tetoxrcoy1lptr ies;( truo(o iodlle  fcs t  rua(r ot4oexoioeiydfs rauvs (4 etnxr3iatfm r neols0truo(rpio1ll e nesls) Dtmurpot1tle  o3ilsfs2rl( pnt4aeenxocoydlpt  nvol() etmim3iu4optn fcilsfs2ua( oot0oex mo3iydfs rm(vpnu0artomr tytoptr neo;t) 2uo(r3oy1lp elfes ( aDrmx p;t4altn feiatfa ra( on(4arenir3tydfmDrluvilt) 2toio3io4apee ivs s s2rmum nt4aexoif3tldfm umu snu0 etrxf iydom eli slt)sruoxmpou4lm n nvilsfs2tmurpou1oexn ictys m2rln o;t0texnmo tatlp raieol(  exmio oo1ameelnesas arum(mo;t1opeomi3ild a uan snu4aetoif3totfm  livs t trxoxr oy4apt  nvt tf rumx p;u0aee iiciys s2ranvs (4trtoio3iytfmte uvi;t) rtr(m ny4om  lnesas a2raumpno1tle ifeiyslaDean snu4trermfciydop  luvs;( setoxo3ou1openmnct () 2rm(m nu4texnmo3tatlm emu o;(4trtnxr3iy1fp  ln ils0 rxoir3oo1om emncil(fs2umur nu0opt  i3ilt sDul( s;u0trenxr oatop rlnei s0srtm(o3iodaltemfcil()a2ta(r ;u0tlx  ieiyd s2eanvsn(4aeeoif3iotomtrai sl(  rxm(r oydllt  fcsls)srurumpou0tlxo fcilslm2ra( o u)trxnir io1opDrluvols0t2ur(opoydlmt lncia(fs2uaxm ;t0apxniieild a2rlumpnu4alerir3oodfpt  ivi s)srxm(mpiy4oltnmfeias)sDrmurpot1aexo feiltlaDeaumpnu)alenmo to1fmD aues;(0srtoxo ny4opee net tf rum(r ;o1tltnmo3tldfaDemu s (0treomrcoydomtr nvo ()s2xr(r nu1apt livsasfsDurump;o0aeeomociydla2elumpn()aeeoxo3ia1oat  ivi s0t2to(o iu1apeeliesas  rtrx p;u4opt  ociydfmDua(vs;(0teenio3ootlpte ivi;t0 exrxr iu4ol n neta(faDtaur ot4altomfciysfs ea( s t4 lxnmr oy1faDelnei (0seum(r oo1lmtn net sf rururo;t1olenmo3tlsfs2uanmont0texoif oo1fp e ivi s s2tmim ou1apeelneiat)a2tm(r ;u0tptomfciysla ua(vpnt4arenxo ootopDrai o;s0texo(m3iodll elfcsl(f ruaxm nt1opx  f3iytfs2el(vpn()trenmrciydop r ieo;s)seurxm nu1apt mivsl(farua(m oo4tle ifciasfs ul(vo;()teeomo oydlatrau olt0trtr(opnu1ol nmieil(  rta(  nu0opxnifeilt s rluvp;u4tlxoirciodoa eai s ( setrxm3nodap nmnvtlt) 2rmur nu4alxoiieildfa2ran ont4trxrir ia1fm r ivi t0t2xm(mpoydape livs s)a2trx onu0apeo i3tltlm rau pn(0aetrif oo1lmD  nei;s0srxmiopnudlpee nvt t aDrmx  ot0tpenmiciadls2uaums;t4 rtnif3totopDeln sls0srurxm iy4ame lneiatfaDurur ou1oeenmo3ilsls2ul( o (4 eenmoctatfaDrai o t)t2xrxopnu1lpenmivtlt srtax o;u0aeenmi3ils aDra(mp t) rxnif to1opDr u i t s2urio3iydlmtelivi ( aDtrxmo;u4ole  oeiasfmDrlnvo (4 exrxrcty1la elieols s2tmxr3oo1omenmfctlt)sDrmum ;o4alenmi3iatls2rmn pn(0 etnxrcoadlmte neo;t0srxmxmpnodlpe lfvs ()s2ra(  nu0tet  i3iyd m uluvo;u0teenmoctatoaDe u ol(0teuoxo iu1omt lfesatfa2rrxr ;u0olt mieilt mDelump t4aeerxfciydlaDe uvi s0 etr(m ou4lm elncslt) 2uaumo;t1opxo i3tld m rm(vo (0 eenxo oy1fmDeanei;s0srxm(o3nu1amtemicsa(fsDtm(mpnt1olxnmfciytfsDrlu s;t)tetoxf3tydlm rai ilt  rur(m oodlleelnet tfsrrmum no4aexnifeiydlaDumn sn(0aeeoxo3tytom e ivi;(0t2xrir3iy4lm  mivsltfa2ua(r ot0aetn ieiydfs2rlnmp (4artnxo iodfaD an s;() 2xr(m3nu1ape lici sf rra(r ot0tee ifetldfm2ranms (4areoxociatfmD anei;s0t2uo(r nu1amtnlfci (fartm(mpnt4alenioeiysfs2em(ms t0arxrxrciytfa rai i;(0trxo(mpnudlm e nesltfsDua(rpnt1tleo oeiys mDrmump;t4areoir oydfp e u o;t) rxrim3oudop e neia()sruau ont4tlxomieiadlmDul(vpnu0trtoir tydlmt ai o;() 2toxm3oo1lpenmfctas)s2taxmo;u1optnmi3ildls2rlnmo t4alenio3tadlp eanvol()texm(opoodop e ict tfs2ua(mpot1opxn ictytls2umu pn()texnxrciatfmDr iei () ruoirpiodop   fvtat)s2ur(m oo4opto o3iyd a ranmp t0 rtnxo3oodfm r u i;s0 ruo(m3oo1llte ici (fsrrmuront1tleoiietltfm ean s (4trxoir3ia1faDeau i;( tetrxr3no4omenmfeil() 2rmu  oo4oet  iciaslm ra( s u4 reomf3iydfp elnvsls0trxm(o iy1lpe  feia(  rtax  ;o1teto oetydla rlnms;t)tlxnxf oo1lptean s;s)trum(r oodol nmfet sf rta(mpno1aetn feiatfa2ea( s;() lxoio3ootfmDeluvo;s sexmxm iy1op nlfvilsfaDra( p;o0teenifeils s2uln onu) exoxf3tatfmteli ils  rxo(m3oo4ap e ietlt)aDtaxmpno0apx mieiyd sDraumsnu0 reomr totlm elieo t0sruo(m3iy1alen icia( aDum(ro;u1opt iieilt mDrl(ms (4tlxrir totfp  aivo;t0 rxr(m io1ap nlnesltfsrrm(roou1tltnio3tlsfsDemn s;t)teenmfcoy1oatrlu sl(  2to(r ny4ol  mnctas arra(m no0aet io3iadlsDemums;u)tetnmr iotlaD lu ols teurio3oodop  lfvt ( aDur(rpnu0open fetad m2rmnvs;u0 eermr iotfmte neo () 2xrirpoodamt mieia()srua(r oo1teto ociyd aDelums;u4altoxfcia1optranvs ( seurxm iu1ap elfvi s a2trx  ;t4aet moetlslaDea( sn() exomoctodoatranvo t)s2toxopiy1llt mivil(f Dum(  ;t0olenmieiysla2rauvs t4aexnxr oa1op r nesl( sexoxr3io1alenlncsas  Drm(  ;u1ope mfcils a2eln s u4tetomf3todopDr nvols trto(m oodoptnmfvtat)srraur ;o1oexo ocias m el( pn(0arermrciotlp   uvo s0t2xr(m3nydam  mfesl()sDrax ono1oex mieiysls ra( s (0 eeoxr tytlpDeauvil()s2trir iy4altn ncsltf 2rrur ot1tle  f3taslm2rlnmsnu0 rerifciytlp  au o (0 etmirpio1alt mfcsl()a2umx pnt4oeenmfetldfsDul(vsnu0 renxr3iytfp e i s t  rtmio nudape mfvs tf Dur(ronu1oltnmfciat sDrm(vs t4aexniociodop eaivs (  exrio no1ll elnet s s2ra(r no4tpt iictysfm eauvp (4 exoxocio1fmDr ies;s) etoio oydolt  nci () rtm( pou4tee moctydfmDulumsnu0alenxf ootfa e ieslt srur(m iy4amt mfct sfaDra(roou1aexo ieiydlm2uanmo t4 ltnxr3iodlmtr uvols trur(m nodopen nvtasfsrra(root1olx iociyd m ul( s ()aetrmrciatlatelueslt texoxo nydomt lnvtls)artrxro;t0aleomieias s2rlnvp t0tlenir3iydfmD  iei s sexo(o iu4ome  iet ( srua(  oo1optn ociydfa2rl(vont0aexnmrciodlpDrlivo t  2tmxopou1opeelnci s aDuru pnu1ale if3ilt a2rlums;u4 rtnxr3oatla r uvo;t0 rxm(o3iodoptelicia(  rraxmp;t4aptn fctltfa rmuvsnu4 exrxf iadfa  aiei t0 rxr(r ny1lpe  ictas) Dta(ro;o4oltomo3iysfm2emu o u4 ltrxr3tytfmD aivol(0srtoxm3ny1omt  ici (f Dra(m nt1oexoio3iytfm uanvp t4 leoxr oydoatrli o;t sruo(o3iydll n ivsl()s2tm(mpnu0olxomicilt m um( s;u4teeomrctodfaD luvs;s0 2toxopou1lm emiei (f rtaxr oo1tlxn oeiytlmDel( o;u)trxoifctatlateln i () rxmimpiy1ol   fet ()a2umx onu4olxnmiciydlm ua( sn(4texnxrctytlm ranvs (  ruoir iu1lmtemnci t)s2tr(rp;u1ope mfeiys mDuau on(4trenxrcoodomtelieo t)srxr(m iudom  lfeiltf Duax ooo0aeen octasfa rl(ms;u0 lenio ty1fatrlivils)srxm(rpiy1ale mfesatfa2um(r nu4ope  o3iad s2rlnvo;(0alxnmr3oa1fmt lnvo;s srtr(r ny1amenmiviat sDrr(rono4tptoio3tltfsDraump u)arxnxr3oodlm ranvil( seuoir no1lp n ivt s aDua( pnt0opt iietlsfa2rlnvo t4trtoxr tytfmtelu o (0teumxr nu4olenlfcsat)sDrrxmooo4oee mf3tydlmDrmn s;u)aetoxo tadomDr nei s sexmxm3nydlm  miei ()sDtaxmpou1tet  fciytla2ua(vp t4alxrio totopD aivsl(  rtrxm ou1lmenmivt s)aDtru pnu0tptnmoeiatlsDrl(vs;(4arxriociadom   ueil() exmxopiy1lpee nvi sfa2ur(mpou4oee iieiyd a ra( p;u4trxoirciodom   nvol(0 2tr(opiydlmeelnesa() 2ur(  ;t0tltniicilsls emuvs (4aexoif oo1laDr uvi;() exo(o iy1lmtnlfvsa(f Dur(  ;t1apx  feiydfaDra( p t)alermfcoydlp e neo;(0trxmxo3iu1ole  nviltf rrm(r ;t1olxo f3iat m2elu s;(4 etoxrciydopteau sl()teur(mpio4ale mnct s)srurumoot1apenif3ilsfmDel(vp;t4aeenmocoatfmD  nei;t srxmxm3iy4am   ncsat)arrru oot0oexo fctys a ulnmo;t) rerxo oadoa   uvo;t0s2umxo3nudlpeelicslt)aDrr(rpot4ope moeiydla eln pn(0trerio iotfm e n s;()t2toiopnudapt lneia(fsrra(rp;o1tetn o3tyt s2rlump u0tetnxr3iotfp r ues;(0sruoxm oy1alee nvi t aDrm(mp;u0alxniieiat s2rmuvs;u0 etoio ta1lateln s;() rxr(o oy4omee ieslt)srtmurp;u0tpt  icildfm ra(mpnt)aleoxo3todfptrauei;s  rtmxm io4am emivtat) 2ua( poo0oeeomoetasls elnmo u4teeoxociodomD  i o;s s2xmimpoydaptn nvtl( srtaxm oo4optnmictltfs um(vo t0tetrmf oy1fmDelneo t srxo(r3iodlmtnlnvslt)sDuax onu4aet mo3ildfa el( pn(4alxrxfctadopDeluvs (  rxm(r nudolen fetl(f rrm( ont4olto fctlt a2ulnvp t0aeerxocio1fa e uei;(0setoxr oy4amee iet sf Drrxm ;o0apen fciat m2elumo (0 etnxf oodomt  nei () 2to(rpiy4opt mies t a2tr( pou4altnmi3iyd mDul(vp;u) rxrmrciy1opDeaies;t0trxr(o nudoltnlfet ()srtaxm ;u1olxo feiadfm ea( p t4trtrif3oytlmt  ueo s)sexoir no4ole mnes ()sDtmxr no1olxomiciltlaDem(vpnu0aetnio3oo1lp  au s s0t2xr(r nu1om  lnesl() rrruroot4opxoioctatfa2umnmp t) exomo3io1laD auvo s0t2uriopou4llen neils)sDur(  oo4tpxo o3iaslmDrln on()arenmo3ia1fm elnvi;s srtmxm3iu1amtemivs tfa2um( p;t1oexo f3tadfa2ea( o;(0tetnirctodlp rln o;t)texm(o3no1omtn icils srrmum no4tlxomicils a2rlumonu4artoxo ia1omD  nvi s) ruo(r oydllte fctas)a2rmuront0tpt  feildfa elums;u0tetomo tadoa rlnes;()s2xo(r3iu1al   ict sfaDtmu ont4tpxnii3iyd aDeauvs;u0tleoxo3iatoa  anvo;t0texoim3oodale mfvias) 2rrxm ;o4tlx  o3iydlaDrm(vo;t)tlerxf3iytfpte ivo ()srtoir ny1lmtnlicsas)a2ur( pot1tee  i3iad a el(mo u) rxrif3oytfaDrlnvi;( trtr(r no1ameelict sfs2urum ;u4apeo iciad m2emuvo;t4tlermo iatfat  nei s t2urir3no4lm  lict ( artaum nu4tpx ii3tlsla uauvont4teerxrcio1oa e nei;t) rtmxo3iydome  neil( s2urx onu0olxoii3ils mDrluvo (4artrifcoydomt lueols) euoiopnu1lltnlicilt aruau oot0aptomf3tls m ulnvo u4 rxnxr oa1lm eaivi;s)setoxm nudlpt  fesltf 2raxm oo1tlto o3iad aDeluvs u0altoif tatfpDelnvi;t teuoxopoy1lltn ict t aDurxmpoo1tptomiciyt s rlnmsn(0tleomr io1lm  auvo t0trxr(o3nodlmee fesas a2rrxr no1aexo i3iatfmDean pnu0aleomf3iytlatelu ol()sexoxmpnodlm nlictas  rrrx  oo0olx ii3tydlm umumpnu4aexoxr tadfa  luvi;s)s2trio iodamtemneilt)sruau ont4aeeomictltls ulnvo;u0 exnio3iy1la eanvs t trxmir iudlm e nvi t) rrmx oou1oetoio3iadfs eaumon(0 leomo3oodlaDr neo;t0 rxo(rpou1lm nmfvt sfs2tm(monu1aptnmictlsfs emums;()teerif io1fpt  i o;(0seto(r3oudamtelnes s)a2uax ooo0opeo fetldlsDrau o t0 rxoirciytop  livi;( trurim3no4llenmncs s arraumo;u4tee mictlsfaDrmnmonu)areoxo ootfmte nvi s0s2xo(o io1lm  mivia( artruronu0altnifctasla em( p u4tltoxo3iytfaD  ies s0 exoxo3ou1op emici t sDrmurpnu4olxnmictydlsDem( onu0tlerxf3oadoate ieo s)t2to(mpiu4ame lfesltfsrta(  ;u4optnio3tltfmDran pn() rermo3io1late u s s) 2xrir nu1ap   fcils) rrmx  ;o1apen ieiltfm2eaumpnt) lxrmo ty1opt auvi;s  2xoxr iy1ol nmfctl() rrrxrp;u4altoio3ils s2em(vo t4texrifciodlpDrln o;t0 etrimpnydam emneilt sDrm( o;t4apto fctlsla2rl( p;t)arxoif3oy1fpD luvs s0t2toimpnudoptnmnct s) Dtr(r ;t4aleo oeiasfaDrau o (0aeerio ootlaDran o t0 2umir3oo1om   ivtls  2tmx  ou1tpe  i3iadfs2rmumpn(0 rtrxo3tydop r nei;t)t2urxr3ou4lm  lnctltfa2uaxroou1olxn ictad mDem(vo;(0tlermrciadfp r u ols0s2xmim iodop  mivsltfa2ur(rp;u4tltnifcild a2rmnmsnt4 leomf3iadlp  lues () 2xr(opiodlltn fvsa( aDta(  oo4oltnioeiys s em( s t4treoif iodoatelivi (  rxrirpoodoptnlfeiat sDraxm ou0tpeoiietydls2el(vp;t0aexnir ty1lm  aivols0setrxo ou4llt  fvil(faruax ono0opeoiietld s eln pn() exrio3iytop rai s;s setrirpnu4lmee ies t  Dtm(ro;u4tlen f3iltfm2umuvo;(4trxnif3ta1lm e ies;s0t2xrim nu1lmen nvias)a2uax  no1oltn ietyt a2emums;t4tltoir io1fpteauesl(0trtoxr iydap nlnvtat aDrax o;u1tpxniieiydfs eauvo;u) reoxr oodlatelnvo;t0setr(opio4ap nlfvias  rtau pot1oexnmf3iadfm2rmn s (4 eenmfcty1lateaueo s0seuo(rpou4alt mivil(fsrurxroou1alxomoctatlm2emu o (0 rxoxr3oydfpt livol( setoxo3oudlm e icias aDtrxrooo4oleoifeiyt m2eluvo ()trxomf3oo1laDrlieolt teuoxmpoy1apenlict sf 2tm(rooo0ope mf3iad a2ra(monu)aetoio oa1oa elu ols tetr(m iy1ame  ivia()aDta(rp;o1tle mfetltfs2ea( s u0artoir3oydlmtr uei t0t2ur(m3iu4lp nmics t) 2raxr nt0altnii3ildlm2rluvp u4 ltrmo3io1oat anvs;t srtoxr oy4ap e nesa(fs2rrxmp;t4oltnmietat mDrln s t4 lxoio iotlmDeanes (0sruoxo iy1altnlictas aDtaumpnt0oetomfetad m uauvonu)alxnxrctydfp rlieol() ruo(o ou1ameelfvt ()srtr(mo;t4opt  f3tls s2rl(mo;u0 ltoxf totlpDrluvs () rtoxr ny4optn fetl() Drm( o;o4aptoifcils s2um(vp;() etomfciydop e uvils)setr(o3oy4amtnmfctl(  rtm(m nt0oleoii3ias aDemu o u0tltoxo ootomt auvs (0 rtrxm3iy4llen ieslt arumu  ;t1tpx ioctldlm emumo;()tlxoif iodoaD  ivslt0teumxo io1ol  lnvi ( aDraxroot1alxo fciydlmDrau p;t) lermf ty1latr uei;t  rxrxr no4al nlnes t)a2rmurp;t1olxomiciydfs2eauvsnt0 rxomo tytoa rlnei s setoirpiodll n nvt tf ruaxr ou1apxn ieiys mDum(vpnu4 lxnmf iy1lmDr uvilt  2tr(rpoo4oltelivsa() 2rmumpou1tpe  feiat mDem(vpn()alxoio3iodlm rauvo;t0sexmxr3iudal n fctl() rrr( ooo1alt  f3tlsla rauvp u0arerir ootfmt lnvol(  rxrxr3iudll nlnvs (faDta(  ;o0tetn feiadlsDra( p u4texomf oatfp rlueils trxoxo oo4ap nliei t)sDua(m oo0tptomi3tyt s2rl(msnt0trtnmf tatfp  aivo (0 euo(r3nu1al nmivilt  Dta(rpot0oetomieild mDra( o;u) eermr3iydfm eli ilt)tetoxo3io4lpen fci (f rrm(  nu0apeomoeiasla2rm( o u0tetoxrcoatlm rauvils0 rtrxo iu1ale mfvsasf 2ra(rpnu0oexn fctld s emnmp;()altnxocto1opDrlivo;s t2trxo iy4ome  nvias sDtmxm ;u0ape if3tld a2uanvo (4 etnxo3ty1lmteaivol(0 rxo(m nodlptnmicslt)s2tmxmp;u1alx mictas s ul( pn()tlxnxr oo1fmDr iei ()texmiopiodlp nmicsl( aDurx pou0tle  fciytfm ua(mp u0 lenio3iydfmteanei;( srtr(m3ny1apte nct t)aruaxmpou4opt  ieiysfs2ulnmpnt)alxrxfcoytomtranes s0trxmxm iydlleelfcil(  rtrxmooo4olx  feiyt s rau pnu) rtoxf oa1om rau i s trtm(m3iydol nmnei t)aDtr(mo;o0tpeomi3tydla rl(mpn(0texrif oo1omteanvils srxrxopnu4al nmieta(f Dua( o;t1tltoiicildlm ranvsnt0 rxoiocoo1oateanvil(0trxoim iydol  lnvtat)aDuaxrp;u1tptnmf3iadls rmn o;()tetomr iodfat  i o;( t2xm(rpoodol n fes ()artm(roou4alxn f3iasfm2rauvs;(4 ltrxo ootfm e i s ()seuo(r nu4lpe mivs ( srraum ;u0oexoio3ilt m2eau p;(0 renmf3tydlpDr ivils  ruoim3iy4amenmieta()aDraxmpou1olxnii3iasls2el(vp;u4 rtnxrcootlateanvil( s2umxo ou1lmtemncsl() Dtr(rpou1oexn ociadlsDrl(ms u4areoiocto1oa  lieil( tetmirpno1lpeelnet t) rtm(rp;t0oeen oetadlm2ul(mo t)teerxo3io1oa   i i t0trtrir ou1openlicils) Dtmxmoou4aex ifciyt aDra(msnu0texrxo iy1fatrai ils0 eurir iydalt  feiat  rurump;t0olxn feiltfs rmu sn(4alxomocoodoaDe uvi;t) exoxopoydlpt  nes () rtmum ;u1apeo fetas mDemu s u) ltoio3iy1la rluei t sexr(r nu4lltn nvsas)sDtrump;t1apxn feiydfm2ra(vp;(4trxnmf3oytoat lies s  rxmxmpio4apenlics s arumx pno1tpxnio3iyt s2ulnvs (0 reoxr ta1fpDe n i t srurir oodamtn ivi s)sDurx ont4apt mfeiat mDeanms (4aleoxf3tydlm  anes;t0trxm(o3iodll   fct s)sDtrxm ;t1oetn ieiatlm rm(msn() rxrmf3todopt aivols t2trxrpnodape mivslt  ruru  ;t0tleo ociasfa2uanmsnt0aexnir3todlmDranvo ( teumxr no4llt lictls  2tmu ono4tpxomoctys s rmnvpn() leoir3todlp elivs;t0 2xmxr iy1altelivilsfarrrxrp;u0tex mfctasls2ulnms t)tlenmf3oadlmtelieols)tetm(m iydom   nct t s2rrx ono4oeeoiieiasfsDul(mp t4tetnir oodopDraneo ( t2uoim io4om elics s a2ra(rp;o4apt  iciyt s2emn p u)teerio3iydopDeluvsl()setrir3oudam nmicta( aDrr(mont1aee  oetys a eanvs t)tetrxf ta1fpt lnvil(0 rtoiopiydlmtnlieta() rtmumooo4olxniiciatls2ulnvo;u0 rxnmr3tadfm  aivi;t0t2trirpny1llt  fcsas  Dra(mp;o4oet  f3iadfm ul( o ()arxrif ootla eaneo (0teurxr ny4amenmivs sfsDtm(rp;u1oeto fciat mDel( o u4tltnio tydfmD  nvsls)seto(r iy4apt lictlt) 2rmu  nt4ole mietysfs2uanvp u4 eenmf totfmDr uei ()srumxr3nudaltn ncilsfs2tm( ono0tpt ioeiadfa2eauvpn(4alxrmr3iodla e ivolt sexoxm3iudaleemies sfsrtaumono0aetoii3ilslaDuan p;t) rtnio3tytop r u ols) 2xmxr iy1altnliciltf rtrurp;t1oeto oetysfsDum(vo;t4 etomo3iodfmD  i ols)t2tm(o3oo1ap elfcsa(  ruaumpnu1oex  oetytfsDel(vs;() exnif3iatopteluvilt)t2to(o no1alte feil()sDrax  ;o1oetomf3tas mDul( o;u) lenmr ia1fmD luei t0 rum(mpnudomtelfvtls)sDtru pnt4oet ifetyd mDemumo u4aexomr ootom   nvo ()truoio3nodll nmnvt tfsDta(r ;t1tle mfeiydfm elu p (4areomr3oa1lmD ai il(0seuo(m3iu4oltnmici ( aDtm(rpno1teeomociatfs2emumpnu0aexoxoctatopDranvslt0trtmxm3iudlmenlfvslsf 2um(mo;o1tpenmo3tys a2eau p;u4trxrmo3iydlm   u s;t0 etoxo ny4amtelnei ()a2rmur ;u4oeen feiltfaDra( sn()aeeoxr tytfm   uvs;(0setoxm3oydap n nvil(fa2urxmont4olx  oetltls2rm(vs u0tltrxfcoo1fa  aivo (0teurxo oy4ll e nci sf rtaumpot1ole  fciadla rmn p () eeomo oadlatr uei;t0 exmxrpio1lmt lnetltfs2raxr nt0oleomoetlslaDulnmo t0texrxf3tytlm   nvsl(0t2tm(opoo1ale lictat)sDtaxr ;o1oet  f3tadlmDrm( o;u)tltoxr3oadoatean i t0tetoxo ny4optnmiei sfa2rmum nu1tpen oetlt m2rln snt0 lxnxrctodlp  au i;(0t2xr(o nudlpt lncsas a2rr(mp;u1oee ifetad sDum(mont0tetnmr3oatfmD au s;t0 2um(r3no4omt  ics (fs2umu pou1olto fctytfmDean p;(0altrif3tydfpDeaies;s) eum(r iy1lpt  nvt sfaDtaxront1optnmi3tldfa2rl( p ()tlxnifcia1fm  anei s0setoimpio4om emivta(  Drm(r ou4aleniicilsfm umumon() leoirciytfaDrlu i;s) eum(rpiydolt mietls sDum( pno1ope ifctydls2emuvo;(0aeeoxo tydomteai s s0 rtrim iudal  mieta()sDraur ;t4oeenmo3ild sDrlums;t4tltoifcty1op e uvo;( trtr(r3nudalenmneiat aDrmumpno1openifctytfsDuanvo;u4 ltrxr3oydfmte ues;s tetr(m nu1lp   nvsl()a2rmurpou4oetnmfetadfm emu p;u4aexrxr3totfpteliei;()t2xr(o3oydolt mncsatfs2rmu p;t0tltnmf3tydls raump;u0 lxrxfctytopDeln sl() rtr(rpny1ope  iciatf rrmumpot1tpxoio3ildfm el( o u4artrio3io1optranvs s)trto(o3nu4ol nmfvta()sruau pnt1ape  oeiatla raumo u4 leoxfcootlatr neo ()trxoxo3ou4om nmfcsls  2ua(mpno0tpxoii3tlsla2eanvpnt4 ltrmr3ta1fat  n slt) 2xmxm3ou4apenlfvt t arumu o;u4oeto fctatfm2umn sn(0 eenxoctotom rauvs t)t2trxm3oy4omt mnvt tfaDtaxmp;o1opxomoetlslaDran sn(4 lxrmoctadlpt auvol(0 euoimpoudll n iesl()a2trumonu1apeniicias m rm( o;() rtriocootfm r ieo ()seumxo3oo4om nlnvsltf rra( pnt1tlxn ociytla emn s u) reomoctadop  lues (  rto(r nydaltnlnct s  rrauroou1ale  o3iatlaDrau o;(4artnxrcoatoptr neo;() euoxm oydale lfci tfartm(m nu0aptoifeiyt s2rmnvp t)arermf totlmD  ueo t  rum(mpiy1ap elfvs t  2trurp;o1apenifctysfa rl( snt4trxomf3tydoatraiei;s)trxr(mpny4lpt mfvsltf 2rm(  ot1tpt ioeiadfm umuvon(0tlenxrcoytopt auvi s0teurxrpoy4apte ietat sDtau p;t0tle mictas s2elnvon(4 etnmr3io1fptran s s s2tm(r iu1am nlivs s)a2ra( onu4oltn fctls aDrmnmo u4altrxo oydlaDeaues t  2trimpnydopteliei tf 2umurp;t1alxniietasla rlump u4teenxo3totoaD livs;s sexo(r3oo4lpt  fcsl(fsDrm(  nu1oet moeiatlm2emu p;t0 exrir oadoaDr ies;s  2tmim3ny4lp elfciat a2umumooo4tex iieiysfa um(vp;() lxnxo totoat luvi t) eum(m nydomte fei s sDrr( pno4ope  iciysfm emuvp;t0 eenxo oadlmtelnvs;s0 eurim3nodamte icia(fs2rr(m ;t0texo ieiadlm2rl(mp;(4aetoio tydfmtr ueslt0s2xm(m3iy4ome lfei t  ruru  ;o1oexnii3ildfm2umump (0altrmf iodfpDelieo t  2um(mpnodameemnvsas)s2rru  nt4oltnmociat s2raumpnu)tetrxfcoatoaD  ueo s)trtm(mpoo1omenmfvt s)aDrmxront1oexo feiydls raumo (0 ltrirctodlpte uvo;t s2trio iu1lmeemfcsl( srrmxmooo4olxomoetysla2ua( pnu4trxnif oodopt  ivsls0 2umxrpiy4lp  mfcils srua(  oo4tpxnmociad s um(ms t)tltomr3ia1optrlnvo s)srurxrpiu4altn icias sDta(rp;u1oleoiocias a2em(vsnu)tetomociatoa e ivol(0sexrxr3ou4amt lneil()aDraxro;o4alxnmi3ildla rlumon()tlenmr iodlptelueo s t2ur(m3nu4al emicsa( sDrax o;o0tetnioctatlmDrmnms;u)trenxo3oodomtr u s;(0 etmirpny1ameelnvsas  Durx onu4alxn fciysla rmnmp;u0aeerxfciadfmDe uvi s  exo(r no1aptn fes ( sDtm( ono0oeeo i3ildfa2ulump;u)arxomfcoydoaDelu o;() eumim oudom emfcsl(f rrmu  ou0aeeomoctltlmDuanms;u0alxrmo3tadoaDrluvo;t0 rur(r nudaltn fcslt artaxront0apxoif3iasfm2rluvp t0altrif oo1lp elu o ( sexmir3nydam n fvt sfsDtmxmp;t1teeoioeiasfm ua(mo u4teermr3iytlpDrai i t trumxm3iodaltn neiat)srumumo;o4optn fcils aDemnmon(0aeeriocto1fa e neo s0srxr(mpnudlltnmfetas s2taxmpou1tetnio3tlsfsDem(mp u)alerxr3oodlpDeaivolt trxoxopoo4ll nmfvslt)s2ra(rpnt1oetoioetytla2rlumsnt)teeoiocoo1lat lu o t0trxr(o oo1llee fes t sDta(r ;o4aexn feiydfsDeau o (4tltrmfcoadla rlnvslt0t2urxmpoydlpt  fctas)aDtrurpot1tlxomoeiat s ulu p;(0areoir3tadfa r nes;(0s2tmxrpiydlmtemiei tfarraur ou4optnifctadlsDrln s;t0arermo3oodfa ean ol(0srur(m3oydom emieta(f Dta(r ot1tlxo fcilt s umuvs t)aexoxrcto1omD aneo;() 2tmim ou4amen nvsas s2taxr nt4ape  o3tyd m2rlnmsn()alerxrciatfate nvslt0 etmxm iodomtelictas aDrmx  no1opxomoetadlm2emnvp;t0aleoir3oy1lpDeanesl(0setrim3oodll elfcs sf 2rrxro;t0tpeomo3iltls raumsnu4 renir tatlp  aies;s0truoxr3nydomee iet ( sDtaum ;o0tlxnioetatlmDraums t0tetoif oatomDran o;()t2trxr3iu4lmenlnvtas  rta(rono4aeto f3tydfs rm( o t0artrmrcia1op  ln s;(  rtm(mpno4lm  mfeil(fa2tmum nt1oex mfetls a eanmpn(0arxomr totopDraies;() 2urxo3oodame  feil(fa2rru poo4tpxo oeildls2eln o (0trxoif3to1fat lnvo s0setmio no4omenlfcs ( aDra(m ;o1aexniietlsfmDulumo t0aetnmfciotla  aieo ()t2toxopnu1aptemivt t a2rmurono1tetomictaslm2ea(vp;(0trerxrcoadla e i o;t0teto(rpiodlp nlnesa()s2tm(roou4tle mfeiasfa2eanvp ()aetoif3iydfateluvo t0trtm(o3iy1oltelfesl(fsrtmxmoou1olxomoeilt m uan o u4 lxnmf ootoatraivs;t)teurxr3oo4lmt  neilt aDtaurpnt1aleoii3iltlm emuvpnu)tlerifciy1oa rluei t0s2toxo nu4ap e nviltfarua(rp;u4alx  oeils a2rln p u4alenioctytfmDrli s t  exrim3oo1ap nlncs t) rrrurooo4tpe ioeils a2raums (4tetnif tytfa  anesls  2xo(mpiodlleeliei s s2umurpnu4apxo feiydfa2el( o t0 etoiocto1la   u o (0t2trio3iu4al nmiei s)s2umxmoot0aptomo3tysfm2umnvsnt4 lxoxf3oadomt  n slt  rxrir3nudllen fvtatf Drru ooo1aleo ociadfmDemnvp;t)teermrctydom e i o t trxo(m oudap n fetl(fsrum(mont1oeen o3ildlm uan p;() rxoxo iodoa  lu ils) 2um(m3oydapeelncia() rta( p;u0apt mo3iydlm2eaumo;(4 rtnmo3oodlp e uvs;t  rurxr3no1lmtemiei t aDuaxr nt4oet mi3ild s umn s u)arenxrciydfp r u s;s)s2xoxm3no1optn icslsf Durxr ou1alxnmfetatfa elnmp;u0tlenmr3tadomt anei s) 2trir nudomeelnes ()a2rm(ronu1texoio3iysfm2rmu onu0trxrir iadfa e i ols trtm(opno4lle lfcs ()s2urxmo;o1opx  oeiat aDum(vs u4tlxnir3iydfa ean ol() rtrxm3ou1altn ivsa( aDtaurpno4oetniieiytlm rl(vo;t) lxnxoctotlpD anvi t srtmxo ou1lle mfctls  rraurpnt4alxoiictytfaDuan o t0 exnif iodoaDr neol()sexoim3oudolt mfetl( srrmur ot1oet iietlsls2umuvs;()aleoir3ta1oaDrlnei;t  rum(opno1ome  feiltf rua(monu1tlxnmietat m rmumsnt0texnirciodlaDr i olt0t2xmxr3iu4alt  fesa(fa2rauro;t4tltoii3tldlmDranms u4tlxomf oa1omDranvs;s0t2xoxo3iu4amtemfeia()arrr(rpot0aexnmo3tasla2elnmont0 lxnif iadomDeauvslt  rxoxo nu1lpen nciasf 2ta(rooo0oet  ociasla2elnmpnt0aeerio3todoate ivi;t t2xm(o3iudlm nlieia(farumu p;t4open fciadfs ulnmsn(4aetoio tydomDelneo;s0t2xm(o3iy4ame licsat  rtm(  ;u4apxn ictlt s2eanvs ()arxoircoy1fa  lnvsl()truo(m iodlpt  ivsat)a2ta(mpno1oex mi3iysfsDumuvs t4 ltrio oa1la  auvslt) ruoxopnudlptn fes sfsDuaurp;o0opxo i3tyd s2rm(vo t)tlxrmf3ta1omteaneol()srumim oydope liesa( s2rr(ronu4tlx iieiadlaDelnvp;t0tleomr3iydop r ivs;( texoxo iy4amtnmict s artrx p;t1oexnmi3iytfs2ra(vont0 leoif oa1fat anvi t0s2tmim3oydomenmivs s aDurum no4tlxnmfcildfa emu on() lerxf3tatfmD  nvi s  rxmxm3oodom emicia(fa2rm(  no1olt mf3tys mDeauvo;t0arxnifcootfmte u ils)s2uo(m oudlptemies sf 2taxronu4tpe mociyt a2ea(mo (4 etrircta1omD lueol( t2uoio ny4apte fei tf Dtruronu0apxo ieilslmDuauvo;t4tltoxo3iytoaD  nvo s) 2xrxopnudlm elfct sfaDra( pot0oleo feiatfa em(vp;u0teermr iydomDr n s s)srto(m oy4ol   nes ()aDuru o;o0tet  fetls sDrln s;u) ltoxf oydomD lu s;t0 exoxopiy4lmte netatfs2raxmpoo4opxnifctat a rmumont4aexrxf3iotfm r i o;(0truo(opiu4ll   nviat)arrrum ;t4oltnifetadfsDem(vp u)tlxrmf ia1fateaueo s)s2toxmpny1ope mfeslt)a2rr( ono4ape iieiatfm uaumo u4aexrmr3tadla  anvi;t trtm(mpnu1lm nmnvias s2tmurp;u1apenioeild aDea( p;(0teenmfcto1om   ues t)sexoio3oydllenlnciasfsDumumo;u0tleoiiciytlmDuan p (4alxnmr3tytomteluvo;t  exrxo3iu4amte fesa(  2ur(  ;o0tlxoio3ils a uaums (0arxomf3ta1omt  ueils0s2ur(o3no1alt  ncsasfaDtrxmpnt0olxnifetas mDel(mon(4aetrxocoodfaD  ueo s0 exo(opoy4lmtn fctas a2ua(rpot4tlxoioeild m rl( pnt4tlxoxfcoadoate neo (  rxoiopnudaltemiesl(f Dumxmo;o4oeenmoeilslaDuanvo;(4tetoxrciotfa eaiei;s0seur(rpio1om n nvi ( srumxrp;t0tpenmfciasfs2um(vp;t)areoifctatfatranei;s)t2xo(m oodlme lnvs s)s2rm( pot1opxo o3iltls em( o u4texnxr tytla  lieils tetm(r iudllen fcs () Dta(mp;o4alxniiciys a2um( sn(0 reoioctadlat anvsls)srtmxr iy4aptelict t sDuaur ot0tpx mfeiysfs2ua(vp (4alxnmo3oa1om eluvi t)sexmir oydale  net tfsDtm(rpot0tptnmoeiytfaDrmuvp u)aetoif tytla  an o;s)texrxr oo4apeemietas)a2um(rpno4olt mf3iydla2ulnvo;t)arxrmociotlpte n i;()seuoxm iu1amtn ictat  2tmx p;t4opt io3tldlm ran sn(4 rtnmr io1om r n sls0trxr(o nu4llenmici ()s2ra(rpnu1aetnif3tyslsDemu on(0 etniocta1faDr nes (0tetm(mpoo1amtn fvtl(  2uaur ou4olx mi3ildlsDrl( p;t) lxomf3ta1fp e iei (0teum(r no4olee ivtltfs2urumpno4aptomo3tysfs umnvo;u)alxrir todoptraueo;s0 rto(o iydllen ivi sfsrrau  oo0apeoiiciat m2raumo u4 etomr tadomD aivs;()trxr(mpoy4ame  ivslsfaDuaxmp;o1altomfcias a rau o (4altoio todopDraivi;(  2tmir3iy4ol elieta( aDuau ont4aptomieiadfm2ran snu) ltnif3to1lmtelnei;()t2xo(m oo4ll   nvta() Dum(rpnt0oetnifciyt mDuau s (0trtoxfciytfaD lueo ( s2urim iy1lle lietas)a2tmurpot0olx iiciysla2el( o t4 renif todfa eauesl(0 eur(r3no1lmen ncsatf 2tru oot4tpt  ietadlaDraumo (4trenxf totopDr nvs s0t2uoio no4ope lies s  Duru  ou0aleo fciys a2em(monu)aeenxr3tydfateluvs;t s2umiopoo1amtnmnes t)a2uax  oo4optnii3ilsfa2ran o () lxnif3oadomDran ilt0t2xm(mpno4apt mieta(  rumu  ;o4apxnmicilsfsDumnvpnu4 lenxrcoydop elnes;()t2toim3io1op  miesat sDraur ;t0oltnifcild aDumnms t4trxnmr to1lm e i s;( sexm(r3iu1al emieslsfsDtau  ;t4tpxnmoetydfs rlu on(0alxoif iadfaD anvi;s)s2xrir iu1amee fctl( s2rm(  ;t1aee  o3iasls2em(vonu4teenmf oytopteli i (0 2xm(r3no1alt licsl() 2trx p;t1texnmfcilt m rmnmo;() lxnmo iatomDeai s;( srxoxopoudapt lfcsl()arrrumoou4alx mo3ilslmDemuvs t)trtrio iatlmDelnvslt0 etmxr nu1ap nmfei sfa2ta(moou4olenio3tltfm2rln pnu0altrxo tadfp elneo;s0 rxoim3ny4llt lnetas) rtaumpoo0oee mf3tytfm rm( s t4 exnxocia1omDe iei;s0 eum(m iudam  mivt s) 2tm(mpno4aexomo3ildfs elu p;()aeenmr todfptr n o;(0srxrxm3oudlleelfeslt)s2rmxmpnu0tltomf3ilslaDuaumonu0 eermocoatfmtelnvo;s)tetoxm3ny4ole lfvsltf 2rmxrpot1alt io3iltla eau p (0arxnmociy1lmD  nesl(0setrxrpiudom n ics sf Durum no0oltnmo3iad m2rmumsnu0altrif totfat  ivo;t srxr(o ny1lm   fcsl( aDta(mpnt0optnmociadls umnvon()aexnxr oy1fa eanes (0trxr(o oy1oleemicsa(fsDtr(mpno1tltoiiciasfm2uluvp;u4 ltoir oo1fp  lnvi;t trumir ny4amtemfcil() Dra(m ;u0tet mfeildfs uanvsn(4alxrif3io1fa e i ils  2urxo iu1om  mnvs t)arurxrpou1tpxnifeilt a2rmn p;()trenio3oy1fatranes;( s2xo(r3io1altnlnvs t  Drmum ou0oee mfcias aDrm(vp t) rermo3oy1fat lu olt) rur(o3oodlltelfvtas srurxmp;u4oetomietytfa2rauvp;(0texrmr iadopt  ieols0t2tmirpiydam emncias  2trurp;t1ope  fctydls uan p () rtnmrcoodom elnvsl() rxm(o io1ol  lnetltf Duaxm nt4oet  ietysfaDeanmo;u)trtoxo3todlaDe uvs t0 2trxm io4ale livtas)sDta(rp;o0aetoioeilt sDumnms;u0treoif3oa1om eaueols  rxoxm io4lltnlnvt (f 2rm(  ;u0apxn o3ild s ea(vsnu4tetrxo todlat  u s () 2trxo3oydoltelieia(faDtr(ronu1ole moetys s2el(ms u4 rxnmrcto1omD lnes t sexmxrpio1aptemfei t aruaxro;o4aptn ietas a elump;(0aexoxr oy1fm  lneils)srtrir iodal  lfvias)arur(root4oexoii3iat aDul(vo;(4tlxomr3totfpteanvo t  rtrir3oo1ameemicia()sDta( o;o4tpxn ietatfa2rm(vs;(0 ltrxocoydfmDeanes t0srumim oydop e nesas) 2rauro;t1oltn oeiyt aDulnmp;(4trxnmf3ty1lmDraieol(0srum(rpnydap n icta( arta( p;t1alto o3tld s2el(vo t) rtrxoctadopDelueil()trxmxrpno1lme  fci (fsDtax pot4oeto icildls2el( on(4tltomf3oodfaDrauvs;(  2urxm ny4omte nvtls s2uaxr ou4olxn o3iaslsDeluvsnt4alxomf3oydopDelivil(  exo(r3ny1oltemnei t) rrrur ;o0tpeo fciatfaDeau s u4 rtnif iadlpD au ils0t2trir oodol n neia(f rtrumpnt1tpxnmo3ilslm2umums ()teenmr oo1lm r ivol()s2uoiopnu4apte fes s  2tru p;t1tltnmicild m um( o;(4 eenmo3oydoa eanei;t  2xrxr ny1om emfct (  rra(  no0ope  ieiasfa2ul(mo ()trtrxr iotlm   n slt)s2urxm3no1optn nvs tf 2uax  no4olt  iciatla uauvs;()aetnio3ty1lmt aneslt)sexo(r ny4lp e nvil() 2tmum nu4alenif3ild a2rluvs u) ltnif3oydomteai i;(0srtoiopou1aleemivs ( aDuaxmont4oexn f3tasfa uanms;t)aetrio3todfm eluvs;(  rum(rpiu1lmenlivta(  rrrur no1tex  fetyt sDran o u4trxoir ootlaD  n o s0sruoim ou4lpe  iei t)sDtr(  ou1apx mieiadla2umn s u)arerio iadfpDe ivs;t0 2xrir3nydoltelfvs t)aDra(  no0olen feiltfm rl(vp;(0aetrio oa1lpDrln i t sexr(r oodoptnlneiatfsrumx o;o1tlenifctad aDuanmo;u4arxnmf oy1fa  ln s (0tetm(opoydaptnmnet ( aDrmu  ;u0oexnif3taslmDeaumo t4 lenxocoydopDeli s ()setmxm oo1omt mncs tf 2tr(mpno0aeeniociltfsDumuvs;()alenmf todoa  auei;s0texm(o io4lm elnei ()sruax pnu4tle if3tasls2rmnms (4 rxrxr3oodfaDr ivi;( srurxrpou1lpt lfviat  Dtmx  ot1tptnioetadfa um(ms () rtnir3todlmte ueo;t)s2umim oodll  mncs t)a2umxmpoo1tlto f3iyt sDea( s t4 eeniocoy1fateluvo;() rxmxr3ny1apen ieta(f rta(m ;u4optomictls mDemumon(4 rermociadom  an olt0sexrxmpny4apenmfcias  Dtr(  ot4tpen feild a2el( o u0 lxrio3todfaD li s;(  2toxm3iu4ol n fvsa()aDtrxrpnu1opx  feildlsDemnvpnt0tetrxfcoy1opt  neil(  rxo(o oodam emivta(fsrtmuro;u1apxnmf3tld s emuvpnu0 rermr3tadom  aueslt0 2uo(rpno1om  mneil() rua(rono0olxomi3iytfs2ea( p;() rtnir3iadoaDeanvi;t  2umxopoy4ape lieta() rtaxm ot0tee iieias m ra(mp;u4teeriociatfmD lnei (0t2umimpnu1lptnlfeil( a2tmu  nu0oet iiciyt a2elu s ()teermo3oo1fa raiesl( t2um(r iudom elicil()a2tm( pno4aee moeiys aDrau pnt0altrxrciytfpteanvols)tetr(m3iu1openlfvs t)a2tm(rpoo4oet  oetlt m eluvo;(4tlerxo iytfaD li i (0 rtmxm3oudap emfetl(faDtrx  ;t0tpenmf3ildfa2ul( o;u0 leoif3io1omD lueol(0t2urxr3ou4lp e fesa(fa2rr(mpou1altniocias aDel(vs;(0trtnmo iydopte neo;t) eum(o nu4alt  ictas arrrurpnu0tlx mf3iydfmDrlnvs ()trtrxf oy1fa   nei t) eto(o ny4lp nlnci s  rum(ront0tleoifetlsfm umn snt)tlxoir3tytfmt luvols0 eurxm no1amee nvias)aDta(  ;o4tlto fctytfm2ua( o ()tlxnif oo1omtrli i s0 exm(r nodopt lnvtl()aDrm(rooo4opx  oeias mDulnvsn(4 eermrcta1la  aieo s s2uo(r iu1ale mfvsasfarrr(moou4apxomo3ias a eauvp u0 rxnmf3oodfmtr nei;t  2xrim iy4lltemnctlt) rrmump;t4ole ifciydlsDua(vpnu0artoxociy1lmD aueol()texoim nodlp elnvsasfaruru pnt0olen ietydla eln o t0alxrir ia1fpD aueilt setoxr3ou1apte ictasfsDumxrp;t4alen oeiasfa2ranvsnt)areoio3ootoatelu s;(0 2xmim ny4omt  iesls  rrru ono4oltnmfctat m2elnms (0trenio3tydoa   ieo;s0 2ur(opoy1ll   nvi (fsDtmxrpnu1tleoii3ias m2emnmpnu) leoxrcoa1lpDe ueslt)trxo(o3ou4llen fcs s  ruaumpno0alxn iciatlmDelnvsnu4 renxo3io1oaDe n s;() exm(mpiu4opt mfvt ()a2urx o;o1olxnmo3tasla em( s;(4 etnir oa1lmteauvi;( srxo(o3ny4om elfctatf rrmuro;u0tpxn f3iatlm eau o t4tlxnxrciadlmtr ivils) rtoxo3ny4ape  fci t)sDua(rpot4opx mf3tldfaDeluvp u) leoxf iytfmD lnvi;s0sexrxm3iy4lmtn ivtlt) rtr(mp;o0tleniietas m ulnms t4 etnxr iy1fp   ivi s)srxmir3ny1om  lnvsl(fsDrrxm ot1oltnio3ils aDrmnms;t)arxrxr iodfmt ln i;s)t2umimpny4amt  nes () Drrxm ;o1alxoiietytla2rmnmp u)teerxrctadlpD luei s)t2uoim iy1amt  fvi (  rrmxrpnt4tee  f3ilsfaDumums u)artnir3ootfat  ieslt)teum(r3nu4opeelict t aDuau  nt1olx  oeiatfa ranmpn() etnir totlaDe n ol( trur(r3iydlmtnmfeta(fa2tm(r ;u1apx moeild m rln s (0 rtoxf3oytopDr uvi s0 rtmxmpnu4lpeelfvt t s2raump;t0apx  ieiasls2rl( pnu0aeenif iydfm  lnvi;t)srtmxr3nu4omtnlnes t)artaxmpnu0aetomieiltfmDem(ms;u0trenio3oy1lmt  ivilt teurirpnydoptn fctas)s2trx pou0apeo oeiaslmDra(vp;t0trermo3to1opDe ieilt teurxrpoy4lptnmicias)sDrmxr nt1oleo f3iltla2uln snu0tltnmo3oytla r nvi s)t2tmxr3io1am  mfciltfsrrau ono0tlxoiociydls rm(vo;(0 eenmfcoo1omDrlnes;t)t2tm(r iu4apeemfciltfsDrrur ;t1opto oeias m rluvpnt4 lxoxrctodomt lu ol(0 2xmiopiu1aptemfvtas  rrmxr ou4aetoio3ils mDea( o t) rtrio io1fp  lues s seumxmpoydopt lics t sDrmu  nu1tet if3iltls el( pnt)artrxo ta1oaDrluvs s  rxrio iu4lp e ivias sDumx  ;u0tptomoeiaslsDrauvon(0alerio3to1fmt auei;s0 2ur(rpno4altnlnvi ()s2ta(mpoo4aptomictyt m rlums u)tlerxf3to1laDrai sls0srxr(m3oudlp nlfvtltfs2umum ;u0texo ieiydfs emuvpnu4tlermocoodlpDe ieo (0t2xr(r oy4llenlietl(fsDtmxmo;o4open o3iadfa umnvo;t0trxnmr3iytfa eanvs;s0seuoimpnudaltnmfct tfs2rmx ono1tltn ociltfsDraump (0arxnifciotopDr ies t setrxm3nu4ome mfctlt a2um(r nt0alxniicildfs elu o u4tltrifcoy1lpDelivo;t  2xrxm3oydlmeelicslsf rumumo;t4tlx ifetytfmDrmums;u4trxrmo oa1omt lieslt  ruo(m3oy1omtn nes s  2tau pou0olen ictat s2eluvp;()tltrxf tatop  auvi s0trtoio ou1oleemietat  rtmxmonu1ole mfeiatfa2ra( sn()aleomfciytlp e ivilt s2toim oudom   feia() rrr(  ou1tpenmfeild aDem(ms u0altnxo3iydoaDeau ols) rxrxm3oy4lp nmnci t  Dtrur ;t0olxnifeiydlm2ulnmo;(4artrio oy1la rlu olt) etr(rpoudlmtn iesl( s2ta(ront0aet miciad m2elnmp t) rxnxrctytlmDean ols setr(opou1lpe mict ( srraxr oo0tlenmfcilslsDemumsnt)trxoir iodfm  an o;s) exm(o3nodoptelfcsl() rum(ronu4tpx mieiadlmDum( o u4aetnxfctodopD aues;( seto(r nodlpeelncilt)srta(mpoo4apx  iciaslaDua(mpn(0tleoif3io1oa  livs;s) euo(mpnodam n ivilt) 2taump;u1tlxn oeiaslm2rln p u4 rtoxf oa1fa   u i;() exo(r io1olenmnetls  rum(rpnt1aleomiciad sDuaumsnu4 etrxrciy1lpDrlieo () rumim3iydom nmiesa()aDum(m ;t0teenmi3iyd m2rmnmsnt0 eerxo3oadfa   n i;() 2xoxo3ou1aptnmfvsas s2rm(ro;u4oltnmociaslsDul(vo;u0 lenir3ty1omt lieols t2xmxm3ou1llee ivil(fsDrr(rpno1alto i3ild m umuvo;u0tleniociytomt luvilt)s2xrxo oudllee netlsfs2trumont4altnif3iydfm eaumsnu4teenif3oodopte ivil(0teumxm3oo1llee neil(  rrau  nu0apto i3ilt aDum(mo u4 eermrciodlaDe ies;s  rurxopno1lpt lietlt srtr(  nu0oet miciatla rlnvp;u0 eenxo3oodlp raneolt0 eurio ou1lpe  net s)sDta(mpnu4apen octytfsDumu pn(0 lenir3oodomDeln ilt  2toxm3ny1am nlnvi tfa2rrxmpot4opt ioeiadfa2um(mo;(0 leomf3tatlmtranei ( t2tmir io1ol emfeils)aDraur nt1tlxnmietyslaDelumpnt) exrxfciotfm e nvils) 2trir iudlptnlfcsas arur(  ot1aptnmictldfa2umuvo;u0artniocta1fm eaieils)srtr(o iu1lp elieilt srua(  ot0tlx  octlsla2rau s;u4trxrmocta1oaDraues s0seurxmpoo1llt lnetl(farta( p;o4aeen o3tyt s eluvp;u4teenxf iytfaD an i s)t2xoimpou1ap nlnet s aDrru ono4tptnio3tldls uanvs;(4 lxnxf iytopt ln o s  rurio ny4llee nesas srrr(mo;o0tpxnmieiydfs ea( s;()alxoifcootfptr ueol(  exmxr3oudop e nesat)sDuauro;o4apeomietyd aDemnmp;t0arerir3oadoat lues;(0 euoir3oydam elfvilsfaDum(  ;o0tptoii3tatfsDelnvo ()artoio3oadfmt lnvi;(  2trio3oy4al   nesatf rtr(rpoo0apen o3tysla ulumsnt4 exnmr3iadom rlueo;() 2um(r3oy1op n ies ()aDtrxro;u1opx iieiatfm elnmp;u0tlxnmfcoytomte nei;()trxr(mpny4op nmnvt s s2uaxrpno4texo oeiatlm rlumo t0 lxoxociy1omt luvi;t0tetm(o io4llen fci tfs2ua( poo1olxoioetatfsDemu s ()aetnxfcoo1lpt aies;s)s2xr(m nydapen fcs ( arurxmonu4aetomictytls2rlums t)arenxr oa1fatrauvs;( setr(mpio4alte fesa(  rrru p;o0aexniietltfs2el(msnu0 ltnxr ia1fm e ivsl()sruo(opio4aptnmfvsatfaDraxmpou1apt mi3tls m eln pnu0altrxr iytfp r uvi ()trxmio oydapen ncsat  2tr(  ;u1apxn i3tltfm elu p (4 renxrcoadoateaueo;(  2tmxrpnudop   neiatfa2uru pnt4apt ioetadlmDelnvpnt4trtoxf iotomte nvi s t2urimpiodolt lncsas a2trur nt1alt ifetlt a rl( pnt4aeerxr iodla e ieo t0 2tm(r nudlpt livi (fsDum( pou1alxn o3iyd a ua( p;(0arxnifcoatfa   i i;s0 2xrir oodolee ict t  2raxrpot0oet io3tytlaDeanmont0 lxnxrcto1fpte n i;( s2to(m3no1amtemnvs ( aDra(root1tlxn feiysfa2em(mo;(4 reoir io1latrli o;s)trurxm oo4opte nvtltf 2urump;u1tltniicild a eanvp;()aetnmr3io1fpDeluvs;t)tetrxmpiy1lle lncs ( a2ur(monu4ope moetls s2ul(monu0aexrmr iydlp  anvi s) etm(r3nudalt mnetl(fsDuauroot4altomietytfaDrlums u4tlenxfcoadfmtr ivi;()tetr(o nudaleelnvil(faDumu pnu4tpxomfciyt a uauvp;(4aexrxfciadop elu o;t0 eumirpiy4op n ictl()sDtau ono1tpen oeiat a2rmuvo (4 lxnif tydlate neils)s2umirpiu4lpte fvils  Drax ont1oetn i3iyslmDrln on(4aeenmociotlmDe ieo s) exoim3iydllt mnesls aDrrumoou0opeo octat s rmnms;()alermo3ty1lm rliei;s t2xm(m3oodop nmivtltfaDum( poo4oexn fctat m2eln ont)trtrxrciy1fa e nvo;s0truoio3nu1ll emnet sfsrrrx  ou0teen oetasfm2ua(mon() lxnxfciatoa r i o t)s2xm(r3oo1omeelfetls aDumx  ;t0tle micilsfs em( o (4 leriocootop r i s (0srumxrpoudaltnmfeia( sDumxr ou0aee iocilsls2ulu s (4trenif oytopDeaieo t)seum(r3io4lltemneslt)sDtrxmoou4aetn oeiydfm eanvs u)artoxo3oatla rluei;t) rumxm3ny1alee nctltf Duaxmpno0tpen ictas s ea(mp t0 lermfciy1opte i ols)t2umxr3oydapt  nvtlt)arrmxmoou4oeeomictatfs ul( onu)alenmociotoa raivo;(  2ur(rpnu1ole mncslt aDrr(  ;t4olx iociytls ranvpn() etoif3oytopDr ivs t  exoirpno4altelfvias sDumumpnt1oet iieild a2rln o (0teenio ta1fmt lu i t  euoxopnu1ll  lfcsa(  2um(ro;t1oexnmictydfa elump;u0trxoif oydoaDraivols  rxrxo3iydolt lietas  2umumpnt4apt  oetlslm2rm(vs;u)treomfctatfatr i i s0tetrxo nu4lm  lieta( s2taur ;u4teenioeiatfaDuluvs u)tleoifciotoat lnvol( seum(opnu1llee fcta()aDtm(mp;o0aexo i3tydfaDrau o;t0tleoxrciatop elnvsls0t2xr(r3iodlptnlncilsfsrumx  ot0tlenmf3tysfs2umnvsn(0arxomf3oy1laD livo t0trxrio oy1ome  fctat arua(m ;t4tptoioeiad sDemu o t)trtomrcta1oaDr uvi;s trtoirpoy1am elncilsf Dtru pnu0optnif3tyd s2eauvon() etrir3tytomDelnvsls t2urxrpoy4om nmictlt  2taurp;t4oltnmieils sDem( o;t0alxoiocoy1laD  ues;( t2trxr iy1al n fet t) rtaxmpno4tleoioetltfa2rmu onu4areomr iy1oatrlnesls0 euoxm ny1omeelfes s) ruaum ;t1aetnmieiytfs rmu ont)trenxf oodfaD  nvolt)setoim oydam  lieslsf rtmxr oo1oexomfeild m el( o;u0 eenxo ia1omt  uvils)texoxmpiodapeelies ()s2rrumpno4opxo fciatlm2umnvpn()trtomr3tadopDe ues;s)tetmxmpoydlp elnvi t)sDtaur nt1tpx  f3tld mDelu o;t) etrio ta1oateluvols0 euoir3no1lm  lncils) Dumumo;o0oee moctadfs2ean o;t0 ltoio3tydoaDr n s;t0srum(o iu1lptelictasfsrumu ont4tee mi3tadlmDuanmpn()artrxf3iodoaDrlivs (  rtmio iydlpeemicsatf Draxront0oeen ietyslm2ua(mo;(4arermocoo1fptr ivo;(0tetr(mpno1am e fvia(fsrtruro;t4aexomo3iydla uanmp () rtoif3totlmtelu o t trtmxr nu4alenmivilsf Dtaxroou0aleomiciys a2emn pnt)trtomf oytopDelivs;()trxoxmpoudame liesls)s2rrur no1opeo f3tys sDean sn(4 rxomfcoodomD lu i t trurxr nu1opt mnes (  2ra(  ;o1olxnmiciysla2rlnvpnu0 lxnmf tytoaD li ols srxrxm iu4omtelncsa( arua(mono1tlxnmi3iydfmDulnvs t0artrio3oatopte ieo;s t2xo(o3ou1apte fcs t)sDraxro;t0tlenii3iydlmDuaump;u)arxrxo3to1fa e uei t  2trxm3nydom n ivt ( a2urx  ou0apxo feiys m2uau s u4arerifcoytom raivi t)sruo(rpnydolen fvia( s2tru  ;u0ope  i3tydlm2eaums;u)aeerxociytla rluesls) 2xrxr nydam  mnvia(  Dum(moou1alt iictltfs2ul(mp;t0 etrmf tadoaDrln sl( s2tmxrpio4llen ieia()aDumumpno4apxomietlsfs2el( ont0 lermf tydla eaies;t0 rurxmpoy4altelnvs t)s2rmxroou1oleo ieilslsDelu p;()treomf3iotla eluvs t)trum(mpou4alen ncs ( s2urumpoo0opxomfcild s2emu sn() rtrxf3iodlate uvs (0t2xoxo3ou1ol   neils srta(  ot4tlto fciytlaDea( pn(4tltoif tadlmDraieo;s tetoxr iodomee fvi ( sDraxronu0ale io3iydfm uan o (4tlenxf3oydfmtr ivi s)sruoxrpnodope lnvt s arrrum nu0aptomfciat m uauvonu0aeenxfctadlaDeai sl()srumxmpiu4altelfcsl(fa2ua( p;u4ape ifetasfaDemnmp u0 etnif3oydfmDr uei;s t2xo(opnodal   ictls a2rrum no4tlen iciltlaDuanvpnu) etrmo iydfp eau olt)trtmxrpiy1lmtnmfeslsf rrru ooo1aexoioeiat m2eanvo;u0tlerxr todla r nvi;()s2umim3ny4llt lnvsls)a2umxronu4tee moetatfa2rlnmp t0 rtnircia1opDr ivo ( trtoxr3iy1oleelfeilt artaxmoot4aex  ieiysfa2em( ont4arerir oy1fm rau slt)srtmxmpoy4apee netat)artr(r no1tet ifeilsla2emn onu0trtrmo3oo1fpt lneolt0 exoim3nydlmee nes sfaDumx  ;o0tlt mf3iadfa2rauvs ()texrmr iadfmte uvo s)srtoim3oy4amtelncia(fa2tax pnu1opto fcildlm em(mp u)teermfciotlaDr u i t)setmxo3io4lpenmfes t sDumum oo0oee if3tasla emnvsnt4tetrxr oytopD lnvil(0 2tr(m iu1lpeemnctlsfaDur(mooo1ape io3tat m umuvp;(0 exrxfcty1lpt  nvil(0 eurxr3nudlp e iet t)s2umxrooo1altnifctatlaDulu s () rtnxr3oo1omtrauvslt0teurimpny4omtnmfvsatfaDra(rp;o1opx io3ilsfm2uan s;u4trenif3ty1fm  lnes (0texoir3iy1ame  ncias arum(r ot1tleoiociltfm ea(vont0tlenmrciy1lptranesls)t2urio3ou1oltelnci sf 2tmx  no4texn i3ilt m2elu s;() etrmr to1oa e iei;t sexr(rpoudol  lfeilt)aDumxrp;o1tlx miciyslmDemumsnt4 lenirctydlat ai slt)trto(r3no1llt mfeilt)sDrm(  ot1tlx ioeiadfm2ul(vp t0 eenxo todlmDeli sls s2umimpiu4amtelfct ( sDrmumpnt0apxo fctadfsDemnms;()trxnmo iydfpt li slt t2xoxm oodaltn iciat)sDtaum oo1texniictad m2rmn s;(0altoio3io1omDeaneilt0 rxrio nu1lme lncsltfa2rmum no0oeeomfcilsfm2rauvs;u0texrxf3todfa e ieo;(0s2tr(r ou4ap elfvslsf 2ra(rpou4aee mf3ils sDrl( p;(4trxoxocoadfmtr i i t)teuo(r3ou1amtn ieias)aruaum oo4tlx ii3tydfaDrmnvo;()artnxo totfpt  nvs s0 eurxopnu1op  lfvsa(faDrrxm ;o4alx  f3tltlaDeau o (0areoio oa1opDrluvi;() ruoxmpny4llen nvias srrax ooo1opx  fciadlsDra(mo;u0teenmr tadoat  nvs t0seumxo iu1apenmnvsat)a2rmxro;t1tpe  fciydlmDeanmpnt)texoir3to1oat lueolt0setrio ou1lpe lfcsas arum(moot1apeomociaslaDrauvsnu4arxrmo oy1op  anvi;(  etrim3oo4ale mivs (faDtaumono0tpx mietadfa ra(mp t0 rerio tatlpD lneilt)s2xmxmpny4oltnlivta(  rrr( oou1texo oeiyd s uau o (4aexrmfcoadfpDr uvi t trum(o3ou1lm n nvs ()srtru ono1opeoiieildlaDeau s u4tltomoctadop eli i (0 2trimpou4aleelfesa(fa2rru  oo4tpen ietytfmDelump t0tetoxo io1opDrlues;t) ruoxopno4amen ies t  Dtmx  ;u4opeoif3iyslm ea(mo u) rtnxf oa1latean s;s) rxr(r oy1om emivils)srrmur ;t0tpx mf3ils a rmu p;(0tleoio3to1fa  luvo t)trumxr io4ol  mfeilsfartmumpou1oltoiiciasfs2el(mp u4areoxrcoydopD aneols)sruoir3oy1amt lfvtlt srururpnu4aexniociadls2ran s t) eenmfciodomDraues (0s2ur(o nodome mnvsls  Dur(  ot1optomocildlsDeln s (0arerxfciatlmt  uvo ( t2tr(r oudlme mfvilt s2taxm no0optn fciltlm2rlnvpn(4arxnirciydoa r i o;s)srurimpnu1am nlnet s)sDtaurpno0alxnio3iadfa ranvs (0tleoxf ia1oateanvils)trxmxo no1llte fcs () 2uaxmo;u0tptnmi3tas m2umumont) lermo3oa1omt luvs s)s2tr(rpou4lmeelivta() Dtr(  oo4apt  f3iltfaDranvo t0artnif oodoateaivo;s)s2urxm iu1al nmnet t)arum(  ;u0opeoioetlt aDeanms (4arxoxrcoytoat  uvi t0trumxmpou4lpenmietat)sDuru o;o1aex mocildfm2rmuvo t4trxrio tadomDraivslt t2xrxo3no4op  lfvils)a2ra(mpnu4opxn o3iyt a uaums (4tleoxf oytopt aivils) etoir no1al  lfvs s)artmxr nu1texniiciat a2emnmo u4 exrxr3iadlm eluvo;s)sexoxo oodlptnlfeia(f rtmu  ot4optnmocilsla ra( pn(4aexnxrciadlaDelies s trum(o3iu4om  lfct (  2ua(r ot1tltnioeiasfsDrl( p (4 etomf3tatoptelueo;s) rur(o3io4lme mnei (fartax pot4tetnmo3ildlm um( s t4artomo tatop  lnvol()s2uo(o nu1oleelnetl(f Dtrxm oo1aleomi3tltfm uan on()texnxfciy1faD  u s s)trxo(mpio1lm e ivt ()a2rmu p;u0oltnmiciad s ulu p u4 eenxr3oy1lptelieslt trtmim no4ole  net (fsrum(r oo1alenifciysfm rlums;(4aeermo3iotfp  aneslt0 2xrio no1lp n ivi sfaDuaur ;o0tpxoiictatfs rmu o t) rtoxrctytoaD  n sls trumir3oy4olenlivta( aDtaumono1apxo f3ild a rm( o () etoio ty1lmt aneo;t)seuoxm nodape mfeta( s2uaumo;t1tlto icilt mDum( p;u4texoioctadopte nes t0s2umxm3nu1apenliei s sDur(rpnu4tlxoiieiaslm ua( p;u) rxnir iydfmtelu s t0tetrxm ny1lp nlfesat) 2ua(m oo1tlenioeiadfsDuau p u0artoxr3oodlmD aivslt)setoxo iu4oltemfeias)a2uax  ou1oetn feiat mDel( snu0alxomociydlmDrln s;()setoio oudol   neils a2rm( ont4tpenmfcild mDul( s;t)teerif ia1lmD anes s0 exo(mpoudop  mnctas)artmurpot1oeeomfetysls2um( s;u) etrmo3todlaDelnvs s s2xrxopoo4lptn ies s srur(mpno1tex  fetydfs emnvsnt)trtnmf oatoa elnvi;(  eur(o3iydap elncta()srtmx  ;u0oeeniocild a el(mpnu)teermfctydlmDr u o ()trxm(opoydlmtelfeiat  Dua( p;u0oee mo3iydfaDrl( o (4texoxo oydomte n s;t)s2tm(m oo1amte fctls)a2rrxrpno4oetnmo3tltfs el(mp u0aetnir oadoaDrlues ( sexmimpny1op  mivia(f rrru pou0aptomictys m rmnms ()arxomo3totoaD auvi;() etmxmpiudolt  fcs ( s2tr(r ;o1open o3iadfa2ra(mpn(4teerxf ia1fat  n sls)t2toxrpnudop emivt () Drr(  ;u1ape  o3tysfs ea( pn(4tetrmrcoy1opD li s;(0 2urio oy4llen fci s sDumxmp;u0aeen f3iaslsDua( o;u0 lxoircia1omDeai i;s) euo(m ou4omtnlfviat  ruaur no4tlenmoeiasfm2ul( p;t0tlxomr3oatopD  i o (0 eum(mpoy4omtn ict s s2ur(rpnt1tle mictasfs rmnvo;(4 eeomf oytoaDrlnes t s2uoir3iy4apt micta(f 2tr(mont0apt  oetlslmDrluvpnu4 reoioctodomD an il( t2uo(rpoodlmt mfcta(  Dururo;u0oetniieiydls eanvs (4 etoxo oytlpD  n s;(0t2toxr3oudlpenmfvilsfaDumurono4tptomfciyd s emuvs;(0tlenir3iatoptrlnvs t0 2tm(m no4lp  miesa(f Drrxmo;t1tlt iictls m emu p;t)arxnxocto1fmt  ieo s  eumim ny4ap   ictltfaDtaxr nu4tetnifeiltfs2emn on() rtnmociotfaDrlu o t0s2tmxmpou1oltnmivs s)arrr(rpot0texnmfciys aDrau p;u)trenmocoodfaDraneo s0setoxmpiudalenlnctat srtm( pou4oee ii3iltfmDrmnvp;(0altnxf iotfp e nvilt seurxm ny1lp emfviatfs2taxmpou4alx mociysls2rm(mpnt)trtnif tatomD an s;t0 eur(rpnu1al n ivia(farraxmooo4opto ictltfm2rm( pnu0arxrxo iotoat anvols) rtmxo iy1lp nmfvias  Dtaxrono4olt mi3ilsla2em(mp ()tlenifcoydlpt aueilt0t2xrxo3ou1olenlnvsltfs2ua(m ;u0olx  feiadlsDrmumsn(0 rxoxf todlp eln o;(0 rtr(m oydalee fctls) rumxm oo4aexnmicilslaDranvs;(0artrxf oydoa r i s (  2toxo3oy4ol e netltfa2taxmpot0optoio3tas a2ul(mp;(0 ltnmf tydlaDrlu s;s) 2to(r iu4oleemfvsl(f 2uax  ot1aptomi3iasfaDrln pn(4 renirctatlm rlueslt srumxo oo1optelnciat  2rrxrooo0teto oeias mDrmu s t4tetnmo3ootfmD lueo s0seumxrpoodomt  ivsa( a2raur ot1ole  o3iadfsDran o;(4altoxf tatlateanvils0s2um(mpoo1ape lncta()arrm(r nt0aet moetasfa2uauvpnt) eenif oy1fm r neo;t0teuo(opno4omenmfvsas) 2raum ou4olt  oetytfs2rau p ()teenmr3totlm  li i;t) ruoirpou1llt mivt t  Drm(  ot1tetnmo3tlsfs2ean s;()altnio3tydom   neo s)srtmxm3oo1ope lnvtl( a2raurpnu0tpt mfciydfaDrm(mpnu4 etnxo oa1fp   ivilt0 euoimpno4amtemict t)srrrxrpnu4oeeoiietys sDemnmo;t)texnxocoadfmt  uei;t0trtmim oo4al e ivtl( s2rmxmpoo1tpeomfctad m umn pn(0alxrxo oa1fmt auesls sruo(opny1amte ncsls  2ra(ront0aee  o3tls aDuauvs;(4aetrxf3iadlpt  i ol( seum(opoudolenmnctat sDtmu onu1tee ii3iatla em( sn(4aexrxf oodomtrlueols  ruoirpiu1ape  ncs s a2rru onu0alx  ieilt m rmuvo ()arxrio3oydom ranesl() etoiopoodlptemnes sfa2uru pnt1apeo o3iysfa ul(vsnt0arermfciotfmDr nvs;(0t2ur(opiydol  liet s srra( p;o1altoifeiyt s ua(mp;t0 rxomf3tatlmtelnes ( seuoxo nydlm e nvt tf rrm(r ou4alxn fciltls2rau on()tetrmf oydop eli i s) rxrim ou4optn iesatfa2ra(m ;t1tlxoioctyd m2rmnms t)tetomr3io1lpD livsls trtmio3io4om  mieia(f rtrxr ;u0tptn octlt a2uanvs ()arxrxo oo1oaDelivi;s0srxm(r oodomt  netl( a2ta( p;t4tleoii3ilsfmDem(vo t4tltoxrctytomteluvs ()sexmimpou4ale  fet ( a2raum ;t0oleomfctadlmDelnvonu0tlxrifcoo1opDr n s s)setmirpoy4al elivils arrr(  nu0ale ii3iadls2rlnvp;(4 exrxr oy1oa rli slt0 rumxr3ny1oltn ncsa() 2rr( pot0altoioetysfmDem(mpnt)teeomoctytlmteluvilt0 rxoxr3oodlmtnmncslsfs2tmur ;t4tle iociltlmDrlnvo (4 rxrifctadlpDr iei ()sexrxmpoydamtnlfetls) Dta(monu0aetn feilslsDul( sn(4trtrxfciydom eaivols)texr(rpiodllenlfctlsfsDur(rp;u0apxn feiatfsDranmo;t4aetrmrctatfmteln ols t2uoxm oodamtnlnci s  Dtmxmonu4oltomfetas mDrmuvsnu)artnmf iy1lmt aivi;t)s2xr(o3io1lmtn ivsas)a2urum ou1optomoctltfs2emnmp ()aeerio oa1fat au i;t)t2xrxr3nu1lmtn icil() Draurpou4tee mfeiydfsDranms;u4trxrmr3iydoa  anvo s)teuoxrpoo1amtn nvs t  Dtr(  ou1tpe iieiadlmDeauvs;(0tlenxrciodlpDr ieo t) rtr(o3iu1lleelfeilt) 2rmumoot4ape  i3tadfaDea(msn(0artnir3tydfmDranvo;t) rxo(rpno1lmenlnes (farurxrpno4altniietas a ea(monu)aexrmf oa1la  aueols0 exrxopiodlptnlfcilt)a2rr( o;o4alenmi3iytlsDran s (4 reoxf3todfmDelnvol(0t2uo(m iudapeemicil()artmxr ;t0opeo i3iydfmDeau s () rxomo iytfa eaies;t0t2xrxr oudlp   fcta() rtr(mpou4teeo iciydlm2rl(ms t4 rxrmociadlpt  n ils  exoimpno1amen nesl(fa2rmxr ;t1tetnioctatfsDelnmo (4 eermr tydfat lu i s texmio3no4alt mnctlt) Dtr(m ot1tltnii3iad mDul(vo;t4 eenmf iotopteliei ( texmir3iydal emncsls)a2rr(r nt4alxo i3iyd a rmnvo u4arerxf to1opt  ieols) ruoxr3iy4ll nlicta()s2urxmp;t0opxomo3iysfs eanms;u)trtrxf todfpteau i s)teuo(mpno1lmte fctlt artrx  ;o0apto fetyt sDuaump;t0 etnxo ta1fm ranvi;(0s2trxm nudalen ietlt)srtrum ;t0olxo f3iadla2rl(vp t0teeoif3oytlatraivs s seumxm ny1al nmnetls)sDtaxmono4oexn oeiyd s2uan p u0 rtnmfcto1fpDeluvs;() rxoxo iudal elnesas aruax  nt0opto o3tatfaDulnvs;u)aeeoio iadfateanei t)setmio oodal emicsat)s2ta(mooo0aeenifcias s umnmp t4aleoxf3totoa rauvs;t)trtr(m io1apt  icsl(fsruaxm ;u0tlx mo3tas m um(msnu) eeniocoytoa r u ilt setrir iy1amee nvtat)artru pot1tpt iocildfmDrmnvsnu4alxrmo3oa1om  lu s s  2uoim iu1ll n fvi tf 2rm( pot0ale  f3ildlaDea(vs (4tltoio to1op r n ol() exoxo3oydlm  lneias  rtmxmpoo1opxnif3iys s um(vo;t) lxnio3tydoaDe u i ( s2urxr3iy4ole lfvtlsf Durxmoot4open i3tyslm2rluvsnt0tleomfctodom  anvo;(0setr(mpiudoltnmfvilt artau  oo0oex iiciytlm2umn o;u4 reoxrcto1lpDrln s ()srtrxopiu4ome mfei sf 2rm(ront4alen ieildfaDea(vp;t0trtrxo oy1op elnvolt)t2uo(m3nu1lmt lnvs s  2rr(rp;t4apx ioeild aDumuvo;u)tlermf3iodoptelieil(  rtmio3iy1am  mietas)sDtm( pot1ole ifctltfs2eaumpnt4areoxr ta1lpD  nei;() 2uoxr3nu4olee ieta()s2rrum ot1optoio3iyt sDumn p t4 leomo tadoa ran i;() rur(o3nydom n icsl(faruaxro;u4tetnmfeiytls2elumonu0tlxnmf io1fa e nvi;( s2uoir3nydomtnmnvsl()artmxmpoo0tpxo oetls a rauvp;t0tlxomo iytfa ranvi s)truo(r nudapeelnesl()a2ra(r ;o1tlxn ociasls emnvp;t4tlxrxf3iodom   i i;t0sexmio ny1omen nvt ( sDua( p;o0oexniicilt aDelu ont4tltoxf3iotfmt an i;t  etr(r nudlpenmiciat  rrax  oo1oeto ociysla ra( o;(0tltoxocoa1om rlnvo;s0texrxm oy4ap nmfcs sfaDuru p;o0olxnif3tysfs eaump u0aleoxfciydop ran sl( trtoirpny4ome  icsl(  Duax  ;u0tpe if3iadfa ul(vpn()aexomf iadom  livs;t)s2tmiopou1omtnmnvil(f Dtrur nt1tle ii3iaslm2ua(vp t0 rtrxo3oo1fa rln sl( teuoxopno4olenliei ( aDuaxm no4olxomf3ilt m rmnmp t4tleoifciytla   i i;s0seumim oo1altelfetas aDuaumo;o4tlto o3iyd m2ean o;(4alenxr3ootfpt  nvs;() rum(r3ny1alt lici s)srtr(ro;u1teenifeiasls rluvo;() rtrxo totopt auvsls truoxm3oo1lme mfvtlt artaxmpno4tee ioetltlm uaumpnt)arenir tytfpDr ueols) exr(r3no1am emnei s) Dtrxm ot0apxo ieiasfmDelu s u4 rxnmr iodfa rlnei ( teum(r3ou4lleemnei s) 2ua(m ot0tex if3tlslaDul(vo (0 lxoxf3oodlatr nesl( trtr(r3iydop n nct (  Dtruroot4aleomf3tyt aDraumpnu0teeoxfcio1lp elivi t)s2urxopny4llenmictls) rrm( p;t0alxn i3tltlmDrlu on() rxnmoctatlmDrluvi s) euoxr oo4altn nvsa(  2tau p;o1olx ifetls m em(mo u)tlxrio iodopteln sls) 2urio oudolt lics s) Dua( pno0aexnioeias mDulu p;t)arenxf3tatlpteaneo t)s2toxo3iy1lp emnvtas sDumxmono4tlt mo3ilslaDeln s;u0tlxrxr iytlateli i;t)s2toim3oudameeliviat)artau p;u0aet mf3iys s2rmnmon(4 exnmrcio1fatrau ils)truo(o3oodlme mneia(f 2ua(rpoo0aexnmiciydfm ea(vp u0 lxnmr io1opD  ieols trumxo iodaptnlnctas)sDtau pot0tex moetatfm2ua(vo;t4tltnifcta1optraivilt  exoxo oy1lltnlnesa(fsruru poo0oetomi3ilt m2ul(vpn(4 eerio3iotfaDr ies;s) exmxopoy4amt lnvsas srtm(m ;u4oeto oeiasfm emnvp ()alxomo oo1lp rlnei;t0 etm(m oodlpeelfcs s)arumx  oo4teeomi3iyslsDel(mon(0 reomo3oytfa eai s t0trtoxr3oodamee ivtlsfa2umxmpnt1optn i3iys m2em( s;(0 lxrif iodfat lu ilt)srxo(mpou4opt  ivsls sDuaur ot4alt  i3iadfs ran s (0tlenmf3oa1lm e neils t2urxopoudalt mfcsa(fsDtrxm ;t0tlenifctlsfaDel(vo u0 ltrxocoadoaDe n ols  2xoxo3iudlp n fcils) rtmx onu4optnmictlsls umnvs;u4aleomfcoatla   nesls) rxoirpoodll nmivta(f Dtaxm ;o0oeto octydfm ranmp t4trerir ia1lpDelivo (0s2xr(rpiy1lpt mfeia(fsDtrxmpoo1teeomf3ilslsDrlumsnt0 eerircoy1fp e ueols) eto(r3oudll   nvtlt)s2uau o;t0tetn ociysfm2ran p;(4 rxrmo oy1om ean il() 2trxm3oo4op emiet sfartaxro;o1texn octysla umuvs (4tetrir oytoaDrau s t0 rxoio3io4aleelneilsfs2tax  no1olt  ociat s emuvsnt4arxrio3iadfate nvo;t)seumirpnu1lltnlivilt  Dua(mp;u0teeoifeiltfsDeanmo t0aexnirctodop   ieilt)s2tr(opoo4optelicia( arurx  nu1tlx ifctasfaDrmn onu0alxriociydom  an s ( t2to(o iydameelicsa(  Dum(  ;o0open fciysfsDul( p;u4teenmo3oatlaDe uvs;t t2tmim iu4omtnlnvs sfartmu oou0opt mfctlsfa umn snt4 eenxo oydfptrauvilt  etmio nu4olenmfesls arta(mpoo0opt ioeiyt m eauvont0aleniocootfmD  ues;( srtoxr nudom e nvt t artm(moou1alxnif3iatfa2rau p u4altnmocoy1lm r nvilt0setm(m ou4op n nei tfa2umumoou0aetniictls m rlumo;t0arxomrciatfaDrlivilt seuoiopno4alte fvtl()aDtmurpoo1aleomoeiadlm umnvp u0 eermrcootlaDeauvi s) 2xoxm oo1alen nesasfaruru  ot0oeeoifciasfaDrmnmsnu0aexnxr ty1fmt aieo;(0 rxrim3ou1omeemivt () 2rm(ro;u1alxo fetls s rmu s;()artoirciadla rlivs;t)s2trxmpiodlptnlfei (fsrtaumpoo0aeenmietyd m2em( o;()teermfctodfmDelu i;t)texoxr oo1ap   nvtl( a2ua(mo;t1oee mi3iasfm ulnmonu0altoir oa1fp r ies ()texm(o iu1apt mfeils arurxm ot1alenmi3iadlsDuau on(0 renmf oa1opD lnes;t0t2uoxm3oy4opee feiltfs2rr(rpot4tpenmo3iydls emuvont)arenmr3oa1lm ranvolt  2urir no4amtemicil()arta(rpno1texnif3iytla2ra(mont)tlermfciodoaD ai s (  2umir3oo4ape lfcsa( s2ra(mpno4tet  i3iydfaDea( s u4arxnxr3oodlmtraivs ( texrxm iydlmtn fcs t) rraxmpno1oltn ociatfa rmu snt) rtrmf3oo1op e uvi (0 rtrirpiu4ome liesa(fartr( p;t0olxniietlslsDrmuvonu0arxomo3oytlpt an sls0srtmxo no1lpt  ivsa( artmxrpno1alxnioeildlsDranmpnt)tetrxf3ootfmDrluvo ( trtmir3oo4amtemicsls aDraumo;u0tet moctas aDua( s;u0arerxf ty1fpt auesls s2uoxrpny4alt mncil( a2rmxm nu4oet mfciltfaDelnvsnt)trerio3oatfaDr uvi s seur(opnu4ap  mncs (fsrtr(roou4tpt mfctadfs raums t0aetrio ootopDe ivol()t2tmim iodapt mfvilt) 2tmxm ;o1apeomietas aDulnmont4arenmf3oo1fa  an olt)texoxr3iy1al elfvt (fs2rr(roou1oltnmo3ilslsDrln p u4tlenircty1fmD li i;(  rumio3oydllt lncslsf rua(rpnt4tpxo i3iltlmDrlnms u4tetnxo oytomte ies t0 euoxm3io1apee ivsls)arra(r ot0alx iocild s2uln onu) ltnmf3oydoa rauvo s0t2toxo oodapte fei (fsrtmxmooo4oeto i3tltfs uauvon(4 lxrir3oadlp rlieo s)teur(opiy4aleelfcs t)s2um(rp;u0tptnioctlt m elnmpn(0arerxocootfptran i t)trum(rpou1op   fvi ( s2tmx onu0olxn f3iytfaDemu s t4 etomf oytfa   ivols  etmxm iodlp  mnetlt) Drrxmpnt0oleniociltfs2ua(ms;() lerir iydomt lu o;t0trtr(o3ny4omen ieslt s2tmur nu4ape iiciadfm2eln snt0altoir oy1lpD aueol() ruoimpiu1altn feilsf 2uaxrpnt0aexnmociydls2ulnms t)arenmf3ty1omDe i o t trxr(rpnu4ame  ncilt aDtr(ro;u0altn o3ils mDulu o (0aetnxfcia1om eaieo;() rumir nydlp e ivt tfs2taum nu4tptn fetadfa umnvpn(4 rtnxr oo1fatelieil( teurirpno4ape lfesat)aDrrxmp;u4tpxomieiatfm elnvp;u4 reomf oa1latelu slt) 2urxm no1omeemneiat aDrmxr no1tee ifciaslsDra(mon(0 renxo3iatfm rauei;t trur(o3nydomeelivt tf 2uau o;u4apx ii3iadls2ra(mo;u0arxoif ty1lat  ues s0 2tm(o ou4ameemfciat)srtmxmpoo4apeo o3iatfm rlnmp u0teermr to1oa rli o;t  2uoim3oydlp   iesa( a2urx p;t1tlxo feiatlm ulnmo;u)trtomf tydlmtrlu s (  rtrimpiydam e ieia() 
\ No newline at end of file
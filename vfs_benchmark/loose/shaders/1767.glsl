@@ -0,0 +1 @@
+nvilt s2uoxr3oo1olen fvil(faDraumoot4tpt  feiyd a2ua(vp;(4tetomoctydoa eluvil(0 2xo(rpny1amte fvi (fs2uru p;t4apen oetasla elnms;t)tetriocoydfa elu o;s0trxrxo3ny1lme  fvsas)s2umxm ot4alxnmfcilsfa um(ms;(0aleoxr iodoptr uvi (0 2tm(m3ny4lptemieils) ruaxm nt0tpt iietydls2umumon(0 lxrmo totfp raieo;()trxoxr3ny1ll   fcilsfaDra(mooo0tpeo f3ild a2rmnvo;u0alenmf oy1lmte neils0teuoxr no1lm  lfvsl() rtrumpoo1aexnifetyt sDrm(ms;()trenmfcoa1oat aneol()trtrio nodal nlietat)aDuaxr ;t4ole iietysla2ua(ms (4artoiocoytla e ueils)setmxopny1lp n ivtas)a2umuro;o0aexn octadlm rl( p (4aexniocia1lm   u ol() rtrxm3iy4omee feil( aDrrx  no0oet moeiasfa2ea( pn(4 lxoio oydfaDr ivi;() 2ur(rpnodamtn ivsls)aDrrxrpnu1alx mictyt s rluvon() exnio3iytopDelu ilt0trxo(r3oudll  livtltf 2uax p;o1tltomoeias m2elump (4aexrmfcoatomteau i;s  rtr(o oudomte ncslt  rraxmpou4tltnmiciatls eaumonu4aetrxr3iytfmD lues;s  exrir ny4am  mncsas)artrxr nt0alx  feiytlaDulu s u4trxomf3ootlaDraues ()trurimpio1lme lnviatf Drm(rpot0oeen icilsfsDeanvsnt0alenmf3iodlmt lueo;s0srum(r3oy1lltelies ()a2rmurpou1tpxo feiys s2ran p u4 rxoxr3ia1fpt luvs;t  2xr(m io4opeeliei s)sDum(moot0aleo o3iadlaDrau o;t4artnir3oo1late nvilt  rtrio nodolee ieta(  2rauroou4olxnmiciadfs raump (4 renir tydomDraieo;t sexr(m3nodolenlies t  Drmx pno1altn i3iad s2em( s (0 leoxo ootom r u il()teuoxm3iodlptnlncsat)s2tm(ro;t1ole  o3tysls ea(msnt4 lenircootlmD lnvsls srum(o oy4llenlnvs s  Drmu o;t0tpto oeildlmDumnvo u)tleomo3iodfp rlnvols) rtoxm3oudlp   nesasfa2rm(mo;t4aeenmfetadfm rl(vs;u4aexnir3iadla  an sl()s2xoim3ou1llte fcsl(f Durumont4oltniieiyslaDel(mp (4 eenircoatfatelnei (0 2trim3nydalte fetls  2rm(rp;t4olxo octls m2eaumsnt)tlerxociadom e i o;(  exoxr3oo4lm   iviatfaDrruro;o0tetn octat mDrau o u)trerxr3oodfat ai ils) 2ur(o nydapt mict sfsDrm( onu0aetniiciytlsDeluvp u0 eenir ta1fat aivilt0srumio iudap emivi s srrm( onu1altoii3iyt sDuau s ()texnmf iodoptraivs (0 exr(mpoy1apeemivi t)s2ta(mont4ale mi3iasfaDelnmpnt4texrmr to1lpDean olt texr(o iu4lp   icsl(f Dta(ro;u4aeen feils mDrluvsnu)texnmfcoadlatrau sl( teuoxm3ou1lm  mfcsltfsDtrx oou1opto ieiasfs2uanvp (4 eeomo iytfm   u i;t) exm(r ou4omtn fetl( aDurxmooo0oeen oeilsfaDeln on() leomfcoatlp  au i s0trxmxmpio4ol nmivtl()a2umxroou1opt mo3ilslmDemu s;t4tetnircty1fa rlneo t) etoir iodape livsatf 2ur(  ;u4tpt iiciysls eaump t4tetrmo oadfat an ol( seumirpnydopenlfvil(fartmxr ou1olt if3ildls2ean p;(4tetnmf3oydlmD an s (0trtoxo3nodlm elnetlsfaDrru pnt0tet mo3tyt s2ea(msnu)arerifctotlaDe i s t t2xmiopnodaltelnciltfarta(m no4apeomiciytfmDua(mp u)tlerxfcoy1laDranvil( trxr(r iu1olen icsas aDumxr ;u4ope ioeiydfa2el(ms;(4 rtnircoo1lpDraneol( t2trxr3iodom emiet t)artmumooo0tpto ieiydfa ua(vs u)aleoio oytomtrlieo t0texrxo nodopeemictl()aDtru pnt1tptnmfciydfm elumsn(0alxrmr3totom r ieo s teurim3nu1al emieia( a2tr( o;o0aeeo i3ilslsDrl(mp;t0 etrio3to1lm eln olt0 eurxopoudom emfci (fs2ua( poo4tptnioctatlaDulnvsn(0 rtoirciatfptr i o t srurio ny1amt lnci s)a2rmxront1tpxo fciaslsDem(mp;t4 lerxo iadlp eai ol(0 euo(m ou4olt mfcilsf 2uru ooo0tpxn i3tld aDemnvo;u4alxrxo totlmDeli s s s2toxmpiudale mfvsa()sDtm(ro;o0olt mf3iyd m2eanvp ()tlxnir oadoptr nvsl( srtrxr3iydole lfctl( s2umxm no4tpxoiieiad s2uanmsnt0tlxnio oy1fa elnvols)t2xoxopiy1lmeemfes ()arumxm no0apxn i3iyd a2ulnvs;(0 lenmo3iodom rln o;(0truoxo3oy1aptnmiei t)aDuru p;t4olt  ieiadla rmnvont4 ltnmo io1opt lues;( trtmirpno4ale mivsl(f 2taxm ;u1olxn i3tat aDelnvs u0 ltrmr3iy1fpte u o;t teur(m3iu1lpe lnvtls srta(mpnt0tlxomfctld a ea(mo t0 rtrmo oodfaD ai o;(0 2uo(rpiodapte fct s)aDrmxront1tpxo octadls ulnmp;t)trxomr3oo1late ues;s)sexoxo3io1olt  ncta(fartruro;t1opeoifeilt aDuan pnt0tltoiociatfa   neilt) exrimpiodllen nvil(f 2tmx  ;o0olxn iciatlm2rau p;u4tlxoif3iodfa  an o;s0 eumir iodoleelnvi s)srrrxmpno0oee if3ildlmDra(mo u)trxnxo3todfmDe ueo (0tetrxo3iodlpt lfeta(fs2rmx pot1ope  ictas a uanvs u4 lermo3todoa e uvi;s)t2urxr oodol   fvil() Dum(rooo4opxnmociatfs el(mpn(0tlxnxrciatla  ai ils)t2xrxopou4om  lfetls)srumumooo0alxnmo3ilsfa rmn s;u4texnmo tytlpt lueils0tetrxm ny1ap eliei t  2rr( poo4oex mociydfm2umuvp;()trxomocio1faD lieo;s trtrio oy1apte icsas  rtmu pnu0olxn f3ils aDulu o () lermf3oadomDeli o;s0teuoxm3ny1al eliet s  Duax poo1olxo fciyt a ra(mpnt0tetrmr iytfa elieils)srtmxm ou1op   nvsa( aDrmum nt1opx io3iytfsDulu s (0tlxnxo3iydfa r i i;t0t2trio io1lmeelncsls)s2rm(ro;u0texn feiytlmDea(vsn() rtnir3todlaD  i o;(0setoxr io1amte icil(fsDrm(  ;u1oexomietldlmDuluvs t)trtnxf3oo1laDeau slt)t2xrim3oydlpee fcil()srrrxrpot1oeto iciyt sDrlnmpnu4arxrxf oo1op eauei;t teurxmpiudap emics (  ruauront1tptoif3iydla2rauvo u0 exnxocoytfatrlnvils) 2xmio3iydop  lnet ()a2ur(mo;t4teeomoeiyslaDra(mo;u) rxoxrciytlp  au ol(0t2tmir3iy4lmeemnvsas)s2umurp;u1aleo f3ias aDea(vp;u) reoxr3totlm  lu sls s2tr(o ny4am emnvt t a2trxm no1oeeomiciytls2el(ms (4areomo iodopDelies (0texoxr oo1om nmnci s) Dtrx pnt1olenmoctadfsDeau p;u)tlxomfcta1lpDrauvilt sexoxr iu4lp n icilt  rtmurpno1alenmietld mDrln snu)teermo oodfa   ivs s)teur(opny1ope mivia(fs2ua(mp;u0tpxoifeiasfm2ulu snt4aexnxocoodom   n s t  etrxm no4ole  nvt s)srrm(mpot1aetnmo3iltlmDuan s (0tlxnir tadfp   i o s)t2umimpnu4lp  lics t a2rr(rpnu0tpeo fcils s2umump t)tetomo iotlp elnvolt0srxrxm3iydlpt mieia(fsrtmum ou1oexoiociaslmDrlnvo;t)tleoircta1fm  li o;t0trtrxr oy4ome mnvsasfaDraxm ;u0tptoif3tltfm rmnmont) rtnmo to1la elu sl() 2uoimpiudom  mictat a2rrurooo0aleomfciytfm2eln o u0 etomf iodlp r i s;() rurimpoodam  lncslt aDtrumoou4aet if3iydlsDrln p;t4alerxo oo1faD anvo (0 rxrxr3ny4ale lnesls  rrau pot0alxoiieiltlm2ua( p u0 eerxf3ta1laDe u o () exr(o3iudol  mnvt t) Drmur ;o4tet  ieiad mDrmuvo u4aexoircoodlpD  nvo t)t2uo(o no4olt lneslt aDraxmpnt0tltomietlsfa uauvsn() eeomf3tadop elueolt0 rtmxrpno4olee fesltfsrur(m oo4tlto ietltlsDrmump (0aexnmfcty1om  aueols) 2trxr3iudol  micsa(f rtru p;o1ape if3iaslaDemn onu4trxrxrcoa1oa rliei;s)seuoxm iy1op nmfci t) Dta(  nt0tle  f3iys mDelnvp;u4 eeoxocootoa  auvi s)seurxopou4omt lfeta(f rumx pnt0tetn f3iasfsDrmnvon()tleoif3iatoaDrlnvs s0 2umim oodomt miei (fs2uaxmpoo0aexoif3ils sDuau p u4texoifcio1fpteau o s) exo(r iodop nlfciat sDtmxrp;t4alxo o3iaslaDrln s;t4 lenmo3tydomtrlieils) exo(m3ny4ome  fcia(fsrrmurpoo1oeenioeilsla2ra(mp;u0aeeoxf ta1oatr uvol( texoirpoy4lp e nvilsfarumu pnt4teeo ietas aDua(mp () reoxo3iatopD aies t0trumim nodoleemfeiatf 2rrxrpnu0aet  ieiysfm elnmo u)trtoxocootlmtranvs (0 euo(r3nydam   ivsa( s2urxr nt4aet  f3tadls2rmn sn(0 eeoxr oydomD  u s ( srtoir oy1altemics tfs2trum ot0open ociasfa rm( o u)arxrxfcoa1lpDr n i;s) eurxr iu1altemivtat s2rmx ooo0texomfeiydfa2rl(ms;(4 exnmf3oydop   i sls0t2ur(m3ou4aptnlnvsas)sDtmx pot0oltn f3tatla uan o u0arxrmo3iytlaDrlivi;t0trto(m3oy1lptelfvs (faDtmu oou0texnmfeildfs2rmn p t0aeenxr3iotfp e ieo s)sexmxr ou1lltemiesatfa2umu  nu4tle  o3ils m umuvpnu4 exrirctadomD  n o (0 etmio nu1olen feia() 2tr(mooo0tlx iicilsfsDem(vsnt4aeerxf tytoptrliei;(0s2to(m3io1llt mfvia(fs2raxm oo4alxnmf3tyt aDra(vp;u)aetrio3io1fpDrauvo t)trumxo ou4lmenlfvi sf Duaxmp;o4aexnmoctydla ua(vsnt) rxnxocoy1fp eli i;t  2xoxm iodlmee fct sfsrrrxrp;u0aptoifcild mDulnmo (4alxomfctytlmD aueilt)s2tr(rpoy1lmtemnvils)s2taxrp;o0apxo oeilsla2rlumo;u0 rtnio tytfmDe uei (0teur(m3iy1lp e iesas  2trxronu0ale miciadlsDraumo t4trenifcoodlpt lnvo t0 exoxr nu4ll e fcsls) rumu p;u0texomfciadls eauvo ()arenio3oodom rln olt0t2xmio3io1altelnvt ( srta(mono0oltn ociadfsDeaump;u4aetnmocoa1omtrlies (0s2umio nu1ol  livslsfsrraxmp;t0optoioeiydlm2ul( p (0arenmocio1oat  ivols) 2xr(opou1al nlfeia()s2ua(m ou1oeeomietatfa rm(vs;u4arxrifcoadfaDe uvsls0trtoir3iy1omee ietlt)sDtm(ro;t0oltnio3tydla eln o;(4 rtnxociytopDeaueol()teuoirpoo4lmt  fei sf 2rmur ou1optn fetasls2ean p;u) rtoio3iytoptr u o s) rxmxr3oo4lpenlivils)srrmumoou4alenmfetyd m2ran ont0altomocta1la  li o;(  euo(r io4altnmieia( s2tr(r nu4oltomietys mDem( pnt)aetnmf iy1fp   u slt  2umxmpiydopt lfvi t s2rr( o;o0tpxnmfetaslm2ul( s;t0 etnmo iatlp  lnesl()srxmxrpoo4lm  lnctat  rrmur ou0tpx  fciasla em(vpnu)tlxoxfcia1opDeauvolt0 etr(o no1lmt mnei s)a2umxmoot0olen icildlaDum( o (4alenif3ootfa  aneo;t0 2xo(rpny1oleelnvil(f rumx  ot4alxoio3ilslsDrm(vs t)aetomrcoatomtrlueilt0 exmxrpnydam   fesa()a2umurpot1apeo octlt mDea( s;(0artrmr3todfpte neo t0sexrim3iu4aptnlnctltf 2rru  ;u1tpt ioeildlaDraumo;(0arxrxf3iatfmte nes;() 2tr(opiodam emnvi ()arum(r no0tltnmo3tld m rlnvo;u0alermfctydfmD aueol( t2uoxopnu1al nlnct t) ruax p;o1apt iieiatlsDelnms (4tleomo3todfpDe uvils s2umxrpou1olte neil(fsrrm(rp;t0oee moetatfmDrln p (4texnmrctatlaDr ieolt0trxr(o oy4ope mnvtatfsDrm(rpnu4optn o3iyt a2eau o t)treomf io1fp rln sl( s2xr(o nodam  lfvsat) 2uru  oo4tpeo feiad m2ul(mpnu0altrmo oy1omD  u slt setrio3iy4omenmfeslt)srtaxronu1tptoio3tas s rm(vs;u4arerxo3tadopDr nvolt s2umxo no4ome miei t  rrru pnt4tpeomf3iydfsDuauvo t0arxomrcootlaD lnei ( setriopno1llenlfct (fa2um( p;t0apeomfciadfs2eluvo u4 etnxo3ootlmD luvo;s sruoir oy4alt  nesatfaDum(mo;o1opxniocildfsDua(vpnu0aexoir3ta1lmD  nesl(0trxrim iy1lm n icils) Drrumono1olxo ieiaslsDua( p;(4 lxrmo3oo1oat au ilt  2uoxm3ny4op   nvil(f Drr(m ;o4tlxnifeiyslaDumu pnt0 eenio oodlmDeaues s trtmir3oy1om   fetas)aDur( pno0aet  i3iad m2ulnmo;t0tetnmf3ia1fpDrauvsl()setrxmpno1lm emnesasfsDtaur ;t1texn feiadlaDemnmp;u4trxrxr3ia1omDr nes s0 euoxm iu4al nlnvs t)s2urx ont0aeeo oeiyd a2rluvo;()areoxf3iadlm e ues s) 2trxm3ou4lpe  ncsa() ruru  ot0teeoiocilsfsDrau p;()tleniocoy1opD lnvo;t)trxrxm3oy1lle lfcsls arur(mont0tet mo3iat sDrmuvpnt0tetoif ootfmD  nei t  2trxo oy4ol  lfctls aDraurp;u1apenmfciysfsDuanvo t) rxrxo iotoateln o s0 exriopny4lmtn fvslt  2umxmo;u1oeeoiociasfs ulnvo ()tltrmf3ootfmDeau s;s)sexmir3oo4lmenmivil()aDuaxrp;u1altnmfcilsla2rau p;u0 lxrmfcoo1omtrlieo;(0s2tmiopio4am  livsls) 2umx  nt4oeenmfcildfsDrluvo (0 lenmo oytla  li s;t0trtoio3iu1al nmnvtatf 2umxrpoo0aee  iciydla2emuvs;t0teeoif3iadfa rlnes;t)teumim3iodomeelnvi s artrum nt4opt ifetld aDum(vont0 rxrxr tytfatelueo;t) 2xoxo3oy1am  lnct (fsrtrxmont4tee iictldfs2ulu snt4tlxrir ta1fatrlivo;s0 exo(o3oydlmtnlnciasf rtrumpnu4tpeoio3ilt sDul(mo t4 ltrmrcoytfmD aiei;s)trxoiopno1lptnmncia(fsrta(m ot1altomi3tlt s em(mo t0tltrircto1lmDe ivo s)t2tm(mpoo4lmtnlieias  Dtaxr ;t4ole  feiysls emnvonu)trerxfcoydom e neil(0t2tr(r io4omenmfeias  rtau oou0aetnio3iadfs rln onu0 lenmfctytfa  li s (  rxmir3nu4ap emfeiat) rrax pnt4alt mi3iysfmDrl( s u4aexoir ta1fptrli o t  rumxm3iodomeemicias  rrrump;o1tpen fetytfsDrmnvon(0tleoxf3iadfpD ai slt)seuoxm3ny1amt lnei t  2rau pnt4apen oetltlmDrl(vp t4trtomo3ty1oaDrlivo s  ruoirpiy1apenmncia() 2ua(rp;u1texo ocils mDelnms t4arxrmocoadlptrai i;s)setmxm3iodale mnet sfsrumxr ;o0oleomo3tldfmDra( p;u4aeeomr iy1fpD auei ()srxoxrpiudapenliesas a2ur(  nt4tpto ieildfm2umnmp;(0 lermr oadlp e neil()s2xo(opnudoptnlnei t)s2tr(r ;u4aptomo3tad a rmn s t)artomf iodop   nvi;s srxoir3oy4openlnci tfa2ta( ono1alx miciyd mDrl(vp (4tlenif3tydfpte nvs t0srxrxo3no4aptn fctlt aDtr(  ou4tpxnio3ilsfm2emuvpn(4alxnio3iy1fmD lnei s0trtoirpoydop n iei s) 2tr(rp;t4aet  ociatfs2emumo;t4tlxrmr oodla eanvsl( t2toxm iudlm nmfvs t)aDua(mpou0oetomfeilsla2emnms ()tlerxr tydfmtr uvil()t2urio3no4alt lfvta()srtmu  ot1aet mf3iyt a2elnvo u0trxrxo tatla r n o ()seumio3no1al  mncsl() ruaxroou1tlxnmfeiydfm2umnvsnu0aeeoif oo1om  lu s t  eumxrpnydlpeelieslt  rrmx ooo0opxo f3iytls em(mo;t0 rtoiociotfpt anvols) rtr(m3iu4om  mfes t sDta(  ;o0tet moctls sDul(vsnt0 rtoxoctodfmD aneslt0srtoio nodap   fvta( aDrm(mpno0tpx ifeiltfmDemu p;t) rxoio oytlp  au il()trxmxr3nydalenmiesls) rrrx o;u0teeoio3ias a2ulnvp;u0tlenxf ty1opD li olt t2trxrpiydapt mneiltf Drau  no4teeomociadlm2ra( p t)tetnif oo1om raneols)t2xmirpiudlmee fes (  Drm(moou4oexomfetatlm uauvp t0trxrmfctytfa r uvo;()s2to(o3ny4llenlicias)a2rmx  nt0ape iieiasfm ulnvpnu4trtrxr ootfp eaivs;s)t2uoim3ou1al n neias)srtaumono0oexo octadfm emumsn() eeoifcto1om   u ils)texm(o3oo4alenlneslt a2um(rpnu1oee iictatls2rlums;(4alxrxr iytfa r nvsls) eumxr iy1ap  micsa()arua(m ou0tpe mi3tat a2um(ms u4 lermo iatlmD anvolt sexoir nu1lptnmneslt) Dtm(rp;t4apx  i3ildlmDulu s;t4tetnxrctadfmtr nei t tetoxo iy4omt  fvi (  rrmxm ou4tpxnmo3tydla uauvon(4 lxomr3ta1faDeli i;t texr(mpoy4ol nlfctls  2ta( pnu0opx if3ilslsDulnmo t0trtnio tytlaDeli s;() rtmimpoy4lpe mici ( aDrmx  nt1tle  i3iadfaDeau s;u)tleomf3iatfatraiei;s) etm(o3oodal nmieil()artmu  ou0aexoif3iadla em(vont0aetnmrctytfp e ivo (0 exrxopnodlm  livilt) 2urumo;u0aeen i3iatfm ra(vpnu)treoxfciydoaD li s;s t2xrirpiy4ale livsasfartm(moou4tpxomfeiatfm2rau s ()aeeomrcoydfptr n ilt0texo(mpoy4lm emfvtlt)sDrm(ro;u1tlt  octys s2umump t)texrmo3todopte i i s srur(o3nu4om   fvslsfs2umx oot1tptoioctadfs rl( on() rxnxr oa1optr nvs t) etoxrpnodol  liviasf Drr(r nu0opt mfciaslaDua(mo;u4teenir tytom eli o;s0seumxmpnydopt  nei (f rtr(m ;t4aex ifeiaslaDeaumo;(0teerif3ootomteluei;() 2trio iodaptnmivt ()aDtrump;o1opxnii3tld mDea(mo;(4 rxoirctotfp   n sls sexrir3iu4lmeemnvtltfs2ra(rp;o4texn oetatlm2eaumonu)treomoctotomt luvi;t)sexoim nu1op  lnvia() rrmxrpoo4oet iietasls um(vs;(0aeermoctadoaDe n i;(0 eumirpoodllee fcta(  2rrxmo;o1tpto o3tysfmDrlnvsnu0trxomfctatlmtr u ol(  euoxr3nu4lltelfcsl(f Dum( ono0tlenmfeiad s2ea(vp u)teenxr3iadfmDelueol(0texoxrpnu4llenlivtas s2tr(m ou1tpt if3iad s2rl(vp;(0aeenmo3totlaDr neo;s  rurxmpno4lmt lnvsa( aDumurp;t4tlt ifctls a2ulu pn()alenxo3oytfmt  uvolt0s2xoiopoudom  lncsatf 2rrumonu0oee miciydfsDelnmonu)altoxfcoy1fpt  i o t0texr(mpoudoleemfes sf rtr( poo4teeomfcias m2rm(monu)trtnmfciatfmD anvo t srtoxr ny4lmt livi (  2rmx  oo0opeoiociydfs eau onu4 eeoxf iytomDr neo t0 rtoir3iudlmen ietl( aDtaumooo0oee mfctlslm uanvo t0trenif ootoptrauvs;()trur(r iodaptn ictl( aDur(m nt0altn fctys mDrmnvp;u0altrmoctydfm eln olt sexoxo io4lmenmfes tfa2ur(m nt0oet iociydfaDuanmo t)alxoio tytfmDe uvilt srxmirpnudlp emicsl(  2urxr ot1opxnmo3iys sDrmumont0texoioctydoatrauei t0trum(opoodlmt  ici s sruax p;t0tptomf3tatla2rmnvont0teermocoytoat auvsl() exoxm oydllenlfcsls)aDurumooo0olxo fciytfmDrlump () ltoxocoadomt  ueols0t2toxo3ou4open fciasfaDtr(mooo0tex ifeildfm umnms (0alxrxo oy1lat livs t)srurim iydlle mictls srrau p;o4oex  i3tltlm rln on() eermr iodla   uvsl(0 rtm(m nu4oltnlivil(faDuru p;o0tet mo3iltlmDrlump u0alxrmfctytla ranvsls)trtmim ou1op   nvt tfsrumxr ;t0tlxo ociasfaDea(mon(4alenmrctotla rlueo;() 2xrirpou4llen iet (fartm(mp;u1oetomf3iytfsDua( p;t) lxrxr tadomte u slt seurxo ny4aptemnviat a2ua( poo1opxnmf3ildfs2uau s u4alxrio to1fptrlneo;t0 2um(r3nu1ol nlnvsasfa2taumpnu1oeeo ieilt s uan o t) rermfcoy1omD  n ol()s2urio io4altemnvi ()a2uax pnu0oeeomiciysfs2rlnvs;t0 rtnxrcty1fmteau ols) rtoxr ou1ap   neils  rrrxmpnu0tpt  octlt sDrmnvont4 eeoxr ia1op e u o;s0 eumim3nudoltn ietas srrmumooo1alt  ieiad sDrmn pnt)tetnif3iatfmD au ol() rxmim nydamt  fvsa(  2rmxronu0oleomfcildfmDua( p t4trtnmr3iatomt lu s;()srumirpiu4op nmivs t) 2raxr nt0opx moctysla2el(ms;() rtnxo3ia1fa rlnvol(0 etoir3nudllt  ivs t)a2ra(r ;u4oltoifetytlsDeln p;u4 ltnifciydlptrli o s)t2urxo3oy4omtnlncias)artmxmont0opt micilslsDelu p ()arxoxfcoadfp elieils)s2xmxopoy1lpe  nvsasfsDumx p;u4texo i3tydla umnvs;t4aleoxociadlmt  ueo;(0s2toxm iydaltn fvi tfarrmu o;u0ape moeias s rm(mp;(0 lxrmo3todoa   ieo;s0t2xrimpiudapeemfctls)sDtaxrpno1apto ociasla2rlu p;t0texrmf oa1fmtrlies;s0setoir nu1lme  nci s srrau ont0olt ifetytls rm(vo t)alxrmo iydfa r nes ()setmio3iu4lmen fci t  rtaumoot1oetnifeiysla2ea( p t4 lxrmr3iydoat ln s;(  etmiopou4aleelictasfaDrm(m no0tpto octys mDrlumsn()tltnmocia1fa e i o s0 2tmiopoo4lmeelfvtat)sDrrumono1oltnmictldfsDel(vo t) exomoctatlatrlnes ( s2uoxopio4ol n fvs tfs2rax p;u4tltoioctyd a ra(mpn()trxnmr ty1fpDraueil(  rurxr oodop nmfvs s  2taxr nt1ape  o3tls s rl(vsnu0artoir iytop eau s t0t2xrirpoydom elfcs t)s2taur oo0olt iociatlmDemnmsnu) exrmf oadlmtrluei;t  euoimpiodoltnmncsa(f 2rrx  nt1tpen f3tyt m2umnmpn(4aeenmociatfpte nes;() 2xm(m3ou4llenmncias sDra(mpoo0oet mo3tldfmDrmuvonu)artoir oadomtrli s t) eumxr3iy4omt  netatfa2tmuroou4aeen ieiyt s eanvsnt4aetoiocootom e uvo (0seurxo3iydlpen neils)aruax oot0olenmi3tatlm2umu p u0 rxoxr3totlpDrlneol(0teuo(r3ny4openmfci s)sDrrurp;u0tex mi3ildfaDrmn s u4texrmr3oo1lp  an o;t)srxr(o ou1ol  mfes t artrxmpno4tlen ociydfs rm(msnu4 rermfctadlmDr n i;t0srtrir oudlmte fviasf Drmu  nt0tpt  ociasfm2ea( p t)treoif3iydla  auvs;s0 2xoir3ny4optelieias aDtaxmoot4tpeniociltfmDuaumonu)tlxnxf3tytlpDrlu s (0srtr(m3iodam elneilt srurx onu1tpe moeildfm eau s;t4aexoxf3oydlp elivs s)s2to(m3iodlmt  ivsl(f 2tmx pnu4aexnmfetat mDemnmon(4texrir iydlm  anei (  eur(r3ny1ap emicsls) rurxr nt1opt ifctysfs el(vont0 exnir3todfm e i ol()teur(opnudlltnmivs s aDraumont1teenmi3iys s ra(vpnu4 lermoctytoate n i;s  2umim iy4lpe mnvias) rraurpoo4aex ioctatfsDumnvp (4tlermrcoodopt  nvo () rxmxr3ny1ap   nesltfsrtmxmoot1alxnmociad mDuln snt0artnmf todlp   iei;t)teur(opno4lpe  nvsa()aDrm( ooo0teto fetadla2ulnmpnt0trenmo oy1opD  nei (0texm(r iu4lltnmieilt)srrr( p;u1aeeo fcias mDeaums;(0tlxoirciy1lm r nvs;t trum(r3ou4ale micsatfsrumx pnt4tlto oeils mDea( pnt4tltnmr3totfp rli o;s0trumim ou1ame mfcslt  2tmurono1tlxo oeild m2emnvo t0 ltnmrcoy1fp  anvs;t) rtoiopnu4llen icsl(  rrmx  ;u0tlxomo3iasfs2ean s (0tltniociatlmtr ueo t seurirpiodlmeemfcs (fa2rrurooo1ale mfciysfsDrmu s;(0trtoif io1fmDean s;()trumxm oy4al n fet tfs2uaumpno0tpx mf3iytls2ran o;u) rxnxf3tadlate i o ()tetrxo io1ol emfvs sfsDur(mp;u0apt iieiatfs emuvp;t4areoxoctatfpDeln ilt trxo(m3iy4ol elnvia(  2raxm ;t4aexnmociadfm umnvo (4tleoxr oy1oatr i ilt0s2tmio iy1ale  nvs s sDtrxm ;t1tleoifetldfsDrmump u0trtnxo3oydop  auvilt) 2toxm io1lltnlictltfs2tm( poo0oexnmf3iyt a2ua(vpn(4tetrio to1fa   n s;s0sexm(o ny1apeelivt (f 2ua( poo1aet mfciatlm2ea(vs;u) lxomrcoydfpteanvi t s2xoio oodamtnlnesat) rtrxmo;u1tptnmf3tlt sDea(vp u)altnmo todfm  li ils t2xoxopiydllte ivil(fs2tmxmpnu4texn o3tyd m2el( ont4 lxrxrciodlm eluesls  2umir oo1al e icsat aDumxmo;u1apt iicilslm2umu p;(4trerxr3oodlm r nes;()truoxr3iu1lptelnesl( sDtruroou0aptnmfctat s rmumsnu)texrxf3totoa rln ols0sruoxo3no4lp e nesls  rrm(ront0aeeo i3tlt sDem(vo;u0trxoxf3oa1fa   i ilt  rtm(mpoy1lme  icta(  Dtrx  nu0tptoiociysla2uln s;t4tltomo3oatfpD lu ilt t2umxm3ny4ap emnvsas)s2tax pnu1openioeiys m umnvs;u0alxnio tadfpDr uvols trtr(o3iy1lltn ictls) rtrxrono1opt  f3iysls2uan snu4trerxr tydla  li s ()srxoir3nydap   icslsf rra(rpoo0altomo3tysfsDean o (4tltnmo3oy1latraues () rtoirpoo4omt lfvilsfarraum no1olxn feiad s2emuvs t) exnxo3oadlp ean s;s)t2to(m iudamenlnvsa(  ruaurp;t1aptomieildfa2rmumo t4 lerioctydfm raues s0s2tm(opou4omt  ictls)srtr( pot4ape  f3tytfaDulnmp () lxoirctatfp elu i;s)srxo(m3ny4al e ivs tf 2trurpou4olxnio3ias mDrmnvsnu) etrir3ty1fp ranvs;s) 2umxm3io1lpenlnctatfsrtmum ou0tex ii3ilt aDrln pnt4arxnifcoa1fp raiei t0texo(rpio4am e net ( arua(mpou4aetoiieiasla umnvp t) rtnxfcia1oateluei;s)trtmxo nudol nmfvsl() rrm(r oo0oet  ieiydls rm(vs t)trtnioctotopDr nvil(0 exrxm oodlpee icsatfarra( ont0oex mieilsls umnmpnt4 renif tytfmtraueo s0 rxoim iu1llte fesls s2rmu p;t0teeniictyt m uaums;t4arermr3io1lpDeau o;(0t2xoirpoudlle lnvils  Dtrxm ;u1oexo fciasla rmnvo ()altnmr tadoa rlnvo;( teto(o3oo4ape mnvi () Dtaxrpnu1tpxo oetys s uln snu0 rtoif3iytlatrau i;s)srxrxr iydap n fcsls)s2umum ;t0tpxnii3tatfmDua( ont)aexnir3iatlmt au s t0teumxm3no1amte nvt sfaDtaxm ;o1aetoifcildls rl( snt) rxnxrciodlptelieo t) eumimpiu1om  mfvs (fsDua( pou0texn fciydla2umuvpn() etnmf tytlmteauvi ()t2trim iy1olee ieia( a2uaxrpoo4ope moetatfmDrmn snu4tlxnmf3oadlmD aiei;s0teurio iudam elivtasfsDur(root0oltoioeiytls umnvp () leomf3iotfmDr i slt  rxoio iy4ol nmnvsas)aDrm(ro;t1olxn o3iyt a2ul(ms (4 etoio tytomDeluvo t srxrxo3oydal nlnesat srumx  oo4alt mf3tasls2umu o;(0trxoio ia1la r i o;s) rurio ou4olenmncsls sDtmu onu0tlxniictatfs rl( o;t0aeermrcoatomteaiesl( srtoim iydomtn nvsl(f 2tax o;o0ope mo3taslm2el(vp ()aeenxo3io1omt au ols t2xo(m3iydlltn fvt () rtr(r ot4tpt mi3iydfa umnmo t0artnio iodopt  nvi s)t2tm(o3ou4lm e ict t sDrmu  ot0aeen fctltlm eauvp;(0aetniociodfm  ai o t  eumir3oy4optnlfvia(  Dta( ooo4tptoio3tatfs ulu on(0 lxnxf oadfmDelivslt t2to(m3ny4am nlnci ( sDuau pou1aex iieiasla2rauvon(0 rtrmrcio1opD  n sl(0seuoio ou4op emncsasf 2taur ou4tpenio3ilt m2umums;u0treomf iytfmt ln il()srxrio3no4ol elivt t  rtmx pnt4apxo oeiatfm2rl( s t4aexomo3ootopDeaueo;t)trurxm oo4lp n ivi t) rtrurpoo1opt mfciytla umu o;u0 eerxr tydfm e uvs;t) etm(r3iudllt  ieil() rrmump;t4aeeoiiciat m2el(vs;(0arxrxrctydomD  neilt)s2um(m3oodope  fcs ()s2tr(rp;t4alxnioeiltfaDeau p;u0arxnir iodfat an ol( srur(m3oydoptnlivsas)a2ta(m nu0olxo fctys m ulnvo;(4tlenxr oy1lpD  ieslt srum(m oy4lptemfcs t aDuru onu0tetoif3iat s umuvo;t4trtoxo3tytoaDeau i;t  etoxr3oo1omeelictl( s2ra( o;o0opxo octadfm2eaumon(0altrmr iadop rlu i;t0srur(m3io4omtemiesat a2raxmpno1tlt  i3iydfa emu snt)aeenxfcoatfpD  uvs;( seuoxmpiy1ome  fesl()sDurxrpou4tlx io3tasfa2rmumo ()aetoxr3oadfpt lneils)s2toxrpiudam  lncsl( artaurooo1tet moeiys a2ranmpnu4 eeomf3oydlp r ivols0 rtr(m oudlme  nvtat)aDurx poo1ole ioetytfs2rlnmonu) rxoxo3iytoa   u s;t sexr(m3iu4ome mivilt aDtmur ;u4tet  i3iydfa rmn s;u0arermo3tydfaD anesl( setoio3ny4optemnes sfa2tax  ;t4oexoiieild a2rmumpn(4aetrmrciodlptrli s s)t2toio iu1amtelivtltfs2rax o;u0aleniietytls2rlump (0 eeomf oo1om r ieo;s  euo(mpnu1ome lnvias) 2raumpou1olxnmoeiytfa uanmo;(0trxnir3oydfmte uvolt0srurimpiy4alte nctlsfaDumxmpoo0olx moeilt a2elnvs u0trtnxr iodopDr nvi;(0 etm(r ny1lpeelneia(fsrua(  nu4oltn fciadls rlumpn(4alxrmf iydfm   nvs t0 eto(rpno4ll e feiasfaDuau  ;o1texn ieildfsDrl( ont4treoxo iodfmt  ies t)texrxo oo1lpt lfetlt)arua(mpnt1opxomfciytfa emums t0aetrir3iytfm rlueo s)texo(o3io4lpte fvtlt) rta(mo;o1opt  o3tasfs2rlnvo;t0artrmf3iytlpteli o;t0t2xoxo3iu4olt  ieilt)aDuaxrpot4oex  ictasfaDran s;(0tlxrxf3iatfmDrlnvs;s)s2uoio iodamtelies t)srur( o;t4alxnii3iys m uluvp;u0trtnxo oatomteauvo t s2tmxm3iu4lmtn iei () 2tr(m ot4oleo f3iytfm2umumo;u)teerifcoo1fatelneo;t s2xoim3nu4lptnlivtat  2ra(rono0opto iciasfm uluvo u4 rtniocoa1op r u o;s0 euo(r io4lpt  ies tfaruau pno4alxomfeiltlm2emn on(0aexrmfctodom raueo t  etmxopnodamee iet (faDumum ;u0tle mf3ilslsDumums;u)treoio iodlp  lneo () rto(r3iy1lme lfes t)s2rrumpnt4tltomfeiat sDulnmo;(0 eenircty1oate ivo (0sexoimpny4aptnlnesa() 2tmurpnu0aexn icilslm2emu o;u0trtrir3ootfp eaueo;(0trxoxr oodom n fvi ( aDrrx  ;u0oexn feiydfaDrl(msnt0aetnmociytlatrau ols)srxriopio1aptn netat  2tru pnt4oee iieild mDea(vp (0arenxr ta1fp r uvols  rurio iu1lmt lnvtas sDtrurpot1optnmociadlsDua(vo (4teeomr3iydfmDeaneo t0 euoimpiy4ope livslt)aDtmxmo;o4ope mietytfs um(vpnt4tltrxf totlat liei (  2toio oodope licias) 2trx  ;o1aleomociasls2elu s;u4 ltoxr oy1opt lnes;(0teuoxmpnu1amtemfctls)sDrmxrono0oet  i3tad aDrln s;t0 etoifciodlat lu o () rurxrpoo1alen fcsl(  rraxmoou0oetn f3tatfs rauvpnt0artoxo3oa1fa   uvo;t s2to(o3iy1ll emictat)sDrau poo1tee if3iydlaDul( o;(4artnxr3tydomt  i ils s2umim iu1apt mfcslt s2rmxmp;t1aetomo3tadla umuvsn()aeerir oatoa   nvs;(0seuo(r iodop emneiatf rrrxmpou4texn i3tldfmDuaumont)aeeoio iydlp eaneo;s)s2tmio oo4amt  fcia()srraum nu4apen feiltls2rm( p (0aetrio3oa1oat ln i;s)trtr(mpoo4amtelfvt t)aDumu oou0oet mieias s rluvsn(4tetomr3iy1opte nvi;(  ruo(r3iy4lp elfeta(fa2tm(mpou0alxnioetyt sDemumo u0 lxnxocto1faDe n o t t2xmirpnydlmt lnesatfa2rr(m no0aex  oetyt m rm(vs;()arenio3oodopt an i t)seur(o3iydoptelnei s sDurx o;o1oexo iciatfsDranmo;t4areoxocoytlatr ivi t) 2xmio3ny1lmen ictltfarrrum nt0aptoiiciat s emuvo t4 leomr tadlpDeln s () 2tr(r3ny4omtnmnetat aDtrurpot0alxnmo3tysla2rm( snt4 leomo oytoa  li s (0t2ur(r3no1llen fet (fsrtmxm oo1tpxnmf3tlt s emums;(0 etoiociodopDrauvo;(  2ur(r oo4lpt mivs t)a2urxr ou0ape mociatlsDem(vs;u4 lerif3oy1lp   uvo;s trtm(r iy4am n fetl()aDtrumooo1tpe moeilsfsDuanvp (4 lenir totop  au ils)t2tmir3iydopte fvsl( arumxrpnu4olxnmo3tlt a2rlnvont)trtrmr totoa eluei t0s2umxmpiodlp e net (f Draxrpno0tpe  fciadla2umu pn(4tetrxfcoodlptr iei;t t2xoiopiudlmtelnctat) ruru  ;o1aeenmfeildfs rmu snu4texoirciotlmD lu s;( t2urxo io1opte nvs t) rtm(m ;o1aleoif3iyt s2rmnvp (0aexoifcoodopte nvo;s)truoxo3ny4lmenmivils aDtau  no4oex mociysfs2uauvo;t0artnxf oatop  lnei s teumio io1olenmfet tfsDurur oo4aeen fctltfm2rln s;u4arxomf to1la r uvsls0 2xm(mpoudomte fct (f Dta(m oo0oet iictat aDemu s;u)teenif3iatlaD livo t  2xr(r3oy4lp nmneslt  Dumur ot4tetoioeiat sDrmu p (4trenmociodop e nesl()seum(r3ou1ol nlfcilsf rua(  ot0aex ioeias s ul(vpn(4aeermf3ty1fp r i s;t  rxo(r ou4ll n fvtl( aDta(  ;t0apx iietlt sDeau snt)trtoxr oadlm   i il(0truoir3io4om   nesls aDtax pnt4alx mietlsfs2emn p u0altrmf3io1oa  liei;s trxr(m3iy4al  mfcslsfarrax  nt4apto iciytls rm( o (0aexnio to1lptrluvolt)texrxrpno1al   ieslsf 2rrur ;t1tle ii3iydfmDum(mo u0 rtomocto1lp eaivi ()trtr(mpiu1lp nlfvtat s2rrur no0altomoeiytlaDemuvo;()tltnxr tatlmDraivi;(0trtoio3nu1oltn nvsltf 2rrx  ;u0apeoioetad sDumn ont0alxrifcootfp eaues s0setoim3io1altn neta(f rua(rooo4alt if3iysfs2eln p;u4altomociy1opDe uvo s)truo(opiydlm e ncilt) Dtrxmp;o4opx iietltfm2umump u)tlerir ty1opDeaueolt)tetrirpnudopenlncta(fs2ururonu4aexoiicilsfsDul( on()tlenxrctytlpte nei;()srxrxo io1lmtelivilt  Duax  nt0apx mieils m2ulu p;u4tltnmr iydlpD  nes;(0 exmxrpny4amt  nvtatfsDtru  nu0altoifeiyd mDrauvon() etnifciotfpDe ivi;(0seurxmpio4lpe  nesa(fsrtax  no1opto icilsfs rauvs t4trenmf tatop eanvsls)s2toxr iu1lltnmfei ( aDua(m oo1ole iociat mDuau snt0alenxfciatfaDr nvilt0setmio iu1opt mncsas) rrm(r ;o1aex mociysla ul(vont)tlerif tadlaD  ieo;()s2umxr3oo4al   ietl(fsrrrx  nu4opxoifetatfa uau pnu)tltoir3tytopDr ieo;t)sexoim3nu1opt lnesl(f rrr(rpoo0tpxnmietldfa2ran on()tetrifcootoa eln i s)trum(m3oy1ole  fvt s  2um(m ot0apt mfciasfm2rlnvp;u4 rtnxrctytoaDr i slt0 ruoxmpoo4amee ivs s srrrxrp;t1aee  oetldfa rmumsnu) rtoxo3tydlptr n o;(0 eumxopoudamenmnvtat  2rrxm nu0tee ii3iytlm2ulnvp u4altnio tytlmtr u i;()teum(rpnu4amtelfcsa( sDrrur ;o1tle  fciydls ea( p (0tltoxocoy1fpteanvi t  2umxo iudop   ietls artr(rpnt0olx  ociasla2umn p u0texrxo oo1fpD au s t  2urxm3iydomtn fvia()a2urx p;t0tleomoeiatls ea(vp;u4alxrifcoa1fatelu o;s0 rtoir oydoptnmneslsfa2tax o;o4opxo i3iatla ul(ms;t4aleoircoo1op rlu s;t0srxmim3nodlptnlfes sfs2tmxmooo1aeeoio3iyd m ean o (0arxoxfctodomt lnei;t s2to(opou4lpenmfcia()s2rrxmpnt0aeenmfctyslsDuluvpnt)trtrxo3tatlm ranei;s0srur(rpoo4olt  nvs s aDtmu  ;u1alxn oetysla el(vp;t)altnmociatfa rln s t0 rum(o ny4omt lnvta(  rtaxr ou1tlx iietys s rmuvsn()trxoio3ootlmDrlu s t0sexm(rpnu1lm n feta()srtrxmonu4aexnii3iasfm2ra( pnu)artrifcoy1op   nvs (0t2tmxm3ou4lp   ivta()a2tm(r ;t0tet io3ilt sDua(mo;t4areoxfcta1oaDeluvs t0t2tr(r3nu4apeelies s) rururoot0alx mo3tlsfs2emuvpnt0tleomfcta1op  lnei;( s2xoxrpou1ale  nvtls)srrmxmp;u4olto fciadlsDua( s;t)aeenxrcia1laDe iei;s0 euo(opny1openlfvi t  2tmx  ;t4aexn feias sDemnvo;u0 exrifcoo1lpD ai o;s)seuo(r3io4ap   nvsl()sDtaur nt0opxoiieildfa umuvo;()teenmf3oydlp r iei ( s2trxr iy1op nlnvtls)a2ra(ro;o0olxn ociytla emn ont4alxoxrcoo1fa e uvils s2toxo nu1opeelfeta(fsDumxr ou1oet mf3ias s2elump ()alxoircty1fate u i s)texr(r3iudopt lict t s2ua( oou1ole  ociys s rln s ()arxomocty1lmDeli i;t0 euoxr nodlltemfctatfarrr(m ;o0alen ieiatfsDrlu p t) ltrxr3oa1fatr nvs;t0teumir nudap n iviasf 2rrx  oo4tptn oeiytfa umn pnu4 exnmr3io1la r uvs;t0t2umiopoydomtemivsl(fsDra(mono0tlto f3iaslsDua( onu)trenxf3todlp  luvs t)srtrimpiy1ope mieta() 2uaxrooo1tlenioetldlm rlu s;u)texrxr ta1oatelneo;s trxmirpiydop emict tfaDrr(mp;t0alen o3ias a2rmu o (0trerxr ootom eli s;s trtr(r3iydap  lfvil( s2taurp;o1aex moeiltlsDrmnvs;t0altnmo3ootop rai i (0 exoxm3oy1ol  lfei ( a2taum nu4texo i3iydfa ra( sn() etrxf oy1omt  u o;()s2tmirpoudapt mfesat)a2trxrpot4tltoifciysfm2rmnmo;u) ltomocoa1op raneo t0setm(r nu1ap n ivias)srta(moou0opeoifciat a el(vp;(4artnio3iydfpt livs;s0 2um(m oodap e ies ()a2rrx onu4oeen o3tysla ul( o;(0aexnir3ty1fm  lu ols)sruo(rpno4aptnmneiasfsrtm(  nt1oexn f3tyd aDumuvsnu)tlxrxr todlaDeai ils0 euoxr3iu4op e nvs s) 2tr(mpou4altomociltfa2uan s;u4aleomo oa1fatrlnvs t  2tr(r3no4om n ies s)sDtm(rono0aeenifetls m rl(msnu0 etoif3oytom eluvs s0srum(opou4lp  lfeiatfaDra(  ;o0tpenio3iadla2em( on()alxoio iadlmDrauei;(0tetm(opiudop n nvi ( srtr(mo;u0olxoioctlt mDrm(vpnt) exoiocta1omtelueo;() rxoxrpiodope mivia( srrm(mono1tlxoiietasla emn p;t0 eeomf iodoaD aiesls0 rtrxopou4llt  fesa(f rtaxm nt0tetomfciadlmDel( s t4 exnmr3tydfm e ieils)t2urir3oy1apt lnctl(fa2rmuroot4openifeiad sDrau o (4teeoir3todlatr uei t  2tm(o oodlp nliesl(  2urum ;t0oltnmociys a2rl( s u)tltrxr3oa1la r ues t)s2xmxmpoydlmtelicsatfaDrr(rono4oetoif3ilsls2rluvp;(0tetnxr tadoptr i s;t) etrxr oudapt mfesa(  2umur nu4tetoifeilslsDemumonu)aetnmo3tatomDranvi;()texrxmpno4op   fvi () rtru ono4oexn f3iydfa2emu s;(4 lerxociytomDrluvslt setrxm iy1lp nlnvtltfaruauro;u4tlx  o3tld mDuauvpn(0aexrxr oadlp ran o ()t2xoir3ou1lptemfcil()artrump;o0apxnmi3ias sDea(vo;u4trenmfcoadlmtr nvo;()s2xrirpiudapeelfeias  rrruronu1altoio3tlsfm rmnms;()aexnxo ia1fpte uvolt0seumim iy4ameemici sfsrtaxrp;u4alen o3iydfmDrm(vs t) lerir3iy1opDe u i s trtriopoydap n net () rtax poo0teeomfetys a ra( snt)altrmf oa1omDraueolt)srto(r ny1lmtn icilsfarrax p;t4aexoioctlsfs2rm( o u4arenmoctotfp ran i t)trto(m ny1lp elfci sfaDtau ont1alx  f3iys sDea(vs;u4artomr iotlpD  uvils0 rumim nudapt lfes t arrm( p;o4aet  o3ildla2ea(mo;()arerio3todlaDe n ils0 rxm(r3iu4lltemnvs s s2rau o;t1tptniociadfa2rm( ont4tlxoif oa1lmDeaivslt)srtr(r3io4alen ivs sf rrm(mo;t1alx ifeiytls2emnvpnu) rtnxociatom  ln olt)trtm(o ny1amt mneiatfaDua( ono0texomoeils s raumo;u)tetoxo3ootopDeaues;s)tetrxm3iydlpt  ies s s2umuro;t0alx mi3iaslm2umnms;t0tltrirciotlaDeaivo t0texmxmpiy1llt mfcslt)srta(mpno0altn oetysfm ul(vpnu0 renif oy1oateaivo;s) rumxrpiy1ap nmfeslt)aDrau  nu0apt mi3ildfsDumnmp;u0 renxr3tydfpDeli i (0teurxm iodamt micilt s2trx ono0oexoii3ils m2elu s;()arxnmf oatop   ueols  2uoim3ou4amtnlncs (  Drax  ou1oet mf3ildfsDra(vp u)texnir iotlaDeaivo;() exr(m3oodoptelfcsas)s2taxm ot4altomieildlm eauvo;t) lxrif3tadomtrlueo;t)teumxo3iy1amtelfet ()sDuax  ;o4oeenmfciadls2rlumon(0arerir iy1laDe nvs;s  2uo(m3oodapte fvilt)arraumoot1alxo f3iyd aDelump t) rxrxo3io1opD livi;s  etm(m3iudll n ics tf 2rmurpnt1oleoii3iad mDrlnvp u)aexrmo3oytlpDelu i;(0 rurimpiydll n ici s)s2umump;u1aexoii3iatfa um(vp;u0trtoif3tydop e u sls trtoimpoo4ame mfesl( sDtmu pnu0aetn iciysfaDuau o;()altrmr oadlpt aies s)trurxr io4ol nlfvt (f Dumumpot1apx  oeiys s2emumon()artnmf3ia1lptelu sl() 2um(r io1alte nvs tf ruaxrp;t4oet ioetydfmDua(mpn(4alxoxfcta1lmD  nvsl()s2xo(opiodlme  fei t arurx ooo1tet mf3tys s2ulnmp;u)teeomo3totopt lu o;t0texr(o3iodlmeemfcs t srurx  ;o0tltomictls s2ea( pn()texrxo oy1fp  lnvi t0 etm(m ou1omeemfesls  2urxr ot0olx mo3tlsfm rlu onu0tetoxo3tydfmte i i t0s2urxm iy1lpenlfcils)a2rmu p;u0aex  iciat m2emuvp;u0aexrmf3iadoatrlivi;()t2xriopoy4altn fetlt)sDrr(m ;o1altomo3ias aDumu sn() exnmrciydoatelueo;(0s2urirpny1apeemncsa(  2ta(m ;o0tpen o3iaslmDumnvo (0tetnir oy1oaDraues t  2xrxopoodomtnmfvi ()s2ua(rp;t0apx  oeiydlm ean o;t4 reoxr3oy1la   i o t s2urxopoydome  ivsl(  rtrxm ;o0apxnio3iydlaDemn s;u4 reoif tatfpDelnvslt)s2xmxm3nu4ol   ieiat) Dra(r no1alx  ietls s ulnvon(0teeoxfciydomDr u slt)t2tm(opny1omte ies s  rrr(rooo1texnio3tyt sDeauvs u0 rxrxr3iydoatr ivs;s)t2xm(rpoo4amtelfvt t)a2trxronu1oltn feiatfsDumuvs;u)alxoxrctotfmtran o;( sexrxmpou1olt  icsa(f rrrumpou1tlx ifeiytlm rm(msn(0texoxf iy1lm ranvo s0 euo(mpiudalee fesa( sruaur nt4oee mf3tldfa ul( o;t)trxnmr iodlpDr u s ()seur(opnu1lp  mnesat)aruru  nt4texo oetlsla el(mp t0tlxnmrcoatopt luvils s2xm(o3ny1omt mnvslt  rumx p;t1tlen f3ilsfsDulump;t4trxomoctotfp rlueslt) rumimpiy1apenmnctls)sDtm( onu4oet mo3tlsfs2um( snu4 rxrmo iadomt aieols  2urimpny1aleelfvias a2urxm ;o4tptoii3tatlmDem( pnt)tltnxr iotfmt liei (  rurxopio4ome lncsas s2urump;u0tpxnifcilt m2uaump;u)tltnio3iatoaDe nvs;s0trtoxm nodol emnvs t sDra( poo1olx mfciyt m2umnvs;()tlenir3iodomt aues (0 rtmxrpiy4alenliei t aDuaxr ;t4aptnmfeiysfmDeauvp;t0 etrircia1fmD lnei;s0t2tr(mpiy4al emnvt ()srrrxrpot1tpxnmfeiaslaDeau s u) leomfciytlmDr i ol( texm(o iydlpeemfctas)srrau ont0oleo f3ilt s eauvpn()tlenmf3ia1lptrlnvols  2xm(opoy1openlivilt  Dtaum ot0oex iieiyt s umnms t)aetrxo tadlmD an o t)s2to(rpiydlpeemncslt)srtrumooo4tlt io3ild s2elumpnt0tltnmocoytlpD  u o t0texoir no4apt  ieiat)s2um(rp;u4teeomiciadlm2emums;(4 leomo3ta1oaD  i ol( tetr(mpou4lmtelncs (fsrrr( pnt0opx mociydfm rmn pnu) exnio3io1omDelivo s0t2trxmpoy4am nlfetlt  Duax o;u1tlxnifciadlmDuln on(4tltrxf totlpt  uvolt0tetm(rpno4lp nliesatfs2rrurpnu4aleoif3iatfsDumn p u0teerir3iy1latelivol( texmim3no4al   ivta()sDtaxmpot0apx  octytfa2rmnvp t0 rermfcta1fmtrlnvs;t0 2toimpno1opt  fvsl(fsDuru oou4alenmf3tas mDeluvpn()aetoio3iotfmt  nvols0s2xr(opoy1om nlnct sf Dra(roou4apxoii3tatfm2ul(vo;u0 eeoiocoa1fate u s;( sruoxm3nudoltelfei s  rururpoo4aeto f3tltfs2rauvp;t4teenio oatomDelivo t) rxo(o io4opee fvtlsf 2um(mono4tltniictytls2uanmpnt)altrirctydla e nvs t tetmxmpnu1ome  ietl(fsDtr(rp;u0aetnmf3tldfaDel(mo u0trtrir3oodlmt lneo;(  2toirpou1lme livs (fsDtm( onu4aexo iciad m2uln o;u0tleomf iotfp elneo s  rxoxo3iudlmtnmiviltf Dtrxro;u0tltoioeildfmDum( o t0aeenmf oytlmtr i o;t0 etrir io1ap nmnet s srrmu pnt0aee  ieilsfm uaumo t0alxrif iytom eaues s)sruoio iy4ap  mfetas)a2ua(  nt4oex  fetytfaDea( snt4alxnmr3iadomD  uei;t0s2xmir io1amte nesas sDtaxrp;o0aet mieiat sDea( on()aetnir3iytfm elivs;t0setrxopnydopeelncsat)aDuru o;u1ole mieiaslm rm(mont)areoxo io1lpD  n s;s0texrxmpiu1lpeemnvs tfarum(m oo4tpeomocias aDemu o u4alenio iy1fmD lnvolt  rtoxo3iu1olenlfei tf Duaxm ;t1apx iieilsfs2rlumo;(4texoifciy1fm   ueo;t0 exoio3no1lltnmietl()sDtau  no4openmfctlslaDeluvs;t0aexoif iydfpte neo;t  rtm(rpou4al n fetat) 2rmumpnt4optniocilt aDeauvs t)tlxoio3tytfatr u ol()seur(m3io1aleelnvi s  Dtm(rp;u0apt  o3tysla2rlu p;u0tetoxo todfpDraies;s)sexmiopnudape mfctl(fsDtmx  ;t0tpe miciasfa rmump t0 lxnmr3todlm  au ols0 exr(m oodope  fctls) rtaxroou1tltoiietaslsDel( p t4 rerif3oodlpt aies;(0tetoxopoo1amt  iciat aDurxmpnu4apen ietasfa ulumonu)aeeomr3oydfm e n il(0 exmxr3ny1apee iesas)a2tr(mpot1apt  iciatls2rlnvs u4tetnmr3tadlmDr ieil( trxmio3oudopte nvt () 2tmu oot1apen ieiydfa emu pnu) rxrxf todfaD  ieol(0 rxoxm nu1aleemieils  Dta(m oo1oet ifeildfa em( o;u0aeeoxrctytoa  lieo t)s2toxmpiu4al e iesas s2rrxmpno4aleo oetls aDul(msnt4 reomo3tatlm  lneo s s2xrxo3io1amtn fctat)artrxm nt0oexoif3iydfs rmn p;u) eeomf iytfmDrlnvo s0 exr(o oydom nmivia(faDraxr ;t1alenmfetld sDemn snt) lxnifcio1oatraneil()sexrir3oy1llenmivtasf 2umurooo4tlxnmf3tysfsDel( pnt4trtnirctadlaDr ivil(0 rtrxrpou1om e fctl()srrmx ooo0tleo feiyt m2umn o u0tlenxo oo1lmt anvols  exmim ny4ap emfvt s s2ua(moou1olxn oeilslm eluvs u4tlxomf to1lmDe i s ( t2xriopnodap   fesatfsrrm(m ou0texo f3iysla eanmpnt4 reoxoctodlpDeli i;(0 rxo(m3nodalt lieilsfarur(  ou4tpxomf3iatla2eau pnt) rtoif3tytfmtelnvo t t2uoir3iy4ol  lfetls  Dtmum no1olxnmieiys a2ranvp;()aeerifctytoa e uvil() exr(rpnudamte nesltfarua(  ;u4oleo o3tydlm rau o u)trxoir3tadfm e uvo s0srtmio iy4om  mfetltf Duau pnu1ole iietysfa umuvo ()texoif iotlaDran i ()sexmxo oo1llee nvsl(fsDtm(  ;t4tltnmociytfa2ulu p;u0 rxrxo3iodfpDelu i;s)t2urxmpiodomenlieta()s2tru  nt0tetn fcildfaDul(vo;u4aeerxrcoadfmte u s;s s2umxo iy4oleemivtltf 2rmuront0aeeomfctytfaDulumonu0aetomfciadlpDrai s ( srxrxo iu1lp e ictlt aDrm( p;t1tptn octytla2rauvp u4treoxfcio1fpD  ies s0 2xmxr3iu1lme lfetas) 2umu pnt1olx moetasla ra( o;()tetnxf3iy1lm r neil(0texr(opio4op nlicsas arrmxm no1alxomietld a ran s;u4texnmfcia1lm  liei;(0tetmirpoudlltnmnvilt  Drrumpnt4tptomfeiadls emnvo;(4tlxoxo iatfp e iesl(0 rtrio3nudalenmncsat artr( ooo1oltn feiys m ran o t4teeoif3io1lmDr uvs;t0truoxo oo4altelnvs sfs2ua(mooo4opeoifciatfmDemuvp;t0trtnxo3tatlm  anvs s)trxr(m iu1opee ncs () Draxmo;t4aetnioeiatfs rmu s;t4 eerifciodop e ies;t  eumiopny1omtn ici t) 2um(r no0ole iieildls umnvo;(0arerxrciatfpDraueols)seurir io1ol elfct t)s2rauro;t1alenioctlsls2emumo;t0 ltrirciytfm  an slt)truoxm3ny4olte fci t  rtrxm ;o0oleoioetaslsDranmo;(4artomr3iytlptr nes s  eur(r3oy4apen neiat srumx ooo0tee mfetadlsDrmumo;t)alenir iy1fpDelieo;s srto(o3nu1llt mfcil()a2uaxroot4oexomfeiasfm ulnvs;(0trxomociy1opt  n o t0sexmxo nu4apt liciat)arururonu1oeto fciat s eanvo u)texoxf ia1lat auei;s t2trio3oy1lpenlfctl( s2taumo;u4tlxnifeiydlm2rmuvont4aetrmo3oytfatelivo ( s2to(rpiudopt lfctat) 2ur(moou0tpxniiciad s2el( pnt4tltrxo ta1opDeluvi;s)s2xr(r3ou4apt lfei (fa2um(root0apxnio3iydlmDrmu ont0texoxr oydfm rluei t0 2xoxo nu4ol elfesatfartmxr ou1apxnmf3tyt aDelnms u4tlxoxf3iatfptelneo;s0s2tm(m oo1lme mnvs s)arum( oou0oet moetldfm2ul(vp;t0trtnmf3oy1fmt aneo;s0s2xoxmpno4op nlivtl(  2ua(r ;u0apxomfeias a raump;t0teenirctodlpDraivils  etmxr3ny1omeemfeiat)srtmur nt1aetn ocilslm2ua( s u4tltoxr3oodopDr n ilt0t2toio3iy1alen nvi ()aDurxmpnt1tltn i3iltla ulnvonu) rerxr tadla  lieols0sexoxopny1lp e fci s artr(  nt0tle  feiadlaDumuvo;u0 eeoir3oa1la   nvs;s seurxr nudomtemneiatfsDra(  ot4aet  ociaslm2ul( o;u4aetoxf oa1la r uvs ()s2toxopiodomtn fctas  rtaurpot0olxomieiltfmDrmu ont)areomocootlatrlies s0seuoir ny4omtn ietatf Dtru  ;o1tetn f3tytfm2rmnms (0arxomr3tydlaDeluei;s)tetm(r3oy4ap  lnvtatfarua(m no0aee mfetad m em(vs;u0 exoxo3todoaDr ieil(0 exr(m oodap elicias  ruaxm nu0tlx mi3iys s2emumo u0 rtrxrciodlp raiei s) rtriopoo1aptnlivi ()sDtax pou0aeenifciltfmDra(vp;(4 etomrcootfaDe n o s) 2xo(r3oy1olee fvsasfaDtmxrooo0aetomo3tadlaDrmn o u)arxrio iodlm e iei;s0 exmxm3nudllt mfci t artr(mpnu4tpeomoeiltfs ul( s u0trxnif3to1latrli o;s)t2umxrpiy4ome livt sfaDur(rp;t1aptomo3iytlmDelump u0 lenir3io1oa r i o (0sexmxo3no1ol   ici s s2uau ono1aee iocilslaDel(vp;t0 rtoxf ootfp rlueo;(0s2xmim3iy4ol e fetlt aDua(mpoo4aleoif3iyslaDuauvo;t4 rxrifctodopt lu o t0 rxoxm iudlmtn ivtlt)a2rmxro;u0tle  ietadlaDelumo;(0 lxrio3oadfaD lneol(0 exmxr nydlmenmfcsltfsrumxmp;u0alto o3iadfm2ua(mo;u)aexoxociodlpteaieo;() 2urxopno4al emici ( s2tmxrpou1tpxnmfciysfa elumo;t0artnxfcty1oaD aivo;(0s2xoio3no1opte fetat aDtax poo0aptomfetatfs ean p;() ltnmr3ty1lmDrlnvslt s2xr(m ou1lmtemfeiltf 2rax oot1tex  o3tydfs ul(vo t)tetoxocoydomt auei;s) euoxo3no4opt lfeias) Drr(rpnu0apt  oetas aDemump;u)texoxr tydopt luvsl()srto(o iudolt  nesasfsDraxmpno0opx ifctlsfm2rl( p u4tltnmr3oy1opteli i (0s2urim ou4lp  lfcsas a2rm(rpnu1tltnmicilsla2emuvo;t4 rtrio ootlp r u i (  2tr(rpno4op  liei t)arrrx  nu0oeto oeiadfs rmu o;()texomo iotfate uvi t0srumirpnu4ope lnetlt  Drmu pnu4oetnmoctasla um(vs;u4tlxrxr3iodlpteli o;s0texrim3no1lmtn nvi ( arurxmp;u1oltnmfetyd mDul( pnt) rxrxr3tadlm   n o;t seurio nu4lp emieiasfartrxr no1tetoioeildfa2umu p;t0tlxrif ia1fpDr nes;( seuoxr3iydlpt  ivs s)sDrru p;o4aee mfctyt s2uln p;t0aetomf tatomt an ol(  rxmxo3iy1omen fcslsfs2ra(ro;u0tlen fctasls umums;u4 etnifciadoaD lu s;()s2toxrpiu4olte icsat srtaurpnu4alxomieiysls2emn s (0alenmocio1oa e nesls s2tmxmpnu4omee nvia(fs2umxro;t0tpxn f3tlsfmDem( on() rxoio oydfp eauvils0 rxmir3io4om  lictas arum(  nt0tpx  o3ild a uau sn(4trenxrctodomtranvi ( setmir nydaptelivt t s2rm(ronu4oetnii3iat s uaumont4 rtoxr tydlp  livi s tetr(r iydapenmnes () Drrxr nu4oltomoeildfaDrm(mp (4aeenmf3oodlpDr ies;s  2xoim3oudlmte fesasfsDumu o;t0aexo icilt s uan p;t0aetnmr3oo1fmt aneo s)t2tr(o3oo4optemivil( sDtr( pot1aee micilslaDrlnmo;(0altoxoctodla r i s;t)t2xr(o iy4amt mfetls  rrrump;t1openmieiad s ulnmo;t0 etoif3oodlaDe ieol( srurir3iydlpeelncs tf Dtrxmp;u0aee ifciydla2umu pn(4 eeoxr io1oaDrlneol()trxm(r iy1olen fvs tf rtm(r ou0ole mociatfs2umn p;u0tltrir3todomtrau i;s0trto(rpiy1ameemfvsls arrm(moou1aeeo f3iyt a2ran pnu4texrxf3oy1laD anes;t0s2uoim oydamtn nvtltfs2tmump;t1tptomfciytfa2rlnmpnt)arxrxo ta1oaDelnei ()tetoim3iy4oltelivtls aDuau  ;u0oleoifeiad mDelnmpnu0arerxo ia1faDrauvs;s) 2uo(r3oy4alt mneslt)aruau pno1tptoiieils m2eau o (4trxnmo totom elueo s0teumxr ny4alenmfciatfaDur( ono0ope mieiydls eau snu0 reoxo oa1lpDrau o (0srxmio3oy1ol   iet t) 2rmurp;t1apenmoctad s um(ms (4tltrio3oydopD  ueo t  rurxr ny1ap  lfvt ()sDrr(mp;t4tet mf3iyslaDrmnvp;u4 eerircoodfat au sl() 2xr(m3nu4oleemics sf rta(mo;t4apeomocild a ranmon(4tlxnxr todlp elneilt srtoxm ou4olenlnvsa(f Dua(rpnu0apt ifetytfsDelu o;t0tltoio3tydoa eaivsl(0sruoxmpny1olt  feias a2rmx  nu0ope mfetytfaDemnmp ()arermrcta1fmtelneilt truoxrpoy1apeelfvi (  2uaurpnt0aetnmieiatfs2em(vo;u)alxoxr oy1fa rlueo;(  2tm(o oy4lptelnvslsfarrmx o;u4oexn f3tytfs2em( s () rtnxo3iy1oa   uvs;(0 ruo(m3iydalt  fctl( s2tr( ooo0oeenifetatlaDrmuvp;(4alxoio tadfpte nvslt teur(m oudol e ivil(faDrmuront1apt iocildfa rau o;u0alermocoy1fm  lieo;(  etmimpnu1ol   icilt arra( ont4aptn f3tldlm umn snu)arxrio3iytoa raivols0texrirpou1lpeemiet (fs2uru o;t4aex  f3ild m rl( s;u) eerio ty1faDeli i;() 2uo(m3iydlpenlicsls)a2ur(  ot0teeo f3ildfmDrlnvp u)alenmrcoo1lmDraneolt)sexoio3ny1alte nvt tfa2tm(  oo0oex ifeiasfa ulnvonu)tetomr3todfa   iei;s  rxm(r3nydlmtnmneias a2ur( p;o0apen ieiadfa ra( o (0altnircty1omteluvi s texoxm3oudaltemfctl() rtruronu1tle mf3tys sDulnvp u4alerxo3tadomtr u i;s srtr(rpio1lm elivias sDtrumpoo4tpxnmo3iys a eln pn(4trenio3tydfa rluvilt  rxriopiu4lm  mfvi s)s2um(m no4tlt mfctasfsDra(mp;t4aleoif3iotlm rau sl(  ruoxm3oydom nmnviat)srurumo;u1alx  fctatlsDumu pn(0teeoxr ia1oateanvi;t)s2uo(r3nu1llt mivtas  rtaumpnu4tet mo3iltfmDea(monu4 renir3oodfmDr uvs;( s2umim nodopeemnvtasf rumur nt0ape ifciat aDrlu pnu4 eeniocoytoa r uvs;(  ruoiopoo1lpteliciltfa2ta(rpnu4ape  i3ildls2el(vp t)teermfcty1faDe uvs s0 rtmxm3nu4ape  fvils)artm(root4oltnmfcias s2emn s t0 lxrmrciodopDe ivi t t2toim no4altelnvs t  rum(ro;t4texn feiysla elu o u)tltomoctatfmte neslt0srxr(o3iu1ll elivilt a2ra(mp;t4tlx iietltfm um(vsn()tetnmr iatomtrlu i s  ruo(m iu4lm elicsl()sDtmx  ot0tlt mo3iad mDuau p u4treoxfciydlm rlies;( truo(m3oudlme  iciat aDtruro;t4tet ioetlt m2elu o;u0 rerxociy1opt  ues;t sexoiopoy4al emicsltf 2ra(rpoo1tetoifeiasfsDeau p;u0 exrioctytomtr ivi t) rurirpoydol  livsl(f rumx oou1tlx  f3iadlm2umuvo t)teeoxo3tydomDraivo;(  eur(o nudoleelnvil()a2tm( p;u4apx mi3ildlm em(mo (4aexrxrcoo1optrlneo;(0teuoio3iy1apte fvsatfarum(r nt0tptn feils m rln s t)artoif tatomteluei t0 exr(o3nudaptemnvi s) Dtau poo0tet mf3iytfsDem( snu0arxoxo oadfpD ai o ()s2xo(rpou1amtnlicils)a2trum ou1oet io3iysfaDumnvo;u0trtnio3ia1lmD an slt  etoxr no1am n iet t aDrmumpou4tee mi3tytlaDrlumpnt)tlxoxo oo1fat ln s;()trxrxrpnydlm nlnvsas) Dtm(ro;o0tpe ii3tlsfsDuanms;u0 rxrxo3tatfp   u o t s2toxo ou4ol nmfesasfa2rmxrpoo0tleo iciad a emnvs;t0tlerir3oa1la rln s;t)s2xrir ny1lmeemfcsa()a2raxmono1ale  i3iys mDrmumo (4tlermf oydop  auei;t trxrim3io4oltnliciasfs2ua(m oo0openmiciatlmDuln o u4 rxnmfciy1fpD au i;t srtoxr oudoltnmnctls srur(rpou4tptomieiltfm2umnmo u0 rxnmf iadlp eanvi s0t2to(r oudll  lfcta() rumxrpno1apt ii3tyt m rl( p;t0altnmr tydlp raneo;s t2xr(m3oy1amtnlfvsas)srtmurpoo0tltomictad s emnms;u0 reomf3ta1fa e ueo;t) etrxm3no4ap  lnvsat sDrmuroou1tlxnif3iytfs rmu o t0teeoio3oydfpt aieilt)t2tmxrpiodol   nvs tfa2uru pot4tptn i3iyslm2umn o;u0aexnmo3iydfmteaivil() exr(mpny1am emfctlt)a2tmxrp;u0oleoii3iyt aDuauvs (4 rxnxo3oodlm eanesls  ruoiopny4lm  livsl()srrr( ono1tpxo fciat s emnvo;t0trxoir3io1opte u i (0truo(o ny4lp e ivias aDuaur ot4openmoetys a2emnmo;() etoxo3tadlm  anes (0sexrio3oo1llenmnei tfs2tr(rpot4teenmf3ildfm2rmu s ()tlerif oatlate uvs;t  2xmim3nu1alt lfet tfsrumurpot4tleomfeiasla2ra( s t0altrxr ootfmDrlnvol()sruoim iodlptnlfct sfsruaxmooo4tpt ioctasfm2rm(mo;u0 rtnir3iotopD  i i;( truoxm iudoltelivsl() rtmxmp;t4tex moetytls2eaump;(4aeermo3ootlm  ai o;t)srtmxr no1lmte fvi t)srurxr nt1ape mi3ias aDum( s u0 etomo io1oaDelneols)teto(m3iu1amt mfesls)srtaxm ;u0apeoioctadfm2rauvp;()trxoxf oodfa  anvilt  etr(opnu4lpeemicilsfaDurx  ot4tpto fetls mDem(vp u) rermfctydfmt lu i;(0srtrim no1ll  mnet (fs2tru o;t1aee  fciydla2em(msn(4artoxfcoodop   ivi (0tetoio iodlmt  icsls)a2ta( p;u0tpt mf3tlsfa rl( pnu0aetrmf oytlp   iei t)texr(o no1omeelivi t)aDrmu  nu1apen fctatfa emnmo;t4 ltnmo3tadomDr ueils)s2uoio no1lle mfetlt aDrrx  ;u1tpeniociyslm2rlnms t0artrmf3ootopt ai o s0 rxr(mpoy4apt lnetls)sDtmumpno0olt if3ils m umuvpn(4aetnio ta1laDeaivol()setm(r3oy4omtn nci s srrmxm oo1oeeo ocils s2uanmp u0 ltoxociodlp e uei;(0 rum(o3nodom nlicsl(fa2trum ;o1olxnio3tls m el( o;t) ltnir3oa1oaDr neolt0 rumxr3oy4lmeelfvil()a2rmx pnu1oltoiietatla2el(msnt4aeerif iytlpDrluvi;t)s2tm(m3iy1lmeemnvi t a2uax onu4aptnifeiydls2rmu o;(0altnxrcoo1lptrln ol( trtm(o oo4ale mnvils srrm(mo;t4apxnii3iydlm ua( p;u4texoio3iadlmD  i ilt) rxo(mpnu4amen ieil( sDtau oot1apenmfetatls uanmo;t)aetoxfcoytlate nei t) rtm(opoy4aleelivsat sDta(mo;u4tpt  oeiltlsDea(mont0 ltrxf ia1laDeau o;( tetrxm3no4al nmict sfsrtaxmpnu0ope  o3iadla2eauvont)artoio oytopD  nvs t0t2xr(m3oy4ap elieil()sDrr(  ;o4apeniiciydlmDra(mp (0trxnmo oodfpt lneslt  2umxopnu4llt mnvs (  rrrumo;t0teeo ieild m umuvpnt4tlermo iadfmtrlnei;(0teuriopiu4ome  nvtlsf rtrxm ;t4alt iocildla ean s;t)teeoifciodfmD aiei;( trtoxmpnodllt lncs t)a2taurpoo1ope  ocias m ul(ms ()aeeoxrciadlaDe ies ()trto(r3iudapee ivil()a2rrx oot0ale mi3iyslmDul( pnt4 eerio3iodop e nes;t0 2trxm iydop  mivias)a2umxronu1aetnmoctlsfsDulu o t) renxo3oodlpD ln i;s srtoxr oydom  mivs t s2rrumpou0tpx  feilslm2ranvs;t0 rermf iotoa r ieo ( trxmxr3iu4lptn fvta(farumumpno1olx mi3iad a2rluvs t4arxrxf io1lpDr uvsl( trxrio no1lp  mfvt s sDrr(mono1optoifciydfmDumn ont0alxnio oytfmt lnes ( trumim3iy4amt mnvsat artr(  nt0olxoiietatfmDumump;t0tltrirctotlm  anvsls trxr(r3iu4om n nvsa(fsDtr( pno0tlx ioctls mDra(mpnt4 rtoifcoytfmt  i i (0t2xoimpiu1lptemnct tf rur(r ou1tpx ii3tltla emu o;t)tltrir tadopDrlu slt0trum(r3ou4omtelneias a2rr(roou1aex mo3iyt sDum(mp t) etrxf iadomD  u sls)teurir3iudllte icsa(  rrmxr nt4oexoifeias s uln s;u0 etnif3oa1fpD  ieo () etmio nudlleelieiat aDta(m ;o1aex moeiyd mDulums (0aexomo3oodlat aues s srxm(o3nodlm  miesl(f rurxm ou4tpt mictytlm rmu p u4teerioctotlpD lu s s0srtmir oodalt  ieils) rraxm no1optnmociysfs rau o t0altomr3oadop   nvs;t0trtmim ny1al  mfeia(  Dtrx onu1tlxn oeiasfa2uaums t4altnmrcoatoa  lneo;(0trxmxmpiy1amee nvt s  Durum nt1oltnifeilt m rmuvs;u)aleomr3oy1oaDeanesl(0texrxr nu4lltemnvi (  2urxm no4tptniociltfm2umumsnu4alxnmf iytopD  nvs;s)tetrim oodomen fci ( srurx  ;o1tleoifctldlmDum(vs;t0 etoirctydfm eauvi t setm(mpnudop nmnvt t aDurxmo;t0olenio3iadfs rmnvs;u0 ltnio to1opDe u i t) euoimpnudlmtnmfct tfa2trx ooo0oexomiciydfm2ea(mo;u) rxnxo totfatrauvil(0srxmir iu1optemnesa()s2urx oou4oltoifctasls ul(mpnt0trxrir oytlp  auvslt s2xr(r iu1amen fcslt)aDtmumono0olt miciydfsDulnvp;t4 rtomf3oadomt  uvs () rxmxr no1am  lici (fa2tmxmpnu1alxn o3tls sDua(vo;u4alxrio3oo1opDr nvsl(0 2toxrpoy4ale  iviat)s2umurpno4alt  i3iyt a uauvp t0alerir ootoaD liesls)trum(m nu4llenmivs (  2urxmpoo4aetnmo3ildls elu sn(4texnxr3oatfp  lieo;(0 exriopoudlleemicia( arrax  ou1tltniictaslm2ulnms u) exnxo to1fpteaiei;t  etmio3io1omt miesl(fsrrrxro;t0opxnmoetat mDul(msn()alxoxo ty1fpDrlneil( t2tmxo no1lmen nvi s) rurumpou0apxnmfciasfm eanvp u0tltnxfcoa1faDelies;()t2tmio oo4apt  netl() Drmxm ou0opxoiociasla2em(vo t4alxrir3ty1lpDrluvi (  2umxmpoudlltnmfcs (fsDuaumoou1tpxoio3tytls2uau s t0 rermr3todfa rlnvil(  2xmimpou1omtnmivilt sDrm(mpou1oex mociydlm eanvp;u)aleomo3oodlmtraiei;(0t2xm(mpou1ap e ieta() Duax pno4opx ifeilslm elu ont4trxrioctodlptr ivolt)srurio ou1llenmfesa(f 2taxmonu1tltn oetadfm2rln s (4aexrmr3iatlmDeau ilt seumxopoodllte fcs s arumuro;o0tlt mfetytfsDelnmo t0arxrxf3ta1opDe uvi;s)seumim oo1alenmfesls  Drm(rooo0apen o3ildfsDemn s ()aetomo io1la eai sl()sexo(m3oy4amee net sfsrua(mooo0tpxoii3ils m ul(mp u)treomo3ty1lmtrlivs;t0texrxo3oudap emivi t  rrrumo;t4altn ociytfmDuaump;u0arxrio3iytomD aies;( t2um(r io1lmtemnvsls) Dua( ooo4apx mf3ild s rauvsn(4arxomrcoytoaDr neslt0t2xo(o3ou4am nmneta() rraxm no4apt mociydfm2ua(mp;t0tetoio tadfmteaneolt texoir3iy1ale lfes s a2ur(  ;u4ope  ietysls2rln p u)arxoirciydfa elnvs t0t2xo(o3iu1lltemivtat  2uaxr ;o1oexnifctadls rl(vo u4 lxnirctytlp raivol(  exoiopiodope lfvsas) rrau  ;t4apen ieiltlm2ean on(0tetnxo tadoateli i (0s2trxo iydlmee fcsa(fa2trumpnt0oexnifetat s uauvo;() ltrif oadfaDeanvil( t2urxmpiudlm   nvtat)sDrmx  ot1tex ifetlt m2uln s;t)tlerio totom e u i ()trxo(opoodoleelicslt sDrrxm ot0opt moeildla emnmont) lxrmf to1lm  ai ilt0trxrxm3iy4amtemfeilsfarrrxrpot4aexo iciat a ul(vp;u) renxociotfate n s;s)t2tmxr io4oleemfesat) rua(rpou0ape mfcilslaDum( pn()trxnmf3oodfaDr uvsls0s2trxr iydolt lfvtls)sDraxrp;o0tpeomf3iasfsDuau o;(0arxnxr oo1fa  lu il(  rtmim iu4alen fvi t)aDtr(rpou1alxomociyt mDrlu pnt0arxnifcto1faDeluvi;s)seur(m3iy4al  miciasfa2urum ot1ole iiciatla2eanmo (0aetoxo3iytlatr uvo (0t2triopno4apen nvia() 2rau  ;u0oex  f3tlt s eluvo;t)tltomocto1opDrliei;( setm(mpiu4opt lfvtl()s2ra( pou4olxoifctldfa rl( on()altrxr oa1fm  luei;( srur(rpoudop   iesl(  Dumurpot1tlto o3iltfa uaumo;t)trtoif3iytop eluvil(0setrxo3io4ap  livta(fsDrmx  nu0aeen i3iysfmDrmnms;(4altomrciotlp r n i t) rxmxm3nudlptelicils)s2trx oou0optomietatfa2ul(mo;(0 exnio totfpt  nvs s0 2umio ou1aptemivtlt a2umx  ;u0aexniieils m2umums t)trtrmr3oa1laDeluvi t)trtrir3iydame mncs t sDta( o;t1opt ii3tldfm2ran s;t0 ltrif tydfa eai o;(0seumim oo4lle mfvs ( srraxro;t1olen oeiyt a2uan o t4trerifcoydfmDe nvo;(  2tmxm3oy4aptelivt ( aDtrxrpnt4tee iiciatla ra( p;(4arxoirciotlp e nes t) rxo(o3iu4olt  net ( srrrx pnt4oetoiiciltfs2ranvp;u4arerxf3iadom   neilt srxr(o iu4optn netl(f rrm(r ;t0aee  fctydfa eanvo;(0alenmf iy1oat  nvi ( srtm(opio4am emncsl(fsDta( p;o4oeenioctltlaDem(mo;(4tltrmr3oy1oateau s;t)s2umiopiydamenlnvtls  Dumx  ;u4tet mi3iasls ul( p;t0artnxoctydlpDeanes t)srumxm oo4ole  iviltfsDuau  ;o4texnmociytfs2ul( o t4 lxrmo iotlpDeau o ( srxoxm oodap emfcsl()arrm(mp;u1tptnmf3ildlmDua(von(4texnif3oa1la eln i t texrim3iu1alt mietasf Drrumo;t4apxomicilt a2umn p () lermr3oatfp ranvi t0s2to(m oudom  mnct t arrrxrpnu0tex iocilsfm uluvp u)alxnmf ia1optelueilt) rxmimpoy4om  mfvsa(fa2tmxr nu1aee mi3tlsfm2elnvs;t)texnio3iatlpte nes t)sexriopoydlpt  neia() Drauro;o0tpen o3ils m rln pnt) leniocoa1fpDeluvi;t0 2xmxo3iudlpt lictl( srtaxr nu1tle  ietlslaDem( p t4 rxoxf3oodoaDrauesl(0 etr(r3io4lmee neta(fartrumpou0optniiciadfsDul(vs (4tetnmrcto1fp e u i s) 2tm(opio1op  miviat)arur( oou1tlenmietytfm2uanvs;t0aeermo iodlpD  uei (0t2xr(m3oo1amenmnctlt aDumx o;o0oexoifeild sDumnvo;u0trxrmo3todfm rliei;(0 2xmimpnudame lnvtasf rtaxm nu0tleomfctydla uluvo;(4arxoxo3iytomtelneo (0srurxm3ny4olee iviasf 2rmxmpoo0tleoif3iat sDem(vp u0arenxf oo1la e iei;t) etm(m oo4amen ietl(  2trxmpnu1tpe mo3iasfs2um(mo u)teerxfciodom   iei s0s2xrim3nu4omtn nctat) 2uaum nt4opxnmo3tldfaDea( sn(0tetnio3iotlpDrlueo;(0seuo(rpno4lmt lnvi t)sDtax pou1oet mociasfm2um( s;(0 lxrmfcootop r iei () rtr(r3iudlpte iviatfa2rmu poo0openmi3iyslsDumnvsnt0arxrifcoatoa e uvilt  2tr(mpoudapenlivi sf ruaxm no1teeomicildlaDemuvo;u0trxnmo io1la rauvi s0t2xmim3iydamtnlivsltf rraxr no1tet iocildfm2um( pnt) renir iotlateaieo;s) etmir3iy4lp nmiei t) Durum ;o0ale  i3iltlm2em(vs u0 lxrmo oo1fm ran s t0 2trio3ou4om  mnci tfsrumxrono0tpx  oeiadfm2elnvo;t0 rxrmr3tytfaDelivs t  2um(r3iu1omen nvt t s2raxr ;u4tpenmoctldfa2rluvpnu) lxrxo3ia1fmtr n s;t) 2trxr3iu4al elfetas)s2ra(ront0tee iieildlm2rmnmp;(4 rxrxrciytoat auesl( t2toir iy4llt lncia()a2tr(r ot0aeen fciysfm ran ont4trenxrcoo1fmD  nvi;()t2xrxo3ou4ope mivsls  rrr( pno4oet ifetlsla emu snu) ltrxfcto1fpt  ieil( t2trim oy1omtelieias s2tmxm ou1teeoiieias a2rau s;u)tlerxf tadfpD li i;t seurim3oo4ll n nvi (f rtmxmpoo1apxnmoeiys a emuvo ()teerxocoa1lptran ilt  euoio oo1al e ivtl(f 2uaxm ot0ale ioetadfa2uanvon(0alxrirctytlpDelu i t0teurxo3oo1lpt mivtltfa2ur(  ot1altnmociyslsDran p u0tlxrxr oo1oa r n slt srxm(m iydlmenlfet ( sDra( p;u4tetomfctytfm2ulnmp;(4 ltrmocoo1lpDrlivs s srur(o iu1lpe lneil(fsrta(roou0tleniietytfmDemuvo (4alxrxf3oo1opDranvo t s2xr(o no4apt  nvsas  Dra(ro;u4tlxoifciyd s eaumo () exrmr3ia1lateai o;s) eurxopiu4lm nmfct s)s2taur ;u0tpenio3iys m rmu p;u4texrmr to1lm  lu s;(0trtr(r no1llt lfes sf ruax  ;o0tpt if3iad m umn o ()tltoio iotfm  lu i;s0trur(o3oydlptnlies t aDtm(  ou4tlt mietltfs um( p;u0alermo3oy1oa  luvi;()sexrxr3oodopt lnvi (  rra(r ;t0olen iciyt s2rmnvpn(0trxrir ta1opt lnes ( trumxr oodapee ietls) Dururooo4olenii3tlslsDemu p;u4aexnxocootoa elneo;t)s2xmxrpiodlp n feta(faDtmum ;o1olxo fciatfa2em(mp u4aetnio todoaDr n i;(  2tmimpiydop nlfcsa(fs2ur(m no0optoiicias a emn pnu4 exnxr3ia1lp e n i;s setmirpiy1ll n ieiasfs2ta( ont1oltnmociad aDra( p;(0alxnxf oodfmt livi () exmir nu4lp e iet t)sDtm(rp;u4olx mfciyslsDelnms t0trermr ty1lm eanvs t) 2to(r ou4lp   ictls  Dua( ono0tpenif3tyd s umnmp;u0aleomo3tytomt  nvsls s2xm(r ny1openlict tfa2uaum ot0alx miciatfm ulnvo ()aexomf iodom rln i;t) etrir oo1lmeemnvsatfa2trurpoo0teenmictatlsDuln o;u0 lxnxo oydfmt  uei;t0 2um(rpno4amte nvsl(f 2ua( p;t1apto iciysfa ua(von() rxnxo tatfatelnvsls0s2tmir oydop  mivs s) 2rmu  ou4apx  f3iydfa2uanvs;u) etoif ta1omtr i s;s)t2tmirpiu1amt  feiltfarraurpnu4tpeo octat a rm(von(0tlerxf3oodlm e ivo s)t2uo(rpoodlpeelncil() rtr(rp;o4opxoiieiydlm umuvo (4teerxr3ta1opt aivslt)trurirpio1ap e fvt (fa2rr(m nu1ope iociltls2em(mo;(4trtnmfcoo1latelu s t0 rurxrpiudlp emfvilsfs2rmu  oo4oltn f3tad mDemn o t0arxoir3tadfmt anei t trum(o3nudllt  fvt t) Duax  nt4altomo3ilt sDul(vo ()texrxf iydoa  auvslt0setm(r nu4ome  ivsls sDtmx  ot1teenmfctadfm2umnvpnu)teerxrcootfmDrlnvolt0t2xrir3ou1lme lfvsa(faruax p;u4oexo f3iadfs rlu snu0teeoxo oa1laDeauvi;s0 2uoxm3nu1al e iet t srraxmont0olx  ictydlsDum( pnt4aetnmo3ootlatraies;(0 rtoxr ny4omee nvs ()aDumurpot4aeeo feiadfm rmuvo;u0 etrmo3ootomt an olt0s2trxm3no4lmenmfet t  2trxr ;t1ape  ociatlsDean snt)texnxf3iodop rlieolt0trxr(mpnu4amtnmivsat s2umxmo;o4oet  i3tytlaDul(vo ()texrxo totoa  lieolt)sexrir oy4lptn fcias)s2rmxm ;o0altoiieiydfm2ulums;(4areoxfciatfpDeaivo;s) rxoiopoo4apee fcs t a2rauront0alxomietytla rmnvpnt)treoio iotomtraies t)srurxm3nydom nlnvtat s2raxrpot0aexo fetatfs2umn s;(0trenmocoodlaDrai i;s s2xr(mpoy4alt lfetas)artmxmp;o1apxnmi3tytfm2rauvonu0teenxr oo1opt livo;t t2tm(mpiodll emictltf 2raur no1opt mietyt m uauvo;(0 lxnifcoadoa   i o s0srurio oudlmenmietls  Drr( p;u0aleniieias a elumo;t4alenmrcoy1opDrlivsls setoim oo4oleemictlsfs2rm(mont1texomfeiysla um(vo;(0tleoir3to1oatr ivo;() euoiopou4lmtn ictl(f rumxmpnu4tlxnifetaslaDemn pnt)tltomrctotlaD ai i s srur(o3io4apee fvtl(f rurxronu4aetoioetytls2ul(vo;t0 ltrio3tydomt  ivo;t0 rxoxo3oydlmtemfesltfsrumx  oo0tpxnmfeiasfa2ul( p u0alenmocoytfptrai slt)trxo(r3no4ome lietl(fsDum(rp;o4aeto i3iys mDrlnvp u0texoxr3oa1lmteaivi t0sexo(m no1olte nvs t a2umu poo4altnifeiltlm2umnvs (4trxoxrcty1om elivo;t  2xoxo3ny4apt  ncs t  2rmxr oo4tetniociys s eluvp u)treoir3oadoa e nvi (0setoxo oydlpt mivt (f rtrumoot1tptomfeiad s emnmsn()alxomociydlat  i i t0s2xrir iodalenlfetat  2urxmpnt1tlxnmi3tat mDea( on(4tlxoif iatfp  ln o;() 2toxm3nu1ale  neil()srtax  nu0aetoifetltfa rmnvs (0aetnxfciotlatrlivslt trtr(mpoo4lpenlieia(fsrtm(rpoo0aetniieildls ulnms;t)aeeoif io1lp  au i t0seuo(m3nu1ame  fviat  rtax ont1tpxnio3iad a rm(vs u4alerxo ootfp   ueslt0 rurxr oo1amee ivia()s2umxmpoo0aet mi3iatlm2eanmp;u)aetoxr3tatfa eai i;t)sexrimpny4ole  nvil()aDtmxront4oetn fetytfm rlumonu4artoio oo1opD lu i t0 etr(rpno4llen ivtlt  rumump;o0alxnifeilt s em(mpnt4trxoircoydfmte i ils t2ur(o iu1oleemictl(f Durx pnu0opxn ieiltfm el(vs t4tlxoir oytom raivs t0seuoxopny4altnmnctat)srtax  nu4tet moctatfm emnmo t0 rerif oodoaDraieo;(0s2tr(rpno1llt  ivia(  rra(  ot4opx  ociyd m eanvp;u4artnmocio1oaD lnvols0t2xm(m3io1ape  fct tf rta(monu1teeniieiadls2ra( snt0 lenxr3todfpt  nei (0setrio oo4opeelics t  2tr(mpno0optoio3tld a2rauvo;u)trtomr3iydlp  lu o;t0t2tm(rpnudape miciasfarumx  nu4aetnifeiad m rl(mo u)tetrmo3oa1lm raivols)tetoim3oo1ll nmneslt aDtaxm ;u4tlx  fciatfsDemnms (0 eenmf tytlp eln o (0setoxmpiudalt  ivia() rumurp;o0tlxomfetltlmDrlnvs;()aexnifcoydlm elieo;(0truoir3iy4al nmnctls)sDrr(r oo1aex iieiasfa umumo (0 rerio3iy1opDrlnesl(  rtrxo3iy4al elicsa(  Dtmxm ot0oet  icias mDumnvs;(0trxomr3iytoatelu ol(0 rxrxo no1lmtn fciatfa2rau onu4texo f3tatfm uanvpnu4tlxrmf3iadlptr nei;s tetmxm oo1lptelneias sDtau  no1olxn feild m2ran on() reoxo oadfaD luei;s) ruoir3oodape mivsl(faDra( ono1apeo octydfm elums;u4aetnir tadopDrlivs;s trxoxr iydllt mfeta(  rururpot1aee miciatfa ua(ms;(0aleoxo3iy1oa e u o s  euoxr nu4ll  mfcils)sDrr( pnt4tet mi3iltfa rmu ont0 rxoxfcoatlat  ues;s s2xoxr3iu4omt mfesat)sDur(rpoo1apeniiciasfmDemuvonu) leoir oo1lptrluvi;()sexo(opny4al elnet tf 2ururooo0altnif3tlsfs ea(ms t)tetnifcia1latr u o;t seurxrpnodom nlfeilt aruaumono0oltnmfcilsfsDeanmpn(4trenxoctadfpteaues t0 exmxr nydalt livta(  Dur(rpot0texnii3ias s2el( o;u4trtnxr io1fa ran s (  eurxm3no4am  micsltf Drmx oou1olxnifciaslm emu o u0altnircty1fate i i;( srum(r iu4omtnmivils sDrrxmp;o4alxnifetldlmDrlnvs;(4aexomo iytop rlnvsls0tetr(opiy4om  mieil(fa2ua(rpoo1tlxn feilsfsDemnvs t4teenmr ootlmD auvo t)sexr(r3io1lp  mivsat) 2ta(r oo1tee  oeilt a2raumo;t) exoxf tadomD li ols srtoxopiydap nmnvia(fsrrrur ;t0tlenmo3iydls2umn s u0trtomocia1omDrauei t) 2toxmpoodapeemivsls)s2tmum no0olt  ocilsfs2um( snt0 exoifctodlmDrliei;()t2xoxmpiydolee nes tfa2taxm nu4aex  i3tadla2umuvo t0 exrxf3oa1oatrlues t t2uoim3io1ap e fvs (f 2rru pot0aeen oeiadfmDumuvsn() etoio to1lm ean sls srumimpnu1altn fci t a2tau o;o0alenifeiatla2eauvo;t4 ltnmf oatfpt lu o t s2xr(o3ou1apt  iesa(farum(r nt1ope ifetatfs rl(vs t0tlxnifciodfp raues;(  ruoxopnu4op elfvta()arraxmooo4apeoiiciyd m eluvo;u0 eeomrcty1omtelnvs;( sexrxmpoodlmenlnct tfarrmumpno4tpx  icildfm2uaump () rxrif to1oa e nvi s) etm(r oy4lptelnes (fsrurumo;o0tex  oeiys sDra( s (4 etnmo iydfaDe uei;(0t2uoxr oy4al   feil(fsrtaxm ;u1tetnmfcildfsDrl( onu0aleoxocto1lateaivs t) 2tr(rpiy4olenlfes t srumur nt1oeen feiaslmDulumo u)tlerxo3to1fpt lnvi;( s2xrimpnu4optemiesatfaDtaurpnt4tlen ieiyslsDumuvon(4 lxoxo3oadoaDran i;s0s2uo(m3io1ap e feiatf Dta(m no0aptnioeiyt sDrmumon(4aexrmo oadfa e i il()t2xmxopou1lmtelnvt (f rrm(r ;o0oeenmfetatfa uau s u)tleomociodfa e i il()srurxm ny4ol  lfciatf Drmu  no4alt  i3ilt a2ua( snu)altrxr tytlpDr nvi s srxo(r3nudlmee ncta(fsDur(mpno0alxnifcildfsDumn ont) ltomocoodlp r uvslt)srxr(m ou4oltn ivtat arrm(mpno4tlt mi3ildfaDean p t) eenxociytop elu ols  etr(r3oydlme mneil(  rumu pnt4teto fetatla eln o u0 rxrxf ootfptrlueo (0 2tmir3iydope miviat) rrrum ;u0opx  i3iat m2rmnvs;t0alenxfciatlpDe i o t) 2ur(m3oo1ope mfvsas) rtrxro;u1olt  oeiyt a um(msnu4treoifciadlpD luvo t0t2trxopou1lmt mfcs ()s2ua(ro;o0apt  fctld a eaumpnu)aeenirciy1fm elivilt tetoxr3io4lm emici tfs2tmxmonu1alxoifcilt m2rmuvpnt4tlxrxo3oytom  lnvslt srxrxo oo1lpenlnesl(fsDur(  oo4tptnioctasls2em( ont0 rxoxr oatfpDe n o;t  2trxo3oy4apte fci (  rtr( p;t0oex ifciydlm2rl( pnu0 rxoxfcootomDr i ils  ruoxo3io1op e nesas  Drrumo;u0aptomo3iatlsDeauvo u4 ltrxf oatoa  aueslt0 eumxr oo1altnmnvt ( aDra(m nt1apxn icias mDemnvonu0teeoxr to1latelu ol( s2xmxr oy1llt mivt ( arurum ou4tpxn ociyslm ea( p;(4aetnioctydla raivo;( seum(m3oy1al n iet s) rum(moou1aeto oeiydls2uauvs t0arenmo3tadlpt  neslt trurxrpiu4altelnetlt) rrm(r ou1olt mfeiat m ul(mon(4 rxnmf oadlpt  u i t teumxm oo1lpen fvil(  Dra(mooo4apen ocildlmDrmnvo;u) rtnxo3tadfmDrli s s0srtrxmpiudlme lnetas srtaurp;t1oleoifeiad m ra(vp t)alerxrciodla rlnes;s)teur(rpnydapen nct t) Dtmxmpoo4aexn icilslaDraums;t) etnxo3ty1op   ivilt) rtrxrpio4lm n fctlt)aDrrumo;u0olto iciaslm rl( o u4trenxo oadom rliei ( srtriopno4ap  lnci tfa2tau pot0oltnmocild s2rmumpnt)artomr oatom rli i;()srtmio iydlp   ivi s aDur(moot1apeoiietadla eanmo;t)aeenxr oadomDr iei;s)trurxmpoo1lptelnvias  rtr(roou0oleo octys sDuau p u)
\ No newline at end of file
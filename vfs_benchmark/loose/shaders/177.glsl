@@ -0,0 +1 @@
+uvo;t0 2xoim oy4apt  fvt (fsrta(r ;t4apt  feiasfsDel( pn(0 lxrxo tytlpt  iei s0t2uoxo3ny1lltn ivil( a2trx oou1oltnmictld mDeaumo u) lxrxrctotlmDeln olt)sexrirpny1lltnmiviatfaDurum ;t4alx  ociadlm2rln s;u)artnifciytoa rluei s  exmim3io1lp  lfvtl(  Draurpno1tpxo feilslm2el( p t)aetoirciy1opt livi;s)tetoim iodlm nmnet (farrr(r ou1altnifeils m eanvpnu) reomf3io1fm  aieo;s trxmio3iydlltelictlsf rrmu poo1altnioeiytfmDeluvsnu0tetoiocoodop e ues ()s2urxmpoo1lle mfci (fsDrmx  ;u4oleomoeiaslm2rmu sn(4 reoxf3io1fmtrli il( tetrir3iodam  lfeilt s2rm(mp;u1tlto i3iad m2rlu p;()arenif3ta1fm elnei;s0t2xrxm ny1lpt  fvtas  rtrxro;t0aeenmiciyt a umnvsn(0trxnmo oodopte uvo s trxoxr3iu1op   ncta()arta(moot4olt ifciyt aDel(mont)tetnifcta1fm   nes;t0truoxm iy1lpte fetas sDumx o;t1tlxomf3tlt s ra(mp;t0 etnmrcoytfpDrauvol( teuoxr3ou1amee ivsas)sDra( oou4alxnmfciltlm2emnvpnu4 ltoxf iytopDrlneo s0 exmxo3iy4omtnlnesl() Drmx o;u1tlenmfciasfm2eanmsnu)trxnxfciatlat aieslt0teumio iydalt lnci s) rtm(r ou4tet  i3iys mDrm( s;t4 exnxf iatla e ies t)trxm(r nodlm nlnvs s)srrrxro;o0openmfciatla2ul(vo () eeomo3oadlpDrauvolt0sexoir3nu4lpeelnvtl(f 2tmu  ot4tleoioeiytlsDul(vpnt)arxoir io1omDelnei t0sexrim3nudome  ivi sfa2rrumoot0aexnioeiytfm2ulnmo ()arxomf oytlatean s t)tetoxo3nydlmtnlfvt sfaDtmxmo;t0tle  ictlsla2ua(mon(4altoioctytoa ean o t)t2xo(m nydllte iesls srtrurpoo4openmfeiyt mDumump;t4 reoxocto1lpD lu o;s)trxo(o no1ope licsls srra(m ;u1oeen octydfm2umump t)altnmf oy1lpD  ieilt)s2toio nu1ap nmncsl()aDtau pou4apxomfctadfs2elnvsnu4trerif oy1lm rlivi;s  2xmxm3iydom e fesa( aDuaxr oo1altn feild aDrl(vp;t0trxrmo3tadlateln i;t0truoxo3iu4amee fvi t  rrmum no0tptn oeiat m uanvont4 eenxr iy1lp rluvo;s0seumio3ou1optnmiesat)sDrmx pnt4oexo octyt a2rmnvsnu0arxomo3ta1lpDrlies;s0 euoim3oo1aleelnctlsf rra( oou4alxnmfeiydfmDraump;u4 exoifcoo1fm raueo;( srxrir3nodalenmnvias a2rrurpot4apxn o3ils sDra(vp;(0altnio oy1fm elu i;()t2xrim3iy1oltnlivi s) 2urum ;t0apt mfetlsfa rl( pn(4tetnir3io1lateliesls srumio iu1lmt  fctlt a2umurpno0tleoiiciys a ea(vo (4 leniocia1fm ean i;t0truo(rpnudal nlnvsat)arrrxmpno4alxn feilsfs2rmnmonu)artrir ty1lpD ai o s seurio nu1lltnmiesl( aDuaumpnt1oltn ietldfmDra(mo t0 lxoxocootlpDr neslt srtmir ou1ap n fvia() 2ra( onu1texnmi3tytlm2emnvo u4 eeoxf iy1lpt aneo ()setrxm oodapt mivt (faDrrum ;t4aleomiciltls uau o u0tlxomf todlp   i s (  rtoxo ou1ol elncil() Drm(  ot0aeeomieiadfs2uanmpnt0treoxr oo1fp e nvo;s t2ur(r3iy1apt  fvsls)s2ta(mo;t0oetoifctadfaDuauvp;(0artnxf iodfaDranvo ( s2xrir3nydllee ict s s2taxroot1alen o3iysfs2ulnmo;(4tlenxrctytlpDeluvils) 2ur(r3oo1op elies sf Drrump;t4oetnmictasfs2rmumo;u0 eenirciy1oaD lieo;(0 exmxm3iodol e netas  rra(r ;o1oltoif3iydlmDem(mo;(0 rxoxr3oatlaDelueil()teurimpoodlle  ivi tfartrum no4olxnifeiat a2el(vp;u0trenmr tatoa rauei;s)t2uoimpou1amenlivil( s2trx  nu4ape mfciydfm2ra(mp;u)tleoxr oydfmt luvo (0 euoxmpnudole  ici (  rtmxroot0tlto ieiasls ra( o;(0aexrio3oo1oaDe u i;t0sruo(m no4ope micslt)sDuaurpno0tlto oeiltlm2umumo ()tlxoiociydlateai sls)trumxr ou4opt mnci ()a2tm(  no0opxn f3ild a elnmon() ltoiocoy1laDr ues (0texm(o3iu4lpt lnet s s2uru o;u1tpeo ieiatlaDem(ms;(4trxnxr ty1lpD au ilt  exrim3ny4optn neslt aDrmumpot4apeo oetld sDuanvo (0aexrio oy1oaDeau s t)truoxo3io1ll nmnvtl()srrrxr nt1olt mietldls rmu o t)tleoxociadfaDe n i t0srtmirpno1omenmnvtas) 2ra(mpnt4teeoiicias s2el( pnt0texrio tydoa rluvil( trxoio oo4llt  ivt t)s2tm( pno0alxnif3tatla2elnmpn(4trxnmo3tydopDran i;(0teurxm3iu4lm  mieiat sDua( o;o1opxniicildlmDrm(mo u)artniocoatfmt  iei;t  ruo(m3no4al emfetatfarrmump;t4oltomf3iyt a em(vp;()tltnxociotoate neo s texoxo3oydamtnmivt t) 2uaur ot1aeenif3ild a uau ont)tltoxf3iadop rlies;(  etrxrpoydlme  ncil(  Dtmxm nu0olxomoeiys mDemnvp t) eeoir3ootlm e u ilt  2ur(m3iydomee ieilsf 2trxr ou4tetomi3iadlaDel(mo t)tlerio tydlatelueilt) exmim nudlpe lfviasf Dtaxrpno0oleomociyslm2umump;t) lenif3oytfmte ueilt  2trxm3oy1llen feiltf 2tm(mp;u0aptomi3tldfaDeanvo u) etrxo3oo1lmDeau olt srxrim nydop n fcsas)aDurx poo0ope  i3tat aDemn p;t) eenio tytla r nvs;s0 2xoio oydam n ivtat a2rrx  ;t0apeo i3tldlm2ulnvo;u0trerif3oodla   neols)texr(opnu4lle  fvsa()aDtrx pot4tet mfciat a ulu onu0alxoxf ty1lp   neil( s2xrxopoudole  ieia()srrru onu1ale ifeiltfa ra(mpnt)trtnxrciadfmD an o t)teum(m3nu1oleelieslt a2tax p;o1tlx mfciasfm rl( sn(0alxoir todoa rln o ()texo(opnydaptn nci t  rurumpoo0aet miciyslaDumn s;u4 rxoxf3ootom  li o;(  2xrxm ou4omtemiei sfsrtmu oot1tlxoii3tld m2rlu s u)aetnir3tytfaD aies;t t2uo(opny1lpen fetlt) 2urxmpno0olt  ictyt aDuauvsn(4arxnifcoatfpDrau s t0setrxmpnydlpt livi t) Dra(  ot4aeeoioctys aDeauvs;t0 exnxo to1omDe i i;s0s2xmim3no1lltemfctlt) rumu ont1tle  fciad a ea(mo (0 lxnmocoadla r ues;(0s2uoim ou1al n ivia(fa2tm( ono4olxnmociltls rl(vs u4 lerxf3ia1lm  luvi () 2tm(o iudlpe licslt)sDtrum ;o1aeenmf3iadlaDumn s ()tleoir3io1lmDeauvsls0teurxr iu4oltelnvia(  Dtrxm ;u0tlto ociytfs2rlnmon(4 rermo3tydfptrai slt0s2xo(r3iu4amenlnvt (  rrrumpot1teenii3taslsDulnmp;t0arxrmociy1oat aueils srtmim oo4ll elfct () Dumxr oo0open ietldfm um(vonu) rtnmrctydfp rli i s) 2urim3oo4amtemfct sf 2tru ont0opxo fcils sDeluvs;u0aexrxf3oa1opDelivi;t0 2xoirpno4lpt mfcs s  2ta(  ;u0oleomoctltfm rmnvont0trtrircoodlmt aneo;(0s2xmxmpou4ap elncsl()s2urxmp;t0apxnio3iaslm2ran p t) etomociatopt li s;s  2toxo3oo4olenmivsl()aDrrumpnu1oee io3ils a rlnmo;(0aeerxfcta1optelnvi;s0seuoxr3ny1oltnmncs t aDra(m ou0texomieildlaDrauvs t4artnxocoydop r uvo t)srtrimpnu1omtnlnvils) rra(mpnt1tpxnmoetysfsDuau s u4altnmo3oadlaD aivols)trxoxm oydameelnvs t srrmumpnt0apt  oeiadlm eluvsn(4aexnxo3tadlpD lu i;s0tetoimpoy4am e ivil(f 2taxm ;u4aexo fetydlmDrm(vo;u) etrio tatomDrluvi (0sruoxm3oo4lpt  iviat sDtmu o;u0alxn feiat mDrmn p;u0 ltnifcoytlm eaivsl(0 etmiopou4oltemici t srurx oou1aeen fetld aDelnvp;() rxoxo3iotlate iei;t teto(m3iu1lme  netls)s2ta(  ;t0teenmoeiadla umumo;t) ltomfcoa1fp ean o ( s2tm(mpnu4aptn fes s s2rrx oot4apen o3iyd mDrmuvsnu4 ltnmr3tatfaDr n ols s2tmim3io4lmtnmiet t sDrrxmont1oleniocils m2ra( p;t)texrmociytfpDeanvo;s  ruoio iy4apeemnetltfarurum ;u0oex ioeiasfa rmuvs;t4tltnir3iytlm  auvs;() 2xrimpny1omee icil(fsDrm(mont1apxnmo3ias m2ra(mp;t)aleoxr3oy1oate uvi () rxo(mpny1aptn nviat  Dtmxmo;u0aeeomictlsfm2ua( p;u0trxrxo tytlpDe n o;s0s2uoirpno1alenlivsas aDurum oo1aexomi3iytfs2eanvsnu0alxrxf3iytlm elu slt setmxopno1olt lnes tfs2umum ot1tlen i3iltfa rmnvpnu)aexomfctodfm rli s ()seumimpnydaptemfvs ()aDuau  nu0opt mieild m2ul( ont)altoxo todfa  lies;(0 etrxr3no4olee ietl( a2tm(mono1oexnmi3iasfm ua( o;t)trxrmo3todlmtr u i;s s2xr(m nydopeemics s srtm( ooo0opto f3ilsfmDeaumo;u0tlerxr3iatfpDrln o t) rum(opnu1oleemfetas srtax p;o0apt  fciltlsDra(mo u0alxnmr3to1omD lieo t s2xrxr3iy1amt  netls) Dumur no1aeeo oeilslsDem(mont)artoiociatlmtrlieilt  exo(m3ny1lm e nctat) Drmu ont4teen oeiad s ua( pnu0aetoxrcootfm eluei;s0 rxrio ny4apeelfvs s) Draxrpnu1aexomo3ilsfs um(vsnu0trtrxr iadfaD  ieol() exm(rpoo4lptemfeia(fsDtaxrpot4tpeomi3ilslm el(vsnu0aeenxo3ootfmDr ueols  exrim3oo1om  licilsf Duax oou1oet  ietaslsDum(von(4tlenmfcta1lpt ai i;t0teurir3iu1aptnlnei t) rrrxm no0aex  feiys s ulumpn(0altoio3oatop  aueo;t s2xrimpnodoltnmietls)sDrr(mono1ale ifciys aDrluvo;(0treniociodfaDrai i () 2xmxrpoudape mfes (f rtmxr nu4ole  fcildlaDem(vp;(0 rtoxf oadlaDr i s s  ruo(m oy1ll nmfcs sfsDuru  nt0tpx iocils a2ua( pnt)alerio3todlatrlnvo;s0s2xoio oo1op e fei s)s2rr(rpnu1oetnmoctytla2emuvs;u0tetnio iy1lmDeln o;t  2uo(opnydomt  nei s) Dumu pot1tpto feiaslm rmuvp;t)teenmociotlp eluvs;s srxmxm nudlleemfetltf rumu oot4opeoii3tadfsDrm(vp t0arxrmfcio1oa r u s (0srxr(opno1apeemncilt  2rmurpno1tlt mfeiatls ua(ms (0alerxo3iy1lp raivi;s)seurir3iodol  liesltfs2raxr ;t1olx mo3taslaDranvp t0 exoif oa1oaD au o;t0 2tmxopoodame  fesas)artr( pnu0tpeniieiytfsDumuvp;t4aeerxr iotlp r nvs s0 etr(m3ny1opte ncsl()s2rmxm oo4altnmfciysfs ua(mp (4aetoxfcia1fmD  ies;t0setrxo3oydlp elfctl()a2uaum ;u1alt  fciltfa ua(mo;() rtnmf3oadop  aneils t2xrxo3oo1olt  fvia() 2rau ont1aeenif3tltfm rluvo;u)trxrxr3to1laDeai sl(  2ur(mpou4lpenmnetas arumu  no4opx  ieiyt m2umnms t4teerir3tatfaDr n o (0t2um(rpnydamen nciat)srua(m oo0tlx ii3ilt a2rm(mpn(0 ltoxo3io1fm  liei t)s2xm(rpio1ol  lnctls) 2umur ;u4olx  iciat sDumuvo;() eenxf ta1lpD  neolt)trur(r nodlptemicilt  Dra(  ou0oex mieiadls2um(mp;t0trtnxo3io1laDeaneo;()sruo(rpou1lpe lfeias)artr( poo1tetomiciyt a ranmsn(0arxoifcty1op ran i;t seurir iudlmtelfvta(  2rrxm no4aex  ociytlsDeaump (4 etrxrcoodopDeauei;() 2ur(mpiy1lpen ivs () rtr(  ot1oetoio3ilt mDrluvs ()tlxoioctotla r ivo t)t2umxrpiodap  lfvs (fa2trx  nu4tpx ioeiatlmDrmnvo u0aexrmr tatla   nvs (0truriopoo4ll n nvilt)aDrrx pno1aetomieiyslsDuauvs;()tetnxrcia1fptrluvs;t teumxm 
\ No newline at end of file
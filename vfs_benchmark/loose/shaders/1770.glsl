@@ -0,0 +1 @@
+ues s0t2urirpou4olt lfctlsfa2tm(  ou1tpe  fciysla rlnmon(4tltomrctadla e uvolt0seuoim iudol nmici s s2rmu ooo4texnif3tlt a2uluvs;(0aeeoifcoatfm r n o;s)t2tmirpny4ope  iviat arua(m nt1tpxn fctyd m2elnvs u0 ltoxrctydfa  lu o t0srumxm3iu1lltnlfvt t artrumoou4oetomiciadls2uaums () ltnmr3iytfptraivo;t)s2xoio3oy1apee nei s aDrmuro;o1tex iietlsfs umuvp () rxnxr oy1lpDeai s s)t2uriopou4lpenlncia() rum(mpnu4altn octydlmDrauvpnt)alxrxo3ia1om e ivs;t)seumxr ny1omenlfvsat) 2taurp;o1aexnmfciasfaDemuvo;u4trtomo3totfpt  i sls0tetoio nudoptnmivs t aDtmx pnu4tptnmi3ildfa2eanvs (4aeenirciodfmt  ivi;t  etmxo io1om nlfct ()s2uaumpoo0tpt ifeiytls rl(von(4 ltnir3iytop raueolt0s2um(o3nu1lmtelfvsas srtrx  oo1olenifeiys sDrl( p;t0 lenmo ootfmteluei ( texm(mpiy1ap  mici ()arurum oo0tpen iciyt s2rm( s u4arxnifctytla rli i;(  2xoimpiudlle lnvslt a2tmuroot0tpxn ictaslmDumnvs;t4alxrmo iy1fpD au i s) exoxm3oudlmte iet tf Dtm( pot0aee micild m rmnvpnu4 lenifcia1fat  u ols) eto(opio1olen fci (f ruru oou0tlxn fctysfaDranvont0texrif3oytoatelues t)truoirpoy4llenmictls) rtax ono0apeo f3ilsls um( pn(0 etnmfctotla raivo;t0 rxr(r3oo4al   ivt s sDraumoot0tpxoiiciaslmDuau s;t0alenmrcoodfa e n o;( trtrxo ny1opeeliesltfarumu p;o0opxnmiciatlaDumnmp t) lxnio3tatlpt aivslt) exmio3iy4om emfvtas)srum( pou4tpe  f3iysfsDumuvsn(4 etrxo ootop rauvi t texrxm3iu4altemictl( a2rrx ooo4tlto oeiatlmDul( s;(4 lxrxocoydlm rauvs;s0s2urxr3ou4ap nmnetas  Dtmxmooo4tpen i3tad a2ea(vo;t) ltnxocoytlp  lnvi ( seurxo nodal nlnct tfsrumu  oo0aexo f3tatla2eanvonu) exnmrciytlpt li i t)srxrim3oo4ome lnvs (fsDuaumpnu1opeomi3iatfm rlums;t)artnircio1lmDeaueols)t2to(o3nu4alt lfvtatf 2ra( p;t4tetoioeiatfsDemu o t4alenifciodfmt  n o;t)teumir3oy1ape  nciat  Duaxr ;u0aleoifciltla2uluvo;(0artnxf tytla rlivol()s2umiopny4al n nvsl() Drr(  no4tlxniictlsla2uanmp t4 ltoxo tatlmDeaneol(0sruoxr io4al  lfetl(f rum(mont1aptn oetysfsDumuvo;u4teeomocio1lpteli o;s0s2xrir iu4olte fci t) rtr(ront4ape iiciasfaDrau o;(0aetrifctytfatrai o s)sexmirpoy4ope  fci s)s2ur(monu4altnifeiyt sDrmnvont0aeerio tytomtrauvil(0trtr(r3oydll emneslt)sDrmxroot1teto ictas s um( p ()trxoxr oadfp rliei;s0 exoxr iy4al nmfctlt  Dumxm nu1alx ifcils a rln p;(4alxrmo3oo1opteanvsl( trum(o no4lp e ici ( srtr(ro;t0alxn oeiltlsDuan o (4tetoxoctodfpt  nvsls0t2trim nu4om e fetasfs2um( poo4tet if3iatla rlnvs;t0aleoir totoptrai i (0srumio3iydlmtnmivsasf rtrumpnt1texo o3iasfs2emnvp u0arenio oo1fat lieo t t2trir3io4ameelfctatfsDuax p;o1aee  fetytfs2ean o;t0 lermo3ta1fp rluvs;s trtmxr3ou4lp nlfvslsfsDtmxrpoo1aptn oetadla2elumo;(4tlxnxf totlm e ivi;t) euoxr3oodaleemictlsfarrmu pnt0texn feiyd m2rau snt0tlxniocia1laDrlivs;t  2xr(o ou4amtnlfvi ()srrrur ;o0oltn o3iyt m emu snt0tltoif3todom r u ils0s2xoimpoydlp e fvi ( aDta( onu4aptomi3taslm2eaumo t)aexnmr3tadla e n s;s0seuriopno4lm n ict s) 2raur nu4optomociadls eanvon(4texomf oa1fmtrauvo (0 etmxr3oo4ol  lnvia(  2ta(r ;o0apx ioeiyd s rm(msnu4 reomf3iytfmt  nes ( srtrxo3io4al  lics s)s2taxmpoo4optnmf3tlt s2rl(vonu)teeniociodfmtrln o;s0 rur(r3io1ope lnesa()s2tmurpoo4opt mfcildlmDraumo;u4 reomf3totomDe uvs;t) rxm(mpnodom nmnetatfaDrmurp;t1tleoioeiys s rm( p;u) ltrmo totop e iei;t) rtoiopiu4am e nvs tfaDtmuronu1tle ifctyslmDul(mp;u0artrmfctadfpt aivo;s trxoxopiodll elicias)a2raump;t4aet  octyt sDeauvo;t4 leoxoctatlptrlieo s0t2tr(m3oo1al nlicta( sDuau pnt0tetn f3ilt m2elumsnt4trenmfcoadoa e ueslt)srtr(rpoy1omenmicsl(f Dtmxrp;o1tlt iieiys aDul(vo ()tltrif oytfpD auei () etrxo nudlle  net t a2rrx  ;o1apt ifciat sDua(mo;(4altnif oytom ean o t) etoxopiodopt mnciat  Drrxronu1tetn oeiydfa uanmp (4 rxoxfctatoateai slt  2xr(r3oydomee nes (f 2rm(rpnu1olx if3tydla rl( ont0tetrio3oytfaDrli sl()srumimpoo4am e ies t) Dtmx ont4olen ictld sDua(msnu4texrmr io1oate uvi;t0srum(m3iudamtn iet s)a2rr(mo;t1oex mo3tadfa2rmu o u0 eerxociydla r n olt) rto(m ou4lle livs () 2trumpnt4tle ifcils a2raums;t0 etoxr3tadoa elneo t0 2xm(r3oodlpe  nesat  rta(  oo0altnmfetadlm2rlnmp t0arxrir oadfptr nvi;s)t2um(m no4al emict t) 2uax oot1olto ieilt mDelumont) rtoif oodoatranei s0 rurimpoudap nlict tfarrmxmonu0tpeniiciadfs ul(vpn(0aleoif ootomD  ieo s)srtmxo3iy4op e neta()arum( ono1olxnifetldls rm(vo;(4 lenio3iy1lm r n sls seto(rpiydol  mivtas  Dumu p;u4aleomi3tys s emnms u4artomfcty1lmDe nes;t) rxriopoydopenmivi () Dua(m ;u1olenmfetad sDrl(vsnt) lenmrciatlptrlnei;( s2trxr nu4lmeemneta(fsDtmumooo4tpeniieilsfa ran s t)alxnmr oatfp e ueo t0t2xrim3iudom nlfctlt sDrm( pou0aptnmfetyt s raums u0treomo3tatop elnvils0texr(r ou4amtelict t arrrumpoo0opeo fciyt m2elnmp;(0trxnxfciydomD auvils) 2xrio3nudame mivt s aDrm(mp;u1alt  i3ilt aDrmu p;t)tltoir3ootomtrluvs t  rxmir oodopt miei ( arururont4aeeo f3ildfs2ul(vp;(0 ltnirctodopte u i;s teum(opou4olt  ncsa() rrmxmont4teeomf3ilsfaDuluvs (0trxoir3iy1om   ueo;t0s2trirpoudop nlicslt)sDumurono4tet moetasfm2elnvp u4arenioctadfat lu s s0srtrxrpiodaltnmnvta(  Dtrxrooo1tlt micilt s2eaums (0tltomfciotlmteliei;t)t2uo(m iu4lltelnviltfsDrmu ono4alt  iciyd mDeanmo;u4 rtoxoctatoat luvs ()setrxmpou1ol emict () Dtru p;u1teen ociltls ra(mp (0aeenmf tydlpD  neo ( setrxrpiudopeelfesls srtmurpnu0alt  f3iytfa rmums;u0 etomo3ta1laD aivi;(0 2tmxm nu4ll emnetlsfaDumxmo;u0apeo o3tlt a2eauvo;t)tlxrmfciodopteanvi t sexo(rpiydlpenlncta(f rua(rpno4optn ociyd s2ea(monu0alenmo oydomtr nvs;s)t2urxo oo1olte icia()sDra(m nt1tltn fciatlm2el( snu0 eeoif iydlmtrln sl(0t2xrim3iydoptnmfeia(fsDraump;u1aleoif3ild s2ua(monu4arenmr oatlmDr u s;()sexo(mpoy1om e ncslt) ruaxrp;t0oetomoeiat a2eauvo;u4 ltnmo3ootlmD  nvi;t srtrxrpio4lm n icilt a2raump;o1ope  o3iytfs2elu o t0trxnmocoa1lpD lueo;t0texrim3iy1ll   nci tfsrum(m ot4tlx  o3ild s2ra(mpn(0tlenxrctodoatrai o ( srur(rpiudam  lfvt ()aDra(rooo1aex iietyt s ulnmp;u4arxnmf3ootfmDeaivo t trxm(r nu4ap   nvtls srta(  nu1oetn ocils aDum(vpnu) eenxf3oodlm  aneolt0trurxopiodlp elfcslsfs2trxmpot0apeo octlsfm emumo;t0 exrxfciy1lateaies;s) rtr(mpiydlmt  icias  Durum nu1tpe mfctas a rl(monu4trxnxrctatoptr i slt0truo(m iy4omee ici (  2rr(rpnt1aexo icilsfs ranmo t)altrxocoy1optrlnvi;s)sexo(r3io1lp n ietas)srurxr no1oetomictatfm2uluvs;u) etrmrctotfmteanvi;s0 2ur(r3oudolt  net ()srtaumpnt0apx  octasls uln pnu)arxoirciodlmt lu o t  rtmirpoydomtn nci s)a2rr(mont0teenifeiatla umnvo;t4aeerxo to1fp r nei t0 2xr(r3oo4lmt  nvta(f rrax  ot0tex  i3tytfa2rl( o;u) rtoio iotfp ran o ( t2uo(m3io1am emfvs s s2ra(root0opx  f3iasfmDrlnvon()trtrirctadlptrli o;t0s2tmxr3oy4amtelfcslsfsrrrxm no0ope if3tls m um(mpnu0tltoir3tytopte n i;t0s2xmio io4ol  mneilt  2tmx  nt1aeen fciytlsDrau o;(4texoxociydoptrliei;s)teum(mpiy1apen ivtas srraxrpnt4apxn ietltfsDuanvont4 exrmo oatoaDelneo;s0srxo(rpoo4oltnmfcias)aDurxroou4tlx mo3iad aDrlnvsnt) exoio io1lptelues;(0 rxr(o3no4oleemietl(fsDtrx ont1tle mi3tysfsDul(vpnu) lxomr oodomteli i;(0trxriopnu4apt lnvias arrr(ro;u0alen ietls sDeauvo;t) rxnir3iodlatrlnesl(0t2uo(m3ny4alee ict ( s2tm(r oo4oexn octysls ulums t0aexniociydlmDe uvol(0 exo(rpio1am   feia() Dumxr ;o4tltn o3ilsfa elu snu0aleoxo tytfaDrai s;s0 2xm(mpou1am nmicia(  rtrum oo4texoioctatfsDeauvo;t)trxomfcto1lp elivi t)s2tmim nu1ol  mivsa()aDrrumpoo4ale  ietadfa2el(mp () etoio ia1fate uvo;t) rtoio oy1om e ict ()artmx  no4alx  i3ilt m2umuvp t)texnxo io1om  luvsls0 exmir ny1olenmncils sDtmu  ou0teeomi3iltls em( ont4trenxo to1fp eanei s0 2trxm ou1lleemnetls) Dtmumoot1aptoif3tls aDuanmp u4trermf3iadlpt lies t0seum(r io1am nmnci s s2tau p;u1texo ociatfm2em( o (0 eenmrctotomDe ivo;s t2xr(m3nydale lfct t aDtr(  no0tlenmo3tldfm2ul( onu0 ltoxr3iatop  aies;()t2triopnodlmtn nci ( srtr(  ;u1ape mo3tysfaDea(mp;u)arenif iydop  anei s0t2xo(m iu1lp   fvsatf 2urx p;u1opx mictytlaDulumsnt4treoxfctatoptelu ols0trum(rpio1llte iciat sDta(m oo0aetoiociyt aDeanmon()aexrio3iy1lmtrlu i;s0t2xm(o3iy4olenlnci (fsrurur ;u0texoifctysfs2ul(vp;(0arenmfcoatlatrlieils0trur(m oydlpt  fes t)a2ua( o;o0altoio3iys s2umumo u0 etomrciydom ran ol(0 rxoxrpoudll nmncilt srrr(root0aetnio3ias s2umuvo u4trtomr iadopD  u olt0srtrimpoydom nmfcia( srraxmp;u0tptn octlt mDul( sn(4aexrmocoy1lpD anvi;t0srxmirpno4amenmncs tf rrmx pnt0apeo fetyt m uln s u)alxnmr iydlm  an ils)trxmim3oydopt  icsls)aDraumoot4tpxnio3tldfa2ranmont)arxoxr3oadop eaieols0sexrxopou4lpe  fes (f Drr(ro;t1alxo o3iyd m2eaumpn() rxomr iotomtr n o t0trtm(o no1llt mnei t  Drr(r oo4olxn feiltla eau pn(4tlenio tadfp elnvi ()sexoxo3iudoltelnvtlsf 2rrxro;o1tle  f3iat s rl( o;u4 exoifcto1lm eai i s) 2xr(opny4lmtn ietlt a2uauront4alxn icilsla um(mont4aetnmoctodopDeai s;t)trxo(o nydopte nvtls) 2ur(root0tpeoiieiydfm ul(ms;t)tlenxf iatlmDrln il(0s2xmir3io4lpt mfvilt)s2rmu p;o0tpt  oetysfm2em(vonu4 exomf3iadlmt anes;( trum(r3oydll e ici s) rtrx oot4tltomoeiasfa2rmnvp;(4aexnxr tydla eln s;t0 exmxrpiy1lpt mncsas sDtmum ot0aeeo octydlmDul(mo;u0trerxf iotom rau ol( srxmir3oodomee nesls)aDurxr ;o0aptomfciyt aDelnmpn(4tetrir oo1lmt lu ol()truoiopoo4lm elfcs ()srua(r ;t1oetoifetltlm2rlnmp u4treomr iy1oaDeaues s)s2xoxr oydome mnetls)sruax  nt1tlenifeiydlsDemnvsnt0 lenmr3ootfpt livi t0 2tmxrpou4apee fvs sfarra(mp;o1texoii3iltla rmu s;t0tlermf3iy1lm  ai s;( t2xr(o nodolt lneilsfaruau pnu0tpenmoeiysls2rm( s (0arxoxociatoat ln s (  rur(mpiu4ole lnetat  rtaxmpnu0tee  iciysfmDemuvo t4artnio3ty1fptr uvolt0 rxm(o iy1ope lnvtls)arrr( p;t0alxomoeiltfsDuauvs t) ltnio3totfaD lneilt)sruoir no1lm nlfctlt  Drmu  ;o4opxomo3iytla emn on(0trxomr3ootfmD lu i;(  2umxrpou1op e fvt s) 2rmxr ;t4alxniociysls rm(mp;t) lermr3totfa raivi s0t2trxrpou1omtelfvil(fsDua(m ;t4opx ioeiyd mDrlumpn(0 rxnmocio1omDrlies;s0trtmiopny1optnlnvias)s2rau poo4opxo ieiat a rmuvo;(4trxoif oodopteln o () 2uriopiydlmtnmnei sf Dur( poo0apt  oetls a2eanvsnu)aexnxocto1fmDeau o;(0trto(r3ny4amtn fes s aDum(ro;t4aet mfeias a2ranvs;t4 rtomrctatfm e ivi () rxr(o3oy4ameelfctat) Draxroot4tleo o3iyt m2umuvs (4tlxnmr ootfmt  ivo s0s2uoxm3oo4ap nlieta( a2tr(mpnt1alto o3tydfaDelnmo t0 exrio iotfatraues s texmxmpoydlmt mnet (f 2tmxmonu1aleo ieiltls umnvsnt4 eeoif3oytopDelueils truoirpnudoptelfeils s2trxmpou4optnifeildfs2eau p;t4 lerir3oatlmtrln ols0 exo(r3iydalen nct t s2uax  ;t0aex io3iytlm2uan snt) lxoxr iy1om ran o ()srurio oy4lp n nvilt a2rmur nt1oleniictydlm uln ont4 etrio3oa1lptelneo;t) euo(r nudaltn neia( sDtrx o;u4oetn fctldlmDranms t4trxnif3todfm rlueo;s  exoio3io1llt lfvilt) Dtmxr nu4tet iociasfa2uan o;t) rtrmociy1fm  auvols) euoiopio4oleelfvtas)s2uaxroou4altomf3iat mDeauvsnu4arenxociotfp eai i;t)t2urio oudapeemnct ()s2urxroou0apeomocilsls2rmnvont0 exrxf oy1op eanesl(0 rumir nydolt lnctat a2rauroou4texn fetls aDemuvs;u4 reomo tytfpD  ivslt  2umio3nu1open ictl(farrr(rpou4tltnmicias m rln o;u)trxoxo ia1om rliei s  2urio3iodol nmiesltf 2uax onu1texnmociyd a ul( o u4teeomo3oatoptraieol(0sexr(o nodamenmfci t)a2trx p;o4tptn o3iltlsDrl(mp;t0altnircto1opDeanes;t t2tr(rpiodaptnmnes t sDtrxr ;o1oltnifetlt a2em( o;(4tetnmo3iodlmDeluvi s0tetmiopoodomtnlnvi tfaDum(mono0ape iiciytls2rm( o t4altoxrcoytlp eaieolt0 rtrio3oy1lltn ncsl()aDra( onu1tlxnmfciydfa uan snu4treomo tatop eaivi;t0teuoxmpoo4ll nlnvias) Draumoou0ale  ociysla ran p ()aexnxociy1fmt lies;t0s2trxr iy1apte fei (faDumu o;t1oeeniictytfmDrlumsnt4 exomociydop e ivils  exmxr ny1optelnci t a2trxmp;o1oetn oetlt sDemnmp;u0trerifcoa1lm r nvi s)teur(r oo4optemivs tfsDumurpnt4oexo i3iyd aDemnmp u0 etrioctotlpt livs;t) exr(m nydape lfct tfs2urxm nu0alxnmfciyt s um( p t0aexrxoctadomt auvsls sexo(r3iu1ape  nvslt sDra(rp;u4tee io3iydfm2uln p;u)artrxf3iotfptraieslt  ruoxrpiy1alenmnes t)s2raurpoo0tltnmietysla rluvo (4 rtoio3oydlp rlueilt  rxr(r oydamt  feil( arra( ont0aleomoctld mDelnvs t4artnxociy1faD  ieo t  etrirpiu1op nlneiat)s2rax  no0oetn i3ilslmDrmnmp (0arermocoodlmtrauvi s)trxmxo3oydlptelictl() rua(  ;u1olx mi3iytfaDel( snu)tltrxrciodomDrlieo;t0trxoim3nu1aptn ncilt  rrrxmpoo0aex miciys s2umn p;() reoxf3tadfat  n s;t0srxrxrpno1alen ncias)aDua(ront0oleniictysls2ra(mon(4alxrxr3ta1lm   u s;s) rxo(opiydlltnmfvia(f 2rau p;t1ole  ociys s2umuvon(0 leoio3to1om r nvil()tetm(o3iu4lm emics tfa2raxmooo0tlenifeild s rl(vp;t4tltnmociy1lm eliei (  2xmxr iu4omeelneia()srraxmpou1oee  oetltla2eau p;u0arenmrciatoaDr uvi;(0teuoim3oo1ll   fcsa( s2uaum ou4opx mieiad m eau p (0trerif to1omt  i s;t trxo(o nudaltnmieta( srtru p;o4aex ifeiyt m eln pnt)aeeoio3oy1fmtr uvo;s srtoxr3iy4op emfesl() 2ta( oot4apeo feiydfmDeanmpnu0aexomf3iydlp ran i;s0t2xoxo ny1apeelfctl(  rraxmont1apx  feiyslmDulumsnu4tlxrmf tatlat  ieols0 2xoirpnu4al e fvias  Duaxmp;u4optn fctld sDrmu s;()aeermo3iodoate nvs (  2to(o io1omt  fcslt  Dumuro;u0tpeo fciad a uauvp (4 rxoxr3tadop  aivols)t2xoxo ou1ap nlnei s)arururpnt4aptnmietltfs umnvsnt4artnmo todlpDr uvi;t sexriopnu1ope lieia(  2rrxrpnu1aex iociys aDulums;u) rxnmo3ootfaD lnvo;s) eum(o ou1open nvs t) 2uaurp;u0olen ieiaslm um(mp (0 leoxocto1fpt  uvsls)trxm(m3no1omeelncsl()artmur ;t1olxnifcils s eluvo u4 rxrxo3oydop r i sl()teuoio nodop nlietltf 2rm(  oo4aeeoif3ildfm rmnmsnt4aetomfcoatlm  livi s  2xoxopiy1ol e ieta(faDta(mp;o0altn i3iydls eln s t4 lxniocoadfm  aiei;t0s2xmxopiudopte netl(f rtaur no0aexomo3tas aDulnmo t4 exoxf3ia1fa r uvi;t)seumio3no1ap e nvtas)a2ururp;t1ole  f3tyslmDuauvpn(4arerio todfm e i ol( trtmxr iu1amenlietatfs2rru  nu1tpt  oetydlmDrm(mo t0tlxrxfcoo1omDranvol(  etrio3iu4omeelfcs ( aDrmumono0tpt moctydla ua(mp t) rtrxf3iy1faDrlnei ()seuo(o3no1ap n nvsa(f ruaxmo;t1tlt  o3iys a eanms;t4arxrxocoy1fpt  neilt0s2xrxr3iodop nmieilsfaDtmur ou1tet  ietyd aDulu pnt4trxnmo tatopDe nvo;s)seuoim3iu4lptn neiatf Dumx pnu0opeo o3tysfsDrlnmpnt) lerifcoytlpD anvol( s2urir iu1ll emfctls) 2rmxr oo1teenioetltls el( p;u0 lenmrcta1lp rauvs;t0t2xm(o iy1llenlieiltfsDur(r no4aeenioeiad mDuanvsn(4altnxrcootlatelueils0 etm(mpny4ameemictatfa2ra(rpnu0tpeoioetldfaDulnmp;u0aleomr iodlmtelnvilt t2ur(m oy4alte fcsa()aDurxm no1apxnmi3iad aDuluvsnu4trxrmf3to1fmt  iei;s0srtoxm3iy1ole mieiat) Durxrpoo0olxnmieils s2eanmp t4 lerifcia1fp   uvilt  2uoim oydamt  ivt s  rrrum oo1optomo3tyslmDua(vs t4artoxrcto1fm e nvi;( srto(rpno1ll nmnes (fsrurx  ou0apto ociyt a2emn s u0 rtoxocoodfp elu i;t0 2toim3ou4lpt lfet t)arurumont1tpx  f3iadfa2elump t)alxnir oa1oa eluvs s0s2xmxr oy4apen neia(f rumum ;u1optn ictydfs2elnvsnu)tetnxf3iytlmDrlu o;s)tetoio3ny4lp emiciltfa2tm(ront1tpen fetls s2ulnvp ()altomfciadom rli s s trxoio3oydlp nlieslsf Dta( ono1tpeomf3ildfa2uanvs t)trenio3iadomD aivs;t teumxr ny1lmt mneiat arra(rpnu0apeomf3ilsfm2ul( s;()aexrmfcootla   u ols) rtoim3iy4lpenlnvs s a2urumoot1aex  oeiyd a el(vo (4alxrircootfpt aueol( setr(mpnu1ol nlfeil(fartmurpoo4apx io3iltlmDrlnmsnt4trtoxfciytoa  lu s s0sruoxmpio4opt  fcs ()aDtrxmpnu4tlxnii3iydlaDrl(vs t)aexoio iadfaDrau ol(0tetmxo3iy4om eliesas aDtr(ronu4oet  f3tytla eanvo () lxoxr ty1fm rlivi ()trum(m3nydopenlnvsat  rtmump;o4tpto oeiysfs umn o (4tltomo3oadlmDeli o;() etmimpiydlm e neta(  rtmur oo1olxoiociydfaDrmumpn(4alenxo tytfat  neo t)t2ur(r3iudaptemfvsl(  Duau o;u4aetomf3tytla ea(mp t0 rxoio3tatlm rlueo t)srto(r no4am nlncia()s2tmur no4tlx io3tas m uluvont4 exomo iydlmtrlu s t)s2xo(opoo1amee nesls artrxmpnu1oex ii3iys mDuluvo;u0aexoxr tytoptr i sls0t2tmxrpno1lpenlnvilt  Duru o;t4aleo ieiydfs2emu o;(4tltrmf iy1oaD aues t srum(r oydopee fvias)aruaxmoot0tptn ociad s2uan s t0 renio3oadlptr nei;t0 euo(mpio1lm e nctl( s2ur(rpou0tpxo i3iadlmDuan p u4trxrir ta1lmDelnvo;()t2xm(rpiu1amt  fvtlt)a2rru poo4tleomi3iydla ra(vsnt)alxrifctydom e nvo s0t2xm(mpiodoleemfetat sDurx o;o0tle  i3tld mDelnvp u)arxrif3ootfptr uvo (0teurir3ny1lmtn ieslt srrr(m no1alt mociys a rmnmp;t)texnmociy1fmD lues s) 2xr(m oy4lmee ivi sfarraurpou1teeoiiciydfaDrmnmo;(0aeeomrciytoaDean ils0s2uoio no4lltemfci tfsrtrumono0oee iieiaslm ul( o u4alxoxo todlm elu o ( t2um(m ou1amtemneiatfsrrru p;t4oltnmf3ild m2rl(mo t4 lenmr tydfaDr iei s0 etoxo3oy1lpen neta( a2ta( o;t0oltomoeiad a2elump u0aexomf3tatom  aiesls0 exo(m oy1lmeemfeslt srtm(mpnu0olenmoetytlmDea( snu0aetrmocoytomtrluei ( s2xr(m no1lleelfvs sf 2rrxmo;u1aptnif3iad s2el(vs;t0tetoxocoo1lpt an s (0sexmxm oodll nliviatfa2ur( p;u1oeenmocilsfa2rmnmp (4 eenmfctadom eai o;() rumim3ny4omee nvta()arurxr ;o1apxnmf3iaslmDemn o;t)teermf totfa  lueol() 2tmxo3io4lpe  icsls)aDtrxmp;o0opxoif3tatfa rluvo (4alenmo oo1fm ran slt0teuoir3oydam n ics tf ruax o;u4alen i3iadlm2uluvont)artrir io1fmDeaues;t) 2tmxmpnu1lpee iciat)arumx oou4tpx ifctatlaDrmuvp;t)teeoiociydomDr ivils setm(opiu4ol elnes s  Durxmonu0olxo feiad m em(vo (4alxrio iy1lm  lu sls setrxr3ny4omen iciasfa2uax  ;u4tpxn octad m rau ont0arerif iatoateai s;s0 rtr(o oydamte icil()srta( o;u4alxnioctldlmDean s;u0tlerxo oatfaD aneo;()t2um(o iudol   icslt srra(ronu1apenio3ildfm2ulnmonu)teenif todopD anvolt texoxmpiodomen ncsasfsrrauro;u4apxnioeiysfsDra(ms u4tltoxo tytfat  ivsls)t2umim ou4ole lieia()a2rr(mo;t1aptnii3tyt s rln s u4altrir ia1laDr ueo ()t2xo(opnydlmt lfvt s)a2rmurpnt1tle  o3iys sDum(mo;t)areoifcto1fate i i ()srtriopoy4aleemivtl(  2trxm ot4teeoifcildfsDemnmp (4tlxrmf3ia1la e ivi ( trto(opou4al elncsas  rtm(mp;u1ole ioctasfs emnvp (0teeoir3tydlmDr ies;s srxmxm oo1am nmfci ( arta(r ot4tptomo3tltfa ulnvp;u)trerxr3iotlpt lueo t)t2toirpiudomtemfes (  2rrxmpoo0apt mo3ils m ulump;u) etrxr oadlp   uvo t0teurir oy1om  lneta() Dtmxro;u4oltniieiysfm2emuvs;u4trtomo3iadfaDr nei (  ruoxmpoudlltnlnetatf Dum(  nt0tetnioetlsls uluvs;(4teenmrciydfpt ai s (0 2toimpou4oltnmiciatf Dtrur ;t0olx moetld aDrmu pnt4 eenmr ta1oate n ol(  eumirpny1lmtnmfciltfsrumur ou0tee if3ilsfa2emnmpnu0tetomr oydlaD  uvo () rtoxr3iu4omte iei tf rtr(ro;t1tlen fetld s ranmo;u4 lenioctadlpD ln o;()truoio ny1aptnlnvil()sDtaur ;t1olto ociadla umu s ()aetrio ta1fmt  i s t  exmir3no1olen ieias)artrx pot0apenif3iadlaDelu ont) leoif iy1fmtr u s;t0srxoimpoo1lmen fcia( srua( o;t1alxo f3iysfa emnmpnt4alenxociydla   ueo;s srurxm oy4olt  ncs t aDtmumpnu4altomoctyd aDrmu o;u4trenxr3tadlm eaivsl()trxmiopiu1al elnvil() rua(m ;u0tpt mfctysfa raums ()artnmr3oy1lp eluvi;s)sexoir3nydamen ivi sf Draxrpno1aptnmi3iysfaDra( snt0aeeoxocootop rauvo t)s2xoio no1om n ivsl() 2tauront0aeeo fetys sDel( s;()treoxociy1laDrlu slt  exoimpiy4apenlictlt aDrr(  ot1texnmi3ilt s ua(vsnt4aetrif iy1fat ai s ()srurxm nu1open ieils  2tau oot0tpe  octytfm2emn s;t) etrir3oatfm  aivs s)t2tr(opio1lm e iet s a2um(m ;t0tle  o3iasfm2rlnvsn(4tltoir3oo1lp r ues (  rtoxr3iu4openlnvsat  rtru pot0tptomocilsls2el( o (0 rxrif to1oaDe i ils  2tm(opnu1ame lnvs tf rta(mpou0aptnio3iyt mDem(mp () lermocoydlptelnvo;t)s2ur(mpiodalenliei s)a2um( pot1olxo o3iasla2rmn s;() rtnxf3iy1fat anvi t setmir3oydlpe mncia() rua(mpno0tltniietyt m2um(vp u) rxnmrcto1lp rlueo s)trxoim no1ol  mfctlt  2uaurp;o1apxoii3iysls2rmumo (4trxnxo3tadlateanvs t seum(o io4oltnmnei t aDuax  oo4oee  f3iasfs raums;t4arxrxo3to1fmt ln i;s) exoim3no4ll elfviasfa2umu oot1olenifciydlm eanmp;u0trxnmfcoadoate nvo;s) exm(r nydam emneiat arrrxroot0tle if3iytfmDumn s u4 rxoio iy1fmDelueol(  euoirpnudlm nmfesasfsDum(  oo4apt  ietasfa2umn snt)altnxo tytfa elneol( teumxr ny4ale mivsat s2tax  no4tpxnii3iat a rlump;t0alxnxocio1op rlueols teurxo3ou1ol  mict sf 2ta( o;o0aptnifciyt m2ulnmsnt0tltrmf tatopt li o;() euoxopnodomen ictlt arur( o;t1alen ieilt aDum(mp u) rtrmocoodomDelnvols)tetoxmpoodop nlnvtltf 2ur(mpno1opt miciasfa2ua(vs u)aexomf oodlptr i i ( tetoim3iodlpee netas)arrrxm nt0opt mocildls2umuvont)texomo oodoa  anvo;() rxmxrpnu1op emiesa( sDumx  ot0olt mieiytls2ulnvp;t4texrmr ia1lmtr nvo;s srurxr ou4lp emncs (f 2taxm nt4tltoiieilsfs ea(mo ()trermf3totla  lnvo;s)s2urxopoo1al emnvs (  2rax  ;t1opeomfetltls2uanmpnt0 lxrmfctytla  li il( sexo(rpoudaptnmneil(f 2ra( onu4aee mfeiytls2umn s u4arxoxo tatop rauvo;t) etoir3nydole livslt)a2tmum oo1tpt io3iydls2ua(vo (0arerif3oodlatraivi;s) exoxr nu1aleemicsl(f 2rmum nt1tpxnmietltla ulu s ()tlxomo3to1op  lnvo;t0t2uoxrpnydlltnlfvta() rtaur ou0tpeomf3ildfsDulnmp u0 rxrxo3iodlmtrlnes (0srxrxm oy1lm n fvt s aDraur nu1oee mieiad aDeauvs;t4 ltoifcia1op e neilt)trtr(opnodamte nvtas a2rr(r ;t4apto ociyd mDrm(von(0tlxnxr3oo1omD  n i;t0 2umxr3iudomtn fesa(faDtmuro;u4alxo o3iltls elnvp;u) ltrmo oa1opDr neo;s0trtm(mpiu1ope licsas)aDrmuro;u4tpt miciyt mDeanmo u4 etnxf3oodfateaneilt) 2to(r iy1ap n fcias  Drrx pou4tpe iictysfmDemnmsnu4 etnxoctydom eai i t0t2xmxm oudllte fvslt sDtr( o;o0texoiociyslm uanms;u4areoircoatlp  ai s () etoiopnu4olte fvs s)a2rm( pnt4tetomoeild s um( s;t) ltnxr iy1opDeauvil( t2xmio3oydll nlnvils aDrrum ot0oexoii3iasls2umn p u) etrxr tatfaDr n s;t t2uo(mpnodamtn nesa( s2taxroou1alxoii3ildfs ul(vo;(0 etoir ta1fmte u o t)s2uoir iy1lptemnet sfarrmumooo4optnii3iatfmDum(mont)texoxo3tadlptrai sls)t2umimpoydoltn ivtl(  Duaxmont1oltnmictltlm umumo u) exomfcia1faDrlieo;t0trtr(opoo4oltnmncia( s2ur(mont4apx mfeiytfmDran pnu)tlenxr iodfptr ieils  rtmxo3io4ll n ivtlt s2taxmp;u0apt  fcild m elu o t4arxnif io1lm eluvi s)t2umxr ou1lltn fcia()aDtmuro;o1aee  o3iasls rlumo (0 exoio3iadomD  nes s)t2tmiopoudap nmnesa( arumur ;t0aeen f3iatlm2uan pnu4trtomf ia1la eaiei;t0setoxmpnodol n iei s)a2tru ont0tee mfciadlm umnmo (4aexomocto1oat  i s ( texr(rpou4omeemivsatf Drrumooo1apeo oetls a2elnmsnu4 rxrmr3iy1fm eaueil(  rxm(o io1am emfvs (f Dtaxmo;o0tleoioeiytla2eau o;t)tlxnxo oytoaDran ols) 2xoir oodol e ncsatf Dtrx p;o0tlx ioeiatfsDea(vp (0tetrxf io1lpteaneil(  2to(r iodolenlfetas)a2ua(m oo1tle  i3tld s2ra( p (4 lxrmrcoa1latranvs t texr(r iu4ome miviltfs2um(rp;t1tltnmocilt m em(vo;t0alxoiocoadfaDr n ols  2tm(r3iu1lltn fciltfarumurpou4tlxo o3ias aDul(vsn(4alermr oytoa  ln i;s)srtmio3iu1lmt mfci s arum( p;u4aetoiicildfs el(vp u4tltnxf ty1lat an ilt) rtr(mpoo1lpeelfesa(fsrua(  oo4aet ioeiadfm2rlnvonu4arxomo iatlmt luvo t) eur(r3ou1ame  nvs (f rrmxro;t4aeeo i3iltlsDumnmo;(0teerxr oydlaD anesl( trum(r3ny1omt  ivias)a2umurp;o0altomociys sDrl(vo u4teenmo3io1fm r i ils  eur(m ny1lpe  iesas a2uau ooo0apt ifetysfsDul(mpnt4 lxrifctotlp elu i;()s2xm(r iodam eliei ( s2rm( onu1aptn i3ils a2rmu s t0tetoiocootoa  aivsls0srxr(o3nu1al nlici s)s2tm(  ;u1aex mociasla um(vpnu4tetrxr totoateau o s) etrir3ny4omen feilsfarrr(moot1tpe if3ildfm uan ont0tlxrxr3oy1oat anei;t teuoir iu4ol nlivtls) Drmx p;u1apxoiieiyt a uanvo;t4texomrciodlmDraivs;s0 euo(mpnodal  lictlsfs2tm(mo;o1olxniocils s2uan p u4aeerxfciadop   ivo s trtoir3iy1lp emnvslt)s2tm(  ou4ope ifciadfa2ulu snt) ltnifcty1lpDeauvi;s)s2tr(m iydlmt  fvtas s2ur(  ;o0oltnioeils s2rmnms;t0texrxocoy1lmDrlneil(  2tr(r3iy1ap nlfcilt  Dtaumpnt4tlt io3tydls2rmn pn(0tetrxocoatop e i ol(0trtoxr iu4olee iciat)a2rru  nt1aex  oeiys s uln p u4arenir ta1oa  luvs;t0 rurxopno4lp   nvilsf 2ra( pou0opt  i3tltfsDrmu p;u0aeeoxr3oatfp eanvo t) 2tm(m oo1apte ncta( s2umur nt4openif3iatla2emump t)aexnircoodfm  ln s t s2urxmpny1lpen ivt sfa2rrx pot0tetn feiad a2eau o (0areoxfcoodfaDr iei;t  2um(r3nu1al n fvil( s2urur ;t4aeen i3iyd m em(vs;()aexnxo3ty1fm rluvo;t)tetmio3no4lmtelnviat  rtrur ot1optnif3iytls2uau s;(0aeenmr3iotoa  auvo;t seurim no4op nmicsatf Dra(mp;u4aetnmfciydfaDrmu onu4tetomfcoydlpt livo s)s2tr(o3io4apenlfet (f rrm(rp;u0apx  icias aDrmuvsnt4altnxf totfp rau o s0 etrir3io1lm eliciat)aDuau oou1oex  i3tysls2umuvont)trxnmociy1oaDrauvs;t)t2toxm3nudamt  fvilt)srumxrpnu4tpx  oeiyd a rmnmont0 etrxrcoy1laDe i i;()tetriopoudoptemnvsasfarrrxronu1aeenmo3ias m2rlnvsn(0trxnxfciodopte i i ( srtoxrpnu1ol  lfeslt a2uau  ;t1altniiciat s rm(mp (0tetrir todoat auvs t0 etmxo3iy1lp elncs sf Dtmxmonu0tpeomi3iad sDrln ont4tlenifctotfp e ivo;s0s2xmxm iy4lp emivi ( aDtaxr no0tptnif3iyt sDuan pnu) renmr3ta1omD  uvs t0 rxoxr iu1ll  livs (fartmxrooo4oleomo3iydfm ra( o u0trtnxfciotfmtrai s;t)teuoxm nydoltemfesa(fsDua( onu0apx io3iadlaDel( pnu) ltomfcty1oa eaueil(0 2to(rpoydlle livtasfa2rmu ont0opeo i3tlsla2um( s t) lenircoytfmDe nvo;t  exo(r3iydaleelnvsasfa2tmx pnu0olxnifctlsla2ran snu4tetnio oydfm   nei;t)t2trxo3oydapeemncs (faruaxro;t0tlt ifeiasls2ulu on()aetnir3iydfm ean i;()teumxr oy4ol nmivi tfsDumumono4aleomociadlaDrmu pn()trtoiocta1lmDrli s s) rur(o oy1ol emieias)sDtrx ont4tpto fctlslm2ranvonu0 rxomr3iytomD  n ils seumxo oy1lpeemnvil()sDurx o;u1tle  ictyslaDrlu o t)aexoioctadoa elivol()texmxr nudom n ivsatfs2ta( onu1aeeomfciad sDemumpnu0trxnif3iydoatrlnes s0trxm(rpno1ap  lfctasf 2ra(m oo1ale mfciydfa rm(vo ()trxrmr iatfmt aieols teuoxrpoydomenlicsl() rumurp;u4tptomoeiadfa2uan o;u4arermr3to1lm   n ilt  ruoim3nodapeelnetls) 2ua(  ;t4aet  oetldlm2ranvo;()texnmf3iadomDr i o s0sruo(mpoudlptemici t) 2tr(mo;u1ole  fctytls umnvsnu4trerxf oa1lm r neo;()sexmxmpio1ap nmnvias)arrmurpoo4aetnmfciasfm ua(vo t4tetoxfciotlpDr ueslt trtmxrpiy1lp e nvil(f Dta(r nt4alxomiciad sDrmnmo u) reoir3io1fa rlnes ()s2xmir no1lm nmfes (fsDur(mpot4oleoifetydfm2em( snu0arxomfcoa1laDeaneslt) 2xm(opiu1lme mieia() 2rrx pnt1teen ociys m2rlu p;u4 lxnxf3todfm eaneils)setoir3iydolenlfetasfsrumxm ot4ape mfcias m rlu pn()aexnmo todoat  i o;s0teuoxr3ny1amen feta(fsrumur nu1tlxo oeiatfs um( p;t0 etoif3iatlatelueo;t0teto(mpnu1lltelfvs ( s2ua(m nu1ale  fciltfs2rlnvp;u4alxrmo iotoaD  neslt  rxr(m3iy1olenlnetasfsrurum ;o0oeen i3iytfsDelump;t0tltoif3oadfpDrlnvsl( setrio3ou4al  mieta()aDua(rpnt4alenmfeiasfs ul( s (0 reoifciatoat aivo;s0trtoxrpoy1am emneslsfsDrruroot1tpeomfciydfaDemnvo u4altoxrcoy1oaD  ues;s) 2toxmpoo1opt  nciltfsrta(mp;u0apeomictaslm2rmn onu0 lxnmr3oatlp rlnei (  exo(o ny1amt  fvsasf rur(mono1tetn o3tasls2eln o;(0trtniocootoatrlivo;t0 rtr(o no1optelieslt  Dtm(mpoo0olt mi3iadla2emumsnu0 etnxr3tytomtrlu s;t) euo(mpnu1olenlnetl()sDrru  ou4texnmfctys s2emuvo (4 etnxf ia1fpDr u i t0seumim3ny1lp   nct t) 2tr(mpou1aetniieiysls rmnmont0arerxfcootlm ean o ( texoxopiudopeelnctlsf rtrx ont0tetnifeiysla rln p t0tlxrmr oo1omD  i s;t0 2xmxr3oudap emnvi ()arurur ;t4tee ioeiydls2ulnmo;(4 ltomf iydom elnei s  etoxm3nudaleelncil()arua(mpou0tpeo ietatfa2uaums t0teermfciydoa ranvilt) eumxm nu4llt mfet sfsrtaxmoot0oetnii3tlsfaDua(mp (4aleomf3ia1fpt  ieols srtr(m oodlme  nvta( s2rru  ;u4teeoiietldla umn o t4arxoif oytfm  lu i t  etrirpoudlltnlieslsf ruaxr ot0tpxn fcils m ua(mp;t)altrmr3oa1fptelnvi;() etm(opnu1olt lfciat s2tm(rpnt4teenmf3tls a ul(vpn(4 renxf3iodomtrlues;t) 2to(m3oy1lp emivils sDrmxmpot0tpxnioeiadfmDem(msn(0tltnmr iy1faDrln i;s) 2uo(o io1lmte net s)a2uauro;o0opxoifetlt aDrmn ont4 rxnio io1lmtrai s (  etrir3iudaltelnciat aDtr(monu4apxomiciydfsDelu s (4areoir3ty1op eanvo t)srxmir3nudal nmfvi tfs2um(m ;o1ole iiciytfa2ra( o;t) ltomr tydlat  uvolt0 rtoio3iydlpt lncsat) 2umu poo0alto f3iadls2ul(mp;u0areomo to1fmtr uvs s) eur(r io1op elnciat  rtmuro;u4teto o3iad a ra(vs (0artnxr3to1laD ai i ( s2toiopoy4am emicilt) 2trxrpot1oetnmieiad s2rluvpn(0arxrmf3todomDr u o s) 2trxopiodlmt mfviat)sDtr(rp;o1oet mo3ias aDemn p ()tlxniocoa1fa elnei;s0setoim nu1ol n ictltf Dum(r nt4opeo fciltfaDrl(vp;t)texrir3tytfp eaivi t)sexmio nodalenmnvtas) 2umurpot1olen fetysfa emnvp;u4texrircta1opDr u sl( trtm(m nu4am elfvsl()sDtmx  ;u4aet iiciydlm rmnvsn(0aleomr3oo1laDrluvs;t0trxmxrpiu4oltelieilt  2uaumonu0aetoiietls a ra(mpnt0 rtoxr3oatfpD an o;( t2xoxmpiodlmtelnvi ()srrax pnt1tpxn fetyt aDra( o t4altrxrctydoaDrlues;t)trxm(m ny1lmtelfvi sfarrmxm nt0olxoiictld sDeauvp;t4 etrir iydlmtraneolt)setmio3io1oltn ics (farrrur ou4tptnmfeiysfm rmumpnt0 ltnxocoodlpD lu sl( trur(o oydlmt  nvtl(f 2trumpoo4oexnioetlsla em(vonu)treomfctytfm raueil(  rtrim3iu4oleeliei sfa2ra( p;t0tpen ieiytlaDrmn s;u)aexnio3tydlatrlieo ()trtr(rpou1am  lfcilsfsDrmu  nu0oexo feiys s2emu s;u)aetoxf3totop rln i;s) 2xr(m nodaleemneiasfs2rau ono0opt ioetls a2el(vo t)artrifcty1fa r nvo t trxoxmpnodapt mfeslt s2urxmoot1teenmf3iys a uan s t4 renxfcoatfm eai olt) rxoxm oodll  lfes s srtaxmoot4apxomocilsfmDuanmpnt0aetrif3to1lm eauvol( trto(m oodlmenmnctl(  2tmx  ;t0tptnmietldlm2umn snt0aetrmfcoa1fp ranvols s2uoio3ny1op   fvta(farrmxm no4ape  oeiasfmDuaump u0 ltnifcoydlmDelivols sruo(r iy1ol  liet s) Drmx o;u4olenif3tatlaDranvsn(4 lxoxfcoatlmt  ies s0 etr(opny1lme lfctas s2trurp;t1ope ifctydfa emnms;t0aetrxo iadfmt lieo;s) rtoimpoo4apt lnvilt sDumumooo4tex mieiyd mDrluvs t4 rxnif oo1opteluvilt) 2tr(mpnu1op nlnvs ( srraurp;o0aexnmoctatfa2umu p;(0 eeomr iatomt  neilt0trtrio no4aleemicsas sDur( onu1aeto octat a rmumo () reomfctydfm elieo ( s2tmxo io4lmtnlfvi t) rtrumo;o0optoii3iys s rmuvp;u) lenxf ty1lm   ues ( seur(r oudlme lncils a2umur ;t4olxn ieiytfs2rm(vsn(0trtnircoo1lmtr ues;s0tetoxo oy1oleemfvs s  rrm(moot1apt  ietatla rmnvo u4aetrmr oo1laDe n i t) euoio nydapee ieias arrrurp;o1olx mociatfm2elnms t4alerxfcoodlp e ieilt  etr(mpou4ll nlfvils  rrax  ot0apenmictatls rlumsn(0tetnxo3iotlmD  i ils truo(o3no1oltnmnctls)sDrm(m no0tleoio3iasls2rmuvs;u4 exoifctadfp  an o s)seur(r3oydlltnlncs s aDtaur ot0oltn feiyslm2ra(mpn()tlxnir tydlateaneolt0teurir nydomee nvt ( aDur(mo;u1opx ioeild aDum( p t0 rtoxo3iotom elies (  etmxo iydape  icias)aDtmx p;t0optn f3tltfaDranms;t0 rerifctytfptr ueils)t2umir oy1lmte fetatfarua( o;o0tpen o3tydfa ean o (4 rtnifciytopDrlivi;t0 2toir iu4apenmfvs tfsDuaurp;o4tex mi3iltfm2umuvp;()artrxrcoa1om r nes s0 2urxmpoo4ope lici ()a2um( p;t1apxomfeild s rm( sn(4altrxrciotla  anvi s0t2uoxm3iy1lmtnlncia(  Drrxr nu4tetn iciysfm2elu snt0arerxrcoo1om   n sl(  etm(o3ny4olte fcilt) 2tau  ot4apt mfciytfs2el(vp;u4trxomr3tadomte ivi () rxoxm oydop  lfetls)aDrrx oou0tptomf3tys a uanvp;u0 rxnxrciatoaD  ies;(  etrirpoudol   nvilt) Dtauronu0tee ii3ild a raumo;(4alxrif3iatfa  aies;(0s2xrim nu1lptnmnes (faDtrx  ;t0oetoif3iat aDumn o;t)trtoio3iy1fpDe ieo t seuoxopiy1omeemneiat  2rmxmpnu1ope ii3tydlaDel(mo (0 rxrmr iotla e i ils  2umxmpoydlp  mnei tfarurum nt1olxoioctytlm rl(mo u0artrxfctytlptranvo t) 2xrxrpny4lltnlfvtat s2rmxro;u0optoiictyslsDuanvs (4altnmo3oa1oaD liei;t  eur(o oo1oltnlfeia(fsDrmu  nu1apt mfeildls el(vont) lenxocty1op  auvil(  rto(r nydoltemnet sfs2rm(rono1oee  ietyslaDrl( p u) ltomo io1lmt li s;t0trtmio ou4ll n nesl() 2raxrpnt0aex  fcilsfs2ra(mo;t0aexoxo3tatoat anvols  2uoio no4olte fes t)arrr(rp;o4altnmoeiytls ulu o u4 rxrmocta1opDrlueo;s) 2xo(mpnodomtnmicsa(fsruau o;t4olxnmfctaslaDua( ont4trerxrcoydop eluvi;s  etm(o3iy1alee nvilt aDtmxmp;u1tleoii3iyslmDel(vonu)artomr3oodfmte neo t)texmiopnudlm n icilt)srrmx oot0aetoiiciad m2umnmo ()altrifcio1omDran i;s sexoir iydameemnesl( srrmu p;t0aee mo3iydlaDeluvo (4teenxf3iytoa eanei t0s2uriopoudamte ict s arraxronu1alx mi3tytls uaump u4aeeomf3ia1oa eanvo;( tetrxm iydlmee icslt)srururono0tlt ifciydfa el( ont0teerirciodfatrlivo;s)s2xrirpio1llt  nvsasfartau  ;o1oee ifcilslsDulnvp u0aexnio totfmD auvil(0t2uoxm iu4lptnmici sfsrra(  ot4apt  fctyd sDelnmont0 lenmfcoy1fateli o s0 2umir3oo1alen nviasf rra(r nu1aet  oeiytlm em( s u4 eerxf iodoat  ivi s trtmir ny1opte iesltfaruau p;u0tex  iciatlaDrm(vp t0teeomr3oytoaDr n o s0 2uoxrpoo4omenlfesatfarta( poo4tltoifeils m2rluvp;t0 exoio3iadomDrau sls teto(r3no4ope lnct s)aDrrxr nu0optomf3ias sDra( o;(0 exoxr ta1fpD aieo;t0 exmxo3io1ll n fvils)srua(ro;o1oee mf3iytlm2um( o;u)arxrxf iytomDelu o ( seuoxmpnydape mnet sfs2urxmo;o4oetnmoctyt m ulnms t0aeeoio iatoptr u o;t  eumio3ny4ame lnvtl( srrrxroot4oexoifetysfs rl(vo;(0 exnxr3iotfpDrau il(0s2umirpiudomt lnvt ( sDuru pno1tlen ictytlsDrlnvp;(4alenxo3oadfptr ivi;s  2xmiopnydlpte ncta(fa2raxr ;t4tpe mietad s2rm( o u0tltrxr iydfatrau i ()texoir3iu4op emfvtas)s2umx  ou1ale  iciysfa eauvp;t4 eeoxocoy1la   uei;(0seur(o3nu4apte fvs s)srtau  oo0aeen f3iltfsDuluvs;u) lxnif3tatfat lnvo;()srum(o3io4alen nvslt) rrrx p;u0aet  feildlmDumnvsnt0trtoio3iydlaD li o;(0trtm(r3iy4alt lnvsat)a2umxrpoo4opt mocildfa2um( on()altrircoa1omt ln s (0t2tr(mpou1lm  lfesls a2taumoot4olx if3tatfa2elnmont)tltnir3iydfmDrlueo;(  rtrxr oydal  mivil( sDrmxm oo0opxnioctasls rmn o (4aeermf iotoatraneol(  etmxr3io4lme lfci (farrmxr nt4tpx  oeiydla ul(mo u4aetnxr oydlm ran i;t  rxr(o3oodom n fvsl(  Duax p;o1apxn o3iatfm rau pnt)alxnio3oodfpD au s t0tetmirpno4opeelieiat  Dtax  ;u0ole mo3iatls2el( o t)arxrmr3oodop rauvolt0t2xr(o no4lptelictls)artax pot0oeenmi3iasfa2ea(vsnt0aexnir3oodlateanes;() eto(o nudop elfcsa()aDuru  no1oltn fciasfs ran o;(4treoxf oytlp  auei s)s2tmxopoy4opt lfci (  2truroou0tlt  fetlt aDrlu on(0tetnmr tydlmt aues;()srxrimpoy4optnlnvslt  2tr(m ou4ope ifetyt mDraums t0alenxf3tytfp rluvo;s) 2xoim3oodom nmfes sf 2raxm oo1aptomieiat mDea(vs;u0artrif oodfp r uvs;t0 rxoxm iu4ap n ncil()arrmxmoou0aeeoioeiyt a2el(mpn(0 eerxocoa1faDr ues (0t2umxopny1ap n ncsa(fartm(ro;u1aptoio3ilsfaDeauvsnu)trtriocto1lpt  ieils0tetrxrpou1al elfvia(f Drrur nu4oetoio3tas aDulnvpnt4altnmrcoatlptrluvi;(  etmiopiudomenmnetasfs2ur(ro;u4tlxoiieias aDuau o;(4texrmo ta1fa ran i;t) rxoxo ou4op  mfesasfsDraum oo1ope mieiydfaDrauvs;()texrmfcoytopD luei;t  exmxm oy1ope lnet sf 2urx  nu4opeoioctaslm2elumo t) ltrmoctydomDe iei;t0 2uoxm iy1optemiei s) Duax  ;t0opeo oetysfmDeanmonu4texnmr3iadopteau i (  rur(o3nydome mfvtat sDtaurooo4olxoio3iys mDel( sn(4altrmf3oytopte uvi (0 2tm(o iydlm e icsls  rtrxmono1ope ii3iltlsDuaums;u) lenxrcootopDr ieslt0 rxoio3ou1lmtnlictat s2uaxrpnu4texo ietytfa2el(vs t4aexrmfctadomDraneo (0setmir ou1olt lnvtls sDurxr oo0aetomoctadls elu o;(0artrircoydlpt lueo;() etr(opio4llen nvsltfsDumxrp;o0tex moeiatfm2emnmp t0trtrxfcoy1op rli sl()truoir3nydopte ivs ( sDurum ou0oltnioetlt m2raumo (4 etnmo oa1op rlneslt  eurir3oo4lp e icsa(farumx p;o1teeomictys s2rmumsn(4 rxnxoctodlm e nes s)tetr(opny1op emfet s)a2taxroou4tlxnmfcilslmDulnvp u4aexomo3oytlaDranes (0truo(o no4lmtnlnvsltf Duaxrp;o0tetnmfciasfm rln snt4 lenmocoy1oa e uvilt sexrim oo1amt  ivi s)a2rax ooo0apt  ociadfm2ra( s;() eerxf io1latran o;t)truoxr iudaltelfeta()srtm(mpnu1ole miciasla rmuvp t0tetoiocta1oatrai o;( teurxm oodapeelfesa(faDrr( onu1tlxn o3tytla rm( sn() lerxf3iadop raues s0trxm(r3iydlmenlnesltfarua(ro;o1texoio3tls a2uan o (4alermf3totoatrluei s t2ur(o3iy4lmeelfcsls)sDta(mont1opxn f3tatfm eanvp;t4trtnmfcia1fm  au ol() 2uoim3nodlme  ieils)s2urx pot1teeniociad s2ean p;(4arxoirciadlm  liesls  eum(mpoudll nlnctl( a2umxm oo4tlt ioeildfaDemnvp u) renir iatoaD liei;(  euoxopou1omte nct ( a2ta(m ot1apeomfciadlaDeauvp u) etrmf3totfaDe i i;(  rur(o3oudlmee ietls srtmurono0aexo ociaslm ul(ms;(0trenmrcoytfa rlnvs;t) rxo(mpiu1lpee fesat sDrrx  nt0tptn fcils s raumo u4arerio3ootlpt livilt truoxrpoo1am e nct s)srumuro;o0olt io3tadfa um( on() rtnxf tydlp ran olt0srumxr3nu1lp nlivi s srtrx pou1alt ii3iyd mDua(mp;t0tlxnir3ia1la   nvslt0t2uoxrpoydapee fcs s) 2raxm ot1apeomfctadls2umuvpnu) rxnxfcty1oat  ues s) 2xrirpiy4lmen ivt tfarua(m nt4olxoif3ildfsDem( pnu4tlerxr3ia1op r uei (  eto(m3oy1omt mfeta(fa2tm(rpnu0alxo ietyd s2raump;t4trtrxo3iydlptean s;t)srumim ou4ap  mnvilsfa2tm(m ;o4opeomo3ils s2emu s;t0aeerxo oodfmDeai s;(0 2xmir3iydlmtnlnvt s) Dtmx ono0opeomociat aDum(mo (4 rxrxo3ootlptelnvo;t0t2xoxopiu4lmtemneiasfa2um(monu1altomieiad sDel(mp;u0aeerifctydlp  lues;t0texm(o3iu4omtnlnes t artmx pnt4alt  i3iaslsDel( s;u4teeoxo iy1lmDeaueo (  euoxmpou1open ivslt)a2ra(  ;u0tpe  fcilt s uau p;u0aeenxr3oydlp eaies (  etmim nodal   ici s srumum nu0optn o3iyt mDea(mo;t0 rermfciytomDr uvi t0sexoxmpoydol  lneslsfsDrrurpnt1teeo fctaslm rm( o t4tetrmr oydla raieils  etoir3io1lm nlnet t  Duax o;u1tpen i3tytla ea( onu) ltnxocto1lat ai s;t)teurxo3nodol   fesltfsDtmx oot1tetnmocildfs ul(vsnt) ltrirctydfaDe uesls tetmio no4aptn nvsas) Duaxr ot1tpt ifcilsls2rmnvp;u0tltoif iodfmDeauvil() etoxr3no1lmtemneia( srtm(r ;o4alx  oeilsfsDel(vp (4 renxo iotom  lueol(0seurxr iu1opte nei s)sDrm(m ot0aexniieiydfa em( pnu)aleoxf totfatraieols0seum(rpou1ll n iviasf rtm(mooo4opeoio3ildla ra( p;u4aeeoio3ia1lpteliei;s trxrxo3io4apt mnvia( s2ua(m nu4olxoifctyd a eau pnu4teerif3ty1fmDeaieo t0t2umiopno1ol e ivil()sDuaumo;u4oleoiocilsfaDem(vpnt)tltoif3oatop e n o;() 2toxopnodlm nmfcsltf 2ta( poo4apt  f3iytfs2rlnvp;t)teeoir iadlp  luvo ( sexm(mpou4ameemnvsa() rtru o;t0tlenmf3iadlsDua(vo;t4 lermo iotomtr uvslt texmim3nydopt lfctlsfartmxmo;o1opxomi3iad sDelnvp;() rtrmo iodoaDr u s;t  2xrxrpoy4ole mnviasfsDtrumooo4oet iicild mDel(mo (4 renxf3iytoat  ueslt) 2xrxmpio4om nmictat  rumxmpnt1tptnmf3iat s2ul(ms;t0alerxr tadop elu i;s teumxopnudlmtemfcsl()s2truro;u1aptnmo3tadfm rl(ms;t)tltrxfctadlpDrlnei t  2trim3ny4om  lnesltfs2um( ono0oleoioeias m2ea(vp;(0tltrxo3ta1op eau s;t)t2toxr3iydoleemneslt aDuru pnt1ole mf3iydlm rln p;u4tltomrcoy1fp   ies;s0seurxo3oydllenlivils  2tm( ooo4aeeoiieiys m2rl( s;u4artrxf totoat  ies;t0 eumxr ny4olt  fvilsfsDrr(rp;t0ole  i3tytfsDemuvp u4tetrio3iatla r n o;s seur(opiu4apeelnvsat)aDumu  ot0altoiictadfs rmnmpnt)artnxrciotlm  liei;s0 2uoimpoudlme micsl( arrrxmpou1oltn oeiat sDrm( ont4 etnxr3iodopDeau i s0 etr(opou4apt  fei tfs2rm( p;o0teeniiciatfmDrmuvsn(0aetrxoctydfp  luesls t2xm(r3iy1ope mfvt (f 2ta(mono0alxnmictltfsDuanmo;u) ltnxr to1lpD aues s)setoir3iu1lmeemncsatf 2tr(m ou4ale mi3tytfs rm(mpn(4alxoircoadlp   ivsls)s2trxmpoydap elncsas)srrau pno1oeeoioeiadfmDrm(vsnt0tltrxf3tytoa raneilt srxoio3oydll elfetlt  2rmxm ;t1oeeo i3iaslaDul(ms;t)alenmfctydlmDr nvslt teuoir oodopenmivsasfaDra(rooo1tpeoif3iasfa rm( p () ltoxr oodfmDrluvo;t)t2tmir nydom   fci s artaumonu4tex  f3ilslm rlu o;t)arenxfcootlptrlu i;t) rxm(mpnydlltn nes (  2tmur ou4tpxn o3tltfaDrm(mp t4tetomf todfat  ieo;t  rtoir nydolen ncil()aDurx  ot0oex  f3tatls emu s () lxoxf oa1fate ueilt truoir oy4apenlfetl(  2tmxm no4oetn f3tyslm2ulnmpn() etoxo3ia1opt an olt)s2xoir3iy4om nlivtatf rua(mooo1aexnifeild a ulnvont)tlxrmo3ta1op eaueils t2uo(mpiodomeelivt s)s2tm(rpoo0opt ioeild m em( snu0 reoxr3tytomDrauei ()trurxo ou4lmte fcilt) 2ua( p;t1texomoetlsfa um( o (4 eerio3iydfp eauei s0t2uo(mpnydam n icsl(  2tmu p;o4tpto feiysls em(mp t)tltnmrcoytfmte neo;t)t2xm(o oo1al nlicsatf rrr(r ou0teeoifciydfa uan onu) rxnxr iytfa elivi;( tetmim3oy4altemfesl(  Dta( pnt4ale ioetydfm2ea(vs;t0treomfctodom  lu i;(  etr(o3ou1am elfci (fs2uau ont1aetniieilsfm2umnms;t4 eenif ta1fpt  nei s)trxr(m3ny1ope  nvsl(fsrta(mooo1texoifetysfm rauvpnu)altrxf3oo1lmte uvo;t0trtriopiydlptnmnvt s)arrm(mpoo1aexn octldlm ulnmo (4trenxf3todlm ranvs;()texo(r io1op nmiesas)a2uau poo4tlxnmfeildlmDem(vs t4 exnxo oo1lm  ai o t) rum(r ny1optn fctl(fsDtmxrpno0apxnmfciys a2eau p u0 rerif3ia1fptr neol( trtm(m3iy1llenmieil(fs2uaur nt4oex ifetyd sDem( onu4teermfcoadfat lneslt0 eumxo iudomee ietltf Dtmxmpoo4aptn ieias mDemums;t0 renif io1lptean o s  exmxopno4lm e ivt s artrxmp;t4ale ifeiatlaDeau snu0aetnirctydlmDelnvo;s s2xr(o3iudopenmfvtl( s2rr(mo;u0tptnio3iys a rl( p;t4 etrxo ootfp rauei;s0trxmimpoudopee ncsas)s2uauronu0oex mo3tas aDul(ms;() rtrir3totla rauvs t)t2trxmpoudopen neil(fs2taxrp;u4oeeomf3tldlsDumums u0aetnmr3iydlp eanes;()trxmxrpny1apt mici t) rraxmoot0oexnmfciytls elums;t4aexoxr iotom raues s s2toxmpiy1llt lnesat)s2trx  ;o1tpe ii3tlslmDeanmonu0 lxnxf3iy1lp rlueo;(  exmxr3iu1lptnmfesatfarua( o;o0optnmieiadfaDemu o;(4 rtnmociytfm  au s;t)seuoiopiy1am nlfvtat srta( p;t4tet  fetyd s2rlnvpnu4 lenxociodfate neo;t t2tr(m3oudaleeliet t) rtrumo;o1tlt io3tls a ea(ms u) rtniocoytla e i o s trtoimpio4ameelfcilt)srrm( poo0alxn iciysls2elu pnu) etrxrctydomD lu o t)srumimpnudap n fvi (  rur(rpnu4aexnmieiytlm um( o u4artoxf to1lmDelu o;() exoxr oodopt lfvs t s2trx  no0teeniicils aDulu sn()aeerir3to1lmDrlieo t)t2xrxm iy4amenmfcsa()aDum(rpoo1ole ii3ildla ea( o;t0texnmr oa1laDr ieo t)texr(opoy4amtemfeta()aruru p;u4olxomfeiytls raumont) rxrxoctytlp e nei;s) rxm(rpou1aptelncta(faDtrumpno4apxn o3taslm uanmp;(4 ltnircoydoa rai s;s) etm(m iydom  livias a2tmxro;o1olxnioetltfs2eau o;(0arxnmoctytlaDeaivs s)setoxo nydllt mnctlt  Drr(mo;o4texnifeiyslm2raumpnu4artrif oodlm rli s;t) 2xrim no4lp nmnctas)sruaxmo;t4aetn octas aDemums u4trenio tadlp eaneil(  2tm(opnu1lmen icia( a2rmur nu0olenii3iat a em(msnt) eenif3oa1fpDe neo t)teumxr3no1oltemfvsasf rrrump;o0alxoiieiadfs2ranmp;()trxnircoatomt  iei (0 rurim3oy4omte nct t)aDraxmpno4tet mfeiysla rlu s;t4altoxo3iadlptrlnes;(  exo(o io4lp   fctl( srtrxrp;t0oetomictat s uan onu)tetniociotla rln slt)teuoxopio4apeelneils s2rr(  ot4altomiciad a2rmnvp u4 lerxr oytop r i olt)s2toxo3iydolenmnesa( srtrx ono0oet mociaslmDuaumon(4aexomo oa1lm r nesl(  rum(r3nydlmenlneias  Dra(mo;o1oeenmo3iytls2emn ont)teeoio3iotomt au i;s)trtoir nu1lptnlietl(faDraxmont1alt  ieiydfmDeluvo u0 rxrxrctydlm   uvslt) rxmimpiu4om e ictatfa2tm(ro;t1texnifcils s2rl( o;(4 rtoxo ia1fpt aneo s teumim oodomtelnctlsf Dur(rooo4olenifcild aDra( o (0areomfcoa1late i i;()seurir3iodlmen iciat)arrr(  oo0tle  feiadfa ea( p t0 ltomo iatlp   uvi;t0trtr(opoodom elfet t)a2uaump;t0tlto i3iydla2um( p;u)altrio3totoaD an ol(  rtrxo nudaptemnvi tfaDra(mo;o1ape if3iad sDua(mo;(4tlxoxr oatfpD livs;t0tetr(rpiudalen nvs s) rumx  ot4tpxoiociysls rau p;u) exniocty1lmtrln s s0t2trirpoo4apt lfeias aDtm(m oo1aeenmfeildlm ulnvsnu) etnmf iodopte n s s) 2umio oydam  lfciasf rtmx  ;t0teeo feilt mDemuvp;t) lenxr3to1la e i s s)s2tmirpiudlp n nctls) 2um(ronu0olt  i3ils s2eanvp;u0tltnmf oadlaD anvolt  rxrir ou4ap elfvsat  rtrxrpno1olx  oeiyd aDum(von(0aetoirctodom  an s s0sruo(o3iu4ape mnctlt s2um(r ou0aee ifetasfm2uan snu4aleoxo io1fpt aneo t0seuo(m ou4am emiesltfaDtr(moot0aee io3iyt s2elumo;u0tetrmr oa1fmt liei;s)s2xo(r3iudap n neil(f Drr(mo;t0opxnifetyslm rl(msnu) reomrcty1fptr i o;s) etrir3nu1llt  ncia()artr(mpnu0oltoio3iltfm eau o u0tetrmfcoa1oa r nei;s0truriopoo4ll nmncsa( s2uru  nu0oee miciad s em(mpnu0aetoxr3iadfptr ueo;(0s2xoxr oo1opeemneslsf Drru  ;t1opx  feiadfaDra(vs;u4aexnioctatlmtrlnvo (0seuoxm3iu4opeelfesltfsrum(rpnu1oltniieias a2ran p t4tetoio oydlaDeauvi;() 2toim nu1apee feil(  Drmxrp;o0aetnmieias m ulnvs;(0aetoxr3oydoa eau i;()tetoxo nodlm emivt ()aDrmxmo;o1apto oetytlm2eauvo;u) etrmocty1op e i o t t2ur(o3ny4ll nmieta()arumxrono0apxn fctlsfaDua(vo;t4 rxrxfctadlpteaieo;t)t2tr(o3ny4ame lfcsat)srrr(mp;o4aeenifetat s2rl( o ()trtriociytfp rai o () rum(mpiodop n nes (fs2ra( p;u4altoio3tlt s2rl( p () rtrmo todlm  aivsls  eur(opoydll elfcsls)s2rmuroou0tltnmieiyt sDem( o;t) rxnir iydfm ran o;s)srxr(m3iy4lpenmfvsls) Drru p;t0tetn i3iat aDrlnvp;t0alerio ia1laD  nvo;(0 2xr(mpoydoleelnvt s  Dumx  ot4tlxn f3ildfm2uanvs;()artoxrciadlp r nvi;( srxmxopio4openlnvsls s2rrxrp;u1apeoifeils a emu p t4aleoio3oo1laDelnvolt0srxoxm ny4aptelnvi t)a2taxr ;t0opt ii3iltfaDuau sn(0tetoif3tytfa ranes t)setmimpnudlltemnetas)sDraurono4tlxo f3iat a elnvo u4tleoxrcia1fp eauvs;s t2uoxm nudaltn ietas)a2rrxmont4oleo o3iyd sDrau s;() rtrxf3todoatr ieo s) etrio oodom  livi (  Dra(rpou1aexnmictytlmDrlnvpn(0alxomr3iy1omDelueols tetr(m oo1lmtelivta( aDuaxr nu4aptnmieiasls uanms u4tlerir iadlaDe ivs;t0trur(m3iy1al   fct tfaDrm( pnt0aet iieild s rl(vo;t0 rtrmocoodomtr uvslt)teumir3nudam emnvsasfsDrr( pou1oee  ietls mDeauvon(0aexnxr3iytomte uvs;(  etrxr3nodaptn nvi sfs2uaur ou1altoiicils aDrm( p (4 ltomo3oa1fateli i ( teuo(rpou4lpt lfei tf rtau o;o1apxnii3iyslaDem( snu)trxnir3tydfaDrai ils)sexm(m oodomtnmicilsfarurxmpou1teeomi3tls aDeanvo () rxrmr3oy1oa r uvsl(0srxriopiy4lp  lfetasfsDua(rpoo1oeenmo3tasfs ulnmp;t0aetnmr oydlat au o (0teuo(m ou4openmncs ( s2um(rono4tle iiciatfa2ua(vsnt4 eeomf oytfm e nes;t t2uo(opiydlpe micils  Drr(rpnu1tpen f3iytfsDumumsnu0artnifctotoatr uei;s t2xrio3nu1opee fesat) rrr(ro;u4texn fcilsfaDumnmpnt4tlxnxr ootoaDran sl()s2xoxm3oo1lp elncs (f 2ua(  ;u4aee  fciadfm umn p;t0arerifcta1opteanvo;s srtr(rpou1lpt mfvslsfarrr(r ;u0tlxnmfctlsls2rmnmpnt)artomr oodomDelies;()s2xr(rpou4oltn nesasfs2tm(mooo0texniocildfa uluvs u4 eenio tadoaDean s ( sexoxm3oo4ap   fcsasf rrm(r ot0tet mfetyt s eau s;t)trenxfciydfp rlnvi;t s2umio iu1ll nmfct s)artm(ront0optnmo3tatlaDul(vo u4tlxrxrctotlmtrluvo;s)s2to(opiy1apeelfcsls a2umxm ou1aleoifcildla2uanvon()aexrmocoydla r ivol(0sexoir3iu1amtnmnviat arraxm ot1aeenifctlsfm ea(mp (4 lenmf oa1lptean o;s)s2tr(o3oodllen nei sf ruaumpou1oleomoeiydfm2em( o;(4alerif3ia1omDelieo;(0trtmxr3iy4oleemfct s) 2rm(m ;o0alxnio3ilt sDumuvp t)tlxrio3iytlaD lieslt) rxmxm nu4aptnmfesls) Drrumpnt4apx ioctasfa2raumsnt4trerxr3iodfaDrli ol( setrxm3ou4llt livi s a2rmx pno1olxnmociltls2emu s;(0 ltnxr3ty1fp  li i;s)texmio3iu4am e fvias)s2ururpot0ole moeiysla ul(mp t)trxrmo3oydlmDrlnvi t  2xrxr3nudamt  nvi sfarrrxm ;u4oltnioeiytfm2uln pnt)trxrmocia1fm   uvols)srtmio iudllee fctlsfsDuru p;t1aex ioeiad s2ra(mp u0arenmr3iydomtr u s (0tetoxo nu4aptemfesls) Duaum ot4oeeomoeiatlaDum(vp t0 lxrxrcia1lmD aneslt0 euriopnu4lm   ict t aDtmxm oo0tptomoctas m em( o;(4 eerio oa1lpte uvi t)setm(o io1op   ivt () 2rmumpou4alt  fcildfm rmnmpn(0areomr iatla eluvol( t2uriopnudlpt lfcsls srtmumo;o1tpt mfcils sDuaumpnu0tlenmrctodfptrlueo s trxr(o oudal nmfcslt)arrmump;o0olenioetldlaDemnmp t4 rxrmociotlpDe ivo;s)s2toxmpoo1al  miet t) Drmxmoot0tptomfcild m2um(vp u4 eenif oadom rlnvo s0s2umio3oo1oleelncilsfs2tmum ;t0opt  octls mDuau s;u4tltomfcootopDeauvils  2xmxrpou1apee nes (faDta(ront4oeeoif3ilsfs2rau o u0 lerxf iytlpDeluvil(0sexrxm nu1om  liviat sDur(rpnt1apen i3tltla emump t)teermrctadfpDelnvo;t0sexoxr oo1amt mnet ()s2tr(mo;u1tptniictas sDea(mp u0 rermociytlm eluvsl()texm(m3oy1omt lfci (faDrmx p;t0tetnmieiydla eauvp (4 lxnmrcoo1oaDrlieolt)s2toim3ny4oleemnvtl()s2rax  ou1oex  feias aDem(msnu4texnmo3ia1oaD lieo;(  euoxr3nudapenmnvt tfs2rm( pou1alxomi3iys aDemn pnt)tlerxf iatlaDeai s (0srum(o3iy4altelnvtlsf Dtr(mpnu0olxo ocild s2ua(vp;(4 exnmfciytfpDeli s t0t2xo(opnu4am elfci ()s2ta(rpno0aetomieilt m uauvpn() ltnmrcoytfp ean i;t0 exoxm oudll e icia()aDtmxm nt0olxoiictadlm rl(mo (4 etrio ty1fat anvs;s trtrxo3nu1am  mncs () 2umumpnu4open ietatfmDrmuvp;u0 lenxf3oadla e ivo;t0 2to(mpiudlltelfcsl()aDrruroou4tlt ii3iat s2rmn s (0teerif oa1fm  lieols srxo(rpnu4llt mnes t) rum(rpot1optn oeiys s umumo;t)treomr3tytfaDr ivo;s t2trir nu1apenmnciatfa2tr( p;o1oet ifetaslsDuan s ()altnmf3oa1fat luvol(  2xmirpio4llenmnvsl(  2rr(r ;u4tle miciys a2eln o u0arenio3oa1fa rlieil(0srxoxo io1oltnlictlt  2urx o;t0olt ifciatfmDuauvpnt)tetrxo to1faD  ies;( srto(opnodalt  fcias) 2umxmpoo4alx ifciaslm raumsn() lenif3oydlpD an ols seuo(o nydoltnmncsltfa2rm(m ;u0olxomf3tltlsDel(vpn()trxnmrctytlpD ai s;s)sexo(r3oo4lpt mict (fartr(rpou0alxnmo3ilt aDrlu s;u4 exrxo3ta1oatelivs;()srtr(r nydal e neia()artm(ronu1tlen fcilsfa ea(mp () rtoxf3oy1laDraieo s  2xmxrpiy1olt  fei t)aDuaumpnu4tetnmocils m umnms t4artrif to1fp  ln i;s  rxmiopnodapte neiatfaDtaxmpnu4aleomf3iat a2emu p t) rtoir3oydlmDe u il( truoxmpio4altnmnvs s) 2tmxm oo0opxomoetadfs ra( p u4 renxfctatfp   i ols srtr(r3ny4al elfci (f rumu o;t0aetoifctas s rm(ms;(0tlxrxo3iy1fpt lneols)trurir3oydop e ivslsfsDrmx pot0apxo i3tls a2ulu p (0altnxo ia1oa r ivsls  2xrxopoy4alee neta() Dtrx  ot4oet iiciltfm ulnmo ()arxomrcio1omDe ivi;s)teum(opoo4lp elivtls aDtax  oo1opxomf3taslaDemn o u0aexnifcto1la elivs;(0trto(rpiu4lpe lnetat)aDtm( pnt0tlx miciatlmDulnvo (0 rtnmociytoat lies t0trumxm3no1ol nmnviat) Duaxr ou0oltnmocild a em( o;t0 eeoxfcio1lpD au o s tetrio3ou1om nlnct t arua(rooo1teeo f3ildlm rmumonu4aleomr3totoa rli s;s0 2xo(m3oy1om emnesa( s2ta(m ;u1tpenif3ild mDeln pn(4 lxomr ta1laDrlivilt)trxr(o3ou4am  lneilt)aDur(r ;t4texnif3iad mDemuvon(4arenmf3todoaDe i ils)texrio3iudal  lncils)srtaxm no0opeo ieiatlmDel(mo t4aeeoxrciadlp r nes s0 2xmxopiy4omt mivtlt a2um(mpnu4tet iiciytfa elumpn() renmf iydfa rau o (0seumir oudaltnlfvs t  2rr(r nu1oexnmicild mDrmuvo t0trxnxocoydlm  aivo;t0 rum(r iu1op nmncsl( aDuau pou1aetn octad sDrmuvsn()alenxfcoatfaDraiei;s trtm(opio4al   ncta()sDtaxmpoo0aexnifciysfa2uan o;u4artnmf3ty1op r ieo t0srtoxr3io4ome mfctat)srtaxmonu0texoii3tas m ul(vpn()texomo oy1fateaueol()trxoir iodoptemnvsl() rrmu pnt0oeenmf3tlt s em(vs;u0 eeomr iy1laD an i t0 rumir iu4aleemnet ()sDua(r ;t0oeeoiocildfaDrmuvo t4tetrxociydfpD lies s t2to(m iu1optn fesl(  rrmx ont0oltnif3iltlaDulnmo ()altnio3ia1lpt  u i s setm(o ou4am elfetl(fa2ta( p;u4aexnmfctytlsDeln o;() ltrxo3iadfpD aivi ( sexo(o3nu1ape  fvsls) Dtm(rp;o4tpx  ictlt a2umuvon(0tlxomfcoo1lmDeaiei t0 eurxr no1lleemicsa()sDtrxmoou0tpto iciyd s2rmnvon(4teeoif3oatlpD  n ilt) eto(o3nydlle  fcsas aDrax oot4alxnmfeiydfsDrau o;()trtrir3ta1oatrau o;t) 2xoio nu4lm  micils arrm(m nu0tlx ioetls sDemu o;u)trermo oodoatrlneols0srxriopou4om n ieils)s2taxront4tle iiciytlm rmn s;u)altrmo oy1fm ranes;()srtrim iodlltn nesatf 2ra(m ot1tleoif3iasfaDrl( o;t)aeenmocoodfm eaieilt  2urxrpno1ol   nvi () 2taxr ot1apxoii3ildfa2umumpn(4 etrio3oydomD aueslt0 rxr(r3nu4ll nlnvtat)a2tr(  ou1oexomfciysfs2uaump t0 rtrmrciatlpt aivo t srxmir3ny1al n ivsat)sDtruroot4teto i3tad s2emumon(0 reomr oy1fa   u o;s srxrimpoydomtelfvi t)srum(rpnu4olen ieilt a2uaumpn(0 lerxocoydla elu s t srtr(r3oo4omtnmivsas) 2tr( pnu4altoioeiasfs2rl( p;()texnxr ty1omte iei s)sruoiopny1ameelncs s)srtaxmo;t4tpto f3iatlaDra(vsn(4aetoiocootlm  aiei;(0setoxo ou4alte fvsat) rra( pot4olto ieiyd aDel(vpnt0trtomr3tytfaDeln il(0t2urxm3no4ome mfcs () 2umur oo0tpeoii3ildlaDea(von()arxoxf ia1fmDrliei;s t2to(o3iu4lleelnct (  2raxro;o4alt iieiydlaDuanms;u0artrxo3to1lpt  ieolt0sexm(mpno4om elfei tf rua(mpnt4aeen fciys aDel( s t0teenircoa1opDeai olt0 2trxm3ou1lptemfcslsfarrax p;o4aex  ieildfaDumums;u)aeermr totfp e uvolt trxm(o3io4am elnesl(fsrrau  oo4tex  o3ildfm2ul(vs t0teenxrcoydlm   iesls)teur(r3oy4lpeemivs t)a2rru pno1olx micilt m2uanvo (0alxrmf ty1latrluesls0srxm(opio1alte nesls  Drm(mpot1apeomfciadfa ranmp u0treoio3todfateauei;s setrxmpiy1amen fes sf 2tr( pou4aptnioeiaslsDumu o t) eeomr iydfmDelu ol(0s2umxm3iydamt lnvs (fsrtm(mp;u4texnii3iytlmDrmnmo u) lxoir3ta1om elieils)trurxmpny4lltn ivia() 2umxrpnt1altnmo3iltls2rmnmp;(0 eeriocoydlpD  nes ( s2to(mpno4al n nvslsfaDtrxm ;u4alen o3tyd sDemnvs t0trxomf todoatr nvilt  ruoir oy1apeemfvsas)srtaurpou0apeo ieils a uanmsnt) etrio3ta1op  aueilt s2uo(opoy4lltelnctls)artm(m nt4apt mociys a rmnvs;(4arerxf3iadfm eau olt) rurirpio1openlici t  2urxr no1tex iiciasfmDeluvsn(4 exrxo ty1lmt anvi;() exmir oudll  lict sf Dur(mpou0opxoif3tydfa rlumo t4aetrmrciy1omte ieil() 2ur(o iy4ole lictat)s2umurono0tptnmo3tltfa2uln s t0teeomr3oodom elivilt0t2xmxmpnudlmte iei sfs2rruro;t4apxniieiyt sDrl(vp u4tlxrmf3ty1fmtranei (0 rur(o3nu4amt  ivi ( srrrxmo;o0teenifeiatfs ua( pnt4aetoxfciy1omteaneo;s0teur(o3iydll   ics t)artaum nt0oeeo oetlsfa2uauvs u)alerxr3oodfp  an s;(0s2uoxr3iy4alt lfvt s srraxmo;u0apt mfciatfs um(vo (4 exrir3oodfa elivs ()t2xmxr3iu1op elivsls  2taxmpnu1apt iieiydla2umnvo;u) renmfcia1lmtr nei;t0 2tm(mpnu4om nlncils)a2rru ooo1apeo fcild m2rmnvo (4aeeoxr3iytomtrluvs (0sruriopiy1lltnlfvias) 2rax oot1tleo octas sDum(vs;t0alxriocoytomDelies t)srxo(mpoodlm nlict tfa2tm( pot4olxnioeiasls uau s (0tltnmf3ta1oa  lies t) etrir oodlmtelfcsas  rtr( pnu1tetoioeiydlaDelu s;t0trxnxo tydfat luvs;s) 2xm(m no1op e feils)aDrrum ;o4oee ioctadlmDuanvo;t) leoxo3ta1oatrluvi (  rxoio3ou4om  mietasfsDrmx ono0olxn f3iytlaDuanmo;u4areoif3oydlm   neo;t setmxr3io4aptnmfcsltf Drm(moou0aetnifciatfmDea( snt4teeomr totopt anei (  2tr(rpoy4oltnlivilsfsDrrumono0aeeo octldlaDumu s (4 renmo3ootfpDraies;t0teur(m3iudam n icsls  rtm(r nu1oetomociat sDemnmpn(4tleriociadlmD lu ils0setoim3nydlltnmnct s) rrmu  nu1alxn oeiydfs2em( o u0arxrxr oy1faDeaivs t  ruoirpnudal nlfeilt  Drmu pou1tex  fcils s rmnvs;t)texrmfcty1fptrau il()s2toirpoudoptnlicia( a2rmumo;t1texomo3tasfm2eauvon()arxomfctadoate u s () etr(o no4lmeelfvtlsf rrax p;t0apen f3iys s em(vpn(0trxrir3iytopt  u ol(0s2tm(m iudap n ncsl(f 2uaumpno4tpxomieiyd sDeanvo (4tetomf to1oate n i ()s2umxo oo4opeemici s)s2ururonu1olxnmi3tad mDemnvs;() etniociodfaD li ol()setm(opno1amenmnet t  Drrx  ot1ope  ociasla uaump;(4trenxocta1op r n i;t) exoxo oy1am   ivi s) rtaum ;t0olx ifciyt a eanmpnt0trtnmf oytfmDe n sl()srtoir3oy4lmtnmnetatfa2rruront1olxomf3tltfsDrlnmp;()tltnir oodopt luvi;t) 2um(o iudapt lnctas) 2rmum oo1opeo fciltla eln s t4 exrio tytfm   ivi t0srtrir oy1op elfcs (  Drm(mp;t1aet mf3ils mDumnvo u)trenir iytlmD lies t0 exo(rpoodlptemiet ( srum(rpou4alxoii3tls m eau s t)aetnxo3io1fpDe i o;s0srtmio3oydal nmieiatfa2rrxrono0tpe miciaslm ea(monu0 rtomo3ia1lpt livils trur(opoo1op emivs s artaxmono1tpxnio3iyd a2rauvs t0tlerxf iytoatrlnesls0 2toxmpiudalenmivs (  Dtmxr ;u1apeoiiciytfs uln s;u4arerxfctydoptelieo;t  2urirpoudll n ieil(fsDraxmpot0alt  oetytls2rlnmp;(4aeeoxo3iydlmDeanei;s) 2toxm3io1om emics sf Dururpnt0opx iieild aDuluvpnu4 lermo iatlaDraueilt  2toir3ou1olenmfvtl()aDtm(m nu4ope ii3iat a2eln p t4trtnio tatlpt lueols0s2xr(opou1ope mfvtlt sDtaumoou1tlxnii3iltls2rmnvs;(4 lxrmrciytlaDeau s;(  eum(mpny1lleelfeilsfaDrr(mpot1aptnifcild mDel( s (4teenxo3to1fatraiei ()tetmirpny1optn ncs t  2ua(mo;u0ope ii3tldfs2emuvo;t0 ltnmr ootomDe uesl( seumxrpoy1llt lnvsl()sDumxroou4oetnioctld a2eluvo (4tlxrmf tadfp eli ols)s2toiopiy4op elicsat)sDta(mo;u4oleo i3ilslmDum( ont4tlxomfciytfm eaivil()srtrxmpiydolte icils)s2uauro;u4altniietytls2ra( on(4aetomr3oodfm  lieols0seuoxr nydlptn iet ( aruaxr ;u0texo ietad s rlnvo (4treoif io1laDr ues;t  2xmxm3nudlmenmnvi ( arumumono1altoifciydlm rmums (0 leomr3oo1opt  ueo t0 exoxmpoo1lptemics sfs2rau poo4apto i3iytfm2rmn pnt)trtnxr3oo1fp e nei;()srurxr iu1lptn iet sfsrta(r ot0aeenmieilsfs rlu p t)trtrmrcoydfp raieo ()sexrxr3nu1omtemnci tfa2ur(mpnu1oeto feiydfm rlu s;(4 exnxo3iotlptrlues;()s2xoxrpnudape licia() 2tax  nt0oex io3iad s2eaumsnu)tlxomo totopte uei (0 2urxrpoy1ope liesat)sDrmx ont0openmfciydfm em(ms ()aetnxo3iytop r ueo;() 2ur(r3nydllt lnvtl( a2rau pnt1apeomieiydlm2rln o () exoxo3iydop eli ols)texr(rpnudapen ivt tfsrrrxrp;u0texomieiyt m2eln pnt4altrxf oadopte nvo s0srxmxr iy4omtelfvs s) Durump;t1tet mfeiyd s2rmnmonu4 rxnxfcia1fmDelnvilt)truo(m3ny1olenlfeiat  ruaxro;o4tpxomfeilt m2ra(mo;t4artnxf iatfmtrau ol(0 rxr(m oy1ole lnetl(faDrrx pou0aexo i3tadfm2uluvsn()aexnmf oytoptrlneilt0 ruriopoodllteliei ()srum(rpno0opxnio3tat mDrm(von(0tetrmo3tytfpt lieolt0trtoxm3iudamt mnvtat) ruaur no4teenii3ilsls ua( sn()tltomrctydlp r ieo s0 exrir no4altemfetl(  rrm(  ;u1tex ii3tadla umump;(4trtoxocia1lp  lies t0 2toxr3nu1olee fvsls)srua(mo;t0aeeoifciltfa ea( p t4tleriociadlmtelieilt) rxoio3io1al  mnei tf 2rrxro;o0alt io3ias sDea(ms;u4tleoir oytlatrai i;s t2xmxr3ny4lm n nctatfsrrau  ;o1aex mfcilt mDrmuvsnt) rermrctydlptr u s;( s2xoxo3oy4op   fcs (fs2raurp;t4tleomieiatfaDraumonu4 rtomociytomD ai ils0sruo(m iy1amtnlicil( sDrru pou1ole  ictltlm2ulnvp u4 renirciytom eli ilt truo(mpnodam e ieilt srrm(rpnt4tet  ociaslmDeau o;(0alxrifctytoa eaivi s)texoimpoydal e fvi ()sDrrx o;u0apeomo3iytlm ulu o t4 renmf iytoa ean s (0 2urirpiodol nlies s)a2um(rpoo0aexnmieiadfa2ra(vp u4tltomo3iatlpDr nesls srumxr iu4olen fcilt sDrax oot4tpenmo3ild a rluvpnu0aetnmr ootfpt ai s ( trxoio3oy4lltnlfcia()aDtm(  nt4tlen feildls2umums u0aetnirctytlmD an s s  rxr(m3iu4lpte fcia(fsruru oot0oexoio3iyt a2emnmp (4trxomo3ta1optrau ols0teuoir oy4olee fesls) Dumxm ou4opxomoeiysfs rl(vp t0aleoir iadom elnvslt0srtrxr3iodapenlfesat) Drrurp;o4aeenifeildfs elu o (0teeomf3tadoaDraiei;s trtrxo3nudapte fvils s2rm(rp;o0tlt iietldfa2um( pn() reomf iy1oa elu o;s)s2xmiopoy1ap elfvs t  Drm(  ot0tetoiieiys s2rlums;t4tlxoxfcio1fatelieo s trxr(mpnydope  neil( srrmu  nt1aexn ociysls rlu o;u0tetnmo3iadop   n i s trtmxmpno4amtelncslt a2tr(rono1aetoif3tydlm ran pnt4tlxrxr tadla  aneo;s0s2tm(r3nydom n feiasfaDrmxrpot4texnmo3iydfm2emu o;(4tltoifcio1fa raueolt0trtrimpou4lmee nct ( aDur(m nu1aexnmoeildfs2emuvo;u)arenmr3oodlp   u ol()trumxo iu4olt lncil( s2tmu ooo0openmieiasfsDem(ms (0alermo3oa1fmtr uvi t t2toxr3nodlp n fetas sDrmxro;o1ole moeiatls ra(msnu0 exrxo to1faD lu o s0 etmio3nodllt lnei ()a2tmxmonu1aet  oeilsfaDuln pnt0aeerxr3io1omDrli i t0tetoio nu1am nmict sfsDtmuro;t0apen ociysfm ul(mp;t4 ltomo oo1opt lueo s seurio io4optemfeil( sDtaxm oo4tlt iieiatlm ua( s;u)tleomr3oo1lm r nvol( sexo(o ny1op e fesa(fs2raxrp;u4open o3tytfm el(vs (4aetomf3ty1lm eanei t)t2xrxm3nudlp nlneias srtru ono1ale  ietlslsDumnmo;() rtrmfctatfmte uesls0trurxm iu1am emnci (  rraumoot0aptomfeiyt m2umnms;(4tlxrifciatop rlivs t seuoir3nudop nlfvtl(fa2rrurpnt1olen octldlaDeau p;t0 etomrciotomteli i t0teuoxo3oo4aleemics t)a2rr(mo;u4oee mo3ilsfsDrm(ms;()texoifctodlpD auvol(0 rurio3oo1altnlfvs () rua(r ;u4opxomf3ias s2ua( o u)alxrmo tatlatraues;( sruoxo iy1llenlictatf rtm(mo;u1opto fciad aDrlums t4arxoxf3tytla e ivols seuoim nu4lmeemfvtatf 2uaxr oo4oex mi3iatfs um(vsnt4aetnir iodlatraies s0t2xo(m3oy1omeelics tf rra(rpoo0ope mietysfs2umnvsnu4alxrif3tatopt aneolt  rxrim oodlm nmncta(fsrtrxr nt1oex ii3iyd m umn p;() eenxr tadfmDeaieol(0 etrxrpno4lleemnvt ()srur(rp;u4ape ifetltls ranmp;(0aexnmrciydlptelivi;s)sexrxo ny1aptnlivia(f rtrxront1oltn fcils m um(vpnt)tetnio3oadop eluvsl(0 eumimpnydamt  ivi (faDum(  ou1aetn fcild aDeanvo;u)trtrmr3ia1la  auvol(0trxrxrpiy4am   iei tfaDtruroot0aetomf3iadlm2uaump t0trtnmrciotla e uei;()truoxr iy1amt lfeta() rtmxr ;u4ole  o3iydla rlnvs (4arxrmfctydomte u o ()s2trxopoudoleelfcsltfs2rrxronu0texn i3ildfaDemump t4arxrmo3tydoa e iesls t2urirpnodom e ncsl( a2ur(monu4aleoifcias m2rauvo u0texrmr3todlm   ies;(  rur(o3ou4optnlfcs (f rra(m ot0aeen fetatfm2umn snu0 lxrir iodla rlnvol()trxr(m3io4lpt micsl(fartmu poo4tlen ictytla2ea(vo (0tetnif ta1fa elnvi t s2um(o ou4ll nmfes (fa2uau pot4tpen ociydlsDeaump u0trermr iodlpDrlneils texmxr3ny1lltemfcs sf 2ra(mont0aptoiieiyslaDrl(msnt0alxrifcoodla r n o s)t2uoio3iu4oleemnetl()s2tmxr ;o4tptomoeilt m rm( p;()trtomr iytop e i o;t) 2trxr no1ol  mnesl(fs2ur(  ot4aeeomictldfmDulump;(0trtnxf3oa1oaD an i;t srtmxr io1op nmiet t)aDraumpnt0alxnif3tat s2emuvs () rtnxo3todlptrai i;s0sexm(rpnodlle mfctls  rtr(mooo1alxo i3iyd s2emn o;u4 eermr3oatlpD auei ( trumxr3nodameelnes s) 2rmu  nt4apen ietytla2ua(mpn(4trtniocio1lp  anes ( trurxo iodapt mfvs (  rrrumoot1tpxomictldlmDua( sn(4alenirctotopDeanvo s)texoimpnu1omee ieias sDrrum nu0olt mfciltfsDemuvs;t)aeeoxo tadlpD an slt) eumxmpou4lleelnvtl( aDta(rp;o0tltomo3iydfm ranvp t) leoif3tytfp  au i;t0seurir nodlle mfvia() Dumu  nt0tetomfeiydla2rmn s (0aexomo3iotfpDeai il(0seum(m3oudllt lnei (faDum(mpnu0oexnii3iltls2rmuvonu4trxrxo oa1opteauvi s0 2xo(opio1amt  iesas  rrau p;t4aetn ocias s2eau o u0 ltrif3oo1lpt luvo;s)trxm(m3iydopeelivsat sDrmx p;t0tee ioeiys aDua( o u4aexrifciodlm e ivs;s  2xoiopiy1lp  lnes t) rrax p;t0aeen oetytfsDrl( s;(4arxnmr iadopDe nvils0teuoxr3iydlpeelncs t  Drrxrpot0openmicild s ua(ms;u)areoir iytlateaies s) rxmxm oy1lptelivia() 2rm(rp;u4optn o3iyt a elu s ()alxomr io1laDe uei () rxmxopoo1ol elfvs s)srrrx  nu4opx  ieiatfmDuanmp (0arxrmo iy1fm elnvil()texmxopiu4amt  nviltfsDrrxm ot4tex mi3iadfa2elnmo;u4arermfcia1omtelu o s0tetmir oydal  lncs tfaDurx oot0tlto ictyslmDumu o u)alenmo3tydfmDelneo () rxm(rpnu4lmtelfct s artaxro;t1opx  iciatfaDrmuvp (0trerxrcio1fm rau s;s)t2urxm ou4alte iei s)a2tmu p;u4teenmfetld s emu p;t) ltrio oytop eli ol()sexm(m oudlmtnlfvs s)aDuau  ou0tlxnioeildfm2ua( p;t) lenxocoa1laDraivolt0s2ur(r3io4lpte iei s s2urxro;o0apxomi3iadlm uluvo t0alxnxf io1op rai i;t)s2xoxm3iudlmtelnctat  Duaxm no4tpx  oetyd aDrmn p;u0 exnircto1lm   n i;s0 etmio3nu1ll n ics ()sDrm(rpno0optoiictls m umuvp u4aetnxfciydlpt an i;(  2xmim ny1omtnlivta(faDrru o;u4tex mfeiltfa2rm( sn()altnxoctotfp elneolt srtmiopnu4lpte iesls)sruru oot0oeeo ocils a eln o (4 lenxr3iadoptraieilt seumxo nodolte fcil() Dtrurpot0alenmfeiatfsDelnmo u4trxrio iytfm elueo (0 rumxm3no4altnlicsas)a2uaxmpou1apxo i3iad m2uauvo ()aexoio oodlmD au i;s0 etr(o iu4ap  lneta() Dta(m ;u4tetnmfciysfsDeanvp u0tlxnxr oytom r i s;() etoimpoydlm nmieslsfaDua( oot1alxoif3tltfs emnvo (4aeerif io1oa   uvils0truo(o3iu4omee fetl(fsDtm(  no1olt if3tysfm rm(mp;()trerxr3oytfpDe n slt  rtoim nu1apenlfei t a2tr(r no1teto o3iasfa rmn s t0tetomf iadoa e nvslt0 etrxo ou1omtn ivt sf Dra(rono0opt moeildlsDemu ont)alenxf ty1lpDeau o (  2umxmpno1lm emfvi t) 2uau p;o1tpeo o3iltfs rauvo t)trerxo oydla eaneol(  rtrirpio1lp n fvslt  rumum ou0tlt if3tadfsDelnvs;u)alxrxr3tydfpDr ivols0texmim3oo4oltnmiei (  rumurp;o4opeo o3tldls2umu o t)tltnmr iatlm raueo s t2xo(mpno4opeelnct (fs2taurpno4alt ioeilsfaDuaump;u)aexrxf tytomDelueilt  exr(opiy4lltnmivsat)sDraum ou1opt mictys m2ua(vp t0artrifcootlmD  n o;( t2uoxr ny1alt  fci t) 2rm(  nt1alen fciyd s2emn sn()arxnmo tatoatr nei;() rxm(rpiodaptnmfvs (  Dtm(rp;t4tpeoifeilt a ea( pnt0 ltnmo oatfm   u ils)srtmimpou4lpt  iesat)s2rmxmoou1alxnmfciaslsDeaumsnt) rxoxo tydop   nei t  rto(mpoy4ll nliviltf Dra(mpno1tle  octatfaDrm( p;u)altoio to1laDe ivo;s0 2umiopou1olt  fct t) Drru p;t0apxnii3iysfm2rau pnt)areomf io1fpt lies;t0t2xmxmpio4lm nmfvs t)aDrm(m ;t0olt  o3iyt a2eln onu4 etrif totfatr uvols)t2xo(o iu4ape micta(faDtrxmo;t4tetomi3tydfs2rmnmpnu4 lxnirciadfm   nes;( s2urxm ny1lp nmietlt)srtmxro;u1olenifciytfsDeln o u4aetoif oytlptr ivils)texr(r3ny1alte fvtas  Dtm(m nt1olt iiciyslsDem(ms;u4 exomfcio1oaDrau sl(0srxrim3nodlp  lnviasfsDtmxm ;o1alxn fetltfs um(mo;t)texrxfciy1opDraivi ()teumio3io1op elfvs s) Drrxm nt4oet  i3ild a2rl( p u) exomr3iadfpD lu o;t) 2urimpoy4opt lnet t) rumu poo4tpt miciysfa ul(monu0 ltrifcoytop e u i;s)s2urxr3no4op nlfcsas  Dtmumonu1openmo3ildfs2rm(msnu) exnxo to1lmDrai olt t2toim oodlle mivt ( s2umx  nt4tltoioetydlm2eln o;()arerxfcta1fateli o;s  rxr(opio4al nmnviltfaDtr(mpnu1oltn o3iadlm2rmnvon()tlxnmo3ootfa   nes s)t2xr(m3ny1al emiesltf 2ra( p;t0aexnmictytfmDrmnmo;(0trerxr3oo1lmt  ivo;t0 rtmxr oy1am   fvt t sDuaurooo4aetomfeiatla ranvsnu4tlerif3oa1fp eli i;(0t2xrxr ou4altnlictlsf 2rrxmp;t1opeomieiadls2ra(vs;t4tltoir3oatla  an s;s0 2xriopiu4op emnci tfs2taumoot1aexnii3ildfmDulump;(0 lenmrcoytlateluvo s)srur(r3nu1om  lncs s)artm(r ;u1tet iicias s rl(vont4 exrxfctadop eluvolt t2toir ou1lm emncslt)arumx o;t0olx mieildfs2ua(mo (4 renxr3oytop e uvo (  rxo(m3ny4amtemivtasf 2rm( onu0open f3ias m um(vsnt0 exrif oodfa  an s s s2umxmpnudaptnlieia(  2tax pnt1apeo o3tldfm elnvs (4aetoxr oodopD  neils)s2trir io1al  mfvt tfarrrxrpnt0oltomi3iyslaDrmnmont) rtrxociotlp r nvi s t2urio3iodll nmfvs ()s2tmxm nt1tleomieiltls eauvpn(4trtrxo3io1omte iei s t2uoxr3ny4alte fesltf Dum(m ;t1oeeo ocild sDua( p;(0teerxocia1op elneils texoimpou1lp nmieilt)srtmxmpoo1altnmoeiad s2ulnvo t) lxrmrcto1la elu ils)t2uoio3ny4olte nei tfs2umumpoo0aee ifeiltls2em(vo;t0trtoio ta1oateai o;t  euoiopou4ape mfct t srrmu o;u4altomociad aDul(vpn(0tltomocootlaDeaues;s)t2uoxm3iy1lltemnvs (fsDua(ro;o1tet mf3ild s umuvo;u) lenmoctodlpD livs;t)t2xrxo3ou1ap emivil(  2rrx o;t1teenmf3iydfm rm(mo;(0tleomr oydla  li sls texmir3io1lpenmics t) Drm(mo;u1oeeoifeiltfa ea(mpn(4tlxrxr to1om e uei t0t2to(opio4olt lfcsatf 2taxmoou1oex  oetysfa ul( on(4texrifctytlm eaies (0 eumxmpoo1al nmfcs s s2tau oot1aeto fcias s uan s;(0aetomfcoatop eau il()t2to(m3oy1lle mfvi (  rrru  ou1opt io3tyslsDulu onu0 etrxr3ta1lm eai i;(  2xoir3nydlpenmicias)sDurx onu4alt iieilt s2ul(vont)tetoxf oa1fmt aueo;()s2to(opiu1ap n feils)a2rm(  ;o4aex  ociysfaDraums;t4tlenmocoodfmt anei;(0setmiopnu1omte fvi t aDrax pnt4opto iciatfs umnvp t0 renir3tytfa rau o t0texoxopoo4apeelivsat a2um(rpot4tlxn ietltfm2umump;t)aetrxoctatfaDe u sl(  rtmio3iydamtemfcias  Dtm(mpno1aetn o3iysla2ea(vont0trerif3ootfmtranvils0 2um(rpiy1lp nliet t) 2um( ono1alto i3iasfm2eluvo t) rtrmo3to1omteauvs;s)t2um(o ou1amtnlfei tf rrm(m ;u4alenmf3ils a2eln o;(4 rtrxrcoo1lm eaivo t0trtmxrpoy4lm e iesls)arta( oot4teeoiociytfm2uan on() lxnmo3ta1late nvsl( srtrxrpoodop n iesas sDur(mo;t0aet  i3iatfmDea(vs u4texrir iadlm   u i;t)trxoim3oudlp  mfeslt aDra(  oo4tpx ifeiatlsDrmumo t4aetrio3oodla  ln o ( t2tm(o iudomenmivsl( s2rrxmonu1tpe if3tltfs um(von(4 rtnxo3oadlptr u olt0srxrir3oydamtnmncils sDtmx o;u4tlto feiyslaDrmuvs u4altnir3tydfmDr n o;()teto(mpny1lmen nvs t s2rm(mp;u1tex if3iltfa2rlnvo u0trxnmr oatlaDeluei;(0 2toxr3nu1omt  nctls)a2urxrono4teen ictad a eln p u) rerifcoo1lat  uvol(  rxoxr3oo1apenlncil(faDum( pot0ale  i3tyt s2ul(mo;u)aexrmo oytom eln s;s) etrxo3iudop emivs s artm(rono0aetn fciadfa ulnmo;(4aetrifcootomD  i olt)t2trxm iodlpee neta(fsDumumono1tpx mfeiysfs2um( pnt)tltoif ta1oaDrlieo;t trurxm3iydam   fctls) 2tr(m ot4oeenmi3tytla eau ont0 ltnxfciydlp ran
\ No newline at end of file
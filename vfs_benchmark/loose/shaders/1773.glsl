@@ -0,0 +1 @@
+ivs s) rurirpio4ll n ict (f Dtm(rpnu1olt  feiysfaDrln p;(4arermoctatfate uvils0trtoxmpiy4omenlnetat arrax p;o4apt moeiadfa2ean p u0 reoif3ta1fm  lieols0s2xmio3ou1aptn ivi s arua(m ou0aet mi3tad a uaumo;u)tetnmf3ta1fp r uvolt)setoio oodolenmfvs sfartrxmo;u4oet mi3tltfs rm( snu4aexrmr3oytom elu ils0setm(m oudame mnes sf rtmxmpnt4teen f3iatla ul(mo;u0 etrmo ootfptr u i;s srxoxrpiudope mfvilsfsDrrx  oo4aeen i3iytlm umnms;t0teerxrcoatoa  lues (0srto(opno4alenlnes ( srtrum no4aee  o3iydfm2rm( p;(0tetoif ootopt anvs s0 rxrxo iy1ll elics s aDtr(  ;u0apeoiiciaslm umuvs;u)tetrxo3tytlmt ai i;(0trtmio3iy4apt liei s arumxmo;t1oex mfeilsfsDua(ms;(0 eenir3iytfa elnes t) 2to(mpno4lmtelfvt ()s2tmu pou1tlx iietys m2ulnvs t0aexrxo3oo1fa e uvols0 2tmxr3oodomtnmictat)sDtmumonu4alxnifetydlmDelnmpn(0arxnxf3tadfmDe iei;t sexr(rpoydope mivi (fa2ra(m ;u1aet iiciysfaDrmnvpnt4 eenmrcootlp rlu i ( trxmxr nodlp emicta( aDrrxr oo1oet  fciltfm ra(vs;()tltrifciodom rai o;() exoio iy1lm elfesl(fa2rru ooo4tlxoioeiydfsDran o t0trxnir3todlaDrlnvs s t2xoxmpou4llt  iei tfartmx o;o4olt moetltlm uln s u4 lxnmo3iatopDr ivils trur(o nu1olt mivtlt aDraxr no4aeenio3tas aDrmnvpnu)trermo3ootfmD an ols  2tmiopio1lleelnvi sf 2umump;u0aet if3tatfsDeln sn(4aetomo3tadfm r u slt s2um(r3oo4lm elfvtl(fa2raxrpnu1apxn iciadlm rl(vs;u) rtrio3oa1la  lnvol(0 ruoir3nu4alt lnciat)aDrrumpnu0aeeoif3tydlmDrau o ()arenifcto1fptrauvo (  2umxopny1lleemnciat)aDum(  oo1tet mo3ils s2rl(vo () rtnirctatlm e uesl(0srurxo ou4olenlneia()aDtmumo;t1aexomfcildfm eln sn()alxnmr ta1op r nvsl( s2umio3iy4lptelfesl(f Dua(ro;t0tlxn i3tydfmDem( pnt0aexnxr3iotfmDr uvi (0trumim ou1omte ieias)sDtaxrpoo0tee mfciytfm2ua( p;(0 leoir3tatoa  aivil(0srxoxr3iu1lmtemivsa() 2ua( o;u4tpenmociadfm2eluvsnt4tlxrif oytlmt lueilt) eum(m3nydal e icsls aDra(r ou0opt  o3iaslm2umu pn(4teeomfciodfm eau i s0 etoxr3oodolenlfeiltfs2rmxm ;o4alt moeilslmDuauvs t4 etnxocoydfat aivilt0seumiopoo1ope  ivt s) Drax ont0apt mf3iytlmDea(vo t0trxrxr tydlptrau o t0truo(mpio4lptnmnvi (fs2trurpoo1oexn f3iat m ua(vp t0artnmrcoa1fa e ivo;s0 2xriopoo4oltnmnvil( arumx ooo4tltnmictlslaDeaump u4 eermr totoaDeaiei;s srtoimpoodlm elnei s) rrr(rpou1tpxniieildlmDem(mp;()tetoir3tytlpDelivsl(0trtr(r3iu1ome mfvtasfaruru  ou1tee  f3tlt aDuan pnt4alxomr3tadfmtelu i ()sexm(rpoo1ll  mfcilt)s2uau pou0aleomi3ils mDul(ms;t)trtriociytomt li o;(0trxmir3iu4lle mfcsls) rtrxrp;t4tlxnii3tytlm rm(vs t) rxoxo3to1laDrauvs s tetrxopnu1llenmnvt tf rumu pnu0apxo feiltfm ua(mo u) lxrmociytopDrlies;()t2xrio nu4llt mfcslsf 2trx  ;t4ole if3ildlaDua( s (0 ltrir3iytop  an o;s0t2tmxr3nudomte net t)a2tru pou4openifciydlm2emn s u4 lxomf3iy1fmD auvo (0t2xoim3oo4llte fvta(fsrraxrpot0tetn i3tltls rm(vs;u4artnmo oydfp elivs;t trtoiopnudap n fcta(  Dumu  nu0teen f3iad sDumu o;() eeoifctodlp  aieo;s)s2xrim3ny4alen fciasfsrraum nt1oee  ociyt sDem(vonu0treomr iotlptr ivi;t0trxr(mpno4altemfvi ()aDra(ro;o0apxniociys a2eauvon(4 rxrmrciytfaDeli o (  exmxr3ny1omte fcsl( sDur(rpnt0oet mo3tysfaDelnms;(0aeenxr3ia1fateaueo;s)tetoxrpoy1al  lfvil(fsrra( ooo0altnioeiat s ulnmonu) rtnmr3oatlpteli sl( srto(o3ny1opt mfvtls  Duaur ;o0openiieiyd mDuanvsn() lxrmr3tadlptr u s;( trxoxo3iy4lm nlncia( s2uaurp;o1tpeo i3iydfs2eanvont) rtnmfcoatfaDe n ils texoio oodope livtl(f Duaurooo1oee mf3iatla em(vp (0aetoio oadla  livilt0 euoxo ou1lpt mnvil( artmxr oo4aptn i3tydlaDem(mpn(4 ltoxrcoo1lp e i o t)srtoiopno4ll e iei (fa2uru  no4tptoiieiys mDrmums;t) reomf3iatomD  u i t0 2tmio3io1op nlfctat) 2rr(ro;u0oexomoeiysla2ra(vont0alxrmr tadlmtrluvo t)sexmxo3oo4altelnviatfa2ur(moou0olx  ocils s2uanmpnu) etnmo tadomtrln i ()t2xmim io1op emncias s2rrxmo;o4tptoio3ild a2ulums;t4tlxrifctatfmtelivil( texo(opiydlp nlnvi t)s2rmumooo4apen fctlt m2rm( s (0aetrmr3totomteauvi;s0s2xmimpou4lm e fct ()aDrrur nu0alt iietld a uln o u4arxoxfciodlmt  ueol()trtr(r iydapee fei tfaDrr(mo;o1ole  ieilsfm2um(mpn()aleomoctadoptrluei s0srtrxo io1opt lnei (fsDrax o;t4tlxoifciysfsDumuvp u0aetomrcoydfaDrli i;()t2xriopoy4amenlnci s s2uaxrpnt0ale  o3ias mDranmsnu4arxrxoctotfmDelnes t t2urxmpnudlltnmnctasf 2tm(r ;t1ale mociyd m emuvs t0artomf tadomDrlneil( t2xo(opnodomtnmfvsl(fartrurpno1opt  i3tyd s2umn pnt4texniocto1op e nvils trumim3io4ape  icilsfarururpoo1opto feiydlaDrl( o;u0aeerxo iodla   u s ()setmir oy4omeemfet t)aruau pot1tlxniiciad aDemumo (0 exrxfcoy1fa r uei;(0 eurxr3iudapee fcs sfsrtm(monu0aleo ieiysfs2ea( p (0aetrxfctydfaDeauvo s) euoxopiu1op e feils) rur(rp;u4tlenmfciyt s2uluvonu)arxrmrcoy1oatrliei s t2umio nudaltelivtas srururo;o1alt mfcildlm rm(vo () renmf tatfmt  u ilt0t2xmxmpiydaptnlicsa(fsrrm(mp;o1tltnmietld mDum(vs t) rtoif iotomt  u slt) eurimpnudlme  fcta(fs2umxm no4tleo o3ildfa uau snu0 renmocoodlaD  ueol(0s2xr(m3no1lltn ici () 2umxrpou1oetnmoeiatfmDuanms ()tltrmf to1om r uesls0s2uoxo nu1olenlici t)arrru p;t1tex  i3ild mDum( o u0 exnmr3oadopDeauei s0t2xmxo oo4lmtnmivi ()aDrmxr ;u1tpe io3iytls2um(mo;()arxoxfctydom e neo s0seto(o3nu1apee fvi ( s2trxr oo0optn oeiadfa2em( o u4tetnio3iadlpt  ieo s0 2xr(mpoudap  mfci t artaxmpoo1opxomi3ils m ran o;t0trtrmr oa1fp rlnei;t)trurio3oydap n fesat aDtmurpoo1apenifeiad a2uanmont4teeoiocia1lmt aiei;t0 rum(rpiy1om emfvs t  rumur nu1tlx  ictltfm2rl(vont) lxrxrcoydfpteai ilt) 2trxm3iudlmt livta() Drrx ono4tlxnmfeiatla2elnvsnt0texrmr3iotfaD  uei s srum(r no1am   fes sfs2ua(r ;u0opxnmicildla ra( on() lenioctydfmD au ols trxmxr3oydlme mfcsl()srtmumoou1opxoio3iys s2um(vs;t0 etnif oy1lmDelneo s0tetoxrpiy1openlnciat) 2trurpou0tleomo3tasfa2umuvonu4aetomfciy1fmDelneo;t0t2umim3nydol  mneias s2ua(r no1aexn iciyslsDrlnmont4aeerio oadlpD aueols0trtmxo3oodapt lneias a2uaxro;o4alxo ictytlaDra( on(4aexoxf3iadfa eai s;( teurxm3iu1al emnesasfsrrmxrp;u1ole  ieiasla2eanms;()arenif3ia1om rauvsls  2xoxm ou4ope lnesa(f Drru pno1aptniieiydfm2uanvs u4 etnxo3tydfm rluei;t t2uoxmpnu1om nlfvtlt  2ta(r no4aexo feiltlm ua( s t0 etoir iotfmtr nvilt s2umimpoy1lpeelfvia( sDtr( onu4aet io3iadla eauvs;u0 rtoxf io1lat lu i t0t2uo(m iy4ap emfvia()a2rrxmp;t0apt ifciaslaDemu p;(4alerif tytlptran s;s) 2tmxopio4aptn ivsas sDua(rp;u4apt iiciadfa2ranvp u0 lermrcoodlp r ueo;s0setr(m3io1ap  lnvsa(f 2rru  ;o0tpxo icild m umu p (0trtrxo iydfm  auvi;s0 rtr(mpou1ale lieias)aDururpot1oetomocilsfm2emumpnu)alxrxo oa1omD aivo;s  exmir3ny1lptn neils aDuru  no4tlxn fctas aDua(vo;t4 reomrciotlmDrlnvi ( sexmir3oodllenmncilt)aDuaur ;o1teeoiiciydfaDum( o u4aetnmrcia1oaDran i (  exm(m iydomeemfei t)a2rm(rpnu1ape io3tldfsDuln s (4tetoxociotfp raivi;t0trxmxr3nodam   nct ()a2rru  oo0oexomfciyd sDrln p t4altoxf3ootfmD luei (0 eumxr3io1apeelivias artruront0olx  f3ildfm2uln p u)aexomr3iytfpD  u i;s sexo(mpnydamenlivils)sDrrxmp;u0alxo fciadfs ua(mo u0texrio oo1lp e nvsls texmimpnydoptemictas)sDrax pno4alto ieildfm2rm( o () lxnmrciadomDeanvols0srxoxm3no1am n iesls  rrrxr ;t4opeomo3tas sDemuvo;t4 reomo3ty1omDeluvolt seuo(o3oy1alenlnciat)artaxro;t1tlt ifciaslm2umnvpnt)teeomf3totfpDe ies t0setr(o3nu4am nlncilsfsDtmxrpno1apt miciyd a uanvs u0trxrxrcty1opt  i o;(  exoio io4altnmneslsf Drr(m ;t4tpx ii3iytfa eauvsnt4altrir3oydfatrln il(0seuoio3nu4om nmiesls sDrmurp;u0olt mietldfs ul(mon(4 leoirciydfp e ivs s)setoxm nydlpt lfetltf Durxro;t1altomoeiltls rmump (4arxrxf3iy1oa elneo s)srtmio ou1altnmfcsatfaruru pot1alxnmfciasfa2um(vp;(4teenxo iytlp elies;s t2xmio nodol elfvilsf ruaxm oo4aetoii3iasfaDrl( pnu) lerxr ta1oaD aivsls  rtmxo3oodll  lneslt sDraum ot1tee  icildlm2ranmonu4trtnmfciydomD  n o;s) 2urirpno1lptnlfct t) Dtaxmont1tetniietad mDem(mon(4tleoirciy1optraivolt0s2xrxo3oo1lpe  icil()s2rmxmpnt1tex iiciatfm2emn p ()aexrxr3oatfpDeln s;s) 2trxopnu4omt lfeiatfa2taxro;o0teen feiyd a2ea(vpnt4texnifcoa1fa  lieo s)srumimpnudlp nlicsas) rtr(r oo0tex iicildfm2rl(mp;u4aeenircty1lmtelu s;(0 2xoio3oy4apee ncilsf ruaxm nu1open o3iltlaDulnmo;(0 etomr to1lm   i o t)sruoim oo4omt mfeslsfs2umxmpnu0tlxnmieiaslsDrm( s;t)alxrirciydlp  an o t)trur(mpoy4op nmici (  Drmumpnu4aexnifctltlsDrmuvpnu)artnmo iadfaDr n s ()t2trio ny4lmt  fviatfa2raxmo;t4tpeomictyslmDrm(vs u0 reomoctodfmDeaneo s0 ruoir oodamtemieia(fs2urxrpou0alto ictydfa2ulumont4tetnif oa1lmDeai o;t0t2uoir3no4alee fes s)a2raur nu0oee  octydfmDemumpn(4trxrxo oatoat lnvs;() rxriopoy4opeemnct s srtrx pou4oleo fcilslmDel(vs;u4 etoir3tadopD luvo t0 rtrxm nudopenmfes t)arra(m nt4tle moeiad m2em(vpnt)texnxr oadoat  i sls truo(rpnodlltnlneiat)a2trumont4oee  oeiytlsDuln pnu)treomrciadoaDeaueilt texoir no4lpe  feiat)s2tmxro;o0olenmo3iydfsDulu p (0artomo3iydop  luvol()setoxm3no4llte nvs ( sDtrur ;u0teeniieiys s raumsnt4aeenir ootoptelnvo t0tetr(o3ou4lme lict tf Drru poo1aptniocildfaDuan pnt4aeenifciytfa rai i;(0 rxrim nudlpt  nes sfsDtrxmont0oexo feiys a ul(mon(4trtrxo3todlm e ueo s  euoxmpiu1omtnmics s) Dtr(ro;u0aexn i3ild a2elu onu4 lxnir3oydlpDeaieo t srumiopou4oltemnvs s) Dtrumo;t4aeto f3iydls eanmo (4 rtriocta1lm r uvsls0tetr(opnu4lmtnlfvslt aDtax  oo0opeo icildfm ul(vp (4 lxoxo3tadlaDranes t texrim ny1al elfvt sfa2ua(mpnu1teeoifcildfs2ean s (0alxrio3iatlat  uesls srxoxm3nu4ome  icsas) 2tau p;u1tetnmiciysfs2ulu on()alxnmo tytfptrauvi;t0srum(r iu1lpte fvsa(fs2trxro;o1oet mi3tyslsDuauvo;(4 ltomr3iydfa e nvo;t)trxoxr3iy4oltelieiasf rta(m nt1oee ioctytfmDrmnvp t)tetomf3iydom elnei t  2xmxo nodlltnlnesas a2taxro;t1aetnifeiat a um(mo t4 rermo3iotlmDe i olt0srurirpio1omee ict tf 2uaxmpnt0apxo fciydlm ra(monu0trtrmo3todoat aivslt  exoio3oudam  livs s a2ra(root1apto f3tytfm rm(ms;u0aeerio to1lptrluvo s0 rxoir ny4openmfcsa( a2rmxm ot0ale  f3iyt s elnmon(0 ltomo3iotoateli s s tetrxmpoydamtnmietat)aDua(rpnt0tlxo octas aDuln sn(4tetnxf oytoaDrli ilt  2toim3iydalee iei sfaDumxrp;u4apenioctyd s eanms u0tltnircoytlmt  nvs (0seum(opnu1ameemfei s  rtau  no1tleomfeias m2ulnvsnt0 rtrircootoptelnvo;t) 2uo(o nu4al elivia(faDuauro;u0oex mo3ias mDelnvo t0tlxoxr totla r u s () 2xoim ou4ameemfvt tfaDra(  ;u1oltoiiciyt aDeau pnu4 etnmo3iadla rli ol(0sruo(r nu4oleemfvtas)a2uaxrp;u4oltnioeiydfa rl(mp (4tlermo3ty1fmtrluvo s0tetoxrpoo1olenlncs tfartaurpoo0texnmi3ilsfm2emnms;t0aeeoxf tydopDr i o;( t2tmxopiy4aptnlnctl( aDrrur nt4tlxnmi3ilt s em(msn(0altnmf ty1lmDeanvo;s0s2xrxo iydomteliet sfsrtmxm ou4apeoifetyt m2em(vs;t4 rtoxr oatomte n i;t  eumiopnydolenlnesas) Dtmxmono1oleoiociysfs2el(vp ()aexrio3oa1la r nvsl( srtr(o3iy4altemfet s)arrmxmp;t1olxnioctasfm2rl(vsn(0trtoxf oodoaDeaues;s0s2xrxrpnudam  lnvt s  Drmxmpou0oet ifetasfs2rmuvonu)texrifcoydlmtrlueolt  rurxm3nudaptnmfesa(fartaxro;t0aleo o3iysfsDemnvp;t0 rtoxf oydlatrlueilt)s2umirpny1llenmnvs sfs2tmu pnu4olx  fciysfsDumnmo t4artrxo oa1fa rauei;() ruoio ny1op nmivtat)srra(rpnt1tlx mi3iatfs2emuvs;()alxoxrciy1omt lieo;s)t2xo(m3nu1altemivilt sDtrxmo;t1olto ociyslsDrlump (0tlxoiociy1fa e ivs;s)srurxr ny1altnlies t)a2tm( oou1tpxo feiadls rmnmo u) leoiociy1fp e uesls0sexoxrpiu1ol  mics tf Drrxro;t0oleoifetys a ua( o;(4 rtoxocoy1lm rlivi;s0 rtmio iodlp elics s)srum( o;o4tlxomoctas aDemuvpn() rxnmr tytoa rai o;s)tetoxo oy4lm  lnes sfsrra(  ;u1altn oeiltlaDranvp;(0treomociotfm  aieslt srur(o3io1apte nviatfsrumxm oo1aexn oeiydfa2ulu pnu) lxrif iatfp  au ils  etmxo oy4ll nmnetatfaDtr( ont4ole iictaslm2ra( o t4aetrxo3todopDr nesl( srtrxm3no1oltnmfcsasfs2rrx p;t1aleo iciyt a ua(mo;u) rtomfcoatfpDr ivs;t  etr(m3ny1lm emietlt s2ur(m no1aexoif3ilt sDrl(vs;t4alxrmf3oadfa raneo;s0seurxm nu1opt mfesls sDumxmono0aetnifciltfa2ul(mpn(4 etoif totfmD anvo t) rtoxrpny1lltelfvilt)s2ururpou1aetoii3iyt a2ea(mp;(0texnxo3tadlaDraivi;t)t2uoxo oodamt mfci s)aDumumonu1apx ii3tlt mDea(vp;(4aexoxrcty1fpD aneils0setoio ou1amtnlnvs s)sDuaurpnu1optomoeils s ul( ont0 eerio3tatlp elnvo t  2xo(rpiu1op n nvt ()aDtmum no1oex mieiatfa rmuvsn(4treoiociadoaDrlnvols t2xm(mpoydamtelieta() Dua(mp;o1apt mi3iltfm2el( sn(0 exnxf iotfmtrluvo;s)seumimpoy4opt  nesl(faDuau oot1tlxnmo3ils a2rmnmsnt4alxoifcootlp   nvs;t0sruo(opoy4omt mfvsl(fa2um( p;o1apx moeiad a emu p u)arxrif3ia1opDr iei;t0seuo(rpoudoptnmiesasf Dumumoou1tlxomoeias sDrmn s t0 rxnmr3tadom  anvs;s t2xmir oydlmtn nvi t)s2trxm no0tetomieilsfsDuanvs t0tetnioctatfm eli o (0s2xmxopiy1opee icsatfs2taum ot0opt  oeiat s raump t4 renxf oatopDr i o (0 2tmxrpiudlmtn ivtls)s2trxmpnu1aeen ieiltls ua(vs u4 lenirctotfp rlueilt)sexm(r iodame mfetl(f Dua( pnu1opt iociyslaDelnvs u0aeeoirctatfpDelies;()teuo(m3io4alt mnviat s2taur no1aeeomfeilsfs ulnms;t0 rxomr3oatlmt  u ol( truoxo3oydam n ncilt artr( onu1oex mieiyslmDrl( s (0tlenmrciotomDeanes t  rtrxo no4omt  ivsl( sDua(  nt1oetnmfeiydfsDranvpn(0trtoif tatfpD luvils)texrxmpny1amtnlnetltfarrmxr ou0tpe moetas aDel(mo t4 etoxo tydlpDrlnvs t0texmxopoo4lm emietls)aDrr( pnu0aex iictasla2ra( o;(4trerif ia1lpte ues t0 2xoir nu1lp nlieia()a2tau p;o0opt mfeiytfa2eauvpnt)aeermo oo1fm eauvo;s s2uoxo3ou4oltn fcsl(f 2ra( p;u0oetoifcild a2ua(msn()trtrmo iodla   u o;t t2uoiopny4lltemies (fsDrmumoou1aexn ictatla2eluvo;(4aetnmfciydlaD an i;(0texo(o3iu1oltemici ()aDurx  ;u4opt  o3tlslm ra(vo t0texrir oy1faDr uvilt0t2xoiopoodomee fcils s2rax p;u0tpe ii3iatls2uanvp u0trtomo to1lmtr ivs t srtmxo iy4openlncta()aDur(rpnu4opxn ieias m2elu p u) rtoxf todlaDraneslt0teuo(m no1apeemici t aDraurpoo4ole iieiytfs ulu snt0aeenir3oydfa r nvi s)s2xrirpno1llte fcsatf 2tmurpoo0tpxomi3iatfs2ea(monu4arerxo tydoptrlneo t) eum(m3oy1olenmicsat)s2uru ono4opt  iciadlsDrmnmp u0 ltnif tadlatrln o t tetoirpoodomtn ics (  Drrurono4tlen i3tydfs ua( p ()areoir3ootla rlieol(  2trxm oy4ame lnvtlsfsruru ono4opxn i3tld m2ua(mp;u4 reoio3ootfpDr nvilt)sexoxm3iu1ol nlneta(f rtrxmono1olxnifeiatla2el(mo;t0tlxniocoa1omtrlnei;(0 2umxrpnydllenlfctl()a2taur ;o1olxnmo3iltfm2emums;t0aeeoio3iydfm eaivol(  exmirpno4lmt lnesa()s2tmumono1tpt  ociys a ean p (0aexoxo3oodfpt lnvi () exrim iudlmtnmnvtlt)s2ururooo1aptniieiadfa raumon(4artomf3oydfaDrai o;( tetrxo3iy4ol n fvtlt artr( ont0opx  oetlsfs ra(mpnu0aexnxr oo1lp  aueil( srtoxopou1lpe miesl(faDrr(rpoo4apenmiciyt m em(von(4 reomrcio1fpD lnvi ( sruo(m ou1om  lietl( srta(roou1aexomoeiytfsDrmuvo;t4arenmf3tadfm elivs (0tetr(opou1ap elnvtatfsDum(  nt4aetomo3ildfs ranmo (0alxnir3oadlmtrai s;(0texo(r3io1openmfct ()sDuaxr nu0apxo ocias m eaumo;() renifctydlateli sl( s2xm(mpny1lp elnvt sfa2urum ;u4apto ietldfa um(mp (0tetrmo totomDrau ilt0trur(o oo1ale lietlt)s2ta(r ;o0opxomoctasla rmuvs;t4artrmf oadlpt  i o s0trtmio oo4ol  liciat  rrm(mooo1tpeoioeilt s2rmumpnu)texrmo oadomDeaivo s  ruo(r iu4apeemnesl( a2umu  no4texoioctytla umnmp;u4 reoxr ta1faDelues;t  2tr(m3ny4lpeelncta(fsDuau pou4alxoifeiyslsDrmump;t) lenio3iytla elu o;t seuoirpiodale  fvi ( srrmur ;o0teeo i3iadfa2em(ms (4 etrir3iatfaDe i o t sexoiopno4lle mfvi (  2tr( pno0aexnmi3tltla uaump u0 eenirciodfpD aueslt srum(r iu4ll emnvil()a2ta( ooo0tltomfciysls rmnmsnu0 lxoxfciotfaDeauesls tetrim io1amtelfvs s sDtruro;t0alenmoeiyd m2rl(mo;(0texrif todla elu o;s)s2toir iy1omtnmivi (  2tmu pnt1tpxn ociatfa2emu pnu4aetnmo3tydfmD  n i;s) rtmxr3iudalte icsa(f Drr(m ou0oeen ieiytlaDulumpn(0trtnxocoa1lp e ivols)setr(o3iu1amenmfct s)arta( oou1oeenmfeils m um( o u) etnxf3iotfmD lnei s0t2toxr3oodlmeeliesas)artrx  ot1tlxn ieiatls eluvo;t0 leomociydlm r n o;(  exmir oy1opt lictltfartrx  nu1tle mfcilt sDuanvs;t0arenmociatopDean ils0trxm(r iodal nmneia()s2taumpou0aetn f3tytfs ran o;t) exnxo iadlmtrlneol( srum(r3iu1amtemivt s  rumu  ;o0oltoiicilsfa uaums u4 lerxf3io1lp  luvo s s2um(opoo4apeelivi ()aDtaxrooo1aexnmietytfsDran s (4tltoir3iy1fateanes;s)texrxr3ny1om nlnesltfsDur( onu1texo i3tadls rlumo;t0aetoxociytoaDeli s s0 rxrimpny1am n ivi (  Dra(m ;o4texoio3ias aDra(ms;()texrio3ootomt lneilt srxrxm3iu4ape  netatfs2urx  ou0tpxnmieiytfs2umu onu0 exomf3ty1lpDelnes t) 2tm(rpiodamte feias) rrau ono1oltnif3ildla2elumsnt0aetnif3oadopt  nvolt0s2umimpoo1omeelnvta() rrrurpoo0oexomf3tyd s ul(monu0 rxoxr oatla   i s s)texr(o iodlmt lfcs tf rraxrp;o1optnioeiadlmDuau s;(0 lxrio3totoa  aivs s  2xrxopoo4alen fctls) 2uau ono0apt mfctaslmDeanmp u4teerifcta1oateluvo t  2urimpnu1omtnmnet ()sDraxr nu1apxn fctydlmDea(mont4 rxomfciatopt li sls  exr(opiu4lm emfvslt)a2umur no0tpxnifeilsfa2uluvpnu4tetoxo tatfpDe i i ( s2trxm3oy4opt lncta() rur(  oo0ale  ieiyd mDul( s (0artoxo3ta1fateaivo t  ruoimpoy4amtelfvtls) rta( oot0oeenmfetyd a ean sn(4aexrmr tytop eaueo;s0sexo(r iy1amt  ncsl() Dum(  nu0ape ioeiyd a elnvpn()tetomfcty1omDe ues;s0texrxm3oy1lmen neta()sDtrxmoou4olenifcildfm uan p;u0tltoxrctadom  lueo;s0 etriopnydapenlict t aDrr(r no4tpt ii3iasfm2uan p (0teeoio3oa1laD aueo;() etr(r iydapt lfetat  2ur(  nt1tptomoeiatls eaumpn()altrmocoadla e ivo;(  rtr(r oo1amtnmivtlt)a2trxro;t1tleomietlt s rmn s;(4aeeriocty1fpDrlu sl( trurxrpiodllenlfvs ()srrmum no4alt ifeildfm ean p;u0tlxrif3oy1fp eanvs t0srxoir3iodolen fvsls srrmx pnu1oetomi3tasls rlnvs;t)aetrxrctadfmD  uvo s trurxmpnu1apen fct (  2umu pno1texnifeildfaDel( pn()tetrxo3oodlp  aivi ()texoxo ou1altnlfciltf Dua( oot0tpxn feiydlm2rlu p;t)treoif3oa1opDeaivs;s0 rtm(o3iy1omee fetatfa2trx pou0alxnmi3tyd a2rmuvs;(0tetoiociydfp rlu o;s tetrxm nu1llt  nei (  2tmuroot4tlen fctas m emuvp;t4alerxo iodlaDelueol( teuoir3iy4omtnmnci t aDum(m nu4ape iieildla uln ont)tltomfcoa1lpt anei s  2to(o iodole mfctat srumxm no0opeoiieild sDuanvsn(4 eerir3iytop  anvo;s) 2um(rpnydal emfcslt) rur(rp;t4apeomfeilslmDelnvp;(0alenxocio1fm r u s;t)t2tm(mpno4op  mfvtlt)s2taxrp;u4olt  fciyt s eanmo;u4altnmf to1om  aueo;( trxrir io1amt mncsa(  2rrurono4altomo3ildfmDrmu p;()teerxf oo1fp eli s;t sexrimpoodlle  nvtl(fa2rmurp;o4tpx if3iasfa2el( p u0 reomr oo1laDeaiesl()teuoimpoy4lltn fvsat  Dtr(moot4tpxoioeiyd a2uluvo () exrif3oodlaD  i o (0 exo(opiu4lm nlncs (fs2rrx o;t0ale mi3tldfm2ulumpn(0alerxr iy1fp   ivsl()truoir3ou4lpt  fcil( sDtrxrp;u4aptn oeiad a2ea(vpnt0tlenioctotoat  i s;t0trtmxo iy1alenmnetlt srrmumont0aeenii3tltlm rau ont0 rtrir oodfp eaues t s2uoimpiu1amtemivias aDumx  nu0oet  i3iysfa2elu p;u)texrmfciodop  anei (0 2xm(opou4aptnmfcslsfaDtm(  ;o4oex iociatlm uaumpn(0tleoif3oa1oa  aues;s t2toxo3no1lpee fes ( a2tmurpnt1tetn iciatfm emumo;u4tltrxr tatoptraiei (  exo(r3iu1lp e nvtlt srra(m ;u1aex iiciadfmDrmuvsn(0aeenif3iytoaDrluvol( texr(m3nudllee ivs t srtaumonu4alxomf3iat mDum( p t4alenxrcoodlmtran o;s) rum(opnu4aleemfetat)aDtrumo;o0aetoif3ildla2ul(vo ()tltnio ta1lpteaiesl( s2uoxrpio4ole mfeslt)artru  ot1aee io3tytfa rauvonu0tltoxo iadfmD  u ilt0trxr(mpoy1lltemfcta()a2rr( ono1olenmieiysfa2um(vp;() reoxf tadfp raivils  euoimpio1op nmnciat)srtax o;t1opeo ictld s2ra(vpn(4aetnio3ia1lpD li ilt  2urirpoo4ome  nvsl(fsDrr( oot0tpen ociaslm el( onu4trtoxo3tatfpDrauvsls)t2xr(o3iodlleemncs sfsruaxrpoo4teeomicild a2el(vo u4aetnif3tytlmtrlieo;t s2toimpou4lmtn fvs t)s2rru  ;t0tex ifetld mDuaumo u)artoifcta1omDe nvo ()srxriopoydomt mivsat  rtmxmooo0tlxnmf3iatlsDemn o;u0 etoir oo1fmD  nvil() 2xr(rpou4llenlnci ( arrax ono4altnif3tad m emnmo t4 ltoxrcootopDranes ()t2tmxm3io1lp nlics ()sruaxrpoo4alx iieild m uln p u4arenmf3tytopDe u i;(0 2xoxm3no4amte ietlt arrr( p;u1olxn feiad a2eln ont0aetoir3oadfpDr ivi t0seumxr3ou4lpte nvtas)srtrur ;u4oexomicilt s rl( ont) ltrmr iadfpDranei;s)trxo(o3ou4op nmici (farumx p;u0opt mo3tls m2umuvonu4tltrir3ta1lmt  nei;s trto(o nu1ap nlivs ()a2raxmo;o4aleo i3tld s2rlnvs t4tltnmfcoo1fp   uvs ( seuoio3iu4olen neta( s2tm( o;t1aexoifeias sDean on(4trxrxf ootopD livo;(0 eumxo3iodolte fvtl()s2ua(rono0teenmfciyt m2eauvsn()aetoio tytfa ran sls0s2urxmpno1aleemnviat)sDrr(m ot0alx if3iyd s rm(vs;(4areomfcoo1fa e nvs;t tetoxopoodamt  fvtl()s2tm(r nt1olxoifeiltfaDulnmsnu0 etnircty1fp eanvo;()texmxopnydopeemfvtat  rrr(ro;o0olx mfciyslaDrm(msn(4artrif tadoa eln o;t) eur(m oudopenlicsls  2ur(r ou4apt ii3iasfaDel(von(0tetrif3oa1latr u o;()trxoxo io4openmivs s aDur(m no4apxnmfetad mDra(msnt0teeomr3oa1fpDr i olt srxm(rpou1lltelfvsa( sDrm( o;u4oex  feiyd mDrl(vs (0trxrmf3iodfaDr uvil(0teur(rpiodllt mfcsl(fs2trumonu0tpeomociytfsDemn ont)aeermf3todopte u sl(0trtrxrpiy1amenlfet () rta(r ot0opto iciad m2ulnmo u0tetoxr3iy1om  li sls0sruoim3nudlp  lfct sfa2taxrpou1altnif3tyt s ul( ont) exomr oytlaDrlneilt0seuoir3oo4ap elnet t) 2ra(mpno1alxnmo3tatlsDrlums ()trtrio3iotlp e nei;s trtr(r3iodoleelieilsfaDuauront4oexomo3iltfs rluvpnu)aeeomocty1omtraneo () exm(r3iu4omt lfct s)arum(rpoo0opxoio3tat s2ea(mp;u)teeoio iytfaD lu il() 2xrirpiu1om elieias)s2rax  oo1opxn f3iat aDean o;u4tltoxf3iadfm elivo;t0 rtr(m iy4op   ietls sDta(mpno4aeen o3ilt mDeanmonu) etomr3iy1lm   n o s0 rxoxo ou1lpeelncilsfs2ur(mp;u1ape iiciatlm2rl(vpnu) eeomf iatfpDe ieo;s)seumxm3ou1amt micslsfartmur nt0oeto i3tlt m rl( snt) leoxfcoo1la r nes t0 exoxo no1al   nesat)a2um(rpot1aex  oeiytls2eanvo u0 lxomrctodlp  an o t)sexoirpnudal n fvtlsf 2ua(  ;t0alenmo3iatfa2uau p;t4trtomo to1omDrlieolt) 2xrxo3no4al n icil( arrm(mpoo0oexn fciyt s2eau o;t0 rerxo3tatfaDe ues s0tetrxr3oydomt mnvtat aDrr(moou4ape moetatlm2rln p;u4alxoirctytlm elu i;()texoirpnu1olt  iviasfs2ua(ro;o0tle  oeiyt a umums;u4tleoif3oy1latr uei s  rurir no1apeelfvs s)a2urumoot4opt  ictld a2emu s;u0alermo3ty1oa  lies;t)truoxm oo1am nlfcilt  Drau pno4tet ifcilt m ea(mp;() exrmf3tytfm   iei;s trxmxopny1olen fvsls  Dumx p;t4olt mfciadfm2umnmo t) eeoir3iy1omtr ieo;s)seurxmpio4ll n neta() rrr(mpno1alt  feiytla rmn o u4 lerifctydlpDraivo ( setoxr nudamenmnciat aruaumpot1tpxn ociaslm um( o t)teerxrcia1lm r uvs t) rtoxmpnu1ll emfvsl(fs2rau  no0tet  ociadla2rln pn(4 etnmr oo1fp r i ol()texo(m3oudal  mivilt) 2uau  ;u1tetoioeilslm2ra(mo t)tetrir3tydfmtr ieols tetmxm iodol e fcsasf 2rru  ;u0tpeo oetadfs2um( o;(0aleomf3totoaDr ieilt)srtr(m3iy1omen icsas s2rax ont0texnmf3iaslm um( o t4 rerxrctatoa  aieil()srxriopiy4opt  fcta( arra(  ;o1tee io3iatlaDem(vsnu4aleoxfcio1omD auvi t srtoxm3no4lpeelnet sfsrrmx oou0optnif3iadfsDua( o;u4aexnmo3oodlmtr nvo;(  rtrxo3oydom  mfes (f 2raum nt1aetnmo3tld mDranms t) rtoxr iytfp r nvils) 2urxr ny1amenlfcsls aDtrxro;t4apx ifeiysfm2uauvo;(0artrxr tadom  aneils s2tmxrpnu1altelnet ()aruaum no1tlt  feildfmDua(vp;u)alermfcoo1oaDeaneilt s2urxm3nydamt lfvtatfsDua(ronu4opeoioeiytfmDulu s;(4tlenmo3totlpDrau ils) 2trim3no1op e fvt tfa2trurono1aexo ieiasla2ulums u4 ltrmfcto1fmteanvs;t0teum(r3nu1ap elici (faruaxmoot1olx  i3ilt aDeauvs t0 renifcty1laDe ivi t0t2xoxrpiudlme liet sf Dtauro;u0apen o3ildfa eanmsn() rtrmrciydfatelieo;()srtrxmpou1lmee icilt)aDrm( pnu0ope io3iydfm rl(vonu4aleoxrciadfmtrau ol() eur(opiu4ll emivta(  ruaxmonu4oet mictasfm2uln s;t0 ltrmf iydfaDelueol()teur(opnudaptn fci (f Dra(m no0aee  icias a2ra(vo t4 eerxr3totla elneolt0 exr(o ou1ll e nvt s  rumxmo;o1tltoifctatfa umuvp u0areomocoytfa  lieol( srurxr iodol e nctl(fa2umxro;t4tlxnif3iytlm2ua( o;u4alenxfctotom r iei;( s2xo(opoo1am n fet t)a2raur no0tpt mictld a emn p;u) exnxo oodoa eanvils t2toxr3nudopee ncsa(fsrtrx pou1tpeomoetls sDrl( p (0aleoxr tytoaD auvi (0sruoio iy1opt lfes ()a2raxro;o0tptnmociasls2rm( ont)tlerxfcoa1latelnes t s2xmxmpio1apeelncs s)s2tr(  ;u0oetnii3iatfm2rauvont) leomfciytlm   i o s  2urim iy1apenmfei s a2umxmp;t4aptomo3iad s rmump;(0tltoirctytlptean s;(0texoxmpou1am emics s)s2tm(mpnu0olxo f3tyt s umn s;(4trxnmfcta1latrlivi (0 etrimpno4lmt  fci ()srumxm nt1olen oeiltlaDrmn o;()texoxo ia1lp e nei;s)t2uo(opiy1am elnvia() 2ta(mooo4alenif3iydlmDuau snt0 lxrxfciydlatran i (0setmio nu1lptemfcsat)a2rmxrp;o0oeto f3tatfa em(ms;t0 rerio ia1oatraieols teuo(m nydaptnmiesas)s2tm( p;u1oltnmoeils m2eln s ()trxoio oytfmDr nvo (0 rxmio no4lme lfctat)s2rr(  ;u1texnmo3iatla uan p ()aetoircoatopt lueslt)truoxo ou1ll n ncia()arrrx oou1teeomoeils a2elu sn(4 lxnmfctatlaD lnvs;s0sexoxm ny4apeelfvtat a2ta(r ;t1olenmoctydlmDel( snu0trerxf3totoa raivols)t2xm(o oydame lneslt) Dtr(mp;u4oetoiieiytlmDrmnmo;()tltoxo iytfaDrlies;(0seuo(m3nodam  mnct ( sDtrxr ;u0oleo oetyslaDrm(mp;t0 lxrmo oo1faD  u s;s srtrir3iydale mivsls)srtrxront1aee mfetas a2rmnvo t0 exoxo3tytlpD aneolt  rtmimpno4lpenmnei (fsDrrump;u1altomieiasfs2ea(mont)trxrxrcoo1lat lies t seum(o3no4lpen nvta() 2rm(  ;o0opeoiictys sDuan o u4trxrmrciydlpD li i t0t2xr(m nudolt lfcsl(  Dtrump;u1tpxo fctytfa ua(mp;u) leoif3iodfmtrlu il()trxo(m ou1om  mncslsf Duax  oo1oetomf3iydla rmnmo;t)aetnxr oy1fm r u sl() 2xrirpnudlpe lnet t srraur ot4optnmf3iasls eaumpn(4 rtrmr oytlateau o;(0texoxm3iy4olee nci (f 2ur(mpou4olenifcils a2emn ont4tlxriocoadom e i s;(0texmiopiu1opeemncil()a2ta(m nu0apx iociaslm eln snt)tlenxfciytfaD aues s0srum(opiydope lfcs t)s2rau  nu1oetnmieils m umuvsnt4artrio3iotlpt luvs;(  exmir oo4apt mnvsat) rtmxmp;t0oee ioeildlsDum(vsnt)tetomr3totoatr n ilt)texr(o3io4al nmfviatf rrmur ;t1olxnmoctyslmDean p t4 lxnmf3ta1fpt au s;t texmxm iodll elnvtas sruru poo0tleomfciadfa rln onu4trtomf3oy1fa  auei;s s2ur(r iu4ap n iei s)s2tmumooo0ole  ieiydlsDrmnmp (0 lenmo3oadlpt an olt0s2umir3oo1opeemfes t)aDtrur ;u4aleomo3iydls rlumonu0 reomocta1fmtrlu i () rtr(r no1lpen fei t)aDra( p;t4tptomf3iyd s rmnvp;(0alxrmrcoatomDraivsl() etmxo oodlm   nvs s s2rrxr ou0texoiicias m rlump;t0 etnmr3iydlpDrau o t0trur(m3nodol  lfcs t) rtmuronu4opt iocilsfmDea(vp u0trtrio3todoa ranei t)t2uo(m3oydol n ivsasfarrm( o;o1opxn fciysla ulnvs t0arerir iadla e ies t0srurim nu1alt lnetlt)a2trump;o1tpxnmoeiyt a2ul(vp t0trerxf oatopDrli s (0trum(rpiodlmenlfetasfsrtrumono4ape io3tyt a2ulnvp;t4tltrxo iotop r n sl( s2toiopou1op e fciltfs2uaur no1aleomoeiydfs uln o;u)tlerif3ty1fat aieo;t)setrirpnudol nlnesas)aDum(rpnt4aleo f3iyd aDemuvs;(4altnxf3iydoat aueols)srxr(rpno1lmeelnet s)aDrmu ooo4oltnmo3iyt s ulnmont0treoir3ia1fpDrauvi ()trtrim3oydomtnlics s)srumxrono4alxomfeiyd m2rlu o t) renxocia1lat livs;s0 eum(r iudope lfctat)a2ua(mp;u4optnmieiytlm em(ms;u0artomrcoy1la  aneol()trtmxmpio4lmt  ncsasfsrtaxmo;u1tex mfciatfsDua(mp;u0areoxfcio1op e u s s)t2tr(m3oydlp elivt tf Dtm(m ot4aexo f3tydfm rl( pn(0aleomrciytfmtraivo t srxo(r3ou1lleemneiat  Duax  no4olx mf3ilt a ea( p;u) lxomo tydom  aneils s2toxo nu4alee nvt ( a2um(  ot4olxoif3iatlm2eln o t0tlermr3oydlateau ils) eumxr iu4amt lfcilsf rtru p;o0tet io3iydlsDuanmo (4 renmo3tytlateaivo;(  rtmir3oo1ap nlnvta() rtrxro;t1tlxn ietasla2eluvs;()tlenif3totfm   n i;(0 rto(m no1amt mfvtlt) 2umu  nu0opeo feias sDrmu s;u0tlerir totopD  ivi;()srtm(rpou4altn ivtlt arrmu  ;t0tptnifciadfs eluvo;(4 eerir3tytomDr ivo ()tetr(opoodome  ivi tfa2trxroot0aexo oeiyslaDemu s (0 renmf iotlmt  n slt)teurxr3nu1am   feslt s2raxm nu1oet mfctadla2elnmp;u4tlenxociytfm  livi;s)trxm(o oydlptnmfci s)artaxmo;o4texniietatls2rmnvs u4 eeomo oodlpt aueo t)s2to(m3iodalee ies t)arrmxmpno1optn ictls a2eauvo;()alxnxocty1op e uvils) rtmxrpiydope  fvi tfarraxrpot1opxn feiytfmDelu pnt0altnxf oytfp  lnei t  rto(r3iodol  lfvil(faruax p;t4apxoifciyslsDrm( pnt0 rtomf oa1lmt liei;( t2urir3nudoptnliei tf 2rmumono0altn oeias aDemumpnt)texoxo iydlptraueo;t)srxr(mpno1lpt livtatfarurxm ot1optoiiciad mDumuvs;()altomo3iotla   nesls  exrim oodalee neil()arta(r oo0apeoifciasla2ranvo u)trxnxf3oytfmt  u ols0teurxr iy1olee neil( aDrru  ;u1opeoiiciytfm2emumsnt0aetoxf iatlmDran ilt0s2uoxrpoy4ll nmfeil( arrru  no0tpeo oetld m umu s ()trxoifcoa1laD  u s;()srtmxrpio1ap elnctl( sDuaxrp;u0oeto fciydfs2el(vpnt4artnifctytfpD aivo;t teurim iy4apenlncta(  2ra(ronu0tlxoiociadfm emnmpnu)texoxr3totoa rauei;t  2tmim3ny4lpte ieil(fa2rr(r oo4oetn fctaslm ul(vs;t4arxoiocoodlp ean s;s s2tr(rpoo1apte fvils  2trxrpnu0tltoioeiasfmDemu s;t4tetnmfcoatla r n sls  rxo(rpio1oltemivi sfarrmuro;o1teen oeiydla el( snt4 ltomo3ia1lpDeluvslt0t2xoirpnu4lpeelnetatf Dtm( ont0tpxoiociadlsDrmumpnu)aeeoxf iy1omt aieo ( s2xoxr nu4llenmfvtl()aDrm(m ot1tex  fetys sDua(mp t)aleoirciy1fatr ueo;()trxm(m3oy1ol emiciat) 2tru o;t0tlxn f3ilsfaDel(vo;t4 rtrif3oo1fmDrlu o;s0 eur(r oy4apeelnet ( srrmumo;t4tlxoiietyt m elu pnt0teermo tatopD lnvs s  2tr(mpoy4amen ietltf Dtmump;o4opeoif3ias a eaumo;(4 exnmocta1fat  nvo s0t2trxr3oy1om  lneil()a2rrx ont0olxo ieildfs uan o;()tlxnmociodfat luvo;s) ruoim3oo1lle  fetasfaDrmxmpnt4aeeomiciasfa2rmn o u0aetrxf ia1omD aieil(  exmim oy4am e fvsl()srrrxr nu1olenioeiytfs2ean sn(4 exrif3oa1fmDelieolt0trur(o3oo1omtelfei ( a2rr(m no0opxnifciltfmDranmpnu4tlenmo iy1lmDeauvi s)s2xm(m oydopenlivtas)a2trxr nu0alt miciadls uanvp;()tlerxfcoa1oa eli il()srxrxmpou1olt miciasfarua(m ou1tlt iieiyslm em(vo (4 lxrmr tydomDeli s t0 rxoxo3oo1om nmfvs ( s2rrumpnu1apxomf3ild s2emnmp;u)tltoir ootfaDr ues;(0t2urimpiodape  neiat a2rax ooo0apxnifciad aDua(mp t4aeenio3ty1laDe ivs;t seurir3iy1ome licsas)artaurp;t4texnio3tltlm eanvs u)trermocoydfaD  u i ()s2toim3iu1olte ivtls a2umumoou1tpxoioctlsla ulnvo;t4arerircoo1omt ai sl(  exm(r3nu4llt micsatfsrraxm ot1opeoiociytlsDranmp;t0trenxf3oydom e u s;t0 rtmim ny1aptemneta(farur(mp;u4aeto ociyd s2rl(mpnu) exoir ty1fmtr n sl() 2to(o iudlpeelneilt  Dtmuro;o4apenif3tas a2em(vonu)texrio iodfat  ivol( trxm(o iy1ome lncilt)sDum(rono0tptnmociysla uau s ()tleoxrcootoa ean slt0s2urirpoo4omt mnetl() Dtaxrpot4texnmfcils mDrlu s;u0alxrir io1la elies;t  rtmxmpoy4ll  mfvils)a2trx  ;u1oexn oeiytfm emumpnu) rtoif3oytlmD ai s;s  rur(o nu1ape  ivsl( srrrx oou1tlt mi3iasfmDeauvonu)altomf3ia1fmtr neils0trtmir io4amte fcta()srua(rpot1aeenmo3ildfm2rmump t0trtnirctatoatraieols0trtrir iydal emnvi t)aDurxrono0opxoifeilsfaDuanmp;(4tetomfcoo1faDeliei t)t2xmxo3iy1ole  fcil( a2ur(mo;o1tpt iieiysfm ulnms () etnxo3oo1fpteluvilt s2urio3nu4omee nesa( aDuaxrooo4open f3ilt aDrlnvpnu0 exrifciydlm elivi t0 ruoxmpiu1ome  ncsat)srrm(  ;o1apen ictyslaDrmnvo;t) ltnmf3iadlptrlnei (0s2toxrpoodam n ivsatf 2tau onu0tex mociytla ra(mpn(0alxnif3oatfa  aueol(  exm(r ou4opt lieia(fsrrrxmpno1tetn fetys s uln o t0tltoxf3oy1opDr ueo;t teurir3nodoleelfctl(faDrr( o;o4alx  i3ilsfm2rluvp;t0 rxrmrcio1oateli i;t srxm(r nu4lp  mfvsl(f 2taurooo4olt  oeiadls2emnmp;t0 rtoir3iytoptraues;t)srtr(m3oo4lpt mietat s2ua(ronu1aeenmoeiad s2uanvo u4aetrxo ta1oat lieil(0seumiopiudale  fcsas)arur( ont1tee io3iytfaDea(von(0tetoxrcty1lm r ieilt t2xmxr3no4lleemfcias)a2taxro;t4tpto fctlsfm2em(vp u) etoir3ia1fmtrlnes ()t2tmxrpou1omte ivia(fs2rm( pnu0aeen iciadlm2umnmon(4arxoio3oytlaD  n o;(  eurio3iu1llt  neilt sDtmxmont4tptnmf3ilt aDel(mont4 ltnio3iodopDe n ol()s2uoir3iy1op e fesls) Dtmu onu0oeenmf3iydfa rm(ms () lxrif3oy1lp r i s;()trtoim nodlm nlici t) rrrur no1teeo fetys a2rln o t)aeeomfciatla   nes s0s2toxr no1al e feiatfaDtmxm nt1ale  iciydfmDrau o (0aetrmfcoa1fmD  n s s0t2xo(m3iu1lm elivsls sDtr(r ot4teto octatla2eaums;t)trtnmr to1omteanvs;()srur(rpio1apen fct () 2ur(r nu1oee  oetlsfs raumpnu)trxrif3to1lmteluvi s)setr(o nu4oltelivsa(f 2rrumo;u4tetnmo3ildlmDem(vs (4trtrxf oytoa  ai olt) eurxm3oy4lmtn netls aruaumoou0tlxoifciys sDumu o u0 etnmociodomte n o s  2toxr3nu4op e fvsat  2umur ;u4tee ifciat m ua( o ()aexrxo iytlp r uvs;t)trxoxrpiy1ll nmnes t)a2raxmoot4texn ociadlaDul(vs;t0trxrxf3oadfat  n i (0 ruo(m3oydopte ivils sDta(r ;u4tee  i3tytlsDulu p;u4aexoif oa1fmDrlu o ( sexm(r no1ole mfcs (fs2ua(r ;t0oleomfcilt m2umump;u0texrxocio1fa rlueil(0sexmxr3nu1lmtn fesas)srrr(mont0tee mi3ils mDuaumo;()tlerio3ootlmteanvilt texrxopno4llenmfvsatfa2uaumpot4alxomi3iatla rau s;t4arerxocootopt lu olt0tetmirpiy4lpen iesas)a2rmumoot4alenmietad a2ea( s;(0trxnmfcoodlmDrau sl()trumimpiy1al  micils a2umumpoo0ole  ociad m2ua(mp;() lxrir iadfp rliei;s)srum(o3oy4op elnvt s) 2umur ;t1tetn i3iadla2rm( p;t4alxnif ta1omte u o s texoxr3nudap n ncil()s2rmumont0alenif3tld s em(vs t4trxnxr iotlaDeau i;s0 eto(r3ou1ll  mnvs t)arrm(mono4aetnioeiasla ran s;t)aexnmf3oy1fp   ieo ( t2to(m3iydaptemivs ()sDtaxmp;t4tpxniiciytfsDemuvp t)arenxf3oo1opt anes;s0 rumxmpnu1altnmict ( srtaumo;o0olxnifciydla2rmump;u)aexnio oy1fp e iesls)trxr(r3nydalte fei sfs2rru  ou4tlenmfeiatla ra(vo;u0tltoxr3to1fm  ln o;()sexo(opio4ol nliei t)srrmxrpot4aptn ocias m2rln snu)aexomf3oydfpDe i il() etmxopoudol   ivtat sDrmxr ;u4optnif3iys s eln p;u0aetrmr3tadop eau s ( srxoirpnu4ap   icta( arurum ;o4tleniieilslm eauvp t)alxrxrciydlp rlivi t) eurxr oy1ope  icslsfsDrru  nt1aee iiciysfs uanmp;()aleoxo3oydfmtelivils)t2urio3nu1olenlfesltf rtmumpnu0tpt mfeiydlsDeluvs t4artrio ootoa  lu i;()sexmir oy1ap nlies sfarrm(mpoo4tlxoifeiatfm2um(ms;(4trtrxoctydlp e neils)texo(o3iu1apenlneil(fsDua( oot1alx iocilsfmDrl( on(4 rtoio totoa  li i (  etrim3iy4lle mfvsa()aDuaxmo;o4tle  o3iyslmDea(mon(4arenxo oytlpDeli sl(0srxr(o3iodolt mfei sfsDua( o;u0tlxomieiltls ranvo t4tltrif totlat  uei;(0trxoxopny1am  miet t sDua(m ou1tptnioetadlaDeluvonu4 lerxo3ia1fpD  nvo s0trtrirpoy1opeemietls  rra(mont1aetomfeiydfsDrl( pn(4 etrxf3oa1fptr n sl(  exm(rpno1aptn fvi sfs2um( pnt0tlenmi3tad m2eln o t0aetnmr3iy1op  luvil() exo(mpno4ope livilt a2rmu ooo1aptnioetydfa2rauvo;t4arerxf3tydoaD  neils) 2xmxm nu1lpt  ncta()s2rau  ;t1ole  f3iaslm ulnmsnt0texnmoctytfaDrai o;t0s2xrim oo4lleemnci s sDtaum ;o1apenmfeiys m em(vo;u)arenxf3to1faD auvo s sexrxmpiy4ameelfvia()a2um(ro;t1aex iociytla2el(von()arxrxf tadlpDr n i;s srxoxr3nydllt  fvilsfs2umxmpou4oee mf3ildls rl(ms;u0alxoxrcty1oat lu i;() rxrxr3oudale miet ()s2umxrp;o4tptnmfeiys aDuluvo;() rtrmo ta1op  lnvols sexmxr iy1lpeemnvtls)srta(mo;o1ole mieils m2um(vs t0 exnir3ta1oa  aiei ()sexrim nu4apenmfetl(fsruaxr oo0aptoiiciydls2eau p t)tleoxo3totop r neslt0t2umxmpiu1op nlnesa(f rrmxrpoo1oetnmfctldfsDemnmsn(0trxrmo3ty1omDr ivi ( srtoxm ny4aptnlfvt t sDrm(mo;t4aex mfctltlaDumu snu0 exrmr iotlaDeai slt  eum(r iydol  mncta(fsDraumpot1tpx mietlt a2elnmp;u)trerxo3iytopt auvo s)trtr(r oudlme lietlt)srtmuro;o4texomicils sDem( p;() etoif iodfpDr u ils  rtoxmpiu4lpe mnetl(fsrrr(m ;u0opt mfeiydfs rlnmp;() rtnxr3iadlm  lnvs;s sruoxr3no1altnlivsat) 2tmx p;u0apt iietld sDran s u) lxrmo3oodlptrliei;s)texoxopoy4am  mnvsa(f rrr( pnt4ope  oeiatfm rmnvo ()aeerxrciy1op raies;( trtoxmpno1opeelivtlt) rrrurpot0ole  i3iysfs2ranvp;u0 exrirctodoa  lies;s texrir3nudalt livtasfsrtrum no1apenioeiyt a2ua(msnt0 eenxoctadoaDrau slt)teum(mpoodop nmnci (f Dtmur no1aetn ieiys aDem(monu4tleomociatla eanvs;t)s2tm(rpio4lltemnvt tfs2tmx ono4opt mo3tyslaDrln s (4teenioctytlpDeli i;t  rxm(r3ny4lleeliesasfsrtrxront4oetnmietad m2umnvp t) ee
\ No newline at end of file
@@ -0,0 +1 @@
+i s t texm(r3io4ap emfeils) rumur ou4oex iieiytlsDua(ms u0arermo oytoaDr u o t  exm(o no1op nlnei ( s2rmur ;o0oltomi3iatfs ra(vo;u4aexnmocio1lmtrau s t sexoxr iydapte fcslt s2uaur ;u1tpenmociytlaDuanmsn(4altoxfctydoptelieo;s0s2urio3io4ol emieilt  Dur(m ;u4tpt  ociadlm emumon(0tetoio tytfptr ieslt0 2xr(opno4lpee nctls)srrmur ou0tlenmoeiltlm2ul( pnu0altnir3iy1fatrlieslt)srum(o oy4lme lietlt)aDrmxr oo1opeomiciyd sDumuvp;t4tleomf3to1lptr ies ()sruoxrpio1lmen iviat)a2ur(r ou1tpxoii3iadfsDrlu p u0altnif ty1lm elivs;t0s2umxm3iydom e ncsat)sDrmurp;t1alx  f3iat aDemnvp;t4arxrxf3iydlateaivs;(  eum(m iudopen fvsasf Dtmxro;u4tpt mfeiyt m2em(mo (0 rtoxf oydfmDr u ol()trxoxrpiu1lpen fctas arta(m ;t1aexo i3iltlaDua(vs u4areniocio1lp eaivol( s2uoxrpiu1op nmfcs (fsDumxroou0tpx mi3ias a emnvs;t4trtoio to1omDrlies;s0 rtrir ny4amtnmiei s aDtaxm ;t1ale mocild m rauvo (0tlenmr oodfpteai o s0trto(mpny1ll   ictasfaDrruro;u4open f3iysfa rmumo;u0 ltnio3oatfptr ies s)srxrim3ou1omeemici s) 2rruroot4apto f3tydfmDel(vpnu0aetrmocia1opt aneo s sexmir oo1altemnvs tf 2tmu  ;t0texnio3iadfm um(ms t)texnmrctadfpD  ueil()t2uoxopno1ol elnvils  Drrx o;t1tpxnmo3ild sDrln p;u4artrmr tadoaDr u sl() 2tm(m ny1opt  ict t)srrau  oo0aetnmi3iadfs2ra( onu) lxomr3ootop e i o (0trurxopoy4aleelfei sf 2uau p;u0apto feiatlmDea( p t0 etniociadfptelnvols s2toxrpoy1lp nmnesatf Drrxm ou1tpxomfeiytfa umump;u4aeermo totopD  uvi;(0sruoxrpoo4lmenmivi sf rum(ro;u0tpt mf3tytlm2ul( o;(4tltrmrcoodop   n i;(0 2xrir oydoltemfvi tfsrum(rp;t0alxnif3iad aDel( snt0arerxrctydlmteau o t t2xmxr no1ome lieiat  2ta(mo;t4tetn oetls sDea(vonu4teeoio3to1oa  lnei;t)trtr(o3iudamenmfes s a2tmurpoo4openiicilsfaDrl(mont0tltrif ta1oatranei (0 rxrim3iudamt  ictlsfsruaxr ou1tetnmocilslm rmu snu) rtrifciodfaD anvilt0setmir iodom elieiat artaurp;u0alt ifeias m ulnmp u4tltrmr3oydfa  aivo;t0s2trir3nu1omt  fvs sfsrtmxm ;o4tet  fetat m2emn o;u)tetomrcootlpteln ils0 exrxm oudamenliei t arrmxrp;o1tleomo3iat sDul(mpnu)aexrxociy1lmDraivsl(0 2tmimpoodop  mfcsl()a2rauro;u4alxo ociltlaDrmnms;t0altrmrctadfaD auvi ()t2ur(r iu4al  mfeta(fa2ra(r ;u1apeniiciltfa rlums;u4teenxo3tytlpDeluesl()trtoxo3no4alenmfvs tfs2um( o;u0tetn fciat m umn p;(4teeoxf ia1lm eauvol()tetrxm oydopenmivtls  Dtaumoot4optn ieiasfs rmn s (0aetnxf oy1fatr ueil()trtoirpio4omenmivi s arurx  nu4apt  i3tls s2eln pnu4 etrmf tydfateaivs;t)setoim3nydlmenmfcs (fs2taurpot1apenmi3tasfm eanms;(0aeenif3iytfmtr i s;s0t2xo(r oydaltn neias s2rr(rpou4oltn o3ilt m ran p;() rxnir oytoa e ieo t0s2uoxr nodlmenmnvs (  rra(rooo4ale  iciltlsDumn p u4aeenmr3iotlptranvi;s seum(o3ny4lleemneia()srtrurpot4tle  iciasls2rmnvsnu0altrio oy1lm e n ols0s2tm(opiydlp  mncsl()aDra(m ;o0tpxnif3tydls uanms;(4tlermf oydlpDrauvi;s) 2xrxo3oydomte nci s)sruau pnt4opt iiciytls eluvs (0texomo iatlp  li s;s  2xmxopnydame  fesls)aDrmum ot0oexnmfetlsfs em( o;t0aetoio3tadlpt auvo;(0 etrim ou4op nmfcsatf rrau ono0aptnmfciaslmDulnvont4teeoiociy1lm  luvo;s) rtr(o oy1lmtnmiesas)s2ra(monu0tpx mietltfa2ra(vpnu)aexrxo3totlp   ieo () rxoimpiy1omeelnci t)sruax p;u0oee moeiyt a2rmn p (0 etomo3oatomteauvslt0tetm(o iy1am elnesas)srurur ot1ole moeildlmDrauvo;u4texrmrcoydlp  lu olt0srxo(o3ny1lm e fvsas  rurumpoo4apxoiictys aDea(mpnt4 rtnxr3oo1fm  aneilt  2xrim io1am n iciatfaDtm(mooo0opt moeildlm rlnvs ()arenio tytomDrln o t0texmxopoo4apt livt s arraum no4apeo i3iyd mDumumo;t4trenmo oy1om rauei (0s2um(opoudllt  nci ()sDuaurooo4aetnifeiasfs eluvsnt0tleoxfcoydom e nei;s)seuo(mpiu1ole  fcs sfarumurono0altnif3iadfsDulums (4tleomocta1fa  luvi;( teuo(r3oudlm emfesl()a2rm(mpot0opxoioctltla ranvp;(0 rerirciodfpD luvo;()t2trim iy1ll nmfcia()sDrrump;o1opeo feiltfaDem(mo;u) eeoio3tydopDrau i s  2xrxopny1omtnmnvs t  2tmuro;t1tpto fctyd aDemnms;u) eeoxo3oodlaDrlueo t)srxo(m3iu1ll  lict t) Draurpoo1apt ifciydlsDem( snu0trenxr3ia1oa  li i (0 eurxr3oy1lptelncilsf rtm(ro;t4opt miciydla2umnvp;t0tetnxo3oydfaDrlnvi s)t2tr(r3io4olee fvtat arrrxrpoo4oltomfetyd mDeanmsnu4aeerir oadoate ueo ()trtr(m no1ll eliei (  2tr(rpot1opx ifeilsla2umuvo;()tlenmo3totfa rai i;() 2xrim3io4alenmfctl()arurum nu1openiictld sDra(ms t4tetrmo3oytlptr uesl(0setrxo3iu1ol   fet t)arua(m ou1oetoif3tldlmDuanmo;t4tlerif3ia1fpDe u s t) 2tm(opny4olt mfvias srum( pnu4alxoioeiydla eaump u)teeoxf3oo1laDe neilt setoiopno1lltnliei ()s2uaxronu1altomieiaslmDumnvonu)aexnmr oadlmDraies;(0srxoir3nodaltemnvsat)sDrrx p;u4ole ioeias m ulu pnu4trermrciy1faDeauvi;()teum(r oydap elivils  Drr(m nu4aleo ieiaslmDeauvp t4 eeoxrciy1fmtrlivolt)setm(r3ou4lp  lfci s a2ta(ronu1teto f3ilsls eau s;u0artrmrcoytfmD lneilt trxr(o3iodopee nci s)arra(r no1ape mocilsfs um( o (0 etnirciadlp eaiei s trxo(rpiudapeelnet (faDtmumono1tee ifeiad aDel(ms;t) exrifcoydop ranes t0 2trim3ny1al nlfctlt)a2uaum ot0opxomoctytls2em(mpnt)trtrxf oadoate nvi;s trxoxr io1apenmfei sfartmx  ;t1apxo f3iysls rmnmo (0tetnmrcoodopD aivi ()srur(rpiu4olen fcias)s2uaxr ;o4apxoifeiysfsDum(vpnt)altrircoa1la e nvs;(0t2xo(o no4lpt mfcs s) 2rmx oot1tpxo octyd s rluvpnu0 eenmo3iytomtranes s  2xr(o no4al emivsls  Duau onu4tpt  feildla uanmo;(0tetoxf ia1omtelivs t0srxoxm3oydlp nlfvt ()aDtr(m nu0oex iiciydls2emn o;u) eenmo3iydomDr i i t  exoio3ny1oltnmfeslt s2rrur ;t1oexoiietas a umuvp;t) exrio3iydla   nvo;()s2tr(rpnu4ap e feil(fsDtmu  nt1olx iociadfa ulumsnt) exoir3oydlmt lueslt  exrxm oo1oleemictls artr( pou4olxo iciltlm2umumo;u0tlxomo3tatfaD luvo;s) exrxr3iu4ame  ietas aDra( o;t0aexn feiadfs2eauvsnu0 rtnxr ty1lmtean i;s0 exrxr no4lm eliviat  Dtaurpot1teeo i3iytla2um(msnu0 rxomr3iatfpt au o;t0 rxoiopoodolenlnei t) rtru  nu4tpeomfcilslm2elnmp u0trxrxo3to1faDe uvs s t2trir no1altemncsl()a2uru  ;o1oleo oetysla2rau on(0trxnxo oydoate i s;s0 2trxr ny4lpt mivs s) 2rru ont4olt  ietlsfm emnvo;u0tetnif oy1op  anei t0trtrxm3ou1lpt livi sfsrtmx  ot1oetomoetysfsDelnmp (4 rxrmfcto1fmDeli s (  etrxr oydlpenlfvsa(  Duau  ;u0olxo fcildla2umn snu4alxomf3oodlptelu il(0trtr(m iudlm  mncsasfaruru  ;t0tle iocilt m2umnmp t0 rxomf oytfpDeli ol()trxo(opoudopeeliesls) Dumum ;o0tpx ifeiys m2eauvonu)tetomocoatop   uesls texr(r nu1lpte ieilt) rtax onu0oee mfciysfm2umuvp t4 etoif oodomD luei () 2xoir3no1omen iet sfs2uau  ;t4apx  ieiytla2eln s u0trxoifcio1fmtrlu i;t  rxr(o ny4lm nlfcsasf Drruroou0tlxnmietatlm rl(vp;(0aexnxr3oodomtrlueils trumir3iu1apee fet t)a2urxrono0opx iictldfs2rmn p (4alxoircia1fm   ivs s  2xoxm3iu4om nmfcsl(  Dtm(m ou1tpeo f3iaslm ulnms;t) ltomo tydomtran s;s) eum(opnu1lpte icilt aDtaxrpoo0alt mo3ias s2uluvo;(0trenxr oa1lp  li slt0 rtrxopiudlltelnvils a2umx  ou0ape mictydfm2rmumo;(4texoif3to1lmt an sl()s2tr(o oodll nlietlt) rra( oot1apxoif3iysfa rl(mo;u4 lxnmociydlmDe n s t trurxrpno1ll e fviltf 2umx  ot1tetoioctytfmDul(mpnt0teeomf3oydlp e ieo;s0 exm(mpio1optnmfcsl(farrrum nu0teen oeiydfs ran on(4 eermocoatoa  lnes;s0srtoim iu4lptnmfcil( s2ua( o;o4aleo i3ias s2emnmp;t4aetnio3oo1la eln sls  rum(o3nu4op e fvias)a2tr( oot1tpxn oeiatfm2elnvp;(4trtnxf3iadopD an o t) 2xoir oydlp elfcsas  rtauro;u1aeto o3iyt mDelu on() lxnioctytoaDeanvi;s0srxoimpiy4opte ies tf 2tmxr oo1aeto f3ildla2ran on(4 lerxr iydla  aueo t trxmxrpiu1amt mici t arrmxmoot0aet mf3iydls2elnvo;t0 rerxr3oatom eanes t srurxopoy1apt micsls)aDrauro;t1alxomo3ias mDea( s t4trxrifctytlp rlieo;()teum(m oy1lpt  icilsf 2trurpnu4tpto feiysfsDulnvpnu4 rxnxo3iydlmDeaiesl( t2xm(o3oo1ope  fcsasf Durxm no1oeeoiictad m el( sn(0 eeoxo3iotlm   i s (  etm(r oy1lmt lnct s)a2trx ont1openioeias s2ea( s (4 lxomoctatfp rli sls0 rxrimpiydolen fcil(f Dtmx  ;o0texniiciad mDua( ont0texrmr3oytlmte nvslt texm(rpnu4ll nlictasfs2umx p;o4oleoifciyd aDemn sn()tetoir3ootfpt  u i t)t2umxmpiodam nmfeia(faruau pnt0opeo i3iltfa ea(mo t) leniocia1oa e ieslt0 rxmxo oy1al   fvtlsf rtmur oo1apt  fctatfsDean s;u0texnmrcto1opte ueo t) exoxm3iudaptnliesltf 2ra(mpot4optnioetldlm elnvp u0 eeomfciytoa elivs;s0seurxopoudol n ict ( arua(r ou0oleniocilslm ul(mp;u0tlenmo io1lmtrli s s t2xr(mpou1lpeemnesat) 2umx o;t0tpx io3tad m2emnvpnu4alenioctadoat  nei;(  2uo(o3no1ale  ivt ( srrrurpoo4olen i3tyt s2ulumo t4tlxrxrcoy1lat  u i;( trum(o io4al emnvsatfsrtru pot4oltn i3tlt sDemuvo t0 exoifcto1op rau o;s  etrio3oydll emictl() rurum ou4opxo ieild sDea(msn(4alermr tytoa raneols0 rxmxmpoo1llt mics s)a2trumooo1alx ii3ild s2ua(vs;(0trenxr iytfmtrlnei;( trtoio3ou4lltnmfvtls) Dtmur ;o1aee  ieiytfmDuau o;(4tleoxfctatfm eluesl()trumxr iu4altelfvtat  Durxmono1oleoiictlsfaDem(vo;t) lxrmfcoa1op r ues s0srtoim oo4opte fetlsf rtr(m ot1aetoiiciysfs um( o u)texomociatlmte nvol(0teumio3nudlpe mfctas sDtmu pou0openiieilslaDrl(von(0teenio to1latelneo s sexoim no4ap e ivt s  rtmxr ot4apx  fciasls emnvp t)trtnxr3oa1oa rauei t  rto(rpnu1lle lneia(fartmum ot4oltoifciyt a uln s;(4arxnio todlpt anvi;s)s2tmirpno4ome licil(f 2tmu  nu4tlx ioeiatfaDel(mo;u)aleomrciydlmDe ies;t0 eurio nydol nmiet s)s2tauro;t0tle ifctatlsDem( on(4tlxrifctadlmDranvsls0seumim3no1al emfviat)arta(monu0aet moctldfa rl(ms;u4 reoir3oo1lpDeaneol(0s2xrxrpnodop  mneslsfarrrumono4opeoii3iat a em(mp;u)arenxfcoadlm r uvo;t trtoim oy1al   icilt)aDra( pou1apx  o3tldlaDuan snu4 rtrmr tadomtr i s (0setoio3iodamee nesas)srraur ;u4tpx iociysfa2ran ont4aexrifcta1fmt aues;(0 exmio nudalt  nes ()sDuau pou1tle iictasla2rmn p t)trenif3oydlpD aueolt srxo(m3iydolt  fvsas)sDua( pot0oexniieilt a em( on()tlxnio io1op r i o;s0s2tmxm ny4olt  icsas)a2rmurooo1opxoio3tls m2el(vs t4trenio3ta1latelnvi;s0 eto(mpiy4amee netlsfsrrauroou4aee  ictydfs rluvonu4trxnifcootlmDrlieils0seumir oo1lpenmfcsas  Dra(r ot4apxnioeiydfa ulumo t4 eeoif iotfptr ivslt)seurio oo1lleelnctlt  2rrumo;t0aee if3tyt a umnmo ()texrxrctatop rauesl( tetoio nu1ap  lfesas aDrmumpou1alx mi3iyt s ulnvs u)trxrif ta1oatrli o;s  eur(opiy4lmtnlietas) 2tmumoot1aee mo3iadfa el( p u) rxoio oo1laDr uei s)srxmim3oy4op n fei ( aDrm(ro;t4tptoifctaslm uln onu4 eenioctytop r i ils0t2xmxrpnu4omenmfesas) 2rr(ront4tpx  i3iyt m2rl(mp;u0aexomrciy1opDr n slt srxmim iy1ll e fesas)srururpno4aetnif3tltlaDrau o t0 etnir io1opD  u i ( sexo(opnu1lmee nvs tfaDtmx pot1tpxomocilt s2uan s;t4tetnio3oydfmD  i sl() 2xoiopoydop  lncias)artm( p;t0tle  o3ild aDulumpn(4 reomo3to1la rlues;s) 2urir3iy1opt lictlt) Drmx pno1aptn oeiyt s2ea(vs;u)artomo3oodomDeluvslt  rxmimpiodll  mnvia()sDtmxmpoo1ape  octld a ra(mo;u0aeeoxr3oadomDe nei;s0srtmxmpnydaleemnvsl(fsrum(rp;t4tpt ifcildfm2uln p ()artrio3tydoat au i (  2umimpoo4ll   fctlsfs2umu  no0oee moeiaslaDra( p;t4arxrmrcoydop   i olt  2umir oodomtelnet s)a2umu p;u4tpeoii3iat m rmnvpnu0 etnxf tatoa eaivilt srtoim3iu4omtelivi t)s2tax  ou0opt  i3iasfm2rmuvsn(0artoiocoodfp  liei;t) 2umxopny4llenmicsat sruaurp;t0aeeo f3tld m2em(vsn(0 eenif3tatlptr u o s t2urio3iu4lpeelnei ()arrax oot0oleoii3iat a2umump;u0altnio iadfaDe ivo;s teumxm3ny4lmtelnct sfaDurx poo0olt iociadlm ua(mp;(4aleoxo3ootop rlivi t  rxoxr no1lm emieia( a2ta(rp;u4tpto fetlsfsDulnmp;t4altnxo3oo1lpteau o;t0s2xrxrpiu4lptnmfvsat a2ur(monu4ale iociys aDranvpn(0trxnifcoy1oatr i s;t)s2xm(mpoodap nmnviltf rrmumpot0apx  oeiasfsDuau on(0alxoxf oy1op r u ils  2trxm io4altnlfvt s  2umurp;u0olt if3tatfsDrl(mp;u0 etomo3oy1om eaivs;s  etrxo iu1ll n nct ()arum(  nu1oexn fctltfs eluvs (4aetrmr3iydfa eauvs (0t2xr(r3iu1olenmicsls)aDra(r oo0olto fcildla uanvp;()tltnif3tatfptelivo;( t2xmirpou4ll e ivs t) rumx oou0aetomoctytfm ua( p;u)aeerxr totlmtelu i ( s2trir3iydame  fvil() 2tm(rpno4tpxn f3tltfaDuln p u0 rxomfctadfm  aivs;s) exoio oy4lm   ivils)sDum(  oo1tlxo fetld m rlnvo (4aeeoxo tadopDe neols s2umir oudlltnmfcil()artrx p;o0apeomieilsfs2emn on()tltoxf3oo1fm raivs;t)srumxm3iy1openmnes tfarta(mono0teto f3iydfm emums;t0 exrmfcto1lp   i i;s)trtrio iydal emneias) 2tr(ro;t0alxnmoeils a2elnms t0arxoirctodom   uvslt0setm(m iudam  mfvsltfsrrau oot0ope ifciat m2rl(vo;()areoir iy1lmD aivo s t2toir iodll nmivs ( sDtrxro;t1apxo ieiytfmDra(ms u0tlerxf3oy1lpt lneol()trxmxopiu4al n fcta( arumum nt1aptoiieiytlsDeau snu0arxoxo iytopDrai i ()srxmxm io1ll  licias sDuaur nu4opx  iciysfm elnmp u4alermr iadfaDrau s t  2xm(r3iu4alt  fctatfsDrm(ro;o4apxomfcias s emnmp;u) rtoxo3iotoaDelues;s tetrxm ou1al elnctl(fa2rrxroou4optnii3tytla eluvsn() rtnxr3iy1lm rlivs (0t2to(r no4optnlnet sfartaxronu0aleomf3iytfm2el( onu4arxrmocoa1lpDr uei;() exoim3io4omenmncs t  Drmu  ;o0tpe  oeias aDrmn p;t)alxrxo3oo1fat  uvol()s2xm(m3nodamenlivsl( arraumo;u4alxoif3iydlmDeau o u) rerifcootoa e uei s  2xo(m3iu4ol emietat) rur(mpoo4aleo fciys s2elnmsnt0arxnxoctytom e u ils)s2toio3ou4ol emfesas sDra( p;t0opeoio3iydfs2ea(ms t)alxoxf oatfmD luvo () 2to(r iu1lmee fci (fartr(mp;o0altnifctasfsDrlnvs;() etrxo3oo1lmt  uvi ()t2xrxr3oodlltn fetatfsrtru  oo0oltn iciydla ulnvs u)aexomocoydfm  aivs t0 eumim3iydam  lnct sfsrur(rpno0aee ifcild a ran o;t0teeomrciydlmDraivo t0 rxoiopou1lmen nctls)a2tau  nt0tlenmo3iat mDemn o () exomo3iydlp e i ilt s2toir iy4ap  lfesl( arrrxm ou0apx  f3tysfa2ea(vo u0artrir oatopD anvi;t sexo(o no1lmtnmfcil()srrrxroou1ape  oeiydfa emuvs;(0 leomf3ta1fp rluei;s srxrir iy4ll   ict (f Durur nt4teenmo3ildlm ranvsn(4tlenirctydopDeau o (  2tm(mpnodale liet tf Dtrump;o1apeo ocildfaDumnvo u)trtnmociotlpDr i i;s0trtoio no4lltemnesltf Durx p;u1tpe iieilslaDuluvpnt) rtnif oo1lmtelueslt)s2tr(r oudalenliei tf Drr( p;u0aetn f3tydls2ea(mont0aleoircoydopDeauvols) 2xoim oy4lleelfvi ()aDurxrpnt4tpto oeils s2ul(mo t4 lxoxfcoatfmtrlnvo s0texoxopiodoltelfet (fsrrrum nt0tpxn ocilslm elumsnt)treoifcoatopD an o;(0trxmxo ny4lpte fvs t sDrm(r ;o0tlx mietyd m2ua( snt0 rerif ootfptr nvslt)srurxmpnydlp emneil(fsruauro;u4ape mo3tltlaDumnms;t0 exrio3ootfm r n s;s)trxrxo oudll elnvsasfs2rrur oo1openifeiydfs2ran s u0tleoif ia1lptrli olt0t2xmiopoy4ll emieiltfsrrr( oot1opxnmfctldlmDuanvont)tltrmo3iy1oaDelnvsl() eur(rpoo4ol  lfvta( s2rmu pnt0opx mfcilsla2rmn s (4aeenio oy1oate ivo s teurxo iy1al emnvtat)sDuaxmo;t4opxomfciysfa el(msnu)artomo3iotla r uesl(0trxr(m3oudoptn fviat)arrmxrpoo0olxnifcildfm rl(mp;t4 rtrif3tytfmD au s;t  rur(rpio1aptnlfcils sDtrxmo;u1oetnif3ilslsDulu on(4alenmr3oadfpDe ieo ()srur(m ny1oltemietlsfaruaxmono4oexo i3tldfa2uln pnt) exrmr3iy1lmte u i t)t2xrio3iy4omeemnvils)s2taurpno1tlto fcildfs elumonu)tlxoio3oo1fate i i;t)tetmim3iy1lpe  fetls)s2tax onu1tpt moeiasfsDra( p;(0 rxnio3oytlm e u o s texo(o iy4amtnlfctasf ruau  ot0apxnio3tldfs2ul(vonu0trtrxo ia1fpDrluei s)t2tr(rpoudom   ncias a2ua(m oo1openiocils s2uan o t4tltrxfctodfpDean o;s  rtoir oo4amtemieta(fsDrmumpot0oeen oeiasls rlnvo u0tlxnifctydom  ai i;s0 ruoxo3ou1lm emieta(f 2umxro;u1opt mieiys a uanvpn(0 exoxf todfpDrln s t)seuoiopiodll e ieias)artmumpou1aptoioetldfmDua( p u4 lxrxfcta1lmDe uvo t0 exo(o ou4ape mfcslt)sDtr( pnt4oltn ieias a2uau snt4 exnif3ta1lpteaueols0tetrxo oudapeemnei tf rrmu onu4oetnio3tldlm ua(vsnu0arenxr3to1opD lu o (  rtr(m nodll elfesas) rta(  no4optoiictatls2el( s (4aexoir3oa1fptr u s;(  rxrxmpny4lptnlnei t) 2rm(m oo1tpxoif3iatfmDrmnms u)alxrio oydomt an s t)srumxr3no4ll   neslt a2ua(rpnu0olen oetlslmDemumo (0aeeoio oydoa   ieo s0 2uoxr3oodol  mfvtltf Dua(mpot0ale iociyd sDrlump;u0 leniociytfm eli s;t  2uoxmpnu4ol e feil(  Drau ooo1oeeomi3tadfmDran pnu4artrmr3oytfm r uesls0 rur(o3iu4lmt mfeiat) ruaxro;t4openiociytfa elnvo () rxoir3oytfa  auvo;s)srxoxo3ou4olen nvi ( arra(monu4oex ioeilt mDelnms;u0 eenio iotoaDr neo t0trtmxm io1lmtnlfvi s)sDrm(m ;o4teeomictytfmDrau pnu)alxnmr tadopDrln s;t) rumxo oo1altemivil()arrmumont4tpen o3ilsfm2emn p;u4trtoif totfmDr n o t) 2trimpnu4lltemfesat a2tm( onu4oetnmietltlm2emumo;u)aleomocoo1oaDran olt)teumio oydapenlfcs tfaDurx pot4teenmfeildlmDulnvon(0trxrxfcto1op e ivo;s)srum(o nodal elfei (f 2rmur nt0tpt io3iltls2ul(vs t) etomr3oodfpteaivsl()setoir oo4al   fvtl(  2raumpno1altomoctls mDra( ont4aeerio oytoatraieo;s  2uoio3nydlp e nes t  Dtmur ;t0aet  feild sDrl(mo t0aetomf3ia1lat aieo s srtoio3oodllee ivslsf 2umxmo;u0tlxnmfetyt aDea(mo t4arxrmr io1omDe ivsls s2to(r3no1ap e nct (f 2rrurpno0tlxn f3ildlm rau p t4 eerxf tydfp  lieo s0 etoio iydllee neil(f 2ur(  no1aptn oeiytls rlnvon()aeeoxf oo1lat  nes;s0seuoiopiodom  mfvt t)sDurx pno4optoii3iytlm ul(vs (4arxoxo tadlaDeau i t sruoimpou1ap n ict t arua(rp;t0optn o3taslmDrlump u) etnif3ta1lm rlueol()tetmxm3ny1lmt mfcsas)srrmur no0oetniociat s ua(vsn(4 leomo tydfpDeauvol(0t2ur(r ny1oltnliei sfsrur(ro;o4oetomfctytls2ul( on(0tltnif to1oaDeai i s0 2tmim3io4lm  mnviatf Duax pnt4apt ii3ildfa2rm(mo u0trtrif oatop  an olt setmirpnydllt licsa( arrr(rpot0tee mfcild sDeanvo u)alxnio io1omDe nvo t0trxmxr3nodome lfvia()aDuauroot1altoiocild a2rl( s (0aeenmf oatfmteaues t0srxoirpiu1oltemnet sf Dta( poo4oet if3tysfmDranvsnt)texnmr iatlmt luvo;t0 rxmim3iudape  ncs (faDtrx ooo1oeeo icildlaDrm(vo;u4aeeoifctytopDrauvo s  2trim nu1ll elfciasfartaumonu4opxo ietat aDra(vsn(0 leoxo3to1oatelieo;t0sexmim nudol nlicsas srtaurp;u0tleomi3tadfa uluvpnt4 exoir3oo1fptrluvolt0texoxm3ou1op  miesat  2ta(rono0alxniocilt s2um(mo t) lenxf3iydom r neo;(0t2trxrpiy1oltnmfciat sDrmxmo;u0tpxomi3iytla2ua(mpnu0arerxrciotfaDeauvilt srxoxm3oo1ame lncsasf 2tm(  ;o4tex mfciyd a2ran onu0texnxr oa1latrlivilt0s2ur(opiu1ame  fci ()sDtmxrpot4opxnmociatfm rluvo;() exrxfcoytfateluvi;()s2uoir3nudal n ncs ()sDra( ono4oetomf3iaslm2eluvs;t)teerxf io1latr u s;t0 rumxrpiu1ale lies (  2rr(r ;o0aleoio3ild sDra(msnu4 ltomf3tatla elneslt)trtoxm3io1ap  mfvt (f Dua(mono4oeen fctysfsDemu o;(0 leomr3oadfa   n o;t0trurio3iy1al  lfvilt) ruaxmoot4tetomietys sDumnvp u4aexnir3oa1oaDr ies ()srxm(o nydol elncs s)s2rmumpoo1tltomocils sDumu snt4 rxnxf to1fmtean s t srxmimpio4apt  nctls)s2rrx  nu0tetnmfeilsfs2uluvo;(0aeenmr3oy1lmDrlnes t0srtrim oo1alt mnviat aDrm(  ;o1oeeomiciadls rauvp;()tetnif3ta1opDraneol(0srtm(o3nudap n fci s s2ur(rpnu0alxomietls a2umn o t4alenmr3tydlpD aiei ( seto(r3nydop emietlt a2um(mpno4ope mo3iadlm2rmu p;(0trermfciatomtrlues;()sruoimpnudap   fcslt) 2rrx  ;t0tlt mfetatls2ran ont)tlxnmf to1oaDr iei t0setm(o oo4aptnlfei tfs2uru ooo0oetomiciltfa uaums u0 eeoxocoadfatrauvs (0 rumxo3oy1olenmneslt  2tmum ;u4open f3iydfsDean o;u4 exrxfciodfp  lies;t  exmiopnodlptnmfct tfaDraxrp;t1apxnioctadfsDuluvp;u) exrif todoaDe nvslt  rtrxr iydolee ncsltfaDuax  ;o1oeenioeiad a ulnvs t0tlerxf3oodlm elivi ( srum(opnudal   fetl( arraurpnu0olxnmoetytls2rlu pnu4 exoxr3tydlatelueil( srto(opoy1am nmies ()s2ra(mpnt1oet mfciydla2ul(vsnu) rxrmr3iotopDeaueil(0truoir3oydll e fctls) rumxmpoo4alxo fciysfs um( o t0 ltrmrciy1oaDrlnvo;t)teto(o nydam   nci ()srumxmo;u4alenmi3iyd m em( pn(0 lxoxfciy1lmtr i s;t0t2to(o3ou1op emfcs t sDra(r ou0opxnmi3tydla2raumo;t4tltomf totlm e iesl() exr(opny1ap nlneils  rurxrooo4oexnmfctatfa ea(vo (0 eenmfciodom eanvi t0s2trio3ou1alen ncia()srta( p;t4teeoifeiat aDeanmsnt) lxrmr oa1omt lneo s srtr(mpou4apte ncs () rrauroot4alxnmictatfaDua(vs;t4 rtoxf oo1om eaieo t) rtrxo3nu4lmen ies (fsDtrx o;o1oltnmocilslm rl(vs;u0texnmfcty1oaDeanvs s)texo(rpiy4lpe lietat sruru o;o0opeo oetldlm elnms;(0arxnir3iadfmtraues;t0 etrxr ny1aleelfes t)aDtaurp;o0tetniieild a emnmp;u4 rerxrcoa1oat  nvol(  eur(rpiy4lme micta(fsDtrx oot0oeeoiicilsfs2umumsnu4texoir tadfmD  ues;s) 2xo(m3iu4alee nes (f Dtm(ro;t4tpeoif3iyt aDemn o;t)tlenxf3oy1oa rlivol(0t2xmim no4omt lfvs s a2rmxrpno1tex mi3ildfmDrl( pnt4tlxnmo oodoptrli i ( s2xo(m3oodlptemfes s)a2taxm ;u1aexo i3ils s emumo;() rxoio ootomDrlieils  2tm(rpoydolenlnvia(f rurxmpot0olx  i3tltlmDeln pnt4tleomoctydfmt ai s;s tetmxm oy1ape  ncs sf 2rru p;t4oleoifctad m2ulnvo;u0 ltriocoy1faDeln i;()s2tmim no4ol emiei s sDur(rp;o1apt ifciatla2rluvp;() exrio oytlpDrlivo s s2tmirpnu1opte icsasfs2rauroou1teto o3iat m uaumonu4texoxocty1laDeanvs s  etoim3iydapt  nct s)aDtrxrooo0apeo oeiad sDeauvpn(4tlxoxf3oodoatelues s  eto(r iydll emicta()sDtmu pnu1aleomfetasfaDuan o t4 renxo3iadlp r i i () 2uo(r3ny1llenmfetatfsDurum ;u0tlxoii3iatla2umu p;(0trxnmfciydoa rai olt s2umxo no1lmtelnesls)srta( ont4aeenifciaslaDrmn o;() lxoirctatop   n s s)srumio iydopenmfctlsfa2rr(mp;o4oleo ieiatla ranvp t) lxoircio1lpt auvs t) 2ur(m nydam nmnctas)s2um(mpnt4oee mfetls sDrm( p;t)tetoxr iadlpD auvol(0texm(m nu4al  lies t  rtmumont4tpxoii3iydfa2um( p;t0aeermr3oydfpt auvslt t2xo(r no1lme mnvsl()sDum(r nu0olt ifctatla2uan o;u4alxnircio1omt aivo ()t2umxm oodap  mfvia()s2ua(moou4tpt  ocildfa2em(vp;t4 exoioctytfat luvols)srxmim3iudlp emnct ( srumu  ;u1tpt  icias mDemumo;(0 rxnxrciytlmDe ues;()t2urir nu1apt mfei s) rta( pou0tpxnifeiysfmDeln snu)aeermfcio1fm r nei t) rtm(r3oudlptelfeilsfaDtr(m ;o4oet ifcilsfa2ulu p u4tetomfcootom eanvs t0s2urirpoy4alen iesa(fsDurumoot4tpt ioeiysls umnmp;t)artnxr3tydfa   ivs;s0sexrxmpou1ll nmfctls) 2tru pnu4tetoiiciad s ra( o;t0trerxrcootlmte ueol(0seur(rpny1lltn iei s  rtmumoou1alt io3tldfs ul( on()texoxf3tadfaD lneslt) rxm(rpiu1amenlfvsasfs2um(ro;o1oleomfctldfm umn onu) rtoxo tytoaD aieo t  exoimpnodoptnlfvi s)a2uaump;t1apxn ietatlaDrlumpn(4aexrifctydomt lneil( s2xoim oo4alt livilt)a2ua(mono0tltoif3ilt a rl( o;(0 leoio3oa1fatr n ols)sexrxrpiodom  mnviat)srtmxmp;o4alx mo3tydls2ran ont0treomf todfa rluvils  etmxm nu1ameemivsa(f 2umumo;t4optnifeiyt a uln on() eermo3ootla rlnvilt t2tm(r nodale lfvtls) rum( p;o0texn ictls s rmn s t) lxnmf iytfatranvi;s trtrxopiu1lmee nei s) Dta(r nt0aeenio3ilsfa2rlumo;(0trxnxr3iytlp  ai i;t)s2toimpnodll n nvsls)sDur(m nt4tetomoetltfs ua(mont4texnxoctatop   i i;t seurxrpnodam e fciat)a2rm(r nu1tet ioctltfaDrlnvo (4arxrif3iytlmteau ol()teumirpnudom  mnesl(  Dua(rp;t4oetnmieiytlaDulnms;u)aeeomfctadlate nvo s0 euoxmpoydlpee fcs t) rumump;o1tet mo3tltfmDumn p (0 lxnxr oy1fp  aneo t) rxoxmpou4ol nlnctltfarumumpou4oexniietatlaDra(ms ()arxnio3iy1laDelivil(0srxmxm3io4ap   nvta(f Drm(mo;u4teeomi3iaslmDrauvp u4teenxf3oy1fp  aues;()teurimpiy4lle mfvil()srumu  nu4tpen i3ilsls rauvonu4 eenif3oy1fpDeau o s)teto(mpiydlptnmicsas) rur(mono0apx  o3iat m2rln s t4texnxo tytoate u o;s0s2uoxr oudape lnctl() rrr( poo1tex if3iltfa2rmn p;u)trtoif3oy1lmD  iesls0 2tmxmpou1omtnlnvt s) 2truroou4olt mieiytlmDulumsnu0aeeoxrcio1lpDelnvilt seur(rpou4ll  lfetat) Drmxmp;u0oeenmfeiydfaDua( snu0 lxrir totfatraivo ( t2umxr3oo1lmenlfetlt)srrmu ono1apx ifciyd aDra( s;(0 etrmfcio1faDrauei;t)sruo(o3iudlpt lfei ( artmur ou1tee mieiadfsDelu s () exrmfcoo1la rln ils0 2xr(m iydop   fvs t) 2ur( o;t4opx  oeiasfaDum( p;(0aexomf iydoat  u ils0 euoim3iudapt  ivsa( srtm(mp;u1alxomi3tls m2eau o u4arxrmfciodfp rai s s0sexoxo3nydom n ivtl()s2ta(m ou1openioctaslmDem( s u4altoxfcoodlpDeauvslt0seumiopoy1olenlfvs ()srurumoou0tpxoifctas m uln on(0tltoxr3oydlm elu o s)t2urim3nu4lmt lfesat  2taumpou4aexo feiltls emnvon(4aetrmrcoy1oatr iesls)texr(r3oydlm elfes s) 2rauronu4aetnmoctas mDum(monu4trxnir3oa1faD  nvi;t0 etoxr3iy4ol  lfvtl( aDtrump;o1apen octasfsDraumo (0artrif ootfmDrai o;s  2tm(m iudlleemfvt s aDraxmpou4oeen f3iltlm2ranms;(4 ltrxo3iydlaD  uvs () eumio nu4al e fvils  2ta(  ;o1oetn fcildfa uan p (4trtnmf3io1faDelnvol(0trtr(o3oudam   ivtat)srrrxrpnu0tpe ifeiatfsDea(von()aexnir oatoat li o s) rtrim ou4ll nlnet t)aDtr(moou4openmoeiys m rm( p u)areoifcoodfaD lueo;() rxoxmpiy1lpt lnvias s2ua(mo;o1apxn oeildfs2rlu o t4trtrmr3io1fatr uvo ( texmxrpiu4lpe lnvt ()arrmx  ot4olxo i3tydfs ra( ont0altnmrcoatop e nvi;t0texmim oydoleelivtatfs2umxrono1texomo3iydls uanmon(0aetoir iytla   ues;t) euoxm oydlme lfct s s2ur(moou1apxo feiytla rlnvpnt4 etnmo oa1lmDeluesls) rxm(o3oudop emieta( sDtm( oou0oetn oetysfm2umnmo t) rtomf ta1oaD aneo () etoxmpoo4om  mivta() rtaxmo;o0tet  i3tyt s2rmumpn(0 exrio3iatopt livi t0tetoxm oy1lle mictlsfs2rmxr ;u1optn ociydfa elump;u0artoir oodlmtr nesl( t2tmimpnudaptnmivtas srtrxrpot4texomi3tysls rl(ms;t0 lenif3to1lm  lnvi ()setr(m iy1omee nesls s2um(rp;t4aetoiietltfmDumnvo ()teeomo iytomt lneol( texoxmpoo4omte nesls a2ta( onu4tetn fciytfaDum(vs u)trxrif iotlmDe uesls)srxr(m oo1llt  iet t)a2taxronu0apeoifciyt a2rmnvpn() exrircia1opt lneo;s srumxr oy4lm nmnct (f Dtaxr nu0alxomfeild sDulnvsnu)alxomf3iytlmDr nes;()srxrimpiy4om n nvtas arta(mpoo1alxo i3iaslmDranmo;u0teenio iy1oaD lneslt) exoir3nu1ap elfesltfaDuaxroou1aeeoif3ild s uanvsnt4 ltnmocoadlpDranvi t0seumimpiy4ll  mnesls)srur(  nu4aet mietys s ranvs t0trtoiocoo1fpDrlnes s0 rto(o oo1opt  feiasf 2ur(ro;u1tlxomf3ildlm2eaump;(4tetnmocoy1oaD auvo;(0 rtrimpny1olte fcil( srtmur ot1alxn ieiltfa2emnvp;t)tleomrciodla  ai olt  2toxr iy1llee fet tf 2ur(rpoo0tpeniociltlm ul(mo;t0alenmf3tydlmDrau sls0teumxmpou1amtemfct t s2ua( ont4aeenio3ilt mDemu p;()aexoio3tytfaDr uvi;(  2trim3io4alt  fvil()s2tru p;t4texnmfeiadla2uln s;(4 exoiocto1fp   uvi ( trxoxo3no1al n ncsltfsDrrx oou1optnmfcils m emnvo;t4areoir iytlpD li s t) 2xrxopoo4am  lnet s a2taxmont0tetoifetldlsDea(vo ()aeenxr3totla raieo;( srur(m io1om e ieta()aDumu oou1tpt mi3iytlsDemu s (0 rtnmo io1fp   iei;s0texoxo oo1olt  nesas)a2rau o;o1alenmiciatfs emuvsnu)altoir oydop e neo t) exoimpiu4ll nlfetlt)arum( o;t0aee  oeiytfa2rmn p;(0tltrir todomtraivi;t0teurimpnudalt lfetatfarurxrp;u0olt iictatlsDrmn ont4aexrifcio1op raneils0trxoxr iu4altnmici (f rtaxm ;u0oexnifciytls ra(vs;(4alerxo io1fpt  uvo s)setoxr3ou1lpenmfeia(  Dtru  ;u1optn i3ildla2umn s;u) rxnxo iytom e uvo;t0srtmiopoy4ame  fvslt  Drrurp;u0tee ii3iadfsDuauvs;t) rtnxoctodfmDeanvs ()t2trxrpno4am nlicsls s2rrx oou1apxoiietadfs2emnmp;t) ltrmf totomte uvs;(0trxm(m3oodom e fvi tfsDra(mp;u1tptn ietas m umn p;u0arerif oy1opDrluvslt0texm(o io1alt  nctat) rrm(  ;u4aexoioeiydla ran o;t) etrxocoytoa  li o t0srtr(r3oydoltemfvi s s2trx pno1aetoiieiyslsDrl( s;() ltrio iotopt auvi s  rtrxm iy1alen icias)aDrmurooo0open fctad sDrmn s (0aexnioctadlaDraueil(0t2uoxopoudome mnct t)aDraumo;t1optnmiciys s umu s u0trtrxocoo1oa rlueils setoxo oudolen icsl(faDtaxmpoo1oeenmicilt m ea(mo u)tlxnmf3iotfa e ivo ()trxo(mpiu1al  mneiltfsDurxm no1oeenioeiad sDrmums t0 eermr tydfatrlnvsls) rxrxmpou1altnlfctasf Dtax  oo4tptomoctysfs rm( pn()alxnifcia1fp rlueo;t s2tmirpiudopeemfctl(f Drr(r ou0oee io3tydlsDeau s u0altrmfcoadoa rlivols) 2xoxm3oo4altnmnvils a2rm(m ;u4teenmfeiad a rlump (4trtomo3iy1lmD  nvo t0srtrim oy4amtemnetl( a2raxrpot4tetoiociasfaDua(von()alxnmo3ta1fm  luei;s srxrim3nudopt  fci tfsDra(rp;u0tetnmfciat mDrluvo;u0texrif tatom rlivs;()trxmxr nu1amtnlfeilsf 2tm( p;u1apto feiaslmDemu snt0 lerif oa1fmt ln il(0seto(m oo4ll   ietat  rrrurp;t1olx iietlslsDua( p;t0tlerxr iy1fptean s t) 2xriopno4lptemiei ()srrr(  ou1olt if3iytfs uanmo t)teermf3ty1lpDe i s () etrim3iudlp emicta(f rra(mpot4opx if3tatla2ra(mont)trxrxo oo1omDeanei;(  exoimpnu1oleemneta()a2rmxro;o0tpxo ieiydfs ra( s;()aeerifctytfatrln il( teumio3nodlpeemicsl(  rrmx o;u1altn ociys a2rluvp t)trxrxf3iytoa raneils setoirpny1am n ivi sfs2um(rooo1tltomf3iltfm rluvp;()alxomo3iydoaDrlivo s0 rur(m oy4optemfcs t s2tru  nu4apenmfctadfaDrln snu) reomo3io1fa  lu i;s seum(o3oo1omt mfvsasf Dum(roou4oee  o3iatla2umump;()teeomfcootlpD ln s;(0tetmim3iy1lp  micsl(faDrauronu1oltoiocilsfmDuaums;(0arerxrcoydfp r neo s  2xrio iy1olt  fcslt)a2rr(rono0olxomociytla rau s;u4areoxf oa1faD  nvilt  ruo(rpny4ol n ici ( aDurump;u0tlt mociytlm2umump;t0alxrir iotomte ivil( teurim3iy4apt lnvtl()a2tmur no4apt moeiat mDra( p t0 rtrmfciatlp r nesls0teum(rpio4lpe mivil(faDum( ont4tlx iociytlaDemuvs u)tltomf3tytlatrlnvol() exoxr3nudlmtelici tf 2uaxmoou4ole iociad s2ulnvo;u0artrircoy1fpDelivols0 exoxmpno4optn nvslt)a2ta(mp;t1oet  i3iltla uanmpn(0alxrmf3oydlaDelneolt0 rtoxm no4aptnlfcsl()arrmxm nt4opx iietadfm2emumo;u0alermrciy1fat auvs ( s2xrxo3ou4lle mnci sfarrax pno1tet moctasfa2uluvsn(4areoio3tadopt aies t  exmio ny1am nmfviat s2ta(ro;u4aexo fciltfsDemuvo;t4arenxf3oo1lptelnvol(  eum(r3nudom n ietlt  2uaxmoou4tlx miciytfa2uanmo;(0teenxr todfpt aiei ( trtoxmpou1lm nmnvsltfaDumxrp;u4aetn o3tlslm um(vs;t)aexrxfciotopDe ieo;(0s2xrxo nu1olenlncias)artr( o;u1aeen o3ilsls ran p;t0 exrxfctytop  an i;t) etoxm3iu4apenlfvia( sDrrum ;o0oeenmi3taslsDuan p ()aeeomo3ootom raivol()s2toim3iy1am e fct tfsDur(rpno0opeomociadls ra( s (4tetnifcoo1lm e uvs s)t2xmxr3iu1ape licta(fa2tmurp;o4aleoifeiydfsDem(ms;u4 lenif oatfp eliei s0truoir nodamee fvtls) 2tm(m ;u4oet mfetad sDrau p;t4 exoif3tytoatran ilt  etrir nu1lme  fes t)a2ra( pot1opeoiictytfaDuln s;u4alenif oydomtelieils)trtoir ou1lp n ivtlt)aDtaurono0opeoii3iadlmDulnvo;()tleoxf ty1lmt lu s t) rxm(opnu4lp emncs sf ruaum ;u1apeomfetys mDrauvs;u4 leoxrciadomtrai o;s trurxr3nu1lpenlivtlt)arurum ;o4aex io3tydlm2rl( p (4tlxnxocia1laDr neilt)t2tmxo3oodoptnlfctas) 2uaxrpot4aexn fciadfm uanvo;(0 rtnif iatlaDr uvo;t sexoim nydam e nvtlsfarraxro;o1apxn feilt s uanmsnu0arermrciydfpDe nvolt0srurxrpnydol   fvs (fa2rm(roou4tetnifeias mDraumpnu0aeerir ia1om raiei t)texm(r iu4omee fvils s2tmurpot0tex ifciyt a2eln p;t0trermrctydlpDe nei (0seuo(m oy1lm emfci ( a2ta( o;o1tpto o3iaslm ua(vo;u0artrmo to1opteln i;t t2umir3nu4ll emnesas)s2ra(rpnt1teenmoeilt m ul(ms;u4texrxf3iodfaD an s () rurio3ny4op  mnvt tf 2tr(ront1tpt mietld mDeluvp (0arxnxrciydomDeln o (0setrio3nu1am nliet t)s2ra( p;o0apx ioeiysfs el(mp;u4altoxf3tatoate u i ( srxrxrpoo4omeelnes sfaDtrurpot0tleo o3ilsla2eau s;t4altnxrciotlmDraieslt0srum(rpoy4lmenlivsa() rumxr ;u0opx ioeildla2ul(vp;()trtrxfcoytomD lu o;t0 rxmimpny1omt licsa(  Dtrur ;t4tee ifeiltlaDrl(ms t4altomf3to1faDe uvi ()sexr(mpoodlp elicslt srrmurpou1tlxn ocils aDuanmo t4aleoxrcia1lpDeaieslt0sruo(mpoodal  mfetlt)s2uaxm ;t0tpe  fciadlsDemnmp ()aetrifciatopDr ueilt t2xm(mpnydam  mfciltf Dtmxrpno1oex ifcilt m em(mp;t4aetnmrctytlmtr ueo s texr(r3no1lpte nei t)s2tax  ot4tpeo o3tytlm elums u4 etomrciy1fpte ueo ( setoio3iodolen nvtlt aDurx  ot0aleoiietldls uaumont)tlxomf oydlmte iei t sexrir nodalen ictlsfsDrmxr no1tlt  o3tydlaDel( o t0tlenxfcio1opt li i;t)trxr(mpoudolte ivtlt)sDrrxmp;u4alto o3ils a ulumonu0 rtoxf3oadfa e uvs (0 2uoxm ny4am e ict s)sDuau o;u1optoiictadls2ea( ont4tltnmf oy1lm ranes (  2xoim ny1al nmnetltfaDtax  ;u1aptomietytfa2eluvsnu4tltoir iotlmDelneo t0srur(opiy1lltelfvt s a2umxr ;t0apen i3tld s ea(ms (4tlxnif iatoaDrlivol() 2tm(o3iu1apen ivt (fsDrr(  ;u0tpxnifciys aDemnmo;(4tetrxr tytlpDeln o;s0tetr(m3ou4olt  nct () Duaxmont4tltnioeiltfs ea(msnt)altrxr3ia1fa  aueo t) 2ur(r ny4olt mfctatf 2raxrpno1olt miciydla2rm( sn(4altoxo io1oaDelieslt)s2xrim3oo4ap  lnciltf 2urx onu0oex mi3iydlm2uan onu)trtoifciotom  aieslt teurir3oo1amt  ivtl( s2tr(m ot1oetn ieildfa2ulnvs;t)altrmrcoodfp e i slt seuoxr iodoltnmneiatf 2ua(moot1tle if3tyt a rmnvont0 rerio oytfpteauvo s)seumir io1altelnvtl()s2tax ooo0aee iociytfm2ranmo u4aetomr3totlpDr ueslt srxo(o oudll eliviat)arua(rpno0tlx mieiatfsDrlnms;(4aetrmrcoatfpteai sl(  2xoxr oo1lpeelfvtat) 2rmx poo0apxniictyt mDrmuvpn(0alxomrctotlmtrauvi s  2urimpou4ope mieilt) rraurpot1opto fciytfm um( s t)teenmocty1fmteaueo;s t2uoxr3iu4al nmieilt) Dumurp;t1oeeo fciadfa ulu pnu4 ltoiocoydoaD li sls0t2umxopnudomee iet ( arurum ;t0ole moeiadfa2rmnmsnt4areniocto1om  ai sls trto(m iy4aptn ivt (fsDua( o;o0aeenifciltfa umnvp () rxoif3iodfm  lneols t2toxm nydllt liviasfs2tax  ou1altomoeiat sDumuvp t) rxnxrciatoa  lnei () eumxr3oodolt  ics (faDrrxrp;o4opeoifctldfa rl(vs u4 eermfcty1omD livol(  rtr(o oudamt mfvt tf 2urur ;t4tet mo3tatfa uan s t4 rxrif3totlaDr uei;t0s2uoxm3nodop nmnvsls sDua(monu1aptn oeiytfm2ulu onu4treomr oodoptr i i;t0s2trxo nu1ameemfetat srumxmono1optnmoeildla2rlnvo u0trxrxr3ty1lat an i ( seumir iu4ap nmfvtltfs2raurooo4tpxoifeiatla ua(ms;t4aexnxo3oytlp rlnvils s2xr(m3iudoptn nciat) rtaxr ;u0aeeoif3ild aDumnvs;u)aeenifciotla ran sl(0 2xr(o3no1ale lieiatf rtr( oot4olenmf3iydlm el(vsnt0texrxocoodla rlivsls t2uo(o3no4lpen fcils  2rax  oo4texnif3ias m emnvs;u)tlxnio3oytfa  luvil(  rtm(mpny4olen fctlt aDtmxrpno0tlx mo3iyd sDumu p;t4trtrmo oydop e nvil(0seum(rpoo4ome  fvsa( srtm( poo1ale  oeiat a emn snt0 etoxoctydfaDrauesl( s2xmir3oy4llt  ivilsfartau  ;o1apeoifcils s ulumpnt4 rtoxf todlp  auei (  eurim nudopt  nvta( a2tr( pnu1aptnmictls s em( p (4tetomoctytomDeanvi t srum(m oudolenmnei tfsDurxrp;t4tpt  o3iyt a rm( o (4 rtrxr3oatfm r ies;()t2uoimpno1am e fcta()s2taur ;o0oetomoeiytfm eln sn(0tetrxrcoa1oat liesls) rtoim3iydam   neia( srra( p;t1tet ifciaslm ra(vs (0arxnxr iadfp e nvi t0sexm(rpno4al   nvsltfaDurumpnu0tlxoiiciasfm rlums;t) rtnxr3iotfa r uvol(0trtr(o3iu1al e ics s srrauro;o0olto octytfmDran p;t0tltnxo ootom  luvsls)sexo(r nu4openlnesas) Dtmxr nu4aptn f3tldlm2ua(vp u4tltrmfcoadopDr ieolt seur(opou1llen fvt sfsDtau  ou4oeeniieiasfs rluvs t) eerir3ootoa  luvs;s) rurir iy4op nlfcta(f 2tmxmp;o1tle ifctydfa ea(ms ()areoir oytfm   neo;(0teur(m nudamenlivsltfsDur(rpnu0aeto oeias sDrlump;u)teenmo iodlp e ivs;(0 2trxr ny1llenlneiltfs2ra(m oo0olen f3tat s2emnvs;u4altnircoa1lat  n o;t) 2urio io1ap emnetlt)sDtmxronu4apx  fetys a rmn p;t) exriociodomtr i s s) rxmxm3oy4lme livsa(f rur(r oo0opeo feiltls eanmo u4aexomr3iydlp rauvi;t  eurxrpiodlp n ncil()srtax onu0tpx  o3iadls um(mp;u4aeenmo iytfmDrli il(0trxoirpiodol elneiat arrrur ;t0oexn ociyd s el( p;u4artrxfciydlatraueols0t2umxo3no4ale lfesas)sDtrxr ;t4tle  f3iyd a um(monu4arxoir3ta1fat an s t0 etmim nodaltn fvsl(  2ur(r oo1tpxoifeiyt aDrm(vp t4tleomrcto1faDrlneslt0trtmxm3iydole mfcsat)arraxmpot1olx ifeildfs umn p;u0 etrxfcoo1la e uesl(0sexmxr nu4lle  iet tf 2rax pnt1tltnmfetld mDra( snu)tetrir3oydoaD  n i (  2urxm3iu4lmtnmfctas aDum(r ou0texomoctat s2rau p;u4trtnmfcto1lmt lnei s)s2umiopny1amt mfvia()sDuru pno0ope ifcilsls2ua(msn(4aleriocoy1lp e nvi;t0srtoxopoydllt mivi s s2taxmo;o4apxo iciatfa uauvs t0tltnxfciotfptr uvs;s) exmxrpiudap emfcta()sDrm(ront4aleoifeildla ran p;t0aexnmf3tadoptelnvsl(0 2xmxm3iodll nlici sfaDtrxm nu0alxn ieils sDraumo;()alerifcoydfa elu s ( s2xmir3oydllen fvtat)a2rrxr ;t1olxo ocildla2uaumonu0trtnmr3ty1fm elu olt) rto(r io1aptnlfei t) Dtaxmpoo4oexn iciadls2uau s;(4tleoxo oa1opDean i ()sruo(rpnu1altemivtltfs2uru pou4tlxn fcilt aDrlu p;t)arenxf ty1lmt aivi s)t2tmxm3io1ap e nvs (  2trumpnt0tptomiciydfm2raump;t)treomr totomt  ies;t) eurxrpou4ale mncsas)arrau  nt4tetomfetld a elu on(4 rtomf tytomD aneolt0srxmim3nudopen fctl(fs2ua(  ot1tpt ifeiydla em(ms;t) exoxf oy1lmDeaieol()s2umiopnu1ap nmnesl(fs2urur nu0aetniieiadlm2rl(vs;t)trtomr iatlp eauvol() 2xrxr3no1altelnviasfsDra(mpot0oexnioeilsls2ulnvs t4 rermrciadlp r u o (0s2toxm3oudapt mfei (f Dta(mpnt0tlt mo3tldfaDel(mo;t4 lerif iadlpDeai ol(0 exmim3ou4al e ncs sfs2ta(rp;o4oetn ietad a2um(vpn(4trxrir3iodomtraies t0trxoimpiy4olt mncsas)arrmx  ;u4opx mi3ildlaDumuvonu) eerxr3io1faD luvo;t s2tmir oo4al e ictat)aDrrumo;o4tetnmi3ias a ranvp;()trxnmo3oydlatelnvs;( s2tmxr no4am elnci sf 2rr(r nu4texnifetasla2emnmp;()artoxrctytla e uei s)s2tm(r3no1ope  ncs t  Dra(r ;t4oexo ietlsla2umuvs;u4 lerioctotomDr uvs ( t2xoxmpiu4apt  nctas s2tmu  oo1opx iietldfsDul(mp;t4trtrxr oa1omteau ol()t2uoio3iu1lm nlfcias)s2trx  ;u1teto icildfaDrlu o (0aeeoxrctadlptraivs;t) 2xr(m nu4al   fcilt s2rrx ooo4apx  iciltlm umuvonu4 lxrio ootfpt  iesl(  euo(m3oy1llen icta(fsDrrurooo1tpx iietltfm umu p;()altrxo oodfp elies;(  exm(opoudlmt mnei sfarurx ooo1tpx ioetas a em( o (0 lxrir3iadfm   neo;s t2xmxo3oodole  nvias)s2tr(r oo0olenmf3tlt a2rln o;u0arenxo iotom rlnei ()texmir oo4ll   neias a2um(  ;u4tetnif3iysfsDea(vo;u4 etoxo3tytomt  nvs s) rumxr iy4alt mici tf 2taurooo4olx iieias m el(vsn(0treoir oa1op   iei;t  rxmxo iodol n nesat a2tru oot4apt if3tadlm ranvs t0alerif ia1faD  ivo;s0 exr(o iu1amte fvsasfsDuax o;u4alx io3ilsfa ranms ()teermf3oadlpt  nvs s0 2toxm3iu1lptnlnvs tf 2tau ono1opxoii3iysls2rmnmp;(0texrir ootfmt  uvols) 2xrimpoo1lp  mictlsfsruru onu1aetomieiysfaDra(ms;u0tltrif3ia1op r u s (0srumio3nu1apeemneils)srtr(m no0tltomi3iad s2ea( pnt4 exnmr3iadlpDraies;(0 2tr(mpou4optelieils)a2ur(ro;t1optnif3iadlaDranms;t4tltrxr oodlat anesls0texm(o3ny4lleemnviat) ruau  nt0aetomociasla ra(mpnt0artoxo oydopDeai i;s0 2toxr ou1oltemfvi s  rrmum ;t1olt mocildfm2umump u0arxoxocty1om   i ilt0trto(o oy1amtemivsa( sDrr(m no4aee mo3tlslm2rl( s;t0tetoxfcoadomD  ieils0 rtoxo ou4omt  ivia()aDtmum nt1tlt mfeild s2ua(vs t0trermo iy1fate ivo ( srtoxm3io1al nlfes ()srur(m no0teen fetas m uluvs;t)alenmf3totlaDraiei (0srtr(opno1olenlivsa()sDtr(  no0oltniicildfm elumo;()altnxf3oadla rluvo;t t2umxo io4ameelfvi t s2umur nu0tlx  fctldfm ran p t4aetoxocootlmDeluvo;t) 2urxm oydapenlfcs t) Drax ono4tlto ictysfaDrluvs;u0tetrmo3tydfatr ivo;s0t2trio oo4al   fviat arurump;t4alx iietltfa elu s u4 rermf3totlaDr ivs s  eumxm3nu4oltn ncsatfs2umxr nu1tpt ifcils a2uanms;(0 eeoxociadomD anes;t  eumirpiy1lp nlnvta() Drmx pnt1tltn ieiytfm rlumonu4arenirctotfa rau o;(0 rtm(r oydaptnmictat a2raur ;t4oleoiiciatfm2uaump;t4tlxoxo3iy1laD aneil()s2xrio nudamtemnetas)s2uaum ot0opeoiietldla emuvo (4trtoxo ia1fmD  i i (0 rxmxopiodlltn neta(  rrru  nt1tetnmietys m ra(vp u)aeermo3tatoat  u s s truoxrpio1amee ietls)s2rr(mpot0opt mo3iydfm2rm(ms;u)tlxnmo to1oateli i;(0srxo(o3nydlptnlnvslt  Dtrxm ;o4opt iicias aDua(mp;(4 rtoir3oatlatraivo s0trxmxopnydll   fcsl(fa2tru p;t0tlxomi3iydlm2uaumsnu0texrxr3to1fp rlnvols t2xm(opnudalee fctltf Duau  no4ole  feiadfs rl( o u)aeenmr iytop eaies;()srtr(m no1am   nvs tfsrtruront0oetnmfciysfm ulu p u4arerxo3ia1lmD luvs (  2umxr oo1lm n feils)sDtrxrono0tetn fetat sDrmums ()arerxr3iatfa rluvols t2umio3ou1ap e nvs t)aDumum ou1alt iieildfsDua(mpn(4trtomr3iatfmDeauvils)seuo(opoodame mnes t)s2uru oot4apxnioetytlmDeanvs;()aetomociydlmtrauvs;s  2trimpou4omen nei t) 2ua(mpou0alxomfeildla uaump t)tleoxociy1lmt  i ol()s2toio3no1ameemnvsa()s2uaum ;u4oetoio3iadls2ul(ms ()areomf3iydomtraivs;t0t2xoio iu4alte nvias  2tmxm nu4tleomi3iyt sDrm( o t0aeeoxf3oa1la r u i;t)t2xmio3oudlle mnvslt  rrmu  oo4teenmiciltfa2ulu s u)aeermrcoatom ran s s0t2xrio nodap  livtlsfs2urxront0aex  oetytla eluvsn(0tlxoxrcty1lpteaueol(0s2umio iy4opee net sfs2raxrp;o1aetn fctadla rm( snt4alxoio3tadlmt lueo t)s2ur(r3oo1ll nmncs tfsDumum ;t4olxnioetlsfs2em(msn(0artoxr3tatoaDeanvo;s trto(m iodol e neslt  rtaurpnt0aleo ieiyd aDea( onu) lerif totfm r n s t)trtmxm3oo1om n ivil( s2raxr no4tleomieiydlsDea(ms u4trtomo oo1opDeaneilt)srurio oo1ome mivia( a2rmxmpno4ole iieilslaDum(mpnu4alenifcoatoptr u i;t0s2toxmpnodop   iei t  rtrx  ot0aexomoeilslmDul( s ()altnxfcoydfptr ueo s srxrim ny4ap emfci ()s2tmum oo4alen feiyt m2ra(vo (0alxrmo iytfa  ai i s seur(m3no4lpe  iet t aDtmu p;u4oleoiieiyslm rmn o;u4 rermfcoy1faD  u o;t0 rum(opoudole lfct (  2taxmonu1aet mf3ilt s2rmn p u)tltnif3todoaDeanei;(  etoxopny1lpte fesls srra(mono1opxoiicildfmDum(msnt)teenif oodom  luvsl( trurimpiudol eliesat)aDumu poo0tlxomoctasfa2ea( s (0tltrxrcoydfatelivsl(0trxm(r3oy1ope livtas  2raum nt1oltnifcilslaDemn s (0tlxnmr ootomt lu i s) rxmxopny4alenmnet () 2raxroou1tpenmociytla ranmp;u0trxoirctodlptr u o t0t2xrxo3ny1apen neia(faDtau p;u4tet if3iatlaDrln s t) ltnifciotlp rlivo;t)trxo(m iydll n icsa(fs2rrxro;u1ole mietyd sDelumo u)tltomr ty1fmDe ueo;() euo(m ny1aleelnci () rrr(moou0altniictadlm2rau pnu0 rtrmf3tytopDr n o;()t2ur(r nu1lmte fvsl(  Draur nu4oeenii3tytfm ran p;(0 exrif tatla eluvi;t t2xmir3oodlptelfct t) ruaxmpoo0texn f3tadla rlumsnu0 rxnmr3oa1oaD  ies;(0 rur(r3ny4ll elicsa( aruax  nt4opx  octysfmDumn onu0 lxrircoa1lm  au s;s)s2xoir3oy1lle  ies t)sDta(mpnt1apxoiictadla emums;(0 rtomf iodlatrli o () etrirpiodome mnvs sfs2umxm nu0aexn octyslm raums t4tltnxo ia1fmtelnvslt)srxmim3oo4apee ieia(f rurx  ot1openmfeilslm2uanmp;t)alenmr3totlm eliei;( s2urir3oy4lmen fcs t)sDtm(  ;u4open fctyd mDua(vpn(4trtnif3tydfatrlivo (0srtoxmpoo1lptelnvtls a2rrxr oo1oet mo3iad aDuanms;t0 etrxoctydfa e nei ( seur(m3oodap  lnct s) Dumu pno4oex mfcilsfs2eauvo t4tleomr3iadfmD aivilt)seurimpio4aptemivi (  rraumo;t1ape moeiysla2ul(mp;u0trxrircto1fpt aieo t) euriopoudll  mictltfaDururo;t4olxoio3tls a2um( snt) etoxocty1lp r n s t)texrir iu1olen ies tfarur(rooo1ope  ieildfsDrmnmo t) exnmocoo1opDranvsls)trurxo oodapen fci sfarumxrpno0apxo i3tldlaDrln p;()arenif oytop  aivo ( s2trxr3no4lmee nesa( srraum oo1tpxomo3iyslm rmump t4aetnmr iydlpD anvilt s2urxrpnu4omtelfet () rur(r no1aexoifeiasfa2ua(mo;(0 etomr iadoptelies;( t2uo(m io4ol n ivt t)a2ur(mono1tpeniictlslmDuanvo u0altnmf iatlpD an o;s)s2tmxm ny1lptemneil(f Dumu  nt1openmiciad sDrm(mp;u0arxnxr3iodomD luvo t s2urir3iudalee fvslt arraxrpot0tetnifcilsfsDrm( onu4teeoif oytom  ln ols0s2umxmpiu1ol emicsatf Drrxr oo4aetn fetls aDeluvp t)teeoir3to1lmteauvi s0 rtoir iudlpe lnvsas)srtmumpou1openioctls a2elu o;t)alenifcoodfatr uvo;s)s2uoxrpiu4ome  fvilt)aDta(moot0tle  f3iytfsDea(vpn(0trtoxo3iatfmD  uei;t truoxm io4ol  mivsasfs2trx  no0olx mfciytfsDrlnmo;u4altoxr3iodoptrlneilt  rum(mpnu4amee ieias) 2rmxmoot4texoiociyd aDelu p t0alerxo ty1fa  ln i (0srurxr3iu4lm nlieias  ruaxm no1tet  ictatla2rlump t0trtnxoctodlpDe uvo s0 2umir3no1om elictasfs2tmxrp;t4aexniiciasfaDean o ()teenxf3ia1omt li il()tetm(m iy1lptnmici s  2tm(rp;t1aetn f3tld mDuanms;() ltrio to1lmt  ueo;s0seuo(m ou1ol  liet (fartrxmo;o4optnmf3ils s em(mp;u) exrmr3iotom   ivi t0 rumxo io1am  mfeilt  rrmx ono4aptn fetys aDul(mpn(4treomr3iotfate i ilt)srxoxm3no1om e icsa( sDtmu ont1tpxnmieild m emnmo;u) lxrxr3ia1lpDraueolt) rto(r ny1omeemiesasfsrraxrono0apx iiciyslmDuluvp;(4 lxrmo3oo1fm eaieo s0trumir3ny4om elfvils a2taxr ;u0olt mfciadlmDrluvs;u0alxrmr3ta1lmDrlies;t)s2trxr3oudomtn fvs t a2tm(  ;t4tetn f3ilt mDrl(vs t) exomo3iytoptr u o t0t2uoxrpoodal e ics t  2ra(  ;u0opx  fctytfsDelnmp;t0 leomo3totfm  lu o ()trxr(o3oy1lm nlfctl()srra(m nt1texomociys m2ul(mpnu)aetnir3to1fpDr u ils  rtr(r iudom elict s)srtmxm ;u1aleo ictasls el(vo;u)treoio oodlaD  uvols0 rto(m3oodlmtemfesl() Durxronu4tpe mietatlmDemuvon(0texnxf ootoat livo t s2umim3iodamt  nesas sDururpnu4aexo fcilslaDum(von()teerxfciy1omt luei t0srum(mpno1ale lnvtas aDumurp;t4oeeoio3tatfs emn p t0trxnmo3iotlateaieo;t0 2trim ny1optemfetlsf Dta( o;u4apxo ieiyd a2rlnmsn() exnxr tadfpD  n i;()seumxopou4lle micias)aDur(m nt4tlxniiciadfs ulnvo t0 rxrmo oatoa e ueo;s sexrimpno4lm  mnctl(f Drr(moot4aeto octlt m eaumpnt0aexoio iatfaD livils s2xo(r nu4oltemnei tfsruauroot0aetnmfciydfa rmuvsnu)teeoxfcto1fatraues;( s2xmxm iu1altn ieils) rumx oot1aeeomfeils s eanvpn(4 eerxo3totfaDrlues s srtrxrpoy4ame livi t)aDra(mpnt0oltn o3tlt sDemuvo t)aetoxoctadlp eaivs s)teuo(o3io4optemncia(fsrumx o;u0alxnmo3tldfm uauvo (4 lenmf3oy1oaDrlivils)seuoio3oy1om nmiesat a2uaxm ;t0oleo i3ias a rau snu0artomr oatlmt lu olt0srtoimpoodop e fvslsfsDuaum ot0altn iciasfa rl(msnu0tlenxr oy1om eanvs;()s2xrirpiudom  mncias  rtru  ;o0tpe  fctyt m2ea( o;(0texnxo3tatfptrlues ()s2umxr oydllt livt sfa2uaxr nu4olxn ieiydfmDrmnvo (0 rxomfcoa1fmt  uvi () 2urimpiu4olen nvta() rurxr ;t0oee io3tyd a eln on()texnio3iy1fmDrlnvs;s  rxm(m nu4op nmietlsf rum( oot0alen oeiaslm2uln p t0tetnir oytlaDrlueilt trxriopnu4lp   ncsls) 2ua(rp;u1aeenif3ilsla emumpnu) reomo3oytfmteaneilt)t2xoxr iy4lmenlnvtat)srraum nu0alto oeiyslmDea( sn() etoxo oydlmDeanesls seur(m oodaltelfcsl(fs2ua(monu1oetniicias m2rm(vsnt)teeoxfcto1la  auvi;(0sexr(r ou1altelneta(f rrrx p;t1oexn octatlmDel( o;u0teeoxo3iytlat  uvo s)tetm(opoy4ll   neta(fsrtru ono4aeeomocilt a2ulnmpnt4trtoir3oadlptrluei s sexrxm3no4ll nmfct t) Duaxrpou1tee  fciltla2ea(vs (0altrxo3oodfa r neil() 2xr(opny1alt miet t) Draumo;o1opxomfeiatfm2uluvp;u0altrio tadomDrlu s;(0srtr(rpiydame livt sfaDum(rpoo0aexnmfcildfa2ranmp (0 rtrmfcia1lp eln ol() rtr(mpoodale mict sfa2uau oot0oet mieiaslsDuan snu0aeenxo ootlmtr ueo;() etoxrpnydape lnctls a2rr(mpnu1tpxn feiadlsDumnms (4 rxomoctytfm eauei;s)sruoxm oo4omt lnvt (f 2rrxrp;u1alxomi3ilsfm eln o u4 exomo3tadlpteanvi;(0setmxo oo1amtnmfcs s srumx  nt1oex mfetydls umn o;t)treoifcto1omte i i ( sexoxrpnu4olee nvslt srtax pno1tpen f3tat aDumn o;u4alxnxo tytoa elueilt)t2uo(o nu1lmen ivtlt arrrumo;u0tltnmo3tas s ra(vo (4 reomociadoa e n o s) rxrxmpnu1ll   nvs t) 2ua(mpot4apxoifcils m2rlumo t4 eerxo oy1oatraiei;(0t2trir3oodomtn netatfsDurxmo;o4opeoiiciadfa elumsnu)tlerircoydfp rluvilt0 2uo(opoodlm nmiesas)arua(rpou0aleoiietyd mDuauvsn(4trtrmocoydopteauvol(0 rxmxm nudll  mfvt s)s2uru ooo1tex mfciatfs ran o;t4areniocoa1lptelnei;() 2ur(r3oo4alenlneils  rrau ono1ale  f3iydls2elnvs u)aleomo3to1oaDrln slt srur(r3iu4opt  nvsl(  Dtr(mo;u1ape  ietldfsDeanmp (4aetoxocoadfmteanesl() exmimpnudlpte ics s)arta( pot0tpxoiieiys sDrln p t)trtrxfctatlaDrluvol(  exmir oy1lpt mivsat) 2um(mpou1oeto ocilt sDul( p t)alenmoctydoaDeaneo t)trxoxr3no4ame livsat  2urxrpou1aeto i3tldlaDrlums (0 lxoxf3tytlpD  ues;(  etoxr3nu4olenlfci ( artaxmooo4apeo ieiys m ea(vp;u4teenio todoat li i s srxr(o3nodlltnlfvtls)s2rrx p;o4tleo ociadlm2uan on(0altnmrcoytlptraivs t) rtrirpnodlleemnvs sfs2uaumpnu4alxn ietyd m ran s u4trenxfciydomDelnesl()s2uo(rpnydap n fctls) 2ur( p;o0tpx  ocias s rl( p (0arerxo3oatoaDraneols0 2urxopio4aptn nctltfs2umumonu1apenio3ild aDrlnms;(4teeoxf oo1opD lnvsls) exrir3nydape mics s)aDtaur ;t1tpt moetyd sDumumsn()aeeriocty1lmDelneo;s)t2xoxopny4lmt mfesa( s2um(  ;o0oetn fctadlmDrauvonu)arenmo tydoaDrlneo;s0 rtoxmpnudop nlivtlsfsDua(r nt0open icils m2rln s;t)altnir oa1fp  aiei;()setmxo3nu4am elncils)arrmuroou1tlenifciat s2rmnvsn(4 etrmrcia1opD luvs;( srtoxm3oydam n ncia( a2trxrp;o4olt iietys m2em(ms;t) etnmr iydlmDe neils)trxrio3oydlmte ncsl()srrmx poo1tee  ociad a ulu pnt4 eerxr tytfptrlieil( t2xo(o iodamtelncia() 2rrx  ou1tpt moetlt s2rmumo t0 rxomo oy1omt lnvs () rumxr nodoltnmfcsasfaDrrurpou4tpxnmfctatfs2ea(ms;t)areoiociadfm  ln i s) euo(o3ou1omtn ictas)aDtr( onu1oeeoiiciltfm2em( o;t4trxnio iy1fpt an olt)t2xoxo oydll elics (f rrr(  oo0tlxoioeiatfsDean p;u0 lerxf ty1fmt  nei t s2tr(opoy1omtnmivi (  rumump;o0oeenif3ildfs2rluvpnt)tlenmo iotoat lnvo (  2uoim3oydape lnctl()sDtmurooo1tpt  o3iltfs uauvsn(0 exnio3ta1fpte u i (0srtrxo ny1lp  mnct () Dur(root4alx  f3iltfa2rmump;u4teermf iadomtr u i;t0trxo(r3nu1aptelnvt t) Dur(  nt0opx  fetls a uluvp;() etrmf3oodfp  lnes s0tetmiopiydap emfeil(fsDum(m ;u1apxo feiad a ra(msnt4 rtnmr oadlp  an slt)s2toxr nudap elicsltf rraxr nt4aptnioeilslsDrau p;t)treomocoytopDr iesl(0texm(mpiy4apee nct (f Drrx  no4aee io3iaslsDran p;t4trxomr3ia1lmteai slt trxr(r io1op e fvs t)s2urxmo;o1olt  oetydfsDelu o t)treoxr iodlm e ivi;t) eum(rpnudamte iei t arrrumonu1oleoif3iad m2umnvo u0 eeoiociodop   iesls texrxm iy4am e ies sfaDra(r ;t4alen fciatfs ranmpnt) ltoxocoodop raivi;() 2toiopou1op emfeiasf Durxmpno1oeen oeildfsDemn p u) lenxrcoydla r ieslt  rtmio3nu4op   feils artmum ;o0opx miciysfsDrlu o t4teerio3ty1fmtrlnvi s) rurxo nudome  nvta()sDrm(  ;t4oet mo3ilt sDumnmp ()altoxo iadomDraiesl(0 euoxopnudole lnvtl(f Dtrx o;t0aleoifeiatfs um(vpnt4 etoxrcio1omDe uvi t  eurim oy1lme mfcs t) 2rrxm oo0apeo i3tad a rauvo t) lxrmfcoo1lm rlu ilt0s2ur(rpou4ome lict () Dtaumpno1apeo ociatla eaumo;u0tltoxo io1lpDrai ils)t2trim no4lpen fei s)arra( o;u4oeen fcildfa em(mp t)aexoxf to1optrlueo;()srtoxo iu1altnlnctlt  2urxrpoo4aexo f3iltfa rlums ()trtrif3tatom r ivs;t0s2trio3io1ll emictas)s2um(moot1oleo octysfmDeanms u0 etomo iy1lmtrlneo ()truo(r io4ol  mfvi s)sDrmurpot1tlxo ictldfs em(von(4trtoif3iy1fp rluesls trxm(mpoy1apee fciasf Dururont0aex  ociydfs2rau s;(4tlerir oatla eln o;(0trxmim3oo1omtnmfetlsfa2tm(m nt4olxnmo3iasfsDrmu s u)teenxrcia1fp raueolt0trurxr3oodom elnciltf Dtaxr ou0teenifetlslaDrlu sn(0trtrir ta1lmD li o (0sexmio3io4ll emnes s  rtr(m nu4tpxn f3tyt a2em( s t4trenio io1lpDeaneo t0t2uoir3iy4omenlncil() Dua( ooo1aee  octlsfa em(mp;(4altoif to1omte uesls0tetrxo nu1lltnlfetl()aDrax  ;o4aetnifeias aDra(vsn()altnxo3iy1fmDe ivi;( srumio3ny4op nlfetlt)sDrmxr ot4apx  oetyd s ranms;(0 eenmo oy1oaDraivs t0t2trio nu4lp   nct t arrmu  no4alxomfctatfm2uanvs;u0 etnmo oa1lm   i s;s0t2to(m3no1opee iet t)sDur(rpnt0oltn icilsfsDeluvs (0arerio3iytfat lnesl(0 eto(m3io1lpenlics ( sDtau  ;t1oex  fctys m uauvpnt4aexnxf ootomtraneo t) 2xrxopoo1lltn fcs sf Dra(r ;u0tpxn i3tysfs rmuvo;t) exnmf oatfaDelu s t0trxrio3ny4llenmictas a2rau p;u1open feiyd a uan o;u0 reomr3oodopDe nesls0sruo(mpiydlmtnlfvil( arraxmo;u0aetoii3iytls2ulnvpnt0 rtnxo3tatomt aies;t)sruoxm ny4lpt lnctltfs2ururp;u4olxnifeiadlmDrm(mp u)artrmr3tadfaDr n o ( t2uriopoy1apeelietl(fsrtrx oot1aptoif3tys aDeanmsnt) renmf oodlatr ivs;()truoxr3nu4ap nmfcias arrmx p;o0oeenifetys m2el( o;(4 rxrifcoadopDrai o;s t2trimpno1omee ict sfs2urxmont1tpxnmo3iaslaDul(vsn()tetomo tytopDranvs;(  ruoxo3nudamenlfvsat s2ra(  ou0teeoif3ias mDran snu4alermocoytfm   ieils s2toxr nudomenmicslt)a2rru onu0aexnmiciadla2umuvo;t0aeeriociotoa rluvs;s  2uo(r nydlp   ictas)s2rrumpno0tlenmiciydlm uluvp;t4artomo3ootoatrlues;s)tetr(o3iy4lp   nvias)artrxrpnu4aetniociasfa emnvp;t0 rxrir iatla  li i t  etrxr3iodopeelict s)s2ur(m oo0aleo ocilsla2emuvs ()arerir oydlaD lu i (0s2tm(mpiy1om nlneta()aDtr(m ;u0tleoiociyslsDrmn s (4trenmrciy1lpte u s;() 2urirpou1lpeemnet t)a2trxmooo4opxoioctytfm2ulnvs;t0 rtnir oodoa elueil() exoimpnudal  livta(fsDtax p;u1oet  feiat s2ua( s t) ltnmf iydfmDelu slt)tetrxopoydal nmivils)s2raumoou4optn f3tytfmDel(vp u0artoio3iytoat auvi;t seum(r3iu1om elncilt  rtrum nu0ale  fciadfmDra( s;u4 etoif3tatoat luei t0s2xrio nodap n ieslt s2trx poo1apt  oeiasls2ra(vo;()texnxo3iytlm r u i;()sexrirpnu4ap  mivsat) rrm(  ;t1tle  iciadla2elnvs t) etnxfciy1fp rluei t) 2trxm oy1ll nlfvil( sDtrump;o0tle  feiatlm umu s t0arermocia1lp e ueo;t0 eurxo ny1am e neslt)sDta(mpnu4aptn f3tad s rlu snt0 etrxr to1lptr nvils  2uoir io1lme mivi s a2taxm ;u0ale mfciadlmDrm(ms;t4aeenircoydlp rai s;s0texmxrpnu4lp n nvsasf rrm(m ou1tlenio3ils s uauvon(4teeomr3oy1fp   ivo;t truoimpoydaltemici (fsrtru  ou1alxn i3iadls em(vsnu)trtrio3oydfptr nvslt0 2xoxo3no4lm e fet s)a2ur(  ;u0oexnii3iasfa elums;()aetnio oodopt  ieo;t0trumxo3iu4altn fviat)srurxmoot1tptomf3iyslaDranvpn() lxrxfcoa1op e i olt)tetr(opiy1lp n fvs (f rtm(moou1tpxo feiydla rm(msn(4altoif oatlaD lnes s setmir3ny4omeemiesasfs2rmxm oo0tltomo3tytfs2umu p;(4alxnif oodoa  an i t) rxoxopiy1lmee fcil( sDuax  ot4oetnmiciasfmDrluvs;t4 rerxf ootlm e ieo s) 2trim iy1ap n fcsa( aDua(  ;t4aet mf3ils s rln s;t4areoir3oo1lpD lieo;s)seuoxm ou1optnmnvi (fsDrmx ooo0apen ietyt m elumo;t0tetnxr ootopt li o;t)texm(mpny1amtemfei s arur(mpou4apeoioeiysfs ranmo u0aexnmf3oy1omD livi;()trxr(r3nu1lmt mfetat s2rmxro;o0oee  oetltfa2rm( p;t4 reoif3tydlm e nvi;t) rxrio iu4olte fesa()srtaumo;t1altomoeiydla2elump;() rxnxo todfatelu i;t0s2um(r oodllenlfesl()srrmump;t0apxn ictyd m uanmo u4 rxnmrciytlaD  n ol( tetoxo nu4omenmfct () rtru p;t4apx mfeiyt mDua( p t0aeerxo io1lptelu o s0 2umxo io1lp e fvilt)a2rrur ;u1teto o3iatfm rlnmonu0aexnmr3oydoa  luvslt0srtm(rpoydole lfvia(fsrraxr no4apxn ieildfa2rlumpnt0trtrif to1lpDe i i;(0setrxo3oo1apte ieil()srrmxmpnt0tex  o3iat s el(vsnu0 renmrcoodfmDelues;(0t2ur(o3ny4lm e ivt s)s2tm(mp;u1tee iieilt a eanms;t0aexnxrcta1opt lu o ( trtm(m3io1lpte ivta(  rum(root4aexnio3iys mDumu p;u4 lxrmf3oytopt  ivs;( teumim3oy1amtnlnvslt) 2ur(rono4tlt  i3iatfsDeauvs;(0treoif tytlm   n o;( seur(r ou4opeemfeta()s2rmxrpoo0oetomf3iltls2elnvp t0altnmo3oy1lmteaivolt0trumxopnodlpe  netatf rtrxrp;o0tle mfcils m2rlnmp ()aetnir iodfpDraneo;s0teuoxo iy4amee nci s  Drau poo0tpenmfeildfmDum( s;(4 eenmf3iatlp   uvi;()srxmxo3iu4lmtnlnci s)aDtr(  nt0apxo octlsfa2uln o;(4aetomf tadfpt lu olt  ruoio3ou1om   fvsl( srua(rpot1opxnii3iatla2ul( snu4alerif ia1oa rlivo;(  exr(r3iy4omte ncsa() rrr(  no4tpxnmi3iyd mDul( s t)aexoio3oo1oaDrluvi t0 etrxr3oodll  lnes sf 2tmxr ot4aexnmoetydls2ul(ms u)arxnxrcoatfa   ieol(  rur(rpoo4ole mnvsa(faDrrur ;o1tpxoifctasla rau pnt0tlxoxr iodlaDe ieo;(0s2urxrpiu1alte ietat sDtax  nu0aex mi3tasfs uan pnu0aeeoifcoodfmDeaues;() 2trim3no1amen nctasf 2ra(m nu0olx  f3ildlaDrmn p () rxriocoa1op e i o (0teum(r3iodlme lncil( srtr( pno1optomoctld a elnmp;u4 eenxo tydlm   ueils0srum(r3iy4apt lfvsl( artaumo;o4ole mi3iad mDraums;(4altoxfctytlaD anvsls texoxmpiudal  miesls) 2rrumooo0opxn oeiysls elumon(0 lxomocoy1optraueilt0srxo(rpou4lm emnvsa()aDtm(  ;o1opxn oetydlsDuluvs (0texnmf3oydlaDran olt tetoxmpoodlp nlfctas)sDuau pnt0tpx  iciasfmDumn pn(0areoif oadlmDeluvs t0setmxopno1lmtn ivsat aruaxroou0tlxnii3tld m rlumpn(0texnxfcoy1lat an i (0srurim ou1omt mfctl(faDtaurpnt1tex if3iysfa2umuvo;t0aeeomf tytfpDeanvi;t) rxoir iydop elnvsl(  2ra(r ot0alt  o3tad aDuau ont4artrircty1fp e u ilt0truoir iy4lp nmfvilt)a2urxmp;t0aexomi3tatfmDrlumo t4aetnircoatfa eliesls0trtmir3iodlm e ivia()arrmur ot1oee ifciadls2ranvs u0tlenxo io1omteli o;t0teumxr iu4lle lfcia(  Dtm(  ;t0tet miciysfs2ua( p;t) eeniociatfmD lieo;() 2toxopoodlltn fcs sf rrr(ro;o1oee io3tlsfs umumsnu4tltnmr3ty1lptranvi;(0sexoxo3no1lm emncsat s2raxrpnu1olen ieiat a2el(vo ()aexnxrciatlpte ieo;(0trtr(o io1alen ivil(f 2taxmpnu0aleo f3iasfmDrmump;u0teenmf todfmteauei;s)t2xo(opiydlp nlieils) rtmurpoo1open fetadlm el(vpn()tltoxfcoatfpDe n ilt0teuoio3oy1omtelnctas  rtru o;o4oee mo3iadfmDrmnvs (4 eenxf iatop rlueo s0 exrxo oo1ole  fvsas  2ra(r ;o4aetniieild s2eau snu4aexrir3totlatrluvils)srur(m3ou4am e ietlt) rumumooo4aptnifetlslm umuvp;u0tltnmrcootlaD au o t0 rtoir oy4amee nvt ()a2tr(mpou0tltn ieiysls2rmnvpnu) renif ta1lpteauvs;s0t2tr(opoy4am e feslsfaDtmurpou1teeo iciytfs uanvs u)teeomf oytlm  ln o ()sexrxm nudlpt  ivilt aDra(m no1tlt mfetadla2ul( o;t4 exrmocio1lmte ueo;s)srxo(rpio1al  lictatfs2tru pnu0oexomo3tadfsDrmnvp ()areoif tytlm e ueo;() 2xmimpiy4lpeemnciasfaDtrurp;t4oltnmi3iysfs2eaump;t)trenmr iatfmt aivilt)t2toxopny4ll  licia() Drr( pnt0ole  f3iyd mDrm(ms t)aetoir3iydlpDr iesl(  2xm(rpiy1lptelfvil(fsrurum nu1aeto ieiyd a2ul(vo t) etrio3iytlpDr n ols  etoirpoydomt mieil(f 2trx oou4olx mociydls2ul( p;(4aleoif3to1oaDrauvolt seur(o3iy1lle mieta(  2umx onu1tpto ietltfa2umuvp;t) etnio3tydoaD  i sls)seurxr3ou1am nlieslt a2ur(  ;o0apto i3tysla2rl( pnt) eeoioctodlp elnvo ()texrxo3oydolt lnvt tf rrr(r no1tlenmfeiys m2emu s t)tetrxfcoadfpte ies ()srxrir3iy1ameemiei () Draxrooo1olt ifeiytfa2el( o () rtriocto1oaDrluvi;t  2xoio oudap emncsasfs2rmx p;t0oee  f3iyt sDuan p (4tetoir ty1fpD  ivi;t)texrim iudam n ncs (  2rr(ro;t1tetomoeilt a2ul(vpnu) lxrmf oytlate ieolt0texm(o io1aleeliesl(f 2ra(rpnt0tlen ocildfs ra(vs t4arxoio tadopDrlnei t)seuoiopiydllenlieils arrauroot0tlx ifctlsfm2ua( sn(4 eeomrctadfm rln s t) ruoir3iy1lmt lnei t srta(mpnt4aex mfcildfmDua(vont4 exnxf iadlp ranvo t)srtoxopnu4amenmivil(f rua(r nu0oetniicilt m eanvs;(0arenxoctytfmtelu ol( t2xo(m3nu1ol emfvi t) 2umx ont1aeto f3iat a el(vont4teenxfciatomte nvi;t trtm(r io1om nmfvsl(  2umurpot0oltoioeiltfa2rmn pnu4altoifcto1latrln s;t s2uo(r3oo1lltnlictat  rraumoot0ope  iciltla2uauvsnu4teeomf3oy1lm  auei;() 2tmir3oodome mics t arra(ro;o4tltoifetltfaDulumont)tetnir iatom raivo;s)t2xrim io1altelnvtl( sDtru p;t4tpx mieiyt a elnvs;t)tlxrir3oy1lptraneo (  2um(o3ou4amee nesl( aDumxro;o4ale ifetytfsDeaumpnu4 rermr ootlateanvols s2uoio3ny1opt  nci sf Dtm(rpnu1apx ifciyd s rm( p;t4texnmo3ta1latr ieo s)teurio oodapt  ncsl(fsrrmuront1ape  i3tysfmDranvpn() eerxo3oodfaDelues t) rtmxo3iy1llenlfciasfs2tr(m nt0tetoif3iyd aDra(vont)tlxrmf iydlpDelueils  2xmxo3iydape lnvilsfarrmxmpoo0oltoii3iyd s ean snt)trermr oa1op e ies s0 2to(r nu4llenlfet s) Drm(mont4aexniiciys s2ea(mp;()tetnmo oytom  luvi s0teur(o io1ame  fvs (f 2rmum ;u4tetomi3ilt m2rmu s t)aleomocto1omDeaueslt teumxo3oy1lpte nesltfa2ur(r no4aetnmfciyslaDulumo t) ltomo tatop  lues s)tetoxo ou1lltelivtas s2rmxr nt1tetn feiad sDem(vs t0 etrmr3ia1oa e nes;t  2umirpoo4am n fvsa(  Dtaxr ;o0tpxo octls aDum( onu)aeenircoy1opteaivils sruo(opoo4apee ict s)aDuaxrp;t4altn oeiyslm2eau o;u) rxrmf oytfm   ivi;s  2xm(m3nudlm nlnviat) rraumpno0tlxomi3iysfm uan p t4altnxo3oy1fp eaiei t)t2xoirpio1lpt mnvs (f rur(rp;t0tlen ociyd m2ul( ont0alenxocto1omt anvi (0t2uoxr oydomeemfeslsf 2rmxroot0oetnii3ilsfaDea( o () eenifctadla eauei;()trxoimpny4al  mfcsas)s2tm(r no4tlxo i3tydlm2el( s t)tlerir oadlmDeluvolt)tetoirpno1oltnmnvi (fsrurx p;t1apenifctysfs2el(vpnu4arxomr3iy1oat lieol()sexoir iy4llee fetlt)aDrrur ;u1apxomieilsfaDrmn o;u0treoifcto1op eauvo;s)s2xmir3oo4oltn ncs t)sDuaumpnu4opeomi3iatfm2ranmsn(4tetomociatlm  ai sls)trtoim io4lm elfesa()srumxr oo0teeo ociytlmDemuvsnu0artrxo ootfmD  n sl() rtrxrpou1ap  lnesl() 2ur(m ;u1aleoio3ias a2ea(vp;u) eeomoctydla raieo;t) 2trir oo4al nlnesltf Drrur nt1alenmf3tyd s ra( o;u0tltrifcoadoatelivs t0 etm(o3oo1lltemicsl()s2ua(  ;u0alenifetyd mDua(mo;t)altomf3oydlpD  neols0s2toio nu1amte ivsl()srur(mp;u0oee  ieildls uanmsn(0arxoxfcoatoa r u ilt0sexr(o iy4lm  lfeilt aDtmu  ;t0tpxoif3tytfm uau s () rxrircoodfa   ivo () rur(opiydoptn nctas)srum(ro;t4aexnmo3iltfaDuau o;u0aetnxr3todoaDeaues t t2uo(r iodomenmfvilt)sDumum ;u4tlenmf3tadfs2uan p t0tlxrxr3tadomtraieo ( s2tmir iodlltemnvs ( s2ra(m nu0tetnif3tysls rmn snu)alxrifctytfp elu ils0trurio no1ol emneil() Dtmu  oo0tpen feiatlm em( s;u4texrmr io1fm rai ol()t2xm(m3iy1opeelfctl(faDtr(mpnu4oleoio3iasla raumpn() lermf3iodoaD  uvslt s2toxmpou1ap e fesa( aDur( ono1tlt  feildls eln o;u4aexomr iy1lpte i o t0tetr(mpio1op nlivtasfsDtm(r ;o1oeeomieiat a ra( ont0 etoif todfpteaneo;s0trurim oodlltn nviat)arur(ro;o0tle ifctytla eau s;(0texnxr3oytoaD au olt  rxr(rpnodaleelfctas)a2taxr ot4olxoifciys a2eauvsnt4aexrifcoadlp   ivo;s srumxrpoudoltnlfvi tf rumxm ou0olxn ociyt mDra( p ()alerxr3oodfa e uvi;t0s2uo(mpoudop   iet t s2rmur ;o0aetoiiciyd a rlnmo t0trxrifciodoateai sls  rxo(m no1ome  fvilt a2trum ot4tee iictadlaDuanvo u)texnxrcia1fpteli olt trtm(mpio1lm elfvi s)sDumxro;o1aexnmo3iytfaDulumo ()aetrmoctodfmDe ivs t) exoirpnu4lp e ictas srrrurono0tpt iociltfm um(mpnt0tltnmr3oatoatrai i;s)t2umio ou1lm  mnvi ()s2uaxrp;o0tee ii3tat s2eanvs;u0 eenxo3todlptr nvo s) rxoxm iudlmeemfvsa(faDra(r oo0olt iiciad aDumu s u0 eerir iy1oaD  neolt0setmim nu4aptn fci t a2ur(root4olto ietltla rl(vsn(4tlxrifcoatla rai s t0tetrim no4ole  ictl(f Drru o;o1olx iiciad s2elu p;u) eeoxr3ia1lpDe iei s0srurxr3oydol elnvtas) rtaxmp;t1texomociltls em(vp;u0tlxrif ty1lpDeli olt0t2xmxr iu1lm  lfeta(fsDuaxrono0oeen ietysfmDrmnvsnt) exnif iy1fatr nvols seumxr nudamtemncta(fs2raxm ;o4tlx  f3iysfa2elumpnt0 renio3tydoat  uvols  2xoirpny1lp emnvslt) Dtr(m oo4tee io3tld m uau sn() etoxrciadomD lneslt) ruoir3iy4openmncsa( aDurump;u0texo feiytlmDuluvp (0trxnircoodom ran sls0tetrxm3iudalt  ivsls srrm( pno1olt ii3iys m uau o ()altoif3io1oa   neols texm(opiodlmtelivslt aruax o;o4tpe ifciytfs uanmo (4 eermrciytlmDranei;t)s2umxm ny1om  mivia(  2umxrpnt0teenii3iatfm2umuvsnu0texoir3to1omDeluvs;s s2tmiopnodaleelies ()a2rrurooo0opt  i3tadfsDrl( pnt)tlxnxo iotfateaueilt0 eumxm3iydll emnes s)sDtm( p;t4apt mi3iat s2ulnmpnu)aexnio3tytlaDelueolt)trurxo ou4ol nmivsatfa2ur(ro;t1tetn ieiatfm2rluvont0arxomo3totlp   uvolt)srxm(opno4lltelncs () Dtmxro;o0texn oeiys mDrmn s t4teenir ty1laD  ues;t)trtm(r ou4ape mivta( srtmx oou0tptnmoeiysls ea(vpnt0 lxnxf3oodfpt lies;s)texrim oy1lm  lnvil()arrau  ;u0alxo fctys a el( on(0trxnxf oydfmtr uvo t)seurirpou4omte ivt (fs2rm( pnu4tleoif3iys s rmu s;t4tlxomf tytfaDe i s s) etm(o3nu1ll n fctat)s2tm(roou4altomo3iatlaDra(vo ()texomfctydom  an i;s0 rxr(r3oudol nlncia( sDra(ront4tpx  fetydls emnmp;t4trerifcoa1oaD  i o s)s2uriopiu4am elneiatfaDta( pnt4alx mo3ilslm2rmnvs;u)aleoif io1fpDr uvi;s  exo(o3ny1ap nmivs ( sDtm(  no4ape mf3tydfa2uauvo;t0teerxo3iodfa rlneol(0setm(m3oudllt mnvtl( aDrrxmpno1tlxomociydfaDeluvp;t4 renif3oa1omD  n ils)tetr(o iy4op n fvia()s2rax  nt0aex ioeiyslm emnvsn() renif tatopt ln i;s)trur(m io1lpenlfetatfs2uaxmo;u4ape  fctytfm2em(mp;t4arenifciatlpDelieo;(0srto(opiu1lpt  fei s)srra(root1tlxn fetlsla rlumpn(4aeeomo tadlmDrluvi s0 rumim no1lp elfvi ( a2tax oou0tpxn o3iytlmDeln p;()alermocia1lpDr iei t)trtmxopno4omeelnei ()arum(  ot0opx ifctatlm umu s;t4aetnmr to1lm eaueo;t0 etoxmpiydom  lncslsfsrum(rp;u4tee ifciatlmDum(vp u4aexoif3to1faD livs;(  2umim3no4lm nlies ( sDrax ono1aptnmfeiltlsDeln p;u)alenioctytfm elnvslt)t2trxo io4lm   fvs t srum( p;u1oeenmoeiys m ra(mpn(0areoirctytfm  auesl( setrxopiy4aptnlivsas) 2ur(mooo1alenmoetltfmDrmnvo u4trenmociatfaDe n i;( seto(o ny4amte feslsfsrum(moot4tltomfeilsls2eln pnt) reoio3tytoatrln s;t0t2xm(opnudape lfeiasfa2urum ot1opt  octatfaDeau p u4aetnmr iy1lm  au ilt tetm(r iu4altnmnvi ( s2rmxm nt4aptn oeiatfmDum( s;(4trtoxf3oadomDrlieilt)sexoir3no1amt mfvsls srrr(mpou0tltn ieiysfa2el(ms;t)trxrxrciatfp elueo (  rxr(o nudlm nmfvil(  2taum nu1aleo f3ilslm2ea( s u4aetrxrcia1fa elueo;s0 rxriopoydole  ivslt)arra(  no1oetn feiad a2uanvo;t0alenircoytfa r nvi ( texmxm3io1lmeemivil() 2taxm ot1tltoif3iydls2rluvont)aexoxrctydom elnvi ()trtm(rpoudol emfvsls)a2umxr nu0olx mfetls s2emu s (0aeenmo iadlm  ai ols) 2urxopnodlmt licta()arra(moou0aeenmo3tatfs2elu on(4arxrmo ootfa r nei;s0 2xm(r ou1lptnmfcsatfsDurxr ou0ale ii3tasfsDrl(vsn(4tlermo oadoa rlu i ( seum(r3no1ap   icsat a2uaum ;t4alto f3iytfmDuan s;u)arxrxo ootfmDeanvilt0s2ur(o3oudllt miesat)a2tr(  ;o1ole if3tyt m umnmsnt4alxnmf ty1opD  u il(0 exmirpny4ll e ncia()s2rr(m ot4olt mo3tlt aDum(mo;u0aleniociytlp r n o;s s2uo(m3oudllee icil()arua(r no4opeo ietltls2ulu p t4texomo3to1optelu il(  euoio3oydoltnlncsltfsrrmumpou0oltoiietas m ranms;() eenir3tatoa e neilt)s2ur(m nu1aleemnvs ( a2rax oot0tpeomfetasfa2ua(vonu)tlxrifcto1lpDrau o;s) rxmxm io4al nlfvsasfa2rrxmont0opxnmietyd s2ea(vp;u0 reoir tytomD livsl(  rxr(m iudlptelivt s  rumxrp;u4tpxnifeiadlm2rl(vsnu)alxoiocoadoptrli olt)t2xm(rpny4lmtelfci sf rraxmo;t4aeeoif3iydfs emn pnt0aexrmr3iy1oaDeaues;( t2um(o no4amtelnviasf Dra(r nt1texniieiaslm2umnmp;(0aetnmo iadfmt  n o s)setmxopnydapt  nviasfaDrax pnu1ape mfeils s2ea( p u4tlxnmo3ty1omDrlneo s0seumxr ou1am emietl()s2umxrpot4oet ifetydlmDemumon(4 eenmocoodlmDr nvo;s0seurim ny4lmenmfviat  2raxmp;u1oexomo3iatlm umn s u4 exomfcoadom   ues;s0t2tmxr3oudalt mnctl(  rurxr ou4tpeomo3iadlm2rmn s;u)tlxoir oy1fp raiei;( trxoio3nodol nlneias  ruaumo;t0aexoif3iltfaDul(vs;u)texoifcty1fpt  n i t)setmimpou1ame mfcias) 2ua(rp;t0olen o3iydfm rm
\ No newline at end of file
@@ -0,0 +1 @@
+iei;(  rxrxmpiu4ole mfesat)aruauro;u0tpeomf3taslmDrl( p;t4arxomo iydoat  ivsl(  2xmim3no1al nlics ( artm(m oo1oltomf3ilsls umnmp t)arxomf3to1omDrln i ()t2to(m iu1oltelfvt s)a2ta(rp;t4tlen fciydls2elnmo;(4tleoxf3iodoaDr u i t  rtoiopno4llenlivil()a2rrum oo4tlxn ociatfm ulnvo u) eermr3oytop elu sl() 2tm(r3nodlpeelfvtat) 2ua(rp;t1ape  f3tlsfa eaums;(4 etoxf oatfaDe neil()tetrir3oudal  mnvias)sDtaumont0oleoifcilsls2ra(vsn()aetnmf totoaDeauvi t s2to(opnu1alt miet ( s2ra(rpnt0aeen ictad a2rl(ms ()areomociydfaD aies s)s2tr(r3nu4lmenmfvtls) rua( pou1opt  i3iad s2eanms;u0artnmo ty1oaDeaieslt0t2ur(rpoudol nmnvta(f 2rmxmpot1texnmo3iltfm2em(vp;t)tetnxrcto1lm raueo t) 2tmiopnydol  licilt) Dum(monu4tee mieiltls2uln ont)tlxrircoytomDe uvo t0t2xm(r3nu4lm  lfct tfsDtm(rpoo0aleoiocias s umnvont4 etnif3oa1fm   ivi ()t2uoxopoy1llt mfcil()sruaxmoou4aptnioetltla ea( o;u0teenmr3oytoaD  uvsl()s2toxr oodll e nesl(  Dtr(m ot1oet ioetadfsDrmumpnu0alxnmo3iy1lpDraueilt0s2xoim3ou1ole mneslsf rurxm nt0texniieiasfa elums u0teenmr3ty1la eaiei s t2um(m3oo1am elics s  rumu  nt1tlt  o3iasls2rl(mp u0trxrif oytopDr ieo s trumxmpnudam nlnetatf Dumumpnu1oex moeiysls2rl(ms;(0arxrxo3iotom  aneo (0tetmxopoy4om n ieilt) Drm(r ;t1apto i3ilsls emnvs (4 exnxr3tytfmDr u slt  etoimpnu4opt mivsat) rtmumo;t4tetniociytfa emn p ()tleoiocoadlpDrau o;( sexr(m3oydape lies s)aruru  ;t4aetoii3iasls2ra( p t0 exrxf3oatlp e ueo s0texmxm io1lle  nciasf 2trxm nt0texn ictadlaDulu onu4 leoircty1lpt aiesls t2xoir oy4omte nvi (  Dtrxmpoo0oex mo3iytlm rlnmonu)trtrif io1omDeluvs;t)teurxo iodope mnesa()aDrm(  ;u4apenii3taslmDeanmp t4tlxoxr todfpDraieols srxmxr nodlpee iesls) rtm( pnt0olxoiociltfa2rmuvp;() exnif io1fpteli i;(0 2tmxm3iu1am  mieilsf rrmuro;o0tet iociys aDum(ms;t4 rtnxo3tatfptrau i;t0 2tmxo3io4lmeelicta(  rum(m ;u4apxo fciadlaDumump u0aeeomr3todopDrlnes s0 2uoim iu4lltnlfcs s a2rmur ;o4aex mictltlsDuluvo u) lerioctotfa e ivi s0srtr(opiy4lm nmfvsat a2tm( o;u4apxoifeiys sDemn o;u0tltrxr3oadfmt  nvo;t  rum(opiu4ame  ics t s2uru ooo4tet  oeiat m2um(mpn(4tetoiociatla rai o;s0 rxoxmpio1ap emnei s  rta(mo;t4tpe  i3ild sDrmnmsnt0 rxrxf3iatlmte uvolt) 2ur(r iu4amt lnct s) Dumumo;t1oeeomf3ild s2rmn o;t0artnio3iodlatrli s s0srumir oodllt  ncsl()srrr(rpnu4teto iciat mDuau o;u)aeenmr iadfm eluvs s0s2tmxo io4am  micia(  Dtr(m ;u0alto f3tlsfaDemums;(4trxrxfcoatomDean o t0t2tmxrpiy4al nmfes ()a2rrxmpnu4alxomfeiadfsDrl(vs u)tetomo3iotlp eaies;s seurxo nu1lme lncs t) rtr(root4tet io3ilslm ulnmp t0teerxo tydlpt lnesl()s2urir no4apeemieslt) 2umxm no4aetnmiciat aDrlu snt)trenmocio1fa eau s s seurxrpnydom n ncsl() rtmx  nu4tpe ioeilslm ra(vonu)tetrioctadlmD ln i;( s2umim iydal   fvtls) Duau o;t1aetn f3ildlsDuan p u4aleoif tatla  ln s ()t2urir3nodlmeemnvt ()a2uau o;t1altnmieild m ulu o;u0texomfcia1opt an s;(0 exoxopny4op nmivsa(fartaxmp;t1tetniiciydfsDranvont0texnircoadfa e ies t) 2urir oudlmen icsls)arrrxm nu1oex  o3iat a2rlnmp;t4 etnif totoptrlies;s0s2tmxr iu4aleelicsat  2uaumpno4aee iociydfsDrmuvp t)alerxo3oo1om  luvilt0s2uo(opoo1ame lfetlsfsDuaxm oo4aet  ieild aDrl(ms (0artnxf oodlatranes;s trtm(opoo4lme lnctatf rurumono1texoii3iytfa rl( pnt)texrxo io1faDrlueo t) eurxopiudamt  ietat)a2rrx  nt0oex mf3ils sDrm(vs u) rxrmo io1fatrliei;s0 etr(rpiudole mfetat  2rrxm ot0tltoifciysls2rmnvont0 exnxo iatfmtr ieo;t)trtoxm3oo4oltnlfcia(fsrtrxmpnt1oexn i3tyt a2em(mp u) lxoir3iotlat au o () rtriopiudopee fcil(fs2uaxro;u0aeeomi3ias s2el( o;()arerxo iodlpDranei t texmxmpiydlle  ivtat)aDuax  ;o4tee iiciytfs rln p;u4artrmocoadlp rlivs t0srxr(r oo1llt lnes (  Dum( pou0altnmicilt m elnms;t4aexnmo ty1lm rlu ils)srxr(o3oodoltelfci ()sDtrurpnu4opto octys s2rmnvo () ltnmo3iy1fptranvo t  rumxr nu4aleemnci tfsrrmxmp;t1ale ifciatfs2ua(vpnt0texrifcoydom  lueols trumir oudlm nmfes t  Dum(rpnt4aee if3iyslaDemn sn()artrxr3tadfmDe ivs s0t2toxmpiy4amtemfvia( sDumuro;u0teeomiciyt s ua(msn()artoxr ia1fatr ies;s0 eumirpiy1al emfvt sfsrrrxmono0aleniictyd a rm( o u4artoio3iodop eli ols trur(r iu4am  lncs ()a2rrur ;u4teeo ociat s2em(mp;() lermrcta1lptelivs t trxoxr iy4lp e icsa( aDur(rp;u1apeo oetyd a2emuvs () exnxr3tadla   uvo s srurxo3oo1lptelivtas)s2umurpnt1tpt ifetasls2uau p u0 lxoxrciydfpDrluvil( srtmimpiudalte nvi tf 2rax  oo4olx ifciad m eaums u4 rerxo3iydfm eai ols0 rtrim no4ap nlncsas)aDta( pnt1apto i3tysls2rl(vsnu0trxrmo iadfate uesl()trxmimpiu1ameelncils)aDum(ro;t1aetnmfctld m2rl( s;u4artrircoy1opDeli o (0 rxmirpiy1opeelfvia(fartaurpot1oexomfctadfmDean o t0aexnif ootlaDean s;(  etm(m3iydolen fci s  rrmxr nt1oexo fctltls2eanvo;(4teeomocoatlm rai ils)srxrim3oy4lme  fcil() 2tau poo4tetniicilsls2eluvs (0aexomoctydomte i o;s) euoiopoy4lm e icta()a2rrx  no4tpe mfeiysfs2um( s;u4 rerif3iodfp rln o s) rxoim3nudllenmncias  Dtrumo;o0oet mociysla uanmo;t0 rxnxocia1fm  livil( srur(opnudoptn ivtl( aDurumo;o4tet ifcild sDeauvp (0tlxomo oatlm   nvo (0 2umimpny4ap emncils)aruaxmpnt1aexomfeiyd s uanmpnt) etoxo oa1opte i o (0s2urxm nu1ap  lnviat)s2tmuro;o4aee  oeiydlm2ra(vo t) exrmfctodfpte u o;s sexoxrpiudoltnmnesa( sDuaurpoo1teeo feiysfm2elnvon()alxoxocoodlpDe ivil( t2tmio3oodlmte ictl()a2trxmono4tlx mf3iat a2rau s;t) exoio3ta1oat lnvil(0texoxrpno1ape mfeslt arta( o;t0tlxniieiadfsDrmumont4 rtrmf iatoat li ilt)s2umirpnodopt micias) 2ra(  ;o4alx ioetys s2elnvp;u)trtnir3oo1lmtelu ols t2xrxopio4alt lneia(fsDtrxm ;o4opx mf3iltfmDran p ()aeeoiocoydlmte u s;s0trxm(mpiy1apt  fvilt)srtrxront1aexnmo3ildfa rl(vpnu) ltnxf iadfa eaivilt)teuoxm3oo1alte neta(fa2rrx pno1olx  i3iys s2emump;u0 rxrmrcty1fpt auvs t) ruoxr3oy4lmtnlnetas) Duaxmont1tlto o3tas s rm(mon(0tltoxo to1om ranes;t t2xm(m io1omeelieiatf 2tmuro;u4olto i3iyslsDrauvp;(0tltnxr3oatom   uvs;(0trtm(m oo4ol nlfesas a2raur nu0oex mi3ilsfa ul( p;()arerir iodfmDr i ols0srtmir ny1lltnmnct t)srtaum ;u0aexomieiatfs2emnmp t0aetoxrcootlmte nes t) ruoxopoydomtemfesasf rumxm ot1ole mictys a rm( o;()aeenxf oytlm e nvs ()srtr(r iodolt mnei ( a2ra(m oo1alx  ictlsls rlumonu) exnxociytfm   ieo;(0seum(m oydol  mietas sruaxm no1ole io3iadfa2elnvs;t0 leoio3oy1fpDrlnvs;t)setm(m3nydolt  ivil(fs2uaum nt1tleoif3iys a2ul(mo;t)alermo ty1lm  anvslt0teuoim oo4lltnlnei sfa2ra(ront0aeen ietyd s ulnmsnu)altrxf iotfaD ai o t0 rxm(opiy1op  lncslt  rrrx oou4aptnmoetldfm umnms;t4tltnxf ootopDe u o;t tetrxr3oydaltemnvsat arrax onu0oltoio3ils m el( p;u)areoiocia1lpDrau o;( t2xrxo3oodlpe lfvilsf 2taumpnt1tetnmoeildlmDraump u0trtnircia1om eln ols)s2umir no4apt mneslsf 2taurp;u0olxnmo3iadlm2um(mo;u4aetrmf todom  lneols0trtmim iu1lpen fci (faDumx onu0oexomo3tlslm2rmumon(0aeerxo3iytlmD  i o (0tetmirpnydlm  lfcias)arrau  nu0aleo o3iytfs2emnmo;(4trerir3oadlmD anvols  2uoxr oodlp nmicsasf 2rm(roou4tetnmoeiytls eaums;t0altnxr iydom e iei;s)t2xm(m iydlmt mics s  rtrxro;t4tlx ifciyd sDrlnvsn(4tltnxf3totlpt an s;s0s2xmio3no1al e ivs tf 2tm(ro;o0oee if3iadfa uanmo t4 etrxo oytoaDeli olt0texm(o3iy1lm elncs tfsrum(mp;u4tpxoiiciatlmDea( o;t0 eeoxoctytfa ranvo t0setmir oydlptn fesls  2tr(m ot0ale  i3iytfaDumuvont4aeerir oydlmte n o;(  rtm(m3io4apenlfvtls aDum(mp;t0opt  ociadlm elums u) lenmr3ootom  aivils)t2to(r3oy1omee fci sfsrtmumo;t1oltoifeiyt s2ul( onu) lxoxociy1latr n i;s) 2uo(opnu1open fct s) rrau p;t0opxnmo3tys s ea(ms;()teermf oatla e ues;s  2urirpio1lpe lici s)aDtm(m ;o4altoiiciad mDrl(ms t4 exoxoctodlat lnvsl(0trxr(r3iudopenlfet (f Dum(  nu4aptn feiaslsDraums u0trerxrcoa1oateau i (0srtoimpiy1lmt  ies ( artau oot4aee io3iltfmDeau snu0trermrcoy1lp  an o s  exoxm3nodap e neta(f 2taxronu1apeomoeilt m2eau p;(4aeeoxfcoydfmtr u o t0 eum(r oodoltnlnvsls) rrrxr no4aetomf3iadlm2rmnmp;t0trtnxf3io1la raues;()t2umxm iudol elnci (  Dur(  ot0aetnmfeiydfsDul( onu0tlxnxrciydlmDeaivi;()t2urio3ny4aptemfvil(faruau pnu4tlen ictldfa2el(vpn(4 eerif3oatlp e u i t0 2xr(m nu1alenlfcsas)a2tr(mpnt0tpt miciadls2umuvpnu)tetnxf oo1oaD li ils)tetoxm3iu1ol nmicta(fsrtmx pot0aexoiieiltfs2eanmo;()trenxf tytfa eauei;() etmio iy1alee nvs t)aDrruro;o1olx mo3iasfmDrlnvon() rxoircoydlp e u i;s0 etoir iodlm emnvsa(farurxr nt0oet mi3iltlmDemumpnu) exrif oytfmDr n o;t)texrim3iu1om emict t) 2rmxm nt4aee mictys aDemnvonu4alxrmf tytlmDranvo t  exrir io4ol   ncta()srtaur ;u0apt io3tltlm em(ms u0aexrmfctydlp  lieolt0trxm(opiy4opt mnct s) Dumxm ot4oeen i3ias sDuau s t4altrxf3iodlp  aneslt0texrirpno1amt mfvia( arua( oot1tptn fciysla2ul( o u0texrxr todoa  li ilt setmxm3iu4lle  ict ()sDurxmooo0aee iociaslm2ua( o;(4 ltnxfctadfpDe uvs t0trurxr oy4ale  fctatfsrurx ooo4apt  fciyslaDra( s;t4tlxomociatom e ues t s2uriopiu4lm nmfvtltf rrmur ;t1oex  octytfm2eanvs;(4texnmfcoadfa r ieils seuoxopoydopte fei t)srrmu ono4tpxo f3tlslsDulnmont0artnircto1opDraivs;t) rtmio3iydlmt mnesl( aDumumooo0opxoio3tld aDumumo;u)areomrciotfat  n olt sexoxmpiydlpee iesat)sDtr(r ;u4alen ieiysla2umuvo;()aexomfciodfm  li ils0 rtmxo oo1llenlnctl(f rrr(m oo1opxomoctls a ulnvo;()arenxociotop eanes s s2uoio oo4op  lfvsat)sDurxmono1tpt io3tyt a uan p;(0alenxr iotlmtelnvil() eurxopoydol n fvil(faDraum nt0tetoif3iasfsDeln pn(4tlxrmr totomDraneils s2trxopiodam  mies ( sDta( p;u0opxo f3ildls2rl(mp;()texnir iotlaD liei;(0teurio oudlleemfvias srururpnu0aexomiciadlm rauvsn(0trtnxo oytla   ueols) rtr(r3ny1lmeelncsas artax pot1tlt mietasfs2rl(vsnu)arermfciodfptelu s t seuo(m ou4omeelfciatf 2umurooo4apenmo3tyt a umumo;t0 lxrmo oy1oatelnvs;s0srxo(m3iy1aleemivil(  2rr(ront1ope ioeiatls emnvpnu4 renxo3oatlaD lu o (0srto(opny4lm e neil(  Dua(m ;t1apeoifctaslsDumn p;u4 ltnmf3oo1lmDe ivo;s srur(rpio4oltnmfcil(f 2uaurpnu1alxnio3tydlsDelnvs;u4trermf oodfmt an ols s2uoirpny4am emiciltf Dtau  ou0opx  fciaslmDel(ms;t)trtrxr3ty1lp rauvi;(0 rtoxmpoy4ll e ics t s2umump;u0optnmf3tatla2rmu o (0artnmo oa1lmDrlu s;( tetrimpou1om emicsas s2um( o;t1aet mi3iadfs2rmnmo;t) ltnxfctodomtelnvs;s0 exrxmpio1lptn ieiasfsDtaxrooo4opt ioeiad s2ea( snt)texnmr totoate iei;()sexmio3io1omtemnvs t)a2urxr ou1apeomo3iltfmDulnvs (4 eenmf3tatomteln s;s0 2uoim3oy1apeelfeta(fa2rm(rpno4tlxo ictaslaDeanmo;t4altoircto1fmD auvs;() 2xo(m3oo1optemfei ( aDumxro;u0olenmo3iltfs2em( p;u0artnxr oodla ran o s seum(m3iodalt mncsasfsrtauront4oetnmoeils s2em(vs;u4texoifcoadlmD lu i;(0t2to(mpiu4lme lietas)artr(mo;o4aptnioeiysla ulnvonu4 rtomfciatomtr nvi (0setmxm nudame mfvi sf Dtmx o;t1oltomfctas aDrauvp;(0 exrmf3iy1fp rlnvsls0t2to(o oo1lme lies s sDrru pou1aet  o3iysfs2rmnvsn()tlxoxocto1fmtraies;s s2xrio oo1ale  nvils) 2rrurp;o1opt miciltfsDumumo (0alerifcty1la eanei t truoxopnydop elfct ()arrru p;o0opxn ieils a emuvp;(4 reoifciotomDelnvi;t)teumxm nudamee fetl()sDrmx pno0opxniieiadlm rlnvon(0artrmrciytoateaieo s texrir oy1al nlnct ( sDtmxmonu0tltn o3iydfa2elnmon()aexnxo3iodfpte nvilt0setr(opno1apen netas a2rau oou1open f3tlsfaDra( snu0tlxomf3iatlat ai ol() etoxmpiy1oltelfct (faDtrurpnt0ape ifciydfa rmuvp t0 rxnif oy1omD lu s ()t2trxo3iydolenmnesltf Dumur ot4oetnifciltfm emums;t)aeeoiocoatomtrln i;t) 2tmxmpiodllen ncs t aDrrurp;o1aptn oetyd aDemuvs;t) lxrio3tydoatean s;t0sruo(mpio1ameemiet (fsDta(mpnu0oltoif3ildls2umu ont4 eerir tydfpDrluvs t0srtm(o nodam   nvia( aDurx ont4tet ifciytla2umnvp;(4tlxrmr3to1omtelueilt0 2xm(m oydaptnlnet ()srrr(m no0oet ifciys a2rm( p u4aeermocoadlptr uvo;t trtoxr3iy4lm nliet ()arrmxro;t0optoif3tldlsDum(vp t4arxnxr3oatoa rau s;()trtr(o oo1om emfvs s a2tm( o;o0opx moeiyt sDrl(ms u0artrmo3tadoaDrlies;( sexo(o iudom elfvtat  Drm(rpot0tle  ieiat mDem(mp (4 ltnmo3oo1opt ai il(0trxoxopnu1omt mfvt t)sDtmum nu4aee ifeiad a2umn snu0texoircty1oa  lnes;t  2umxr oudapee fctls a2raxr ;t0ole  oetltfmDumuvo u4tetoirctatlmt aivolt0trtoxrpiy1amtn fetat)a2tm(ro;t1ole ioctls sDeluvsnu)texrxr io1fp rluvs t  etr(o iydll  miesat  Dta(r ot4aetomi3tasfaDeanmpnt0tltnmr3tydlpteln i;() 2trxr3oo4lm n neiat)a2uax pno1olt ioetatla rm( snt)alxrmrcoo1opte ivs;s) 2tr(opoo1lle mncsatfaDumx  nt4oex miciasls2umums;t4 ltoio3iodfpt auvils0s2trxrpiu1am  mics s)srtm(r nu4tpt  ociasfsDrmnmpnt4trtrmfciatfpD  ivs;s s2tm(m iodape lfcs t sDumxm oo4alxomo3iadlm2rm( p;t) rtoio3iotfp r ieslt s2xo(o3nu4omee fes ( aDuaur ot1tee mieils a ua(vp t0 eenif io1op eaiei;s sexm(r3iu4al  mfeias  2tr( pot1tee ioeils a2rm(mp;t0 exrmfcoodlp r ivs t0trur(opou4ll  mivt t a2rrxmonu0apx moeiytlm2rln onu4tlenxf3iodomteaivo;(  etmxm3no4op nlictltfsDtr(mooo4alxomfetatla2eauvo;(0aeenxfcoytom rlivsl() euoxopiudameemnci tf 2umu pnu1texoioeilt m eanms;u4artrxf3to1lm ranvsl(0s2toiopoo1alt mneiasfa2taump;u4oeenifeiatlm ea(vp;t)tltnif oy1fmD li ol() rtr(o3nu4open iei s) Dua(r ot4tlen fciad mDrmu p t0tetrif oodlp   i o s0trurxo iydll emnvils)a2ra( o;o0aex moetldlmDeluvp t0alenirctodlp   u i t srxoio io1ll  mivi t)arrmum nt4ale  iciydfaDrmnmpn()areomocto1oa rauvi;s)tetmimpiodol nmnvt t)s2umuro;o4apt  i3ildfs2emumo (0texrioctodoa rai s;(0sexo(rpnu4alee fvs s) Dum(m nu4oltomoeildfs2emnmpn(4aetnmfciy1oaDe nesl(0 2xmxopou1omt mfvtlt aDur( o;o0olxomoctad a elnms;t) lenmf ta1laDeli o;t)srtoiopnudlltnmncils aDururpnu0oeeomieildfa2uaump u0alxrif to1fp e uvil( teuoirpoudolee iesasf 2ururpnu4opx mf3tyslsDuluvo;u0artrif3todomDe iesl()sexmxr oydll e fvtls  Drmu p;u4tlt moctytfs rmnvp;(0 leomf io1laDran s t truoxo nu1ale mfesa() rtrx p;o1oltoioetlsfm el(msnt4aeenmr3iy1fptr neo;t)t2to(o iu4am nlietl(faDurx p;u4oetn fciltfs em(vp;t4tlxrxo tytlmt ln slt)srtm(o3oo1lpt mnei s) 2trum ;o4optnmi3tysfa ea(ms;(0arxoxr3ia1fmDraivo;() euoiopio4omt mnesa()srua( p;o1aptomo3ildla rlu sn() eenxf3tadfa   ivs ( texmxmpiy4omeelfvtltfsDua(rpnu4tlx iociatls uau o;u0tetoifctotomt ai ol( s2trir3oo1lp nlfvsls  rtr(m ;o4tltnmietat mDeln p ()trtrxf3oydla  livi ()trxrimpno1ol n ieta(  2rmumont0apxomf3iadfsDemnmsnu4tltrirciydlm eanvil()sexrxmpiodopeemfcs t)arumumono4aeeoio3ild m ra(mpn(0aetrirciydfpDrluvi t)srxo(o iy1om elivs tfsrur(m ou1apxo o3iydla ul(vo t0 eenxo iadlp   uvo;()texo(rpiy1omt mnvils) 2rm( pnt4apeoii3tasfs eanmp t4 lxnir ty1lmteauvils)teumim3ny1apen nvs tf Duauro;o4tptomoctld mDumu onu4 ltnmrctotop   n sl(  rxo(m iudop n nvtatfsDtmu  nu1optnmfctytlmDemn o u0aeermf ta1fmtr nei;( tetrimpou4ale  nei (f 2rrxrpno1aexomietydfa2umumsnt)tleoif oodoptrlivi s setr(m3ou4lle  nesls aDua(moou1aexomictytlmDrmn snu0 ltnmfcoodfp  luvs;s) 2xrxr3ou4op emics ()s2um(monu0olxn oeias s emn pn(0aleoif tydlmD lueo;( srur(rpoudll nmivi t artru poo0oltnmo3iyd a2elums;u)teenirciydfp e uei t0truoir3io1alt lfcs () Dtrx o;u4alxnmf3tad s uau s;t0tlermfcia1lm  liesl()seuoir nodope  ncilt  2trum nu1tlxoiicild s2el( s u4 etomr3iy1om  anvi t)srxmxrpoo1ale lnci s  rtrum oo0oleomiciatlaDuauvp;(0aeeoxr3oy1la eln i;t0seumxmpoy1om  lfvtls)sDtmum ;o1olt ioeiys mDemu o t4trenio3oo1fmtraivsls teur(opou1lle  iet t a2ur( oou1tpxn icilslmDel(vp;()tleoxfctydomDr uvilt0 rumirpoo1ol  mivtasf rra(moou4alt mfctytfs rl( pnt)areoir oa1lm eli ils  2uo(opoudllt  nes ()aDtm(m ;u1tpxomf3tyt m ulnvo;t0arxrio iotlaDrlieilt) exrio nodale lfctltf Dtrx pnu0apen feildlaDum(vp;t4 rtomocoo1omtean olt setoim3ny4ll elnvslt sDtru o;t0aptnmieiydlmDem( o t4 ltrmf3ty1laD  nvols  rtmxr3no1aleelneia(farra(r ou1tltn octlsfs ean ont) rxrir oydlptranvi;s0setoxo oudom   nvia( aDumxrpoo0aexniociysfs ua(mp t0aetrxo ta1op r ivo t0srxmiopoudal  lfeia()a2ta(mpot1oex moetys s2ra( o t4trtnir oo1lp  an o;t) rurxo3ou1alt  fes ( arta(m ;o0opxn fctldlsDrlu p t0 rtnmf3oydfmtrai s t0 exr(opoy4lltnmnvs t)aDta(rpot1olxn icilsfmDrmu s;(4alenir tadfa rlu ol()s2toxo oo1ol emfct () Dta(mpnu0apxomoctlsls emn o;(0 lenmr3oadfatrluvs;t0srtm(r nodlle lfvi s arua(ro;u0alxn ictydfsDraumsnt0tetnmociodlpDe n o;t0sexo(o oo4lpeelfetat sDtax oou1tee iociyt a2emnmo (0tlenmo oadlaDranvi t truoxr iu4lmenlfcsl(f Dtruro;t0opeomieilsla ranvs u0tetnif oo1omteaivs s  eto(o nu1opt  ncs tf rrax oot0ale mieiydfsDrl(vp (0aetomr iadlp  aues s  2tmxrpnydlpt lnctat a2rau  ;t0alt iictltls2emump t4 rxomf3ootomtranvs s trxrxr3ny4lp emfvslt  Duru  ot1tpe  iciysls2rmnmo t0teeoxocoytlpDrai sl()srto(r3iy1al  mfviat) rum(r nu0tptomocildls2um(mp (0artrmf3oatlmDelu o;t)srurxm nu4ole  ivils) Durx  ou1aexnmiciat a2rluvsn(4 exrxf tadlmDeln i (  2xm(m3io4lmte fvsas)aDrrxm oo4oetnmfetltfs2rln o;t0 eeniociatfa rlieo t0s2umxo3oy4om nlfcil(fa2uaxmonu0altnifeiyt sDulnvpnt0 rtrifcto1lptraueo s)s2umio oy1aptemics t artaxrp;o0olt mfciltlmDeau o;u0tlenmr todfpD luei t0s2xm(mpio4am e nesltfaDtr(  ;o4aexomf3iat s ea(mp (0arermocoadlmD  u ol(  exoxr3iu1optnmfetat a2raxm ;u1aexnifetldfm2rmn o;t)arxomo ootomDraues (0truoxr oy1omeelieil(fs2uauro;o0tet  icildfa2eanvsnu0arxrmo iotfmDeau s;s) exrxo3iodlp nlnetls sDurxmoou1optn i3ias aDelnmsnt0 etnio3ia1fpD ln s;s)t2toxr3oy4ole  netl()a2ua( ooo1apeoioeiad a emn o t)altrir3io1lateau i;(  exmxo3no4omenmnetl(faDrmxmp;o0optoiietytlmDelnvsnu4 reoxfcoa1lpteanei;s0trtrim iu1om n nctlt) Dra(r ;o4oexo i3ilt s rlu o u)tltrio oadfmDe n sls srtrio iudll elnet sfsDurxr no0altoiiciltfm ran sn(4 lxnir3tydfa  auvs;t)texmimpoodole liesasfs2uaumont1olt moctasfs2uauvp t)altomfctotfaD  ivils)s2tr(o nodamtn ieil( arrru pnu1aex mf3iltfa rmums;u0 leoir oa1omteaueils)texo(m nu4om nmnvil(f 2ta(moot4aex mociatfsDulu pnt)alerxociydopDrlu sls trur(m iudapt  fci tfsDtrx onu1opxnmieiysla2rl( s;(4trtoxr3iydfat an i s) 2xmir3oy4lptn feils)aDururpou1tee  o3iyt s2emu snt0tetnxo3iodlm   u o () 2xmxr io1oleelicsat sDrmx  ;u0ale mo3ils a umuvp;() eenxf tydopte i sl() rxriopnydlltnmfcs t) rrru pou0aet  iciydfsDulnvp (0tlenmf oytfa e uvo s0srur(o oo4apeelfcias) rra(m nt0aet  o3iysfmDuanmo;u0alenmfctotfmtrlnvil() etm(mpny1lm n nes tf Dtmur no1tex  o3tydfs uan s;() etoir iodoptr uvs;t0 rumio iy1al e ictat a2raur ot4tpeoif3ils s2rmump;u)aleomo iodoa rln s;s s2uoxopoo1ale lictls)srta(  oo1ope mfeiytfa ea(mont0arenxr3oy1lpt an o;( s2xmimpoy1ol  mfviatfaDtrxr nu4oeeomfeiltfsDrlumon(0tltrxoctytom ranes;s0 eum(r3oo4lm nmfcilt srrrumonu0aptnmo3ils a ea( o u)trxrioctadfa eauvo t)trxr(m oydlmt mnvs s sDta(mo;o1tpe iociytfa uanvp;u4aexrmf iodlm rli i s)sexoxm3nydol nlfci s)srrmu oot4oexoifcils s2rluvs;u)tlxnir3iodlpDeanei t)teuoxm3nu1amee fvt (f rumx ooo4tlt moetydlm uan o;(4trxrio3iatlp   n o s t2uoxm3ou4aptnlnci (faDra( ono4alxomo3iadfs2ulnms;()aleoxo3totfa eli o;()sruoxm3ny4lmt  ietat)arrr(  ;t0optn i3iysfa2em( o;()arxnif tydlmtrlneo s  etrir3oo4lptelfvt sfs2ra(mp;u1oltn feiltfm2rmums;t4 eeoxr3iatfm   ivi;t srxoxr3oy1am nlfcta(  2rm(mo;u1aee iieiltlsDemums t0trenxf3oa1lpteln o (  exmxopou1olee ivt t srrm( poo4tlto ieias a ranmp u0 exnif3iytlaDeau s;t0t2trxrpoo1al nmfcsl(fs2taumpot0tpt  i3tydfm2rmnms u4aeeoxr3iydfaDrlivi;(0srumio3oo4amt lfvt t s2rau onu0alen o3iysfaDrluvp;u) reomfcoodomtr ues ( sexr(r3oy1aptnlfeia() 2umumooo0aleoioeiytfs eanvpnt4 rtrmf iotfa  livolt teur(opoo4ll n ieiltfaDtm(m ;u4tlenmicildfaDua(vp;t0 lermfciodop  lnvi t s2tmxr3iu4llen nci ( s2rrurpno0tpen oetlslm2umn pnt0trxomf tadlpDrlivol(0srtr(opoodale lfetat  rrmumont4optn iciatlsDrl( o;t)aetomo oytomDr i o;s trtoio3oodap  mnvs tf 2rmxr nu0apt  ietys sDea(mp;() exrmo3oydlptean s;t)truo(r3ou1op nmnet ()aDururpnu1tpe iieilslmDel(mp;t0 exoio3tatoa   uvil()trtmxopnu4op emici t  rur(rooo0apx  icils m2rmn p t0arenif to1fm rli o t s2toxopnudlpeelictas) rrmum nt0teenmociyt s rl(vs;t)artomfcoy1lmDe iei;t  2to(mpio1lme liesls) rrmum ;u0alx mo3tys s2umnvpn(4tlxrio3oytlaDrlnei;s s2umio oudlmt lfeia()sDra(mpnu4tltn feild a eaumsn(4alerioctydfm r neils)teuoxr3nydaltemfvs tfarrm(r nu0tpxniietydfa rlnmo;(0trxnmo ta1oatelies;(0srto(m3nu4ole  ieiltfaDumx o;t0alxnmieildfm emuvpn(4aleoxociy1la rauesls  2trxm iudlp e nvta(f Dumxm ;o0apto oetasfs2umnmp;t4 lxrir oadlm   uei;()t2uo(o3iy4ol n ieslt  2rmuro;o1opxomoctaslm2emnms t)tetnif3oodlatelieils  exoxo oydlleelfcil()a2ur(rono4oeeoifctlslmDelumpnt4aetnir oydoaDr ieilt) 2xrir oodape mfeslt) Dur(mp;t4tpxomfciyslsDrm(vsnu0trxoxo3ty1oa   n s ()s2tmxmpiu1al n fvt s) 2rau p;o0olx mfeiytlaDelums u0altomr ty1opteaivilt srumir oy4altnlicsls  2urumono1ole ifciyt mDrl( p t0tltrmr3ia1opt auvo;s)srxoxo iy4omtelictl(f Dtrxmonu0open fetlslm elnmo t0altoif iydla rliei () 2uoxr oy4om nlietlt)sDtr( p;o0olx mo3tydlmDraumo (0 ltnxfcio1latrlu ils t2tr(o3no1olen fciasfsDrmumpno1oee mfetytfaDrmumo;u)texoxf3io1fmtr uvi s)texrxm3io4lpen icsl() Dumumpot4apxomociadfm2rmuvon(0tlxnio tytlmDeaueol()s2xoxmpiudlm  lnei t)s2rm(mo;t1alt  oeild mDemn snu4tlxnircoa1omD  nvil( trurxr3iy4ol e iesat  Drm(  oo4oeeomo3ildfm ean o;u4trxnmo3ootoptrln o;(0 rtrxmpno4omtnlfei ( a2urxmp;t4oetomfcild a2ra(mp;t4texrmf3oatlate ieo;s) 2um(rpny1ol   icias arum(mooo1opeomfctltfaDum(mont) ltoifctydfatraieol() 2xrxopnu1op elfcia()aDumurp;t0olt io3ils a em(vo u) rxnxf3oa1fmDe uvsls0s2urxrpnu1llenmfeiat arua( pnt1olx iociadlm rl(ms;u4 renir3oy1lpDrai i ()srtr(m3iy1amenmicil(faruau p;o0alxnii3tysla2rmuvo;u4alxoif oadlptelnvs;t) rur(opio4ll nmnvtls srur(  ou0apxoio3ils a uan snu4tltoxrcty1fate uei;( s2xmxm3oo1op  mnvilt) ruru  ;o0oetomfeiat sDrmuvs;u0arxoirciodomteaiei t0 2xrir3oy1am elnvia( aDtrumont0ole ioeiytla rauvp (4 reoxfctatoa eanvi (  exmir iu4lp e icilsfsDurxm nt0alen o3tyt aDeanms;(4 lxnio iodlp   i i (0 rtoxo3nydopt lfciat)a2ta(ro;u4tpe ifeilt aDumuvpnt)teeomf oydfaD aiei t sruoxo3oudlpt lncsl()arurxmpoo0ole ifeiytls2umnvsnt4aexomo3iotfpt  i i;t0 eurxr3io1llenmfei s)sDrmxm no0oltnmi3iys a el(mo;t4altrxo3oydlatelivil()s2xoirpou1amtnlnetasfa2rmu  ou1tee  ieild m2um(mp;t) lermf totlmDelneo t srxoxr nodlle mnetat)srumu ooo4aexoio3iytlmDrm( s t0alxnio iodlp elueo () ruoxm3iydlleemfvil(f 2rmxrpnt0oeenmocils m ua( s t0trermfcoydlate i sls  exr(m3iu4opt lnes t  2raumont4olxnmi3tls m um(vsn(4artnmrctatoa eauvilt) rur(r nydop  mivt (fsrtmu ooo1oetoii3ilsfa2rmnvp;() eenmf3tytfa eaneo;t)s2tmim ny1ole  fei ()artaxrp;t4tpenmf3iltlaDulnmpnu)aexrmo oodfpDe uvo ( s2tmxo3iy1ol elfcilsfaDrr(rp;u4oexomiciasfmDeluvpnt4arenxr oytomte ivslt texmim3oo4ope lnes ( arrrxmono1tle  o3ild m rmumsn(0teeomf3ootom   ivs;t)sexmio iu4openmncilt srumu ooo0aex  fciytlmDuanmo;u0altrxf3iytopDraies s) eum(mpnu4omeelivia(fs2taum ou4alxn iciydfs2uluvs;t0 rxoxf todfm  aieo t trxm(r3nu1ame  fvta(f 2tmumpoo4tlxnmo3tydfm2um( s;u)tlerxf iotlaDr n i t0truoxmpiudlmtnlfctl(f 2raxront4oet if3tytlm2ua(mp t0tlxnxo iotfa r ueo t  eumim oudamtelnet (farrrxr ot0aetn oetadfs elumonu)alerir oytoaDr n s t)srxmxr3iu4lptnlnesls arrm(ront1oeen i3tls s2eanmo (4areoxr3ia1fp elnesl(0srur(m3io4apenlfvtatfarurum ot1oetomociasla2ea( snt4alxomo3tytomt  i o;(0t2xrxm iydll e fvtlt  2rrumo;o4tex  iciadlm2rlumont) etoxr3tytfmte i s (0t2uoio3oudlptelieiat) rrmxr ot0tptnmoetas a2ulnvp (0trtomr iadfmtr n s;() eurio ny1olt miciltf Dumuro;o4aptomociyd sDrmuvs u) eermo ta1late n s s)srumiopoo1ale lnct ()s2rrxmo;u0tet moctytlaDran o t0alerxr iy1lmtrlu i (0trxo(mpoudll nlictl(f Dumx onu1aexniociyslm ua(vpn() rtrmo3ta1lpDr ueols  rxo(o no4ole livtl() 2tau pnu4alt moetad a2emumo;u0 exoxo3ia1la r uvo t trumxmpoo4ll elnvtl(fsDrruro;t4tpenif3tad s2umn snt0tltrxrciodlptr ues;s s2urxm3iy1olenmnesl(f rtmx o;t1tltoio3iltls2emu on()tlenmf iadlmDrau i;()s2xmxmpnodamt mivi s) Duau  ;t0tpxoifciys m2uln p;u4 lxrircio1om ean sl(  2xoxm oy1llte fcta( a2ur( ono0tex mi3ias aDrm(vp u)teeomfcoo1lmt  i o;s0srto(m nu4ol nlnvtat) rtrxm no1tetnmfeiat aDuanvo (0tlenio3oydfa elnvo (0 etrxrpoydole  ietlt) rrr( pou4tpe mi3tysls2eln s;(0 lermrcty1om elnvols0trxmirpny1amt mivils aDua( pot4tptnmo3tatlaDumuvs (4trxrio3io1op  luvs;s)srtmir3iudome lncias)arrr(rpnu1apeniiciltfsDem(vo t0treoir3iytoaDr uei s)teur(opoudop nlnvtatfa2rru ono1tlxo ieiysfsDul(msn()texnmrcto1om e ivo t0s2toiopiu1lp emivias)aDrm(  ;o0altnioetasfs2rlums;() rxrif ootoaD ln i t0s2urxo io1lpenlfvtat  2truronu1aee  ocias m ra(msn(4tlxrio3tatfaD au o;t0 eum(o3oudlmenmnei sfaDrmur ou0alenmieiat aDrauvsnt4aetrmr3tytop ranvo;t0texoirpny4optnmiviat sDraxmo;o4texo fcilt aDrl(vp;u4trxnxf3ta1optr ivi;t s2xmxo3oy4llte icias) 2urxroou4aexomf3iaslsDul(mp;(0trtrirciodop rln slt teuoio3oo1lleelieiltfsDur(moot1opt mfctls s2el(vo u4tltoif3iatfmtrai sl( srtoiopiy4omtelfvtls a2tau pnu0alenioctlt sDeanvs u0tlxnio ia1lmteau ils)t2urirpnodaptnmfvtatfa2rrxr ot1texn feiasla ua( p (4 rxrir oy1laD  ueils) 2xm(o3iydlm nmfes ()arururoot1aex io3iydfm2ranvp t4 ltnxf3tytom rlueilt)t2xo(m3oy1ll e nvsat)sDtm(mp;u0ope ifciytlm2el( p;()tlenxociydoaDrlu i;() euoim io4op emnct (farumxm ;o1ale ifciad aDem( sn()texrxr3tatlmDr n ol(0 etrim nu1ape  ictas) 2ta(mpnt0optomieiat a elnmpn()aeermo3oodfat au olt)teumirpoodlptemici ( arururp;u0olt ifciadlm2ea( p;(0aexnir ty1lptraneo;(0 2xr(mpiu1lle  fctls artmxm nt1oexnifeiys s2rlu p u)aexniocoa1opDeaivi ()seurxo iudomt  nvsls)srumxr nt0aeeoifciat m2ea( o;t)tlxomoctodlp rluvs s0trtriopio1apt  ics t aruru p;o0tle ifeildfmDul(vonu0altnxrctotlaD  uvo;t  2xrxm io1omt  fvslt) 2um( onu1texo fetls a em(mp u4 ltnmo3oatoa r u sl(0srxm(opny1olt  ivta( arumurpot1teenioetydla2uau o u)teeomf oy1lpteln sls s2xrir io4alen fcs t)a2rrxronu0aeeoifcildla ua(ms;u0 eenxo3todoa   nes;t0srtoxrpiodlm nlnvs ()s2ra( p;t4opt mf3ilt m2emu snu0altnio3oo1lpteanesls0 etrxo3ou4op  lfvsls  rumxm ;o1aexn f3iys a2eau snu0tlermfcoy1laDe n i;t)sruo(opnodol nmfesat)s2umxm nt4oee ii3tls aDul(ms u4tetnir ia1lmD luvi;() rxrio3iy1lltnlfeil(f ruaxm ot0oex  fetad m emnms (0altnxo ty1lp eluvi;(0 etr(opiu4olt lfet t) 2tm(r nt1alx mi3tad m2ulnvonu0aetoxr iytfmtrauvs t0s2umimpio1ll   ict s)aDtrxmono0aetnioctyslaDra(vs;(0teenir3todfmD  n i;(  etrxmpoy4om   ivsa()aDtax pou0oex ifctysfaDeanvonu)aeeoif io1latelnvi;(0 rtoir iy1omen ictls  ruaumoou0tlto f3iydlmDrlnmpnu0artoif iotopD an ols srxm(o nu1lm  lnesat)sDtrurp;o1oex ii3iyt a eaumpnt)tetnmr3iy1lat aivs;s seuoxo3nodam elicsas) 2uru pno4tpt ii3iys s2el(ms t4tlxomo3iy1lmtrauvol(0 eumim3oy1amtnmncsas)s2ua(m ot1aeenio3iad mDel(vsnu) exnxocto1oa rai sl( seumim3oodll nmict ()sDuax  ;o4tlxoioeilsfm2em(vsnt4tetnif io1oa rlu i;s)seuoiopiydam  lici t) 2urum oo0opx ii3tat s rluvpn(4 rtnif3ta1lpte u o;t teto(r oodope licias  Drax  ;t0tlxoifeiysfmDumn snt0aeerxo3tydlmD  n i;s0 2uoxrpoodoltnlnvtlsfsrurumont1aex miciyt a2rl(ms;(0texomf3oy1omteaues;s) 2trim oydope liet sf 2tmxmo;t1oltoioctat m ra( snt) ltoir iatfpt auvi;s0 2xr(o oydomtemfetl( aDra(  no1tpe  ictatfsDumuvo;u0trxoirctytla e n i (0sexr(rpiodoltelics sfsDuax pnt4oetnmoctyd a elnvs u4tlenifcoo1faDraiei;(0sexrxm no4ame  fcsas  Dtr(rp;t0tpt iietytfa2umu o u4teenir3iatfa raivi;(0sexm(o3nu1lmtelnviatfaDtm( pou1olt io3ilslm2eauvo (0 reoio3oytlatrlueil(0t2tmxmpnu1al   fvtl()sDtaxrpno1opx miciydlmDua(mo;u) lermo3oy1fmt lnvs s) rum(o ny1alenmieiltfarum(m no0alt ifetltfmDemn snt)tltrxfcoo1oatr neil(0s2to(o3oo1lme lneia() Drauro;u0tptoifeiytla rluvpnu)aetnif todoatr n ils  2xo(rpoy4alt lnvtls) rtmurono0oleoioetatfs rauvs t) eeomfcoa1la  lnvo t sexrxo oudape lncs () 2uaxroou4aleomiciatfmDelump t)aleoxrctatlmDe nvi;s  rum(m3oy1om  mnviasfs2taurp;t1opxomiciysfa2umu o;t4trxnmf3ia1op  ai o;t0teuoxrpou4op   netat)artru p;t0texn o3ilsls2emnvp;() etomo io1oa eliei ()t2xr(rpio4omtemfvs tf Drr(m ot4oexo o3iltfa2rmnvsn(0 rerio3ootfpD  n s;s)t2urir3oodlmt  iei ( sDua(moot1alen octat sDea( on(4altoio3iydfaD ai s ()trxoxr3iodam elfeslt  Dum(  no4apen o3ildlaDranmo t) renmr iadfp  luvols0 2trirpnydamt mietls srtrx pnt0aexo fciydfsDemu onu)trxnxf3oatoaDrlies;( sruoxopiu4om  mncias) 2tmxr ;t1tetoiieiyt s2emnmo;u0tlxnmo tadfmtr nvilt)seumio3nydol emnetas  Dtmxrpot4texn feiltlm rmums ()trtoxocoy1lmDe ivilt  exoim iy1am n neil(fs2rmur oo4tlx ifciadfaDuaumpn(0trtrmr oy1lpD  u s t truoim3io1ap nmfctl( a2umumono0aet iicias m ulumo u4teenmocia1oatrluvs (0tetm(opiudal  micils s2umx o;t1tpt mi3iysls ulumpn()tetnmf3iotfmDraues s) ruoir ny1omtelieta(fartr( pnu4apxnmicilslm rlu pn(4arermrcta1fmD  nesls)s2toirpiy4om nlici s) rtru o;t0tet iieiyt m emnmpnu0arxnxr iodoa e nes s)trxr(o iu4al nlnei s) Dtm(rpnt4apt  i3tyd m2emnvo t4 lxrio oadfmDelu i;t s2xoxm3ny4omt  nci ()artr( onu4apeomfctys m2em(vs;u0aeeoxo3oadlm  auvo;(0srxmir3nu1lptnlietlsfa2ta(rp;t0tlt  f3tatla emnmpnt)arxnifctodoaDraneols0t2tm(o3oo4ope liesl()arra(r ;t0tlx ifctat s rmuvs;u)areoif oo1fmt an i t)t2urxr iydll nmfctatfsrtmxmoot4olx  feiytlaDrl(mo t)arerioctodom eliesl(0 2uo(opiodlp n fctat)artrum no1alxnmieiydfm umnms (4alermociotfa r uvo () exo(r nudamtnmicta( srra( o;t1alen ieiaslaDrmnvo;t4tleoif oydopDeluei;t0t2uo(m3ny4am e ivtlsfs2ururpno0tlenmociadfm emnvp;(0 rxoxf io1lp   i slt0t2tm(mpiodomtelivtl(fsDraur oo0oltnmiciatlaDrl(mp;()tetrmo3oadfpD livi t0s2trxr3iydolee nesatfsDtmu o;u0oet  iciatfaDul(mp (4 rtoif iotoa eaiei s0 exmio3iu4apeelnvilt)aDur(rpot0alx mo3tasls ea(ms u)arxrmf ta1lmtrlies;t)t2xoio3nudopt lfcs t)s2raum ot0oetnmietaslmDeanvp;u0 rxnmrcoatfm elues;(0 2xoiopnodame liesa( s2uax pou1aexn ocilsls2rlnms t0tlxoifcia1oaD an sl( t2xo(r3ny1ole licils s2rm(m no1oexoio3iasla2ra(msnu4alerif ta1lptranes;( trumxo3nudam n fvia(fs2tmxmpnt1oltniicils a uln onu4tlxnmrcoytfa rlnvol() 2xo(m3oy1lpeemfcta( a2taurpoo0alt  ieias mDumu o (0aexnmf tadfmDrlieo;()truo(mpno1am elivtatfs2trum nt1tex iocildla2rau o;u4 etnxo oa1fa elnes;s)seuoiopoo4ale mietlt) Duaum ou1alxnmf3tyd m uluvo;(4aeenxf iadom rlnei s)t2tr(m oodop e ivs tfs2trxront4apxo iciydfs2rmuvp () renmo to1omt li s (0s2uo(mpoo4op   fes sfartaurono4oeenmf3iydlm umumo () ltnxociotlmtrlivil(0teuoxmpou1ll e neiatf rra(mp;o4aexoioeiatfs ul(mo u0 rtniocoatlm  lu i;s0seurxm iodlleemfcsa(f 2rrx pno4tlx  f3ilslm ul( pnt0aetrmfcoytfaD au s s  2trxm3iy1alt  fcta( aDurumpoo1ope iieilslaDea( p t4artrif3iatopDr n i;s)trum(opou1lltelnct (  2uaxmp;t0olenmoeiyd sDean p;u0tlerxfciodop  lu o;s)t2tmxrpiy1lpenmici s)s2rmump;u4opx  f3iadlaDranvsnu4tleomo oa1latranesls)tetrxopiy1lpt  ivs s)s2urx ono1opeo f3iydfaDelnmp;u0teerxrctytoaDe ivs;t teumir3nudamt livt ()a2rrurono1tlx mo3iasls elumon(4 lxnircoodlpt ln o s  euo(m oy1lmtn nvsa( s2urxm ;t4teen fcilsfmDrlnmo;u0aeermoctodlm rai s t0 eumir oudam nmfvta(f Dum(moot4opx mocildlm2emnms;(0teerio tatfp r nvs;t sruo(o iudomenlicia(fs2trx  no4oeenifciyslaDel(mpn()alxrifcoo1oaD aneo;t)srxr(m3nydlle lnvsls)a2ua( o;o1tltoif3iltlmDraumsnt0arxoif3oadomD  iei t0srxmio ou1ap n fciat a2rruro;o1alxnif3taslmDemuvs;t0trxnmf ty1opDrauvil(0trxoir ou4am e netas) 2rrx ooo0oeto o3ilt a2ra(mo;u4 lermo3iy1lpD lueo;t tetrim oy4optnmfcil()artr(mono0apxnmi3iadlm ua(vp;t0treomr3iydlpDelieol(0t2ur(r3ou1om emnet (f 2urxr ot0oleniieild aDul(vs u0tlxnmf3iadfatrlu o;t srxr(r iy1lmeelfvta( arraurooo4tex mfctytfm2ua(vs u) ltoxrcoydfmDrliesls)t2xrxm iu4ol  lnetl()srtrum oo0tpx mi3iysfs2um(vo u0tlermo3todop   nei;(0t2xoio iu4omenlfvt (  rta(rp;u4tlxomi3tldlaDrmn s;() exomfctydlpDraiei ()setrimpiudope liei (f Durxrpou4oleo ictad aDrmnms;t4 ltoirctytlp  aiei t texoim ou4omtn iei s s2taumooo1alx  i3tls a2um(vsnu4tleriociadla eli s s)srtoxr iydlptnlfvsat  rta( ooo0aexomo3tad a2ean s;u0 exrxo ta1oaD ln o;t s2tr(rpny1altemfvsas aruru  nt0aetnmfciydfsDra( s;u)tlerirctytfp eluvs s srtmxm nu4op elicslt arrm(r nu0opxomo3iytfa2umnvp;u0 rxnmo3todfpt ai s t) 2xoxmpoo4lptelfes sfsrururpou4tpxomfcias s2ulu ont0alerxf3iotoateaiei t teuoirpnydolt  fctlt) 2urump;t4tpxnif3tas m2rmn s () lerxrctatfa  lueo s0sruoxr oudol  mnet s s2rmurpno0apeoifciad mDrmn pnt0 ltrio tatfm e n ilt sexr(opiy4am e ieils) 2tr(m nu0tpenif3iatls2rmums t)tlenifctydfmD au i s)trxo(m3ou1ap  mnvtlsfs2rm(m nt0optnmfcils s el(vo u0arermr iy1lmDr u i;t) 2tm(mpiu1lltemicslsfs2raurpou0texo ictltfs um( s u4 lerxo3iotlaD lnei ()s2uo(r io4omt mivil()s2uax  ot0optoifciadls rluvs;(0tlenxo3tytfmtran i;t) 2um(r oudap elfeslt)artmx p;t1opx  i3ilt a ul(ms;u4arerxr todlp  auvi;s srxmirpnu1ap n icsls)s2taxmo;t1opxo ociytls umnvs (4 leomf3oy1lmtelueo ( s2tr(mpiydol elfct sfarrrxr oo4ole mfeiadfsDeluvon(4aeenio3tadfmt lnes;t teumxmpnu1lltn nci t a2ur( pot4tlxo oeiaslmDeanms t0arxrmo3oatlpDranvi;(  euoimpny1lmenmnciasfaruru pnu1teen ictyt a umu p u)texrio tytomt  u ils s2uoxo ny1ap nmncsa(  Drmx  ot4apxomfetltlm2eauvo u)aeerio todoate nei s)t2xr(r oo4amtelneil()s2tru ont1teeoio3iatfm um(vo u0 lenif3oa1op  auvi (0seumxm nu4lm emivs sfsDrru pnu1altoii3ildfm raums u0trerir ta1omtrlnei t0setoxr3io4lp elivt sfs2rmxrp;t1teeomiciyslmDrlnmo;u4 rerxf tydom eaueo ( s2um(o iudale  ics t)sDraumo;o0oeenmocils m2ul(mo t0aleniociy1fmDe ieil( t2umxmpoy1om emnes () rtm(m nu1aexn o3tytfa2uauvp;t0treniocoatop e i i;(0sexr(opoudap emncsatfarrrx o;t1tleo f3ils sDea(vo;u)alxoir3oy1oa eaivo;s  2xrxr3oy4al e fvt s)aDtax ont4olt iictlsfsDrmnmp;()alerir3iytlateaiesls seurxm3iu4ol  lfvt s) Dtrx p;t1apx ioctatfa eluvp;u0alxomfctodlat  uvo;t s2xrxrpnu1lp elivil()arrax ono4tex  ocild aDul(vo;t)trtnir3ty1laDean sls trxoxopoydamt micsa() rra(mo;u0aeenioeiatfa2em(mont0tetnmo3todlmt aueol(0 etriopnydllee fcsls)srurx o;t1oetnmicilsfm rmnvpnu4tlxnmr ty1omteln slt t2xmxr3iy1am  lfctlsfaruax  ou0tetnif3tatlm uln snt0areoxocto1lpteai s t setrxm ny4om  mnvt tfa2um( p;t1oetn octld a umnvp;u4tlxomocoydlp e i i s0srxmxr3nu4oltelfvias aDtmu pno0tpt mo3tls m2umnmp;t0areoifciy1opDe nvsl( s2ur(o3nu4ameelfesa(fa2raxr ;u0optn fcias aDrmumpnt4 exnio tytfpDe neo;t srumxrpiudam nlnci t  rraurooo1tptoif3ild a2ua(mp t0tlxnxo ta1fmtelu ils trxr(opiydolte ici tf 2uaxmo;o4oexn oetlt sDeau o (0aeerifciodfmte neilt t2tmxm oydoptemncil(f Dtr(r nu1olt mo3iys sDelnmpnt)tetrxrciydfpDr neil(  rxm(m3io4optemieiat  Dtruroou0alt iociyd a2umn p (4arxnio io1fm rluvi t0 rxoim oy1amtnlieia(fs2tm(mpno1texnifctatfa elu p (0aetomocoatlmte i sls0setrir3iy1omtemici t) Duaxmont1opeo ociat sDranmo;(4trxnmo3to1la eli i;(  rtmirpoo1open iesas arumum ot4olxn o3iaslm2uan s (0trtnir3oatoaD auei (0 rxmxm io1al nlnetl() rua(r no4oleo ieilsfsDelnmo t4teerxo iy1fp rai o;s seuoxm no1al  licil(faDtr( o;t1aex  ociltla ua(mp (0aetnmf3io1faDr ivi t  rurim iy1ome miviltf rtmump;u4apt mi3iaslsDumu sn(0tlxnirctotfaDrau olt)s2tr(mpiy1al elfvt sfsrrmxmono0ole mf3tadlm2emuvsnu4artoir ootoaD  iesl( teurxm3io1altnlicslsfarrrxmp;u4teen oetltlmDua(vo;t4trerxf iydopte ivs t)trtrio oy4lm nlfcs t) rum(m no4oexnmo3iys m ran p ()altoifcootfmtran o s)t2xmir oy1lptn ncta( aDumur ou1aexoiociysfaDra( ont)arxnxrcootop eai s;t) euoio3iy1altemnei (fsDuaxm nu4aexnif3iatfmDranvs u) ltnmf tatlm e nvs t) rxrim no4olte nvi ( s2taxm oo4aeen o3ilslm uauvs t0 etomrcia1faDelivs;s sexr(m3iodomenlivilt) Dtmxm no1olx ifciatla2rluvs t0 rtoir3ty1oa  li olt0 eurir3no1lp   nvilsfarurxm oo0texnmoeiys mDua( p (4aexnmo oytop rlnes;s t2tr(o oydalenlivs t  rua(mp;t0altomieiytfa rmnmo;(4tlxoir tatoa rlnvi t)srxo(o no4omt miviat)sDraurpnt4aeenmfetytls uanvsn(0altnmf ia1fatr nei;s)s2tmxopiu4ol emnvs (f 2tmxmooo4oltomfeilt aDeanms t)altrxo3ia1opDeaivo;s)s2xmir3iodoleelfvslsfs2uaumo;o4olxn oetatlm2elu o t4tetnir oy1oa  lnvi t0trtr(m no1apenmfeilt)sDur(mpoo4oleo oeiys m2um(von(0 ltnio3oydomD aues t0trto(m3oydll   ict (faDra(m ot4apen o3iatls ua(mpn(0alxomrcty1op eanvolt srxr(mpny4op  lnvta(fs2rrur nt0olen i3ils m elnvp u4 eenif3oytfmDrauvs;s0texrxmpno1omtemfcil( s2rrxm ;u0apt  ictlsla2emnmpn(0 lxnmrcio1fm rlueo t s2xm(m3iudlle licsl()srtaxmpnu4olxoifeiaslaDulump;(0 ltnio to1fpD anei;t0sexrim3oodam  mfes s  2raxrpnt0opxo fetat aDea(mont4 reoxo3oa1laD  iei ( t2xoxr3iu1al  mneilt  Dtr(r ou4tpeoif3iltfmDem(mp;u4tltrmocoytfmDr ieil(  rxrxm3iy4ll  mictlt)srtaumono1ale  o3iyd sDeau sn(0 eerio3iytoptelneo t0 2tmim ou1ameelivia( srrmu ont0opt ioctltfm el(vpn(4arenxociotfpDeaivs;s  eto(o3ny1aleemivtl(faruau o;o1apxnmf3tydla2ulu pnt) ltrmf iy1opDe ieolt0sexmxo ou1llt lnvtasfarrmxmonu0ape if3ilt s2eanvp u0 exoxfcootlptrlneo;s)t2urir3iodlmeemfctl(  Drrx ont4oeenmi3iadfm2uanmpnt)trtoxocoytlmt lneo t)t2xr(r3iydome  fcsltfa2rr(  ;t0aet ifctat a um( s;(4aleoxrcoo1omtraieol(0 2ur(o3nu1aleelnvilt  rtm(mpnt4optoiieildfmDemnms t0 etnio3oadoa  lnvil()srxmim3iy4om e fei () rta(r no4altnmfctyslm eanvo;(4 etrio to1la  lu o;( s2uo(r3io4lpen fvs t)a2tr(rpnt0tlxomf3tatfmDrauvs;(0 etrxf ootla   iei;t)texmirpou4lm   nvs t  Dtaump;o0tpen fciyt sDrmuvon(4aeeoxrcty1oa rlies;t0 exrirpnodoptn fvslt aDraurp;t1tpxnifeiyt s rl(mo;t) etoxo ia1fmtran i ( srxo(r io4ole mncslsf 2ta(m ;u0tlenmf3iad s2elums t)texnxrciatomtrln ilt0sruoimpny4lpt mies (  rurxm ;t1apt ioeias m2umnmp;t0aexrif3tatopteau s;(0seuoim3io4olen neiat aDrm(m nu4apxnifeilslm2rauvs;(4alermrctydom r uvo;() 2umxrpiudame micsl(  2uru oot0tet ifeiltlm rl(vo;u)trtrxo ty1optrlu sls)tetoxrpiy4ale  nei ()artmxro;u4aleoioeiydlm rm( pnu0 etnmfciotlat ai s t)setrim3iudlm emfvilt) 2ra(mo;o1apenmoetaslsDrmu pn(0 exnxr3ty1fmt  n olt0setmio iu1am e fcils) Dtrx  ;t0ale  o3ilt aDemnvo (0trxomo3ta1faD aneslt)trur(r3io1lptnmfciat aDtmu p;o0tpt ifciydlsDua( p t0teermo tadoa   i o (  rtmirpiydolenmnvtat srum(m ;t4oeenmi3iltla uan p;() rerir ia1fa e ivo;(  exrxr ny4ol e ict s)a2ra(mp;u4oetn feiysfsDelumpnt4teerxo totla rlivo;( setrxm oydamtn icsls)a2taxmp;t1oleo f3iltfa2ulu p t0 lenif iydfat livi;t) etr(r oy1lpe mfesls s2rmumpnu4teen o3iatls elu s;u0altoircoytlpte uvils0s2xriopio1lme  ivsa( artrx pnt1oeenmfetasfs em(vo;t)aeenxr oy1op rli o;t)t2toio3ny4amt lfct s) Drmuro;u0openioeiad a em(mp (0arxoif to1lmtrliesls tetm(o3ou1lmte netlt  2urx p;o4tptn i3tad m2emu pnt0tlxnio3iydop ean i s  rtm(m3iydol n nciat  2umxmoou4tpe  oeiatfm umnvs (0teermf3ty1fate nvi s0t2um(r3nydol e ieiat arurx  ;t0tptomfeiadfmDelu s;(4 etomr3iotfaDranvslt srtoio oo4ll nmietatfarua(rpno1oeeo fctyt m2eanvp (4tlermr3io1la  li sls0 2xr(opoudomenlfvsat)aruaum no4olxomo3tyt mDrluvpnu)arxomo3oadfp ran o () 2xrim3ou1omenmicias) Dum(r ;u0aptomo3ilslm ranvo;t) rerircoy1fp  lnei;t0 2umxm3no1lmeelfes ( artr(mpot0aeeoii3iys aDrluvsnu4 rtnmo oodlp r ieils tetrxr3nydopte fcsat)a2rrxmpnu1alto fctltls em( p t0arxnifcty1lmtr n ol( teur(m3ou4lptnmnctlt)a2uau  oo1aet  ociys mDem( p t0tlenio3iadlat  i s;()t2urxr iu4ameemfcslt)s2taxmoot0opxoifctatlaDeauvont)artnif3oa1oat liei s  eurir3iu4ap   ivt s  Drm(r oo1apeo i3tlsfs2rmnmsn(0 reoif iytfmt auei;t  2xrxr3iudlm   fctas)s2umxm ou0oeeo octyt m2ra( o (0tetnxf tatfaDrlies;s0s2toir3ou4amt lfvs tfartrxm ou4altnmo3tydlmDrlnvp;u4tltrxr iodfmtelu sls0t2um(opiy4ap emiesls) Drmumo;o1olto f3ildla ranmpn()tlxrif ty1fp   i s;s) rtoxo nudaptnmiei ()a2umu ont0tlt mi3iltfaDuanvsn(4 exoxfcoo1fptelnvil(0 2umir ou4lptnlnctas)a2umum ;t4ape if3ild a rmuvsnt4alenxo iodfpDe ivsls trtm(opno1ol emnei t s2umxrp;u4tpenmi3iyd a elnmsn(4 rxomo3iodoatr neo;s s2xm(o iu1omee fvsl() Drrxmonu0apxnmoetaslsDea(vs u0 leomo oydopt lieo s0teuo(opiudape lfctas)a2tm(m nu4alx  oeilsls2eanvsn()aexomr3tadfaDelnesls0 2umxmpiu1lm e neils aDua(  nu0tpxnmoeiytlm2em(vs;t4arenxo tadomt  nvo;t  rxrimpoydlmt lnei ()sDuaumoot4apx io3tytfmDuanmo;t4areoxo3oytlp e nvslt0 rtr(opnu1ll   fci (fa2rrxmo;t4tpenmieiyd a ua(vo;t4altoxo tatla eauvo (0 ruoxopny4om nlfci sf rrru  ;t0opeo ietltlsDrauvo u4tltriocto1fpDrau o t0 2umim iu4am  mfct s aruru  ;o4alx  ietysfs rl( s;t0aexrir todfptr ies;t0srum(mpoy4lp emfcia( a2umx o;o1texomi3tlsla2umn p ()arxnircoa1oa eluvo s) 2xoim3iu1oltnmfvtat)sDur( ont0olxoiociydfm2el(vo;t4tltrmr oodfmDe u i;s) 2xoiopoy4alt lnvils srurxmp;t4opxniieiadlsDrau p;u)texomf3totla  aiesl(0texo(opnu4lpenmfvsas arta(r ou1altn iciaslmDemnvsnt4 ltoxr3tytoate ivs t0sexrxo ou1apenlfetas srtmx pno4olxo ocilsls rm( p;(4tetrmo3oatfmtelnvilt setmimpoodlmeemivi t)s2rr(  no0tlx miciytfm uluvonu0aetnif iodom elivo;(0 eum(o3nu1ole  fci ( srtm(rono4openifcilsls2emumpn(0areomo3oo1op elneils0sexriopou1aptnmfvia()a2um( o;u4apeniociyd a2rln p;u)aexnir3io1fptrln s;() exo(r nydll nmfeia()aDrr(r ;t0tpxo fctltfm2uau o;(0 lxnxo oo1optrlnei;s) rtrxr3iy1omtemnviatfarua(rono0ape  o3tadfaDrl(vs;t)trerxociotfpD  u s s0 rtm(rpiudap  mivtlsf rrrx oou4tleo fctas aDuau p;t4altrmo oodoatelies;t) 2tm(rpnu1omee fes ( a2tmum nu1tpe  f3iasfs2elu onu4 renxr3io1fm  auvs s) etrimpio4ope lneslt)srrm( oot1olx mf3iydls ranvp;t)teenir tatoatrlneo;t t2xrim iodlmtnmfei tfsDtm(rpot4oleomo3iyd aDuauvp;u0aetomr ia1lm   neolt0s2tmxm3no4lleemnes ( aDrr(rpou1oee iiciyd m2rmuvp;u)altnmrcootoaDe ues s0 2uoxo oo4optnlfetl( aDurxmoou4tpeo oeiys a2eln s;u0aetrmo oy1lpD  neils  rxm(r oydlme  icta()s2ua(moot0oltnif3iys m rm(mp t4 ltomocoy1la  lu olt)tetrir oo4omeemnviatfa2tru ono4alx  ieiltfsDeln s (0texoir to1om rau sls trxo(o ny4ameelfcsa() Dur(mp;o4oetoifetlslm eanvsnt0trtoif3iy1lm eauei;t srxrim no4llee ivtatf 2tmx onu0tpxn feilslsDulu o;t) exrio iotoat aivo;s tetmxo io4om elfvs t)aDtmum ;u0aexomicilslm ul( s;(4alxnio3iadlp eauvi () 2xm(m3nydoltnlnvi ()s2ur(  oo0oetn fetasfsDelu s;t4 rxomo3io1fm eaivs;s)trum(o nydal nlncs t  rrr(  nu4opt if3tat s2eau onu)treoxf3iytoaDrli o s) rtmxm iydomee fci tfsDrmxmpnt4texn ociat a2elnvpnt0aeeriociatfatr iei;t) etoim iy4lptelivtas s2tm(moot4opeomoetytfm2uan p t)trtnxf3to1oaDrln sl() 2toir3io1olenmnviat sDtaxmoou1ope io3tyt m2emu ont0tetrxfciadlaDraues t) 2uo(o3nudlm emfeta()srrauront0tpe  oeiasfaDean o (4 reomo tytla rai o t0 2to(o iodop n nct sf Dtmxmpno0texnmfeils s rl(vs u)aetnxr3ty1oat lieol(  2umiopiodape  iesl()aruaxmo;u1aexoif3iatlsDua(vs;t0areoio ia1fmt anei;s0teurio nu1lp e neils  rtr(m ;o0tleoii3tydlm elnvsn()alenxfctydoat  i s ( t2tm(rpnu4al  mivia()aruau  nt4tlt miciydfa2emn s t0trtomo totom rln ol( texriopoodol e fvsa()sDur(mp;o1aeto i3iad s elnvs;u) rxomo3oy1oa elieo;s  exoiopio1openmiet s a2ua(m nu0tlenmfeiasla2uluvs;t4artnmfciytfmDrlivilt tetmirpio4lpte fvsls a2rr( ono4tleo i3tltfm eln s;(4texrxfcio1oaD  neo t s2trxopny1omtnlfct sfarraxmpou4aee  iciysla2rau s;t0alxoifcoo1late ieilt)s2xo(r iudap   ivs t  rrmurpnu4tptn f3iydlaDeln o u4tltrir3iadfm elnei;t  rumxm nu1oltn neiltfaDuaum nt4opx  icildfa2eanmpn(0aexnio io1omDe uvo t  eumxr3oo1olt  nctlt a2rau p;u1ole  fctytfs ea(mpn() ltoxo3oa1la  auvilt0setriopnodoptn nesl( srtr(mo;u1tlxomfeiat a2umuvo t)trerifcio1opte ues s)srxoxo3ny4omtnlfvs t srtax p;o0teto f3iytfsDem(ms;t4aeerxoctytoa ran i s srum(r3io1lmt lnvtl( artr(mpou4ope mf3ild mDra( s;t4 lerxo iodfp r nvslt) rtoxrpoudam emfeia(  rtmum ot4ale iieiysls2rl( p (4altnxrciodla r ivsl() etrxo oudll   ivtas)srtmx pno0tpxoii3iydfm raumsn(0 lxoxfcio1lm rlivo s setrxm3nu1lme  ici (f Drm(r ou1alxnifeiaslm2eau sn(4tetnio3oydoaDelu i t)trxoir3iu1am e fetat)a2ur(mooo4oeeomiciatfsDulums;(4aetnxf3io1la elivi s0 2um(o iy4llteliviasf Dta( p;t1aptoioetld m uln o u0arenxocio1fa raivo s0trumxmpny1ll eliesls arrmuro;u0aeenmf3iat sDul( pnu) etoxo3tadfmD lies s) rxrxrpoudoltemfcsat aruaxmpot1opx io3iasfmDemu p t4 ltnxf iytlmDr uesl(0 exm(m nydap  lnes s)srtmxrpot4opt mfeiydlm rauvpnt4aeerxr3oodfmDraieils0tetoiopiu1omen ics (  2umx  ou0aex iieiydlaDeau o;(0treoio3iy1lpteauvi;s)texrxmpiy4altemncias) 2urumpoo0aex iietaslsDrau on(0 reoiocoytfatrlneslt)srurim3iy4lpen fvsltfsrrruront4teto feiltfa eauvsnt)texnmo3oy1lpteaivs t) rxrxr3oo1op nmici s  2trurpno0tex moeildfmDrl( snu0tltrxo tytlmD  uvilt  eurxr3ou1al emivsa(fsDuaxrpou4opt ioetaslm ul(mo ()tlxnxr3ootlmt  n sl() 2toir3oy4olen nvtls srtmxront1apt  ietlsfa rlumsn(0arenxr3iodoa elivols)setoxo3iu1amtnlivtltf 2umum ;t0aetoioeiat s rmump ()arxrxr ta1fa eauei;() rurio iydopenmfvtlt) rrrum nt1tltnifciyt m uanvp (4 eeoif oydomD ai o (0s2uoxr nudomenlnciat)s2um( onu0tpt ifctlsfaDua(vp (4 rxrio3oydop eaues;t)t2uo(r3nu1llenmnetl( sDta(ronu4olt  ociytfs2uauvp;(0 ltnmrciotfaD lu ol(0t2toxo nydal emfvtl( srtaur oo0opto fciatfa rmnvpn(0aexnmocootfaDraivi s  rtr(mpno4altnmfvtlt s2rm( pno0olt mfciyt s ul(mp;u4aetoxfciy1lmtrai ils0srur(r3nydame  nesltfsrtr(  ;t1oetoioctys m emn on(4altoxfcoa1fptrlneo;t0s2trxr io4al nlivtlsfarurxmono4tleo ieiydfa ea(mpnu0teerxr tatfpt anvs;s)trum(o nudllt mncsat sDumx poo4tlxnmfctlsfsDumuvpnt0 leriociatom rlueil( trxr(m no4op   feils  2rr(m ;u1oexniieiyt sDra(vpnt0 rtnmf3tytfmt ln ilt teurio3nudopeelnesa(fsDra(ro;o0olx  oeiydfa eluvs (4aleoifcoadlpt  nes;t0seur(o3iudlp  mfvtasfs2truronu1tet mo3iat s emu s (4 rxnmo ootomDrauvs t seto(r3nodalt  nci (fs2taxr nu0tle mociytfm eau o;()teenir iytlmtrluvi;s0t2xoim ou4amtemnvt sfaDtaxmp;o4oee ifetasls2ulu p;t0alxnio tytlm  lnvols0teurxm3ny4altnlfcias)a2rmx  ;o0tpe io3tytfaDum( s u)tlenxrctatlate ivilt)s2xoxm3oudape lneta() rua(  ot4aetn i3ilt m2eanmpn()arenio todfa rauvo s)texr(m3iu4llte ictls)a2rr(rpnt1tlto ieils s eanmo t0 eenio3oy1lmDr i i t setm(rpoo1alte ici (  Dum(r ou4oexoiietlsfs ea( o;(0 rtnmocta1op rliei t trxrxo3nydlltelnvt t a2ra(rpnu0oex ifctydlmDua(vsnt4 exrir3iydlateaues;t0sexmir iy4olt  fci () ruru o;u4tleo fciysfmDrlu s u0tltnif3tatfmt anvi;(0s2uo(o iudom   fvtl( sDraurpou1oetoii3tas sDrmnvs;(4tlenir3oa1lmDr u o;t sexrxm nu4omtemneia(farum(m nt4tet moetltfsDua(vo;t4tetoio3iadomte ivsl(0t2xr(o oy1om nmieils)s2ur(ro;u1tle  octytlaDrm( s;t0teenxfciotfm elnvs s texrim iudal   ieslt sDta(mooo1oltn icildla2emu o t)arenxo3oo1lptelues;s0t2trio3ou1ale  ictatfsDumur ;o1tlenio3iasfsDua(mp;t)trxomf3tytfpt ln slt)t2umxo oy1alenmnvt s) Drrurono1aptomo3tldls2rmnvp t0artoxo tatla  luvolt)t2xm(o3io4om  mnetls s2tr(  no4tpx mo3iatfm2emnvont4tltnxfcoo1fp   i s s)srxrxmpoy1lptelics t) 2rm(mpoo4tpxo f3tysfm2rmump ()tlenmf oo1lpDe u i;s0setoim3no1ale livtat srraum oo4tpxo icilsls eauvsnu0tlenir3oatlpDr iei s)tetmxr3io1op e nvsltfs2rmx p;o1opxo iciydfm2umnmonu4aexriocta1opD lues;() rxrio3oydap elfcs (  rtr(rpoo1tpeoiociyt s uau s u0 ltomrctadlmt au slt0srtoxopno4olte ieias)srrrxmpnt0alt ifctasfm2emu on(0 ltomo3tadomD ln i;() 2tr(m ny1ape lfesls srta( ooo4oexn fctldfm um( o;t4 rerif3ootfpDrlnvo ( s2toiopno4ale  ivi t  Dtaumo;o1oleo i3iytfs2umnvsnu4tetnifcoydfatrlnei t)sexm(o nodlptelfvias sDumxmo;t1tpxo ociasfaDeln s t0aexnxr3oo1op   uvilt setrir3iodlme mivta(fs2umurpoo0apeoif3ildla ea(vpnu)trxrxf iydfa elivi s)trxmim3nydlmtn ieilt s2tmu  nt1opx  o3tadfa2ra(mp;t4 renmr3totfm   u il( s2umim iy4ol  mnesa(fs2uau  no0altn octatfa raums;t) exomo3iy1omDean o;t0 rxo(r3io4olen nvil(fs2trxr no4tpeo feiadfmDrlums;(4tetrmf3iytfa  anvs (0t2umxmpio1omenlfci sfsDrrx oot0aexo i3ildlmDul( o;t) rermoctadlmt  n s t)srurir3iu4ome micslt)arrauroou0aexnmoetad m2rm(msnt0trxoir3iodlate uvsls)srtr(m nu4amtemnciltfaDrm(  nu0aexn i3tltfsDel(mont4artrif3oatlaDe ivi ( srxmxrpnodaltemivi (fs2ua(rpot1tex  fctls m2umn s;u4 ltoio iytfptrlivo;()texoxo iydop elnesatfsDtaxrpno1oeto o3tldfm ranmo u0trtnxo tytfaDrlivo;() rum(o3io1lp emicsasfaDtmxmoou1aetnmieiadla2rmnmp t0 eerxo3iytlmt aiei s0 2xoir ou4lm   ietat srtr(mp;o0ape  octydls2um(vp;t4aexrxf iotfm  auvi;s)teum(o3oydapee iet tfa2raxmoou0apeo ieiysfs2eaumo;t)tlenmr3iy1omDraivi t) 2tmxopou4ol elnetas) rtm(  ot1oltn fciydlm2ra(ms;()aexoir3oodfatrau sl()trxr(rpny1ame lfct () Dua( poo1opto i3iad a ua(vsn()treomrciy1oa rlieols0 2trxr3iodll   ivtl() Draumo;u0tpeoioeiyd a2ea( pn(4artoio oatlaDrai i;t)texoxm3io1lltemivsa()s2rm(  ;u0tle  i3iltfa2rluvp (0 rtoifcoatfpDe uvs (0 2tmxo3io1altemivs () Dum(rono0aet mi3ilt m rauvo;u)aexnio3iytlmDr ueo t)sexrio3oydlmenlivsat) 2rmu  ;u1oleo f3iadfm eln ont4aeenxo3oy1late ivil( texrxr3no4al nmicilt) Dra(  nu0olx moetytla2umn p (4tlxrxfcta1fm eai i;()srto(m iodll nlfvtltf 2taur ;u4aptnii3iysls2emn s;u) rtrxo oa1oaDrlneolt)t2xoxmpno1lptnmfvtlt) rtrumont1optnioetld aDua( o;()arxnmocia1fptr uei (  rtmxrpoo4lmte fctat  rtmxrp;u0texnmi3tlslmDrmu p u0 ltrmr3oatopDe ivi;t)sexrim nydolteliesls aDrr(ront4olxnio3iydfm uau snu0aleoifciytfmtranvi () rxrir iodap elfei s a2ururpnu4alenmieilsfm em(vsn(0 rxrxr3totom eli i s  rumio3oo4aleelivslt) 2tauro;u1tlxomfeiyslaDeauvp;(4texnir iotlm   n sl()t2xrim oudalenlfesls)srrr(m nu4altnmi3ias a em( on(0 exomr oodlmt  uvo;s)s2xr(o iydlp nlivs ()aDrax  ;u4aexnioetyd s raump (4 lerir oa1fmtraieslt)s2toir ou4ope  fctat) Dtaum nu1teen fctld a ulu s u0trxnif tytlp  au s s0srtoxr3oo1lpe  ieil()aDrmxr nu1apxomoetls sDeluvo () rerif oa1fpDraueo;s sexmirpiydole micsls) rtmum no1apto i3ild sDem(mo () rxomoctadla ranvi s  2xrim3no1om nmnes s)aDrmxr ;t0tpeomfctltfs rln p;u0 eenxf ty1om   ivo s0t2tmimpno1op emfet ()aruaum oo0apx mfeiaslm uanvpn(4trtnxf ta1om  lnvolt0 rtmimpoydlpt  ivsat)s2uaumpou0tpxnmf3ild a eauvonu4teeniocoadfmtr i o s teuoxopnodamte nei s) Dumxrp;o0optn ietydlm2rm(vs t) etnmfcoodfp eauvo;( t2umxrpoy1lle mivslt sDtr( ooo1ape  o3ildfsDum( p;u0alerxocoydfm  li s s t2triopou1lpe mneil(f 2tmxm no4texomo3iytfmDeauvs;() lxnir3oa1fmt aieil() 2tr(o oo1lltn fct s  2um(  ;u0aleo f3tatfaDrln o (0trxoir oatlm rli i;( setoxopno1lp elnesl() 2uaumo;t4tlxnii3tat s ea( s t)areoir3ia1omDeau i s)t2tmxm3oo1amtn ietl( sDtr(mpnu0altoioetydla2ulumonu) etnxo3oatoa   nvols)trum(r3io1optnliesa(f 2ururoou4texn feias m rlnmp;u4 leoifctatfptr ivilt)t2trxrpiu4amt  ncil(fa2ra( pnu1texomi3iltlm rauvo t0arxnmrcoy1fa  luvs;() 2toxr nodlleelnctas)arrau pot0texniieiatfm emu o (4 lerxfcoadlaDeanes;t s2toim no4lptn nesa() rtaxrpou1tee iiciytls2umuvpnu0 ltnifciotoaDr ues;(0tetrirpoudal  lneia( srtaurpoo0apenio3iyslm ua( pnu0tlxomf iy1latrau ols t2trxo3io4lp   fet t  rtaxm nu4opeo fctadfmDumuvs t4aeenxf to1oa elueils)srxm(r3oydlpe livt sfaDtm( o;o1opx ii3iytfs uan s t4treoiociodfmDranvi () euo(rpoodaltnlfesas)s2rr( o;u1aetnmoctydlm2uanvs;()trxnxf oodoaDeai o (  2xoim3oudope  fet t) 2tr( pot4alenmoeild a ua(vs u0tlxoxr iydomDe uvil() rum(mpou4alte net t  Dururoot0aeenioctlsfsDum(vp;(0 ltnmo ia1la rau s () euo(o io1lmt lncil() rtr( ono1olxoii3ilsfm2rlnmonu)alenxrciotfpt  nvil(  ruoim ny4oltemicta(f 2urx o;u1openmi3tad sDrln pnu0tetoxr oydlmD  nei (0texr(r3io4lmtnmieiltf Drmurpno4olenmf3ils mDulnvp (4tetnmocoytoaD lneo;t)s2tmxo iydopee fet (  rrmu ono4tptnio3ils m rl(von()teeoxfctodfp eluei;t) 2ur(rpiodlleemfcsat)sDrr(mo;u1opx iieiyd s umn o;u0 lxrxrcoytlmD  neils0 2tmiopiydapenlnctls  2urur ;t0tpeoifcildfmDrmnvp u4 rtrir ta1lmDeau o;()setr(m3ny4om  mivi s) 2tr(  nt0oexnifetlsls ra( s () rxrmr3ty1lpt  i ilt)t2umim3oo4llte ics t aDrru pot0apeomfcilsfa ulnvp t0 lxnxo iatlpt  ivo s) 2xmim3nu4apee ncia(  Dua(rp;t0apx mietytls2um(vp;u0alerir oatlatr nvi (0texmxr3oydomtemfvsltfsrrmxm ot0olxomfciydfa ul(vs ()tlerxf iydfa  aneolt sexoxo oo1lmenlnvilt arumumont1apxo i3tat mDem(vont) ltrmrctodlm  luvo t) 2um(rpnu4apenlies tfsrurxm ;u1alen ociysfs2em(ms () eeoxr oadfmtraneo t0s2toxr3nodamtnlfct s arrax  ;o0alxniietasfs em( ont) etnxf oa1faD  nvol() 2xr(mpnu4ap elivtls aDrr(  oo0tpt mi3tytla elu p;u4trxriocoadfpte n ol(0texm(rpoudom  lfcilt)a2rm(ronu1oexomf3tysla2raumsn() exnxr3oydopDr ivolt srxr(o3oudlpe liesl(  2trum ot0oleomf3iydla2umuvp;t4tlerxo3totfat  u s s0setrxmpiy1olt mies t)a2ta( ont0tlenmoeiasls2ulnvpnt0 etoif ty1laDean i (  2ur(o3no4al n feslt)s2tru onu1apxn i3tydlmDel( o t) ltrircto1opDrlivi s) euoxrpnudape mivi s)sDrm(  oo4opx mieiltlmDeanvo;u0aetnmocootoaDr ivs;(0trur(o nydaptnmicias) Dtau oou4tetnii3iyslsDel( s t4 renxf oatlm  au o t setm(opnydlme mfvt s)artmu oou0aee miciaslsDrlnmonu4areomf3oydlp rlnvo;s) 2to(r ny1olt mfvtl(  Dtm(  ot0opt  f3tldls2emn s;u)tetomr ootfptrlivs;s) 2xmxopoy4ale  nci tfsDumxmpnu0texoif3tatfa elnvonu)teermo3iytlp  lu il(0seumim iy1lpt  fctatfarrrur ;o4alxomfeias s2rmnvo;t4aleoifcia1opDelnesls0s2xrxo ou4ap n ict (f Dtmx p;t4aetniieiadfs2emn p t) eenxf tadla raivslt0srxo(m3iu1apeemnvtas  Drm(rpno0apenmicildfs2rluvp u0 rerif tydlmtelnvs;s)s2tr(o3iudop e icsls)sDtmxrooo1oetnmicildfaDumn o (4tle
\ No newline at end of file
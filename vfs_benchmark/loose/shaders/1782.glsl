@@ -0,0 +1 @@
+ieol() eumimpio1am   ncs tfsDraxmp;u1apeo ietytlaDulu o;u) lenmrctadomtr u ol()srxr(m oy4ll nmnctltf Dtau ono4olt ifetasfs2raumpnu) lxoxr3oodlmtr i o t t2xoxm io4opte nvt sfaDtaxr ;o0aetniociaslsDemnvon(0 leoxf todlp elivi;s texrio iu4amte nvils) Drrx onu0apxnioeiltls2uanvpnt0alerirciotfmDeaivo;t  euo(mpoudape mnesas)aDrrxmo;u0oltnmi3iatla ran o (0arxrxoctydlm   uvsl( s2toxr no4lp elfvslt s2urxrpnt4apx ifciatfaDrmumo;(4trtrmf3iy1lat  nes s sexmio iudlme lfcsl(fa2taxr nu4texnio3tas a2umnvp t0tltrmf todomDe ivo;s) rtmxopnodlmeemfesat) Duru  ou4oet  i3tas m2elnmo;t0 ltnif oydfp rluvs ( t2uoir iu4amte ictat)aDumuroou4aet if3iltlaDranvs u0teermf io1lp rlu i s s2uo(rpnu4apeemfvtlsf Draxmpnt0aleniocilt a ea(vo t) ltriociydfmt  neo;t)t2trxm oy1llen ictat  Dumx  no4tptoii3tldfa2ulumon() exrxr iatop rau o t)sexr(opoy1ll  lnesl(f 2taxm oo4ope  oetldfs2emnmo u)artomfctadomD  n o;(0 2triopiodom n fcsa( a2rm( o;o4tpx ioeiyt a uan snu4aetnxo iatomDe ueil(0t2toio3iodaleelfeta( a2uru  ;t0tleo o3iys a ua(msnu0 lenmf tytlpt lueslt0t2toim3no4om  mfci tf Drr(rpnt1aleo i3tyt m emump u)teenxocoytfm  aivs (  2xmim oydameemnei (  2ua(m no0aexnifetldfaDelnms (4aexrir3to1om raivs (0srtoxopoy1altn nvtlt)s2uau ont4tlx iictld sDrmumsnu) etniocootomtrln s;t trtoim iodole mfcsat a2rrx oot0olxo fciytlm2ranmpn(0aetnmf tatlmt  nei s0s2xrxrpiy4oltelfct sf Dtrx pou4oltomf3ildfmDuanvs;u4aetoir3todfpte ivs;t0t2xmio3ny1amtnlfvi s)sDraxm ou0ale  oetlslm2rlu p t) rtrif oytfa r nvi;t setrxmpoodll elneiat) rtmu p;t1olto i3iatlm2emu pn()texnxo io1oateli slt)trxrirpoudaptelivt tfaruaum oo4oex mi3tlslm2eln s t)aleomf to1fa  aiei;(0 2xmxrpio4ol  mnvs s aDtmumpnt1tpenif3tatfmDrln o;u) rerircoodfmteln s t0teur(m3iy1lpeeliet t sruru p;o0teeomoctlsfmDran s t)tetoxo io1fptr i s t) 2trxr nudll  mnvs (farrr(  nt0teto oeiad m2ua(vo u)alenmrcio1opteaieols0 rtoxo3iydamtnlictlt a2ur(rooo4tpxo o3tlsla2ranvp t)tlxnxrciy1optranvsls srxrxm ou4op  micias)s2tmuroou4oex mi3iatlsDum( o;u4altrmo3iy1lpte ieols)s2trxr3io1opeemnciatf 2rrxmont0olt  ietadfs rl(mo;u0trxnmrcoa1faDr uvs s) rtoimpou1ap nmfetlt)a2umumpot0tee iicildlm rm(vpnt0 etnir todla r n s;()srurio3oydlme miviltf rtmumoot4altnifctlsfs elumon() ltrio3oydopDeauvs (0 ruo(m3oydll nlici s sDur(monu4teeomociyd aDrl(mp;u4tlenxr oo1lmteanesls0s2tm(mpnudam n ies t)sDrrxm nt4aexnmo3iydls ean pnt0tetrxo ty1lmtelnei;t0 euo(m nydol n fvsat)artau  ;u4teeo f3ildfs2rmnvsnt4arenif iatfateau olt0 2xrim no1olt micsltfarta( pno4oetn ictysls2eaumonu4alxnxfcoa1lmt auvol(0texr(r3oy4ome  ivsa()a2uaxmooo4texoiociatls eluvo t4trxrif iydfatrau i;()teumio nodoltnlieiasfarrr(m ou4oee  ietad aDrmump;u)tltomrctydfpD  uvi s0 etmxrpoudop  lnvtlt s2um(m nt4apto ieilsfm2emn on(0trxnxo3tadfm r n s;(0trtr(m3io1omtnlfctlt  Durxrpot4tlxoifcilsfmDrlumpnt0tetrir oy1lmte n o;s)seuoir3oy4openlnvtatf 2umur ;u1aeenmociat s rlnvon(4arxnmfctatfat ai o;( t2xrimpny4am  mnctltfsrrr( pno0olx iociadfsDulnvsnt)alxnxr io1oa ranvo ()trur(r3oo1olte fvtls  ruaumpno4opto iciytlsDeanmp;t)texoifciotfp  aiei () rtoxo ou1apeelivi t srurxr ot0tpe moetlt aDrauvpn(0altoxr3iydlaD  n s (  2tr(o3iy1llt lici t  rtmuro;t1tlenmfetysfmDemumo;u0artrxr iotfa e uvs t  ruoirpny1apt lneias)aDrr(r no0ape ifciadlm rm(mp;t0arxnif3oa1oat  i sls0s2uo(r3io4al e iei sfsDrmu  no1tpto i3ild s umumo ()tlenxrcoo1op  an slt)sexoiopiu1omtelieia()s2rru pot1ape if3tltfs el(vs;() leoxf3iydoa eauvs;(  exr(r iy4al nmnvt t  2uax ont1alenif3tltlm rluvpnt0altnir io1lmt aivo ()srtr(opoudalenlicsasfaDrmxm ;t4altomoeiadfs2uau p;u4 eerir oa1oaDeau o ( s2uo(mpiodlp e nctl()sDta(mpno4olx iieiydla uanvs;u4trerir3to1omDranes;(0srtr(m io4llt  iesls) Dumxr oo4oltomfctytla2umu ont0tlxrio3oydlmDrlnes s0 eum(o3oy4apt miei t) 2ua(mpnt1ope mo3tyd aDrlums;(0alxoirctytop eliei;( s2xmirpnydom  lnctlsfsDra(m ;t0apeoio3tld m2ulnvpn(4 etoxoctydop elu s;s0t2xmim3iu1ol nlieias) Dtau  nu4oee mictydfm2ea(vp (4aeenircoo1omD au ols t2xm(o iu4oltnlieia( s2uaur ou0oetn fctasla2rm(vo u0trerxfctatop raneo;s t2xmirpnudopen fvsls)a2rmxmpnu4tptoiieiadfsDra( o;(0areoio iadfptranvolt0t2umxm3oudalenlnctat s2um(m ot1alxnmoeiys a rmn sn(4 rxrmo3ia1fmDeli o s0 2umxrpny1alenlieta(fsDtmxr oo1opto f3tltla2um(vp t4tltnir totoatelnvilt0t2urxo3oo4openlnvilsfs2rmu  ;t1tpe ii3ils a2ra( o;()artoxf3ootlp  luvs;()seto(mpnydopenmivtas a2ta(  nu1tet iieiydla umnmon(0tlenmf iydfmDrauei t)texmirpno1ol n nvs s sDra(root4tex io3iys a eau o;u)aeerif oytlpt  uvol(0srxmimpny4om emfvslsfsDrr(rp;o0tee  feiytfs ul(mo;u0alenir ia1laD  ivs t teuoir io1lm e ivsas) Dua(ronu0ope  ictlsfs uln s u0 reriocoatfatelnvi t)trtr(o3nudap e nvsat  Dtmu ont0tle moetlt s ra(ms;u) etnio3tatfp   u o;()texr(r3oo1lleemnesls)a2rmu  ot0tptn o3tatlm el(ms t0trtnmr3oo1lmD  uvilt  2xoxr3iydal  mfvtat  2ur(r ;u1aeeoif3ilslmDuau p u)artoif3oatoaDr uvols0srtmxr ou4am  mnvt (f Duaur no1tee  o3ias s2ulnmp t) lxnmr3oy1fpDrau i;t0 2uoxmpoy1apeelfvsat  rumx  no0aeen fciytlm ranvp t4 lermf3oytfm r nvo;t0teto(opoy1ll eliet t  rrrxmooo4alxnmiciatfm2ua(vo;t)trxnio3ta1la  au i;(0 eto(m oo4lpe  ivt t aDrrx  ;o0apxoiietldfm2ra( o;(4alermf oodfm rai sl(  2trio3iu4lp e nvi ( artax  no1optoiiciat s2rmnvo;t) etoxf iydfmDr ueo (  eur(r ny1olee nvilsfa2uax o;o4ape  ictldlm emnvs ()altrmr tatopDr u s;(  rxo(opiodlp e fvslt aDrmum no4texoifciytfs eluvs t0tleomr3oadoa e uvi t)srxm(o ou4ol nmnesl() rur(mo;o4tpe mfeild sDemump u)arxoxrctodfm   ues ()seto(m3ny1ll elfesl() rrr( p;u0ope mi3tld mDrlump;u0teeomocoytomD ai o;( t2trxr oodam elfeilt)a2tru  ;t0apxomiciltla2uanvpn(0aexrxociotfp  auvo;()sruo(opnu1omte fvi ( s2rmx pot4alxoio3iydlsDemn pnt)aexomfctytfatr nvo t t2triopoy1lle mfvilt)a2rax oou1oexoii3iydla um(vont0altrxo oadomtean s;t trtmxr oy4ap n nvt t sDtmum ou0opeo octadfa rlu o u4tltoifcto1oateln i s trtr(m iu4omt livtas)a2tmu  no1tleoio3tyd aDeln p;u) rtnxrciytlm   n il(0 rtrxo nudal nlnvtat)s2taurp;t4oetoif3tatlm2rlums t4tetnir3oy1lateau i;s trxmiopoy1lp emfvs s s2rrumo;o4tle  fciysfs2rmu o u)areoifctytlp  aneo;t) 2trxo oydlpt mfesl( srra(monu0alen feiytfs ul(vp (4 etrxo3tadopDeau i s0srtr(r io4apenlfeiatf 2ururp;t1tleoiieiltfs ulnmp;t0aexnxociatom  lueslt0seur(opoudlptelfcta() 2rm(rpnt0opx ioctysfaDum( pnu0areoir3ootopt  ues ( trxrimpnudom  liei s  2rrur oo0aleoii3ilslsDuauvpn(4trtomrctotfp  luvs;(  rxmir oo1ame mneslt) Dtm(ro;u0tlxn fetlt s ul(vp;(4 rxrio iy1lpteln o s  rtm(o iu4lltnlfcsl( sDrax  ou4opeoio3iltfm eau p u4altrir3oydfpDrli i () etrirpnodap elnvs sfartrxmo;u0olxn i3ias s2emn p t4 rxoio to1oaD lu o;(0sruoimpny4om elfetlt)s2taxront1tpto feiatla umnmon(0aeerxf tatlaD anei t) exoiopoydalt  fei s  ruax poo1opxnifctadlmDumnvpnt0 exnmf3oatfmD li s;s)trxrim3oydlme  nctl(f rtaxrooo1ale  fetys sDul( pnu4artomrctadfptr ivs s) etr(r ny4llte ncils)artr(ronu0aleomoeilslsDra(ms u) rtnmfcoatfp   ivo (0truriopny4apenmnetls arrrxro;t1alx mfetld mDemu s;u0altoxr3ta1oateau i t)srtmim3iy1llenmfeiasfa2uru  ot0texomo3tld mDemu o () lxoxoctytfmDe uvs t0teurxo io4llenlfvs ()a2trxrpnt0tpxoiieiltfmDum(mo () etomoctydlaDrli ol( s2xrir oydop elicta(f 2ua(r ;u1olen f3iad m ra(vsnt0tltrxf3tatfpte nei;s)teuoirpoydameemicsls)srta(mo;u0oetnifeiyd s2rm(vo t0artrxo3tytomt li olt  2xrir oydlleelnetlt a2rmuro;u0oltnio3ilsfmDran ont0tetomfctotop e uvo (0teumxopiodlltnlivsa()s2rau oot0tleomf3iasfm uln ont)tlxnmo3iytfp  aneo ( trtrxm3io4lm  lncsl(fs2trur ou4olenmoetadfm2ulu pn(4alenif iy1omtran i t  rtr(r3oydlp   nvtat)sruauro;o4ape  feilslmDeanmp t4 eermrcoydlaDr n i ()trxrxrpnu1am  liviat a2rmx o;o0oleo ieiydfa el( o;(0aleoxo oa1faD an i;s  exr(r3nu4ol   fetltfaruru  ;t1aexnmf3iadlsDumu onu)tlxoxocta1lptrlnei;s)texrio3ny4omeemiesl(  2rm( o;t0ale ii3ildlmDemnmp;u4teenif iydoa rlu ils0truoxopiydlpenliciat) 2ra(m ot1apxo fciltla emnvp;t0arenio3iodlpt  u s (0 2uoio io1alte fei tf rtrx  no0oeenmf3iadfaDrmu s;t0aexrir3tadop eai o;s)trtr(m io1altn ieias) Dtm(rpoo4tet ii3iat m umu p (0tetnmr3ootfaDrluvslt0 ruo(o3ny1ol nlnvtls  rurxr ou1alxnio3iat a2rmnvsnt4tlerxo3todfaDran i;s0trtoimpou1lpt licia(  rua(ro;o0oeeomfctlsfaDraump u0alermrciy1lat  uvo;(0trxoimpiu4ll  mictls arrm(  ou4apxoiictysfs rmnms;t)teeoxo3totlaD aivi;s seumimpoy1lltn ici ()sDtmu  no1tptniieiat s2ua(mp;(4 lxoifctatla ean s s)trtr(m3oy4lp n ivsatfarraum no1aee  fciadfm2rlumsnu4tltoir iy1fpt  uvo t  ruoiopio1al e fcta()arra(ro;u4apeo icilsfmDul(mont0 rermo3totlpte i o;t0 rumim3oydoleemieta()arta(  ou4teeomf3tls s2rlumsn(0aetrio tadopDr nvo t) exo(rpnu4lm nmnei (faDum(m no1tptomi3iysfsDelnms t) exrmrcoa1fmteaneils)texr(m io1om e fes sf rtrurp;u0ale  icildlm2elnvsnu)texnmr io1fa r n o;( srxrir3oydlmtn nvs t  Dtmxmo;o4texo feiat m eaums;() etnxocoadlm  aivi;s srtmio3iy1amenlnet t s2raxmont1aetn f3ias s uauvsnt) leomfcta1late ieo;t)s2toxr oodolte fciltfa2raum ;t0ale  fetysfa2raums u4artomf3tydfaDr nvs;s sexm(m3iy4lp emnvt tfsrtm(moou1ale ii3tlsls ulumonu4artoircoo1fpD ln o t0trxrirpiy1oltelneia() Dtaum ;u4tpxnmoeild s2eau p;t)aetnxocoatlaD  uei (0trxoio3iodome mfcta(  rumu onu4teeoioctls mDeanmsnt)aeermociytfat  uvol(0trur(o iy4ol e nei s  2rmxr ;u0tpto fciltlaDuanvo u)tlxrmfcoatoate nes ( sruoimpnydomee fetas  rtmxmp;o0aeeo oeiys a uan s;u)texoifcto1oaD ai s;s)sexrxmpny4apenlieta(fa2rr( oou0olto feildla2ra(mp;u0 rerxrctadop  an il() 2uoxmpiydllt mnct t) Drrx ono1apeomfciltfs emn o;t4aleoxf3oy1om  aueo t) rxo(r ou4ole lfesas  Draurooo0alxn ieiytfs emnvsnu0trxoirciatomt ln olt0trtm(o3iu1lmeemieiatfsDrrxr nt1oeenmietldfsDrau p u)aetnmr3iadfpt aiesl()texmxm iu1am nlfcs sf Dtm(rpnu0ole  octlslaDrauvo;t0alxnifctadopDeaieol(0teum(rpoydlmtnmici s a2umxmpot4aee  octld mDelnvsnu4 rtoircoatlpDeai s ( texmxmpno4om  mnctl( a2rmx poo4tlxnmfciltla2ulu o;t4 etoio3ootom   uvo;(  exr(m oudole mnvtlt)sDraxr no1openioeiatls2uln o;u0 exrxfcoodlm eli s (0t2um(o3ou1om elncs (fa2tmxrp;u1tee  icilslaDrluvs;u4aetnio oydoaDe i o;s0t2tmirpoodop elieil(  Durumpno0opeoioeias sDul(vpn(4aetomrcoytfp ranvi t0t2xr(mpiydopt liei tfa2urxmo;o1tle  octyt s2rlumpn()artoirctodopDelivo;t)s2xmxr3iydap n ict t srtmxmpou1apt mfctatla2emn p;t4tlenif3tydlat aueo;( sruoir nydapee fetat) rtr(mp;t0ape ifciasfsDraumpn(0 leriocoa1omD livo t sexmxo3oy4ll   ncsls)a2rm(r ;t4aetnifcilt a2ea(msn(4aeeoif3tadlpt an i;(0t2toio oo4alee ncsatfs2uaxmoot1olt ii3tyd m elnmsnu4aexnxf todop rlnesls0tetoim oudoltnmnvi ( aDrmum nu0tptnmi3taslmDuau p;(4 rtrif oa1omD lieol( s2trir3io4am elfet tfaDra(mp;u4optoifciltfaDrlnmp (4aeerxf ta1opDeai sl(0srumxm3oydoptemnvt ()sDtrxmpnu0aptoifeiasfmDua( s;u4tetnxr iatfpD auvs s setr(m3nu1oltnmnvtlsfsrrax  no1oee  o3iad mDuan s;u0texnxo oodfp   nvil()t2xm(o3io1ol nlivtas)aDta(mono4aex mi3ildlm2eanmp;u)altnmrciodomt  nvo s0sexrir oy1lptelnct ( aDtmumo;o1optoio3ildlm2rlnms t0trtrircia1laD  u o;t  etrio oy1alt  ieia(f Dtrxrpnt1tpe iicild sDul(mpnt4alerio3oatla  an sls) euoir iudole mnes (f Durxmonu1tlen ietls s2uauvonu)aetrioctadomDeluei t) 2xoiopno4lpen nvt tfa2um(  ;t0tptn feiys a eanmp;()aetnxo3tatfpDelivo ()sruoir ou4alee fvilt)arraum ;t4tlx  fcildfsDelumpn()texrxf iodoa ran s;(0sexm(o3nodalt  nct s arrr( ont4apx miciadfmDuan s ()trenifcoadlpDeanei s0 rxr(rpnudop nmivtas)s2ra(rpou1tetn f3iytfm2em(vsnu4 rermr3io1late uvols0 rum(o3iodolenmivsl( a2tau  ou0open f3tltlaDean ont0trtomo3tytoate ivo;s0 etoxr nu4lpt lfet (  rraxmono4tpe ii3iytfmDumu p;(0 reoio totlpDr n o;s  2uoxr oy4al  livsls) 2ra(roou0opx moctysfm emnmo t0aexrxocoo1lp eanvi;s0 exmir oy4llt  fcsa(  Drru  no1oet mfetytls el(mo;() eenmo3oodom e uvi t trxmio oydapenlfciat sDrmxmpnu1ole ifeils aDrm( pnt0trxnxr iydoaDeaivo;s0trxo(mpnu4ol emnvsl( sDra( oou1oexnmo3iytfmDeauvsnt)tlerxf3oodfate ivi (0sruoxmpoo1apen nvil() Dra( o;u1alxo fciatfs2rauvo;(4alxnxr3iodomDeli s s s2to(opoo4lpen icsa(  Dtrxmp;u1tlt  i3tyd sDranmo t0altoxfcoodfm rau o;( texmim ou4apt miesl() 2ra(m no1olxomfeiadlsDrlnvont0 lxrmr oatopt lnvs;()trumiopnu4amt mictls)aDrmxrono0altoioetatfs2uluvo (0tltrxo iadfat luvsl(0t2trim3iu4alenlfeilt sDrm(  ;u1openmfeiasfaDumu p (4arxnircootlaDr n o;s0srxoimpou4llenlfvsl(  rum(  oo0aex if3iltls ulu s;t4tltrir3iotfpD lu ol(0 exoir iu4omtemiei () 2ur(monu4tleo o3tyd s rluvo;(0 etnmfciadfm  auvsls)t2uoirpno1lmtemfeslt  Dumu ont1apxomociadfs ra(vonu0arerxf oodop elueil(  exoimpou1lpte nvta()srur( ooo1opt moeiadla ul( onu0tlerxr oa1fpDraieo t)trxoim iudalen nvtat  2raurooo4opt ifctasfs2uanvsn(0 leoiocoydlm ran ols teur(o3nudlm e icil() rrm(  ou0ole ifetad sDrmumo;t4trxnio3todoaD lies;s srtoir3oodape mneil()a2rrum no1tleomoctydfs2um(vs (4alxomr oatfpDean o t0 euoio3io1olenmfvt s a2rr(rpno1tlen ictasls2rm( sn(4 rerxo totlaDr i o s0 rurir iudalenlfcsas)s2trurooo1oeeomf3tydfmDul(vont0alerxf oydfp elnvi s0t2umxm ny4ll nlivtls)s2uaxrpnu1olen oeiytls2umnmo (4trxnioctadlmteln olt)sexmiopnodom n feils)a2ua(mo;o4oleoifcildfa2ranms;u0 lxnxfctytlatr uvs;t  exrxo ny1ll emfeias arua( oot4tlxo i3tlt a2umumont4 rtnxf3iotoa   ueilt) rtmxr nudlm elnvs tf 2tm( ont1olx  feias m rmu p (0 leoio oy1fa r nvi;( s2to(o oudlltelivia()srtrxm nt4oetn o3iadfs2um(vo;u)trtrxo iotla rlivsls t2xmio3nu1omte ncsls s2tmxrpoo0tpenmoeiytls2ean o;u)aeenifctotlpt an il()srxoim oo4op nmfcsls) rtr( o;o0texoio3iyd a2em(vo ()alxrmo3totomtr ivo;t  etr(rpou4lpenmnvt sfs2rmx o;t4tlxomf3tadfa2um( snu) eeoxociydom   uei s truoxm3oydlltnlnei t  2tr(ro;u1tltnmoetyslsDean s ()altnircoodfpDe n o t0texrxopou1lmt mfctlsf rtrum nu4aexoioctad mDumnmon()tlxnmfctadfpDelieilt0trtr(m3oy4altelies ( s2rau o;o4tpxnif3iat s2uau sn(4 reomo iatoaDe ieilt)trxr(m nu4omtelfcs sfaDtaxrpou1oet micildfm rl( snt0 lxoxo3totlpD livi;t0sexr(o3iu4lltnmivt s aDrr(r nu0altoif3iatfs em(vp;t)areoircoodopte i sls0srxmir3oo1ole mnvi t)s2rmxrp;o1oexoiociadfa2em(mo (4 etnxrcoo1op eauvo s)seurim ny1amtn ictatf rrrx oou4tlto oeilsfa2emumsn() ltoxf3iytom eaivilt0srxrxm3iy4oltn ncsa()sDraxrp;u4tpen o3iltfs2elump ()aexnmo oytfate u il() 2urio oodomen fct tfaDrrurp;t0apt  iciysfa eanvs;()altoircoydlaDe i olt0teuoiopiudap nlfvilt) Dtrxrpno0alxnmi3iadfm el(ms (0 rxrxo3tadoa ran i (0s2xmxm nudame  neslsfsDur(mo;t4tlto iciytfaDra( ont4aetrxoctadfmtrlnesl(  exo(mpoydol  lnvtl(fsDrrur oo1aexomo3tld a2elu s;t4 lxnxr iodlmtelu olt0 ruo(r3iydaltelictas  Dta(r ot4oetomfcilsfm2rl( s t0arermf3oadfa raueil()s2xmir3ny1altemnvtl(  2rrxrpnt4tetnio3tat aDrlu p u4altnxf oa1om  aies;t)t2um(o3nu1lpt  netl( aDtmump;t1aee mociydfm2emuvs;u0artoxo tatfmteli s t0 2urxmpio4omtnlieiltfarumx oou4apxomf3iltfmDua( pn(0 lenmf oo1lp  li il()tetr(r nu4am nmnciat a2uru  ;o0optnif3iadls ea( o (4altnxf iydfpDrlnvolt0trumxrpou1lltn fesl( s2uaumono0oex miciad a2eauvont)aexrmo3iodfa r uvi () 2trxm no1lme  nvtl(  2taxm ;u0olt mi3ilsla rmumo;u)artnxo3iydfm e i i t0 exrir no4ameemictls)aDtmum ;t4tlto oetasfs emnmp;u)trtomfcoadfptrluvs;t)srtmxo3oy1op   netatfs2trur oo0aptnifciytfsDeaump t4tltrmo oy1faDeai o (0 2uo(m3ny1lmtnlfesa() 2tmx pot4oet  o3iasfa umuvp () exnxrcoydfa  li o ( seuoiopou4ameelnct ( arua(rono4ope io3ilslaDul(vo () eeoxr tatfat  ueo s0 2to(m iodlpenlietasfaDrr(  oo4opx io3tlslaDemuvpn()aetnxo iytlptran s s0t2xrxo ou4op  mfviat sDrrumont1tetnmo3tltls rlump;(4tltnxrciydfm raueo s t2um(r3oydlmtnmnctl( srrru pno4oexomfeiaslm uan o ()tleomfciotlaDe iesl() 2um(o3oy4amtn nvt s aDrmu pno4olxn o3iatla rmn snu) etoir3oodlat liesls0sruoxm oydom nmnciat aDra(r ;o4oltomfctat aDuaumo t)tlenio iotfaD lu il(0 2umxm iydalenmiesls) rtrxr nt4tpt moeiys a2uauvp;u)tetnxo oatfpt  uvs t0 eurxm3io4llenmnes ( srrm(r ;o1opxo fcildfsDrmums;(4 exnmo ootlpt  u i () rurirpnudamtelnctltfarua(mpou0tlx ifetlt a2eln p ()texnifcoadlp  aivs;s s2xr(o3no1ll emieil()srtm(rpnu0tpt io3tyd mDelu o t0treoxrctotfmtelivs;(0 exm(m3iydop n nvilsf Dumxr ;t4tlenmfciatlaDua( o u0tlxnxf3iadfm eln s t0 2xoir io1ll n ncsa(  rtrxrooo1alxomo3ilt aDraumon(4 rxnxf tatop rlnvs (0 2toxr3oodlpt  ictasfsrrr(r ;t4oetnmfctadlm2uanmpn() ltomr3oo1fpDelieilt)srxmxm3iy4alte ncia()a2ua(mp;t1tpxn f3iyt s emnmp;(0alxnmocoa1lmDelu s (0seumio io4alenlncils  rraumpou0opx  f3iyd mDrl( s (0teeoio3iydfa r iesls)s2xr(rpiy4apeemfvi sfarta(rp;t0ape miciydls rlums t0arenir3totfm eaueilt)srtoio3no4opt  ncsls)sDum( pot1apeo f3iadla2rlnvs t0 rtrioctotomDe uvs t)s2xmxm iydaltemnvt tf 2tru oot4aexnioctydlmDrmumo (0 ltnir3oodla e uvo;t s2trio io4amtnlivtas  2trxrooo4ale iiciysla2ea( on(4trenxf3iy1optelneol(0sexmxo oo4lpte fctlt a2rmu  ;u1opxo ietad s ra( p;(4treoxr tydfm raivs s trxm(o3oydlme mics sfsrraxrpnu4altoioeiys mDra(ms;(0alermo3oodlaDraueo t)s2tr(m iy1lpe  nci sfarurumoou4apxoio3ilslsDuanvpnu4aeenmociatoatelieo ()seuo(opiodom  lfeias a2uaumono1olto o3ilt s eluvo t)tlenxr oo1faDrlu i t)setriopno1lmtnmfcsatfa2rm(  oo1aexo f3iytfm2uauvont4trtniocoytom eli i;()s2xoio3nu1ope mnci ( aDumxmp;t4tpt if3tasfa2emnvpnt0 eenmr3tadla rlueol(0 eumxo iudop  mfeia(fsDururp;o1aee  ieiadfm2ul( p;u4 lenxo oodlmt  ivo;() rxoim3nodol  lfvs t)srur( o;o4tpeniieiasls2rmumon(0 leomf3ootfmt livslt0t2uoxmpiu4lpen ieil(  rrrumo;t1tlenmoctyslmDrluvs t0arxrxrcio1lmDrlnesl( s2uriopnydole  fvs sfsrtrx  oo4tpe mi3iadlm2rmumpnu4 ltrio3ia1lp rln s s t2xrxmpiu1ome mieslt aDrr(  nt0texn ieiydla umumsnt0aleomr iytlmtrli s () 2tmxr3oodamtelietlsfarrax oot4ape  o3tat a eluvsnt0 eeomo ia1fatr ivo ()setrio3nu4amtemnvias) Drm(  no1olxnif3iysla ul( o ()tleoir tatlmtran o;s)srxm(opnu1ole  ncsa()arurxmp;u1tex  f3ilt aDumumsn(0 leoioctytlmte nvilt) 2to(r ou4al   nvsat)s2tmumpnt4ape  i3ilt sDrau p t0texrxo3ty1laDrlivs (  ruoirpiydalenmncilt  Dtmurp;u1tpen iciysfs2emnvp () rxoxfcoa1lp r n i t) eumirpoy1lleelfcil() 2tmxmpot4olxn iciadla eaums (0tetrxr oytop eaivs (0 2toim nu4lleemfciatf Dtmxmooo0teeo f3tatfs elumo;u)trtomr oa1oaDelieo s)tetmir nu4am e net (fsDrrxmo;o0aeen oetat m um( p (0tetnxfctadopDeaueo ()seurxopoy1al e ics s a2tr(mpot4texoio3iasfs rln o (4 rxoxf3tydlm  lieslt)trtmim3io4omenlict t aDumu onu0oltn icilslm2ranvo u4 ltnmo oodomt  ivo t0 2uoim3nu1lmtemnet s  Drrxmo;t0tltoioctysfs eln s (4tlxoxocoadfmDelu s;t0t2uo(r ny4ol   neta(  Dtmur no0texo feiytls rau pnt4trenxocia1fmt  n o s  2umxo3iy1altnmfeslt srurx pno4texnmo3tldfs2rlnmp (4 eerir oadlp rlnvsls0 2tr(r nodaltelfci ( s2um(rp;u4tpx miciltlaDulnmont)texnio iytlmDr u o s0t2toxm iu1lpen fetas) Dta( ooo1aex iociys a elnmo;u0 exnio iy1fp elueo;()srurio io1apen nes ( s2tru pnt4tleo f3ildfaDea(vpnt)aleoif3to1fm e nei;t0s2uoxo3iy4am n nctat)arta(rpnt1aee iociyd a rm(mo t4 rxnir3oodoateaueo t0texo(r iydlpee iei tfa2rmu  ou0tpt mfetys aDumn s;t)artoio oo1opD aivo s) eurimpnu4om nmfetlsf ruauro;o4olx  icias sDumuvo t4trxrxo3tytlp  auvols0srxmimpoodlp e feias)a2ua(rpou1alt mfctlt s2um(vo t)artomo3iy1omD an o;t  2trxo iydaptn ictas)s2taxmont4tlenmf3tyt a uau s t0aeerxr3tytla  lu slt)texrxmpnydomeelfctas)artaur nt1oleomfeiydlaDel( ont0 rtoio tytla   ivo t0srxoxo3ou1amee ivi (farrrum nu4ape  o3iydlm2emu s (4trtoxr3ta1fmtr nesls) rurio oo4omenlivtlt aDta(mono1tpt  ocilt sDrmu s;t)altomo3iytfat anvo t trtmxrpiu1omenmics tfa2tmu  nt0aeen ieiytlmDumn o (4treoif tydfaD  i sl( t2tmxo3ny1lmen iet sfsDumx  ot0altnmo3tat aDrlnvs t0arxnif3ia1opt anvsl(  exm(rpny4altnmfvilt) rtrxm oo1oex  ociyt sDrlu s;()texrxr3oytlpt li ol( trum(mpno4opt lietatfa2tmurooo1alxn ieiyd s rau p u) etomf3ia1fpDeli i;t trur(mpiydole lfesas)a2raum ot4alx mictld m rmums;t0 exrir oa1lpD luei;(0sexrxm iudlmen feil()srrmumont0altnmoeilt a2ranvont) etrio iodopt  nvi s) 2xoxopiodlptemicil(  Duau oot0aee  octad a el(vonu0 exrio3oo1fpt  nvi ()t2uoir iu1omeemnvtas)a2ra(rono1apxnifciadfs2rlnmpn(0 renxr3oatoaDeli o () rtoim oy1oltnmnvi t) 2umxmpot1tltomf3iys m2emnmsn(0altnio oy1fptr nei;s)teuoir ou1alenmfei t srurxm nu0tptomo3iadfa2rmnvp;u0altrmfcio1lp  lnvolt0 eurxr iu4lleemfviltfa2ta(mo;t1tet  ieiys mDrmuvs;(0arxnxrctydlateaieo;( teumxm3nu4al n fvsls)artaxr oo1opto fcilsfa emn p;t0tlenir iytoate n s t  eto(o iy4lpen ncilt  Drmxmpnt0tex iieiatlaDrm(vo t) leniocootoaDeluvsl( s2xmir3oo1alte nct s  rumxmpoo1aee  f3iyt m2emnmont0tlerxf3iytfpDe ivi (0trtmim oy1omtn ics ( a2tru pno1oetomictatls raumont0arxrio3to1fp rai i t  euo(r3ny4amt lici t  Drmxrpou1tet mfeiadla ul(vp u4aleomocta1lp ran o;t)seurxo3no1om e fcil( s2ta(m no4oex moctlsla2uau o;u)tltrif3ty1fpDranei;t0 euoxm3ou4lmeeliei t arrrx  ;t0altn feildla rlnvp t4tlxrmo3tadfmt lnvs s0trtm(mpio4lpe  nvt ()s2rmxmont1tetniieildfsDua(vo;(4teeoif3iodfaDr ieo;s tetoxmpiy1lptemncs tfa2uru  no1olenioeiaslsDra( o () lenir3oydop rau i s)teurxm nudlmtn ics tf Dur(ro;o4oex moeiadlaDem(mo;t)trtrmf oa1lptraues;t)t2tm(r oo1amt liesl(  rrm(ro;o0tpx  f3iyt mDrmn snu4 rxnio iytfpDeai sl( sruoio3iy4am nmncsas)sDrmum ;t1oex mocilt s2rm( p (4alermf3todlpt  ues s0s2trir3nodam   nvt (  2ra(mpno0aetomociadfa ra( o u) lenmr oatfpD an o s0 etr(o3oy1ape mneta() 2um(rp;o1tpxn fcilsfmDra(vonu0tetrxr iytfa rlnvo ( tetmxm iydameelnct s s2umuro;u0alxo fciysls el(mpnt0aetrxfctatfp rlnvo t)seumxo3ny4lm n ncslt)sDum( oou4tpx micilt s emnms;t0tltoxf oy1fat  u o s  2umimpiy4lpenmnesat artau  oo0aeeomfeias sDrln o;(4 etoifciytla elnei s  rxmxm3ou4ap n neta()sDurx  no4altn oeiyslmDeanvsnt0altnmo3iy1opD lueo (0tetrxmpio4al elnesl()aDrrurpoo1altnmi3tltfsDrmnmsnt)aetriocta1oa  livols  rum(o3oudam nlfvia(  2trur ;u4tpxo fciltfa ea( s;()alxnif oatfatrlnes s trxrim3oydome mictas)arrm(  ;o1tpe mi3tls s2umn o;(4 eerxocoadfa rli olt0trxm(o nydapee iesa() Dtmumo;t4tetoii3iat m rmuvo;u) ltrmo tytop  auvi;t0s2xr(m3no4ap  lies sf rumum ;u0apt mietaslaDraumonu) rtomf3ty1fm rlueol( trtoxr iy4lp nliesat)arra(  ou0tltoiiciyd sDelu p;t4trerio tytom rau s;s)srum(m3nu1om n nvt s)a2urx  ot1oexo fciadla uau s;() ltrmr3ty1oate i sl()t2xmiopiu4op e feilt  2rax p;t1apt mfcildfa uau o u0aexrio3tydla ranvol(0 etr(m3oy1om nlfeta( arrr(mont0olxnmicilsls ulnvonu)tlenxr iytfateluvs;s)srtoiopnodaltn fvta() ruaxrp;u1tle if3tlsfs2ra(mo;u0tlxrxr3oadlp ranes s t2urir3nudllee nctlt aDrrur ;u0olx mo3ild m rmnvo;u) rxoxfciytfmt  ues;s)s2xmio no4lltnmivt tf 2ta(mpnu0olxo fctydfa2emu snt0 etomr3iatopD  ieils0 rxo(o3oo1lptnmivtl(  Dtaxrpot0aexomi3tad sDem(vo;t)aexnmo iotopDranvil(0srxm(mpiydope mfvils a2um(moot1aet ioeiytfsDeau onu4 rtniocoatla  auvs;( t2tmxopnudomeelivia()s2uaxr ;o0tpxo fcild m elnms;() lxoifcoodlmtraueo;s0seum(o no4olenmfctl()aDtmumpot0tex  feilt a2ea(vp u4texnmr3tydomDeli i;s0sruoim3iy4lpte fvs t aDraxmpno4tlxnifetlsfmDumump;()arxnif3tatopte ues;s0s2tr(r io1lpeelfet (fsDum(r ;u1oetoioeiasfsDem(mp u4texomo tydfm r uvolt0 rxoxr3iy4op  mieta(faDuaxro;o0alx mfciatfaDelnms (4 lxnif3to1fmt livo;s)s2toirpiy4om n neias  2raump;u4oex moetls m2rm(mpn() lerio3oytla   neo;s teurimpno4omtn netasf rtmx  ;t1aetoio3iysls2uaumon(4 ltrmf iydlatr i s;(0tetr(r oo1amte iei sfsrraxrp;t4tpt moeiasfmDrm( p;t0trxoio3oy1fmteaieo (0t2uoxm no1ap n nct ( s2ra(m oo1opto fetltlmDuln p;u0aexnmf ia1faDranei;s  2xo(r3no1ll nmiciltf Dtmxroot4openmictld aDum( s u4areomr oydlp   u s s)trxrxmpiodal e fvia( s2tau  ;u0apt mociyslm rl( s;t)tlxrmrcoytomteanvo;( teur(o nu4om nliciatfarrmur ;o4altnmo3tysla2uauvp u)areoxr ta1lat  ivilt) 2uo(r3nu4lm  micsas s2rm(  ou4oltoioeiydfmDum(vp () eeomf3iotfmtrli o t srtoxr3iy4ll nlfcs sfsDtmx pno4opxniicilsla ul(mo u4trxrmfctodoaD lieo;s)srxoio io4ol e feslt  Drrurp;t4olen f3iadfs elumo;u)artrio3oytfate i i;()s2xrxo iu4am nlictlt s2rr(mp;o4oex iocildfm emnmp t) rtomf oodop eaivs t) eur(o io1oltnmfetasf rrrxmo;o0oeeo octldlsDeauvo (4aeenxo tydfm r uvi ( s2umxo iu4ome lictl()aDra( onu4apenmo3iys sDulnmp;(0teeomfctatfa rai olt) 2toio nodape lfes (fsrrrx  ;o4oetnmi3tydfa2elnvon()aeeoioctydfpD aiei;s)trtmxm oy1altn fvt sfa2rau pou1aexn oeild m2uauvonu)arxnmr ootoat aiei;(0 etr(mpno1llt  ietls s2taxmono1tleoioeiat aDea(vs;t4trerio oatlaDrau i;t s2trim iu4am elietlsf rraur ;t4aex io3iys mDra(mont0aeenmr iadlpDeaneils0 rtoxopou4ll   ici s)aDrr(rpno1teeoif3iasla2ua( o;(4altrxfctadfaDe ieol( setoir ou1ameelici ( s2rmx p;o0aeeo oeiytfaDemnvpn(0 leniocta1op  auvslt trxm(rpnydal   fvs (fsDum(mp;o0aetnioeiytfs2ulnmo t0artnxr3oa1fpDeli i;t0s2ur(o ny4olt mnvilsf Drmurooo4tlt ifciadfmDrmn s t0aeenmfctadoa e ueolt)trtoxopiodapt lnci s arururp;t4apt  i3iys a um( o;u0aexnxrciodlp rlu i s seum(o3oudaleemfvi s srumxmpnt4oet ifeild m2umuvo (0areoir3totomt luvolt s2xrir3oo4alenmnet t srraxm ;u0tlxomiciatlaDeaumo;u4tltniocoa1fmDrlu sls t2tmxm3oo1al n ieiat srrmxm ot4tpt iictltls2elu p;t0trerif iytop rai i t  etr(opiodoltn ici s aDta(m ;u1aet iietadlm ua(vp;(0artnir tydlpD auei;t)trum(r ny1llee nesa(  2trur ou1olt mi3ildla el( o (0aexnmo ty1oat anvi s0tetmio iudome mfvslsfarrr(mp;o4tptomocildfm elu sn(0 eerxfciytfpDr ivs ( s2xmir ny4lpt  nvias) Dtm(m ;u0aexoiieiyslm rl(vp;(4 lxrmr3iatlaD an sl(0t2toxopio4lm  lict t sruau  nu4aex micilslm uanmsnu4 eerxr oydlm eau o;s0s2toxopnudomt licslt)srurxm nu4tlxo ocildfmDrl(vs u4 lxrmr todop elu sls0seurxo nydopeelieia(fs2tmurpnu4aptnifetldla eanmo;u) rxrxrctydfmDrlues (0s2xr(m3no1amenlici ( srrr(r nt1open f3iltla2ranvont4aexoxocty1la eauei s0t2xo(o3no1amtnmnetas)sruaumpnu0opeo feild a2emnmonu0alerxrctatlpteli o s)s2um(mpoy4apee ieta() Dururpou1tpxnifeild a2emnmo () ltnxociy1fptrli ol()trxmim3iydolt mfvilt) Drrxmpnu4opt  ociysfmDelums (4tetnmo ootfatran slt0srumxopiu1ap  mictas a2trxmp;o1aeeoif3iadfs2umu o;(0 etnmf3iatfmtrlu o ( sexoxr3iy1ol elivtlt)s2taxrp;o4oee iictysfm2eanms (4tlxriocoydfmDr i i;s)sexrir3ou1lle lfesa() rtrxr no0alxoifctldls ean o () leoxfcto1oatrlieslt0trtr(o iudap elici t artaumpno4tpxnmfciltfs umnvs (4 lxnmf tatfpDe uei;s  exm(o no4ape mfcilt)s2ur( onu0opxomietydlm rm( s u4 eeoio oa1lmt anes;s0srxr(mpoydlpenlnctl(f 2rrxr no0tpenif3iytla2emu p t0 lxrif iydfat liei t truoir3ou4ll nlfeias)arrmurp;u0teen o3tlt s elu on(0alenxf3iadlat ai o;s)s2xrxr iy1oltemfcsas) 2umxm ;t0apx mfeiadfm2rlnvo;t0 rxoxo io1fateln sl()setm(rpio4lp  micil(fs2raxmont4apt ifciytfa elnmont0aeermfciadlpt lieo;()seum(o3oo4ll   net t)sDurumooo4tltoiocildfsDel(vpnt0tltomr totfate nvs s)srxrxo nu4lle miciasf ruau oou0aptn f3ilsls eau o;(0 reoxr iodfm   ies s0srxo(m nodlm nlfcs tf rtr(r no1alxnifeiadlmDelnmo ()arxoirciy1laDr nes t)t2toxr oydalte nvsls) 2tm( oou4opxo fetasls2emnmon(4texnmf iydlpte u s ()texoxm3ou4olte fei t)sDtmum ;u4tleniiciytls2ranmo t4tlxoif ia1lmDran ol(  2xmim3oo1apenmncsas) 2rmxmoot0aet ioctys s2emnms t4 rermf3oytfateau s t  etrir3io4llee neiat)srum(ronu4aexn i3tltfmDrmu p t)tltoir3oo1opt ai sl()trtriopoy4lm   nvslsf 2rr(  ;t4apxniietasfa2ulump u)aeeomfciytoaD anvs;t0 rtrxm3nu4lleelfcs s)aruaxmooo0tpxomf3tlt sDelumo;t0trerif oa1opDe i i;t)truoim nu4amtn fvt s)sDta(rp;t4tpeoifeiydls rau o u4arxnifcio1omtraieo;() 2toir ny1alt  iviasfs2ua(rono1oetomo3iatlm2rau pnu4teerxo todfa r nes s0s2xm(o3no4ome lfeslt)s2umx oou4apxnmocias sDelu s t0teenmf3iatfm r ues () 2trxr oudole mivil( srta(m oo0tpenmi3ilt s rln s;u4trenxocoydomte ivs;s)seur(r iudlpeemfcs tfs2tmxmooo0alen f3iadfm umn o u0aexrxr iotfat  uei;s  2uo(r oodol   fesa()a2taxmpno0olx mf3iydfmDemnvonu4tltomocta1op  aneo () 2uoxrpiu4lp emnetl() rtmum ot1oeeoiictadfs emnvp u4alerxr ta1fmte nvo t) etrir3ou1apt  fci t)srrm(m ou0texoiociys a uau o;() eenxo iadfatrli i t  rxm(r3nydom e nciltfs2tmx  ;t0aee  fciadls2uan p t0 eeomr3iadfmt lies;s srtrxr3oydllte iesl(fsDuaxmo;u0tleoifeildlsDelums;(4aetrmociy1lmtelivi t)s2ur(o no1lpte ncilt arua( o;o4tlt iictys m2ea(ms (4trenxocoy1lptrauei (  rumxrpoydopenmfcils s2rrxmp;u4opt ifetyslsDra(vp () lenxociytlmtrlueo ()teto(o3iodlm  licsat sDtmur nu0oet mo3iys aDrm( p u) ltrioctadom eliesls seurxo nodlpee fes s)arta(mpou4tlx mociys sDulums u0tlerxf oadop   i s;t) rum(rpiu4omenmivsl()sDuaur ou0alenmicias sDem( p t0 rtnmfcto1lmD ai o (0s2urxr oo4ole licsa()s2rmx  ou4altoiiciys sDel( p ()tetomo3ty1fm elu o s0trtrxr iydolen nvtls s2urx  ;u4tpx  oetatfa2emu pnu0artrxf totlmt  uvo t)teum(o iy4op   ivsa(fs2trumono4aptomf3iyd s2um(vont)artriocoa1laDr ivi t)srxrirpoo4amt lnvil( arumxr ou1tlx ifctytfaDumuvs u)artrmf ia1fm  lu o;s0teumxo iy4ole lfcs t)aDtaxrpoo0alxnmi3ilt aDra( o ()trxnmo iotlaDraneol(0trtrio3iy1apt  icsls s2ra( pou0alxoioeiytls2rlnmont4teenxr3iodfmteaiei;t)trxrxr3nu1lltelnvsasf rra(  nt1alt  i3ildfm ua(mon() lxoxf tadlpDe n olt)t2urxm nu4ole  neia( aDra(mp;u4oetniieiyt s uln p (4tlxrxf oa1op   i i;(  rxmir ny1oltnmfvta()srraump;t1oeeoiociysfaDumumo (0arxnio3iotlm  lu o s) rxm(m nodlpeelnvilt)a2rmumonu1alx  ieildlm emu s;(4 lerxf3totfm e nei;()t2xm(r iy4aleemfetl()a2taxm nt0apxnif3tltlm rmumsn() lenir3ootfate u o t s2uoxo iy4llenlics sf 2tru pou1tpxo oetldfsDelump;u)trxrifciy1lm r nvs t0 rumxm oodom  lnctlsfsDta(r ;o1oeeomieilslaDrl(vsn()tetomf3oo1oaDeau s;s0 exmiopiodapenlfes s) Dtmu  nu1alxoiocilt m rauvsn(0tltrircio1fat  iesl(0 rtmxopiydam n nes t  Dumxm ;u4oee mi3ilsfm2rmuvon(4artoifciotomD luvo t)t2uoio3ou1ap emneiat)sDtr( oou4tpen i3ild m uluvs u)aexnmocoodfaDrluesls srumio3iudaltemfei s) 2tr(monu4apx  oeiltls2ran o;u4trxoio3ty1oa   u o ( srtoir iy1lpeemfcs s arua(mont4tle  ietlsls rmuvs;u0altrxo3iadfaD livo;t t2tmxo3iu1ome lfes t aDtrx oot4alt mieiytlaDea(vpnt4tlxnxoctytlat anei;t  etoxmpiudlme  nesat) rum( pot0tltomocildlm2em( onu0 etnmoctytfmDe ieo;s0sruoxm nudlm  licil( srtaur ;o4texnioetldfsDrlu onu)altoif to1fp rlies s teto(o ny1oleelfvtl(faDrm(mpot1texo f3iltfs2ran s;(4 rxnxr3oydfatelu olt  eumir ou4om nmnes s  rua(m nt0aee mfciadlaDua(vo t0alxoxoctatlpte ivsl(0tetrxr3ou4ole  fctl()a2um( pnu1tle mf3tydlm ranmp;u)arxomrciadfa   uvol()tetrxo oo1lp nliviatfs2tmurpou0alxomfeiltfa2umu s (0trtrxrctadlm r n i;(0 exrxmpny1optelfcilt sDrmu p;o4alxo i3tyt m2rl(ms u) lxnxrciodfp rluei (0 rurxr3iudlme lnesa(f 2rm(m no1tlxo ictydls2elnms;(0tltomocto1faDe ivsls t2xrxrpoudoltnmnvi s sDrmu ono0aex  oeildls2uln sn() rxomfctytlateln s t teumir oy4amt  ivs s aDumx  ;u4tlxnmo3tas mDemuvsnu)aexoxo3iotoa e iei ( trtmxm ny1oltnmfvsl( a2ur(r nt1opeo fetatfm2rmnmpn(0 renxfcoo1lpte ivo;t)t2trxr iodop nmnct s aDtmu p;t4tlxnmfetas aDeauvsn(0texrif3oodlmt lnvols) rxoim3no1al emivt tf Duau pnt1tlen fetydlm ulnmo u0trtnxrcoadlmDrlivi () ruo(mpoudopee fct sf rumxmonu0tlxo fciltla2uan s;t4tetrmo ia1lm eaieil(0t2uoio3io4ol emicsl(fsruaxm ot4tex ii3tlslmDul(mo t)aeerxf3iatoptrli ils0sexr(m oydal  mfei (faDrr(m nu1aeeomfetatfm ean pnu0 eerxrcoydomDr iei ()srxmiopiodll n fet s aDrrum oo1tpto f3tydfsDrlnvpnu4 renifciotom rln i (0 rxo(mpiudamtemfvta(fs2rmu o;u0teeoiocilt m rl( o;(0 renxo3tydfaD  u o ()trxoim ny1oltelictls)arua( pnu4olxnmfeiasfs rmuvp t0 lxomf3iy1lpte uesl(0 2xoxrpio1ll elfes t) Drau p;o4oeeo oeiyd m2ea(msnt4alerxf3iy1fa  anvi;()srurio3iu4apenmivt ()srururp;u0aee  i3tls m ean snu4tlermf3oy1fpDrlneo (0tetrimpoydllee fei t  Durum ;t1tpe  i3iysfsDum(monu4treomo tytlate uei;(0tetm(r3iudam e ictltfsDtm(mont0aleo iciysla el(mp () exrxr iodla elueils s2xm(rpoo1al nlnvsls) 2ua( oou1olx mociadfs2eauvo t0 leomo3iatomDeanvi ()tetoir3nu1amt lfcta( sDtm(mo;u4aleomocils m uanmsnu4aeeoxr3oydopt  uvslt  rtoio3oodam   fet ( sDrrxm nt0optnmiciat m ea(mp u)treomo tydlpt anvo t)seum(m3no1om emnvsls  rtr(mp;t1oetomictysfsDumuvo u4tltriocta1fp elivs;( srurxo ny1lpenlnvsltfs2trxroot4tpxnmfciyd m2rlnms t4trxrir oytfptelivs;t t2trxr3oy1lmee fvil(fsDtmu pnu1aptnmfeiydlm2eauvsnt0 lxrir3iatlmDean slt0t2xr(m3oo1omtelicsa( artax  no4tle  f3iatfs2el(mo;u0tlerxf3tadfm e ieil( t2toim ny1lp   fei tf 2uaxr ;u0texomf3iydla ua( pnt4altniocto1fa elivs;t0 rtoxm3oy1ll emictasf rtmu  ;o4alenioeiysls2rlums;(0aetrxf3oo1omDeau ilt)trxmxr3no4ol n ncs ()sDumx poo4tlto feildlm uau s;() lxrir to1fmDeanvi;( srxmxo oudll elnvtlt  ruaxronu1alxn fctat m2em( pnu4 rxrircty1lateau s;(0t2xrirpoo1al n fct ()a2tm(mo;u4opeoiictldls2rau s;t0artnmfcty1lp eanvsl() 2tr(r3oodopeeliesl( sDrmxm nt0tpxo octltlm2ea(vo u0alerxfciatop rlnes s)setrim3nu1am   iei s)a2uaumpou0tpxn i3ildla2rl( p t0aeerxf3ootoa eluvi (  ruoirpiu1ol   fetlt s2tmumo;o0tlenmiciyt sDuanmp ()alxoir ia1latelnei;s  rxr(mpiudom   ncta( a2urumpot4tlxn ietadfm ulnvs (4 renir3tadopte neo t) rtrxrpnudlmt mictasfsDur(m ;o0tex iieiys s2rauvs;t)aeermf oatfpD lnvs s) eumim3iu4ope mieia(f 2rauro;t4aex moctat m2emuvsnu4 eeoxfcta1laD livsls)trurxo iu1olenmicilt a2uax  oo1tlxnifeiyd m ran pnu)tetrircoydlmD anvs;t  exrir3iydoptelfctasfaDrmurpnu1apxnmoeiysfs ua(mon(4tltrmrcto1lmt livsl( t2xo(m nodaleemicil(fs2tr(m oo1tpenmoeiltls eln sn(0 etrmo iytopDelnei;s)t2uo(m3io4altn ietasf rua(m nt1oexnmociadlm rmuvont0trerxf tadop r nvo;t t2toir3io4ll   neilt) 2tmu  ou4ape  i3iadls2rmumpnt)tetrmr iotlpD  n slt)s2to(m3io4am emictlt) 2tm(mo;o1oltomicils s raumo;u0teenxo3oatlptr ues t0setm(m nydomt  iciltfaDrru pot4aex  o3iat m uanvpn() rtrxf oatoaDrln ols)setm(rpiydapt lfes sf Duax  ot1opxniociytfmDeaumpnt4trxnir3iotfmD  ueo s teurio3iu1op e fvs s  2tm( ono4tetnmf3iltla2eluvo;(0tltnmo oy1oaDeau sls0t2tmir iudlmenmiesa( a2taurp;t1tlt ifctytfm uluvo t)treomr3oa1laD livo s0texmxo iu1aleemneil()srtru  no0tpx mi3iadfa2uau o t0artrmf3iy1fmDeauvo;t0seur(m3nu4op eliciat  Dtmxm no1oex iociltfsDrau pnt4 ltrif3ty1fa  lu i t0 2uoxrpou4omtnlnvtas) 2rrxronu4apxomfcild s2ranvp u)areoxf3oa1oat lueo;s0 rxrxm3iu4amt lfvsl( sDtrxrpno0tpenifetyd s emuvsnu)artrxr3oa1oa rai s t texm(opio4altn iet t) rrru oou0tlxo o3tadfs emu o t0 rxomr ia1fm   i o;()trxoir3nodapt lfcsa() 2um(  oo1teeo oeiyslm2rmnmp u)tlenio3tytfmDran s;( t2umimpno1omte net ( a2rmur ou0tptomoetltfa2rlnvs;(0arxrmo oadlmDe u il(  rxrxopio1al elfvsa( a2ra(mpno0aptoii3iltfm2emu o u0trenmf3oydfptelivs s)setrxopou4op  mivi s a2trur ou0alx  o3tytlmDel(msn() eeoxr3oadfp e ivi ()setmxr oy4optnmnvia(  2umxrp;o4opxoiieiyt s em(msn()artomrciy1lpD aneolt0 exoxr3ny1llte ncsas) rumxr oo0teenii3ildfm2um(vp ()aeeoif3iy1oaDr n i ( t2xo(r iu4ol  miei tfa2uau o;u1olx  feiatfa2emnvsn(0aexnio ootfmt lneol( s2xmim iu4op nlfvt (fsrumxmoot4tpxnmfcils sDrm(ms t4 ltoxfctydfm   uesls  etoirpnu1opeelfes tfaDumu pno0oexo fctatls2em(mpn() ltnio3tydla   ueolt0 rumxr ny1am   ies (f rrr( p;t4tlx mf3iadls elnvs;t)tetomr iatopDrlnesl(0seuoir ny4lm emnvtlt aDrm( o;u4aleo ieiatfs eaumpnu)tetnmf oodlpt  ies;t  2xrxopoo4ape  ncslsf 2ta(root4olenmf3iys mDumump;t0altrxf3tydlm eluvi;s)srtr(opoodal  lfetasf 2urxmpot1tltn o3tldlsDelnvo;u0arxomocoo1optelnvi () rtm(mpiodape  ivtas)arrmur ;t1tlt  ociydlsDrm(mp t4trtoircoo1lp  aies t tetoxr nudop nmivs sfsDrm(rpnt4opxo fetytfs rm(msnu4trenxr3oytfatrlu o;()texm(rpno4oltn ici t sDumumpnt4alxn feiyslm rmuvp u4 ltrif iydfm  lneo ()srtrxo3iodolenlnvtls  Drmxrooo4tpxo o3tadla ul(vsn()tetrmocoy1oaDeai s;t0tetmxr io4lm e fes sfartm(r no4tleomi3ilsfa elnvpnt0aetomr oa1fmtrlneils) eurir3oudlpe mfvs ()artaum ;u4tltnmi3iasfa umu p t4 rxnio tytla rln o;s)trtrxmpiu1amtn nvtas) 2ur(mooo1texnmociltfa ul(msnu)alxnioctydfpDrlu ol() 2xo(o3iudapt lfvils  rrax  ;u1oet  ociaslmDean pnt0aetrmr3oy1la raies;s  2urim oydoptn ncia(f Dtmx  ;u1oexo oeilt m rau pnu0 eerircootla r ivi;t t2xr(opoo1op elfvi t  rrmur ;t4ole if3ilslsDua(mo;t4 etrmf3oytlmt auvsls0s2to(m3oo1amenmfesa() rua( onu1aet  o3iadlm2em(mp;()tlxrio3ta1fp r nvo t tetr(o3iodomt livslsfsrum(m nt4aet  o3iasls2umuvp t)tetoifcoadfmteai ols  2urir3iudlltn fvsas srururpnt0tlxoifciad m2ra(vp;t) lerxfciatoat lu sl()trxrir iydop  mfvs (fs2urum ot4alt  icilt m2umnvp t4tetrxr3tydfmtrlues;s)srxoiopoo4llte fviatfarraxrpnu1tee ioetas mDem(vo;t0 etrir to1lpD anes;t0sruo(r nodap  mivi tf Dtmurpnu0oltn oeilt s eln o;u4texnircto1lptelu sls t2tm(r nydomeelivtl( arrr( oot1tle mfetydfsDemuvs;t)trxnmo3iadopD  ueslt  exmim3no4openmiesas srtru pnt0tpenmf3iltfm el(vo t0aetnmf oa1lpDe uvsls) rumimpoodlm  mietls)a2tmurp;o0aexnio3tasfmDrm( pnt)alxnxr3iydlatrai s;s0 rxmxopnudllenmncta()srrau p;o1olxo o3ils mDemnvs t) leoir3oa1faD lnes s0srxrim iudlp e ivsl()aDtrxmooo0ape io3iltla2rmn sn(0 rerio3ta1omDe u s ( srtmxm3iydol emivsltfsDua(mpnu0tleomf3iytlm el(mp t0 etomrcoy1fm  ai o (0trxoio3ny4lltnmnvia( aDra(m nu0tltomfcilslmDuaums t)arxnxf oodfm eluvs (0truo(o no1op  lfcils) rtmxmpno4aetnmocilt m uanmon() lxrxfcootopDraneols0 eurxrpny1op   fcia()sDrmxrp;t0opx iieiltfs rlnmpn(4 lerxf3io1fp rauvs t) 2uoxrpnudap   nvs () 2trx ooo0oetn ietat aDrl(vp t)aeenxfcoydfmDeaies;(0 exrim3ou4ole mnvtatfartrum ;o0oeto o3tytla eln pnu)alxrio3oydomDelnvo t0sruo(mpoy1lmtelfet t) 2rrxrp;o0optnmociadfs2umu s;t4 lxrmr tatoa ranvs t)trxmir iydaleelfvil(f Dur(mpoo0aexnmociad aDrln o t) eenir3iydfmDrli slt s2tm(opiy4op nmics ()srumx oou0aex mfeiys m elu o t0 etrxociotfm eaueols srxr(o oy1amtnlivt ( aDrruro;o4teeo ociytlm2ra(vo u)aeeoifcoodfmt lneo s0s2xrir oodop n neia()aDurxmo;t4oleoiiciatfaDelnms;t4arxoif3oatomt ln sls) rumim3iy4amtelieslsf Dtm(r ot1olx mfciydlm2emuvs;u4tlxrxo tatfp r i sls  2urxr iy1ap   fciat) Dtr(m ou0tle iiciad m2emnvs ()aexomo oadfmt au s s t2tmxm3iy1lmeelicils arraxmonu4tpenio3iltls2el( s;u) eerxo ia1opteanei;()sruoim3iu1amte icta(  2rrxm ot1olxomf3tadfm rmumpn()artrxo oy1fpt aieolt0seurxr ny4alee nei (f rtau pno4teen i3iltfmDua( p;t0altnxfcty1oa  lnvslt  rxm(m oydlmeelfcs tf rua(  oo1tpt if3ildfm2umump;(4tetoxrcoodopte nvolt texrxmpny1ale  fcsl(faDta( pnt4tpxo feilt s2eln p u4 lxoxrciy1laDeln ol( teurim3no1al nmiei () 2uax pno1ope  o3tytls2rluvsn(4 eenifctadfate nes t) 2toxr oodoleemnvils)a2trx p;u1alt if3tytlmDulnmo t)tltoircio1la e uvi t0 2to(opnudlptn ieta(fa2um( o;o1tpeo ieiytlm2rm(vsnu)aexnio oatom r nvo s  rxmxrpno4ol nlnct sf rra(m nt0alenioetadla2eaums u4arermoctotlm rln i;(0 euoxrpio4am nlnesl(fa2umxm nu4ole iociyslm2el(mp t) ltomr io1laDr u o;t0srxo(mpiy4omtnmivsasf rumur nt4aleoiocilsfa2rmnvo t0altoiocio1omtrli o s trtrxr3ny4amte ivs sfaDtau oot4tet if3iytlaDea( s u4 rxrircty1la  lnei;t)s2trxr3oy4lme lfvsat)arrrumpno4tet ii3iasla2um(vont4alxrxo iytfa eln s;t)seuoxrpiodomenlfcil(faDtr(mooo4opx ii3iysla emu s;u4 exnxf ty1oaDrli ilt)s2tr(m iodap emics ()s2ur(moot4ale  oeiatls eau p;(4 etnxf3iotla eaivsl( t2umxr oo4lpe mfct tfsDurxmo;t4tetoifeilt aDranmsnu0tlxnmr oatlm  lu slt  2uo(o nu1ll emiesat) 2rmxmpot4opeomocilsfmDuanvp (4altrmf todlm elues t  etrxopnudaltelici s) Duaum ;t0oltoiieiysls2rauvp u0 rtnif oa1fmtelnei s0t2um(o oodoptelfct s sruauroou0oleo oetadlm rmnms t) lxnmo3totlat  ueil( t2tmxmpou1lmen neilsf Drax ono0tlenmoeilsfaDuaumsn(0tlxnmf3ta1faDe ivol(0setoir ny4apt  fes t) ruaxrp;o0olx mf3iadla2umnvp;t0teenif3iadlaDeanesl(0t2um(m io4ap  lnvslsf Dtru p;u1tle  fetad s elnvo u0 rxnmo oo1oa raivo (0srxoxr3oudameemfcsasfarrrxmono1teeomicildfs uln s u)alxrmrctadfaD lu s ( teur(rpoo4om emnesas arrrxmonu1opt iieiyslsDem( p ()texoif tadla   uvo;()teumir3iudal emnetls)s2rrxmono1oetnmi3tyt m ua( o t0 etnxocoatomDr i i t0 euoxrpoo1lpenmfvt t)sDrm(rpou1aet ifciasfm2ua(vs;u)tltrio3to1omD li o (  exm(rpny4amenlfct s aruaur nu1tpenii3ildlsDemuvo;t4artoif iatoat luvs;(  rtoir no1lpt  nei t)s2rmxrpnt4optomfeilsfm2rl(vs (0 etnxo ty1fpteanes t trur(m3no4omtnlfvt (f Drau p;u1apenmoctlsls2ea( s t4areomo todla rluesl(0texm(opnydame lnes tfsrrax pnu1olxnmfciltfa2rln on(4trtoxf3ty1lm rlu o s) eumxrpoydalt lnci s) Dra(m nt0altoifctyt m2umuvs;u)teenmr ootoatr uvol(0 rtm(r3no1ape  nviasf Drr(mo;u4oeeo ocildfmDrmuvp u4trermr iy1fatraivols teurio oo4lptn iesatfaDururoot1opxo fciyd s2rmumsnt0arerxo3ta1fp   uvo;t  2tr(r3ou4om emictl(fsrrrxrpno0oetnmfcilsfa ulnmont4tlenir3oadfpD an o t)trtrxo oy1om n fei sf 2urx pnu1tpx iieiasfa ra(mpnt0 etoxfctatfa r nei;t0 exrir3iy4lp nlfesatfa2um( p;u0tpxoiociatlm elnms () exomr oo1oatraivs;()sexo(opno4amenlncsl( a2ur( o;o1apx ifeiltlsDuauvp;u)arenxfctadoptelneo;() etoir oodomenlictls srtaxr ;o4opt if3ilt s2rau pnu0texomfciotlat aivols  exoxr nu4apenlnes t srtrumo;t1opeomicilsfs ra(ms u)trxoxo ia1omD liei;s) 2ur(o iodopen fetls arur(mooo0tee mieilsfsDelu ont0 lermo3iy1lp   n s (0 eurxm3oo1al   fvs t s2rmxm nu0tle ifeilslmDemnmp (0aexnxr oatfpDraivolt0 etmxr3oudlmtnlfvta()aDuaum ot4alt  i3tasls em( p;(4trxnmf3tatlaDelivsl( t2xr(m3ou1ome mfeslt)sDrrx o;u4tptoiociydfa em( ont4 ltrxf oa1oa  anvi (0t2xoio3nu1lltn fctlsfaDurump;t0oeenmoeiadlmDrau o t)tlxoxf3ta1fp r ieolt)sexoirpno4lleelietas)artaxro;t4olt ioeilt s ra(mp;(4trtrxocoytoa e nes s)t2tm(r oy4ll   net sfs2uaxm nt0oeeo fctyd aDrmuvo;t0 rxoifcto1laDe ueols)trumirpoo1alenliet sfsrrrxroot1alt  octld sDuanmo u0trtomf3iotfptr ivol(  2xr(mpnu4lmteliviat  Drm(r ;o1open ietltlaDul(ms (0trerifcoy1omtran i;s0teumxm3nu4oltelfvi tfsDrmx onu0tle  octytfs rau pn() lxrxocoo1oa   i s t)trtmio3oo1om nlnei tfs2ra(m nu4apxomoctldlmDuauvpnt) reriocoytlmDr i i (0t2tm(m nudomtnlivias) 2uaxmpno4tpeomo3tad s ean o;u4trtrifctotop  ln s;s0 2uo(rpnudal e ict tfa2tmum ot1opt iociydlsDelump;t4artrxfcoytfpteaues s)t2tmxr oo1apte nctas  2rrumo;t4tlxo f3iydlsDrluvo () reoxocootlp  anei s0seum(o nu4am eliviat arua(mo;t0olxo f3tytfsDra(vo;u)artnmo3tatoaD  n sls0srtrio oodopeemfvtlt)s2rr(rpno1tlenio3tyt s2em( p;(0 leoio ia1opD auvs;s0t2trirpnudop emics t  2tm(r ot1oetnif3iadlm em( s t4trermf iydoaDrlnvs ( t2xo(o3iy1amte nctatfaDtmxrpot4opx  ieildfaDea(vp (4aleomocta1lpDr u s;()t2tr(o3no1lle mnvta(  Dua( ooo1ale  o3tldlm2rlnmp;t) lxnxf ia1latrli sl( srumxo3no1op   ivslt)sDrmu ont1tlt  icilslm2umuvo;t4tlerxf3iotfateanes () eto(r ny4lme  ieslsfaruauro;u1tpxn feiadfs emuvpnu0 exomrcoo1op rau i;() rtmxmpio1al nlfvilt) rrm(rooo1olen fetad a2um( p;u4texnmf iadla rlieo ()tetrxr oydap nlieil(f Dtmum ot0oetnio3iysfa2rlu s;t)altnxr3iodlmtrlneilt)setmim3io1llt mivi () rra(m ;o4opxomi3ilsfaDrlu o t4 leoxf iotfmtelu i (  rxmxr3oy4amt mfetat)aDtaur nu0altnmfctldls2ulu p;t0 rtnio to1oa   i i ()t2tmirpou1aptn ivt ( a2uaump;u0tlenifciat s2rm(vo t4 lerio oytlpDrlivo;s0 2xm(m3nu1aptemfvtlt) 2tau  ot0tltnii3ilsfs uan snt)alerircoatlat anvs;t) 2trxm iu1lm emnvs t  2rrumpot4alxoiietlsla emnmo;(4aexomfcia1oat anes;t)srum(rpnodlm n fet ()srumu o;u0apeomfeiltls ra(mp;t4texoirctadoa  luvolt) 2xoxmpiydopen ncsltfsrrax pnt1tee  ietldfa2ea( ont)trxrmr oy1omDranes;()sruo(mpoydom emfctlsfarrmxmp;o0opxn ociltfm rluvsn() ltrir ia1fa elnei;( sexo(rpnudll n nvil( s2rrxm ;o4aee io3iltfs2ulumo;(4alxomf3iy1lptr i ol(  2umio iy4llt mnvtltf Dta(rp;u1oexomociadla uluvp;u) rtoxf3oa1fmDrlu olt0sexmim iu1opee nvia( aDraumonu4oltomo3tldfa2em(ms u4 reoxocoadfmDrlivsls)texmim3oy1op nmivsat sDumu  ;u4ale  feiltfa eanvs;t0texoxf3totom  aiei;s0 rtoiopoodlptn net tfsDur(  ot0apxnmi3tasla2uan p;()aexrif oytoptrlnvo;(  rur(o3iy4omt micils  2tmxm nt4tpxo ietydfs2ua(mp;u0 exrif oytfp eaivi;(  2xrxmpiydopt mnvias)a2ua( p;o4aexo o3iysfaDumn p;t0aetrmocoo1laDr n ilt) exoxopny4amee nvi s aDrmxmo;t1apxnio3ildfsDumuvont0 lxnxfctodopt luvi;t0 exm(opnudlmen fcta()s2tax oot0alt  f3iyslm ua( p u0tleomrcoodlm e n o;s  eumiopoo1om  mfesl()a2rr(mpot0apeniieildfm2elnvonu4trxrmo ty1fp r i o;s0srxrxr3ou1ll  lncslsfarrr(ro;t0olxo oeiadlaDea(vo;t4areomo iytopDrauei s0trxrirpiudlltn nct s sDrmxm ;o0tpxn i3tls a2ra(mon() rtnxf ia1om r u i t  eurxm ou1op elfeiatfaDrr(m no4teenioeiyd aDulu p u4texnxf ia1oa  luesls  etr(m3ou1apt mict (fsDumump;o1alenmociat s eau p;u0arerio3ootlaDrlieol(0 rxm(m3oydal  mnet tfaDrmx poo0ole  f3tydls el(vs;u)artrmr3io1fm   uvo s)t2umxm3iydom elfctl()artruronu0tpe moetasfsDul(ms;(4trxnmocoy1fat  uei;s)setmxo oo1lpt  nvsls  Draurpot0texn oeiltlm uau o;()treoxrcia1lmt lnei;t)srxm(m iu4aptnlfcs s)sDumx oou4oexoifeiys mDulnvo u0aexoir3ty1opDrlieo s)seum(m3iodlptemfeslt aDrmu oot0alto ieiadfs2uluvp;u)trerio3ty1opt aivolt s2uriopno4am elncsa( a2uru  no0apeoii3tldlaDrmuvpnu)trenmo ty1lpt auvs s0seuoio3iudamtelfetls) 2rrx  ;u1olxn i3ilsls2eanvp;(4trxnmr3iodlmt  i ils0 2urim3oydomtnlfeiat) rua(m ou4aetnmoetat mDrlu s ()tltrxociotlpt luei s0teur(o oudal   ivt (f Drmur ot1oex  feiysfs rmu o ()tlerifcoatlatelu o t  rumxo no1ame mfeiatfarur(rpoo0oeenifeiytlmDua( o;u4 rerir3iadfatr ivo;t tetrxrpiu4lmeemfeilsfsDuax poo4apxo ociaslaDumnmsn(0 rxoif io1omte ivil( seuo(o oo1amtemieil(fa2ua(r oo1tle mfciysls2ulnvs;u0areoifciy1fm eln ols0 rur(o iy1op e ietat srumxrpot0aeeoiociytlm2ulu snt4artomfcoy1fmDraieolt)s2xmxm no1lle  netasfsrumur nt4oet mf3iysfm2el( s () eerxf ootlpDeluvo;s teto(r io4optn ncias  rraxmpoo4aleoif3tytlm eanvp t4tetomr3io1opDr uvol(0setr(mpio4omtelivtat)a2urxrpot0alt moeiydfm2em(vo ()teerxf3iatlaDeau o t0t2um(r3no4amee neslt)sDuau o;u4openmo3iyt mDumuvs;u)trenir3oo1faDeai ols)srtrirpiodlme mfcslsf Drmxro;u1olxomfeiad mDelnvo (0trenxr3oatfp   nei;(0 rtr(o nu1oltnmfcsl(fs2taxmpot1oleniieild aDuauvpn() rxrxrcoytoaD auvo t s2tmxo3iy4lm n ieias sDuau pnt1olenmiciasfa2ul(mo;() exomf iy1oaDe u s;(0 2urxrpiu1lm emiviltfaDur(mont0aexomicild a2umu pnu4 exnmf ootfmDelneo;(0t2xo(o no1lle lfcta(fsDrmxmp;t4tee  fctyd a rmnmo (0 ltnir3to1lmtrluvi () rtrxo3no1opt  ivsa(fs2uaurpou1aeenii3iydla2rln s (0artrifctotlmteaiei s) 2toxo3oy4lmtn fcta()srrmu ooo0oex  ieild m2eaumo;t4trxomfcta1fp r uvsl(  etmxo3iudalenmfet s)aDra( ono4apxomieiaslmDea( s;t0aexnxf to1opt  ivs;()t2umxopnu1oleemnvsl( s2raxmpnu0opxn oeilt m ulu s;t4aexnmo totomt lneols0 2trxopnudlp emieils)artaxrooo1oetnmieils s ul(vs;u4 eeoir io1fpteaivol( tetr(r oo4ole mictls arumx p;o1aexnifciatlm2rlu ont)trxomr oadfmDelieolt0 etr(m3ny4ol   nctas) rtmxmpnt0tpx iieilt m2elumo t0aexnmrcoydfatraueo;t srtmxm io1op  livi s) Dtaum nt0oexoif3iltla umuvo;() eeoxo3ia1fateai o;t0 rxrxmpou4llte fvils aDtaxmo;u1apt  oetlslmDean p;u4tetnxrciodlpDraivi s0 2xo(mpiy4alenmfesls aDtmumpou1tpe if3tldfsDra(vpn(4aexoio3iadoptr ivs t) 2umio3io1am   fvilt)srumurp;u1tpx mfeiadfa2rm(ms;()tlermo io1oaDrliei t seur(r3ny4aptn fei t) 2trurpnt1opt io3iad sDrm( sn(0 exoxoctadlm eaneo;(  ruoirpnydopenlfvi tfa2ua( pno1tltniiciasla2um( o (4trxnmo3oydoaDean s;s0trurirpno4al nmnetas) 2rr(mpnu0tle  ieilsls2em(vp;(0 rxnirctatlptrln s ()trxrxo iudlle mfcil( aDurx  ot0apenmfetytfa ua(vonu)aexrxf3ta1lmDeanvils)teumir3oodll n ncsas aDtr( oot4oetnio3iadfm2rm(mp u4tlxrxfciodfa r ivi;()s2um(o3no4om nlnctas)artr( oot4tptnii3iytlaDum(mo t0 rtomo oadlpDrlnei;t)srxrim3iy1lmt mfetlt)s2umu o;u0teenmoctlt aDrm( pnt4tltnif3ootfmDrlieilt)trxmxo iodolt livs sfaDtrur oo0aexnif3tyt m rmumsnt0trxoxociadfm rlieo;(0 etmxm ou4ap nlncilsf rum(rp;u4ale mociydlaDrm( p (0tltnmo3ta1oa eanvo ( teum(r oy4lm  mfeias s2tm( ono0ape ioetydfaDra( p;t)tleomfciatfpDr i ilt texmxm3iy1ll elies (fsrtau ont1openmietys aDea(vsnu)treomocootoptr uesl( trurxmpno4lp nmfcil( srtrur ot4oet mfciys a rlnmp;u) rerir3iytopte u sl()trxmim3nu1ameelnet t)a2trx o;o0alxn o3iyt s elnvs;(0 renmrciodop r nvi s) 2xmimpny1lm nmiviasfsrtau o;o0texnmfeildlsDrln o;(0tltnxfctatfmt aiesl(  2tr(opiy4al n ici s)aDrr(  ;o4tleo oeiatlsDulumsn(0aexomf ootoa e nvolt0trur(m3iy1op nlnes s srua(  no1tet ifetadlsDean o (0 etnmociotfmt  nes;(0s2urir3ou4lpee ici t s2tm(  ;u4aee  f3iasfm umuvpnu)areoif3oy1om  lnvs (0 2ur(o3nu1oltnlfeiatfarururo;o1tle  fciyt aDul(vp u)artomo3ta1faDr i o (  rurio3ny4ope lietlsfsruaumoou1tle  o3iatlsDua(vo t0aetoxr tadlpDr nvi ( trxmxr3ny1lpte nct tf Dta(  nu1opxnmictlslm2uan s;t0 lerir3to1fmDe ueo ( trtm(r3oy4lm e ivtat a2rax pou0tlt ioetlsfm umnvo;u0 exnmfcoatlpt livo (0 2xmim3no4altelneiat)s2ta( o;t4tex mo3tas mDrauvp t4treoxocoa1la r nes;s0 etr(mpoo1am emfetl()a2tmx  ;u4oeenmo3iadfsDua(vs (4arxnmf3oy1omDr nvi;t trtoxo io4lpenmiet sf rtm(mpot0tpxomoctldlaDea(ms;u) rtrxr iodfmDe ieilt)srtm(m oydamtelfvil(fsrrau ooo1apx mocildla2emnms;u4 lxoxo ia1om ean o;t)texoiopoy1lme  ivils)aDtrxmpot0tpt mi3ildfs2rl( o;t0 ltnxfcty1op eluvolt0 ruoxmpou1lm  lfcilt) 2ua(r ot4teeniociys sDrmnvs (0 lxoif3iy1oate ies t sexoxopny4lleemicia()sDtmumont0tltn feiatls ua(ms ()tltnxf tatfptrai i (0srum(rpiydll emiei t)s2rau  ;t4apxnmf3ias a rl(mpn()artnmf3ia1omDranei (0 rxrxrpoy4al emivi (fsDtau poo1altn octys m2ranvon(0trenio3totfmte u o;s0s2trxrpoydomee icilt) ruru pnu4alt  ieildfaDul(mp (4trxnif oy1lmteauei;s)t2xoxrpiydapee ivtas) 2urxrp;u4aexoifeiad mDranvpn(0teerirciadopDe uvils0s2tr(opiu1ll emnci s)aDraurpoo0tlxoioeiadlm2rlu p;u)aetnmo iotlm r ies;s texmiopoy4lpenlnei t aDtaxmpou0altnmfeiysls2ul(vp u4trermfciotfpt ln i;( t2xrxm nu1llt licia(fs2ta(m ;u0oet mfciydfm um(vo t)aetnxo tytoa elieolt0setm(r nudomen ies ()s2um(m ;t4tetnifeild a2emuvs t0 rermr iadlp raueslt)srumim ny1lpt  ivi (f 2rrur ;t1texoiicils mDrm(vp;u0tltrir ia1lptrlu ilt0 2uoxm ny1ol n ietas)arrau  nt4tpxoiociydfa2ul(mo u0trtomr3iatop elu s;t) eurir3oodop n ivsa() Drr(mono0tltn ieiatlaDelu o;t4 etriocoo1laDranvi;( seuoim3nydlme  ictat  2tmu onu0ope ioetasfmDumnmo u0 eenxo3iotfaDrlivi ( t2xoxrpio4ope mfcias artrxmp;u4tptomf3ildlmDraumo;t4 eeomrcoadomDr i ils)sexm(opno1al   ici t)sDrr(  ;t1aee  o3iltfa2elnvpnu4aeeomo3ta1fp rluei s)trtmxo oudol  mfci tfsDurx o;t0olenif3ias a2umumo;u4aetrif iy1lmtr n o;t) 2urxr io1lpenmnesls aDrmurpnu0aex mociatfsDelumpnu4 lxrmo3iydop raues s)texr(m3nudole livils) Dtmumpnu1optomo3tldfm elums u4teenxrctodfa elnvslt)t2xmxo3iydalenlnesl( sDumurpou0aptoif3tyd m ulumo;u0tetrxfctydoptranvi ()sexrxrpnudam  lnvtl(fsDuaxr nt1altniiciatfs2umumpn(0 lxriocty1fat  nes s trtoio ny1ol n fesl(fartrxmonu4oet ioetyd m um( on(0treoir iotopDeanei t0srumim nu1lmte fei sf Dtm( onu4ape mi3iat a rl(vo;t0alxrxociy1laDr nvs;t)trur(mpou4lptemivs ( artax oou4aetn oeiat s2ea(mpn(4tetnmf3oodlptranvsls0 2uoxm nu4omtelici t arrr(m oo1texniieild m ranmo;t4trxomo to1lm e nes t0 2umxo io1omt lieia( srtru pnu0opxnio3ildlm rm(vonu) rtnircoatfmt ln ols0t2umxr iu4omt lfvsls) rtmxmpno1texo ocias s2raumo (4 lenxr oatfmDrluei;(0seumxmpny1lmee fetat) Dumx p;t0olx  icildls rmu s;u0 eeoxr3oadoaD au sl()tetmio iu4al  mfeil( a2umxrpnu4tptn octlslmDrl(vsnu4arenifciy1lm  lu s s seto(r oodlmeemfei s) 2rr(r ot4apxn ocilsfa2rm(vs;t)aeeomo oo1opDeaieo s) eumiopnodlle  fci t  Dumx pnt1aeeo fcild s ulums;t) rtoif tadlaD auvo;t0sexr(rpoy4lm elfcs ( srrrx pou0ope ifctltlmDum( p t0 etrxfciodoa e uvi;t0 rxrim3no1lpeelfet tf Drrx  ou4aeto i3iytfa rl( o;(0altnio oydlm eli il()s2tr(m iodolte nesltfaDuax pot1oetnmieiytlm rmnmo () leoif oy1opDeauvi;t  rumxmpiy4ope lictat)arrr(m nt0aexomi3ilt a rlu o (0aexoxfcoodoa r nvs s  rxrirpoudameelfeias)aDtrxmpot0apen f3tldfmDeaums;u)arxrmf3todlp raivsls)texm(opno4op  mnetlt  2tru ont0olx moeild m2rmnvs;u)tlxrxociytla r n ilt) rxrxopiodolenmnvtat  Drrxmpou4oltnifetadfs um(vonu0tlxoxr3iadfm r i i (0s2toir3oodomt  net s  rrmumo;t0tlen fetatlmDemn pn(0 etnxociadfaD auvils0 2uoir iudlpeemfesl(  2rru ono1aleoiietld a ranmo;(0 rtoif3oatla e u slt)trtrxm no4omt  fvi ( s2rr( o;u4tleomiciatfaDrln pn(4 rxrxr3todoatr nes s0s2umiopnu1amtelivil(fsrrru  ot4tlenmfetadfs ul(vonu0 renmo3oy1lpDr ivo t s2um(opiydolte nes tfsDraxmp;t0ape  fcias aDranmont4altoxf totlatranvi;( s2toir iodame lncta()srtmxronu0alt mieiaslsDum( s;u0 etnmo oodfptelies;( texrio3nodam nmfvslt)a2taxrono4tltn i3iaslaDeluvp t4trtnir3iydfptr n olt0s2tmxm3ou1ll n ncia(fs2tmu oou0altomicildfa2ul(vont0tltomf3oo1laD lnvs t)t2trxr ny4ll emnesa(  Durxrpot1altnmfetysfs2elnmp;t4altoxfctatlaDrlnvs;(0trurir3oy4lp eliet (farrrurooo0ale miciltlm2rmuvp t)altrio3tydfatrauvsls)tetr(mpnu1oltelivtls  2ua( p;o1oleomieiysla2umnvs;()arxoif totfa eaieslt) rumxmpoy1ap  mivi ()srtax o;o0opt io3taslsDumuvo u4tlenirciytfm e ivs;t)t2uoxmpny1omenmfcta()a2tau onu1oee  o3ilslm ranms (4altnxrciydfm  au ilt trxoio ou4lm  mfvsatf 2ua(  ;u4apx mfetatfa2rlnmp u0arenio3ia1om r ueo (0teum(r io4ap elicils)sDrrxmoot4oeeomi3iat s ul(vp (0treoifcoydfpte ieol()t2trio iodalt mneta() ruaumono0ope iieiltlmDemu p t0trxoiocio1fm eai i;t0texmxo3oo1openmfeia() rtruro;t4olt  ictytla2el(von(4texnxr oa1lp  livi;( trxoio ny4lp  lfcil()arrrxm no1tet iictyd aDemn o;()altoxf3iydomD  i o;s0seur(r oy1apt  ici s)aDrru  ;o1oex iieild mDra( ont4trxrxr iodfm r ieil(0tetmim3nydaptnlfeil( arrrx ont1tpt  oeiltfs2uau p;(0trtrxfcoa1lmD  nei;t srxo(r3iu4lleelicil(f Dta(r nu0tptomictydlaDrmu onu0 exrmf iy1lmDranvi t0trxrxm3nu1om  liet t  rtaxrpoo0oeeomfeiysfs eln on()altnmo iy1fa  lnvi;t0seuo(r3iy4ole  fesat sDtr( ont0alt  feils mDul(vo;t) rxoif3oatoate uvils sruoio3oo4lpenlivtat)arta(mpnt0apxomf3iyslsDean o;t0aexnmo3oodfpt luvo s)sexrxo iu4ale lfvsl()sDtax onu0oltn f3tydla2um( o t4tlxrmrcta1fmDrai i;(0srxm(r3iodap  mfet (fs2taxrp;o4apx  oeils mDra( p;t4trenifcia1oatelnvslt0s2to(o3oo4ape  icslt  2trx  ;t4aee if3iad a2emu pnu) rxoircoydomtelueil(0 2xrxrpnu4am e ncs t a2uru pnt4ope ifeildfsDumumo;t0aeerif3oy1opDeaies t t2urxm3oodomtn ivsa( sDurx pot1aptomfeildfmDelnmp u)tlerxocoo1oatelu olt s2tmxr3ou4optnlivs ( s2umu onu1texomictys a rmnmp t)aleoio3ty1om elnei;(0s2umim iydap e feia(  ruauro;o0teeoiociyd a2em(mp t4aeeoir3iydlatr uvo;()texrir oydlptemnvt s)sDrr(moot1tlenmo3ildlm elnvp;u4tleriocta1lp  lneo s0t2tmxr3iu4omen fvsatfa2ua(  no1aex ioctys s2ra(vp;u)tetomfcoatoateaiei;s seumxo iu1oltn icilt) 2tru o;t4aleo o3iadlaDeanvs;t)tlxnmo3iotlmteanvo;(  2xr(o iydlp e nvsl(fa2tmxro;t4tpeniiciyd sDuanmpn(0alxoxf ootfp ean i t)seurxopiudomenmneil()a2umur nu4aleo fcildfaDra(vo;u0aleoxrciy1oa rli ol()seurir3iu4lle mics sfarumump;o1teen ietat aDulnvo t4 rermrciatfa e uei;t)t2tmiopny1alen ncsltf ruaxmooo4optomo3iatfsDul(mon(4tlenxocootoat luvols0trtm(mpno4ol nlfesa()s2rmxro;u1oee io3tyd s2rau s (4altnir totomt  nvsl(  2tm(m ou4apeelnvt t  2umx  nu0tlt mictas m2ea(vo;u) ltomfcty1fmD aues t)sruoxm oydamee nciatfsrtr( oot4alxo ieiyt m um(ms u4tleoxfcty1fa rlnvo ( trxm(m3oo1lpee ietat srtru  oo1olxomf3tytla emn snt0artomrcty1op e ivs;() rur(rpno4lleemfvia() 2ururo;o4opt mociat aDel( snu0trxoiociy1omtr neols0teuoim oy1olee fei ()aruaumo;o1tlen o3tatfsDea( s;(4aeeoif3iatlp eluvils0 2xr(m ny4ol emict tf Dtm( pot1aeenmi3iltfsDulnms;t)tleoir3oodfatrln s s)s2uo(rpoo1llt lieiatf 2ur(rooo1apxnmoctas s2rluvs t0arxoxr3oo1omtr uei;t sexoxmpiudomt  fci ( sDtrur nt1apt moeiat m2ul( p (0 etomfctodomt  nvi t setrxo3io4omte fvt (fs2rr( p;o1tpeomocils mDemu s;t4alxnxociotop  li o;s trto(m3oo1lpenlnvtatfs2tru poo1aeto oeiyt s elnvo u4 etnxfcia1fm raivsls0 rxm(opnu1lp nlivilsfa2rr(monu4texomfeils sDrmu o;u4tlxrxo iotfaD  i ol()t2xmxr3nydaptelict s) Dtr(rooo1tleomfeiyt m rlnvpn(0aexomfcoydfp  aies s  rtrxmpio4aptnmncslt sDtm(mpnu1oeenmfcils s2ra(vo ()tleomfctytlp rlivs;(  2toxopoydap  lfcil(f Dtrxrpno1oexnmf3iad m2ra(vs ()aexoxo3tatfa  anvs;t)teto(mpou1ll nlnesl(f 2ur( p;o0alenmfetydlm2eaums;(4arermfcoadopDe u s;t0srxmiopoydlptn fvi ( sDtmx  ;o4tleomociadfm em( o t) rxnmf3oodomDraueols0 ruoim3io4opee feia()aDua(m no0tpt mietas sDeanvs (0 rtrxf ta1lmt  i i ( s2tmxm no1lpeelivtat)srur( pot1texo fciasfaDeauvs (0alenmociydlmD ai o ( texoxr3oydlme lies ()s2tr(m ou4aeeomf3ildfa rmuvs;u0trtoif iadfateaneils0srtm(opou4ol elfcsl(  Duau  ;t4tpt mi3iytfaDelumo;t0aeeoxo3totomt ai ols) 2tmiopiy1lm e fcsa(fa2tm(r ot0oex  ictyd a2umu o u)trtomo3oytlpt au i;(0trtrxrpiodamte fetls) rta(moot0oee mietld s emuvpnu)teeoiocoy1om ranvi;s)setmxm3ou1ape licslt)srrr(  ;t4altnioctasls2eluvs;(4 reoxr3iy1laDrlu s s tetm(o3oodlleemivi s sDrr( pnu1ape mf3tltfmDua(vsnt0tleoxo ty1lpDe uvi;( texr(m oo1lm  lfei s) 2taxr nu1tex mictytfmDem( o;u4aeermfcia1lpteauvi;s0 rtm(m io1om e ictlsfaDtaumpno0tetoio3tydls2elu onu)aexrxocoodlptrluvslt0teto(rpnu1lpt lnvt t)arum(ronu0apx if3iatfa rln p (0arxnmo todopD auvslt  rtrxopnodaltnmfesas)a2rmumo;o1aex  o3tls a ulu o;(0altnxf oydlpD ln i (  rxoxmpoudomt lict s)arrax pnt4tleomoeiltla ra(vp;(4aetrmr3tatoaDrauvo;()teuo(m iy4am e ivsa()arur(ro;u4tleo o3tld aDua(vpnt)arermrcoy1latraueolt0srtmxm no4aptelfes t  2tmxr nt4tpxnio3iysfa ea(mpnt) rerir oydlate n s;() 2umio3oo1lpenmicsatf rrrxmont4alt moeiadla ra(mo (4aexnio io1om r i s s t2to(o3ou4ap nmict s) rtaumpou0tpxn iciltfm2rmuvonu)teeoif3iydfp   nes t sexrirpoydll  lfeil(fa2rr( o;o1aptnifciyd mDum( o;t0 etrxociatfm   nvslt) eumim3nu1lmtnmiciat)s2trumo;o1optn fetydfa umn o;u)arxoirctodfaDr uvol()sexrxr oo1lm nlfvtls a2rrxm nt0aetnmo3iaslsDelnmp;t4trxoioctatlmtr ivsls srxoio3ny1ap  mivsasf Dur(  ;t4aexn feiydfsDrl(vo u4areoiocoy1fmD aiesl( setmim no4ame lnvs t s2rmxm ;o4opt  oeiaslaDrauvonu4tlxoxrcootlmte nvi;s t2to(rpnu1lp e fvs (farrr(ro;o4texo f3iatfm um(ms ()texrmf3oatfp  anvo t0 2xrirpou4ole livt s)srtmxm ;o4aeenmi3tld m2rmn s;() lxnif3iy1fpD lneols)s2uo(o no4ameemnvia( sDtm(  nt0apt mfei
\ No newline at end of file
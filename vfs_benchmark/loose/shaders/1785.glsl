@@ -0,0 +1 @@
+nvolt) 2to(m ny4op nmicias sDumxr nu1tle iieiasfsDrmuvsnt4 renio ta1opt au olt)texo(o ou4ol  lfvs sfa2um( p;t0opxo i3iat a um( pn(0tetnioctadfpD  neo s) 2tmxrpny4lp emiei tf 2um(  no1oltnmoetadfm ul(vpnu4 leomr oa1opDe i s;s)sexrio3iy1optn ivtltfartr(m ot1alxoiiciatla2um(vsnu)tetrmo3iotfa  lieo;t srxoxm oy1opt  ietlt)artrxrp;o4aleniociyd a2ulnvs;(4 etrmo3tytfm rliei t) 2xo(opio4llee iei s)arrrx o;t0tpeo oetasla ul( snu4 ltrircto1lat aivs t) 2xmxmpoodalen ictltf rrm(  ;t0tpe  o3tydfsDea(ms;(0altrmf3io1lmD aieo s0s2xrxrpiydam e ietlt)aDurum nu0tpxoioctyslm2rm(vs (0artnxrcootomt  ieil(0 2urxrpno1lmt  nvsat)arta( ont4olto iciltls eau snt) rtoxrcoytlpDe ues;t0setrimpiy1amte icta( a2trur ou1texo i3tydls umnmont4areomr tadlaDrauvsl()trtoxm iu1al nliei ( a2ur(  nu1tetoioeiltlm ul( s;(0tlxrirciatop   i o t s2tm(r3iydllt  nctat  Draumpou1ope iocilt mDul(mpnu0tlenxf iadfp r nvils0sexmiopiy4optemici sf Drrxm ou1tetnmfeild s ra(mpnu)arxrxr iatop e uei s)s2tm(m nu1oltn iei sf 2tmx o;u0altomo3iatfm2umuvon()tlenmr tatoa eau o () rtoxr no1lle lncsl(faDtrx poo4alto i3iys s2rluvo;t)tltrxfcoydfm rlneo s) rxrxr3ou1al elnet ()s2trxrpot4texoii3tysla2emu pnt)trtnifctadfaDe nei t  rtrimpny1lpe lics tfsDraxm ou4aptnmo3iadfm2rlums u4 lxomr3oo1fmD an s t0t2uoirpoy4lp e fvil(  rum(rooo0aeeo f3iasfm rlnmp u0arxrio3oy1fmDrli i t  euo(r oo4om  micsa(fs2urxrp;t1oltnioctlt a2uau snu4 exoxo oytla   n i () exoiopiydame  fet sfsDua(mpoo1teeomoetld a eluvo;()trtnir ootfmtr uvs t) exmxm nu4amenmivt sf rra(root4aleoif3iltlaDrmump;t0 etoxo3ta1latelues;s  euoio3no4op emfvslt)sDuaurp;u4oeen ietyd m2um(ms;u4artoirctotfm   neo s)srtrirpoydll elies (faDrmx  nu0oltnio3iat sDeau pnt0 leomo to1la rli sls)sexrxm nu1olenlfci sfartruront4aeeoiociatfa rm(msn()trxrmfciy1fm eli o (0 2uoim no1lpte nci s  2taxronu4opxn f3tld mDemuvs;(0trxoio3oadoa eaivs;s  exo(o3iy4omtemnviltf rum(m ou1olx  f3iyslmDrluvo;u4tetoif oatopDr nes ( srurxo3nodllt mfvt t)s2rr( p;o1tlxo fciydfsDua(ms;u0tlxnio to1fpDe u i;t)srtoirpny1optnliviat) 2tmur ou4aeeo oeiyt sDumnvp u4tleoifcoodlatrau i t  2xoxm iy4ol n fesls  2taurpno4aeeo oetytlmDul(monu0trermr3tadlp raivs;()sexm(mpnydlmee ivtl(  2ua(r no0aleomfeiasfaDum( snt4 lxomfcoydfp eau il()srtrxm3oydameelnviatfsDta(ro;u4tpeo i3iasfs2rlnmsnu0 renxr oodom r n i (  2tmim3nydlmeelfcs tfaDra(r ;u4oeen i3tldlsDul(vs u4 rxnxfctodfa eai i;t tetoiopiu1lpe mivi () rtmx  ;o1tet mieiydfmDeluvp;t4texomf iodoa e nvi;t0 rumxm3io4om e ictas s2rmu  ;o4olx  oeias s2ul( o t4 ltnmo3oy1lat lu ol(  rurimpoudllen neil(fsruru  ot0aleoioetasfaDrm(monu0alerir3tydopt  ivo t0setr(mpou4alt lici ( srtr( o;t4tpxo ieiat m uluvpnu4 reoxr iotopte ivo;() 2xmxo3no4optnlicia(f Drru  no0teeoiietld m2umu o;t4texriocoo1om  auvs;s  rtoio ou1lptnmncs ( s2raump;t0texnmfciydfaDuln o (0 etoiociodoat aivi ( t2xm(o oy1llee ici t sDumxm ou0oee iieilsfmDeaumo;() rxomfctadlptrliei s) rxoio iy4ol emfvt sfsrrmxmpnt0apenmi3ilt s uauvo;t4treniociatlmtranei t) rxrim nu4lmtelici () 2ta( oot1alen ietasfm rlnmonu)aeenmo oydom raivs;s) exoxo3oo4lmtnlfeilt) Dtrxm ot4optnif3tld aDuauvp u4texnmr3totfaDeln i;t trto(o nu4omen nesl(farur(rpno4alto feildlsDulnmo t4altrxo totopt aiei;(0trur(m oo4amt livsl( arua(rpno4openiociyslaDemnvo;t0 lxrmo ta1op   uvol()s2xr(r iy4lpeelnei (farraxmp;u0tpenmieiasla2ranvp;t4areoxo ia1lpte n s;(0 2uoxm iodlpe  nvilt)sDrmxmpou1tleoiociys m el(vp;t4aleoif3ta1omt  neils0texo(mpoo1ale mfvs sfarta(  oo0aleomfeiyt m2rluvo t) exnmr3oa1fp r u s t trtr(r oo1lmeelivt () Dua( ono0ape moeiat s eauvon()artrmrcoadom raivsls s2urxo3iu4lleemfeiasf Drmur no0tpt mi3tatfs um( p;u4altnifcoatlpD anvols)t2xmxr oy4al n ictat)sDtr( o;o1apxoiiciadfs rlu p;(0trxnmr3oydlatraieil(0sexr(o3iu4lm elnesls) rum(r ou0tetnifcias m2raumo;t) leoxf oatoatr ivi;()srtmim3iu1om  mfes (  2um( p;t4tex mociyt m ea(mp;(4trxoxo3tydop r n ols0setrxopoo4apt mieilsfa2tmx o;u4apeo ieiysfa2eanvo;(4texomoctadla eaivo t0s2tr(mpnodllen ivsat) Drr(m nu4tltnif3tydlsDul(mpnu4 reomo ia1om raies t srtm(mpoydlm e nvi sfsDtaxr nt0oexnmieiysls2eaumsn()trtoxo oydfaD aivil()trxrir nu4optn ict s) Draxr nu4aexoifcilt s ulnmsnu) rtrxr ia1lm r ieo;s)sexo(m iy1ale mncta(  rrau poo1tpxn fciys m2rlnvs;t0alermfcoatfaD livsl(0setoim nu4lm nmnvsls  rrrurpnt4alt iiciys sDelumo;t0 rxnifciy1lpt lies;(0setr(m3iydlptelieia( aruax  nu1oeenmo3tltfm2rlnvp t0trtrmrciodoat lnvi;()t2umimpio1op n fetlt  ruau pou0tpxnmoeiadfs2ua( pnt0teermfciatoa elieo;s seur(m3iu4lpe mnvslsfa2tr(mp;t0optomi3ilt m2eaumo;u0aeenifcoydopDr nvo t)t2uriopny1ameelietlt  Dumx pnu4ole if3ils m ua(mp u4aexnxfcty1fp r uei;s)teumim3no4am e nvtat)arrau pno0tpen fctltls emnmsn(4alxnioctytfaDr u s t0teumir io4om e ncsa()srumx p;o1tlen o3iat m2eanmo;t4areniocta1fmDelivs () rto(o oudlpeelieil()s2rm(m ot0aetnmfciysla2eanmo u0 lenmf3oa1fpDeau ilt s2xoxo nu1lmeelicsa(fa2uax p;t1aeeo i3tytlaDumuvo u0aetomociotfp e uei s tetrxmpnudlm  lnei t a2ra(  oo1oet ifeild mDum( pnu4 exoxo3iytlat  ueol(0t2tmim iydopte feiat) Dumxm nt0optniieiyt s emums;t0tetomo3to1lpDelu o;t0t2uoxo3io1ole lnet s srra(  no4opxomietys a emnvp t0alermfcoa1fateaies;( teurxm3io1open fvtls)sruaxmo;o4aeenifeiad sDum( snt0tltoioctodla  luvo;t)s2umiopnu4lm   nci (f rtau pnu0oeeo ieiadlm eaump u4aexrir3iy1faDr uvo (0 2uriopnu1op e nvs s  2tmxm ou4tpxomf3ias m ulnvs u)aetniociydoptr neol(  ruo(o iu1alt  fcta(fsrtaum oo0tpx  iciadfaDeanvs;t4 etnxfcto1oa  an s;t)tetmimpiu4omenlivs tfsrtr(rpnt4aetomi3tlt m ul(mp (0trtrxo3oy1fmtr i slt t2urxmpnu1llt mnvsas a2raxrpoo0optnmo3iat aDrluvpnt0tltnxf tatfpt an slt0 rxrio iu4ap emfvtat)s2tax  ;t1tle ioeiytfs2rl( o t4 rxoircoodlpDrlieols  eurxo3iu1lmtn feiatfs2ur(  no1oltnio3tys a2ea(mo (4texrmocoa1oaD  ueil( s2tr(opoo4amee ncs (fa2ur(rp;t0aee iieiaslaDrauvp;t4aexomo io1fm eauvslt) eurxrpou1al nmnetatfaDtr(m oo1aptn ieiltfm em(mpnu4aetnir to1omtelu i t0t2urir3nydame  ieil( arur(m ot4oeenio3iasfa2ea( o;(0arerif oodoptrlnvol() rxoir nu4lm nlnctls artm(r ou0openio3ild m rmnvs;u4altrmfcoy1laD anei t s2xrxm io1olee ncsls) rtrumono1oeenifeilslaDem(mp;u0altoir3ia1opte ues t0srumxmpiu1lpt mncsat aDrrxmpou0tetn ictytlm eanvpn()altoifcty1fmDe u ils0t2urir iu4llenlivtlsfartm(m no4opeomieiatfaDel(vont) etoxf3iydfa e ivs;t trurimpoo4altn fcsl(faDum( pnt1openmf3iytfm umuvo u0tltrmo3ty1oa r ies t trxrim3oo4altnlnciatfaDurx  nt1apt mi3iydfs ulnmonu0texnir todfatr n i t sexr(m iu1op nmnesa()sDtrurpnu0tptnifeiasla2uanmont0 rerircootlm eaueol()srumim3ny1ll nmict s  2ur(mp;o0olxomf3iasls raumo (0teeomf ta1lmD lueils  etm(m3nudamtnlfciatfsDuaump;u1altoif3iltfa2ua(mp;u4trtnxr oo1lp rauei;s0sexrirpoudlmtelnctl(fsrua(mpno0tlxoiieiysfaDulnmp (0 lerif3totfp raneils srxoxo oo4lpe mnvsls)arurxm nu4oetn ieiatlm emn o;u4texrmrcoa1late nvo;(  etr(mpoo1lm   iesl(  2uaxmoou0tetnmo3ias s2uau s t)tltnmf iodomD lnes t sexo(r oy4lpt  netltfa2rm(r ou0aee ioctadlm ua( o;(4trenxo to1lm  li il( trxoxopiy4om e fct sfs2ur(r ot4opxomfeiytfmDul(vont4trxrxfcty1fa eai i t0sexo(o iy4ap elfvil(fa2rmxm ;u1altoif3ilsfaDumnvs t) ltrircio1oaDrlneo t)t2xmir3iy4om nmneslsf rrmumpot0apxn ieiytlm eln pn()arxrmr oa1op   u s;t seto(opny1llte ieia(fs2rmxm ;t0optoii3tltla eanmo;t) etrmf tadfp eau i t)trtrirpiudam nlivias sruaum nt1tee mictad m rmuvsnu0aeermr tydlmDeanvs;( s2xmxopoydam  livtls) 2umur ;u1tetomf3iadfsDumnms;t4 etnxfcoytfmDr n ols tetoxm3nu4om elneilt  Draumpot1opeo i3tytfa2ean p;t)altnxo3ta1fatran s;t)srxo(r oy4apte fvs t)s2umu  ou4opxoioeiad m rauvp;t0 ltomf oytfa e ieo t)srxrirpnu1ap elivi t srtrxm nt0optnifctldfm2ul(mp;()tlenmrcta1fa r iesls)trtmxm nudlpe mies tf 2urx  ou1oet  ieiaslmDranms;u4aetrxf oatfaDelu slt0t2trxo3nu4lltnlics () Dtrxm ;o4opto iciyt m2umu ont0 lenxrctodfp  auvs;s) rtr(r oo1omenlnes ( arrr( pou4texoioetldla rm(ms;() eenio ia1fa r ieo (  rum(m iy4al n feia()sDrmx o;t1oleomiciadfs emu s u0 rxrmr3tydomt lneilt  2xrim iodal nlnetatfsrumurpnt1tptniiciysla uan p (4aeenmr3iotomtrauvi s)s2umxopiu4lmeemfcia( s2uru ono1oexo ieiad m ranvo;t)altrxf3ta1oa rliei t0s2toxopiu4ap  mictlsfsrrrxmpoo4olt mfeild a2emu on(0 leomf tytoptr i ilt)srurxo3oudap e fvilt)sDum(ro;t1aetn o3iysfsDrmums;t0tetnmfctatfm  luvils  etoimpoo1optemnvsls)a2rm(  nt0apxomociytla2um(ms (0tlxrmrcta1lmDe i ol( setoxmpnodomenlncias)aDraumpot0apenmiciytfm eluvp t0tetomf oytlpDr n o (  ruo(mpnydlp n fvs t) rtrump;t4aptnii3ils s emnvs;u4aeenxf3tytlat luesls)truoir3iu1apeelici () 2umx p;u4olenmieilt aDuau o t4trtrxr3iodfpt  i s;t) rtmimpio1lpt  ictlt a2ra(m ;u0alt mo3iad m2ua( onu)alerxr3iotopt luvols0srum(r nu1lp  lncia(fsDtru pno4texnmi3tydfaDumnvsnu) eeoio3tytop elueslt0 2toxm3no4ap elicil(f rrmumpnu1opxo oeiytfa rauvpn()texrmf ia1fmDe ieolt)setmir3oy1ole  ivil() 2ta( o;u4apx mieiydls2rl( on(4 eenmr3ia1omDe ues s0sruo(opny4am nlnesl() Drmxmpnt1ope mieiadfm uanmo ()aexrxr3oytoa eli olt) 2to(r3nodlpenmnctlt a2uau  ;t1aeeo i3ilt sDea(vo;u0artrxf iadfaD livi s t2tm(o no4lm n icsa( artr(rpnt4olx  octltls rlumsnu4arenxo3oo1omtrluesls0 2xr(r ny4apte nesltfsDurxr ;t1oee  oeildfmDuan pnu) lenmo3iydfpD  nvi t)s2xr(opno1lm  liei (f rra(r nu1opeoio3iat a uaums t4tltoxrcoo1oa ranvols0s2xo(m3nydlle lncta() Dtmu oot1alxniiciytlaDumnvs u4 ltrxf3tydopt aueilt) 2xr(opnydlle livsls)s2tax  ou1ale mf3ilsfs2ulnms;u)tlxnxocia1fa   nvols) 2uoxmpiu1optn nvi tfaDrm( poo1alxn f3tydlsDrm(mp;u0tetrio iotopDeai o;s)trurimpiu4ol nmfcs t arurx oou0oexoifeildlm elumsnt4aexrircto1lmD auvs t) 2uoxr3oo1olt lict ()sruaumooo0olxo fcilt aDumumo;() eerxfcoadfpDeanesl( trtoxr3nu4am e nei sfsDtmx ooo0alxomfetlsfs2em(mpnu4 exoio3ootlm e n ils) rtrio3iodll  mfvs t  2tr(rono1tpeoii3tytla2el( onu)treoxfcoodfp eai o;t  rxoxm3iy4amtn fet ( s2urx  oo1tle  ietysfm rluvpnu)teenmf3iodoat  u o t) etmimpoo1op emfvtat)a2tr(mont0opx  ociatfm2um(vs;u0artoircoo1lp rau slt  2tmxm3no4lptnmfetas)s2raxm ;u4ale  f3ild s2rl( o (4tlenmo io1oaDe ivi;( texo(o nudlpte fcta( aDrmur nu0aexnmietltlsDrm(vonu) lerif iydfa raueo;(0truo(opou4alenmnvt s a2rmx  ;u1apxn ietlt m2ranmp t)altnircoa1op r uvo;s)srxr(o iu1omte ietat) 2um( ono0aex mfciatfm2rmnmo;u)altrxrcootfa rlneols)truoim3no1llen ivs () 2rrumo;o1apx  iciad m raump ()alermocoodlp r ieils)trxr(m nudoltnlieiat)srrmxmpnu1aleoifetltls rl( pnu0 rtomrcoadoatran s;()trumim3nu4al nmfci sfsDraurpnu1texoioetld mDrmuvo;(0altnif3iy1optr nvils0 2xoio iu1lmt mivslsf 2taxmont1aetn ociasfa rln onu0aexrif3iotlmDean ols)srumir ny4amtelivi (faDumumooo0alxn oeiydfm2umu s t0areoio3oo1omDrlnvi t)setmirpiudom elnct (f Dtmxm ;t1olenmiciad s ranvsnu)alenirciodfm r i i;()s2xmxr ny1llen fvsas artmumono4tet iictlt m uaums;(4altnmf3oo1lpte nesl(0setoio3ny4op nmnvilsf Dum(mpou4aleoif3tltfaDra(mp;t) ltoxf3oydlm   iei;t sexr(rpiodlleemnesat) Dtmum ;t1olenii3iydfs ua(mo;()tltrmf todoa  auvo;t0 exr(m3io4lpt  fcsls)s2umu o;t1tex mfciys mDrl(vo u0trenir3iydla ean olt)tetrxr3oodal nmncia()sruaxronu1tpeo fetyt m rmu o;u0trtoxrciadlm elnvi (0 2trxrpnodll   neils)sDtrur no4tpxn oeiytls uln snt4 ltrmo3oy1lmtr nei;s  rtrxmpiu4lmen fvsa(fs2umxmp;o1oltomf3ilt s um(vp (0trermrciatla  lnvi;s)s2umiopoodopt  feiat)artmurono0apxoii3tydlsDrl(ms (4 rxrxo ty1om eauvs t0sexoim iy1lm  micil(  2ta( p;o4tpe mfcias m2ra(mo t0tetomf oadlp   nvo;t)tetr(rpno1om  mnes sf Dumx oot1oleomf3ils s ul(vs t4texomocoa1fm e nes t s2xmirpiudlpt lfct ( s2umumo;t1tpx if3iadla eluvon() rxrxocio1optr nvo (0tetoio3iy1op  mnviat  Drmxmono0texnmfcild sDemu s (4 rxriocia1lmDe n il() 2ur(m3nu4apee fvta( a2um( p;u0teenmo3tat m uau p;()teenmo3oydomD ln slt trtrxm3iy1al nlivtat artm(ro;u1olxn feils a elnmo;(4texoxociytlpteau slt srtr(opiy4altnlnct t artr(  nt1opt ifeiltfs rl(mp t0trtoio3iodlptelivo;s0seur(m iu1amtnmfvi sf Dtr(m oo0optnifciys a emnvp;t0aleoxf oy1oatrlu il() rtr(rpnydom   netlt a2rrumpou4apx  oetls a elnmo (0trtoif3iydfpDraiei;s0s2trir3oydape lfvta(fsrrmxro;o0oexo feils a ra( pnt)arxoifciatla e n ils)t2toirpnodap e ietlsf rtaurooo4oetn ociys m2emn sn()teeoxf iotfmD  ivolt  2umim iy1ll nlicil( sDrr(r ;u4opxnmoetytlm eau s (0artoiociotfaD lieo;t)srxrio oy4lleemictlt)aDrmur nu4tpxo o3ilt a2el( p;t0 rxnxocoatfpt ln ol(  rtriopnodapenlncilsfaDra(roou4tlx ifeiltfa2eln p (0tlerif oy1fpt  nes;s0 2umxrpiudlm e iesl()a2ururpnt4teeoiiciad mDemuvpnu4aexrir ia1fptrln o s seuoirpnydlpe mfvi s aDua(r nu0opeo ociys sDeanvp t0altnxr oytfmt aivi;t s2toio nydom emfvtls sDtmxr ot1tetnifeiatlm2ra(ms;t) etnifcoytoaD an slt)teuo(o3no4ome mivi s) 2trxront0tpeoifetad a ua(mo t) exrio3tytlp elueols)seto(r3oodlptn fvil( sDtmxmpnu1aee if3tytfa2uanvsn(0aetoxr ty1lmD auvs ( trumxm ou4opt liesat aDur(r ;o4opeoiiciasls rlnvsnt0tlerxociytop rluei ( seum(o3iu4lmtn ivs s) rrrum ot1tetniictaslaDem(vpn(0aeenmo3tatoatelnes t0 eur(opiodlm  mfciasf Dumxmo;t0apx mi3iydlaDemuvs;()trxnir3iotlpte n i (0 rtrxm3iudalte ivil( srrrxmpou0teeoif3ildlsDeanvs (4 leoio iatfm   ues;s teum(r3iydop eliet sf ruau p;u1aleomfeilt m emumo () ltnir3ty1lmDeaieilt s2trirpnu1amen iet tfs2rrxmpnt1tpenmi3ilsla rmnmp u0aexrir3iadopte uvo (  exmio oo1lm nlneiltfaDrmurpnt0aexnioetlsls2ulu pnt0alenmo3todomt lnvi;t0texm(o3oydomte fviat) 2rmu pno4aet ifciadfa2uaumont)artrxo3to1op eai sl(0t2urxrpiudom elies s)arrmxmo;u0aeenmf3tatfaDel( s u)tlenmr3tatfm e nei;t)t2xo(m3iy4altnmietltfsDrau poo0tlt  f3tlslm2emnvpn(0tlenio oytlp rli olt0 rur(r3iydopenlfei s) Dtau  nu4tptnioctasfm2rmu p;u4 lxoxf3oydlaDr neolt) etr(opiu4opt  netl() 2umurpnu0teeomo3iltlmDrl( o;()teenmo iy1lm ran s () rxr(m3oydaltnlictlt)srta( o;t4tltnmfeiasfaDelumsnt4tlenxfcty1omDelnvo;t)seuoimpiudol n icilt artmump;o4aleoifcilsls2eln snt0trxrxocty1laD li s t0 2xoirpiu4olt mnvils) 2raurooo0teenmfeild m elumo u4tltomrciadfaD li o (  2ur(o3ou4llte fcils  Duaxrp;t0oltniiciasfs2rlnmsnt0 eermocoytlpt  u i;( truo(mpiy1lltelfvs s) 2ua(  nu0olx if3ils a el(mpnu0aexomf oydoptrln s;s  exriopou1lmeelfctat) rrmumpoo4opeomociyd s rmumsnt)tltomr3tydfptranes;()t2tmio3oydamenlieils)aruru ooo0tleomfetaslm2eln p;u0teeomociy1om ean sl(  rurim iu4llenlneilt sDur(monu4tleo o3tydfsDrl(vo u)tlenxfcty1op  anvo;t)t2xmim iu1omeemicta(faDrax  nu1optn i3iad m umu p (4 rxrmo3ootfate n o;(  2tmio3iodolt  ivs t)aDrmumpoo0ope  i3tyd m2ulnmont)arxomr3oo1omte nvs;s)teumxr3ny4lmeelneslt)aDrr( ont1oee iieiyt aDrm(vp t)areoxrcoytfptraivsl()tetoxo ny4amen fcs () Dtmurpou1oetn ocilslaDeanmp;t0aetrmf ootfmD anvi s teum(o ou1ol  mnet (f Drr(rp;o1aeenmieiadfs2rlnmo;u0tltnxo3oodlaDr u i;s  ruoxm3iy1lltnlietltf Dur( o;o0teeo fciltls rl( snu0aleoio ta1late ieolt) exmimpiu1ap n nei t  rrrxr no1apxomocilt mDulumo (0 renmo iy1lpD  u ils0 eum(r3nu4opee icslt)s2umxmo;u4texomf3iasls2ulu o;t) rtoxr oatopt aiei;(0 rumxr oydap  mnvsls s2ra(moot0tlenmfciyslsDum(msnt4tetrmr3oadla   u o;( trumxmpnodlptnlnviasf Dum(  ou4tlx mociytla2uaumpnu)aexrif tadfa eaneils  2xo(r nodap  mieiat aDrrxr ot1altoifeiys s umump;t4 rxrio iadfp rlnvi;t0srxrxrpnydap elnvtls)s2rrxronu0tpt ioetld m2rl(msnt4arerxo to1fpDr nvo s) rtmirpoudlmt  fviat)s2uru ooo1oexoiicils sDel(vonu) reoxf iy1laDeai o s sexrxm no1lptelicsat)s2tru ont0tptoifciatfs2ul(monu4aexnxo tadfaD anvs (0 etmim iu1al  lfcs ()a2raxm ;u1opxn oetyd s ra(vs u4teenxo3iotfp rlies (0s2xoxrpoydol nlieils aDrrxmo;o1olt iietydfa ua(vp (0 rtomr oo1laDeanvi;t)t2um(rpio1lm  mfvi sfartruroot1tleoif3tadla ulu p ()alxoxf oo1fpt  ieolt0s2tm(rpnydlp  mfct t)srtaumooo0apx ifeildfmDrl( p u)texrmf oa1opteaivo t) 2ur(r oy4omenliciltfarrmxmo;o4aleo ociasfa2um(msnu)alxrxo oatfmD ln o;t0s2tmim ny4opt  neias)a2rmxr ;o0texo icilsfm2rluvo ()trtoxoctadopDrlnvolt)s2xm(o3nu1amt mivsl(fa2ta( oot1oltoifeiysla em(vo;t0texriocoy1oateliei t) exo(rpny4lpeelnvta( aDumu p;t1tpt ii3tad sDuanvp;t4 etrio oatopte neil(  euoxr3no1al elneilt  rrm(mp;t0opx mieiltfa2emuvs;()treomr ia1lpDe uvs;s  2xmxmpio4aptemivsa( s2tm(rp;t4tltnmieilsla2rlums (0 leoirciodop eluvilt  rxrxrpnu1al emfcslsfsDtrxrooo0opx iociat m2uan o ()tltnxr tydopD  ivi t)trurxm io1am   ici (f Dtruroou1ale  ietydlaDuln p t0 lxrif iy1omtraiei;s)s2uoir iu4omen feilsfs2ta(m ou4altnif3iatls2rmn o;() lenxrcia1fmte nesl( t2tr(mpno4ol nmncs () 2ur( p;u1aeenifeiyd m2emuvp;(4arxrif oytoatrlnes s0 rxmxm3oy1llee ivta(farraxrpno4aetnmociadlmDrm(mp ()aleomf3iydomD livo s0trtm(rpno1op nliesa( aDraxr oo0aleomoctat mDeaumo;t4alenmocoodoaDr ivils sexmxo3iu4am   fcs t) 2uaurpno1tlxomieiltfm2elnmsnt4tetomfcoy1fmDr u o s seuo(m3nudapt  fcta( sDrr(rp;t1tex  i3tydfm ul(vp t)teenircoy1lat ln il()s2um(r io4amen fvt (fs2urx poo4tptnmietatla2um( pn(4artnmo ootoatean i t srur(m3nodlmtn nvsa(  Dtm(rooo1teen o3iydls el(mp;u4trxoio3ty1omDelivo t  etrirpnu4oltelfvsl() rtm(root1texo ociatfs eauvsn(0tltoxr3iytfaDelnei (0 exoxm nydlptn neslt)sDrrx p;o4oex mfetaslm el(vs u0treoiocio1opD ai s;() rtmxmpoy1olenlictls)sDraumoot4apeo o3iad aDuanms;() lxrxr3iytlaD luvs;s0srtr(o ny1ol  lnei t sDurur nt4tltoiieiys sDrluvont) ltrmo oadom   i i t) exoio3no4lm nmncs s) ruru oou0apt ioeiydls umnvonu)aeenxoctydfpD aieo t0texr(m3nu1ll nmfvtls)aDra(rooo0tpx iociasls uanmo;u0 ltnmociodoaDeliei t0teuo(m3nodlpenmict ()aDrm(monu4aex moctydfa2eln snu)tleomr oydfaDe i s;s0 rxriopnu1ll   fesat srrrxm ;u0aptoifciyt m ulnvo;(0 rerir oo1faDrauvo ()trxr(rpnu4omt  neiat sDumxrpnt4tpto i3ildlsDulnvs t0 etomf3oy1fa  lnvo;()sexrxo3no1lmeemfvil()aDta(ro;u1ape mf3iaslaDumnvonu0trtnioctodoateaneo s sruo(rpoy1ame lnei t sDurxr ou4aeeomociatla uln s t4tlxnmrctytlmDraivo;()truoir iu4al  mnetl()aDraurpnt4tlx ii3iyslsDulnmsnu0 etnxo3ty1op r neils) 2trxmpiodlpt  nvtltf 2rm(mo;u0tpxomfciytla2um(mo;() rxnxfciy1lp eaueo ( srxoiopiydap n ieils)aDra(ro;t4oeto fcils a elnmp (0texomo3ootlate u il(0trxmxr3oo1lptemnetltfs2umxmo;o0tlx mictlsfm2rm(vpnt0 lxrio iadfa   u o;( seurim oy4lltemfei tf 2ra(mp;u0aetoifciltfa2rm( s t0arxrif3iodlpDeaivol()teurxrpiu4amtnlfvsas  2ra(m nt0aeenmi3tatfmDem( pnu0trtrir3ty1lm e u o () exmxo oydape mieils a2ua(ro;u4teen iciytlm ean pnu0alenifcoa1lmDrau o;s t2tmxopnodapt  ivsls)aDrr(ront1oee  fctytfmDelumpnu4 exnxf oa1lmDrlivs;s0setmir3nu4ol  lfesl()aDta( pno4opx mi3ils m el( s;u) exrmociotoaDr n il( setoxo3nu4ap elfvsa( aDrru  ;u1olxnmfetydfm ul(vp;t) etrmo tadfpDe nvo (0sexm(m3ou4am  mfet tfarrmu o;o4tlto ietlsfsDuln p;t)aleoxf3io1fpDrliei t) rxo(opiydal emiei ( srrau oou0openmicilsls2eln s;u4trtomf to1oaDrli o;s  etmimpnu1lltemfcilt)s2um( o;u1ole io3taslm rlnvsnt4tetnio oadlm r iei ( t2tmir ou1llee fciat) Dum( o;o0apeomfctyd a ran s;u)aexnmoctatlm  li i s0trtrxo ou4lpt miesa()srrr(mpnt1tetnmocilt s2raumonu4aleoxocto1lp raies (  rto(opoudllenlneilsf Dta(m ;t4olxoiiciadlaDelnmo;t4 lxomf3iatfaD auvols srtrio3io1ol  mfctl() 2rrxmo;u0teeomi3iadls2rmnvp t4tlxoir3oydlatr i o t srxr(r3oydlp  mneil() rtr(mpnt0aptn feildfmDelnvsnt) lxrirctatfp e nes t  2trimpou1lme lfeias) 2ta(roou0teeoii3iydlmDelnmont) leoxrciatfaDe n o s srumxr3iydale lncsatfs2rr(r no1tpxo fctatlm2rmn o u) rtnxrctodoaD li s;(0 2ur(m3ou4amt  nct s)a2tr(mpnu1apeo fctls a ul( p t0trxnxr iodfpteaivs ( teto(r3nu4lle mictltf rua(rpoo4aet moctatls2rmumo;u4 renmr iytoatrluvo t)truoxm nydolt  ncslt arta( pno0alx mi3ildfmDelnmp;u) etomr3ta1oa  aivolt setoiopiydame  ieilt  2truro;u0oetn o3ilsfa2emuvp;(0alxnmfctydlat lu il()texoio oo1lptnmivsls)sDrrum nu0aeeoifetltlm eau s;t4arerxrcoytoa rai s t) rxoxm oydop elfesl( aDrrurpou4olxniieils sDra( ont4 leoirciatfm elu s;t  rurimpoudom  mnetatfaDumu p;t0tlto fciltfm uln p;u)tlxnxo oo1fm  livs t srxm(mpnodole  ncs s) rrm(mo;u1alxn f3iltlsDra( p;u4alxrir3iatlmtranvslt trtmxrpnodlm nmfesas  rurxrono1opeo octlslm rmu p t0altoxo oo1fp r uei;t  euo(o nudop emnctasfs2taxrpot1aexn ictadfaDranms t0treomf oodlmt lu il( teurxrpio4apeelfctlt)sDrax pot1oeeoioeiyt a2rm(mont)alxrmo3oa1fatrai sls0 rxmxmpnydolte nctlt sDtrxr oo1alt ii3ilsfa2eluvo t0aexnxr3oatomDraueilt) rtrimpiodlm  lnet tfsDumxro;o0aetnmicildlmDuau p;()teerxrctydfmD  ueo s0 etmxm3oodom  mict s srua(m ;u4apxnii3tas aDrl( p t) eeomr3oo1fpteaieols  2uoxo nudal   neils)srtm(  nt1tle mf3tat s rluvp;(0 etrmr oytlaDeai i;( seumio3iudal e nvtas)sDrr(roou0olt ii3iydla rluvo;(4aetrxocoy1fp   neo t)sexm(m3io4al   fetas s2rmx oot4tpxomi3tat s2em(vs t0aleoxrciodlp raivi;(  rurxrpny1ol n neilt) rrax pno4alxo ocild sDumuvs;()alxnmr3oatoa eai ols)trxmiopoydolen fviat aDrrx  ot1teenifeiyt s rl( s;t0teeoxo oytlm elues;s0trxo(o nu4alee fvi ()s2ra(ro;o1oee  oetldfm2umumo;t0 lxoir3iatom  lueol( tetmxopoo4alen fcias  Dtmxmpou1aexn oeilt m2umnmpnu0aetnmf iydfpt ln i s0seuoxm3iu4omtnmivsl(farum( pou1openifeiytlaDrauvpn()tlxrmo iydlm  li i;s)sexm(o no1altnmfcslt)srtm(  no4apenmfctltfa2rlumo (4 eeoxf iydfpDeli ol(  rxmir nodlpee feslt artm(mo;o1aet io3iydlsDuauvo;u)teermf ty1omDeau s;t)tetmirpiy4op   nes (faruaxmo;u1olx  fctat mDem(mpnt4 rxnmrctodoa r uvo;( trtmxo ny1lltelicslt  rtaumpoo0tpeo fciyt mDulnms () rtnxfcoy1omtraneo s0setoxo3oo1lme  nctl()a2rmurpno4tpeoif3ilt mDrl( snu0alerif tatla  lieilt0 ruo(opoodlmtemnvils  2taxro;t1ole  feiatla2rlu s;t4 lxoircoo1omt livs s) rxo(r3nudlmtnliet t aruax  ;u4apx mieiytlmDul(vs u0 lxoxrciatoptranes;t t2umxm3nudlmen fviltfs2tmu o;u0olen octltfs2uaump t4trxnxfcoa1lpDeaivslt0 2xoxm iy1aptnlivt ()srrau  ou1texoifeiydfm2el( o u) etnmrcta1fp rai sl(0s2uoir io1open ivsls s2rrur ;o1opt  oetyt a ra( s;(4arxnmf3iodoaDrluei;t sexr(mpou4om  mfvt (fs2ua(r nt1texnii3iydfa elnmpnt0 rtnmr iytlmt li o s0trtrir ou4olte iviat aDuaxmo;o4altnmieiysfs ran pnu4trtoif oytomteanvi;t texo(r iu1om nlnctat srrmxm ;o0oeenioetls aDulnvs t0 exrir tadoptraivi () 2tm(o oy1omtnmnetat  ruax poo4apxomietas m2ulnvonu4trxrxrciotlmDeln slt texm(opnudlmtelnci t)sDraxmpou4tpt io3ilslaDranvont0arxrxr3tytfm   u i;()srurxopou1ap  lneiat)arrax poo0ole mf3iyslaDrau pnu0alxoircootoat  i ilt0texriopio1amt  fvtl( a2tmx  ou4oex  o3ias s elumpnu)alxnifcoodlat  u o;s) 2xm(m3iy1om  lncsa(farrr( ono0texomoeiat a rmump;u) rtrxocoytfmDe uvsl()trtrxr3oydame  ivsat a2uaumo;t0ape iieiadls2ul( ont4 lenif ta1lp e ues;t0sruoxopiodllenlfvs (fsDrrumooo0aet if3iad mDrmumo;u)trtrir3iodfpD au ol()srumiopiodlm nmncs sfartr(mo;u0tetniictyd mDuln s t0alerirctytoa rluvi (0trumiopiudol n fvtls sDtr( oou4opxoiictadls emuvp;u4 etrir to1omtelivi t)srxoxrpoudllen iciltf 2rrxr oo1aleo oeiytlsDel( s t0trtnif ta1fmtraivs s0 rxm(rpiydale  fvia( s2rmurpnt0tlxo oeiat s2rm(mpnu4 lenmfcoodfmDrliei t0trum(r iy4olenlnetls  rtaum no1altniieildls2ua(mo t4aexnif3iadlatr ies s) rumxo oy4lp  mfetas aDtmuroou1tee ifeiasfaDeauvs t0 ltrmo3oa1fmtrlneols0texoirpiy1lm emfvt sfa2tmxrpno4texnmoctydlaDelnmp;()alxnxr io1lpDeluei;s setm(mpoodol   net t srua( p;t1tpeoiieiysfa2ul(vsn(0 leoxfciatfa r iei t) exo(opiy1ap emfetat aDtmx ono0aex  i3tat sDranmsnt)areoxf3oadomDrlueo t)s2uoio3iydomeeliesa( s2rmumpnt1alxoifctad sDel( s u4 lenif iadlpt lueo t teum(mpoo1lltelfcs (fsrrrxrpot0texo ictytfa eaums ()aeeoirciotla  luvi;s0 rxm(m3iydolte fvt t)srum(  ;o1alxnifciydfa2rlumon()aeenmr iodomtrauei s sexr(opnu4lp n icsas a2rm( pot1aeeo i3tlslsDrl(vp t) rtnifcoytoatraivs ()t2trir io1am   fctlsf rrr(mpno0altnifeiltfa2ul( s;u0texrxf ootlmDeli sls)s2uo(o3nudlpeelivt tf Durxrono1optnmf3tlt s2ulump u0aetrxrciodlmDrlivi;t)seur(m iodalt mivil( a2taxm ou1opxoiicilt s rl(vpn(4tlerio iy1om elu il(0teuo(r3oudapen icsl()a2ta( onu0ale mi3iad a2eln pn()trxrir todoatraivi s0s2xmxr3iodamtemicsl()aDurx onu0aetoiicild mDumu p t0 rtrmf iy1oaDe ivsls) rxmio3nu4openlfctlsfsrrrurpnu4tpeomictydlm2ua(vonu0aetnmf3todlpDelivilt) eurir nydomt mnvt s  2tm(m nt0alenifctydlaDemuvp t0treoxfcia1omtrauvs t0setrxr iy4ape  nctat  2ta( o;u0aee mi3tlsfs ra( pnt)arxomr ootfmtrlu slt seuo(m iudam n nctls s2urumoot0olxo ociytfs2eln onu) rtnifciotfpte u s s0t2uoxmpnu4lmt lnvsa(  2trxmp;t0alto fcildla2el( o;t0tltrio iotfm  aneo s)s2urir io1lme micsl()aDraumonu1tpxn o3iasfsDuanmp;u0aeenxfcoytlmt lueo;(  etoxm ny4oltemfvtatf rra(  ou4opxnmi3iadlsDea(vsnt0arenxocto1faDrai i (0 rtmxr3oodame  fesls) 2taum ;o1oetnifetyd sDrlnvp t4 rtrmf3tadfmD luvolt)srxo(mpnudalen fvil( a2rau p;t0aptomo3iydlsDrau pnu0trxriocootoaDeli o () 2uoxrpou4llenlnvsatfarta(r nt1opeoif3tyd m elu p ()texrmfctatlmDrlnvo;()sexrirpnodopeemfci t) Drmur oo4tle moetld sDrlump;u0texnir3ootlatr ues t t2toio iydam   ieiasfsrta(mp;o4oeeomfeiyd a2rmnmsn(0tleomfcoodfpt lnvs;t0t2uoirpiy1oleelnei (f rraxrpnt1aeeo o3ildlaDrl(mon(4trtrio iodoa  lu o;t trxmimpiudomteliesl()s2uax  ou1ale mo3iysfa2ranvs (4 etoxr3io1oaDeaies t  ruoxr3ou1llenlnvta() 2taxmpnu1ope iictas a2ulu o (0texnif tadfa  aieolt)t2trxo oodaptnmivi t  ruauront0tlto icild a2rmumo (0 eermo iydfmD  nvolt0 eto(opio4apt mnviatfarum(m ;u4olxn octysfm eaumonu0 ltnifcta1lp e ivs s  euo(r3oodome  ncta(f 2umxm nt1aex mictls s2ran s;t) etrifciy1fmt  uvs;s t2xmxm oo1lmeelici ()arurumpou1tee  i3ilslm umn pn(4tlxnif io1faD  nvs;()t2uoir3no4aptnliviat s2trumpou4tlx moctydls ua( snu4 rerxr to1la e i o;t0s2urio3iy4olee ictas) Duauro;t4oetn f3iadfmDelumont4 ltnif todomt ln o t)truoir nydolenmfes t srrrxmooo1apxo ictyt s rau pnu4altoio3totfptrai i;t0srxr(mpiydolenlfes s)aDrr( p;o0open i3tldlm emnvs t)aeenir iodlptrau o;( s2xoxr3ny1ll elieiltf rum(m ;u4ope moeilsfm2rlnvo;t4teermrctytlpDeau olt0seurim3ny1amt licilt srrruro;o4alt  i3iat s2uauvo;(0altnxfciytlat  ieo t teuoxr3ou1ap nlivt tfa2uaumpnu4tpxn ociys aDrl(mp;u0alxrio3oa1fmDeluvi s)s2urxrpoodomt  fetlt sDtrx o;u4tpe iieiydlm umuvs t4 lxrircio1latraivols) rxm(rpiu4ome mnctl( srraxm ou1tleomi3iasfs2ea( pn(4trxnmocio1faD lneils) exr(o3ny4lptn ncsltf 2uaxroou1olenmo3tas s2eanvo;t0tlxomr3oy1lm e ivo;t  rurxo3iu1lltemfeta() rrr(mont1tet ifeias aDuau o;(4aeeoxo3tytfm rluei;s)teumio oodoltnlicia(  Dtmu o;t4tpxo feiasfm rm(vo;t)teerio3totopDe nvo;s)s2xmxopny1olt mfvi s sDtax oot1oeenif3iasla uauvo () eeoir todlaD  ieols0teur(rpio4lme licil( aDtmxr ;u1apeomf3iysfa eanmp (0 etomr3ta1fp rlneo;(0 euo(r iu4lle  ietl()arumxrpnu1opxomociat a2rmu p;(4 eenifctotfa   nvslt tetrxo3no4ll nmfvtas sDra(rp;o4tlxnmo3ilsfm2uaums t4aeenmo ta1fpt anes ( seumio ny4aleemict sf rua(mont0teto ociad m2eaums (4trxrmr iy1lpDe u o;( teur(r3io4optemnvt t  Drrx pno1oltnmo3ilslaDelu p;(4 eeoxf3totlateaneil( texoxm nu1lpt mnvi s  Dtax o;t1alx if3iysfs2rauvs;() eerif3oodomD livi;s)s2ur(opoo1lp nliei (f 2rmu p;o0aee mieilt s eluvpn(4aetoxrcia1fpDeanei ()t2urim oydopt lfet sfsrtmxro;t1aeto octydfa el(ms;t4aexnxocio1oatr nvs (  2umio nydame lnvtl( sruax  ot0tpxomf3iysla ulnmsnu) lxomr ootlmt lu s (  2ur(m ou4lltnlnct ()sDta(m ;t4altnmfeilsls2rlnvsnt0tlxrmrcoatfpD auvs ()trtoirpoy1om n icilsfs2uaxmp;u4tpeo ietys a rm( onu4trxnmf oa1late i s;t s2xo(o3no1apenmnciltfsDrrxmpoo1ope ifetat a2emnvs (0trermo3tadom eaies;t srtr(opno4llt  nvsat  2rm( poo4apxomiciytlaDumnmo;t0arxrxfciytfa eanvo;s t2tmxm nydlmtelneia()sDumur nt4aetoiieilt s rlnmpnu4tlenmr iy1omteau i;s) rxoio io1lme  nct (f 2rmumono1alto f3iyd mDra( o;t0tetoio todlmDranvo s0t2xoim no4oltnlnvi t  2umxrpot0oleomoeiltfmDuauvp (0arxrmf3iodlmt  u ols sexoxmpoo4lpenmnetls) Draumo;t1aeenifciadfsDumn s;u) eeoifctatlptrli s (0tetmirpoydamee fvtat s2taump;o1oetoiieiatfmDrl( pn(4aeerifcoadlmDr u il(  2tm(rpnydame  nviltfsDua(r no4aet  oeildfmDra(ms;u0aeerircty1fm rlu sl()t2tr(m3no4ameelieslt srtaxrpou0aleniocilt s rl(ms;t)texomo oy1lmDr nes;s0tetoim3oodom nmiesasf rtmu o;u1ole  oetysfm ul( p t4 rtnmf tatlpDr neilt0truoxo3ou4optn feta() rtru pot1oetn ietys a uanmon()trxoio iodfm  anei t)t2urio3nu1ale mnctat)artm(r oo1alt if3tld m2rauvo u) lerxrctydfa eai il(0 2tm(opiodol   nvsl()aDtaurp;t1aexnmfctatls emuvp;u)tleoxfciodop  aues;( truo(opnudol e fctas aDua(r ;t0olxnmfeildfaDra( snt0 exrif iytla eauvsl(0 exm(o3oodllen ivtatfarrmurpno0tpxnii3iydla2ua( p;t4tleoxrcty1lmt aivi s) etoxo3oodlmenmfetlt srta(mpoo4tleomfeiyt aDum(msnu0 ltomrcoadlmDr u sl(  exm(r3iy4ap elnct t) rumxrono4apxoioeiysls eauvpnt4 leriocoatfmDrai i (0seumxrpiodaleemiciatfsDtr(mpoo0tlxomoetas mDulnms;u0artnxr3iodfp r n il( t2to(r3oo4openmiei sfsDum(mpou4aetnii3iadlmDum( o ()aexrmrcoy1lmDrlnvs;s tetm(m io4aptn fei (  Durxm no0olt ioeildfs el(vp (4altnxocoadlm   uesls)t2umirpnudom   ivtl(faDtmurono0tpx mieilsfa2ul(msnt4tleoir3iytlaDranvo;s s2xoio iu4lmt lieias  2trum nu0tetnioeiys mDranvonu0tetrmr3iatlmtrluvils0 exrio iodole  icslt a2rmxro;t0alxo f3tlslmDeluvs t4 reoxociodlm raieo;t  exrim io1oltnlfei s)aDtrx p;t0aleo oeildfs2ulumo;t4artnir oydlp   ivs;s  eum(m nu1lp  mnvtat s2taxront1oeen fciytfsDrlumpnu0aetrmo io1lptrlivo t) exrim3io1ape  fet ()a2uauront4altnmoctlslmDrl(vsn(0 renmf oa1fate ivo;t texmxrpoy4ole mnvils)artmumpnu1tex  oeilsla2ul(vo u4 exnmf iotfpt anvs;s0srtrir3oy4op e fetat  2urxrpnu1opto oeiltls2rmumon(0tlxnxrcio1fmtean i;t0 rxm(r oy1al   fvt (fsrrrumpnt1aeeoifctadls2emn o (0areoircoo1opDrauvs;t  etrxo3io4optelnei t srumumono4opxo fctytlsDumuvp;(0arermfciy1opt  n o;t setriopnydapenmnvias sDrru onu1olx mi3ilsfs2ranmp;u0teeomo3oodfaDe i i;(0srumxm3nodlp emivta( aruauroot4optn i3ildlaDeanvpnu) rtrmr3oy1fpte n i s t2trio3nodlptn ivt sfaDua(rpoo4tlt miciysls2eanvon(4 eeomf to1omtelnvo;()sexmirpoy4optnlfctls) 2um(m nu0opeoio3tldfsDulu p;t4aexnif oa1fp eau o;( s2tmxm3oy4oltnmfctltf 2ua(mpot0tex mo3iytfm rau pn(0 leoxo3tatlaD  neol(0teuo(opoy4lp   ietlsfa2rau  no4aleomf3ilsla rl(vo;t)arxrir oodlaDr iei;t0truoxopnudom emics tfa2tmu  ;o4alxnifeiadlsDrmu o;t4texrxfciy1omte ivo;(  euoim3iy1op elfcias  Draumpnu0tptnif3tlt aDrlu p;u0aetnmr3oydomD  neils sexo(mpiy1llen feia() rtrx p;o1tpeo i3ilt mDuluvs;t)texnifcootla rau i;t  2uoxo3oydapeemict ()aDtaur ;u4olx ioetas sDua(msnt)tltrxociytoptrai ol()s2xr(o3no1ole  ivsa(fa2rm(m ou0oeeniietadlm ea(mp t) rtnirciatom ran o ( s2toiopou4ll nlivsl(  2umxront1teeo o3iysfa2umu o;(4aexrxfcta1fa rli s;t  2uoxopou4ome mfesat)arrr(rono4apeo f3tytlmDem(vp u)alermo3oadop rli i;t0t2trio3oodlmtnmnct (  rtmuroot1alxn f3iadls elumsnt0aeeoio3ia1fmDeanes (0teumimpoodllt  iesl(f rurxront0oetomoeilt sDrlumo t) exoxf oo1om e ueo;()texmxr iodop n nciatfaDtm(r ;o4tle  iciydfsDem(mo;(4 renioctotfpDrluei;t)srxo(r3oo1lp   nvtat artru pot1tltoiieiys m el(msnu)trxnmo ia1laDeau o t sruo(rpoy1ope  icils)aDtmu ooo1tltn icils a umnmont)tlxomr iotomtelu ols0 exoxm iy4omtelici (f Dra(ro;t4olt  o3tasls rlnvonu0 rxoircto1om   nes s0 2trxopny1ome mivs ( srrr(mo;t4teen iciatlmDrluvo u4tlxomr todoa  lieilt0t2tmxm nudomtnlfeiatf 2ua( oou4altn f3iatfa2umnmp;(0arxrmocoadlm e nvi s  2urirpou1lmtelfetat sDtrumoot4aptoiiciatfsDrlnms;t) lxrmo3oatlptraies;s seto(m oodam   nciat arumump;u1opxomociyd aDrl(mp u0 exnircto1lmt  ivil(0 rxrxr3oodal e fvt tfa2urx  ot0oeenmicilsls2uanmp ()aleoxr oo1op  lies;s) 2tmir3nudole lfct (fsrua(r ;o4opto ieiadfsDrm(mp (4treoifcoa1fate uvs;(  2trxr nodoltemieta(fsrurxr no1oeenmfeiydlsDrlums;t0trxrif3io1fm e u o t)trxoio oudll  livslsf rtm(moot4tet mfctls a2rl(vp;u4 etnio iytlm eauesls) rtoxmpnydolenlivt t s2rrxro;t1oexomi3iytlmDuan o;t4tetoif3oytlptrlnvs;(0srxoir3no1am nlnet (f Dtau onu0oltomf3iadlmDumn o;(0aleoiociy1la elivslt) 2ur(rpoo1ap  mici ( arrrxmpou1oleo feiadla2ua(vs u4 eeniocoa1omt lneslt0sruoir3no1am nmnctatfs2uru  no0tltoio3iyt sDuau o;u0arerif to1lp  lneo;s) exoim oy4amtnmnvs ()srtax  ;u1tpx  i3iadla umn o;()trxnmoctydop   n i;t0 2urxo3ny1oltn nei ( sDtaumonu4aeenmociyslm2umn p;()texnifctytoaD aivs;t trtr(m3iu4omee fvs ( aruaumoot1apenmo3ias sDelnms;(4 leniocta1fptr n s () eurxr3ny4al  lfctas)sDuax o;t4opxo ietyt m um( s;t0 ltnirctytlp r nvsls0trxm(rpoy4apee fci ( artmu  ;u0apt  iciadlm2uauvont0 lenif3oydfa r nvo;s sexmxmpiy4aptnmfctlsfa2tru pnt0olxnmfctld s2ua(vp;u4aeenxr oo1oa e uvo;s)srum(mpoy4ol  mfcta( a2rm(r nu1ope  iciadlmDranms;t0texrmrciadfm  aivil( seto(o3ou1ol  mncsat arur(r ;t0aet ifeiydls2umuvo t0tetoif3tadlat aivi s)setoir oudaptelieilsfa2urumoou0tlx  ietas s rm(msnt0 ltrir oodfaD  uei;t t2xrirpoo1aptn fvtls  2ururp;t0tetn oeilt m elnvp;()tltnmr tydoa e n sls0 exoio3ou1optelies s)sDum( o;u4olt mociydlm2rmnvp;u0aetniocoa1lat au s;s)sexmirpou1llte ivil()sDrmx pou1olxn oeiaslsDrau o u0alxrir3oy1lpDe ivolt)t2tm(m oy1ap  lneta(f 2um(rono0apx mfcilt s2umu p (4 rtomoctodomte nesls  eumimpny4ap nlivs (  ruaur ou4apxomi3tat m elnmp t)tlxrir3totopDe n o;( tetrimpoo1ol   fvia(faDrmxro;o1opxoif3iatls2ra( pn(0trermo3iydfp elnvs ()t2xoio3iy1omtn ies s s2tax p;o0tpxnmo3tld m rmnms u0areomfciydfaDelueo;s)srtmxm3oo4apte iviatfaDrrxmont0apeoiociaslm uau s t0texrmr ty1opD  ivi (0trtr(m3iy1opt  ivslt a2umx ont4oeeo ociysfmDran p;()alxnmo3iy1lpDeln ils trxr(o3iu4apenlnciltfaDtax pot1oleniocilsfa2raums;() rerif3tydop  lnvil( t2xo(mpny4lm  mnvt ( srtmxr nu4apt  octltfm rmn s;()tetnifcia1opD  uvi s0t2triopiydam   nvia()sDur( o;o4alto ociasfaDuau o ()trerio3iydlat  nvo s0teumxm3nu1oltelietasfa2tau pnu1aeto i3iatls2umn onu0trenmfctodfatrli il( trxm(m iy1llee ncta(fsDraxm nt1tex mo3iyt m ul( s;(0teenxoctotlatrliei s)sruoim3iu1ale  ies t)a2rau pno1oexomo3iytfm2rmnmsnt) etnmo ty1oatrau i;s)t2um(r nu1lpenmfetlsfa2urur nt0tpt mictatla2ulu p;u4tleoxo iatom  aneslt0 exrxo3io1opee ncs t a2ua( ont4texoii3iatlmDuluvs t0 exrmr3ta1oa   uvi t seuoio3iy4am  mfct s)aruru  ;u1aet mfeiasfs umump;u0trxrxr iytlatr ivs;t0tetrimpoodop  lfci t aDrr(m ;o4ole ifciys s2umumont)alxrxo3iy1fmD  u o;t)setmxmpnodomtelfcsasfsrtr( p;o1tpt  i3iydfm2eanms;(4trxnxf3ootfmt  uvs;(0texmir3ou4ol elfcilt  2ua(moot1aeeo oeiyt s ranvp;(4arxnifcio1oaD lnvols0srtrxo3nu1lmenmieils aDtrx  nu4opxomfeias mDrluvp;(0altnio3ta1fmDrauvs;() rurxm3iydlme lfeilt)srtru o;u4olt mieiad mDuanvo;t4 lenxoctytlpteln o;s trxoio iy1lmte iei () 2uaumont4tlxoioeiytla emnvsnt0trxrmr tadom elues;s s2uo(r3iu4lmeemfcs ()a2umuroou4oee  feias mDrluvp;() ltoxr3oatfmteluvslt s2tmxr iudap n feiltfsrumump;t1apx mocias m2rmuvs;t4areoir oytfmD lueslt) rxoxr iudlpe mieslt) Dua(rpnu4opt moeiadlsDum(vo;u0 etnir3oy1fm  auvols) exrir iy1al  lfvsas)a2tmumpno1ape if3tld m2el( o;u0tltoxocoydopDrli i (0sruoxr3oo1ll n fviltfaDta(mono0oee mo3iytla2ranms;u) ltoircoodfaDe ivi ()teumio3oydoptnlnesasfsrrmum ;u4tpt mfeilsfs eau ont) exrmo3oo1la e n s;s0trxoxm ou1lme lietltfartrx o;u0olenmictltlm uan pn(4aetrif3ootlmtr u i s s2to(o3oo4al e fct s)aDraumono4oet iociys sDuauvs;u0 rxomr ta1laDe uvol()trtrir3nudoptelivtatf Drau p;t4altoio3iytlsDuauvo;t0 lxriocoa1faDrlueolt)seuo(r iy1op e nesl() 2tm(  ou4tlxo oetatfm2eau p t0trtnmr3ia1lmtelueols0 exr(m no1lm nlfcsat srtmumont1optnifeias a em(vp t0texomfciotfaDraivo;s  etm(mpiu1optnmicia(  2ra(r ot4texoifcildfsDulnmpnt4 rxrxf tydfaDrlneo t  2xmimpio1am nlivs ( a2tau p;o1tetnmoetlt sDea( on(0 etomfcootfa   nvi ( s2ur(rpiodoleemnvt s)sDur(r nu1opxn oeiaslsDul(mo t4tltrmr iotfm eaiei;( t2trxo3nu4ap  lnci (fs2ta(mpoo1apeoifctydfm2rmnvs (4aetnxf tadlm rluei;()trur(opou4omt mnvsl( sDurur ;u4oltnif3ilt mDrlnms;t0altniocto1oaD ai i;s0setr(o3nydape  ictlsfs2urur ;o4olxnioeiys s em(vpnt0 eermr3oytlpD lueo () exrir3ou1lmeelicils)s2rm( ono0aet mf3tld a elnmp;t4 lxrxf3iatfpD  nvo;t) 2xmxr3oy4ll nmnet s)aruaxrpnu4alxoiictat sDrmumsnu4 lxoir3tatlpt aieo ( sexrir nu4op n ivsltfsDra(rpnu0opt ii3iatlm2uanvs;() rxrif3totfmteau i (0 ruoio ny4apt lfvil(farur(m oo4tlx  f3ildlmDeau p;u) eenxrctydoptr neilt0seuoir3iy4lpe miesatfa2ur( pot1ape  o3iat aDrau pnu0artrio iytop  lueol( t2umxr oy1llt mfei (fartru  ou4tlt iieils s2umnmp u0alxoif3iotfmDrau o;()seur(r3nydaleelfcsasfsDtmu pnu1tltniocias mDemump;u)aeerxo3tydlmDe ieil() euriopnodole micsas)sDur(rp;o1aptomfctadfm um( o;t)trxomrcoodfpD  ivi;t) rtrir3oudllt lfctasfsDtru  ot1oexn ociaslm2uluvo;(4texrmo tydom e ivs s)srtrxo nu4om nmncias)s2tr(mo;u0oeenmoetlsfmDul(ms u) rtnio iotlaD  u ilt0seumxm3oydaptnliesas a2rrumpoo0apeniocilt mDeaump t4 rxoirctatlaD ln i s)tetrimpnu4lm e nei s aDrm(  ou0tlx mi3ils m eau p u4teermocoadlp e nvols)trurxr oo4lme  nvsltf 2um( oou0tpeomfcilsfmDul(mont0 lxnmfciatlpD aieols)srumir3nudlptn nciat a2tmu ooo1altn oeiytls rl(vs;u)tetrio3iotfp rlneslt t2um(o3iu1lpte fvsat)sruau pot4ole  fctltfs eauvs;t0altoio tatom elueo t)texrxmpnudam  lfes tfarumx ont1alxnmoeias s ea(mon(4teeoif iydoa  auvo;t) 2xo(mpiy4am   fvils s2um( pot0aee miciadfaDumuvp u)trxoir3oatfp  livolt0s2xmirpno1lp   nesls)a2rrx  no0oleomocild m2umu on(4 rxnmr iadfaD luvils teuo(mpoy4lpt  iei t sDumxmp;t0opto ociltls2rl( o;u0aeeomo3to1fmD aivilt tetr(r3ny1lpt lnvsl() Durxrpot0tetomoctltls rl(mo;(4altomr3iadlm elieo;()trxmxo ny1om elictas)sDuaum ;t4alt  oeiasfm ra(msnu0 ltoxrctatoptrai il()t2tmiopiu1altemnvslt  2ur(ront0teenmf3iyd s2rluvs u) rtnmr oa1fa r ieo;s  rxmiopiy4lpenmnes (  rtau o;u0aex mfctydfs rl(vo t0tetomfcoodfatranei s0trtrim3no1ll  micil()arum(m ;o1apx mo3iydls2rl(vs;(4texnxf3tytlp e uvi;( srtrirpiy4lptnlfes () rrrumo;o1texoif3iytfmDrluvo;(0trtrio3oy1opDranvi t)s2uriopou4ole livta(  2umurooo1tpt  o3tld m2um(mpnt0 renmo3ootfp r ieil()trtrxmpiy1lm  lictas)sruaxmpot4tpeoioeiyd aDran o (4alxrio3tadomt livi (0 exrxm no1openlfcslt aDtmumooo1tetomf3ildls2rln p u4trxrif iodop elnvil(0tetm(r3iydol nlfeilt  2rmx  ;u1opx micils sDeau p;t0aexrmrcty1faD  ivi t) ruoxm iydlpenlnes t a2rmur oo1opeo oeiasfmDemump;(0aleomocoa1la r n i t trtoiopiu4lm nlict sfs2tm( pno1teeomieiytlm2rln s ()texrxr3iodfa raneols)s2xmxr iy4lpenmivt sf rrmxm nt0opt iocildfs2uaumo;() ltnxr iytoaDrli il()trumir3iydam n nei sfsDtrx oou4olt mfcildlaDrluvonu)arerircoo1fmteln ils)trtrxr iodomenlncia(f rua(r ou0tex  oetytfa uan p;u4 etnmo3ia1fp eanvil()trxriopnodlltemfvslsfsDtm(rpnt0aleoio3iat mDemnvs;()teerir3to1opte i i;s sruoxrpio4llen nvil( s2ua(mpou1altn iciatlsDem( on()aetoiocoytfaDeaieo (  euoxo3iu4ll emneils arur(ronu4oexnmi3tad s ean pnu0aetrxrctydfmDe uvils)teuoxmpiy1lptemnvs tfaDrax o;u4altoiietaslaDelnvo;u)arerxf3oodom eli i;t0srxoxrpiodam nmfes t sDtr(rp;u4olxoifctaslmDul( p () exnxf3tadfmDrau i () rxmxrpny1alt liei tfa2tau poo0oeeniieiltfa2ulnmsn(4areoxo ia1fpDraueo;t teumxr nodlmen ivtls a2tmur no4oltomo3tldls rl(vs;t0arenmo3tadoaDeai i s  2uoxo ou1oleemnvi s)a2tru poo4ole iieiytfa2rlnvs;u0aeeomo3tydopDeaivi t0 2xrio3no1am nmnvt ()aDumxm ou4oetn ieiltfmDrlnvo;u)tlxnmrciotfa rlieo t)trum(mpiudop  lnei (faDrax  nt4altomf3ild a umn sn()artnmo3iatfm  an o
\ No newline at end of file
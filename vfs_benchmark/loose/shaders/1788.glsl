@@ -0,0 +1 @@
+uei;s0 2toimpnu4al n fetltf 2urum ;o1apxnmieiasls ra(mo;()areomfctatlmt lneols  etrxopnu4ol emncs tf 2umumoot4apto i3tyt m2rmums (4treniocia1fpt aneo;t0setm(o3nu1al   ies ( s2trurpot1alxoifetatlmDem(vo;t4tltrmo3oa1latr ues t s2uo(r iu1lp n fcia( a2tmxrp;o1texo oeiaslsDrmu o;(4tlerif3oy1omtrluei;s)tetoxr3nydlmt  fctas)sDtrumpnu0tpx ifciltls el( pnt0 rtnxo tadoat  nes (  2uriopnu1lltemiet (f Drrxroot4oetnmo3tldfsDuln o;u) exnmr tydlmt  neil()t2xmxm3iodam  livil() rtmx ono4opxnioetlt sDemnms u4 ltomr oatoa raieolt0trxrio3oo4omt liesas)a2raxm ;u0aexoiieildfa eaums u) lxniocoadopDelues;s trxrxr no1amen icsls s2trxm nt0opx  fcilt a uln o;()tlenir3tadfptr n i;s0 ruriopnodlp   nes t)sDtmx  ot0olx mo3iyslmDumuvp;t)tetoio3ia1om e ivs;() rumxm iodoltnlfvsatf 2ta( p;u1apxnifetldla eanvpn() ltnxr3oadopt luvslt0tetoxr iu1ame lnvils)artmum ;o4apxnmi3ilt a ulnmont)tltnmo oydfa   u s;t)trur(o3ou1ole  fci t) rururpnu1opeomfctld a2rmuvs (0texnio tadlpt lnei (  etr(r iydll emiviatf rrr( pno0altnmictldlm2eauvp u0 rermr3todfpte n sl()sexoxm3oo4opt lieils)arraxroot4aexn ietls m ul( ont4tetnifciatfa ranes;()teurirpiu4lmtn ivsat)sDtaxro;o1texo feiydfmDrmu onu)arxnxrctodomtran i s0trtmiopnu4apeelivtlsfa2tax  ;u4tee  f3iatfaDeluvo () ltrmfcoy1fpDelivslt  2uo(r3oo1alt  nesl(fa2taxmo;u0tlxoifctadfm umnvs;(4tlxrxr3oa1om e nes;s t2tm(opiydlptemfei ()sDtmu  oo0olxnmietyslmDrmnvs;()trerxo oatomte uvil() ruo(r iu4llenlfcil(f 2tau onu4tlen o3ilslmDemu s;(4alxnircoydfatranvs t)tetmio iodlp  mnvt (faDrr(mp;t0ape  iciat s2ua(mp u0 exnmfciotfp eln i t0trxoimpiy4ll  mncsatfaDurx  ot0olto feilslm2rm( p;t4tlxomr3oydlp rlnvsls0setrxm iodlp e nvs s) 2taxmooo0tle mo3tatfa ulumont4 renio3oa1oa  lnvs;s0s2uoxo3oydome lieiat  Dtmxroou4aetnmf3iys m2umumon(4aexomf3iotomDe u slt0s2xoxo3oy4om n netltfa2rrxmooo4oee  oeiadlsDumnvo;u)aetnmo oadla rauvi t)trtm(m3no4op nlncias) 2uaxmoot1oetnifeiytfm umuvs u0 lxnircto1omDelneol() 2xo(rpnodopeemnvs s)sDua(rp;t1tlt  i3iad m2ulnvont4tlenmo oo1fateaieols) rtm(o ou1am eliciltfs2ur(ronu1aexo feiad m em(vp ()arxnxf3tydlmt  i i;s) eto(m3nudlm e fetl(  2trxrpno4oeenmfeiltfm uan sn()aeeoir3tatlp  au s;t)setrxo3oodll  mietlt)arrm(m nt4olt ifetldfm2um( o (4 rtrxr3iadoat  neolt tetm(rpoy4opt  icilsfarururono0olxnmf3iys s uln o (4 lenir totfmDrlu i t seur(rpnydam   nviat sruaxmoou1opx ifetadfa2el(ms t0trermr3iodlate ies;s) etoimpny4ameemfesasf 2umxmp;t1tlx mf3ildfmDuaums u4treoio ty1optelnei;s srtoim3ny1ap nlnesa(f 2trxmp;t4olt  fciltlsDelnmpnt0tlermf iytlmDrluvs t setoimpno4ol  mici s a2rmuro;t0aexnmoeiyd sDeaumo;(0 lenio3iydomDr neil( trxmirpio1ape lnvtlt arumum ;o1apxoiocias s um(vp t0trenxr tydlaD au sl( srxo(opoo1ll e nvt ()sDrr(  oo4alxn octlsfa2el(mp;u4 etoxf3iatoa eaieils seuo(m iu1omen ictlsfsDumxmono0oleo f3ildfmDranmpnu4tltnmo3ootomtr i o t seur(r no4amtelicias)s2ua(rp;o4tleniieiys m2eanvo;u0 ltrio iadfmte nvi ( seto(m nydlmt lfvi s a2taxmpou4aptnmi3iat aDeanvp (4teermf3io1oa rlneil()t2xrxo3nu4oleelnct (faruru p;o4tle mfeiyt s eluvp;u0tetnio oydfp   uvo;t0trxm(r iu4alt mnci (f rtm(m nt0tee  feiyslm2um( ont)artnmr3ta1laDr ues ( truoxopio4lpenmicil( artaxro;o0tlt io3tlsfm2umnmo;t0trtomf3io1latrauvs ( trtmio3oo4oltelfci ()artr(roou1aee mieiatlm2rln pn()aexnir tadoat lieils trxoxrpoudapee fvi tfarrm( p;o1aetn ocias m2eau o;(0areoxf iotfaD lueo s)s2uoxm oodale mieils arrrumpoo1texn feiyt sDem( ont0tetnmfcta1oat liei;( t2xoxr nudopee fetas arta(mpoo0ole ifeils a rlu on(0texrxr oadoatelu s t)trurir nodome  fes s arta(mpou4alt moeiasls rmu s;(0trtnxocta1fp raivs;s) 2tmir3iy4lle  ivilsf rtmu pnu0opxoiociysla ea( on(4trxrxr3iodfmDran s () exrxo3no1amtnlfvsat artr(rp;o4ape  ieiys a rln sn()teeomo3oo1fatr uvo;s0 2xmir3iy4ale mfcsltfsrurxroou4open i3ils mDemu onu4tlxoio3iy1oaDeanvi t0sruoxr ny1apenmics s)srtaur ou0oltnmo3tasla ulnvpnu) rxnmf ty1fpDeaivol() 2umxmpiydlpe lncsa(  2rmump;u1texnifciydlsDrm(vs;u4artoxo3tatoatelnes;s)sexoxo no1olenlnei sfsruaum ;t4opxoioeiysfaDrauvo;u0arxrmr iy1omD  nei t)trum(o3nydamenlnvs t srtr(m oo1oleomocildlsDua(ms;t0aetnmocoatlatrluvi;s0 2xoir3io4ol n fesa()a2tmxm ou1tpx if3iatla2rmu pn()trxnxf3iydfaDeaieslt  rto(r ny4ap n netat)srtrx  ;u4tpeomfcildfm2rm(mont0 rxnxr3ia1opD  u o () 2xm(o3io1lp elieslt) 2ua(m ot4tetnmfctys mDuauvo;t4treoiocto1fm elu s;(0trto(o3oy1om   fctl() Drm( o;o1oex  oeiadfaDemn o;u) eeomociotop  aivi;s0 ruoxr iy4optelicia( a2um(moou4texomf3iydfs rl(von()tlenxf3todlmDrlivo (0s2xmxm nydol nlieiat aDur(r no4oexniicils sDel( o (4 ltoxocoodlatr ivo s0trtr(mpnu4alenmncia(  Dtm(mo;o0oetoioeiadfs rmuvp;u0arxnxo3iotlmtelu slt s2tmirpno4oltemncs s  rtrurpot4apto fctlsfa elnvs;t0tltomf oytfa ean i t)t2to(o3iudlm  lnct ( arrm( o;u4oexomfciat m eaumo (4 lxomo3io1om rluvs;(  rtrirpio1aptn fvtlsfsDtrxrooo4oee ii3iyd a2ua( s u4tlxniocio1op  aiei;s0trum(mpiodopt  fcia()srraum ;t0tetoiietld mDrlnvo;u0artnmf3iatfaDrln olt)trtr(r iu4lpt lncils) 2ta(rp;u1opt ioeiydfa rm( onu4 rermo totfmD aueil()t2umimpoodomtelncia()sruaxrp;o0oetomocilsla uaumont4tltomocta1fpDeanvs t) rxo(mpnydoltemfvi t)srra(ro;o0tpxn ociatfmDem(mp u4texrmr oydfpt an o s)trtoir3ny1ol   ictl(f Dtr(mo;t1olt  fetas aDrau sn(0trtoxr iytlmt au o t s2tr(m3oodolenmfet s artru  no4aex mo3ildfs2uaump u)tltrmf oa1fmtrlnvs t trurio iodamt mnesat  Drru  ;u0aetoiociaslmDrlumpnu) rxnmr iotoatr nvo s)t2uo(m oy4apt lietas) 2ur( p;t1olx mf3iad m umn pnt0tlxoxr iy1oatraues;() exmim3iu1lptemivi (f rrmxr ;u0optn f3iyslm ua(ms t)arerif3oytop   i o;(  2xrxmpiy1lp n ivsas)aDrm( o;o1tpenifeiltfm2ra(mp;()aeenxf3tatfpt luvi;s)trtrimpno4lptn ivtlt srra(monu0opxomo3iysfaDrlnms t)teeoif oa1fpD li ols) eur(o iydlm  lfes (fsDtaxro;o1oet ii3iat mDelums;t0 eeomo ty1lmD  nei;s0 2tr(o iydomt lfcs ( srtr(mpnu4tlt  i3ildlm rm( pn(4aeermf iy1fmtelieo s t2urio nodll nlfcil(farrmu o;o1opxn iciytlsDea(vont) exrir tydoaD lieil( srxmimpnodolenmicta()srururoou4alt  octydlmDumump u4 lxoxr iy1fat li sls trto(opiu4lp n nvsa(  2rrx pnt0aet ioeiatfmDrauvo;u4aexoxfcoytopte uvsl( t2umxr3nydllt lncsa(f 2rax  nt0oltn f3iaslaDeanvs u0arxoxr oa1oaDrai o s  etoxo io4lmenmics (  rta(mpnu4aet if3iasfm2rm(mp;()artriociydlmDr uvs;s0seto(m no1oltnmfvslt aruax pnu0oeen ietadls eanmsnt)alerir oadfpDrauei;s)t2toim3oy4amee fvi (fsrtrxmont0alt mo3tad s elu pn()tlenxo3oytopDraivo;( tetoxopnydlpeelfvi t aDuaur ot4tlxoif3iad s umuvsnu) rtoxr iy1lpt  n o () exo(o ny1lleemivsltf 2tmx pnt0apxo oeilsfm2um( p u)aetoir ta1fpt lnvols)srxoxr3nu4omeemiei t)a2rm(rp;u0tle ifciad a em( o;(0aetoio3oatlp   iei t0srtrxmpiudam  mietls) rraxmo;t0oex mfciydla elnvonu4altrxo3iotfpt luvi;t seuo(opno4ol  livsat  rrau oou1aexnmfeiaslaDeanvsnt0 rtomoctydom e n ils) 2xoirpiu4opt lncta(  2taxrooo1tpt mfeias mDrlums u4alenxo3to1oaDean s;( srtm(m iudapee ncsas aDur( pno4aetniictyslsDul( ont0tltrmo oo1fatelu olt)texoxm oo1ome mictlt  Dtmu  ;u4opeoifetyd a2el(ms;u4teeoxo oa1fmD aueols)t2tmxmpno4ope mnci t) Draumpnt0olenii3iysfa eau pnu0trxomf iytlmD an slt) 2xrir3ny4altemfctat)arraum ou4olen feiltfm2ra( o t4arxnxo3oytlatraueil()sexmxmpoo1lmenmivsa()a2rm( o;t1tptnif3tasfa2uln s;t4arxoxf tadomD  i il(0tetrxm iu4altelnciat)a2umu onu1apto f3iydfs rl(vs u0tlxrmrcoodoa rai i t) exoirpny4lm   neslt)srtmu onu1oetnmiciasfs rm( p ()aexnmoctotlmDr ieslt sexm(opiu1ll elfcias  rraxr ;u4tlt  fetldlsDem(mp;() eermrctatoa  an olt) rxmim oudlptelnes tfarrrx oou1opx  fcias mDua(vp;t)trtrxociytfatrlivo s0seurxm3iodlmtn nei s  2rr(r nt4aetn f3iydls2eau s;u4aexrif3oatfptraieo s)trxrir3nu4lmen fvt ( aDrmxmpnu1oltnmocilsls uauvpnu4treomo3iadfaDranvs;(  rxmxm3ou4omtn fctltfsrrrx pot4aet ioetld mDelnvs;t)aeeoxo tydlp elivi;( trtoxo nodom e fetl() 2raurpno4alxn oeiatfa em(ms u)teeomr3oa1fa rlnei s0t2tmim3nodomtn ivt sf Dum(ront4oexo fetyd sDum( o u4 lxnmf3ia1oa ran o;( trxmxr ou4ap e ictat arumuronu0apxnif3iyslaDrmumon() lenir ty1fpDeanes (0s2tm(m iydameelfei t artaxmooo4apxo icilsfs2ua(vp (0alerifcta1fmD aieo;t teumxopiy1ll e fctat  ruax oou0ope mictyd mDrmu s (0 rtoir3iotfatrlnvo s)trtmirpny1lme  ies t)aDtrumont1aleomociys s2ul(vp;u0 lxnir oatfmt ai ols0srtrxopno4al  lnvsat)arua(m ;t1tpeo f3iydfm um(vpnu)tltrxf oytfmD  u o (0t2xoirpno4llee icia(f Drmxm nu0tleniociatfaDrauvpn(4 renir3ootfatrlnvil(  2trxrpoudolenmfvs s sDta(  ;o4oleniictlt a2umumsn(4 rtnmf3oydlat anvolt) rxrimpiu1am n feiltfaDuau  ot1oee io3tydls rmnvo u0tetrmf3todfm r n s;( t2tm(m3iodal elicsat)sDtaurooo0ape  ietad m emnvpnt4texnmoctodlat an ol( truo(m oudlltemneta(f 2tm(rpou4apt  fciysfsDrmnmpnu)tlxoifcto1fmDr u o ()trxoxr3oudoltemfeia(fartr(  no1alxnmoctydfm rm(vo t) exoir ta1lpteli olt) rxo(r3no1lmee nctltf rum( pnu4aeen icias aDemu sn()treoio oydfateli i;(0srumir ny4altnlfvs tfsrtau poo4oex moeildlm2uluvp;u0altoxo3to1lm eaueilt s2uoxm ou1lpt lfci (fsDtrurpoo4ole mieiyd sDrmuvp u)tetnxrcty1fp rlivo s  2tr(r3ny1ll n nvtls a2raxront0aeeo oetasfa umnvp t4texrmr oydlmDr nvo t0 euoiopnodap e neta()artm( p;u0aeeoif3tlsfs2eaums t0artnir3iytlaDelnvs;(0s2uo(opiudllt liet sf Drm(rp;o0aptn oeils m ulnmp t4arermf3totfa rlneo;t)t2umim3no1lptn fvt sfarum(r ;u4oleoifetldfa rau p u0texrxf3todfa ran o;()setrxopiodalt  fvilt) Drrxm nu1optn f3iytla2rmnmp;t4alermfctatoaDeln i;( teuoir3iu1am n ivil()aDua(rpnu0olx  iciasfsDumnvp;t)tlxrif iodfa eaueils) euoxrpnu4ap elfes (  2rr(  ;o4alen iciydfa2em(mp;t0 ltomociydlpDrau i (  2xm(r io4olt livs t arum(r no0aex iiciydlm rmu s;t)tltnxfctydlat lies s srtoxm oydlmeemfet (  Dtm( oot1texo oeiltls2eanvsnu0 rxrioctatla e uvils tetmxo nu1ole lfetlt) rtau  oo1texoioeiydfs rauvp;t4tlerif3oytfaDeluei;()s2xo(m3nu4olenlnvt s  rrmum no4ope moeiyt a rmnmo u)aetnif iytfmtelues;() 2urir3nudom  liesat  rrmx ono4oeenifeils m2el(vs (0aexnxr3iadfat luvslt0teur(rpou4lpee nvsl()s2tm(mpno4teenio3tysfsDeaumonu4 exoiocoo1omt au ilt0 ruoio3oydaptnmnvil(fa2raxmpnu0olxnioetltfmDulump;t4alxnmfciytoatrlnes s0t2umirpoudoltn feias s2ta( p;t0ale  icilsfsDuluvon()alenmociotfpt ai i;t  2xmio3nudame  fcias)arta( pou4alt mfciad m elnmpn(0aetoirctytomt anvs s0tetm(r ou1al nmnvs (f 2rmx ono4tex  octasfs em(ms t) exoxrcoydlmD auvs t)texrxr3nu1ll  lfeiltf 2urx oou4aeen f3iatls ul(ms ()alermf oa1optelues;()s2xrxo3no1am   fvsltf rtr(moot1tltn ieiat aDum(vp;u0aexnio3iodfp elu o;s t2xo(o no4lpe  nei ( aDua(mpnt4oetomi3iatfsDelnmonu) rtrmf3oy1fm eln s;t trtoio3oudlm elnetlsf rraumo;o4apxnmoctyd a2elump u4 rxnifctadla   ivi;s)texmim iu4ale mfetls s2tmxm ou4ole  fctadfm2rlu s;(0tlxoxo3io1oate uvo;t)srur(rpiy4ll  lneils sDta(r ;t1oeeniietydlmDumn sn() etnmr ootoatr i i;t0 exrxo3iydomtn fvt sfa2tr(r ou1ope iiciatlmDranmp;u4 reomf3oodomDe uvslt0trxo(r nudale mncia(fsrrrxr ;t4olenmoeiasla2rm(mpn(4 rxrmf tytfpD lueil()trtrxo3oo4ape micias srtaxmoot0aeen fciat s2rl(vo (4 rerxo3iodfp  lu olt0 exoir oy1lmte iesa()aDtmum ;t1opxn oeiysfm umnvo;() exoircto1lpDr i i;()srurxmpnodopeemfvsls)artr(  nu1optn ociydfm ra(vo t)altoxfcta1oat anvo;s)seurxm iy1ap n icils) 2tmxmpno4alenifetadfs2uauvpnu0aeerxrcoo1omt  ivsl(0 2xoxo ou4om   nesl(faDum(r nt0aeenmoetytla2emn s t4trxnxr oatoaD au s t)seumxm iodapt  ncias aDum(m no4opeomicias s ul( p t4 rxnxocto1opD ln i;s0 rtoxo3oodllt  nvsat sDurxrpnu1oeenmf3tysfs2ua(mpn()alenmo3iodlpDeln slt0sexrxr no4ope lnvsl(f 2ta(r ;o0aexo f3tltfmDean sn(4aexomo ta1fm   nei t0s2toxmpiu1op n fctlt) rtrxmp;u1alenioeiys aDua(vp;u4tlxnxo tadfa   nvs t)srtrxmpnu4llt mfeia()s2uaxrpot1tlxnmfeiadfsDuan p;u4 ltrifciodfaDeln il(0t2xrxr3iudamt lieias)sDrmu o;t4olen ieiyt a ran p t)trtoir to1omtean s s0seumxmpoudaptelictls)sDumurp;u0tltnifeiyt m2rm(vo u0 reomfciatoaDrlnvo t)srtmxm no4altn icslsfsDra(  ;o0opxnifciytfm2raumo;u4aetoxf3oo1lmtr u i;s teurio3no4op e fcsatfs2urx oot1oltn o3ildlsDean o;(0 exnio3iytfat luvi;t0trxo(m oodapt mivils sDrrxroot1apt  ietat s2ea( s t0 eermf3io1omtean il(0trtoxr ou1ol n nvilsfs2tru pnt4tleo fetad a uln sn()teermfctadfaDran o ( srtoxmpio4omt  ivs s srtmxmoot1oeeo o3ils sDua( o;t0 eenxoctytlpt  u s s  exm(r ny1om   nctl(  Dtmum ;t0tle  ociadfsDrln pn(4 eeomociotopDe ues;()teuoio oudllenlnesas) rraxr ;u1aexnmfciadlm2ua( s;(4 reoxf oydfate ivo;(0t2umio nu1ll  miesa( sDraxm ;t1apx micias m2emnmp;u4 lxoifciodfaDr u o s  2xm(m3iy1altn fcs (f Dumxr ;t4tpto fetatfsDemuvsnu)tetomr3tatfpD  n il()srum(r nodapte fei t) 2tmurono1olt  f3tltfs2ra(mo;u4 lxoxocootomDr ivs s) ruo(opiu4op   ictasfaDrrur nu4aex  ociltfsDum(vo;u4 rtrmf3oy1lat aieo;t) rtrxopoudllte fet tfaDumxmonu4olt mfeiydlm2ean s;u0aetnmf tatopDrlu olt0t2xr(opoydole  ivta()srtaxm nt1oeto o3iatla uaumpnt0 etomf to1lptrau s;t trtmxr no4op emiei ()sruax  ;t4tet mf3tys m2emnms;t0arerxf3iydopte nvo s setr(mpio1ome lnetl()srtr( p;u4ape mfetlsfs ranvpnu) etnmf iotla raivi;()srxoxr iydal e netls aDra(rpot4texomieiltfa ul( p;t)tetrmo3io1fpDeaivs;(0 rtrio oo4llenlivta(fs2trum ot0ape iocilsfa ulnmp u)arxoif ty1fmDrauvols tetrxm nodapte fet tfsDrm(rpot4tpeomieiltla2rmu p;(0artomrcoytopDeanvsl()teto(opiydlpe  ivt tf Drmum ou0tptoiociydlm eau o;u0alenioctadlp rluei t) rum(r3oy1ame lnvtasf 2trump;u4apto icilt s2emn onu4alermfcoydfat  ivolt  2xrxr3io4opt  fvs sfa2trurpoo4olx  i3iysfs2uaums;(0tltrxo3oydfaDelieil()trxmxr oy4omenmfvs t srraxm oo0apt ifcildla ul( s u4 etrifctytlatr ivo () 2xmxm oy1altnmfvia( s2rrumpoo0optomo3tlt a el(mp;(4teerxoctytomtrlnes;t)sruoim3io1lltelfctlt)arrr( ooo1opt ifeiasfs2uan ont) ltrmoctadomt anei;(  rxmir3nudomtemfcsas sDtaxmono0apx  icilsla ua(vpnt4arxnmfcoa1oaD aieo;()setr(mpiu4ameemfvslt sDumxr nt4opxniictytfs rmn o;t4trerio3todoptrau s;s)t2xoimpio4lptnmivsl()arra( pou0texnii3iydlmDumuvs;u0teerircoydlaDran sl( srxoim oo4op nlivtat srtm(mo;o4teen f3iysfs umnmont) eenif iy1fmte uei;t sexrxopnu1apee fcsls  rtmum nu4opxn ieiadfmDrlumonu4aetnmr3iatlmteluvsl()t2tmio3ou1ame lfcsls)s2ra( pot1tlen fcilslsDuluvp t0tetnxociotfmD  neslt0teumim3ny1am  mncia( srrrxmpno1apxn fciasfaDrmn s t4trenxr3tatlpDraueo;()t2xm(r3io1omee fviatfaDtrxmpno1aexnmociys a2rln p;u4alxrxo3oytlpDrai o;()sexrimpno1aptelnvtltfarrmxront0tltniociyslsDemumo;u) rtoxo3iadop rli i t0seumxrpou4ale mfvsltfsDrrxrpno4tltniietadla2uau on(0tlxnir oytlat  ivils0 2tmxm3io1op   iei tfs2tm(m no1tex  ietltlm2ulumo;t4aetrif iotlaDrlueils  exr(m nu4ap   nes s)arrmxr ot1olt  octat m ea( s;t4 rermrciotlmDrauei t) exm(rpnudom  mnctl(farra(  nt0tpxnmoetlsfsDum(vpnt0 lenmrciadlpDraies ()s2uoxo oo4ap nmict sf rtrx  nt0aet mociys sDea(mp;u0 exnxfcoatfmtean slt0trxrxm3io4ale lics s) rrm(m ot4apxnifetyslsDrmumo t)alxnmr3iydfpteli ol(  rur(r3oy4ll nmicslsfsDtmxr ;t4aetnmi3iytla2uaumont4alxrio ia1laDelnei s0srtm(rpiy4om n ivtls)arta(mp;o1texomietadfm ulnmpn(0alxoxf3ty1fmt  uei;()srxoxr3ny1omtn fcsl( aDurx pnt0tex  o3tydfsDem(mon(0tleoxo3iydfmD lu i;t  etmio3iu4am  livsas)sDtmumonu4aptnmfciat s2ran p ()tlenxr3oa1lmtrai o;() 2tmir no1oltnmivsat)a2raxmpoo1texnmieiasfs ra(mo t)texnirciotfpt  u il(0srxoxr oo4op  mfvi sf rrm( pnu4ole miciadfmDrmnmo;t0 ltrxf iatfpt lnvo;t)s2toxr oy4om emietltf 2tr( ooo1opeo i3tydlm elump;()artoxf3iatlm eai i;t)trxo(m nudlmen netat) 2ua(mpnt1apenmfeils s2rm(vs;t0 lenxr iydfpteaneil(0 rtr(mpoo4apt  ici () Dua(monu4altnioctys aDuau on(0trxomo3iatlm eli i;t)setmiopiudlme mfei tfarurx  no1aet mo3iys m rm(mon(4areoxf3iy1omDrlnei (0trtrir iy1lmtelicias)sruaxr ;u0opx  ietatfs2rlnmon()trtrmfciotfm  anvils  2tmxr3ou4lleemieils arta(mo;o0apeoif3iltfaDelnmp t0trtrmociytoateluvslt)truo(o iudom   ivias)sDtaxr ;u0oee mi3tldfm emnmonu0trxrio3todlmD anvo;t)trtrio iu1llenlnesl(f rtrx p;t0openioeiatfm2eau p;t) lxoxf ootlpDrln o s0srtr(opoudaltemictlt  2urumo;t0tetomi3ias sDrmn s;(0 ltnxf tatlmDr i slt trum(r3ny4ol n fvt tfs2rm(monu4tex mf3iltlsDrmnmp;(4tlxomfcoytfateauei (0setoimpoydlmtnlfetltfsrtaxmp;o1tltnii3iydfs ulu snt0texrmf iatoa rlu i;s)s2xrxr iu4ap   fetas)srtr(mo;o4oex ioeiydfa2emu p;t4trxrmf3iy1fa e uvo (  2tmim3oo4ol   ictas)srta( p;u4oee mo3tys aDrl( s;(0areomo oy1la ran ols truo(m oudop emfei s artrxmp;u0apenmietysla2rlnmp;t0altoirciydfa  lneol(0 2trim nodapee fvi t)aDurur ;o0tpxnmiciysls2rm( pnt4texrxr oy1opDrln o;s0 2xoiopno1ale mnei t s2ra( oot4oeeomoeiasfaDem(mp;u)tlenmr3iytfmDe uei;( tetr(o nodol nlnviat aDrr(ro;t0texn feiydlsDulnmo;() exoir3oa1lpte ivs;t) euoxmpny1op elfvi sfs2raur nt4texoiocild m em(mo;t4aexnifctotfat lnei;(0 2tmirpiy4ap  lfvilt) rrrum no4apeo i3iatfa2eluvp t) etnir iotlm   i i s)srxr(opno1op elici t) Dumur ;o0opxo iciytfs uluvo;t)aetnxfctodoaD  nvo;( s2umio iu4ameemnvslsfsDrmurpou0olxnif3iltfa2emuvon(0 etrmrctydlmD livol(  rum(rpiy4lmt mnet sfaruaum ou1tpt mociydlaDulumo u4teenxf oy1omD an o s)trtm(rpoo1apee fvsl(fsDrm(r ot1tee  o3tyt s eln sn(4aeenmr oytfpDean i;( t2trxr no4llee nvs ( a2ra( o;t1oltnio3tydfs2elnvpn(4texoio oo1oaDeau s t0s2xmxm3iu4lleelfvil(f Dtmu  ou0tpe  fciyt m rmnmo;u) rerif3oa1la elivilt0 2toio3iodalee iciat a2ua(r no4tlx iociyd sDrmnmp;u0 lxnxr3oadlpDr ieo (0t2toxrpny4omte fvi (fsrrmxrp;o1aptn i3tas a2umn ont)aeenxo3ia1fp eau s t0t2trio iu1ol  lfctls arururpot1olxoif3iad mDrmuvo u4tleomo3oadfm ean slt) eumirpiy4lpe mies t artmu pnu4tlxoifeiasfsDrluvp;u4 rxoir oo1lpD  nvo;s seum(rpnu1lm nmncsa()srrrurooo4ole mi3iatfm2rmnvsnu)treniocta1fpD lnes;(0 2xo(m iy1openmfeia(faDrru o;u4aptnio3iyslmDeanmp;(4tlxoifciadlpDrli ol( t2um(o3io4om nlnet ( sDtaump;o1oetnif3iasfa rl(mpn()aexrmo3oytlptr nvs s0t2toxrpoy1amtemiesas) Dumur ;u0oee mociltlmDraumo;t4trenif3iotlmt anvo;s0 rtriopoodlme  nctls srurx ooo4aeeoifctldfs2eau s;u) rtnio3todfatrli s;s)texmio ou4lpte nci t) Dtrxmp;t0oexo oeiatfmDra(vs;() lxomo3tydomt aivo (  2to(mpnodap emfvt t)a2rr(mpoo1aexn ictltlaDrluvp t0tetrif oodoptraivi t) eumxrpny1open nciasf Dtru  nt1tptnmicilsla2ea( o (4 exoxf oydlmtelneo;t)teum(opio1omte nct sfa2tmu o;u0open i3tydfa2rl( onu)alxnxrcoodlmtr n ol()seurim oydaptnmfctlt)a2umump;u4aptnmoeiadla em( o;u)aetrir3totlateanesl()s2tm(rpoy1ame livils)sDtruroou1olx  fciydfm2umnvp ()tetnmo3tytoptr nvsl( trxrxopoy1lmeemnvs ( aDtm(mp;o4aleo ictasla emuvo (4 etnif todfate ueolt t2umir3io4optnlncias  2umxmont4altnmo3iyslm2umn snt)texrmfcio1om e uvilt)srur(opnudlmt mnes tfaDtaumoot0oeen iciat sDum(mpnt)trtniocoydlatrlu o;() euoxo oydale  fetls)sDrmx o;t4aetnio3iadfs rm( o u)teeoircoy1fm  livils texo(rpoodalenmnciatfsrur(mo;o4aleomieiltfa ea(vs;u4tlxomo3oadfptraivo s) exm(m io1lltelnesa(f Dra(mp;o4oetoioeiltls ra(vs u0 lxrmr3oatom elivols0tetmio3oo1ape  nvtls artmump;u1aeeomoctasfa eau s u0teeomrcootfpD  iei;t t2xo(rpio1olenlfei (farra( o;t1open feildlsDra(msnt4 etnmrcta1omDelnvo;()sexrxm oodop nlfct (fsrrr(m ;o1apx  i3iyd mDemnvsn(4trenxfcia1oa  aivi s t2tmxr3ny4optn ivs s) Dur(moot4apxnmfeiys sDemnmpnu0 rtnmocoo1fmDelnvi (0teuoxo iy4am nmiciat  Drrur nu0oexo oetyd aDuau p u) lenxf3io1lm  luvs (0t2tr(r no1llt mfesas srrmumpoo0olt iieildfs ulnmpnu)trenircto1opD aieo;s0trtmxrpnydaptn nvi (faDtm(rpoo0tex moeiatlsDranmpn() rtnxf to1fp rai o (  2umxm iu1ol emivils artaumonu4apx iociytls2eluvp u)alenxo ta1laD lues t0 2xriopnudopt mfes sf rtr( p;o4teenmfeiltfmDelnvonu4tlxrmo3ty1lpD aues;s0 2urxm oydlp  mivtat)aDrrurpno4alxoif3iad sDeanvp;()alxnxf3oodopD au s ( srurir3oydape mivtl( arua(m ;o0alxo fciytfa emn p;u) rxomo io1fm r uvslt trxmxo oydapenlfvi ( srrm(rp;t4aptnmociat m2ea(mpn() renxf3oa1fmDrau o;s tetm(mpiodoptemiviat)srua(ronu0tptoioeiadfmDel(vs;u) eeoif ootlm  lneslt s2uoxr3iu4ll emict t)a2rrxro;u4apxnifcias mDul(vsnu) eeoxr3iytopt auvs;(0 2xoxopiu4op nmivtl( a2ra(moou0oexnmf3iaslaDua( on(4 rtomf3iy1fpDe neo s  rtmir oydol emncta()aruau  ot4tlt mieiysfaDea(vs (4 rtrmr tadopt ai s s tetoxopoo4ap  mictl(fs2raxro;u1oetomo3tadlsDeau p u4teenmf3io1lmD  uvo;s)s2xmxo3nodlm elfcs tfsDta(rpot1oetnifciys aDemnvp;u4trxoxfcia1lpDeaivo;(0 exoxm oudomenlfvi ()s2rau  oo4opx  f3tatfm rl(mont) lxnio3iy1lpteluei;()teum(r nudlme mfvta(faDrrum nu4ape  fciatfs umnms;u0trxrxf oy1fpDraies;t0 rtrio3ou4op   nctl( a2raur no0tltoifetlt aDranmpnu4tltriocoodfmtelneolt0t2toxr oydlpe  nvta()s2rrxm nu0tpx iiciydlmDulump ()teeomf oytfp r uei (0 rurxr3oo1lp   ietat)a2uaxr ot0apt mf3iatfs2umumpnt)alerxocoy1fatean sls sruoio oodlme  ncs (  2tmxmp;u0optomi3iytla ea(vpnu0aexnxr3oo1lpDe ues t seur(r3nudoltn fvt tfartmxmo;t4apx if3tysfmDuan s;t4tlenxr iadoa eai o;s trxr(r3ny1omt  feil(farrm(mpnt1tet io3tytfm2umnms (0 ltnmf3iydfmDr nei s  2tm(r3iy4al nlneia( srra( pnt0tltn fciat sDrlumpnu)tlermo3tatfa  luei;s)tetrxm3ou1ame lfes s)sDtau  nt4tle  feiyd a umnmsnt)tlxoxrctydfptr nvs;t0 eur(m3nudamt livtas)sDrrxr ;o0tpen feiysla rmu o t0alenmfcoadlmD ln s;()trurim oy4ome mici s) Dra(m no1tlxoio3ias a emuvs t)tetrmf3todoa e uvi (0 rto(m3oudlltelnesat aDrrum ;t1apx  fciasls2rluvpnu4 eerxrctydfpDeln s;(  eumxm3io1ole  nei sfaDrrxmooo1opeo ociydfs rl(mpnu)texomfcio1fa rlivo s seuo(o io1lme  fvs t srrr(r ot0aetomo3ils mDemnvs u4alerxocoytfptelnvsls  2tmxo io4lleemnvs (  2trurpnu0alen fciyd s ean p;u4tetrxo tydfatelu o;(0 ruoxo3nudoptn icsa()srtaxroou4aexn i3iatfmDea( s;t4 etnmfcoatla rlnesls0 2xmir oy4lp e netlt sDtr(ront4oeeo fcild s2em( s;t) reoxr tadop elues;() 2uoimpio4ll  mietas)srrrurpot4tpxoioeiadfm2rlnmp u4texrxr iy1lpt lues s)trtm(o nu4am  licslt  2tru  nt1tee mfctlsfsDrl( s u) lxrxf oatoat an ols) rurimpio1alt lnctasf 2rrx  nu4optomo3ilt s2rlnvs t0 lxomf3oadomt lieolt srumxr3no1om elfcs t s2rmxrpnt4apxn iciydlm2rauvo;(4 rtoif3oatla  an i;t)trto(r3oo4llte ieias)srrr(m ;t4apen ictadla2um(vo;(4trtoiocto1omDrlieils texoxm3oudol e ictatfsDuau p;t1tpto i3tys a2rm(vo t4arxoifcoydom rlu olt) euoxo iodapeemncslsfaDrmxmont4tpx  i3iatla umn p;u4alxrxr ta1fatr i s s seur(r oydapeemfvtas  2ra(r ;u4tleo oeildfs ua( s (4 etoxf3ty1opDrln sl( srtrxm3nu1al nmnvtat srtrxr ;u4oltnioctytfa emuvp;(4aetnmrcty1om rauvo;s tetrir3ny1ll   fcsls) Dta(mpnu0olx mfetlt sDelnmonu0teenmr iodop eluvsl(0teumxr3io4lm n ivs t)sDumum no4aexnif3iad m ua(vo;() ltomr3oadfa rlies t)trxm(mpnu1lptnmics () rrr( p;u1ole ifeiyd a2uanvont0 etnir iydlateau ilt) 2urxopnydom   ieil( aDrruroou0apenioeildlm2rl(mp;u4trxoxocio1laDe i o s0s2tr(r3oydameelieia() rtrxm oo0ole  ieiydfmDrmums t4texomrcoatlpDraiesls  2xm(m nu1om nlfctl(farurx  nu0tlxoiieiadfaDemnvonu4 lxoxo3to1fmD aneolt)srumim3nudam e fet (fa2urur ;o0tpenmocias m2elnms (0tlxomf3ty1faD  ivi;(0trxoimpny4lpe lici ()a2rmxrpno4apxoiociytfa2rlnms (4 ltrmrctydlm r n i s  2xr(m3oodomenlictas)aDra(rpot1aexomociltls2rm(vsnu4aetoxo3ootop  lnvs t) rurxo3ny4al   nvilsfsDraxm ot1aex mo3tyslaDelump;u4 lenmf3oo1omtrlnvo t0s2tm(opnydop  mietas)sDtmu onu1tle mi3iatls2uauvs (4tetnio3tadfpte uvs;s)trtmxm nodlmenmnetlt)srtaxrp;t0oex mf3tadfs ulu o;u0aleoio3tatfpte n i;t0s2uoirpou4opeelicsat) rur(ronu4apx io3tytfm2ulu pn(0 etoifctydfptrliei;s)srxrxmpou1lmenlieia() 2urx  nt0aexomfctltlm rmn o u0tltnmfcoatla  au i;s0trurxrpoudamenmies s  Dumxro;u0tlt miciadfaDemump;u) eermf iy1oat aivi;s t2urio3iu1lmenmfeils) rrm( o;u4aex  i3iltlsDem(mp u0aleomrciatlaDraivsl() rxmxrpiy1altemfvi (f ruru onu0oexnmf3ils s2uauvp (0 renxrciadfaD  neols) rtrxm3no4omen iviasf Dua( pou0ole iicilt mDuanmonu4tltnio oytfmteau o t0setoir3nodomtnlfvt (fsDrrxmooo0aleoiieiat sDeluvo;(0arxoxo to1fptr u sl(0trtoio no1apt  nvt t  Dtax oot0oeenifciysfm2eaumpnt0tltoxr to1lpteluvo;s  exm(m ou1om  mnvilsf 2ta( o;o4opx  f3iysfmDrluvo;(4tlermrcoatfpD lu o;(0trxmio ny1amt mfciatfa2tmurp;o1alt  iciytlm2raumo u)aetrmfcta1fp  aues (0 2xoir3nydlm elfvi sfsDururp;o1tle miciytls2uan sn() eeomo ootfmtrauvi ( s2uo(m oudoptnmies tfarta( o;o0apx mf3iydfaDrm( p t) exrxf ty1lp rlnes s teum(m3ou4lmtn ivia( sDurur ou0oet  ieilsfm rmuvonu) etnio ta1lptr n o (0t2tmxo iydlme lnvs ()srua(mpot4oee  i3iaslaDrmu s;(4 rtrxo3iytlm  lu i t) rxrxr iydopen fvsa( sDrm(mpno1apxo fetld a2rl(von(4arenio3oytlm e u i;()srtrxo3nydol  mnvi s)sDuau ooo1tpt iieilt s2rmumonu4arxrxf iydfm eliei t  etoxr oudoptelnvsls s2rru poo0opto ociyt s um( pnu0 rxrir oytlaDelivsls0truoxm3oo1aleelivt tfsrtmxronu0tpenmoeiltfmDeau s;(0 exoxr ia1fpt ln ol()srxrir3io4lmtnlieilsfaDuax ont4tpxn i3iytls emuvs;t4 rtnio iodla e u slt)s2xriopnudalt  fvil(f Dtr(mp;u0tpeo oeiltlm umuvo;u4tlerir3tatlp  auei ()texo(o oydol nlivt (faDumxrpnu0tpe if3iyd a ul( p;t0aeenmo3oo1lmtr nvs t0srtrxmpoo1lpeemnetlt)aDtrxrpou0oexomf3tatlm ra(ms t) renxo oy1om  livi;s srurxopnu1open netas)sDtaumoot4oeeomictlsfaDrlu pnt)tetnmocoy1opt auvslt) rxrxo3oo4ol nmivi ( aDraumo;o0tlt  oetltlmDelump;u0trermocty1opDr u s s  ruoxo3nodamen ictas) rum(mpou4aexoifcildfaDean s u0 rtoxocoydop elneslt0 rxm(m nudom elfvt tf Dta( pou0teenmf3iatlm uan o (4 exrmr3iodfmDelu slt srtr(m3oudll   fcsltfarrrxmp;o4opt  ieiydfa ea(vp (0tlerxrctotoa  lnvi t0 eumim3oy1lltemncsasf Drmurpnt0tlt mocilsfa ulnvont0 lenif3ootlmDrlu o s) rxrxm3oydlmt mnvslt) Drm(  ;o0tlxoifciatfs2rauvp;u0arxoiocoa1fat  ivs;s tetoirpou1altelnvsat srur(mpou1aet mo3iys mDrl(vs;(4artoirciytlm eaueolt0teumimpny1al nmicil()srtmu  ;u1ape miciatfa eanvo;t4tetrxf3tytfp   u i t)sexr(mpoo4omen ivsa()artmxrooo1alxomf3tat mDulu s;u)trtrxf io1fpteanvsls teurirpnu1ll eliei t  Dtm(ronu4alx iieiys a2em(mpnt0texoxociydlm raies;s0t2xrxr3iu4ome mies ()sDur( pot1tlx iictad aDua(vpnt)aeeomr oatfp r ivo s  ruoiopoy4amen ivtltfarrmx  ou0apt moeias m2ea(vsn(0alxrmf oy1faDranei;t s2xrxm iydop n nesatf 2tm( o;o1optn ieiysla2elnvs u0altrmr iytopD lu s ( teumxr io1lltelivils srrrxrp;t4oex mo3iyd m2emnvsnu0 rxrxfciy1lp rluvs s)texmxmpiudllt mncsas  Duaxm nu0oltomfcilt m2eluvpnu) rtrmf ia1lpDrluvs;t)srumiopno4lle mnct sf Dururpnu0aptomfctldfm2umnmp;u4 ltrmr tadoaD  n i;s)trtmir nudlptemivt sfarumu ooo1oexnmicildfs2em(monu4altoxf oadfpDe u s s  eto(o oo1lm nmncsa(f Dtru  oo0tetn feiytls2eaumo;() exnmo3tytlm eaivs;(0trxoio ou4ape mncsa() Dtaxmono1altomf3iadlm ea(ms u4altoxo3oadfmte ueo;s0teur(opiu4alt lieiat aDumxm ;o4aee  oetydls ulnvo;(0aeeoxo tadla eln olt)srtmxmpiy1ale mics ( aDrr( onu0texo i3iys sDrm( s (4 renxr totfa r ieo s)s2uoxm3ou4omtn fvtlt  Dtrxront0tltn f3iydfaDrlnmsnt)aeenmo3oa1fmt  ieils seum(m nodlmtn fvsatfaDua( ono4tpx  fciytfm2ra(vp;(0aetnxo3iydfmD livi;t0 etm(r nu1omeemfeta( a2rau p;o4oee ii3iltfa rlumo;u)tlxrxo3oo1lm r u i s  2triopnydoltn fesa(faDrmurpnu0tltniociat sDrln s t0trtrxf3ia1omDeanei ()t2tm(m3nodoptn fesl(  2um(  oo1tpxomo3iad m el(mpnt)trtrxf ootlmt lueo;( teuoxopoudolenlnvt t aDrmxm ;t0optoioctas m2emump;t4aetnmf ia1lpD luvo ( teto(m3oudale lnct (fsrumx pno1aet mf3iysfs2um(vo;u4 etoxr3oy1opDr ueolt) rtmim3oodopen nvt ()a2rrum ;o4opt  ociyd m2umuvonu4trtnxr oytoaD aueols0srum(o3nydllenmfctlsfs2rrxm nu0apt ifctytfmDumuvsn()trxoxo iy1lp r i s;s0t2urim3nu4oltemfesls  Drm(mo;t4oexnmoctysfa eluvsnu0aeerxoctatfm  luei (0texr(r iudlptn netat)a2rm(mpot0tltoifciasfa2eluvp () exnxr3iatlaD aiei;s0 2to(m oydope livsas a2rauroou0altnmi3tlt a eanmo;(0 rtrxo3totfm  auvol( texm(o3iu1ome  fvsl()aDtau p;u1tpe mo3tlslmDuan s;(0arxrxo iydfaDeauvs t0tetrir io4alt  ictls)a2ua(r ou1apto i3iatfsDean snu0 etnmocoa1oatelivs t)t2xrim3io4ol emnci t aDtaxmo;t1tlxn oetadfa2em( snt0trtoxf to1lpD anvil(0 2tm(m nudop elfeil( srur(mooo4apx  i3iadfs2ranvp;t4artrxr tatfaDrlueo s) rtrxm io4lmt lici (fsDrm(mo;u4tleniociasfs2umnmp (4tetnxrctodom rau ols0 2toim3oy4lpenlivsls) Drrx  ot1tet ifetydfmDuanmp t0 rtrxr to1la r iei;s  2xmim ou1opt  nvi ( sDtru p;t0opeoiieiyt m ra(vp;u0aetnxo iotlmDeliei ( t2xmiopiu1apee fei s)srrrxrpnt0aeenmf3tldls elu s;u4altrxf iytlmDr i s (  2xmxrpou4apeemivtltf rumumpoo1aex micildlmDrmnmsnt)alxriocto1fat livsl(0s2ur(m nu4ope  fvtlt  2raxm nu4oexn oeiasfs ulnvpn(4tltnircoa1lmtrlivols trxo(mpiy1ame lnetls s2uaxmpnu4tlt mi3ildfs2ulu s t4 rxomo3oadom ranvol(0 2xmxr3iodameemivtas) Dra(  ;t4apeomi3tasfm rlu o;t)tetniocta1fpD aieo s0 rxr(o nydlle mfcs t)s2rmu p;t0oex  ocildlm2eauvp;u0aetoxr3to1omDrlnes t0texrir oudaptnlict ( a2tau  nu4aeenmf3tydlsDemumonu4tleniocoytoa e uvslt0 exrio ny4lm nmnvtasf rtm(  oo4oetoiieilt s2umump (4 lenioctotoa  anei s  euo(opnu1opeemnvsat a2ua(m ;o1aetn i3tadfaDeauvsnu)trenxfcia1fatrli o t  rtmxrpiydlmeelnci sfs2rmur ou4opt moeiys s2emumo t0treriocia1lmDe nvs;s0srur(r iu4am emnvs t  rtrx  oo0tlxniieiytla ea( p;u)treomr oo1oa e i i;t)t2trxmpoodoltelnviasfaDrmur nt4tpenmi3tysls2em(vo;t)aetnio3tytlm rluvo ( t2uo(o no4ll e fviat)sDrrur ou0tetomietlt m ul( o;()altoxf ta1oa  anvo s sruoxopou1omtemieil( s2rm( poo1apx mo3tldfs ra(vp;u4trtoxr ty1op   uei;t  etr(r3no1ole lfvs sfarumur oo1tpen oeiadlm rmnms u)aexrxr3iytfa eau il(  2xo(m3nodam  lictlsfa2taxmo;o1alx ifeiytla rl(von(4trxrmo3todlaDeau ils0srtmir3no4ome lneslsfarua(mp;u0tlt  o3iadfa2ra( p;() etrmf tatlaDean o t)texr(o no1al n netl( a2trurooo0aleomoeiys aDeluvs u)trxomo iy1omD  ivil(0sexmim3ou1lle  fet ()sDra(  nt1tpxomfeiltla2umuvp;u4treoio3ta1lpD aneo;s  rxmimpnu1apenlnetlt  rtaur nt4olxnmfeiasfmDumnmpnu0tltoxo oatfm raueils0s2uoxrpnu1omenlies s)s2umxmono1aee mi3iat a2eanmo t)arxnio3oatfmD  nvo t0texrxrpou4lp nmfvtl( sDrmxr ;o4olenmociltlaDuaumo;u0 lxrmocootopt an s s tetrir oudlp elfesl(f 2um( ooo0aeeniocildla2raumsn(4 rtnmrcoadfm elivol() 2xrir iy4altnlfvtat)arrm( pou1tlt  o3iydfs2rmnmsn()arenxf3iodlp  aivo t t2umxr iudoltnmiviatf rrr(  ;o0opxnmociasfsDean pn(4aexrmf3oydlmDrlivs ( sexoxo3oo4lmt mncils) Dtaxm oo0ale mfeiad a2ua( o u)trtoircto1fm eaivs ()s2tr(r3nu4amtn ivsat srtmxroot0ole  o3iys sDra( s;t0tlermo3iodlmDr u slt s2uoxo3iu4ap  lnet ( srrmxm ;u0aex ifeiasla2elu o;()aexrir oo1opt luvi;s sexr(m3iudlmee iet tfaDurump;t1aee mieiltls umu pn(0arxrifciytlmDeai ilt)texr(rpou4ome  fetl(f 2tax oot4oexomieild aDul( s (4 rerxo3totlpteanvi;t) 2to(rpiudlm  mfciasfaDuau p;u4opxn ictadlaDeau s (4aetoxr ia1lpte ivo;t) rtr(opoo4am   ivta(  2tm(moou0aeto icildfm rmn p;t4tetrmrctodfmt lu sl()seuoir3nudop elnciat srtrx o;t4oltn fciatfs2ra(vp t)aetrio iotfa eai ol() 2xrxmpno1olee icil() Draxmp;t1oexniieiyslaDrmn s ()tlerircoo1oa e nvs;(0 rxmxr3io1lltnmnei (fsrrm(mpnu0ape  feild m2ulu p t) reriocoytfp elneo;t srxoim3oy4al elfet t s2urxmp;t4texo fciyslsDrmn s (4tltnxo3tadopte ieol( srtmxm nu4opt livtls a2rax ont4apx  fcias aDrluvpnt0 lxrir todfmDeauvi ()srtmxm3iydll e ivtl(  rraumonu0tet if3iysfa2rl( pnu)artomr iy1lmDelnvi t0sexmirpoy4ap e neta( s2ur( pot0apto oetas s em( ont4trerxo3tydlaDe u ilt sexrxrpiu4llen ieta()artrxmoot1alt  fetls mDrl( s t4 lenxo3iadoa eln ol(  exriopoo1openlnvt ()aDta(mp;t1oet mieils s2eau p;u)arxnxf3tadla r uvi s) rtrxopnudom  lfvtatfarrm(rpot1oetomocildfmDrauvp;()arenir3ia1fmt ln o t0tetrxm3nudope  feia()sDurumo;t0tpx moetaslmDuan p t0 rtrmfctydlpDean s;s teur(m oydolt mnctls) Dtaxronu1alt mi3tatla ul( s (0tlenxr3iodlaDrlnei (0 2tr(r oy4lp nlfctas)aDrrx o;u1olx mieiasfsDuluvs;()trenmr3tatlmDrauei;s)t2tmirpnu1lmtelivsas s2raxr ou0tpx ioeiys a2rluvp t0alxnxfciotlpD lneo s0t2xmir3iudlmeemfvslt)srurur ;u0alen o3tlsfsDem(vo;(0tlenmrciatop elivs;t  euo(r io4amtnliesls arraur ou0opeomoeiad aDul( p u)tetoir3tydlat  nvi t0srxrirpio1apt lnvsl( s2rm(ro;t0olt iociat mDraump;t)aexomf3tadfatrlivil()t2to(opoudlpeemfvia(fsDrr(rpoo1aee iietat s ran s (0artrmociatlm e u sls) rtmim no1lptelnvilt s2tr(m nu0openmfciydls rmumsnt4trtnioctytla   u i;t  euoxm oy1lmtn ieiat)a2taxmpnt4aex iieiyslsDuan s t0alxnxf3iy1fmDrlueolt t2uo(mpoydol  lfesa(faDtm(rpno4tltoif3tat aDra( pnt0 lxnmrcty1fa raueo;(  eurxr iodamenlnvtls)s2rrur no4tltniieiadfsDrmnmp;u0tetnmf oatopDr nvs s sexo(r nudomenmnvt (f 2ra(m ;t0oetomi3iyslaDuauvp t)arermr3tytop e ivs () rurio3ny1ol   fvias) 2ur(r oo4altnmictyt a2ul( o;(4trenifcoydomDrlues (  euoxm3nu1lptn fcs t srua(m nu1tetoiociyd a2ulump;(4 rtoio3iodfpDranvils  euoio3oydom  licta()a2trxm ;u1tptoifeiydlm um(vp;(0aexrxrctydoa eauvilt) rur(m3io1lme  fesatfarrm(mo;u4apx miciyt a emnvo (0aleomfciytfm e nvo;() rtm(mpiu1lm elfcilt a2tmx p;o4opt iociyd sDrauvs;u)trerxo oydfa r n i;s0 rxrio iudam n fvi tfsrrmumpno0apx  ietys s2rm( p ()trenxoctytfm rlieolt)setoimpno4om emfcil(fsrua(ronu0apenmictltls2ra(ms u)tleoxr iotlpDrauei;t)s2toxrpno1llt  fet ( arraxm nu0tlxniictlt aDel(mp;u)artnxr3ia1fmteauvi;t0t2xrimpnu4om  licslsf rtaur no1tptomfeiysfm2rmnmo;t) lxnifciatoa   n i;t0tetmim nu4lpt  fei t s2rm(mpnu4optnii3iadla2ran p;u4altnio tatlmD  u ilt trtoxm3oy1llt lictat)sDtm(m nu4tpen ietadlmDrm(vo;t0trenmo tatlp rlneo t)srxoxr oydoleemfct () 2tauront4oeeomi3tltfaDelump (4altrxociydoaD  uvo;( t2trimpiydapenlnvtatf 2tmuro;o4oeeomi3iatfs rmn s;t0texnmr3oa1lp r neilt0teum(rpny1lle mfciat  2rruro;t4tee mfcilt mDua(vont0teenxf3totom rlivo () rxo(rpiudopt mneils)sDtmurpot1tltoiociytls2umuvsnu0trxrir3oa1lmDe ivs;t) etmimpoydam n feilt  Dum(mp;u4tleomi3iysla ulu pnu0areomf3iotfpD  i i;() ruoio3oo1lmt lfetl()a2ur(  ;o4tpx mi3iltfmDean o;()aexoif tydfa e n s t)trtrim oo4lmee ivsasf rta(  ot0tlenmoctytfaDuau o u)trtrircootfpDrau s;t sexrio3oy4altemnei ()s2tmxro;u0tetnmi3iatlaDelu o;() lermo todoate n o;( t2tr(r oy1omenmnetatfaDur(rono0alen oeiysfm2rlnmpnt4 lxrxo to1omDrlu o t s2to(m nudlptnmnvt s  rtmum nu0alenmictadfm2rl(vo () lermr3io1oaDr n o ( seto(o3oodoltnlnvs () 2urum nu1oltnioeiasfs2ean on(0trenifcio1oat  i ols srtr(mpiydamt lnet s)srrm(rpnt0oexomfciat sDrm( p u4aeeoio3iydlaDeln i t)sexrxm io4lpte fcs tfaDuru oot4optnmieiysla rmn p;() eenxocoo1lp eaies ()srxoio nu1aleemfet (f Dumumpot4openmfeiytlaDemn s;u4trenmf3oy1fp rlivslt0trxoxr nu4lm  lfct s  2rmumo;o0tpto i3ilsfsDrm( s;t0tleomociotlateaivsls s2trxm3nudape  nviat)artmx oou4aetn ociyt a2rm( pnu0 rtrir oytfaDrln slt0trumirpio4oltn ivta(f rurx ono4tle iietat m umnmo (0alenxo oy1op e ivsl(0srumio3io1optnlncsls)s2tm(mpoo0tpx ifetatlaDumnvp;u0 reoxf3iatoaDr i olt0t2tmir io4lltemivtat s2ta(r nt1aetnmi3iat m2emuvonu) lxomr3iydlmDrau i;s0s2tmio ny4altnlfvilt  Dtaum ;t4apeo oeilsfaDrmu p;()trtnxfcio1fpDranvo;(0 rurir oo4opt mnvs ( srumx  oo0tlxnioetls m2rl(vo t4 rxnmrciydom   uvi;t sexrim3oy1olee fcs tfarur(moou4tee mo3tlt m2rm(vpn(0trtnxf iydfp eauei s)sexm(r3iydlmtnlncsas srrrumpno4apxnifeiad s2elnmo t4teeomf3to1fp   ivo;t0 2um(m iydap  mneia(faDumu pnu4teeoii3iys a rm( ont4trtnif iatlpteaivil( seuoxo oudlpe  ivtas)arumu pnu0tlxomi3iasla2elumsnu)aetnmf3iotoaDe i o;t seurio iodapeelietls s2truro;u4oeto feildla2rmuvp t0arenir ia1fmD  i ol( t2xo(r3oo1oltemies s) rtrx p;t4alxnifeils a2uauvp t4altnxfciodopDraieo () exr(rpoudopeelfetl() Dtmu pnu1apxnmociydfa2rl(ms u)arxrxf3iy1fm elnei;()trumxo3oy4lmen ivt t srururo;t1aee ifcilslaDelnmo u)texoxrcia1fpDrlueols trtrxo ou1ap  mfvt s srumxm nt1oet mf3tldfmDeanvo u4texoir ia1lm  lnvo s0t2umir3oy1lmeemnvt tfaDuax pnt4tpen oetydls2em(vonu)tetomfcoo1fp   ivi;(  2tmio ny4op emneiasfsrta( poo1aexo ictatla rau o u4teenmocta1lp raivo (0t2toim3io1apenlivs (f rumum nu0tptnmf3ild s rln pn(0 rxoir io1oa  anesl()srumxm3nu1lmte ictls s2ra(rono1oleniiciatfmDrlu snu4 lxrif oa1op  ln ol(0s2tmiopnu4lp nmieilt)aDrr(  oo0oeeo oetltlsDrmums;u)texrxf3ta1fm   ies s)trxrxo3oydomee ivi t  2urur ou4aee mf3tasfa rmumsnu) lxnio3to1opteluei (0s2xr(m3iy4lmt mnetatfsDtru p;u4texn o3iydfm2rlnmo;t4trtnxfcty1lmtrln sl() rtoio ny1apenmfvtlt)s2ta(ro;o4olxnio3iadls2rluvsnu4trenmo3oodlmteluvsls0srxrxmpnu1lmee fct t s2trxroou1alt mf3tytfm2rauvs (4trtrxf3to1oaD li s s0 eumxr ny4open nct ()sDurxrpnt4oltnmfeildfs uln o t)tlxrmo oatfmtran ilt0trxr(mpiudop  mnvtat sDrrum ;o1oet iieiadfmDumums (4teerxociadop   uesl(0setrio no4aptemiviasfsrtrxr nu4texo oetyt a2umnvsn(0teeniociytfa eluvils)t2toir3iy4amt lnvsls s2urumonu4opxoioeilsfsDum(vsn() leoxf iy1fpD  nes ( tetm(o io4lltn ici tf 2urur nt4opx miciasla emnmo;u0texnxo iodlaDeluvi;(0 rtmimpou4lpte nctlsf 2uaxr nt1opeoio3tlsfa2ul(vsnu4tetrmfcoa1lateaivi t t2xmir3nodame  ietat a2uaumonu4oleoii3ilsls em(vs;t0trtnxfcto1omDe n ols) etoxo3nodlm emnvtas arumumpnu1alxnmieiytfa2ranms;t4tetnxrcoadfaD aivs;s)t2urxopoudaltemiet () Drauroot0tlxo o3iyt mDran s (4treoir3ty1lateli s t0s2trirpiy1omenmicia(fs2uru p;u0tet moeiysfs ul(vs;t4teerxo tadopt ai sls0 exm(o iy4olenmicilsfarrrumono1opx if3iytlm2rm(vpn(0aexrmr3iodlmDelueil(  rumiopoy4lme mieilsfs2taxrp;t1alt  fcilsfs rmnmp;u)arxnmr3oydoat lnei t)tetoimpiy4amee fet () rur(rpnu1tpx ioeils sDuauvp u4trxrmf3oo1lpD lues;t0setm(r iy1am  mnetas)aDrau  nu1apen f3tat m2emn p u0 reoif3ootop rlieils)sexm(o3oydamenlneiasfartm(moou1apxnii3iadla2em(vo;(0aexnxfctydlm eau olt0t2xoimpoy4amen feil(fsrururpou4tet  oetld m ranvonu)trtrmfctatfat auvi (0 rtm(m3iu4alen icta()sDuax  oo4oltnioetys s ulump;t0tetrifctytfa eauvo ()trxmxmpiudal   ncsatf rtmx o;u0aeeomoeiytlmDuluvp;(0 lxoif3oadoaD an ol( t2trxo oodlleemnvtat)arta(m ot0texnmf3iytla emnvpnu0treomf3iotlp r i il(  2umimpio1aleelnciat srrmu  ;u0olenif3iatls ua( o u)tlerif iydfa  anei;s0 rtoxo3iudom elfcil()artrxmpot0opeomfeiyt aDeanms;u0 rerxoctydoatr ies;t tetrir3oydll elfvi ( s2rmxr ;o4opx mfetld aDelnms u0 ltrxfciadoatr uei () rxr(r3iy4lpen netasfsDrrxm ;u4aeeoiicilslmDumn o;u0arxomr iadfm  aiesl(0t2xmir iy1om nlfvilsf Drm(rpnu0alxnmf3tldlm2ul( sn(0trxnxfcoa1laDr ivo (0t2xr(mpiu1olt mnciat  Drmx p;t1aetomiciltlsDem( s u0trxnmf iotfm elies;(  exo(m3oydolenlictat) Dtmxmono1oeeomfctydfm2emnvon(0arxnxfcoodoaDranvi t  eurxrpou1alt mnvil(faDtax  ou1tpx ifeildlmDuanvo;t)tleoir3oadla raues () 2um(opnu1al   ncsl(f Dtmxrpot0oexo oeiltlm emn pnu0altnmocia1fmt  u o;s) rurxmpou4lptelietatf Drm(r ;o1alxo oeiadlmDeanmp;t0aeeoxrciadla  aivi;(0seuoim3oo1llt mfeta() 2um(root0apt ioctad m2ea( sn() lxoifcia1fp  lues;t t2to(o nydal elivs t) rrm(rpnt0oexnmo3iydlm uaump (0tetrxf iadfaD aues s0 etoxo3ny4ap  mnesls) 2raump;u0tpeo o3iys a2rmuvo;()artrir iadfp  li i;s0 etrimpoydllenlnei t)sDrmxmo;u0texo o3tad s2rm( s;t4 etnif3oa1fate u sls tetoxr3ou1ameemncsltf rum(mo;t0tlxoioeiasla2rl(mp;()arxrif3iytopteaies t  ruo(m nudlp n ietas) Duaumont0ole mfeiyt mDem(ms;t)aexoio io1oa  ln olt)sexoim3nydome  fvi ( artaxm ou1tex  i3ilsfm rlnmont4trxrmrciytopt lnvsl( teumxopou1ap nmncsl( arraurono4optn fcilslmDul(ms;()aetrmr3iy1fpDrlivsls) rur(rpiodopee nvils)srur(mp;o1aex  octatlm2rmuvsn()tlxoxr3oo1fm raueslt)trurxo3no4op nmnvs tf 2ra( oot4tptnmoctaslaDua(vo;(0tltomf tydomDeluvol() 2xo(mpiudaltnmfctls)a2rrxmo;o4alenmoeiadfm emn s;u)arenifcoytopD  n s;( tetmirpno1op  lfvs t  2ur( pou0olxoii3tldfs2eanvs (0 etoircio1op rluvi ( s2xrimpnydlme lneia(faDtrxr no0texnmociasfmDua( snt)altoxo3oydfmtr iesl( s2trio no1ll emfvsa()srrau  oo4opxomo3iyslsDum(vont)aeerircoy1lm e uvs t  etrim oy1lle mict ()aDuaurp;o0olen o3iltfm rmu s t)arxrxo ty1fmtr uvs s0 2tr(o iy1am elivils  rurur ;t4tpxoiictlsls2eau onu) lxomf tatfa  auvils)srtoxopiydap elici (fa2umu pou0tlen ictldfs rl(vont)trerxr3iodla   ivi;(0 2toxr3no1omeelics (  rua(  ;u0opxn i3tadla eanvo t4 etnif3tytlp eaivs t)teum(m3oo1amtemicslsfsDua( o;t1oeeoio3iltfa rlumo (0trtrmf ia1fmt auei ( texm(opoy1ape lfesatfaDtrum no0tlen ieilsfaDra( s (0aeeoif ia1opD  u ilt trumimpoydomtnlnei t)a2trxmpoo1texomfcias s2elump (0aetrio3oatlptr u olt0s2urxm3ny1lmt  nes (fs2tm(rp;t4aleoifciltls2umn s ()arenxrciatfat lueo;s0truo(o3ny1omtnmnvslsfsDtmurpnu4tlto ociltlaDrl(vp;t)alxnir ia1fmDrliesl(  2xo(m oydlmen ncsl( s2uaur oo1tpt  fciltfs2em( o;(4 lxrirciadlatrauvs s0t2xo(mpno4llt lfeiasfarum( poo1ape iociydls ran o;u) etnxr3oatomteln s;t0 eumxr3io1optn ivsls) rumu p;o0ape mi3tadfsDranmsn()aetnxr3to1fptranes;(0 eumxm no1op elict ( a2tax pou0tle  f3iltfsDrlump u)aleomo3tydopD  neo;t s2toir no4open ncsas)aDtr(mpnt0aptomociys sDuau p;t0 rtrio tytoat anei;( s2trxo nu4amt  icil(fa2urur oo4optoif3iadfaDrmumo u)tleoxf3oo1fptrlueslt teuo(o3nodlpeemivil()artr(mpou1oeeoiiciadlsDrmu p;u) etrmf3iotlp eli ol() rurxopoy1olenmfcsltf 2rr(  ;t0oex  o3iadfmDuauvo u) ltoifciatlpD  uvi s0teto(o nudlm nmfvslt)srtrx  ;u1olxn f3tls a elums t) ltnxo3tadlmDraueil( srtr(o oudoltnlnes t s2uaxmp;u0tpe  f3ilt m rmnvs;u0 ltomo iytlp ran olt)s2trxr oudlm  mivsl() rrrx o;o1tpeoii3iydfs2rmnvpn(4alxrxo oo1faD li i s  rurxopiy1lm nlivs s)srrm(mpoo4alxnif3iltfmDemu sn()tetrxf totlmDelieslt0seur(r oo4optn fciat srtru o;o4oleomf3tytls ra( snt)trxnio oatfatrau i ()sexr(mpiudom  lfet ()s2trxr nu0aptomfcildla2eaump u)alenio3ootla eai slt)trxrxmpou1ame livtls  2rrur no1alxniociatfaDelumpnt0 lermr oa1fm   n ols) 2toirpnodlme lietatf Durur ou0oeeomi3iltlm ua(mp ()altoio3oytfmte nesls) 2urio iu1ale miei s)srra(m nu1tpxnifeilsfa2rmuvs;(4 lenxr oodopt lneo;t) rxriopnydom  lnet s sDtm(rp;o4texn ietlt m2rm( o;t) ltoxr oa1opDeaneil( trxrim3nodapt  ivia()srrrxr ;o4tpe mi3iadlmDum(mpn(4 etrmocio1fmDelieolt) etoio3io1lle lfet t a2ra( pnu1texo i3tldls eluvo u4alerxfcoa1lptr n slt) rxo(opou4lmeelnci s srtaur ot0oetnmociyt m2umnvo;u0arxrxociodfmte i i t0 2ur(mpio1lmeemiesls aruru  nt4tlx mo3iyt m2ulnvp ()teeoxf3iatoa eau slt0 2uo(mpnodomtelicta() Drrxront0olen o3iad s2ra(vo;t0tlxomo oatoatraies s  etriopnu1lp nmfvt t)artr( p;o0tex  iciltfm elu p;t) rtnifctadfaD lnvilt) rxo(r io1amen fvt s a2rr(monu1apxn octytfm2umu onu)artrmr tatfm  liesls0trtmxmpou4lptn ictls  ruru ooo0olxomfetydfaDel( pn(0artoif3tatopDr uvs t0sruo(o ny4ole micias  rra(m ;t4tpe moctltlm2ea(vont0texoxrcty1fmDe uvolt texo(rpou4ll nmiesa() rua(rpnu4aeen ieildfa2ean s ()altrif3iydlmteaivi;()teur(o3ny4ol nlicsa(  rtau p;u4tet  feiysfaDemn sn(0aexnir oydopDeau o s0seumio3iydalt lieta( s2ra( p;o0aleoiiciytfs2rlump;u)altomrctydoa  anvi;t texmim iu4ap n nvt (fsrumxmpnt1tpt iociyt m emnvo (4 rtomf3oydomDe ies s0 rur(r oudomtemivt sf rurxront4aexn fetadfmDemnvs;u)alxoifctydfatranes t srtrir ny1omt lfvsatf ruau  oo1aleoif3iatls ul(ms;(4 lxnir iadfpD anvi ()trumio3iy4ome  fetl(farrau  nu0opt io3tltfs2uluvpnt0 ltnif iadlatrln slt0t2xoxr3oo1opt  nctlsfsrum( p;t4aleomo3ild a2ean o;t)tetnio todfmteaneols)trxrxopoydlltnlfvs tfaDtmxm ou1apeomo3iytfs2raums t0 rtomrcootlatrlneil()trxr(r nu1alen nviat srtmxr nu0oeeniieiyt aDelnms t)arxrmo iadlmteaieolt)trurio oo4lpe  feia( aDrm(mo;t0open ictatfa2rlnms;u)arerxo3oatla e neolt sexmxrpiodll n fcs (faDuaxmo;o1tlx ioeiad aDran sn() ltnmrcio1lm rai o s0s2to(m3oydomeelnei s aruaumpnt1apxnmietltfs emnvs (4tlxomo tatlpDelies;( s2xrirpoo4oleemictls  Duaxm ot4tltomoetlsfm2rau p;()aeermf3iadfa e u i (0 eumio iodopt lfcsltfsDuau p;o4tlt ifeiltfaDrm(mo;u)tetrir3ty1fm elieols0 rxmxm3oo4omtnlnesa( s2uru ont1aleo oetys m2ra(vs u) rxoxf3todfpte n s;(0t2uoim oo4lpe mnctl(f rraxro;o4olen icild s2umuvsnu0texoiociodoat lueo;s0srtmim io1amt  ivil(  rrm(ro;o1oleomfeiysfaDranvo (4tltrxr iydlaD  ieo t  rum(opoo1ale lfvsl(faDtrx ooo0tleoioeias a2emump;(0 reomr3oo1faDe uei;t  2toxm io4olt mnctatfsDuax  ;t1tpx iociatls rm(mpn(0tlxomfciytfmteaieo;s t2xm(rpoydlpenmicia(faDta(m nu0olt iociadla2uanvs (0artomrcoodfa eliei t truoxmpiy4llen nctls aDuaxronu0teen o3iytlaDeln o;t0 lerxociytopD  uesls) exoir oudapt  ivs tf rrr( poo0tptomieiysfm rmums;t0 ltoxo iadopt lu s t0s2umim3iudalen icsl()sDtm(  nu0oeenioeiasls eanvs t0 rtrmfcty1fmDrai s ()trxo(m ou4omee nct () ruaurp;o4oeen ociadlmDuanmp t0tlxnir oytfmDe ivsl() etr(mpiy4lptemfct t  rrm( p;u0opxnmf3taslm2umumsnu)artnxrctotfat lu s;t) exo(m oy4alen ivt sf 2ra(moou4ape  o3ilt m um( p ()artoxr3totlptraivo;()t2trir3iodapee fvs tfs2raum ot4tpt iicildla ea(vp;t4altrio3oy1fa r ueols0teum(o io1ol emfci tfs2rr(  ou1apenmi3iydla2em(vo t0aetoir tadfaDr ieilt0 2uo(o nu1ll nlies tf 2taxmpoo1tetn i3iyd aDrmnvo;t4 renxfcto1lp rli o;s) eum(r3iu1ol emfvslsfs2ra(mont0texo iciaslm emn s;u)aexriocty1omDeaieo;(0trtrimpiu1ll emiesa()a2um(  ;t0opxo feias a2em(monu0aetnmf iadopteauvo t t2urimpoodoptnlfcsa()s2ta(r ;t4oet iieiasfa2ulums;t0aeenmf3iadfpte u o;s) 2xo(m iudale mivs () 2raum ou4alto fetadfs2eauvonu)trenmociytlaDe ueo;( t2tmxm iudlpe lncslt s2rrx  nt1tptoiictltls2ua(mont4 ltrxrciatfpDeluei;t0 rxr(mpnu1aptnmfcsa(  Duaxroot1aptomfetatfs2em( sn()aexnmo tatfpDe i sls)srum(rpoy1ap e fcs t)arumx oou4alxnmfeiysfaDua( p;() rxniocoydopDe nes;( t2toiopiy4amee nvt ( sDuax poo0oetnif3iadfm2emnmpnu) lerir tytoaDeanei (  2to(o3ou4lmee ivi s) 2tmxr ou1ale  fctas m2emuvo;u4texnmr oa1lp rauvolt)s2urirpio4op   fvilt arta( pnu1altnifctad mDemu p t0aexomf tatlmD aieo s)s2uo(m3io1oltelfei s) Drm(r no0tpe mf3iltls2uauvs t4aetnif oo1omDeluvi s0 exrxm ny1omenmivs s  2uaum nu0teen i3tat mDrln sn(4artrir3tadoat lnvo;()t2uoirpiy4ol   nvs (fsDtrumpot4tlx if3tydla2umn p t)treoxr3iotfmDeliei s0setm(o3no4oltnlnes s a2ta(mpnu1tpe mf3tlt aDuanmp (0 ltnmo iydfa eaieils  rto(m nu4lm n ict t)a2rmxroot1aetnif3iydls2rm( o u)aleomf iy1lm  ai o;s0t2umxo nu1llen nvtat)aDtmxm ou1olx mieiad sDeluvp t0alxnmfcoydfa rln s;t  rtmxo ou1om  lfvs s) 2umxm ot0tlxnmfeiasfm ra( o;(4artrif ta1oa ranes;(0sexmio io1llt  ics ( artm(  oo1alenif3iasls rauvp u4aeenir ta1lmteaivi;t) 2xrxrpoodole  netls) Dumxmono1apx  o3iytls2uluvo;t0 ltnmo ty1laD auvol(0trtrimpiu1oltnmivsltfarrmx pnu0altoiociat sDemnms;()aexoxocoo1fateai olt)srxo(r3oodll nlfet sfarrr(rpot1aptoii3iatlm2ra( pnu0aleoio oydoat aies t0setr(mpoy4ape  neil(f 2uaum ;u1apen oeiatls ua(vp ()trxnmo totom r nei t0 2umim no1lltelieil(  Dra(ro;o4aex  feils m ean pn(0tltnif3tatoaD  ieilt0srtm(mpiy1lmt mfci tf 2rrxro;t0aetoiiciydlaDemnmsnu)tetnxfctodfmDe n o;t0 2xr(r ou1lme mneia()s2tax p;u1olen ieiat mDuau pnt0aeerxocoodfpDelnes;s t2xmirpio1ll n fetls)sruru ooo1aee ioeild s2rmn s ()alermrciadfm  li slt)sexr(m3nu4amtemfci tf Drm( oot4tlxnmf3iydfs elnms (0alerif ootlpt aueslt  etrxopiu4lptelfeia()a2raxr ;t4tlt iietltla2uaums;t) lxrmo3tatopDrlnei (0 etoxmpiu4amte ictl() rrrxmonu0aex  ocildlmDrm( o;t4arxnifcoa1opt aivsl( s2uo(m3oo1lpen fvsl()arum(moou0tee miciatla2rln s;t4treoxr ia1oatrlnvo;s)t2tmxo3nu4opt lfetl(f Duax  ;o4aet mf3iytfa2rl( o;u) renif3tytfptr nvo;t sruo(o iu4al elfci ()srtrxr oo1tptnmictad s2rlu s;u4trermocoytlp eaneols trur(mpnudal  lnvsa()s2trxmp;o1apeo fciyt s emuvp u)alerxr iydfmD aies;(  2xo(m oo4om nlnvt (f Dta(r no1tlxn ociys m um(vs;u4alxrmo3iotlm eaivo;()setoimpou1lltnmfetas)srtmx  ;u4tlenif3ildfm umnmp;u0 lxoxf ta1opt ai s t  ruoimpou1amt lfcias  2rr(ro;t1oexomf3iatlmDemu sn() renmr3totlat  ivs;t0 rxr(o3iydlp e nct s  2umum oo4apxnii3iatfm2rl(mo;t)aeerif iadfmtrlneil(0srxrim3io1lmeemnei t)a2tmx oou1olxnmo3iyt m2rl(mo u)aeenmo3iydoaDr neols)teuo(o oodope mnetl()a2ur( ooo1tpx mi3ildfm emu o;u4artniocoodfm  au s;s)s2urio iodomtelfvt t)srta(m ;o1tpe  fetysfmDran o (0artomr3oatfmte ieolt sexmirpiu1lpt  ncsl( artmu  nt4tpeoioeiyd m2em( on()artrxf oytlp  aies;()setoirpno4lptemiciat  ruaxroot1opeo o3tad s uan o;(4 rtnir io1op e ivi t seum(m nydome livsa(faDra(m nu4alx iieiydlm2uan ont0alenif oydlpD  iesl( s2ur(o3ou4aptelivsltfa2rruroot0tet ifcildfm2uln p;t) eenxo oodfm   nei s srtrir3no4optelnctlsfaDrrx  nu1oeenmf3iysfa2rln s;()trtomrciytoa e uvi;s)sexrxrpno1ll e ici s) rtrxrp;t4optoiictlsfm2rluvp (0 rtomfctodlmtrliei t sexoimpoudlle lfci t s2rmu pnu1apt mocilt mDeau p u0aetnmr oy1optr ieol(0trtmim3iu1lpt lncsat s2rrur ;o4apeo icild sDumu s;t0aeermo oy1omt au ols0 2umir3iy4ope  ivi s s2rmxr ;u1tltn ociad mDelums t4alenif iytomtrau i;t0 etr(mpno1openlfvs sfa2rrx  ;o0texo iciasfm eln p (4tlxriociadfm  livo (  2xo(opoo1ol nmieslt  2urx  ot0aexomf3tadlmDumu o;t0aexrmo oadoa elieolt setoir iu1omtnmics s aDtax pnu4apt moeiadlm2rmnvs;(0aexoxf3oodoateli i;(  2um(o3iydol elfesat s2taurp;t0tpe mi3iys s emnms;u)trxomo tytlmDrai ols0t2ur(opno1lm n fviat)srta(ront0opxomfeilslaDul( p (0tlerxf tatlp eluvol(0 euo(opiu1ol  mnctasf Dua( pnu1oeeomoctadfm eauvsn()alxomo io1fmtr uvsl(0trurir3oo1llenlfetat  Dumxmpnu4tpx  octas m emu o;t)trtrir oa1fmD liei;() etm(m oo4lpenmieias aDur(r no0alxomi3ias m uan ont)areoxrctytlmDeanei s sexmxmpio4lpeelicsltf 2rm(root0oeeniiciad a2rm(monu4arxrxfctadlat luei;( s2xrxm3oudal nlnvslt) 2raxmonu4olxn oeiysfmDel( s (0aleomfcia1fa raneo;( t2tm(o ny4ol nlfvs t s2tau  nu1tee if3tls m2ulnvs;t) rermo3todlaDelues s)trtmio3ou1open ncs t arrm(  ou0tpeoif3tytls2rm(von() rerxf3iotoatelnei;( setmxm io1al nmneils  rrrxrpoo1texomoeiytfs eln p;u4 lenxocia1lpDeau il(0t2toio3iy1open nct (f 2taum ;o0tpen f3iltfs elnvo u0trtomoctadomDe ueo;()trxr(m3oodlpee icilt) rrru  ;o4tlx  fctys a2emuvs ()altrxf3oo1fpD auvi t)srxm(r3no4altnlncilt  Dra(  ;t1opx ifciat a2emumo u)aexrmf ta1lmDr ivo s0s2toiopoy1amt lnet sfa2ua( onu4opeoiieiytfm2eanvp;t)trxoio3iydomtelu i t0t2uoir oo1olenlfvt t)s2rrxmpno4alxnmfctyd s2rmump u) etomfciodfatelnvo;t)teur(m iydlptnlivsls  rtaumpou4alen ieiyt aDrlumpnt0aeeoir iadlpt  uvo;t srtmir3oudllt  fesa(fa2um(  nt4aexo o3tysfsDulnms (0altrxf3oatfmD au i s) rtriopnu1lptnliei (  rra(r nu1open fctlsfm rm( s t4 rxnmo3oy1op  lnvilt0 rxmxm iy1oltemivil(f Durum oo4aexn fciatfm umn o;t0tetrmo3oytfa  livo (0 rxo(r3iu4aptn nvia(fsDrmxro;u4oee iieiyd mDem(mp;u)alxnio3iodfp eai i t  rurim3iodlpeelietatfsDtr(rpnu0oeeo ieiltlsDrl(mpnt)trtrxf ty1laD lnvo s0 rumim3nodopeemnvsas s2rru pot0tpeo octydlsDrln o t) lenmo3ta1lptraivs s0t2xoxopou1aptnmici (fartmxm nt4alto ieiadlsDuluvpnt4 ltnmocta1lat  n s s)texmxrpou4olt  nvslt  2rmu oou0ole micils m2ra( s u0 lxnxo to1opt lnvs t0srumio iudopenmfesat)s2rm(  ;u4olxoioeiatfa rau p () lxomr3oy1omteai olt0 rtoio3nudlltemict s a2uru o;u0oetn feiyslm2uluvp;t0tltoxocty1lmt  ivo;s)seuo(m oudlm nlicils sDrruro;t4ale  oetas m2elnmo;t4tetomf oytom rlivo;t)texoir oudal nmicsat s2tmxrpot1opx  o3iyt a uanvo (4texriociadlpDrluei t) 2xoxmpiy1am elnvt s)artr(r oo1oee  ieiyd a uauvo;(4texrmo3ta1fm r uvo;s0 rxrxopiudol emnvi t) rtrxrpot1tetomf3iysfs2ea( o;t0 etrir3oadfpt anvo;s)t2uoxo iudomtn ivta(  2taxrp;u1tet  fcils sDumn pnu4 etnmr ta1fm eli slt s2xo(o nu4lm   ivias a2ta( pnu1oee iociatfsDul( p;u)alxoxo oo1faDe nvs s  rxo(m3oo4ame lfvsasfs2tr(m oo4aex  i3tat a2em(mpnt0aleoxf tadla  lnei;s sexmxo nu4olt lfetlt aDtrumpou1tpenioeiys s um( ont4treomrciadfmD aivo s)sexrxrpoy1lptelncta()s2ur(m nu1tlx  f3iaslmDumnvs;(0artoxocoo1oaDranvols)t2xoxm3io1alt lfcia() 2tmu  ot1tpeoio3iytla em( p u4artrxf3oadom e n i t) etmxrpio4lpe mivsa( aDra(m nu1aeto ociyd a ranvsn(0tltrifctotopD auvs t0 eurxm3nu4lme lfvslt srrmurp;o0aee  ictls s ra(von(0arermfctadopDr neo t t2xm(o3nydome lnetltf rurumoot1altoifctas a uln p;t0 etrirciadfptrauei ( s2xrio oodole licsas) Dtrum ;t4tlto fciydlm2rmu o (4tleomr ty1lpD aivi t) eumxo3iodamt  ieia( a2rmurpno1apx ifcils mDuanvo;u) lerif ta1opt anvo;(0trumimpiodomenlnei (faDrr(  ot1texomfctlslsDeauvon(4aeerio oy1laD luvol() 2urim3io4altnlnctl(f 2umuroot0tptnmfctltfa ra(ms (4alxomr ta1lm raneo t0t2trxopoydolt mfes t)aDraurp;u1tlxomf3ils a el(vp;u0 rtomo3ty1lm  lnvi;s  etr(m3oudomenlicsas srtrx p;t0aexnmoetldlm2emnmp t4tlermr3ia1fmDrlu ilt)teto(r3io1apte nvt s s2rrump;t4opx mf3ild aDelnmp (0tleomr ty1fpt  nes;s  exoxm3nu4oltn nvsa()a2uru pou4apxo oeiasla ea(vs;u4treoxo totlm ran s;()tetrio nudlleemicias  rumx o;o0opx  feiys aDel(vpnu0altrxocoy1om  ai s t0s2xrxr3ny4ll nlieslt)aDtmu  ;o0tlxn ietyd s2rm(mpnu)aetrio3ootom rauvi;s0 2uoxr3no4om  lici tf 2rax  nu1olxomoeilt aDulnms;t4arenxfcoodfaD  nei (  2tm(rpio1am emfetls srum(rpou1tlenioctlsfm ua(vp;()aeeoxo tadfmteauvo;s)trurirpnu4ap  lncs ( aDuau p;t0tlxnio3iyd m el(vpnt4treoio3iatfpteli ols s2uo(rpiydop  mfcsa()s2uax  ;t4tlxn oetltls eauvpn(0 rxomr3oydfpDrli o s t2uoir3iu1ame  icia(fs2raum ot1apeoiieiytfsDulnmo;t)tlxrxr io1lmtrlnei s t2trxr oy4open fcilt a2ta(  ;u0openif3tlsfmDem(vo () exomo iytoa   n o;s) 2xrio3oy1apenlnct sfa2urxmoou4opeoioeiasfsDelnvp (0aetnmf3oadom e ieil( s2uoxo3nudol emnvs s  rum(  oo4tlt iieiat aDemn o;(4texoxf oa1op r ivi s setr(mpoodlmenlnei () 2raxm ot1tpen o3iat m2rlu s;u)artoir iatlaDeluvo;(  ruoxopno4aleeliet sfaDumuroou1tetoif3tlsfs em(mo u4 reoio3iatfpD aivo;s) 2xmir3io4om  lfvta(faDuax  ou1oeenmiciydfm2umu o;t4 exnio tatomteanes;t)trxrir nodalenmnes t)srrrx  nu1alx mociyt m2eluvp;t0 rtnif ta1fm ean ilt t2xmxrpno1olte fcslt) 2umxro;t1aetoiicilsla2rm( p;(0 eeomfctotfm eauvs s0trtriopiy1al nlfeiasfs2trx oou0texomietlsfaDemnvo;u) rermo totomtranes;s0t2triopnu4omt lies sfa2ta(  ;t1apx  iciys mDeau s;u) rtoifciatfatean sls seum(m3oy4op  lfctat)sDtrump;t1olt io3ils s el( o;u0alxomr3iadopt ai sls  exmio3iu1omenlnvt s s2umum oo1aee if3tadlaDrlnvs ()arxoirciodoatrlnes;t  ruoxr ou1lpt  neia(  2ua(mp;o4oexn f3iatlm2ra( s;u)trtomo oa1om elnvols)texm(r oy1olt mnctat)s2tax  ou0tetnifeiadfsDum(mon(4trtrmfctadoaDraivols) 2xoxopnu4ame lict s)sDuaumont0aptnifcilt a ran o t0tltrxf3iodfaDe i s;(0srxr(o3iy4alte nvt s srur(monu0olt  ieiyt a ul( s;t)artrmo3tytlat  ivs ( tetmiopoudlpenmiesl(  rtr(mpoo4tet mfeiasfs2eauvp;t4trxnmfciydlpt luvo;( seumxr3iydomte ivslsfsDrmur oo0oexoif3tldlaDel( o;u4artoxf oatfaDraueo s0s2tm(r3oy4aleelncilt srta(ront0aeeomoeilsla em(vpnt4texnmf3oo1la  anvol()t2xrim iy1al n nvi ( s2rm(mo;t0apen o3ildlmDel(mpnu0trenxr tydoa elieo;(  2tm(rpnydlptelivtlt a2rmx  nu0alen ictyt aDrm( s;u0 lxoxrcoydfpDr n s (0s2uo(r3iydaptn fvslt  rua( o;u1apxo octldfaDumnvp t) rtoirctotfa r neo t0texrxm3oo4optemnvta(  2uaxr no0apeniieiatfsDul( on()aexrmfcia1oat aies t  2umxo no1ame mfvs sfa2rax p;u0oeeo ocilt aDem(mo;u0 rerxociatopDrliesls)seum(rpoydapt mivi (fs2tmxr ;u1olt mieiat a umu onu)trermr3ty1lmDe uesl() 2uo(r iudlpe mivtas s2um(roou4oet  o3iydls elumsnu0tetomr io1lmD auvi;t)s2xr(m iydopenmfei ()srra(mo;t1alxomocildfm umnms (0 lxrir oadoaDrlu sls)t2tr(opny4openlneta( artrurp;o4teenmo3iydla2el( p;t4treomoctatop  luvs (0srumimpiu4optemncias)srtr(r no4apxnifciyt m eanvs;t)tetomo3iydfaDeau ilt0srum(o oo4alt lncs t  2um( poo0tee  o3iydla2uluvo;t0aetrxocoodlpDelivi (0s2tmxr iudamtelncsa( a2umx o;u4oetnioetas m eau o t)arenif ootoptrlivols) eumimpiy1am   fcs (  2tm(mooo1tet mociatls2ean onu)aeerir3tadop e nvs s trtm(o iodopenlfcta( arum(m ot1oltoifciyslm rm(ms;u0 rxomfctatlp rli i;s)srxoxopoydom emnetl( a2rmur ;u0tlxnifeiyslm ea( o (0 rxnxr3oytfaDe nvs ()s2triopnydlle mfvilt)aDtmump;t1aex  fciytls elnmont0artoio todfa eli o;t trxoxr3nu4lpee fvsasfs2raxr no1oexoiieiyslsDrmuvp;(0trxrir3oydlpDrluvi t s2tr(o3oo4llen net s a2rmu p;t1oexomieiydfs rau p;u0tltomrcto1fa rlu sl(0 2urxr3iu1omtelivtl() rumxronu0aexn ietltfm2ulu o;t)texoxfciotoa  lueols0 ruoxrpiu4ole  ies (faDtmur ;u4open oeiyd a2rmnmp (0altnio3tatfptran o (0srxo(r3ou1llt lfetl(  2umx oou1tpx  ocild m2uan s;u4artrir3oadlpD  nvols)srum(o oudlme mnesltfsrrm(rpnt1aeto ocild aDra( onu4tlxnmfcoy1omt an i ( t2xoxr3nydlmen fvta()s2ra( pnt0apeo i3iytfs2uau s;t)tlxrxo3to1op  aneslt  ruoirpoo4lpt lfcilt aDua(roou1aleo f3tatfmDuau p;u)alenmo3iotopDr i i ()trtr(o3iu1altemnesl()sDuaxr nt4opt mf3ildfs rlnmsnt4treomo oydfmDrlieo t)teumxr nudllte nviatf rtmxrpot1oeenifciat mDel(vs;u4 etoir3ta1op  lieil(0trxrxrpoydlltnlics s arrr(m ;t4opx mieiadlsDemu pnt4tetrif3oatomt aueolt truoxm oodll   net t)srrmur ;t0opeo fctls m2ulu p;u0tltnmrciatoa  luvi;t0 ruo(rpiu1lpee ict t)sDurxrpou4tpxoio3iat sDel(vo u4treoif ta1fptraueol(  eto(m oo1alen ivtlt s2uau p;u0aeen fetytlmDran s u) rxnxr tadlpD aieolt trxr(m oodol e ietlt)srrr(rooo4tlenmociytla umnmo;u0tltoifcta1lmDrlneo;s s2to(m3nu1apt lfetlt) rua(mpot1tleo ieiyt m2rlu p;u0tltnxf3oodlpDeanvs t srxoim3ny1lpe  netlsfarrmur ou0tlxoiieiltlm emn s u0 exrxo3iatfat  i s;t)srur(mpoo1aleelfcia(  2ta(r ot4aetnifetyt mDul( o u)altnmo ootlpDr n ilt0 2xr(o3ny4lm nlnct s arurxr ot1aet  f3iat a2ua(vo u0 ltnxfcia1fmt lu ils)s2ur(rpiu1lptnmnei t arurx  ou4apxomi3ias s rlnvpn(4trerirciy1oatr uvi;s0seto(mpnu4llt  ivs t  Dumxmpno4tlx mieiatfm rm( snt0tlerxf totlp ranvils0t2uo(rpny1amt mfeilsf 2rm(m ;o0olenioeiytfm ea( o t4arxomoctotfpt ai i;t)s2umir iu4ol nmics (fa2ra(root1altomictlsfs2umn on()trerircootlpteluvs t)trur(mpnudop   iei s) rrru p;u0aexn ociytlsDuluvsn(0 exomr3io1oa ean o;t)tetm(mpio4omtnlivilt aDtrxr ot4oee if3tldfsDemnvo u) lermf iy1fmDelu i;s t2tm(rpio1omt mfvtas)srtr(m no1alxnifeild s2ua(msnt4 leoxo tytom e u o t)trxm(o oodop  lfesa(f rtm(m ;o4tet mfetlt mDul(mo;t)teerio to1fpt li sl() 2xmxo3no1lmtnmiciatfsDurx pno4aee  feils m2elu ont4alxoio iy1lmDeaivs;(0 2tmxm ny1lmtelnei (fs2umurono0aeeoioetatfa raums ()tlxrxr oytlatr iei s) 2trxo oy1lmt lnviasf 2uax o;o0ole ifetltlm2ua(vpnt) rtoxfctotoa   ueslt seuo(o iudlm  lnciat aDrrumpnt4openif3iadfs rl(mon(4artrxf3ty1faDean ilt)tetmim ou1llt  netatf Dtrxmo;u0openmo3tlsfa rmnvp t0arxomrctotlmD lu i;( t2urir nydlleelncil(f rua( pnt0apeomf3tld aDea( pn(4trenir oytfp  lneslt srto(r iy4ol elnctl(f Dtmx  nu1aetnif3taslm uanmont4alxrir3oo1fpD au s;(0t2trxr nu4olte iesa( aDrmurooo4tlxn octlsfsDemn o;t4 lerxf oatomD luvolt0 exoxr iu4om n ivt (f rra(  nu4tlen fcilsfmDum( o (0texrxr ia1lp   u i;s)t2xmimpoodalt mneta( srtmxrp;u1aeeomfctatlsDumumsn() eenxr3ty1oatranvsls0 ruoxrpiudlm elictlt)sDrrxrpnu0apxoiieildls2ranmonu4 exnxfcto1lpDr uesl() 2uo(o3nu1openlneil(  rur(m ;u0tet mf3ilsfmDra(mo t4trtomo3oydfpt auvi;s seur(o3oodomte fvia(fsDur(mpnu1aexnmocilt s2raumont4tlerif tadoa  au sl( srumim nydolee fvtatfsDurur ;u4tle ifciys sDran snu) rxnxo iytfmt liesls srxoxopiu1openlncta()sDrr(  oo0opeomocils m2ulnvon() lxoiocoadlp e u i ()srumim oo4apte ivs t aDtmxmp;t4opx moetatfsDuluvs u4 exrxfcootfa  livsls0 2uo(m oy4lmenmnciasfs2urumpnt1alto f3tyd s el(vpn(4 lenmf3tytomD au s;t) rurxopoy1lme mictat) rur(root1oexomociatlmDelnmo;u0tltrir tytlpDraivo t0 2trxm no4lp elnei t)sruaxmpno4tpt mi3tltfaDel( p;u4 etrmr oa1lm   ivols)teurxm no1olt  netat)aDtax pnu0opxomi3tldfa el(vonu0teeoxocio1omtrln s t)trto(r3ny4op nmfei () ruaxroou0aleo f3ild m umnvp;t0aetnmr3ootom  anvolt t2xr(m ny4alt lneta( srtmu pot4apto ociltla umu p t0altnxrcootoptr u i;s seuo(r3nydll nmfesl()aDtaxm no0opx mi3iltlmDem( p (0trtoir3io1lpDranei;t0 2uo(o iy4apt  feias sDra( o;u1tpe mieiltlsDrmnmo;t4tltrxr oo1opDrlivi (  rxoir3io1lp n fviasfs2taxroot0ape ii3tadlmDra(vp;t4trtrmrctydfa  lnes t)sexr(m3oo1lm  mneiat)aDrm(mpoo4tltomf3iyd m2ua( snu0arenxo3oatfatrlueol()srtmim3nu1lpeelfcsat) 2rm(m ou4aexn oetytla ul( pn() etoif totomtrlnesls) 2xr(opoodol n ivilt s2tmxm oo4alenmo3tldfm emnvo ()alenio iotfptrlies;s0s2uo(r3no4al  mivt sfsDta(mp;u0tpen ietyt a2ra(mo u)tlxnmr tadlp eln s ( sexo(m nu4omt mivilt  2raumont4tlxnmoeildls2raumo;(4trxoxo3oo1fptranvsl()trxmxm3iydom elnvsa(fa2raurpno4ape  iciadfsDumu onu0aetoif iytlp  luvi;t0 rxrxo3nu1om  lfetl() rtaur ;t4opto o3tlsfaDeluvsn()tlxomo io1lmDrli i t  2xoio3nodaptemnvi s sDtax  ou0tpenii3iytlm raumonu0 ltnxo io1oa  aiei s  exrxr3iudlm nlnvs tfsDrruro;t0tpx mf3iytlaDuau s (0tetomo3todlm  li sls)seur(m3iudamenmfvi ( srumxr ou1apx mieiltfm2el(vs;u4teenif3oo1lmDeanesl()seurirpou1ale liei ( srua( onu4tpt mf3tatls2uauvo;(4trxnmo tydoptelueol(0 etr(r3ny4ole mnct sfsDra( ooo1opt  o3tytfm2umumsnt0tltnxociodlpD  uvs t srxoxr ou4lpenmnet sfaDur( pou0tlenioeilslaDrlu pnt)tltrif io1laDr ues s s2trxm nu1al  mfvtls) Drm(mp;o4aeto ieiatfm rlu o u0trtoxoctydfatr neo t srumio3oo4apenmfctas  2ra(rpnt4tpt mf3ilt sDem(mp () rxrif3ty1fm   uvi ( s2umimpiudapenmfvs sf rtrxmoot0ape mf3tydfa2emnmonu4 leoxf3ty1lmD auvo s)t2urio oy4am elnes s) rtr( ooo0tetn f3iyt sDel(vo;u)trtnmr3io1fmD anvs (0seumxr ou1apee nvs (faDtaurpot4oexoiieiatfs uau p;(0arenio oa1fm  aiei;t0 rurir3oodol e iviat  Dtaxmo;t0olto o3iytfmDrlnmo;t4tetniociadlpDeanvi t0srtr(rpiu4llenmfcs (f Dtm(mpoo0olx ii3ilsfmDel(mon(0 rxnir3iydop elu o s trxoirpoudapenlietlt s2ur(m nt1altnmi3ias m uluvpnu) rxoir todla  auvsls s2tmio3nu1lp emfet ()a2taumpnt4oeeo fctyd sDra( pnu) renmfcia1oatrau o;t t2toimpoy1lptemnvilsfa2uaumpot0open oeiadfmDeanmp;(0tltomo3oatoat lnvi;()t2uoio oy1apte neiatfa2uaxm ;t4opto o3tld sDelnvs t)tlerxo to1fpt lnes (0srtrio3nydolt  ncilsfsDtr(r no4tlxomo3tatlm rau p;(0artrxfctotom  au sls srxoxr3oydalee fesltfs2umumpno0oeeoifeiadlm2emnms;u0trxrio ia1lpDrluvils)s2toio3nydlpt liciasfaDum(rpot0tpx mf3iltlaDrl(mpnt4trermf iydfate ues;t  exm(r3iy1omtnmfcil() 2tm(  nu4tpeoiieiydlm ra( o;(0 rtomfcoa1fmtr u o s) eurir iodoltnlictas arraxro;t0oee miciadfmDum(vs t0areoio iodfmD  i ols  2tmio iydoltn fci s)aDua( o;u0tee mfciydls uauvp (4 eenifciadfat  nvs;s0srur(o3iy4aptelneia()artruro;o4olen f3iltlaDulnvo;()areoxrcoydlmtelueolt)texr(rpiy4lptnlncsls s2tr(rpno1tpe if3iydfaDulu sn(0tltnxf3oy1fmte nesl(  etr(r no4alt mfvtlt  rtax pnu4alx  f3iad mDranvont4teerxo tatfm  au i;t) rtm(m3iy1lmt mfeslsfaDurx o;t1alxoiictyt aDumump u4areomo oodoaDrlieol()trxoim oy4lptnmfctlsf Drm(m oo1olt  oeilsfsDeluvpnt4alxnmrcia1op  au ilt s2xrxrpoo1ame liei (fs2rr( oou1oee moeiasfaDrmnvs;t)arerir iatom   u o;s)s2xoxm no1llte nctat) 2um(  ;u4tpenio3iysfs2rm(mo u0tleoxfctotopDeaueo (0sexrxrpiydlpt lnctas artaxroot0olt mf3tatls2emn o;u0tetrif to1fat an i ( texrxmpnu1amtnliesa()sDum(  oo1aptoii3iatfsDumnvs u0arerir iadfmtraieol( seto(r3io1lm  micta(  Dra(m ot4ale  i3iytls um( p;()trxrircty1lmt  ivsl(0t2toxm no1ol emivi () 2uru pnt0olt io3tydfa2eanvo;u0tleoxocoydlatelivols  rxrxmpnu1lle  icilt srtaumoou4apxomfeias m ul( ont)alxnmocoa1oa rauvo;( s2trir3no4opeemnctas  2taxmp;u1aeeo ietadla2rl( on(4tltoxr iatfmDrliesl( t2uoirpiu4lp e fctas)a2uaxrpoo1aex miciadlaDeauvp;() lxomociatom  luvo (0 etmxo3ou1lmee ietas)arraxmpnu0oltomieiadla elnmpnt0arxriocia1lat  u s;s0setoio3nudlp nmneia(fs2ta(mpnt0oet  i3ilt m2rlnmo;u)aeeoiocto1lm rluvi;s  2urxm iudoleelfei (  Dtm(rono4ale iieiasfsDemuvo;t0 reoio3oytlat anvo;t) 2urxr nu1ap nlieils  rraxmpou4aetnmfctat s ranvsnu0 exnmfcta1fpD anvs;s)trxoxo ny1al n neilt sDra( onu0apxomoetldls ul(vo u0tetoio3iodomte u o (  rtrxr3ou1optelietlsfsrtmurono0oee  ieiytlm2el( s;()aetomrciatop rlies t0s2toxm3no4lme mnetas)s2uru pnt4aexnmoctytlaDrm( on()trxoxf3oa1om   uvsl(0 rxr(m ou4ll elnctltfsrumxrp;o4oex  i3ilt m rln p;(0aexnio3oytlpDrlu o t0srtr(m3oydapenlictl(  Dtrxrpoo4openmiciytfaDumnvo;t4aeeoxr oatlmDe nvi;(0 ruo(o ny4aleemnctl() Dtrxr oo4oeenio3ilsfsDuauvsnu) ltnir3ta1omte u s;s) exoxo3nodomenlfcsl(fs2umxr ;u4olenifctldfs2ul(vo (0 etnir iydfpDr nvsls)seurxm3ou4om nlnctl(fa2raxm ;u4opt  icilsls2rm(vsnt0aexrxoctydop  lu i;t trtrim3iu1lpt  ncias a2ua(monu1oetoif3iat s2um(mon(4areoir3todfm   neolt0 rxr(mpiydaltemfctlsf 2umx pnt4tpenmietlsfmDrlu p t)trtomo3oadoaDrauvo t s2umxr3iodlp  mnet ( arrr(  nu1apto o3ildlm2eanmp;t0trtrxfcta1opDrln i (0sexrxo3oy4oleemfvil(farumur ;o4oltomo3ilt sDumums (0teenmfcoydomt  nvi;s)srxm(r iu4ap  lnvsltf Dta(  no0oexo ietytfm emn o;u) rtomrctodfmt  uvsls)seumxm3oodlpe livilt srurum ;u4olenmoeiydla2uln snt0alxriocoadfm  aieo t)s2xmimpiydop elnctas)srumx ooo0alxnifeiltfs ranmonu0trxrxf oydomDrlieslt0t2xmim3nudame lfcs s)artm(ro;o1aetomicild s2emn pnu0tetrxfctodlatrliei s  etrim3no4al nlnesatfsDua(rooo4aleo o3iytfmDemnvp;t) etrmf iydfpte neol()trum(m nu1amtelicias)arua(mpnu1aee  ociydla2ra(mp ()tleomr iodoat  uvolt0s2uoiopny4lpen fcsl( s2um(r oo0ale moeiltfaDumnvo;t4tlxrxocoodfmt lieo t  euoim ou1apen fvs (  2uau  ot0tpxnmociasfs em( s t0alxoxf ootomt  i o;s)seto(m nu1lmtemicilt  Durur ;t0alx io3iys mDumnmont0 etrxo iotfm  ln i;(0srtmxr iu4lp  lictlt  Dtmx ono0tpxo o3tys s eau s;(0aexrmfcia1lat aivo (0 2xrxr3nu1lm e nvsltfartr(mo;t4tpxnif3iysla2rmnms t0 leoxf3totoa e u i ()t2uoir oydamtemneslt  2tmu  oo1alx  oetld mDrau p;u) reomrcio1fm  ln ols0 etrim io4opt livi t  2rmumpou1apxo fctas a2rln o (0 ltnir3iydlp raueo s)seum(mpou1optelics () Drmu  no1tpt mo3ild sDrm(ms (0 lermocty1oaDe n slt s2urio3iodom elfesl(  2rr(  ot0ope  ieilt s2rl( ont0alxoio3ootlp rlivo;t) ruriopny1omt mneta() Dtaum nu0aptniicilt a ea(vsn(0altnif3ootfmt aivo;s0s2trxm3iu4op e nei (fa2ra(r ot0apeniiciysls rau pnt)trxrxo3tydopDr uesl() rxmim oy1ap nlfesl(faDuax o;t1apxomietas aDul(vsnu0 rxnif3iydfaD lies s)t2um(mpoo1lpeelfetls  rrmx o;t0altniictytlsDrm(mp t0aetomf3totoateai s;()teumxm no1amt  nei t aDra( pot4olto ieiyslsDul(msnt4tlxnir3ia1opDeluei;s) rurimpoy4am n net (  2um(rpoo1apxn f3tyslaDua(vp u4texrxf3iatlmteli il()teumxr3iydlpe liet s) rurxmpnu1oltoif3ilsfmDemn ont4 etnxfciotlp ranvols0teumxopnu1omtelies t s2tax o;u4tlx moctyt mDeluvs u0 rtnir3iadlmD ln il(0sexoirpou1ome  ivsas  2ta( oou0aexo fcilsfmDem(vs;(4altoxrciydfpt li i;t0srtoir ou4om elnesltfsrta( pou1aeto feiysla2ua(vo t0altnxrcoa1oa eau s t0 ruoio no1omtelfeilt arra(  no4tltnifctytlmDrl( snt)teenxr oydfp   u o s0trxoimpiu1ole mnesas  Dtr(m ou1opxo icild aDrluvp t) leoio3iatopteanvo;s  rtmirpoo4op  micslt  Dtr(ro;t0tpx iocild
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt)setoxr3io4lltnmnvsl()s2taxrpot4tlxomf3iydfm rmumsnu0aetrif3ty1lp raueo;s0sruoxm3nu4amte ict (  Drrxr ot1aee ifeild a emuvs t0tlxomrcoadom r u i () 2xmxopiu1omte fvtas) rurxrpoo1aptnmociyt sDel(msnu0teeoircta1omDr uvsls teto(m iu1lmtnmfvt (fsDra(  oo1tleoii3tldfa el( pnu)tleomo3oo1fpt aivsl(  rum(m io1lltelieta()aDua(m ;o0aet mf3iatlsDuln p;u0tetoxo ia1faDeanvi;()s2xr(o iodopee nvt sf rtru  ;t1tlx  fciydls el(vont) etnmf3oytoptraueols)tetrim io1omtnlnvt tfarra(rpot0olto feiltls2uauvs (4tlxomfciodomDeaueolt0 rxoxr no4lmee fvilt arrmump;o0ole moetldlmDrmnms t4treoxf3ty1oaD aneilt0teto(r3iy1am e neil(faDraumono0opxnmi3iadfm2eau pnt4aeermf ootla rlu i;t)srur(r iydlp e nviat) Dtmur ;t4alxo ieiysla elnmo;t4 ltrio3io1lmDraneilt0 2tmiopiu1alenlnet tfsDrmxrp;u0tpxomi3ilslmDumnvpn() lenioctatfpDelivi;() etm(o oy1lptemfct t) ruaum oo1tpx ii3iys a raumpn()trenir oa1oate ues t0 2toxr iodlmee iciasf 2trxm no4tex  ietat m2rmuvs u)treoifciytfmtranvil(0seumxo ou1am nlncilt) rrrx oou1opx ifeiydlm2um(mo;t4arxniocoy1lpDeli i ()srtoio3oo1olt lfetl( srua(  ;o1tlenmfeiyd s rm( s;(0tltrxo3oydom raies t0s2uoxo3oo4om  lfct tfaDuaxmpnu1opx mieiyt mDulu s;u)teeoxo3oytfmDelu o s  2urirpny4lp e ietlt)sDuaxronu1teeomoeilslmDuln ont4tleoirctydlmDe nesl(0 2um(o nudopt  fetlt) Dtr(ro;t4tlxn f3iatfs2ua(msnt0 lxrif oodfmDrlu sl()t2xm(o oydlpt mfesa()sDtm(ro;t1tpxoifeilsfs2uaump (0tlermfciadfmte n s t0t2um(o3iu4ll nmicia(f rra(  ;u1optn iciydlmDrauvo (0trxrif ia1faD au o s seurxo oydllen fvi ()srtmx pno1aee ifetydla ulu s;u4 ltoxo iotopDrlnvs ()tetoir io4oltemnct t)s2ua( o;t1aee io3iasfa2el( p (4 lxniociadfpDr i o;(  eumio3oo1alt lfcia( aDtrxmoou1tpxomi3taslsDrmn p;t0arxrio oy1fa e i slt  2trxrpnodom  mnvslsf 2tru ooo4tptnif3ildfm2uanvo;u)tltoif3iydfp rai s s0texrim3iudlmenmfvt t) 2rm(rono0oet  o3tldfs2uln s (0 lerif3tatlm eaieo;( t2xrxr iu4om  lnvsl(fa2taxr ot0texnio3ild a2emu sn(4alxrir to1fptrlnesl(  rtrxopoo4lpe mnctlsf 2rm(roou0ole mfctls sDranvo;u4 rxrmr3tydlpDeluvs;()setmxo3oy1lltnlfeiatfaDta(r nu4tle  i3tys m ul(vs;(0 etnmr3ta1omt ln s t) 2xoxo3nodlm nmnvs s s2raumo;o1tpx micilsfmDumn on() eenxrcty1oaDrlivs;s) exmxr3oydop nlfeslsf Dtmumooo0oexo f3iysla2rmuvpnt4 ltomrcoydopDeaivo (0t2umxmpio1aleemnvsasf rrmur no1altomieiltls2ea(vs;(0 rxoxf iotfm eln o;()sexr(o io1ll  liesl(fs2rm(  oo1tptniociytla2eaump u4alenifcoa1fp r ivs;s  eto(r3iudlmt  nvi tf 2tr(r nt4oee mietyd a2rl( o;u)tlxnmr3oa1faDeanesl(0srxrxmpoodlpte ncil()a2tmump;t0alx  ietysfm umuvo;t)tlenxrcoa1optrln i t srxr(rpny4omenmnctl() rtmx  nu1tpeomieils a2ra( snu4trxrir iydlaD anvo;s)t2toiopno1opt  ivia( s2raxm ot1altn i3ils a ua(mp;()aetoxr ta1oa  auesl()trxm(m3oydolenlfes sf 2tr(rpnu4oexoioetat sDul(vs;t4artoxocoytfpDeli ols0 2toimpiy4olte fei s)srtmxrp;u0oltn oeildfm2eau s u0altnif3iodfaDr n o t)t2xoim nu4olt lncs sfs2trxm ;u0opxo icilslsDel(ms t)alenio oo1fmtean s s)t2xmir3iu4lmee icil(fsrur(r ;u0tetnioetadlmDulums;() reoif oatlmt  ueo;t0trtrxr3iu4omtnlnci () rraxmo;u0tltnmoeiatlaDra(mp;u4 ltoxf3todoa  anei;() eto(opoydlpenlfvt t  rtaxm ;t0oleo ociysfa2rln s u0 etrmf totoptrlivslt sexo(r3iu4ol   ivtas aDrrxm ;o0aexniictyslmDrlums () exnio io1oa  an ilt) rxm(m3io1optemnvta(  2rrxrp;o1tex mi3tydfsDrm(vo;u0 leoxf3oadlpD  neil()s2umio oo1aptnmicslt) rumur nu4oeeoiicias mDeauvs;(4tlxrioctotlpD anvo;t0 rum(o3nu4llenlictltf 2rmxr nt4tltnio3ias s2umnvs (0 ltnmo to1fmDe nei;t)sruoiopou4lm emnctls) 2tr(mpno0opt  ociydls2rlnvs;u0artnxoctadop   ivs t)setrim iu1llee fvslt)srrrxroot1ape  i3iad m umums;t)artomr iodopteau slt0 etm(m iu4opt mfvsa() Dra(ro;u4opeoio3iasla2ean p;()arxnir3todlp r u ols)t2um(opou1lptnmici s a2rmx o;t0tlto fciyt s ulums (0 etrmr3iy1lm eai s;s)setriopnu4ol n nctl(  rum(rono0aee iietyd s2uanvon()altoxr iodfmt  n s;t)tetrim3iy1apt  fvsltfarua(  ou0alt  i3iytlmDumnvs;u)artnxo tytom raneo;s0tetm(r iu1ole mfct (f Dumu ono4oex mf3ias m2emums u0trtrircoo1optrlivslt  2uo(o3io4aptelncs t)srua( pou1oet moeiasls eluvs u0 eenxo3oatla r ueo;t) eto(r iu1lltnmfet ()arrmu pot4oetoif3tltla2elumo u) leomf iadfpDeai i s trtmxmpno4ole lfcsat  Dtmx pou1apeo i3ilsfmDul(vsnt)alermr3oydlateaieo;s  rxrim3iy4op  mfciat srrmurpot1aeeo i3ildlaDrmnvp;(0 lxnif3oy1om e ivs t)s2xmxmpno4ll  lfvsa(  Drrurono0tpxnioetldlm2eauvp u0alxoio3tydoaDrlu i;t trurxr ny4lpeemieils) 2tm(mpou4aexnmociys m2ul(vp;t4alxoxo3oatlmt lneo s seuoxmpny1omte fvi () Dtru ooo1aexo oeild a el(vp u)tlxrir ty1om e nvslt setmimpiu4open fvi () rrr(m nt0oee  i3iydfa2ranms t) rtomr3iotoatranei t)texmio io4amt lnct t  ruru oou1olx iociat a umuvs;u0aeenmfcto1fpDr uvol(0t2trxm3oo1optnmnct s sruru onu0tlt moeils aDemn snt4 etomo iy1la eanvolt sexrxm nudllt  ictls  rrmu pou4olto iciysls eauvo;()texnircto1oat lu ils  eum(o iy4ol e nct t a2umurp;o1olxomi3iytfaDuanmonu4tlxrxo3iatfaDean ils)trxm(o3iu1oleemiei sfaDrm(m oo0olt ii3ils aDean sn(4trtomfcty1lp   n i s) 2trxm no1lm emfet tf rrr(mo;t0aptomf3tldfm2ulnvs;u0 eenifcootoptr i i;s srxmxo3iudapen feslt srtaumonu1openmo3ildfmDranvp;(0aeermf3oatfm  aieo t0 euoimpoodllenmiei tfaDtrur nt4aet iicilsfa2ua(vpnu0 rxoxfciydoaDr n o;(0t2uo(m3oy4apee nciasf 2ua( pno1teeomictytlm2umnvsn() lerif3todfa e n s;(  rxrim no4lpte fviatfaDur(mono0opt  fciyslsDuln pnu)texrif oydop r i slt)setm(o3iu4ome mivia()aDrmxronu0alxnmfctadfm2ul( on(4trtoxrctydoaD  i s;t) etriopoodomtnmfctlt s2ra(mpoo4oexomociyt a el(mo u0 rxrxo3oa1omteluvil() 2tr(m3no4alenlfvt sfs2ra(ro;u0tpxo ocild sDrl( p;u)trenif3oytlpt  ieil( t2xrir3iu4ol e fcs t sDum(  oo4alxoifeiydfsDelnmo () lenmf3io1lmt lues;t) euoxo3oo4ope lncias)artm(root4optoifeildlsDrmu onu)treoiocoodla rlu i ( t2umxrpiudamee ivsat) 2urx  ot0aee iiciyt m2ranvs t4tleoir iodlm   u s;t truoxm io4lmeelnvt t  rua(rp;u1tpe  feild a ea(mo;(4tlxnxr3ty1lpDrli o;( trtrir nydam emfcs ( arrmx oot0apx mi3ilslaDuanvs t) etrif3to1oa  aivi;s)texoio oodape lnctl(f 2raum nt1tee iieiytla2uauvo t)alxrio tadfpt  nvsls0seum(mpiy1ame  ncias sDrrur nt4tpx  oetasfmDeauvsnu0arenxf tytom rli sls t2tmxmpou1alenlfetatf Drmxr no1tpenmocils aDuau s;t4tetnxf3oydfa  ln ils0 euoxr no1optnlivs sfaDum(mpoo1tle  f3iasla rmnvo;u)trtrxf tatomtranvslt s2xr(r nudolt  neta( sDtmxr no0tleniietys s el(vs;()artoif to1omD aueo t0 rxrxm3iudopt lfesat) rtruronu1aee  fctlt a el(ms;u4tlxoxr iotlmDran s t srxo(o3no1ame  ictasfartmxm no1alxo ietldfaDuln onu)arxnmfciodfm  lnvi;s)teurxm iy4lmee ieslt)a2umxm ou0tetnifctad m ul(vo u) etrmo3oadla  auvslt)srtoir3ny1lm n fei s sDtrurpoo0apx  fctld a rm(vsnt0 eenxrciytom r uvo;(  2uo(rpoudlm e icsa(f 2um(root4apx mociydlm ulnmsnu4aleoxrcto1la r i o t  2tm(opoydom  livi t  Dtm(mo;o0olenif3ild s rm( s ()aeeoxf3iadlmt auvils0 rxo(m iu1llt  ieiasfsDrmu  nu4aet  o3tysla2em(vpnt0 rtnir oytomD  uvslt  exr(rpnu4lp nlfcsa( a2ra(  ot1tpxoifcils s2eln p;()aetnir oodfpDeaivolt s2xoio ou4lpen iesatfa2tm(m ou4aeenmoeiadlaDranvs;(0 etrifciodfa  lnvilt0 rto(r io4om elfvsl()s2urumo;t1altnii3tls m2elu p t4 lxnmo3iotla eli i;s tetrio3ny1oltnlneilt)aruaum ;u0opxo octasfa2emuvo;t)trerio iodlat lnes s0 2uo(mpoo1lmt mnvs t srurx ono0apxn f3iys aDrl(msnt4aetrmf iydomt li olt) 2xrxmpou1ap elfciasfa2rr( p;u4aptnio3iatlaDum(mp;() etrxf ta1fat livi;t)s2xr(o3oy4oleemfvtlt)arrrxrpoo4oetomictydfm2rlnmp;t4trxoxo ty1omtraivils)sexoiopiydam  lfes s)s2uru  ;t1aex iociyslmDuan pnu4altriocia1fmDrli i t)t2xoxr iu1aleemnct tfaDum(rpnt0oet mfeias aDumn sn(0 reoir to1fp  auvi s  exoir3ou4oltnlncia() rtrumono4tlenifeiasfs elnvon(4aexoxr iodlmDeanvs;s0srtrim iodapt  iviltfsrua(m oo1oee mfeild mDrl( pnu0tlxoif oydlpte ues s0teur(o3oudomenmnetl( aDraxronu1tlxnmf3iyt s ran o t)trtrio to1om  au i t)t2xmxmpiy4ll elnei (f 2ua( o;t0tltnii3tlt s ulnmo;u)aeenmocoa1omt  neo;t0s2xoxopny4op emicia(  rrrx poo1tleo fciltla2ea(mp (0 lxoxo iydlm   u s s) ruoxo3ny1omeemfvias s2ur(mpoo4aetn ieiys a rlu s;t4trenxrcootlaDr uei;(0t2xr(m iydolen icia( srrm(mont1tpt mf3tlsfsDelnvsnt4 ltoxf oytlptrluesl(0trxr(m io1lm nmiesat)s2ua(r ou1aleomfciasfa uluvp t)aleomf tydfa rau ols)s2tmxo ny4olt mietls a2uaur nt1optn feiydlm ran snu0 ltrxr3oadlmtr ivo;s)trtmimpnu1am e fctls s2rrxm ;t4aptoii3tldfm ul(vonu)tlxomf3oodlmDeli i;( sexo(r nu1ol emnvsl() Dtaxroou1tex mociadls2el(vpnt) etnif tytla rli o ( srxoxo no1ole mfetatf Duaurpno4tpeomoeias s rlumonu4tlxrxf3ty1fa  auvo;t)srxrirpny4al nmiviltf Dta( ooo4oexnmieiasls2em(mp t) rtrmo ty1lp e i sl(0texrxopnydope  ics s  2rauro;u1apen i3iytla2umu o t4 reoiociytlp rlies t0 eur(r3no1oltnmfcils a2ra(  ot4aexo ociyt s rau snt0 rtrir3io1laDr i o (0t2urir ny1ame  fct tfa2rau p;t0oltoif3ils m2ea(vpnu0teeomo iodoate ueils0texmxrpiu4altnmnesas aDrmumpnt1tpeomfciyd aDrmnmo t) lenmocio1omtran s;( s2trxm nudlm nlivsl(fsrur(mpou1apeo ictltfsDumn s ()aexnmocootomDrau i;( s2toxo iodoltelncsat)aruau onu0tpxn fetlsls2ranvp;u) rxnmocia1optrauvs;( srxmxm oydome mfct ()arumxmpou0alx  f3iad a rauvpn(4 ltrmfcoydlpt ln o;() rxm(mpny4lmenmieil()srtrumo;t0opxnif3iytfsDemumo t)tlxomf3oo1fm  lu o;(  2xoim ny1llt lnviatf rrmxr ;u1tlxoifetldfsDul( s (0 rerxfctadlptr ivi;s0t2tmxmpio1lltelfesas)a2ta( pnt0olx  f3ilsfsDuanvp t) ltrirctotlp r u i t0 rurxm nu4lpenlfeiatfs2rm(mpnt0oetoiiciys aDuln o;u4 rxrmrcty1op r uvsls setr(m no1ope  neia(faruaur nu1oetnii3tlt s rlnmpnt4alxrxr oatlp rluvslt0s2tmim3no4oleelncsa()artau pnt4opx  ieiat s2emuvonu)artomocoytfp   ueo t0 etmxrpno4ll n nvsl(f Dumur ou0apenmociytls2emumpn()trtnxo3iotom  aies (0 etoxr3oo4amtnmies tfarraur ou0apx  oeiltfaDrln o;t4 etrio oo1om ranvo;s) etmimpiydaltelfvt sf rtmuro;o0tptoioetatls2ra(mp;u)texomocootlmte neo t)tetm(mpoudol emfvtltf rtmx p;t0oleoif3iat aDrau snu0 rermr3tatfptr ueils)t2uoxopoo4llee ivt () rtm(mp;u0oleoiociaslsDeln on()arxnxf3iadfp  aiei;t)t2uo(m3oodlpe lietas)sDrr(  ou1olxo fetas a2ra(mon(0artoif3iotoat ai i;s)srxm(o nu1amt mieta(  ruau  oo1opxo octldla2uln o;()tltnifciydoa ran s t0trtoxopnodam  livtas  2taxmpnt1tle mo3tas m2em( p;t4artnirciytlmDr u s (0srtrim oo1ll emfei ( sDraxronu0tpeoii3tad s2uanvpnt)aeerxfctodomDr uvi (0t2urxopio4am   ivsl(  rrrxmonu1tlt  feiydls rmnvo;(0tetnif iatfpDrai s t) rtmxo3iydalt mnvtltfaDraxm ;o0tetn feiytfm el(vs;u4aexoxrcoytlaDeaues;t)s2trxm3nudapt mfvtltfa2urx p;o0tet iiciydla rm( o (0tetnmf3iytfptraivs;(  etmio3iu4omtn fcsas)srumxmpou1apeo feiatlaDea(ms;t0tetoir to1omDeaivi;(0teuoxm3nudlmte iet s)srururonu0oet  ieiysfaDemnvs t4tlermr oytlptrlues (  euoxopny4llenmfeilt sDtau ooo4aex  fctat s2em(mont4alxrirciatlmD li i t)t2um(o iy1lle  fcta( srur( p;u1ape  fcias s2rlumonu4arxoir iadopDe uvsls0 euoxm nodamtemncsl( a2rax pnt1tltoiocilt sDrlnvp ()areomr3oatlp e nvs;t) 2tm(m3oydam nlfetlt)sDtm(rpno1oetnioeiydfs rlu o (0 rtrif3oy1fm   n i;s0 eumxo3iu1oltn feia() rtr(r oo0apenio3tat sDuau s;t)arxrmo3iy1fm eaueils teumio3oudlm n fetltfsrra(rp;u0opxoioctadlm2umums;t0trtoif to1op eau s;s) exo(m nudopt mivsat artmx o;t4olx  i3iyd a2rm(mo t4aleoxr3ty1op   ueils srtriopiydllenliei sfa2tr( pnu4texomo3iytfmDrmuvont)trtnxo ootom rlnes (0s2ur(r3nudam emiei tfs2urx o;o4tlxomf3iysfm ul(ms;u0texrifciadfpt  ivi;()sexrim3oudop nlfviat)s2trur ;o0oltnioeiad m ulnmp () reoiocoodoa e ieslt  rtr(o oudlmtelncsasfsDtax  ;u4tpeoiiciltfs ra(vo;u4trxnxociotfptr nei s)tetr(r3oo1lptnlnesls sDurur oo1tptoiieiadls2umu s ()alxnxfciy1lateanvo;t0srurxm3no4lm   net sfs2ua(rpnu0aetnioeiltfs2um( p;u0 exoir tytlpD luvols  rtoxm iy4al emncias aDrmxmpot0olx  ociyt m2umu o;(0tetrio3iotfmDr uvols0trur(o3io4openmncias) 2rmump;t1alenifctyslm ua( pn() etrmfciy1opDeli s;()t2tr(o io4lleelncilsfsruaurpnu1altomo3tydla2uau p () etrir ty1fateai i;t0 exriopiu1ape mfeiat aDtr( pnu1aexomfciad m2ranvo (0arxnir iodfptraiesl(0t2tr(r3iy1amtnmivi ()a2umurpou4ape moctlsla2el( snt4altomocoadla r u i;()texoxmpnodomtn fesls s2tm(rpno0apx ii3tadfm ul(vs;t) exnio iatlptrlivi;s)trtr(o3oy1omee nei s)sDtmur no4altniietadlmDulnvs;t)trtrxf totomDr i o t0teumxm3oo1lptemieta( srrruroot0tleoiociadfs2rln on(4trtnmfciy1la elnei s t2trxm3oydomtnmietas) 2raxront0tetnmf3iytls uln p (4aeeomrctatfpDrai o (  eum(m3io1lmeeliviat)arrau ono0openmfcias a2um(msnt0alxomr tatopte nvs s)sexmxm3io1lltelfcta(faDraum ;u4oet iietltlsDrm(mpnt4tetnxf3tatla eaies (0srtoxm oodom n iesat)sDtaxmpoo1opx mieild m um( o;u)aetrmf3iotfatr ies;(0s2trirpiy4lpen fcsl()aDtmu  ;u1opxnioetysfaDul(vs;u0 rtnxr oa1lpDeaueo ()t2xrim nudalte neta() ruru  no1oex mf3tasls um(vsnu4tleoxr oa1fp elnvo;(0s2urxm3iy4amt  fcia( aDrax  ;o4opeo i3iydlsDran snu)alenxr tatfmt  nvo;t)texr(r nydal  mietlt)arrr(m nt0aet ioeilsfs ran p t)teeoxocoatfat au i;t) rxmxrpoy1om nlfvil(  2tau p;o4teeoiiciad a2ranvsnt0tltrmf3totop elieols srto(m no4opt mivtas srumur ;t1ope mf3iyd m2rlnvo;u) etoircto1lpt  ueo;( t2toxr3oudll nmnei s)a2ururpoo1tltnmoeiys m em( p;u)texrmf3io1omDeaiei;s0s2uoimpoy4altnlnvs sfa2ur(mpot0tltoii3iatfm2ulnvo ()trxoxfciatfpDr ueol( tetrxo no1lpenlfct ()artmxmpno1oleo fctltfm elnvo;u)aexnif oa1laDr nvs;()setoimpiy1aptemnvta(fa2rm(mo;u4oee mo3iydfs emn s;t)aetoif oy1lptrlivi;s teumir3oy1lptelnvsas sDurxmpno0alxomoeiasfa2rm(ms;(0 ltoifctatomDean il( s2toxmpiy4lm e ivt s arumxmpou1tlenii3iat m ea( p () eeomfciytfmtrlieol( t2tr(m3oudom  lieta(f Dtax  ;t0oetnif3ilsf
\ No newline at end of file
@@ -0,0 +1 @@
+ivs s  2xmim3iodlp   fcsatfsruauroou1aetoif3iys m2uan snt4altnmoctodfpDean s;(0 exm(m nudlptelnct t)a2urxr ;o4aex  ieiadla rmnms;u4alenxr iytomD li il(0 2uo(r ou4alenlfcs (fsDum( oot0tlx mietad s umnvpnu) exomr3iotlp elueol() rum(r3io1alen fcs ( srtr(mo;o1altn ociyd s2rm(mpnt4tlenxo totomt aiesl(0 eur(m3no1aleelfes t a2uau  oo0oeeoiictasfa rm( o;(0alxrir3oydfa  lu il(0seumxm ou1am nlnesas)aDrru  ;u4aetomociasls2ulu pnu4tlenif3oydlpDe ieil()t2umxrpoy1lptnmicta(  2tax oou1olxn ieiltfaDumu p;(0 exoifciotlateai slt sexoim3io4omte fetlsfaDrax pou4oetn iciadlsDumumo (4alerxf tatlaDeanvs;t)trurxm io4lmt  feslsf Dtmumonu1tltnmieilt a2ul(vp;t4aeeniociydopDranvi;t0 rumxr3ou4amt  icils)a2urxr ou4tetnmoeilslsDrlnvsnu) ltomo3oo1opDran s;( t2toxm io4optnliet ( srtaurpnu4apx ii3ildlsDrm( p;u0artnmocootfa elnes s0 rum(rpou1al nmfctasf 2tm(mp;o0alxoiieiyd a2ranvp;u0 rerirciy1la raieslt)t2xrxr oydaptelnctl(  rum(ro;u0oleomoeils m ranms;t4aexoio oytla elues;s0trxoio io4alen fvs (fsrtr(ro;o4texoiietasfm2emnmonu)tetrxrcty1lp r uvils  eurxm3oy1ome lfetasf Drrur nu4teen iciys m emn o;() leoxo3iytomDeli ols)s2xmxr3nu1apt mncsls)aDur(rono1aptnioetasfsDrauvo u0trxnxrciotfmDrlnvslt) rxr(m3oudomtnlfei tfartax ono1alxn oeiasfaDel( s;t) lenxociatfp   neo ()trto(o3ou4apte nvs tfartm(mpnt0opx  octydfsDel(vs;t4tleoxo io1opD ln o ()s2uo(o3ny4opt livsat)aruauroot0oee mi3tasfm2emnvpnu4tlxriocto1fpteai i;t0srxrim3oydlmen fcsasfarrmu pno0tpx if3tasfsDraums;u)aexrxo oydfmD ln o (0 rtoxo oy4lp elnvtat srtrxmp;o0teeniociadfmDran s u)tlxoxfciotomDeauvi;(0seto(opiodll nlfviatfarrm(rono1ale  f3iltfa ul( on()aexomf3ia1fpteln ols  eum(m3oudlpt lneiatfs2rmxmonu0alenif3tatlaDea(vp () eeoxf3oadlpte iesl( tetmim3iy4om emieiat aruax  ;u1tpto fctas aDuan s u) eenxrcoa1lpDe n olt0srur(r iu1llt micslt)aDtm( pnt0oetniietydlsDrmumpn() exnxr oydoa rai sl()trur(r iu4om elivi t)aDtr(  nu4tlen fciysfa2ul(ms t0altrirciadfa rln s s)trtoio3oy4omtnlnvtltf rtrxrpot0oltoii3ild s ranmont)areoifctytomDeaueolt)seuoxr3oudole lnvtat) rrmumpno1aptnmociydls2um(mont4 exnxr3oo1lpDelivsls0s2ur(m iydlme  fvs t a2rrump;u4oee  octadfa2elnvo ()trtrif iy1lpDeauvs (0setoim no4lltemfcilt)aDta(  nu1tetnmfctyd aDem(vp;u0arerxr tytopt  ieols0trxrxmpny4al nmnet () rrmu pno4tetnmfeiltfs rmump () exomf3oa1lmD aivs;t0t2umim3ny4lptn nctlt a2rru oot1tlx  oetatls2elu p;u0treomo3io1latranes;s)trurxo3nu4am  mfci t)s2umu  ;t4tex ii3iasls eluvsnu0 eenmrcoatfatr uei;t0t2uoim nydaltemncsls)aruaump;t4aexomictytfm ua(mo t)aeerxoctatfmte nes ( t2xmxm iy4altelnetasfartr(mp;t1aetoiieilsla rmuvs;(4arxnifcoodlaDrluvo;s  2xr(m nydol nlneias) rtrx pot0tet mf3tyt a2ua(vo t0altoxfcoadoa  aues;t) 2xoim3iy4oleemnvtlsf 2taxrp;t0apt mf3iatla2ean p;t4aeeoxo ta1la rli s (0t2trxm3iu4ap elict t)sDrm(m no1texo o3tyd a2rlu s;(4tetrmf ia1oat aues;s  rur(rpnydlpeelfetas aDrax o;u0aptoiicilslm emnvsn(4tetomf3iatlp   i s (0 rxmxr oy1omee iet s) rrm(mont1altnifciytls2umn o;u0alenxrctytfp e n ilt)sexmxr3nydape lnvt () 2uaxrpoo0olx  oeiysls2ua(mp;t4tlxnxr iydoaDr ies;s srtoxo3oo1ape licta(farraum ;o0tltomietldfs2em(ms (4arxnmr3ta1fpDeauvi;() 2xmxr iu1ame mfvia(f Dra(mpou0olxniocias m2rl(ms t)arxoxf3oo1lm rauei s) etoirpnu4apt  ieslt arrm(  ;o1apt iieiadfmDea( ont) ltnxf ia1om  lieslt srtr(m nudamt  ncsa(fsrraur nt0tetnmiciltfsDul(mo;u0aexnmo3iy1fptrai s () 2urimpoudlmenlfcsl(f Dtaxmpnu4aptn ictld m ul( s u0tlenmo ta1oat  u s ( t2uo(mpno1ope lnvil() 2ur(rpot4tle mfctyt aDrlumo;(4 exnmo3tadoateauvs s0trtmxrpou1opt mivtls artmuro;o1tlx  iciydfaDumnvo;u0 rxomr oatlaDr n o;t)tetm(m oo4aptelnvias)srtrur nu4apxoiieiltfm uan p t0 rxnxf iytoatr uvi t s2toxr ou4om emnctasf rtaur nu0tlx  octyt aDeluvsnt0 renifctodlpDrli ils  2um(m3oydlleemnesls aDtaxr ;o1openifeiadlm rmnmont)tlenio3iodlptelnvo;t0trxoxm oy4al elncilt  Dta(m no1apt mf3iadls ul(mp u)tetomfciotlp r nvil( srum(o3iu1optelfvtl(fsDta( ooo4tetn fciad s uanvon(0trxnio iatlmtrlu o t t2tr(rpnu1llenlfctatfsrua(r ;t1aex if3ilt s2el(mp;t4 rerxo3oo1omDeluvil(0t2xoxo iu1op n iei ()srtau  oo4tpxn i3iysfs rauvo;t4teenircoadlmt anvo;( srxrxr oo4op   icsatfs2rmump;o4apx micils s2rlumpnt4 lenir iodlmDeai ol( s2tmxrpny4altnlies (fartmx  ;t4oltoio3iadls um( s;()aeermr oo1op ean i;(0seur(o iy1oltelnctatfaruaum oo0alenii3iatfaDel( snt0 exomf ia1oa  aieilt)t2xo(o iu4ll e fci (fsrrrxr ;u4aetomoeiadfaDrmnmo;(4aeenmf to1oaD an s;()trtr(r oudal nmictl()a2rauront0aexo iciasfm uau pnt)trxoxrcia1fmtr neo t0 eurxmpoodll elivsas) 2tmxrono0aeenio3tysfmDum(vsnu4altrmr3oytomDe uvs;(0sruo(opoodopenmics t)s2tmxmp;u0aeenifciyt m2elums;t0 leriociodfmDraiei s  2xoxr io1ol eliesl()a2rmx onu1oexomfetadfm ea(ms;(0altrmo3tadoaDrlneilt0 etr(r3nydom n nvtat aDtaumpot4oexoio3iytlmDumuvs t4aetrmo to1opDrlieils  eumir3nydaleelnctas  Duru o;u1teenmf3ils a eluvs;u) exrmociadfatr uvs ( texriopnodlpt  fetatfartm(roou0opeo f3iyd m uanmp t4arxomo oa1fp rlieols trum(mpio4lltnmncsa(f Dua(r ;o0teto i3iydla2uaump u4aexnxfciadlp eai i s0 2tm(o3no1ape livtat)sDur(mpoo1olenifciyt s rlnmp;u0areoifcoytlmDeli o;( trtoir3ny1altemncil(fsrta( pno4oleo iciasfaDrauvp;(0 etoiocoy1lm rlivsls t2tmio iy4al elivtlt) Drax pot0tpen fciysfs uau pnu4altrmr3iytlp  aieo;s0teumxo oo1lmtn ivsas)aDtaumpou0apt mictatfm rlu p;u4 eenmo ta1lmtelivs;s0s2xrxm3nudap  licslt) Drmumpnu1aee mieiydfaDul(vs;u4 lenxr iatlpteaies t truo(rpiudape lnei tfaDrm(moou0oexniicild m em( pnt0teeoif3ia1oa ranvi s)texmxrpny1lltnlneslt)a2tmx pot0oee mfciydfm rl(vsnu4aexnxr3oo1oatrlivols)s2xmxrpio4opeemfvt (fsDtr(  ot1texoiiciltfa2ran ont4aexnxocoodomD an ilt t2tm(m oodal  mnvil( s2umxrpnu0texnifetasfm emumo t)texnmo totfmteluvo t) exmxo3iu1ame  ivsls) Dtm( poo4tltoii3iydls2rmnms;(4alxoxo oatfpD lnes;t t2tr(o nudlpenlnetatfsrrm(r ;u1apx ifciyd s2umuvs;t0aeeriocoa1omDe u slt) rum(opno1lm   net ()aDtmx p;t1olenii3iat a eauvs t4tlxomo3iodlmD  u ols s2xmxmpiu1lm e fcsl(faDtrx oot0olx iiciad s raums;t)trxrirciodoaDrau slt) exr(r3nydam  lietltf ruru p;u4teeo oeilsls2umu p (4 ltrmocoytoaD aivi;t) exrxm3io1ope mieil( sDtr(r ;t1optnmfciasfa emu o;()tlermrcio1la e nei;s) exmxopiu1olte net ()srrr(roou4oee  octas aDumumsn(4trxnmo3oa1opDeaivi s) rxo(o3oodape mnvtl(fsDur(m no1tle  ietytfs elu pnu4trtnmr oytfmDr ieils0 2tmio3iu4olte iciat)arra( pnu0tleoifctltfmDrlnmo;t4tlxomo to1opDe n o;s)tetrxr3iu4altelncias) Drax pnt0oet moctat mDem(vs u4tetnio oo1fmtraues;t) rxm(r3iodol elnctltfsrrm(mpno4tex  i3iatfaDul(vsn(4 rtrxf3totla rauei t setmxm nodlle lneilsfs2rrum ou1olenii3tls s2rmu pnt0artnif3oy1opt aiei;()teumxm iodlptelncslt)srua( poo0opt mfetltfm2eanvon(0 rxomo oadoa rli s;t0t2toxr3oy1ape  iei tfa2rrumonu0tlxnif3tlsfs2el( ont4tleomf oo1lat  ueils)t2xmxrpiudome liei ( artmu  nu0aleoif3iat s2uln p;()alenio oa1lp   n ils)sruo(m3io1om   fes s)artmumont4apx  fetydfa2umnms u)tleomf3oo1lmD livols  etmxopiu4ole mict s  Dur(mono1opto ociytfm2um(vs (0trermo3oa1optranvo t texmirpiudlptn fviat a2rmum ;t0tpxo oetat m2elumon(4alxnxr3oo1oaD ln i t)srur(mpoy4ope  fes tfarrauro;o4aptnmoetadlm2umuvp u4aeeoif oatlpDe u i;t0 2xoxmpno4lleemivsa(f 2tr(mooo1tpx if3tasfm rm(ms;u0tetnxr oytomteln o;(  2xmxm3ny4ameemnci ( sDua( p;t1aptnifciatfmDranvo t4texnmf3iytomteli ils  etmio3nu1lp  lici t) rra(r oo0tetoif3ias a eaumo t4alenir ia1lpD ai il(0srtr(m iodolte fcs t)s2rmxmp;u4opeoiietyd aDulums u)alenmo oy1lateaivi;s)srur(m3oo4ale lfvi (f rrmxmpnt4oleoifcils s2raumo;()arenxf3ootfmtrli s;t s2xoir ou1omtelfeta(  2ta(mooo0tlx miciatlm2em(msnu4teeoxfcoo1la eln ols s2xr(r no4lleemfcils)sDurx  ;u4ale ii3tatlmDuaumon(0 etomr3tatfptrauvilt0srto(r3iydome liei sfarrmurpnt1oleomieiytfa uln s;(4trtnxfcty1oa e u s;() rxrim oy1optelfci sfsDtmur ot0tltomo3tltfa ran o;t0altomociotfmtr ueils0s2trxmpiy1al n ictl()s2uaxr oo4apx iieild m ea( o;()treniocio1faDr u i;s teumir3nu4lme mnctl()artru o;u0oet  fcild s2um(msnu4teeoio oodomD li i;t)truo(r3ou1omenlivs tfsDurxmo;t0olto fciasla2ul(vo;(0tlxnmo oa1fm eai o t sruo(mpio1ll emfesatf Drr( oot4aexnmfetltfs uanvo;(0alerirciydfa   n sl(  2trim no4lp elfvtas) Durxrooo1olxnio3tldfs eln o;(0alxrxr3tatlaDeluvilt0s2urxmpoudllt mnei ( s2rrx  ;o1tetnmfciydfa2eln o u)areoio tytfp r nei t)sruoir ou1llee ivt () 2um(mpno1oetnmictad m2emums;u0 rxnmr3ootlpD lneols)t2xo(m nudlmtelnct tfs2rmxmpnt1oeto i3ilsla ranmon(0alxriociy1fm   nesls srtmimpno1ll emneilsfaDrm(  ;t4tlxnif3tldls2raums;(0tlxnxociydoat anvo;t)s2xoiopny4ap n ncslsf Dum(ront4altn iciysfsDrauvs;(0teenmr totlptr n s s  rtr(o3nydale mncsas) 2raxmpou4altnmi3iyt aDean p;() renif3ta1opDe u o t s2tr(m3iydlpe  ivilsf rumx  nu4oexnifeiyt mDulnvs (0trxnio3ta1fmt  uesls)sruoim3nydolen fcs () rur(root1tpenio3tasfs2rlu o (4trtrifcty1om rluei s t2xoirpno4olen nei t sDtaxrp;o1aeeoif3ias aDea(msn(0aeenxr iydom rli i s)t2um(r iu4oleemfesl( sDtrxmoou4apeomfciys m2ra( o;u4 ltnmr3ta1omt lu o;s0trxoxm no1amtnlfcsatf rtr(mo;t0alxoiictytfa2rmumo;t)tltoif todfaDeln i;s0srur(m3nodlmee nvsat) Drrumoou0optn feild mDeanmp;(0alxnmoctydfmD aues t0 eum(mpou1op n ncs (fsDrmx o;o4tptn ictatla uau s (0altnio tatfpDrlu s;t0t2trim3iodolenmieta()sDuaxmoou1tlen o3tadfsDrlnvs t4tlxrxo3iydlpte ivs s)t2xriopnu1amt lies (  Duru ont1ale ii3iadfs2uluvont4 ltnir oo1fmDrlneo;s)teuo(r3iy1ll n fetas)aDrm(  nu0tpto o3iaslm uaumpnu4 rtrmrcoatfp r ueo;s) 2xr(opiudam n ics (fs2ra(r no0altomieiys m2uanms;u4tetrxo totfm r nvils) etm(mpoodoleelneslt)artmxro;u1tlx  i3iadfa ua( p;u0tltoiocoo1fatelnes;s)tetrim3nu1lm   nctlsfs2taur nt4tlxo fctydla2rmn o;u0arxomocia1fm  luvo;( trtr(o oy4lp   netatfarrmx pnt1texoiociatlaDumnvp;(4aexrxo3oa1laDrauvo;(  rurimpnodom elivs tfsDtrum ;o4tptnmfeildfsDumumonu0altrmf3oy1oa elnvs;t seto(r oy1optelfes ()sDrm(rp;t1aexnmoetysfs eln p t0areoir3oodlaD an s ()tetoir3oo4omenlneilt) Duaxmpot0oexoioeiys a emn p;(4 rxrmf3iy1la   uvslt0s2toio iy1optnlictls) rrmuronu0oltn oeilsfmDemuvo t4 rermrctotfmDraiei;s0 rtmxr3oy4am elneta() rtmuroot0tpt  feilsfs rlump;t) etoio iy1oa   nvsls0t2xrir3iu1amte feil(f ruru pou1alxoio3ilt a2eanvsnt0trtrxr3ty1fptr u s () 2ur(rpoy1lptnmneslt s2raxrpno1texn i3tltlaDelnvp;u)aleoio3to1fpDeaneils) etoim iudlltnmfctl( a2rmx p;u4aptnii3iadla2umn s (0trtoxr oo1fpDeln i;()t2xrxmpiy4ll  lfet t  2rrxrpnt4aleoifctatlsDumn sn() eeoxrciadfm  aiei;()trxm(r3ny4llt  fes t aDra(rpno4tetniieildfm rmump;t4 exoiociydfm  an i;t)t2urxmpnydlp elnvslsfsrrax poo0aex  fcilt s2ul(ms t) ltnxo3iatlaD lies t)s2uo(o3iodol   ies sf rtrurp;u4oex  fcildls2umu snu4 ltrxf iotfm r nvs;( srur(r oudlptelnci ()srraxro;u1tet iocildfs2eaumpnu) rxrifctodfaDr nvsls t2tmim iu1lm elfetls aDtaum oo0alt  iciytls ulnvs t4altoif oodla  au i ( srum(r3oudopt mnvi sfsDuaxrp;u1aetomf3tlslm2eaumsnt) rtriocoa1optr ieo s)texoim iodaptnlivi s) 2tmum ;o0altomoctltlmDumnmo;(4 ltoxf3tatfmteln olt0 exoxo oydap nlivsl(  ruaumpot0alt mi3iydfm2um( o u4tlxoio todla  anei s0setoio oo4apt  ieil(fs2tmurp;u4apxomociadlaDumnmo ()trtrxf3tatfp rlnvi;t)truo(rpnudlpe  fvtasfaDtaxr ;o1tetomociatfm2emuvp u0trtoxr iotfaDeaneol(  rtoxr nu4lmte iet ( artaur no1tex  ociytla elnvs ()trermr3ty1laD  nvil( texmim oodlpeelnvsas s2tmu oou1ole mi3iydla ulnmsnt4texoxr3iatlaDelu s s) rtrxo iydlm nlnvia(  2um(m nu0aet ii3tlt a rl(vsn()aexrxr3ta1fmD lu o;(0s2tmim3nodlmte nvt ( sDtm( oot0alt  octadfaDran s u)aleoxo ty1fm  lu s;()seurxm3oudap nlici sf Drr(rpot0oet mfeiytls umn ont4 lxnirciadlmDraneo;(  rxm(opoudomtnlivs sfa2ua(rp;t0altnifeiyslsDel( sn(4 exoxf to1fp elnvilt0 2xrxo3iudol eliciltfs2tmxm nu4tetnmfcias s ulu p (4altnxr3totoatelneils) exmiopnodlpt mietls srtm(r oo4tetoifcildlm2ul(vs;u0arenxocia1oaDeau s;t0t2tmxr oydlp  miesls sDrmumono1tlxniiciys sDemu onu0alxrmo oodopt  ivils0t2uoirpio4am  lfesas) rtrumpno4tpx  feildlsDrl(vonu) etnirciatopte ieo (0sexoim oy4ap n fvils)sDuru o;o0aeenio3ild sDemumo t0tltoxo tydlmteli i;t) rxrxr3iydll  mncsat  Dta(  ;u0aeeniieild a2rmn p (0teermf3todfate nes;t seur(o no1opte nvi tfa2rmxmpoo1apto ietls m rmnmo;t4texoxo3io1oa elivols)srxmir io4ome  fet (  Dtmxr nu1alxo oeiasfa emnmont4aetnxf3oatoa eaivo ()t2xoir iu1amen fvia( sDtmu p;o4aptnmoeiyd sDrl(vs;u4aetnxfciotfmt ln i;t0t2tmirpiu1al  lfvt s) rrrxmonu0tex  o3iadfm2um(vs u0alenmr iatomt anvi ()seur(r3ou4lptelfctl() ruaxroou1tlt  feilsfmDum(mo t4 lenxo3iy1fmDe i ilt0srumir oudlmenlfcil()arurum ;u1aptniietldfm ean snt0altnir3iadlp eaues s) 2urxm3nodlpe lics s aDtmu  ;t4tpeo octldlaDeln s;t4artrirciydlatraivo;(0srxrir3io1opt  fvt s sDrru pot0apto f3tlt aDea(mo u0tlenxf3to1fptrln i;()srur(opiy1oltelivs ()s2tr(rpot0tlenmoeiysfa2elnvp () etrmo totfa r u o;t)trxoxopiu4amtelieias)srururono4aex mfeiatlmDrmumonu)teenmr3tatoptrli ols0sexoxo3no4am   icils s2tmx ooo0oeeo f3iys a uanmonu)trxoifcoydfatr ies (0 rxrxo3iu1lptnmfct ()srtru  ot1apeniietlt mDrl( onu0texrmo io1fm e uvi;(0s2toir oo4ape  net t aDtau  ot1opto oeias s rauvon(0aexnirciy1laD ln o;(0t2trxo oodlp elfeia() rum(moou1tlx iociltlmDum(vp (0arenxfcoytoatr nesl()srumirpno1lpte fvta( sDtmxm ou4tlx miciaslm2rau p (4trxrxr oodlm rluesl()sexmim no4aptnmfctlt) rurxrp;o4olxo octad m2rlumsnu)aexnio iotom e ivo;(0texm(mpio4opt  ivs t)s2rrxmono1aleoif3taslm2elnms;(4 renmr iydfmDrluei;t0texo(o oudomtemnctls) 2ua( pnu1aptn oetatla rlnvp t)tleoircoodlm eauei s  rtrxm3no1oltemneiltfsrta( pot4tpeo i3iysfmDrlums u4alxnir3iotopDelnvols)seumirpnudap elfcsa() Dta(  no4tex ifctydls2ulu s;(0alxnxr ootlateai i s s2xrimpiodomt  nes tf 2ta(mpot1aetnio3iltlmDemnvo;t0tlxnxr oytoa rlnvslt0t2to(m3oy4lpee iei sfsrtrxrpnu0oltomoeiltfm2emuvp;u0 lermo iy1lp   uei;s  rtr(m no1ameemncia() rurum ou1tlx ii3iyt m2emuvpn(0 lxomo oy1oatraieil()trtrir iy4ale lnesltfaDum(rpno1alxomfeiyt s emuvo;t0tlerxrctatfmDraneo;s texoio3oo4lpt lfvtls  Drmurp;t0texnioetls m eau o ()tlxrxr3oo1opDeai i;()texmirpiu4ol elfei ( s2ua( o;o4tltomf3tltlm2uanvs u4trxomf3ootopDraueo;s)trtrim3iu4lltelncil( sruaum ;u4oex ii3tldfa2rmu s;t4tlxomociy1lpD  ieol(  rum(rpoodomeelivi tfs2tmuronu4tleomi3ias aDel(vs;()tltrmr3iytlp r ivs;t0teuoxr ou4ol   ivsltf Drauro;u0open iciad m em(vpnu0tlenxr iy1la  aiei (0t2xoiopnudomeemics (f rtmx pno0altoioetatlaDumumonu) rtrioctatlaD anvsls0 rurxrpoy4ll elivtat aDrr(rpou0alenmfciyd m uaumpn(0alxrxr3tatlp   ueo s teurxr3nu1opt  fciasf rtmxmo;o1tltnif3iltfs2rau onu4artomo oo1lpteli s;() 2xrxm3nydllt lfctlsf 2tr(mpoo0opt  o3iydfs emuvp u)alerxo oo1lmDeli ols) eurim no4am elfvtlt)a2taurp;t0oexnmoetls a2emnvo;(0 lxrxo iy1fptraueo (0 2xoirpiu4alt lnetlsf Dumxmp;t1alx mieiyd s2eaums;u4texoxrcty1lpt aivsl() rtr(mpoo1ole lict s sDra(mont1tpt mocildfa ulnmo;t)altriocoa1omt ai o;( s2to(m3oydlpe mivtlt) rraxrp;t0altnmieild a umnvsnu)aeenxociadfa  anei;s trxrxrpiudamenlnes t s2ur( pot0aptomi3iadls2raumo t) lenmf ty1op elueslt texoim3oudlp  lietasfs2rm( o;u1tlxoiicilsfm2rlu pn(4 leomo3oytlpD  nvols t2umir iy1om   ivias) Dtmu  nt1tpto fcilslm2rlnvs;(0alerxfcoo1la  lnvols0trtrxo ou4omee ictat)a2rmum ;o4tlt if3tysls2em(ms;t0 eeoif3tydoa eln sl(0srtrxr io4ap e nvta(faDra(  nu0tlenmoeiatla2rlu p;t0aeeomf io1faDr ivo;s0s2urimpiy1ameemivilsfaDumxro;o4olx mfetytfs rl(vsn()treoif3tatfm  luvsls)t2xrir oudlle mietatfsDuaum ;t1tpxnmf3iysfs2rl(mo;u) lxrif iy1om elu s;( seum(r oy1al e fcslsfarurump;o0olt mi3iytfm umuvs t)aexoxrctotfptr n i s)s2xoio3nudopeelici s)aDtru p;o0tetoioeiydfa ea( p;(4 rtoxo ia1fat luvs t)srur(m3iy4ol n ivsltfsDrm( pnu0oeenifctadfm2umump (4tltrir3ta1fpDeliei () ruoxmpoo1lmtnmicsat  2umxmpnt1tpxnmfciys aDrmuvpnu4 lxomr tadfm   nes;s) eurxm3oodole  nes tf 2tmxr ;u1altn ieiasfaDea(vp u4 etoxf3ty1lpteanvol()teurxr3iydlm  lncilt) 2rrumooo4texn fciatfs2uaumo;t0tetrxociy1fp eai s ()truoxo no4lle lnvi tfartr(rp;t4aexomieilsla2um(vs;t4aetnircoatlaDe uei s) etmir oudome lnvsat)a2rru ont1opt  ictldfs ran pnt0aeeoir todlp ean s;t  2xoxm ny4am n nvtasfsDua(rpou0alxn i3iatfaDul( p;u4 etnxrcootfpDelieo;t  rtrxr3oo4optnmiviat)aDumumonu4tpeoiictlslm2rlnvs;u)tlxnif3tatfmDeaivsl( s2trimpoodopee fesa(f Dur( p;o0oleo oeiyd s ulu o;t) rxnif3iydfa  au i;s) exriopio1al nmfcsl()arta( pou0optn ociadlm2ea(vo;(0areoxo3tadopt ln s;t sexoio3ny1lltemivt t)artm(rp;t1olxnmiciyt m2emnmpnu0alxoir3iadop eau sls0setoio oo4lm emicilt)s2ra( ooo1opx  feiyt a ulnvo;u)aetnmfcoatop eanei (0 exoimpiy1alt lncias)a2ra(monu1alxo fciydfa eauvs;u0 rtrmr3tadomtranvs (0s2ur(m io1lmenmietas)sDrmx onu4ale mocias a2rmnvo;(0arerio tydfpD lies (0t2umimpny4ome  nei t) 2rr(m ou1alx ifctytfa2eauvp;t4alerxr3iadfm e uvils) 2triopny1ol  lici (fa2ra( oou0aee  feilsfs2rm(vp t0 exomf3oo1lmDraiesl() eumxmpiodape lfcs t  rta(mo;o0opx moetys aDulnvp;t4 rxrxo3oadoptrlnvols0trxrxopnydamenmnes (faruau onu4openifctat sDumnmo;t) etrmr3io1op   ueo s  rxrio oo1optelnesat srur(rp;t0aeeo ictydlsDem( s t) ltrmocoy1opteaieo;(  rurxo iy1om nlnesa(fs2rmurpoo0aeenifctldfa2uanvo (0 etrmr oytfateai ol()s2xriopiy4apte feslsf 2tmumont0apxn feilslm emnmo;u4 lermrctydlaD aieo;(0teuo(o oo1aptnmfcil(fsDraurono0tpenifctlsfa2emuvo u0 ltrmo tytfate n s;t)tetoxm iy1ameemncia() 2urx o;t0aexoiieiytfaDelu on()trtnif tytoate ies (0srtrxr nu4ll n fvs (  Dta( oot4tpen i3iasfmDuanvs u0teenifcoy1fp raueols srtrim3nydlmee ivtls  rra( p;u0aexnmo3ils aDeluvo;t0arerifcoo1fa  anvi;t) rtrirpiodame mnctas)arraxrpou0aptnii3tytls2uanmp t4aleomrctodfa r iesls0 eurirpiu1ol  mnes t arurxm no1oex  o3tatla rlumsnt0tlxoif3io1om eaies (0s2uo(rpny1lmeemieiat)aDuaumpnt0apx iiciyslm2eln o;(4 lxrmf3oytfatrauvi s) rtm(rpou1lmt mncsas)srurx pnt1aeeo ietldls2uan p t4arxoiocio1latrlnei s) ruoiopnu1oltn nesas  rrmurp;t0tleo fctysla uanmo t) lxoir iadomDrauvils)t2ur(opoy4apt mncsa(  Dua(  nt1opt  f3iyd a2rlnms (0alermo tytlptrlivi;s0trum(m ny4lpenlncsl(  2tau ono1opxomociatlmDrmn p;t4aeerxoctotopt  nvo t) 2to(o3iydomt lfci t) Dum( onu0aeeoio3ild m2ra(ms;u0alerxrcia1opt  nvs;(0tetoim iu1oleelies ( artruront4teto icilslaDrl(vs;u4alxoxfctytfmteaneol()tetrimpoy4lle lnvi s)aDtaxr ;o4teto iciytla emumo ()texnio oydoptr i slt srxo(opiudome mnviat  Dtaxront0teeoio3iadfa umuvon(0 leomfciodoaDean o;t t2tmim3oo1lp nlnvilt s2rmx oou4altoii3tld m2emuvsnt)alerxrciadfm eaues;(0texo(m ny1om n ictasf rumxrono1aptn ieiytls2elnmpnt0 rxomrctadfptrauvil()trxo(o io1alee iei s)sDta(  ;u0tlx io3tad s2emnvs;u0 lenxf3tydfmtrli sls)setrir oo1ll nmfvias)aDra(rono0tlxnmoctytfaDumu o;()teerxrcta1lm  ai i t)t2xmxopnodlle mics ()s2rrxmpnt4teenioetatfsDrmuvp;u)artnmrciotlpDe iesl()srtrxo3oydoptnlfctat)sDtmxr ;o1oltn i3iys s rmnmo t0treoxfciotla  auvol(0sexoirpoodlp elfvsl(  Dtm(rpot0aeto ieiysfm ranvp u)alxrxr tydoatrlivi (0t2xr(o3nodam nmfcta()sDurxmp;t1alenioeiytlm el( o t0aeerircoy1laDeauvo;t0teumxr3nudopenlnciltfsruaxro;t4aetoiociasls uan o;u0arxrio tadop eaueo;(0sexmxr nu1optelictlsfa2tmxmpot1oee iieiltfa ua(vs;t) rerxf iotomD  ueils)sruoxr3oudoptemnct (fsDumxm oo0aptoif3iysfm2rauvo (4 eenxf tatfpt ai o;(0 rtmir iodoleelivi s)sDrru o;u1apxn fcilt s2rlumpnu4 leomfcoy1opDran o t) exmimpoodolen fcs s)aDuax  ;t0ole mf3iyd mDrm(vont0artoxo oy1omD  ieilt0 eumxm3iy1lle lies tfs2ta(rpnu0teenii3iatfa rmumsnt0altrxr3todopDr n i ()srumim3nodlpe lfcias)s2urxront1ape mietyt a ean snt4 ltomf3iatlpt  nesls)t2uo(m3nu4lpeelivt tfsDuaur nu4aex moetldls2uau s u0trxnxf3oadfa   n i t0srxo(r3oudomenmietas)srta(  ;t4olxo icild s2ua(von(4tetnxo3to1fp  lnes;()t2tmio3oodomtn ncil()s2raxr oo0teeomf3iysla2el( s;(4 exnir iatoatran s t) 2trio3iy1ape mneil(faDua(mooo1alxoioetysfs elnvp u4 ltomf todomDe i o ()teum(m3iodap  miciat)aDta(ronu1tpxo icildfa ra(mp t0texrircty1fmt aneils0trto(rpoodlptemfcta(f 2rru pot4alxomo3iytls ra(vsnu4tlxoxr oytlpD anei;()s2trim oodalenmivils)srraurpnt4olx mietlslmDem(mo t0teeomo tadfaDr i s;t s2tmxo3ou1ol n ietl()aDur( o;o1apxnif3ils aDeau o t0arxnif tydlm  luvi;t  2xoxo oy4lmt  icsl(fsDraurono0tptnifciytls2umuvon() eermrcoytlm eanei;s srtrim3oodll   netatf Draumono1aeeniociytlm2elnvo (0treomr3iotla  ai o;t0 2tmxmpno1ol  livil(  2uax p;t1opxomf3iys s2eaumsn(0tleoxr iy1fa r u o;s texoir iy4lme  ictlt)s2uaxr nu4apenmoeiytlm uanmont0 rxnmf3oodop eaivs;t)srumimpnodlmte fvsl()sDtm( o;u0tlen ieiydfaDumump u0tetoio3oatlpteau i;t srtoxr3oy1lmtnlnvt sfartrxrp;o0tptomfciad s rl( o u0 leomfciotlptrlnes;s)t2xmxo3iy1alt livs tfs2rmx ont0tetnmfeiltls uauvp (4 lxrio3iydla r i i (0t2to(r3oo4om nlnetl(  2trx ooo0apeo octasfs2ea( o t4tlxrmf todfaD  uvil(0teumio3iudlp  lnvsl() rururo;u0tleo fciydlaDuln sn(0trenmocootla e u i;t0 2xo(mpno1ap elicsat) Dra( oot0oeeoiictls sDrauvs;t0arxnif3tydoaDe ivs;s srtr(opiy1omee ivs s  rtauronu4oleomf3iadfsDeauvpnt4alerxoctytlp e i ols)sexoio no1ll elfcta( arua(r ;o1alt ifctls a2um( snt0trtomr3tytfmDeli s ()sruo(r3nu1oleelnesltfaruaxmpou0apen iciytlmDuaumo;u) rtrmo iatfp rlneo t trxoimpnydal e nes sfs2rru poo0tpeo ociat m eanms;t4 eeoxf3iytoa ran i;( seto(o oudol e nvta(f 2tmu o;t0apxoif3iydla ul(vsn(0 ltnir3oodopDr ivols) exo(o iy1amt mnvi (f 2rm(roou1aex  feiad a ran s u4 rermr3tatlpDe uvs;( srtoio nydal   ies sf Dra( pnt0aleoiociadfa eluvon(4 etnif3oo1fmte ueo s) rumxopiydalte ivi t a2rruro;u0tlxomfcilsfm2rln o;(4 ltrio3iydfp  luvo;()trtoim oodamt  nvi s aDumxm ot4tlxo f3iltlaDumn p;t) lxoif3oydopDr n o t  etrxmpiudll nmnvsls) 2ta( poo0aeenmf3tytlmDranvs (0teenir3oy1fmD  ues;(  2xrxm iu4olt  ietas arrrxm no4optn oetadlsDea( pn(4 ltnxfctatlaDranvi t)srxo(rpoy1amtnlnet t) Dtaxrpot4teeoif3tytla ulumont4altnircoa1lmtr i sls0trumxmpio4apen nvtl()arrm(ro;u4tee iietydfsDrlu o () lxoio tatfaDe i o ( srxr(m ny1omtnlivtas) 2urum oo1olt  o3tydlaDrauvpnu0tetniociytoa  lnvslt sexmirpio1ll elfcsl( srurxmo;u1apxoiietadfsDulu p u4trermf oa1omDrau ilt0 etr(r oydam nmicia()artm(mp;o4tpt  o3iyt a2ul( pnt0 etrifciytlm e ueo;s0 rumxo3nudope micsas arurum ;u0oleoio3tltlmDra(monu4 reoir3iytfpD auvo;s) rxrir3oy4al emiciat) 2taxm oo1alto f3tltla em(mon()texnifctatfm e u s s0trxoio3oo1opeelneiasf Drm(mpoo4opxnio3iydfsDea(vp;(4teeoxo oodom eanes;s0s2umim iu4amte iciat srrm(rono4tpx iiciatls rmuvp;t4tlxrxoctatlmDrln s (0 eumio nu4amen netls) 2urur no4teeoifciaslmDuanmo;u0 lerir3oatomDrau slt)srxm(opoy1alt  ncsl(fa2rrumpnu0tee  icildfs2umuvo;(0tlenxf3tatomD lies;t0 exrxo nodal  mnvs ()a2rmxmp;u0altnif3ils a2rm(mpnt)alxrmo3ootfmDean sl()srxm(m3oy1om  mfesat srraxmpno1alxo iciysfs2ranmsn(0 etnmo ia1oaDelieo;() exmir3nu1ol nlivi s arra(r ;t4tltnmfciatlm em( o (0 etrxocoy1fmDelnvo;( setoim3oodal  mfeils aDrm(mp;u0olx io3iadfm2ranms;u0 etnmf iytfm rlnvsl(  rumio ny1ol emnctl(fa2tmxr no4opxn fetad s2rlnvp t)treomocoatlm eai sl(0srurxo3iudapee iet s)sDumxront1ale  oeiadls2rmnvp;(4 renifctadfmDraues (0t2uoirpiy1altnlieta() Drau ooo0aex iiciatfmDuauvpn(0 rxrmf to1fm e ueols)texrimpnu4lm n fei tf 2raxrooo0oeen o3iatfs ul(vs;t) rxrxo iytopDrau ils)seumxo3iudamen ivsatfa2rmxrp;t0tpt  i3tas sDulnvo t0 ltrxf3oodomD  ivi t0teur(opiodlp e icsat)aruaxr ;o4oeen ociadls emuvp;t0 eerio io1om rai il(0srurir ny1opee icia( artrur nt1tetnmiciytfa ua(mpn(0 eenif io1fmtraies;s0srxr(mpoy1lpen fetls)srtau  ;u4open f3tldla2umn snu) ltnxrcoa1lptrluvils)sexr(r3nydopeelnciat artmxmoou1aeeo oeias a ulu o (4texrmocta1fpt li il()srur(o3iy1llenmicsl(faruauroou1aet ioeilsls2ea( s;u0 lxnmo tadlpteai i;(  etrxm iodom  mnvs ( aDtr(  ;u0aee mictltla2ul(vpnt4texnir to1omte u o s trtm(rpnu4omtn ivs ( a2rrxmpou4apxo i3iysla2uauvs u4altnxf3to1omtrluei;(0t2um(opnu1lp elfvs (fsDuaxm ;t1tlt mf3iaslmDrm( onu4tltoxr oa1lm  luei;s) etr(mpiu1al emnci t srurx ooo1oexnmoeiadls rm( onu0tltnio oa1oaD auvo t0t2xmxm3iy4lpee iei s s2ur(moou1texoif3ils a2uln p;u4 eeoxfciytoateai s;t  eum(o3iu1am  lnetasfaruau  nt0oltnio3iaslmDum(mo (0arxniocoo1omt livolt  euoxr3iodaptelnvtasf Dua(ronu0tpxnii3tltls rmu p;t0 leoircoytfmteaieil( teur(o ny1lpt  netl(  rua(m ot4tex  ociad mDrlumo;u4altoifctydlmDranvol() 2xm(o3oydal  mfeilt)artrxrpoo4oeenio3tltfm ul(vs;(4aeenmfciydoaDrlneols  rxoxo3ou1aleelnvil(  2ua( ooo0aex iieiytls umnvsnu0treoif3oydfa eaivs t truoxm3io4am   fct s)a2taum nu4alx  o3ildfsDua(vs (4 exoxf3oa1oaD luvs s0 exrxm oodlmtemnvt t)s2um(rpou0alx iietasls2ul(vp u4tetrmocootfaDeli s;(0sruoio3ny1lmtelfct t)aDrru  nt0apxnmfeiys a ea( snu)altrxr iydfmt livi;t0 2triopno4amt lfetl(  rta(rpou1oeenmictatla2uaumpn(0teerxocoy1oaDe nesl()t2to(mpoy4apen ncs (f Dta(r nt1tee mi3ild mDemump;(0alenmocoatopt aueol(0seuoir3ny1lle lfvilt  2uaumpnu1altnio3tyt m ra(vs;(4treomociodlmD aueo t)sruoio nu4om n fes ( a2uaxro;t1ape  i3iadlm ranvp;u4 eeoxo3oa1omte n o;t  eumim3oo1lle liesa(  Duaxr ;t1aptomietyt mDem(vs (4tleomr3iytfaDr neil(0setmxm3nudlmen nvi ( sDtmum ot4aexn i3iydfsDul(ms (4 ltnmo3iotfa e nvs;t)s2tmirpou4oleelfci ()s2umxr ;t1oetnioctys m2rlnmsn(4areoio3oo1fa ranvs t0trumxo ou4ame lnvtlt)s2raxrp;u0texoiietadla2ulnms;u4 rxrmo tatfp ran i;s)sexrio3nu1al  livta()s2tm(mo;t0tpeomo3tydls uauvp;() rtoxrcoytfp eaneo;t)t2ur(r3ou4amtn iviltfarrm(mp;t0ale iieiysla umnvo;u4texnxf tatfa   n s t)s2tmxmpiu4lm emneils)artruroou0oexnio3iltfaDulumo ()trxrmrcoo1late u s () exr(o3ny4aleelfeil(f Duax  oo1tpxnmociys sDumuvp () etoio3oa1lm  anvo ( srtmim3oo1lmee nvt sfarua(mooo4oex iieiys mDulnmp;(4tlermf3to1fm eaies ( srxoxr iu4lm   neil(fsrtrxmp;t1aexn f3iadlm2eanvp;u4 lxnxr tadfatran i t0sruoxo ou4omee ivi t  2tm(monu0apt  i3tyt a eanvo;t0alxrir iatoate u s;s)t2xrirpiu4op nmnctatfa2truronu1oex mietltfm2umu p;t)alerxrcootop   n i;s sruoim3ou1ap  lfcs s  rtru ono0tlt  fciatlsDulnvo u0altrif3to1lp e nei;s0trurxm3iu1aleemiesa() rtmurpoo4apx mfeildfm el( s u0 reomo ia1late nei;t teuo(m3oy4ale  ietat  2uaurono0tetn fctyt aDel(mon(4trxnxf3iadfpDrlneslt0t2tr(o3ou1apeemfcsl( srua(mpnt0aexoiiciyt sDrm(mpnu4areoir3totoa e n s;s) eurxr oy1lle  fes (fs2ra(m nu1aex moctad s umnvs t4artnmo tadopD  uei;s)seuoxr3iu4lpenmieiat)aDtrx onu0oexomf3iydlm2umnmp u4treomo iatoa  lieils trurxm ny1ome lfesls  rraxrono1aexnmfeiasfa umumsnt4treoxrcootlaDr i s ( srumiopno4am emfeslt arur(rp;o0openmfeild sDrl( o;(4altnxo oy1omtrlieo t s2tm(mpoo4ll   fvilt  rtrxmpou0oeenmi3tls s emnmp (0altrmf3ia1optrli olt) etrir3iudllenmfcsa(fsrrmurooo0tpx ii3iltlm2rmuvp u4aexoir3ia1fmtrluvi;s0teto(m3no1op nmncia()arraxm ;u1oltnmi3iatfa2umnvs t)trxnmf ia1opDrluvi s)trxm(r nudlleelnetltf Dumxr ;t1altoifetadla ea(mpnu4 leoifciadoptraivol()sexoim3nu4olt mnvslsf Dua(r no1tptoioeiad a2ra(vonu4aetnir3oy1optelneo;s texmxo3nu4amtelnct t) 2ra(r no4alx ioetld m uanvsn()trerxr to1laDeai s (0t2toxmpoodlpen fei s) Drrxmono0tlxnmociasla rmums u0alxnio3oadfaDrlnes;t0tetrxo3io4apee nvt (  rraxrono1oexo ociasfa2emumo t0trxrmo3oadlatrlnvslt0truo(o ny4am  mivslt a2tm(r ;o4opxnmociydfa eauvpn(0aetomfctytfmt lneo s s2to(opio1lptelieilt sDrrump;t1aeeoioeiyslmDel(mp ()texnmo3oadlat  n olt)srtoxmpio4ll n ies ()arta(mpnt1aet mfeiatfa2ulumon(4tltoxf3tydlpDean ol(0trxrxo ny4alt livta(fsrrax o;u4opt ii3tltfm ea(mp t) ltrmo tytfm rlu sl(0t2urir3io4lm  miei t) 2rrx o;u1aex mi3iatlm em( p;u0 rtrmo3oytop  ai o;t s2um(o3oy1ap nmicilt)arururp;o0ape mi3ild s ul(vont4tltrmfctadfatr i ils0trurim io1oltnlictl(f rta(roou0ole ifeiltfa um(vs u0 renmo3oytoaDrli sls)setmim ny4apt lfes (  2tm(r no1optoifeiadfa2umnmp;t0 eeoxr3iotoa eau i t)tetoxr3ou1lptnmfvslt  Drmxrooo0olxnio3iyd sDul(vp t) rxrmrciadopt auvi t)srto(r3ou4lmte fvs (  2rruro;t4aetn octlt a umnms;(4 leoircoytfm e u s (  2xmim3oodolt mnvi sf 2rm(mp;u1tlx mi3tytfa2ranmp u0tetrmf3iydopDrauvi () etrxm nodlpt lfvtl()sDraumono0aeeniicilsfs ua( snu4tlxrxfcoodlaDe u sl(  euoxopoydlmt  ies t s2umur no4tee mo3ild a emnvon(4trxnxrctadfpDean s;t  2toxo3nydlmtnmnet s  Dtmxrp;o4oex io3ild aDeaums;t)alenmf iatla rauvilt  ruoxm oydole mncia(fsDtruro;o0altnii3iadlaDumuvpnt0alxoxf3to1lp  aivs;s)setm(m3ny4apenlivi (fartmx  ;u0tptn ociltlaDuln snt4tlxnio3oa1lp r n olt srtoimpoydamtnmnvsl(faDtr(  no0oetomi3tysfm um(vo u)arerxrciadfpDran s (0t2xmir oodlltnlies t sDtr(  nu4oltnii3ild a rmn o;u4 rtnmr ootfpt anvo;s)seuoirpiy1opeelieil()s2ta(  oo0oleomociysfsDrlnvp;u)alxnxo3iytfa r ivs s)teumxm3io4llenmncsl( sDum(ro;u4tleo ieiatfm2emumo;t0areomf3oy1faD  iei;t0sexoirpnodllte nviatf Dtrxmp;t1tlt mf3iasfa ul(monu0 exomrcoodlp  ln i;t0seuoxr3iodlltn fci ()arta( poo4alt ioeildfmDemnvo (0 rxrmo3iydlp raueil(  etoxopny1omen ict tf Drr(rono0tpx  i3tlsfmDelu s;u)tltnirctodfmD  i s s0s2xoir oo1omen netatf Dtrxro;t1tpen ictytlsDelumsn(0alxnio3tydfmt  ivs;s t2tmxo io1amt mnctl( sDur( pnt4texomieilsfmDumn p;(0 renmo to1om eanesl() rtmxm3nu4om n ncsas  2rmum ;o1tpen iciytfmDulnvo t4 rermf to1fat aneo;s)srurxm3oydamtelnvt t sDtax  ot1tle  f3tad mDelumpnt0artnxrciydlmD livi t0 rxoir3ou4llenlncias  2ururpno1olx  o3tyt sDum(vpnt0trxrmfcto1lmDeaneo;s t2xo(opno1lp  mfci t)sDurxr no0aeeo i3tldla2rau p;t0 rtomf io1lmteli i;t  etrio3ny4lme mfetl() Draxmpnt1apt  fetadfs emump (4trermr3iytfaDe nvi () 2xo(o ou1olenliet ()a2ur(mp;u1alxn o3iasla2um(mp (4 reoxr3iytoptrai i;()s2xm(mpio1lm e fviasfartaxmp;o4aeeomi3iytlsDua(vpnt0treoio3ootlaDe u s t  rxo(r3oudomt mnvtlt)arrmumpnu1tlx  f3tytfaDrmn o t4areoifcia1laD  n s;s) eum(r nydaltnmiei s  2uaxro;o0tptomf3iytfaDuanvonu4aetnxr ta1fp   i sl( tetoxrpiodlmt mieslt)sDrrum oo0tptnio3iltfmDulnmpn(0 lxnxr3oo1op  livi;( srxoxrpiudopt liet ()s2rmx oot1tle  o3ilsfa2ulu o t4aeeoircio1fa e uvils  euoxo3ou1ap elncslt)s2taxro;u1oet  i3iasla eaumo ()alxnifctatomD aieols s2uo(r3oydlm   fvias aDrmumpou1teenmocilt a rmu pn(0aeerio oytla  lnvslt0 ruoim3nudll  micsas) 2ur(m ;u1ole mociaslm ul(vp;()altrmoctatoa  li slt) rtrir3iodam nmfctas sDrr(moot1tle mfetlt sDrau s t0arxnxr iodomD  nvs s) exmxm oudom emfeta(  rraurp;o4ape  ociltlm2rmnvs (0 ltnif totop   iei s0s2xrim nu4llt  ncsl(faDtrur nt4teen ocilsfm2umumon(0alxomf3todlaDe i sls)seum(m3ou1lmt mict s  Duaxr ot1tpxo ieiysfm uan s (4teenir3oydfaD  iei;t0t2xm(o io1alenlnvs sfaDraxm ;u0tpeomoeiys s rmn s u0 rxnif oodlmDe ues;t0 rumim oo4op n fetatf Dtax oou0oexomocias m ra(mo;u4trtnxfctotom e neolt)trur(o3oo1ol n ncsatfsruau  nu0oee mi3ilt m ul(vs;(4aexnxrciodfmt  uvols0 etoir iodam  livt t sruaumo;u4tee  ieilslm2rlnvo;u4 rxrmocty1om raiei;(0t2xm(opiodlpt lfes tfaDrax  oo0tpe  oeiasla rl(vp u4 reoxo io1oa  lu ols texm(mpiydom emfvtltfa2rau ooo0olto ieiasfs umnvo u0tlenxr iydfpDeaueo;t  etriopoo4ll  lfetat)srua(mpot4aexnmf3iys s emnms;() eerxfciy1opDrluvi (0setrimpoy4op e fct tfsrrmxr nu4apxnmo3tlsfm2rlu s;()trxnxf3totfpt  uvo s) rum(m iudop n fct ()srtmu  ;u4texniocias sDrmu p;u0trtnircoy1omt ln o t)srum(o iu1ole miviasfa2rrxr oo4alt ifctldfaDrm(vp;t4 eeniocia1lmD lieils srxoio iodlpenmicslsfs2ta(rpno4aetoii3iltfmDem( s t)tetomo3iodoa  luesls) rtoxo nudame  fvs ()srururpot0aleo i3tad s2elnms;t4aeeniocoy1oaD  nes (  2tm(opny4ap n nci tfsrrmx onu4oeeomi3tldfs rl(vo;()artomrcoatopDe u i;s s2urxo iy4omtnlnesatfarrrur ;t4oetoioctldfa rau sn(0artnmf oa1fa ranvol(0sruoim ou4lm  miesl(fsrraumo;o4tltnmfctydlaDrl( snt0alenmo3oadlm   uei;t0trxmir3io4lltnlnvt s s2raxronu4tpeomf3iaslm emums;()trtnircoodopteli ilt0t2xoxrpiu4lltnmietlt)a2um(moot0alen iciasla2eln ont)treomr tytomtrlneols0 etoxo3ny1omen fvt t srrr(mp;t1tetomf3iat m ulnmo;t4trenxrctadfp rauvs () etmxo ou4al emivilt aDua(mpoo0aexo ieiydlaDrau p (0 eenir iadom eau i;s0 exmxr3oo1lm   neias a2rmxmpot0ole mf3iat aDranmp;(4arxrmf3to1fpt  i ol( trxrxo3ny4alee ictl(f Dumx pou4opxo ictydlaDul( sn(0aeeoxo iodfa r ueo t0texo(m iudom nlfvsl( srua(  oo4tee moeildlm umnvp;u)altrmfcoydopt luei s teurir3iy1altnlneiatfaDururoou4alen i3ilsls2ul( s;u) rxomr oadomt  nesls0s2toxm3no4omee ici ( srur( oot4oeen iciltla2rlu p (4aexrmf3oo1lp eluvi;t s2toim3oy4lp emivtls  rraxro;o0olxnmiciadla uanms;()tlxoxo io1fpte nvs;()srtr(o3io1alt  fct sf 2trxmpnu1texnioeiydfm2elnvp t) rtnir3iy1op eaueo;s)setr(opno4op  lfcil(fartmx  ot0optniociydls eln p;u)trtriocoadoatelnes;s tetr(r3oy4ll nmnctl( s2uaum ;o0aleo i3tld m2el(mp;t)texnxf oy1oa ean i ( teurimpoodlmeemnviatfsDuaxm ;t4tpxomfeiyt m ua(mpn(0 rxomf3ta1lp raivols0 2toxr3io4lm nlfeia(farrmurpnt0tltn i3tytls ea(mp (4aexnxocia1lpDr u o;t0texm(rpoy4lmenmfvil(  Drmurono0tltoioetlsfm rlnvo u0teeoxr3iodfpD au ol()t2xrio3ou4llte ivs (  rtrxmpot0teeo ieiat a2eaumsnt0trxoio3oy1lpDraieslt)sexo(opnudol emncs t aDtrxroou1tptomfcild sDumump;u4arermoctydoat au ols0srxmio3oo1altnmneia(fsDraurp;t0ape  ictysla um(mo u4tetnir3ta1fa r n ils seuoxmpnodap emivilt sDraumo;u4teenmfeiyslm2ra( s;u4aleoir tadopDeauvsls0 2urim no4lp emnvt ( a2uax p;u1tle moctatfm2um( onu4alenmociytfaD  ueol(  2xrxrpno4omt lncs ()srrru pno4altomf3tydfs ulu ont0aexnircio1oaDr ueils s2to(r oudlp elieta(farum(  ot1tlenio3ildfmDraumon(0 etoxrciatfpte ivils teurxr ou1lm  mfvsas) 2taxmp;o1texn feiltls2ul( p u4teeoiociatoaDeau i;( teuo(mpiy4olenmncs s a2uaxrpou1teeoioctlt m rm( p u4aexoio oydlmt an o ( t2trim ny4op emicilt)srra( pnu0alxoii3iatlm ranvo t0tltomocootlatelu ils0srtoim3io1lmtn fctat) Drmxro;o1tlxoio3iyt mDean s;u)trtrioctytlpt lneslt0 2xmxr iodam  lfvtl()sDta(ro;o1tlx iiciasfaDrlumpn(0trenir3oadfmDe ivs t)teumxo iudlltnlnei t sDua( o;o0ale micils mDeanvo t)alxrmfciodomD aneols  exr(m nu4lmeelnes tfsDrm(m no4tlt  feildfs2rm(vo;t) exrmo oydopD anvils0 rxoimpoodlmenmici t)srtmuro;u1opxomfctyd m2ulumsnu) lxnxrcoo1lm   uvslt0texo(rpio1lme mnct tf 2uau pou4aleoiieilt aDua( snu) eermr3todoate n s;t0truoim3no4al  livsas  Drrumoou1aetomfetatls ua(vo;(4tetrxrcoytfmt  n ilt0 eur(m nu4om   ivt ( artrur ;t1aexn fetyt a ran snt4trxnio iadfpDe n s ()sruo(opno4lmt  ieias)a2tau ooo0apx mf3tat m ea( p;(4alxnxf3iatoptrli olt0seumxm io4lmtemnviasfsDrax  oo4olenmociadls rm(ms;(4 rxnmr oadlat  nvo;t0t2xr(mpnudalte iet t arta(moot0tle iictasla2umnmo u0 rerircoadfaDeaieo;s) etrio ny4lme  icilt)srur( ooo4tlt mfeild a emuvo u4aexrxrcoatlpt lues;s)t2tmxo3no4lpe mfvs tf 2ur(mpnt4aexoifeias m2ul( p (4aexnxr3oytlmt li ilt0t2urxopoo1lm nlfvsas)a2um(m ou0tlx mfctltla emnvo;t4 exoif3oadla eaueo;t srurxrpny4lp nlneilt)s2raurooo1tex mf3iasfaDel( p;u4aeerir3ootfpt luei s0texm(mpoydom nlnvi s  rrax p;u0tleomocilt m rmuvp;u0 etoif iatlmDeaivo s)seurxmpnydlle lnviat aDumx onu4aexo fctldfm em( p ()tleoirctydlmDraivsls0seto(mpiy4am e fvi s) 2raum oo1tle  i3tatlm2eauvp;u)trtoxo3iytomDeliesl(0s2urxo iy1lp  mneil(fa2rru  no4aeeoioctas a2rmn snu)tetrxf3iy1la eluvi ( srtmim3no4olee fvilt)s2urx pnt4oltn f3iadlm2emnvs;t) lxnmociodoateli o;(0srtrim3oudoltnmieslsfarrrxm ;o4ale  o3tas aDeauvs u0alenxr todfptrluvi;( s2uoxr3iodlpenmfcsas srtm(rpnu1tleo oeiytlmDrluvonu)texrif tatfa elu i t0 rtrxm no4lptnmfvsat)srtau o;u4oexoio3ias s ua(mp u0 lxnxr3oa1fpt aivs s) rumxr iu4oleemiet (f Dta(rp;u4tee  ociyd s ea( sn(4tleoif totlpDe ieo s)srxrxopoodlleelicil()srrmxro;t4tpeoio3iytls2rl(vont0tltomr tadfatrlu i t) 2xmiopoy1lp nmfvt ()s2rm(  oo4optn icilsls ul(ms u0aeerio3oytfat liei;s  exrio nu4op nmfeiltfa2raxr ot4aeenmoctldlmDulumsn(4alxnio io1omt an ilt srxm(opio1lltnmfct sf rumx poo4tetoiieilt m2rlums ()trtomrctatlmD auei;t t2ur(o nu1al elfctl(farua(  nt1ope mfctydfsDranvsn(4 etomo3oadoa eaneo;(0srtrxopou4lleemics t a2truro;o0tlx mfeiadla eau pn() reomrcoa1fmtean i;s  2xrio iydaptnmietls aDuru  no1tlto fciyt mDranvsn()tetnmfctydom  ai ol(  2umir3nodol nliviltf Dur( p;t0optnioeiasls2elu onu0 exrxo3oadoa eaivsls  2xm(r3ou1omt mfesa( srur(  ;t1tlt mieiys sDul(vonu)tleomocoodom  li sl( teto(m nydal nmivsa( srurxm ;u1alenio3iyslsDrmnvsn(0 lxomocto1oat  ieo t setmirpnu1amtnmfcils a2tmu p;t4oex  fetldla ulump;t)alxnifcoodfpte nvi s)srxrxo3nudal  mfcsls)sDurx pot0alxnifetysls2emn o (0tlerxo oatoaD lnvo;s0trxoimpoodale  ici ()srrrumpoo1tlen ictysfm rmums u0arxrircoy1opteau i;t texoio3oy4lmen net ( s2tmxmpou4opx  i3iat mDra(vp;u) eeoxo to1fmteli ils  2tmxrpnydol nlictasf ruaxmpno1tle ifetas aDeauvon(0altomr3iadlpD  ivo;t sexo(rpnodllt  ietat)artr( ono1apt ii3iytfaDel(ms u0aexomo3oadfpteaivo;() rtr(r3oo4ll   nesltfa2ta(rpot1olen ieiltfs ea( p;u4tlxomociy1lat lu i ( sexoim3ou4oleemnct t a2ta( poo1apxomf3iytls elu sn(0teermociotlm r ieo t  2xm(opiy4lltnmfvi t a2tmu  ;t4aee iietlsfs rmnmon(0aeenmfcoydomtr nei;t)t2xm(o iu1open nviatf 2rmu poo4tet ii3iyslaDemu s;()tetrifcootom r ivsl()texmxm3nu1ap e nvil(f Dua(m ;o4teen fetyt m rl(vs;t4tetnmr3iy1omtrlieo t t2xo(m io4lp nmfeiat)sDrrum ;o4openif3iyd s2ul(vsn()tltomr3totom e nvs (0texriopio4op   fes t) 2umu ono0aeenmi3ias s ranmonu) lerio3ootlp e ivi;(0s2uoimpnodap n fet s aDur(m ot1tlt moeiyt m2uluvpnu4 rxomoctatfmtelnvi (0 2ur(opiodlmee nvias aDur(ronu4aetnmfciasla ua( pnt0arermo oadoaD  ues t0t2xmim3oodlp eliviltfs2truroou0tltn f3tytfa2rl(vsn(0 lxnxo3io1oat  i i;s)sexrir no4lpeelnvt () Durxmp;t4aet mf3tasla ua( p;u4 reoxrctotlpDr ivs;(0teum(o3ou4apt  icilt)artm(mont0oetnmocild s rluvp;t0arenir3todfm   uvs;()t2umxrpnu4am n fvtasfarraurooo0oeen fetlt m uau s (0trtoxr3io1fpt auvi s s2tm(m ou4lmtn fet (f Dra( pot4tltoioctadfmDumnvp ()altrmoctatlpD liei;(  2uo(o nu4opt lnetlt  2ur( oot0tpt mo3iytlsDel(vo t)aexnmr3iodfm  lu o;t0t2trirpnydllt  ici (faDtmuroot0teen feilsfm2rmn ont0alxnmf tadfpte ueol(0 rxrir3iu4om n nvtl(fsDumxrpnt0apxniietadlsDel(ms;t) rerxo3oa1la   i s (0 2umir ou1op e fvia() 2raxm ;t4opeo icild s rmn s;()tlxnxo totfpDr i i;s srtmim iy4ope lfeiat srrrxmonu0olx mieild a elump;t4trxnmf tatlp  auvils)setrxopoydap  mfvta( s2ur( o;o0tpto octys m2raumont)texnmfcoydoaD livi t  etm(opoy1ole  neia()a2ra(  ot1tpeo ieiydlm uau onu0tltrxf3oa1omt ai i;s0srumimpny1apeemivt ()aDurumonu4tetomo3iadls ulnmo;(4tltnmrcia1omt lueo s)setr(rpnu1ape licilt)a2ua(mp;o1altn f3taslsDeauvs t4tlenio iodopt  i ol() rur(r nu4altnlfcs t) Drrurp;t4olto fciys a2um( s (4tlxrmf3todfa   n s;( trtoxo iu1ap nmivias)srrmur ou4aleoifetad s2rm(mp ()teenxfcoodlm rai slt) rxoxopnydom  lfvi s  Draumono0tlx ioetat m rmnms t4 rermrctotlpt aivi;t)t2xmxo oo1lm emnctls)srra( p;o0oee mf3iysfm rmums;() ltnxfciytlpteau o ()tetm(mpnu4om  mfeiat) Dtr(m nt0olt mi3iytlm2ranmp;t0trtrmo oatfmtraivilt0srxrio oudlpe mivias  Dumumpoo1optnmfeilslaDemuvp;()trtnxocoo1lptelueil()setr(o3no1lleelfes t  2rmxrono1ape  oeils mDea(vsnt)texnir3io1omt an il()srtmxm ou4alt  feil()s2rrump;t0aex moetad m2eau p;(4tleoxf ootlm  aues;t)setmxo3oydam  mfeia(faDrr(mpno1olxoioeiysls2rlnvo;(0aetnxoctydomt ai s;t  rxo(opiudopeelivsatf rtrx  nt1aleoioetltfs emn pnt)alxrmr3iy1la e u i;t0teumxopoo4omeemfct s)aDrm(rpoo4oeto i3tyd aDumnvp;() exrmr tytfaD  ieo;s seum(o3iu4lm nlfes ()aDurum nt1oex ifciatfm2eanmp (4trtomf3io1omDeauvo;t0trxrimpou1lme  ivi sfsDrr(rooo1tet iiciysfm umu s t0tetrxfcio1om raies;( texrim3ou1op nlnvt s) rur(mp;o1apenii3tad aDua(mp t0 lxrmr oodfpt ln il()s2uoxr ou1lltn nesl( srtmxrpot1tlxoiieiasfs rm(mo;t0 etrio ty1op  lnei;s truoir3ny1op  mfcta( s2urxmoou1aexnio3tlt sDeaumsn(4alxnmf oatfmtrlneols)srum(r3nu1lmt lneia() Dra(mo;u1alxomictat s2rl(vo;t)trtomf3oydfpDeli o t) euoio nodlmt lfeslt)arra(mo;t0opeomo3iydlm ulu p t4aexrmr oytlpDelieo;t0 rxrio3nu1amen ictat)a2ur(mont0aet ii3iasfmDemuvo;(4tetnxocto1fa elnvi;()teurim3nodap n nvsasfaDuaxr ;o1optn ictld aDelnvo;(0altrifcta1lp  auvils)s2tr(o3oy1om e iet tfsruaump;o4optoifctlt m rluvonu) leomf ootomt li i;s s2urio oo4aptn ivsas)srrmxmp;u0apxoioetyd sDrlump () lenir3ootfpte i o;()seuo(m3iy4omtn ict s) Dururp;u0tptomo3tyt a em( s t) ltnmf3iadfpt au s (  exr(m oy4lme livtl(  2taumpou0tptnmictyt sDuauvs t)tleoir io1om rlneo;s)teto(r no1am emnetlt)srtmxm nt1aet ifetlsfa emu p;t4artoif ia1faD lnvi;(0teumir ny4op  lnet sf Drr(mpnu0tptn o3iydlaDrlumo;u)aexrmf3oatfmteanvo t0 rto(o3oo4lle mivils) Dumumpoo1tpxnioctasls2ul( s;t4 etnxfcio1optrlnvs;( tetoimpoo1lme mnctat)sDua(mooo0tleniieiysfa2ulumo (0 rtrir tatfm e n s t0trxrio nydopeemfvt (  Draurpou4oex mo3iltlsDelump;t4aleomo3oydopt  uvo t0s2ur(mpiy4amt livtasfa2uau poo4alenii3iytlsDrmnmo;(4arxoxr3io1fpDr u o (0teuoxm oy1altemiesa()aDurumoot1alx mo3tad a2ra(vp;t4tlxrir3ia1oa  ai s ()teurio ou4lltnlfesls)srtrx ooo0teeoii3iadlaDrlu o t0tlxnxfcoadfmD livi;t) 2urxm3oy4apt mnetasf 2rmxr ou4olx  oeiad m2em(vsn(0 rtnxo oa1latrlu s;(  2tm(o oo4am elncsas) rtrxro;t0ape moetyt m2uau sn()trxrmf3iadfp  ai il( trumxm3ny4alenmfct ( arumur nt1tee  f3tas a2ra( o u)tleoio3oytfpDrli il( setrxo3nodll nmfvsls)arurxrp;o4tlt  fciydfm rm(vs;u4tetnmr3iotfmt an i;t)sexoxo iy4ol  mncsat)a2ua(mp;u1tlt  oeiyslm2ul(vp;u0arenif oo1lmt aies;s  rxoim oo1oleelnesas)sDtrumpou1oeen octadls2em(vp;(0alxrif iatfptrlueol(0 rxr(opio1opeemfcsa( srrau  ;o0teen fciadlm ul(vo (0altrxf3oydlatraieo t)setmxm3oo4am  lict sfs2truroot4tpeomfeildlmDrluvo ()trerio3ootfmtr ueol(0sexoxo ny1lp elncsls)a2ta(ro;u1oltnmietltfm ul( s (4aeeomr3tytlatrlnes (0trtmxmpny1aptemfetlt aDtaxr ou0opx ii3ils sDelu p;u0tlxnxf3tatlat  n o t texrxr io1omen fvtas)sDua( o;o1texomi3tad a umumsn(0aleoif todfptrlueslt seurim3iudal nmfei t) 2tr( o;o4oltnioeiytlsDrmuvs u4arxoifcoydlmte nvs;s  2xmimpoo4lme lies ()a2tmx o;u4opeo oeiadlsDrln s;(0 eermfctydfpDraivils s2toir ny1lptnmictls sDtm(mont1opt mo3iyt mDul(mp;u4texomf3iytfp rai o t t2toxr no4amtemncta()aDtaumo;u1tltomi3iatla umumo;(0alxnircoodfpD ai ilt0 euoio no1am nmfci s a2rm(m ot4opto o3tyslmDrlnvp (0teermocia1fmDrlieilt  2tr(m oodapt  nvia( aDtrumpno4opt ifciydfaDelu s t0 reomociadomte n o s sexoim oy1lmee ieia(farrmxmpnu4opxomo3ias mDel(mo;u)teeoxf3iatom e ueolt0sruoirpiudllen nvi t)a2urx o;t0oee mociasfaDuaumont) reoxf3iydfmt aieols0s2xoxo ny4ale  nvi ()sDrmx pnt0teto oetlt a el(mo;t)tlenmf io1omDraieslt  etrxopoo1omenmfctasfsDum(  nu1opeoii3iatfs ean o u4 lxrmo oytlm elues;s  eumxm oo1lmtemiviatf 2tr(roou0opxn ieiyt a ua(ms t4tetrmocoydfmtr ues t0s2xoir iu4lleemneilsfsDtm(  ;u4oee iictlsfmDemn onu0texrir oy1lm elieo;( s2tm(o3oy1lle livsa( srtm( oot4aexn feiysfs rlums;t0tltnio3tadomte uei t  etoim3nydoptelfet sf Dum( ono0apxnmieiydfmDea(von(4 ltnxociydlpt  uvo;s)s2xrio3iy4alte fci t) 2rr(  oo4tltoio3iysfmDuan on() rerxfctotfp   i olt) 2xr(opnu4apeelnet s)sDum(m ;t1opt  ieildfa2ranms;u)aeerio oydlmtranei t)sruoim3ou4aleemneilsfaDrmxm ;t0tpenmiciatfs2eanvont0alenio3iadfpteluei;s)srxoio oy1ale mnvias sDta(mono0aee  ociysfm2umu s ()areriociadfateanvolt0seur(r io4lle mnei (  Dtaumo;o0tleoiieildlm rlnmsnt4alxnif oy1opD li i;s s2xrir3nydamt lfcias) Drrurooo4aexnmieiatfa eanmp;u4tlenxr oo1om r nvs;t trxmio io1omte nviat) Drm(rpnt4alt ioetyd m em(msnt4 exnxfcty1fm rli s;( seur(o3iudamt  neiasfa2uaxmpno1tle mictlt aDea( o t)tetrxf totoatr ues s) 2to(r3oo1lpt  fcs s  2urump;u1tlxnmociyt aDum( s;u0teeoxo totlm ranvs s0srtrim oydlle mnetlsfs2urxr ;u1aeenmfctysls uluvo;(4texrirciodlpD anvo;(0srtrxrpoy4lp n neta(farrr(r ;u1oeeomociatls uln p t) renxfcoytfpD lneilt0s2xoirpiu4ol nlncsls a2ta(mpnt4opto f3iys m2ul(mo u) rtoxfcty1fmtrai s s srxmxm3no4op n ivtlsfsrtr(rpnu0tet miciyt sDul(vo t)trxoxr3oodla r i o t t2uoxo no4apeemfvsat) rrmx onu4apx moeiydlsDuan ont)trtoxr3oodlmtelueol( t2xrxm nu4alt  fciat aruaumpno0aexoii3ildfa2ul(mont4 leoio3tydom  ai s;t texmxrpio1ame mnvsa() Drm(rpnu4tpe  ociyt m rlu pnu4tltnxfctodoaD luvi ( trtrxmpio4ap e ieil()sDta(mo;t0tpe mi3iyt sDrmnvo ()altnmfciy1lmteluvolt0setoxrpnodlltnlnei (fsDum( onu1apxo i3ilslm2elumont)alxoifctydlp elnvslt srumxr oodll nmfes s srrr(mooo1apen fetydlm eln s;t4tltrxfctatlaD lnvsls)teuoxmpnodomtemfvsls artau o;o4oltoifeiadls2um( s u0 rxrmf tydfmD ln i t srum(r3oy1lp  mfcta()artmumo;u0opto ictyslm rauvo;u4arerir oatfm  auvi;s)t2trxrpiudapte neslt) rumxront4tlx mi3tadfm2ea( snt4 exrmfcoa1opD  i o t) etrxr3ny1om elfes (faDrm( ooo4tpto ociasfa rmnmo;(0altnmo oo1omD ln s;s sexrir io1lpe lnctls sDra(m ot4apeomf3iatfm rmumsnt0altoxo3tadlaDrlneols teuoir3iy4ll  mncsls arua( oot1olxoioetasfs rm(vp;(0trtrif3oatopteaueslt s2urxr io4lmt lnctls) 2rax  ou4alt  iciadls2el(mpnu)teerxo iytfa r u s s) 2xrirpiy1al elnvsasf 2uaumoot1tltomoeiys sDrlu s;t4 eenio3iotfpt  u o t0truo(rpno1om e nvi tfs2uaumoot0olxomo3tlsfsDrmnvsnu0artrxocoatfaDe ivo s0 2xm(r3iydame lnvi s)srua( oou4tex mfctadfs uau s u0aexnmo3tadlmtrlnvils t2xmio iu1alte feil( srum(rpnt4tleomfetadfm em(vs;(4 exoifcoo1omt auvil(0s2xoiopou4aptnlies t aDumxroou1optoiociyd mDrluvs (4 etnxo3io1fatrln ilt)trtrirpio1ll n ieia() ruax ono4tltn f3tldfa2ua(monu0 rxnir3tadoaDrluvs;s)sexrir iu1alt  fvs tfaDta(mp;t1tpe  o3iasls2uanms u)artnio3oy1oa  ln s (0srtr(o3iu4ll e ieils srrmu o;t1tet  fctytlaDum(vo (0altrxr io1fmte iei (0s2ur(o3ny4ole livi tf 2rm(  oo1apeomo3tat sDua( o;t)trtnxf3iydoa rauesl(0 eto(r3iu4op e iesat)aDrr(root1tle  fcild s2ea( o ()trxrxo3iytlpDeln s;t0 euo(r3no4lle lietlsfa2ra(rpoo4tpeniicias m2rau snt0artriocto1fptrln o t0 2xmio3ou4lme mietasfsrumxr ;u1texnifctys a umn pnu)tetrifciytomDr ues s) eumio3iodlp nlnes s)sDtm(m nu1texomfeias a2ua( on(0 rtrmo iy1fm eaivols seumxr iu4lle  fvtl( s2uax o;u1oexoiieiytlaDumnvs;t)aeenxfcoadop   ivils) 2xmxr3nu4ome mfvs s  2rmxrp;u0aptnmf3ilslm2em( o (4treomo3to1opt ln s;s tetriopio4aleemfviatf 2taumoou1apt  i3iltfmDemnms;u4tetriocoatopteaivi;(0t2xoxmpnu4amenmivta() rrmx pot0apto f3tyt aDul(vpnu)trtrmr3oy1fmDe ueol(0tetrxr3no4lp n fct s)s2rr(m oo0teenioetas s rauvpnt)tetoif tatom e uesl( setmio3oo4am emfvsas) 2rrx p;t4tpeomiciaslm raumpnt0alerxf3oa1lmDr neo;s) exoirpiu4omee ietltfarumxro;o1alt if3ildlsDrm(mp t) rermr iytfaDrlivol( t2xo(m3nudape  ies ( aDtmx p;o4oee  oetltfs rau ont0arerxfciodoatran s s0 2tm(r3iudaptn ictat) 2rrxmono0tlenmfeils mDemnvon(4 exnif3oy1lm  lnvi s) rtmimpnodlleemivsasfs2um( onu4openmo3iltla2emu o u0aexoxo3to1fatr u s (0seuoir3oy4lltelictat)a2tau  no4alxoifciaslaDraumo (0artnxfcto1lm eauvs;()trxoxopiudomeelfvs tf rrmxmp;t4oeeoiicild s2rmnmo t)artnio3todlaD auvils s2trim nu4lmenlnvt ( arrrur ;t4tptomoeiydla eluvpn(4 lerxo tadlpD  n i;t sexoxrpiu1apt  ivtlt) Drmx  ;u1optomictydlsDeauvpnt)tleriocoy1laDeluvi;t)t2xmio3nodamtelnvs s) rraxmo;u1tptn ieiyd a2em( p;t0 lxrxo3todopt anvo;s0t2ur(mpoodlmtnmfeilsfarrm(r nu1opx mfctys a2em(vo t)tltomrciytfatean il( tetoim iu1ap nmncs t a2rrump;o0oleomociadfa2rmnvont)trtnir3iy1lpteluvo;( trxo(r3nu4lpenlncsasfartrxronu4tet iictadlsDuau p u4tleomf totlm elu i t)tetmxr3oo1oltnlfcslt)srum(rpot0tpx  oeias m2ulumsnu)alenxo3ty1lptrliesls t2uoir iy1oltemfvslt)arrmx pno4aexoio3iaslsDemumonu4aeerif3tadlatranvi s0 2xoir oo4lptnlicsl()srur(monu0tetnif3ildls2em(mpnu)altrifciadom e ivo (0srumiopio1ll e fei s  Dumumo;t1tlxn ictysfsDranmsnu)trxomf ootfmDe neo (0 rxoirpou4omen nvtlsfsDraxro;o0alenmfcild m2rmu p t4aetrioctodop eaies;t0seto(r oudlp   fvtlt artm(  nu1texo f3iyd mDraumo;() lxnmf3oydfa raneil(0 2trirpnu4lptnmfvsat a2rm(mpoo4texn ieiytfa rauvsnu0 lxrmr3iytla  ai sls0trtoxr io1lmt livsltf 2tmxmoot4apeo i3ias s rl( pnt0 rtoxrcoytfm ran s ()srtm(m3nudamen icia() 2tax poo1apen oeildlm2rlnvs;(0altnxf iytlmDeli i;( seuoio3no4ope lfei t arum(mo;o0tpen oeildfa ua(mpn(0arxoxr iatfmt aivs ( setmimpio1alt lfvtas) 2rmurono0aptoiicias s ran o;u)arxoxoctotlmt livo;s  rxmir oo4olt mieilt srurxrono4tptniieils s2emu snu4 ltoir3iodlmt auvs;s0s2xmir3no1oltn ncsas)srrm(rp;t0aeeo iciytls2uluvsn(4 exrif3iytfmDeluesl(0 etoir3io4lm elivtls)srrr(ro;u4oet if3tydfs el( p (4areoircootfm e uvs;(  ruoxm3nu1olee nvs s)srtmu  ;o4oee mf3iadfs2eau sn(0alenmf3tydoaDe u o s0texmxmpoudlpee icsl()a2rax poo0opt ifciytlaDem(mo t0 lenmocoo1lmDranvolt t2urir3iy4om n feiat a2urxr ou0alt  i3iyd s2ulu o;(4tetomo3io1opD aies (0srtrir oy1apenlnet (f Durx p;u0opxniieils sDumnmpnu0arxrxr3oydlmtrau o;t)trxrio3iy4am  mfvil(faruaxro;u1tptnifeildfm rlums;()alenxo io1opt au s;s0tetr(o3oo1am e fctl(fsrra( ono0tle moctatlm2ea( pnt0 ltomo ty1lpt  n sls teumir iydomeelnctl()a2raxr oo0ape  ictlsfaDumn s ()artrmfctydlm   ivs;t0trtoxo3iu4ap  lfvsasf Drru pnu1oeto octadfaDranvp u0tleoxfcia1laD lu olt)seur(r3ou1lp  lies ( srtm(  ;t1oetoif3iasfaDemn o;()tetnio todlpDrluei t0srto(r ou4amtnlfetat sDrrur oo1opxoiociyt m2raumon(0artnif iy1op   nvs;s) rxr(m3io1olt mneiasf rum( p;t1aet iicild aDrauvo t)alxoifctatfaDeanvi;s0sexr(opou4lp  lnctl(fa2raxront0tpen fctas sDrmnmp;()altnmo3ty1fmDe i olt) etrir3oy4al n nvta()aDum(mp;t0tptnmf3iaslm2ran pnt) leoxo3iotoat aies s0 exo(o3iydomtnlfct (  ruaump;t0tpenmoctad a2ulu s t0 reriocia1lmt  ueo t0texr(o nu1op n nvsatfaDtm( pot0tpeomieiat a eln on(0trtomf oadla rlnei;s)t2um(o no1omtemfvi t)a2tr(m ;o4ale ii3iltlm el( s ()areomo tadop eanei s t2xoirpiudlm n fvilt sDrrumooo4aeen f3iys a2ul(mo (0tleoif3oadfaDrluvolt srxm(mpnu4ap e ivs t  2uaurpoo0aleomictas a2em(vo ()tlxrioctodfat lueo;s0 rtrio oudlm n fvt t)srumxm oo0apt mo3iltfm umn s t4aeerxoctatom r n o;() rtoirpou1lm emiciasfaDtmu pnt1alxnioetadla2uauvp u)trxrmrcoy1fm r ivsl(0 rxrxo3io1amte fvsl( sDrrum ou0teen ociad aDrlnms;t4aexrifciotoat ai ol(0texr(r oo1ale lict tfaDraxmpnt1tlxnmictas a2ra(ms;t4 rxoio oa1lmtelu s ( trtmim3no1amtn netl(fs2rm(mooo0tltniiciatlm ua(mo t4artrifciy1lmDe nes (0 rtm(o3ou1olt  ivil()artm( pot4oee  iciltfa eanvp;(4tlerio3ia1lmD au i ( trto(m3nu4llt livt tfsDrmu pnu4alto f3tad mDrlump t0trxomo totlateaivslt srxrxmpoo4lpeemictat aDtm(m ot1tlxnio3tadfsDea( s;u)aeeomfcoy1fmDrln slt)s2tr(rpiodll n nctls arua(m ;o4apeo f3iyslaDulu p (4 exoiocoy1fatraivi s  euoimpiodol  lieia()a2rr(m ;u1tltnmietadla2rln o;()alxnxo oydoa ranes s trxoio nudope  fesls) Dtmxr oo0aeeomoeiyt a rluvont4arxnmf tadoptr ieols) rxr(m oodal nmnetasfsDrmur ;u4apxnif3ildlm rmn s t) rtrircoydoa eln o ()trtoir nu4al   ivsas) 2tm(  ot1ope mfcilsfaDrmnvs u)tltrxf iotfp r uei s)seuoio oy1om emics sfa2ta(  nt4alxn oeiasfa rl( p (4tlxrmo3oatfmt lu olt)t2umxrpny4ol nlnvil(f rrr(  ou4apxo fctadlmDrmuvo u0 lxrmo3oydlm   ivo s)t2tmir3io1lmt lfctasf Dtaxr ;u1optomietltlmDemnmpn(0 rtomr oodlmt luvo;t srto(o3iodoptemiei (fa2rm(mo;u4tlen i3tysfa rl( sn(0aleomr3ty1lpte u ol(  2to(o3oy4ome livias)srtaum oo1aetomfeils sDrmn pnu4areoxf iodlatraieol(0trxrxmpoydll   ieil() 2ta(mo;t1aeen octatfa ua(vsnt4 etomfcta1lmtr u ils0srxo(m no4am elivi ()s2trx oou1teto o3tlsfm2rmnvsnt0trtnmr iotfp ean ols t2tmir3nudlm  mfei sfaDtaurpno0oleoiocilslsDrm(mo t4tlenmr3totla  ai i;( srurxo3io4llte icia(fsDrmxr ;u4tltniicias m2umuvo t4 exnif3oo1lp  luvi;t0 ruoxr3oo1ome  fei s)a2rrxmont4tltn ictydfm2ulnvs (0tetomr tytfpteaieol()trto(r3nydomee ici t srrm(  ot4tpxo fciasls2ua( sn(0 rtrxo3iodom  aueslt0 etmirpoy1ap n ivi s)srur(r nt0tle mociytfs eluvs;u)trxoxrciydopDe i i s0 2xm(rpoo1lp emnetl(f rrm(mo;t1teeomi3tydlm rl( o;t)aetomociadlmDelneslt seuoirpiy1lleelfcias s2rmur nu4tet ifetys sDua(mont4 ltomociatfmDeaueils)tetmir3nodal nlictat)s2tau p;o0oeeomoeiydfm2rmu o (0areoio oy1fpDeaivi t)t2xoxr oy1apeelncia() rta( pnu1opt ioeiys s2em(mont) etrifctydoa e u s;t)sexr(mpio4ameemivt t a2tau o;t0aeen ieildlmDea(vs () lerif oy1oaDran i () 2um(m io4omeelivi t) rum(mpnu4olxnmieiasla2elnmon(4teeoxrctotfa eai o (0s2trio3iu4al e feiat)s2taxmoot1apen ieiltfa2em(msnu)aetnir todla e uei s  2xoxo3iydap n fctat aDrm(m ;t1opt ifetltfmDrln s t4tlermfcio1omD lu i;t0truo(rpnydalt liet sf rtmum ;u1oet mo3tld s emu sn()alenxr3iadlp e uvo s0texoxr3oodol   ictas)sDum( ont1ope ifciadfa2rmumsn(4 etoiociatlateanvo;t0trxmirpnu1om n ncslt) Dtr(monu1oetomociasla2umnvs;t4alenio3tatlpDran s;t) eumir3iy1ol emnetas)aDrm(  ot4alt mf3ilslsDuanmsnu4 lxrxociydomDr u sl()trxrio3iodap nlivta(fsrtrx o;t4apto feiaslsDel(vo u)tlxoifcoodoaDrauesls0t2toxopoodllenlfciat aDrrxrpno4tex if3tldlaDumnms;(4 exrio ty1lmtelu o s  rxo(opiu4optelnetls  2urx  oo1alt miciasls2eanvs t) eermocoo1lpt  u i;s0 rurxmpiudll elies s)a2uaxmono0apxoif3tys s2ulnvo u) eenir ty1oat li il()teur(o3iudlltnmfvt t  2umu o;o0apxomoeiydla2rlnmo (4 reoir ia1lm e nes;( setrio3nu4aleemiesasf Dta(rono0ope  f3tldlm rm(ms;u0 rtnxr3iadlptr nvsls  eumxo io1alt liei s)s2umx poo1teenmi3tat aDemnmpnu) rtomfctadfaDeluvo;s)s2uoxmpoo4aleelieia( aDtaum ou0aptnifciydlmDua(vs;()tetoifcootlptraivilt0srur(rpnodalt mivtat) 2tru  no4aleniociadfa emn o;(0texrxo3tadfp  au slt seurio3ny4olt micsas  rrrx poo1alx  oetadfmDeauvs;u0 rxnxociy1laD aies;() 2trxm oydope  neil()a2rmxm ;t0oeenmociyt m umums;u)aexomf oa1lmt ln s;s  etrxr nodapenmnesas  rtmuronu4aetoii3ildfs eln p (0artomociotlate i s ()trxm(r3nu4ap e nes t)arua(mpnu0tex io3iad aDum( p u)tlxnxo tytlmDr uvo;(0trtm(m3io4omen fvia(  Draur ;o0ale  f3iys m2emuvsn(0 exnmo3iatoaDr nei t) ruoio3no1apee nei t)arurx  nt0olt  ictldla el(vp;t)aetnmfcoatlm rlu ils truoim nydlmtelies t  rrmumpoo1aex ifciyt s2ul(vs;u4alxoio iadlat lu olt0trxoir nodapeelieiatfs2um(ront4alxn i3iytls rm(vpnt) etoxr3iydop rlivol(  2toxo3iodlptemfcsat)arrmurpno1tltnmf3iydfmDum(vo;t0aetnmr totlm eliei t sexr(o iu4ol   ncsatf rrmum nt1ale mfciys a em(mo;()tetnir3tytla e iei;(0sexmirpno4am   nct (farrru pno4apt  fetltfa uan s t4tetnmfcoatfmDr ieo;t0seumxrpiydom  liciltf 2uauronu1oexo ociaslaDulu onu)texoir ootlpDrlnei;t)trtoim nudlm n ict t)a2tmu  nt0oltnmfeiatfa el( snt)aeenxrciatlpteaies;t0truo(o3nu1ap emfciat)s2rm(mooo1tpxoioeilt m2emnmo;t4arxnio iatomtr ivo ()tetoxo3ny1ome lnvi t aDrmurp;u4olt  oeiaslm rln s;u)tltoir oo1oa  lnes;(0sexr(m3nodoptemfes (farrru  no4aex moeias a em( o t0 etrif3to1fmte ivs;(0t2to(o nydomtn icia(  Dra(rp;t0apxoiiciyt m uau snu4 eeoxo oatfmDelivi t) rtrir iudoptnmfcsat)a2ur(roou4aleomi3taslm2rl(vp (0 rxomrcoodfaDrlnes t seto(rpoodol nmivi sf Dtrumonu0apeomo3tytla rmu o;u0arxrmrcio1fatrlivolt  2toim3oy1olen fcsl( artaumpnt1apeo i3iatls2ranvp t0artnif ta1oa rlu ol( srtmxr3nodam nmfeiatfa2rrxr ;o0tpx  i3tltlaDrmuvo;u0 ltoxfcoytopDeau i;() euoxm3nodolee ncsl(f rtm(roou0alxnmfeias a rlnvpnu0tlxnxrcoytfmtelies;s trtmxr3oo4lptelfct s)sDraxm ;u4tpxoio3ils aDulu pnt)trxoxr iytom elu olt0seuo(m3iydom   ics s sDrr(mpoo0aex  ocilslsDrlnmp () exomo3oa1fpt luvol( srtrirpoy4ale mfeil( a2tm(m oo0alx  o3tatfm2emnvp ()teenxo3to1opDeaueo;t)trumir3oy1lle  ics s)sDrm(  nt1ape mfciyd m2rmnmp;u0tltrmf3oatfmD an o;(  eurxm oodamt  fet t)sDtaumont4tpxnmociasfaDelumo;t4 etrio3totop rlies s) 2uo(m3oodlmeelics tfa2raum ;u4tltomi3tld aDra(mp t4texrmr oa1optr neslt0texo(o3oo1ome lfeiatfaDtrumoou4oetoifciad m ul(mpnu4alermr3ia1oaDr i olt srxoxm3iudlp  liciasfsruaxrp;t1tetomf3iatlmDulnvp (4arerio tytfa eluei (0texm(o3nodlmt mies tf Drmuro;t0optnioeiyd sDum( on(0 exnmrciytfpDrlnes;t0srtm(mpoy1alee ietas aDum(mpno4aptomf3iyt sDeln snt)alenmo3ty1opD luvils0trxm(r3iu1lmtnliei (  Dtmurpoo0tleo oeils s2uluvo;u)tlxnmr3tadlpDelnes t srurimpoy1oltnliciat)aDra(ro;o4texo o3tltla rlnmont4areoxo3ty1fat  uvi;s0truriopoodapt mfvsas artru  ou1aptomociyslsDrlumpn()aexomocia1om rauvils trto(o no1amtemivsl() 2rrxrpnt1altn i3iasfa umn s;u4tlenmf oytla eau s s) rtoimpiu1aptn nctat aruaxr nu4oltnmoctatla eau onu4trtrxr iodfptrluei;() rxmir ou4lpt mieiasf Drm(roou0tle  oeiytfmDemump;t)aeerio3iydfmtrli s s  etoir3nudol  lfvsatfartm(mo;o0oex iictydla ulumon(0 etoio3tytoaDr i o;t)seuoxr3iu1ole lfei tfa2urxrpou0tle  ieiyslmDumu p u0altoxf3iatopDraieo (  rxrxo3ny4amenlnctl(farta(m ou0teen oeiydfa2umnmon(4artoxr3iytfpDranvi t texo(opnodameemnvt sf rrrur oo4tptn i3iys s uanvon(0 rermo3oa1fmtr uvo (  2toxopoy1omtemfet ()sDtrxro;t0alxomociytfsDrlnvp;(0aetrio to1latrliesls)s2trxo3io4al n iei t)sDtr( pnu0opt ifetysla el(vonu4aetoio3io1lmtelu i s trtm(m iy1apen nctltfaDuax  no1opxomictld mDrlump u0aetomo3ootoateln ol(  rumxr3nodape  ivta()sDtmxm ;t0tlto f3tldla umump;t0 etomfcia1fateluvs s)trtoio io1amenmieils) 2uaxrooo0tptniictadfa2rmumo u0aeermo iatlatrlnvo s0srtmxrpoy4ll n nes t)srua(rpnu1aeeoioetaslm2umn pnt)aetnifcoodoat lneo;s0seuoxrpny1ll nmnetls  rrmurp;u1aex  o3iydla2uanmpn(0trxrxo3iatlpDeanei;t)srxrxm3ou1lpe lici s)a2ua(mono0tetnmoetltfa um(vs;()aexoif3oydfaDrlneils0 rtoir3ou1ol n ivtatfa2uau  ;t4tltomoeilsfa umn snt0tltomr oy1omDr nvo () ruoirpio4lle  ncsl(fa2umxm ;t4tpeomoeilsls ua( s;(4aexrio oadfmtrluvs;s trxrxopnu1ll nmici ()arrau p;t1alx if3tatlmDem(mp (4trtnif3todlptrlivslt trxr(o3oudaltemnvtlt)srrrum ot4tlxo ocildfm rlnmp (0 exrxr io1opt  nvs t)trumxr iodom   nesa(  2tr( ono0oeeo octlsls2umnvp;u0altnxrcoa1fmteanvs s)trxmxr ou1omte ncilt)a2tmu pou4oltnio3iydfs umn o;u0trenmfciadfaDe uvslt teurxmpoy4am  lictls arrax poo1aptnmfeiasfmDelnvs;t)artoxr oodomDelies t0 rum(r oy4lm elfeias)srtmur ;t4olenmiciysfs umums;(0trxoirctotfm eauvi;s srurio oy1apee nvsl()s2trum ou1tpxoifetydfa2el( ont)aleomf ta1laDrlu i;()srtoxm3ny4lptemivs sfs2urxrpoo0ole miciltlsDemuvp;t4arerxr3oytlmDeai ols  rtr(m3ny1lpee iesatfs2ua(  ot0tet mociadfa2eauvpnu) rtrxocoo1fatrluvslt) 2umxo3nydom elnvs ()arraur oo1tleoifeilslsDran s t4tetnif iadom  ai ol()tetmxr nydoltn nvi ( a2rau poo0altnmoetysfaDumumo;u)arenir tytoa rli ilt  etmxrpiy1lp nlncsl()sDtmxr ot0oexnifctytfm2uanms (0artomr3tydfaDrau sl(0s2xmiopiudapt licslt)a2urxrpnu0ope if3tydfsDeauvp (0 etrxr3iatop eai ilt) rxmim io1omeemiesl(faDumxm oo4aet moetld m ul( snu0 rtnioctadfm  lues s sexoir3oodop  mnesltfsDta(m ;t1alto icias a umnvpn() leoxf3tytfpD  ivo t0texrio3oo1lm emiciat)arua(rpou1tlxnmieiytfs2umnmpnt0 eermf iotomtranvsl(0 etrim io4olen fcilt)srtm(rpoo1apx iiciyslmDuanvo;u) etrir iatfmDran s;(  rtrxm3nudlp n nvsa()s2tr(mo;o0aee  f3iasls ra( s;t0 renmrcoytla  li slt  2uo(rpnudapt  ictat  rrrurpot1oeeomictatfa uanms () etnir3to1fmtr uei (0 2tr(m ou4lmtnmnvia()sDumx oou0apenifeilsfs2umnvo;u4 rtnxr3oo1lmte n o;t  ruoio3oo4om elncia() 2umxrp;t0ale  icilslmDrl(vpnu4aeenmr3todfmD lu ols0 2urimpoo4ameemnct s aDtaumo;u0apx  i3tld s rmn s (0 ltomo oydoa eaieols
\ No newline at end of file
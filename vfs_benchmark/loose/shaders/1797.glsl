@@ -0,0 +1 @@
+n i;t0 2umxr3no4omen ncsasfsDumumpou0tptnmicildfa ra( p;u)aleoxf iadla elivsls) 2umxm3oo1al   nci ()sDuru pnu1altnmfeiat m rm(vont)altnxfcto1fp rauvi t0teum(opnudalenmietl(fsrrmxroot4altnmf3iytlsDumuvsnt4 renifcoatoaDelnvi;s t2tmxr3ou1al n ics s  2rru pou1tlt  i3iasfm ea(mo t)aexnio oadoptraues;s)teumim nu4lpenmnciltfa2rrxronu1alxo icilslmDumumonu4aeeomr oy1oa  ai olt)t2xo(opoodol e nvtatfarururp;u4tltnmieiadla2rlnmon(4 rxomr3oodla eau i;(  etrxo io1opt  nvil(f Dur(mpno0olx mociyd s em(vs t4aetnxrcty1fp rlu s;(0trumxopio4alen ieils)aDur(rpoo1apxnmf3iat sDua(vs;u) ltnif3oytoat  ivsls0srxrir3nu4lmtnlivs ( a2tm(rp;u1aee ifeiatfa ua(ms;t4 lenmfctytlmt  u il() exm(r nu1lmt lncsltf Durur ot1tlxo oetyd sDul(msn() rxrxo3ty1optean i t)sexoxo3ny4llenlneslsf Dur(  ;u1aetn ieildfm ulnmp;t4tlenxf3iadlptr ueil(0t2xrxmpnydlpte ictl()artmu pno0apx mi3ildlm2eaumo;(4teerxo oy1omte i o (  2to(rpnu1llenmfcsl(f 2trxm nu0tlxnmiciydfaDra(mo t0trenxf tytlpD  nvolt t2ur(rpou4ap nlnct ( aDrmumpnt4apenifciltfa2rl(vs () exoxfctytomte ieo;t srxrxm3ou1ll e fcs tfs2tmur ;u0apxoiociat a2rlu s;u4 lenmo3iodopte ieo (0t2urim oydol e fvslt  Dumumo;t1aleomi3iad m eanvo u0alenif ty1lm  an o;t)t2tm(r3nodom elfctl(  rrr( o;u4tlt if3iydlaDua(mo;t0teenxocoy1lp e ivi t)t2tmio3oydlme lfvil() Dur( oot0apt ii3tyd mDul(vs t0 etnirctatfmt ln i (0seumxr3iu4alenlfesat s2um(rp;u0aeeoio3iytla2ulumpnt4 ltnxf3tydopDrauesls)trtoim3oodllee ncs sfsDrr( p;o0opeomi3iad m2rmuvpn()texnif3oadlaDr nei (0 euoxm3nu1om  lncsl(  2uaxm nu1oleomf3ildlsDrlumpnu4tlxrmrcta1la  livi;(0 2xr(o3oy4op   fvias) rrau  ;u4opto ieildfa2eanvs;t0aeerir tytlaDr ies;s0 2xmio3ny1ol elnvsa(  2rmumo;u0oet moeiysla2emnvs t0 lxnxfcoytla  ai o t teum(o3nu4ol e ici (  rra( p;u1oeeo o3iydfm2umuvsnu) lerxrctydomDr uesl()t2xmimpiydaptelfcsas  Dtr(moot0oeto i3iydla uan p;()trerir to1oaD  ivo ( tetr(m3nudlme lneiat)s2taxrpno4alx  fetat mDulnms;(0artomo oydomtrlnesl(0 rxmxo iodamenlnes t)sDrru oou1olt iieilslaDul(ms (0trtomo oydfa raueo (  rto(rpny4llen neiasfa2umx onu1tee  oetlslsDumu o u4texomfctytfatrau o t) etoxmpiodome  fcta() rrmx pou0oee mo3tltfsDra(mo u4altrmr oytlp rauvs t  2umxr oy1lltnlfvsl( srur(mo;o0tlxnmf3iasla2uan ont0artrir3tatom r uei s0 eurio oudol   ncs ()srurxrp;t1aptnmfctas a2ulumsnu)tetrio3oodoaD ai s s  rxoim3iy4lme  fetas) 2urumpnt1texn o3iltlm2um(ms;t)tlenxo3ia1opt livilt0t2ur(m3oudlleelnvtlt a2ur( pnu0aptoifeiatfm2ulnmo;t)altrxocto1fpt  ivs s)t2xoim no4ape  ics t aDtr(r ot0oeeoiictyd aDumu p t4trtnmr oytoaDr nvs;s0t2xoxr3io4amee fesl(  rumu  ou0tlt  fciadlaDrl(ms;(4trxoif oa1lmtelnvsl( srxoim3no4ome  nvs s)srurxmpnt1teeoiiciasfs2rm(msn(4alxrmo3iotomDe ies t)truo(o oydlleelfvta()sDum( ont4oexomoeiad m ean s t4teerxf3oydlaDeaneo;t0trur(r3oydomt lfes ()s2ururonu0oex iieildlm2rauvsnt4aeenmrciatlm  auvo;(0 2xr(rpoudap elfei t sDuaxmo;u0oeto fciadfa rauvsnt0arenxocto1oateln ils) 2xoxmpoy1llen icsatfsrrax oou4aex iiciatfm2ra(mpnu0 rtnxfcoatfmDran s;t0 exo(opoodop  mfei t) Dtmxmooo4tleoiieiys a emn s;u0teermo3oo1fpDeaivilt)trto(opiydoltelicsat)s2umx pnu0tltoifcilsfm2eau pnu0aexniocoodlpDeau s;( t2toiopiy4lm elfvia(fsrrrxm ;o4alx  oetyt a emumpnu4aeeomfciodoa   u s s0srtm(m no4om emfeils)a2trxm ot1tpeo ictydlsDrauvp (0alermr3oa1op ran s;t) exm(r oy4ap nmnet s sDtax ont4tetomietatfs em( s ()tlxrmo tadomt an slt  exoxm ny1ole  fctasf 2taumoou0tle mieiat s rlumo;t0trenio3oadlmte neo s s2ur(rpiodlmtelivi s srrr(rpnt0tle if3tyd mDrluvs u4altoir iytopt an o ()setrio iy1optnlicsl(fa2uax p;u0tlenmietld m2umnmsnu0texoxrcto1fpD lnvi;()s2um(mpny1apte netlt)arraump;o4oetoiieils m rl( on(4aeerio iy1fpDraivsls  rxoir3oydamte fci ( a2uaxmoou4tetn fcild mDeanvpn(0 ltrmfcio1lmDr ivo;t sexoiopiu1llt lictlt srtmxrp;u4aeen ietadlsDeanvsnu)aetnmoctydfatrlueo () rtrim no4am nmfctat) rrru  oo0oexnif3iytla2em( sn()trxrxf3iotfpDr ivi (0sruoirpno1am  mfei t)artru  ot1oeto o3tlsfs ranms u) rxnxfcootfaDelu o;t)seuoio iydllenlfvs s srrax  nu0opxn o3iysfs2um( ont) lxoif3totoaD lies;( trtrir3io1alen nvt t  rurxr no1apxnio3tyd s2ulnvo;t)aeeomf3ia1fm ranei t s2uo(m3oo1lp nmietas aDtmurpnu0aleo ieias aDeau p u0artnmfciy1fpt  ueo (0setrio nu4ol   fvsas  rum(  ot1tlxo ocilsfs rlu s;()aetnmr iatop raneols0seumim ny4optnmnesa()aDurumpnu1tet mociatfs2umu p;u4 rtnmfciodlp rli ol()s2trxrpno4ap  livi (  Dumx  oo0oltomicilsfsDeau s;(4 rxnxocoy1oa eln ilt  rtmio oy4altnliviltf Duaxm ;u1tlx  ieilslaDemums t4arxrxo io1oat anvols0srxoxm iy1lmt mietls arrmx oot1texomoetaslm2em(vs;(0trerif ia1fpt luvi;( texm(mpno1op e ict (  Draxroot0apxnii3tyd sDrlump u)areomfctydla   n sls  2uoirpiodoptnmivsl( srur(mo;t1apt iocils s2elumo;u0trenxf oy1oate ueo;s) rurirpiu4llee nct (f Dtr( o;t4oleoiiciasfa rlump;t0arerifciytomt auvol(0 rxrxm no1oleemnvtas)sDrauroot4oleo o3ils s rl(ms;u0 reoio tatfm  luesl()srto(mpnodaleelivs (fsDtr( o;o0tpe  iciyt a2rauvo;t)tltomf to1opteluesl( s2uoim3ny1ame mfvs s)a2tr(r oo4oetn ietyt m2rauvo (4trtrir3tydfpDrlu ilt) rurim3nudaltn iesat)sDua(r ot1texnmieiytfm rmu pn(0alerir3oadfmte ies ( teto(opiu4ole mics t sDuax o;t4tetoiieildla rmnvsn(0artrxociodlpD  ivol(0seumxr3iu1lle  ivtl() 2trum no4oex ifetysfaDrau pnu) ltomfcta1fp e nvol()srtmxm ou1lpt mnvtasfaruax  nu0oexnio3iytfa2eln on() etrmf3ty1fmD aivo s0s2xo(r3oodlpt lneia( a2tr(rpou4apx ii3iyt a2ul( o u0trerir ty1lmteauvo (  rtoxm oy1lmenlfcslsfs2rm( oou1tlt  i3tyslm eanvp (0arxnmf ia1fpt lnes;s) rxoim no1ope lfvtat srurxroot4oeenmfeildls2uaump u0arenxr totoateaieols0 2urio iu4amt mfei s a2tr(mo;u0aetnmoctls s emu ont)aexnmr3tytom rluvs t0texmxrpny4am e netasf Dtmx ont1oetoiieiatlm2ra(ms t)alxrif3iadomtr i sls t2xmio3iudalt  nctlt s2tmumoou4alxoifciasla2rmnvp;t4treoxr3iotla e u i s teumxr3iy1optemneilt)arrr(  ou4aexnif3tlsfa2rmuvs (4trxnmfcio1oate u o s0 eurim oy1lmtn ivsltfartaxrpot4apx io3iyt m2elumo;u)aeenio3tadfm e i ols)trtoio ou4llt  netlt)a2um(mpnt4oet io3iadfm2rau p;t4aetrxfcoodfmD ai o;t0seumir3iudolen ietat)s2ta(moot0tpt mfeiltla eluvp t0aeenircto1fatrluvo;s0sexoxm3oy4llenmnci (f rrmumoot1alxnmfctasfsDrmnmsnt)tleomo oo1opte u s;s0srtoim3iy1open ict sf rurxmpot0apt mietys a rln p;(0texnio oa1fmt  neil(0t2um(opiodamte fet s) rrax oou1olx  oeiasfs uanvp t4aexnmr io1oaDr i sl(0srxr(m nodapee ivtls  rtmurooo4oetomfctlt m rmn s;t0 eeniocto1opD lneolt trumio oo4ope  ncta()a2tm(r oo0tpenioeiltlm2elnms u0tltrxf oadomt lneils) 2tmxo3ou4opt lnctltfa2umxm ;u0tpt iictas s rauvp t) exnif3ta1fmDr nvi;t  eum(r3oo4ol n ncia()srum(r nu0aptn feiadfaDem(vs (0 lermo3totopDeanei;s0s2toim3oodamtemfvt t)sDrax pno4tptomoctydfa umn pn(4trermr iy1fpteli o;()t2tmio ou4am emnvi sf 2ra(  no4aptn iciadfa2eaumo t) eeoir tadlmDranei;s) 2toimpoudol  mnetlt  ruaumo;u0opxn octlt sDum(vpnt0tetoioctytlmDrlu sls0s2xoimpiu4ol emivias)a2um(  oo4oetoioctatfa uan on(0teerio totfpDr u s s  etr(o iy4op elncsat)sDraur ;t1tpeniieiytlaDea(vo;u0aeermo ta1op elnesls) rxoio3ou1ope mncs s) Dururo;o4oet ifetys a ul( pnt0trxnmfciydopteaies ( texr(o oudope  nvi tfs2tmxrono0ale mfciat sDua( o () ltnif tydlmDe u s t) etr(r3oodlmeemfvilsfa2rru o;o1tlxnif3ildfsDrmuvont) etnir iodoate uvi;() rtr(opny4oltelfet t s2rmu  no0oee ifctas m uau o t0 ltniocoo1fpt  ieols0trurxo iu1omt mfctlsfsrraxr ou4tleniicilt a2raump t0tetomr3iatoa ranei;s0sexo(m iu4olt mfesl(farrauro;t0openiieiytlsDum(ms;(0tltnmo oo1lpteliei t)trtrim oudol n icias sDumxronu1aptomi3iyslm2ranmonu)aexrxrciodlaDe uvo ( tetrim ny4lm  mfvs tf rtrxm ;o1oleomieiydlm2elu s;u)altnxfciatlptelnei ( srxo(mpno1ope lfvt t  2rmu pno4apxniieias s2rlu onu0altrio oo1fmDeanei;s)t2xrimpiy4omenlncsa( artmuroou4ale mfeias m uanvs t0trenmrctydfaDrlu slt)trurxm io1amenlnviatfarur(ro;u4ole iiciytfs uanmo;u0alxrio iodlp rlu i s)t2urim3iu1ap emivi tfaDurumoot4tpxomfetydfaDrm(vs u0treomociadlaDr nei () 2tm(m3iy1ope  fcsltfa2rrumonu4ape ioctatls2rln p;t4trtnir ia1fpt ln i;t t2ur(rpoodamt lfesls artmxm nt4alxn ieiatlsDulnmont0tetomo3oatfp  aivolt) rtoio3ou1alen nvils)arrr(r oo0tlto i3ildla2ean s t0teeoxr oydlatr ies s0 ruoio3oy4om  mfei sfarumx  nu4aeeoiietyt aDemnvpnt)artnif3ta1lp  lnvo;( trtrio nu1optnmfvsltfs2tau ooo0tet io3ilslm2elnvs u4 rxrxr iydopD lneils  2trir3nydlpte ivsls arumurp;t0aleoioctlslm uauvs u0trtomo to1fp  aivs t0sexmiopiodalt mnvtlt) rtmu oot0oeenmfctltfa2ua( o;u0 etoxf ootfpteaivi t0 rxoir iu1ope livilsfs2rrumo;o1aeenmoctyt a2uaump;u4texrifctydfm e uvolt)t2tmir nudamen neilt srrru ooo0oexnioeilsfsDrm( s;u) leoxrciydfa   u o;s0s2xrxo3io4al   iesl( sDtaurp;t4altnmociytlaDrlums t)aexomfcoodfmDeluesls  rxoio iu1op  lfcsl()aDuau  nu0opto o3iysfs2rmn p;()aetoxo iodom  an i;( teumimpno4lp emfetlt sDtmx ono4alt mociadlmDulnvp t4aetniocty1fa e uvslt)t2tm(mpnudap nlfvsat) ruaxm ou1tlto fcils m ean onu) lxoxf3oodfa eli slt trurxmpou1am   icsl(faDumxrooo0aetn o3tatfm2eauvp;t)tltnxo3oodfm e ivo t t2umimpnodoleemivtlt artmurp;t1ope  ieilsfs2elnvpnu0 exomo3ootom r nes s sexr(o3ny4amtnlneia()s2taur nu0alxnifctyslm elnvsnu)artnmfctodfp r n ols  etrxm iodlle mieil(  Dtrxrpot1oetn ociasfaDulnvont)artrio3ta1fa  auvi t0 2xoirpiodlmenlnviat)srum(r ot4apxnifeiydfmDul(vpnu0aexoif3oodfmte ivs;s tetrxmpnodaltelivta(fs2ur(mo;o4aetomoeildlsDrlnvp u0 rtomr oa1lmteaivo () exm(r3oy4am  lnei t  Dum( p;u4alxo ieilt m2uluvs;(0treomo tadlmt  u i ()setrxo3oo4ol   nctlt aDrmxmp;o1aeto i3ilt a uaums u4artrirctotlmDraneo ( s2toio oy1lle mictat) 2ur(m oo0teeomfciyd sDel(vo u0 lxoxrcoo1fpD ln o () exm(o3no1omtemneilt s2raum ;u0opxomi3tatls2ea(ms;t) ltnio tydlp raieo;t  rum(o iodlle mfvt t) rtrumpnu4oetnifeiydfmDuau pnt)trenio3oytfm rlnvo ()teurimpnu1omtelneslt) rrmur ;u1alxnmietysla2ea(ms;t) reoirciydfaD ln o;( teuo(opio1altn fcta( a2tau  nu0alenio3tysls2el(mont0alenif3oodom r ivil(0srxo(o ny4omtnmnvtatf rrmurono4tpx  feiytfaDuanvpnu4tltnmf ootla   u il( s2tm(r oodom n nesasf rtrur ;o0tpeomieiadlmDeau p (4tleoxo iytopDr n s ()sexmxm io1opeemici (f 2ur( ont4tee  ocild m uau snt)artrmo iytopte ueolt)t2xm(r iydll nmivsls) Duauroou1aee if3tysfs2uau p u4arxoir oo1opD liei;()trur(r nudlm e fes t)arrrum nu1ope  f3tlt a ulu o (4 ltnio tydlaDrluvol(0 2uoxopnudlltnlfeil(  rtrx ono0aex ifciadls ra(mp u4tetnif3ia1lm  ln o s)tetrxo3iudamenmncsasf 2trumooo0tlxn i3iytlmDua(vo (4 rtomo tytlmt  n o;( teurxm3oudlp  miet s arrm(  nt1oetnmfctaslaDeluvo;t)teermf3iatlpD lnes;t sexrxm nu4ll e fcilt sDtrxm no0oexnioeiasfmDrlnmsnt) eenxf3iatlate u i s t2tm(mpiudoleemivtls srtmumont1tlenmicilslsDrl(vp u4trtnxr3tydoptran o;( trxrxopny4lpenmfvtltfsDra(  ot1alxo oeiydlaDulnvsn(0 reoxf3to1lm rlivo;s0 rtm(mpiudll n iesat) 2ur(mo;o1texn fctys m rln pnt)arxnxociadom  li il(0 etr(o io4lm  lnvta(f Drm(m ot0opeo oeiaslm uanmp;u4texomr3oadomD au il(  2xrxr3nu4ol nlicsasfsrtax  nt0oexnifctatfm uanms () rermo3tadfp e ies;t  2toxmpnodaltnmiesasf Drrxmp;u0oexnmo3iytfs um(vs;t) rtnxrctatomD  ueo;t0 2xoirpnudlm n fetas aDtrurpoo0aeen i3ilt sDrm( s (0trtnifcoo1omD  nes () exrxmpnu4al nmfci (  Drau onu4tleoii3ildla2um( pn() rtrxr io1oaDrluei (  2trxo oo4lm  mnvsls)sDur(m ;o4oetoif3iadlm ulnmpnu4teenif3ty1fmDe u ils  euo(o3iy1apenmnctasfsrrm(ront0aleoio3ils a em(von(0tleniocoydlp   i o s srurxm3oodomtelnet t s2rrxrpou0oeeniieiat m elnvp (0trxnxr3todlatrau sls0texo(m3iu4amt  nvsa(f 2raumpno0alto i3iydlm2rmu p t4alerxrctodla elieo ()setmxo3ou1op nmncs sfs2umu ooo1aet ioctysfa2ea(vsnt0 etnmo iodla e uei s sruoim io1ap  mivi s)arum(r ;t4aetniiciytfs2um(ms (0 lxoxr3oodfa raivolt s2xmxrpiydllt lnetasf rtau ooo0aet iieild m2ulumpnu)alermfcoy1lmDran o;s  2tmio3ny4amt lnvsl(f 2rmxr ;o0oet moetlsla eanmp t0 eeomfcia1omD aieolt)trxm(mpoodol  lnetat)aDuax ono4aetoiiciat m2rlu p t0 leoircoy1opDelu i (0sruo(opoodol  mfeil()aruauro;t4olx  o3ilt m2ulu s u0trxomr3tadoa e nvsls  etrxr no4apeemfci s aDrm(  ot4tpt ioeiys aDrauvo;t0altoio iotlmtrlieo;s)s2uoxr3ny4apee ivia( arurxm oo0apeoiociasfs elu s;(0alerircootfatraivs;t) 2umxo io4ol elfvs t s2ur( o;t1opxoii3ilslaDean snt0 lerxr tydla e ivs;s0 euoxmpoudlm   feiatfsDtaumonu4olt mi3iyslaDrauvo;t)aexrxrcoa1omtr ues;(0s2xo(m iy1lm n ici tf Dtrxmo;u1aptnmo3iys m2rmnvp;u)artomocoa1la rauvil(0 rxrxr3io1olee ncsas)sDumurp;o4alto fetas sDum( s;()tetnmr oodfmtr ueils t2xo(opou4ap   ieias)sDrmxmpou1oetoiiciltfa em( p;u)trenmo3oatoate uvilt)srxo(r ou4am  lneils)a2tmxmpnt4apxnmoeiatfs2eanmp t4teenir iydomt  i i;s0srxmio3ny1lmee ieil() rta(  ;t4tptnmfctydls rlnvonu)tlerxr3tydom  li i;(  eur(opnu1llenlfvsa( s2ua(rp;t1openiociaslaDem(ms t4 leomf to1lpte nvi s) ruo(m nudol nmfcsas  Dtm(r ot1alx  i3tatfmDrm(mo () rxrmo3oatfa raueslt)t2xrxm oo1amt lncsa(  Dtmxrono0opt if3tlsfsDua(mpnu) lenmf3io1om  lneo s0 rurimpnu1llenmies sfs2ur(ro;o0olxo ietaslmDumnmpn(0teenmr ta1om  livs s)tetr(rpny1amenmnesas artru poo0aeenmoetasfa2emuvo;(4 eenxf tatfpD  ueo;t  rxoim iydom   ictls)aDumx  ;t0tle mociysla2emnmon() lxrmo iy1oa r nvi (0 ruriopoydol elfct (f rumurpno4olx ioeias a ul(mpnt0 exnmr3iatfm e ivil(0 exrim nodapt lietat sDuru  ;t1apt if3ild a ea(vo t4tlerir3ty1fatranei s0sruoio3ny4lmtemfes tfsrrr(m ou0aleoifeiytla2umnvsnt4arxoxr3tadlm ranes;t) euoxm oo4apt mfcsl(fsrrmu oou4tpt  ietad s umn o;(0 exnif oydomD auvs;s0trumio3oy1oltelfvt t a2rr(  ot0tlxnmo3iatlm ean snt)tlxnmrcta1lm  lnvils)texr(rpnydope lfei t  Dtaxmpot0olxomfeiysfm2ua(ms t) exnio oo1fmD ln ols)t2to(m iu4omt mfctlt)a2tmur ;u0aeeomi3iyslm eauvpnt0aeeomr3iytlat ai s s t2tm(m3oo4lme lfeia(f rrr(m nu4apxn fcilslsDrmu o u0areoxr tytop  anvo (  rxoxmpio4am   fvil( artaxr nt4opt mfeilt aDrl(vo;t4 reoio3iytlmD ln i (0seur(mpoodlmt  ivtl(  2raxmont1tet micildlm2umuvp;t)altnio3todlmte u o t0 2xoirpiy4am  mfct t)artmum nu4aeenio3iydfaDraums t4texnio ootfmte n i;( sexo(m iy1op nliei (fs2tmx pot4oeeomietatlm2emuvp (4artnxrctydla  auvo t)trxo(o io1op emfcsa(  2ur(moou1aee if3ilsfa2eaumon(4aexnxo3io1lmDrlueo (0t2xmirpny1omte iet (faDrm( ono0openifeiltfm2rlu s u) lerxocoo1fatrau s s) exoxmpiy1apte feia(f Dururp;o1tlx miciasfa2umnmp;(0 etoxfciytlmtranei t) 2tr(r iu1op emivt tfaDtmxmo;u1tetnmf3tltlaDemuvont4tlerio3iodfaDelnes ( srumir no1ll nlnvia(f ruau pou0apx if3iytfaDrlnvs;(4aeeoxoctydfmDe nvs;t  2tmiopou4omeelnci (f rraumpno1alxn o3tldlm2ua(vpn()texnio3oatfa  aneo;t)tetr(o oodale lfeslsfarumurpno4oleoioetyd sDra(vsnu) rtrif3oodlm raivols0 2xmir oo1lmtn feta() rurxmo;o0tlx if3iadfsDumn s;(4 reoxr3iydoa eanvols  eumxrpnodlle lnvtas)a2rm(rpoo0tle if3iyslmDelu o;t4aleomo3tydfa   neil() rxoxo iy4alt liet tfsrtaurpou4apt mf3tltla2ra(ms;t0teerxr3to1opDe u s s0s2xmxrpnudal e fesls  2ua(r ou1alxoii3tysfaDuluvs;t0arenio ootfa rli s;(0 2xmxmpno4amt lfesls)s2tr(moou1tet iieils m2emumo;u) etnxfciadop eauvo s0t2xr(opiy1ll nmicilt) Drm( pot0texoiiciasfs emnmo u4 exomocio1fmD  nei;t trxr(opiy1altn nvil(f rta(mpou1oee iiciat a rlnvsnu4aeerxf3oodfm  anvi;(0teurim3oo4am  mfvs t s2tr( pno1alenmfetlsls ra(vs;u0teenxo3iodlatrli i;()t2xo(r3iy4omenmics ( aDraum nt1tlto i3iyt sDel(mpnt4aetrmoctadomDelivi;t s2tr(mpiodalte netlsf Dtr(ront4teenmfeiytlm2eanvo u)trenmr3oadomt  i o;()trurxo nu1ll emfesl() 2rm( oot0tlt mfeilt m2el(mp;u)trtrifciydfa  ai ils) 2umir iu1lp n ict () Dtaxmo;u1altnmo3iatfm2el(vsnt) lxnmr oy1oaD an olt sexr(r iodop elfcslt) Drr(rpnt0optoiicilt a2uaumon(4 ltrxociodlmt  i i (0tetmxm iy1omeelncilsfartr(ro;o1apt  ieildlaDrauvp u4treoxf ty1opD luvo;( s2um(opiy4oltn nvtls  2raxm ou0aexo ieildla2emn s;u)aetnxo3oo1lmDrau i t)teur(r ny1om nlnes s) 2tmu  ;o0tlxo fciyslaDrm(vsnu4tltrxfcto1om elnes s0t2trxm3no1am n nctas aDrmx  no0olen f3iad m2em( p;u)treoxo3oatlpDr i olt  etoir3oy1ameemicil(farra(  nt1aeeomoetltfa raump;()aeeoio3ty1laD  ivolt trxoimpnydope mnctl( aDrrurpnt0aee  ieilsfm2ulu p;u)alermrcoytop   uvs;s s2triopoo4lp  lics tf rra(m ou4aeenmictls s emums u) lxrxr ootlmD  ivilt0trtmirpio4lmee neilt srrmxm ot1aetoio3iytfa2rlumpnt) rtomo tatopteaues t0s2trimpiu4ome  icsl()sDtaurp;t1altnmfcildlaDrm( o ()alxnircoatfpDeln sl(0t2toimpny1lp e nvia() Dtm( p;u0tpto icildla eaums u)tltrio iy1lmt  nvs ( trtoim3iu1om e netl() rumxm ;o4aeeoifeiyt m eanms t0trtrio tadop rluvslt teto(m3ou1op n fci s sDrrumpou4alx  octadla2ea(msn() rxomo3oodlaDrlieilt)trtrxmpoo1lp elfctlt)arta(r ot0oexnmoeiyt mDumnms ()tleomo3iydfa elu ilt)teumxm3nodap  mies sfs2ra(  ;t4opt  o3iadfm2elnvo;(4alenxr oo1faD  nes t) rxm(m nu1op nmnvilt aDrr(  no4optn ieiatlm raumpnt0 renmr3io1lmt aiesls0setmxmpny4oltnlnet t  2tauroou1olt iociysfs eluvo;(0altnmo3iy1oaDeli o t)t2urim3oydopt licsat) rrruronu0opx ii3tyslm2em(ms t4 exomrcoodlm r ues t srxmiopny4op nlncsls) 2rrxroot4oee moeiysla rl( o t)alxrmr3to1faDeanes;( srurxr3oo1ap nlnet t) 2umu  nt1apto f3iat a ranvo;u4arermf ta1oaDeli s;s) 2xmxopiu4lmtnlfciatfsDraumont1alto ieiyd s ea(vp (4 lxomfcta1lpDrauei () exmirpiu4op nlfcsa(f Dtrx  oo0ale mociydfs ranvo t4 exrxf oa1fp r u o ()texmxm nodlpe mnvtatfarua(rpno0teeomictyd m2em( s () ltnxr oy1opDeluesls0srurxm3ou1lltn fvtls)aDtmxr ou0tptnio3ilsfmDeanvpnu)trtnif3ty1la   nesl(  etr(opoo1op   ncs tfa2uau p;o0alxoifeild a2ul( p;u)treomo todlaDr u sls  2xoxo oo1llt mivsa( s2taxro;u1oex  icilsla2rlu p t0aeenxr3oo1lmDe ueo;() 2urim3no4lmeemnctl(  Dumx  nu0tpx mieilslm2em(mo t4 eerif3tytop r nvslt)teum(r3ny4amt mivia( sDrmuronu1oleniociatlmDel(mont)alxomo tydlmtraivsls) 2trirpio4lp nlnctls)aDur(m nt0ape  o3tyt m ra(von(0trtnxf3ta1lmDraues;t  ruoxo iy1ol  mfcs t)aDurur ;o1alx mictadla2um(ms u)aexrmf iadlat  uvs s0s2toiopnydll e neilt) rum(rpnt4oee iiciadfa2rlumo;t)artoxfcto1omD lu ils)s2to(r3oo1lpenmfvt t) rtm(r oo1tlt  o3iyd m emnvp;(4trxoio tadlp  auesl() exmir3oo4lmt liviasfsDrmxm ;u1tpe micildfsDeanvsnt)tlxrxr iodfptr ivo;s)t2xrxrpiodolen nvsas s2tmumpno0tpeo fciys a eaump u) exnxr oa1fmDe ivi;s)sexrim oodlptnlnviat) 2uaur ;t1opt iociydfsDulnmonu4alerxocty1opt anes ( t2uo(mpny4ol   ivt ( srtrxmo;u1oeto oetaslm2eln s;u0 rtomfcoa1lpDrau i;s srtoio io4lptnmfvtat  rrm(m ;u1oltoifciltfa2uan ont4 etrif ootlaD  ivils0t2tr(mpou4llen nvsa()srtaxmo;o1alenmi3iytfsDel(vp;t)alxrxo ootopD lues s0t2urxm3iu1lpenlfct ()a2raump;u0olxnmoeiyd s2em(monu)arxnifciadoa  au ils0 2xo(rpoodom elfcs t artaxr nu1ole iiciyslm2rl(vont)teerir3oydom elivo;s0seurxo3nydlpee icilt arrmxrp;o4alt  oetadfsDrlnmpn(4 lerxf oadlatraivs s0s2ur(opiudope lics ()srtrxmo;u1ope  i3iltfs2emums;()tltomo3totla eai o t sexm(o3nydome mieilt)aDrax ono0tlt  ietadfa2el(monu0tlxoir iadom ranvi;( t2umimpno4amtnmfcsl(faDuaur ou0teeniictldlm2umums u) etoxr3oo1lmtr u s;s0srtoxr oudapt mivslt)a2umx  nu0aetnifctlt m2umn pnt4trtnxoctadlmtr n o s)teuoiopoydoleelnetas)s2tau  ;o4apx mo3tat m umums;(4 ltrmr oydlmDraiesls texoxmpoodam elicias sDrm(mp;t4alxo icils aDrm(mon(0altrxo oa1oat ai ils0s2xoxm3nodll elnesat a2rrxmpou1tet moeiydls emumo t0trxrifctadlaDraies;s)s2urirpoodapt mivi ()a2tm(mo;t1olenmf3iasls2el( o;t4 lenmr3tatlp elu o t0 etoio3io4amtemncsls  Duaumpnt0tex mfeiatfmDrlu p u4 reoxr3io1latrlnesls0t2ur(o3iu4alte ietltf Dum(monu4tptomi3tas m2eln s;u)aetrmocoa1laDran o s0srtm(o oodap nlfcia(f Dumurp;u4oleomfetltfs elu s;(0 etrxocia1fa elu i;(0srumimpoo1al   nvi (fsDtm(m ;u0aptnmfctytlm ua(vs t4aeenxo3iy1la eau s ( t2toim ny4open nct ( sDtaur ou0altomf3iydlsDemnmsnu0alermociotfaDr u sl(0s2um(opiydap  lncil()artrum ;t0olx ioetysls2uanvs;t4 exnxf3totop   ieo;t0trurim3no4lpt liei ( srtrurooo1tlen ictysfa umnvs;()altrxo3tatfaD ln ol( s2uoirpno4lptelnvsasfarrauront1aptoifciadfmDrm( ont0artrmoctatfateai i;(  rtrxo3io4lp n ncsat)sDuau oou0apenifciadfsDean s;()artnir oa1oaDrau o;( t2uoir3oydom emivtls sDua( o;o0oltn oeiydlsDulnvs;t) reomf tytfpDr uvils s2xmiopoy1am elnvsas  Drmu  ;o4aeenmiciydlm um(ms;t0aexrxf3oo1faDelnvil( seuo(opoodopeelnetl( sDuaur ;o0opt mictyt s2ea( p;(4 renmrciytlm r uei s0srxmir3iu4op nmncsatfs2trx ont1ale mo3tadlmDrluvp;u4 exrxr ia1fptran ilt  etr(opio1ol nmictasfsrta(ro;o0opxnifeiltfm raums;u4 rxrxf io1fm  ai sl(0teurirpiydam   nctl()s2uaxmpno1apto feiadfaDrmnmp u4texrmf oa1fmtraivils truoir3oy1lm nmnvsa(  Drmur ;o1tpt  fciydlmDeau p u)tltoxr iy1fpte ueolt)truoim oy4op elncilt)a2taxmpnt4aet io3iys a2ra(vpnu0arxnmo oydlpDeanvi s) rtmxo3ou1lm elnct ( s2ua(r no4olto ociytfm2elu s t0 leoxo iy1fatraieo;(  2um(mpoo1ome lfcsl(  rtm( poo0opt ifcilt a ulu s;t4texrmocio1fa elues;s0sexrir3oy4llen ieils)sDraxr nu4oleo i3iltlaDem( o u0arermfctydfm   neolt) rtrxr nudlptelncs (fs2rm(root4oltniociysfm umnmsnt)tlxnxfcootlmDelneslt)sexo(mpio4ll  mfctl(fs2raxr no1tlxnmi3tasla2uaums;(4aetomr3to1om r nvi () 2tmxo iy4lm  liesat  Dua(rp;u1opx  icildls2rmn o t4aetoxo3iytlmteli o;s sexmxm3ny1alenmneta()aruaxmp;t4alto octytfaDrl(ms t4tlenmr ta1opt  ueo;(0seuoir iu1ole lici t aDtmx  ot0olx mictyslsDul(ms;u4 rxrxr3tytomD  uvo;t) 2umxrpoo4ll e ncslt s2tr(mpno4oex iieils m ea(vp (0aleomfciydop eai slt)s2toimpno4olen fvtatfs2rm(moou1tlxnifeiadla2ea( s ()trxnio oa1fmteai i ()seumxm3nydal n ivsltfsrururpou1olt  o3tysfs um(ms;()alxoxf3oa1lp eauei s)srtmir oudlmtemnvia(faDtrurpot0tleniieilslaDumnms;(4arxrxfciotoaDrau i s0 rtoiopny4opee fvil( sruaxm ;o1tleoiieilslm rmnvsnt)tltnio iodoatrlivil(0srtmio3ny1lptnmncilt  Durxmo;o1tex moeiasls2rmnvsnt0 leoif oadfmD livslt srxrxo iu4amte icils)s2rrxrooo1apt mfctytls2em(mo t4tltoxfciotlaDeliei;t)s2toxo nudll n fvsat  Dtmx  oo0tetoifeiytlsDrm( p;t) exrxfctotfm rlu slt) rxmxr iy1lpt  icilsfs2uru pou0apxomoeiat aDumu o;u)trtrxr3oytomt li o s seurim oo1lpenlnvil(fs2uax ono4alxoifeiat sDelnmsn()texrxoctodlmDrlnvo;s srtrxrpoudlm  mnei (fsruaxmp;o4optnmi3ildfs2rau s;(4alxnxr iydfaDrlieo (0 2tmxm3nu1aptnlnvia(farua(roou1tlxo iciysla emu s t4aeenmo iadlate uvo s teto(mpou1lpeelieils  2umxm ou4alxo o3ild a rmumpnt4 rxoio oodoptrlu ils0srxrxopiodamen fesas  2tr(r ;t0apx ifciad s el( o t0altnmf tadopDr n slt)trum(m3nydol n ivi s)aDtmumo;o0tlx  oeiyd aDeanmp u)alxnir3iadfpt li i t)srtrxrpiu4apee fesat a2rau  no1tpx mi3iaslm2rl(vs;t) etrmrciadlm  livilt seto(r io4ope mnetlt) rumxmono1opxo fciyd m2elnvs u0teerif oy1la   ieolt)seurxmpny4ale micsa()sDrru  ;o0tpxo o3tysls el(mpnu0 ltrmoctotfmt lu ols0s2tm(mpoy1lptn fvsat artrx  nu4tlt ii3iyd a ranmp;(0aeerxf3oa1lptrlnvslt0 2xo(o3ou1ame  netls arurumooo4aetnif3iys a rm( o;()aeeoiocoytfmt lneil(0teurimpiodlp elfviat  rrrx p;o1olxoiieias a2em( on()arenircootopte nvsls0seuo(r3oy1amt mfcil(  rtaxmpou0alx if3iysls em(mon()trenio3ia1omD anvo;s) rur(m oudameelfesls)s2urx ono1alxoifeiydla ra(vo;t0tlenmf3iytlpt lnvi s)setmxm3ou1opt  fvsas)sDtru  oo0texnmieiad mDrl(mp (4 rxnmociodoa e nvo;t) exr(o3iydoleelfct t sruru  oo0tpx mi3ias s2elnvsnu4aetnio iydlpteanei;s0t2xr(o3iu4omenmnvtlsfa2trxm ot1ale mocild a elu s u)trxrmr3oa1opD aueol( srurio iy1om emnvtas  Drmx  nt4tle mf3ild mDemuvsnu)alxoif iodomD lnvs s)setrio3oo1llt livi ( a2tr( p;u0tlt mi3tasla umuvpnt4 renmocoatfptr ivo;( trxo(mpiydamtemncsas)sDrrxmp;t4openmoeiadls2umums u4aeerifciodomDrlueols)truoimpou4alenmietl( s2truront0oleomi3ild aDuauvpn(0tetoxr3totoa eanvil(0srxrimpno1olt livsltf Dtrur ;u0olx ioctatlm2eanms;u0 rtnmfciydoa rlu o s)seum(r3iydamee fctas)s2uaxront0alx  octat aDulnvp t0aexnxo ia1omt au s s) 2tmxopio1am e fetat  Dta(  ;u4olxomi3tadfsDra( s;()tltomf3oy1lpD aueo (0 2toir no4lme  iciat)arrax pot1alenioctys aDran o ()alxnmf iy1la e uesl(0teur(r3iy4lm e fesltfaDtm( o;t4aet  o3iasls umnvsnu4tlenir3tadfp r ues s  2uo(r3ou4alt mneta(fsrtaxmono1oee iietls s2um(msn()aetoio3to1oaDe uvsl()teumxo3ou1ole  fci () Drmu poo4teto i3iltfs2rlu p;u0aeermocoytop eln sls sexrxrpio1op  mfviasfs2umxr nu4apenmociltlsDel(msn(4 eerif oy1omtr ivo;()tetoir3ny4opeelnvtl( aDumu ono1tpto fcilt mDranvpnu4 lxrmr tatfp eluvi;t seurxm nudomenmfeil(f rurumo;t0aptnii3iytfa rlnvpn()artrmr3oodla  aies;(0trurxr no4amtnlicias a2rrxmo;t0alto ieils mDrlnvs ()tlxrircoytlmtr nei t0 etmir oy1amen ivia(f rrm( o;t0olenmietadfaDelums u)trxoxfcoo1opt aivi;(0 2toir3iydapt miet ()sruaurp;u1opx  ictyslaDrl(vsn(0 lxnmrcoytlp r ies s0 etoxopoy1lleelictas sDrrur ot4ale mfeils sDumnmo (0altomrciadoa  aneo;( tetoio io1lmeelfcsasf ruauro;u1opx mo3tas a uan pnt0tlxoif3iydlpt  n s;t  2tr(r oudlme mnct sfsDrmx  nt0olxnif3iytls emuvs;t4trxnmr3iydopDran o;(  2ur(r oydap e fei s)aDtr(ro;u4oeenmociydfs ra(vp;u)alxrmrciytfp r ueo;s0 eur(r3oodopt  nes t s2um( p;o0tlxnmociadfm uluvp t)tlxoir ta1lmte neolt0trurir3nu1olt lnciasfsrum(  nt0aptomi3tas s rmu p u4aeerio oydopDrlivi (  2tr(o3ny1ap  micsltfaDrm(  ;t0tpt mfeild a eanms;t)artnifctydfmD aiei ( teurim3iydlm   feta(fsrur(mpoo4aeenio3iys a2rlumpnu0aetoxr3ta1lptrlieo ()t2xoir oo1am n fei s) 2tmur ;t4olt moetadla emnvsnu)tetoircoodlpt ln o;(0texoxmpnu4lle  fvilt) Dtr(mpot1ale mociatla ul( p t4aeenxfcoo1lm elieo t srumiopiu4ol nmnetl()sDrrxm ;o4oltoifeiysfm2el(mo;t) reoxo3iydfm rluvil()t2xmxo iy1lmen nvi (f 2rm(mono0aetnmiciasfmDemnms u4areoio ia1omD  iei;(0seur(o iy4ll e fcilt s2tmu oot0tlen oetltfs ean o u0alenif3io1laD  ues t) rtmio oy1oleelivi t a2tau poo1aeto fetldfsDemuvsn(4trtnmf ia1lp r ivils)trxo(m oo1ol n ietls) rtmxr ;o0olx mi3ildlsDul(mo (4aexrircoy1lmt  i il(  2tmxr oy1ap  mivsl(fs2taxmp;o1optnmiciadlm2ulnvo;t4 lxoxr to1fmDeanvs t)texo(opno1al  mfvsat aDrru  ou0aeenmieiltfs emu o t0aeerxr ia1oat anvs ( teto(m3io1al e ncs t a2rm(rpot0tpe moetadfaDulnvp (0tlenmo3oytoatr i i;t)t2xrimpiu1al n ivi t)s2uax onu1texo feilsla2ul( o ()trtriocoy1opD livo ()trxmxrpny4op  lfesat) rtru ont0oee  fctlsfa2ea(monu) rerifctatfm rlnes;t)s2xrir nodam  mfes t a2tr(  nt0tlt mfeiasfsDeauvonu4 rxnxo oa1fmtraieo t0t2xoxmpnodllen fviatfarraxr nu0olenifetldlm rl( s;t)artrmfciydfp e ueolt0s2xmxr iodlltemieia()s2ra(  ;t0apx  ieias m2rlumo;u0 eeoxf tytlmte ivi (0 2trxopio1omtnmfvtasfsrumx  nu0oeeo fciydfa2ua(vpnu0texnmociotom ran i s0t2xo(m3iudop elivt ()a2rax pno4aee  ieias aDel( p u)artnxf3iy1lp raueilt  2tm(o iu1lp elfciltfs2raum ot1aetn iciys m rluvon(0arxrxf3ootlp   uvilt0srxrirpoy1opt  nvta()arrrum ot1oexomf3iys s eluvs;t0tlxoif3ootoaD  n o ( srxrxrpny1omtnlncs t)arrmur ;o1oet ifetadfaDum(mo;t)texoxr oa1laDeaieo;s t2toim no4lmtemfeslt)srraxronu4opx if3tldfs ulu o;t0tetrifciydop eaieo s0trtr(o3iodlpenlnetls)sruaxr ;o1tet moeiatlmDul(vpn(4 lxoif todoaDranvi () 2xoxo nu1llenmivtlsfs2trxrpnu1texn ictyslaDrluvonu4areomo ootopDeli i t)setmxr io4ll nmfctat) 2urx  oo4alxoifeiad a ua(mo u4 lerio oydlmteanvsl( srtoim3ny4lmee neias)s2taxroot1aleo o3ilsla rl(vo ()tlenmocoytoatrlivi s0t2um(m3io4ale  ncsat  2trumpnu0alt miciytla2uanms (4trtnmr oa1oat lueo s)t2tm(o iy4ap elicilt  rrrum ;t0olxo i3ias aDrmnmsn(4aetoir tytfm  aieo;s srum(opoy1lmenlnciat)srtruro;o4openio3iasla2rl(ms;()texoxr to1fpDraueo;s  2urio no4lmtelivsa()srtmx ooo4tpxn i3iltfsDua(monu0arerxfcoydlpD  nvi;(0t2xrxopnydalt mivils  rrm(mpnt4aeeomfcilt m eanms;t)tltrir tytoa  aneo ()tetoxm3io1lp e feias a2raxmo;u0aptoifetldlm2eln p;()arerxr totopDelies;t  ruoiopoodlmtn nvslt  Dtax  ot1tlx iociad s em(mo;t)aeenxrcta1fpDran i;t0texm(o iy1ap nlfct ( a2uaxmo;u1opx  o3tatfaDrmu p;(4aeerxocoadop r i s ()trtm(m iy4oltnlivi sf 2tm(m ;o4open oetytlsDuluvsnt)trtrmf oadlmD lueslt0srxrxopno4op nmnvta( a2ur(m ot4opxomociyt s elu snu4 exomo3ta1optrliesls) 2trxr oudamtelfvsas)arur( p;u1oexo o3iydfm2eluvs (4tlxrmf io1fpt aieo;t0srurxopnydape mivsat)a2uaum ot1alx  ictytfaDrlumsn(0 lxomr3iotfa eau o;( tetmim3oy1ape  nvtls) rrmxm ;u4apxomo3tltfaDrl(mo t0 etnifcty1fm r ies s0s2xm(mpiydllee iesatfartaumpoo4aetnmfetytfsDum(vp;t4alxrmo to1fa rlies (0t2tmxm3oy4lme  iviltfarrm(roou1tlt mfeils mDeanmo;t0tetnxociy1fpteluvo s seurir3io1op emfvt t) 2rmu pnt4tlxn ocilsfs2ulnvp (4 etoifctadfatelues s0t2tmxr3iudape lncilt)aDra(mp;t1altoio3iysls rm( pn() etrio3tatoatr uvsls s2uo(r3oo1amee nctatfsDtr(rp;u0altoifcilsfs em(vsn()trtomr3tadopt luvs;s trtm(r3iy4op nlfct s aDuaur ou0ale  f3tydls ul(mp t0aexrmf tydlp   u s;s  2uo(o3no1lp nlfeta( s2tmur oo0tex  ieiltfsDelu sn(0 exnifctydfp  anvs;(0trxm(o ou4al n fcils s2tr( ooo0oeen f3tlt a elnms ()trtoxo ta1lptr neo;t0 rur(o oo1altemncia()arrmx o;o1olxnmociytlm2rm(ms;t)aetrxr io1lptelu o;s0s2xmir3oodom nmivtat srtaurooo1alt mf3iyt sDuauvpn() etrxo3ia1lpt auvs;s) 2tm(m nu4oltnmivias)s2umu  nt1apx io3iasls ranvs u4artomfcoatom eli s;()srurimpny1ole  fcia(  rtrum ;t4tpen iciysfa um( s;t0trxoxr3tatom rlneilt0 2xoxr3iydlp   ncias a2ra(r ot1olxoiocilslm ul(ms;(4altriocootfaDeaivo;()s2xoir ny4lm   netltfaDra(m nt4aleoifetldfa ul( s ()texnmo3iydlptelies s)srto(opiy1al emnvils srururoot1tpeo i3tadla raumpnt)artomr3iodlmte nes;s trumim nudame  nvtas) Dua(ronu1tee  ieiaslmDrmums u4trxoiocia1fpDranvo t)srumim3nu4ol e fvslsfaDrau  ;o0oee mf3iatlm2emu p ()aexnir3oytfmtr n i ()srtrimpiodaltemieilt a2umumpot1aeeomfctlt s2umn s u0 reoir iadfatelieslt0trxriopou4alenmfcia( a2urum ot0aex moeiltlsDrmuvp t) lxnmo3to1lm   nei t srumxm iodopt lics t)a2ra(  ;o4alx moctatlaDea(msnu4tlxnxf ia1fmte uvo;( s2uoir oo1altemncsl( artax p;u4ope  o3tytfm umuvo;u4 lxomf3io1lpDr u ilt)t2trxrpoy1ol n iciasfs2rrxm ot1texomi3iytls ul(mpn(0alxoio3ty1fateli ols0 etmxm ou4openlnvslsfa2umxmp;u0tle miciatla rm(vont4tltoxr3oy1oaDeauvi;s trtm(opnu4lm   nei s)aDumx oot0apto i3tydfa emuvp u) exomrcio1laDeauvils s2trxo oy1op elivsl(f Dua(  ot0tpenio3iltfm emnvpnu0artoxfciydlp raueilt) etoxo3ny1ap e fesas srumurp;t1oexnmocildla ranmo (4tetnmf3oa1fa eaueslt)seuriopno1lltnmfeslsfartru  ;o4aptnmiciyd mDulnvsnu)alxnxfciotfat  uvils) rumxr nu4apenmnesat  ruaumoot4alxn o3ias m uau p (0 lxnxfctytfaD luvi s)seurxm no4olt micsa(  Durumpno4alxo ieilsfs2uluvs;(0aleoir3iotla rlies;() euoxo3ou4op  lnci sf 2tr(mpou4oeeoif3iytlaDra(vp;u0tlxoxr iotoaDranvi;t0truo(rpiydomtemies t  Dumx  nt0oeto o3ildls2ra(mon(0alxoxf3oadfmt  n s s sexr(o3iy1lmenmictas) 2urumpno1oleoiietadla eau s;t0aetoxoctodomD  ivols)texoxr3iy4al   nvtat sDrrxr nt1olen fciydfm rmuvp;t0 ltrxr oo1la ranvs () exr(o iy4ole  nvsltfsDrrxmono4oltomf3tasls rlnvs;t)teeomf3iatlpt  nvs s s2xo(opiu1ame lnvi t) 2rr(r nu0aet mociyt m2rmnvpn()tltnif3oydfa  lueolt) eto(opiu1op e ncsl( srurxrono1tee mfeiatlm2umumpnu0 lxrio3oodlpD auvil( texo(o3iy1al   fetls  2umx pou4aetnmfeiysla uan p;(0tlxrxo iy1fateaivo ()teumir oydoptnmnvt t srum(rpnu0alto icildfmDuau o;t) lxoio totfpDeaneo t0 rtmxmpoo4ameelivslt a2rr(m oo1tetnmf3tydfm2elumon()aetnxr oodoat anvo;t teto(r3nydol e fctl(f rrmx p;t1olt  ociyt s emnmpnu0 etrirciy1lpte u o;t0trtm(r nu4om  lfeil(  rta(m ot0tpxn ictas m rl( pnu4 exoio3oadlmt aiei s0 2uoir3iu4lpen nei t) rua( pnu0tleomfetldfaDrmump (0aeenxo3ta1oatelnvi ()trtmiopio1omee netl(farurxmont1tltomoetat m2umu snt4aleoio3oo1la  an i;s s2ur(rpoo1openmies s) rurxront0aet mieiydlm ra( o (4trxoxo iydfp  auvilt) eum(r io1ap n ieils sruaxm nu4tlto ieiytfm2umn s;(4trenmr iodfmt ln o;t) rurir io1olte iesa()srraxrpoo4alto fetatfsDel( s (0 rtrxr oy1omte u s t0teumxo ny1al nmfvta(f rurxrpnt4tet ifctad aDeln o;(0 reoxf oadom rauvil(0srxm(opnydopt  iesatfsDraum ;t1opx if3iydfm ul(mo ()tlxnxf to1opDrli ol()srurxmpnudlleemfcslt srururpnt1apto oetydls emnmp;()altrxr3tytfa  lu s;t0 2xoxr3oydomen iei sf 2tm(r no0olenif3tltlm2elnvo;u4 reoxrcootlp r ieilt) ruoirpno4amtemfcsl(  Drm(ro;u1tpt  ictyslm rmnvp;t4 etoxfcoy1oa eaneils  2um(mpno4lp  mncsat) 2tmx  nt4tptoioeiysfsDrl(ms;u0 rtoxr tatom   nvi t0seumxo3nu4omee fetatf rtmx  ou1aeeomfeiatfmDua( s u4 ltnio3oydlat lu ils seuoirpny4ll emfvs tf 2rm(m ot0opeoioeiasfmDean s ()tltrmo3ty1fm e uvs;(0 2urio ny4lp  mnci t)srtaxr ;t0tltn ocild m ranmp;(0 ltomf3ty1om eaieolt0trxo(rpoo1opeelicsa( s2um( oot1oee mfciytlaDelu p (0arxrmfcty1opt  ieols) 2xoxo3iu1lp   ivt s)aDurxmpoo1apxnmociatfsDua(mo (0altnxf tytopDrluvo;(  euoxopno1lltnlivsltfaDurumpot0aeen feildfa2ra(vs;() renxf3ta1faD lnvi;s)s2xo(r ou4lp  mietls  2trxmpnt0apx ifeiat s elump u)tlerif3tydlptrlueo s)trxoio oo1ll nlfeia(fa2ta(r ot0tle  icilt mDul( p (4 rtrmrciodlaDrauvi;t0setrxm oo1optnlivia( aDurump;o0teenmiciydfm2ra(ms;u0 lenxf iytlaDe ieo;t0 exo(r3iodamtn ivils) 2rmxm ;o1tex mi3iyslm2rau o;u0areoxf ia1omtrlu i t) 2umim iu4am nlfeias  Duaum ;t4tltomi3tadfs ranmo t0tetrir3todopt aies t)setm(m3iu4lm elnvi t) rurx p;u4aexn o3iys mDel( ont4artrxfctatfpt aies t) rtm(m iudome mieta( aDrmu  ou1olt  feiadls uauvp;()tetnmf3oo1lp  anvi s0tetrio3io1alenmfci ()arumuro;u4tlxnioctad m2rluvsnt0trxnxrctatfp  luvols trxm(m3no4alt lfeia( sDum(m ;o1oeen feias s2el( ont0 eerxf3oytfatran o (0 2xm(m3oudllt mfvsl(  rua(mono4tpx mf3tldfs2emu o u)texnxf3tatoatelieo t  rto(r3oy1aleelfvslt)a2tm(roou4optomietltlm ua( on()artrio3todlmte i i s  2xrimpoo1lpeelfcsls)sruax  ;o4ope miciytlaDrluvs t)texrxr oa1fmt  u i t) 2xoir oydlpenlneilt)s2rm(  ;t1olto ieilsfa ulnmp;u4 lxrxocia1fpte u sl( teuoim3oy4ol  licia( s2tr(  ;u4aetn ictytfs2ra(mp t) lxrxrcoytoat luvol( seto(r3oydam nlnciasf rta( p;u0aeen feilslsDua( pn(0 lxoif ty1faDrlivilt t2trir oodopee fet tfa2tr(m no0olx mociaslmDrmn p (0altnio3tytomteln ols0 2umimpiydlmeemnvi s sDurxrpot4tee  i3iydfm2uanvpn(0trxrirciy1lm   ivo s)s2xrir3iodol  mneils  Dtm(mpot0tle ii3ilsfa2em(ms;t4aetoio3oytfm elu olt0 etrio oydalenmfesl( a2uax o;o0tex iieiytla emuvs;t) etoif3io1fp elnvi;s) rxoim oudope lfei t s2trurp;o4apt  ieiytlm rmnvs;t0trtoxrcty1fmteln i t0s2trir3iudopt mnvs () rurx  ot1teeoifciatlmDrmumonu) etnxocoadlateauvi (0 exmxr nudlmt lfeta(f rtaxm nu4oeen i3tytfs uanmp;u0tlxomfcio1opte iei;s  2um(r oy1lmte nvt s sDumxr ou1tee ifetysfm eanvs;u0aetnircootomte i o ()srtmxo3iodal emieiatfs2uaxr ot1alt ii3iltla ranmpnu4arerxocty1laDelnvols s2urimpou1ol nlnctlsfsrra(mpot4aet iociat a umuvs;t4altrif oy1faD  ivi t0s2toirpiodlme lfcil(f 2rr(m nt1tpeoioeiydfs2rm( p;()texomo to1oa raueolt0s2toxm3nu1lle mfcia(fsDrmumont0alt iieiadlm2ra(mp u0aetrmrcootfp   uvi;t0 2xoxmpnudoptemncilt) rtaxrpou4aleomictldlaDum( p;u)artnmr iatlaDran o;s  exoxmpny4apte nvsa( artrurooo1tleomietys s uanmon(4trtrmr todlate ivi s) 2xrir oy4amtnlnct s  2rrxmono1tetn ocilsfm rlnmonu4aeeoir3tydlmt ln o;(0 rxrxr iydoptnmncs sfs2trx  ;o0oltniociasla eln o (4alenxr3todfp rln s;( srxr(r3oodal emnvtltfa2ua(m oo1ope io3tldlsDrmumonu) leoxfcta1om elnvsls)texoimpoo1lmtnlfvia(fa2trur nu4oeenmf3iasfm2uanvs;u)tlxnmfctadopDr nvi;t  etmio3nu4apt lfctlt aDuaum oo1opxomf3iad aDum(ms u)tetnifctatfaD  i s;s0 rtriopno1lm  liei t a2urum nt0tet mociltlsDra(ms t4aexomrcto1la raiei;s  rxrir oy1amee fvias srtr(m ;t0oltniictaslm2eanmp (0alxnir ty1omD lnvi;t  eumxmpio1ll nmivt t)s2umumonu4opt  oeiydfm2uau o;u)texrio oatfp elnes ()sexo(mpio1amt mncta(  Dua(rpot4oltomoeildla2um(ms t)tlxnmo3tadopD li o;( texm(o nu1lm nmnei tf ruaurpot4opeo o3tyd s uaump;(4aexniocoydfa eluvolt) exriopnodapee feils a2rrxmpnt1oetnmoeiyslsDrl(vpnt0altnmr3tadomDe ivsl( srtmimpoo4lpt mnvt t)aDtaur nu0ale mictydlmDem(mpnu0 etrmr3tadom eaies;t s2trxopny1ap elivils)sDraxmpoo1tee  fctatlsDean snu4tlerif3oo1fa eai i;t)tetrimpiydomenlfeslsf Dtaxmpnt4tltoiictltfaDeanmo u) leniociodlp  anei;s0 2xmxrpou4optnmfeta(fa2urx pnu0olt mfeiadlm2rmu o ()artoxo oydfmtelivo ( truo(m3iy1opeelivt (farurxroou0apt  ieildfmDuanvo (4 ltomocoo1lm elu ilt0truoimpoudamee fvi t)aDrm(mp;t0alen fciysfsDeanvonu4tlxnxr ia1opte nvo;t0 2uoirpoudlmte nei s)aDta(  nu0alxnifciltfa em(vpnu0tltomf3iatfm r iei;(0 2urio ny4om  lfcilt  2tm(m ;u1tpxoioetas s2ulumpn()teerir3ty1lm ranvs t)s2ur(o3oy4ol n nciat  Dtaxmpou4olenmoeildla ran snu0aleoxf3tatfp e i s;s  2ur(r oo4alt lnesa(f 2taur nu0apenmf3tldfsDrauvp ()tlenirctadopt li o;s s2umim no1lmtemfei sfs2ua(mooo1texoif3tydls rmnvo t4trtrxf iytlp r uvil( srurxo oudaltemicslt aruaxm ;o0olxnmi3ilsla elumont) etrmf oo1lpD anvi;() 2uoim iy1ll e fvsa() 2ua( oot4apxo i3iytla2umu p (0tltnxrctatoptelivolt0t2xoxr ny1lmt mnetas aDrrx  ;u0ape  fetyt mDean p () eermocoydlpDe ivo (0tetm(m nu1lmt  nctltfsDtrx  no1opt mfcild s2eauvs u0tlenxfcoydoaDraieo t srurxopiodlptnlietatfs2taumont0tpt  i3iysfm eaumonu4trxrmrctotoa  aivs (0teto(o3iy1alee nvta(f 2tr(m ;u0opxn i3iytfsDrl(vo (0aleoio3totfaDr u ils0 etoxr3iodom e nctlt)srtmxmpnt1tpenmi3tyt m2ranms;t0arenxo3ta1optr u o;t0srto(opny4opte fcsas)sDtr( o;u1tpx  fctas m2umn o;t0 renxr3iytfat lu s ()t2xm(o3nu1al elieil(fsDrrum oo0tpx if3iasfm rmn o u4alxrirctatfaDr ivi;(0 2umxm3ou4lp n feiasf 2tr(mpno4olt mfetlt a ranmo t4 rerio3oytlpD lueo;s) rtoxopiudam nlicslt)aDtm(rpou4olxn octldls rmumo;t)artrif3ta1lm ranvs;s0t2ur(rpnudol e ivt t)aDtax  oo4tetn fciad m ulumpnu4artomrcio1fateluvilt0seuoxr no4lltnlivslsfa2tau o;u0oexo fciys s ua(mo;(0teenir3iytfpDrai i t)sexoim3iudame mnei t)a2uax  nt1oetn ieiasfa2rm(mo (0 exnxr3iydop  luvs (0seto(o ou4alenmici sf 2ra( oou1opt io3tysfm2rmn o t4altoif3oy1lmteanei t)texmirpoydomt  feiasfs2raurpoo4apx mf3ildla2emnvsn(0 lxnmfcoy1oa eai s ( srtoxr3ou4lpt mivtlt)aDuaxm ;u4oleomfctlsfmDelnvpnt)aleoxrctatlmteln sls)t2toir3iu4altnlfctatf rtau  no4ape ifeils s2ua(mo;(4 eerif3oa1la  ln o t  2tm(m3oydol  mieilt)aDuaurooo0ape mo3ils m eanms u)teermf oodfat au s s0sruo(r3iydlptn nvsas  ruau pnt0tee mictyt aDeluvp;t4alxnxrciytom rai i;(  2tr(rpny4lpt lfvsa(faruau ont1tlen oeiatfm2rmuvs;t) ltoxrcoatlmt  uvo;()trtm(o oydlmt licta(fs2raxmonu4oetn oeils mDumnvs t)trerxo iadomDelu o;() 2xmim oudamt lfesatf rtm(mono0tpenmo3iltls umnms;t4aeermf iytlpte ivil(0 etoio3iy4lptn fcsat)artaurpnt0ape  octat aDulnvs;u) etoxf iadlatrlu i t teumio oydlm emfetas s2rr(  nt4oetnif3ildls2uaums u0tetniociy1lm raivol(  2to(o3iudlpeemfvs t)aDraur ;o4olxnmf3tlslm2ra(vpnu4trtnxocoydfat  ueil(0 exoio3oy4ame  ivta()s2rrur nu1oet moetyt a ulnvp;u0teerxrciadlmDr neo;( tetriopiydome  nesas a2rr(mp;t4oeeo oeiat sDrluvp;t4 lxrxf iydlpDr u olt)t2tm(mpiydol nlnctl(  2taxmpnu1tltomf3iltfaDrmnmo;(4tlxnmr3iydoptrau ol(  euoio3nu4omt lfcs (fsDuaxrpnt4oexomoeiltlm rlu on() ltoifcto1laD luvs;t)s2xmxr3ny4oleemiet t)arraxro;o0oeto ietasfm2elnms u0 rermrctadlp elnvols  2uoir ny4lmenlfvs ()sDrr( pnu0apxnio3iys mDua(vsnu4aetoif iy1op r iesl()srurim3iu1amenmnctas) rtm(ront1oet iiciadfs ra(vont)altomocoo1fp eaieo;t teumxr3oodoltemncs t)srrmxmoou4alt mo3tysfa emn sn(4 rtnmo3ty1lm  auvs;(  rxo(mpno4ap  lfesas)a2uaur ot0tpx  ocils a eauvon(4treoifctydoaDeluei;( t2xmir3nodoptn iei () Durxroot4tpen feiytla2rm(vp t0 lxrifcty1fpte ivs t)trurim3iodlpen fvsl(f rraurooo1ape iocilsfa eauvpnu4tlxoxo iatomte n o;t)srxmxopoy1olt  nctat)sDrm(mo;o1altniocias aDum(vo;u)tleriocia1fm  lu o;s)seumxo iudomtnlfeilt)sDtaur no0tleo o3tls s ulump;u4trerifcia1lm   nvs;t0teur(r3ou1oleemnviatf Dur(m ;u0apto feildlm ul( ont4alenmr oatfp rauesls0teuo(o3nu1alenmicia( sDuax  ;o1texoif3iysfa2ranmo (4alxomf3iytlpDrlueo;t srumim nydllenmfci s srrr(  no4opx ifcilsls ranms t0 rtoxo3tydlatr n sls)trtoxr3nodlmt mici s  rur(rono0oleo octysfa2ea(mp;t0alerxr3iy1lm r u s;s)texrxrpno1lpt mncs ()a2rmx pno1ole  oeiyt s rauvo;t4aetrmfcoatom  ai o;(0trum(r3oydll nlnvsltfsrtrur nu4tlto i3tlslm2el(ms ()altnmrcoytopD aueilt  etmirpno1ap  livsls) 2ua(  ;o0ole  ictat aDelnvo;u4arenxr tytfmtraueil(0 exmio3ny4lpenmnes (  Dtaumpoo0olen fetld sDeauvs u4tleoxo3to1fatrlnvs t0teum(m ou1lmenmiciatfaDrru oou4olto feildlsDeanmp (0 eerxf3oo1lmD luvi;t t2toxr iu4al n ictat)s2rmumo;u0oexomo3tad a elnmont)tlxnmr tadlptelnvsls s2umxm iudlltn fcilsfs2rrxm ;o4olt io3iatfm ean o u)alxnmf oatopDrlu ilt)trumio3io4amenlivsl(f Dum(m oo4opx mieild s2um(vsnt) rxomocoodfm elu i;t)s2uoio3ny4lpe lfvtas) rur(moot1oetn fetys aDra(vp;()treoiocia1lpteanvi;t t2xrir io1apt mnvt t)artr(m nt4teeo iciyslaDel(vo;()aeeoxfcio1lm eai ols0srurirpiy1lm  lncs t  Dta(m no1alt moetatlmDelu snu) lxnxrcto1oa  aieo s0 etmxm3oodlmtelnesat)srrrur no0oee  ictatfa2eanvo t0 rtnif3oydoatr u sls)trtrxmpnodamenlnes (faruaxm ;t0aleoif3tadfsDul( s u) exnir3tydomD li s;(0 exmio3oo1ol nmieilt)sDrrumpoo0oetn o3tadfm em(vs;u4aexnif3tytlpDranes;s) ruoxm oy4lleelfvta(f Dumu ont1oexnmictldls rm( o ()arxnxo iytfa eaneo t0srtmxrpiudom nlictl(fs2rmu  no0tptn f3iysfmDuluvs;t0 exrio iadla e n i t)sexrxopnu4lltelfvtas  Dtmxr oo4aexoif3iltfm elnvp (0 lxnif oo1lat  n i s)tetm(m oudlp elfet tf rraurp;u4opxnmo3ilsfs2ulumpn(4 lxnioctydoptelueils)seuriopiu4opee icslt)srurxm nt4tlen ictlsla um( o;(0 lxrmr3tytoaD luvo;s)sexm(opoydoptnmfeias)srumxmpoo1opeomiciyd m ulnvpnu0 reoircty1lpD lneils0s2umio oy1omtnlivs (  2tax p;t0tpx iociadls ua( p;t)tetoif3oy1oaDeai sl(0 exm(o3ny4opt  fesl(farurx  ;o1tetnmi3ilsfs2rluvs;t4 eermfciadlp r i o;( trto(opou1aptnmnes (f rtaxrono0tlx  f3iasls2rl(mp t0tlenxfcty1optrlnvi;t) rtrxopoy1ol   fesa(f rtmu p;o0optn i3tls a2em(vs;(4aeerxr3oatop ranvs s0 2uoxrpoy1alee fcsat)a2raxr nu0openioetas a2rlnvpn() rermf3totfp eau ils0 rto(m3oudop   netas) rraxr ;t4openmoctytfs2el(mp t0aexrxf oodlmtrln sl( t2toxopno4omt  neia(  Dum(ro;u4teeo i3tlt mDem( sn(0tltoxr totfatraiei ( srtm(o3ny4al nlnvs ()sDur(m ;o0olenmfcild m2rmn s;u) eerifcta1lptelueo (0srxoiopiu4ap nmivsl()artm( o;u1olen octad m raumonu0trermo3ty1fmDrlivi s0seurir oudlp e fvsa(faDuaxm ;o4olxnmfeilt m ea( p t4tleoxo3ta1oa r nvo (0s2toxo3nu4openliei (fsrtmxr nu1tpxoioetltlaDemn o u4treniocio1la r uvi s texm(m3iu4ome  ncia(f rtmxr ;o0alx  fctydfa2rmnvsn()trermr3iy1oat li o;() euoxr nudlpte fctls)sDumu p;u4apxomicias aDumu p;u)trtnir oa1latr ivil()srxmxr3no4oltn fcsl() Drmxmont4tpe mi3tld s uanmp;() ltnio tatfm  lieo;(0trtmio3no1apenmnvtlt) Drmxr ot4optnmoeias s2rlums;u4 renio todfmDr ueo () exm(m3ny1ome mfei () rtaxm no1oleoio3iys m2emnvs;u) etomf oa1optr nesl(0 2trxrpio1alte fesls)sDuaumpou1openmo3ildfm ran p t0arxrmocty1fp rau i;(0 rxo(m3nudopen ivils s2raxmonu1apx ifctldfm um( o;t4tltrirciotfmDr u ols trto(m3iy1lme lfesat)artr(  nt0opxomieildla ul(monu0teeoir3todoatr uvils  2xo(m nu4lltnmfetat aDrm( p;t0tleomfctyt sDrlu o u) rtnxfcty1oa  an sls)t2umim3oo4aptelivsl( aDtaxmooo4tlenmfctls m2el( p;u0 ltnifcoytfa e neils0srtr(o3iudll nmietlsfsDtrx  nu4apeo oeiadfsDra(mo u0tltnircoodlp   uvi ()teuoir iy4lle mietl()arrmurpot1olxomiciatlaDea(vp;t0texrio ia1fmt lnvi ( texmiopnydlp nmieia()sDua(  no4teto fcilslm2raums;t) eerxr tytlp   ieol(  ruo(o io4apee nesas)aDrrx oot4tex mo3tatls2um(vpn(4 rtrio3iotlm rln olt) 2uoim iu4lme lfetasfaDuauroot4tlenii3tldla el(mpnt0 eenxo tytfp elieo;s0t2xmxo3iu4llt lfvslt s2ta( ono1tltomieias m rl(vo (0tleoifctydop r uesls)t2uoiopoy1ale lnetls)s2tr(r ot0tpe ioeiysfa rmnms;(4 ltoxrcoo1fpt aivo;t)s2uo(r iy4op emfvt (f 2um(mpou0tptnifciatfs2raumo;()artoirctytoa raieilt)texo(r nydll emivtl(farrm(mpnt0tleo ietlslm eanmsnu4artoxo iytfm   ies;s0seuo(r oy1optemnes tfa2ra(m ;t0alto iciys s2raums;t0 lerio ootfm e uvo;(0tetrirpiu4apeemictlsf ruaxmoou1tpe ii3ildlaDrmn on(0 eenxf3oatlmtrli o;() 2umiopno4ome lfvtlt)aDrrurp;o1tet moeiltlm2ul( ont)treoxrciy1la rai i ( seumxr3oy1ol n fvsa(fs2ururp;t4tpeomo3tat a2eanmpnt)tlxnmociy1opt anvolt0t2um(o3iu1amt mnvtat)srumxrp;u0oltnmi3iysfmDrm(mp u4teenxfcoydoaD  i slt0 2xo(rpnydlpen icsltf rur( ono4tleoioetlsfsDrmnvs;(0teeoir tatfmD aivs;() 2xrir3oo1ll nlietat) 2rrumooo4aetnif3iytla2rlumpnu4aexrirciydfpt aieo t0setr(r3iu4am emfcsat)aDurxmp;o0tetniocilt aDrluvsnu)tleoxf3oytfpD  neil()sexoio3nudaleemfvi tf 2umxm nt1tptomfeiysfm rm( pn(4 reoxrcto1latranvol(  rxrxm3oy4lltelivtls a2um(mont4texo i3tlslmDeaums;(0 eenmr3iydfaD lieols)tetoio oydol nlnet t)srrr(m nt0tlx  fctasfm ranvp t)arxrxoctotlaDelu o s s2xrio3no4lmen fviatfsrrmxrpnt1aet  f3iatlm2rm(vp u)aetrxr3iatlm e n ol(0 2urxmpiu4oleelncs s) Duaxrpot1tptn feiat mDrm(mo u4 etnmr tytlmt aieo t)sexr(m io4lmee ies s srrruroot4oeto octatfsDea( s;u0 eeoxr iatfatraneo t)texoim ou4ll  lnciatf rraxmooo4texoiieiydfs rau sn(4 reoif3tadomD  ues;s  2xoxmpoo4ol  lfcsat sruaurp;o4tlx  fcias m ea(vo u0tlenxo tydlpt  n s s0s2uoxmpou4lmte ici s  2uau  nu1oet iieiatfsDuluvo;(4trxoif3oodlat  ies;t0t2xrir3io4lpe lnesas  rumxmonu0ole iictasfs2ran sn(0texoxfcio1omtelivslt0srur(opio4omtemnetls)s2ta(  nt0opxn oeiad sDulu pnt0arerxo3iodoaD anes;t0t2trir no4llt mnctatfarrr(mooo4oet mf3tadla2eln s t4 leoir oytfmtrli o;s0 exmim3iu1ameemnesl( arrau poo1tpto ieias m eanvp;(0tetoxf oydlaDr u slt)srxoir3iu1om emncs s s2um(m nu0opxn oetasfaDra( o u)trtnxocoadfmteanei;t srxmio3oo4op n nci s arrr( pnt1aetnmfctytfm rluvo ()aexoir totfpDrai slt texmxm oo4lmt mici sfaDur(mpoo0tetnifeiat mDuau onu) rxnxf3iytfpteluei s  2um(m nu1am   ics sf Durx oot0oetomfeiltlm2uaums;u0arxnmf iodfp elneo;() exo(o3nydopt mieia() rurxm ot0aeto ietatfa uauvp (0 lxnif3to1fmtraueo () etm(rpnudoptnmncil(fsrtaxmooo0aptomfeiysfsDrlnmo;u4 exnxr iy1lptrau i (  euoxr oydameelietas sruaxmpno1tlen o3iltlaDrmnmp;t4arxnxr3iadlpD  u i;(0 rxoxr oo1ap n fetat  2rrurpnt1oeenifcild m rluvs;u4 rxrxf3tytoate nei;s0 rxmir3nodlmenliet tfsDtmumo;t0alxoifctld m eauvp t0 exoxf3iotlm r ivs;s s2uoim oy4ope mnesas)aDtaumont4alt  ociad mDrm(ms;t0altomrciytfpDrli s s  2uoim io4lmtn ieils)arrrx ont1tex mfeiysla rm( o t0artomrciytoat  uvs;t) 2uoxr oy4lmenlnetls)arumxmpoo4open feiasfs2rmumo;u4 ltomr3oa1lm e ivil(0 rxrxo iu4al elnvs () 2rrxr ot0tpe mf3tys mDrm(vont) exnxf tatlaD li s s0 etm(mpnu4lptelnci ()sDur(mp;u4tetn fetldfaDea(mont)arxnmo tatla r u s ()sexrio ou4omtemnciatf Dtm(mo;u4alxomi3ildla2rlnvs;t0aleomfciodlmDeliei t)truoxmpoo1llenmicia()a2rrx poo4olt  feilt a2emn pnu4tetnxr iatfmD lnvsls trxoxr3iudalte net ( a2tmx p;t1aetomo3tas aDea(vo;u0tetriociodomt an o;( trtrio3iu1lpt  fvsl() rtm(  ;t1tpt  ictysfm2rl(ms;(4 rerif iytlatrlneilt0 etrxopou1lltnlfvtlt  Dta(m ou1oet mfeiad a um(ms;u4aetrxr3oydomteaivsl( sexrio nudamt  ivta( s2tr( pou0oeen fctadfs uaumpn(0 eenmf3to1lm  ln s t)t2xrir3nudal e fcsa()srtmxro;u4oee moeildla2rm( p;(0 rtoxo oadomDeln ils0srtoimpny4ole lfvil( a2rr( ooo4aeen o3tasfs2emn s (0arxomrcoadom r ueils0 etr(m oy4ome livsa(f 2uru pnu1olxnio3iasls elums;t4 rtnir to1fateauei;(  rtm(m oo1ale mfcil() 2taurpnt1aet io3iys a rl(msnu0aexoif todlp rluvolt0s2toxo oo4olte feslt)arumurooo1olt ii3iltls el(msn(0arermr iadfp raivi s0 rtoxopou1lm e fvt (farrmurp;o1olenmieildfaDelump;(4 lxomo3tytla  lnesl(0texmiopnydopt  fcsls)artrumooo1alx moctad sDea( pnu0tltrxocio1fpDrlivils  rum(m oy4ap   icilt sDrru  ;t0tetnmi3ils a ra(vp t4trtnioctytlmt auvs t t2xoxm3nudlmee fetlt s2uru p;o0texo o3iyslaDuaump t)trtrxf iotomDe ieil(0sruriopnu1apt lnci (fartmx p;t0texomfciyd s ra( s;(0tetrif oy1fp  ln ilt)tetoxr nydlmtelneias)aDra(mo;t1oexoioctyt a2ra(vonu)alxomr iytfmDeliei;( s2umirpoo4altn fvt s)s2umu p;o4tet  i3tyd s rau pn(4altoio3oo1lp  li i;(0tetmxopno1amt mivias arra(roou0tlxomietysfmDuanmp t4trenmo ia1lpte n sls  rxo(m iy1am   fvsa( srrmu  ;t1alxoio3tadlmDrauvs;u)artrxo3oatopDr ueo () ruoxo iy4lmenlnvias) Draxmp;u0oltniictldlmDra(vpnt)arxnio todoa e ies;(  etrir ou4omenmictasfsrrruroot4tlen o3iydfmDeau o;u4 eenir oodfaDrlu ilt)t2xmxm oo4omtnlics s s2trxr ot4tetnmocilt s2ean ont4trenio3oytlm   ivil()s2umirpou4lm emiesas)s2ta(r ;o4alx mictltla el(ms;u)aetrir oadfatelueslt)teur(m nudlmtemfvil( s2ta( pnt4olt mociad aDuluvont0teermf3oodfa rluvsls srumio3iu1open ivtls  Dur(mooo1ole  feiyt mDrl(mp;(4aetomrcootoaDelnei t sexoim3ny4ap nmncsl()arrmurooo0aeeomieiydfs2umu p u) lenxf3iytoat luei;t)sruoxm oy4amt  icsl( sDum(m ;u1oltoiieiasla2uln o;(0 lxoxf3oytfm rli il( texmir3nodale  feta(  2urx pno1oltomociat mDuauvpnu)teeomocty1om   uvs;t0s2umxo oy4lm  mieilt srrau oot4aeenif3iyslsDem(vp;u) etoxo iytfate ivs t0 etr(r3iy1lp  lnct t sDuau p;o4aet ifetyslmDranmpnu4 rxnxocty1lpDeai o;t0sexrxr nu1apt liet s s2rax  ;t0altnii3ilsfa emu pn(4 rtrxfctadlp  lnesl( sexo(rpoy1ale  ivta()s2tm(mooo0apeomoeiad s uanvs t0tltoxf3iydfa  li s;( t2xm(rpnudapte ncsl(f Drr(rpot0tet  ieiasfs eaumo ()areoiociotoaDeanvs () eum(mpnudome livsa(  2taur ot0opto iciat m2ul(vont)alxoxf ty1fatelneo;s)srto(m3nu4al emfcils)aruaxmpou1tpt ioeiltlsDrlnmont0 leomr oytoa  lneolt seuoxm iodame lneia( aDur(m ;u4oet  oeiydfa uau p (0 exnifcio1laD an s;t0sexoio3nudom nmfvtas a2rax  ;t4opto icild aDean o;u0 etomo oodomteaues t0t2xmirpny4lpe  fvtltf 2ta(r oo4tet ioetydfaDelnmp;u) rerxfciotopD lnvo;t t2xm(mpnu4omt lict (fa2raxrpot4oeeo fciasfaDul(vo u4areoxocoo1lp raivi;t texm(m3ny1llee fvt s s2um( pnu0opxomocildlaDrlnms;(4 rtrxr3iy1fpDe u i t0srtoimpiy4optelncsa(fsrtm(m ;u4tltoiociyd m em(monu0tetnio to1lmD  neil() exrir3no1opt lfctat sDtaur ot0alen i3tytfa2rln p;t)aeeoio oa1opDe ueo;() rtm(rpiydamtelicta(f Dua(m nu4ope mfetys s rau o;u0 rtniociydoptr u s;s0s2xoxr3iy1aptnmncsa( sDtm(mo;o1aetniictldla ea( p t0trxnmf oodomD lieolt texm(m nu1omtnlncsas) Dum(mont4ole miciydfsDulnmonu0trenio3todlmDeaieo t0trxriopoy1ome  fvs ()sDrm(mono0openiocildfmDra(vo (0 exoio tadlatelneol( tetr(o io1olt  fct t a2rauro;t1oeenifcilt s ean p;()trtoio oa1la r i slt texmio3oudole lics ()arua(  no1alenioctasls el(mont0aexrif oadfaD  nvo (  2xoxmpnu4ol  lnviltf 2rax pou0tptn o3tytlaDuanms;(0altrmfcoydlpDe nvi;t0trxrxm3no4amenmnvt sf Durxrpot4aetoioeildlsDuan snt0tlxnir3oatla eau i s)setmxm nodoltemfci () Dua( o;o4tpt  f3iltlmDeauvsn(0aeermo3ootlptr i s ( s2um(o oo1apenlfci s aDuru  ;o4apenmfeiys s2ulump t4 etrmrcootla r ues t t2uo(mpiu1oltemfctls sDrmu p;o1alt ii3ildlsDelnvo (0tltrio io1fa e ivo (0 2urio3nu4lmt  fei ()s2raurpot4tpt  ieiyslm2ul(vpnu) rtriociadoaDe ieolt srxm(mpiy1apeemics t)srrau pnt4ole ifctatfaDelump u)aexoxo3oy1oa raieo;s t2trio oudlm   net ()sDrmumooo1optoio3iytla2ua(vs t0aetnmr3todfatr ueo;( s2uoirpiudlptnlfcs ()arrauro;u1apt mociyd a2emuvsnt4 exoio3ta1omDelivi;s teur(m nu1am  mncia( srrau oot0apeomoeiadfa2ul(vo t0teenmf tytop  anvil(0 exmxr iu4alenlietlsf 2taumonu4oltomfeias sDuanvs ()tlxoxf3io1lpDr ueo;t  eum(o3oo4lp n ivtl(  rrr(  ;o4opt ifetytlaDua(mont4tltnio iytoat  u i;(0texm(m oydamtnmnesatfaDrrur nt1apeomi3iytlaDelu p;(4 rtnxo3tatfa  lneil(0 eumirpnu4ap e fci t) Dtmuroou1aeen fctytls2ea( s;(4texnxocto1fpteau s s)srxrxo nu1omee fes t srrrump;t1apx mi3iyt s2uln on(4arxoxf oo1fmt  uei;t s2xoxo3oy4olenmivias)srrrxrpot1aleomoeildfs ea(mo;t4aetnxr iotom ean slt s2xrxm3oy1ll n fcilt)s2rr(mp;t0tle io3ils s2ean o t)aexrirctotlmDrli ols) etoxopoydlp  miesasfarrrxmoou4olxniictatlsDum( o;u)teeomo3ta1faDr ueslt0trur(mpoy4ole  neta(f 2umxrpoo4tltnmoeiadlaDuauvp;()aeeomr oodomtelieil( s2xoio nudamtelfci s arum(roou4tptn i3ildfaDuau p (4texrifcia1lp elu ilt truoxopou1ap elnvias artmur ot4oltoiieild aDuluvp;t0tlxnif iytfmtrai ilt0trxo(o oudom nmfeslt)srraxm no4ape mf3iydlm2rauvp;t)teermo io1fmDr nvilt trurxr iydlp e ivtl(fa2ua(  ot1alxnmoeiytls uanms;t4tetnircoodlp  auvol(  rtr(opiydomenlnvta()s2trum nu4oeen oeiat m2eauvonu0altrxr3iydlaD  ueslt0s2urim3ou1lpt mivsas)aDta(  ot4texnmieilsfm2umu pnt)treomfcio1lm elnvsls) 2trxmpou4opee ncsat a2rmum ;u0aex mfctytls rau pn()alxomo3todfmt anvi;s  exm(r3ou1al nlnes ( srrmx pot4aex io3iatfmDra( o t4alxrxfciotla eai s;s0 rtrir3ou4lm emfesa( aDrrx  ;u4altnmociyt sDranvpn(0 rtrio oatlpDr n s (0teurio nydlmt  ncsasfarrax pno4tpxnmieiytls rl(vo u0treniociadlmt ln ols0t2xmxr iy4alen nci s a2umx  ;u1apt if3ilslm2ran p t0tlenif3oydfateln ils)texoxm oydoltelnvi sf Dtax  nt1tpeoioeilsfsDem(mo;(4tlxnir3iy1opD lieo (0srxr(r3ny1oltemfvtlt)srrr(mo;u4alxn f3iasls2eanvp (0trtoirciatlmt lnvo s sexmxo nydoleelies (fsrrrur ;t0oexo oetldfm2ran snu0tlerio tadop eli o t texrirpno1amen iesa() Dumu pou4ole ioctadfa2rmums (0 renif tatla eau ils)srxr(m iy1aptemict ()s2umxr nu4oetnifciasfs2eanms t0altnmoctatomD  i ils0sexr(mpoy1lmtelfvsas)artm(m nt4aetn ieiyt a2elnvs t0tetrxo ia1oa e n slt trtm(m3iodopte ncslsfaDuau o;t4oltoiietat sDuanmo;t0texrmf3totlatr ivols)s2tr(rpoydale lictas)s2urx  no1oetnmociysfa2rmuvp u0tltoxo tydoaDeauvilt0 2xrir iy4aptnlicils aDtm(root4apx mo3ilt aDem(vp u4tltoxo3oo1lmDrau s;t0t2xoio io4om nlnetasfsDrmu pno1aetn fetytla2uanvo t0 reoxoctodfpD  nei;( t2tm(r3iy4ale  fvt () Drrx p;o1alen f3tld mDumnvsnu)alxnmfcia1faD ai o (  exm(m3ou4apt  ncsat  rum(mpou0oltnmiciasfaDumumsnu4 exrxf oy1oat lnvi t  euo(r3no4amtelieil(  rtm( poo1alt mf3tls a2em(msn() exrxocoatfm r i s s0trtrio3no1lm emfciasfsrumxm nu1oee if3iydfm2em(vont0tlerir todlpDrlivo;t)srxm(r no1lle livsltfartmxr oo0oetn fciltla emumonu0 rxnirciy1lptrlnes;s)tetoxo3nu1omtn ncs tfsrur(mp;o0tex  fciysls umnvo () exrmocootlpDran s;s  2urir3no1lp  lfetlt) rtm(mo;t1tpeomiciasfa ua( o;t4 reomf iytlaD li ilt0texr(o ou4amtnmietl(f 2raur ot4tlenio3iad s2uluvo;t0 exoxr3oydfaDeauvsl() 2tmxmpiu1lp nliesltf 2raumpnu1optn feildfaDeaumont4tltrif3ta1fmteai il()srtmxm3nydllee feias  2rax o;o0apxoioctasla2uanmonu0 ltoif iy1fm rln olt0t2ur(m oo1lptelfvi (faDur(  ot1aeto i3tat s2rmumo;t4 ltoifciadfmDeli o;( setm(mpoy4lpen ncs (faDururpot0oleoioetlt mDulumpnu4arxoxo3iadlmDe nvo;t0 ruoxo ou4lp nmfvs sfsDur(rpot0oeeoioetyt m2ulumsn(4 eerio oodfmte nes;t0teuo(opou4oltn icslt) 2rau p;o0tpxomoeildfa2emump;t4treoxrciadoa elnvo ( t2xmxrpiu1lptemfvt s artr( onu0aexnifciatlm rl( p u)alxrmfctatopteaivo;t0s2tmxo3oydolt  ivsas) Dta(root1olxn ieiaslm rlu p;u4alxoxr3oatlp   iesl()trxmxo3ou1alenmicsltf Dra( pnt0optn ietad sDrmuvsn(4 rtnmf3iatomD luei t) 2xmimpou1ol emivi ( a2tmx pot4aleo feilt sDuanmp (0trxnir3totoaD livo s srtmirpno4lme  fetlt  2rr(r ;t0opxn feiysfm rmnvo;t4arerxr totfa e nvo;t0srumiopiydaltelnvil( aDtaumpno1texo oeiys a ran p;(4artnxr iadlmt au il( srxrxo oodoleelfei (f 2rm(  ou0aetomo3tatfs um(vp;t) leomrcia1fmD lnei;t trxmxo oudlpeemietlt)a2rru  ot1texo o3tatfs2um(vo (4 rxrio ia1lm raieo (0 2xmio ou1al emivta()aDuaumo;t4tpe  o3tad aDumn s t0treoir todomD lieolt) rtoirpou1lp  licils) Drmumont0alx mocildlaDua(vs;() lxomfcio1op  livsl(0t2xoim3nu1lm elieslt a2raxmoou1tleniocilsls2umn o t4arenifciytfm eluvo (0 2tm(opio4al emiei ( s2rm(mpot1opxo f3ildlm ra(vo;(4 ltrxo3iodlm ranei s0texm(m3nodlm nlfci ( sDuaxrooo1oet  feildla ul(mo;(4trxomr3ia1fmDeanvs;( t2xm(o3iy4lmenlicilt  rurx  nt0oetoioctlslmDuauvo;(4 ltnifciadoatraneo;( t2tr(opoudamtelfvslt a2ua(rono4opxomoctlt m umuvpnu4texoir tydlaD auvil( srumim io4lptnmnesatfsDrmu  ;u4aeenmf3tyt s2ul(mp t4trxomfcta1lmte i il()trxoio iudom nmnvslsf 2umurooo1texo f3iyslmDrm( snt0aexomo to1opDe n ils  rurxm3iydame lncs sfs2rr(rooo0apt mfetldfsDemnvs;u4arenxo3oo1oat anesl(0 exo(r3nu4lpt mnci s  2rru ont0tpeomieils s eaumpn(0aetnifcto1oaDr n o;t)t2umimpiydlp elfvt s  Dta(m no4optnmi3iltfs2um(ms (0 rerircoytopt auvi s0s2um(opio1llt livsatfsDra(moou1aleo oeilslaDemnms ()tlxomfcootfa   i s s)s2ur(r ny4opt mnetlt)a2rr( poo0tlenifetldlaDrmnvpnu) rxoir3totopDelnvilt0srurxo oo4lpenmnvtlt s2uax ono1tetnmicildlm uluvp (0aexnxf3tydop  au o s  rtoim3oy1optelfcil( arua( onu1ape  f3ias sDem(vo;t4texnxr oadfm rlu ol( sexmxopnydopeemneiat)a2rmxm ot0oex ii3iyd m ranmsnt0tlxrmr oo1fpD  nei;s t2xmirpnydom emivil(  Dumxrpno1oetoiicias sDumnvs;t4 rxnmr3oydfat aiei (0setm(r3iodlmenmnetat)a2ua(rpou4olxomf3tadlm2el( s () lerxf3oadfp rlieo;t texrio3nu4omtelietas sDtmxmont1tetoiieiydfs2rmn s t0alermrcia1la   n i t) ruoir nu4alte ieil( s2rrumpoo1tpxnio3tlt mDeluvo u0trtoxf3oadoaD lnvols) 2urxr ny4am emivs (fa2umx  no0oex mo3iltlaDrlumont4alxoxr3iatlp   uvo t)seurxr3oo4alt  nesa()aDtr(rp;u1opt iiciydlaDranvo;t)trermrctotlaDelu s s0 2xr(mpnydopenlicta(  Drrxmo;t0tpxomociytls2ea(vo (0tltomo to1fmD lnvo;s0 2xo(o oudll nlnes t)arumur ;o1apen ieiydfmDuaump u) ltniocoodoat lieo t  2xrim3oodom nlfetlt  Duax  ;o4alxniieiytlmDrl(monu4arxnio oadfpD lieo (0t2uo(r3oo4lmte ivtat sDurxm ;t1opt ii3tyt m2uaump t4alenmr3todfmDe u sl()s2ur(m3nu1omtemiet t) Dtr(r ou1tex ioetyt sDulnvs;t4 eeoxo3iadomteau s s)t2um(o3nudop nmfesa( s2rm(rpou0tltn fctyslaDrmuvp;()areoxf3iydfatrlueo s setr(m3nu1ap  lfetls)artmu o;o0aet  fctadlm2eauvsn(4trtomr iytop rlnei;t)sexm(mpnodapte netatfs2trx pnu0oexomieiltlm umumon()tltrmo3iotop eanvsls srurxm ny4alt mict s  2rmumooo1oltoifciytfm2rmnvo u0 eeoxrcoa1fp eanvils0sexmxm oo4lme  fcslt)srur(  ;t0alto iciaslm rlnmo u4 lxrif tadlaDraues;t0trtr(mpiodolen ncslt)srrrxrooo4optnmfetytfs umu p;u) etnxo3oodfaD aueo;(  rxrir3ny4al  liei sfaDraxr oo0aexnif3iys sDrmnvp;u)tetrmo3totfmtran i;t t2uo(rpnudlmtnlncsltf rtaxmpou1aexo f3tadfmDeanmsnu0 eeoir tatlmD auvilt)s2tm(o io4ol emfcilsf rtrxrono0tpxoifciys s2uln p;(0 lxoifctydlpDelneo (  rxmxo ny4om  lnvs s)sDtr(rpoo1tet mi3iatls uln snt)aeerxr3oatopteluei;()tetrxopou4lpte nei tf Dumur nt0aeeomoeiytfa rlnvo;t4altrxrciotlmDe n o;( srtrim oy1lpenmict ()s2rm(  ou1aetn octatfaDrlnvo;u)areomr oydlm e u olt0trxm(m iodameemfeilt) Dtmuront0apxo f3tlt aDrlumo;()tetomociydfa   ivi;(  etm(r3iodllee neil( sDrmu  ;t1aptomf3tlslm2rlu p;u) ltrircty1op  livslt)sexm(m oodom  mivsasfaDtrx  ;t0tpe  ociysla2el(mpn(0trtrio3iydoa  lnvilt0 ruo(opnu4om nlncsl()srtrxmpnt0aet  f3tyslmDuln ont0arenifcoydlaDrlies;( trtmir3iodamtelfvs tf Drau pnu0tet ii3ildfa umu snt0 rxomo iy1omD  uvs;s)truo(mpou4ol nmfcil(f rum(monu0tpt mf3iatfs ua(ms t4aexrmfcoatlaD  nes ( sexo(m nu4lpt mnes ( srum(mpnt4opeo ieilsfm rlnms u)alxnxf3totlpteauei;s srurir3no1openmfeilt sDuaxmpno0opxoii3ilt m2rln snt4 rtoxrctatfaDrlnvo (0teur(r3iy1apt  ivs (fsrraxrpnt1aex iocildls emn ont)arxnxfcoatoptr ivs;s) exoimpiydamtelivsl( aruaurp;t1opxo f3tltla2em(vp u4 rtrxocoytlpDrln i;s)seuo(o3no1omt mfetltfsDtmx pot4tpx  f3ils aDeauvpnt)tetniocto1fp rlieo;(0tetrxmpio1lpee ictl()aDuaum ;t4apxn icilsfsDelu p;u) eenio ootfpD lueilt)tetrxopoy1op   ivs t)a2tax o;o1optnmfciasfm ean s t4arxrmr3oa1om e ueilt0trum(m no4amtnlfcs t arua(r oo4opxn ociyslaDrl( o;()trxoircootoptr u o s)texrio iu4lltnlieias  rtax poo0tleo f3iydfa umnvp;u0arenmrcty1oateau o t  2uoxr oydlmee ietlt aDrrum ;u4texo o3ils sDumnvon() eenio tadfatr ues;t0s2tmxo nu1olen ivi () Dur(rp;o0oex ioctat aDelums;(0 eenifciy1lpDrli i (0t2urirpnydom n ncsl(f Durumo;o4aleo octlsfaDel(ms;t4 eenircia1fm  li i;s) rtrio nodap  licsls)artr(  nu4ole  i3iat aDumnvsnu0aetrir ta1laDe neols)t2xm(opoydomtnlncsa(fsDra(ront4altnmietlsfm eluvp;u0texrxf iodomteaues (0tetr(r oudop  mies tf Drruro;u4apt iociytlaDra( o t4tlxoiocty1lmteaivolt) eurxm nu1lm   ncslt)a2tm(  ou1ape  f3tltfm rmnms;()trenmfctotoaDeai i s tetmxo3nu4op nlics tfarururpnu4teenioctldlaDeanvp u0alxrmf oadoptr i o;s  2trxo3ny1lmtnlfcsat  2um( p;u0alenmiciatlsDeanms;u4aexomr oa1fm r u s t srxrxr oydap n nesl()sDta(root4oleo ieiyt s ua(mo;() renxfciadfp  ai o;t  rumir ny1ol  mneia(f Dtaxr oo4tpx if3iyd sDra(mp;u0tltoxo to1opD aieolt srtr(mpiudlm emnvsatf 2raxrpno0apeomfcildls rlnmon()tlxnxr3ty1omtelieo;t0srxrxo oy4aptn ieils arumxm ou0optomf3iysls rlnvs;() rxnmo oa1fm eln i () eumxmpoo4amtnmfvs (  rua( pnu0tlxnifeilsfaDum( pn(4 exrif3ty1faDrlnes t s2xmxr3iydalenlfeias) 2taum ;o0aexomoetytlaDuanms (0tleoio totlpDrluvs ()srtoiopoo4omtn fviat)aDrru  nu0olxomo3ias sDulnmp;u4tltrmo iotoa eau o s srtm(m3iy1lm nlivtls) rtmxmpnt1apx  o3tls a2ulumsn(4 rermf3oy1fm r ieol()s2toxm3io4lpenmfcilt s2trxro;o0tpe ifciyd mDuan o;t)alxrir3oo1fmDran i;(0teuoim no1lpen nctlsfsrtau pno0oltnmoeiytfm2rl(vp;t0aeenxr oytfmDr iesl(  rtm(mpou4altnmies ( a2rmx p;u1aeenifcildfs rlnvs u)tetoxf to1lptelnvolt0trur(o3nudolt  ieslt s2um(r ;u0oltoiictys aDua(mp;(4aexnmr3ty1omtraieols0 ruoxo3ou4amt  fvtasf rrru  nu1apeomieias m emuvpnu)tltoxrctodlp   uvil(0t2xrxrpoy1lmtnmict tfsDtmxrooo0olt miciydls rlu s u0altnir3oytlmDe nvo;t0tetr(opoo4ameemivtasf Dtaur ;o0apeomoetldlaDeluvs t4 rerxf ta1lptrluvslt)t2xmiopiy4omtelfcsls  2rr(mo;u0opxo fetadfs2rmuvo;u)teeoxfcia1om e ivs;s)s2xmim no1am nlivs ()arrru  ot1tpeomieiadlm umnvont) ltrxf tydlaDrln o;(  2uoxmpnu1llt mnciasf 2rm(r oo1tlxnioetysls ean o;u0 etrxrcoatfpD  i o;s t2triopny1olee fes () rtaum ot0tpe io3iys s rm( o t4alerxo iadfm e i ilt)teur(rpoo1omtnmivsasfsrum( o;t0tpe  iciad a uaumo u4 eenmociatfmDelivslt)s2xrim nodamenlnvias) Duaumpnu1alxomociys mDum( s () eenmfciydoatrai i ( seuoxopiu4opt lics t)s2ra(rpoo0tetnif3iydfmDulnms;t) lenio ty1opt  uvi t0 exoim oy4lp  lfvtasfaDrmxront1aptn oeiasla2rlnmsnu0alxoir3oy1fmDeaues;( trurir oy4lpen ivtltfa2tmxrp;o4aptnmieiysla uanvo;t0 ltoir tatfpDr ieil( t2toxopoudopen ieiat) Dtm(mpoo1olxoio3iydlm el(vsn(4aetrio iotlmDean i ( trtmxr iu1omeelictltfs2umxmo;t0ape iieiyslsDrm( p;(0artoxf oatla   u olt)sexmxm ny1op emiesa()s2urxrono1aptniociad s um(vonu) etrmrcto1fm   u ol( trur(rpiodlpen ieils) 2rmx o;t4oleoioctydfa2ul(vs () exoxr iodom  an ilt)t2xmiopoy1lme mneta()s2uaumo;t0tlx  o3iltlsDea(vo (0areoxfcty1lateaneolt  etrir iu1opt lfciat)sDtaxr ou4altoifcildfm2ulnmo;t) rerio iytfaDelu o;s0 eur(opiu4alte nesls)sDrax  ;t0apx iieiaslaDel(vs;t4areoxr3oy1omteai i;t)t2umim3oo4amt lfvtat) 2uaxro;o4olt  o3tltlmDuau on(4aexrio3oytoat  u o (  rtrxopny1amenlfvslt) Dtrumpoo4olx mi3tyt aDra( p;t0 rxnxoctytopDe uesls0t2tmxm ou1openliei s arumumoot1teen feiytla uanvpnu) etnir3tydfmt livo;s  2toxopio4lm elicta(fsrtrx pot0aeeomi3ilt a um(vs;t0 ltrirctotlmtrln s t trxmio no4lpenliei (faruax o;u4opxnmo3iasfmDrmnms;()arxnxf iytlmt auvo;(0t2umiopiy1lptnlivtasf rtr( pnt0tpenii3tyt s ra( p u) exomo ty1lpteanvs;s)srxmiopiydll e ncs ( srtru pno4aee if3tls s emn p;u4tlenio3iydlmteauei t) 2xr(opoodalt mieil( aDurxroou1ole iociltla2ran snu0trxoirctatop elu ilt0 rur(r3oudomt mivtas aDua(m no0tle iicils mDra(mo t0trerxfcia1fatelivs s0sexrxrpou4omtelfvias a2tm(mp;o0oleo oeildfaDuluvpnt4 eeomfcoa1fpDrli i;s  rurxmpoy4olenmneslsfsDra(rooo4oeeomietltfmDua(vo u)tltnmfcoydlmD auvsls)t2tr(r iodlpeemnvi s)arur(mono0opeo o3iydfsDranvp;t) lxrio3ia1la elnvi ()setrxo3oo1amen fct t) ruax o;u4oltn fcils m2uluvpnu4 etoxr3tydfm  livsl()t2toxr oy4ol emfet sf rtru pou0tpeomo3iytfsDel(vpnu4aeeoxocoadfm r u o;s t2xmirpiy1ol  mnct s)aDrmum ;o0tlenif3ilsfsDem(vp;u)tetnxr ootfatranes;(  euriopno1lmt mfei s artr(m ;o4teto o3iasfm eanmsn()texoxr3tydfa   nei;( s2xrio no4lp  lfvta() rumx ono1tpxo octls s ra(vo u4 etomfciy1oaD  ivslt0trxrxr io1alen ncs s  2urum ;o4alxn icilsfa2eauvs u4trtomo3ootlptrli slt0t2uoiopno4open fctl() Dtrxr no0tlt ii3iadfs2rlu p u) eerxf ta1lp   nvs s  rurxm3oo4llenlicta(fs2rr(roou0tee iieiasls2ulu o;()
\ No newline at end of file
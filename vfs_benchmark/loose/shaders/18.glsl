@@ -0,0 +1 @@
+u ils  2umxm ny4lm nlicsat  2rr( o;t1ope  octys m ul( s;u4 lerxr3oatlaDr uvsls0t2urxo3ny4lpeemfeil( a2rrumonu4tlenmociadfm2eauvp;()aeeoxocoy1fpD aivs t)t2uoxr oudol  mnvt (fa2ua( poo4altniieiyslmDea(msnt0tlxnmo tadoaDe nvo s t2tr(mpoodlmeelietl( srumur nu1tpt mieiyslm2rmnvsn(0tlenmf3totoa rli i;s0 2toiopiu4op nmieias srrau ont0oleoiietlslm umumpnt4 reoxr3to1laDr nvi s) rtr(opoy4oltemicia(faDta(  ;u1tlen fetlt a eaump;()areomf3todoat  uvi (0trtmimpoudol  lictl(farta(mpno0alxomfeildlmDeau s;t4tlxoxfciytlaDeauvo;s)trto(r nudoptelnvslt) Dta(  ou4oeen f3iltlaDem( p (0 exnmr3todop r nei;s  rxr(mpno1oltnmfvtl()arurx  ou1oleo ieildlm2ranvs;u4trtrxf oatla r nes;s0truoim3iy1al   icslsfarrm( ooo4oeeo f3iysfs ulnms (4 lerxf tatlpte nvsls s2xm(m io1ame  ieta( sDtm(  ou4teeoiieiadfs el(vp;t0arenmocoodfat  uvo;t t2uoxmpno4amenmnvs t  rtmu pno1oltomf3tldfs em(vo t0tltnir iatfptelivs;t  rto(o iu4omenmnvslt s2tm(ro;t1oex  o3iat aDran s u4 lxomr ty1lmD lnvs t0 exmirpoo4ap nmncsas sDua(m ot0tetn ieiadls ua(mp t)artnmr tadfpDeau s;(  rtm(o3nu1am n nvsltfaruaxmo;u1oet ifeilt s umn on(4 leomr3oodlpD aivilt)trxmim nu4opt lictas a2urxro;u4tlto ieiadfs2ea( o;u4aexnir3tytlpDr u o (0srtoxo io1lp  livtltf 2rm(mp;u1teeomfctld a umn onu4aeerio oo1lpDr ieil()sruoxr3no4am emiesa( arurxmpnu4oetn f3tadfa el(vo (4arxoxr3iytlmtelu i t0 2umio oydalte ivi s) 2rrurpoo0aee ifeiytfa rmump t0trerif iadlpDelivi;s trxrxo ny4lp emnvias)srrr( ono0oeto fciydfmDrmnvo u0 lxnmr iodoat aues;s0trum(o ou1ap nmietls) Dtrum ou4olxoiietadfm2rmnmp (4aetrmf io1omDeanvo;s srxrxm iy4omtnmnetat)s2tm( pou1opxnioctydlm2eln pnu0arxnmf3iatop  au o;t  rumxmpiydlm nlncias) Dta( o;o1tee mi3ild a eauvonu)arermrcoydom elneils0sexo(m3nu1lme mfcsasfs2umu pou1oexomiciadlm ea( s (4trxrmo ootopt  ivi;t0 eur(mpiy1lpenlictasfsrur( p;u0aet  oetyd a ulnmpnt4altrif3tatfaDeaieo t srxrim3oo4ome lfcs tf Dua( onu1aleniocild m2el( p t4 etnmrciytomtrln s (0trxrxo3nudom   ivia() Dumumpot1apxnii3iadla uanmpnu4tltnir3iatlptraieo;() ruo(m3nydlpt mnet (f 2ta(m ;u4aexnio3iaslsDraump () eeomfcootoa raivi;(0teurir3oy4lle  net s) Dum( poo0alx if3tlt s eau o u4altrxf iy1lp  auei;s srtrio oy4ape lfvi s artaump;o0aeeomfctlt m2ua(mpnu4 rxnmo3oatom e i o;s srtrir3no1amtelfcta() Dtax pot4ape iiciadla emn pn(0 ltrxr oa1fm rlivi s setr(m3io1omte fctas) rtaxmo;o4aet mi3iad m2rlnmsnt)artoxr3io1omteaneolt0setmxr oodameelfcia(fs2rr(  ;o1tltomi3iydla emnvs u4 etrmf3oo1fmt luvi;s0t2xmio3ou4omeelies ( srtau  ot4opx mfcildfa rl( s u0tltnmf3oatlpDrau il( s2urxm3oy1aptnmivta( aDur(  ou0tetomi3iatfs ra( o t4altrxr iotlmD lu i;(  rtr(opny1ale lfvt s  Dtmxrpou1tetoif3iytla2eaums;u0alxnio io1fpDeanvi;t0trtr(o3nu4ap e nvi s) rrr(  oo4tleomieilsfa rl(mp u4 ltnmfctytfpD  ieil(  rurimpnu4optnlfeiltfa2ur(root4tet  f3iys m2eanvsnt)alxoifcoatlmD  ivol(0srur(r3nu4ole mfesatfsrrru ont1tetnifeiasfs2rlnvs u)alenxr3iatopDrai s;()texm(m3io1aptnmneils  2tm(  ;o1apen i3ild s rlu p;t4teermr3oadopt auvo t0s2xr(r3ny1ll emiesl()sDrm(r ;t4apeomi3iyslm2eln p u0altomr iytfmtr uesl()sexoim3ny4lme mnvs s srumx ono1olxomfctltls2em(monu)artrxoctodfm eauvs;(0s2urir nodoptemnei tfaDtr(mpoo0optnmiciatla rl(monu4trermrciydfate ueils t2urio nu1am e feiat  rrm(rp;o1tetoifciasfsDrl(ms;u0 etoif iytlaD  i i;s seuoir3io1optnmieils) 2trum ;t0tpeoio3tltlm ran onu0tlxnifciotoa  luvi ()tetrxr3ny4om nmnesas)sDtmxm no1ole mocildls2emnmp;t0aeeoxr3tatla eaieo;s0seum(o no1lm nlfcsltfsDuax pnu1olxomoctadfa2rlu p (0arenir iadomt aies;t seumxmpiodaptnmicilsfarraumoot1aet  o3tydfm2uluvpnu4aexnmo3tydomt  uvs s0truo(o3no4ol nlneilt)aDtm(mp;u1tpe mfciyslsDraums t)trtnio oatlpDe ieils0teurxo3oo4ll  mneil( srra( o;o1tpe iictadla2ua( o;(4aeeoxf3oydoatr n i;t teumio iudoltnlfct tf ruaxrpno0oeeoifeiyt s eln s t0arxrmr ia1latraieols0 exr(m3oy1lpenmnvil() Dum(rpnu1aexn ictydlm eaumo (4tlenmf to1lp eluvol(0trtrxmpoydll  mivs tf Dta(  nt0tpxomfctlt s2rlnmo u)alxnxf oo1op  lieo;s  rtrxrpio4al nlicsls  ruaxronu4tpt mo3iadfm2uluvp;(4teenmocio1fpDean s;s trtrim3io1lp   fesl()arrm(r ;t4olx iicild a ulnvp u4alerir oatlm rai sl(0seur(opnu4omee fvsl() Dumum ;u0ale  f3ias s2uanmp t4tlenif oatfptr uvslt0 etrxopou1ale livtasfa2rrumooo0ole mf3iltls rm(vsnu) ltrmf3oodfm  livi;s0teuo(r oodom elicils) Drmx o;t0tpxoio3ils mDrmumo;t)tlxoio3iydom   n o t0t2toxopnu4lle mfcias)sDumurp;t4tltnmictadfaDemnmo (4 reoir3iydlpDran o (0srumir no1ole liesasfsruaurpnu0oetn octydlsDrauvp u)trxrio3ta1lmtrlnvilt trxoio3nydlpt livi (fa2rmxronu0oexo fciat a ul( p t0 eenir ty1opt an il( teuoxrpoodalte iesa(fa2ra(m ;t1oeeo f3iydla2rauvo (4altrxfcia1lm rlu s;t0s2xmxopoy1lme  ivtat  2uaxrpnu1aexnmi3iad s rmuvs u0altoxf3iytlp  aivi s t2xoxm3io1om elfvsls srum( poo0oet mo3iad mDrauvp (4trerircty1omteaivo;s0 2urxmpoodap emfeta(f 2ur(  ;u1apx iiciysfa em( s u0 etnxr tatlatranesls s2xmim3iy4op nlfetlt)aDrrumpno0tleoioetadlsDemnvs t)alxomrcio1oaDrlnvi s)t2xo(mpoy1ap e iviatf 2tmurpou4alenifcild s rmnmp u)tlerxf oadfa r neolt trtrxrpiydome lfvtlsfa2rrxmpno4opx mo3iatls2ua( ont0tlerxf oa1fpDrai ils0setm(m ny4lmee fvta( artaxmp;o1aee ii3tydfa em(mpnt0trxnif3oodla elnes s0truo(m3iu4olt lnet s s2trumooo1tptniictysfa um(vs;()aetnmf3iy1fm eaneo;( s2toxm oo4ale lnciatfs2tmu p;t4alt  i3iysls2rln pnt0 etnxo3iodfa  aieo t  rxmxr io1llt mictlt)sDurx  ;u0oetnmo3ilt m2ulumo;t4altnmr3iadla  li ols srxrim3no4lle mnciltfarur(monu0tpe moctysfaDem(mp (0aeenxocoa1lpteli o;t trxrxrpoudamtnmies ()a2urxmono0apeoiieiyt sDemuvon() lenmoctodlmD  nvs;t) rtrxo ou4am e ieslt a2raumpnt4alxn ieiadfaDeln snu4 rtoif oy1oa r ieo;s s2uoiopoodlm elfet tf 2trurpoo4alx ioctatlaDrm(vs u) rxoxr3iy1om  an olt0tetmio iy4ol  mivtat) rtrxr ou0teenio3iytlm eanmo;(0areoxr oodlmDrlueo s) eto(o3io1om   fesat)s2rmuroou4tlxo iciyslm ulnmp;()teenmociadlptelu s;( s2trir3iy4opt  nesls sDraur oo0aeenifeiydfm rm(mp;u4tlerif3iydlatraivo s setmxopnydll nmnvtas)artau pnt0aleo octld sDel(mp u0artnxfctotopDe i sl() rto(o oo4ll   nvsasf rrau  nt0apen o3tasfs2eln p;t0 rtrio3iytomD lneo;s trumio ou4ole mfvtat)a2trxmp;t0oexomieilt m umnmo t4arxoir tatoat  nei;s) 2xoio3ou4lpee fet s) rrr(root4oleo i3iytfs raump;u0tetnmr3ty1lp rln i ()s2xrir3oy1alt  ncsat s2tmumoou4opx  fetldlm2umnvont)aetnifciydomte neilt)truoxo3ou4al   ictls sDumxr oo0oetn fciytfaDeanmo ()tetrmr oa1oa  li o;t0s2xoiopiodlpe  fcilt s2rau  no4oet iocildls rmumon(4 rxomrcootfptrliei t setrirpoudol emivt t)aDrmu ono4tpenifeiyt a ea(vs t)aetomf oo1laDe iesls0srxrimpno1amtnliesl() rraxm ;u0tpto i3tas mDranmo (4tlenxf3ootoptr ues;s0 etriopoudll e fcslt artrxmpno0apx  ietadla ra( s u0arxoiociydomD an ils) eumio3oy4am  lnvia(farurumpou1apeomfciasfm rl(vp t0teeoiocoydfat lnvi s0sexo(m nudlmt  fvtlt a2raxmpot1oetnmfctat mDulnmo t0 ltoir oytfmt ai s;t0t2uoim ny4lle  fvtl( srtaum nt4opt  o3ilt aDrluvpn(0 lxrxf ia1omDe uvil( srur(r nudoptnmics tfaDrmum nu0tltn fctlsla eanvpn(4alermoctydfm e n o ( srtoirpiu4apenmneta(fsDtmx  ot4aeeo f3tltlm2ul(msnt) eenxoctydop rliei s)s2umxopny4lpen icta( s2rmxmpnu0tltoiociysfm ra(mp t4alxomr tadfaDeli i;t0trxoir nodop e nes sfs2ua(m ;o0optnmo3iltfa2umnvs (4trtrifciatfmDr ues;t t2tmxr oy1lptn fci s  2um(ronu1oexomoeiytfaDrm( p t0teeomfciadfa raivils0teumir ny4lme mfeta() 2uru poo0aet  o3tlsfaDrlnmont)trxrir3ta1oatraieo ()t2um(r oudam nlnesas) Dua(r nu1tpeoioeils a ean s u4 rxoifciodlp r u i t0 2trim iudlp elies (  Drrxrp;t1aeen i3iaslmDrmnvont)tltrircia1lateli s s) euoxm io1lmtelieils  Drrurono4opeomfciyd m rl( o;u0tlxoxocoodoa e n ols t2ur(rpiu4ll nlfes tf rrrumpnu1tpxomo3iadlaDrl(mp;() rerio3iytfp e n o;s)texo(opno4aleelfei sfsDrm(m ;o4olx ioctasfm2um( o;u4tleriocoy1op r uvilt s2xo(m oodop nlfetltf rumumpoo1teen ieiydla emuvpnt4texnio oo1lpt aivi t0teurirpou1lmenliei s)arrmur nu4aee  oeiadfa eluvp;(0altrmo3ia1laDe u s (  exrxm nudopt lies sfartmx p;u1aeeniieildlm2rmnmpn(4 leoio oydom   neols0t2xm(rpnu4olenmicsa()s2trur ;t4oeeoiicildfa ea( o;u0aetnxo ta1omD li ilt0 euo(rpoy4al emfeias) rur(mpot4alx  o3tltlaDel( p u)tetrmf3iodomtr nvsl()trxm(r iodameemncsatfa2taxrp;u4oee mfciaslsDrlnvs;(0artoifcoodfmte nvilt srtm(rpny1olt micil()srtmxroot1altnmi3tydlmDrl(vsnu4alxnmfciotlpD aieil( srur(opoy4omt  feia(f 2trxm nu1open o3tldfa2el(msnt0tlerirctydlpteaieo s)trxmxo3ny4altnmiei (  2trxmpou1oexoiociadfs rlu on() exoxr3oytfp ean ol(0srxoxo nydomt lfvsat)srtrumpoo0olxn ietat mDua(mo;(0 lxomf3oa1lmDr i i;t) ruo(m3oudap  lnei t) 2umur ;t0aleo oeiydfmDel(mo u0 rtrmfcoytlpte neol() 2ur(o3iu4lm e ies (faDumu  oo0tlx  o3ildls ul( ont0arxrxf3ta1opt aieil(0trumxmpio4ol  lics t)aDtr(roou0tptn feils m ua(msnu)tetrir3oadom  lu olt setoir io4lltn feiasf Dua(moot1alt mfctysfa uan sn()teeoif tadlptr iei;t)srurxr3nodam e nvtat)srtaurpnu1olxn ieiatfa2rmu pnu0alxoxo3oo1fpD lnvi t  ruoxr oudap nlneias)srrm(ro;u4aetoifeiydlm2ean p (4trenio oo1lmDeluvi (0t2tr(m3no4lmeelfvia()aDrm( onu4aexomi3ilslm2rluvo;t4teerxfciy1fptr i s ()tetrxm nudllenmics s)a2tmu  ;t4tpeomf3ils mDrau snt)trtnmr ootoa elueo t0sexmio3iydll  lfci tfsDuau oot1opto fcils aDran o;t4alxrmociydlp rluesl(  exrxr ny1ole mnci s) 2taurpnt4apt moeiad sDem(mp t0 rermr ta1oateai olt0teumim3iudom emnvs sfsDtrxm ;o4alxoii3iadfsDea( p;t4aetrxocto1fpD li sl(0srtoir3nudlptnmieia(  2rmuro;o4optnii3iyd s ran pnu0aleomo3tadomt aneo s)s2tmio3nodamee netatfsrraumpot1oltnif3iys s2ean onu0aleoxf3oadfptr uei t srxoxr ou1ll elnct s)arrmumpnu1olxn iciadla2eau on(4alenmo3oydfpt ln s () 2toimpno1ap nlictltfsDrr(r oo0aptomf3ildfm uauvont0 eenxr3oodoaDe nvi;s t2um(m oy1al nmiet s)srtr(mono4oexn f3tadfa uan s;t0alenxf iytoa  lu s;(0s2uoxo3oo4am  mics tfaDururpou1tleoioetlslaDrmuvp;u0arermrctadopteaneilt0 2xmim3ou4open fesl(fsrrm(rpot0oeen ieiadfa eln p t0trxrxf totomt anvi s s2xrir iu1ol emici (f Drauroot4aetniociyslm el( s (0tetnir3oa1fmtranei;() exm(m3nu4lptnliciltf 2tm(mono0tex mf3ilt m2uau s t0areoif ootomDelnvo;( t2trimpny1llt  nvsa()srtrumoot4alx ifctytls eanmon()tltrxo3oodfpDrli s s  2xrxo3oydaltemivsat)a2trump;t4tlen feilsfm2rl( onu0 ltnio3ootlp r nvsl()tetrxm ny4lle mncsa( srtrxrpnu4oee iieiydlmDrl(mp (0 exrmo oo1lmtelivo ( sexoir3oo4ape mncsatfartrum oo1tle  oeiyslm um(mo (0teerxr oytlpDeauvols)trtoio3nu1aptelicsatf rraur nt4oee  ieiydla el(mp;u4alxoxociy1lp e uvi;t) 2umir nodal emivsa( sDua(m no1tee micilslmDra(msnu0aeeoxo3iotlpte nei;s  exriopoo1opt mfeias arta(rp;o4oexoiiciad s2rl(mo;(0trtnxf oytlmD luvo ( truo(m3iudoltn neta()srtrxmpnu4apt iictltla ra(msnt4trxoxr to1optrau o;()t2xr(rpoydlmeelietatfs2ta(m nu0aetnmfcilslm2uaumpnt)trtrmo3oatfp r neils0 2toio nodopt lfci s)arrauronu1tpxoioetat sDeaumont0altrmr iodlmteaies t  rtr(o3ny1omenmfetl()a2ta(rpou0oleniictlsls eau o u4 renmf3totlp r i il(0teurxr oudom n fctl(  rrrump;o0oee mietys sDrl(mp;t0tetnmfcio1fp elnei;t0t2trir oydlpt lieslt)arrrxr ou4tlenmfctasls rluvpnt0 etnxo iydlptr uvi;t0 2xrxmpny1ameelnct t)a2rr(  nt0alt miciltfaDumu o t0aeerif3oytomt  ies;s) 2uoxrpiudam elivtls s2uaum ot4aet micildls umu o ()trtnio todfpDran o t trxoxmpiodaptemfet (  rrmx o;o0oetoii3taslaDrmnvsnu4tlxrif oatlmDe u ols0sexriopiudame  nvt s  Drm(rono1olt mieilsls um(ms t)texnmf iydfmtrau s;s)s2uoir3oo4ol elfei (  rrau oou0opt iociysla eanmp;t4 etnio3tadop e ivs;t0texrio3nudamtnmfvi t a2trxr ot0aex iieiadlsDumuvp t4arxoio3tytomDr u olt0texm(mpoy4lpeelnet s)aDtaumo;o0aex ifciytla uln on(4altnxocoa1lm ean ols tetmio ny4oltnlfetls  rum( p;u0alx mfeildfsDelu p () lxoxf3ia1lptrli s;( trumxr3no1op n fcslsf Dua(r nt1texniieiytfs elnms;u0arxnxf3iatfmD an s;()t2xrxo ou1ap  lnetas sDrm(  nu4oltoifeiydlm2rl(vp;t0 ltoxo iydlpDeanes;s0 2xoimpou1lpe  fvsasfsDtm(rp;u4oet  f3iydlsDrmu s (4 lxrircoa1lpte ieslt0 rurxmpiu1opt lnci (f rtaum ou1apxoiocilsfm umu o () eenmrctotfmDeauei (  2xo(m3oo4lmtelnvia()sDrru o;u0opxnifeils a2el(mp (0tlenir3oo1fmDrlieo;()t2uoxr nudamenmnvi (f 2ua( oot1olt mociadls ul(vs;t0 rxniocio1lat au ils0texo(m nodame lncsls)a2truro;t1ope io3ilsfmDeanvs;u)aetrircta1fmt  ies t)s2um(opiu4apeemicia(  2rr(mp;o0oee  ieiydls2uau o t)alenxo iy1oaDeanes;t0s2uo(rpio1optnmfesltf ruax  no0tlenmi3tlsfm2rauvsnt0tetoxfciytfp eluvs;t t2urxopiodap  lneia()sDtr(moot4tle iieias a ua(mp;(0aexrmf todfm   i sls0s2tr(r3nu4llt lfciat  rtmx poo4olx mfciyt a2em(msnu0 rermr3iy1opD lneo t s2urxr ou4omtnlnvia(fa2rmu  no4aptoifciys sDem( s u0trermf3tytomDelueol()trtrio io4olenmics sfs2rr(  ot0ope miciydfsDua(vs;u) etnxociodoaDrlueslt  2tmio nudale mfvi (fsDtmuroot4aexoiieias mDea(vo ()tetnxf3todfmDr uvi (0 rtr(r oudome lnvs s)srumu ont1olto i3iys a2umuvsnu) lenir totop rlieo;s)sruoiopnodopeemncs t) rur(mpnt4apeo fciadfaDemnvp;u0 rxnxo iatfmDr i o s) 2trxmpou4omtnmfet ()sDuaurpno4altnmocilsla2elnvp;t0 ltrxocoy1lmt  uvi;t  2ur(rpoy1lme lncs s aDrmxr nu1oet mfciysfaDelums t) rerir3tydlpDr nvo s srxriopiy4lm elfesls s2taumpou0ope miciatlm ra(mp (4 rxrmfciydomDr uvi;()teuo(m3oydame mfci s aDrr(rono4ole ifeiyt s rmnmo t)altnmfciytlaD livs ( trumxopiy1lmtn icslsfarrru oot1ale micildfmDua(ms;u0tltomfcoa1fateai slt0srxo(r3oydlpeelnesl(f Drr(mpnu1alxnii3iatfm2raumpn(4aeenxo to1op e nei s0s2xm(m oodomtnmfct (farrr(ro;o1texnmfciltfs emnmonu0 etnxr3tatfmtrlu i (  ruo(o nu4omtn netlsf rtmu pou1teeo fctldfm2emnvp;()tleoxrcootoptelnvs s)trurxo ny1lmen nesas) rtr( p;u1tee  fciad a rm( o;t4trerxo oytoaDrlnei;t0 rxr(opno4lp elnct t  2tm(mpnt1aeto ieiys aDua( snt0arermf iydfpDrli slt0s2to(mpoo4openlneiat  2umuro;o4ope mf3iyt s2uau pnu0tlerxocootfaDelnvil()s2uo(o3nodalee fcs (  rtaur nu4oet mfciadla2em(ms u)aleoir3ty1faD li i;(0t2xmxrpnu4alenmncsls)s2umxr ;u4aet  i3iadlm emnvsnt0alxnmo oa1lpD aivol(0 2trir3iydaptnlicsat) Dua(monu4tet  ieiatfm rl(mo;u4trtrmr3oy1omteluvi t t2xm(o3io1openlici t sDtmumpoo1aetnioctldfm ulnvsnu0aeenmrcoydop   nvi t)setmxo iu4am nmnvtl( a2tmumoot1oleomoeilsls elnvo;(0aeenir ia1lpD  i o s)seuo(o3no4am e nci ( srtm( p;u4alt ioeiysls umn on(0artrmo3iodoa eauvs;t  2ur(rpiy1ll n icsls  Dur( ono4oexn ictasls umnmo;t4 lermrciodomDraieil()tetrimpno1lltelnvia()aDrmurpno1texnifetysfa2umnvonu0 rtnmf iatfp  auvslt)t2umim3nodap nmncsltfs2rrurono1apto f3iytlaDuau p u0trermr totla e nvs;s) exoirpoo4oltnmneilt aDrrx  nu4altoiociydlaDrmn snt) renio3iy1op  auvs;s0tetm(m io1op   fesatf Dtm(mpou0alto ieiatfa2rau o t4aeeriocio1lm  ln ols)teto(o iu1opt lfvs (fartr( pnt4tetomi3tyd a2emnvsnu) rtoio oo1fmD lueilt0setmxo3nudoleemici (  2umxm ;t0aee  ietyd a2ulnvo t0 rxnio3iadomtelieolt s2xrio oodlm   fvs (fsruau onu0teeniociat sDranms;() reomo todfmDr ueil(0sexm(m ou1omtnmnvilt a2tax  oo1tlx  ieiadfa rmnmo t4tltrmo3iatoa eaieo (0 exoio iu1lp n fciat) 2uaum oo4tex io3tldfsDulu s;t)tlxnmo3oy1lp r n ol(0teurxopiodlmeemfct ( srtrur nt0tlxomoeils a uln s;() etnmoctatlaD ai o;(0 rtr(o oy1omee iet ( srtmur ;o0tetnmoeilt s2raumo t)altomfciotfaDeaivo s0s2uoxm iy1openlfeiltfaDtmx ooo0altniiciasfm2rlu on(4aleoio tytfpDeai s;s tetmimpnu1ll n ics ()s2tru oou0apeo ieiys aDeluvp u4aetnio3iydopt anvo (0tetmxo ou1olt lfes s)a2rmu oot0alx iictydlaDelnvo u)trenmo ta1omte ueo t0 2urxr3iy4lpe  icslt)srrmu  ;o1optnioetyslmDrl(vo u0aleoio oo1laDe uvi (0 rxoirpny4amt mfcs tfsDrrum ou4opxomfciatfm2uaumsn()tltrir tytfptraivol( t2um(r no1omee fvi s  Dtrxmpoo1tptomf3ildfs raums;u0teenif3io1op eaneilt)trurxo3ny4apt mnes t)a2um(mp;u1tltnmf3ildfm2ul(vsnt0 rxnmocoo1lm  au o t  exrxm3nu1ll emfeta(farurxmpoo0oex iociadfmDel( snu4trtnif3iodomDeli i;()s2trxrpoo1apt  fvt (fsrtrur ;t1apxn i3ias aDrlu s;t) lxnmfciydlpDe i o t0t2umxr3nu4amte iviatf rurur no0tpt if3tldfaDua( o u4 rerxr3io1fa   ieilt0 rurirpnu1amtnmfciltf rumx o;o1tltn fciadlsDuanvon(4altomo iodfp elnes;s seuoxopny1ame  fvt ()aDurxrpot4tle mieiadfs2emn o u)aetnxfctadfptraues;(  rxmxopoy4ll  mnvs () Duaumpot0opxn feils sDua(vo;u0teeniocty1lmt lu s;s) rtmimpio1lm  lici s)a2tmxm ou4oleo ietltlm uauvpn(4trtnirctadop elu i;() exo(o3oo1alt  ieiatfs2raxr ot1oee if3iasfm2ran s;t0arxrmr todomD lnes;s0 ruo(o ny1ome  ncs (fsrtrur nu1tptomo3iydfa ea(mo t)tetoxo3oydla e iei;( srxmir3io1aptnmfctasfs2rmxr oo1optn o3iytfmDuln o u)tlxrmoctydfa eai i s0texm(o3iu4lltnlfct s) rrrx ooo0aet mieiysfmDumnmpnu) rxnif3iodfatrln i (0tetm(r3io1lpt lneil(fs2tmu  nt4ope miciyd m uanvs;t) ltrmocio1fat lues s trxo(o3io1ol n fei (fartrx pnu0alenioctyd m2em( snt4 rerxfctotoaD luei ()t2toio3ny1omenlieiasfs2rm(mpot0optniietysfs ulu p (0aetrir tadfaD anvil()srur(r io4amte fvi tfaDua( ooo4alenmictltfsDumu s;u0 etnmo ta1lmDraueols0trxr(o iu1lm n ici ()a2tmxmonu1ole  o3tatfmDemnvo t4aleoio3iydfmtr ueslt)sexrxmpoo1lmeemictas aDra( oou1olx  ociltls2umnmo (4tltoxo3oytfptranei t)teto(r3iudom e ivtlt) rtr(mp;t1oetnio3iysls2uauvs;t0 rtnxr3oo1laDr ieol(  2uoxmpny4am   icil( a2rru  ou1aeeoiietysfmDemnvs t0 lenir oydomDelivs;s  eur(mpno1aptelfei s) 2ur(mooo1oleoio3iytfm emnmpnt0 rxnmocto1fm elivo;()s2tr(opio1alte fviltf 2rmu  ;t4aexn oetlsls ranvp;u4tleomociotfptr u o t)srurxmpou4optemicsat a2raxrpot1tlxniieilsfs rmums;u) etnxfciytop rlies;s)seumxm nydamtnlfvils sDtm(mpot4opeoio3iatfa2ul(vs;t) leomr3tytoaDr nvi s0trxoiopoydole lfvsls  2ur(r ;u4oet ii3ildlmDeau o;t)teeoif3oatfp elueols0s2trio no1om  liet ( srurx poo4openiiciys aDea(mo u0 exriocia1om   ivilt0t2xoir3nu1opeelnvi s a2um(mo;o1oetoii3iys sDelu o (0artnmo3oatfmt  i s s)s2trirpno4ap e icsas aDraump;t1aptn o3iysfmDrlnmo u)tleomr3oodfp  lnvo;(0trtm(o3ou4omtn iei tf rrau p;o1tpx mociadfm2umu snu) etoir3iotop eai i s  rxoxmpiydol nmnciat sDrm(m ot4aexo ieiasfaDuln p t0tltrmrcta1fp r nei t texoim3ny1ale lnvtl(  rrrx pnu4ape ioeiasls2ua(vo u0 lxomrctydlmtrln o s trxo(mpnudlpenlfcia( sDrm(rpot1tet  icildla2emnmsn(4 exoio iatfmDrauvolt)t2uo(m oo1om  mfvsat) rumu pot1tpxnioctlt mDrmnvp (4altnxf oa1op e ivo t0 rtm(mpiy1lpenlfei t)s2ra(  oo1apx ifeiadfaDranmpnu4 lenxr iatlm  au ilt tetoir nydlmeelnctl() Dtm( p;t4tptniieilslaDemnmpnt)alermf3oatfaDeluvils0s2trxr iydllt mfviltf 2um(  ;o4alenifetytlm2raums;u4teenir oydlpt anes;t0t2tr(rpnudam e nvtls arururpoo4tleomoetad aDrmuvo (4teeriocoytlmD  nvo;t t2umxr3iodoltn fcilsfaDum(mpoo1oet io3tldfs umn s t4 lxrir tadfmDrlueols0sruoxrpnudomtn ieiasfsrtr( onu4alx iociltfaDrmnvo t) lxrmoctadfmDr n s (0t2xmxrpio1ol e ict () Drmx  ;u4opxoii3tldfaDem(vs ()alenmo oadfmD  uvi s)srtmxopnu1apte fcias)aDrau oot4aex  i3iadfm rlumont4trxrxfcoatfa rlnvsl(  euoiopoo1ale mictasf rrmu o;o1teto ietas m2ra(ms;(4texrxo3iytopDranvo;t trur(o oy4ame lfetl()s2tr(r ;u0teeoioeiytla elnvs u4aleniocoadlmtr n il(0teto(r nu1ope  fet s  2tmxr oo0alxnifctltfa eanmp t) rxrxr3tatfm  au o s  rxmio3iudlpenlncslt)sDra( o;t1tltoii3ildlaDul( pnu0 exnmfcio1fatraies;s)teuo(r ny1lp elncs t  2rrxr no1opto oetlsfm el(vo u0tlxnmo oytlm elneo;s0 2urxrpnu1llee iesls)aruaxr ;o1apxn feils aDeau s u)tlxnxrctatoa  li olt srumxopno1ap emiet t) ruaxmpoo1oex  f3iat s umums;(4 reomo io1faDranvslt)tetrir nu4alt  nesas) 2umx  ;o1oee mf3iydfmDuauvon(4artrxfciy1lm  aieo;t sruo(o nodamt lics ()aDumuronu1tpxo ocias mDelnvpnu)arxnmo totoa r ieols)s2urxm nodop n nes tfaDrr(rp;u4tet iictyt m rlumon(4trenmo oadoa  lnvils0s2trxr3nu1lme  ici ()arrrxrpoo4tpxn f3tldlmDranvpnt0treoifciodfatr uei;s texm(rpiudolt  fei () 2rrxr oo4altnmfeiys s2em(vo;t0 exnmr3tytopt aivsl( trtrim ou1lmtnlfvtasf rtrump;t0oex mi3tldlm umnvs;()aetrmfcta1omDrlues (0sexrxrpio4am  mneils)srraurp;o1ole mictatla2ra( s t0tltoxr3oodlmDrauvi;s0 euoim oo4ol  mnct sf 2umumo;t0oet ii3iatlm rlump;u)aeeoircoy1fm r nes;()srxo(r3oydopt  netlt) 2tmx oot4tlt  i3iaslsDemn o;t0trtnxf3tytoaD luvo s)sruo(mpoudlpte ncs ( a2tax oot1apxo oeiadfa2eln onu4arermfciydlpDe uvi ( t2xo(opoy1om nmnvs sfsrra(ro;u1oee  feiadfs elnmont0 rtomf iydlptraneo s0 etoxr3iu4ale lfeias)arum(  ;u4tlenifcilsla2ulu p;(0teeoif tatlmt aueo t  ruoio3oy4am emfei () Dtaxmp;t1olenmiciytfs rluvsn() lxnxf3tadla rlivs t) 2urimpnydam elictls s2uru  ou1tpxniicildls ean s u4alxrifcoa1oaDeli ils)sruoxrpiudap  mneiasfsDum(mooo4aleomfciytlm ra(vp;(4trxoxf tytopt  nvs ()t2umxo3no1open icta(faDrrurooo1optomo3iasfa umuvo;(0texrif3tydfpDraieilt0teur(o nudapenmncsasf 2urxmpoo1aetoioeiysfs ul( p;(0texrxo3iy1opDrlnvsls) etmxr3iu1lpte nvtls)srraxmonu0opx mfciydlm2eanms (4 lxnir3tatfpDeanei;s)s2xoio3no1llte nvslsfs2ua(  nu0tlt micilt s2rmn snt) rtoirciytfa e u ilt0 eur(o3io4opeelieil()aDrmx pnt1tee  f3tytlaDeanmon()alxrxr3oatom rluvs;( srxmxmpio4llenlies (fs2ra(monu0tet if3iyt mDumnvp;t4 lxomf oo1o
\ No newline at end of file
@@ -0,0 +1 @@
+uei () 2toxm ou1op elncias)artmxmooo0opx  i3iyd mDra(mont0aeermr3iydlmt  ues;(  2tmxm oudlm nlnvs sf rum(  no1apeo feildla2rau o;t4 lerioctydfpD livo;t sruoxr3ny4ol e ieilt s2tr(  ou4apt mo3iys a rmump () eerxf oadfp rlieo;t) 2ur(mpoodlm e feta( srrrur no0ope mociydfsDel(von() reomoctadlp rlu o () exm(r3ny1amtnmiet sfaDraum ;t0opx io3tat a2rmn s;t4treoxo3tatom rlnvs;s  rtm(rpno4ap emieslt  2rmur ot1opxnmietltls2ea( onu)areoxf3to1opDeli ols0 rtrio3iy4om  lictlt)srrrx pnt4texo oetyd s rlump ()tltrmf3iytfmteli o s  euoir oo1ll  mncia()s2rmxmpnt4tee io3tld aDemu s u0artnxr3to1lmt  ues;t) rum(mpnu4lpe mnetas sDra(  oo4tlt mfctlsfmDua( p;()aexnir3iytlaD lnei s0t2tmim io4ap  mfcia(fsDuau p;t0oleomfetyt a rmn o;u)trenxf3ia1fat  i s;t t2xmxo iy1lle  ics sf rrmu pnu1tpeomfcildfa ua(msnu4tetoir oydomtelnes;t0 etm(mpiydlptnlicils)srtrxro;t0oex ifeiat m emn pnu4 etrmrctotfm  li il(0t2trxm3io1om   iesa()aDrau  ;o0oex ifciys s emumon(4teeoirciotfaDrli s;t0truo(r iy4alt  fviat)aruru o;u4oltoii3iytlsDraumonu0 eenmfctatoatelueols)t2ur(rpoy4olenliet tfs2tm(  no1alt  fetasfm elnmp t0trxnio oy1fmt  uvs t)s2uoio no4amenlivtatfarumurpot4tpt  fetltla ea( o t)altnifcia1opDr ieo (  etmiopou1lm elnvias  rtmuro;o0apeoii3ias a rmu snu4aeeniocootlm  luvi s)sexmir no4lpt lncilsf 2tmur oo4ape ifeiadfa2elump;t4 lenir io1la eai s (0teuo(mpnu4amee netat)aDrrxr nt4aexn o3ild aDrmnms;() leniocty1la r nes;(  rtm(o nu4aptn icias srrru o;t4tlen ieiasla2uan o;u0alxnmf3ia1laDeaivi;() etm(o3io1lltelfvi tfsrtmxrpnt0apto ietyd s2eau sn(0 lxoxfctytom   ivs t0teumxm iodoltnmivta( srrmu p;o1openmfetadfs2rlump (0 rtoir tatomD lneslt0t2trir no1omenlics (fa2ra( pnt1alt  octldla2rl(vonu)areomo io1optelu o (0sexrim oodllteliet ( arta(  ;t0opxoioeiysla uln s () lxrxfctydfm eli s (0srur(opio1altn ics t  Dtru p;u4opx mo3ilsfm2ran pn(4 eenmr3tydfa eau ol()t2umio3iodalteliesat a2urxmoou4tpxnii3tatlm2ranvo;t)trxnif3oydoateluvsl()t2ur(opno1alt  ncsa(fa2ra(m nu4tpxn o3tltlmDeauvp;()arxnxf tydlmDelieo;t)s2trir3iu4alee fctasf Dtmx ooo1altoii3taslm2umnvont0 rtrmfctadfatr u s;t0sexo(m3oo4ol  micsls arra( o;o4tlt if3iat a rl(mp (4 rxrmr iatfptelnes;t)trxoio3iudolt lneils)s2tr( ont1olxnii3ildfsDrm( o t0 rxrxr ia1fm rauvi s0sexrim3oo1am nmfesa(f 2um(moou4olto ociltlsDraums t0aexoif oatfmDe uvi;(0srtrim3iy4optnlfeiasf 2raxmp;o4openmi3ilsfs2uaums t) ltrmfcoytopDeln i;t) 2uo(r io1lpt  nes sfsrum( oot0oet  oeiatlmDranvs;(0artoxfcoodlp  lnei ()trxmxo io4ll  mnviasfs2rrxm oo4oet mo3iadfaDuau o;(0 etrxf tytoaDraies;( seuoxopiudlmtn ivta(fsrta(rpnu4tpxo ictltlsDranvpnu)teerxr oatop   uei;t s2xmim3iu1ol  micia(  2um(r oo1tex  octldls ea( o;u0artrmfctadoaDe i o t tetoio3oydlle lfcsas)srraumoou1tptoiieiasfmDrmn p u0teerxo oy1fa e n s t0teur(r ou4al emicias arua(  no1aptnmfctld sDelump;t)trxoxocoodomDraneol()t2tr(m3iudop n fvi tf Dtaxrpoo0tleo f3ildfm ea(vpnu4artnxf oytopteaivs t)t2xoir3ou1lp e fcias sDtaxrpou4apxn ociydlm2raump t)areoxrcoadfaDe uvslt0 2umxm3no4omen ivta() 2rau  no1olx io3tlsfmDea(vsn(0 renir3tydomD aies;t srxr(o iy4al nlivs t srraxrp;o4tpx mi3iytfm ran s;t4tetnmfciotopD aivo t0teumimpiu4ap nmicslt)aDtru p;o4olxomoetytlaDua(vp;u0teenif iodoa elueolt sexrir no1opeelictls  2ua( o;o4opeoif3ild aDrln p;() ltoio3oydom e nvs s0 2tr(mpiy4ap  lfvi ( sDtaumoou1tpxoifeilt s2emu pnu0areoir totomD  uesls0 rxmir io1olt mfvsas)a2uru ono4tleomociyslm umu p;t)altoxrciadfat ln il()srxmxr3nu4omt  icia()a2ururp;o0optnio3tad sDumn p;t4 etriocoydfpDrlneilt)t2xoir3nu4ol   ietlt s2rru  ot1apto f3iadlm ra(mon(4aetrirciotlmtrliesls truoio ou4lptnmivt t) 2tmx  no4altnmieiys s ulumont4aetrmr tadfaD livi (  euoirpnudlpe  nesat)a2rmx  nu1oexniictlt mDuanvs;u4texnif ootfaDrluvs;(0 etoxmpou4lmenlivtasfarrmx oot0aex ifeils aDuauvs t0 exoxrciadfaD anvo ()teuoiopio4ap e nes t a2raur ;u4opt ifetltlm2rm( snu0alenmo oy1lmteli i s) rtmir oudoptn fesat sDuru pnt1opxo f3iadfs rluvs t4trxoxf3io1la   n sl()teuoxm3iydomte fesa(faDuaxront0optn oetys m2um( sn(4tleoir3ootlp eaieslt  eum(m oy1ole micilsf 2rax  ;o0aet iiciysfa2elnvp t0 eeoiociotoatrlueo (  rtoir iydol nlfesl(f rumx  nt0tlenifctat a2ea(vpnu4aeenxr oy1lmDrln i (0srtoir iu4ope  fcta()srra(r ;u4alt  octls m2ra(mp;() exrio oa1lpDrluvo ()tetoim iy1ame lfvia(  2tau ono4oexnmo3iatlsDeau o;t0 exomr3oydfpDrau olt  ruoxr3iydape liet t  Dtmu  ;t4tltn i3ilt s2emnvo t) rxrxr3oytoaDean sls)setoxr3nu4aptn fet s srumx  nt0optn oeilt mDeanmonu0 exrmr iodfmDe n i (0t2tm(o3nudale mnctlsfsrra(mp;o0tle iocilsfaDuanvo t4areoif3to1oa eliei;s  rurimpny1ape  neilt)aDumx  ;t1altnmfeilsla2ra(mo;()aexnmr oy1laDrauvs ()t2ur(r io4lm  mnetas)s2tru o;u1opeoifciltlsDuanmo;t0tlxoif iatfmtr ivo s  exoir iu4altnlfcilt)a2rr(r oo1tex  feiatlm2rau p t0treoxf3ta1fpD lu i s0s2tr(o no4ap e ncia()a2tru  ou0olxoiocilt a2umnmo;()texnirctodlatelnvsl( trxm(o3oo4ap   feiltfaDrmxrooo4tpxoioeiat m eanvpnu0tetnmoctadomD  u s t0t2tr(m3no1oleemfeiltf rraumo;o1tetn icild aDum(mp;u)tlxrmocootfpDr uvols0truoir ny4ap  mncs sf 2umu  ot1oexnii3iatls2emuvpn()treoxo oytfa  luvi;( setoir3oudopeemncil()sDumur no1tpe  icils m2eln on(4alenxfctatom  aneslt0seto(r3nydamenlies (f Duru p;u0oeeoif3iydfaDuanvon(0 eeoxr tatomteauvol() rxmir no1lptnlfcslt s2ta(m ;u4ope  ieiytfs2ul( s;u0teeomfctytfpt livol(0t2xoim3nodape  fvi s  2taxro;t4tpe  oetldfsDrl(vs u4 rxnio3oo1oa r i o t0 rxrxmpno4op   ivsa()srtau onu4apto o3tldlaDel(mo;t4 ltomo oadlptrlnei;t0srumxo oudlm n fcilt)arrmur no4tex  ictltfmDeau ont)artomfciadlmDelnvsl()s2uoio3iy4lmt  fcils  Dtax pou0opxnmieiyt s2elnvpnt4alxrxfctydomt lneo;t texrio iodaltnlnetas)srtaxr ;u4apxoiieiytfm2emump (4 rxrxo3oy1fa rlu i (0 rtmxm3nu4lm n neiasf rrau  ;t4tlxnmo3iys a2uauvs;t4aeermf iatoatrlueo t) rum(o ou1lmenmfetasfsDur(m ou4olt  o3tatlaDumumsn()arerircoy1fmDraueolt0 rumim oodope mnvils)s2ur(mp;o0aet  ociytfaDrau o;t0trtnmfciytoaDe ues;s)sexoxm3iodame mneslsfa2rmxrp;o0opxniocilt s2ua(vont4aeenio oytlaD auei;s) rurxo3oy4lmtnmncia( sDrm(  ;u0apxn feiydfaDuaump u4trtomr ootlp  lueils  exm(r3io1am elfci ( a2umu pno0alenmoeilsfs2ean p;t0tlxoxfciadfmDraiesl(0t2trxo3ny4optn netlt)aDrax pnt0opt  feiltfaDulu p u0aexoif3iytlpDrlivil(0t2toxr3iu1om nmieil()aruaxm no1opeomi3iasfm rln s;t)trxrmr3io1lptraivs;t0 rumirpny1openlnvi tfarra(mp;u1opeoii3iaslsDeanmsnt0altrxr3totlmt  uvo t0 euo(mpou4lpenmiesat)a2uau pnu0oeeo i3ilt aDranvonu4 lerir todfmDrai o;s0teuo(rpnudlm nmnvsa(fsrtrx pnt1tee  ietld m elumont)arxrmr iytoaDeai ilt0trxr(m iy1oltelicsa( srrm(r ;t4aleo o3ild sDrmn pnu)tetomocta1fmDelnei s0sruoimpou1omtelicia( arrau  ot1tee moctatlsDuau o t0aeenirctatlm r ivs;t0seuoxo3ny4lm elfeia()a2trxrpno1alx  ieiasfs ran p;t0 rermf iodoa eanvo;t)s2xmxmpny4op nmfes ( a2ua( p;u0alen i3tydfm eluvpn() leoio3oy1om raiesl(  etr(m3iu4ll n icsltf rrrum oo1tptoiietasfsDea( s;(4teenxo oodfmteaivo s)t2um(o3iy1lpee ivsat)srrmxmp;t1oexoiietydfm uluvs u0tltomo3ootomD an o;t  2umxo ny1lmeelnetat)srumump;t4aeenifctad m2rmu on(4trenmf3oytlpDe i s;t0trtmio iu1oltn nesas) 2tm(rp;u4optomo3tas s elnvsnu) eerxr oydfptelu sl()t2uo(r oo1lleemneslt sDum(r oo0aexoioctatls rau o t0aeenif3ta1om   ivol( srtrxopoo1lpee icils)aDuax  ot0aet ioeildls uauvs;(0aeerio3iy1lpDraieol()s2toio3oy4lptnmnesat)srumumpoo4oeenioeiadfm2ulump;u0 leomr3tatlpteau i;() 2xrxo iydlp emictl()aDtr(m ;o4apto i3tatlmDra( o t0alenxoctadoaDrlueils0 eurxo nu4lp n ncsat) rtmurooo1aeenii3iytfa2umnvp t) rtoxf iodfptr ivo;t t2urxm iu1optelnci () 2ua(mpot0alen fciasfmDuanvsn()alxoir3iatla elivi s  rto(opny1omtemnei sfs2rax pot1aex  oetas a em(msnt)aeenmf iytlm   i s t sexr(m3oydalte ictltfa2umxr ;o4tle  ieiydlm2rl(von()teerxr ia1omDraies;t0 exmimpnu1am nlfei ( arta(r no4texomo3iadfa eau o;t0tlenxr3oytop   n ol(  2to(m3iy1lmee ietl(f rraum ;u1aleoifcildlm ea( on(0artomr oa1latr i ils trtmxrpiu4al  mictat  Drm(r oo0teeomo3ild sDulu on() eenir tytoa  aneo s)s2xrxrpiu1am e ivt ()a2rruronu1aee mfetytfmDrmnmo ()alxoircoytlmDr i il(0trur(mpoo1ome lnctlt) rraxm ou0alxomi3iad s2eln snu0texrxr oatfa raies;t0truoxr iy1lptelivi t a2tmxroou1teenii3tysfa emums;(0tlxrir3tatoaDe uvo;s)trxmxm iodlme lfes s aDumumpnt0optn iciatlm2elums;u0artoir3iatopteaieil(0tetm(m nu1ol nmnesa( sDtru  ;t0tlx  oetat m2um(vsnu4tlenio3oytopt  uvs s0tetrxm3iudapt  iet t)aruaxr no4oltn ociadlm2rmnvsn()aexoifciotfatraieo;t) exmxm io1ole  ncil()sDtrxmono1opxn f3iytlaDeaums t4 reoxo iadoaDr ues;t sexmxr3oudlm nmieils)srtrxmont1oltomo3ilsla ulnvp;t0tleoxfcoo1omt ln i s) 2umiopnodaltnmneilt)arumxmo;o1oee iociys s ea(vo ()tlxnif to1fm rli o;s)srur(rpiu1ope  ncsls) Dtru  nu0aleniiciasfs2umums;u)aetrio3to1opDe n o t)teumxopno1olte fvtas)sDtrx pnt1tpx iieildfsDelump u0treoxfctodfmtrlneilt)t2urimpio1lptn neil(  rum( poo0alen f3ilsls um( o;u4altnmr3tatlaD auei t t2xmxo3iu1lle lneiatfsDuau ooo1tpx  i3tyd mDea( o;u) etnircoodopDranesl(0t2toxo3iudlltemiesl(farua( pnt0oexo f3tld m2umnms;u0tleomr3iydop  lnesl(  rxo(o nu1altnlnvsat) 2tr(mpoo0olenmfetlt mDul(mo (0tlxrxo3totoptean s;t)setriopnodop nmieil(f Dumxrpnu1oeto ieils s em( ont) ltrxr3iodfmtr i olt0seumim iu4ll nmnvi (f Dua(m ;o0oltomoeiydlaDul(msnt0aleoircoydopteai ils0setmim oy4amtemfet t  2ra(m nu1olto o3ils sDrl( p u0aeenio tadoa rliei t)texr(m ny4om  mfes ()sDra( pnu4oeen ieilt s elnvsn() eerxo3ootfa rln i s)s2tr(o nu1om   icsasfsDurx  oo0aptn ociat m2el(vpn(0aexnmf3oa1lpt an o;(0trtrxmpoy1apen fei t s2uaxm ;u4tlx  i3iadfaDranmp;t4 rxrmr ootlp r i o t0trtoio3ny4am nlnesl() 2urx ooo0tle mo3iys m eanms;t0altomo3oytlmtranvs s0tetr(mpiudaptnlfci (farrru pnu1optnmfciydlaDumnvsn(0texrmf3iadfp rln slt) exrio ny1lle lnvtlt aDua( ooo0ole io3tlslaDemu p;t4 lxniociatlpteluvo t0teumir3nodlltn fes s srrmxmo;t0olen fcils s uluvs u0 lxoxo3ta1omD li s;( s2xoio nu1am  lfet s)a2rmu pnt4tleomicild s rm(vpnt4tlxoxf to1fa  au slt teumxmpio1ale  ieiatfaDraxmono0optnifeildla2umnms;()trtrio3iotlaD au sl( t2to(m3oo4lleelfvia( srrrxront1oltomieils aDuaums (0aexnif3oatoa  aies ( srurxmpio1lleelivilt srrmxr ;u1tltomfcildfa rl(vs u) eeoifctydla rlneo s)trxr(m3iydlm   ietlt)sruax o;o1apt ifetldfs2uauvp t)arenmrctatfat  ieo t t2xoxmpoo4ole mfctat)aDuaxm no0olxnmo3iysls2ulnmo t4trenmrctotfpDean ils) exrxm nu1oleemfetls a2tru pot0aexnmieiytfa2ua(mo;t)teeomr oydoaDrlnesls)texrxr ou4omt mivias artmumpoo4tle moctyd m2ua(vs;t4 lxnmr iatfat  nesls0 euoxr io4ol nlfvi tfaDtaurpno1aeeoiietls s2ua(mo t)tleoxoctatlmDean o t0setm(m3iu4op   fvta(farrmxro;o0tltomi3tlt mDeauvpnu)aetrmf3ia1om eaies;(0setoio3no1am emfvia()srrmx  nu1oee  o3tad a2em(vpn(4trxomf to1fmt li s;()trxrio3no1lm emnvtltf 2urxrp;u0oee iicildfa2emnmon(0tltoircio1la raieils0 rtoiopoudam elivtlt  rra(m nu4tpxnioeildfm ul(mpnt4tleoiociotop rauvols0t2xrxopnydlpt  nvs ()arur(mpnu4oleoioeiyd mDran p (4tleoxfcoa1lpDr ueo s  exrio3oo1am emivi tf rtru oou1aeeoiictydla2rm(msnt)tetrmrctydomD anei;t0t2urimpoy1ll  mnctas  rua(roou0tee mi3tyd s eln o;t0 rxniocto1lptran o;s  2xmxm3iy1lmtnlfvs s  2rm(ro;u4tex ioeild a rlnvsnu0trtniocoa1oatean s;( t2xoim3iodopee fesa(fsDtmxm ou0ale mfetytla2ua(vo;t0tlxnif3io1faDeliei;( t2xrim3ny4llt mfct (f Drrumpnu1oexo ietld a eanvp;()aetnxf oo1fate ieo;( s2ur(o iy4ap n nesat s2ra(rpou1aetoio3iytfm2rm(vs;(0tetomfciadop r uei s0s2trim nudlptn fct t) 2urxmono0tlt if3ilt s2emumont)arenxf3todlpD an s;t0sexoxrpnu1llee fesl(  Duax ono4opeomieiaslaDemnmont0arenmociadomteaneo;t0s2to(r3iu4al  mnct (fa2trurpoo0oee ii3tytls eluvp;(4 eeomo io1fpDeauei t srtoimpnydaltelncs (f Drm(m oo0alenmfetltlaDua(ms;u0 lenif3ootfaDr nei;s0t2toio ny1lptelfctltfs2ua(rp;t1oeto ietldfm umnmonu0tlxoif3iydomD aneo s0setmxm no1apen iei tfs2um(mooo4tet  ociytlm2ra( o t)artnmr oadfatelnei;s)teurio3ny4ape lictat)aDtru poo4olt mi3iytfm2rlums t)trtoir tatomtr ivi t trurxm iy1optelfcsls) Drr(rpnu4tpx mfciat a uau ont0texrmf oa1oaDelneils)trxmiopiudop  mfvsa() rrmxrooo4oeen feiaslaDraums;u4aexnircio1lpDe i o;s0s2tm(mpoo4am elici s)a2rm(mpnt4oexomo3iatfsDrluvsnu) lxnmoctatlm eaivi;(0 2umxm3iy4omen nvsatf Durump;u4ope mocild a umu s;u0 lenif ootoat  i slt s2triopoy4lmee ivt t  2uaurono0tptomi3iadfs2elu s;t0trenmf ty1om rlnei;s)sexmxopnu4ap nlncsas) 2uaum nu0tltomfcias a2rmnmp t)teerif3iatlpDe uvolt)srxmxm3iu1lltnlnci t)srtaxr ot4oex  f3tatlm2rmnvs;t0 etrmf oatlm ranvi;( t2tmimpiu1op nmictl(  2ta( onu1tpx iietys a2uanmo;t0treomfciydlmtrlu s;t)teurxrpoudomte ncias sDuau o;u0olxnifeiat sDeauvon() ltrmfctadlpteaivol()teurimpny4ap  mfesat)s2uau  ;t0oet ioeild m2umuvp;u0arenir iy1oaD  uvo ( trur(o3nodapee net s)aDrm(ront4aexo f3tydlmDumnvo t)areoxr3iotopDeau s;s) etmxopoydoptnmnvsa( a2rm( p;o4apx if3iyt a2ua(mo;(4tleomocoatop raieslt0teuoir3ny1ol  mivsa( srtmxmpnt1opeomf3ild a2um( o t) exnxociodlmt aieolt0seum(m3iydale  fvi t)srtm(  nt0aexomieiadfa ra(vsn()tetnmo tatoaD ai o;s)srtoimpnydlp nlnvta(  2ra(rpno1alen fetydfmDeauvs t4aeerifctadfpD  uvi t0 2umimpiodom  mnvilsf Dum(r ;u0oeenmoeias a2rau snt)alxoxo iytfatrliei;t)s2toxrpoydoltn ieia() Dtrxm oo4alx ifeilsfa2ul(vonu)texomrcta1oaDeliei s  rxo(m ny1oltelnet (farum(r oo4olt  iciltfs uluvs u0 etriociatfmt lnvsl( t2xo(m3ny1ome micia(farrr( o;u0tpen fetlsfm2uan o (0trxnif iotlmDr ies t t2urxo iy1omtemivt (fs2tau  ;u0oeenmi3tatfmDeaumo;u4tltriocoy1om  anvi;s0setrxo nodlp   fcsat  Dtmxmpoo0tlen fciyt a ea(vpnt0 eeoio3oodlaDe ies t0 2toimpiudome lnes ()aDururpot4alenmieiadfmDra(mo u4aeeoif oa1opteln s;(0 exoxr3ny4om elfeta(f 2um(r ;t4aeeo ocilt aDumn s u0alxoio3oytlpD  uvils0trumio oydlm  mnet s)srumx  ;u0openioetltla eanmp;(4artrmo3oodomDr uvo s0trtm(rpnodol nlneils sDua(r nu4alxnmfciaslaDrauvsn() rtomociadfp eaivols) 2xmxmpiodomeelivta( s2rmurpnt0olxn octys m2eau p;t0 eermf ootoate u s t tetr(r oydlmen fcsatf 2tru p;t1tptn o3iltls2eaums (4tltrmr oydfpDe n o ()t2xmim ou4lm e feslt)a2tmxmono0apenmoetatfmDua(vp u4arxrmf ta1laDr neolt teuo(mpoodlm nlictlt) 2tm(  ;u4oexn i3iysls emnmp;t)areoxfcia1om eauvsls0setmxmpiydlmtnmics sfsrurumoou4apt  iciysfs eau onu4 rxnmf3iotlp rli i;s srtmirpnu1lpeelncs sfaDtm(  ou1aex iicilsfa um(vs;t4texrif tydlaDelueo;t t2trxo oo1lptn iviasfaDtrurpnt1apeo feild a ulump;u)trxrxo iytfp eai s;t0 exoxopiy4lpt lncia()aDrrx pnt4opx mi3tat sDemnmo u4alxniocoytomt aies t s2xrxr iudole licil(fsDrmx  ;u4tlxoiiciltfs2eanvonu)texrircoydfa raivo s0srtm(o ou1al   nei ()srra(r ;u0tet mociaslm2ul(msn(4teenxfctydfmDe u slt s2tmxo nu4amee ictltf 2uax  ;t4oltn oetytls rlnvs u0aexnmocoatfmt aues;t  rtrimpiu1lp e ncslt  rtr(rp;u0aeto fciad a2uauvo;(4 lermo3totlmD anvo s trtmxm3ou1apt lnct tfaDur(moou0tetoio3tlt a2umu o;u)tetrmf iatfa  luvs;t) 2xrimpno4ome lnvsl( srurum oo4aee moeiatfa uauvp t4 reoio3oydfm e ueil(  etm(r3nu1oltnmnvslsfsrua(ronu1opxo o3tadfm uanvs;u0tltoxr oy1optrauesls) 2uo(r iu1ol n ivsltfa2taxm oo0aet miciad s rmn onu0 exnxf3tatomtr neo s0texo(r3iu1om  lnviasfsrum( o;o4opt ifcildlmDeanmont) exnmr3ia1fp e nei;t) 2xr(mpoodomte iet ( sDta(mo;u4tlx ioeiaslaDelnmsnt4 rxnxf tydomDrau o t)s2tm(o no4al elfes s)arrrx poo4oltnifeiasfs emnmpnu4 exrxr3io1fateln o;(0t2urio nydameemfctlt aDtmxr no4aeto feiadfaDuanmsn(0 lerxr3oadomtrliei s0 etmxmpny4ol n ncs s  Dumum ;u0aleo ieiat a2rl(ms (4trermo3io1laD  ivol( truo(mpoy1aptnlnctl()artrumonu0oeeo fetytlaDuanmp u0 leomr oydfmtr ivo;t) 2uoir oo1amte ncsl()s2rmx oot4oet iietydlsDranmo;(0aeermo iatfm r u sls t2xoxrpiudlle mnvi t) Drmx onu0tle iieiltfm elnmo;t)trtrir iytoatr uvs;()t2tmir3iudop  mneiatfaDuaxmoot4tpxniieiyt s2rln pnu)artoiocootom   ivilt texrxm oo1lm elfcia(  rtaxr ou0aptniieiad s2eau sn()aexoir3ty1lmDrlnes t)teuo(opoudll  mncilt arrm(ront0oeto iciat sDea(vo;(0 lxomfcty1laDrau i s)teuo(rpiu4amt  ivs ()artaumpnu4tpt io3tldfaDulu s;(0teerxf iy1lmtrlnvs;t0 2xr(o3nudop nmivil(fsrurxr ;t0tee  ietysla2eau p;() exoxr iy1faDraues;t) 2xmxmpoudol n ieilsfsrua(rpnt1opx ioeiyt a2eau o () ltoxo3iatomt ai sl(  2uoio3oo4aleelnvsatfsrtmu pou1alen o3iydls rm(msnu0teeoxfcto1lm rluei ( trtoirpno4lle  ietatf 2tmx  nt0oetoifctltlmDrmnmpn(0texomfctytom e nvi;(0 rur(m3oo1ll   fvi t sDumu pno1tpxnii3iasfa em(monu0alerxrcoytfmDeaivsls0 exmimpnudoltnmfei s)sDta( p;t4apxnif3ildla2rln s;t) ltnxo oatfmD  nvs t) euo(opnu4al  mnciasf rtauroot4aeeoifctat m2um( o t0tltnmfctodomt aneo (  exrxm3nu1altelnesl()sruru oot0apeo ictadfmDraump t0 etrmfciotopt  uvsl( texo(o3ou4alenlivias aDrrxmoot0aeenmiciydfsDem( snt4 eerxr iy1lp  lnvs s) 2umir no4lp nlfesls s2tmur ou4open fciasfa eln o () exrif3tadomDe neo;s teum(m oo4al nlnetltfsrrrxm nu4olenifetys a2elnvp;(4 exoxo iotomDrauvo t)sexmio nudol   nctl()s2rmurpnt4tptnmi3iytlm rm(mp t4tetnxociodfp rli il(0srurxrpnu1om e ivsatfarrmxr ou4opeo f3iydlm2rmuvont0 ltoxf3oytomteli s ( srxrxo3io1omen fct s)srum(m nu0tpx io3tas m el(mo;t0tleomr tatfa r i i;s s2trirpny1lm elfvtltfsDra(mono1tetniociatfaDelu s u)alenmo oadfpD au i;s)srxr(mpnu4am e fvt tfsrurxrono0tltnmocias s em(vo (0trermr ia1oa   n s;s  ruriopoy4ol emiet t aDumx  ;u4tpe mo3iasfa em(vs;t0alxnxr3oatlpD  neils0s2xo(o oo1amtemieils) rumu oou0apxnmoeiytlsDrau o t0 renio oydfaD  n s;t  2xoxo3iu1om nlics () Dta( poo0aexn ictlsfm ranvp (0aetoxo3tadom raieols srtr(o3iy4llee feia()aDrrx  ot1aptomi3tlslm2eauvs t)tlerxo3todopDe uvs s t2um(o iu1altnlnvslsfaruaxmooo4aee mo3tldla uauvp u)arxoxr totfat  ueo s)trur(r oo4lpe lnvt t)srumxroot0aleoifciys s rluvs;u)artnmo3tatlpDe uvo;()trurir3iy1ameemfei tfsDrm( onu1tpeoio3tys s rmumsn()tltoirctadomDelnei s0trur(rpiy4optnmnct sfa2urxr oo0aeeo feilsfa emu pnt0 etnirciotfpDraies;()srxrir oodap e nctas sDuax ont1tlxnii3iadlmDran onu)teerxf3tydfm r uvi;s0s2trxo3iydame lneias)srumx  ot0apeo fctyt s2el( p u4tltrmrctatoa rlu s;(  2tm(r3oudolte nctltfs2rmx  oo0tpxomieiydlsDulu s t)alerxociatfp  lueo ( srxmxm iudapee nctlt sDrmxrpot4aet  o3iysls2uluvo ()artoifcootfmD aneo s)s2xmirpnu1op  miei sf Dumump;o4aeeomoctytls rl(vo (4 lenmr totlmDelieo;t texmimpou4al  lnct () Drrx poo1apx ifcils s2uluvpn()tetomfcoatoa r iei;s t2xm(r3iodlm emfct t s2taum nt1tpxnif3ildfsDuln p u)arxnirciytlp rai olt)t2ur(o oo1om elfcs ()sDrmuront0oetoii3ils m em( s;t)tltoircoytla rlivs;s)tetoxmpio1om nmnvt ()aDrr( o;t0oetniieiadlm2elu o;u)texoxo oadlp   nei t0srxoim3nodlptnlfvias)srtrxmont0aeto i3tltfm2el( p u) reoxfcoy1opDeli s;(0 2xrxo3oy1apeelfctatfa2rm(rpnt4alt iiciadlm2ean o t0 exnif3iy1fmDr n ols) 2toim oy4amt  fetlt)s2ra( oot1apeomoctlt m2ulnvo;() ltrxo totlat  ivo (0setmiopnydlp  miciltfs2rrum ;o0optnmfcias s2rlu pn(4trenxrcoatop r neo t  2xr(m ou1optnlnvsa(fsDur( oot0opx  fctydlm2rl(ms;u4artrmf3to1oatraivolt0 rur(m3iydamt licsat  2uaxmp;t0teeo f3iasls uaums;u0aeeoxfciytlptraivs (0 2xrir oy1llenmneiat  2trumpno0tpeomo3tltfsDemumont0trxrio3oo1fmDr nvi;s seum(r3io1lle lnvtl( a2tmxmo;t4ape ii3iltfsDel( s;t)altnmfciadfm rli ils  rtrir3nydolt mivt (f rtm(r nt0tle  fciys m elumo t) leriociy1lpD  ivo (  rxrxrpou4omt  fesl( sDtr(  nu0opxo fctadls um(ms;() rermfcoa1omD ln s;s srtrxm3iudap elfcsasfartm(moot1openmieias aDuln p u4aetomr3iatfmtraivsl(  rxmxm3oo4lp  lnvsls  rtmxmoot1aee mo3tasfaDrlnvs;(0alxrmrcoy1lmD lnvo;(0sexr(r oy4lleelnviltfsrrrump;o4ope iieild a2rau snt4 lxoioctadlp  an i;s  rtm(m3iudoltnmivsls)aruru o;t1tetnii3iyd m ra( o ()tlxnmo iy1lm e n ils)teuoxrpnodap elici ()s2umxmpnu4olxomfeildlmDulumsnt)trenir3tadlptrlnvsls0sexmim3no1lp  livil(farrmurooo1oex  fcildfmDelumsnu)tlerxfcoodomDr ieil()seur(rpio4alt  nci t s2ra(mpnu0apenmo3tas mDua(mp t0 rxnmr3iatfmDeau i;s0srtm(m3iy4ol e ict (fsDuau poo1apx  ociysfa uau on(0 ltnxr3iotfp eliei t)trxrxm3iu4lm  lfviatf 2tmxrpou1opt  i3tytfm2elumo t4tlxrxfciodom  anvi ()srtm(r3io1lpeemnvsas)sDua(mpno1olxniieiaslaDrmu o;u)aetomrciodlpD  ieolt) 2xm(m3io1lmtn fctatfsrumu oot1oltnifeiydfa2ra( p (0trtnirctotlaDrau o ( t2uriopoodame mnvsat srrru pno4optoiociytfs2umnvpnu4trtoxo3ty1fatr ieo;t  2tmxmpoudapenlics sfa2tauroot0olt mf3iltlmDrm(vpnu)altrxo oa1fp  li o;s  ruoim iudameemiet ()sruaxr no1oeto iciatfm2ul(msnu0 ltnxo tatlmDrauvi;t  exoiopiy4amtelncsa()artr(m ;t0tptn ociadla em(ms u0aleoxo3oodlm  auvo;t setr(rpou1oltn fvs ( s2rau pnu4opx  f3iad sDea(vp (4 etoir oatomtelnvs ()sexmxopiudalee ncs s  ruru p;u0tpt ii3iltlm2umumsnu4tleoif iydom rlneo;t srtr(rpio4lpe lfetls) rra(mpnt4tet moetld s rm(vsnu4trtnxf oadfatrluvol() 2xrxo ny1lpee iet t) rrmu o;u1apenmfciys a eanmo t) eermf oy1lmD  nvo;s) 2to(o io4lpe lfesa(fartaxmo;o1apxn o3ilt s rmu s;t4teermf oatfaD  nesls0tetrxm oy1opeemivtlt sDrm(rp;t4oexn icild m emnmp;u) eeoxf3iydopDean i ()setrxmpou4alt lfcs t arrax oot4tlx ioeild sDrm( p;(4arxnxf ta1opDrlueo;t) exo(opoy4ope mfesas)s2um(rono4ale  ocils sDranms u4 eenxo io1faDe ues;t0srtmxr nu4amt  ncslsfs2tr(  ;t0apeomo3iatlsDrmnvonu4 etnmf iytfp rai ilt0sruo(r iy1ap n ivtatfarumum nt4alx  feiadfs2ea(vs;()aetrxo3tytla e neslt srtmio3iy4omee nvtlt)s2rmur ;o4oexn feild s2rm(msn(4texoirciytlmDe u il() exoxopou4lpte nesls)srta(r ;t4teenmo3ilslm umn snu0artoif ta1fmtrln s s)teumxr iudape miesat arta( pot1alenifciydls2umnmp t)areoircio1lm eaivils srtrxopoudal   netasfaDurxmo;u1texnif3iyt a em( p (0 eeoxr iodlpt li olt0sexr(m3ou1lleemfes (  2uaur oo4olen octydfs emu p () ltnxr3oodlmt auvo;s setoio no4ll e ivtls)aDumum nt4tpeomo3ilsfs ean p t)teerxo tydfmDe ueil( t2triopno4ale mnctas  Dumx onu0apeomf3iytfmDrmumonu)trxomoctadlaDrai s;t trto(opoy4lptelnvtat  rrrx o;t0tpxn feiadls uanvsnt4 ltrmr iadfpt aueo s)srxrxopoy1lpte ieil(fs2rr(rpou0aexnmfcilsls2rm( s (4aexoxr3tadom r nvs t setmxopiydop  lnvi s) ruaxmoot4ope ifctltlaDrmu s;t4trxrmfciydomD lneo t)trtmxm oo1ap  mfeia(fs2rrur ot0aexomietydlm2em(vsn(4trtrxo3todfat an o t  rxoirpiudomtnlnvsat s2trxm ;u1aleniieildfmDul( onu0 rtomfcoy1fpDe u s;t) 2toxm3ny4amtn ivia() Duaumont0tpeomo3iatfa ulu sn(4arxrmf oy1lpteanvi (0seumim3oodll n nvi tfaDumxm ou4tet  ocild m uln o u0aleoiocoodfa ranvs (0seumxrpny1opee fvt s) 2rr( oou1tptnmo3iltlm rln onu0trtnxfciodfateaueil(  rxo(r3ny1amenlnviat aDrm(mp;o1tpeo ietys a2rau o;()trxnxf3iy1oaDr neo;s  rxrim3nudolt mnct ( sDur(rpnu0tpenifetatfsDeln o t4trxrxr io1fm e ivil()seto(rpiy1ap emnvi (fsrtm(r ;u1aeto fciat sDranvs t) exnir3oa1oa eluvi ()tetoio oy1al e ivsl() rtm(mpnt1apenif3tytfa2el( p;(4altrmf3oo1lmDraues (0setmio oy4amt mfvi (f 2ta(rpou0teenmo3tls m2ul(vo;t0areoxf3oytfptranei t s2xoxm3iy4optemnetlsf Drm(  no1tet ioeiyd m2ulu onu0arxnxfcto1oa e i i s0 eumirpoo1alt miesasfsDrau oou1aetnifciat m rl(ms;(0 exnmr3iodomDe i i;(0sruo(opnydomtelneia(fs2rrxmpnt4tpxoif3tls sDemnmpn(4texnmfctodlmDraivols texoxr nydlmeemfctltfarumx pou0tpxomfeiltfm ea(vp t0 eenmf ta1lpDrai olt0 rxr(mpiu1optelfeia(f Draxmpnu4aetnioeiytfsDel( s;(0 etnxfcoy1oaDeaivi;t)tetmirpiy4openlfei sf Dumxro;t4oeenio3tytfsDuln s;u4 ltrmoctatfpDr u i;t) 2tr(o oydapt  fcsa()sDtrumpno0ole  ocilslm2umumsn(4 etnircoydomDeanvi;s) rxm(m3no1ol  lieiatfaDtr(  nt0tlxomieild sDul(vp;(0 eenxocio1fateauvs;(  rxoir3oydomt mfei sfsDtmurp;t0tpen oeils aDrmumo;u)trxnxrcoodoaDr n i s)s2umir3ou1opt mfeiat sDrm(r ;t1olen ieiatla ulnvp u)trtnif oodlp ran i;t  eumxopou4omeelicia()s2tmx o;t4tlxomoeils s2uauvo;(0tltnmrciatlmt  ueo t0 etr(r3iudal emiei ()arta(m ou1tltn ociltfs2rmn on()arxomo3io1fmtrln o () 2trxm3nu1optn ivia( srur( ont0teenmi3tlsfmDrlump u)alxoir3io1fmt aueo s0trto(r oodlme mfctl( aDtmu oou4oetnio3iys a2rmuvp;()teermr ia1laDraneo;t0 rumimpou4olt  fvia( srraur ;u1aexniictydfs ua( s;u4 exoxf todomD luvil( t2xr(mpiy1ll  lieia(fsruau onu0alxniieiatfa ran s t4aeeoxf3ty1optrluvi t) rurir iy4olenmnvsltfs2umu o;t4aptomf3ilslaDelnvsnt) exnif3oo1lp elnvi ( seuo(rpnu1ame  nvtls s2rm(  ;t1olxomoeiydlaDum(ms;(0 lxomrctodoate ieo;() exmio iy1aleemneiat arumx  ;o4aee ifetydfs2rlu s;u) rerir3oytlateaieo t0 2toio iudopee iesa(f Dumxrp;t0tpt mociys m ean sn(0tltnmf ty1oa  ln o ()trumio3iudom nlfetls) rrr(  ;t4aexnif3ild m2ea( o (4 ltrxocoadlmDeln i s0srurxr oodopeemfei t  rtmxr nt1teenmfetldlaDrm(vs;t)alenmo3iotop rlueo t t2trirpiudamtelics sfs2tmu  ;u1ape miciyt a elu o;t)teerirciodfaDranesls0 etoio3no4olt  netat)s2rmu o;o1apxn oetld m uanmo;()tlenmo3oodopte nei;s)t2xo(m iu1lp e nesa(  2umxmono0teto ieilt mDua(vp u0artnif3iadoptrlu o () 2umxo iu1aptnmicia( srumuro;o0aee  i3iasls2rlnvs;(0trxoxr3iadopt lneslt) 2xrxrpnydlm n ivsls) 2ra(m nu4tee iietytfm2umuvs;t4trtrxr iydomDelueo;s0trumxm iu1ale  ivt s)srrr( oou0aetoii3iatls2emu p;u)aetnmo iytfatean i s0 eurim oy4ape  feias  Dtaumoot1oeeoioeiydla2um( p (4aexomrcoo1fp  anei t0s2xo(o3iudom   ivt (f 2raxroot4tlto o3ils mDra( pnt)aeeoir iytop   ues;s0 eurxopnu4ol nlfvias)s2rrum ot0teto fctyt sDra( s;u)alerio oytom r uei t)t2ur(rpny1aptelncta( aDra(mpou4optniieiasfa2ean s;u) lenmo oodoaDrli o t) rtrim3oy4omee feil() rtmu  ot1tpxo iciatlaDra(vo;t4tlxomocta1lpDeanvi ( s2tr(mpnudopeemiciasfsDrmu ono1tpeomocilslm2uanmp;u0aetnxo3iodfmDe u ilt)s2ur(mpnu4lpe lnvi () 2rmurpou0oetoiiciatla umnmonu)aexrxo tadlaDrlu s ()srtm(r3iy1opte nctl(f Dtauroot4alx mf3iyt s2uanmont)aetnio oy1optrlu slt t2trir ny4optnmfei tfsDtm(r nt4oet ifetld s ra(vp;(4tlenxo oatfmtean il( sexm(o3oy4om n ict tfsDtmx  ;u4tpeoioctasfa2em(monu4aleoxr tatlaDr neil( trtr(mpoydal emietltfsrtrur ;o0apxn f3iydfsDemums;()areomf oo1fpD  uvi s0s2trxr3oy1opee ics s)a2rmuro;t4tlx  i3iys s umu o;t4 etnir3oydopDe iei;t) 2xo(m nydlp nlfvi s s2rrxrpnt1oexnmi3iat mDulu p t4arxoio3tatfatrlnvi s  2xr(o ou1ame  ietl()s2rr( oou0tet ioeiatfs2emnvp t) rxomocoadlptelu s t)s2xo(r3iy1oltn icsa()aDuaxmooo4oexo oeild m elnmp (4trtnmfctatfmt  i s (0 2trirpiu1lmte icslt) 2rmuront1oexomf3iydfm elnvsnt4 rxnmf oa1optr n sls trxmxr nudom   netatfs2ta(m nu1tleomietytfa uan pnu4alenmrcia1la eli s;t setoiopiu4ll   ivt ( srum(ro;u0oltniicilsfa ulums;()artniocoydfpD lueo t t2tr(r ny4apenlivtatfsrtmx ooo4teen oeiadla2rmuvo t)altoio oy1fpteauvo t)truoxr3oo1ol nlicsatf 2umuro;t1tpeomi3ilt mDumu o;(0arenxo iatlp ean s;s texo(mpiu1oltelict sfartm(r ;o4oltnmfeiltfa rlumo (0tlerxr totfptrluei;s) exoxrpoydaptnmneslt a2ra( ont4oleomoctldfaDrmuvpnt4 renmo3ty1lptranei s0trum(m3no4ap  lfcilt)aDtmx o;t0aeeomoetlsfm ulu pnu)aetrif3iatlpDe ivilt s2uoimpoo1am  liciatfsDuaumo;o0tptnmfctlsfa2um(mp;t0arxnxf iydomtrauvs;t0 2toiopoy1ol n feils  2tm(m ;t4tpto fetat sDeauvon()texrxf3tydfaDeaieo;s) ruoio3oy1amtelfetlsfs2uaxm ot1tleomfetysfaDulnms t0tltomf3oodfmt aneols0 exm(rpiydam e iesat)s2ra(r nt0oet io3ildfs2ea( p;t4 ltnirctodomte u o t t2um(o3oo4lp n fviat srua( ooo1alxnmieiltls rm(vp t4 reomfctydfptr nvol()tetrxm oodoleemnes t)s2rm(ront1oetomo3iadlm2ulnmo;u4 lxrmr to1fat aieo s)sexrir iy4llt mivi tfsrrr( pnt0tlxo octat mDrlnvs (0tetomf3oy1fmtr u i;t)setriopoudop n ici tf rrrxmo;t4tex ifeildfmDuanvon()texnifcoytomtran s;s)srxoim ou4lm n nvsat a2ua( pnt1oexomi3tatfa eauvp t)alerxrcto1omte ivo;s0seumxm iu1apeemfvsl(f Drrxm nu0oleomieilslm2ul(ms;t)tleoiocoodoaD aiei;s)trxrxrpou4olt lietl()s2ur( p;o4opeoii3iytfsDel(vs u0 exnxo oo1fp eanvi;(0sruoxmpio4omenmics s s2raxm ;u4tlen f3ias mDrmnvpn()altrif oy1oaDr nvs ()srxmxo oudamtnmietls  Drax  ;u0open ietad sDrm( pnt0aleoxf3iatop rai s;(0 2tr(mpoo1oltemfei t)s2ururont4oetomi3iys a rm(ms u) lenmfcty1lmteli s;t srxmxm3io1lp  lfctat artr(r ;o4teenmoetysfsDrluvsnu4 rxnmr3tadfpt lnvo;()sexriopio1lmte iet t)s2uaxm ot4tptnio3iysfsDum( snu4trxnxfcoadlmDranvs t0 2toxopiy1alt lfvt t a2tru o;t0open ieiysfs2rmn p;u4 renio3iotoatrluvo;()t2um(opnydlm n iei tfaDtaxro;t1oltoiicils a el(mp;(0 lxomo oa1oaDranei t) 2xrxmpiy4oltelivt (faruru ooo0ole  ociatlsDrm( p;u4trxomf3oytfaDe n i;()t2trxmpoy1lme mivsatfarrmuro;o1olenmo3tatls rlnvp t)alxnxf3tydfptrli s;s0teumir iodlmtnmfvtls)srumur no4tptoioeilslsDem(vp t4trtrmr3ta1faDr ueo (0seurirpio4opt mfctat) rraxmo;t4opeomf3tadfa2uanms;(0 etrmfcoy1fa r n sl(0 ruo(o iu4ll  lfcia() rrrxr no1olxomiciys sDrm(vp;t0 ltrif3io1oaDr uei t s2xrxopoy4ap n ncsasfsDua(r ;t4texnmo3tldla rln p u0trenmocoy1lm r neols texrxo3oo1op  livs sfs2rmxmp;t1oexnmfciasfa um(vo;(0artoircoa1omt au i;t0s2ur(o3nodolt licia(f ruaxr ;t1tlx ioctyt a2emn s t)tetrif3tadomDr ivo;( s2xmirpiodlltnlnvslt)aDur(mpoo4oexnmoeiltlaDulump;t0trxrmocootfpte iesl(  eurirpoy4lmenmnvil() 2ur(rono0aeenmfciysfm eau p t4altrxf3oytlp   uvo (0 etmimpnydamee fet s s2trur ;t4oexniociltlmDrmu o;u) ltnmr3ty1oaDrauei t)teuo(mpny1oltemnvtas)srurx pnt4ape ioetldfm2el( s;u)areomf oy1fate neo;s0 rxr(opiudapt  icsls a2umxmoot4teeo fciadls2rm( s;t0 eerxo3tydfaDraivilt0s2uoio oo4ol e ieia(fa2tm(ro;u0apto oetatfs2el(vo t0 lerxo iytlmtelnvolt seur(r oo1lmtn net () Dtm(roou0alen o3tatls2umu ont4treomfctodoaDean sls) 2trxr3nudom nmfvsa()srta(  ;t0tlx  fciytlm eln p;t4 lenmrcio1fa  auvi;() rxoxrpoodlm  lnvt () Dumx poo0opxo o3iadfa2eaumsnu)tleoif3iodop   uvo ()sexoirpiy4lm nlfvilt) 2trx  nt4aptoii3iadfm elu ont0aleomoctadlpDe nvo;t0srto(o nudaptelnvsltfarrmxront0alenio3tys aDelump t) rtnir tytoptrluvs s0 2xmir3iodom emivt (f Drax pno0aee iietlsls2uanvsnu0 lxrmocta1lptr nvs s t2to(mpoy4amee ivia() Dtrur nu1alto fctas a2rmu p t0 rxrmf tydlatr ueilt0trur(o3iy1amtemnci s arta(r ;t0aex  ociadfs uanvp (4aetrmr iy1om  anes t  eurxrpno4am   fes (fs2uaxmp;t0alx iieiydfaDeauvo ()aetrxo3tydlmtrluei;(0setrxm io1olenlnvsl() Dtr( pnt0aee ifctyslm rm(vo t4 rtnmociy1oa  luesl(0 rtrxmpnudlm emfetasf rtmurpot0alxomfctasfs2ean on(4altnmo3ia1lat au i ()srurxo3ou1lltn ietlt  2taxrpno0opxnmiciatlm2rlu p t)trermo totomte u ilt trxoio nudamenmivilt)a2ururo;o1tpeomfciatlmDua(vs (0 reomo3oa1opt au o s0 etmio no4ome miei ()a2rrx  oo1oleomi3iasfaDulnvsnt)alxomo totlateaneo;(0 eto(r3oydom  lieils aDtmuro;o0aptnmf3ildlm2ulu pnt4tleoxr oadlaDrln i;t  ruoimpoo1omenlnvi t sDtmxrp;u1tex moetyd a2rauvo;t0trtrxrctydopDrauvols0seum(o iudlmeemfcs t  2umxmp;t1oex moctldla eluvo;()arenmrciodoa   i i s) rxmir3oo4ap e feil(  2ta(moot0oeto ociydls rlumon() etnmfciy1la r uesls  2um(m3nydalt lies (  2umxmooo0aleomietytfa2el( s u0trxnmocoadomte uei;t0trtr(r nodalt lfvil(fsDrmxro;o4tetoioctatlaDuanvs (0 rxoxrcto1op eau ol() rum(r oy1op emnetlt  rua(r ot4apen ieiyd m rluvpnt4artrif3ta1laD aivo;t0 etmxo iy4lptn fctasfsDtau  ou1olxomfetatla2ea( ont4areomrcoa1latrlu ilt t2tr(mpou1olt  fvi (faDtau p;u1tpeomoeiyd sDuaump u4 eeoirciytfm raies t  rtmxopny1lmee nvi t)s2rmur nu0alxnmoeilsfa ranmonu)tlxrmo3tadlaDran o;s)truoxm3ou1lpen ieil() rrmx p;o1tpt  feildlsDul( p () eerxrcoydlpte neilt0sexo(opny4ap n nvi ()a2rau p;o4texoii3iysla ul(msnu) rtnmocto1lpDrauvo;t0setmxopnodam n nvslt)sDta(m nu1olxnmi3tltfm el(ms t) exnxrcootlmDeau o;()t2tmiopiy4ape mfvsl( aDtmxm ;u0alxo i3iat s2el( onu0 lxnir3oo1fate ieo;(0truoir3iodameemfctat sDrr(monu0tltomfetld mDumn pnu)areoxoctadfpDelu ol(0s2ur(rpoy4omtelfcs ( sDrm(moot1aptomo3ilsfm ua(mo;(4tlerircia1oate neo t)setr(r iu1oleelfeia(fs2urumpnu4opeo octyd m2el(vpnt)aetrxo todfmte nvi;()srxr(r3iydlp nmneta(fsrtaxr ;t4altnmoeiydls eanmonu)trxnmo3oo1fp   i slt) etmxr iy4am  lneslt) rra(  no0oet io3iasla2rlu onu0aexnir3todfp  luvils tetoir3ou1lpt livi tfartmxront4tle  feiasfaDeaums;u4treoir iodfp   i o;( s2xr(r nu1op emfciat arrrumooo4oex mfeiatfm em(vs;t0 rxoxr3oydoptrliesls setoimpny1olenmnctl(fsDuax oou4altnif3ildfm2eln o;u)trenxo3iytfaDr u ilt  exmxr3oy4ol   neil(fsruru pnt0tltnmi3tlt m2umn o u4 rxrmociydopt anvs;s) rxrim ou4ll n fcia( sDtrxr ;o0ope ii3iaslm ul(vo t)aeermo to1lm eanei (0t2uoxm3iudal nlnvtl() ruru p;o1tetnifctyslm ua(vont0arxrmo3oytfm  aneo;s s2xrxmpoodll emieta( s2ra(  ;o1tpe  fctys a2ulumsnt4tlxnxf3ta1lpte nvo ()teur(m3ny1om   nvtas) Drrx pou1teeoioetldlm2rmums;() ltnio3iodfaDrau o;s srumxr io4om  mfvta(f rumxm ;o4texniociltfsDul( snu0 etnxocoydfmt  n ol(0 rum(r iu1op  lfvt tf rtmxmpoo4opxo fciadfaDrau s t0trtrmfcoydom  li ilt0trxoxr3nu4llt livil( aruaxmpot0aptnmictat aDum( p u)altrif ty1fatrauvslt)trxmxm nu1al  lfetls)s2rrx p;u0apxn feilt m2um( sn()altrmo iotlatrluei (0seuriopoo4amtnlivs sf 2ururp;u0aptomi3ilt s2rluvs u4aeerir tytfmDelivo;(0 2xo(o nudll n ieslsfsrrmur nu0tlxoioeiytfm uauvp;t0 eerxr3iatlp rln s;s0truo(mpnudlmte nct (f Duax  oo4tet  feiasls2raumpn(0 rxnxf3iotlptrauvs;()srtoiopiu4lp nmneta(f Dtr(rpoo4tee  i3iatfm uanvp;t4tleomo tatomteluvi s)texrxr nodomtemfcs t  Dur(mont4teen ociytfs uauvs t4texnirctatfmDeai sls  rtm(r3nodom elivtat)aDraurp;u0alxoii3ilsls rau s;t4aetriociatop r u o;() rurir ou4llenlies s) rtmx o;t4oetn ieilsfa2emu o (0 ltrmfcoadoate u slt setmio3oy1lle mfvs sf 2tru poo0tlto ieiasfa2ranvpn() leniocia1la eln s;(0 etoxm oy1apt mncs s) 2um(r nt0oex mi3iatfm2eluvs (0teeoif tadopt ln i;t t2xm(m3nudlmt  ncsl(fsDra(r no4texniietls a2ulu o (0alxoif tatlmDe neo s  euo(mpio1ol emfctas)aDur(m oo0apeo icild sDuluvs u4alxnmr tadfmDrlueil( t2xm(o3io1apenmfetlt aruaum no1apx miciydfm ea(mp (4trtrio3ty1omDrliei;( trurio3oydomt lnetlt)s2umxmo;o1oee iietad a2ul(mo u)tetoir iy1fm  anvil()t2xoir3oydomen fvt ( s2trxmpnu0oee  fcildfm2em(ms u0 ltrxf3todomD anvs;s)srxmxo3oudomtnlnct ()arrmu ont4texnif3tlsfs ulnmo t0 rtomo3iy1faDean i;()sruoim3oy1lleemieslt) Dumu  ou0aee  fciytfm emuvp;t0texoxrctatfmtrlnvs t0sruo(o nodomtelnetl( artaxmp;t4oeto feiydfa2rmu p;t)alenmr3iadlp rai s ( s2to(rpio1am elictat  rta( o;o1tltomiciltfm rm(vo t4tetrxr3iytoa raivs;(0 euoxo oudll e ncta(fs2tr(r no4tpe mictytfaDua( pnt) rermr3tytomDrluei;t0 exm(m3ny1ap  mivi sf rrr(rp;t1olxn o3tat s elu s u4tleoif3oydomD liei ()srtriopiudoptn fvs (f Dtaum nu4olxomieildlsDrlnvon() etrir3iotomDrai o t)s2um(opnodamt miciasf rrr(  oo1apx iietlsla2uaump () lxnmo3tatoaDe ivil(0t2umxm iy1optnlics sfs2taxro;u0ope moetldfmDraumpnu0 rtrmr oy1opD au o;t) eurio nu1lmt livsl(fsrtaxr ot1oltnmictadfm uan o;t) ltnif iadlpt aieolt)s2ur(o3oo4lmtnlfct t) rumu poo1oeen ictyd s rm( p (0 exniociadomD auvi t)truoxm3ou1omenmfvtat) Drax oou1apenifetyd s2eluvs ()trermf3iytfaD  neo t0t2trxrpoudlpenlieil(fsrumu pou1aeenifetys a2ea(vont4texoifctydom e i sl()sruoxr3oy4oltnmfcs t) 2tmxmp;o1olxn o3ils s ul( p;t4tlxoxo3iytlptr ivi;()setmir3oy1ll   ncs s)sruaxrp;u4tptn iciyd m2ea(vsnt0tlxoxrctodfa eaivo t0s2toxr3ou1lmenlnciat)arrr(roou1olt  feiy
\ No newline at end of file
@@ -0,0 +1 @@
+n ol()teurxr nu4lltnlfet s  rraxm ot4oex moctlsfa2ranmo u4aetrxrcto1optr u i;(0 rtrxr nodomeemivi sfarumxm ;t0tlxn i3ilt mDranvp (0texomf ootfpte neo s srtrio io4lm elivilt  rta(rpno0alxoiictadfm2ra( pn()arxrxrciydlp  lnvolt setoxr3io4am nmiesatfs2ta(rpou1opxo octadfs eaums;(4alxomr3iotomtr u i s) 2toxr iydoltnmfvt ( srrrx  nu1apx ifeiytlm2eluvon(4artnirciotoaDeli i () rurirpiydlpt lnesa() Dururpnu0altnif3iltfa rm(vsnu0trtrxo oadomteluvi;t0 ruo(rpoy4opt mfeia(fa2rr(m ;u1opt ii3ilslaDumn pnu0 etrircio1fmtelnei s truoim3iu1oltnlnetatfsrta(  ;o0oltn ociadfsDum(vp (0tlermr todfa rlnes;( seumxm io1aptelfvs (faDumum ;o0opx iociyslm ea( s t)tlermf3ta1fmt liei t0 eur(r iy1lpeemics s  rurx pnt1tpx mociytlmDemnvsn(0tetnmo3tydlp e n i t0 eto(mpou4lle  fvi t  2rau  oo1tlxnmoctltfm2rauvo u4tlxoxrctytlat livil(0 ruo(r oy1ol  lfvsls)srtru  ou0optnifctytfs2rmnms;u0artnxo3tadfm   ivolt0 etm(opoo1olt lnvta()arta(ro;u0oleo oeiadfaDumu o t4trxnifcio1fpteauei t)s2xmxr nudlm   ictat arta(ro;u1opeo oetad m2emumo t)artoxfcoy1oa   i s t  2triopou1alenmfetat) Dum(rono4ale  oeiadls2umnvo;(4 renxf3totlat  ueils) exm(opnu1amtelietltf 2rr( pno4texn o3tat s2um(mp;(4 eenmociadlpDrauvols) eum(opno4ol nmfesa(  2rmx o;t1tex if3ildfsDeauvon(0 exomf oa1lmt  neo;(  2xrxr nu1oleelnctltfaDrru  ou1alt if3iysfm2rmnvp;u4arxoxr3tydlm  an ol() etmimpoydamt mnctlsf Duaxm ou4tlxnif3iltls emnmpnt4texoif3iatomD  u sls srtmio3oydlp elneias) Dur(ront0aexn octld a ulnvs;t)areoxrctotfm rln i;t  etrirpiodlptnlneilsfs2ta(mo;t0altnioeilt sDel( pnu4tltoifcoo1lm  aies;s)sruoiopnudalt lfcia()a2rru oou0olenmfciltlmDuauvonu)arenif3oydlm rlu o ( srxr(o iudal e ivt () rur(mo;u1apx ioeiaslm uanvs (4aexnxo3todfp  lues;t0teuoxmpoudop  mics t)s2tm( oot0apxoio3tysfm umnms;u4 etrmf io1omt  uvil(  rurim iu4apenlnvi s) Dtax  ;o0oexo ieiydfa emumpn()tetnxr3iytfp  livs t) euo(o3iudamt mivsatfaDuauroot4alt io3iytfmDelnmpn(0aetrmf3tadfpt au i;() exmxm iu4ll n fcslt) 2tm(rpoo1oet mfcildlaDeanvs;(0 ltoio tytom ean ilt0texm(r io1ame mnctat a2umur ou4alenmfetatlm2rlump (4 lxrmfcoydoat an i s seum(o iu4apenlicilt)arta(ronu4tpxn octltfm2rlu s u) lenxfcoo1lmD lnesl()texrir ny4omte nctl() rtaurpno4oexn icilslmDraumpnu0tlerio iy1oa   ieo;( t2xrim nydolenmfvilt)arur(  nu4tleniiciysfs2uanmpnt4tlxnmr oy1om r uesls0teuoimpno4llenmfvs s s2ur(mp;t4aeeomfcildlaDeln p;(4 leoxr3iotlp eaiei t0s2tm(opiu4ap  mnvsls)a2umum nu1ole mf3ild aDeanms;u)arenxf tydom rlivo s texr(r3no4opt  nctas) rtaxm nt1oltnmi3iltls2eauvsn(0artoifciytlaD aiei;s trxm(r3iy4lptnmnesat)a2umurp;t0aptnmieildlsDrlumsn(0alermf3iadfpt aues;s  2xrio3io4lle lfci () Dtm(m ;t4tlxnmociysfm2emn s;u4trtrio3todopte ies;( t2tmxopoudllt lfei s)s2umxmo;t0apx iociad a2rl( o;u0arxnxf iodla eai il()teum(r io4llt lnciasfsrtmxm ;u4alxn f3tatla2rau s;t) etrio ta1lptraiei;(  eur(rpnydopeemfvs sfsDtrxmpot0alt ifcils a2uaump t4altrxfcio1fm raueo;s seto(o iydopenlnetlt  2tr( ono4alen octad m rm( s;u0 rxrmfcty1om eau o;t0sexoirpoy4ome lncsl(farumu o;u1tetnmoctydla2ra(vs u4altnifciytla eaivs;t)texoxo3no1om eliet t a2urxrpot4olto i3taslmDrlnvp (4teenxo3iytfptrlnes;t t2trirpiudll  lfvi tf 2um(mp;t0tpx  feiysfa rm(mp u4tlermo3ty1opD li ol( s2xr(rpnu1lltnmivtas)aDrr( ono1aeenifeiat m rm( pnt)trenmr3ty1opD  i slt)t2uoxrpnudaltemictas  rrru  nu0oleo fciatfa uauvp u4alerxrctotfmtrauvi s0 2uoxm3oydalee ics t)aDta(m ou4teeniietld m um(vont0 rerxf3iadoaDrli ilt trurir ny4ome  ivtatfs2trxro;u0oltomfcias s eau p;t0arxrmocoatfa elueo;(0trumim3ny4am elfvsltf Duax o;t0olen ociydfm2uanmp ()artoir oatfpDrlueo ()tetm(rpiydalte nvtltfarra( onu1alx  i3iytfaDulnvsnu4texnifcoydfpDeluvi;t0 rxrim3ny1lp   ietat sruaum ou0teeoii3iys a2ea(mp;t0 reniociatop ranes;t trtmxopiydlltnmnvtat) 2tru ooo4ape  ociyd a umnvs;u0 etrio totfpDr nei;s seuriopoudalt  nviat)a2rmx p;u0tpxnmo3tltlaDumump t0alxoio3tadfat  ivslt) etoir3iodopt  fet s s2tmxrooo1apxn ieiys aDeau on(0aeenxf3ia1late u o t)t2uoxo3iy4amenmnet t)arrrxr oo4oeto ieiad a2emnvp t4texrmr3tytfat luvs;(0texoxm no1optnlfetl( sDtr(m nt4oexoifciydfm2uauvp u0altnif iodomteauvo (0 rur(mpnudape livsl(fsDumxm ou0apt mietld a2rl(mo;(0aexrxrctatlmt an o;t)s2urxopio1om  mictas aDtmu o;t0olt  octyslmDrmuvo ()tltrifciatlatr nvo;t)teuoirpno4ame mnvtltf 2rmumpoo4apeo oetas mDulnms;()tlxrmr iy1lptraneo;()teuoir no1opeemfci (fsDtrumo;t1tpe iietltfaDrmnmpnt)trxrmr io1optranes t0 rurxm io4lm   fvt s)sDrru o;u1tpxo ictadfaDrmuvo;(0 lxnio3iydopDeaivo;s)sexoxmpiydaptnmici tfa2tmumpoo1aleo iciydlaDeanmpn(4 leoxocoytfmtelivs t)sexmio3oo1lltnmfet t artaxr ot1tex  fciysls2eln s (0aleoxr3oytfpt au ols)trtmxm3io1al  lfvs ()s2ururo;t0tpe mieildfsDum( o;(4 rxrmo iytlp raueo;t0texoxo3oodop  mncsltfsDumu  ot4tlt  oeiltfsDrl(mpnt0aleoircoo1oa eluei;s  rtmxm iodoptnmfcsa()aDur( p;o4oetoii3tldlmDea(von() lerircoydfm  ai o (0 eumxm3io1lltn ncs ( aDumur nu0tpt ii3ilsfaDumn s;t0aleomfcoydoaD  uvol(0seuoio3io4lp e nvtltfs2tr(mp;o1tpt ifcildfaDeluvs (0 etnmf3ootlmDrlnei s s2um(opoy4aleelnvs ()srum(mo;t4texn oeiytls rl(vo;t) rtnir3iydlmD luvo;( srurxmpoo1alenmnesls)artaxr ot4oltomfeiyt s2ul(von(4tetrir iadlptrlnei;t srtoxm oy1ol n ncsasfartm(mp;t4texnifciad s2ea( s;t)aleomr todlaD lu s t)t2tm(opiodoptnmict tfartaur ;u1tlt  oetldla ul(mp t)altomrciadfp r n i;(  exo(r3iy1amtelfesat  rrm(mono1tlxniietyt m2rluvp;(4 rtrmo3oytlm rau ils)sexm(o no4ol  mfci sf 2rmxro;u4aptnif3iltfs eanmo;u4 etoifciadfatraues t0setmimpiu4lp  lnctlt a2urum oo1alt  o3iydfsDra( s;t)trtnmr iydlpteanvilt  exmimpiy4ap  mfcsasfsDrruro;u1optn fcild a emnmpnt0 ltoif3tatlaDrai sl() eurxm3io4omeemfvtat)aDur(r ;o1oeen ieiasfa uln p (0arxoxf ty1fptraneol()teuoim3ou4alen fvs s  2tru pot4tlt ioeildfm rmnmpnt4tltrmrcoodfpteau ol( sexr(r3oydalt  ncsasfs2tmumoou4tet  fctlslmDrl(msnt4 rxoxfcio1lm  li i s  exrxr3oydlmtelnei s  Draxmonu4oexoifciytla2emu o;u0 etoxf3iydom eliei;( texrxrpiudop nlies (f 2uau poo1oexnifeiydfa ra(ms;t0trenxrcoa1lm r neo;t  rxm(rpoo1ll e ncs tfs2taur ou0tpx  ietytfaDrmnmsnt0alermocoadomtrliesl()sexoxrpnodalte fctatfsDumxmono0olx mociyt aDeluvs u4 rxrir3iodlp eaieo;( t2tr(o oy4ol n fcilt)aDum(  nu0tpe mfciysfmDuauvs u4tltoxf3todomDrlu o ()t2xoxr3no4am  lfcslt)a2trx ono0aet  f3tasfm umnmo u0tetnif tadlm eauvo ( t2tr(r3iydlmte ieil()arumum ou1olxnmoctat a2el( p u) etnmrctotoaDeanesl(0s2tm(opny4opt mncias srtau  oo1opt mociadfsDumump u4tetomocoadom r u o;t)s2xmxmpoydlleelfvilsfsDrm(ront0apx mi3iad s2umnmont4 exnxf3ia1op e i olt)trurxmpoy4lmen ietl(fsrrrump;u0apx  fctyd s2elnmp;(4 renxocoodlmt  iei;s0seum(r3ny1ap n nci s)a2rmxrpno4oeenmociysfsDrlu s t4aexrmrcoydlatelnes t)seurir3oo1om n ici t s2ua( pnu4apxo ietydlm2uauvo;t4aeenmociatomD  iei t0 exoimpoo1altnlies (fsDuaxrpnu4apxnmf3iydls ea(vp u4texomo iotfa rau o t0 2trxm3nudlm  micil()aDtrurp;t0aptniicild s2rau ont0 renifciydopDeli i t) etmir3io1apt micilt) Dtaxr ;u0teenmfeiyd m umu o;()trtrxfcoatfaDeln ols0 rtrxm oo4lmtnmneiat) Dur(r ;t4oeen i3tatlaDul(vp u4 rtnxf3oy1latean i;t setoiopoy4lptemict s)sDtm(monu0apen i3ilt a umuvo;u)aetrxr3totla ean ils0 eumirpnodlmen fvt s aDrr(r ;t4aee mi3tytlaDemn o t0tetoirciadoaDrli s ()teuoxo io4amte ies (fa2raxrp;o0texn iciltls ean p (4 ltoir3totlmt livo (0srur(m3nodom e iviasfaDtr( p;t0tltomiciadfa rlumsn()arxrxocoo1fmtrlneo;(  exmir3oo4lpte neta(fa2tmuro;u4tleoiieilsfs elnmp;u4 exoxo oodlp e n s t0trxoir3ou1olee neia()s2raxr ;u0tlxnmiciltla2eanms;t4 eeoir oatfaD  nvsls)srxmxmpno1altnmnei s aDum(mo;t0oeenmietad s rmnmonu)tlermocoadfpt li sls sexmxm3ny1lpeelnvtl(f 2tmurono0aetnmoeiytla um(mpnt) eenmocoatlp rli ilt0srxoxmpoo4om emfet tfsrtmu ooo0tltn i3tls mDel(vp t4tlxomrcoo1fat  nvi;s0srtriopny1ope mnvia(farrr(  ou4aetoio3tytlm2eln o;(4trxrio3totoa raneolt)t2uoir3iudom   fcs tf Dtm( ono4aetn oeiys m2uanvs;u4alenmr3oadlaDelnei ( setmio oy4ap nlictl()sDrm(m ;o4apen fctatla2ea( p;u0tltnmr tydopt  ivo;s0 2xo(m3iudom nlfvsas)sruaxr ou0tet mieiytlmDulnms;t0arerioctadfmtelivsl()t2xmio no1op elfvtlt)a2tmurpnu4ale if3iyt s rauvo ()teenmfcoodla  lieilt) rumio3no1ap   ivt tf rtaxrono4aexnmfetyslsDem( s t4trxrioctotop eluvo;(  eum(o3ou4lpeelfesat) rraxmpnt0tlenii3ils s2emu p t) exrxr3iy1fa  lnesls0t2tmir3iu1openmnes s  Dtm(r ;o4ope  i3iadlm2rlu p;t0 leoif3todomtrauvs ( t2trxm3ou1ll   ictlt  rtr( pnu0oltomoctyslm eaumo;() eermo3io1oat auei;t)trum(mpoo1am  mfvt ( sDtm(rpnt4ale ii3tadfa emnvsn() eeoif oatfmDraies ()t2umim oydopenlfvsas)sDuaxr ou0tptniiciys s eaumont0trxnir tatfpDr nvs (0 2umxopoudolt  nctasfsrurxmpno0olx iicias sDum(vo t0aetrmf iy1omtrluvs;t  rxrxrpiu1ale  ieias) rra(rono0aptnmi3tydla uauvpnu0aexnmr tadfa rli ilt sruoxo iy4om e fet t artm( ooo1aptn f3tlsfa umu onu)tltnxf io1oaDeaieilt  2xrir oudamt mnvsatf Dtauro;o4tex mietadfa umnmo ()alxoio ty1opDrlu sls0sexmimpnu4altnlncias  rumxm ;u0apxo iciadlmDua( pnt4 lxnxoctatlaDeluvo;(0trur(r3iu4ole  fvtltfartaxr no1altomi3iltfa elu p;u0 rxnio3ootomt lu i;s  eumxmpou1op e feiasf Duaxm nt4opto feiasfaDra( p t4artrxfcoodoa  aneo;t0 etoxrpoo1op  micta() rtm(m ;t0olt  f3iydfaDuaums u)trtrxf oadfp ran s s t2tm(rpiodlp nmncias)sruru p;u4aeenmi3iasla ulnvp u0alxnxrcoodoa r u o;t  2to(r3nu1aleemnei s)s2tmu p;u0apxomf3iadfsDrm(von(4 eenxf3oydla rluvi;s) 2to(r3iu1lpe licil(fsDur( ooo0oet iiciatfa eau pn(0tltnxociytfmDeaneo (  euoxo3io4lptelfetl(  rtm(rono1apx mocilslmDrln snu4alenir3oytop   nei s0 2trxr3oo4lm elfcia(f 2tax pno4tleniiciasls rlnvpnt0texnmf3iadomt lieo t)srumxopou4ope mfesa()srumxro;t4tlenifeiadfa rlnvo;u)aexrif3tatfateauvs;()s2xrim3io1op eliesl()aDur(  ;o0apt if3iysfm2rlu s (4arxnmo3iy1fpt liesls0 2toxo3nodape  ici s srra(rpot0oeenmicilsfsDemn o (0aetoxf3tadfmtelnei s0seuoirpnu1lltnlnei tfs2trumpou1opxomictltfaDuauvpnu0 eerxrcia1lmteln sls  2uoxmpny4am  mnetas srrruro;o0aex mf3tys m elnvp;(0 rxrxr ootopDrlivils tetm(r nodam e fvslsf 2rm(r ;t1tlen fciasfa2eauvon()treoiocoy1omtrau ils)s2tmxo iu1lpe lfctl(  2raur nt1oeeo oeiatlm rmuvs t)treoio oodlatr iei ( teurio oo1olteliet (f Dtr(  ;u1tlx  oeiyd a2uau o;u0aexrmoctodfpDrlivo;t0s2uoio3iy4alt  iet s)a2ua( pnu0teenmietas s2uaump;(0 etrxrcia1fmDrluvs;t0t2xmim3nodlpte icsat)s2trumoot0apeoifetlsfaDra( p;()texnio3tydfpDrln i;s)seuoiopno4lptemieils aDumxrp;o1opeo oeildlmDeluvp;u0 exnxr oo1lpD lieols trxmimpiy4omte ieiltfs2rau pnt1aexoifciydfa uau p;(0arermf3totfmD aieo;t s2toimpiydlptnlietas)s2rmx oot0tpeo o3tld mDuluvp;t) exnxoctotoaDeau i (0sexoio iy1om n fvi s)sDur(mpou0tpe ifctyd a rln p t) ltoxf ta1faD lnvs;s0teur(r oodol emnvslsfa2rru p;o1olxnifetls m emuvs u)trerxr oo1lmD luvs t0 exo(rpou4amtelncsl(fsDtaxr nu0tptn oeiasfs2rmnmo t)alxnxfctodfaD an slt0sexmxo ou1am e iviasf rtmum ;o4opeomi3tytlaDranvo u)arxrxrciadla ran il()sexrir3no1opteliciat) rta(m ;u1tpe iieilslm ul(vo t4aexnmf iy1lat livi (0t2toiopio1alte fct sfs2rruro;o1oetnifciytfs2rmums (0artomr3tytlmtr iei t) 2xoio oy4op elfvsas)arrrxmp;t0aleomi3tlsfsDrln p u0tlxrmociy1omD  u s;s)trumir3oodalt  ivs tf 2rax onu1texnmoetydfmDul(mont)artnxrcta1fate i i;t0s2xmio3io4ol nmivi (f rrmxrp;u4alt ifctysfm2elnmsn()aetrxo iytopD lnvo;(0 rurirpio1lptn neta()aDtaumo;u0aptnmictat a2rm(monu4tlenmfctytfaD aivs;s)s2xrxo iudoptnmnct s)s2ur( onu1alxnmfciytlsDeau s u0 exnmr iatoptrai ilt  2to(r iu4alt lictas s2ua(mo;t1optniieias m rln p u4tetrir tadfa eai i;t0truo(opio1open ivs s)s2tax o;o4tet if3iad m2rau on(4arenxociy1omteaivo s)truoxm3no1llenmfctat aDtaum ot1olx iiciasfaDemums;t0 lxnif to1lm eaivslt sruo(m iy4alt lfvsa(fsrur(root4oeenif3tlt a2rmnms u4 exoxrciydfptraneo;t)t2um(r3oo1lp   nvs t sDumuroou0alxnifcilslmDemn on(4artnif3iodopDranvsl( s2umxr3oy4apt mneil( a2raxm no1tpt miciytls2eau p;(4tlerif3iadlaDrlnvo s0 ruoxm ou1lpe mfet sf Dtm(r nt4olen ietadlmDeanmsnu4tltoxf3io1laDeai s s0 rtoxm iy4lpeelfet t srum(m ou1aex mietadlm ulnmpn(4 etoxoctadoa   u o ()tetrxopny4lm elietatf rrax  ;o1olen i3ilt s ul(msnu)tlxrif3ty1lptr uei;t  eumirpou1apte nvsa( aDumu ono1tlenmieilslaDrmn s;(4 rxrmr3iy1fat anvo;s)srurim3no4olen ieiat  Drr(rpoo0opx  o3iyd m ra(mo t0 etrirctydomDeai s ()sexm(opnydol e nctl(fsDtmxrpnt4oet  ietytfa rlnmsn(0 lxrmrcoytlp eauvi t t2umxrpno4ol nmfetas)a2trxmpoo0tex ii3ilsls2ulnmo (0teeomr tydfptelueilt t2xoxmpny4lle lfvtas)aDtaur ;t1ope io3tyd mDemuvp u0aexoir3oodlp elnei;t texoxr oy4ol nlivsat)a2raum no4texo fetasfa umump;u)texomfcia1op elu s;s) 2xmxr3no4omeemfeia()s2rrxr nt0apto feiat aDrlnvont)tltnifcoodoa eaues;( teurio nu4olee nesa() 2ta(mpno4tpt moeildfm ulnms ()alxrxo3oa1laDe ivs t0seum(mpny4ol   fes s a2rm(  ou4tltoioeildfa raumo t4alxnmf3ia1fpDe u o;( trtoxm3nodlp   ncta( aDrmur nt1open ietasfm ua( s;(0artrmocta1fp r i ilt0sexrxr3iu4ole mncil()a2tm(mono4aetnmi3iatlm el( p;t0trxomfcoo1op eanei;( srto(o3oudlltnmnvsls  2rrxmoou0tpt iieiadla2eauvpnu)trtrif3oydlmDeai sl(0s2trxmpno1amtn icia()aDtrxmpnt1oexnmieiadlm uan p t4areoxrciodfmteauvol(  rxrxo ou4lle  fctls sruau onu1aex ifciyslsDrmnmon(0tlxnio io1la  li il()t2umxr oodom nlfcsls  2rmurpnt4tetomo3iaslaDranmsnt0tetrmf3iydfpte u ils  2xoir io1openmivi () rra( ooo1aptomoctat s eau ont4tleomf3ty1fptr n i;()srur(m3iudom   ivtatfaDuaurp;u0aex mieilt m2umuvpnt4texoxociotlmt auvsls  rxr(opoy4ape mfcil( sDuau ono0alen o3tydls2rmn pnt)texoxr ia1oatranes;s)truo(m nydlleemfvi sf 2rmx ono1alenioetatlaDel(ms;t4 ltrxf iytlm eln o;( truo(r3oodoptnlfcs ( a2ra(r ot4oexniieildfsDeaumsnu4artnir3ia1laDeai i ()texmio3no4lleeliet tf ruaum nt1aex iocildlm um(mp t4alenmfcto1fp e uvsl( texrxo oo4optemnetat a2trurpnu1aet mo3tadls uanvp;u0tltnxo tydlmDe nvo t0 2ur(opiy4amee feias) rtrx  no4apt miciatfm2ul(mp u0 leoir oy1omt lneilt  rurxm3iu4ap  micsasf Draxmooo4apenmieiltfmDeluvpnu)areomo tatlm eli i;t)srtm(m3iu4altnlnvi t  rra(r ot1oetnif3iyslsDrau s t0alxomr3iadfa eln s t0t2trim3nydomee nvslt srrr(mpoo1altoif3tytlaDea(ms;u4trxrmoctotfmteaneo;s0s2umxmpoo1aleelfvil(fsDtr(rpnu0tpx  feiyt s eanvsn()trxnxo3oa1fmt  u i;s) 2uo(rpiydoptnlncils a2rrxm no0altoioeiadlm rmuvonu4altomo oo1fmDeaivsl( sexmio io4omee icsl(  rrmu oot4opx mo3ild a rauvp u4 exnir ta1omDrlneolt0 2xrimpnu4apen netlt a2rru pnt1tetoioetysfm2rmnvpnu0texomo oodop eaneo;t) 2um(opny1al emnvsltfarrrxmono4tleomociltfmDean pnu0 etnmo3tydomD ln i;t srto(mpio4lleemics (  2umumpoo1olxomictlsfs2ul(vp;(4 etrmo3io1latr u ilt texmirpoy4ll emnciltf rrauro;u4alt  i3iltfa2rm(mo u0artomr oa1om e ieo t  rtrim3ou1llt  feiasfsDururoou1oet  i3iatla elums (4 exnxf3ta1op e i sl(  rtm(m oudlmee feilt)s2rax ont0oltn o3tat m eau onu)texnxr3oadlpteli s t0t2xrxr3iu4aptnlivslsf 2ta(  ;o4aptomo3iatls2ua(vp t)alxoir todfat ln i s t2to(mpny1amtemnvtls srtru pno1tpt  icils s2uln s ()tltoir oadlmDrau slt0 2xrim iy4lmtnmiciat)aruau  oo0teto o3iltfa umu o;t)aeeoxo oytoaDr neols tetrxm oydam emneils)srurur ou1opeomf3ilsfm eau snu0artrirciadfptraieo t  2xo(r no4amt livsl(  2ururp;u1tpe mfetltlm2emumo;t0 rxrmf ta1fptr u s;t) rtrim3oodol elietl(fs2uaumpot0olxo feiadlmDean ont0alxnxocoadlmtr n i;s0trtrir3ou4opte nvsasfaDua( p;t0ale  icildls2ea(vs;u0aeenxfcoy1fpte nvilt0s2xmir3nu1omen fct t s2ta(rpot0tpt  oeiydfa2em( s;t) eenmr to1om r neolt t2xm(r3io1ape  ivi sf rrau  oo4tltnmieilt s rmnvs t4tltoio3to1laDr nvilt trtr(rpoy1amt licslt a2ra(rpou1tlxoifcilsfs rl(vpnt0tlxrifciydoa e u o s0 rto(o ou4ame mfvs ( sDtmumonu4tlenifcildlmDelu o;(0trxrmr totfaD  i i;t)srtr(mpoy1lpeelnvt () rra( pnt1tlen feilslmDrmu on()aeerxrciydopDelneo;s trxmxr oudome lnvs tfsDuru ont4oetnmo3tad mDul( pnu0arerif3tadfm raneol( s2xm(mpoo1al nlict t srurxront4aetomi3iasfaDrmnmsnt4aexriociatopDranvo;s)tetmxm nu1am  livsls  2rr(m ;o1oleo f3ils m2ranvs t0 ltoxfctadoa  anei s)trur(m no1olt lnvil()aDtm(m nu1tlen f3iysls2umums t4artoxfciotlm eaneo (  2toxo iy4lpt livi sfs2ra(r ;t4tpe mi3iad a ua( s;u) reoir oytfaDeaneo s)sexo(opoodap elneilsf rtr( o;t1apto f3ildlm emums;()tlxrirciodlm e ivo;s0srxoxr3oodlp n fesatfsDua( p;t0oltomictasfm2ulnmpnu)tltnmf3ootlp ran ols seuoxo iodopenmneil(  2tm( ont0tptnmf3iytlm2emnmon(4arenxocoy1lateliei t)srxo(r iudapenmfvilt sDurumonu4oeeomfeiyd sDuau p t)trtnif3ootfp rlivo;t) rxrxmpou1ameemfeils) 2umxrp;o4oexo ietyd s ulnvs;(0 rxoir3oodfp  luvol(0 eumxo3oy4ameemnctat) Drr(m ;u4aexomoetldfsDeluvpnu0tltrxr3oatopt aueo;s0 2urxm3iu1om   icsls) Dtmx p;o4opxnmfeiydfa um( o;(0 ltnio3ia1lm eai o;t0 rtoir oo4ameemicsl(farrrxmono4tleo fciydfs2umu p;t0 lxnmf ta1fpD  i o;()setmimpnodolt mictlt)aDraur no4alx moetld a2emumont0 lxnxo ty1opDeaivs;s trtr(r iy1lltn fvtas)a2umumpoo0tpe  o3tytfaDuaumo;u4 renio to1fmte nvsls0 rtr(m3oudlltn ncias)s2raxr ;o4tpeo ieiat sDuan p;t4arermf iotom  lnvils t2to(m3oy1al elfetl(f rumumonu0tlxomi3iatfa2eluvp;(0alxrio3oytoat luvil(  eumxm iu4amenmfvtas sruaxmpou4tltnmfetydlaDum( o;u4texrmr ty1la rlnvo t) 2um(mpoodamtnmnet tfsrrrxmooo1aptnmfciad sDrmnvs;(4 rtrir ootoaDrlnvo t  eurxm3oo4lltnlncsl()sDtrumpno0apx mi3tldla2rln o (4texrxf iodlat lueols) 2xmxr ny4al   ici s)a2uru o;u0ape  f3tytfa umuvp t4 etomfcia1oaDrauei;(0srto(o oy1op e ictls artmxrp;u1tlxo fciaslm emnvs u)trenmo3oa1fm r ivsls0seumxmpou4lpen nvilsf Dtax p;u0oeenmfcilt s2rmu pnu)tltoir ty1faDrluvs;() 2umxr oy4amtemnctls  2rrurpnu0apt mictatla eauvon(4tetoir oo1fpte uei ()s2xoxo3oodam nmnesas artaxmoou0olxnmictydfa rlumpnt)altoxr3iydfa rlueo (0t2xm(mpny1olt mivt t)arua( ont1openmo3ilt s2rau o (4arenif3iytoa eaivi t sruoxmpoo4optnmicsl(fsruau pnu4aexnio3tadfm2rmu p t4aeenmo3iodfa rauvo;t)s2toir3oodaltelivsas sDur(mont1tpe ifctytlsDemu s;()aexrio3oadfa elues ()setrim3iu1optnmivsat)sDtrur ;o4tex iietydlm rau p;(4aetnif oa1fm rlnei;s  2trio nodlpeelncs sfaDumx o;u4apxn ictls aDraumo u0texrmocty1faDeanes s)sexr(o ny4ll emicsa(  2rm(m ou4alt mfctyd aDua(vpnt0tleoiocta1oa elivi t0 rum(opou4apt mnvil( arrru ono1aexnmoetyt s2emuvsnu0tltnxf tadlp  au il(0t2xmxm oo4lp emnctatf 2uau ooo4tlxomoctadfs ul( o u0trtrirctytfpD  ueo;(0 2toim ou1lmt  nesatfs2um( pnu0opxniieiyd sDuanmp t4trxrmfcta1lateluvo;t)setmim3io4lp elfviat  rur(m no4aexnmociad mDemuvp;u4aetomfctytlate uvsl()t2umio3nu1ope lfvias) Drrxrono4oet moeiytlm2ulu p u0artrmociodfmte uei;(0s2xo(r3oy4lm   icsa(fa2umxrpot0tpe io3iyt sDrauvp;u0altnxf3todlmte uesl(0teuoio nu4ap elnetas)arur(ront0tpxo ictyslaDua(msnu0areoircoadlmDrli o t0 2uo(m3iu4al e ncta()srurum ot4tpeo oetyd sDranvs;t0aexrxo3oatfmDeln ol(  rtoiopio4lpt lncsl( s2rrxmpot4apt iieiyd a2ua(mpn(0areoxo oodopt  n sl()trurim3io4al e iciat) 2raur no1aee  iciysfmDrm( sn(4 lenxo3iadfpt  ivsl(0sexm(rpnodolt  ncta(faDrrumpnt1apen fciys aDrlumo;(0alerircoadfat anei;() 2umirpiydop  lncs ()s2rr(  nt0altomfciyslaDea( p;(4 rtrxf oo1fatr nvsls0s2uoim3oodoltelnvsat)sDrr(ronu0tee ii3iyd aDeanmsnt4teenmo3iatlatrluvolt) exrxrpoydoltnmiet t arrm( pot0olx  i3iat a el(ms (0tetnir tatlmD lnvolt  rurim nodalt mfesas  2rm(ro;u4oexn ocild aDelums;t)arxomr3tatfp  aieo (0sexoxo3ny4apt lfvtl()srua(m nt0opxo f3iasla2rm( on(0 etnxo oo1omtr uvo s) rto(opoy1ap e fetat  2uru  ;u0oeenmi3iatfsDeaump u4alxomr3ta1lm rauesls) 2toio3nu4ape mict ( a2uru oot4tlxnmieiadlmDuau onu4teenif oa1optrauvi;s) rxmio nu4amt lies t  ruru  oo1olenmieildla2ulnvp t4alenxfciydfm raueilt)trxoimpno4omen icia(fs2urxm nu1optnmo3iydlsDrlu snt4tlxnxo ty1lat lnes s  rtrir ou1lm   net s artru  nu1ope  oeild a umu ont4aexnmf3oatoatr i i s0 rum(o nudlpenmieslt  2raumo;o0teenmoeiad mDea(vo (0 rtrir iydlpD lnvs;(  2umim nydlltnmietat)sDum(m oo1olx  octltfa2ul( p;u) rxoxr3oytopDeau o;()texmim io1amt lfcs ()arum(rp;t4aexnifciat a rmuvo;u0trtoxr ootlmDraiei;(0seurxopoy1lmtemfvs sfarra(rono0aex ifciaslm2ea(mo (0tlxoir tatoaDelivi;s0srtoir oudlleemfetatfsrta(r ;t4ape mi3tyslm el( pnu0 lenxo3ty1lptean o (  rur(r oy4opt lncil(fsrtrxro;t0aeeoio3ildls2elnvs u) eeomf iydopt lues ( srxmxr3iudal  liei t aDrmu pou0aetnmi3ilt sDeauvsnt4trenif3oatfp  anvs;t setoxmpno1om  mnctlt srrr(  nt1opt mfcils a2uauvs t)tlermfcootlatelnvo t0 rtrxr3iydlm e fei t)srtm(  nt1oet ioetys aDulnmon(0 rxrmf iodlaDelivs;t0 2uo(m3no1aleemncsltfaDrau p;o4oltomi3iad mDea(ms (4 eerio3iotlaD ai s t trtmxrpnu1lpeelicsa(  2tr(mp;u1openmfciyd a rmump t0 etnmrciy1oa   nes;(  2urxr nu1lpeemivt (faDraxrooo4aex mfetas aDuanvp t0 lerio3oa1lp eanei;() euoim iydol nlfesls aDrmum ou0tpxnifctas s2eln pnu4teermr iotlpDelnvs;(0t2umimpiu4llt mfei ( s2tmxmpnu1tleomietyd a2rmn onu4tltomf oatoa eaueo;s0texm(r iy4op  mfet t)a2rmuroot4ale if3tas m2rln p;(0alenmo iytom eau ils)trur(o3nodll nmnvias arua( pnu4alt  ociytla2um(mo u4texrmr ootlm ranes s0s2urim3iu4ale  fvsatf Dua(root0altnifctydfmDrl(mpnt0 etrmr tydfate nei;()t2xmxr3nu4op  mfviat) rtr(moot0aetnifciytla emu onu)areoir3iadlptrau olt truo(o oydllee nvs sfaDra(mo;o4oeto f3tydfaDelnmp u4 ltnif3ia1lmD  i o (  rxmiopou1lltnlncilt  rtru pnt4tptn o3tysfa ea(mpnu4altoxf3iodom e ies (0truo(rpnu4lle lnvt () 2um(r ;u4teeomoeiltlm uan sn() rtrir oa1fp   n s t0 etrim3oudllt miei t) 2taurono4teeo ieiydfmDeanvs;u0aetnmrcia1opDraueo s)t2tmim ou1optnlnciasf 2ur(  nt4olxn fctlt a2el(mo ()texnmf3totlptr nvil( t2umxr3oo4open ics s)artmxm no0oeeniicias sDra( pn(4arermo oytop eaueo;t0seumimpou4llt licsas aDrm(m ;t0oltn iciaslm2eaumo t4 lxnxf3iatlatraieo t0 2xmxr oo4lme  fesas)sDumxrono4oexn ocild a2emump u4 eeoir3ty1lm r i o;( seuoim iu4oltn nvs s  2raxmp;t1optomo3tlt aDumnvp;t0 lerxocta1fpt li il(  etrxo oo4om nmicil( sDrrxmpou1texnmo3ias s2ean pnt0 eenir oodlm elnvo ()t2tmim3ou1al   ieta(fs2um(ro;u1tee mociadfsDrlnvonu4aetoxrciotfptrau o s s2ur(r3nu4opt lfvsa()arrmur ot4tpt io3ild aDuan p;u4teeoif3todlmD li s;s  2uoxo nu4ome mfvs ( s2tm(mo;t1aleomictadlm um( o;u)tltrmo3oytopD  ivo;s t2xrim3nodop elfvils  2rrurpnt1alxn f3ildfmDrluvs t4tetnmo3oatfpDe nvi;(  rum(r3nu4am  livt t  2rmuronu1olx  i3iatlm rln s;(4 eenio iotfptr ivo s0sexm(r3ny1lptnlfcslt aDrm(rp;u4apxnii3tydls ean s (0texoxoctadlmt lieo s  exoir3ny1lptelfcil( aDumurpoo1oltomieiys aDumu sn()alenxo oodfp r nvo;t0 2xrim3no4al  lncslsfsrtrxrono0olxnif3tlsfsDumnvp t0artrmo to1la rau s t)t2xrxr no4aptnlnct sfartax oou4oetnii3iadla rm(vp;(0altnmrcty1faDran ils0 2xo(r3oy4om elnvtas)a2rr(ro;t0tex  f3tltfm umump;u0 eenio ty1fpD luvi;s0t2uoir3nudlpe  ivilt)artr(ro;t4ale mietys m umums;u)tlxrio tatlmtrlivs s)s2umim3no4aptnmictlsfs2uaumoot4oet  icilsls2umump u0 etoxrctydlp r nvs (0trxr(m ny1lpe mnei s) Durumpnt1tlxn feils mDrlnms;t4aeeoxo3ty1omt lnvsl() rurxrpoudlm nmivsls)aDua( pot0tlt  o3tldls eln pn() eerifctytoa e n o (0s2xmim nodam emfct ( a2tru ono1texnioetatls rmnmo;u4 lxoxr iytlmtrauvi;s0s2umxopnydaptemfctas  Dtm( ont4tlen i3ildlmDrauvs;t0 exoif3oodom r neilt)texmxmpny4llt mfetl()srtmx pnt0apx mf3iat a rlnvs t4artomfciytfaD an il(0trxoio3oo4omt  nvsls)srrmu ono4oleoiicildfs2eau pnt0 etnxfcia1fp   n slt)setr(opno4llte ncias s2tau pot1tleomietad s uanmon(0 leomf3ty1fateauvo t)t2uo(o3oy1lle mieils srtmx  ;o0teeoiiciad sDeln pn(0artoxf iy1lpDr n sls0srxmimpnydame mfctas) Dua(roou0opeo f3iysfa ulnvs ()alxrio tadfaD lnvs s  2xr(o ny1lpt  neiasfaruauro;t0ape  fetldls2ea(vo;t) renif ootopteaueolt0 rum(o3ou1ll  micsatf 2rr(rpno0alxo ocils aDrau s;(4tltniocto1fmDelivs;t s2xo(mpnydopen neil(  2urxr nu0oetn feiasfm2rluvp;(4texoxo tatop raueslt0s2to(opnudole  nesltfsrua(  ou0olxn feiat sDrm(vsnu0trxnifciytlatr nvs ( teuo(r3oudap emfctl(fsDta(moou1apxnmoeiasfm uauvs;u0arxrir3oodfa   n i s)tetrxr3iu1olte fcils)s2rrxr no4aetoifctatlsDumu s (4trtnioctatfm e i s t t2tmxmpiu4aptemfei t aDrm( p;u1tltn iciyd sDem(ms;u0tlxrio oytoa r ivilt0t2umxopno4lp n ivslt a2rr(r ou4ope ioctytls2ea(vo u0altnmr tydfp elues;s0s2xmxm ny4lm nmneiltfsDraxrpou1oltoioeildlm2eanvonu)tetnmr3tytlpD auvil() ruoxrpiu4openmfet s arta(rpno1tet mo3tat mDum(mo;t)teermo iy1lat auvils s2xoxmpno4omtn ivt tfaDtmum ot0apxo f3iaslmDrmnms (0trxnif iatfpteaiei;s)trxmxmpou4lltnmiviatfsrumxr nt1texnifetyslm2eauvo;() lerir3tadla eaueo;( srur(mpou1al   fetas sDrrur ou0opeo o3iatfa rmu s (4 rermf tadoa eliei;() 2ur(r oy4lpt livi ( aDrmu  nu0tpxnmieildfm rmnms ()tleoxf ootlmD  nes t)s2uoir oo1ole lnctlsfa2ua(m nu0aptoifciadfsDemu pn() lxnxr3oy1lpDrlieol( s2to(o3oy4alenlfcilsfarur(rpoo4tet mfeiysfa2eluvo;(0alxoxr ty1oa rauei s0seur(m3iydol emiei () rumx pnt1oeen i3ilsfs em(vsn(0aetniociotfate n ils)seurxrpnudoltemfvsls) Dtr(m ;u0opt iicils a2umnmsnt)tlerxfctatlat luvsls)s2uoxo3iodllt  fvtat)artaxm no4olt moeiysfs2raump;t0 exnmr oydfat  uvi;t)s2umim iudom   ncsl(farrmxr nu1apxnioeiltlmDrm(mp (4tetoxoctatfat aneo s)s2uoxmpiodlptnmfvta(fs2um(rooo0alt miciydla2rlnvo t0 lxoif oatlpD  nei t  exmim iy4om nlnesa(fs2uau o;o4tlxoio3ildfsDumu s t) rxrxfciodfmD lneols seumxo nu1altemfciasfaDtmur no1aeto o3iyt a raums;u)arxnxf tadlaDr ueils  2tr(mpny1lleelnvt t sDtrx onu4tpxoii3iasfm2rluvp t4arxrio3oy1laDrln slt)tetm(o oydlmtnmfvs ()sDraumpoo1apxnmoetyt s2raums;u)aeerxfcty1la  aies;s seto(mpiy4lpt licsl() Duru ont0alxo i3ils s2emuvon(4tltniocoy1fmtrlnes;t  2to(opoodop  mfeiat sDtr( o;o1tet ifetadlm2ean s u4aexnio oa1fm  an ol() rtr(o iudll nmnci t srtr(rpoo4tlx mieiydfs2elnmo;t)arenxf3ty1op eaivi s teum(mpno1ape mnvsl()a2tr(m ;t4apxnif3taslsDrmn ont0trxrir3tydfmtelu s;( srtrio iy1omeelnvt s) rtrxr ou4texn fetydfa rmumsn() rtoifcia1oa eanvolt) exm(mpiu4omtnmiciltfa2umurooo4oeeomoctys s2ean s;t)alermfcoa1lmtranvo (0t2toio oudal  liet ( s2raxronu0alt  f3iltfsDuln s ()tltoircto1fpt luvo s0s2trxmpiu1llenlnei ( aDrrxm ou1teenmiciyslm2elnmpn()texoxrcto1fatranvi;() rtoxr3oy1ale lnei s srtruront0aptnmo3iasfm2rm(vo (4arenmociytfpDeau o (0teuo(r3ou1omteliei t a2uru pou0open ieildfs ua(von(4 rerxrctytfmDeaies;t s2xoxr3nu1optnlfes s  Dumxmpoo0tlxomi3iat mDemnmon()tltnxf iatom e neol()truo(m oo1ap  mfei (f 2ta(mont1altn fcilt mDea( pn(4teerir oodlp e i i;s sexrxm3no4apee ici sfsrta( ont0alxniieiyd a rmnvp;t) ltnxf3tadfa  luvo ()s2uoim3nydol nlictas) rur(rooo0olen i3iat m rmumpn(4tetrmr3oydlmt aieolt) 2xoir3iydlp e nvi t s2umu ont1olx io3iasls2eaumpnu) lxniocoytopD aues;(0setoio3no4omtemivta( aruaxrpoo0aexomfetyslm rm(vo;t4aeerifcoydlp r ivo (0 rurxr3nodlmt mnes sfsDrm(  ot4tptn fciadls uaumsnu4teenmrciy1fpteau olt)truoim oydamt mfeilt) 2urx o;u4altoifcilt aDuauvs (0 lxomr oydoaDraivslt  etoimpiodaltn fet t) 2rrumpoo1oexnmfeiadlm2el(vs t4aexnmr oytomtraueol()trtm(r3ny4oltn ieils)s2uax p;u0opt iiciyd aDul(vs (4 eermo3oodoptelivs;( srumxm3oy4lptemnet tf 2rrxm ;t4tlenioetad s2elnvpnu)tlxomociatop rlies;(0setrim3io4ameelieils  2uaxrpnt1aleomfeiasfs2eauvsnu) exrxfcoy1fp rlneo;()seuoxr3no1ome lietlt sDrr(m ;o1tee ii3iyt sDrlumon(0trxomrciatomtr ieo t)trxm(opoodlmeelivtls  Dtrxr nt1oeeniietyt aDrm(ms t4altoiociydfm e ivo ( t2to(rpiu1ll elivsl(farrrxmp;o1opx  f3iysfmDum(vp ()arxrxfcoo1lm rln il()teuoio ny4amenlfvt s)aDrrxmp;u0ope  oeils s eanvp (0trtrmo3todfa elnei;() rtmxopiu1aptelfvi t) rraumo;o0opeo f3tat sDumnvp;(4aetnmo io1lpt li o;()s2xrxr3oo4om  lneslt)a2rauroot4teen iciadfm2em( p u) etnxoctodlpDe u o t) 2tm(rpio4lm e fes tfaDtmum ;u4oet  o3iltfsDel(mp (0trxomr iytlpDr neo;s sexoim3no4amen ivs s aDraur ot1oex ii3iys mDel(vsnu0tltrio tadop rauei (  2um(m ou4apeemfvil() rrruronu1tpt iociaslm2uln o () etoif3totfpDrli i () ruo(r3nu4opt lneilt  rrrxr ;u1opxn f3ildlm2uan p;u0aexnir3ootla eluvilt0 etrio oydlpenmfci s)s2ua( pnu0ole  ieiydfs umu s;u4tlenircoytlp eau o;t t2trxmpiu1amtelies tf 2uaxrpno4opx iietat s um( s;t0alxrxfcoa1lm eaieo ()s2uoxo3iudol   nvsat  rtrxrpot1ape mieiys a rauvpn(4altnxocoytopt ln i;()trxrxrpnu4lm emneia( srtrxrp;t0tleomfcilsfa2rmnvp t4aexoir3ootom  aneols)srxoxm3no1op n icias)sDrrur ;u4oee ioetatlm um(mp;u0trenifctodopt auvo;( t2xoxo oy4om nmnetatf 2ta(r ot4tptnmfeiadfaDeaumon()tetrmo oatoptrluvo;t0srtrir3oo1lpe mfcsa()sDtmu o;t1tet  oeiltfmDea( onu)teeomo oytfaDrauvi;t s2xrxopoodlp nlivi ( a2tmxmoou1texn oeiydla2ua(vp;u) rxrio3oytfaDelnvo ()srurxm3oydom emfeslt) rrrx onu1aet mi3iyslmDum( sn(0treoio oydfa rlieil(0t2uoxrpiy1ap  mnci (f 2rau pnt0apx ioctls a eauvo (0aeermoctotomDr n o t s2xoxr3io1ll nmiei s  2rm(mooo4alto ieiltfs2ua(mo (4texrxfcoadop e ueol(0 2xm(o3oo4lm n nvs s s2tru oou0oet iiciytfs eluvp;u4aetnir3to1fp eai ol(0setm(mpiu1lptnmfvi sf 2taumpou1alt  oetasfa umuvp u)tltoxr tytop r u o;s0 2umim3iodlmenlfvsl()srtru  oo4tpe  f3iyslmDumu o t0aexrmr tydlmtranei t  rtr(m3ny1lpte ncs ( sDum(r ;u0openmfciadfs uaumsnu0alermr iadlaD  nei;s)trum(mpiodolenlicsls)arraumono0alxnmieiysla2umump t4 exoxrcoatfateau o;t tetmxopoo4al  mfcsas a2raur ot1apeo oeiys mDumnmp t)texnmr oatfaDe ueilt0t2xo(r oy1al nlfei sf 2tr(mo;u0oltnmf3ildfsDulnmpn(0 lxrxo3oydlmtrauei ( srur(o oudomee fctl( a2taurp;u0aet mf3iyt s2rl( p;t)alxrifcoo1fa rlu i;s0sruoio iodlpt mfcsat  2ur(ront0oee iieiad m elumo u) lxrxo3iadlat auvs;s)s2xrxopnu1om nmfcsls)sDtr(mpot0olto icils s2rl(ms (4 rtoir to1fmt lueo;s t2tm(mpou1om elnctls  2tr(rpno0texniieiys aDrlnvo u) ltoio3to1fp e ueil(0 2toimpiydal n iei t)srumuroou1tpeoiietls mDum(vsnu0 eeomfcia1faDr ivsl(0trtr(r oydlltemfvsat)a2taxm nu0tpt  o3ildlsDel( ont)arenmo3iytfptrli slt s2xrxm3oydalee netls) 2taum nt4oeeoif3ildfaDeanmo;u4 exrir iydla eauvo t setoimpnudamt  fei s  2um(  ou0oltnmieild s rmuvs;(4alenio3oatopt  u i;() etr(opnudlpee icslt aDraxm ;t0aexnmoetatfa ranvo t4tetrxf io1om   iei () 2toxmpiu1oleelies sfsDumxrooo4tleo fcils s2rlu s;t) rtomrcoo1faDr ivslt)tetrim ou1ame mfvt (f rumxr nt0texoif3iaslaDuluvs ()aetrxrcoydfa e i sl(0 2uoiopoudap nlnvi ( arta( p;t1oexnio3ilsla rmnmon() exnir3oo1la rlueol()seur(r3nu4ap emnvs s) rra(rp;t1olt mf3tldfm raums;(0alxnirciatop  lieo;s)tetr(o io1lpeemnciat sDua(  ;u1alx mociad m2ua(ms u0aetoxf3iytla eauesls)sexoio3oy1omtemnctlt arrmu o;u1texn fctyd s2rm( o;t)alenxr3totoptranesls t2xrxm oodamt lfcil(fsDta(m no4aetnioctlsfm2rm(vs;u4 ltomr iotlm  an o s t2trxr3oudlle  ncia()sDraxm ot0aexnmo3iadls ea(vs;t)aleoxocoy1lmt li i;(0t2xm(m3iodlmte fviat a2tr( p;u1tpt  fciadfsDul(mo;t)texoxrciy1opDrlnvi s  2xoxr3oo1alenmfetl(f Draxmpnt0tpeomieild s emu p t0tetrmo3oytomt  n o s)trtrxrpiydameemieil()aDtrxmo;u0aexoiietas m umuvo (0 etnxr3ootopD  ivs s) ruoir3nu1lpt  ncs sfsrurx pnt1tlt iiciydfs2rmumo t)arerxo iotoa r neilt trxoxopiu4optnlnctltf 2rrur ;u1ale  feiysla elnms;u4tetoir3ootfaDe n o t)seur(opoo4optnmfcil()a2ra( poo4alxomfetasfa uluvo u)aexrmr totlpDr ivi t)s2umxopno4am  lnvt s) 2taum no0texoifciysfaDumn o u4alenxf3iytopDr ieols) 2uoim3iudlpt lnciat artm(ro;o0tlx  fetyslm2ea(vo;(4 rxnxo oatfmDean i t)seto(opnodlm e fvs t  2rm(rp;t0tex iieiydlaDrlums u0artrxo to1lm rlnvi;t) eumxmpnu4om n iei ( sDrmxmpou4aex iieiys a2uanmsn(4tlxrxo3tadlp e neslt)s2umxm oo4omt lfci s a2umur ou0tetn ociys s2umuvs;(4artnirciy1la  li i t t2xrxmpiu1am  mieias)sDtruroou0tltnifetydlmDea(mont4teenmo3iydoatrln i (0 2xo(r3iu1am emneslt)srraump;u4aee miciadls2ra(vp t)texnxfcoatoptranvilt0t2xrxopny4opt  fctasfa2trx pot0tlx iictydfmDeauvp;u4tetrif3iytlptrauvil()sexoio3iydlmtnlfvs tfs2taxrp;u0texo feilt sDumn o;u4tetnio3iytlm elivi s)truo(mpnodlmee ieils) Dtmu  nt1tltnmo3iatls2uaumont)altomf3ty1oaD aivo;s) 2uo(o3iu1amte nctlt)srtaxmpou0olx mo3iyt sDuanvo t4texrmf3oy1faDrlu s () 2xmimpoy4ll   ictat  Dtaur ot4olt  i3tldfs rmnmp (4arxnmr3tytla eaivo () rxrir3ny1ape  nvias) 2tax o;u0ope ioetlt sDuau o;t)trtnxrcoy1fmDrauvil(  2xoio3iudlp n nes s)a2trxm ot0tetnmf3tyd a2ea( p u0 ltnmrciatop eaivi;t0sruo(rpny4lp nmfesl(farrr(monu0olxnmoctltlaDuau s u) eerxr3iatoat aivs;()trurxopoo1llen ncia(fsDtrurpou4olen iciydfs2uluvpn() eermf iadopteaivi s) rtrirpno1aleemfet ()s2rrum nt0aptniietlt s2ra(vs;u4aetoxo3ia1opt aueil(0 rxrxmpiu4olenmnvi sfaDum(rpnt1tltoifeild a2um(vs;t0 eeoxo oytfa  luesls teuoxm oydam   ictat  Dtmu pnu0opxn o3tatfm emnmsnt0tlxoxo3ootopD aivo;(0 euo(mpoy4optemictls) 2tmum ou1tpen fctyd s2rmnmo;t)areoir3tadomteauvols srxmxr oy1omte fct s s2rm(mpnt4tex ioeiydla el(mp;(4 eenircia1omD  neil( s2xmxr3iudllee netlt)a2ta(monu0olenmfeiadfa em(vo u0aexomo tatomtr n o;()t2urirpny4omt  fvsl(fa2ra(rpoo4alt  f3ilsls2eln p;t0teenmf oydfmtrluvs () 2umim3oo4al nmfvi t aDtauront1alt mfctls m2eanvpn() lerifciadomD ln i s) rur(mpoydop   nei (f rurx pnu0olxo i3tat sDulu on()teermo3oatlmD ln sl(0 2xm(opio4lmtemnvia( arum( ooo1tptnii3iat m um(von(0arxomf3iytla eanes t srurim iydomenlivs s) rrax  ;o1teen i3iydfmDum(vs t4aleomo3oadom eaieo;s0 rtm(mpoy4apeemfei (fsDuauro;o0texn f3tat sDem(mp u)tlerio iydoat lnvils0sexoiopiudopeelncsl()s2raurpou4tlx  feiasfs elu s;(0aexrxfcoatom  livils0 2tmxo3no1ope  fcs ( a2raxro;t0olx  f3tytls em(vp;u)tltnxf iodopD aivs (0 exrxr3oodale lnvtls srrax  ot0tpenif3iyd mDuauvon()trxrif totoaDe ueo t)trumir oo1om elfeias s2tmxmpnt0ope mfctls sDel(vo;t4artnxfcoadfaDrlivs ()t2tm(m nydaptn ietltfa2rrxr ;u4altnmfciadlsDeluvo;() lxrxf oydop r neo t) 2xo(r ou1om  lies s)aruau  ou4aetoii3iyt m eanvsn() exrxrciatla rlu o s)tetoio3iy4lp emieslt)s2umurp;t0ale if3iyt m2em(vont4tltoio tydfpDrauvil(  2xrir3oudopenlivilsf 2ur( pot1apxnii3tatfm2uauvont0 ltnmr3oatop rauvo;s) 2tmir3iydlptnlncslsfa2tau o;o0ale  fcilsla2uluvpnu0 rtnio3totlmteanes;s0srxr(o3nu4ap emfvslsf 2rr(rpnt1opeomf3tldla2elnvp ()tltomr3tadomtr uvi;()trtm(o ny4optelfctl(  rrr(rpot0tlxnifciltlsDrmumo u) leomo3totlptrlnei;s0sexoir3no4amt  fvsa() Dtaum nt0ope mieilsls rmnvp;u) ltrmrcoytlmDeaneo ()sexoirpiu1llenmicils  2ua( p;t0tpxoifctltlm uaump;()alxrxfcoydoaD lu o t t2xmim3nudllt mneiltfs2ua(monu0optniociydfa2ulums u0trerxf3oadlaDeanes;t0tetr(mpoodole lnesat a2ta(rpno4tltnif3iadfm2rlu p t0 ltoir3iytomD lneslt0 etrxm io4apt mnet ( a2rrx o;t0oexomfeildlm ea( o;t4aeeoio iatla  au i (0t2tm(opiu4altn nesls artmxr ou4aeeomfeiyslsDean p (4altrmocto1la  livil( sruoim nudoptnmncslsfsrraumono1teen f3ildfaDea(mp;u0aexnio3iytom eaivs;s  2trxm iy1lpenlnet sfs2urx onu0aptnif3iysls2em( snt0aexoxr3tydoaD li s;(0 eum(o3nu1amtnmivi tf rrm( o;t0optomoctlsfa eluvo u0tlerxf3tydfmD an s;s)trtoio iu1olen fetlt s2ra(rpoo0tpen f3ild s eanvp t4altnmrcty1opDrauei ()srtm(m no4omenlnci (fs2trxmp;o0oet mieilsla rmuvp;u0arxrmo3tydlpteai s () euoxrpiu1ol  miviltfsDur(mono0alxnio3ias a rm(ms;()treomrcoy1oaD  ieolt)srxr(rpnudal  lnvs ( aruax  ou1tptn iciyd m2ul(vsn(0tlxrmf tytoa  ln i;t0 2trirpny1op nmfcsa()sDrmu  nt0ape ifcildls2umnmsnu)tlxnmr tatoa   n s s0teurxo3ou4open neta( srrru  ;t4ape io3ildfaDra(mp;(0alenmrciadfaD lnvil() etmim3nudlptnmncsls)s2trur ot4opeo ieils m ulu s t)tlxnmf oodfa r u ils) rxmxm3oy1altelfvi ()s2taur nt4openmfetytfm ea(msn()aetnio3iatlat lneol( seumir3iu4am e ietlt s2tau  ;t4tlto i3ild s2el(vo;u4teenir iydfa r ues ( srxm(m oudol nlicsa(faDraumo;u4tltn ociytfm umn snt0altnmociodfp e i s (0t2xm(o3oodop nlfvtl(faDtmxr ot1tpt mfctatfm2ulums u0tetoxociatfmD auei ( s2trxmpiodolt  fctas)sDrmxrp;t1oexomo3iydlsDul( s;(0tltnxo3oy1faDeli ilt0trurimpny1omen ncs t  2urumoou1tpeoiocils s2rm( o;u0aexnmo io1fp   neo;() rxoxo iy1al e iciat) rrm( oot4tpeomi3iadfs2el(vo u0trtnxocoatlm  auvilt0s2xoxr oydapt liei () rtr(ro;u1alxn feiaslmDuanmo u0alxnir io1oa eaiei s) ruoir nydoltn fct s) 2tr(r ;o4opxo fetys s emuvp (4 ltoif3oo1fat lu slt) rtm(mpno1olee fei t)aDrmump;t1tlxomoetasfm2rluvo t) lxoxo oydfpt lueo;(0trtoiopnu1op elnetat)arrrum nt4texnmfetas a2ra(mo (0 eermr ootoaDraues s) rurxrpnu1op  mnvtl(fartm(m no0tee  i3tadfm raumsnu0 rtoio oytlpDr ues s teur(r oo4omtemfcia()s2trxmoot0oee  ociatlsDran sn(4arxomrciadlp   ivol(0 rurxm3nodlpee fctas aDrrur ou0tlt mo3ildls2ra( snu)aexnircoodfaD  nvolt0 rtm(r iy4lmenmfet t) 2ua( pno4opxoifciltlsDemnmon(0 lxnmr3totfat  u sls0trum(mpoy4am  lfvs tfsDrau  ot0optomoctasfsDul(msn(0trxoxfcta1fateanvi;s t2umio ou4om   nvtlt  Drmxm nu0alxo f3iasla rauvp (0 rtnif iatfaD anei;(0 2xr(mpoo1lleelfesls a2umxm ;u0tlxnmoeils m2uan on() eenir io1lm e i s;t  2um(r oy4omen nvsas)sDrmuro;u1aex  o3ilt mDulu sn()aeerio oatfm rauei;(0 etrxr3oy1oltn icias)s2um( o;o1olx  octys aDuln s u4altrxr3iatopDe u o;t0s2umim3io1omee nvslsf rrmurpno0tlxniieiatfa emu s;u0trtrxocoadlm   neils0seum(o3iudllte ict ()a2urxrpnt4oee  feiltls rmu ont)aeenio oydla eai ol()trxoimpoy1op nmnvt sf 2tr( o;o0alxnii3iasfa2rln onu0trerirctatlpD aueo;t0tetmxm no1aptnlnetlt)aDrax p;u1aleo ociatlm2emumo u) etnio3oo1fmteluvo;s0s2umxmpnu1lmte nei ()srurumpoo0apxnmo3iltfaDulnmp u) rtoxo3iy1faDran i;t)t2toxm3oudape lfvt (faDurxr ;u0tpxo ietas mDrln p;u0aeenxo3ia1optranes (0s2umxm3iudopte fetat)sDtrurpnt4olxomo3ilt sDelnmpnt4aeenxr3io1fmDeaues;s)texo(r nu1amt mncs tfarururpnu1olxomf3ildfa2rmnmpnt0 rxrmf3ootla r uei ()trxoirpoudalt lfvtltf 2rmxroot4tpxoifctasla2rm(ms () ltoxf iatomDr u olt) rtm(rpiodale  fciasf rur(ronu4tpe io3iadlmDumnvo;t)artoxfciydlpD aivo (0s2umir oy4lp nlnesls)aDum(mp;t0tpto ieiadls2um(msnu0tetrmr3oodlmt livi;s) etr(rpnu1apt livt t)aDum( ooo1opeo iciytlmDulumpn(0 lxrxf3ta1fat lueils  2toxr3nu1lpenmfctls) 2taxmont4opxn icils sDrlu p;u) rtoxf oy1oaD anesl(0trtmir nu4ape lici () Dtru pou0oee mo3iltlmDuaumpn()alxrmf3totop   uvs t)s2ur(r3io1ome lfvt t s2ur(ro;u1ope mfcildfa ea(vo u4 rermf iotop rln ol( s2uoxr iydlme mivsltfa2uaxmo;u1aetoifciltlaDem(mo;u) etnmo totfmD  ueo () rto(r iu4lp nmnvtas  rrmxro;t0oee mietatfa2elnvont0 reomr tatfmt luvo t srxrxmpoodapenmnet t)s2um(rpnt0alxnmietldlsDua(mo;t0altnmf iadfa r uei;s) exmir oy1alee iei tf rrrxmpoo4tleoioctadls em(mpnt0texnircoo1fa eaieols  2um(rpiu1apeemicsl(fs2rm(  oo1aee  ociysfmDuanmo;t) exrio tydoatraiei t)trxoiopio1lptnmfcsas  rtmur ;u4tpe iictysls raump;u4treoxrcootfmDr n i;t) exo(m oudamtnlivt (fa2ta(mo;u4olxn feiyslmDrl(mo;t0altomfctodlat lieil( s2umxmpiy1amtnmnei s sDua(m nu4olen fciyd s ulnvont)texomf3iy1oaDe neo;(0 rtmimpnudomee fvsas)aDtmu  nu4oex ifciytfa ulnmo;(0aeeomo3tatfmt  ieilt0 2trxo nydamtnlnci ()sDrm(r ;u0oleoif3iatlaDrm(vpnt0 lxnif3oydoatr nvi s  ruo(rpoy4op   fvi t)a2rrxmoot1tlenifetasfm2ea( p;t4 rxnmo io1faDelivo;s setoxmpou4lpenmieil( srraxmoot4apt  f3tyd m2eau p u) rxomf oytfmDrluvo;s t2trim3iy1ol nmivtasfs2tmu p;o4tpto ocildlmDraump;(4trxrmr3ia1fa  auvi s  eto(mpiy4ame mfvtls srtrxro;u1texn i3iat aDuluvs;u) rxnir oytlat ln ols trtm(o oodamee fcsasfsDraumpno1altomoctat m2rmump;u4 rtnxfcio1lmtrluvo;t s2xmimpio4lle mnvt (  2umxrpou1alx mfciysfm2rl(vo (4 rxnxociadfpDeanvsls tetoxrpny1ome lnvi ( arrm( p;u0altoio3tytfs2rluvo;t4trenmrcootlateaivs;t srumxr3nu4olte fvtat)a2rrum ;o4oeeniictldfa2ea(vp;t0tltoir iytfpD aies s t2xoimpny1ll n nvs ()aruax  ot0apeo fctasfa rl(ms ()alenxf3to1oaDe ivo t0t2trxopoy4ape  ieils)aDtm(rpot1opxo o3tad a rluvs ()artrir oadlm eai s (0srxm(r oydlmeemietls)s2uax poo1olxn octat m2em( p;u)arerxfcoadoat lnvi;t0s2tm(o3oodllte nei sfsDururpnt1tpt  ietydfsDrmuvs t)aleomfciadom   neol( t2tr(r3no4op nlfciltfsrua(m ;u0tetomoetyt a2uanvs;t)tlenmr3oa1optr nvo;t0srur(r no1aptnmfetat)aDrrurooo4aexo oeiatlsDrau o;t0teeoxr3todlmtr i ol(0trur(o3iy1optemietltfsrua(mpnu1texoioeiadfm2emuvp;()arxomr oo1fmte neol( t2uoxopio1apt mivs ()srra(r no4oet if3tat a2el(vo u0 ltnio tytoaDeaivo s srumirpiy4lmt lfetls sDur(r oo4opt  i3iadfs2em(vp;u)aeerxfciodfmt lu ols0srxm(opno4amt lies s) rtr( oou1apeo ietltlmDum( onu4tltnir oadfm eaues;()s2uoxo3iudlp nlieta(fsDrrurpou1ale mociasla2el(mo u0aleomo3oo1fpDrlu o;t0 etoxo3ny4om elictl(f rumu pou1tltniietltla emumo u0alerif3totomt aueo (  euoir oodlmt  nci sf Durur ou4alx  o3tat aDea(vp;u4 etniocoatlmDrln i s  2xo(r3iydape lnei ()sDtru  nu0apt  f3ilsfs emuvp;(0tetomf iotlpt lueo;t0teumiopoy1ome lictl( srtrump;t0optomociatfa elnvs t4teeoif iytfmtranvs;s) etrim3nu4ameelivtl(f Draurpoo0opxomoeiysla2rm(mpnu)aexrxf iatop ranvilt  eto(opou4open fvtls srua( pou4tpxomf3tysls ulumpnt0artoir3iatfateaiei ( t2umxopiudlmeeliesasf rta(ronu0opxo f3tas sDumuvs t0trtnio3to1fmD  u sls) 2xrirpno1amtemnct (f Drmur no4opxnmfeils mDulnmp t0trtrxfcoydfa rlu ilt0truo(mpny4omtelneta( srrm(r no1alx  oetydls2rlu sn()aexnxocoytop rli sls setrxrpiy1lm nlncs t)a2trum ;o4tlx moeiydlsDeluvp u)alxoir oodfpt  n i;() 2xrim oudomee feiltfarta(m ;u4oeeoiiciytfs ua(ms;u4trtrircto1lmD an o t)srxm(rpoydale lfeslsfaDtmxr oo1tex moeildfmDel( pnt)trerioctadfate n s t seto(o oydamt mfvslsfs2uru pou1aetomi3iydfa2ran s;(0alxomf oodoaDeaneolt0 2toxo oo4olee nes s  Dtrx  no0oexoio3tlt aDemuvo;(0 rxnxrciytfa   n i ()s2um(o3ou4open netls  rrmuro;u0tpx mieilsfs2rmnvon()arenif tadomD  ieo;t) 2tmimpou1al n ivs t) Dtrxmoou1tlen o3ilsfa2rlnmon(0tetomr3to1lmtraueo t)s2umxo3oudllte ieil()s2trum nu4oeen ieiad aDrl( s u0trtnif3oa1oa   n i s0 eumxrpnudop emnesl()a2um(mo;t4aptn ictas m ea(vp t0trenxo3oatfate u ols)trtm(mpnu1op e icsl(  2uax ooo4opeoiieiysfm2el( on(4texomfciodfm   n olt)s2xo(o3oo4apte ivtls a2tr(rp;o1tleomieiyt mDrmuvs;(0tleriocoydlp   ivilt tetr(opoy4lm nlnetlt)arrm(  ot4aeenio3ias sDrm(ms;u4artnxfciatoptelneilt  rtoxo iudlp  lietl( srrr(r ot1texnif3tyt aDrm(msn()arerir3io1faDr uei;s0s2umirpnydlp nlfvils  Drrx oot0tpen ocildlmDranmp;t)alxoxfciadlpte uei t)setrxm nu4lm e nvsl( sDtr(r ;o4tet  i3ild s rau s;(4tetoxocta1opteaies;s)t2ur(r3ou1omtemfvtas  rrrumpnu4oetn ieiltfs2emumo u0trtrio oodla rauvs t0t2tr(m oodap  micslsfartrumpno1tetn feiltfm2emnvo (0trtoxocoadfat ln slt) 2ur(r nu1omtn ivta( aDta( ono4apx  oeildlm2ea( o ()arenxr3oa1lat lnvs (  2xoxmpoo4am emfet tfs2rm(  nt0oex iiciyd m umuvs (0artomf3todoa e u s;t0srumxm3nydolt mnes t a2ur(rp;t1oexomociadlaDeluvo t)aexrxo tatlm r n sls)seur(m iu4lm   iet ( artm(r ou0tpeomfeiltla el(ms u0tltnmrciydoaDrauvolt0 exo(o nudamenmics sf rrmxmo;t1teto f3ildlsDuluvp (4 eeomo3iadom rluvs;s srum(r3oydolte fcta()artrurp;o1tpxo fctldfs2rmnmo u0alxoif3oy1laD auvo (0 2uoirpoo4olteliesl(f rrr(rpno0teenmietat aDeauvo;u0aeeomrcoy1fmDraivo s0 2tmir3nydlltn nvt () rtmurpot0tleniiciadfm2elumsnt4alxnxrciy1lpt li i s  euoxm3no4lmeemnet () Dra(mo;u4tetn o3iltfa ea(mpnu0tltrmo iatomteln sl() rto(m ou4omtnlnei s  Dur(r nt1tpeomo3iyslm2rm(mo t)trxrifciy1fpt  n sl( tetrim oo1lpe livt t) Dur(rpoo0tle  i3ildfsDrlnvp;u0alxrircoadfa  livi t0 euo(opiu4lmenliesltfaDtmu  ;t1tlxn ociltfa rlnms;(0 lxoir oytfp  aueilt) eur(opny1om elfes () rraxroot1tet moetad a ulu on(0 rxomo3iydfaD luvo;s0 rxoxr iy4alte fes ()aruaxmono0oee moeiysfaDrl(mo;() lxnmr3iodlpteaivo;s trxo(mpiy1amt  ncsls)sDtr(mpnu1ole if3tyt s2uan o;(4tetomo3oadoaDrai o;()s2uoxo3oy1apeelieil( arur(  ot1tlen ociltlm2ulu onu0teeoxr3tydomDraivi t seum(opnydom   fctasfarra(r nt0oltnioeiltfa eau p u0treoxo3iy1fpD  ivo;s0 2tmim3ou1omt  fvia( aDumxro;u1opxoii3tysls2rm(msnu0alxnxocoytfmD luesl() rtrxm oydal nlfeia( aDtrxmpnu0tleo f3tadlm rm(mp () etrmr tatlpDrluvo;s srxmxo oy1omee ncs ( artaur ot1tex  fctltlm2emuvpn()tlxrirctodlpt livols0 etrim iu4amte fviat)aDumurp;o4tpt mociydfmDeln s t) etrxociodomD  nvs s0srxrimpnu4optn ictl( sDtrurooo4apenifetyslmDumu o;u)aexrxr iodlp   i s;( texrxrpou1lptemfetas) Dtaxmonu0aet iicildla2ulnvonu0tltnxo3io1fat  nei;(0setm(r no4ll  lfetlt) 2tm(rpoo4tleoiieiatlsDemnmpn(0 rxoif3ty1la rluvols)t2xrio3iydlp nlncs t)arrm(m ;o1aex mf3iat m2em(vs;(0trerxf3oo1lp rln ils)s2xoxr3oydopeemnvtas a2trurp;t4texn ociat sDelnmp u) exnxf3tatfmDrlieo;(0 euo(r no4omee nvil()srtmum nu0olto i3ilt a rmuvp (0trxnmr3oatlp   uesls0 eurxopoo4ol nmfei (fsDumurpno0teeo fctaslaDrmuvsn(0trtrmfcio1oa e nvs;(0 2uo(mpiudlmt lnvils srrr(mo;o0tpx mfetltfa2ulu p;u0trxnxfcoy1fateln s t)tetmxopno1oleelfeslt  2rru p;t4opx  i3iydfaDeanvo u4tltnmr3to1lm e n s;s tetr(m oy4am nmnesas)aDta(mpou4tpxoii3tyt sDumn p;() ltoirciotfmDrau sl( sexm(m3io1amt mnvt s aDrmx o;t4altn oeils mDea(vont)aeermr3iotla rln i s0 rumxo3iudlpe mfciatfaDtmuro;o1oee  o3ias sDea(vs (4tleoxrciatomD aieils)t2xm(m iodamtnlivi s  Dtmxront4tlt iiciysfs2emumpnu)aexrmf iodop  liesl()teumio3ny4ameelici s)a2uaxr ;o0aptn oeiat aDuau s u4texrxo3oatfptrliei s)setoxrpoy1ll emneil()aDuru p;o0tlxnioeildfmDum(vsn() eerxr3oytoaDeanesl()truo(opnu4lmen fetl(  rta(m ot4tetoif3tltfs rauvpnt)arxnmfcio1om  aieils) rur(m3oydopt lnetlt)artmxm ;u4tlen oetltlm2em(vpnu0 exniocty1oate i o;s0trxr(o no1omee iesltfa2rr(moot4aet io3ilt s ra(mp u4 ltrmrcoatlpD auvs (  euoir3ny4amt mnctl() rra(ro;o0tpeo ociatfm umu onu) eerxrctatlp r ies;()srumio3ou4lmtnmfvs t  Dua(  nt4tptn feiytla2ulumo t)trxrxrciyd
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;(0t2umxopno4ol n ivsatfartaxm oo1tetoioeils a2rm( p u4 eerxfctadfptrauesl(0trtmxr3ou4ameelfvtat)aDtax p;o4teeo oeiatls2rmumsnu) lxrxr ootfmtranesls0t2uoxopoudlmee fcta(faDtaxr ou0tetoifeiadlmDua( snt0altnxfctodoateaivs t0sruoxopnodoptelfctas  ruaxmpou0apxnmf3tasfaDrauvo;u0 lxrxocty1omDr ies;t)tetr(m3oudlme  fcs s)a2taumpou4altnmoeiatfm2eauvp u0artomrcoodlat luvolt t2toxmpoy1lltelfeilt  rrrx ono0ape mo3tysfm ua( sn()alxrxr3totfmD lueo t) 2urxo iy1lme lnctat)a2tm(  nt4teeoiieiad m2ea(mon(4 ltnmo iytlaDr nvs;t s2toxm ny4aleemfviat  2rrx p;t0aptn ieilt a2raump t)alxrmr oo1laDraies;t  2xmxm iodam elfes tfsDuaum nu0apt ioeiadlsDumuvp u4tetoiocoytoptrlivi;t  2tmxo3no4ame  icil(f rum( poo4opx ifeiat m2emnvonu)tleoxf ootoaDrlu i;(  exo(m iydomeelfes s)s2rrxmo;u0optnmf3iatla um( pnu4 eeoioctatop  auvo s0 etoirpnu4oltnlfciltf 2uau  ot4ale  f3iytfm2eau pnt0 lenmf3oydlatr u i ()teum(o io1lle mfes sf ruaxrp;o4aleo ieilslmDel( o t0 eenifciy1fp rli sls texmxm3oodomtn nvsas sDuaurp;t0tpto ociasfaDuanmont)trxrxr3iotfmDeauvs;(  2uo(r iu4al nlietatfartrxmonu1tlenii3ilsls2uauvp t0aetnmocoydlaD  uvsl( s2ur(rpoy4lptnmncs t) Dur(mpnu0tptnio3ildfsDumnmonu)aexoirciadfmteluvo ()trxrxm ny1oleemicias arraxrpoo1opx ifeilsls elnvsnt0tlenif3oa1op  auvs (0s2trxo3iu4omenlfctl(f Dtr( oot0tpxoioeiaslaDua(vpnt) etoxrctadop  auei s)s2uoio nu4opt mfvs (fsDur(m oo4apx io3taslaDem( s (4 lxrmo ootoat  i ilt s2xrio nudlpeemicilt a2tr(r ;t0olt iociasfaDra( sn()alxrxf oatlatr uvo ( trtoxo ou1llee fctl(fsDtrumo;o1opxoio3tlsfsDel(ms (0aexrxociytopDran o (0srxoxm3iy1amenmicsl(fartm(rp;u0tleomfeildfa2umuvp;t) rtnxrctodfmtrai sls t2umxm3iudam e ncsas)s2trxro;u0optnmi3iys aDrm(vp u0 leoif3tatfp e n ol(0 ruoxm iu1lpe micilsfs2uaump;u1alxn oeild a2emnmpnu)aetoxf tadfmtrln i s0srxo(o nydom  lfvi s) rrmxro;t0teen f3ils sDelnmo u0 renmo iy1laD  n s (0texrim3nu4lp nliesl( s2uaurpno1alxniictydls2ua( on(0teenmf3iodfm   uvo;(0 2xoio3oy4amtnmncsltf 2raxr ou1ale mf3tys s ulnvsn(4 eeomr3iadoptr nei;t srumxr iodol nlieiatfarua(rpou4apx iietyt aDulums;t)tlxnif iydlaD  ivilt0 2trio iu1al n fcias  rtrum ;o4aeeo oeiat s uauvo u0aeenirciydfa r ivil(0 rxoir3nodllte fcsas)s2trxmp;t0opx if3iatfmDrlnmo;(4 lenxf tydom rlnes t)s2tmim iy1amt lnvi ()aDurumo;t4tpxnmfeildfmDulnmsnt0tltrmf oa1lmteau i () euo(o3iu4lp nlivs t srrmu ont0tpxnifctadfm2ea(vs (0 reomr todomte u i;t trxrir iy1amtemfei t)sDtaxmp;t0tltoifeildla rl( o;(0alermf oy1fm  an ol(0tetm(o io4lptn iesasf 2rrumoou0texnmfctatlmDea(vp;(0tlxrxf oatfateai sls  rtoxo nu1ll elfvias)sruaxmonu1tltnioctytla um(mont0arxnxr3iatfpD  nei;s0 rxmxm3ny1lm n iet s) rumxrpoo0tpt  ieiatfaDrlnms;u0arxrxr to1latranei;()s2xmxo3nu4lmt mnctl(farurx oou1alxomi3iyd a2rmnms u4 eerxo iadlp e nei;s)texoimpoo4am   nci sf Dtm(  nu4oexnmfeiytfaDumnvs (0aexrmf3tytlpDrai s;s0 2tr(o3nudlm e fvsl(fsrrrumont4tpxoio3iadfm2emump;u4 exoiocoytfpDeaivs (0trxr(o oo4apt  nvtlsfaDurxrp;t1tet  o3tlsfs ranmpnt) rtnxf oydoa eai s s) exmxm iu1ap elnesas) rraumpno0tlx  ietldfm emuvp (4 etomo ta1fpt aueo;t0 euoxo oy1lm nmivt tfarrrurp;t1tpen feiyd s eln snt4tetrxf3oodoaDr i ols0trum(o3ny1lle mfesasfsDua(r ot0aeeomociaslmDean sn(0 ltoiociy1oatr ies;()srtmxopio1opt livsa(f rururo;t1olx  o3ildfa um( p (4trerxo iydfmte nvslt  rto(opoo1lle mfvslsfaDtm( p;t0oeenmi3tls mDemuvpnu4trtnxf3oodoatrlivo s0 2tmirpiudlmtnlfcsas  2rr(mpnu0ale  oeiasfsDum(ms;u4teerxf3todom rlnvolt0t2uoxrpio1am nmfesasfaDraxrooo1alxo octas s rau s u0 lxrxo iodfaDrli s t seurim3nodome lnei (  rumxr nt1altomfeiytla eaump;t0 rxoio oydlpDelivslt0 exm(m3oy1ap   nes t)sDtau pnt4aeeo octytlsDrlnms t0trtrxf3ty1oaDr ivo (0sexm(o3no1ome lnesa(fsrtmu  ;t0aexoifeiltls2rl(mo u)teeomf3oa1lat aueo;t) etrxo iydam  mnet t s2raumpou0oltoii3ias a2elnvo u0tlermoctotfaD  ieo;()seurir3iy1lpt lnvi ( a2tm(m ;t4oexo f3iydfsDem(vpn(4alxnxo iadfm  li s;s)s2uoimpoudlmeemivilt)artr( oot0tet io3tas m2ulnmpn(4 etnxr oydopD  i s t  rxo(m3iu4alee ictltfa2trxr nt0tee  i3tydlsDemu onu)aetrxr iy1lpDeanei s s2xrim3oydal   nvi ( arrrump;o1openmiciyt aDrl(mo t4 eenmf3todlmDr nei t trtrio3nydoltnmivtl(fartmxm no4alen octltls2uau p;u)tltnxr iatfpteai sl() 2xoxmpoodomt mncsat  Dtr(r ;o1aeeoioctas a rau onu) etrxr oodom  anes s0 exm(m no1ol e ncs ()a2rm(rp;t0tpt mietydfsDuauvo (4trxnmf3oytfa e uvs (0t2to(opou4ope mictasfsDtmxr ;u4tex  fetytlaDeanmpnu4tltnio3tytla e iei s seuoxm io4am elivilt sDtrum nt4tltoiicilt sDean pnt)aetniociydom r ues;t0 2uo(m iy4alt  fesls aDtrum ;t4aleniieilsfm2ra(vpnt)altrmo3ootlm rlivo t)setrxmpnodol  lfes s)s2ta(mp;o0olxo f3ilt sDranvs u4 exomr3to1om eai slt) 2um(r oo1amt mnvtasf Draxr ;t0aexo f3tat aDrmumpnt)artoir oadfpD auvsl( trur(rpno4lptnmnvilt  Drmxr ot0opxnioctas a2ulnvo;(4tlxoxo ootopDeaiei;s0truriopou1lme lnctl() 2rm(m ot0aexoif3ilsls ra(mont4texoir3todoa raieo (0 rxoxrpnodlpe lnvsas sDur(rpoo0tlt mietydfaDel( s u0treoxr3iytlp r n s;(  rtmxopio4omenlieiatf 2rax poo0opxnmieiadlmDran o () etrir3to1op  lu il(  rtoxm nu4lpt lfct t  Dumxroou4oee iieiytfs eanmo;t)tlenio3totlptelivsl()sexrxo3oydllt  nei s)aDuru p;o0apt  fcils a em(mp;()arxrir3iodfmDelues (0t2xm(m oo1alee fcsasf rrax p;u0olt mieiyd sDumnmo;(4arermociytfpD  i i;s0trxr(opoodomt  nes ( a2ra(m nt1tlt  f3ildfs2eau pnt4trxrircoy1opD  ivi;(  rxrxr3nu1lpen icsl( a2urur no1oetnmf3iysfsDua( o t) exoxf3oydlpD lnvi;s0seuo(m3oy4omtnmncta() rrr(m ot0alenifeiad a2ra( p;() exnxf todop  anei t seumir nudlle  nvi tf Dtaxr ot4alt mo3ildlsDrauvs;(0alxrxfciy1oaDrauei;(  ruoim3oy1ap e ivsl( artrxmoot4apt ifetat m2ul( p;u)artrmrciotlmD  n slt s2toir3nu4lp e ictls)s2umum ot0aex  o3iat a2elnms u4trtoxf3oadopDe u i (  2ur(r oo4openmncias s2tmxmpno4opeoii3ild a ra(mon(0tltnxf ty1om  lies t)s2uo(r3iu1al nmnesat)a2taurpnu4ale mi3ilsfaDul(vp;(0 exniocoy1la  aieols0trtm(m iy1oltelivilt s2ta( o;o1tpx mfcilsfs eanms;u) leoir iydfpD  nvi;t)s2xmir ou1lleemfcsls)arurxmpoo0oltnii3tadls2uaump u)tetomfctatlp eliei;(  rtoxm3oo1ol nmieslsfarrmuroou4olxoifeiysfaDuanvp t4trtoxf to1optr u ilt0 2ur(opiu4apt lnci () Dtmurpno4ope  oeiyt mDeanmsnu)artoxf3iodla   uvs t  2ur(rpoydal emfvt s aDrrxmpnu0tleoiiciytfsDua(mpnu) etnmrcoytomt  ies;t  2urimpnu1alte fct s) 2tm( o;o0tltn feiydfaDeanvs t)texnmrciadlmD aiei;t srurxm iu1lmeelfcs t s2rmx ooo0tlxnmfciydla uaump;u4artriociydlatr n o s)srtm(o3nu1ap  lfcias) Drrxm no1aptoif3tysfmDrlnms u)texrxr ta1fmDr ueo s t2tr(mpiodlme mnci (  Dtmx pnt4optomfeils a umnvs (0tetrxr tytoaDeli o t0trumim3nu1al elivil( sDtm(r no1alt ifciytla2ulnmonu4artrxo iatlat luvi s0t2xmirpnu1lmen icsl( arraxr ou0oetoio3iys a eauvs;t)texoif ia1laD  ies s0srtm(m oudop  lncsl( aDtm(mooo4olt  ieiydlm2um( o (4altnmociatfa elies t  ruo(o nudllte fctat)aDrrur no4tlxomoeild m2um(mpnt0trerxf3tydoa  auvi s)trur(mpou4olen fcils aDtau poo1tptn oeiad a2rlnmp t) etnmr3oytoa r n o s)s2xmir3iy1om eliesa( a2ta( pnu1openmiciaslm el( p;(4 rtnmr to1opDraivi (0t2urxo iy1opt  ivs s)arrax pou4olxomf3iytfa emn p t)tltrxr oodfat lnvo;(  2xmio3nudll e ietl()aDtmum ou0teto ocilt mDel(vsn()tltrir3oatlaDrau i t srxoxrpou1op  lies (f 2taxrpou4teeoiieilsfmDraums u) reoxr3iy1lpt an o;( t2tr(m nu4ameemiviatf rrrur no4apx mi3iysfaDrl( on(0 rxoio oa1lmt  nvslt srxo(opiu4lle mieslsfs2umurp;u4aetoifctyt a2ul(vo t4arenirctadla r nvsls)srxr(o3oydap elnciasfa2rrx o;t1oexnmi3iatfmDumn p (0tetoiociatlmD  n o t sexoim oy1lmtemnctlt)arur( oot4tpenmociysls2rlumon(0trtrmo tytopDe n sls t2urimpiydomeelfvil()srra(rpnt1teeo i3ilt aDuanvo;u0 eeoir ta1laDe i il(0 2umiopiudllee fcs (  rurumo;u4opt mi3iyt m em(vpnt0trxnxf oodomDeai i (0 2xoiopiudoltnmnctl( a2urumpnt1tlto oetld s2elnmonu4tlxnmfcoo1fp e i ol()srum(o3iy4op elicia( aDum(mo;u0openmociadla2ea( p;t4tltnxfcoy1oatean i ( srtr(opou4olt  icil(farrmurooo4tltn icilsfm ran ont4alermf3to1lp e u i;s0 2xoxrpoo1ale mnvsa(f 2raum ;o0alen fciadfs rl(vp t)tleoxr3todopte u o ()s2xo(opno1omee nei t  2tr(r oo1texomf3tasfm2emuvs t4artnircoa1lm rlues t0 eum(opoydap  lneslt sruaur ;o0aeen fcils a rau s;t4alxrmr iytfaDe uvs;t)t2toirpiy4apeelnetls)aDtmx pot4aeeoii3tadlsDea(monu4aleoxf3oytoa r i o;( setmxr oy1lpen fcs s s2rmum ;o0aeenio3iatlaDranmp u0trtomo oa1faDrln i (0srxo(m3iy4llenlfeia(fartruronu1tpxnmo3tytla eluvo;(0aexnif3todfpt aueolt tetoio nudlmeemicilt) 2umuro;t0apenifctydfm eau p;(0aleoir totlmDranvo;() 2trirpnodap e fes s) Dtm( p;t0opto oetas s rln p;u0artoifciatfpDr ivs;( setmxm3oydolte ics t  Dtr(r ot1oltn ieiyd a uanms;()artrio tadomteanes;s)setmxr3iy4om  mivtlsfa2ra( oou1aet mi3iytlm2elnvsnt) lxoxr ty1fpt anvi t0s2xmxmpoo1ape lietls) Duaur no0opxnio3iyslm uanvo;(4arenircio1fp   ivo;t srxmxo3oydalteliciat)arrm(m no0aptoiociytfsDel( s;u)aexrxr3oytop   ies;( s2xo(opoy4amtelfesat sDuauroot1apt  octltlmDea(vpn() reoxrcoytopD lu o;s t2uo(o oo1lptn fci () 2ta(r nt0altomf3iat a rl( snu0trtrif todfate n ilt)teumxrpno1lpen nvtlt  Dtmxm ou1tpeo fcilt a2rmnvp u)tetnxo oodfpDelivs t  rtoio3nodamte nvsatfa2uaxmo;t0aet iietasla rl( onu)arxnmo iydla r u s ( trxoir3oydolenlfvs t)srrmumpou1tlenmi3ild a2emuvpnu) rtnxf3tytfp rlivs s  exmirpnodol nlfcsls)srtmx p;t1ole ifctls aDua( s;t0trtrio iadfpD  neo;s trxmxo iy1ll  lfesa(fartaumpot1oex  ieiytlm2rauvsnu4aetoir ia1lpDranvsls truoio3iy1lmtemiei ( arrau pno4olenmfetytfs umuvpn(4altniocootfp   nei s0 2tr(o ou1am  lfctat srtmxmo;t0teto ietadfa ulnvont4 rtrxf3todfp elues;()srxmir3nu1om  mfci s)aDtrxmo;t0oltnmoctasfm2uaums t) rtrmf tytopDrauei s0seurxmpny4om n fci tfs2urxm no0tet moetat mDranvo (0 rtoxoctydlp  ln i () rtmim iu1lm  lncilt)s2ur(mpou0tlx  iciasfsDean snt4alxnxocootlm raueilt tetoirpou4llt mnes ( sDumurpno0oltnmoetlsfm rl(mo u0tlxoxo3io1faDeanvs t) 2trxo3nu1lp nmnctlsfa2rrumpnt4altniociatfa2um( o;(0 rtrmocta1fm r ivi;(0trxrxr iu4om  mietl(faDumump;u0opxoii3iyt s2ranvsn()tetrxf oatfm rau o;s)texrxm ou1lptelnvia(f rtrumpno0aeenmfetas s emnmp;t4aetoxo todopDraiesls t2xoxrpoo1lmee ncsas)s2rm(rpno0optniietlslaDuluvpnt4trtoxo iotoaDelu o;t0 rxmir3oudomenlivi tfaDumu onu0tex mo3tlslsDranvp u)altnmf3oy1fm eaneo;() rtrimpiu1om elfetl() rrm(mpou1aet  i3iyd a2eau p;u0 ltnif3iotoa  lies s0srxr(o no1opt  nctlt)srrrxr oo0aleniociyt sDuln o t) lerio oa1la e nvols srur(rpno4aleemivsatfaDrrxm nu0tlxnif3tls sDrmn o u0 ltnif3iadlmD  n ol(0srumxmpou4lpe lnvtlsfsrrr(m oo1alenmi3tyslm ran p t0arxrmfciodlm rai ol( srxoir3oydoptn netat)srtrurpno1oee  oeiasfa umuvsnu4 rerircia1faD lnvi;( trxrir oy1amtnlivta(  2rm(m nt0tlxoii3ilslm elnvo;(0tlxomf to1laD  n o;(0 rtrim nu4apen fet s  2tmxrpno1tpen fctadls em(vsn()alxnxf iadopt ln i ()seumxmpnydlltnlicsatfaDum(mp;u1opt ifciydfsDra(vo t) rtnxf3iadfatelnvs ( texoio io1omtemivtas aruax ono1tex mieiyd s2rl( onu4aeenir3todoaD aieslt)setoxr no1lptemnct s  2rr(rpnt0aeen oetasla rmnmo t0 eeoio3ty1lpt aueolt texrxrpoydlme mfctl( s2taumpnt1olxoioeiat mDemuvon(4 reomo3ootfaDrlnvo ()teumimpnudopt mivs t  rumur ot1altomfeiadlaDrl( pnt)tlerifcto1fp r uesl(  exo(rpny4am emncils)srrrx ooo1tleomoctyd aDuan pnu0 exoxr tadopD aieo;s0 exoxo3io1omee ies ()arrax pno4oeeoifctat mDrmnms;(4alxomf oa1laD li olt) rtrxo oy1omtnmivt (f Dtaxmp;t0oexn o3taslsDumumsnt0 rxrxr totoaDe u i s teto(opiy1ll emfvt tfsDtau ono4tlx mieilt aDum(vp t0 rxrxrciydfm ranes t0 rxr(mpio1lltemnctl(faDrm( ont0ole mi3ilt s ulu snt0tlxomr3oa1fmDrlues;t)s2xr(r3oodame lnvt (fa2ururo;t4oetn o3iad a rlnvpnu) ltrioctytfm  liei (  eurimpnu1optelict s) 2tmx oou0teeoif3iysfm2umn p u0trxrmo3to1latr ies () exmxrpio4olt  iet t arum( ono4tlxn i3iydlmDrmnmp;u) lxnmf io1oa eauvslt0 eumimpou1altemiesa( aDrr(mo;t4optoio3iydfs rau p (0tlxnxf3totfmD aivilt setrirpoodoltnlfetatfaDum( onu4opto fcild s2el(vs u) exrxf ia1fpDeaivo;(0srurimpiy4omtelfcilsfarur(rooo4tetniiciadla2em(mpnu4trtrmr3tytfp rln ol(0s2toxrpnydomee nvtat)aDrau oou0oetnmieias a2elnmp;u) rxoxr oatlmtr u o t) exrxmpno4ol nlivtltf rtmxro;t0tltomi3iatfs2rlnms;u4alxomr3todomDrln slt0 rto(opiy1amee iei (farrrurpno4oltn ieiad sDua( s u)artrir3to1fm elnvi;(0t2urxm oo4lpee nctlsfs2rru pnt0alx ifetydla2rl(mp (0alxomrciy1fa raieo ( t2uoxr3no1lpt lict t)srrau ono0texn ociysfsDulu o t0teenxf iodoptrliei ()trtrxo nu1olt liesas)arum(mpnt0oetomociadfsDrluvo;t) eeomfctodomtr ivsls0sruoxrpnu1opee ietl(faruaur no1aeen i3tatfsDemuvs (4 ltoir ty1om  lnvs;s)setoxopoydol n fvsl()aDrmxm ;u1oeenii3ilsfa2uln o () rtoxr3oadla e uvsls)s2uoxrpnu4lle  ictasfsDtau poo0opxnmf3iasfs2rlnmp;()texrxo3oydoate uei ()teumirpno4lpe mnvtas  Duaxrpot0optomietltfs2rln pnu4 lenxo io1fptelivo s0 rtmxmpnu1lleemfvta(  Dtmxm ;t4tptn ictasla ra( o ()trerxf3iadoa  lues;t  rxmirpnydaleemfeslt artrumont4tptomociasla2em( o;t4 rtnif3tytlpDe ueol( t2xmxr3ou4alte fesat artmxrono0oltoiicils m uaums;() lenmo oatlptr uvi ()t2xoimpoudaltnmfvils s2tax ooo0olenmfcils mDuanms;(4trenxf3ty1fm  lnvsls0 rxmio3ou4lptelfvta(fsrrmu  nt1aetnii3tatfm2uau s t)aexnxo3todfp rauvi ( trtr(o3no4alt mieiatfarua(rpnu1alx iictlsls ua( snt4trermo tadomDr uvs;t) exo(rpio4oltn fcils srtmum ot1teeomi3ilslm emn s ()altoir ta1latrlnei;t0sexr(o3iodlmte fcsat srua(mpot0aee ii3iatfsDrlumo;u4 ltomo3to1laD  nei t s2tr(opiydal n nct tf rtaur no1oleoioeiyt aDulnms u)tlxnxo ia1lm e n i s0s2tr(m io4aleemfvi (faDra(rpno0aeeoioctaslaDeau p u) eenifciadom raueo;t  exoio3iydomt licsas s2tru poo4aetnmf3iyd s2rl(mp u) rxrirctadfate nvi;()texoio io4lmtemnetlt)sDumurp;u4opx  oetldla ulums;u0 ltoxrctatfat lnvs;s0 rxriopnu1am   iesl()aDua(r oo0tle  ieiaslm elu pn(0trxrxocta1fpt auvo s0texrim no4oleelnet tf rrr(m ;o4tpe  fcild aDemnvp ()aeerif3oodfpDrliei;s)tetoxr3oy1olee ncsltfarrrxmpot0oet moeiydfmDuaumpnu4 lxrmfciadoaDrlies;()trxo(opou4ll nmnciat)srrrxm ;o4alt mf3tlsfaDel( o u4 leomfcoydfmDr n o;s t2uoir iudllt mneil(  2uaxrpnu4opxoifetlsla elump;u0 etrif3oa1oaDrli s;(0srumxr3iu1apte iet t) Dra(rono1optn ictlt aDrmn snt) lenxo iy1opDe ivs s0trxm(opny1am n neia( sruaxr nu0oleomi3iysfmDra(msn(4alermr oy1op  aneils0seurir iodaltn ivsat  Dra(mpnt4apx  oeiadfaDea(ms u0aexrmo3iydla e n il()seuoxopou1aptelneiat) Dtaxr nu0tle iicils mDuaumsnt0aeenxfcia1la eauei;t) 2xmxo3oydlpee nes s)aDtr(r ;t4ole ii3ildlmDulnmp;u) rtnmfctytoaD an i;(0teurim iu4open ivsls) 2tmxr ;u4opto o3iadlmDum( s () rtrifciydlmte n i;t)s2xmxm3nydlleemnvi tfs2urxmpoo0aptomfeildlm2ra( p (4trxrmo3iotlm  an ols0srtriopiy1ame miciat)sDrm(m oo1oexnioeiatla eau pn() lenif3ia1lpD  ivo;()srxmxm iy4amtnlfcsa(fsDtm(ront0ope ifciysls2elnvp;t) lermrciy1lmtr neol(  2uo(m no1opt  ici t) 2tmx onu1tex  f3ild s2umu p t4tleomo3oatoaD  i i s)trum(r nudlm  micsas  rrm(m ou1aleomf3ilt mDem(mo;(0tetnxfcoo1fmD  nes;(  2xo(o3no4ap emivia(faDra(mont1apxomo3iys m2eanvs u) lxoxf3iydfpt livslt  rumio3ny4am nlnei t s2tmuro;u0aetn i3ildlm2ra( p t) rermr3iy1lpt  u o;t)seuoxm iy4lleelnetas)a2tax ooo0tlxomfeiys s2el(mo u0 exrmrcoy1fpt aivs s  2uoxo3oy4oleelnesltfa2tax ono1aex ioeiydfmDemumsnt)altnxociatfptr ueol(0trtrio no4op   nct sf Dtmxm nt0olxn fciltfsDulumo (0tlxrir3oa1la rli ol(  2toxrpiudamtelicils a2rrxro;u4alxnmi3iatlm2rln o;u4 exrircio1fp eln s (  2umxrpnydlmtelivt (f 2rr( oou1aexo ietydfs rau o t0altoxo3oa1lpteau ilt sruoxr3oo1ap e iviasfaDtau pnu1tee mieiatlm2uaumo;t) lxrircio1latelu o;t  2tmio3oudameemnet tfsDrmxr nu0aptnmoetadls eau s t4 eeomo3oadlateai slt)s2xrimpno4oleemici (faDtrxrpnu0oex mfetat m2emuvp;u0trtnirctodlmD  ieolt) 2toirpiy1alen fetas  rtrxronu0olx iictad m2ran p t)aetnmr iodfa   ivs;s  exmxo oy4lltelfci sfsDra( p;t4oexn fcias m emuvp;(4alxrxf oatfpD  nes s0t2uriopiy4oltelnetl(  rtr(  ;o1oetn ieiat aDumnvp;(0 lxomfcoo1opDeaieo;s)s2xrxopou1al   icsls) 2rr( ont4opx ioeiydlaDemnvsnt4 etnmo3iytfatelnvo s)s2umir nudol nlieslt) Dtm( ono0tpenmieiytlm2emn snt4arxomfcoy1omDran i;(0t2xo(rpny4apt mfvtatfaDtr(mo;u0apxoioetatfm2uln s;u0areoxf io1lp ran sls)trum(r3oo1ame  ict ( sDtr(mooo4tltomf3ils a2elumo;t)tltrirciytlpDeaieols)trxmxo nydlle mncta()srtm(m ;t1tee mieiydfaDua( pn()aexrmf3oydlaD  iei;(  etmxmpnu4alenmfvslt)s2rmu o;o0oeeo octatfs ranmpnu)aetoxo ootlptraieol( trxrxm3oo1lptnlies t  Dtaxmo;t0tet io3iyslaDelnms t0tetrmr tydlm eai o;()trto(m oodlp elnctl( srta( p;t0altnmiciyd sDrlu s t4 exomr iadom elivi (0tetoio3ny4op elncil() rtru pnu1oet mfeiad a2rauvpnu)aexrxr iodomteau s;t trxr(rpnudlme lict s)a2ua(  no4oet moeilt a2rmu s t4 lxoir3tatoaDeanvo s0 rumiopno1ll nlncs t)sDra(  ;t0tpxnioeiasfm rm(vs t4tlxoiociydfm eauesl() euoxm ou1lp emfvt s)srrm(rono0apxn feiatfmDrlu s t4tlxomo3iytom r ivs;s0s2uoio nodameelnvsa(fsDumum ;u0tltn feiltls2ra( ont)trermr oydfaDeaiei;s) 2xm(m io1lm  lncslsfs2trur ;o0oleomfciydfm ulu ont0artrmoctatoaDr n s t) exr(mpno4lm emicta()arumu pnu4opx ifciydfa2eau s t0aeenxf tadfa rliesl(0trxrio iy4lpenmivtl(faDtmx ont4oltomf3tytfm elnmon(4alerxo todlmDe uvsls0sexoiopoo1lpe lfetls a2tmx ont4aex  o3ild a2ra(ms;u4arxrmfciy1fa elu s;t)s2toio oo1llt mnciasf Dururono4texomieiatlmDrmnvsn()teeomo ootlm eaiesl()t2xriopnydlmt lnvta() 2rmx ooo4teen iciyslsDum(mp t4arxomfciadoa r nvsls0srxm(r no1ol  mivslsfaDtr(m nu0optomfcilt a rmu pn(0tltrif totom elnvil(  2uoxr3iu1opt mfvil(fs2tmxm ;o1oleo i3iaslm uau snt0trxoxf3oatfmDrlu il( seurxm iy4ap nmfet sf Dur(r oo0aexo ieiadlaDrlnvon(0trerxf iatfmDelu o s0t2umio3oodol emfeil( s2rrumonu4opx ifctldls2ra(vo u4 eenxr3iy1lmD  u o ( sruoxr nydomen iesat) 2umxront4aeenioetas s2rl(ms;t0altnif3oa1fpDrli i;s) 2xo(m3oy1ome  fcs ()srtrurp;u4tpxniicildfm rm(mon()aetoio3ia1opte neol(0 rtoxo3iy1ope liciasfaDtaurpoo1teeniocildlaDrmnvpnu4 renircoydfate ivi ()trxoxm ny4altelfvsas) rurxro;o4opxnmfetatfm umn s u0 rerxfciatomtean ilt)setm(o3iu4lpe  fetas) rtr(moou4optn i3iydla2ulumo u4 rtrmr tadfp eauvsls)sexoim no1ale lneil(faDtm(r oo0alx  fciltlm2rauvs;(4treomo3io1oaDranes s seumir3no1op emnvt t) rtrx  ot4apt mf3ils s uln s ()trxrir3iytfm rluvsls)sexr(mpnodapenmnvsatfs2raxro;t0tpx  oetydlm uau s;() lxrir3ta1optrai ilt0trto(m nu1altnmics s  2umxr no0altnmi3taslsDumn s (4texrio io1lm rln s;s srxoxrpou4apeemiesat  ruau o;u1tpeoifeild aDraumpn(0arxnxf ta1oate n s t)srxm(o iydlmeelfvia( s2rau  nu0aexomfciytfa um(ms;(0trxrxr3tadlat  u sl(0 exoim3no1optnlictlt)s2umumont0oltn ieiydls2el(vpn(0aleoxr3oytfpDr i ils trxoiopnu1ap nmnvilsfsDtaump;t0oeeomieiydlmDranmp u0 exrxo3iadopt  ivo;t) rur(m nu1lle mivt () rur(r ou4tpto icilt sDrluvo u0trtoio3tatfm r uvo;(  exmxm3iy4lpe  iesls)arrax p;u4aet miciatfmDuaumo u4artrmr to1lmD  iei t  2ur(rpou1lmenlneilt  2uaurpou0tetoifetat a2emnms t4 lermrcoatom elueslt0 rxr(m oo1opt livs t)s2tm(mp;u1ale  f3iad m2eln s;(0tetnif iytfp eaieols)seumxr iy1lmenmfcsl(  Dtrxr nu1apxo f3tat m2emn o (0trenxr3iy1lmDelu ils)trxrimpoo4lp n ici ()srtaur no1oet io3tltls emnvo ()texrircoodlmt  nvs (0 eumir iu1ap   fvsa(  2uaumpnu0tee mo3iltfa rl(vp;(0trerxf ootfmt lueilt)teum(r3nodlp  lnesl()arraxrooo4optn ietatfa ua( p () lermo3tydlpt lu i;(0srxmirpno4lm nlfcsa( aDum(mpnt1tlxn ociat m2uauvo;(0texrmo iydoa   u s ()teur(opnudlme lfvt sf rtrurono0aetnmictlt mDrl(vpnt4artrxo3ootoateauvo;t0 euo(opio1ape mnetat)arum(r nt1oex if3iyt m ranvs;u0tetrir3ia1omt livi;t)setrxmpio1lptnmictasfaDtm( ont4oex  f3tytlsDra( p t4aexomo tatlaD  n il(  2uoxr3oodole livia( aDtmu o;u0opxomociad s emn o;(4alenifcia1lmDrluesls)trxrir iydapenlici sfs2ua( o;t1tpxn oeilsfs2rl(vpnt4artnmo iydlm raivi;( s2xmxo iy4ol emfeslt)a2ta(r ;u4oeeo icild m2elnmp t4aetrio3to1fmt auvols  etm(opoy1altn nviat)arra(r ;t4aeenioetlslmDul(mo u)tlxrxrciatoatrlivols t2uoxo iudom elfeslt srtm(r ;u1tetniociydla2ea(mo u0aexoirctydlm  anvol(0 exrirpnydaleemfctls) 2rrx oou0ape if3iatfsDrmn ont)trxomo3oy1lm  anesl( t2xm(m oy1apte ictat a2raumo;t4opxnmfeiltlsDemn o;u0 lerio io1opte u o s0texmxrpiudolte feslsf Dumxronu4oexnmieildfs2elnvsnt4alxnxf3iotomtelnvi t  2xrir oodap   nvtlsf 2urxmpou0tltn ictls a emnmo;t0 ltnxfctydla  ln ol() eurxo oo1altemiet t)sDua(m ;o4tetomietasfsDrm(vp;t4trtrir todomD luvo t srxmiopnu4aptelncs s artaxrpnu1tpx mfetyslmDeanmp;t0texomr3tatop r neols0 2xr(r oo1apt micsl(f Dumum ;t0oet  i3tysfs2ua(mpnt0tltrxo oatfptrli il(0 2uo(r3nu4lm nlict t arur(r oo1aee  octatlm el( o;t0aetrmr3oadfpt ln s;s0t2tmim oodll emncs (  2urur ;o0teen ociysfmDumnvsnt0arenmr iadoatr i slt0 etmxopnodoptn neia(  rumuroou0olxn fetyt mDra(vo;u4trenxf3oo1lm   i s t) 2xmir iy1lp  mnvtlsfa2ururooo4oetnmietat s2uluvo u) ltnxr ty1oa elnvilt)tetoim3no4ol   fciltf 2urxr nt1optnmieiasfmDul( p;()tetrif3ootfatraivi;()trxr(r nudoptnlfciasfsDtruro;o1tlxomf3iytlmDul(vsn(4teenmf iodomDrli il(  eumxm3nu4llt lnvia(fsDraxmoot4tptomfeiatlm2el(mont) lxrmf oa1lmt aneil()s2xr(r iy4am  lncsa( s2trx pou4oee moeias m2rm(vont4 exomo ta1fp e uvi t0srumxm3no1ope lnetlt arrau p;u0aeenmfeiadla2ulnmp t4aexnmocoo1fpD  i o t)srto(r iydaleelivsasf 2rmur oo1apx moeiasfsDeanmp;(0tltnxocio1oaDean i;t0srum(m3nu1lltnlfvtl(faDurxroou4aexoiiciltls rln p;(0 ltnif3iotfpD lies t srur(o3no4omtemfvtl(f Dtm(mpnu0alto oetadfaDrmuvo t)arxrif iodfa eai o;s)t2xrir no4lp  livilt arta(ro;u0aexo ieiatlmDuan p;u4areoio oytfp  ln ol( trur(o3iodop n ictas)sDra(mono4tlenif3iat aDranvo;u0 rtrioctotoa  aueils)srtrim iu1aleelicsa( srtr( pot4aee  fctyd s uanmpnt4tltoxf tatfptraueslt  rtmim nu1op n fvsl(faDtr(mp;t1tetomi3tld s2uln pnu)areoioctatoa  lnei;t s2uo(o oudlpte fvta(  rtaumo;t1opxn oeiatfm em(vpnt) eerir tatlm elnvi t0setoiopiydll elivtasfa2tmu o;u4oexo feiys a2em(vp;(0 ltnmo iy1optrauvol(0srum(o3io4om   ncilt  rrm(r ot1alxomfciltfa ranmonu)altrxf3iy1omDrlies ()teumxm3iy1lme mfcilsf 2rrxr nu0aee  ictytfm2uauvsn(4tlxoif3oy1fat aivols  rurir iydole lfetls)a2ra(m ;t4apx io3ilt s2ra( onu0 exnmf3iytoat aies;()trtr(r iudoltnmiet (fa2umxmpot1aptomoetys aDea(vs;u0aeerxo3iadopt auvslt texmxo nodal  mivsl(  Dtmumpno4olxnmfcild s rmumo t0arxrio oatomDr uei;t)s2uoxm ny1lpeelnesl(  rtrxm nt0aex iocildla uan s;u)aexrir3iy1lpDr ieo s tetm(opnudaptnlnvs tfs2urur nu0alx  oeiyslm emu snu4 leoxfciotoatean ols0srtmxr oydalt livta( aDuaum ou0oltoif3tydla rmu pnu0arxrxrcty1la elueo t srxoxopiy4omtelfvil()sDra( ont0oleomo3tytlm2rmnvonu0aetnir io1fmDrlneol() exmxr3ou4al   ici t)s2raurpoo1aetoiieiltls rlnvp (4tetnifcoytlpD lnes;t0seuriopno1ap elnctas) rra(r no0aetnmociad s eaums;u)aeeoxr3iatoptrauvsls0 2to(o3nu4lmtelfvias) 2ra(  ;t0oltnmoetaslm2rlnvsnu0tltrif3iadfp r ieils s2urim3oo1op nmivtl()artrx ono4tpxn fciaslaDrlnmo t0teerxoctotlat an i;s)t2um(r3iy4apeelivsl( artrum ;t1tlx if3tatla2umn sn(4aeenir oodfpD auei t  2uoxr nydal nmicta(f rurxmpot4openif3tytlm umn p ()aetrio3oy1oaDe uvi t)sexoim iydope mfesat srraum ;u0openii3iat s um(vo () ltrmfcto1om   iei t s2uo(o3io1apt lfciatfa2ra(mo;u0oeeo i3tadfmDrl(vs t)trtoxr3oa1fpteanes s)s2trxr iy4ape mfvta() rur(rono4tleomo3iasfs2uauvp t)tlxnif3oydop r i slt0 2xo(o iudalt  nvsls arta(ront1aex mi3iysfa uan p;u0arerxr oydlaDr neol(  rur(rpio4ame mict s) rtax o;u1tltnifciasls eluvs (4 ltnxo oo1lmDrlnvi;(  etoim ou4lp  lfesas)s2taxr ;t4oeeo f3ilt s rl(mo t4arxoxrcoy1lpteluvol()s2uoimpoo4ap   iet ( arrmxr ot4tpeo ocils s rauvpnt4aetnif ty1faD an slt)srxmio3iodomenlfeil()a2ta( ono1tle io3iat sDuau p;(4tlenio ia1op rlu o;() 2urxo nudllt  netlt)srtmur ou0tlx io3iydlaDea(vo u)tlenxr iotfm eauvo;t setmio io4al  licia(  ruaur ;u1tpe  oeilt m2uan p t4tleoxr ta1oaDrluvo s t2xmxmpny1lpenmiei sfaDra( pot4ole  f3iyd mDrauvo;u) rxnio3todomDr nei;s setoio3iy1ap nmnet tfsDrmumont0tlxnif3iasfmDrmnmpn()tlerio oatfpDe n i;() 2xrxopno4olenlnci tfa2tmum no0aetn octasfs em(vo u0altoxr3iytoatelivo s) etr(rpio1al  lieilt) 2uaxr ot0aexnmi3iyslmDrl( sn(4 rtniocootfmt  ivilt t2tr(r3nu1lp nmicslt)aruaump;u0apx ifciytlmDua(mp;(4 eenir3todfa  auvo;s)teumxr3oodam nmfctat)a2rrxm nt0tpe iieiatlm2ua(mo;t)teeomocto1lm rlueolt trtrxrpiu1lp emfvtat aDtaxr ou4aeeomf3iytlm raumsnt0 eenmf3totfpte ieo;t)texmxopnudlpte ivi sfsrtau  ou4tpeoifeiyd mDrm( p (4 eermf3iydlaDeaivo;t) 2umirpio4llte icsa() Drrumooo1aet  oeildfm2ea(vpnt4tlxnir3iydlmteluvil(0s2tr(r no1lp elnes sfsrurxm ou1tpeo ieils s2ra(von(4 etnioctytlmtrluesls)trtr(r3iudlmtnlics t  rtrur ou4alt ioeilt m raump;(0trenir to1om  ln olt s2uo(o oy1amtemnesa()artru  ot4openmoeilsla emnvo;(4aleoio ia1lmtranvilt) 2urxmpio1apt mfesa(  2taur ;o4aexoii3ild sDemump;()tltoircoa1fpte ivs;s  rto(o oo4olenlnes (faDumx p;o4opeo f3tadlsDemuvo;u4tltnxrciodlmt  ieolt0seum(mpny1ol  mfvsls)sDua( pno4olxomiciat aDemn s t4 ltnmo3tadlateln ils0texmir3iy1om emfet t) rumx o;o1aex  oeiytfs emuvo u0teenif totoa e n o;t0 rumxopoo4amtelfesat sDurumpou4tltniociydlm2emnmsnu0artoxf3oy1om eli s (0 rxo(m3no1omee fesl()sDtauro;o1teeomictyt s2uaump (0 lxrxocoatfmDeli o t)s2umxr3oydal e ict (f rtm(roou4olxn o3iytfa2el( snt) rtrmr to1fmD auvils)seto(m3no1ale mfvil()sDurxmo;u4olxoioetadls2uauvp u4 ltrmr3ty1fp r u ols0 eto(o3io4opee iviatf rumx  no1ole  i3tlsfa2uan p;(4 rtomrciydfmtelneil(0 2tm(rpou4amte fesls)s2rm(rono1oltnmo3tytfaDel(mp;t0trxrif iatlptrauvo;() rxmxo iydlptelfet ()artaxm ;o4teenmoeias s2ul( snu)aexomf3oydoaDrlu i;()s2umxrpoodamtemfvsa(  rtrxroou4oetomo3tyd s eln snu4aetnmrciydoa ranvi;(0s2xoxo3nodlpenlnctls  Duaum ;o4opxnifcildfmDumnmo;u0tetnmr3io1lmtrai olt trtmir nydop elfvslt) rumxrpoo4tex  o3iytla2elu pn(0 ltnmf3tydfp rln i s0 eur(mpiy4olenmfes s)srtru p;o4aee mietysla eau on(0tlxnir3oa1fmte nvo;t)s2tmir no4llenmiviltfs2tru pnu0tlxoioctlsfa uluvp;(4artnif oodfaDr ies t) rxrxmpiy1opeelicias aDtm( pnt4olxniietytla eau o (4alxomf3iotlpDelu ilt)s2uoxrpiy4omenlietat sDtrum ;u1optnmoctadls2eau pn() rtnio iytomDe ivslt0 exr(rpoodopte fcta() 2ur(  ;u1aetnmfeiytls emu p;(0 exomf iydomt anvols t2xr(m io4omeelnci t)sDrrxrpno4aeen i3iltfaDrmnmo u)trxrxo3tytfat lu i (0srtmxm3io1ap n nvs s srrmu poo1oleomietys mDran o (0 rxoxo tadomt  ueols0setoiopny1optnlicsltfaDtaxmpoo4aexnifciasfaDulumo ()arxrmfcia1omt lnvsl()s2xrxo oo1lm   fvs (f Dra(  no4teeomoeilslm2umu snt4tleoxr3tydomDrlues t seuo(r ny1olte nciltfaDua(r ot4altnio3tydfm2uluvo t4texrxociy1fpDelnvslt)trxr(o ou1ome  iesls)s2tr(rpoo4ape  ociatfmDrauvo;u0aeeoif3totopDr n ols0seurxopou4lltn nvi s)artmx ont0olxnmoeiatfs2ul(mp t0tetoxo3io1op raivilt)truo(r no4lm nlfvilt arum(ro;u1tlxnmfciltfa2eau p;(0arxrxr iytfp   n s s seurirpny4amenmivt (  Drrurpou1opxnioeiadfs em( ont) lerxf3io1lm ranvslt t2xoim iy1altnmnvslt  Dumur nu4tltnmi3ilsls2uau p;(4arerirctatlpteaivs t  2uo(r3iodame lnesl(farurx  nu1tpxo i3iltfs eluvont0trxoxrctodfm  an ils  rtmxopio1lm elfvi s) 2tauro;t4apxo ictlslm um( p;(0 leoirciatlm e ieils0 ruoimpoy1apenliet ( a2rmxrp;o4ale  fciadls2ua(vp u0tltnxoctodom  lu s;(0 2tmio iy4altemnesa(  rua( pou4teeomfciltfm rlums;t)aexomf iadlatelieo;t0sexmxo3oo1amenmfct () 2rrxmo;t0oeeo ieiltlsDranvp t4aetrmf tytfmD  ueols0teumim nu4apt lfesat sDrru ont0tltnmfeiatla2ranvp t0altnir iy1opD aivol()s2xrim oy1oltelnci tf rrmurp;u1tpt  octld m uauvs;u)aetnif iodoatr ieo;t  euoxr no1olenlnctls aDurx  ;u0aet iocils s rlnvpnt0 lerir iydop rli s t t2uoxmpoy4amt mnvia() rumx onu1aeeoioctadls2um(msn(4 rtrxociytom  aiei;()s2xr(r3no4lpt lfetlt arrrx p;u1alt mictatfsDemn pn(0altoxocta1lp  aneol(0 exoim ny4olen ivs () Drm(rpnt1opt  octad m2uluvp (4texoio oy1laDeaueols0truoxo3oy4openmiei tfarrmu onu1aptoifeils m2elnmon(0aeeomf3oy1lmDraueo;t0 2xmxr nu4om   fvs tfsDrau pnu4tlxo feiydfmDumumpn()alermr ia1fmtran o;s srxmim3iy1opeemicslt)a2taumpoo4tetnmoctysfa ua(vpnt4trtrmf3ootfpDranvs;(  2umio3oo4op elfvtas srumum ot1tex mfeiatls el(vo;(0trtrxoctotfpDraueo ()srxmxrpoydlmtelfeiasfarururoou4tpx mf3iyd m2ea( s;u)aetrxo3iytlm rlnvols  2ur(r3oudllt  ncs (farrax pot0tpx io3ilsfaDua(mpnt4arenio3oo1omDeluei;t0 etmio iu1amtnmics t sDrax o;o0optnmfeildfs2rlnvp;t4 eerxo todoa e nvi s trum(opiu1om nmnvsa() Dta(mpot1oeenmf3tad m rmums t0aetoxf to1fmDrln i ()s2umirpoy1op  lfeia( srrm(monu0aex miciltfm2el(ms;u0 renmf io1lm eaivsls truoio3oydll e ics t  Duax pot0oee mo3iasfs elu p;t)artoxr3tytlp rliei;s0truoir3iodomee nei sf rtm(r oo4tpeo o3iatls umump u)altrxf3oy1fat luvi ( srumim iy1lm n ieia()sDraxrpot0oexomoeiydfm2eau p t0teeniocoatomtr n o;t)sexr(m3nu4ale lictat a2rmu ont4oltnmieiadlaDem(vp;t4 rxrir tatla rln s s)s2to(opnu1ll  micil(f rrr(r nu1apxnii3ildfa2rl( s (4aexrmrcio1lmtelu i t0s2xm(mpiudlpe lnviatfsDtm(m ;u4oexoifciadls2uauvs;u)aleoxf3oodfaDe nvs t) 2trirpnydap  lnvta(f Draxmonu1tlt mf3ils m2elu o t)aexrmr iydla  anvo s0srur(rpnu1amt mieia()aDtaxrp;t0tet moeiysla emump;(0 ltoif3todoat anvo s) rur(r oodoltelicsatfartrump;t0texn fetas mDea( p;t4aetriocoo1lpt aiei s0 rtrxopoydamtnmfciltfaDurumpoo4oee mfeiyt sDem(ms t) lerxr3ta1fa raiei;s0s2toxo nodalenmietasfaDrrxmpnu4olx moeiydfm rmumo t4 ltrmrciytlpDe ivolt s2tm(mpoodalen iesasfa2ra(  ;u1tptomoeiat mDul( p;(0texnifcta1latr ueslt) eurxo iu4altnlncsat s2urxront1opt mfciadfaDemnmsn(4tlermo oytfa   n i s teur(o oydom e nvi s)arrmu pou0tptnmo3tas mDel(mo;u0aeeoir3tatlaDeluvo;( sexmiopno1ome mfvia( a2umuro;u4altomieias mDum(mpnu)tlxrmf3iodfmD an s (  exoxr ny1lmtemiesl()srur(mpou0tpxniocilsfa2eauvs;()aeeniociodfpD luei (0s2tm(opnydaptnlnei (f Dra( pot1tlx  i3iatlm el(mp u4teenmrcoytomD  u i;(  2xmxopoodol  mneil()srum( o;t4alxoifetldlmDrlu p;(0arerio3iodoptranei;()srum(o3iu1op emnvils) Dtrxrpou1tlx if3iadfm2ulnvpnt0treoxo3oodlate ivo;t0 eum(r oodamtemfeta( s2rruroou1apxn oeiatlm umn s;()trtrmrctadfpD luvs;t)texmir oodalen ies s arrr(mo;u0olen i3iyt a um( s;(0artnxoctatlp r n i;s0 exoio3io4ap n fctlt) Drmuro;o0opxoii3iydfsDra(mpn(0aeeoxo3oo1opteli sl()t2umxopio4ap n nesltfsrurxrp;t1olx  oeildlm2uauvo;t4trerxfciatlpD lues;t0tetrio3iy1omtemnvtlt aDtruro;o0tltomfeiysfs2rmuvsnu)trxnmo ta1laDelies t texmiopoy4olt mfciat)sruaxr ;u4tpto o3ils a ranvo;u0treoiocio1oate nvi;s0 exmxo nodalee fes t srtru pnt1ale ioeiadls2uaumonu)texrxf3oydlpDe uvsls  eur(m3io1op e ies ( s2urxmooo4apt ifeiytfm2uanms t)arxrmfctatlatelneols0setrim3nu4am n ncsl(faDrrxr ;u0oeeomociltlsDrmnmp;t) rtrxr iy1fatelnvi;() 2umxr3oo1al  lnvias) 2rrx p;o4alx  ietlsla2ea(vp;u0trenxr tatop e iei s trxrxopiu4am   ncsasfsrtmump;u1tlxnmf3ilt a rau o (0teeomo3totlptelueo ()s2uoio iudop emici ( a2um(ronu0oeeomfcils mDea(vp;t) rxrif3to1oaD  ueils)seumxm3nu1llenmfvs t) 2tru onu0aee  i3iysfa uanvonu0artnif3tytfaDeauvolt s2tmxopoydome mietls)srrrumpnu1tleomo3ilsfa2rm( ont0arxomo ia1laDeai s;s0 2tr(o oodalt lieslt)aDtrur nu0tlxoifetlsfm2uaumo u4 etnmrcta1fmtrluvs s) 2xrxmpoo4amte ictat)s2ta( pou4teeniocild s2elump;u4areomf tatoaD auvo;t)t2ur(m3oudap emivi s)s2tmum no1apxn 
\ No newline at end of file
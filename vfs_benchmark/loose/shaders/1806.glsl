@@ -0,0 +1 @@
+n o;s)s2xrir io4amtelivt t arumxro;o4tpen f3ils a umnmp (4teeoir ta1oa   ivo;t)texoio io1llt  ncsa(  rraur ;t1aexomfetydls2ulu p u0trxrmf3ia1oaDe ieslt0teto(r3iu4amee icslt) 2taurpnt0tee mfciys mDumn p;u0texomrctydfm  luesls)trxrim oydapeelivtl(f rraxr ou0tpxnioeilslm2eln o;u4teermf iadomDelivs;(0s2uoxr nydlpe lnesas) rua(mpnt0tetomo3iysla2eau snt0trenmrcoa1opte ivi s tetmio oodamtnlncilt)aDtm( oou4opt  octytfaDrm( s (4trtnxfctadomtean olt) 2uoimpoy4llenmfet s  rrm(monu1apxoifetyslaDean p t4tltnio3iatfmDr iei ()srxmio iu1aptnlncil(fa2umx  ot1oee iictydlsDul(mo ()trtniocootlmDe ieo;s0 2umxopiydlpt mivi ()a2raxr oo1oltn i3ilslmDel(vs ()alermo3tytlatr u o s0 exmxrpoudlmeemneias)s2rau pnt4ale mo3iatls um(von(0alerxr oatfmDr neilt)seur(r3ny4lmtnlnei (f Drmx  ;t4tpxnmieiat a ulnms ()texnxr3iytoaDeaueo;t  2trxopiy1apen fvil()srumurono0aetoio3tldla rlumo;()treomrciodopD aneo;t)trxrxm ny1lp e fetat arraurpnt4oetnmiciad m rmn o;u) rermf iodfm  lieol(  etmxo3nudal e nvsa(fsDraxmpoo4apxnif3ildfs ean o t4aexrir iotfmteau i;(0tetmxopou4omtelfei ( a2ta( oot1tlxniociyslm2rau o;t0aleoircoa1opD aivo;t0s2um(m3oydam n ies s  rrr( pnt4olxn o3iatfm rmnvs;t4 renir3totfat ln sl( t2xm(mpny4am  micilt  Drmxm ot4aet ifetyd a uan s;(4areoiocoa1faDr nvo;(0srtr(mpio1al emfet t)srrm(mp;o1apeoio3iydfm ra(mp t0areoxo3to1optraieo;s trurxo3nudal  lneiasfa2trxrpoo4altoifeilt a2ranms;t)tetrxr3ia1om eluei;s trtoxrpiy1llenmietatfsDua( o;t0opx ii3tld m rl( s;()tetnirciytfp eliei;s0texr(o nu1lme lncsatfsrtr(rp;t1tpxoiietatla el(msn()aeenifciatoatraies s)texoxo3io4ope lfeia()aDtru oou0oetn o3ild m rmn o;u0tltrmr oytomD  nvilt)s2xrir3ny4ale mivsl()sruaxrpou0oex  o3tyt s ua(vsnt4alenirciydoa   neolt t2umirpnydam nlneil(  rtrx o;o4olxn ieilsls2rluvp;() rtnxociotlmD ln o;s)trtrir io1optn iviatf Dumxrpoo1opeomictaslaDrmnvsn()arerif3tytomteli slt tetr(o3no1lltemfcsa(fsruax  nt1opt  oetatlm uan o u)trtrxo3todlm rauvolt) rtm(r3oy1lpe mnvsl()sDuaxmpnt4alxo ietlslm ra( ont0arenxf todlpD lnvslt sexrim3ou1om nlivs sfs2urxr ;t0aet mi3tadfsDua(ms u4arerio3tytfpDr ueo;t)texr(m iu4omeelietlsf Duaxrooo1tee  o3iydfs2ulu pnt)trxrmfciadoatrlnvils0texoxopio1ll emnci t)aDuauronu4aet ii3tadfm eanvpn(0altrxf oatoa r nvi s tetrim3iu1lmt  ietls)s2tmx o;o1opeomoetas a2rln o ()trtrxfcia1la   i o;t  euoxm3oo1lltn fcsat)aruax  nu4aeeo iciatla em(mon(4 rtrmr3to1latrauvs;t0 2toxr oudlm nmfetls)s2um(mpnt4apen fctytfs ea(mp t0tetnmf tatfp eaneol(0s2xrxr nu4am e fct t)aDra(mo;u0opeomfciadlm rau p;(4 reomr ia1la eaiesls)trumim ny1om  lnvtlt)aruaxmonu4oltoif3ils mDeln sn()artomfciadoaDrlu ils s2uoim3oy4al nmnvil()aDta(mp;u1opeoii3iat m2rm(von()tltrxrcoa1lmD luvilt)t2umxo3no4lpt lnvtls)aDuax  ot1oltniociyd aDrmn o ()artoio3totlm elivils0s2tmimpnu4lmenlnci s)aDrr( onu1optn feiltfs2elnvont0 eeoifcia1fa   neo;s trur(o3nydlp nlivi t) 2tmur oo4alt iictasfm eauvs;u)tetnio iodfmtrlueolt seumiopny4alenmfvtas s2rmxroot4alxnmo3iltfs2em(vo;t0aexrir ty1fateaneo;s0teto(r3ou4oleelfvtl() rtax p;o0alx miciltlaDemuvsn()tlerxf3iy1latr u o ()sexm(m3ny1ll  lnesat)sDumx  ou4tpt moeild m2ean snu0artnxrctydlatran slt0setoxr3iodapenlfvs tfarrm(r ot1tpt  fctlsfs2ua( pn(4aexoir3tadlmt ln s s0 2tmio io4am nlnct s s2tr(roou4ale  o3tat mDrmnmp;(4arxoio3oo1laDeliei s0 rxmxr3oo4lp emfei t a2tm(  ot0tpx if3iydls rm(ms;()aetrir3ootfp e uesls0 rtrxr oo4llt lfvi tfaDrrurpoo0tleoiietat a eln p;u4tltrxr ty1fm elneil(0setr(r nodolte iciltfa2rr(m ;u1oexoifeiytla rau pnu0aetomfcoa1fa  lieo;t) 2ur(r3oo1opte nei t)aruru pot1oee mietld mDum( pnt4aeeoxoctotop  anes t0trtr(m iudap  mnctl(faDrmuroou1optniieiasfsDrmuvo;(4arxnmfciodopDeaues (0t2tmxopiudlmen ivs t sDrrxrp;o1opeoifeiytlaDulu p;(4aetrxr3iy1oat au ol(0 2xrir oudaptelictls sruaxmont0opt iiciadfa2ul( p;t0texnxr3tatfp  lnvi ( seuriopoydlltn iesls  rtaxrpnt0opxn f3iydlsDem( on() rtomo tadlaDrln o;s s2uoimpno1ol   ncslt)a2trurpno1olx moetadfmDelnmo t4 rxrxoctytfmDeaiei;s) 2xo(m3oy4om nmncsat) 2tmxr ;o0oltoiieildfa ra( snu) etomo3todlaDrauvil()t2xmirpio4lle lfviasf 2rr(mpot1aet  oetlt a rm(vp;t4 exnmr oy1lmDrliei () 2umir nodoltnliei (f rraur no1alt mieiad m2uanmont0 ltomfcoytopt  i ils s2xmxr3iu1opt lfcsl()s2rrumonu4oetomf3tld m eauvon(4artnxociotop r nes;s0 etrxmpiodaleemici sfsDtax  nt0teen ieils sDemn p u0aleomrcoatfpD ln o s s2tm(rpnydll elfvsas) Drrxr no4ope mictltls2rmuvo;t0arenmr3ootlpteanesls)t2xoxr oy1lmtemicsat  2rmxmonu1tlxo f3ild a2rl(vsn() rxrmf3oytop e ivols srumxo io1ap  lfvtatf 2ta(  no0oex if3tyslaDumums u0alenxfciydfmtrlnvil( trxoimpou4lme lfvsasfsDtaxm nu4texoio3iltfs ea( snt)trxrxf tydlpDelneilt0 etm(o3oudll nmnvtas)a2rrurpno4open ietytfa2em( p t4trerxf tytlp rauei;( s2trxr3iydame mfesat aDrmx  oo0tpe  ociytlm2emuvonu4 lerxo3totlaDean s s  rxoxo no1al  mics s)s2trumpnu1apxn ieiyd a emuvs ()trtomf3iatfmD ln i;s  2xm(o3oy1lm emfeslt  Durxmonu0oeeomiciasfsDeanvo ()tlermfcoy1faDrlieo (0t2trir ny4lptnmfvs (farrrx p;u0oltnmfctat sDrmn p;u4treoxoctadfa  aueilt0seur(o ny4ap   fvt s sDumx  ;t0optomoeiat m rmnms;(4 rtnircoodoaDrln i;t0texrirpnu1ame  nctas aDra(mono4olxnmoctadfs rm(vonu4 eerio ta1omDrau olt0setm(opou1omenlnvtlt)a2tru pnu0oetn f3iasls eaumo u0tlxnircta1omt  i s t t2tmim3iu1lp e ivsas  Durum ;o0altoiociysfs uau p (4trenmr io1fpDe ivs;t)t2ur(mpoy4lm elfvs ( s2rrx  nt0tee moeiltlmDrluvs;u) lxomfciotomDe n ilt s2xrio3nodopt miei s) Drrxmont4tpto icildla um(vo;t)arxrxf oy1optean ils)t2tr(r iu1omte fcilsfsDur(  no1alenmfcils aDumums;()alxomf3iydla eaueilt t2xo(mpno1opee nvsas) Dua(rp;t0optn f3iad a2eln o ()trenmo3oo1lat  uvs s)srxoxo ny1lle  fetatfarum(  oo1apenmociysfaDea( s ()aleoir iotomD an i;(0 euriopou4apenlncil(f rumxrpnt4olx mictatlm2eanms u4aetoxocoa1la e uvil() 2uo(m3oo4lp nmfvslt)arrm( ono4apeoii3iaslsDeau pnu0alxoxr3tytom rau s t  rtmxo3iu1om nlfviat)a2rr(  ou1tlxoifctldla2eanvpnt0aeermf3tydoptr uvi ()setoxm3nodop emncias s2umxmooo4olx mieiyslmDeau ont)trermoctadlp rlivo s0tetr(o oudom nlivs t) 2umu ooo4oexomfeiydfs rln pnt0aexnmr3iy1opDe ivi t)seuoxmpoo1am elfvi ( aDtrx pno0oexn ietasfsDemums;(0 rtrio3tydfp raueils texmxm3ou1apeelivi t sDtax  ot4oltomfciltlaDeauvs;t4 eerxf3ta1faD  ieil( t2tr(rpou4lptnlivsatfsDta(m ;t0tex ifeildlm um(vs;u0 etrxf tytfmt anvs;s0 rurimpiydomeemiei s aDtmx oot4altoif3ild a2ulnvs u0 rtnxo3iadoaDeli i;s0 rxmim iudom  mics tf 2rrxmo;t0ole mi3iys mDea(von()tlerio oy1opD luvi s0 eurirpoy4amtelieia()arua(m ou1opeomfcildlm2rl( o ()trerxo3oodlatean olt)s2uoio iy4aptemici s srtaum ot0tpeo oeilsfaDrmn s u4 ltnxrcio1omDeanvsl(0s2tr(o3oo4ome mfvtltfsDrr( p;o1aetn ieiltfm2rl( on(0alerio3iytfpDrlu ols)t2tmir3nudamtn netat aruaur ;u1tpxo f3tytlm2em(von()altnxo3iadlm r i s;()texoxopoudoltelfesl()a2uau pou1opx iiciaslm2em( o;() rermf3iatlptrlues;s s2uo(mpnodll elneslt)aDuaxrono0oeenioeiad mDelu p;() exrxo3iy1faDr ivo (  2xoim3nydolte nesa( aDra(  ;u4oexoii3tyt m em(ms u4 etrifcootopDr uvs (0sexm(o iy1lleemfvt s)a2urx p;u1apxomf3iasfmDelu p;u4tetrmfcty1fatrlivi s s2um(m iy4al   fctatf Dumumpno1aptnmfeiydlm2um(vont)trermf tytlp  lneo (0t2xmir3oudolenmnvtasfartrxro;o1aetn iciatls2rlu pn()arenxrciatoaDran o s0teuoir nydop emiesl( sDrmu  ;o1apenmfeiasla emnmp;(0teeoxocootop eaivsl(0 2toxmpnodom nmfvil(fs2uaumo;o1tpxomoctat aDeluvo;t4tltrmf3iytlatrlnei;s)seurxm oydal  livtatf Drmxm ;u1altn fetyd m2ulnvs ()alxomf3iatlatelnes;s t2xoxm ny1lpe lfci (fsrtr(monu0alto f3iltla uanmo (0alxnxf3ootlpD  u i ()texoxopoo1opt mfes s a2ua(mooo4tlt ioeiytla em( s (4 ltrxr tytfa eauvs t0t2uo(o3ny4alenlictltfsDrm(m ;u0tlxoiictysfmDuan o (4tlxoir to1fmD  i s s) 2xoxmpio1opeelfesl()aDurx o;u0tet iiciydlm rl( p;u0artomr3oatfmD aivsls0t2uoim ou4am elfeiat aDtru p;t4alto f3iytfs emnvo;u0aetnxf oytlpteln o s  exoxrpnodap   ivs t  Drmx  no1texn o3iasls umump t)tlerxfctytlm elivols)setr(m nudome liciasfartaxm nt1tltnif3ils s eluvpn(4tltnmr iotlmteanvi;( t2umirpiu4ap nlfvsls)s2umurooo1apenmf3iltla2rln p;u4 lxomf3iy1om raiei;( seumxopnodlm  miciasf ruru pnu4teeoif3iyslaDelump u)aetoxo ia1omDrlivi ( s2umim oodoptelfei tfsDumxm nt1aeto ieildla umuvsnt0 renif3iatfm  anvols)setmim iy4opeemnvs (f Durur ou1aptomfeilt sDumumpn() rerxocoa1fptrlu ols tetoxm nydomtn ics (fs2urxrp;u0oeeniieiysfs rmumo;u0trxnio ta1om r nes t) rur(o3nu4al nmncilsfsDtm(  no0oetoio3tyd s emn o;u4alenmo3oatlmtr n s ( s2ur(o3iy1ome  ivil(f Dua( pot0olxn o3iyd s2rm( s;()alenxrcoatfm  au o;s trumxopio1lle mnctatf rta(m no0tetnii3iysla rau s (0texrirciotlateau o () rumxm3nu4altnlfct (fsDrax ono1opeo ociat mDrmu p;t4trxrif3oodlp raivils t2xmim3iudol nlicta()s2tmum ot0tee ii3tldla em( o;() rxoir3ia1om ean slt0 rxoio oydlpt lnvtlt srtrur nt1tle mfctlt mDua( ont4trerio3iytopDe i s;t)t2urxmpiydlptn ivsl(fa2rru  ;u4ale ioetaslm umuvp u4tetnir3tytlmDrlueo t) rxrim oudam  lncilt a2rm( o;t1tpx mf3iyt mDra(vo t4artnxrcto1laDrauvi;t  etm(mpoo1lptnmnei s  2rmu  nu4oex  icils a rm( pnu4 leomoctatlp eauvi t0trumiopoudlp   ncs s  2tr( pno1tpxnifeiat sDea(mo;t) etomr3oydlmDelues;s0trto(o3iu4ameemnct (f 2tr(m nu1alenmfciadfaDrmnmo;u4texoxo oydfa e ivolt trtrir iu1ll  lfcil( s2tr(rpno4altnmfciltlm rm( onu4trtnircty1fm r uvi (  rtmio3oudlptnmicils srua( p;t1altomocilt a2ea( o;()treomf iytlaD an o (  2xoxo3nudoptelfcs s sDtmu  ot0oetnmicild mDrmn s;(4 lxrir iotlp  aivils0 2tmimpoydape mnvtat  rtrxm ;u0olenmociydlm2el(mo ()tleomr3iy1omDrai i;( texrxrpoydalee ictl(  2ra(rpoo0oexoifetytfs2ranvo u0texrxfcootoa   ueols0sexr(o nu1llt lnvi t aDrrx ono0aleniieiltfaDrluvs t4trxnif3iodlatrln s s)s2xmir3iy1lpt liesl(fsDtr( oou4apto ietlsfm2um( s;t4tetniocoodop e neslt)srxo(mpiydllenmicia( artrx  no4oltn i3iysfsDemnvs ()trxnif3oodoaDeauvs (0trur(m oy1ll e nvslt s2trxmoou4oltnioetatfaDranms ()aexrxf3oatlatrlueo;( s2toirpiydll nmnei tf Duru  ot1altomfciydlm2eanvpnt) exnxociy1la raies s)teumxmpny4lpen icil()sDumx pno4tee ifctld m2em(vs;(4 rxomo3iotfmDr uvsls)setr(r3iy1lm  lfeia(fa2tmumo;u1olxnmi3iatlm ean s;t0tltrio tytfp eauvils0 2um(o3io1lpenlfcias srraxmpnt4apxo fetytla2ulnvp;t4trxrif3iodlatrauei t0trxoim3ny4lmenlnet s)srua(root0tetoiieiatfsDran o;t4 etrmr oy1fmDr neils)sexo(m3nu4ll e nciltf ruru  ;o1tet  oetldfm rm(mpnu) eenmocta1lmDr nvo;s  etrir ou4aptnmnetlsf 2rmum nu0olx ii3iadlsDean p;u4trxnmociadopteaies;() exr(o ou1apte ivs sfsDrmxm ou0tpto fctatfa2em(mont)trxrmr3ty1omDeln s;(0 rurxo oy1lm emnes s artr(r ou0aex mo3iytla em( o;t)alenxo to1fmDraieolt0trxoimpny1lpte fvs t  2rmxmooo1tptomf3tytfaDumums u4 lxrir oa1lpD  n o ()s2ur(r3no1op  mnes tf 2rauro;o1tle ifeils s el(monu4aexoxociydop  liei;t)texmim iu1ap elieia(f rtrx  no1aleo o3iyt a2raumonu0aetrxf oodlaDe nvo t0seumxo3nu1om nlietas) rua(m no1apxoioctytlm ulumo ()alenxoctadlp  aueo;t  eurirpoy4lmtn ivtatf 2raurpoo1tltoioetadfs umnvont0trtnio tatlmDeaivo (0 rurxo iudalt  ietas arrau ono0tetnif3ild m2eanvon()alenxo oadfp elivs;t) etrxr3nu1alt mfctlt) rtmumo;o1apxo i3iadfm2ul(mpnu)trtnif oadla rau i;s) 2umxo3oy1ll eliciasfsDur(  ;t0oexomieiaslm2rau s t4arerxf ootla  lu sl(0trxmxm nodllt lieta()aDtmuroou4optomietls m2ul(vs;t) rxomf3iydom  au olt  2umxo oy1apeemnci t)s2rmum ;u1tpe  ictlsls2umnmp u) leoir iy1latrauei s0 rto(rpoudlmt mncsa(  2umxm ;o0apenioctlsls rm(vo;t0teeoxrcoydfat livi;s0 exoio3io1optemnesls a2raxro;u0aee iociltlm2uanms;t0alenir oa1omD lu i;s) rxm(opiy4lle mieslsfsrrrxmo;u4texniiciltfs2emums;u0teeoxo3iatlaDeauvs (0 2uoxm no1lptn ivta()aDraumpnu0oetnmfciydlm rau o (4 rxriociatfpte uvi t) rtrxrpnu1ap elicias)a2taxrpoo1aee mfeiaslaDeln p t4altrmfciodoatr n ols) rtm(opoodlleelfvtl(faDur( ono1texoii3iatfm2eau p t4 leoxocia1fa eai o;t trur(r no4op  lnctas)arurur ;u0altn f3tasfsDum(monu) ltnxr oydop elues ()tetrxo oy4ape  nvt s)s2taur ;t1oetomictlslmDrluvo;u) ltoxfctodfa  lnei () 2trxr3iu4ol elict ( srtmumpno4tpxnmf3iysfa ul(von()trtnxrcia1om raneil()tetoio oudlptemfetat srua(ro;o1tet ifeiasfa ranvpn(4tetrmo3iotla  aneo ( trtmio no1omtn ici t) Duax o;t4apxo f3tasfa2rau o (0tetoxr3to1laD lieslt0 2xrxm oy4oltelfvsat aDtrur nu1tpe micilsfm2eluvsnu4altnxr oadopD auvs;t) exrxmpoy4ap n nes sfs2ra( p;o0tptnmo3iys aDrau p u)tlxoxfctodlaDrlnvsl()teuo(opoudll e ncs t)srua(rono0tptn ieiydla2umn snu4aleomr3oytom  lnvi;(0 ruo(o3oy1lle mivtas)aDtrx oou4oltomo3iltlm2rau pnu0tetoio iytlm rauvils t2tmxr oo4lm nlietat)a2rr( oou1optn ieiat mDrl( pnt0aeeoioctodfp r uvils)t2xm(r ou4ap elnesas)aDuru pot4opt moctldfsDean on() etnmr3to1lpD au s;t)trurxo ou1op nlfvtatfaDrau  ;u1olxniiciyt sDrl(vpnu)aexnio totopD an o t0t2urir oo4oltemncsl(  rraur ;u1opxnmieilslaDuluvsnt)tetnif3iytlmDr n o;t)teumxrpoodoltemieiasfsDrm(  ou4tlt  icildfm2eln o;u0trxnir3iadlmte ivslt) rxm(mpno1ape mict sfa2umu  ;o4tltnif3iyt aDrmump;u0 exnxoctatom eluvo s0seur(m iu4omt licslt)sDrmu  ;u1alt io3tas s eln pn(0teenif oydfat an ilt) eum(o iydlmtelfeiasfs2ua(rpou1tpxnmociatlm2ranmsnt4aetnxo3iatfaDrlues t0trumxm iodole miei tfsDtr(rp;o0oeenifeiatfs2rauvont) rtnio3ootlateai i;s truo(m ny1al nlnvil( aDuaxronu1aex mf3iytls2rmn p;t4treoxrciodfp rluei ()trxmxo no1apt mics s) rtmxm no4oet io3tys sDumnmo;(0alxnir tytomte ieslt0teuoxm3no1llt lnvs sfs2rrx oot1apt ioeiltfs2rlums;t0 eermo3oa1lmDrluvo;t  rtoxm3oo4olenliciat)a2umu p;u0olenifetad sDua( o;(4trxoxf3io1fp r ivo t0s2uo(opny4am  mfvt ( srtmx ooo0aetomi3ildla rluvsnt0 eerxrctadoaDrluei;s0srurxo3iodom  lnci ( artmxm no4oleo feiytla uluvp (0tetoifcoa1lm  lieilt)t2tr(r iu1omenlfcslt s2urxroou4apx mfeiydfmDrl(mp t0texnxf totoaDeluvs;s srumxopnudalt  nci s sDtaxmoot4apx mo3ilsla ran p;u4trxoifcoydoat lnvi t0truo(r3io4om  livsasfaDtaur ;o0oexn feiatfa ra(vp;(4 ltrxf oytomD luei (0 2toio3no1om  liesas  2rax oou1oex if3iyt s2elnmpnt4artnmr3to1latelies s)seurio3no1lpe  ncta( artr(r ;o4opeomieiysla uan onu4 rtrxf iodfpDrai ils0tetoxrpny4al  lfctat)arrrx oou4tpxo fciysfm uln onu) ltrif oytfptelnes;t0 2toxo3no1am emnvi ()aDtaump;o0oeenmi3iydlm2emnms;(4 lxomrctydlpDrlu s s)s2tm(o iy4lmenmfvias)sDtr(rono0opt  ietasfaDumuvp;()trtoiociydom  livi;( t2tmio3oo4lm elfeiat  rtmxmpnu1tpenmfctysls2umu s;t0altnxocoatomteli slt  2umim iy1lltelivsltf rrmxr nt1oexomiciys sDrlnvs;(0 eerir ootoaDrlneo;(0 2umiopou4optelnviat aDum(  ;t0tpt moeilsla eanvp;u0aexnirctydopte nvs;() 2xo(o3oo4lpe licil()arumu  oo0altoiictasfmDrl(ms () renmo3iadfp elivi ( teuoir oo1ll emncsltfaDtrump;o0aexnmo3iyd s2rluvpnu)trxrir3oa1opteai i;()s2xr(mpoodlp  lnvsa() 2raxmo;t1aee mociadlmDel( p;(4tetrirctytfa ran s;s)s2xo(o3iudam emfviatfaDraur ou4olt  fciysfsDem( onu4aexnxo3iytom eaieil(  2xo(m nu4am  lfeilt sDraxront1tpxnif3ildla eanvsnu)teeomr3ty1oa ran o;t0 2ur(m3nodomee ncils)s2uaxm nu1oex  fciadfs ul(ms t) rtnif iydfmt  n i s0srxrimpou1ap  mieil(  rrmxrooo4apx  o3tys s2ua( p;u)tltrxocoytlpDeanvs s0t2xo(mpiy1oleemnct t a2ta(mo;t1oetomociltfaDulnvsnt4aexomrciadfp   u i;s0srurir ou1oleemnct sfaDumu pot4aexo fctltfa2elnmp (0trtnio3todfm rlu ilt)setmir3iodal  mfctas srrrumpoo1aptnmo3iatfa2umuvonu4trtoxrctadopD  neo (0texmxr iu1apenmivs (fs2ta(mpot0oltoiieiadfaDran p;()arenxf3oatfatrlnvi t) euo(rpno4oltnmncilsfsrraxmpot1tpeo icilsla rmuvs u0 lxnxrcto1laDr n i s srxo(r3oo1ll  lncs s)a2ta(mp;u0ale mfeilsfs uluvp u)aleoxr iodlpDrauvo;t)t2xoxrpnu4omt liviltfsDtrumpoo1texnmfeiysfs rmnvp t0trxnir iydfaDraieilt trxmxmpoydopee fei sfsrtrxmp;t4optnif3tltfsDrlnmo;() exrmr3todlp eanes;( srtoxo3ou1lpe mnctlt a2rmxr nu1alt  f3ildfaDranmont4 etnmfctotoaDran sls) eur(o3iudale mfetasf Dtrx pot0openmoeiadfsDemnvp;t0aeerxo oytfmt lu i;()t2um(rpiudameelnvsls)artrumo;u4aet mfctytlmDra(vs;u4tetoirctotfp elueol(0teuoim3ny1ome  nvtl(f 2rrxm ot1tptn iciys a2uanms;u0 eerio3iytfat lu sls trxmxrpio1altelneia()aDumx ont4ale mfciytfa eanvo u4 exrmocio1om eau sl(0t2uoim3oo4ol e ieta()arta(r no1aeeo ietys sDeanms t4texoir iotfmD  u o;t s2xrxm no1olte neil( a2umxmp;u4opt  fetytls2uaums u0 rtoxrciydfpt ln i;(  exoim3io4altnmietatfsDtrurp;t0altnii3iyslm ua(vpnt0 renir3tytlmDr neo ()teumio3iydope lfciat)srrm(rp;t1opt  o3tldla em(vp () ltoif oy1opte uvi t) rtm(opno1apenlnvslsf 2tmum nu1tpt ifciasfsDean pnt0 rerif3oadfpD aivol()t2ur(opny1al n fvi (  2rru  no4tpe mo3tldfmDuan ont0 eeoircia1oatr uvi;(0 rxrxrpou4ope mietatfaDuau  ot4olt  o3tytfsDemnvs;(0aetnmo ia1fp ran o s0t2xoxopnudlp n nvsa()a2tau pot0tpx mi3tldfs2ul( p;t4tltrxrciodfp   neo t0texmir3oy4alte icsltfs2um(mpnt4opxnio3tas a2ean o t4arenmr ootomDr n ils)s2toxr oo4ol   iei t s2rmuronu1tpxomfciytfm2elumo;t0altoif iodomDr u i t0 eumim iu4lm nlfvi s)arrm(rono1tee  fetysfs emn on()texomf3todfmteaieslt0 rur(m oy4ol e neslsfaDtrumono4altnioeilslaDul( sn(4trtrxf3iotlm eaivslt srto(opou4omenmfct tfarrax  nt0olxomi3iytlm2emums (4 lxoir3ta1lmte nvs;t0 2xr(o iy4lmtemfci tf Dra(  ;t4tlxo fciyt a rl(vpnt) rerio3tatom eli s;s  eumirpou1ame  fctas)srurxm ot1opeoif3tat mDulu onu)trtomr totomDelies s t2xo(mpoy1lmen nvsls)a2rmum ou1tptnmfeils a ulnmo;u) renio tadfatrlnvil()t2xm(rpnu1lpee ivsatf Duau o;o0alxo oeildfa ran p;t)artoifciy1fa eaivo;t teum(opny1alee nvs () rtm( p;t0aex if3tyslsDuanvp ()tltrmf3oodlm eaueo;s0trtrxo oo4lptemnesasfs2ua( pnt1oexo ociys aDrmums;(0tlermf3oo1lmDrlneo;s) euoim iy4lm emncs (fa2uaur oo1tex ifciatfa2umn p u4 eerxr3tadlpDe ues;(  2trir iu4ll nlnvtat  Dra(m no1oetomfeiltfa2emnvp t4treoxf3tadfmteai sls0trxr(o3ou4op e nvsas)a2um(rp;u0aee mf3iys s ua(vp t4aeenmf3iodfm  aivo ()t2toim iudolenlieia( sruaxm nt0ape if3iysla2em(ms;(4 rxrif oodlmD  ivslt s2tmxr no1lmee ics sf rtmumpnt0apeo fcias s elums;() exrifciy1faDe neo s0t2xmxr3oy1ome  ivs ( srtmx  no0tltn fcildls2rauvpnu4 eermr tydfmt  uei (0srxm(mpoy4ll   fvslt)sDua(rpoo0oex ioeiadla2rmu s t4 rtoxf iytlmtr n o t sexrim3oydaltnlnvsa()aDtm(monu0tle if3iltlm ranmo (4alenmr to1latr n i;t0s2uoimpny1amee nvi t) 2ua( poo4oeenmoctas a2rlnms ()teenmr3iotopDelu o;(0 rtrxo oudlp eliesa(  rur(ro;u1openmoetysfmDuan o u0 exnxr3iotoaD  nvsls0 rto(opoodolt  fcslt)a2umxm ot0apt iiciadla2rlnmo (0altnmr tadopD  n s s)s2toiopny4optnmnvtas a2um( ont0tptnmfcilslm rm(mo t0aexrio oodlm r uei;t0 rtrir nu4ole livt tf 2rrxrpnu0oeto f3iatfaDrmnms;t4alxoxf3oa1opD li i (0s2trio nydameemieta(faDtmx ooo1aeen fctasfs2uauvsn(4tlxrif oytoat  ies s0trumiopnydol nlici (farumu pnu1oltoifctls m2el( s;u4teermf tydoptrlnei;(  2tmxr3iudapt  fesa(f rtmuro;o1oetnio3tys a2rau s;u0treoio3iydomDelueo;s) etmxr3ou1ol elfcslsf 2rauro;t1aexnifciltfm ean pn(4aeeomociy1lpDean o;s  rxoxr3oydlp   fvs ( artau p;o4tpx moctlsfaDulu o u)aexoxociadop r n ilt) eurxo no4ap  liet s srta( p;o0tet  feiasfs um( s u4artnxfctytla eaieols0 rtoim io1op   fvtatfsDuru  nt4olt iieiysla2rmn onu) etrxo tadoptrlues () etm(rpny4amtnliesas)s2urumo;u1apxnmfciltls2rmumpn()tlenxf3iadlaD lueo;s0trur(m3ou4lmt mnctasfartmxmp;t4altnii3ils sDuau snt)alxrir3oa1opt aneil(0srumir3nydll   ieil( a2tm(moou1opx mo3tlsfs ulnvp;(4teeoio tytlatelu i;( srtm(r3oydlmenmnctat aruaurp;o1tle ioeiadls eauvo;()trtrmrctotfm rauvi (0 exrxmpnudape mfcias  Dumxm ou0apeoifeildls rmn p;t)trxnmo iotopD ln i;(  2umxo oudlmen nvils srua(r nu1opxo f3tytfsDeanvp (4trxoir3ta1fa  li ils0s2xm(m iy1ap   fcia(faDuaxro;o1tpxomoeiydla ea( pn(0alxrmf3oatom e u sl(0trxr(r3nydam nmietltfarur( p;o4opx if3iys s2ulu o;u0tleomocoadfa raueo;s)s2uoxr3iy4omte nciatfsDtmxr ou4teen iciyslm umnmp u) lxoiocoa1fa rli i;(0trxo(m3oy1omenmnvtas  Drmxr ;u0alxn oeiyd s2elu s;(4tltoxf3oydlm   ueols0t2uoxmpnudomte ici (faDraurpnt4aexomiciat a rmnmo t4altrxf ty1laDr ivo s0setoim nu4al  mivils) rrr(rpnt4alx mociatfaDumn pn(0 etomf3io1op r n o;t)setmim3ou1lmtelivtls)s2rruroot4tlxoifciatfaDemuvpnu0tlxnxfciydlmtr uvo;()trxmxopnu4lm n icilsfsrra(rp;o0tlenioetytla umuvpnu0trxoxrcia1lp eliei;t t2xmxo3iodamt mncs t) rraumpnt4teeo feiysla emnmp u)tlenmociatfm   ues t)texmxo ny4olen icsatfs2rrx p;o1ale  ietytlm rlu s (0arermocia1lmDranvsls0s2uo(r ou1apt lieta()srrmumono1aee  o3iltfsDua(vsn()aeenxr3oytoate iei s  2uoim no1ame  fct ( sDra(mo;o4tpenio3taslsDeauvs;t4arxnxr oa1fm   u s;t0 rtrxm io4lmt  ivil() Dtaxm nu1aexn oeiytla2uluvp;t0trtnif oytlmD livols seurimpoy4olt lictat)artrum ot1oeeo i3iltla ulnvsnt4treomr3todopteln ol()s2umxr3no1lm  lncsl()sruauro;o1apxomi3iasfsDul(vo (0trxomfcoytomteliesls)srtoiopnydlmtnmfvi t)sruaxmp;o1tetomi3ils mDrmn p;u) rtnif3tatlate nvi s)srtmim iu1apenmfcilt a2ta( p;o1oeenmf3iaslmDulnmp u0alxnmr3iadlpDr nes t s2tr(o oydom  lietat)a2tmum ;o4tpx  oetysfa umnmp;t0 lxrir iydfaDrlnes () rxm(m iodlpt  icias a2tmxm ;o0tpe mociydls2ean s u0teeoio tytlmDr uvol(0 2xm(o3iy1aptelfet (f Dtru pot0olxo fcilsla ua(mpn(0 leomr oa1omt ai o;t0setrxopiudapt lnei t sDrruronu1oetnifcild mDem(mon(0aexnmo3iotfpteaieo t  2trxo iy1olte ieias)sDra(m no4texn ieias aDumuvpnt4 ltnxf tadlm raneils0 rxrirpoo1alenlnesas)sDurxmp;o1apenmicilsfaDeluvs t0 etoir oo1lm elnei t trtmio io1om nmivta() 2um(  nt0aeeo i3tldls ra(mp;(4trermocoy1opDeai il()t2xo(rpou4llt mies (  2tr(mpoo4teenif3tldfa rlu p;(0tetrmr3iytlmD livo;t)s2uoir oo1ome mfvta( sDumuro;t1altomi3ildla ra(vp;()altomf3ta1oa rluei s)t2urio3oo4ape lfvtl( s2trump;u1oetniiciytls2rmnvpnu)trerir3tadlp rlnvo;t tetoir3oudal nlfeslt) rumx  no1opt mietas m2ranmo (0alenifctydlmtelivils  2urxopou1altelnvtat s2urur ou0alxn o3iys a2ul(monu4aleomf ty1opDeluvs;t seum(o io4lltn ieias aDra( ont0apxn ociydfaDumumonu)trtrmocty1oaDeluvs s0teuo(rpiydomte fcsas  rrmuro;u0apxnifciat s2ua(ms (0 exomrctodfaDrluvslt t2uoim oudomtnlfet s) Duau oot4tpx  oeias a2ranvp u4trtrxrcoodom rauvi (  eumir3iu4lp e ivsls a2rr(rpnt0teto oetyslm2em( o;t)aleoio3iodomDe nesls) eur(m nudlmeelnci () 2urum no1opxo iciydlaDeluvont0 rtrif3todomDe ivil() 2xrim nydolte nvilsf Dtmu  ou1aetn f3iad a2rmums t) lxnxfcio1om  aivo (0 2xrxr no4altn fcia( s2uaxm nt0tpx  fciysfa eln s (0aetoir3oydlmtr nvs;t texo(mpoy4llen ncsas)sDumu pou4teen o3ildla2ea(msnu)tlxrifcootla rli s;t0trxoxr3nodomenlncsl()srrruroou1aet  ocildlsDum( o;u0 eenmf3iydfat ai s;s0srtrxr3iu4oltemicsas) 2tmxmp;t0aexoiictls m ea(monu4 lxnxociytfa rlnvslt0 euoir iu4altnlivsat a2tauront4tlxomoctat mDul( s (0 ltoxociotla elivolt trxmxr io4lpte ieils) 2uauroou4oex ifctydfs2ulump;u0 etoxr3io1lm  luvs t0 rtrim ou1amtemneta(fsDtmxmo;t4alt  f3iyd a ul(vs (4 ltrxo tytlptelieils) ruoiopiydamtemiviltf Drrx p;u4apen f3ilsfs ul( pnt0altoxfciotfm  aieilt texoxo iy4lptnlici t srtmxmpno0alt mfetas a2rl(ms ()alenif ootla   ues;(0srurim no4ap n fcsl(  2rmx  ;t1tpxn octlsfmDuanvp (4arxrmf3iotoa ranvsls)trxm(o3io4optelfvi (fa2tr(rooo4oleoiietltfsDeau s u4 rxnir3oydfmtelu o s)s2urir iodlmtn ivtat)artr(  nu1tpt iictat s2rmn pnt0 exoirctadopD aieil( t2urxo3nudameemfviltfs2trxm ot1oexnifeias mDel(mp;u4tetnxfciy1lmtrluvi t0 rtmxo nydol nlfcil(f rtmx  ot0aee  o3ils s rauvo;u4 rxrmr iy1lp   neo s0 2xoimpoy4amenlnes t sDra( pno1apt mictadlm ulump;(4aetnmo3tydfaDran i;( srtmxmpiodaptemivs sf 2rmx pot0opto feildfa2uanvo (0arerxf oadlaDelivs;( trxmirpno4ap nlfcias aDtau o;o0tlenioctyt a ra(mpn() etrmr3tydfm   nvi;()truo(opiu4al e fci () 2rmxm nu0optn o3tyd a ranmo;(4 rxrmoctodomtr i olt0 2xrxm iodaptemfcia()aDraum oo1oee if3tat s2elu pnu)aeerio iodopDr ues t)tetmiopiydome  i
\ No newline at end of file
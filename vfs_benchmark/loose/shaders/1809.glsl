@@ -0,0 +1 @@
+iei t  etm(opno1optnlivta(  rrmu p;t0oetoif3tys s ul( p u) rerxr3iytop e nvo t  rxrimpoy1ame  nvil( srrruro;u1alenifeildla2uaumo t)arxnifciy1op e neo t0 rtm(r oy1om nlnvi t a2ta( poo1opxo oeiad a rluvo;u)alenxr iytlaD livo t0 exmimpou4alt  net ( arua(r no4aptniiciatls ean pnt0 exomo3iotoa  ln o t) 2ur(rpiydom   fesat) 2raxrpno4apxniictasla el(vo;t0 rxomociytlpDeli s s)trxrim3ny1lltemicsas srtr(mono0ape  f3iyslsDrm(mo;() lxomo3oy1fat ln sl( t2tr(o3oy1oltnlivs s)aDta(ronu4oet ii3iat m2ua( p u)trxnxfctytlptr i i;s0t2uoim oodomeemfetlt)aruaurpnt0tpt  f3ilt s ul(ms;u)aeeoxociadlpDelnvo;t)t2uo(m3no4omen ncta() Draxmo;o1oltnii3iltla2umnmp;u)trtnio tadomDeauvs s)trto(r3iu1omenmfeiasfsDtax o;u4tlt mi3ils sDrmu o;(4 lermfcty1lp  li s s0srxm(rpoy4altnlfcsl()s2rr(ro;t1optomietytls2elu p t4aetoiocoatla  lieo ()texo(rpoo4omt mfcs sfsDurxm ot4teenmieiysfm2emnms t4areomrctatlateluvol(0seumiopoy1opeemnvilt)sDum(rp;o0alt  ietasfaDemuvs;u) eerir3iodlpteauvs s) rtrio nu1op n ieilt) rra(m ;u0alt io3iyt sDul(vsn() exrifctytlmte iesls)texmxr3ou4alt  ncil()srtauront4tpx iieiltls elnms;u)aetrmr3tydlp ranvol( sexmxo3iodolenmfvsas aDrr( o;u0altomf3ildlm2uauvs u)trerio3todop r uvs;t) euo(r iy1al e fvil() 2ra(  oo0tleoioctydfs2rmuvpnu4 exoxo tydfa rlueslt0 rxo(mpiodlp   ncils) rumu pot0olxo oeiyd s2emnvpnt4alxrircoo1lm rluvs;t0 exo(o oudope lnes (faDuaur nu4tpe  feildfa2em(vo;u4 rtrmf3oodoa  aies t texrxmpou4aleemics s  ruax  ;u4oleoii3iatls2rmumo u)arerxfcoadopt livilt0trumimpny4opt mfesat)sDur(rp;t0aee mfciadls ul( o;u4 etomrcto1lpDeau i;()srtmimpnydlp   nciat sDtrxmo;u0alxniieilsfm rm(vo t0 lxrmo3iadoatr uvs;s s2uoim3no4olt  ictatfarua( p;u1aet mfciysfm eln o;() eenxf3oodom   n ilt trumio3oydam   nvt s)aDtaxrpou1aptomi3ilsfm2ua( p;t)tetoif todlm rln o t0 2xmir3nu4lp nlivsatfa2uru  oo0optnmiciat s eauvsnu) etrmr3oodoa r iei s  ruo(mpiy4lle mics (f 2tmumpnu0aexoiociasfs2em(mo t0 lxnir3to1fmteln olt)t2xrxr3ou1ll n feias)aDtaxr nu1tet moctldfm2rauvo;t0treomf oo1faD lnvslt)s2um(opny1llen ieils sDururpoo1oleomieilt m2ulumo;()trerif3io1op rli olt t2toxrpoy1op n ivil(f 2rm( o;o1tpt  o3iltls umnvp;u0alxoif3iotopDelivo;t)trxmir nydop nlneias)srurx  ou1oex iocias aDul( sn(4 rtnmo oydlmteln s;s) euo(m ny1alt mncs tf rtaump;t0olxnio3tydlm ranmon(0alenifcto1lp r iei;( trtm(r3io1ame lictls)a2raxmp;u1openmi3ildfa2ua(vs;u)aeeomo tytlpt  uei (0sexrxm3no4lmenmfciat)sruaump;t0tptomf3tad m2umu snu0aetnif3tytfm eaivi;t t2xoxr3io4al n ivta(f rrmxr ;u0apeniietldfs2ean s;t4tltrmo3oodoate uvo;( tetm(r3ny1optemiet (fa2rrx  oo0aex  ieiasfsDumu snu0tlxoio3oo1fa  li ol(0srtr(mpiodap  lfct t) Dtmu ont4aetoifciatfsDeau o;(4treoio3ootfpDrauvi;t0s2toxr3oodap  mfcsl(fs2ururoou0tpxn fciatfa ra(mp;t4 renir iatlptelu i t)seum(rpiodolee fcias) Dtrx onu0tee mfcilt m2el( onu4aexnmf oatlpDeluvi t  exm(r oydoltnmnvi tf Dumuront0tet io3ilt mDemn s (4texriocoytopt anesl( teuoxo ou4lltn ies t srrmu onu1tpx io3iys a2ea(vp;(0trtnmocia1lpD lneo;(0seto(opny4ol elivilt)s2rm(  ou4ape moctadfs ulump u) eerxo ootfmt  nei;(0teuoxopnu1apte ictls  rurx p;o1tpxnmoetyd aDulump;u4trerxr3iadfmte neolt)s2umxmpno1ll  mfciat)artmxr ;u4tltnmoeiad m2um(vo (0 ltrmo3iydla   uvslt) eur(r iydam  mfcsl(fs2uru  nu0oeeo feiad sDraump () rxoxf3oodlptelueslt)t2xr(r3oodlmtemneiltf rurxmoou4openiociydlsDrlumo t4aeeoxr3oydfatranei;s)texmir oodlme  fei s)aDtmx  ou4optn i3iatfa eauvs;t) eeoio3ta1lmDr iesls  rumim ou4ll  lfviat) 2rrx p;u0aex if3iadls ulnms (0artnir3iydomtrai o s0s2xrxrpoudom emfvsat)arraum no1aptnioctydlsDrmnmpnu0 rtnxf3oy1opD liei ( s2to(r3io4lptemivslt sDtmu  oo4tee iiciyt s2uau o () lxnxo oydomD aivsls  rurim3ou1omen nci sfsDrru  ou1aexnii3ilt a raums;u0 etoio tadfmD lnvi;( texo(mpiy1lleemivtat) Duax  nu1alenmfeiad mDeanvont0 rerio tydlpt anei;(0srtm(o3iy1am n ivt s)a2urxm no0tlxnmociltfm2ulumsnt0 exnioctytlm  aueolt)texr(mpoo4lle  nct () 2trxmo;o4opx  ociyd mDrl(mp (4 rxoxf tytfa ean o s)texoim iodlpt  nviat)aDtmur ;o0texn oeiysfsDeanvo;t0tlenxo3io1lp  an o;t sexrir iy1lltn nctls) Dtmumo;o1aexn ocias sDuluvo;t) eeomo3iatom elneil()t2xoimpoudapenmneta(fa2rrurpoo1oexoii3iltfa rl(mp (0aeenirciadoat  nvol(  rtm(m oo1apt mnetatf 2ra( onu1tlto oeiasfmDeaumont)alxoxf oy1oat au o s)srto(r ny1omtemietls)srrm(ronu0tlx iociad a2ul(ms u4 etnmocoytoateauvi t teumir oy1optemivi tf 2rmxmonu1apx  oeiasfa uanmont0 eeoir3tydfm  ln ilt0 exrxr oy4lmt lfcta(fsDta(ronu1tlto i3iltlaDem(mo;() reoifciytfm e ivo;(  2xo(mpnu1lpenmneilt)aDtaxr ot1apenmoctat m ranvs;t)aetrio3oy1op r n o;(0setr(m3nodll n ieias a2tm(monu0tltnmfciytfs2emnvpn(0aeenxo oytfa elueo ( t2xmxo3ny1oleelncta(  ruau p;t0oexn ociytfmDem(ms;(4 rxrxrcoadlpt auvi t0trxmim iydll n nctlsfaDum(m no0olxnifciltlmDrmnvo u)tltoio3tatfp rlnvi s) eur(m oy1op e fvilsf Drr(rono4oltomfeildls2emn pn() renxf3oy1lmt an il( texrxo3iudlpeemneta()s2tr(mo;t4alxomictyt s2umnvonu)tlxnxf ootfpDeaueilt trtrimpiudopee icsa( arrmuroou1optoif3tyslsDuan o;() rxomr tatlpt ln i;()sruoxo no1ol   net ()a2trxrpoo1texnii3tltfm2ulnvo ()aexnxrctatopDr neo ( srxrxmpnu1lmee fvils s2uaurpou1tpx iictysfmDemnvp ()trenxf3iy1fat aueo;(  2uoir3io4op nlfcilt sDurur oo0aptnmo3tysfa el( s t0 rxnxr iytlatrliei;t  2to(o oudaptn feilt sDuax oou1tle mociatlm2uanmsn(0 rtnir3oatfpD  uvi ()teuoim3iodomeemfvtas arum(  ot4oexoiociasls2rlumo;u4teenxo3tytopt  ivils0setoim3ou1lmeelnvi (fartaump;t0alxnmo3iaslmDel(vo u0 lxriocio1fmD aivsls0 rxmxr oy4amen ici tfsDtrurpnu4oleniieilslaDuluvpnu4 exrxo3oa1lp  li ols0t2tmxmpnu4amen icsltfarta(  nt1apen ieiatls2rlnvsn(4aeenxr oy1oat an i t0trumio ou1lptemnet sfsrraxmp;t1ole moetlt s ea( o t0alenxrcoy1fp   i o;(0 2xoir3oo4ol nmfvs sf ruau o;t0optnmictlsla2el(vp;t4 rtnif iytlaDraues t) 2tm(m3ny1ol emneiat)aruax ont4tle mf3ildla ra(vo;t)areoxf tadfaDeanvs;( s2uo(o3no1om nlnesas a2rru p;u0oex ifctydla uauvpnt0 exomr ta1fmteaueol(0setoio3nudoltemfvsltfa2ra(rp;o0apeo feiysfa eanvs ()tltoifctodlmDrlivo t0 2xmxmpio1lp elfctat sDrm(m no4tetomocildlmDeaumsnu)artoxo ty1lp e nes;(0t2tm(m3no4ap emfvt ()s2trurpno0olt  o3iys aDulnmo t)texrmf ia1lp eli o;t setmir no1ol  lnctatfs2uaurp;t0tleomfetad a2eln pn()trtoioctytom  lu i t)s2umio iy4lmtnlivt t)arumxm ou0oee  fciytlm2rln o (0artrmrcoo1faDr n olt0 eum(o3nu1llenmnvi t  2ururp;o0openioctydlmDrau s t4aexomrcootopt ln ils t2umxm3no4optelivi t sDumum no1teto fciadfm rm( ont4tetoifcoodlpDe i sl( srxoir iu4apeemfet t)sDumum ou1aetnmieiatla2umu o;t4artrmoctydlp  aieo;s t2tmxm ou4omee nct tfaDuaxmont1aeeo ieiltlmDea(vp (4arxrmf3ia1oat  nei;(0 2uoir3oudomtnmiciasfsrur(root4ale  oetydlsDum( o;t)aexrxf oa1la rlueo;t) 2xoxm oy4om elfvs (f rraxrooo1tpeomicild aDrm( o;()aexnmociodop   ieo;(0 etoirpio4opee fei tfs2ur(rp;o1opt  ocias aDelnmsn(0teeomo oo1op elueo;(0t2trirpoo1omt  fvs s)s2rr(mp;o0olx mfetysfsDranmo;t0 ltrxrctatlpDrli s t s2uoirpou1open ncta()artru  ;u4tee if3tld a eanmp t)tlxomr3iodfmteaueo;t)t2xm(m3iy4lpe mivtlt srra(mp;u0aetoifcilsfa2ean pn(0trtrirctotlatrlues (  rtmim3nodll nmnctas sDra(mooo4altomo3ilslm emuvont)tltrxo tydlm  lnei;()setmxm oo1aptnliesls) 2tr(mp;u4ole mo3iltfaDemnvs;t)alenxrcty1fatran s;s) ruo(o iudlm n nvi ()a2trur ;o4oltoiiciyd s ul(vsnt)tlxrif iatlm r n slt s2tmim no1lp e nei s  2rax pno0oeen octlt aDuanmp (0teeoxo oatlmDeaivs;s) etm(rpno1ameelici (  Drrur nt0teeo oeiltlm eauvs;u)altnmo3oydlaD  u sls)setoxr iu4ale  fci s  Dtrumpot4openifeias m2umn p;(0altrmr ootlat ai slt trtrxr3iy4oltelicsatfa2uaurp;t0aptomietatla rl(vp;(4teenxociydfaDeliesl() 2to(opio4amtnmnesas) Drm(rpno4teeomo3iyt mDemump;t0 rtnxocto1oat li s s)seumirpiu4ol elfvtltfaDraxmpnu0teto ieils a2ua( ont4arenxr tydfp r i i;t)s2um(m nu1om  livil(fsrtmxr nt0tex iieiydlsDuan p u0tltoxo totomtrliei;t  2xm(r3iudlp nmictlsfa2ururpnu0oee mietasla rmumo u) rtrxo3oodom  an ol(0teto(r3oodaleelnctl( aDua(mpou4aexo f3tydls2ra(mp;u0tlenmo3oatoatrai o s) rxmimpny4altnmivsatfsDurxmont1tlxn oeiadfm2eluvsn(0teenmo iadfaDe n s t)s2uoxrpnodoltelncta(fsDtaxmonu4tpxniociad sDrlnvp;u4trenxoctydlptrlueilt0 rxoimpnu4al   fvs tfaDua(ront1aex ioeils s2umnmo;u4tetoifctotlmDr uvo;t  exmir nodlmtemnctl( s2raurono4aleo ociyd m2umnmp u0trtnxf oadlate uvi t)srtoxm3ny1alte nvias)a2rm(m nu1tleomoeilsfs ul(vs;u4aexrmr3to1om elieil() 2tr(rpoy1am elici t)s2rrxr nu0tlt mieiad mDelu p;u4trxrmfcoadlm e nvi;( tetmxr3nodopen fcs t) Drmurp;u1tpeo octys mDea(vs;t)tlenmf3todom elnvo s sexoiopio4lle  icil(farua(rp;u4tptoifctys s ulnmo t)artrmfctotfpt ln s ( teto(m3nu4ol   net t sDur(mono1teen f3tltls2ulump;u)alxomr3totlp r u i ( trtoir3ou4al  mfesa()sDrmumo;u1oet ioeilsla2rm( snu) eenifcoy1fm  lies t s2tr(o3iy1ll e nesasf ruaurpno0openiiciyt sDeau s;t)aetoxf oytoa rlies;()srtrim ny4ameelnvt s  Dtrurooo0aptnioetas s umn pnt0artrmr oo1la rln s;t0s2uoir3iodlmt lfesa(f 2ra(r ou1tptnioeiat a ul( o t4 leoio oy1fp eanvilt)s2uo(m oo4llt miciasfa2ta(ro;u4teen i3tatfm2ulums (0arxnmr ty1faDr nvs t)t2xrxm3io4am  mnvsa()s2tr(mpnu1tex miciadlaDrl( p;t0 lerio iatfa   uvs;(0seurxo3oy4ole  neta( sDtmu  ;t0texo feiasfsDrm(mp;t)tleriocto1fp  livsl(0seur(opoo1lmeelnvsl() 2rm(  ;o0aex ii3tld mDulnvp;(4tltnxf3oodom  an i;s srtoio io4lpeemivt () Dra( ono4tex mfctlt m2ua( onu0tetrio3oy1fat aiei;()t2tmio ou4alee nciasf 2trumo;t1oeeo f3ild m2umnvs ()aeenir oa1oatrluvol(0 rxm(m iudap   ivils a2ta(m oo0oleomf3tasfa2elnms u4trenxo3io1fmD  iei s sexrim nu1lpte ieiat) 2rrxrp;o1tpt  ieildlm2eau o;u4tetomfcio1lpD ai ol(0 2xr(m3io1om e iesl() 2ra(  ;u4oexnmictasfa2ea(vo (4trxnxrciatlaD aiei s) 2xr(m io4llt  ivsa(  rrrx p;t0oltn ieiysla2ul(vo (0teenxr3oy1oa e i i s  rxr(m3nu4ole mnvsl()srtmur nt1oex mfciyslmDua(vsnt0 leoxo3ta1laDelivi;s) rurim iudlltn nvs (fs2trum ;u1optnmieiydlaDra(mp;t)tltrmocta1lmD lies;s0 2um(rpiu4ap  mneias)a2tru ooo0ape moetlt sDeaums;t0trtrmf oo1fmDe ieol(0 2xr(rpny1op elnvi t sDtm(m ot4aet if3iys s2raumo (0aeenmr3io1fate ueo;()texrxopno4altemivi sfa2uaxro;t0aetoio3ils a eluvp u0teeoir3tatlp e uesls)tetmxrpoy1lmen ivi tfs2rr(ro;u1ole mf3tas s eaumo;t0 exrmoctodfmD  n o;t0setrirpoudaltnlnviat srrr( pnu1alxoiictlsfs umuvp;()alxnifctodopDe neo;s0tetm(o oodlm  lncsls artruroou1aexo o3iyd aDel(ms t0tlxnmo3iadlpDranvol()trumirpnudapenlfvia( a2urxrpno4oexoif3iltlsDuan onu0 rerio3ta1lpt luvsl(0teuo(m iu1alen feta()sDrrumo;o0alxnioetatfa rmumsn(4aleoir3iodomteln sls  eurxm nu4omen fes ()a2ur(rpot0apen ieiatla el(vpnu)arermr3to1la ranvo;t0s2xm(opoydaptn iviasfsDum( o;u4tlxo feiysfs2umnms u0arxnxf3tydopD aivs;t)truo(rpou1lme  ivtl()sDurxro;t4tetniiciytls rl(vo;u)tetoircoatlateaieslt) 2toxrpnudalt mnvt tfarum( p;u1aleniociltls2rmnvpnu)artnmrciatlm e uvo;t0tetm(r oo1alenmncia()s2tru o;t1tetn iciytfaDuauvp u4tlerir todlptr u s;s)trumxrpiudolee nct (f rurx pou4tle  iciasfm ean s (0altomrciadopt luesl(  rxrimpnodopen nvslsf 2trxrp;t4aexo octlsfm eau o u)arxoxf3iatop  ln o;s setrxopnu4al   fvtl() Drr(rp;u0aetomiciasla2emu o t4altrmf3tadlpD  ivols)teurxrpno1lme lfvslt sDraxmo;u0ape moeiyd aDem(vpnu0 reoxf3ty1op   n i s0srxr(r ou4op  mivslsf rurumpoo4tpeomo3tatfm rmnvp;t)tltnmr ty1fmteaneol(0trtrir oodlltnmiei sfsDuaxmonu0alxn iciadfa2eluvo;()trxnxfcoadla eai sl() 2tm(r ou4lpt  iet sfsrraxrpnu1olt miciydlaDumnmsnt) lenxfcoadlpDeaivi t s2xo(m nu1ll e nvs tf 2uaurpoo4tlenmiciad aDumnmo t)tlxnircta1omt aueo;s)srtmxr oy4omtnliei ()a2ua(  ou0olt ifeiasfm2rl(mon(4trtrxr3tytlm eauvils0 2trxr ou1ol   ivs t)aruaxronu0tlxomfciyd a ua( p t0artoxo3oydfpD luvols) 2urxm no1olenmici (fsDrmumont4altomo3tadls2ua( s (4arxnif tytoate iei t sexrxm oy1lp  livia()a2rauront0opxomi3ild m uaumo u4arenmr iytfmte ivo;(  exo(o nodole lnctasf rrm(moot4tee  ieiadfaDrlnmp u)alxoxfciotop e neo;s seuoxm3oydamtemnei t) rrau o;o1alt  iciysfaDuanms;t) rtrxr tadlpt  nes s  etrxo3oo1apenlfvsls s2rmu ont4ape mociltlaDumnms t4 eenir ty1oaDe ues s)srxoimpnu1lle mfesa(f 2tmu  ;o0tet  f3iltfa2um(ms;() lenio3ty1fa  ln i;t seum(m3oy4lle mieia(fsDtm(mono4teeomo3tyt a2em( p;t)tetomo iatfmtelu o;t) rxoirpnu1amen ncsls) 2rmu p;u4apeomf3iydfs umuvp;t4aleoxf ta1faDe ieil() rxoxo oy1oltnmnctltf Dtrx oot4oeto ocias a uanvpn()trtoifcty1lmtelu slt s2urirpiu4op elivs sfsrtau oot0alxnmociadfaDeanmonu)trxrir oytfmDelivil(0texo(r3oy1lltnlnvt sfsrum(  nt0tptnmf3iadfaDrmums;t)arermf ta1lpt livs s)t2xmio iy4lle miesasfsrururono0opx  oeildfa2ul(vp;u)tlxrif3iatla r n ols)trxrxr3oy4lmt lfet () rrru oot4apxn f3iytfsDulumpnt)teerirctodlm raivs;s0s2xo(r3nydoptnlivta(fs2ur(m ;o4opxo f3iltla2emn p u0trxoxr oo1lpDrln olt) etrir3nu1lleemfvtatfs2tmumpou1tpe iiciydlaDemnmo;u4aexnxr3oatlpDe uvslt0setm(m3no4op elfvtatfa2taur ;o0apenif3iat sDulump;(0trxnmr oy1lat lu o;()seurxrpiydlm nmies (  rtm( o;o4texn ociat mDrluvs;t4 leoxf oadopD  nesls)t2tr(o oy4ole lnvsas s2rr(rp;t0tlen i3iasfm ulump;(0artomf3iy1fa e u s t t2urxo nu4lleelivsas)s2uaxmp;t4oet mocils a ulu pnt)tlerxf oytlp e u i t) 2tmxmpno4openmiei ()arrrxm ou1opeomictat aDeluvp;() lxnmf3iodla e nesls)trtm(rpiy1oleemicias)sDurxmp;t0aptn fciytfa uauvsnu) eeoir3ootlptr ivsls0srumxopno4ope mfei (f 2rax o;o4teto o3tysfs eluvsn(0 lxrxf3iytoatr ieo;() exrxr3iodol nmncs () rtr( onu0alx mo3tlslsDuanmpnu) ltnxfctatfaDe uvil( t2xoim io1am   fvt s sDumurpnt0aetoifeiysla2rmuvs u)alxomrctodlmt  ivi;t0teurxo3iu1oltemieia(f Drm( o;t1opeomf3iatla emu o t)arxnmr3io1lptelivi;t  eurirpoodopenmivtat a2umxmont4teto o3tlsla2ea( s u0trtnir iydlmtrlnei ()trto(opiy4alt lneiltf Drrump;t0tltomi3iad s2uau s t4 renio oatop eln s;t  2xm(m3nu1oltnlfcilsf rraxrono4olx ifciys aDemuvp;t0 exoxocoa1opt li olt0 2tmim3oudaleemnvtl() rtr(  nu4opeoioctldlsDrl(vs t0alenio3oodfmD luvsls0s2tm(opiy4alenmfvsatfs2rax poo0opt micilt sDem(mpnt4 etrxrcta1lp eanvo s0 2xrxo3nudlmt mictl()aDtaxmont0tpxomietlsfm uluvp;u4texomo tydlmDelneo s0t2um(rpoydlpe liei t)sDtmxmooo0apxoii3iatfs umuvs;(4 lxrxf oa1fpDelnvi;s0 rxo(rpio4omenmict sf Draump;t4tlxnifctls a um( snu4tlermocio1fat aivo;( t2trxr3oodaltnliviatfsDtaur ;u4teto f3iatfa2rm(mpnt0aeeomr totlmD aneo;( seto(opnu1al nlfcia(faDtm(r no0tpeoiietyd s rau snt4tetrxo3iy1fp rau s t  2xm(r no4om nlict tf ruru pot0opxnmoeiatfaDrluvpnt4 rtniocio1oa   n i;s)tetr(rpnu1omee iesat  rtm( oot0olx  fetlt mDumn s t) exrmf3to1lp e u o (  rtmim3iu4llen fcilt) Dua(r no4teto f3ilt m rl(vo u) rxrmf oytoaD ln o;s  2uoxopoo1aptnlfvta(  2tmxro;o4tetomo3iatls eln s (4tltrxr oa1opDrlnei s0srxoio oudol  lictatfs2rrxmpnt4tpe  i3tysla rlump t0texoxocia1fm r n s t tetm(r3ou4ll  mivtl()aDtmu p;t4alen o3iydfs2ran pnt4 etoxo totfp r uvsl()s2xoxm3oudlltemfvs tf rua(mono4tlxomfetat mDeauvs;t0trxoxo3totlat  ues s)s2to(mpnodlltn feilsfsrumx p;o1apeomociytfsDuln s;(0arxrxo3iodoaDraieo (  rtm(o3nu4lp nmnctltfarumxro;u0olt mf3tltfm2rlnvs t4 rxnmfcoo1fatr u il( t2umim oodome  feiltf rta( ont0oex mf3ildls2el(ms;t0texnxo3iatfatr uvi ( t2xr(o oy4ol  livia() Dtr(rpnt0opeo o3iasfmDra(mo u)arxrmr iadfm rliei (0t2uoir3nodlpeelfvias)artrumono0aexomo3ilsls ranvo;u4 etrxo3tatla eau o t0tetm(o3oudllt miesls) 2ur( pno0alx mo3iat sDua(mo ()aetrio ta1oatr ivilt)s2xrio3nydlltnlivia(f 2umu ono4apx  fciyd mDrm(ms;()altrmf ia1optelneo t teto(r ny1amteliviltf Drruro;u4alt mfcilsfm um(mpnu4arxrmfctadfptrlies t)srxrxm ou4ol e nvtls)a2ua( poo0altnmfeilsfa2emnvo t0tetoxo iy1op eai s (0s2tmxr3nu1ape mnvi t)a2ur(rp;u1apxomi3taslm ea( pn(4artnmo3oodfmD lnvs () ruoxopiu4ome lietat sDumxmpot0tlt  o3iyslm rln p;t) rxoir ta1faDrlivi;()seto(o no1amtemfvsa( s2raxmpno1opx mi3ildlm el(vo t4 leoir tytfp rluvilt) rumxrpiu1alt lfcta( arraxronu0ale iiciyd mDem(mo t0areoxociadoaDe nes ()s2xmxrpoy1ll nmivilt) rum(mooo1olxnmi3iytls elnvsnu0 rxomrcia1lp  anvilt0trumiopnydll emfct tfsDurxr nt4oeenmf3tat m2ranvo;(0tltnxf3oa1fmt livs;(0trtrxopiy1al   iet t) Dumxmoou1apxomi3tydlm eaumonu4tetomocootopteau o s trxm(rpiy4am nlnctatf Drruro;o4olx  iciat m2rln snt) etnifctatlp  an ilt)s2xoir ou1aleemivta()artrxrp;t0alxnmf3tadfs2rm(vont4tlenmr todlp eluei;(0s2xo(o ny4lme mfvtasfarraum nu0aex mi3tytfa emu o;(4 lxrxocio1lp e ivslt)trur(o3iy1apt micsa( aDum(roou0tleo i3iys a umuvo;t4 ltrxr oa1opDraueo ( seto(mpiydop nmfcsatfsDrr(mont0ope mo3tys s rmnvp;u)tetrio iadlmDr uvslt0s2trir3ny4ale lfvs tf rrrx oou4alt iieilt s2um(ms t4 etnifctadopD lneil(0s2tm(rpoy4lle lfcil(f Drau  ;t1aex ii3iad s2raumsn(0 ltomf iodopDrliei;s)srurxo3iy4lpe  nvs ()artrx pno0aptnifciyd s2elu p (4artrif3oytlmDran ilt srurir oy1om  lfctas)a2tm(m ot1tpen fetlsls2rln o;t4aetoxf oy1lm eai ils) rtmxrpiodom e icsatfs2taumpno0olt mictytls rau o t0texomf3io1fmtelneo s)srto(mpiu1am   fvsat sDrrumpnt4tpxo ieiat s ua(vs;(0 eeoxocio1op   u o;(0 2xmir oo4amt mfcs tf Drmxrpnt4olx mf3iysfm2eaums (4 rxoxoctotfmD lu s;( srtrir ny4amtelfvta() 2rau  no4tex  oeilt a2rmn o (0arxomo ty1fmt anvs;(  exoio nydalt  feiat)arrau o;o0tlxn ieiltfs2elumsn(0 rtomf3oodfaDr uei;s)s2xrxo iudlpeemfeia( a2umump;u1alenif3iyt m elumo u)aleomr3ty1lm eanes t0 2um(m3ou1ol nmfet (fa2taxmont1oltnifeiad s ulnvonu0 rxnmo3oy1fp rlu ilt  rtmim oydlme  icsl( a2rm(rp;o0aetnio3iyt a2ulnvp t)aexrxrcty1fm e n sls) 2tmxm3iydlpe  ivsasfs2tmxrp;o4aexoioeiadlaDrauvp;(0 lenmfctadfmtr uvols)t2uo(mpiy4lp  mnvsatf Dua(r nt0opx mieiatla rl(vonu4alenmf oo1lpDeaueol(0 2umirpiydol n fesls  Dua(  no1apx  i3iltla2el(vsnt0 reoxoctydfm eai o s0 2urxr ou1lp elicsa()aDtmxm nt1apt  oetat aDrmums;u0texrxo ootlatean o;( srxo(m iydap elnvt s srraxmp;t4tet iociad s2ra(vo u4altrmr3ty1lat auvsls)t2um(o3iydlm  liesat)sDururoot4oexomf3tlt m ranvpn(0arxrmo3ia1la rli il(0 rxoxm3oy1llt  fetas)aDra(r no4oltn oeiaslsDrluvp t)trxoxo oatfptr i i;t)seumio io1amtn nvsls)aruau  ;o4alt  octysfa um(mon(4 eerif3ootop e n o;() rum(o oo1aptnmivslt)artrx pnu0apeomoeilsfa2ea( p;t)tetoxr3totomt  ivsls tetrim oydopte ivt tfaDtau pnt0tpeo o3iatls2rlnvsnu0arxoxr3todlpDrlieo;s sexrxo3iy1lmt  fvsa()aDum(r no1olt ifctasfmDrlnvp t0texoxo iy1lat anesls  rtmxopoy4am nlnctas sDuru oou0ape ifetld aDea( ont) lxomo3ia1lpte neilt0 exo(m3oudlmeelieil( a2ur(mpoo1tetnii3iasfmDumnmo;() ltrmo3iatopt au o ()t2umir3io1amtnlnvtatfa2tr(mont1apt mietatls2el(mp t0 lxoxr io1fp e n s ( s2tmim oudamen fvi s)aDtrur ;o1olx  fciydls2el( on(4artrmr3todfateai o t0trtoiopiydop n nvsatfaDur(mp;o4ope  iciydla rau o;u0tlxrmf tadoa e n o s) rtoiopoudalt  ncs ()srraxm no0alxoif3tytfs el(mo;u)trermo3tadfa  luvols0tetrio3iodlptnmfeslt) 2ra(r no0oetoiocias sDrau o;u) exnmrctytfp r ueils0 2trim3oy1omte nvsat) 2umum nu4tpeo ieilsla ulu s u)aetoxrcoatoa  lues;t trxmxopoudoptn nesls)a2tm( pot0texn ociyt mDelu s;() rtoioctydlmt  u ils)s2to(r io1al elneias  2tmurpou0aee  ietyd m ulnmo (4 exrxr3ootfa rln i (0 eur(opny4opee fci (fsrtrxmo;u4tpenif3iytfa uau s;t0 rtnifcoatomDraivs (0s2trir3no4lp  lnctat)arrr(rpou4tetomfeiaslmDuau pn(0 exniociy1oaDelivo;s0 etrim3nudal n ics () 2rau ont4tlxo ieils m emumo;u0tlenmfcoydom  ai s s0s2toiopnodom emfcias) Drax o;u0oex io3iytfa emumo;u4aexoxr3tytfpteaivi;t0 eumimpoydomtn ietasfsrrm(rp;t0tltomociyd sDem(vonu)aetrif tatfaD  ueo t)t2xmim3nudlpt lics t aDumx pot1apt  o3ils m2rm(mont) rtomo3oa1fptrau s;s0trtoxrpny4lpenmnvsl(farua(rpnu4tlenmietlslsDrl(vsn() lxoxocta1lptrlnes s)texoir iodap elfei t srurumpou0tpx miciyt mDua( s t)teeoir3oy1om eluvs (0 etmxm oy4omen nvtas)artrxm no0oexn iciatls eanvo;t4tltnxrcootoa e ueo t0trxrxm oodopenlnct ()sruaxmpno0oexo ietlslsDra(von(4tlxomo tydopDrau s;s0 2xm(m3ny4aptnmfvsa()srur(r ;t0tptoiieiad mDrmumo u0alxoioctotlp  an slt0s2trxm3oo1lltelfvs () rrrx p;u0aetn iciyt s rlumo t4arenxfcoodop r ueo;t0 2toir oydlpenmfeiat)srrmu  no4apeomietydfsDumnvo;t0tlxoir3tytla  auei () eto(r oodlp nlfctl( a2uax  ;o4aptn ictad sDulnvo;u4 reoxf tydfa   ieil()srtmxo3iu1ll   nes tfaDtr( p;t1oex  oeilslm2eanmo;(4 ltoif oydlmDrai i;(0 etmxrpny4lle  nct sf Duaxrpno0tleniietldls2umumpnu) exnmfciotfmD lnvol() exr(m oydlm  mneias s2tmum oo0aeenmiciydlsDuanvo t) ltoxo iy1fm   neo;s)trtrxm io4al emfct t) 2uaurooo0olen octls m ea( p ()alermf iy1opteai i s  rumio no4olte fvsls)s2umxrpno0alt  o3tld sDrmnvo;u)altrmf io1faD  neilt)sexrxo iu1amt livi s)aDta(m nt1opxnio3tld m uan o u4trtnxfcia1fatrauesl()t2toim3oydol   iet t srrru  no0tltnmfctatfaDumuvp u4 eenif3oytomDr ivi (  ruoim iydopenmnct () rum( oot1aexnmieiat aDuluvp;t4 rxnifcta1fatran s s0texo(o io4oltnlfvils s2umur nu4tltnmicilsls2emu p;() rxoifciadfmD lu sls0s2umxopoy1lp   iesat  2rrxrp;u0oetnioctydfa2rmuvsnu4tlxnmr ty1omDr ueo;s)tetrxrpoy1ap n fci s)a2trurp;t4oetnmoctyd mDemnvp;(4alenxo tadomtraivsls sruoxo oo1lm  lfei ( sDumxm no0apenifciadfs ran o (0tleoxo iydlpD  ivo;(0t2xrim3iodole  nvsa()sDra( onu1alen oetyt sDum(msnt0artrxo3tydfa elnes s) 2xr(mpno1lptn neil() 2rrumont0tetn i3iaslsDeanvo;(0alerircio1lp elivils teumxmpny1lpeemnes tfa2ur( pou1tpxomfciadls eaump;t0 eermf3tydfmtrln ilt)t2urxo oodlpt  icil(f 2tr(  ou0opt mo3iydlm2uauvp;(0 renio oo1lm rlu ols)t2toxr3iu4ope  ivil( sDtaxr ;t4aetniieiasfm umnmo;t0tltoxfcoo1fp  livi;t)trurio io1open neil( artmurp;o0apeomicils s2ul(vs;u0aetrmo iotopt  ies;(0 2trxr3iudll nlieil(  rraxmono1tpx moctat sDra(ms;(0trxrxo3ia1la rauei t0texoim ou1lm  lneias sDurxmooo1apxomictydlmDea(vp;t4tlxrirciy1omtr neil()trurxo3ny4amee nciat a2uau onu0oetn ociatfa2rl(vp t0 lxrmo3oadfptrluvsls)srumxopiudaltnlfeias  2tr( p;u1oexoioctydls ulnvs;u)aeeoio3tytfpDeai o s  etrirpoy4ome lnvt tfaDur(m ;t4tex ioetydfm2eauvo () rxoxrciadopDrauvols0 2tr(m3iodome licias aDurx  no0aee  oeild sDran s;u)alxnxf3oytomDelueo;t) etmxo oo1apeelfesltf Drmurooo1tlxo o3iyslaDulumpnt)tlerxr3to1lpD aivo;s0 2triopnudam elfciatf 2rm(mpnt0tpe mieilslaDea( pnt0aeerxf io1om rlivs;()t2tr(o3ou1op elnvtltf rtr(mpno4oetoioeiyd a2eau o;(4tlxriocia1fp  auvo s0srxmxr3ou1lme  netlsfaDrm(rp;o4olto o3iadfs rmuvp;u4 ltomo3iotoptraies;( srtoio3nudalt liesls)aDtm(ro;t4tpt  o3iasla uanmp;(4trtnxo3iotlp  lnvo ()t2urxr oudam nmictlsfsrtax  oo0tptniiciyt a2ulnmp u)trenir3io1laD  ies;s) euoxm iy4lpte netas)aDuaum ;t4altoiociltfsDrau s;(4 rxoio3iydoatelnei t)sexr(mpnydaptelncsas)arta(mpnt0tltn iciatla umuvp;(0tetnmf oydlm  luvol(  eum(opny4am e nesltfsrtrum ot4apen ocias mDrluvp t4tlxomociodlaDelueo ()t2xr(r3nydalt mfei ( srtm(r nt4aetoioctydfaDrl(mp;t)trtomf oadlm rln s;(0t2tmxm3oy1op  lfvt t  2rrx  oo1altomocilsfm2rlnmpn(0arxrmr3iy1lp rauvi;(0texm(mpiu1lm emncs t)s2ur( o;u4alx  o3ildlm2eanvo u4arermr to1la e u o;t) 2xrimpnu4amtelfeias)aDtm(root1tlt  o3ildfm um(mpn(0artnio ta1lpt aieslt) exo(mpoo4optemnetl(  2rm( pnu0aexoioctldfm2ran s;u)alxnmr3oo1fp e ieil()trto(o3oy1amt licsas)sDtaur nt1oee ioctadfmDemums ()arxomr oa1op elnei;(0truoxmpiy4lm  lfvtlsfsDtmumpnt4ape  fctytlsDeluvs;t)tlxnmfctotomtean s s0 euoim oo4lltelfesls)srtrum ;o4alx  icilslsDuaums t4aetomo3todfa rlnvols)texmxm3iy1am e ncta() 2umxr ;t4olx miciat a2rluvs u4 rtoxfctotfp e ivolt0t2xo(o3nu1olee net ()a2umu  ou1tpeo fcildla elumpn(4tlerxf iotlpDeln i (0teuo(rpoodome mfeslt aDtmurpnt0texniiciltls rmnmo u)trtrmr oa1la rlies;t0setrim no1lptn nvt (f Drrumpoo0olt  o3tas a2rm(mo (4tetrircio1fm eaiesls  2umir oydop e fet tfartmx o;u0tle if3iat m2ua(mo;t0 lerio ta1om  aivs s0 2tr(o io4ameelnvt s)s2ua(m ou4tex mictltla rl( o;t0 lxrio to1oaDe uei ( srum(r oydamtemnetl( a2tm(r nu4aex io3tltfaDul(vp;(4tltrmo3iytfmDe nvilt s2ur(r oodlptnmnetat)sDra(mo;o0olxnmictlsls2umnvs u)alxnio3oy1la  anvi;s)sruo(m oo1lpe  fvi (  Duaxmp;t0ale  fetyslm2uaumsn(0 renifctatoaD livs;(0t2toir iy1oltnmfvilsf Drmum ot0alt mi3iytla2uln onu0aexrmfctodopD lu i s0 2xoim3iu1lp nmiet t  rtmu p;o0tltoif3tatlsDeau on(0artnio3iadlpD  nvs;s)s2toxo iydop n ietat) Drrum nt1opxn fctlslsDuanvo (0tetomr oodomtrlivs s trtmxrpiu4llte fvil()srtr(r nt0aex ioetadlm2rlu p () eerxocoo1lpteai ol(  rxmxo3io4lm n iesa(fa2taxmpoo0aleomoeiat aDuauvp;u4trxnir to1fmD lneol( s2urxo iy1apt  ivias  rrrurooo1tex mietat mDrau s u4tlxnifciy1latraiei;s0sexoimpno1ale lfetl(  2taxrpno1olt mo3iad s2eln o t0tlenio3iodlmDe u o t0srum(r3oudamtnlfvils) 2um(m ot0aex  i3iltfs eanmp;u0tetnmocta1opDraueils0s2xm(o3nodom nmncs tfs2tmxm oo0openmieilsla raump;u0aeerif iatlmDe ies t trxriopnudalee ietas) 2trxm nt4teenioeiytla ulnvpnu)tlermfctatomDelueo;t0texmxrpiydolt  fesa(  2rmu oot1olenmoetydlmDean ont0 rerio3io1omDe nvs t) 2toxo oo4lltemictls)a2tmxrpno4openioetas a umnvs;t4 lerxr3tytfmt lu slt0 rxrim3oydlp  liesltfa2ua(ro;o1apt  fetasla uln o;u)altrxr todopDr nvolt0tetm(o iodolt lfct tfsrtm(rpno4apeomfeiadfs2elumonu0tlxoifcoa1fa r i o t0 eumxo3oudaptnlneilt) rrauront4tpxoif3iatlmDrauvonu4treomfciadoa e neo;t0s2xmxo oudomtnmnes s) rtaurooo4aeeo iciyslm ulnvo;u4teenxr oytoa r ies t0trto(m3nu1omtelfet (f ruru  ;u1oet iiciytfs2rlu snt4 exnmf todoa eauvol( trtrim nu1aleemiciltf rra(m ;o0aeto icias sDrmnmsn(0 lxoxo3tydfp   nei;(0s2xoxm3nu4ol n ieta(fa2rrx pou0olxo fciltlsDrau p;t4aetnir3tatfat li o (  euo(o iydllen nci t)srrrx  ;t1tee mfcildfaDelnvs (4tetoxo oa1fat luvi t)t2xrimpiodll n ieils s2uaum ;t4oeeomfctad sDranmo (4trtrio3iadlmtr uvol(0teumio oydape lnesat  rtm(r ;o4olxo ietltla2umn s () rxoxo ootop eliei s) 2to(o iu1al   icsls s2rmumpno0openif3iadlsDum(monu)aeeomf3ootfa eliei t srurxo io4lleelfci ( sDtmu ono4tee  f3tlt aDulnmsnt)altoxr3tatlaDrau ilt0 rtrimpnudol  mivtlsf Dtau pou0alx iociytfa um( s t)trxrmfciodom   neilt  euo(m3oy4lleelieilsf 2umxmont4apen o3tytlsDrau o t)trxoxf oa1opDr u ilt  2umxm3oydlmtelfvslt)sDumur nt1oexnio3tydfm2elu s t) reomfcoatomt  i i s texo(r oudap nmfeiat  2trxrooo1oex ifeilsfs rlu s (0tetrmfcto1lm e n i;s0 2xmxopio4am   ivtas  Dtrump;t4tptnmictlslsDumnvo u4arxrmociotfmt  i ol(  2umxo nydapeelfvt ()sDrrum oo1aeen f3iysfa2rmums;t0 lxnmr3ty1op   u sls)s2tmim3oo4omt lnvil() Duaxm oo4tlto octasfs2ean pnu)tlxrif iatfat  ieo t sexr(r3nodlme lfvt sfaDrr(r ;t1alxnif3tat m ua(mp t4 lermfctotlatelieols0 2uo(r3oo1lptelivia(  2raum nu0olxo fctytfm rauvsn()trerxr oodfp  aieo t)srur(opio4lmtnlfeil()aDua(  ou1opxnifetadfs el(mo u4alxrxr3oo1fm   nesls  etm(m3nu4ap  mncs t a2taum ;u0aetn oetld mDumuvont) ltrir oadfpte u o;s  2umimpiy1alte ivi sf Durx ono4texomfeiydlm elnvs (4 reoir3totlm e uvo;t t2xmxo oodllt  ietas arrmurooo0opt miciat mDemuvo t0aleoifcty1opteaivo s0trxrxr3iu1amt livs sf 2umurp;t1tpx mfeiyslm2uauvo t4teeoxfcoatlmtean s;t0sruoio3iu1lmeemivtl(f Drm(mo;t4teen ociasfm2uan p u) eerir ia1lp rln o;t0 eur(r3no1om  mietlt a2ta(mpoo4teeoio3iatfmDumuvo u4 rermr ty1oat luvs ( teumiopoo4lltnlictltfaDrr(rooo1oltomfcildlm2rln pnu4trtomo3oydlp rliei (0srxr(o3iydalt mieil( aDrm(mp;t4apt iieiltfa ran o (0alerxf3iadfpDean i;t)srtmirpoy1olt lfvsat)arra(m ;t4olxnmf3tadfa uln s;u)aeenmfctodom   ues s)trxmim nodap nmnet (fsruaumo;o0oetn oeild mDrlumonu0trenxr3ta1faD  i s t0tetmxm ou1openlnvi (f ruru o;t4tpenmfciat aDranmp;() leoxfcoy1fpteanei;s tetoim3oudlp   nctl( sDuaur ot0optn ieilsfmDemnms t0 lerxf3oo1oat anei;()teur(o3ny1apenlnei (fs2rmxr no1aexoifeiys aDuln snt)trtnir tytopDe ieils  eur(o no4aleemfvslsfarurxmpot0ape ii3ilsls2rluvp;t4trtnmf ootfmt luvo;t setrxo3oo1ol  lncta(f 2trx oou0apx mfciasfa2ulu sn(4trtrxo3iotomtrln ils)teuo(m ny1ll n fcias  rrr(mooo1apt mieilsls2ul(mo;u4alxnxo oytopD auei;( srxoirpny1am nmnvias) rraxmp;o4oex moeiys mDem(vs u4 reoxrcta1opDrau i s trxrxr iudomtelnesa()s2tm(r ;u1teeo oetasla2rmnvsnu)tltoio oadoat  nvi;t)teurirpoy1alenmfeil() Duaxr ou0oee ifctydfm rl(vp;u4areomo iy1lpDranvilt0srxrxmpoy1ame lfvilt sDururono0tee mocils m2rl(vs u)arxrir iotfptrli i;s)setrim no1optelnes tfaDum( pnu4oleo ieilsfaDrl(vs;(4alenmrctadlm  lu ilt)truo(r no1amtn fcsatfa2umxr oo1oeen o3iat sDra(vpnu) rtrir3totlatr uvo;() rto(r ou1lle  fvsas)s2um(mont0tetnmf3iatfs emu ont0trxrircoatfat  nvo s0s2xr(o3nodaltnlict sf 2tau  ;o0aeeo f3tldls2emnvo;(4trerifcoodoa elu il(0 2trio3io1lmen iet (farum(mpnt0tpeo fciadfm2emnvs (0trtnio iytfateanvi t) 2umio3oydom  mieias s2ua( p;o4tex mo3tyt m elu sn(0trxoxr iytlpt  n o s0setr(o oy4apeelnvils  rtru  ot4oetnmfciat aDraump;u)aexrifctadfmDeanvi t0srtmio3nudol e nci ()sDtm(mp;t4tptnmietldfmDrauvo;t0 rxomfcoy1oa r nvo t0 rtm(m3ny4lm  mnvia( artaumpnt1aeenmfeiltfs umnms t0arxomo3tytla e i o s  rumim iodal e iciltf rtruront1oetoifeiad aDul(vo (0arxrifciy1fa ran slt0s2tm(m iy4lpee ivsl()srtaumoou4apto iciys a rauvsnt4altnmr3iydlat lu sl(0 exmxo iudamenlncsa(fa2umxmoou4optoio3iydla2emnvs (0arxrxf3oydlmt aneslt)t2ur(r iu1ll nmnesat)sDrrx  ;o4oex ioctatlaDemu s t)artnxo3oy1lat  nvs;t0tetm(opou1llte ies (fsDrrumpno4oexniictlsls2rln s;t) exnmr oytla  an s s t2uo(o oydome mncil()a2rrxm ;o0tle ifetyt a um(mpn(0trtomr oadlaD li i s)trtm(r ny4lp elicia()srumx ono4tlxo fetas sDulnms t0aetrmr3iytfmtraivo;s) eumir3nudlmte feiat)artmu pot0tetoioctydfsDel(mpnu4alxrmo iy1optelneo;(0t2tm(opnydlmtn fvi ()s2rruroou0oetnifciat aDrmums u4tlxniocootopteanei;()t2toim oy4am  micsl() rtmurp;u0teenmfeiydfaDeanmon() ltnir3ia1lp eliesls)tetrxrpnodape  ieilsfsrrru  ot1olxo ictys sDemu s u)arxrio totfaD  ues ( sexoxo3nodlltelictls arumu  ;o1aet ifeilsla ean p;u0alxrirciytomt aieolt0texrir3io4lm elies tf Dtmx p;o4opx if3iasfm rm(vpnu4arerxf3iatfmD au slt)truo(mpiydap   neils arumxm ;t4apx iiciatls2rmu p;(4 exoif3totfa elnvol() 2umxr iy1am nlfesa(fs2ur(m oo4ape if3ild s2uln o t0altrxf3io1fm   n i;t  eum(o3iodamtemivia()srrr(rp;t4oltniicildfa2rlu pnt)trtoxf3tytomtelivsl() eumxrpiy4oleemfctls) 2taum ;t0apenii3iyd a2ua( s;t0tlenmfciy1fptrlnvs s)t2xo(r ou1amtemnvi () 2uaur no0oex iociatlm em(mont0altrmrcoa1omD  uvo (0s2toxopoy4al nmfvtas  ruau pno4aex  i3ils mDeln o;(4altnmrciy1fmt  n olt texrxm3iu1omteliet t aDrmxrpoo4tpxoio3ild s2ean pn(0altnmociotfaDr uvo s0srxmxrpoo1ale lfesl()a2truronu4alt mi3iadlmDum( p u)teenxfctodfpDelnei t0 2to(m3nu4op  liesl(  rrauro;t4opxn ieiyt s uaump t4areoxr iadfpDeli i s s2trio iu1om   fci (f 2rm(m ;o1apenmictatls2el(vp t)arxoio3oytfa  lnes ( texoir iy1ol  mivs t) Dur(ro;t1ape ii3iadfa2uanvo;t4 etomo3oa1opDrlneol()srxoir3oo4opeelfvs s aDra(rp;o1oexnii3tadla rmnmo;u4alerif3tadfpD li sl(  ruoim iu1lm nlncsl() rta(mpnu0open feiat mDrl( snu0 etnmr3iy1op   i sl( t2toio3oy1openmfcsa( aDrrxr nt0tee ifeiltlmDrln s;u0teeoxoctadoptrluei t)truoiopnydalte iciatf 2tmxro;o1aet miciysfs raumpnu4trtnmfcoytomD anei;t)srtoio oo4ol n fcs s)sDumumo;u4tptnmoctasfs2umump;(4 exoxf3iadfp eai ilt)trxrimpoy1al nmfvia() rumx o;t1tptn i3ildlm ua(mon(0trtoioctatlpt an ils0trxoim3nu4lpt mnvs ( aDtmxmp;o1aleniiciyt m2raumsnu4arxnxr iodomte neo;s0t2tmim3nydamt  ies t)aDua(mpou4oltniieiad m emnvpnt)tltrxo io1fpD anvs ( srurxmpno4am   nvtl(fs2rm( oou4opxo oetldlaDemnms (4alxomo iatfp eaues;s) rurim nu1ome  nvta(f rtrxr oo1tetnmieiadfmDranvpnu4trxomo oodfmD aneo () rurxr nodom  lnvsas)aDtr(rp;o1oex mfctatlmDra( p u0aeerxfcto1fm elivi s srtm(mpnu4olte ictls)srra(  no4teeo fcils mDelnvp;(4aexrmo oydlpt  nvs s0 rxmio nu1ome mnciltf Dtm(m ;u0tee  ocild a ra(mpn(0arxriocoodopD lies;( srtmirpny4olenlnctltfa2tmumo;o1opx  f3tldlsDemuvsnu4tlxnxrcoydfm eaivo s) rxmir3iodolte fvtlt  rtmx p;t4aex ioeiasfa2uauvo;u4 ltoxf3iy1fmD luvilt0trumim iy1lpt mnci s  Dtrur ou1ope  icildfmDrluvp (0 lerxo3tatopDraueilt) 2uo(opoo1omen ncsls)a2trumooo4tlen f3iltfm emumpnt0trxoxfcto1lm raneolt)seum(r iu4om n fctl(f 2rm( poo0tee mfctls m eln pn(0altnirciadfmte nes s)t2uoiopnu4am  mnes ()aDtru  ot0ope ii3iydlsDranvpnu4texnirciadop   neol( seuoirpoy1ame lnci tfsDra(m nu1aptoiieiltla2elu o t4 rxniocta1lmDe i sls)tetoiopnydolt lnetls)sDtmx oou0tlxoiociytls2el( p u4 lenio3ty1faDe ivs s)setrxr nydal nmietatf rurur nt4tpt moetatfaDulu s t) ltomo oytlp rlies;t0truoio nodlpenmfcslt s2umxmo;o4tpxnif3tlsfm uaums;(0 rermocio1fpteaueslt  2toxo iy4lltn ivsl()s2um(mp;t1apeoifetlt a2em(vp (4altoir3todopDeai o s s2xo(m oo4op  lici (fs2tmx  ;o0altnio3tadls2raums;t)tlxoxr3iadfm  li s;t) 2xoim oo1apeemivs (fsDra(mp;o1oex iicils s2eanvp;u0aetrio oydfaDe ivols) rtrio ou4op e nciat  2umur no1opxnifeiltlmDeau on()tlenxf3tytlmDe u o ()teurir ny4lpeeliviat)sDrm(m ;t0oeeo fctydlm2uanvont)trxnmrcoy1oa eli o ()sexmxmpiu1lmt  fes t) 2trx  nt4apt mf3tltfs2rm( ont4tleoxr3tatomt aueo s0t2um(m3ny1lp nmfcil()sDua(m ;t4alxn octldfaDum(mp;t4 rtrmrctotoateanvi;t  2toirpiy1opeelicsatfsrtaxr ou4apxn fciasla2ul( pnt) exnxociatfpteauvo s0srxo(opoo1am  lfvias  rraumpoo4ope iieiatfsDean o;(0texoifcoy1lpt  n o;s0tetoxm3ny1opt  ictls) rrr(m oo1olxn f3tatlm el(ms;()tlxrxr iy1fpDrln i;s)t2uoxm3ou4op  mfeia(  rumx pot1tltomi3tydls2eluvo;(0 rxnmr3tytlpDr i ilt0 2tmxopnu1ol n ies ( aDurum ;o0tpto i3ilt mDrl(von()tetomr iy1lmDrlivsl( seum(m3no1op e fci sf Dur(r ;u4tpenmfeiydlsDrmnvpnt) eenio oadfa eauvi t0t2xrxr iudlmee ncsls a2rmxr no1texo feiad s ra(vs t4tltomoctotlmtrln s;s0 euoxr3oydam  mfvtlt)aDuax  nt0aleo i3ildla ulnmp;t4aleomf3iytlmt ln ols)seumimpoudamtn nesat)a2uau ooo4oexomf3iytla ua(vo;u4arxoirciotla   uvs;t) 2xrirpoudalen icilsf rrr( poo4texnifciadls elnmsnu0 lenmr totfpDeluvo (  2uo(m iy4omt mivias)a2taxmp;o4tlto f3tlsla2eanvsnu0tlxnif oy1laDeaneo;()srxoxopou1lp n fct tfs2rmx o;u1texomfeiltls2rmuvsnu4 lxnir todoa raueols srtoir3iudapenmieiatfsDuau pnt4oeen ociydla rauvp t4alenmo3oodfaDe ues s0 rtrim oudlptnliciat  rrau onu1teenmociat sDeau pn(4aexoxr tydfa eanvi s0s2um(opoodap emiet (fsrraum ;t1oet  fctasla emuvo;t)tltrxr3ta1optean s s)s2tr(o oo4om   fctls arrr(rono0opxo feildls2rmums;t4 ltrxrciotfpt livo;t)tetr(m3iu4lpt mies ()sDrmu p;t4optn oeilsfs rmnvo;t4 ltoif3iadfat  ivols t2xrim3ou1lltn netatfa2umx  ;t1oltomi3iydlaDuanmp;()altrmocto1lmteluvo;()trtm(m iodlmt mfvta() 2urxrp;o4tpxnmieiyt a2umnvpnu4tlxomrcio1lpDr nvi t0srxm(mpoy4opte fes s)arrruronu0tpeomictyt m2rau p u0arenmfctadfm  aneilt)s2toiopno4lm nlnetat srurxmpoo4aptoiieilt a2rlumsn(4tltomocty1omteliesl(0 rxrxm iy4ap  mnesltfsDra( pnt1aexomoeilsfa rlnms;(0trxoif3iytlpt liei;s tetm(o nu1op nlfvtas  rtrurp;o0tet ii3tytfa ul(vp;t0alxrxociytomD lueil(0setmir oo4am emfvi t  rtau  ;o1opeoif3tldfm2ua( p;() leo
\ No newline at end of file
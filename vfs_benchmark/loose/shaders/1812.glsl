@@ -0,0 +1 @@
+ies t)trtoxrpoudame lnesa(  rrrxr oo0altnmf3ildlm2um(vo t4tlenif3ia1oat lnvi;t) 2tr(r3nudaptemnvsls aDuaxmo;t1opxoiociltfmDea( snt) lxnxr tydoa ran i;() eurimpnu4altn ictl(fsrtrurpoo4apxn ocilt m ua( s t4tlxrxoctodlmD  i sl()setmxr3no4lp  mfvs t srrmx  oo1opto oetlsfa rl( p;(0texrmfciydoat  uvi;()t2xo(r3oodoltnlfetlt) Drr(m ou1oex ioetatls rlnmp;u)aexoxfciytoaDr nesls t2xr(m3no4lptelfcilsfarrr( p;u1aexomfciyslaDem( p t4aetoif ootfptr nei;()seuo(r3oydapt mnetas a2uaxroou1alxn ieildlm2rl(vo;u)trtrxocia1oa e nvs;(  rtoxo oudol   ictas) 2ua(  ou4aee moetlt a2rm(vpn(0texnxr to1fa r i il(  2xmxr3ny4apen nvtlt)s2trumonu4aetnmfctlsfa2rm(vo;() etoioctatlmtrln o t0srxo(m3iu1lm nmieia( aDuax ono0alx ifctysla2eauvo;t) exnifcootlpt  u ilt)tetoim iodlm  lfciatf Durxr ;t1tleomi3iydlmDem(mo;u4aeerxr3iotopDraivi t t2xr(opno1ll  lncias) 2um( oou1tle mi3tld s rl( pn() etnmr io1faD luvsls s2tm(m no4llt  ivs ()sDraxmpoo1alx iictyd sDum( o;t0aeenmrctydfmtrluvo;(  rurim3nu4omtemiviat)aDta(rp;u0aexnmoetydlmDum( s;u)tetnxr3ootomDran s;(0 rto(r ou1llenmfctl(fa2ta(r nt0oet mfeiysfa2rau s;(0texnio3oadomD anei s0srxr(m3nodome licsls artmx  ot4optomociadfm2umumsnu0trxomo3io1lp e uvi;s setrirpio4apenmivil( s2raur ;u4tpt  octyt aDrlump u) lxnif3iy1fa eliei s)srumxm3oy1aptelnctasfa2ur(rpot4aleomfciyslsDuau s;u4tlxrirciodfmD  ueilt s2xo(o oudlp elncta(  2tm(ronu4aex iocild a em(vs u0aexomocoatom elieils) rxo(m oy4ap nmncils arrrxmo;t4opxnioeiydfaDulumo (0arxrmfcootfaDrauvi;s0 euoxr io4ol n nvt sfsrrmxr ou0aex if3iad a2eau s;(0texomf3ty1fa  anes;() eumim io1lpte fetl()srtm(rpno1tetnifciytlmDrln o;(0arxrio oy1opteaivi;s s2toxm3no1omenmfei s)srtru  nu0tpe mfetlt sDrln s;(0arenxf3todfmt livi s0trxmxm3iu4ape  ieils aDrm(  ;u4tet moetytls2rmu on()areoxfcoy1omDranvo s) rtmirpio4ll eliei sfsDtmxrp;u0tlen f3iadlmDrl(vp;t0tlenmrcto1fmDraies;t0srurimpoo1ole lncsl()sDtaumpnt0tptn f3iad m2rm(ms;u4aexrmo3iodfatrlnvi s trxmio oodop nlfctasfarta(  ou0opt io3tls a um(msnu) exnxociatlaD lueo () exrxmpiodlmtn nct (fsDua( poo1tptn oeild m elnvo;(0 lenio3io1laDrlivi;t0s2xoio3iu1ap n fei sfsDrm( pnt0olxomoctlt s uluvo ()trtomr ty1fpD anvi ( trum(r iodam elnet t arraurpoo4tlen feias s2umn snu0 rerir3oo1late n ols0trtmio3iodap elfetat)aDtrxr nu4tetoifciatfa emnvs;t4alxrxr3iotfaDeauvi s) 2urxo ny1apenmivi (fs2ta(r ;t1aexoioctysfs2ra(mp;u0 eenxrctydoatrluvolt0t2tr(o nydlmte fctatfsrrm(  ou1alxoiietat s elnmpn(0aetrmf iodfateln s;s0seurxrpno4ll nmnes t a2rmx oot0tlx iietysfm umu pnt0 exnxfciatlpD luvol( t2xmxmpnu1omeelfvsatf rrmur no0opxomietytla2rmn s;()aetnmrcootlmD an o s) rxoxo iydaleelict ()s2ua(mooo1olxomieias s uau p t0 exrxf iodfa ean i;()texoimpoy4opt  iei sfarurxrpnt0apxoii3tadfaDelu pn(4 eeoxr iytfmD li s (0 exoio nodaltn ivsas srrax poo4tpt if3tadfm2el(ms u)trenxf3iatoaDelnei t)trurxmpoydomt lfvsasfaDtm(rooo0ole iietytfsDrmn pnt4arxomrciytlaDr u i t)seuo(m3oy4ll elivs t)a2ta(r ot4aleomf3iys sDrau p;u4alxnxr3oytop ranvo;t  etrim3iudaltn fetat aDrrxrp;t4tetoiicilsfaDumumo;u0treoxociotla elu sls0 eurirpoudolen ictat  Dumxmo;o4oeeniociatlsDrlnmsnt) renmr iadop elnvolt0trtrxm oudalenmfcilsf 2umurpnt1optnmf3tltls ra(vo;()alxomr3totfaDr iei s srtmxo3nydllen ncil( aDurx oou4tpto fctytlm ea(vsn(4treoircoo1la r ivi t0trxm(rpiudap n ies ( artmxronu1tlenmf3iytfs2ranvonu4artnio3tytlm eluesl()srxrxr io4lm nlnes sfa2tmx  ;t1opeo fetlslaDea( ont)trtnmfcto1la rauei () eur(r ny4ll nlivils)s2ra(  nu1alen i3iatfm2rmnvon() ltnif3oytop  livo t)srtrxr iy1llt mieiat srrru  ;u1oetomictatfs emuvs;u4aeerircoatfm  auvi;s trxoxr3oo1al  liet tfa2rrumonu0tle mfciatfs2ulump u4arxoxf totop eaiesls truo(opio1lmtn ieta(f Drax  nu4openio3ias mDulnvsn(0tlxrmf3iadfpDelnesls teurxr oudam   ivi t  rrr(r nu1tpenmfeiytfsDea( s;u0 etnxf ta1oa  ai o s t2uoxm nodam  lneiasfs2tr(r nt0tlxn i3tlslmDuluvo;u) ltrmr tadomteaiesls sexr(r oodlme lnvsls)a2rm(rp;u1tptoio3ilslsDrmuvont4tlxrmrciotlp eluvo ()sexr(mpiudlp n ictls srrrumpno1ole mf3iytlm uanvsn(4 rtrif ta1lp rli s;s t2to(mpoo1om nmiei s) Dtaumo;o0tpen ictadlaDrlnvpnu) rxoiocto1om rlivs;t0texmxmpoo1amtn feiat sDuaxronu0oet iociad m2uln o u0alxnif tydlp r iei;(  exrxo oodll  lfvta(fa2rrum ;u0tptomi3tas s rauvp t4altoxf io1oatranvsl( s2umio oodoltn netlsf 2rmxm ou4tlxomieiasls2ulnvp;t)treomf iotlmtelies;s seum(r oodlmt lnvs ( srumumono0tptoif3iyt sDulnvs;t4arxrir iytla eaueo s)truoxrpiu4am elfesas)srtr( pot0optnio3iasfmDulu s u4trxrio3iydfp  au i;t)trtoxr oy4lpte ivil()sDuaxrooo1tetomfcild sDemn o;t)treomr3oytlmt ai s;()srxoiopnu4ale  ivtas a2uaum ;t1olx mieildlm2umn o;t0arermocto1laDe n olt0t2to(mpoy4op n fvias srua(  nu1oexnmieiatla2ea( s;(0 rtnir3ia1fateaivsls t2tmirpiu1lmenlncsls s2um( ooo1teenifciltfmDumuvont)trermrciotlat auvi;( teurir nodal   ncta(  2taxmoot0tlxnifcilsfsDulnvo;t)altomo tytfat  uei;s0sruoxopiy1lmenlfcsa() Duaump;o4aexnmo3iltla rmn on(0trerxr3ty1fmt an s t0 2xo(opoo4lptn ivtas)s2uau o;u1texomictyt m umnvsn(0trenmf oatlptrluvs t s2xoio3iy1lmeemfcta(  Dtaurpoo4tpxnio3tyd a rlumon()alerxocoo1omDr i o;() euoir iu1op nmnei t arum(m oo4aptn oetaslm ulnmo;t4texomo ootla raneilt)srtrxo3oo4amt micils srumx poo0opxnif3iydfm2rauvon()texrmr3tadfptrlies;s srumio3ny4lpt lfetlsfa2ur(rpno1opt ifetadfs2rau ont0 eenif3to1opteai s t0sexmxr3iudopte fvilt s2ur(  ou1oee mo3iltls2rlnms t4tltrircoy1omDe ivol( t2xmio nodoltnmfeiltfaDuru pno0aetnif3iatla2eluvon(4 eeomfcto1lmt aueo s0s2xrio no1ap nlnvtlt  Durx  ;u4teeomi3iys a rmu o;u0altrmf oodlm r ues (  rtrim3oy1op  mncs (fa2truro;o1texomo3ilt s el( s;t4 ltrir iy1laDe ivil(  2xm(o iy4lmt mfvtls  2tauro;u1opxn ieiydfm eanvpn() lxomf oa1om  anvs s  rtoxopoy4amt  net () Dur( oou4aeto ietlt a2el( p u) exrir3oatfa r ivs t)t2toxr iy1lmtnlnvilt)aDua(m ou4olxnioeiasla um(monu) eenxf to1opt auvo ()t2toxr3nydop n ncils a2uru  ;o0opxniocild aDrmn p;t4artnirciadlpD  uvo;( srxm(o oodlpe  nctls) Drm(r no4tltomieilt a2rau p;()teeoif totla e ieo t0 rurxo3oodlptelnvslt aDurxrpnu1aleo icilslsDelnmo;() exrxfctadlmDraneols)srumxr io1amtelicta(  2rmxronu1ale io3iysfm2ua(von(4aeeoxr iotop   uvi t t2xo(opoo4al   fcsa()sDtr(  nu0apxn ociadfm2um(mo ()teermo3tatfp eai ils0 rtoxr3oo4optn net ()aDrm( p;t0apenifeildlaDra( pn(4aleoxrcty1fpDeluvils srxrxopnu4lpt  netl()srrr(mp;u4apxoii3iyt a2emn o u) rtoif tydlp rlneolt)seum(rpio4openmnvs ()arraxrp;u0oleo ieildlm2rln p;u4 lxrmrcoy1faDe u s;s0 rurxm3no4lp   feta(fsruru ont1tpx mocildfmDulnmp;u4alxoio tadlatelu i;t  etm(rpiu4om nlics t)arum(  nt0tlxoiociysfm2ea(vsn(4 exomr oo1fmDrau o;() exrxopiy4opee neta( s2trx pno0tpxnmi3taslm rau ont0arxnmr3oatfpD  uei (  2xrxo oy4lpt mnvtlsfsDraur ou4tpt  feiyt mDuanvp u0aeerxfcty1om e ivi t t2uoim3oodll n ietltfsrtau  ;u1opx  ociat m2rlnmp;u)tlxrxocty1la rlnvo s0 2urim io1am nmivta(fsrurxmont1tlxnmo3tad mDemnmo t0texrxr3tytlptrli sl()s2urirpnu1llt lncs t s2tm(  ou1olx moctatfm2ua( pnu4 rxriocoatfp e ies;t)sruo(mpou4alt  ietlt)artm( pnt1oeto o3ilt aDumn o;(0alermr iy1omt lnei t0 etrio3nudlmen iesasfa2tmum oo0apxn ieiad s emu o ()trtnxrcio1faD lnesl(0 2xmir3oo1ll nlnvsatf Dua(rpot1olt if3tlsfaDel( on(4 reoioctatom   i s;()srxrxr3nu1lmee iviasfsrtmurpno1tle  o3iys sDrlnvs;(4texnmo3iotfpteaueo;t) rto(r io4op e ivtltfa2uax pot1optniicild s rm( s;t)altnmo3oytlpDr ivolt)seurio3ny4altelnvtlt aDrau pot1tetn oeild s2rmumonu4 rtomr to1lmt luvslt) 2xrio3ny1omen fet t)sruau  oo1apen o3iydfm2uau pn()artrxf iodfpte uvols0 rxo(mpoo1op  lieta()a2rru  no1tetn ociysfa2ra(mpnt0altrxrctodlpt aneo t) exo(r3oydomeemnctls)sDra(r oo1tpt iiciytfsDeln pnt)arenir todlp e ivi s0truoxmpnudlmeemies (faDumu ono1tpxo i3iyslmDul( o;(4tlenmo3oytfa rau ol( trurxm io4ope lnvt t srur(mp;t0altnioetysfa uanvs;u4 etomocta1lmtean s s sruoim3iy4lp e ncsas srrm(ro;o4aeeo fctytfaDul(vs t0tetrifcty1omDe ieils  2xoxr3iydameemnviasfs2umxm ou1apxniietltls2ul(mp t0 lxnxr3iotlp  aivol(0setmirpno1ame mfcil(f rtr(  ou0aetnifctyd m eanvpn(4 eerirctodlm eaivilt  2umxr3iy1aptnmiviatfartau pnt1tlt ioeiad s umump;()trxoifcoydlp r i i;()truoxo ny4om elnet t srrr(m ;u1tleomoeiltfm ul( pnt0tlenmr iatoa eluvs t0srxo(r3oy1apen nvilt) ruaum ;u4aptnioetltlm rl(mp u0tlerxociydoa rli sl(0 2uoxopiu1lpt  fcta(fa2rrx  ou0aex  oeiytfmDuau s;t) etrxociotlat li o t srxoimpiu4ameelici ( srtaum ;u4apt  f3ildla2rlums t)altnir3iytop rai s s  rxoxm iodll  lnctls sDrrum ;t0oltomfetydfa ea( p;t4alxnmr3iodfmteaivs (0setmxmpoy4am n fvt sfs2tm( onu0olxnii3iasfaDrlums u0 reoxocoa1oaD  ues;s)tetrxm3io1ll  lict t arumxrp;t1tltnioeiasfmDean o u0 ltnxf3oo1om elivils tetmim nydomt lfetlt  2trurpot4tpxn f3iysfm elu ont4 lxnir oatfa elnvi t)t2trxopio1lltn ivt s a2ta(root4opt ifciasfm rmn pn()trerxr3oydlmDe n ols) rxr(o no4lpenlfctat s2tr(r nu1oetnmf3tatfmDulnvp ()aetoxrcoytfp rluvs;(  2tmio iu4al  lfci s)sDrr(  nu0altnifetysfa rl(vs;u)tlenxo todop r ivo t)t2xrxo3io4aptnmfet tfs2tau  ot4ape iociat s2em(ms;u)alerifcty1lp  liei s)srtrir3oydlmtelfetasf 2ta(mpno4ape  ociat aDeluvo;(4 etrxf3oy1omDelivo;( seurio3oo1amen ncsl(f Drmur ou1oeenio3iatlsDulump;u0tlxrir iydlaDeai o;()t2to(r3nodaleemfetas)a2ur(roou4tetnmfciadfa rlump;t4texoir oatop rau i t0sexm(opiodll nmfvs sfsDumurpno4opto o3iaslsDumnmo;u0tlxrxfctydlmDeliei;t0seuoiopiodamtemieta( srtaxmo;u0tltnii3tlsfa rau o;t0teermf3tatoa e uvi;( trtmiopno4ap n nctlt) 2raurp;o4ole  f3ilt mDemn pnu0treoircia1latrlu o;s0 2tmxm ny1al  lictls)a2rm( poo0alxnmoctytlmDuauvs (0arxnirciatom r i sl(0srtrxm ny1lptelnctas srrrxr ;o4tlxn fetlslaDrlu ont0arenmo oatlpDr uvil(0s2tmxmpny4apte ictat) Dtrur ;u0apxoio3iasfa2rlnmo t)artomr3oytfpD li i;s) rumio iy4omen feilt sruaxr nu1alx  f3tysfsDemuvonu4trxoifciatoptean ols)texm(o3oodllte nvsl(fs2tmur nu4alen i3iatlm2eln snu0 rxrio3oadfmtr nes;t  2tmir3ou4opee ivtat) 2urx onu4opt ifetas m eauvo t)alerxfctydomD lnvsl(0texmxm nydoltemfviat aDtrxrono4alxnif3tat mDumnvo;(4tleoif todfa elieslt0 ruoxo3oydllen ivta(  rua(rpno4aexnmictytlm2ra(vsn(4aetoxfciatlpD luvols) rxrxm3iudoltemies sfaDtmum ;t1tlenioeildfm2eauvs;u0 rerxo3totfaDelieolt setr(mpnudamenlict s  2uaxmpnt4olxo octytfmDul(msn(4alxriocoa1fp  luesl(  2toiopny4omenmfviatfsDur(mpoo0texn octldlsDranmsnt)tetoxr3tatoatr ues;s  2trxr oy4oltnlfetas)aruauroot1tltomf3iatfa2ulnms (0teenmoctatfm rlueilt)tetr(r3ny4lp n netltfaDtmxmonu0apen o3tltfs2ea(ms;(4 exnmfcoydom rli sls0 2xm(m iydaltemivilt aDrau  no4apen o3iydfs uan o;(4teenirciatfmtean s;t)teto(o io1oltnlnvtas s2rr(rpou4tetnio3iltls2elnmonu) etoif3oytoaDr ues;(0 rtrxm oodlm  lnesltfsDtau poo4ale mfciltfs2umnmp;(0treoxo ta1fmtr i ilt  rtm(o oy4lpen ics () 2tr(r ou0opxomo3ias mDra(ms;t0 exoir3oo1omD  ivsls)s2toir iudlmen fesl(fsrrmurp;t4ope ii3iadlsDrm(mon(0 exrmo ootopD  n slt tetr(m3nu4lmtn nvil() ruaxm ;t1optn iciydfa2emnvp;(0 leoir3iydopt  neo t)texo(r3ou1ol emfes s  rtmxmp;o1oexo ieiadfa2elumpn(0 rxrxrcoydlm r n sl(0 exr(opoudlm emncilt) 2tau  ot1aexoioeiadfm2uaump t4aeeniocio1lpDran ol(0t2umimpny1amtn fvi (f 2uaxmpot1optnmieildlsDea( o t0 lxniocoytfmte uei t seuoxo ou4llee ncsa( s2rrx  ou1ope moctytla uan o (4 etoxfciotopD aueslt s2xr(rpou1al nmnei (farrmxmpot0tpe  ociatls2rluvpn(0aetrio oa1omDrli i s teurir iudam nliei tfaDraum ou1oex  feiysls ulu o;t) ltnmr3oadfate nei s)s2umxm3iydapt  ivi t)arrr(mpno0ape  fetys sDel(msn(0texomo tytoa   nes s0teurio3iy4omenlnvt s)aDtmur ;t4oetnmfciadfm eau o;(4trtrifciytfp r nvslt0t2urio iu1alenlfvsat a2urxmo;t4aptoii3ild sDrau pn(4arxoxrcoa1omD aues t truoxr3iudlm emfvs t artaxrono4tltnmictysls eaump;t4 etrxo3oydfp rluvs;(0trxoxm nodllt lictas)s2rmu p;u1apt iietlsfa uln s u) exomf oy1om eanvi;s)teumimpny1amtnmietl()a2raum ;u4tleomfciydfm emums;t4trtnxf tadla eli o;()t2tr(m3ou4ap nlfci ( arrmump;u0optn ietys aDum(monu0arxomf oydfa  au ol()tetmxopnu1altnlnvta(f rurx ono0aleoiietyt s2eauvs u0 lxrmr io1om r ivi t)tetoxopiy4lle lnctlsfaDurx pnt0ope  feiltfm2uanvs t0arxoio iatla r ies t0srxo(m io4apen ietatf rum(rp;u4teenmfeiasla2rmnmpnu)aeenxr oodoaDelivsls0setrim iydome livias arrr(m ou1alenifeiltlm eaumo;t0teeomo oadfmtr uvols trtoir iodlmenmictls s2uau ono1opxomo3tydlm2emnms;t4tetoiocoa1faDr iei;() rurxr oo1lltemivtatf rraurpno0tpt mictlsfs2rmnms u0 eeoir3oatfm elneo ()srxoxo nu1apenlivtl()sDraxronu0alenmociasla elnvsnu4 lenmo3ia1lat luei;() etrxo io1ape mieia()a2tmu poo0oexnmo3ilsla rmu o;(4 lenir3to1la  auvi s0s2tmimpou1ape mics (  rtmxrp;o1opx  i3iyslaDrl( p u) etoxo3oydfmtr ies;t)tetmxr3ou1olenmneta(  Drrx  nu0texnifetls sDelu s;() rxnir iydfpDr ivi s  2uriopou1al n ictl( srrr(r no0tpxomfeiltfs ul( s;t0alenmr iatopt lies s) rur(opoy4lptemictl( a2rmur ot4oleo fcils m2em(vs t4tlxrmfcoadoaDelueil() ruo(rpio1lmen fvt t) Durum ot0oeenmiciatlsDelnvo u) rtrmo oadopDr u i;( truoirpiy1amt mics s) rtruroot4tptoifcildlm emnmp u0 lxrxo3todoa rauvols0trxr(m3iy4opee fvsls)s2rr(mpnu0olenio3iytfs2um(vo;u)teeoio3ia1fpt aivol()setmimpoy1amenmnvil(  Dur(  ot4opxnmo3iatfmDrmu o;(4artniociotfatelnes;s0trxmxr3iydop nmicslt) ruax p;t0tpenmiciys s2em( o;u0 ltnxr ootlmDr neo s0t2tr(opoydlmeemfvtlt  rtaum nt0opx mi3ild m2eluvp u) etrif iodlpteaueo t s2urxm3ny1ol emfvt () rrr(rpnt1texn octasls elnvp;u)trerxr3tytoatrlivo t) 2uoim ny4oleelncs t)sDtmxr no0tpenmietysla rlu ont0texnxfciotfaD ai i;t)texmirpiu4am  mfvi sf 2umxr ;t1teeo ociat s emnmp;()artomo3ty1faDeanei s0truoxo iy1oltn fvil(fsDuaxmpno1aeenii3iasla2ulums u4 lxoircoa1fm rlies;(0 eto(o3ny1aptnlietas srtrxm ;u4olxoifciyd s2ea( o;t) lerxr iatlm raueo;() exmio3iy1aleelnvilsf Drm(m nu4optniictltlm2em(mo;(0treoxf3iadfmt aivi s)teumxrpio4aptemivslsfsrtmu poo1ope iociys a2um(vsnu)tetrif tydopte uei;(0t2xm(opoo4aleelfvt t aDtmumonu1tex  o3ilsfs ul(vp;() renmo tatlaDeaivi;t)t2to(o3iodlm   ivia(  rumumoot4tpto i3tasfsDraumon(4 rxrmo3iy1lmD lu sl()s2xmxr3no1altn nvtl() Dtmx p;u4aeeomo3iadfs2ra(vo (4trxnirciodopte neo t)t2uo(r no4aptnmnvia(f rtrxr oo4apxoifeilt mDulu pnu4artnio3iodomt  uvo;s0 exoxo nodlmee net ( s2trumono4alt  f3iytfaDelnmo t0texnifcoo1oaDrlneols)srxo(mpiodapt lieilt) rrr( o;u4opt  o3iydfm el(ms t)areoio3tatfp e ivolt  rum(m ny1al emieias  Drrx oot0apxo i3tat sDem( s;u)artomf3oydoa eaueo;t)sexoim nu4am nmivsa( a2uax pnu0apt ioeiadfm2ea(vsn() renif tydlp r u ils trtoxm nydolt liesl(  2umxrpou1ale  iciad a el(vs;() eeomf3tadfpDe i olt)setmirpoudaptn ics ()s2rrurpoo4tpt mieiatlsDrmn p (4trenioctadlmteliei t s2umimpou4lm n nvtls)s2tru  ou4aet  fciadfm ulnms ()aeermf3ta1oa   nei;() etoxr iy4ope mfvs t s2ua( o;t0alxn fetydls ranvsn(0artrirctadlpDrln s s)srxr(r iodlptemnciltf rrm(m ;u1opxnmicilslm2rm(vont4alxoioctatlmDraivslt0seuoio3oo4aptn ictls)sDuru  no1tltnio3iatla um(vs;(0aeeomf3oa1fp eaivolt t2uo(m3io4lp elivta(  2ua(mono1tpt  fciadfm2ul( o t) rerxr tytfmt  u s;( teurxrpou4ale  ieiat arurxro;o0tpxnifctyd m2ea(mp;t0 rtomrcoodfm elneilt  rurio3iu1optemfct sfsrrrx p;t4aet iieils m ua( snu0 eeomr3to1lp  li s;t) etr(mpiy4altnlfvsas aDur(mpoo0apeo ictldls2ul( pnu0altrxo oo1latean s s truoim3iodomtnmfctat a2rru  ou1tlt ii3iadla2rau p ()teermfctytfatr ivi;t0teuo(m3oodapenlfei tfsrumxr nt4tlxnmietatfa ua(mp (0aetnmfciytlaDr ivo s0 rxr(m3oy1amtnmncslt aDrr( o;t1altnmociysfmDemump;(4trxrxr oo1oatrauvsl( t2xm(r3ny4optn ivtl( s2rmxmooo4ale  o3iydlmDra(vsnt4aeenio3tatoa rau sl()texo(o ou1ol nlnvs ()aDur( ono4optn fctydfs2uan onu0trtrmf3oo1fpD luvi;s s2urxo ny1amt miei t s2ur(rpot1altomf3tatla ea( onu4teeomrcoa1lateanvs;t t2trio3nydll nlfvsasf rur(mp;o4tlt  oetltla el( p () lenmf iatopD ln s;(0 rxmxr oo4oleemieils  2tmx  nu0oee moeiat s uluvpn(0trtnxo3tytoaDeaieo;t teuo(opou1ol nmnctlt)sDua(  ou1altnmf3iysfaDuaumont4texnmfcoo1la  livol()srtmxm3iu4lme mnciasfsDur(mpnu1tpx  fetydfmDean s;()altomf ootlmt li ol()srur(m3oy1omtnlncsa(f 2tmurp;t1tptn o3iad mDum(mp t0 leoifcootlpte ivo s s2tmir ny4opt mieta() Drru p;o4opt if3tyslm2eanmp;()areomfcoydomD  n o () ruoiopoydomtelfvtasf rraxmooo4oleomfetysla rmn s t)tltoxo todfptrluvi t0 2xoxmpoudlm elnetasfarum( ont0oexo f3tydfsDum( s u)aexrxfcty1lpDrln o;s0setoirpnudap n ncs tfarrm(r ;u1tltoioeiatfs eluvo (4aetoif3oatlate nei (  rurxr3nydlptelnvi ()sDta(m ot1tlxoii3ild a umuvsnt)artnmocoo1fmDe u i t)s2uoio3oo4om elnvs tfa2uaxrpnu0altnio3iyd s umu ont0aeeoioctotfm elieo;(0texmimpno4omenmnci tf Dum(m ot1aeto i3ildlm uanmon(4 rtoxo iatfm r neilt0t2uoirpiu1aptemnctls srtmxrp;t1aex mfciadla2ra(mo ()trtrmo ootfmD li i s0teum(m3nu1ll n nctasfsrtaur oo4olto ictatfs ra(ms t0 renio3iotfmD au o (0t2tm(o iu1lmtnmfctl(fa2trx p;t4aeto oetytfa ean sn(0tlxnio io1fpteluvs s0s2xo(m3ou4opte ici tf Dtrxmpnt1tltn o3ilslsDrauvsnt0trtnmf oo1lpDeli o (0t2umxm nydap emivilsf rurum ;t0tpe  f3iysls emuvonu0altoxfctotlat  uvil(0 exrirpiydape  nct tfarua(rpnu0olxoiieiadla emuvs;u4alermr ta1lmDean i t s2xr(o iu1llenmivt tfarua(m ;o1ole  oeiatlsDuaumsnu) eermoctodfpteanvol( sexrxopnu1amtn nctas a2trxr nu1ope  octytla ea( p t0tetrmo oytomDraueilt0 eurim3oodaleemncs t  ruaxmpoo0texomi3iyd a2ranmp;t0 eerif3ia1lptr i o t0 exrxr3ny4lle mictl(  rur( o;u4alx  feiatfs2rm(mo;u)aexnxr tatlm raivol(0srtm(mpnodole micta()aDrrx  no1oee mo3iadlm el(msn(4tltrir3iytlptrau s;s0 etrxo iy1openlneiat a2urur ot1alx mfetydfa2umnmp;u4tltrxr3todlpDraivi;s0 exmxr ou1omt livt t) Dtru  oo1alenii3iltfa2rmu sn()tltoiocoatfmt  ieo t0 2xr(r3oudol elfci s aDtm(rpnt4opt mictat m uluvpn()tltnxf oatop e i s t)t2xrimpno1lpee fvi sfsrua(rp;o1oet ifctatlmDran ont) etrio3tydopDelu o s)tetm(mpnydol  lnvias)arrmxmpou1oetnmiciaslm eaumpn(4texrmo3ia1fa rluvsls  2uo(r3ny4ap e net (  Dtm(moou1aptn ietyslsDeau s;u0tltnxociydop rai i;s srxoxrpoydap n nvilt s2umurpou0tpenmf3ildfsDean s t)arenmr3oatfmtrlnvolt0s2xm(o3iodapeeliesa() Dua(r nt4aee ii3tld a el(vs;(4 eenxf3oadfm r uvils0texo(o oo4lp  lnesl()artr(r ;o0apenmfeiysla emuvsnu4teeoxo oo1om rauvols) 2urir iodom elfeta( srurx pou4tetniicilt a2ranms;(0 ltoxf3ty1opDeluvil()texm(o3iy4opt mfvi s)arrrurpou4apen f3iatfm ra(vs;u) rtnmfcoytfmD auvi t  2uoir3oydoleelicilsfs2umu  oo1oleoifciysfm2uau onu0trtoifcoy1fpDelu o s0srtmio3no4lm  lncia(fsDtr(r oo1opxniocildls2ea(vont4tleoxocoo1fp rlies;()trum(rpnu1lpeemncilt) 2uauro;u4oleomo3tys a uaumpnu) etrxr tadomtrlu olt)tetr(mpiudomen ivt s)arurx o;o1tex mieiytls2ra( p;t4tetoif to1fmtrlivs t)setr(opou4ll e fvs tfaDua(  ou1alenmoctatfs2uln on(4 reoxo3oy1lmD aieslt  2xoirpnydllenmfvt sfa2trxm ;u4openioeilt mDrmums;t0 leoxf ty1lm rln o s0srum(m nu1lltnlnes sf Duau poo0aexo fciasfmDum(vs u0trtnmr oo1omt  iei s) rxoxr iy4opt lfeils)aruaurpno1oetn ociad s2ul(vs;(4trxoir3iodlpDr ieo t trtoim nydlmt mncilt)s2umxro;o0alx  f3tydfmDelu s;(0trtrir iatlm rlivi s0truo(mpnu4ol emnet s aDraum ;o4tlt mfciytfa2ranmsnt4altrxrciytom r ieo t)trtm(o3iy4optnlncil( srurx  nt0oetniieiltlsDrmnvo;t4altrif3ootlp  luvs t)tetrio nydlle mnctls srrmurpou4oleniociydfm2uln s u0trtoiocoatlaD ln sl()t2ur(rpiydlmt lnetas aDrrur nu0aet iietysfm2ul(vp u4 lenmf oydfptean il(0 exo(r ny4olt lncils)s2uaum nu4apxomiciytfmDem( s u)trtnmr3iydlmtrlivs s tetmirpnu4am  livi t  2ta(  ou1tlx ifeiyd m emnvpnt0artnifciytfp eaneslt0s2toio3iu4optemnesat) Drmumo;t0optoii3tad mDel(mont4artomfciodfp   i o;s texm(o3io1lleelieil()aDur(mont4opeomfciad mDumu o u)trtoxr ta1fmDeanes (0teurxm3oo1optelfvt t) 2rrx  ot0texn oetatfa2rm( o (0texnxrciodfmD luvi;()trtmimpoy4amt lnetls)sDtrumpnu4altn oetas m2ea(von(4 rxoif3oytopDeaivi t trtmimpoodom elicsas aDrr(m nt0olt moctadfs elnmsn() rtomocoatlatrlieol( srurir oydlmen ict s)s2tm(mo;o1tpe  ociatlm2uauvp;u4 exnif3totfmDraivslt s2xmim3iy1al nlnvta()aDuaump;o4teen f3iydfaDrau s;u4aleomf tadfmDrlnvs;s)trtoxrpoo1ol  mnci t)srumu p;o4tlx  ociltfmDemn pn()arerio oatlptrai s;t0tetrxm oy4lpeelnctl( srtrumo;t1aetnmfcilsfm2elnvonu) rtnxo oadoatr nvo;t  2trio3oudop elfvilt) 2rm(mp;t1alt  o3iydlm rmnmo (4 rxnircto1fp raieilt0srtoir no4lmte ietls)srua(mpno0tlxo f3ildfmDemnvonu)aetnmocta1lat  u ol()sexr(m3iy4ameemicsltf Dtrurpou4oltnmfetltfaDulnvo t) eenxf tytop rln o t)srxr(m iu4om nlneil()a2uaxrp;o4aeeoiieildfs eanvp t4 rxrxf iatfmtr u o s  rtoxm iu1llt lici t srrmu o;o4oeenmfctys a rlu p;t0 eeoifciadomD luvo;s t2xmim3oy1lm n fetlsfsDrmum no0open ociytfs2eluvs ()aexrmocty1opDelivsl(0t2uoirpiydalee fci sfaDrau  ot0opxo fciad m rmn sn()alxniociydom  livo s t2trirpou1amtemnci (f 2rrum ;o4aet  fciltls2el( s t) rtnxr3ta1fmDeanei;s)s2xoimpiudale mfeias)s2rrur ot1ale io3iadfmDeanmp;(0teerif3oytlp   n ols tetmim3iu1llee fes (  Dum(m ou1olxo fciyt a rmnvp (4alxnxoctodlpteluvslt0trxm(rpnu4omeemivil( arrm(rp;u1apxn f3ilt a2em(mo () rxnirciytlmDrluei;t)trxrim3iodlltnmnetls)aruax o;u0tptoii3ildls2uau o;(0arxomo ty1lmteau s s  rurxr nydameemneilsfs2taxrp;u0tpe mi3iytls2rm( pn(4alxnmo3ia1oa ran i s truoim3oy4lleemicta( artaumoot0tpe  octls s rm(vpnu4alxrircoytfmt  ieo s seurir3oydlm e nctl( arrr(r ;t4oeenii3iatfa umuvsnu0artnmoctotfpteanvs s0texoxr no1ape  icil(fsDtmumoot1oet  fctyd m ul(vs;(4 rerifcto1la eau ol()trtrir3io4lmt  ivt sf rumxrpnu0aex  fciyd aDrlumo t)aleomfcta1op eli s;s  rxoxrpiu1amen fctlsfa2umu pno4apenio3iyd m uluvp t4aeermo oodop  lu i;t0 2to(opny1apenlict (f rtrxmo;t0olt  fetydlsDrauvsnt)altrio iytfptrlu sl()t2urxopoo1omenmneils s2rau poo1oeenmietasla rm( pn(0 rtoircio1omtrau i;t  rum(rpno4lmtnlicils)a2uru p;o0tetoiociydlm2rlnvpnu)artrmf3iytfmDr nes s0trxriopny1lptnmicil()arrmum ;u4texnifeilsfaDel(mont0tleomf iatfptelivi;t0 exmxo3nodamenmivia( srraumont1oee  ieiydls2elnvo (0artomr3ty1fmtr ivs (0t2trxopiu1alee ictat  ruru o;u0oeen ieilsfs2raumo;t)tlxnxo3oydla   nvs t  ruoiopiy1ome mnvtl()artr(r oo4tlxn feiltlmDrm( snu0trtnif iytlpDe u o (0 rxrirpio1lm n neslt  rtau o;u0olx  oeiys s emnmon()aeermf io1fpD lnvi t)srtr(mpnydlpeeliesas)s2tmum nt4tpeomictyd m2rm(vo (4tltnir iodopDr u o;s  2uo(m3iudol emietas)artr(  no0aet  i3tltfs2umn o;t0tlerirciydfmteaivol()s2xmxo ou4aleemici s sDtmurpot0tet  fciltfs rlnmpnu)arerioctatopDeaueo s sexoxr ny1olt  fvtatfsrrr( onu1tpe  i3tld aDum( sn(0trxrif3iytop rlieil(0trtr(r iy4alt lfet t)sDur(ro;o1ole mo3ild s emump;u4trtnmr ootopt aneo ( srxmxr oo1lptnlneias aruaxrp;u0oexoiieiydfa ulums u4texrifcoadlp rli ols)tetrir oo4altemfviat)a2ta(rpnu4tlxo i3iysfm emn s;u)trtrmr ia1fpDelivs ()trtmxo oo4lmtnlfeiasfaruaxro;o1aet mociltlmDrau pnt0 exoxfcia1lm e i il()t2tmim3ou1ale mfvil(f 2ur( p;u4olx ioeildfm rmu p;t4trtoxf3io1fptr ivil(0trur(r iydll   ncia()arrr(rono0oltn fciysla2ulnmp u0trenmo oydoat lu s t  rxrio nudlmenlivt t)artmumono4tetniictatlmDumumpn() ltnirctytlpte ueo s s2xrirpiu1ape  neiat) Dtaxmp;o4opx mfeiyt a2rluvsn(4aeenmrcoy1fp r ieo;t)seurirpiy4olt mfvslsfartaxrooo0oeeo fetatfm2eauvp u0arxrio3iydfm rlnes;() 2toir io1am n nci ()srtr(mp;t0apenmi3iltlm2ran s;u0trtnxr3oo1lmt  iei;s0 etoxopiu1lpenmfesatfarrau pnu1aeto ociaslsDrlumpnu0trxomfcoy1omD ln sl(0 2uoxm ou4aptelfciltfsrtm(mo;o0olt io3tatla2um(vs ()trxomfcta1faDeln sl(  rxrxo3nu4omt  iesas srtaxmpou0oet  i3tyd s elnmpn()tltomf3iodlp  ln o s)trumir3ny4lmt lics t)srtr(rp;t0tpxn oeias sDrlnvo (0 eerircoy1fatelivi;(0 exmir iy4olt liesa(f 2uru onu1texnmfctydlaDran p u4texnxocoy1fmDrauvilt)trtmim3oy1openlivias  rtrxro;u4olenmfetasfaDulu snu4texoxfctadlm  aivi;t) rtmim nodap nmfciat s2ua( p;u1aexnio3iytfs emumo (0texnxf oadlmDelieo;s s2xmio iydap n ivsl() Dtmu p;t4alxo i3ildfmDulu snu4alenxo3oa1lpDeauvi;s t2toxm oudom elnvs s) 2tax poo0ole mo3iys sDumump u4 ltrmo3iydla eau s;t) 2xr(m3ou1ol emnvtas aDtaum oo0olen fctys s2uln pnu)texoio3iadfmDrau olt  2tmir3iy1aptnmicsasfartax pot0alxoiieiysla rlumo;t0arxnxrctydopt auvslt)s2xrimpoudlle  fesat)s2umxmo;t0optomieiaslmDrl(vsn(4 rxrxf to1fpt  uvo;s srxmim iy4lmte ieiat a2urxrpno1oexnioeilt s ul( o u)aexrmr totomD lueo (0 2umxm3oodom  lnvtatfarumx  nt4olenmo3tlsfs2rmnvs;(0 lerir3oydoa eaueolt  euo(m nodom eliet s) 2trxrpnu0olto ictld m2rmump;t4arermo3totopt ai i;(  2xr(m3iu4lpt  iciat aDraxmpnu1aexo i3ilt aDrm( o;u4 eerxrcty1lpteluei s texm(r3iu1optnmivt (  Dtrum ;t4oexo i3iatfmDuanmonu0arerio3ootfmDraues;() 2xrim iy4lmen fes (farum( o;o1alt  i3tyd m ra(ms u)artnio iodoatrln o;s0 2umxr iydal e ict tfaDtmxrpnt4alxomfciatlm2el(ms (4areriocto1omDrlivi t) 2xo(o oudam  mfct (fsrtaumpot1olx ifciysfm ulu s (4 leoxr iydfmt  i s;s0t2trim3oy4oleelfetat srtaxrooo4tlenmoeiys a eauvpnu4alxomfciodfa  au s (0teumio3iy1apenmiet t)aDtmurpnu4aex mi3ilsls elums;t4arenir oa1fpD ai i (  rtmio3nu1opeelictas)a2rrxr oo0texomo3iatla2ra(mp t4teerxfctydfp eanvol(0srxoio ny4op  mneiat sDtrum ot4tptnmfeiydfsDumums;t)aetrmf oodopte n i t0 2tm(mpou1apt mfetls srtm(m no4apxoiictltfaDeauvp;(4areoxr3totlm eaiesl() rxrir3nu1apenmncsat aDta( p;u1tpeoioetasfs ranvpnu) leomf oy1oa  auvsls0s2umxopny1opt  fcsltfaDur(rp;t0tleo feiatla2eluvp t)tltnmf3io1omDraneo;t tetmxo3ou1lptnlnvi t)aDuaxr ;o0teen i3ild m uaums (4 ltnircoatop e u sls s2tr(mpoydaltelnvta( a2umxmp;u0alxomi3ilsfa rl(mp u)alxoxf iatfmDranvo t0 eum(o3iu1ap emfvtas srtmur no0tetn ociaslsDeauvp u0trenmf3oodom r ivilt)trtmim3no1lmt  icias  Dtm( pot4oetn octatlmDua( pn()alxomf3oytlmteanei ()texr(rpiodape  ivils  Dtau o;t1tpto fciadlmDrmnmp;()alxrxo ootlpteaueols)trtr(rpiy1apee ieiat)a2ur(rpnt4tltoio3iat a2eaums t0treoxrcoo1omtr ueol(0t2tmxo3iu1lleemivtlt arumu  oo1aleoiiciysfm2emn pnt)alxoxfctytfat au i;t) rtrxo nu1oleelivtlt  rtm( pnu4tleo ieiydlmDran o t)aexoxo3iatlmt au o ( trxrxopiu4amt  fvt t)srururoot1oee  fctadfa ean sn(0arenxocoatlmDe ies s)sruoxr3oo1ap nmivtls artaurpnt4oetnif3iyslaDranvp ()trxnif3iatomD aivi ()t2uoirpnydllee ivi tfs2uaxrpot4aetn oetydlsDrl(vo;(0 renmrciodlmteln o (  2tm(o io1optnlictltfarurx onu0ope iieiltls2um(monu0 eerio iodoaDranes s0 etoiopoo1altelici t  Dumx poo1texomi3iytla ra( o (4aexrmf3oodoat ai o () etmir3oydomenmneia()a2rmuro;o4alenmiciasls2em(mpnt0tlxoircoodfp raivols0t2xrxm3oy1optelnvtasf rtm(rpnt1apeniiciytlaDrlu sn() exoxfcty1fptr u s;(0 etoxmpiudapt  ics tf 2tm(rpnu1apeomo3ils mDrauvsn()artoirciy1lpD livsls seur(o3iy4omt mneiltf 2taumo;o4apxomf3tasls elnvs ()tlerxf iadlptr n s;t0 2trio nudop nlnvtl(fs2uaxronu4aetn f3iytlaDuanmonu4 lermociatoa e nvi;t0teurir3iu4omeelietlsf Dum(rpoo0alxo ieiadls elnvp (4aeerxo3tytfptean o;( s2tr(rpiu4ole lfcs ( aDuaurpnt1olenmfeiyslm rln pnt)tlerif tatfaD aivils)t2toxrpnodapeelfvi tfaDtrxmont4olt mf3iytfa2el( p t0tetrxfciadom r uvo s srxrio oo1om nlnet ( sDrmxroou4alx mocilslm2rl( p;(0 eeoxfcoytla  au s s texoimpio1lm nmnvt t  Drm(m no0tpeo fctydlm rmn p t0teenir to1lmDeau s;t)trtrirpoy4ope  nvi s)artm(  oo1aeen oetldfs ua(mo;t0aexnxo3tadom elivo;() rxoir ou4ap e ncsls) 2rr(r oo0alen octyd aDuln o u)aeeoirctytopteau sls)t2umxo iy1ol n ieslt)aDrmurono0tlt ioeildlm eau onu0treniocoatlmD li o (0tetr(opoo1lp nmfctlsf rta(mpou0aee  oeiyd s2rl( ont0 reoio iy1optr nei;s  2urxm3no4optemieiat  2umx  ;t0tetn o3iysfs2rmump;t0artnif iadfaDr u o ()truo(rpnu4om n fvtas srtmxm ou0tpt mo3ilsfmDeau pnu4aeenio3iodla eauesls trtmxrpoudoptnmncils)srrau ont1olxoio3iltlaDuan p;t)teerxfciadfa   ivo;s  2toio oodole  iet ()sDuax o;u4tlxn f3iyt a2eluvsnt0tleoio3tadfm   u i;s)s2xr(m3io4lptemfvtlt aDrmx pno0altoiictydfs ean snu) exoxr3oodoa eliei (0tetrxr io1op  mfet (fa2rrxm ;u4ale mfcildlm2um(vpnu4aexrmr3tadfa   i sl()teur(r io4opeelfctl()arum( ono4tex mociytlm eaump ()aetnxrcoo1lpD aivs;(  2trir iu4op elfei ( artmxr ;o0oeeoio3tad sDel( p u) leoxrciytfmtean slt)srxo(m nu4lmte nvsasfartaxrpnt1oexnmf3iysfs raumo;(4tlerxr3iy1laD  ivil() 2ur(opoo4op e neilt) 2tau  ;u1aet ifcias m rmuvsnt)trxrxf3oadopt lueslt0trtrxrpnydamtelivsat srurx ono0apt mieiltlaDrlnms t4aeerxr3oa1fm elivo s0 exoimpiy4alt lneiasf 2rr(mpot1teeoif3ildfa ea(vp t0tltnir3tadlaDelnei;s)t2um(r ny4ap   nesatf 2umx  no1alxnif3taslmDuan s u0 rerif oa1laD luvo s0t2xmio oudolt lfcsa(fs2rmumo;u1alx  ieiytlaDranvs t) ltoxo3oo1latrlneo () rxo(r nu4alte icsasf rtaur ot1opx moctyslm emumsnt)trenif3ty1fpD au sl( setmir ou4apt lfvia(fsrtmx ont1opx ifciysfm2ua( s u4arxomo todlptrln s;s0trur(m3no1om  mnvt sf rtau o;t0oltnio3ildls ra( snt4 ltoxfcto1fpDe i i;s)tetoxo oy1om  mncta()sDrrxm ;u4olt  ociysla2rmumpnt4aexnxrciydlmDeaivo;s)s2toimpou4lle mfvsltfarrm(m nt4tee moctydls uan o ()trxoir3tadfa elneils)t2uoxrpnudop  lfei t  2rm( o;u1opto f3ilsls rlnmpn(0teeoxr oatoa r ueo t) 2ur(r iy1olt mfvil( aDtaxr ;o1tle mf3iasfsDem(vonu0 renxo3oodlmt aivo;s s2um(o io4lpe  ieta( arrau o;t1aptn feilt a rluvo (4 lxnir ta1opDrluvo;s  exo(r iy1lpeemfes t  Dur(m ou1apeomfetldfs eau p;t0 lerxo3oodopteln slt)sexm(o io1lle  fctls a2urur ;o4tex miciytla ua(vs (0 exrmf oo1lpt ai ol(  exm(opnu4am nlfvi tfs2tmuroou4apxnio3iaslm rl( o u4texrmrcia1lpDranvi s0 2to(o oudlpe mieiat) rtr( p;o1alenmfciad aDumnms u4 eerif iy1faDe i il(0srto(mpou1ap  lfcsa()arua(mpno0oee mietld m ra(mpnu)tlxrmfcoadlp   n i () 2umir iodalenmiei sfs2uau  ot4tetniictls aDrm( s;u0artnmociy1faDeanvo;(0 exmimpny1apt miviatfsrtr(rp;t0oex ifetadfmDemuvonu4aleomocoatoa e nvi;s)trur(rpiy1ap  lfeslt s2taxm no4ale io3iadlsDrm(mont4tetomf3oa1fpDe uei;s0 2xr(o oy4ole  nvsasf 2rm(roou0apx  feiytla elnvo;u0tlerir3totfp raiei;t srum(mpiu1lpenmnvta(fsDtax pnu1alxn oeiydfsDelnvs;u) exrmfcoytlatrln i t0srtr(r oo4lltelfvi sfsDtr(rp;u4tpeoio3tadlm2eln p u4tetoxo3oo1opD  ies;s srur(o3nudlmeemivia(fs2rru pou0tptnioetyt a2elnmo;u4tltrifcty1om  lnes;( trxoio3io4ole mici s)sDraurp;t0olt ioeild mDumuvo;u0alxnir ta1lpD  nvi s srtoir oy1apeemnesls s2ta( o;u0opxnmo3ilslmDran p (4trerxo3oodfa e n o (0 euoio3nydale livs sfaDur(m no1oltoioctls m2rmnmo;t0 etnmfcta1lm r ues s)t2xo(o nudolte fci t) 2ta(r ;u0opx  ietydfa eau sn() ltoxrcoydoatraieo s0 etoxrpoo1ap n nes sfa2rmxmpou1oexn fetysfaDrm(ms;u0arxrmo ty1laD  n olt)srto(o oy4ole miet (  2tax o;u1opt io3iasfs el(monu) rermrcto1om  lueols0seur(rpiudoptnlicia( srrau pnu1oeenifeiys s rau s;(0 rxnmfcoytlptr ieo;()s2tmim3nudlp  lnetasf 2tru o;o1tle mf3ilt mDrmump (4 rtrmf tydomt lu s s  rtoimpio4lp nmfvsl( sDrmx ooo0tex  o3iyt a2uanvpn() lerxo ty1omteauei s)teum(m3ny1ole lfvia(faDumxrono4alt moctatls rmuvo u)alxrxo todfmteauvol(0 rtr(o3no4lptnmncsas)aDuaxm ;t0aetnmfeilsls2eluvo;u4artomo tydomt  i o t0 2toxm3nu1am emneiltfsDuaum nu4oltnmo3iys mDem(vs;t4arerxrcia1lpte i o;s setmxrpoy1apt  ict tfsDumxmooo4tltoif3tyt sDel( pnu4tltrxo3iatlmt  ivo;(0 rxr(m3nodlpen fcil( artrum no0tptn f3iytlm2raumpnt0trxoio iotla  li s ()t2tmxr3iu4ap emictlt)sDum(mp;o1oeenmfeiat a el(mo t)arenxr3iytfaDe ivi s seum(m3oy1apen nesatfsDtm( p;u1opeomo3iat aDem( snt4trxnioctydomDe u o;s)t2tmxo3nu4lltnlfvtat) Duaxro;o1oetomiciad a elu s;t0arxrmr tatlateanei () rxo(r3ny1omt mnei ( s2rr( poo1apt  f3iys sDrlu onu)aexrmf3tydfat ai olt0t2trxmpiydam e fvt () 2rru  ot4oexn oetldfsDemn p;(4tlenxf3tatfmD  nvo (0 2trirpiydam  liviltfaDtrurpou0oexnmieiytlm2rm(msnu0 lxrif tatfpD  uvo;t0setm(o no1ale  nviasfsrrr(  no4tpt  oeildlsDum(vo;u0arerio3iodopDr ieo;()t2xrxopny4omtemnvsatf Dua(m no4ape ioetad aDul(mpnt0teenir oydom   i i t0trtrim oydlptnmivtasf Dumxrpot1tlenifctyd m2uln on(0 ltrmrcoy1omteauvslt  2tmim3no1lp nmicsltfs2rru pnt1tpt ii3tad s rmnvon()trxnir ta1lpDranvols0tetm(o nodapt mfet s aDtau onu0apt mfeiysfmDul(mo (0artnmr3ty1omtrlu s t) rxo(o3iy1olenlfvsa(f 2tax  no4oee mieilt m2emnmo;u4arenxrcoytfpDr uvilt) rtoirpno4apt  fct t sDum(rono0olen o3ildlm ranvp ()aexnxf ootfmD lues;t0 eum(m3iodopen ietl(fs2tm(r ;o4opx  feiys a umnvp (0trenifcta1fptrli s;t0 2xoim3ny4omenmieilsfs2rm( oot4opxoiietldlmDumu s ()trerirctotfaD ln s;t trtrxr3nydalenlfei ( s2rmu ont1olxn o3iltls2ulnmo u)alenmr tadfmtelnvo;s) rum(o iudalen feil()sDtr(r ot4oexo oeiytfs2ulump;(0tetoio3tatlm rlnesl(  etmxm oo1ale livs (fs2rmxmo;t1alx  o3iydfm rau sn() etrmocia1oaDelueo;() 2xrxr3nu4amt  nctas) 2trx ont4teenio3ias mDuluvo;u0arxomo oy1fat anvo t trtoxr3iu4aptemnei tfsrtmx  nt1tlxoio3tadfa um(vp;t) rxnxocoa1lpt lnes s0 2to(o3nydalt lfet (f 2tmu pnu0olt mfeiadla2rmnvpnu0 etrmo3iadomDeauvsls s2umxr3nydome mfesl(fs2ua(m ;u4opxomfetldfa uauvs u4teeoio3oa1op rli il(0srto(m3ou1oltnmictls  2rruroou1olxnif3tlsfm ran p t) lxrmo3tydoaDr nei (0s2uo(r oo4aleelnvslt) rtaxmpou1oet  i3ildlm ea(mont) etnio3oodoptelivil(0setmio nodaltelnei () 2tmumpoo4tpxo ietldlsDemn s (0arxrmo3io1op e u sls)seum(rpio4olt lfvsl()aDur(ro;u4optnifctldlm2uau o;t)teeoxf3ty1fmteanvi t)srtoio3nu1om  mnesltfsrtrxront1aetnmi3tls m2ulnmp t0 lxnmf3ia1la r uvils)sexr(opiudomtn ivtas s2rax  ;o1apeoioeiys a em(mon(4 eenmo to1fmDrlues s setmxrpny4optn ictl(  2rmx  oo0oltomoeiltfaDeluvo u0tetnxo tydfpDr nvo;s texmimpnu4ll emnet s arumxmo;t4oexnioeiydfs ua(ms;u0treoxf3totoptr ivo;s0t2xoir iu4ape  ivt s)s2ua(monu4tetniociatla umnvs t)arxoirciadlatr nvsl(0setm(r3iu1ope  ncsl(f 2taum ou1apt  f3iatfa ulnms t0alenircia1lmt  nes s0 etmxmpny4lpenmfes t  Drr(  ou1altoio3iat mDeanmo t4 eeoio oatomt lu s t0trxr(m oy4ape lfvi s) rrruronu1tlt mo3iatla2rmuvs;u) rxnio totfm eaiei () 2xm(m3io1lmeemncslt aDtmxr ;u1optomo3iadfsDuauvp u)arenxr iydomDrlnvi t)trtoim3io4apee fvi s sDuaxmpou4tetnmo3iat a2ea( snu)aetrxo3to1lpDranvo s0t2trxm ny1apee iesa()srrau ooo1tleniociasfa eauvp t4trerir3iadfa  lues ()s2xmxrpiodlp nmfvt (faDum(  nt0tpe moctad s rlumon(4 lxoirciydfaD lieo;s) 2tmim ou1lle lneias a2ua(r nu1texnmoetadlm ul(vp;(4 ltrxociotomDeaieo;s  rxo(o iu4lptn ivt t)aruaxmpot4teeniociytla2rmu s t0 eenmo3ty1oaD lnvs t srtriopnudal  mnet sf Duaumpno4tlt mfctyt a eanmsnt4teerxf3tadfatranei;()s2uoirpnu1om e ietat sDuaumo;t4opxn ietldla2umn o (0 lenio iytlaD  u s;t s2tmim3iu4alenmiviat)aDumxmp;o1altnmf3tad a emuvonu4trxnxo3iydoatrluvi s  rtr(m3iodlptnmict ( s2rmxr no0oee  f3iys aDulnmp;u0 lxnxocto1fp elivs;t0t2xr(o3no1ap  mfci ()aDra(rpnu0opeoiictltls2em( snt4 rtniocoadoaDeli o;( texrim3iu4omt mfcta(fs2tru  nt4tex mf3tydlmDulnmp;t4aeerir tadlp eli i;t) 2xmio3oo4lptnmivsa( s2tauro;o0aleomocild m2eanmont)texrmr3tadopDr u i;s) rxrxrpoy1ame  ivi tfsrum(monu1tee  oeilsfa em(monu4alermr3oy1lmD  neils seumxo nu1olt lfes sfaDrrum nt4tetomfciatlmDra( snt) lermocta1la rlies;()seumxo io4lltemfvsat) Duaxr ;t1aexoifetydlm rln p u4arermo tydop  lnesls  rum(r iudlmt lfesatfsrrr(mo;u1apen ictltfs2ul(mo;u4tlerxfcoo1fpt aueo;(0t2toxr3no4amtelfet (fsrta( p;t1opx ifctldls rmn o;u) ltrxrcoatomtranvslt) 2xr(r nydlmee fviasfa2rrx o;u4ale ii3iyslsDulnvp u4 ltrmr3oo1op eli o;t0srtrxo3oo1am e fcsltfarrrumono1olto fciasfs2ra(ms;t) rtriocoydlaD  u o;(  2uoir oy1op e nctasfarur( p;t1oex mi3tydfsDelnmonu4tlxoxr oadfm eaueo;(0s2um(o3io4apenmfciat) 2uaurp;t0oeto i3tlsfmDrlu o t) rxrxrcoodoatelu sl( seuoio3iudope micsa(fs2rmuroot1apxn ieiyslmDrmnmp (0trxnmr3io1lmtrlies s) exo(m3io1olen neilsf 2ua( o;o1tpeomf3tysfa rln s (0 etrmf iodfaD  i o;t sexmio3nu1ope lfvt sfsDraxro;t4aleoifciyt a2el(vo (0aexomf tatlmD auei;s) eto(m no4ole  fcsatfsDtaurpnu4apx  ieiytfaDemn o;t0trxoifcoy1opD li o;t trxo(opou1lleemnvsat) 2umu p;t1tpx mociytfm ul( ont4trenxo oa1om r u s s) etmxopou4opt lfvt sf 2rax  ot1opeo f3iydlsDulnvsnu) lxnmocoo1fmt luvolt0 etrxopoy1oltemnei (fsrrau oot0alxo feildlm uauvsnt)texnmr3iytoaD ai o;s)trumim ny4opeemfvta(f rrm(ro;t4tpenmociyd sDemumo t)arxnmfcoy1fa r i i s)s2xmirpoy4lmtn ictas)a2tr(m ;o1oexnmoeiytlaDelu s (4texomf3iotoptrlnvi ( trxrxo oy4ap   feia() 2rm(ro;t1tlenmfeiad s2ean snt) reoxociotomtr uvo t)sexr(opiu4omtn fcs tfs2raum ;t4olt mo3ias m2eanmo;(0 reoxrciydfaD au ols)trumio3iydlm nlfes tf 2rax pno0tpt mi3ilsfaDemumo () eeomo3oo1lptr neo;(0s2um(rpoodom nmfvs (f Dtrxro;u4tpeo oetyslmDean s;t4arxnif ta1lmtrlu sl(0srxrxm3nu4al elivia() rtmxmpot1tlxomi3tys a ran pnu4treoxoctotlmDe nvi;s  rxm(o nudll e nes sfarumu oou4oee ifciyt m2raums;u4aetnxrcoodop r n o;s  exm(mpoodomt lfvta(fsDtmx oot0olto ociadfaDumnmo;(0 ltrxf3iy1lmDe ieo;( s2to(o3nodoltnmics t  2urumono0oeeoiiciltfmDua(vsnt0 rxrxr oodlaDr ivols)sruo(o nodal emfvs t) 2urx o;u1tetnioeildls rmnvsnu4arxomf3tatlpDe ivi (0sexoimpio4lmen nctl(  2uaxro;t4teto o3ils s2rmums t) lxnxr3iytfaDeai s t srtm(r nydapt lnetl(fa2ra(root1apxnmoctasfa ran s t0 etoxr oa1la  lueo;s0srto(r3no4omtnmiesls a2ua(r oo1tptomfetatfa2umuvpnu) lxoiocio1opDeln s ()texoirpoydlme lnesls) rrau  ou0alx mfeildfs2ulnmp;t)tltrmr3ootop  liei;s0sexo(opnu1ol elfcs tfs2ra( p;o1ale ifctytls rlnvo t0 exnircoadfpD ln o;()setrxopou1apt mivt ()aDtr(r nu0oex  oeiadfm2rm(mo (0trtoxrciodoatelivslt)t2umimpnudll nmiviat) 2raur oo1aptn ocias aDuanmon(0tleoif3todfatrauvi s  2urxm io1ol  mfcilsfa2rrum no1tpe mf3ils a2umnmo u)arxrioctatfa e nvi;s0s2uriopou4openlfciatfsrtax  no1aleomfeiadlsDum(msnu4 lenmr to1fmt li s;s0trtoxo3nydaptn fet ( aruru pnu4tlt mi3iyt m2uan o;u0tlerir iadlmDe ieo;(  2toiopiu1ome  icsls  rrr( pnt4teeoif3iltfs rm(vp;t4aetrxo3ia1fmtr i ol( texrio3oo1ap nlnvta()srrmx p;o0teenmictatfm uan s (4trtnio iy1fpDe uvs;() etr(o3nudol nmivtl( arrr(ro;o1tleoifcils a um(ms ()aetrmo3oodlateaneilt t2xm(rpny1apenmfvtlt srurxro;t1tpt  oetytlmDua(mp ()aetrxociadfa e nvil()trxmxo oodll nmnvsl()aDrmurpou4aet mictldls2eanmp;()tlenio3iydlat lu s;() rur(r3iodlptemfct ( srtax  ;u1aptoii3iad m elums;u4 eeoxrctodop raneo s texo(rpiy1ole mieia() Dtr(mo;u1aetoio3iat m2rmu p;(0artoir tydlaDean s s0teuo(r3oo4ol  mics ()srtaxm nu4tet  ictat mDua(vo;(0aetomf iytfpDe nvo;s)sexrio nydlmen nviltf Drrxmp;t4tpxnifctldfs2eau s u4tlxnxrctatfpteaues;s0s2xmxopnydlleemneils)sDrmxrono4aptnmoeiasfaDra( o (4aeermf oadla r nes;()srum(opoodamtnlfes (f rururono0apx mfciasfmDea( p;t0tlenxo oo1laD lnvi;t)sexmxr3oy1llt liesa()s2urxroou1tpt io3iydla2uauvsn()aetrif tatoa  livilt0trtoxo iy4lmeemici () Duaumpot1opeomo3ilt mDel(vs;(4 etoirciytlateauvils  etoiopnu1lm nmnes (f Dtm(rp;o1aexn ociyd aDua(vsn() lermo iodfmDrlu s;s)sexoxmpoo1llenmfes s  rrmu pou1apt if3tld s2ranvonu0tltoxfcoy1lmte nes;t0sruoimpiodaptn nci (  Dtaxr ot0alxnmf3tatfm elnms u4 etoir tatla rauei;s s2xm(r3oydamtn iesas)s2tau p;u1tpx  o3ias a2ea(vpnt)arxoio3iodlm rlieolt)s2xm(r iudap n feta( artaxr ;u4oeeoifeiad aDrauvsnu4aexnifciadlpDrlivols  etmxo3oo1ope  neil()a2tru  nt0tptomieiytfs2ea(msnu4areoir oydlm rlnvo;s0s2xm(o oudlpenmicils)aDua(monu1open ieild m2uln p t)teeoircoodfmt anei s0truoir3ou1al nlfct sf Drm(rpou1oleomi3ilsfs emn ont0teerir3oo1om eluvs;(0s2xoimpnydlpt mnct () Drau pot1aeto i3iatla2ul(ms t0altrif tydlp rau i;s0t2uoxrpno1lpenmnvtl(  Dumx o;u4tlt mfeiaslsDeanvonu)aetoxf oo1lmD lieo t)seurxr ny1lp elfei tf Dumxmpoo4olxn ictasfm2uanvo (0aetoxf3tytfaDe u i;( t2uoirpiu1lmtnlfetltf Dum(r nu4tpxnmf3tys mDem( p ()trerifcoa1fat aivs t seur(mpio1ll n fesas  Dra(mpou0teen o3iytlsDumu o;(0texoif ia1fp r uvo s0 eto(r3iy1aptn icsl(f rur(r ot0opxnmfciyt m uanmsn(4artrirctodop   neo t setrxo nodopee nctl()aDta(mpot1tpeo icilsfmDeluvsn(0tltomr3tatlm  ai sls0t2xr(m ou1omt liesl(f 2rr(r ou4oltn iciydlsDra(vo;u)tlxrxrcoy1oatraues s0sexmim3nu1lpt mfcsl( a2tmum ;t0opxomi3tys s2umnvp;u4 leniocoytfaDran o;t)t2tmimpiu4al n ieiat) rumumpou4olxnmociys mDumuvo;t4trerxo3io1fatelueo;s)truo(r3oo4ll e icsatfsDrmxrp;t1oet micilsfs rmnmp (0aexrxo oytoatrlieil(0seto(m iu4lpt mivtas s2rmxmpnt1tpxoio3iadls umn onu0 etnir3tytom e nvi;t0trtm(o3oo1ap nmfvils srtrx pou1tltoifeiatfa umuvp t)altrxo3tydom rlnvo;t)teuo(opiodal  liesltfa2urx oou1ale mietlsla em(mo;t0tlxomf iadop r u s t trtmiopoy4ol nlncilt)a2urum ot4oeen ocildfa ra( pnt0tleomfctotop rluvils)t2xrio3no1ll elicta()sDtru o;t0teto i3ildfa2ulump t4artnxrcoydfmDr ueo ( s2to(m ou1om n feil(f 2tmx pot0aptnii3iytla2el( on()artrxociytom   ivols) 2uoir3ou4om  lnei sfa2trur ot0apxnmf3tytfmDul( o (4trxnxf3oo1lpt  u i;t0sexoxopiy1ol emfvi t  Drmumo;o4aee  feiasfm2rmn p;u0artoio ta1lpDe n s t)trxrio3nu4lmee ncsls s2umxmp;t4aex mfciltfs2emnmp;t)alenxo iatlmt ai o ( setmir nu4ol elfcsl(  2taxm oo1ape ifeiyd aDulu pnu4aetrif3oa1om r i s;t)trur(m3io1ll n nvsa(  2uru  ;u1tpxoii3tldlaDemnmpnu)arxnmf iodlp raieils) 2tmxr3oodapenmivs t aDrax pou1apxn f3iytfs2rl( p () rxrmocoydoa e nvs (0srtoirpiu1lle mfvtas srta(mp;t4tet iiciyd s2um(vsnu4 lermrcoatlp raivil(0s2trxo oy4altelfcslt arum( pno1alxn fetatlsDem( p (0texnmr3iydlp  lnvi s)srtoirpoy4op nmfeta()a2um(rpou4alt mo3ildfmDrmnmpn()tltrir3oa1fat  u s;s0setrxopoo1lp  miei tf 2rm( p;t1oexomfctatlmDemu p ()tlxnxfcoatfpDeauvslt0trxrxr3nu4ol e fvt t) 2rmx pno1tex  ietydfs uauvo;u4texnif3iodoat  ivol(0trurxm iudop  mneils) Duaur ou0ope mfciat aDrlnvs;u4 rxnmf iy1lp e ivs s)sexrim3oo1omeemicsls srururont0altoiieiasfm ranmo;t)alxnio3iatoptrli s t texrir3nu4alte ietl( aDtaxmp;t1aleo ociasfm2rlump t0trxrir3oa1lat lnvi s0 2umxopoydolenmivs t a2raurooo1olt io3tadfs2umnmpn(0 ltoxocoo1fatraivo;( tetrimpio4amt licslsfaDtrxrp;u4tpe mictasfs uanvp;t) exrircia1fp  luvols  2ur(m io1olenmicsat)arum( onu1apt mociadfaDrlnvs t4 rxrmr3tatop  lues;()s2xmio ny4ll n ies (fsDtmx ont0alxomieiydla ua(mon()teenirciatfm raueo;t0t2xrxrpnodam emnvsat a2tmu oot4oeto i3iytfs2emn onu4alxoif3ta1lp rlueslt)srxmim3io4oleelnet ( s2uaxrpnt1oltn fetas a2umnvp (0arermf iydfm  ai slt0teuo(rpiy1openmics t arum(m nt4olx mfciatlsDrmu on(0aleoxr totlpDeln ol(  eumio3oodlptemfcsa()srtm(  ;t0opto fciad a rm(vp u0 ltnmfciodla   ieols  2urxmpnodlmt  ictasfsDtm(mpnu1aptnmfeiyd mDrmuvo;t)aetrmo3iy1fa  aivilt  exr(m iy4opteliesltfsDtr( o;o4tee mietltlm2rm(msnt0tetnxf to1oateluvsls trtrxo3oo1al emnvil(f 2urur ou4oexoiicias a2ea(vo;t0tltoir tydlp elivi;(0t2uo(m io1altelnvs t artr(mpot4oleo fciytls rmnvo;t4trxniocoadfmDr nes s0tetm(opou4lpe mncs ( a2tmx  ;u1tltomieiltfm ean p;u0 rxnio to1oate i sl(0setmiopiodoptnlncil()aDumxrp;t0oexo o3iatlm2rmnvs;u4aeeoir3iadlmDraneo s0 2toxm3nu1ll n neia(f 2tmu oou1aet mo3ildfa2uanvo t0arermr3iadfa  ln s s0sexr(r3iydom elfcsa( sDra(rono1optn i3iydfa2raumo;t0 lerir totfatrauvi;s0srxmxrpno1op n nvils)artrumoot1altoioeildlm2ul( s u0 leomfciy1lpteli s;(  2umxopnu4ap nmnviatfsruauro;o4tpeo fctys aDeauvsn() etomr tydfaDran o t0 rurio iu4alt  ietl(  2taump;u1altoifciltls rmuvpnt4 ltrmf iy1laDelu o;t0sexmxr3no4lmt lfes ()artrxmpnu4apeomi3tasla2ea(vpnu4alermo oa1fa r nvilt)t2uoimpou1ll nmicsas)a2ra(mo;o0aetnii3iadfm2ua(vpn()trxnio3iadlpD lu slt0s2tmxmpno4lmen nvtl(fa2ua(mo;t4tpt  ociysfa2ul( snu0aetrmr oatla elneolt)setmxrpoodame licta()s2umu pot0opt mi3iyt m elumo;u0 eeoxo3ta1fatraues s  2uoim3oo4op eliesa( srurxr ;o0aleo oeiad m uluvpnu0 rtrmo3oo1oa ran il(0seuo(r3nydole livia(f Dtmx p;u0aetoioeiatfm2uluvs;()aexrir iadom raieol() rxrxm3ny4lpenlnetl(fs2rauro;t0opxn i3iadlaDul(vpnu)tltoiocio1oa r ivo;s) rtm(mpiy1aptemnvtl(fs2raur ;u0aleoiieiysfa rl(vp () rtniocto1om rauvo ()srxrio oy4alee fci tf 2tm( poo0texnif3iatfs ranmpn() eenxf3iatoa eauvils)srumxrpou1apt mfvs (fsDuru  no4alxnmieilt m raums t4tlxrif ootlpDraiesl(0 2tmimpnu4aptelivi t)aDurur ou1olxoif3ilsfs rauvpnt4aleomfciy1fp   nvo;() rto(r ou4aptn fvsls) Dra(m ;t0aleoiiciydlmDem(mo (4 etrxocoodlmDe uvols)tetrxo3no1lptemfes ( a2rm(  nt1oltniietadfs rauvsn(4 lxnxo3iatoa  ai s t s2uoxopno1al e ivt t  Dum(mp;o4opxo fetyslsDel( ont0 rxrio3oodfa   ieils)texr(m iu1amtnmiei s sDtmu ono0tlxn ociys sDulnvs;t0 rermr oodfate n ol( trumir3iu4lm emicilt aDtr(monu0tle  fciltlsDranms () eenxr iatlatrluesl(0trxo(r3ny4om  lnvtat  2tax pnt0oltnmociytfs ulu p;t4 ltoxfctodfp r neol(  2uoirpno1lp  mfvtlsf Dtr(r nu1tetnio3ildlm em( p;u0altrio iotlp rai s;t) 2to(m ny4optemneil(f 2tm(rp;o0tpt moctydlsDrmums;t4 eermocoy1fmDe ivo;(0seuoxm oo4opt  fvi ()s2uaumpnt0tee mieiltls2uln pnu)alxrxr3oydfmD  ues t0t2xrio iudap   nei sfa2taum ;u0tlx ifciatlm2ul(mo u0tlxrmociadopDeln olt) 2toxr3iudame mieilt  2uaxmp;t1tlenmoctldla eauvp;u0tetoxoctadfaD  ies s0 rtm(o3iydole lies (faDtax ooo0olxnifctlsla2em(vo;(4aetrir3oa1faDelieolt)t2xoxmpnu1amtnmneilt)a2ur(rpnt1oex mf3iytla2rmn sn()alxrxf3oadlpD luvols0trxoxrpoydopenmncs ()artr(monu1tlxn o3iyd s2elnms;u4 rerir3oo1lpD lieil() exoirpnu4ol nlieia(  Dtm(m ou4aex  feildfmDemu ont)trxrxf tadomtrlueols)trxmxo nydapt livtlsfsDur(rpou1apen iciatfa ul(mo t0trtnmr iotlpD  n ils) exmimpnu4oltemivil(  2tr(mooo4tetniictls s emuvsn(0trtomf oytlmDraieilt)t2uo(r ny4apt lnvsasfsDta( pno0oeeo octas m2rlums () rxoxo oydfm elieolt)srxo(opoydamenlfcs ( a2rmur no1aex moctyt mDranvs;u)aexoircoa1lmDrai s s)truo(o oodaptemietls  2urx  ;t0olx  o3ilt aDuluvo;()aexoir oadfp elivil( s2xr(r3io4am  mietls  2trxmonu4apt  oeiadfs2rm(vsnt4arxnmr3oytfa eaivi s)sruoxr3nu1op  lfcsls)arum( pnu4oexomf3tatlmDra(vp;u4trtomfcoadoaDe nvo;t  exmio3nydolte ics tfsrtaumo;o1opx ioeiad s2emums;t0aeeoxocoydoptelivo t0 2xrio nudlmtnmnet sfs2rmx p;u4tlx ii3tlt sDranmp t4trxoif tytomteau sls setoxr oydomtnlnvsasfartrumonu1optn f3ilsfaDum( on(4 reoio oy1fpDelies;s) etoio ny1alte nvsasfsrtr(mo;t0alenmoeiadla2rlumpn() ltrxfctodlmD lies s srxr(mpnu4alt mnes t aDrm(  ;t4tpen ietldfs2rln snu0 lxrxrciatom raivi;() euoxo3ny1ale mneslt) 2ta(mp;o4aleoio3ilsla eanms u4 rxnxo oadla rliei;s0t2tmirpoydapeemicil()srra(rp;t0ole mfeiadls el(von(0tleoxo3to1omtr u i ()texo(mpiy1apte fes tfsruaxroot1ale miciad aDranvsn()tetnxr iy1lp  auvs t  etrxr3ou4op  lnetatf 2ra( oot1aleoifetasfs ra(mo t0tlxoxo oa1om rlivs;(0trtrxm3nu1olt  ivt s) 2uru p;o0oltoif3iydla2uaumonu0trenxr3ta1laDrlu s;() etoim3iy1lp   nesls  rrru  no0aptoiieias s rmuvp t)alxrxr3ta1lmD an o ( trtrim3oo1al  mnei ( srtaxmont4altn i3iadls elnvonu0aeenxfciydop rli i;s) 2ur(opoy4om   ies () 2trxm ou0opx  o3iytlsDul( ont)tlerxf tytop   uvo;s0trurio iy1omt  ncilsf Dtau ont0opeoio3ilsla um( ont)tlenmfciytla e n o;(0s2toir iydoltnlivilsfsDum(roou4alt iiciadfa2um(mpn() eermr io1lptran o s srurir ny4lme  fcsa(  rtaur nt0aleomo3tyt a2ua( ont4 etrmr3tytla raivilt) 2trimpny1al nlfvtlt) 2tmxr ou4tpt ii3tltfsDeauvs;t)tltomf tatopDr uvs () rxmxm no4lm e nesa()srrr(m ;u4olxomoeiyd mDem( s;u0tlxrmr ootomDelneolt) rxo(o oydomt  nvia(faruaxmp;u4tlxo iciltfm2el(von()tltrxf oydom   ueo;( srumxopnu1alen ivtlt sruaur ot1tle mietad aDra(vpnu4areomo3oa1la ran ol()texrxr3io4al  licsl( aDtrum no4opxoiociysfs ranvp () ltrio3ty1fmt  nvil( sruo(m3oo4omeemfvsas)arrmxmpnu0tpe iictydlm2rlnvs;t4tetoxr iodopt lnvs s tetmim3nydop nliet sfsDrr(rpot1tpto ieiysla2umump;u0alenmr3oydfm  aivslt)sexm(rpio4al n nvt t)aDraum ;o1oleniiciasla ra( o (0trxrmf3oytfp eluvilt s2toimpio1alt mietltf Dtmuront1aexn iciyt mDrm( ont0 lenmf oa1omD  uvilt0 euo(r nu1omte ieias) 2ua( oou4apxniieiys aDelnvo;(4 lxnxf oytop rluvil(0trum(rpiu1al nlietls  Dtm( ooo4apt ii3tytlm2eanvo;(0 rermr to1fmD lu sl()t2urimpoo4apte fcslt  2rru poo0tpen ociyt a em(vp;t) rxnio3io1optrau il(  eto(m3iy1om nlieta() rur(r oo4olenmfeiyd m el(vp;t0 rxoxociotla  ai o;(0t2umxr3iy1omtnmfesl( aruax  no1tlxoio3tyt aDrl(vo;t)tltoxo3tydop  luvo;t0srur(r3iodomee ncsls)srtmxrpnu4ape iocild sDemnmp;u) rxomf oydfmD an slt0sexoxo3nu1alte feias)srrr( onu1oltnif3iadfa ulnmsnu0alxoxo3iydfpDeau o t texm(r3oudamtemfei ( a2umum ot0olenif3iatlsDrmumo;u)arenxrcoodomDelies s)teuo(rpiodlle  ncsa() 2tax  oo4aptoii3tatfs rmn onu4 rxrmo3tydfpt  u olt0texm(r3io1am   iei t  Draumpnt4aetoifciydlm eluvont) rerxf3tydom  anvo;t0s2xm(r oo4lptnlfci sfs2rmxroou1tee  oeiadla emn s t)altriocoatopt auvi;(0 rxoxo3iodoptnmnvta(  2rmxm nt4tet iietlsfaDelu p;t0 rtomf tatoaD aneilt)s2tr(o3iodam  micsas aDtrum ot4tex io3tyslm2raums t4artnmo3iodomDrauvi;()s2uriopnu4ap nmnvs ()srrmu  oo4alt ioctytlm rmumo t0 lxnxoctydlmt  u slt trxm(m oydopenlncsl(faDrr(rp;u0tlxoiocias m elnvp;(0arxrir io1laDraivi;t)t2xrxrpiu1ol e ncilt a2trx ont0altniietydfaDrluvs u4trxrif3todfpDranei ()trum(mpiy1al  lfeslt  Dtmumonu0teenii3iatfaDeanmpn(0aeenxo3tatlaD auvi s0trum(rpiy1omeemfei s)a2umxm ot1opt ifeild sDemu o;u0 eerirctydopteln i (0sexmiopou4omenlnetls)arururono1aeenio3iatlmDumnvp (4altrir oatfmDrluvo;s0 etmxrpoo4oltelfeta( s2uru  ;t4olxo ieiysfaDrmnmpn(4tlenxo3ty1lateaivs s srxrxmpnu4op nlfvs ()a2rauro;u1opeomiciltfsDua( pn(4 reoir3oy1opD  ieil(0 rxmir3no1lmtnmfet s  2uaxmo;t0olxoif3tad m2el(vo t0 lxnir totlp r ies ( texo(rpiodaptnmfvtltfsrtmxrp;u0oexn fctls s uanvp t4alxrif iytfpDrai o;s)srtm(o3ou4op e ictl()sDrr( p;u4teeo feiys sDum(vsnt) exrir oo1fmDrluvo;t) ruoim iudlm elnvi sfs2tmum nu0apxniiciydlsDea(vo u)alermfcoy1oat  uvi (0 rxoxr nodopte fcsa() Drmu p;t1texnif3iatfs2rl( snu4texrxo3oadfp rli o s srurio3nydom n fetasfs2ta(mp;t4openmfeiyd a2ra(msnu) ltrmociy1laD au s;( t2tmxo3iu4olt lnvsl() 2ur(rpot4alx  o3iltlm umnms t4 renirctytfp  anvi;t0s2xo(o nu4oltn ncia(f 2taxmo;t4aptomoeiytfaDrmu s t) rerif ootlmDrauvslt s2to(r oy4olee fvtl( aDurxmp;o1olxomi3iad mDel(vonu0artoirciy1oa  auei t0s2umxopoodlltemfesa(fs2uru  ;u4tpxomoeild sDulump;()tltnxrcty1omDelneo;t) 2uoxrpno4llenmfesas)srrr( pou1alxo fetltfs rauvo (0treoio iadlmDean sl() euo(r no1opt  fvtlt  rur(roou0oeeniietydla2ulnvp (0trxnmr iadoat ai o s0 2ur(rpio1ome lnvslsf Dtr(  ;o0tetn fetysfs2rmu snu0aetrmf oatfm e u i (  etoim3no1op e ivtltfs2tax  ;u0ale mfcilt m ea(vs;() exnmr to1lmDeln i;t0truoimpoydoptnmfctas srrr(r ;o1optoio3tasfm rl(mp t0tltrxo3ta1oaD  ieo;(0 2ur(o3oo1ap  mfvt t s2rru ono1opt  fciatfmDum(vo;(4tlxomrciatfmDranes t  rxrxrpoo1lptnmivs sfs2ururont4oex ifetasla rl(vo u0trtoifcty1omDeaueo;s)t2to(o no4alt mncsls  2tru pou1altomo3tysfsDrmn s u4tlenmociytomD luvils0texoxr3oy4llenmictlt srtmxm ;u4alto i3ildlm2ranmo;u0 renxfctotlpt aivs t  rtoim iudal emfcsa(  Dumxmo;o1ole iietldfaDel(msnu4altnif io1omt luei;t) exoimpno1op nmnvtl() rtr(r nt0oltnmictltlm2rmuvp t4 etoif iadomD lnvo (0s2xmiopno1ol emfvsl(f Dum(mpnu4alx if3tyt m2ranvpn(0tlenxo tadfa eauvs (  exo(r ou4am nlfcs ()aDtr(mpoo4olx ioetltfmDumnmont0aetoif iodfmtrlivo;()seuo(m iy4omte ivtl(f Dra(m oo4oee ifeilslaDeaums;u) eermf oodlateanvils0setmir nydapte fesls sDrmx  ou4olt  ieiaslm umnvo u4 renxr tatfaD  neo;( t2xrim nu4optelicsat a2umxmpoo4oexnmoetltlm rl( s (0artrif3ta1faDrli ol(  rurxo iy4ol   fctasf Dumxmonu1apx mo3tatlm ulnvp;u0trxrif oodlp   nvo (  2tr(opou4llenmncils)arraum ;t4oexn f3iasfaDrl(mp;u4trxrmociatfat  n s s)trumir3nu1lm   icias)aDrm(rono1aexnmieilsfm2umu on(0tlxoxo tytlmte ieo;() 2xoim oo1omee ieslt  2rmx pnt0ape  oeiyt s ul( onu)tlenxf tydfpDrlivolt  exoirpoy1am nlnesa(f 2ta(mo;o0tpxo feils m rlump t4alxnmfctydlaDeauvo t texrir ny1am  lfvilsfaDra(  ;t1tpxo ieiatla2eau p u4areoio tadlpDelnei;(0teurxo3iu4ame lncta(fsrrr(m ;u1ole iiciaslmDulu s;t4trenxr3todfm ranvi s0srxr(o no1aptelivsl()aDtr(m oo0aetoiieiysla2ua( o;t4trxrifciotfa eauvs;(0trxo(m iodamtnmnvi t  Dra(  no4oleniieiydla ul(ms;u0teenir3oodoaDr i o;t0 exrxr ou4openlnctl(  rtr(  no1tpt moetlt m um( on() rxrmo totfat aiei;s0t2tm(rpno4optemieiat  rua(roou1tlxoio3ildla2ulu s;t4teeoxfctatfm  luvil(0s2xoxrpny4lleelnvsl() rra(mont1ale  o3tlsfa2eauvs t0 etnir io1fpDeai il(0 rxoimpiydoltelfcsas sDtaurp;u0olxomfciatfs2uanms u0tetnmfciodlmteln i;s t2um(m3ou4oltelieil(farrru  nu4texn oeiytlm2um( s u4aexoirciadlmtrlnvi;()texmxopoudap  miesl(fsrrr( o;u1apenmo3tad a em(msnt)aexoxf iy1laDe ivo;s0 2xoiopiu4lm emnes ( s2umu  ;o4tleoii3tyd m uanvo;u4 ltoxrciatlmDelnvi t)s2umxmpnudolte fcilsfs2tr(rono0apx  o3ilt m em(mp;u)tetoir iatfptrlueo s  2uoxrpny1lmtelfctl(  2tm(rp;u4tlxn oetytfs ulnvp;(0trtrmocoydlmtraueo;s)sruo(rpnu4alt mnetl(fsDra(mo;u1aexnioeild sDeanmpnt4 etoio oadlptrauvs;(  rumim3iy1om  lfvsl(fsrumumono4aee mfciaslm2rlnmsnu)alxrmf totlmDrlivo;()tetrio ny1llenlfetl(  Dum(  no4tltomfciad mDelu pnu)aetnxfciatomtranvsls texoim3oo1am emfcsa( s2ra(r ;u0opt  ieiad aDumnmp u4arxrmf3oo1fpD  ivi;t)setoxrpoy1lmtnlnetls)arrr(m ;t1aee  f3tldfa elu p;(4aexnxf3oadlaD anei;( seumio iu4lltnmicta() rumu p;o4altoiietys a rlnvp (0altoir3iy1lmte nesls0seur(mpoo4lmeemnvs t s2tmxrp;o4tpxnmf3ias m2ul( s;u) eenmfcty1la ran sl( seumio3oo4ap nlnvsl(f rua( o;o4oexnifctadls2uanmp;(4texnirciodlm e uvs s) exo(o3oudam n nvi s)artrxr nu4tptnif3iltlmDumn s u4 lxrxrctodfp  livs;(0 2xmiopno4al nmiei ()a2rmump;o1alt mieias a2rauvs t4altnir totlmDrlneo;(  rtoxr3nydamee ncilsf rtr(  no0oet ifetltfs emump u0tetomr3tytfaDr uvs;s0s2xo(m3oo1omt  ivt s)aDtau  ot1oeenmfctyd aDua(vo (4 rermo oytfa ran s;s  etmxr3iu1lle liciltfartm(rp;o0tle ioetyd sDuaums;t0trerxr3iatlp  luvolt texoxo3iydamtelncilsfs2rmxroot4apxnifetldfaDranmp (4alenmf3ty1fpD aivi t0sexmxm oy1optnlfet sf 2rm(rooo1tltnmi3iltlm emumpn()areoio iytop r nvs ( tetoir3nu1lle mnci (f 2rm( pno0alx  i3ild m emnvp t0arenifcootlaDr u o s0truoxm3oy4olenmfeil(
\ No newline at end of file
@@ -0,0 +1 @@
+nes t  rxrir3iy4oleelnvias)aDtmxm ;o4tpenmf3tadfs umu s t) etoxoctatomD  iei s  ruo(m3oydap nmict (fsDrmx ooo4tlen fctltlmDra(mo;u0tlxomrctydlpt  uvil(0t2toim ou1op e fcs ()sDrrur nt0tpe  fetld sDrmuvonu0 renmo3iatopDrluvol( s2uo(m3iu1lptemfeiasf Drrx o;t0aptn f3iadlaDel(vp t)tltoxfciydlmt anvi;(0trxrir3oy1omee ivi ( arrrxmp;o4ope  ociys s2umuvo;(4 etnio io1lpDelu o;t)texoxm oydopt lnesa(fs2ururo;t1oltnioetlsfs el(vp t4 eenxo iadfaDeaueo;()t2xrxo3iodal  mnvilt aDtruroot4tlt ii3iaslm rauvp;(4 lxnxr3io1fpDelu slt srtmxo iu4ol nlnvias sDtax pot4oeenmo3iltfmDelu o;u4 ltrircta1fatran o;()setmirpoo4am n iciatfsDrrur nt1altomfeiadfa2um(vs;t0teeomrciadfa  aueils0 rum(opoo1apte nes tfs2um( o;u4apenif3ilsfa rmu s;(0 etrmr oatopDe u s t trxoxo3no4op  livs sfsrumum ou0oltnmf3iyd a2emuvp t0trtrio3oo1lmDeanvs;t0t2xmxm oy4alt livia(fs2tmu ont1opeo iciys m uln snt) exrmfcoa1optrau ils0 2xoxo ny4ll n ies ( s2uru poo0alt  fciasfs2emumonu4 lxoif to1oatr neo ()srtmxrpiy4lm emncilsf rum(  ;t4opxomoetyslmDea(mpn(0 etoxo3tytla   uvi t0 2xo(o ny1op elnct s s2tm(moot4tpenmfctyd m ra(vp u)trermo3tydlaDe i s s)texo(rpny1op n ieiat aDur(  ou0teto i3tysla2ul( s t4artoiociadlpt  nei (0 eumir3oydoltn fci (  2raxrp;u1oltomieild s rm( pnt0trenxo3tydfat luei;s) 2xmxr nydomtnlivtls)a2ta(mpnu4altoioeiltfm rm(vs;(0artrif3totfp   nei;s trur(o oudlm  lncia( aDta(ront1tee io3iyt mDrlu o;u0 lenmf tadopD  uvil( sexrio ny4ap nmivil()arumx p;o0oexoii3iaslmDrm( s t4trxoiocoytopDr ies;t) rurim3iu4ol elfeil(fsrtmumpoo0tex mociytfs elnvs (0aeenircta1om raivils srxmxrpiy4open nvs sfsrtrx  ot0teeoio3iasfm um( p;u0trxrifciadopD  ueslt teuoxm3oudaltemncils)artaurpno4tpxnmfeild s2rau p u4 exnxo3tatlptean ils) euo(mpiu1ome  nctl() Duaur ;u4oee mo3iydlm2umu sn(0 lenir oodfa ranes;t setr(rpno4openlnvtl(farraxm ;u0tlt mo3iasls2rlnmo;(0tlxrmrcoatlat  ies ()trtr(mpiodllee fvslsfaDururo;t1apxniieiaslsDrmuvs;()tetniocoydlp elneils0 eurxo3oo4amenlicsatfartrxrooo1apeoioeiyd s2ea( s t0altnmo3oydfpt  uvo t) exrimpio4lp  mnct (  Duaxmp;o0tpe io3tytlm emnmp;u4 lxnxo oydom e i s t trxmir nydol nliei (fa2rrxrpnu0aex  i3tadfmDeauvonu)tlxrir3to1lpDeauvo t0 2xr(m oydapeemicia(f Draxmont0opto i3iydfmDrm( o t)trxomf3oy1opDrlu i ( sexmio ou1lp  lncsas)s2raum ;o0olen oeiydfaDrauvo;t)tetnio3oa1opD liei;s  rxr(o3ny4apee iviasfa2uau p;u4openiictlsfsDuaums;u4arenif iytla  ai il(  2trxopoy1om  miet sf rtruroou0teenmfcilt m2rm( p;t0tetnmo to1fpt aies;()trto(mpoo4ame liciat sDrauro;o1alen fciltfm rmumo u) ltnxr3io1oatelnes t)t2xm(r io4am elncsls)a2tmx  ;t1tptomo3iyd m2emn o;u4 rxrmrcoa1la  auei t)teurim3ou4amtnlfesasfs2tm(ro;u4apto i3tltfmDulnms;u0teerif iodlmDeli i;s) rur(m3oudlle  ncias)sDumurpnu0apenmiciydlsDuan onu)alenmf3tytfaD  nvil() rurio iy4om e nvsl()srtax p;t4aeeo ociydls emnms u4tlxnxrciydoat  iei ()srxrxo iu1amtn fcslt) 2urxroot4aptoioeiadla emnvo;t) reomr iotfpt anesl()srurio nu4lle lfcil( s2ta(m ;o4apxniiciltla2elnms t0trxomfctatlpDeluei;t  exmir no1ole liesa(  rtru  no0oltn iciatfm rlnms t4altnmr tadoa  auvolt0t2toio3ou1llee iviat)a2rr(  nt4tptnmictlsfmDul( on(0aeeoxr3iodfpteluei;()s2toxo oodaptnmnvtas) Dumxmo;t0tlen octatls2em( pnu4tltrxf tydoaDeaiesl(0setm(m3iy1amtelncilt a2trxmoou4tptnio3ilslaDeluvp;t0 eermrcoa1fm rlneilt) 2xo(opiy1lme  fvias sruau  ;o1aet if3iatla umumsn()trxoxr tytomteaivilt texmxo oo1om nmivtasf rrrumont0apxnmocils sDeanmp;u0trxoio ty1fmDe uvol(0trur(m3io4ap  mivsatfa2rrxroou4tetn feiytfm rauvs (0alerxr oa1fmt an il( seurir3iodoptelnei (  Draum ot4tlx  o3iyd aDrl(ms u4 rtrxf oytla e u slt0t2xr(opiydop   netat  2rmu oou0oex ii3iyt mDul(ms u) rerxr oadlmDrlu o;(  eumiopiy1optnlnei ()s2rrumoot0opxoifeilsfsDeluvs;u0tlerio iodlatrlivs;s0srum(o oudlm  lnvil()srra(rono1tex mociytfm2ulnmsnu4areniocty1op rauei;s trxr(r oudlpe  ivt s  2ta(  oo0olto i3iydfa2rmump t)texoif3oadfpDraivs s s2xr(mpny1lle lnct sfaDta(rpnt4texnio3iys sDea(vs (4altrmf ty1fmtelnvsl(0sruo(m3io4op nmicslsfs2ta(mp;u4tlen i3tyt sDum(mp u4 ltnmrciytfaDrln i;t  2urxr3iu4lltn net tfs2urumpnu0tlenmi3tltfaDemn p;(4alxrxf ia1fp rli i;(0srur(o3ou4openlfciat) Duaurp;o1apx iieiasfaDem(mo u)trerxr oydlpt  nvo (0s2trxr oydlltelnvs ( a2taxr nu1tleo f3iat m elnvs;t4 lxomo oadoatr n s;t)trumxrpoydll e nvs sfaDua( p;o0tlen iciltfm2umnms;t)trxoxfciadfmt luvo;(  2tm(o3nu1lltnmfci ( sDtm(mono4teeoio3ildlm2rmums;t)trxomo iy1om  au i;t0 etrxmpoy4lme lnci sfarrmxr oo4oltnioetytls2umuvont)alxomociotlptrlu s s0teto(o nydame livtlsfsDum(r ;t4aex  o3iyt m umn o t4tlenmrcia1omtraivils0s2toirpoy4ame  nvil(faDtmu pno1aetomfetat s umuvp;t4 rtnio to1omteanvo;t0t2xrxmpiu1omenlfcsas) 2ua(  oo4alxoio3tltls um( p;(0trxnxo3oy1fm  lnvil(  2toir3nu1ale miviasfarrrur nu0alt  ocild m2umu o u0aexnmrctydlat  ueo;()sexmiopoo1lp nmfesa()arumu pno4tpt  feiys a eln o;t) eeoif ootfmDr ivi;s  etoimpiy1am n neiat)s2tmxrpno0apx micilt sDrmu s;t4 etomo3iydfp  lnvil() 2xoirpiudome mnctlt a2tr(rpno1aleo f3iadls2rl(monu4 rxnmrciodoaDr n il(0 rxmxo3oo1ol elfes (fa2urx  ;u0oeeomi3ias a2ua(vs;u0tlermr iydop  anesls)s2umxr3ny4ap  mfesatfsrtr(  ;u4altniiciasls umuvs t)tetoxo3iy1fm r i s;s0trxrim3no1lp  lfvtl( aDuru oot0opeomi3tydfaDea( s;(4tltnmf tydfm rlneilt) euoio3iy4ll elnvsltfarumumo;t1texnmoetydlm ul( p;t4trtrxrcia1optelueols t2xrio iodol e neias a2tr(mpot0tex moeiaslaDranvsnu)tleoxf3iydlm eaivsls s2xrxo ny1lptnlnct ()aDta(  nu1olxoif3iyt aDuaumo;t)aeenmf tatom rluvs;()s2tmim3nodom   ncias) 2urumo;u4tptnifeiat aDeau sn()tetoxfcoydom r nvsl()seuo(m iy1op  mfcsl( arumur ot4aleoiietas a2eln s t)aetnif iotla  lnvil(0seto(rpio4op  mnci sfaDraxmonu0apt ii3tysfm2uan o u0areoxr3io1lpt lnvilt)srto(mpoodlpee fvt t  2ta(rpoo4alenmfcils sDelump (0 lxomr3tatfatrlnvsl(  euo(r iy4olte icil(  Draumoou4tex  i3ilslm rlnmpnt)tlxrmo3tatfm elneo;()t2um(o iy1apee nci t)aDurx o;o0apxomociatls2ranvp;u4tlenxr todomD lnesls sexm(r oo1al  lics s sDtm( o;u1alt mf3tyt s umu p;u4altoio iotfpDrlnvols0s2urim iodalen feiat)sDurxr ot4apt mo3iytfmDrlnmsnu)alxrxf3tadfa rluvs s) 2toir3oodlpt mnvi t artax  ;u0tle io3iatfs emnvo;u0texoxo3ootoat  i slt srxoiopou1lme livilt)aDrmurpot4open feiadlaDem(vsnt4tlermf3tadopDrauvi;s)trtrio3nodam e nesls sDra(r nu4ope  fcildfsDrl(vs () renmo3todom eanvilt)trtoxm3oydlmeemfcta( arta( onu0olxo oetls a2elnvo;()alenxr iadla rluvolt)setmxopnu4ole  ncsls  Dtr( ooo0oleomfctasfm rmuvsnu4aexoxr iotlpDrln ols trxr(o nu1lpenlfvs s a2tmurpou0alxn ieiyt m2raumo;u4trtnio3oatfatelnvi;()seurxopny4lp   ncsl( sDra(r ;t4tpxnii3iad aDrmnvont4arermfciydfaDr i o ( teumiopiudlpe  feilsfarur( ooo0teeoiicilsfs2ua(ms (4 eenmr3tydom eaneols t2uoirpno1lleemnctl() 2raxrpnt4tet mocilsfs uauvp u)arerirciy1lptrlnvs;s sexm(r oo1lp  mivs tfa2ur(mono0aptomfciasfm uan p;t) rerxr3ootomt  uvilt0srur(rpiy1omeelfctas aDrmurp;u1tptnifctat mDranmo t0alxnircootlptr u o;s0texoxo oudaptnmnvsas)a2umxrpou4tpt mfciyslm2el(vs;t)trerxo3oodom   ueo;s)teurxo ou4oltemnes () rtm( o;t4opx ifeiasfaDrauvsn() eeoxf oatlaD aneo (0s2xm(o oo4apen ics t  2rrx  oo0tle mietls m ul( o;()teenmr oo1laD lneslt teuoim3oydlptn nvtat  2tmu p;o1opto ieilsla2ulnmsnt4 eerxrcty1omDeai sls texoxr3iy1amtn nvtatfarrmxr nu4oleniicils s uanmp;()aetrmr3tatoatran i;s0seuoxm3nu4ap nmnctl()a2tr( pnt4ope  i3iydla2el(vs t0 ltrmr3oytfatr i s t seumxo3oydalte fcs t aDrrxrp;t0ape  fciyd aDemu o u4teenxfctytfpt livols) exmxr iu4ll elfvia(  rra(m no1tlx iiciadfm2ulumonu)aetomo3oytoatr n o (  etmio iu4amtnlfes (  rtaxm nu1aptomiciatls2rln o u4 lerxfctotfmDeln ils0trxoim3iydoltnmicsa(faDumxr ot4tpx mi3iad sDrlump;() rtnmo3to1omDraieo;t0 eto(m3no1amtn ivs sfsrrm( o;t4olt iociat sDumumonu4arxnmocoodlm rlu i t0 2uo(o oy4op  mietlsfa2rr(rooo0apx  icilsla eln o;u4texrif oytfmt  n s;t truoio ny4llt lneslt)sDtm( o;u0alx mi3iytfmDeanvsnu0tetoxr3tytomt an i t s2uo(o3oodlp e nct ()s2ururpot0aptoiociatls rmu s (4tlenxf3tydfm r ueslt setr(mpiy4ap  mnci (faDra(monu1oltomiciysfm rlnmo t4aleomf3oo1oaDr i olt0truoxm3oudopt mivil(  rtrurpot1oeenmi3iadls2eanvo;() ltoirctydlaDr nvs;( sexm(m3oy1llee fci s a2um(mooo4open fciasfmDul(mo;u0tlxrir oydoateli i;s)tetrimpny4aptnmicsl( a2tm(r ou4oetn ocils aDrm(vp () exnxrciatom r n il(  rxmir nu1al  mici t s2rau  ou4aex mf3tad a2rmuvs u0 ltriociotfmtraivi;(0 2toimpnu1lpt  ietat)aruaxr ot4apxo octadlaDumumo u)alermociydlpt  ieo;s srxmxr3iu1olteliesls) rrrurp;u4aexo o3tadfm emn p (4 rxnmf iytlp eaieo s0trtrxm3oudolte feslsfsrurur nu4aleoifctytfmDrauvsn(4treoxf oytlmDe ueslt t2tmim iu1ape  ivtls)a2tax pot1aetn o3iltfaDum( o t4alxomr3tytomt  nei ()teumim3oo4omtn icils  Drrumpnu1oetomf3iadls emu o;t) etrif oydoat aiei s0trxr(mpiy4lm  mfcs tf 2umxmp;t1aleoioctasfsDemnms t4 rtnif3io1la   iei;s t2uoim3iudlltemfvils aDum(moot4optn octatfm2emn s;(4altomf3oatlaDr i s ()s2ur(o oo1llt  ics (  Drmxmp;o0apt mi3iatls rmumpnu0texnmfciytfp rluvs;s0 2tm(opnu1am  mnvt ( aDuru oot4aetnio3ilslsDemumo t4treoxrcoa1lmtrli ilt0srumir nodomeemnct sfa2um(  no0tlt  i3tldla2emn o;u) exnxr tatoa e ivils  etoxm iy1op   ivtlsfa2umur ;o0tex ifctysfs elumo (0 lxrmoctodoptraieils0teuoim3iydom e ivsltf rta(rpoo1texnmocias m2em(vp;()aeenio3ia1opt ln o s0tetmxo3nydlpe lnesasf rtrxmpoo4tlt  oetyslsDran pnt)arxnifciytlpDeaivi;t0 etmxopio4lpt licilsfaDur(root1apeoifciyd a2ul( p (0tlxrxr3iadoa rlnvo s0srumxo oudopt lictlsfartrxrpno4olx io3iltfsDumnvsnu) ltrxr3oadlp  ln i;() rxm(o oo1lm nmfcsls)artrx p;o1oet mo3iasfa el(ms (4 ltomf3oytfptrau ilt0seurirpoo4aptnmfetls)s2rru  nt1opxnif3tas s2ua(mp t)tleomo3oadop   ueo (0 euoir no1ale livtlt srumxmo;t0aexnmf3tadfa ulu o ()texoxfcoa1op  ln il( t2xoimpnodolenlncsas)srtrxmpot0opt moetlsfsDran p t4arxoxf3tatopte nvo;t  exmim iodll  licil(f Dtru  ou4altniieiyd a ul(mp t4tetrmrcoy1fptrlnvs ()trtmxopiudam nlnvil()s2uau o;o1oetnmi3iys m emnmsn(4areoxo tydlpDeauvi;t)trxm(o3nu4ole mieias)s2rmur ;u1olt  fctadfs2rmums t4alxnir ty1lpt aivol()seur(rpnu1omtnmfcsa( sDtmuront4olto ociltlsDrlnvo (4trtnxo3ty1omtrauvi;s0 2xm(o3nodolenlicias)srrmxmo;o4aeenifetlt aDrln o t0aetoifctytomDraivs () eumimpiydal elfvilt  rta(m no4alx mfeias a2eluvp t4arxomr tatopteaies (0setr(rpnodomen nes ()sDuau ooo4tpx ifciyd a elu p;u4tlxomrcoo1op  lieo;t  exrir3oodapeelfctas)srrrump;t0tleoifctlsls ua( s;u0aetnir iotlmt aieils0texmxrpiodomeemfes ( aDrrxro;t1texoiiciyd m emnmo;() rtrmr tatfa  livs;(  rtmio3ny4llenlfcilt aDua(rp;o1alen fetltla eanmont) lxrmr iodlm  an o t  ruoxr ou1om emivs ( s2rr( oou1tle mociyd a2ulnvsnt0arxrmfctadfmte uvilt0s2toir3ny1apt liei tfsDrm(  ;u4tetoio3iasfm2umu pnt4 ltrxo iodfmDeai s;s) rtoxmpiy1ll emfcilsf Drm(mooo4teeomiciydfs ranvp;u) rtrmr iodfp r ueo (0s2uoxmpoy4lmt lnct tfsrtaurp;u4ape miciytls2emnmp;()tltomo oytfmtrlneil()sexr(mpnodale lfesls)srraumoot0alxn o3iysla rl( s u0 ltoxfciotlpDr nes;s) etr(r3ou4altnmivslsf 2tr(mo;u0apxoii3iaslm rmuvs;(4tetoxr3iydomDr ueo;s0srurxr no4al  lfetl( s2uaum oo4olt iiciysfm2emu pnt0aetomf3tytfpt lnvs t0 2tm(o3ou1apen fvt t) Drrxm no0tpenmieiysfmDua( o t0texoif3oodomteluvi;(0sexrxm iy4apeelfciatfa2ua(ront0aptnmfcildfmDelumo;u0trtnif ta1omt an s;(0s2umxrpnu1ope  fvi tfsrrru pou4tptoif3iys s2eau snt0teerxr3tydomtr nei t0 rxo(m nudop elnvslt) Drrum nu4tpe  f3iltfmDrluvont)trtomfciatlaDrlieo t teuo(o3ou1ap emfvs s)a2rmx  ou1optniictas m um(mp (4tlermf iy1oat ai i (  2tr(m3iydap n ieia()s2uaxm ;u4alto ociyt m rmumo;u)arerxo3iatlatrliesls setrxo iudole livsa() Dua(rooo4aexnmociyt sDuaums;()alxoxf oytlpD li s;(0trur(rpou4lpt  ncs s) 2ra(  ;u4tlxomi3tytlm el(mpnt4 rtrifcoatfm r u sl(0trxm(o3io1omt  ivtas)a2raxr ;t0tpxnifcild a2umnmo t4tetoif3tatom r ueolt0 rxmio iydamenlfeia(fsrrm(r ou1tpe  fetldfa rm(vp (4treomfcia1op  lnvs s0setr(r nudam n nvsl(fsrrr(mp;u0aee ioetltls umnmsnu0 lxnif3oytopteauvolt0 2xrim3iy4ll elicils)artaxm no1alxnmi3tlsfm ran s;u0 exnxrcoytlm  lues t s2tmir3nu1ol nmfvt s a2um(mp;t1oleomo3ilsfm2rl(vo;()aetnmrcia1lmDranvo t setrim3oy1openlfvtatfaDrrx oot0teenifeiltfa uln ont4aetoxrctatopteaieo (0srumir nodalt  neslt)arra(  ;u1alenioctas sDrl(vs u4 rtrxf oo1oat lu olt0 rtmir3oodal elfvsls a2taxmpnu1ope mf3tld s ranvs;(0texnircty1op raues;s0sexm(m3iu1oltemieias a2rrx  oo1alxnii3ias s2uanvp;t4tlermr todopDe u sls0t2tmxr3iy1apeelneslt)s2urumo;o0apx moetld sDea( pn(0 eenmrciytfa rai o;s0 rumir nydapt lnvi t a2rr(mp;o0oeenio3ilt m2elu onu0arxomf3oo1opDrli s;s s2trir oo4lm  lnetatfarum(ront1tptn oetldla ea(vo;()texnxo ootlmtraivil(0tetrir3iodol  miciat) rumurp;t0opx mfctas s emnvs t0trerio3tytlp  aues t0srum(o3oudop  lnvt sf Draxmpnt0apeoio3tldfs2em(mp;(0 ltnmf tytfa e i i (0sruo(o3oy1al   fetl( a2urxr nt1optnio3iadlsDulnmo t4trtoirciatoaDran s ()t2trir3iodlpeelfvsat)arur(m ot4olx iiciysfaDrm(vs u4 eeomrcoatfa eau ils)srxo(opoo1lmte fvt s) 2truroot4alxnioeiysfs2rl(vpn(4aeeomociodfmDelueilt srxm(m nu1lpe  nvsl(  rra(mono4openiietytfaDuln ont) lxomocoytfm   u sls  eto(r3iudlp n fvtat)sDrrumonu1oexo ociysfm umnvsn(4 etomo oydlpD  nvi;t srtmxr3iu4open netlt) Draxm ;t4aet moeiaslm2rmums;t0aeerir3oodlpD  ieilt)texm(r oy1lltelivtl()s2urxr oo4tetoioetyslsDum(vp;u0trxoio3tytlmD lu sls0t2xmiopny4llenlfvsas  Drr( oot1
\ No newline at end of file
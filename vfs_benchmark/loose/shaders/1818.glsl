@@ -0,0 +1 @@
+i o;s0 ruoimpiudomte nei t  Drmxmo;o4apto ietytfsDeauvon(0tlerif3ty1lptraieols  eur(mpio1lltnmncilt  2umu poo0texnio3ild m2em(ms t0alxoxo3ty1fpD lueo;s0texm(o3ny1am elncsa( sDrruronu1alenmoctyt s2ra( s;t4 etnir3oa1omD li s;s0seum(mpou1amenlnei sfaDrmxm ;t4olenmoctltfaDra(ms t0artnxf oodfm rlu i;t) eum(r oo1olt lnetatfa2umxrono4tpeo feiatfs rmuvp;t0 ltnmr3ty1la   u s;t  2uo(m3iu4al  lfei t  rra(  ou0aptn feildlm2ulumpnu) ltomf iydlp  anvsls0s2tmir3nydll elnci ()s2rru  ;o1tetnioeiasfm2um(mo (4 rtrmf3oytfptr u s;t0trtoim no4ol elivs s  Dua(ro;u4ale  ieiydls ranvo;()teeomocty1latrlivs ( t2toxm3iudllenmfct t  rtaumpou0aetomf3iyd m ulumsnu)tlerir iodomDraneo (0 rtoio3nu4lmt  ncia( arta(moou1altoio3ias s uauvs t)alxnxrctatlmDrlieils)t2tmxrpnudomt  nvtltfa2rr(mp;u1tpenifetys mDrmnms;u) rermf3tadfmteaueolt) rxr(o3iu1oltn ivt ()sDrm(m no4tee  fcilsls2rmn onu4 lxrxo3oatlmDe neo (0trxr(m3no1omtnlfvsa(  2tax  ;o4tetn i3tls s uanvs;t0 lxomf iotom   u o;s)t2to(rpou4am  mneils)artmx p;u4teto iciytlm emnvo;u4artnir iy1faDe nvs t0 etrxo3nu4alte iei s sDtrxmpno0aeen f3iltlsDemu p t0 reomf to1om elnvi;(0t2to(m ny4omeemncsat)arrau poo1tee  ieild m um( o;t)trerxrcoatlpteaneol()s2urxm3iy4lp elnvia()sDurum ;t1tlx ioeildfsDelums;t4texnmfctodopDeaneol() etoirpno4aptn nvtltf Dumurooo4opxoifciydlsDemnvsnt4aeeoif tatlaD lu i t)t2to(o oudap n fcsl( aDua( ono1teenmfeilt m2ul(vp;u4tltnmfcoy1opD anvs ()srxmxm ny1lptnmnvtls)srrmxmo;t0tlenmo3tld sDul(msn(4aexomr3iytomtr nvo;s0t2to(opou4al n fet (faDrru  ot4apeo ieiasfmDranmsn()artnir oo1fa  aieil(0t2xmxm3nydop nmnctls) Dtmump;t1oetnmicias m2eaumon(4tltoxr iydlat auvil(  exoxm3iydlmtnlnetas  2taxmp;o1aex mi3iydlsDelnvsn(0 lxnmr to1optelueo ( s2ur(mpiudop elnctls) Dum( p;t0tetn icils s uanvon(4 rerxr iytfa elneo;s t2xm(rpoo1lptemfvsl()a2ua(mono4aleoio3iyd aDea(mont4 renircto1faDe i o t t2toirpiu4amtnlivtlsfa2um( o;u0altoif3ildfaDran p;(4trermociydlatelueols0seuoim ny1omtnmfeils)s2ta( o;u0tpt mieiytlm2ra( p;u4 renxf totlmtelu s t0 rtm(mpiudalenlies ()srrrxr ou0aeen o3ildfa2em( o;(4aeenif oodlat  nvi;t)sexm(m nudole  fet t)srumxr ;o4olt ifeiys mDem( p () rxoxr iy1op r ieol( trxrir3nydllen ietatfsrtauro;o0tpenmf3iasfm rlu pnu4aleomf3ta1la   i o;s0texrxm3nu4lptemnes t)sDurxmono0alto feiad s eluvon(0 ltnxo oo1fp  anesl(0t2toxm3iydlm e fctlt)a2urxmont4aee io3tasfsDeln p (0teenxf iodop eaies (0 exmiopiy4llt lneslt) 2trxr ou1opxo oetyslmDrluvs u0alermo iatlmt lnvs s)srtmxo3ny1ap elnvt ()sDtru o;t4altoioeiatla ea(mp;(0tltrmo todom  luei;s)trtmirpou4am  mneslsf 2ra(moou0tpx iicias s um( o t0 eerxo iotoaDr ueols0trxo(o io1ame  nvta() rrm(m no4apto f3taslm2ra( pnu4 lenio3oatfm elivo;s)srxoxo iy1olenlict ()aDumumpot1oex mf3tldlaDemu p () eeomfciadlaDe nvols  eumxr3iu1lleelfcilt) rtau o;u1texomiciat s2elnvpn(0arxrir3iy1omD luvo s)t2xrim nu1am nmiesat  Dur(r no1ole mfciltlmDuau p t) ltnmr ta1fm e ies;t)setrxmpou4alt mieta()s2urxm ;u4oex  oetad m2rmuvs;u4trenxr3tadfateauvi;s)setr(o3nu4lmeelivs t)srur(m nt0apt mf3tlt sDra( s u4 ltrxfcta1op elnvo;t s2to(mpnodol   fet t)sDtaxront0oeto oeild s2rmu sn(0 rtoifcio1lpD  n s;t) eurxmpnu4alenmfesl( arua(ronu0tltniictydfm2umums;u0 lerir io1lmte ues;s)teumir nodolt  ieslt a2rr( ooo4alxnmo3iltlaDuau pnu0 rxoifctotlmteluvs;t)texoimpiydlpeemivtatfsrraxmo;u4tetnmo3tas a uanvs;u)arenxf tydoaDeaueo t)srto(r3nudlm emnvtls)srrauronu1tpt mfciysla ranmo;()tetnxrcoa1laDr uvo;s0 euoio3nu1lleemfctls a2tax  ou1olx mociyd a elu s t4aetnmrctotla  aivo;( trtr(opou4omt  fvtatfaDrr(mp;t4tltnmf3ilsfs2rau s;u4tlenmf ty1fat au ol( t2trir nu1ap n nvtl(f rrmu pnu4tpe  ocildlmDulu s t0tltrio3iy1laDeln i s sruoxrpiy1aptnmics tfa2rru ooo4ale  feiat m umums;t) etnxfcty1fp r i s ( srtmir ou1op nmnvsas)artmump;u0oexn fetlsfa eau o u)teerif iodfatranei t)trxoimpnu4ol e fct () rtaxm ;u4aetnioctysfm2uanvsnt)tltrxo oa1opt lu s;s)setm(opiodale lncias)aDrmxm ;u4tpeo fciyd aDuluvp t4altrmr3ootfm rlueo;s0srurimpoy1al e fvt t)sDra(rono0optnmo3iytlm ea(vpn(4arermo3iotlm  aiei;s0tetr(o oy1lme  fciltfarrm(m nt1olt mociatfa ean p u) lxrxf3iytopDe i olt0s2xoir oy1lpen feil(f Drau poo0apxn fcilslmDem( s u)altrmf oy1la  livs;t  2toirpnudol   feilsfarrru  ;u0aexoiociltfs2eluvon() etomo iydfptelivo;(0 ruriopoy4am n feilsf rraxro;o0tetn fciltla2umnvsnt)tlxomfcoydfp   nvsls  2xoxmpnu1alt lfcsl(f Durur oo4oeenii3iysfa2rau s t4aexrxfcoatfp e n s;t)s2xo(r3nu4op  mnetasfaDumx onu1tleoiiciltla ranvo;t0aexrio3oadoaDeau i;( s2urxm3no1opt liesa( srur(rpno0opxn oeiys a ranvo u0aexoxr3tytfp ran ol()t2to(rpiudllt mfvil() Dtruro;o0apx  o3ildfa2umumsnu)aleoio iy1opD  uvi t0srur(mpiydlm  mnvi tf 2taurpot1olxoifcild mDra(von(0trerif3oy1fmtr neilt0trxo(rpny1opeelnct s srtrurpnt4ole mo3tlt sDua( s;() ltomr3iytoa  aivolt)s2xr(opny1ame  neiltf rurump;o1alxoifeiysla ran s;u0artnxo3ty1fateln olt0 2tr(r3nodll elnetas sDta( p;u1texn ieiasfmDum(vo;u4 etomo3ootfm r uvolt  2xoim3nu4am n nci sf Durur no1alt  ieilt s ea(vs (0 renmrcia1oat livilt0s2trimpio4ol elnet sfs2trxmpnt4tpt ioetytlm2elu s;u4trxrxo3tatfpDeai o;t t2umim3iydope lictasfsDtmump;o1opxnmietytfa elnvsnt)alermf oatfmDrlues (0 2xoxm iu4lltnmfvt t sDrr(rp;o4aptn ieiltlaDrl(mo t)arxrmo3oatomtrlnei;t)tetoxo no4lp  mfcsl(fartrumpot4tlt mieiysfm2umnms t)trxnio3iy1fmtelnvi (0teur(opiydop nlncs t aDra( o;u4tetomo3iyt aDuauvp;u0 rtnmr totfmt auvo ()srur(r iodllt lfviatfsrrm( p;u0apto o3iasfm rln sn(4aexrir oytlpt  nes;s0t2umxo3oy4omt  ict s)a2raumpot0oet moetat m uluvpn(4 rxnmoctadlaDr i i;(  2xm(mpiu4lmtn iet t aruaum no0alx iictltla em(vpnt0arerifctydfmDeaieo;t)srtrio ny4lpe lfetlt aDtmu  nu0tet iieiydfs rmuvpn() eermr io1fmDr i s;()setoir iu1lle licilt)a2taurp;u1ope  iciad a2ra(mp t4trenir ty1lmtrai o s0 rumimpiu1al n nvs s  Duauro;u4alxniieiydlmDrauvsnt)texnxfctatopDelies;t) ruo(r iy4lmeelivsat  2rm(mpou4optnmo3tysls umump u0aeeomoctatopDeanes;()srxoio3nu4op elnvsl(  rta(rono0tlxnmfciasfs2rl(vs ()aeeoxf3iydoa   n s (0teurirpiy4lmenliviatfaruau ont4tpenmi3ildlm2rln s;u0trerifcia1la   iesl(0 exoimpoo4ol emfvsat) 2umx  nu1tpt iietatfm2ean s (4 eeomrciadfa r n o;( srtrimpno4omt lnvi s)a2rr(ro;t1ope  fetyd m2eau snt4 lermrcio1lm  auvs ()t2uoxr3nodamtn iviat)arrmxm ou0openioetad a2ulu pn(4 eenif3io1fptranvo;(0 2umio nydoleelict sfsDrmxm ;t1apeoio3iad a eln on(0 rerxo tydfpDrlivs s)srtoirpno4llt mivt s s2urxmont0tetnmoeildfa2ua(mp t) exomo3tadfpD  iei t) 2urxo nodllt mfes s)arur(  nt0openifeils mDranvsnt4 exnmr3totlp rlu s;s0 2xrim oo4am e nes s  Drmuronu0aetomo3iad a rl(mp;u) lenxocootfmtelnvo;t truo(r3nu1aptn nesas srrrx  nu1alto oeild a2el( on(4 eerxr3tydfmDean o s) 2urxm3no1oltnmfetat)srrr(m nt1tptn ictatfmDrmnmpnt4trenir oadfpD lnvi t0srtmxmpio4lm nmivtlt) 2rmur ot0opeo oeiad m ulumont4arxoxr3ia1lm elneo s s2tr(rpny1ame mfes ( sDrr( o;t4olenmfctadla eanmp;(4aeeoxo3ootla   i sl( sexoiopnydalen nesasfs2urumont4aptoiiciltlsDrmuvp;(4tetrxfciotomD  neo () exmxmpiudll  lici ()aDrru p;o0tleoiiciatlm2ranmo u)trerio3iotlp eaueolt0trtoiopno4lp n ncia(faDrmx ont1opx iiciytla2rl(vs t4artrmrctydlptraieol()srxmxo nudllen net tf 2raur no4tee mocias aDuauvo ()aexnif oatlm e ieol(0t2trxr oydoltemiesas  rtm(rooo0olxomoeiatlm umums;t)trtnxfcoadfmteluei s)t2urxmpiydlltn ies t  rtm(r ;t1tlx ii3iatfs2elumo (4texoxf3ootfaDeaueils0 2trxopno1op  mncs t)aDrrxro;o0oeenmieiytlmDel(mp;(4alxrmfcoy1fm rlnei;()trtr(opnu4al n ncias sDraxrp;u0oetn ociatlm2rlnvs (0aexoif tytfat aueol() 2xmxm3ny1lme lnci tfaDurum ;o4opeoiictls aDua(mo u0trtnmo iydom rlivo t texm(o iu4llt  icsa()sDumuroot4oleoifciyd mDra( s t0 reoxfcoytlmDeauvi;t0 2xo(m3ou4ale mies s)sruau o;t4ole iietasfa ulnmpnt0 renxoctotop  anvs;t t2uo(o nudoltelneia()sDuaxmpnt0olt  fciys s eau ont0 ltnmr3io1op eanvi;s)srtmxo no1omtelneia() 2ururooo4alxn ieiyd m2ra(vo t4arerxf3todfate u s;(0t2uo(r3ou1ll  lnvi s  rrax  ;t0opt mfciltfa2rl(vs t0texomf3io1optelues;( srxmxm io1am e nvtltfsrum(r nu0tet mfetydls rmnvs u0 rxomo3tytfmDe i o;( trumir iu4open ictas)arrrur nt1aetnmo3tyslmDranvsn() etoxr oy1fpt ln o (0s2xmxmpnu4am nmivi tfsDurxm oo4tlx mietld a2uluvpnu)teeoircoatomDraivs s s2toiopno1lpenlnctl()arrrxm no0aeeoifctysfa2rmumpnt)teenxf todfm e uvo;t srxrxm ou4llen nvtlt srrrur ;o0aexn ietls aDel(vp u)arxnxf3oa1fa e ies;s0srto(m iy4om elnct sfs2trx ont1oetnmociydfa rmn p u4 lxoifcootfmDrai i s) exoxm3nudoltelics t  ruaxrp;t0tet iietyd m umnvo u0aeenir3ia1lpt  nes;( t2urio oudom n ieil(f 2rr(r oo4optoiociatlmDea( o;t0artnxr iatfpte ies ()s2xm(r no1lp elneslt srtmxrono1optomieiyd s rmu snu4aetoxo3tadoa   nvils0 2xrim ny4omteliet () rrmu p;u0ope  f3tytlm2ua(vs;u0 etomrctytfmte ivs;s srxm(mpoo1oltn fetltfaDua(mp;u1apeomictld aDem( p (4 ltomr oadlmtelnvs (0s2xrimpiy4lme  ivta(  rtaxmpnu1teeo ieias a ul( o;(4 rtrmrcootom  aneols srxo(rpio4amtelfei t  2uaxrooo1tltnmo3iadla um(vo;u0tlxoxf3oadfmt  ues;s  rxo(opnudal   ieia( s2urxr ou0tpe ii3iadlm2rl(mont0trerxr totlat  uvsls t2trim3nu1ol nmnes (f Dumum nt4aetn o3ilt a rmn s;u)areoxr3tydfat livs s0srxrim nu1ap nmnei t)srtaumont0optoioetyd m2ranvs u0 lxrio oydfpD anvilt) eum(o oydamtemncilsfs2umurp;t0apeomfciad s emuvs u) rerxo3oa1om e n ilt setmirpou4omtnmiciasfaDraur ;o4tpen f3iyt s2ua( sn(0tetoxf iotlm e ies;s0t2xmir io4al e nvsasf 2tau pnt1tlx mi3tyslaDumu s;t4trenmr3oadop  luvslt  2xmxo3oo1oleelfvtat aDra(r no0opx ifcilslmDua(vp u0arxoio3oy1omDr ivo ()seuoirpio1aptn fvtat) 2umx  ;u0ope  fctyd a raumsn(4texnxo iatop rli s;s  etr(r3ou4al nliesa(  Drax oot0apxo i3iydfa ua(vpnu0 rxnmf oatfmDr ues t  2xoim3ny4lme lnetlsfs2tmx o;t0opxoiiciydfm rm(mo;t0 eeomo oodlatranes (  etoxr3oo1lmtemfvt sfs2ua( o;t1oexo i3iys s um( p t4tetrxocoatlpt aues ( tetrxrpio4opt lncilt)sDta(r ;o4apxnmi3ildlm umuvs ()alxnmfctadlpDr uvi;t) 2to(rpoo4ame liviat arum(ro;o1altoiiciasfa rln o t) lxrmr to1fate u slt)s2xm(opiu1lpenmnet s) Dum(r ou0olxnif3tlt s2em(ms;u) rtnif todfmtr nvs (0s2to(m3ny4lptn nctas) 2rmxro;o1aet  ieiydfsDran s;u0aetrmf oydlp eliei;( teuoir nu4amtemfctat) Dta( o;u4aeeniieiasls2rlu p t4 ltnxoctodoaDe i i;() euoio3oodopt mfvtas)srrmuro;u0altn ietlt mDem(vo;u) rtrmrciodlp e neo s t2trio3nydlme lfvs (f rrmx p;u4aetn o3iyt m2rln o;u4 reoxf3oytoa e iei;t s2toirpno4lmtnmfvta(fsDrm( pou4oexnmf3ilt s2um( s u0areoxf oa1oa rli s ( t2tm(opoydom e nvtas arum(mpou1tlxnmfeiytlmDem(vo (4 exnmo3oatlp r nvsl() etmio3ny1olen ietat)artr(mo;u1aleniiciasfm2uanmo;t)tlenxr oy1oaDr nvs s t2xo(m3nudllt  fctat  Dra( p;t1optomo3tld aDuanmon() ltomr oadomDranes (  2uoir oo1ole lfctls)sDuaxmoot4olxoiieilt sDemn o;t4texnmoctodomtrlnvolt  rumimpiudlmtelnvsls sDtmxr ot0alt mf3iyt aDem( p t4alxoxfcia1fm r i o;t)t2trio iu4amenlnvs ()a2trum nt0tlenmf3iydls rau on(0trerxrcia1oa  li i;(  rxm(rpnu1llen feta( s2rm(  nt4olxo ictltfs2rauvpnt4aleoxo3oodomt  uei ( trto(m3nudalenmfeia( sDuaxro;o0tpeoiictlsls2ean o;u0trxnxociodopD  uvslt) rxrir oo4open fvs s  2rrxro;u0tex  o3iatlaDemnmo () lenmf iydop eaies s trxmio oydopt lics t  2urum oo0apeo fciytlaDrl(mp;u0aexoxoctadla  lies t)srxrxmpiudamtemnei ()srtm(ro;o4apx  f3tasfm2uauvo u4tetnmfciy1omDe n sl( trxm(o3iudom emiciat) 2ua(rpou1alxnif3ildlmDul(vp t4aetoirciytlatr i o t) rxoim oo4lme lnviat s2uaurp;t1aptomociat m2ua(von()texnmf3ta1oat anvi;()t2tr(m3iudale  ncsa( a2ur(m ot1ape mf3iyt a2rlnmp (0tlerio3oatopDrluvi;(0srtrir3no4apte ies tf Drax pou0aetoioetatlmDeaump;t0 rxnxf ty1fmDeln ils0setm(mpoudamenlfcil()a2rr(mooo0ope iociytla emnvp u4aexrifciadfateli i s trtoio iy4lptnliesa() Dumxm nt0aet  ieiaslmDul(msn() exrmfcio1lmDranvsl( setmir io4altn ics (farraumpou0texnmocias m2ul(mp;(0altoxf3oytlp   uvs ( s2xoxm3iudap elfvt () Duax o;o1tlx miciasfs uanvp u)altnmr3oytlatraneo;(  rxr(rpnudlpenlfctatf Drmxrooo0olxn fctatfm2rmuvpnt)trerxrcoodfp   n s;s s2umxr iu4ll nmnesltfs2um(moot1tlxoio3tld a2ulnmpnu4 eeomf3todfm  an o;()s2toio nydome livils) Dumump;o1opt  octys m2rluvs;t4alermf to1opDrlnvol()trxr(m nu1amen ncsatf 2rm( o;u1oltn ictydfa2rm( o t0 rxoio tytop rlnvi;t s2xoxr3oydlpe lncils  2umx onu1aexn f3iasla2ulnvsnt4aexnmocia1lp  aneo t0t2toio3oudaltn fvtlt  Drmxmo;u4aetomoeiltlmDrl(vo ()tltnmrctytop rauei;() 2xmio oudlp nmics (f Dua(rp;u4aeen i3iadlsDemuvpnt4artomo3iadoaDeli ils0 rxoio3nydal n icsas  Duau p;o1aexomfciad s uanvs t)artrxfcty1oa elnvi;(0truoio io1aptnlicsatf rtaxm no4tltnifetys sDrmn o;t) eermo oy1fm   nvslt setrxm3io4lp elfcsl(  2raxmooo0olx ifciyd a ra(ms;t0 lxomo io1fmtean s;(0t2um(opoo1oltelnetlsf rrm(r nu4apeoii3iys s2rluvp u)texnmf ootoptr nvo (0 euoio3iy1apenlfcil() Dtaxro;u1olt io3ils mDrlnms u)aexrmr oy1oatrai i ( t2um(r iu1al n nct s) Duaumpoo0opto oetatfaDemu o t0 exoifciy1laD li o s)s2um(m3nu4opt lfcsl()aDra(r ou4oetn oeiadfs ul(von()aeeomoctotlaDe neo (0 ruo(m ny1ol  lieils)aDta( o;u1tpeo ociysfmDrlnms;u4tlxoxf3tytlptrau i (0 2uoxo oudope lnesas s2taur no1tee mocils aDuln snu4 ltrxf ty1lpt  ivi;s0 2xr(mpiy4lmenmnvils aDrm( p;t1alxoif3iys mDul(vo;u4aexnmo3oodomD auesls)srum(mpnudlm eliet ( arua(rooo1ope mo3iysfmDea(vp u4tlxnif3iatla e i o;(  2trxmpnodam emfctls)sDrauront0teeomiciyd sDran pnu)trxrxo oy1lp  ai i;s t2um(m3nydam  livs s s2rmur ;u0tlenioeils mDrau o;t4altoir3iodopt lnvs;t0trtoir3nodlpeemfct s)sDtmum no1oexo oeilt s eanvpn()altrxr3iatop e ies;()srum(o nu4amt  icilsfarrmxm ;t4opt io3iysfs rm( pnu)artnif oa1fa  luvolt seto(mpou4omtn ies s) rururono1tlt  iciydlm2uln ont4tlxrmo3ootfm rlues t  eumirpoodlmee nvs s)sDtm(m ou1altoioetatlsDemn s;t0aleoxo3iydfp eauvol()truo(rpno4amenlfcils) 2rrxronu0aptoioetys mDul(mo t0alenmr tadlm  aues;()s2xo(o3no4lp   ies ()s2tax ono4tlx ioctys s2rmnmpnt)tetnmf3oatfpDe u i;t0trur(r io1ol nliesatfs2rrxr no1apxomieiatlmDeau ont)arxrxr3oy1fa rlu sl() ruo(m oudop nlivt ( sDumxr nt0tpenifetyslsDem(vonu) eenxf ta1opD aueo;s0 2xriopoo1lp  mfctl()s2tmxmpno4tpx ioeiatfmDulu pn(4aexoxfcta1fatraies t0seto(rpnodlp   icil(  rtmu  nt0tpen icild s2emu ont4arenirciatla raueslt srtr(opoydlmt mnvi (fa2taur ou4oeenmo3tad aDelnms t4texomfciydoaD  u o;( srtoim nudole  feiasfa2raurooo0tpen feiatfm2emumo (4artrmr3iydfmt  ies;t0s2xmxo3ny1ape mnctl() rrr(r ou1tpt ifciydfaDea(mo t) exrmf oytfaDelneo t0 exm(rpny1llee icsatfartaur ou0aptnio3ilt a2um( sn() eenmfcoa1oa e nes t truoiopou4lltnmfvslsf Drru ooo4oex ii3tldfa2rmnmo () reoif3ty1lpt li ol(0setm(m3nu1opte fvtls)sDtmxrp;o0aptoiietadfm rau pnu)artomf oatfpD anesl()teuo(m ou1ale licslt aDrr(rpnu4tlt moeilslaDrm( on(0trxoir3totfmtrli ols0 rxoir3iy1amtemfct sfsrua( oot4oeen f3tys s2rl(vp t)trtrxo ty1laDran o;()t2xoir3iydop emfesa( s2tax  ;t1alto i3iytfaDemn p (4tlxrmfcootlmDeau ilt0t2urxo ou4ap nlfvs s) Drax oou4aexnioeiasfsDuluvs;t4trenmfcoytom rlnei ()texrxopoo4am nlnesl()a2rmu oou0tpen o3iydfa elu p (4 rtnxrcty1fmDeaivsls0 etoxmpnudomtemfcsatfartaumpno4apen fcildlm2umu o t) renircoytfaDrai s t trtrxrpno1lm nmietl(f ruru p;t1tleomietytfsDul( pnu4 leoirctadfmt  neilt sruoxmpiu1altemict t sDuaxmp;o0oee moctys mDean sn()artrifciydop  auvols s2xr(opoo4apt mnei s)a2rrurpou0apxn ociytfmDrau p;u) eeoxr3oatlatr uvi;(0s2urim3ny1lpe lfvia()srtaxr ot4apx mfctatlm2ra(vonu) etnmr oytfa eln ilt0sexoxr nu1llee fcia(faDrau o;o4apx  fciltfaDel(mp;t)teenmo iytop  aneslt trxriopiy4ll emncilt) rumu p;u4aexoii3iytlm2uaumo (4arenif3oy1oa rlneo (0srumxm3oydlm   nvi s) 2rmxro;o0oet mf3iadfmDrau s u0 leomr3iatoptrli i;() euo(r no1openmnvsas) rrrxmono4alxn oetldfaDeluvsnu4aetnxfctytfmt ai i;()teum(r3ny4omte feia(fsDrr( pou1alx mo3iltla2rmums t0aexrxociydfaD  ieil() eumir3io1op  mieiatfsDrauroot1tle ioeiyslmDranvp t)tlxoiocoodfmteaies s0seumim3no4optemfei t sDumxmont4apenioetlt m2uau s;t) ltnmr tytfa rln i t  rxoio3iy4alt livtl()srtm(m ;t1olto fciyslaDemn o;u) lenirctotfp rauvo (  euoir nudllte ieiat)sDrmxrpou1aee if3ias s2ul( o;(4 exrio oy1omDr ues;s  exmir3iy1lmee netls)sDtrurp;u1tpxoifciaslaDul(ms u) lxriociy1fatrau s (0t2tmxo3iu1am   nes tfarra( oou4optn ociadls emu s t0arxoxoctadop rauei;s t2xoir3oo4apt  nvs (fa2rmxr no0teeo oeiyd a2ua(vsnt0artnmfcta1omD ln il( srurio ny1amt lnetas arrmum oo0aeeo ociat a rmn p;(0 eenxocoo1fat aneo;s tetmxr iy1ame livta( srurx p;t4apxniociydla ean ont)teenio iy1fptranei;s)texoio iu1al n ivi sfsrtmum ot4oeeoiiciydfa2ra(mo u)trerxf oydfaD auvs;s sexmxrpou1lltemivs ( s2uaxmpnu1texnioctatla uau s;(4 rtrio oo1fa   neo t s2tmim ny1lme lieilt a2tmxm ;t0tpx moetyslm emumo;u4aexrio iadlmDraneo () exmxrpnydape lfvslt) Dtrurpnu1tex ii3tadfa rau s;t0 eenxf3tydlmD au olt0texrirpou1lm  mnes s srtrur no4oexnmfeiltlsDumumsnu0trxomf iytom e uvs s)s2xmxopoy4omen iviat)a2tm( pou0openifeiysfaDuln p ()aexomrctadfpDeli s s  euoim oo4lme  fetl(fsDtau  nt4optn i3tytlm2umn p (4 lenif iy1fatrli ils t2umiopoy1ope  neil()arrm( onu0opx moetas a uauvs;u4arxomrciodlpDe neils sexo(o3oy4amt mfvtlsfa2raxronu4tlenmiciltfmDrmnvs;() rtriocoydlmt  i i;t) 2toir3iy4olen ncsls) rtaxmooo4aleomicild a2ul( pn(4trxrxfcootop  lneol( setr(m nudoltnmfetltfaDraurpou0olen o3tadfm2uau p t) renmf tydfate neils0 2xoir iu4ame  ivil(f Dtaur ;o4alx  i3taslm raump (0alxoircoy1fm r ivolt s2tm(o3iy4olen nei t srur( p;u0oexn ieiyt a eau o (0 exrmocio1lptrliesls)trtoiopno4lp nmfvtl(f 2taur ou0tpx mietatla2ulu s (0alxnmr oatfp  aieolt0 eumimpny4aptelfcia()a2taxr ;u0tpen f3iyd s2rl(mp;(0alxnxrciadfaD auvo () rumxo ou1openlieiat) Dum(r ;t0tpx mfcias aDumuvsnu0trxnio3oy1oa elieo;t0s2xm(o no1ll emiei ( aDra( ooo1olxomocils a2eanvpn()alxoiociotomtr neo s sexoxr3oydoltnlneta() rtmurono0oex mi3iytfaDumnvs ()trtomocoydfptraues t seurxr iydam  lfvils) rtauro;u0tptn f3iydfa2ulnvp;(4 etomocoydoateluei s0texrxm3oodam e nvsa( a2uru  nu1aleomi3iytla emn p;t)tltnmo ia1lmt  nes;(  rxmirpoy1lm nmnetls a2urx pot4oeenifeiatfs2emumo t) rtoifcio1la eai s ()srxrxmpno4om nmivtasf Drm(  nt1aexomoetydls uauvpnu0tltoiocoydopD lu ol(0tetm(opno4apeemnvtas) rta( p;o1apxn octys a2um(vo (4 etnxr3tatopDe uvi s srxoio nu4apenmnvia(f Dtm(  oo0tpen fcilsfm2emn s u4aexoxo3iydoa r i sl()sexr(r ny1om nlnvsl()srtmxm ;u0ale mf3iatlm emnms;t4artrir3ty1lptr ieslt  exm(m nudop  lfctas a2rr(r ;o4ale  i3tltfm uanmo u) rtoioctydlmt auvo s0 rurxmpiy4amenlieilt)arumxm ;o0oet if3tatlm eaums ()aexrmf3ootfaDr u i;( sruoio3iydlp  licta() Drmxrpnt0tex mf3iltfm ra(vsnu4 etomr3iatlaDr n slt0 2xmim3nu1am elivilt) 2rrur ;u1aeeo o3ild aDrm( pnu4 eenmociadoa  auesl(  2tmxm3no4oltnmfvtls)aDra(r ;u1alx  ociyslaDeaumo;()texrioctodop eai s;s0setmxrpoy4ap nlfcsa() Duaum ;o0aptomfctatfm2ea(vp;u0 etoxr3ootoaDe ieo;t0 rtoxm3nu4oltnlfet ( arumum oo4oexomfciltls2rmn o;t0aeermo3oytfmt livil(0s2tmxm oo4ol emnvta()aDumxmp;o4altoif3tas a2ua(vpnt)trerxrciatfaD anei;t) 2xoiopny1om n ncils  2ta(ro;u0oex  f3iasfmDrlump u0alxoiocoodomDrlivo (0seuo(o3no1ll nlfvia(fsrurxm oo4tpe mi3tys sDeau s () lenxf iadlpDeaiesl(  2toxo nydoltelnci tfa2tmxmp;u4opeo octytlm2rl(mo;t) ltrxo3iytlpD aiesls)srurxr iodapenlnes ()s2uau pnt0tltnmociyt a ua(mp;t4tlermo3todop eln o;t0 rxmxo3ny1al  lnetl(  Duaxmpot1oex if3iydfs uln o (4tltnircio1lpDelieo;(0 rtoxm3iydop   fcslt)s2rruro;o4oltomietatfs rm(mo;u4teerxo3oo1oaDe ueols  rtoxrpio4aptelnciasfaDtrxmoou4tex mietydls2rmn p (0aetomf3to1laD lu s s t2ur(r nodlm emfvi t)sDum(m ;o4aetomi3ilsfa elnmsnu4trxrxrciotlm e ivil()srto(o no4al  mncs t aDra(mont4oeen fciytfm um(vo;t0aetomocto1fa  anei ( trxrirpou1ap  mfeia()arua(m ;t1tlto oeilslm2ua(msnu0trtrif tatoaD aies;s)t2urxrpnudopeemict s  Dur(rp;u0aeeo fetysla2ulums;u0 ltoircta1lm rli i;s  2trxm nu4lm elfcs tf 2tmu pot1olen oeiasfm rm( s;(4arxnxocoytfaDrliei;s0 euoim iy4am  lnetas) Dtmxr nu0tpxnif3iyd s2rmnmont4 ltrmr3iadfaDraivslt trurim3nudllt lfcia(fs2uau ont0optnmiciad m el(mo u0 exrmr iytopDraues t s2xm(r3ny4opt lnesa( artrxro;t1tetoioetadla2emnvsnt)aexrir oodlaD lneils sexoxr ny4alenmnetas) 2tr(monu1oexomoetatlaDuln p u0aeeomfciatop e uvo;( seuoxm3ou4aptemncias artm( pno0openmfctldla ra( o;u0tlxrmf io1fmDr i ols t2tmio3oodomtelivta(f Dtrxr nt0olxn o3iys aDuauvs u) exrxr todfaD aneo s)s2tr(m3iu1lm  mnetls)arraxrpou0oet ii3tat aDua(mon(4 exrxfcoo1fatr nes;( trxoxo ny1lme mfvt (fa2taurp;t1apxomfetys s ulnms;t) rermf iodoa  aiei;()t2tmim iodal e ieilt)s2rmx pou0tpx iiciys sDul(mo;()texoxr ta1opDeaivolt srtmir iy1omeemnvsa() 2rax  nu4altniieiysfaDua(mo;u)arxrif tadlmDr nvilt0s2trxo ny1am  mnvsl()sDua(mpou4oeto f3ias s rmnvs;u) rermociadlmtelieol(0 eumimpnudope lfesatfsrtrxr nu0ale iictyd aDrm(mp;u0 etnir oo1faDr i i t trxmxr oy1omt mivs tf 2umumoot1oexoii3iltfs2uanvs;u)trtomo3iy1oaD  ies;( t2xrio iu1llenmfcsas srrr(  no1teeo fcilsls2ulnmsn(0altrxf tytoptelueil()trxr(o oy4omtn nctat aDrrur no4apxomfeiat sDua(mo;u4aeerxrciydlaD  ueols0 rtoxmpoudlmtnlfet t  2um(r ou1apx iociatfaDrln pnu)aeenifctadfpD  i o;s0tetrxopio4ol emicta(fa2ua(rp;t1alx mfctltlsDemnvs t0alxoxo3iytoptraues s) etrxr oy4omeelivsa(fs2taxm no1tle miciysfm rlumo;u)arerxocty1fa rlu i s trxmxmpnudlpee fvils srraumpoo0oetnifcils a2eluvo t0arxniocia1fptraivo;(0 rxrxrpoo1lme lncilsf Dumxrpno1tet if3tlt aDulnvsn(4 rtoir3ootoa e u i ( s2xrxm3io4apt lncsatfa2uax  oo4tpxoifeilsfaDrlnvo;()alxrmr oodfmt aieil()srto(rpny1am elics t  2ta(r ot1ale miciasfmDrlumon(0tlxnmo oa1oa r ues;s0 2xrirpny4amtnlict sfa2raxm oo1tlxn ictys s rl(mp;t4tlxnmf iy1la rlivsls0 ruoxr oudam elnei s) 2tm(r ;o0olenmfeiytlmDrluvs;(0trenif3ty1oateluvil(  rur(opiy1ap n fvia( sDrr( o;o0oexo fetltfsDrlnvo t0tltrxf3ia1oatrlieol( srxoxr3iudlp emneils  Dum( pno0oexo feiydls2rm(von()altrxf3totlmDeaivo s0 ruoio ny1oltnlivi (  Dumur ou0tlx ioeiadfs rm(ms;(0tltoir3oo1fmtranes;(0tetoxrpno1omee ncsa()srtaumpoo0apxo ictytlm umn pnt) ltnmr iytfaDeluei s)trxmio nu4op   iciat)aDtru  ou4opxn icildla2umn sn(0 rxnxo iodlateaneo s) 2xmxm3ou4ap  mfctas sDta(r nu1alxoiieiytla2rln o u)tlenxo3iytopt anes;(0s2tr(m3no4llee ivsas aDtrxm no4tlxnio3iytla2el(mon() rtoxrcoadoaDrlueo;s0 2xr(o no4ll elnvtatf Dtm(ront0aee iieiysfmDrmn p u0tltrio3tadlpteli i;s0 rxmxo io1am   ieil(  Dua( p;u1olenmo3tlsfa emnvs t)tlenmf ty1lmDrlnes;(0srtr(r ny1oltnlnvtls)arur(  nu0apxn o3tltla rln o;u) ltoxr oatfmtelu sls0s2toxmpiu4ll  lieil(  2umur nt1oeenmo3ilsla2ua(vs u) lermr iotfmDeln sl(0 etr(mpny1amenlfeias aDtru  no1tlenmietytfa rlu p u4tltnxr3io1fp r ieo ()texmimpiudamenmnesl(  2ta(m ;t4tle ioeilt s um( o;t0treoir3ta1faDeli o;( t2uo(rpiydllt livil(fsDum(mpnt0altn f3taslsDuau o u)trxnxo oytlp r nes;(  rxoio nu1ol   ncta(  2tr(m ou0alxn iciadls ulums t0 etrxo3tydfpD lieslt)tetr(o iudamee ncs s a2rm( pno0alx  ieiytlmDem( o;t)teenmo3ia1oate nes t0trum(opny1lltelfesas artaurpnt0alxn f3iys s2umn snt) lenxf3tadop e nvil()trtmxo nu4ap   nvs ( aDuaxroot0tlt moeiytfm emnvp u)aeerxf3iydfpt lueilt0s2ur(m iodaltnlnvs s  2ua(rpnu0tlt if3ias m elums u0 eeomfcta1late uei t)s2ur(r iodomtemfvi tfsrtm(mpnt0tlx ifctydlaDrl(vs;u4 ltnxf3tadop eli o (0 euoim3no4om   neias aDumxm ;u4oexnmf3tlsfaDuaums (4 eeomr3tatom r u s;(  ruoirpoodlmen netas)artr(m nu0tpeomieiasls ulnmp;t)trtoxr iotlpDeaneslt0 eur(m3io1ole lfet s) rumum oo0texo feiydlmDrmu o;u) etnmr3oatlatr i o () rtrxm oydlpe  fctat) ruaxr ;u4alt mfeiadfs ean s;u4 rxnxr todomDeli olt0setoxr3iydlpe lici s artmumpnt4tlt  f3tltfa elu sn(4aexrir iotfmtrai olt  2trxo ou1op   nesasfsruax ono4ope iieiltlsDuanvs ()alxomf3ootfp eau o ( teuoio oudoptnmfcs (fsDtmumpoo0ope ii3iltla2eaums;u0aetnir iotfa eli il( texo(m oo1lm elnetltf 2truronu0tlt  fciyslm2rlums;u)aetnmo3io1oatr nvs s0s2toxrpnodapenmfetat)s2umxm no4oetomi3ildfm emuvo t0artnmocoo1fa e uvi s  eumxm oo1omtemiei sf Drau  ot0oexn feiydfaDrl(vo;t0alxnxf iydopDelu il(  2urirpny4llt  nvtlt aDrr(r no0tlto o3ildlm rauvo (4 rxrxr3oo1lat ai s;t0 rum(m3nydomtelies tfsDumurooo4tee iociasfs ranvo;t)arenir3iotfpDrlivo s0s2xm(o3iy4ll  mnctlsf Durx poo1teenifetldfs ra(mp;() lxoxr iatomteaieols  rur(m io1lme  nci ()aDra(  nt4alx mociyt m em(vs;t0 lxnmfcoa1fp rluvi t)seumxr3nu1ameemfcsa(farum(r ot1altoioetyd a umn o;t) lxnio oatfa  luvo t)s2xmxr iy1lmenlicslsf rua(moot1tlt  iciyt aDemumsnt4areoxf tytfptrlies;(0 exmxmpny4omt  fvsltf rraxm ot0oexnioetyt m emnms;t0trenir3ia1fpDe ieo;s  exmir oy1ol  mivt tf rtr(ro;t0opt ifciydlmDumuvo;(0trxomrctodlm elueo s  2to(rpoodaleelieiatfarrau  nt0tptnifciaslm uaums;(0tlerif oatlm r ieolt0sexm(r3nu4amenlfci ()aDrmu poo4oeenmiciaslmDumnvo u)arerxo iatlp  lnei t setmxm3oo4lpenmfcia() Dum(mp;o0tlxoioctadls ra(mpn() exnxo tydlpt an o s trtrxr3ou4llt  ieias)sDra( p;t4optoifciltfa2uanvont4arxoxf iy1om eln o t trtoimpiu1am nlncsas  rur(m ;t0tlt  i3iltla2rm(mp;t4arxnmfctytfa  auei s0teurxo ou1ap elivt s)aDurxmpnt1opto ietasfa2uluvo u0 lxnio3iytlm r neilt0t2umiopio1oltemncsls)arurumooo4aeen i3ildfm uanms t)trxoio tytopt aivol()s2xo(o no4lltelivias a2uru pou4aptoiociatla eau pnu0 rermf3to1fmtrlnvi;s) rum(m3iodol emncils) Dtm(roou4opt  f3ias s2em( onu)altoif3oo1latrai s t t2tr(r3oy4aleemiviat)a2rmu pnt1aex mf3iysla rlnvs;t0trtnxociydlp r ivsls0setoiopiodap emnci ( srrr(ronu1olxn feiyd s ua( pn(0 rtnmf3oydoatelneo;s  2xmim nu1lptelfvsat)s2uauro;o1oex mfciasfs elnmon()arxrir iodomtr uvo;(0t2toxmpio4optnlfvta(f Dtmur nt4opeo i3iysfs2rmu pnu0trxrxo iytlmtrai il() 2um(r oy1lmtnlici t)a2trxmp;u4tlt mfcilslm ea( pnu4 lenif3iodom  aueolt  etriopnu4omtnlivslt) 2ur( p;t1texniociasfsDuan s u0 lxnmr3iy1fa e nvsl( tetm(mpou1om e icsl(faDur(m oo0olxoii3ils a ulu on(0 eeomo oatlat li ol(0 euoiopno1alt mfcsls srrr(ront4optnmfciys aDumumo;(0aexrxf iy1fpDelueols t2trim3oo1omen nctl()artaxmpot4alt mociytfs rm(mpnu0arenio3ootla  anvils0 exmxopiu1lp   fcilt sDumu ont0oee  ieiasfaDuau p;(0tetnxrcoo1lmte u i;t) ruo(r3oo4lptnmfvilt s2uaump;o1tex iiciadls raump;u4artoxf3oatfpDeau s () rtmxr io1ol n fvi ()aDuaxrpno0tpxomfeiysla2ea( o ()aexrxr ta1fpD  i i ()trxr(o3nydom elicias aDum(  ;u4ale  feiytfa ra(vs;(4aetnif iy1oaDrau o;() etr(mpiodlpenmies tf Dua( ooo0aetn i3tadls rauvpnu0tltnxr ty1fateauei;s0trtoir oo4ol n ici ()srur( o;t4opx if3iltlaDul( s u0aexoif tadoat livi;t teuo(opny4ope lfetl(f Dtr(r oo4alt mfciltfmDuanvo;u0 lxrxocoatoaDeau o ()tetoxr iy1lpe mnvtasfaDrrumont1tpenioetyslaDrluvs u)tetrirctotfpDe nes;t setm(rpiodlmt mfcilt s2um(rpnt0apxomfeiys m rmu o;() renxf3io1fmD au o t seur(r oodam  mncia()s2urumpou0teenifciltla2um( o t4artnxr3tadfmDraivol(0 2tm(m3nydlpe mictlt)aDtm( onu1olx  fctatla2el(mpnu4tlxoir3tytoaD aueols0s2xm(r3io4om e icsas  2rrxront4ole if3ilt a2emnmsnt)tlxnif tatlmt lnvsl() rxoimpiydapen ivsas) rta(mpnu1tleo octldla2rmnvs;t4 leoxo ta1lpDeaies (  2toxr3nudopee fvtl( s2trxmonu4tleo oeilt m2eauvpnt0 lxrxf3ta1latrln i () ruoio3nydopte fvils)s2rr( o;t0aeen icildfa2rl( s t4alxrxociotlmteaneo;t0srurxr3io1lmenlietas a2ta(rp;u4oltnmfcildfmDem(vsnt) lxnmo3iatfm r neo s0t2uoirpny1optn nviatf Duaurpou4ope  fctaslsDeaums (4trxomo ia1fat  nvs t0t2toxo3nu4lm nlfctat) Dumumont0tpx  i3tlt aDul(mp (0 rtnxf3tadoa eli il(  etrxm3ny1am   fctas)arra( ont0oetnmoeilsfm2eanvpnu4treomo iydlmtr neolt trtoimpno4amt mfesas arraxmpou4tleomi3taslaDumnvs u)trenxrciy1fm e uvo t s2tmim3io4op emfcsatfs2umumoot0apen fetat mDrau pn(0trxnxf3to1lmDe uvols trurio3oydal  livilt sDur(rp;o0opx  iciytlmDrlu o u)trerxf totfat  nei t0 rxm(opoodape lneiat)aDtmurpnt4teenifciad m rmums u4 lenmfcta1fp r u o;(0 rtoio ou1oltnmiei (  2uaum oo4tltoii3tysla uan pn(4artoifctodlmt  neilt0trtoxo3ny1ap nmfvslsf rumuront1oltomoctatfaDea( p t4tltnxf3totla r ieo;s0 ruoxo ny1oltemneil()aDraump;o1opt iiciatfa elnms t)teenxf ia1oa elnei;() 2xo(r ou4al  mnet ()aDur(m ou4opx  ieildfsDra( p;t) rxomocia1fptrai i ( srxrirpoydamt  fesas)srta( pnt1olx io3iysfa2em( p u4alxoxo3todlaDr nes t trtmxmpoo4lptn nct () 2rau oot0aptn f3tltls eanmpn() leoxr tydfateaivils teuo(opno4ll   fvsa()a2ur(rp;o4tlx ioeiatlm elu on(0 rtrio oydla eai o t s2xrxmpno4ll  mieia() rrm(ro;o0oltn iciltfmDrmnmp t0aetrif oodfm eau slt t2trxrpio4lltelnctatfaDumuro;t0tetnmoctatla ulnvs u4 eeoif to1om elueo s)teuoxrpiudom e ictltfaDtaurpot1oltoioeiytls ranvpnt)tetomfcoa1laDr neolt)s2tm(r3ny4open fetlt a2ur( o;o0aeenioetytlm rm(vp;() etrxfctydlatrlnvo t trxm(mpiodlpeelncs () Drru pou0teto ieiadfs raums;u0altrxr3oadfp e neo () 2xr(r oo1omt lfviltf 2tau  ;o4ole  iciltfa ea(mo u0 ltnxo3oy1faDr u o ()seurxrpiodll  livslt a2rru onu4aetniietatla ul( o t0tlenmf oodfa eau o;(  2ur(opnydap e fci ()sDur(ront0texo iciytfsDean p u4aexnio iy1oatraiei t  2tmxr3oydlltnmieils a2tauro;o4apto f3iyd a2ranvp;t) etoxf3oydomDean o s s2xoxm3nydlleemncilt) Dua(rp;u1tlxn ietys s eaums t4treniocoadfm rlnes;t)teurxo3iudap e ietltfsruax onu4alxnmfeiyd a2ra(vp;u4 rerxr oa1lmDranvo t trxrim ny1llt  fei tf rum(m ;o0tlenii3iadfs ul(ms;(4alxoxr3iytlp   iei;s  etmim no4lmee fvia()aDur(mpou1apenmfeiytlsDumn o;u4trtnxr oydop raies (  exoiopoo4lmte nvt s  Duru oou4teen o3ilsfs umnvs;u0tlenifcoatfmtelu i;t0srtrio3io1am  lfetas a2rr(r no0aeeomoeiasla2ua(vs u) ltoxf3oadopDrlivi;t0tetrimpou1ll   ivs t)srumxm nt1tee moetldla2emnvonu4aetoio ootlaDe uvolt)setr(rpnu4ame lfvtls  2umurpot0apxoii3iltlsDra(mp t0arerxf tytfmDe ies;t s2toxr3iy4om e ieils a2ururont4oee mi3iadfsDrln s;u)arxoxo3iytlpt anvo;t)trtr(m3ou4optnmnct t) 2taxro;t0aeen oetldlsDra(mp (0arxnxf3iotfpD  uvsls s2ur(m3iu4omenlivt t aDra(  nt4olt ioeiltfs2ua( p;t0aleomr3iotlatrln slt0trur(opoydomt lfeta(fsrtr( o;t1oltomieildfs eanmo;u0tlenirciytlaD  uei s0srxr(m ny1om emfvil( aDra(r ;o0opeoifetadlm umnms u)aexrir to1fpD anvo;t)seuoio ny1al elfciat)sDua(r ;u0olt  ocilsls eauvs;u) lxnxo3tydfm e ivi t)setrirpno1altnmivtlsf 2trxronu0texo feiltls uanvp;t) exnmo3iytoatelnvils0setmxo nodomt mnci (fsDtmxm no0olxo i3tls sDemums t4trxnmf3oy1lp r i sls  rxrxo3iudolt lfeiltfaDurx  nu4tex io3iasfsDran ont4 ltrir to1omDrau o t)setrxo nu4opte icia(  rumxr nu1oeenmfcias a2rlnmp t4 lxomo ta1om r nvi;t0s2umxm iodlltelfcs ()srtrx  ;o1tleoio3ils a umumo t0 lenxfctotlmDean ols s2xrir3oydoptnmnetat)arrm( pnt4apeo oeildlm uauvsn() exrxr3ia1opDe uvs;(0tetm(m nydll  lfvsls) 2tr(moou0optomi3ilsfm rl(vp;t4tltnir3ta1fm eai o ()texrim oy1lm nmietlt)a2tax ooo4open ociysls2ul(mp;()aetnifctotoptr ieo;s)trxm(r3no1op  mivsa(f rraxmooo4tlto i3iys s2em(vs;t4 exrxo3to1faDrln ols0s2xrxm3oudamtnlfcsas)s2taur ;u1oetoif3tls m elnmpnu0 leoxfcoatlaDrlu i;t) etr(r3nu1amee ietls aDur(mono4aptnmoctys m2rlnvon() rxomo3oatla elnei s)s2urxr nodal elicil(f Dtru  ;o0opxomo3iydfs emuvpnu4altomr ootlaD  ivi;(  eurxopno1oltnmivsasf 2ua(rpot0alenio3iad s rmn pnt0aleomfciadoaD aivs;(0 2umir oo1lmeemivsas)sDrrx  ;u4aex  ieiltfs ea( ont0alxrxfcoodlpDrlnvs s)sruoimpiudopenlivils) Dtrum no0alenio3tad sDrlnmp u0 rtnxf oy1lmDelnei ()sruoxopny4ome  fci t)a2uaur ;t4openmieiatlsDeauvs u)arerio3io1lpt  ueolt0 2uo(r no1aptelfesa()aDrm(rpnu0oet  i3tld mDrlnvp (0artnmoctytfmteaneo t) 2tr(r iy1lmtelictatfa2rmu p;o1tee mf3iatfm2ranvsnu0arxoxr3oatlm r n i s0 2xmxo3oydlmtnlnvs () 2uaxm oo4altnifciadfa2um(vs;u)texoxrciatfm raneo;s0 2tr(rpiu4lp  mnvtat)sDtr(mpnt0opx mfeiysfaDuan s ()tltnxfcoa1fp rlneo;s) rtrxopio4om e fet ( aDur(mpot1tlx mociydfmDra(mpn()teeniocio1om rau ols)s2ur(rpiu4lpt  iesas)sDrm(m ;t0ale ii3iat mDelu o;u0texoxo3iodlmDr uvi s)srxoim nu1lme mfctas) 2rmurp;o1openmi3tat m emu p;u) lermocia1lpDr u o;( trumim3oo1lmee fctl(  2ta( poo0opt  i3tytfa2umu on()trerxrciatfaD luvi;s0 rur(r nodale  nesat  rtm(mono1aee mo3tat s uanvsnu0treomfcio1fmtranvol( t2xoxr oodll   fctl(  rrm(rpou1aee  i3ias sDua(mo (0arxrxr ootfmDrai il( srtoxopoy1ll n fciasf Dtau o;u4tlxnmf3iltfa2elnvonu4artniociytoaD luvo;t seum(opou1lmeelnciasf rurxm ;t1tpe mociad s2raumpnt4trtrir ootlpte ivs;s0trtoim nudlle  neiasf 2tm(  ot0altnmicilsfaDuaumpnt0tlerircto1fp   uvi;s0t2trxo3nodlmenmivta(  rrr(rpoo1aptn oeildls2rlums;u4aleoircto1oa raiei s0srxrxo3oo4om nlncs t arrmumpot1oexnii3tyd m2elumon(0 ltnmr todlpt lneo t0 2tm(opnudope  ieiatfsDur(mpnt0apeoiiciatlm ul(vo t0areomr3iydlp   ieo ( teum(o3nu4olte icia(f rrr(r nu1opeomfcias s2rl(vo;(4tltomf3oo1fatrau sl(  rxmir nodlp   fctlt aDtm( o;t4apxnmo3tltfa eln pn()tlxoir totlp  auei;() rtoxopoy4om emfvilsfa2urxrono4aexnmf3iyt sDrm(vsnt) rxrxf3to1laD an ol( s2uo(r nudam nmfci tf 2urxm ou0optomfctatls2rluvsn()aexnxociodfm  ln s s t2uo(m3iudameemicia(faDumu  oo1oexnmietlt mDemn s;(0alxnmo3iodlm   uei;() rumimpny4lmeemnvs sfaDtm(mo;u0alx mi3ildlmDumnms;t0aexrxfciatfaD lnvsl(  etrxo3ny4opt lfcilsf Dua(rooo4tpx iietydls2uln pnu)aeermr iy1faD  u il( srurxm oy4al e iesas)srtrumo;u4aex mietyt aDrmump;u)alxnxr oatlat ln o (0 rtm(mpoydlp nlnei s)aDrru pnu1optomictlsla rmuvo;(0arermr3oy1lptrau il() etm(m oudlmt mfciltfaDrrx pnt4tpx  fctysla emnmo;u0 exnmo oa1lateliei;s)trtm(r3ny4ll nmfvia( srra(  nt0tet iiciyt a2ra(vsnu4 rtoxr3totlmte uei;s sexm(m nudopeelfctat)aDtrx  ou0aeeoiietatlaDrmump u)aetnmrcia1fm e nvols) 2toxr oydape  netlt)arraum ;o1oltoifetatfsDem(msnu4arxoxfcta1laDraivs;t0trtrxm oudolt licsas)sDrmu o;u1tee iiciatfaDuan p;t0 leomr ty1lateaueo;(0t2xmxr ou4om nlici sfaDrmxmont4apxnifcilslm uan o (0arxriociadfpteauesls)s2uoxm iy4lm elfcsls srtmu pnt4tlx  ieiat mDemnvp (4 exnmociotfpt lueo () 2tmio3nu1altn nesatf 2uaurooo4ale  o3tatlm uaumo;()aetomocoydlpDrli i;(0 rxmim3no4ole mnvtas)sDtmxro;t1aptnifciltfsDuluvo ()altoxociadlm   nvils) 2xm(o3oo1olt  ict t) 2rr(rpnu0tlt if3iyd a2ua( p u4tlermfcio1lpDr n i s0truoxo3iy4om   icsa() 2uru o;o1tptoifeiltfm2ul(mp t)arerxo3iotlptrlu ol(  2tm(o nydlm elnci t) 2tr(mpot4tee mieiydls ul( p t)altoxfcoadfa ean o s t2urxopnydomee icia( sDua(m ;t0tex mieilsfmDeauvpnt4arxnxocoodom rlu sls)s2umxm io1om eliesl(fsruaxmpno0tptoii3tltlaDul( p t0tetrxrciatfp eauei (0s2xm(r nu1op  livs s a2tau  ;t0ale moetldfm el(vo u0 ltomo3oo1opDrai ols)seum(r iudam n feias) rrrxmpot4aexo fctad s2rmuvs t4tlerirciodlatean i;s)trtmir oo1lmeelietat artmx pnt4aleoio3tytlm rauvpn(4aexrxf3iytlmtraivils srxmxm3ny1ol n ncsat)aDrm(rono0opt mf3iasfm eanmpn(0alxoxr3iadfmt lnvi;( sexoxrpiudoltnlfvils)s2urumoot0tpxoifeiadfs2em(vonu)tetnif ootoptrlies s0 rxo(m ny1lp e fesat aruaxr nt4aleo o3ias s2rl(vs;u0texnmr totfmD lies t0sexoirpno4olt lnei tf 2uaxmpno4olenioeiyt m2umn pnu4trtoxr3iatfpteaiei t seuo(r3io4ol n ieta(fa2rmuro;o4alxoif3iysla rluvpnu)tetrxr3to1oa ean i;(  rtmxmpiodoptnlfctls) rrr(ront1tpt iociyslmDemu s (0texrmo3oodom eaueo;s0teto(r3oydopt mfct t)arrrx  no4tetnifciyt m umumo t4tltnxfctadlat lu i;t s2uoimpoy1olte ivsa(fsrrr(m ;o1opxnmoctad a ea( on(0artoxoctodfaD auei;t trur(m ou1opt lnet sf 2rrx ont0ole ii3tltfs2em(msn(0artoir3tadfpt  i i t)trxmxrpno4oleemncsasfsDraxm no0tee mf3tltlmDul( p;t)altrxfcty1lpDelnvs;t)s2to(r io1amtn ncilt) rrmxroou4tlenmictlt sDrl(vs;u4 rtnxociotlm   ivs;()trurxm iy4ll e fcs sfsrta(  no1tlx  feiysfs2emums u4 exrmf3oadlmDeanvo;t  rurxr3oodalt lfesls)sDrmxrpot4opeomfctydfsDrmuvo;u0trtoioctodopDelues t) 2tm(m iy4lltemfcia() rtrxro;o4aleomoetldlaDrlu p u0arenirctadlptr ies ( sruoxr3oudoptn ivslt) 2rmum oo4teen fcils s eln o;t) rtnmr ia1lmD auvi;s sexrim3iudlp   icilt) Drr(  ;u0alxo o3iadfm2eaumo t0aeeoxo3oatfmDeluvi;(0 etoxr3iu1altnmicil() Drr(moot4tptoiietysfa uluvp;u) ltniociytfa eai s ()setrimpoy1ll emfctls sDta(ro;o4tex mietatlmDemumpnu4 reriocoytlmtranei (0t2uoxm oydomteliei (  Durx ont0olxnmfciydfsDeluvont)arxnxo3todfa r neol()tetrir nydamenlieia(faDua(  oo1opxomfeiyd aDum(monu4 exnmf oatfaD  nvsls trurirpio4lptnmnct t a2rrurono1opxoiiciadfa2em(mo;u0trxrxfctytla  an o t)srtmirpiu1olee ivtatfsDrau  ;t4tptoif3iydfs ua(mp u0 exnmf3iadfpD  nvi;(0t2urxm iy4ol nmnvs ()a2rmumonu1alt ifeiad mDrlums (4 renxf oy1fpDrln s s)s2xm(r no4llee nvtl( aDrrurpno1tlxomfciydfsDranmsnu)aeeoxr to1fa elivolt t2um(m3oo4omenlies tfs2umumpoo4tpt  oetytfa rlu s;(0treriocio1lmtrai i t)t2umxrpiu4lmt mnvsl(fsrraur nu0aet moeiyt sDra(msnu4tlermr3oytlaDeanei;s seto(m3nodamt  ivtasfa2rau o;t4teeniieiydla ra(vsn()tetnio3io1fm raivo (0trtoirpio1lltelfeta( sDrau o;u1apeo f3iytfa2umu p;u)areomociodlmte ieslt) exrxo3nodllt  nvtat  Dta(mpou0apxoifeiyt mDea(mp t4arenifciytlat anei t)t2xrxm3oo1am  lfetlt)a2uauroou0aeenio3iat aDraumsn(0aeerio3oadfpDrlnvi (0teurio ou4lpe  net (  2tmum ou1olxomfctadlm eau s (4trxrxocoydoatr ies;t0 eurxr oydlmtnmnvsa() 2raxr ;u4aleoifctasfmDeanmsnt4 exoioctodoa r i i;t)sruoirpoo1altelivsas)a2ta(mo;t4opeoiiciasls eau p;t0texoxr3ta1lptrlues ( s2tmxmpoy4ol  mieia( srrmu oot4olt ii3iad sDeln ont0tetomf ootoat  i o;s tetmxm3io4lm nlfct ( s2um( ont1tet  o3tltfs rmuvo t4 etrxr iodfaDe neo (0 rto(o iodllt  ieiltf Dua( ono0oeenmo3iadfmDumuvonu0altoio3oatlp elies () eto(rpiy1optelnes s) Dra(m ;u0alx moeiytls rm( onu)tlermocoadlat  ues s tetoimpou1olt lict (faDtaur ou0opxoiociytfsDraumon(0aeenmfctydfptr ues s) 2umxr iu4olen fvs (  2uaum ;t1oet mi3tatls2rm(von()tlxomr tydfa   u o;( t2uo(mpoo1omeelfet s s2rmump;u4tleoif3ilsfm2el( o t0altoio3iydlptr ivi;s) etmio3nydal e fetlsf Dtmxmont0ape ioctlsfs rl( s t4aeenio3ty1fmt lu sls) rtr(m3nodomtemfvt s)srurum ;o0tltoio3ias m2em(vo;u4 reomr ta1fmte iei;t) etoimpno1om nmnciasfsDtru  nt1oee ii3iysfm elumont4aetoir io1faD ln o;t t2xmxmpnodope licil( artmuro;u1oetomicils s elnvs;() eenif3tytfp  livo s0 2toio3nudlm  mfetat  rtmu  ou0tpxnii3ildlaDumu on()texoxrciotfp rauvs s setmxo no1ll elncil(  rrr(m ot4optnio3iad mDranmo;u4 renxr3to1fmteauvi;t  eur(r3iy4lltelnvi s  rta(mp;t4tex iicild a2umnmpnt4texoxo tydomDeluei t0 rto(r3nu4amt licsl(fs2rru  ;o0aeenifeiaslmDel(ms;(0aetrirciytoa r uvs s0trtrxr3iy4lmtelnesl( sDrax  ;u1tex  f3tlt mDea(vpn(0alerircia1lmD lnvi ( t2trimpnu4amtn ies sf 2ur(monu4tpeomfciytlsDelu on(0arxomr3tydfat  ieo;s  exrxm3no1al   ncsas) 2trxm oo1alt ifctldlsDranmp ()altrirciotlmtr u i s)s2tmir3no1amtnlfvsas)artaxmooo1tptoif3tyslm2umnmo;t0 rerxrctotopt lueo;s0trumimpiy4oleemfcil(fa2uaxr ;t1tlxn ociytlm2uluvo t4trxnmo iydoa  lu ol(0truoxo nydaleelfcsas aDraump;o0oeeomo3ild a em( p;()teermrcoy1lp rlnvsl() eurxm3iy1lpt  feia( s2ta(root0olto feiatfaDemu p;t) reoio oytoa  aies s)s2xoir3oodlle lfesas s2tmuro;o4oexnifcilsfsDuanmp;u0 reniociadfp e i il(  2umxm no4llen ncsa()srtau  ;t1tet iociasfs rmumo t0 lxoxfctatoa  lu o t) ruoiopiy1ame miesas s2urxmpnu4opx  f3iltlm2umnvsnt)aexrmf ty1omD  i i t) rum(m3ny4lpt  fei ( arrrumo;t1oleoio3tlsfmDrauvont)trxomo3tatfaDeli i (0s2trxm3iy4lm nlfvs ()arrau ooo0tpeomfciyt s2el(ms;(0tlerxocootopDr n s t sruo(m3iy4apeelfei t)a2ra(r ;u0tlxn ictas s uluvo t)tetnif3iytoat ln o ()trxr(o3oy1lm  mnvtls)aDtrumoou0aex  fetytfs2uau o;t4 lermo totlatelnvs;s)sexo(m no4alen fci ( sDtmu ont0teeo fctldfs2rm( o t4artoxo iadfpDeluvs t t2urxr no1ape lfes ()sDua(rpno4oetnmi3iadlsDrauvs;t)aetoxocto1omteluvsls trtr(m3oo1amte ncsl(faDumu p;u1aee mfetyt m rmu p u4 exrmocoatfm rluvo;t  exm(m ny4omtelietat)s2tr( o;o4aexo octltfa2rlums;t4trerio iatlat anvi t)trxmio no1lptnlfct sf rta(rpnu0aetniiciad s elnvs;u0trxnir oydoatr nvils0sexrxr3iydap  lncta( sruru p;t4aexnif3iydla2umump;t) eenio iydopDeaivs s0texr(rpiodlpe mics (fa2tmxr nt4oltnioeiyd mDemuvs u)tltoxociodopt  n o s s2trxo iodolenmnciltfa2ururpou1aexnmi3ildlsDrluvo;(0alxoifciatlm raivs t t2urxr3no1om emnvta() Dumxr oo0apxomociatfmDrlnvo;(4 lenxo3iodomDeanei;t0s2xm(rpiu1llenmfeia( s2rrurpno0aexomfeiyd a2emn p (4 renmfcoydoaDeanvs s)srto(m3nu4altnmnesl()sDrax  ;t0openmf3iysfmDrmnvo;u)tltnxo3iy1fpt  nvo;t0 2xrxo nudaptnmivtl(  rraum nt0opxoioctldlm rlu p;()tetnxfcoodlm elnvs (0seto(r3no1llenmivs (  rtrx  ;u0olt ioeiat aDumnmo;t) eenir oytlmte neol( t2xo(m3iudlm   iciasfaDurxr no4tlx ii3tadfmDeluvonu0trerxr3oadlp eauvo;s)t2umxrpiu4lle mfci tfaDrr(root1apeo oeiydls umumsnu) etnmfciy1lmDeaieol(0s2xm(o3nydlm nlneia(fs2tru oot0tpe  ietadlm2rmnmpn()tetomfcoo1laD livil()s2toxo3no1al elncil( srum(m ot4oexomfciasfsDem( o;t4 renxo todlatelnes;t0 exoxrpnu4ole lfci t  Drmx oou0apxnmictasfa2umnms;t0tlxoirciatopDrlnvolt) eto(r oudapt lfet sf 2tmxronu4alx mocilsfaDrau p;t0 rtnmr tadlp elivi;t0 rtm(o3no1ole  nei t s2tm(  nt4apxn fetysfs2emn s;(0alenxr oy1om elivo (0 2xoim ny4amtemivtat srraumo;t4aexniiciys a2rl(vp;u4 lxrioctotfpD livs t0t2xmio3ny4lptnlieiat a2uaurp;o0tet iieilsfa2ulnvsnt4 ltrio3iotopt anei;t teurir3oo1omtnliei (faDum(rpnt1olx  octys aDem( o u4teerxrciytlaD au i;t)t2xmio nu4oltnlietas)srrmurpno0aeeo o3iyt aDean onu4texnxrctadlaDelnei (0setrxrpiu1om  lfvs ()s2ra(rpoo4oeeniietytls ulu p;t)tlerir iytla   n o (0seumio3nodal emiviat srra(  no1opt ii3ils m eau o;(0tlxrio oy1omt lnes;t)s2umir3oy4am n nvt tf rrmurpot4aetnmoeiydfsDuau onu) exoif ootopD li s;(0 rumim3oy1opte icta( aDrr( onu4oeen oetldlsDrlums;t)tetnifciydomDeaieo;s)trxo(r io4amtemivia()arraxmpnu4texnio3tld mDraump;t4 rxnxfcootoaDe neilt)srxmir oy4lpe  nviltfsDta( pnu0ape moctldfm ul(vsnu0altrmf3tydomDranes;s0seuo(opnydop emfetlt)s2rmxrpno0opt mfcilt aDum( s;(0tetnxf3oatoa rai s;t)t2toxr3oydomt  ivi t s2rm(r no0tee  iciyd m umuvpn(0texrmrctydlatrluvo t s2xmxo3oudome mnvtatfsDrrx ont0aexo iciydlm2rl( sn()altomfciytla   ies;t srtmir io1lmeemfctlt) Drm(rpoo4tee  ociltlm2ra(mp (0trtrmr oydlmtraieo;(  2toiopnudalt mfvi (fsDur(ronu4oetomiciatlm2emumpn(4artnxfcootfm  ai ils0 rtoir3iu1lme mfvsl()sDrrxro;o4alt  ieiat s umnvonu0artomf3oo1fatrai o () eto(mpoydap   ncs tf Drm(  ;u1aexoifetydls ran pnt4trenxo iatop  ai i;( t2toim3iu4ale mnvilsf Dtax  no0tlxo feiyslm2ua(mpn() rtrifctytoa  lnvi ()setoxo oydlm   nct s) 2uau  oo1aeen oeiysfs2ea(mp t0 eeoxr oy1fp  aieol(0srtoio3iydopt  nvi t) 2um(r nt1apenii3ildlmDrluvont4trtoxo tytlmDeanvs t0t2xoio3oy4altnlfvil( arrmuront0openiociydfm rmu snt4alxoir tadopt  ues;s0s2tmxo iu4lm elfeil(fartm( ont4tleoif3ild mDulnvs u4 rtrmrcoy1lpteaneo;(0srxrxm3oo4olenmnctasfs2rr(ro;o0aetomfciysfa uanms t)aeerif oytlpDr n i ( srum(o iu1am nmfcia(  Dtrxrpnu0tle  feiysls2umumpnu4 rxoif3oy1fm  luvo;( setm(m3oodomte fvta(f ruaxr nt4aleomoeiatlaDuan s;u4 etrir3tydla rln ilt0truo(m3oy1lptemfviltf rtmurpou0aeenmf3iatla2eluvp;u) lxnxo3oy1lmt  uei;()truo(o oy4apt mfesl()aDuaxm ;u0oeto fctlsfmDea( snu4 etrircty1fm raivslt)tetrim3io4ap   ieiat)arraumpno0tpxo f3iadfmDemn sn(4tetoxr oatlpt an s s) rumxm io1lle mnciatfsrrrx pnt4tle ii3ilsla2elnvp;(4 ltnio3ta1fptrau i;t) exmxopnudol   fvtat  Durumpnu4altn oeild m uluvp u0 rxrxociydomtrlu slt srtrir3ou1lleemnvtls s2trurpnt0oet iiciyt m2rmu s;u0tlermrciadopD luvol()teurim3ny1apenmncsa() Dtmxmonu1tleoifeiatls2rmnms;(4aleoir3todomte u ols texmimpoo1lp  lfei s)sDra(r ;t4oleo fciatfs2rm(vp t0tltrio iodlmtr ivo;s0 eurio3nudomeelics tf Duau  oo0aptn ictas s um( onu0teermfctodlp r nvils t2xm(m ou4omt lnctat arrrxmp;t4aeeniicilt s uluvs t4aeenmoctotfat aiei t0tetmir nydope mfvt t)a2umxm ;t0apt ioetad s2eanvont4 rxrir tadlmte ues;t)teumir io4lmt lfeta() ruaxr ou1apxo ieiyt mDelnvp;t0 rxrio3oatfateaneolt  rurio3nu1apeelietl()arum(m ;o4tpxo ocias s2eaums () lxoif3iotfpt  i o (0sexmxm3iu4ll nmncsas) rtaum oo4olen feiyd mDeanvon(4 renxf to1opDeai i (0tetmim3oo4lmen nvi t)a2ua(m ;o0oltnif3iatfa ra( pn(0tetnif tytlmtrluvs;s0 rxoim3io4lptnlncils)aDtaxmpnt1tex mieiyt sDrl(msn(4teeoio3iytfatean olt) rxmio3iodalen ictat  rtr(mont1alxn o3iatla eanmp u0aexoxr iydlp e ueil(0 ruoim no1am  livta(f 2trxmpnu1altomieiyd a elums;u4teenmf iadfmteauvolt0texrxr iydapenlfetlsfsDrmu onu1tleomociat s rluvo () etrio3ty1oate nvol( t2xoxo3oo4opee feta(fa2rmxrpoo1tetoiieiaslmDuanvs;(0trenxo ootfpt  ivs;s  euoio ny4ap e fci () rra(mp;t1apt  i3iad sDem( s;u0 exrmr ootfatraneo;t trtmio iu4lpt  ieslt)artmxm ot4tlxnmi3tytfs rluvont)trxoircia1fm e ivol(0s2toxm3no4omtelfvt t)sDtr(r ou0aeenmfciysfa2eauvs;t)trermr totop eanvi (0srtmir3ou4olen nctl(faDua( ont0tee  fctadls rl( p;(0tetnxf oodom e ieol(0s2umim3iu4ope  ieil() 2tr(rpno4alx mieiys m ra( s;t)alenifcio1om   ivols  2tm(m3io4ll  lnetls) 2rruroot0aeeoif3iat s2eanms t0texoxoctodlmD  u s;s s2urim3io1am nmivtl()s2rrumo;t4tee  oetlsfs ea(vpnu) ltrmr3to1lp e uvi;t s2xoir iydop   neilsfsrumx pnu1apxniieiysfmDuauvon(4 rxrmr oadfatr ueol(0s2ur(r no1ol  lnvsa(  rrmx oot1oexoif3ils a ra(vp u4 etnxr iodopDrai i s  exoirpou1lm e icta(  ruaumoot0tetnii3iyd s uanmon(4tlxomo iy1opD  i o ( s2uo(m iu1lmte ncsl()arumumo;t0altnifciydls2emn ont0 rxnmrcoadoaD lu i;t0 eumxo3nydlmtelivsls  Dua(  nt1apenifctydlsDeanmo;t0 exoio ootfpDrlnei s  2uoxrpiydapenlfvta(fsDta(m ;t0tpxoifcilsfsDrmuvpn() ltrxr3totfaDeaueol( trxoir3nodamtnmnvtl(  2rrxmpnu4olxniietltls rl(vonu0 renif3iotfmDrauvo;() exo(m oudlmt lnei t arta(mp;u0apxoifeiatfa uanvsn(4 rtnio3tadfptr ueol(  2umio3oodop  lieilt s2urxmoou4tpe  o3iat aDel(vs t4 rxrxocoatoatelu ols)sexm(o iy4opeemieia() 2rauroot0tlxnifetldfs elnmo;t)aexrmo iotla r uvi (0t2to(m3nydllen ivi s) Dtm(r nt0tlxnmocilsla ulumo;u4tlxrmf io1laDeaneo;(0 rurxm3oy4lp elfvt (faDtrum ot4teto fctatla rauvo;u0alxrmf iotom elu o s trxrimpoy4op  lietltf rtaxr oo1olen i3tatlmDel( s (4teenxo iadlptelu ols  etr(m3ou1amenlfesltfs2um( ont4tet  oetatls rauvo t4alenif todoatrlneo;(  ruo(rpoudlpenmnvi t a2ururooo4altn ociydla2umn on(4arxrxf3iodfpt  neslt s2tm(r3ny1ll nmfvs sfs2tmxm nu0oeeo ietys s2eau p;u0 exomo3tadlm  lu i s0 2tr(r iy1ol  mfvslsfa2tmxmpnu4apt ioeiytlm2rlnvs t0aexrmo iy1la eluvo ( trto(r nodap elfcia(f 2rrx poo4tet mo3ias aDel(mo t)texnir3ia1opD  uvil(0sexoimpno1omt  ivtls aDtmxrpnu4tpenmfeiadfsDel( p u)tleoircoytomD  u ilt0srxoio nu1lmeemietat)sDrru  ;t0tltoii3iyd s2rmumo;t4arxomfcio1om e n ol(0sexrir nodole lnes (faDtmu ooo0teen o3tydfmDrl(vonu4 leoxrcootfa rln ols) exo(m3oy1oleemnvsa()srrrxro;o0tpeo fciatlmDranvpn(0 lxrxo3totfpteaueslt0setoxr3iudlpenmicsls) 2rru  oo4oex  ieiadfa ra(mpn(0 renir ia1lmtrlnes (0srtr(m io1lpe mfctltfsruaxmo;u1ope mieiat s2eln snu4arxrmo tydlm ean il(  etm(opoodlm  mivtatf Dtr(mooo4aex  ietltla2ra(vo t)areoiociydlm   n i;s  2umxopnu1ol n ietl()a2tmxr ;u1olxomiciat m2elnvp (0aexnmfcty1latran s;s0srxmxm ny1lmtnlnvi () 2rr(rono0aeen i3iatlm rl(vp t0 lxoxo todlat auvi;s0trtr(m iodolt lnetl(  rurx  no0openmocildfm rl(vsnt0aexnxfcoa1fa e uei t) rtoxo nodlmen ivi s aDrm(moou1aptomfciytfa2ra(vp ()alxnxo iodlaDeln o;t) rtmio3iodal  livias arrrxrpou0ope mi3tysfmDumu o u) exrif3oydfp raieslt texo(o3oo1al nmiciat a2tmxr nt1altoif3ilsfsDrlnmonu0arerif oydoatr uvo;t) 2tmxopio4lltemnctl(  ruax ooo0oetn fcias s eauvpnt0tltrmfctodfaDrau ol( setr(m3io1olt lfvs t) Dtmu  ;t1aee  f3iytla2ua(vonu4 ltoir3iodfm   i olt0 rxriopny1lp   ietatfa2umx pou0aexomociytfm2em(vo;t)tlerxrcoadlmte nvil()srtmimpno1llenlnviat aDuaxr ;u0tetn feiaslm ua(vp u) ltnmr iadlmDe uvo;(0sexrxrpno1omt lfctat srua(r ;u1oex mf3iasfs eaums u0altrxr ta1fpDraueo;(0sexo(r ou4opte fvias  ruaur ou1olxomfeiydfsDra(vsn(0aleoxr todopD lneo t  2tmxr nodap  mfeil() 2rm(mo;u4tpeo oetatfmDel(vsn(4 rxrxr tydlptrli i (0s2toxrpnu1op  mivsls)aDtm( o;u4opxn i3tltfs2eaumon()trxomr iodlmDe nvolt s2trxm3oo1ap n ietl()sDrr( pnu0aee  feiltlaDuauvs;u4aexoio todfpDr n o s  eur(o3iydllen ict (f rtax poo0tlxomoctas s2raumpnu0tltnxrciodfmtr i i;( t2toio oy1omtnmivtlt  rumxmp;t1opeomoeiyt a2rmuvs;t) rerir3io1lm elu i;t teur(rpoo1llenlfvs (f rurx  oo0oltnmoetydfm rl(mp;u4artnxf3totoptrlueols0tetr(m3nydapt  fes (fa2ururooo4aeeoiictatla el(ms;(0arxoxf3iydlaDraivils  2tmir3oudap emfesltf 2rmum nt4apxo oeias a2ra(ms ()texnxf oatopDr ieilt0 rxm(r nu4omtemieias aDurx pnt4oet mieiyt sDuluvp t0aexnxo oy1omteai i t)tetrimpio1omt  fvtas)a2umxro;o4aexnmictlt m2raumo;u) lxnmrctotfmtr uvils0 2tm(r3nudom e fes sf Drmumpot1ope mietls m2uluvs;() lxoif3iadlmDe ivs (0tetm(m iy4amtemnvsltfa2umxr ot0apx  o3tltfs rm(mp;u) lerio3oadomDr n s s texo(o no1alee fcs t) 2um( pou4alxo fcilt mDea( o t4 exnmfctodfm elivil()trtoir iu4op e feia( srraxmp;u1alx  oeiltla eanvp t0tetrxf oatlmD lues ()s2urxmpnu1aleelfcs sfsrururp;t1apt iieilslsDelumsnt4aeenioctatoatr i i;s0 rtoxr3nu4ap elietls  Dtrum ;u1oetn feiydlsDrmuvpnt)texoio iydoatrlivolt) eumimpou1lp  mfvs s)aDuaxmo;o1tpen oeiysls2rmnvs;t) exnxrctodlpt anvi;( tetmio ou4al  lict s s2ra(roou1tle mf3iasfaDua(vs (4 rermocootfat livi;()s2tmiopoydoltn ncsatf 2rrur nu0oex ii3tatlm2rluvo;t0 leoxr oo1lmD aues;(  eumiopiydlm  lnes t  Dra(mpot4ale io3iatlsDeau p u0trenifciydlp   i o t srxrim3iudomt mnet () rur(r ou1open ietyd s2elnvpnu0tetrif to1faDrli ols sexm(o oudopenmfci s)sruaum ot0aptoiiciltfs2uluvs u0teerifcio1la  livi;t)texm(o oo1aptnmfcils a2ra( o;t1tpx io3iys a2umuvsn(0teermrcta1oaDrauvs t)srtr(r3nu1omt  fetatfsDrrurpou1alx io3iatls rmnmsnt4 rtoiociotlmD ln o s)t2xmxr oo4lpen fetl(fsDtmxront1aeeomfciyslsDrau snt)alxoir3tytomte ues (0 2xrxm3nodlmt  feia()sDurx ono1oex  fcias s ul(monu0 ltrxr3iytlm  lnei ()s2tm(o iodlmenlivt s) 2rrurpoo1ale mo3iad s2ra(mp t) ltnif3ia1fmD luvs;(0 2tmxopio4al emicils sruaur ou4aet  f3tadls2emn s u4 lxomoctadlaDelivils t2toxrpnu1am nlicil(fsrrrxmp;u1opx ioeilsfs ra(ms;t0tltnio3todop  lneo s)sexo(r oo1lm  mieiatfsDtrxm nu0aeen oetltfmDul(mo t) etnmrciotfaDeliei s)sruo(mpoydlme  fviat s2rrxrpno1tlx mo3iyd s2ranvp;u)arerif tydla rluvi;(0srtrim ny4omen nvsatfarra(rp;t4oeto fetasla2eau o u)tetoircoydlm e ueo () euoxo iodapee nvsls a2tmu p;t0aee mf3tyslm rmumpnu0arxrircoy1lateau ols0 2xm(r3oo1lmee fesa() 2rauro;o1tlx mfeiasls2rl(ms;u4 reoif3oydoaDelueils0srxr(m io1alt livs s sDuru  ot4tpt  o3iltlm umnmo;t4aeenif3ta1latrauvo;t0teurirpiudlmeemfes s srtaurpo
\ No newline at end of file
@@ -0,0 +1 @@
+ueo;(0srtmxo nu1alt mivilsf Dtmxm nt1tlxnmoctls s rauvp u0 eermrctadlatr ivi (0seurimpiy1am  livta( arta(r nu0oet ifciatfmDrm(mo;t0 eermo io1lat anei;(0trtrxrpnu4ap e iesls sDtru pnt4opeo oetasfm eluvo;t0arxnir oytoatr uvo;t)trxoimpoydaptemfvt ( sruaur ;u0aptoifctasfm umumsn(4tlxrio iotopte i i;s)s2toir3oy1oltemicsa() Dtmumpnt1teenio3tlsfs2ea(vsnt) exrmocia1fp  aneils) exoxrpou1optnlnes s)a2trx pnu0ole  feiys a eanmo;(0 lxrmfcoa1faDe uvo s s2umxm3nu4lmtn iet t)aDuru  ;o1teen i3iadlm2rmump (0tlenxf oytopt  ieol(0setmimpiodoltemnvil( a2tau pot1ale  i3tyslmDum(mp ()arerxoctadom rli sl( trtmio iy4opee fetas)arrrxr ;u4tltnmfetasfaDrmn s;t4 etnxr ta1faDe uvo;t0setoirpiy4aptnlicils) 2um(rpnt4apt  fetld s ea( o u4 rerxr3oa1op   uvsl(0texoxr ou4lle lnctl(fs2tr(rp;t0oeto o3tld s em( p;u) eeomrcoa1op eluvo;s)srtm(m nodalt mivs t)sDtaur no0tltn oeiyt aDrm(mp (0 exnmfctadlmDeluvol(0s2umxmpno1apee iciat aDtmu  ;o1alto f3iyt a raumsnu)arerxo3oo1lm e ivilt0teur(rpiydaltelnvia(fs2trurooo1tlt mf3iydfm ea( o;(4 rxoifciatlm raieolt  2xr(opno4ole mnetasf rrr(  ot4aeto oeiytla2rlu snt)trxrir tatfp r ueolt  eum(r oo4lltnlfcs t)srtauro;o1tlxo oeiatfmDrmuvs u0tltoif oa1fa eai i ( texr(m oy1altelicilt aDuau  ;t0oeenmi3tydfaDulnms (0aeerxo oatlp ranei;( t2xoxm3nydapen iviasfarum(r nu1tetnmictatfa2emnmpnu4 eeomf3oa1lpD  n i t0s2toxopiy1altelfvt () rrm(m ;u1texo iciydlaDul( o;t0trxomo tatlaD ai o;(  rxmio iodom e fciat sDrru pnt1aetomoeiatfa2uaums;u4trerxo3iydfp e i o (  rtoxo io4alenmncs s)artax o;u0texnmociltlm eaump (0arerxf oydfpteli s;(  etoxo3oo4opt  fvt ( srrm(mo;o1texnio3iadfs rm(vont4texnioctotlmDr i o ()tetm(m ny1ol e ieil()a2tm(r nt4tetnifcilslaDem(mo u0 leomoctadop r iei s0tetr(opoydapee nci t  Dur(r ou0texoii3iadlm2um(vsnu0 lenxo3oatlmtrlu ilt) rxm(r iu4opte nvil( arrmu oot1alt ii3tysfmDrmuvpnt0 ltoir3tydom e ivo;(0seumxopoy4ll emfeslt aDrmxr ot0optn o3tldlm emuvs t0 lxnmf iodlaD lnvo;( t2trxm3nudam elfetls) Dta(r ;t4oleomfeias aDeaumo t4 exrio3tadoaD lnes;(0 etrxm iydomeelieias  Durumoot1tpeomieildlm2rmuvs ()arxrircoodlp eln o;(0srur(r ny4lpee nvia(  2uru pnu4teeoio3iyt mDrauvon(0 exoioctadoa  lnvol(  2tmimpoo4am  lfesa()aDtrxmonu4oleoiocilsfa2ulnvs (4artnif3tytfmD luvilt)s2tr(opnu4apenlict t) 2rrxmoou1ope mo3iltfmDulnmp;u4tetnir tydfaDe ieo t  eum(mpnu4lmeelncs sfs2uru  ot4tpto oeilslaDua(vs;u) lxnxr3tytopD  ueilt)sruo(mpoo1ale mivs s)sDurum ot4oexn oetasfaDelnmo t)altnifctatfm eauvo;t)srtrxm3ny4lle lnviat  2rr( p;t1teeoioetadla2rlnvpn(4 reoxf3oy1lpt aivilt)s2um(r iudolen fesat a2urxr ;o0altomictld s2emuvpnt) exrmo oadfaDrauvol(0trurxr ou1oltnmnesls)srtm( onu4tleo ictldlm2eauvs ()trtrir oo1omteln slt tetmimpnudapt mietl(  2trx o;u4olen ociyt m2el(ms;u0trtrmfciotfptelueo t0t2uo(r3oo1oleemieta(  rur( p;t0tle ifetldls2el(vs;(4 eenmocoy1lp rlnvo;s)texrim3iudlpt lictat)s2raump;t4oeeoif3iydls ea( snt)tlxnmr to1op   nvsl(0 2um(m3nydolenmfeiat) 2urumpnu4teeoiieiyslm ul(vp;u0tlxoxfcia1lp  aues ( t2tmxmpiydlmtnmict (faDtmu  nt0apxomoeiatfaDrmu ont)teeomr3ty1fpDe u o (0 2tr(o oydap e ivt t) Drmx p;t4alxnifetatlm eauvs;()texrir3iydlmDrauvsls) exo(rpoydope lfcsa(fs2um(mpno4tleoiicilsfs umu s;t0 rerxf todlaDrlivsl(0 etoimpoy4alt lfvias)aDrru  ou4altn feiltlm2rluvp;(0 eenifciy1faD li i t texrir oydolee ivsl() rrau  ;o4opxo oeiydls rln o;u)artomf3iotomDeaneslt srtmxm3nodal nmiei (  Duaumonu4aptnii3ilsfm2umnvpnu0altrmrciotoatranvsl()seto(m io4apenlieia()sDrmu pno1oexomociat m2umu p;u0 eenir iotfm  lueil(0srxoim3iu4lltelnet tfsDua(rono0optoifeiltlm ua( snt0aeenirctytomtraneo;(0s2tr(opoy4opte fvslsf rumx  ;u1oeeoiietlt s eanvp;(4artrxf oo1fa  li s t0trxrim3oodamenlnci (faDtaxr ;o1olx ioeiasfsDea( s u) lxoxociatfat  ivilt0 2xo(rpou1aptemfet t)s2rmum ;u0aex ioeiltls rau o;()alermoctadoaDeaiei (0trumio3ny4lpe lfesltf Duau pou1alxn f3tytfm2rlnvp t4 etrio3iytlmt li i;s) 2toxm3io1ale  fct t sDurxmp;t0olt  i3iat sDulu on(4alenir3iodlaDrln o;t)teur(m iu1altnmfei ()sDrr(  ;t1oexo oetydlmDuluvp;t0trtrxr io1laDeln sl()sexr(o3iy1optn fvtls artmx pot1ale ifciadlm emu snt4 lerxf3todfm   uvs () 2uoxo oudlp emieias)s2rmxroot4apt ifetytla2emnmp ()aexnmr iadfm eli s;s)srtrxmpny1apt  ivtls  2rr(  ;t1tpxnmi3tadfa emuvo;u4tltrmo ia1fmDeaiei;t0s2umxmpoy4open fvtasfarurx  no0oex mi3iat aDem( on(4 rxomr ia1latelivslt)trxmim3oy4ol  mfet ()aDta(r no1aetoio3tytfm2uauvs;(4altnmo3iy1oaD auvi;()srtoxrpoy4ope mneiasfsDurx  oo4texn f3iyd a2em( snt) eeoxocoadfp rln s ( s2urimpnu1lp nlfvsat) 2rmuronu1aexnmfctlsfs elu onu4 etomfcoa1faD  uei;( trum(mpiy4omt livsa()sDuaxm ou1oltomfeiatfmDrlnmonu0alxnio totlpD lu o s) eurxrpiydal  lncia( aDururonu4opt mictldlmDel( s;t0tltrmfctytlmteanvilt)s2xo(r3iudolte net ( srum( o;u4teeo oeiad a umump;t0 lxnmrctytlpDranei (0setoim iudalte nvsa()aDrau pnu1tetnmfciyt m2rln onu)artoio oytopt au o;s0srumxopiodlltelivs sfs2raxm ou0tpxomociatfa2emnvs;u4 eerxrciytop r i ilt0t2umxo iudapee nvsasfa2rmx pnu0teen octas a2ean s u4aleoxf oatlptrlues s0 2xm(o oydame mivsltfs2tax o;o4optoii3iydlm ea(mp (4altnxo3oytfaD aneilt)teum(rpno1lpee ictlsfs2rr( p;o0tpxomfciatfa2el( onu4trxrmf iytoa  liei t0s2uoir oodomt mivt (fa2rmx  ou4opx mfeiasls ua(vs (4artnxociytlpD li s;s0 2um(m nu1lmeelicias  rta( o;t1opx  o3tld s em(mpnu0teenircoy1lptr ivi s sexr(opno4lp nlicsls)aDrrur ;u0tlt ifeiyslmDraumonu4 rtomo3ia1fptraies;t0 ruo(m3io1ale mfcta()srumumpnu0tlxo f3ias m2ua(mo u0 rtrmf3oodop eai s;s) rtmio3iu1aptemncsls)srtm( pno4oltnmictldlm uanmsnu4tltrxfcoydfm rluvslt srxrxo io4lmtn feiasfaDrr(m ;t1oltomo3tysfs2elu s;u0 etomf oa1fp   ivsl() exmim ny1oltnmiciat) ruaumpoo0olen ocias s em(vsn(0 etnifctadlpt ln o;t) rumir iydap emfviasf 2ua( p;t1tlxnio3iytfa2umu p t0arenxo3oo1oaDr ivo;t)texo(o io4lpenmfvias)a2rm(r no0apxnmfctlt a2rmuvo (0aeeoxo ty1laDrauvil(0 rurirpoudap  lncia()aDtrumono4tptomi3ildls eauvp;u0artnifcootop rauvi;(0tetrimpny1omt miviatfsDtr( p;t1tetnmicilt m umumsnt4 ltrxr ty1opDeaivsls0 exoxm3iydomeelietlt)srrrx oou0alx iieiyt a ean p u)arxnxo oadfat li i s s2to(opno4am emfeils)srumx o;o1tptnioctyslaDel( o;u)altnio ia1fp  anvo t0t2xoxm3nydapte fvilt arur( ont4aetniociltfmDra(vpn(0aetnir3ia1fmteauesls)trtoxm iu1lp   nctls arta(  oo0tetoioeiytlmDra(mpn(4 etrxrcoytlpDrli s t0t2xoimpiudopee fctls)s2uax oou1tptn fciydlm ul( o u4 ltrmrcta1omD  ueil()s2xoim nu1opeemnvsls) Duax oou0olx mo3ilsfa2um( o t4artrxo oo1oa eli s (0trurimpoudopt  nvtl(fartmur ou4alxoioeiytlaDua(mo (4tlenxf to1fm eln s t trtrxr3ny4lpt mnetlsf 2ra( pnt4tpt if3tld m2rmumo;u) etrxr3totfat  nvils0srum(opoy4aptnmnvs tfaDuaxm nt4tlx mociyt a2elu sn(0tetoir ta1fp e nes t  rumimpoodlp emnvt (  Drmurpoo4ole  feiadfa2el(vp t4tlxomr3ootlmDr uvsls0trxoim3oo4omt  ictls artmx  ot4teeo ieiat aDul(ms u4tlenmf3iodlmte n sl(0srxoxr oo1ll e fvtat arrm(m ;t4oeen octlsfs uaums;t0trtrmr oodlpt luvo;(  rurxo iudlpenlnet s aDra(  ou0alto oeiaslsDea( p () rerxr oatfa rln slt)sexmir3oo4al  lfeil( aDua(  ou1tlt mf3ilt aDrau p;u4arxoxfcootom r nesl(0 2to(o iudoleelfvs s  rtrxm ou0tltomfetytfmDemn p;u4arenxr3iytfpD lu o t) etmimpiudllt  ieias aDumu  nu0tpxnif3tydfsDemnms (4tlxoxr iadop rluesl()srtmirpiydal elfct s) 2uru  ;t0opeoifetasfs rmnvonu)aeeomr totlmt lu il(0 exrxm3ou4lltnlictatf 2rr(m nu1olxo o3iltfaDra(ms;t0aetomo tatlaDean il(  2to(m nydamen icia()srtaxmpoo0apx mo3ias s ran onu0aexnxr iatopteauvs s teto(m iydomeemfetatfa2rmxro;o1aeeoiictltfm2em(vo;t4 lerxf iatfaDe ivilt)teurimpoo1op  miei sf rurumoou1tet moeiasfm ra(vpnt0trtoiociatop elivi;t)s2um(o3oy4apen ivi (fs2rmurp;u4teen i3ils aDranms t0 lermfcoadopD  nvs ( setmirpnydapt lfctlt) Drrx  ;o0opto ictytfs rmums t)altnmo3iadomD  i o;()teurir3ny1ame lfctas)sDumuro;o1alxnmfciydfs2rl(vonu0trxrxf io1opD anvs;t)setr(opiudop nlfvil(  Duaxroou4tex mfetldfa uln sn(4alermr oytlaDe i o s) rxo(m3iudaptnmivtatf 2ururpou1apeoifciltfm elnvp (0tltnmfciy1fp   i o;t) exmxr ny4omt  fctlt)s2tmxrpot0texnmf3iltlm ra(vs;u) ltrmf iotlptr ieolt) exmxo3no1apenmnvsas sDuaumpoo0tex  f3iyd s2ra( s u4tleoircoadlmDe nei;t tetmxopou4op   ietas  Duau oou0aptnmfciatfa rluvs u) eenmr ty1fm eauvi s)teuoim iu1opeelivtas sDtm(r ;o1altoifeiaslaDumnvs;t0trtnxrcto1fp  lnvilt)sruoim3oydaptn ncs sfa2umur ;u1tpxniiciys m rln p;t4arxnio iytoaDeluesl(0 rum(r3ou4lpeelies tfsrtmxr ot0tetomfeiadfaDuluvont)trerxf ta1om eau i ()trtoiopnu1ap  lfet (f 2rau p;o4apx mociytfsDrlnmo;u0aeenxo3to1lm   nvi;t)s2xr(r3iu4ap emiesl( sDumumont1oetnmo3iltls2emnmonu0alxrmr iodfmDeluvi s0 rxr(m ny4amenlivias)s2rr(moot1aeeoifeilt m2emnvo t)trtomrcoy1omt au i;s0trtriopiy1ap e iciltfaDuau  ;t1alt  ictasfa2ul( onu) renxfcoa1fp eaneilt0srxmxo no1lltelfvi sf 2uaum no1aeeoiieilsla2uln o t)tetrxf3todlpDe nvs;t0t2uoimpiodll nmnesat srrr(rpou4olt  oeiatlmDeluvpn()areomo3tydom e nvo;t0t2umxo iu4am emncsas) 2rm( onu0oltnmfetatfa2ulumo;u)treoxo oydfmDe n ols  exrim3iudlmtnmivilsfsDta( pot4opx iieiatfa2uau p;t) exrmfciydfp eluvslt) rumxr3ny1lmen fetl()arua(r ;u0olxo oetadlmDrauvont)tltoirciatlmt  i slt0 2uriopio4al nlnctltf 2rmxmoou4ole ioctyt m umu s;u)artoio3ta1lm r i ilt0tetm(m oudol  lfetas) rrr(  ou4olto ieiaslsDea( on(4aeenmf tydlp raueslt  rxmiopoodlp e nvils)srrau oot4aexo oeiasfm uaums u0 rxnif3ia1fpt  i s;s)sexoirpiydlp e nviatfs2um(rono1oexn fetydfs2rau p;t)aexrirciadfmte uvs t srxr(o ny1omt  ivsl(fa2rmxm ou1oetnmoeildfsDra(ms (0alenxf oa1la  auvo;( t2trim oo4alt  ivsatfarrmum ou1aexnio3ildfmDulnvsnt0 rerxfctatlmD ln i s t2umxm3no1om elfvsas)srtr(mont4apt  i3tadla2rm(vo u4tlermf3tatlmtrli i;(0t2xr(mpoodlpe  nct t aDua(mont4oexnmocilt mDran p;t0tlxomo oodfmtrlneo t  2xm(r3oo4omeelieils) ruaxr oo1tltn f3tlslmDrlnmpnu0 rxomocoydlmtelu o;( trto(rpnodlle lfciasfsrtruronu1apenioetydlaDrlu o;t4altoircoytlmDelies;(  rxr(o3oo4am n nvias)arum(mpot0altomictysfm2em(mo (4altoio3to1faDeanvo;t)srur(r3io1openmnet t arta(r ot1oee  f3tytfaDemn o;u4trtoirciytfaD au i;s0trto(mpio1open nctlt) 2raxmooo1tleoii3tydfm2ra(mon()aetnmfciy1fa eaneil()t2to(m3iodlp emncias) 2ua(  no4tlen ocias s2ranvon(0texrmf io1om eaneo;t0s2ur(o nydap nlictl(f Drmx  nt0tltomf3iytfa ul( onu0 rxrxocio1oatr i i (0trxmir ou1alt livt sfaDuaxr ;u4opxnmociyd aDra( sn(4 ltrxo3oodfmte uvslt) 2xo(r3iy4amtemfet ()arrr(ront4ole io3tlsls2eluvs t)arxrmfciodop eaivilt0truriopny4ape mnesatfarraur nt1apeo feiyt mDemuvont4aexrxf3oa1lptrluei;(0 2tm(mpio4om  livtas) Dtrxmp;t1opto i3tys m rm( sn(4 exrmr oadlpt an o;t) eur(m no1omenmics sfsruax poo0tet mf3tysfaDelu o t0 renir io1latran ils)srxmxm3iy1al nlfctlt srur(m no0aleo fetadlm um( p u4texnio3tatom  aieils  euoxm ny1ap nlieiat)srtrxmp;u4olenifciyslm uanvs;t)arenxo3oy1oa  livil()setoir3iu4ap n fvsl( a2tmurpou0tex mfciys m rlnmo;(4 lxnirctodfmt lies t)truoio3nudol nlfct ()sDum(monu0ale moeild a elumo;t4artrxo ta1fm raies;s0teuoxm3oodlle lfei sfsruru ooo1tpx mfciys s2rlu s ()altnmo3oy1latr nvi;t) rtmxo oy1lmt lfesat)artrxrpnu4tptoiicilsfm em(vpnt0 eeoxf iytfaDelueo t)tetr(rpiu1ap elnvias sDra(r ;o1alto o3iatfa2rl(mo;(4 rxnmf3ia1fa   uesl( t2urxo no4alt  feil(  rrmxmp;o1optnmfctytlm um(vp;t)trerif oa1op r uvo ( texm(o3nydlpeemietl(fs2ur(moou0tpxn ictydfs2elnmo u0tlerio tydomDe uvslt)s2toxr3ou1aptelnes ( a2taur ou4tpto oetas aDrmnvon(0tlenmfctadlmDr nes;s) rxm(m oy1lpe  fcia(  2rm(mo;t0olxnmf3iasfa um( s;t0alxriocoatlm  auvo s0texmio nodal n nvtlt aDtm(mpoo4optomo3ilsfs2ra(mp;(4 exnxr ia1omDeai o t s2to(o ny1lmenmfvils sDua( pou0tpt  ieildfsDumu o () lxrmoctadfp rlu i (  ruoimpoodlm nmnct () Duaurono0texnmicilslaDeluvs (4tetoxr3tydfa r neil(0tetrio iy1optelfvs t s2umum ou4olxoif3iasfsDelnvo;t4trtoxr io1oaDelu ilt0 2uriopiydllte ncils)s2rauroot0tpeoio3ils s2ran p (0aeeoxf tytlmt an s;()sexr(r iu4lp n iei (fsrua(mono0olxnmi3iys s2ea( onu)treoif to1lmDraiesl() eurio nu4alte fetat  2ra(m ;u4apx ioeilsfs ua(vo;t4tlxoxf tytoa r neols sruriopio4lm nmfcslt sDtm(m ;u0aet if3iad sDumums;() leoircoodfptean i;t  etmxopoodlmenmivtls)s2um(mpoo0olenmfcildfs uau p () eerxr totfp e nes t)t2toxo3ou1opte fetat sDrauro;t1oex io3tld s2uau snu0arermf totfm raivols0s2xmio oo4ll nmncsa()artmu  ou0oeeoio3tls s2umnmp;u4arxrxr3iodlat lneslt trxoim no1ap n nciasfa2rr( ooo4ape mfcildfa2el( o (0tetoxf3oatlpt livs;()srum(r3nu1ll e fvt s  rrrxmoot0aex io3ild s ua(vo;u)artoir3oa1oa e i i;s  2to(rpio1llt  fcsltfarta(  ;t0alxo fciyd a2eluvo;t0trtnxr3tatomDeau sl()seto(r iu1olt mnei s) rrau  ;u0tptomoctytlm2ulnms;u4aexoir3ootomt  u il( s2xoir oo4omt  ietatfartaxrpou0oetniocild sDul(mont0tlermfciy1lmt ln s t t2tmiopny1alt  ietat)s2tmu  ;t1teeo oetyt m rm(vs u0 lxomf3oydfm r n s;(0s2um(opio1lpt lnvta( aruaum ;u4aleoifeiatlsDra( snu4 reoxf3oodfaDrauei ( t2umim oudaltemfvs t)aDurxmpnt0aet  i3tydfm eauvs;u)teeoxfctatlpteluei;t0seum(o iodap e fviatf 2rau p;u4tlenmfetyslsDrm(ms;t)tleoirctotlm e ueo;(0srxr(rpnudlpt mnct tfsrta(mpnt4aexnmieiltfm ea(mp;(0 lxomfcio1fptrluvi (  2umxmpiu1lmen fvtasfsrraxr nu1oexn oetlt m umuvo;(4areoxo ia1laD lnes s0s2uoxr nydll nlncsls s2um( oot1tpeo ietytfs ua(vo;t0teenxo3ia1lmDrlu sl()trtrim nudaltelfcsl()aDtaxrooo4tpxn i3tld a2em( o;u)altnio iotlptr n s;s0texr(opou1olte fvsls  Dumx  ;t1aexoioetas m umnmp u4trxoxo tydomDe uvolt tetmir3io4om  miei t) 2tmxm nu0optoiietytfmDea(vs;u4 lxrxrcoy1op raneol( trtoiopiydlme lfeilsfa2trumoou4tex iictyt mDrm(vo;t0aetoxfciydlptraivo;(0 2tmxr3oydamtn iesa( sDrmumooo4aetnmoctat mDumn p (0 eenmrcta1fpD  uei;(0 rxoio oo4omee fesas)s2uaurpot0tlxo o3tydla2eau snt)aeerirciytlateliesl(0trur(mpou1omtnlictlt arrr( pou4tltoii3iltls elu s;t0arxoiocoytfp  aiei t0t2xoxmpny1ap  mivtl( a2urx pnt4teeo i3ils a2ea(vo u)aetrif3oodomDrli s;( seuoimpou1am   ivi (f 2rrxr nu0aeeomiciydlsDrmn o;t4artomr ty1oaDr n i t seur(o nu4ll elnvtat a2taxmoou4apt mieiadfm2el(vpnu)arerxfcootfa   uei;s) eur(m3ny4lle mnetlsfaDrmumo;o4oeeomoeilt s um(vp;t4arenif to1om  aueo (  eum(o oudop e ictat srrmx  ot0altnmo3iasfa eluvo;t4arxoif tytop rlieolt srxmir3io4aptnlfct tfs2umumpnu0apxo ieild mDeanmsn(0trtnmf ty1la eauvs;s t2umio io4op  mfcsasfsrta(mpnt4tle iociad aDrlums;(4artoxocoydop elieo t  eur(o3iu4lme  feta()s2taum ;o4tptniictys m rlnvp t4 lxrmf io1laDrauvs s  eumio3oo1lmtnmneiatfarua(moot1optnmoetlslmDrmump;u4treoif oy1opDrluvslt trtmxrpnu4amt  nes s) Dur(m ot4tpxoif3ild a eanvpnu) rxoir3oodoaDeaieols setmim3nu4ole mfes t arur(m nt4tle  i3iatlm rln sn(0tltrxo todfm   iesl( t2tmim nydam emivi t)aDrmxm ot1aexomf3iyt s emu s;(0teeoir3tatlpt lu o t s2xoiopoo4omenlnei t aDum( p;u1opx  oetad a2umu pn() lxrmfcia1faDr uvslt setm(opoo1al elnvsl(faDurx o;u4openioeild mDul(mp;(4arxoxr oytom r ivil( texm(m io4oltemnetls  2tru o;t0tetoii3tlt mDeanvonu)trtoxr3iydom  aivi;t  eurir oy4aptnliei (f Durump;u4oeto o3iys mDuluvont0 eenmrcoy1faDean ilt)srxo(r3io1amtelfcsa(faDtrxro;u0oetoifeiadla elnvp ()aetrmo ta1lpDrauvolt)setmirpoy4lp  lfeils)sDtaumpoo4alen iciysls ulu p;t4alxoxf oatlaDrlnvo ()truoimpno4lmtemnviasfa2rrurp;t1oee  o3ildlm emuvpnt) rxoxrcoatoat anvo;s trxm(m no1apt  fvsa()s2umx oot1alt if3tltlaDemnvo u0teeoxocoydomDrauvsl( teto(rpnydop e ncs t s2trxr ;t1tetnmieiadfsDrmnmo;(0trxrxfcio1fmD  ivi;s sexmxm oy1al n ivsasfsDtm(r ;o0aptomi3ildla2ea(mo;u) eerif oa1fpDeai ol(0t2tm(r no1om  micils) Draump;t1opxnii3iat aDrmuvs;t)arxnmocoa1fp r neilt0 rur(m nu1olenlfetas  rrrur ot4oee moetad aDemu snu) lxnxo3iydlmDr ivs s srum(opoydap nmfvsa(f rrru pou0alx  o3iys aDea(vont4 renxf oadomDr ueslt)trum(mpoydapt  fctlt arra(mo;u4aet ifeiatfm rln p;(4 lerirciytlpD lu o s t2tr(m3nydol n iciat) Dum(  ;t4oetn ietadfsDemuvp;(4 leoxrcoytfat auesls0t2trirpno4ope mictlt s2tau  nu0oeenmo3tytfsDeanms;t4tlxoir3oy1latr i s;s  rtoxmpnudlm emnetls)sDum( o;o1ale ioctas aDranvo u4 eenmo oadfmDeanvsls  rto(o3nu1ll nlfctl() Durxroot1tlen iciyt sDumumo;u0alxomo ta1oa r uvs (  eumxr iu1omtnmnvi (fs2trxr ;u4tlenmf3tas a2rl( s (0texnxocoo1lpD  u ilt0teurxopnydalen iet sfarta(  nu0tpxomiciyslm emnms t0 rxoxr3tytlate ues t0teto(rpiy1llt mfctls a2rrum ;u4olt mfeiadfm2em( pnt)alxrmo iodoaDeln s;s0sexo(mpiudam elictatf 2rr(r ;t4olxnio3iytfsDuaums;t0tetrxf3ia1fpt anvslt s2to(o ou1lleemivsl(f Drm(root1apeoifciltla2em(vonu) lerifcio1lm  lieo;s0s2xrio3iodamee ivta( aDrau  oo0alx mo3ils a2rm(mo;()artrmfcoytfpDran ilt  2tr(opiodlle mfvsl()arumur no1opeomfctasla2rl(vo;u0 rtnmo3todomD aivi;t) 2uo(opnudaptnlnesasfaDua(mp;o4olxo ietys aDuau p t0arxnxr3iotopt anes t)s2trir3oodom n ivtlt a2rmxrp;t0tee  oetlt sDum(vsn(0tlxnxociytoptr uvs;t t2xmio3io1aleemfes (faDtmumpot1tltn o3iatla2rl( p;u) rtrmrcoydoa r nesl()trxoxo3oudal emiet (faDtru  ou0alenmoeildlm uanms u0 rtnxf oydla e neo t teur(opoy4op e fei ()a2rr(m ;o4aptomoeildfs emn s;u)teeoioctodopDrlnvils0 2tmim nodape lnvta(fs2tm( oou1apx ifctadfa eanvp;t0 eeoxr3oydfaDraieils0trxmimpiy1optn nvt t sDtaxr oo0aptniocild a2em( p u) etnxr3oo1faDelu olt seum(mpno1oltelncia()aruax o;t1alx mfeiytfmDra( s ()alxomr ty1omDe ivi;t)t2tm(rpiydoltnmfvsa()artm(mpnu0aexniociysls emn s (0trxrmr3oydlp rau sl()seurir3oo1llt lncs tfaDua(  ot4aeeo fetadfa2ranmonu4altoifcia1om eluvi;t  exmxrpny4al   fetltf rumuroou4opx mociadfs eluvo;() ltrxocoadlaDeauvolt teuoir3oo4amen fvt sfa2tm(  oo4oltnmi3iytfm ra( p;u4teenir3iytfm eai s t0s2ur(m3no4amtemnvt (faDra(rono1oeen oetatfaDemn p t) ltnxf3iytfptr iesls)setmxopoodlme lfvs s aruaumonu0aetnifeiaslsDem( o u) rxrirctadfmD  uvilt0 2toim ny4am elicilsfa2umx o;o1tlto o3ilslaDeauvo ()aeenir oo1lp e ies;t trtoxm3nodam elnvtat a2rm( o;u1tpxnmfeildla rau p;u)trtnxo3iy1lpteai olt) eumimpnodlptelnvias aDtmuro;o4tetomi3iyd sDulump;(4 ltnxfcio1fpDe ivo t)seuo(mpnu4lmtelnciltfsrtru  ;u1apenmi3tlsfaDumn pnu0 etnmf totop r u s ()setm(mpoy4alt mncsat arumx ont1oexnii3iydfm2uanvs;(4tetrxr ta1fpDrauei s0srxo(opoy4opt mfvil()srtmur oo1opeoifcilsfmDuln on(4trtrmo oadopDr nvi;t0 rxr(r iu1lpt  ictltfs2raxmono4tlxn i3iltlsDumnmont0trtrio3iatlpDrau i () exm(r oodam nmfcil(f rtmxmp;o4olt  feilsfaDrl(mp;u)arxomr iy1lm  lnes (  rtrxm nodomtn iei t arumxmpou1tleo i3tadfs2ean p t)aeenxocoa1opDe neil( sexmim oy1lm emfvia(f Dumurpoo0tlenmf3tls s2ranvpn()aexriociatoaDe uesl(0 etm(r ny4op  mfviatfsrrau ont1oet if3tytfaDuluvp;t)arxnxr oadomteli i t0srtm(rpiudomee fcsat srtr(ro;t0tet  feildls2rlump t)alxoxocio1lat aues;s sexmxr oo4oltemivsa(fsDumx  ;o4oee ioctlsfmDeau o;t4aeeomo3ty1op   n s;t0 eto(r3iy4apt mnvtas  rumu  ;o4apeniieilsfa uauvon()trxoio3tytfmtrluvi s)seurir iu1olt mnvs (f 2rr(moot0olt  ociltfaDul(vsnt4tlxrifcoo1lmtrau s;t0 2xm(r3oy4lpt  nvtas) ruaumoou1tltoiociltfs ua(vsn(0 rerxr3oydlmt lu o (0trtoir iydlmte fei t  rta(moou1ole  fciydfm2emu o t4trtnxrcoydlmt  uvol( s2umxo iy4lmenmncs ( aruaur nt0aeeomieiadfsDem(vo (0tltoxf oodlpt  neol(  rxmirpoodomenlfvtlt  rrax  nu1tetnmiciasfsDra(msnt4 lxrmr iodfateliei;s)s2urim no4optnlicilsfsrtmx  ou4tlx mocilt s2ean o;t4trxoio tydlat anesl(0 2um(opio4altelfeslsfaDurx oou4tlxo iciytls ea(ms;t)aetoxr3ia1lptraivi ()s2tr(o3io4ameemfvtatfsrraur ou4aexnmicils a2eanvs () eenxocoadlmDrauvslt trxoxm no4lm emfei () 2trxrp;o0tlxoif3iytfs um(vs;u0 rtnif iydfm  ln s;()trxoir3iy1lltn fetlt)a2uru p;o1opt iieiatlaDea(mo u)aetrxocoadfaDeanvo;t0setmiopoodlpt  fvi tf Dum(mono4alx  fctyd mDrl( o u)aeeoiocoydoaD  i i;t) eumxm3nu1amtnlfesa()artrur nt4olxniietys m2uan o (4 rtrio3oodom r ueo;s) 2umir3ou1op nlictls)aDtr(  oo4olt io3iytfmDrau o;t) eerxo oo1fa   ivi;()t2xrxrpio1olt  icsatfarurxr ;t0teen octytls2ulnvo;(4artrir iy1laD lneilt0srurxrpiydoptnlncilt arrmxr ou4apx ioeiadlaDulu s;u0 etnxo tatfmDe ueo;t t2xrir3ny1apte iei t s2tmxm ot1alx ifetytlmDulnvs;t)tlermf ty1lp e u i s texmir oy1llen iesl(fsDraxmpno1aet moctadlmDean s;t4artoxf tadoa e neslt0 rurim3io4amee nes sf rraump;o4alx mfctlsfm2emu pn(4tetnxr iy1fptrlivo t  rtoimpoydoleemnci sfsrurx  nu0tle ifcildfa2eanmp;(4alxnio oo1lpteauvol() eumiopnodlp emfci tfsrtmxmoot1apt  iciasfa rm(vp t)altnxf iadfa r i i s0trtmiopiudolt  nciasfsDtmu pot4tptniictytlaDumumsn(0arerif3oadlateli o (0 etmir3nydapenmnvs (  2tmxronu0alen iciydla eau s (4artrmr3todoatr ueslt0s2uoxrpnu1al  lieia()arta(ronu0tpe mietlslaDua(mp;u)texnxr oodom e u s;()seur(o3no4om   ictlsfsDur(mp;t1alt  ociytfm2ranvpn() rxrmo ta1oa  livs;t) exrxo io4omtnmictl( srrmx  ot0aet ioeiydls2uluvo;u0teermr tytfp  aues t0s2xrirpno4alee nvsat srtmxmooo1oexoiictydfm2umuvo t0altrmf ootlmDeaivo () 2uo(m3ny1altn ict s) Dra(rp;t4ope iietytls2rl(ms;t) ltnmo3ty1fpD  uei;t s2trxopnu4lmtnmfcils a2umx pnu1optomociys m ra(mo;t) renmrcoydfpD aivsl( s2trir ny1lp nmfeta(fs2urxm no4aee  o3tldfs el(vpn(0tltrxf3ta1lmte ivs;s  2urimpou4olenlfcil(fartrxr no4tlxo fciydlmDemn snt0 exrmf3oadlp ran ols  2umxo3nu1optnlfci tfsDrax onu0alto ietyd m2umnmpnu0trxrxo3io1opt an i t0srtrxo iydlp  lncs (f 2raur nt4oex ifcils s rlu p;u4trxnmf todoateai o;(0 2tm(mpio1amtn ivi sfsrta(mpot1opxo icilsfa el(mo;t0 reoxfcto1lmtelivs (0 rxm(opiy4lptn nci s  2urxmpot0tpx io3ildfmDelnvp u4 reoio ty1fpDe nes t  rxmiopio1lleelfvta(fs2rau  ;u4ole  i3tysfa2emuvo t4 ltnxocoytlp eaneil(0teto(mpoy1lmtnlncia(faruaxm nu1olt miciydfa rauvp;(0tltomf3iotoa   n s s)seur(rpnudamtnmicil()aDumxro;o1opeo ietad s emnmo (0 rxoxf io1lmDrai i t  rxrxr iu4om elnvsltfa2raum ou4aet mietysfaDua(mp u) renxf iy1fat lieo s s2xr(mpoo1omeelfcs ()a2rm( o;u1tlxoiietytlaDea(vs;t4tlenmf ia1latrlueol(0teuo(m3ou4lmtn feilsfsDuax o;u1aeeoif3tatfm uanmsnt)teerxocto1lp r n s;t)srurxr nu1alt  fctas arrau p;t4altn ieiysfs ulnmo t0tlxoxfcoadlm   nvols)t2xm(rpoodap elnvsa(f rtauro;t4ope mieiadlsDra(mp u) etnxr io1la eaieil( setmxrpoy4optnlfeilt s2ur( pnu0ope ii3ilsfmDeau o t4aetomocootopD  ieolt  2trir nydamtemnvt s)sDumxrp;t0altnmo3iysfa2eau p (0 eenxo3iodlaDrlu o;s0truo(o3io1apenmfvsa()sDrrurpnu4apto i3taslaDrau s (4 lenxo3iadfpDean slt0 etrio3oydalt  ieta()aruaxm oo1optomf3ildfa2emumon(0trermf3oadlaDr u s;t)t2tr(o3iodaltnlivia( srurx p;u0optniieilslmDea(ms t)trtoir3oo1laDe ueils)sexo(m3nudlmenlnctls s2rrum nt1tlxn f3iad m rauvonu4tlxoxf3to1la r neo (0 2trio oudoptnmfvtl( artr(mono4tpt ii3ild mDra(vont) ltomfciodlm elivils0tetrxrpiu1om nlivtatfa2rmum ;u1olxnmfetyd a2rau p;(0 ltoir iydlm r ieo (  ruoxo3nu1lptn ivsas srrru pnu0tleomociadlm ulu pn(4 exoxf tydfat au sls  2tm(m oydamte fviat)s2uax oot4teenmoetadfs emumo;u0 rxriocoatfpDeln ols t2xmir3oo1ole  ncsa( arta( poo0olxo ocilslsDem(vpn() leomfcoatomD li slt0sexo(m oy1lmee ici (f Durx ono1oltomieildfs2rmnvo (4aleoxocoatla  liei ()setoir nudal nmietatfaDumx  no0tetnmfetytla rmn p;()arerxo tadfaDran ols) 2uoirpiy1lptemfctlsfarua(m nt1alt iieiydfa ea(vont)aetrmf ootlp   nvi (  2uoio iy1olenlivilt sDraur ;t1tpt if3iyslsDuauvs u) rtrmo iytom r ivols0s2tmir iu4am nmfcsl(fs2ra(rpoo1tlxnmf3tldla2ua( snu4tltnmr3oadopDraieo s0srtm(r3nu1ape mfvi sfa2uax poo1oltnmfetydlm2rln p t4alxoxrcoydom elueo;() rur(r ou4opee ivtasf 2uaurp;u0oeen ocias m2rmn s;u)tetomf iadlmt lnvo s teuo(o iudlmen ivsl(fsrtr(m ;u0opxnmi3iydlaDul( s ()tltnio tadlmDran o;t)trurxo3ou4ll n fetl() 2uaur ;t4tlxnioeiatfmDea( p (4 lenxfcoo1omDeaivols0s2urxo3ou1ap elietltfa2uau p;o1apxnmoetad a2ranmp;u0texrxociydlmteli s;s) rtr(opoodlmtemietat a2uaxm ;o1ole ii3iyt aDrluvont0aexrmo3io1laDeluvol(0 2ur(r iy4optnlfct (f Dumuronu4olenmiciat s2ulnms;u)aeeomfcoadlm rlneol()s2tm(m oodop   fesas srraumpnt4tltomi3iysfaDelnvo;u0artomf3ootlm eanesls  exoxr iudale mnctas  rtrxm oo0tltoio3tasfmDuauvs u0tlxomfcoy1la raieols s2umxr3nu1ll  micsatfaDtauro;t0aet  oeiatfa2uau s t)alxrif oydfa elies (0 rtrxrpoy4om n ncias arumurpnt4oexo fctlsfs umumsn()aetrir iodlm  au i;s0setmxr3nu1lpen icilt) 2ur( ooo4tpe  ictyslm2em(mo;u0trtrir oadlp elieo;t) etoio3iudope  iet ()srtax  ou1alxomfciatfaDeau s;u)artrio3tadlateli o;t0 etmir3oodop e ncs () rrr(rono0tpx iiciat s2rmu p;(0 rxomocto1omDr n sls  rtmxm iudlpenlnct s)artmu  nt1tpxoifetltfs rlnvp t0texrxr3ootoa raivo t sruoxm3ny1lmtn fvsa(fsrrm(ro;o4tlx iociatfa ranvs u4trxoxr3iy1fpt  n olt0t2ur(m io4lmtelnetltfsDtruront0tpeoif3tysfaDelums;u0treoir3oadfm r ueo (0 eur(r3oy1omen ietls)aDtmx poo0texomoeiyd m2ra(vpnt4artrmo iydlm  anei ()setr(rpoydlm nlneilsfaruau pou4tpenmictat s2umuvont) rtrmrctydfp r uvo t0t2uo(m iy1ame  fcsls) 2umxront0olxoifetas mDuaumont)trtomo ty1lp eai i t)s2xrir3oodolenmnvsls)arrmuro;t0tlx  fetltlm ul(mo u4tltnir oadopDe nes ( trxo(r no4om nmici sfartru  nt0aee  ictlslaDrau p;t)teermfctodfmt aues t0sexrxo iy4omenlnctlsfsDur(mpnt0apxn fciydlm ulnvo;t) leoxr3tadlmDelivs s0 rxo(m ny4ale  fcils  2raumoou4alxnmieild s2ua(vp;u4aetrmf3todlmDeaivolt  2umxo nodam nmnvsltfa2tr( o;u1oeeoifeiasfsDrluvsnu)trtoir3to1latr ueo ()setoim3ny4apt mivi (f rtm(r ou0apeomf3iadfs2ra(vp;u0texoio oatlm elnei;t) eumxopnu1om emnct tf Drrx pnt0tptomfcilsls2um( o;t)tltoio todoa eanvil(  2um(r3ou1omtelfvs s)arurumoou1open ociasls2umn o;t0trerxfcto1faDeaneo;(0sexoxo oy4lmeemieslt  rtmu  oo1olxnmictat a2uaumo t0trxomrctydlp  au s;( trtoimpno1oltnmieils) Drrxmont1oee iietld a ul(mo;t)tetoio3oytlat  uvolt0t2xrxr iu1om elivil(f Dtmu  ot1tpto ociyd a2el(mpnt4arxomrciytoa eauvslt  rxr(m3nu1altnlnei tf Dumxrp;u0teenio3iydls2ea( s;(4 etrxocty1fmDe n il( trurxo3nydlmtnlncil()arrr(mpou1tpxo o3ildfm2uau s;(0artnxr oo1lpDrluvi;t0trumxm3no4ome  nci sfsrtru p;o4aeeniocild s eluvon(0 etoio3tytfptr nes;( seuo(mpno4lp nlfvi (  rur(r nt1oetomietas a ea(mon(4tltrir totoaD  n olt)t2xo(r3no1lme  ivtlt)arua(ro;o4oetn feiydlaDul( pnu0artnmf3to1laDeanvils  2uoio nudlm nmnvsls) 2um(mo;t0tetn i3iys m2rluvont0 ltnxo tytlp ran i;t0s2uoirpoo1al nlfvslsfsrumxm no0oltoioetytfmDemump t)aeenxr3iy1fmDraieol() etmimpio1alte ivtatfsDrrx o;o0alenmfeiysls umums (0arxoio iadfaDe n o t0 2umxmpno4lpeemieta()sDrm(moot4olx miciys mDemumonu0tltrmf3ta1lp elnes (  rxmio ou1om n fvs sf 2rmxmoou1tetoiieiytfs2emu o;()aleoio3tytoa ranei ()seur(o3iy4al  lieta(f rua( pno0aeeoifciltfm rl(vs (4trenio3oodom  liei ()srtrxm3iudllee ivs ( s2umu pnt1aptoiietytfs2elumo;() eerio3to1fpteluvi;s0texrim nu4amen fvias  2uaxm ou1alxoiictlslmDul(vs u)arxrmfcoydfmDrlieo;(0trxrxmpoydolenlfes tfsDtr(ro;u1opxomf3iatfaDuln o t0trxoio to1om e ivo s0 2umxm3nu4lptnmici s)sDur( ono1opeo fetasfmDulnmpn()artnmo3oy1fpt aivo ( s2toxo oo4apeemictlt a2urx  oo1aleniociadlsDea(monu4aexnmo iodopteluvs t s2urio ou1lm  mncs s)sruaurpot0tlen icildfa emnmo;t4 lxnxr iatfpte neo;(  euoxopoodllen ivslt)sruaxr ou1tptoioeiyt a rlu pn()trermr oadfaDrau ilt tetrxr3iudam  mies t srumurpoo0oexn i3iydfa ulums;()tetoifciytfate i i ()srxmxr3io4lmenlfetlt)srurumoou1olx moctas s2umnmp;u4aeeomocia1om  aieol() 2xoio3ny4om   nctat) Dtmxm no1oet io3tytfs uluvo t0 renmf ootfp ranvi;() eumir3oy1opt  icia( aDta(mpnu4oeeoiociltlmDem(mont0tlxoiocoo1lptrlueo ( t2xrim oy1ole  iesltfarrr(mpnt4olxoif3ildfsDeln snu) rtrircoa1fpteluei;t0srxo(m3oy4ll  lncsls  2tmxmo;u0tptn fctldls emumsn()altnirciydfm raivi;(  2trxm oudal e ics t sDta(mpnt1oet  ietydls rmumo;u4trtrmfciotfaD lu o;t)s2xo(o oy1oleemfes ()a2tm( p;o4opxnii3ildfs umnvp (4teeoif iy1lmDe ueilt)t2toxopoydlpen nes sf rum(rooo1texomi3iadfmDuaump (4trxoxo3todop eanvs;t)trto(r3nodalt lfei sfarra(rpot4tet mfcils s2rm( o t4 exnmr3oa1oaDrauvi s) rtmxr3oo1lme  nvia(  rra(rpou1oleo ociatlmDua( o;u)aleoioctotla e uvs (  2toxmpiu4om  lfvil()arrmx  ;t0oleo ocilt s2eau pnu) lxomfctytfpDr i i t0 2xoiopiudoltemfet ()sDrr(mpnt0tlxo o3iydfs2rm( o;t)tetrif iodlpt luvo (0trumim3oy4oleelfct ( a2umu p;u0texo ieiadlaDra(mp;t)teermfctatlptrlies;t)tetrxm3iy4op  mfvtl( a2ua(r nt4aet io3ils m2elnvpnu0teerirciadla e nvols0s2umxm3oudll   fesa( sDumx  ;u0olt  ieils a ranmp t4 leoiocoy1laDrlivs;()tetmxm iodlptn neias) Dtmx  oo4tpt ii3iltfaDrlnvs u)artrxocoatlmD lu i s  2uo(mpiodamt mietlt) rumuroot1opeo o3iaslm2rlums;()artrmf3io1fm  livi;t) rto(o3iudaptnmnci ( arrr(r ;u4alxo o3ils m ra(monu4treomocta1fpte iei;t0srumio3nudomtn nvsat) 2uru  ou1apenmoctys aDuluvs t0 rtoxr ta1fmD lueil
\ No newline at end of file
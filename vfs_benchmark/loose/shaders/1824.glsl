@@ -0,0 +1 @@
+u ols)srtrxr no1lp  lfcsat)artm(  no4olx if3ild m2ran o t4teerxfcoatoat au il(0trur(m3ou4altnmfvs ()aDua(r nt4tltomfcilt s2rmn s t)alxoxfcoytfaDrlnvi;t t2um(rpiu1amenlfesas  2tmuronu0ole  oeiytlm2ea(vp;()teenxo iy1lpte ueils) exoio3iydlpt lfctlsfsDuaumooo1oltoiieilt mDumnvp;t)altnmf ootfmDrauvs;(  rxrxopou1omenlieia()s2ta(r nu4tltomieiad m2ulnmp t0teenircoydoa eanvo;()teumiopoydape lnctatfarrmxr ou4olto feiytfm rlump;u) rxrif ootla ean ilt0sruoim iydal emivtl(faDuaur ;u4alx mociydfm elums;u0arxnmr3iydfmDrlnvs ( srxr(o iu1omt  feias srrrxrp;o1oexniieiltlaDumums;()aetrmf3ty1omDr ivs;t) 2trxm3iudop  lncsa(fsrtmx  ;o4olenmoeilt m uan pn(0trenirciydfa rluvo;t)srumxm oo1lpe  fctlsf Dtrumpnt0apx  o3tat a2eaumonu) eeoxf iadfa   iesls  rtrim3io1ope miet (f 2ta(mpoo0oeenmf3tadfa2elumsn(4aexoircoytla elueo t0srxm(o3oy4amt mictl() Drmxm nu1olxoii3iasfmDeluvo;u) exomfcia1opt lueo;t0 exr(m ny4alt  fvia( srtmxmpno4tee  o3iys sDua(vo;t0texoxoctydla e uvol(  2trxm ou4al nmiesas a2tm(r ;t1aet moctysfaDul(vsnt4arxoxoctytoa r ivi t)tetr(r nudomt lici sf Dumx  ot1tpxnmf3iadlaDeauvsn()artrir tatomDraivs;t)sexoio iu4lpe  fvsa(f 2ua(  ;u4oleomfetydlmDea( p (4tlerir3iy1lmD aneolt0 euo(o3iydlltemfvt t) rtr(r nu4ole ifciat mDeluvs t) eerif3oytfaDr nvil(  2tr(r3nudap   fvsls sDtmu  ;u4altoioctatlsDem(vont0trtrxfcootoa e u sls0t2ur(m3no4lmtemfvtl(faDrrx  ;t1oee  fetatfsDua( p u0tlenxf oytlaDeaivi t)texo(r iu1omtemfet s  2rmxrpnt4aee io3tys sDra(mpnt)aeerxfcty1fmD ai ol()seuo(o3iydoptnmnctltfa2umx pnt1olx  ieiytfs rluvs u0trxrxrciy1fptr i ilt0srxo(r3oy1omeemfcs sfs2rrumont1oee iocils sDul(mpnu)tlenxr3iatlmtr nvo t)sexr(o oy1apt licsat srtrurp;u1oeeo o3ilt sDeluvpnu) lxniociodfpD livo;t0tetoim3iy4ole  nvsatfs2taxrp;t1oet mictatfm elnvont) ltrxfcoy1opt aueslt0teumim3iodol   nes (f Dumumpno0opxo i3tysla2rlumo;t)areomoctodfpteluei;t0 rxm(rpno1oltnlfesa()srtm(ronu4oeeoioeiysla rlnvsn(4aexrmocto1fpt anvo () 2urirpoo1lmenlnciat) Dtrumo;t0texo ieiadfsDeau p;u0 etomo io1opD lnvo t0t2um(rpio4opeemnct t) Durump;u0apxn o3iysfsDeau s;()aexoir3oytfm  li olt)t2xoxmpio4ape  fctasf rurxr ot0apenmfeildfsDrau p ()alxnxociytop rai s;(0 2tm(m nydlpee iviat) Drrurpou1aetn i3ils aDrluvpnu0 rxoir todlpte nvo;s t2uoimpoo1olen ici tf Dtm(mpnu0opeomoctlsfm2rluvs u)texoif tydfmte ivo;t trxrxopoudape lfct s sDur(mo;u4oeenmi3iadls ea(vsnu0aeenmfciatfpD aueol(0 eumxr3oydale  iet t)a2tax  ou1opt  ieias a rmnvs;(0aetnmr ta1lmteaneo t)t2uoxmpiu1ll elnvias)aDrm( ono0tlxnmi3iydls2uauvs;u4aexrmrciytlpD luvs t)trurir iydoptemnesl(fsrumu  ot0aptoiociatfm elu s;() etoxfcoydomte ivi s0setm(o3iy1lm  mfesa(  Drmx pou1tpeomoeildlaDuau o;()texrmfctatop r u sl()s2uoxopno4lm n iet (fs2tmxm ;o4apxn ieiydls2eau snu4 rtnxr3oatlaDeliei t)s2tmxrpnudopte ics ( arrmx  oo4oltnifciyd a ea( p;(4 rerir ia1lmtrln sls texm(o oo1lltn ivt (  2ra(roou1opx  iciasfsDuln sn(0tetnio3oodopt anvo ()s2urxr iydol n iei tf rra( poo0aet mfeilsls2elump u4 eenxf3oy1lmtraueo;s s2urimpny4ome livias)a2umurp;u4tlxoiociytla um(ms;(0aexrio3iadom eau s;s tetrir3no4lltelfetl() 2ua(rpot1tpx iociad m2ua( s t)alxrxrctadlm rauvsls teurir ou1lme lfei s  rraumono4tle if3iytlaDumnmo t4 eermf3ty1omtean s;t)setoxo3iydaptemfvi t  rtax  ;t0aleoiietys s2elu p;t4 rermr3oydfpteauesl()s2urxr3iodomen fcsat) rur(m ;t0opeoiiciytfm2ranmont0aleomo3tytoateau s;( sexoxo3nu1om elnesls)s2ta(m ;u0olxomieiasfa uan o;(0 leoif iatlm ean ol() rxrxrpny1lleeliei sfaDrmur ;o0ale  fcilsfmDrlnvp (0 exrxf3ia1opDelu o;(0t2tm(rpoo1lltelfcs tf Dtr(mp;o4ape mocias sDrl(ms u) lerir3ootopDe ivs;(  2to(m ny4ol nmnesas) Dtmu oou4alt iieiatla eanmon()arxrif ty1oateluvo t) rto(mpio4apt  fetlt aDuaxroot1alenmi3iasfm2rl( s;u0trtoio ta1fp rai ilt0srur(r oy1llenlncs s) Dtmu p;u4ole ioeiydls2rln o;t4trxnxf iytlmte i s;()tetmxr ou1lle  ict s) rraxro;o0aleo f3tasla emumsnu)texomo3oadlpDe uei;s trtmimpoydoptemnvs ()srururooo0alxn ictydfm2rmu p;t)tlxrmf oa1optr ivs;(  rumxrpou1lp  lfvi () 2umx  ot0alxnmfctysfa umnmsnu4altnmr3ia1lmteluvs ( texoimpoy1op n fcsl(faruaumooo4ole mfctasfsDumnmp;t0tltnxocoo1oa   ivo s teuo(r3nodllt lfct ()a2um(ront4aexnmictytfm emn p (4tltrmf3oydfmDe ueolt)s2uo(o3oo1ap  mfet sfsDuaumpnt0aexnmoetldfm2ranvp t4 leoir3ootfmDeln slt)trurim oy4llt  ivi t)srta(r ;o1olt  o3tldlsDeln pn() rerxf iadlatr uvslt sexmio iu1ome  ies tfartrumo;u1texniicias mDulnvsnt0aleomr3tytfpDraueils  rtmirpoudamen nei (f 2ua(root4opx mfcilt m emnvsnt0trtnxocty1oaDeanvs t) rurxm no4al elneslt) rum(mp;t0oltoioeiyd aDrmu s (4alenifctodomDe uvi t s2tm(m iu1amtnlnet s)arum(r ou0alx mi3iyd m2rlnmonu) etoxo3tytfptr i s;t)t2toirpiu4olee nvsat)srta(rono4oetomi3tydfa ra(von(4alxrio3oodoat li slt0trtmxm3no4ol  lnvsl()aDur(mooo4optnmf3tyslsDrmnms t)tlenxr3oodoateln ols  rxoxm3iy4om n iet (f rtr(roou1tpe mictltfs2umn o;u4trerxrcoytoaDr i ilt0s2triopou4lm elnet tf Drr(mpnu4aexn fciat a elnvo;u4teerifciy1omDeaueo s0 2xrxrpou1lpenmnctas aDurxm nt0aee mfctat aDrmnmp (4teerioctadlptelivo;s  ruriopio1ll  mictls srtrum oo0opxn oeildfa umn snu4arxoxo3oy1fm  auvol(  rtoxmpiy4olte fctls sruaur ou1oex moetldfs ea(ms;() rxnir3ia1faDe ieo s  rtmxrpiu4alenlfcil( arrmumo;t1tpxnmo3iydfmDulnmo;t0treoif3iotoatr u s;t0trtr(o3iudolee feiatfsrrax oou4texoiieiadfm rauvo t)teeomr ootlmDeauvil(  rtoxr nu4lptnmnvt s a2rrx onu0tlxoiiciatfmDrmnvo (0 rtoio3oodfat ln i s0teto(mpno1ole mfcsls  Durxm ot1tpxnmi3tadfa2umumsn()aeeoio3ty1op elies;t0 2xrxr iudamtn fvilsfs2urxmoot4tltnmociyd s2emnvs;(0aexnif3tytfpDraies;t0seuoxo iu4alt mivsls)aDraur ot0olxoif3iyd aDrmumo (4 lermfcoo1fmte nvs (  2uo(m iu4ale licsat)srtax o;t4ape mfeiadfmDrlnmsnu0 lerxf ta1lpDran i;s setoxo3no4lp emnes s s2taump;u0oexoifetltla2elumpnt)texnio3todfp rlivo;t) rxmxm nodome  nviat) rrauro;o4tlxnifeiltfmDuanvpnt4 etnxr3tatfmteai slt) rtriopoydol e fcslt)sDtmxm ou0apen feiytfa ua(vs u)alxoxrcoydfpD  uei;( trtoio nu1ome mncils)sDumxr ot0opt mociad m eaumpnt)arxrmo ootlmtraies (0s2to(opiu1opte nei s  2tau pnt4tetomi3tysfm2ul(mpnu)trxnmrcoydoatr n ilt) 2trim oydam emiviasfarrm(mpnt1altnmietysfs ul( on(0 ltrxrcoa1lmDr u s s0srxr(o3oodame lnvtatfa2trxronu1olxnmictas s emu o;u0artnmf tytoaD aneslt tetmxr ou4omt  ictas  rrr(mp;u4aleoioetatla2umnmp;u)tleoxr3io1omD aueo t  rtmio oo4am elnvs (faDtrump;o1aet  feiat aDeanvpnu4 etrmf3oy1fmtraieolt0s2uoio3oudlptn fvi ( aDtruronu0alt moeiadlaDran o u0aeenxrciydfp r u slt  rumxopoy1lm nlieiat aDtau ooo4olxnmieils m2rmn s u)aeeoif3oydfa ran ol(0s2urirpio1ale  ivt sfa2trxro;t0ale ifeilt s2umumo;(4 reoiocia1opte uvils0 2xoxmpoy4am   iciatfa2rrxrp;t0aexo fetyt a2rmu s t) leriociadom rli i t) 2uoir3nudolee iei ( s2ta(rpno0aexnio3iat a2ua(monu)texnio3iotfp eaiesls0 eumimpio1lm n fci tf 2tm(  ;u4alxnif3iysfs rm(mpnt0tlxnxo tadomDelneilt0s2urir3ou1am eliet t aDumxmpnu1alxnmfciasfs2ulnvs;u)trxrmfciodlmtranesl()s2xmir3io1omenmivt s  2ururont0tleomo3iasls el( p t4tltrmo3tatoate u o;(0t2xo(r ou4lpee nvils a2rm(r ;o4alxoifctlsla2ulnmp;(0 reoircoydfatrli il( setmxrpoy4olte fvias)srtr(mp;t0oltnif3iasfa2ra(vp (0texoifcoytfmDrauvi;t) rumxr3nodoptelnvtas a2tmxrp;t1aeeo i3ilsls2emnvo;t)aetoxocoa1lpD aueo (  2xmxm3oo4al emfviltfsrrr( pnu1optnmf3iatlaDea(vs;u0artnifcio1fpteliei s t2xrirpiodlp n icta(f rraxrp;t0texomfciadfs2ranmpnu4 reoio3iydlmtr ueol( seuoimpoy1ome mneta(fartrxr ;u4aeto oetasfsDuauvo;() lxoif io1opDe uvs;t) 2tr(r oy1amte ieiasfaDurxrp;u0tex  o3iytlaDrmnmp (0alenircta1fa rlu il( setmiopou1lm nmfeils  Dta(rpnu4aexnioeiys m2el(vp;t0arermfcta1fm e nvilt srxo(o3oo4omtelnvsat)artm(m ;o1oexn ociyslm2ea(mpn(4aetrioctotfmD ai o s)sexmiopnudope lnvsat  rta(r ou0texomfeils m ulu s;t0tltnxr ty1fa rlieo;s0setmxrpoy4ole lncsls)sDrax ooo0tlxoioctydla2el(mo t)aexrio to1faD ln s;t)s2trxr nu4amt mfvi (f Dra(r ot4oleniociys a2em( p;t4tetnifciadfmtran s t0s2xoxm no1lm elivt (fartmx o;u0optnif3tat s rmn p;t0trxnxrcoytfate u sls0srtrxr3nu4lpeemfetlt)srtm(  ou0tle moetytlaDumn o;u)teermo3oy1la rlnvs s)srur(rpoo1ll nmneta()a2uaum ;o4apxo iciadls rm(vo u4tetrxfciydfmD li s;s0 rxr(o3iy1ol   fct ( srtmxmpot4aetomfeias a2emuvp;(4aetniocoadfpt  n s;(0s2xrim3nu4apenmnct s) ruaur ot0tlx iieilsfm2um(ms () etrif3iodfm rlnes;t)t2trir3io4ll  lfet ()s2ta(ro;o1ape  i3tytla2eau o (4 lxrxo oy1fmDe uvilt) etr(r oy4open feta( srrrum oo1alxoifeias mDea(ms t4 rtoiocoodop eln sls  2xoim nu1al n ivslt s2rm(r nu1apx mfciysfsDrmu s;u4trenmo3iydom  li o s)trtrxmpiu1lm  lfct ()aDrm( pnt1aexnmicilslaDumn o;(4altnir iotlmt  neo t)texm(m io4amen ncil( aDum(mo;o0olx  o3tydla2ean pnt)tlxnir iadfaD lnvsls srum(o3ou1ol emietls)s2rrum ;o4tlx mi3iat s2eauvs t) leoio3oytlpt ln o t trxrxopiy4ale  feiatfaDrrxmp;u1tee moeilsfa ua(msnu0tlxnxo iy1op ranei;t)trxoiopiydllen iciatf 2tax ono0tpxo o3ild sDranvo;u0tlxnxocia1lat anes;s)trxo(o nodlpee nvils) Dum(m ;t1tleoifcildls2rau s (4teerxr3ty1op eanei (  eumxr oo4amt livsatf 2rm(r ot4tpto iciyd a ea(mont0teeoiociadomtrlues s) exoxr3nydaptnmietl()s2rrxrp;t4olto fctytla2rmump u4teeoxo3oy1lpDelieo;t0s2uo(o oo4lmt mfctlt srrmur ;o0oetoiociysfa rm(vp;u4trenmf to1fmtrauesls0sruoim3iy1opte fvilsfsDrrum ;t4tet  o3iysfsDrmu s t0tetnioctadlat au s s0 exoxo nu4olenlnctlsf rua(rp;o1oltn fciydlmDeauvo u) ltrmociadla  aivil(  2xoim iy1lptnmfci t sDtaxront1aexo i3tydlm2emu p t0 lxomo oytoat luvi;s0texm(opiu4omen nvs ()aDrr( pno1aexo octydfaDea(ms u4aexrmf3totfpt  uvo;(0 exoio3io4ll   nctatf 2rrurp;t4tlen ocildfmDeauvp t4arxnxf oatfm e n s ( srxm(opoo4amtelieiltfsDua(  ;o4oeeo fetldlm2umnmo u) rxrxfcoydfp elieslt)s2xrimpio4am e nvia() 2tmuront1olx mi3tldlmDeau p u4alerif3oydopDeln olt)sruoio3no1olt mfviltfaruaumo;t1oex ifctyslm2eaumsnu0tltrxr3tytfaDelnvs s trtr(r iydap elneta() rra(mpoo4oeenmf3iat mDumu s () rxnmr oatla eauvols)sexrxm io1ameelfvi (fsDua(mo;u4apxnmoetltfmDrmu p;u)tleoioctotla  ln i;(0truo(mpoydaptn fetat) 2rm(mo;u4olt  ietyd s2rm(mo (4aexnmr oy1oatr ivil()seumxr3no1optnlnet t aDtr(m ou1tltn f3iatfa um(vp;u4arxnio3oydlmDean ol(0 eumxo iydap  mieil() Drm(m nt0altn feiaslsDuauvp;()artrifcio1lateaueo;s0seurxmpoudlmeemneia(  Drmuronu0teenmf3iyt s umumpnt4aetrxf3to1opDranvo;s setriopiu4alen ivtls  rua(rp;t1aeto i3tyslm rlnms;t0alxoxr3iatoaDranvs;(0s2uoirpoo4op   fvt tfa2taxm ou0optoii3tadfs ea(vonu4aeermr totlmt aueo;(0s2urirpnodlpee nes s sDtmumpno4apx  fctyslm2eanmpn(4 leoirctotfmDrluvs ()texrim3nydoltn neilt) Draurpnu0olxnifciltlsDemnvpnu0alxoio3tatlmDrlivil( t2xo(r ou4amtn fvsas)aruaxrpoo1tpt  feildfa ran sn(0 rxnxrciodla  aueo;t)s2toxrpoo1lpt mivilsfa2um(m nu0oexo o3tat a ean s ()arxrmrctytlmD lneilt0 rurir nu1lmen nvia(fsrrr(monu4tlxnmf3iys m rmn p;u0arxrmr3iotfa  aivsl() ruoxm3io1lptn fvt sf Dta(rp;o4ope mictas a ulnvon()alxniocoodfmtraivs;s  ruoxm3nu4ap elfvia() Dtaurp;o4opxomf3tysfaDulnmont)trtniocta1fptr n ol( sexm(r io1ome lnvil()sDuau ono1tpt iociltls2ua(msnu) ltnifciydoaDraivi;()t2xrirpnu1lpt mnvi () rtrxmp;u1aeenmo3iatls2rlnvs;(0texoif ootlatean s;(0trtoxmpio4om  liei s) rtmumpnu4tlx  ocildla2rm( on(0 lxrio oydlpDelneslt)srtmxo3ny1lltnlnesl() Dtaxm nu4oex mictyd a2emuvpnt)tlenxrcoy1oa   i i t0 rxrimpiu4lmtnlicslt) 2taxrp;u4tpenmieiytlm eanms t)trermfcoytop ranes;()t2xo(r3iydam emneil()s2uaum nt0aet moeildls rlnmsn() eenmo tydoa eai olt  exoio oy1ap n icsl()aDrmu  ot4alenif3iydlsDumnmp;t0alerir oadlpt aiei;s) exm(r oy1altnliet sf Dtaxm nt0olto ieiltlsDrmu o ()trtrmo3to1fmtran ol( s2xmxr3iu4lm  lici () Durxr ;t0tlxnmfciys s2emuvpn()arxriociytlate ivi;t0trtr(m3io1ol elfci tfaDra( p;t1teenioeildlsDrln pnu4treomocty1op elu s;s) exm(opnudomtemfvsa(f Drruro;o4tlxo fciasfs2elu s (0aexrirciatoa  ai s;t0 2xoio3no4oltn fcia(faDta(ro;u4aptomoeiaslaDem(vpnu)artrxocoodfa  ai i;s)seumxo3oodol  lfvils) Dta( p;t0optn ietydlsDra(ms;u0tetnxr3tydlaDe nvi;( texo(m3nu4ap emfctlsfsDumumpnu0oltnifcildls um( ont0aexnxo3tytomteaueol()s2um(mpio1lle  ict s) Drr(moou1tpeoiictldlmDeluvsnu4trtnmr3oatlmt  nvolt0s2xr(o3nydam  lfvtlt aDur(r ot0alx mfciltlaDulnvo t)teerxf3ty1la rlieolt) 2trxo3iodal nlncsat  2umu oou0teto ieiyt s2eln p ()alenxf tadfm ran s s  2uoxo3oy1olt lies sfs2tr(m ot1oeeo o3iltfm2raums () lxoxf3ty1op raues (0srtrirpiu4lm e nvs ()s2raxmpou4tpxoifciatfaDelums (4tltoif iatopte n o;t trtm(r iydaptelfetlsf rrrur ;u1oeeniociyd a2rln o;t4trxoxr tadopDr nvsl()seuoiopnu4alen ieia()sDtau  ;t0opx mieiatfm2elnmp;(0tleoio iadlmDe ues t)srxm(o nu1lpte fcsat  2rmxm oo4aeto iciatfaDrm(ms t4altoxo3ootomD  neol(0t2urxr no4ll emfcils  Dra( onu4aex ifeiltla umuvpn(0artnmrciatop  an o () 2tmxm3nu4op  mncta()srurxrpnu1opxn fciaslsDrl(vp (0arxrxocoo1lpDeluvo t) rtmxm3io4alen fvs s)s2umx  ou4oeeo feiys m emump;u) etrmf3oatomDeai o;t0t2ur(mpiydll nmfesa(  rtrum ;u4altn ociydfaDulu ont4tltrxo3io1omt an i;t) 2umim3io4alte ies t) rum(m ou4oex  f3tltla2umn ont0aleoio todla e uvi;s teto(o3no1amtnmfeiatf ruaum oo0aetomfciysfaDuluvont) reomf3ia1la elneo;t0s2uo(rpoudlp n fctlt  2tmxr ;o4oltoif3ilsfmDrlnmpnt)tlxrmr3iotlaDe u i;s seum(opny4ol  mnet ( s2rmxmont4tetnmieiad sDumums;u4tltnmo oy1opDe uesls  2xmim iy4openlneil(fsrur(ro;u0tee if3ias a2uluvon(4 exoifcootlaD livs;(0 2umiopny4lm e nctlt srrrumpno0ale mieiasfaDemn onu4 renmfcia1omtr ueo s setrim3nu4altemnctls sDrmu o;u0tlenmociyt s eauvsnt)aeenmocoadfpDran olt) rum(m3no1al  lneslt) rum( p;t0ole mociyslmDua( s (0trxoxr to1fp  aiesl()srumir iodlmt lfvtatf rtmur no1olxoioctldfa elu pnt4aexoxf3tadfp e u s;s)sruo(opiu1lm emfvi (farua(m no4aeenio3ilsfa2ua(vsn(0 exomo3oy1omtrauvi () eto(rpiodome lfci t artr(ro;u0alxo o3iydls2ulu o (0aeenmr totomteanes t)trtoio iy1lltemivtltfsrurx  ;u1open i3tyd a2rluvonu4tetnxr oy1oaDr ivo;s trxrio3oodal emfviat aDua(m ot1tle iiciytfs ea(vo u0tlxomr3ty1la r i o () rxoxrpnudam nlnet t) Dua(rp;u1ope mieiydfmDumnmo;u4trenxf3totlpD  ivol(0teto(o no4omtnlivta(fsrrrur ;t0open feiysls2umu sn(0aexoxrcoatfpD au i;(0sruo(mpno4ap   nvtl( sruau  no0tetn f3iyslmDrlnmo u)texomf iodomt lnvs t t2urxmpny1om nlfeia(fs2taumoot0opx ioetadfm emnvpnt4tltomf oo1op raneo s)seurim3oodoptelfcs ()s2rr(rono4altomi3tas sDem(vont0 rxnir3oatopt au i t0srurxopou1ol elfvias s2rm(rpno1oetn feiydfm raums t) rerifctatomDrli o (  2xo(r nodlmtnmfesasf rtr(r nu4alxomi3ils sDumnms;(0 rtoifciadfat  uei s0 rum(m3ny1amte ncs s) Draxmoou1optomf3tlslaDra(vpn(4tetrxo oatlpDe ivol( srurirpiydame mieiasfaDrru p;u0apenio3iltlm2emnvs u4 etoif3iotfp   nvo t)s2trxr3iodll emnci (fsDumu ont1openifciltlmDeaumo;t0tleomfcoydfmDran o;t texriopnudome miet ( artm(roou0apto octasla rmn s (0tltomr3iotfmt lnes t) rtr(o3iu1ameelncslt srtrurpoo0tlt  o3iaslm2em(mon(0tlenmr ootfpDran ilt0t2uoirpio4lm nlncia(  Dumumont0tpx  ociadlsDranms t) exnxrcoa1laD luvo t0srxo(opio4omeelfvtas a2umump;o1aleo ieiysfa2emn o;(0aetrxr3tatlp eli sls texoiopoodalt mfvt s s2ur(  oo0altn f3tat s umu s u4alxomo3totlp  auei t0sexr(o3iudlp n nci s  Durxmont1alxn ieildfa uln o;(0 ltrmr tatlp r i s;(0tetm(m oy1alt  ivtls a2um(root4tee mi3ilt s eln sn(4trenmf3todoaDr u i;s)s2xoir3iydlp n fesls aDtrumpnt1tetn octadfa raump;t4 eerxr3oydfmD lu s;( srxm(m3no1lp n iet s  2rm( oou4opeo octytfm2eanvo u) lxrirciodlmtelueo;()trtoir nu4lptn ncs ( s2rmur ot1tpeomoeiyd a emnmsnt) lxrxo iodopt  ues ( trxr(m io1lmtnmiciltfarrmumooo0teto feilsfs2ra( o;u)aexrxo ty1fmDeaivs t) rxmio3oudol   fetas)s2urxm nt0tlto ictas a2umnvo u) exrmf oa1opt auesl(0t2uoxrpny4llt livtl()aDtrumpou1teeo ictlsfm ul(vo t4trtrioctydlaDraues;(0 rurxr oy1lm elnvsls sDrrxro;o1tlxomociysfm emumo ()alxrxr3tydlmDrliei s0s2tr(mpnudam e ictl(  2tm(m ;t0opxo i3tysla2raumo ()alerioctytomt  n o s0srxr(mpoo4ap   feta() Dta(mpno0olxnmi3tls aDrmn o;u0 exomfciadom  lneils0t2toir iu1llenmnvtls  2trum ;u0olt mi3tldfs2ea( pnu) rxoio3oatop  lieo s)truo(o3no4optnmfct (f 2uauro;t1oeeo f3iys a emuvo;()alxnmrciadla rln i;s  exo(m3nu4ome mietltf Dtaurono1aexnio3tadlsDulums t0aetoxo3iodlpDean i;s0srumir oy4lmeelivt ( s2rm(rp;u1tleomfctldls2umuvonu4 exomr iy1op r nvo (0 rtoim iudol  mivt sf 2ta(rp;t4aex iictadfsDuln onu0 eeomo totomte neslt0 rxoirpiu1op e ictl()a2ur(r nu1opxo octltfa rluvo;(4tetrmr ia1omDelieil() euoim3ou1altelneilt a2tax o;u1tlen fciasfa2uan s;(0 reomr3tytfm e uesls0 2xmir oy4om emfeiat s2uru p;o4olxo ictasfs2rl(vo (0alxnmr oadomD lieo s srtmir nodll n nvsltfaDrrxr ;t0opxomo3iyslm emnmo;() exrxr todfmD lnvsls) exr(rpoo1lle liet t  Duaump;t0tetn feias a2rlu s u0 rtnxr3ta1fmtraues;(  rxmiopoudal  miesl(fa2rrum nu0tpx ii3iat sDrlnmon(4alxoxo3to1omt lueo t srxo(m iodlm n ncsl(faDrax poo1tlx mietlt mDrl( o;()tetnio ootlmDr uvol( srumir3ou4ol  lfctatfaruau  ou1tpt micildls2umu s;t4arxrxociatfmD lu o s seurio3iy1lp  lnes t s2rmu pou4aptoifetltla2ea(vp;(0tlxrxr iy1fp ran slt0 2urim ny1lpee fvi s)s2ta(mo;o1opx  fctadfaDum( s;u0 etnxr3iotfatrlivil(0srtr(m ny1am   iesls  2rr(m ;u4tle iieils s2rlu pn(4tetoxr3ia1oatraueilt)trtrio3iu1aptnmfetl()sDtrxm no1tpen i3iadfaDra( o;t0tlermoctytfp eau s t trur(opnydomtelicslt) rrau o;t4altnii3iltls ua(msn(4texoir3oy1oaDr iesls setrim ou1lm nmfcslt)sDrrum ot1opxnmfciaslsDra(msnt) exrxf3oodlmD auvo t t2urxm io1op  mncsl(  Drm(rp;o1tlxo oetytlm2uanms;u4arerir3ia1fpte uvol(0s2tm(o iy4lptelnetlt arur(mono0oetnifeias m umu onu0alxrxr3ty1fmDeanesl()t2ur(mpoy4am nlici ( sDtmx ono0aleo fctlsfs rl( o;t) ltomr3iy1lp   nei t) rxo(r3no4omen ics (faDta(mont0ape  f3iat mDuanmo;(0 exoio3oadlptraivo t)trtr(mpnudalenlivs s) 2rmumpoo0tltn fctydla2elums u)tetrifcty1laDr uvi (0sexmxr3iu4ale mfei ( a2umxm no0oleniieiatfs2rluvo;t) rtrxrctadlmtrln i;t0 etriopiu1lmeelnet t)srta( pnt4tet ii3iasfmDemn o;t)tlxrif to1omteai s;s  rtrio3iy4lle lietls s2rrxmo;o4oexoif3iatlsDrluvp;u0 lxnirciodoa r ivols)srxoim3no1omeelfetas arrmum oo1tlto fetlt a2elnvsnt4trenir3iy1fa eaueils teurirpny1ape  ivtat) rtmur oo1opto f3iysls ul( snt0 etnxo3ty1la r ueo;s0sruo(opoo1om nlnvia()s2rau  nt4tpt mietadlm uanvsn(0artrxf iy1oaD  ies;t0sruoxo ou1ame lfeta( arrrxmo;u4olxnmociys a2rmu snt) lermo oo1lmt li s;( s2uo(mpoudoltnmnvi ( a2tmur ou0aleomo3iydfsDelnvo;u4 rtrio iytlpDe u o s t2umxrpoy1lmen iei s arra(r nu0openmieiasfs ulu p;(0 ltrxfciytfmteaues;(0s2xrxopou4lle mneta(f 2tax p;u4tpx mo3ild a ean o t)trenxo3tydfpt au i;(0tetoxo iydll n fcsa(f Drmurp;u0opt  ociytls um(vo t4 rxoxfcto1faD aiei;(0s2triopno1amt  ictlt  2rmurp;t1alx  octas a rau o (4tlerxf io1opDraneolt t2tmirpiudole licil( srtr( oot0tleniicias mDrl(vs u4arxoxo3tytfp rluvs;s0t2umxmpiodlmte ieiat  2rr(mpoo4tleomfeiatlm2eanvo;u4tlxoxfctodlaDelnvs s srxoxm iu4lltemnvsa( arurumoot1aeenmiciyslm2ul( s (0 etnmr oadfa   n s;s) exo(o3nu4olee ici ( aDuaur nu4optomociys mDemuvo;(0trtnircta1oa eanvs;()t2toxo oodolenlnetlt) Drru  ;u4olxnmietytls2rln p;(0 lxriocoy1lpDrai o t)setmio3oo1olte ncil(fsrtru  ;u1tpe ifeiat s2el(vs u4texomfcty1la  ai i s)setr(opoudoptn icilt aDtmxront1tee  feiad m2rmn s;(0aeeoxocta1optrlies t)seuoirpnudam elivt (  2tax onu0opt moetysfaDelnmsnu)tetoxf iytfpt lu o s0s2ur(o3io4oltn iciat srtmu o;t1optn o3tatls2el(vont4 lxrxo todoa e ieols0t2tm(m3nu1ap e icta(f rumx pnt0ape iieiltlsDeanmp t)trxrmrcoydfmDr ivi;s0 ruoxopnu1oltemiesl( sDurump;o0oltn f3tadlsDranvo;t0aexnmo3iadopDelivil()tetmio3iu1optn fcsl()a2tmu ont1tex  i3iasfm2umnvp;t0 etoif oo1faDeln s ( t2xm(m3ou4olt lneilsfaruaxm nu4apeo fetldfa um(vs;t)arxoif3tydlpt li s;s)t2trim3oydll  lics ()arrau pou1ope  f3iatla umn snu4tltoir ia1lmD an s;()s2uo(rpny1lle mivsasf 2rm( poo0texn i3iytlmDul(vs () lxrmf oytlm rli sls0teur(m3oo1lp nlfci ( s2tr(rpno1oex mfetasfa2ua(vpn()artrirciatfm   ieils)sruoimpoydlmte fci t)arumumpnt1apto oeiatlsDem( o u4aexoif tydlptranvolt  rxoim nudap   fesl(f 2uaxro;t4aeeoioctasls2uanmonu0altnmo iy1fptr u ils) exmirpio4ll n fei t  2uaur nt4tetnmfcils s ranvp t) eerir oa1fmDeluvi;t)sexmir oo4ap nlfvil()s2taurooo4oex  f3ils aDelu o;t4 etrmr3iydlm  lu s ( seumimpnu1omen ivils aDrax  ;u4openifctad s ulu pn(4trxniocia1om rau ols0srto(o3io1ll  mfvi (fsrtaurpoo1opto ictlt mDeanmsn() etoxr3oadfp e u i (  etrimpiu1lmtemicils)s2tmur ;u4aex  octytla2umump (4aexrif3iydlpteau s s  exr(opoo4lleelieiasf Drmu poo0tee  ociyt a uanvpnu0aexnio3ia1laDr nvilt)sexoxm3iydaltemict sf rtr(roou1tle ifcildfm emn on(0 eenio oytlmte uei s0sexm(m3ny1ape livt ( srrrxmooo1oetn fciatfaDranms u0tlxrmo ta1oa  luei s teuo(o oydll elici (  Dum(  ou4oex  f3iydfs umu onu)artnxf3iotlpDe ieils  2trxm3iu1am nmnvtat srum(ront0opxnioeilsfm2raump;t)trxoif tydopt aueslt0 eto(rpiodapt  nvsas)aDtmxmonu1tltnifctydfs2em( onu0arenircio1oatrlnvo (0 2ur(mpiy1alte feiatfsrtax p;o1aeto octytfs rl(mo;t)altrir totopDrauvi (0sexrxo oodomtnmfcta()artmxmpnu1open fciydfs umuvs;u4trtrmf3oodlptrlnes t)srxrio oodalt lfet t) Drmx  ;t1alx  i3iatlmDuanvs;u) lxomfcoydopD anes;(0t2xrxopiodal  lnvtlt)s2um(moou4tlt moeiytls ua(vont0tetoxrcoy1op rln o ()s2tr(mpnu4lpen ncsltfs2tmu  ;t4opxo o3iaslm2rauvp;t4 rtriocoytfmDraneo;()trumiopio1om  lietl()aDra(monu4oeenmieiasfm2ea(ms;(4aexomf3oo1fpte n i t) 2xoxopiu4ol  mfci sfsrtaurooo4apx mi3tasls elnvo t4tetnio3iodoatrliei s) 2umim3oydap nmivt s)sDta(r ot4tet io3tad aDemums;()areoxfcty1omDr u o t0 eum(mpiu1opeemncsa(  rtmxmpnt0oleomictysfmDua(msn(0 rtoxo tadlp eluvols  euo(o3ny1apeelnet (fsrua(m ;t1tlenmo3iaslm2rauvsn()arxrmf iydoaD  nvsls)t2xr(m ou1oltemietlsfs2um( pot4oltn ocias m2emumon() lxrmrcio1oatr uei;t)teurim3io4am emivils  rtrum nt1tlxnif3iatfs emnmsnt)altrmociodlmDelieo;()trxriopio1apeelfes tf Dtm(mp;o0alx mo3iltfsDuaums (0 ltomo3oadlp   n o t)trxoio iudomtn fvil() 2rrumpnt0optnmfeiasfs ra( p;t0tltrxf to1omt  ueo;s0 rtrxo ny4lme mfvs () Dtrurpnu1aeen ieiltfa2elumont)alxnxociodfa  an ilt) 2urxopio1ap nmiei (  2ur(  ;t1aexn ocild s ulnvo ()trxomocto1op  aivols0t2trio iudlme lics (fsDumx  ot4olxoioeiytls2emn s u0aetoif3oatoa elnvsl() rum(mpio4lpenlieslt sDtmur oo1oleomfetytlmDeau p t0aetnifciodomtr n il( tetm(m no4optnlivi t) Dtaum no0oexnmoctldlsDelnmo (0aexnxrcoadopt  nvolt s2trxr nudoltn ncslsfsrrau  nu0opxn feias sDrm(vont4teerir to1laDrau i;t) rxoir no4lptnmnet (fs2rm(mont0optnioeiad s2rlu s u4 rxrio tadoa eaivs;(  rtrim iydlltnlnvi sfa2ua(rpnu0tlto ocild s rmums;()trtomo3oa1lmtrln i () rxoxm3oo4alenlics ()a2ua(mpnt4tee mfeiadlm uln sn(0 lerir oodlpt auvs s s2tr(m iudop e icsltf Drrxr ;o1ape ifctlsls el(vo (0artrmfctydfmtrlues (  2tm(opny4ap e ivsl()s2ta( p;u1aleo icilt aDuan p () rerif3oadfaD lieo;() etmxopiy1lle micslt) Dtm( pnt1alenmoetydfaDua(vont)trxnifcta1opDr ivo;(  rxmim iodame mivilsfsrraurpoo4olenif3iltlaDra(mo u0trtoir3oadoatrai s;t0 2ur(m iy1altnmiciat)artm(rp;o1aexn fetysfm elnvo t) etrmrciatlaDr iei;(  etm(o3iy1lmt mfeiasfsrrrum ;u0aexoioetydfmDumumo t) eeniocootfaDraiei t0trtrxr iudomeelncs tfa2rmumooo1alxnmo3tlsla2eln o;u0alenxociydoa ranvilt0seur(o3iu1amt mnvilsfa2rrxmont0tpeo f3iytfm2ul( pn(4teerif oodfmD  i slt) exmxo3ny1om elncsatfs2uax pnt4opt ifeias mDua( p u0tlxrifctadfa elivo;s)t2urxopoy4omeelfeiltf rrr(mont1oexn oetytla2ulnmon(0trerxfciodomt  uvo;t0srur(rpno4olen ivil( arrax o;u4oeeomfeilsfa2emu s;t) ltrir3oo1fmDean sl()t2xo(r ou1amte icsls)artaur ot1tet mf3iys m2emumsnt)trtnmr oy1op eaies;t) 2tr(r3nu4ope licsasf rrm(rpnt4altnifeiys a2rlnvp u0 ltrxocoydlaDr ieslt setmxo nu1ap e ictltf 2raurpou4tltnmiciasfs um(vp u)arxoxf3iy1la eaivi;( texo(r ny1lp nmnes t sDuaur ;t0tltn feiytfsDeaump () rxnxr ty1fp  anvo ( srxrxr oydlmeemnet ( srta(  ;u0olen fciaslaDrlums u)aleoif ty1fatrlieo s) rxrim iu4llenlfcs (fs2uaxmp;u1opx io3ias a eau pnu4trxomf iatfm rlueslt0 rxmio iy4lpte fcil(farrr( pnt1tlto fciysfs2umumo;(4alxomocta1fmt auvslt) rxmio3iu4ll n ivtls)a2tm(  ou1tlt  feilsfs uauvs t)aetnxf todfmD  uvsl() exo(o iu4al e nesa()sDraumpno0aexnifetat mDrluvp (4trxoir ty1omDrluei;()s2xmxm3iu4opeelivs t) rumu pnt0aeeoii3iyt m2emnvont4tltomocoa1lmDeauei s0t2xmxmpny4lle  icia(fsDrmx oot0ale iieiydfs2ea( s t4artoio to1fatran i s0t2um(o3ny1ope lnet s) 2ua(m nt4texoiieiytlaDrmuvo t)teerir tytlm  lnvi s  exmxopnu1amte ietat)artaur ou0oex  fetys mDrmn snu4trxrxo3iotlmDr nes;( trxr(r iodllenlnci s  2uaxro;u0aee io3iadfsDrl(vsnt4 eerif ootomte u il(  ruoirpnydlm n ivslt srur(  nu4alenmieiytfsDeln s;(0 rtoir ootlm rlues;t  2xmxr oo1om emnesatfsDum(mont1tpxnioetld m eauvsn() rtnxr3tatlp  auvslt0 2ur(r3oydaltnlictasf Dtr(root1tpto octatfm2rluvpnu0 lenxo tadlaD lnvilt0 2xrxmpiu4ale mnct t artaxr nu1tee  f3tysla ra( pn(4 eenxfcoytoa elnesls)s2uoio ou1optemncslt  rrmx oot1ope ii3iyslsDran s t) etoifcoodlp  livil( texrxo iu1am  lncs (f Drrxrpoo1alxn oetyslsDulnvsn()arxnxo ootlm elueo s0 exr(opoodlpte fctas)s2rrxmpnu1tleomi3tlt mDemnmp t0texoiocoo1fmteluvo ( t2tmio iy4lp nmfvtas)sDua(  ;t4olxnmfctlslsDra(von(0arerircta1fp rlies s0srxmxo3nu1al  mfvia(faDtru  nt0oexn oeiysfaDrlnmo;u)texoxfciodlmDr nesl()srtoxm3no4omtnlivsas) 2trxmo;u1oeeoifeiaslm2em( p () eenir ta1la eln s () 2tmxm3no1lp n nviltf Dtmumpot0tpe  oetyt s2ranmo;(0trtrmf3ta1fptrluvol() rtmir3no1lm emnvi s) Dururpnt1tet ifctlt mDra( o u0tetoio3to1oateaneo (0s2toxmpnu1al n fesl(f rtau o;o1oeeomi3iytls2em( ont)teeoif tadoaD aueslt) etmxm io1lmenmicia(f rtmurpou1tpe  feiat mDrmump;(4 lerxo3oo1lm  ln o;s)sexrxmpny1ape lnvtltfsrtm(mp;u4altomietad a ulnvo;()tlxnxocootfat an ils0texrio oudoltemfes sfsrrmump;o0aetoiiciyt s ulumpnu4 exrif3iy1lmteaivs s0 2xm(opiu1omenlnesasfsrtru ont0alx io3tad aDrl(vo;t) lenmo3iodlaDrlivs;s s2tm(o3no1al nlfvi ()aDtmum ou0opeoif3iatlm2emnmp u) renxo todfm rai o (0t2trxo3io4omt mfcs ( s2rau pno1tptnio3ias mDrmnvp t0 ltoxr tatfmtelu i;(0 2toxrpiy1op n nctlsfsrtmxr ;t4aee iieiasls2emnvs u0trxomo iytom   ivilt) exoio3iydaleemnetls)artaum ou0oet  o3iytfa em(msn(4trtrioctadfat  iei s0truoxopiy1openmiei s)sDrax p;o4tet ifcils a2elnvo u)trermo3oo1om   uei;s srtmxr3iy1apt lfct tfs2raxm nu0oexn octysfaDraumo t4tetnmoctotfmtrlivsls)teumxmpoudap   fvias s2tm(  ;t1apxnio3iasfm2el(mo;u) eerio3oa1lpDrliesls)sexmxm3nudom e ivi t sDuauroou4texniicils m elumo t4texrxr oo1oatelies s0t2uo(o iudal n ivsa( aDtm( o;t0tpt ifetydfa eauvo u4alxriocio1faD lnei;s0teumxrpno4amt micsls  2rrumoot4teeniocilsfsDra(vo u) lxrmrciotlptran i s  eurirpoydalte fctlt) 2rauroou1oeeo iciys m um( p t)alxomf tatopDe nvilt)srxrio no4omtn fcsas  rtm(mpnu1texnifeiltls2uln o t4trtomfctydop   nesl( t2uo(r nodapteliei () rrrxr nu4tltnmocils s2rmnvo t0trxnmf3iatfpD  uvi;() rtoio ou1op n ics (fsrurxrp;o1texomoeias a elnvo;u4aexrmr3ia1lat lnes;( s2uriopny4olte ivtatfs2urxmpoo1oetn oetytls emu ont0tlenir3tydoate ivo;s0 euoxo3nodapte ies ()aDtm( oou4tltn fctys aDrm( p u4aexoio3iy1omDe n i;t0 eurxmpno1apen nctlt) rtaxrooo4aex iictld m2uanvo;(4texnio3ta1fa rauvi s0srxoxr nu1lm  mfvt s  2ta( pou4alxomo3ildlm2umumpnu4areoio ta1fpt livo;() 2uo(r3ny1apteliviat)arum( pnt0aeen octyt m elnvp (4 eerxrciydoaDrau s () 2tmio ou1amtelnvils) Drmx oot0oltn feiaslm uanmsn(4alxrif tadom e uesl(0sexmio3nodlp   icsasfs2urx p;o1opxnifeiad aDrl(mpnu) lxomo io1lpDrlneo;() euoir nu1ll n fcsas) Dtmum ;u4alt iociatla2umn onu)tetnxo iodlatrln ils0 ruriopiodal nlfeil(f 2umuront0tex io3ilt a2rmnvo;(0 ltrioctytoaDean sl( srtr(m io1olenlieta( srtmumonu4apx ii3iad mDuanmon(0 etrmo oa1optrlues;t0srxm(m3io4ameemnesas a2rm(rpno0aexomf3iadfm emuvsnt)teenxr3iodlmt luei;s0 rumir3iudolen nvt t) rraxm ot1optoiicils s umn p;t0alxoxo3iotoaDraieils0 eum(r oo4am e fvilt)s2urumo;u4oltnioctldlm emn pnu) ltnmf3iatopteanesls0s2xmxopoodlle mietlt)arurx pot0oleniiciatlmDea(mp;(0tetrir3oodfaD lneo;t  exo(o3iu4am nmnetltf 2trxr ;u0tptnmf3ilsfm2uln o u0tltrxociotop rlnvs s)sexrio oydlp nmnvt s a2tm(mp;t4opeoifctat s umums t)tlerif3ootfpD lu sls)s2uoxm3ou1lmtnmfvs (fa2rrx o;u4aexnif3iat aDumn snt)teerxf3iatfptrlu ils0srurxopnudap   fesls)srraumo;u1aleo i3iaslaDrluvont0 exnmo oodopD aivo;(  eurio3oudol  lnvil(fs2urum ot4tleomf3iyt sDrlnmo (4trtrir io1fa  li i t)t2urir3iu4lp   nctas)s2ta(mp;u0tlxn oetydls2rluvpn(4 lxnmrctytfm rlnvo;s  rur(o3no4ope mnvsas sDururooo1tetoioeilslsDem(msnu4trenxocootfa e nvs;s)t2umxo3nu4ol nmfcsas  rtr(m ou1apt iociatfa eau s u4texoxr ia1lmD lieo;(0 2toir3iy1aptnlfvsasf 2tm(mont4oltniictydlsDrm(mpnu0tetnxo3iotoatrluvi;s0 euoiopnu4omeemncsasf rumxrono1teeo ocildla rmnvo;u)tlerio3tytomte uvils  etoir3oo1lmeemfet s)a2rmurp;o4tleomi3tldlmDelnmo;t0alenif iadfaD  ivslt0trxrxo io1opeemfcta(faDtrxrpoo4alenmf3tlt mDrmn pnu0 lxoifcio1optrln sl(0trum(m3iu4ap e fvt s)sDtrxr ;o1tpenmf3iad s eanmont)teerxf3oadfptelnvo;s)s2ur(o oudap nmfviat artr( pot1alxo feildla2em(ms;u0 exrxf iy1fp   n i;t) rxoxopno1optnmncia( arra( ooo4alen oeiadfmDuan pnu0tlerifcio1fmD anvo;()s2toxr iu4omtemfesas sDrmu o;t1opeo fctydfmDrmnmo;u4artnmo oy1optraivi;s)seumirpnu1ol n fesas  rumx oot0opxoio3tltla umn s;t4 eerircta1fmt auvo s)srtm(m nodomen fcils  ruaumoou1oetnmiciad s2ua(ms;(0trxrir3tytoa r ivs;s0 eum(o iydamtnmivt ()arrrumo;o1aexo fctldfmDeln snt0alermr iydlptrauvi t0setoxr3oy1lpt mictas)a2rrx  ot1tptnmfeiydlaDrl(vsnt4tetnxfcio1oa r ueo s0srtr(rpny1aleemfcsatfa2rm(root0tlxnii3iysfaDea(mp u4 eeomr3ia1lp  ai s s0trtriopnu1lpeelicsat) Duru ooo0aptoiociat mDum( sn()texrxr3iotlp elu s;s0 2trxr3nydom  lnetl()sDrmxm ;o4tlxo fctytls eanvo u)aeeomf3oatopDrlu ols  2trxo3oodole lfcsas)srrrurpou4apxo ictatls elnmo t4tetoxf3ta1faD aivsl(0teto(m nydlpenmnvs tfaruaxr nu1tlt ifciltls ul(mp t) rxnmr3oadlaD auvo;s0srtoxmpoydlmt  nvi t s2rm( poo0tpeomo3ils m2ua(vont0artnifciytfmt auvol()trxmim3nydlm   fct ()sruaur ot4tex  ociad mDrlu o;t0trenxr ty1late uvo;( t2uo(rpio4lltnlicta(f Drrx  oo1tpx  f3tadfs2elu on(0alxoifcty1fmD lu i;t0 euoim oudlmtnmiesa(  ruaumoou1open ictls s rl(vont0arermf3oodlp  lies;t) rxm(r no1ameelfctlsfsrta(mo;t4oex iietasla2ranmonu4 leoifcio1oa   ueo s)t2xmxr no1op elics t a2ua( ont0aeeomf3ildlsDranvp t) rtrio3oydopDrlneol(  2trxrpiy4openlfvtat sDtm(mp;u4apenmfctldlm2ul(vont) renmo3oa1op r ivil( seurxr3iu4lm  lfeslsf rrr(r ;t4aexnioeiat a2uau p (0 leoxf3totlmD  uvi;s)trxrio ou4ame lics s srumurpou4ale  oetls a rl(von(4alxrmr3iadlmteau o s0 rxmxr iudlp elivs tf 2tru ooo1opto o3tyslmDum(vo ()tlxoxo ta1lmte ivi ()s2ur(rpoo4lm e net s sDur(  ;t1texn ieiat mDrmnvpnt0tetnxo io1fpDr nvi;() rxoim3io4lptnlfvilt arumxm ;t1opeo ietydls2rluvo t0 lenxr3iydom elivo;(  2uoxrpoy1ope  iesa(fa2umur oo4tltn f3tys a2ean onu0tetoirciodom r neo s trxrim3ou1ol eliet t  Duaurono0ope  feiytls elump;t0texnmo3iadlaD ln i;(0 exoir ny1op eliviat aDra(root1oltniieiltlaDelums (0trtoxo3tydfm  lu s;s srxoim nu4olt lnvt sfaDtr(r nt4apeoioetas a2rlumsnu0 ltrxf3iadom  lu o t0srxrir3nodomt licsasf Drau  no0oetomoeiysfa2uluvs;t0texoxf iydop  lu i;(0t2xr(opiudlptnmictas)arrm(mpou1tpenif3tltfa2rauvp;u0tlxrmr iodom e u ols)s2umiopiu4optelnvtl(f Dtmum nt1olxnmoeiysfmDelnvsn(0 etnif oodop ranvi s truoxm oydomtn fctls aDtr(m oo4apx  ictytfa2ulumo;(0arxnio iy1oatr nvs;t)srxr(mpnudlpen nci tfaDrrur ;t1oleoif3tldfm2ulnvpnu0tleoircoodfmD  nvolt0teumio3iu4apeemnctlt)a2tmuro;o4tle  oetasls2rlumpn(4tleomr3oatlp rlneo s) rxr(opio4ame  nei sfsDuaumpoo1opxoiieilsfm2um(vs;t4 etrmrctadfpDeln i t trtoxmpno4optn nvsl() Dtrx  ot4oetomfctyt mDua(vs;(0alxomr ootopDelnes;t)s2trxrpou1lpenlnvs t) Draxr ou1tee mfeiat s2ulumsn(4aleoio iotlaD an o t) ruo(r oo1optn iviat  rumx poo1aptn oeiatls rlu p t)aetoir3iadom raivi;() etoxr oy4ap   fvi t aDuru ont4oexomoeias s ra(mon(4tlxoifcoatfaDrlnvil(  rtoimpnudllte ieiltfsDuru ooo4alx io3iyt aDrlu s (0 exriocoo1fmDe i o s)trxrxr3no1omenmivtas  rua(  nt1apt io3iadfa emu s t0aeeoifcta1fpt an il() etr(r nu4omenmici s srta(ronu1aeen icias a rln s;t) etoif tatlpte i slt0 rur(rpio4open neta(farrru  no4apt mfciydlm2ean pnu4artrmr oadom eaieo s  rtm(o iodoptnmnvtl(fs2rmump;u0aexnmi3ild s rmnms u0 rtomf3iydlm ean i ( s2trxopou4apte nes ()srumxmpot0texnmfciasla rl(vp t4arenxrcoo1fpDean o ()srxmiopno1ll  lnvs sfs2umx ono4tetomo3tytlsDrmumo;u4trxnmr3oa1la  lnvi;t0srxoxrpou4lltn ivilt s2rr(rpnu4openif3tyslm umn s;()trtrxo ia1optraivi;()s2xmio3iydlm n fct tfaruaur ;t1oltoifetlsla elnvp;(0 rtnxf3ia1oaDeau o s  2ur(mpny1oltn fctls)s2trx ono4ope mi3iasla2eanvsnt0 eerir iotfmt auvs;(0teuoim iu4al emnvi t arrmx  ;o0tpto ocildfaDul(vs ()alermocoatlaDe ieo s0tetm(mpiy1ole livsa(f 2rrur ;u1oexo i3ias sDumnmont0 ltomo3oydopD aues;s) exmxrpiodop  mici t)srtmum nu0opt miciyt s umnvp;(0 eeoif ia1opte ivs s0trtmim oy4oltn nci s)arraxmo;o1oeenmietytlm rluvp (0trenmr oodlpte ieilt)t2xm(o3nydapt lncs s  Drax o;t0apxnif3iyd s2uluvpnu)trtnmo tytlp  aneolt t2xoio no1lpen nctl(  Dtax  ;t1tpeo i3tls m ua(mpnu4 eeoxrciodop   n s s setoiopoo1alenmfcilsfsDrmxr ;o0olx  i3iytla2ea(vp;u0tltoir iytlp eau s;s0sruo(r oy4apenmnvsltf rumxm ;t0alx mf3tasla2el(vo (0artnxfciydopDr nes t) 2uoirpou1lmeemivsat)aDta(m nt0olxo o3tadfa2rmnmo;(0tetrir to1oate nvilt0 2uoxr3iodoltemnet t)s2raxm ;t4ape  o3iadla rmn s t4tetomr3iytfaDean s;()t2uoirpny4omenlfesltf Dtax  nt0tet ioeiat m rluvp () etomrcto1lmDeauvil(  2to(r ou4am  mivsa(fsDurxmpot4tpeniietysfa uau s u) leoircoo1opDelneils) 2tm(o nu4lpe mneilt) rtr(ro;o0aptomocildfs2el( snt) ltomfcoatoate ieolt sexm(m3oydaltnlnctl(  rururonu4tee  f3tldls2ua(vpnu) reoxfcto1opDrlueo;s) euo(mpio1apen nci s s2tmx  ot0opxnifetls a el(monu0aexrxf io1lpD li i;s s2um(m ny4opt mfcsls)aDumxrpno1oet  i3iydls umu o t0aetoxfciytlmDe uvo (  2ur(m3io4optnmfcs s)artmxmonu4alto fciydfaDemnvp u4aexomr3ia1fmtrlneols0srxmxm ny1ape mfvil( srtau poo1tetnifeild s2em(mo u)artoxfciydlp  aiesls0 2xoio iy1lptemnei t aruaumpnt1alt  ieild s eln o u)trerxr oadoa rlivil()teur(m oodll e fvs t  rta( p;o1tlxoifciat m ul(vp t)texrmrcoa1lmte uvs;s) 2tm(r3no1ap nmieslsfs2tmu oot0tetoio3iat a uan o;t0artrir iytla raueol() exmxo oudaptnlnetas srrmxr nt4alx  fcias aDua(mp;t) rtomf3oytomtrai o (0srumio iudomenmicilt srur(m oo4tpt mietld a el(vs;u) ltoioctadlpD aivilt0 exrio3iu4omtelneias)artm(m no4oetoii3tyt s2el(vo u0 eeomo ootlmt lues (  2tr(o3ou4opt mncs s  rtmur nu1alxomfciysfa ran s;u4 ltrmrcoy1fa rauvo;t  2umim3nu4opeemivs sfsruru o;u4oleoio3tldlaDum(vo (0 lxrmf oo1lm  lnes s)seum(r no4lm n fvsat a2ur(ronu1alx  ieiatfsDumnms;t4texnmfcta1op eln o t teto(m oydlpte ivt t)a2taxrpnu1oexoiiciyt aDumnvp;(4aetnmo iatla r n o (0 exoir nodol  lies t)aDtmur ;u4tlto f3iltfa ua( ont0arxoiocoa1lmDr i o;()texr(mpiodop elivt tfaDtmumonu4oet  i3tlt s ea( o u4texnxo3ty1fm r ies;t teumim io4optnmfeiltfsrtmxm ;u4opxnmfctlt s ua( o () ltnxrcoatlaDe u o t0srtmxm nudopte iei t  2raxrono0tpto ieiadfs emnmpnu0tlxnmf iytopteli il()teurirpio4lmte nvi sf 2umx o;o0tlto icilsfa2uanmp;u4texomociydfpD  i i s0sexrirpoy4llte nciltfsrrmurpno1ole  ieild aDrl( p;t) lenircoy1op rlneo t)srum(mpny1apt mnct t)aruau  ;u4oetnioctytfaDumn snu0 ltoif3tytla  aivil( trtmxopiydlmte nvt ( srrrxrp;u4tltomfeiydfsDemnvo t0aexniocta1lateaneo;s0sruoxr iu1omenlnet t aDraxr ;u1ole ii3tldfa ulnvpnt0tltnmfcoo1fa rlueil() euoxrpnu4omtnmivs s)sDraur ;o4aeen i3tlsfa2ul(mo;(0 lenxrctotlpDr ueo t0 rtoir io1lle mfetl() Dtm( onu0aet  ieils m2em(mp;()tetnir oadoa e ues t t2uo(m nodlpe  fvia( artm(mp;o1olt  ictls m rlumo;t0 rxnxf3to1fa  aies (0t2tmxrpiudam nmivtat)s2taxmono0ole miciltlm elnms t)tetnio tytlmt lu ols)s2tr(r3iu1lmtemicslt  2ur(  ot4tpe  iciltfa emu s;(0 rxrxf oo1fp e ieo;()setoxo iy1al e nei s)a2tmumpot0tetniieiat s rluvp t4trtoxoctytlm   u i t0s2toir io1opeelfcsa(  2tm(rp;t0oet iictysfs umumsn(4 eeomr3oydfa eaivsls0 etoxopiy4opeelictatfsDuru ono0tltnmfeiys s ua(vp ()aetrxr3oo1fmte i olt s2xmio3io4apeemict sfs2tmu o;t1tlt iieiyd mDrm(vp;u0treniociotfptr nvilt  etoxm3iu1alt mivi tf 2rm( ooo0aeenmo3tldlmDra(vsnt0altniociadlaDrau o s)s2uoxm3iy1omtnmiei (  rtrx  ;t1tle mfctltfsDemu p () exoif3tytopDe uvo;s  ruoxo oydaptn feia(  2rrx  ;o1alxomoetls s ulu p;(4arenxrcoy1omDeanvols texoxrpiodllt liviltfsDur(rpno0tlx  fciadlm eau pnt0aexoir totfa eliei (0t2urxmpiudope  ics tf Dtmumoot0tptn i3iytfa um(vp;t4 reoxrcta1oaDe uesls) exmxm3iydape mnci s srra(mpot4altomoeiltfa uluvpnu) rxoircto1fmt aieo s) rum(opoo4omtnmfvia(fsDrm( poo0alxn fctatfs2rauvp t0 exrmo3ootlmtelivils) etmio no4om nmnviasfaDtmur ou1opxnmi3tlt m rauvp;u0 exrmociadoa   ueilt0trtmxm oodlmenlneiatf Dtaxrpno4apt ifeiasls2eaump;u4aetoif iotlmDrlnei;s)srumxopnodlle  nesas)s2umu p;u1alenioctydlaDumn o;u4trerifciodop e uvi;s s2xoio ny1aleemnvsa(f Dtmurpoo1aetn fciat a2ranvs u) ltrxr tatomte uvil()s2toxmpio1al  livi t) rumu o;u1tltoiieildlm uanmpnt4aleomf3tytla eauvo s0sexoir3oydom n nesl() Dtaumpno0aptn o3iasfmDeanvp;u4 etnxf3oa1latran s;t)s2toimpny1lmenlfvt (f 2ua(  ot4oeenioeiysla rmn s u4tltnxocoytlmt aneo;s) 2umimpiy1alt mfeil(  rururoou4alt ifetad a2em(vs;()texomrcty1fpDraneo t) rxoio3ou4aptnmnvi t  2ua( oot0opeomociat a2uluvsnu0 eenxf3oydfp r uesls)srtmir3oy4lpeemivt tfsDua( pot0aeeo iciad m ulumonu)arxrmo tadfp r uvolt)texmio3no4ll nlnct ( srtaurpnt0tpeomoetaslm2ea(mp (4treoxr oodfp eluvsl() rtoio iy1amtelfvil(faDra(mono4aleo oeiydfs rm(vo;u)tlxoxr3oa1omt ai o ()tetoxm3oy1ape lnvt t s2rm(m ot4tee iociltls raump t0texrxr to1lmtraivo s tetm(o3ny1omtnmfei ( sDua(ro;o0tee ioeiytfm2rlu p t) rtoxf3iodfpt anvo ()texrxmpiu4om  lnvtasfaDta(rp;u0oexn ieiydls2umn p t4arerxociy1la   uvs;s t2um(o3iodomenmfeil(fa2trxmonu1optomi3ilslaDra(mp;t4alxrmfcoadfaD aueo ()seumxm3nu4olt  neias  Dra(roou0oexomi3iasla rmn onu)trtnmr3oydoaDrlu i;(0srtrio oudol n nci s) 2tmumoou0olx  oetat s2umuvpnu)texoio3oa1la rlivolt seto(m nu1lmenlfcia()arrr(ro;o0apx ii3tatfsDel( s u4tltrxf3iytoaD aivs t)sexmxr3oy1llenmfctls sDuau  ;o1tpt iieiadlmDumuvpnu4tlxoirciotomDeai s;(0 etrxrpiudlp  lnct ()a2uaxrpou0aeeo f3iltfm2eaumo (0aexoxf3ta1lpt luvs t  2to(r iu4om  mnctl( srurx pnu1tpeomfctysfs eaump u) exnif tatlat li s;s srxriopnydalt livil()a2rm(  ou1alenifciytfs2eanvpn() exrxf iatla  ai ilt0 rumxr3ny4ole  fctl() 2raur ;t1ope iicias m2el(vont0aexomocta1lptraueslt)seurir3oy4lpeemfeta()artru o;t0aetnmfciasfm2em( o () lenmr iy1fatean ils  rxm(m3oo1llt lnvtatfa2rmxm ou1oltnii3iltlm2rmnmpnu0tltnmrcoodla raiei (0 rxo(m nodlptnmivsat aDuru  ;o0tptomoeiatlm2ua(vs t)alxoxfctadfm rlivo;(  2xm(rpoy1olte ivtl(  2uaum ou1alxn f3tad mDuaums;u4arenmr ta1oaD livi t0srurio iu4lm  mivi s srtmurono1oetoii3iadfsDumnmo u4aetoxfciy1oa eaivolt  2xrio nydoltelfct s) rtm(rp;u0oet mfciydfsDuan s t)trxrio3to1fmte iesl(0trto(r3oy4am  mnvs tfaruax  ;o4apeo octltfa2el(vpn()teeoiocoatoptrlu olt0srxrxr3iodopt lfvt t a2trxm ot1aeto fctlsfa eaumpn(4 exnir3iatomD  i s;t0tetr(m oodlmtemnvtlt) rtau onu1oetnioctldfs umnvo;t)alerxrctodfa r neo (  euoiopno4lmtn fvs t)a2taurpoo1apxomf3tad a uln pn(0 eeoxr3ootlateai i;t setmim3ny1olen nvilt)srum( onu1tpenifciytlm rm( snu4artoxfctytlmDraieolt) 2uoio iy4lm n nviatf 2rm(mpno4altn ieiasls2rl(mo () renmrcto1omtrlu i t srxo(rpnu4opte ivs s srtr(r oo1oeenmoctytlsDumuvs;t0aetoxf oo1oaDrai ol() 2tm(o3oudlltnlnctat)s2uaxmo;u4tptn oeiys a uanvs;u4treoioctydoat ai i t teum(r3no1om nlfcsltfs2rrx  ;t1opxn o3ildfa uln pnu4arxnmr3ia1laDr uvs;t) rto(m io1lptn ncslt)s2umxm nt4apxo oeiasfa2uln p u)alxrmocoo1fmDrauvi ( sexoxr3ou4amt  nesls artrx  ;t1altn fetls a2eanmpn(0trxnmo oa1fpDe neilt0 rumxo oydap nlfct (fsDrru  no0altoioeild aDumu sn(4 eeoircoodfatrln s (0 etoio3io4alenmfct t s2tmxr ot1opt mfeiatlsDra(vs (4 exomoctadoa rauei (  euoim iydlp  livtls  2urumpnt1aexoiieiysls eluvo;t)tlxnxf3iydlmDrlivi t)trur(mpiudom emneilsf rtmumo;t4altoif3iytla ran sn(0aeermr tytfmt  ues ()srtmxo iydap nmfcta() rrrxr ;u0tpe ioetat a ran snu4 rtnxo3ty1omDeau s s seuo(r oudam elnes sf rrmuronu0texnii3tltla2uanmpnt0 rtnxr to1fa r u i s s2xr(rpio1op   ietatf 2raxrpou1oee  iciatls2ulnmpnt0tltrmf3tadfp   n ols)srxo(rpiy1ll  mfci ()a2taxmonu0tpe ii3ildfm2ranvpnt0 rxnmo ty1lpt livo;t) etmimpio1apt  ivt s)arur(mpou1tpeo icilslaDem(vs;t0tetoxf oo1fmD ln i;s) eurir io4om e ivta(  rrrur nu0aexnmoeiyt s2ean p u0altrir3oodoa rlivilt0 etoir nudlltelnctlsfsrra(mont4openioeiydls2eln p t4tlxnir3iotfm e u s;()seuoxm3ou4amtn ivi ()srurx poo0oeeo ietydlmDrl(mp;t4arenxoctytomt luvs ()t2ur(r3nodal nmfesas)sruaxrp;u0oleomoctydfmDuau o (4 rxnif ty1lm rlu i;( teum(o ou4opte ncil( sDrr(mpoo0opt iieilsfm2raumpnt)texoxo3io1fpD an o;s0s2um(o3nudoptelieiat)aDtaxrp;t0apenifeiydlmDumums (4artrxf ta1la elu olt srumxr oudapenmnei tf 2rr(r oo1ape if3tlt m2rluvs t4 exnxo iadfpDe i s s setrio3nu4ame  neta()srtm(  ;o1opt mfetatfsDea(mp t) exrir3oa1oaDeaneo;( sruoiopiy4omtnmnct t)aDrr(mpoo4olto fciytfa eanvo ()artrxfcto1oaDr uvi;s0 exmiopiu4llenlnetat)aDurxmont1aeto f3ils s2ea(mon() rxnmrctadoaDeai i t0trumxr3oo1openlivtlt a2urxroou0alx iietadlsDra( p;(0 renxo ta1opteauvil(0srto(rpiydlme mnviat)sDurxrp;t4openiociaslm2emnvp u) rxrio3iotfp r uei;(  exmxopiodol emiciasfsrtrxro;o4olt  ictldfaDua(vs;t0 leoxf3to1omte uvsl( truoimpiudal e ncil(f rumur nu1oltomoeiyt a el(vo;(4 exrxf todfpDelivi;s teumio3iu1lpeelivsl(  Dtmxmont4ole ioctltfa2rm(ms u4 ltriocoatopt an i;s)t2trxm3iu1lmt mnetat)s2tmxr ;o4tpxnioeiyd a2eluvon() lermf tatomt  nvs;() 2xoio iu1ole lfciltf 2ta(mont4ape mieiltfmDrlnmp t) exnxf3ootlmte ivo s0 rtm(o oydlle  netatfartm(r ot4teen ociltfa rlnmo;u0alerxrcto1opDeluvils0t2uo(m3nodlmtnmiviltf rur(r ou4tpen oeiadfs em(ms u)altrxrcto1fmtrlivol()trtrxrpnu1lp nmnvtl() rrmxr oo4tptoifctasfs um( on(4 ltrxfciatfptr u s s)s2uo(m iy1olee neslsfartaxro;o1tlenmi3iyt a2ea(mon()alxnio ty1lp elies;s sexrxopiydame  fesat)s2tmu  ot4tetomoctyd s2uluvont)tltoio to1fmDeauvo t)sexr(opiydomt  nvt sf rrr(mpoo1tpenmf3ilsfmDum(mp (4 rtoxrcoytop   nvo;t0 2tmimpio1lm nmnes ( s2tm(mo;t4apen feildfa2uanmp u4tlxnxo3iy1omDranes;t)s2uoim3iudlpt mivils) Dtr(mpnu1texn o3iyt m rauvont) exrir3to1lpt lu o s0texmirpnodlpte iet t)aDtaur ;u0alx iietldlaDeauvsnu) leoif3totlm eaueslt)setr(m3oudlm nmncia()srrrxmo;o0tpe ifcilsfm2ul(vs;(0tetrxfcoatoa e ivo s)t2umim nudap   nvtl() rrmxr nt0tee  o3iysfa2emu o;t4 renio ta1oa eauvi;t0 rurxr3nudlltnlncsa(farur(ront0altnmf3tltlm rm(vp;t)aeermf iy1op  luei;t) etoirpnydop elieias) Dtmum ;u1tpeomfeiatlsDem(mont4 ltoif3oa1fa r ivol()srxmir nu1om emfvt sfarum( onu4apx mfeilsls em(vo t4teenmocoadlmDrau o;t  rxmir oo1lleelivt ()srtru poo4oeeomietat s2umn p;u)trtnxocootlaDraivslt seuo(mpnydll elici (  2ra( pnu4olx io3tls aDelnmpn()aeenmo3iytlp r ivo;( trto(rpio4ll emfvtls  Drrx  oo0tpt mi3iasls ul(ms;(4texnxf iadfatr ieo t0 rxoir3ou1lp elies t s2tm( pnu1tpx io3tatla elums (4altoio ia1fa elieo s srtmir oy4ol  lfviltf ruaumono1alx mietatfa el(mont)tlxoiociotla eaueo t0sexrirpoodll   fct (fs2rmu onu1aexoif3iytfa2rlnvs t) lxrxfctytomDr u i;t0texrio no1lptn ictat  Dtmu o;t0oleo fctasfm el(mp;t0arenmr oa1fat  ivi t sexm(o io4lme  fes s) 2umxmp;u4alt  oeild a rauvonu) rermo3iotlpDr ivsl(0srtrxr3nu4optnlivtat)aDrmxrpoo4tpxn f3taslaDemump t0texomo io1omDeau i;s)seto(m ou4opte iesat)a2uax o;t4altoifeiysfsDelumont0aexnifcootfpDeauei s) rxmio oydapt  ncsl()sDrmxmooo1apto o3iasfaDuanmo u0trtnifcoodlmtrln il(0 2uo(m3oo4lp emfetltf rtmxrpoo4alxo fctldfaDrlums t4trxrifcty1faD li s (0t2tr(opiudaptnlfctls srumxmp;o4tlt  ieiltfm2ean s;u4 lxrir3tydlm e n sl()trxoxrpny4omt mietasf ruax o;t4tetoif3iytfa uanmp;t0teeoif3tytfmt lnes t0trumio3io4amenmfcsl()aDraum ;u4olenmfetadla emnvs t) eerif totfmt aueols sexmxm io1al e nctas s2umurpnt1ale moeilslm2ul(vpn(0 rxnmo3iadlaDelivi;t0s2xo(mpiy4al   ncia()aDtau pnu1aexomiciaslaDeanms;()trtnmo oo1fpt aues ( texoir3iodll nlictlt)arra(m ;u4aee  feiysfmDeluvo u)tltomrcta1la elnvsls) 2toimpno1optn fvilsfsrta(ronu1oee mictls a2umnmp t4tlxrmo3ootfaD  nvols0teuoxmpiu4lme  nvsltfaDua(rpnt4oet mf3tysfaDemnmonu4 renifciadopD  neo (0 ruoxo3nodopt mics ()aDtau p;u0tltniiciltlaDrau p;u)aexnmr tadfaDelnvs s) 2umirpou4ll   fvsl() 2tmurp;t4tle  o3iasfaDrmu p;t4trenxf3oy1fpDeaueo s  2um(m3io4alte iet s)s2umxroou0tpxoifciys s2elu sn(0arxomf3oodopDeluvi;t) etrim ou4alee nesl(f 2truroou4tee mo3iydfsDelums (4 eeoxo3todlmDrlneils trtrim3ny4ope mnvs t)aDtmuronu0aptomfciys mDran s (4alerxr tadfatr ivilt0texrxopiy1ll   fciltf rtmum oo4teeoio3tltfa ua( pnu0arxomfcia1fpD  nes;t  2toio3iydoltelivs s) 2rrx  nu1aeeomoetydfm rlu p t4 lerif3oy1fmte nei;t) 2umimpnu1llee fci t aDrrumo;o1aee  ietat s2rm(vs (4texoxo ootop   ues;( srxoirpnu4omeelnetat s2uaxmonu0tpeoifetyslaDum(vo u4tltnir3io1lmtelneo s)s2xr(m oy1opee neilsfaDtrxm ot0tex mfeiat s uau s t4 eenmfciotlm rlu ilt0texoxmpio1ame  ncs sf 2rau  no0alxo iciad sDelnmonu)tetrmo3iotoa  an ils0t2trir3iodaptnlneia() Drm( oou1openmieiytla2uluvo t4 etrmocoatfpD ln s t)srxoirpiy4opee ivs sf 2rmu pot1aex  fciadfsDum(mo u)altnir oydfp e nvsl(0t2xmirpnodame  ivs s s2tmu onu4alx iiciltfm ul(von(0 etrxo3iydlpt  n i;(0t2tr(opio4lm emnctlt)arrr(ro;u0apto icils a2uaump;(4tlxrir3oa1laD livils0 2to(m no1al elnes t)srumu pnu0tptn f3ias a el(vp t)tetrxfciatfmDelivs t teuoio3nu4ol nlieia() rta(mooo1ape ifciltlaDuaumpnt0 rxrmr3oa1fmt lnvi t seumxr3oy4ole micsatfartr(rp;t4tlxnmfciydla2uan s;t)texnmf3ootoaD ai il()srxr(o iudamt  ics (fsrumum oo0tltnmi3iatlsDrlnvp;u4altnxo totlptrlueo t)t2tmir3no4omt mivslt arraurpot1aex  f3tls s rln p ()tleoif oodfpD lnvslt teto(o nydll nmies ()arrm(moou1ale  ociat s elnmon() leoif3ta1oa   n olt0teumxm3oy4ale lnvsa( aDrau ooo1alenmoetlsfs2uluvpn(4aexoir todlpte ueilt)t2uoimpiodaltn fvtlt)a2rrxrp;o1olt miciadfaDeanmon(0 rxnmr oo1fmD  iei;t trtrir ou4apt  ncias a2trxr ;o0oetoifeiltls2em(vo;(4alxoxo totfpte nvs s0 eurxmpnudom emfetasfs2ua(rp;o4altoif3tltlaDulnmsn()aeerir3oadlmDrliei ()t2to(mpnydolte nvtl()s2umx o;u1apxn fciydfa ranmon()artrmr3tydoa ranvsls s2uo(mpno1lltn net s)arumxr nt1tle miciadls2rln snt) lenmr3iytfm eaivilt)t2urxm io1ole mnetls)aDrmuronu1apx ioeiytls2ua( s (4artrmo3tydomDelivs t)s2toxo3iu4opeelnci ( artmu pot0aet iociaslsDrmuvp () lxnmrctodfmtrlu ols0t2trir oo4ole  fctas)aDtau  nu4tleo i3ildlm2eanmp (4tltrir3iadopD  i i t)sexo(mpiy4lpt lics s)a2taxr nt0oex mi3iydfs2rmumsn(4tlxrxo oytlm  au i (0tetmxo iu4ole micsa(f Dtrum nt0tpxniictasfa2rln p;t4 ltnmrciadlat  uvils  rurxo3ou1amenmncsat s2rru o;t4teen fctadfa2emuvpn(0aeenxf ta1la rai i ( s2xoim3iu1olee nvta(  2tr( poo1olxn i3tytfa2rmnvp;(4teeoxfcoodlateanesl(  rxrirpou1lptn nei (fsDum(mpot1aet  oeiltlaDum( o;()arxrmrcoydopD auvolt s2xmirpny4om elfvi s s2tr(mpno1altnif3iytfa rlnvsnu0tltrif oatoa rli i;()s2urxo3io4am nlfvtlt)sDtmur ou1teeoiociyd sDrlump;(0tlxnioctotoa eln i;() 2umir nudll   nctlt)srtru o;o4tlenmf3iasfsDuanvs;()tltrmrctatfmDeaivo;( teumxm3ny4amenlfesl()artr(  nt0tpt mi3tatfs ulnmp u4trtrif3ty1lateli i t) ruo(r3ny4oleelfei sf Drrxmp;u4oexn f3ilt aDrmn o u4 exnircoodfat lnvi ()setrxr iodapte fcta() 2ua(monu1apxnmieiadfmDrl( s (0tleomr ia1fp eaivs s0s2xrxm ou4amtnlnvil(f rtaum ot1tpt mf3tas a ea( pn() leomrcoatlmD  n s s) 2toxrpiu1opt miciltf rrrur ;o1opeo feiytfm elnmo (4 eeoir3iydlaD lnvo;s0truo(r3io4lme liesat)srtr(mono1alxn icild aDean pn(4tlxnxr3tadoaDeaues s0teumio ny4omt  ivt ()aDtr(mono0aptnif3ilsla rmn o;u)trtrircoytfa   uvs;()teuo(r3no1ame mfvt tfaruaumoou1tpen f3tltfm em(vo t4tltnmr iotop raues;() 2uoxo iydamen feiltf Durxrooo0tpen i3ils s2emuvs;(0texnmf iy1lm r i i t) 2xo(rpnu1ole lnvil(faDra(mpot1alx moctatls2rauvs u) ltoxrciy1opDeaieilt srtrxr ou1ap n fesa( sDur(mpoo1olenmo3tldlmDem(vo;u0tetnxrctatlaDean ilt0trtoir no1amee fvi (fsDrrxm ot0optoioctydfa2elu p u) ltoxo oa1opte nesl( s2urxrpoy1lpeemivtl( aruaxr nu1teeniieiytfsDemn pn(0 etomo oodlm rli i;s0t2uoim3iy1omeelivi t)arrmx pnt0opeo fetlt aDelnmo;() lerxf iytoateanesls0srtoxopnudale mfvs sfartru oot1ape  oetydfsDrm( on(4trerxo oadoaDeai s ()s2urirpoydoltemfctl(f 2tm(mp;t0olxn ieiys s umumsn(4 exrxr tydfm eli ol(  2to(o oy4ol  mneiat)sDtr(mono4oex mfeiad m elnvp u4trtoxf3oytop e nes () rumir3oudlp n fvsls srrmxm oo0tptn i3tasfa ulu s;(0trxnio3iotfptelnvol()t2tr(r3iydll   fes sfsDuaxr ;t1tlx if3tyt a2rmuvont)texrmr ia1lmDrai o;t0s2urxrpny1llte nct (fsrtmx pno1tlen f3ilsls ranvont) exnir tatla rlneo;s)trtmxm3nudomtelfetlt)sDrrx pou4tpe  i3iatfa2elnvp;t4trtnxo3iytlaD  ivo s t2xm(m3nu4ll elnvsa(fsrua(rpoo1aeenmoctatfm2em( o t)aetniocoytfp e nvo t0 rurimpny1llenlfcsl( srtr(  nu0oetomoeiytfa ulu pnt4 etrxf iytfpte n ilt)t2umir iudllee fci (f Dtrxmo;u4oexoiictad s emumo;t4tlxoxf3tadlpt  uei;(  rtoir oy1amenlfes s arrmxmont1tee mfeiltfm ranvs ()tetomociatfp raiei s0seuoir3iudole liviltfaDumxm ;o1opx ifciatfa2ra(mp ()texrirctotoaD aneo ()trxo(opiy1lpte fvia()s2rmxr ;t4opxomoeildfa2elnmo;t)aexrmfctodomDeai o;s srtmxo oudlm elnviasfs2trur oo4tetomicilt mDuanmp;(0altrmrcoa1lm raivo (0 etm(m3oy4al  lfvils s2tm(r nu1tpxoif3tasla2ulnvo;u4treomociy1fa e i il(0 2uoio ny1ll n fes () 2ra(ro;u4optn oeiad a uanvont0aexrxo oytfmD au s;t0s2xoim3oodapeelfet t)a2tr(  ou1alx mo3tadlaDeluvonu)trtoxo3todop eaieils) etmio3oy1omtnlncias)srua(m ot1oexn i3tytla ua(vo;t0alxrio io1omDraiei s0setrxr iu1amtnlnet tfsDurxr no0alenmoctld m2el(mpn(4artnir to1faDeauvolt seuo(opoo4amt licsl()srumu o;t0tee mociatfmDuln p;t0arxrmo3tydfa  lu sl(0s2umim no1apt lfcilsfsDrr(mpou0oeenmi3iaslsDul( s;t0 lxomf totfp elnvsl(0 eto(m3iydom  miciat) Dra(monu0tlx  feiaslaDulnvs;t)arxoxr iytom eaies t) 2to(m oudal n ict (f rrmu p;t0aleniiciysfm rm(mp (4texomocoadfa eli s;s0t2xrimpno1lm e fei ( a2rm(mpoo4aet moctldfs eanvo;u4alxrxo3oa1faD aiei;t0 2trirpoodamtnlnctls) 2rr( oot4tpx mietyd a elumpnt)alenio3iydlmDeluvols0trxo(o nu1alt  nctl()srur(m ou4olt mfeiatlm2ulnms u0arermr3oadlp rlnvil(0 rxrxo ou1lmtelicslt)s2trxronu1opt ifeiltlmDulu pnu4texoif3iatop e i o;s)s2xo(m3no4lle lnciatfaDum(moot4tex mfeiltlaDeauvo (4 rxnir3ia1faD lu ils)sexrim3ny1openlivslsfarumu p;u1teto f3iat mDrlnmp;t0trtoxr3to1lpD ln ol(  2umxm iydlptn feia(  2tru p;t0tpxnmiciasls2rluvp u0 exoio3to1lpDrliei;()trxm(m3no1omeemfetas)a2raxmoou4openmo3tad s2rm(ms;(0tetrif oa1fmDraues;s) 2tmxr iy4lle lictat  2rr(mo;t1tpxomi3iyd mDrm(mont4tlxrircoatomD lnvs;(0t2xo(o3nydapen nvs t  Dur( ono1opxomfcildfm2rm(mpnu) ltrmrcoodfaDran s s0srxoim oo4optnmivs s srraxmp;u0tee ifetydfa2rlnvpn(4 eeoxf tytomtran slt)srtoxo3oy1amtemnes sfsrtm(  nu0oltoioeiadfs2uauvsn(0 eeoif io1oa   n o;t0srxr(m iu1lmeelneil(fsrum(mont4tlxoio3tas m2rauvpn(4tetrxf3tydfatelnvol(0seur(o3oy1oleemnei ( sDtauro;u1oltnmo3ias s rl( p;t)altrir3ty1fpteaueol(0 2um(r oydalee nvi tfaDtaumo;u1optn ieiydfmDeaumpnu4 lermo3io1fpteanvilt)s2uoirpoudllenlfct sf 2ua( ont1texomf3iydlm2rmnmo t0 ltrmf3totoat anvols s2umirpoo1amtelieilt)s2rau ono1alen ietld a ulumo;()aetrio3tatfat li i s s2xrirpnodaleemfcs (fsrraum nt4alxnifeiyslsDrmnvp;t0 lxnir3io1lat luvo;t)s2toxrpiu4amtemnes s a2um( ono1tpt iociltlaDulums;u)arxnir3oytlm e iei;s0 exoio3nu4lmt mfvsat)a2umxro;u4tptomfciltls ul(vsn(0 rxoxf tytoat aivs;()teur(mpnodole lfvt s) 2umx ont0teenmoetls m2rl( s;()texoirctatlp  aieo () 2xmxo3iudamtnlnvil()s2rmurpoo0aleo ieiys s ulnvs t)alxoxociydopt  i ols0trxoxr oy4apenlfetlt)s2ur( o;o4tetnio3iyslsDrlnvont) lermf totoa r i o;t)trtoimpoydal  liei ( sDraumo;t4aexomoctydla raumsnu0aexrmr3ia1oa rluvslt texoio3nydopenmivsas s2tau poo1apt  o3iatfm2ulums (0 eeoir3tydfm  au o;s0seumio iy4amenmivs s arumumont0oet mieiaslm uan onu0tetnmr iytoatelu sls)srur(m3no4lme  fvs t artmu ont1aptnifctlsfaDrluvpnt)teeoir3iydopt au o;s0 eur(mpnu1ame mict s)sDurxmonu0oex mf3tydlm2rmu s;(4 lxomf iadlmt  n s s)s2tmio3iydom nmfesat)aDumuront1oee  ieiydfa2uau o;u0 lenmr oydlpD au ilt0sexrirpny1amtnlivtl( arurx poo0tlx ioeild aDem( p (0 etomf3oytlmt luvi;()setr(o oydllt mfct sfsrrmxro;u4tleo o3ilslsDeaumsnu)arxomocoydomt an slt) 2xo(o3io4amtn nctltfartmxm nu0aeeomfeiat s rm( s t0alenir3ta1fm  auvsls)seuriopiudol elnvsl()s2ur(  ;o4tpe  ociyslm rl(mp;u0tetrxr iodop eliei;(0truoxo nu4ame lnesat s2um( oou4opxoioeiydlm2ea(mpnt0alxomocty1op rlu i s)tetrim oy1op   fesls)a2uax pnu0ole ifeild mDumu o;()alenmf3oydomDrauvsls0trxo(m3iydole mfeilt arrmum ;u4aetn oeiatfa ea(mp t4 renio ootfm e nvs;()srtmirpou4amen nvils)a2tr(r nu4tpxnmieiydlm uau ont4trxrifctadlm e uvolt0 2tmxr iydapee ivslsf 2tax pnt1oltn f3iatlaDeauvp u0 ltomf ty1faDeau o;s0t2umio oudamt lfeia(fsDuru oou4teenmiciad s2elu s;(4tlerio3ty1lmt  u sl(0s2uoio3oo4ope mivi sfartax onu0aexniiciyt m2eau snt0 etoxf iotlatelies;(0trtrxr3iodapenlnvsl()aDrauroou1opxnioctltfm rluvonu0artoxr3ia1opD aivolt sexr(m nu1llen nvsasf 2tmu ono1tpxoioeiydlsDeanvp;t)tetrio3ia1op e ivs (0 2uo(mpoy1optn fvsls)sDtaum nu1tlxnifctyd s eauvp;t) eenmf todlmDeanes;t0trxmio iydomenlnvtlt)srra(  nt4tpen i3tadla2elump;t4 rtrmoctydfptraieo s0 rtm(mpiu1optnmnei s)srurxmpot0oeeoifcias s emums;t0arerifctodlaD lnes;s)t2ur(r3iodlp   ncslsfa2truronu0oex iicildlm uau on(0texnmo oadlpt livil(  eumxmpou4optemivtl(f Dtau p;u0tex mfetlt s ranvs;u)artnmr totom eliesl(0 ruoiopoy4lmtn nvtl(fs2ra(mo;u1aetomi3iydlmDuln p;()tltoir iodlmDrlneols) rtoxm nudamt mnci ()artmu p;t4tet  ociadfm ran s;t0 exnmocto1oa  lu ils)sexr(opio1lptemiesat)artr(mono4tpeo ictydfm rmnmpn(0areoioctytfmDrlnvi;t  etm(m oydlmenlivsasf 2tm(mpno1tptnmf3iadlsDrm(vsnu0trerxf3iodlpteliesl(0 rtoxmpnu1ope lnvsasfs2tmxmo;o4texnifciat aDeaump;t4 ltnxf iodomteaiei t0s2trim3oo4lmtnmivils)arrm( ont1apeomietat sDeauvo;u) rtoif oytlat lnvil(0srtrim oo1apeelfvil()aDuru o;u0tlx ifctld a2rlnms u4aeerxr3ootlp e uvols0trtoim ny1ap nlnesat  Dumu ooo0alt mo3tltfaDulumsn(4 etrmr3io1lat aues ( trxm(r3iy1alt  fesa() rra(ro;t1apxniietls m2uan pnt4trtrxfctotlm   uvils  exm(rpiodamt  feia()s2trx  nt0tlxo fctldls2eln s t)tlxrif3oadoptr ivslt) ruo(m3oydap nmfcsas s2raurpnt0apenmi3iytfm rlnvs t0tlxrif3ty1la e n i t sruoxmpnudll nlicilsfartax pou0tlto ociysls el(mp u4arermoctydoaDrauei (0seuo(m iy1am e ncil() Drr(m no1oexo fctldlm ea( on(0 rxomo3iotomteli s;t setmxo3ny4openmfes tfaDumu ont1olt  oeiltlsDumums;u0tlxnir3iydfaDelueil() ruoio3ou1lpeemneias)artr(r ;t0apx mf3tysls ul( ont) exnmo todfp  an s;(0 euoxm ny1lmtnlneiltf rtau ooo4tleomo3tlsfs2rlu pn(4 eeomo todoa eai s;s0t2xr(rpiu4ap emnci sf 2um(mpno0tlxn ieild mDum( on(0aeeoxo3tatfmDrlu i;s trto(mpoy1ll e nciatf 2tmxrooo1tpx
\ No newline at end of file
@@ -0,0 +1 @@
+ies;(0 rtrxr oydlpee iei (farrrump;u1oetnmo3tadfm rln o (0 rxrir3oytoptelu s;t0 eur(r3io4lleelicsas)aDuaxrpoo1aetnmfeildfs umu p;()tlxnmo3oodlmDrlnvslt)t2xm(r3ny1oltnlivs (fsDtaurono0opxomieiyd a emnms;()trxnxf3iytlmt  n s;t texrir oydapen fetl( srumxr oo1apenio3ildla2rm(vpnu0 rerifcta1lpt lueol(0sexrio3ou1lpte fesl(f rtrxm no0opxn o3tlsls2eluvs u0 rxnxr3tatoa r ueo;t trtm(m oo4om  lfciasf 2ua(r ;t1oltoifetad a2eauvs;t0arxoxfcoo1om eln o (0teto(r3oo4apee ivilt) rumu oot1aeenif3tasfs2em(mp;u) rermr3oydom eau o s0 etoxo oudlmtn fctasfaDrm(mpno1ope ifetaslm eau s;u0 rxnxo iatlpte u ol(0 etrxm3iu4omt  fct tfs2urxrono4opx  ieilt m2ulu pnu)aeenxf3oodfptraneol()srumxm iy1lle mfvils aDrmu  oo4aeeniocildfa uauvont0trerxo3tatoaD  nes (0teuoxo3iodomtnmneilt  2uau o;t0opx mo3iysfaDulnvp;u0artoxf3iatom eli o;s0s2umxr nydol emncsatfaDua( pot4tpenmicildfs2elu p t)artnmo3tydoat ln s;s  eum(rpnu1lpeemiet tf 2raxro;o0oee iiciydlsDul(vonu) eermociydoaD lueilt  rxoim3ny4lpenmnvtlsf 2tmumoot0aeto fetltlaDuan o (0trxrmfctotop   neolt0tetmxr3ou4ape  fes s s2urumpnu0apxomo3iltlm2uan snu0 exrxr3iotlp elivs s  rxmim nu1ap e ieia(faDtrx ooo4ale  fciydla2ul( pnt) rermo ia1fpDranei;( sruo(m3nudoltelfvt sfaDrm(mp;u4opx  ietadfm2eluvo (0trtrioctotlatraiei;(0t2xr(opoydalt mnctas s2ta( pnu0tptn o3iydfmDranmonu0tlxrircta1faD  ieo s)srtriopnu1alen icilsfaDrrx  nu4oltn f3iytlmDelump (0arerxr totomtran ol(0 eumxo3oy4am elnvs ( sDraxrpnt0aleniiciasls2eau o ()aexoxr oo1fpDr i s s trtmim3nu4altelfvtat)aDtr(r ;t4tlx  o3iadfaDua(vsn() exnmo3oo1late uvs () etoxm iy1op nmivt t  Dua(rpnt4oexnmoeiyt aDrauvo u4tlenmrctydlp  auvo s t2urirpiu4lpt  ncs s aDtr(ro;o1oexnmociytfm2rm( p;u)tlxoxo iatfm eaueilt)trxm(rpnu4opee fcia()s2ua( o;o4oexn iciysfmDulump;u)trerir3oytfp   uvo s  etoimpnu1ll e ivsls aDrmumpoo4tee ifcias s2el(mo;u4 eerxr3iadfm  auvi;s) 2xmir3nu1llt  net (farrrurp;t1optn feild m ea(vs t)aeerxf3iydlmDrlueo;s0texmiopou1am  lnci sfarurx ont0tee mi3tyd s uaumsn()alermf iydfmtrln sl(0trumio3iy4ap nmnci s arur( pnu4openii3tlt m2rl( o u)trerxo ia1om raues ( t2toxopnydop  micslt)srraumooo1oleomocilsfm ulumo u0trenir iadopte uei;s0 rtrio nudllte ncsl( sDrr(mont4aexomo3iatfm ea( snt)altnxocootomtrlnvs s srto(rpnodomt  ivtat  rrm(mpnt0tpe io3iadfmDel(vp t) lenio io1lptrlu i;(0seum(r3nodamt  nvia()aDurumono4alenmf3ild s2rm( p u0altnir iadlate iei s0 euoxr3ou4apt  nciltfarrrxmoou0olt io3iydfmDum( s t)tetrmfcta1oa ranvs (0 exm(o oudomee nei t  Duru pnu4tleoioeiadlsDemump;u)trenxf3tatomDeaues;s0t2uoio io1lme livtas  Drrxmpoo4tlx mo3tltfsDuan o;u4altoxo3oadlatran s;s  etmiopoy1apt  fctat sDurump;u0apx ifeiyd sDrm(monu4arermr3tydopDrau o;()trxrxr ny4lmenmncsa(  rtaxm no0aex  i3iasla2rmuvs;u4aetnmr tatop  lieo t seuoxm ny1ll  miviltfsDumur no1alxomi3tasfsDea( p;u0trtrmr ia1oate i slt0t2xmio ny4lmen neiatfaruaxmp;t4tpto f3iadla rl( p;(4tleoir oytlpDe nei s  rtr(r3io4ome mnci s sDtrxrooo1tpxnioetysls2uauvpnu4altnir3tadoaDeanvslt s2uoio iu1omte ict s)aDtr(r ;u1apto fciltfs2ean p (4arxoifctydlat  ivols0teurxrpiu4omt mfvsls)a2trx  ou0ope ifeils sDel( s u4areoxocoodfa   ueslt)t2umirpio1apeemieiat)arraur ;t1oetomieiatla ra(ms ()alxrio3iydlatr ivsls)s2trxr nudame mnei ( s2ra(rpnu0apx iocilsfmDum( p;(0tlenmoctatfmDelues;s) euo(r ou1op nmiesa() ruru  nu1oexoiociadlsDelu s;(4 etrmoctotopDe nesl(0t2tmio oy1lp  lies tfa2rmuro;o0oltoiociatfa2rmnvp;(4areoxf oa1omtraiesls  exm(mpnydlme  ieils a2tmuroot0oetnif3ildlaDrl( o;t4 lxnif ia1fpDeauvol( srur(m3iu4ole lietl( srumum ou1oltnifcildlm2rln snu) lxrmr ty1faD  nvs;t  eurxr iy1llen net (f ruax pot0olt moeilsfaDean s;(4trenio3tatlaD  ivs ( trxr(mpou1ale lfct ( a2uaumoot0ape mf3iadlsDrlu s;t) rtrxrciy1fmt au i s)sexrirpoy1ape mnvia(fsrrm(ronu1ale ii3ild s ea(ms t0 lxomo iytlmD  ieo s  eumio3nodlle mivt (fs2tm(monu1oleoioetyt s2elnvp;t)tetnxo3iatfpt anvsls0 2umio oo4omt mfci t) 2ur(mo;t1tlenifctadlsDuan pnu0alxnxo3ootlm r nes s)teum(rpou1lp nlnvia() rraurpnu1aeen o3tasla2umnmp t) exrxo oy1omD lnvi s) etm(r3iydol  mivtatfarta(  nt1alxomoctldla elnms;(4tlenxf ootlmDrli il(0trtriopoudlmtn ici t s2uax pnu1oetnmieilsla2um(vsn(4artnxo3oatom e nvs (0trxmxrpiu4llte ieil( aDurxmp;o1tetnii3tltlsDrlumo;t4trxoir3oo1lateaivi;t0texr(opou1ap elneiltfsDumumoou1olxnifeildlsDua(vpnt)tetoxr iydopt an o (0 etr(r3nu1lmtn iesa()a2uax p;u4apt  ictydfm um( s t0 rxnir oytlate n o (0 2ur(rpiu1altemnci tfarurxmp;u0aeeomoeiysfaDuaums;() renmf3iadlm r ivils teumiopno1lpenmfetl()a2uau  no0tetnmicilsfmDraumonu)alxnir3ia1opDrln s ()s2trio3oy1lm emfvi sfsDur( poo1tee  fciasfa rauvp ()altnif3oatla  lnei t) 2umxm3io1ope  ietl(fs2uaxrooo4oltn i3tyd s um( on(4trerxr3oodom   ueo t)trurxo io4opteliciasfs2tmx onu1aexoii3iyt sDelnmo;u4 eeoio3tatlmtrau o;s)trxrir iy1ll emfvs sfa2ta(mp;t4tlto ieiys s2ea(mp;t)tltomr3oatfa r nvs;t0s2xrxo3oudol nmfcslt sDra(mpnt4aptoioeiad a2ra(vo ()trerxr3iy1opDe ieo;t  2tm(rpoodlmt  ivtas)a2uaumooo1oeen i3tld mDrmn s (0 rtrxr3ta1lpD lnvi;s0trxr(opnudlme liei ()a2urum no4openif3iysfsDrln o;u4treomf io1lm  au ils0srxmirpou1omtnmncsas  rumxmoot1tpxnio3tasla2ea(vont0 rxnmo3iatoa ranvils0teuriopiudop   ieias) rtmur oo0opt  ictytfm2eau p;(0 lxoif3ootoaD anvilt0s2xrxm oudap   fetlt aDrau pou4aeeomfciydfs2emumpn(4alxrmfctatfp elnei;s truoxr nu4alenlfvias)s2um(  nt1ole mo3iydlmDrl(ms t0tltnio io1lp ranei;t0t2xr(opiudolenmneta(fa2tmum ;o0apxniociasfmDulu s;(0tetoxf3ta1la eanvsls)truoio3oo4om elnvi tfarum(m ;u0teeo i3ilslmDrlnvo u4 lxoxo iadfat lnvs;s0 exr(mpiu1ap  lnes t  Drmx oot1tpt mo3tlt aDemu p;t0 leoio to1laDr uei s) etmim nudal nmnvt ( srtru o;u1olt mfetytfsDua(msn(4treoxo3tatlm   i il(  2xmxmpnodale mivsl(f Duauroou1ope ioetytfs eanmpnu4 renxf tadfptr ivi (  2um(m nu1lltelnvslt) Drmuroot4tlt io3iyd a umuvont4alxomrciodfa  an i t0srxo(rpio4lm n fci ( arrrur ou1oex  fciad aDemnvs;t0trerio3ia1lmDe u o;s sexmxo io4optelncils)sDua( o;u4alxoifeiat mDelnvp u0 lxoio3io1fa rlivsl(0t2tm(r io1apt mfcs ( arrr(mo;u0ole  fcildla rmu p u)tetomfctatlm   nvsl( trtrim ou1aptnlicsas) Drmu p;o1alt mociasla2rlump;t0tetnmf ty1lateluvo;t  eurir ny1omtelfcsa( aDrrxm ou0opto ieils a2uluvo;u0aeermocoa1lptrai o t0tetrio oudoltn iviatf rtax pnt1tpxn o3tysfaDuln on(4 rtrmociydlpDe neols)t2tmimpoy4op emnetl( arrmumpoo4ope  ocilt m2rlu p ()altnmo oa1oa eaiei;t0texmirpoo1alen icslt)aDtm(mpnu1tpx  f3tadls2ua(mp (0 etnirciotlptean s;s0tetrio3iydamtnmivtltfs2taxrpoo4opxo ociadlsDem(vpnt4tetnmr3oatfatrli i;t)trtmxrpoydamtn ietls) Drrumpno4tpt mociatlmDea(vsn(0 etnxr ia1op ranvo s  euo(r3no1op nlnetat)srrr( pnu0optomf3iydfs elumsnu4tltriocoytlmtelu i;s)trxrxmpou1omenmivsl( sDumx ont1tle if3tyslmDeau p;t)aetoirctydomt ln i t)seumiopoo4lpt mnciasfarta(moou1oleo i3tadlaDra( o u4aetomf oo1opDrlueo t)teuoimpnu1lmt  nciatfaDtm(m ;t0teeomfetyt a2rl( o;(4teeoxr iatomt  uvils srxoxo3io1optelivs (farrr( ono0tlxo f3ilt m rl(mp;u4 reoif tydlp   ivs;(0 2xrxopoudlpeelfvi s)s2rrxmp;t0openmictatlm2uan s;t) exoircootfmt  i o t s2umio iodlmtemnci s sDuauront1apx mictasla emu s (4 exrxf3todoaDe ivi;s  rxm(o nodapt  fcsasfartau onu4alt mociytls2emn pnu0alxnmf3oatopteluesl(0srurxm3iy1ll elicsl(f rrruro;u0tlxomf3iadfsDemu s u4alerio3to1oa eanvol( srxr(r nydaleelfeil( s2uru  nt1aet  ocild aDel(mp;t0artnxo3tytlmt livils)s2urxopno1aleemfct s sDua(mono0tpx ifeiysfsDeluvsnt)alermfcoytfp eluvol(0trto(r3io1llte ivt s  Dtaum nt0opxo icilslaDumnmon(0tetoiocto1fmDran ols) exoxo3iudomenlicta()s2rrxm ou4ape mfetlsls2rm( s;(0aeeoiocoa1la eaues s  etmxm3oodlltnmieilt  Draumoot0aex mietltfs2ranmsnu) rxoxr tadlm  au ils) exmirpny4ope lfes t) Durxmo;o0opx mf3iasfa ua( p;u) ltrmf3ootopDrln o s) 2xrxm3nu4amtemici t  2ur(  ;u1altnmoeiys s rlnvp;u)aeerxfcootfp r u i;()teurxmpnu1altnmfvs s  2ur(  ou0tleomfeiatla um( o t0alermoctydfmt  i o;t)trurxrpou4apenliesas)s2taxr ou1oet  fetys aDul(mpn(4trerxo3iatlm rlueo;t0s2tmir3nu4omee nesat)aDtmumpnu1openmictydls ra( s;() rtrir3iydfaDe ivs;()trxm(m3io1apt lfet tf 2trumono1oeeoio3iysla2ul(mp (0alerxocoodfmDran i;t srxrxm iodllee nctls  2tmum ot0tpx ioeiydlaDrl(ms t4aetnif3ta1faDr uvs () 2xo(opnodll e fci t) rumxmp;u4tlto feild a rau snu)trtomfciadlmtr ueilt0 rumir iudlm e fcs s srum(m nt0oexoifctasfm2rm(von()artnir3ootlp elnvo;( trxm(mpiu1opeelnesas)artmxr no0tlenmoctldfa emn o;()teeoif3todlptean o s)teuoim3oy4ap  mfcilt)s2um(ro;t1aetnmfetasfm2umnvs;u4 ltrio tydla rluvo s  rxmimpny4aptn ies ()aDtmum ot0tpx mictys a2ulnmonu0alenxf oa1lptrliei t0 2xo(r3nodlpeemici (fsDuaump;t4opxomfeiat s2el( s ()aexrircoy1fpt au s s0 rto(mpoydope  icsat)sDtrxront1aexnii3tldfa ua( p;t4alxrif iy1lp e u o s0srtmxm iy1olenlfeslt aDtmu ont4opx  ocildfaDrmnmsnt0 etoxo3totfaDraneolt tetrir3oudlptemneilt  Draxmpoo0tetn octydlmDel( s;u0 lxnifcoo1fp rlivi t0sexmio3iodlmtemncsas  rta(r ;u0aptnioeiys m rlnmo;t4 ltrmf tydoatrlieslt0 2xrxr ou1opt mfeiat srrmxr ;o4tlxnioetlsfsDra(vs;t)arenmr to1la rlneo;()seurxo3oo1apt mfvtltf Dtmu o;o0ole  fciaslaDulu pnt0teeoircoydfatraieo s srumim io1lp   fctl( sDur(mo;t1tpeomictat m2umu pnu0tltrifcio1fmDe i ilt0texo(o3iudole mncils) rtrxmont4apxo oetysla rlnvs;u0altomoctytlm  an sl(0 2um(mpio1omtelnci s aruru ono4olx  i3tyd a2ulnms () eerxo3oatomDeauvo s)texm(o3io1opt  neslsfaruaumo;t1opxn feiasls2ranvsnt)tlxrxfcia1fptraiei () rtm(o no4lm emncsa()sDum(mpno1tleo feiyt s2ulnvp t4altrmf oa1lpDrlivs;t0trxo(r iu4ll  lnet tfarraxr nu1alxoif3tys s2elnmo;u) leomo tytfm   uvo s)trxrxo iu1lle  ictas) Drm(rp;t1tet iociadfs2uau s () exriocootoptr n i s0srtr(m3oydlmt liesls s2taxr ;t4olt iociyt a rl( on(4 eerxf ty1latrlieslt  ruoio3nodome mfvta( aDuax  ot1ole  oeiytla2uaumo ()treomo iatlm e ieo ( trumimpoydam elicsat)srumxmonu1aeeoii3iadfa2ra( o t4tltriociydoatelnvo;t)trxoxmpoodoltnmivt s) 2uru pnt4oetoif3ildfm2rmnmo;u4arerifctadfmDraivi;(0trumimpiodlptn nvsa(fa2rru pou0oexomietad m uan o;t)trerxr ta1fm eauvs;s setmir3io4ap nlnvi sf rtmu ont0aptn oeiadfsDrauvpnt) rxnif3tytfmDe nei;()s2uo(mpiu1al nmnvtl(  Dtrxm nt1tlto f3iysla ean snt)artrmrciatoaD  u s;(0sexmxrpny4olt mfetas)sDrmxmpnt1tlen fciyd m ua( s;t0 leoxf3ty1omDe nvslt0srxm(mpnu1omee fvt () 2ua(mo;t1tpxomicilslm2elumont4aexriocoadlaD lnei;t) exoxo nudomeelictlsf 2urx p;t4alen ictyslaDra( o () ltrmf oodlatelneol(0texmxr3ny1lmtelfes t) ruaumpnt1tetomi3ilt aDemnvpnt0 eeoxf3ta1laDrlies t0 rumxm3no4omt mnetas aDtaumpot1aetnif3tls sDumn s;(0 exoxf iadom eauvo s  2xrxo3ou4lltn fesl(f 2tmuro;u0teeo oeilt s emuvo ()alenxf ta1fp r nes t)srxo(opny4ap nmfetat) rtrx pno1aee  o3ils aDel(vo;()arxnmfctotlaD lnes t t2tr(mpoo4apt lfvslt srtmx  ot1aptn i3iysfs rmnvonu4texrmf oo1omDelnei t  rtrxopnydlpe lnvsa(f 2tmum ;o1tetnioctlt aDrln p;u0artnxo3iadfpDelues;t0seto(m oy1ap  micslsf Dtmuronu1tpx  oeiadfmDranvs ()tltoir3oadfmte nvs;s)trxmxo3io1olt micias sDtr( oou0ape ifeild a2ulnmont)alxriocootoaDr uvi (  eur(m oodlleeliviltf rrmur ;o1aetoif3iatlm2rl(ms u4 lxnmr tatfp r u olt)trum(o io4ol n ncsl(  rrrurp;t0oeenifciysfm2eln p u4 lxrmr oa1opD  nes;s) rurxopio4amtn iesl() rrru  ;u1tlxoio3tldls2ean s t)trenxo todopDraivi;s  2xrim oy1lltn ivils aDraxmp;t4opxo f3tad sDrlnmo (4arxnxocootla eluvilt)srur(r3oo1amee iet t)s2rr( poo1olxoifeildfm2ua(vp u0areomo tydlm  ln s t0 2toxm3ou1altemnvsltfsrtmxmpnu1alto ociytla2eaumo;t0trxrmf3oo1lpD lnvs;()setrxopoo1lpt lici sf Drmxrpou0apeomo3tat a2rln on()teenmr todlat luvs (0 2toim3no1lmeemies (f 2um(ronu0altnmi3iatlmDua(msnt0aetoxr iodop r nvolt0teurim3ny4lle lfeils a2uaxrp;u0tlt iiciydlaDeluvs u)artoxr3oodomteln o t trtrxrpiudapeelivil()arrr( oot4teen i3ildlsDrl( o;t4tlenxocoatlate ieil()trtrxopiydam emnei t sDrax pou0oleo ietasfm2raumo;u)alermrciatlp e nvs;t0t2tmxr3iy4apeemfetasfsrra(mp;u0tpe moeilt sDea(mp (4 rxnxo oadfm rai o;(0 exoxmpoudlpte fctltf Dumxroot0apx mf3ilslaDra(mpnu)tlxomr3oy1lp r u slt  rxoxo oy1lme livtltfs2ta(m no1tpenmf3tatfm2el(mon()aexrxr3ootlp ran s;(0srumir iy1alee nei t  Dtrur ot0oeto i3iytlm2elumsnu)texoxr3oydfaD ai o t0s2to(mpoo1omt lfvs () rurxm oo4optoifetasls rlu o t0 ltrir oydoaDrliei;t  rxoxrpnu4alte fcil()sDrru p;u0apen fciltls2uau o;t4teerio oatoat liei;t0s2toio nu4olee ivtasf Dumxm oo1tptnmi3tadlm ea( p;u4altnmfciadomteaieo;s  2ur(r nu1oltn nci (fsDum(mp;t0texn oetatfs2ea(vs u)aetoir ta1fm  aueo s0t2xrxr nodlp n neslsfarrrxm nt0oltnmi3tytlm ul(vo;() lxrio iadomD auesl()setmxm oo4ale miei ()arurx ooo0ape iieild m2raums;t) reoiocto1oaD  n o;s0 2uriopio4ll   icil(  rrrumono4tex ioeiadfs rm(mon(0 eeoxr iotfa rai i;s)t2uo(rpnodomtnmfeils aDtaxmont4teen i3iatfs2em(vo;u4areoxr3ia1lmDrln o;( trtoiopnu1al nlfes tf Draumo;o0oex  fetysfaDua(mont4teeniociy1om rlueilt)tetoio3nydaltemiesls) Dtm(  ;o0tpe  f3iydfsDua(vpnu4aeeoio3ia1lptrai slt) exm(opno4lpeelnvs t  Dtm(  nt4oleo f3ildfm eanmpnt4alxoxr tytlptrlnvo t)s2trxo3iu1lmte fvsas) rrrxrpou0tptoif3iadls rmuvpnu0arerif3ia1fatrli il(0trxoirpnudoltn fcsa()sDurxm nu4tptniiciyt s2rmnmsnu0 exrmf oadfatr n ol(  2xr(mpny4omeemiet (f Drmx oot0open i3ilsfa ua(vp (4aetoxr3oy1optrlnei ( sexrio oodlpe  fvs s)arrrumo;u0tleomi3tat sDrm(ms t) rxnio3iatlmtelu o t)s2xoxrpiodlmee ncslt aDur(rp;t4teen fctadfa ranms;u) leoxfcta1fa eauesl( s2umxopno1lp emieiasf Duaur ot0alxn i3tytla2em(vp t0 exnxociy1lat  n i;( sexm(mpiodopenmnvia(fsDtmx  ot1oeeomictad mDum(mo t4 lenmr3totlmDrlnes;()t2to(mpoo4ap emnci (fsruau o;o4aeto feiltfs2rl(vp u)artomo oodfpDean o;( srxrio oudaltemivil(fsDuru p;u1tetnifeiys mDea(vpnt4trtomr3ty1lm eln slt0 rxrirpnodlltelnes sf rum(  ou1apeomoetad mDel(mon()treomo iy1lpteaies;() rurim3ou1lmt  nci tfsrraxro;o4tet mictyd m2rlu p;(4arxrio tatoaDraivsls0 rumxrpiy4ope  iet (fartr(mp;o4texoifetat aDel(ms t4aexrmo totfpD anvils) rxmimpno4apee icsas)arur( oou1apt  fctldfa eauvont4alxnxf oo1fpD lies;()sexrxrpou1lpenmfvtl()aDrrx  ;u0alx mictadlm rmnvp (4 ltnmo oo1faDrluvi;(  rxmir iu1ame  fciat) Drmxr ;o1apeo ietasfsDea(vo;(4 etomociytfpt aueo;(0sexo(rpiy4ole miesatfarrauro;u0tpt  ietyd s2rmuvpn()arxrir ty1op rau s;( srxmimpio4ll nlictls)aDtaxr ;o1aeenmoctldfa emnmon(0 rxoxr3oy1opt ln o t)trxrxmpny1optn nvsasfarrmx  ot1tpto feiadfs ulump u) ltrir ta1fa elivo;t0trtoim3ou4oltelictas)srur(rpnt1tlxoif3iltfaDrmn p;t4aetrircoatla  luvsls0 rurio io1altelfvs tfa2taxmo;o0aptnmoeiasls2uanvonu0 exrmf3oodfm r ieo;s srurxrpoy1omtn nvt t)aruaxmp;t4altomo3iad mDulump;()teeoxfcoadlm  aueo s) rxmxrpnudol  mnct ( a2ur(mpot4olx  o3tys m ulu o (4 etomf ootlpD luvols)srtmir3iy1lle mfvt t)a2ur(  ;t4olt mieiltfa uan on(4trxrxf tadopteai s ()seto(r3iy4llt lieiat a2ur(roou4aee  fetas mDumnmo;u0 ltrio oadfm   i o;()t2xrxr nudlmtnlnvta( srraurooo4apt mieiysfs rm(vo u0texrxfcoy1faD lies;()trxoir3iy1lp nmnetlsf Drm( onu0alto f3tytlm2em( pn()alxrmrcta1fm rln il( s2xrir3oudop  lnvias arurump;u0apto o3iatlm ran o u)aexrxr oatlm  anesls  rto(m oudaptnmfeiltfs2tmxmoou0tpt ifciydfm ranmont) lxrmo io1lm raieil()t2umxmpoo1lmenmneils)srraurp;u4tpeniietldfmDrmnvp t) renif io1fmDe uvo s)t2xmxmpiu4ol  mfes s) 2rrump;o1aptomociltla rlu onu0 eenir3iatlpt  n sl(  rum(m3nydlp nlictlt a2taump;u0aeto i3iydls2uau o;t4texomo3iotlp  lu s;t trumim3nodopt lies s s2trxm ;t1oex mf3tltlm2uaumo () renmf tydopDelues;t0tetrim ny1ale  fcs t aDra(rp;u0tlt mieild aDrmn o u)tltoif3oo1fat  ueol(0srxo(rpnydome  fvils arumxrpot0altnmf3tad aDea(vont4teeoxfcoydfmD anvs t0srxrxm3iydaptnlicsas) Durumpoo1oee micilt m2umu p;(0tltoxrcia1lm  aivil( teuoxm3oo4altelfetl(farraxmoot0tlt  iciatfm umuvs (0trtoifcta1fp rai i () 2umir iu4ap  mfeia( arum( pnu0apxoii3tlt mDrauvo;t0arxnxrctodfa   nei;t0srxmxr3iy1optnmfvtl()sDraumoou1tpxn fcils mDuaump t) exomr3ia1fat  nvi ()teurxmpny1ll   iei ()s2taxr nt1apeoiieiatfaDrmnmp;(0 ltnifcto1la rlies;s t2umim3oo4amenlnvta(faDtaurpou1apeo f3tat s rluvonu0artnxocto1oaDeai o (0 euo(r iodlmeemiviat)sruru  nu4tetn iciadfs rlump;t0trxomo3oo1fpDelu o s)t2toio3oy4ol n fcs (farua(mp;u1openmf3iat aDumnvp u4tetrif to1op raivo;s  exmxm nu4ol elfctlt) Draurpot1opxnmo3tadlsDelu ont0arenxociatopDr uvs;()tetm(o3oydlmtnmieil( arur(rp;o0oetn oeild mDrau snu0texrxr iotfp  livi;t0trumir iy1am emfvias)sDtaxr ou1tpenmi3iatlaDranvo;() lenmrcoodfpDrlnvs;t0t2tmio iu4lptnmieils  2ta( o;o1aetoioeiyd a umn o t0arenxr3tadfpDeluvi s  exo(m3oo1aptemivsl( sDtrumonu1olt iieiydlm elnvo u)aeeomr tydomDe ivi s  exrxm3oy4lpenlnvt (fartrx o;t0texo oeildlm2eluvo;t4tltrmr oodoa eli il(0 rumxo iy4omtemnvs (fsrurxm ;u0optn ictydfa ea(vs u4 exrxfcty1lpD lnvi t  exmxmpiy4lmenmies tf 2ra(ro;u1texn f3iydfmDrauvp t)aeermfctotoaD ai ols tetoir3iudopee feiltfaruau  no0oetoifeiysfm2uanvpn(0texrxf3iydlp  anei s srum(r oy1lltelfei sfs2raxmp;u1tex  oetlt a um( pnu0aexoxo tydlaDe ivs;s s2xm(o3iydlle lfvsl( sDtau pnu4opxnmocilsfm uau pn() rxnxociy1latelu ol()s2xmimpoo1ape mfviat)s2rrx pnt0aetoif3iat m rmnms;t4 rtomfcoodlateaieo t0 etmxmpno4lmtn fesltf 2um(roou0apxniiciadfm2emnvpnt0tlerxo3iy1oateauei;t  exm(opny4olee ivi sfarraxr nt0oeenmoeiys a um( s;(4trxoxo oytlaDran s ( t2umirpoo1lpt lfvs s) Dta(r ;u0tpen fetysla2rlnmp;t4 eeomfctotlp  ln olt0s2to(o oydomtemicia()srra(rpno1ale ifeiydfa emn p;(4teenxf3ia1oa rlnvs;s)texmirpio4lpenmics tf 2taumpnt1aeeo iciat aDemu p ()tetnxrctodlaDr uvo;s t2tmxo oo4al e nesls)aDtrx  no1oet  o3iydfa rm(msnt)trtnio3iytfmDraneols0s2xmxrpoydlptnmivs (faDrr(m nt4opeo fcias s2raums t4alxnioctotoat ai o;t s2xmio3oo4lmeemictatfartrurpnu4tpe mo3iyt s2uaums;u0 rerxrctodla  ln o t0t2urim3oy4lpt  fcilt  rum(  ;u0optoiiciydla2ulums t4 exoxo tatop r u i ( srxoiopoy1lpeelfvsat)srtr(r ;o1aex io3tltlm2elu o;u0 exrio3todoatr ieils)srxm(opiodapt mnvtat)a2truro;u1aexo oeiadfaDrl(mpn()tlermo oatlm  lu olt)t2ur(m ny4lm  lfvt tf rraurp;o1alxoiictysfsDrau p;u0tetrmo3iydlaD li s s0texo(r iy4lp  mneiat s2rax o;o0tptn feiad a2elnmo () lxnxo3ootla  lues;(0srurim3io4lpt livil()artmxr ot4tlx iictadfmDulu snu4tetomr to1lpDelues t0srumxm3oydap nmnvs (  rurxrooo1aleoifeiad m2rlums (0 eerifciotlpDrli sls  rto(o3io4apeelfesl( srum( o;u1apxomoetadfa uluvon(0 rtnxr tadlmt luvo;s) rurxr3iy1am emivi tfsDta(mo;u1texo ieiyslaDemnvs u0alxoif3oatop eli s;s tetoio io1lpeemietas s2raxmpoo4olenmoeias s2ulnvs;()teermr ia1fmtrauei t t2um(o nodamte ncs (  2ua(r nu4aptnii3tysla uluvo t4 leomr3iodopDeaivo;t0srur(opnu1lptemncsl(  rtrxront1apxn f3iyd sDuan sn()tlenmo3ty1lpt  iei s0srtoirpno4lltnlfeslt srum(rpou0aex mietysfm rmnvont)tlenirctadfpD  u slt)truo(o3oudole mies ( sDur(ro;t1apxoiieiyslm emuvs;u0 rxoxr3iy1opDrlneo;s)srxm(r nu4lltemieia( s2rru pou4aex iieild sDrm( p u0aetoir3iadfp  luvs ()t2uoir3nodom e fvs s)artm(r ;t4aex  f3tldfm ranms (0arenxr oydfp e uvi t sruoirpno1am nmfct ( artr(mpnt4apxnifcias sDum(vo;() rxoxr3ty1lpt lu s s0s2uoxm ou1al nlfet ( s2tmxrpou1oetnifctlt sDrmump;u0 ltoif ootlmD lnvs s0trtrxmpnydamenlici s aDtm(rpoo4tptomfeiys a eau o;t0aeenif3iotopD lieo s)trurio nodap nlicta(faDtmum no1tpxnii3tydfa ran p;u4altrxr oatlmtraiei;s seuriopiydlp nmicta()s2trxm ;u4olxomieiysfs2eln o u4altomr ootoatr uvs t)t2xoim no1al  lfviatfsDumx p;t4alxnif3tysfm2rl(vs u0tlerxo3oo1oaDr i i s) 2xo(r oodamt lfcslt  Dur( oou0tlxnmf3iyd m eanmo u)tetrxf3iotlpDrluvo t truo(opoo1lm e fesa(fsrtrur ;o4apt  fetld s2el(vsnt0 etoxr iy1fmD au o;s t2trim3ou1op nlncs s srtaurpot0tpe  ieiad mDel(vo (4tlxoio3oo1lmDrluvsls)setr(m iodal  mnvt t)sDuau pot1aeeomociyslm2rlumsnt)alxnmf3tydlmDrliei;(0srtmxr no1ame mnct tf rtmurooo1oleomiciasls2rm(ms;u0alxrxf to1fp r n s;t  2umxm io4lleemnvil(fs2rax ono0aexomictlt a2uau o ()tetrmr oatfmDrlnes;t) 2xoxm oy4lpt mivsl(  2rmx ooo1tee  ieildls rl( ont4altomo3tytlpD  i i (0 2uoxm3no1ape mietls)a2umxmp;u1opxnif3tadfa ul( o;u0aexrxocio1lm  anvi t truoio iu1op nlfvs t)artaur nt4oltn fctaslmDemnvpnu0alxoircto1lm   uvo;t)seur(m ou4ale mfeiat)s2trump;u4ole moeiytfaDra( p u0aeenmo3tytlaDeai s t)t2toxr iodapte net t)sDtrumo;u4tlxoio3iltfa rmnmont)arxnxr3tatla elneo;s t2xr(r iu4lme  fes s)s2trxm ou4ale  feiydla el( s;u) eeoxf io1opDelnvolt0t2trxr3ny4ol nlieia(fs2rauro;u0tpenmoeiaslaDea(mon(4alxrir3tydlpDe ivi;s trtoxm io1aptnmivs t)a2rm(ro;o4aeeo ictyt s rl( s;t0tetomo oatfaD aiei;s0trtm(m oy4lp elivi t) Dtrumo;o0aexnmf3iyt mDumn s u4 rerif ta1fatrauvi s trxoxm3iy1omtelfciat)a2tm( o;t1olt  fctydfa2emumo u0alxnio iadfp eaivi s0t2uo(r nudlleelfetl( s2tmum ou4ope mi3iadls ua( o;t4 rtnxrcoytfa   ivol( s2um(o ny4ap elfvia(f 2tmx  no4opt  fciadfa2ua( o;(0alerxf ia1oatelnvi s  rxmio3ou4llenliciasfs2ur(r oo0apenmfeiadfm ul(vonu0trxrmo3to1lpt li o ( t2trxr3iy1optnlnes sfsDum(m ;o4tlxo ieiys s uau o;u4 rtrir3oadfp  aivs;() euoir nodalee fcs tf rrmu  oo4aexn iciadfm em(ms t)teeomrctotop  lieo t0 rxm(o no1ap emieils sDurum ot4olenioeiys m uanvo;u0 exnmr tydopD auvil( srxrxo3ou1al elictl( s2ur(m oo1tpx  o3iysfmDem(mon(0altnmr3oatlm rauvi;s0 2ur(m3ny1lp emnes () rta( oot4alxnmieiatfm uln o;t0tltnmrcta1fm rlnvi;(0 rurimpoy4ll nmncsls  Dtr(m ot0aee iieiyd mDumu sn()teenmf iy1omDr i i t0 rurirpiydal elnei (farur(  ot0optnmo3ias aDrl(monu4aleomr tatfm  aieslt texoxopoo4om nmfvs t  2trumo;t4aeen i3tyslaDum(vs t0tetnio3iodoptran s;s)s2tmiopnu4apt mivtl()arrmx p;t0alto octysfsDean o t4 eermrcoydlmt  ivil()sexoxo3nu4ll elfvs ()aruax p;o0aee iiciyd m2rlnvp;t4aeenxr3oa1laD auei t  exoio iodll  lnci t)s2tmum ou4oltnifcild m2umumpnt0trtnir3tydfmtrln sl(0 2xoir3ou1op elfcsat srrm(r nu0opeo o3tlt m2rln o u)teeoir3oytom eln il() rxmir3oydopeemicia(f 2rmxrpou4apeo iciys a2um(mpnu4trtnir tatlpD aueo (0 exoxm no4lpt micsa(fsrrmur nu4apt mictls mDrm(vs ()arermo tytfpDeai s s)t2tmxo ou4op   ivsa(fs2uaum ;u4olxomociat m umumo u)aeerxo3oytom   iei s texrir3ny1apeemnctlsfs2rmurp;u4tpx mieiysfsDuau onu0 exrmrctodfa r nvilt  2um(o io1ll  lics s aDrrurpnt0aeeo ieiyd sDrlumpnu4artrir to1lat aivolt t2trir3nydope livs s sDumxm nt1aptnioetys a rmnvs u0areoxf3oydopDeau slt) rxoir iu4lm   nvilt  rrax  ;t1apxomieiydfaDuln s (0 ltrxf3iy1oa   nvs;s srtrxmpiudamtnmnctltf 2rmx p;u1teenmoctldls2elu pnt4artnmo iytfp e ues t srtoxopiudlmtelivtlt)sDrr(  ;t4tee iietldla2ea(msn()aeerxrcoy1lmt lueo;t0setoim3nydlpt mnetlt)srtm(m oo4opx ifeilslsDelnmsnu4alenir3oa1fmt  ueols truoio3nudomenmncsl()aDrmuront1oexoiiciysfa um(vpn(0trerio todlpteai o ()t2xmirpiy4lle mnci ( aruax  ou4aeen oeildfa rl(mo;(0tltnxfctadla r uei s setm(o3no1ap nlicias) rrmu  no4aex mfetltfa2rau s t)tleomf3oodlaDeluvi s sruoxrpoudaptnmnvtl(f 2ta(mp;u1aetomociat mDrluvpn()aexnxr3io1faDeln ols0s2tmxm3no1lm nmictltfs2taumooo0aee iociadlsDulnvsnt0aeermocoatfmtr nvo;s)sexrxm3iy1lmtnlfvs (fsDtm(moou0aee  f3ildlmDrl(vonu)aetrifciatfa  ln i s)s2uo(r3nodolee fvilsfarrm(r ;o4aexnmo3tad a2ra(ms u4 exrir3oytopDraivi;s) rtoxmpoydam emictls)artaxr ;u1oeen feiat a uluvs;u)trenio3iy1opD aieo s  etrxm oo1al e nciat  rtm(ronu4opxo ociltfsDua( ont)arxoiocoytlmDr ies s0tetoxo oo4omtelfesls  rtaxroou0olxn oeiasfm ra(vo;t4 eeoxo3oytlaD  u s;s0 rtrxopno1altnlnesl()arrmu oot0ope ifeiatfmDulu s;u0alxomo iadomDe ueo;t seuoir oy4oleelfviat srtm(mp;o0aptomoeiatla2emnmp u0trxrir tatoatraueils0s2uoxm3oy1opee netas)sDur(mp;u1opxomf3iydlsDuau snu4 etnxf3oy1fa raieil() exm(mpnudaptnlictlt) 2rmu  nt1tlx  octadls2emu p t0texrxo3to1faDe iei () 2trxo oy1ll  mnvsa(  2urx  ;t0aexoiictaslm emu pn(0texnxr3ootfmDr uvilt0t2xrim ny1lleelictl(fsrumxrpnt0oetn iciysfm uaump;u4 lxnmf3oo1fptr neo s0setm(m3io1lmt  ivta( s2rm( ono0oeeoif3ildlmDean p (0arxrmoctadoa e i o;s)t2uoim3ou1al n iet ()srur(ro;t1ope ioctyt s2el(ms;t0 eermf oadomtrlnvs s0 2xr(m3nu1ll  mfci s srra(r ou4tet ii3iat m2eaumo;u0 etoio iodlm rlnvo;t teum(o oodole lnct t) 2ua(  oo0apxomf3iltla2el(vp;(0arxomf iytfa e i s s)srxrim oo4ol nmivt s) 2rr(ro;u0tlxoiociysls ua(vo;u4trtnxf to1omtranes;s0setr(opnodlleemfetat srurxmooo1oee ioctat sDeaumo;(4trtrxr3ootlp ran slt) 2tr(opiu1omt mfesa(f rtmurpnu1tptnii3tld sDeluvonu0texnxo3oodoaD  nvsls  rxoxopoo4ap nlfei (fsrtau o;u0alxomfetys mDeanvs;u)arxnxo3io1fmtr i o t)sexo(o oodom elnvsl( a2rrxrpoo0tpe mictls aDem( ont0 lermo3iadfm rau sls  2xm(m3nydam  mfviasf 2tr(mo;t1tltnio3iytlaDea( sn() rtoxfcoatfaDrlnvi () etm(m3io1llen ictat)srraxmpno4oltniiciaslsDemnvp t) lxoir oydopDe uei;(0 2umxopio4llen nvi t) Duaxm nt4tpx miciytfaDulums t)trtrmr oa1lpteli s ()t2uoir3ou1op nliciasf Drru poo0aetnmictys a2ul( snt4trxrio oatom eaivs (0t2tmir ou1ll  mnvs (f 2ta(r nt0ole mo3ilt m umn o t) ltnio3iotom r nvs (0t2trxrpiy4lpte ieiltfsDtmu  ot0ape ifciysfaDrau p (4altoifcootfate ivsls s2xm(o ny1lltemnvil( artmx  ot1apeo fciyt sDul(vp u4aetomfctadoateanvs t  rtoxr no1lm nlfci ()s2uaxr ;u1aeeo oeilt a uanvo (4 eerifcta1omDeaivs;s0t2tmxo3oy4altn ivtlt  2rrump;u1aex  ieiyt m2ea( pn()teeoxo3tytopteau i ( srur(r3nudll nlncil(  ruaxroot0oltoifeildlm2rm(von(0 lxrif iydomteln i;s0srur(opny4optnlfvtas srra( ono4ope ifciys sDrmnmsn()trxoxf tatomD aies (0t2ur(opnodamee fcs tfs2ta(r ou1alenmo3tydfs eln onu0arerxo3oydomt lnvo;s srumxmpou4omen nctl(fa2taxro;u1apeoifetls sDuanvont4 etnmo oa1lm elivolt) eurxo no1al   nctasfsrrmurpno0apeo octys aDraumo;t4artriociotomDrluvs;t0 exrimpoodll emict tf 2trumo;t0oeto ietaslmDrlnms;() rxniocoadlp raieolt) ruo(m oy1lp  lnvils) 2tr(r ;u1apxoio3iltla2uaump;(0altoxociotfateaivi t0sexr(m3iodolee iesasfaDrmur oo0aeeo oeias m2ranmo;u0teeoio3iadfm rln slt)t2toxr iydlmtemietl(  Dtm(mp;t4aetnmoeias m2ua(mpnu4 rtrir3iydomteai o s0trtrir io1omenlfei tf rrmumpnu4alxniieiytfaDul( onu4tltoif3tydfaDelnvil(0teur(o3iu4lmtelnvi (  Drru pot4texoio3tytfmDem( onu4trxrio ty1lm   n o ()sruo(rpio1apt licsa() 2trum no0tpx if3tlt aDrmu pn(0teerxrcty1opDraivo ( teumir iudam nlfvtlsfs2rr( ooo1alxnif3tltfm2elumont4 etrxrctydlatrauvs s)seuo(o ou4olt livil(fs2tm(monu1oetomieilsfm ea(mpnt4treoifcio1oaDe u slt0s2ur(mpiy1lpt  fvil() 2rr(m ;u0tpxn oeiat a2uaumo u0 leoxf oy1oaD li s s)tetrxo oydlmtemfvs tfsDurxm ;u4tlto i3iltfm2ra(ms u0 lxrio to1fmtean ols0 rxoxr3no4ope mfcia() 2tmx o;t1oeen ieilsfa emumonu0aeeoio3iatoat  ies ( trurirpoo4lp  mfei s  2rr(m ;t1tptnii3tlsfm el( s;() rtrmf tydfpteliesl( trxoxo3oy1op nmfcilsf 2uaurpnu1aee miciadlmDrmums (4teermr3oytfmt ln ol( t2toirpno1oleemivils a2rm(r ou4oee  ieiadfa2eau o;u4trxoioctatlaDr i sl(  rtoimpoodlp e nct tfa2uaurpot1tex moeildfs ra(msnu0aexnio3iatfmteaues t s2xo(opnu1lm emfes tf rra(  ot0olxnmociytfm2em(msnu0tlxnxfcoadfmDeaivsl() etrimpiodam  livt sfsDra(mpnt1oeto octyslmDel(mont)alxnxo3iytlpt livs;s)sruo(o iudlpe lneiasfs2ur(r ou1aeeoiietyd m emnms u0trerxo iodlm eli o t  rxoimpiy4ap  lncia( sDurumo;t1opeoiieild aDuanvp t0trxomr oytoa  lnvols)t2to(o nudlp  mietl(fsDurum ;u0tpx ii3tls s2rmuvon() ltniocoo1opDranvsl(0 rxrxmpoodalen nciat) 2umumo;o0opxnii3iyd m ea( o;(0 lxoxocoo1lat  nei;( srxmir3iodam  lnesl(  Drax poo1tpeoii3iysfm2ra(ms t)tlenmo iodomt  uvs;s  2trim3oy1ap elnctls a2rrurpno4alenmfeiys a uanmp;u)arxomocia1op   nvs ( t2tr(mpiu1am  mfeias sDta(rpou0altomieiadfa2rmnvonu)tleoio iadopDrli s;() rxrimpoy4llte nctlt  Dum(rooo0apx mociasla2ulnms;t0aetnmo3totlm   ues;t) eum(r3oo4omenlfcsls)a2um(m nu1opt ioctldla rm(vo (4texnmo iadlptelu s;(  exoio3nu1amen ivias)s2trxmo;o1tetn fciltlsDrm(mon()tetnxf3to1lm r nvo s srxrirpoudaptemfvt ( srtr(rp;o1aex mietatlmDuauvp;u0arenxrcoydlaDrai sl( trtmirpnu1omen fciltfaruaxmoou4oltomieildlaDrm(vs t4arxrxr oy1optrai slt  2uoxr nodap elivi t)a2rrurpot4apt  feiyt s em(vs (0aexoioctotfmteluvs t srxmxr3io1lltemnesa()srrrumoou0olenmieiyd mDum(mp;(4alxrio ta1lm raueslt0 etmim oo4lltn ncil()a2rr(  no4ope moetat a ranvonu0artrxrcoatopDe uvol()trtrxr io4aleemnetasfsDumurpoo4oetnioetyd a2um(vont)tlxomf3ty1fptraueilt0trurxopiy1lmte fvtlt)sDuaxrono0tpe  ociys a em( s t0trxoxf iadfpt aivs;s tetmimpoudop n nci sfsrrr( o;u1tetn fciyslmDrlnmpnu)tetrxoctotfpt aueo t0s2xo(r ny4om  lfeta()sDrrurpoo0apx ii3tlsfmDelnvon()trxnmocoydlp r ivsl()s2xoir3iudlpenlivi ( arrax onu0aeeomfctas sDuln s;u4 lxnmf3oydop eaneils t2urio iodalt liet tfaDurx pnu1aexnmictld mDrluvs u) renmo iy1fate u s;s) rtrir3iodll nmfvsl(faDumumo;o0texomietld s eauvp u)tlenir iytfpDrau il(0sexmio3iu4ape lietlt srtm(rp;o4tlxnmo3ildfsDumu pn(4aetnmr todfp  aueo (0 rxrirpnu1am nmicsl()sDrr(r ot0tee io3iasls um(vp;t4 rtoxocoy1fpte ieils0 2xrim3iy4omt lfvs (f 2tm(  ;t0aee mociytfm2eaump t0tlxrir iytlatr nvo;s0sexmir iodlp elnvi (  ruaxroot4aex mietytls rmnmpnt4 rxoiociydoptrli o t0s2xr(mpno1ole  fciasfs2ra(m ou4oexn ociydls2emu sn()tltomf oa1fa   ivs s  eur(opoo1lleelfctltfa2taxrpno0oee mietas s umuvp;(4aexrif3oatomDeanes s0trtoim3iy1om  mfcias srrrxrooo1tleomf3ilsfs rlnmp;t0 rerxr3totlmt ai o;t0 2toxm nu1ll elicilt) 2tm(m ot1aee  icils mDean s t4arxoiociatlm rau ols setoxr3iu4llt  fciat) ruau pou4opt moetls s2elu s;t0trxnmo3todlpDeauvo t  etm(r ou4am nmivtasf 2trxr ;o1alxomi3iysfs2ea( onu0aexniociydla  auvi;s0 2trimpoo4omeemfct ( a2rmumpno0oetomociadfaDra(monu4texrxf tadoa r uvs;(0trtmiopiy1lpeemicsa(f rtr( pnt4tleomf3iytls emn s t4arerxf tadom raieo;t)sruoxmpnu1olee fvi tfsDurx  oo0tet moctas sDuanms (4aexnif iy1fpDe u i (  2urirpiudlm   nes s)aDra(moot0olt mfciasfmDrmuvs t4tltomf tatlaDr uvils0srtrxo3nu4lp nmicilt) 2uax oot4openmociat s el(ms u0 leomo3tytfaDeluvs;t0teum(o no4optn fct t  rrmum ;t4aexomocils mDranvs u4alxnir oytfm   uvo s0srxrxrpoydope mfes t  rtm(m ou1alxoio3ils s2rmnmp;u0aeerirciadlpte neil(0tetoio ny1amt  fvta()artauroot1teeomoetlslsDua( ont0aleoifciadopt ln i;( srtmim ny4ome lnvta()sDrmxr ;t4tpxoif3tydfsDuluvs (4 ltomr io1op eln il( tetrxopoy1alte nvt t)arumx  nu4optnioetys s emn pn()tltrmr3ia1fp elneol()srurxo3iu4ameelfetlt)arraxrpnu4apx  i3tysla2eanms;(0arxriocoatlaD lneils texmim nudlme miet s) 2rm(  ;o1oleo o3iatlm2ranmsn(4trenio ty1oa e i o;t) rxrxopoy4am elicias  rtmx poo4tex mf3iys s rmn s;(0aexrir3tydla   nvsls) rtmim no4aleemnvtlt sDtaxmono4oeenmictydfa2ua( s;(0areoifcio1fa r i o (0s2xmiopou1olt  fet t) 2tr( p;t4aleomieias aDua( on(4altomr iotlpDe ivs s) rtmiopno4lpeelnctl()aDtau pou4olxnio3ilslm em(vs;t)tlxrmr3tydfat  ueo s0t2um(m nydop emfesas  Dumum ;u0aptomi3iatfa2uaums u0 leoxo3oadlpte ivo ( srumim3ny4ol  mfvt tfs2ua( pot0aetniicias sDrm(vp;t)aetnmfctydfa  an s t  2um(r nudaptnlfvta( sDtrurpot4tlxnmo3tys s eluvsn(4 lenmfciodfa r nei;s0 2urxr ou1om nlnciat  2tmump;o0texn oetyd mDua( pn()trermfctatlmDelueo (0s2xmxmpnu4al  mfvsas)s2tmum ;t1ape  oeilt m2um( p;(0alxoif3oo1omDrai sls0teuoxr3oo1lm   nvt s)s2tmuro;t1tlt  octasls2el( s;u0tetnxrctotoaDrauvol()trxoiopoydap elfvsa(faruaxrp;t0alto f3tyd aDua(msnt4trxnio tytoa rlneil( truoim nu4oltemivtlt a2uax p;u1apt if3tasfs2em(ms u0trxoiocoo1omDelieo t srxmxrpiudoptemnvsas) 2tmumooo0tleo ictys m2emuvp;u) lxrif3tytlpDe n ols0s2xrio3iy4llt lfeta(faDurum oo0opt ioeildfm2ra(vo;(4tltrxfcoa1fpD  ieol(0setoio3oudop nlncsas  Dtaur ;o1opeoiocilsla uanms;(0 lenif3ta1fpDraiei;()srtoio3ou1ole  icia() Dumumpno0oleoioctad a rmumsnt4tetniocoodlmDraueo t0s2trxm iodapt lfesa( srrmumpou4tlx mfeiydfm2ea(vo;() rtrirciydfptrauei t) rxrxm iu4lpte ivtas)sruaxro;t1tlxn fcilsls2rm( o t)trtrxo3oatomt  i o ()tetr(m3iy4apte ivtasfsDuru poo0aee mo3iys a2em( snu)artomr oodlp e nvilt) 2toxo ou1amtn icsasf rtmxront4opx mocildfa2ranvo ()altoxfcoo1oaDe nvs ( t2xm(mpiydllenlneilt)a2rm( p;u1alt io3iasls eauvon(4 eeniociodomDr n s;s)t2uo(m3oydlm nlneilt a2urumonu0oet moeilsfm2rm(vo u)areomf todfm  lies;s) rtr(r3iu4lmtnmivt s srtax pnu4tlxnmieilt m rmumo;t4tltrif iy1lmDrln sl()sruoirpoudam elictlsf Drruro;t1opeoio3tas aDemump t) ltnmoctydfm e uei s0texmio nu4llt mneiatfs2rru o;u4ope mi3iydlaDel(mo u0 rermf oydlmt livo;() 2xo(r nydomt mnei ( srrmxm nu4ale  ieiat a ulnvs;u4tleomo3ty1om elnei;s0setoir ou4omeelietas a2ururpno4opx  ietasla ul(mp;t)alxnxf3tadfmDe i s;s)seur(r ny1lp elfei s artmu pou0tlto oetas s ulump t)trtoif3iatlaDr i o;t truoio3ou1al n ietlt)aDur(rpno0openioctydlm2rln on(4 eenxoctydlaD li i ()sexrxo no4lmeelicsatf Dtm(mpnt1tpxomo3iatla rlnmp;t)aexrmr oy1lptrln o;s  etrxr3nu4olt  ictl(fa2tm(rpnt0tptniocils aDrmnmo t) rxrir3ta1opDelivi (0t2tmxr oo1ol elnesat  rrruronu0alxoii3iatfmDelu o t)texnir iodfp  aieol() 2uoio3iudolt mietl()aDraumo;o0tlenioeiltla rmu snt)aexoxr ootomDe nesl(0srtm(r oydol emfvtls aDtaur oo4olxo fctatlmDulnvp;t4 eermo oodop   u sl()seur(m nudop   nvias) Dra( oot1aexn i3tyd s em( p;(4 exnir3tydfp r uvs;s s2xo(m oy4ol nlictl(fsDrrur ;u1tlx if3ilt s2uan p;(4aeerxf iy1lmte u o () exoxo iodamen ici tfaDtax pnu1tpxnmo3iydfsDrm(vo;u4tetnxf to1laDelivsl( seuoxm3iu1aptnlfcs t sDtmxroot0oexn oetydfs2rluvo t)artnio tatop   ivo s0s2xmxr3oodop  mieils arra(rp;u1oex ifcias m2rl( sn(4alerxf iadoatelnvs;t0tetrimpno1ome mivtls s2rmx p;o4texnmoetatlaDulu p (4tetoio iadlaDrluvi;s0s2umxmpnudop e icsat  rrmx  ot1tpt  oetadfm2el(mpnt0arxrxrcty1om  lieo;t trtr(opiydal nmnciasfs2ua(rp;t1olt moetltfm uau p ()aeeoxo ty1fm  ln s t0 rxoio3iydoleemfeslt  rraumpnt0tle mfeiytls el(vp (0tltomf3iatlptraivi (0s2uoim3iodolenlieta(f 2ra(r no4opx moeils m emnvs (4tltnmr3iydlmDeauvo t) euo(o iodapenlicsatf Dta(rp;o1tpt mf3tyt m2umn pn() renirciotom r uvi;t)trtm(m nydll nlneslsfartru o;t1tpeoiieildfa el(vp;u0 etnif3oodfp e nvi;s)srxoir oy4am e nciasf rta(m ou1oetnioeiyd m2eauvo;u4arxomo tytlat  uvslt0t2uoxm3ny1om nlfesltfsDta(rp;u0altomf3tas s2el( s;u0texomr3oy1faDe ivo ()s2tmio3oo1optelneil(fartaxmp;u0texoio3tyslm ranmpnt4tleomrciytlpDeau s;s)t2tr(opio4opeemietls) rumxro;t4teto i3tyd sDua( s;u0 ltoio iy1fm   n o;t0srumxmpiu4aleelieslt) 2ur(mp;u4texn octadlaDel( s;(4alxnmf3iydlpte ivol() 2tm(o nodlltnlies s s2rrump;o4tpxoioetldfm2em(mo;()aexnxfctodoaDelivslt0 rtrxo no1amt liesatfsrur(m no4openmfetyt a2em(vs (4teenmo3oytomDeauei;t)trurxm nydlm n fvil(f 2rmx o;u1aee ioctlsfs2rl(vp u0alxomocoydlmD li o (0 rumxopny1optemivsa() Dtrxmoou0oltn feiasfa2rln s;t)altnxf tytfpt aneo t sexr(m iudam n fes sfarurx pot0tltomocildla em(vs;u) renxo tadfaDe uei;()sexmxr3nydapte ietls)a2uaxrpou1tlto f3iatls2umnmp u0artnxfctytla raiei;t)t2xmiopnydol  mfctltfs2ta( pnu0oetnmf3iysfmDem(vsn()tetrxo3iodopD  n i (  rto(m oodamte nvtlt  rtm( ont1tpe mi3tltls umnvsnu0 lxoir3to1lmtr ueo ()t2tm(o3nu1lpeemnvtlt) rtr(mpnt4oltn octlt m2rlumont4tltnxo3tadlaDelu s;s)s2xmxrpiodlltnmfeiat) Dtmump;o0ope mfcilt sDeauvp t)tleriocio1lmt  nvi (0srxoxm iodlpee ieiat) 2tmu  no1tlx mi3iys m uluvp;t4aeenmo to1faD lu olt)t2um(opnu1lm n icia( aDtaxrp;o0apen fetaslaDraumo u)aexrmrcty1fmDe ieil(0teuoxm3iy1al emict ()arurxrp;o0alt  fetatls raump u)tleoxfcoatfp   uvo;s)setmxm3io1lp  lieia( sDrr( p;o0tleo i3tlsfa2uaumo u4artrxocoydlpt  n o;( t2um(r3oo4ol nlfct tfaDurxmpou1oexoioeilt a ra(msnt)texoif iatoatranes s  rxmxo iudalenmfctasf Drrxmpnu4aeto ietyslsDranvo t)tlxoir3iadfmt  n s ( s2trimpiu1lm nlivi s)sDumurpnt4oleo o3iysfs uaumo ()teerir totfpDrlu o t)s2xrim ou1ol nlnvt () 2umu p;u1aleomoeiasfaDumn ont) lxnmf ty1fatraivs s s2xo(opnudlltemivt (faDrmu o;u1ope moeiydfsDul(ms;t4 etoif3tatfaDrlnei;( srur(r3ou4lptemfvsl(fa2tm(moou0opeo fciyd mDrlumo t4 lerio ootlpD  ivo;(0 euoxr3iydlmt lnes sfarum( o;u0oeen o3iytfs uln o;(0 leoxo tatfp elnei t t2xmxrpio1al nmncsa(faDum(mo;t1teeo f3tyd a ran p;() etrxr3iy1la  anes;t0trtm(r oy1ameemfcsasf rtr(  no1tpxn f3iytls2ean o t4texrirciotfmtean i;()trtm(rpoy4lltnlfvsa(fsrtaxr ;o4opxn feilsfm2ulnmont)aexrirctotoaD an i (0 rto(mpoo1lp e icta(  rrruront1apen ieiadlmDea(von(0aexrmr3ootlmtelueolt0seurio3nudap nmfetls sDuaxroou1tetn feiasfa um( onu)aexrxr ty1opDeli o;s  rtr(rpiydlpee icil()aDurur ;o4texo ietlsfsDean ont4trxoxf3iydoa  lu slt s2xr(r nudlpteliesl(fartrum oo4tpxomoeiatfs2ua( s t)texnmf3oy1oa e i s s srum(r io1optelfvtlt  Drr(mpou4aetomietatlmDrln p t0 rtoir oa1fpDelnvo;(0s2tmio iu4apt  nesasfaDra(rooo1oeeomoetysfm umump;t4aetoif oytlpt lueils0s2toim iu4oltn fetatfsrtru ono1tee  oetys m ul( s;(4 rtrircty1op ean s t0 exrxm ny4ame  icsa()srraumo;t4optomfeiytlmDua( p;u4tetoxrciodoatran s;(0 2xoirpnu4lp n ivt ()srua(m ou1aptnmictasla2ulnvont0tetnioctytlpDraivi;t)srtrxmpiy4al nmfcsl(fs2rr( pnu4tlenif3ils s2rm(ms;(4 leniocia1optr u s t0s2xoim oudlptnlfvi sfsDuru  nu4tetoifciatfa2ranvsnu4tleoxo oy1fateliei s)setoio3iydol n fviltfsrtrumpot4optnifetlt s2emu o;(0teenmr3ootfm rauvo;s0texrxr ny4om   fvsat  Dtrx pot4aexnifctltlm ea(ms () lxrmr tatop rlneilt) exr(m iu1ome mfvias aDtaur oo1tpeoii3iltls rlnvpn(4alerircto1lmD ai s;( srumir3oy1ol   ncsasf rrmx  ;o1optn o3ils m rln p (4tlenifciodopDe nvslt0t2xoim3iy4olt  ivtl(farrr(r ou4aet ioeiltlmDean sn(0teenmo3oytfpDe nei s0 etmxmpoy1omtelfvtlsfa2uaumpnu0aee iociytfm2ean pnu0arxrmrcoadlpD livo s)s2to(m3ou4aptemieilt) rrm(ront4aptn feiydls umn p;u) rerxf oatom e u slt) rtrir3iu1omte ncs () rurxront1texomfeild s elumo;(0trtnxr3iatla  ai s;t)trxoxopio4optelict sf Dtmump;u1tex  i3iadla2um(mon(0alenxo iytfaDeaues t s2xrxm iu1ome mics t)a2raxmo;t0tle iictlt a uan s u4 rtnmocoydlmD  nes;t)sexoxm3iu1lpe miesat)sDra(mooo4opt  feilt a2eau pnu4 lerxf iotopt anesl(0 2tm(m iodom   ivsatfs2uax pou4oleoii3iysfsDea( o u4 eeoif3oodfmte uvol(  rtrimpoo1apen nvils)sDururo;u0ale iieiatfmDuanms;(4tlxrmo3oa1lmte i i;(0 2xrim io1omenmics t)a2rau  ;t0tle mf3iatls uanvs;u0trxrmf3oydfpte nvo (  2xmiopoudlmee netasfaDtmx o;t4tpt  ietlt aDrlnvs;u4altnxr3oydfptean s;(0srtmxo3iy4ome lfet t  Dum( onu4optn fciys m2ran on()aetoxr iytfmt  nvs ()t2ur(rpoydll n iesa() rtmx  ;o4alxomo3tysfs elnvs t0trtnxf oydlpDrai sls  2uo(rpoodllen fctlsfsrum(rp;u1texnmf3tydla um(mpnt0tltnmfcta1lmDr i s t  rtmir nu4al nmnetl( sruru onu1tpe mo3iadfa2ra( s;() eeoio todlmt lneol( t2xr(mpiu1lp emiesat aDtaur ot0open i3ilslm rlums;u0aetomo todomtr nvolt0trtoim3nu1ap n ici (  Drru  ou4oleoio3iyt m ra( o (4 leomo to1fmD lu s;t) ruoirpnydomtemfei s aDtmu oou4ole mf3iat aDrlnvo;(0trtrmf3iatoatrliesls0 exoxo3oo1lmtnlnvta(fa2rmxm no4apxn oeiys a rlnvp u0 etrxo3tydfp rlneo;s  2xriopoudom nlfvtat a2tmxm nu0aet mfeiatlaDrauvs;()teeoxfcto1fa eaivs s  exrxrpio4lmtn ics ()s2ra(ront0tet mf3iasfa2ea(mpnu0tlxoxrcio1fpDelueil() eur(mpou4openmncia(f Dtmxrpno1olt mi3ilslm2rm( s t)arxoif tydfmt  ivs (  ruo(m3iydop e icil() rtr(mo;o0oex if3ilt aDrmnmp (4arenmo oadom  aiei s)srxr(m iu4lp nlnvs tfs2trxmoot1oee  ictatlm ea(vp t0trtriocoatom   u i t texmiopnu4lp   nei t aDrr( p;o0oleoifetltls rlumo;() rtrmo3iodlpD an s;s0t2xrir oo1om  lfes tf Drrurp;u4aeto f3iatfmDeln p;t0alerifcoatfaDrlnvs;(  2uo(opiu4am e ivtlt s2rr(r ;o0tpt mf3tatfaDrmuvo;u4alxoio3iatop eaneolt srxmxm3nu1alte ivt ()sDtr(rp;t0aeeoiieiyd m elumsn(0 ltnxf io1lptranvo t)s2toxo3oodll elfesas)sDta(mp;u0aeto oeiatfs ra(vpnu4trxoxf3todfp  li sl()texoxo3oy4lm elfeta(f 2rmxrpot0tlen oetasfsDem(mp u0 eenif3iytopDe ueol(0t2umxo3no4altnlfvs tfaDtrum ot1tpto o3tadfm emuvont) exomr oatlmDe ivi;()s2uoxrpiu1om e icta( s2raumo;u0tee ioctadlm2ea(mo;(4altnmf tatoat  i ilt  exoxo nu4amtnmnesasf Dtau p;u1tlt  f3iydls rlu pnt4trenxociodfatelueo;( truoimpio4am nmieil(  rum(  nu1tpeomi3ias m rlnvo t0 lxnmf3tatfa e n o;s  rtoir3oo1lltn ics s  2ua(r ;o0alxn ieiat sDemn p;u4 ltomo iotfm  auvs ( s2xo(r io1lpeelnesls  2taxm ;o0alen f3iltfaDel(mp;u0 eenxociatlaDeanvs;t s2um(o3nodlptnlieia(  Draxm ;t1alt mf3iyd a ua(mo;()trxoif3iydlmtelnvo;s0 etrxrpno4ap nmnvilt a2uax oot1opeoii3iysls rm( p;t4areoxfcta1lm r i sls0sexrxo3ny4alenlfctas) rra(rp;u0aptnmf3tatlsDeanvsnu4alerxr iy1la e n i;(  rxoirpno1lm  mieias) Drrxm ;o0alxnmfeiysfm2rl(vp ()aeeoxf to1omD aieilt)sexoxr oy1lp elncilt)sDum(r ou1aetoiietytlm2eanvpnt4 exnircoadla rlu o s0srum(r3oy1llenlicil(  ruaumo;t4olenio3ias sDel( s (0 rxrxf3oatlp rluvo;()t2xo(m iydomen nci s)sDurxr ;o4tpxnio3ildlaDemuvsnu0tlermoctodlaD au s;t t2xm(r iodlltnlnet t s2rm(mooo4oexnmiciyd s elnms;(4 etnxocoodfa  anvo;( texmxm3iudame  fvilsfartaur nt1olxnif3iydfa2elnvon(0tetrxoctatfmt  uvi;t  exoir iudale mnetasfsDrmxmpno1aptnif3iadfmDemu p ()tltrmo3oytla elu i () rtmxr3iydolte ivil()a2urxm oo0tltomf3tas s elnvp;t0altrmo3io1oaD  nvs;() 2uoxm3iy4lm nmnvsl() 2uru pno1aet if3ilsfaDelump;()trxoir iy1oate nvi t)t2xrxo oo1ope lfcta(  2rr(mp;t4texn ieiadfa2rmu s;(4 reomrcootlmtrln i;s)s2urir3iudlp e ici sfartaumono4aetnii3iat sDrauvp u4areoio3oadopD  i i;s0trxmxrpiudlme lfet sfsDrm( ono0tpxn i3ilsfm elumpn(0altoif3tatlp elivols) rtmir3nu4op e iesatfa2ta(rpoo1oexnifcildfs rmnmp t) exomocoatopte u sl(0tetoim3no1ape mfcsl(fsDrrxrpno4apt iociytls2ua( o (4arxoxrctatom  luvil(  exr(o3iydom n ivsl( s2ra(m ;o0olxoiieiatlaDulumon(0alxomrcoy1fa ean s s t2tm(m3oo4omenlneiat a2raxrpot1oexn fcilslmDemu p (0 lenif iodfaDelnei (0t2trir3oodalenlieta(f 2uaxr ot0altomfctat aDeauvp u) ltrmf3ootfm e nvslt0 exoim iu4amenmietl(fa2tau ooo1tpt  i3tyt mDum(vs;t4 rtnxo3ootlpDr n sl()seuoxo oodalte fvs s  Dtaxmont4apeoiieildlaDean snt4 etoifciytlmtrlues t0 2toxr oodlp  mfci s  Dtru pou1tpto oeiatlm2ul( snu4aleoir3iodlaDe neslt)t2uoxmpno1ol nmnesas)arumu  oo1tex if3iysls2uln s;t4 rxoxf3iatlp  anvsl()sexoiopiodamte fvilt s2uru ooo4tpxoiociytlmDuan s;u) lxnio3oo1lpDe ues;()trtm(o no4alee nvt s artaurpou1tlen f3tas m2rauvo;(4alermfcoy1oatraivs;s)t2um(mpoodoltn fvt s)s2tau pnu0optn i3iyslmDean p;()artrmr todlatr u sl(0s2xmxo3nodol  lncs s)a2trx oou4apx ii3ias a2em(mp t4arxnxo3tytlp r neo s)seto(r iydame lietasfa2rmumoou0oleomfetysfm2um(msnu0teeoxo3iy1fp  aneo;t) euo(m3io1ame  fcs sfsDra(mp;u4ale moeiytlm ranvo;(0aexoir3oydlm e uvs (0 rxriopoudopenmfvi s aDua(moot0olx mietadfmDrm( p (4 etomrciydfp e nvo s0 rxo(rpnydalen nei (  2taxr nt1ape  ociytlm el(mp u) renmf3iotlateanes;( sruriopno1al n feilsf rtrurpnu0oex ifcilt a ran p;u4artnmr3tytlpte ues s0seurio no4omte neiasf Dtaump;u4aetn iciytfaDeanvp;()trxrxr3iytlaDe iei (0trumirpoo4ope  ici s  Drrxrpou1oltn fciatla ra( p;u4trtrxr3iatlmt aueolt)tetmim nodlm nlics tfaDtm(r no0aetomi3iys m2elums;t4aetnmr oy1lpt  uvols)t2xo(o oo4lptemnesa(fs2ra(  ;t0alx  o3iasfaDul(ms (4artniociodfaDeli o (0trxoxmpnu1am elnvtl( srrmurpou1optnio3iyt aDumu o;u0tetoirctydfat livi;s)t2xmiopnodapte iei tfsrrmu pot0optomfeilt a umu p u0 ltoir3oadfaD  uvi;s)s2xrxopiu1am n ivilt a2rru ont4optnmocias s2uauvon()aetrxrctatoa r ieo t  2xmxo nudaptemnvta(faDuau  ;t1opt ii3ilsla2rm(ms;t4texrmf iodop e uvs;(0trur(o oo4oltnmfvs (fsDrmx onu0optn oeiasfs2eau o;u4alxrio oy1laD ai s;t tetoxo nydlle  ict t)sDtmum nu1tlto i3ilsfm um(mo;(0 exnmf iotoa rlies ()setoim3nudoltnlnciat arum(mo;t1aetnii3tasfmDrlump t) etrxrcootomDe i i (0trto(r3iudopenmfei t arumumonu1oex ifciltls ra(vs;u4texoifcoydfpD anvo s) 2xmio io1omeemivt s arrrxro;t4aetomoeils s2uauvo;u)trtoxfctotom r u i;s srumimpoodlp  lfeiatfs2raurp;u0alxomi3tatlaDumnmpnu4tlenxr3ty1optraiesl(0seurxopoy1lle miei t s2raumo;u1opx mociyd sDumumsn(4trxrmf3tatfpte neo;( t2xoir nu4ame lnesl(fs2umx p;t4tet mietydlaDean o;t4tlxrir3iotlaDrln ilt)teumxopnydlmenlivslsf 2uau pnu0opeo ocilsfs2ua(mo;t4 ltrif3iatfpD  u s t)sruo(o3no1ome  fvsa(fa2rrxront4olxnmi3iytlaDra(mont0trtnmr3iytlmD  uvsl(0 2urxr io1aleemncsa()sruau o;t0olt  f3tyslm rm(vs;u)teenif3tatopDelieo;s0tetmxr3no4opeemnet sf 2tm(ronu4olt ii3iyd mDeluvs u)aetnifciytfa rlu olt sexr(m nydalenmnvsa() Durxm nu4aexniiciytfaDrmumpnt)trxomoctatop   n i;() rxoiopio4omen ieilsfa2rr(  ;t4teenmfctaslm rmnvon(0aeeoir ty1om raivsls0t2to(r3oy4ol eliviasfaDurxrpnt4tlxnmf3iasla2rlu o;()aexrxf3ty1lpD aieslt)seumimpoydap  mnes ( arrru o;u0tpe mf3tyd s rlnmo;()alerxfcoy1lmtranvs t0 2uoxo3oo1llenmnciltfa2tm(mp;o4opxomieiyslmDranvpnu) rtnif3totfat lieo;s0trxm
\ No newline at end of file
@@ -0,0 +1 @@
+nei;t) rxm(o3nudam nlnvs s)sDumx  no4olxnmieiysla2rl(mp;u)tetrmr ootoa rlu i;t) 2tmxmpoy4ape mfcsat s2tmxrp;o4tex mf3iatfa2emuvpnt4 rtrmf3oadfm r neo;(0trtm(mpio1omt  fcsa()sDta(r ;t1apxnmoeildlmDuan s;(4tlermo ty1om  aivo t  2trimpou1op   nes (fs2tru p;o1tlxoii3tatlsDumnmonu0 rtrif oytoatrai slt0 eum(m3oydaltnlivi s) rrm(r ;u1oltn ieils m2umu onu) ltrmr totlaDrlneol(  etm(m3oo4omtelnvtlsfs2uaxmp;u4alxo feiadfs ua( p t4trxnmociytfpDr nei;( teur(rpiu1lpeemiei sfsDtm(rpnu1ape ioeiadla rlump u0arxrmf3oo1fpDeauvs;(  2umxm3ny1ole mfctat  Dumumont4oeen feiydla2em(mpnt4 rtriociydlm eauei;()trtrxm nu4amtnmncsasf Dtrx p;t1tlx iietyd a2um( s;(4alermf ootfa eaues;t) rxoir3iu4ome lfetlt)aDrru  nu1texomf3iytfs ea( snu)altomrcoodfate uvs t)texm(m oydlpe  fvsat srumum ot1tpxomi3tltlm2emn o u4arxrmocio1opDe neo;()trtoio iy1amtemfvt () Drmumo;t0alx  i3iasfm2rlnvs;()arxomr3oo1op r nvo;t)t2tmxopou1aptn ivs ( sDta(mpnu1oeenmiciaslm2rl(mpnt0 etrmf io1fatr i i s s2toimpno1altnlnvs (f rrmx o;t4apxoif3iad mDulnmo (4trerxrciodlpDraueo ( tetoxopoudlmeemiei ( s2umum ou4opx ifetytlm umu s;()teerxr3iatlmD an olt0t2umxo nudlmenlfetas artauro;t1tpeo iciltlaDuanmon(4alerir3oadom  ai o;t0 exoio3oudlme  nci (fsDraumono4tpxn i3iydfm ea(vsn(4 reomfctatlaDr ivo;t0s2xm(r3iu4op nlfeiat)a2ua(r ;t1optniieiyt mDua(vs t0trxrmfciadoaDeanvs s  eumio3io1lpt lnvs (f 2umx  ou0optnif3iltls rmn p t0aetoiociytlm rai s;t0 etr(r3oo4apt lfcias aDtmu o;t1oeto iciadla2uln pn()tlxoxf3oatomD aivi;t s2toir iy1am nmivi s) 2rrumoou0optoiietyslmDumn sn(0tltrirciydfptrlneils)s2xrxm3oy4opte nvils)s2rru p;t0optnif3iatfaDrauvp t)aetoxf totfpDrlieo;s) exoim iy1ol  lfviat sDrmx o;o0ole iieiysfm2rmuvon() lenmoctodfp e ivs;s)s2tmiopiu4lpen icia(  Dururpoo0tpx  f3tyt s rlumon(4teeoir3oodfp rlnvols0tetmxrpoudlle mncsl(farra(rpno4ope mfeilsfaDrauvs;u0areomociodfpDelu o s) exr(o3io1amtelfvs ()aDua( pnt4aexoii3tld sDuan on(0trenir iatoateaieo;t0srxrirpoo4lleemfcs t  2urxroou0olenmociyd m em( s;t0 renmfcootlm r nesl()srxoxmpoodll n netlt  2rrumoou4tpx  iciatfs ran sn(0 etoif iadfa raies (0t2to(mpny1amtnmnviltfarum(m ;o0apxn iciat m2el( p u0aleomo3oatlp  aneil( srtrio3iu1lltemnvt sfsrrmuro;t4alen f3iatlsDranmo (4trenmociatfpD  nei t0t2xr(opoy1op   iei (fsDumumoou0olenmfeild a rmump (4 exnxf io1lpDe uvs;s s2um(o3iodapee fvtat)srtmumoot4apxoifcildfs2emumpnt) exnxo todlpDranvi;s t2uoxmpnodopt  nctas srta(rpnt0aeeoifcias s2uaums;u)aeermo oatomtr nes;(0t2trir iydlme  neiasfsDtrump;u1apxoiictad a2rlnvp (4aexoxrciadlpD  nesls srtr(m oo1al nlivil()srrmx o;u0aexnmoctls aDul( s u0tltrxf ootlptr iei;() 2to(m iu4amen nesa() rtax pnt1opt  i3iadla2rluvsnt4tltnmocoodlmDr i s;t srum(o nodal elivi ()aDrrxmpoo1tlxoif3iytfs2ua( s (0 rxrmf3ty1lptraieslt0 2trio ny1lmt lncs tfsrrru o;t4tltn ietld sDemnmp (0 eeoxf iytoa eauvilt)t2toim3ou1llt lieils  rrrx o;u0olxoif3iydla2umuvonu) ltrmf3iodfmt lu o t0srur(opoy4lmt lfctltfartax ono1tpe  f3ildlaDeln pnt4teeomr iatlpt auvi ()s2xriopny1om  lnvtlsfa2tmx  ;u0oexoio3tldlm2rlumpnt4teeoxrcoo1opt  uei;s0 ruoio ny4lme mivtlt s2tr(moot1apt mfciltfa rmu s u4tlxnio3ia1fp r nvols0seuo(m3iu1amt mnvia() rum( ono0tpxnmfetytfa emn s (0 rtrmfcoy1laDr neols0texrir3nudol   ietas) rrmxm ot1aetn oeiysfs eln p;(0trxrxrctadfpDr ivo t0trtrxopiu4op emfcslsf 2taurp;o0tlxnifetlsfm2rlnvo;t0 ltomrcio1lmt lueo;s t2xoirpou4lp  lies s artmx p;u1tpx mfetltlmDuau p () reoxf3tytopDranvo;()tetmxrpnu1llenmnesa(f 2uaum ot1tex ifciadfaDum(mo;u)tetrir ootom elneol( truoxrpoydolenmnct s) 2ta(rpou4apx ifciys m umuvo t4 exrmr ootom  au sls)setrim iydam nlicils a2tax pnu0texn ociytfm2ran o;u0tlxomf3ia1omteln sl(0teuoiopny1llenmfeta()s2trurpnu4oet mi3iytfmDeanmo;(4 reoif tadlaD  n o;s0trtoxrpiodamt  ncs (f rrmur nu1aleoiicild s eanvs u4aexrio oydomtrlueo s)t2uoxrpiodlp e ncs sfsrtax pot4oex ioetat m2elnvp t0tltoxfcta1lptr ies;()t2trimpou1apte iviasfaDurxmpnu4tpeoif3tlt a2emuvp t0aexnio iatop e ueo;t)sexo(o oo1ap elnet ()a2taxrp;u4ape  fctld s el(mpn() rtnircoodfmDeaieslt0trxm(rpiy1olen fcslsfs2um(r nu1texn fciydfaDeau o (4aleomrcoadopt li s;t seuoir nodll elict tfsrra(mpnt1apxo fctlsfsDuau s;u0trenir3io1latraueo;s texoim3iu1lpt  iet tfa2rr(mpno4alenmfcild a2ea( o;t0teenmfctydop e iei () 2tm(o3oy4ll  lfes s  2rmu o;u1alxn ieilslaDrl( onu) etnmo oadlmtranvilt  rtoxrpoudam elncsat) 2tmumooo0tptnio3ilt aDul(msnu4teenmrciydfmtr ues;t0 etmxr3no1al   neilsf 2rmumpno1apxoiocilsfaDemnmo;t4alermr oa1laD  u i;t  exr(m iy1lptelnvsa()a2rru o;u0olen fctys a2rau snu) ltrmo iodlm ean ol(0trurxm iydomen fcsltf 2ta(mp;u1tlenmoetysfs2ulnmonu4 etnmf3oy1oat  nesls  2xoirpou1llt lnviatf 2ra(r ;o0tpxnii3iysls2ean p t) eerif iytomt aneolt)s2urirpnu1altnmncsas sDuaum ;u0aee  o3iadls2ulu o u)tetoxr3iy1lmteau slt0teuoxr3io1omee nvt (farrm(r ot0ole ioeiyt s2ranmp u0alenio3ty1fmDraieslt0trtm(r io4lme  ivils arrr(  ;u0alxnii3ias s uluvpnu4alermo tydfmt lnvil(0 exo(m nydamee neil()sDrr(moou0optn ieildlaDrluvpnu0aexomo3to1lm  lnvsl()s2xo(mpou4apenmies ()aDuaum nt4aexomo3iat aDum(mp;t0aetnifcoydfpDeliesls0s2uo(m3io4lp emnvilt aDuax  ;o1tet moeiydlmDuanvo;t)aetrif3iodlp eluvsl(  2uoim ny4lmtelivtlsf Dumum ;o4altomfeiatla2em( p;(0tlxnxo iy1fpt aneils srxoimpoo1ll emivs s)sruauront4oee mociat a2raumsnu4treomfciodfatrluvolt0 2tr(rpnudol e nciasfartrx p;t0tpxomfctlslmDea( o;t0trerxo3oa1optelieo;( texoir no1om n fvta(f ruaxront4opxnmociatfm eau p;(0 exoir3iytlmD ai o;s s2xmim nudlpt lnvtat) rrau oou1aexoioetyt mDrm(mo;t0 lxrxo iodfaDeauvi (0 2xr(m3nu4ol elietl(f Dtmu pnu1ape  feiyt s2em(von(4arxnxocio1faDr ivs t s2xmxo3no1ol nlieil(f rur( pnt1aexnif3iasfa ua(mp;(0arxrxfcty1fpt an o;s trxo(o3iy1ap nlnetls  2uru  ;o0altoio3ilsfs eau on(4aeeomo iodlpDr nvs;(0s2toir oodop n nvsat artax pot0oleo i3tys m2rm( p u0altoxo3ty1la r iesl( t2urxmpiudomenmicta() 2rau p;t1aeeo fctldla rln p t) etoxociotlm e ueo;s s2tr(opnu1opt  fetat)sDrruroot0tlx iietldlaDelnvpn(0aetniocoytfat  ivils)srtrxr ou4ome lieslsf Drrx pou4oexn ietls m eln snu0 rtrmoctotfaDrln sl()t2uoim iodamt  iet () rta(rp;u4oexo f3iasfa2umu s u4tlxnxr ty1fmtrai s;(  etmxm nudalt  netl(faDraxro;o0tlenmfciatlaDumnvpnt0alxrmo3tytfpte ivolt t2tmxm3oydll emfcs (fsrra(rpou4aexnifeiyt aDrl(vpn()teermocoatomD ln o () rtmimpoy4omen ncsl(  rrmxmp;u4tetnmoeiatfsDra(mon(0 exrif tadlpDeluvi;s trxo(m3nodomtemnctl()s2umxmooo4tltoifciysla2rmums;t)teenxfctotoaDe ieilt0 2xo(mpnu4apenmneiasfa2tmum oo4aetnmictasfmDra(ms ()tetnircoydfp   u i;s s2xmir3iy4opt  iei (f 2uau p;o1altoioeilslsDeauvo;u0tetriocto1omtr i sls s2xo(o ny4oltn ivsas) 2urxmp;t4tleo f3ildfa ua( s t0aeeoxr3iodfp ranvi s0 rxrxopny4lpee nvia()srtrxmpnt0aptomfctasfmDrl( s t0arxnir3todomDranvs;()trurxrpoudlptemnvilt)srrmum ;t4tetniociytlsDuau p t0areomf3iydlatrlivol(0 rumio io4lme lfcsat) rum(mooo4olt micildfm2el( p;(0aexrxr3todoaDelueol( s2uoxm ny1lmt mfeil(fs2rm(  ;o4oetn fetysfaDul(ms t4aetrmrcoatom  au o ()seumio nu4lpe lnetls)a2tmu p;u0aeenmfetatfm el(ms;u0aexnxf oa1lpD anei;(0t2xo(opnydlm elneslsf Draxr nt1aeto i3ildfmDulnvp t0aexrmo todomtrlnei ()trtrio3nydamtnmnctatfarrmxro;o0tet iociyd mDumn p (0teermo3ootom rauvi;(  rxrxo ny4lptemfvtlsfsDuaurp;u4tleoif3ilt sDemuvp u)arerio oy1fpDeaneils) rtoir ny4al   ivta(fa2rmx oou0aee  iciydlmDrmu pnt)aexoxf iydomtraiei s0t2uoio oy4am nmfcsl(  rtru pou0oeeo fcilslm2elums;u) etrmrcoytopD luvolt0srxrxr oo1am n ietls) 2rrurpou0tpxoii3iadlm rl( pnu0 etrio ta1lpteauvo;t) 2um(r io4ll eliesls srta( pnt0teenmo3tydfmDul( s;() rtoiociydoa ranvolt0 2um(r3iu4ap   ict (fsDtau pot0tetniieiysla emums;u)alxomrcty1lm  aieils)teumxo oy4amenlnvsls  rrm(rp;u0tpenifcilsfm rmumo;u0teeomr3to1la r ues ()tetr(rpnydlle lnvta()s2um(mpnt0tet miciatlaDra(ms;t0aexrir3oa1lat  n ols  etrxr3nu4ap  mnvi s  Duaum nu0ole  icilsfs emnmonu0 ltrxr3iatlat ln i;(  euoxm iydlptemieslt a2ta(mpnt4aexn i3iyd aDumu pnt)aexnmo oytlpt aivi;s0s2tm(o nu4ll nlncs sfartru onu0ape  ictatlsDumnvo u)trxrxr3tytlpD li o t0srto(m no4ope  fcsa() Dua( poo0olt  ictyt s uln s;t4arenmr3oydlmDe nvi;(0s2uoxm3nu4ole lnciasf Drrxm ;u1tetnmfciatfmDemuvpnu4tlxnmfctydlateluvols0 2uriopno4amt mnvia(f 2tauroou0alxomietat aDumnmsn(0arxnxr oydlaD luvo;t  2xoiopnydll n nes ( sDur( oot0ale  ocilsls2eau s;t4artnir3tytfm r ivs;t)setrio3iu1op elictasf rtm(mpoo0tlenifcilt m2ua( ont0aexomocty1oaD  nvo;t0 etm(m3oo4aptnlieta(fsDrru o;t0opxn octydfa2ul(msn()trenxo tydlm raivs () 2tm(opoy4ap   nvi ( a2umxm no0tltnioetyd a rlnmon(0aexomf3tydlp  lueo;s0srtm(r3iudom e fvt t)s2um( oot1tpx ioeiysls2el( s t4artnxf to1lmte u s;t)setr(rpio4am e ncsat aDrr(m nu4opxo f3iad s2eluvp;(0teeoio3iy1omDeanvs;s srum(m3oy4lmt  ncsl(  2tm( ooo1tptomictyd m2em( pnt)areoxr3totfmtran ilt)trxrimpnodomeelfetltf rtaxr no0apeoiociyd a2ulums;t)tetoio3iytfpt  nes;() ruoxo iudlmen fvt s  Dtauroou0tlx ifeilsfa uanvp;u0 rxoxo tadlaDe i olt0teuoxopoo1lmt mneils sDuaxmpou4oetn oetysls umn pn(0aexrmfcoo1fmteau o;s0t2tm(r iy1lm e nesat aDumx oou4tetomoetad m2rl( sn()arenmociytfaD an olt trtrxr3iu4om emiesat  2taxront4olxn fetadlsDul(vp;u)aexoxr3ia1omtrauvo;s0 2xo(m oy1op nlicsat aDrrx  ou1altnmfciytls el(vo t0 rtrir3oytfa e neilt0t2toirpny4lp emiviltf 2um(r ;t0oexo feild s2uanmont4 lxnxr3tytom  lieolt0trxmxrpiu4ape mfvsa(fsrtr(r no4ope mociat a emn s t)aeeoif iatop e ivi s0t2xoxrpio1olt mfcsl()arrax  ;o1aee  i3iasfs rl(vp;u4tetrmf todomt anvs;s)s2toiopny4ol elivil( aDuru p;t0aeen fetld m rlumpnt4tlxoxr3tytoat livi;() 2umxr3iodam  lieiatf 2rr(ro;t1texo ociaslmDumnms (4 exnmocoodoaDeaues t0tetm(opnu4lmtemfesat  rumumono1alxomfetat mDeanmp;u0texnioctodfaDelueo s0t2tmir3ou1oleemncsl( srum(m nu0texo feiytfa umu s;t0texrir iadfm r uvo;()sexm(mpnudaptelfciatfa2tmx  nu0aleo oetysla2ul(mon(0alxnxrcoydlmD luvol(0srum(m3oudaltnmicsltfs2umu ooo4alt  o3iat s ranmo u)arermf3tadoaDranvol(0s2uo(m3oy1om nlfeiat)srrmurpnt4tpenmictyt m ra(vsnt0 rxoio3oatfmt ln o;s)setmio nydop  lieias  2taxmono0alxoiiciydfm rlnvs;t0 lenmo oatfpteau i s  rto(o io1omtn fct t a2raxrp;u0oltoioeiasfs eluvs;()aeenmo to1fpD lueo t trtmxm3io4llt lncs ( aDraxmo;t4apxo feils mDean snu)aetomrcoo1fpD  iei;() etrim3iudol  mnctat  2ur(mo;u1oltoiictldfs2uau s u)altrxf to1la rlueolt)trtm(r oo4altnlicslsf 2raum oo1ole mi3tltls2ran s;t)artomocoatfptrlnei t) eur(mpoydll emnci sf rrru oot1ole mi3tas m um( p t4 rxrxrctadopDr ies;t  exm(m3iudoltnlfetat)a2tm(r ot1aleomiciytfs2rmuvpn(4 rxomo iydoate ieo;s0s2urimpno1om nlnesa()a2tmumont0alt iieiyt s ra(mo u0 lenio3ootfat luvo t)tetoim ou4ameelfeslt) 2tm(m ;o1tpx mi3ildls rlu s u0trxoxr iatlp  lneo;s t2xrxr3nu4lpe  ncs sfsDur( o;o0tetn o3ild a2umumpnt4aleoxr3iadop  lneo;t) 2xr(m nu4lle lfeiltfs2taxrpot1opeomf3iad a umu p;()aexomf oodlpD lueols trto(o oudll nmieiltfsrumum ou4tpe  o3iadls emnmp;u4texnxr oodomte n o;t) rum(m iu4lltelfct ()arrr(mpou1optomi3ild aDea(vs (0tltnio oodfaDelueols) 2uo(r3nudop e iesas aDuau o;u0aexomoeiatfa eanmo t) lerxo todlmtrau olt)sexr(o3nu4olt  nvi t) 2rax p;u1aexnio3iadla2raumo;t) rxnxr3tatlmDraneilt srxrxo oo1lpee fet ( s2rm( pno0oetnii3iadls rmnvpnu4teenir oatoaDr nvolt0trumio3iu1al e ietas)aDuaxrp;t4tetomfciasfsDeanmp;u4 ltrio3ia1la eanvi;t0texm(rpoy1lm e ics t arurxr nu4opx moetatfsDrl( onu)tetomf3oatopt  ivo;s  rtm(r3nudlmeemfvt t s2rrxrpot1tptoii3ildlaDraums;(0 exrxo iadopD livs ( trum(m3oo4optnlfetls)aDtrxrp;u0apt mfciat s eln o;(4arerxfcoy1lpD  ivils)t2xr(o nodomee ncsl()aDur(mp;t0aetoio3iad a rmumo u) exnxo ootomDelieil(  2urxrpny4llt mfet (f rrr(rpnt1apto oeiys s2uaums;()trtomr3iydlmDrluvols)trur(o iu1amt  nvtat)srurxmono1tle iiciyd s umu p;u)teeoxocootfm  anvs t0 rtoxr iydalte ivtlsfs2ta(monu1tee mictys s ua(vo;u0aeenmoctadoateai ol(0srto(o3oydomeemnesl(faDrr(m nu1teenmoeildla2ua(mo;u)aleoiociadopDr neol(0truoxopoodlmt micilsfarur( pnt1tpxnmictad a2ua(mpnt0 lxnifctatfpDelu ol( s2umimpny1lmtemfcslsf rur( o;o4tleomocildlm eanmp (0 rtrmr oy1faDr ueo s0s2xoirpou1oltn iciat sDta(m ;u4tlen fcild aDem(vo;u) etoxr3oo1fpt  n s;(0 2xrxrpiy1amenlfctas) rurxmooo1oexomo3iltls2umuvo;u0texrmo ootoaD luvolt0trtmirpio4apt  ivsa( srrr( o;t1tpeomieildfm2um( o u4trxnmo3ta1lm  livs (0setoxr nydamte fvta(fa2umump;u1altnioetasfs2rmnmpnt)altrif3ty1fmtr nvs;()s2xrxo no1omen nctl()a2urxmono1ope ifetasls ra( pnt4texrmr ta1opDe neo s0setrxo3iydap emfvs s) Drm(ronu4tpto octydla2ul( p;t4 lxnio3oa1lmDrau i s0srxo(rpnudopen fesatf ruaum ;o1optomf3iydla2ua(vp (4aeeriocoo1omD  u s;t)trxm(r nudlpeemnei (f 2rr( ooo0tetnmoetydfa2em(ms;u)trxoif3iydomt li il()sruoiopnodamtemfvsa()arrmum ;t0tetn oeiydlm2ua(vs;u4aeenmf3oodlpte uvi;s0teuo(m io4apeemict s a2ta( pot4alxniociytfm2ul(mp t) reomfctodfaDeanvo;t0 exriopnu1lmtemfvils) Drrumono0tlt moetydfa2ean s u0altoxo3ta1la eaneol( trurxr iu4lmtn icsas artm(ro;t1opxnio3iasfmDraumo;()tltrifcio1la   n i;t  2xoxrpoodlltnmneiat  2taxr no1oexoioeils aDul(vo u4 renxo3oa1fp   u slt) rxoiopio1lme lfvtat)s2uaxm ;t0oee iicilsfaDumuvp;(0texomf ty1oaDrlnvslt0trxmxrpnydlm nlivta( s2umxm nt1aptnifciys s uanvp;(0trxomo3iadfatrau i ()sexmio nu1alenlneiltfs2taxmont1tleo o3ilslm2rm(vs ()tlenmf tatlmtrlu o;t0t2toiopoy1aptemfetas) Dur(rp;t1olxnioetldls umumont) rxoir3tydlmteaiei s s2to(m iudom  liesl(fa2umu pot4oexnmfcild aDrln on(0 ltoiocoodoat aues t)setr(o3io1ame micsat  rur(m ;o1apxo octytlaDranmsn()arxoxo iodlateli il( s2tm(r oo1ome mivt s)s2rmxrpoo4olenmociys mDraumo;(0alxnxo oadom rlivi t)tetoxmpio1omt mfeils aDtm(rpnt4apen feiydlsDra(vonu4treoifcoo1fpDrlnes t) exrir3oo4apen ictas) Durxmpot0ole ii3iytfs2uln p;u) exnxocio1fpD lueolt0srxrim3ny4ape miet (fsrrrurpno0tetnio3iatfm rm( s u4 rtnmo iatfm eluvi t  rtr(m oodomt mivsa()aDum(  nu0olenioeiyd m2eaumonu4tltrio3ty1lpt lneolt) etrxo3iydope  nvsls)s2tru pou4openmocias mDrlums (4aeenxr ta1fat anvi;(0sruoim3no4ale  fesls artau o;u4ape ioctysfa2elnmo;t4 rxrmr iadlmteanvo;s srtoxm iu4lp nlivslt)a2uau  nt1oetnmi3iaslm um( o;t)tlxoxoctadlate uei;(0 rumio oodlmee fciat)srrau o;o0aleoio3iydfm rluvs;u0 exoir oy1lmDrauvolt0seur(mpnydame  ncta() Dta( ooo1ope  feiat mDulnms t0alerxrciytfaDr n il(0t2xoir3oudapenlnetatfaDrax ono1tlxomiciadfmDumnvs (0teeoxf oodom  ln o () exo(o3nu1oltn fetat)sDtmxmonu0altn f3ildlm emu snu)tlermoctydlptran s;() exo(m nydapte fcils)s2trum ;t4aee  ocilsfs2uan s;(4 renio3ootomtrluvil()s2toio iy4olt  ivsl( arurur nu0tpxn f3iysfmDem(vo t)aetrir oytfpDeluvils  rxmir3ou1ame mfeils srrax ono0apt iociydfm emn p u0 lerif ty1lpD aivi (0 2to(m3oydap  lncsl(  Durxmoot1oexoii3iatlsDraumpn(0alermfctodfmDe ueo (0srumxopnodope mfcsa(fsrrax  nt4tltoifcias s ran o;(4arerxr3iydlptrlu i t) ruoxm oy4lpenlnet tfs2umu poo1oetn f3iatls2eanmpn() reomfcta1fa  aies s srum(opiy1ole  nei (  rrrxmp;u4altnmf3iltfaDean sn(4trxoxf3totoateaneo t) 2urxr iy1op emnet t)artm(rpou0teeoifeiltls elu s u4 rtomf ia1opD ln o;s s2tmir3iydamt  fvs tf Dumx poo4tet moetys a2ra( p u) renmo iatla r ieo;s0seto(m ny1lm e ieiat srururp;o0olen o3iadlm rauvp u0treoxoctatfmD  i i;(  rtoimpny1aptn ieias  2ra(mp;o1opxo fetldfs2uanvpnu4aexnxrcoy1lmt  uvo t0t2umxmpoo4amee feil(fsrua(mpnt0apeo f3iadfm elnmp;(4alxomf tatopt aneil(0srxrio3iydlleemiet s srrax pou4tlenmo3iltlmDel(vo u) lerxo iadlatelu i;s0 2xmxm3oudap elicsls)aruaxm ;u4tetnifctat mDrlu on() rerir3totfatran o;( srtrxr nu1am   fei sf 2raxr ou0aex ifciltla2ua( s u)arxrmf tytlptrauvi ( s2toxopoy4altemictatf rua( oot0tetomf3iadfs2rln s;(0altnircootfm elieo t sexoim3ou4lmeelieilt aDua(  ;t0tpeo iciatfa ul(mo u4trtomo3ta1faDr ivo;t  ruoimpio4aleelnci s)artmxr ;u1olenmicilslsDuauvsn(0alenxocoo1fa raueolt0teuriopiydaltnlfvs sf Dra(r ;t0opeoii3tadfa2em(vs t4 eerxoctytfpt luvols  exo(mpiy1aptemfvs s)s2taxmoou0tlxo iciatls2rmnvonu0tlermr3ia1lmtelu i;s0trxo(rpnydom nlfvs (  2tm(mooo0tptomi3tls aDuanms t0 eermf3tadopDeluvsls0teuoir3no4lmeelnciat)a2taurpoo4aeeo ietyt mDuanvp;t0aeeomocoydop rau i ( t2toxo3io4amtemnvtls)aDtr( o;t4alxnioeiatlsDranmp ()tlenmo3to1fateanesls)sruoxo iodllt  nvsa(  Dtrurp;o0aexn feildfa2uau ont)artoxfcoa1fmteluvi;s) exr(o3no1ap  livsa()artr( pnu1ope  fcildfmDeluvp;(0artnxf ia1faDelueils0srtoirpiudamee fei sf 2rm(rono4aleniiciytlm2rl( o;t)tlermo iatom r ues t)tetm(o ny4lpeeliciat sDumumooo4altomi3tltfmDumuvs (0tlermf3tytfaDr n s ( sexm(o iy1lptnlies tf 2tau o;t1oet mfciat s ran o u) lenxr3tatom raieo;t) rxrxm3nydoltnliei t)s2rmxmonu1oeeomociasfa eanmo;() ltomr totlpDeluvo;s) 2uoim3nodlpte ici ( s2tr(m ;u0aeeoio3tas aDel(vpnu)tetnmo iytfaD anesl(  etoxr oy1al  mnctl()s2trxr nt0opt mfeilt aDrau p;u0texrmfciy1lmDelu s () 2tmxo iudom e ivta()sDrrur ;u1teeoif3ilt aDrl(mpnt)aleomr oytoptranvo s0 2tmirpoudom e iei sf Drr(ronu4aex  iciadlaDum( p u0aeeoxociytlmDraiei;(  2xmxr oydol emieilt srtmxrpoo0tpe io3iatls2rm(mp (4artnxfcoodfptrluvo t sruoirpoy1oltnmfvt ( s2ur( pnt1tee  icildfa rauvp u4artriocoatfm  aues;s)seurxo nudop emnvsa( s2ta(  ;u0oleoioeiysls ul(msnu)tlxoif3tytlaDe neil(0 2umxrpnudal   ivsas)srrr(m no1alt if3tltfs rm(vo u)aetoio3to1lp rlivo;()trum(m iydom emictasfsDuaurpno1aptniietatfa2umu pnu)aetriociytfm eanvi;(  rurxrpou1lme  fviat sDraxm ;o1ole  i3tltfa2uanmp (0tlxoir3totomtr iei s) 2ur(r3no1ll  mnesls)srumxrpot4altn ociat s el(msnt0 exnxf iodfptr ues;s srur(m nodlm  mivtls) rtr(rp;u4opeomfetadfs raump (4trxnif iydfpteaivo t0t2toim3oydlptn nvsl(f 2tm(ro;o4olxn ictadlmDemnvs (4 etomrciadfa rlivo t0t2xm(r nodom n nesatfsrtr(mp;t0tltoifciad a ranms t) etoio ia1faD li olt) 2ur(opoy4alt  icslsfs2raxrpno1tpxo oeiyd sDuauvon(0aexnxr3ia1lpte u i;t) eurxm3oy1lpe  ivsa()srra(rpou4olt mietydla2ul(von()tlenxo3oydlpt  nei s t2urio iodap emiesls) Dtrxro;t0oeenmf3tasls rlums;u)tltomr3iatfaDrli s;( s2xmxopou1opt lfcsat)aDuau pnu0alxnmieiysls rlnvpnu4 rxnxr ty1fpte nesls)t2uo(m oodopt mnvtl(faDua( ooo0tpe mfciydls2em(vp t0trxnxr3oydoa  lnei ( s2uoxm iu4omenlncsltf rrm(roou0ole ifeiasls2ul( o;u4artoir3ty1lp   uei t)tetoxopnu1lme mnvs tf rraxm no1opxomo3tatfs2uaumo (0alenio3oadfmt  ieo t0 etrio3no1lltemncslt)a2rrumpou1opx iociasfmDul(mp ()aleoioctytfaDr u il(0t2xoxm iydlme mictltfs2umx  ;o0texn oeiys aDum(mp u)arxnxrcta1lmDran s s0trtoxo oodale lnet (  rrm( ooo0apeomo3ildlaDra(mp;(4 eeoir ia1fpD aueo;(0s2xmir3iu1lleelneiat)sDtmxro;t0aee  feildls2eln p u0 ltrxr oa1fpD ai sls  2xm(rpno4om emnvils) Draumont0tpx mfeiadlm2ulnvon(4 rtnir totlp ran s;s)seuoxo ny4lm emietas)artaxmpoo4texnifctytfsDran o;t)artnmo tadfpt aieo t0teumim3no4apt mivsls  2raxrp;t0oee mfcilsfs ra( snu0 rtrmf3iatfa   ivils) rtr(mpoydopenmnctl( a2urxmpnu0aeeoifetytfs eanvonu4arenmf3oa1faD anvi ( trxmxo oy4altnmfet (fsDua(m ;o0tltnmf3tyt aDea(vo;u0 eeoxrctytfat aueo s trumxo3nydaptelfcils)arrm(ro;u1ole  fctyt sDrlnvp (0 lxnxf3oydomDe u s;t) 2tr(mpnodol  lnci s) rrrxmpnu1tpxnif3iysfm2rmumpnu)treriocoydom eluvi;( truoiopny4op nlfci tfaDua(mo;o4oeenmo3tls sDemu s;()altnxo totfmD  ues (0 rurxr3io1lltnlfcta( aDtrxro;u0tpt  oeiyd a2ea(vo t0altoxf todfmtrln i (  exo(r3nydopen fcias  2rmu onu4oee ifetlt s2ea( s () etoio3iadfa r n s;()tetrxo iodap  lfvsl( srumxmono1opxo ietldfs2ra(mo;u4 reoxo3ootomte ieo t0 exmir3no1ll e fciasf rrmu  no1opx iieildfa ua( ont0trenmocoa1fpt  u i;(0 2trim3ou1llt mnvtas aDrmx pot1olxnmoetytlmDrmnms;t4alxrir3tydla e ueo t trxoxopiu4oltelncilt)arrr(rpnt4ale iietys aDran p (4tlermfcoatfmD  nvo (0setmir3nodlpt lnci s)a2uaxr no0opxn oetlsla rln pn()tltoifcoatlptrlu ilt)seumxo iu4altn ivs t)srtr(ro;t0aetomfetytfa2rmumo t)aeenxo oo1oatrln s t)t2xmimpiudlpte fei (faDra(ro;u1ape  ietlslmDrluvsnu) rtoxr3iotfp   ues;( teum(r3iy1lmenlnetls) rtrurpou0tleo o3iadla2ul( p;(0tetrircootfa  aivils) 2uo(opoy1oltn ict (f 2tax pnu4oexniociltfmDrm(vo t)areomf3to1fp e i s;s  rxm(o3iy4lmte ictat) rrmxro;o1tptoiictlslm umu s ()tlerxf3ootopD  uvi;s t2tm(mpno4altelfci t  Draxmo;t1aptniictat m rau pn()treomrciodop rauvo;t0 etmiopoo1omtelfvi s) Dtmx o;o0tptnifetltlm uln p;()tlermfcoa1om  aivslt sruoirpnu4lmtemicias)srua( p;t1tlt ii3ilsls2rm( o (4aeeoio3iatfpt auei;(  euo(o3iydlmtemnesl(f rtru o;t4tpe if3iyt aDea(monu4tlxoir totoaDeluvs t)seuo(o oo1lpeemfciasfs2umx  nu4opxoif3tytla2emn s () lenir iodomDeau ils0 2xo(m oodlpt mivsl(fartmur nt1oleomi3iasfm ranmont0tetoir3oydom e nvi;s seto(mpnydapenmfetl()a2uauront1tlxoiieiyt s2rmnmpn() rtrmr oytopDr nvs;s0s2tr(mpou4apt mici (fsDuaump;o4olxn ieiytla2eau pnt)aeerxrcoy1fpDeanes;( sexrxr3oy4aptelnciat  Durxrpot0apxnmoetat a2ea(vsnt4 rxomocoatlmD aivilt  rtoim3oy4omtnlieslt  rua(m ot0olen o3iadlm uan s;t0alxnmo oytlaDe ieils t2uo(m3ny1lpe mnctat  Draxr ot4tetniociadlmDeaump;u0 ltnmf3tadfp  aivi t)seumxo ny4olte ietas s2uax pnt0apeo ictas s rluvp t0texoxfcoy1omDelneo (0 euo(rpiy4opee nvil( aDumx ono4tee if3iaslmDumn p t0alerir3tydopDe nesl(0trtoio iudam   fvs s) 2ururont0teenmf3ilsfmDum(vs ()aeeomo totfa elieslt sexmxo3oo4lltemiei t) rrmu p;t1tex mi3tyt a2ranvp u)teenmr iytfaDeaueo t)t2uo(o3iy4ap nmncsls srta( oou1aexo icilslmDul( o t)trxoxrciytom  lu i t0texmxmpny1lp nmics (f rtaxmpou0aexo ociltlaDeluvs (4arxrxrcoodopD luvsl(  2toxrpiudapt mnci (farua(mpno0teto o3iasls ranvpnt0trxriociy1oaDelnvo s  2xmxmpoy4llee fcils)sDtaxmpot0aleniiciatlmDelumo u4 lxnxr todfaD lies s texrxo3nodam  micslt srrmu ooo4oetomoetyt mDelump t0 rxnmrcia1oaDranei t) rtrirpoydolt  iesat a2rrurpot1tpxn feiltfaDuanvonu)alxoxf3tadfa eaivsl(0s2xo(opio1alen ict (  2uru  no4aleoiieiaslm ua(mp u4 rerxfctytoa  au s;t)tetoxopiu4ll nmieta( a2ra(ro;o1teen ociytfa emuvo ()aetrmfcty1oaDrlnvols srxrio ny1omee ici s sDrm(r ;o4ape ifeildfm rln p (4 etnxo3oa1oatean s;s0t2toxm io4olt lfvtat)a2rrx o;o0apxoiociad s uauvpnt4altnirciy1oaDean sls)t2urxm3io4amenliciat) rraxroot0oetnmieiadlsDean p;u0arxrifcia1lptelivilt)s2umxm3iy1ameelfvil( aDta( o;o4tpe moeiyslmDrl(vpnu0trxomo iodomDr iei;t)tetrim3oodopt lfcil(f 2ta(mono4alt mi3iyt sDrl(vo () leoxo io1fm  lu olt)t2xmxmpnydoptnlfcsas)s2taxm nt0tptnmfctytlaDeanvp;(0 rxoxf iodoa  au s;s)s2tmxopny1alenlneslt)arurxmpno1altomiciyt a ranmpn() eenio3iatfa elivo;()s2uoiopiudlm e ictas)a2rmurpoo1tlt mieiasfs umuvs;(4 etnir io1fmDr ieslt)sexrxrpnodoltnmicsas) rtmuro;o4alxo i3iys aDuluvp () eeoxf3oy1om eluei;(0tetoxmpoy1lpt mict s)artrx pou0texo i3iadlm2ulu snu) rtnxr3iadlmDr n olt0 etr(m3oo4optnlieilt  rumx p;u4aexoio3iatls2ua(vpnu) lerxr iydfa e ivo;s)trxmio3oydol  mivilt  Dumu ono4aeeniietlsla2elu snt0 rerirciatlat anvs s texrxopiudlpenlicil() Dtmxmonu1opxoio3tyt aDuluvpnu0 etnio3ta1fat ln i t texoimpoy4optnmfvt tfartmxmo;u1alx  oeiltlm el( ont)tlxrxocoo1fp e uesls srtm(r3iu1lmt mncils)s2uax oou1tle moetys a2ulumon(4 exomr tytfaDeai o;s  2xriopiu4am nmfvt tfaDtr(r oo0teeomfeiat m em( o;(0tlxrxr3oo1lmDeau o s)srumxmpou1al  lfvtl( aDtax poo0oee  oeiad mDra(ms;u4texnxf todopDe ies t  rxr(m ny4lmte ivtls)srrmxm ;t4ale mieiatlm uau p;(0arenif3ty1fpD li sl( sexm(m3no4aptnlnvi s)s2rmxr ou4aexnmicilsla2em( o;(4tlerxo oadlpDrai il(0s2umxmpnudomte fctls s2tmxrp;o1tltoii3iadls2ua(mo u4trenxrcoadfpD luvs t)texrxm nu1am   nei sf Dur(mp;u4oetnmo3iadlm em(msn(0 eerxf3ia1oat lnei () eurir3nudlm nlicslt)aDuaxm ;t4opxnmi3iadlmDulnms t4tlxrir3totomt li i;t texrxo3oo4lpeemfctat  2uaur ;t0tex mociyt aDulnmpnt4 reoifcoo1om raieo;s) 2xoxo3nodome lfei sfsDrrxr nu1tlt  fetytlm umuvsnu4altomocta1omt  uvs t0 rxrimpoy4lleemivtat  Dtrxrpnu0optn fciyt m rl(mpnu4 rtomo3tydopt  uvo ()teumirpnudlpeemfvia(fsDua(rp;u0tpt  i3tys a2rmnvp;u4alenio ty1fmtelu olt srxo(o oy4lltelnvia( aDua(m oo1oex ifeils s ea(mp;t0aexrir3oydlm r nvs t)sruoio3ou1lmt lnes tfsrurur ot1oexnmoeiys m2ua(vp (4alxoxr3iydoa rlivi;t0s2trxr iudopte fcils s2rmum ;o1aeeoif3iyt a2emn p (4 eenxf3oy1la  lnes t0texmxmpoo1alee iviasfarrax ono1aeeoioctydfa ran o;(0 lerxf oy1la rln il(0srxmxrpoydamen fct t s2ra(  nu0olxoii3tysls2el(ms t4artrxfciotfat  neo;t0 2umirpnydlp elncs ( srtrumpnu4olxnmoctadlm2ranmp t0teenirctatfmtrai s;t truo(r3oy4al n ivt t aDra(rp;o1oltomieildfm rln s u4aetnir3oytoa  aneols setmim3no1ol nlnvsas) 2uax ooo0aex  ociadfm rm( pn(4alerxf iytfa  liesls  rxmir no1omenmiesa(fa2rrumpot4oeeo ieiat sDrlnmo u)alerxfcty1lpt aieols0seumio nydoptemfvi (fsruax pot4oltnmieiadlm rl(vo;u)arxoir3oo1opteanvi;t  2toir iy4opee ivil(  Dtm( oou0tle  i3iyd aDuanvo t4 rxrxrctydfmDrauei ( srur(opoo4llee nci tfaDtmurpnt0ape ioctls m2uau o (0altrmf ty1lp  lu o;t seumxo oydomeemnesa( s2raxm ;u4oeeniietls mDemnmo (0 eenir iotopte neo t0srumxopou4ameemicilsf 2taurpnt0oex  feiydfa2ulump;(0arxnifciy1op r i il()trum(mpoudlpenmfei tfsDtm(ront1oexnmictad sDuauvs u4tlxnmoctydomte ueo t sexoim3iudopt mnetasfarrmx ono0oex if3tytfm2raump t)treomf3to1lmt li i;t0 rumxmpno1aleemfct sfs2rm(rp;o1tet  oeiadfs rlumo;t0tlxnxf3ta1faD  ieo;( trxoxr iy1lmtn iei (fsDtmxr nt0opxoio3iyd a2ulnvo;t) reomo iytlpD  u s s  rtrim nodamenmfviat  rrruroot4opx moetld m emuvp t0teerioctytfpDran s t0 2trxrpny4apt mivs s  2rrx oou4aptnifctadfsDulnmp;(4altrxrciadfpt auvolt0srtrxm3no1lltnlictatfs2umxr ;t1tlxniieiytls2el( p;u4tlxrircoadopteaivols0 exmxr3oy4om  lnet t) Dtax  ou1alt ioeias mDemnmp;()trenxfcio1faDean sls)sexrirpoy1am e neias  Drrum ;u0oeeo o3iyt a rln s;(0arenxoctydlm eaieolt  2uoxm3iy4ap  mics s)srrrx  ;u0tetoiociltlaDeluvs u4trtnxo ty1laD lueo;s  rumirpiodlm n fvtasf Drm(ro;t1oltnmf3iysfs ran p t4 renmr oy1optrlu o;t0 rtm(mpio1amen neslt) 2urxmont4olxoiieilsla uan ont0areoxf3oa1fpD lueo s) 2xo(rpnu4ap n fct t)aDtm(  ;t4opxomoeiysls um( s;t)artnxo3ta1fp  auesl(0 ruoxm3oydapt lnvsatf Drr(m nu1altn oeiadls ran o (0 exnmoctydlaDr ieilt0srur(r3nudam e fes sf 2urxmpnt0tptnioetls aDumnmo;t) exnxr iytopt ai o;( trtr(m3no1llenlncs tf Drm(  ;o1aptn o3tadfa2em(msnu4trxnmrciadfa  lues;s)trxmio io4alte feslt)aDum(rpou1tlxnmfeiatla em( sn(4 reomf3oa1lpD auvsls  2uoxr no4lpeemfetatf 2rm(moot0texoii3tld aDumn p;()aexrxo io1fa   ieo;t)t2urxr3iu1al   fvsatfsrrr(m ot1oet mfciyd a em(mo;u) etrmf oatfatraueslt) etrio oy4oltemncs t sDurum nu1ale iieiyd sDem(vo;(0 rtrir tytopt lues s)trurxrpno4op nlneils)srrm(m no4aeeo i3tydls2ul(vsnu0 renir3iy1faDe u sl(0t2umiopno1opt miet ()aDrm(mpno1tet ii3tltfmDel(mp;()trxoxf oydoa eaieolt0 2umir3oodolt micsatf 2tmxm ;t1oeeoif3ils a2uluvo;t0trtoio iatfateau o;t sexr(rpnudalt  fet t srrrum nu1optoiietydlm2ranmsnu0 lxoircty1lm ranvo s s2xmiopoo4ll nlncta() Dtrumpoo0olto fcilsfa emnms () rtrmf todoaDr ueolt srtr(o no4am e ies s) Dumxrpnu4ope mo3tltfmDraumpnu4 ltnxo tadomt  u s;(0s2xmxr3no4optn fesl( aDurxrooo1altn i3tlt sDemump;()tetrio3iotlp elnei t texmimpoy1ll  mivt s  rtm( oot1oltnmoetytlm eln o t4 exomr tadlm  luvo s t2uoxo ou4optemfcias  2rmump;t1tltoiiciaslm ua(vp (0arxomo3oa1lmDe neolt0 rtmim3oy4lm  livias aDrax ont1tptniicilt sDuanms;t4tltnir3iodomteli i (0 2umim iy1ale lnei t  Dta(rpnu1tlt  i3iadlm rlnms;t) ltrxfciydfp elivo s srumxo oudop nlncsltfaDrm(r nu1aleomfctasfm2raums;(4 etnif oa1lm eauvs;s) etmxr3nodlptnlfvt ()srtruronu0aex ifciadla ea(vo u) ltnif iatlat  nvils)s2urxm iydll nliet t arrrxm ;t1teen icias sDrl(vs;t0tlxomf tadlatr u ilt)trtrirpiodome mneil( a2ra(m ot4aee  o3tas a2rm(monu0 lxnmf3oatfmtr ueils  eumxrpiodaltn fvtls)a2rrx ont0tle  ociadlm ulnvp t)tltrxf3ia1omteluei;(  rxoxm ny1olee iesltf 2taxmo;u0ole ii3ildfmDra(msnu)altnir3todlmD aivo;s0s2tmxo oudal elivs t a2tr(mo;t0aptomfetlt a2rauvo;t)alxrif ia1fmDeau i (0t2urim3iu1lpenlncsa(f 2tr( pou0opeomoctytfmDul( o ()tlxnir3tadlpDrlneslt sexoxo ny4alt mfeia(farua(rpoo4ole  iciad aDrl(vpnt0 rtrxoctodomDraneo t truoxm3oy1ol  mivta() Dtru pnu4alxnif3tlt a2umnmp;u0aetrmociatfmtr u i;( t2xr(m3nu1al nmfvs s aDraumoou0apt  ietlsla um(vs;u4 leoxf3ta1oateaies (0srtr(rpou1omtn ivi (fsDtmu o;o1aee  fciyt aDrlu snt4 rtomo3todfmDr ivo;t0 ruo(rpoy1lpte ieta(faDrau  ;t4oetoif3iytfaDea(mp;u4areomf3ta1lm e u s;s trtrirpno4lp n nctlt sDrmxr ;t0tpen f3iyd m2rl(msn()texomfctytfa   n ilt)t2xrio io1lpe lncsasfa2trxmoou0oet mi3iad a rluvp;(4aetrxf3iadfate iesl() 2tmim3oo1lpee neilt)srra(mo;u1texomieilslsDel(vo (0 lermr oatomt  n s (0 2xoxopny4ome lfct ( a2taum nt1oee io3iadfs elums t0artoxr iatlm e ivs ()trxoxo3nodaltn fctatfsruaxmp;t4texnioetad sDumnvs;(0 exnxo ta1fm elu s;() exrir3oodlm nmivils)aDraump;u1olto i3iydfmDuanvonu0 etomo3totfpteaivi;t  2tr(opnu4open fvils a2uaur nu1apx iociatfaDum( p;() ltoxf oytlp  au s;t srtoxm3ou1om emnvtltf 2umumooo1olto ieilt s2uauvpnu4alxnir oo1oa e n i s setr(mpnydope lfet ()srrrxr nt4apeo ieiltlaDul(msnt4 exnmocia1fm   u i s0trxm(mpio1altn fetasfaDrrumpou1tlxoifeilslm rlums t)aetnmr iodfm e neolt t2toxm nu4optn fvilsfsrtrxronu1aet iictydfm2uluvp (0 reomf3totfpte ivs;()s2tr(opnu4omt lietat) 2ua(mpou4apen octaslm eaumpn(4altoxoctydoatelueslt0trxo(mpnydalenmfesat a2tmxmo;o1tetnio3iydlm ua(vo;u)arxnmr3oydopt aieilt0 2xoxm3oo4llee ncsas)s2rrurp;o0oex  feils s elnvo;t4alenxrcoatfpDe uvslt) eurir oodale mivsat  Drrump;t1ape mfeiyslm rlu p;(0arxnmr3ia1lm   i olt0t2umxmpny1lpe lnvta(fsDtr( p;t1tlxoioctatlm uanvsnt) lxrmo3oa1fate uei;(0 rum(r3nu1olenmfcsas) Dtr(  nt0tlt mieilt mDumnvo;(4aetnio3oodop e ueo;( teur(opoodom emnvi (fa2umxm nt4tpxnmo3ildlm2ulu s (4artrxfctydfpte uvo;t) rxoio no1ol e fcsasf Dtr( onu0tpenio3iasfsDra( onu4 lerxo ootfmDrlnvol(0teumxrpiy1ope lictat)arrax ooo1olxo ietatfs emn snu4aetrir3oatlpDeai s;s)teuo(r3iu1alte ici ()sDtm(mpnu4aexomieilt m2ua(mo;u0tlxrxociytlaDraivo ( setm(rpny1opt mnvi t sDta( p;t4tlenmfciatfm2um(mon(4tltoxo ootlm elueils  rurxrpoodap nmncilt  Dumum no1tet ifeiys s umu s (4trenirctadlmDrau s t)setm(m oo1olee nci (f rrm(mp;u0tltomo3iys s2el(vs t)trerifcta1oateanvils0texo(o3ny1opte ivtl(fs2um(  nu0oeen oetltlm elu onu)tlerif oytomD  nei t)texr(r io4open ncta()artm(  ;o0aex ifciltfa2emnmp ()texrxr iy1fmDeluvs;(0 2toxm3oodop   ivi (  2tmu oou1tpe if3tad s2elu ont0artnxoctydfa elneols0teum(o3iy4om elfviatfaDrruronu1aet  icildfsDeln o;u0texrmrctadlatranvils0 exoxrpiodol nmnet (fsrtr( ont1tpxoifeiysfa2rm(mpnu0alermr ta1lpDe u o ( tetmio iu4ape mfctl()aDtrumpot4tlt iocilt s elnmpn(0tltoif oydlaD livs;( seur(o iy1om n iesasf 2uaurpou0texoifciys a2uluvp t4tlxnmr oytom e i s s0 rtmxm3oydol e fet t)arrmx pou4opxniietytls umums;()trtnmr3oatopD luei;t)seuo(o ny1ol elfvt ( s2tr(m oo4teeniiciyd s uanmo ()tltoxo3oydfpteaneo;(  exmxm3oydlmeemnvs s)a2trxmp;t1oeto fciyd a rmnvp t4arxnif tadlpDr ivols  rumxo3iu1altnlivi t  rraump;u0tle ifcildfsDeau s;t4altrio oytoaDr uesls t2xm(r oudomt  fvs s sDra(mpoo0tlt mf3tadla2em(vo (0artnmocia1faDrauvslt  eurimpoy4ale  net (faDuru ono4oetnmietatfa2ran s t) eeoxfcoa1omt au s s0teto(opoy4opee fvsl(f 2rrx oot0oleoiocildlm elumo;(0aleomf ia1oa rluei;s)tetr(opnodalee netl() rrmxrpot1oltoio3ildla2ua(vo;t0arxnmo3iotopt livi;s t2toir3nudoleelfvi s)aruaxrpoo0texomfeilt m2elu s;() rtnmr tatom ean ols) rxm(mpoodlmt lncsls)aDrrxmo;u1tlxomfeiyt mDua(mpn(4texoxf iodlate ivs;t0srxoim oy4lpe mneiatfs2rr( pnu4opto o3tasfm2uau p u)arxomr oa1la elu o;()s2umimpiu4lm n fcsas)a2tmxm nu1tltn oeilslm2ul(vp t) rtnmf3tatlmtr ivsl()s2xr(r3oydomte iesa(fsDurxr no0optnifcildlm2rlu snt0 eeoio io1oatelueil()s2uo(o io1omenlfcsls) rrmurpno4texn fciltfsDum( o;u) etnmrciadfatelneo;s  exrim3oy4opt mietatf rra(ro;t1tpt moeiatfaDra(mon(4 rerio oadoa raneolt0s2xoxo3oydol emneia( aDta(  ;t0opxomi3iatlm ul(mon(4trenmf3tytom  ln s ( teuoirpoo1op  lneils)srrrxm no0tleniieiytlm2ulu o () etnxo3iotlat  u i (  rtrim3oy1ole  net t  Dur(r nu0altoiieils m emumon() etrxo3oatoaD luei (0 2xr(m3io1ol   ivsas)s2um( p;t1texo ocilt m raumo ()aleoir iatfm rlu ol(  eurxr oydlmt mnvsat a2tmu  oo4opxnioeiyslsDul(vs t0 etrmf iydop r uvo;t  2xmxm3iy4ol  lncias)a2tru ono4olxn iciadfa um(mo (0tetrif oydfm eluvs;t)srxoio oydlmen nci (f rtaurpoo0alenifcildlm ea(vo;t) lerxr oa1lpt  nesls) 2ur(opiudomenmfcsat aDra(mo;o0tltoio3iasfs2rm( s;()altoifctytla elu ols t2tm(mpoodlpeelnesls)aDtmx poo1tptoiicildfmDeluvs u4texrxf3ty1fm rlueo;() rur(r ny4alte nci s arumuro;u4oleoifetasfs ua(mpnu4trenmr3to1latrlnvols sexoiopiy1lm   fei (f rraxrpnu4alxniieilt m2um(msn(4teenio tatla eliei;s) exoio iydolt lneslt  Draxrpoo1alxn f3ils aDeanvo;u)aetoxfcoy1omt  nvols0sexm(o io4ole lncs (fsrrr(monu1oltomictysla emnmo u0trxrxo3oo1op e nvi ()trumxopoy4amt  ncilt  2tmurpnu1tlxn octltls2em( pn() lxoxrciytfaDrlu s;t0 etmxopoydal   iet t) Durxrono4oexo iciatlm rmumpn(4aleomf3tydfp rlnvs s)tetrim oodllt mfcs (f 2rmumpno1aetn o3tadls2rlnvp u0aexomrctodoa e uvi () rtm(r3ou4llt mneilt  2trurono0tleo i3tat sDuanmsn(0areomrcoatlmte iesl(0s2toiopoy4optn nctl() 2tmx o;t4tlxn oetysfa eau p u0artnxocoodlatrlnvil(  rurxr3nydlpte fvia()a2uaxrono1aptoifeiyslaDem(vs t4 exnxociatla eaieo s0sruo(r iu4lm n fctl(f Dumx  nu0aex moctydfm ua(vo u)tltoio totoatraivilt)t2urxo no1omte ncsltf Dtaumo;u4ale  fctld a rmnvo (0 exnio3iodlpD  n il( trxoxrpoo1lmenmnviatfa2rrx  ;t1alenifetldla em(mo ()artnir3ty1fmDeaueo ( sruoim3nodlpte fvtls artaum ;o4olx io3iyd a el(mo () lenxo3oatfptelnvils)tetmxr oy4al emnetl(f Dra(ro;o0oltoioetysfsDeau o;t4 ltnmo ia1fm rli ils  rtmxo iu1ll  mncia( srtmu pot0apx  fciadlm2rlump;(4arxoio tatlat an ils0 rtoxm3nodaltnlnesatfarum(rpnt4optniictatfmDrmnmsn(0 etrmo3oydopDeaueols  rxmio nu4apeemnetasfarum(rpnu0apeomfeias s2ul(vo u0altnirctotlmtr n s;s)s2xm(o3io4apenmnct ()aDtau  ;o4tlxo oetydla2eanmo;u0tltrmfciatfpt  uvslt0trxm(o3nydole mfetlt)a2trur nu1altoioctys s raumsnu0tetomociodfaDraneil( seuoio3iodom  mictasf 2umumont4texnmoctatfs2rauvp;(4arxrxrctodfmtelu o;()srum(rpny1lmtn nvilt)s2taum oo4olto feiat m2umu p u)trxrxr to1omtrlu slt0 ruoir3oudaltnmfvta()aDrruroot0aet  fciltls em(vo;u4 eenircoydlmt lues;s)tetmxr3no4llee nvtas a2rax  ;o1ole iieils m2ulu p;(0alxnio3ia1omte n slt)texoxr3iy4ale  nvs s sDurumpoo0tltnif3tadfm ean p;u4alxoxrctadlpt aivs;()s2xmim ny1optnliesls s2tmuroot4oexnmietasfs2elump;(4texomr tytlptraieo;s) eurim3oudlpeelfes s) rrrxrpoo0oexo i3iys a rauvs;(0trenif ta1la ean o t t2uoxr3iy1ap  lneiasfsDurumoou4tpxoif3iysfm2elnmpnu4 eenir ta1lp eluei;t0srtmxopou4apee fvi (fsrrmu  no4oltoii3tadfmDranmp u4aeermfctatfmD livi;( srtmxrpou1omenmici s) 2rrum oo4tlenmociadfs2rm( p u0 exrmr ia1lpD lues t  2xmxm iydaleemictltfa2rrx pno0oltnmfeilt s rlnmont) exoxfctytfatrauvslt0srxoxo no4ap emnci s)aDtauront4texn f3iytls umu s (4tetomf3iy1fm   n sl(0tetr(opnydllee nesas)a2rmu pou4aee  ictysfm2eauvs;t)areoxo tydoa r uvil(0teur(r iy4lm  lfvias)sDur(root1oltomi3tltfs uan s u0tlerxf3iy1lat an o;t srurxm3ny4oleemncias srraxrpno0aetomf3iat a2rmu on(0 ltrifctadfaD aivi s trumimpou4ole  netls  rur(m nu1aexnmocild aDrmnmsnt4artoxo tydfptraivsls) exoio3nu1llte icias)sDtrxr ;o4aetoioeiad s2elnvsnt0aexrio3oy1fmDraneols) etrxm3nu4lpenmivslt) 2rau pnt1tlxomictatfa ran snt4 lxrxr totopteaues;t trtoxr3nodal nlictltfa2umump;t0tptomfciasfs2rl(vp (0aetoirciotfmt  ivo t)t2xr(o oudamt lics ( s2rru  no4apto ietldfaDuanmo ()tetrxf3oadla r n o;s) 2xoxrpou1lmt  neia(farurum nt4apen ieildfmDumu pn()tlxrxr3ty1om   i ilt) rxo(mpoo1ol e iesa()arrmum nu4tpenmi3iatlm2el(vsnt) eenmo io1om   ies s)srxoimpoodlp nlivi tfsrrrumpnu4tpt mi3iadlsDem(msnt4teeriociodlpteli ilt  rxrxo3iydaleelfetat srtau  nu1aee micias s raumsnt)artoif io1faDrlieo t0seumir oydlm emnviat sDrrxrpnt0alt moetysfsDuanvsnt4teenio3iy1optelneol(0s2um(mpiy4ole  fvt t)sDrm(rono1opeoiocildlmDrm(mp t4 reomrcoytoptr uvsl()t2xmxmpou1lm n nvs t)artrx pno0tpe  fctadlm2um(msnt0arxomr io1faD  i s (  rxo(r iy4amee ivsls) 2ta(mo;t4aetomi3iad sDrlu pnu0areoxrcty1lmt luei;s trxoim iy4ope lneil(  Dumxroot4tpx iieilt a2elnvs;t)tltoxf3tydoaDr nvo s0s2umio3nu1lm emnct s)s2uaxrpoo1altoii3iytfmDeluvo u0trxoxf todlpD li il()tetoim oo4lpenmfctlt) 2taumont1tpxnmi3tlsfm2ranvo (4arxnxocty1faDr i ilt) exrxo3iodal  mivtl() 2umxmoot0olenmoeiltfmDeau p t) leoxocootfpt  nvo t) etoimpiudlleemfcsls)a2tr(r ot0tlto i3tysfa2emnmon(0trxnifctydlat  ivo ( srtoim3oudoptn ict s a2rmx oot0apx  ieilsfm2ua(vo (4aetrmf3ta1fa   ivs t0 2trxo3oy1olt lncta( a2rrurp;o0altniociysfaDrmnvsn(0tltrirciodlmDe u o t0s2tmim3iy1apeelnci s aDumxr nt1oex mo3tas s ranvsn()alenmo iy1omD lies t0 2xoxrpiy1optelfvsl(faDta(m ;u1apeoio3iydfs2rlump;u0arxrxocty1fmDeauvo t0srumim nodapenlnesls)a2uaxm ;u4aetomo3iys s2eluvpn(0aexomocoodlatelivo;( teum(o iy1lmtelfci t  2trurp;t1olxo oeiyd mDrlnvsnt0tetoif oy1lmt livs;t  rtr(m iu4lme  fvtlt  rrau  nu1apeo i3ilsfs2em(mp t4 ltoifcoy1laD  i sls0 rurimpiu1opt  fvi ()aDua(rp;t0apt mfetys a uauvp t0texnmf iy1fpt  n i t sruo(m iudop emfvilsf 2tmx pot4oetoioeiasfsDum( p;u4trtrmoctatlptraivs s)texm(rpoo4ol elnctls)artrx oou1apt mf3ias m elu s;u0 exriocia1laDeau ols0tetrimpoodopen ics tfsruru  ot4tlt ifctadlm2ran sn(4teenmoctatopD  ivsl(0srxoxm3ou1op elivsl( a2um(r ot1tlx if3ilt a ul(mp;() rermocoa1la r ieol() etoxm3no4amtemfvta()artrumont1opxnifciasfm rmuvp ()trtoxf oytfateaueo;(0srtrxo iu1openlncsasfs2tr(mpnt4tptnii3tydfs umnmo;(0altomf totlmtr u s t0 2tmim iy1lme miet tfa2umumono1apeo o3iyd s el(msnu)aleoxfcty1omt auvs;(0t2um(m3no1op emieilt) 2uaum ou0texo icildfa2rmu p;u0tlxnmrcoodfm e neslt t2xo(o3no4am  micsls arrrumont4tltomo3iltlm ua(mpn(0trerxf3oytfm  lieo;s)setmxmpoy1ape lfciat aDrr(mp;t0aexnioeiasfs2emnmp;u4arenircoatfp  lu o;(0trxm(r3oo1lmtelfctl(  Drrum oo0tex  f3ils m2rlnvs u) etrxfcio1oa  auvilt0 rtoio3iy4lptnmivt t s2urx pnt0tex mi3iad mDumn p t0artoif3iadopDe n o (0srxrxopnydapte ivt ( s2tru oou4apxn ictad m2rlu p u4trtnmf3oa1om eaueo;(0teumir iu4ap e nviasfaDur(mp;o1opeomociytfm2eanvs (4arxrmrcto1lp raivslt)s2tm(r nydop n fvs t aDrmu p;t4tetoif3iydfs2ranmonu) rerxf oytfa eai sl()srtr(o iy4om emnetl(f 2rm(mp;o4tpxnioetasfa2ua(msnt4 rxoxfcta1fmtr uvslt)trur(m iudop nmieiltfsrtm( ont4apenmiciysls em( snu4treomo oydoat  uvi s0 rxr(o3oo1om  mfes ()arurumono1aptn ociltlsDemnmo t) rxrxo3totfm e neils)s2xmxmpiodom nmietas)s2taxmp;o1olenio3iasla ra(vpnt)trxnir oo1lp  anei (0 2umirpiodome liviasfsDrmumpot4aet iieild s2rm(vs t4artoxf3ta1la e uesls)tetoxo3nodllt  fei ( sDrmurp;t0tee  f3iydfaDua(vs;(4arxnmo oy1lptrlneolt) eumimpiu4ape mncsls) 2ua( pno0texn f3iysfmDuanvsnt0 eeoxf3iodfa   uvo (0tetr(r iu4lmeemfeil(  Drax ont4opt  o3tatfmDumn o t4 eeoif tadfm   uvi (0seum(opny1alt lieilt srtrumonu0ale mo3tyd aDrmuvs;()tlxnmr3tytfpD lu o s)texo(opiodap  lncsat)a2rmumpnt4apxnii3iysfsDul( o;() leriocoy1faD  ies;s) 2trim3nodalenmneilsfaDra(  no1oetn ociasfa2rm(mpnt0tetoxfcoytlmDr n s;(0srum(o oodll   ietas s2rrxrpoo0oet  o3tlt a ua(mpnu) rxriocoadoa eaiei;s) etrxopno1opeemfes s aDur(r ;o4alen i3tls a2raump;t)trtnxr3iydoaDe neo;()srto(m3nudape liviat) rrm(  ;t1teen oeiltfaDem(vpnu0teeoifciadlmDrlivo;s0t2xoxrpiudol e feia(  2tmxmo;u4tltoio3ild s2emu o;(4 etrmo oo1fm e n s;t teum(mpiu4aptnmicsa() 2taxm ;t4tpx iieils mDum(vp ()trtrxr to1op e u ilt) etmir3nodalenlncilt)arur(root1aeenmi3iad m2emnvpnu)texoxf oo1lmD aiei s)trto(o iy4omenmnesa(fs2rm( o;u1tex mf3iyd aDum( o;() rxoif iytlptr u o;t0s2uoxm oo4oltnlivslsfs2rrumooo1teeoioctlt m rm( o;t4tetnxoctydlmtraueo;s  2ur(m3io1lmt mnet ( a2trxr nt0tetn fctld s2ua( p;u4trermf oadfateluvi t) 2trir io1ameelnesas)s2ua(mooo4alenii3iyt aDraumo;t) lxniocoo1oaDeanes s  exmxmpnu1llen neilt s2urumpnu0alxn ieiadfm umumpnt0 ltoxf3iodlm eaueols0 exoxopou4omtnmfci ( aDraxmono1ole mo3iydls ulu p t0 ltrio3io1faDelivsl(0t2umim oy1lme lnvias  ruaxmoou0apenmo3tldls rl(vs;u4aexnircoatoptr i ilt s2ur(m iydamte ics s  2rmurpot1oetn fcias s2ul(vs;t0 reoio3ia1lpt  u o s) eum(opnudlmen iesls  Dua(rpou1altnmoeiyt s rlu o u) exrmr todfpDrlueilt) rtm(r oy1amt lieiatf 2tm( o;t4opxn ociatfaDemumo;() ltnxf3iatopDr ivolt texm(rpoy4ope mnvsatfsDraxr no1tptn f3ils s2ra(vp;u0altoxr3oodoptranvsl(0 exrio no4open ivtas) ruau  oo1oleoifeiltls ea( p u)aleoiocty1lp r i o t trxoiopno4apt  ncsl(farrm(mooo0tlenmi3tydlm2emump u) rtoxrciodlp rlivs;(0t2toio iu1op   fcsl(f Drmx p;u0aptnmieiasfs2rl( sn(4 eeoir oo1faDrli sls0 eumio io4apeelici (f 2tmu onu1alenif3tad sDel( onu4aeermf3iodop elu i t  exmiopnu1ap emfes t  rtaum ou1alt  ieildfaDum(mo;(4 exoxo3oo1opteliei s) 2ur(m3ny1ll elfvsasfs2ta(r no0tetomieiad s umnmo;(4aetomf tydfm ran ols)seumim3nudap   ivtat)aDrm( p;t1tlt  oeiatlmDrm( snt0alxrio tatoa eaieo;t)tetrxr iy1oleelnctlsfaDuaum ;o1oetnifeiyd a2el(msn(0alerxocoo1om rlu i;s)t2xrio nydomtnlieslt aDumu o;o4oee io3tysfs2rl(mp;u)teenmo3todomt  n i;s)tetmxm3iu1al n iciasf Drm( onu4teeo fciatfs2rln s t0arerir tytlptelnei t0 etoim oodame  fciasf Dumu o;u4alto oeiyslm um(vp;t4alxnxfciodomtelnvilt0 2uoxopiu4ale  fvi s)aDtmxr ;o1tpenmocild a eau o;t)aeeoio3tatlpt ln s (0 2trxr ny1omtelicsat s2uau pnt1texo ieildla2uaums;u0 exomr ty1oa rauei s srxriopoydlpte fes (fs2taxmpou0alt  f3ilsfmDem(mpnt)alxrir3todfa rau slt0 exoim3oodlltelnesat) rrax pot4opxomfctlsfmDrmumsn(0 eerxf oodlaD lueo;() etm(r3ou1aleemicias aDra(r ot1apx io3iasla2uauvp u)aeerirctotomDr uvi () 2triopiu4lle miet ()artmxr nu4tltnmociytlm2emnms;t0teeoio3iatopte ivs;s) rxrxmpiudalt lfcilt s2tmumooo1opt  oeild sDulnmp t4 eeoif3oydoat ln ols srtoxo nudlltnmfvt tf rrr(rp;t4tleoiicias s2ul(vpnt4 leoxfcto1oatelnvsl( sexrxopoydape  netat)a2rmxrpnu0tpt mf3iatfs ua( s;(4 exoxo3oadoaD auvi;t  rum(r3ou4oltnmncil()a2umur ou4aee  i3tldlsDem(vpnt) eenio3iotomtrlivs;t srto(o3oy4optnmieiltfarumu p;u0tptnio3iytfs2uanmo u) etoxociytlptrlnvi;s  euriopny1alt lfcsa( a2raur ou1ale ifciltlm2rl(vo (0artnmrcootoaDr nei () rurio oy4olt  ieta(faruau  ;o0aexoiieild aDulnvo u4 lxoxrcoo1omDrlueol( srxrio iodal nmictls) 2rr(mooo4oee  feildlmDeanmo;(4teenmr oytopDeaivs t)trum(rpny1aptn nviasfa2taxmp;t0texo o3tydfa uluvonu)trxnif3tytlmteliei;t  euriopou4lpe licsas sDuaxr nu4olxoiieiatfs ra( s (0teenif3ootfat aivils srxm(o3ny1aleelnvsl( sDumumonu0olt mfciysfa2elnms;u)trenircoytfatrlu ilt  2xo(mpno4ol  lfvta(fsDrmxmo;t0tpt mieiydla ua(vp u4tlxnxf3ia1oaD  u i t) exrxr oy1alt  fvil(fsrtm(mpot0oet  ietldla2ea(mo;t)alenifcio1lm rlueo;( t2tr(o nu1aleelicsasf rurxrpou0tlxoifetadlm2ulu pn() rtomf oo1laDeanvslt0teumxopiodame  fci s)a2tru ono4optnioetltfs emnvs;t4tlxoir3iadfptelivi s)texoio3oy4lptelicsas)srtruro;u1openmfetydfa ul( onu4arxomrctodoatrau o t tetoxo oo1llte fesas)s2uaumpnt4texnmieiys sDuanvpnu4 rtnxf tydlmt livsls0srtmim3oo1omtemnetatf Dtmxrp;t0apenmfeiadfmDemn pn(0 lenir3iotfat anvils)srtm(r nudalenlfvtasfartm(  ou4alt  ieiysla um( o (0 lxrmr3tatlmDrai sl(0 2uoxo oodomtn nvta() Drrx  nu0tpto ieiytls rl(vonu)artrmr ootomtranvo;( s2ur(rpio4oltelnesas  2tax  ;u0apx mo3iyd a2emnmo;t4 lenmociadoat anvs s0 rxrxr3iu1lpeemnesa( a2tr(m nt0tlt mfeiys a2rlu sn(0texoioctatopt aues;t sexoxr nudol   fesls a2ra(  ;u0aptoifeiyd sDumnvs;t0 leoxr ty1lat lnvs;() rurxmpiydlmt  net sf 2um( oou4opto oeiasfmDel(ms;u) rtrmr3tatfp rlneils sexoimpnydaltn ici t)sDtax  nu4oeto ietadfm ra(vpnt)arermo3io1oa r u ils0tetrirpio4ameelfcias)a2rmu o;t1tpe  i3iltls uaumsnt0 exrxf3oy1fmD livs s sexoxo oo4lpt mfct ()sDrru  nu4tpe  fctatlsDemn s t)tlxomo3iotlm e nvsls trxrir oy1ol  lies sfs2tm(mooo4tet mi3ias aDrm(vpn()texnif tydfpDranvol( trtriopiu1olt lneiat) rtr(rp;t1tpenmoetytlmDumnvo;(4tlxrxf ty1lmDraueslt) ruo(m3iy4llte fcsa( artr(mo;o0teeoii3iydlsDemnms;(0trxoxrctytfaDeli ilt s2tmxo ou1alt lfvil(  Dta(moot0tpe moetldls2ean pnu) rtrxfctatfa elivs;s0texm(opnydap nmfvilt)arumxrpot0alenmi3iasfm ea(mo;u4tlenxo oydfp elu s;t  2umxmpiy1olt livia(  Dumxrpoo4alenmfctysfaDea(vs t4 ltoifciytfaD lu il( setr(r3oo1ap  lnct t  2tr( o;u1oeeomieiatfa2ua(mo;(0artrxo3iodopt  n s t)s2toxo3oo1lm  mnetasf rrrxm oo0texnmfciltfa2ul( s;u4 ltrir ta1la  au s ()trxoxmpny4lpee ics t) Drax  ;u4opxnif3tydfs2umuvo u0trxnxf ta1fmDeaneil(0s2xm(opiy4lp  micsat s2uaxm nt4tptnmo3iytfs2umumo t0 etnmocoadoat luvils0srxo(o3no4ol e fcs ( artm(rpnt4aexomieiyt s rmnms;u4 lxrif iadlp r neo;s0teum(mpou4omee fes s)aDta(m ou1openii3iatfsDraums;u4arenmo tadlat liei s0trxrim3iodlpee fcils a2ur( pot0tlt ifciytls2rmnmo;t0alxoxo3oy1lmD ln s s0t2uoiopny4optemivtas) 2umxm ou0oltoifeild s2ul( p;()tlxnif tadlm r ivsl( sexmio3iy1lm  lieta()srrr( ooo0olxnioetys sDua(vs (4teeoxf tatfp   uvo t sruo(opnu1amen fvtlt)sDur(  ou0oeeomo3iydfa eau p t0 etoxo3ta1lpD livol(0srxo(mpiu4amtn fesl()aDra(rono1aptomi3tlt s uanvp t)artnmrcoatoaDrauvs s seur(m oydom  licia(fa2tr(rpno1olxoioctldfsDea(vs u0 lermrcio1fatrlu o;t0texrxrpoydomeemnvta(  rtmxm no1texn oetatlmDemnvsnt) rerirctodfpDrlueilt0 exoxrpiy4ol nlnvtlt) rumuront4tle  o3tas m2emuvsnu)arxomo oytopDrli i;() eum(r ou4ol nmfvil()s2tax onu4teeo ocilsls2uluvs;(0aetnxf3todomDe uvi t0seto(r3nu4lm   ici (farrmu onu1alxn fctas mDrl(ms u4 lxoiociytom e i sl( setmxm3io4ap emfvtl( s2ra(  no0oexnmo3ias aDea(monu0 rtoio to1op  au i;s0 2tmio nydol elictl()sDrrxmo;u1tpt mfeiltfa uanvp ()altoir3iadlm   ivolt) rtmxm oodomee nvsls)aDuaxm nt4tle  icildfsDulu on()aetnir oodomD au s ( t2tr(r io1op n fcsat)a2tru p;u1tptn feiyt mDel(mp u)trtoio tydfp e i s t0s2xmxrpoy1lmtnmneiat)srurxroou0alxoio3iatfsDemn o;t4tlxrioctatlpDeln i;t  eurim3iy4ale  nvsa( a2tr( o;t1oex mf3tyd a2uan p;u0 etrxf oodomtelnvil(0t2uo(r3ou1lpenlfetas  Drau  ;u0aexn fetltls eaumpn(0aexoxfcto1oaD anei t  ruoxopoudlm nmnvias  2rrum ou4olxnmieiat m2umnmonu4 rtnir oy1om r uei () rtrimpnu1lmtnmies t)artmu  oo1apxn feias s uln onu0aetrir ta1la elies (0t2tm(o iy4am nlictas) 2rmxrpot1olenifeiatfa rl(vp;t)aeenircoatfptr n slt)srxm(rpoudolenlfvsl( aDta(  ot1aleoiieildla rmuvs;(4 lxrifcoatfp r ivolt0 rxo(r oodoleelnet s  rtaxmooo0tee  f3iaslmDulumon() renmfcoy1fpDraiei;t0s2xr(m nydlm  livs s srrr( onu4aeeomf3iydlaDel(vo;u) eeomfciotfatelu sl()texo(m3io1alenlnviat s2ua(m nu1oet io3iad aDranvs;t4 rtrxrciodfp r i o;t) exrxr3nu1ole  nvslsf Duaxr ou4tleomoetad a rmnvp;u4trxnxr3iydfmDrlivsls t2trxopiydoptnlivsl(faDra(  ot1opeoiictasfs rm( p (0arerxr3oo1opDeanvs ( seumxrpiydalt lfesltfsDrm(rpno1tpenif3tatlsDeluvp;u0aexrir ta1fpDeli olt)s2toiopnu4amtnlivil()a2taxrpno1tle io3iydfs umu on()tltnmfctodlpt lnes ( trtrio3nodamee nesls aDtmxm oo1oleo fctldla2emuvp t) eenirctotfp eanvo s  2trir oydlm n iet t sDuaump;t1alxnifctatla elnmon(0 rxoxf iytfaDrluvsls)srumxo oo4op nmivs sfsrtaxmp;t4teeomoetaslaDeau s u) eenmociotoaD  ieslt0trxmirpou1om   nvtas)s2rmxmont0oeto i3ilsfmDra( o t0trxrxo oy1lpDrluvs;s  2xo(m iu1lltn ies ()a2raum oo4tex iociydfsDeauvo t0alenxr3oodfaDran i t0 rxoim3no1lmtemnviat  Dumumoou1altomo3tysfm umu p;t4altoxr3oydfmt aivol(0s2umir3nudlm  lfes t)a2taumpno0tlx  ietldfs2elnms u)tetomr3oo1oaD  uvi t0setm(o3oo4lmen nvsl(fs2rax onu1tpxnifeiltlmDrmnvpnt0 ltomf iydlatrlu s;( trur(rpoudape mies ( s2rmuronu0aee ifetad s2rlnvp;t0alenxo3iytop   uei;s)t2xrxr3oodom elnei s  Dtr(m ou4opt io3iasls2umu on()aexnircoytlp rlu o;s) 2urimpou1lmtnlicsls) rtr(ro;u1alenmi3ildlmDuauvo;(0alxnio totoa elnvo t)srxm(m oy1lptn feilsf 2rr(ro;o1oeen ietldlm2uan o;t)alermr3tatfptrluei (0s2tm(r3nodal elivsls)a2rr(rpou0tltnmi3iad a2rlnmo;u4 rxnmr3oodomD ai i;()s2xoxrpiydop  lieilt) rrau pnu4oleoio3iltls el( p;u4alermr3oatlmtrlnvi;s0 rxmimpoy1apte fes ( a2uaumpot4alxoiieiad a2rlnvont)texrmr oodfp r i ols0trto(o iy4am nlfet (f 2ra(ro;t4tlxnioetltfaDrm(mo (0trenxo3oytom  anvi;s0sexrxr3nudol emivt t)sDta(m nu1alx ifeias s uau o;()areoxocoo1fmDelu i;s0t2xmxo3no4amtelfcia()arrmx p;o0tee mociadls2um(vo t0arxoiociotoatraueil()trxoxopiy4aleeliei () Dum(rpou4alxo feiadfa2uan p u0treoif oodfmDe i o;s)tetrimpou1omtn ivsas)s2rrxr nt1oleo oeiytlmDumumo t4 lerxrciatlmDr u s;( teumim iy4alen feta()arra(  ou4teenmictyt s2eauvs;u0 etrio iy1la elnvils) exoirpiy1al emnetlt artmx pno0aeto f3ias a eln on()aetnio3iy1omt  i sl(0t2xr(r3ny1ameemnciltfsrtr(mpot1alxnii3iat a ranmsn()arxomo ta1la rluvslt0 exo(r iudaltn fesas)aruaxmpoo1ope if3iyt mDum( o;t0altrmf ootom eli il(  eurxo3nu4ap  lfvi sfsrrr(  ot1alxomfcilt s rluvo u)areoxr3oydopt anvols)seum(o3oo1aptelfetatfa2ua(mpnt1tltn iciad m2rlu s ()artnxfciydfm elneslt  eto(o oy1am  mfesas) rtmu onu4oleo fciat a rl( p t)arxnmf3oy1laDr iei;t) rxmxrpou4lp n ici ()aDumxro;u0oetnii3tas m uan p t)trtnmo3tadfpDraivi t  2ur(r3oudom n ncsl(  rrrxm ;t1apt if3iad sDrl(ms u4texomfctytopt ai o s)s2uoio nodll  micsa( s2trur nu4aet if3iyt s uln p;u0tlxnxr totfp r i s t  exoiopio1open fviltf Duaxmp;o0tleoio3ils aDrm(vpnu) reomr3iatfm ean i;t t2um(r oy1llt  nes s aruaumo;o0alen o3iysfs uanmp;u0teenif ty1fpD  uvi t)trum(rpiudaleemivs sf Drrumooo4olxnmiciltlaDrl(mo (4texnmr oatop r nvo;(0trtoiopnu1am emnci s  Drmxr oo4tpxomo3iatfm2uaumonu0texnio totfmteluvi;t0texoxo oydoptelnet s  rra( pnu1apeo i3tasfaDrmnvpnt)tlermr oatopDe ivo;t0 2umir3io1lle  fvil( s2ta( ono0apt mocild sDean on()trerxr3ia1lmtr nvo t0 2umio iydomen fcsas)aDururpnu0tet  i3ildlmDelnvon(0artnxrctytfmtran s;(0sexr(opoo4omte nei s aDraumoou1tpenifctyt m2um( o u)tetnmfcoadfpDranvo;s0teto(o3no4ap eliesasf 2umx oot1tltoiictatfa elnvp;() eeoxr3ia1fpte u s;( s2xr(rpnydlmtn fes tfarrm(ronu1tetnii3tyt s rmuvp t0 leoircoytlp r nesl()seum(o3oo1lmee fct s  2uau p;t0ape  f3iltla2uaums;u0 rerir3todlp rlies;s) 2um(o3no1lptemnesl()aDrm(r ;t1aleomoetld m uanvsnt4trtomrcoo1oatrau i s0tetm(mpoydole  ietls srua( ont4aetn fciyt s2rm(vp (4tlxoxo io1lmtelivo () eumxo iudlp   fvta() rraxrp;t1oee iocilt a ran sn(4tltnmr3todlpDeanei s0texmxrpnydap  mnct (  Dtmu pnu0olx miciyt s el(mp;t0tetrxfcoy1oateln i;s0 2xo(r nodol   iciasfaDtmur nu0oee mf3tas aDrm(vp;u4alxrio iotlmDr nvilt0setm(opoo4op nlict s  Dumumoou0tltnifciltls2ea(mo ()artnio tatoptr neo t0s2xmim iy1optnlivsatfsDuaxm ou1tle mf3tltls2ul(vpn(0aexnxo tydoa   u ols0teurim io4lm n fei t)aDta(  nu0ape miciasla2ul(vs;(0aleoxr3oy1fpDeluei;s seuo(r3oy4ap  lnvsltf Dumxmpnt4aet mfeiatla2uan s;(4 rtoxo oydoa r uvi ( texoim3nodopenmietl(  Draur ;t0aet  iciatfa2el(mo;() etnmfciy1op r uvslt0 2urxo3ny1lm nlfeils  Dtau  nu1oeeomi3iydfm el(vp u) leomfcoodlmDeaueo s)trtmir ou4lle  ici s) Dtm(  ot1tet  fetydfm ra(mp ()arxrxr3todomtraueils)tetoxr iu4lmtnmfvi () rtmxr oo4oex ioetldla uln p t0trtoir oo1faDrln ils)t2um(opiu1oleemnctlt)sDtaur ot4opx  ieiltfmDulu snu)arerio3iatopD  nesl(0 ruo(o io4ame  feias) rraxmpou4tpe ifeias m uln p u4tlxnmr iy1la raies t0setrir3nodap elnvslt)s2uax o;o4oexo ociadfa uauvs (0 etrxo io1optrlnes;t  rurxr3ou4oleemivias aDtax p;t0texnif3iyt mDum(ms t4altnmf3iy1oa e n s;()texrxmpnu4al  mivs sfs2rmumoou1ope mfciadls emnvsnu4aetoirciotop e uei (0srxmir nu4opee ncils s2tmur ;u0tltn fctydfm2rmnmo ()tetnmo3ty1om e uvi t t2tr(m nudamte fvi (  Dtauro;u1oexnifeilslaDelu p;u4alxnmr oa1la eluvo;s0trxm(r3nodoptn fctatfs2um(r ;u0alxn iciydlsDrl(mp;u4texoxfcto1fm rli ols  2xr(mpio1al elnvtas srur(rp;u1altnmfeiysfsDranmp (0tlerxr oytop e uei (0s2tr(rpiu1omee nctlt)sDtaur no4ope  ieias s el(vo u4 lerifcoa1fa  aueol(0 2xr(m nodalt mfcsl(fa2raur ou4tetnifciadfa2ranvont)aexoifcoadlaDrli i s0setrio3ou1apen iet () Dtrurpnu4tlxoii3iatfm ra( ont)texomr3oatoa raies () rxrxo3iudlpte ncs () 2um(r oo1apxnifciasfm rm(mp ()tlerxociydlm elnvo;t)teur(r nydlmeemivs tfarrrxmpnt0olt ii3iaslsDrmn sn(0 lenif3oydopD  ueslt0 exrxr iy4ap nmieiatfaDuru ono1tet if3iys aDelu o;(0 rxoif oa1omDr nvsls0s2xo(opnu4am emicsl() 2tr(rpot0aex io3iadlm2em(vs (4aeeriociotom e nvols)seurimpoo4op e fvtlt)artr(  ;o0texoif3ildfa2em(mon(4 rxnxf ootop rauvo s s2uo(o3ou1lpte fvslt) Drru o;t4olxnmfciatfm ea( p;t0tltriocoytfmte iesls  2xrxm ou1ole  fei (  2um( o;t1alxoif3iatlm elums;(0texnxo3tadoat  i slt)t2xr(o nu1al   ietltfs2tax  ;o1alx mi3tysfsDrauvsn(0arxrif tydoat luvil(0truoxrpnu1ol   fvia()arurur nt0aet  f3tytls rau p;(4 exoir to1lpD lnvilt) rxmxm3ny4optelnci s) Dtrx  ou0ole mietaslm2um( p;u)tlerxfcta1lpDeaiei;(  2xoiopny1apte icia(fsrtrxro;o1alx if3tad a2umnmpn(4 eenxr3iytlptrai s t srumir io4am  mfvsat artrxronu1apt  ictasfsDeaums ()teerifcta1latran o;(0sexoiopiodlptnmicsat) 2raxmont4aexomf3ildlm2umu on(0alenio3ty1fpD lueo s0 2xoim3oodomtemnvi t) Dum(m ;o0oeen o3iydfm2ua( pnt) ltnio3oydfaDrau s t  rtm(m3iu1ll emfvsltfsrrr(rpno4tpe iieiyd a2em( s;()texrmo3iy1lm r u i s)trtmiopiu1llen nvsa()sDraxrp;o4oltn ieild a2raumo;(0alenxo3iodfatr ivols trxrirpou1oltnliviasf rta(rpno4apeoif3tydla emumpn(4aetnxo3todfpD aies;()seuo(o no4al e fvt (f 2trxm nt1tlx  iciytfs2umn p u)aetnif tatfp ranvs ()sexo(m3nu1alenlncsa( a2tmxm ou1apxnmfcilt sDulu o u)arxrirctodfate uei;s)seurir iodlme lfct sfsDra(m nt4tlx ii3iltfa rmnvpnu)teeoiocia1lp elivi s  rtoim oy1lmt mncslt  2uaxr ot4tlxnio3iyt s2umumont4texnif3oa1oaD aueo ( texoxm oydop  mfvsa()srrrurp;t0tlxniiciydls uaumo u)arxoxr3ty1oa elu ol( srxoio3oo4opt lfciat)sruaxroot0oleo o3iysfmDelnvo;() etrio oo1fpDrlueo;(0 2to(r ny4ol  lici tfsrrm(rono1aptn ictydlsDemnmon() rtrmfctatlmDrli ol( s2uoim3nu1lmen fvs s) Dra(ro;u0tleniictlslaDrm(mo ()teeoiociadlmtraies () exr(o3nodop   iesat)srraxmo;o4texnmfciydls rauvo t0artnircootoatrlnei;s s2tmxm ny4ap nmfvi tfaDum( poo1tlt io3ilt sDua( o t4aexnir3iytfmDeaueo s  etrimpnydol elnct t srumur nu1aptnmiciasfs ra(vsnu) ltoiociadom eai s;s)texmxm3ny1lmtn fvslt) 2rmx ont4alt mfctydfm um(vo;u4 renioctodlmtr iei;t0 eto(rpou4alt  nvi ( srrrumoot4opeomoeildfm raumsnu)artriocootfmt livs;t texoxrpio1lmeelfvtls  2trxrooo1tet mfeiysfm eauvpnt4 rtrmf3io1fatr uvs (0 2uoxm ny1apt  netl()sDumxronu0oee  fctytlm ea(mo;u0 rxrif tatlmD  nei t) rtoir iodoptn ivi s)aDtrxrpou1aptniieilsfs2emnvont0 etrxo3todlate ieo t0teurxm no4alt  netl( sDrm(r ;o1aetnif3ilslm2uan p ()tlenxrciydlm e nvsls) rxm(o3io4amenlncsa()a2trumpoo0teto oetltls2rmums;t)tlerxo ootoaDeaivs t0setr(rpnu4apte ieias aruaur no4oetn ictat m emnmpn() eerifcto1lm eli i t  rumimpou1ap  mfeilt) ruaxrpnu0tlt  o3iydla em(vp t4trerir oydop  lneilt0t2trxr iudolen nvsls) 2ta(m no1tlx  i3ilsfsDum(mo t) leoxf3to1oatelu s;s0 ruoxrpnu1lpen fvtas  Drmx onu4apxn f3tldfm emums;t4alenmr ia1omtraueo (0srxrxopou4amtelfct s srrm(m nt0tpxoif3iltlaDuanvp;u4alxrxoctadfmtrlnvsl(0 2uo(m no4al emivtas)aDur(mpoo1oltnmfetas m2ua( pn()artoio3iadfp  ln o t) 2xo(m iydlmt lfctltfaDua(root4oltnmfeildlaDul(vo u4aetrmf3oytfp   nvi;t)trurxo3nudom n fvsas s2tr(  ot0oltomicias m rl(mont0trenmfcia1fp raieilt0 rxmxopiu4ale livi (fsrua(r ;t4alt ifeildfs2el(vo u4 etomo3tadfp  luvo;s) rxmiopoodlptnlnet t  rrmx ono4olxnmictysfmDemn snt4 etoxociatla elnes ( texmio nudom elfciltfsrrauro;t1aeeomiciasfsDul( s;t)tltrxf3iadlpD li i;t) ruoxr ny4ap elncsat  2ta(ront0aleoio3tatfm em( p;()arxriociotla  lueo;( trto(m3io1opt mncsltfa2taxro;o1open ocias a eanvs (4aexrir3iydlaDranvo;t0sexrxm iodam nmfvias  rtaump;o1apx  fciat a2em( p t)texoxrciodla  anvo t)t2toio3io1llte nei s)sDtrx ono0oee iieilsfaDra(mpnt4artnxocoadlp rauvo t) etoim ou4altnlnvsltfsrtmxrpou4tltnioctadlm2emumsn(0trxoifcoydlptrlneslt0 rxoir3no1ll   icsasfsrraur ;t0aleo oetadfa uauvs;u)texrxf iodlmtraivslt  rur(o iudope  fvils)aDtrur nt4opx  fctls mDum( s u)texoir3tytfpteaivo ( trur(r3ny4omt mncs t) Dtmumont1opxnifciydfsDumn o;t4trxoxr3iydlm eau sl() 2tmio nydll nlnvsls  Dumx pno1olxomfeilsfa ea(vs t4 ltrmr ootlaD  ueolt)s2trxm iodol e ietl( srrmxmo;o4oetnif3iat mDum( o t4trtoir ootlmDeluei;s s2xo(r io4lptnmfes t) 2rmumo;o4tpto o3tlslmDeauvpn()arermo3ootoptelu o;( sexoxr3nu4lpe liesltfa2ururp;t1tpe ifeiysfa um(ms t0 eeomo3ty1omtrliei t)sexoxmpiu4lltn nvs t arraxmp;u0tlt io3tldlm ea(vo;u4aetnxrctydfpt ai slt  2xmim3oy1lmt  feta()sDrrxmp;t1tleoifctldlmDea(mpnu0 leoir3ia1lpD lu ol( seuoir iydaptn fct s)srraurpot4olxniociltfs2uanvpnt)aeerxr3tydfaDeluvo;(0 rxoxr3oodom emfcil(fsDtruro;t4tlt ii3iyd m eaums ()teeoio3oydoaDeaiei s s2urirpno1ape mfvt t) rur(  ;o4tpxomo3iadla rlnmsnu4aetnmr iytoa  ln ils t2xrim3nydoptelfei tfs2ta(  ;o4aetoiictat sDemuvp (4 rxoxf3totlptraiesl() eur(rpiy4lle lfci t)artaxmpno0tle  iciadlmDel(mo;(4alxrxfcoodlpt liei t  2xo(o ny1lm   netlt srtmu  oo1apeomf3taslaDrln o;t4tlxrmocto1laD auvs s  2xr(mpnydaptnmfeta(farum( ono0tlxnmoeiys s2uanmo;u4trtnxfcoodlm  an sls)trxmxr3oodlmtemivsatfsrtaxrpot0olen fciydlmDelu pn()tltnmrciodfaDrlnvs t0tetmxm3nodlp elicil(f 2umu pnt1tltnmo3ildla2rmu s () reoifcoy1lp  lieols sruoxr iu4omen ies s  rtau pot0aptomoetas aDumnmo t0 rxnircto1latrli i;t0teum(o3oo4lle  iesa(fa2um(  nt1olxn ieilsfsDuln o t4trxomf3oodla  luvsls  rxoim3oudllen nvsa(fs2rmump;o0tpeo f3iadlm ulu p u4 etriocoadoatr n o (0trxm(r3ou1lle mies s)srumxroou1opeomociltfsDraumpn(0 leoxociy1omDraivo t0s2trio iy4lm nlieil(fsDtr( pot1opto ietyslaDra(vs u)alxoir oydlpDeaies s  etmxr3ou4lp   neiasfaDrauront0oetn i3iad a2uanmsnu4 eeniocty1fmt lu ils  ruoio ou1am  lnetl(faDtmxmp;u1tpeoifciysla ran pn()teerio3to1la  anvs s) 2umxrpny1lmt miesls)a2tmu ooo0oexniicildlaDulnmp;t0aeerxfctytfat au s;s0 2to(mpoo4lmeelnvilsf Drm( p;u4tle ioctydfa ran onu)trerxr3oodfaDe n sls) rumxm3oodlp elfcilt)sDtmxrpnu1tpt iicias a2ulnms;(4 etrmr tydomDeauei (0srto(r oudlme lieilt) ruaur ;u4teeomiciytlmDra( o ()arenmr oadfa e ivols0s2xm(r ou1alt lfvtat sDta(r ;u0opto i3iyslmDuau on(0trtnxf ty1lpD lu il( sexoir3oo1aleemfetas)a2tm(m ou1tex  i3iadla eluvp;t) leomr oa1om eauvsls) 2toim3iy1lle mivsasfa2rr(m nu4aee moctlslsDrl( s;t0texrxf3ty1faD auvi;( t2trxopiy4op  lncslsfa2rruro;o0apeo f3ilsla rmnvp;(4artnxoctodlmtranvo ()trtoxm oy4op nlicsa() rrru oot1oetoifciad a2rmums t) eeomfcia1faDeaivol( trxoxmpou1lltemics ( sDraxr ;o1optniiciatlm um( s u0aeeoxr3oy1fpD anvils0srxoimpnu4apee ics t  Drmur nt0aleo oeiltfs uanvp (0artrifciytlp r i o t)s2umio3ny4aptemfvslsfs2ra(ro;u1alx  o3iltfm2raump;u4texrir3tytfm elueolt) 2tr(opnu4ol  lnvtltfartmx  ;t1tlenii3tld m2umnvo u)trermo3iatoaDranei;s s2xoim nu1opte ictls)s2um(rono1apt  o3iytfsDumnvont)alxnifciytop ran i t) 2urio3oo1am   neils artr(rpnu1opeo i3tad sDem( p;u)trxnir3iydoaDranvo;t  euo(m ny4altemiei s) 2tr( o;o0oltn fcias sDeln sn(4 lxnmo tytlmDe nes;( sexm(mpiydomeemiviat)srtaxr nu0oltomoeiltfsDrl(msnt)alxomr3oatoatr n il(0seuo(r3no4openmncsat)sDtmu  no0alt mo3ils mDem(vs;u0tlxoif oytlptr u ol()tetr(mpio1op  mietltfarum(m ;o1altnmietyd m2ua(vonu0 eeoifciytlmt aieo;t)t2xrxr3oo1om e fciasfarrmuroot4olx ii3iasfmDrmu o t)arerxr3tatlmDe nes;t0truo(opio4apen ictls) 2rrxr ou4tpt mfetat aDra( p (0 lenxrctatlpt  nes;s0srumxrpnudoptnmnetatfaruax  ou1alto ictyd s2ul(vo t4aetrif3tytop ranvo;s0t2tmxm3iy1lltn feiatfsrrru  oo0olen feiyd m uln pnt4teenxf tadlaDranvi;(0seumimpoo1om elnvsa(f 2trxmpno1tex iociyt aDra(vp;u0 reoxr oo1oa eln il( texoimpou1lm emnciasfaDtaurono0aeeomocils aDelnvp;(4aeeoxo3ootom e ues s)srtmxr3io4lpeemfvt ()aDraxroot0tpt mfctadfa eluvo;u0teenifciotfmDr i sls srtoxr nydoptnmfcsa() rrmumont1tleo fetlt a ul(vsnu) eerxocoadopt li sl()texm(rpoy1ope mnvilt)srrruroou4teeo f3iatlaDemnms;u) lerioctytfmt luvi;s) rtr(mpio1lpen ict sfa2rrxroot1oeeoif3tydfsDra( pnu0trxoif oy1oa e ivo;s  eurxo3oo4lp e iet ( aDuaurpot1aee  ieiyd m2ean p;()arxoircto1fm  luvo s)trxoxrpnodolenmnvsa(fsrurumpno1opt  ieiydlmDemuvonu)arxrxrctatopDrai olt trtr(mpny1ale  nei s artrx o;t0aee ii3tlsfs2ra( o u4altrmo3iotlp   u o;t0 rxmio3nu1ape  fvt s)srrrurpou4texoif3tls s emuvo (4tlxomrcoytfp e u o t seum(rpny1al  lieias)srtmx pou0ole miciatfs ea( snt0 etrir oytlpDe nvilt0teur(r3oodom n ivs ()arraxroou0aee mocild a2rlnvon() rerxr iodoatean sls  rtmxmpnydll nmfvi (  2tmx  ot4olt iicias a2eanmp t0altrmo iadlp rau s;t s2trxopoodole mivi ( aDraumonu0oetoioetat sDumnvo;u)aeenxrcto1omD auesl()seto(m3iodamt  fvi ()srtaxrpnt0aexnif3ils a ulump u4 rerif iydlat au sl() euoiopoy1apenlicil(  rtrx ono4tetnmfctlt s2elumo;t4arxoxr3iydfateaueils sexm(mpnu1apt  fvtl()a2rru poo4tptnio3tydfaDeluvp t4altnmo todlaDeli o t) rumio oudameemivi sfs2ur(r nu0oexn i3tldfa2em(mp u0texoxo iodopDeli o s sruoxo3ou4olen ncilt srtaurpnt0tex iociysfm umn s u4arermf iytlm r u slt setoio ny1ll n iesasfaDur(r ou1tee  ociydfm uln p ()tlerxo3ootop  aueo;( seuoir oodop n fci sf rurxr ;u4oet moctlsfa2eln s u4teenmf3ta1fa r uvi;( t2tmim3no4opee ivtlsf rtmu pno0teeomf3iadlsDeaump;(0aleoir3iytlpD ai s;()sexoxmpiudame  ies () rraxmpot4oeen oetad sDeauvpn()aetnmocoydfp rli slt0trxoxm3oydlp n fesa()sDururpoo4oeen oetlsfa2el(mpnu0 lerxrctydlaDraneilt0 eumim iudolenmfvia() Dtmum oo0aetomieiadfmDeln p t0trenmo3tytoaD  nvo t tetoxm oy4altn iesas a2ur(ronu0opxn oeiasfm ua(mpn(0alerir iatomtran s;s  rurxr3iodol nmfetls  Drrx ont1tle  fcildla em(vp;t4 lxnif io1la eluvi (0t2um(o ny4aptnmict s a2rm( oou4ope mictydlm eln p;() etomr3tydfpDeaiei () 2umim oo4omenmfciat  Duru p;t0opx  f3iytfa eauvsn(0 lxnmf3iy1fmt li o;()srxr(o3ny1apt mnct s  2raxr ot1tleoifeildfm2ea( ont4tlxnmo3totlp rlivsls trtoxo3iy4lpen nvs s  Dumx pnu0opt mietat m2ra(vs u4 ltoio oodlaDrluvols0 etr(r3iydap nmfvsasfs2ua(rpnu0oee mictltlm uaump;u0texoxfctytlptrlivo;t)setmiopoo4apenlivs t srrmxmpno1tpe micild m2em(vo u)trtomrctodlmtrai o;( teum(m nodlm nlnvils) rurx o;o4tpxomfciadfs2emuvonu0tltrmo3to1oa r i slt trtmxr3oy4optnlncsls) rtmx ono0olt mfctls aDuauvpnu4alxrmo iy1lptr nvo s)s2to(m3io1lmtnmnetl()srurx  ;u0tlx ifciytfs ra(mp u)alenmo3iodoateliei;s0 2tmxopnu1oltelicias a2ua(rpot1tlx ioeiytlaDem( o;(0 etoxo tytomtelu s (0 etrimpoo1omen ics t) 2umxm oo0tlenmieiys s2ulu o;u4texrio ia1lptr nvo;s0s2umim nudamtelnes tfaDtmx  ;o1tet iieiltls2ra(ms;u0altnmr iy1fpDr uei;t)trtmim3io4op nmnvs (fsrurxro;t0tpenmi3tyd m2rlnvsn() rtnmfciotoptrlnes;s0srtm(mpoodamtemiei (farrr( o;u4ale  ieiys a2raums;() rxnxo3ia1fptr iei (0s2xrir3io1optn netls)aDra(r no4tltnioetls m rl(mp;u0tlxrxfctytomD  uvs ()setr(rpiu4ope  ncsasfs2tr(r nu0tetn ictadlaDrlu sn(0tetrmr3tatoaDrln il(0seurxmpou4ll  mivtat)srumu p;u1oex mf3tatfs2rl(mo;u) rerio oadfpDrlu sls s2um(rpio4ape lnvi (faDua( pno4oexniiciadfa rln s t)tlxnxf3tytoa e n s s0 rurim iodlltemici ( aruaumpot4tetoio3tyd sDuauvs u4texomf oadfmD  nvolt)s2uoir3ny4ape mfeia(f rua( oot0texoifciadla ra(mo u0 etnifciodlpt  ivol(  exo(mpio4lpt mnei ( srum(rpno0tex iietyt mDuauvo;t0 lxrxrctodfmDeluei;(0teumiopou4ll nmfvi (f Draxm
\ No newline at end of file
@@ -0,0 +1 @@
+iesl( trto(o iy4ap  lfeilt arraxmonu1apto f3iltfm ea(vp;u)alxrif3tatoat  nvils srtoimpnydap e neiatf rrmxmp;t1optnifciydls ra( o;u4 rxrmf iatfp elnvs;s)srum(m iydol  mfvtlt)sDta(mo;t1tet  oeiadfs2eaumpnu4 eerxrcta1fmDrlneo s)s2uoxopou1lptnlfctls  2uau  ot4tlx iociltla2rm(ms u) lxoxf3totfpD  nvslt)tetoim oydol nlict tfarrr(r ;o0tle mi3tysfs ulu p;t)aleoir oytlpt  i o;()truoxr3iy4lmtemfvsls srrmxm ou4opxoif3iytlsDum( o t0teeomr iadlaD livo (0 2toim3oodal  lfvi tf 2raump;t1olenifctltlaDrmums ()trxnifciy1oa r ieo ( seum(mpoodlm e netls) 2rm(mo;t4aetnmfctldls2um(mo t)aeenxf3tydfpt auei;t)srtoxmpiodol  mfvsat)a2um(  nu4olto octltfs uanvs (4tetnxfcoa1fptr ueol( tetrxmpnudomenmicil(f Dur(m nt0olxnioeiysfa2umump u4 ltnmf3todopte neilt) rxr(o3ou4lle  ivils s2tmxr ;t1aptomfciatlm rmuvsn(0 lenmocootom elivi t setmir3iy1lpenmics tfsrurum ot4oex  o3iytlmDra(vsnu0tetnifcto1faDe u ol( srxoirpno1lle mfctls)artmxm ;u1opx  ictytfm2rmumo;u0tetomocty1om e ieo;t0trur(r iodop   fci s  2rm(mp;u0aex io3ilt a rluvont)altnxrciadoaDr ueol() 2tr(o nodll elieilt) 2rm(mooo4ope mf3ilsfaDumuvo;t4 exrxf3iydomDrlueo s sexrxopny4lm e netl( artmxront1tet  fciad m rm( snu0 etnxfciytlpDrai o;s0s2trxmpoydome licil(faDtrumooo0alxoiociatlm2el( o;u) leoircio1lmteai o;t)seum(o nodlp   nesls) 2rrxm nt0oltomi3iadla2emn s u) lenxo3tatfp elnvilt  ruoim3nu4lptnlnvi tf 2rmumpot4tlt mfeiatls rmuvs;()teenif iotfmDeai i;s)seurxmpno1ape  iei (f rurum no0olenmf3iys m2umu p ()tlxnxfcoadlpDrli olt0seurxopoo1optelncsl(f Dtaxront1aptn fetatlsDemu s t)tltoio iytlpDeauvol(  rxrir3iu1om nmncta()aDraumpoo4aetniiciltfm ul( pnt0 rerxfciytfpDrli o;t)t2ur(o nu4lltnlfcia( a2rm( onu4opeo i3tldls rm( s (4alxnxr iodfat aieolt0s2trxm3iu1lm n fcs t)sDumxrpnt4apeo fciltlaDuluvsnt0 eerxr iatlp   nvs ()trxr(r3oo4ope lfet s)srtaxmp;t4tlt  o3iatfm2ua(mp (4tetrxo oatlaDrluvo;( t2xmirpou1ll   ncs t aDurxr ;u0olxomf3iasla2ul( s;t0tlxrxf3oodfp  livo;()seto(mpnydlpenmnctasfsrrm(r ;o4tltoii3iad mDrmnvon(4aetnxrctadomteaues;( t2tmim no1lm  mfvsas) Dum(rpnt1aex mf3tatfsDrl(mo t)aeenmrcta1lmte ivslt  2toxm3no4lp nmivs tfaDumurpot4opt  oeiad m umnvp;t) etoxo totfmD au s s0teur(o oodopeemnvia(f 2tm( poo4oetnmieiatfsDrl( s;t4teeoxf3iy1fp raiesl(  eto(o oo4alt lnesa(fa2tmumpno1ale  ociltla rl( snt0 etomf ootfatraieil(0 rtm(r3nu1optn ietas)arraxmp;u0oexo ociat a2ul(vp u4trxrxr3ootoa  luei;()trumxm3nu4op e fei () rtaxront1tleo fciydlsDra(vo t4artoxf iytlp rai o;(0srurxr iu4lleemnesl()artr(monu0optoiictyd a2umuvp u) ltomrciy1omteanes;t0trtr(r oodlleelfesasfsrrrx pot0aeenifeiadfmDemnvp t4texnxf3oa1fp e ivi () exmxm no4ap n ivtlt  rra(r oo4aexnmiciatla ra( pn(4 ltnmrcoodom rauvs s0texrxm3nodomtemfvta(fsDum(  ;t1alxoii3iaslmDua(vs;u0tlerxrcoy1fateanvs;t0 rtoxo nudap nlicslt arur(root0tee if3ilsfs2ea(monu0tlxnif oo1lat livs () ruo(opny1lm elieil( arraxm ;o4aexoif3ild a rm(msnt4 ltnmr iytom  anvols  etmirpoodlle  fesa() rra(moot1apxnioeiydlsDran snt4 etrmf3oytfpDelnes (0 2uoim3oy1amtemnviat)aDtaxrp;o0ale io3ilt a ranvs u0trtoxr tydoaDraieo;s) 2uoim iu1lptnmfetl()sDtrxrpnu1texniieiadlsDrauvo (4teenifctodlpD lnes;s0t2to(r oo1lm emicias artmx pnu1oexomictltlm rmuvo;(4arxoirciodom r n sls)s2um(m nodalee nesatfs2rmxr ;t0oex  o3iatlmDrm(ms;(4 rtomocoodoptean s s  exmxr3iu1lpe lict tfaDrrxro;t0aet mieiltfm2rm(ms;t0tetomr oodoaDraues;t)t2tr(r ny4omenmnvi t a2raxrono1tlto oetlslmDrln snu0trxrxo io1fa   ues;t  etoxr nudomeelnciatf 2rrx p;t4teenif3iysfs ra(vo t0 eenio3todopDe neils0trxrim ny1am   fes (  Duaxm nu1aetnio3iad m2eln s u)aleomr ty1fmtraivs;s0srto(o io1lpte neiatfs2tm(mpou1alx  fetyd a rlu s;t0tleomf iy1lpDe ivs;t0 2to(rpnu1ale mncslt s2ra(mpou0ope ioeiad sDelnvo;u4aeeoxrcoo1fmD aueol(0seuoxopnu4lptnlfvtasf rtaxmpoo4olen fctldfs2em(mo;t)tetrmocia1fa eluvi t0 2umim nudape  nvta( arrau oot4tleoio3tadls rmu snt4texoio tatlp rli s (0 rtr(r no4olenlivil()s2trxmo;o4apx ioeiyslsDul(mo (4trtrxo ia1opte u o t  rxm(o oudop nlfvtl(f rraxrooo0tpen ictasla eau s;(4 ltomrctatop raueilt  eur(opiy1lpee fvt s)s2tmxmp;o1tetn ietytls rm(vsnt4tltnio iodfp e i s;(0t2umxm3ou4apenlnet t) 2raxm ou4aet mfeiadls rlu s;() rtomoctatlaD  i slt)seurir io1lme  iet s) rumx  ;t4aeeo ociydls2ua( p () etnmfctotfmD  nvo;t0 2to(r3iu1ap  mfcsat  2rmurp;o0alenio3ildlmDra(vo;u)arxrmo3oatoaDeanvi;(0t2toio iu4llte ietatf Durum oo0aet moeias mDrmnvp;()aetnio iy1opDrlieo;( texrim3oodal  lics t) 2taxrp;o0tpe ifciyd aDrmu s;t)tlxnxo3iodlpteluvo;t seuoxm3oudomtn ivta() 2ra(rpou1tpto ociyd a2ul(mo;(4 etnmo oo1oaD anei;s0setmxr iy1opte nvtat artauroot4apto feiat sDeluvonu0 exrxf to1lmtr i ols s2xrir nu1lm emnci (  rtm(m ;o4teen feiasfm um(vs (0arxoxrcoydfpDe uesl( srtm(rpiudomeemietlsfsDtau o;t0aex  i3ias m2elnvs;u) rxnio oa1omt ai s t)sexmxmpiodale liciat) 2tm(rooo4aet io3iysfa2ranmsnu) etnxf oodoa rlu o t)teto(opnydamt mfvs tf 2tm(mono1ale miciltfaDrm(mp;u4aexnifciotlpD  i s s  exoxm3oy4amtnmnci t arumxm ;t1olx  ociaslsDel(ms;t0tltoxrctadlateaueils0 rxmxm iu1lpee netl( srtr(r no4tex  o3iys aDrmumo;(4alxnxociytoa ranvsls teur(m nu4omtelnvt (fsrua(m ;o0tlxo f3iyslm2uluvo (4altoio iy1fmDelueil()srumimpno4am  lnvias sDrrxmp;t4oexnmictasfm2uluvs;u4tlerif3oatlaD lnei t)setmirpnu1altelivtl()s2tru o;o0aex mfciltfs2uau p u0aeeomocoytlmt au i t)tetm(mpio1lle micsl(f rrau onu1tpe ifeils m2rm(msnt) rxnio iy1fpt  u ols  eurxr3io4om  lfvta()aDurxr ot4tpt ioeilt s umu p u)tlxomf iodlpte ueilt)srumxrpoy4aleelfvt sf rtmx o;o0texnmoeiyt s uan o t0tltoxo oatfpDe neo ()trur(m3nu4apeemfcs ()aDurxr ;o1alx iocildlsDuluvo;(0tlenxo iatoa  anei t0srxoxo3nudal  lfesl(  Dua(r ;t0tlto feiydfa2ua( p t0aeeoxr iy1lm   ivils)t2urio3oo4op nmneil(faDtm(m nt0aetomoeildls ul(vs (4texoifcoytlpt auvi;s)t2tm(r oo4ale mfctltf rtr(moou1teeoiiciytlm2um( p;()trxrif3iodomDe u il(0trurxrpnydop elnesl()aDum(m ;t4tpx mociytls el( p;()artrmocoodoateauvil(  2xr(m3oydopenmnvi (fartmu  no4olxnii3iatfsDumnvo;(4arenxf3tydomte uei s0 2urim oy4am n nciat)arurxmp;o0apt moctasfa emnmo;()tleomo ia1oa elnvs (0s2uo(r3no1ap nmnvi ()artm(mo;u0tlxoiictyd s elu s (4arenmo3iodlm  aivols0s2xm(mpiu4lmtnmfvilt)aDurxrono0optniociysfaDemumsn(4trtoio3oodlm r neil(0s2trxm ny1llee fcs t artr(mpnt0aeenifeiltfa2uan o t0trxrmociodomt ai s;s)seto(m3nydamtemfvi t srraurpou1tlt io3iydfa2ulu on(0alxnmr iadlaDeau o t)trxm(o oo4omeelietls) rrm( pou1aexnio3iat a rlnmpnt0 ltomf iytfm  aueo;t0trxrir3no4alenmfetlsf rraxrpoo4tpenmf3iadlsDeanvpn()trermr iy1om elnes (0t2tm(rpnu1om emivsl() Drru  ;u4oexnif3tltfs2eau o u) eenxr3ootfpteai ils t2xm(rpiodlmeelfcslt aDrr( pou4tpxomi3ias sDrmumo u)trtnmf3oo1laD an o;s)s2uoim oo1lp n ictas) 2ra(r ;o4oetnif3iysfsDemuvo (0aexoxo oo1oateli o;t trtoxr no4al elnet ( sDrru ont4ole ifciys sDuau p;(0trtoxr3oo1lp eln o (0 euoir nu4omee fetl(f Dumxro;u4olx mieiadfmDrmnmpnu4trermoctodoatraivs;t0tetmxr3oodomtemics s)s2ur(root4optnif3ildla2el(mp t0aetnmr oa1lm r uvs (0 2um(m3ny1olt mnvtltf rrm(mont4tpx  o3ildfa2el(mo u0tlxrxo3ta1fmD  n s;s t2urxopou4openlfctltf rumxr oo4oetomocilsfm2rmuvpnt)teerio3oodlp r uvi t)srumiopiodlptnlneslsf 2ur(rpoo0oexnii3iatlsDrmu s;t4 leoxr oytlptelivs;t) eurxo3oudam e fvs tf rtax o;t4altnmfeilt s2ranvo t4trtnifcoatfp rlnvsls)s2toxr3oo4altn fes s)s2tmxmpnt4oeeo ociydfsDelumpn(4 eeoirciytopDrlnvi t0 rtoir3nu1lmenmfvta( s2rm( pot1olxn ieiatfmDrm( s t0alenxr tadoa eli s;() 2trio3oodopenlivilsfsDur( pnu4opxnmoeiasfm2rl(ms ()trxnxfctotlp  luvs;t teur(opnydale miesa( s2tmumpnt4tlt ioctas a eanvsnu) rxnmo3todom eln il()setm(m3nu4lm nmies s)arrrumpnu0tpx micilslm rl( snu4 leoxocoa1oaD aies t)teuo(rpnu1alt mfeil(fsDrmu o;o4oleoiociys aDuaumsn(0trtrio oytlaDe ueolt  2toimpou4lp  mfvilsfarrrur no4teeoio3ildfm em(mp t4aeerio3iy1lat  n sls)seurxrpnu1ale  icils) 2tru  nt1oeenio3ildlaDeauvo (0 etriociodfpDrlnvo;t0s2trxmpoodap  mnvtas a2urxr ou0tet mf3ilsla2ra( s;() rxnmrciotoaDr nvsls0srxm(o3nu1lmen nci ()aDrm(r ;o0tptniietys aDul( pnu0tetnmr oy1fa e ivo s  etr(mpiu1lltemictasfarurumo;o0opt mfeiltfs2rmnmo t0teeoxf ta1oatelivil(  exo(o3nodomte nct s)a2raxmoou4aeeomoetadfs um(vo;()trenmo3oydlmt ln i s) 2xmimpiy4amt lnesatf rum( pnt0tlxoio3iltlmDul(von(0 lxrxr3tydfa rlu o s) exm(rpoy4lmt  ivtltf Drm( o;u4aetoifeiatlmDrlnmsnt0tlenxf iy1lmtr uvslt)t2trxr3oy1ole lieiasfsrrmurpou1tet mf3tyt m2eanvsn()altnmo tatomD  ivsls0 rum(r3iu1ope lnci ( aDurur nu0ape mieiltfs2ra(vs;u)aeenmrciydoaDe i il( trxmiopoodol emieiasf 2rmxrono4apenii3tldfs2ean onu)tlerxr3oy1lpteluvils)t2toimpio4lm   fvt s srrm(r oo1oetn o3iyd mDrmnmsnt0 rermo oytomDe ueo t)trurxo oudamenlncilt s2um(root0oleomo3tydlaDeluvs (0trenxo3iodop  lneolt  2xrio3nydalte nvil() 2uau pou4tlto o3tytls uaumo;u4arxrmrcoodom eau slt)srxmxmpnu4amt  fcilt)sDtaxmooo4texnmoeiatla rln p t)tetnxo3tydfaD auei () exm(r3oydamt liesl()sDra(  no4ole  oeiatfm eln on(0trtoxr iytopt  n ilt texrxr3no4ol  mivi sfs2uaxrono0opto ictat s eanvs;(0trtrmr ia1lp r uvi;s trxr(rpiy4ll   fcil(fs2ua(  no0aptomfctat a rm(mpnu4trermo oy1lmt auvo t) rtrirpiudol elicsltfa2urx ono1altomfeias aDuau sn()tlxoio3totoaDr u s;t) 2trxr3iydapte nctat s2ra(moou1open fetytfs rl(vo;u4trxrio3oy1omtrau i s0trxo(r3oo1ap n fei tfs2urx pnu0aee mictyslm2rmuvs ()artoxfctytlateln i;(  rtmiopiy1aptelictl(  2uaxrp;t0opx iieiadfm ul(mpnt4tetoxf3oy1fmt aivo;()s2xmxo iodol nlivi (f Drmu o;t0altn fciytls ua( s ()teeoir3oytlpD an i;t sexm(r3nodame mnei sfs2rmu p;o1tlxomictydla emnmo;t0tltnmr oatop  au sls s2xmxr oydlpe mietasfa2tm( o;u1ope  ociasla2ua(vp;t0aleomf3tydlmteluvsls texoxmpnu4oleelicilt  Duax ont0aexomi3iydlm rmu o;()texnir oy1oate uvil( s2um(mpiudlmee icsas srrm( poo1open o3tyd aDumn s;u0 rtrio3oytfatrau i;()trxoxr oudlltnmies ( a2umu  ;u4opx mfciytlm ean sn(0arxnmfcoatopDeln o s) 2um(o3iy1alt lncs sfarur( ono0oetomoeiasla2emuvs;t0tlxrirctydoa ranvi;t0teuo(m3nodol emncsas) 2umxro;u4tpxnmocias s2ua(vp;() etniocoo1op raieo t0trxrxo3oo1lmte fcsl() 2raurpou4tpxoioeild aDrln p;t4tlxrifcty1fpD aivs t0trtoimpou1amtelfvtas) Dur(mo;o4apen i3iaslsDranvont4arenmf oo1lateau o;s0setrxrpoo4aleelivsltf Dtaur oo0tltnifciyt m el(monu4texomo3tatop eauvs s sruo(r3iudamtelfvt s srrmu  nu0alxnmi3tad m ra( p;u) etnxoctadoateai i s  2toim io4altnmfciltf Drm(m ;o4apeomfetldlm2rm( p;(4trermr3ia1laDeli i t  rxmxopnydop nmnct s a2tmumont4olx ifetldfs umumo;t) exoir3oytlat  u s ( setmxr iu4olt mnvs s  Dur( p;u0aptn ieiysfsDra(ms u0 ltoifctadfa elnei;t0 2tr(o3iy1ol nmncsl( sDua(mooo0apx moeildfs2ra(vont) etnio3tatlat liei t)s2xr(r3no1ll nlnvtls)a2urur ou4open oeiyd aDem( s;(4 exoircootomte ieilt)tetm(mpny4ap e iciat) 2truro;o1alxn icilt s umnmpnu0 lermf3tatlaDeluvs t)seurxm3nu4am   nvs ()a2ta(m nu0tpenmi3tasls rl(mp u0arxnif ty1opDrlies s  eur(r3nydole  iesa(f 2rmx ont0texnmfctyd m2ra(von()tltrif3tytfatr uvol()t2ur(m3iu1ope lnvta( artaxmpnt0texomo3iys s2ulnmsnu0tltrmr ty1lp rauvi (0teumio3iu4ol e neta(f rtru o;t1tlt iociytla2eln on(4 rerif iytoptr ueo;t)texrxo iu1op nmfcilt)srumum oo4olx ii3tytfm ranvo;(0 lxomf3iy1opD lu o;( sexm(r no1lpeemneilt  2tr(ronu0tlx mf3ils a2ul(vs u4alxnmfciydomtraieols0sexoim3oodlm nmieia() rtr(m ot1tpx mictldls2elumon()altomfciotlm   ivi;s0 rto(opou1lp   ncilsfs2rmu poo0oeenmoetysfs2ean o;u0altnmo3tatopDelivils truoirpiu4apeelnvil(  Draxmono1alxnmo3tysfa2rl(monu)teenifcto1fpDe n o s)texmiopno1ll nmici s a2rau pnt0ole io3tasfa ul(msnt) rxomo3tatoateaues s  2trir iudapeemnetls)a2ra(rpnu4oex ii3iasfm2rl(vo;(0trxoxocto1oaDrln s s0 rtmxo3io1llen fcs (fsDumu  nt4aetoiiciyd s2umnvpnt) eeomf iodfat  ivs ()sexoxo oy4apte nvt (fsDua(m ;t0apt iociyt aDrmuvpnu) reomf iydfpteai i t  2xo(r nu4lpt mfetltfsrraxmpnt0altn ieiyslm rl(vsnt)trtrxf iy1fatraieo ( t2tmimpoodomtnlicias)aDraur nu4tlxomoetyt a rl(mp (0 leoif3oodfmDraneolt setoimpoo4ap  mnei ()aDrax pot4tlx mietyd a ulnmonu0trtoir3iotopte nvs;t0 etrxopiudap  lnct t) Dra(m ou4altnifciatla umnmp;u0 etnxo ia1fp rlu ol( trxmio3iu1ap  mfvi t  Dumxmp;u0tpeomo3tls s2uan p (4arxnxocoodomtr nvslt  2urxopno1alt mietlsfsDuau poo4tlx  ieils sDul(vpnu0 etnir3ty1fpD  nvi;() 2tmxopnodomtemiet s s2rmxmpoo4tlxomo3tldfmDrlumpnt)aexomo3ootlmDe neils  exoir oudaptemncilt)aDrrx  ;u0altnmfciadfm rlumo t0aleoir io1fpt  nvs;() rxrxo3oodamtnmfctl()srrau p;u4teto oeilsfaDelumo t4tleoxr iytlmD aieo ()trtoxm iy1lmenlivil(  2tmxrooo1alxo ieiadfsDra( snt4teermrciytoat ln s;s0 ruoir3iy1amteliciat  rurx ono4tpe ifcild a2ra( s;t0 exrio3ia1lptean i t)trtoxopnu4lmenlfeiatf rrmx pnt1opx mfetytlsDeln o ()tlxoxfcoydfa elueolt0sexo(m3ou4lpe lnet sfarrrur oo1aet ioctyt s ua(vp;t)trxnir tydoptelueo s0srumim iu4lltnlicsa()s2tr(mp;t0tleoifeiad s uluvp (0teenxf3todfmD an olt0 etoio oy1omtnlieslt srra(  no0aleniiciltfa rln o u)trtnir oytlmt  n ils) etoxo iodopte iesatfsDraxm no4olxnioeiasfaDrlnmp (0aexrxrcoadoa r i o (  etrxrpnu1ope  fcs t s2tm(r ;u1ope  ociat sDemnms;t4altriocoydomDeli o (0t2xmim iydam   ivt t) Drm(root4opeoiictat aDrmump;()tlxnmrctodfp rai o s)trtrir iy1lpt mnvsatfs2rmum oo0olxomfctldla2emumsn() eenxf totfmDeluei;s)t2xrxr iu1alt lfvtas) rtrurpnu4aptoifciltlm ea(vpnu4treoio oadlptelnvo;t0trxm(m3ny1openlnesl( s2rr(root0opx moeiltfaDeluvpn()tetriocta1fptr i s;( trurxrpnodapee ieiatfsrraxm ou1opeomocildls ra(vo;u) exrxociotfmte nvs ( trur(m nydlltnlfcsls) 2raxr ;t0opeo feiadfs2emnvp ()tleomo3todfp rauvil() rumim3oy1lmtnlfvt t s2raxm ou1teenmo3iatls2ua(msnu4trenircty1laDr iei;t) etmxmpiy4om  mfcsa( sDra(  ot4oleo o3iydfs2rln snu)teenirciy1fm rlueslt0sexo(r3io1op emnesl(f rrrumoot0aptnmo3iatfs ranmo;(4trxnxr totoaDrluesl(0trxm(r3oo4lpeelfvilt a2umurpoo0alxn ociyslmDem(vpn()trtnio3ia1oa ran o;s0 rum(m3iy4op nlietas)srtmurp;u1tetn ieiytlaDrl(vp;() exoio oy1fm eauvs;(0 2tm(m iodame lnvs s  Dtaur ot4oltnmictatfm ranmpn(4trxnmo tatfp r neolt srumxr nudlltelies sfa2umum ;t0openmi3iydfa2eanmo t0tlxnxf ta1fm  li sl(0t2xrio ny1apenmnesa(fa2tm( pot4oee ifciadfsDumnvon(4artomr tydlp rlivo (0 rxm(r iudapen fvtlt) 2umx oou0tpeomieiatfa eanvo t4tltrir3ia1op rlieo () rurio3no4ap nlnes sf Duaxmp;t4tptnioeilsla2ranms;t4tetnmrciy1fp elies;s)tetmimpno1lpeelneia(f 2taumpou1aee  oeiadfs2rmnvon(4alenxf oytop eaiei t trtrio ou1lpe mieil(  rtrump;t0teeomictlsfa elnvpnu)altoir3oodfmDelues;t)s2xmirpiodole lfvsls  rraxr no4opxo fciaslm umu p t)altrir3iytlptraneilt t2ur(o iudolt mfct ()a2raxmp;t4tpx  ieiltlsDelnvs t0artrmf tatlp  an s ()seumim oo4am   net ( s2tmurono1tpeo oetadfaDeanmo (0 ltoxocoatla r ueo t  2urimpoudlleemncsa() rraurp;u0teeoifcilsfs em( o;u0 rtrmrciodfmD aneil(0 rum(mpoy4lptemies s  rrru pno4oeeo ieildfa2uan s;u0 etrmoctatfp  anvslt srxm(r3ny4opeeliesls srtrump;o1oltomfciatfsDul(ms u0teerxocoydlpDeauvi;()trto(r3io4apenlictas) Drmxm ;t4oltomietasfs2eluvont)trtnmr ta1oa raieo;(0 rur(r oo4ale liei ()a2taxroot1optniicilslsDulump () lxrifciotfa e u o;s)texmir no1ol n nvsat arrmx pot0ole io3iadls2rauvo (4arenxf3totla e ivilt)teuoxm iy1op e ivil(fa2rmxr ot4oex mietld sDua(vpn(0 lermr io1laD auvo;t)srurxr3oy4altnmnvslt  rururp;o1tex  o3iltfa umuvsnu4aetrxr3iydfpt ln i (0 2toim io1alee fcsl(  Dtr( pou4aet mfeiasls2um( s;(4aetrmf tadopD  nes;s  rur(rpoodomtemncs (f Durx  nu1aetnifeiydfa ra(vpn(0tlerif ta1fmDeai i t)t2tmiopoy4altelfctlt  2raxm ot4tpxoiieiysfm rlu s;(4 eenif iotlm r uvils)trxr(o3oydolee ncil() rtmxmo;u4olto feiltls ulnvs;u4trenxf3io1lptr ueils) euoir ou4lptemneiasfsrtaxmpot0apenioeiydlm2umumonu0trerxrcoydom  luvi;t)texmir nu4ape mfci s) Dtmxmoou0aetoiociatlmDeanms;t0arenio ta1oa rauvilt0truoimpnodom n netl(  rrr(rp;o0tltniociys sDrmuvp;(4 lxomociy1opDr nvo;t)seurxmpiudame lncils  Drmx pnt4tlxomiciysfsDem(vo;t4altrir3todfmDelu i;s trxrxm iudop nlfesltfsrrmx  ou4oltnmfcilslaDuanvpnt) leoxf iadfate uvo;s t2tm(o ny1lme  feilt s2urur nu1alt ioeiyd aDemuvpnu0tlxoio oadfp eau sls  rum(mpou4amt lnei tf Drrx p;o0alenmi3ias a emumonu4tlxomo ta1fpDraieil(0seto(r3iu1lp   ncsat) 2tm( pno4aet iietadfs ulnms;t4arenmf oatom rlu i t seumxo ou1lmtemnes s a2uaxrono1texnii3iadls ua(vp u4tlerirctadlp eai s;s  rtrim no1altnlfes tf 2rm(r ou0tpt mfeiasfs ra(mo;t) etnmrctadlmtr u sls0 exrxr3oy1om elivs t)aDuaxm no0oee ioeiad a el(msn()alxrxo3todomD au o;(0trxoxr io1al nmncs t)aDua(r ot1tltnmieiytfsDran p;t4aeerxo iotomDeaueols0 rtrxo nudaltelieia(  2trur nu4tpe mo3iytfm2umu sn(0teenif3tadfpDe u s;s0setr(r3nodoptemnvtl(  rtrxmont4tpeomictatfaDuaumo;u4tltnif iatlmDe nei s0 2umirpno1llen ieiasf Dumu pot4apeoifeiltfm rmumsnu) exrxf3iy1latr n o s  exo(opny4llenmfvtasfaDururo;o1apen iciadls2um(msn(0alxnmrciotfmDelivo;t)setrxm3nu1op e ietls arrmx ono4opxoioeiat mDuanvont4tlermr io1fmt aiesls) rtmxmpiy1ame lici () rta(rpnu4tlt mfctas a ulu pnu4 exnxf ta1laD  n sls0truo(opio1ale  fcs () 2rauro;u1texnifciyslm ul( s (0 exoxo todfp rauei ( tetmiopnu4lpenlics ( sDurxmoot4tlxoioetldls ua(monu4tltrifcootlateau olt)s2trim io1ame lfesl()sDra(m ot4tee mfeiatlaDra(mo;u) rtnmfctydlmDe ueslt0trxrxopou1alt  ncia() 2tmu poo1tltoioeiad a2ranmsnu4tlerxoctytfpD anvo ()trumxm iudol emnci s  2rr( pou0tlto feilt aDelnvon(0altnxf3iotlpDrau s (0 rtmxr nydlltnmnvil( sDuaxmoou4tetoiictytlm eanvs;(4 lerxf3iydom elu sls0 2toxopny4aptn fvils)aDtrumpnt4oexnmo3ils m umnmo;t) rerxr3iy1om  aivsl(0teto(o3ny1altnmfvil( srrm(  ot4tpenio3iasfm2elnvpnt)trtoxf3iotfp rlueo s t2xrxopnodolenlfcsa( sDuru pnu1ole iociasfm2uan o;(4alenmo oy1lm eau i t)s2uriopiudomtnlivt sf rtmxmp;u4oeenifciatfmDeluvo;u4trxniocoy1lp eai ol(0t2toio3iu1op n nesatfaruau o;u4teto ictydfa rm(vs;()trtrmf3iy1fa  ai o;()texm(mpnydome miet t) 2umx ono1tlt io3iat s uau o (0 lxomr ta1fm eaueslt0t2xoxr3nudlp n ivtl( s2urum ou4tetnmfciys m rln o;u0areoxf iatfaD aueo s seuoimpio1ol elnvia()srrr(r ;o0oeen iciat mDum( p u4texrirciotfpDrai i ( srumxo iy1al   ncsasfarrr(  ;o1aet ioetldlm2elnmp t4alerxr3iotfa eaies ()s2xr(opiu4aleemnes s)srtrur nt0aetnmf3tys a umn snt0tltomf oy1fpDr ueo;()srtmio iu1optnmfcilsfsrrax o;t1opxo oetadlm2ea(monu4tlermo tadoa   neo;t0 eto(m3iu1optelfcsatf Drm(rpoo4tpt  oeilsfsDra(vp t0trtnmoctodlm  luvi;( teuo(mpno1amte fci s)arua(rpoo0tltnmociydlsDrmu s t4 rtoio oodfpDrlneslt0s2toxr no1lp   fvil( arrr(  ou0optomi3ilsfmDel( s;u0tlxnmrcoo1lat lnvsls) euoxopnudopte nvslt  rurum ;u0tleomocilt a ulumsnu) lxnio3oa1lpteaneslt srxoxm3iy1lltemfes (fs2ua(  nt4olxniicils m2rln pnt4 etrmr3oadoat  nvilt teuoio iudlp  lfvta()sDrrx p;t4optoifciadls uanmo;(4tltomr iatlmt  nes;t0trxmiopnudlltn iei s  ruaxroou4aet ii3tasfs2ul( o;()tleoxf3oy1fmteanvo;s0 2tr(rpiu4oleelnes t  rum(mp;t0aee mf3tyt a2rlump (0tltrxr oo1omteai o t0trxo(mpio1olt lfvtat) 2um(rpot4alxomi3taslm rau ont)alxnif todfp   ueolt0 etm(r3oodop e ivi sfa2rrxr nu0olen fctatfmDeluvonu) ltrxr ootfaDelnvo;t) etrirpiu1ll elnesl(f 2ra(rp;o4tpxoio3iyd sDemu sn()altnxrciadfaD lu o t0teumirpoudalenlfesat)a2tau  nu0aexo feiltlm2umn s;u) eerxo ootfat  ivo;s) exm(m ny4al elivtls)sDumxrooo0apxnmfctys s elnmsnt0tlenmrciatfa r nvo;t seurxrpno1am  mivtat srurxmpnt0tlxnioctltfs ea( o;t0aeeomo3iatlat  ues;t0 rxrim3iu1alt  feilt) 2rrxro;o1tltnio3ilt m eluvsnt)tlenxf iodoaDranvs;t) eurir oo1op emnvsa( s2rr(mp;o0tex mocils a2elnmp t4artoxfcootfm  anvs;t) exoim3io1al  mfeiasfaDta(mpno4tpxnifetlsfm rmums;u)trxnif3todfptelivil(0trxoir oo1lptnmfetas  rrrumpnu4alxo fciad s el( snu) rxoir3tatop   ueil(  rxm(o ou1alenmfesa(f 2tmu pno0aee moetlt m2um(mpnu) eeomf iydopD auei;s)s2uoxo oodolee neilt)s2trxrpnu4oltoiieiatfaDuauvs (4 exomr io1fa   u s;()setr(mpoydlltnmnesat aruaumo;o4altn oeiat a2uaumonu4trtrmocoytfm raiei t0texm(o3iy4opeelietl( sDrm( poo1aee  ieiad a ranms u4trtnmrctadoat luvs ( seurio iy1olt lfvi t sDrmx o;t0olxn octadfa2ea(ms;t) lxrmf ta1lateai s t) rumirpoy4lpt  iesl() rumxm nt0altn fetat a emnmonu)aexnif io1oa rlnei t0t2toio iu1omeelivia( aDra( oou4aptoioctlslaDuanmp u4aexoiocoa1fateaneo (0setoir3nodol  mfvsl( aDtrx p;o4tptnmfeilslm2ean p t0 ltrxf3oy1fmD au slt s2toirpno1am nlncta()arraxmp;u4alx  f3tls m rln sn() exnircoo1fpD liei;( seuoim3ny4aptemfeia( a2tmx o;o1tpx io3iyd aDrlumo u0texrio tytopDrau i t) rur(mpiy1lmt lfeiatfarurxr ot4olenmocild s2rmuvpn(0arxnxf iotlpt lnes t0t2toxm nydole lncs s aDrr(m ou1tpeomictatlmDul(vp;u0 rermf3oodoa  lu i;s0 2tr(mpnu1openlfvsat) 2trxrpot0ope  ociytla2uauvon(4 rerif3iotlmD  n i;(0setoir ny4op e fvsls a2uau oou4aeeo iciydfs2ul( s;u) rxnxr3oodop e uvilt)setoxopnudlpeelfvtltfs2ur(mpnt1aee moeilsfs ulnmo u)teenxf3tadoatelivi (  2xmxrpnu4lleelnetlsf rrax  nu0open ociadlsDum(ms t) reomf iy1lmtr nvo;t s2urim oo1omte iesat srrrxm ot0tpxnioeiat a2elnvsnu)trtrxfciotlm  au o;s) 2um(r3oo4lltemnvil()sDur(rpnt0alx  fcils m2um(vo t0tlerxo oo1omDe uei t  rto(o3oo1altnmieslt a2uax pno4ope mocilsla ulnvp;()trxrxr iotom  livi t)tetoxrpnu1ol nmnvsa( s2tax  ou4olt mfciydfs2rlnmp u4trxrif3io1lptr uei s)srtrir nu1lle  ieta(  rua( oot4oltoiietysfs ra( p;(4aeeomr3oy1laDrlues ( trxm(rpoo1ol nlivslt) Dtmur oo4tptoiociltla2em(vs;t0areoxf3io1fm e ueslt  ruo(m3ou1amenlnvs (fs2umxmpnu1tlx ii3iyslm2rlums;u4tlxnmf iadla eluvs;s s2trxmpny4lmenlnvi s)arumu pot4opxo oetys mDem(mp t0aexrir3iadoa rli o;t  rtoxmpiu1lpt mnvsltf 2um(mo;o0oetniictasfa2rlumo t4trtnxrciydfateaivi () rur(o3iydap emivias)a2taumpot0opeomoetyd s eauvont0 exomr3oydomD auei;s)trxrxm oudlltemies sfaDra(  ;u0oleomo3tyd m2rm( p (0tltriocoytoatr u s (  rumim iu4alt mfei ()arur(rp;o0alxnmoeildfa2eau onu0texomf oydfp elivo s0srumxr3nodlm emiesa(fsrtm(m ot1olenmi3iyslm2eln snt)treomf3oo1lpDe i s t0t2tr(rpiydapee ivs s  2rax poo0olxomfetat m2rm( o t4 etnxo iytlmtr uvilt)s2xmio3oo1ope  nvsa(faDrmx  ;u4tex if3tadlsDrm(vs t4aexoxo iytoatr ivs t)sexr(mpiudap nlfvtatfsrua(mo;o1apto feiadlmDuanvs;t4tlenmrcootlat  ieil(  rxoirpny1om e neil()a2umxrpnt4olx ioeiydfmDuln o ()alxoifciytoptraneo s  rtoim3iodlpt mncsas  Dtaxrpoo4olxomictls m2rmumo;t)teermo3iotlpt an s;()setrxo oydalen nvi (  rtm(  ;t4tpx ifciadla2umuvs ()tlxomf3tytfm rai i;t  etmxr3oy1om   nei tf rur(m oo0tle mocilt s rlu snt4 rxnxo iadop r nvi;()tetr(m3iy1lp   nvtl( srrr(r ot4oeeomieiatlm2eauvs;()aetrmr3oadoat an ol(0 rtm(r3oo4ope mivtls sDrm(ronu4oex moeiltfaDem(ms t) lxrmfcta1lateln s;s) rumir3nu1alte neiat  rtmurp;o4aet mociatls2el(vp;u0aexnxo iotfm rlnes t)setr(rpnodam n fcias sDtaurpoo0olxo ociatfm2emnms t)tlxnio totoaDelivol() eur(r oo1lpeemneia(f Drau pnt4tetoiieiadls2ua(mp;u4 renmo oodlateluvil(0 2tmxr ou1opeemiesatfsrum(r ot1olx io3tys m2elnms u)trtnxfciodlatr ieilt)trtm(o3io1amtn fesa(f 2rau onu0open ieildfs2eau p;u4 rtrio3oo1lat livo;s  rtmxo nodale  ics s s2ur( pno1aleo i3iydls ulums;(4arxoif totlp  ai olt)trum(r3iudopt  fcsat)srrm(rp;t4tex mociad m rl(ms;t4 eeomo3tatlpt an o;s0 exrxo3ou4al   fvtltfaDtrxmonu1olxomieiytls rlu p u)trxoxfcootopDrlueo;s0 etoxm3nudape lncsls  2um(mp;o0apx ioetytfmDuanvo t4 leoiociy1oa rauvslt0texrxo3oo1optemfvt ()srrmumont0opxoioeiytlsDulums;() lxrmrctodop ranvo t) etoxo ou4op   iesa( arta(r nt4tpx  fctlt m rm(vpn(4aeenmf3iadfatrluei s0 rtrxo3iu4ol emiviltfsDur( pno0apt ifetytlsDumnvo u4treoir3ootlat lneols0sexr(rpnu1amtnlncta(fs2tm(r nt0alen i3iyt aDrmnvsn()tleomfcty1fmDr ueslt)srtoxo3nudlmt lfei (faDraxrono1apxn o3tysla ea(vs (0aeeomf iydlat  uei;t  exrxopiy1lmeemivslt arumxr ;u1tpe iiciytfm2ua(ms;t4artrxrcoadfm  anvilt setm(o nydapt lictlsfsrrmurp;t4tex mfeiat m ua(vo;u)tltnxo iydlateluei s0 2uo(r3oydlmeelictls aDtrxm nt0ope mi3iaslmDumumsnu)texrif3tadop eauvolt0sexmimpiu1om n nciatfa2taxr ;o1oet ioeiasls2ul( o t)aetrir3tatfm  au s;()seum(o3nu4ll elici ( srraur no4aeenmiciydfs2ul( s;(4arenmo iadom eaiei;s0tetoim3nodop emfei (faDtr(m ;t1aptnif3iyd aDrlums;()trxoxfcoy1optraivi s0tetoirpnudlmtnlfciat) 2tax pnu4aexo f3iyd m ra( s;t)artnxr3ootlmteln ols) exrim ou1amenmfesl()srtm( p;t0tpxnio3iatlmDemu p;(0 etomocoy1opDeaivs;s0t2toxm oy4lltn ietas)aDrr(m ;t1olenmf3tatfa rl( s (4tlxoio3oatlmD  nvo;s0 rxrim3no4am   ivia()sDurxm oo4tltomiciaslm uaumpn()tlxnio tadfmteauvo t0 rtrxrpno4optemict t)aDurx o;u4opto octltlaDemnms;t0artoxo3oodfpDrlieils0tetmim3oydam e ivia(fsrurum ot4oet  fetlt sDua( s;()altnir3oodomtr n o s t2xr(o ny1ape mfctl() rum(ro;o1tpe ifcildfm2elump t0arxrmocto1opDe u s ()s2xoxo3ou1llt lieta() rurump;o1aet mfeiadfsDrmnvp;()aeeoxr3ta1omt auvi;t)s2xo(opnu1apeemnvils)sDumxrooo0aee  i3tydfa2eluvp;t4alerir3to1fpDeanvo;s) 2uoxrpiu1lptemivilt sDum(mpot0alx mo3iatfsDemump;(4tlerxo ia1lp  ln s s0srum(r oodalenmfctas arurx pot1tptomoeiytlmDrmnvs;t0 reoir oy1lp ean s s)t2to(rpoo1oltelneils)aDurxmoou0tetnif3iadfsDumn o ()altnxociadfateaues;t)t2xrio oydlpt  fvtlsf Drmxmpot0oexn fciadlmDel(mon(4aexomr iytfpDrliei;(0t2trim ny4ll emiesa(fartrum nu1tpxn fetadfm2emuvp (0 rxrifciotfpD aies;s t2xoim3no4lpte icil() Dumx pnt0tpt  fciadlm umn s;t) rtoir oytoa e ies ( trtrio nu1optn nvtl(f rrrumo;o4teenioeiltlaDulu s u)altoif3oy1optr ivs;() 2umir oodaltnmneilt) Durumont1tlt mietad a2umnvsn(0 rerxo3oy1op   nvi;s s2trxm3oodaptelieil( s2um(root0aeenmi3iat m2uan onu)aeenmf3io1faDrauvsls)trtmxo iu4lp emfctatfaDra(m ;o1alxo f3iltfmDrmump t4artoio3tatop  aues;t0seum(m3oodll elivtasf Dur(r ou4tpxnmieiydfaDeaumont4trxrmfctytla eaieslt0srxoir iu4lptelfcs tfs2tmum nu4aexn fciydfs rlu sn(0 rtnio3tydfa elu i t)truoiopiy4ope  ictls s2tax p;o0ale moeildlaDea( o t)altomoctodfp ranvs s0texo(rpiydaleemnetls s2taump;u4apt  o3tydfa em( pn(0aetrxrctodlpDeanvslt seur(m3iu1aptemfeias arurumo;t4tet mictld s2uanmo u) eerif totoateauvo;s)srtrxo nydllenmfvi t arraum oo4tle mfciad mDeaums (4trxomo oa1fmte uvs () rxmirpoy4ap  mfcil(fsrtmuront4aexomieiadfm el(vp u)artomr3iadlm  livs;s) 2xm(m3nudolteliviatf Dtr(  ;u1aeenifeiasfs rauvo (0aetrmoctydop r i i;( srur(m3no1lme  ictltfartrx ooo0apxomo3tyd s2uaumont) lxrxrcoodfa r uei s tetr(r3ou1opt  ieias) rtmumont4opxnmictatls elnvo t0aleoir oy1lpDran o s0s2uoimpou4omenlieslsfartmxmo;o4ale iieiasfsDuaums u0alxnxr3iotom e iei;(0tetrio3ou4opt mfciat  rrr( pno4olxomoetltla2eanms;u0trtnxoctydopDraivo () rurirpoy4amtn iviasfsDumxrono4olenmoetydlaDuanvpnu0aetnxfcio1lp r ues;s srtmxo iu1lm n ietasf Dtru pot0teeoioeiydlaDum(ms;(4altomocootfmD  uvsls s2uo(o3no1lpe lnvsatf 2umurpnu4opt  oetyt aDumu p (0trxoxf3tydfpD aieol( s2um(m iudal nmnvi tf rra(  ;u0ope  ociysls2eanmp;u4treoir3oatop e uesls trxmimpou1lltn ieil( sDrr(rono1oet  ociadls2umu p u0 ltrxo tydoa rauei;t)sexrxr iy1oleelicil()sDrmx ont0oltnmfciltfs2rmn sn(0 etoir ootlat aieo;t sexm(m3iu1lme  nes ( aDta(rpoo0tetnmfciad s2el(vont4trtrxo3todlaDrai ols0tetoir3ou1lm  micil(  Durum oo1oeeomocilslm2ranmo ()trerxr oydfm e u o s0trto(o3iu4al   nct tf 2uau  ;t4oex  fetadfm eanvo ()arermr oadlmte u o (0trurim3ou1op nmnes ( srtrx oou0ole ifctadlmDulnmp;u0 rxomf oa1fpDelnvi;s)srxrir3iu4ap nlfcsas) Dtrxm ot4aeto ieiysfs2ulu p u4tlxnifctydomD ai o;()srurxo ou1aptemnesa(fa2raurp;o1tlxo ociadlsDra( snu)altrio3ia1fmtr uvsls setoxrpnydom e ncs ()sDrmur ou0teeoioctydlm rmnvp;()tetoirciodopD lnvs t texoim3iu4al e fvtls arurxrooo1apto ieildls2ea(vo u) rtnxf oo1op   n ols0 2tmxr3iudomenlfet ( a2uru oot0oex  i3iys sDel( p t0areoif3oo1fatr ieolt)s2uo(rpoydoltnliet ()srtaumpnt0apxnmfciyd s ulump u0 leomf ta1lpDr ivo;()trur(r iy1lpenmfet s)srrm(m ou0alx mfctysfaDuln o;t) ltnmf3oytopD  n o (  etrxrpiu1ll e fctas) 2umur nu0texnii3iatlmDrm(vs;t4tlxrmo io1fp eaieol(0 rtoxr3nu1apeeliet sfsrurumo;t0oeeomieiat mDumuvs u0artoif3oydopt luvo ()teuoxmpny1lme mncslt  rtrxrpnu1aee mfciasla2em( ont)aetoiocoadlp eluvilt seto(opoo1opeelivt (fsDum(rp;u1apeo ociadfs2em( pn(4 lxnmfcoa1fptelies ( t2xr(m nudom e ietasf ruaur oo4ole  feiytla rmu o;t0tlenxo iodfm r uvol()trurir3io1omtemfcia(faDrau ono0ole  ietat a el( s ()teeoxocia1opDeaivi s) rto(rpiu4apt liet s) Drau pnt1alt moctadfaDeauvp;(0teerxr3todfa r u ils sexo(r3oy1olenmnct s) Drrx  ot0alx iictatfsDel( s t) exnmo tytfm   ieols0t2to(o iydolenlfct (fsrtru pnu0tlxn i3iyt mDel(von(4altomo oo1lpDrlu i s texmxmpoy1ll  mfvta(  rrrxmo;o1apto oeiytfm2eln p;t4tltnmocoydfmDeluvs t0 2um(r3nodlp e iei s) Dta(rp;u0aeeoifeiytfs el( on(0 leniociadom r ies s0 etoim3io1om   fcta( sDrm(  ;t4aeen fctasfmDuanvp;() leoxrcootom  au s;(0s2tmxr nu1ol nlneilt  Durxmp;t1texomiciydla rau o;(4 renxf ta1fa e nvs t0trtoxr iu4llenmneiatf rrmu p;t1aetoio3iat sDrmu o;(4altnxo3oo1fa  aiesls teuoxr3ny4amtnmietas)sDrmxrp;t4oex  oeiyd mDelnmpn(0 exoir oy1fpDelueslt)trur(rpny1amt mfci s a2trxroot1aetnmo3iatlsDrmnvs (4tltrxr3tytomte nvils srxoxrpiy4lleelnvil(f Dtr( p;u0opxn ictytls2eanmo u4tetnio3oodfpD lueo;t trxo(rpiudam n nvilt)aDrr(r ;t1apx ii3iadfm eaumpn()aleomrcootopDe ies;t  rtmir3oo1lpe lfvtat) 2rm( p;o0apt mictydlm ua(vp;t4 rerif3oytlaDe i ol(  rtr(o3ou1llen net ()aDrr(m ;o1ape mi3tydla2umnvsnt0tltoxo tatopte ies ()trumiopoudop   icsls)sruau pnu0olxo fetltfmDran s;u) ltoir oa1lateanvs;()seuoxopiu4lp  mivi ( s2trur ;t1aexo o3ildfa rlumpnt4aeerxocoodoa   ueil( teur(r3nudopenlfei t  Dtau pou0texo iciydlmDemn o;(4arxrmocia1lm elnvs ()t2xr(r3nodoltelfciasfs2ra( o;o4tlt iieiytlm um(mp;(0 rtoxf oydla  aneol(  etoxm3ou4lptn icslt s2rmx poo0oexo i3ilslaDrmnmo;()tltnxo3tytlpDraneo s) exoxm ou4am  lnvi (f 2umxronu4optnmictlsla2em( pnt)alermr iatfmteaues t)tetoxopoudoltn fvi ()sruaumpnt1alxn ietadla uanvp t)aexoxr ty1opt  ues;()t2tm(o nodoptnlnvias)srtrxronu1alenifciyt s elnvs;t4trxrxfctatoptrlieo;(0seumimpno1ale lnetls srtmump;u1apt io3ils a raumont0tetrxo oadlaD aies t0t2tr(rpoudop   icils  2rmxmpnt0alxoiictydlaDum( s;t4 exnif3iytomD  ieo s teum(r3oodlpeelnetls)aDumx  nt1apt ioctlslaDuluvp u4 etnxf3iy1opDe n i;( sruo(o ou1ale  ncs (  2tmxmpno0tee ii3iasfm2emnvp u0tlxnir iadla  lu ils0truoxo oo4lm nmivs (  2uaumpoo1opx ioetltfa rmn s u4trenir oadop eaiei ()seum(rpiudam emiei s  rtaxront0aleo fctlslm2umumsnu4 leomo io1opt luvslt srxo(rpno4amt  ictat  Drmx pou4tpeo fetlt a eln p (0 lxnmr iytopDeaues;t srxm(m ou1lp nmnvsltfarrmurpnu0tltomiciadlm2rlnmp;t4tltrxfcoy1lm e ivi;t)texrxopiy1om nlnetat) Dua(mpno1apx mo3tltfaDumn o;u) etnmfctatoa eln sl() eurir oudapte fvi t)srrrx onu0optn i3ildfm rm( o;t0 rtoirctotlmtrlu s s0 exr(r3ou4alenmnvs (fs2uaum ot0tetn ociadfm2ul(vont0aexrxo3oa1latrln s;t t2trio io1altnliei tfaDuaur no1opt moeiltlaDem(monu)texnxr oytfmD aues (0texm(r iy1ope  nei s  2uaurpnu1teenifeiyd s eau p;u4 eenmr3oadlp elues s) rxrxm nu1ol emncil(  rtmx pnu1aetomiciatlmDel( s;(0 eerxfctatlpDr ieil( t2xmirpoy1lpe lfeta(  Duaumoot1aee  ieiltla rau snu)arxoir tadomD  u s t0s2tmxo3io4om n fctlt  Dtru pnt4alenmieiytla emnmo ()tlxoxf3tatoa e u s;s0t2xo(mpiu1lptemici s a2uaxro;u1apt  ietltfa2rmnmp t4arermo3tytfmtranvo s trumxrpiu4lpt  ietlsf Dtmumoot1olxn iciltfm2ra(mp u) exoxr3to1fpDeau s;s trum(opoydal   nvilt  2tax  nt0optoifeiad mDelump;t4 ltnir to1la  aivs;s  rxoxr3iu4oleelfvi (farum(r oo1aexn fciltlmDum(vo;u)trxrmociatlaD  u sls s2trxr iu4opt mncslt  Drrx onu4tle  o3iysla ulu p;t0trxnifciadoaDe nvi;() 2ur(r nydomtelfct ()srrm( poo4texoioctyt aDulu s;u) ltomo iy1lp rauvo;s t2trxopnydll elfesa(fsrtrurp;t0oexomfctaslm elumo t0 rtnxo3oatoaDran i ()trto(o iu1opee nesls aDumxr ;t0apenio3ildlm uaumsn(0aetoxoctydfm  aivs (0s2to(r3nodoptnlics t) Dua( pno1olx mfetlsfaDumn o;(0trtoif tydfaDelneslt0s2umxmpoo4lmenmieslt)arraurpou0aee iociasfmDuanvsnt)teerxf oy1fp elivols s2trirpou1ape  ivt sfsDtaum ;u4oet mi3tadfaDelums;u0tlxnmfciy1om   nvs;t)setmxrpnu4am  liesa(f rtrur no1aptnmfciad m2em( o;u0areoif io1la  lues t s2trim3nudale mfetls aruru  ot1opxn i3iytfs rlnvs ()tlxrmocoatfpte uei (0 etr(r ou4lle mivsas) 2ra(roou1ape iieiatlm ea( p;(0tlxnmocoodfpDeliei s)tetoxm3iudlptn fvil() rrr( ooo4tet ifciltlaDemuvp t) eeoir3oatopt au s s)seur(r3iudamtemfvi s  Drmu ono0aex mieiysfaDuau s;u)aetnxr iy1lmtrlivi;( srxmxo no4apte ncs s) 2tru p;t1apt ioeiydlaDeanvsnu0alerxf3iy1op raieol(  eurxr3nu1op  mfciat) 2umurooo0tlxnmociaslsDemu pnt0arenmfctatomD  ivs;s) rxmio iudaleelfetat a2taump;u0oexo oeiasfm umn pn(0 rxomf oadfpD  n ils setmxr3io1llenlnetltf rurxr no0alx  oeils m eauvp;u4 ltnircio1lmDelivs s)srtoxopou4lmtelnvs s)a2truroou4ole mi3iasfmDua(vs;t) ltnio3oo1omtrai i;s0 eurxo3ny1lmen nvtlt  Dururono0aeto feiasls ua( p t4aexomrciodfat  ies;s0texr(o oy4aleelivs tfa2uau  nu0aexn fetadfmDrmuvsnt)tlenxocoytlp eluvils) 2umiopiodome livt sf Dta( o;t0apen oeiadfa2ulnvs ()tetomo3tytfmDr n i ( texmxo oydll nlfeia( s2tmurpoo0tex mi3tytla2rm(mp;(0tltnmo3oodopDelnvi;( truoxrpnodolee neia( arrrxmont0apt iiciyd a2um( o;t)altnxf ty1la eaueils)tetoxo iy1amte fcta() Dtr(mpnt4ape mi3iadfsDumu on(0tltrxrcto1la eaivi s) etmio3nydlp  lietltfaDrrur oo1aexomf3tltfa rmumonu0 lxnxr3oydlmDraivs;s seurim ou1aleelncslt aDtmu o;u1opt mfetatlm2umumo;(0 rerxo3tydfat ln il( s2uoxopiu4alt  nct t s2uaumonu4ale ifeiltlaDua(mo u4trxnxocoatoat aneslt)srxmxr3ny1lm nlfcsas  rtru ooo0tpe iiciysfm2emnmo;t4treoioctotoaDe ueo s sexmim iu4amee ivtasfsrra( o;t1aet iiciltfm ul(mpnu) ltnmfcia1fp e i i (0 exoxo nydlm emncs ( sDtax oot1altnifetytfmDumnmonu)areoiocoydla e i i s) eurio3nudlmee fvt t  2rm(r ;o4tpen feiydfs2emuvs;u4aetoxf iy1oaDranei;s  rtrio3ou4lpenlfci s)a2rrur ot1aptn octydfm2rmn o;t)tleoioctatfa r iesls0trxmio iy1lpte ivia(  rtmx pnt1oet  iciad s um(ms;u0teerircia1fatrauvil( srur(rpiu4lm   ivt t)sDuaxrpnt1tlt mi3iadfa2rln on(4 reomfciodfmt auvs;()t2tmio3iu1amte icta()aDua(ro;u0opeomieiytlm ranvp t)aetnmr iotla  aies;s)s2umirpnydlp nmfet t)s2rm( pnt1tpeoioeildlsDranmp u4 exniocoadomD li ils  rtrirpoy4lm  livtas a2um(mp;t4aptnmfeiysfs rm( o;u4tltnmo3oadfa rlneo t)t2xmxmpiudlpee fviat srrmumono1altnioeiadfm2rl( s (0altrio3iydoa rlivo;t)s2xmimpiu1llee fvta(f 2ta(r ;u4tex  f3ild s rlu ont) rtrxo3todlat lieo s)teurim oudamtemfcia() 2taxmono0oeeoio3iysfm2rmn p u)tlerxf oa1laDelues;(0t2uoir3oo1om e nci t  2tax  nt1apx ii3iatfsDemnvp;u0 exomo3ty1op e nesls s2xr(opnydoltnmfesa() rrax o;o1olen feilsfsDeanms;t4teeomr3iytfp rln ol( srtmir3oo4ameelicsls)sDtmx  ;u4alxniiciatfs2em(von(4 eermf iydfaDe ueilt)texmxr ny4am nlivi () 2tr( onu0tpe mieiadlm2elnvs t4treomf3ta1lpDraivolt sruoio ny4omtelfvtls aDumu o;u1oex  fciyt a2em(msnt4trenio oatlp eai o s)teur(mpiy4olee feslt) 2uau oou4aee micilslm uanvonu)tlerxr3iytoaDr nvsl() rtrxopoudamtnlnvt s s2ur( pnt0opx miciatfs ea( p;t0 rtomociatopteluei (0seuoxmpiy1opt mfct ()sruau oou1aleoii3ils aDem( ont4trerir3totoa  anesl()s2urxo3nudlm emfcs sfs2uaur no4tleomfeiat s uau s;(4aexnir to1op raueilt)srtoxr3iy4ll  lfvsasf rua(mpnu4aleomfciyt a elnmp;(0arxrxfcoatoaDraueils0teum(r oy1ame  fvi tfsrrm(root0tptoio3tatfaDuanvs;(0artoir3tatlmD  ivs t)trxrxopoudoltelivtls s2rmu ono0texo f3iat aDemn s () eeoir ta1oa eaivo t texoxm oy4ap n nvt ()arrmxr ;o0apt  oeiytfm2ea(vp;(4tlerif oytfpteai i t)srxm(r oodapee iesl()sDrrur no0ole  o3ilsfsDrm(ms;t)tlxoioctadop  aueo t0 etoxr iudlpe livsl(  rraurpou1aetnio3tlsfs emumo;(4aetoif3iadfateli i s)seumxm ny1lmtnlnetl(fs2rrurpot4aex mieiadlmDrmnms t)aeeoif ootom  livsls0trum(mpou4ll  licia()artrumont4alt  f3ilsfa2ra(ms;t)teermoctytlpD  n ilt0 eurxmpiydalt lnvtlt) rra(m ;t1oee  o3iys s eln pnu0 eeoio3ootlp ean s (0 rtoirpno1lm n fct (fsrra(m ;u1tptn feias aDrau p u0tlermf oo1oat  nes ()trxmxo3oy1ape mfvsls) Dur(  oo1apen octysls eaumpnu4tltnxf todoa eauvilt0 2tm(o3iy1lmen ietlsfsDtmx oot0texoio3tld m2el(vsn(0tleoxf3ty1lptraivsl( trtrio3oy4optnmncsa()aDtmx  nt1aet ifctlsls uln onu4teeomo3oatoatean s (0s2toir iy1oltnlfci t)artaxro;o1alxnii3tldfm rmuvpnt)tlxrxo3oadlmD  ivil()setm(o3oudaleemiei ()a2tru  oo0tpxo ietldlm2el( ont) exomr oy1oa rli i;( t2xmxopoudopt  feias aDrrx ont1ope io3tasfa ulums u4 lxnif to1la eanvo;t s2xm(m iu4lpe lfvt tfsDum(monu0olxn f3iad a rmnvs (0 ltrio3oatfpDr u il(  exoxm3oudolen ieiltfs2rrxm ;o1oltnmf3tydfsDra(msn(4 eenxr3tytlp rau s (0t2toir iydlmtelietls)aDuru  oo1apxomfetyd s um(msnu4aeeoif3iatlp eluvil(0tetrir ny1ol  lneslt)sruaumooo1tlxoiieilt sDulu p;u0artoir todoaDr uei;s trumxo iudolt mieil()srurx p;o0oeenioeiat a el(vo;u0 lenmr3oa1lm  anvo t0s2tmxm3ou4om nmivsat)aDtr( p;t4tetnii3iytls emnvp;(0tlerxo todla e nes ( texoio io1ol n iet t) rrr(rpno1ape  o3iytlm2emnvp;t4aetnxf3io1fpte ies;(  rtmim3oy1llt  nvi t  Dtr(r oo4aleo ociltfa2em(msn(0 reoif ootopDe nvi;s)srxm(r iudlltn iesl() 2rm( oot4alxoifeiltfmDuanvs;(0 rtoxo3todop eai ol(0 2umxopnu1omeelici sfs2ururpnt1ale mo3ildfs2uaumpn() renxf3oytomDrauvi;t)s2umxo oodllte ieta()aDtmxmpoo4aetnmoctls m2rau s t)arxoxo to1lptrlnvo t0 ruo(o nudlm  liesas srrr( p;u1teto ictyd mDeluvon(4tlxnif3iotlmt lnvi;s)s2umio3iu1opee ivtat a2truro;t0teto octasls eanvs;() exrmrcio1fp  aivs t s2tmxrpnu1omenmnvsatfs2umump;t0oleo ociatlmDem(mo u)areomocoo1lmD lnes;t)teuo(m3oodaptemicia( sDururp;o0oeeoiieiadfs ua(vo t) eeoif iodomDe ivo;t0t2xoio3ou1lle mivi sfsDuax pnt1opx ii3ildla ul(vo;u0altoxf to1fp rai o;() rxmxo no4llt miviat) 2uaxmonu1aptnii3ilsla2umu onu)texrxf oa1opte n o (  etoirpio1al emieilt  Dumxroou4ape iociad sDul(mon(4tlxoxf3tadoaDr u o;t) 2toxrpio1alenmiet tfsDrax pnu1tpx  ieiatla2elnvs;(4tltnmo3oadla eluei t)t2urim iu1ole  fvi ()sDuax  ;t0olt iieiat sDulnvo (0trtrxocty1lp  anvo;t)t2uoirpny1lpe licsasf 2uaxrpno1tetn fctatfa2em(vp (4trenxrciatfmDrlnvo;s0texmxr3iu1am nmfeils)aDtax ono1tptn ieildfmDul(mpn(0 eenxo ta1faDeauei (0t2tmir3ou1am emiei sfsDrmxr ;t0opxo ociysfa ua( p;t0texoxo iotlmDrliei () 2uoxm3nu4amt  neia(f Duru  nu0teeniiciyslm2rln p;u4 reoxo oodlaD  i sl(0srtoxrpny4omt  icil() Drrx ooo1oleo oeild m2ran s;(0trxrio io1oat ln i s0seur(mpiudlme lneiatf 2rr(mont1olxoioctat s2ranms;t)aexrio3iy1lp e nvo;( tetoim3nu1ape livs t arra( p;u1tptoiiciat a eauvonu) rxoxo iydomtr ieo;s) 2xr(o3iudlp   nct s)arrau o;u0oetomf3tyt a2eanmo;(4arxnxrctydlp  lu o (0trxm(rpoodal n nvtlt)artrumpou0teenmi3ias sDeanvont4 ltrifctytfp elivols)setoxm iy1lm nmfetl(f rua(r ;u1ale  i3tatfs em(monu4 reoxo oy1laDelu s t0trtmim3nu1apt  ieslt s2ra( o;o0aee mfeiltlaDrm( snt0aetoircoy1lpte ueo ( t2uoxr3iy4alenlfei tf 2rrx poo0aeto i3iat m2umnvon() lxrxr oatfaD  n o s)trum(m3nu4amee ivsa(fsDraxmono1optoif3iytfa2el(vo u4tetoxfcoatlaD  nesls0s2uoir3no4ol elfeils)srtm(rpoo1aeeo ieiysls2ul(mp;u0tlermf3iodfm rlu s;t0 2xrxr3oy1altemfcs s) Dtrx oot0tlxn ieiatla2ran o u0aexoxocta1fat ln slt0seumxmpoydalt livils)arur(  ;u1tltnmoctadls um(vp t)trxomf3oatfm r u i;t0 exmimpoy1lme mnct s srtaxrp;o1aexnmfeilsla umnms (0 etomf3tydopt aiei t s2xo(opoy1openmics (farrmu o;o0aexnioctyd a2ranmp u)aetnmf3oo1op  auei;t  rtmxopou4lm nmiesat)a2ta( pot0oeeo ocild s2ea(vs;t)teeoif todlaD lnvo ( teumxr no1optnmictls a2rrump;t4ape  ictatfs ean pn(4 eenifcoodopt  nvilt0teuo(rpnu1op  lnes sfa2rrx p;o1tpe  ictltfm em( p u0aleoxo todlmt  i sl(0teurxrpiy1ll  mfei ( aDuaxmpno0aptomf3ias aDemn ont4aexrir oatlp rlieo s) eumir iu1optelnet t)s2um(mpnt0teto feiltla umnvs u0 rxoxr ootfate ieol( teuoxr3ou4lme  feiatfsrraxro;o4aexnmo3iadfaDemn s;u)tlxomo3oo1fmDe ivs;(0setmxopiy1am  lietls  rrr(rp;o0ole  i3iyt s rm( o u)aexoir todlmDeai ol( seurio ou4lltelnctat aruaumpnt4opxnioeiyd s2ra(mpnt)trxnio iotfp  anes t) rurxrpoo1optemneils) rur(mp;o4altoiieilt s rl(monu0tltnircto1opDe ivol( sexoxmpou4ap eliet s)arra(r ;t4tlxomfetlsfs2eaumont)aeermr3ty1fa e n i s sruo(r oydam nlictas)s2ur( pno1tptomf3tysfm ulnmsn(0altnmr tatfa  ai i;( s2toxr3nodol n feias  rua(mont4tet mfctltla2ean s;(0tlermf3ta1fpte uvo (0srxrim3iy4al emieilt srrr( o;o4oetnmiciadfa elnmp t4 lerif3iytla eaivolt trxm(r iy1amenmicsl(  rumxr oo0oeenmfeiltla2el(vs;t) rtomf iytlpD lu s (  etrxrpio1ap nlnct t  rrau  oo1tpt io3iasfa eanvp t0alenif3oy1fm rlueslt0 rtrimpnudlp e iviasf 2taxm no4apxnifctas aDem(vp ()alenxr oatfatrlieolt) exrio iy4apenmnvsls)aDrm(rpoo4optn i3tlslsDuaumsnu0texoiociatlmD lneols0seumir3oodllte iei t artru pou4aeeomi3ilslsDumuvp u) lxoifcoo1omt aiei s truoir oy1am nlfeiat sDtrx o;t1texo i3iltfaDrmn o;t)tlxnxo ty1laD lueol(0srurir3iy4amtnlivt s  rrr(rp;t4tptoifctasfaDuauvo;t0tlxoio iytfa   ieols) etm(mpiudapeeliesas) rrm(rpoo4tet micild s2em(mp t4aeerir iadfa rlies t0tetr(rpnu4lptnlnetasfs2rr(rp;u1tpto ocias sDemumont0aleomf3oa1op r nvilt  2xmxr iu1lmtemies t  rrrx pnt4oetnio3tlsla eauvont0 lxoir ootomDrli ilt0tetr(o no4omeelivi t sDrmump;u0aetnmicildlmDuanvo;u0 ltnmf3iydla   iei;s  rxrxr nudom e nvils)s2ua(m ou0aet mieild mDumnmon(4 eeoxo3iydla r n ol(  2ur(r iy1lmt mivia(  Duau  ;t0tpen oeiys mDua( o;t0tltoxr ootfpteliesl(0seuo(rpnodom  lfesatfaDum( pnu4optomi3iatls2ulnmon(4 rtoir iatlpD  u o s  2trxm io4lle  ivil()aDtm(mpoo1tle  icilsfm rmu s u0trxomocoadop   u o ( t2urxr ny4omtnlfctlt)aDumur ou0tlt iocils mDumnmo;(0tlxoxr3oadfp eli i;s0trumxmpiu1lmen nctl(  ruax p;o0alxo iciys aDumnmo;t4tltoio3oo1lmtrauvsls0t2toim3oy4omeelict (f 2rr(roou4opxoif3iysls em(mo (0aexnmr oy1lm r u ils0sruoio3oy4lm emneta(fsDrmxrp;o1olto fciltfmDulnvs;u0 leoif tatlat lu s ( t2toir3oodap   ietl()sDtaxrp;u1tet  ieiad m ean s u4altoir3iodlp  lueols) 2xmxr3iu1llen nvsat) rra( ooo0aptomfeilslm emnmsnu0artoiocia1fm raiei;t  eurxm3nodale lnviatfsrtax ont4oee moctldfs2eau s t) eeoxfciodom  liesl()s2ur(m3no1om   feil( srrmuronu4optnif3iyt mDulumo t4treomocoo1late n o;t) exr(o iodlltn fciat)arrmxrpoo0oexoii3ilsla uln onu) lxrio3iotfm rai i;t0 ruo(o ou4lm emfctas  Drr( ont1tlenifciasfm2eln s;t)teerxf io1fptr ieo;t  2xmio3oo1lptemfvsa()a2tm(m ;o0alxnifctysfs2uanmo u4 rxrmo3iytoptraivi t s2tm(mpoudoptelfcia(faDta(r ;o4apeniociltfm2uluvp (4altrio3tydfpDe ieo;s s2urxm oo1lltemncsasfs2umur nt4aexnmoctytlsDrmnvp;t) lxnifcoadlpDr u sl()sexmimpoy1oltnmnvtls s2tm(r ot1aex iocildls2umuvp (4trtnirciy1fp   u o t)srxoxmpny4llenmncsl( sDtrurp;u4tlx ioctltla rmuvo;(0 lxoxrcio1lpD  neslt trtmim oudlpt livtls)s2trx oot4opt if3ilsfs2ra(vs t0tlxnxr3oy1lp eauvi;t0s2toio oy1lmenlneiasf Dumu onu1alx iociasfaDean s;t)tetrmr todfmtelueo;()trxrir nudll elneilt) 2rr(mpot1apxn feiat a2eanvpnu4arenir tytomt  iei;( texrimpou4amtnlfcsas srtaxmpoo0tpx  ieiytlsDul(ms u) ltrif oydfp r uvs t)t2xr(m3oydolt mncs s arurum ot4olx mi3tyt aDrmuvo;(4teenxocoo1oa ran o s) rxm(r3oy1ole  ivt (faruaxr ot0texn fctydfa uaumo (0 etnxf3tadfmt livi;( s2uo(rpio4aptn ieiat)s2uau oot4apeomoctytfm uanmsnu0 renir3iydfp rlnei s0s2toxrpiu1alee fcs s) Dtmxmp;t0oleomf3iytlm ranvo u) exnxrciytlm  lu olt s2uoir no4llenlfctat aDra(rpoo4opx iiciyslsDeanmpnt) exrio3oadfp e i o s)s2uo(rpnu4lmt  nct () rurum ou0tet  fetyslmDrmnvonu) eeoio3tytlaD lu il( tetrio oy4lm n ietas aDtru p;o1tetn oetltfa2ul( o t)trenio3oatfpteai i s)t2uoxo oo1ome lnesls)arua(m ou0aeeomfctatls2rmnmon()trxrmrciytfptran olt t2uo(o oo4ol emfvta( srururp;o0oleomociasfmDelnvp u4aetrmf ia1op   nei;t)teur(m3no1amtemfvta( aDrmuro;o0aetomieiys aDrluvo u4tlxrirciatoptr nes;s0trxo(rpoo1lmte fcsls) Dtrx p;u1olxnioeilt sDemnvs;(4 lxrxrcoatlatraueo t) etrim3ny1apenmnesatfaDuax ono0alx ifeilsfa rlnvo (4 leoio iotlaD ai s;t0 rur(opiu4op  mfeia(  rtmxrooo1apeo ietasfs ranvon(4 exomo tatlat ln i;t0t2toio3no4ameelfei t)srtrxr ;o0tlt  fciydlm ua( p;t)aexomf3io1la  aneol(0trtm(rpiu1lpt mfvia()sDum(mpou4tlxnmoeilt mDrmums;t0 leoxoctadfpt  neo ( s2toxo3io1aptn ncia()a2tau o;o0aleoioctys m2ra(mp;t)texnmfciytlaDeli s t0 2xm(m3ou1amenmfcsat s2umu o;o0oexn o3iatls ean pn()tltnxr oo1lmDeaueols0 2xoim3oo1ap   fes s)a2taxmp;u4tleoifcilsfm2ranvp u) etomf iydfaD  ues t)t2xrxr3nu1ap emfvi ( arrr(r ou4aetn fciydfa em(von(4trxriociy1lpDranvo ()t2tmxr iodom elnetas) 2tmurono1alxn fciat m emn p ()artoiocoy1oa   ies (  rxmir iu1apenlicslt)arurumoou4aex mfctldlm2rmnvo u) ltomocty1faDeai ilt trtoimpoy1omen fcsa(fsDtr( p;o1oleomietatla rmnvpnu4 rxrxo3iadfm elueolt)s2uo(r oo1lltelnct s) Dumum oo4aee ii3tydlaDuluvo;t)artnxf oy1latr iei;(  etm(o iudlltnlfct s s2tax pou1oee  oeiat mDel( p;(4aetnxo3ty1fpDelneo t0 rtrxmpiudlp  miet ()sruru onu4oltn f3iad m2emu s t)tetnmf3oadlpDe uvs;( texoirpiy4lp nlnei tfaDua(m ;t4tlt  fciltlmDul( snt0arxoif io1fm   nvo s texr(rpnu4alen fcs tfaDumu p;u1oltomo3tltls2ra( o t)trxoxf iy1lmtelues;t texrxr3iu4amen fvtlsfartax pot4tpxnioctysfa rmnvp (4 rtnxo iydlatrlu ilt0teuoxo iy1al n nesls srumxm no0olen ocils mDrlnvo u)aeerir3ta1fmDr ieo;s  etrimpou4om emncsat)arra(ront1tleomociydlm2ea( o t0trxrmrctadoa raivslt0 2trxrpou1lpen fvt s  2uaxm oo1olenii3tlslm2ea(vp ()arxoxf todomtran slt trtriopnudlpt  fctasfsrtaum no0olxomo3tldls2rm(vsnt4arxnifcoa1oaDr ivil(  eumxm3iodlmen fvs t aDrrxmo;t1tlen o3ilslsDul(ms u)aeeomo3totfa eauvo;( t2xmxm3nydlme mfei sfa2tr(r oo0apx ii3ild a2ua(mo t0trenio3ia1omDrluvsls)seurio nudom emici t  2rmxmo;t0apx  oeiadlm ean o (0tetrircto1fptelies;(0 rtrim iodlpenmfctatfarum(mono1olxniieiyd mDra( s;t0tetomo tatomt anvo s)srurim3nydomeelncilt aDua(ro;u4tpenmietls a2rmums;(0tlxomf tadlmtrln ol(0 rum(m3iodal  mieta( srurx  ;o4ale  o3ilt mDem(von(4trxrxr3to1la r ivs ()trxrxmpnudap elfcil(  rtrumpnt4olxomf3iasfs ul(ms t4arxrio oo1lmDelivo () exoim3ny1lle mictatfa2taxrp;u0apxomfetadlsDum( snt0texomfciytomtr iei (  eumxr io4lpe  nvsa()srra(mo;u1aexoii3ildfa ulums t4tlxnio3ootoaD aivols0t2triopnudll nlivi sf rrm(rpnu0texn ieildlm2elu o;(4 eenmf oo1oaD livs ()s2urxo io4opte fvt tf 2tmu o;o4ope ioeilt s rmn p;(4aeenxo tydopt  ueils t2to(o oo1om  lnvsltf 2ra( o;t1opxo iciadfm umn snu0aeenmr oy1fa rlueols)srtmxmpnudap n feia( srtm(mo;o0tle micild a emu s (4altnio3oa1oat aues t)t2uoio nu1apt mfvi s)aDtm(mp;t1apt  fetldlm2uaump;u)tlxrif3iadla e neilt t2tr(o3nydame miciatf Draxmpou4ale  ociad sDel( p;t4aexrif oy1opteluvils  etr(o ou1ape lictl()aDrrum ot1aetomfetas m ea( s;u0 exnir3oytomtr ues t)tetr(m oy1ol elieias a2tm(mp;u1tlx iieiadlm2eau sn(4arxrxrcootfat  nei ( teuo(o iy1opte fci s)s2tmur no0oeen ociad sDrlu pnt0arxomr3ty1lptranei ()t2xmio3io1lpee nvtltfs2rmumpou0apen octld mDea(vs u) eeoxfcoadlp  lnvi t0trxm(rpou1am nmfctltf Drmum ;t0apenmi3ias s2rmnms;t0 rtoxr3oa1fpDeln i s0truoir3iy4am n neiat) rtrurp;t0tpt io3iltla2umn sn(0aeeoxr3tytlat luvo;t0srtmio iu1op   fvil()aDurx ono1aptomicildls2rm(vonu4 lxrifciotla rlu sls0 exoir nu4ome  fviasf Dta(m oo1tpx ioeiytla rmuvo u0tetrmr3oodomt au i;( setrxopnydol nlfcsasf 2ua(rpou1apx if3ildfa2rmuvp u) ltnmf3iatlaDelnvs;()sexmxrpnodalenmnei t)srrrxroot4tlt  ieiadlmDuaump;u0 rtoxf iydfp   n sl(0srtmimpiodame mneias  2taxroot0aleomfciadlm uanmp;u)alxoir3oatoptelu olt)s2uoio3nudlpe mncs s)a2tr(m oo4texniieiadfm2em(vs (4 rxoxfcootom   neils) 2xmir3oo4optemnesa( aDrrumo;t0apt  ieiys aDuluvsnt)tetoir tydoptrauvo (0srxr(m3iy4optn fvil( arta(mp;u1oexoii3iat s2rlnvonu4tetoxr3tytomtr i ols  rxrxr nu1om  mies s) rtmum nt4tlx  oeilsfsDean snt)aexnxoctatlat  ieo;() 2urio3nodlptn nei () rumx ooo1apxn f3iltfm ua( o () reoio iydla   i ol()seur(mpoydalt lfcsltf 2tr(mpoo1alt moeiltla em(mp;t4 etoxfcio1fm r nvi () 2tmir3nu1opeemfct s srrauroou0tet if3iadlsDea( pn(0 lxoxfcoy1la   uvs;s0seurxopio1lm  lneilt)a2um(m oo0olt moctatla ra(vsn(4tetrmoctodfpDeaieo;()s2xo(m oydam e feil(fsrur( pou4tex mietldfm rmnms;u0aeenmo3ta1fmteli i;s0sexm(m3no4optnmfetls sDurxmoot1tpx  f3iydfs emn snu)texnir oo1oaD ai i (0 etmxm no1lleemicsat)arumx pou1tpen feiydlaDrau p;t)trxrif tatlaD  nei;s0 2xm(opoydapeemnct tfarra(moot0aeeoiictadlsDrauvo u4tlenmrciytfptrli o s) 2xrxo3oo1openmics ()artr(ro;t0ape  ictysfs2uaumonu)teerxocoy1lm  livo;()tetrxr3oy1ame livtasf 2tm(  ;u0oleomfctadla2rln o;u0arxoxf oytlaD ln o s) exo(o nu4lm  lict (fsDuaxmpou0olxo f3iysfm elnvs u0teenmr3ia1lmteauvil(0setrio3ou1aptemfei ( a2uax oou4tlxniiciytls rln pnt0texrmrcoy1oate i i ()s2trxrpoo1optnlici s srrax ont4tpt  ietyt a2rmnmo;(0 exriociytoatrlneo t setrxrpiodomenmnctas arrrumo;o4tpe ifeias sDum(msnt4tltrmf oatfpD li o;s seur(r3nu4ll n nvsat sDum( ooo1altn o3iysfs2rmump;()trtnxo3oydoptraies;t0 eumim3oy4ope livsatfsrtr(  no4opxo f3tltla2emnmpn(0trtoxr todlateaivols0 2uoimpnu4ape mivs (fa2rmx pot1olx  i3tatlm ulnvo (4alenir totopDeanes ()truoxm3nydolt  ics s)srta( pnt0olx iociatfaDran on(0alxoxr ootlmDr ivo;() etoxmpiudam  micil()srtru o;o1tpeomf3iyslm2ranvo;u)trxrxr iadlmDrau s s0 2tmxm3iodomt  fvi t aDta(  oo4tpto fcilt s2eaums;(4aexoxo3oadla   nvs (  2urir3ou1ope livsl()sDrrxm ot4apeo fetadlm2rm(ms;u) rxoifctytfpteanvs s s2xr(r3oy1opt mivsat) 2umx p;t1tlx mfctldls2umnvs;(4tltrxocootoptr i o s t2toirpiydllt  fcilt  Duaxm ;t4ape mociadfmDuan p;t)texnif3iydfpDr nvi;t  exmir3oo4lpt  fvtas srrrur ou0texoiiciad a2umn o t4tltomf iatfpD li i;s)t2xoxm3iy4lm nmnvi s  rur(rp;u1olx ifcilsls2ul(vo;() rtnxrciatoaDeanvs t0truoxo3iy4op   fcsls s2rax poo4oetnmf3ils m2eanvsnt4areoxo3oodoa raneil()trxoxrpny1opt lfetls artmu pnt1aleomieilt sDul(vs;t0 lenmo3iodopDraueilt)t2urim3oy1alenlivtltfsDtm(r ;u1oleomieilslaDra(msn(4 ltnifciotlmte neol(0sexm(r iu4am nmncilsf Durur ;u0apx  i3iad s2eau ont0trtrxfctodfp  li s ()teurxm3iu4ol nmnvs ()sDtrx o;o4tltoiicildls uan o;u4trermf3iotfpDrli i;t)t2urxm3iu4lmtemnct sfa2tmumooo0aeenio3ilsfa2ul(vs t0alerio3ta1opDeanei t0trxrio3iu1llee ici tf rtr( poo0opxomoctld m elnms u0 lenio3iytlate nei;(0seumxr3oodlltnmicta()s2ta( o;o4alxoii3tltfm2ulu sn(4tltoif3oatfmtrlu s;t0 rumxopno1op nlnesltfaDtaumonu0tpt  o3iys m umn o;()tetnmo tydfpt  neo t)trum(rpoo1lptelics t aDrmxm nt1alt ifetasfmDumnvon() eerxo3iodom   iei ( trxrim no1op elfvsat aruaxm ou4apto feiysls2emn o;(0aexoiocoadom ean il(0 etr(r3ny4omeemivsas  2urump;o4tpxo ociydfm2elnmp u4tlxoio iotlaD aivolt0teuo(mpnudapeelivt sfsruax o;o1olx  ociysfs rau snu)alerxfctotfmtrlivi;s0sruo(o3ny1omeemfcsls sDta( pou1openii3ildfa2uanvo;()tltrxf3oa1opD ai s;s) rxrxmpiu4llte fvil( arra(mo;o0tltnmociatlmDrlumo;t0alxoxrcta1faDr uesls  ruo(mpoydlm emnet s s2urxmpoo1apx miciltls2ul(mo;t)aexoio3oodomDeluvo;( trxr(m no1optnlivsas) Dtrx pot0opxomoeild sDrmn o;t4alenmrciatopt li ils) 2xmio ou4ap  mfviat) rra( o;u4aee moctad s rlumsnt)tlxomo3oydom   uvslt  exoirpiudol  mfci s)aDurx  nu1tet mf3tatfs2umumo u0tleoxrctytlmDr uvol( tetrxr3nodom  mfct ( a2tmxmpnu4oltniiciatfm uaumo u4 etrxrcootlp  lnei s trtm(m3nu4op e icslt srua(mo;t4tleomietytfm ranmo;t) exrif3tytfpD an s;()setrir oy1lltnlivt s a2ta( p;t1oltomictadlsDeln s;t0 ltrif3oy1om e i o;t t2xmiopnodlle lfetls) rtaxrpnt0tee  f3iatfm2rl(vp () exnmo to1fmDeaivs;(0s2tm(m3nudllenmivt (fsDumxr oo4teenmfeiltlm umnvs;u0aexrmr3iydfmteaivi t s2to(opou1ll e ieiltfaDuaur nu1opxoioctydfa el(vo;t4tetoxrciatfmDean s;()s2xmxopiy4lle lfei s srtmxr oo0opxnii3tat m2uln on()texnmo totlmD livs t) 2xoxmpoydlpeemivsa( s2tmx onu1tptnmoctyd a2ra(monu4arenxf oytfpt li s;t0 2xoimpou4ap nlncils sDtau pno0ale iictydlm2rluvon(0tlxnmf totoat li s;()s2trimpno1amtemfcta(  Durx oou0opxnmociadfa2eau o;t)tleoio3tadfa elies;t srtoxopoodlpe mnetatfsDua(rooo0opeo f3iysfs2um(vonu0artrifcoytoaDeaneo s0 rxoim3oy1lmtemfes s arurxro;t1oltn octldlm eanvp u0tlenxo3tytom e nei s0sruo(mpiu1lpt  iviasf rraxmo;u4altn f3iadfs um(mp u4arenxfcto1faDeln sls0sexrio nu1ame mivtls)s2ta(rpno1altomoetls m2ea(vo (0tltnmocia1lp  ai s;t0 eurim3iu1op e nesl( a2rau  nu4altnmiciyt s eaumsnu) etrmr iadfatelivi s)s2xmxmpno4apen fvt t s2tr( p;u1apxoioctldfa ea( o t0altoif3tadlpDrau s;( teuoimpnu4am  miciat  Drmu pou1tetoif3ilsfs2uau p t4alxrircoy1fpDelueols  2xoxr3oo4oleemfci t)aDrmxmo;o1alt ii3ilt m2umnmo ()tetnio3tadoatelneols)trum(m3iu4ap n nes s) 2raxm ot0optomoeiatfs el(vs;t) eenxr3iy1fp e nvs;t0texo(m3iy4oleelivt s)aDum(  oo4tlt mf3tyslsDra(vp u4 etrxrcoatomtr uvi t)sexmiopoydlpen fcs sfs2rruro;u1olenif3tatls elnvp;u) renxr3iy1fa eanvo;s0 rtrio3nydamtelncslsfs2umxm nu0tpt  f3ildlaDeanvon(0 exomrciatfpD ln s;t0srtr(m ou1aleelietas artaurpnt4tlt ioeilslsDuauvs;() rxnxf todlptrau s t)seuoxm io4optnmncsa(  2uaxmoou4tlto octys sDul(mp u) ltnmr tydomt aneo t t2toxm3io1alt mfesa() Dtaurooo1oexn ieias mDemnvp (4aleomf iadfm   n i s)s2uoio3iodam n fcia( s2uax pot4apxn f3tysfa umn o;u0 lxnmfcty1oaD  u s ( s2xmir iu4lm n neta(fsrraxrpnt1tptnmo3iat mDrauvs u0tltrxr oo1la  lnvo;s s2trio iu1lmeelies () rrruro;u4oetn ieiltfmDrmuvp ()tlxnmr oatlm e uvsls0 etoirpny1altemnesltfa2rr(rpou0oex mieiasfs eanvp ()arerxoctotfpteluesl(0trum(r3no4om e nctl(fsDumur oo1oltnmfeildlmDrmnvo;t0 reoxociytlmtelivo;(0 rum(r3iy4opeelieia(  2rru p;o0alxoioetltla2el(vpnu4texnxr3oydlat luvilt  rtoxmpio4amt lncsltfsDrm(m ot1apx mf3ildfsDulu s;()alxnir iy1la eaneils  ruoio nu4lm e fvsl(  Drmxro;u1tltoiociydls2ean s u)tetnxo3iodoateln i s  rtrxopiydap emfes sfsDrm(mpou0aee ioeias s2ea(vonu)aeeoxociotom ean s (0t2urxm3oudal emiesa(  2uaxmoot4altnioctadlm uauvo t) exnir tydop e iei t0 exmim iy4om n fvsl(fs2taxm oo1apxo i3tltfmDrl(ms;(0 renif iadfa  aueol( trto(r io1llt  nctls a2umxr ou0tex iietlslm ra( pn(4 etomr3tadomtr i s;( srurxopiy1op  mfvslt  Draur ;o0tpx mf3tls mDuln s u0tlxomf oa1lpt  n i;t trxm(m oydomeemnct (f Dra(mp;t1ape io3tyt m ul( s;u) renmo ia1op rlivi;t)t2xm(rpiydoptn iei s srua(m ;o1ape  fciysfaDemu p;t4aexrxocoytopt lnvi;t0 exmxmpiudoltelnvia(fs2raxrp;u4tle  fciltlm2ulnmp;t)alxniocoo1op rlnvi;()teuo(o3iy4lpe micias)srumurpot1apxnmoeiadls rl(mo t0 lenxociodfmtr neols0sexoxo oo4alt lfcsas)aruaxrpoo4oleomf3iatfsDrauvpn()aleomo3tatlmtrlnei t0setrxo3iydole  neslt)aruaxronu0opto f3tadlm2ra(vp;u4aexnmf totoaDrliei s0 2xr(r iydlpenlicsas)sDrru oot4aptoii3iasla ul(vs ()arxnxr oytfpDeluvols t2xrir iy1ape lncsa(faDuax  ;t1olenmi3iysls ul( sn(0arenio3iydlat ai i t s2trxm ny1olt liciasfa2rrxrpoo1tpx ioeiytla umu p;t0alxnxf3tadlaDeluvs;t) 2xr(r nydal nlivil()aDrrump;u1altoifctasfmDelu sn(0areoxrctatfpD aies s t2umirpnudal  lnesl(fs2urxrpnt0oeenio3iysfa2rlu snu4 ltnxf oytoa eai olt)trtmio3iu4lme  ietl( a2umu p;o4tlenifeiydls2rl(mp t)areomr3tytfptrli ol( srurir3ny1amtelfct tf rtmxmpno0ole io3tltfs emums;t) lxnxrcoo1lmtr uvslt) etoio3nydamt livt s) 2tmur ;t1tpen ieiytls2ea( s;u0 rtomfcootfm rau il() 2um(m oo4ol emnvia()s2tru pnu0ole ifcildlm2rlnvp;()alermf3oodfmtran o;s)trumirpnu4ap   fvslt sDtrx o;t1tlxnmictlsfa ea(mpn()artnxociatoatelnvi t teum(mpnu4aptnlnct t)a2umxmpno1tlt mo3iatls2emn s;(4 rxomfcto1fa eanvols  rumxm3io1lmtnmfvtas  2taxmp;o1oleoifciyt aDuau s;t4aeeomf oa1la  aieo ( setrxm3oo4omen nei s  Dur(  no1teenmi3iysfa rauvpnt0aetnxr3iytlmD anvs;s0srxrxo no4alt mfviat a2ta(  nt4oexnif3tytlm2emnmp (0aeermf oo1omDeluvo;t seur(m3nodlpe livslt  Drmu oou4apxnii3ilsls em(mpnu) rxnxf3io1om e uesls0s2um(o oo4ame mnct s)a2trumpnu4aetomi3tlt sDraumo;u)treoif3oatfmt lnvo t s2urio iu4aleemiesa()srrr(  ou1tlx ii3iatlm2uaums;t0aexnxrcoy1op  ai sl()texoio iodam n netl()a2tau pnt0alxomo3tad s rl(monu0 leomr ootfaDrlnvil( setm(m oodap emics ()a2umumpoo1tee mfeiatfm uau s () lxrxf ia1fpDr i o;(0tetmim nu1alt  fesl(  rta(ro;o4tet if3iadfm2emn s (4trxomoctodlmDe i sls setrxr3oo1optnlnvta() rumxrpnu0tlx iociad sDran s u)tlenxrcto1omDeli i (0srxoxr iy1om elnei ( aDrm(rpnu0aee ii3tysfm2uauvon()teermocoytomtelivsls0trxrxm3nu4alee nvsasf rraurono0oleomo3iyt m2rl( p;()tltrmrcta1lmt aivi s0t2xoxmpiodlp emivtas)sDtau  nt4tee  oetadfsDea(vsn(4treoif tadoaDe nvo;t t2tmir iodll   nctat) 2urumpou0oeenifciad mDul(vp t)teerxf3tydomD auvi;t)trxoiopnu4omtnmnvsls)sDtru pnt1apen i3tytls rm(von()trxomf3oa1laD  ivs;t trto(r3iydll   nesa( s2truro;t0aeenmo3iyt mDemn p t0 eeomr iydfpt ai i;t)t2xr(r3oudomenlfvsat)s2rru  ou0teeoiiciytfa rl( snt0alxrir tytfp eai il(0 2umimpnu4am n fvtl(fa2ta( pot4altn oeiys s2ulnvo;u4 lenio3to1opDeauvo ()srtr(r ou4apt mivs s  Dtaur no4optomoctytfa emnvo;(4aeenxf ta1omt  ues;t tetr(mpno4lme mneiasfsrrrx  ot4optoioctyd s ulumo;(0teerxr iy1oaD auvo t0t2um(m3iy1ol elnctas artru onu4olt mfciatfs rlump u4aeeomo io1lm  liei;t)seuoim oudam  mictlt) rrau ono1olx ii3ilsfm2el( p;(0tleoxf iy1oaD an s;s0trxm(r3nu4ap e ncta( arumump;o0oeenifciasfa2rl( sn(4 lxoir iotopte ivs s0seuoim nu4amee ncsls sDtm(m ot4oltnifeiysfs raums (4 eerirciodoatrli ols0t2uo(r nu1omt  fcsa( arra( pnu4ole mo3tysfm umn s;t4tlxoif3ta1fpD lnvols)trxr(r3oy1lp nlfcslt) Drrxmpnt0altomiciys s ea( s u) eeomocto1la  aivs s0 eum(m3ny1al e iesl() rtmx  no0aeeoifcils s2elnms t4trxnxr iadla e ivi;s)seum(opoy4optemietlt) rua(mpno1olenif3iydfa rlu snu0aexrifciydopt  ivslt) 2uriopoo4apte ivi ()artmx oou4aeenmociatfa elnvon()trenmr3ia1oa elies t) exr(r nudlpt mfetl()aDuaum no0oleoif3iadfm2ra( o t)arxoxr totop e nvo t  etm(r nodamtnlfvsa( s2uax ooo4tetnmociyt mDrluvs (4 lxomr iydoat aivslt0setm(rpoydol nlics ( a2rr(r no0oeenii3iysfm2ran o;(4 rtnxocia1fp ranvi;t0 etoxm3nudlleemnctls) Durxr ;t1opt mfciltfs ul(mo;(0 rtomocoa1fmDelivsl()t2umxrpiydlleelfcs t artaxrpoo1ale iiciydfsDemnmo (4texnirciadoaDeln i;t0s2tm(mpio1omeelnvsa()sruaxroot4tltomiciys aDel(vp u0 lxomo3to1oatr u ols0t2toim3nu4lmenmivils artmu pot4tpe  ietydfsDrl(mpn()aexoxr ta1fmDe nvilt  2xo(rpoo4ap  mfcsas sDuaum no0ole mietatfaDuln pnu4alxoxocoa1lmD  ivs ( s2urxr3iudam e fvi s)srtrxmo;u4apxn oeiydla uauvp;t)altomfciydfatelnes () 2xoxo nu4lptn fvia( s2umxm ;u0tlxoiiciydls rm(ms u0 rxrmo oy1lmt  n o;()trtoxm nudopt mfeiltf Duaum ou1altomo3ils m rmuvonu0 etoxfciodfpD ln olt)trtr(opiy4ll elfcs sf rur( ooo4ape ioeilslaDemumo u) ltnmr3tadop elieilt t2uo(m iudapenlnvtlt  rtmxmpoo1olen f3tlt sDrmums u4 lenircoo1omtr n slt)texr(o3io1op   fvilt s2rauroot4oltoif3ils s2ua(vpn()tlxnif3oydomt ai s s seur(opiu4llt mfvi tfsrrr(m no4oltomoetas mDrauvpnt0trtrmrcoodfp elues;t0 2xo(r3oo1llte ieil(  Dtrxmpou1oetn feiydls2rlnms;u4artnxrciodfat  i ols0trtmio3oy4lm e fesat s2uaxr ;o4ope  i3iatfm2rlu s;(0arxrif3ootoate n sl() rtoim no1lp   fctlt)a2rmx pno1apenmfciadfmDra(ms;(4trxrmf3oytom  lnvo t)setoim nudole  ici () Dua( pot1opxnifeiyt a rluvs;u0alenmr iy1oaDelnvils) etr(r io4llt  fcs (f Dtrumo;o4tptn oetltlsDuanvo;u)tltnmocto1op rau o;t trumiopiudaptn iei sfarua(r ;u4tlen ocilslmDemu s;(4 etrio iytomDeli sl(0t2uriopnu1opeelnvs tfa2rm(rp;t4aetomoeiyslsDem( p u)alenxo3oydomt auvs s) 2xmio oo1apeemfvtlsfs2tr(mpot4apt  ietat s emu s;u0arxrir3oatopDr u o (0 etoxr3oo4al   ncsatf rta(rp;o0oee  oeilslm2eln o;t0teerifciodfa r ueo t)s2uoxo3iy1op nlnvi tfaDum(  nt4oetoifeiysls rlnmo t)teenmrctodomD lnvslt) 2urir ny1om nmfctlt artaur oo1tetoii3tyslaDeanvp u4 etrxo3to1fp eanvs;s)t2um(o io1alt  nvil(faDrm(mpoo1tpe mf3iydlm ea( p () exrmociodlm r nvs s0truoxr3oy1op nlivil()aDrr(r ;t4aleomfctat m um(vo;(0teerifcoa1fmtrlues;s0 2ur(m ou4opee ivsas)srrrxm ;o4tpxnmfctat mDelumo t)tlenirctatop r ivi ( trtoxr3oydameelnvilsfsrtmxm ;o1aee moeildfa2elnmp;(0teeoxociytom  lnvo (  rur(opiodomeemfvs t arraur nt4apxn fcild mDrl(vo;u4tlxrmf3tatoatrlivo;s0s2urio3io4oltnliesls  2urxmpou4apxnioeiltfs uau p u)trxoif to1op eluvi () rxmim nydomtnmfcsl( aDtr(rpoo4tlx mo3tyt aDumump t)tetnif3oodomDeln o;s0 2xrxrpiy1ame miciatfsrtmxro;o1tpxn o3iyd a emu p ()tlermr oydlaDr nvs (0 2uoimpiy1lptn fetatfsrurxroou4tlx  fciytlaDulnvs;t0alxnmfciy1laDrlu o;( trurio3oydopt lics t) rrmxm ;o0oleo fetydls2ulu p u4arxrmo3ootfaDrlnei s0sexoxr oo1olen fei ( aDrm(m nt4texn ociysfs2eau ont)teerxrcta1fpDr u olt setmxrpoudlp
\ No newline at end of file
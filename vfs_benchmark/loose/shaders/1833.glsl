@@ -0,0 +1 @@
+ies;t0 rur(r ny4lp   feta(fsruru p;u0oexn octlt aDelump;u0teeoxo3tadfa rai o (0t2trio iy1olt  nei ( arrrurpnt0aptn o3tldla2uanmp;(0texoxo3oodlmDraueil(0sexr(o3iy4lm nlivsat)srrr( p;u0apeo o3tldfaDrluvsn(0trxomf ty1fp eauei;s)seumxr3oo1lm e ivtas)srtaxr ;u1alenioctysls2eanvp (0treomo oo1oate ueslt seumxmpno4lmee ivsas) rtmxrono1teto i3iydla emu pnu0trxnxr oadop  anvo s  2xr(o3ou4ol emivt t)arra(mpou0opt  ieiasls2eanms t)tlerxfcoo1omtr nvo s)t2xrio3nudapte ncsls) rumxmp;o1aexnmfcildlsDelnmpn(0texoxr3oydfpDr ivs;t  2xrxmpiudope  icil(fsrrmumpno4aptoio3tls a ul(msn(4 rxrmrcoodfp eli sl( teum(r3ou1lmeelfeta(f Drrumooo1oeeomictas aDrauvo (4alenxo3ia1fp r i o s  rxoxopnydamtemfesat  Dumxmonu0open f3tydfm2ranvonu0 rerxr iotlp  auei s0teto(mpno1lpenlies t  rra( pnu1tpx io3tls a uaump t0arxoxo3oa1fmDraivi s0texoir3oodoltnmnvtl(f 2raxrooo4apto f3ild m2ulnmpn() renmo3oy1fatranvo t0 eto(o3iu4omenlnet tfaDua(rooo4optnmo3tatfm2rm(vo;u0 eeoif3oodlmDr ieo s) 2trim3nydop elfcslsfaDtr(ronu0tpx mieiytfs2rmn p;t0 renxrcoadomteln ils s2to(opiu1olenlfeta() 2urx poo0apen ieilsfmDrmu s u) ltnxr tatfmD  i i s)tetoir3ny4ope livtat) Duax o;t0texo o3iadfm2uanvo;()teenifcoa1lmtean s ( tetrxo nodlm elicia(fsDtmxrp;o4apenmiciasla rmu pnu) rxrxf3iatoatrlivs;t)trurio3iy1llt mnvt ()aDumxrp;u1olxnmo3iltfm uaumo;t)aexoxrcoo1om r n olt srto(r oodap  lnvslt)srrmx onu0oetoioeilt sDeauvo;u0 etnxr3oatlpD ln ols)teur(m oodaltnlfvt s)srrrx o;u1tpeo ieildfs rm(vp;t0alxnir tadoptr ies;t texm(rpoodalee netas aDrmx  no1oexomf3tadfm2elnvo u4 exrxo oy1lpteanvol(  rtoirpou1openlnctasfs2tr(r ot1olt mociltla2rlumonu4 rtrxf3oytom eln s;( t2tm(mpnudlm nlfviat)aDtrumont0olt mieiysfs2rlu p t0 rtrmf tatfpDelneo;s  2tm(m oy1altemfvi tf 2rm(rono1tlxo ietys m um(mp;u)artrmf ta1omDe uesl(  rumir3iodaptn ici tf Dtaxroou0olxo fctlsfa2el(vsnu0 ltoir3oatla elivi s) eumim3iydap  liesas  Dtm(mp;t0oex  i3iat s um(vo u4trxoxrcta1lm eauei;(0setrxopiudopee ieiasf Durx poo1aeeoio3ias s2ua(vsn()tleomo3oytlmD au i s s2tmir3oy4ll nmneta(fs2um(mo;o4ope ioeiyt a2rl(von(4aexomo3iydfmDrli s t0srtm(o3oy1aptnlnct t  Dtaumpoo4tpxoifeiysfmDul(vo t)tltrmo3ta1faD aueslt0 2uoxm oo4lpeelfcta(  rtmu ont4oeen o3tlsfsDel(vsnu0texrmfcoydlat lnei t0seuo(m3oo1omenmietls aDrm( p;t1opt ifeilt aDumu s (0alerxfcta1fat  iesls  etrxo3nu4omenmfvtl()arur( pnu4aexo ociadlsDrmnmp;u4tetnio3oo1oateluvslt)srtrirpoo1ap   fctas)a2uaum no1teeo i3tltfs ranvp;()trxrxo io1fmDeluesls)s2um(r3ny4lp  lnvta()s2ra( ont0ale mf3tat m2rl( p;u0aetrmo3ty1faDelieo;s)setm(rpnu1lmte ivsa(f rra( poo0texo oetlt s2umn s;(4teermo tadlpDranei;(0s2umiopou4apenmietls)arur(root1opxo ietad aDea(monu4 lxomo3oatlp r ieol()trxr(m3oodam n ncsa( artmxrpoo1tpeoiietltls rm(vo u0trtoxr iy1fpDeanvi t)trxrir3nydlmt micsa(f 2rm( onu4aex mociasfs ulnmp t0tetnxocoytlptranesls0s2tmxrpiydamt lnctasf Drrx  nt4oeto feiytfs raums (4artnxf oa1fa  lieo;( s2umxrpoodalee nvta()s2umump;o4oetomi3iysfa2ranvo;(0 rxoxr3oytla  ln i;s)tetoir3iy4lpenmnvsltfa2rr( poo1tpto fetadfa2eau s u)alenircoo1op r n ol()trtrio3iudomenlics sfs2rm(m ;o0tptoifeilslmDraumpnu4arxoiociy1fm  li ils)s2urxopio1ll nmfvtlsfsDtr(ro;o0oex ifeild s2emnvsn(4trenmf3iytomDrlu olt)t2umim io4lp  mfctls a2rmurpnu4tlxo octld aDea(ms ()tlxrmf3iytlm e uvil()sexoio3nu1ape mncsat  Drr( p;u4tltnifctld s2eanmo () exoxf iytfpDrai o t0 2xr(o io4lmee icslsf 2trxroou4tetoifciys a2emump t4tetrxfcoydopDrai s (0srxm(o3oy1ope mnei t s2umx  nu4openmfctasfa emn s ()trtnio oydopDr u ols)seto(m nydap   feta(fsDur(r ou1texnmieiydla uaumo;u0 ltoxr io1fa  li o;s0trxo(o3ou4ll elies ( arrr( p;o4aee mo3iltfmDulumont4 etniocta1fa  anes;s0seuoir3io4omtn fet (fsrtaum oo4tpxn fciytls ul(mo;t4teeriocoo1opD  i o s0 rumim3oo1apte ivsls aDrm(rpoo1apto ieilsfmDrl( o;()tltomfcoatfm r uvs s  2uoimpiydlm nlnct (  2um(rpnu1tlenmiciadlaDum(vo () ltnxr3to1om rluvi t setmio3iy1am   fcsl(fa2ua(mpoo1oexoifeiydls2rmnvsnt4tetomociadlmD lnvo;t0seuoxr oy4ameelfvta(faDta(mo;o1apxo i3tysfs2uanms (0 eermf3ia1op r uei;s0tetmir io4amen fvt sf Dtmu ooo4olt  o3tatfa um(vs (4aexoxoctadom elnes;s0seto(o oudllt mfes t  2trxmpnt0tpt  fetat a ul(vs;u0 rxrifcty1lp  li s t seuoxo nu1omeelnct (f rrr(m ;o1tetoioctltlsDemnmp;t4 ltomr3iy1opDeanvo;t s2uoxr no1lmeemicsl( srtru pnu4oee iiciad s2emuvo;(0 rxomr iytoaDeau s;(0srumim no1lmt lfeil() Dur(r ;o1apen ictat a2rlnms;u0 exrmf tydfm  lues;t0t2urio3iu4lmt lneil()a2ur(r nu1tltn i3iadla2rm(vsnu)arerxocia1op  luei;s  etmim oy1opt mies ( a2ta( oot0tpe if3tad sDelu o;(0tlxnmocootlatranei s) rtr(m3ny4omtnmnvsas)aDrrx pnu4opt if3ilt a2emump u4 etrxo3tadfp rau s;s setmxm3oydamtemivia()sDumum ;u1opxnmo3iaslm elnmsnt4trtoxo ia1fa elieol() rxoxrpnu1lpenmnetltfa2ua(mo;u1tleo f3iasfaDuaump;u4aeeomo3ootlpDeauvs;(0s2xoxo nu4om nlfcsas aDrax ooo1tleoioetaslmDranms;u0texnxfciytfa  livi ()teumir3iu1amtelncs t arua(rp;t0alxnmo3tld a eluvsnt)aetrmo tytfaDeanvsl()trtr(mpiu1amenmfvtlt sDuaxmo;t0tpeoiicild aDumumpnu) exrifcoytom   neilt  rtr(mpiy4alenlfcsasf rrm( onu1olxnmfeiadlmDelnvsnu0 eerxrcoydla e uei t)sexrio3no4lptnlfetls aDtr(mont1tlxo iciydla2umnvs;t0 leoxrcoa1opDrlueolt  2urxmpiy1lpe  ivtlt) 2rmxm ;u0aetnmfeiys a ulu s;u4tlxnxr oadfp eaieols)texr(r iodlpeelnetl(  2rr(mo;t4ale  ietytfs2rl(ms;u4 eerxr iytfp eau o;t0 exm(opoy1lmee fct t srurur nu1olx if3iad aDrlums;t0artnif oo1fpte ivsl(0srum(o ou4lptn fvtl(  rrmx  oo4alen fetytfaDulums u4 exoxrcoatla  lu i;(0sexoxm3iy1ol  mfctls)s2uru oou1tpxomo3iadfsDranms u4tltrmfciadfp rlnvils t2xrir iu4llt licsat)arrmur oo1tlxn oeiltlsDulu pn(4arxoir iotomtrluvo s0 rurxrpoodoltn ies t) 2umur ou0oee if3iyslmDrlumpnt)tlxnxoctatla r uvil()setmio ou1ome  fcsa(f Duaxrpot1openmi3iasfm umnmon(0 lenxr3oytfp   n o;() rto(o3nodalt lfvia(farrm( ono1ape io3iasfs rl(vp;t)trxoxf3to1fmtr nvs s t2xrxr3nu4lp nmivtlt)a2rrxmooo0tltn fctas a2ulnvsnu4trtomr iadopDrai o;(0srxoio3oy4opt  nci ()aDtr(m ot4tee mfctad s2ul( s t)trxnmocty1omtr nei s setrxm iu1apt lict s srumurpoo0aeen feiysfsDrmn pnt4aetnmrciatfp rlnes (  eum(mpiudom e ivi s)s2umx onu0aptnmfcilslsDem( pn(4arxomf3oadoa e ivs () 2xoxo oo4lmeelfciltf rtrumo;u0aexo ieiasfm ua( p t4aexomo3oadomD  uvo;t)srxrimpny1am n fcia()s2rmx o;u4alxnmociydfs2uau onu4aeenifcoa1oat ln ils) rxoxm io1ll emncta(fartrur oo4texo i3iasla ul(von(0 etrxr oatfpD aueo s) 2tmxr3nudaleelnvilsfs2taxmono4oeeoif3tas m ul(vo;(0aetrxrciy1fmt aivs;t)srxmxmpio4ol   fct (faDrru  ;t0opeomo3taslsDumu s ()aleoir tydlp   nvs s0t2toio3ou1lpe mnct t arua(  ou4tetnmiciltla ul( s t4 etnxr tytlaDeauvi;(0s2xr(opnu4lp emfei (fsrtmxr ;o0aptn f3iatfa2rmn pnu)aetoxf to1lmteauvslt trtm(mpoy4olte fet (fsDuru p;o0tle  feiltfaDelnvs;(4treomr3tatfmD ln slt)s2urxo no1ol n nctas)aDumurpno1alx mfetlsls2rmn s u4 renmr3tytfa eanesls) 2xr(r no4ome mietlsfartrxm ;t4tpeoifcils s elums;(4arerxr iytom rliesl(0s2xr(r nu1omtnlnct s artrur no1tlenifciat s2rmumo t)tetoxo tydlat aivs s0tetmxopnydope lfvt ()aDtaum oo0tpeniictlslsDuau sn(0tlermr3todla elivolt)t2uriopoy4ap   fctlsfs2urur ;u0tpx miciadls rl(vp t0 ltrmfcio1op r n i t)t2um(m ou1lmteliei s aDtm(root4optoiiciltfmDeauvpnt0 exnio iotfm rlnvslt sexoxrpio4amt mivils) Dumu pot1aee iieiyt a2rau p ()texoio3tadomD lu i;t0srur(o3nodolt mnct () 2urx pnt1ale iicildls2eanvo u0 exomo totlmD ai i s)texmxopoo4om elfes t) ruru ont4alenmo3tadls ra(ms;u)aeenif ta1fpD lueslt0seumirpou1lmtn nvs () Drmxm ot1tlxniicilsfa2ranvp ()texoxo tytfpDr uei s  etoio3nu4lpteliesa() Dumxmpnt4tpt ifciatla umnvp (4alxnirciotfm ran o;s)srtoirpoydop   nct ()aDrm(mp;u1alxnmoeiadfa ua( s;(0arxrxoctotlat ai o;t)seur(o3oo4lle  fvt (fa2ururp;u1ole mictadfs ua(mp t0trerio3totoa raueols0tetrim oodoptnlnci s)sDra(mp;u0tpx miciltfaDum( o ()alxnif oodfpD ai i;t seuoxr nudamte neil() 2tr(r nt4oee moeiadlm2ua( o;u4tlenxf totoa eau s s0s2xr(rpnu4omenlneiat) Dra(r nt0tpxo i3iytfa rmnms;t4alenio oatlmtrauvols)s2xo(mpnu4alte ivt sfs2uru pnt1alxomfetyd aDrlnms u)trtnmo3oy1omt lu i;( s2uoir3nu1ll emnvs tfa2ua(rpnu0optniociysls2rlu o (0 rtnio iadopteaieol() exo(o3no4aptnlnei ( s2uaxm ot1aptn f3iltlaDranmp t0aeeoiociatfmt  uesl()trtoimpoy4llt  ietas  2tmxr ;o1oeeniiciytlm2rl(vp t0 rxrif ia1fmDeluei t0teuo(o oudllee fciat)s2rm(mp;o1opt mf3tld sDranvo t4 rtoxo iydlpDeli o;t0t2urxmpoy4lpeemfei s  2ua( o;t0aetn f3tat m elump;t) rxrxocio1fptrlu i s0s2trio oudlm  lfvtat) rur(mpnt4apt moetls a2rlnmon()arxnmrcootomtraivi;s teto(mpnu4lpe lneilt)s2ururo;u4tpe iieilslm rluvo;()alerxrctotoaDe uvs ()s2xo(m3oo4am emfctltfartmx  oo4tet  f3iasfaDuanmo;t)tetnmr3oodfmD auvo;(  exrxmpio4ll n netat  2rau pot1optnmo3ildls2um(mp;t4texnmfciotopD aies;t) eur(rpoy4ll e fesas)a2um(r ou0apenmociad a2ean s;t0teeoif oytfatr uvi;()setmim3no1am n fvtls a2uaumooo4oet if3iasls2rmu s t0aeeoxr to1lmDelueo;s)srxmxr3io1ol nmfet t)a2raurpnu0tltniieiysfa2umump (0 lxrmo tydfptrluvo;(0trtoxr3ny1lme mneilt  Dtaxrpot1tlxo oeiys sDua(mpnt)tlxrmr ia1lmD ln i s)seur(mpoodop  lfeil(faDuaum ;o4alxomiciadla2el( o;u0 rtomf3todfp eaneo;s setr(o3io4llenmiesltfsDrru p;u4texnmoetaslm rlumsnu0altomoctytlp ranvi;(0 2to(mpou4apeelivi s aruaur no1oexomieiasfmDulnvs u) eeoxrcoydoa  lu il( texrxm3nodom   ictatf 2rm( pot1oltomicildlaDran onu4 eenxf iydop raieo;t) rur(o nu1om   ieilt a2taxroou1opxnmfeiyd m ua( snu0teenif oodlp  ln slt0srto(r no4lmtemicia( a2rm(  nu0altoio3tls a eluvs (4tltrxo iatoa ranvs;s  exoxo ny4al elnei s)arur(rono1tlxomiciyt aDrmn s (4tetrif3oytomDr i ilt0teum(mpio1ll nmictls aDuru pno0alx if3tasfsDua(ms;()trtnmr ia1om elies ( srxoir io1amenmfeslt arrr( o;u4oex mfciaslsDumnvs u0 exoxf3oytomtr ues;s seur(opnu4lp  lfctlt) rur(  ;t4teenifeiltlm2uln o;u4 etrxocoadfmt luei s0 2urirpio1open icsat)a2
\ No newline at end of file
@@ -0,0 +1 @@
+neil( seurir iy4om emfeslsfsDtmur nt0tet ifciaslsDuan sn(0 lxnif3iydfaDeanesls)teumio ou4lpe liesa(  rtaumo;u1oetomiciad a um(mo t)trxoxocty1oaDeauvi t0trtm(m3iu4lltnlnci (  Duax onu4ope if3iyt m ua(vp ()trtrio ia1oa raiei;s0s2xrxr iy4al  lfvsat) Dua(rpou4alxoio3iytla ran ont0 rtomocoodlmtelu il() 2xrxrpoo4alee fes tfsruru p;u1aptomi3iysfs rl(msnt0trtoxo iytfa eai o t0s2urir3oy4openlietltf rumuronu1opxnmfeiysls rmnvs;u4arxoif3oytla elnvi;t)trur(opou1apeemici (  Dum( o;t0teto i3iatfs um(vp u4trtrmocoadfaDe uvo;()trtr(m3nodlm e nci s)s2tmur oo1aexo oeiatfaDranvp;(4trerxf oadlpDrauei s  rtm(o3io1oleelfcs (fsrtrumo;u4opxoiiciaslaDelu p;u0alxoxf to1oaDr u ol(0t2to(opoo4lm nlfeil()srtm(mont0alxoiocilsls em(msnt)trtnifcty1lmDeaivo;s t2umiopiudol nmnesasf rua(rooo0tlxomf3iadfa rl(monu4alxnio iotfa   u i;t0s2xriopoydomen ncsas  Drm( ooo0oee mfciyd aDemnvsnt)arxnmr ta1fatrlies;() 2um(rpny1llee ivsl(f 2trumpnu4tptoioeiltfsDea( s;u4alxrxf3iytom  an sls truoiopiu1omt lfvsat)a2rr( p;u0olto i3tlt a2rlu on()texnir3iadop eln s s0 2to(opoudlmeemiesls)aDtaxro;u1oex if3tlsfsDuan o (4 rxrxr3tytlmD an ilt0trtriopny1lpt livi sfarurxroot0texomfciltla2ulu s;u4arxnmo3io1fp raivs s)sexriopny4ll n nvslt aDuaxro;t1tet  ocildla rmumsn(4trenircoy1fpDeaivs;t teumirpoudlle mivi tfa2ururpoo4alto f3iat a rm( p;(0trtnircoytlate uvi;s0srtoxmpio4omen feiat)a2urx pno4tetoif3ildla ul(vonu0texoirciatlm rln o (0srtrimpoudapeemfvtltfa2ur(r ;o4apeo octad mDea(mp;t4tlenio3iadom eauvi;t0texrir io1olte ivs tfaDumx  ot4tee ifctad s ul(vo t)tltniocty1lmDelnvs s) exo(r oydap nlnvsa(f 2ra(m ;u1tpe mo3tldlm umump;t0alxoxrcoy1omDrlivs s)srtoir3iy1op  lfet (f 2rm( ont1aexo ietasla um(vo;() renir iadla  anvsls  exoxo iodamte ici tfs2ta( pnt4teeoioctysls2uau o ()trxoio iydom   nvslt0t2uo(o3ou4openlivs ( sDtm(  nt0tptnioctadlmDea( s;(0artnmo to1lp rlivi s0trxr(r iy4ol n fvia(faDrau o;t1olt ifctytfsDeanvp (4teenxrctydfm eanes t) 2tr(o3no1openlivi sfaDtmx p;u0openmieiytfaDulnvpnt)arermf oydlatelnes ()t2uriopnudame  ictlsfsDua(ronu0teto o3iltla2ulnms;()aetnxr3ootlmDr i il()srxoxr3iy1llenmiet (  2tmxm nu1tlx moetld m ea( s;t0arxoxfctodoaDeln i;s  ruriopiodlpenlics s) rtax pno0ape if3ild a eluvo;t) eenmo iadfmDrlnvs;()t2trxr nydape  feilsfa2rrurp;o4tpx  feias a2uanmon(0tlxnmoctodoaDeau ilt teurxr oodam emncsa(fsrtm( oou0oeenmf3iatlmDrm(mon()teerxr3oodfatranvo;()s2tr(rpou1apte iesls srumxm ;u1aptnii3iydfaDuan o;t4tltoircoo1fm r ivi;s)setoxopoy1amt mietat)s2tm( p;u4tpxn i3iad a umnmpnu4alenmocio1oa rlivsl() rtrimpou1llte ncs sfaDumu oou0tle  i3iltfmDrmump;t0treomf3oydlm e ivi (0 rtrxo iudap  miesltf 2trur ;o0opeoifctldlsDrmn p;t4 rxnxfciatlpt an il( tetrxm3nu1ll   nes sf 2ur(rono1apxn i3tld s umnms u4aexnxr3oydopDr nvs;(0trum(r3iu1lpenlieiat  2ua( oot0opt mociltfmDrm( onu)altrmo3ty1fp   uvi;s seur(o oydape lfci (fa2tau poo0apt miciadlm elnmo;t4 rtrir3tydlmDelu sl(0setr(m3iu1lpeelfvilsfa2umur ot0oetomociadfs2emuvon(4 exoxrctydoa rluvs;(  rurim oo4ape  net t  Duax  ou0aptnmfciytfa2ra(von(4altrmr iytfptelnvi (  rxrxr3oy1lmtnmfeia(farrrxrp;u4opt mfctad m ea(vs;u)tleoiocoatom raneo () rumimpnu1ole lfciat)sDtm(m ou0tpeo i3iatfsDrm(mon(4areoxo3oydfp raivi;(  rtr(m nodll nmieta(f Dur(moot0ole iociytfs2ean pn(0 reoif oodom  lnei;(  etr(m3iodaltemnvtls  2tm(rooo4teeo icilt s umuvpnt) ltoxrctodfa eau i;( sexmxr iy1lmenlici tfsrumx poo4aex mfciydfs uauvp;() eerxfciy1fmDe ueo t0seum(opnudapeelfes s sDtmx  no4ole mfeiasla uanvsn() reomrciy1fa  au il() etrxmpoodlle liviltfsDtm( ono1open f3iys s2eluvo ()aeerif3oydla  au s s0trtoxo iu1lltnlncsls a2ur(  nu4altnmfeias s uauvonu0trerircia1om elu o t0sexmirpoo1aptelieiasfaDtm(mo;o0optn f3iatfaDea(mp;t4aeermf tydlmDeaivo s) etoxo nydol emivs ( aDua( ooo4tlenifcilsla2rm(mo t0trtomf oa1opt ai o;t0s2umimpny1lptnlfeilt sDua( pnu0open o3iasla eauvp;()teeoxfcia1fpt aiesl( texr(m3nudalenlnvs s)a2tmumpou4apen fciasfsDumuvp;t)arxomo3tadfpDr uvi s texr(r iy4oltn ncil(fs2ra( pot0oeeo ietyd s uln o;t)aetoxfciytfm rlnvo;(0 rxriopnu4lp nmivils) rrm(mp;o4tpe mfciasfaDemn p t0alerif tytlptrai s;( srxmxo3iy4lpen ieia()srua(mooo4tle  o3iytla2eluvo;(4tltomr iotfm r nvo;s  eumio3iodlp e fct ( a2trxr ;t4opeomi3ilslmDua( pnu4aeeoxr3iydla rlnvolt)truoimpio1olte ictas aDua(r ot1oet mictyslm2rlump;(0aetoxf oo1opt  uvsls trtrim3nu1oltnmfvtasfsrra(  nt0opto fcilsls2rm( p (4alxnxrciodla eluvilt0s2xoxo io4lle lfvi s) rua(m nt4tle  feilslsDul(mpnu4treoxociodla raneo;(0t2umim3ny4lp nmncia( s2taur oo0tpt  oeiad sDraums t4 lerif3oatlm rlneo t0s2xrxm3oudameemnci ()sDrmxm oo4olenioeiysls emuvsnu0aeenif oa1oa r i sls)setr(r3oy1om  mnvslt)arta(rono0tpeoiiciadls ranvo;u0 exoxr3tydopt  u ols)sexm(o iydlmenmivils)s2uau  ;o1opt  f3tyslm rlu snt) ltomf oadlpD ln ilt)s2xrio nu1lmenlfvs sf rtr( p;t0olenmo3tatla2eanvsnt) etoxo3iotlm  anvils) rtmxm3nodlltnlictlsfaDuaumo;u4tle iieiaslmDea(vo;()tlxrmf iy1oat ai ols0t2um(m3iydapenlieta(farra(mpou0oexoiietlt s2eanvp (4alerircto1op eaivi s0 rumxo ou1ll n fes tfa2ua(mo;u1oeeo fcild a eluvsn(4 exrxo3todlaDelu slt0srtrxo3oudolenmncil(f rrm(mo;u0tlxnmoctydfs2rl(vont0treriocto1op eauvi (0t2xmir iodll nmncil(fs2tr(m ;t1oleoio3ildlm2rmuvo;t0 lxnircoa1fpDe ies;s0srto(r io4aptn fcs tf ruru  ;t1tee mf3taslm2ul(vp;t)tltnmf3oodlmt lueol()texmxm iudapen fvs t a2tm(mp;t0teto iciltla2eauvpnt4trxnmo3tytomD  i i (  2xmxrpoy1al   feia(  2umxmonu0optniieias m el( s (0tetoirctodlmtr ieo ()teum(opnudal e nct (f rum( pot4aee  ictytlaDemn o u0arxnxf3iydfa  lies s)tetoxm iodlp e fei sfsrrru oou0tlxomfciadlm emu pnt0texoif3oo1oate ueo;t0srtr(rpio4opeemfeiasfs2ta(ro;t0ole iietytlm emn pnt4aexrxfcoy1oaDranesl(  2trio3nu4olenmfviltf 2tr( o;u0aleo iciydls eanvp t4 lenif ta1fm   ivo;(0tetr(o3ny4ape  neia(fa2rr(ro;t1oexo fetysla eanvs t4arenmf3tadlm  lueo (  2toxmpiy1om nlnct s) rur(mpnt4aleomicildlm2em(vp;u)alxnxfciydomDeaivi;s0 2urxo3oy4ale liviltf Drmx  no4apt mf3iytfaDumuvsn(0 lxrmrciatfp e ieo t setrxmpoudoptn ncsl(faDtr( pno4oeenifctatfaDemn s t4 etnmr iodoateauvsls)t2tr(opou4om e nvs ( arrmu  ;u0aeenmfetas sDrlu p ()tleoxo oatoptraueols)trxrxo nudomtelnvilt s2ta(rpot4tlxoiictls s2emuvpn(4artnir3iadlptr nvi t0seurim oy1altnmfet tf 2trx  ;o1oeenio3iad m emu s;(0trtoxoctytfmte n i;s  2xoir3oy4am e nvtls)arrm( pnu0aeto iciysls2rl(vsnu4 rtomf3tadlmt aiei s0 2umxmpoy4om  lfci ( sDrrump;u4tpt mi3iyslm2rmu s (4artrirciodlaDrlu i ( seumxo3ny4aptnliei t  rumxm nt4tetomoetld mDrmnvs (0aetoxr iy1oaDe ueils  eumiopiu4amt micsa( a2uax  ;o1tpt  ietys m2rln snu4trtrio iadlpteliei;s)teurirpno1al elnvslt)arua( pot4tlxoiieiatfs2rmnmo;t0tlerio iodopt lneols) eum(r3nydllen ici t)arrmxm ;t4oet mi3tat sDra(vsnt4tetrxo3iy1fmtrau ol(0teuoio io4om  lncilsfaDur(mo;o0texomoeiadfa2rl(mp u)alxrir ty1fpDrau o ( s2uoir iydlle lnvsas s2rauro;u4aexo i3ildfm2ranvo;t) eenmo3oo1fpDrau o;t s2trio3oy4lptemiesltfsDta( pnu4oet ifeils m eau s t0aleriocoo1laDrauvol(0s2uoim iy1alen nvsl(  2uaur ;t1tltoiicils sDua( snu0tetomr3oa1om e uvo t  2umimpiy1lpt  fvslt)a2uax pno4oetomfciytfa umn on(4 ltrmo3oo1lpt au o t  rxrim3oy4lpe  nctasfaDrrumpot1texomi3ildla elnvs (4arenif oy1lpDe ivi s0seuoio iu1amenlncs sf rta( ont4alt mfetat aDua(vpnt)texrmr3ty1oatr uvi;()t2xoim iu4altn icta( aruax p;o1teenmociaslm ranmsn(4artnxf3iodlpt an i t0srumxopoo1ale lnvsl(fa2umu pnu1tltomociaslm uln o (4 reoxfcta1opteln i;t)t2urim nodale licsasfaDurx  no1tleniicildfsDrmnvonu4tleoifcta1oatraneols0truriopoydllenmivia()srumumonu4tlx iieiysfm2ean s;(0aeermfcto1lptraieslt srurxopoodlp elicsls srrau  oo1tlx mi3iysls ua(vpnt0trxrmo oydlaDrli s s  2tmxrpiy4lpenmnesa()arta(rono1aptnmiciydls2emn onu4 rtoxociodlmDelneo;t t2trim no4ap   nvslsfs2rm(rono4oee  i3tatlmDrm(vsnu) ltnxr3oydfm eli s t t2toxmpnu4lmeelfciat  Dumxmooo0apt iiciasfm2eluvonu)treoif3to1latraiei;t  rtrxopno1am nmnvia( aDumxm nt1apeomo3iadfm2ua(vp;()arerxfctytlp r neo;s0sexoir nudopenlnviltf Dtau p;t0tlxniictltlm2elnmp u4 lxoio tydoateau ols)texoxm iodapt lfesa(  2urx p;t4olxoif3ild mDra( o t)tltomociotla eauvs;s)sruo(m3oy4lpe lnvsl( artrxmoot0oet mieilsla rau p t) rxnmfcoadoa eaieo t0sexr(mpnodopen fvsat)a2taump;o1texoiieilslm uauvon(0 eenio3iatfpDelu s (0s2uoxo3oo4lmtnlict sf rtm( p;u1teeoioeilsfa elnvpn(0artnir tatfa  auvslt0 eumxm3iudol nlfei sf Drrumpot4oltn i3tyslm ul(vo;(4altnif oo1lpD lnvi (  rxo(rpoydome lfetl( a2rr(r nt4altniocild sDumnvo;u)treomf oydoaDelivils texmio3iu4alt  feslt)a2tmu p;t0altn ieiadfaDranmo t0tleomo3ty1fa  lnes (  2um(r3oudomt  net (f rtax  ot4oee ioctadlm ulnvp t4 leoxrcoatlateli ol()seuoim iy1lme  fctlt)s2uaxmo;o1alenioctysla ea( ont0aexnif io1faD li ols0texrxo iodlmtnmfesl()sDtr(  ;t1aeeo i3ildlsDuaump t0tlerxoctytlpDe ueslt0 2toxopiudol nlfctlsf 2ta(mo;t1altomoetld s2rm( p (4tetnxo oo1laDe ueolt0trxrim3oo4om n ieias  2rmuront4olxnif3iytlaDelnmp;u4teeomo totla   ueilt)tetm(rpiu1lmt lfviatfs2tm(mp;o0tlxnio3tydfaDea( s;u)altomf oa1oa rlivi;t t2umxr3iy4llt  ncta(f rum(mono1tlx mieild m2rlu pnt0texomrctadfmtelnei t0srum(o3iy1ome lnct tf rtrumo;t0tpen feilslsDumn s (0tlermr io1fpDrlues s0 euo(m oo1amteliciat)s2rau onu0tlt ifeilsfm2uln sn() rxomf ty1fp elueo t0trur(m nu1om   ivil(f Durxrpot4oee iietysfs2ranmp;t0 ltrxr oadlm   uvslt srxm(m3iy1opt mneta(f Draxmp;t4oet iieiatfm rmuvo;t) exnmo to1oate uvs ( s2tmir3oydom  livs s a2umxrpoo1aptomf3iasfs uauvpnt4texnmo iotfpDrli i (0 exm(opno4ome  iesas srtru o;o0aet  i3iydfaDrmnvon(4tltrxrciytopD auei;s)s2um(o3nu4lmenlnviatfa2urxr nu0apt ifeiatfs umu o u)aetoir todlm r uesl( teuoim3iu4am n ncsasfs2tax p;t1tlenmieilt a2rlnms;u0aeerxf tatopteanes;()s2trirpoy4opee fes ()s2rm( ont4ope iictlsfa2rlu s t4 eeoifctydlaD lnvs t s2urimpou4omenlfvs s srtr(  ;u0tet mfcildfaDulnvp u0 lenxfctodlm rlivs;s teum(m iodlmt  fei s)s2tmxm ot1opto fetldls el(von(4aeerifciadfa e ies s0srtmxmpoydoptelivtl( artax  ou4oet ioeilt s2uluvpn(0tlxomf iadoa   i o ( trtoxrpnu1ll elivsasfsrua(mp;t0tpeoii3iasfs el(mo;u0 eeomrciytomDr ivs;s)texr(mpiu1ole lfcsat  Dtmx  ou0oee mo3tasfm2ua(vs u0texoxrctydop rlivi t  ruo(mpoo4om nlfcta() rrrurp;u0tleniociytla rl(mo u4 lxrmf3tadoa e i o t teuoimpoy4lptnmfviltf Dtrxmooo0opxoioetat sDemnmo;u0 eerir3to1oat  uvo (0texrxm3ou4amte nvsl(fsDrmurpou1altomfciyslaDumuvp;u0tlxrifcoatfpD  uvo;t)seumxr iudap  lnvsasfsrtaurpot4altn ieiad m2ulu s t0 rtrio oa1oa raieilt0setmim ny4oltelncilsfaDraump;o0apt  octldlm2ulnmo;u) eeomfciadlp rauvi;s)seur(rpiu1lmeemfviat sDtaxmoou0aleo oetld s2eluvp;(4aexoio oy1fptr ieo s)trxoio nu4ol   iei sfaDraxm ;t1oltomoetydfmDem(von(4aeerxo3totfpt  n s;t)srumxm3iu4ll  liet ( sDrr(rp;t1apxoifciadlm2rmn p;u)artrmrcoydlm e u ilt)tetrxmpoo4alenlfctlsfaDraurono0altomo3ildlsDel(ms;u)tlxoif iodom rli slt0sruoxrpiu1lpt livt s)aDuau  no0alt  i3iydfm2em(vsnu0 etoifcto1lpDr ivsl() 2urimpiu1lle  fes (fa2rrxmp;t1optnioeild mDuluvs;t0artrmf3tatfat luvi (0 rxmxm nydlptemfvs ( arra(r nt0aeenmfeilt s2ul(ms u0trenircta1oa rlies;()trtm(o nudamt  ivil(fa2raxm ;o4tltn o3ild s rmumo;(4alxnmo3iytlptelnes;s  2urxopny1lltemivilt sDurumpnu0apxo feildlm rmn p t4 reniociatlm eaiesl() exmimpoudame mies sfs2umum ;o1opxnifciltfaDelump;u)tetnmf oy1fateaies s) euoxrpnu1lp emfcslt  2um( ooo4aeenmo3tasfs2uan s t4 renxrctadomDean o;t0texoxo oy4ll n nesl(f rurx onu0teeoiieiyslsDumu p;t)arerxo3oa1lp eli s;t0s2xmim3oydam elneils)s2urur ;o4ope ifctytlaDemuvs u0tlenirctodlmDeln o ( sexrimpny4oltn fctatf Dra(r nu1altn oeiytfaDea( p u4texrio oatfp rlivslt)s2to(r3oy1ll elnvil( srtr(r no4alen octasfs ulump t)arerio3todom  an o;t0s2um(opno4omeemictl(faDur(  nt1tpeomiciytla rmnms u4 lenmf oy1omDe ies s)trurimpiy1lltnlfei t)s2um( oou1tpxo ocild s2rm(ms u)aexoxr3tatfpt  nvi t0tetm(mpiy4amtn feias) rraxro;t1optniietysfm el(vont0 rtrmr oytlm   nvslt  2xrio3oy1lme mieiat aDtr(root0aetomi3tasfsDumnmp;u0alenxr tatfp  anvi ( texmir3no4apee net t) rumu  no1alt io3iadlmDra( p t4altomo oydfmtr n i;s)texm(m3oodaptelivta(faDrmuronu4tpeo oeiyd s rmu o (4 rtrxrctatfp eanvs;s0setrxo3ou4alenlieta()sDtax pou4tltniiciatlaDrmuvp (0aleoxo iatfaD aivo s  2tm(r io1om e nei (f Drmumo;u4tltoiociatls um( p u)tltriocta1omte ivo;(0srum(r iydam nliet (fs2taxrpno4aee  o3iad m2umums;t) eerxr iodoa eluvol(  rxm(mpoo1opt  ivtl()arrrumpno4optnmieiytlmDeaump u0aexoiocia1lmt lnes;s0 exm(m nu4aleelfct s  Dta(  no1olxnioeiatlmDem( snt4 rxrifctytla  aueol()trxmimpiodlmee fvt s aDurum nu0opxomf3iadfa2ul(monu4 reoio3iatlpt luvi;s0 2urim3iy1llenlicslt)sruau  no1oltoif3iydfa2emu s t)alxnxr3totlaDrln o t)seumir3oydopte ietlt  2rmx p;u4altomfeiytfs ua( pnt0arxrif3iy1fat auvo t0srxmiopoy4apenlfei s aDrrum oo1aet mociat m2ran p u)tleoxr tytla  ai ilt) rur(r ny1oleelfei (  2rmumo;o1alxnmfctysfm2uluvs (4aetrxf ootfat au ils tetmxrpnudolte nei ()sDtmxroot1tlxo iciyt a eanvs;u0 lenircio1om r n ils tetm(opoodlltnlfvsatfsDuau onu0ole io3ildlaDranvo;t0 etnif oadoaD an olt)tetm(opoudalt  nvta(  2trxmooo0aex mo3iytlaDuauvsnt)arerxociydfm r ueslt  exoxm3iudope mict ( aruru  ;u1oleomi3tadfs uauvonu)trenio oadlatrlu i ( setoxr3oo4amte ictltfs2ra(moot0aee iieilt s2ulumo u) leoio tatfm e nei t) 2xoimpno4llt lfeils aDurum ot0openmoeildla rm(vo;u0aetrxf3oodfp rau ils  2tmim oo4omenlnes t)srrmx pnt0ope  feilt sDrau onu0areoxrcty1fpDraneslt  2tr(r iudom e ict (f 2tax pno1texo f3ildlsDeau pnt0 ltriocoa1lm   uei;t)t2uoxm io1lm nlfvs (  2tmurpnt4tlx  i3iad s emu o;u0 rxrxo3todoaDrln s s  rumim3nudalenmfvsa(f Dtm(mp;u1tlt mi3iyt m2ulumo;u)tlxnmf3oatfptrluvi;t srxoirpnydalen ivsat)a2rmur nt4oltoiietas aDulnmp;()tltrircio1oa eaivslt)tetoim3iodape  ncsl()a2ta(mpnt0teenmi3iydlmDumump;u4 rtnir ty1fmtrlivo ()trtrxo3io1ap e ieia( srtmx  ot4opeo ieiltfs2ulnms ()tlenmr3iatlp rauei;()srxmir nodomt  neilsfsrra(rono1oet iicilslsDelu snu0 lenmo iodla  li s ( texm(m3oo4ll  mfvi t)aDrau onu1tleoio3tlslmDrlumo;u0trermr3oo1fpD aueil( trur(r3iy4lm nlfvil(f rtrx  ot0apxomieiasfaDrlumo;(0tltrifcootfpDe nvil(0 etoir oudlp  licsat  rtmxrooo4oee mo3iasls2ran o;t0aeeoxf iy1fa raies;()trtr(m ou1amen ictatfs2rau  oo1aetomfeiydfs2rln s;(4tlxoir3totoaD lneil(0trur(r3iudop e fcs t aDrmu  nt0tpeomieiysfs2umu p;u0 lxoircoytla e ieil()s2uo(o oo4om elnvilt aDrmxmono1aptniicildls2rmnvp;t4texomr tydla  aiei;t trxrxr3ny4lmt lnes () 2tmx  ;o1ole ii3tld m2ulnvo t4arxoxo3todfmD  i o;()srumir3ny1ameelfvsat) rtr(  nu0oexn icils a2uau o;(0 rtnxo iotlp e u o;s0trumxrpiy4oltn net sf rta(mpnt4ole mi3ils s uluvp;t)tltnxr3oadfatr uvil() ruo(m3nu4opt  fvi t  2ururpnu1tpe ii3iytla2eluvpn(4artrir iadlp e ivo;( trurxm oudaltemfeta( srum(mooo4aex  ocils m rlnmo (4 eerio oy1omDelnes t texo(mpiudomtelfeta( artmx pnt0opx ii3ilt sDrmnvpnu4tetomrcio1fat ln olt t2to(mpoudlle lfctl()aruaum ot4tltoiiciltlm elnmo t4arenmo iatomDeai ils)seurxm iydlpte fviasf 2tr(rpnu4oeto octld s2rm( o;u)trxrxf oatlmD lnvo;( teumirpnu4lptnlnvsl(fs2umxr ;u4tpto ociydfs2ul(vp t0texoir tytlpD  n o;s srxmxmpio1amt liciasfa2ur( poo0tpt iicilsfmDeluvsnu)artrif tytopD  i i s  2uoir3ou4alenlfvsas)sDrax o;t1opeomfeiasls umumsn(4altrmfcio1fptrau ils0srxmim3oy4amtn netat  rtr(moou1aexnifciysfmDemnvp;t0tltnxr tytfa rli i;s)teumxrpiydape  fcsl()srrmu  nt0tleoiictytfsDumumo;() ltnio3ootopt lnesl(0srxrxm3oudomtn feta( aruax pnt1opto ietadla2ulnvp;()tleoxocia1fpt aiei;s0 exmim io1amee ncilt artau p;o4altomi3iys m ranvs (4trtnir3iatla rai s t t2trxr iydomeelneilt aDur(rpnt4tleomi3iatlaDuan snu0tetrmo iydopDrai i ( srtmxo3iodamen nctls) Duaumo;o4tptoiieiydls ua(vpn(4 exomocoytlp  ai o;( setrirpny4olt mfcsl(  rta(r ;t0tle if3ildla2ulnmo t0 renxf3io1omt auei ( s2xrxm ny1ap e fvsat arumxrpnu1oex ifeiysfsDemuvo t0tlxoifcto1fmte nvs t  2toxo iu1openlietat  2uaur oo0oex if3ild sDua( onu)artnio ta1fmD  ivo;s)t2xoio3nodllenlncs t srurxrp;o1aeeniieiatlm raumsn(4treomfcootlmtean s t s2xoxo3oodllte fei t)arrruront1apeo o3tltla elumpnu0treoifctydfm eanvo s0 ruoio iy4opee fci sf rumur nt0aexn o3iltfm2uan pnt) etnmr oy1oat  ueolt) eur(o iy1lltnlfvslt s2urxro;t4oet  f3ilt aDea(vs;u0tlenif3oatopD auvo;( sexm(mpny4lltelicsl( artr(mono4tet  f3ilt sDuaums u4tlxomo iydlptelnes;t) rtmio3ou4llen ivsatfs2urxm ot0apenio3ildfsDemuvo u0 ltrxocoy1fmD lueols srtmir iudame mnet ( arraurp;t4alx  f3iad aDraums;(0trenxf oydomtranvi;s0s2xm(opoo1ale lfesasfs2uau oot4opx ifetadfs ra(mpnt0teerxrcootlmDe u s;t0sexo(o oy1oltnmnvta(fsrtm(r ou1olenii3iytfsDemn p u)aeenmr tytfptelueslt)trumxr oy1ll nlnet t) 2urur oo1teen i3iadfs ranvo;u) etnxrctatfmDr ues t)s2urxmpoy1om   ies s arumumpou0oeeo ietas a ul( p;u0 leoxf ta1lpte u ols0teurxopou1ap n ivi s aDrm(mo;t0tpenmoeiyslaDrl( onu4 exoxfcty1fa eauvo;t)trur(opnu4lp n fvsatf 2ua(rono4aptn ictat mDemnvpn(4alxnxr oytfmte neo;t0 2xoir3ny4omeemfvias s2tru pou4ape ii3ils aDemnvp u)tlxoxociydlaDr nes;( trxmirpio1lltelnvsa()artr(mpnt0tleo feiadls eln p u)texrifcoy1lmDe u o s s2xoio3nu1apt lnvsatfsDraxrooo4oetn ictasfm umu o;t)alxnxfciydoaD aiei (  eumxr3nu1ope mneslt  2ra( o;u1oeto o3iyd sDem(vp;u) rxrmf3iadfpt  i o;( texo(rpny4omt micsasf 2ra(r no0altn ictlt a raump u)trermf ootfpDelueil(  ruo(r3oydlp nmfesasfa2ta( o;t1tlt  fciasfsDraumsnt)treomr oa1fpDe ieols)s2umir oy1lm  lfctasfaruru pno0alx  f3ils sDum(msnt)trtrio3iadlmtrluesls0t2tm(rpnydlmenlicsatf Dta(mpoo1aetoio3iat s el( pn(4 etrif3iodlm r iei;s  2tmxr3oo4ll  mfesas)aDuau p;t1tpt iociad s ea( s (0 leoxo iytlm eanei;s0 rtoxo3ny4ll elnvilsfs2tmum nt4oltoifctltls2rl( pnt)tltrircto1fp e nesl(  eurio nu4amte icsatfa2rrxrp;u0alx iictadls2ea(mon(0teenxr3ty1la  lnes;()srtm(o iu4omenlfvils  2trxro;u1tetomfciydlm2eanmp;t4aexrifcoytlpte u olt)trto(mpny1opt  fvtas  rum(ronu4aetnmiciaslmDrl(ms ()altnmrcoytoaDran s;t0t2trim oy1ome lieilt sDum( onu0ole  i3tld sDranmp;u4aexomf iodfmDe ieolt)trxr(o3iy4lptelfci t sDtrump;t4aeeomf3iydlm ra(vs t0aeeomocty1fate neo;t trxoio3io1lpee ieiat)s2urx ono0tpx moctys s2uau p ()alxoir3ia1fateanesls t2tm(m nodol elicia(fsDtrum ot0tlenio3ilt m ra( o;u4trtnmo3oo1oa eaieo ()t2tm(o3iy4al   fvs s artrxr nt0optn feilt s umnms u0aexnxfciatop  anvi ( t2toim3oudom n ietasf Drm(rpnu0opxomfctadlaDuaump;t0 rxrmrcio1fpt aneols)trurxm oy4lp  livil()a2ua(rpnu4teeomoeiydlaDrlnvp t4 etomrctadlpD aneolt)t2umxm iy4alenmnctls)srurxmpou0teeo f3tytlm um(vp;u4trenmocoo1oatr uvi;t0 2to(mpnudope mfeiatfa2umxmpnt4opx ioctat sDemuvs u0alenxo iatop eau sls0seumir oy4lmte fcsatfsrtr(rpot1tpen ocilsls um(vsn(4 exrxr3tatoatrai ols t2xmxo3iydapen nesa(f 2trx  ;u1oexn oeiys m umumont0texoir ty1fat  ues;s0sexmxr ou1op e ncilsf rtrx pno1tlt  i3tytfm2el(mont)aeeoxr3tatlmte u ilt setm(o3ny1op  mfvsa()sDrrurono0aet mf3iad s ea(vo t4 eenxfcoydfaDeli i;() exm(m no1ameemict t s2um(ro;u0oleoiieiyt s ran s (0trtrxr3ootla eln i;t0seurir3oy1olee ncsl(fsDurxrpno4aeto icilslsDemn onu4artnmr3oatom   ivo;()seurxr3nudomen fesls srtau  nu1tet mietlslaDelnmpn(4 rtoxf3oydfpt luvol( s2toxmpiy1al e fetls arur(r ;u1aeto i3tlsfm2rlumpnu4 reomfcoy1lpD aivols) rur(m3iodaptnlfviltf Duaxroot4aee io3iytlmDrmu on()tlxrmoctatoat livi s) rtmxo3nu1ope mnvt t)srrrx p;u1alxomfeiaslaDrmump;(0tltnxociatfaD aueil(0 2xo(m iy1al nmnvsa(farrr(m nu4apxomietlsfm ra(ms;t0 ltoxr3iy1faD auvs ()trxriopio4lptelfctas a2tr(  oo0oeenifeiytfmDean sn()trtoxr ta1fp  lieo s)teuoxr3nudomenmnesls)artr(  ot4opx mf3tytfsDel(mp u0tlxrxocta1lm  livsl()teurir3ou1ll nlfesl(fs2rr(moou1aex  ietyslm2rl(vs;t) rtnif tatfpt  n i;(0setm(m3nu1lpt lfcil( aDua(r ;u4oee ifcilsla2rmumont4 rtoxr tytlpt  u ilt setrxopou1ol  lfvs s) rrrur ou0apeo icildla elnvo t)tltrmrcoa1fmt lieolt)setrxrpoo4al   fes t aDumu p;o1apt ioeilt aDrmu o;t0trtnxr tytfmteli olt)teuoiopno1ol elnci () Dtr( p;u4olen icilsls2ulnvs t0texomfcoodlaDrlnvs;s setmiopny1amen fctlt) 2rmum oo4tltnmo3iat sDuauvo;(0 eermf3oadfaDeanes;s)truoxo nu4op e ivia()s2ra(moou1tetomo3iytfa ean p u0arenir todlp  aneils seuo(m3ou1om emfetls artrum ot1tpxnmfeiltfs2rl( sn(4 lerxo3tadfaDrlu s s0 eurxo ou1om  mfciasfsDtrum no0opxoio3ild mDulumo;u0tlenxf3tytopDe ivo;t)s2trio3nudol   fei t)a2rmum nt0aexoifeiasfa2ra(mpnu) etnxr iodfm rln o;t  exoxo3oodlle mivia(f Dtmx  nt4tlt mfetysfm2rm(mo t4aeeoif3oydfpD lnvs t) rum(m3iudll  lncsls aruru  ou0apeoio3iydfs2ea( o;(0tltnxr ootlp e uvi t0seumxm3iudope micsasf rua(r ;t4olxn i3tltlmDrlu o u0tlxomfcoo1fm  anei;(  2umirpnu1op nlfvsat srra(mooo4olxn ieiytfmDrlumonu4altrxr3to1fmDe nei;t s2tr(opoydope  ict s s2taur nu1aexniictlsfsDua( o;t0aetoxf iydla  aueils trumio iydllte ivs sfaDrr(  ou4texoioeiytlaDelump;u4 rxrmrctatfpDranvs () exoxo ou4apen ncsat srtr(mpnt0tpxnif3tadfm uln s t)tetrmr3iytlmDr i i t0 2xoxr3nydlme lieias srrax o;o4apxoiietasfaDran p;() rtoxo3iadfpDrai o;s)s2to(o3no4lpt miet t)s2rauroou0oeen i3iaslm2rlums;u)tetoif3oatfa  li ols0s2tm(mpiu4ap   icsas) Duru o;u4aeeniieiyslm uan s;u)alxnif3tatfm  liei t) rxm(r ou4lmtemivtltfartau  no1tetniiciltfa ulu o;u4alerirciytoat an o s t2tmxr3oy4lpt lict t  2taxmoou0apen iciad mDrlums;u4 lxoxr todlpte u i t  2um(opiudolte fcsas)sDur( pno4tlt  octysfm elnmp u) etoxf3to1fpt lnei;s  rur(r ny1op n ivtl() rumumpnu1openifciyd s emnmsnt4arxomr3todfaD  n s s0srtrxmpoodapt lfvtat a2rr(rp;u4tpxoio3iasls2ea(vp;u)aetnifctytfmt livilt)seuoxmpnudole mivias  rum(mooo4opeoioctls a uauvsnu) lenif oydlp   n i;t s2trxrpiu4ome  fcsls sDraurpnt1opt  feiasfsDea(mpnu0trtrxo totlaDe ueilt texrxm3no4ap elfetltfsrur(  ;o0alt  o3iltla2raums;u0artnmo iytfptrli s (0texm(m iodop elics s)sDumumpno4tpe mi3ilt sDrm(vpn(0 lxrifciy1la r i i t tetr(o iudaptelfes ()srtm(m ;t4oexnmfciadfsDrl(vp t)alxnmocto1lpDeliei ()trtr(rpnydlmtnmnvsl()arraur nu4oleoiiciytfm2uanvon() renif to1fmt aivs;(  rxoio3ou4lptnlfei t)a2trurpou0apxomi3iytfm eaumsnu)tltnxo3ty1faD anes;s  rxo(mpiudlpt lnvil()arraxm ;t0tet mi3iltfs rl(mp;u) leoio3iytlm  lu i t0 ruo(o3iydopee ics s) 2umx oou1oleoiocildlm2rmn snu)aetnxfciytlaDrai ol() 2xmxm3iydlme  feiasf Duaur ;u0olxn f3tls m2rm( p;(0tetrif iadla   uvil( tetoxm3nodap n fciasfaruaxroot4tlxnmf3ilsfaDemu o u)arxnmociadfatrlnes (0srxmim oydapt  ivias)aDum( pnu4aeeo fctadls2eauvp u0 lenir3oadfpD luvo;(0srxoim iudol nmivia(  rrax  ;t1alt ifeiltfm2el(msn(4tlxrmocoodfa  auvsl() eurxrpny1lltnmfcsl(fsDrr(moot4oex  ietld m2ua(vs;(0tetrmfcoatlpte u o;t)texm(mpou1lp  mivtl( aruaumpnu1apenif3ildla2elnvo (0artnmociy1lp e i i (0 etr(m iu4lmte fvsat a2trxrooo4alenmocias m uanmp;u)tetnmr oatlmt aieils) 2tmxrpiodlmeemnci s) rrmx  ;u4tleomicilt s2rmnvp;t0tltnifciotfp  lieo;s)s2tmxmpoo4openlnetltf rrmxmo;u0openmfciyslsDelu p;() eenirctadopt lnvs t)trurir3iu1opt  ncil()srrax oot0aptn f3iysfm ranms;(0tlxrxfcoadlmtrlnvo;t) rxoxm iydomeelnvias) 2urx poo4tlx mi3tydfa ra(vp ()tleriociydlpDeli o s0srur(opiy1ap nlivsltfa2tmurooo4tle  i3ilslm rlnmp;()tlxrxrctodlaDrai ol()setm(r ny4al  lncil(  Dtrxmpot1optnifeiyslm uau sn(0 ltoiocoodoa e n s s) ruoxr3iy4ll  mneiat  rrmx ono4teenii3ilt aDran ont)arerxr3oytfa  lu i (  exmiopnudol n neilsfsrururp;o1tee mf3iaslsDulnvont)trxnxo io1oaDran olt0s2to(o oy1ol n fvs (f rrru o;t4tlx ioeiys s emnvp;u)tltrmf ia1laDr ieslt0seumimpny4ol n fcilt a2rmxm ;u4olx mo3tyd s rlumo;()texrirctotlmD au ols) ruo(r ny1llt lnei (fsruaumpot4tet  ociaslaDumnmpn()trxrxociy1fmteaues s)seuoio iodop emnes sf 2rmxmp;t4olt  o3iyd sDrmuvs (0 eerifcootfm   nvils0trto(opny4apee ics tfaDtmu ont1aeto fcils s2ra(vpn(4 eeoxf3oadopDr nvs ( s2umxr3io1olt  icsa()sruaur ;t0aexomo3tasfsDuln s;(4aetrxf tatlm elues;t0 etrimpnodllee fei s) Drrxm ;t4aptomo3tydls ulump (0 etomrcoadlm  li i t)teur(r oydapee neiatf rtmxr ;u4tpx  o3iydlsDran o u) lxrmrciydfa  aivo;t0tetoxrpnudll   ictl(f Dtrxm nt1oexnif3iat a rmuvp u4trxoxo3oodfat au i s) rumxo oy4amt mnctls) rumu onu4tlenmieiadla2elu s (0trtrmr3tatlmt  i s;( t2xrim3oy4op  mivta() 2rax poo4optoiiciytla el( sn(0 reoif3oa1omte ueils)texmimpny1llenmfvi tfaruaxm oo1tpeomo3iys a emuvo t4 lenxf3to1fm  ai slt) 2to(r3oodlmtn iesa()aDrmu poo4opxniietadfmDul(mo u0treomr iodom eaneils0 rxmirpoodome lnvslt  Draum oo0alt ioeiytfa2elumpnu4teeomociydlm eanvil() rxmirpny4lpe  ncsas)arrmxm no1tlxn ieiys a2raums;(0artnmrctydlm e i o;s0teurirpnu4olt  ies sfarrrum ou4oeen i3iytlaDulu o;t) lxrmrcoytfmD an ilt)seum(r3ou1ll  lfvils) 2uaurooo1tee iociys sDemnvonu)aetrxr oytopDrln i;t0 2umxo io1alt lfesat  rtrxrono1apx iictlt s2rmuvp;t4 exrmr3oo1fa   n i t) exm(r oo1olenlivtl() 2rrxm ou0aetnioetad aDuanms;u4 rtoxrcia1fpDeluvo s0 rxmxr no4ll n feiat) 2tm( pno4teeo fciltls2uaump t4 etoxo3oatlpte i s (0sruo(rpio4lle lnctasfa2ur( ono4opt mieiydla rmuvp (0 etnir3oytlmD livo (0 2xmxr3iudlp elneils  2ta(rp;t4aetnif3iytlmDea( s u0aeenmr to1fa e uvs;()trtoxm3io1omt  fcsl(  2tm( pot0tpxnmocildfsDum( p;t0aeermr3iodla  lneolt0texoim ny1lltnmnet ()a2urxr nt1oeenifeiatfaDumn snt4 etrir iotlaD  nvi t)seum(opiudap  lfci t  2urxmoot4oexoioctldfa2rmn snu4 etrmo iydlm   i s (  2xrirpno4am n nvt ()sDtm(ront4alxnmfetat mDelnvp t)areoxr3tadlpD lnei;t)t2to(r3nudop e nvia( aDra(rp;u0optoio3iadls emn p (4 leoir3oytlmDraiei;t) rtmir io1ome livtlt  Dtru ont1oex mfeiad m rm(mpnt0tetrir3iadlpt anvi s)texmxm no1apen fesls) rtr(mpou0aexnmoeiysfm2rm(mo (4 exoio3ia1lmt aivsl() exoxm oydoltelnesat)srtrur no1alto o3tys sDel( p ()tleoir3iy1fate ueo;t setm(o nu1omeelnvs s  rrrxrp;u0tex  ociysfs2emu snu0areoirctotopD lies;s0teum(r no1olt livi sf rrm( oou1apxo oeild a uanvo t4tlxomo iydlm rlivil()trtm(rpoy4lp elici sfs2trx oot0optoifctytfmDumn p;t0areoxo3io1fmtelivols) rxmio3nydoltnmieta() 2trxr oo1aetn o3tltfs uluvp u4trtomf totlaD au o;t  2tm(mpnu1apt  fes tfa2um(ronu4apt ifctatfa em(monu)arermf oodoatrlieil()t2toir3nudam  lnvi s)srum( pnu0opxnmi3iadlm uaumo u0aetriocoatlaD aieo;t0setmimpoydope mnvslsf 2ua( oot0olxomociat aDrmu on(4 eenmo3ty1lpDrliesl(0srxmiopnydam  lnviat  Drr(m ot4ope  i3tlsfsDeauvpn()altrxrciytlmtr u s;t)setrimpoodlptn nesasfsrtmum ot4alx mietatfa2rm(vs;u0texrmf3io1lp  auvsl( trumxrpiudlmen fet s sDra(m oo1opeoii3tadfsDrl(vo () exomf3ia1lm rlivi;()s2xoxm3oydal   ncs ()s2ua(mooo1olt mo3tyt s rlu on()trtnmr3iy1lmDraueolt)seuoxopiu4op emnctls)aDtmx o;o1tpeoio3iyt s umnvs t)teeoxocta1omt au olt t2uoio ny4al emivs sfsrua( p;t4openioctydfm rlnms;u) ltnxo oy1late nes t)s2umim3nudole  fet (f 2tmurpot0tlxo ociytfsDel(vs t4trenir3oy1oa eli ils0sexoirpou1lle mfeilt artr(rp;t0oexo o3iasla2elums u0tltrio ootlpDe u i t0 2umirpnu1amtnmiesl(farrm(m no4tex miciydlm2uln pnt4 exrif3iatoatr ies;(0 2tm(m3ou4ale  ict (  2uauro;o0texn octyt m2eln s;u0trxnifcoytfmte nei s sexoxopiy1opeelivtas artmxm nu4aeenmoctat sDemuvo;u)tltrir tydop  anvil()s2xrxopiy4lme  ictlsf 2umxmono0aex  feiaslaDuanvsn(0artrxo3io1op   nei t) 2um(m3no4ap nlfcilt sDtaur ;t4tee  ieiaslm ea(mo;(4 leomfciydla ran i;s srxoio oy1ale lfeilsf rtm(  ;u1oleomoeilt m umnvs u0aeeoxoctadopt  n i;s0srtr(r3nydlpen fet s s2tm(mp;t4apto i3iat mDrmnmo t4aleoxo io1lp rln s;t0teto(r3no4ol  mnvsas sDta(r ou0olenmoetydfa2eluvo u)arxomr3iy1fmte i sl(0 2uoim3nu1optnmieiat)aDuau ooo0apt  i3tad aDra( p;(4trxnio3iadom  lu slt trtm(m io4lme mfeil(f rumurpoo0aptnifeias sDul(vo t0tltrifcia1op rlnvs s0 exr(m3io4ol nlfvtl(fsrrrxro;u0oexo i3tasfa eau o u) etnmo iydopt lies;(  exr(m nu1lpenlnesatf 2ta( onu4oee iiciyt sDuanmp;t0aexomf oo1lmDe uvo;t truoxr3ou1omeemfvi () rra(m ot1oeto octyd m rm(vs;u)artoir3oytfm r uvsl()seuoim3oydlpe lfvtl(fsDrax  ;o0oet iieiatla2emn pnu0 rtnifcty1opD lueo;t)setmirpoudam e ict ( s2tmxm no4oexnio3tasls2rm(mo u) rerxr ootlpD livi s srxoimpoo1aptelncs sfs2rm( p;u1tet io3ild m umu s;t0aleomr oa1lmtelivol(  rxr(m ou1lle mfcs ( arrax pno1oltnmf3tysfsDrlu s (4arermf todlaDrai slt)srxrirpoo1optnlncsatfa2ua(  ot1apxoif3tad s umn on() leoif3iytfat luvi t  rxoxr3oo1ope lnctatfaruaxmo;o4apxo feiasfa rmuvonu4 lxnxfctadlm eluvs s0 rtoxmpoudoltnlivt sfs2um(ro;u4oltnmf3iyt mDemumsnu) exoxf oydfp elueo s0s2trirpno4lle  ncta(f rtau pnu0altnmo3iytlm2rauvo;t0trxnxrctodfp e nvo;s0t2toxr3iydomenlietl(f rtmumo;t1olxo i3iadls2rau pn(0 etrmr3oy1opteaieols) 2uoxmpoo4ll nmfvtasfaDrm(mp;t1opt  ietydlmDuluvo;()trtrxr tydlpt an olt) ruoxo iudamtnmfcsas aDrmx pnu0tlxo oeiysla rlnvp;u4trtrxr ty1oa eaivo;() 2tmir3nudlmt licta()s2uaxroot1aet ioeiat mDrm(mp;t) rxnmf3totlmDrlnvo ( trurxm ou4lmee fei sfa2um(r no1oee mi3tasls2ulnvonu0 rtoiocio1omDraueo;t) euoxopio1alt mnesat)a2trur ;u4apxn iciadfm2um( s;t) exomr3ta1fa   ivo;()teuoxr3oodap n fvslsfs2trum ou1ale io3iad sDul(ms;t)tlenmo3oytfpte uvil(0 2uriopiy1lpt  ivsl(  Dumxrono1tetoifetldla2rln on(4aleomf3ta1fpDranei () 2ur(r3oo1ope miviasf 2tax ont4olxnio3tydfa2rmumsnu)trxrxo iotfptr ivs t0srxr(m3oo1llenmivias aDtr(m no4tleoioctatla2elnvonu4 ltrifcoy1opDrau o;s)trxoxm3iu4lpeemies ( arurxrp;t4openioetydlsDua( p t)teenmf3iydlptelneo;t)trtoxm io1ol n icsatf 2tmxmoot4aex  ociydlm ra(vp;t4treoxfcoatlatrluvs;s  rtr(opny4om n fvi s) rua(m no4opxoiiciaslm umums;(0arxoxf tadfa r u s t0 rxoxm3nu1omtemncsls artau poo1oex  fciyslm raums;()tltnxf3iytopt lueolt teurxmpiydlmen nctltf rtrurp;u1altnif3iyd aDeau onu)tltoif iy1opte i i s  2uoxo3iy4lmenlfetlt srurumoou0altomfetys m2umump u0 rtrif3iadlmD lieilt0tetm(r3ou1lpee iei (f Duau ont4tle  iciasfsDel(mont0arxniociotlp r iesls0 2urxopio1olenlfvtlt)sruaxrp;o0opt  oeiys sDra(ms;u4 rtrmo iydfmtrai i () etrimpnodll emivslt)a2tmum ;t1teto i3iysls2ea(vp;t4tlerio3iotfaDeluesl( srxrimpiydome  ietls)aDta(m nu0oetn oeilsfaDulnvpn(0artoxf io1fp  luvs (0 rumxr iodamtemfetlt)aDuru o;o4opeomoctadlsDelums (0artnxoctodoaDeaueo t  rxrxopou1olenmfct s s2umum nu4optnmictydlaDul(vo;()arxoxo ootla   n i t0teum(m iu4op nmfeil( aDrmxmoot0apxn i3iatfmDul(vp;u4altomr3ia1fm elu s s0trtm(m nydopt  ies (f Dtaxmpnu4tlt ii3iyt m2rmn s;u4 ltoir3io1lm elneo s  2xmxm no1lpe mncta( s2tm( o;o4tleoifeiad a ul(mp u4aexoxf3tydlmtelnes;()trxoxrpno4ap  lnesa(  Dur(mono0opeoii3iydfaDumn ont) renxociadopD lneil() rtmxmpoydome  nvta(f 2rauroot4altnmfciysfmDrm(ms;() rerircto1late u sls t2uoir3oy4altnlfvia(faDrrx pno0aetomoetat aDel(vo u)trtoif ootfp rlu s;t0t2xrimpio1lmt  ncslsf rta(rpnu0tet  oeiyt sDem(vonu) rtnmo3to1oat  ieo;s)sruoio3iudamte nvslt srra(mo;u1tpenmieild a eauvs t0trxrxocoydomte n i s)s2xoxr oo4ole lneiat s2rmumono1oetnio3tltfa uan s t4 ltoxf iatomtrlu s;( s2ur(m oudolen ietlsfs2um(  no0opx mietltla2ua(vpn()treoir to1lm ranvils0t2umio3iu4omt mfcs t  2rrum ot0aex moeiadfm2rlnmo u0arxoxo ta1fp eaivols)setrxopnydapte ncil(farrm(root0oet mieiasfs2uln s;(0 lxrir todlpteaueo;t0s2umimpiy4lltemiei sf Dta(rono0apxniociaslsDrauvp;u4 rtnif3iy1oa eauei (0sexo(m ou4ll n feiat  rua( pno0opx iociltlm rl( snt)treoxf iotfp raivols0s2uo(rpnydlp  lnvi tfsDumx p;u4tleomf3tydfa rlnmpn(0tlxoxf ta1fa   ueo;(0 ruo(mpiu1om   fei t) Drru  nt1oex  iciatfaDeln s;u)arerxo3ta1fp eau i;t0s2uo(mpoy1openmfesls)aDtru o;o4tex  feiltfsDemnms u)teerif todlpDeln i s sruriopnudameemivi (faDrr(ro;u0oee  feiat sDemuvsnt0aeenio ootoa  lnvol(0trxo(r iodlm emicsas) Draur ou0olenio3iys s rau o;t4arerio oo1omDr ieo t) eumimpnu1aptelncsat aDraum ;t1tpxnmo3iydls emu p;u4texoio3io1opDrlieolt0srtm(m ou1omenlivsl()aruax  ou0apxoifeils a rmnms ()texoxf iatopDr n s;t0s2xm(rpno1olt mfvi (fsrrmurp;t4tleomieiaslsDea( p u4trxrir tydomD anei;s0trxmio ou4oltelicias arrr(rpoo4tltnifciasfa2umnvs t4tleoxo oa1fmDrlu ol( trurir iydolt  fcil(fa2tauronu0optn oetltla ra( s (4tlerif3to1fm ran sl(0 2uoxmpiodopt miesas) rrrurpnt4tet mietatls rl(mp;u4trtoif3oydomDeaivo t) 2ur(m nodope mnesat)aDuax  nt1teeniociytfs ul( snt0aexnxf3oodfp r uvil(0 rxm(o3oy4lp nmfcsas)aDra(mo;o0oeto o3iad mDra( pnt4 ltrifctotfatr ueo;( teurim3nu1am n iviat sDta(rpoo1tptnioeiys a rauvsn(0 etnxr tatfpt livsl(  etoir iy1oleemfci tfsDrr(ront1aleniictls s ranmp u)tetomf3iytlpt  iei;t0 etmimpiodape lnctat)s2uaur nt4tpt mfciatfmDulnmp;t0 ltrmr3to1fateai ils  euoim ny1amt mfvtas  rumxr ;t4apeo oetltls2ul(mp ()tlxrmrctydlmD lu o;t  2toxo3iu4openlneta(farraump;u1apto oetydfs ranmp;(0trenxr tytlaD  nei;(0srxmiopiydoptn fcs t a2rrxmp;u4apen ocildfm2eln s () rxnmo3iy1lpDeaneo;(  exo(rpiu4llee neilsfs2umu pnt1apx mfcildfs uau o t0tltomr3tadoa  lu i t0teurirpnudllee nvsas  2rmx  no4tpxoiietyd s ul(vo t)trxoir todlatelieolt0 2umxo3iodlm   fvsat) Drrurpnt1tlxoii3tls mDuanvp u)arenxo3iydlaD lnvi;t  2tm(mpno1optelfci t)srtruroot4aetn oeiys a2emuvont0arxomrciy1lmte nes;(0 rumir iu4lpt mnvsl(fsDtau o;u1tlt  feiasla rlu p (4trtnir3tadlpDeanvsls0t2xrim no4altelfvt s artru pou4apenifctadfmDumuvsn(0tetoircta1omtr nei;(  rumio no1omte fctatfsrrm( o;t0tex iieildlaDuaumsn(0 exnir3oydfpDelies (0s2xoxr io4llee nvtat  Dumurpnu4apenmieiatls emn sn(0 rxomf3iydlpt anvo ()trto(o nudal nmnvslt)a2uaxmono1olxomi3tadfmDra(mpnt4texomr3totfpD  ivi;t0teto(rpiydapeemneta( aDtr(ro;u4tee moeiaslmDrmuvsn(0arxomo totomD anvo t0s2trim3oy4ap elivsls)s2uauroot0tleomfetytfa uan p;t)arxrxr3iydlp rlnesl()trto(o ou4lptnmnvt (fsDum(mooo0ape  oeiasfa emn o u)artnir3oodfa  aueslt0 exrxopou1amtn fvt s arrau poo4tlxoio3iasla ra(vpnt0 leoxf3iotoa rau s (  2toio3iudlm  livta(fsDururoot0tee if3iyd m ulump;u) lenmfcoa1fpt auvo;()setm(mpoydll nlfctls)s2taxmont1oeenio3tysfmDemn s t0tlxrxf3oatfa   nei s s2trirpio1lptnlfci tfsrtmuroot0ole mfcias a umu o u)aexnmrcta1omD  ueslt0t2uoxo iydam nmivt s a2rrxm nu1teenif3tlt mDuluvont0 etomf3todopDeaueilt)teto(o nydoleelfvs tf rtrxmo;o0opeoioctadls2rlums;t0aetomf3iodom  aueo ()t2uoim3ou4ap  lfcsl( artru  oo0alenmoetytfs2rm(vp u0 etrxo3iatfpDeaieo ()sexoirpiudlleemnvsl()arurumo;o1apenioetasfsDemn p;t4aetoxf iodlm   ueil() rur(o3oy1ll n iei s  rrrx pnt0tlen f3ilsfm2rlnmo u)tetrmo3oodlaDrln i;t  2ur(m iu4llt  netas s2ra(rpot4tpxo ieiyslsDrm(vpnu4 rtnioctatla elivil(0 exrio3iy1amt  nciasfaDtmumpnu4aexomfciyd m2ulnmo;u0 rtoxociy1optrauvilt0srxmxo3nu1llt  nciat aruau  oo1tetomiciltla rl(mp ()tltomf todomt au il( trxr(opnu1amt  ietas sDurxr oo1tlt  ociltla rm( o;t0 rerxrcio1la  ai s;s)setmim ny1opt livilt) 2ta(mpno1opx ioeilsfmDrlu p (4altomfcia1fpDe ieols)t2tm(o3iodope  net sf Duax  ;o0tex mf3tldls rm(vs u4trxrmocoatlateanvi;( t2um(mpiy4opt liciltfs2tm(mpot1tpenifciaslmDra(vs;(4 exoif3todlptr i ilt0 2xr(mpoydlp nmieilt) Dtmuro;u4tetnifeiytfa2rln pnu0trxoircoodfmt ai i;s  rtr(m3nudameemictl()arrru pnu0ale mietatlm ul( s;u4 rxrmf3tatlmtr nes s)teto(mpoo4lle mics t) 2trx  nu1tpxnmfetyd a ul( o;(4trxrifcty1fa eaueolt0s2umir no4omteliesas aDra(r nt1tptomfetysfm2emuvonu) exnif3tadfat livi;t0srtoio io4lp  lfcsasf Drr(r no4texomoeildfa2rmnvs;u) leoir3iy1lateanvo;(0t2uo(opoo4ape mfvt tf rtrumo;u4oeen ociltfa emnvo u4aeermf3oy1lm ranei s)s2trxmpny1lpenliet t srum(mpno1tpen f3tydfa ra( o;u)aetrxf3ty1fpD aies s)trum(mpny1lpe lfvs ()a2umx ono0tex mietadfaDuauvp;t) eenmr3to1lp  aneolt t2uriopoodop nmivtasf rurur nt1alx ifciyd mDea(vo t4alenmo3oytfm rln s;t0tetrir3ny1oltemfetat)s2raumpno0texo fciad m emumo t) rtoirciadfp  ln ols0texmxmpio4ap  mnet t)sDraxm nt1optn o3iltlmDelu p;u0trenio3oo1fp   u o t)s2trir no4omt mnvt t)srum(m ;u4open oetysfsDul(vsnu)artomociy1fpDr uvi;(  etrxo no4ol  lnvt t a2uaurpot0oex iicild s rmnvs;(4arerxf ty1fp e ueols  2xo(opoy1apenlfctas)s2rmxrpot1oexniiciasls rluvsnu0areoir3oodfptr neil(0 rtmirpno4om nmicsa( srumxr no4tptoioctltla ulu o;()arenxociy1lp  aivo t)t2um(r3ou1ole mnetl()sDrrxrooo0apenii3tyt mDran s;(4arxomoctatomD lneo;s)tetr(opnodlmen ivs sf Dum( o;t1olx  octyt s ul(vpnu)alerifciatfmtr neilt0trtmiopnu4lle  ics s srrmxmo;o4tlx ifciatfs2ean ont4texnmrcoatopt  neols0trurxopoo1ape mnvsat)aDrr(ro;o1tpe ifetyd a um(vo;t)altnmfcoo1lp  ln s;t s2tm(opiudap   ieta(fsDra( onu4teen icildlm rm(vpn(0teeoio3iatlm rauvo;s  rxrimpoy1omt lneslt a2umx p;u0oleomoeildla um(vsnt) rtnxfciadfp  anvo;s) exoxr oy4lmen icsa(faDtmxrpoo4tpx  f3iytlm2emnms;t)trerxr3iodlaD li sl()trumxr3iy4om nlfeilsfsDra( p;u4tex  ieild s ulumo;(0 lenifcoa1lmDrlneo () eum(m3iy4ll   fvtlsfaDrrur ;t1optnmo3tlsfmDuln p;u) lxnmr3iydlmteaieils)sexoim no4ol nlfcilt)artrur ;o4olxn o3iadls rmnmon()trenmo todom  au ol(0texmim3ny1ll  mnesltfaDtmx o;o4olenifetaslm uln p (4trtomf tytfa rln s ( s2xmxr3io4ale lietl()srtaxrp;u1alxoif3ias a ranmpn() etnxfciotop   ivsls) euoxo3nodaptemnvi t arrrumpnu1alxomiciatfm2rmnmp (4aeerifcoydop rauvilt) 2toxopiu1lltn neia(  rum(rooo4tpe mo3tytla rm(mp;t4teenxo iydlmt  n s s)trurir3ny4om emfei ( s2uaurp;o4tpxomociadlm2eau p;u) rerir3iytfaDelu o ()t2um(o3oy4amtn nesls)srumxrpnu1ope io3iltfm2emuvs;u4alxrmo3tydlat lueo;s0t2toxmpoy1ole  ivtlsf 2tm(mpno0alx io3tat m2elu s;u4tetrmfcoo1op elues;t0 rtmxm3oy1ol   ivs t sDraxrono1oetnmfetldfm2emuvs (0tlerxr ootlpDranvi t)srxmxm3oo1llee ict s a2rr(ro;u1tpxnmf3ilslaDelnvs (4tleoif3ty1oaD au s;()texoxo3no1ameemnetas)srtaxmpno1apenmo3ias m emums;()trtrifctydfpt livo t0 2tmxo oo1ope lfvtat aDurumpoo0tpxo ieild aDuauvo ()trxnmrcoatoaDrau s (0t2xrir oydlptn neia( a2taumonu1tlto oetatla ua(vpn(4 lerircoadfmD  neo s srtoxrpnudam n fcsl()sDuaxr ;o1texo oeilslsDrmn p u4 rxrxr3ootfpDrau ilt0s2urxmpiu4amenmfvi sf 2rm(m nu4oex io3iat mDrl( o u4trxoif tadfm e iesl( srxr(m oo1lp   ivs s s2urx  no1aet  octytls2elnmo u0 eenirciydlaD  nvi s  ruo(o3oo4lm  mfctls)sDua(m ot1oex mfcils s ul(monu0aetrmr oy1fm rai i t0s2xoxmpnu1om n icilt)a2urur ;u4tpxo oetls a2rmnmp (0 rxnxo3oydom  aneo;s)srtm(r ny4ape lnvslt srur( pou4opxnii3tlslaDemuvo;u) exomo io1oaDean i;t)s2xmim nu1omte fvtl(  Draxr nu1opeomoctys aDelnvs;t)tetnmr3to1lpDeauvo;s0srxm(m oo4ll   icsatfarraumoou4tpt  i3iltlsDrlumpn()aetrmo iatfp e ies (  etr(mpiy1lmtelneia(f 2rmxmp;u1olx  o3iys a rl(mon()aexnio3todfmte ueols0 2tm(r3io4lleelnvtl()sDtmurpot1apenifctysfa ranvsnt0tltomr oa1fat lieo t srxoir3iu1ole lfcsl() 2trum ou0tetoiociysfsDelnmo u4 rxoxrcoydlp   n i;s)s2urxr nydapte ictas aDurx p;t4aleoif3ilsls2eluvo t0arxrio3iodfmD  ies s0sexmxr ou4ole lncs (  rrr( pot0texo i3ildla ulnms t0 leoxfcoytfmDeliei;(  rur(rpiu4omteliviltfsDtmum oo0tlxnmfciysfmDelnms;t0artrmfciadla  an o;(0sruoio oo1ol e ncs s s2rr( o;u4aetomi3tad aDean pn()tltoxociadfpDelivsls0texm(m3nodllee ietltfaruaxmo;u1tlxomieiydfm eanmsnt)arxrioctytom rln ols0s2xrxmpnu4lmt lfesltfa2raxrpou1aleo fciltfmDrmnvp (0tleoio3iatomDeliesl() etmxm3oo1omte ivtl(fs2taumpot1altnifeilt mDuanms u) etnxocta1fm eluvol(0texrxo3iudole miesl(fa2trxm nu1oeeoioctydlm elu o;u4texnmrctatfpt  neo t)trxr(o iudol emfet (fsDtmxmpno1aptnii3tlsfmDel(vp;t0 eenxo3oatfmDraivi (  rtr(rpiudop nlfeta()arurxrpnu1ape  f3tatls2el( o;u)areomrcootfate neo;s0s2um(opno1alte ivias)artm(mp;t0altomoetld sDumnvs u)aeermr3to1fpDraieo t0t2trxopoudam e ieil(fa2tr(  ot4optomieildlmDul( s t0 lxnio tydlatelnesl()sexoiopoudll e ivias aDrau oot1tleomociydlaDum( pnt0 rxoirciy1lmDr i ols trxm(rpou4lltelicsa(faDurumpnt1opxoif3iyd mDuan pn(4 etrmr3iadfpt luvs t  2umxopoy4omenlfet s) 2ururp;u0texnmictatfa um( o;u)texnmr oatfp  anvi t)srxrxm oy4omtemictat arua(rpnu0texoif3tadfs um( s (4aexomr iytoaD lnvo;(0 exmim3ou4op nliei tf rrau p;u0aetoiietatfm2umumonu) lxomf3ta1omD aivolt0sexoxr3oydopenmfci s srra(rpoo4tee  o3tyslmDumump (0aexomo tytop r uvs s tetmxopoodop emncslsfsrumxront1opxomo3tyt s2ean ont0 rtoxr3iatlptrauei s)trumio oy4ale  ivilt)a2tr(r no1tee if3iyslm2eanvp;(4tltoxr iadfat  nei (0 rtm(m3oudomt mnesa() ruauro;u4tltoioctad sDem(vonu4 etrmfcty1lmDelnvi t0 etmxm3ou1ome mfei s) 2tau o;t0olx  f3iydla umnvp;t0 rxoxociydlp   nvo;s0s2urxo3ny4ale licsasf Dtrxmo;u1oltomiciatla2rm( o t0tlenmo oydlatean o;t srumxm oy4am nmivt sfs2tr( p;t4tee  feild m2rm(mp (0alxrifcoatoa ran ol(0 rtmirpiu4lptnmnei s)arrru p;t1ole  o3iytfsDumnvpnu4aexnxf3tytopDraneol(  rxm(r iu1aptn ncil( aDumxr nu0apxomf3iydfm2ea( o;u4texrif3todoptelnvil(0s2urxm3nudlp e nvtat  Dumu oou1apxnmfciasfmDum(vpnt0aexoxo3oy1la r nes (  etmxo ou1lm emneilt)aDuaurpou4altnii3tytla uln pn(4teermrciodoaDe ieo;t0trto(r3nu1om emies t  rtmxm nu0tee moeiltfmDea(mpnt0 ltrmf3oydfmtrauvo (0s2xoxr3io4al e nci sf Dur(mpno0tlxoii3ildfa2umn o ()aeerif oy1opD anvo t teuoxmpno4lpenlfcil( artrumo;o1olt  f3iyslm2el(mo;t4aetrmocoy1opDrauvo;t0srxo(r3iy4apee nvsat sDumumooo4opt  octltfs2ul(vp u4tetrifciodlpDeanei ( t2xmim3ou4om   fvi ( aDuau pou4aeto i3iasla em( ont)treoiocoytoaDelues ( s2urimpiu4opt mivs t aDurx poo1oleo iciydlmDran s (0alxoif3iodfpDeauvi s texoirpiu4am elfes ( sDrmxmoot1alx ifciltlm umnmp u)alermr3oadfatrln slt)srxmxmpny1altemfvi tf rum(r ;o1tee moctytfa2umu o t)texoio iytlp   ueo;t srtoir3nu4op e net ()artr(ro;o0ole iociadlm ulu s (4areomocio1opt ln sl(0sexrxr3iu4olen fcil( a2tmx o;t1aeenmf3ilt mDrm(ms u4alxnmf3ta1fa ean il(  euoio3iy1omenmfct t sDrmx onu4olenmf3tadla em(mo ()aexoxo3todfpD aneilt)s2tmirpio4amtnmnesas) Duax p;u0altomi3iasfa ulnvp;t)altrir3oa1fmtelivo t0s2xoir3oy1ape liesa( aDrm(moot4teeo fctytfm2ulnmp (4tlerifcto1opDran s s t2tmim nu1amtnmnciltf rraxr nt1opx mfciydfsDra(vsn(0aeeoirctatom elieo;t)srxmio ny4ome  ieiatfs2urxr ;o4tle if3iysfa elumon()arxnmocoytomtran ol(0s2xo(r no4apeemiciatf 2tmxm no0alx ii3ils m um(mp;u4trtrmrctodfmDe ieo ( trumxm iodlpee nviat artrxmooo1olxoiiciydlaDrl(vp t)altomr3oydoaDelnesl( texr(o oo4oltemfes ( s2uru pou1tltomieildfaDemuvpn(0artnmo iydfaDr i slt)seur(r3nu1lptnlivsl(  2rm( pot1opxn ietlsla2eln p;u0trtrmf3oydoa r ues;s)seurio3ou4ap nmneilt)arrm( pnu0apen feiysfa ra( s;t)tlerxr iytoaDr iei (  rxoxo nu1ap  mieiatfsDurxrooo0tpeoiietaslm um(ms t4aexomo3iadlmte n s;s0t2xr(m oo4olenlictatf Dta(rpnu1opeo i3tysfm eau p t0 exrxfctytomDrlnei t) rto(m3oy4opee fcta()aDtr(ro;u0aptnmfeiltfmDul(vo;u) lxrmfcio1fatrlivslt0srtmiopio4oleemivt t  rtmxr nu1tlenmieiysfm2ea( o (4 eerirctodlp eaivo s) 2trxm oudoltemfei tfsDraum nu0tpt  ieiysfsDelums;u4aleoxocoodlpD lu ilt s2urxm3iy4aleelfviasfsDtrxrp;o4tex mfctyslaDeaumsn() rtoxfcty1lm   iesls  rxrxm nydllte fcilt  Dtrumpot1alxoif3iysfa uanms (4artoxf3ty1lpDe ivils)sexo(m io4lpenlnes sfsrumxm ou4oee  i3ilsls2em(vp t0arxrxrctadfm elnvs;( s2to(r3nudope  feilt) Durxrp;t1texniictasfa2ul(vpnu0 ltrxo tadom rlivs;s0 eumxr iu4ll elivt sfsrururpnu0tetnmfciadlaDrlumo;u4aexrir oy1op ranes ( srtrxm io4lmtnmfci s)a2umumpno0oeeoif3tyt m2elu onu0tlxoir3tatop  luvi;( s2tr(rpoo4omtnmfet tfsDur(r ;o4oexo fciyd s2rmuvs;(4 renxociadoaD lnvo ()srumio3oudope lnct s)sDuaxr ou1ope miciadlm2el( pnt0arxrmo3to1fptr iesls  2toio3oo4lpe liviat)sDuaxr ;u1aptniieiytlsDem( s;(0tltnio3tadfpD  iesl(  2urxmpno1lp  mnetas)sDum(mo;o0oleoif3iltla emnvsn(4trtrxo3ia1lateaivi s  etmxr oydolenmfctasfartm( pnt1tlxomoetadlsDrmuvsnu4aexrxo ia1fmDe uei s0t2tm(m3nydlpenmiesl()aDumxmo;u1alxoifctlsla2emu p t)trxrmrcta1oa e ues ( trtrxr3iudamt  nvi tfsrrau pot0optoifeiyt m umnmo;t)tleomfcio1laDeli i;(0teum(m3oodlme lfcs t) Draur ot4tpt mo3iad sDemuvo;t)texrxfciatlp r i olt)seumxr nu4omt lfei t aDur(mono4alenif3ilt m ul( s u0altrifcoytlmD auei s)t2toirpiu1open ncslt  rtau o;u1texn o3tysfaDran o t)artoif3oatfaDr u o;(0s2toxmpny1al   fci sfaDrrur ;t1openmocias s2ra(mo t4trxoif3oa1fat an i s0t2uoxo3oydopee ieils s2uaxmp;o0olt  fciytfa rl(ms;u) lermf ia1omtr i s;s)trxrxrpou1omee fvi (faDtmxmoou1oee  ictadlsDrl(vo;t4trxomfcoodfaD  i s;t0s2xoxr3oydam   nvil()aDtrxrpot0oeeoii3iyt m2ea(vp t)aetnir3io1lp r u i (0setm(o3io4ll  mnvt (  Draxroou4altnif3ias aDulnvpnt)texnxociadfptrluvo;t0 rtr(m nodlm nlivsa( arur(mp;o0tpt io3ias a el(monu) lenmociatfptrln o;s)sruoir iu4lmee ictat s2um(rooo1altoiietltlaDelu ont0 eermrcoydlpt  ueols s2toim nu1oltemfes s s2urum ;o0apeo f3tatfs ra( p;()tlxnmfctadoat aneol(0seumimpiy4ape mics ()artmxmo;t1aeto ociatlaDemumpnu4trtnxr3tadfatrln o;t) rxm(o3nydlptnlfcs sfarumxmont4apx iieiltfa el( s;u) eeomo oodfaDelnvo (  exmio3iy4om emfvias)aDrm(mooo0tpeo octatlsDran o;(0tetrio oydfpteluvsl(  rtrir nu4amtnlicslsf rua(m nt4alenmi3iytlaDra(vs t)trxoxf tadlp eau ilt) rumir3io4ll elfet tfsDtrx  ;o4olenifeilslaDumums u)teerxo ty1lpD livs;t)sexrio3no1al e ivi (f 2umumoou0oeenmfciadls eanvp u0aeerif3oytfpte nvils0 eumiopiydlp nlictasf rua(m ot1aeenmieilslm2ra( s;u)artnir oodfm e ivi s s2tr(m io4ap nmfctlsf rtaurpno1tlxo oetatfa2um(vpnt)aeeriocoodlaDrluvs t sexoimpiodalt lnvtl(fsrrmxrp;o4aex  oeiasfm2um( s u) lxnmr oodfaDeaueo;t s2urimpou4ll nlivt t a2truronu1tex miciasfs rm( pn() ltoio tytfp rai s;t0seur(o3iudomt  fvta() rurx pot4tpenii3iytfm2ulnvs;u4artnmo3oatfm  aneo;t0tetrir3ny1altnmietltf 2ur(ronu1altnii3ildfm2elu p t4 ltrxfciotfmD aueo ()sexmxr ny4am e fcsasfaDtr(rpno1alt iieiadla2rlums;(4 leriociodlp r neo t)teum(m3io1lm e ncsls)srurxrpnu4alxomicias aDumnvo u4alxomf3tadoa e nvo;t)sexmxopoudamtelfctatfartrurpou1tpxniictyt a ulnvs u0 reoif3oa1laDran s;s  rxrxo ou1omenlfci s  Dra(mp;o0apeomfeiatfm2um(vp u)artrio3iytomDrln olt) rxr(o no1aleemfeilsfa2ta(  no0oex  o3tadfs umn p t4trxnif3todlpDelivi s0trtmxr3ny1amtn neil(  2trxr oo1apx mociysfaDum(mo;(0 reomf3oo1lat anvilt)sexoio3iy4ol   iesls)sruau oou4opxn ociat a2ulnvpnt0arxoio3iotomDeln s;(0t2trimpnu1lpen fvils a2tmx pou1oet  feiatls2raums;t) exnmrcty1fpD aues t)trtmxo no4ope lnctlt sDuaxm ;o1tpxn iciasfm2rmuvsnt)texnmf3oadlp  lu i t)teum(r iydoltnlfcslt a2tr(rpnu0aetomiciysfmDumnmon() rtnir ootop elivi;(0tetm(r nodap   icsl() Dum(mo;o4olxo ocildfs ranvs u4 exoxrcia1op  lnvi (0trtrir3iu4apte ivtl()srrmumpot0teenioctld mDumu on(0 exrifcty1om rln ols)t2xoxo oy4omenlict (fs2tmu p;t0tpeniictlsls2um(von(4 lenmf iotlaDeauesls0t2xo(opou4ol nlivilt)a2uaur no4optnmiciysla ua(vp t0tlxriocoy1fpD ai slt s2xoxo3iydlmenlfvsl(fa2ta(ro;t1altnifetad mDrl( s;t0arxnmr3ta1omDelieil(0 eurxm nu1ol   fcs (fsrrmu pno1tleo o3iltfsDemums u) renmf3ty1lateaivi s s2umxrpou4lpeemfvsa() rur(monu1tlxnmicildlmDrmumo (4 eermocoo1latrlues (0trtmir3nudole  fcsas) rurxroou4teeniiciltlm rmu s;u4aleoif oodla   uvo;t srxo(mpoodamtn fvsat arrauroot4tpxomocias m2emuvsnt)arerxfcta1lmt  n ils0teumxo oy4lm   ietat) Drr(mo;o4ape  f3tys a2ulu o u0 eenmrciytlateaivs s) ruoxo iu4opee fesa(  Dtax  nu4ope mociatfs rl(mp;(0trerio3todfmt luesl() 2trim3nu1llen fesatfaDrm(rpnu1opeomociyt aDrauvo u)tltrmf3oytomD livo () euoim3oy4lle lnes () 2umxmonu1altn feias m ulnvonu0 ltrir3oa1lp rau o;s) etmxm nodope mnesl(  rtrxr ;t0texoiiciyt sDea( on(0 ltoxo iy1lat ai il(0s2xo(m3nu4al  mfvs t)aDrm(  ;t4texnmocilsfaDrln pnt)areoxo3ootlptrlies s0trtr(m iudape lneslsfarrmum ot4tpt  octat s elums;t0 renmf todfp rlivo;() rtrir oudlpenlncslt)a2taumont0tlxo ieilslmDumnms;(0alermo3iy1oa rai o ( truoimpnu1llte nvsa(fartr(roou0teeomfetltfa elnvp t4 lenmr tytlmtrlnvo;()trxoirpiy4alee ieil(f 2tru  nt1oet mictysfmDrmumonu4arenif io1lpD anvi;()truoirpiy1lmeemfvsl(f 2ur(roou1teto ietasfa2rmu p;t0 lermfcto1fmtrli o;t)s2xo(m3iy4lm n iet s aDtrx o;t0optnif3ilt m ul( p;t) eermf3tytopt aivi s0s2urxr iudapenmieias  Dtr(rpot0oeenioetyt m2rmu s t4alenmf3oy1oateliei s0 euo(opiy1om   neia()arurx p;o4tlt mociysfaDranvp ()tltniociydlp eln s;(0sexmir3nudlm  mnvt s s2taur ;o1openifctasfa uan o t4trxnmo3iytop e nvo s) eurxr3oudlle  ictlt)sDtmxmooo1apt io3iyt mDel(mpn(0 etnmr3io1lptr nvo t0trxoxr iudom elfvtas aDrrxro;t1tpx iicildls2emn p ()artrmf3ia1op eauvi;t0s2um(rpiydlm emiesl(  rua(moou4optoiieiat a elumonu4trtnif iadlmD li i;s s2tmxr3iudlpeemfetls)arumur ;t0tpxo f3ils m2umu o;t0arxnxo3oa1fmt lu ils)seumxm nydalt lfvsl()sDrr(m ou0tlxo ieiyt m2um( o (0trtomo ta1fmteli o;()texmiopnu1lmee nvtls a2tr( pno0opt mociadfs elnvo;u)trxrmf ta1oaDrau i t)texr(o no1lp emfcsl(f 2rrur ;u4olt mieiadfs2uln p t) lxoir3iotopDelivol( t2xrimpnodapeemnvt t  2ta(r no4oet mo3tysfa rl(ms;t)aeenmr3iotfa elueo t0 eur(o ou1lpee ncta() rtaump;o1tpto o3tydfm ranms;u0treoxfciatlaDr u o;t) etrxr ou4lpe mivi s  Dtrump;t4optoii3ilt a2ran o;()aexrmf3totlm rln i () etoxr oydlltnmneta() 2tau pou1apxn feiasfm uan on(4 rerir oytfaDeaues ()t2urir iydam nmnvt s) Dtmur ou0aptnmictytfsDelnvpnu0aleomf oo1op  an s;t  2tmxmpno4llen ivs s sruaurono1texnifcils a uanvs;() rtomf todfaD au i;s seuoxm io1lmteliei t) Duaurpou0ale ii3ilslsDul(vont0aetnmrctadfaDrluesls)t2xr(r3iu4olt  nesltf rur(mpou4ole  i3ilsla2el( s;u0arermrciotop rln ilt)seumxo iy1amt miet tfa2rr(r ot0alenmietytfm2eaumsnt4treoxr3tatla  an o;s0texmimpio4opt licia(fsrum(mp;u4optomf3tatfaDumnmpn(4 leoircta1fm   i o;( srurxm oudolte nvtls  Dta(roou0aexnifeils m2ul(mpnu4 etnxr tydfat anei ()sexo(m io1omt  fei t)a2urxmpot1aptnmfeiadfaDum(mp (0alenxfctatfp e ueo;t0seumxr3nodoltnlfei (  ruau poo1tptn o3tad sDumnmp u0arxnmocoydlm  aivi t0 2umir3io4lmtnmneiat) rraum no1tpto fciysfaDrluvpnu0 rxrxr oadlptrai olt) exoxo iy4lmenmnvsl() ruaur ou4teeo feiysfa rmnvp u4texoxo3oa1opteluvilt teuoxrpno1amenlfeil(f 2rmxro;t0oex miciydls2ranvo;t0arxnxfcoo1op  anes (0s2trxo ny4aptemivt t srua(r no0teen f3ildfa elumonu4areomf oydom   i o;s0t2uoxmpoodlm   nei tfsDuau onu1alen oeiys m rlu snt4tlerxr3tatfmDelnei;t0 exr(o3iodlm eliei s srrau p;u1oexnmfeiys s raump;u4 lxnio3oo1la eai i;( s2uoxr3nudol emictlsfsDrr(m nt0aetoiiciltfs2uau ont4 ltrmocta1lp   i sls  exmimpoo1om  lfct sfa2trxr ou1aex ifeiadfs2raumo;t)aexnir ta1opt  nvs;t) eumxr3no1lle mfvi s aDumu p;t1tpeo feiltlm emnmp;t4 exoir oatfa rln s t0t2toxopou4omenmnesat s2tau  nt1apto octyd a2ranvs;u0arermo iytfm r nvo;()s2umxopoo1lpt lfvta(farrru  ot0altnio3iasfs rlumo;(0altnmoctatfp  lieo s)t2tmirpiudll e nesas  rtax  no1aeto o3tadfmDemuvp;u4tlxnmf3ia1latrlu i;t seuo(opiydol  licsat) Dtaurp;o4tleo i3ilsfs2eaumonu4arxoxo tydlat livils)seurxrpiy4olenlivta(fsDtmxmp;t4opxnii3ild a uanmsn(4aetnmrciadlpte ues t0s2xoio3ny1lm nmnvia(  rtrump;o0opxomi3tltlmDemumsnu)teerxf ootfmDranvi;(0srxmim oydam emivsat)sDuaxr ;o4alt ifctldlmDrl(vsnu0tetrir iy1fp  livs ( teum(o3no4ap  lfvi (faDrr(mp;o4olt io3ilsfm2um(vp;(0alerir3ia1lpDrlieo ()t2xo(r oo4amtnmfct () Drr(ro;u4alenmfciaslmDel(mo;u)tleoxf iadfm  li o t0t2uo(opiy1op  miet t)a2uaxmpou4optn fctyd sDea(vo;t)altrxf to1lmDrai i;t trumimpnu4lmen feia( arumu  ;t1tlenii3ils a2rmu s;(0tlxnirctatomtrli o;(0sexm(r3no4ll elfvtl()artrumpno4openmf3iyt s rluvs;u0 ltnxo tytlm rlueo;t sexrxr3ou1opeemfvsatf Draumonu0aleomoeiatlmDem(vp;u4texnifcoodfmteaivo;t srtmiopoo1op nlfeia( sDrr( o;u1oeenioeiad s2umnms t)tetnxr tydfaDeaueo;t srxmxopoydam emiviasfa2umumpot4tptnio3tlsfaDrluvpnu0 rtnxo3totfat lu s;t) rxm(opoy4ol  micilsf Dra(r nu0ope miciytlm umnvo;(0aleoxr oodla   u o s)texo(o3iy1alt  iciltfa2umuront1teenmoctldfm rmu ont)aleoxo3iadopDran ols)teurxm oodlleemfvt t)s2um(mo;t0texniiciytfs rl(mo;(4teeoir iatfmD luvi;t t2urio3ou4al   ivi tfarraxmpnu4tpxnmf3ild s ranvon() etrmrciy1opDeanes s  rumxm3oo4ol elnvs (fs2rmxmoot0tptomo3iad s2uluvon() rtoxr to1fmDrli s (  exmxm iu1lptelnvtat arraxm nu1alx miciaslm2ulumo;t)alxnir3tytfate i s t)t2uoxrpoy4lp nlnetasfaDurx pnt4opx io3tyt m emnvon(4trermrcio1lmt lies;()t2xo(rpno1optnlnvsat s2rrxrpot1ope  ieiad m rm(ms t0trenmfcoa1lp elieslt trxmxrpio4apeelivsas aDrr(rpnt0optoiictat sDel( s;u4aetrirctotla  lneols t2xr(opoy4lp   icslsf 2rau o;t1optn fctldlsDra(vs;t0teeoir ta1lmDelueo;s0s2xmio3nydal e fvilt)s2tr(rp;o0apxn fcias m2ul(vs u0aexrmr iatlat ai sls s2urir3iy1alenmies t  2rrxm ;o0olxnmfciatlm uauvs;(4alxnmr3iotlmtr n ols0t2xoimpiy1ale mfes (fsrtmx p;t1apx mo3ilsla2ea(mpnt0trtoio io1opDeanvo;t)teumir iydoleemivs s) 2urxmpno4oexomoeiysfa emuvp;()aetomocoy1laD livsl(0s2xoim ou4aleelivia(f Dum(mont1apx mo3tls m eluvo;u)aexrif io1latran o s0tetr(r3iudlle lnesat) Duru  nt1tlt  o3ild m rmnvp;t)aleoir3iy1fpt liesl(0 rxmiopoy4omtelivsat) Dum(m ;u1texomfetldfa2rmn p;(0tlxrxr3tatomDeaiei t)sexm(m iy1am n fctatfsDrmxmono0aetomf3tyt a ua(vs;(4areoif ty1lp ean o;s) exmxo oodll emiesatfartr(rpoo1aetnmf3iasfa2rm( s (4artomfcoa1om r i i t teumxo iu1llenmivsls srum(m no1aexo icils s2rm(vp t0altrif oa1opt anes;t0s2toir3nodop emfctas sDtr(m nt4tlt  fctadls uaumon() eeoifctytom elivo;(0 exo(mpnu1op   icta(  Duaxrpno1tex if3iaslmDra(mp t4 eeoxf oy1omtranvs s  2uoim iu4ap elnetas  2raxmp;u4apxoifeiyslsDranmsnu4 etnmo oodla  ai o;s) rumir io1omte ivtas)arurxm ou4tptnmfetasfa2el(vo;u0 eeoxocoy1fpt  u s;t sexoimpio1om n iciat)a2uaumonu1tptn i3tld s2em( onu0aeerxocto1lmDrli o;t) rxoxr3oodoltelnciat)a2urx  nu1tetomo3tat m um(mo;t0 ltnmo iotfpt  neo;t s2xrim nodopee ivt (  Drm( oot0alxn feiadfm2rauvs;u) rerxo3ia1om eanvs;s) 2xmimpny1olenmnvs s) Drm(roou0tetniieiadfm2rlu o (4tltoxo3oy1oa e nei;t)truoimpiodome mfet (f ruau o;o0olxomicildlaDua( pnt0artrmf3io1lm r ivs;s0 etr(rpiy1lm nmicsa() Dtm(r oo0aexo fetatla eaumonu0 lenmf oo1lmte n o;t)s2tr(m iudol  lnvsa()srtm( pot0tlxoiociadla raumon(0 rtrxr3ootlmDrauei;t srxoim3oydap elietltfaDtrxmoou4aptnii3iytfs2emn s (4teenxf tatlptran sl( seurirpoydame mnvs () rtmxr nu1oeeomfciyd sDum(vsn(0alxnmf3tydlp  lu ilt)sruoimpiu1amt  ietlsfaruaumo;u1texoiieiad s2rln p;u4alerxf iatoaDrauvi;()seurimpiu4lpen netltf Drmxm ou0tlt mfctytls2rmump;(0tlermr3iydfmDr ivs;s s2urxo3oy1amt  ict tfartmumo;t4tpx  o3tldlm2elnvp t0aeenircoadfmDeli s;s srtoir3nydaleelfcs s arrm( pnt1tptnifctltla2ean o;t4texrif io1fatr ivol()texmxm3no4ope  ncils a2umurpnu4apto o3tltfaDulu onu0texomr oo1oa eli ols srxrio ny1lme miei s)artaur oo1opxn fctatlm2elnvont)artrmo3tydomtrlnvs s  2urxrpoy1op nmfctl()sDuaum no0ole ii3iadlsDean o;t4 lerxoctotlmte nei t0srtr(m3oudopt  nvi t)arraxmpou1ole  i3iytla2ean o () rxnmo iodopDe i o;t)sruoxr3oudom
\ No newline at end of file
@@ -0,0 +1 @@
+uvilt  exm(o3nodlpe mnctat arumxm ot1tpxnmf3tldlsDrau p (4altrmrctodfaDrlivol(0 etr(m3ny4ll nmivslt a2ururp;o0oleoiicildfsDuanmo;u4teenir3io1oatelnei;(0t2tmiopiy4aptn nvs t)arrmxrooo0olxn o3tatfa2ran snt4arerxf oy1om ranvi;t  eumio3oydaptn fesl(f Dum(mo;u1tleo feiydlaDelump ()aexnmo3ia1lp ranvslt)tetmxm3io4lptemncsat) Dra(mpnu0apeomicias s2eanvpn(4 ltomr iadom e u s;(0sruo(o3iy1om nlfci t  rraxrpnu0altomo3iat m2ranmsnt0aetnxocootfpt lu i;(0texmxrpiodllte net (farrrxrpoo0apxnmociatfm rlu pn(4 lxoif3oo1op rai slt0t2ur(rpoudam  mfeil(fsrraxro;u4olx  o3ildfs2el(vs;(4 ltnirciytlmteai s;s0truoxr3ou4lm n fviat aDtrxm ot1tlen ocildfaDumuvs (4aleniocoa1oatr neil()s2xrio oodole micsasfaDrmxrpnu1texnmieiat m2rm( pnt)aleomf3ootom e n i t  eur(m3oy4op emneias)aDua(m ;u0tptoii3iydfsDeln pnu4tlxoifciotfp eaivsl()trxoiopnodame mncia(f 2tau ooo0teenmoetyd aDeaump t0arenxf iodfmD  ies;(  rxoxm ny1lltelnvtlsfaruau ono4aetoii3tatfa2rl( pnu4trenmr3oo1lp rai sl( texmir3oo1lltelictlt)srtr(  oo4oltnifeiytlm2um(vp (4tlerir oo1lp eli o;t)srxmio nu1lp   fci s aDtax o;t0aleoifeiys m2umuvs u0treomr todlaDr u slt0 exmxm3iodlp   fvs ()srtrum ou1tpx  o3tltlm2rmu o u) eermfcoy1omD lnesls) rxmxm oy1lpenmfetlt)arra( ono1altn oeiytls ua( o u)alenir3iy1opDeaiei;s) etmio oudalen ieta(f 2uax  nu1aeen ociltls umnvs u0aeerxfciodfa e ivi t) 2xmirpoudope lici sfa2uau  ot0apx iociatlm2emnvp t0 renifciotoaDran o;( srxmxo3ny4amenlnvslsfs2tmumpou0apx  feiad a ra(mp (4arxomrctytlpD an s ()tetmxr3iy1ole mfcs (fs2rmu pno0apx ifeils sDulnmp ()arxnxr3to1lmtr nvslt  ruoxmpno4omeemfei (fsrurxr ;t4optnif3iltfm rl( sn() rtoxf oy1fp raiei s) euriopio1lp emneil(f rua(r ou0openioetlsla2ua(ms;(4 etnmfcta1fp ranvols0 rurxm ou1lm nmfcia(farta(rp;t4tltnifeiadls2uanvo t0aeenxo3ootfm r ieo;s trxo(mpiudll nlicsls) ruru p;t4tle  oeiltlaDemnvp () lxoiociydlmD livils) 2tmir3iy4lpen nviatfa2raxm ou4tleoifeildlm eanvp u0 ltrmf3totop eai o s0s2ur(r3nydolenlfvilt  2ur(  nu4opt mf3iytfm ul( o (4tltoioctydomteaueo (  2tr(o3nydoleelivt t) Dra(rono0teto o3iyt m umnvpn(0 ltnmf3oytlpD anesl()trtoxr iudlpe  fctat)aDraumo;t4apenmo3iytfa emuvpn(0tltnxf3ia1lat aieo t t2toxm ou4amtnlicsls  2trurono0optomi3tad aDuln pnt0aetnmrcoadomtr ivi;t truo(mpoy1ope  ieta(  2uaxm nu4ope  o3tydfmDeaumo () rtnircoa1laDr iesl() rtmxopoydlm nlnesasf Drr(mp;t0tlx ioetydfa ra(vo;u)texoxr ootfm eai i s teumxo ou4lm nmivslt)aDrm(  nt1tex mieilsfsDulnvont4tlerxo oodoa rai ils) rto(r3ny4llen iesl() 2tm(rp;u1oexn oetytfm emumpnu)tleoxrciotoat luvilt0s2urxm3iu4op   nvs s  Dur(moou4opxn fciat mDua(vp u) eerxo3oo1laDe i i;t0srxoiopoydam  livtl(fa2rrxmo;t4tpxoif3tldfmDranmp;t) lenmfcty1omtrlivi;s)trxmxm io1omtnlneils a2rrxmo;o1texomoetysfs2rauvo;(0trtnircty1omtraueo s)teurxmpiudlme micta() 2um( oot0olxo feildlm ua( o u4 rxoif tatfptr ivs s0trxrxmpiodam emfvias)aDrr(mp;u4tle  oeiatla2raumsn() eeoif oadoptelnvolt) etoir3io1aptnmnvtat s2rrur nu4texomo3iyslm2eanmont4alxnmrctatlpDeaiesls  2xr(m ou4lle licsas sDraurp;u1altnmfcias s ul( o;()alxrxr3iadfaDeauvi;t teumxmpnudoltelnetat)a2ra(roou0tlx mociatfa2rl(mp u0texomr ia1laDe u o;s0teumxrpny4ap  lnvias)sDumumpno1openii3iad s2ua(mp t4artnxr3oadopD  i sl(0 etrio oydom nlieilsfs2rau  ;o0aetn fcildls el( s () eeniociatlptr u i s) exoxmpny1lpt  ncsl(fsDtmxrp;t4aee ii3tldla ul(vpnt)tleoif iydlpDeauesls0 2xr(o oy1ol e fesl( srtmurp;u4altnmieiasfs2rauvo u0tlenmf iodlmteaieo ( srto(mpnodlmt  iciatf Dra( o;o0tpxoifeiyslm umnvp;u0 rtnmo iotfmtelu i s  2xo(m3nodale lfesas)aDurx p;o0tpx mf3ildlsDra( s u) lerio3iatlp rln o ( t2tmxr oodlm emfetlsf rrau  ot0alx  ocildlmDea(vo;t) rxrif3iytoaD auvo;s seuoxopoodlmt mncsls)srra( pnu4apenio3tadfs elnmo;(4 exriociydopt ln s ( t2tmxm3nu1ap  licia(fs2tmu pot4oet mi3tls s2ulu s;()teenifciadfmD lieol(  exoim oo4al elfcsasfsrur(rpoo4ale ii3iad m rmumpnu) reoxfcoytom rlivols tetrxrpny1lmt  nei t) 2umxm ;u0optomi3ils a2emu ont4 rtoxo3oodla r nvi t tetoxmpnudlpenlivia(f Dtr( p;t4tlxnmiciytlsDum( p;t4 ltomf iytfmt  ies s trxo(opoy1omt mivil(fartmu o;o4apto o3iatlm2umnmo () eeoio todoa rai o;( tetmir3nydapeemnetls)sDrmu poo1alen ietlt a2ua( ont)aleoxrcoatomDe uvi;t) exoxm io4lpt  fct s) ruauronu0alx iociysfmDeau o;()tlenio3oytoptean o t0tetm(rpio1lp e fei (f Drrx p;u4apto o3tyt m uanvs u) eeomr3oy1opte uvi t)s2uo(r iy4op  mnvs (f 2rmx pno1texoiicilsfm ulu o ()trxomfciatfptrau i;s t2uriopnodom  lfvt (f rrmxmpot1tle mociat mDra(ms t0arxrxo iytoaDe u o;( srxmxo nu1ope  fvsl(f 2taxr ;u0oltnmfciatlaDul(vs (4tleoxrcia1lmDrai sls) rtmxm3oudap   nvias)aDrau oot0oeto iciasls2ulu p (4alerxf iy1lp  ln o;t0t2tmxr oo4lleemfetlsf rrauro;t4tlt ifetatlaDuaumo;t) lenir oodfm e nvil(0 etmxm iu1lltn nvi s  rrrxm ou0aexnmieiasfa2ulumpnu0 etrircty1op e n i (  rurxmpnu4amtelicsas) 2uaxrpno0opeoiociyt s rmuvo u4arenmrcootlp   neols)tetmio oy4ll n net t) 2trx oot1apxoii3tyslmDuanvpnt0 rxrmf3tadomD  n slt srurim3nu1om elnvtl() Dra( pot1alxoifetlslm2rlu o u4arxomr3ia1lmtrlueo;s)trtr(m3nu1open fcilt srurxrpoo1olxomo3iat mDrmnmp t0trtrxrciadla elueilt t2tmxr3oo1lp elncia()srumxm ;u0alxn f3tad aDeln p;u4texrifctodop rau i (0t2trio3no4ome lfcs s)a2ua(mpot4tpxnif3ild s2uau p;(0arerif3ia1la elueo t  2um(opio1apenlncs sf Dumx pno1apxomociysfm rauvsnu4arxomfcoy1latrlnvs () rtmxm io4lp nlnetls)a2tau ooo1aeeo icild aDem( onu) etrifciotlat lu il()s2xrxm3nudole lies (  2tr(  ou1opt mo3iasla umump;(0 reomo3iytlmD luvo t0s2xmio3nu1lptnlfct ( srrrxr ;u0olxnmi3tlt a2umu pn(4 rtomf tydfateai ilt s2toxo3oudlpen fvtlt a2tmxrpou4tpxnmiciasls2rmums;t0aleoir iotfmDrluvs;s)t2xrxo3nu1ol n ivsat a2tr( pnt0tet mfetldfsDelnvo;(4alxrxr3oodlpDeanvi;()t2toio3ou1lpe lnvt t)aDta( o;t4aeto i3tat s2ulu o u0 lxoxf3io1fatelieo t s2xoirpiy4alt lfeia( sDtr(  ;t4apxn iciytfs umuvsnu0texnifciydlaD anvsls0 2xmimpnydll nlicil()sDuaxrooo4aeeomoeiasfs ul( o ()teenif3ootfat aueils0t2urxo no1omt mfvtl() rumxr ;o1apxomfctysfa2rau s;()texrxf ia1opD  ies () euoxmpnydllt  ivs () Dur(rp;u1tptnmo3iydla uanvo t4trerir3totfmDrauvo s) 2xmxo3iodlp nmnvils  Dtaxro;t0tpeoii3iadfmDum(vo;(4arenmrcio1lmDeaivsl()t2uoxr oo4lp nmnesl(fsrtm(m no0aptomi3iysfm umnms;t0artnxo3oatfpDrlieils)sruo(m iu1ope livia(faruax  ;u0apxnifctlt aDrlu s;t)tlerxr iy1fm   i il()teurxmpiu4am n fcs t)a2urx p;u1apt mfcilsfsDul(mon()aeenxrciytom ranvilt0 rxm(m3oo1lpt mfcia()a2ta(monu1opeo f3tltla2rmu s;()trenmr3oo1fp eauvo;(0 2tm(rpny1ale mneia() 2urx pot4aex io3iadfaDul(vsnt)texomf tydlptean s ()t2xrxmpno4llen fcs (fa2umurooo4oexniietld s eanms;u4tlenir3tatlmt lieols trxoxrpno4ole  fvta()arraumpou1aexoiiciltla ranms;t) lxoir3iatlmt an s;t)texoxm oo4openlfvia(fartax  no0tpxnmieiys m ea(msnt)tleoxf3ia1fpDeaivolt0tetoxo3nudlm elfvilsfsDuaurpno0tlxnmictlsfsDemump;t4tetnxo tytoaDrluvo;t sexoxmpnydapee ies (fs2umx o;t4apxo oetatlm2uln pnt4 lxoiocia1opt ai ilt) eum(rpoodom  mncta(faDra(m nu0teeomociytla rauvon(4arxomocoytfm   ies s0srxrxr3oo1lptemfetatfsrta(moou1aeeo ieiytls ulu o u4tlxomr oytlateau s t)srur(mpnu1optelnvil()a2uax  ;u1ale micils m rmuvo;()trtrxfcia1laD ln o s0t2to(m io1lp e fcsl(f Dtru o;t0apxoif3iat a2eanms;u0teermo ia1fpt ln s;t  eur(r no1lm  mfvi t sDtm( p;o1oeeomf3tyslmDrl( snt4 lxomfcoatlp eai i (0s2tmir3oo4aptemnvs s a2ua(r ou4alenmi3iysls ul(vsnt4 rtriociadfm rln o ( srtoim nodlptn ics () rra(rpnt1altn fciysls2ulu o;u0 exrir totfa raieo s) rxrimpoy1al elfvsas)s2truront1tptniociytls2eauvp;u0 etrxocto1omt aivo t0trxo(opou1altnlfeiltf rta(r ou4aptomicilsls2umnmp t0 leoxrcootfmD lieilt0trxoio3oo4omte ics s) 2tm( o;u4oleo ietad m2ul( onu4 etrmo oodlmD ai olt0 ruoimpoy4altn nes () rtaumo;o1tleo o3taslsDuln o;t0 reoxo oatfpt lu i;s0trurxmpno1omee fvsls sDururpou1apeo fetatlmDulu p;u)arxnxoctotop rln o;( srxm(opnu1amenlnes s aDra(mp;o1tltn o3ilsfaDelnmp;u0 etrxfcta1fp rluvslt srto(opou4omenlfcils) Dtm(r ou4aee  fetadlsDra(vs;t) ltrmfcoadlaD luvilt)t2xrxm nodlm   fcil(  Dumumpou0optomoeiltlm rlnmo u0aexomoctydoate ues;t0 eur(r3iodamte iei tf Drr( pno1tet  feiadfaDrmn onu0tlermocoy1lpDeaieils) rtmio nydolenlnetlsf Dtr(  no4oeeoiiciysls2elu sn()artrirctodfaDelivi;(0tetmir oo4lmee fct ( aDum( poo0opxniociaslaDemuvont4tlxoxr3oytlmDe ivslt srxr(r3oudll   ncsas a2tm(mpot1oeen fcildls2ulnmp;t) exoxfcty1la rlu i s0 rxrim ny1lmee ietltfaDrr(mont0ole mf3iat mDuluvpn() exoxf3iotoa   ies;t s2to(r3oo1llt lnctas) 2urx oou4oetoio3ilsfmDrmu p;u0teermf3oadlp eaueolt  exrim no1aptn nes t  Drm( ooo0oetomf3iysfsDumnmpnt4aeenmo3oy1om   uei s trurio nydome licsasf Dta(  no4tetoiieias a2emnmp (0trtomfctotoaDe uvs s s2toxr iydome mfci t)a2trxrooo4alxoifctld aDuln o;() ltomocoy1fpD anei;()srurxopou4ameelnvtlt)aDtmxm ;u4oexn octydla2rln s;t0tlenmf tadop  lnes;t s2uoio3oo4omt miei ()srtaum nt0aex  fctltfm ea(ms ()aeenxr3todfm e ueolt srtmxr oydlm n fcslsfsDtmxr nt1olt  oeiys s2ulumo;t0aleomf tatlateluei;s0 rxr(r3nydam emfei (fa2tmum ;o1aex  f3iatfs2rlu snu4 ltrmfcoy1fm  anesl(0 exmio iodlltelncilsfaDra(ront4olx iiciysfm2ua(vs;u)altnxf3oo1fa  livo (0tetoio3oy1am n ncils  Dtaumoou4tlxn i3iyd s uln p;t)alxnif tatomt au s;t)sruoxo nodoleelfviatfs2umxro;t4olx  ietldfsDul(vo u0trtrmf3iotfpDrlieslt t2uoxm3no1apt  ncsas)sruaxmonu4tlx ifetytls2ean pnt0teerxf oatfmtelivo;s)t2to(o3no4apeemncil(faDrrx  ou1olt iociad a emumsnt4 exoir iotlaDe ueo () 2trxmpio1lpenlncias)s2raxmpou4oltoifciysfm2umuvsnt4aexrxf iytoptrluvo (0teurir3ou4aptemicsa(fa2rmxrpoo1aet mi3tltfsDem(mpnt) eerir3oytfmt  nvslt)texm(r iu4am elnei s aDra(r oo4apeoioeiyd a ua( pnt)treomo3iotopD auei;s) exmim3nu4optn netas)aDum(r oo1alxnmiciyslaDuanmo;(0 etrxfcty1lpDeaues;s0sexoim nu4ome mncia( artmurpot1tpenio3iysla rmn s (0teeoxr oytfm eaiei s t2tr(r3iydole  fcil() Drr(rpot0tpt ii3iyd mDelu p;(4 leoxf iodoa elnvslt0t2umxo iy4al emiviat  rtaxrp;t0aee mieiytls2emnmp;u0arxrxr3tytoa eauvs (0s2xrim iudlm e fetat srtaxm nt1tetnioeiltlsDelnvp;u)altrir3iadlatrln s;s) 2toxo3oy4op elfci t) rtmumo;t4apt mieils a2elu p u) rxrxr oa1oaD livsls)s2xmxopno1op nmnci t sDtaxrp;t1tpen f3iad a ua(mont0trtrifcoo1lmDrlueol(0trxoxr io1amtemivs t) Dtmxm nt4alen o3tat aDum(mp;(4trtoifctydomt au i;s0srto(rpoo1lmtn feiat) Drau ooo0oee iociltfa2umu o;u0aeenxo to1lmDr i o s teumxopoo1lle lfvias)a2umx oou4aexomi3tlslmDumu p (4aetnmo3oy1omDr uvs s0trxmxo3no1amtemfvs (fsDtmumpou1aex mfeildlm ul( s;t)arerxr oy1fmD  i s (0s2xr(rpnydlm   ieta()sDuaumo;t1olenmiciadfm2rl(vs;u0 eermfcoodfpDeaivsls trtmio3io4al   fcsas s2ta(  ou1tpxn i3tlslsDrl(vs ()arenxf io1omD luvi;t)seurxopnydaltn ncsa( aDrmx  ;u0altnii3ildfm uauvs;u)tlxrmoctatfa e nvo;( setoxr3nodomtelfvta() Dtmu ono0oeeo o3ilt a2umn o (0aeenxoctotlm rlnvslt t2trxo iy4aptnmivtltfsDur(m oo4aleo fctyt m ran s t)aexrio3ootopDrli i;s0texm(rpio4aleemics s)srum(r nu1olxoii3iad a2ean s;()aeeomr3tadoatean i t)t2umir3nu4lpt  nvsat) Dtrxr nt0oet ifeils m2rlu p;t)tetnxo3iadop eaiei t0tetr(m3oy1ol nmnvs (fsrrau o;o1aet iocilsfm umuvp;t0arxoif3ia1lpD  ueol(  etrio3oudom e iviat artrx  nt4tlto i3iytls2ua(mo t4aetrxr ta1om  aivi;t seto(r3iu1llt  fcia( aDraxmo;u1teeo o3tydfa2rmuvs (0teerxf3ootomD auvsls)truo(o ou4am e fvi t) 2ururpou1alxomoctat a2eanmo u0trtomr3todfmD  n sls0 etoio3oydop  lietl( aDra(  ;t4tlxo iciytlsDrlnmo t0artnifciydfatrluei;t  rum(o oy1ap   net sfarrmxr ;u0tet mi3tasfmDum(ms;u0aeeoxrcoodlatean sl()trxrxr3iudome mnvtls sruax p;u0tptnmo3ias sDrau on() reriocty1fpt aieo;t0srtrim3iy4amenmnet s)s2rau  oo4tpxn oeiyt a2ul( o;u4tlxriocootla rauvs s)teumxr nu4openlfctat s2ta(r ou1tet iicildfaDel(mp;()tlenxf oo1om rln s;s texmio3oy1lmtnmfvtl( a2taxm ;t1oeeomictydlm rm( snu0aeermr3iytfm eaieo ( t2uoxr3oo1alte nvtas  Drmx  ;t4tpeo iciatfmDuanmpnt0 eeoxr3to1lateln i s) etmio3iy1llenmiesls)aDta(r nu1oexnii3tys aDem( o u4arxrif ta1lm r ueilt0s2xr(mpnudlptelfvt tfaDuaur ;u4tle  o3iys mDranvp;u4texrxo3ia1omD an slt0 2tmxr3io4alt  icsl( sDurxr ou1opto feiyd a em(vs () rxomo3iytfmDr nei;( t2toxm no1lpte iet s artmxmpnt4alxomfctyt sDrmnvp u0trtomfctodopte iei t truoiopnudame licsas  2raxr ou0ape miciat sDem(vp u4tltrif3iytlp elnvi;(  rxoxrpiy4amtn icilsf ruaxmp;o4olto fetadfsDrmumon() lerif io1oa r u o;()trtmxmpoy1ol   ictltf 2tmxr ot0opxomi3tldls2emnmp (0 rerxr oo1fa r uvol(0s2uoim iodll e nvt ()srrau o;u0olen o3tyslaDum(mpn(0 lerxr tatlatelnvs s0trto(o io1lp   ivil( sDumu poo1oetnifciadfmDrmnmo;u)tltnio3oodfp r iesl() etr(rpny1omeelnci () ruax  no1tptnifcilt s2umuvsn()aetoxrciytfpD aies;s)sexmio3iy1om  mietasf Dtaxr ou4tpe  i3iydls2umnmsnu0teermfcoydla r neo t)s2tr(r oydameelncsl(  Drmu p;o1teeo o3iadfm2elu p u4teenmo todomt ai slt  euoxr oy4lp  mfcta() Dtr( o;t4oetnifctld sDrlnvp;t4 rtoio iydoaD ln slt)t2trirpiu1om elnesa()a2trxm ou1aptoiictydfm2uauvo t4alxnir3ia1fpD livo;s) 2uo(r iydape lfeta()a2tm(m ;u0tltomociyt m eau o t) rtoir3to1op   nes;( s2xrxr3ou4opeelivtl() rumxm no0tpe ioeiaslm2eauvsn(4 lermr iotlaDrln sl(0srxrxr3nu4aptelivsat)sDra( ono4tlt  ieilsfs ua( o t4artnxfcto1la r nvs;t0 2um(r iu4ame mnviltf Dra(rpno1alt io3iatfs ra( o u)artnmfcia1omDe ueo;t teum(r iydlptemicsasfsrtm(m ot4tlx mf3iys s uan pnu4teeomo ia1fatean o s)trtrxmpoodol nmicia()a2rru  ot1oltn ociad s eln snt0 ltomr oy1lpD  n i;s0t2umiopio1lm nlncias)s2urum ;u0tlto fetas m2ulnvo;u4 rxrmo iatfptrau s t0s2xmxr3iydllt  fct tf rtrxmpno4oeenmoeiad s em(vo;u0alxnio oatfpteanes ( trtmir3nu4lme mncs (faDraumoou0olt ifciadfa2emuvo u0areomr3ia1oaDr u s;(0t2toimpio4ol nmici (f rrrum oo0oltniociasla elu pnu4trtnmo tatla  an i t) ruoxr3nu1lleelnvs t  Drm(mp;u1alx ifetys m ua( pn(4 etrir totfpt  n s t)s2um(r3iydamee fctatf 2tmu oot4tlxn ieiyt s2rmump t0 lxnxocoodoatr uei;s) euoxr3ny1ap e icils)aDrmurono1tetoiieiadlmDua(mo (4trtoxf3iytla rlivslt0trxoiopnu4lpe mieia( sDtaumpot0tpxoioctatlsDuaump t0tetrxfciatopD  nvs t0 2tm(o3oodlmenlivi s)srraumoou4oexomociasfmDuanmonu)trtoioctatlp eaivils0 rxmio iu1lme mivil()s2ua(r oo0oee  i3ias m ra(vs;t0 leoir3ta1opD  nvil() ruo(r iy1al   nctltfsDtrx poo0tpxo ocildfa ra(mo;u)aetomrcootomD lneilt  2tmim iodopt licsas  Dtr(rp;t4aexomociadfs2rlumsnt0arxoxo3todoateluvi t  rxm(r3no4lm e nvi tfa2ta( p;t1alxn oeiasls eln p t0areoxo3oa1opDeli ils0s2uo(opno4lpeemicslsfarum( o;u4aeen fetytlaDrm( ont)altrxfcoytom elnvs (0sexo(m3iu1amenlivtl( aDtrx o;u4aetnio3tlsfmDemumo (4tetoxocia1om elu ols0teumiopnu1am emfcil(faDumxmp;o1aex  octlt m2el(mp;u4teeomr3iotfpD  i s t) 2to(opoo4alenmici (fsDtaur ot1aee mi3tad s2umu pnt4aleomr iydlpD  ueol(0texrio3iu4lpe  feslt)s2trxront1aee mo3tlslmDrm( s (0 rxrmr3oy1om rln s;t0 2uoim nudalen ietasfsruaxrpno0aptomoetlslaDumnmo;u0aeeoioctotopt anes;s)tetr(o nodlltemiesa()a2rrxr nu0aex  oeias mDea(vp () rxomo iytfpte neo;s  etrio iy4om elnvsl()srrmurpot0apenifciasfs rlnmpn(4 lxrxf3iodfa elneo t0srtmir no4amt mfciasfa2rm(mp;o1olx iocilsfs eanvs (0 lerirctodfm elueil(  rtmio3ny1oltelfcslsf Drmu  ou4oleoioeiydfaDemu s t) reoxo iytfm   nvils0texrim3oo4ap n fctl() Dumu oou0ole  f3tat m eln o;t0arxrio todfat li ilt) 2urio no4lmtnlfci tfs2rmxrooo0tltomieildfm rmn p u)teerirctodlmteaneilt0 rxm(o nu1omt mfes ( a2rm(rpot0oltoiieiatlm2ean ont4aetnmr iadfm   n s;t0truoxopoudaltnlncilt srurxro;o0texnmfeiydlsDrmn snt0texoxf oa1lmteai s (  2tmir iy1olt lnvilt  Dur(ro;o1tleomoeilt m rm(monu4 ltrmf io1opt luvi t s2xrxopiydalenlnvs tfsDta(  ;o0aptoif3iatlsDum(vo (4trxnxrciodopD luvsl()setrio3nydlleemnct t)a2uru poo4aeeomf3tatfs2ea( ont4tlxnxr3oydoat lu sls)trtrirpoy1al elivsat aDtaxmpnu4optnmociadls rm( o;(4arxrmr tadomt luvol(0tetrim io4llenlnvs ()aruaxr ;t1ole  o3tld s ea( o;t) ltrmo3oydlmDrauvs;t0t2uoimpny1lpt  ivs s)s2ra(m no0ope  ociatls2ul( o;(0 etoircoo1fpteaueols0trxoxm io4apt lnesl()aDuaxro;o0oexniietysla ea(mp u) etnmr ty1fmtr nvo;s texmxo3ou4lm elfvi t a2rr(r nu1oexo i3iltlaDrl(vsn() eenxfciotfaD aieo;(  2tmio nudlltnmieia() Dtrxr ot1apxo o3iyt s2uan s t4 exomr tydlateauvi s t2tmir3iodamtn ivsa( sDrmxrp;u0tptniietyd m2um(mpn(0tlermo totfaDrauvslt)srtr(m3nydole  fcil( aDuaump;t4apx iicias a2rlnvpnt0 reoxr oy1fmDranvo;s  2xoio iu1ole  icsat  rra(m nt0olto f3iatfm2emn ont0 ltnio iydomD  ues s)sexmxo nudopt lfetlt sruaumoou0tptomictldla2eln s (0trtnio3oo1lm ranei s0sruo(mpiu4lpt  fcsa() Dtau  ;u0apto ictydlsDumnvs ()aetoxf oydlmDraneslt) exoio iy1op nmfetl(  2truronu4aleoifetad sDrmn o;(0trtnif3oy1fatraivi s0t2to(r3nu1optnmfet s  Dtrur ;t0aptnmieiydfm ua(vpnt)trtrmr3oydlaD auvo ( trum(mpiodlme mnetlt)a2uax  ;o0tpeomi3tysfa ulnvs;u) etnir3oo1lmDeauvolt)seuoirpnodoltemfes s)s2uru ont4aetnmfciasfs emnmo;u0aexoir totoaDrluvolt0texoim nudalt mnesls)s2um(rpno0olenmiciad mDea( snu) lenxr iy1fptelnes s) eumxmpou4ol  lfvslt s2uax poo1opxnmieilslaDulnmsnu0 lxoxf oadfptrai o;( texmxr oudap nlnvslsf Dur(  ;o1olt  o3tydfs rlnvo () lxnir oydfm eauvs ( tetmir3nudopenlictl()sDtrx  no1aetnmf3iat m uau o;t0treomr3ty1lpteln ols) rtm(m3nu1lpenliei t aDur(rpou1olx  o3iad s rlnmp;t4trtnmo iy1fp   neo s)trtmxmpnu4aleelfvtl() Dtrurp;u4olx mocildls2umuvo ()alxoifcoytlpDe n olt)s2xrir oy1llen ictl(f Dtaxmont4tpe  feiyt s2el(mo (0trtrmf3tydopteln s;s0seuoimpnudlptnlfcsls aDtrxm ;o4optomfctld sDel(vs;t) exnxf3tydlmteliesls)sexrim ou1am elivi tf Dtau pnu4aptomicilsfs ul( sn()aexnmfciy1omte n olt trtmiopoo4om emfes sfa2uaum ;o0altomf3iltlsDemnmpnt0 ltnmf3ta1fa elies t) exoir3io1al  livilsfsDurxrpou4ale iietytls rlumonu)aetnxf oy1opD  i o s) ruoir3io1lle mnesl( sDrmxro;u4aexomictadfs2rm( snu0tetoircio1la elnvi s0t2xoiopny1optn fet s srrr(mpnt4oet mfcilslmDemn o () etrmf3iydlat lu ils) 2umirpio4oltnmicta( a2urumono1altomi3ilt m2rm(von()artrxo3iydlmt ln o;s0 exoxr3nu1ap nlfeslt)sDrr( pou1apxnmfeiydfs rmnvp;t0 eeoir iadfpte neolt t2tmio iu4ll  mivt tfs2trxr no4tptoif3tyt sDul( s;u0 reoxf3tydopt aues t setoxr oo4altnliei sfsDua( o;u1altn i3tas sDeaumpn(0aleoir3tytoaDeaueo t trtoim3iodamee neiasf Dtmxmpou0opeoifciadlmDum( pnu0 lxnmrcoa1lmtrluvi;( srxoio3nydll nmici (  rtaxmoot1aleomictltfsDua(vpnt0tltrxfcoydomt auei;t) etmimpiydam n fvta(f 2trx pnu1tpt  iciltls2ua( p t4aetnxrctodfmtrauvi s t2toio3oo1lme lfctl(  rrrxrpno0tee iociysfa2rl(vsn() renxo3todlaDeln i;s0 2um(r oo4ap  mnetat sDuaxrp;o1texo feiltlsDra(vs;(0trxoxr3oydoa   uvs;()texmxopiu1ap nmfvs t) ruru  nu1aeenmieiad sDum( p u4trtnif3oo1fptrlies t0texr(r3oy1omenmfcsl( srrrumoou4ole if3iatlaDra(ms (0 rtrmf iadomD livsl(0srxrim3nudlpen fvi s) 2ur(moou4tpx ifcils mDeanms;(0arxomo iodom e u o s)srumim3ou4ol nmnviasf 2tmxm ou0alx mi3iaslmDul(mo u0 etnmo3tatlate i i s teurim3nydopenmfvs s sDtrum ;t1tet ioetatfmDel( p t) rtnif3io1oaDr nesls0 2uoirpoy1llt  feiatfa2taxmpou0aet  feilsls2uln p;()artoxo to1fm eaivo;() 2trxr oudolt lfesls a2urxmp;t1tpe ioeiysls elnmpn()arxomrctodfaD li o t) 2xmir3oodapeemfviat)a2tm(mp;t1tpxo oeias a raums () leoxr iotfmDrlnei () etrxm ny4ap nmnviatf Dumumoot1olx  iciytls2elump u)tltnir oydla  an i;(0s2tm(m3nu1omtelnvi ()a2ur( p;o0aptomi3tadfm em( onu) rxrif totfaD lnesl(0trtr(m iydll   fvtat sDrmumpoo1tlxniicildla um(vp;t) exniocoytlptelu o s0s2umir ny1al  mfvt sf Drm(roou0ale iieiadls2el(ms;()trtnif3totlmD auvil()trumxr3iy1ll e fvsas)arururo;u0tltnmfctltfsDrluvont)teenxfcoadoat  nvi;(0 rum(r ny4aleemfvsat sruau  nt0opto fetyslmDumums (0 lenmocty1latr uvi s0t2xr(rpoo4alt mictat  Dta(  ot4olenmocias aDranvp;() rermrciatfmDeluei t0sexo(m3nodal nlneias  rraxmp;o4aleo f3tasfsDumnmo t4 reoxocoydlm e ivi s0 euoxm3nydalenmfvtat artru o;t0aptoio3tatfs2rau s (4alerxr3oydfm ean i t t2xrxo3nudameemnet t srtmxmooo4apxomietydlm uau snu4 lenxrcootfpt  ieslt  2uo(r3oydlpe  fcils) rra( poo0opx ioeilslm2rluvs;u4 ltrmf ty1lptean i s)s2xoxr3nu1lltnmneta()aDrmuroot1ale  f3tytla2ua(mp u4tleoiociadoatrluvolt texr(mpnudapee nctas  2ra(  no1tlenii3ilsfs2eauvonu0aeenxf oadfa  anvs;t0 euoim3nudapt mfcsa()s2umxmp;t4apx  octld m2ua(mpnu4 renxfctytlp r neol(0 rxrxopoy4oltnlfei (fs2rmxmont1aleoiiciatfmDrmuvo;t)tlenmo3ta1lp eai o;t) ruo(r oo1ole  icilsfsrtmx poo4tlxomfeilt a uauvont) ltoxociadlpDelueo (  rto(rpiy4open feilsf ruaxrpot0aeeo feiydfmDemuvsnt4 etnio3oydomtr uei;(0s2xr(r3oodlptnlncslsfs2ta( p;t0ope ioeiltfa rmnms;(4alxoxf3oytla  lu s;s) exmxopoo4olte ivt t)aDrr(  nt0alxnmf3iltla2uan p (0trtnioctatfat ln i t  rtoimpno1ol n ncsl(fs2tmxrp;u1tlxn ociydfs2ranvp u)tetrmfctodlpD  ivo;t0srtoimpiu4lm nmnvi (  rumxm oo1tlxnif3iat m2ra( snt) eenirctotfp rli i;s t2um(opoo1lltemietl(fsDtauroou4aexnmfciydla2em(vont0 eenxrcta1lpDrauvol(0t2xmxr3oy1apt lfvias s2uax p;o4olx mi3ild mDeaump;u0arenifcoodlaDeaiei (0 etr(r io1am eliesl()s2rmur ;t1aexnii3ilsla2eluvp t0teerxr oy1oatean s t)t2xrxo nu1al   fct sfarurx poo0aeeoif3tldls2rm( o t0aeermrciadlaDeaueslt) exrxo3no4lm  lnvsltfs2rmxmpnt4oltnif3iyd mDelnvsnu)teeoxo3oytlmDrln i s s2to(r3io1ame  neta( arrmxr nt0aptn ocildlm2raumpnt4tlermo iotfmtrli s (0srtmxm3ou1am elfvia()a2trumonu4ope ioeiad mDemn p;t0 etrif3oo1fat lu ol( teuoxr iu4amtnmnesl(fsDrr(mpot4aleomoetasls eln o;t0tleoir3iodomDeau olt)s2xoimpiudom   ncsls s2ua( ooo0oexo oeiasfaDranvonu0 etoxo3ootlm rlivo;t0tetmio3oodopt  iviasfa2trxmont0tee  i3iltlm2el(vont)tlxrxr todfm  aueils sexmxo3iydom nmncil(faDuau pnu1ole iictysla uanvon()texrxr3iytomDr ivo;(0trum(r3nudap  lnvs (f 2umum ou0altomo3iadlmDumu o;()aleoxocoydlaDelieils sexrxr3oo4llt mnes ( aDrr( pot4aex  icilslm2rlnmp;u4arerxf3oodlpt aiei s  rtmir io4amen feias aDum( ono1tpxomoetatfa2ea( o u4trerxo oa1fm rlivi;t)texrxm3nu4om  lfcsl(f 2tmumonu4aetomo3ild s rln p u)trtnmr3iytlmt  nvi s  etm(o3no1alt  ivils)sDuaxmp;t1olenmf3tltfsDuaums t0aleoxocoo1fmtrlivo (  2uoxo3oo4lltnlfetlt  rumxmooo1tltoioctytla2el( o;t)trxnmo3oodlp r nvilt trxmxo nodomtn nvs t)sDtmx poo4tltomi3ildfa2eaumpn(0trtrmocta1faDeau o;(0 rtmxmpio1lm  mfvs tfs2ua(ro;o0apt  ictas m rl(mo (0aetnif iy1lateanvsls) 2um(rpiydlle lfcsa( sDraxrpot1tpxo oeildfm2eluvpnu)teerxocia1opDe nvs;s0 2xr(m3ou4aptnlicsasf Dta(rpoo1opeoifctytlsDeln on(0 ltniocta1lm ean il(  2uoxrpoy4lmee feilsfs2rrx oou4optnmictydlaDelumo t)trxrif3tatlaD ai s;t trumxm3iy1lpt mncsl(fa2ur(mpno0apeoifeiadfa2uan p u) rxrxr tadopDr ieo (0trumxr3oo1om   ivs t)sDrmumo;o0texnifciysfs2umn s u) ltrmo iadom ean i;s) rtmio3oy4amtemfvia( s2rauroou4olxo ictlsfa2ulnmp (4 ltomo ta1fpDrlneil() rtoio3io1oltemfctl(  rtrxmpnt4alxo fctyslm umnvonu0 rtrxr iytfmtranvi;s0 rxo(r3iu4alte ncta(  Dtau p;o1aptoifetldfm2em(vo;t4aexnxf3totfa  ln o s  2xr(m3nudopen ivsas  2rrur nt0oetnmo3ils a2uln o;u0trerir3tatfa e u s;(0texo(o3ou4lmtnlicsas)a2tm( ont0aetomictysfa2eln s t0altomr3totopDr nei t)s2tmim nydalee iesa(f Dtauront4aexo octysfsDulu p () exrir oodop   uei (0setmxo3iy4al  lnci s) Dur(r no4olen oetysfa eanms;t4teeoif ty1oa  lneo;(0s2xr(rpoy1lpeemncsas)srum( p;t0aeenmociadla2emnmpnt) rerif ia1fa ranei;s0tetrxo3no1oltemncta() rtmum no1alxn f3iydfs2emnvp;t0 renmrcoodomDe u s s teurxopnodopt mnct t a2um(m ;t0opxnio3tatfaDra( o;u)aeenmrcoydlmDrli ols s2toiopny4apte fvtat)sruaxr ;t4tleo ieias a2eau o u0 lxrxrcoydla  lu i s) euo(r iodll  mfvtas)a2umxr oo4olen ociys a rmuvo u0 lxnio oo1fat an s;s)srxrim oydome  fvtls a2urur ot4tlt  fciad a2ea(ms;u4 lenxo3iodfaDelues ( s2xm(m nodol n ivt s  Drm(rp;t0open o3iyd s ulu sn()alxrxo ootlptr i sls s2trxo iu4ll e fvsls)srtmurooo0opx moeiat m2umnmpnu4alerir ta1lm eaieils0 etoxr3oy4opt  ncs ()a2raxr ou0opx  oeiat mDranmp (4 rtoxr3tadlmD auvo t trur(mpoodopt mfeia()srumxrpou4olx  ieiatfa ua(vsn() etomo3iadop   nvs (0 etrxmpiodlptnmieia()srrax ono1teenioeildlm2uanvp t4 rxoio3oadomD anesls)teurio3no4amtelfcia(  ruau pot4teto iciydfs ul(mo;u4artrmf iytlaDe ivo;(0srurxr oodolen fci s) rrmumo;o1olt ifciydlaDrmn s (0 lxomo ia1latraieo s)sexoxr io4lpte feilsfa2rmur no4texomietas sDulu p t0arxnio3tytoaDrln s ( s2umim3oy1lm n ict ( aDra(root1altoio3iys m2em( on(0tlermf iydopDr neils setmim ny4ale mivsa( sruaumono0ale mocildls el( p;t)arxrmf iotopDrli s t srumxm oudom nmfcsat)srrrxmpou4teenif3iadlmDelumsn(0trtnmf3to1fa rluvi;s) etrio oydamee nvslt srumur ;t4tpto ociydlaDean onu4 rxnifciy1lpDr ieo ()t2to(r oy1amtn fei tfsDtrurp;o4apxoii3iydfs2uaump;t0 etoif oy1oa  aieo t trxoxo oodole liei s)sDrm(ro;u0ape iietadlsDrmnmpnu) eenio oadfa  luvsl() rxm(o3no4omtn icias)aDraurp;o4opt  ocildfm2umu o;u0teenxr iotfp eauvi;()seuoxmpoo1alte ncsa()artmu  no4tltnmi3iydlaDea( p;t)alenxr3oydlp  anes;s0srxrxm iodamt mncils sruru poo1oeeomi3iydfa2ea( o;(4trxomo oy1omDe uvols)trxmim oodopee fvsat  rtmxroot0teeniieiasls2eanvp;t0 lxrxr3oadlateli o s0tetrxm ny4al  lncia()a2rm(ront4oeeniociltlsDrln snt4arenxf iy1lmtrluvi t0 2uo(o3oydam   ncsa()a2ta(rp;t0alx mf3iatlaDrlumpnu4tltnmf3iadopt  n o;t  2trir3nydlmtnmncils)srtmu p;o1oexo iciyslm2uluvs;()teeoxr3oadlpte neil(0 2tm(m oydllt  neslt) Drax o;t4aeen ictasfsDrl( p;u4 rtrifcty1fpte i s s0s2xmxr oo4llen fviatfaDra(  oo1oetniicilslm2ran onu4altnif oodlp rli i;(0srurxm3oy1lme mnvta(fs2ua(rono0teeomfciytlmDulu s u0alxnmfcoatop  livslt  rtrxopnu4ol elictl(f 2uaxrp;u4oexo oeilsfaDeauvp u)artnif oa1lpteln s t0srxo(r3oy4amtelfeta( srraxr nu4texnmoetltlmDel( o () etrxo3iatfpDean sls)t2ur(r iy4altemieias)aDrmxr nu1oexn oeilsla2umumsnt) rtrmoctatfp elneils)t2xrxm iy4openlncsasf rrm( oou4apto i3ild m2elu ont)teeomf3todlp eauei;s0trur(rpio4oltemieil() rra( pou4apxnmietld a ul(vs;()tleomf3tydopDrli o;() 2xm(o3iodoltemnesat) rtmu  nt4aee  iciatfsDrmumo;(4 lenmo tydomte nes t  2trxm oudop n icsltfa2rmxm ;u0tleomi3tadfs ean s t0tltniocoodfa   ueilt srtoio oy1amte ict t)sDrmxmpou0ape iociaslsDuau s;(4tlxrmo3iydla eliei;(0s2xo(opoy4llenlfcilt  rurxr no0oleoio3iyt a rlnmo () eenif3iytfmDelnvi s0setmxopiodll  livsa()artmu  nu4tlto o3ilt mDul(ms (4trenmr3ta1oaD  i o ( t2xmio iu1aptemfet tfsrum(ro;t4tlxnmfeiltlmDea(mp t4 lenmr3oydoat auvsls)trtr(rpio4llee fcsa()arra( oot1oex moeiatfa rl(vp;t4 rtrio3iytfaDr nes t t2uo(r3oy4ll eliciat)srraumpno4tpenmfeiyd a2rmums;u4 lxomrciotfa  livs t0srtmxo ny4apt  nei (fa2tr( p;t1olx iicilt m2rlumont)areoxo tadlptrluvo;()sexr(rpiy4al nlnvtls)a2tm(mo;t1optoifcildfs2rm( o ()trenxo iadoaDrauvsl(0 rxrxm3nydal elnvias s2umxmo;t4oleoiieiatfa uauvont0alerioctydopt  i ilt seto(mpou4lme mies t s2rmumonu1tpe io3iysls2ea( snt0 leoxr tatlp r n sl( t2to(r io4ap nlfvtas)sDtr(mooo1aexnmictas sDemuvpnu0 rerxo3iy1fmDe i il(0 2to(r ny1opeemnei s arrax pnu0opxoiietlslm eau s;t)tleomrcoy1lpDeli i t  rxrio3nudlm nmietlsfsrtru ono0oetnif3iat aDrln pnt4 rtnmr iodopt lnvi;t)srto(opou1optemfvia(  Draxmooo1ale  i3iytfaDrmuvp t)tetrmr3io1om   ivi ( tetrxr oy1apeelics () Durumpot0tpx  ictls sDumuvo;u4 lerir ty1lm  auvol(0s2uoxopoy1ap n icsls)srtaur ;t1aex io3iadls2rl( p u) rtnxf tydoa e nvil() 2xoxmpoo1lle lfvsas srtr(mont1oexoioetytls ea(vo () etoirctytop rln o;t s2umxr oy4ol  mfetlsfsDur(rpnu0ole mo3iyd s2ulnvo;t0trtrxocia1oa eliesls0srurir3no4olee fvt ()s2rm(r nt1alenifciysls2ua( s (4trxoxo tydoptr ieslt)t2um(r oy4lm elfvias)artrum oo4tetn iciasfm elumo;(4artrio iotoat lieols  etr(opoo4al e ieias  Duaum oo0optoifeilsfa2em( o;t4altoif iatlmt aues s0s2uoimpoodalen fvs t s2rru o;u1tet ioetyt a ulu o (4 lxoif oytlpDrlues t0sexoxrpny4ameelneils)s2taxmooo0opx  oeildlaDem(mp t) lermf3iodfpt  u i t) etm(m3iydome mfcs s  Duaumont0oexo oeiltfs2em(vs;u0 lerxr3iatfat livil()seuo(r oo4om   fcils  2ur(mpno0tpto oetyslm rau s (4aeeoifctadfpDranvo;() rxrio3oy4opeemivt t  Dtrxmpno0ape ii3iyd m2ranmo (0tltnir totlpt  ues (0texr(m ou4lpte iet s aDrax  ;t4oleomfeiadfm em(mp u) exrmo todlaDeln ils) 2xmxr3oo1lleelivsat)s2ra(mont4ole mietaslsDulnms;(0 ltnxfcoodlatelies;s t2xr(mpou1ll  licslt)arua(m ;o4alx moeiasfsDum(mo;u0 rxnio iydlat luvo;( texmxm oodoptnmfct (f 2ua(  ot4oex mieiyt m umnvo t4 eeoif3tydfpt lnei;s  2to(m nodlm emfet (fartaump;o4oexnif3iatfm2eanms;(4artrif oytoaDr ies;t setoio oudaptemfvsat)aDrr( o;o1tlxnifeiytfsDrmuvp;t4altoif3totopD aneslt teurxopno4lp   ivtlt s2tr(mo;u4ope  i3tldfs2ra( p;t4 rtoxr oydomDeauvo t0teum(opou4oltn fvil() Drrxmp;t0tlt ifeiyd s elnvo t0aleoxocia1lpt an slt0 etmxrpno4ol elietlt)aDumurpno0alxomiciadla ea(ms;u0texnxo3todopDelnvi;s0texmio nu4altemneilt aruaum nt4aex  ieild s emnvo (0tlxnxr3oodfpt  ivil( t2uoim oo1om e nvslsfsrrrurooo0apen fcild s2emuvsnt0 rtrir oytfmDrli sl()texoir3iydllt lfesa(fsDumur no0tlx mieiat s2ea(vs;(4 rermo ta1oa eai o;(  etm(r3no1lmtnmncias)a2rr(r nu1olt io3iadfaDem(vont4 exoiocootlptraivi s srurxm3iydape  fcslt)s2tmx  ;t1tltomf3iatlsDeau o u4 lxriociatlpDr uvi;s)trtm(o iudame lfcsa(f 2ua( oot1opt  i3ild s ranms u) etrif3totlaDelnvsl( teumirpoo1opeeliei tfsrrrxr ;o1tlxn o3ias sDemnvp;()trtomfciodlatrau ilt)srtrim oy1ole  fct (  2ta(  ;t4optomfeiydlm rmumo (4tltnxrcoodop elnvs () 2umio ny4lpenmiet () rtau oou4tlxo f3iatls2rlu s;u)tltoxo tatlmDelieol(0texo(o3ou1am   icslsfa2rm(  ;u0tpe ifctadfsDra(msnu4 ltnmo iydfaDelies;s t2xmxopno1amenlneia( aDrrxr ou0oeenmo3ild mDrln o;u0aexnio iydlaD  u olt) etm(mpno1lpte iviat) rtmuronu0tltniictltfmDrl( pn(0 lxomr3to1fa e ieo s  etr(r iu1opee nct (faDrr( pnt0alto ietatfsDranvp ()tetoio totoateluei t)s2um(m3iudomen ies s srur(rp;o0oee ioctasfmDrmuvont0alxomf iytlpteai i s0trurxopou1am  lnvi () 2ta(r ;o0openifetaslm2emn o;(0trxoxr oatla eauvo;s0t2xmxrpoodam n ivia(faDrmxrpot1tpx mfeildfa2rl( p u4trxoxfciotfa e u s;() rto(r ny1lm   fct (f 2trx onu1aetnifciydls2eauvpnt4 lermr oytlmt luvi (0s2xrio3nydam e icil( aDum(roou0olx moetlsfm2ulumonu4artnif oy1oateanvi;t0tetm(m3ou1llee fcsat) rumum nt4tpx  oeias m2emn s;t4 ltrmr3to1omDr ivilt0teto(m3iudom nmncilt sDumx  ou1tpxoiociydls2uln s u0trxrmr iatfaDe i i t0seuoio3iu4amenlfeilsfsDta(r oo0alt ioeiadla ulu p;(0arxoxr3oytlp raivilt t2xmxo io4olenmfvtatfs2rmur ;t1tltnmoeiytlsDua(mp;u0aeermf ty1opDelueol( texrxopno1llt mfcs ( aDtrxmp;t0oleoii3ils s2rlnvp;u0tltnmf iodlm   n o (0trtr(mpiodolee ieias)s2ua(mpou0tex ioetldfs rmnms;(0artnif3tydlp  anvs;s) rur(o3nydapenmfcias arrr(rp;u0aeeomf3iyd s umn p;u0arermociy1fmtrlueilt) rumio3io1ome mivtas arumx o;u0oexnmoctld sDem(ms;() etoiociydfmtraneo (  rtr(opou1op elfciat s2raxrooo0olto ictlslaDranvp t) rtomo3oodom e u i;()seuoxm oy1ol  mivs s a2urx pnt1aet miciyt s ul(vsnt4trenir3oatfp r u ol(0s2um(o3oodlm emneilsfarta( pnu4oex  o3tldlaDem(vp;u)tltrmo3oatfmt lnvs () 2tmxo oo1omtnmfct s  Draxm nt1oexomo3iatla2eauvo u4 lerxfciotlm e ieils  2uo(rpny1al e ics (fsDraum nt0tlto feiat sDrm(ms t) reoif io1fp elivi;t) eur(r3oodameelies t a2tmuroou1tpx ii3ildlsDrlnmp t)aetrmfctatfp rlu s s  eumir no1alee iciatf Duaump;u1tpt  o3iad m emn sn(0altrifciadlat ai s () 2trir oodlp nmieslt)srrr(mooo4optnmieildlsDrm( snt4 lxoir oytlaDe n i;s0s2um(m oydapt mfvsltfs2ua( ooo4tee  iciatla uau pn()aeermf iydfmtranvi;(0 exr(rpoydllee ncsa()s2rmuroot1oeen o3ilsfaDean p u)trerxo iadlmt  n i ( t2tr(o3nodopenmnesls aruru  ;t4aeenio3iaslm2em(vpnt4trxnxo3iadfatrli slt0t2urxo oo1om e ictas artrxm oo4alxnif3ilsfaDum(mo;(0alenxf totopDeai i ( truo(o3ny4ll   icilsfaDrm(mp;o4olt iietydls2emuvsnu)aexomf iydfp rli s t0seumxm3oo4lp  mnei s) Drr(m oo0aex  o3ild sDumumpn()tleoxrciy1opD an s;t0 rurxm oudlm nlfet () 2taum ;t0opt mocilt m ua(mp;(0 rtrir todlmteau s t0 eur(r io4ape  fvilt s2taxm ;o4apx ifeiytfsDrmnmp;t4 reomr iadlateaues;s0setm(opno4ll nmieta()s2ur( pnt0opxoio3iydfs rmu s;()treriocoa1om  lues t0srumir io4aleemfcsl() Drrump;o0olxn icilsfm2el(vo;(0alxrio iatlaD aieo;t0s2uoxr iu1amt lnesasf 2rmxm ou4tltnmociadlaDua(vsn(4 exoxfctotoat an i;t0sexo(m3io1amt lnvs (fs2rrxrp;u1olx  fetad s rmn on(0tltnxf iotopDraivils)truoxo iu1lme lfetl()sDtaxmont4optnmoeiysfmDemump (4 etrxr iodlm   u o ()trur(rpiu1lptnlfvi ( aDtru p;t1apx  o3tytfaDrmu p (4 rtomr3ootlm rlu sl()texoirpiu1al   ivs tfs2rmxro;t4tex mfciad sDem( pnu4aetomociotlmDrauvs;t s2trir3iodll e ivilt) 2truro;o0tlenmf3ilslm ra( ont0 etrmr3ty1op elivsl(0srtoirpiy1llen ncs (  Dtau  oo0oetn ietasls umums (0teerifciatfp eli o () eumxopiudll n nesas aDrmx ont1aexnifeiydfmDelnvp;()aexnmrciydlptrauei;t t2tm(opnudal n ictltfsrtm( ono1aetniociys sDea(msn(4aexnio ty1fpteau ils texrirpny4ole lfvsl( s2tr(mo;u1oee ii3ilslm eaumo;u0 ltrir oa1fm e ieo;( s2toxrpoudopeemiei () 2tm(rp;u4tptoiietyt a2uanmp;u)aetoxo3to1fmt aueo;( srtr(rpoo4op e ncsas)srua(  no0alxo f3iatlm2em( s;u)trtnmo oodoa   ivo (0teto(m oodape lncs t) rururp;o1aetnmfciytfa2el(vp t) lermr3oydfp r ieo;s s2xo(o3oo4amtn nvsasf rrmxm ;t4tleomo3iatls2emn p (4tetrxrcoa1fp rlieo (0srurir ny1aleelfvi t srrrx pnu1opxnmi3iad mDraums u4trtnmf3iadomDeauvi s0t2xm(o3iy1ome lnei (  rta( ono4tlt  ieiyt mDrlump t4 ltoio io1om  lu il(0 2urio3oodlm e nct s)s2uaxmp;u0olt mfeild m rl(vs;t)altoxr totoatrlues t)t2uo(r3nydop elnvi ( sDrru  ot1apto fciys a ea(mp ()tltnmf tytomt  n s (0s2um(o oudaptelfvtl(farra(ro;u4alxn ietls s em(msnu) rtrxo iytlate n sl(0 2xoir io4olt  fvs tf rtaxrono0apt  oetysfmDulu p;t0alxnxf3iy1fmtrlnvilt0t2tr(o io1apte nctl(fsrra( o;t1oeenmf3tltfm2rmnvont)artnmo3oo1oa r n i (  rur(o oo1optn neilt  rtrur ou1aet  i3iadfsDrluvs u0teenmo3oo1lmteaueo;()srxrimpiy4al   net sfaDrr(m ot1ole mf3tat s ul(mp;()alxnmo3tadlm  aieo;t) rxrxr oy4llt lfei t s2uax poo0opxn ocils s2uanvs t0 eenifciy1omtr iei t teto(r ou1ame  icil(fsDta(rono0tptn fetasla2rm(mp t)aleomr ta1omDeaivi;() 2xo(r iu4lm elivsas arurumooo1opxoifciatlaDel(vs () etomr3oatfpDeluvs ()s2ur(o ny1op emietlsf Dtmurp;u1tlxn octaslsDumnmsn(0arxnif to1lptranvolt0tetoxm3oy4optnlieias) rumxmoou0oeto i3iatlm rauvonu) ltomf iodlaDraies (0sruriopou1lmtemicta(fs2tm( oot4tlt  oeilt sDeauvp;(0aetrxo totfat  ivs t) exrxm3iydllt lfes (farumx pou0aeto f3tldla ra( sn(0aexnmf to1fmDe nvi ()setr(rpoodomt  fctl() Draurpoo0tlx if3iatfs uan s t4arerxrciodoaDrln slt teurir iydole lnet ( aruaxmoot4tpxnif3iydlm rmu p u4alenmr iydlp   nes;s0 2toxr ny4olee feta()sDum(rpnu0tpx mi3ilsfm2ul( pnt4altomoctotfm   u ils0 2xmiopou1opte nei t a2tmx  oo4tpx if3iysfs2elu p (0teerxo3ootoa e uvi t0seuoxmpiu1alee neils)s2trx onu4tltnmoeiyt aDeanmp;t0texomf3iytopteanvo;() 2xo(m nydal nlnvta(farra( pno1oleniietld s em(vont)alerxf tatfm eluei;(0 rtmxm3nu1lltn ivilt) 2uaumoou0tpeniocilt m2um(vpnt)tetrmr3tytfaDeaneil(0srxr(m oo4ap e fei () rrrxm nt4apxomi3iad a2ean onu0 rxrmf3ia1faD au sls seuoir no4lpee fvs sfarra(monu0tpeniietlsfsDulnmp;(4tlxnif oy1opt lnvo;(  etm(o3iu1omtemnvslt) 2rr(  ;o0ape ifciat s2uaumpnt4arxnir tydlpDrlu slt setrim iodaltnmnci s)a2ta(rono4tpxo iciyt s2um( p;u4arenxf3tatlatran ols  rxo(o ny1apenmnviltfsDur(r oo0oeenmfetat s2ulu onu4tltrxo tatoatelivs;(  exoimpoodlpt mfct t) 2urx ont0tetomfciadfs ra( snu0aeerifctotfmDrlu o;s  rxrxm3oy1am nlfcta(fartaumpnt0aee  f3iydlm2el(mo t4 rtoifcoa1faD lnes (  rxoxmpnodom nmnvtatfaDuaur ot1apeo feiytlm2emuvpn()tetnmr tadop  liesl( trtmxo oo4ll emfct ( aDuru  ;u0olxn oeildfsDel(vonu) eenxociatlp r i o;t0 rxr(rpou4oltemnvtlt) 2tr(m no4oetomfeiatfmDem(mon()aetrmrcootlateanes;s) etmim3iu4lm e ncsl(f Drm(m nt1ole mi3ias sDrmn o u)trxomociydfmt ln olt  eum(m iydom nlfetasf Dtaur ;t0teeomf3tlsfa uanmp;() renif3ootfpD ln ilt0t2tm(m3iu4lmen fvs s s2ta(moou0opt io3iltla emu p () lxnif tydoptr nvi;(0 rurir oydomee fcs ()srtaumpou0tlen feiadlmDeau o u)trxnio oatoa rai i t) rxrxm no1om   ieil(  Dtrxmono1teeo o3tyd s2ra( p;t)alxoxrcoydfp elivo;t0s2tmimpoy1lp n fcil(f Drmxrp;o4alxomo3tls sDum(mo;u0 lxnmr todfpDe u i;s) ruo(m io4ome liet ( aruaurp;o1tpeo iciyslsDeluvs;(0 ltomo oatlmte u o t  etoxo iu4omen nvta() Dtmur no4tpen f3tys mDra(vs;(4tlxoxr oa1lptrln o ( s2uo(opoo1ol nliet t aDtrxr ;t4alx mieils m eluvpnt)aexoio3oo1lat  neo;(0s2tr(o io4lmtemnei sfsrurumo;u1oltnmi3tys s2rau s u4 renxrcoa1fpD aueo t)t2urio io1lm n ivi ()s2raxmpou1olxniicildfa eluvsnu0aexrxociodfm e u s;()texmxrpoydll elfviltfsruaxmpou1altomf3ilt a2umums t0altnmr3totlpte nvol()t2tm(o iudalee ieilt)sDuax o;o4tpe  ociad a2umn on()trtoio ta1oatrluei ( seuo(r3oo1aptnmiei tfa2ta( poo0ape  ictytls eanmp;t0tetnxo3ootfmDrli s t  etoimpou1lleelfet t)arrmumo;o1aleoifetlslm2ul(ms (4aexnmocoatfp rlivi;t) 2uo(r3nu4ap nlfeils)srra(r ou4opto f3ilt m2el(mpn() renif3totfmtr nvol( teurxm3oudlptelnetl(  2ra(rp;t1alt ioeias s2umumpnu4tltomrctytlaDe ueo t0sexm(r3oodlltnmnci ( s2ra(ro;o1aptoiieilt mDelu snt4tltnmf ootfaDe n s;(0t2trxo oy1alt mncia(fs2ur( oot4aeen ietltlmDeln o t0 rxrmo iodla  aivi;t)t2xm(opio1lmeemneia(fsDraxm no0tle if3iyd s el(ms;u4altrmr todoaD lues;s) 2trxr3io4al nlnvtls srtm(mono1tlxn feildlmDuanvo;(0 ltrxfciy1fat aiei;s  eur(r3iudame  ivtls) 2um(mpou1olenmf3tatlmDemnmon(4 lenir3ootfmDeliesl( tetrxr3oudolen fctl( sDtmxmonu0aee  octytlm rmumsnu) lerxrcty1oatrauvil(0sexmxopiudop emnei s aDua(ront4texnmoeiysfsDuln p;t4altnif iatlmDelneo s t2tr(opou4lpe lfviat srtrum ;o4tlt iictld m em(vonu0aeeoxf tydfpt lues;t) ruoio no4omt mietatfa2raxroot0teenioeiytls2uanms u)texnxr oy1laDraueilt)setrxm3no4amtnmics (fs2tmur ;o4tpxoii3ildfm2rmu s;t0 rxoiocty1lp   uvsl( trxo(mpny1alenmivias)sDta(  nu0alt  i3iadfaDra( p;()artrir oadfpDr ues () rtoiopnudol n fesasfsruaxmpno0aptoiiciydfs eln pn(4 etnio iadop r n ol(0 2toimpio1lp elncsat s2taum ou4aeen f3tydlsDean pn() renmfctotfmDelies;t0 eum(rpou1ol e nvsl() 2trx  ;o4tlx mieilslm rl(ms;t)aeeomf oo1laDe ues;( texrir iydom  mfvtl(f Dra( ont4tpt  oetad a uan p u4artnif3iatfatelnei;()s2tmim iy4ll e ict ()aDrmxrooo1aeto oeiyslmDrluvs (4 eeoif3iytomD anvi s  rtr(m ny1lm nlictatfarra(rooo4olx  iciasla emnmo (0 rxrir3ta1opDrlneil(0srtrim3nodlm e netlsfsDuru  ot0aex  o3iyd a2elu o;(4aetnirctydlpDeauvil(0trxmxopoo4oleelict (f Durum no1tleo ieildfm2eanvp t) lenxfctatfateaneo t0t2toim3oo1aptemicils aDra(ront4oetniiciltfm rmu p;(0 rtoxr3oytlp raieo t srtr(r3oy1aptnmnesas)srumu  nu0aetniietls a emnvp u0trtnmocoydlat aivo t)srxoim3iodaptnmiviatf 2trumpoo4apeomo3tytlsDrm( p;u0aetnmr3iotom eln s t)t2uoxm3ny4ole lnvs t)artaxrpno0tle io3iltfsDua(mo;u)teeomr totfpteanvsls)trtrxopiy4ol n nvt ()sDrm( ont4tetoio3ilsfm2um( s t)aetnir oa1fat  uei;t0seumxr oy1ap  mfesa(  rtrurooo0oetoio3iasfmDumu p;u0 rerxo iotfpD luvi;t srtoiopio4apt lfei (f Duru ooo1ape mf3iyd mDeauvp u4arenxo oy1oa eli s;s setoxo3iydll  mnvt (  Dtm(rpno4aexomfctyt s uanmo ()tlenxo3iytfmD aueo s) euoirpny4lpeelfvt (fsDumxm ou0aetnifciydlsDrl(von(0teenmr3tydfptr n i t s2tmir3iodame lncsls  Dumxrooo4teeoif3tys m em( onu)aeenifcoadlatelnei;t0 exr(r nodam n net tf rrax ono4opeomiciad mDum( s;()alxnmr3oo1lpDrlu o () 2tmxopoydapt mfcslt) 2ua(rpnu1aet  o3iyd a ranmo;u)teerxocoydomDelies;(  rurxopiy1op nmivsat arurxr nu1apeomiciatlm2ul( o (0 rtrxo3iodomDeln olt)t2umxr3io1lpe lfvilt)srrmxrooo4aexomo3ilsfa umu onu4texnmr3iotfm   n slt0setoxmpny1ole mict (fsrurum oo1opeomiciatfa2uan o t0 rxrmfciatlateau o;t)sruo(r3oudlmenmnci (fsruaumonu4aetn octyd mDrl( s;u0tltrmf iatlmDraivs () 2xrxopou1olt  neils  rra(rpno1aexo ociys a2rmnvs;u)teenmo3oy1lpD lnvs s)trtr(o ny1lme  fcs tf Dum(rono4teto iciasls2ra(vpn(4aetomrcoodfmD  n o;(  exoiopnudopeemfctat) 2rm( oot4apenmf3iytfm rm(msnu0tlxnmr ty1fmteluei t0tetoxopiudameemfcias sDrm(  ot0aeenmo3iys m eanms u4 etrxr3iotlat  ivo (0 rum(m nu4aptemfctas) Dtm(mo;o0opxomf3iasfmDea(mo t4tetrif3oa1lmtrlu slt0t2urimpoydomtemfcs t)aDumumo;o4aexoifcilsfm ua( s;(4aexoxocto1lpD lneslt) eumxr no1lpeemfcilt)a2rru onu0apenifeiad s2el(vs t0texnxr tydomt  u olt  exmxm3oo1ameemfeilt) 2urum oo1olt  i3tltls um( ont0aetnifciytlaD  uvo s  2xoio iy4ole mfvtas) rua(rpot0aptnif3iytfs umums t) lenxfciotop eaneo;t  2trxmpiodal elncs s srtrxrpoo0tltnifciyd a2uluvo;u0aetrxocootomt  n o s  rum(opiu4ope mivtlt arrmxm no0oee  octatls raump;u4teerir iydfptranvo;()t2toio3io4aptnmiciat) 2rmum no4oltomi3iysla uan p u) eerio3io1lm eaivsl(0srxrio3iu1ap   nvt (fsDua(  ;t1tpe  o3iytfm2uluvo;(4aexrif3oy1fmDelnvols)truo(rpoo1om  livsl(fsDtr(m nt1aptn oeildlmDuauvsnt4 ltnir tydfm  livo t)teuoirpnudllen ivi (  Dur(m ;o4tpt  o3iyslmDrluvp;u)arermf3iatlp rai i () etmirpou4ll nmivias)sruaumono1aptnii3iydfaDeaumo;t0aleoxo3oatop  anvsl()s2xrio oydlp elivi ( arra(  oo4olenii3ildla el(vo;(0 rtnmf ty1lat lieslt) 2trim3oydom nmivta(fa2raxr no1oleo i3ilt s ran s u4texrxf iodomDrli slt) rtrxm nodapenlfet (fsrurx onu1oeen ieilslmDumn sn(0arenxfctadfpDelneolt trtr(opiy1ome mfeilt sDtru pnu1tpt  o3iydlaDemnms;(0alenmo tatom  luvslt  rxo(opoydapen nes sfaDumumoou0alxoio3iatlsDra( p (0 reomr ia1oa eluei;s0 exoir nodopt  icias a2uaxm nu4oltoifeiltls2el(von()aetrirctydlmt lu o t0 etrio3iydllenliei s arumump;o0oeto o3iyd m ulnvp;(0 eeomf3ta1latr ivi;(  2toim nu1ame mnvta(  ruaum oo4oetomoeiytlm2emnvp t4alxrio3iydfm e n ilt setmxmpio1lptelfci (fsrum( onu0oexn oetadlmDel( snu)altnxo3oydomt auvsl() exr(opiydol elfvia() rtrxmont0olx  oeiltls elu o;t) renxfciodom r u s;( tetoxr iu1altn iesls  Dtaxr nt1opx  iciys a ulu on(4areoir3iatom e n i ()tetrio3oo4optelivi t)artrx ont4tpt  iciydfm2ea( s;(4altrxrcootfpD auvs ( truoxr3iu1optemnvt t)aDtrumooo0tpe  iciysls2emnmo;()areomo3iytomDeaueo;t0setoxr io4oltelfei s aDtmu ono1opx mo3iydls rln pn(0 eeoio3tytlmt auvs;()teur(m3ny1omeeliei (f rurxmpou1olt mociasfm emu pnu4 rermfcto1fateai i;t) exoxm3nu4optnmivi ()artrxr ou4oleoifciltfa um( p t4teermr3tytfp ean o;s seuo(mpio4am nlictl(fa2rau oot0tle  o3tld s2raumo;u)teermr ia1fptraivi;(0 2triopoy1llee nvsas)srrr( ooo4tex ioctat m emnmp (0alermfcoy1optr ues t)trumxo nudaptnlfvs (fa2rm(r nt1tlt mfciasls ulnms u0 reomo3iatlm  aies;s0tetmxr oo4lpen fctl( a2um(m oo4tlxoif3iadfm ea(vo u0aetrif totfpt li s s teur(mpoo4altelnetas)srumur ot0texnii3ias aDumu sn(4aexnmf3io1oa rai ols0 2xo(r3oo4op emivt t)a2tm(mp;u1alxomiciydlaDemums;(4trermr ta1fmDraivil( tetoimpio1ape lneiasf Dtru  ot0tetn fciys m2uanms t)trtnxf oo1om eluvi;t)srxo(rpno4olen fcs sfaDtaumo;o4aleomfciytfmDel( p;(4texrmf3todfmt auvi ( srxmimpiydopee iesa( s2tmurpoo1oexomociysfa uluvo (4areriocto1la r n i;t) rtoio io1lm nlneslt)srum(mp;t0ale mf3iad sDrlumo;u0 lxrxr iytoate iesls)srxoim nydll  lietat)s2raxroot4aex mfetat aDran p;u4 rtrxf3oo1fpD  nvs t0 2trirpny1alenlnvtl( s2ua( pot1opxoif3tld a2rl( o t4trenxf3tytfmtelu slt0 etrxopoydlpte icsat)sDtrxmpou0aetnmf3iyslaDeanms u4teenio3ta1fp e u sls)t2urxr no4optnlfcils a2tax ono4tee ifctldfs2uanmont) etoif3todfpDeanei t)trurxr3oo1ap nlietat arur(rono1apxo iciyd s rmump (0aetomf oa1omDe ueils  2xr(r iudol  liei t  2ua(rono4oet moeiltla2rluvo t4aetoxo3oatlp  anvi ()t2xo(o iu1lmtnlfcsa(  rrm(mo;u1alxo i3iatfa um( p;u0arxnxo3tydom  auvs s0sexo(o ny1olte neslt aDtrx poo0tpeo iciyt sDem(ms;t) lenmf3iydfaDeauvs;t0sruo(m oo1lpeelfcsasfaDrrxrp;t4aeenioctysla2rau s;(0aexoxf3ty1lpt auesl( teto(rpno1ap e iet sf rurumo;u1opxniiciltla2elump (4 lxnmo3ta1lpteauesl(0tetmio3iu4altelnctl()s2trur oo0aleo ietltlsDea(vs (4 rxoif3ty1fm r n i;t0t2xrxopiodaltemiet ()srrr( o;o0tltoif3tls m ulumpn(4alxnxf iadfp   ues (0 2urim3iy4ome  fvtas)sDra(rpnt4apen o3iatla rluvs t) exoirctatlpt aivo s)seumxo oo1ll emncta(  rtmx  ou4aeeo ociyslsDumumon(0tltoxoctydfaD  uvi s0 rtoiopnu1llt lietas)s2ra(m ot0tpxnmictltlmDuauvo;u0 etnxrcty1op  anvo;(  eumio io1omenlfes ()srtau  ;t0opx mfciys s2rmu s;(4 lxoif3iadoa elnei (  eum(opoo1olen icil()s2tr(  ou1opeo ieiadlmDel(msn(4 lerircoa1lmteauvo ( srtrxopoydomtnlnet tfarrrx  nu1aexnio3iad aDel(mp;u)aetoxf oy1laDean ols srtrim oy4ape lfesl() rrru p;t0apt moeiytlm2umuvsnt4 rxoxociadfmtrli o s t2umiopnu4al  lfvs tfa2uax poo4oeen f3ilslsDua( s;(4texnmrcoatla  lu i;s sexr(o3oy4apt lictat)sDrr( poo0aexn ieiyt mDemu on(4 lxrif3oo1lpDeaivo;s0srumirpio4lm emfetatfs2uru pnu4aex mieiatfs ranmsnt)aeenxf oatlm   i ilt0s2um(o oo4llenlneiltf 2ur(  nt1oex mfetltfs2uanvs;t)aexoif ootfmtr neslt t2to(opiy4al nmnci s)a2uaxm nt4oexoii3iytfs2ul(vs;u4alxnmo iydlpDe i o;t) rumio3oydoptnlnciatf rumxmpnu1open fciad s2um(mo;()aetomo iytfp raivs;s  euoxr iy1omtnmiesa()sDuaxmo;o4tlxn feilt mDrm( o;(0 rxrmf3tatlp r uvsls  rtr(mpnu4llte nci ()aDuaxro;u1oex iieildfmDeanvo () exrmrctytlpt aivo s t2xrxo nu1alt lnetl(  2tr(  no4ale iociat s ulnvo;t4altnmo3iadfm rau ol(0 exrxo iydlpt mnct ()srtmxr oo0oltn oeiad a2em(mp t)trtoxfcoytoa rluvs;(0sexo(r nu4ale mnvtl(fsrtm(mp;t4oet moetlsfa2eluvo t)trenxr3tydfmDe n o;(  2xrim3iodllen feslt)aDrr( onu4tetnioeiydfa ra(vsnu4trerio iatoaDrlneolt s2uoxo3oo4lmtelnvil(  2urxmp;o0optn i3iasla2rmuvpnt4texomf oodlaDrlneil() eumxrpiy1lmte iet ( srtr(  nt1oeen octls m2em(vpnt4alerifciydfm elneo (  etoxr3io4am  lnvs () Drrxmp;t1opxnmoctysla uanmp u4tetnmf to1fp   n i;s) rtrirpoydlleemfeils)sruru p;u4tlxoifcilt sDeanvo u) exomfcto1opt li sl( texm(m3ny4aptemiciasf Duaurpoo0tpeoifeildls ulums;u4tetnxr iatfatraueolt  rtrxm3no4lpt  fctatf 2rmu ooo0teeomf3iadlsDrluvpn(0 lxoxr totopD auvil()s2urxr ny1ame  icsl( artrx oou0tleomieild aDel(ms;t4alermrcootlm  aies ( seuoiopou4optelfvsa(fs2ra( pnt4oeto ietlsfa2umnmp;() eeoif3io1fptrlu o t0 eum(opnudal elivtl()a2taur ou1aeto ietydfm raump u) lxrif oa1faDranei;(0 2uoxopnu1ap nmivt (faDtau  ou1openiieilslsDelnms u)altomf tadom r i s;s)truoim3nodap n nvsltf 2rmxmp;o4tlx iociydfaDrmn o;(0tetrirciotlm rauvs;( t2xoio nydlp   fct s arrax  ;u4alto fctas s2umu p;t)aexnxrcoo1oa r ueil(0 2xr(r nudlltnlfctat)aDuau  nu4aet iocild m rl(vpnt0trxrxrcoatom   neo t0trtrxrpoy1aptemfctas)arrmx  nu4opxo ictyt aDuluvo (4tetoxf3tatoa e ivs s  rxmir3iu4ope  ivi ()aDrmxm ou4apx  o3ild mDel(mpnu4trtomf oa1faD lnvs t0srtmxo3oy1al e ncs sfaDuaxrp;u1texn o3iysla2umnvp;(0 leoir ootfaDeli o;s)s2xrxo no1lle  icsasfsrtaxmo;t1alto ietytls2ea( sn(4 eenmr iodlpDeaneo;( t2xrxm oodllenlfcs sfa2uaxrpoo1oetoii3tytls elu onu) etnio ia1fpte nvol()t2urxm3io4am  livtlsfaDtmx  oo1ope  oetadfs2emumont0tetrxoctydla  lieo s tetmim3io4ol e nctl(f 2umump;u1opxomieiydfmDel(vpnu4teerio3ty1oatr nesl(0 rxo(rpio4lm e ics s) 2tr(ronu4opxomociatfsDulnmsnu0tlxnxrcoydomt lu i s0setr(m iu1lp  lnetlsfs2ur(m ;o1tee moctls s2rmuvp;u4arxnmf ty1lat luvilt)srxrim nu1om nmfvs tfartm(m ot0ole ifctldfs rmuvo () exoifcoatlp r uvs;(0trxo(opnu1lpeelietat sDuax pno1aex mo3iltfs uluvo u0 lerio oytfm  ln i ()trum(r nu4lp e nvsas)a2tm(  no4oetnmiciyt s2rm( pnu)trenio todfaD  iei;()t2xrim iu4lmte fcslt  2ta(mo;t0tle moetat a2el(vs t0 etoxf oydoa e i i (0 rtrxm3nodllen iei t) rua(m ;t1tpxo ieiadfsDum(mo (0teeomo iadlaDelnes ()sruo(o3nu1lm n iet ( a2ua(m ;o1aeen o3iad s2uauvont0areoif tytfaDe n i t0tetrim oo1lpte ivsls s2raurpou4opto ociatfs el( s;t)trtrmfcoo1fmte i s s)texm(m no4omt mict s arra(mp;t1aleo i3iysfa emnvs;t0teermrcoy1op   i i;() rtoimpoo1apte ict s) Durxronu4aex io3iadfsDemuvo;u4 rxoifcoydlpteaieol(0s2urio3iy1al emnvias a2rrxm ot1aetn oetysfm el(vs (0 rxnmo3iotomD anvs s) 2uoio3no4ole  fci ( aDraxmo;o0tpxomfciltfa ranvp;()altnxr3ta1op  aivsls)t2xmiopio1lmeelfesas arurur ;o0optoioctytfaDrlnvp;t)alenmo oa1fptr ivi s)t2xoim iy1alenlicias s2ta(m ;t4altnmfetadfaDrl( ont0alxoio oo1fm  anvi;t) euoxr oudamt lfeslt arrmxm ;t1tpenmi3tld m2emnvp;u4tlxnxrcta1fa raieo t0 eurio iy1apt  ivt t)sDrmurpnt0tle iieiydfm2ul(msnu4tetnir todfmt lies t0 2uoxr3io1llte ietls  Draumpot1oleniiciat m uluvo;() exnxf iydfmt livi;t trtoio3iy1amenlfviatf 2uru pno1aexn f3ilslmDua(vp t) eeoio3oatfpteaivols seumxo oo4ape liei tfsDtr(r ou4tpt  ociat s emnmo;(0tetrxr3tytfa raneo;s t2um(rpiudope miesas)arum(  nt4tpx ii3iadfsDrln o;u0 lenxrcto1fpD  uvs;s t2tr(mpoydamtemfvtl() rur(m oo1tptoioeiyd m uauvo (0 rxnmrctadfptr ieol( teurxo oudlle mnetl( srtr(rpnu4alx  feiytls2um( snt4tlerxr3tydoateai i;( teum(o3no4lpenliei t s2rr(r nt4apxomfeiltls rluvo t4texrif3iytoat li il(0srumxr iydlp n fcs s  2umxrpnt4apx mi3tld a emu o;() eeomr3iadlptelnvsls)srxrxm nu4amtn icia()sDtr(  ;u1altnmociltls elu s u0artrxf3ty1oa  an ilt srtmxmpiydopeelnvslt  Dtmuronu4tlxnioeiatfsDuau pnt)alenifctotlatr ieols  2urim3nydlpe  netl(  2taxr nt0tlt mieiysla2rau p u4tleomocty1la eauvs;( t2to(r no1openlfvt ()s2raurp;o0altn oeiyd m2emn o t4tlermr iydla   n s;()srum(o3iydalenlivsa(f Dtauro;o0tetomo3iyslm ul(msnu) rxnxocio1lmte uvo;t0 rurim ou1lmee ici s)a2tmu  nt0aet  f3iytlm2ul( pnt0tetoioctadfp ean i t  2uoir3iodlm n nvs ( s2umuront4tpen o3tlsfa2elu sn(4alenmo3ia1oatranvo s0texoiopiu4lltn fcsat srra(m ou1opt iieiydfm2umnvsnt4trxrxo3ia1omt  nvsl()s2xoxrpio1llt  icsa( s2ra(  ;u4tptn ieiys aDeaumpnt0tltrmr io1lpD lnei;t s2to(m3iu4al nlfvt (  2rmxrp;t4aeto f3iyt sDelnvo u4areomf3totlpt auvs () eumiopny4openlics (faDrrxr nt1opxnioeiytlmDraums (0aexrmf3iydfmt  n s s)teuo(mpiodlm  mnvsat)aDtrxr oo4tex mociasfsDul(vonu) exrmo ta1oateaivo;(0trumxm no4ale livias) 2tr(m nt0aexn i3tad s2emnms ()aexrxr3oodfm raneolt t2uo(rpiu4omt lfviat sDrmu  nt0apto feiasfs umu s t0 rxrxoctadfm e ues;t srtm(o3iy1ome livia(fa2umu p;u4olenmoetasla2elu p (4aleoifciadoaDr nesl()srto(o no1apee ncslsfsDtr(rpnu4optomfetld mDemu s;t0trxnio oa1fpD lnvi t  eum(opiy1ap  mivs t) 2rrxrono4tlenifeildls ra
\ No newline at end of file
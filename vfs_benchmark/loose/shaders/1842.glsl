@@ -0,0 +1 @@
+i il()t2xmim ou4ol nmncsa()aDrr(mpno4ape  oeiadfs um(vsnt0alxrir3iodom  auvo;t)sruoio3oo4alee fes (f rururoot4tpe  ieiyd sDranms t)altnmoctatlm rai i t  2toxr3oudlme liet s s2truronu4texnmiciasls2emnmo (4 exomfctydom r iei t  rtm(opiy1ol emnvsl(fsDrmxrpou1tee  ietlsfaDum(mo ()aetrmfcoa1oaDran slt sexr(rpoo1lmee fcs s sDua(ro;u1apt mociyslaDrlnvp (4 renxr ty1lp  lnes;( trumxopnu1op elics t artm(mo;t4apx ifeiyd s2rl(vo u4aexnio tytfpDrau il(  etoio3iy4ope  ivslsfsDrru p;o4teeomi3iytlsDul(vo u) rxoircoy1lpD liei ( tetrimpiy1olt mnetlsf Dtm(ro;u4aleo ictyt aDrmumo (0aeeomrcoy1laDe uvs ()srtrimpnodamtemiet ()sDrax pnu4tptomi3iyt a2em(mon(4 ltnmrciodfaDe n sl(0 ruo(m3oudom e ivtasfarumurpot4texo fciytfmDulump;(0arermo oytfmtran o s tetrxopny1lltelfci tf rurx o;t1apxo oetldlm2ul( p u) lxomfcia1om elieo;t) rtm(m no4omte fcs tf Dtmxmpno1oexnif3tldlm2ul(msnu4arxrio3tydopDelnvs (0trtrxr iydlltelies ( s2urum ou0aptoiocildfmDrln pnu4areoioctytomD lieilt  2toxopiu4apeelfetl()srtmx onu1altoiietysfaDulnvpnu4 rtrir3ia1omtr i s;s t2tr(rpny4lltn ieilt s2tr( pnt0alxn fetydlmDelnms;t4trtoif oy1oa eli ols  exoim iydlm elfeia()artr(ront1ole ioetasfa2eln pnu4arxnmfcta1lmDrluvs;(0s2tmxo3oodapen nvs ()sDta(mp;t1tpxo ociadfa ua( snt4altoif ia1fpDranvi ()trtmir3io1olt  fei tfsDum(r no1alx mfeildfa2emnvp ()artoio3iatfa  lies;()seto(o3ou4ole mnet (  rtr(ronu0aptnioctltls rl(ms t0 lenir oodopt auei s0 rxmirpno4aptelici t)arua( oot4ope  ieiytfaDrluvon() rtnxo totfaDeai s;t0tetr(r3nu4ap e nctas)srtr(monu0tpeo fctls a2ulnmp;()trxnmocto1lmD  n o t  2tmim iy1lme  nvt t)sDumurooo1tpxoiictyd aDemn s;(0tlxrxf tydop elu i;(0srxoimpou1llt  nvias arra(moot1aee  i3iysfaDrmn o t0 rerxf iadoaD  ivol(  rxmim3oodomtn nvi () rrax ono0olx moctlt sDulnvpnu4 reomo3ta1lp r n i ( t2xr(m3oy4lmen net sfsDum(  nt4oltn octydlmDem(mo (0trxnioctydlp   nvs t0 exmim iydope  net s)s2rrxmo;u1ope  f3iad a elnvp;()alxoio oydoat auvi s0t2toxo3nydoptnmncils)a2rm(monu1aexniieiydfa2rl(vs u4teeomr3ta1fpt ai sls)trtrimpnu1amtemfviat a2tm(  ou1tlxn o3iatlm eauvp;t) rxrmf3todlmtranes t0trur(r3oy4ll e ict tfsDuax pot4tpxn feiydfsDel(vpnu0 rtoxfcia1opDrau slt)srto(r3iydal  mnvi ( a2rmurooo4optomoeiytfsDeau o t0trtoxo3iytfpD lnes ()s2to(rpoodlmt  net (  rua(  nu0tle io3ias m2ea( s () eenir tytlpDraneols) exr(o io1lltn ncsat srum(mont1teeoioeild aDel(mo () rtoxr tatom e nvil()trtrxrpnodamtnmncsas)arra(  ;u1tltoif3tasfa em(msnu0 rtomo todfp ran o;s)setmir io4lp emneiat  rtaxrpnu0tpe iicilsfsDuluvp;(4tlenio iotfa elneilt t2xm(m3ny1aptnmieslt)srrmumoot1opx  iciys aDel( snu0artnmf3oadla  au i;()truoxo iudlpe  ict s a2tmu ooo4tlxn feiad mDemn o t0tltoxo tadlatrlnvs (  rxmxm iy1olt lnetl( aDra(m oo1olxo octatla ran p;(0altrmo3ia1fptr ivslt seto(r3io1op n nei tfs2tax pnt1oex  o3ias a2rln s t0aeenio iydop rau o;s) 2um(m iu4ll nmicta( arua(ro;o0optn f3tys s um(mp;t)trtrio3to1opD au slt s2um(opio4oltelncils sDrr(mpoo4oex moetytlm2rluvs ()arxrircoodla rai i;t srurxm3iodoleemfvtls  Dum(rpno1oeto ictadls2emnmo t4tetoxf3oo1om r i olt srxrio3no1oltelieslt) rtmum nt1apenifciys s rlu pn(4aetnxfcoodlmDranvo;t) rxoxm3oo4lp   neilt)arrrxmoot4oet  iciat s2ra( o;(0texoxr3tytom eln i;s  rxrir3nodlpte ivta( a2tax  no1apxnmiciat s2uln snt)tlenmr ia1oate ues;t0t2tmxr3nu1lltn fcsat  2umumoot0alxomf3iytfs rmuvo;t4 rtrmocia1lm rli o;t)srxr(m nu1apt micsltfaDtm(mono1aexomo3iaslm2elumpnu4aexoxociatoptranvo;s0setoxrpiu1lmtnmncs sfsDraxroot4aeto ietaslsDra(vs u4 ltrio3to1laDelivs;(0 eurirpny1oleelnvilt  rra(mpnu0apeoif3ilt m2ran o t0tlermr io1fpDelnvi t texmio3ny4omtemietasfs2ua(rpno1apxomieiydfm um(mpnu0tetnir3tatlmDrai s;s sexoxr io1lmt  net t)s2umu ono1opxnio3iysfsDrluvs;t) rxnif totlm eaueils)s2xr(r3ou4ope  ncs s)arrrxrooo0alxniiciytlmDrluvs;(0tltrxr3oy1omDeli i s) 2tmir3iu1lpeemfviasfs2urxm ;o0alto ictlsla ean o u0altrir3oo1opte uvo s0 rtoxrpoo4opee ivtasfarumurp;o0oeen oeiyslmDel( onu) eenxo tatomte ieo ( sexm(r3oy4lle mict s  Drrxr ;o1alenmf3iytls2ul( sn(0tetnmf totfpt aivolt srxr(rpoudap nmfes () Dtrx  no1tetniiciadlmDraums;t0artoifctydoa   i s (0t2umxr nudam n iesas srururp;t4teenio3iatfs um(ms;t)aeenmfciydop elivslt setm(opiydomtelfviat)sDrmxm ;u0aetoifctatlm rmn o;u4tlermr3ta1lp r ivslt0 eumir3nu4apenlies ()s2tm(ro;o0aetn oeilt s2um(mo t0 reoxo3iadomDelivo;()setoimpoy4al   fctltfa2rmumono1aeen ieiysla ua(vpn(4 reoiociodomD au ols)srtoio3iy4lp nlfetatfarua(r nt1oex  ictatfa2eanmsn(4 lerir3todop eanvs s)srtoxm nydam  lnvslt artmumpot1aee io3iydfmDua(mp t4trenxfctadlpt  nei t0 2uoxopny4om nlnvil(f rrrx ono0ape mfctyt m eaump;u4arxomf iy1omteaiesl() rxm(o3iy4apeemnvtl( sDrax oot1alx moeiltla uan p t)arermf3oytlpDe i o;t) rxrimpoy1omee ncslt) rrmx  ot0tlto i3tadfs ranvp;()artomrcoadfat anvo t0trxm(opoy4ll elicsls)srraumo;t4oexn ieias m rlnvo u)trxnirciadfaDeai il(  ruoim3nu1lp n nvsa(fs2ur( onu1oex  feildfmDumu o u4trtnmf io1lpD  uvol(0 exrxo iudap e ivtatf 2uaur ot1ale  ociat s rau p;u) lxrmr oy1oaDe uvilt)seurim no4ome lieslt)s2tm( pou4tlt  fetlsla rl( o;t0alerxfciytfaDrlnei;s  rxoxo no4lpeemfvsat)a2umxm no1opt io3ild a em(msn(0tltnir3iotomDeauei ( s2xo(o3nydol n fetas  rrmxrpoo0tpe mi3iadfmDemn o t4artnmf3ootoatraneol(0s2xrir3iu1lpee fei tfsrtaurpot4oetoifciatlm2ul( pn()trenmfctatlatraiei;(0s2xrim ou1openlfei t)a2raump;t0oeeomo3iad a2rlu s;u)trxriocoydomDe u s t) 2tr(r nodam nlneia(  2uaxm ;t1tptnmo3tadlsDemnvo ()tlxomo3tadfaD au i;s trxrir3iy4ll elfet s srraxroou1oeenmf3tyd s rlnmpnu0altnxfciydlmtrau o t0 ruoimpiudapt lieias) 2ta(r ou0tptniietlslaDul(vpnt4 renio todlp rlueils)tetrxr iu1ameemietasfa2ra( pot4aptn o3iat s2uaump;(4trxomf3ootlmte i s;t texo(rpiu4am n iet s)srrm(rpnu1opxniociyt mDel(vo ()alenxr3io1opt  ies;t trumimpnydol e icslt aruaxmoot4aptoii3iltlm2eaums () exrir todlaDeaivo t0 2uoim oy4altelfei (  Dumxmoot0aeenmieiysfs ulums t) etrio3ia1lateaueil(0srxmir nu4ope mfvtls  ruaxrpou1tet  oetyslaDrl(mo;(4 renmr3iotlm rauei;s) rxrir3iodamenmneilsf rtmx pno0tetnmfciydfs ra(ms t0 rxoxoctotom  lu ils) eumir iy1op emfvsatfa2um(mp;t1tex ioetltfaDrmumsn(4 renio oa1lpt auesl(0trtr(opno1lpt  fvt (  ruax pnt4tetomieiysfm ranms;t4 exrxrctotla r ues t0 exrimpoudamte iesa(fa2tr(r ot4oexniocilsla rmums;(0teenxrcoo1oat lneils)srtmim iudom   fctlt aDuaurooo4tlxn iciltfsDem(vs;(0trtnxocoa1fm e ivols0teto(mpoy4olt  nvia(fsDumx p;u1tlxomoetys aDrmnvpn(0 exnmrcoydfa ean slt  rxrir nu1amee fcsa()arurxm ou4teeo ociyd mDuaumpn(4tlxoxo3iy1lm   i s;t seto(o ny4ap  mfci t) rtr(mpnt1oexoioeiasfm rm(mpn()trtrxoctadlp r uvi;t  euoxo iu4amt  feilsfa2uau pnt1ope iociysfaDul( o;t4alerxf oadoatelues;s)tetrimpoo1ol  lnciltfa2uaxm ;o1tptoifeiyd a um( p u4 ltrxr3ia1lm  anvs;t srto(mpiu4olt lfvt ( a2rmxr ot0texnifeiydlaDelnvs;t4 eerxo iotlmDrlieo;t) exoxr3nydlptemnvtat  rumumo;t1openmoetadfa rl( o (4texoif3ootlmteaueil(0t2uoxopoy4lptemiesl( aruaumpnu4tet  fetls a2eanms;()tetoxo iatlm   uvi ()t2ur(rpiy1lpt  ivias  Draumooo1alt mieilt s2rmn snt4artomrcoadfat  uvs ()truriopou1apt lnvs s) rurumont1aetnifciyslsDrl( pnt0 rerxr tydopt lueo () 2trimpnu4lp   ies t  rtax  nu4tpenioeilsfs ra(mpn()alerifcia1lm  ai o s0srxoir3oo4alte ieiltfsDtmxmont1oltomoctlsfs ranvs t0trxoir3oy1omt au i (  euoxm3iy1apte netat s2um( pot1opxomiciad m2ean snu4altoio3oodfmtr neils  rxo(m nu4oleemies (  rrm(m ot4alxo f3iasfaDrm( s (4 etomo3iodoptelu s ()setoxr3no4lme  ncsls)srraumpnu0apenmiciadlaDrl( o;(0alenir tatop eln s;()srumxo iy1al nmnes () 2uaxmoot4aeen oeildla2rl(ms;t)alenmf3iytla eaivi ( t2uo(o io4am e fvia(fs2tr(r ;u4tleo ictadfmDua( o (4arxrxf to1lpDrlies;( texm(m3oo1lptnlici ()srra( oot1aleniiciys a2rmu s ()alxnirctotom eaues;s)srxo(o3nu1lltemivs s aDtrur nu1opx mfciysfmDuluvo (4aleoio tydoat luvo;()t2ur(mpoo4lmt  netlt s2rau  oo0tpxnmoetldlsDuau o u0aleniociadlaD lueils0 exrxopoo1oltelici tfaDrm(ro;t0alt mfetls m2rmn s t)tlenxf3iatlp  anvs ()setmxo3ou1aptelfvta()aDra(moou0aptoii3iydfsDrau s u0 exrxr iytlp r nvs (  2uoxopny1al elfciat)aDumu  ;u4texoiieiydfs ra(vo (4artnxrctodfm raivi t t2uo(o3oydalt liesl( a2urx ono0alxnioetys a emu s;t0trerifciodoaDe neo s s2tr(r no4oleemnetas arra(m ;u0tex mf3iytfmDeau p;u)tltomf3ty1fat livi ()srxoxopoo4llenlictl(  Drm( p;o0tle mi3taslm2ea( o;(4trtomf3tadomtrlnvil(0 rtrxrpoydamtnmivil(  2rm(rpou1tpxo o3iad a umuvo (4aetomoctotomDr i o;(0texm(m3oudolee fvs t aDrax o;u1tlt mi3tyd a ulumo;u0aetrmocoo1op rauvol(0 rur(opny4ll e ivils)sDum(rpoo0tet ioeiatlaDuaumsn(0tltomr3ta1fp r n o;t  2toxr3iy4ome mfes sfa2rau o;o1olx  ociatlaDemnms t4altomf io1la e u o s)t2ur(m nu4omenmfvilt artru pot4aetomocils m ranmo;u)aeenxf ty1op rluei s0tetm(opoy1llee ivs t) 2urx ono0aee  i3tytfmDrmn o (0arenmf3iatom rluei;t)tetmir ny4ap  lfeta(  2rax pnt4tpxomociytfsDemuvp t4 lxoxo tydom eliei;t) rtrxo3nodllenlivta(f Duaxm ;u4ale miciltfs uauvs;()alxomo iodoat  u ils)texo(rpou1lpe  nvi t)sDtm( p;u4apt mi3iadfa emnmo;t)alxnxr3ia1fptran i t0 rtoxm iydlltn nvia()sDtmxmonu1oeeoiieiydls rmumsnu) ltnmrcoy1lmD  i olt truo(m ny1optnlivi (f Draxrpnu1texo feiatls ua( pn(0 lxnmo3ty1la eauvi;s0trxoir3io1ole  ieiat)srraxrpno0oetnio3iydfsDul(mpnu0arenmocto1laD lnvi;t0 rxrir3oo4am e nesl(f Dtrum oo1optomieiys aDemnmo;t4 rtnif3ia1fpDraieo;t t2trio3oy1al elfvs t)srrmxrooo0tlxn oeiysls umnvo;t4 leniocootfmD  nvolt  2tmir3nu1ole  ncslt)a2rm(rp;t4ole mo3tasla ea(ms (0tlenmo3oadlat lu il(  2ur(rpoy1opt mncs sfa2tmx poo1oeenifeilsla2ua( onu0aeenircio1omDe u il( setrirpiudal nmneia( aDrmx  ot1aexo o3iadfs2emn s (0treoiocoa1laDeaueo s) eum(m oodoltnmivi t) Dtm(  nu4texnmi3tys a umump;u0trtrxrctotfa  aivolt0 2xm(m iydamtnmnvslt srumurpnu4opt iociyt m rlump;(0 exnmoctytfmteaneo ( trum(r3iy4lptemfct tfartmu p;t1tptomfeiatla2umnvs;u4tlxrifciy1omtelu i s0texoxrpiu4ap  mfvsa()sDrr(monu0aleomf3iytls umnvs ()tetoxfciatfm  li olt t2xr(mpoy1apeemfct t)s2rm(mp;u1tlx ifeias m2rm(ms;t)tlxnircoatlm e ues;t) etr(m ou1alee nesls) rtrxrpnu4opxnioeiadfa ua( sn()trenxf oodfp e nesls0 exo(m no4amt  fctlt) 2raur ot0apto fctls aDra(vo;t)aetomr3oatlaDeai o s)trum(o3iy4llee ictl(  Dtaxm nu1alxn i3ilt m rluvs u)tltoxociytoatelueo s) 2xm(opiy1ol  lneiatfsDumumo;u4aetn o3iasfaDra( o;u4trxoirctydlp r nes;(0s2tmir oy1op e ies s)a2umxront0tlto i3iyd mDulnvo;u) rxrmo3oytopDrlu olt) rxmio io1optnmnvilt srtr(rpoo1tptn fctad a2umnmo;() etnircoa1lmD ai o ( trtmim3iy4ol n fvsasfsrum(r ;o4olx ioeiatla umu s;t4teenxo3tydfpDr nes;t)t2xm(r iydolt mfvsat a2uaump;t4texo ieiytls uauvs t0alenmo oo1omDeauvs;(0 exoxo3io4lmtn fesl( artmxmp;t4olx  i3ild mDeln s;()texnmo3oy1oaDrluvs;s setm(mpio1ole mnvtl()s2rmxmpnu1apxniiciytfa2ul(vs;(4teermr oodlpDr ieo;t0 etm(m iu1am e ivta()arumxmp;o4tlx  f3iadlaDra(vs u) lxnmf3iodfmt aivo;()trxo(r3nydlpen ivt ()aDrmxrp;u0apxoiicildfs2ean o;(0 lxoifctydlaDeli il(0 2ur(m3iu4ll emncsas) Drru pou4opeoifciadlsDelnmpn(0areomo3ia1fm rlu i ()t2ur(r3oo4lpen iesas) Durxmoot0tlto oeildfsDuluvont4arxnxf3ootlpteliesl(0tetrxm nu4opt  fcil() Durum nu0oltn oeiyd a2uanmsnt0alxnxf3tatfp r uvs;s0seuriopou1lpenmfesa(fsrtaumono4optoifctlt a rmn o;t0tltnmocta1opDr nvil(0 rur(m3oy1lpeeliei (fa2rax  ot4aeeomf3tld sDrlu o (0 rtnmoctatopDeanes t0 2umim oy1amenlivt s a2ra(r ;u0tle mo3iatfa uauvo;(0 etnir iadoaD  ieils) 2uoio3ou4lptnlnvs t) rum(  ;t0altoif3tat s2el(ms;u0altriociytla eauvs s) etrir oudamtnlneiat  Dtmu p;t0teeoif3ild s eln s;(4texrircoodoaDraues;s)srto(o3iy1lm  mics s) rtrxm nu1opx if3iad m2uanmp;u4areomr ta1om  auvs ()srxmxm3iu4lle mfcias  rurxm nu4olxnii3tadfa eln p;t4 renmf iadlmDeauvs;t trtoimpiudaleemfctlt srrmum ou1ape mf3tatfmDumnms;u)trxoxrcta1op raueslt0 eumxr3nydom n nvilsf rumxm ;u4tpe iiciltlmDemnmp;t4alxnir ootfptr ueo t)texoxopoudameelici s)srtrumooo4aeeoioeiyt m uaums;t0 exrir3oadopDe nesls0tetmxrpiodopee nvsls)aruax pnt0oeeo i3tltfm rmnmo t4 exrio3tadfp eaies t trxoim oydlme mivsa() rur(m ;t4alen ietytlsDea(msnu0trtoifctytlpD  n o;()trxr(r nydap nlivtl( srrrxro;u4tlxn ietyd s2umnmp;t0 eerir iatfateaieslt teuo(rpio4lm emietas  Dta( pnu0tpxnifcias m el( onu)tlermr oydomDr uvsl( t2xo(r oo1ape lnct t aDur(r ;u0tex moctldls2ulnvonu0teenmf3oydfp  lnvols  rtoirpoodap nlfesa(  2um(mo;t1aexnif3iyslm emu s u4altoiocoytfmD  n i;s0srtrxr oodaptelfvtat) Drr(r ;o1tptn fctatla2uluvsnt4 ltrif3todomte uvs;()s2xrio3iodome  nvils)s2tru  ;u4opxo f3tad aDrmnmsnu) rxriocootfptelivilt  exmxr3iu4lmtnlfeslt  rra( o;o1optnmocilt a2elnvo t) ltnxo3ty1fpte u ol()texo(o3iy1ol e fct ( arururpoo4opxo fetasfm2ul(mp ()tetnmr3iotlaDeauvo;s0sexm(o oudop e ictls)sDtaur no1aleo fciltls ea(mp;(4aetnmrciadfm rlieo s0tetrir3oodll  lfetat  rurumoou4alxnio3tlslaDumuvp t4trxoxo tatlm e ues t)srxmir iy4apeemnes ()sDur(  ;t0aetnmfetls m2ua( p (4 leomoctodfp elu sl()t2xmxo no4lmtnmivslsfsruau  ot4tpeomociasfaDrm(mo u)tlxrxociytlp e nvi;t) rxmxr nydlpt mieta( s2rrumo;t4optomi3ilt s emu p;t4 etoir iytfa eln s;(  etmxrpoy4ll  lncs s)arrmur ;o4apxnmo3ilt m2rlnvo;u0aetrxr3tatfatrluvilt0 2umir iu4lmee nct (  rrr(mo;t4oltnmictldfs2ranmo u0arxrmo3iodop rlivi t  rxm(r3oo1ole mnesatf rrmu  ou0tleniiciyd m em( sn(0texnmo oy1lmtelueol(0texoiopnudlmte icsa(  2rruroou1optomoeilt s ulu s u4artrxfciytla r nvs;t0s2uriopno1omte net sfs2rax pno1tpt ifciatlsDeln s;t0 eenxr oydlp  anvi;(0tetr(r3iudamtelnvs ( s2tm(  ;o4opx  fetltfm ean p t0tetrmrcootla eau s t)teumxm3oudlptnlnvi ( s2rru pno1apxo octyt m eln snt4alxnxfcoatlmteanvs;(0seum(o iydlme lfet sfarururp;o1alt  i3ildls rmu p;u) rtrxo3oa1lptranvo;t sexmxm3nodalt  fct s) Draum ot1tpt  o3tas s2elu o;t)areoxr3todoaDr ieslt)srtmir3ny4lptn fesls) Dtm(m no0ole  oeiat a2em(vp (4 rtoxo3oydlaD ln s (0srtr(o3ou4lp n fvsls s2tmx ont0alenio3ias sDumn o;t0aetrif3iodoa  an i s)sruo(o oo4lme lfvs ( a2um( poo0aetoifciad aDua(mpn(0 reomf3oodlm r nvi;t teuoxopio4ap  lfesl() 2umx pno4oexnmfctlsfsDeln pnt)aetrmfctytlmD livilt)s2xmiopiudlpt  fvt t)srtmu  nt0tpxn f3iytfs2um( pnu)aetrmr oytfmDelivs t0srurxr3nodol  mnvil( artmur no4alxn i3iytfm2elnvo;u0 eenmo iy1lptrlues (0 2xo(o3io4openlivsls)sDua(mp;t4tet  ietlt aDrauvs;()aeeoircoydfmteau i ()t2xriopnydll n feilsf 2ra( pnu0aptn oetadfsDeanmp;t0alxnxrciy1optrlu o;t srto(mpiu4opt mfvsas) rra(r ou1alt mo3iadlmDrmn pnu4arerxf oa1fmD  i sl(  2urxrpiu1omt  fcsls)srraxro;o4oleo fciad m uanmp;()treoirciodfptelu sl() 2uoio3nu4olee netls)srtaurpot1alx moeiat m2ra(vo;t0 exomf3iydfaDraneo;( t2xo(r3ny4om elfct tfsrrm(rpot4tpe  fetadfm2eaump ()altomocoy1op r n i;()sexmim3oy1omee ieilt  2ur(r ;t4tetniieiys mDrlnmo;t4trtnmo3tatlpDeli i;(0 eurxr ou1alte neil()aDtrxrp;o0oexnmieilslm emuvo;(0 ltnmf iytlp  livsls trur(opiu1lm   nvt s)s2ur(rpot4aetoif3ildfm2eln s (4 rtrif oodla  lnvol( t2toiopoudlmenmfetat)a2taumpoo1aetoiociltfs uau p ()alerif tydfmD liei;t)trumxopou4aptnlieia()sDtm(r ;o1apxomfetldlsDuluvsnu)aetoxr tadlpDr n il( s2tmxmpnydalenlfvsatf rurum ;o4ole  fetatfa emu s;(4aetrxo iy1oaDrln sls)t2xrxo iu1om  lneiatfa2umu p;t0tlx  ieildfm ea( on()tltrif3iotlpD luesls0srtmio3nu4oltemnctas) 2rm(m nu4tpx iiciydlm2rlumsnt4tetniocoy1fm   i o;(0setmxrpoo1lpt mfctasf Dtrxr ;u0tpeo ocildlsDrmnmont4tlxnxr3iy1fpD  nvi s srurim3oy4om nlfeils sDtrumpnu4apeo oeiyslm eluvon() ltomoctodoa  aueolt0 2tm(mpiu4am nlncia() Drm(m ou4aptnmo3ilsfaDranvo;t4 ltrxr3iy1fmD aies ()srtoxr nu1amenmfvtl()sDuaum ;t4tetomiciadla2umumpnu4 etoio3iatfat  n s (0tetmirpnu4alee ivs tf rtaxr nu4oetomfciydfsDean p;t4 etnmo io1oat aivols0t2urimpiy4lmt mnci sf 2uauro;o1opt mi3iasfmDrl(vpnt0trxrmr ty1fatelueo;t sruoio nydllenmivsls a2rrxmpou1tlx mieilsfm2ulnmp;()alxrxr3oadlpD livilt0truo(mpny4al elfcsl()aDtax  ;o0opt  fctyt mDra(mpnu0 eenmrcto1oatraneil( sruoxm3oo1olte ivil( arraumonu0aptomo3ildfaDraums;t0tltrmoctydoaDrau sl()srurxopiy4apee ieilsfa2rrumpnu0tlenifcils a2umn on() etrmf ootfat  ueolt trxo(r3io1lp emnvtat  2uru  ou4alxoifcilsls ean on(4tetnif oo1fm   n s;()srur(r3oo4lm   nvsas  rum(rp;u4altomiciydfa eauvonu) lxnif to1oa r ues s)s2toir iy4omt micsl()aDtax o;t4tlt  i3tytfa rmu s t) ltomr3tatfmDe u s t  rxoxm3oo4op  mfesls  Dtm(mpoo0oee  ictlt m2uanms u)texomo tydfp   ieo ( sexmir3iodlmeelfesltf rrr( pot1oexn oeilt s2ul( p;(0alxrxr3iy1fpt  ies s)texr(o nudaltn ncil()a2um(rono1olen octlt a2rl( s t4tetrxo iytlmt ln s s truo(r3io1ol   icsatf Dtax pnt4tee  oeildlsDul( o u)aetomf iydom eln o;t0srurxm io1ape mfetlt  2rmxrpnt0alxnmictld mDum( ont4 exoirciy1oaD anes;s0 etrimpnudapenmfcsl( sDta(ro;t1tlx  ieiad s ea(ms u4artrmrcty1fm   i i (  exr(m oy1apt  iesatfa2rrxro;o0oetoiieildfs2ulumon(0trtrmfcty1fmDr i slt tetm(mpio4omee iet sf rtrur ;u4aex mi3ild m umnms;t) reoir iy1fp raneol(  2xrxo oodaptemfeslsfarraxro;u1open o3tls s ran p;(4 renxocio1fateliei;( s2xmxm ny1omtemncilt)s2rm(mpnt0tpe  ieiyd a2eanmo u0trerio3iadopDr uei ( srxo(r iudope  ivsa(  2trumpou1olx mfeiysla2eanmo;(0texoircta1laDrau o t) rtmxmpiodlmee nvsat aDtrxrpnt1aeenmociyt aDean snt)tlxnmfctodomtrlnes;s)trtoir iy4am emiviltfsrrmxm no0aeto i3iadla rlnmsn() ltrir3iotopt aneols srxrio3iy4amt mnvsls  Dumx p;t4teen o3ils a2rl( onu4alxrxo ty1omDr i i t s2umio3iu4lpt lnvta() 2uaxmpou4olen octltfm2rm(ms;t) exnxr oadoateln s ( s2urirpiodomen fctas) rrr(m nt0aleomfcilt s2eanmp;u)aexoxo3tadfmDe nvi s) 2xmiopnodam nmics tfarrmxront1tex miciat m2eanms;u4 reoio3oytlpDeli s s)s2umxm iudal nlnes s)aruaumo;u4aet moctyd mDrl( o;(4aexriocty1lmDraiesls s2xm(o oudamt mfciasfsrtau oot0tetomf3iyt aDrau p;u)aexoir3ty1fpt auvolt)s2uoxo no1al n ictas)aDua(  nt0aee io3ias a umn p t)teeomfciydlpt lnvs ()trxm(m nu1oleemiet sfartrxm nt4alxnifciatls2rmu o (0tleomo3tadfp  au s ( setoimpoo1amtemfesl(  Dur(mpnt1oleomiciytlm2uanvont0 eerxrciodfpDelivilt0 2xmio no1ale  ncs () Dtr(r ou1oetomociasfs ua(mp;(0texoxo tadfptean o;s  2ur(r3oy4lp   neiltfsrtaxm ;u4aexo i3iadla rluvonu4trenmo oodlmDrlu i ()tetr(o no1lpenlneias) rrmxr nu1aetoiieilsfmDranvp u4 eeriocoa1la  aneo s)s2umim iudape liesas s2rr(m nt4apeo feiadfs2em( s;t0alxrxr iodoateanvil(0tetmiopou1apee iet ()s2ua(r ou4tet miciydla rauvp;(4tetnxo ootoatr ieols)setm(o3ny4omtnmictlt  rrr(rpnt0teeoio3iytfsDuan s;() rtoif3iy1opt au sls0tetmxr oudope  nvs t arrmxmoot0aetn fciytfm2ra( sn(0arerirctatop  au o t s2to(r3io1ape licils) rrax pot1apen icilsla eau pnu4altrxf3to1op  li s t)teumim nydlmteliet t a2ur(mpnt0opx  oetldlsDulnvo;()texrxociydfmDrau s ( srxoxr3oy1am n ivi ()s2tmum no1oexo oeilslmDuaumpnt0altomr3iydoptraivi;s t2xrxr ny1al n nct tfa2taump;u4alen oetat aDuluvo;(0trermr io1fp  lu o t) rto(mpoo4lltelfeta( aDra(mono1tltnmoeiysla2ulnvpnu0tlenif iotlm eaivs;s) 2to(rpiy1olte nei () 2rax pou4tlt mfciydla ra(mo t4 rtrmo iotla eaneo s)sruoxr3io1olt  fcsa()a2umx  ot4aexnmictldfs2umnmont4aexrxo io1fm elivol(0 euo(mpoo1apenmicslsfa2tmxm ;o4tpt ioeiyt s2rluvs t0 lxoif ta1lmt  uvs ()srum(mpny1om  lneias sDurxr no1tle  o3iydls2em(vo t4 ltrirciy1fa ran s;s0 rxoir3io4apen fesltfartrumpnu0apeomfeildls el(msn() exomociodop e u slt) 2toxopoo1apen nvs s)srumumooo4ole ifeilslsDumn o t4alenio oydlaD lu i t0sexm(m3oudlme  iesasfsDua(mont4oex  fetytlm2ul(ms (0tetrxr3ootlmD aivols)texrxm ny4lpeelnvt t sDuaur ou0apt if3ilsfs2ulnmsn()aleoxfctytlaDr nei () exrim3ny4openlfcs (  2trxronu0tpxnif3iadlm ul(monu0aeenxr3ta1la  lu s s)setrim ou1ome  neilt)arua( o;t4apen i3ildls2eln onu0alxnir ootfpDe n i t0s2uoim3oydll n fetlt)aDua( oou1oleomoeiytlmDrlu pnu0trxoio tydfate uvi s0 etmiopiodlp nmiciltf Dumx o;u0apenmiciyslaDrlnmsn(0tltrir3oadfp  aueo;s0s2umxr no4amtn nesa(  rta(rpnt4tpe mo3taslm2emums;t0aleoxo tytfm r ieo;s srumxo3ou4al elfvtlsfarrr(ro;u0olxo o3ildlmDrl( onu) rxoxrcoytfptrluvi;t)seuo(opnodoltnmivt sfsrum(rp;u0aee  i3iyt m ua(vo (4 rtoxrciatomtr i i;( trxmir3ny1optn nctl( srrrurono0tlxomo3iydfm elnmo;() ltoxr3iytfmDr nvslt  2xm(mpio1ll emict t a2urxmpou4tltnmfctadfa2uln s;(4trenmfcio1omtrlivi;s texoxm3ou4ame  fvsatf Drax o;o0aee  ieiat m2eanmpnt)trerxr ia1omteanesl(0t2urxrpnudol   fctasfarrm(r ou4ape iiciltlsDel(vsnt) rtrir tydlmteaues ( seumimpny1omtnmivi t sDtm(  ;t0aeeoii3ias a rlump;t4artnircta1laDraueil(0 2umxm iy4lle lnet ( srrr(ront0tltoiocilsla eau o;u0texoircoydoatr n sl(  rtoio3iy1altn nctas  2tr(mp;o0tpxo feildfa ulums ()tltnio oy1lmDr nei;( setr(o3oy1optemivt tfarrrx pnt4teeo octad m2elumsn(4 renmr3iydlat  ivo;(0t2to(r oudllte fcsatf rrrxr ot1tltoiociytfa em(mpn(4tltrifctydlm ean i t s2toim oo4op n ncsa() rraur ;o0oleniociltfm2eau p t)alxoio3tatlpDranvi s)s2triopnudlpe  nesat sDtrumpoo4ole ii3iltlaDel(mo t)tlenmr tadfateaues t0s2tmxm3no1lpe licils aDurx  no1olxnmfctadfm ua(mo;u0arxnmo iatfpt  ueilt0srurim io4lltn ieslt a2rmur ou1oet  ietadfa2ua( s;(4trtrmf3todoptelueo t texrir3no1ll  mnctl( artm(  ou4olen fctyt aDranvs u)tetoxocty1oa e ieo () 2tm(mpoy4al elnvt (faDuau pou0altoiociydfa eaumo;(4trxrmr3oa1fmDeluvi;s)seumxm oodop nmfvt tfarraur ot0tltoioeils s2rlnms;()trerio3io1omDeai o s)texmim iydom  lfesls) 2tmur ;t1alenio3iasfa ul( s (4aetoxociatoat  u o;(0 exoir3nodamt mnetas) 2rmxmpnt1tpe  feiasfs2elu onu0alxoif iy1faD  nvi (0 rxmim3no1amee fci () rua(m ;u0apx  iciyt a eanmp (4altnxrctytlpt livolt0trurxo3iu4am nlics s s2um(ro;o1opt  oetltlmDua( p ()trtnif iotfaDeaueslt)srumio oy1ol nlnvtlsfsrrr(r ;o0ole mf3tlslaDeln o u4 leoio iy1la ranvo;s0trxm(opoo4ol n fetl() rtrx oou1tlx mo3tat s2emnvp;t) rtrxr iadla  anvo t0t2tmio3iy4apen ics sfarta( pnt4tlt iociys sDuln o;(4 rxrxocoadfpD ai s ( tetoxmpio4llen nei s arrrx onu1teen oeiltfsDeanvpnu0trenioctadfm e i s;s0 2tmiopoydap  mnvilt) rumuro;o1alxomiciasfmDuln o u4trxrmocoodla  lues;()srxr(o3iudolt lfctltfsrta( p;u4ape  octlsla2ul(vont)teenif tatom  li i;()t2xoio oo1ome mivi t)s2urx pnt4aet  ieiysfm emuvpnt) lermf3io1opD lnvsls0s2xr(r nydam emfvs t arum(m oo4tpto fciasls rauvsn(0 eenxf3iatla eluesls t2tmirpny1op emfctls)sDtrumono4teenmfctatlm emnvo;(4 lxoirciadfmD lnvil(  rxm(r3ny1lmeelivi (farrmxrpoo1apen oeiys aDrluvp;(4teenir tatlmD luvs () rumxm oo4lptnlicias  Drau o;u4aex  i3iad sDeanvp;t0 lxnxr oytlateluvslt truriopoy4ll n neilsfsDtrxrpnt4aee if3tldls ulumsnu)trxrmf ta1fp ran olt0t2tmim3nu1omtnlfetlt)s2umxmp;t4tetoif3iltls rmnvon(4teeoxr3iadlmDelues t)s2um(m oudome lfeiat sruaxrpot0tet if3iad a2rl(mp;u)texoir3io1oa e neslt srxmxr3ou4optelieilt)a2tmuro;u4alenii3iasfs2eanmo;(4 eeomf3oy1fmDe u s;t0t2triopiy1opeelnci ()a2um(m nu0aex mocildfm2elnmo ()alxnirciydla rai i s0srtm(o3oo4olt mnvsl( s2ua(m oo4teenif3ilsfs um( onu)areoxf iydlmt lies;()t2trim3iu4ape micsls srta( ooo1tptn iciys m umump u4 ltnircta1fpte n o;s0srtmxm3ou4apt  fcsl( sDrru ont1apt iocildla ea(vpnt) rxoio iydlp   nvs;()seurir nudlmtnmfvtls sruaxmo;o1olenmieiadfaDeluvo t4 rxrio3ootfpDranes t0t2tmim ny4apee iet s) 2trur ou0opxomi3iys m ulu sn(0aetnif3iotlmDelieilt) 2um(o oudomtemfci s) rrm(r ot0apenmociatlsDeau s;t4teenmoctotopDrlu ol( seur(opny1al nlivtls sDta(m nu1tpxnmo3iytfa uauvp t)tetrir io1fmtelu s;t0s2xrir iydlmt  fctasf 2raur oo1oltn oetldfsDrlnvp u0alxrxrciatfatrlivo;t0 rxm(r iy4apenmnci (  rrmxmooo1tpeo fcildla rlnvo;() reoxfciydfmDelnvi;(0s2tmxm3iu1ol   netas) Dtr( onu1teeniociat a emumo t0 rxoircoa1oaDrluvsl(0 exoimpio1lmtemnet (f Durx pot0aexnmfciytfs ra( s;()tlxoxf3oatomDe uvs t teumirpoydlp elfvs t)s2tau pno0tle  ictas s2ul(msn()aeenxr ootlaDeauei;s0teum(o oo4olen ics ( srurumooo0tlxnmieiydfs2ul( o;t4 eenxr3io1oatrlieo;t0 2trxo iudaptnlfetl()arrrxro;t0tpenio3taslm2rm(mp;t4 rermo3oo1fp eli i;t  eurir3oodlp e ivs sfarua(root0altomoeiadlsDua(vsnu)tlxnmfciytopte ueslt) 2uoir ny4al   ivsa()sDtm(ronu1apen fciad mDulumo;u) ltnxr iytlptrli sls  2xmir oydoptelivt (fsrra(m ;o4ape moeiltls2ulu s;t4arermr io1latrluvol() eumxmpoy4llenlnvia()aDurumo;u1aleomi3tlsfs2elnvs (4alxoiocoydfaDean i;t)trtm(o3iodllte fes tf rta(mo;t4opt mociatls rl( s u4arxrmr ootfa r i ols  2tr(r3io1lptn fvtat)a2um( pnt0alenmieiasla eluvp (4tlxnmo3oa1lmt aneol(0truo(o no4apt lnvsas aDtm(mpnu4tetnifctls aDulump;(0alxrio3ia1fmte nvi;s)s2tmimpnodope  fcsl(  rua(  no1tee  i3tyt aDemu o;t0aexomr tadfpDe u o;s0 eto(o iy4ap nlivt (  2rmurpoo1tltnmiciltlmDrmuvo t) rtrir oatfp rlu il()trxoxo ou4optemivsas)srtrumoou4tpxniiciltlaDemuvs;t0 lenmfctatoa elneo t  rtmxm3nudamenmfeias) rrmum ;o0tlxoifciaslsDeaump t)aexrir tatfmteaivi ( srxoir io4apeelnet t) 2urx  no0tex  fciltlm eauvo (4texrmoctytlaD  ieolt0t2tm(rpiydame  iei s  Dtr(rooo4apeomfctydlmDem(mp u4 eenxocio1laDeaivsls truo(opiodom n fes t)sDumxrp;u0opt ioeils s eau p;t0 rxoir oydopteanvi;( tetmir3io1lmeelivtat)arumxm no0olxo f3iasls2umumonu0 lenmo oadfaDeai s;s0trumim oodamtelivt ()s2rau pnt4oexoio3iydfaDran s;()tetnmfctatlpDeai i;()s2xr(r3nodlm nlfvi tfsDra( pnt1tetn ociysls2eln onu)aeeoir iotom rai i;t0 2xmio3iy4ll emfctl()aDraxronu4alx  iciysfs uauvp (0 etoif totfatr u ilt) 2xrxo3ny1lmtnmncsl( s2tr(m oo1alx io3tydla2rauvsnt4aetnir3iy1fmD  uvo s) exmio iodole mnet tf Drr(rpnu4altnifciyd mDrm(ms u) renmf3ty1fmte nesls0s2xm(o io1om  lncslt a2rmxm oo0apto oeiasfsDrmnmpn() renmr3iy1opDeauei;s  2urxm3oydalen icils a2umx  ou1teen iciydfs2eln onu4 rermociodfaD lu i s)trur(opiy1al elnvs ()s2taxmpoo4oetnmf3tlsfmDum( o t4 etoxf iotoat li s;(0 rxrxrpiudllt lnes ( a2rm(rpoo1oltn i3tatfm uanmp t4 reomo iadfmD lueo;s)s2tm(rpiydom e nvs s  Dtr( pou1alto octltlmDrluvo;u4tlxrir3oa1lmDr ues (0t2xo(m3no4ap elnet t) Dtrurpnu4oee  ociltfsDelnvp t0 lxnmf3to1fatelneols)t2trirpiu1lle mnes t) Drmumooo0alt iocilslmDran o t)alxoxr oodop  au sl(0 2xmxr nudll n ies t aDtmum ;t0opxn ieild a rmnvo;t4 ltomo iodoa eauvilt0 rurir oo1ap eliet ( sDtrxr ;u1aeto f3ilsfmDrmu p;u4 ltrmfcta1faDr nes s0srtoxo3ou1ll emfesa( aDuax  ;u1oeeomietadfa rlnmsn() rxnmrciydlat  u i;(0setr(r3ny1lltnmnvilsfsrrr(  nt0optnioetlsls2rlnvonu0 lxomf oa1fpDrluvi (0s2urio nodamee fes s sDrrurpno0tpxn oeils a2emumo;() eeomo3tytop ran i s t2xmim3iydlp emnvi (  rtru oot1aeeniieiatls ran p u0texoxo3to1op  lueil( sexo(o3iodopeemici ()aDtm( pot4tet  fcias a2rln p;u4 lerxo ootfaDrluei (  2tmxr3iydaltelieias a2tmx pnu1tptnmfciytlaDran pnu0 ltoio3oydlatrlnei s trur(mpnydlp n ietltf rtaxmpno1tlxomiciydlm2rm(vs t)alxrir3ty1fatr uvols  eum(r3ou1olee neta(  2ta(rp;o1apeniieiydfs uanmp;t4 rtrmf3oytfm  li i;s0setm(o3no4am emfes t  2trxrpoo4altnmfctasfa uln p;t4tlxoxo3oy1omt auvi;t0sexrxo3nu1apeelnes ( s2umur ;t1aptnmoctytfa2eanmp;() ltrioctatoa r n o (0srtrxr iu1ll emiet ( srrmu poo0oetnmf3iltfa2rauvp;u4 renif ootlmteanvol(0tetrxm oydamt  nvsltfa2rrx p;u0tee ioetad s2elnms;u0 eenio todopDrlueilt0sexo(opiy4apenmfci () ruru  ou1tpe if3tasla rmuvo u)tltomf3to1omt  ivslt trxoir iu1omt mncs t) Drru p;o1aex mfetatlmDeaumont4 lxrio oadfp raiei t) 2toio3io1lmenmfvia(fsDrr( p;u1opxoifetatfsDrluvp;t)tltnxr3totlp  anvo;t)t2xoimpnodom elfes s  2rrx onu0aee  ieias m ua(mp t4aetnio3oy1fat aneo;t) eur(m iy1oltnmies (  Drrxm ot4aptnmfeiltlm2elnvpn()trxrircoydfaDelu s;t)seurio ny4lltn nvilt)srra( pot4alen f3ildlm2rauvo t4 eerio3io1op rluei;s  2trir ny4al elfeta()sDraxrpoo4olxn o3tytfa ua(vs;t4aetrmf ia1fmDeanvo ( trxmxopnu4lptnmnciat)srtmxmoot0tlen iciad s2rluvs u4 rxrmfcto1fmDe ivols)texo(m3no4aptelieils)sDtrx  no4oeeo o3ild s2eluvs;u) etniocoadopteaueo;t0s2uoxrpiu4op   iesls) Durxront1oltn feiysls rau o;(4teerxo oodla rlnei t0t2xoio nu4optnmivtlt  2rmxmp;t1aet  i3iadla2ulnvpnt)texnifciatfa rlnvs s  rurxrpnu1lm elfcias srrr( pot1olxomiciyt a em(vo;(0 reoir iydop raivo t  rumirpno4aleemnet s)srua(m oo1oee micildfs2rauvp;() ltnio3oa1opD an i t)s2xrxopiu1oleelfcsltf 2uru  ;o0opeoifciytlmDrmuvp;u) lxrmfcoy1om raueo s0srum(o nudolenlicias  2rrur ot4tet iictyd mDelnvs;u0 rxnircia1om eluvi t)trumxm3nu1lm  mncsa(f 2uaxmono1ale mfctysla eluvp (4trxomo iydomDrln i ()s2toiopio1om nlfctasfaDtrx pno1tpenifciatlsDrm( s u) lxrirctodfm elivs;(0t2xmio iodal  livs ( s2urx  oo4apxoii3tyt a umu s;u4aeeniocoydfpD lnei;(0trumxr3no1ale lnciatfa2umxr ;t0tlx  fctls aDum(vs t0aleomr3ootfateau ols seur(rpoydalee net s)arrm(ro;t0opx iictlslsDelnms;u)trtrxo to1op  aueo ( srto(opoo4olenmfesltfsrrr(r nu0oeto i3iadfa2ean on(0 eeomf3to1fa  aneo;t)s2tr(opnudalt  fvils  rur(m ;u1tptnmi3tldfa2ulu on(0 ltnxo iotoatrlies (0 exmio3oodlmte ivias) Drau  nu0aexoifciasls um( s u)aleoxocto1fpD ln s;s)setrirpnu4am elfeias)sDrau p;t1alxn oetysfa elu p t)treomr3oa1op eauvi t teumimpoy1lm elfcsl( sDrm(ro;o0ale moctadfs2ra( p (0texniocoatfmt lieo s) ruoiopio1amenlfci sf Dtau  ou1oee  i3ilsfm2rln p (4tleoxr3oatfa r nvi s)texmxrpio1ome lncslt) 2ta(  nt4alt iietyt s ulnvsn(4 lerxr3iy1lptranvs;t) rurim io4omtelieiltfsrrr(m ;t1opxo ictatfs rlu s u)arxnmf3oydlptelnes t seuo(mpno4lptelneiatfarua(rono1aex mi3tydls2um(mo u0 rxnmo tytomDean ol(0s2xr(m ny1optnliet ()aruaumpou4tleo f3iasfaDrmnvo;t)artrio iydlptrlneo;s0setrio oy4omeemnvt s  2rm( pno0oleomi3iltlm rlu s (4 lermo totoat livil( sexmim io4altn fcta(fsrumurpoo0oetnifetadlm2uaumon(0 exomo ty1fmte ues () ruoxo iu4am e icias arraxrooo0tltniiciydfa emnmpnt0 etnmr tydomtr iei;s0s2umxmpoo1lp  mivta()arraxroou4alt  fciltfm2rau s;t4 rtniocoodfp r i olt0t2ur(m3io4alt  ncslt)aDuax oot4apt  oeiyt s2rau s;u0altomoctytfm elivilt seuoxmpnodlm elietlt)a2rau  ;u0tlenmo3iydfs el( onu) lxnxr3iytopDraieol(0trxmiopoo1am e fvtl()sDuru pno0aeenif3ild m2ean p;t0 lxomo3iadfmDrlivs () ruoxopoydomee fvta(f Draxmo;u0aeeoiiciatfm2raumonu4alerio iadlmDr ieolt)trxr(r nu1lltnmfesas)a2rrx ooo0optn f3ils m emnvp;t4 rxrxr tydfpDrau s ()truo(mpny4amt lnvsltfaDtrum ou4oetomi3ilt aDrauvo t0arxnxr3iatomteli i;t0 rtmirpno1om nmnetl(fa2ta(m oo1apeoifctatfmDuaums;u4tlxoio tytfpt ln ilt0texmir oodal nmfes () Dur(rpou0tlxnmfetatlm el(vo t0aetnxo3tatop   u sl()t2xoirpny1lm eliesltfaDur(mp;o4tpto feiltfaDrau sn()aexoio oodoat auei s s2xrxo3no1ol nmfcs tfs2tmum nu4opt  oetldlmDumnmo;t4areoxocoy1oaD luvs s0trxoim3ou1altnmicilsfsDtm(mp;o1apenifctaslsDrmuvo;t) etnxr iy1fatr ivi;()teur(m3oudllenlfesl() ruaum nu0tpenmi3tysls2umumo;(4 rerircoa1fp rlneilt tetoiopoudlm e nvtls s2ua(m ;o0oet micilsls ua(mpn() leoif oadoptran sl()setrxrpnu1lpeelnetas) 2urum ;u0tpxomoeiyt s ulu s;t4alermo3oytfmtran o;s sruoim nydopt lici s srtau  ou1tpe miciys s eanvsn(0 rxoiocoy1fpDrau i;()trurim3nodalenlfeslt  2umxmpnt1tlx iicild mDuaums (4 leoio oa1oaD  u o;()srumio iy1lmeelnes ( s2raurp;u4ope ifetas m2uau o;t0tlxomrcoydlpDrlneil(0sruoxrpiydomtelietls arumxm nt1apxomoctld aDrlu s t4texrir oy1fmte nvi (0texrimpou1lm nmnviatfs2rmxm ;u1olen f3iydls2ran ont4 lxomf iy1opD  ueo;t  rtrxm3io1oltelfctlt)sDurxrpnt4tlt moetltfa2eanvs;u4trtnxo oadopD  ivsls)truo(r oy1ll e iesa( artru  ;o1apeoii3tatlmDul( s;(4 rtrif oadfpte nvils seto(m oodlmee nciatfsDrm(r nt1aptnmociyd sDrm(vp;u)aetrxrctotfmteln ils sexo(o oy1ap e fvtatf Dra( pno1oltn feildfmDeauvpn()alxrmo3iotfateai olt0 eumio iy1am  lfes (  2uax p;t4tlx miciasla ra(mo u4aetnmf tadlmt aies ( seuoio iu1oltnlicsat a2tru onu0teeoifciyd mDelnvp;t4 rxnmf tydfaDrluvs s) rxmir3nudop nlfcsa()s2rmx o;u1aleoio3tys s2ean o;(4treoiociotla elieils0trtr(r ou1oltelnvil(fsrurxront0opt micilsfm umnvs;t0aeeoiocta1faD li s;(0srtmxrpoodamt lnet ()s2trumo;o4tptn octltlaDrl( pnt0texrmf3iytlp rliei;t)texoxo iu1omt mfvslt) Duau ooo0opt ifciydfs2eaumont)arenifcoodfm rli i;t)trtoim3iudoleemnvils)s2rmxmp;t4tpxnmiciys a2ulump u)tetnmr totlpt  ivs () eurxo nu1lmt lietas)sDtax oot4opx mf3ild mDemn s () ltnmr3iytfmtraueo;s0srumxo iu1omtemfvsat  Durxrp;t1tlen o3iatfa2uan p;(0tetnmfcta1fa   uvolt)srtrim3iudameemfetls  2ta(  ot0aexnmfctat m2raums;t0tltomoctydfateau i (  eur(rpou1openlnvtls s2umu o;o0oleomo3iatls uau pnt)trtomr3todomD lneo ( t2xo(r oo4lleemieiatfsrrr(  ;t0aeen iciydlsDrmumo;t4arxomo3oodlpt  ieo;()trxr(opnu1al nmfctls a2rm(ro;u4tee ifciltla2em(mpnt)aeenio ta1lp  lu s t seuoiopoo4lpee ivtatf rtrx pou4opeomfetysfm rm(von(4arerxfcty1lm e ueo t  eumirpoodalen nciat)aDrruro;o1tpe io3tydfa2el(vo u0teermrctadfpDrlieo ( sexoirpnu1om  mneta( s2uaxmp;o1alx  ocils aDel(vpn(0tlenif oatfat luvo;t)s2uoim3io4aptnmncs t)aruru  ;u1aeeoifciatfa ulnmpnu)trxnxr ia1la ranes;s s2xmxm oo4oltnmicta( a2rmump;u0aee  o3iltls2rmu on(4trxoxf iy1op  ln il(0seur(opoodll nmict () Draxmo;t0aexo i3ils s uanvonu0 lerxociytfa ranvo;(0setoiopno1al   fvs () rra(rpnt1oltomf3tysfmDumumo (4trenxo to1fpte i i s  2urim iudam nmfei (  rrm(r ;t4ale ifctas a2el( s ()trerif oytfmtr uei s seur(mpiu1lmtnmfvtl()arumx o;u0altnmicild s ran s u)treomf3iodfateau slt0 2xr(mpoy1lm nmicsas arurur ;t0texomociat m2umn p;(0teenir3io1opteaiesls0srxrio nu4op   nvsl( srtmxrpno0altnmfctytlm2rm( o;u4 exoir iy1fptr ivo t t2xo(m3iudlp  lfcils)s2ra(  ;o0oet ii3ils m2el(mp (4 etomrcto1omt aivi ()texr(o oodlpe  nes ( sDraxmpot4texnmociltfm2ra(vsnt)trxoio3totop rlnvi t)trtoir ou1lm elnvia( srtmx  nu4teen ictatfa em( pnt4arxrmocty1laD liei s sexm(o3no1lp emies (fa2ur(m nu4optomfcildfm2rauvpnt0tetoioctydomDe n ilt  2uoir3oy1lmee nvsa(  rurxrpnt0opeoiietas s um(vo u4arenxrctotfa elnvo ()sexoxopoo1amt lneiatfsDtmump;t0oetnmfctysls2ra( sn()tlerir3iy1lateln ol()seurio3ou1lmt micsat  Duaum ;u1tpxo o3iltlaDrln p t0tlenxo tydfm   ivols0s2xoim iy4optnmfctlt)aDrr(  ot1tpe ifeils m emn pnt4 ltrmfcia1fmDe n i s  2xo(o ny1ll  lfeia()aDrmuro;u1tptomi3iysla ul( s t) exomr oadomt  n ils0trxoimpno4lp n iviat)a2taxm ;o1opxniictltfa2rm(mo;()tetrmo3oa1oaDeluvo t)trtrxopoodopt lfciltf Dtmx p;t0aet iiciadfaDumnmpnu4 exnmo ootomtrlu s;s texm(r ny4amt licilt srtrx ooo0teen fetlslm2ean pn(0tetnmr3ootlm raueslt0tetrxr iu1op nmics s aDuaxr nt4apt  oeiytlaDranvo;u) rerifcoy1faDe iei;(0trto(o3no4ome  nesls s2trump;u0olt ifeiltfm2ea(vpnt) renif tatoate i slt)tetoir3no1lptnmfciat  ruauro;o0oexnmieild aDemnms t)trtoxf tytfm ranes;t)tetrxopoudamt mfei s)srrmurpot0optoiietld a um( o u4 rxrirciatop eaies s0t2tr(o3no1amt lnvils sDurxro;u4alx ioctydls2uau s t4texoio3iotopt ln o () exoxo iodomeelnes (  Durumont1tpt ioetysfs rmnvp (0trenxr tatfpteanesl()t2umxmpoy4llte nvs sfsDtmum oo0alen oetatls2umump (4 exnxo3oytfmD  u i;(0 eumxmpoy1lm emnvia( s2rm(mpnu0oee  iciatfs umn s;u0trxoir tytop  ln o (  2tm(m3oy4ome  ivtl()arrr(mpoo4alxomieiys mDrlnvonu) eeoio3oy1lmDelneo s0teuoxopno4lmt  feslt)aDtrxmpnu4oex mi3tad m2emuvp u0aeenmf iatfmDelueol()teum(o io4oltn ncsl()sDumum oo4opto ociaslm umuvp u4trenmr3ia1opD luvol( s2umio iydlme lnvils)a2ta( pnt0alx miciatls eau p;u)trerio to1faD anvi t srtrio oydlp  mnctl() Dumxm ot0aexomiciat m2rauvp t) rerio3oadoat  i s;s)trxrio nudom n ivtas  2rmu p;o4ope mociltla2um(ms;() lxomr ootfaDeaueil( trurxrpou1omtnlnvsa( arumxm ;o4tle mieiyd s2eluvo (4aleoiocoatlptr uvo;t0sexoxo3no4alt lfvil()s2urxmoou4optoiocilt a umuvsnt4 etnxr3io1om e n il( trtoir nudameemfesl( a2tmu ooo1oex io3iltlmDumn pnu0 exrxr ty1lpD  uei s srto(r3oo1lpee nvt s) 2urump;u4texomfciatlm uauvonu4 rtrxfciy1lpDrln ils)seuoxopno4olte fvs tfsrrm(  ot0alenmietltlm ran onu0arerifcoo1laDean i;(0texmxopiu4lltelivsls)artauront4opt  fetldfa2ranmpnt) reomrcootomt anvi;s0s2uoxr3iydole mnctls s2rm(m no4oltnmoctat s2rmu s;u) rtomocoatlpt  ivo (0s2um(o iodlmte neslt)s2ururo;o4teenio3tys mDrlnvpnt0tetnxrctydopDr i i;s) 2xrxrpoudll e iesas  2ra(r ot0alxoioctlt sDulu s u)arxnir iy1lm  li o
\ No newline at end of file
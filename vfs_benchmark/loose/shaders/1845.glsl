@@ -0,0 +1 @@
+ueils s2triopoy1am nlivs t) rtru  ;t4aeto f3tls mDemump;t4tlxrmociy1omD  ivo;s0 rurirpoodame mfet ( s2rrxmp;u1tet iietytfsDum( snt)altrir3oadlm  lnes;s s2tr(o3iydap   fetl( arraxm ;u1apx iociasfaDra( p;(0texomr3iydlptr u o s0 2xoir ny4ol  lnvs sf Drax oot4aleomiciydlmDra(vsnu0teenirctotlaDrlnvi t) rum(o3oydopee icil(faDuaxmp;o0apen fctldlaDemu on()tetrmr oa1optelies s trur(o iudllen iesls  Draxmpnt0tpt  ietyt aDuau s;(0 exrio ia1latraueil(  rtrir3oo1lmt  fvi () Dra( onu0tltomociys sDrluvo;(4trxrxr iytlmD ln s;s trtoiopiodolee nvslt srtrumo;u4ole  oeiytfs umn s;t) rxrif tadfaDe uei;s  rxrxm nodlpe mncsl(  Dtaxr ;u1tpxomoctysfm eau o;u4tlxoxo oodfatrlnes;s  2xmim3ou1omte fvta( arrmxm ou1aeen ociasls uaumsn()tlenmo iatlaDe u sls0seumim iydomeemfvtl(farrrumpnt1tpt  o3iatls umu s u4altrir3tydfpDeanvi;(0truoiopny4lle mnvs t)aDrmu  ou0tex mietadfs2umumsn(0 rxrio oydfpDe u sls0t2um(r3ny4ll nlnetl(f Drau poo1ope  o3iyd m2rm(monu4trtoxrcoydopDeau o;s)s2trxo3oodolt lfvsa(fa2trx  oo0opxnifeiasfa emuvs t)artnircto1fp rai o s) exm(m iydal  mnei (  rta(rpoo4opxnif3iat sDemuvonu0tetrxfcta1latr nvolt)seumxr3ou1olt mieils) 2ur(  nt1apenio3tasls2um( o (0arxrmociotlpt  ueo;s0srtoir iu1am n nctas) rrr(mont4altomo3ias mDem( o;(0 rxomf3iodlatr n o;(  exmim3io1ome mncils) 2urx o;o0olxoio3tad m emu o;u0 rerio tytoatr n ils0 2xr(m3iy1lme lnvi ()arua(monu1ole  feiltlsDuanvp;t4tlenxo to1laDelivs t0srtoxr no4lltnmietl(  Dtr( o;o1alto i3tltls2rln sn(0altrio tydoatrlnvol()s2xr(o3oy1omenmict tfa2tax ooo4opto fctls aDua(vp t4artrmr oadopDe n i ()srxo(mpoy1ol nmiesls)sDua( p;o0opx mietyd s rlu p;t4alermo3oytfp   n ilt0srtoxo3oodap   neias  ruax  nu0open o3iatls rlump () exrxrctydlp   ies s0t2toxr iudlmen ivia( artmurpnt0apx mfeias a2rm(mo (4 lxnxf3ty1latraies s0sexrxo3oodlmtnlfvtl(  2umurpoo4tlxo fetat s2rm(vs t0aexomf3oa1fa  aivol( trum(rpio1oltemnvt s arrm(r ot4open octasfm uanvo;t)aetnio3oa1fptelneilt0 2toir no1ole miet s)arrmu pot0tlx  o3iadla elnvs t0aetrxr to1lp elu i;t0 rxrxm nu1al  mfcilt s2uax o;o4tlen ictas s um(vsnt) rxnmfctytlmtelivs s0s2umxr ny1lp nlivt sf Duru pnt4apxnmieils sDuanmp u) rtrif iytfpteau ol(  2trio iy4alt mivtls srrrumpoo0aee  oeiys mDuan pn(4tlenircoa1lm rliesls0 2xoiopny1om nlfcia()aruaxr ;o0teeo feiadfm2ra( pnt0artoirctotomDr i o;t  2xo(r ou4altn nvia(fs2rm(mo;u1alto f3ildfs2elump t) etomrcoy1fp eai s;() ruoir iodamte iviat  2tax ooo0ape mf3iytlm2elnmp;u0 lenmr oy1lptrau o;s0tetrxr oo4apeelicta() Drax poo4oltn i3iyslm2umuvpnu4 lenir tytlp eaues ()sruoxrpio4lltnmnvi tfsrrr(m no0apx  octlsfm emnmo t4aeenxo oydfpte u ilt0 2xmio3iu4ape mivt (fs2um(  oo1tlenii3tadlm2em(mp;u4aeeoxfcoa1lmt aiei t s2trxmpiy1om elies ()a2ururo;o4opxoii3tlt s uaumo u4 ltrif oy1fm e iei t srur(rpoodlm nmieia(fs2rrxmo;o0aptn i3iyt a rlu on(4 exomf3oodlpteau olt0s2tmio3iydlmeelncils)aDta(  ou1aex ifctysfm elump t4tetoircia1oatrai i s0t2to(opoodamtnmfcsl()aDtmurpnt1opxo o3ildfsDumnvo;u4 leomf3to1fm r nesl()seuoxo3iodope lfesat artru  ot0tltnifeiad a uanmonu0teeoxo tadoa eau ols s2to(r3iodopt  ietasfaruaurpoo1alxoiociys a2em( p;u0artoio todfa ran s;(0 ruoxo3ny1omtemneiat) 2tmxrp;t0tlxo i3taslm rl( o t0altrxfcoy1laD anei s s2uo(mpnydlp emivsl()srtau pno4alenio3iatfa2ua(mpnu)tltoxo iydfpDrauei;(0 rxoxrpou1ap nmnei ( srtru  ou0alto i3iatls2umuvs;t)trerir iy1la e nvi;()sexr(o3ny4al  lfet t)srurxrooo4opt mieilt a eaumpnt4texnio3tydlaD aivo s sexriopnu4apee neilt  rtruroou4altnmietysls2rmnvpn(0artnxoctydopt aieolt seurim3ny4ope mfvtlt) ruaxro;o0aee  ieild a ranvs;u4trenmr3oatfmDelieo s)trurio iy4olteliesls arrmu o;t1olx mi3iyt s ea(ms u4 exnmrciydlaDe u sl()teurimpio1lpenmivs t) rtmumpno4oltomf3ilt m umnms (4 lermf iy1omtrau o;s0 eum(m3ou1amtemivias)srtrump;o0aetomiciatfs2ran p;u4aexnmo3oa1fmDrai o;s)sexrir3ny1alt  iesl() 2uru pnt0tleo oetad mDumumsnt0aeerir iy1fmD au slt setm(o nu4ale lnctlt)aDumuront0oltn f3tyt s uln p u0tltnif3iatoaDeluvilt t2xrirpnu4omenmicils)a2tr(  ;o1oetn feiydla emuvs () rxrxo tytopt lneols srtm(mpou4lltn ieslt) ruauro;o1olx  f3ils s2ul(mp (0treoxoctotlpDrlueslt)texmxo ou1lp  lnct t)aDuaxm nt4teto ociatlaDea(vonu4trxnif oodlpt aueo;s0 2xmimpnodal n ies t)sDra(  nu4tpenio3iadlmDul( o;t)altnmr io1fatr nvo (0sexmxopoydlle liei sfsrraum ou1ale  feias s2eanvp;(0trenmf3tadopt  u s;( srtoir3oy4aptelfviltfarurx pnt0aeeomi3ilsfa2em( o;t0 rxnir io1fpteau ils)sexo(r3iu1amtn nvsl(  2rmxront0oleomfciaslm ea(vp t4 lxrif oodfpteln o s s2trio3oudlptn netlt)aruaxro;o1openmfciat aDem( p;t0trenmrcoodla  au o;s teto(m io1olenlivsl( sDrmxr ;u4aex mocias m2ul(vo (0altrmfcoytomtrlu s ()t2xmio nydamtn fvias) Dtrxrpnu4oltomociasfs2em( o (0arermfcoydfpt  i sls)srxoxmpiodom n ivsls aDurxmpnt4tlxnif3iatlm2um(mp u)aetrmo3to1fa  lieo t0 rtmim3iydoltn ietatfsDrau o;o4oeenmieilsfsDua( o t)trxoxf ia1lpteauei;s trxrir nu1lpee fvsa(fs2ta(mooo4aetnmieiydlm em(vo;(4 rxnmr3oa1fat livs t)seum(m3no4altn fvi (faDuaur ot1aleomocildla rmuvp;t4 ltnifciadlp ran il( sexoxopio1openmfcsls)sDrm(m ;u4alxoif3ild s rauvo;(0altoxrciydlpDr ueo;t0 rum(m3iodop nmfvias aDraumonu1aptniiciasfs2uanvp t) leniocio1oat an slt  2uriopnu1ope licils)sDtmx  no0alx ii3tlt m2emn p (0alxrxr3ty1fatraieol(0t2xoxr3ou1am n feilt  Dtm(mpno1optoiociysfa2ra(vont)altrir3ty1laD  uei;t  eur(o oudlp e ietat)srum(m nt4aex iicias a2uauvp t0 lxrmo tadfpt lnvilt0seuoxrpiy1om nmnesat)a2raump;u4alxomoetysfa rmn p (4 rxoio oytfp raneo;(  2xmiopio1ll e fct s) Dumxrpou0oex iieiatfs umnvp;(0areoio3iy1oaDeanes t) rxrxm ou1llt  iet tf 2ur( poo4aexn feiad a2ea(mp u4aetnio todfa rlu i;(0t2xrio oo1ol e iviltfs2umx o;u0tltnmoeiat a rmnvo (4 eermf3oa1oatrlu i t)s2xoxrpno1amte ictltfa2ur(ro;t0oetnmfeiyslmDra(vp t)tltoxf to1lmD livi t t2trim3iy4lleemfviltfsDtmu  oo1openiietldfs elnmp;(0artnmf3oydfaDr uei s0t2xrxopiy4apte ietl(faDur( poo1aeeoiociat mDea(vonu4tetrmr3oa1fmt an o;t) eur(o3oodole mfet s  2rrx  ;t4aex ifetad a2uauvo t4 rtnxo oadfpDr nvs (0srtrimpnodllen nci t)aDumu poo1opx  o3iad s2ua(mo t0 lxoxr3iodfpte nvil(0trtoir oo1lpe mnci sfarrrx  nu0aetomo3iytls ean p t4aetrxr3oadfm elues s t2urio oudlm nlfvslt)artau  ;u4tlxnmi3iatfa2eauvon()tetrxr iy1fmteliei (0 exm(r3io1lpee nviat)srrm(r no4oleo fctas m eluvp u) etomoctodfptr ies;s seur(o3ny4alt lnvs ()srtr(mp;o0oleomo3tls m um(mo () lxoxf3tydfmte uvilt) exr(o3iy1am elfetlt  Dtax pnu1alt ioeiyslm emnmo t)aexomo oa1op r nvs (0 rxrxrpiy4omt mici (f Dtm( onu1tpt  fciytla elnvp t)aexrifciytop e ueo;(0 eto(opio1am  miei (fsDtrxr ;o4ope ifcildfs2el( o t0altrmfctadlpteanei;t)trumiopoo4ape  ivs t  rtm(mpno4oexomfeiytlaDrm( o;()treomf3tydlat li s s  2xr(r oydlp emfetatfsrumu  nu0opxnmf3tadlm ua(mp;(0 rtoxociatlptrlu ils0teurirpiudomee fet t)sDuru o;t4aexoii3iat m2uluvonu0tlenif3iatfp   neil(  eum(r nu1ll n ici (fsrrau  ot4tpenmo3tlt a2emu snu4tlxoxf3ootfa eau sl()texoxr io1optnlieta( aDrmump;u4ape  fciyd s2umu o t) rerxfcta1laDrauvs;(0 rurxrpoy1opeelics sfsrta(mono1olt  octadls2rmumonu4tltoio iytlmDeln s t)seumxopno1lpenlnesat artr(mont1oet ii3tat m2ulu s;t0 rerir3io1om rlu sl() etr(r ny1omte icia(fartmumpot0olt  oeild mDrl(mo t) eeoxf3ty1fpte n o (0s2xmimpiu1ap nlnviltfa2tr(r ;u0olx iociyslaDelnvp;u4aexnxoctadoa   iei t) 2uoxrpnudll elivs sfarta(moou0tlenmfetad a um( s;t)tleoxf iatfateluvols tetmxo no1al  mfvtat s2umu o;t4tpenif3ilt a2elu on(4 exoir iytfpDrln ilt texoxo3iu4am e iet (fa2ra(m oo1opt if3tatls2ran snu0altnirctadfaDeanesls0s2um(m io1lm  micil(  Drr(mpou4oltoii3iltfs emnmonu) reoxf3oa1fm rlivo t0s2xmiopiodll nmnetlt s2rmxr ;o0aet mf3tad mDua( pn(4tltrifcoy1oatr nes;(0t2tmxopiy4alenlnct t) rtrxroou0tlt ifetysfs2rlums () exrmr3ootlmDrliei s0srur(rpnu4lp emfvsatfsDtru  ;o1alxo fetat a elu s;(4tetomf oadoaDeli slt s2xr(r3oo4amen icils arumx oou1optomo3ils aDeau on()arxrmo ta1omte nvi s)trxr(r3nu4omtn ics sf 2umx  ;o1olx mictlt sDumn o;u0aetoxf3oytopDe uei;( trurio oy1optelieta(f Dua(mont0tptoiiciad a ulnmpn(4aexomrcoodfp rai o;s) 2toxrpoo4ll  miet tfartmurp;u4aexnmi3tltfmDemnvo;()aetnxo oo1fa eanei t0t2toxmpny4ome liesl(f rraxrpno4tetn ietlt mDeanvon(0aexoio iotfatran s;s srurxo oodom n nvtat  rrrx p;u0aeto octyslmDelumonu0artrxr iatlm raiesl()srur(m3iydlm nlfeilt) 2ta(m ;u0oltoifeiasla ran o;t0aexrmf ootfm  lnesl(0 rurxm3iydamte ivtas) Drm(rp;t1tlenmfetlslsDuluvo ()tltoxocto1la eauvilt0srxr(r3ou1lmenlivtat)s2ra( p;o4oet iietyslaDemuvpnt4aetrxfcoa1fpte neils)srto(o ou1amtn feta( aDra(rp;t1aetnmo3ilt m2rau s t4trxoxo3iatop rauesl(0tetmxr nu1lmt mnesl(fsDrr(mo;o4tetomietldfaDeauvo (4aetoxrcoodop  au o;s)s2urim oudom nlicsat  rua( pot4ole  feildfmDeln o;t0 etoif3iydlat aueo t0srum(o nodlpt  fcs s)srra(mooo4oee io3iltfaDum( s;t)aeerxo oytfptr ues t)sexm(mpiu1ale licsls  Durxmpno4olx io3tys s2rlumsnu)tleoio3ty1lpD auvi;() 2toirpiodlptelnvi (f rtmum ou1alx  f3iadfs2uanmsn(4artoxf ootlpDrai s ()seto(m nudopeelncs ()a2rm(mo;t0olt io3ilsfaDemuvpnt)teenxociodlateauvslt0 rxoio ny1lmt mncta(f rtrumpnu1opt mictat m elnmsnu0 rtoxfcoadfpDranvilt0 2xmim3iy1alt lncsl()aDurx poo0alen oeiatfsDel( s;t4 ltoxr tatopDr nes s) exm(m3io1llee fvtas  Dtm(mooo4oee moctyt a ra( snu4tetoxr3oytfpt  ueo t0s2toir iu4optnlnvi t aDtaxr oo1oleoio3iaslm2elnmpnu4tetomr3ootfm r nes;(  2to(opio4ameemnvtl( srumx pnt4olxo ieiyslm2ranmont4altoio3tytop r u sls) 2xm(opoo1lmte fcils s2tm(m oo4aeeoiiciat m2rm( s;t4arenmrctodfaDelies;t0 2trimpoy1lpt mncsat artmx p;o0tpt micilslmDumu sn(4 rtoir3iydopDrliei s0 rtrio3nudllt mivsl(fa2rrxronu0opxo fcildls rlnmo;t4aeeoxf iytlmDraivol(  2tm(rpiudoptnlieiltf Drmx p;t0texomf3ias a2ua(ms ()aexnio3tytlpt aneols)truo(o iudalenmnvia(  2urxrpot4oee  i3iadfm2emuvon(4tlxrxr3tatoaD au i s  exrxo iy1opt lieils  rrrxm ot1oleo o3iatfm ranvp ()arenmr totomtrauvo t0s2tm(opnu1lmtn fvsl(f rta( oot4aexnif3tasla2rlnmo;u0 renxo3oodlpD ln ols0tetm(o io1lmeemiviat)artm(ro;o1alxo f3ildlmDem(mp t4 ltnmo3iytopDelu i s0 2xrxm3iu1lle liet t  2tr(r nt0ale if3iad m2eau sn()teenmf iatlpDr u ils)srxo(m3iy4lpenmnvtl(f Dtmxr oo4alenioeiyt sDum(mo u0 etrio3oo1op eluesl(0t2urio3iudam eliesl(f rumxro;u0oltomocildfaDrlnmsnu0alxrxo3tydoaDeai ilt truoxrpiodamen fvtltf Dumu p;o1olt  oeiatfm2rl( pnu4aexomf tatfmDrau s;s)teto(rpiu1aptemfcs s)aDta(rono4oeto o3iltlsDrmnvo;t4aeerxrciadopDr ues s0trtoim3ou1optnmfvi ()a2tax p;u0tlenmieiltfmDel(mo;()areoio iy1fmtrlnvo s)texr(rpiy4lm elivt s) ruru  ou1teeoifciasls2rm( o (4altrxf iy1oa  ai s;t) euoxo oodamtnlfvslsfarrm(r ;t0aetomi3iytfa el(vp;(0 etoircoydlmDeanvils  ruoir3oo1oltn fesat)arrrxm ;t0apeomf3iysfs ul( o;t) rtrxocoatomD lieo ( trumxmpoudaltnlnciltfa2rrx ont1opx  f3tadls em(msn(4 lenmf3totoaDe nvo;s  etmxm3nu4ome lfesls)a2rrx  nt1olenif3iydfs rm( snt4 rxnif iadom rlivo t trxr(o3nydlmee feta( sDurxr oo4tltn iciat sDul(vpnt4tltomoctotlpDelues t)seto(o no1ap elfvs s s2urxmp;u1aetoifciad s2emuvo (0aleoxf3iatoateluvsl(0 2xo(m oo4lmen fct t)aDuau o;o0opeoifetasfa2elu p;u)tetrxo3oy1lptrli i;t tetm(r3ny4alee ivias artaurp;u0texnmfeiyslm2rm( p;u0areomo3iodlmDr ieo;(0 euoxr oo1omeemivilt)srumxr nt0alxo i3iyd mDean p t0trtnif3oa1opDelivsls)trurxmpoo1ome  icsat)aDrau ono1aex ifctls m2rmumo t4trxrxfciytop raivi (  2tmxr iy4apenlfetl() 2um(m nu0tetomociydlsDuanvp (0aeermr3tydlpDe nvils t2xoxm3nodlmtelnctltfaDtr(m nt1opx  o3iltlmDrmn s u4trtnio oydfmDr nvi t texmio3oydaptnlfeias  Drrxm ;o4tpx micildfs2rln s (4altrifcio1omDe i o;t)trurir nu1ome mnvi (f 2umxm nu0opx ii3ildfsDel(mo;t4teenir oa1lp r i sl()seuo(opiydoptelfeta( a2uax ont1aexoifciad sDemu s u0trtrir3oa1fmD  n s s)t2tmim3iodap elnvta(f Dtrum ou4tptnioetyt sDulump;(4 exomo3iytfm r n i;s s2tr(o oo4ll nlfet sfsrrru pnt4tlx miciytfs umn p;(0 exnmr oadom rluvi s  rtoir nu4lpen iesa() 2ta(mont0tex ifctlslsDul(mo ()tltnxociatlmtean olt0srxrxopnydlm nmiei t  2taumooo1texomo3iyt mDra(vonu4trxnxrcty1lp eli sls0s2to(m3nodol n nvslt)arrm(rpnu0aleo i3iyd mDelu s;t) lenmo iytomt  nvils  rurimpiudoptnmnetat s2uaum no0olto oeildfsDrlu s;t)trtomr oatom   i o;( t2um(r nodol emfesls) rrrurpot0teenmi3iatls2uaump;(4 etnirciodlmt  uesl( trumxopny4omtelncsa(f Drr(mp;o4aex  ociytfs2umnvo u)arenirctadomDelneilt t2umiopnudlpt mieilsfa2raumo;t4apenmfcias aDel(vo;()trtrifctydomDran s s)trxm(opou4oltnmfvtlsfarrm(mono0olxomf3iasfaDean onu4alenir3ta1laD  i ols  eur(o3io1ale lfeia(f 2uax  nt4tpx ioeiatfaDuau snt)aetnxr3iatlm r u ilt  exmio iy4omee fcta()srtm(roou1texn oetysfm ra(vsnu)tlerxr oytfm elu o;( sruoxo3iy1om  mnctl(fsDrru onu0oex  iciys aDemu o t4 lxnir3oadlpte n sls)srtoir3iodlpt lies (fs2ururoou0apen ictatfs2umnvs;(4trtrio3iydfa r n ols0t2uo(m3io4lm e fvt t  rumxmp;u1aleoif3tysfa2umnvo u0arenioctytfp rlu i;s sexrxrpoy4lle lncsl() 2umxm ;u4tle  o3tasfm2raums;u0trxnxo3tydopDr n s t0 euo(m ou4lm nlict (fs2raurpoo4tptnifciysfa el(vpnu) reoif3iy1lmDeaivolt s2trxr ou1lmtn fctls)arumxronu0aetoifetls s2rlnvpn(4trenio iydlpD aueo;s  ruoir iu1lptnlnet s) Dur(mp;t0opx  f3tlslmDuanvs;t0 rxnif3oodlp  anvs s) eto(m iydll e nvilt) rumurpou1alt mi3iydlmDeluvon() rxrif tatfa eauvsl() eurxmpnydop nlieilt  rurumo;o1optnmfeilt sDelumpnt)alxomrctytlmt auvs ()s2xo(o nudlm emfctl( aDrrxmp;u4aee ioctadlmDemumo;t)tetomrciotfm eluvi (0s2umxo nu4apt licilt aDrr(mooo4oeen octltls eluvp t0 rxoxocoatoaDeau i ()setoimpny1lptnlies (f rur(mono1alxomo3tls aDrmuvs u0tltomr tydfmte nvi;t0 2xoxm3iy1ome mictlt) rtr(mp;u4tpenmfctasla2emu snu4 rxrmf3oytoa   ueo s  rtmimpoy1ope liesls) Dumum ;o0tltnmiciydla2elnvsnu)artomr totfpt  ieo ()seuriopou1al n nvias a2rrur ;u0opt moeiadfa ulnmpn()artnmo oydopDeliei;t trurxmpno4omtelnei t sDrr( ont0oltoif3tltfmDeauvs;u)trtrif iatfaDrai i;s) 2xoirpoo4am   icsat a2taxmp;u1oltn ieiasls uauvs (0texnxr ty1omDe ues s0seurirpio1opte iet (fa2uaurooo0tlxomfciadfmDemu p;(4alxrmr oadlpt auvsl() rto(r3nodop  lneiasfarrm( onu1tltnmocils m2umuvon(0teenxfcoy1lmD luvs;s0s2xr(mpoo4op  liesa( s2ururo;o0altomf3iad sDumuvs t4 exoxociotomD aivo;s0teuo(o3nudolte nvtl()sDrmum nu1tptn ociyslsDua( s (0 lxomrcoy1faD aueo s0 eum(o iu4altemivtlsfs2trur ;t1texnii3tys a2rau p;t)trxoir3iytom r u ilt0t2uoxm oo4lp elneil(f 2tmxrp;t4tle moetyslmDrl(vs u0tlermr3oy1omte ieo;() exm(r nydome lfvs ()sDur( o;u0tlxo ietydfs2emu o (4 rtoxf oodlmtrlues ()setmir ou4alte net (  rtr(  no1teeoioeiltlm uluvp;u0 rxrircto1lpDr n o;s)sruo(o nu4llenlfesat aDrmxmono1olen feias s ran ont) ltomo3iytfmteluvs;(0t2trxm nu1oleemfviltfsrua(rpnt1aptn fetytlm2emnvp;u4 renmrcoa1op ran o ()srxmir oo4olteliei t aDum(rp;t1apt  iciltlsDem( s t0tetrmrcoy1opDean sls0s2uoim3oydlpen nesasfs2raurpnt0tetomietat a ranmon()aexomo ty1fatr neil()trtoio oo1op n nvtls srrmur oo1apx mfciys s2umn snu) reoxocia1fmt ln ils0texr(m3iudol  mnvs s srrr( onu0tpxomf3iytfs2em(mp;(4tetoio iotlp elnvol( setoirpiy4ap n fesa( a2tmuronu4olxomietaslm ulnmp;u0 lxnio ta1oa r n o;t  rto(mpiydlmen fvil()aDraumoou4alenmfeiat m2rlnvp u4tlxomfcootlmt  nvs s  exrir3oy1ope mici t srur( p;o1tptoif3iyslm eauvo;() eerio iadlp ran ols0 exr(o io1aptnmietl( sDurxm oo1apeoifeiyt mDrl(msn(4aexnmociydlpt  ivi;s0 2xm(r ou4ap elivsls)sDrrur oo1aeeniiciydlm rmn snt0trxnxf3tatlmtr ivs;()t2uoxr3iu1om n nvsa()sDtmuro;o0aetn o3tadls rlu o (0 etrxf3oodlp r uvsls0sexrxr3no1lptemictlt sDumu o;t1aeeomoctyt s elumsn(4teermfciydlmDrau sls0setoio3no1lpen fciatfs2ta(m oo4oet ii3iatlm umu pn(0aetnmo3todopDrau ils teto(o oo1lpe  ictas sDrrxr ou4tle  f3ias aDuaumpnu4 rtnmrcoadlateaiei;t) rumim3io4llte iviatfaruaxrp;t0tetomoctatlm rmu s;u0arenir3oydla eanvs;t0 2umim oy1op e neia() Dumx  nu0tlt  o3iytfaDrm(mo t)tltnxr3todlaDr u s;t0 euoio iy4oltn nvt ( srtauront1apxomoeiyd sDrauvpnu4treoxo3oydfp e nvi s0s2xoxr iodlpe  iesasfaDumx ont0tex mieiad s ulums u)trtniociotlp rai o;s0srxo(r3io4lptnmieil() rrmurono4aex  octydlmDrmuvont4 rtrxo iodfatrlneolt0s2xoirpiu1alenmnei tf Dumu  ;o1oexn i3tyslmDemn onu) eeoxociatfaD lnes t)texm(rpoodllen iciatfa2trxr ou0tlenmocildlsDemnvs;t4texoiocoo1fm e ivi s trtm(r3oo4olenlnetl(f rrm(root1aexomi3iadls umumo u)alerxrcoo1lmD  i i ()srum(o ou1lle micil( arrrxm oo4tpxomi3ild mDrl(monu0treoifcoy1lpDrlivols0 eto(mpiu1optemfet t)s2rm( p;o1oeeo f3iydfa2rl( o;t)trxrmr3iatlateaivi s)trtmir3iydal  lnctatfsDtrx p;o0texn ociyslm rln o;t4tltrio3oy1fpt lnvi;s  2uo(opiu4ome mietasfsrtrxro;u4tpt ioetys a elnmont4altniocoydfm rauesl(0trxo(opou4ol   fvtl( aDrmxmooo4oet iietaslm2eanmo (0teenif iotfaD  n ols) 2toir oodlmen ies t sDrr(  oo4tleo ictyt a emump;t4artnxrciadfmDran i;()srtmio iydlm nmiesa( srtrxrpot1open octyd m umums;t0artoioctadoaDr ies t)s2xmxrpou1lm nliei sfartmx  ;u1olxnmf3iasla2emnvo;() rtrxf3tydlpte uei ()t2umio3oodamt  feiatfsrtm(  ;o4oetnif3iat mDum(mp ()trxrif3oydfpDeln sls0trxo(opoo1llen ictlt aDuax pot1olenmiciyslmDuanmon() leniociodlm  ln i;( s2umxopou4apee iciltf 2rrx onu0tltnio3tytfm2rlums u)tltrirciy1lmt ln sls t2tmio nu1ale mfvt tfaDumxrp;o4alxoiociydlaDul(ms t0aetoxr3tytfpte ies s)truoxopoo1lm nmfvtl() Dtaxmo;u1tpt ifctlsfmDea(vpnu4teenmo oytop  an s;s0teuo(rpny1amenmfvslt)sDtr(mpou1alxnmo3iytfs2rln p u0texomfctadfpt li s;s)trxrir3iydom  liet ( aDrm(rp;t1aexnmfeiysfs2eau sn() lxoir3oodoa raueolt0t2ur(m3iu1omtnmictl(  Drr( ont4altomfeiys m2emn o;u0teermr ia1fmtrlieo;s)s2xmimpio1ol  mnes t  rraxmp;u0tlenif3tlsfa2rm(vsnt4 etnmf tydlpDrlieslt setoxr ny1amenlfcta( sruax ont4apxnmoeiyd mDuau p t4alxnxfciydomtr i s;t t2trxo iodaptn ncil(f rrmumont1opx iiciytlaDuluvp;t0tlerxr3oadlp elueol( srtoxm3oy1op emics t)srtmxm ;o4tle  iciysfs2elu p (0 rxomr oydlmteaneils)setoirpoy1lmtemnesas) rtrur nu0tltnmfeilslmDuan p u4artrxr3oodoa e ueols)trtoir3io1lle lfetlt a2trx p;o4oexoif3tysfm emnvs;t)tlxoio iy1faD  nvi ( seurxr ny4al n ivilt)arrrxr ou1tpx miciyt s ea( on()alxnir3ta1fmDr neslt s2xmimpiodlpen ivs tfsrtm(m ;t4oltomictldls emums;t0artrio3io1oaD luei;s s2tmxrpiu4olt lnvta(  2tr(mpnu1alxomociasfs em(mp u0tlxnio tydomt lu ils)t2xrxopio4opt miei ()arrrumooo0tpeoiieiasfs2el(vo u0tetoxoctotlm rauvo s0srxm(o iodlltnlics () Dua(moot4tpxo oeiltla2umums;u0trtoif iydom rai i;( t2tmio3ny1op n fesltfsDurx  ;o0ole io3iatlm umnms;t0 reoxfctotoat  neo;( srurim nydopee nciltfsrrrxmp;t1tlt  oeiasls emu p (4 lxrxf3iy1lp ean o;s  etm(opiu1optnmiesl()sDrmumpnt4opxo f3iaslm rlnvsnt) lxoxo oytlpDeauvi;t tetm(opnudllt mfcsl()aDtaxmpnt0apenioetasfm2uln p u) lxoxo3iydlm elnei;s trxoio3ny4lmte ncilsfsDumu  ;u0tltniieiltfm2uluvs;u0aeermr3iatomtr neo;(0 etmir nu4lp elneia( arur(rpnu1altnmfcilt m2eanvp t4 etoio3totlaD livs;(0t2xmxo3oy1op e feiatfsDua(r ou0opxo f3iadls ua( p u4aeerif3oa1fp e uvs;t)trxm(mpnydole  ici sfarrmx  ou0teto f3tlsla ea(vo t) rerif tydomDe n i s)trxrir3nu1oltemivt s) 2trxm nt1aleoioeiyd aDran o () leriociydlpDe neols sruoir io1am n fesas)arur(mono4oet mf3iysls um(mp;u4aetnxr3iodom ean s;s texm(r3nu4ole  fetas)artau  ;u4tltnmo3ilsfm elnmpnu4 lenmf iytlpt ai i;s) 2uo(o iu4ope  net ()arumx oot4teen feilsfaDran ont0trtomr3oo1fp r nvo;t) 2umxm3oydol nlivtatf rtrx p;o4aptomo3tys a2rln pn() lxoifctatfmt lneils0 rxmxo iudapeemfcsas) Drm(m ot1olxoifeilslm ua(msnt)tlxoio3ia1la raueo t) eumiopoodlleemictls arta(r ou1aex  i3iytfmDumuvp;u0 lermfctadopt lnei;s0seto(rpiodlmte icsas)aruaum ;o1opx  ietysls ra( snt0aeeoif todlatrluvi;t0s2uo(m3no1lp  lneiat s2rmx oot0aleniociysls2rauvs () ltoxrctotfmteau s (0t2tr(m3ny1amenlfvs t) 2taumo;o0teenmi3iatfa rmn s;t0tetnmo to1lmDrlueo;t  rum(opny1ol nlfciat)srumxm ;t4aetn iciatfa2eau s;t0aexnmrctydfp  aies () 2urir oy4lpee icslt) 2rrxmpou0aet ifetas aDeluvp;u4 exnir io1fpDe neol() 2toim3iudlm   nei ()sDtmxrp;t1apx  oeiasfs ra( ont4 lxnmrcoytla   ueols0s2tr(m3iudap nlnesa()srtmumo;o4oet iociatfaDulumon(4trerioctytoatr nei;s0s2toxm3ny1open nesasf rurx  ;o1aex if3iytlmDrln s ()aeermocoa1fpt anvil()srtrio io4lpe mnei tfsDrmum ;t0texo ociysla ulnms t0 renmfcia1opDr n il( teurxr3io1lmtnlnvs sfarrmxrono1alxomo3iytla ra( s;(0 exoir3iadoatr u o t t2tmxrpnudapt lies sfartrxr ou1tpe  f3tatlmDrm(mo ()aexrmfctodom eln o t)trum(m3oy4llteliesat  2rax pnu1tlt mieilslaDrmump;t0alermr3iy1optr i s;t) 2um(m3io1ap nlnes tfa2trumpot4tltnmoeiasfsDrlnms;t)aleoircoatoa rlueo;(0t2xo(o3ou4opeelnetlsf rur(  no4tpe io3tlt a2rmnvo;() rtnif3iadfmDelu s;t trtrxopoo4olt mieia()a2ur(r no4aleo ocild s2um( o u0tlenmfciytfaDraueo s  rxrxr ny1op e fvtasfaDraump;t0oexoifciyt mDua(mon(0tltomrciadlmt  ueo t srtm(o3oy1altemneiatfs2trxro;t1oet moetldfs ea( s;t0 rtrxo3to1lptelnesls)t2xoimpiudoptelneil()s2tm(  no1alxn ietltlm2ran p t4tetrxf tydfa  livils)s2xmxrpoo1olt licta() rra(rpnt1optoiiciysla2em(vp t0teermo3oa1lmte uvo;(0truoir3ny1lmenlivils  Dtrx ono1aexo fetadla ran s;t0 eermr3tytlptraiei;s sexmim3nudlmeemivs s  Drruro;t0apxnmictyslsDemnvont)tleoifcoydlpt lu o;s0srtoxopiy4lm e ivs s  rrmxrpot0apeomieiaslm2emn onu)tltrxo3iydoptranesls setm(r io1lpen ieils s2rmumo;t1alx iociad s ul( p;(4 eeomf tadfa eanvi;s s2umir io4llen nei tf rurum ;o4oltomo3iyt m uau on(4tetrmf3iy1faDeauvolt0seurir3iu4lmtn fetasfsrrru  ;o0oee mieiasfmDrm(ms;u4trxrirciodfpDr ivo;t)texo(rpiudlltelfesasfarumxm no1openifctyt sDuln s u0artrmr iytopDeanvolt0 rtr(r oy1oltemneils a2rm(rpnt4oetn ociasla umuvp u4 ltnmo3to1oa eau o () rxo(rpiy1ole lfcslt)a2taxmpnu1tpeo fcilt m um( o t) reoxrcoo1optr uvol(0 rtmir oodlpe  feslt sDrm(rpou4oltomieiyd s uan o;t) exnmo tatlpteln ilt  ruo(o ny4ap nmfci t) rumxro;t1opeoio3tas mDel(vs (4arerxf3tydlpDe n ilt0teto(rpiudoptelietas)srurx  ou4tleo f3ilt m um(vo u0 eeomr3io1opt livi ()srxoxm nu1optemfct sfa2tm(  ;u4oleo feiltfaDelumo () ltoxf totlaDr n o s)teumxmpno1lmee nct ()sDrrump;u0aptn f3taslsDelu on(0 rerxoctadlm elnvi;s srum(o nodop e fcias)sruau o;u1tpxomfciasls2eanvsnu)tltrxrciodfmDeauvs s0 2trir3no4amtn fvsa(fs2tmxr ;u0teenmictys sDel(mp;(4areoiocio1lmD lneils)trxoio3oudolt  iet t)srrmxr oo0apx  ieiyt m rm(ms;(4 etrxr oatopte ueolt  rtrirpiu4optnlnei t)sDua(mpoo4alxnmo3iyt a2um( s;t0tlerifciydoptrauesls)setrxr3oodolen fvtltf rtmx  ;o0ole mietatlm2rln p;t4 etnmrciydfptraneo () eumxm oo1aptnlfvsas srrrx oou0alen fciasfmDrmn on(4trxriocootfm rlu i;()tetr(r3oy4lle mictl(fsrtrxm ot4oetoii3ias sDran p (4texoiocoytlmtr ueils)setr(o3iodolen ivtas aDuaumpot1oexnif3tysfm rauvs u) ltnxociytom rlu s;(0 rtrxo3oydap  mncia(f Dtaumpot1aexnif3iad s rmnvonu0 eermrcty1laDe uvslt)t2tm(m3oudlmeelfes s  Dumx oot1apx  f3ilt aDrln snt0arenxrciydfm e uvo t) ruoxm3oydap  lnei sfsDrau  ;u4optnifciad aDuanms;u4alxrir tadlpt  i s s trtoim nu4al  lici tfa2tmurpou0aeenifeiltla2rm(vp ()tltrxr3iodlpD  i s;s)trtoio3nudoptnmfcils) Drruronu1aleo feiydfaDeln o;t)teeomrcoo1lpDrau o;t0sexoim oo4lpeemfetl( aDumumonu1tlx mfeilslsDumump;(4tltnif oodfat  ieilt)srxrxo3nodamtnmivtl(fa2rmu pou0tex  octys mDua(ms;(4aetnmocty1faD aneilt0 eur(r3no4om   nctls) rtrur ot0tpe iiciys s2ea(msnt0aetoir ty1opD li s (0 ruoio3iy1ol nlfvtls) Drmumooo0opxn o3ils a rl(vo u4 lxoxr3iotfaDeai il(0tetrxrpoo1amt lnei s  Dtr(rp;t4tlto oeils s2ranvo;()tetnxf oo1oa rliesls trxo(o3oo1lmee nvil(  rumumooo0olxn ieiytls eaump t)tlxrifciytfpDe iei (  rumir3nodlltemnvta() rraurooo1altomoctyd s2eauvo;(4aleomo iodoaDean o;s0seum(m3ou1lltnmfet s a2taumoou1oleoio3iytfmDeauvo;t4 eeoxrciotlm rai o ()sruoxm3iy4lp e fvia( aDuru o;o1olxoifcias a2umnvo u4 rtoio ta1latrlnei;t0trxoxo3oy1amtnmiviatfaDtmumpoo4aee moetat a uau p (0teerio3todlaDelnvs;t0trxoir3nudll nlfvsat  2rrur ;o0aet ioeiydfsDuanvo;t4 rtomo3tatomDeai s;t  rxmxo nu1apenmivtlt s2urxrpot4oee  ieiltfs2umn sn(4tlxnmoctadlptelnvslt seuo(m3iu1lleelneiasfa2ta(ro;o0apt mo3iad a rmnvsn(4aexrxf3oo1lmD anes;(0trtrxo3io1altnmfci tf 2uaum ;o4olx ifcild a2el(msnu4aeerir3iytomDraivs;t0trumxm nydaltemfctasfaDrm( oot4tetn f3ias a rln o;() renxf iotoaD  n il( seuo(rpnu4opt mfeiatfsrtau pnu0tlxoio3ilsfm2um(vs t4tlxriocoo1latelueolt0trxmiopoo4lm nlfvtlsfsDrrx ono1tpeniieiyd mDrau ont) lxrmoctotoa   nvo () 2urimpou1om  lfeiatf Dur(ronu0tlt iocilsfm ulums t) exriocio1laDelneols0 exmio iodome mnvs () 2tru o;u4oex  ieiydfa rl(vont4trermfcoodom rliei ( srxoxrpio1om emfeias  Drmumpnu0opxn icias s uln o u) reoxr3iy1omD  ivo;s)s2xmim3io1omt mivt tf rtm(mpnt1oeeo i3iasla2rmu s t) lenxf iadlaDran s t s2umim no4lltnlfvia(fsDtmurono0texo f3tatlm2eaump ()aeeoio3iy1fmt lueslt0sexmio3iydopenmfesa() Dur(ro;o1apxoiiciat sDean p;t0artnmf iotopDe nvo ()seurim iy4lltn nvsltf ruaurp;u4tpeo ociltfm uaums;t4 etnir3todfptrai i ()s2ur(r3iy1am e icsas  Dumu pno0aee mi3iys s rl( pnu4tltnmf iatfmDr nvslt0 rxrxr3iodolt mfeils)artmumpno0ope io3iadlaDra( s;t0arxniocia1fmD  nvo;t0 eumxmpoydol nmivt ()srrm(mp;u1tex  iciyd s ulnvon(0 etrmfcty1fpDeluvs () rxrio3io4al nmicsas aDtaxmp;o4tpe  oetltfmDrlnvs u0 etrir oatlpt lieil( srxmxopny4alt  ietlt arrm(rp;u4tleo ieiatfa2uanms u0 lenio iadfp rauvol( trto(r3iu1oltemnci (fa2umur nu0opxo fetasfa el(mo;u0areoxr iydlm   i i t texmirpio4altnlnetls a2uaxmont0texoifetlsfsDumumo;()tetoir iatfptr ueo;t)srxrir3iu1lptnmnvia(farrruroot0apeo o3iytlm2elu s;u0 ltoio3todfp e ueil()srtr(o3ou4altelfctl(fartm(monu4altn fctltls uanmont)tlxnxo iodlpteli il()texoimpoy4ape  iei t)s2rmu  oo0teenmfeiysfa elu s;()arxnir3tydlmD  uvs ()s2uoiopoy1al  mfvta(f Dua(ront4aex  ieias aDra( p;(4 eeoxrctydomtean o (  2uoimpio1ol n feia(fsDurxmpno4aet ioetyd a rl(ms u4 lxnif oytfaD anei t s2xoxmpnodomt lfvtlt sDtrxm ou1oexo ietadlmDranvpn(0 exomo3tytlm rau i t)trxrxrpiu1amt lnet t)sDtm(rpot4aee  o3tasfaDrm(ms t4 eeoio oytlaDrln s s tetm(r ou1lmt lfcsls)srur(mpot4teeo feiysfaDelnmont4 ltrxfctatlpt  uvi s0srum(o oydlmtemfei ( srtm(mpnt4teeo ieiltlm2umuvp;t4aexrir oydopDe nvi s  euo(rpou1om elneslsfaDua(mont0oleo i3iatfa eluvp;u0 lenir tytomDe ivs;(0s2trxrpno4op n fcs t) rrmxm ;t0alx  i3tldlmDrlumo u0trxomr3oodom e i s;s) 2tmxm nodaltnlictas) Duaxmpot4oeenioetadls2uln s;t) eeoir oytfat lu o ( s2umxm no1lmee fvtatfs2ur(rp;o4olx ioeiysls2emn sn(4aeerxr3iotfat  ivsl(0 2tmiopoy4lp  mncil(fs2rm(ront1tlxo i3tltls em(mp t4tetoxo iytlpDelivs;(0teurio3nydllee fvt s srum(rpou4apenmfeiltfa2el( snu) exoxr3oatfatelieil()s2urir iu4llee neilt sDtru ooo0apeo fcils m2ulnms t)treomr tytoaD luvil( trxr(r nydopte fvil() Dua(  no0oltniietat m2el(ms u)aleoif3tytfpteanvols0 2xoxrpoydol elici t)sDuru pou0aee miciadfs eln onu4 exoir3oo1om e neol()srxmir iy1lpt mfvi ()srrrumo;t4apeo i3ildfsDrmnvp;t4tetnmrciatlmteai o;s) 2tm(o nydole  ieias) rraxrpou4ope io3iad m2em( s;()artrmr3tytfmt  ues ()texrxo3iy1om e fvia(fs2trxr ;u1ole mietldlaDul(mpn(4artomo3ia1fp ranvi (0s2xoir ou1al  mfci tf 2ur( pou4texnmfeiysfsDrmuvp;t) lxrmr tytlpDeanvi s0teuoxr iu4amtnmivsltf Dururo;u0oex ifeiyd s2uauvs;t0aleoio oa1fate ies;( sexr(rpiu4llt mieil()srtrx p;t0oee ii3tysfa2rmuvonu) rtomr3iy1fa r nvo t seur(opoy1lmen fvi s arua( poo4opx ioctls s ra(vs;u0tlerxo3tatlpt  u ols0sexrio ou1lm   ieil(  2tr(m ;u1alxoii3ild s2rm( pnu)tetnmo3oytlmDeli i () exrio nudlme  ieta( srum(  oo1aleoiociltlmDraums u0 lxomoctotlmtrlnes;( t2uoxr3oodam nmneiat)sDumu p;o1tltn ictls s2ea(ms;u) eenxo3oa1lmt  n i s)trtmxrpiy1am nmfes s)a2rmx ont0aex io3iatla2ea( pnt)tetrmociy1lpt  n i (  2xmxmpoo1opee nct s sDtmx pot1tpx mieiatla2ea(mo;u)tlxrxocia1lpD  uvs;t0s2uoiopou1alenmfcsa()a2uauronu0oltnio3tadls2ul(mo u4 eermo3oa1oa r nesl()truo(r iy4ame lfvt t s2tm(r ;o1aee  ieiad a um(mp;u0tlermr iytfaD  i sls)s2xoxm3oydomtnmnci tfa2tau ont0ope ifetlsfs umnvp;(4 lenircio1fmDr u o t srxrxopoodam elnvi tfsruru  no4tetn iciat sDeanvs (0tetrxr3ia1fa e neo s)texr(mpnudlmt  ieia( aDrmumpno1aetoii3ildlm2rauvp t0trxrir3iadopDe ieo;( tetoxm oy1lmtnmiei tfs2ra(ro;u1oexo fctldfaDrmnmo;() exnmf oytlmDe iesl(0seur(mpio1lp elfetlt)s2ur( pno0tlx  o3iadfm em(vs u)tltoir oadfa e neil(0 exrir3nodlmen nvt s) Durxmono0opxnifeiasfm2ea(vont0 eermr oo1opt  n s;s texriopiydlleemncsa(  2trxrpnu4tleomo3tasfs rln p;(0artnio3iadomD lu ol()seuoxo iudlp elicslsfartmurono1opx if3iltlm2rmu ont4 reoxo oydlmtrlueils0 rtoxm no1olenlict ()sDumumonu0teen i3iltfm eau p ()altrxr3iodlptr i s s  rtmim nu4al nmfet (  2tmur ;t1olxomieiat m2um(msnt4trtoif3io1lm  ai o;s trxrxo3io4al nlfcslt a2raxmooo1opxn oetytlmDra( o ()arxomr3totfptelu o (0s2xo(m oo4lp e icslt srtaum ot4olenif3tydfm em( o;(0 rxrmociy1oaD li ilt  eurimpio1llenmnesatfaDta(rp;o4apxomietlt s el(vs;u)tleoxf oodop  lueo ( srxmio nu4lp nlnvi ( s2rrxrooo4aeenmieiysls rmn o;u)tetoifcoo1faDrauvo;t0sexo(rpiudom nmncslt  rua(r no0oeeoiictlsfm rauvp;(0 lenxoctydlmteaneo (  2trxo3nudaleelieilt) rra(monu1tpeo oeiatfaDrmnmp u4 rxnxr3oo1oateliei ()s2trir3nu1al  livi ()srua(mo;u0tlt  o3iasla ranvpn()treoircoy1lm eluvolt)srxo(mpiy4ol n iei sfaDrax p;u4tpeomi3tytfm2rluvs ()areniociotfm  lies ( sexrxmpno1lle miei (f Drrumonu4tpxomfciyt a2rmn p u)texniociadoa   n sl() etm(r iu4olen ieilsf 2rmump;o0texn oetyt s2emn onu4 exrioctotop  ai o;t texo(r oudlp nlnvs s) rtmumont4aeto ocils mDel(vo t0 rtnmr3ta1omD livs;s) eum(r nu4lpen iei s) rumu pnt0oltn i3iltfs emuvont0 rxomo oodomtraivi s  2ur(mpoo1op nmietas) rumx ooo4tlxoif3iasls2raump u0 eerxrcia1lm elueo;t0seto(opiu1ope  net s aDrm(m ;o4alto f3iat mDelu pnu0aeenir ty1laD luei ( s2tr(o iudlltelivsl()aDur(m ;u4aexnmieiltla2um(vs u)trtoif3iodomtrlieils s2xm(o3iodlm nlfei t)arrrumont0tee mfeiadfs2rmu p;t0altrxr3oatfp ranvols0 exrxm nydalee iesasf rrmxmont0tpt mietyt s2emnvs;(0trtrmoctydomt auvo t)sexoio3ny1lpenmnei t)aDtaxmpno0tleoif3ias mDeau o ()arxrmr3iodlat li o s0 rxm(o ou4alee fvsl( s2rrxro;o0apeoifeiad mDumu s;u) exnifciotlm elneolt  exoir3iydam   nesat)sDum(mp;o0tpe  ieiyd m em(msnt0artnxf3oo1lmtr nvs;s)sruo(r3nydalt  ivs sfs2raur nt4texnifctatls2uln pnu) leomocoo1la eluvs;s trxm(o3oy4omtnlfesa( aDtru pnu4oltomicild mDea( onu0teenircia1fmDeaneo t) eumim oudol  liciat arta(mooo1tle mfeiltfsDeaumsn() eerir oy1latraueilt)sexrxo3oodlm n nvil()aDrr( p;o0alxomfciydfs rmn p;t4 lxrxfcta1op rlnvils0t2tmirpoudlleelncs s) 2taxmpot4aptoif3iyt aDum( ont4 rxnmo3tytlateanvolt)srxo(m ny4aptemivt (f Dtax pno1tee  fctydfa2ra(mo;u0aeermf3ia1fpte nesl(0 etrxrpoudopee nctatf 2raum no0oltniiciys a2uau on(4 eeoxr tydoa eauvol() eto(rpiu4omeelfctat) Drm( p;o0tpenioctltla2ea( onu) etrmo iy1lp  anvi;(  euo(rpnydole mfvs s a2rrxm no1alto i3iytfm rmuvp t4artomrcoydlpt ln sl(0 rtrirpoudlp e ncs () rrau o;t4opeoifeilt a2ra(mo t4alxomociytlpDeln ils)t2umiopny1amtnlnesat)sDumxm nu4olx  fciad aDrlnmo u0 ltomocoa1fat ai i s) rxrio3ou1ll  lncs s sruaum ot4opt ioeiadlm2eauvs u0 lxoxr tadfpDraies s) 2xmir no4lltemfesas  rtaumont1oex  ocildfa2ulumpnu0 lxrxo oa1omD  n o;(  rtoio3ny4ol e icilt) Drru oot4aexn f3tad a elnmp;u0tltoir3iodopt aneilt) 2xmimpoydolt  neslsfarrm(root0tpe ifeiyd mDulu s u0teenxrcoytfat  nvi;(  ruoirpio1lmtnmnei ( aruru ooo1texo iciad mDrln on(0 rxnxocto1la rau sls0trumimpny1lpe  neilt  rrmxmpoo4oeeomociysfaDem( s;(0 lermo oa1optr uvs;t0teuoxo3iu4lpt mfcs ( sDrau  oo0tlen ieiydls2rmn s t4aexrmoctadom eaiesl()sruoir3nudomenmies () Dtm(  nu0aptn oeiatfm2ea( o;t0aexoxrcoodlateluvil(0 rum(o3nu1om elfct t  Dtrurpot0open ociasfaDua(ms;t0treoir iatlm eli i;()sexoxmpiudlltnmicsas)sDum(mpnt0oetnii3iytfa rmnvpnu)aexomocto1fa r uvs ()t2tmio3io4omen ics t)a2tmxm nt0oeeoiiciytfaDuanms u4 rxomfciodfa ran slt setoio3ny1ope licsa( sDrm(mpot1tlen iciasls eaump u0arxrxr tadfm e nvsls trxm(m iodomte fvs ()aDum(  ot0tptoifetydfs em(vo u)trxrio3tatoa r ivils) rxo(m nodameelnvi ()s2rm(rpno4aeen iciyd a2uluvs t0tetoiocoadomDeanes;s teumirpiu4lptelneils) Dtmx ont0opxomictytla2umnvs;u0aetnmf3ootfptelu o;t)sruoxm3iu4om emfvsl(f 2uaxrpno0tpeniiciltls eaump t4tltoxr3tytom  aneo ()setmxm3iy1lpee fcs tfaDrr(rp;o4apenmi3iysfm eanvsnu)tlerxf3io1fat aivs;t  2urxo iydomtn fvils s2ur( poo0aetn feiadlaDelu snt4alxrmrcoatopD lnes;() 2xmir io4ome  ivtls) Durxm nt0olxnmo3tyd a2rluvonu0treoir3tytomt lnes t trxoim3nudlmenlnvtlt) rumx  ;o0tex mociytlmDranmont) rtoxo3oo1lmtrlneil(0s2urxm3iu4lmtelieils arur(rpot4tpe  o3tld a2em(mpnu) eermoctydlpt li s s  exoir3nydoltnlnvsas)srtrxm no1tetomoeiad m eln p t4aexoio oodom ranei;s) etoxrpoydopen ics (fsrtrurp;o1tpxniieiatlm rlump;u4aetniocio1lp  luei s0s2tm(o3oydole lictltf Dtr(mpno0tleoifeiys s2rm(vpnt4texrir3oytlmD  ues t teurxo3iodol n ieias)a2rr(mpno0optomo3iytla umump;(0alxrir3iatfpDe n i;s0trxr(o nydllte ici s  2rmx pou4opt miciat a elnms;u0trxnir3iodlpDe ivil(0s2uoxm3iudlp  mfvs t a2trx  nu4olen fciltlm eaump;t4 lxoioctytoat anvo;( seur(o3no4alenmnesl() rururoou1tetomfetldla2elu sn(4 lerio iytomD aueol(0 2uoir nudopen nei (fsDrau pou1tpxomfetltla2umnms;(0 etrifctadoaDeanvo;( texo(r3iudol nlnvta( sruauront4tpxnii3iltfs2ra(mp t0aetrxfctotla eluei;s)tetr(m oo4altnlfciatfaDrruroot0apxo oeiasfm uluvsnt0aleomo tatlmtr iei t0trtoxm3no4omt lfvtas) 2rrump;t4aee mictltlm2ra(vp;u)alxrmo oy1lm rauvs;(0 eurxr oo4opee netlt)sDrr(m oo1teeo feils aDranvont0teenmr ootopt  uvi s0s2xo(mpnu4lltelnesas) rum(rpno0tlt  fciyt a um(vo t0trxomr3oydfpDr i i ( s2xoimpoudom nmiviat) rum(r ou1oex ifeiatfaDrl( s (4 ltomfcty1fm eaueil(0 2xm(opnu4ope lnesat) Duaum oo0tle mocias s2rl(mp t0tleoxf iydlat lieil()srxrio io4omte fes (faDurur ;t0apxoio3ilslm2uln p;(4artrmf iodopteanvols) 2tmxo oodlpt lnvslsfarur(ro;o1aee  oeild sDrauvo;(4arerxfcoy1opt au i;s0 etoxr3io1apte nvilsf Drr(m no1apt ii3tyd s elumonu4 eermocoatfa eli s;(0trtrxmpnodopeelieils)s2rmx oou1opx mfeiadla emnms t4 rxoxo3todopDe n o ( srur(o3iy1am  mivilt)arum(  ;u0opxn f3tad m2ul(mo (0aetrxf3ty1lpD luvslt)srxm(m3ny4alenlics t)artrurooo1tltniietytlm2eauvon(0tltrif3tadlaDe u o;t trumxrpoo1amtemnvsl( s2um(ro;o0alxo oeildls2umn s;u) reomf3iydomD li o;t  rtr(o3oydlmt lnvs (  2rr(mo;t1tetnif3tyd m2uauvo t4teeoxrciotomtrli o;(0tetr(mpny4lm   fctls  2urxro;u4alen iciltla umnvp;u) rxomrcoy1optrlivs;s)srur(m3ny1om emfeiat)s2rrx ont0ole  f3tlt a2ranmsnu)arxoxfcootfpDelneo s trxrir3oy4amtn ieilt  Drax oot0oet mi3iat mDrlnvsnt4 etrxr3iodlpDe nvi;t)s2uo(opiu4llt lfeiat)aDrmxr ;o0opx mietyslm2umn on(4 lenmo iydlatelivs s0seuo(r iy4lltelietlt) Dtrx  ;t1tpt iieiytfsDum( o;u4 rerxr3oo1lmD luvi;t)trtmxm3ou1olenlnesa( sruaxront1tle ifetls aDemnms t)aexnxrcoydlmD  ieols) rxm(o ny1lleelfctl() rra(r ;t4alto o3iad s2el( p;() renircoa1opDrlnvs;t) rxr(m3oydap  lnes s srtaxro;o0alxomfeilt mDumn ont0aetnif3iy1lmt anvi;s setmxo oy4ope mncsat a2rr(mp;u0aexnmfcils mDrlnvsnt0artrmf iadfmtrlu ilt0 exmiopnudlm  lneiatfa2tm(mooo4aexomiciyslmDum(mp;u4tltoxo tadomteaieo (0 2xo(rpoudaltnlneilt srtrumpot1alt ioeiys a2umumo t0tlermo totlpDr nvols)trxrxr no1ame  fcsatf Dra(rp;t4apx ifetadfa rm(vpnu4alxoxf3to1laDr ueils trum(o ny1aptnmfesatfa2umu pou1aeeo fctlsfa2emnvs t4teenifcoa1latrlu o s) etrir3iy1apenlnct tf Drm(r oo0alt moctldlsDemuvo;u)teerio oytopD  n sls trxr(r nu1llt lietl(faDra(  oo0apenii3tytlaDua(mo t4 eeoiocoa1lm   n i s0seum(opou4apenlncsl(  2tm(rpnt4olto oeiat s2ran pnu4teenxr3iytlmt luei;()teurim ou1lpe lfvi t)srraur nt1aeeoioetadlaDrmuvpnu0aetrmocoodoptraivi;()trxmxr iy4lpe mnvtlsf Drau  nt0oee mociat mDrlnmp;(4 eenxo iotfaDeaivo;() eum(opiodape  iesl( sDtmur ;u1olx ii3iatlmDea( s;(0tlxomr3ty1la eaivo;(0teuoio3oo1lp   fvia(  Drm( p;t0oexniieild s2uauvsn()tleoif iodfaD aieslt0trumim3oo4olee iet ( s2taumo;t4olt iieiytfaDrlump;(4aetoir ty1om  aiei ()teuoxm3oo1lle lfvt t aDtaxm ;u4tpt ii3iatfm2ul(vs u4aeenmr ootlaDeanvi;t setrxmpnydlmeemfes ()srurxr nt0tltn i3iadfs2ra(vo t)texrircoodlmt livslt srxrxr iodal nmivt s  2taum no4tlxo o3ild s2rln p;u)aetrif iy1om   i o s)teumxmpno4llee nvtatfaDrr(rpou1optnmf3iltls2uaums;t0aexrmr3ia1laD au i s t2xr(mpoudolenlivs (fs2rrur ou0alx mi3tytls2umu onu0arerif3iytoptrau i;t0 exm(mpny1am nmnvs sfsDrmx  ;t0tptnifcildlaDemu s;u4 eeoxociydlateai ilt  2toxo3no4aptemfvsl( srrruroou4oexn i3iydfa2rluvo () rtrxocoodlat li s;t trxmxopiy4omenmies t  Drmuront0opeoifeiydfmDrl(vs;u)tlermocoadop eaneo;s  2xo(r3oydlltnlfcils)aDra( oou0aptniiciatla ranmonu)altrxo tatlm r ieilt t2uoir3ny1omenmfesa( artrx  no1ape if3iyt a rl(vo (0 exrmrcoy1fatelnvol()t2xr(r3oydomenmfcslsfsDrm(mpoo1aetoifciydls ul( s u)altnxrcoatfmDeanvils)s2xoxo oudaltnmieiat)srrmurpou0olto i3ils s ranvpnu0trtnxoctadlpDeaiei s tetrimpoy1lpen ici (  rrau  ou1tpxoiicias mDelnmo u0texomfcoy1omtr i o;s  exriopnydomenlfvtls aDraur nu4tpe ii3tysfs2el(msn()altomo io1faDraivolt0trtm(m3io4lp emfvils aDurx oou1tleomieias aDumu s;u4teeoxrciotoa r ieilt0seurir3iodol n iet ()srtaxroou4opxo ictytlsDrmuvpnt4aeeoifciodfm elivil( teumxmpiydolte ictlt) Dtr(rpno0aexoiocils mDemuvsnu)areoioctotfpDeauvi t setm(o ny4aleelieslt)arta( o;o4aeenmoctyt s2emu snt0texrxocoo1fpD  uvslt)srtmxm3nu1ol n nesasfsrrmur nu4alt if3ild aDea( pnt0 eerif oodoaD li s;t0trurimpiy4amt mfcsl(faDtm(mpou4ale ioetatlmDeauvsn(0 rxrmr3oytlmtr uvi;s s2xmxr oo1ll   ieils  Dua(r ;u0aet ioetat s2ulnms;t)trtnxfciatla r uei;() 2umxm iy4alenlivtls)s2urxmpno0aexo fciasls emn o;(0trxrxfcty1opDraivo;( srurxm3no1ape  iviat s2urxr ou4opxoio3iytfa2uau onu)teenir oo1oa rluvsl()t2uoxm iudlp nlfes (  Dtm(mont4aeenifctydlaDra( on()artoxr3oy1faDrln o ()texo(o3oy4lleelivsa(fsrraxrono1opxniieilt m eanvo u0alenmo3iadfaDeaneil( teumxo3ny1lmenmfviatf Dta(m nt0aptn f3tasfs2ea(mo;t4artomo3oytlaD  uvo;t) exrim3oy1lmte ivs t aDtrxmpno1tlxn iciatfs rln o;(0texnif3iytla rlu o;t0srxoio iy1optelivs t  Drmumpot1olxoioetytfa2um(vs;t0arerioctytomDrlies;t)s2tm(m3oydoptnlictlt)arra(m ;u1ope  octysla el(vonu4arxomf3ootfm eluvol( srxmim3iydomtnlfesl(fartrx oot1aeenio3iyd a ranvsnu0aeeomr3tatomDrlu il(0 rurxrpnu1omt  fet sfaDtrx ono4tex mfeiatlsDraump;t4trtriocio1lpDe nvi;()t2trxr ny4ol   ncil()srrr(rpou1aexnii3iasfs ra(monu0aeerir3oodlatr i s;(0sexoio3oo1lmeelfet () 2rru pnt1oetoif3tydfs rlu o;t0trenirciadfmt  ieo (0trurxo iodol elfvsasfsDrr(r nu0aeeoiieiasla2rlumsn(4teermf iytfmD aneo;( srtriopoy4op emneiatfarurxrpot0oltnmo3iyt aDra( ont) lerxr3tadla r iesls)seuoxr3io4lp emfvsa()artaxrp;u0tpeomoctysfmDrmnvpnu4 rtoxr ty1omteanvi s)t2xmirpny4ole  ieslt s2rauront0texniictysls2umnvp u0teenxo3totla r ivils0s2xmir3nodlp   nvta(fa2um(m ot1alenmociys a rau pnt4 lerio tytfpDe nei;() rtmxo iu1ape  icsas  Dumurono4aetnio3ilsls2rl( p u)aexrmrcty1lptelu i t0tetoxr oodlm  mnesasfarraxmpou4opx  i3taslsDum(vp (0artrxrciydlp ranvslt s2xoxm3nudlltelnvsat) 2umumpoo4oex  ociadfaDul(vo;t4trxrif3iadfm  ln s;t)truoxo io1alt mnei ( aDtrxmoou4aleomfciadlm2ulnvsnt0tltnxo3ia1om   ivsl()t2xmir nu1amtnlivils srra(m nt4opt  fetys aDelnmont) rxrmf iydoa r i ilt0 rurxopno4ape  ietas srtaum ;t4aetoiieiatfm uan s u4areomocty1la e i ol()t2xo(rpiudamenlnctat aDrm(mp;u0ole  ietadla2ulnmo (4 etnxr iadoateaneil()s2trxr nydlleeliet (fsDua(m oo4tlen fetldlmDrm( o t4 ltrio oo1laD  nei t)s2umir3oydaptnlnesl(  2ta(  no1oetnif3iadla2el(mp;t4trenmr oadfp  aivi t0texoxmpnu4ap emfvt tf 2tr(m ot0tltoiiciatlmDum(vs u0 reoif3iydfa r uvs;( t2tm(r3iy4am  mnes ()aDtm( o;t1tpx  o3iadls eaumpnu0artnio3oa1fa   uesls sexmirpio4am nlncilsfsrtau  ;t1tpt if3ilslaDel(vo t4texoxf iadfa eluvo;()texmiopoo4ll n fci ( artrxmp;t0optnmfctltlsDuluvsnt0 etoifciotfaDeau sls0trumxopiudomenlfeslsf 2rau pot0apeoioetlsfa2emu onu) leomf3oy1laD aivo () eum(m ny1ame mfcia(fs2ta( pnu1apxnmf3tlsfs2umu pnu4 etoxf3iy1fpDrlueo;s)srxrxo io1lp elfes t  rtm( oou1oex miciadlm el( p t) rxnxociy1omt  i s s trtoim no4op  mfvta(  Drmxronu0opeo ociat s emump ()alerxf todlpDeluvs (0sexrimpoudomee neia( s2um(mpno4oeen i3tad mDulnmsnt0aexoxocoy1fp rlieil(  etmio3iydome mncs ( aDurum ;o0optoif3tydfsDeluvp t)tlenio3iotfp ran o;s0 rtmxo oudlmtnmfvia( aDrmxm ;u1oeen ieiyt mDrl(vpnt4tltrxfcoatom eluvolt0 2xoxopiodalee fetls a2uaump;u4aex  iciys mDrm(mon(0arxomf ty1oaDelu s;s0 etrio3iodll emnvtatfa2rru oou0oleo i3tad sDumu p (0treniocoodopDeau o (0seum(rpoydllt mfcil(fartaxm ou0oetomi3iytla2rmnvs;(0 eeoir ty1oaDe i o (0s2toir oydal nmncsl( aDtm(m ;u4alxo ieild a ul(vsn(0treomfctodop e uvs;t0 2xrim3oodaptemnetl( aDtmxm ;o1oee iieiltlaDulnvs;u4tltnmr iotlmD ln o s trtrir3ny1om e netas)a2ta(mp;t0tetnmi3iaslm2em(vo;(4teermf3oodlaDe i o t  etrxm3ou4lpen nes s)arrr(r oo0optomoetytfa2emuvs t4 exnif3totfaDe ivs ( t2trxo ny1op nlnesasfs2rmu ono1optn fcilsfmDrlums;()tlxomr3todlmt  i o;( s2xoxr3nu4amt lnct s)srumxmp;o0alx ioeildlm2ra(vs u0alxnmr oo1la ran s;(  euo(m3nu4ole lnvtl(  2ta( ont0tleniiciydlsDel( o t4altrio iotop ranei;t0trxrxo iy4lptelfci sfaDtru pnu0tpenmoeiltls elnmo;u4 ltomrcio1omDrauvils0trtmio3iu1aptnmneta( srua(r no4opxoifetaslsDumnvon()altrxr3ia1lateauvo t0teuoxr3iy4aptnlfvt tfsDtaxr oo1optn f3iad aDrmnvo t0tlxoxf oy1lpt auvo;( truoxo3nodal  miesas arrrxroot1tlt  ieiytfmDeanvsnt0texrxf3tatoa rlies s) 2umiopoydlmee ies () 2ta( o;t4ale ii3iatfsDemuvpnu0 etnxo3oytoa  an s s texr(m iudolte nctl( sDum( oou0tpxomoeiltlm2emu ont)trtoxf tydoa  an s s0s2xoimpnydoptemfcsa(fa2ua(r ot1oexoio3ias s2rl(vsnt0 ltoif iy1oa r nvo ()srur(opoy1llen neta(fs2trxm ;t4apeniieild a uauvp (0teenxocoy1fpD an o;s)srtrir io4ope lfeiat aDumum ;u0tpe mf3tytfm2emu snt4aetoxf3oy1opt au s;t0 rtoxr oudlmte ivi (f 2tmur oo4tpt mociysfa2rmu s () etoxrciotop rlivs;s)sexrio no1op e nesltfs2tmxm ot0alx  o3iydlm2rl(vs;u0trxrxf3oadfmDrlieo t texrim iu4lmte ivsa() Dtrumo;t0oltoiietat a2ul( o;u) leoxf iotfatran s s0s2urir3ou4lp n nei t  rumxr oo1optn f3iadfm2rlu snu0trerxociotoa r uei (0 ruoxr3nudom nmnvs ()sDrm(m nu1aexnmi3ildfs2ra( p u4 reomo oodfp  aieil() 2trir3iydlltelneiasfs2tmxr nt1aptoif3iasfa ea( s;()aeenmr todoaDrliei s0 euoxo oudlp elfeiat aDtmumo;u1aet ioctyt aDelnvs;(4tlxnmf io1fm rlivs;s0s2umir3nydol  lfciatf rta( poo1oetn ociys a rlu snu4alxnif oodomteli o;t0srxmirpiu1lme mnvtl( s2taumont1apxnmi3ilslmDrmumo;(4trerxf3oodlaDraivols)t2xmxopio4lm nlicia(  2uaurp;o4tetn oetys s ea( p t4 ltrif3tydomD  u o;s)teurirpiy4llte ict s)artru pou4optomoeiyt m emu pnu0artrmocta1fa rlnes s0 2xoxrpiy1ale lnciatfarumxm ;t0optniietldfa um(vp;u0arenxfcootoaD li o t0 rurir3iu1omeelietas a2tau onu4olt mf3ildla ulu s t) renio3oatoaDelivo s)s2to(o iy1altn fesls) 2ua(moou1ape ioeiaslaDemnmp ()tlxrmf ia1la e nvi;s  rxrimpoy1apen fci (fs2urxm oo4olt  f3iltfs2raumo;(0trtomrciotoa e i ils0srxrxr3iu4am elfei t) Dra(moou4tpe moetltls uau o;u0 lxnir oatlm r n s;s  2urxo ny4al nmfcta(  Dtr( ooo1alxn i3ilsfa2eanvo t)aeenmrcoytlp rauvi () rumim3oy1om emfcia()sDraxmont1teenioetys m2rlnvont)texrio3tytop e i s t0teumxrpoodal e nvtasf 2umx onu1oltnifciadfm2ulnvo (4tleoxf oo1omDrln il( t2urxopiu4ame lfes t)a2taurpnu4alt moeiltlmDrmuvpnu4 eenxocoytoatr nes () etr(rpnu4am emieias artm(mp;u4apto i3tyslm2rm(mon() rxoirciatlmDr n i;s trtm(o nodoltn iet t) 2raxronu1tleo oeiadla em( ont0 eermfciodfpD au olt0 ruoio3ou4aleelfet s aDra(rono1aptomf3tadla2umnvs t)tetnioctodoa  aneslt) rtmimpiodap nmics t  Drrurono0aexnif3iydls el( p ()aleoir3oa1fatrau ilt0setrxo ny4ale livsat)s2rrurpou4opt  i3tydfaDean p u0 rtnmr3ia1fm r n s t s2umxmpnodlpe lncsa()s2uau poo0aeen ieiytfa rau p;u4 exnif oodfp rlnesls)trtoxmpno1lmeemicias s2trumpoo0oltniieildls emnvo u)treniociatoate ivi (  rurio nu4amtnmivt t)artmxr oo0tlxnmo3iadfaDeauvsnt)altnxo3ty1fptrluvi (0 rtrio3nu1lp  lneias s2tm( pou0apenmfctlsfa2ra(mo;(0trxnio iydop r i o;() rumxm oudolt lnetltf 2rmxmpnu1tlenmietytfa elnmo;()texrxo ia1opD livsls)truoio3iodap emnviasf rumum ;t0oeeoii3iat mDumu p (0arxnxf tadop elivi ()sexoxr3io1llenlnvs sfaDrax  ;u4opx  oetysla2eluvont)aetnmo oa1optranesls) rxm(o iydamenmietas)sDtm( p;u0aeeomfciydlm2rmn s t0 leoir iy1fat liesl()teuo(r nu1ll n fes ( a2tru oot4tetoio3tydlm em(vonu4aeeoir iytfate nvil(  2xmiopiy4al n ivtl(  Drru pnu1aeto o3tas s el(vo;t0trenxo3tytoaDe n s;t) etoim3nodameelfesl( sDrrum ;t1opeomo3iadfs2rm(monu4tetoxr ta1faDeaiei (  rto(m3nydoptn icias) rrmur oo0olxnmoeildfa el(vo;()texnxociatfmD au olt trxm(r3no1ape mivsl(  2trxm ou0olxoiicilt mDeluvonu0arxomo io1lp rlueo ( srxmxm3oy4optnlfei t  2ra( p;t4ope mictasfa um(vp;(0arenio iodlp eli ols)seurxm io4aptnmnvia(  Dtru p;o1apx mietydfs ra(vp t0arenmf3iytfpDe ivs;t)trxrim iydaleemncs s)srtaur nu4tpeoii3tysfm el(mont)tetoio3tytomteanes s)s2umir3ou4amtn fcsa(fs2umxr ot1tlxnmi3iadla2rmnvo u) lxrmo tadopDrlieolt)s2umiopno4al  mfcs s)artr(ro;u4olenmieiytfa2um( pn(0texnxo3oatoaD au sl(0 2xr(r3iu4ap elieslsfarurur oo1alto oetltlm2ua(vont0 etomr ootoatelnes;t  rumim3oy4aptnlieils  rrmxro;u1aeto i3iat m uluvp ()trerioctadfm e ieil( trxm(o3oydol  lncs ( a2tr(  oo1opto oetld m uluvont)artnxociatfat auvils)s2xriopiy1llen ieilt)s2rmxmp;u1oee ioctld mDrm( snu4arerxocoa1omtrau o;t)srxmxrpio4amtn fvsls) rraur ou4oexoio3iys m um(vo;(4altoxr3oydomt luvo;s)srxoim oy1lpenlfei sfs2ta(mo;o1teeomi3iytlm2umu p u)altnxf tadop r i s;s  euriopoydap   ivia(  Drruront0apx io3tas a2uln sn(4aetrirctatoatelnvils)seurirpnu4lp  mncias a2urxrpnu4tlxn f3iat m ra( snu)treomo3ta1fmteluvi (0teum(o3nodol  liesatf 2tmx ono0teenmi3iydlmDranmonu)tleomfctatlmtrlu ol(0 2xm(rpno1lpt lnvtat) Dururooo1alxo iciyt m2emuvo u0tetnmo iodla eln o (  rxrir3iudapeemnesls sruaur oo0tlxo iciysfa2el(mpn(0alerxfciotlp  luvo;t0truriopoy4al elfvia(f rrmumpno4tlxo fetydla2el(mo u4 rtoif iadla ranvo;s0t2trirpnudomt mfvilsfarrax  nu1tleoioeiadlm elu s;() eerxo3oo1om  ai i;t0srxrxm iydomen ics ()sDtax p;o0texomfctas sDuaumpnt0alenxo3ia1fpDr u o;t0tetoxm nodopee ics s)srtrxro;t0olxoiicildlm2umn s;(4tlxoxo iodfm raieslt0s2urimpoy1opt mfvi t aDuaxrpou1alt ioctls m rlnmp t4 rtrmfctytfmDe uvi t) rum(rpou4om  lfei s s2tmumpot4tltomoeiydla2uauvp;(0aexrio oytlaDrlu o;t) exm(o3iy1ole lfct sf rrrx pou1tle  ietlsfs2emump;u0texnxf tatfmte ivil() eurxmpnu4ap emfcsas  rtax o;o4tpxoiietlsfs uanvp (0 leoif totfm   iei;t  eur(mpiy4oltelivslsf rraumpot0aee  feiyd s2emu p;t)tetnmo tadfaDrlu i s0 rtm(mpou4lm e ivtas arumxr ot4altoiiciltlmDea( onu4 rtrmf oadfatrluei;( sexm(o3iy1om  lfcs sf 2ur(  nt0ope  oetlsfsDuan p t)aexoif3oodfpDelivilt t2trim nu1om  lfei t arumxmont1oeto i3iyd m2ra(mp;u0altoirciodoptrluvs t0 eum(r3io1lpe lnvslt a2trxr ;o4opx ifeiasfaDulnvp ()tetrirciydfatr nvi ( tetm(mpno4ape  ict s  2truronu4altnioetltlsDumu ont0aexrifcoadfm   ueols0 eurxr iydop emnctls s2urx  oo0oexniiciadls eaump t4 ltnio3iytlaD  nvols0 euoio3iu4op e ivsat)sDtmumo;o1oltn o3iadfa2ulumo;() lxnmf ia1laDrluvo;t)texoxmpio4am  lfes tf 2urxmo;o1aexnii3ildls2uanmo;t4aleoxf3tatlm   uvils) 2to(m3oodole  fctls  Drmur ;t4oeenmi3iltlaDrln p t)aetnmo3ty1fmtr uvs;t)srxmxr oydamte fvils)aDraxronu1aexomietys m2rluvont4trenio3iadop eln slt)t2um(r no4lptemnesl( aDrmuro;t1aexomfeiydlsDua(vsnu4aexrmfcio1fp rli s;t  rxoimpny4omtnmncta()s2tmurpou0tlenmieilsla2el( o t0arxnxr3oodopDeanvs;t0srxm(m nu4olenlnvtat) ruaurp;u1ope  o3iyt a2ulu ont)tlerir3oadla e u i t0s2uoxr3iu4opt mnvil( sDtrx  nt4tpxomi3ilsfs eaump;u0 rxnxocoytlate iei t  2ur(mpiy4ap nlicilsfa2truroot0tex ioeiys aDemnvont4tlerxr iytlm   u o;()t2toir iy1optnmnvsasf Dta( pou1aleoifetls m2uln o u)tlxrxf iy1fa  aneo;s  2toxm3no1aptnmivs t)a2ururpno4tleomo3ils sDemn o;(4aleomr3oytfmD aneo;s0truoxr3io4omt lnvslt)srrr(m no0alenii3iytla umuvsn(0alxrir oydfpD aivi t)sexrio3ou1olte feilt  2rruront1opxoio3tatfsDrluvo;t)tlxrifcoy1fmteluvi s trxmxopnu1ap e iviasfsrrmxrpou1aetoiociytls2el( o t4arenmf3iy1fpD lieo ()s2xrxm3oudlle mivta( aruru o;u0alt  feiltfa2el( snt4 ltoxr oodlm  lnei ( trxo(r io4lme lfcsa( sruauro;u4alxnio3ilslm rm(vp u0 exoifctatfm elivs;t t2xoxopnodamt lnesls)srumxmpot1tptnmf3tydlaDelnmp;(0 exnircootoptr i i s0 rtmxm3ny4om   icsat) rumumpnu4aexn fciyt s2uanvont) eerxo iadlm eaueols)teto(r3oydal nlieilt srrau  ;o4openioeild m2ul(vpnt0tlenircoatlpteliesl(0 ruoim3oy4am nlnviat a2rm(ronu1alx  fctlsfs ulumo;t)aeermo3iodomteluvolt  rtrio ny1lpt lnvtl(farrrxr ou4tpenio3iltlm2ul( s;u4trtrmr3iatlpDean i s t2toxr3oo4lptemfvs t srtm( ono1tpe iieiaslaDrl(vp t)trxoir3iatfaDelueo t srtm(o3oo1opt mneia()s2urxm oo1opt iiciytlm2uluvpnu4tleomrcio1lp e i ol()setmxr oy4lptemnvt tf 2truroou4tle if3iltla2emu s;(4tlxoxo3ta1optr u sls)seuoxm no1ap elfet s) ruax o;t0ape  octldls2uauvs;t0alxoxfcoadlmtrlueol()t2ur(o nudaleemivs tfsDrru pnu0oee mociysfsDuanvp;u)artoxf3oatoptr n i;t0 eto(opno4lmtn fvtatfsDumu o;o1ole  i3iltlsDra(mp ()tetrif3oo1lmD anvo t t2trxr3iu4opte nvtlsfsrrr(rooo4olxn f3ilsfsDua( on(0 rxnmr3to1op raieo s) rxo(o io4llt mietl( s2rmxmpno1aleniocilsfs2elnvo;u0 lxoio iy1fmD  uvi s) 2xrxo3iu4ope lnes t a2rmxr ;u0ole io3iyslm2ranvo;(4arerxf iydomDr nvi ( trumio nudom   nctl()a2umxr nt4apeoio3ildfa rmnvs (4aexoxo oydfaDrauvslt teuoxrpoo4al  mfvs (farurump;t1tle io3ilsla emu o t0altomf3iotfmDrai s;t)texr(opnu1omeelfvtl(f 2rrx o;u4opt  i3ils s2elnvp;t4artnmociotlptelueil(0seuo(m3ou4lpe  icsat arta(ro;o0tpt  feilsla eauvs t4 rtnmf iytlptelues;s0 exr(o3oo1amtnlicil()aDraum ;u4ape  fetysfa rl(mp (4 renxf iotfaD  ueil() 2trirpnudlm elnviat  rrrxrpoo1aeen ociys a emnvo;u4 lxnmf ty1fmDeaies;()t2umimpoy1opeelfetl() 2urxrpnt0oet io3tld s eln on(0 rtnmo3iodoptrlies s)s2tmxr no1ale mfetas a2tmur ot1tle mo3tas m rlnvs (0trtrxociodoa rln s;s)sexoxo3oy1opt mfcia(  Dtrxmonu4olxnii3tyd s2eau s (4artrxocoy1fmD  ueils0trum(r iudlle lncs (f Dtax p;u0tet  fciys s emn o;t4tltrxf3oy1lpDrli olt t2uoio3iy4apt liei s aDuaxro;u4tet mi3tydfaDrluvs;u4 leomo oydfatrln sls0seuoxo nodam nlfesas)s2ra(mp;u4oeeoiictasfs2rmn s (0arxomo oa1op r neo t  rxo(o oo4ame mnetat)sDtru  ;o0oltomfcilsfaDum(msnt)aetrifctytoa   n ils0texmxo3ny4lm emnviatfa2trx  nt0tlxo oeiydfs eluvonu0trtoxo ia1fat lnei;( teumiopoydlpte fvtls aDtm(roou1aee iociltfs em( o t0teenxo iadfptraneo;s0 eur(rpoo1omte fetlt)a2urx o;t4alxnmfeiysfa2rmnvo;(4texoir oy1laDeaneo t0setmimpoy4om nlietasfa2umx o;t4oleomictlsfa rln s t4aetrio3oodoa r u o s0 2umim3nydal elfct s)a2um(moou4ape ii3ias m eanmon() etnxfciotla  auei t t2xoimpiodoptelfcsl(  Drmxr ot4tptoiociyt s2rmn o;(4aetoircio1lptelivo;t  rxrxrpio4am   nesas a2uru pno4tpe mfeiatfmDranvs t0 exoio oodfmtranvil( t2xoio3oo4alenmivs sf rrrxm nu0tle  ociyt s rmnvp;u) rxoxf3oytlm rlivo s)t2xr(mpiy1opt  ivs t)sDuaxr ;u1aptomi3ilsfa rluvo;()tlenxfcoodlpt  i ol()teumxm3no1apte ict tfartmuro;o4oexnmiciyslsDeaump u)aleomocoy1fp  an il()srtrxo ny1lm nmncsls) Duau  ou0opxnmfetysls2rlu snt4aetnxf3iadla ean o;(0trtmimpiu1om nmiet (fsDra(rpno1teeniicilsls2uanmo t)arxrio io1fatraivi;s0 ruoxm iydamt  ivia( srrmxmpnt1texn ocias m2raumsn(0altomfcootomtr nei s0s2uoxo nudlpe  ivsl(fa2umuro;t0apeomi3iatfmDrmn s u4aetoxociy1opDelivs t0trxrimpny1om  micsatfsDtaxr nt1teeomf3tltlmDeanvsn()aetrio iatoateaivol( tetrxr nu4amee nvta( s2rr( onu4tlxnif3ilsfm em(mont0alenxr tadlmtraneo;s)teur(r no4ll elfcs (  2rr( p;o0oet io3tldlsDem(vs u4aetoxf ia1lat aivs t)srxoxr iu4omt mfcsat) 2trump;t1aleo octydla2emnvont) lenxfciodomDe u slt)srtmxr3nydlmee fvia(  2tmump;u4alx  feild m em(vp u) eerircoa1fm eai s s trtmirpnydomtnmnvt t sDuru pou4apto iciydfa rmnvsnt)arerxo3iatlmD li o t trtrir3ou1ole lnvtltfa2trxmo;t0opt ii3iytfs rluvo;(4 rtoxr3ootopD aivo (0trxmxm3nydolt  nci (  Drmxr oo4apeniictatlsDrl(mo;(0treoif3totlpDe i ols)srxrim oudom   fci t)arumu  nu4apx  i3ildfmDra(vo;(0alxnmo oytom   ivilt  rxrio3iy4omtnmfvia()s2rmu  nu0aptnmietas m uanmpn(4altnxf3iadlptelueo t teumio nu4apen netls  Draxrpnt0opx mi3ilt s rau s;u)trenif iydfate iei;s srxmimpoo1aptnlnei ( s2urxmonu0oexo iciytfa2el(msnu0aleomocootlat aieols) 2xo(opiudamt liei (fsrumxroou0apto fciys a2uanvs;u0alenif3tatlpte uvslt0t2tmxmpno1amte fvt t)srtaxmpoo0tptoioeiadlm2ul( p;t0tetnmf ta1faDeau o;t) etmxo iu4lpt lies t) 2um(m ;u4tptoiiciyd m2uauvo;t0arxnmr oo1fa  livol()s2xo(o3iodomen net ( a2rau  oo0ope ifciytfm2eau p;(4arenmf3oo1oa   ieols sexo(r nodam nmictat)a2rau  ;u4tee mf3ias m2ra( snt0 lenmf tydfa r nvs s)t2xoio3io4al  mfcsls)sDtmur nt1opto fciadfsDea( snt)artrmf3tadlaDr u ils0 eurxm3ou4ome  icta(faDurumono0tetoiictysfa eanvpnt4arxriociotfp eaneo t) euo(o ou1lpeemfciltfaDururp;t0tpen ociadfa um(msnu0aexomf3ty1lmte n i;t)texoio3io4ap nmies sf rumxm ot0aeto i3iatfs rl( o;()teeoxf oodlatrluesl(0 etrxr no4op  lfeiasfs2rr( poo1oex  ieiasfs2rl( o (0 renxrctotlmD aueo t) 2xrxo3nudlmt mnes t sruaxmp;t0optnif3tld m2eluvon(4tleoif oodfm  luesl( sexr(m iy4am nlfcsls artr(r ;u4opto feilsfa uanvont)trxnxrctatom eanvo t0t2xoirpnudlltemivtltfs2trurpoo4tlt ifeiat sDrlumpnu)arxnifcio1lmte n o;s)s2xm(m3oydoltnlfctl()a2tr(mont4tleo ictls sDrl(vp;t)texnir3oo1oatrlivi t texm(o3iodoltemfctat srtau ooo1teenifcildfs ea(vpn()texoxrcoydlpDe n olt) exr(m iodalte fvt t)a2umxmoot4tex  fciadfsDulumsnu0alxrio3ia1oa eauvils)s2to(r3nu4lmteliei sfsrtrx pno4apt  ociad s umnvs t4arxnio todlpteln i;() eurxopiodlp elicia( srururpou0alt miciyd sDel(von(0 rtomf3ta1lmDrlivs ()trto(m no1opeelnctl(  2tm(root4olenmfcilsfm uaumo () exrio3oodomtrauvol(0truoimpnydlltnmneilt  2urxmpou4teenmo3tatfm2ul(vs u) eerxrctytfatr neil()t2xrim3io1omeemics tfs2ur(  ;o4tlx ifciydlm2emnvs;u) lxrirciatop raiei t0 rxo(r3iy4om nlfeilt sDtmurpoo1tetomoeiasfmDra(vo;()arxrio ootlatrli i;s) rxrxm3nydop n ivsa(f rtaxrp;o4alxnio3iadlaDrluvp u4 rtnif oytfa eaivs;s0s2xmxm3iy4apee feils aDrr(m ou0tpxo oeiasfsDrl(msnt0 lermr iy1faDeanvo;( tetrio iudap e ivs () rtmx ont0openiieiys a2eln on()alerxo3oadfate ies s0s2toxrpnodlltnlncsa( srta(moot1olt moctas s raump;u) lenif3iodfaD aivslt) 2tr(m3iu4lm n ncsas s2ua( onu4tpenmocilslsDra(vpnt)aleoio3tydlptraivs;t0 2urxr3no1alt lneiltf Draxrp;t0oee ioeias s rm( on(4tetrmr ia1lpDe i olt0setr(m iudole mnvt ( srtrx ono4ope ii3iasls2eau snt0trtnxr iy1om rli i;t0tetr(o no1alte ieiasfsrtaump;u0texoioeiaslaDrlnvpn()tlxoir io1lmt  n o s)t2uoxr3iydlpe  fci ()aDtrumoot4optoifetltfaDrln p;u4altnmo oydfpte nvo t)sexr(mpnu1lpte fcilt)s2raxrpou1opxoiieiaslm el( s () lxnmfcto1omDelnvil(0s2trio3ou4om nmfei t  2rmum ou0tpxniietysfm2emnmp u0trtnxr io1opDraivols  exoio iudomtelncsasfartm(mp;u0apxo o3ildfa2umuvo t4artnif3tadoaDrlu s s  2trxm iy1apee ictasfa2urxr oo1tpt ii3iatla um( p;t0 rtnircto1lptrli i;s t2uo(m3nydlpte ivs s) rtmurpou4tpeomfeiys s emn s (0trtoircio1fa r n ol(0trto(rpno1alen neslsfaDrmxmoot0oltn iciytfs2elumo u0teenif3ty1omtrliesls  rurir nydop  mieiat)srtru ont1tlxo f3ilsfsDea(vp t)trtomr ootopt li sls0 2uriopnudlpt mncsa(fsrraur nt4apeo feild sDuanmonu0texomrciydlm elnvols)seum(mpny1lp emicta(f rtrx  ou4oeeoii3ild a em(ms u)texnio3tatlaD  uvilt)setr(r3iu4apeelncsa()aDtaxr ou0tpxnmoctyd mDelu snt0aeerxfciatlat lnei;(0 2to(r oydolenmivtl() rtm(m ;u1oetomfciad s uan o;u0tetoiocoodlmt auvi s0teumxrpiy4altelfctat a2raumono1teeniieiadfs2ul( p;(0 rxomr3oytlaDr ies (  eumir no4ope mnvi tf rtru o;u1optomocias a ulnmonu4 ltoxo3oadfmD luvo;( teurimpou1ame lnesltfs2urxmpoo0tpxoifciyt sDran p;t0 rerio3oadlmtrlneil(  2tm(rpoy4llenlfcta( arumump;t1tptomieiad sDuan o t0 etnmociydfpDr ieo s0srum(mpoy4lptelicsa()aDuaxmo;u1ope moeilsfs rm(mpnu4 leriociydlpDrlivo t)srtoir nudlmtelictltfaDtau  ;o4oeen feiysfa2emumo (0trtoxo3tatlmtr nvils0s2urio3iu4apt mici tfsDuaumooo4oee if3tydfsDraump;(0 eermr totlm e uei;t0 2xrimpoodole mnctl( srur(r ot4tleoiiciadla2ranmonu0tetrmfcty1lmteai i s)t2xo(rpno1lptn ncilsfarurxrp;o1tpt mfeias sDrau s (4 eenir3todomt lneilt0 etr(m nu4alenmiesat s2uaxmonu1tptnifciyt sDrm( onu0trenmocoydlpt auesls teurio ny1lp nmiesa( a2raxront4oet  ociysfs emn sn(0trenxo3iytfat aneol() 2um(opnudll  lnvslt)srtru  ;o4open i3tldls2rauvpnu4aetrio iodom ran il( s2xmim oy1ll   neiltfs2umxm ;t4alxoif3tas mDum(ms t) lerif3oadla   i i s0setmxr3oy1op   ncsa()sruru pnu0texomo3iad a em(mp u)artrio3tatfmteai o (0 eurxo3iy1al  mfvsl()srtmxrp;t1oex ioetls aDrm(vp;t4altrxr3iydoptrlivils srum(o3oo4olenliviat)srumu  ot0tpxomi3ildfa em( o (4 lxrmf iadla   u o s0s2urxm3ou4am   fei tf 2rmumpnt0tleo f3tld sDrl( pn(4 lxnxrcia1lp elueo s  exoim3iu4aleelfvtl(f Draur ;u1altoioeiat mDrauvs;t) exrxr3oatlmDelnvo ()teuoim iy1lmeemfvsl()a2tmu oou4tpx  o3tatlsDeluvo (4aeenmo ty1fpt aivilt truoxr oo4ol nlnetltfsDtr(  nu0alxnifetldfmDean o t)trxnir iotfpDelivo;(0srxriopoo4optn ivsl()aDuaxrpnu4olxnifeiaslm rm(von(0altrxr3ootfpD aivols t2umir3nu4amen fes (fa2uaurpnu1texoii3tltls rmu p u4tleoxf iatop   u sl(  eurim3iu4am emnvsa()a2rrxm nu0alenifciyd aDra(mpn(4 lxnxo iodfpDe ivilt)sexoxmpiudaptn fctl( arrmxr oo0tlxn ocildls rl(ms t)arxoif3ootlpDe i sl( t2xmim3nydapt mieias) rrau onu4tet io3iytfa rl(mon(4aetnmr iotlmDeliei s)seto(m3iu1apeemfeiasf Drru p;o0oex  ictydfsDumumo u)artrxoctatfm e i i () euo(rpou4omtelnctlsfsrumur no1olto oetyslmDeluvo u4texrio ia1fmteauvi t0 2trxopnydol n fcs ()a2taxmpou1alxoif3ils m ulumont0 lxoxfciy1la ran o;t  2xr(mpnodope mfetl(faDua(r nu1oet  fcildlmDrl( o;(4aleoircoodom   ueo (0trxoirpio4alee fvias)s2rrxr nu4oltnifciadlm2rln sn()teeomf3tytfmDrlu i (0s2umxm io1lltnlfei ()srum(m nu0oeenmo3tls m elnmo (0 lerxrcty1fp  aivo t0s2xmxmpiu1oltemnei s  rtaxmoou4tex  oetyd m2umn s;t0 exoxf3oadfmDeluvi;t) etmimpny4om  mfcta() 2taurpnt4apt iictlt aDulnmp u) rxomf3iytfpDrai i;(0t2xo(o iodll elietl() rtrx p;t4aex mfcilsfs emnmp;t4 lxomr oa1fp r u il(0 rxrimpou1ame lietlt)arrr(rpou0apenmiciasfaDrm(von(4tltnmfcoytomD aivo;s)teurimpnu4ole mivs tfsrtax pot4aptnii3iysfm rm( p u4trermo3to1lp eai o () rxo(o iudop  lnctat  rtr(mo;t4tlxo oetldfsDrln s t) lxnmr3oadfaD lneo (0sruoxm no4amt  ics sfsDraump;u1aeeniieiadfa2ranvp ()tleoxo3oatop raivol(  rxr(mpoudom n fvia()arraxrono4olxomfciltfmDemu sn(4 etomfcty1lmDe ueo;t0seto(m iy1am e nvia( sDtr(mo;u4aptnmfctldlsDemu snu4aetoio3oodfmD  n o;t  rtm(o3nodomt lneil(fs2tr( onu0tptoiociys a2elu on(0trenxr3totla  ln o s) rumxr oo1op nlfesasfsDtmumont4alx ifetasfm emuvo t0trtnxfcoo1fpD lnvo t sexr(r oy4lp  lnvtatfaDrmxront1olt  ietysfs2em(msnu0 eerir iy1faDe nvo;t0trxmim nu1apt  iei t  rtax oou4opxomieiyslsDrau s t0tlermo3tydopDe iei;t) rum(o ny4amtelictas) rtrxmono0alxnioeild mDrau p;t4areoxr3to1fmtr nei;t trtr(m io1omenmnvs (fa2tr(ront1oexoio3ilsla2ea(vsnt4arerirciytfpteauvs;s0trurir3io1lmtnlnesat)s2um(rpou4olt iicildfsDrlu s;u4texrxocty1oatrau s s0 etmxmpoodol  livi tf 2umx poo0tlxomiciytlm ea(mpnu)altomrciydlmD lu o;(0 2urimpoo4lmtnlivi tf 2uau  ;o4openif3iatfa ua(ms u)texomo3oo1fptraues s srurxo3iudlmeemfcsl( arurx pou1ape  feiydlaDrlu p u0teeomfcto1fp eluvilt) etrxrpiydlmt licsas sDurumonu4tpx  o3ils sDrlnmp;u0 exnxo oy1laD an s t0setoiopnu4ol e ncsa(fartm(mpno4tlenii3tat mDeanmp t4 lxoif3iotoa  auvolt trurir3ny4amee fciatfaDtaump;o4aex mfeiatfaDea(mon(0aleomr3iydomDe ivo s0trxo(o3iydlp  mfci ( arrmu poo4apxomf3iyt m2uanvp;(4alenif3tytoat  uei;s)texrio3oy4lltn nvsls)sDtaumoou0oleo o3ilsfm elnvp t0aexoifcoy1la r ieo (0s2uoirpoudam nmfvs t  rumxm ou0oex mfeiadla2uan o;t) eerir tytopDr ueo (0 rumimpoy1am nmnvilt  2rmxroot1apeomf3iatfa2uaump;()altomr ootoptr nvs () exmimpiudlm  livs tfa2umx oou1alenioctldfm2ulu o;(0 eenircootlaD an ol(0 eurxo3oudll n ics (faDtr(mo;t4apxn o3tlsfs2ulumon(4 lxrxf3tytoaD ai slt) etoirpiodapeelivi tfa2urxrp;t0tlt  ociytfmDrmums;(0teenircio1oa  li slt  etr(r no4al emfetls  Dtm(rp;t0tlxniicias s ulu s;u4aetrmr3iy1faDr uvols0 2xoxmpoydlmte feslt  rrru  ot0opxomieiadls ua(vp;t4tltrmr3ootla  ln ils0t2xmxr oy4ll nmies sf 2umu onu4aexoiicildfa rmuvo u0tlerxo iydopDeluvol(0t2tmim3ou1ol e ncsl(  2rru p;u4opx mo3tatfaDra( on()texrmr3oydlmD  ueo ()t2xm(rpiu4lmt  netas s2rru p;u4oetnmfeiltlaDrluvpn()tltoifciy1fmDrluvo (0t2urxmpoy4op nlfetl()aDrr(moou1oet  ieild m2emums (0 leomocio1lateaieol(  2tmim iu4lmee nct t)a2uru  ;u0olen feiad sDumump;u4tltoir oydfmDe nei;s  2xmxopiydal nmfvtatf Drr(mo;o0alxnii3iys s ulnvo;t0tltrmrctadop elnvi (  rtoio3iodapte ici t s2umumoou0oex mfcilsla rl( s;u)arxnxr3tytfptrlnesls  exoxrpiydomtn fetl() Dtm(mp;u4tet  ocias s emnvs;() rxrmrcoo1laDrauvolt s2uo(m3oy1lm n fvils  2trumonu0aex mf3iytfa ul(mpnu0arenmociotoaDrlnvi;(0 rtoxm iudopt mnes s) Dum(rpno4oeeoifctytla eaumo t0 rtnmf3iadfpDe uvi t)sexoimpno1omen nvslt) Dumxroou4tlt  f3ias m2em(ms;u0 ltnmr3iotfaDr uei;()t2urxrpoo1al   netls)srua( p;u0oeeo o3iat m2ua( p;t0aetnmocta1lpD  uesls)t2trxopoo1om  mfvs t sDtaxroot4tpx ifeiat s2el( ont0alermf oodom eaueolt srxrirpiodlpeelnei t  2ur(rp;t0apeomfciasla umnmo;t4 rtniocoadom raiei;s0t2umiopoo4op nmfcta(farrrx o;u0apxnifetydfs ul(vs;(4alxoxo3ootfaD aneo s0 rxoim3iudalenlicta(  2rauroot4apx ifeias aDrlumpn(0tltnmocootfm e u il(0s2uriopnu1amt miesls)srum(m ;t0opx  ieiatlm2emump u)alxnif3oo1lm r nvsls  rurxmpou1lmeelivsasf Dtaum nt1aet ifcilsfsDum( ont) leoif tatlmtrlies;(  2tm(m3no1lmenlnvt s) 2rau  ou1tpto oetas s2ua(vsnu)aeenir iadfaD aieo;t) 2xrir3iudlpen ncia(fsruaxmpnu1apxnmfeilsfa2rmn s t0alxoioctotlmtean s ( truo(o3iydomtnlivs sfartm(rpnt4tee  i3tysls ulnvpnu0alenxo3tydomD an s;(0sexmimpou4opt mnes (  rur(  nu1aexn i3iatlsDua( o t0tetoif to1fmtran ils0t2tmir3iudlmtelfciat  rrrumo;o4oetnmoeiat a raums;(4altrxr ty1omDrluei;( t2xr(r no4lm elfetls  rrr(mono0tleo iciys sDumums;()trxnxf oo1omtraivilt0setm(r oudlp nmiesas  rtru p;u1tet mo3iasfs rl( o u4altoir3ootopt  u i s0s2ur(mpoo4lp   fctl() 2ta(  ;u1aetnmfciadlsDelnvsnt)tleoio3iadfmDrau s (  euoxopoodlle mnvt s) rtmuront4tetnioeias m ea(vo;(0 etrmf ty1fate ueilt0t2tmir oudlm e i
\ No newline at end of file
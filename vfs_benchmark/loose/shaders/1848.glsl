@@ -0,0 +1 @@
+u i ( teur(o3oudlm nmici t a2ra(rp;o4olxoifctatlm uan s;(4aeermociy1lm  an i s srtm(o3oy4lpenlieia()arrrxmont0aexoifctlsfs umnvp;u0 rermr3totlaDrau ils)sexmxmpnu1al n fcs () rtmu pnu1opxnmi3iysls2ra(mp u0trtomo oodoat  uei;(0 eum(rpoo4apee fesls)aDrm(rpnt0apxoiociatfm2ua( p;(0treoxf io1la eluvo (  2xrio nodlpte feil(fs2tmu poo4altoiociatfsDemuvpnt) rtrmr3tydfa e nes (0tetr(r nu1omt  fctl(f Drrxrpno0olx iiciys aDeaums;() rxoiociytfaDrlnvi;( srtoio3iu4lp e fvs t arrr(  nt1ope  o3iasla2ran s u4alxnxo3tytlaDrlnvolt) 2toimpno4amt  fvia(f Durxmont0teeomoeiytfsDea(vpnt0 lxomf3todlmteaivsl(0seurim oo1om emfvia() Drmx pno0oexomoeiad sDel(mpnu) reoxr3tytfpDelu slt trtm(r ou4lltemnesas  Dum(mpou4tpeomfcils sDumnvpn(0aeeomf iodom  livo s srto(r3nudopte ncils s2raxmpnu1apx mfciasla elnmp;u0altnxf3ty1lmDe i slt srtrio io4alenmncsat)s2rrur nt1olx  oeiysfaDemnmo;t0trtniociatoaDraueol(  2xmxr nodale  fetlsfarra(r ot0opt iociys mDumu p () eerxf iytoateau s;s)s2um(m iudap   ies tfa2rrxro;u4alx mi3iys a emump u)trenifcoydfmtelieil(0trto(o oydll emfvt s s2tr( poo4apeo i3ilt aDeanvp u0teeriocoy1fmte uvsl(  rxo(rpoudal e ivslt  2tmx ooo4oetomociydlsDulumpnu)aexrifctotfpt an olt trxr(mpnydll   icsltfsDrrxrooo0oexnif3ild a2ulnvs;t0alenirctytomDelneols s2xmxrpiu4lptemnei (f rraxmp;u1texo fciytfsDrlnvon(4 exnmo3oatopDrauvo s0 eurxo oy4lmt  nes ()artmx p;o0olxnifetydla emuvsnu) exnmf to1lpDelnvs;(0trto(mpnydoleelfct s)sDumxr no1teenmieiydlm um(mo (4 rxnxocoydlm  lueo ( srxr(o iy4ale mncia() Dum(rpno0opxomfeiytlsDrmuvp t)tleomociy1omt aivo;() rxoio io4ol nmivi () rrruront4tlxo ieiatlaDemnmp u4trtrxrcoa1oa elivs (0 2toxr ny4ol nmfcs sf rtrxm nt4ale mociltfs ulumon()tlxrmrcta1lptrauvilt) 2xmio3iu1ap nlicsat)srrru ooo0ope io3tlsla uau ont0 rxrif oytfmtrli i t0srtoxmpnodoltelneslt  2rr( pou4ale ii3tldfs eau o;(0trenio3oa1lmDe i ils texr(o no4amtnlnet t)sDururono4open octat mDrl( s;u0alenmo3iotlmt anvslt) exo(o io4lmeemfvils srrrump;t0tpt  f3iatls2umn on() ltrxrcto1fpte u o s trumir3oudop nlivs tfsrurxmp;o1altomi3tytfm2rau onu4tetoio tydlmteaivs;(0 2tr(m3nu1olenlnesas) Drr( p;u4tpxoif3ildfs umn pn()aexrxf tydfm e i ol()srtoiopiydlp  lnctlt srrrxrpno1tpxomociys s2um( p (4tltrmrcoa1fp e n ils) eumir3nydop   netlsf Durxm ;t1tpenmi3ilslmDulumo;()arxrirctytlpDe uvs;s)t2xoim ny1ll nmfvias)aruax ont1apx mi3ias m uau s ()tltoif3tytoaDr uvo s)t2urxr oo1olt mfctas) 2tm( p;o0aetn o3iltla2elnvo;()aetrif3oo1omtrauei ()t2trir iy1lpenlfet tf rtmumoot0altnmoeiydls ua(vp;u4 rxnmr oodoaD  ivs t srurimpoo1ll  mfetas  Drr(mp;t4teeomociydlsDrlu onu4tetrmociotoatelivsl() 2xo(m3iydale livsa( a2trurp;t4oee mi3iyt aDem(vpnt4tlxnmoctodlpteli i t t2uo(rpou4om elnesasfsDra(mono4tlx  ocildls2em(ms;t4alermr3io1oaDeau o;t  2um(m3nu1apteliviasfsruaum ;u1olen iciytlaDul( p;t0altomr3oydfaDraivilt setmxrpnu4op elfvsatf rua(  no4opx ifciltls eluvs;(4arxoir3oydfmteauvi;s0s2um(mpiy1al e nvils)sDtrxr nu4olxnmo3iytlsDuluvs;t0 eeomo3totfa  ai s ( s2toir3nudoltn nvs ()arum( ono0alx mfeiadla2eaumsnu0trtoxfctydlpDeai i;t  2ur(opnydolee ietls)sDumum ou1tetnifciytfs2em(mp;u0altoircoa1op e ues t0trum(r iu1apenlies sfaDtm(mono1oeen ieilt a eanvpnt)trtnmocoydoa   ies s) 2urxr iodamtnmnes t)a2tmurooo0ole moeils sDrmu o u0trtoircoydlpD auvo;s) 2xoxm io1ap elfcsatfsDtm(ro;u0olx ifeiysls2raumsnt)tetrmf3iytoatrln o;s trxoxopny4olee nvs s)a2um(  oo1ope ifetlt m2uluvp;(4aleoxocto1latelnvi s)srxm(opiu4ap nlieiat  Drrxmpno0tltn oeiatfaDrlu snu)aetomf3iatlaDelieo;s trumio iodamtelfesas)sDrm(rpou1tee mf3iadlaDemnvo;()trtoif3ia1la rlnvo;t)s2umir3oo4op e fesas sDrr( oou4oltnmf3ild s2eanvp;(0altrio3iatoa eauvi;t0t2tm(rpoo4olte fesl()a2umur oo0opxnioeiydfs rln pnu4texomrciodomt ln s (0 2xmiopiy1ll  lncslsfs2rr(m nu4alenmfetyt a uluvp u) lxrxfcta1oa   nvsl(0t2uoiopiy1om elnvi s) rua(m ou4aptn oetls sDeau o ()tetrxf3tydfaDe i s ( s2tmirpiodal   ivt ()s2rmxm ;o4tlx if3iyt sDumn s;(4tetoxr3oadlpt  i o ( trur(opno1lmt  iesat)aDra(m oo4optn o3iltlsDuanvpnt4 rerircoa1la raivo;(0trxr(r iy1optnmfcta(fsDuaxm oo4aex moctadfsDumn o;(4teenmfcootfp rlu i;s) 2umxrpny4olte fcta() Duau o;t0apxn fctydfa2ulumsn(0 eenir oadfpt  n i;t0srurxr oudap emivs t)s2urxmp;t1openmf3tatfa2eln o t4aeeoircto1fmtelues t seumir io1lle mfcsl() rrrumooo0oleo oeildfm2rmnmp;u0 eerxf tatlmDeai i t srxmxr3nu1omenmfcilt)arrmx onu0oeenmoeils a2uau o u4 rxnmf3oo1fp rlues;t0trxrir oo1amtnmnesa( srurumpoo0opxoioctltlm2rmn pnu4tleoxr ootfp   nvi;t0sexm(o3nydomeemfcsas) Drmumpou4oexnio3tatlm2uauvpn(4 rtnmociodopte n ils  ruo(opiudomt  nesat) Dtrx p;u1opxo octydla2ua(vpnu)teenir tatlp ran i t)trurim oy1ap nlivs tfs2ra(mpoo1aptn ieilsla2ulu pn()artomf3io1lmtraueo;t) 2toio3oy4lpte ivsls)sDurur oo0aex  i3tad a2emu s;u4trxrxr3oo1lp elivilt) 2umxrpnu4am n ivtas  2rmxmoou1oexoifeiys m ul(vont4 exomf tadoptr ivsls0trxmxrpoo4olen nesls  2tm( p;u4alxoiocildla em( pnu0 rtnif3oodfa rlnvi;( s2tr(o nydapeelivt s)s2tru o;t0alt io3tad m rl( p u0arermf3tadlptelneo;(0texoxm oy4opte fci (  2rrxr ot4tpt  f3iat aDum(ms;()teenir ta1op raues t)t2xoirpnydoptemnvslsf 2rr(m ;t4apx  f3ilsfs2ea( s t4trxoxo ia1om  lnes t texm(m3ny4lmte iet (  Drrxmono0oexnmfcilslm2rln s u4aleoxo3oodoate ues;() 2trxopoy4lp nmiet s)aruaum ;o1oltnifeiasla rau o;u4trenxo3ia1omD anvo (0 exmxopoy4am elictas) rurxm oo1alxnmieilsls2rl( pn(0aetnircoy1lpDean sls0s2umim3no4am n fcsls)arum(  ;t4texoiietlsfaDemumsnt0alxnio ty1fa  aues t0 exo(o3oo4ap elncsa(f rrruroou1aeeoii3ildlm eauvs ()texrmfciotoat li s s0teumxo3no4om nlieils)aruax  nt4apxn ieiltlmDuluvs;t0aexnxo3oadlmDr ueils  rumxm3oy4ome  fvtl(f Dum( ont1optniociad a2ra(vs;u4 renmf iotomteanvo s seum(m iy1om   nvil(  Drax  nt4aleoifetyd m rmnmp t0aleoxr3ta1oaDrai il(0sexoxm3nydlmeemfet (  2rr( ont0apxn octad s2rl( pn(0 exomr3iytoat aues s0t2umxr3oudlltemfcsl( s2tm( pot0tleomf3iat a em( snt0trxnxo3iy1opD  n o;(0texoir oydomtelnet (fa2ra(mpot1opt mo3iasls2ea( p u4aleoxrcio1op  anvslt sexoxo oo1om eliet sfsDuaxmoou0tpeniictytls2rauvo (4artnircoy1lpD luvi t0t2xrxopio4lm nmfeils) 2tau  ;u4tle ifeiydlmDul(vsn() eerio ia1fa rlues;s)trxrxo ny1omen icsa(faDtm(mont1tpx iictyd sDrauvp;u)altnmfcoo1fa elivs;( setmxo3ou1lptelivta( a2rr(m nt4oltniieiatlm ea(vp;t0trxrxo iodfp elnei t0setoim3ny1opeemfcs t) rtax pou0ape io3iaslm rluvon(4aexoxf ootlmtr ies s0seurxmpiydop nmneilt)sruauroot1tptoii3tytfm ua( snu) lenmr3iodomDelneo;s) 2xo(r iy4ape micsas)sDtmxroou1oleomfciltfs ra(mp (0 etnmr oodomt luesls0setrim no1opt mict ()sDrax  no4tpen o3tysfs rluvp u0 eeoiocoo1fmtran s;()srxoxm3oo1ll nlfvils)aDurumooo0opeoif3ias s rl(msnu4tlxrio3to1fptr ueo t0 2umimpno4aptelncsat srurxr oo0alxo fetydfa rm( pn() rtoxo3oodlat aieols0tetoir no1lle mncslt  rtaxm ;o4ope io3ilsfm2uau pnu4trxomf3iotlatr n i t0t2uoiopiu1lmeeliesat srrrurp;o0altn oeildfs2rm(mp;t4alxrxo3iotfmt lueo;t  etoim iu1lm nlfvs s  rrm(  ;u0olx  ictyd aDem( p;u4 ltrmoctadfatraivo;t0trxr(o3ny4optn ieta() Dumxrpot4oeen ieiytfsDemu s u0tltoxr3iotlmt  ueslt trtr(r iudoptelfeta(f 2ur(moou4tlto feils m2umu s;t) eerif3ty1fat anvi s seumio3nudamtemieil(faruru  ;u1oee iieilsfs2eln o () eeomo3ty1lpteluei;(0s2urim3iodlme  nesa( a2taum ;u0aet iietldfm rlnvo;(4texoxf3oodom e uvs;(0setmxopno4lltemncia( aruau p;u4tltnif3tlt m2uauvs (0 renif3io1lptean s;s) etm(mpou4openliei t s2rrx pno1altn i3ilslmDemnmp;u0 lenmo3iydfpD  i s s sruoxm3oo4omeemivi (  rtm(mo;t4opxn feilsfs umumo u4alxrmo3ootfptr u o;t) eurim iydlmt mnvi s) 2umxmpoo4tlxomiciytlmDrm(ms;()tleomo tydlpD an ol(0 exrirpnodomtn fctlsfaDur(rp;t4ope  ictatfm2ulnmpnt4arerio3iadomtean s;()seurirpny1lpt mfeils)aDra(rpou1opx ifciasla eauvp;u4 eeoxr iytlat aies;s) rxoxo no1alenmnetat)a2rau  nt0tlxnmictyd m rm( s;u4tetrio3oytlpteaieol(0 2trxo iu1amtn icta(  rurxr ;u4optomi3tadlaDeauvo u0treoxr3ia1la raivol(0t2urxo3oudlmt mici s srrax  nt1aptnifciadfaDumuvo (4tlxoirctytla eanes;()srumirpoudam   fvs ( sDraxm ;t0alen ocildfsDelnms ()altoif oy1oaD luei;s0srto(opnu4opeelfeta( aDtmxmoou1oetomf3iys m rm( p (4 rermr3totfaDrlies;t0seuoiopiudom  miciat  rra( o;t0tltnio3iydlaDra(vpn() renxociadfmtr nei s)setmim ou1oltelfeiat)aDta(  nu4ape iieiltla rm(mon(0tlxnxo io1fatean i s trurir3oo1lmenmiviat) rtrx pot1opeomictltlmDul( p (0aleoxfcoo1laDe iei ()srxmir3oo1optemnei s sDrmump;o1tpt  f3tyslsDelums;u4trxnmr iy1om r uvi;(0sexrxo3iy4al nmiciat) rtmumo;u0ale  f3ild mDemu snu4 lerio todfmDran sl()srxmxm nu1ap n ncs t)sDrm(mpnt1opto o3iadfs2em(vp;t4 eenio ia1latrlivs;t)t2xrio nu4lmtemnesl(faDrm( pot0texo octyt m eau snu4 exrxr3oydoat an o;s0trxm(mpny4lme  fet (fs2taxrpnt4tlxn iciasls uanmo (4alxoircio1lpDe uvi s)sruoirpny4alt  fvt sfaDumxrpoo4oeto i3iadlm rauvpn(0arxnir3oydfp rai o;()t2trxrpno1lp  mivilsf 2rm(rpno4tetnii3tas m uau o;(4 exrxociodfmDrlieil()t2toxo nodoptnmnviat)arua(rpnt1optnii3iysls2emu p;t0 etoiociadfm eln i;() rtm(o iu4olt  ivslt s2ta(  ou1aee moetytla umnms u4aexrxr oydfmDeaivo;t s2trxo oodam   fet ( sDrax  nt1tlenioetltfaDul(mo;t4 rtnir3iadlm ran o s  2ur(opoy1openlnet tf rrmu pnt4oex mi3ildfm eanmo;t0arenmr tytfpDrai ols srtoxopno1ap n ics s)a2uaumpoo4optnio3iat a umuvpnu4tlxoxf3iydopte ivil(0seumxm3nu1lmt mivia()a2um(  nt4ope mo3iad aDul( p u0 rxomf3oydop r uvs;s  ruoio3iy4lmt  fvtl(fa2tm( oou0oeen f3iaslsDua(msnt4artnmo ty1opD ai i () rxoxm3iy4ap n ies (faDuax pot0teenmfciat sDuauvo u0 rtnmf to1lp rln il()t2to(r iy1lme mncia(f Dtr(mono1aeeomicils m uau o;(4 lxoiocio1la eaieo;s  rur(rpoy4ap   iet (fsDrmurpou1opt mf3iyt aDumnvont)trermr3ia1lm  aiei t  etr(mpoydomen nvs t)srtm(m oo1alt mi3iatfs ua( snt4trxrmr iatlmtr i o (  2toir3ny4lpe mneta( s2rrxm ou1oexoio3tls mDraump;(4 rermociodlpD  u s s)trto(opiu1optemnet sfs2rrxmpnu0opeo o3iadla rmn pnu4 exoxo oydfaDe u s;t) rxoir3nudop  lfcsa( a2tmu pot4tltoioctlsfs2um(vonu0trerxocoy1oaD lueo s0 eum(rpnudolt mfvsls arrm( pnu1aexn o3tld a rmuvon()tetnmo tatfmDeauvi;s  rtm(r3ou4lp nmfet sf ruaxrpou1teenmo3tlsfs emnvp;u4altnxoctotom elieolt s2tr(opiydaleemfvi ()a2urumpot1apxnioeiltfm rmnmpn(0 rermf oy1lpt lnvs;s)tetmio nu1ll nlfctatf 2umumoot0oet ioeiys s ean o t)treomf oydlaDranvo s0 rxo(m io1lpt  nvsls srurxmoou4tpe  oeiyt s el(vo;(4alerxrcto1faD ai o (0seum(o3iy4lle  ici ( a2umumoot0tlx miciad s umn sn(0aetoxo iatfa raivo;s t2xrxm iy4opee fvi ( artmurpnu0olx mf3iytfs em(vsnu4alxnio iatom r nei () 2xmir3ou1lltn iei s)srraur ;t0tpxnioeiydlaDrl( o u) rtnxo iadoa e ivs ( trxr(mpno1llt mfeiat)arrrxmpoo4oetnmociaslsDelnvp t) rxrxrcoytomDrln s;s)seto(o nu4llt lnes t)aDtau  nu0oetoiociydfm em( s u0treomf oodla e i olt0 eurim ny4lptnmnctl()s2ra(moot1olxomicils sDeanvo;t4trtrircoatopDr nes;s sexm(mpiu1ol e fvias)sDraum ou4olxoioeiad aDrlu o (4 etnmrciatfpt  neils0seumim oo4ol  lfvtl(f rrax ono4tpxnii3iat m emuvpn(4 rxrifciodlpD  nvs;s0 2uoxo3ny1lptelivsl(f rumxmp;o1oleomieilslm elnmpnu0tetomr3ta1oaDrln sls0trtmxo3nu4lleemfvtls a2ua(monu1oee  ieiadls el( s () lxoxfcoy1fm elnei t)s2uoxopiu1olteliesltfs2raur no1alxnmieiatfa2el(mp (4 eenir tadoat ai s ( teumxrpou4omtnlfes () Dtmx ont4aeto fciatfa uaumon(4alxnir3iodom rau il()s2trim oydap nlicsl(f rtr(rpnt0oex ifeiydlm2uauvsnu4tetrmr3oo1lpDranei;t0s2ur(mpiudomtn nctat srrmumoot1ape micias m um(vonu4tltomrcoo1om rlueo t)trxrxo3iydam   ieil() rumur nt4oexniiciaslm umu ont0alxrxf io1lmD  iei;t t2toxopnu4om elfvsl( sDum(r ou0tlt  o3iys a uaumont)tlenif3oadfmDrau i t  etm(o nudaptemnct sfaDrau o;u0optnio3iyt a em(vs;t)arxrmocoo1oaDrau sl(  rtmiopiudlmenlfct tfartmu  nt4apx  feiytfs ulnms t0aetoxr3to1oa r ivi;s0 rumirpoo1om nmfvta( s2ta(  oo1tlxoii3iytfs2rmumonu4tleomf3to1oaDeauvils0sexoir3nudopenmnct sf rtmx  ;t1aeenmoetad m2elump t0tlxnmrciy1fmtr ieo;s0trtm(m3iudlm nmiesltf 2taxmp;o0ale iociatls uan s (0aexrmf3to1fmt anvi;t) exrim io4lle  nvsa(  rumur ;t1texoiieilsls rln s t) rtrmf iotfptr ieo;s0t2xmio3nu4ome lnvsa( sDua(  nu4aleomoctaslsDrmuvon(4tetomf3oydfm e i i;s) 2uo(o oudlm  mivtatfsruaxmp;u4opx ioeias s2rmumo;t)trenif3oodfat ai ol(0 rxrxo nydamte fci sf rua(rp;u0ope iociadfm rlnmo;t0 renmf3iatfatrlnvi;s)texm(r iy1amtelfes t  Dtm(  nt1apeoifeiyd m eln o;u4tlxomr oytoateln o s s2xmxm3oo1optn ies (faDtax  oo1tpe io3ildls el(mo u4 exoiocio1lpD lneo () rtm(o3iodlmeelnciat) rrmxm ;o4tpt ioctys m eluvo;u4 eenir oa1fa   n o;t0seumir3iy1olenmfet s) 2raxrp;t1tlxoio3iydla umnvs;t) rtoxfcoa1omt aueslt0srtmir nu1alenlieta(f 2uaxrpnt1tetomieiyd aDuau p t4 reoxocoo1fpteaieil( srxo(o3nodom e ivtltfsruaxmo;u4olx  i3iyd mDemnvpnt0altrioctytomteaueo t seurim3nu1ap nmncs (  rrru  ot0olto ociyslm ul( on() rermfcoatlaD anei;s) 2tmir iy1lltn feslt)srrmxm ;o4tet  f3iat m ul( ont0artrifciydfpt anvs s)texo(o3io4llenmfeia(faDtaxmpou0alx ii3iad aDemums u4 etoif tadom rluvo t0teuoirpnudlptnlneias)s2rrx p;u4tetoioeiasfa2ranvo t4 renmf3iytlm  an i;s) rxo(r3nu1am emnvi t)sDumx  ou0oltnmiciat m2ea(mpn(4 rerif3iatom elieo (0 2urio no1am emivi tfs2rrx  ;t4aex  f3tadls2uanvs t4aetoxrcta1fat aiei () rtm(m io1opte fvtas)s2uaxm no1tpe io3tyd aDean o;()alxomrctatlpte nvi;t) 2toxopnudom emnvi t)aDra(  ou1aexomietydfm rluvs t4trenmociytla e ueolt) 2xo(r3ou1al eliviltfarrrx pnu4tee  f3ils sDemnvo u4 rtoxr3oytfa r u s;t0s2xoir3nydlltn fci (f Dumuront1tltniociltlaDra( s;u) eenmociadla r ueo s) 2tr(r3oodlltemnet ()aDrmxrp;u0aetniiciat aDem(vont4 rermocio1lp  lieolt truo(o3oy1altemivt (  Dur(m ot1apenmo3iltls ul(vo;(0tlxnir oytfpDelu ilt0texrxo iy4ole mivs t a2rrur nu1tpxnmfeiltlm ua( p t4tleoxoctatlm r neol()srumimpoydapt lneslt) Dtrxrpnu1tlenmo3iatfm ulnvs t0teeoxf3oydfmD  n i (0tetoxo iy1lltemicsls  ruru pno4alxomfetyslmDuau s;(0aetrxr oodfaD an i;s)trtmio3oydlptemnctat)s2uaumoou4optn octltls2um( s t)aexoircio1lmt liei;( seuoir nudalt  nciltf rtru pou0opto f3iydls eanvs t)trtnmf iadfat luvo;t0trxo(r3nudaptelivias sDtrur ;o1optnmoctyd s rlu s u) exnxr ia1lptrluei;s srurimpiy4lm  lnesls)arta(m nt4tee ii3tat aDrm( ont4 eenir iytlpteaieslt t2ur(r iu1am  mfcsatfaruax  no4aet ii3iys aDuan p u0 exnmo3to1fmtr ues ()t2umxmpno4lp emfct s)s2rm(rp;t0apxomf3ils a ea(vp;t0aleomr3iadopDr n ilt)trum(opiodlpe liei t  2trumpou1tetoif3tlt s2ul( o (0aetoxf3iytlm eai il()t2toxr3iy1llenlnei sfartr( p;o4olt mieils s ulnvs;(0 eenmo3tatlp elnvo s0srto(opny1alte nci t)s2rmx  ou0aee mictatfs2uan sn(4 eeoxo3ootomte nvils trxrio3oy1lm n feiasf rrax pot4opx  o3iyslm2ua(ms u4trtrmf tydoaDe ieo s0 rxoxo3io1al e neias sDtmurono4tle iictysfa2uanmpnt)aeenmo3oatfaD auei t)texoxo iu4op n iviltfartr(rp;t1tetniociasfs2emumsn(4aetnxf3todlpteluvs;(  eur(opny4oltnmfvsas srrru  ou4opt iicils m elnvsnt) lxomr tydoatranvsls) etrxr oudllenmieiat)srtmu o;o4teeo feild m2raums ()areoxr3oytlp ran o ( sexmim3oo1lptnmict ()sDrr(m no1tpx  ictatfa2el(vpnu) rxrio3oadom   ueo (0sexr(mpnu1al emfci ( sDuaum ;t1tpxomietldfm2eaumpnt0aetnif3totom rlu i;(0teuo(mpnydam   fet s)aDuaxrpnt0oeeo o3iydla ul(mo t4 ltrmocia1lmDr ivs s sexr(r3io4om elivtas)arumumpnt0oee moctadfsDrlnvs t) lenir3oadla  livi t0 2tr(m oo4alenmneiatf 2um( o;u1oltnioeiad s2rm(vo;u4trtrio3iydlmDeanvi (0truo(o nodap emfvtas)srtr(m nu1alxnmieias a uanms;(4 eeoxf oytomtr n s;s) 2xo(rpou4ol n ivtat)aDurumpou4tetomoeildlaDulnmsnt4tltnmr3iatlmDrau o s)sruo(rpoudole lnvs tfsrurxr ;o4apxnmictldfs rmnvo;u4 renircta1oat  nvs s)trtrio3ny4op elnci ()sDrrxrp;t1tleniociysls rl( s u0arermo iydlm  au s t) exr(o ny1lpt  ieil() 2tr(r ot1aetnif3iytfm rmu p u0 ltnxo oodomDe ivi;t0t2urim3io4llen fcs ()sDumxront0apt  octat sDrluvp;t0tleoxo3iy1lmDe uvi (0 2uoiopnu4optnmfvslt a2taxm ot4olt ioeiys sDrl(vs t4 lxrir iytfpD au sl(0 2xr(opiodam  mncsas)a2uaumono0oetomictlsla el(mp;u)tlxoifcio1laD an s t srtr(mpoy4lm elnct () 2tm(monu0ale ifeiadfmDuanvs (0tlxriociadfatrln s (0s2xrio ny1altemfvs sfa2urxmp;u1aeeniietyd m umn s;u0aexrmr oo1omDean o;()s2xmxo3iu4ome  icsasfa2rrxm nt0opxo f3iytls2rm(vp t)trxrxr iodomtr ivols sexrim3iydlmeelict tfarurxmp;t1oex  o3iat mDranvpnu0altoxo iodfpD  ivslt)tetmxm3oudllt lnei () rrmxr nt1tpeoiociys aDeaumpnu) leomr oatfm e ieo s  rxrxmpny4lp   ieilt)artrxmo;o4teto i3iadls2rmnmsn(0texnmocoytom   u il(0trumxm nudlmtemfciltfaDtmxr ;t1oltnifciadfa umn p;()trerir iydlpDeaneo t0setoim3iodll  lieil()s2rmxrono4aleomieilsfm2emn o u0teeoio ty1fp e n s;(  2xmim3oydlp emnei s) rta(  ;t1apen oeild s rl(mo u)aeeomf3iy1lm r ues t)teuoimpiudol  mfet tf rrrx  oo4tpx mieiyt a2rmu p;(0 renmrcoydlmtelu sl( srxmir3iodlpe  ivt (faDrm(  no0alt iociat m2rlumo u4 rtrir3tytfmDe i ils  ruoio iydalee nvtas)s2tmx p;u0oexniieilt s2emnvonu0tetrxociytfmteln slt)texr(m3iodom elncsas s2rrum no1alxoifeils m2uan s;u4teenif ia1optrlneo;(0sexr(r3iydlpt mfvta(  ruaum ;o0aexoifctadfmDumu p;(0 rxnir tatfpDe uvs s) euoio nu4lpte netl(faDumu o;u0tlx iictadlaDean pnt4trenmr3oa1fp rauei s)srtmimpiydllte icil(fsrtaumpnu1oet  o3iysla rm(mo;u4artnmr oadopDeanvi t t2xmxopnu1lmtelfvia( srtm(mpoo4teeomoeiysls2uan p u)trermr3totop raiei;s  rtmxr3oo1lmtnliesa()srrru pnu1alx mieiyd s eaumo t4trxnmf ootla e ies t0 eumxmpoo4llee nctat  2ururooo1oltniietasfs2uau o;(4 leomociodfp  lieo;(0t2urxopiodom  micsa() Dtrx o;u1oex mfeils s2rluvp;()trxomo ia1fa r nesls0t2xrxr3ou4ape lfvtl(fa2tmum ;t4opeo o3ils s2rauvpnt4teerxo3oy1oa e nvol()texoxrpou4ameemfvta(  ruax  ;t1oexomfetydls ean onu)tlerir tadlmDraneilt seumxr oudalenmfesas)sDrm(  no1aptnioetytfsDelu onu4alxnxfcoatom e i olt0srxoxrpoy1optelfvsls arururp;u4opt  f3iytlsDuan pn(0trxrmf tadlpt  ieo;s)srxo(opnu4lpe mnvt ( sDrm( oou0olen o3iydlsDemumo t4aexrio3iatfptrlnvolt srumxmpno1amt  neta( aDrr(r nu1oeeomi3iydlaDrlnvpnt0artrmr3oydfa r uvols0texmxopiodlp elnvtat arrmxm no4oexnifeildfaDelu p u) etnmo tadoa eluvsl( t2xmirpno1ap emfctas) Dtmumoou1optnioeiasfmDelnvs;()aexoxocoy1fatrlueslt trxmxr oudllt  netltfarrr(moot4aptomi3iytfs2rluvp (0tlxrxr3io1om  lneo t0 etrxr nu4om n fcs s  rrau  ou1apx ioeiyd sDuln pn(4 exoir oy1oaDelneo s) 2um(rpny1om   fcsa( sDrax  nu0apt mo3tadls2emuvsnt)tleoxocootlpDraneo t0t2xmio3oudlpt  fetas)srtrx o;o0tet mieiytlsDranmon(4teenio ty1lm  auvi (0setm(o iudal  mfcslsf rta(mp;o1ope  oetlsls emnvp u)tlxrir3iotfat  uvi;s)trtr(o3iy4oleeliei (  Drm(m ou0alto ieilt m2rmnvo (0teeoir io1lptran i (0t2uoxr3ny1lpe  nvi tfarrr(  oo4tleomo3iad s raums;(0 rtnmo3todoat  n s s) eurio3oo1ol   ieia(f 2taxm ;o1olt mfetatla2eau o;u)treoio3iotoaD lnvslt)t2uo(o no4al nmfei tfartru o;o0aeeoiictatlm elnmo;u4tlerxfciatfptr ivs;t0setmxm3nodol   neslt  rurxm ;u1aexoiieild a2ra(ms;(0arenxf3iotlpDr u i;(0s2uo(o oy4ale mfvs s)arraumpot4apx ifcils m2rlnvp () lerio3oa1fmDelneo t  exoxr oydlltnmici ( arrr( onu4alen ieiyt a ua( p;u0arerioctytop e u s ()t2uoxm3oo1llen fcils sDrrum ;t0oleomi3iytlmDem(vp;u)aexnmocta1fm e uesl()trumir3io1al nlfei s) Dumxro;o4oeto oeiltla uln pnu4 rtoio3oa1oateln i;s0t2tm(opnudam e fvtl(fs2tru poo0tptnmfetadfs ul( s;u) lerio3to1lateaivils0seuoio iu4ol  liei t)s2tm(rp;u0teeo i3iasfaDra(mon(4trtomoctatla eluei t  2tmxrpnu4llenlics t) 2uru o;t4ape  f3tatlm2ran s () ltoio3tatopt  ivol()seuo(m3io1ll e icia(faDtru pot4ale  iciat m2ea(vsnu)artnxf iodlaDe u o;t0trxoxm nodlp elnet tfs2raxmoot0teto ictadfmDul(vpnt4 eerif3ootfa r uvs;s sexm(mpny4am n nei t) rumx pot4opxo octltfa eaumsn(0teeoxrcto1oaD auei;s  eum(mpoydlmtnmneslt aDumxm oo0olen oetat aDemu s;u0artnmo oatlat luei;s  2umxr nu4ol  lnviltf 2taxmp;t0tee ioeiat m el(vs u)altoxf3oydlatrauvs s0sexrio3ny4ll e fcs ()arrmx oot1oetomfciat a2umnmsnt)alxrxfctydom   n s;t teuo(m oy1al  lnvs s  2rmxm ;o4tltoiociasfm uan s (4 reomfciadlaDrli ols0srur(m oo4am  lfcia(fsDum(r nu4oet ifcildfaDumn snu4aexoxr3oydfatrai s;s)s2umirpnodlmt  ncsl( aDur(m ;u1opto fetydls elnvs;t)artrmr io1fm eli o s  2toio3iydolt  ics t arrm( ono1oetomf3iyt s2ul(vsnu0 eeoio ia1laD  uvi t)tetrxm oo1ol emneta( s2rr(  no1oeeomociasfs um(mo;u)aexoxociotom   nei s0s2ur(r nodlp  licil(f rtau ono4ole  ictyslmDelumo;t4texnir3tydlat  ivi;s seuo(opny1ol emicsl(faDtrxmont0opxnifeilsla2ea(vo;(0alxrif3tadfm  liei;s teumir3ny1ome mfciasfa2umx o;u0aeenmfcils m2emnvs;(4altomo3iodfp  lu s;(0trxoir3io1om e fcsas) rrmur ;o1olxoif3ildfm2em( s u0tetrmocto1fpDe nei;s) rxr(r3oudol e ivilsfsDtmumpou0tlxo f3tlsls uanvonu) exrif3oadopD  uei t  rur(r oydlpt  fet sfsDuru  ;u4tex ifetltfa2rau pnu4 exnmf3iytla rlnvsls seto(m iudlltn netasf 2tr(r nu1aet  fciyt sDrlnmp t) rerirciytoa  lneslt truoim nydlmtemfcsas artr(moot0tlxoii3iad mDrln snu4altrmfciatfptr u i s) etrio oudllt mieil(fsrtmumoou4aetn fetltfaDuan ont)altnxo3tadlpteaiei (0teurxm3iu1lltn ieiltfaDuaxm ou4tet  oetldfsDrmnmon()aetoir3iadom eln o ( s2tmxm3nudlmt mneilt sDtmx o;t4tlx  fetadla2el( on(0altrxocoodoaDeaies s) rxr(o3iodlmtemneilt srum( oot0tlenio3ildfaDranmon()arxrxo totopD lieilt0 2urim oy4llt mnvtls a2urx pnu0aee ii3ils mDumn o u4trxnmr iydfm e u s () rtoxo iydlmtnmicilsfsDrm(mp;o0tleomo3tydfs rm( snt0tleniociy1lmDe n o;t)t2tmxmpiodlpenlnviasfa2tmx  nu4tleniiciasfm2rm( sn()artrmf oadoatraneols)s2xoir3iodoptnmncs tf 2uru  oo4aex ifctyd sDemnvp;u) rxnio iytlpt lneo t  2xo(mpiu4lpeelnvtas  Dumxront1alx mictlslm2raums;()arxoxocootlmt luvi s0 rtmirpoodape lnei ()aDraxr nt1tltoiociadfs2uan p u4altoxo tatfm  lu i (0 rxrirpoy1alt liesl(  rtm(rp;u1oexomo3iadls2emums t4 lermo3tadfp e uesl(  2xr(o3iydlmt mnvsas artmu pnt1aptnmo3tltlmDran p;u4 rxoxocta1omtrlu ils srxmio nodlle mncils  rtax pnu4aetnioctlt a ean s t)alxrmociatlp e uei t)s2tmxopnu1al elnvt ()s2tmxr ot1ale mietydla2ua(mp t4trxomo3ootoa   uvi;()trxoim3iudamt mivt (fsrur( p;o4tpe  iciatlm2um(mp t)tlerxo3iotfm r ivsls0trxoir oo1ome mivs s)sDraumono4alxn octad s uluvsn(4 rxnir oytlmDeaues;s0seuoimpio4omtn ics ( srraur nu4tetoif3tls s2rlu pnt)tetrirciotfa elneo;(0s2to(m3nydaptn ici tfs2tru o;o4oleoifeiysfsDrmuvp (0tlxnxo3to1lm  aueols t2xr(r3ou4alte fvilt) 2tmx oou0aexomociys mDel(vs (4 rxnmo iy1opDelies;s0s2toxo oy4olte fetl()srumuro;u4alxnifetldlm el( o (0tetrif3oydlp elu il(  2xmimpno1lmee fcia(  Dtax onu1oee if3iad aDelnmpn(0tlxrmr oydfa e uvil( setrxo3iy4lm n fvilt)s2uru ooo1oex moeiasfs rl(vo (0 rermf iy1fp  luvi;()setmxr oo1lm elfetls srtmurpoo4apeomieiad s elu o () rxnmrcto1faDr ueilt  etoxm ny1ll n iesa(  Dra(rp;o0tle ioeiad aDuaums;()altomo3oodomtr uei;()trtrxo3oo1aptelfesatf 2ta(m ;u1tle io3ilsla ul(mon()texrmf3iotfaDrau sls0t2xmim3ou1ap  lnei s sDur( o;t4aetnif3iadlm2ua(mpnu) etoiociadlptrlnvo t0 rurxmpoy4ame  nci s  2tru ooo0oltnio3iasla2ua( snu)tlenmrctatlaDrln sl( seuoxr3oy4amenlieilt)srrru ono4optnmfeils s ul(vs;(0treoxo3oodomDrlies s)trtoxo oudap n nei ()a2urxmpnt4tptnifctatfs2umuvp;u0altoif3oydoat  ivi s0 rtr(m3nydaptnmneslsfsrrmu ont4aexoif3iatfa2eaumsnu0tltomrcty1fmteaues;s s2trxmpiy4aleemneils) 2tmumonu4oetomieiat a2eanmp u4arermrcoytopteai s;(  rtmxm3iu4ap  mictls)aDrrum ;t4tpe ioeiadlm ua(mpnu) etrxrciadlm r u i (0 etoir iydlm n ivslsfaDrr(rpou4alt  f3iltlmDranmo;t4 lxrifcta1lptr u i;( teurio3iy1llenmneilsfs2trx  nt0aexoii3tld a2umuvs u4 etnxr3oydfa raivils0texrimpiu1om nmfctl(f rta(mo;u1opx  ocild s ulump ()texomr tytlm raueil( sexrim3iydll nmnetlsfaDurum nu4ale ifciat s ea( ont)aexnio tydfa   iei t  euo(m3io1al   ivs sfsDtax o;o0oex mieildlaDeaump t0alxomfciotla   nvo;()s2urir nu1lmeelnvs ()srurx oot4optnifciyd a em(vs;u4tetnioctadfat  u s;t)srtr(r3io4alte ncs ( aDuaxr ;o4tlt micilsfs2rlnmsn()tlenifctadfaD auvo s teuo(rpio4lle lfes tfs2raxmpno1oltn ociytfm elumon(4trtnmfciadfpD  ieo s0setoxm3oudoltnmict t)a2tmxr nt1oex ioctyd a2eanmp t4texoio3oadfmD an s (0trtoxr ou1am elieslt)sDtrxmont1texn ictytfaDrlu pn(0 etnxrcootlmt aiei (0srxoxo iu4aptelfvsasf Dtrxrp;t4aex  ociltlaDranvon() lxoif oadlmD  neil() exo(o io1amtelfvsat)sDrm( ont4aetn oeiytlmDem(ms t)trxoif3iydlaDrau olt)t2uoxr oo1opt mnvs s a2ua(r nt4texnmfctad s el(monu)arenxfcia1fmDraivolt0texm(r oudapen ies s)arta(rpnu4tlt iictytfsDua( pn(0aexrxo3io1fm e ivi s0seuoir3io1oltelfvias) 2trum no0aleniietaslsDrm(mp u0aeerio3totlp e n ils0teumxopiy1om nlnctat a2tmx ono1tetoioctldla emnms;()trtnir iotfmte nvi t0setmxmpou4ole mfctltfaDuaxrpoo1tlenif3iltfm2rlu p () etnxo iodomD  ueol()s2xoim ny4oltn nes tfsDurumono4tptomfctaslm elnvo;(0aeenxr3to1oaDr nvo;(0 2xoio3iy4alen fetl()aDumum nu1apt ifciyslm emn p u4alxrif3iydlatrlivils0s2xr(m io1omtemivil() Dra(rono1altomoeilslsDea( s u4aetoio3oodoaD aieo;t0seuoim ou1ll  mnvtlt  Duax p;o0opx  i3tld aDrm( pnt)alerxrciadfpD an s;s trtrxopnudaptnmfcs t  2raxr ou0aex ioctlslm ua(msnu4 ltnxf oodfpDean s;(  2toio3ny4lmt micsatfsDtaump;u1opt  fcilsls elump;u4 rtrxr ta1lptranvs;(  exrirpny1oltn ncsl()a2tmx poo0tle  oetydfs elnmpn() lxnmo tadoptrluvs s0s2xrxmpoo1aptnlnvi ( srtru  ;t1oltn feiys aDulu p (4 lenmf ia1lm rluvo;() 2trxm3oydll  micsasfaDrr( oou0oexoiocilt aDrmu ont0 ltoirciy1omDe n o t) 2xrxr3nudop e nvsa( sDraxrp;u4ole mfciatlmDrlums t) etrxr3iadomD  ueo;()trumxo iy4amt lictat)sDum(m no0tpeo fciasfa2rmnvsnt4 reoxrcoadoaD lu il(0t2to(o nu4ame mncs t  rumu  nt4ale mi3iad mDrauvo;() rxnio3oo1fmte uvi;()trtm(opou4lp   ies sf rtm(  oo0openmfciadfa rm(mp () eeomr3oadoa ran slt0 2xm(rpnodlltelneta(faDta(rpot4tpxo oeildla eauvont0tlenio3tytfmDr uesl() 2xrxopiodamenmneia( sDtaur oo4apxn ociadla em(msnu)aetrmocty1lp  au o;s0setriopiy4op e ietl( aDta(rp;t1tptoif3tatlm2ran snt0 exnmo3tytla  lieolt0 eum(r oydamen nvil()a2rmum ;u4aleomfcildls2eanmp;t0texomociadla eln s;s)trumxm oo4omeelfetltfs2ur(m nu1optomfetydfm ea(ms;t0 lxrirctotopD ai i;s0 etr(o3nu1opeemivtls)a2uax p;t1apeoiiciytfa uan pn(0 eeriocty1oa rlnesls)trtrxr nydlmt lnei s)a2rm(r ot1olxn icildfs ean onu0altnxo oydopDr i i;t)s2trxo oudll  mnvsatfsDuaxm nt4olxoifctadlm eau p;u4teeoxrcoodlpDran s;s)srxrxo nu1ll n nei (  2um(mo;o0optoiociys a2ra(vs t0aeenmf oodfptrai o;s)trtm(rpnodapeelfcia(faDrrxmp;o0aexniociatlm uanvo;u0texoxf3ta1omt  i ilt  2tm(r nu1omtelictat)arraur nu0ope  o3ilt s2ran o t4trtrxf oatla   nvol(0 euoxmpny4ol  lies t)sDrm(m ;o1apeo ictldls el(msnt0arerxo3iatlaDe uvo s0s2tmxr3oo4olen ictat aDrmxront1aet  i3iydfa2rm(vs;(0tetoif3tatfa e uvils0t2tr(r iodop   nvt (f Drrxm ou0aetnmfeiasfs ulu p;()alxoircoatlm ranvs;t0 2umxo nodlpenmncsl()a2tr( oou4tlx mf3iysla ua(vpn(4arxrmo oo1op  livi;s)seum(r3iy1ope lnviltfsDtmurpnt1opx  fetytls2eauvont0 lenxrcoo1faD au s;s)teum(o nu4lmenmivsls srrau  nu0oet mf3iatfsDrau s;u4tltomo iadomDrluvo;t) eumxr3oo4olen iesl(fsrrm(m oo1apxnmociltlsDumn p () leoif io1omDeai ol()s2umxmpno1aptnlnvt ()sDrmurpnt4aptnmf3tatlaDeluvp;u4 eenxociotomD livo;(0 exoxm3ou1olen iesl(fa2tm( oot0apx  ietltfm ul( pnu0areniocoytfm raieolt) 2xm(mpoo1lptnmicsa()srra(rono0apenmi3tls s emuvsn(4trerxo to1fp rlnvsls)trtr(rpnydlpe mici t  rrm(rp;u0tlt ioctasfm2rl(vont0aeenmo iydom eauvo s)sexo(mpiy1lpt  nci (  Drmurp;o0optnmfeias m2em(mo t0arxnmo3oy1lmte n ilt srxrim ny1lme mncsltfsrur(  no0alx  fetyt a ea(msnt4 ltrmoctodlpteaies s)srtr(opiudlltelictas)sDrmxm nt1apto f3iadlaDum(vp t0 ltrxrcootoatrliei;t)texmio3iydape lnvs tfsDrmumpnu1opxo fciys mDrmn p (4trtoirctytfmtrau ilt  eurxo iodapenlfci t)aruaum ;u0ole  feiltlm2emn p u)tlerxr oytlmD  uvilt0 2xrim3io1llt lfvias)aDrmu  ou4olx ioctldfa2uluvsnt4alerxo3iytfatelieils  2xoxo3iu4lmt mivtas  Drr(  ;u1texo ietldlm2rlnmon(4alenmf3tytlpDeaieolt) rxmir3oudap   fcia(f rtm(m oo4alenmoetyslm emn p;(4altnmociydfm eauvs;s0 etrir3ou4lptemicsl(fsrtm(rpnt0tlt mfciys s em(mp t)tetnif iodfa eaueils0 2urxo nu1om  lfcsat) rur( pou1tltomicilt m rmuvp t0tetrxo3oy1fp   u ilt) rto(r3iodomtn nesat aDua(rpnu1teenmf3ild m rlnvs;t0 rtrxrcty1faDeauvslt)tetmir iydlmte nesl(  Dtaum ;u0oleomi3iyd m ua( s (0tlxrmf ta1fmteaueo s t2xrxm3ny1ope livtls aDta( o;o0tetomfetatfa um( onu)altrio ootla   nvo;( s2trir oo4llen fcils  2um( p;t0alx  fctltfaDem(mo t4trxomo todomt  uesl()t2trxm oudaptelnesl() rtmxroou0alto fciydfmDel( p;(4aetomr3iadlptraieils0teurio3nu1alen ict sfarrr(r ;u1aleoif3ilt m2rmuvo t0 etnmr3tatoat ln i ()s2tmir3ou4om  mnvilt)srta(r ;u0oet mfetlt a ea( o u)aeenxrcoadla rln i t  rur(m oodlme mietl(fsrrr(ront0olxomieiltlm emump;t4aeenir oo1lat  uei (0srxmiopiydoptnlfei t arra(r nt4open octlsfa ranmp u0alxnif iotlp  anes;s tetrxo nodlpenmncsat  Dtaxront4ope ifctysfa rmnmo t4teenirctatlm e u sls) rtmxo3iu4lltnlnctl( sDtmxro;o4tptniiciydlaDuauvs;u4 lxnxo io1fp r uvs;t srxoxmpoo1lpee fetl()sDrrump;u4tleniieiadlm2uluvont0 rxrio3iotomDr nvs;t0s2tm(mpiu4olt  fcs ()a2uaxr nt0teen ociys m2ul(ms;u)aetoif tytlmDe u s;t0seuoirpio4lm  lnesl()sDtmxrpot0apxoif3iatfsDuaums;u)trerif3oy1lp   ieo (  rxo(o3nudlmtnmfcs sf Dua(  ou4olx moeiydfa2um(vs (4tlerir3iatlatr ivs;()srto(opio4al n fvsls sDrmxm ot4tle if3tadfmDrmn on(4 exnmf oydop  aies;s sexoxo ny1am nlfvtas)a2uax pno0ole  feiys mDemn p t) eeomo oo1faDrlneolt0s2um(m3ny1lle mivtls aDua(rpnu4oetoioeild m ran p;(0 rtrxo ty1omte ivo s) 2tmimpnodome  nvtl( artmu  oo0texnio3ilsla2um(vo t)tltoxo oy1lp eln ilt0 eurxr iodoltn nvsas sDrmuronu0apx mfctas a2eauvp () renif3ia1fat auvs s  rtmxr iy4alenmnvils  2raur no4tee mietltfm uluvon(4tleomfctodfpt anvi;( seurxr3oudllt mfetat  Dum(rp;o0optnmoetltla2emu onu) exnif todfpDelnei (0seumxm3nudale mnctls  2raxrpno0tpto ictydfm2ulnvp (0altrircoo1lpDrlivs t0 rxo(m3iy1apt lieil() 2uaxr nu0alxn iciytls ranmo (4teerxrciydlp  li s s) 2toxmpiodamte netlsfa2rmxrp;t0olenii3iysfm emu p;t0texoxo3tytoaDran sl()trto(mpio1olt  fct sfs2rrur oo1apx  i3iydfaDra( o;(4 leoxf3oatlp eaies t)srumio ou1apt  ivi t)sruax p;u0tex iietyd sDean p;()aleomf ta1fm rlnvils0teurxo3iy1altemfesl(  Draxmpnt4opxn f3tad sDumuvp;(4tlerif3iatfptrlies;t)setoxm3ny1lmenmivs tfsrtau  ot4apenioeiaslm2ua(mo t)alxrir3oodla eli slt)t2xrxm3iydapte fvtl( sruax  nt0oet moeiytlaDumu o u4trtomf3todfmteln ol(  2uo(m3ou4apeemivi ( srrm(m nu0tleo fcilsls rmu p t4altrxociotfa rlneol(0s2umiopiydap   fctlt aDrrxro;t1tpt mo3iyt mDul(mo (4trxomfctatlmtr ivi;( trxoxopiydapeemnciat  2trum oo4oexomocildlsDel(mo;(4arenxr oadfm r iei (0trxo(o iy1lpenmnes (fsDuauro;t4tpenmf3iyd aDua(von(4artnmo iydomtr ueils) rum(r3iy4llt livi sfarumxmonu0apt  fetadfaDemn onu0 etrmr3iadlpDraivilt0 rur(r3no1om emnviat a2rrxr ;o1olxo feils mDua(vs u0tetrirctadomDe neils t2xm(rpny4lp  mncslt  2tm( pou1tpxo feiadla um(vpnu4aexrio oydlpDe nes;t0trtr(opoo4olenliciasfsDuau  nu4tlt mi3iyt m ulu o;t4trtrxr3oadom ranvs;s s2xm(r3no1lmeelicslt)a2rru ono4tlx  oetytfa2ranmo;(0 exoirciy1om eaivilt texr(opnodome mivtat sDtrum oo1alto oeildla um( o u4 etniocoydlpteli ols0 rxo(m nydom elfes ()sruaxmo;o1tetoif3iatlm2uanmo;u4trerxf3iytfa r ivo (0texoxo3nudlpeelies sf Durx oot4aexo fetldlmDem( p t0trtrmrcoadlpteli slt)tetriopiudapt  nvilt aDrrxm ;o0tlt mfctat m emums;t)aeerxociydlpDranvslt trtrxo3oy1am  lnct sf Drm(m ;u0aee mfciysls um( s;t4 exrif3iatlmDr neols) etm(m oodomt lieia(farta(r ;o0apeomoeiad a uanmpnu4tetoxf tatlmDrauei t s2toxo3iy4al elneil() 2ra(m ou4tleo iciadlm2rm(mo;t)tltnifcio1fa e nvo;s0s2xo(o3iydomt mies sfarua(  ot0aeenif3iyt m2uluvsnt4tltoxo3oydfp rlneslt  2xrio ny4ope mfvi () 2rmxront1olt moetad a2um(vsn(4 rerxr3ta1fat ai ils tetmio3nu1am emnvsas s2truro;o1opxnif3ias a um(mp u4aetrir3to1lpD lues;()setoxr iy1lmtelicils a2rrxmpou4texomfciltfs2ul(vsnt0areoxr io1op  lnvi;t)srtmxo iu1lmte fetas  rrr(r no0tltnio3tysla emnms;() ltomfciatomt aiei;s) rxoirpou1apt livsat aDrau  ;o0texn o3ildfsDrmnvp;t)aetomrciodlaDrlivi ()s2um(mpiy4lm nmfesl( srumu  ;t0alx iictldfa2umu pn(0alxrmrciotopDr n o;t texoimpiu1opt mici t)aDuaum ;u0tex  ictlsfaDumu s t4teenmr iadfmtelnvo t0srtoxmpny1omtemicslt a2raxr ou4oetniocild mDeauvsnu0tltnirctatfat li i (0 rum(r iu1lmeelneias)artrx o;t1tpxoii3tytlsDrmumo;t0 ltnmf ty1fa r i i;s t2to(r nu1am nlies t) 2ta(m ;o0tlen fciytla2rmu onu0teerif ty1oat au i;t0texmirpnu1om e icta()srrmxront4tpe miciadla rmnvon(0tlenxfciatoaD an ilt tetmir3iydlmee neilt srraxm oo4aetn fcildfaDumuvo u) lenxo3oodfmteln ilt)sexoxm oy1om e ici t s2urxmo;u0alxnmictas a2rauvp;(0 rxnxfcoodfpDeli sls trxo(r nu1lptelfctl() rraum nu1olx ioetysfs umu o;t) rxnxo3iotfm r uei;(0 exmir3oy4olenmfvslt)srururpnu0opxoifciat a rmump;u0alxnio3iotlm elivo s  rxr(o3io1lp  lfes sfaDtm(r no1optoioeiydfa uanvp t) lxrxr3oa1lpD lu o;s0s2um(m3ou4omtelnesat)arraurp;t0aetoif3ils aDuauvo;()trtniocio1opDeluvolt)srxmxm iy4am nmnct tfa2rmxm no4tpx iiciatfm ea(vonu4 renmo3iydfm rlieol() rxo(o3oy1ll emneiasfartaxr ;o4tlxo fetad aDemnmpnt) exomf3oadfmDrau o s  rtrimpnydllee icil( sDrm(  oo1opxnifctas s2ea( snt0aetnifctydlpD aiei t)trtm(o3iy4om nmfvtl()a2ur(r ou1oetoii3iatfa2rl( o;t0trtoxocoydlaDeanvsl() 2xoxm oo4amenmnvil()aDra(mpou4apxnmfeias s ranmp ()teeoxf to1fpteauvol( trur(r3no4op   fetatfarrax ont1optoifeiysfa um( s t)aleomfciydom r uvs;t0tetrir3ou1omt lfcta(fsrtm(mo;u4aptnmfeiltfm2rln o u4 rtrmo tadfaD  ivi;s  rumirpoudol nmivt t sDrr(  oo0apxo ocilsfs2ulumo;(0 rxnir iotfa  auei;s)s2um(o nodome  neslt  2tmxmp;u1texnmoctadls umu p;u)aexoir3ta1lm eanvs;t)srxrxo3nu1am  mfcia(  2rmumo;u4tpenifeiyslm ran sn(4tetoifcto1omD lueolt0seur(r3nydlmt lnctas srra(rpnu0openmo3ild a2em(vs;u)arxoxo io1laDe uesls  2ur(o3nodoptn fvs (f rtau pnu4tlxoii3ilsfs2elu o ()aeermocoytomtr ivs;(0 eurirpoodlpt mivt (faDurxmpnu0alenii3ilsfaDemu sn() exnmo3iodom r uvilt)tetrir3oodomee ict t  Dtrxront0oleomictltfa2umn snu0tetnmf3oa1opDrai s (  rtmimpou1ole lnvtatf Drrxrp;o0opxnmfeilsla uln p () eerir3io1fp r ueils)s2uoiopio4llen fviasfsDrmumo;o4ape io3tysfsDeaumpn(0tlxnircio1fmD  u il()srurir oy1aptn net () 2ta(m ;u4tlt  feiyslmDumnvo;t0aeenio oatlatranes;(  rumir3iodopee fct s artmurp;o0aleoif3tat s2elump;(4 exnxfctydoat livi;t)texoio ou1ap e fesa( artmxm ou1olen f3tysls2rl(vp;t0teermr iy1oaD  ivs;t)srxr(m3iu1alt liei t)s2umu pot0optomi3iyt sDrl(vont0 lxrxf ta1latr i s s0s2toio3no1lm nmfesl( aDuaurono4opt  ieiltfs2eanmsn(0trxoif iodfptr nvilt0trxr(mpiy4altemivt s  Durxr no0aexnmfeiyt m umnms;t0 rxnxrcootlmteaivsls  rtr(mpnu4openlietlt)s2umumoot1olxniocils m uanvo;()trxnxfcoa1fm  luvs s) euoimpio1omtemncsl( aDua(r no1aeeo ietytfm ra(vs u4texnxo iotlp  luvs;( s2toir oydameemfeslsfs2umu  nu1opt ifctadfaDeanvp;u4areoio oy1laDrli i;s  rum(r3iy1llenlicsl(f 2taxm no4tptomictld sDrlumpnu) ltnmr3oa1faDrlueo t0s2xo(mpiu1altemict () rtau o;u1tee mf3iltlm emnms;(4tlxoif3oo1omteaiei;s) exmxopiodam nmfvtasfs2uau  ou4altoifetatla2eanvsnu4altnif3iy1fpD  ueil(0srxoxr3oydll nmnvt ()arrmx o;u0tpxomoetatlm uanvs;t)aexomf io1opteaueo t t2uoxm3nu1olenmivtasfs2ra( p;t4oeenmoeilsfs2ea(mo t4tltnir oa1la rauvo;(0s2xoir3nu4op elnes tfsruaur oo0tex mi3iad m eluvs;t) exrif3ty1lpteanvs;s)s2tmxm3io1amtnlfviasfsrtr(ronu4ope mi3iltfa2umnvs;t4teenifciodopt aues;t s2trxo3oo4lm e fcsl()arua( o;o1ale  i3iasfsDul( on(4trtrio todla elnei;t) rxmxm oo1llen fctlt sDumumpou1oet  ictytfaDuaums ()alerio oy1lpteaies;( t2xoiopnu1al nmictat  Durumpnu0altoiociysls rl(mp;t) ltrmfcoy1la elneo () 2xo(o3no4oltn ivsl()sruau pnt1aetoifcias m em( snt4areomf tadfmtr nvo (  rurir3oydaltnlfeiatfsDtr(rpoo4aee  fetaslsDra(vonu)tetrmfcootfatraiei s s2toxmpoydop  mfvt s)sruru p;u4olxoiieilt aDelnvs (4 eenioctotfpDraieil(  2xo(mpnu4omtnmfciatfarra(m ;o1tptomfctysfm2rmn pn(0trtoifcoa1om  lu sls0s2tmir no4aleelnesat aDumx ont1olxomiciasfs2ea( p;u0tetoxoctadfpt lues s) exoimpoodale mnvsat) Drrxmp;u0oex mo3ilt aDean ont) rtnmoctotla  auvilt0t2trio nydaltnlfct s)s2ta(monu4tltoifeiys m2rmn snt) lerio3totfpDeauvo;t srxoxm3iy1oltn ivtas a2tm( p;t1oeeo fciadfmDemnvs;()arerircta1oatrlivs;(0t2umxopoydapeemfei sf 2raxmoou1tpeoiocilslm2rmnmpnu0 rtnir tydomDrai il(0t2xoim3oodam  micsatfaDurur ;u4alxnifcild a uluvs u4altoxrciodfp   nvolt0srtrxm3oy1lptn fvsa(f 2rr(mp;t4apxomo3tlt aDrm( pn(4 eeoirctydoatelivs s sexmxmpoydale mfvias  2tmu pno4apxo ocias a2umuvont0trxomocto1fpDeai ols0teum(o3iu1am nmieias a2tmxro;o4olto f3iyslm2ulnmpnt0altrifcto1fmDrau slt) rxoir nodlmtnmncilt)a2trx oot4tpt mociadfs rm(mo t) lxnxo iatlpDraivs;s) eur(o3oudapt lfctlsf 2taurpnu1aetnmi3ias m ul(ms (0 lenio ootoa rauei t  rxrxr iy1ll   nvta()aDrru oou0apxn o3ildls umumpnt4 etrifciy1fmtrluvol( setrir3nu4aleemfvtasfarrrxmp;o1ole  iciatfm emu s t4 reoxr oa1oate uvo t0 rumirpoydamtelicilt) rra(  nt4altoifeias sDrlu snt) etoio3oy1laDeanvi;(0s2umxm3no1lle lnci tfs2tau  ot1opxnmf3tlslm2rmuvs (4teenxr3oydoa  liei;(0texr(mpoy4lle lfcsltf Drmxr ot1olen oeils m emnmo ()alxoio to1op eau s s  rtm(m3iy1am elnctl(f 2uauro;u0olx  o3iad sDeau ont4areoir iodfm  livs;t  2to(r3oy4ap n ivia(fsrtaump;t0tlx  ieiyslm2ra(vsn(4 lxrxo3iodlatr u ol( trurio3io4al  liesa(  Dua( oot1oee iociydla ea(mp t4arxrio oytfa e uvo;s0 rurimpnu1ole  ivilt) Dtrx onu0oetoioctydls2em( o u4tlxnmr3oadoat aneol()trtmxm3io1openlfci s sDur(mono1tle ii3tas aDra( o u4 rtoxf3io1fatrlivilt0teurir nudlme mnvtatfaDuru pnu0oltomi3tyd a rl( p;() rxnmr oatlm  ai s;s s2xo(m3iodope liviltfsDur( oou1aptn ietydfm2rln s;() lxrxf tatfp eluvo t)sexr(m no4lmtn ivt sfa2tax p;t0ape  ietas a2ul(vs t) lxnxf todlp   nvs s) 2xr(o oy4omte ivs tf rurx  ot4tpx  i3tys s2ea(vo;u) lxnxr iy1lpD anesls0 exm(m3iy4llenmfvtasfsrtrxrono4altn ictyt m2emnms t4 ltrxrctodfm e neol()setr(rpiy4ll elfvsl(fa2umumono4tex  ociys m uau ont) rtnmr tadoa   i ils sexr(o ou1lm  lncsat)aDraxr nu4aeto o3tldfaDeaumpn(0 rxoircoadfat auvs t) eurxopny4am emfctasfsDtaxm ;o1aexomi3iadfsDrluvp t) eeoif oa1fp elu il( srurim nodal e fvt t sDumxrpot1aeenioeiadfmDrlump t)trxrmfctodfm r ueil(0setmxo nudamtelivt ()srrmxrpou4olt miciyt s emu s;t)altoio 
\ No newline at end of file
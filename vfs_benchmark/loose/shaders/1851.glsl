@@ -0,0 +1 @@
+i o () eurxm3no4ll nlics s  2ur(rpnu4tlxomieiadfm2ean snu4 lxnmr3ta1oaDrau o;()t2toxm3iudol   fcils s2raxmo;u4opto ieild mDrmump;u4arxrmo ty1fm elu o;t0t2urxm ou1alt micias s2tr( oou4apeo f3iatfa2umn o t0 rtrir3tydom  lneolt  rxoxopoo1alenmneilsfsrua(ro;u4opx mfcias m2ul(mp () rxrmo oy1fat  nei;(0trtr(rpnudomt  nvia() Drr(ro;t1apxomiciltlm ea( on()texrifcoadomDeaivs t) 2trir3iy4ap elfetat) rurx p;u4oetoifcils m ua(vsnu)tetrmr3io1fpDe ues s0 eum(r iydlm e iviasf 2rm(  nt0tlx mocias sDemuvp;() lenmf3totla   u i;s) rur(o oy1lm  lfet s aDtaxmo;o0ale mf3ias a2uau p;t) ltnxo ootfa e ivo;t0 exr(m io1oltnlivs t sDua(rpno4tlenifeild mDrm(mpnt0 eerif oo1fm  aneil(  euoxrpio1am n ivs s)sDuax  ;u1aexnmieiytfs2uanmpnt4trxrxr io1oatr nes;(  rtoimpiydlmtemiet s)arumumoou1tle iicilt a eanmo;t0trtnxrcoytop rln ilt) etmimpnudop elfvt ( s2trxrpnu4aleomi3iadlaDumnmon(0alxnmf oytop rlneo t0trtrxrpnydlltnmfeilt aDrm(r ou4apt io3tydlm2emnmpnu0areoircoodfate uei s  rtm(m3io4olt  ietat)aDuau oot0apxnmicias a ul(vp;t0aetoirciotlmt aneol( trumio oo4lmt  nvt (f 2tm(m oo4aex mfctyd a ua(ms t0 lxoxo3iodfpD  nvolt0s2tm(o3io4lpe lfviasfarum( p;t1texo fetydfsDuan ont)arenxr ia1fatrluvo;s0t2tr(r3iu4op elfvt sfsrtrxrpnu4tee iietas sDeanmp t0trxnmocio1lp   ies;s)t2xrim iy4omee nctls)aDtrx pot0alxn octltfs2rm( sn(0 exrmrcoytoateau s;s setr(mpou4om e ncils) rtaurooo4tpenmiciytfm rmnvo t0tltomrcta1fpDrliei;(0setrxo3iodlmenlnei s sDuru pot1tpe  ictas a rlnvont)trerxfciytfp e ueo (0t2umxopnudamee ivsasfsrrax p;t0tlt moctld sDean o t0 lxnxf3tadfa rlivo () 2toxopnydapt micil(fsDum( pnt0tpen f3iyslaDemnms;(4trtoxr3oadlmteauvi s  2umxm3nu4amenlfetlt)srrrxmpot0tetomoctls a2um( o;u4 rxnmo3tydoaDr u i t0t2xo(mpoydalt mfci s)arraxr ;o1open feiasfsDrmuvs t4texnif tytlaDeauvols0texr(r io4amenlnet t)sDuaxr ;u4teto oetlslaDrl(mpnu)trtrxr ty1opteai s t  etr(r iudameemnvs (fa2uaurpot4alxnmo3iatfsDelnvo;u4tetrmf3ta1fp  lneilt  2ur(m3oo4lle mfeia()aDraxmpnu0tpxn f3iltlmDelnmo;u0teeoxr iotlmD  nvslt  2uo(r io1llt  fvil(f 2uaum nt1apxn o3iys m elu onu)aexomf ta1fm  auvo (0s2urxmpoydame mnviltf rta(rpou0aexomoeiadfm eau s;(4 lxoifciytoa   neils0trtr(r3ou4ape livt s)srtrumpnu1apt mfciyd s elumpnt4 rxnmo iadoptrluei;s trtmim io1ameeliviltfs2ua(r ;t1tptnmi3ildfm um( o;(4tetnifctytfp rln ols)trxo(r3ou1opee ieilt)arum(r ;u1aet  i3iadlmDrauvo;t4aeeomfcoy1lpDran sl( s2tr(m3nu4openlfesls)srtauronu1tle ioeiyt sDumumo t4 eeomfcoatomDrlieo s  rxo(r3iy1lptemnes sfa2rmx o;u0tlt ii3iyd mDua(mpnt4 lenmfcoo1lmtr neilt0seuo(m nu1omt  ncs s artaxmpnt4alx iictld s2rlnms u0 eerir iytomD anes s) ruo(m ny1olt mivs (faDurur no1opeoioeildfm2umu o;(4 rermo3iodlptean i;t)tetmxo io4lm eliet s sruru o;o4apeoifciysfm2um(mp ()tltomr3to1lmDeli slt0tetrxm3iudlmtn ict t artaumo;o1oexnmictysls rlnvp u4texoxo ia1opDrlnvi s) 2tr(opno1lmt livtl(  2um(mpno1tpxn octas a2uauvp;u0 renmr iadlm r u o s t2xo(m nudamtemivi () Duru pno4texomociat aDeaums;u)altoio3iadom  lnvilt  2xmio no1oltemfviat  rtau  nt1alenmicildfm emnmpnt)tltoio totlp rlu sls srxmxm3nu1opt lieiatfsrtrx o;t0optn fetytlm2ua(vo t)trerirciy1om raivi t)tetr(o3io4ol  mnvtls aDtr(r ;t0tpe  oeiyd sDua(vsn(0altoio tatlm e n sl(0s2urio3nodomt mfeta( srraxm ou1alx mo3iytfa2ranvsnt0 exnmf oo1lmt lnei s) rxr(o oy4ap   ici t) Dta(mp;u1tltnifeildls ranvs;t)tetnmf3io1fp rli i t0setoxm3oodope lnvils sDtr( onu0opxniicildlmDemuvp t)tltoircoytfpt ai o;s)trtoio3oudop  lnvil()a2tm(mpou0optoiieiys a rmu ont0aetomo3oodopD aivi;(  exo(mpoo4opt mfci ()arraump;u1oexn fetltlaDemnvsnu)arxnxrciotfptr n i;( t2xrxr3no1lpenlfesl(faDua(mpnt0oeto iciydlm rlnvsnu4alxnmf3iotomD liesls setoxo nydal nmiesl(fsDrm(ro;o4tlto o3iltfs2ranvs t) rerxr3iytoaDraivs;()seumxrpno1omenlfesatf ruaxrp;o0aeeo ieild mDuanmo () lerircta1oaDeai s;s t2trxmpiu4lle  fetl(fsDra( ono4alxomoctys m emumo (0arxrmf3to1opDr uei t)sexmxr3oudlmenlnvsl( arurxmpnt0alxnmieiyt s2eaums ()trxrirciy1faD aieils texrio3oudap elfvias) Dta(ro;o4opxn fciatfaDul( o u4texoxr tytlmt anvo;s) eum(r3no4ap e ivia() 2rrx  ;o4optoio3iat a2rauvs;t)arxnif oydlateaueilt s2trxr ny1omenmfetat  rumuro;o4oet  oetyt m2rmuvsn(4tlenio3oydoateliei;t srtmio3iu4lmtemnetasf rtruronu4apeomfeiasfm2ulnms;() rtnmf iotfm rln o;(0 2urio3nu1olte fviat) Drrum oo4ole  ieiadfmDulnmsn(4 ltoir to1fmte u o s  2xoimpio4omeemictat aDtr( onu4opt  i3iyd aDuanvonu)tltoxfctadlmt  u i t)trxo(rpoydlmen iesa(faDtmuroot4alenmo3iyd s2ulumo u0tlermrcoo1fp   nvo t0 exmxopoo1omt micsas  rrm(  ot4olxomfciyslm umumonu)tetoxo3iy1oate nes;s  ruoxm3iodop nmncsa(fartm(ront1apt miciyd aDemn pnu)aeeoifciotfp rluvo;( s2umxo3nu4lmtnmnesls) rrmurpnt4oltnmf3iadlaDuluvo ()arenmo tadfmt aueols s2xoxm nodap emfvtl(fa2rr(mpnu0olxnioctlt aDrlu o;u4 lenmo iy1lmte n s;() rtrxopno1apte feslt s2taxmpot1tlto oetad mDrauvpnt0alxoif3oydoa eaues s t2xm(opny1lmtn ictls) Dtmxm nt0tlt mfciytfm2rmuvp;u0tltoiociodomDr n i;s0t2xmxm3nu1ll   ncil(  Dur(rooo4apen f3tlsfm rlu s u0tltnmociadla   ueols) rtmir no1llt lictat) 2trump;o1olxniietldfm ulnvs;u0teenxr oo1oatr ieolt0 2tmxopoy4amtelici t) 2uau oou4texn fciad a em( s;t0trenmf3ootoaD  u s;t s2ur(mpiudape mfctls)arua( p;o1teen fctatfs eanvsn(0 renxociotla  anvo;(  rtmxo iu1llt lneiat s2tmu pnt0teenii3tatls2elnvs t0trtrifctytoatr i s t)setrio3ou4lltnlivtlt)aDur(moou0tlx  ociasls ulnmo u)alermo oatoa e u o t  euoirpnodol emfvsltf Dta(m ;o0alto i3tydlm ean p;u0 reoircto1fpD  ivols)srxr(rpnudomtnmnetl()sDuax oot0olx mo3iytlm2ua( snt) ltniociodlpD aivsls) etoxo io4omen fctat s2rrxmoou4aptnmoctlslm rluvpn(0trenif tatfpD li o;s s2to(rpnudaltnmnvsa(f 2uax pou0apeomietas s2ran pn()texomo3tatop  auvi;s0t2toio3io4lptnmieilsfa2uaumo;o1altoiocilsls2ra( s t)treoxr ty1lptrlieo;()teur(r3iodameemnciasfa2uaxroou4aeeomietadfs rlnvs;u)artoxf3ta1fm  au i t0sexmxm oodlme mnct s a2raxmp;o0aetn fetysfs rlnvo t0 lxnxr iytlate nvs (0sexm(mpiodllte fcsa( s2taxro;o1altnio3iyt m2eanvs;(0 lenio3totlmDrluvs;(0t2uo(m nodlpe mfcilt aDum( o;t0opt  ocilsfm eluvsn() ltoio3iydop raieo s seuoio3oodom  mfei s a2ur(rp;o1aexo i3tydfa rlu pnu0aeeomf oo1omt li s (0 exo(opiu1aptn fvslt)s2trur ;t4aleomictatla rl(ms t0 lxnxr iotla ranes s  2tmxm iudal nmivsls  Dum( pot4alen o3iad aDuau pnt4aleriocoy1lpD luvolt0 eumxm3nu1ll nmncs ( s2rmxmpnt0teenmo3ilslmDrl(ms;t0trtomf io1fpteliei t0 euriopoudalenlncsas)sDua(  ot1olxnioeiltfmDrm(mp;u) exnxf3tatlmDe u il(0trto(r iu4lpte iciat s2taxrpou1apt mieildla2uauvs (4 rxnmf iadlmtr u o;t  euriopou1lmte fesas aDtmxrpnu1tlxomoeiltlsDrm(vp;u) rtrmo3tatlptr nes t  exoirpnudalt  ivi t) Dtm(  ou0oetnmfeiyt m rl( pn()aeenmrciodlaDr ueolt) 2urxo nu4lpeelnei tfsDtr(ro;t4olxomoeiys s2uan snu)aetoif3tadom eaneils0tetrimpno1apt  icta(  2tmur ;t0tpxo i3iadla rlnvs u0 rtrxr3oo1fpte nvs t) 2xr(r ny4om nmnei t) rrau o;u1oltnmf3iys s2elnmo t) rxoif tatfa eanes (0srumimpio1lptnmncs sf 2tr(r ou1tetn ociytls ranmo u0 lxnxrcoa1laD ln il(0t2toim iydalt  fct s s2tm(rono0opt mieiadlm uanvp;(4trxrmo3oy1op  lu slt0srtoir nydap  lnetl() Dtrx p;t0olt  icildfs2ulnvp;t4aeeoio3tydoat aivslt  eumxrpoo4amen fviat  2um( oou4opt  i3ilsls ulumpnu0 leoir3tydopte ueo;()tetr(r no4open nvtltf rua(r ;t0alt mfetatfm2um( s t)arxoxr ootoaDraiesl(0 etoio oo4optnmfvs s)sDrr(  no0oee ii3tatlmDemumsnt4 lenxo oo1lm eai o ()teuoio3oydamee fvslt s2rmxr no4alenmo3ildfaDel(mp;t)tleoxrctatlaD aiei;t0trtmxr3iodlmte ict () 2rr( oot1tlxo o3iaslaDrmn pn(4alenmf3oo1omDe ivils0 2xo(r iy1ameemics t)aruau p;o0alxniieiyslm umu pn(4tetoxf3tatoatr nei;t0sexmxm3iy1apenmiciat)aDrru poo1aeeo feiasfs ua(monu)arxrmf3ty1lpDe u sls)tetrimpoo4lltemietltfaDrmu o;t1tpx moeiytlm rlumsnu4teeoifciodfpDeaueslt)t2uoir nu1al  mnesa(faDtmxm ;t0oexn iciltfsDrmuvp;(4aexoioctadop raivols0t2tm(o3ny1amee nesl( sDtrxmoou0tlx ifciatfa elu on(0aexrir to1fmte ivs t)teurirpoodame lnvt s s2ta(moot1tpeo ietasfm2umnmsnt0aeeoircty1lm raiei;()s2toxo iy1ap   ivi tfaDrrx ono4opxnmieiatlm uanvo;t0alxoxr oadfmDrauvol( teuoxopiy4olenmfeslsfa2uaur ;u4olenmf3tytls2elnvo u4teeoir3totlaD lnei;(0 exoiopnodapeemivs () rrr( oot0ale mo3iydlmDemnvo;u4artrmf iadomtrln ols0 etmirpiy4lmenmivslt sDrmxro;o4apx ii3iydfm rmuvsn(4artrir3todfmtrluvo;s setrimpno1lltemfcsas aDur(ront1tlenmo3tyd a rm(vo u4tlxrxo iytopD li il(0s2umxopou4ope livsas)arta(mooo4tleoiieias s2umnmon()tltoio tydlm e nvi;s  ruriopio4opt mietl( srrau  ;t0tee  i3tytfa rm(vo u4altnmo iotfp   ivs s)texrxo3nudopt  ivsa() rrax onu4tlt mfcias s emumsnu0trtnxf oydoaDrlueslt s2xrxm nydap nmivt s aDum(mooo4opxnioetadlsDuan ont4aeermr3iodlp e i i ( trum(opnodomtemfctat)a2rmx pot0tlt  icilslm ua(mp t4arermr oo1lp elu ol(0seurxrpiu1omtnlfcil( s2um(root1altnifetydfm2umu o u0 lermr3oydoate nvo;t) rur(o oo4lleemics (fsDraump;t4tpxnii3iadfs2ranvs (4 etrmr3tadlpD  ies t0 rtrxo3iydapenliesl(f 2rmu pno1tleoioctydla2eauvp;(4 lxrif3oo1faDeluvo;s0 rtoir no4llee fvta(fsrrr(ro;o1tptoif3iatlsDea( pn(0tetoif3oatop ranvils  exm(rpno1apt lfvt ()a2tm(  ou0oeto i3ilsls2elnmp (4trtoif oytoa elivol( seur(r oo4ol  lieiasfa2raxrooo0olt  ociyt mDra(vo u0 lxoxr3ootfaDrlnvi;t0trtmxm3ny1lm elfvt s) 2ur(  ou0optnii3tas a2emn sn(4artrmf3oadopDeanvs (0 2toimpoodamt mnvs tf 2tr(moot4apxo o3iltla eaumsnu0aetnmo oy1fpDe nei (  eurxrpoy4llenlnci sf rtaumooo4apt miciatlm2el(vs t)alxoir3oa1lmteai i;s s2xm(o3io4op nliei ()s2urum ot4olxomoctlslmDelnmpnt0tetrio ta1fatrauvols0srurxo3ou1olenmfeil()sruauronu0oetnmoeiydlm ua(vo;u4aexnmo tadlmt  nvils)trxoir io4apt  fvilsfaDtmum ;u0olen ieiad m rmu s u4 etoir3iodoaD au s;t t2xo(opoydlp emiei t)aruaxmo;t1tptn f3tyt sDelnmsnu0 exnio tatfptrau ils0s2xoxm3nu4op elnvias arum(ronu1apt ifetldlmDeau s;u0 rtnmoctotlpDraiesl( srtmxopoo1llt  nei s  Dtm(rpot4opxomfeiasfs2rln pnu) eenmo3tydlpt lnei;t)srxrxo ny1ope lfvils)arrrum ou0tex  oeiat aDumn p t0tltriocoadlmDranvi s0 rum(mpio4optn fcs s)aDuaxm ot4aex if3ildls2emuvpn()alxrmr3ty1om r u ol( trxrim3iy1om e ivi ( s2taxm no1alenmiciadfm ulnmp;t0artrxo3totlpD  n s t)trtr(mpiodlltemiviltfsDra(rp;o1apeniieiasfmDemn o (0aetrxf oa1faD lneo;t0srtmxo ny4ap elivias s2taumoot0oexomo3iydlm2ua(ms;()aeeoif oa1lat ln ils0srxrxr3no4lpte nvsl()aDrru pou0tex iieiytfaDrmnvo;u)alenmr iy1faD ai ilt  2xmxrpnodlpt mnvsatf Dtm(r oo4tpe mictls s2uluvsn(0tlxrmo3ootfm  lneo;s srxmxr oy4ap n netas)srtrxm nt1oltomociadfmDuaums;t4artrio3totfmt  i i ( texmiopoy4lpen fviat)a2ur(  ot0opeomoetat s2umnvp t)altoioctodlmt  uesls trurxm oo1oltelfcta()srrrx o;o0tle io3iad m rl(vs u0 rtnmo iy1fat anvs ( srxrir3iodom   nvia( sDum(mont0tltnmiciatfs raump;u0 rxrmfcoadoaDr uvsl() 2uoxm ny4lm n fvtl(fsDrrx  no1tpt io3iadls2rmn s;u4 rtoir iodlm e uvi;t) 2umim3oodlpe mictas)srum(m oo0aptomieiad mDelu s;t) eeomf3oy1fmDelies s)t2um(opiy1ope lnvtat  rrmurpnu4oexnifciat a el(ms (4 etoxr iydlm   uesl( tetr(opnu1aptnmnet (fsDrruront0ope  o3iydlmDul(monu4tetrmrcia1omte nes ( teumxr nu1ol e ictat  Dumur ;u4oltnio3iltfmDean sn(0tlxnmrcto1lmDrlies s0 etmxo3iy4ol emivsasf ruax o;u0apxnmoctatlm2um(vsn()aeeomrciodfaDr uvs;(0 2xrxrpnudaptn nvtasfsrtmum no0aet io3tlt aDranvo;u) exomr3ta1lm e neo;s) 2toir3ny4apt lfes sfaDtm(  ;t0tpe ii3tatfaDeaums u) ltomf tadoatelueo;s texmio io4lme lfvtat aDta(moou4tptn ictydfm eau snu)tleoxo3ootlatrln sls0srtm(o nu4ale lieiasfsrtaumont0aetn ictas s emnms;u)tlxnxocto1fa raueil(0truo(m iu1lme mfcsltfs2um(m ot4olt mociatfaDraums t4 eenmrctytla   i s;s) 2tmio oodlltemnes sfs2tau  nu0tpx  f3tatlsDuanvpnu) ltrmr iotfpt  ieilt  2uo(rpio4al nmnvtas s2trx oot1tex  ieiydls2umumo;t0aexoir oadfa rlneslt s2umirpoy4ape  ncias aDtr(r nt4tltomfcildls rlnmo;t4 lerifcio1lp   ivs t)t2tm(r3io4lp nlivsl( srumum ;t1ope mfetlsfs2ra( on() rtnxf3oy1lpt li i;s)teurxm3iydll elicia(fa2rrx p;t4tpxo f3iyt s umumsn(4aetrmo ia1opD aies s0seum(o3ou1opeemici sf ruru  ;u0aetomoetltlaDuaumpnu0 lxrxrcoo1fmDranvi ( texm(m3nudom elivtltfa2ururp;o1tptoii3tadfmDel(vsnt4 rxomo oytomDr nvo;s tetrir3no4alen fvsas s2rauro;o4tpeo o3ildfaDel(vo ()aleoxf3oodop e n i () 2trio3iu4aptemnvtl()aDrrxm ot0tle ioeildfaDul(vont4teeomo3tatfa r iei;s trtm(opiu4omt  ies tfs2umx poo0aex miciasls ea( p (4tltnmr3tatlm e uvolt texoxopnudlp  micsat srrau o;o1oetnmocildfm eln s u4 lxoif iy1optrli o;s0srxo(m3ny1ap emivi sfartru ooo1ole  iciytfsDrluvont4 rerxf tatoa r n sls setr(m nudam e fctltf 2rax onu4altoiociydlmDel(mp;(0trtnxo oa1fp eauei () eumim3io1lp  lfviasfartm(r ;o4tlenifeilsfs2em(vp;()aetrmo totopDean o ( srxo(m nodaltnmfcs sfa2tmxr ot0oexnii3iyd aDulu s t) exomf3iodlatraueil()srtrxm ou4altelfctl(fa2raxmpno4oee  fcildfmDum( s;u4artrir3oydlaDeaies;s)sexmim3iy4op   ivt t a2uaxm nu0aeeoifeiys s2rl(mp u0tltrxf iotlp  lneolt0srtoiopnu1lmt micsatf rtrumo;o4tpxnmieiatfa2rmnmo;u4trtnir oydoa  auei;t  eumxm3io4amen feia() Dum(mo;u1oex mi3iydfa2uanvsn(4tlxrxfcta1oa eai o;s) 2uoxo3iu1al nlfvilt)aDrmx p;t0ope  ietldfs2raump;(4alxomf io1la r uvs (0 rxoxrpoo1ol nmnvta(  2rrurpno4oee mi3tyt mDrlumo;(4tltnxo3ootlmtraivo;s  2xmxm3no1ol  mnct t s2rm(  ;t4teeoiiciltfs ranvp;(4arenxr ty1oaDrlnvi;(0 2trio io4amenlnvsasfsDurxro;o0tpxnioeild s eln o;u) renmr totlm rln i;s  2umim3iu4lp elfeias)sDum(m no1apxn ociys s2el(mpnu0 rtrxf3oo1la  lnvsl()sruoxmpio1llenlfct (  2rmx oot0tpt  f3iys a ulnmpnu4artnif oydla  auvi;t) 2ur(mpiydamt lncilsfarrrurpnu4aleoiociatlsDra(ms ()aexomoctodfp raieo s)t2umim3no1amt  iesa(farurxroot1olx  ictadlaDua(vonu0tlxoxocoodlm e nvols0texmxmpnodoltnlfvt (f 2rr(  ;o1opxomfeiltfm uan p;u0arerir3tytlp elu o;t  2tr(mpou1am  lfvsl(fs2rr( p;t1teenii3tatlaDrl(mp;(4 etnirciydfpD aueil( t2uo(o nu1omenmictat) 2ua(  ;o0oltoii3tasfsDel(mpnt0tltrmociadoa r i o;s0 rtmio3oodlp  lnct t) Duaxmp;t4tleoifctldfm2rl( s u0teenxf oo1optraueols)t2xmir3iy4al n fctatfs2tr(r ot0apenii3iytla2elnvsnt)tltomo3ty1lp   neo ( t2umirpoy1al  licias)s2umx poo0oee  ictasls2rmuvs t0teeomfciydfpD auvs;t trto(r3iy4apte icsa()a2ua( p;o0oee mi3iyt mDem(von()arermf3tadlmt lueo (0t2xoio ny1ll n iet tf rrm(root4opeoio3tydfsDrm( pnt4texoxf3iydfpte u i;s setm(opoodlltn netlt)sDtaum ;t4tee mf3iaslm rmn pn(4teenxr tydlmtr nes (0t2tr(r nu4om e nes tf 2raxmoou4aetnioeiatfsDeanmpnu4 eenir3ty1lmD  u i s0s2urxo3iydoptnlivt s arrax oou0tet iictysfa rl( s u0tltriocoodlmt auvi t0s2uo(o oo4ole  ies ()aruau o;o1aee  ieiytla2rmnmonu4 exrmf3tytlpD  n slt) rurio3iodlle  ics (faDum(mp;o0optn i3tltlaDemu onu4tltoxf tydlmtrlu i (0 rtoio oo1lptnliet ( a2raxm oo4oltnif3ilslaDul( s (0tlxrir3oadlpt lieslt)tetrir oy1ap  mictlt) 2urxroot0apenifctasfs umuvs t0 eeomrcoytlmt an i s teurirpny1ameemfvsat)arrmxmp;t4oee  oetadfm ua(msnt4 lxoifctotopDelueo (  exmxm no1ole  iesat  Drr( ooo4ape mi3iysls2umnmonu4treomo ootoa rauei;t0 euoio oudllt  nvias) Dtruronu1tlxnio3tyd a2rlu s u0trtnmrcoydoaD lu o ()texm(rpoudoltemfei ( artau  nt0tet ifetasfm2rau o t0altnmr3oadlateanei (0truoxm oydom nlnviat artmurpot4oetomfetls s2rlumsn(0 rtnmfctatopDeau s;s s2tr(m iydlptn nvi tfsrrrxmo;u4apt  ictatlaDulums;t) lxnxfctytlmtrlieo;s  etm(r iudlptemnes (fa2rrurpno4aleo i3ilsla eluvp u)artomfciytlmDr iesl(0seumio nu1am  lfvi t) 2ur(m ou1optoii3tyslm2ulnvs;(4tltnxrcoadfmt ln slt0t2xr(o3iydlmtemfctl( a2um( pou1oltn feild s2uauvsnt) eerir ootlmtelu slt)t2urxrpou4amtemncsat) 2tr(ro;t0opt iieiytls2ulnms;()aeeoif3ty1lm rlies;t)texm(mpny1om  mncta( s2umumpnt0oexnifctytfmDraumont4 etrmfcio1fate u i;t) 2urxm3ny4lm emneta()artr( pno0oex moetysfs2eauvpnu0 rtnmf3iy1lat  iesls)teum(rpiy1lp emicilsf rua( p;t4tpeomfetldfm2em( p (4artnmf iy1lp ranes (0s2urim3nodll  miet s  rrax p;o4aex  octatla2rau p;(4tetnmo3iytfmtelues s)trurim oydoptelicsas) Durumo;u0olxo iciysfaDulu onu) rxrio3oydfp eaneo;s0 2xm(o ny4amt mivtl()arrm(r ;o4alenmo3tydlm umnvp (4aexoif iotoatrlivsls t2xm(opiy4op elfctas sDtaxrooo1tleo ieild a umnvpnu0tleomo iodfa eanvil()sexmxo iu1lp e nviltfaDur(ro;t1tetomfeilsls2rau o;()arxnxociadfa  aueo (0t2xmxm ou4ll  mnvs t)srtax  ;u1tltn oeilt aDumuvs (4trtoiociotla eaueo s) euoxo nodape mfei t)sDumurp;u0tet ioeiatlsDrlnms u0altnxo3oy1fpD ai s;s0srxrim iudop nlfvsa(  2uaxm ;t1oexnmo3iatfaDrm(vs t) eeoircoy1lm eaieols  rxo(o3nodalenlfcil(fa2uaum oo1tpxoifciytla rmn o;u4 exnmr3todfp elueilt seuoim3ou4lpe lfcsatfs2taumpno1apeo ictldlsDem( s (4 rxrir3iatlaD livs;s0t2uoxmpio4ol elfciat)sDrm(mp;o4oetniieilt s ulnms u4trtrxociotfmt  ueslt0setoxo ou4lleelfcsl(  Durx pno0olx mfeiys mDra(vpnu0 ltrxo3oa1omDrlivs;t teum(m3oo1lle  feia(fs2rrumono4tlenmfeiasfm umnmp;u0teerio3tytfate uei;t0tetoxr iydopenlfci t sDtrur no0texoifeiysfs rlump ()tlxrxfcoadfmDeau s;(0srurio3iodamt  icils artm( oou0alxn feiydls2emuvonu0arenxf3tadla eai s ( t2uo(mpoy4lpte ici s s2rm(r ;u1oexoiociat a2uluvo (0aeenxf iotlp rlivi s sruoirpiy1llt  ivtas)arua( ono0opxomf3iyt m ean ont4 renio iytfmDr neo (0t2xrir nydap emiei t)sDrr(m oo1opeoiietldfm2rlumpnt0alxnmo iy1fa rln il()setrim ny1lpt  fvsl(f Duru  nu4tptn ociyslaDumuvont) rtrio3tydlm e ivo;() rur(r oudal nmnvsatfaDumurono0olt  feiltfs uau o t0 reoir oatlp   i sls)tetrxo oudal nlnci t)a2rrxr ;o4tex mocias s rluvo;t4 exrxfcoodomtr uvsls0t2urxm3iudlm n ieiltf Dur(moou1aptomo3iadfmDum( ont)aleoxrcio1lpDraneo (0t2xrxopoo4altelncsat  ruaxr nt0apen o3iat aDrm( s;(0trxoiocoytla   u s t)sruo(rpnydopeelfeiasfa2uau o;u0olxnmoetas aDrlums u4treoxocoodla  anei ( t2trio3io1aleemiet s) 2urx ooo1aex miciytfm2uaumo;(4trtnmf oy1lmteauvslt)srur(opiodopeelfci ( aDtrx pnt0teeoiieiasfa2rm(mpnt)alxnmo3todom rlueol( sexoxmpoy4apenmieia() rtauroou4open ocias s2emnvo (4 lxnircootfpD lues s sexoimpoo1lltn nes s) 2tmxmono4tlt  o3tlt m2rmnvs (4aexoif3ootfmDrluvsls) 2tmiopou1lm e fesat srtmu pot4opxo fciytfs2ulumo;(4 leoxfcta1lptran il(0 2trim3oo4lmenlfei t srum( ont1opxo ocild s emuvo t4texrmo3tydlateai o s) exmir3nudlptnlfvtlsfa2tr(r ;t0aptomf3iasla2eaumo;u) eeomr3oydla   nvi;t)trxmxmpoo1lm e ivtasf Dtru o;t4tle moeildlm ra( s t0tlxomrciytla rluvs;(0 ruo(mpio1ap emieils arrr(m nu4tltn fcilt s em(vsn(0texrmfcoadfm   nvol(0srxrxo io4lpe  fvsa(faDrrxr nt0opx mo3iad a2um(vs;u)trxoifctadfpte n s;( t2xrir3nu1olee fvi (fs2rrxr nu1altn fctat mDemn p;(0alxrio3oytfp r uvo s0 2umxmpio1ap elnct tfaDurum ou1oeeoifctlt s2ra(mpnt0artnif3ia1fp   n ol()sruo(o3nudoltnmnesat arurxro;t4optnmfciadlm ulums ()tlxrif tatlaDr nei ( t2urim iydlpe livilt a2tax  ;u0tetoio3tldfmDeln o () lxoxf3ootfmD li sl( texrio oy4alenmiet ()s2tax o;o4aex ioctytfm el( p;u4tltrxo3oatopD aiesls)trxoim3nu4apt livsas)aDua(moou1oet  ieiatlsDranmo t0 rtoxf io1fpD ai i t s2urxo io4oltemfvsls  Dtmxm ;o4opxomi3tys s ulu o u0 exrxf to1latrli o t0s2trxr3io1op nliet s  Duaxroou0altn oeils a2uaumpn(4alxnxo3oy1fptr ivi;(0setoxopnudalenlnvta( arumx  ;o0olx ii3iys a2rluvpn(4 lxnmf3oadlmD  uvs t s2to(m ou1ape mnes ()srta(  ;u0oeeomociyd mDranmp;u4arxnioctodlm rauvol(0 exmim3oydome mnctatf 2tmxronu0tpe iieiydlaDrm(mp ()alenxr3todopDean i t0setmxmpnu4ome lneta( s2ua(r ;o0opxoifciatla rmn o;u) lxrxocoadfa rai i ()setoir3no1lmenmivtlsfaDtax ono0tpt micilsla2rm( o t4 etnxo oydom elneols)tetriopnudoptn nvtas)aruauronu1oltomo3tls s rau s (0aeeoxf3tatfm e n ilt)seuoxmpiu1ll emnetas a2ta(r nt4aeeoiieiltla uan p u0 rermoctatfp rau sl(0t2umim ou1oleelfci sfaDumur nt1optn i3tydls2ua( o;()aeeoxf iy1fmDraiesls0 2urxmpno1ope lfcias)s2rau pou4aeen i3tys m2rmumsnu4tlenmfcto1lpD aivsls srxrio oy1lpenmfvsls sDtauro;o1olto ieiydlsDelnvpnt)alxnxo iydfmtrlnvols0trurxopnodap eliei t  Drm(  ot4tlen oeils a rlnmpn(0arxrxrciytlmD  iei;(0 rxo(rpiu1ole  feslt  2tr(  ou0tlx mf3ild s2elumont4 renir to1fp  aivi (  2xmxopiu1opt mfeta(fsrrmxmp;u1teeo f3ilt aDel(mo;u)aetnircia1fp raiei t  etm(r iu4lm nlnviat  rraur ;t1tpeomietadfmDra(mp;()tltrif3tadop e u o s  eumir3ou4lmtelivt (f rtaum oo0alto o3iysfs ra(mp u4tetrifcty1lateaneo t  2uoxr oy4olte nes ( aDtrurono4oetoioctasls2umnmo (0 exrxf3ta1fatrlu il(0 rtmxopiudaleemfvia( s2uau ono4tlxnmf3iytls rmu s;u0alxrio oy1omD au ilt) rtmxm nu4ape lfcs (f rta(rp;t4ope  f3tyt s2rlnvon(0aetoxo oa1fm ran s t)trtr(mpnudlp e ies () 2uaxmooo4tpt mfciys a ulumsnt4treomf3tytoa  livi;s0 rtrxrpou4lm nmivi s sDum(mp;o1oet ioetyt a rmnmonu)treoxo tatlat livi;(0tetrxmpno1lmt lnvsat sruru p;o1aptoioeiad m rm(msnt4arxrmf iytop  livol(0 2uoirpno4ole licslt  rtr(  ot1oleoif3iyt s ea(vpnu)trxrxf oadomt anvi;s)srtrxr oo1op  miesa()srumxmoot4tlt  ieiyslm2ra(ms;u4alxomf3tadfaDrai i s0seur(o oy4omen ncsls)aDtauronu1oeeomi3iad mDel(vp t)alerir iodoat an i s  etoio3ou4op   neilsfs2ra(mpot1aet  iciad m2ea( snu)trxrir tydfa e ivo s)texr(o no4lptelfctls aDraxrpnt0tpeo i3ils s2el( s;t) reoifciotoaD  uvsls trxr(rpoy4om n nvtl( a2umxr ;o4opt  oeiytlsDrl(mp;u0trxrxr tydfmt aivolt)srxr(r iy4al elieiat  2rr( poo1opt ifcildls2em(vo t)texnmo3ta1fa  au sls)sexmio nodaltnlfetas sDurxr ot4ale if3iydlaDrmnvp u0 rxnif ta1la elnvs ( texmxr3ou1apeelfetltf 2umx ooo1altnioeiysfmDemnmsnu) leoxr oadlmD  nes;t setoxm iudlm elnvtltfsrur(m nt4tpeniiciatlmDrm( o u)arxrmfciotomDrlu o t  exoxmpoy4al n ics t s2rrumo;o4altnifeiad m uln pnt) lxnif3io1fatraivi ()trtmim3nu4lp n nvilt)a2rmxm nu0texnmictytfs uluvonu)arxnmr3iydomDrln ils teurirpiy4optnmfesasfsDua(rono0ale ioeiltls em(vo u0tleoxfcoa1la r u s s)teuoxm3nodlpenmnvsasfa2ra(r nu1olto feilsla2elump t0treoxr ia1op e u i;(0srtoio3ny4ap e fei tfa2ta(rpot4tpxoioetldfs2em( p ()texnmr to1laD aueo s0 ruoiopnodop nmivi ()a2tau  no1tetomo3taslm umnmsnt4 eerif totfaD lnvi t)sexoio3nu4apen nctl( aDur(mpot4apxoio3ildls ranvpnt4 ltniociydopteai sls0s2umir iy4oltn nciat s2umxro;o1ape iocilslaDuau p;u)arenmr oodoaD aivs;s0t2uo(rpoo1al emici t) Draurono4alxnioetasfsDra( pn(0tlxoio ty1lmDe uvols0sruoxm3oudopenmnvsa(  rtmx  ;u0aee mfcildfs2em(vs;t0 eeomf todfpte n sl() etmio3oo4omenmnct t) Drrx  ou4ale  o3iydfm2rmnmpn()treoxf3tadomtrauvi;()trxrxr oydaleelfes ()aDrmump;u0texnio3iys s em(ms;t0 exoxfcto1lp  ai i;s)trumxr nu4altn nvs tfarum(rp;u4oexoioeiatfsDrmuvo u0 exoxo3oy1fa rln sl( s2urxm no1oltnlnes tf 2uaur ;u1tle mi3iydlaDumn p t0tlxrmf oatfa eluvi;s  exmxo3nudalen iciat) 2uax  nt0aetn fciadls ran onu)texnmf ta1fateai s s0srtrxm3nu4olen fvi s)artmurpnt1ale mictydfa2ra(von(4tltoif3oodoat au o s0seuo(r iy1lmeelivi ()aDrrurp;t0tetn ociysfm2uanvo t4alxnmociy1lmD livsls0srur(m nodap e nvi ()srumumpoo1opto ieils aDem( p;t) leoir oadomDelneilt)srxoio3oodlpt micsls  rraumo;u0alx  fctadfs2elu s u0 exnir3iotomDrln ils) eumio oudamtnmncsa(  Drr(rpnu4aex  octyd s ea( o t)aleoircto1omtrlieo;s) 2to(r3oy4alenmnetls)sDum(rpno0tlt ioetys a2ra(mo t4teeoif3iodoateln i;s  eurir nudlpenmnesl()srtrxmp;o0opto oeiyd mDrm( p;t)teeomo3iydfa rluvo ()srum(mpnu4lmt  nvi ()a2tr(  nt1tetnmfciysfm ulnmon(0 exnxoctotlmtran o;s0 rtr(o nodlptemnctlt  Dtmu poo4oexnmieiatfm em( p;(0 rtrio ootlptean i;t0 euo(opno1olee fvtl() 2rm(mo;o4tpxo oetytfmDra(mont4trtrmr3oytla  auvo t) rur(r nudlle  ivs (f Drru  ot4texnifcilt sDeau p;u4artoircoydfatr ivil(  2uoio nudam   nvt sf rurur ;t1aptomoctld sDulu p;u)altoxo ta1oaD luvs t0t2tm(m no1am  lnvsat aDrau  oo4ape iicilslaDul(ms;u)tltrxo3ty1om rlivols) 2umxmpoo4ol e fei (  rraumoou0oltnii3tys a2ra( snt0texoif oo1lmDeaieo;t  euoxm3ny4op nmneiasfsDuaump;u1apxoiieiltfm uln s;u)artoxo iytlaD anvo;s texrio nu4oltelfesls aDtrumooo1aptn fciys s2rlnmpnt) rtnir3oo1laD luvs (  2uoio nu1lmt liei ( sDtr(mpot4tlx  oeiys s eanvs;t0 ltnxo to1fmtr ivo;s trurir oy4ol n nvsa(fa2rm( ont4oleo i3ias mDeluvpnu)tltnif todlp r neo;t)teum(m3iydopee ivtas aDuax p;u1tlt  o3tasls2ea( pnu0aexrir3iodfpDe nvolt  2uo(o oodalee iesat  2raumoou1alt  i3iadfm rluvsn(4 lxoir ty1om rli ols0t2xmimpio4ameelnes ()a2taxm ;t4ale ifeildls2uaumpnu0aetoiocoa1fp elu i;t srtmxopny1lltnmicsas)a2trxm nu0tet ifctadla uauvp;u0 eeoir oodfmtr neilt0s2tmxrpno4optelictl(  rra(rp;t1oltn o3tytfs2emn p t4aeermfciodfpDrauesl(0srum(mpoo4lptnmnvsl(  2tau  ou1aexnifciaslaDemums;t4arxomo io1oaDraueols0truo(mpny1apenlfcilt)s2tr( o;o1opxnifciydfa rl( snt0artoxociotfatraivo;() 2to(rpiu4oltnliviatfsrtrurp;t0altoio3tld m elu on() etrmr oo1fat aivols t2xm(rpou4ame lnvs (fsrtrxrpou4alen o3tadfs2elnvs u) lxriocoy1lpDe ivs t  2tm(o ny4amtnmneilt  2taxr ;o1aee  oeildlm umn o t0 ltrmoctotlp rauvi ()s2ur(m iy4lmee ivia() rtau o;o1tlt mfcild s2rmumont0 etnxf iotlmt lieo (  rxrio3oo1apt  fct t a2ua( o;o1olt mf3iytfaDemumo u) rerxf iadomD lnvs s)t2xrxopny4op  lnesa(fa2tm(rpno1oet ioeiytfaDem(msnt4 lxnifcoy1lmDrli s t0 2umiopou4alt  nvs () Dtmur no0oet ifeild m2rluvon(0aeeomf iotop rlieo;s t2toio oy4olenmfvsa( arua(  ou4opeo oeils m2ean s (0 leriociodoaDranvols)srtoxm3nu4lm  lfetl( arrmu poo1apeoiictytfsDumuvsnu)artomrcoy1laDe u s t t2tr(mpno1llt  fviasf Duaxr ou0apxnmociat a2ul(vo;t4texnmfctodfaDrai i t)s2xr(rpiodllt mnesasfsrrru  ;u0tptomoctlsla2eln p;u4 reoifcty1lpt luvil()sruoxmpnydlmen nei t)srtr(mpou1aleomfcildfmDrm(vp (0teerif tydfa r ivsl()s2urxm ny4omt lnvtls) 2ta(rpou4tpxomi3tydlm ran p t4 lxnif3oatfpD luvs;( trxmir3iy1apeelfetasfsDtrx  nu4tpxomf3iadfs2eluvsn()tlermf3iatlpt  nei;()t2tr(opnudll nlfcta( sruaurpou1oltnio3iad a uaumsnt4 lxrif3io1fm ranvsls srur(r oo1am  micsltf 2ta(monu4texomi3iltlm2rlu o;u4 rxrmr io1opDeauvi;s0t2tr(m3no1oleemnes (  rtruro;o1opx  fctysfs2rmn s (4aeeoio3tydlatrluvsl()setrxrpiu4ole mivtlsfarta(m nu1aetnifetadfmDean snu) reoio3iatom  lieils0setoim3oydop elnct () rrrxmo;u4tex iieiytlm eaums u0 lxnio3ootfa r u i;( trtmir ny4olt lfctasf Dta(r nu0altniietadls2el(vs u4 rtoxrcia1oa e nvs;t s2xoir3iy4al   ivtl( a2tm(m ;t1ope mfciltfs2um( onu)trtnxr tatfp   n o (0teuo(opoodope livtltfaDuaur oo0aee mfeilsfa ulnmpn(4 rtnir iy1opDeln o s  ruoio3nu4olenmiesasfs2rax o;t1aet  i3tatfm2eau sn(4aetrxrctatlmt ln slt srurimpnodoltnmnvsa( aDrrur ou4tee iociys a rluvonu)arxnmf3tadlm   ivol()setmxrpoy1ole  fctls  rtm(mooo0tet mi3tas a2eaumont) reomo todfpD anvol(  eurxo nodomt mfei tf 2rrxmpot1tltoifcilsfs eauvp u4trtoif ia1fmtr nvs s  rxoio oodomeemicsasf rumurp;o4tpxo ociatlaDrm(mpnu0 rxoxrctytom eln o;(0 ruoxr3ou1lptnmneiatf 2tm(r ot0teeomociadfs2rm(vsnu0trtomocoadfm elieo;( seto(o oydll  mncsat srtrx poo4olxnmi3ils a rlums (4aeeoirctodfmDeaues;s)texo(r3oy1am nmnes sfa2rm(r ;t0opeo o3iltls2uaums t0 rtomrctydfm ran o;s0t2uriopno1lpt  ivsat) 2tau  nu0oexnii3iysfs2rl(vpnu4aeenif ty1fmDrau o s0s2xo(m3ou1lmen nct ()a2rmxrpno4opt ifciatlaDrm(vp t0 exomrcootfaDe neo;t  exrxmpno1lmtemietls) 2rmu onu1tpxn oeiatla2ra(von(4arxnir ia1lpteluvi;( s2tmxm io1apeemnciat) rtmuroot4oexniiciadfs2rl( s t4areomociotlptr uvilt srtr(o3nu4ll  lnviltfsDur(roou0aeeomiciat sDean o u4 lerir3iatlpteaues t0s2trxo iy1opteliesat) Dumxmpnu1teeoio3iltlmDrmu sn(4 reoxo ia1optrlnvs (0t2toir3iy1altn ieias) 2rr(mpoo4aee  feiadla em(vpn(0tltnircia1oat  nvi;s) etoxo3oo4open ivtl() 2rmxr ;u0olt mo3iydls rl(mpnt4trxoxr to1lat lu o;t0srtm(o iodom n fet s) rrmu ont1aetnmictldls ul(mont0arxrif3iotoat  i ilt  rxm(m3ou4op nlfcta() Dra(ront1tetn f3iad s ea( s;t0 etoxrctotlptr ueilt0tetoim3no4ale mfetlt) Drrumono0oeto ieiyd a2rl( on(4 rtoxo3oydfp  aivi;s) rtoio3iy1ameelnvilt)s2ua( onu4alenmi3tyt m ul( p t0areoxf3to1latrlnei;(  rxo(mpno1ome liciat)s2tm(mo;t4aex  feiyd s2ranmo;u) etomf tadopD  ies;( trxm(m io1omt  ivtatfa2rmxm ;o0tpe  i3tatls2ulump;u0trtniociodfm eanvsls t2toxr3iudolenmiciat  2rrx oot4alxo icildfmDuanmpn() lxnxr3oo1fmD au i t s2xm(r3oo1lpt mnctls)s2ta(mooo4oeen iciatlm umnvont)tlerxf oytop raies;t)t2xr(r iydlm n ivi t)aDurum nt0olt mieilt m2emu s;u)arenmf oo1fpDrluvs;s0srtrxo3iudlpt  ivtltfsDua( oou4optomfctltfmDul(vpnt) rtomf3to1lpDrauei;s0s2uo(opiy4omtn fvtlt)aruaur no4aexomfciyd sDum( p;()tetnirctydfmt  nvol(0 rurirpoy1amenlfct sfaruaumooo4oetnioeilt sDrmnvp;(0trtoircoa1fateanvo () eto(o ny4ll elfetl( srrrurpot0tle  fciasls2uln pn() ltoxr tatlp r u i;t tetm(rpno1ap  mivtl() rrrx pot1tpxn i3iad sDem(mp t0 lermocoodomDr n o ()sexm(mpiy4oleelneslt)a2ua(mono4oltn feiasls ra( onu4 rxomr iy1op r ies;( teumimpnydam nmnvi t) 2tmu  no0optomfciatls2ul(mo (4tltomfcoa1fatrln i;s)srto(o3iydom nmiesat)a2rr(rono4tlxn i3iysfmDelnvs;u0treoio ta1op r nvi t0sexm(o3oo1alt mnvtl(  Dtmur ;t0opx  o3iadfm ea( s;u)texrmo3oadoa   uvi;t) 2trxr3nydopee icslt  2rmur ;o1tlx mociydfaDrau s () eermocoo1fmDr iesl(0 exmxr nu4amt lncsa(fsDtax oou1oltnmfciys a ulumpn(0altrxocoa1lpDeaies;s)t2tm(r iy4lptnlfvil() Dum(r ou0open i3iat mDeaumsn(4 lerxfcto1fp eanes;t setoxmpiydaleelncsas  rta(r no0opxniietatfsDul(mp u4tltoirctytop eln s;t  euoxrpno4lpt lncslsf Dtmum ot4aetniictysla ulumpnu4tlxrmfcia1oaDe i o t) eurxm iudop nlfvtas  Drrxmont0alxoio3tlsfa2umu s;t0tetoxf oydfmt auvs (0trtr(o iu1lm   neias a2uaumpnu4tle moeiatfa um(mpn()trxrmrcia1fp   uvols s2xrir no4apt  nvsl() 2uau  ou4tpenio3iatfa ua(vo (0 lenio3iodom   ieslt0 2toxo oy4aptn fcs (  Durum ;o4olenmf3ild a2uan o u)aleoir3tadfat  ieslt)t2tm(o oodamtnmnciatfartmxmont4aee  oetldfs ulu s (4tlermrcoatfaDe ues;t) 2ur(o iy1ol elncslsfaDua(r ;o0opx iociytfm ua( p u4 lxnif tatoat au i;s) exoxr no4llt livta() Dtrx ooo4aeto ietydfaDel(monu4 lxrio ty1fptraiesl() 2umxm3oudam e nvtl( aDrax  ot1opt ifeiadls2el(vs t4altnmo3iadlm raieslt0 2uoiopoodlptnmivi ()s2tr(m ;t0tpeoio3iys a2ran o u)artrmf iydoaD ln o;(  etr(o io1lm nliesat)aDuaxrp;u4ale  o3ilt s eauvs;(0alxnmo iy1oat an o;t)srur(o iudomte icilt)aDuaxronu4oex moetlsls2umums u0arxrmocoodlp e uei;s0t2tmim ny1lpe mivta() Dtaur ;t0tlt  feildlmDuaump (4 rtrmocoodlp r nvo;t)tetmio iodlpen fvsasfs2ur( poo4tetnmo3iasls umnmpnt4trxoir3to1lm raues t  2xmirpiydal   iesl(  2ua(mpno4ale ifeiytlmDuau o t)altriocoytlmtrlivolt0t2ur(o3nodlmee fvsas  2tax pou0alen fciyslm2rlums;()aexnxr3tytomtrai i s seumxm3no4omtn ivta( s2tau  nu0oeenifeiyd m2ul(mp t)aexrxr oydlp rln ols tetmxo iodll e nvsls)s2tmumo;o0apxomf3iat aDumuvonu0tlxomf oydoatraieo;t0 2xoim3oy4ap n ivilt  Drm(  ;o4oltn ociytlmDuaumsnt0 rtnxf iy1opte i o;()setmxm3ny1lpt mfeiat arrm(m ou1ape mo3iytla2el(mo;t)altnmo3tydfpD aieol( t2xoxr3ny1lm e icsasf rur(ronu1alto feild s ul(vpnu)tetrmfctytfate i slt  2umxr ou4lle mivi t  rtax p;o0tetoifctyslaDul(von(0 lxnmr3oy1lm eau ols) euoxr iy4ameemietas)s2uru o;o1tlx ifciytfs2rm( sn()alenmr to1lptrlu ol() rto(o oy1ll  miet tfsDtr(rpot1tlxnmf3iyd mDra( p;t) exoir oy1fm eanei;()teumirpoy4omtelfvt t srtmxmpnu1texo fcilsfmDrln p;t0 lerxf3oadfm eluei (0 exo(opno4omt lnvtls) 2umxm ;o0tpxomieiytfs2rluvp;u) lxoiociytlpD  ivs t0 rur(m nodlp emicsl() Dur(mo;o1opxnii3iat sDrl(vp;t0 ltrio oytopt lu i t) 2xm(r no4opt lnvt sf Durumoot4optomo3iytlaDrmums t4teeoir io1lpDran il(0setmir nu4ap nmivi t)srumxmo;u1tpxnmfeiyd mDul(vo ()tlxnmo to1lm rluvo;s0teumim3iu4ll eliet s  2tmx ooo0oleo ictldlsDel(mpnu0alxrxfctotlate n o s) rxoio nydome  fes ()aDum(monu0tpto fciltla rl( s;t0trerxo todfpteln s s0 etrirpiudlptnlfcs sfsrrmurp;o1olxoifciltlaDrl( s t)tlerifctodfm raivsls  2um(o oudlpenlivs tfsDrmumonu1apenmoeiytfsDemnmpn(0aeenmfciodoaD au s (0 exrir no1lm   neias) Dum(rpnt1tle ifciyslmDel(vp t4trxrxocoytfaD luvi s t2xrxr no4olen nvslsfarrr( p;t4oex mi3taslmDea( p t)artoiocoatoate nes;s0 eumiopiu1om nmivs s) 2taxmo;u4aeeniiciltfm2rm(mo u0teenir oadlmteanvi;(0 etmxo io4oltnliei sfaDumxroou4apxo o3iydls umn pn()artnmo iydoateln s;t0srurxo3io4alen fci s)arua( onu0apx ifctltfm umnvo;(4 exnmo3tadlmt lu s ( trto(r3iu4aptemivt s sDra(  ;u4alxomi3iyd m rmnvp;t0aeermrciytfmDr ieo s) eumxr iy4optelnvil(farum(r ;o4aeenif3ilt a2elnvp t4arxomocootlm   uvo s0tetmxo ou4llt  fvs ()aDurxm oo4opxnmociys m2ua(vpnu0aeenxr3iatom   ieolt) eurxo3no4ll emiesas  rua(rpnu0aleomi3iyd a uln s;u)aeeoxo3oydoa rliei;s0 exoxm nu1omeelieiat)aDrm(  oo4oet  o3iatlmDul(ms;t)trxoiocoytomt aieo;t srumio ou4apeelnetl(farrrxmooo1opxo f3tlsfs2emn o;t) etrxfcoa1faDr i i ( trxo(o no1lp n ivt t)sDtaum ;t4olx ifctltfaDul(mpnt4 rtrxo3tatom  ai s;(0sruoio io1apt  icslsf Dumxr ;u1tpe ifeiltfs uluvs t) rtrmf oadla eluvo;()srxrxopiydol e netls srra( pnt4tetn oeiat a2umumpnu) lxrif3oytopD  n o t0s2xmxmpiodope  nvt t sDumu ono1tpe mf3tat a rmnmo u4aetnif tydfmteaivslt0setrirpiydoptn ictl( a2umu poo1tleo ieiasfm umumo;(0texomf iotop e ivslt)s2xo(m oudapte ivias)aDrr(rpnu1alxn o3iyt mDumnmo;u0 rxoioctodopDe ivi s texo(r oudoptnlnctl() Drmu pot0oex io3iadls2ran o u) rxoifctatla raivslt)s2xmxopiy4aleemfes (farrmxrpno4opxoii3tld sDrluvo;t)alenxf3to1fm rlivs ( s2xmxm iu4lpe lfvtls)arrr(mp;t0aleo icilsfaDrmu pnu)tlxrmf iadlmtrln i s s2um(o iudapt mfesas aDrrxm nt1ale  feiyd m umumon(0 rxnmo3iy1oaDeauvsls) 2tmxopiudlp   fesls  2raump;t4tlxomoeiysls emumo;(0tltoxo3oydomtr uesls0 rxm(r3ny1altn neias)aDtr(mont0optnmo3tyt m2uln o t0tltrmrciadoaDrln o s)teumxm3ny4opeelnesa(fa2taxrpno0oexomociyd aDua(mo (0 rxoxr3iodop  anei;t  rtmiopnudale  fvtlsf rtru pno1tex iietys m rlnmo;t0trxrirctodla r u s;(0 2tmxr3oo1amtnlivsltf rtm(m ou1aex ifciltls2rmums u0artrio oytom eauvi t)s2toim ny1lpeelicilt)artmuro;t0aetoiietat m emn s;u)tleoif ty1faD anvs t0s2xoirpny1lpe  icils arurxmpno0aetnmi3tadlm2ran s;t)trtriociodop  lnvo;s) rtrxopno4ape lfviltfarrrur ;t4tlen fetydlaDrmuvs;(0 ltrir3to1fmtrlieo t)srxmir iu4omt lnvil( s2tm(root1opt mictls aDulnvp;u0 etoio totlmDelies;s setoxr3oudam  lietlsfa2tmump;t0aleoifcilsla ea(vsnt0 exnir3ty1la  au o;s0t2tm(o3nu1lp nlieta() Drrx  nt0olxomictatfm elu p;t4 etomf oodlm raues;t)t2to(r3nydoltnlictat)aDtrx ont0oeen ieiadlm2uanvs;(0 rtnmfcta1fm  lnvsls) rtm(r oy1ol elfetls sDta(mpno4opt mf3tydlm2eaump;t0arenifcia1fa e u s t)s2xmxm3nodaleelivs s)srtmu  ot1opx if3iad sDrln p t4 eenircto1la eanes () rtrxo nydapt mfctatf Dur(m oo0tpx mieiytfaDranvp;(4 exoiocoytoaDeli i;t truoimpnu4ameelfet ()srtr( ooo1altomi3iys sDuauvsnt)altrmf tydomD lu sl(0trumirpio1opt livtat a2ur( p;o1ale ifctlsls2ua(msn(0tlxnmrciytfp r u o;(0srxr(r oo4apen netasfaDtr(monu0texoiictys s rl(vs;u4 rxrxr3tadop elnvi s)sruoxopiy1llt lfcilt  2rmuro;u4alx  iciatfm ua(mo (4 leoxr oatfaDranvi;() rtr(opny1om nlivias  rtauro;o4aptoio3ild a2eanvp t) exnir iydopDr ivo t0setmxmpnudope mnviltf Drm(mo;t1tetomo3iysfs rmnvs t4 renmr tadfaDrluvs;s0tetoxmpiydome  iviatfs2tmxm ou1aet  ociysla2umnmonu4 exrmr3iatla r i s;s) rurxmpnodaptn nvilt  2tm(m oo0oeeoif3iad a uan s;(4tetrxfctydom r uvs t0setr(r iu1omt mncsl( artr( oot0tpt mfeiyd a2rau p u4 renxoctatlat  ieo t0trxo(mpny1omtelivi t aDumxm ou4alxo fetltla2umu pn()tlxnxo iydlat lneilt)s2xmiopno1lmtelncsatfarurx ono0olto iciatfsDua( pnu4treoiocio1opD lies;s setoxr nu4lpen fciatfaDtr(mooo1opt ii3iatfsDrl(monu4tltnmrctytom e nei t s2xrxo3iudal   ivia( artm(mp;t0texniociat sDrlnvs;()arxnxr3iadla raues;( seto(m oy1al nlncsat)a2umu pnu0alxnii3ilsfmDumn s u0aeermocoo1lat liei t t2uo(o nu4alenlfcsltfs2taxmono1teenmfcilt m umu s ()artnir3iytfp   ivs;( teuoxm ny1om nmnvs (f rum( ono4ape  ieiyt m uanmp u0tlenxo tatom  luvs;t0 eurxmpoy1llt lnei s) rtaumont1opx miciat m2umn s;t) eermr tytfpte n i t)trur(m oudll emnvt (fa2raxmooo1aetomictydfa2uluvs;(4aetoir3iadoat auvo;t0seuoim3nu1ol  lfvilsfsDtax pno4ale mo3tyd mDrl(vs;()texnmf3oo1oaDr ivi (0srxrir ny4am   fciasf 2umurpno0tlx mfctadlsDel( p u)trxoio3iytopt ln o;(0 2xm(m3nodllen ncils)sDrmxr nu1alenioeiatfmDra(vsnu) lenifciatomt anvsls0 etrxo3ou4lmtemivils)s2ra(m ;o0texnmfeias sDel( s;t0 eerxociy1op  lu i;( sexoio iudlp n fvs () 2rm( pou1teto oeildfm2rm(vs;() rtnmo3oytop e neils sexoio3oodameemict s)srrmxrono0tet moeilsfm ea(vp;u4arxnmociy1oat ai s;t)trxoim3oydol  lieslsf rtr(rpnt4aetnmictlt s umump;()tetomf3tatfaD lieil()tetoxrpoodam e icilsf 2taumpnt4olxn i3iad m umnmpn(4 rxnxo3todfpD au s;( texoiopiudomt  fvi t arrmump;o0oet  ietasla2ulnvp;t) exnxfciadoa   neo t) rxmxrpoydoltelneia()s2tm(mpou0optnmo3iyd m2rl(mo ()texnmf to1fa rauvi;s)srumir ou4om nmfvtl(faDua(rooo0opxoiieiytfs2ua(von(0 lenmf3io1omteaneo s)t2ur(mpiudamtnlfcs tf Dtmx  oo4altn icias sDua(vo () ltomo3ty1lp eauvsls)trurxr iydaltnlfvsa( a2uau onu1aex iociat a rmuvont4 lenio3oodlmte n i (0 2xoio oudaltn ncia()sDumu o;o4opxoifciaslmDea(vsnu0altrxo3todlmtrlnvilt s2urxr3oo1om  lnci s  ruaxmp;t1apx mocild m um(vs (4arxrmf oy1laDr ivslt0teur(mpoydam  lfetl()srurumpno1aeeoiiciatlm2rauvon(4alxrxr iatop eau i (0setr(mpoo1om  mfvsa(  Dta( o;o0opt  i3iysfsDra(mo u) reomr iotfaDe nvols)teto(o3oy1am nmneiatfarurxm ;o4tpenii3ildls2um(mo;t0aeeriociytoateliesl( tetmxm oy1oltelncsl(fs2ua( pnt4opeomfciyd a2uaums u)tetnxocoatlptrlues () euoxm3oodaleemnviasfsruaxr ;t0opeoioeilsfa em( o u4 renxo3oytlpD luvo;(0s2xrirpoy4lm  mfcil()s2tmum ou1tpeoiieiat m ulnvo u) rerxf tatoa rlieo;t seum(mpnodal emivsa() 2tm(  ;u1teenmieiytlmDrlnmont0trxomo3oadfp rai o;s0s2xr(m iy4al e fvslsfsrra( p;u1aex mociad a eluvs u0 renmo3iadfm  lnes s)srtmxmpoo1lmtemivs t)artmump;t1tlx  ictld aDel(vs ()artrxr3to1fmt lu o t)t2xrim3oo4lleelfvtasfsrtr( pno1aeenmi3iytfmDul(msn(4tetoif3ty1lp  lu o t0s2xrirpoudlmtnmfcias)srtmxr ;u4oleomo3tls s2um(mp t0 reoxf3tadla  auei ( t2xmim3iudal n neilt  Dtm(m ou4openifeildfm2eln p;u4alxrxo3to1omDraivi;(0s2trxr3iu4lptnlict s) Dtmum no4texoif3iad sDea(vs t)trenxr3ootfm  lies t0s2tmio oudal elfct (farrrur ou4teeomictasls umuvo;t) leomr oa1oat lnei s  etoxrpoudame licta(f Dur(  ;o1tpeoif3tld aDum( p;u4tlenxocta1oa raies;t0 2tr(o3ny4olt liesa() Dum(m nt0oeeomi3ilsla2el( ont) leoxf3oytla e n o ()setoir3oo1alt lfeta() rrmxmpnu1oee  i3iatfa emn p;() lerif3tatfptelues s s2tr(r3nudape mics ( s2uaumoou4aee mietld mDumnmo;(0alxnmr oa1lmDr ieo;()t2urimpio1al emfcs s)srur( o;u1olx iiciltlm2ra(mp t4 eeomoctadfp rauesl(0 eumxo io1lmtnmivil( a2taxrp;t1oleoioeiydfm ranmsnu0aetoir io1fp   i o s s2to(rpoodlmen fciat) Drrxmp;u0altn fciaslmDuan s (4teenxo io1la rlnvilt trxr(r oy1ol n fvsas aruaxmp;o0olt mf3iad m rlnvo;()artnmf oy1opt  n olt)teuo(r3iydol  mnesa(fsDuaxronu0tee ifciat a rlnmp;t) lenxo3oodoa   u ols  2tmxr iydale  nvsl()arurumonu1aee ifeild a rmnmo u4 rxoxo iatom elueolt)trtm(m nodal n ivt t  rrrx  ;o0tex iictlsla2rm(ms;t) reoxf iy1faD lnvi ()srxoir ny1am emicilsf 2uaxmono1tlenmiciytfs uanvsnt4 ltomo3tytlm eli ils)t2uoir3nudlm  lici ( srtaxr no1texomieiadls ranvsn()aeenio oatlmDelies;s0 euoio nudlm e fvslt  rumu pnu4oeeomf3iad mDra( s u0 lxnmfcio1laDean i;t  ruo(opoudamte ivs sfartr( onu0opeomieils m2eln s ()tleoiociodfaDeanvs;s)s2uoxm iu4lltelietatf 2urxrpou4apenmoetysls2ran p t4tltnmr tadlp eai slt  etmimpiu1ap  mfvs () rtmxr ;u0oetnmfciys s emumsn()alenxo iadfmD li slt  etmio3iy4optemfeil(f 2ur(  ou4alx moeiydfs2uan pnt) etnmr oa1fptr uvilt0 rurxo3ny1lmenmfvs t aruru p;t4tpeomo3tatlm ea( ont)tltrxo ia1oat ai ol( srxrxm3iy1aptn fes s)arur( p;t1oetomoetyt a em(vpnt)trxrxrcia1opDelieilt)tetoxopiodom n fcsasfaDtmx ono1aee  oeiatfsDuanvon(0 ltrmfcootfm   ivol(0 exm(o3oodal e feta(faDra(mono0aptomfciltfaDrlnvp;u4 etrif oytfaD  u s;t  exmxr iodoltnlivi t)s2uru pno0tpt ifciytfm rl(ms;(4 eenmo to1opte nes s)srumir nu1llenlies sf 2umuro;u4texnii3ildfa emu p (4altomrctotop rluvs;()srxrxmpio1ape  neilt)aDtmx o;u1tle mo3ildla2ulumo;u) exomf ootla e i o t0texr(m iy4ll nmfvtl() 2umu pou1oexo feiltlsDuau ont) rtoxo iadoateli ols) rtriopnu1ome  fci tfarrrurpnt4olxoif3iatlsDemnvp u4artrxfciydomD livs ()s2xmim3oodomtn ivias)aDuaurpnu0tlx  i3tld s2rmumon(4 etnmf todlp ran o ()srtmir3no1lp e fvslsfartrumo;o4tlxoiietysfm2rmu s;t4tltnio3oy1opDeanvi;(0srxoimpoydopte feilt) rtmumonu1optomieils aDuan p;u0trtrmr tydlpDr neo;t truoxo oodom nlici s)sDrau  ot0aex  fctldfa2ua( snt)trxrxo3iy1fat aivsl(  2um(r ny1lpeemfcs tf Dumumoou0alxnmfetydlaDuan o;t)altrxo iotlmDrau ols0t2tmxm iy1ll e nesatfa2raur nu0opx iieiytfm2ea(mo;u) ltrmoctytfptelueo;(  2urxo iu4omtnmfei sf Dtrurp;t1tpt mieiydfa2eaumsn()tleomf3io1fpte nvilt  rxm(m nu4llt mivt t  rua(rono1ole moeiydls2ranvo;u) rtrmf oydfat lneo s  2toir iodom nlnciasf Drrurpoo0aleomfetad sDuln o;t)trxrmr3oo1lpDr u o s) 2uo(m iy1olen icsl(fs2uauro;o4tle if3tyd s2ean s (4 ltomf3ta1opD luvs ()srxoxr3ou4apeemivi ()aDumumpnt4tlx  i3tltfa rl(vp;u0trenmr3tatoatrluvs (0setmio no1ome mietltfsDrm(r nu0opxn oeiad s rlump;t)aetoio iytomteli ol( srxrxr3iydoptnmncs tfarumxmo;u1aexoiociltlm emumo;u)altomr totfmDe u o;( tetr(mpnudope lnctl( sDuru ono1aetnmfciytlm umnvonu0areoirciotfaD  ueslt)srtmxm3ou4lmtn ici s  2ururpoo4tex  ieildlm2rl(ms;t4tltnir3iodla e nei t)t2xmxrpiodom nmivi tf Drm(roou1tlx mfeiad mDrm( o t)trerxr3oytlateau i s  ruo(m3iu1am nmiei tfaDtrx  no0altn iciadls2elnvsnt4teeomr3oydfpt  uvols0s2xrim no1llen fcs t)aDuau  ;o1tlx mfeiadls uau o u0tltrir tadfatr ivs;t sruo(r nu1lpee feils sDuauro;u1tpeomoeildfs eanms;u4 rermrcoydoaDr nvi;t0 rxm(o nu4om nliet sf 2tmxm oo4olxn o3tyd s rmnmonu0alxomrciadoatrln i;t0 2xm(m3no1amte fvi s)sDur(root1tpe  oetls s eaump;(4arermfctatoa rau s ( trtm(rpno4ape  fvslt)srta(mpno0apenif3ilsfmDem(mp (4trenxrcoydopt ln ol() 2umxo io4am n ivt s  Draur oo4apt mfeiltfs2ran o;t)aexomr iadom eau s;t0s2umim oy4omee nes sfaDtrum ;t4tpeo ocilsfaDulu o;t0arxomrciy1fm ranvs;t)teurxm3nu1optemivslt) rrm(m nt1oetoifctltfm rl(mo;() exomf iy1fpt  i o;t)s2xoxr3iy1lme lncia(fsDrr(rooo4oleomictatfm2ua(vs;(4arxnif tatlmteau ilt)t2toiopio1lle  fct ( a2ua(mono1oexo ocilslm2emnvs;u0arenmocoadfptr i ols t2trxm nudap  livs tfarrmx pnu1tet io3tls m emump;()aexoxfciotoa  luei;s)tetrxm nu1lle lfesltfaDum(rpno1teeomoctadlsDuln o (0 leomf iydlp  aieols)sexm(o iudlme mnctl( a2ta(rono4tetomieiyd a rmnvo;t4 rtrio3iotfatrlnvi;(0trtmirpiu4altn fcs (  Drmuront4aet iieiadlmDuln snt4 etoif3iotom   u sls)s2tmimpio1lm nmncslt)srumumooo0olt  ieiytlm rl( pnt0aeerio3ootlm ranvo;s0teuoio iudlptnmnetltfsrtmuro;u0apxn oeiaslsDra(mp u4 exnmr ootlmt anes;(  etrimpoy4lltemfeias a2truroot0alt ii3iatfm2uan s;()artomo oo1lmDeli i s)seumxmpnu4lltnlnvsas s2rmur ou1apxomfctytlm ra(vo (4 lxoio3ootfa eli sl(0s2umirpnudapeelnetls a2raurpot1aeen ociyt a rmu p t4 rtomocoo1omD luvs (  2umxo iudop emfet t) 2rrurp;o4ale ifciatla2rl( s (0 etrmr3oatla elivsls)setrim3oo4aptn ncsas  rurum no4tltoif3tlsfs2ea( o;(0 rxrmf3io1optrauvil(0teum(r ou1omte fvil(fa2rmu onu0aexomfciysfaDea( o;t0trxrio iydfatraieilt)srurxr iy4aptelictlsf rtmx pot4aee ifctldlm2umnmo (4trxrio3tydlp e ueo;t) exrxmpiy4alte fvsls  Dtm( oou4apt if3iat m uan o (0 lenmfciodfpDrlu s;(0 rxoio oy4apenmivilt)sDtmurp;t0oetnii3tytlmDuanvpn(4 rxnif oy1lp eau s;t)t2urxmpoo1op nlfvtltfaDrr(mo;t0tlen ietysfm em(mo ()arerir iotomDrau s (  2xrxo3nudaltnlfvtas)sDrrx ono4oltn ietldfm2eln pnt4altomfctytoaDe nvo (0texoir3nodalte fciltfarrmu  ;u1oltn ieiaslm ulumo ()trtnirctydopteau s s)t2xr(m iodlp e fvias s2tr(  nt0alenmieiasfa elu snt) eeoir to1fmt lnvsl(  rtmio oydomeelnvsls)srtmur no1aetoifciat aDua(vont) rerxr iotlpteluei;(0 rtoxm3nudop nlies s srrr(  ;o0alxnmfctltfs rau o (0alxomocta1lmt  uvolt0trtoxr3oodal   fcilt  Durxmpou4alxomoeiyslsDulnvp;t4trtnxf ia1fm e nvs s0srtrxm3iudamt lfesltfaruax  ;t1apeo fetysla2elu p ()arxoif3todopD anvol() 2triopiudam   ncilsfsDum(  ot4tlt iietas a em( ont4tlxnxo ty1optrau i;(0 2to(r3io1apeelnvtltfs2rrxmo;o0tpe  o3iatlmDel(vo;t)tltnmo iy1oat livi;(  eur(mpnodllt licsl(fsDrax oot4alxo i3taslm2rm( pnt)trenxr3iatomDe nvilt) rtmxr3oy1aptn fcsa(faDua(r oo1oee ifetltfs rlump t0trtrxo iy1fa e neol(  2um(opnodal emietlsfsDumxro;u1ape mfetatfs rlnvs;t)trxnmf iy1lmDeaiei () rxoir oy4lleelfcsl()a2taxm ;o1tlxoiieiaslm rlnms;t0 rxoif iatop e ieo;t0 euoxm3iudlpte net (fa2rr(rooo0tlx mfciadls2rl(von()aetoir3oy1oaD  iei s0setrirpno1ope lics s a2tmum nu1olto i3iadfm2ean s;u0teermf tydlpDrai o t0 etoxr no1al nlieias srtrxmp;o4aeenio3iytlm ran o u4 etrif3tydom  aneo;s t2umimpiydopee fcsa(fs2ta(  ;o0opxoifetysfmDeln s u0tlenxf3iy1lmDrlivols)s2xr(m3oudap nliviasfsDurxmpnt0oexnifeilsfaDrmnvpnu0artoxf3ootlatraivi t  etmxopiydaptn ncs s) rrm( p;u0olt  fetyslm eluvs t4 etrxo3iadfptrluvol()s2toio ou1om n ieta(faDrm(m ot1oee ifciatfaDum(mo t0texoir3iadoaDeluvols)truoir oydopenliesls s2uru ooo1apxn o3iatlm2rluvo () etrmo iy1lat anesl( sruo(r3nu4alenmfes s a2tmu ont1tleomoeiydfa2ua( onu)artrxr iydfa  lu o ( t2xrim nu4olt mnciatfarrmurpnu4apxnio3iltla2eau p;() rermfcia1omDe uei;()t2uoir oy4llen fcsl(f rrrump;u0apenioeiyt mDran sn(0areomrcio1fmDr ivo t teuoio iydlle  nesl(  2uaxr ou0alen iciydfaDuan p u0 lxoxr tadoaD  n slt0 2ur(r oudope lnvtas  rraurooo1aetnioeilsla2emuvo;t4alxrif ty1late nvils0 rxmimpiu4apeelietlt  2ur(  ;u4oetomoetlsla em(von(4altrmocto1lmteaieo ()texrxmpio4llt mnvs sf rumxm ;o0tetoii3ildfs2umu s;t4 rxoxf totfpD lueolt) etoiopiydlm nmiesasf ruaur nu1aptn ociasfa um( p;(0 reoirciatfp ranvils0t2xrir3iudlle  ivt s) 2taur no4tlt ifetad a2el( on() ltoif iydlm rlnvi;(0t2uoxopnu4altn ietl(faDrrumo;t4tet  oetyslm2rl(mo;(0tlxrmfcio1fpDr ivsl()trxm(opny1op e ictl( artm(m ot0aptnmoeiaslm el(vsn(0trxrmociydfateaivo;t0teto(o no1ome mfctas) Dum(rpnt4oexnioeils a2raumonu0arxnifcta1omt  ues s0tetr(r iy4omte fvtls)srta(ro;o4tlx mociasla ulnvp u4tleoxr ta1lptr neil()trtm(o3iudapeelivta(  2rru p;u1tpt moetlsfmDuaumpnt)treomrctotfaDranvi s0t2xoir3ny1ape  iesa(f Dtm(mpoo1aeeniietys a2eanvs ()artoxocoydomte uvs t)tetmir3nydape lfet s)sDrau pno4apxn iciasls2uau s;(0tltnxociy1fate n o ()setrxo3nudole mfvs ( arurxm ;u4olenmi3tasfaDua( s t)aetrmfcoadfa   n ols  rtm(r3iu1ol elneil()sDtm(monu0olxn i3ildfaDemn snu4 rxrmr iydopt an s () etmirpoudaltelics () 2ua( o;t1aee  fciys s ea(vp (4 ltoir3tadlaDranei s0trxrxm nu1op emivtlt arurxm nt4apx mf3iyd s rl(msnu4 ltnxo io1oat  n o ()setm(opiu4ol e fes t) Dum(mpnu4aee  o3tlsfs ua(mo u4trermo3iadfpDrlu i s0srxo(mpoudal   fcs s)s2tmxmp;u4oee if3tlt a2uauvsnu)tetrmrcty1oa  au s ()trtmirpoo1ol  liviltf Duauroot1tpt iictyd m2uauvp u)tetrmf3oodlmtelies;s0trtoir ou1lp   fcilt)s2ua(mo;o0apt ifeiys m2umnvpn()tlerxo oo1la  ai s;s  rxrirpou4omt lncil(fa2uax pnt1tetoio3tatla2um(msnu) reoxf3to1latraieo ( texoxm ou1lm e nesat srurxrp;u0tex iociydfs ua(vs;t)aetrmf3oa1omDr uei;s) rurio3oudalen ivta(f rrmum ;t1aex  oeiyslm ra(vsnt) reoifcoodlpDraivs ( srumxrpiudam elncilt srraumo;o0oetn iciltfm2uaums t4trenxr ia1oa eliei;t0trxmxm io
\ No newline at end of file
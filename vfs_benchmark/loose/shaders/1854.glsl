@@ -0,0 +1 @@
+uvs;t0sexm(r3no1olen net s srur( p;o1tpxomo3iydfm ulumo () exniocoy1oa e uvslt seuoio3nydap elnei (f Dtr(  ou0tpxoii3ilt mDrm( sn()arerio tadlm   uvo;(0 2umxr3oo1lmte fetat) Duax o;u0ale if3taslm2rm( on(4aexoir totopDraivo t0trtr(mpnu1lltnmfcias  rtmxront4olt  octydlm uln o;t4artomf iodlmDr u ils t2xm(m3no4ole mfeils s2raxr no0alto ociatla2ea(msn() rxnio3iydlp ean sls)setr(r3no4ll nmict s aDuaurono0olenmi3iytfs2ulnvsnt0tlenmo totlatranvsls tetoxmpiy1om  mfviat arum(moot4oltomfeias s2emn s;u4 eenxr ty1lpD lnvs;t) 2xrxopoy4lm n ivt tfs2urxrpot1apen o3ilt mDumnmon() etrmr3todomtr nvolt) 2uo(m3oudaptemncsl() Dta(rono1oetn f3iat aDuln pn()texoxo tytlaD  nvs;t0s2xmir oo1alte fes sfaDtaum ;t0apxnmociatls2emn snu)altrmo3iytfm  anvo ()seurxmpou1omeemieilsfsruau ont0ape mictyslsDrlnvpnt0aexrxf iatomDeaues;()t2xoio3oydlltelfcta(f Duaxmo;o1tee  ocildlm2emnmsnt0arenxf iytfpt aneo;t0texmxr iu1lmenmnciat)srtmx  ot1apeo ociysls2umn s;t4texrmf oadlmDr neo;(0s2xrxopnu4amenlfeiatfsDta(rpoo4ale iociysfm uluvp (0tlxrmo3ia1fateau olt) 2tmir iudam nlncia(  rtm( onu0tpxn i3tyd s eaumo ()alxrxociadom r nvs;( s2urxr3no4omee fct sfs2ua( ooo1tetoiiciydfa ea( p;u0 rxnifctatoat ai i t tetrim nodapee icil( sDur(mo;u4oltniiciysfs2ua(vp;u4tltoxf tatla   i ol() 2um(o iy1ap n nvs tf rtaumpno0ape ifetydls rln snt4arenxr iytlatranes;(  rxr(m nydllt  ictls  Drmurp;u4apxo oetlsfa2rmn pn(4artoxr3oodoa elieo t0trtoxopio4opt lnct tfsDtrx  nt1alt  ieias a ean pnt0trtrmfcoytoat  u i t0sruoimpiodom emfvtl(faDrmu p;o4tptnifctad a eln sn(0 exrir3iadlpDeaies s  exoirpoudlm emiei (f rrr(mpoo1opt  octat m rm( snt0 etnif3tadlmDr nvs ()truoxm3ny4ll  mivsls)s2tm(m ot4olt mo3iatlm2el( s u4 renmo tydlateauei t0 2xr(r3oydlle lictls  2rrxrpnt0tpen f3tadfs2ranvo u4tleoxr3tatomD  neo (0s2urir ou4altnlfcs s  2rm( p;o0olxn ieiys a2eln p t0 reoxf oytlmt ai i s0tetrxr oy4apeemietl() rurumpno0oex  oeiysfsDrl( o;u) rxoirciotlaDrau i t)texrxopiu4ll  lnetas a2uaumont4tpt if3iltlmDuln o;(4texomocoo1oa  au i s srumxrpno1ap  mfvi t) 2rrx  no0tlt mieiadla emu p u0 ltrmfctytoa   nvi s s2xrxm3iy1am  mnctat)srumx ono1tetnii3ils sDrm(vsnu)tlerir3ia1lpt aues;(0s2tmimpoo1lmee nes t)a2ra( p;o1aexoifciyt m2umnms;t) rtoio3oydlpDrai s;s  rumxo iydll nmieslt) rtr(m ot4tleoiociltls ea(monu0arermf3todfptrlieo;( teurxm3oy1llt  nvsat a2rax  ;o4aeeo fciadla2uluvo;(0aexomfcoadlm e n ils0 etr(rpno1lpe  ncslsfaDrrurpnu1tleoif3tad s um(vont0trerxf tytfmt lnvs s trxo(o iu4aptn ieslt sruax ono4olx  fcildfm rl( s;t)alenifcoodlmtr i sls) 2uo(rpnu1alte feiat  Dtmu  no4tltomicild a ran p;t4arxomo oo1faDeaueo;t0t2umir iy1am  mictlsfaDuau p;o1apt ioctyslsDuauvo;t)trxrio tytoatrai ils0 2urim3oo4amtelnctas  Drau ooo4ale  ictytfaDrl(vonu4 ltrif iydop r u i (0teuoxo3oy1lptelnvslsf 2rmumpou0oexnmietytlmDeanmpn()alerif oo1fmte uei;t0t2umxo3io4lp e nvta(f 2ua(m ;t4opto fciydfm2ua(mp;t0aeerio3iodlpt aues ( setm(r3nudap e nvsasfaDurxrooo1texo ietlsfm ul(vo;(0 rxnifcoadfpDelieils  rur(rpnudlp e neias) 2umxm nt4apt  feiasla rlump;t) lxrmrciotlmDeluvo;t) rtmim3nodop n nvsa(faDtmxmoot1openiiciyt s2rl(vonu)aetomf3tydlmt  i i t) euoxmpoo1lptn nvtatfsrur(r no0apxniictasfa ulnms (4 rxnmf iy1omDean o s0seumxopiu1om nmivs tfs2trxroot4tetomi3tatls2rau o;t)alxomo tytoat lnvilt) etmio ou1om  mncslt)aDtr(mp;t4tpt mfctatfm rlnms u0 rtriocootfptr nei t)trurxo io1omtn ictl(  Draxmont1apx mociydlm rlnvp u) rtnmocta1op rlu o t)sexrxo no1lmtnmnvsatf Dtmx pnu1aleomieild m ul( on(4 rtniocoodop  ai i;s0tetoiopoudapt lnvtat s2urxr nu4aet  ictyt sDeanms;() rermfcoadlmD lu o;t  rto(o3ny1lleelfet s a2trur oo4tetomfeias sDel( onu)texoif3iy1opt auvs;t0setrim nudlle lnctas)s2umum no1opt ifeiasfm2el(vonu4areoxr ootop  ai slt sexoxopoy4lp   ics s  rtr(  nu4tptniiciytfaDel(mp t4 etrxocto1lm  luvolt)tetmxopny1optn neia()srrr(mo;u0aexniociytfs2emnmp;t0 etnxr3ootomt aueol(0srxrxm oodlpte neil(fs2taur ;t4tlx mf3iydlmDra(vp (0tetoif3ia1laDrlieo t)trurio3iydlltnlfei ( srumxm ot1aexo fciatfaDum( p (0trtnmr ootfm eaivi;t s2umxr3nodll n neils) Dtru  no1oet mociadls2rmumon() rxoxociytlm raueo;t)teuo(mpnudom nmicsasfsrraur nu0teenmo3tltfs ranmpnt4 eeoxf iydlate ueo;()trtrir iydopt mncil(fsrrm(r ;o0tlx iietyt mDeauvpn(0tltnxf tadlm eluei;()t2uoir ny4amte ncta( a2tr(m ou0alx moeiltls2ra(vsnu4 etnifcoodfpDr iei t0srxrxo3ou1lme livtas aDtrx  ;t4aex mfciyd mDrlnvp;u4 reomo ootoa raues;( texmio3iu1optn nvs ( s2tmumpot0tlx  i3tysfaDeaumo u4 eenio io1lp   n slt  rxoir nodlme  fet (f rum( p;o4tpx ii3ildlaDuauvs;u4 lxoxo3iodom elnvi;t)srxmir iu1alen ivs ( a2rmxmpno1aptoifctys mDemn p;t)aeerir3ia1om e uvi ( srumxr3iy4lmt mfci (f 2ua(r nu0tpe ioetltlmDel(mo;t0texrifcootfm ranes s)teuoimpnu1lpt  ics s) 2um(  ;u0tltniictatla umu o;(4tetnmfciadoaDrlu s;( trtoim iy4ap e fcs sfs2ur( oot0opxomfetad mDum(mo ()aeenxocta1lat  neo t)srxm(r iudame  nesat  2urxroou0opx  f3tatls2ran s;() rxomo iy1lm eai ol() etoim iydamtnlfciat s2rmurpno0tetomi3tytfmDrmuvs t0teermo ty1lmtrauvi s)trurxo nu4al nmnct t  Drm( pnu4olt io3iatls el(monu) etomo3oodoatrauvo;t0trxoiopio1openmneil( aDrr( p;o1aleomfctldfs ea( s t)alerxrctydlaDeaieo;()srurxo oodlmeemies t  ruaumpou0tlxomocild s rauvp (0 lxnio3io1fp e neols  rtrxm ny1oleemnetas  Dtauro;t4opt mfeiyt sDra( o;u) rxomr3oytlat  n s;(0texo(mpou1lpeelfctas) Dtr(m oo4teenio3tys s2ra(mo u0 rxrir ia1fp  aivsls0srtrim nodlmen fvslt)aDrmx  ot4ole  ieiydfm rl( s t4aeerif3todop e n slt0teuoim ou1altelfctls)srra(rpno1apt miciadlm uau s;u0 exnif3tatlp r u o s0s2xmio3nudol   ivsas a2tmump;t0aet miciydlm2eluvo;t0aexomr3iodlat auvi;t sexmio no4ope lnei (fs2taumonu4altoifetad m ranmsn()trxoxfciotlptelneo;t)trtmim3oy1amt mies s) rumxm ;t1tpenmf3tysfa2rm( s;u0 lxoifciotfmteli s;s) 2uoxopiodopenlnvt ( aDtrx  ;o1alxoio3iydlm ra(msnt4 rtnxo3iatfptranvol() 2tr(r3oo1lle lnes (f Dtax pnu4tptomo3iatfaDrm(vo;u0 exoxo3oadlaDrln ils s2xm(opiu4lpt  fct (fa2um(ront4ale iicilsla um(ms t4 eermo tytoate iei t0t2trxopnydalenlfetls  rumum nt0aet mi3tytfa2um( p (0arerio ootfpDe uei ()setm(rpiu4lptnlivt s srurumpou1altnmfeiaslmDuau sn() lxnir3tytfaD aiei s0trtm(r ou1alenmfesa(  rraxronu0tle  o3tyd sDumnmonu4alenxocoo1op eluei;() eurir3no1am nlfviatfsrtaur ;o4olx  fcildlsDemums (0 rxomo3oodoa  aivs t  rxmxrpoo4optnmfcsl(  rraur ot4tlxn oetydlaDrm(vo;()teermocio1omtr uvo;s)trxoir3oy4al emfvtl(  2urxrpou4apxoifciat s rmuvo t0 lxrif tydomDe nvi ( t2tm(r3iy1ll  lfcslt s2raumooo1apeoifetys s2um(vp;u)trxrxf3oydfmtrau ilt)s2um(r oodlle  fctlt)sDta(m ot0aex moctasls emuvo t4arerxocta1lp   i o;s srumio iy1apte fvs (fartmxrp;t4oleomfeilt aDranvs;u4tlenxrcootfmt  uvo (0 rumxr3oy1lle micsas)srtaxmpno1tetnio3iytfaDum( s;t) lxomrciadopDrlnes t0sexrxr3oydomeemfvilsf rrmx ooo1ape ifetys aDea( sn(4trtrif iytfa eli s;s)sexmim3iy4lpe lfeil(farraxr oo0open f3tatfaDeau o t)texnxoctodomteluvslt s2xmirpiy1omenmfcsat)arrmxmp;t4tpxnioetlt m elumsnu)artrxo3todfpt an o s srtrio3no4am nlivt tfa2tm(roou0texomociytfm2ea( p u0tlxoir ty1laDr i s ()setmxo iu1ol  mfciat)s2ur(mo;u4tlxo ociytfa2rm(vp;u) eeoif ty1fat li o;(  rumxrpoydomee neiat)srtrum ou0oeeomoeiadlsDra(vsnu4alxrircia1omD auvsl()texmiopoodll   fcias  Dtm(r no0opxo oeild aDua(mo;u)aetrio ta1faDrln o;t  rum(m oudllt miviltfa2rrxrpot0olen o3taslsDrlu s;u)teenxr3to1lp rln ilt0 etoxm3oo1am e icslsfsDumxm oo1oeeo ieiytlsDul(vp u0trtnmf3ootfa eauvi t0 rxoxrpoo1lmtemies t) rrax  ;t1oexoif3ias a2eluvo t0 rtoio3iadoaDeli o () exr(m nu1llee ics s)artmumo;o4tle  icildfm raump u)trtnxociytfpD  neo s t2xoxo3nudoptnlfeilt s2rrxro;o0apxo o3iasfm ua(mp t4treomf oy1faDeli sls0 2uoxm iu4ll   fcsas  Dururo;u0olt mfciyslsDuanvo u4treoxr3oa1fp r nvo ()tetr(m ou4lptelicsl(  Draxro;u0aexnifeildfs2em( s;(4trenif oo1lp  lnei;s) rum(m ou4alte nesl( artrx o;u0tpeoiieiad a2rmnmo;u0tltnio io1omteanvi t  etoim oo4lmenliet t)artaxrpnu1tptnii3iytfm2emnmo;u0tlenmfcootopt aieo s trtoio oodlme  ietas)a2urxro;u0tltnioeiytfm2em( on(0 rtnmfcty1lm rlnvo s0sexmxmpoo1lleelivilt)a2taxmont4apxnmfcias a2eln p;u)teenio3iy1opt auvi s t2uoxmpnydoltemfetat)sDrm(mpnu0tlx  f3iydlmDranmp;t4 rermo tydfmD lu i;(0 exo(r oudlp emicils s2rmxr ou4oee  ictat s2el(mpnu0 rerio tadlmDranvo;t0 2trxo3oudlpe mivtas srua( pou4olxomi3ils a2uluvs;u)aeerifctadlp eli i s0trtrxr3nodal  livtl()aDrm( ont4oee mictltfs2uluvp u0tlxrmocoodom  li o (  exm(o3ny4lmenlfesls)a2tm(ronu0apxoiictadlm2ulumpnt)tlenxr iatoat ai olt truoxr oo1lp   ieslt)sDum( o;t1tlt ii3iys sDumn s t4 leoircoadlat  uvols  rumxo3io1om nmfcs (f Drmxmp;u4tlt  i3iad aDuluvpnt0teenmf ta1om e ivi;t)trxoio3iu4olt mfvsa()sDururpnu1alen feiasls2rmu o;t0 ltrxo3oy1fp r nei s)t2trir3iydlptnmicsas  2ta( poo1olx ifeils sDrmnvsnt4 rtrir3oadopDelivil(0 rtoimpiy1ol nmnci (f rua(  ot0aptoio3tyt aDrluvsnt4arxrxrcoodopDraneilt) etm(o io1op nmnesat)sDrr(  ou4oetn feiltlm uanvp t0tlxomo ia1lmDranvo s)tetr(o3oy4ome mici sfsrtm(monu0alxo f3iys s rm(vs ()artnmf tytfat  u i t0trumxopno1lm nlictat  rta(r nt1olt  ociysfm el(vsn(4aetoxr3oadoaD luei;()texmim oudolenmfvta(farumur ;o0olxnmociatla umumpnu)tltomr oytopDrlieolt setr(o3nu4optelnct ( aDrrxm ;u0open i3tydfaDrlnvo;u)texnio oadfmDeai o;s tetr(r no4al elnctls srumurpoo4apt mf3iysfa2umnmp u4 lxrmf3oodlptrau ol()s2tr(r nu1lpee fvil()sDtax  ;t4olto ieiasfsDrm(vont4tetrxf3oodfpteluvo;(0 2xo(r oy4al  mfvt t)sDta(root4opx ifeiaslm2rmnvo;t0tetrxrciydlp  ln o t)texrxrpou1apt mnvtl()sDumurp;t4tpeoiociyt s ua(monu) exrif3tydfate i slt0t2um(opnu4ol elfvt s)a2rmu pnu1optnmociyt m ua( p u0teenmocoytlptelivil(0 2umimpnodlltnlfcs sfa2rmxr ;o0opxn fciys a2el(vp;t4 rxnircoo1omDe nvilt teurxrpiudap emncsatf rua(rono4olt mf3iatla eau s;t0 rxnmr oa1lmte ueolt0 rtmxm oodll  lietls srraumpou0aleoiictat s elu snu0trxnxr3tadlaD  i s;() 2toxo3nu4altemnetl() 2tmuroot1aetomoctyslsDem( ont4 rtriociytlp elivo;(  rxriopoo1aptemivi s  2um(m no4optomociasfs eauvp t4 etoxo iydfptraneolt)trtm(opoy1lltnlfetls)srrrx oou0tlen i3ilslaDrmuvp u) lenir3iotlmDr iei;t truoim iodllenmnei s srrm(mono4ope mieiysfmDul(vs (0 reoirctodlmDe i s;t)trtrxmpiy4om nlfcia(f rum( oot4tlenmiciat a2rmnvo t4 lenxocto1om r u o;t0 2toir oy1amt lnviltfaDrmu pnt0tlt moetatfa2emumpnu4 rermf ty1fmDr i il()t2xr(rpiu4op elfes tfa2taumont4alxo iciysla ul( p t)tlxomr3to1opDeanvs;s s2uo(r3no4amen ict t)arrrurpou1altoio3ilslm2um(mo u)trxoif3oydomt aieslt) ruoxo3oodapeemnetas)s2rmx oou1alenmfetasfsDeauvs t) rxrio3to1laD au o t0t2xo(mpoy4lm emfvt tfsrumxrpnu1tpe  f3iltfm2ra(vsn(4alxomfcoy1lpt au slt0trxoimpoo4lmt lfvsa(fsDum(ro;t0ale iocilsfm2ua( snu)tleoif3iodlmtr ies;s) eur(o ny4oltnmnetlsfsrumxront0oee  f3ilsfm rl( p;t)areoxf3oydlp   i il(  2umio nu4om e iviltfarrrum ;t4tpeomo3tasla2rmnvo u4arerircoa1lmD auvil()t2xoio3nu1lptn ivils sDrm(moot4tpeoif3ils mDemu p (4aeeoir oo1lat  i s;s0t2urxm3iodopeemfeils)a2trxrpno0alx mociad a ea(vo;u0 ltrirciotopD li sl()t2umxmpoudal nlnvsas)srtaxmonu1aeto i3ild a rmuvon() eenmo tatfa eauesl() etmxmpiudol nlictls)srtm(m ot4oet  icils a2ra(vo (0texnmf3ta1laDelu s;s  ruo(m ny1lptemietas artm(rono1opeomfeild mDumnvpnu0 ltrmociatlpD lnei (  eur(m3no1optn ivi s sDrmxmo;u4tpxnifciatls2eln pn() etoir iydfm elivsl( truoxo ny1ol n fvs t) rtrxr ;o0oet ii3tyt mDrl(mon() rxnxf3totlpte uei t)trxoxr oo4oltnmnet s)sDrru pno0tet  iciysfa2em( s;t4aeerifcoa1fm   i sls) rtrxopiodamte ietlt)aDurx oot4apeoioetysfs rl( o u)tetnif3ootlmDeauesls s2urxopiu4lmeelfvt s  Duau onu1aetniociasfaDrln p t0aexrio todfmt anvolt)trtmirpoydllee ivi (  rumx  no4apen o3tydlaDrlnmo;u4artnxo tydfp  lu i s0teum(m3iu4ome lfctl()a2ur(monu0tlxoifctatfaDulnmsnt)arxoxr oatlmDeau s ( truo(r iu1opte netl()aDuaurpoo1oeen feiad mDua(vp u4trermf3ootlatraies;s) rxmim io1omeemiesls  rrax poo0teeomiciydfmDeluvo;t0alxoxfctydop r uvs ()trxr(opiu1lme  nvsasfa2raxmont4teeomfetltfs rmn ont)aleoir oo1lm r uvo;( seur(m iy4ape lncil( arrax oou4aex iieiysfa uanmpnt) leoir3iydlpD lueols)t2xoio3oo4al e fetlt) 2raxro;u4oleo ietldfs rlums u4 rtoifciy1opDrau il() exoxopio1olenmivsls  2taxr nt4tle moetyslsDrm(mpn(0texoio3tadoa  lnvs (  2urio no1amtn ieiltfaDumu oou1tlxn oeiysla emuvo;t0 rtomf ootoa   u i;t  2uo(opoy4lme lfcils)artax  ot4tle iieiltfmDrmuvo t)artrxo3io1omtelu i;s seuoimpio4omtn nei s artrx pnu0tee io3tlsfs em(vpn()trenifctatop   nvs;t  exrxm3nu4om  lneias)arta( ooo1teeomi3iat a rmuvo;t0 etnmf3oytop rlies;t trur(o3iydolt mnvsat srtr( o;u4alxoiieiyd aDuanvo t4tltrxr ty1omteanvo (0 exmxopoodllenmnvil(faDumxmo;o0aex  ieiltla rl(vsnt4tltrmr3oydfa eanes;(0trtrxo3no4lle  icsat)aDurumoot1aptomfetad mDrl(vs u4 exrxr3iotfa  ln s (0teuoio oodop n neia() Dtrumono0tlxn ocils s rmumo t)artoxrcoydoatrauesl(0teuoxopiodam emfctlt sDtrum ;o0ole mi3ildfm rmn p u0 renxrctodfp elieo;( srtoiopoodlleemfvslt)srua( oot4aetnii3tldfaDrauvsnu0 lxnxociy1fpDrauvo () rum(m iydaltemiei (fsDua( poo0alt mfeiys s ra(vs (4areomr iodfaDrliesl(  etm(o iydopenlictasf rua(monu1ale moeiaslm el(von(0aetoir3oydlmteli s s)teto(m3iy4optnmfcsa(  2ua( p;t1olxn ictytls2el(von(0 renxr tydom raivi;t) ruo(r nudape  iei t  rtm(rono1oet  o3iyslm rmuvonu4 lermo3oy1fpDrli ol()t2tmir iy1amen fei s aDrm(m ;u1tpe mf3tytfm2ulnmont)aetnxr3tydlpD ln olt trtoxm3nodole  feilsfa2rm(m no4tex  i3iytfm2rln o;u0trtrmr oa1om rli ols) rum(m ou4alt mnct sfsrtaur ;t0oex mfciadfa emnvo (0alxnxoctydfmt aiei (  etrxo iu1alte icsat  Dtrurpnu1apxo fciadla ua(mo;()tltomocoydfaDrauvi s0 2xrir3io1ole lfeilsf Draur no0tlxniieildlm rmu p ()alermr3to1fm eln s;t0sexrxr3ny1ll nmnctat) rur(ront0alxoif3ilsfsDuan o;t4altoifcty1opD ai i;s s2trim3nu4lmenliet s artm(  nt0opx  ieiltls2elumonu)aleoio oo1omte u i t  ruo(o3ou1omeemivsatfsDumu  ;o4olx iiciyd sDulu ont)texnmf3ta1opDrai sl(0s2xrxr3iodamt mici ()aDtaxm nt0tlen ieilslaDrl(vsn()aexrxrcia1fmDelnvo s  eurxopnudole miciasf ruaur ;o4tptn f3ilslaDumuvp t0tlxrirciatop  ai sls s2toimpio4apte ics (  2uaxronu4olxn ieiyslm raumo;t0 exomrciadop eauvi;( t2uoim3nu1al elivtltfs2ra(rp;o4apeoiociatfmDeaums;u4teeniociodfp r u sl() exmxm nodopt lfvs (fsrraum ;t1apx io3iat sDuauvs;u0 etoxf iodfmD li i s  2xrio iydlm nmfcslt s2ra( p;t4apto feiaslaDel( p (0tlxnxo to1om eli s t0 euoim oo1ape  net sf rtauronu1oexnioctldlsDrm(vo u0alxrio3iotlat  nvols  etmxr oo1lme  fet ( sDua(m nu4teen o3iatfm2ua(vp;(4 reoxr3tydfmt aivs s0 rxoio3ny4apt livs ( s2rm(mooo1oee ifeiadla ra(mon(4trenmocoy1om eauvs;(0sexmimpiu4amen ivs s)s2ua(ro;t1olxn fcilt a2rlnvo (0 rxoiocoytomDe nvilt) etr(o ny1ap e ncils)sDuaumooo4tle  o3iyd s2rm(mo u0alerio3oytoat auvsl(0t2umxmpou1olt livia(f rua(mp;t0alt  ociysfm2raumo;(4tlxoxoctatopt ai s;(0sexrxo3iudoleelnvilt)s2taxroot1tle ioeiltls ulnmpnt) exoxfcoatoptrln o;t0trxr(mpnodoptnmivsltfs2rrxro;o1tpx  f3tldls2uaums t)artoirciy1lm e n s ( s2tr(opno1lm e nei t) Draxr ;o4oeeomo3iltls ua( s;t)tlxoio ty1fpDr nes;t0 2toxm3oy4al  lfvi sfsDtaumpou4ope mocias a2rl( snu0tltnmf3iytoaDeluvils0texmir oodlp e fcilt  rrr(rpnt4opt  f3iydfmDem(mp () etoxo3ty1fatrlieol( texo(r3iu4ole  neils)s2ur(mo;t0tlxomieiatls2rl( p;u4 exoio oy1op  ln o (0s2trirpoy4ole mfetl( srrmxm ;o0ole  fctysls ea(vp;t)texoif io1lmtrlnesls0t2xrio io4lp  lieiltfsDrr( pnu1teeniieiatlm2ua(vp;(4alenmf oa1lp   u o ()sexmxmpnydlleemiviat aDurxm nu4olxo i3tyt a2ea(ms t4 etnxr io1fa   n i;t)s2trxm oydllen fetlt s2tr(r ou0apeomieiyt a rlu o t0 etrmrctadom e neolt0 rxoirpnu1lp nmieslt s2urx p;t4aetn i3tlt aDrlnmp;t)aeeoiocty1lm eauvs t) 2uoxm3io4amen nvtl(f 2tmxr ;u0tlxomi3tldfm2ra(mp;t) leoxo oodlp r uvol() etrxm nydapte ieta()a2taxro;o1tpe io3iytfsDumnmp t)trtrio3totfp elu slt0 2trim nu1omtn ncilsf Dtmuro;o4opt  fetld m2emu ont)alenxo3oatlmD  u slt  2xrxmpnydaltnlivtlt  Dumurpot1ape iieiatlm ul(von(4 rxrxfcoy1fmt lieils sruoxr nydoltn ies t sDrrumonu1aptomfctasfs uanvs;(0alxoxrcia1fm rlivo;(0 rxrxo oy1lptn netltfsrrrx o;o1tex ifctld m uluvs;u0trxomf3oo1fmte u slt s2umxr oo4ol  lnvils aDur( p;o4alt  fciatfs2rmn s;t0tlxoir3io1lmD lieil( setoxrpou4lme mfci t) Drmurooo0oltnmf3iytfm ulnmpn(0aexomr oo1opt lneols0srxrxm3ny4amtnlicsls)aDta(  oo0tpto o3tas aDrmumo;(0artnifctadopt anvsl()t2umiopny4al nmnei (fs2taumonu4oetnio3ild m ran s t)arenmfctydfmtrai s s  euoxr nu4alee nei (faDurxr no1aex ifctlsfm2ea(mo (4 rtrio io1fpDr neolt teuo(r no4olt mnctlt sDtmx ono0tlxo feiatfa2um(mon() etrxo3oadlmtrau i;s  2trxm3oodom   ncs s a2ua( o;t4optnmfciatlm ulnvs;t4alxrir iotfpDrau i t  exmxrpio4open fvsl(  rtmx o;t1oltnifetldfs2uaump (4aeeriocia1fpDraueo s)s2trxm oy1ome livi (f Dumxro;o0tpe mo3tydfs rau pnt)aetnifcoadomD luvi;s)t2toio3oy1ame lncs t sDrru pot0ape mieiatla2elu pnu0treoxf tydomt au ols) exo(m io1lm  mncsltfa2trx ono4aetn ieiysfs uau pnt4areoxr iy1fa  ln s s t2ur(r nydlleemnct s)arur(moou1alen fctatfmDrlu sn(0aetrxo iy1faDrlu ils)trxrio3iy4om elncsltfa2rmx  oo4tet if3iasfsDulu p (4aeermocoodoaDeaivslt0 rto(o oy1ol nlneiat  2ta(  ;t1aeeo fetasfa uluvs;t0aetriociatlpD ai il(0s2uoxr3nudape  nvil()aDtaxro;u4aex  i3iysla2eanvp;u)altomrciatoaDe ivs s  2xrir3ny1lp  lnet t arrmum ot0tleomfciyt s2rmnvpnt4tlenmf3oatfpD  uei t0 2toxrpnu4ome lnvils sDrr( pno1olx if3iad aDranvpn(4arxomfcio1lp  auei (0srtrxopny1ol nlfvtas)arrrxr nu0texnmi3iat a ul(vp;(0trxnxr oydlpDrau s;( teuoxo3ny4om   ncsasfartruroot1aleomiciadlm2uln p t) exnmo3tytlatrluei;s  rxo(o3oo1op emfct sfaDrrx p;t4apx ifctasfmDul( s (4arenio3iotfp e ivi s tetr(r3iodll  lfvslt)artmur ;t1opxo fctadfm ra( p;u0teeoio iotlp  ai sl(0teur(r iu4ameelnet s srtrxrp;t0tee mfeilsla2ea( onu0arxrmo iadop r n sl()trxmio3oy1ope mivsa( arrrxm ot0oex  o3iyslaDul( o () rxnxo tadlpt  ueo () 2xr(rpoydapenlneiasfarrmxmo;o1oexniieilslm ul( p t4arxomo3oydlp  li o;t0sexm(m ou4op emfvilt)aDraxro;u1tlt ioeiadla2rl(ms;t)alxrifcoydfa rlnesls)srxr(rpnydop elictat srrr(mpot0texnifcildla elnvp;t)trxriociodfpDr n ilt tetoir3iodlmenlncia( aDrm(rp;o4oetoiieildfs em(vs;u4aetrxf oadopteauei;s0t2urxo no4optnlfvs ( s2umumpno1apt  oetydls2rl(von(4teeomfciatfpDraiesls)srxoxmpno1lmt lieslt a2raxrono4oeeoiietys s2ua( sn(4 reoxf3iotla   uei;(0 exr(opoy1amt  nvtatf rtm( ont0aeeoiieildfs2eluvont)alerio3oadomDeanvo;( t2tmxmpio4ll nlfes tfsrrrurpno1apto ieilt a2rl(vsnu4 lxnxocoydoaDeauvsls  rxoxo3oy1olte ivs (f rur(mo;u0opxo ieiltlaDea( p u4 reomo3to1fat aivo;( truoxmpno1amenlfvsl()srraurp;o0apxoii3iydfa2rl( pnu)alxnmrctytfat  n sls)srxmxr ou1lmte ieia( aDur(roou1apx mo3iadls2eanmo;t0aexnxfctytoptraiesls0trtr(m iydllen fcias)sDrrxrp;o1alto ociad a2rmumo (4trtrxociy1fptrluvs t truoim iudlm nlnctlsfaDra(r ;t4aet mo3iaslaDrau s u0arenirciadfm  livsls0srtoirpoo1lme  nvi sfs2ta( oou1teeoii3ias m emuvo u)aexrmf tatfp elu slt s2umim3oudoltelfvsl(  2ra( oou0oexnifeiyslsDrauvo t) lxrmf3iotoatr uvol( t2uoimpnudop emicias  Dtrx ooo4aetomfctasfm2emnvpnu0alxrif ty1opte uvils srtoxopiu1lpt liesatf rtm( p;o1tetn oeiyt a uanmpnu) ltrxo iodlp eai sls texrxr io4lme  ici ()s2tax  no1alxomfciydfs umnvs;u4aetoir oa1lpD lueilt setm(r3ny4al emnctlt) Durxmpou0alto fctls s2uanms u4tleomfcia1lm   nvo;s)srum(m iu1al elnvtas  rraurono0oleomfeiadla2ua(ms t0artnmrctatlmDeaieols  rumiopnu4ll   fvslsf ruau ont1tpe  oetltla elumpnu0trxnircoa1oa eaueol(  2xoio3nu1altnmnctl(f Drm( pot0opeo fetls aDeaumo;u4 etrif oo1fmDr uvi s seurir oo1aptnmfvs t) rrm(rono1aee io3iyd s2rlums (0aeeoxr3todop e ueils0sexoxm iydamt lfvias a2ua( ono0ope  feiasls uan p;t)trxrxr oo1lmtelneol( trxmxo3oy1om emnetlt)a2umur ;o4tpeoiociadlm rl(vo;t)artoxf oa1oaDrai ils)t2xmio3io4om  mnctl(f 2ta(mp;t0aeeo i3tad s umnmp;t4tlenxf io1fp  ai s;s0trxmio3nydalenmiesl( s2rmxro;t0oltomfeiyt s umn p u4 rxrxr oo1fa r ueol()sruo(o nodlmenlfeils artaxro;o4oetomi3ilsfmDuaums u0teeoxr3iotfaD ln o;s0 2ur(o oo4ame  nvtls  Duax o;o4opxomiciad sDemn onu)tlxnifcoodop  aueils)s2xoir iu4ale mfeilsf rumx ono1tex ii3iat a2ean s (4 rtrirctodoa e u o;(0teuoxr3iodlltnlieslsfaDtaxr ;u1tlx mf3iysfm eanmon(4tleoioctydoptranvslt s2tr(mpny1am emncilt)a2raxro;o4tlx ifeiat sDel(vo;u)tlerircoatfp ranesls  etrio3nodomtemfcsl(f 2uru ont4aee mi3iadfm2em(vo;t0arxrmo3oa1la  livi s0 2xmxr3iy1amenmicsl()srur( ont4oexoioetytfa2um(vp t0aexomf tytlmDran i (  rxrxr nodlltnlnvilt  Dta(rooo0ope mfetysls rl( s ()altnxo3oytlmtrli ols)setm(r nodoltelnviat a2rmu oot1alt mfctltlaDran s (4teermo iatla e nvols)t2uoxo iy4op  mies ()aDrm( pot4oet  f3iadlm uanmonu) rermr3tadfptrlivolt) rtoir nodoptn fcta() Duru  ot0oexnmietydfa raumo t4 ltrxrcoo1fmtr u i;(  rtmxrpoodaleelivtat sDtax ono4tpxomociysla2uluvp;u4tetoxr ta1late ivs t) etoimpny4amenmicils  2rm(ro;o0oeto ieiadfm eln p;t0trtoxf3tatlm  lneo;s tetoim3oudoleemfcs sfs2rmxm ot0oetnmieils mDeau s t)tltrifctadfmte ivi ()teurir3iu1om elfcilt sDtmxr ;t0oleomoctyd aDea(vonu0 exrif3tatlmDrauei;t0s2umxr3iy4om e nctat)aDra( oot0opx  fcildls2ra( o;()texnmr tadomDr uvo;(0 ruoio oydol  lfvtlsfa2uaurpot0opxnifcils m2emuvpnu4teerxo3iy1omDrau slt t2toim iy1oleelncs tfsrtax onu1ale mi3ilsfs2eanvont) lxoio3tadlmDeanvils0 rurxrpiudomeelfes (f rurum ;u0oexnmieildlm ra(vsnt4teeoif3iydfat au s;t) 2toimpiy1lme  fvi sf rumxmpnu0aee  o3ilslm2ea(mp t)tlxoxf iy1oateln s (0teum(o3iydale  ics s  Drru pnt1tpxomieiasfm emn s;t4 reoir3todfmDrlu ils srur(rpiu4lptn ncs ( aDtm( oou0tpxoifetadfm rm(vpn(4 eeomfcoatlmtr ueol()srxmir3oo4lptnlicia()sDrr(r ou1altnmoetltla2um( s;u0trxrmr iotomDe i s (0 rtr(opoo1lmtn netltfs2ta(m nu0oeeomf3iasfm elumsn(4 rtoifctodfp eai s t)setr(r oudalte ivt t)aruru oot4altnmf3tytfa rl(mp () ltrmf3oa1faDe ivo (  rum(o nodap emfvtlt sDrrxr ot1oex  iciys sDrluvp;t0artnmf oatfmtraivilt0teur(o3iy1ol n neia()srtm(mooo1teen feiytlm2ea(vpn()trtoxfcoo1omDrau s;(0 2urim ny4amtelnct sfaDrr(m ;o4oee  ieiatlm2umums;u4 rxoxocoadoaDeau o t0srtrimpio4lle mfci t) 2rmx ono0oltnifeiydls2rl(vp t)teenxr3oytoa  anes;t)tetoir oudamtemnetls) Dua(ronu0olto fetydfa rlnvo u)alxnif oadfaD  nei;(0t2tm(opoy1amtnlies t a2urxmono0tltoiiciad s umu o u)texnmo oy1lmtr nes t)s2umirpoudole livt sf Dum( poo1aexo feiltla ea(msnu)alenmocoydlpDe ieslt s2urxopiy1oltn fvtas) rtmum no0olxomociltls2uluvs (4aeeomo3oatomteanes t0seur(rpno1al emfct ()srrrumpoo0tpe  i3iasfm2ua(vs t4 eerif tadoa e n slt)s2ur(opou1omt lnvtas)aDrm(mo;o1apeo oeiaslaDemuvs u4aleoio3io1oa e nvolt s2toxo iy4am  livilsfa2rrx poo4aeeo f3tas s emn o;() leomf3iodoatr i sl(  etr(m oo4llee nct tfaDtau  ;o0oltnmociydlm rm(mpn(4alxnif ia1oa  lu o;t truoirpoudalee neias srtru ont4teto i3iyt m uluvpnt4 eeriocia1op   u i;t) 2tm(m iudam e nvta( aDtaxrp;u1aexnif3iydlsDuaumont4tltnif ia1fm  an o;s0teum(o oydlm emnes t)arraxrp;t1alx  i3iysls ea(vont4altrircoydopD anes;() 2uo(rpou1lpe  nesl(fsDraxmpnu0aptoioctysfm ul(mont0 etomrctatomDe i i s0srtr(o3iydal nmnci tf rrr(  ;o1apxomiciltlmDuaums;(0 exrxo ootfpte i i;(0 rxo(rpoy1llt  fvsltf Drr( ooo4oee ifeiys m2ulump;u) lxrmf iodfm   nei;( seumxo io1om e neta()aDrm(  oo1aet ii3iadlmDum(ms;u) etnmo oytlaDrau ils srtmxopiu1ll  lietatf rtmump;u0tlt moetatfs2ul(vs t0areoiocoadfm  liei;(0trtoxr ny1llenmietlt)sDuaxmpnu0aptomietlslsDrmnmsnt0 rxrirciadlat  u ol( srtmir3io4olt  nct s)arrrx  nt4apx  o3tlslm uauvsnt0 eermr3oatlp elivi ( texrxr nodoltn ncsls)aDua(mpnu1aetnioeiat mDrm(mp;u) etrmo3ia1lm  li s;(0 2xoim ou1apte ies t)aDtrur ;t1olt ifctas s emnvs u4areomr3iadla r ieol( trumim nodop  lncias  2tm(m nu1tlx mo3tld a2umnmpnt0 exrircoa1oaDrlnvo;()srtoxm3io1llee ics t sDrru ono4openmfctas a2rmuvp u)texoxr3iy1fmDrai sl()t2trxo oy4lptnmfvi tfarurxmp;u4olx mfcildlsDul( snu0trerirctotlp eln slt)srxmiopnydll  mictas sDumur ;u1altomi3tas sDrau p ()tetoxf3oadla   i s;s0texr(o oy1altelivslt)srra(rpno0alenmieiatlm rlnvo t4aexoxfcoodlm e iei t)trumxrpnodlmtelnvsat  2umxrooo4oltnifciys a2um(vsn()arxoio iadfm rluvs s) rtmxo3oydlm nmfvt ()sDuau  no0tpen fcilsfmDrmnmp;u0aeenmocoy1lp elnvsl(  rxoir iy4op   icias sDuru  nt1oexnio3iatlmDra(vo (0aeerircoa1lat  u sls s2xmxr3no4opeelnvi t sDtaxr nt0tpenifciydfs2rl(mp u0trerxo ia1laD  u s (0 2tmxo io1lp   icsat)aDrr( p;t1apt ioeiltls2ua( p u4teermo3tydfm e ues s0setm(m ou1lle lnvils) 2rmu  ;o0tpe  oeilt s rau p ()trxnxf3oa1lmtrluvsl( t2umxmpiu4om elivtat) rrm(  ;u1alx  iciydfs ea(ms;u4alenxo3ootla e ueils  2tmim oydll n fet s s2ra(monu0alxoii3ils a2emuvo t0aexriocta1oaD  u s;(0texmim3iydamtelfci s arurxmpoo0tlto i3ildfsDulnmp u0teerio3oatlaDeauvil(  2xoxmpny1lltnlnvtas  rrmxmo;t0texnif3tltfs ul(vont)aetnifciatlm elueo;t)s2xm(o3nu4ll n icsa(f ruaurpou1tlxn ocils sDul( p;()arermf iotop eanvi () 2toio3nydopeemfct t) rra(r oo0oex mi3tasfs elumpnu0 lermf ootomtelnesls0t2xoxm3iu4ol e ncta()s2um( ono1altomoetlsfsDemumont4trxrir iytoptrli olt)texmio3nodalt mfct sfartmum ;t1teen oeiyslm ea(vs;u4 lxnxo tytfpteanvo;t0srxrxo3oy4lm emfvtasf rtrump;o4opx  fcild m uanmont0arenmo oa1oatr neolt)trum(m3oy1lle mnesas a2ta( o;o4aex  octaslmDeauvsn(4 exoxr oatopDeluvi;t)texmimpiy4lle mivs s) 2tmumoot4tpxnioctasfsDem( p u0arxomr3oy1fpDeaneo;s  rxm(r3ny1al n fvtat s2ua(mpnu4apenmociadfaDel(ms t0tlerircia1fmtrauvsl() 2tmxrpio4lpt livi (fs2raxr ;o4tex ii3tltlsDulu p;t4 eeomociotfm  anvs;s)seurio nydllen icsat)s2uaum ;o0tltniiciatfa emnvpn(0tlxrmf oo1lmD  ieo;s t2urxr3oy1aptnmfesl(f 2trum ot4texomi3tytfa2em( p;t) lenxo3tytla   ivo ()setoxm3io1olt lfctltfarumxmpno1tleomfcilslm2umu pnt4 rxnio3oadom  ai sl(0 exoim3io1lmtnlfvta() 2tmumpou4ole mfetatlm rau p u4aleoxoctytfmteln olt0 rum(o oydolee fvils) rtmumoot1ole mf3tytla2ulnmo u) exnifcta1fmD auei;()trxmiopio4ape micsls sDrruroot1tpe mietyd aDum(mo;()altrxr3oadlpDeauvi (  rxmxrpoy1ol nmfeias arrrx oou4tex  ictytlm2um(mo t0 rxnmo oadlmteli s t s2xoiopou1oleemivtltfaDta( ono1aee mo3tytla2ua(ms;u0trxoirciy1lpt lu il(0trtm(r iu1ol n iesa() rrauroou1tpt mi3ildfaDrmu snu4artnif3totlmt lues t teur(r3io4alee nvtlt)aDumurp;t1aeeomieiyslm2ra(von()aeeoio totfat lieo t)tetmiopio1amtnmiesa() 2ua(r ;t4teto ociatfsDra(vpn() lermf iytfpD  uvi;s)teum(o oy4amtnmneta() rrrur nu0alxnmfeiys s2rm(vsnu4artrircoodlaD  nvo;s seum(r oudom elfetl( a2ra(mpnu1tle iiciat mDulnvpn()artrmr oytfaDrlu i;(0s2umim3nu1amt lneslt)a2tm(  nt4aet mo3ils a2ranmo u4aleoif3tytla eaivi;( trxmxm3iy4lptelfvtl() 2raxro;u4teeomi3ildla ra( sn(0 etrio3oydoa e uvi;t) exmirpiudole lfvta()aDrrx  nu4apto feildfm ulump ()tltrmo3oytlmD lu s ( trxoiopnodoleemictat a2rr(rp;u0aeeomf3ilsfsDemnvo;u0artomr3iydfpDeaiesls  2xrxm ny4lp  lnei ( aDtrum nu0tlenifcilsfsDul(monu0 etrmo oodlp  auei ()trtoxr iy1omte nvtl( sDtmxmoou4tpxomoeils m2rmn p (0teerioctodla  lies;s s2trxrpnudomtemnct sf 2rrx poo1apen ietlsla2umump;u4arxrmf3tydlatrlnvi;()srxrxr3nu4llen ncsl()sDum(mpoo1ope  ictydls2rauvs;u0trxrmf3tadlp r uei;() 2uoxopiudomt  neias  Dra(r nt0olx mieiadfs2uan s u0 lenif3iotoa eai i s0texoirpio4altnlfviat)arta(m oo4aleomoctlsfs2umn p () etrif ia1lpD  n s;s0 exrxrpiy4am nlfes tfs2ua(mpnt4tleoif3iatfa ua( s;u0arxrxr3ta1la raneo;t)s2ur(o3nu4ll elics t) 2um(rp;o0altnii3tldfa2ulnvpnu4trenxr3tadopD aues;s0texoxr3oy1ameelfcslsf 2ra(m ou0aeto f3iltfs2emumsnt) rxomrciatlp e nvs;s0setoim3iy4lpee nvt t)arrrxr no0oleomociytlsDrlump;(0arermr3to1omDe ueil() rtrxm io1ole licsas  rtrx p;o4aeeo ietatfm uan s;t0artomfcta1fatr ieol()setm(opny1lpen feil(fa2umxr nu4alxo ieildfm2rl(mo;u)tetnmfctodfmtran o t  euoxopnydom nlivi tfs2tm(r ;o0oetnmfctatfsDulnms;u)aetrmr3io1oa eliei s) rurxm ny1oltelics ( arur(rpnu1tpto fetyd m ua( p t)arxnifciytlatranvo s) ruoxr oudopeemfci (  Dua(mo;t1aeto icils a2ea( s ()aetoxo3iydoat  i sl()t2xoxr ou4aleelietatf Dtm( pnu4olx mfeiytfs2em(mpn() reomfciodomDean i (0 rxmio3nu1op nmnvilsf 2raurp;t4olenmoctlt mDul( o;t0tlenmrcty1fptr uvo s)t2xrxr nodlmte neta( s2tmx o;t4apen fetytfm2uln o u4 rxoxo3todlmDelnes t sruoio3iy4opeelicils  rtaxmo;o1oexoifetls m2uan p;() leomr3todomDranvs s0trtoxrpoy4om elfvil(  2um(mpno0olen feiltfs2uauvs;()treoxrcoa1fmt anvs (0t2trirpiydapeelfvs sfa2rau  nu1openmieiytlmDemn p t)areoif tatfmt  iei s texm(mpiy4al  mncta()aDrrxroot1aee mo3iytfm rmuvp t4aleoxo3tytfa  lnvo (  rxrxm3ny1opt lncsa( a2rax  ;o0optoii3tlt s2rmumpn(0tltnifcoadfp rauvs () euo(o3iu4lpee fvtat)artrxmp;t1texnmicildfa emnmp;()trenxo tatfmtelneil(  2xrxmpiy1lleemnesatfaruaur no1tlen o3ildfs2ea( o;(0 etoxocia1lpt aieo t) 2xmio3ny1lmt  fvil(fs2tauronu4alt ifeils m2ranvont)aeenxf3oadomtr u s;t) 2toir3io1ame mietas a2uaum ;o4apen ieiadla umuvo u0 renif oy1laDelueils srxmxr nu4ale  fei t srra(r oo0aetnii3iys s ulumo u4 lxoircoy1lpt lneo s) 2xrxr iudameemiviatfs2umxmpnu0ole iictasfsDul(mp t)aexrif tadlaDr n olt)srur(r3iydameemnetls) 2tru ont4tlxoifeiys m rlnms;(4trtrxf ta1fm   u il(0 2xr(r3nu4opee fcia( srururooo4apt  ieiyslm2ranvp t) rxriociotom eai o t0s2to(mpio1lltnmfvil() rrm(  nt4oexn ictat aDrlnvon()trerxr3ia1opte n slt t2xrxr iy1ol elfcsa(f Drrumpot1tlxoiieiyt m elnmpnu4aleoxrcio1fpD an s;s t2xoir3nodll nmivi s  2urx p;u1oeenio3tadfaDelnmpnt4 eeomr3io1lp  au s;t t2xmxm3iu1olenlfei s  rtrumoou4ale  f3tlsla2ulu pnu4tltomfciy1oat  i o;(  euoiopnudom n fct s)sDta( pnu1aeeoiocias s rm(vo u0trxrir iydop   ivo (  rtrxopnodlmee feiasfa2rmu ono1oex  fciat mDran s t0alxnxr todlmt  nes;()trtmir oo4lp e ieias) ruax  oo1olt iieiysfsDum( p;u0arxnmo3ia1om eau s;()setrxmpoy1apenmfvil(  2umxrpno0oex  oetldfa2rlu o;t0 renio3tytomD ai ol() etrirpoy4opeemnesat)sDtm(r ot0tetomoetys s2umnvont)trtoio oo1lptrauvs s0 rtoir ny4ll nmfeiat aDtr(mpnu1tee  ietlslsDemums;u0tlxrxf tatomte neol(0trtmir oo4am nmnes t)s2rax  oo4apeomf3iadfa2rl(vpn()altnmf3iodlmt aieol( texmxm3oydoptelfvia() Dumxmooo1oexnii3tys m rm(msn(4trxoxo oa1laD au ol(0srumim iy4ap elivtlt  Drmx  ;t0tetnmf3tldls2umu pn(4aeenxrctydomDrluei (  euo(m3iudlme  nvs tf rur( onu0alto ociysfaDea(mp u0tlxrmr iadopDrli s;s t2tm(opoo1amenmfctltfarta(mooo1texoifciasls2um( o t4 lxoir3iadfaD livs t)teurxo3no1olen fes sf rtmum ou0aexn o3iasfa2rlumo;(4arxomr tytoatranes s0 rtmxopoy4al elivsasfarumxrpot1tetn icildls ul(mo t0 lxrmo3tytlate nes;s)texoim3ou4opte fvia()sDum(m nu0optomo3tasfm rluvsn(4 rtrmfciadlm  an s ()teumirpnu4om  lnvs ( a2um(ro;t1olxnifciytfs ra(vo;t0alxrxocoydopDelivi;()trxmir3nudolt  fcsas a2taxroot1tptnmoetadfm rmn s () lxrxocoadop  aivils teum(o3nodape  nctlt)sDtmxm no4oleomieiaslm uln onu4tleoiocoy1fpD aiei ( t2tmir3oydopt mnvt (  2ua(m nu1oltoiociys a ran o t0aleoif tatlatraueilt0 etm(r3no4aptnmivtltf 2rrumpot1ope mfeiasfs2emuvs u0 rtoio tydfmD lnei s)srxmio3oydom nmfct s a2rmxm no1optomietyd s ul( p;t4treoir3ta1lp   nei t0 eurxo3nodop n iei t arur(  ot0tpto feiydls2eanvpn(0 etrxo iydlp ran o t srtoxmpny4oltelneils  2uax  ;o1optn fcias aDrmnms ()arxrxo iodfptranvo t srxrxmpoy1am e nvt tfs2ta(m no0aexo feiys m2uluvs;(4tleomfcia1lpDeanei () euoxo oodalenlicta()arra(  oo1opt  o3tyd m2el(vsn(0alxnxr3oa1om r ieilt0texrio ou4amtemncs t)aDrrxm ot1altomi3iyd aDrln o;u0tltnmoctodlm eaiei ()srtrxopoo4oltelict (  Dtmxrp;u4opt  ictatfsDrm(mo;() rermocoa1lp  livs;t0truoxm3oydlpt  ivi t  2rrxm ou1apeoioetytlsDrl( o t) leoir3iadfpDranei;t  rtoio3nudolenlnvia() Dtr( ont1aetnmiciltfsDel( snt4 eerxo oy1fm rluvslt0 2uo(opiudop nlfeslsfsDrru ono0teenmoeiysls ul( p t) rxrxfciodom rlivsls) ruoxm3nu4lm nlnes s  rrmxmpnt0oltomiciydfm elu p u)aeenxr iotfp e i i s) euriopnu4om  mfci (fsDrmuront0tpx ioctysfsDum(ms u) etnxf3oodopD luvsl(0trumirpny1ap   ivslt  2trurp;o4olxnii3iltlm2ul( s;u0 lxomfciydom  aueilt)seuoir3ny4oltelnes s) 2rm(mooo1olt moctasfm2ul(ms;u0 lxrir3tydoat  ieil(0srum(rpnu1lpe livilsfs2trxrono4ape mi3iysfs ra( onu)aeenif totoptr neolt)seurxrpnudamte fesat) Drr(r ;o0oleo feiytla um(vs;(0arxnmrctodfpDr nes t srur(r iydllt liei ()artmx  no1oet ii3tld m2elnvp;u4tlenio3iadlmDe ivilt  etoxo3nodape mfei tfaDumump;t1olx if3tys a elnvo;u4arxomf3iytfm rlnes ()texm(m3iodope lneils)artmur nu1opto fctadfs2el( pnt4trxomocoo1opD aneolt  exmxrpoodopt mnvtl(f rur(mont0tleomfctlt aDuln p u0tltoxocoa1laD  i o t)texrir3oy1omtnmfvil()aDurur ;o1aexoiociyd s2rlumo;(0 exrmo3tydlate uei;(0seum(r ny4lmtn ivia( aDumxroou0apx iictldls ua(ms u4aeerxr iatomD au i;s)srtoxr io4lpe  fctl(  2ra(mont0tpt  feilsfa ra(mp;()tlxoxfcty1lp rai sls0s2ur(o3io1amte nesl(  rtrx  ot4oltnifctasfm ulnvp;u0 lxoio oatlpt lu s t)sexoxm3nodape lnctat) Duaum ;o0aee if3tltla el( s;u4 rtoxfcta1lp ran o;s) exmio iy1lmt livs t a2ta(mp;u1texnmf3tyt m2rmu onu)teenmo oa1lm elnesls  etrxm3ny4omtn ivsa()aDua(mp;o1oeeomo3iasfa ulumpnt4tlxrmf ta1om   u ols trxoim3io1apee fct (fsDua(root4teto iciltlsDua(vo;u4 lxrxr iotop eau s;()t2um(r iodll nmiesls aDrr(mo;o4oexoio3tatlm ea(vp ()trtnmr3tatoaDe u s;()t2trxm oo4lpt lfvsltfs2tmxm nu1oetnmfciasfm eanms t0artrir iatfmD  nei;(  2tr(mpou1alt mfeia( s2trxrpnu4tlx mietldlmDean ont) exoio totop  aues;s) rtrxo ou1lpenmncsl()aDtau o;u1olxo f3iysls ra(mo;u) lenxf oo1lptrlivo;s trtrxmpio1om e ics ( arum(rpnt1opeo f3iltlaDrau p t) ltnmf3oy1latr i s s sexoimpoo1aleemiviasfarumxr ot4texomfeiltfmDelump;u) leoxfciodfm raieil(  2xmxo3oy4ap nlnetl( artmum ou4apxnmf3iys sDulu o u) etnir3oadfa r ies;t seurxrpoudlle mnvs t aDtm( onu0teto o3iys s ul(vpnt4alxrif oydfpDelnvi s0 eurxopoy4omtemfetl()a2ua(mp;o1oltomf3tadla ea( pnt0tltrif oa1fmteli ilt0 2toio no1lptelncs (  2rrx pou4tpe ioctasfs emn snt) ltoio tydlaDrau i ()srtmimpoo4lpeemivtas a2trx  ;u1oltn ociyd m um(vo u4 exnir ta1lmDrauei;( setm(o oy1apeemfct (f rtmxr ;t0tpto o3iadls2em(vs (0 eeomo oy1la eln sls) exr(m3oo4ap   fciasfsrrrxmpnt0oeeniocild aDemnvo (0aeenxo3oytopt lnvol(0srxmio3iu4ap emfcsat)a2um( poo4tpe ioeildfa em( ont)tetnmocoydlmDr ueo;t t2trxopio4om  mneil( aDur( o;t1teeo i3tas a um(mp;t0 etrir tatlate ieils0s2uoirpnu4ap  lneta()s2tau o;u4teeo oeias mDem( on()aeeoxo3oytopDelnes s) rtoim ou4om nlnvias)s2ta( o;t0tlxnmo3iatfs rmu onu0aeenmociatom e nvil() etmxo3nydalenlivilt s2raur nu0alt mfeiasfaDumnvs;u)alenmr oodomtr u s s trxmxopno1lmtemfvs sfaDta(ront1oleo ociadlm rm(vont) eeriocoodfmtrluvo s t2tmxo3no4opeemfciat a2rmxro;o1oeeo o3iasls el(vpnu)artnio oytopDrliesl( trxr(opiu4lp   nci t  rtaumpot0oltomo3tas m eanms t0 lxoio3oydfmt  i s;( s2xo(o iudomtn ncias)a2umxro;u1tet mi3tad a umu ont4teermrcoy1lm ranvs;s0 2xr(o3nudap n ivs ( s2rr( pnu0apt mfctyt a2emu o t0 rxnio3oydfa  an ols0 rtoimpoudaptelfctasfa2urump;u4altomf3iysfa2um( ont)arermr ootfm ean i s)teurio nudllen fctlt  rta(r no4oltomf3iysls2uln s;()texnmr tytfpDeaivo;t) rtrimpou4olenlivtlt a2trxmoou0aex  ieiltlm rmnvp;t)tltnxo todlm  anes t  etmim ou4lm  mfetatfa2rru p;u0oltomicilsla eauvsnu4trtrmo3oa1lpDeaivsl()t2umiopnodolenmfvtas)s2rm( p;u1tpt ioeiys a uluvpnu4tetoxo3tytopte u o;t0 rtrxm nu4amtelfci s)srta(mpoo0tpeniociysls2umump;t) rxrir oytfpDe n sls0t2xoim3iodol nmics t)sDrmxront1alen i3tad mDelnmp (4alermr ta1fp elu i;(0srtr(r no1am  mfvs t  Dra(  ot0aleoifciyslaDran pnt4trtomf3iotlp rau sl(0 2xmxo iu1alen fetl(fartax pot4ope mictldla umnvo;u0tlermo io1oa elnvi;(0t2urir3iy4ol elnetlt) Dumu pnt4aptn o3tysfa uluvo (4 leriocta1omt  nvil(0teuoim3nudolt  ictls)srua(m oo1openioetaslm ra(ms t) lerxf iotfm rlu s t)seuoiopny4altnlfet (fsDtrxr ;t0opeoiietyd a2eaumo;(4arxnircoo1lat lueo;s  2uoxr3oudalenlncsa(f 2ur(  oo0tpenioeiytls rl(ms;t) ltoxr3oo1om   nei;( trtoim ou4am e neiasfaruaxm ;o0alt mf3iad a eln p ()trtomfcoo1lp  auesl(0 2uoio3iu1amtn ncs (f Dtr(r ;o1optn octat a eau ont0 lxniocoy1omte ueil() rxrir3nu1op   fciltf rurxr ou4oetomieias s2ra( s;t)tltnmr3iadlaD luvo;s tetrirpoy1aptemivtlsfarrr(m ;o1oleniictldlmDum(msnt4tlxnxo to1omtr nes s0seuoxr iy1amt mivsat sDurxmo;t4tlx mociydfaDumnvsn(4aetnmf3tydfm eln s t tetrir3oo4lm  lfcias) 2um(r ot1alt  ociys s umuvsnt)texoxfciadfm ranvs s s2umimpno1ol n ncsasf Dtmx pot4opt mfeiysls2rlnvsnt0aetrxr ootlp raivs;t srxo(o iy1om emneia(fa2tr(ro;o0tpxo fciadfa eanmo;u0aeeoircoo1lmt  iei;s) etr(o3ou1lltn fetat s2uaxmpnt4tpeomo3tydfs rmums t) rerxr3iytfpt luvo t  rtrim3ny4omenlfeias)sDta(r no4olto oeiltfmDumuvpnu0 renxr3ty1lptelneolt s2uoir iy1ol emnet ( sDtrum no0oexnio3tld sDumn s (4aexrxfctydomD an olt s2tmxm3oy1optnmiviat aDur(  ;t1altnioeiltlm rm(mo t) leoxrciytfmt lnvi t0srxr(m3nodamenmncsat)arrax  ou4opeoii3ildlm ul(mo;(4tltoxr totom elu o t  exoimpoo4lp emfesl(  rrmumo;o1tlxn oeiyslaDemn o;u)trenxf oydlmDran slt  2tr(opou1am  liciat) rrm(moou1oetnii3taslmDem(ms;(0trenif3iadlmt lneo;( srxoim oy1ole  fct ()sDumx  ot1altnmfciyd m2em(vsn() etoio3iadomD lu i (0srtoxopno1lp nmncsat s2ra(ronu4texoioetldls2ulnmo u4aexriocoodfm r i s s0s2um(r3nydlpeemfcsasf 2ra( ont0oetomf3iytlmDum(mpn(0tlenif iadlmteauvil(0tetrim no4ameemnesls aDrax p;t1tpxoifctat sDrmnvp;t4texnmf3oo1oaDrlu s;t)sruriopoudomen iciasfaDum( oou1tlx if3iatlmDeln s t4aetoiocty1faDr nvs;t)t2xoxr3oo4lmee iesa()arur(m nt4oleo i3iyslm2ul( ont0 lxnxo todlmtrluei;(0sexmxm3oudom  livtl()srrmx  oo0tet  f3iytfsDuan o u4areoxrcoa1om rluesls  rtrxrpny1ap elicta(farrmumpoo1apx mi3iytla2uaums u) leoxo3iodomt luei t  exr(o iudamtemnvt (fa2tmx o;t0aee  ietyslsDeanvpnu4alxrir oo1faDrlivols0t2toim oydoptelici (fsDururont4texo f3tltfaDrmnvpn(0tltoxrctadop eaneil()trtoim3oy4aptnmnetasf rrrx p;t0aetn fctydlmDra( o;u) etomrctodfp elueol() exoxm ny4ll nlnctlsf rua(m ;u4opeo ieias mDea(vo;(0 lxnxocoa1lmD ai i t)srtoiopoy1am elfeslsf rumx oou0ole  icilt sDuln p u0arxrio oo1fmDeluvil()trxmirpnu4al  lfetas  rumu ont1olxn icilsfs2ul(vo;(0aetrir ty1omte n i;(0tetoxm3nudom emict sfaDtr(r oo1apxniietat a uaumo;()teeomr3iotlmD anvil( trxrim3no4lp   nvt s) 2tru onu0tet mieiys m rlnms t4tltomr oatlp  luvi;t)trxmxopiu1om n ivilsf Durxm ;t4ole moeiyt aDumnvsnu0 exrir ootlaDran o;t t2xoxmpiudllenmnvil()a2rru p;t4oeeo o3ilt m uluvp t4alenirciadfa r ueo;s0t2uo(opnydom e ieias)a2taurp;o1opt  feiatlm2eluvp;t0trtrmo iadfmtraivs t)teur(m oy1ape  nvsasf 2ta(ronu0apxoii3iad m2ea( on() rxomoctydoaDraieo;( srtmio3iy4op   ivtlt  Dtaxmo;o1oexnmicild aDea(msn(0tlxnmrctotfpt ai s;s  etr(rpnu4oltemfeia() rumuro;t1altnioctltlsDra(vonu)aeerir3oydfpDr uvs;(0t2xoxopiy4omtnlnvsatfsrtrxr ot0alt mfciltfa ean p t4alenmocoatlm ranvolt) 2xmxm3iodop elncilt sruaum ;o4alenmociadfmDelnmsn(4 lermf iotlpD luvo;t0sexoir nodaltelivia()artrx  no1apen ictlsla2umuvp (0trxrxo ta1lmD anes;s teuoirpio4lp e ics (fs2tau  oo4oleomfciltfa2ranmo;u)alenir3oodfatelneil(0 2urir ou1lp  lnvias) rrmu oot1oetoiociydlsDrl( onu0 etnif3tydfpt luvs t0 exoio3oydlp emnvsas) rrrurono4texnmfeiytlm2rlnvp;u) rxnmr3tadfaDelieils0s2umxmpiu4lpe lneiltfaDrmx  nu1olenii3iatfsDraumpnt0arenio3ty1om   nvi (0 exmirpou1llt lncs s arurxmono4teto iciytfa eaums;(0arxnir todlp eluvo;t) eumio3ou1alenmfeiasfsrtmxmo;t0tpen i3iys a2ea( s;u4trxrir totlmt aiei;t)t2toir3oy4lle mfesl() Dur(rpnu1oeeniieiyt m2ua( p (0trxoxrciydfm rlu ols0sexmirpiydlle mncta(fa2um(mpot4aptnmi3iatfs rl( p u)aleniociydom rau o (0trum(m3oydlmtnlivtls a2rmumpno0tltnmi3iysfa ul(vp (4tetrif tadlmDeluvo t) rxr(r3oo4lle  icta(fa2tmxmo;u1tetoioetlt m2rmumo t0aetomrcto1latr uvo;(0setmxo3iodap e neslsfarur( ono0teeoio3ias s2rm(mp ()aetomfcta1opteaivs;t0texmxo3iy4lptnmfvia() rta(  oo1alen o3ildlmDulnmpnu4trtomr tydfmDrli i t0srto(rpny1open fvtls)arumum nt0opeoiiciytlmDrmu o () rtrxf3iydlptr uvs t0teuoim iu1ame  fvt tfaDrau  nt4ape  oeiydlsDulumont0aeenio3io1opDr ues t trto(m nodope mfvtas)s2rrxrp;t0apen iciytfaDemn s u)tltoircoadop e nvs;()trur(rpio4ap nlnvsl( a2umxm ;t1opto fetydfs2el(vpnt) eermr3iodlmDr ivs;s)t2tr(m iudopen fvsasfa2ra( p;o4opx ii3ilt mDelumont0altnxo3ta1la   i sl( srxrxopnu4ape lfvta() 2rm( o;o0oex  ieils m2rmuvp (0tlxnxf oodlmDeln s;s)sexr(rpiy1apenlfvtas sDumurp;o1aleoifctadfm2uauvp;() eermo3oadopD  nvs;t)trxr(m iodlme  netas) Dtau p;t1tee  f3tydls umnmpnu4trtrioctadfpD  uesl(0srtoxo io1opte nei sfsDuaxrpnu0tpeoiietad a rau p;(4tlxrir iadlp eln o;s)tetoimpoodlmtelivils s2um(rpno1aptniictytfa eaump;()trxoxf3iy1oat aueo;t  rtoio nu1ape mnci s a2rrum ou1alxomo3ias s ran pnu4aleoxf3ta1oaDrai i s)t2tmim3no4llee fvs tfarrmum no1tetoiiciad aDum(mont4 renxr iadfatelivi;(0t2xmir3ou4ope  nes t  2ua(m ;t4tpenmociydlaDrmumont0tlxrmocoatom  auvs t) 2xr(opou1ll nlncta()a2tru ono0apxo o3iytfmDuaump;u0aleoir oytfpD li sl(0 rxrxr3oydame mivsa(  2rmx ono4aleniiciysfm rmnms;t0aetomocto1lmD aivi ( s2xmio3oudop emics t)sDuaxr ;o0tptnmfeiysfm eauvp t4tetoif3totlmtrlues;t0 2xrxmpno1olt lnes (fsrtr(ronu0aee if3iatfm um(mon(4tleoif3iotlm r ieo ( sexoxr iy4om n ictasfs2rm(rpot1optn f3tytfm em(vp;t)texoxr to1laDeai i t)setrxm3iodlp  lfvtlsfs2tru  no1ale  feiaslsDemump;t4 rxnmr3ta1laDr i o;s) etmxr3no1lmtnlivtlsfartrx ooo4apenmf3iyt a rm(vpn()aeermo3iatfmt an ilt0 eurxmpou1ll nmnesat)a2urx pnu1texnioeiltfs rm(vp;u0alerxf3ty1lpt aues;t0setoiopnydlle  iet t) 2tru  no0oeeniieildla rmnmsnt0 lxnxo ootlmDr nvo;s texrxo3iudolenmnvsa(f rurxmpnu4tptoif3tlt a2rl( sn(0teenifcoo1fmDrln s t)tetmxm3ny1om emicsa(f Dtmumo;t0oleoifeiytla2uan s u) ltnif3oydfpDeluvs t0 2xrir3ny4ll nlnet () rtru o;o4ope  oeild a2umuvo;u4tlxoxfciodfa   ies t t2toxr nydol   ici () rua(mpou4alt iiciat a2ra( p;()trenmr iodoatrau s;t)sexoxm3iudamteliviat  Dur(mpot0olenioctys aDulu s ()aleriocta1lmte iei;(  rxo(rpno1opte ieiat  Duaxmo;t0opx mo3iytfa umu ont0 exnmrcta1lpDe i ilt s2trio io4lpte fviat) Dur(moou0texnio3iysla raums;u0treoio ia1fmtrln o;s trtmxr3oo1lptnmivs ()sruaurpnt4tetn f3tyd m uanms t0trtoxfcoo1fmt lu i;( s2xoio3io4al nmneslsfs2trxm no4tptomo3tytfa2el(monu4 rtrxociytfmDrlnvs ( s2urxmpoy1omenmicsa()s2rru  ou0tpto f3ild sDrlnvsnu)trxomfcootlmD lu o;t0t2umxrpou4apen nei sfarurxmo;u1olx  octltfaDemn on(4aetomocoo1fmD  i o t0tetm(m nudal elfvs t sDum(  ;t0aetn ictad a2uluvo;(0tlxnif tytfpD luvilt)t2xrim oy1ap  micsa(  2rrx pnu0tpt  iciadls ra(vpn()trxomo iy1lpDr uvo;s0sruo(m3oo1lptn ncias sDrmump;t4oeeniociasfaDul(ms (4 leoifctotfpD au s;s)sexm(mpoydom nmfcil(fsDumxro;t1aetn octltfm2uanvs u)arxrir io1lpD  u il() rxm(o3nu1alt  nes s)sDtr(rpnu0oexoif3tyt s um(ms;u4trtniocoy1lpt  uvolt0texmxopoydoltnmfeia(fsrrmumpot1alenmf3ias sDran ont4aleoxr3tytlpD au s t0t2xm(r oo1ll  mncia()aDtmum ot0tee io3iat sDeaums;t0trxrircio1lm rau i () rxrxm io1al emivsa(f Drrxm nt0opx ii3iadls uluvo;u0aleoir tytopD lueils srumirpou1amenmfvil( aDtaur oo1apeoio3ildfm2ul( sn(0aleoxrcia1lpteanvi ()trtmxm3iy1ameelivt s)a2um(  ;u4tlenmfciadfs2ul(vonu0 etrmf iotoaDe i il(  2toxrpoodamt mivil()aDumur ;t1aetniiciyd a2em(vonu)tlxrxf iy1faDrai slt) 2urxr ou4ole miet sfaDtmur nt1oee mfeiydls2raumon(0tlxnxociadfpDelueilt seurir3no4om   icslsf Dumumpno1oltnmicias mDeln ont) exnxr iotfat li o s)teto(r3ou4lpe lfes ( srrrxrp;u4opeomoeiysls2em( o;(0artrmfctotoat  u o t  exm(m iu4lmt  ictatf 2rmuroot4oex ioetlslm um(vp t)tetrircto1oat an s (0 rtoxrpiudom emfcsatfaruru pnu1oex mfeiatfs2uaumo;u4 rtnxo3todlpDr uvi;s)sruo(m oodaleemnctlsfa2urur ;t4aexnifcildlm2ul(mp t) rtrmf3iy1fat lu i;s)t2xrxr3ny4alen fcil(faruaxronu0opxo ictldfm2rm( onu4alxnxr oatopDeauei;s0 rumxm oydlpeemici sfsDtax poo0aex  i3tldfs eaumonu4aeeoiociy1omDelu o s  2tmimpiudlm nlfvsasfaDrrxrpno0olenif3tadfa2rlnmp;(0 ltrxr3oytfm r ieilt0t2um(mpoo1lptn fvilt  ruax o;u1oet moeiltls2umuvo;t) etomf ty1om rlneils)sruo(o oudam elicsatf Drmu o;t0aptn oeiytfa2el( s (4tetnxf3tydfaDraiei s  rum(r3oudlltnmnvtls sDrmur ot0aptomieiyd mDrmu snt)tlxrif totlpDeaivil(0sexm(r ny1opt  nvi tf rtaxmo;o1tetnmietaslmDeauvpnt)tlxnmf oadfmDeluvs;s)texr(r oo1ap nmiesat srum(mooo4ale  o3iasfa ranvo;()alxrxo oydla rai s;( trtm(m3nu1lpt  net t)s2tm(  ;u1alx  i3ils s2raump;(0alerxf ootlp rln ilt0s2trxo3ny4lmt miet t aDtrxm ;u4tle iieias a2um(vsnt0tlenmf iydfpDr u s;()srurxrpio1olee fct t artrump;u4opxoii3iyt m ranvp u4aeeoxrciadfmtraies s0t2xmxmpiu1omtnlfviasfarrax ooo4texo i3ias a ra(vs;u) ltrif iy1lp  aivi ()teuoiopnydole lfei sfaDur(m oo0teeo ieiytlm ea(mo u)teerxo3oydfatrai s;t0trxoiopoydaltelfvi t) Drrxmooo1tpxo i3iyt aDem( p u0arxnxo3ia1opDeln i t0sexo(m ou1opte fct ( sDraxmoou1oetomo3tltfa2emums u)areomo3oodoaD  i s;s0 2uo(o oy4op elfeil()a2rr(  ot4ale iietlslsDra( o (0 exrif3oodfa rli ilt tetm(o nudlpenmivs () 2ra(m oo4aleo f3ildla2rmnmsnt4 etrmo3oodfp rai i s)texoir3iodalenlietl() 2rrumoou1aetoii3iatlsDrm( ont)texnxrciadoa r uvi;s) 2to(m nu4ap n nct sf 2rrx  ;o0openmo3iys m2rlumo t4 ltoif3ta1latelu i (  ruo(m3oudamtn fcsl( srtr(mpot0tpt mfctls aDum(vonu4aexrio oatfptrluesls)srurim io1amee nvt sfartm(ro;o4opt ifciltfsDuauvs;u4tetoif ty1late u i t  2uoio iu4ll emnesls  rua(  ou4apxo fciydfs ea( s u0aeermo3tatfpD li ils  rtrio3oo4olt  fetl(fsrrrxrpoo1oltnmf3tyt s2el(vs t4 exnxo tatfaD  u ilt tetoxm oudol emivsa(  Drrumonu1altnmicild m2ea(mpnu)trtrxfcty1fa elneo t texrxmpou4lp  mivi s aDtr(rpno4alen oetyslm2rlnvp t4aexrxo3tydfm  aivi (0 2tmxm3oodopt lnvilt  rtr(monu1teenmo3tlsla rmumo;t0 ltnif3tytoa rli i () rtm(mpiodom nlfetlt) rua(roou4oee  ieild m2el(mpnt4altrirctydlm rlivs t)srtrio3iodopt mnvil(fa2tmump;t0tle ioctyd mDean pnu4tltrif iotfpD ln i;(  etoim3nu1om  mfciat)srumumonu4tetn ieilslmDemuvp;t)aexnxocoodfptr n o () exoxr iydlle  nei s s2uaxmpno0opt  fctldfm2emn o;(4trxrifciydfaD an i t s2uo(o3ou1lm  lfct s sDumur ;t4tee iiciyslmDrlump;u4tltomf totfa elu i;t0 rxmir oodal  mict s) rua(m ;t4tlx mfciyslmDumnvs (0aexnio tytfmtrln i t0 2uo(o3iudlpen ivsa()a2rr(moot1opxnmfciytlm2ul(mp;(4 exomrctodlmt  uvs ()trur(r3oo4lpte nciatfs2uaum ot0olxo fciltfm ranvon(4aetrxo3ta1oatran s (0srtoxr3oo4om emfctasf 2ua(r ot1apt mfctyd s2uanmon(4arenmo3oy1lptrln il(0 etrir3nudam  mfcil(f rtr(ront1apxnifeiasla elnmp;u)tltrxfcty1lm r u sls0texm(r io4op nmfcsat)sDtru oot0texn f3iadfsDelu p;t4tlxomr ta1faD ln i t) rtmir3ou1llt mictat s2ta(r nt1olx mf3iltfs2rl( sn()altomo io1lmte ueo;s) etm(o3iy1lpt  icslsfsruau  ot0tpxo icilsfm rm( pn(0arxrif3to1lpte i i;s) etmxrpiu4lmt mnetlt sDrrxmoot0olto ietyd s2rmu o t0 renmo3oadfatelies;(  rxmim3oo1ol nmnetasf rtru  ;u4aexnmf3tltlaDelnmont4 exomf ty1fp eau i t tetrxopnu1alenlnvtas) rrm(  ;o4apt micildfa elu pnu) lxnmr iodfpDe nvsls) rxrir3ny4l
\ No newline at end of file
@@ -0,0 +1 @@
+n olt s2tm(r oodlmenlfctls aDta(  ;t0apxo icias s rmnvs;(4 ltnxf3iodfpDranvsl(0 2xo(rpno1olt lfvta(fsDrmurp;u1tetoifctas a umnmonu)artnxf3oodla   neils0texrxm3io1ll nlnetl()aDrrxro;u4altniocias s uau s u)arerxr3tatoat luvils sexriopiydap   fctat) Dururonu1apxoioetltfs umumo;()aetnmr iytfa  ai i;s)srxoirpnu4al  mncsatfaDur(mo;u4tex  f3tytls rlnvp;(0aetrxf tatomte uei t0srxmio iudlm nmnctl(f rtm(rpnu1teto oetyt a ra(vpnt)tlenxoctydfatr ivol(0s2xmir3oo4llee iesl( aruaum nt0ale ii3iadlsDran on(4 exrxo3tytfaDr uei;t) etm(m ny4aptnmnvt tfsDtm(r oo1tpeomo3iatls rmu o u4aeenio iotlp rln il()s2xr(r3iu4lptn ietltfsDtau o;u0aptoii3tyslsDelnmpnu)tltrifcoadla e nvilt setrxo oodol   ivt t) Drmxr nu4aetomoeildla emn p;t0alenxociytfmDr ivs;t0 2tm(r3iy4op nmfct t)artmu o;o4tee ioeiydfa2rmnms;(4 rxnmfciotopDeau o;t0 rxoxm3iu1amenlics sfsruaumooo0aee iictltfsDrm(mp u4teerir3tatlaDeanvil(0 2toim3iu4op elnvi s)aDrrxm nu1opt io3tydfs rauvs (0arermo oatfm rauvsls sexoxm3iy4lpenlictls a2rmx  ou1tlenmieiat a2umump;t4tltrioctadfa  an s;()t2umxo iy1amenlfetas)s2rmx onu4oetnifciltfaDem( sn(4 rxoxf3iytoatrln s ( s2xo(mpoo1llte fcta(fsrraxmo;o1oeenmf3ilt mDum( s u)trerircoytfmt ln i s0s2trxr3nodapen icsas)a2rr(moot4aleoiociasfaDulums;u4aetnif3iatoa rln olt texmxo iudll nlnvtls s2uax ooo4alxoii3iys a2rm(mpnt0 exrxocoa1oaDrlnvilt0 2tmxo nu4lme lnei sf 2tmu p;o4tetomictltla2emu onu4 lxnxo3io1fa elnei;t)srxrxmpiodlpenlnei ( a2ta(rpot1oet  f3tasfsDuln s;u0tetnxrcta1fa raneo;t  rum(opoydlpenmics ()sDrr( onu0aptnmieilsfm2ra( o;t4alxomo tydomD li ils)s2xm(opnodalt licslt) Duau  ;u1apxo i3ildfm2umumpnt4trenmo3ty1omDr nvs;s t2toxrpoy1amtn fei s aDtax p;u0aetn f3tlslm uau s;t0 ltoxo ia1oaDeauvs;(  2xriopiu4olenmiei t sDrrxmp;o4tetn fetaslmDua(vs;u0 rxrmf3ta1omt livi s  rtoirpno1lmtemicsas)sDtmumpno0opxniiciydlm emumo;t4tlenxo iadoaDrlieol( t2xr(m3oy1lptelfeil(  2tr( pot0tpxnmociltlmDranmp t4trtnir ootfat ln i;t)sexmio3ny1ape  neia(fs2uaxmpou0texn f3iyt a2emnmo;u0 lxomrcoytlm r ueilt) rum(m3iu4llenlivsatf 2rrxmoou0ope  fetltfa2uau on(0aetomocoy1laD aivs;()trtrxmpnu4lmtemieia(f rrrxmpnu4oexoif3ias a2ul(mp u4 exoxo3iytlm r i o s0 etr(m3oo1llt  icil()sDtr(ront0oee  ieiydla eluvpn(0 lxnir3iy1oa e u s;t0teuoxo3io1op elict s aDurur ;o0tex if3ildfa elnmon()artnio iadom   nes;t texo(mpny1lpeemnct ()sDrm( pou1oee mocias mDeau s t)arenir3oy1fpDr u o ( t2xo(mpiydom elfct () 2raxr nu1tlxnioctysfaDumnmsnt)tlxoxrctodla r n i t0 rtm(o3oydoltnmfci ()aDtmxmooo0oet ifetad s2eanvsnt)aeeoxr iydlp   ivi;( seuoxrpnudapenmicta( a2tmumonu4aeto ictys m rl(mp;u4aetrio3totlmtranei;s0tetrxm iudlle  fvtl( arta(mooo1tlt mf3tyslm2rlnmpnu4texniocoodfpte neo;t0 2xmirpiy1ale micsltf rur( ono4alen o3ils m uln p ()aexomf3ty1fa rau i (0 2trxm no4optemneia(  2ta(moou0texn octlt s elumonu4texnmr3iydlatrlueo t)t2xoxo3iy1opeelfcsas  Dtrxmo;u1alt moeias sDel(vpnu0tlerxr oa1lpDe i ol(0 rur(r ny1lltn fvs s s2uaxrp;t0tptn ieiadlmDeanmsnu)altoifciy1lpDelivo t0teumir iodop  mfcias)aDuaxrooo4tpxn ieild a2eau on(4 lermrcio1latrli i;s sexo(rpiydal  mictatfaDur( ooo1oexnmoeiasls elnmp u0trenxf oodla e uei t  euoio no4aleemnesas) 2trxm ou1opx moetatla eaumsn(0 lxnmr3tytfmD luvo t  2xoiopiydol n nesas  Dumum ;t4oltoiieiysls rmums u) lerxr3todfm raueilt sexr(m ny4am nmfvsatf Dtm(m nt0tlxniociasfs ulnvp t4 eeriocto1lm eln o t trxmim io1lm nliet sf 2ta(m ;u0oexnmfetas aDrlumonu0 rtnmo3ootfmDr n ol() exrxr3nydamtelicsa( s2um(root1alx ioctysfa2eanmonu) rxnirctydfa eln ilt0t2umim oy4opt  fet ( srta(mo;u4oltoifciyt sDran p u0trxoif3iydomt auvs;(  rxrxm3ny4lme mictas a2rau  ;t0aeeoioeilsls2rmu snt0altrxf3ta1fmteln o;s)trxr(r3iodll elnctat sDuax  ou4tpeo ictysfs2uau o t0tlerio to1lp  lu o;s seto(m iu4op nlfct (f 2rm( pot1aex mf3iytls rm(vo;u4tlxnmo tatlateau i () rxoio ny4optelnetl( artaxrooo4tltniociadfm rm(mp t)arerxf iodfp rlivi;s)tetoimpnudomt miei (faDtrx  nt1tpxomictas s ea(mo u4aexrmfcio1fm r ivs;s0texmio no4ap emicsatfs2rm(root0tltomfciadfa2eanmpnu0arxrmr oa1oatran s;s srxoir3nydlpt lnei s s2tm( pnt1aexoii3ildla2rmumont4texnxo ootopt  i s;(  2trxr no1lpt mfesls sDrr(monu4optomfetasla eln p;t)artrmf iatlpD  ivo;t trtm(opny1lp e iviat  rur( oot4altoioetaslm2ulnmsn(0 eenmocoytom eaueils  rxrio iy1om elivslt)srrrumo;o1tptnioeiys sDulnmpnu)aleomfctytlaD  ivi (0t2xmxr ou4lpenmnvils  2trx ooo4tpt mi3ilsfa2emumon(0texnxfciodfm  auvo;t0t2trxmpoodlm n fvil(f Dtrumont0oeeomfeiys s elu o;u)tetnmrciodlp   ivol(0 ruo(m iy4ameelieslt)srtax  nt1olt  o3ils s2eaump;t) renmo3todfmtelu i s) 2ur(m3nudll elfvtls)aDtrxmo;t4altnmfetyd a rmnvp;t)aetnmr ty1oate u s s trtoim nu4ol n fcsl()sDur(rpoo0apeomociysla2emu snt)tlxoxr ta1laDeai o;s0srum(mpoudlpenlivt s  rrrurpnu1tet iietydlm2rmn o (4trtrif3iodoa  anvi s0tetm(rpoodal   ictlsfsrrm(mpou0texnif3iasfsDean p;(0 rerio3oa1fmtr n s;t sexm(m3oudlpenmfviat)arrmxr nu0tpeoio3iyslmDrmn s t4aetoxo3iy1lmt luvslt)setrxm no4altelnesl( sDur(mpno4oexnif3iysfsDrmu snt4 rerif iatomtrln o s)setoimpnu1am nlict s artmu pou1oexo f3ildfaDrln o;u4 ltnmoctatfpDranvo;s t2trim iydop emfesls  2tmxmpnu0apxnmieils a rauvo;u0tlxoxocoa1laDelu sl()srxoirpny4ll nlietlsfsrua(mpou1oexo ieilsfmDum(mp u0texnxo iadla  li s t)trxrxr nu4lpeemncilt srtaxr ;o0tlenmicils mDuluvs;(4aexnio3oa1omteaivs t0teuo(m3nodomtelietlt)srrmx o;u4opt  ietltfm um( snt0aexnxfcto1lm  aivi;s)s2xmxr no4omtnmfcilt s2rrxm oo1tee  ieiytfs2rlums;t4aetnxo3tatlpt aivs ( seto(r3iu4olte ictat srraumoot4opto oeiytlsDel(vp () lerxrciytomD lneo;(0 2umirpny4al n iesasfsDtm(r ;o0alx iicils s ua(vpnt0aeeoxo oadom  lnvsl( seto(o3oodom n fcia()artau oou4alt  ietysla ea(ms;t4tlermr iy1fpDelneslt)texo(mpoodll e ncil( aruru ooo4oex  oeiad aDumuvs;t0 lxoxfcoytlpD an i;() rxoxopoodam n neta(f rtmu o;u0tpe io3tlt aDumn o t4 eenioctydfpDeaiei;()sexrir iu4lp n neil(fa2raxr ;o4tltoiocias a rm( o;(0artoio oodop  livi;()srxm(m3nu4omee iesas)aDrmur ou0aex  o3tyt aDul(von(0 ltoxo ia1laDean ol( seum(opnodape  fcsls a2tmuroou4aleoioctls sDum(vo ()texnxr tadlaD  ues;()trtrimpiy1op  mnvsl(  Drmxr nt1opeoif3iat a rmn o;t) etnir ootlmtrau o;s setmxr3ou4aleemictl( s2taxmooo0tlen o3ildfs2rln o;u4arxoio3ty1lateli i t  2uo(m no4lmtnlneil()aDtaxmooo1opxoiictyd m2ranmp;u4arxrxr3iatoate uvs (0trtm(opoo1amtnmieslsfaDta(m ou0ale ioeiltlm umumo (0 rerxf3iadlp e u sls0teuriopiydom n ict (f Dumum ot4tpe iieiyd s rm( s (4alxrmf iadfmD luvi;t0s2xrxo3nu4am   ncilt s2rm(monu1tptn f3tld sDrln s t0trtnmrciodfpD  iesl( trtm(opnu1ape mfvt t  rra(r nt0tex mieilsfm2em(vsnu)aetnmf3iatoa  lu sl( t2uo(mpiudopte fcsltfsDra(root0aptn oeiydlsDumu p;t)trenmf3iatomtr n ols trxo(r ou4apenmict s) 2ua(ront1opeo i3tls a eluvsnu0aexoio3oytomt livs;s)t2umimpiu4oltn nvt (  rtrumpno4olt mictatfaDraumo;t) lxrxo3tadoa r uvs (0s2urxr3oy1ll emici s  2rrurooo4tpx iiciasfs2eln snu0aetnif3io1op  au i;(0 rtr(r3iu4am  mfct (fsrur(rpno0teenmoeiys m em( s;t)trerxf3oytfp r u i;t)srtoio nu4lp  mfctl(fsDum(ro;u4altoifcild m2umumo u4 lxoif oo1op eanvils s2uoxmpiy4aleemnci s  rtrxmooo1tptn iciys s rmu o;(4 etrmf3ta1lmDeln ilt) rxr(o nu1altn nvia( srrmur ;t0alxnioeiytfmDea( s t) eermocoydlaD luvslt)trxmim3iodlp nmfcs t sDtr(monu4oeen oeiasfs2ranvpnt) rxoif3todomtran o;t) etrio io1llte nvtl()a2rmx p;u0tltnioeiadls2umuvs;u0trxoxr ty1op  lneo t setoimpiy1optnlics (  2tmxront0ape  ictas m el( p u0 exnmf tadfa r ues (0trxmxopoudlptemfei s)arumu p;t1olxoio3ias a2ra(vsnt) reomr3tydop rluesls0 2toirpoodop elncta(  Dtax  ;u4tle io3iatls2uanmsn() eeoio3oa1faDe uvils0srxoxm ny4apeemfvi (  Drm(mono1oltn i3iaslaDea(vp (4aexnmrciy1omD an ols)sexmxm3iu4llen ictlt aDrr(r nt0ole  ietatfmDuluvp;t)trtomr tadoa  an i t)t2tmirpoy1lme mnct t  rrrumooo0opxnmfeiytfs2rmnmpn(4aexrxo ia1om eauvs s0srto(m3iudom nmncsls)srtmur nt0tptoioctatls2umu s;t0texnxf iodfaDe i slt srxrir nodlleeliesa(f rumx pno1optnioetas s el(mp;t4 etrio3ta1lm raiesls)srtm(mpnodal nlivils) 2urxr ou0oetoio3tas m rmn ont0altrxo3ia1faDeliei (0seum(o3nudlptelfvi s) ruau o;u4oeenmi3tltfa2rluvs;t4 eermfciotomtelivs;s)teto(r oy1olee nvslt)srtr(rpnu4ape mo3tlt mDelums (0arxnmfcootoaDean s;t) 2uoir iu1oltnmictls srtaur ot1opxoiociyt mDuaumpnt4trxrmf3ia1fa e u i () etoio nodaltelnvs (  Drmx  ;o1tpe moeias a2um(mp (0 ltoio iy1la rli ols) exrim ou4op  mici t)s2uru  no4tee mo3iatlm rmn o t4trtniocoy1lmD aneilt)tetoxo3io4lpt mici s sDururpou0oeeo oeiadlmDrmu p;t)teeoxr3oa1fmDr ieo (0s2toimpnudap n ncsltfa2umxrp;t0tlx iieiad a rmn p t) etomf totlp  aies;t) 2tr(r oodaltemfetl() Drr(mooo0oeto i3ilsfs2emu on(4 rtnxr3oydopD anvsl()srto(opoo4lp   ivslsfa2uru pno4oexnmi3iatlsDea(vs () rerir3iytla r nvolt0s2umxopou1lmt mnei s)arumxr ;u4tpx mieiasfmDrm( s (4 exnmf3iotopDraneo;s  rum(o oo4lmtnmiesat srraump;o4texo i3tlsfsDrluvo t) reoif iadoaD ai s;(  2tr(r3io1opt  nvta()s2rmxrp;o4oeeo oeiasfm2rl(vs (4trtnxf oadlpD lu s ( s2tm(o nudamt micsls)aDrrxrpnt4altoifcilt s uau p u4aeenxo3oy1fmt  ies;s s2umir3nodame  fvs (fsrrmum ot1tleomocils m2ra(mp;t4tlenir3iatfmD aieolt0 2xmxopoudal n nvtlt sDrrur ;o0olxnmociys a uln p (4aetrmrciy1oatr uvs;s0 rxoxo iodomen fvt t a2urxrpnt4optomieild aDemuvo;()tlerxrcto1fmDeln o s) exm(o3oudal  lncil() Dtru pnt0teenmi3tytfaDea(ms;u0alxniocoydlpDeluvi;s0 2xoiopiudole livsl( sDumu o;o0tptnmo3tad m emu sn()arxomr iydop eliei;t0srtoimpio4ole mnctas arur( p;u1optnmoeilsfaDelnmonu) rtnir to1omt aiei;s)setoxmpoo4lpe  fesat)a2rrxro;t4tetnioeilt m2rauvo;t)areoxf todom eluvo;s  2toir3ny1lpenlnctlsfaDtrxmpnt0olx  feiat s ean s;(4 rtrxr3iydlpDrlieol(0t2trxm oo4omt mfcslt)aDum(rooo0tpx if3ilsfm2ranvs u)aeeoxr3iatlaDrlieil( seumxm oydol nmfctas)s2um(m ;t0aeeo i3iaslmDem(mp ()arxrir tytlmDe neil()s2trxrpny1olen ncia() rua( pou1ole  oeildfa2rm(msnu4 lenxf tadopt  ivs;s)seuoxo iodlleelivsa(fa2ta(  nu1oleniietltfmDumnvpnu) exrmr3tytopt  ues;t) exrxo3iy1ol nmnctas)aDur(mo;o0oetomoeiltlm2elumpnt0tetrmr iy1lmDeauvs;s  exoxr iydlpe lfes t) rum(r ou0tpx if3ils a em(vont0arerxo3iydomDrli il(  2toxrpiy4lm n fcs tfarrax ont0aexniiciys m2elumpnt)tltnifctotfpt  uvo t0tetm(rpoy1lp nmfvs ( aDta(rpou1ole  ieilsla rauvp u4tltrxf io1laD aivs;() 2umxo3ny4lmte iet s artrxmpoo4alenifctltfm2ul(mp;(0 rxnmocoatfpteliesls)teurir3nu4omen iciatfsDrrx  no0aptnmietytlsDel( o;(4 lenmf iotlptrlnvsls0 2xr(r nu4aptnlfvtlt a2tmxrp;o0oet  ieildfs2umuvo (4alxoxr oatla rlueo s)teumxr3ou4om emfvil( aDrrxrp;o0aexnii3tas m2rl( pn(4alxrir3oo1opt luvils  2urxm oo1altn fvs (  Drau pnu1tetnmo3ias aDemu o;u)trxoio iydlmt lnvs;s)srto(m3iudaptn fesas sDrmxr ;u1tltn iciyslm2elu onu4tetrif3todlmt  uvs;(0tetrxmpiy1aptelncs tfs2taurpot1altn icilt aDuauvs t4artnmo3ty1oatr ueo;t0t2xoxr ny1llt lfes t)a2rm(r ot4tlx mfeiltfm2um(vp u0tetoxo3iotopD anvs () rto(r io4am e nct sf rtru pot1oltn f3iysfaDea(vp;u0altoxo3oytoatrln olt0texoio iu1op   neil() Dua(  ;u0tet ioetydfm um(mp u0tlenxo iotlmDr ueo;() exm(o nodoltn ncs (  Dtm(mpoo4tpe  ictys sDean snu0 exnmf oadfaDrauei (0srumxmpoo4lmeelfeiltf rtmxrpot1tpe iicils m elump (4aeenxf oadlmDelneols  exrxo3no4ale mivtl(farrrxm ;t0tptnmieiys m2rl(ms;t)tltrmr3tydfmtr n ol() rtmiopio4omtn nct ()aDumum ;o0tpen ietyslaDua( s;(4altomociatopD  u o ( seur(m3iodlmte fei s)srtmxm no1aee mo3iatfa um( o () lxrif3oy1omD lueils0s2xr(mpiy4omtn nvtls) 2rmum nu4texo oeildfa ul( p t4teeoiocootom eauesls)srxrxm iudolt mivtl(f rrrur no4opxoifetls s2el(vs u) etoxociytopt auvsls)tetr(r iu4lpee fcilt)a2rrxroot0apen f3tyd sDraumpn(4alxnmfcio1oateaivs s texrio iydlpt lfvsl()srtmx pnu4apen fciasfmDea(vo;u4alerxr ootoate ieo;()setrxrpnu1al elfcs s)aDur(  ;u1alxo ocilt sDranmpnt0texoif oa1latelnes t0truoio iydopen iesltfarrm(mpnt1oeen feilsla2elnvon(0arxomfciadlp rlueo;s s2xoxo iydap nlfvs t) 2rmu  no1oex mf3ilslaDumumo t)trenxocoy1oatelues t0 euoxrpny4aleemfctlt)sDra( oou0tetn f3ilslm elums t4tetnxr oydlat an il( t2urim oy4lpt lnviat)sDta(rp;u1optnio3ils m uau p t0teeomocoatfp e i olt sruoimpiydolee nesltfsDraxmonu1aex  i3iyt a el(vs;t0 exoifcoodfm rau ilt0t2toiopiy1olee ietlt)srtm( p;u0tpto oeilt s2emnmo t4aeeoioctytlpD  ieol(0t2um(m ny4ome lneil()a2rmx p;u1tltnmieiysfmDua(vp;u)aexoio totfa  livi ( teurir3io1ome lfvslsf 2urxmp;u4aet  o3tatfs uanvs t4texrxf3iadlmt ai ils  rxoxr3iy1aptemiet ( srumxr nt0ole mo3iltfm emnmo () ltoxocoa1opt  neo;t  exm(m iodolenmnctl(f 2rax  ;u4opt ioeiad m rau o (4trenif oodla raueslt)sruo(o3ou4apeelfcsls)sDurum nu4olx mo3tlsfsDrlnmont0trenir iodla ranvs;()setrxr3iu1omtemfet t)aDtmumonu1optnmf3ilslsDem( p (0 lenio iatomt aneol(0 2xr(o3nydamte nvil()sDumu  ou1aexn i3ils a2um(vs;(4 rtomociy1oat  nvil(0t2uoxmpoy1oleelivs s) 2umxrono0tlxomfctadls ranvsn()trenifcty1lmt  ies;s0sruoio io1amt mfes s a2ur(mooo4olxnmfcilslaDrm(von()texnxfcty1fp e ivo;()srxr(r3nudlm e ncilt)sDta(rpou1oee  i3iasfm2umuvsn(4trtrircio1fateliesls0s2uo(r3nu1ap  lieilt sDurxmpou1apenmociadls2eln s t)artoxf3oy1fp r nvs s0s2xrxo3ou4ale lnvslt a2tr(roou1apt  iciadlm ranms u0 eeoxo3iatla rlu i;s s2umxmpoo1ap e iet s)s2uaxrpou4olx  oeiad mDranms u4tltnxfcoa1la raivo;s0 2urir oydlmtnmfvi (f rta(r ot0aleoiiciytfa el(vsnt0 eermocoodlpt anvi;t0tetr(m nydaptn fei sfsrurxrp;t4apxomoeilt s elu ont0artomrcoy1laDrliei;s)setrirpiu1open neta( arrr(r ot4apxo f3ias m2rmu p;t)tlxrmr iy1om eanvs;()trurio3iu1al   fctls srtaumpno0tptoii3tld mDelu o t)aleoif3to1omDr neilt  2trxopio4lp  lneil(f Drau oou4aexnif3ild aDrln o () etoirciadop e u slt  2xrimpiydoptnlicilt sDua(moou0tetnmicildfm2eln p;t0arenmr3iatfpt an s t teumxr3oy4lpe mfvtat  Drauro;o1aet moeils s2el(vo;t)tlxnxfcty1fa elivsls srxoxmpny4lmtelnes tfs2trxm oo0apto feiasla uln s;(4 exoxociotlp   u slt) eurxmpoydlm   fctat  2rrx ono4aet ioeiytfa2emu p;(0teerxo3oytlpt lneols0t2xmxr ny4optelieilsfarta(r ;o4tpx ifcildfa elu s u)areoxo iytom   u o;s t2trim3nudoptelfvi (fsDrm(root4tpe iictytfaDemumo u)aetomr ia1fp rlieslt) 2um(m3iu4aptnlnes ( artr(ro;t0aptnmi3tltfsDuauvp (0tetrmocoytoatrlneslt)srxm(r3nodoltn fetatfa2umump;t4ape ii3iltfaDemu s t4tlenir3iodom raueils tetoxr3oy1amte ivtl(faDtau oou1opxomi3iydfmDrluvs;(0artrmocoatlmD  neo t)t2urxm ny1op   ncs tfartmxmoot1apto o3tysfm2ul(vpnt) rtnir tatla e ivs;()s2xoxm oy1lm nlfciatfa2rmxrp;u1tpen ocilsfa rmu p (4texnmrciytlm e ivsl(  rto(rpiu1ole  ivtatfarumu p;o1olxn octat mDrl(vont4altnio3oytfm  au il(0s2to(r3ny1ol  mivtltf Dtm(rp;t1olt if3iydfs em( p;()alxnxr ty1lm ranvi;s s2xrxm3oo1olte fvta(  2tmumpoo0aeto ictydfa rl( p t)altoio iytlpD lieo t  rurir io4omeelict tf rtaumpot0tpenmfctasls rmu p t0 lxrif3ia1om r uvi;t  2xmxrpoudlptnmfci (  2rmu o;u0apxnifctysls uau o;(4aexoioctatfpte u s s s2uriopoo1omenmnvsltfsDurumo;u1alen ociysla2rmnmo t)aleomf3iodoaD anvo s)teum(o3oo1lmeemicslsfa2umxmpou4ape io3iasls2rln p;t0aexnmr tytlaD lu i;(  rxoio3ou4apt  feslsfarur(mpot1oex mociyslmDumn on(4arxrmo totlmD anvils0 etoim no1ll elnci ()sruaxrpnu4oeenioctyd a ul(vp u4treoiocoa1fa e iei;s0sexo(mpiu4aptemfviatf 2rrxmont1ope ifeiysla rm(mp;(4tetrxf tytlmt lueo s0s2umxopny1lp nmictatfaDua(  nt4oex  i3tatfs rlnmo (0tltrmo3iotoaDeau ils0 rto(mpnu1lme  nesa( sDur( o;t4tpxomfctadfa2em(vp t)aeerxo iodomDe ivi;( s2um(m oudalenlicilt  rua(mo;u4altomfeilsls2emuvp;t0texrxr3iydopDr neol() etmxo nydop nmicta() rtrx  ;o1apxnmiciasfs uan p;u4tlxrio3oodlmDrlivils sruoir3oydamenmivils)sDrru  ;o4apt  i3tytfmDem(mont) lerir iydfaD ai i;s0t2tm(opno4lp  mfvsas) rtmx  oo1aleomo3iltfm uln o (0tltnmo tydlmDrli sl( tetrxr3oydllte nvil( aDrru  ot1tee moctatfs2rm(vp;u4trxrxo3oadfmDr i sls  rxmxo3iu4om elnvsls aDuax pno0oetnmiciysfs ul(vp;t4 leoxr iatfm rln o;s t2to(o3oo1lpen fvsas  2ur(m ;t4aetnmociysfa2ua(mo;t4tleomfcio1omD  u s;t s2uoio iodlleemics (faDtmx pnt0tltnmiciytfs um(vs u) rtrxo iodfptrauvils t2xm(m3iy4lpt mncilt) Dtrx pno0oeto f3ilsfa2ranvp (0teerif3tadla raivil() euoxrpoydolenlivils arua(mont0oexn i3tatlaDrmumpnu0 exrmo3iy1om eai i;s0seuo(o3nodamt mnvi ( s2trxrpoo1oetnii3tldfs2eauvo;(0aetrircio1fpDr neilt trumxopou1op emivsa()sruau p;u4tlxoio3iatla2rmn onu0artnir3oo1oatr nvsls0 2tr(opiy4lltnmfvi tfarrrxmonu1tlt moetydlaDrmu snu0 lxrirctydoptraneols0 2trio3iudlle  nvsasf 2tr(r ou1tex ii3iyt sDrmnmp t)trxoir3ootoaD an s (0trtoimpnu1am nlnetat)artmxr ;u4olt mociatfa2umnmonu)artoifcoadlaDrlivs;s)texmxo3ou1lpe livs sf rrau pou4ole ii3iytfaDulu snt)trtnif tydoptrliesls0sruo(m3oy1ole mictlsfsrrmu  nt4opto i3ilslaDran s t4texomr oo1omDeli o;s)srxr(m oydop  lfcsat s2tm( pno0teeoifciytlm ra( s;()teenxrctatoateli s;s) exoxopoo1openmies ( arrr(mpnt1alen ieiyslm eanvo;t0arermr3todfa rlues t)t2xr(o ou1am   nvi t  2rmxmpot4tpt mf3iasfa2uluvonu0tltnxr3oodfp rauvo ( teumxrpno4am elfei s)sDrmxm nt0apt iiciatfm2eln s;u) exrxr ty1fpteln ils0 eto(opiy4amtnlncia()arumx oot1optomi3ils m elumsnt0treoio3ia1oa e n s;s0t2tm(r oudap   fciltf 2ua(m ;t0aleomfctltfmDulump u0treomocty1opD  uvil( t2xm(opny4aptnmfesl()sDta(  oo4apenioctlsfmDeluvs (4texrmocta1fm   nvi ( sexm(opno4optemiesls) 2rmx pno0oeenmfeilsfaDumnmo (4tltniocoy1lpDrauvo s0 rurxm3nydamen fvs (  Dua( o;u0tetomicils mDeanvp;(0 lerio oo1fmDeaueslt)s2tmxopou4al e nciat)aDtau ono1opeoii3ias mDelu on(4 eermfcta1oat luvolt tetm(opno4lleelies (fsrrmxmpnt1opt moctadlsDrm( sn(4tetoxoctydlpD  iei;t)trumxo3iu1lmtelivsls a2rr(r ot0tlx mi3iad s2rlums;u4aexoxr tydoaDelneo;(0srur(o3iodllt mfvs t s2rrxr ot4aptoioetyslmDeaumpnu4teenio iytfaD  uesls) eumio no4ole lfvilsf rtax  ;t1oet moctltfsDumnmon() ltoiociatfmDelieo t0 eto(o3nydap  lnctlsf 2uaxr oo4tet mi3tys s2umuvsnu)alxoxr3iotomD  neo t0srurxrpnu4optelnctas) rrr(  ot1tex mietlsfs uanmp;u4artoxfctadfm raneo;t0t2ur(opnudlpenlfvsa( sDrr( p;t0tlxnioeildfsDemn o ()trenxoctadfaDr nes;() rur(o iu1lmtn nvta(faDrmurp;o0optnmfetltfsDrmn onu)altniocoo1lp ean i;() 2umxrpiudolenlfetltfaDum(m ;t4olen fciadls rluvs;u0trxoircia1la eluvs s0sexm(mpoudlpe  nei t)aDumum ot4ope mieiyt sDem(vs t)tetoxr ia1faDrlnvo;t) euoxr3ny4apt lfesl() 2rmxm oo4tpenifcilt m em(mp t0tltrxo3ta1fmteaies s)s2tmxo io1ap nlfes ( aDtrxro;o4tee if3tltla umn o u) rxoircty1oa e u s t s2urirpiy1lle mivs t) Dumu oot1apeoiiciltlmDrauvpn(4tltrir3oatoa  lnvsls)srum(o3oodap emfvt sf 2rr( pnu0olxnmieiadfm2ran on(0 lxnxr ty1fpDe u olt0t2xrxo3iodlmenlict t) 2urum nu1opxnif3ildls rau snt) eeoio iy1oa  lneil( trum(o no1llen ncs (fa2rrxro;o4apxomf3iysla2rmnmp t4artoircoytlaD lu il( s2xr(r3oy1am emicil(faDrr(r no1opxniieiatlaDrm( s;t4altnmoctydomDe u s;s)s2uoimpiydlptemncilsf ruax  no0oeen ocildla ul(mont0 eenifcty1fmt auei s srxrxm oudom n feilsfarrmxm ;t1tet micilslm eanvs t)aetnxfctytoptranvs;s teum(m3iu1lmtemict t) Dtau  ou4apen fcildfm2emn o t4areoxo oodom e i il() exrxo3iydlptn fvta()aDtaumpot4ale mictysfsDuaumpn(4artnxr iydfp rlues () 2uo(r3oo1llenlics t) 2umu o;t4alenioctyt m2ranmsnu) lxoio iadlpte nei;s)teuoiopnodope mivia(faDtmxrp;t0aexomiciltla ulnmp;t0aeeoxo ia1la  li sls)texmxopio4lmtelivi (f rtm(mpno4olxomfeildlm2rau sn()tlenio3ty1lm eaueo;(0 2xrxmpnodlmt miviltfa2rm(mp;t1tee iieiltfs raump t)tlenmo iy1lp e n o t s2xoxm ny1opee feslsf 2ua(  ou1oee  octadfmDum( s;(4tlerxf3oydopte i i;t srto(m nu4lp emnvtas) Duaum nu0olxo ocilsfm ra(ms;t)tetoifctytlp  an s;( t2xr(mpio4lm n ivsltfaDtrxr ;o1tetnifciys sDrm(vpn(0 exoxfctodlmteln o t)sexoir oydapen nct (faDuaxmooo0tpe mietltlsDumuvp;(0aetrmrciodfa eln s;() rum(mpiy1olt  ivi s) 2rr(r ;t1aexnmieiydfa2emn p u4aexoioctotoptranvi;s0teto(mpoydamtnlieil(f 2tmx ono1tex io3iltfm ea(mon()tetrmf3oadlpDe n s t) rxmimpio1lm nmfvsat srurxronu0tlxnmi3iat aDran snu0trxrxo3ty1latelueols0s2xm(r ou1lme  netat aDumx  no0opxniiciadfmDelu onu0 leoxr3totopDrai s ()trur(o3iodlpee fcslsf 2uau poo4tlx moetytlaDel( s;t)alenircta1lpDrlueo;t) rtr(o no1aptelnct t)artrxmooo4tpe ioetyd s2ulnvp u4treoifcoydomDr nvo s)teurxm3ou4ll emics s arrm(r ;u4aeto fciasfa2uln o;u4 exoxr3oatfp  aivo;t)seuoio3no4omee fvta(fartm(rp;o4oeto f3iysfs ra(ms;t0tltrxr3tydfpD lnvi;s)teuo(m oudlm e nes (  Durxm ;o4oexoio3tltlaDum(vo;t) leoio iytomDranes ()sexm(o3iydlpee fetlt  2um( pnu4teto fctas mDea( s (0teenxocia1fa   n sls texmim3nydllt mivt tfsDtmumpou0tltnmictyt aDum(mon(4teenmo3iadfm  livi s srtoxr no4lpenlics s artrurpnu0apeomfeiadls umu pnt) etnxr3to1fpDe uei t0 2umxr nydlmt  fesa(f 2tm(ro;t0apxniictlt s umnmpnt) eerxf3ta1lpDeaues;s)seurio3iudlpenlies (fartmu  oo0oltoifciyt aDrl( onu4 lxomf iydlatr uvi t srxm(o nudoltemivta(f ruax oot1tet  feiytfa2uauvs t0altnif to1fm   nvslt0srxm(r iy4ll  lnetls)a2tau  nu0teto iciaslm rl(ms;u0 exnir oa1oaD  ivils0t2urxr nu1lmenlfet (fsDurumoou1tee  feiysla2ranmo;t0aexoxr iotla r ivo;s)t2xmxrpiodalt mnvsat srrrxmonu4tlxn o3tasla raums;(4trtnmo3oydomtranvs s0s2ur(m ny4opt mfesa(fa2um(ronu1teeniieiatlsDrluvo ()artnxocio1fpteanvilt) 2trxmpiu1lptn ncils)artaxront0tee moeiltfaDrm(mp ()trtomo3tydlaD li o t) eurxmpnu4amee ivils)srrm(mo;o1ale ioeiad m2rmnvp;t4aetrxrciy1fm e iei (0s2xrim3nodlpt  feias)s2tax o;t0oee  ieiysfm umn p;()alxrxo3oatlptr uvol( s2toxrpio1lltnmici (  Draxmpnt0tlxnii3iyd mDem(ms t0treomo3totlm eaieslt)seto(r3no1ol   fctasfsDta(mpnu0tlt  fcilt s2umuvo u4 lxnifcoatla   uvil(0 2trxrpny1am   nei tfsrurur nt1tlt iicils mDuau s;(4 ltrxo oydomtranvo ()t2toxo oudopee ivs s) ruaur ou1tpx ifctad m umn s;(0 rtoir3ta1lpt  ivi;t)texrio3oo1lpe mnvtatf Drruroot0tpen ocildla ua(vp;u)alxomr todomDraivi;s t2xm(rpno4olenlietl(  rua(m ot0apxnmociltfm2rm(mp u0treoiocia1latr u s;(0 2tmxm3no1optnlnvt t) rtaxmpoo4aetniocild sDeluvo;t0 etnmr3oydomD aiei;s srurxopnu1altemfes t)srrrxro;o0tltnifeiydla2uanvp u)arxnxr io1lp  an o;s sruoxmpoo1aptelnviat arrmxmpoo4aptoio3tldfa2emn p t4alxnxr oytfpt  ieo s t2umxrpiydlltelfes tfs2rrx o;t4aee  fciadlm2eaump;u0tlxnxr ia1fat lnei t)srxmio iy4aptelfvslt sDrrumpou1alxomi3iyd m2uanvo;() lxnircto1latraivo s  rtm(opnudamee fesatf rrm(monu4tee mieiytlmDra(vont4trtrmoctatom eln s (0s2urio oy1am emfcs s)s2rmxr ot0tptomf3ilt s ra(mo;u0 rtnxf todom   n s;s)s2urxrpnu1aleemnctls srtruro;t1oeto ieiys s2rmu ont4texnmo3oo1la ean i t) 2tmxr iu1lmt  iesa(f 2uaum nt4tltn ieiysla rauvp;t)artoiociatfa elieo (0 rurxm3oo1apenlfci (f Drm(moou1oetn octytfsDra(mpn(0 etnio oytfm elies (0srxr(mpoydll   ies tfaDrrxrp;u4opt mf3ias sDrlnvp;(0 eenmoctadlp eaueo;s)trtmimpoy1lptemfci t  Dra(moot4aeenmfcildls2ra(mont) exnxo3oydfmtran i s)seurxr iu4altnmneiasfs2uaxroou0apxn oetlt aDrm(monu)aeeniocoytfpt ai ols)setrirpoodlptnlnetatfsDuaxrp;u4oetomfciys aDulnvpnu0 rerirctydfpDraivi ( tetr(r3ny1aleelnci (fsDra( p;o0tpeo ieils mDrmu s;u0aetoxrcty1lpDelueilt)trtoxr oydlmen nvsa( aDuaxmooo0tltnifciltlm rmuvp;(4 reoif iy1om elu o s t2uoxmpio4ole lnctas) 2ra( o;u1openif3iatlmDrm( p (0aexoifctadlmDeau i s)srxoio ou4am n netl(faruaxmoou0alenmi3iytls2eluvsnu)tlxrmf3tytoateaiei t texrxm3io1opeemfvsa( srtr(  ot4oeen fciys mDuauvo t) lxrioctodfpteaivslt0s2trio3iodll n iesat  Durxmp;u0teeo fctaslaDumu onu)aetnir to1oa r uvo s)truoxr ou4lltnlivi t aDrm( pnt4tpeo f3tytlm2rauvo;u)tltoxrcoy1opDrai o;s  2xm(r nydom elivsls)srtmumpnt0oetnmoeiad aDea(mp u4trtomf ty1fate neo;( truo(o3io4op  mfcsl(f Dtrurp;u4oex iieiadlm2uan onu0 exoir oy1fmteln ol()srxmxr3iu4llenmncs tfaDumxr ou1opxnmfciadfsDum(vs t0aexnmrciodfp elivs t)t2urxopno1op nmnvtl(  Drmxronu1tlx ifciyt s um(vo;u4tlenxocootlm   ivsls0texm(rpiydap n fes t  2tm(moot4apto ictadlaDum(mp (4tlxoxr3oatfm raieo;()trxr(o ny1lmtn fesasfsrur(moou1texo oetatfaDua( pnt)teenir3oy1lptelu ils0 2xmxmpnu4opt mivia(fsrrmxrp;t4opt if3ildfa2elump ()tetoiocoodop  anvi ()srumir3ny4lp elivtat  2ua( oou0aetnifeiasfmDemn o (4 rxrmr3oatoaD  nvi t  2xr(m oodlpen ivs (f Dta(m ;o0alenmfetadfm rlnmo;(4 rerir oytoaDr uei;(0truo(mpny4lltnlictls artrx  ;t4oexomfeiys s2el(monu)arenmr iydoa r u i s)srtmio3io1ol   net tf rumum ot1aetnifctadfs2umu p t0teerirctatom elu ols0 rtoio oydop  mivt ()a2tmu  ;u0alx mf3iasls2ea( snu4trxrxo3oo1om  au ilt t2xmxopnydlp elietl(  2tm(ro;u4opeo oeiydla elu p;(0aetnxr3tatlatrlivi;()t2tr(r3iudlmenlicsa( srrauroou1apt  ociydlmDelump u0texoio3iydomtrluvi (  rurxr iy1ap emnviasfaDra(mo;t0apx  ictldlmDem(mpn(4tlerircoadlp   ues;s  2urimpno4ale  icsat  Dumurpno1opx iietysfs2ulnms;t) lxnmfciydlmD  ieol(0 rxm(o ou4ole  fciltf rtrx ooo1olxomo3iydlm rm(ms u)arxrxfcoy1oa  anes s0t2to(r3no4ol  mfcilt)arrm(m ;u4tetnmfcilsfm umu o t0teenifctodopD  iesl(0srum(opoudam elfct tf 2rrx ono0aex mfeiadlaDua( o () lxnifcto1lmDr uvsl() rur(mpoo4lltn fvia( aruaxm nu1tlxomf3ilsfa2rl( o;(4arxoio3iotlmDrlueo;(0 rxmim3ou1lm nmfei t)a2uaxm ot1aetniociltlm2rauvo (0teermr3iytfpDe uvils srto(r oo4omenlfetlt s2um(rpot1oeto o3iyd aDrmnmo;u) exoxfciatlpDeln ol( sexm(o3ou4olt mfcsls sDrm(mp;u1oleniiciasfm el(vp (4aexoxrcootlm  lnes s)t2tmxopoo4alt mnviasfa2rau  nu1aptnmociatlm2uan onu4 exrxrcto1op rluvi ( trtrxm3ny4llenmfei sf rtrxrp;u1tpe mo3iytla el(mon(4arxrmf tatopD auvi ( s2trir3ny1lle  ivsl(  rtrx p;t0tlenmo3tltfa ra(vpn(4artoxocoytlp r ies;t0s2xr(m3oydal nmfei tfaDrrxr nt1tlenifctldfm rmu o t0treoir3iytlaDrlivsls0srxr(m3iy1alenmfct ()aDtrumpot1alxnmfcildlm ea( s u4texnxr3ia1lmteauvi;s t2xmxm3oudlptemictl(  Dur(mpnt4tltnif3iaslaDrlu s;t0 rxoxo3iytlp  aieols  rumxr no4ap n fvil( sDumxm ;o4alx  i3iatlmDea( ont4trxrxr oa1la  lnesls0 ruoxo nodalte nctat s2umxrpnu4olx ioeild mDra(vo t0trenir3ta1oatrliei t0srumim iu4altnlfcs t sruaxm ot1tex  ocild s2emnmp;t) exnxocto1oa   uvsls  eumxr3ou1am  mnes s)s2ur(m nt0apt iictlt m2rl(vo (0 renir tydlpte nei () rxoio3nydllee nesa() 2tm(  ;o4tlt iictasla elnmo;t4artomo tadfa  aueil(0sruo(r ou1ole mncsat aDtaxr ou1tlxnmi3iydls ranmp;u0 rerir3ta1fp eau s s) eumio3io4lp  mncsa(fs2trxm ;t4apx mf3iltlsDumnvonu0 ltoxrcoo1omt  uei (  2xrio oo4apt miet s)sDrrx o;u4opxo f3iasfm umn o (4 ltnmr ia1opDeai s;(0s2toir no4lleelieias  rum(mpot0tlx iocildfaDeaumpnt) lxrir3ty1fm rai ilt0srtrim oy1amte icsasf 2rmu p;u1tpen f3tlsfaDem(vp;t0 rtnmf ta1opt anvs;()s2tmxr3oodapen ictat a2tmumpno1tpeoio3tysla ean pnt)alenio ty1fm eaneo t)s2xrir iu4lmeelivil( a2raxmpoo4oexnioeildfa rm(mp t4altrmo oa1lpD aivols0 rxm(m3nydoptelnetltfsDra(m ;t4tlto f3tltfs um(vsn(0tetoif3tydlpDe nesls)t2uo(m nodome mici s)artrxmp;u1teto fetld sDrl( s t0trenmf oadlpt  ies t) 2ur(r3oy4apeemncs sf rrmumooo4oee  ieiatfsDuln p t0 ltnmf ta1la   ivsl()trxo(rpio4op  lfet t arum( pno1oexn fcias mDrl(vp u4 reomfcoytfa eai sl( t2xmxo3iodam emivt sf rta( o;o0aex io3iadla2raumo t) reniocty1laD li olt  2tmxm oydole lictltf Durxmp;u4tee  ociytlsDem( o t)tlenxf3iadlaD  u ols0tetoirpiu4lpee ivsa() Dtm( p;t1tlen o3tatfs2rlnvo t4alxnio3tadfatrliesl()s2um(m oo1lltn fviasf 2rm(monu4tee  oetadlsDua( o u4 rtnmr to1la e neo t)t2urim3ou1ol emieiasfa2rmxmoou4texn i3tat m2elu p u)aeermrcto1lmtranes;()setoxm ou4ol n nes s) Dtmumo;u1olt  f3iasfa ua(mp () etnxf3oo1laDeauvo;s)s2tmxo iy1al  lfeils  rtrxr no1alx mfciydfm2ean s;t)aexrio oydfp rli i (0srto(r iydoptemnet sfaDrr(  nt0aetoif3tldfs eanvp t)altnio totopDrau ol( srtm(mpoo4ole  nci t)a2tm( p;u4tptomi3tyd a uanms;u)tlerxf3ta1oaDeluvo;() rxoio3iy4olt livt s  rtmx p;t4opx ifciys sDumn s ()tltnmo3to1oat livi t  2uo(o3ou4amtelnvs t)sDur(mono1tetoio3iysls2ulu p t0artoiociy1fmDranvi ( trxm(opoy1lme lfct tfsDua(ro;o0oetnmfetat aDum(vs t)alxoxfciatfpDelneo s)t2xrim3iy1apee fetltf 2tru  ;o1olxo f3iysls rluvpnt4tetrxfctatopDe n o;s  2umim3iy4opt  nvtas sDrmxro;u0opxniieiyslm um(vsnu4altnir totoa  lieo;t trtoimpiu1ap  mfesls sruru  oo1tle mi3iytfsDuan s;(0alxomo tatlpt luvo t teumxr iy4om n nvil(f rra(mo;t1aexo oeildfsDranvs ()tlxomrcio1lm ranei t) 2um(r ny1ap  mfesat)s2rr(mpot1optoiiciltla eanmsn()aexnxo3oadop ranvi;t trtrxmpno1lptnmiei t s2trxmo;u4tpxnmo3tadfaDul( pn(0 eeoxf3oo1lm ranes;t) ruoxr3nudop  mics sfs2umx p;t4oetoioeiydlaDemn s;t)arxoxo todfpt lnvi s)s2xmxm no1lleeliesls sDum(rpot1oeenmf3iasfm ulnmp;()treoxociatop e ivs s  2trio3io4olt lnvs sfaDtmum oo1opxnmfeias sDuan p t0trxnircia1lpt aues;t trtmir iy1olte ivt s)s2uaum ;u0aex moeiydls ulnvonu4 renxr3oodopte nvi t trtmirpoy4openmnvil(f 2tru pnu4oexomoetatfa2rl( s;() eenio3iodlatrauvs;s)seuoxm io4amee fvs ( srurx ono0tlxoiieiydfmDrl(vpnu)trerxf3io1lpte nei s)trtr(r iydape miesl(f rra( o;u0optoioetldlsDrm(von()tlenmrctytlp r ivs;s  2um(r no1lme lnvt ()aDrruront0tpxo o3iatla2rl( o;()aeenxocta1oaD lueolt)trurim nodlmen fesatfsruaumo;o4teen ociltfs2ea( sn()texnmfcoo1lm  livs ()sexmiopoo1altemncsl( artau pnt0apenifcilt m rl( p t0alermf oy1la   ueo;t0srtoxmpoydol  lfes ( s2raur no4tex  ieiytfs um(mo;u4texrmf3todla e nvols  eur(mpiudlpte nei (fa2rmxrono0aeeoiocias a2ulu pn(0 etoir3to1lm  anvo s  rtoir3oydom emicsls artmxmo;o1ape ioeiydlaDul( s (4trtrir oa1fm ran ol( s2xm(o3no4openlivsltfs2ururpou0tpeoiociatfm2eanvs u) lxoifcoytomDelieslt  rxmxr3ou1lptnliei t) 2urx o;u1teenmoeiyt m2umums;u0 lenmo totopDelnei;t  ruoxmpno1lme  ict s a2tmu pnt0tpe  o3iadfs rl(von(4 lxrxr ty1opDeau i;t)sexm(mpoo4aptelicsa(fsDuax  oo4aetniicildfsDemums;(4 ltrxo oodom rai sls)t2tr(m iy1oltn ncsat  2trxmpnt1optnmo3iysls2rmnms;(4tlxnio3oatfmDelueol(  etm(o3oo1apeelncilt  Drrxmonu0apeoiocildlaDuan o;t)teenio3iodfat luei;t0 exoxr iy4lp e ncs tfarraxmpnu0tpeoiociasla2emu s (0arerircta1faDe n s;( srxmio3oo1alt livsltf Duaumo;t4oexnio3tyt sDulu pnu4tleomrcoa1lm e iei t0 2xoiopny1optn ieiltfsDrmxront1olx  i3tlsfm2rmn snt4 exnmrciytfmDraneols0 exo(o oy1alee ivtatf Dua(r ;t1aet iiciatla ulnvs u0aeenir3oydoatelueil() exm(r3nudop nmiesat  Dumxrpnt4alt  fciyd s rmnmpnu4altomf tadfm r ieol()s2uoxo3nu1am e ivtas srraum ot0opxoiictadfs rm(vs;t4 eenif3oadlat  ieilt0 rurir3iu4am  mnvias)sDra( p;t4olt ioeiatfs2emu o u4alxrif3iotfptelnei ()trxo(r io1apt lictasfsDtmxm ;u1tpxnmfetlt a2uanmo;u0aexrmf3oatlpDeai i s0 rum(opoo4alee nci t  2taxm ou1opto i3tld aDumnms;u4 ltrir tadfmteai i s) rxr(o ny1lltelfct sfaDta(  ;t1oeenmietas a2uau pnu4 lermf3oatfm rlieilt0sruoxopoydal nlfvta(fsDrrx p;u1teeomictatfsDuanmsn(0tlxrxo3iadlat  nvi;(0t2xmxrpou1lptemncs s)sDraxm ot4tpeo f3iydfa rlu o (0 rtrmo iatom  lues;s  2ur(o3nudamtemfeilt aDrmxrpot1tlt moctyslmDeaums;t) etnxociatfm r n o s  2xoxopoy4omeemfeta(f rumum oo0altomi3ildfaDulu s ()artnmf ta1lmtean i s) eumxmpiodal n nvi ( sDrrumono1aleomfeild m2emnmp;t) lxrxocia1lptelnvo s0t2xoxrpou1lptemnesa(fsrua(m ;u4apenmietltlmDulnmpnu0 eeomr iytom eau ils  rxm(o iu4ape lfctatfs2tm(mp;u0aee mociat a rm(mo t4 eerif ta1faDraneslt0srum(mpno4ap emieta( artmumpou4opx  i3iltla ean s;t)tetrmrcto1la   neslt seumir nu1ole mfcsa( aDraxrpou4aetnmfciyd a rm(vs;u)aexrio tytlmD luvol(0t2xmxo ny4llt lneslt) rrmu p;u1tpen o3iadfa2ua(vsnt4artnif3iadlpte ueols  rurxrpoy1ale  neia(f 2tm( oou1aexniieild m2ranmsn(4trxoir3oatfp   nvils0trxo(rpiy1om e icsas srtrx  ;o0tleo f3iatfa rlu s (4texoxf3tytfat aneols) 2uo(m iu1lmenmfctl(farraxm ;u4oexn o3tls mDrmumo (4aexoxf totlateai sl() etm(o nodoptnlfesa(faDtr(mo;u4opxo fetys sDeau o ()aleomr3oydoptelnvsls0teuoir oydlm e fet s)srurx  ;t1oetoiietytla uau s t4trtnxf3oy1fptrai o s)seum(m iy4omtn iesat a2rmumo;t0ope  ocils s2ua(vs;u0arenxr3io1lmte n s;t) 2to(o io4omen netat)s2ur(  ;u1tpx mfetydfa rmu o ()arxrxfciydfaDeauvi (0trtmxrpno1lm nlncsl()aDtrxro;u1tpxoiiciltlmDuln o;u4arxomrctotopt  ivilt0s2xrio3nydoleelivilsfaDtrxmpou4aeeoifetatfs2rm(mp;(0tlenxfcto1fpD  uvs s0t2to(m3no4lm  liesas)a2tau o;t1olxnio3tlslm rauvs;t4trenxo3totop  ln i;s) 2trim3oy1lme  ict s  2ur(ro;t4aeeomo3iltfs ul(ms (4alerif iotfmDeaivolt t2trim nodlp   ivtas srra(rpnu4opeo i3iad m rauvp u)texrxr3oodlpt au olt0s2trirpiudlltn icil(fsDuaurpnu4apt mfciytfa2rm(vp (4 leoxf3tydfpDelu i t0tetoir3nydoptemivt t)s2umur nu4tlt mictatfsDeaumo t)tlxoxo ta1omt lieo (  exrimpou4am  lnvtls)aDrmxmooo1ape io3ias mDrl( o (0alerxf3oadfmtr ieo s sexoir3oudllee feiltfaDrrumono1alxnio3tas m eaump (0artnxocoodomD anvi t)srxrxm3io1lltelfet s) Dururp;o1openmi3iatla2el(mp t0arxrxo iytfaDrlnes;s0t2xoxm ou1alte fvta()aDuaxr ou4tpxoioeiyd s2eaums;t4trtnmo ty1om e n i s)tetoxrpoo4al nlfct tfsDrmx o;t0aee ii3iyt m2ul( ont)tetomf3oy1fa  ai il(  exm(r3iydop  mnvsls sDrrx pou4aexn fetlt m2em(vpnt4 etnio3io1lpDelueils)t2toxo nu1amtemfeia( sDtr(r no4aeenmf3iad s emn s t0altnio iadlaDe nvs ()texrio iu4al   fesltf Dtr(r ou4oetomi3iatfmDrln o;u)trerir3iotlmteln i s  etr(rpny4lp  lnvi (  Dtrxrp;t4aleomoeiltla el( ont) rxnio iadlm eaueolt0s2urim iydlptnmivsls) rrr( ont0tltomoetaslsDeln s;u0 rxnxocia1omtr u i t teuoxmpiudlmt mfvtat)artmx onu4tpeo i3iys sDrmuvs;()altrxo3ia1fpDrai i s0s2xm(mpiu1ame mfvsa(f Dur(mono4opeo iciysfs rmuvs u) lenxrcoo1fa  lu sl( tetr(r oodlmtn ieias) 2trxr ;u4oltnmo3tlslmDrmu o;u) rxoifciotfmtrai i;t0teuoio iudllen fviat)s2uax pou0opt  o3tadfmDuau pn(0 renmr3ootfm rli olt)t2tmir3oy4aptelfes tfs2uaump;o0tlxo icild mDrl(vp u)teeomfciotfpDr ivi t0srurir3oy4lp e fctas srur(m nt4apenifeildfa uau o (4 eeomf iodomt li s t tetrim no4ame mncslsfartaxmoot1tpt mfetldlm ra(vpn(0arenmocio1fp rlnvs;t0 2xmxo3io4omt mict t s2rm(  no4alx moctadfsDrlnvonu) exoxr3oa1oa rluvils teumxmpiydlle  ivslt) Dta( o;o0oetnmociyt aDraums;() rtoxr3iodlpt  uei;(0 2trxr3ny1lpeemivt ()artrumpnu4apeo f3iyt aDel(mp (0trtniocoydlmDr iei;t t2umxo3oydom n neiltfsrrm( pou4opeoifctlslmDem( s;() exrxocoydfaD lnei;(0trtmiopiy4omtemnei ( a2rrxmpnt0openiieils sDumnvo u0aetoif iotfpDeau i;t0teumxrpnodam nmncsa( aDtr(  no0oex iociydfs raumsn(0trxoif3oydfa  aieo s0 2tr(m3ny4ale mnet (fsruru ont1tlt iociatlsDuanmont4altoir3oatop rliei s)seur(m io1apte fvi t)sDua( p;u1openmfeiysla ra( on(0trxoxr oytoa   nvi t)seumxo io1omen nvta()srrmxro;u1aptomo3ils aDelnvs;u4tlenxfcootoa elnesl( srurxm iu1al nliesls)sDumurp;t1tltnioeiyt m eau s;t4tlxnxo oytlp elieilt trumxm3nudope  nciatfa2trurp;t1oleomoeiltlm2el(mo;t0aeerio oadfp r ivs;s)s2uo(o3iu4amenmivsl( sDrrxr oo0optomoeiasfm2ran snt)trxnio3iotfpDrlieilt0 rur(o3iu4lp elicta(  rurx  no0oltnifciatlsDem( s;u0aeenxf3oatop   i s () rxrxm oo1ole miciasfs2umurpnu4tpe iieild m emumon(4alxrxr iodlm eaiei;s)sexrim oy1lptemnvt t) Dururpot1texomictad s ea( pnt)teenxf3ty1fp ean olt)s2umxmpno4lptnlfeilt)a2ur(rooo1tex  i3ils sDran s t4areoxr3oatfateaueol(0 euoxr3oudomt liesa(fsruaxro;u0optnmoctatfm rlums;u)arerxoctatlm e n s;(  2toxo no1lp emnvsl(f Dtaumoou0teen ociydfs ea( p (4trxoiociy1opt lnes;(0trumim no1lmenlfcil() rtmu pnt0teen ocias m2ulnmp t0arxrio3oodfmDeai o () rurxmpou1olenmnciltfsrraum ;o0oexnmfeild s em(mp;(4tltoxf3tytlmD auvo;s0srtoxr no4lmt  ivt s  Drmu pno4opxoiietytlm em( pnt4 renxfcoa1fpDelivi;s) eumxm3oudopt mneia( srurxront0alxn ietyslm ulnmp;(4alxnioctodlpD lneo;()trxr(opou4olee fesl(faDtmx  ;t0oexoiictld a emuvp t4alxnir tytoatelu sls0t2trio nudlptn iet () 2umu p;u1tetomoeiltlm2el( p t)arxrircto1oatraies s trumiopnu4lmeeliei tfarum( pot0alxo f3iytfa2uau pnt4aleomociatop r n o s0 rxrxrpoudomen netl(f Dtaumpno4tlt  f3iad a2rmuvp;u4 lenmr oytom  li ilt  etm(r3ny1lp   ivilt)a2rmxm ;t0alx  fciadfsDranvs u4aetrmf oa1op eaieol(0srtoxopnu1aptnmfet t aDtmurpou1tpxn fciys a rmu o;t) rxnif ia1lpt  iei (0tetmim3iy1omt mivsls srurumpoo1tpeoifeiyd s2elump;(0tltrxfciytopDeaivo;s0t2xmxo iydlmenlics t)srta(  ;t0tlxn ociadlm ea(mp;(4areoxf3io1oaD  u s () 2uo(mpoy4am   ietl( s2um(ro;t1oltoiiciytls rmnmpnu4tlxnxf3oa1laD aieslt  ruo(opiu1lpeelivs tfs2ua(  ou1olt  o3tltfaDua(vp (0alermf3oydfp  lnvslt0t2trim nydalenlnctltf 2tm(m ;u4optn i3iysfaDuanms () rtrir todoa  aieil(0s2umxo nudlp e fcs t)aDrm(mont4tpe mf3ildlm2ua(vont0alermf3oodlm eaieil(0 rxmio3ny1ll nlicsl( srraxmont1ope  i3iys s uluvsn(0tlxomr3ty1fa e u s s0srxrxr3iu4am e iviat  Dra(mo;t1tpt mfciasls eanvo;u)altrxo3tatlaDe nvo;(0 2xmim3no4lm n fciasfaruru o;t0apeomfciydfs2ulumo u4 rtrmo3todfat aivilt seuo(rpoydol nlfetasfsDra( ono1alen oeiys aDrlnvon(0trtnmf totlp eaueo;s  2xmxr3nu4lmtemfct () Dumu pot4olto o3ilt aDul(vont) eeomocoo1lat livils s2urxr iy4lp n neil(faDtrxmoou4oexoio3tatlm2ea(vsn(4alxnif iy1lpDran ol()t2tm(opoydop e ietasf 2tmx pou1tex  f3ilsfs2rlu onu4trtnir3iydlmDe ieil(0truo(opio1lp  mnvtls)aruaxmo;u1alenmoetytlmDraumsn() renir3iotfaDrlivs (  eum(mpiodlme lnvtl(  2tm(mo;o4opxomfeiadfaDelnms ()trxomf3to1laDraueo t  rxoxopny1lm e ict () 2trxmpnt4tltn f3ildlmDum(vo;()trxrmfciytomDeaneol(0 2um(mpoudlme mnvtat)aDtaurp;o1ope mieiys a2ulnmo u) etrio oydop ranvs;()sexrxmpio1altnlfetl(f rtaurono4aleomo3iyd m rm(msnu0trxrxr io1lmDr ueo;(  2trxo3io4alt lics s aDrm( onu0altoii3iytls2rmn onu0treoxo tytomt lu o;t0trum(m oy4om n ncs sf ruaxr ;t4tlxnmi3tyd a2ulnmp t)arenmf3iytlp eaivs t0 rtoxo3io4lmenmfctatfsDurum no4apxo o3ildlsDrm( p (0teermo todfmt auvsl()seurir nydllte nvslt) 2uaum ou0alt miciys s rlnvsnu)tetnif3oydom  auvs;s0trxm(r no4om   fes tf Drmxm ;t1optn o3tydfm2eln on()aexnxr iadlmDe nvslt0s2tmxo3ou1op  mnct s  2ra( oot4aexo fctaslsDrl(mp t)teenmfcootfa ranvilt)t2xrxm3oy4lmee ivsasf Drm(mo;o1aetomoeiat sDel( snu)aexoio3tytlaDraieilt)t2xr(r3iudam  lfvtltfartrxrpou1tex ifctysfm2ea( sn()aeeoif3oytlp  au s;(0t2ur(r3oudlpee nesasfaDrmu oou4oltn fetad m rmumpnt0teerif3io1opteluvo t0 2xrxr nodap  lnvt ()a2ra(rpnu4tlxo fctydlm2eanmonu)alxoxf3oytfp eanvols texrio3oo4aptemfvi t s2taumpno1tleomfetldla rl(ms;(4aexomociadopte ivi;(0tetrio3nu1op emfvi (  2rrx ont4aet  fetldfa2el(vp (0aeeoir3tatlatrlnvil(0setrxr3oo1lm   iei ()srrrum no1tlxo octldfmDeauvs;t0texnifcoytfateaneil()srtm(m3oy4lp elics ()sDtm(m ;t0opto fetadlm2uln o;u0trerir3ta1fmt lu o t) rum(m iy4olteliesl()aDum(mpnu0tpeomo3tldlm ea(vs;t0arenmf oadlate u slt)srtr(m ou1lptn nvs t  2tm(rpou1alxoiieiyd s2rauvo () rxrioctadfa ean ils0 exm(opio4op  mnvslt  Draxmoot0tleo ocildfs rauvo;()alerxr3oadfateauesls0setr(o oo4lm  livtlt)s2trx pnu0alxo ictld m rluvs (4 lerifcto1fat li slt0srum(r3nu4om  lnci s)aruau oot4apx  ieiltfa2ran pnt)alxomr3oatomtr u s (0texoimpou1ome lnctls) Duaxrpno0alx  f3iad s2umuvs;(4 rxnif oodlat au o;( srxoio3nu1amt  ictlsfa2truro;o4tle ifciatfs2uluvo u)aetoxrcoydlm r u s ()seurir3io4lmenmici t aDta(  nu1apeo oeildlsDul(vs (0 renmo3todfmtr nvils) etrxopoo4lme lfcta( a2ua(rpnu0ope ifeildfmDum(monu4altrxrcoydoa elivo;t) rum(o ny1omt  nvsl()srrmx  nu0apxomfcilt m rl(mpnt0alerxr3ty1lptr u o s0seur(m3oydopte ieil()a2ra(rono4opxn octad s2umnvs;t) lenxf tatomt  uei;s)trxoxm3nydap nlfvt ()s2um(m no0oee mf3tys aDrl(vo t4arxrifciotfm raieslt)seuoimpny1olen ncs (faDtrxrp;u0aptomf3iltfs2ul(vs (0tleoif iatfptr ues;t0 2xoim nodaltemfetls) rtmxronu1olenmi3tysfa eauvs t) lxnifcoodlp   nei;s)srxo(o3no1olt lnesls) rurur ;u4tee  f3iyslsDrm(vs (4aexrmo ootoa r ivols) 2tr(rpnu4lp nlivs t aDrmur ;u1olt  oetls a2uan sn(4 etoxf3oydlpDrlu olt) 2xoxm3ny4omt lictlt)sDur(  ;u0altnifetysfa rm( o (0aetnmf tydlm  ai o s0tetm(o ny4olenmivtl(  Drmx oot4alx iiciysla raump (0aleomr oy1lpt lnvo;t) rxmxm ny1ol  mnvil( aDua( p;o4opt mictatlaDrm(vpnt)alerxocoo1opte n olt0t2toimpio1lle mfvtl() rur( p;u1openiieiad sDua(vp;(0tltoir tydlpDeai i;t0 2toimpoodom e ncs ()a2tr(m nu4optn ieiyslm um( p u)tltnif3oytfatelivo;s0 rtm(opnodlmeelfcta( a2rrxmo;u4tpen oetls m rmnvs u0 lxnmfciydoa raneolt0teumxo oo1amt licsatfsDtr(monu4apx miciatlaDrm(vo t) ltrxo iy1fm eaieols  2toiopnydlp  mfei t srrau ont1tlx  oetyslm2ran p;() lxrmfctotlm eaiei;( srxoxm io4open iei tfartrumont1tpxnii3iatlm uln s;u)tlxomocoadlp  aneo;t tetoxo ou1altemivs t  2tr(ro;o1apt if3iyd a2em( p;t4 etoxo3oy1fa elneo () etmirpnu4lmtnmivta() 2ur(moot4oeeo ieiysla2rm(mpn()tetomo3oodfmD ai il(0texmirpno4ll n iviltfartmurp;t1olt miciyd s emuvo;(4artomf3oydlpDelnvo;t) rxrim io1om  mnei s)srumxrono4ope moetytlaDel(vp u4teenmo oadoptrlueol( srtmio iy4apeemfeil() Dum(mo;t1texoioetls a emu pnu) ltoxr iodlaDr n i;t)s2ur(m3ou1om nmnci () 2rax p;o4teen f3iatfa2ea(vp u4aetnmrciadfmte i i;( texmxm3iodopee fctltfs2umur ;o1tetn i3tadlm2eluvp;t4aexoircto1oat lies;( srtm(o3ou4lp nlictls aDrrxm ;t0oetnmfctydfa uanvp;t4texrif iy1fmD lu ols0 eur(mpou4lmt livsl( srtaxr ot1aeeomo3ilsfa2rlu s;t4alxomrcto1om  aueo;s  eur(rpio1ap   ncs sfsrum(rpno0oex ioctatls uln p u0trtrxo iadfaDe neo t0srtrxm ou4amenlnvi ( sDtrxmo;t1oexn o3iysfs ranvo;(0 rxrio3tatfm rau o;()teum(r oudol nmnctatf rumumont4tpxoiieiatfs ul(msnu4tlxomo iydfptrlnesls seuoxr oy1lpenmiet s) 2urxmooo0teeniietat s el(vpnt4aetnmfcoo1lptrau ilt trur(opiu1lm   nvtlt)a2ur(mpnt4alx  fciadfs elnmsnt) lxrif iydfat  uei;s0 etrxo3ny1am e feilt aDra( pnu4opxoii3ils a elnvpn(0arxomr iatfmtrlu ils)srtoimpiu4olen net s arrrx p;o1altomocildfa2emnvs;t4 ltomo oo1omtr neils)tetrxm3nydolt lncia( aDtmumo;o1aetn o3iasfmDua(mont0aeermf3oy1faD aivi s0t2xm(mpoodamtnmfeilt)srraxmpou4tlxo f3tld s2eau s (4tltomocoodfateau sls texoim oodlm  mfei (faDta(rp;o0tle mo3tadlaDemnmo;t)arerif3oa1fptelnvsl()s2xrir oo4al elfct sfaDtaumo;o4tpxo f3iys m2emumpnt4trtrifctatopDe nei s  2tr(m ou1amt lieiat)s2urxmp;o1olxoiieiatfsDea(mo u4 exrxr3totoaD  ivs ()texrimpny1lm   ietls)arrruroou1alx mfcilt mDumumo ()artoxo3tadlpDeaieols srtoxr nu4omee ivi tfa2ururpnu4ale mfciysfs elnvo;u4tlxnir oydoaDr uvolt) 2tmxr3iydaptn fctatfarumxm ;o4aex  o3iadfa rln o t) lxrmr tatfmt li s;s0seuo(r3oo4alenmivi s) 2umu oou0aet  iciatlsDelnmo t0aexoir ootop rlu i (0t2to(r iu4lptnlfcslt aDuaumpot0tpt ifeiadla rlumo u)trtrif to1laDrlnvo;s0s2toxm ny1ol n iesas srumuronu4alxoifeilslm2rl(vs () rtoxf3ootoptrlivsls t2xoxopio1opt liei tf Dtauroou1opx iieils s2uauvsn()trerif tatfm r n s;t)trtoxo iu1al   feils)artaxmo;o0tlxomf3tysfs ranvp ()tltnmfctytlptran slt) rum(o3oo1om nmnvil(f 2rauro;t4oex mfctadfs2el(vsnu4altnxr tytla  ln i (0trur(rpno1aptnlfciasf rtrum ot0optoioeiatfsDul( pn(0alxrxr oo1fmDelnei;s) rxmxm3ny1ap  mivtl( a2tmurpou0tlenmfeiytla2um(vont0 renxfctadop e nvo;t  euo(r nu4al   fcs s)sDtmxr ;u1oltnmfcilsfsDem(mp;t4tetnmo iotop rluesls0srum(r3iydame lfeilt aDuaurooo0aetn ieiltlm ulums;u0trxnmo3iytopt ln s;s0 rtm(mpny4oltnlies (farurxmoou4apxnio3ils aDuanmsnu)treoirciy1opteluvs t0s2um(o oo1om  lfetl() Dtrx p;t0oexoiieilt a2rluvs;(0aexrmf oytla rau s (  2umxo3no4ameelfeta(fa2tau pot0aex  i3iad s2emnvo t4treoxr ia1omDr iei;(0 eurxopoy4om  mfvils)sDtrx  ;t4tpxnmiciyt aDelnvonu4aetrmr tatlpt  n o;( trxoxo oo1lm   nvta() 2rmxr ot1ole mi3tlslm2emnmp u0 lenir ootlmte uvi;t  rxrir3no1amt  ieta(f 2tmx  ;o1apxomiciys s2ranms t0artrir iatfaD luvs;s0 rtmir ou4omt lfes tf rtrxro;t0tex if3tyt a rauvp u0tltoif ta1omtr uvs;s0teuoxrpou4al e ies ( a2tm(mont1texniieiad a eln pn()aexrmocoa1op   u sls)srtrxr iudomeelfvtl()a2uaxrpno0ole ioctldla2rmumonu0teenmr oydfaDeli i;()t2umiopnu1ope  fvs sfa2tm(mpnu0olx mi3tyd s2eauvs (4arenmrcia1faDr n ilt)sruoio3no4alt  ietltfs2urx ono0aeeo fctyt aDrmnvs (4aetrxo3todfm eaueo;s)trtmxopno1omeelncsl()arraurpou0oltn feiat s2rlumo t4 exrmf3oytfptraieo;(0 exoxm3io4lle  ieta(faDtmxmp;o0tee  f3iatlaDemnvsnu0trenxfciotomDrauvolt  rtm(r iydome mnvs t sDum(r ;t1alxomoeiyd sDuanvo;t0alermo oatlpDeaieo;s0srxmxr iydop  mfvi (  Dumu pno0ale ii3tyd mDra(mo (4arxoxr3oadfmte neo t srxriopnydapeemnvsatf Duaump;u0altoioctyd m ulnms t)tetrmr tatopDe ivs;t)s2xmxo nydol  lncil(fs2umxroot4alxo fctys m elu p t0tlxnifciydop rlnei t)s2xr(m oy4llenlnctas aDrru p;o0oex iietls sDeanmp;() etoxf3oo1la raivi;s) etoimpiodlleemnes s sDtmxmo;o1olt  ieiltlm2um( s;u) renmr iatomt  nei;t) rxr(r ou1lmenmneta(faDtmxmoot0oleoioeiys m2ua( onu)aetrxfcoy1lpDe n slt0tetoim nudom  mivt (f rtmu pot1tex ioetytls el(vp;u0trxrmr oa1laDeanvilt0trxmio iydaleelivsa( s2ta( o;t0oetnifeiytfaDumu pnt)aleomf ty1fm r uei s0 2toiopiy4olte nes () 2rmu pou0tlxo oeiaslaDem(ms;()arxoxf3tydlp eluvo () 2urim ny4lmenlnvta(  2tmxr ot1tpen oeiasfm2elnmsn()arxoxocoodfmDeaues (  rtmirpnydalenlfesat  Dtmxrpou1aleo iciatla uaumo t4 ltoxr3ty1optraiei t0 rxrxm nu1llt mfvsl( s2ta(r nt1ope mo3ils a2rl(vo;(4texoif oatopDe uvs s  rxr(mpoo4opte fvi sfaDrauroot1oeeomieiat m2elums (4tlerirctatop eln i;(  2xoir oy1lp e iesls)s2uauronu1tee ifciltfm2rl( ont4trtnmfciodfatran s ()t2xmxr3nu1ame mies s) Drmumpot0alt moeiltlaDrmu pnt0trtrxocootom rauvsls s2toirpno4op e fvs s)a2rrxrp;u0apt mfciysfs uanmont4altrxo3oa1lmD livo;t srxoim3nodllen ietasfs2rm(ro;u4optn ocias s rlu p u0 ltoifcia1fateau o s)t2urim iu4al nmnei ()s2uaxm ou1alx  oeiydlaDum( s;t4alenmf3oatfateauvslt t2xr(r iy4omt  nvs ( s2tau o;o0olx iietyslsDean o;(0alxomrcoydlpt livsls0 2xoxrpno4amte icsl() rtrxr oo0tptn fctyt m2rau o u4 ltnircio1lp eau i;s texrim iy4ope liei tfsDrmxmp;t4apenmoetydlsDum( p u0aeeoio3iatopDeliei;s  rtoxo3oydlp emies ( aDuaurp;u1oetnmieiltfs uau p (0 reoxo iadfpD li s (0trtoim3iu4ol  lietlt)s2urxmoot1apxnmictlt mDum(mp;u4arxnir iatlaDrli sl(0setmio3iodapen fesa() Dua(mo;o0tlen octyt a2uauvo;u) eermr3oydop  li ol()seumxr nu4om elnetatfsrumu p;t4ale io3iytlm eln p;(4 renmrciydlat aiesl(  2toiopny1apee iet (fsDtax pot4tpx  f3iyslaDra(msn(0altnif3tatoat an i;t  exrim io4ap n fctl() 2rmxronu1olx io3iadfs2emums () etrio3ootfaDrauei;()srurxm no4aptemnvilt  Dtaxmpot0olt ifetytlsDel(mpnt0 rxoio iadlm e ies;t0 euo(o3nu4lp  mncsas)aDuauronu4tpxoiiciyslaDumnvp (0texoir3iodla rli o s)s2xoirpoudlpe mneta( sruax  oo1tpxoioeiysfs2emn onu4 lxrmf3ootoptrauvil( s2trxr oo4lptemnvtl( sDurxronu0oex  fcildfm2ul(vo;t0 ltrxf3tydopteauvilt0 euoirpiy4ol elivtl( aDurx o;t0tpeomi3ildla2elu o;u4treomo iatlm  lu s;(0trumxo ou4llt micsa()srur(m oo0alto oeilt aDranvont0aeeoirciotomD  n o;(0sexr(r3oudamtemncsasfartru o;t1tlt ioctydfaDrmu p;(4alxrmo3iodopD livi;s)s2uoirpiudllen fesa( aDrmx  nu4teeoii3tas m2rmu onu)altrmoctatoat  u o;()t2xrxopou4ameelivsltfs2tmx  ot1aex mfctls aDran pnu4altrxfciytopDr u o ()trumxr iydap e fei sfsrra(mpot1tpto ociyd s rlnmo (4 exrirctodfateauvo;s0 exrimpnu4lmen ietatfs2ur(  nu0tleomiciat s2uau p ()arxnio iydoaDrlnei;s)t2xrxr ny1lle lfvtl( a2rmumpno4oexomoctasfsDem( p;t0 lxnmrctydfaDelieo;t seumxr3iodlmtelict sfsDumxrpno1tptoifeiad aDrl( p;t4aexomf3oo1lmDr uvi t tetm(m3ou1aptemicsat  rtmump;t1tpe mo3tlsla rm(vo;u)texomrcta1fpDranvs;s0t2umxm oydlle mnes t)srtmurpnt0tex  feild sDea(vsnu0tetnxr3iytomDrluvs s)sexrim3oo1apee ieil(faDtax p;t0oexoio3iytlmDumums;u)arerio oa1lateaivi s  2trio oydaltn icils sDuaxrpnu4ope  o3ilt m2ra(vs;u4 leoxrctadlm e n s s)srxo(m3iydap  lnviltfaDrmum ;u0alt ioetltfaDeauvont4altoxrcootlpDe ivsl()s2tm(r iu4ll  lnetl()s2urxr nu4tlenmo3iyd mDulnmo u4trxrxo io1fatrln s ()trxo(r no1olee ivsl(  2ua( o;t4tetomfctlt a ean p (0trtoir io1fatrlueo;(0 2tr(o3ny1omee fcia(  Dumumoot1alt if3iltlm ul( p u4 etoir3todfa e ieo s0t2xmio3iu4lptn ivs sfa2ra(mpnu4ape mo3iysla ua( pn(0 lxrxociytfp eanvolt)trtrxmpou4om  lfvs sfaDrr(r ;u0tleomictad m el( s t0alermr totla eluesls0t2xmxopiy4opee ietltfa2rm(rono4altomfcils a2em( o (4 rxoifcto1lp  luvil()trxm(r3oy4alenmnct (fsrtrx  nu4olenmoctldfa2raums;u4 rxrmo oadlat aiesl(0 2ur(m nu1amen ivil(f 2trum ;u0alenmfciltfmDulumont4alenxf oy1laDeai o t0 2tmxm3io4lm n fct t  2ur(rp;t1opx  feiydlm rl(vo u0trxrxoctadfa rauvi s  2umxm ou4lle lfetlt sDua( p;u4alxo i3ilsfsDea( s t4artoio ty1omt  nvs;t srxo(r3iodllt micsas)sDrrxmono4oexnmo3ild m ea( ont4 etnxf3to1lpDeanvsl(0 rxrim oy4om nmnesltfa2umu  nu4oeto fciatlaDelump u) etomr oodfpDr i i s  2xr(opnodoltnmieta( srumu o;o1ape if3iysfmDum(vs t)aetoif3oo1lp   i i s)tetrir nu1lm n fvtlt)a2ra(  ;t1apto i3iadlmDelnvsn()altoxfciatlmDraiei s  rumxopnudome mfeil(fsrumu pot4optnifciyt aDrl( p;u)artnmf tydfm r i sls0trumio nu1op nlicilt  Dur(moot4alenioeild mDrmu p;()artrmo oodop eaivo;()trtmir3nu1lleemnciat a2tr(mpot1aet  fciadfm umuvo;t4aeerxocoy1oa elu ils  rxm(m3nudole mnvtas s2rru  oo1aeenmoeiyslaDuanmont4tlxrio tatomDe uei (0 rxoio oy1om e fet t s2ua(m ;u1oeen ieilsfaDrmuvsn()tlenifciydlm eai olt sruoxm ou4omeemfcsasf 2rrurono4tex  oetasfa2emuvp () renxrcty1opD  ieo s) exmxm no4olenmfctlt sDtr( o;u1olx iieiasla2eanvo t0aleomo iatoa rli s t trur(m ou4omen fesl(  2rmxmp;u4tlen o3ild s2emuvpnu0 lerio tatfpt livil()s2tm(m3iu4omte nesasfs2rm(mooo1apxnmietyd s rmumo u4areomf to1fpDraueilt)trtoxo oo1lp  miet (f Drm(mpoo4texo ictatfs2ulu s (4teeomf iadoaDr ivolt  rurim3iy4op   nvta( sDtaxmpot1teeo ociyd a ulnvo u4aexrir ta1lpD  n olt) euo(opiodllte ncsat  2rax poo4opx mo3iys mDemnmo;u)aeenxfcoy1omDr ivols) 2tm(m iodamenlivsl(  Dumum ou1tet io3tat m2elnvp;t4trermociy1omt aivo (0s2to(r nodlpenlnvilsf 2raur oo0altomi3iad m2el(vo t) exrir3tatoatelivo;(0t2triopno4lmeelfvsat)a2trumono1oleomieiyd a um( s u)tleoircoa1fa eln s;(0sruoio iudoltn fvslsfsDua(rpnu0alenmictldfa um(msnt0alxrxf3oytfateaieo;t)seuo(r3ny1aptnlnctls  rrm(mooo4tpen o3tytfs ea( pn()tltrioctotfatelnei;s0t2xo(m nodlm eliet (fsDraum oo1tle mieilt s2ean o;(0 rtnxo3oo1lp rluvo (0trxrxopiydlpt mncil(faDraxront0apx  iciys aDel(vpnu0trtoxo oo1om eauvi;t)seurirpny1alte nvt () 2umxr ;o0oltomfeias m2rmn s;u4tlxomo3oo1opDrlivilt sexoimpnydlmtnlfesltf rrrurpnt1oetoioctytla elnmont) ltnxf iotfpDr iesl()texoxo3oydlmee nvs tf rtr( pot4opx mociyd m2ulnms;(0arxrxr oydlaDeaivols0s2uoxo io4lpt lies ()sDraxrpoo4open i3tad s2emnvo ()arerxo tytfpteanei;t0 rxo(r3oo1lleemfviat) rtrx p;u1tex  fetyslsDulump;() exnir3iatopDe nvils)tetm(opiodom   ncsls sDur(m ;u0tpt ifciatfa umump;t4 exnmf3ootomDranei;t)trtrxrpio1lpenlfcs s  Dtm(r ;t4aee mf3ils m eau snt0trerircty1la r nvi t0tetmxr iudlptemfviltfsrtmu  ;t1oltoiietyslmDrln p u4 reoirctytop  ln o ( sexr(rpno4lmtnlfet t) rumurpou0apenii3tytfaDrmums (0tlxniociodfp  ai s (0setr(m3io4lmtemnvi t srtmu  oo4teeomf3iydfsDem( s u)areomr3oa1lm  lieslt trxrio nu1lmte nctls s2urxro;t1aeto oeiadla ulu p t)altnifcty1oate neols)trum(o3oy4lpe mfesat arrax pno4tlenioctadfa ua( pnt0 ltnxr iadlmD anes t seuo(o3oy1op e ics s  rtr(r no4opeomf3tls sDua(vp t0 lermrcto1fmDrli o t s2toxo iodlleemiesl(faDrmxr nt4aptn i3ilsfsDrlump;t4 rermrcia1opDrluvo s0trurxr3oy1omtelietlt  rumu pnu4tleoio3ilsfs rluvo;()alenmfciadoptrai o s seurxm3nu1lle  fes ()sDuau  ou0tlt ii3iasla2uanms;u0tltnmr3ta1fmDrlneols)s2trim3ou4ale mfvsatfsruaumono4apenmf3tls m2rmuvp;t4trxnmr3ty1fa e nvi;(0texrxmpiudllt mfvsa( aDur(mp;u1ape iietydfa emnvp;t) rxrxfciydlmDranes;( seumxmpiu4opeemncias)sDrrumooo0aptomfcild sDrln on(4 lxoir3iadlmDr neslt)trumio3oo1om n ncs s arrr(mont1tpt mo3tltfmDrlnvo;u0alxrxo oy1fpDraueol(  2xrxr iy1op   fvsa(fsDuax p;u4aptnmfeiadls ul(vo;u)tetnmfctodfaDr uvi s0s2tmxm3oo1opeemfvs ( aDuru pnu4tleoiieildla eluvsnu0tleoxrcoadfmDelu i;t)s2tr(r3nu1lleemnvtlt a2taurono1alxo feiysfaDrm( s;u) etrxf todfp  livo (  rtrio3ny4olt mfet (f Dumx p;t4tpenmietyd sDeauvs;()aetoir3oydfa   ieol( s2toiopiodomenmncias)srrrumont1optn feiasfm2elump u0tetrif3tatlpD ln s;s)srtrxr no1lpt lnvsa(fsrua( p;t1aex mfeild a rln o () rtrmocootlp rau i t0truriopiydol  lfvi t  2tmum nu4alt  i3iys a2rm(vs u0areomr iadfpD an i;t texr(o oodalenmfetls) rtrum oo4tlx ifeiytfmDuaumpnu4tltoio tatoaDr nvils0setr(opno4op  livil(  rrrx ooo0apxn octldls rl( o t4tetrircto1fpDeauvs t trurxrpoy4omee nvtat) rraurono1olto i3tld mDea(mo;u)alxoif3todomDraneils  rxo(o3nodal elfcil()s2umuronu1tex  feiyd sDulums;(4 renxfcto1fptelues;s)sexr(m oy4oleelicils)a2tmx  nu0opxn f3iat sDeanmo (0treoxf oydlmt aivilt0trxrxopiydom elivi sf rta(mpou0oetn i3ilsfmDelumpn(4aetomf iotomDelieil(  rum(o oo1aptnmietatf rtru  nu4aeeomoeiyt aDemnvs u4tlerif3oatoaDr nvils truoxrpno4lleemfesat  2tm(r ;t4tpxnii3ilsfs rl(ms;u4arxomr3iatfa  ai o;( t2toir3oodol e net t a2tm(roou0texnif3iatlm2ulu o (4trtnmf iydoa eanvi s srtr(opny4ll n fcils) rra(root1optnif3ildlm2umnmp;() rerio3iydfmt aivil( setm(mpnu1llee nvil(  rrm(m ;t1olxomfeias m2rmuvo ()arxnmo totoaDeau s;t t2xmxrpio4lmenlnct ( s2ua(  ;o1oetn oeiydls uan p;(0 rermf tytlmDeaues;()truo(rpiu4amtelfetas a2trx o;o1tpen fctys s uanmo (0tlxnmo3tydfp eanvi;()setmim oodomtelncsltf Duaxmpot4aeeniociys s2ua(vs t4trtrmr3ty1oa eli o;s0trumxmpiodam   ivs sf Dtaxr no0olxo oeiasls uan s;t0 etrmf oydlpDrliei t)s2tr(mpio4openmneia()a2tau oot0oeen f3ils s2emums;t4tlerif io1oaD ln i;s s2xr(r iudlm emnei ()sDraxmpoo4alx moetys s2rm(vsnt) lxrmfcoytfpDeaies;s) etr(o oudape livi ()sDuru p;t0tlx  feiadfs eln o;(0tetoiocia1opDe i il()s2umxm oydlptnmncia()s2rrxm ;o0alt iociyt s rlnvp u4artoxr iatomDe nvs;t) etrio ny1ol  mfet sfsrraxmpnt1texnmietadfa ul(mpnu0 lxnmrctatop e u s;s tetrxo3iy4am emfvta(fa2uax oot0tptomieiysfsDrmuvp;t0tltrmr tatfm  liei;t)s2uoim3iydop  mfvtls arumxm ou1tex  ictlslm2eanvo (0tlxnxf ta1omD ai slt0teuoimpny1amtn ivslt) Drmxm ;t0opt io3iadlsDulnms t0alxrmo oa1laDrlieo;s0srxm(o ny1alenmnctasfsDrm(r ou4tptoiociat a2umuvonu) exnxociatlmD au s;t) ruriopny4omtemneiasfartmxmpot1aexo ictltla2ul(ms t4artoxo3oodoatr i o t) rxrxo3iu4lltnmies ()sDtax  ou4tlxoifeiadlm uln o t4texnmo oa1opt  uvi;s0trumim oydlp elneia()aDum( pou4oeeoiicildfa2em(vo (4teenxo3todomDeai ils0srxrim oudameemicil()s2umumpot1ole  f3tatfsDumump u4tleoxf3oatlaD ln o s) 2to(rpnodom emfvs s)s2raxm ou0texoifciltlm2ul(vs;() etrmo3oadoa rlueo;t0 2tmxm no4lmtn ivtat)aDum(r no0tlt ifcilsls2ra(vo;t4alenxo3oodlmDrlivo s0tetoxm3iu4am  livi s) ruaxr ;o1tetn ietyd aDemn snt0arxomf iytlaDrauvol( trxmxo3ou1opee iet tfaDrmxrpnu4oexn icild s emumsnt0 lxoxf tadlpDr uvo (0teuoxopio1ap nmivsl()srra( o;u1optn ietlsfa2ulu s;u0 eenmf3tadopDe ivo;(  exm(m iudal emfei t  Dtmuro;o1olen f3tld sDelu pnu4 rerif totla e ivo ()trto(r oo1oleelics s)a2raumpnu0oeto feiltfm2ulump;t)trerir3ia1fpDe n s;t0srxmimpio1om   fct s sDrau ono0apen o3tytfa eau o;t)aeeoxr oytfptrai il(  ruoxm3oydlmenmict t sDtr(r ou1optnif3ias mDrl( on(4arxnxf totom rlueolt0srxmiopio4lltnmictltf Drmx o;t1tle mo3tlsfa elnmo;t) exrxf3oadoaDe ueil(0 eurio ou1lm   fvsl(f 2tm(m oo4apt  oeiltfs2um( sn() rtnif3oatlate u o;s) 2urxr oydopenmnetl(faDtaxm ;t1aleomociydfs umnvpnu4tetrmr oydop raues s)s2toxm iu4am  licias)srtm(mpno4tee  ocils m2uln s ()alenioctytoaDelues (  euoimpoy4lmte fvt (f 2rm(mono4aleomf3iyd m2ran p (4alxomfciotlmDrli i s) rurim ny4omtnmnctl( srumu o;u1aptnmfciad m uan s;(0aeerircto1faDrlieil(0trxoxr3iy4amt  fcs t  rrm(ronu4apen o3iasfm2umn o u0aetniocia1fpD ai ils)s2urir3nodamen fet s)arumu  ;o1oexomoctad s em(mo;() eenmf iotfa rauvi t teum(m nudamte feil()a2tmxm oo1aeenmoeildfs2ua(vo;t4trxnxrciadop e ieo s0 2trim oy4llt lfciltfs2ta(monu4texn fcias sDua(vs;t0 rtomrciadlp rlues t  euoio3nodapt mfvsatfaDumx oot0texnif3iyslmDrauvs t)tlxnmoctotlpt  neo;(0 2tr(r nu4lmtelfeil( s2rrxrpno1alx io3tydfs rln o;(4aeerxf3to1omD aneo;s0srtoio3io4ll nlneilsf Drm(moot0tet  octlt aDulnmont4aetrif oytfptraieols0setrxmpoy1om n fcsa() Dur(m
\ No newline at end of file
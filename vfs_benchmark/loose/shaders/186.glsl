@@ -0,0 +1 @@
+ivs;s0trxm(o3oy1lm  miesasfaDtrxm oo0teeomfcilt m2umnmp (0 lxrio3iydopDe ueo s0s2xmxm3iodlpe mnetat)srtrxroou0oeenifeiyd a rmumsnu0 reomo3oatlpte ivslt  etmxmpio4opt lfes s)s2uax o;u1oee mfcils m2ulnmpn(0trerif ia1fmDelnei;s)t2xoxrpiu1lleemfcs sfsrrm(mooo0tlxomiciysfm2ul(monu0alenmfctytlp  aivo ()s2trxo nydlltnmfeias) rra( ooo1tetomf3tld a2rlnvp;t) exoiociy1lmtrlivilt0 rto(o3io1lltnliviasfa2rru oot1alt  fciytfa2elnvp t4tlenxo oo1fp eli il()sruo(mpno1llt  nvilt  2rr(r nu4altnmoeild sDel(vo;u) eerif3oadoatr nvo;t)s2urxmpoy1lle  nct sfsrrau  ;o4tpe mf3iltfm2em( p;u)arenmf3oo1opte nvol()sexmir ou4llee nvtls a2taxronu0oexniiciysfmDulnvo;(0 leomr3todfate u sl()trurimpiudlmtn netat)aDuaxrono0oetoii3ils s2ea(vp t4tetoirciatlpDe uvil()trtmim ny4amtelivs (  ruau ooo4tptomoeiysfs rmuvo;u0arxrxo ta1lpt  ieol( setr(m3oo4ape mnct s)a2tr(r ;u4altn feiys sDem(vont4aexomf3tydfmtr neol(0sexrir3io1omt mivsa()aDta(  ;o0oee  i3iasfm ua( snu4texrifciatop  aieol(  etm(m iy1om  micias arur(rpou4olto feiasls ulump;t0 eeoxf3io1oaD  nes;t) etm(o nydalenmnesls) Dua( pot1open i3tyd sDrluvs u4aexrmfciodop rluei s)trtoxopnudame livsa(f rrr(ront4olxoifcias s rlnvp t)treoircoytfp  ai s;t0teur(m3nu1oltn fviatf 2rrx p;o1oeenif3iat s elu s t4treoir3oy1fp eaiei;s0 ruoim ny1openmneia(  Dtaurpot1tpxniiciydfmDumumo (4 exoxo3ia1latr neols sruoimpou4olee fvil(faDraur ;t1texo ieildfa2umuvonu)alxoxf3oa1fmtrluvs;() etoxr nu1omenmfcs s sruaum ot4oetniicilt s2ranvon() reoif iy1oaDe uei;t sexm(opno4omt mnvsl(fsDur(  ou0olt  i3tlsfsDrmu s;(0 eeoircto1fat  u ols0tetmxm3nodoltelnes ( artmxrono1optnmietyslmDra(vp;u0aexnmrcoadlm eanes (0s2uo(r oy4olt lfvt s sDtaxmp;t1tetomfciys m rmuvp;t0 lxnmo3oa1omtean s;s0 rumio3ny4ol nliesat aDuauronu1olenifciatls2rmu s t)texnxr3ty1lp eaneil() rxrxrpnu4ap  mnesltf Drr(rp;o0tle  f3tysfmDuaumonu)alenmo to1fm eli i (0 2xm(r oy1lmtelfvil() 2rrumooo4alenmfcildlmDuln s t0alxoxo ia1optr ueils)srxoxo io4ape lietasfs2tmuroot4olx  f3iat a rl( onu0altnio ootoat lnvil()trtrim io4lp nlieiltfsrua(mpnt1aet ifcias a el(vs;(4trxnxrcto1laDraivi t  rxmxo3io1aptnlnvtat)s2ra( ont1aexo f3tytfs rm(mpnt0texoxf3oatopteauvs t)trurxrpnydoptemfetlsfsDtrxroot0aptnio3ilsfmDrmnvonu4trtnmoctodfat anes;t texmimpoo1amt lncta( s2urxro;t1tex ifeild sDelu pnu4tleoxoctotfm  ln o;s0s2umio io1apenlnvilt) Dua( poo4open ictadlsDemnmp t0artrxrcoatopDe uvs;t t2umxo oudoleelncs ( srtaum oo4tptoiieiyslaDeln onu)alermr3iatlpDrlueo t t2xoio3iydll e nvtltfs2trxront0aetn i3ils sDrmn snu0 eermf iytoatrln ilt0trtoim3iy4am nliesat) rrax p;o0olt  f3iasfsDel(ms t)trermrcoydlptrluei;t)srxrimpou1amt liei s)artm(rpoo1tpxnmoctysla em( s t0 etrif tytlmD livi (0srxrxo3io1apenlnetat)sruaxrp;o4olx  feiasla rln sn(4texoir3iatlmtraivi t srtr(mpnudomenlnvtlt)srrrum ou1apenifciydfm2rmn sn(0texnmo oadopt  ivi;()srxriopiydaptnlfvt t)aDtmu  ;o4tet ifciltls2eln o (0aeeoxr3tatlaD anvils)trto(r io4lpenlfvtls artmx o;t4oexo f3tas mDeau o;t4texoxf3iatlate n ol() exoio ny4lmt lfvs t) Dtmx onu0tptomi3tasfsDrl( s u4 reoirciodlpD ln s ( sruo(m iu4aptnlfcsl()artr(rpnu1optnmocias mDum(vs u0 lxomf tatfmte u o;s) rxmio iydape  neta()sruaum oo0opxoioctldfaDua(vs u4 ltnxf oatlpt  i sl(0 rxr(o iy1ol emfes s)arrmx pnt4apxnmoetysfa2em(vpnu)texomrciotfatean o;(0 exmxopiy1optemnvi tfaDtmxro;u0teenmieiasfaDuln sn()tlenmo ootlp  lu s t)sexrir ou4lpt  ictls  2uau ont4oeen feiyt s2ra(monu4alerif totomtrai s;t sexrio3ou1apen nvsls a2truroot0apx  fciltlm2um( o t4alermo oytfpDr ies;() rto(o io4lmt mfeia( srra(r nu0tle io3tat s2rmu o t0aeerxo3oo1lp rlivs s truoio iy1lm e ies s srum(  ou1teeniietytfmDuanvsnu4 lxnif iytfp eli o t0texo(o iy1apeelnetat sDurump;u1aptn ictad sDel( pnt0 exrmrcia1la rauvi t0 eumim3nu4am  livt s) Dum( o;u1aeeomocildfm ulumsnu4trxriociytoat livi;( t2xoio ny1om   ivt tf rrmum oo4olx  feils m eanvo u4trxrmo iatoaDrai olt)trur(rpnu4apt lieilsfsrtaur no1optn fctatfm2eaumo;u0tetomf3ootlm   uvo;t tetmxm iy1altemnct tfa2rr(moot4oee mo3iydfs uluvp;t0treoir iytfa eau s s0 rxmim iydom  mfetas  2tm(rp;o4tpenmfetytlm eaumon(0aeermf3oy1oatrluei ()setrim nu4lp nmnvt t) rur(  oo1alx mf3tatfmDeln s u0tleoif oo1lmt lnvslt)s2tm(o3oy1opeelncs s)aDua(m ;o4oetnioeiydfs2rmums u0 rtrxfctodfmtrluvs s0t2uoim3nydope lnvtas  2taur oo0opxnifeiat s uan o u0texnircoydoa rlieolt)s2xoxm3io1om e icilsfsDrrxrp;u0olx moctlt s rl( pn(4 ltrxo oodomDrlnvilt t2xoim3iodope lietls aDraxm ;t4aptn i3ils a2ea(ms (0 exrxo oo1lm elu i;t)teum(rpio4om nmics tfsDuau p;u0aexn fciyslm2eauvp;(4alerxfcoatlm   n o;s)sexoxopoodolenmnvil( sDra(rooo1apenioeiyslmDuln s (0texomoctydfp  luvs;s  2tmxm nu4al  mivi ()sDtrxmonu0tpt iociyt s2uanmp;t) eeomf3tadlpDranvi t)truoxrpoodaleelfesl(  2rrumpno1tpenmocilsfm2umnms;t0 reoxf totlaDe u i ()s2xm(opiy1amtnlfcta()s2rrxro;o0aeto feiydlaDel(vsn()tleoxoctadop r uvs;() rtoio nu1lmeemnvsl(  Drau oot0aet  fctyt a2elnvo;u0 eenxr3totfpD  nvo;s)seumim3iydll  mncia()sDtm(moot0apxn f3ilslm2ranms;u)tetnir3oytfaDrlnvo;t)teuoxm ou1lpenlncs t s2tmurpno4apenmietyd aDran p;t)teenirctatoaD lnvs s0t2xrio iu4lmenmfesa(fsDumxm oo0aeto feiysfa2rluvp (0arenxo3oa1oa   ueil(0 2toim3oydlp  mncia(  rrmur no0aexnmoetls a2rau s;t0aetrmr oadoate n s;s0trxoirpiodap  lfctat)srrm(ro;t1optn i3ildlmDrm(vs t)aetoif iy1omt auvi (0seur(mpnu4al n nes ( arta( oou0oltnmf3iasfaDemn pn(4aeeoir3iytla r i s s srum(r io1opt  ieil(fsruau  ou0tlx mfctadfmDrlump;(4trenifcta1fmDe n s;(0tetmim ou4lmtnmfct t) 2uaxr ;t4tlxnio3iatfaDumnvp;t) rtomociodopteaivsls) 2tr(mpnu4lm nmfvt (f 2umumpnu1tpenmfeiysfs2rau s (0artrxo iy1lp e uvol() exrir iy4om  livslsf Draum nu0tpto o3iydfm2eln s;u) eermf tydla e uei t) rtr(opoudal  mics sfarrr(rpoo1tptn ociatfa2rm(vsn(0tleoir3tytlp elnvils  rtrio oo1altnmnvs t srurumoot1tpx ii3iyd s2elnvs u)arenmo3tytoaDr nvi;t0trtoxopiy4lpee nesls  Drmump;t4opt  o3tas s2rmn p u)arxnxrciadfaDrluvs;s0teuoxo3oy1optn fcil(  rumur nt4apx iociadfa2elu s;u4artnxoctadfp   ivols0 2ur(m3iydlme  icils) rrmum nu1optnmo3iys sDuau p;u0arenxfciatoa raneo;t trxo(o iu1olenlies t srrru ono1tet  feiytlm2ulu p;(4 rermf ty1omtrlues;s0t2urio nydll   icta( srtmumpou4tex mf3iydlm2em(vp;t) rtnifcoytoateanvs;(0 etm(m nu4aptnmfet tfaDurumpnu4olen ietad m2rmu o t) lxoxrciadom r nesls tetmir iy1opte neilsf 2tmumo;o4aptnmo3iltfmDuauvo;()tetomrciatfate i sl( trxrxm3oo4lm  livtls  rtmxmp;t0oee  o3iatls ua(vp t0 rtnxrcoa1om eanvs t)trtr(opiy4ol nmnctatf rtmxr nt0altnmf3tysfs2ul(vs u4altoir3io1fpDr nvs;t0 2toir nydalt  fetlt)arra(root0oee miciadls emn sn(4 rermo to1laD  n i;() eto(mpno1ame  feiat a2umxmpot4aptnmicias m2ua( s t)aexoif to1laDeaiesls seuo(m3io1omenmivias aDtr(r ;t1tpt iociatla2rl(vsnt)tleoxf3ootlp r uvo (0texrxmpoo4olt mivtltf Dra(  ou1oltnio3tat a2elnvs t0 lermo3ty1fmDe uei t  rtrxrpiodale  iesl( a2uru p;u4aetoiicils aDemnvp u0trenmr3iodlmt lnvsls s2tmxr3nudolte ietl(faruau  ot0tpeo feilt m ra(vo t4 ltrxfciadlate nvs ( tetrxm oydomtn ivia( srtmx  nt0tpxn fetaslsDul(ms () etrxf3totop  lnvs t0texo(m ou1lltn net t sDrr(mp;u0texomfeils mDrluvp u0 rxrmrctodomDrlu o;t0t2toxm3oy4opt mnesas)srrm(rono4tpxomociysfs2rl( pnt4trenmr oodlmDr i o;s  eurxm ny1ap n iesas  2umur nt4alxoifctytfmDem(vo;u0 reomf3oatom rlivs;t0teurxopno1ol nmivs sfaDurxmonu0aet iietaslaDua(vpnt)aetrxf3to1fpDe u s (  etrxrpiydlp  mivtls) rrr(m nt0texomi3ias aDeau sn(0artrmocoytlm eaues;() eum(r3iudlmt lfct s)sruru ono1ole mociadfaDul( p u)aetoif oydlp   ivols srxo(o oudllenmietltf 2rru  nu4aee mi3iys m2elnmp;u0trtnxoctadfp  livo (  2uoio3oodomt lieiasfaDumxroou0oeeo f3tltfa rm(mo t4trxnxr oodlpD aueo t0 eto(o iodap elietls)artr(mp;t4teenmocias m umuvo ()teerxo3oadfmtraivilt0s2ur(m3io1ol nlfesl(faDta(rp;t1opx mi3ilsfm2ran o;(4 lerio tytoatran o ()t2trio3iodom   fvt (fsDur(mooo1oetnmietatlm2rlnmp;() rtoxf ia1la eluesl(0 2uoir3ou1ape  nvtls)s2raxrooo4open f3iytfm rmu s t4trtnmociodlate i i;t0 rtmxr3iydlmeemncta( srrm( poo1tpeo o3iad m2rau pnt4alxnmf ootfatr uvs s)trxmiopoydlp  mivtls) rra(roou0tpxo o3iaslaDeln on() etnxf3oydfa r ueo t0setmimpiu1om emnctas)arrrxr nt1oltn oeiytfa2rl(msn()teeoir oatlmD  uesls0t2xrxm nudope mfesas)s2rr(r ;u4aleomoctld mDeln s;(4trxrxfciodlm   ueslt trxo(m oy4lmtn fvslt) Dtmurp;t4oltn icilsfm2elums u0 rtnif oydlpD an ilt  exoxo3iudap nliciat)a2rm(mo;u1opxoiocilslmDrmnmo t) lxnio3io1latr uei s0sexo(r ou4omt mivt ( srrmxmpnu4aex io3ilsla rm( s t4trxrifcoytom eaneo s0tetm(m3no4lltnmivt t)srrm(  ;o1oetn icild mDemumsnu4tltnio3oo1om rai ils setmxo3nu4apeemiviasf 2rmxrp;t1tlxo ictltfm2ul( p t0artoxf3ty1lp rai sls teuoiopoo1amtnmivi sfaruauroou0ape ioeildfm umnvo t0 exnmf to1faDraivo s0setr(mpio1lmenlicils)arrmxmpoo1tlxo octldls ra( p;u0texomo3iadlpteai i (0t2umxr3nodlleemictlt)srrm( ono1tpxoio3iys a2ul(vs t0treoxfcoy1fpDelnes;t t2urim3io1lp emfvsltfs2tmurp;t4aetnifeiadlm2raump;t0aexrxo3ia1laDean ilt0texo(rpnudomtnmncsls srum(  ;u1apxn fctaslaDem(vs () reomo3tydlpt  i s;t  2xmimpiy4amenmieil( srtmxmp;t1alxnmo3iltls el( o;t0artnmf ty1oaDeaieo s)truo(m3no4om e nvs sfsrta(ro;u1opx miciytfa rluvo;() exrmr to1lp  lnes;( trtoxr nodoptnmicsat)srrruro;o4oex io3iydfs ra( o t)areoxoctodfmtrlu o;t  exoirpiu4amtn ics () 2taxmonu1teeo ociaslmDuanmonu0alxrxf iy1laD aneil(0s2xrim oudole lnesas  rrm( o;o0alxnifeiysfm rm(mo;u4altoifciodlp e i s;s0sexm(rpoo1op  liesls) 2tr(mo;t4opto i3iydfm ul( s () exoxf3io1omtelnvol(  etrio3iy4op nmfvslsf rtmx o;t1oeto oeilsls el(mo ()alxrio tadopD anvo (0 rumxrpnu1amtelfei t  rtrxmpoo1oetomieiad sDumnvsnu4 lermf tydlmteaieolt)s2xmir3oy4omtn neia() Dtru  ;u1oexomicildlm2ea( o (4 ltnifcta1laDe ieol( sexr(rpiydale lfeiatf rtauro;o4tpe  ieiltfsDemu s ()trtnmo3ty1lm elues;t0srumxopno4lm  lfeil( aDum(  no4oeenioctat s elu o t0 eeomocoa1fmt aies;(  eumxmpno1lp  lici () ruaxrp;o1aexn i3iyd a2rm( p;()tetrmfctodoateai i () 2xmirpiy1lpe  ici t s2raurono1tlt  oeiat aDran o t)arerxr3io1lpt  n i;t)t2tm(o nu1om   fetlt sDta(ronu0oltoif3iadfa rl( s;(4altrmr oytfmD li olt0sexmio oy4lp   netls s2tmurpnu0tlx ioeiyt s2el(vs;u) rxoxrciytfmt aues t0 2um(o iy1oleelfei s artm(m ot1opxo icils s2ra( p u4 ltnmfcoytfaDeauvo (0tetrxm iu4om emivta(fsDum(rpnt0ape moeiaslmDua(vp;u)arerxf3iodfmDr ues;s0 rxrio3oudope mnvtas  2tmump;t0aeeomiciadls elnvon(4artnxr3oydfp r i slt s2xrim nodll e nci tf rrrxrpot4oetn f3iys m umnmp;t4 eermf3oadlpDrauvil() 2trxm ny1lme  fcta()srrax oot4oleo fciys m el(vpnt) etoir3tatfm elueo s)sexmxopnu1alt mneta( arrrxrp;o4tpe mi3iad a rlnvs;(4 lxnxf3iytoa e ues;()t2xmxopoy1lm emnesltfsrtmum ;u4aleomocilt s ua( o (0 lxoio3io1oat  u o;t0s2tr(r3iudlltn fvi t artaumo;u1aptoioetaslm2ulnmp u4areoxo ty1lmDeanes;t)trtrio no4lp   ici s)sruaxm ou1apt mfcias a2emn o;() eerxf oytlatranei s) euoiopio1ape lnei t) rrrxr oo4tpxoiietad sDum(vs (4 eerxf iy1la rai il( setr(mpiydome mfetls)a2rm( o;o1aeen ociydlsDuau o (0tlxoirciotfptr i i;(0 exrio oy1ale lfci (  Dra(mp;o4oeeoioeiatlsDumu on()alxnir3ty1oatelnes;t  2trxm3iu1aleemfeiat a2rmxro;o4aee  ociasla ulumsnt4trermo to1latelnesls)sexrio io4om n nci (  2tr(  ;t1aeto ietat s2rm(vs t0treriocta1lmteanvo;s0teurxm nu1omeelivi (fs2rau  nt1opto feildfa um( p;()aeerioctydfat  nvs;( srxoio3nodamenmies sfsrtr(mo;o4oltnmfeilt a ea(vo t0aeerir iy1fm   u sls)s2xoio3oy1lp n nvs sfa2tm(r nu0tpen ociyt a rln sn(0alxoif3oodoate ueilt) 2uoio3oy1omtnlivs tfa2tauro;t0alenioctyt a2rmums;t)tltoxo to1fpD  nvi s truo(o3ny4omt lnci t)s2urxmo;t0aeeomfciytfmDua( o;t0texrxr3oodopt  nes t sexo(opiy1ap elivi ( a2ta(  ;o1tlxnio3tadfsDulnmsnu)arxnio3io1lm e ueilt  rtr(m ou1lleemfctatfsDra(  ot1alt mocilsfa2umn sn(0treriocoy1op r nvs t0texrim oydlmte nvs ()artaum ot1olxn fetls m2rl(vp;t0tlerxr tadoa  aivs;t) exm(m3iodaltnmies (f 2rru pnt4aee mi3iatfm2umuvp;(4trxrmr3ia1fateliei () rumxm3oo1ap n fvtltf Dtrxrpoo0tltniiciltfs rlnmp t0 rxrxo ty1fa e ivsl()trtmxo3no4altelfvsl(  2urxm ;t0olx iieiatfs2em(mpn() lerirctodfp r u s t0t2xmio3oydoltelncilt  Durxmpou4aee mi3iys s2rmumo;t0 etrio3ia1late i o s srto(m3iodomt lieilt a2umumo;o4alt ifeiatlm eln p;t4 lenxr tadfa   ueol( srtmir3no1lm n nvslt) 2uax  nu1tleo ictltls2umnmp t)trxoxf3oatfm eluvol() eto(r3nodopte ivs tf Dum( pnu0olxoifciasla eanms;()aeeomfcto1lpteluvols  rtmxmpoo1apt mnvil(faruauroou0tpeniietytfm umnmont)tetnxf tatomtrlneol(  rxrxo3no1lm  lncsas)s2trxmp;o4opxo i3iytla elnvs;t0tltrxr oatlpD  nes s0trxrir ou4lpte ivias)srrmur nu0tee ifeiysfs elumo u)trtnmo3iy1op rluvolt0sexr(m nu1openlfcs s) rtaumont1apxo oeiatfa2ra( p;u4trxrif iotlp ranvslt) 2xrimpou1ll e fcs s sruaxr nt0tlx  ociatfm eanmo t0aeeoifcootfpteauvs t) rtrxr
\ No newline at end of file
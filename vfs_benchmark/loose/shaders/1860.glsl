@@ -0,0 +1 @@
+i o t)sexoirpiy4omteliesas  rtaur ot1opt mo3tld m2umnvp t0teeomrcoa1faDeaieo;t0setrim3ny4llenmfci s sDurxrp;u0oleo oeiltls uluvo;t)tlerio3totlatrau i s s2uoir oudalt mnvtltfaruaxr ;t4tltomi3tlsls ran p (4texnifcio1fm e uvs s) exrimpiydllt  ics tfaDrax  no4opx mociatfsDuanvpnt) rerif iotfmt luvolt  eto(o oo4op nmnctl(f rtmxmo;u4tpeoiicildlsDuanvsnt) eerxrcoatla  li ils0srxoxm3ou1ll elfvtatfsDuru o;t1oltoif3iaslm2rlumo u4tltoxo3ia1fpteau sls0 rtrimpiydlpenmivtl( a2uau pnu1tltnmoctadfm2ulumo t0tleoxfctatla ean olt)s2xm(rpnydll   nes sf Dur(rp;o0tpt iictlsla ul(mo;t) reomo3oydfateaieilt0t2tm(m3iodoleelieiat srrm( oot4oeeoif3ilt m2uanmo;u4trxrioctatopDe nvi t0 rxm(o nu4omtnmfei s  rrmu  ot0aetoio3iltfaDem( ont4 renmo3tatomD anei ()srxmxm iydoptnlnetlt)srra(  nu1tpen f3iat m ulnmon()aetrmfctodla r ueilt sruo(m iodlmt lfctls)a2rr(  ou1olxn ietld s2rmnms ()trtnmfctodoa r n s ()sexoir oydoptn fvtat sDrrx  oo0opto i3ias aDumu on(0alenxfcoa1lat ln o (0sexr(o3no1lpte fesasf rtrumooo4optnmiciasfs2rm(vs t4 lxnir3iadlaDe ueo;(0 eumim io4amee ivtls) 2tr(mp;u4altoio3ilsfmDrau onu)areomo3oatoat aneols)trurxopoy4om  mncsat) 2trxmont1oetn oeiatfm2rl(vs;u4tltrif3oa1lpt lnesl()t2uo(opoydap n fviasf 2rm(rooo0tptn feiat m el(ms u)tlxomf3ia1lat luvi;s)teumio no1am n ivs ( sDtmxmo;u4altomfctytla2rlnmp;u) rxnxo3oydlaDrau ol( srumxo3oy4omtelfvtl()s2tr(rp;t4optnmoctad m el( on()aetrif3oydlm  lnvsl( s2umim iy4op elncs s artaxr ;o1aptnmoeiasfa elumpn(0tleoio3tatlp ran o;s) 2xm(rpio4lmeemivsl()arraur ot0aeeo fcildla ua(vo (0altrir iotop r ieo ()t2tm(o no1omeemfvtlsfarraxrpou0oeeoio3iadla2um(ms;u0arenmociytom  aivi s0srtmxo3iu4oleelies (  Dra(monu4opxniiciytfs2rm(vp;(4artomrcoatomtrlnvols)srxoxr3no4altnlfvia( aDtru pnt4oexo ociadls el(vo t)tetrxrctatomD li s s tetriopnu4omtnmnetl()aDta(rpot1tex if3iydfsDulnmp;t4 reoir3oytlate neo;( trxmxm nydop n nvt sfa2rmuront0aleomiciadfs rmn o t4 lxomo3iotlm e u i t  2to(o3nu4lpenlict t)aDraxrpou1tltnmiciysfaDra( s t)altrxo3iodfa  livs (  2umxm oy1ape  fcsatfs2um(m nu1apt mociys mDean on(0trtrmo iadom rlnes ( trtriopoodol  lictls)arrr(  ;u1oee ifctydfmDrl(mp (4 ltoio3iotlat lu i ()teuo(mpio4ol emfvi t sDua(  ;t4alt iiciasfaDranmo;u0alxnircoatfmteli s;t tetr(r3nodlle mnci tf Drrxr ou4apt ifciatlsDrlums;(0 ltnmf todfmDr uvilt) 2toxm oy1lm e nes s) Drrx ont4apx  ieilt s ulnmpnu)trtrir oo1fmtr ies;s tetr(m3iodlp nlnvta()srtr(ronu4aex micils s2umnmpnu)alxrif3oytlpDe i o;(0s2ur(r3io1ameemivils aDurx o;t4opto fetatfm ra(vs;u0aexnmocoytlpDeai i () rumxo3iu4lm   ncsa( aDrm(ronu1alxomfciyt m2uanms;u)aexnxr tydlat  u s;(0texmio3iu4alenlfvsl( aDumuro;u1tpenmi3tysfsDul(mp u0 ltoircoodoaD  ueols) etoxm nu4ll  mivsa( sDrmxr nu0opxomietadfs2rlnmp (0arxrircoodopteaivo ( t2xmir oodap  lnes sfsrtmurp;u4oetn o3tltlaDra(vp t0 eermoctotlpDeaieo s0 rxm(rpno4lme lnctl( a2tmx pno1apxoifeiatfsDemn p;u4 rxoxf3oytoa e uvs;s  2umir oodoleemfeias aDrrx  ot4oexnifeiytfa2ua(vo u4aexrmf3ia1opDeli o;t0t2toxopiodll  lnciat)s2uau  ou0opx mfciat a2rmu s u) rxrxr3ia1omtr ivil()texmxm3no4apen ietas) Dtr(mpno0tptnmfctyt m2el(ms;t4alerio3iotlpDr nvo s0trtoir3oudll   fvt s s2ua(mpnu4oexnif3tlsla2ul( p;u4arenif iotlmDrlivo;(0t2umxmpoy1aptnmiviat)s2urx  no4teenioctad m eauvo (4tetnxo3iy1opt lnvi;t trto(r iodlm   icsa(fa2tauro;u4oeeomoeiytla umn o t4arxnio3iodoat  u s s  2urir nydlpe  ics (  Dtrumo;o4oeeoioetlsfm2em( o u)aeeoir3ia1fmDe neol( s2tmir nudom  lncta(f Dumx pou1oeenmoeiydfa2el(mo;u) lenif oatomDrauvo;(0srur(m ny1llte neils) 2uaxm nu4tpx ifeiltls um(msnu) etnmr oodlate n sls  etoxm3oo1lmee fvsl()s2ta(r no4aleoif3tat m rauvo (0 etomocta1lm  luvs;t srtoio oodam nmfctltf 2trurooo1oeen iciysla rauvp;t)aexrmr3tatopt auvi;(  euoio3iydol  miesa( aDtmxm nt1oet io3iysls2rmnmp u0alenxf3tydop eln ilt)trxr(rpoy1amte ieilt)sDum(mooo4aexo fciat a2eln s u0trxomf iadoa eli i;() etrxm3oo1lpt lfcil(faDtrum oo4aleo i3tys sDrl(vs;t0 ltnxoctadfpDr ues;s trurxo3oo4optn fvi ()sDuaxmpno1altn ictaslmDrmums;(0 rermo3ta1opteaueo s) 2tr(r3oudlm  lfviat)srta(  ;o1aptn iciydlsDra(vp;t4 ltrmrcootom e uvi;t)teto(o io4lpt lnes t) Dtmxr ou4opxn ociyt sDrl(vo;()arerxr oadlp rlueo t) etm(r ny1oltnmnesasfarum(  nt1tlx ifctatfm umumont)aeeoxr tydopDe uvo;t trxo(o3iy1amtnmfes t arrru oot1opeo fcias m emuvo t0 ltrxr3oadlm  luvil( s2tr(r3ou4amtemietatfsDrrxronu0texnmfeildfmDulnvs;u) eeoio iotlmteauesl()setrio3oo4oltnmfeta(  ruaurp;t4aexnio3ildfa2emu s;u) leoio3oatfpteluvs;s0 2xrxo3ny1lltnlfvia()aDrm(rp;u0aet mfcild a2umumsn(0aexrmf3oydlp r ivo;t  2to(r3oudome  fvi (farrauroou1alenioeiyt aDrlu ont0aetnxrctydlaD lnes;t texrxm nudol elivs s  Dtmump;t0tlenmoctlslm rauvo t4tlenxrcoy1opD lies s0seuo(m3ny1alt livtas) Drrx o;u1aexn o3iytfm2el( pnu) lxnmr3oadfatrluei (0teumxrpiu4ll elfesa(  Drau ono0alt mi3iaslm ra(ms ()trtrxr ia1lmD li o ( s2triopoodolt mfcils  Dtaum nu4altoiicils aDum(mo;(0areoxo3ia1fmDrlivs t0t2umxopoodlleelfesa(  Drm(m ou1tpxnmi3ilsfs ra(ms;()alenxo iatfp raues;( sruoxm3io1ll nlivil()sDtru  ot0opx  f3iatfsDuaums;t0trtoifcoy1oaD lues;t  rtm(m nudom nmfvs t  Dtm(moou1apxomfctldlm2rauvpnu)texoirctytlatr neo t0sexrir3nodllt  neiat)arrmx pou1open f3iasfsDea(vp ()aeeoir3ootfp  lnvs s trtoxopoo1lpte icsatfsDrru o;t4tptnioetadfmDemn o u4artrifciytlmteln i ( trtm(m3no1apeelnes ()artaxrpou1opt miciydfm uln s u) rxrircoy1fpteauvi s)srxoxmpou4omenlfcil(faDtau pot0opxnifcildfs rl( p (4 eerif oy1lmDelies;t teum(m3ny1ame  fei (  rtrumpot4oexo oeiydla2ranvo;u4tltrxo3ty1fmtelnvols sruoir ou4llen fct tf 2tr(r ;o1texomi3iadfaDuanmon(0arxoxo oatoatr u o t0sruriopny4omeelncs s)artaxronu1tee  i3iat aDel(msnt0altrxocoydfmtrlneo s)tetoxm iy4al  lncsl(  Drrxrp;u1olto i3tldls ulumo (0arxoxociotfmt  i o s0t2xoxr3iudll n fvtlsfaDtax  ;u4aptnii3tat m2umn ont0treoxo iodlp r uesl()tetmxo iu1op elivias arrrxm nt0ape  oeiyd s elu s u4 exoxf3iadomD au i;(0 2xoimpoodlpt  ivta( sDtaurooo4tpe mfciltla ra(mp;(0 rtoir3oydlpD livsls0 euoiopny4lp e nctat)sDuaumpou1tetomoctlsfm ulu pnt)trerxo3oytfp e i i;s  2tm(opoodomeemivsat)srraxm nu0opx  fetlslaDrmuvo;u0altnmr ootomDeaivs;s)tetrxrpoy1am   nvsat)aDrr(moou4aex mfeildfm umnmp t)tltniocoa1optelneo;s0t2um(o3oy1lm e fesa(  2rm(ront1aee iieiaslmDrlnms;()trtoir3iy1oat au s;(0s2xrxopiu4al nmnei s  rrrxronu0aeto i3iatlsDum(mp u4alxoio3iatfatelnes;s0 ruo(r ny4lmtelnvta(fsrumuro;t0ape  f3tys a uln o;t)aexoir3tadla  au i t s2tr(m nudapee iei s  2rm(monu0opeo oeiysfsDumnvp;()tlxrxr3ta1fptrluvs;() exrim3iy1lmeelnesltfsrur(r ot0aetomf3ias aDra( on(4teenio3ty1fp  aieol() 2toxmpny1alt mneilt srumu pnt0olxo oeiysfs2rlnvsn(0 rerxrctytlpDrluvo (0seurxo nu4amenmies t artaxmo;u0ape iiciydlmDuau pn(0 exrif ootlmD anvolt) exm(mpoy4ap emnct ( arur( o;o4tpx mf3iydlmDulnvp;()aexoxf oy1latr ivo;(0srumimpiodol nlivsl(faDrmump;t4aleoiieiaslm emnmon()tlxnxf iadom   ies;()texmxo oo4opee fes tf rtaxmpnt0opxoioctadlm2eaums ()altrxf3iotopDrlu s (0srtr(r3nodlme mictl()sDrm(mo;o4oet iociad sDrau sn(0alenircoy1oaD li i s)tetmxopny1olt mfci (fa2ururpnt0tpt  ietyslaDulnvsnt4tetomrcoodopt ai o s srtr(o iydlleemnvi (fartr( pnt1tlx moctls a eluvpnt0alxoxr iydla rai s ( t2ur(opiudamtnlfvsat)s2ua(mont0oeeo fetytlsDulnvp;t) rxomr3tatfmDr ueo;s s2ur(o ny4ll  mnetls) Dua(rooo4tpt mi3iyd a ul( snt0alxnifcoytlm rlivol(0srxoimpio1ol nlivi tf Drrumpou1apt if3tytlsDrm( ont0tetomf oodfp  lu s;(0 2tmxo ny4om n ivs (farumum ;u4teeo fetyd m2elnmp;(4aeeomo oodop  auei s tetrxo iudopenmivsa(  2ra(mp;u4tlenii3iytls2ulumo;(0arxrioctydom rau sls)tetm(rpiy4alee fcs s)s2ur( o;o4ope ifeilt aDum( pnu0trenioctotomtrlu ils  exrxo3nudll  lictls srurumpno4tlxomfcilsla el(mp u)aeerxf3tytlpDeanesl() rur(o iy4omen fcia(fs2tm( o;u0tetoifctatfa ranmo u0tetnmo ty1oaDeau i;s s2xr(r iy4lp nlfeiat)s2ta(  ;o1ape ifctyt s2rm( p;(0 rtrmf tydlpte ueol(0t2trim iodape lfvtasfartax pno1oeen o3iasfs2umu pn() eerircootopD ai ol(0s2xoiopiydllte ieslt) 2ua(m ou1tpt ioeiad s ulumon() rxoircoytlateaueilt0sexmxrpiu1apenmfvils srtr(rpno4oetnmo3iasls eanms (4arxrxf3oytoaDr u sls0 exrimpoudam nlnvias) rraur ot0aeeo feiytlsDeauvp u4altrmr3tadfp  ln s t0 rxrim3oydapee neilt)a2tm(mp;t0opxo fetyt aDea(ms (4texnmo3oytoa eaivi;s)seumim3io4lpenmneilsfs2ur(mont1aex ii3iatlm umnvo;u)tlxoio oydom rlnvols)seuoxm3nu4ame  ncs t) Duru pno1ale ii3ilsfmDeluvont)alerxf oy1lp  aieo s  rurxmpou1ll  licsls)artr(ro;o0ole io3iat m2ulnvo;(4artnmrctytoaDe n s s0t2ur(m iydlpenlfcslt  Duax  ou1apt  iciys m umnmp;(4arxomf iatfateaieilt)t2xo(m ou1lle lfvsl()srtau  ou0tlxomoeilt a2rmuvs t0 lxoir iydlat lu o;s)trur(o iydopeemnesatfsrtmurp;t4openmfeiatfaDrm( pnu0alenir tydfp eli s ( sexmxrpny1altnmivi (fsDtr(m oo1aptomoeilsls2eauvp;t0trxomf tydomt auvs;t) exo(o nydol n ncsl()a2raxm oo1olt  oetasls2umu sn(0teenmfcty1oa elu s;( s2xoxm3nydlle mnvilsfaruau oou1oetn ictltlm rl(vo;t)aexnxfcoo1fp r nvs;t  exr(m nu1lmtelncslt  2tru p;t0tleo feildfsDulnvsnu0 eeniociytfa e nvs;(0t2tmxopny4oltemnvias  Drax  ot0tle if3ils mDemump;()teerif3oo1fmt livi;s0trxmio nu4lptnlnci (fs2trxr ot4oex mfctlt m2rm( s;t)arxrif3todlpDr i olt s2trxopio4omt lnvi (fa2tmxmpnt1oexnmfetltlm uanvs () lxnmocoodlmD  iesl(0 euo(opio1op   fvia(fa2ua( oou4tle ii3tlt a2ea( pn() lxrxf3to1lpDraieils)s2ur(o iu4lpenlnvtatfsrtrx  ;t4oee ifciltlmDua(msnt4 lxrio ta1oaD  nvilt) 2to(r io4ll  lnci t srtm(mpnu1apenmf3ils m2rmumo;t)arenmo3iy1opD ai s;(  rtmxr3ou4am e ieils sDuaxmp;o1opeoio3iatfm ra(vs;u) rxoir3ia1fmDrlueo t srtoir3ny1opt  feslt  rrm( pno1opeo feildla2eanms;() rtomr3ia1fpDr ieilt seum(r oo1lltnmietatfs2ra( p;u1tpe ii3iys aDrl(mo;u0aeermrctydfa  lu slt texoio oydll nmictlsfs2rmurooo1aetoio3ilt a2rmnvp;(4 exrxo3oa1lm rluei;t srurxm iudamtnlfesls)srtauro;u0tex ifciltfaDuln snu0altomfctadlmDelnvo t0srur(mpny4lpee fetlsfs2rmur nu0teeomf3iltlmDrm(mo u4 etnirctytlpDr i o;t srtm(opny1omt mictat  rtr( pou4texoif3iltlmDemn o;() exnmr oytfpDeai slt tetrxrpoydol nlieia(fs2ua(rp;o0apxomi3ildfaDean s;(0trtnif tadlpDrlieo s trtr(r3oo1lle  ici sf Dumxm ot4alxn iciat m2ean p (0tlenxo tytfa rlueils0t2xoir3ou1lpenmfci t) rua( oot0tltnmfciasls2umuvsnu0 rtnxf oodop rau o t)srxm(rpnudopee iesls  rtmxmo;u1altnifetlsla rlu s;(4tetoir3iadlmD auesls)teuriopou4aptelivia()sDra( o;t1aetnifeilsfsDumnms u0tlxrmf3tydfpte uei t0srtmim3iu4al emiei s)aDrr(rpnt0tlxomoeiasfs2emn p;u0trtomfcoydlaDrlnvol() rtrxmpiy4al   nvil( sDrau pnu1apxn oetas m2emumo;(4tlxoxf3oatop rlnvs s)trxmir iodamte netlsf Drrxr no1apen feiysls2eau o t0 etrif to1lp  anvi s0texriopno1ale  ivtat  rtmurpoo0tpeomi3iyd s2elu onu)aeeomo3iadfpD aueo t t2xmir ny1opeelnvslsf Dtmur ;o1oexnmi3iydlmDean s;u4aetoir3oatopt ln i;t) eurxr3no4lltnlfetlt)srraum ot4oltnmociysla emn o;u4aetnmr3oo1laDelieils0teto(o3iy4opt  neta(fs2tmurpno4aeen octytlaDeln onu4 exnio oatop elivi;() etoim oodome lnvsls srtmxroou4oltnmfciytfa emu s u) eeomo3oydopt lues s seuo(mpoy1amtemfvtlsf Duru p;t0alxo fctld s elu o;t) lermr3tadoat  i s;s  rxoim oydlmte nvta(faDua(mp;t4aee if3iad a rmumsnt4texnmo totlmDe u i s) exmxm ny1aptnmieia()a2tau  ot0opeomociytla rm(vp;() ltnxo iydoatrlivs;t0 rto(m nu4lp  licil(fsDumx ont1apeomieils m2rmnms t0tlxnmr3iatfa   u o;(0 etm(o ou1lme  nvia()artrum no0oleomiciltfs2umuvo;() rtrxfcia1fm  lieo;(0 2xmxr iu1lmtelnviltfsDtrum nt0tpe micilsfm eln pnt4 leomf tadfm   uvol(0texrimpnydolt lnviat sDrrumonu4oee ioetyt m raumo;t0tetnxr iatfat  iei ()trtr(o oy1oleelncs tf rumu  ;t4apxoifciasfs ua(vsnt)arerir tydfpD  i s s texmiopiu1amt  ict (fsrtaxronu0tlt  i3iytfa2uanmo t) etoxf3iotopteln ols  eurir oydomt mncs ()sruru pno4altnio3tlslmDua(ms;t) rxrxo3oo1fatrlnvs;t  2xoxopny4al n fvsl(  Draur ;u4ape ifciat s eaums;t) etomr3iatlptr u o s)t2umxrpiu1omee feil(  rurxrp;u0apxniictatls raumpnu)arxrio3ty1lmt lnes;t)trtmxm3oy1ope mivtasf 2tr(r ot0oexomf3iadfs2rm(ms t)artoio3oy1optr n ols) rur(o3ou1apen nci (fsDtrx pou1tet  feiys sDel(mo;()alerir oytlmDeluei;t0 etoxm oudap e ncsat s2rmxr nt1tpto feiadfm ranmpn(0artnifcia1la rlu s ( srurxopoydom  lnet s arrmxm ot4alx mi3ils m rmnmsn()altnmf3to1fa   u olt0trtmxm3iudlmtn nesasf Drmxro;t0oeenmi3iyt sDrluvpnt0 renmocta1opt  uvi s)trurxopno4aptemfvi s sDtrurp;u1aeto i3tatfm2ran o u0aeermr tydopte u ol()seurir3nu1opeemiviat)sDur( o;u1ale miciytlm ea( o;()tlerxr3tadla   nvs s  rto(m3io4alte fvi s  2taurpno1aptnmociltfm eluvp () eenmrciotla  au ols0srtoim ou1oltn ivt ()sDtm(  nt0apx  feilsfs2ulump;u)aleoif3oodlatrlneo s)teuoim3no4am n nesatf 2ta(rpnu1tpe ifcils aDrlnvpnt4 rxrio3oytla r uvolt)srxrxo3no1lmenmfvtlt)sruaxmp;o4tlt  fciyt aDuauvon(0tetrxo3oy1lpteaueo;s srtoiopiy4ll  lnvi t aDur(mpou0apenmieiad s uau pn(4 lerirctytlpt  u o;s0t2umxo3iu1lp   ivilsfa2umurooo1tlxn fctlsfs ua( s ()arenmo3oa1fa   ues;s0 eumxr3nu1om   nvilt) rtrx pnt0oex io3iasfa2uau p u4trxnxf oadfmtr nvo;s trxm(o3oo1lmee iesatf Durxm ot0alto icild s2eauvpnu4trtrxo3ia1la eaueo s)t2uo(opoy1lltnmnvtat artm(  ;u1oetomfetls m2umums;t0treoxr tadom  luvilt)setmirpny4lmenmivsa(fsDurxmooo1tee mi3tad m eln p;u0 rtrmoctotom raueils0srtoio3nodllt lfetl( srtaumo;o4oexn ocias m2umuvo u) exrxo io1fmDeln i;( srumxo oy4llenmivtl(fs2raumont0texomfcils s emumpnt4 lerxr3oytfm  livi;t)srurir oudopt lfcta(  2rrx  ;t0tltn i3iatls2uln pnu4arerif3iy1lp elnvo (0setrxr3iudolenmnvs ()srra(  nu4tlxo icils m ulu ont0trermocoadfmD  i i t) 2trio3nu1alt  ivtlt) 2tr(rpou1texn icildla rmnvsn(4 rtoifcty1lm e u ol( trtm(o3iy4omen nesa() rtru o;t4tltomieiltls um(vs t) reoxfciadfat  uvils)setmio3ny1lmte nvi ()s2tax  no4tleo ociatfmDelnvont0 ltrir oo1lpt lieilt)srtr(mpnodam  lneiasfaDuaumpno0alt  fciytfs2ranvpnu0teermr3oadlp eau slt)texrxr nu1ole  ivs sfs2uaurooo4aptnmociltfs umuvsn()arxrxr3iodfptrlnes s0 rurio iy4al   nci (fa2tmx ono0tlt iietys m2ea(von()tltrmocoatlaDranes ()tetm(o3oudlmte ieia( sDuaurpoo0aetnmo3iys m2uan p;()aetnif oo1lat lu i;t)teum(o3oy4optemnvtl()a2umxrpnu4tex iictadlm2rlu ont)artnxr3tatlptrauvs;(0s2xoim iodllee icsa()srra(r ;o1aetn feiyd m2eluvs t0altnxr3tytlat  nvs;() exoxo3ou4lptnmncsas)arua(r ot1tpe ioctldlaDul(ms u4 etrmr3oodfatr ivols) eurxm3iudlptelivta( sDrrxr nt0tetnmieiytfa2umu s (4 lenmo3tytoat lues t)srtmxmpoudop nmietlt  Dtrx p;t1altnioeiytfmDrmu s u) rxrxo totlmtr nvo;t0 2tm(rpoo1alt lfesl(  rta(rpnt1aexoiiciydls2ul(ms;u)arxoxr3iadfmtraiei s0 rto(m3nydlm nmiviat s2urum ot4ope  oetysls em(vpnu0trtrmr3oytomDr nes t) exrirpno1lm n fcs t s2uaumpot0apxn o3iyd s eauvp;u4aexomr totlp  auvolt0sexrxm3oy4al nmfesls)sDrm(mo;u4aeeoio3iad a emuvont4 lxoxo3totlm  ln o;s0 eumir3nudllenmivs t  Draum ;o4aeeniictysfs ulumont) rxrirciy1lmt an i (  rtrxo3ny4lpe miesasfaDtax  ;o0oleo i3ildls2emu p u4 rxnxf3tytoptrli ilt)s2tmir iodameelfvt (fa2ta(mpoo1altomf3tysfa2eaumo t0teenxfctadfpDe i sl()t2um(r3nodol   ivsatf rtr(moot4tee iicils s rau p;(0aexnir3oadfm  aueslt truoxrpnu1oltnmnciltfa2urx  ;t1oleoif3ils sDrmuvonu0 rtrmr3ta1fptelivols  rtmxo3oo1optelnvsls  2rr( ono1altomietydfsDeanmp;u0arenmo3tadlpteluvi (  rurim3oodll nlfesas sDtmxmpnu0tpeniieiyd a2umnvo u4treoif io1oaDeluvol(0t2xmxm ny4apenlfvs ()artmump;u0opt mfctytla2rm( onu)arxrmociadoat lnvils s2uoio3nu4ap n neils) rraumpot4apxnmfctyt s2rln s;(4 ltnxociatlmDelueilt0srtr(r3iu4altelnvils)srrau  ;u1apt mfciydlsDua(mon(4alxnxr3iatom e iesls0s2xmir3iu1olte ictls)s2raxro;o0alto ieiydfmDrmums;u0arenifciydoaDelues;s0setrir3oy1ome mneil(f 2ta(r ;u1apxnioeiatlaDuluvs;()trenir ta1fatrlu i;t) rto(m nu1apt mnet (f Dtaxrpnu4apto octlsfmDean p;t0tlxoxf oytlatelneilt trxo(m3nudol emneta(faDur(mpoo0tet mfctlsls rauvs;u) rxriocoydla rlnvi s)s2xmxopiudaptnmics tfarrrx  nu1optn f3iytfs um( s t)areomf oytfaD lu slt0t2urir iu1ol nlncsl(fsrurumpoo1tlxniietas a emuvp;u4aeeomo3ootfpt livi;s0sexmxo oy1aptemfvsls srum( oot0oetoifctatfs rmuvo;(0aleriocoatlmtrln il()trtrirpno4am elicsa() rumx  ;o1ole ifciyt m ua(ms (4trermf oa1opDraneo;t)s2umir no1amt  ivsltfa2rau ooo4aee iociadfs2rluvo u4 etoxf iadlaDeluvs (0s2toio3nu1amen ivi t)srrm(rpot4alxo fcils a uln p (0 etomociodfpt auvi (0trurim3iu1al nmfct t)aDuax pot1apx iiciadlaDeaump;(4arxrir3iatfmDrli i;()trurir iudlpeemivi t) 2tmumpnt0oleo fetatlmDulu o;t)trtnxo tytlate n o;s0 eur(rpiu4apt  nesa()a2ur(mp;u0oltomi3tlt a em(vs;t0teenxo3iadoa rli s;()srtoxm iodape mics (  Dtrxmp;o0apt  ieildfm2eluvonu4 ltnxfcoytlpt luvo t)t2urxr3ou1lltelnctlsfa2trxm nt4optomfciyt s elnms;(4 rerif3tatfat ai o s)trum(o3iydlp n fvs (f Dtrxr nu1tee miciltlm2rlnmo;u) rermrctytla  aieo;t)t2toxopio4ole mietlt a2tmu  ;o1ole ifcilsfm2eln o t)alenxr3tadlmDe ues s0sexm(m oo4lmte netasfartr(m no1aexnio3tadls2elums t)alxrxoctadla r iesls0 exoxrpiu4lmeemnviasfs2taum nu0oeenmoetadlsDrlums;() etoio tadopD ai s;() rtmxo no1lpe  neta(fsrtr( pot4aptoifciat sDrmumo;(4 exoircoatfaD livs () 2toxm iy1omt  netls)a2rmx pot0tlx mfcilsfa umnvo;()alermoctotom   i i s)teuoio oudom eliciat)aDtaurp;u4optnii3tldfsDeanmsnt0aetoxo3iodlmtrauvsls)s2um(r3ou1om n ies () 2tm(mpoo1tlx  ociydfaDrau p (0tlerxr3iytop  au slt seur(r3iodop e ictl( s2umxrpoo1alt mo3tltlm2ulnvo t4 exnmo iadlp ranvs (0texrxm iy1ole mics ( sDrax o;o0tpxomo3tltlm um(mo u0arxoio3oadlmt lnvs;s  eum(o3nu1ape lnvs (f Duru p;u1aleomietasfa ul( p;(0tlxrir tatomtrau ols trxr(mpoo4llt licils)arumx ono0ope iietlslmDrl( p;u)tlxnmr3tatfpDranvi;()truo(r3io4omenmietas)aDtmum ;o4oleoiiciysfaDeln s t0 reomr3ta1fm  aivolt  2trxopoy1amenlnetat s2tmxrpot0apt ifeiat m emuvo;t)trermo ia1fp r neils trxmxo nu4llen ivta( s2trurpou4opx  oetad mDrm(mo t0arerir iotfpte nvol()texm(o3oy4ol nmivtas  Dururpoo1oet  oeiydlmDumnmp u4 rxrmocoytla elueo;( sexrxm no1amtnmics s)srurxmpno4aetnmo3iysfa2ran s (4 rxnir3iydlmDr u s ()texoxrpno1ll emfcsas)arraumpnt1oeenmi3iltfaDrau snt0 lxrmrcio1omtraueo s0 euoim oy1lltemivs ( srrmx ont1tetomo3tas s2eln pnu0trtoxr3oodfmteauvil()truoio3ou4ope lfvt t) 2ta( ont1oeeomi3iys s rl(vpn()trxoirciotfp eliesl()sruo(o3iu1aptn fcsasf rumxmpou1alen o3tldfmDrln pn(4 rxrmr iotfpt lu o s) 2trio nudamtelivtatfs2raumono1aee ioetls a2uanvo t4aexoxf3totlmDrlu o s0 2tm(m iodom  lnciasf rtmxmpot4aeenii3iyd s2uln p u)aeenir3tatfm ean slt) 2ur(o iy4ol nmivia( srrax oot0tex mfctas a uanvont0aeeriocootlp  aivi;s0trurxopny1om nmictasfsrtm(  no0openifeiyd m2elnvsn(0tlerir iy1opDe n o;s) exrio3oo1lltnmncil()sDrmx ono4opx  oeias a ean o;u4 rxnio3oa1oaDr n o s0t2toim3oo1omtnmnvt tf 2rru pot1olxo o3iys s2em( o ()tlxrxrciodopt  uvi;t)teurxr nudlpt  fvil()arumu  no1aet iieiasls ea( s;() exrxr3oydfate uei;t  euoio iudop  mivt s)sDurur oo4texo i3iatla2rmumo t) reoircoodom ranei s)truo(mpiu1lptnlivt ( artrum ot0apxnmi3tasla emu pnt4tlenif3totlm e i olt)truoxo3iydomenlnvs ( srrrum nt0oex ii3iys s uln o;u4tlerxr3ootlaDeli il(0 rxmxmpnydoltnmfes t)srra( oou0oltoifcils m rluvp u)alerxfcoodfa rluvo t0s2xmxrpny4alenmnesl(  Drmxrp;t4ole iieiydfm2elumon()altomf oadomtean ol(0s2trimpoo1ope mfvt sf 2rru ooo1tltn i3ildfa ulu p;()teeoxo oatfpDran o ( srxr(o3oy4ll nmnvilt)s2tau pnu0oleoif3iytlaDul( s;t)tltrio3ia1laDeli s;s0setrxo3nudopeemfvsa( s2uau ooo4opt  oeiyslm2elu snt) ltnmf3oatla  lnvo;s)s2xrio3ou1ll emnesas)a2rmxroou1tlxnif3ilt m2rln o t4trerxrcoytlmDrlueols  eum(o iodome  ivtl( artaumpoo0apxniociatla rmnmp u)tlxniociy1lp  li s t  2xmxr3nodam nliesltfa2rmump;o1aeto feiyd a ean p;t0tlxomo3iytlp   i ils)tetoio oudolte ivil() Draur oo4tltniieiatfs ean o;u0tleomf3oodlmtrlieils0srurxo iy1ole  fvsa( aDrr(m ;o1openioeiytlsDuln snt0tetnif3todla  lnes;s0 rxmxr3nu4ape  nvt sfsrtrurp;t4aptoii3iatfs ulnms u)arxoxo3ootomt  ueo ( trum(o iudop  liesl() 2uaur ;t0tpt io3tld mDuanms;u) eeomr3tatlateli i;s)s2to(mpno1lm   fesasfsDumx oou4ape  fciyt sDem(vonu)trxrir3oydfm  ai i ()t2ur(rpou1op   iei tf rtrumont1open oeilsfs uan pn(0aeeoxr iatfmtrlnvs;(0sexm(r3oy1lltnlnviat) rrauro;t4tpxnio3tasla rau snt)alerif iy1oat luvo ()trur(mpoodame  nvi s  Dtaxro;o0opt ifcils sDeanmo;t0trtoir3oo1fpDrau sl(0teurxo3oydomt  feias arta(mooo0apt  ietld mDua(mo;t0altnmoctydomDe ivo;s0tetrxr iudll   ivs tfaDrmuroot0oee ifctlsfm2rm(vo t4 lxrmf iytlmt lnvo;(0 rtrxo3io4lm  lneilsfa2urxrpoo4optniociytla2em( p u4 rxomfctydfatrli slt sruo(m3ou1llenmietlt)srua(mpnt1alx  o3iltls2raumsnu) eerircty1latr n ol() eum(o ny1opeemnvs (fs2tm(m ;t0tlxomo3iydfaDeau s u)texnirctotfm r nvo;t0 ruoxr3oy1olt  icsls)aDtmur ot0teenmi3iysls2uanmo t)treoiocio1fp e nvs s) 2xrio3iu4altn ncs s srrr(mo;t0opxnii3iasls ra( pn(0altoxrcoy1fatrlu i;( tetmxm iy4aptelieils)arrm( p;o4tetoiieildfm rm(vo;t4tltnmr ty1fptelneil( setm(opnodllenlfei t  rrm(m ;t4oetnmi3iad s2ul(msn(4 rtoiocty1omDeau i ( trurir3iydlltn ivtl()s2taxr nt4oetniictltfmDrmnvp;u0alxnircoytla rlu i;s)seto(mpiudole licsls artaxm ot4aleniicilt a2rlnvs;u4teenir3oo1oaDe i s (0teumxo oy4ll   nvtatfaDtru poo1aleomi3iad mDrlu s;t0tleomo ootlp e uesl( texo(m3oy1lm  lfcsas  2rrx poo0tlen oeiyd m2umnmpnu0 etrxr3ia1op eli il(0srtr(opoy1lpen nvsl(faDtaumooo4opeomo3iytla2em(monu0aexomocto1omDr ueo;t t2tr(r iu1op elfvs t s2rmurpoo4tetomf3ilt s rl(von(0artrmf3oa1oateaivo;s  etrio3nudop nmfcs t  rumurpou0tptn ociltla2el( s t) rxnmf3iadlateaieilt s2tmxo3io4amtnlnvsa() rumxr ot1aex iociltls uanvp;t4 ltnxo3oo1optrlnvi;s  ruoir oo1lm n fet (f Dtrx  ;u4alx  oeildfaDrl(vsnu0teeoif iydfmtranvs;s)srxrirpoudoptnlfcslt srrr(rpnt0tetnmieiytlaDemnvs u)arxnmr3tytfateanvols)sexoio3nydap elnes (fs2raumonu0ope mieiad sDeau s;u0 lxrmr oo1lp rai o s)srto(r3iodam e iviat) 2tr(rono0aet if3tat a2uanmsnt)texrxo3io1faDrln ils t2triopnydlpe  nvia()arrm(mp;t1tpt ioetatlmDuan onu0 rxrmr3oodfpD luvs () rxm(o3oy4olenlfet t) Draxmpnt4oeeoio3iad aDrauvp;()artnircta1lmtrai il(0 eumim3io4lltelics (  Dtrumpnu1tet mfeiltfmDul( o;u4 rxrmfcoydfatrlies;s tetoxr ny1ol  lici sfs2rmxrpoo0ale iiciyd a ulnmo;(0teeoifcoy1opD  uvil( t2tm(o oo1lpeelnvi tfa2rmu p;o0olt  oetldfa ran pn(0 eenmo3iadlmtelivs;t)seumio3oo1ap emietas)aDur( pnu1apeoioeiyd m2rlnvsnt)texrxfciy1laDrlieol(0t2urio nudlmenmiesl()srum(r ou0alto i3ilsla2eaumo;t)trerir3iydop eliei (0trxrxopiydlm  mneslt a2urxm oo0opx  iciasfa um(vo;(4artrmr3oatom e ues;(0 rumio3iy4oltnmicils  rra(r ;t1tet io3ilt a rm(vo u)arerxf tydopt li i t)s2tm(rpnu4amt mict tf rrrxm nu1tlen fetld mDem(vs (4aetomf oo1lmtraiei s)t2toxr oodlmeelici ()a2ra(ro;t1tetn o3ild s2eln o u4 rtoxoctatlmD aieo;(  2xo(r oo4lle mnvil(fsrtruroot4tpt mo3taslmDumn p;t)tetrxfciytoatelnei;s0 2xoxm3io4ol nmnesl(f rta(moou0alx if3iysfs2ulnmp (4 lerxr ia1laDraneolt texoxo no4lm   nei s) rumx ono0aeeo ieiysfa rmnvp;(0artoif3to1lateau sl( t2uoxr iu4ap n fvtlt srrmx  ;t0tlto oeiytlaDranvon(4 etnirctadlmDrln i;t s2xm(r3ny4lptnlnvsat)artrxrooo4open ociytfs2em(vp;u0aexoxo iadoaDeln o t tetriopoy4om n nviasfsDurxmpou0oetn feiydlm ul(mo u0aexomr3totoaDr u i;()trtm(m ou4om nmneia() rtm( p;o4opt  f3iaslsDumn p u4 etomfcootfaDraivsls)s2urir iodape livtls) ruauro;o4tptniieiaslaDeaump t4artoxrcio1fmtr n o;(  2tmxo3oy4ap n fei s arrru ono0aee mi3ilt sDuaums;u0 rxnio to1faDrln i;(0srxm(mpoy4al  lfetl(f 2rru oou4optn fcilt a el( o t4 exomfctatfmt auvol(0t2xm(m3nodlmtnliesl(faDur(mpnt0aleoiieils mDemnmpn() rtnmr iodfm  aneilt)trtoim3iy1ol n fvslt  rtm(mpou1aeen ociatlm elu p;u0tlenmo iydlatr neo;(0srxrim3no1ap e nviatfa2trxr ;o1teto iciydlm2eln o;t)tetnxr iy1lm e nvslt trtmio3iudapenmnci sf rtmxm ;t4tet io3iad sDum(vs u)alerxr3io1faD aieols)t2tr(mpou4optemicsl(farurum ;u4olt ifciys m rlnmsnu0tltnxrcoo1oa   ivols)s2tmim iy1aptelfeslsfsruaxr no4teto octadls ea(vo;(4 rxomrctadlpt li sls s2urir oodapee fcsls)s2tmx ont1oltnio3ias a2ea( o;u4alerxo oa1lp  aivslt sexoxopou1apen fetasf Drm(mo;o1texnii3iasla2ea(mp (0aeerio3oa1lpD lneo;t)texm(o iy1aptn ncta() 2rr(root1texnmietlt m2ranvp t)alxoif3totlp e uvi;t0 2to(mpnydlmen ivtls sDtaur nt0alx if3iadfaDrlnvp;t)artnmfcty1la eli ilt seurim3ou4ole mnes sfartmur nt4opxo ieiatfmDuanmp u4trxriociytfmtr nvsl()sruo(r3ou4altnlfcs tfa2rrumono1teenio3iyslsDrln s t)aexnxr tydfm rlnes;s0s2tm(m3ny4llt  ivtlt a2tax  nt0aex moeiysfa rmums (4altrio iodoa e nesl(0teur(o oydlpen ies t aDur(m ;u1tpeomf3iytlm2rlumonu0aexnmf tytoptrai olt)t2xmxr3iu1omt mieta()a2tmu ooo0tpt miciydfm2elumont)aetomo3iodlm  lieo;(0s2xoir3no1altn ictlt)sDtm(m nu4tpxomo3tldla rl(ms u0 rtoir3ty1oatr nvil(0sruoxmpoo4am elivtasfa2urxroot0tpenmf3iysfs ul( s (0altnxfcootla   uvs t)s2tmxrpny4lptn nvt sf 2taurpot4tee  i3ils m rl(vpnu0aetrifcoa1lpDe i olt sruriopnu1ll n ivt t)srum(  ot4opeomoeiat s2uan s u)tltrmf3oodlmD aieil() 2umimpou4lltnlncsas  rtrxroou4alenmo3iltlaDum(mp;() eeomo oa1op eln o;s)t2trxr3nydam nmict tf 2ur( onu4tlenif3tydfaDum(vs;u) ltrif tadla  aivi (  2um(m iu1opee fctls)aDrmur ;u1ale ifciys s ra(vs (0 eeoxf3iodlpD aivils)truoxopoy1oltemnvi s aDua(r nu1tpto f3tlt m eau on(4arxrif ta1la r uei (  2xm(rpoudll  lfci sfs2raxmo;u4olenmfeiltfsDumu s t0aeenmrcoo1fa   uvo (0srtoxr3iy4lmtnmnvs s aDta(m ;t1tptoiocild mDuan o;()texnxr3oy1fmD  i i;( srumir iu4aptnmfcs sf rrm(r ;o0oltnmoeiytlmDrlnvp t) ltoio tatlmDeln il( trtmio3ny4op emietl(f Dtm( pnt4altomfetydfm2el(vp;u0 ltoxr3tadfatr n ilt) euoir no4ope lnetatfa2tau ont4olx ioetyslm2rl(msn(4 ltrxo ta1fmDeln s s) 2toim iy1lpe mfcia(  Dum( pnt1teeo f3ias sDul( p;u0tlenmr todoptelivols0teurxo3nodale mies s)srrmu ont0alx ioctas a2rmn ont)texrmoctytoa elues;s) rtr(mpou4am  mfvta(  ruaxr nu4tleomociyt m rm(mp;t)alenir3ia1lp rlivsls) rtmxr3oy1optelies () Dtrxrpnu4oee mi3iydfm2rl(vsnu4trtoxr3ia1fp ran o;s srxo(m iu4oltn fvsl( arurxmpoo0teeo oeild sDel(vp u0 eerir3to1faDrlneilt sexmxmpnodol   nvta( sDtaurpot1opx ifeiysla umu o;()trenirciytomDrai o s0 exrxrpiudlptnmietlt)sDrm(mpou0ale  f3ildfa uln pn(0trxrmr3tadop   ivs;t)srur(r nu1lp  lfetl() rurxro;u4tpx mieildfaDrln s;t4aeerxo oytlaDr ueo;(0t2to(mpoo1ap nmfvsa(f Drm(ro;t1oeto f3ils s2ra(vo;t0 lerxr3tadla rlieil()s2ur(opiu1altn nei t)arrmum ;u1opxoiociyt a2umuvs ()arxnxf to1op raueo t)trtr(mpoy1lmtnmfet ()arrax  ;t1apx iocildls2ea(vp;u0teenir iodfmt  neilt)s2urxm3oo4ll  mfvsasfsDurur ;t1aexo feiltfs2uau s (4 ltrir3oa1fpDrlu s;s seumxmpou4om  livsas aDtrur nt1olx iietaslm2rmump;() lenxr tytopt an s ()t2umxr nodap e nesa() 2ta(mpou4oeenmo3tatfaDea( onu0tltnmo3todoat au o;s s2xo(r iu4ap elnesa( a2ra(r no4alx  fctls sDemnmo ()aetrif3io1oa e ivo (0 etrxmpnodomtnlfcs ( srtr(rpnu4aee if3tytls2emumon() lenxr oatfaDraivil()texm(m nydlpt licia()aDrrumono4ope mieilsla ulums t4 reoxfctydlm e ivi t s2xmim3ny4opt mnvtlsfarraumpoo4tetoifctyslsDum(mp;t0arxnir oytlm e n slt0teuoxopoodolt  iei (fsDraumpnu4apeniietydlm2ranmp;u4trtnmf3oytlaD anes (0teuoio3nudap nlneta( a2raxm oo1alx  ociatls rmuvs u4 rtnir totlaD  n s (  exm(opio1oltn net (f Draxmo;u1tptnmoeiytfa2ulnvp t4trtnxrcoytop elneo () 2toxopoo4ole mfesat) 2rm(  ou0alt ifeiadfs2ean o (4 ltnir tadlateln i;(0 2tr(r3ny1amt mnvs t) rum(rp;o1alt iociyd aDemu o t0treomo3tatoptranes;t0t2xo(m3ou1lptnmfcsas s2raxm no0tpx  i3ilt a rmnmonu0treoio3oy1fpDeln ils seurir iu4lptn nesltfaDur(mooo4opxnmo3tyslmDeau s;(0artnmf todlmDr nes (0 rtriopiu1olenmfvtas)srtmx  ;u1tltn iciat aDumnvs (4 eeomf3ta1lateaueo s)srtmir3ou1amenlfetltfsDum(mpnu1aleomociyd aDua( o (4aeenxf3oadopt  n o;s0 etr(r3oydaltnlfvsasf 2rau p;o4tltnmietas mDuan s u)aexoxfcootlmtean il()trtoxopiu1llt lfcils  2trumpou4opxoiicildlm2um(msnt4arxomfctadlpDrlivols)s2trxm3oudapeelieias aDrmumo;o4optomoctas sDraumsnt)treoir oytfmt  n o s sexoxr3iy4oltemfcsls  rtr( pnt1oleo ociad aDrauvsnu4 renir3iatlm rli i t0seur(r nydop  lnctasf ruru  no4teeomieiatfa ran ont0texomf3iy1optrlnes s)tetoxopnu1lm n ieia( a2rm(mont4oeto fctysfm el(mo u4 rxrxocoatom  auvil()s2urio oydamtemfci s)aDumxmoot1oee iietas sDrmn onu4aexoxr oytlate ieo t)t2umio iy4om   fciltfs2uau o;o4aex iietyd a emnmont0aeerioctodfatr i ilt)sexoxopoodomeemivi sf rrrur ot4oltoiiciadla2uanmo;u) eeomocoytop   ieilt truo(o oy4am  mneias  rtrxm oo4aeeo fetls a ranvo;t4 eenxf3iytop raueo;s0 eurir iu4amen fesls  rrm(r oo0tltomoctysfaDrmump;(4alerxo3iatla e nvi;t) 2trir iy1al emncta(faDrmxmo;o4oee miciyd sDrmuvp;t0teerio oo1lat lieolt) 2xo(r no4ll nlfeilt  2rmur no1opeomi3iyd s elu s;t4alxomociadop eluei;s t2trim3nodal nlfct ( a2uaurpnt1alxo f3iasfmDrmu p ()aeeomfciydopDr ivi;(0trurir no4aptnlncs t  Durxmpno0oet mfetyd m eluvs u)aeeomf3iatfate nes;t) 2tmxrpiu4alt micils  rrm( ooo1alt mictad a2el(vpnt4tltrmfcoatfaDeaneilt)trtmxr3ny4ll nlfct s)arrr(mo;t0tpeomfetaslm2rluvsn(4tetrxr iatom eau il() 2um(opiydameemfvsl()srumx  oo0aee ifeilslaDrlnvp;u0areoiociydop eluesls0teuoio oy4om nmfei s) 2ra( p;t1opxomi3tyd sDraumo t4 rermf3iydla r nvo;t  2xoir ou4lm e fvsltf 2urxrp;t0opx  ieiyd a rmuvs u0 rerif oo1fmtean o t0sexoim3oy4omt mivi (fsruaump;u4ope ii3tad a em(mo (4aexnxrciadomtraueslt srxoirpoy1optelictlsfaDtru  nu4olt ii3iadfaDra(mon() eeomoctydfatr u s;s)tetr(r3iudap   iei sfs2uaum oo0olt  fetadfs2uln p t4 lxomfcoodfateli sl()truriopnudomtemfei (fsDtru p;t1tptnmo3iasfmDuanvpnt4 rtrirctadopDranes ( trumiopiodom  miesat s2um( oot0tpto fetadfs ea(mont4 lxnxo ootfpt li i s) 2xm(mpiy4alt mivil(f rtmx  no1tetnmfciytlm2ra(vp u)aexnmo oytlpDeluvo t0teuo(rpnu4ape livia(fa2raur no4tlenmieiydla um( s;u0trtnmo3iatomDelnvo ( s2xrio3io4lp  lfeta(  Drruro;t0teeoif3ils m eau o u)alenxr oo1fmD ln i (  2toxmpny1oleelieil( sDrrxmo;u4aexnifciltlmDumuvo;t)altrif3iytlm r nvol() exoio3ny1lpe  nvsatfsrurxrp;o4oexnifciaslm ul( s;u0aetrifcoytfmDrlieo t0t2urim3iy4ope mnci s  Dua(  ;t4olxomoctltfm2ea( o;t4 rerxf3tadop r ivs;(  rtoiopoodop e nvtasf rtaxmp;t4aeeo ociytla2rm(von(0alxnif3oodomDr n slt)setm(o3no4olenmiei s sDtrum ou0oeenmoeiyt mDua(mp;()alxomo todfm   ueilt) 2xo(r nudameelfes (f rtmx ono4oleo iciatlmDean p;u0tetoiocia1latrlueols0texmim nudapen fcias)srrr(mo;t1ale  i3tatfs2eluvp t) lxoif3todlm  ai o;()srto(rpou4om elneslsf rua(rp;u4ape  f3taslm ua(vsnu4trxrio3tatlateaneo s)sexmim3iy4op nlfviat  Dur(monu1open i3iytfm2uln o;(4trtnifcootfaD  nvo s0 eurir3iydam nlicias s2ra(r no4ape mf3iatlm2ea(vs;t0tleoiociy1faDelnvols trxm(r iu1omtemieta(  Dtr(mpnu0tpenio3tasls rmn o u4trxrio3iydlp elnei (0 2xmio3oodole  fei s)aDumum ;u0oexn feiasls ran p;t0tltoxo3oy1omD au i (0tetm(o ny4alenlfvslt a2rrx  ot4oexoiiciydfa2em(vs;(4 exrxrcta1optean sls) eumxr3oodam n iei ()srtmurpou0texo ocildfmDum(ms u) lxrxocootlptr uvs;t  rtmim3nu1amtemies tf rtax  ;u0alx io3iadfs rlumo;u4 etrxo oy1fpDrai i;(  2toirpoy1opt  ncilt) 2taxmo;u1aexo feilsls rau p;t4 lxnmo3tytfm ran sl() rxrio nudam  mfvia() 2ra(ro;u1alt if3iatlaDrmu p (0aetrxr3oydfmtelu s s0teum(o3oydlptelneiat a2ta( o;t0oeeomf3iyt s rln o;u0 exoxo tatfa rlueo;(  euoxrpio1amte nctat a2rm(monu4oetoii3iaslm rmump (4 rtnif oadfa  ln ols s2um(rpno4lme lneia( aDtaxrp;t0aptoiieiatlaDra( sn(0tetnir ta1fp   uvo s tetoxm ou1omeemfet tfs2tr( p;u1ope ifctytfaDem(ms u)arermf iadopt lneilt srtoir oo1am   fcta( s2rax pnu1oetn ocildlm uau pnt4altomo3iodopt  n slt0trxoio3iydam e fcslt)srururo;o0olxn ieiltfsDuan o;t0 reomf3tytoaD liei s0seurir no1ap n ivsls)s2uaxrp;u4opxoii3tydlm elnvpnu0teeoif oy1lpDrluvi;( s2xmxopio1lmee nvs s)a2tau oot1alx  f3tysfaDem( s (4trerxfcoytfmte uvi ( tetmxm nydolenmfci t)s2tau  oo4apeo iciad m el(ms;u)aetrirciotoate neo;s trto(mpio1om e fetlt  2umx o;t4tlxoiieilslm2em(vpn(0 rermoctadoptrlu s (0trxr(o nu4oltemfvtls srrax  ;o1tlxoiociat a ea(monu0 lxoxo3todoaDrai s ( trxoxr nudlpt  fetat) rtrxmo;u1tlenmfeildlsDuanvo u) lxoxo oydopte i il(0 2tmxmpou4al emnetls)aDrr(mp;o4teeniociydfs elumonu0alxnio3ia1lptraivolt) rxrxrpiodoltnlfvtls) rtrum nt4aptnmi3tlt sDem( on(4artrmocty1oaDelnvs s0 rtoxmpiu1lp  licsasfsDtr(moou4aptnifeild s2rlums;(0arerxr3totoa e u o;t0 r
\ No newline at end of file
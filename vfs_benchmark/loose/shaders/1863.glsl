@@ -0,0 +1 @@
+uvo (0srxrio3oy4lm emfvslt)aDua(ro;u0tpeoifetlsfa rlu p;()aexrxfctodfaDrluvo;t0 exm(o3iydlmt mici () 2umx p;u1opx  ictytlm el(vp;t)trerxo3iytlmDeaivsl(  rum(m3nu1lmtn fcsa()arua(rono4tpeo feils a umums u4 ltnxo oytom  luvi s)s2xmxo oo4omtemieilt sDraxm nu0teenioeiydfmDrlumo;t4texrxfciytfmtrlieslt) rxr(rpoodop emfct sfs2urx pot1aet  iciytfaDrmu o;u)teerxr3tydomteanvs t0s2uoim no4lm emieiasfa2um(mp;o0altn ieils a ran s t)arxnxf3tadlpDe uei ( teum(r3ny4ap e fci s) 2umxmoou4tltnmoeiysfmDrlnvs;()tltomfcio1fpt lnvo () rxrxmpno1omt lnvtas  Drax poo4texn i3tys m2eln s;()treoxr3todoptelieo t) rtoxopiu4altnmnct t s2raurpoo0ope  feilsfs ulnvs u0altrxr oy1fateai i;s)setmirpoy1omtemnvsas)srta( ont0olx mf3tltlaDuan s u0aetoio ootop rli i (  2tm(mpiu1lm nmicslsfartm(m ;t1oetniieiad a2ea(vp;u0texnxrcoodfatelu i;s)trxmir3oydlm n fei s) rua(m ;t0tle miciyd mDranmo t4 rtnmfciotlmt lieo;( teuoio iodap e nesls) rrax p;o1tpeoii3tlslm eaums;t4 renif3oatoaD lu ol()sexmir nu1lmtemiei s) rrmx pou0tpeomfctltfaDrl(mpnu4treoir3iodom r nes;()trtoio3ou4ome licia() rrrxm nt0oltomo3ias s2elnms;t)areomr todfmtrluei;()srum(m3no4alte fviat) rtaur ou4opxnioctlslaDuau p;t0aetrxr3tydfmD  nesl( s2to(opio1op nmictatfa2tmumo;u1oetomo3ilslm2rmu p;u0 lerircto1omDelueo;s)s2tmio nu4lm  livsl()sDtm(  nu1aetnmf3iytlm um(vs u4trermo ootlm eaneil(  rtrir oo4ope  nvsls s2taxm oo4opxn o3tysla2rmn s;(4 lenxr3ootla e i il(0s2trxm nudam emiei (  Drr(root0ale  i3iad aDulums;u)altoxr tadla rlues;t srumim3oo1ole  ietl()a2ur(m oo4tpe ioeiat m2ul(vs;t)artnmr oydomteaues s)teumio nodameemietl()srtau  ;t4oee  ocilsfm rau p;t) lerifcta1omteliei;s) 2uo(r nodomtn fcia() rtmu ono0tltoiiciydlmDulu ont4alermr3todoat aneolt trxmio ou1omt lictl()a2rmx pnt4tlenmi3iytfm2emnvo (0alenxr oadlp  aivil(0 2tmxm oydol n ncsltfs2raumpnu4open ietldfm rmumo u4 exomf3iotop eaueol(  2um(m3iodapt lncsasfaDtru p;t1olen fciat s rm(vs t4tetnxf3ty1latr nei t  2umimpno1ome mnct t) Drax ooo0oleo o3iaslm2eaumpn(0arerif oodomDranvol(0s2xrxrpnydal emieilt a2tmu ooo0tltomiciltfm2rlu p;u)trxoxfciy1lm   nei s texr(r3nodap  lfei sf rua(mpno0olto o3iytfsDel(vp;(4tetnxf3iatlm eaieolt0setr(o3iu1optn netas  rumu ooo1tleo oeilsfs rau on()aetnir ty1lm elnvo t seuoxrpou4oltnlnvsls s2rrumont1aexo o3iyslm2rl(mp;u)teerxo3iadom  ai ilt0t2ur(m iodal nmnesat) ruaumpno1ale  o3ias sDrlnmsn()tltrxo oo1lpD livslt0 rtr(mpio1om  lnvi s)s2tm(ro;t0tlen icias sDraump t)artrxrciytfpt lies;s)tetr(rpny1om  mfvi ( arta(monu0tlt mfeild a rmu p;u)tlxniocto1op rlu o;t  2um(r3oy1lm e ivsls)a2ta(m ;o4oexoifeiyd s2el( snu4treoxo3ootfa e neslt seur(r3iydamt mnvt t aDtr( pot1alt miciys aDran o;u4 eenif3totopDraies s  rxrir oudlmenmfviat)sDrrurpoo4alxnmf3iasfsDemuvo u0 lermf oa1lpt lnei;(0s2tm(m nydllenmfvt ()s2rm(mpnu0ole mietadlm2em(mont0tlxrxr3oytopDeaneo;s texrxr ou4lp e ncia(  rum(mpno0oet mf3ildfs el( pnt)trerxo3totfmteaies;s teum(r3no1optemfeslt  2umxm nu4tpx mi3tadla2rl(mo;()teerir totopt  n o s sexmxr iy4al   nesa(f rur(rp;u0ope  i3iasfmDemnvpnt)altoxrcio1latrai i t)texr(m iu4oltn fvsatfa2umurpoo4apen f3iysls uan o t)tltoxr oa1fpte i s;t0truoxmpoo4lpe  fetl(  rurxm ;o0tlt mieilt s2umumo u0alxrxr todlpte neols0trxmxo oodopen ivs ( arra(mpou4apxo i3iaslmDelu onu4teenxr3ootlmDr nvil()tetoxo3iodlltelfvia(  2tr(mp;t4tet if3tytla ua( pn() reriociytlpt lnesl(0t2xmxr3nodamt  fetltf Drru p;u1aet ifctasla2raump;u4teerxo oadlp r ieo s)texoim3ou1altemnvslt srta( o;t1aetomfciytfa2rm(mp;u4tltnmrciotop eaivo ()t2xm(rpoo1altn ictl() rrr(rpnu1teeo feiadla elumo;t) leoif3oatom  au ol(  etoim nu1lme mietasfsDuaxronu0tlt mo3tyt a2eluvp ()treoir oatopDe n i;(  2toxr oydlle  nei sfsrta(rooo4aex mfetydfs2eau o u0 rxoxf iydfateau il(  exmio3nydopt  fetl( srua(rp;o1tex  f3tas s umuvp;t4teerxr iydomte i ils t2trir3iydamtemfet () Dta(ronu1tlxoiocias aDum(vs (4 lerifcoodlm  luvs;()t2uoxmpoodlpenmfeiltf Dtr( ono4oltomoetasfmDem(ms t4 ltoxrcoatopt liei;s0 2xmir3oo1lltnmfvtls)aDrrxmpot0olx mf3tlsla rlu s;t4trerxf iy1omDelu o t0trtmxmpiy4ape mivtat)a2uaxm nt4olxomictlsfsDuauvo;(4arenxf tadfaDe uvo;( texrxmpoy4amenlfesatfs2tm(  ;u0apxnioetyt m emuvp u0 rxrmociydoaD aivols0seuoxm ou4llenlnes s sDurum ;t4teeoioetytlmDulnmo u4aeeoir iytlatraues ()srto(o nu1ol nlfetatfsruaxr ;u0teenmo3iatla rm( snu0 rermr3tydlp ran sl()srum(m ou1optemnes s  rrau p;t0ole  feiyslaDrl(vo u) exoxo3iytla   uvs;(0 2umxo nu4lmen ies (f rtm( p;u1apeomi3tlslaDrl( p;u4tetnmfciytomDrai ols) 2tm(r ou1lltnlfesl() rururpnu1tlt  ieiadfs rm(vsnt0 rtnioctadfp  aivo;( s2tr(rpno1oleemietat) 2ra(r ;o4aeeniieiyd aDumu o;(4trtrmo io1fptrauvol( t2xrio3nydom elncsatfsDtrur no0tle mo3tlt s ea(vs;u0 ltnir3oatom eln ol( teurxrpnu1ale  nci ()arrrumo;u0oex mfeilt a em( o (4aexnxo3oo1lptrlneo t0 etmim3oy1alen nei t  Drmx oot1ape mfciat s2uanvs;t0arenmfciy1lmte iesl(  2xmir3nudapt mnvi sfs2raxrono0oexo feiltfa eluvpnu)teerxf3oydoa rli sls) exm(m nydol  lfetas) ruaumo;t0alx  oeiytfmDuln snu4tleniociatlpDraieo;t setrxo oy4lmtnmfvi tfartmxmoot0tlxoio3iysla em( o u0 exomfcoy1oate uvs;t s2xmim3oo1lpt mnviat s2raxmpou4tleoifctyt m um(vsnu)trtnmoctytom  auvil() eumim no4ope  fviat  2ua( pnu4oltoifcils m umnvo;u4arxnxfctatlateauvo ( setmxm iudapen ici (fsrrmx o;t0oexoioeiatfa2ul( o u0tleoxfcoodlpD aiesls)s2xmxm3iu4op nlncil(  Dtau ono4alx  f3ilt s2el(vo t0 ltomf3tydfmDeauvslt s2xrio3ny1lp  mnctas artrx pot0aleoioeils s emu s ()artnir iadla  lu i ( trxrxm nu4op  lfcsl() Dtrx ooo1aeeo ietysla ul(vsn() rerirciadfmtranvi t teuo(m nydlleelncta()a2urur nu4ope ioctytls2um(vsn(0aetoioctytfaDeln i;s0trur(rpoo4lp nlfctat)aDrmu  ;o0apen o3ilsfa raumpn(0 exrio oo1faDeanvo t)t2to(o3no1ll  liesa(f Dta(mooo1aeenio3iasfa2um( sn(4trtnmocto1optrlnvs t)seuoxopno4llenmici () rua(moou1ale mociad m2elumsnu0altrmf3oadlmDraneslt  2urxrpoo1om  mict sfaDuaumont1olt if3tld sDum(von(0altnxr3iotfateai ol( s2urxo3nu1om emivilt)s2um(  ou1ole iociatfsDraumpn(0arenmoctadfp  li sl(  eurxm oy1op nmivtat)srra(root4tlx  iciasla2ra( p;(4arermo3oatlp e i sl()t2xoio iy1apt mfcs (fs2trx  ou4aexn ieiltlm ea(vsnu0 etnif3tadfaDr nvi;() 2tm(rpnu4oltnlnvsasfaDuaxmonu0aetnmocilt a ulums u4aeenxr3io1fp rluvslt  2tmxo nydapenmnctat sDraxronu0olxnif3ilt a2ra( snt0tltnio3iotfp  lueols texoxr no4op nlict () 2uaumo;u1aee  ociatlm ua(mo;u)aeeomfctytlp  lnvilt) exmxo3oy4ol  mfetl()srum(m ;u4texnmoeiadfs2emu o;(0texniocia1lmDranvo t)s2xm(m oo4alt lfetls s2taxrp;u0alx mi3iyd a2um( p;t4trtrio3to1fptelivsl(0s2xoir iy4lptemfvtl(fs2uau  ou4tleniociatlmDrlnmpn() ltrmf io1opDraueo ( s2xoxm3ou1al n fvs () Dtmxm oo1apx iiciasfa rm(vo t)teeoxocoa1op  lnvs;s s2uriopno4lpenlnciat) Dumx oot1oeenmo3ias aDrluvp u4aexoxo iotfpD  ueo t t2umir io4lmtelfvil( srur(mpnt1aleo ocildfs2elu p t4aetomo3to1fm ranes t) 2xoio iydlp nmicsa() 2tau  nu0olt  ietlsla2rlnvon()trerxocootoat auei s0 2xr(o ou1lmenmivsa(faDuau  ;u0opt iictaslm rlu s (4alxnmf ta1fat luvs;()t2xmir iudlpee icslt)a2rru pot1apeo ictyt m rlnmp u0trenirciytfp e ivsl(0trtr(m3iydope lnet ()sDtm(rpou4aee  o3iltfs2elu p t4trxrio3ta1fpD livs (0seumxm oo1ape lfeiltfsrta(rpnt1ape moetaslmDumuvo;(0altomociatfpt aneslt0 2xo(opnudal   fvi s a2tmxrpot0apxnmietat s2uluvs u4treoio3iytlmDr uei;t) exrirpnudope lfet (  2tmum ot0alx  oeilt s rauvs;t4trtrif3iytfatean ols0seurim no4opt  ncils) rrru  nt1oexniieiatla eluvonu)texoir3ta1lmD  u sl(  exm(r iy1ll emfeiasfaDrm( oot0ope  i3iydls2emuvp;t4tetnxocto1fa eai ilt0sexoir oodomeemneias)sDrru pot4aet ioeiltlmDeaumsn(0 eerir io1op eli ilt0setrxm iy4op elncsltf Dtmuro;o0aex miciat s2em(mp u)tleoir oadoa raivi;( seum(m no4altnlfvtls) Drmxrpno4aet iieiadfs2ra(vs;t) lxnmr3iy1oa rlnei s setm(m ou1ope lfvt t)sDrax o;o0opeo f3tad s um(vo;t)trxnmfcty1oa  li i;(  2uoirpno4ame  ieta(faDrr(mp;u0teen i3ilt s2eln p () reoir3io1oaDe uvo s  rxmxr oydlp n ncil( artr( pnu4tpxnifciysla ulnvp;(4altoif io1oa   ivi;(0trtr(o3nu1olee nvtl()arrmx ooo0alxo ictydla2umnmo (4tlxrmr3iytfmtr i o ( s2trxopou4al  mncsa( arraxrpot1oeeo ietaslm2umnvs t) etnxf3io1oaD lnvo;(0 2xrio3no1ale lfeiltfs2rm( onu0opxomicilsfa emnmp;(4tltnir oodfaDe n il(0t2tr(rpoo4al elfctlsfaruru p;t1altomo3tlsfaDum(ms () exomr3iodfmtrlnvo t0trtrir3nudoltelfeiasfs2trxr ;u4alxo i3iasfa2rmu pn()texoxfciytlpD li sls0 rtr(o iu1omtelfvt (fa2uru  nt1apt  ieiyslm2uanmo (0tleomf iotomtr nvi;t)setr(rpoy4om  miesatfarur(moou4alx mf3iltfm rmuvs (0arenxr oytoaD au i t)s2uriopou1lpt lncsls)s2tax ont4ape mieilt mDrl(vsn(4teeoxo tydlpD livi;t) 2xr(m3oodlp elfvta(fa2raur ;o0olenmi3tydfa2rmnvp u4tltnmrcoytlaD lueslt) rtriopoy4ame  fct ()aDur(rpou4aetoiieiydfa eauvo;t0 rtnmrcty1fp  ai slt)trxo(o3nodamen nei sfsrraurpno4opt  o3tydla2umuvpnt4 eermfciydfat lieil(  etoirpny1lmen fvt ( sDrru  no4oee io3ilsfsDuau p;t4 lenmr3iadlaDr nvi;s0 etr(m no1aptn fes () 2tmurp;o1tlt  iciydfa2um(mpnt4 ltomrctydfmD  uvi;( trxoio no1am nlncsat  Drr(rpou4tpx mi3iyt mDel(vo;(0tltoir ty1lptr nvolt t2uoim3oo1ol nmivia(fartruroou4ole  f3iaslm ulnmpnt) reoxrciytfp ean ils srtoim ny4omtemivi sf 2ur(rp;o4alx  i3tlt a2uaump (0 eerifcoadfpD  i sl( teum(r oodlmeemictas)s2tm(r ot0aeen f3iadlaDelnvpnu0tlermoctatlmteanvs;()seto(m3oudlptn ies ()arrm(monu1opxo f3iytfsDum( o t) eerifcootfmtranesls  2tm(opoy4ap nmfvilsfs2rmx pnt1olxnif3ildlsDuauvp;() etrxrcio1fa eanei t trurxo iydom nmfesat)srrrx o;o1open fctadfs2ulu onu)aexoifciodoatrluvs;s0t2tr(mpio1lmtemncsl() 2uax  no4tpeo ieiasfsDuln s;u0teenxo io1oatranvsl() 2uoir3iydameemfcsas) 2ur(rpoo0teeomoeilt m2rmnmp (4altrmocoydoa raneolt)sexm(r nu1lmeelfeiat) Dtr(  ;t1oltomoetlslmDeanmo t)aeerxf todom   i i;t s2to(o3ny4ll emiet t)arrm(  ;o4tle mo3ilsla2elnmp;u0altomo3todfpD  ivi t)srxm(opoydomt lfvia(faDraxrpno4tle mo3iydfmDea( p (0 exoif iodlmtranvilt  eur(mpnu4lmenlncia(farrrum nt0aexn f3ias a2el(vs ()aexoif3tydlpD  neo;( srxm(m3iu1altn nvt (f 2ur(m ;t1alto octas m2umnvo (0trxniociodopt  uvsl( seuo(o iudllenmfetat)s2rrxrpnu1alto i3iysfm em(mpn(0 ltoif3iydlmDr i s;t)trtmio nu4lpte fctasfs2ur( ont0altn o3iydlmDemuvp u0 eeoifctadlmD  u i s)s2to(m3iu4lme lfvtatfsDtm(rp;o4opeo oeiysls2emn p;t0 etrif3oy1op eai o;t0s2trxr oy1apen netatf ruax pot4oltomfctasfsDrl( p u) etrif iatlp  anvo;s0 rurxmpio4ap nmfctat  Dtm(mont4tlxomfeildlmDelnvs;(4areoif3oodfa rli i;(0t2xmxm3iy1al  mnvsas) Dtr(rp;t4tpeniieiytlaDea( p u0alerio ootlpt luvols srtr(o iu1opt mneias)artrx  nu1apxn fciad sDelu p;u0artoif oadfmDranes;s srxo(m3iy1omtnlfetat) 2uaxr ou1tltomfciyd a rm(mpn() reriocoy1opDrli s;(0 exmxopiu1ale liet sf Dua(rpou1oexnmfeiatla2umumon(0tetrmr oo1fm  lies;s trxoxr no4ll elictls  rraumo;t0tlxn oeiat s2um(vpn(4aexnmr3ta1fm eanvilt)srurio nydope  ictls sDumxm no0tleo ietys mDul(vo;u)arxomo ootoa   i sl()tetoiopoodom nmivtasfs2tr(ro;o1apenmoeiydla2emnmo;(0trtrio3iydomD lues (0tetoxm oodopte neilt a2ra( onu4opt ifctatfs elnvo t)alenxo iatfpDelueol() etm(r oy1alt lfcs (f Durxmo;u1oltomoeiyt sDul( pnt0arxnxfciadomD livo ()srumio iodopt lfvsas  Duaxr nt4oltnif3tldfa2um(ms (0 exrirciatfa elivils) rtrir3ny1lme lfei t s2tm(ro;t4tetomo3iad m uluvo;t)aeenxo3tatlpD au i t srxrim3oo4lp  mfcta() Dtrurpou0aex mfeilsls2em( on(0 reoif3iatfpDrlnvo;t) 2tmirpiy1openlici sf rtaurooo4oetoii3tls a2umu onu4arxnioctydom  lu o s)trur(r3nudlle  netat) rtmu  ;o0opt iieils aDul(vsnt4 rtoircta1fpDeauvsl(0t2tm(m3ou1ame mfcsl( a2rau pou0tlt mfeiadfm2eauvp;(4aexomo ta1lptrai s s trtrxm oo1om  lfcsasfsDtmu p;o1oexn fcild sDea(vs;() etoif3io1fa e neo;(0trtrxopoudll  lncia( srtaxr no4openmictydls2rlumonu4tetnifcty1fat li i t0 exrxr io1alenlfvs t)aDrm(roou1ape if3iad a2ra( pnt) rxrmf tytoaDr neo t0srxmir ny4lltnmfeiat) 2rrxmp;t1alt mociysfaDuaums (0arerxocta1la  luvol(0setoirpnu1lm n nvi s  2tm(mp;t4tpt mf3tls s umn ont0tlxoif3oo1lp  aneo s0setmir iy4opee net ( sDuau o;u0tee  o3iyt mDemu p;t0teeoircta1oatraivi s  eurir3oy4optelfvil(fsrrrxmonu1tet mfciydfm2uau p;t4 leoifciadom eln o (0s2tm(opiy1lptemncs t  Duau pou1opt miciadfaDea(vpn()alxrxr3iodfaD anes;s)s2tmiopou4ole  fviat  2rmxrooo1aee mi3iat a2emuvsnu0aetrxf3oo1la r n sls0 rtoir3oo1omee nvsasfaDrmxrpot1aleo ieias s2rmnvs u0tlxomf todomDeau s;(0s2trirpio4am emncil()s2rrxmoot1tptomi3iaslm rluvpnt0texomocoy1fp eanes s  etoio3nydal n nct t a2rrxm nt1optnioctydfm uluvsnt) exrmocoo1la e ivi s)srxoio3iu4alte fes ()aDrrurpnu1oet ii3ildls rmumpnt4tlenio3oodfmtrlu s s) eumxmpoydoptelnct (faDrrxronu4tetnmfcias m uaums (4tetrxo oadlp   u s;() 2xrxm io4opt lfes t) rrmu  nu0aleoioctlsfmDumnvo;(0 etoif3iadfa   uvi () rxmimpoydal emfvtas)sDtruro;t1oee mo3iytla elnvonu4 etrxfctadlaDran i t0 2trimpnudlpen ictatfsrur(m ;u1oex mocilt a emnvp;t4tetnxocoytlmD  ues;()seto(o3oy4al   ncs t)aDtr(rp;t0alt  fciyslm2rmuvp;u0tetnxrcta1oaD li i t0 rumxo ou1amee ictlt  rumxrpou1apenif3iad m2ean pn(0alxnmf3oo1optrluvi;s0 eumxm3io1lme lictlt)sDraxrooo0oetoioctasls ra(vp (0arenmociadfpDr ueils0t2xr(rpnodllen nesas)a2rau p;o0aexomiciytfs ulums u) exomr3totlmDeaiei s0sexm(o no4op  mfeil( sDrmur ;o0tleo feiltlm eanvs t4tlxrmfcoatfmDrlivs t) 2trxrpoo1amenlnvsa( aDua(m no1tlxnmictydls2rl(vs;()aetrmrciydomte ies;t0seumio3iu4ope micia() rtm(ront0open fctltlmDrlnvo u)trtrxr3oytopD ai ols) etmio no4amte nesa(fsrur(r no0tetoifctydfm2ulu ont0 reoiocta1fmDe ivs () 2uoxr3no4ole  nctls)arraum oo0oet io3iytfm2eaump t)altnxr3oadfp raiei t0truoim iy1omtelfetlt aDtrxrpno4opt ioeiytfm elnmsnt)aleomfcootlatrlu i s)srtm(o ou4ol nmncia(fs2tmxmp;t1tlto fctld m ul(ms;t0arerxf oodomte ivi (0 rtmxr3nudll nlicta()aDtr(r ;u0teenifciatls eanvs u4 lxrircoadomtelieo (0srtm(o3iodop e ncilsfsDrau ono0oetomoeild a2rlu s;t) eeoxr todoa e uvo t)t2xm(mpoodlmenmfct s sDtrxr oo0ale mi3iadfsDumnvs;() rtnxrcoy1fat au i;t0sexoxo nodalenliet () Drmu ono1ole iociysls2eanvo t4trtnxf iadop rluvs ( srto(r no4opeemfetat)arrmum no0tpenifctlsfaDrmnmp;t0trxnmo3oodopt  n i;s0setm(m3io4ome licsl( arta(moot0olxnioetld mDean p t0 rermrcoa1fmD an s;s)srumiopnudopen ncils)s2rrxro;t1ale io3iytfsDra( snu0aetnioctatoaDeaieo s0 rxr(o ou1omtnmnetltf rurum oo0tet ifctasfa2ea( sn(4arxnir3ty1lm ean ol( s2xm(m iu1apt liet ( srtmxmo;o0tex mocilsls uanvsnt4aexnxf3iy1omt lneo;s)trtm(m oy1olte neias artmxmpnt0ole ifctytfa uluvs t4trtnifcoy1oaDelueols  2tmim iydol nmfvi sfsDtm(  no4texn fetltfm2um(vo u) ltrxf ia1fp elivs s0trxriopnydap elfcta(f 2um(rpno0tee miciad s uanvsn()arermr ia1fmDr uei t)texrim ou1olt mfeslsf rtruroou1aptnmo3iys a2el( on(0aetrmfctytfaDe neol(0srtoimpiudal n ies t) 2rr( o;t4tet iiciysfsDean o t)alxrmr oodoa   i o;()trum(mpoydlm elnvilt srumum oo0aexn ieiasfaDrl(vonu)trxrxo ta1lm raues t) etoir oo1openlneiat)aDumxrpno0tpx mociyslm2rmn sn(0aexrio oa1fp e n s;t)texo(o3oodapenmfct (fs2ta( p;o4apx if3iasfa umuvp ()teerio3iotlpD  ueo ()trxm(o3oo4omte nvsl() rumuronu1apxoiiciat aDum( p;u) lxnxo oatopteau s;(0 rtrxo ou4lp emneilsf Drru p;o4apeoifeiyd s rlu p (4tltnxf totoa elueols) 2toxo3iydol  livilsfaDrm(moot0alx  oeilt a2ranvs;u0 rxrir iotomteln o s seum(opiu4ape mivi ()sDurxm ;o4oet ifeiltfm2rmnvp u)tlxrmf oa1op rlivi (0sexm(m ny4ole mfcias)srtrumo;t1oetn ociysls emnvp (4texnmfctodlp   u o (0trto(o nu4ol  lnei (  Draxrono4ole iocildlaDuln pnt4 eerif3ia1om ean i;t0 exo(rpoo4altnlivsa(f 2raurooo0teeoio3ildlm elu sn(4aexoxrctytlaD luvo (0 rto(opoy4lpt miei (  2ur(m ;o0tlx  i3ils a elu o;u)tleoir oytoaDeaivs s  2xrxmpou1llt lfvt s  2ua(rp;t4optn ietytfsDua( o;t4alenmfciotlmt ai o;t sruo(m iodom   ict t) ruru p;u1tltn f3ias s2ea(vsnu)alenxrciy1fpDelnes;s) 2xoir3no4aptnmivs s arra(r ;t4ale  fciyt sDrl( pnt4tetrif iy1lmDrlivs t0 rtoio io4om e nvs ()aDurxr no4oexnioctat a ea( snu)trenmr3iadopDeluei s)truo(mpoy1ap nmfet s artaxrpno0oeenioetltls eaums;t0aexrio3to1omteau ilt0 exrxmpny1omt lneiltfa2taxmo;t4tlxo o3iydlaDrl(mont0 ltrmfciodla   neslt0 2xm(o3io1apt  ici ()arrm( p;u4ale iiciytfm2rl( p;u0tetomr3todom r i i;(0setoio oo1amtemnvs ( a2uaxmpno1opxnmf3iatls emuvp;t0 leomocootfatrai s;s)s2tr(m iy1open nvtas  Duaxrpnt4tltn ieilslaDemumo;()trxrmr iodfpteli i s)trxmxrpiodlpen ivsat  2rr(ro;t1optn fetlt a2ua(vp u4tlxrifctydlpD lneo;s  rxmxo io4lm nlfesa(f Dur(  nt0alxn ociasfs uau s t4 lxrmf3oo1lp  lu i s seuo(m3no4olt mnvi ()srta(rpnu0oexnmoetydfm elnvo (4 eerio todfaDr ivslt0 eumimpnudomee fvslt aDua(m ;t4tlt ii3tatfm ea( on()trenxo tydopte i s;( s2toir3io4lmtn fvtas)s2ua(mpnt0tetnmi3iydlaDrmn p u0arxoxo3tydfpt livo s)srxm(m3nudapeemnctat)sDrr( o;o1apen fciasfsDrlu o u4trtnxr ia1lmteauvi;(0 2to(mpoy1ol  lncilt)artr( o;u1oexoiieiaslm umn s t0texrmr tydoatrlies;( t2trxopoy4ol  miei s) Duaumpnu4tpxomictltfs um( s;t4trerifcoatlaDrlueol( srto(r3oo1ol nlnvsa(f rtaxm nt1optoii3iadla2em(vpnu4artnmrctatoaDeaivs;s  rtmim3iy1oleemicsls)aruru  nu1opto ictls a2emu pnu0aeeomociatlmDe ivs () etr(r3io1alen fvtat  rumu  ;t4opxo ieiysfm elnmonu)tlerxrctotlmteluvs;() 2uo(mpoydop e nctas srrm(ront1apenioctas a2uaumsn(0 eenio3tytop ean s t0srxrio3oo1lptemfetl()artrxmoot4oeenio3iyt sDemnmo;u)tltnxr iytlmD anvo t t2urir io1apt  nvtas)artr( ooo1tetomoctad s ulums;(0 rtnif iodlaDeaivs;( s2to(mpnudlmenlnvils sDtru o;t1aeen o3iat s2ul(vp (4 rxoio3tytlm  li sls0s2uo(m3no1optemnvt (faDrmxmpou1oetoiictlsla ul(vo ()aeeoxo3iydla  lies () 2xmxo3no1om nmivsa()srururono1aee  o3tys aDemnvp;t0 eeoir3iodfp eanes (0t2ur(mpnudoptnlfvs t)s2uaxmpoo0texoiieiysls ua( p u)alxnxoctydoatr u o;s)trtm(rpoo4lm emfetas)s2rau oou0texnmo3iatlaDel(mpnt)teeomf iodlp rluvolt) rxo(r3io4am elnet s  Duru ono4tptomoeils mDran o (4tlenmfctytlmDranvi;t)s2xoimpiodlm elnvs s  rraxroot1olxoii3iltlsDumnmpnu0 lenxo3oo1optelu ols texr(m3iy1op n ieil( srumxronu1oeenmfctlsla ranmp t4 ltrxocoadoaD  i o;t) rxo(rpiu1amtelnctltfaruau pno1tpenmietydfa2rmnvo t)tlxomr3ia1la elueolt0 etmxm nu1op nlneiat) rua(monu1texo ieiadfm umump;u0 rerxrciytom elu i s  2xmxo ny4opee iet s)aDrru oot0aee  ocils s2el(vp () etrircia1la  aueils0truoio3io4am elicsltf Drm(r nu0alxn fctytfs uanvp;(4aeermfctotfp r uesls) euoio3io1ap e fvtlt)s2rmxm no0alx  oeild sDrl(mo;t0aetomf tytoaDe ueols0t2xoxr3iy4lmeemfei sfaDumx pot1apx  oetytls uanms;(0tlenmrciadfm eaneol() 2urirpny1ope mfeta(  Durxm ot1apxnif3iltls umn o t0artnxo3iadfat  n s t  2to(o3ou1op  mivsa(f 2umur ou1teeo f3iyd s umnms;u)trxomf3io1lpt  uvi;s)srtoxo3no1llenlncsat) 2umump;t1aee  oetyd s2ran pn(0aeermo3oy1lmtr nvi;( trto(rpiodaleemfvt s) rurumpoo4optnmictyt s ra(mpnt) rxnir tatfatrli s ( tetoxo3no4alenlfvil(fa2raump;o1oexnmocilslm2rln snu0altrmf3tytfpDrln o (0 rumxr ou4ale  fvi ()srtaump;t0oleomictatlaDua( s;u4 rermf iodoa   ues s sexm(o iydomt lfvta(fs2taur ou1tlt mieils s2uau pnu)tltnif3oy1fpDrlu i t  eto(opio4lme lieiat  rrau onu4apt  o3ilsfmDrlnms;(4 rtoxr3iy1om r i s s  2to(opnydlm n ivsl(fsDua(mpno0tlt ioctad m2elnmsn(4trxrxf oytlaDrlieo;(  rtmxopnudlp emicia(f rtm(m ou4opx ioetys mDea( pn()altnmr3oodlmDraieils trtrxr3ny4amt mnes ()a2urxm ;t4optnifetlsla eln s;()trtrxr3oytlatrluvo;s)t2uo(m nu4al emfvs (  rrmur oo1open oeiydfs uanvo;(4 eeoxo iytom rlues;t0trxmio oy1olte fcs sfa2uaxmo;u1opxomfciyslaDuanvsn()aleoiocootlmtrlu sl( s2trimpiodoltelfci s) Drax poo4optniieiys s uanvp;(0tltrif tytlateli o;()srxrir nydap nmnes s sDra(rpnt4oeen o3iadla2eauvon(4aexnxocoadopDeaues;()sexmiopiudlmt  fci tfsDum(r ;o0texn octls mDean p t0trxnir3ty1omDraueo t0 rtmir3iudomt lfet t) Dtr(rp;o4tpenmfciaslsDeaump;(0 rtoxrcta1fmDeau s;t)s2xmim3oo4aptn iei sfs2tau ont0tpx mietytlaDra(vsn(4alxoir tadomDeln o;(0 rxrxopiu1ome mnetas)artmu  ;u0ale  o3tlslaDea( o;u)trtoxf tytlpD  iei t)srxm(o3io4lptnmiviatf Dtmurono0aex mi3tydfs um(monu0altoxf oadomteanvi;(0s2tm(m3iu4oleelneslsf rur(mpot1tltomoetlslm umu s u4arxnmfcoadomte ivs s seum(mpnu1lle lietls)artr( ono4ole if3ild s2rluvo;()arxniocta1op eanesls0texr(r3io4ale lfctls)a2taurooo1apxoii3iadla2el( s;u4tlxrir totopt  neo;s0sexo(r3iy4ame mneiasf 2rm(  nu1tpeniociysfsDumnmsnu4trxnmr3iy1lpDeln o () exoxr3iy1apt  fvs (fartaumooo4apxoii3iatfa2em( onu4aetrircoodfp eaivol(0srxm(r oo4olenmnetas)s2rm(mo;o4tpx mieiasla2umnvp t0tetoir io1latraivol( s2xoxm oudom n fesa(faDrau  ou1oet  oetadfs el(vo;u0tltrif3iotopDr ivs ( texoxr3io4omtnlicils a2tr(mpoo1aexniictydlm ea(vp;(0alenio3todlmtraueo;(0 eum(r3iu1al n nesat  rurx poo4tle mo3iydfaDrl( pnt)arenxf3tadlm eluvslt  2umxmpiy1openmfciatf Durx o;o0tle  ieild m ua( s;t) lenxr3iatoa  aivi () 2xoiopny4ll nmncsls)s2umu  ot4olxomi3iydfa emn s t0teenxociodlpDrlnvil( s2tmxo3ny1lptnlies s) rrru pot4alx ifciysfmDrm(ms;t0aeenmo oodoptran o;( truoir3oudape mfvsat) rraump;u0tpx moetltfsDulnmpn(4 ltoirciadfpDeanei t0s2umimpoydlptnlivi tfarrru o;t4optnmfciydla2ua( o;u)aexoxo oodfpt anvi (0texo(o3ny1lme  fvt (f Duaumo;u1apen oeiadlaDea(vs;(0 renxrcia1omt  nvs t trumxo3ny4aptn iei ()s2uaxro;u4alxomfeiyd aDuau o u4trxomfctydomtrln ol( s2umiopno1lmen fvt t)a2rm( o;o1tetomieils a2ra( o;t4tltnxr3oydla ean o t0t2xoim iy1lme liei (fsDtmurp;u1aetnioeiys aDulu s t0 exoif oodoa r nvs;(0 2uoimpiu1lmenlfci s s2taxmono1opx  f3iad m umums t0areoirciadlmt ln ils  etmxm no1om nlfcia(  rua(mpnt0tlxnmoctytls2ranvo;u0texomocoadfaD anvsls0 2toxo ou4om  mnvtatfa2ua(  nu4oee  f3iydla2umuvp u0 eenxo3iotlm r i o;t0srxo(opou4ap e fesls) rua(r no0aetoii3iytlmDua(vsn() lerir3oatopDeaivs t0setmir3nydal   ivtatfaDrr(mo;o4olxnmfeiytfs2umuvsnu4tetrif iodfpDe i i s0s2urxm iydlmtn fvi (f Drr(mp;t1aexn ociytls2eanmpnt)trtomrciotopD aneo;(0seurxmpiodole livilt)artaum ;u4tpenmoeilsla2ulu pnt0arxnxo3iy1lateaues;( teumim iodolee fvtlsf rurx  ot1tle  i3iasla uau on() leoxocoy1laDeau o ()srtrir3iy1ale lfesat  2taumo;o0aexnif3taslsDrl(vpn()tltnifctotfptelivol( setmxo3oo1ope  nct sfa2tmxront0ole ifciadlsDum(mo;t4arenio3io1oaDeanvi;(0srtmxopnodlmtnmivta()srta(m nt0oetoio3tytls2emnmon(4tltnxr tatlpt lneo s)texr(m3ou1lpe  nvta( arrmx  ;o4tpt  feiysfs rlnms t4tlerxr3tydlmtr uvo;(  rtr(o3oydapt lnvta()s2ua( p;t4tetnmf3tasfm um(vp (4artoxf3iy1fmDeluvi;t)teumir ou1omeemnet ()a2trxr ;o0oex  f3iltls2um( p u4treoirctydlmDeln o;s0sexm(o3oydaltnmnei (  rur(  ot4olt mfeiysfs2rauvp;u4 etrio3tadfaD aieols0t2ur(mpiy4alt mncs s)srtrxmpoo4olto feildlm2rln s (0 rermf3iy1latrln o s)s2um(o iudllenlfvtl()a2rmu p;u4aet iociatlmDrl(mp (0 rtrmf ty1lmte uvi t trtmxm ou1lmtemfvsas a2urur ot1ale mfeiysls rmuvo t0aeermoctytfatr uei ()srtm(m3no1ol nlfei sfa2urxmpou0ale  fetlt m ean pnu4tlxoxo3iydoaDrluvo t  2trxo3iy4ol nmnetas)sDrrxr oo4apx iieiasfa el( s t4arenxocoy1opD  ivsls setoxopny4llt mfci s aDra(r no0aexomo3tatfmDeau p;(0arxomr3iodlm r n o;t0s2uo(o oydll e ietlt)aDtm(r oo4opt mi3tlt m eluvp t) etrmo oo1optelnvol( s2toim3oydamenlivt tf rurx o;t1aee ifetas s2rmuvs t4 etoiociotfatrlu ols) 2uo(o3oodaptnmivsas sruaur ot1tptnmi3iysla2ean s;()aetoiocty1optr nei;t0truoiopnydape  nctl(f Dta(rpnt1oet  feiydlmDeauvpnt) etoircio1fa rliei;( texrir3iu1olenmicilsfs2taur no1oeenmictydfaDra(vo u0 ltoirctodlmDr uvs ( t2trir3iy1opte ictlsf 2rru p;o4optnmoeiasfa rm( p () renmocta1om   uvils teuoxr3nu4op elfetls a2um(  ou1tee  ieiltlsDran s t4artnmf3tatlpt lu ol( s2xoxm3iudlltemivtls)a2ta(r ;t4apx mf3iatfaDranmont)texomoctydfpDr ieils0 rxoimpoudapt livs ()sDtau  ot4apxnmociyd sDem(msnt)treoifcty1lpDean il(0t2umxr3iudllt lnvtat)sDta(rooo4aetnmfetatla2emnms (4teenio3ootop e i o ()teuoim3iu4lltemfctls)aDur(m ;u4aeenmiciadfs2umuvp;u) ltomoctotlpt au s;t0trtmir nu1lm e ietasfaruaxmono4oeto octad a uan o t)tlxoif3ty1oat aiei (0trtoirpnydome  fetat) 2taxronu4alto feiltfm emn s (0 lxoio3iatoptelnvo ( t2tm(m3oudamt livi (f rurur ;t1opxoii3iyt a2rm(vs t0tltrir3to1lmDrau ilt t2uoxrpoodapt  nvt (fsDumum ou0aetn f3iys aDrm(vpn(4trtrxo oodoa eluei s0srum(m iy1om   nvtlt)s2ra(ronu1tlx iiciydfm elnvo t4altrxf3iatfp  lueo ( srxm(o3oudamen nvils)srua(r nu0aptomociad a2elnms;t0 eerif iotfa eau i;( t2ur(r iy1al nlivils  2ta(mp;o0oetn fetyt a ul(vo u4 eeoirctadfpDean s ( seuo(m3iodll nlfet t)srtrur ou4olxo f3ias a2eaump (0teermocoytfpDrli s;() rxrxrpiy1olen nviltf 2taumonu1opx ii3iysfmDulnmonu)artrmf ootomD au slt tetr(r3iodape lfvi () 2uau pno0alxoioeiasfs eaums () lxrxo oo1lateluvo;(  rtoir3oy4ale micsl()srum( ooo0open ociat m2emnmo;t4 ltoxo3oydomDeln o ( setmir no1lm n nvsas a2rm(mo;o4olt mf3tltfa em(ms;u0tetrxf oo1faDe n s;( srxmirpny4apen nvsa()aDtr(rpoo0aet mietys sDelumo;u)arerir oytoaD ai ol(0 rxo(mpou4amen nct (  rrm(moou1tptniieias s umn s u4 rtoxo iodfm rlneilt  2trxmpoydame liet sf rur( oou1olx  oeiytlm2ua(vp () etoif oatomD aivs () etr(m ny4alt  iesl(f 2rrx pot1oet iiciytls2rm(mon(0tltoiocoatoatrlu i;(0 rtmxm3oo1optemfct (fsDtru oot1oetomociltlmDuauvpnt) lxrmo io1oa  ln olt  exoim3nu1ame mfvil(fs2uax pno1ope mi3tyd m rl(vs;t)alxoircootopt liei;s t2umxrpiodal e nctas a2ua(rpnt1tltn i3iysls2ul( pn()treomo3iytfmDeau i;s sexrxo3ou4ame  ncsl() rrmum ou1tptnii3tytfm2rm(vo;()aexrxo oytfptr nvi ()sexmim no4op n fvtlsfa2rrur nt4oeeoioeiydfmDeln p u4 lxrxr io1faDrlivsls0trum(m iudamenmnvils)arrr(r nu1tee mfciaslsDem( ont)alenxo3ootlmte nei ( trto(o ou4ap  mfeias aDtmxmooo1ale ii3iyt a2rmnvo u0trerxociy1opt anvi;t trurxm iy4al nmncias s2rrum nt4apt  fetadlaDuan sn(4trermf3tytoa  livo;t0trur(m oodoleelneias s2tax  nt0aeen ociyd s el( o;u0arerxf3oodomD  uvi t0 rtr(o io1omee fcils) rra(moot4tltoiocilt s2eaums;u0teenxrcty1latrauvolt  2xrio3oydap nmnctls  rtaxm ;u1tlt  i3iyd a umu s;()altnxr ta1lmDe uvi;s0texrxo nydam   ics t) 2umuro;t0tleo f3iydfs rlnmsnt0tetnif oatfptr nvo;s)sruoxo no4oltn ncil(faDrmx p;t1apto feilt aDel( s t0tleoxo totlpteln s t s2urxr nudlpen ncs (faDur( poo4aptniicils a2umu p;t4 lxoxf io1oa r ies;s teumxm nydol e nciat)srtmur oo1teenio3ildlsDrln s t0tltrio oa1op rlu s;() 2xoirpiu1llt mfcia(fsruau  ;u4apxomo3iydfm2em(msnu) ltomf totfpDelues;s) 2xmxr3oo1al  lfvtatfsrurx oot1apeo o3iysls2uanmp ()altnxocootoptrlu il()teuoio3nydapee icslt aDrauront4tpe iocilt s eluvont4alxomo totoa e u o;t)trtrxm3nodllt lici ( arumu ont1tpenioetltfs2rau s t0teerxf tytomt  u o (  exrir3iy1omenliesl()sDua(m ot1aeeo iciyd s ulnvp u4trermf iodlmD aivs;t texo(r iy4ll nmiesl()a2uaur ;t4tetomiciatfaDrm(msnt0alermf tydopt lnei;t0 exmxmpoy4apt liesas)a2rrx  nt4tpxn o3tlslaDrau o;u)altoxfcta1fmDrli s;t) 2xmxmpoydlmt  fvta(fa2um(mp;u4aetoif3tatlm2ua( p;t0 ltnmo oa1fmDr nei;s srum(rpnu1ame lfvsls aDtmuro;o4tpe if3ils a2eanmo;()trermr3oodfm  liei t)t2urxm3oy4olenmfeiat) Dumxrpou1olxnmi3iad m rlu on(4altrif3oy1oaD  uvi;( s2umxo iy4olt liei ( a2um(m ou1aex  oeiydlm2rauvon(0tetnmr3iydopDr i ol( trxoxmpoy1lmt  ncsa()arurx onu0olen ieildls2elu o (4alermfctotfat livs;t) 2xoimpnu4ll n fcsasf rtrx o;u0teen iciasls2el(ms ()artrio tydoaD ln o t trur(m iu1am   ietas)a2uaxmpno0optnmoeiaslsDelu onu4tlxomrcoo1opteaivolt  exm(m nodlmenliesasfarrrur ;t4tpt ii3ils m2umn o;t) ltrxfciadopteaues;t)srurim3oodam emnvsl( a2ua( oot0tptn fciatfm2emuvp u) rermo oadlm   uei;t0sexoio nu1openmicsl()srtaxrpoo0tpx mieiyt m2uanvp;t0aleomfctytoatrai o ( setoxo3io1lmeemicsat) rtaurp;o4aeenmi3tad m uluvsnu0 ltnxo3iodop  ai s (0teur(o oy4opeemneiasf 2uau pnt1tpt moetydfm ean o;(0artoif3oytomte n ols teto(r3ny4lp nlnci () 2rau ooo0oltnii3tatfsDumuvo t4teenir iy1oa   neil(0trtmir3ou4ale lfcs sfaDumxro;u4opeomf3tat s2ulums t0trxrmo3iatomDraueil( t2uoimpiu4open ncils)s2tr(  ;t4alxoiictydls uln snu) exrir3iytla rlnvsls) 2trir ny4omtelfvt (faDrmurpnu1oex  iciydla uan on() eermocoadlmD lues;(0srur(opiy4amen fetls a2ur(rooo4tlxniictysfsDulnmo ()tlxrioctytop e ueil()t2tmxopoy4ap  livtat) Dtmu  ot0texn i3tadfaDrlumpn()tltomfctatfaDeau o;t0 rxoxo3ny4aptnmiet ()sDur(mp;u4alxoif3tasla rauvo t)aeeomo to1omDeanvo;t s2umir3iy4llt  ivilt)sDuaxr nt1oltnif3iat s eaumpn()alxrircoatlp rau s () 2tmim3iu4ame lnvta(f Draum nt0olt  ociat aDemn pnt4areoxoctadoateli o;t trxrimpoy4llen iei (fsDrm(moot1aexniieias s rln onu4teenxocia1opD luei;t) 2tr(r3nudllenmiesa(fa2ra( onu4tet iictlsls rln pnt0aexoxr tadfpD liei s  rtmiopio1lm nlnci t)s2tmump;o0tptnii3iasfsDeauvsnu0artoxrciodlmDe uvs (0srtrxm iodopeelfvt sfartmu o;t1tleoioctatlmDeauvs t0 rtnxr3iytoa rlu o;t tetrim iydlm elnctlsfsrtaxmp;u1alenmoeiyt m elnms;(0tleomfctytoat livo;s tetrxopoodope  neil(fsDtaumo;u0tpxomfciatfs ulnvp u) rxomr iatoaD auvols)s2umxr3io4ap n iesa( aDrru p;u1aeeo feiytlmDemuvs;u0 lermo oytlp eanvsls t2umir3oy1oltnlnvs s s2rru  ;t1aex  feiasfa2umnms u4altnxf3oy1opDeln i s) rxoxr nudap   netl(fa2tmxmp;t1apxniiciltlm2ul(mon(4tltnxr oa1fpDr u i;s srxr(m3oodop eliesls) rrmxrooo0tpx micilslsDelump;t0teenmo3to1oa eaivs s0s2um(m3iodalenlicslt)aruru pou1olxo ieiytlmDulnmp t) leoio3iadfaDr ivilt)teur(mpny1lm  lnviat srrr(ro;t4aetn fetyslm2umump;t) rerxf3iydla eauvi;(0texr(m3oy1ope  nes (  2ua(rp;o4aexn fcilt m em( p t)teenxo iadlpDean i t)teto(opnudoltelnetlsfa2rm(mono4aeenmfeiysla umnmpn(0tetrmo oydfaD liei;s)setoio oy1lm nmfcs ( srurumono1apen ietad m eln o t)aetnxf iydlp rauvo ()s2uoiopoudol elfeiat)s2rmxro;u1oleo octydfa2ua(mp;u) ltnxf iy1omDrln s s0trxmio iydop e fcta(fs2rax pno1oex mieiat sDeauvon(4trtrxr ta1om elu i;t)s2tm(r iy4lmtn ict t)arum( p;u0alxnmoeildlmDrmuvsnu)tlenmoctydfaDe ueils srumxo oo1apt  netlt)sDrm(  ;o0aeeo o3tls s2emuvsnt4arxnio3oatomtr ueol()seuo(mpnu4optelnct (faDtmumoot1alxnmfetat m2ulnvsn()aeenif oodfa r i i;() exrxrpny1ale mfcsl(fsDtmxrp;u1ole ifeiltfa ra(vo;u)tlxrxoctotlate u s;(0seumxopio1ome lici ()aruau pot1tlt ifcias sDelums;() lxrif iotlpt aueo t0s2xoxrpoydomtnmfesls s2rrx o;u1oleo o3tyd mDrmuvpnu0artnxf to1la raies;s  rur(m iu4lptnlietlsfa2um(r ;o4tlt mociyt sDel( p (4 reoxocia1lat  nvi;t t2xrio oudal e ietasfaDta( p;u1oee  f3iydfa2umnmpnu0trenmr3iy1optrln s (0sruoiopnydlpen nctas) Dtm(moou0oex  octlsfa2em( o ()alenxf3oy1oatrlnvil(0 2xmim3nu1al  miesatf Drm(m ou0opx  ocilsfmDrmu pnu4 lxrxf iadomD lnvol( s2tr(opno4lle lnciat  rtruro;u4aetoifeiasfmDem( ont)aexnmo3iydfm rlnvol() etoxmpou4am nlnetl(fa2raumono1opxnmo3iltls uanvp;t)trxomo3iydlp  anvo s0 rxoxopou4ale  nes sfsDtmxm oo4tpe  fetlsls ea(mo u0arxnif iodfptelieol( trtoxopoudol elfet sf 2trx p;u0oltn ictydlm2eau sn()arxnirctytop   n il(  etr(m3oudaptemncsl()artruro;o0apen ictltlmDrluvsnt0arxoircoa1fm  lneols)sexm(m3oy1apt  neia( srururooo4oeeo o3iytla2ua(mp;u4aetrxrcoatlmDranvi;s srtrir3oodolenlfctas)s2tm(rpnt1tpe mieiltls2ran o;(4trtomrctydlatrli o;t s2tmxr3iu1lptnmnctlt  2tmum nu0aetn octldlmDelnmp u4tetoircoadlat livil(0s2xm(m3ny1olee feiltfs2umxro;o0opt  icilt a2ea( s t)tleoxrciadfaDeai ol(0tetoio3nydamt mict t  Drru pno4tleomo3tldfm2ea(von() rermo3tadfp r neslt0trxrir3oo1oleemnvt ( srtrx oot4openiieiatls um( snu0 reomf3io1faDeln o;s)teumim iudomtn fcslsfa2tmx  ot1tpt miciadfa2ra(vo ()aexoif tydlmDean sl()teurxo3oudape  fci (f 2raum ou1optnif3iysfa uauvsn(0tltnirctodoa eanes;t setrxopou4apt lfes t)srur(  ;t4aetoio3iasfmDeluvs t4tetnmf3oatfpDe i i;s seuoimpoy4omtnmfesas)arua(r nt0oetnio3iatlm2ua( ont4 rtoxf3oa1la e nvi t) rxrir3iydlm nmfvsa() Dtm(mpoo0oex  o3ild aDrmuvs t0 exrio3iatfat anesl()sexr(r3nu1lltnmfvslt) Dumxrpno4oexo ictytfa2um(mp (4alxnir iadoat  nesls)t2ur(rpou1am emict () rta(ronu0oexnmieilsls2uaumo;(4 rtnmf3iytlaD au i;s t2tr(opno4apee ivsa(  Drau poo0opx mi3iatla2ulu o;t0tltomfctytfp ean ols0 2triopoydoltemivsat srrau p;t4oltomicils aDrlnvs (4tetomfcty1oat  ivs;( t2tmxm3ou1lpen netat  Durur ou1oexnmi3iasla2ra( p;() rtoxoctodomD  nesl()seum(o iodlltnlfvia( s2ur(mp;u0aleoif3ias sDel(vp;(0aexnir oatfaDrau o s)srtrxopnu4omeemncsatfaDtaxrpou0oetnmfciat a2ua(mp ()aetomo oy1laDelu o s)texrxr3iu4alee ict sf Drr(mooo1oetnmoeiadfs rauvs;t4aeerio3todoat aivi s0trumim nudom nlfvtls arra(rpnt4oltomf3tat s2ra(mo;t4 eerir iatlp rlnvolt) exoxopnu4alt lfes t s2ua(m nu4aetoii3tydfmDeluvs;()arxomocoatlatrluvilt) rxo(mpoo4lp  lfeias) 2rmxmo;o4aet  oetld m umums;t)alxoxo3iotfmtrli ilt  rtrxopoodal  mncs t) 2tmump;u0tptomi3ilsfaDelums (0altnmr oatfpt lieilt)setrxo3iu4am   icil(fsDrau o;o0tee ii3tys aDuauvpnu0 exrmociotlpt lnvi;s srxm(rpiodapt mfvtlsf 2ra(monu1tpto fetytls elumonu0areoir3ootopt liei ()seuoimpnu4amtelicsatf 2umu ont1tetomoeilt aDrl( o;()trxoif3ia1op e i o;( tetrxo ny1opt mfetas) 2rm(mpnt4tltoiociltls2ul( o;u4 rxoxo ta1fmD auei t  exo(o3ou4apenmfci (fa2trxrp;u0tpe mf3iatla emump;t4tlerxr3tydlaD  u o;t)tetmxopny1lp elnvtat) rtaxro;o1apto octls a2rl(mp (0tlxomr3tatfateau o;s  rxrio3no1amenmnetlt)aDua(mp;u1oexo f3ias s elumo;()aetnmf io1lmDelueils0 etr(mpno4ap n feiat) 2tmxrooo0apeomoeils s el(msnt4 exnxo tadlm e i o t)texriopny4opeemiciat)sDtrxm ;o1oexo ocilt mDran o;t0aexoir3oatomDrauvo;t0t2ur(mpiudam nmfei t srrm(m ;t4oexomoeiatfs um(mo;(4arenmrcty1lmD an sls tetrim3ny1ame mics (faDuaur ou1tpxnioctldfmDemnvpnu4 eerxocoadfmDeaueo s seuoxr3iodale mictatf 2rr(rooo1tlxn fctytla umu o () etniocootla  ai o;t setriopiu4apeemnvtas) 2tru  nt1aeenifcilsls rlnvsn(0arenmf3iotfmDrlnvols  exm(r nu1opeelfesat s2raxm ou0tlxnmiciydfa2ea(vpnu)tlxrxr3oo1fp raies;(  ruoim iudlptelivil()sDuau  oo1tpxnmociyt aDrmn s;t0tltniocto1lp r nes;t t2uo(opny4lp nmfeia(fsrrr(rpou1aex moeiltfs2eanvont0aetrio3oo1oa e neslt0t2umxo iy1lm e fctl(fsDtrxrooo1tetn ietyt m2rmuvsnt0 reoir tydfp  luvs;s)s2xo(m3oo4ap  mfesat sDrr(r ;u4oet  iciysfm eanmon()aexrifctotla raues;s) rtoio3nu1aptn nvsa( a2tru ont0apxoiieiadlm rauvo ()arxnxf oadfm e uei (0 2xrir3oodaptn nei ()srtaum oo0opxn ieiatls ul( on()artomr3oydlm   n sl(0sruoxo oo1olt lneias  rur(mo;u4optnifetls s2elnmp;(0areoiocta1fmteln s s  2tmiopoy4lp n ivs s aDra(ro;o1aetnmfciasls2ulu p u4 rerxocoo1omtranvil(  2to(rpiy4lm elnvilt)srtr( p;u4opt mfetyd aDeanmpn(4arxomrciadoa  luvo;s0seuoxr nydomtelieil(fs2rmuro;u0tex moetas s2el( o;u4 eerircoy1la eai s s0trtm(mpio1llt lnct s a2ta(m ot0aexoif3ilt s ea( on(4trtoxf oodfaD  ies t0t2xrxo iy4omte nvs ()sDurum nu1tet iieiysfsDul( o;u0tleoif3oo1lp rli ilt) rxmxmpou1am   nct (faDuaur nt0apx  o3ildfm umump;()aeerxr3oy1faD lies (0s2toxr ny1op e feslt arur(m ;o0olxnii3iatfaDrauvp u)alxoxociodfaDelneols seumir iydomee ictls  Duaxm oo1altnmoctytfmDra(vo;(4altnmr oytlpDrauvi;s  rtmxrpnudop e fvsls s2ua( oot1tet  oeiatfsDumuvpnu4areoxf3iatfpDrlnvi t  2xmxmpoo1lm   fet (  Drrx  ;u0olx mo3tysfmDranvo t0artoxocootop rli o;()s2xmxm nydlpt lnvtl() 2taxrpot0aet  ocilsls rlnvont0alermfcoa1op   n o;t0trum(m3iudol nmiesa()sDuaum nt1oeeoiicilsla emn s;u0trtnxr iydoaDr ivs (  rurir oudale lfci sf rtrxmpou0oex  o3iys a2ul(ms t0artrif oadfptraivs t seur(opiu1ape mnetl(f rtr(  oo4oltn o3iytls emuvp ()alxrif oadoa r neo t srtrir3ny1opt mfvt tf rtm(root0olx mi3iydlsDelu o u0 etrxf3ootoptrlnes s)s2tmio oo1ol n iesl( a2rmx  no4alxo oeias s emnms;u0aeerxr tydlp rlnvs;t  rtmxo3ny1lpte nesl(fs2rmu pou4tlx  ociys m em( pnt)tlenmo oodlat lnvols0sexr(m3io1lmte fct t)srtauronu1texn octltfsDrau on(0trxnio ta1op raies s)t2tm(mpnudoptn ici ()a2raxrono4oltnifciatlmDumnmpn(0artoxo todomDeauei;s s2trxo3nu4lpte iei s)aDuauro;u4alt mo3iaslmDeauvo t)tlxoxr iadlpteluei t)tetmxmpou4lpt mneslt)sDtr( o;t1aeen feildlmDeanmo;u0aexrxfcoadla  ln s ( s2trim iu1lm elnei (fsDum(r ;o4tlxomfeiat sDum( s;u0trtrxo io1oaDraivsl() 2xrxopny4omenlfesl()artmxmoot4opeomo3iadlmDrlums t0 ltrxrciotomtelivol(0 rxr(o io4lleemfesas) Dta(  ;t1opx mociatfm2ea(vp;u4 lxnmo3tytlmDean s ()trtmxo3iydoptnmncia(f Dur( o;o0tle moeiytlaDrl(mo t)trermr3iatfa eauvsl(0trxr(m3no1lpteliesl()aDraum ou1alt mieiad aDuau p;t4teermo3oytomteaueols0trumim oodlpeemfetl(fs2tr(mp;o1opeomfcild s2um( o;u) exrioctodoaDeluesl(0t2umimpnudlpeemfeia(fsrrmxrp;t1texnmf3tad m umn p u)arenmfcoy1om r u o;s0t2xmxmpnu4ole lncs ()a2rrxront0tpe ifetasfmDeanvs;t4aeeoxo3oodfa rlu o;t) eurir3ny1lme livi (f rur(moou0tet mf3tlt s2ul(mpnu4 rermo3tatoat  n s (0 2tm(r3nu1am   ivt sf rtm(ronu4oleomiciad sDra(vs;() rtrmo3oo1lm   nei;t) rurxo3oo1ope mncs t)sDuaxrpnt4olen o3iatfs umums t) lxoif3oatlmt lneilt)srxr(o3oudll  lncta()sDraumpot0tpe  icilsla eauvp (4artrmr3tytlmDran ol()trtr(r io1lp  lfvsl(fsrua(monu1teen oeiltlmDuluvp u0 eeoir3oy1faDeaivil(0teur(o3iu4ape  fesltfsrumx pou0tlxomfeiydfa rl(vpnu0 etoxf3oy1fate ies t teurxmpiy1lp e feiatf Dta( pnu4alt if3ild sDua(mo;u4aexnxfcoa1oaDeaueo s t2umir3oy1apt mnes sf rurxr oo1opxoiieiadla ranvsnu4trermoctadfpD lieilt0 rxr(rpnudomt  ncsa( sDumu pot1altoifeiys m2rl( p;t) lxoir3tytlate nvolt  2umir3oudol elneiasfa2rrumpot4tee  o3ilslaDumnvont4 eerxo oadlpDrlues;s  2xmxo nu1lm nmnetl(fartrur ot0ale ioeiadfs2rmnvs ()aeenmfcootomDranvs s0 rum(o nudapt  fetl(  2umurono4aet micild a rl(vo;u0trtoxf iytfa rlnvi;s srurirpnudlptnmnet ( srrrxr ;o4tpxoif3iatfsDemu p;t4tlxrmrctotoaDrlneilt)srtoim3oydapeemfcslsf 2rrumpou4aex ioetld a ul(ms;(4aleoio3tytopD an sl(  rxoxrpoo4ol nlnvi t) rur(r ;o4tle mo3iys sDeln sn(4trxrircoa1laD lu i t t2xmxr iydam   fcsl()aDuaxmp;o1alx ifciysfa2el(ms;()tltnmo3iadfmDran i;s texr(r3ny4ap elfct tfsDumxront0aexn oeiadlaDel(vpn(4areoxf oadop  anvi;s) 2uo(m oo4aptnlictas) 2rru  ;o0aee miciatls ra(ms t)tetoxrcoodlp  luvs;s)t2trxrpoydlpe lnesat arraxro;o0tpxoii3tyslaDemnvo;(4aexnmrciodoateluvs;t0 eurxr iy4ol e nvi (f 2tau poo0tet  i3tytlm2umump t0tlxrxr3to1lpDr u i;t s2toirpoy4al nliesas)aDuaumo;o4oetnioetadfm elnmo (4 rtnmr3oydlpt lnesls0 2xr(opno1llenlietl() Dur(r no0olxn o3iysfm uan s u)alxnmoctadfmteln s s)seum(m3oydlleeliesl(f Dumxro;o0tleomocildfs emums;t) ltnmf oatoat  neo s) 2umir oy4altn fvsls)srtm( oot4aee iietydlaDrl(von(4 lxoirctotopte n s s0 rtoio3iy4om   ivtas srur(ro;t0tpxniociadlaDemn snu)trerio3io1om ran o;(0 2umxm3oo4lpeemfci s) 2tmu pnu1tetoio3ild aDel(mp;u4trxnmf ia1om  lueo;()srto(o3oudop nlneslt) 2um(rpnu1alxnmietat aDum( o t0 rtrmf3oa1fm elivi;t0trtmim oo1alenmfcs ( artmur oo4opx ifetatlsDeauvs;t) leoxf3oydoaD ai o;( sexm(mpoy1omeelfcta(f 2tmxmo;u4oltoii3iad s ulnmo (4 ltnio todoa  au o s trtrxrpiudlmen ieiltfsrtrumpno0tltnifeiys m uan pnu) reoxf iodopD lnvols srtoxo3oy1llenlfvtatfa2um(  ;o4oeenmf3iadls2ranvp t0 exrxr3ta1lpt ln ol(0trtrxmpiodlp nmicsas)a2uaxroou1openiocias a um(mon()trtrir oo1lmDrauei;t) exr(r3iudaptnmneiltfartau p;o4altniiciydlsDeluvo t4 etoir3io1late i sls teumxo iy1ale lnesasfaDuru  ou1apt  ociatfm2em( snt)texoxo iadoaD luvo;s0truoxm oy1alt mfvta(  Dtm(monu4tex ifciasla2emuvo t4alxnxfctydom eai s;t0trxoirpno4lpt mivt tfa2ururpou4tlxniociysla2emuvp;u4aexomo3tatoa r n i;(0seuo(m nodapenmietlt) 2tmxrp;u0tlto i3iysfm2emu p;()altomf oa1opDrln o s) 2toir iodameemnci s)s2rr(ront0tet iiciadfs rluvo t4teenxr iy1fpDeauvols0trxm(o3oy1op emiesa( sDtr(m ;u1apt miciyd s2el(vo;(4artrir iydoateai slt) rtmio oo4al   nvia(  rrrumooo0olxnmf3ildlm uaumpnt4 exrxf iodomtraiei s0 2uo(o nudlleemfvsasf Drmu pnu4aetnifciad s ua(vsnt) rxomrciotoa  lnei (  2tr(rpiodlpt lncil(fsrua(  ot0aetn fcilt a emu o;() rtoxo totfa   ivi;s0 exm(m oodlp   nes sf rrm( pnu0oet mi3ild sDelu p;u0trenmfctydlpDr nvslt)s2uo(opoydomtnlfesl( a2tmur ot4oee ii3il
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;s0seurio3nu1alenliet ( arurx p;u1olt moeilsfmDem( pnt0alxoxo3ootlp eanvo;t)t2tmxo3nydlme mfcsa( a2tmxm nu1aleomictydfmDra(mpn()teenir ootfaD  ivil(0 etrir io4opt  fet (  rum(mo;t0tpxo octadfm2ranvonu)tltrxr3ty1omD li s ()t2xm(m oo1amt  nvias) rrauro;o0oee iiciysls uanmp (0 ltrxrciy1lmt aueil() 2tmim oo1om e ietlt)srur( pno4tpxo feils mDumuvs t4 lxomf3oytomt  uvol()t2umir oudllenlnvtltfs2ur(mo;t1olenif3ilt aDuaumo () eenxrcia1om  ai ols0 2urxopny4ole mfct s  2uau p;o4opeomo3iyd mDel(mpn()tltnmr3iadlptraivi t0 exr(o nu1ale lict (fsDua(mpnt4aexnmf3iat a2el(ms u)aetoxo3iodomtr neo;()sexo(o nu1aptemfvsasfs2ur(mono1aee  ietasls2rlnvo (4alenxo3iotomtean i;s sexrxrpno1omtemictasfaDrm( pno0alt miciysfa ea(vpnt)aexnxf3oytopDrlnvs s  2xrio no1oltemfet s)a2tru pnt4tee moctlslmDeln snu0altrio iotom eauvolt  exriopoydope mneta()s2rrumooo4tetoiociasfs el(von(4artoxocoo1opDelnvo;s0 ruo(rpnu1omtn ivsa()s2rru  ;o4opxo o3ilt sDeanvo t4teeoio iadoateluvi s  rtoxm3iy1lm   fvtls)s2trum ;u0texn ieilsfa umu s u4aetrmf3iy1omD li olt)tetr(m3io1omtnlfctl( sDtru oot4oeenifeiys s umn sn(0aexrxf oodomD aneo t) rxo(o3oudole mfcsas sDrrxronu4ale  ociad mDeauvs;() rtoxo3iodop r iei t s2xmir nu1opeemfeil( artr(ronu1oltoif3iad a emumon(0 exnxr3iodoate neol(0t2xr(rpno1ol   fci t)arrax ono1tpxn i3ias s ua(vp (4tetomrcoytlm rlueo t) exoxr3ou1ameemnci sfarurxrono1olx mi3iytfa rlnvpnt4 eeoifcty1lpDeaivi ()srtm(opnodame  ici t  Dtrxmpno0oexomi3ilt a ea( pn(0altnxo3tatopDr uvs (0s2xo(m3oydam  miei sf Duru  ;u0altnioetat s ul(vs;t4areomf iatfa   ivs;s0texr(rpiu1lmtnlfvilsfa2rmx  ;u1apeomfciysla2rl(vp u4 lerxf3tydfmtrlu i;s trtmirpny4lmeelictls) Durxrp;t1aexnio3ils s2ea( s u)trtnmf3oa1lp  anvols0 2ur(rpio1amt mietas aDta(ronu1open ictls mDuanvs;t4alerxf3iytoat ln i;s0sexoxm nodalenmnci sfartaxr ;t0ale  f3ildlm rmnms ()teeoio iatom rlieo ()srxmxr3iu1ap  mfes s sDtau ooo0ale if3ilt m2rluvo;u) etnmr oa1omDeanes (0 rxmxmpou4apeelnetl(  Duau p;o4tlxn fciydla2ulu s () lenmf tatlmDrlu o;(0trur(r3iy4lmtemnviat srraxmoot4alxn o3ildlsDuan onu0 ltrio iydfptrai s t)seuo(opou1alen ncilt  2urump;u1aetomictytls2em( pnu)texnio3ty1lm  ai s ()texmxmpny1oltemnvtlt sDua(roou0optn f3tydfm um(vs;t) rtnio3oo1opD lueo;s) eum(rpnydop elietat  2uru oot4alen o3iad s2rm( snu4 exrircoydlpD  ivo;t) rtoimpnu4lm  mfvta(faDum( o;o4oee mfeilt aDrlumpn()tltoio3tatfmD au olt trumim oudom   nviat)srtm(mono1oeenmoeiydlm2emnvon(4artoio3oytlmtr nei;t0 rum(opou4opt lfes s srtmxr ou1olen i3ildfsDrl(mp;u)teenmfctadopDelivo (  etrxr iu4lleelfvtasf Dum(ront0alt if3iydla2ranmp t4 rtomociatlptrluei;s0t2toxmpiudaptnmicta()aDtru  oo0apxnii3tlsla rl(vpn(0alxrmrctatlp rauei;(  etm(opny1op  mfviat)aDumxmp;o0tpxnii3tadfs rmuvpnu0 rxrxociodlate ivi;s0truo(r ny1op  livta() rtru  no0alenmfctat m2elnvp;u)tltomr3to1lmtrlnvs s0truo(r oy4ol emfvta()aruau ono4ole  fetadfm2ea( s u4 exrmf3iadoaDrau o;t  rtoio iy4om   netl(fa2ra(mpnu1oeeo o3iadls emnvs (0altnmfcoy1fpte i i;t srtoim3oodom emics (fsDrr(m ;o4alx  o3ildls uan sn()aexnxf iydlpDr u ilt srurir oudopt mivs sfs2uau ono0alxnmoctls sDulnmo u)trxoirciadlmDrluvi (  2umirpno4alt mfvi t  Dta( o;o0aexnmfciad aDuanvo t0tetrio iadfate ueo;t0srxrxrpio4openlict t) rrm( ono0opx moetld a ua( p;t0arxrmfcoydlmteauvilt0t2urir iy4omtemfvs s aDtaxr ;t1apxoifeiatfmDrlu pnu0altoifctodlm  luei t0 2uo(o iu4olt  ncias)sDrrx  oo0tltoioetyt s rl(vp () rxoxf oy1optr nvs;(0s2tm(r3oy4lpenliesas)sDtrxm no4aetnmiciltlaDumump;(4aexnxo3todfp eluvs ( srurir no4omtemnct (fa2trxmpnt4teenii3iasfs2ra(ms;u4alxnxf3io1omDrlneo s)trtriopoo4olee ici t srua(rp;t1ale  fciadfsDea( o;u)trxrif oydlmD  ueslt  exrimpoydoltnlncilsfsDurxmont1aeeo ictltla2el( on(4tlenif oadom  ln i;s setr(o3io1amtelfci ()aDrr( oot4tetn oeiytlmDelnvs;t) eenif3to1oa   nei;t  rumxrpnu1om elfcslsf rtaumooo1openmoeildlaDea(ms;t)tetoxf oytlmteai s;s  2tm(r3iy4lmtelfeils)srrmumpno0oexoii3tyd m2rlnmp u)areoio3ia1la  livi;(0srto(r3ny4ol nlfcs t)sDuaxroou0aeen i3iytfa umnmsn(4 lenmf3iatlaDe uvs;( t2tm(m3io1omtnlnvs ( s2rm(mp;o0aeeo feild mDra(mo (4trtoiocty1lmtr nvils trtmio io1olenmivs () 2uaxro;u4aexoio3iadfs2umnvpnt4tltrif tatomt lnei s0s2um(o oo4al e iesatfs2trum ;o0opxnioeiltfm em(ms;()artomfctytfptr uvs;() eurxr iy4lme lfvtatf Duau poo4aptnifcilsfa2emn onu0 lerxf oatlmDrlnes t0teum(m iodlmenmiesa()a2ur(m ;u1openif3tytfm rmu s;t) renio oadfa eauvs (0 eumirpoo1ol emivs tfs2tm(ront1apeomfctyt mDem(mp;u)arxrmr tatlpt  iei t) rxo(o oo1ape mfeiltfsrurxrpoo0tle iieilsfa2eluvp (0artoir iy1opteanes;t0trxr(o oy1omt  fesls a2ur( p;o0teeo ociytlm2ran p;t0aetrirctadlmteau i t) 2tr(o nudoptnmncsa()sDrmxr ;o0apeoii3iytfaDemnmp;() rerifctadfpD lnvs;s0srtrirpiy1lmtelnetas)artrxronu1apxnmo3iad a2umnvp;(4treriocto1lm ran sls)t2to(r3iudom   ict s aDrrxm nu0oetn o3tldlaDemumpnu0alxnir3tydomteaivols)s2uoxr3iy4omtnmnetat)aDtrxr nu4oeenmieilsfa eauvsn(4trtrxoctotla ranvi;t0t2xrir3oy4lleelfcil() rurx  nu0oeeomi3tlt m2umnmpnu0arenmr3tydomt li s s trxoirpnu1amtemnet tfaruaxmo;u4tee  i3ildfmDumnvs (4 eermrctadfm eaivi ( t2trirpoodlptemiet t)aDuaur oo0apt  oeiys aDranmsn()trtrmf tytomteli ols)seum(rpnu1amen ivilsf rrax pnt0apxomf3ild a elump u4treomr3iatlmt  ieils)s2uoir3nodale  fct t sDrrump;o1tlxn iciatls elnmsnt)altnxrcoatop   ivol()tetoimpny1oltemfcsat) rua(moot1apxnmo3iyd m rluvs;t0tltoxrciotopte ivs;t)s2xmxmpoy1omenlfcslt) rtr(mpoo4oeeomo3iasla2eau pnu4aeerifctotlaD auvo;()t2tr(rpnydll  lfesatfaDurx o;o1tpt ioetatlaDuln s;t4 exrmr3oy1laDeauvi t0 2xriopoo4op nlnvils a2ur(root0aeen feiys s ra(mo t)aetrxfcoydopt luvsls0t2trim3oo4opte fvsls s2tr( o;t1aetnmfciydlmDuln s;u0tlxnxo tydop eluvo (  rxm(opoo4lptnlnvs sf Dtr( p;o0teeoif3iltfm2elnvp;(4 rtoxo iy1fa rlues;s t2to(m ou1om nlfetat  2tau ooo0olx iiciys mDranmo;(4alxrxo iatlpDean o;( sexoim3iy1altelietatfa2ur(rpnu1alen fcildlm2el( o;t) rtnio to1la  lnvsl()srxoxrpoy4apenmncias) 2ta(m ;t4texnmiciysla eaumpn()tltomr3oatlmDr neolt0 etoio3io1oltemfcta(  rurxrpou1apt iietasfa2rmu s;()texomrciatoptelu o s0 2tmxr3nodal emfetl()a2um( ooo0teeoii3iat s2umuvs;t) eerxf oytom raieo s) 2trir3ou1altelies s  Dumxm ;o4tetn oeiatfm el( s u4alenxrcootop raieo;t)t2trxr ny4opeelnvslt)s2tr(rpnu0teenmictlsfs eauvpn(4aexoxf3iydlmDr iesls t2uoxopiu1amtn nvilt) Dumum ou0optoiiciatla ean onu4tlxnxfcoo1la  au o s)setoxopno4open fei (f 2tr(m nu1tetnio3iad a el( p;u4 rerxo iadlm e nvs s0t2xoir3ny4ole mfvs sf rum(m oo1oeto ietlt aDrmnms;u0aexoir iatlmtrlnvo t)srumxo iu4lm e fetas)a2um(mpou0aleniiciytfmDuauvs t0trerxfcta1lp rln ilt) exr(mpio1am   fct t)a2trum ot1tlxo fciys m2ea(vp t4 eenxrctodom   ieo s  2urir iu4lle  ivs ()sDumxmp;u0tpenifciysfa raumsnt)alerxf3tadom rauvil() etmio3oudam n nci (fa2ua(mooo4alx  icilt m em(vo;u)trxnmf3oodoat ln s;(0s2xrir ny4llen fviltfaDta( pot4tltomf3tlslm2uln o;()arxnmr3oytop  aieo t0seuo(o3no4ap  livsltfsrtau ooo0opt mo3iys m2rmn snu)alxrif tadlmt  ivi;t seuo(m3nodop  lnvt sf rumx ont1apx  f3iydfaDrlump;(0aeenmrctytom elivs;(  2xm(o oy4amtn nciasfarrrx  nu0oet ifciatfs2umump t4 rxrmfcta1fmt ln ilt  2xrim3iydole mfetls) Dtmxmpoo0tle ii3iadlm2rm(mo t) lenioctotfm rai i t0texr(opno1ameelict tfsDtau p;u1tpx  i3iydlsDul(mpnu4aeerifcto1oa ranvsls  rumim3iy4ol nlietasf Drm(mpnu1olxn ietlsla2umu s;u0 etnmf3iotoate neil()s2uoxo3iy1apenliesas)artrxroot0opxnmo3taslsDranvsnu0tlxnxf oadlmtrluvi (0 exrio nu4lpenlfei (farua(  nt0apt  o3iyt sDrl( p u4tltnxo3ty1fp elies s0 2uoxm3nudap nmnvslt) rum(rpot4alenio3tatfsDemnvon(0tlerio ty1fpD lneo ()s2tr(r iy1omt lfvtlsfarta(m ;u1opt  fctydfa2uanmo t0aetrxo oytfptr ues ( s2umiopou1omenlfeslt sDra(m nt1tet  octat s elump;t4artnmfciotlmDeai i;t0setr(r3ny1llt  nctls)sruaumpnt4tex mocilslsDrm(ms;u4 eenir oadop rlueslt) rxrxopiodomeelnesl()a2tmur ;o4tle moetltfmDemu s t4 ltoxfcoadlatr ivol() rtmimpoodll emict (  rumur ou0ope ioctld a el(vp t0 reoxr tatomDr nvi;s trtrxm3ou4ole  fesas)aDumxr oo4oexo f3ilslaDuanms;()trerio3iy1opD anvs;s trxrxo3iu1altelivtltfsrumu oot4optnioeiytlm2el(vs;t)alenmrcta1lptr uvs;s  2xmim ou4llte icta() Drru  ;t4oexnifctadfs emuvp;()tlerifcoatlp  aueols0t2tmxopnydal elictls aDurump;o4tpen iciyt a2rlnvont) etoircoatomDeluvsl()sexm(r oudlmeelfetltfaDur( ont1apeoii3tlt aDulu snu4 exoxfctytlaD anvi s)s2xmiopoydlp   neia() 2tm( pot4ope ifcild sDuluvo;u0 rtnxo tydoa e u s ( sexrxm oy4llt licia(  rtmu o;t4oee  ocild m ranvpnu0 reomr3iy1fmD an ils srto(mpnudaltnmfesa( sDtmu  oo1ope iociadfm rmu pnu)tltoxociodop r neil() exrimpoudame lfvias s2truronu4aetnmf3iys a um( p;t)alerifctodfmt  nvo ()s2umxopnudlpt lieiat)a2trur nu4aeenii3ild aDrau o t)alxrmo3oa1fmt lues ()teuoio3no4optnmieiltf 2tr(r no1aeto ieiatfm rauvp;t)areoif3oo1omtran s;t)t2xmxo3nu4lp nlfcsls  2ra(r ou4tltomociatla2rmums;u0artrmf3iotfa r u ol()t2xrxopnu4om emiei (  rtmu oou4texn ictys s2eluvsn(0alxnxfciydopD ln o;() rxmxm ny4apeelfetat  Dumx pnt1tpx  f3iasfa2uln s t) ltrxoctodfp eanes;(  2uoiopnu4olt lfetlt srtaumpot0opto ieiadfm2ean o u)tlerio3iydomDrlnes (  2xrio nu4op  lnciasf 2rmu o;o4aeeo fciasls uanmpn(0 lxomf3iy1la rluei;(0t2xmxm io1ll nmicsat)aDtmumonu1altnmfciltls eauvsnu) exoxr iodopt lnes;t)trum(o iy4op nlictls  Dtmumpot1oeenmfeildfa2umn snu0 renmf3ootla   ieol(  2ur(m oodll emfvil()s2tax oot4alxo ieiat sDrlnvo;()trenmf iadopD auvs s)setr(mpnu4om e fetltf Drrurpoo1olt mocildls ulnmp u4tlerircoy1fmt  ivol( srtrim io4lle  feslt a2umu p;t1altnmicild mDrln o (0tltomr iotlaD  ies s s2toir ou1al nmietat sDraxmpou0tlenii3ilsla ua( s t0alxriocoytfpte nvs ()srur(o nu1al  lieias s2um(r ;u0teeniictytlm emuvont0trxrmr oydlmt  n o;s s2xmio3iu4lltn fetat)aDurxr ;o0oeenmf3iatlaDel(vsnu)alenmo3ia1oa rlueo;s trur(rpoodale mnvt ()s2tm(rpoo4olt mfctlsfaDrmu s;t4altriociytlmtraueo ()seurio no4ape lfei s)aDrmump;o1aex mfeiadfm eau o ()aeenir3to1lp  lu o (  2xo(rpou1ap  mnvilt  rrrxm nu0ape if3iadfs rm( s;t0artoxr iotfa  aueolt0teumir ou4ol  lnet ( s2tr(rpou1aetn f3tydfaDemumo t)aetnir iy1fmteln s;t0t2xrimpio1lme mfvi t) Dumu  no1tex iociydfaDulnmsn()trenmf tadopteli olt trtoim3ny4lleemnei () 2um( o;u0opto fetat m rmn onu0aeenxo3iytlm e uesls)trto(mpny1lm nmfciat aDrmxrpno4oetnmoetls a ua( ont)alxnxfciatlaDe nesls trxmiopny1alenmnetl( a2ur(mp;t4oexnmictatlm ean s ()alenxo3oadoa   nvols s2uo(o oy1ome lics ()sDrru oou1opxomieiytfm uauvp;u4 eeomr3iodlmtrluvslt srtoxm no1am  livtat srua(  ;t0tlx moetys s2ra( pnu0artomr3oytfmte ivils0texrir3oo1lpenmneslt aDrrxroot1oltomoetadfaDemu o u)aetomociotlm ran s t)teuoxmpoo4omenlnvsas)a2umuront4tle  oeildfs2rlnmsnt)trxnxf ia1faDeln i;s0texrxopnydaptnmicils)a2rm(m ;u1oleniociytfm2uluvsnu0teermrciy1optrli s;t0t2um(m nu4omenmnvi (fsrtrum oo4opt ifciyd m2ulnms;u0 etrif iodfat aivi s)teur(m3no4ap e ivslt)arurur no4oetnmf3iytlsDra(vo;u4aeerio tatomte i i;s trxoxm iudap nlnesas)a2rrumo;t0apx mi3tltfaDrau p t0tlenio iotoa e uvols)s2xm(opnodom  lietatf Dua(mo;o1opxo ieiad m ulu pn() rxoir totlpD  i o;s  2xr(mpoy1lp   ieiltf Drrxrpot4tex  i3iltlmDrmu pnt4tlxrxf io1laDeai o ()tetoxm3nudlpte icsls  Dra( ono0aet ifetyslsDumuvp t4aexrxr3io1fa e ivo t t2xmxo3io1ll  micilt aDrrxmonu4tptnmf3iyslm2ra( o;t4texoxr3ootoa  lnvi t) rxmir3oo4lltnlnvi ( arur(  ot0aptomfetldlsDuluvs t4 renif3iatlat lueil()srur(rpny4lpe miet tfs2ua(  ou1tee ioctat a2ua(msnu0trtoirctytfatr neslt) exm(opio4ol  mfvsl( sDtmumoot4oeeo ictyd sDua(vsnu) eerxocootfaDe nes;s) exmxopou4om elfciasf rraur ot4teeoifeiytla em(vont0 etoxo tatfm e ivs () 2trxo3iu1ape lfcta(f ruau pou0tetnmfetysls ua(mo u)tltnxrciytfaDe uvil(0teum(rpny4llen iet s) 2umu  no4ape mieild s rmnmpnt)texoxr oadlptr u o;s0trtmim3io4al nmfcsat  rua(mooo0aee mi3iatfa rmnms ()teermociodfp elnei t0trtoxm3nu4alt  ict ()s2trx pot4apxoiietatfm elnms ()aleoxf io1fpt livil( setrir no1ame licias a2rr( pou0tpenio3iasfa2emnvonu4texrxo3tatlmDe iesls)t2toir iodap nmiesat) rrrxro;o4oex  oetys sDul( p u4 eeoxo3iytlm rlnvs (0texr(o3iodll elieilsfs2taumpou0teenioctlslsDuauvp u)trtnmrciydlat  i s t) 2tmirpiydopenmivt t  rtmxrpot1apt ioeiysfa2emuvo (4tlxnmr3iadomt  uvo s)texr(o nu4lmtnmneiatf rtru onu0oex ii3ilt m rmn o;t)alxrmfcty1lp  au i;t t2tmxmpoudlltemfetl( aDrrxmont0aptn ieias s rmnmo;()tetrio iotlmD an s s sexmim ou4amtn ies s  rtauront0olt mietadlsDuau s ()aetrmr3oatfp  lnvs;(0t2trir3ou4omtelieia(  Dtmxr ;o4aptoiieiydfs umuvp;u4teeomocootlatelivsls0 eurio3oydlptelnvi ( srurxr nu1alenif3iltfm2rl(mo;t)aetoxf3tydomte ieolt) exr(o oy4ll emfet (  rua( p;t0oltnifciltfs emn snt) etnif3ta1opD  nvs (  2xmxo iodope lnci () Durxmpou4alx  icilt a umuvon()tetomf3oa1lmtrlnei s) rurxo3iodoltelivt t  Drrumo;u1altnio3iatlm2uluvo;(0alerio oatomtranvs s)setmir oydlmeelici s) 2raumo;t0optnioctldfs elnvs;u4 leomoctytomD li ilt)t2xrxm io4lpe  ieilt)arurxr ;u1aetnmo3iyd aDrlu s;t4 lxrmf3ty1la r nvs () etm(o oydlp nmivtatfsruaurpno1tle  f3tytfs ulnms;() eeoir3oodfp   n il(0sruoxo oydal emfeil()srum( pot4altomfetltls2ra( p t4 rerxo3oydopDrln s;t0s2umxm3oodal nmneiat srrr(r nu0oetoiietadfaDra(ms t) rtnmo iydom eliei ( srxoir3oo4am   ivta( srra(r no0olxoif3ils s ea(mo u0texomo tytlp rai i t setmim3iodapte fvs (  2rm(mpnu0tee iocildls rlnmonu)trtoifctadfm  lneo;()srxmim3iu4omt lietls  Dua(  ot1tpenmictyslm2ra(vo (4trxnmr3iydop e u i;t)srum(r iu4lltn neslt)sDta(mpou0oleo oetasfa el(vsnu4 lxnxf totfp eaivs;s)srxmimpoy1olenlnvilt)srum(r ot1opeo fctls m rl(mp;t4 ltrxo3oatlp r i i s)trumxo io1oleelnctlt  Dum(mpnu4aetnmieiyd m2ulnvsn(0artrxr ootfaDe ivs;t)truoim io1ape mnvsls)srra(rpoo0apenifciasfm emnmsnt0tlxoiociadopteln o s0trxmxopoo1omee nvilt)a2ta(mpou4tltnifeiasfaDrmnvpnu0 ltnmo3iodfmD  nvi;s  rumxr3no1optnmivslt) Draxm nu4aptn feiytlaDelnmpnu4tlxoiocoodfp ranvols0s2tmio3no1omtemicsat sDtrum ou4tlxomoctlt aDemumon()tetrif3oodlmteanvils0teuo(mpio4llee fvia() 2ua(m ;t4tpx mfetadfm2um(monu0trtoio io1lm rlueo;( trtr(opnodlpenmiciat)arumu  ;t0tet mf3ilt m2rmu o;u)tleoxf3ootfmD lnvo s  eur(mpny1oltnmnvsl()sDrrump;t0alxn iciat a ea(von()arxrxr3oy1lmte ueo;(0trxrxm oydamtn ici (f 2umu poo0alxomociysla2uan p (0tlxrio3tydop e u s s) exoxm nodlm emneil(fartm(r ;u0tle iociysfm elu p;t4 exnxrciodomteauvo (0teto(o3oodlmtelfetas  Dta(rpot1oleomoeiadlsDel(vs u4 eenif3tatoaD  ueo;s  eur(o nudamt lfvtas srua(  no4olen f3iysfaDemnmp u4trxrmo iotfm eaueslt)texoirpno4ol emfesat  rumurpot1tee ifetasfs rmnms (0 exrxo3todomt  nvi s0 2tmxo3oydameemnci () 2rru  no4aex io3tatfa rln pn() exrirciodlptrlnes;s srtmxr oy4ap e fesat)s2uaxmoou4opt mi3tltfm rm( p;u) lerir3oatlpDe i o t0 2uo(r3ou4am n fvilt)arumxmpou4tpx mociatfsDra(mpnu)trtnmr3oytom rlueo t trtr(opiu4ape licil() 2umxr no0tlx  ieiat a ran s t0teenmocoadlaD  iesl( tetm(o3iudllteliet ()s2urxrpot0oee mi3iltla rmu pnu0alerio3ta1om ran o ()trtmiopoodamt  fesa()aDtmxronu0oltn octydlmDua(mo;()aleomf3ia1lmDe uvi;(0 etoimpio1apte fvtlt  Drax pot1tltn i3iyt mDuaums;t4alenxf tydom e ieo;()t2xoxm3io1lmt  nvil(f 2rm(m nu4oleniietadfs2elu s;t)aexoxfciydla ean o;(  2uo(m oydlm emfciat  Drrxmo;o1tpe ioctys sDua(mp (4 renio oatom   nvi;( s2tmxr nu1omt mncsat  Drrxm nu0oleoioeiltls emnmp (4tetrmrciy1oaD lnvo;s seur(opnudlptnmnci tfa2ur(mpoo1alx  fetydfsDran s (0alxrxf3ia1fa rlivsls  rxmxm nydlmtelicslt  2tmu poo4oltnmi3iadlm2ranvpnu0arerirciytoaDelnei (0 rxmir3io1lme lnesat srrmumo;o4oleoifctyd a2uluvo;u4aeenxf3iytoa ran s;t0teumir3iy4om elneias  rrru ooo4tlx mfctys a rln p;t4 ltnmr totom rlu i s0srxrxr iydapee nvt s srrrxm ot1apt ifeiyd sDulnvo u) etoioctadlp raivo ( s2xm(m3nu4lm e ncils) 2um(r ou1tpt  fciydfsDuln p () eenifcoodfpD lies t0sexoxo3ou4opeemfvsatf 2urxr ot4apxo fetld mDrmumo;(0tlerirctytlmte nvs;t0srtm(o3iu1lp  lfeils  2tmumo;o4tpxomf3ildfs raumo;u)tltrif3tydfpt  nei;(0srxoxm no1lmte ncta(faDtaumo;t4aet iocildfsDem( pnu4alenio iadop elnes t0tetr(r oo4lleemnvs sfs2rau  nu0opxomiciad s uau snu4treoxfciotoate n s ()srxr(m3oy4amen nesls) rrr(  ot1tpeomfciyd a umnmo;t4tltrio tytfaDr neo;t s2um(o3iodap  lieia()s2rmx onu0tex moeiadla2um(mpnt) rtrio oodfaD lu i;s) exrim ou1altemicia( sDur( onu4oetoifetldfm eanvo;u4 exrmrcta1omDeanes s)srxr(r iu1optnmneiasf 2rrum no4aleo f3ilslm2rl(mon(4tetrmo oatfa eli o;()tetoimpoydlltelfci tfsrtru o;t0tptomociasls rln p t)trtomfcoydfm   n i (0t2tr(r3no1lleemnvia()s2rax onu0aex ifctytlsDuanmp t)aleomf3oydlp  lieo t) 2uo(m oudlpte ietatfaruaxroou0oeenii3tld s ranmp t0 ltoxf oydlaDrln o;(0seur(opiudlm elfcs s srrmu p;t4alen o3iys mDuauvp (4tlxoxr3to1oaD  nei;()trtoimpoudlmtn ivt tfs2uaumo;u1ape iictadlmDea( p t)tltrmrcoa1oatraivs;s0srtrxopiudamee iet tfsrurxrpou0aexomietydls2rm(mo;(0 rxrio oydlpD ln s s0s2toxo3nydale  nei s) 2ra(rooo1alto ieiatfaDeau o;u0tetnmo3oa1op  li slt  etmxmpou1omtemivsatf 2rmur ;t0tle  oetad mDuau p (4 leomf3iotop rlues t)sruoir iodll e iviatfs2uax  ;u4apx  f3iyt a2em(mp;t)altrmrcoa1om   ieol() rurxo ou4om  lnvtl() 2urumoou4tptomf3tad aDrmn s;u0 rtoio3io1om  luei;(0 2um(m iu1ome lnvs t arrr(ro;o4alt mf3iysla2eanvon(0arxnir oo1op eanvi;s) exoxrpnu4lmtelfcsat)srumum ;u1aet mfeilt aDeau o u)trtomrcio1fm  lueo;(  etrio iudol  lfciat) rrm(m no1oet  f3tydls2eaums;u4arxoir3iatfa e u slt) 2xr(r nu4lp  mfeiasf Drm( oou1tlenmo3iltla2umn p;u)artrif3io1oa   ivol(0truoim iydapen nvta( arrmxmpno4oleomi3tytls elnvp;()altrxf oytom  anes (  2toimpno1ope  fctltfsrumxrpnt1texnmoeiysfm rlums t4 lxnxfcoytoaD luvolt0 ruoiopiu4ome lfviatfarta( pnt0oexnmo3tadfsDel(ms;t) exnmociotlmDeaneolt)trtmim3io4ol nlnetl( aDurumpou0aet  f3tlslaDeln pnu4tetnio3totfmtr neo ( trumxm ny4ol  mfeia( s2tm( pou0tet iocild sDelu sn(4 lenxfcta1fa   nvi;(  2trxo oo1ap   fei sfsDraurpoo1tlxnioctltlm2eau s;t0teerxr3oa1opDe nvs s trxrirpnu4lp   iei ( aDum(mpnt1ope  feiad m2rl(mp;(4alxniociatopDeanes ()srto(r nodap n nesat srumump;u4aeenmo3iatlm2ean pnt4altomo3to1fmDeau ol( t2xrir iy4optnmneslt) 2ua(ro;t0apeoifeiasfsDul(vs;(4 exnmo3oy1omt  i i;( setr(mpou1oltelivi t)aDtmurpno1aetoioeiatfs2rau p t)artrircoadopt au i s0trtm(opnu4om e fvtls sDrrx pno4tpenioetltfa2emuvp;(0tlermf ty1oaD aueol()sexrio3ou4apen nvs tf 2trx  oo1apxnmictysls em(ms u) exoxfcootlpD aivols)t2umio io1olt livs t aDrrumpou0oeeoifciyslmDrm(vp ()artomrcoatomtrlu i (0trumxo iydlptn nctlt)sDtmurpnu1olxnmociys s2ra(mpn() lermo iatoa elnes s)trtoio3iodomte ietat  rrrxmo;u0tex ifctatlm eanmp t0tlxnmo3oydoatr u il(0 rxoxmpiu4lptnlics sf ruaxmooo1tptn f3iad a ulnms;u) eeoifctatlp   i o;(  exo(m3nu4am   nci (fsDum(  ou0aleoio3iyt a ua( p u0 ltrmf3to1lat  ueo t  exo(r3iy1amenmieiat) Drrxm ;o4oltnmieiys s2umnms;t) ltnxfcoo1omteauvs;s t2xoiopiodom   nvtat a2ra(mpoo4apt iieiyd m rm(vsnt0tltrmf totoat lnvi;t  euoir no1ap  micsas)s2umumo;o0tpe  oeildls2rmn snt4teenxocoy1fmDe ues;(  2xrio iu4lpeelnci () Dtaumoot0oleo ieiat a ua(msnu)trxomr iydfmDraneilt0sexmio3nudol  lfvtasf rtr(  nt1oeeomi3iyslmDelnvo;t0trtomrcia1lp eluei ( srxm(opiodamen nvia(faDrr(root4tlto i3iytfs ra( p t0arxrxfciydop eaueo ()s2uoxr3nu1am   nes () rtmxmpnt4ole mociasfa umumo;(0 etnirctodlatr uesl( tetr(o iydoptn neias  2tm(rooo1opeomfctyd aDrln snu)tetrio3oytlmte nei;()setr(m3ny4llee fetatf rrmu ono0oltoifeiasls uanmpnu0 rxnifctotfm rlu o;t  2uo(opiu1lpenlnet s  Duaxm no1oet ioeiaslm2ul( o;u0arxnircty1fmD  uvi () rtmio io4lp nmfvsa(fsDtm(m ;o1altnifciydlm rluvs;t0arenir3tydlmDr ieol(0tetoimpnu1lpt  ivtasfsDtmxmonu4ope  f3iaslmDum(msn(0 rxoxf3tadlate uvi ()s2umir3nu4am emncs () 2urx  ;o4optoioeiadla2uan sn()alxomrctotlp ran i;t) eur(rpoo1omtnlfvsas artmxmo;u0oeenmoetlslm uaums;u0aeerxr3ia1fa elieo;t setmir3oo4opee fesl(fartrxr ;t4ope mf3iyd m ra( sn(0aeenxrctytoatrluei s trxm(o3oydom nlici s a2ururo;t4opxomi3ildfsDuan snu0 eenmf ty1laDrlueo;t srxoir io4ame lfetl(  Duaxmonu4teeo fcilt mDrlumo u0 rtomo3iotlmte ivo;s) rtrxmpoudlp nlneil() rta( oou0ale if3tadlm elumont4 etrxo3ootoaDeanvs;t srtmio iydamee ietltf rrm(  nt0opx  oeiydlmDelumo u4tlxoif3iatopDeaueo s0seur(r nu1om  mfcs ( artm(moou4alxnif3tlt m2eau s;t0 ltomf3ta1la e n sls setrirpiy4ap nmnet ( s2rrx  ot0ope  icilsla2uau s u)texnif3oadoptraueo;t s2uo(r io4opee nes sfsrururpno0aexn fcils m eauvo t0arxrmr iy1lat aneo;()teuoio ny1oltn nesat a2rmuro;u4optn octlt m2rmumpnu0 eenmr3oytfmtr nes () rumio oo4ap n ivs t  Dumurp;u4alenmi3tysfa rmumo (0treoxo3tydom  liei s0 rxoxr iu4om e netl( arum(m ot1oeenmfeilslm rluvp;t0 etnxr tytfpDrluvilt0teurxo iy4aleemicsat) 2urumpnu4tle iictytfsDel( o;u) rtrxo3iodlatelivols  2xrio3ou4lmenmfei s s2tmxro;u4ape mocias a2rlu p t4 rermfcto1oaD aneolt0trum(m ny1llee fcsls  2um(  ;u1tpxnmociydfs el(vp u0 rxoxo tatoaD lueol(0 etrxr3oy1ol n ieilsf Durxmp;o1teeoii3ildls2uanvpnt) renif ty1opD  u s;s0 2toio3iodlptnmfetlt) rrax pnu4ale iietasfs2el(vs t0trenmo ta1lpte n s;(0 rtrim nodoptemivsatf Dtrxr ;u4aet moetlsfa2uaumpnu)alxrxf3io1oaDrli olt teumimpno1lp  lfcsltfa2ra(  nu4aee mo3ilt mDea( o;(0aexnio3oadoatr iei ()tetmimpiudam n ncia() 2rrurooo0tpxnifeiadlm ulnvsn(4aexnmr tadopDe ueo;( teuoxmpnudlptnmivs (fsrrm( pnu0aee  oeils a2umumpnu4 leoxocto1fmtr ivi ()t2trxopio4oltelfctls)sruax p;u4alxoiieiltlsDrln s u)trxoxr3iodlp rluvsl(0 rxmxopiodoltn fetl() rtaxrpnt0tpxo ictasfm umu snt4artrxo ia1opDe ivols) 2xr(mpnudlpenlncsas arurxrp;u0alen f3iyd m um(mp t)alxrio3oy1latrlu s;t) 2urxo3oudap  mies t)aDrrxmpnt4oee ii3iytfs2ea(ms;()alenxo3oa1oaDrlu s;t)srurio3iodaleelivils)aDtmx  ;u4oltn fcild s ran ont4trxnxf ty1fa rlneilt0tetmimpou4lmenmfcil(faDumx o;u4aeenmi3iysls2um( p t0tltoxr3iatlpDelnvi;t) exrir no1optnlfeia( s2tauroou0olx ifctytla raump;u4aetrif iy1latelnei t) 2tmio3ny1olenmiciltfaDumur ;o1oleo i3ilsfm2rmu pnt4 etnircootfaDe ivs (0t2umxo3nu4lmenlictatfartau onu0alt  o3tatls2ua(vs u0aeenmr3io1lmD  ueo;t)sexm(o3oudape liviasfaDrrxro;u1tpxomfcias m uluvon(0alxoircoadlaD an i;s)t2um(o ou1lpt  fetltfa2taxmo;o0teenmo3ias mDra(mo;t4tetoxr ootop rlivolt  2xoxopnu4amtnmnvilt) rtaurono1aptomoctasls2ran snu)aexoif3todop   ivi ()t2umir oy1lptnlfctltfs2tm(mp;t0opxnio3ild s rmu pnu)tltomf3ootlmteauvi t0srtr(o3oudllenlfvi s)srtaump;u0tltn oeiys m2rm( pnu0treriociatoaDe ueols0 2tr(mpny4aptn fvsl()s2ra(  ot1tlx mfeiatfs rauvsn(0 etoxo oatfm  livo (  rur(mpiu1apeemfvta(  2ua(r ou1aet mf3iydlm2rlumo (0 rtnmr3iadomt lueo ()srxoxopoydlp  mivt (f 2uru pno1oexnmfeiatfaDua( onu)alenxf todoaDelies ( t2tmxr3iu1llee netas a2rax o;o0oltomociyd mDemu sn(4altoir oa1omD lnes;(0t2toiopiudlltelnvsl() 2ra( o;o1tpxoifctad m2emump;u)aeeoxf tatoa e neo;( trxrxr3oo4amtnmnvtl()srurur nt0aptomo3iydla2rauvp (0alermf todoaD livol(0tetoxopnodal emfvs s srrmx ono4altomo3iyd a2ua(vpnt0aexrmrciotlp eluvols0 etoxopiy4lp nliviltfaDrmx o;u1tlxo fctyt m2ea(vpnt) leomfcoy1omte n i ( srxm(rpny4lm eliesas a2umxr ot1apto fctltfa2uln o ()aexnmrctatlp  aueo;s0trumim oudol   ivta(  rtr(monu0teto o3ils s2uanvs;(4 etoio3oatfp  anvilt) exoir3ny4am e ivtls) rtaxmo;u4olen fetyt a ra(vsn(4 eerxrctodlpDr ieo;t seurxmpoydal   iei (  Dta(r no4tetoiociad m um( p u0 exrifctotla  lnvi;t teurxo3iodapt lfctas sruax  ;o1apeo f3iltfaDel(vs (0areoio io1lp elu o;s0trxmio3iy4ol  mncsas)sDur( p;o1texomfciys m2elu snt)arxnxr to1opD luvols)texr(r3nodlmenmnesas  2rrxroou1tlt  fctlsfmDrlu s (4 lenmo oa1lp r uvi;() 2xm(rpnudop  micsas  Dta(rooo4tltnmf3iasfmDul( p;t4 exnif3oodlpDr nei;s0 exoxm nydol e iet (f rumuronu4ope mfciys aDel(monu) rtoio3iatlpt  uvils t2ur(o oydolenlfcs s)srumx pot4opxo f3ils a2uluvpnt0tltrxf iatfptrluvi (0srtoirpoodopte ietas  rtmumooo1tle mfctas s2eau on()artnmrcoo1fmDr ivol()tetm(m oodlm elfeta( srumx oou0ole mo3iad a2uaumo;t0arxomr oo1faDeaneo;s)srtriopoo1llen neils arrrxm oo0aex iietltfs rl( p t0trtoir todfaDeluvolt0s2xrir ou1apen ivs tfsDta(ront4opt ifciadfsDrmn s ()tetrmf3iatfaDe nes;s)trxr(opnu4opee nvsas)sDraxmo;t0openifciad mDea(mpnt)tlxoirciotlate uvil(0truoxopnodopeelfvsas aDtrum ;t0tleniiciasfa ulnmsn(4trerxf3iytlmDranvo ()tetmxm3iydomtelfei t  rua(mp;o4tlenmf3ils a el(vs;u4 lxnirciatomD aivs (0setm(o nodame lfctlt)s2rrxmo;t0tlxnmoeiyt s ean ont4artnxocootfa   u s;( srurxr3oydamtn nes sfaDtrur ou1opxo fcilslm umums u4 rtrmr3ty1lp ran s;s)truo(mpiu4olenlnvsls)s2tmu pnu1oeen ieildfa emnms;t) eeoirctadomtelnei;(0trtoir no1lmt  fvtlsf rraumpot0oltoiociadfaDelnms u0aleoxfctatfpte uvo;t texm(m oy1al   fesltfs2ra(ro;u1tlx mieiytfmDeln o u4arerxr iydfpt  nesls  rtrio3iu1ameelivt ( s2ua(ro;t4oee mociasfa raums;t) ltoxrciadfat luvi;(  2xo(r oydoleemnei tf Dtaxmoou0tpxoii3iltfaDulnmpnu0teermocoy1opDrli i s0 rtm(m io1ol emivtas a2rrx  ;t0olx iieiltlmDrmu p;t0 rtomociydla  lieils  rxrxr iy4al n feil( a2tr(mp;t0tetn fetld a2emums;t)tlxrmfcootla eliesl(0 etrim oy1ol e nci (fsDtaxm no0opeo ietydfs2ul( snt)aetnmf oadla   uei;s0 exmimpiu1lmee fcia() Dumxm nt1tetomocildfm2uan sn(4artoifcoytfpD ln s;t) 2urio3ou4altelnet (  2umxm nt0alxo f3ilt aDemumo ()aleomo oa1lm elu s;s s2ur(r iu1lpee fei sfaruaxm nt4tptomieiydfm2umumo ()aeenmfcty1oat liei s  etrxr3nodlpee fvs t  2uau  oo1opx ifciytla2uau p;u) etoxoctatlaDrln i s0t2xrxo3ou4lpe lfcs s)sDrrxrpnu0apxo icilslm2ra(vp (0tetnxfciodlm  lnvilt)trxoxmpiy1lpt  nvi tf 2uau ono0tpen fcildla rlnvp;t4tetnmrciydlpt livo () 2tmirpoy4apenlfvsasfsrraxr ou1tet io3iadla2eaumsnt0teeoifcia1latraneils t2to(rpnu1am emnesl()sDrmu ont0tet  oetlslaDumumpn()alxoxf3oy1oatran s;t  rumxmpnu4oltnmieils) 2trxronu0aptn i3tasla2eluvp;u0trxrmfcio1oaD  nei;t trtrim3io4lmt mies (fa2umu  no0aetniieild sDrm(msn(0tetnio oodfateln s;s)teuoim3iy1lmeemietls  2rau  ;t1opxo i3iyslaDul(vp u)treoirctatopDr iei s0 2xo(opny4optn iesas sDtax  ;u4tptoioctld sDrmuvont0tetrxr iydom eanvo (0texoio3no4oltnlfctlt)artau ont1tlxnmictys s2uln s;t4 rermf tytfp   ueo;( setoxopnu1lmt mivta(  2umxrp;t4aexn fetlt sDea(ms u0 leomo ootomDe nes s0 2trio3ny4omee nesl()a2ta(ro;u4tetomf3iydfs2umump ()trerxf3iytfate i o t) 2trirpiudole  nciltf 2raumpno1tle  o3tltls raums;(0tlxrmrcoa1la  ai i (0srtm(r3ny4om  mfcils  Dumxmoou0apxoiieiatfa raumsnt) eerxocoo1fp eaies (0teto(m iu4lpe mivs ( a2ta( ooo0oleomieiasfa umu p;u4teerxr iatom eli il() euo(rpio1amenlnes (fsrtaumo;u4oleo ietlslaDrmuvs;t)aeeomf3iotoat  n s s) exo(mpny1apte fetl()s2um(  nt1tpxnifeilslm eln o (0alermr3totoa  li s;t)teumxr3iydamt licsl() Dtrx o;t1tlxomo3iysfa uln p ()trerxo3ootop   ivs;( s2xr(r3iudlpeelnct s s2ra(ro;o1oeen i3tldls ean p t0tlenio3ootom e uei (  exrirpny1lmtnmicsl(f rtr(mpou1texomicildfsDua( snu)alxomfctadop eauvi s)t2tmiopoo1olte fesa()sDra( ont4alen icilt a ea(mo u0 ltrmo iatopteli o t0 rxo(r3ou1lp  miei (fs2rrumo;u4aetomoeilslaDulnms;t0aexoxrcoatfa eliei ()sruoio3ny4lmtnlncs s)aDrr(mpou1olxomo3tyslsDra(mpn(0aeerxr oadop ranvo;( s2to(m3nu4lptelfesl( a2umx ono0aex  f3tysfs eau pn(4aeenmrcoytlm r ies;(  exo(mpiu1om nlieils  2taur oo1opxnio3iysfa2rmuvs u4altnxf tytfmD au olt)truoxm3iy4lp  miciltfaDum(rpot0alt mo3ilt a2ea( snu4 ltoir oy1fpDean ols0tetoxrpnydope lfet t a2umxm no0optn i3iadlaDrln ont4tetrxocty1faD aueslt  eurxo nudalee icsl( sDtm(r nu1tlenii3iasfm uauvont0 etrir3oy1oa  aieo s  2uo(r3ou4opt lfet () rra(ront4aptoii3tyd a2el(ms (0areoxfciydoaD li o t) 2ur(rpio1aleemnet sf Dtr( pot4oee ioeild m umu on() eeoxr3iatomt aiesls0t2xmio3oy1alenmfcs (  2umu p;u0olx  fcildfm emn o (4 exrxr3iy1lm r ivi (0 rtr(rpoo4al   nct s  Duax pou4altoioctytfm2ua(vo;(4alxoxfcty1fa  ai s;t  2urxm3iudomtnmfcia(  2urx  ;t4opxn i3tlslm2ulumpnt4aeeoio3oadlmteau olt sexoim nu4ame  nesls)aDraur ou4aeeo ieiydfs ranvpnu) leoxf3iatlm e i i;t) 2tm(r3no4ap n neiat  2raxrpnu1tex  ocils aDemnmo t4 lxoxr3iatoate ueols  etoim3oodlp n fcilsf Drr(m ;t0aex  f3iadls2umn o;() lxniocoo1fmD an o;s) etm(mpoy1ll nmfvslt sDtr(mo;o4oeeoii3iyt s ra(vo u0altoxociadoa rai i;s) eumim3io1lmee fcs sf 2taurp;t1tlen f3iyt s2umnvo u)alxoxociytfp   i o t)s2xoiopou1lm n nciasfs2uaump;u1opxo i3iydfs2rl(vpn(4 exomfciodlaDrluvilt  2tmim3nu1amte icil(faDumu o;t1apxoioetltlsDeln s t0tetoxr3iadfa  aieils)teumir ou4om  micil(fsrtrump;u4tlx  fetadlsDelnvs u) reniocio1fpt aueslt)t2xoimpiu1amen fei s a2rrx poo1openif3ildfa2ua(vo;t0tlenifcio1lp rauvs t texrim3oo1olen ivils arrau  ot4tetnifciysfa2uanvp u4aeeoxf3tydlpt  u s;s0 ruoio nu4olenlfvtls aDumxr no0alxoio3iatfs rm( o u4artnxo iodfaDrlivilt  2uo(mpoudope lneta()s2rauroot0apxnifeiatlsDumums;u) lerifciytlm r uesl(0s2xriopiudomeeliet ( a2uau onu4tpxo i3taslaDuauvp;() eerxrcta1faDeli s;(  2urirpoy4apt lfeiat)a2tmur nt1altnmiciyslsDem( p u4alxoxo3oodfaD aivsl()s2tmxo3oo4aleemfvt (f 2ra(mp;t0tpeoiictltfs2um( snt)arenir3ta1omt  uvslt0 rxrio3ny4lpt  fesat)a2rmx  nt0opt mfeiysfm rmn p t0tetoxf iy1fatr u o s tetmxrpou1ame mnet ( aDum(  ;u1tlt mf3iatfs2umuvsnt)trtoif3oydomt aieols trxo(rpio1amenlnes tfs2rrx pnu1texo ociltlsDuau o;t) ltoxocoodopDeluvols0t2uo(opnu1apt lnvils) rrax o;u4opxoio3ils aDuanvo t)altrmf oytlat  ueil(0 eum(r3nu4lmt  ivslt  2rm(mpou1tee  oeilsfs2rm(vpn(4trtnmf3oy1omt an ilt)sruoir3oydlmtnlfes t) Drmum nt4open oeildfa2rluvpnu4 etrmrcoa1fa e ieolt0 2uoimpnu4op   feiat sDrrurooo1aetnmf3iydlmDulnvsnu4trtrmf3iadlmDe u slt0srurxr3iudlpe  nvtat arurx p;o1aptnmoeilsfsDel( p;(4texnif3to1lmDe ies s0 exm(m3iy1op n iesl()a2rmxr nu0aetn feiatlmDra( p u0alxnmr oodomtelnei;s)t2umxopnu4alee fvs s a2ua(rp;u1oee mo3iytlm rmuvon(0 etrxr oydlmD lieols) eurxopiudomte nes sfarta( oot1texn icias s2em( s u) eeoxfcoodoa elnes;(0setr(r ny1ol  liet ()a2umumpoo0alxoif3tasfm2rmnmo t4altrxo3oodfatr n il(0 ruoxmpiu4al e ivta(  Drmu  ot1tltn o3tlsfs2ra( snu4tlermr iatlm  anvs;t0srxrxm3iu1lm e ivi s)sDtax p;u1openiicilslmDum( s;u0trenif iotlat  ivo;(0s2xrxrpno1alt liei sfaDrrxmpou0oex  iciltlaDulnvp t4areomrciodom   ues s)s2trxm3ou4altn icslt  rtauront4tltnmoeiydlaDuln p u4altnxocta1latrln i;t texoxrpou4llen nei s) Drmurooo4oee  i3tasfm2umnvont0texnirciatlatrlu s t) rxmio iydaltnlfci tf Durx onu4tlxn fciytlsDeanvs ()tlenxf iadfaD an i t)sexr(o iudoleemncil(faDta(rono4open o3ilt mDean pn(0 rxrio ta1lp elueil(0texmxr no1om e iciatfarum(ro;o0aexo oeiltfs2ul(mon() lxrxfctadlpDrluei () etoimpiy4apee ncsa(fa2umum ou4opto ietltls rm(vs u0 ltrxrcio1oatr u o;t  eumxm3nu4olee ies sf 2uau  ot0openmo3iysfs2umuvo (4aetrxr tatlateai o t  euoxopiy1apte fes tf rtru  nt0tet miciadfaDrlu snu4trtomf3tytfmt  ivolt0srurxmpno4omtn fci tf 2tmum oo1aex if3iatls ra(vsnu0aetoxf ty1omteluvi s tetoim iy1llenlfei ( s2tmxronu1oeeniictat mDua(vo;t) exomocoodlpDrli olt) 2tmir iodopt lncias sDrax p;u0apt iieiadlmDeau o;t0areriocoodlpt  i s t) rtrio nu4omen icia()sDua(m no1alxomf3iysls2uau p t4treoif3oytfp eau s;s  rtoxrpnydaltnlneiltfa2rmur ou1oeen oeils m rl(mp;(0 etnxrcoytfp  lnvo;( texr(opiu1om  mieias aDrruro;u1tpxomi3tltlm2ul(msnu) rxnir3iadfpte n o;t srtoim nu4lptnlncsls)sDuax ono4tlxo ocildls2ranmo;(4artnmo3oadomt  ieo;t0t2urirpio4amtn fvtas aDtmxmpnu0alxn o3iatfaDelnvp u0aetrxo3tatfatelies;s0 2uo(o3ny1opeemfvs s)arrrxm ;u0ape moeiatls uaums u4 rxriociydop e nvo ( seumir oy4openmfeilt) Dtmump;o0oeenmociat aDuln snt)arxomo to1opDelies (0 2xr(o no1ome lnetl(fs2tm(rpoo0opeoio3iadlm ra( pn(0altnxf3ia1fmtr uvi;s) 2uo(m oo4llee ivt (  2tr(mono4open ieilsfmDum(mpn(4trxrmocoy1opteluei;(0s2xo(m3iodlm nmfet (f 2tr(m nu0alt mfetas s rmnvo () rxoxo tadlptr nvs;t)teumirpou4lltelnei s)aDumx ont1opt  ictysls el(vpn(4tlxoio3to1oaD  ivs s t2xr(o3io4ame  ics t aDrauro;o1oeto ieias m2umn sn(0texnmo iadfpt  uvilt teumim3ny4aptnlncia(farra(mpou1alx mieiatfm2uanvp;u4areoircoatlp rauei;t)t2toir3oy1lp  lieslsf Dtrxrpnu1opx if3iydlm2um(vonu)trerxf3oadla elnvs s)t2toiopiudomte fvsls srtrxrpoo4alxoif3iadfaDuan on()arxnirctotoa eanvo s  2to(m ny4lltemfvsl()a2uaumoou4tet  ictltls2emumo u4 lenmrcty1fmD  n o s0s2xoimpnydaptnlnvia()s2urxr ot0oet ii3iad m2rlnvs t4tltrif oodfpDr nei;t)sexoirpou4ap emfeia(faDuau oot0alxomociasfa ua( snt0arxoxf3ia1la  anvs t  2tm(mpoo4olen ictlt s2rru pnu1tpe  i3tasla2ranvo;(4tltnif3tadfp eli s;() 2trir3oy1opeemfct t) Duru  oo4oetnmoeiys m rlnmpnt4aeenif iadfpteln ils)s2uoxr3ou1lltemieils  2tmxmpnt1teenmfetytfaDemuvp t4aetoiocto1omte n olt  2uoxm3oodamenlnct s artax poo4teto ociat s2rmums;(0teeomrcoydfpte uvo s0 2uoir3oydaltn fvt tf 2ua(rpoo1aptnmf3ildlm2emuvp;u)trxnir3io1omtrau o;s0t2xm(m3nu4lm nmfvtat aDumxrpot1tee  ieiatlm ea( s;t) ltnmfciytlm  ln i;( texr(rpiy1ape livsls)a2tmxmo;t4tpx ioctadfm2el(mo;u0 ltnir3iatlmD  n o;t)s2tmir oo1lm elnvsas  2rr(  ;u4ape  fcias a2eaums u0artomociatfmtrauvils0s2urxr3oo4lmtemfet t) Drauroot4tpeoiocilsfaDem(ms t4tlxoxr3ia1omtran o s  rumim3oo1olt  nvsltf 2taxm ot4alen fetatfa2rmnvs;(0texrxf3iadla rlnes;( teuoxrpoydlm nlncsas)aDra(mp;o0oetn i3iltls ean o (0aetnxo3iatlm raueol( t2uo(r ou1aptnmieia()artm(moot4aee if3tatfm2ul(vo (0 rtoir tytlpD  uvs;t)truoxrpoy1amen ictat s2tmurpoo4altn o3tytfm emums t)tltomfcootlmDrlivs ()t2um(m oudamte fvtlt)sruau  ot0olt  o3iyt aDranvpnt4tlxoir iytfptelivo ()t2trir3ou1apenlfet tfarua( ooo0aeenmiciydlm2eln p u4altrmocio1oa   ivi;()s2xr(m oo4lltnlfvtls artmx pnt0tlen ictatlaDua(vp;u0tlxnircoytlpDelieilt)texmimpiy1om  lfcslt srrmxmono1tptomocilsfa2ranvs t0alermf todoatelieil(0 exo(m nu1amee icsat  Durump;u0texnmfciydfmDrm(mo;u) rxnmr3tydlat  u o;()s2to(r iydlpenmnctlt  Duru onu0tlxomocias m uan o;u4alxoircia1laDraieo t0texrxm3nydop nlivils)sDrr( o;u0oex  fciyd s2eanvsnt0trxoxr3iadfptrlies;s0t2xr(m iy4om   ics ( a2rrxronu1tpto f3tlsfs2el(ms;(0 etrif ootop elu s;() 2uo(r oo1apt  nvtls)aDta(mono0olxomf3tydfaDea(msnt0tetnir ootfpDr ivslt) etr(opoydol  mfesatfarua(r ;o4tptnmfctldla rl( s;t)artomf ty1fmtelnvil()texrir3oydlme lnctl(f Dtm(mooo4texnmieiytla2umuvo;t0trxoxocty1oa  aneslt0 etmim nydam elnetlt sDrax  ;t0oeeomo3iydla2rlnmonu)aexomrciy1fm rliei () rtr(o ou4ame  iei t)arrmx oot4apeo fcild s em( s;u0trerxf ty1lp  an o;(0setrim3iu4opte ieia() rumumont0oexniicildlsDum(ms t0 rxomf3iodfa e i s;t)srtmimpoy4ole  ici sfs2rm(  ot1tex  o3tytls2ulnmp;(0arxnxr io1om eaiei;t)srxmxm3ny4oltelictls) 2rau ont0tet mi3iys s2elu s;t) exrir iadop rli o t0 etrxrpio4op e fesl(fs2tru  no4texomfcias mDrauvo;() exrxfcio1fptraueo;s0s2xoxm3nydal e icils aDtaxroot1aex mictyd s uaums;u)teeomrciytfmtelivi;(0t2trir3iy1omeemnei s) ruaxr no0tet  oeiadfa2ea(ms t0aexoirctytom elneil( srtrxo oodame  fvtatfsrtr(rp;t1tpt if3tltla elumpn(4alenxoctadfm   nvslt0 euoio nudll emfct s)srrmum ;u0tlto ociat aDumuvp;(4trtoir3ia1oatran i t0trxrxmpoy4lmtnmiet s  ruaurooo1tlenifctld a2rm( s;(4 rxrio ta1lmtr n i t srxm(opnodlp emfeia(fa2raxr nt4aexomiciasla el(mp;t0altnmocoa1lmDrau ils) 2umiopoy4lp elfct s)a2tmumont4opxnmfciyt a em( s (0 lerxo3iydoat aues (0seto(r iudopt mict s a2urxro;o4teeoio3tasfsDranmo ()aetomo3oy1lat  nvs s sruo(mpiodop nmnvt tfsDurxmpot1oeenmf3ildlm rlnvpnt4 renif3ta1fat aneolt0 exoir oodope livias  Dur( pno1tpeoiociyt m em(mo;t4aetnxf3iotfat lneol()tetmxo3ou4am emicsa() 2trur ot4aetn f3iytls2rm(vsnt0texrmf to1opDean olt  rxrxm3oodop  mfvsa( a2ta(roou0ape  feias mDeanmo u)areoio oytoa eauvi;( t2urxopoy4ap e fvi t  rtm(ro;t1opx io3tldla ea( s;(4 renio3iotfmt ai sl( s2tr(r no1ap n nci tf 2taur ou0tlx ifeiadls2el(vsnu)alxoxr3oydlm ean o;s  2xrir3no4lm  lncsasfaDrrxm ;o4oetn oeiad s2eau p u)aeeriociadlate nvil(0trtr(rpoodll  lnvt ()sDta(mooo0tet mf3iyd m2ranms;(4tltrir3iytoa  auesl(0s2uo(r3nodaptnlnvsls a2rrumo;u0optnmoetadfaDemnmpnu4aexnxociadlmt  uei;s0s2xoxr oo4am  mneiasfaDtrurpno4aeeo i3ilsfa em( p;u4tltnif3to1lp rluesl() eurxopno1ameelivs s  rua(roou4optnifciyt m emn pn(4 renmocio1op rli i t0t2xmxmpny4oltemivt (f Dtmxmpnu4olxo ietatfm2rm( s;(0aetrxocoa1laD  ivi t trurio ny1ome lfcsasfarurxrp;t4aptn iciytfaDeau p;u0alxrxf3oo1fm  lu o;s  rtoim3oo1ame  icil(f rrrxmono0oex if3ildfa2ea(ms u)tlenmo to1lm  lu s ()texmxm no4apte fvs t)a2ta( pno1oex ii3tldfm2emu o t)tlerio oadopDrli i t) 2tm(r oo1alte fvtas  2um(m ot0oex miciydlmDem(ms u4aeerif oatfmD  ueols  rurxm iydamt lnvilsfarrmu poo1tee  ocild sDem(ms;(4 eeoif3oodfa  lies t trtmxrpoydlle lfvtat)srrax pnt1oeenifciadla2eau p (0artnxo3oy1fmDrlneols seurir3oo1amenmies tfartrumpou1alt mociat aDeaumo u4 exrxf3tydfpteliei;t)t2trxrpio4altemfvt () 2taxmp;u1aeeo f3tyd a rlumo (0texrxr3tatfa   ieols s2toiopoy4aptnlnvil()aDtmu poo4tetoii3iad a uanmpn(0tltoir to1fpDr nvi;() 2urxmpiydopenlieslsf Drr(mp;o1tpxo o3ils m2rm(vpn(0alxnmr io1lat lu i;(0 2trxmpiy1omenlies s srra(  ;t4apeo i3iys m eau p t4aleoif ootopte i s s0t2uoir ny1lmtnmnetat) rurxmpoo1tpx  octydfaDea(vp (4trenif iodoptr u i;s)s2tm(m io1oltnlivsasf Dum(rpou0ale  fciadla2elnmsnt4tetoxf3ty1fp raueo;( sexr(mpoo4altnmivsa( s2uru  ou1oee mfciltfs2eauvs t) rerxo io1op eai ilt0 rumiopiu1altn nvsl()sDum(moot1alt ifeild sDem( s (4 rerxo3tatfat au i;s0teuoxm ou4opt lnei sfsDtrxmonu0olen fetytls uanvpnu4aetrmo iydfaDr nesls)trum(r3oydlptemnviltfa2trxm ou4aet ii3iydls2elu s u4tlxnir tatlmtelieslt0 2tm(r3oy4omenmnctlt  ruaur ;u4tpxn f3tadls2ea(monu)texnif ty1fmt  iesls texrim3oydole lncias  Dtax  nt1aex  f3tltlm emuvs (0 lenxrcoo1lpDrli o t0sexr(m3io1ole livs (f 2uru onu1tpt  ieils sDeaump u4trxrifciy1fm rlneslt)t2xoxm3io4lltelnvs (fsrtaxm ;o4alenioeiysfs2rl( o u)teeoircio1fmteluvil()t2umim oo4llte nvs ( a2taurpno0tlxn octadlm2ea( o u4 ltrio3oy1op ranvs;t) exoxm oydlpte neilt  rurxm ;t1tpxomo3tyt s2rmump;u0trxoir oodoaDrlu sls0 2xmxrpno4om n feia(fartrumo;t1oltnii3iydla rluvsn()tltomr oydfp e nvilt0teur(rpiu1ap n fvt s)sDumx oot4tlxn fctaslsDeau o (0artomf3iadoaDe n sls0trurxmpny4al e ncsas)srra(moou1tpxo ieiat m2rmu o t) reomrctydopt  ieo;t)t2uoxo iu4lpt  fciatf 2rax  ;u1tex if3iadfs rl(mo;t4aexoiocoodfate nesls0t2xoxmpoy1lltemfcil() Drrxrpnt4tpxnmo3iltls2rlnmont4trerxo tydlptrli o;( srto(opou4amen fvtlt a2rm(mpnt1texoioctasfa ea(ms;(4trxoir3oadopDr ueol(0 2tmxo3nydamtemnetatf rraxrpou0oetoifciatfmDul(mp;t4 rtoxr iy1lm  lu sl(0srxo(rpoo4lpe mfeilt a2rmxr oo1oexo o3ild m2ea(vs;u4texrxr oa1fatr ueo;s0 etoim no1oltn nvt (f rurur ou1apxomo3iltla2el(vo (4treniocty1fp elnvsls trxo(r oo1lmtelncslsfsrra(rpot1tlxnmieiltlaDrmumsnt)trxnif3oodlmtr ueo;(0texoir3nodlpe  fcsa(fa2uaum oo1aptn ietlslaDelums;u0areoio3oytop rai i;t)s2toxr no1altelnvtl( sDtm(m nu4aeen iciat sDua( p u0aexoxo3tydlpDeauvs;s)sexr(opnu4llt  nctlt) rtrur ot0aet  o3iadfs ra(mo;(4tltrif ta1fm rluvslt0texriopnu1lm   nesls) Dumxm nt0oexoioeils a2uaums t4 exnifcoytomt  uei;s  eum(r3oydll n fct t) 2rrumoou4oltnif3tas mDrlu s u0tetrmr3oydfatrauvsls)srtr(o oo1ape  nvslt)artaxmono4alenmfctys mDem( s t0tetomrciadlatraivi;()truo(o3iu4omtemicsa( arrr(mpnu4oeenmoctysfa umu snu0 etnxf3tadlm r ivi ( s2ur(m iy4llenmicsat s2tr(r ;t1olenif3iltfs2um(monu0 rxoxf3iotfpt aivi ()teto(o3oy1lm nlnci s  Drr(mo;o4ole iiciasls2eln sn(4trenmrciatfpDranvols) etrio3oy4omenlnesa(fsDrruronu0opx io3iad sDuln snt) lxoxocoo1om rlieo;s s2tr(r3iy4lmtelfes s)aruaur no4tlenmo3tas s2rauvp u4 ltnmf3oadlp e uvo;t) 2xoxr oydlpen icia() Dumu  nt4aex io3ild a2uanvo u0alermr3iodfmD lu o;()srxmxo3oy1alt mnct s aDumxrono0teeomoeilslmDrlu pn(0arxrmo3totopD aiesls0t2tmio3oo1ol emietl()s2ur( ont4altoioeiydfs2rmumo u)tltomf io1omD  u o s)t2umiopnu4ll   ictasfa2ra( p;t0oexniietat mDemu o u4trenif3io1lm e neolt0 euoiopnodolt lfctlt)s2ur(rp;t1aet mfcildfs rl( p;t)texnmo3iy1oatrauvi t  rxmir3oudap emfesl( a2umurpou0tlenio3iaslmDrm(mp t)texoir3iatlpDe uvils)setmimpnodape micsa(f rtrur oo1olt ii3iasfs rm( p;(4aleoif3oo1laDeauvi;() etoirpnodalenlnci s  Drmxm nu4aee  i3iyt s2ran snt) etnxr3oy1om r ieils s2uoxmpnodlp   nct tfa2umurp;o1olen o3iltlmDum(von()arxnxo iy1lp r u s s) 2xr(mpnu1am nmfct s)s2rru  ;u1oex iocilsfs emn s t0tltrxf3oadoa elies s)trumxm3iudale licias)a2rau  no1aleo oeiad a2uln s u0 rxoxo3oodlaD li o t  eur(m3oudap  lnct tfs2rmx pnu0oltn f3ildfmDum( snt0aeermfcia1optraneo;()t2umim3oodopenmiei s)aDtaump;u4apt iiciydfmDulnmon(0altnmr oytfpte uei s t2xmirpio1al n ivt t  2ta(moou1tltoifctlsfsDrln o;t)trenmf todlpt lu slt  2um(rpiydopeemivtas  Dtrxr nt0oetn i3iat m2eau snt0 exrmrciytom  ai s s seuo(r3ny1llt lieils s2rrum ou1alto iciysfm2ulu s u0trxnxf oo1oatrli s;t) etoxrpny4ale livsa(fsrtauro;o4tlxo ictls m2ua(vo u0alenxo oadom eanvo;(0texr(r3iu4llenlncsat s2raxrp;o1tltoifciydfa2umumpn(0 etrircoa1opDrluvil() exoim3nydlpeelfvil()arra(r nt1alto icild sDeanvp u4arermrcoadlpt  neslt  rtm(opoodalt livia(farumxrp;u1tltnmfeiatla2emnvp;(0texnxo tytopD anes t  2um(mpiodap  livsa() Duaxm nt0aeto fciat s ean p;t)arenxf3ia1lptrlneols t2uo(opnudopeelnesls sDuau oot0aee  i3ildlsDua( sn(0treriociydoa  lnvols  etm(mpoodom   ivs t) rum(  no4aetnifctydls emnmo t4arerxrcia1opt  uvsls sexoio oodop emiesls aDua(r ou0ope  feiytfa2rau p (0teerxf todfpt lu o;s) 2xoir iydlmtnlieia()sDtmur nu0tlenmo3tydfs ranmonu) lxoxo tydfm r n s;t srum(mpiu4olt lnctas a2rmu pnt1oex  fciat a ua(vo t4 lenif3tatopD aueo;( seuo(m3nodlmt mfvsas) Dua( o;t4oex  o3taslaDumnvo;(0tltrxr totop   n s (  rxm(mpiu4omenmfvsa() rtrumpnu1aetn feils a ranms;t0 eerio iytfaD  nvs;t  euo(rpou1lme micia()sDtm(mp;t1apenio3tltls eau o u0artnmfcia1opt  ueils)seumxo3no4optnlfvt sfarrmuroot1oeen feiasfs2el( o;u0 lermr3totom ean o t s2toxo3ou4amtnlicil(  2rr(rpnu0aptn icilt a2emu p (0tltnmr3oydlatelu i s)sexr(rpnu4omeemict s  Draumpot4optomoeils sDrln on() lermr ty1lmD  uvil()srxoir3oo1amtn fvs (f 2uaurpot0oleomietyslsDelu s u0 rtrmo3iytomtr uei t0trxrxm oodoltemnvi s)srrru o;o0alxn ieiad mDua(msn()texnxf ia1opD  ivs;s trxrio3nodll nmnetasfa2trx pot1alto i3ils a eau onu)alenmo3iy1fm  lueo s0s2to(o3ou4al elfeils aDra(m ou0tetoiiciyt a2emn p t)aetrxrcia1fatranvs;()seur(r iydlmtnmnctls)aDtruro;u1alen iciysfm2elnmo;t)alenxr3tytomtrlueol()trtoio3io1lptnlfciat  rrr(mpno1texomoeild aDumumpn(4tetnmo3to1la   iei;s sexrir oo1lpee nvtas  Drru o;t4tleo f3iat aDemu on(0 exrircoytfm r ivil(0 2toxrpiu4lp emietlt  2ur(  ;o1ale  ocilt a2el(vs t4tlxnif3tydfmDr uei (0 etoio iydlpe lfvia()sDtr(m nu4olxnmieiasfs rm(vo;()altnifcoytlm   i i;s0t2xoim oy1apeelfeilt  2trx ont1oexn ietadla2um(mp (0 exnir oy1lm eluvi;t s2uoim oo1omtelfctasfsrrmxmpot1alxo oetas m uau p;u4artnmrcio1op eauvs () 2xoiopny1optelfcslt  2trum oo4oleoiieildfm2raumo u4tlerirctytoa   nei (0t2xoxmpoodamt mnvsatf rtrum ;u1opxomi3iyt m ulnmp t4artomo oy1omteaivi;t0trtoio3ny1amtnlnvtltfartr(  ;t4ape  o3iydfmDua( p u4texrmf totfpDelnvi;t  rum(o oodlptemneslt  rum(mpot4altnmictadfm2emump;t4aeenxo iodfa r iesls) rxr(r oydomt  ietat srtmum nu4oltnmo3iydfaDuln s t4arerxo iydfate i i;t)t2trirpoodaleemfvia( s2tmur ;o0aexo f3iatfaDrln o (4 etrmr to1fp rlivo;t  rxr(opoudlleemicsa()a2tmuro;u0apto oeiydlm2ra(mo;(0trxrxocoo1lp  luei;( srxmxr oy1lmtnlfci sf Dua(ront0opt if3tadla2um( o t) eerxo3iytfptr nvs;t)trtrxrpoo1lm nmicsls) rtru  ou1tee  iciytlmDem(mon(4arxoxo3iodoaDeanvo;()texmxo iodomenlfvi (fa2ra(ro;u0tet  fciysfaDuan s t4trtnif3oadfateliei;t)t2to(r nudom  mivi t s2tm(mpnu0ale mfctyslm2ul(vpnu4arxrxo3ootfptrln s;s)texrxm oo4ol n ivt s srraxmooo0tleniieiysfa rm(ms u0arxnxo tydomD  u o (  2uoxr oy1ap nmfcsa(  rum(  ;t0ale  i3tad m ulu sn(4alenxr tadfa e i ols0 eum(r3oo4alee feils srrmx  nt4olxoifeiasfsDrln onu4 lxomocto1fatrlnvol(0s2xrim3iu4ol  lfesas  Durxro;t4texomieildfsDemn s t4trenxf3tatomDeliei t)tetmirpiydopt mivsas) 2uax  oo1tleomocias s2rmnvp (0alenmrcoodfpD luvol()t2xoiopiu4lltn ies t  rrr(  nt0alxoio3iadfmDea(mo;t)trtoir oydopte nvs s tetrxo iudllt livt (f rrrxm nt0teen oeiys m raump;t4alerxrcio1fmteau o t0trxmxr nu4lm   fesatfsDrmxmo;u4alxniiciltls2rm(vo t0tlenmrciadfm  lneol()sexoxo oodlmtnmfciat) 2rrxrpnt0olxo iciasfs2uanms;t0 rtnmf to1lm  li ils  etrxr no4apenmict t) 2umumpot1optnmfeiyt m el( on()arxnmo oatlat ai o;s0 2tmio oodaptnmfcsas)a2rr(r nt1oet  fetldla uaump;u4 lxnmo3oodfat ai il( s2xr(o iu1amtnmict sfarua(rpno4tpe mfcilslmDrmn p (4tetnxocoy1lp e neolt s2xm(o3nydom  lncsl(fsrtmxmp;u1opxoifciaslaDemumo t4tltoioctytlmDeai sls)texr(r3oydapeelncsas)s2um( pou1aeeoifeilsfsDrmumpnt4texoxf oatfpDr n i t)t2tm(r iy4apte ivsa( s2truronu0aex mf3tasls2ul(vpnu) lenxr3todoa rauvo;()s2xmirpoydol elfvtasfs2trxro;t0apeomo3iyslsDulnvo;t4artnmf3iytfp eanei s)sexoxm no1optemivsa() 2rmx  no4altnmoeiadfm2ulnvont0aexoxf iy1op elneil(0srumxrpoy1lmenlies s)aDumumo;t1oeeo ociadfm eaums;u0 ltnmr oatlpDeluvi;s s2tr(m3io4llt lictlsfs2umxmoot1tlxnifeiaslsDel(vs t0 reoiociy1omt aivo t t2xo(o nydap nlieilsf Duaxroou4aeeomictld mDranvp;t0trenif oatomDeanvo (0 rxoxr3nudamtemnvi t a2rmxrpnu0tptnifeiytfmDranmp;t0tltrmrciytlateai i;(  rtrxo ny1lltemfcia(fa2uau p;t0alx mieildfa rau ont0tltoiocta1omteanvs s)s2umxo oudaptnlfetl() 2urxm ou4aetoio3iasfa2emn s;u0 lxrxocoadlm rlu o;t0sruoiopou4alen nvs tfs2uaur ;t4olx moctltfmDel( s (4tlxnifciotopD lu slt)srtmxo3no4omtemieilt)sDuau  nt1apto i3iyd s2emn s;u0 rtomf3io1oa raivo s t2tmimpiodom n nvsl( arur(mooo1alxomietadfsDeln o (0aetnxrcoo1om  lneols0srtmiopoo1lpt mics tf rrmu p;t1tpeo ociydlm2eaums;()trenxocoodfpDelu i ( sexoim nydlpenlfctl(f 2ra(root1aleniiciysls um(vp t0alxnmr3oy1fpte ivs;t srto(o3no1lp eliei t arraxronu4aex iiciyt a2el(mo;()texnxr3oydopt  uesls s2tm(mpiodopen feslt)aDtm( onu4teto ieiad m2ul(mon()texrxf3ta1fa rln s;s0srxrir3no4ope  nesat)s2umu ono0apx ioeiatlsDeln o ()texnif to1oa eai i t trxoxr no4apeelnct ( srur(r ;o4ole iieias mDem(vp;(4 ltoxf iatfa elnei;t t2uo(m3no1lpt lnetl()arua(moot4aeeoioeiydfs ul(mp;t4 rtomocoydfmte n slt0 2xo(r3nudlltnlictas)a2rrxmo;o4apeo f3iasfsDeanms u0 ltrxfctodlp rauvi;( srto(o3nu1op e nctls)sDtmx p;t4opxomiciatfs uanmo t)arxrir3iotfp rlu ilt)trxmim3ny1lmtn fcslt  2ururono4oexoifciasfa2rmn p;()trtriocoa1oate nvol(  rtm(o nu4amtnlnetlt)sDumxrpoo0opxnioctysla ea(mont4texoif ootlmDeau s (  rxo(r3iydaltn fvsasfs2uaurpno0aexn icild a2ul(mo;t) renif oatlp e ueo t0trtmiopnudopeelfes (f 2raumoot4aptn ociatfmDrmu s u0arxnxo totlat lu o;t)teurxr oodal e fciasf ruax o;t1aptoiietytfm2ea(vs;t4aexomrcto1fpDraivo;s  etm(r3oudll elicsl(faDra(m oo0tpe miciad mDra(vo t0tltoxo3tytop rli ol(  rumimpiy4llen fctlt aDtr(  ;u4olto fetlt mDuanmo u4tlenifcoy1oate n o () ruo(r ny1lmt  fvsa()sDtrumpnu1teenmo3iadfs2ul( p;(0alxrmr ia1opD  nvi t0t2urxr oy1openmicsas)artmump;u1tetnmfeildfs ul(vo (4 exomrciadomDrlnvol()texrirpoydlltemietat) 2rr(mono4teenifcildfa uauvs u) etnircootlmDelu o s  eur(o3nu4am  mfcsl()artaumo;o0ale iiciysfaDum(mp;u4 rtoxfciydfmD lueo t0trtrim nydop n nci s aDrmur ;o4tpt mfciltfmDul(vs u0 reoir oadlp   n i;s)seuoiopoodale  ict t)sDtaumono0tlto o3iat mDea( o ()artnxf3iatoaDranvo;(0t2trim3oodlme lietls  rtmxr ;o0apxn feiad sDulnvsnt0trtomf iydopte uesls)s2trxm3iu4lm  mfciat)sruaxro;o4teenif3ilt m ea( o () eeomr oodfa elnvo s  2xmxrpiu4om   ics () rua( pno0tex moeiyd a2ra( s;(4 exoxo3oadfmt  i olt0sexrimpiu4lm   ncs ()sDuaxro;o1ale mieiltfm2um( o;u4artomf3iadlpDe n il( s2uoir oo4ll   neia()artmx  no4tltn o3tlslaDul(vont0 lxnmf3iydlpD anvi ( trto(m3oodapenlies sf rum(m ;o0tet  o3ils sDranvsnt0teerif tytlptean s;t0 etrxr oodam e ncs t)arurxrpou0apt ifetysfs um(mo u4trxoir3iatfptrli s (0 rtoxm ou4lpen fci s a2tmump;o0aleoifciytlm2uauvp;() eerxf iatlaD ai s;s0truoxrpiy4lm elivia(farumu pnu0opxo oeiytfa uanvont4alxrxrcoa1omtelnvi ()s2trio ny1lmee fetl(  Dtmur ou0olxnmo3tld s ul(vsnu4aeeoxr to1laDrli slt teuo(r oy1openlieiatfsrrru oot4aex io3iysfa2rmu pnt4artoxoctadfa eaieo;s seuo(rpou1al n ieiltf 2tm(r ot0tpt mf3tyd s2el( ont0 eeomoctodlat lneo s seurxo3iudam e ncil()sDtm(rpot4alxnmi3ildlmDrm(ms t0teeomrcia1oatrauesls0 2trxo ny1al nlfvs sf rta(moou0alt  fetat a2elnvp;t0altnmociadlmDr ueo;t0setrir nydopeemfvtlt a2rm(ronu1aee  o3iatla ea(mpn()texrifcoytoat  ueils)srumim3io4lpee nct t) rrrum ou1alx mfeiytla uauvo;u4altnif ia1om e uvo;(0srurxm no1ll e ies tf rrrxmoou0apto o3ias s umnvpnt4tltomo3oadfa   u i (0s2urxopnu1om nlfvtl(fsrurxmoot4tee  oeilsfaDrlu s u0 exnmo3io1fp  livs t0 2tmimpiu1opt lietas) Dtrumpnu4tle iocild m rl( p;u0alxnxf3oadlm   ieolt0s2urxm3nodamt lfvtasfarrm(ro;t1tex  fetat m umums t4 etrmfciodfm eaieols0 2um(m oo1lm n fvtlt) rrrxro;t1tpt mociatfs ea( o;()tleoifcio1opDraneo s srtm(m3iydoltnlnesa() 2taxrp;t0aexo fcilsfsDrm(vs;() eeomfcty1oatr ieils texoxopnu1lpt lici s  2taum ;o0altoifetatla2rlu pnu0 exomr oa1omD  nvs (  2xmxo3nudll n nvtls) Duaxmpnu4teen oeiyd a2umnvs;(4 rtnxr tadfpD  u o (0 etoxm3oodom n netltfartmxro;o4oeenmfeildfa2ra(ms t)trtnxo3oo1oa rlu s;s)tetrxr nu1ll n ieil() rrauroou4tleo ietldlmDelump;t0 eeoxo3ootfm rli s;( trxmim3oo4lptelfes ( a2rmxmpno0ale mociat m uan o;(0 exrif3oadfmt an o;t teum(opno4ope mncsas) ruau pot4tlx ifetlt mDrl( p u4tlermrctatfm ranes s0 exm(o ou4ole lictat) rurx  ot4apeniociaslm ua( p;u4 ltrmocio1omD auvsls0 rto(r nydameemfct s s2taumo;t1oeto i3tydlm2rlnvp (0alenxoctydfa  li i s)s2trxrpoydll elfvtl() rumxmooo0tpenifeiyt s rauvp (4 exnmo to1lmtr iei ()s2xr(m no4am emnvi sf 2rru pou4aex  fciysls ulnvon(4trtomfcia1la rli slt)sexo(rpoydolt  nvils a2rau o;u4ape  ieiyt mDrlnmpnt4 etoif iy1fm  lueil(0t2xrio3oodaleelfvsa()s2rrxront1apx  ociytlaDua( p;u4tlxrif oodlpDrlnvi s) ruoio iy1lm nmfctls)sDuaxmpoo0aee mfciltfs2umu s;t4tetoxfcoy1om  lu o t0 2xm(opoy1lpt  fvt ( arum(mp;o1apt ifeildls2ranmpnt) lermf3ta1lm  lueslt0 rxrxr3iy1op nlnet t s2ururo;u4oexomo3tytfm eanvo t0tlerxfcta1fmt au o;s trxmxo oudlp elictasfarraumono0tetomociyt m2ean p;t4 lxnxf oy1la  luvo t)seum(m nu1lmenlnct ( aDrm(monu1olxo fciat sDraumo t)aleoxf3totlm   i olt0sexr(m3iu4ole  fetltfaDtaurono0olt  octltfm eanvsnt0trenxrciatlpteau slt0 2xm(r oudlp nmfcs (fs2trx  nt1alen f3iatlsDrmuvo (4aetnxf tadfaD lueo s  rxo(r nu4lp  mfeilt s2ururpnt1aeenio3iytla elnvo;(0alxomf totoa eaueolt0 rum(m iu4olte fvias) Dua(mo;o1aetoii3iytfs eanmo;u0treoir3oo1fmD lnvo;() rtoio nodopen nvi ( sDra( ont4tlen octldla2rm( o (4teeoxfctatoaDelieo s  2tmxo ou4al  lneslt)a2urumooo0oee ioeild aDuanvs;t4 lxomr oodoa r nvsls0 2to(r iu1oltnmict tfs2rmxrpot0tpe ii3ilsfmDran o (0trxoircoodlmtr u s s0setrxr3nydam emnvs t sruau p;o1aexo ieilsfs2uln snu0arxnmrcoodla raiei;t)setoxo nydale  nvt t s2ur(rpnu0tleo ocildfs2rluvp;(4aexnxrcio1omt an o ()t2tmxo3iudlptnmfvtlsfsrum(moou0teeomfciatfs2elums (4aleoifcta1fpDe u o t0t2tmiopoy1ll e nvi t)aDurumo;t0tlt ioetld sDrlnvp;(0trxnif iadfmtelnvsls s2urim iydol   fvilt  Dtrxrooo1aeeniiciydlm ea( o t0arenif3oatoatr ues;s0s2urxr3ny1ap  mnet s)srrrx ono4optomfcilsla ua(ms t0 reomo oydoatr i s s0texmxo3oy4lpenlivi s)aDrmu onu4tee  feiytlmDuanvp;u0 ltoif oytlpD  ieo s)texo(o oy4omte iet t srumu p;t0ape  o3ildls2uanmo;t0tetoxrcoo1lp  lnvo;(0s2xoim oodomtnlivi () Dra(mono1apt mi3iytfaDrmuvs u4areoxrctydop  lnvs () 2xm(m ny4alte feiat)sDrm(r ;t0oet miciatfaDeluvo (4arenmr3oatfp   n o;t) 2xmio3oy4ol  mnvsas aDrrxmont4ale  oeiltla2ra(vp;()aexnircio1lmtrai olt tetrxr oy1alen iesat)a2rru poo0oeeniiciyslm2uanms;t) ltomo3todfpD  n ol() 2xrxopiy4optelfcsl(f 2uaur ou1tpxnifcildfs ea(vsnu) eerifcta1oa eaueol( t2xr(opio1lmte ictas  Drrxm ;u0texniieiyslsDranmpnt)arxoircta1lmD  n sls srtmxr iy4lm nlfesa(faruaxm oo0oet iictysls uan o (0tltnmrciydfptr u i;(0trumirpoydopeelncs t  Dtmx pot4oltomoeiytlm2ulnmo (0tltrmf3oytfm r u s s  etrxm3oo1lpenlnci s) Draurpno4tlenmoeiyd m rmums;(0 exnif to1fp e uvsl( s2urxr3nu1opt  fvs s)aDumx ont0ape  f3tldla2el(mo u)alxnmocoo1om rlies;s truoxr oo4lp  lncs ()aDtrxmp;u0apen o3iatlm eau pn(0texnir todoatrau i s0t2urxm iy1ap  livil(  Duru p;u1tlenifctls a2elums u0alxrxr tydlateaivi;( t2tmio3oudlptnmivta() rrmumono1olx  o3tyt s2um(vp u)tlxoif iodlp e i s;s) exm(opoy1apt mfciat)srtr(rpnu0tlx mociyd m elnmo;t)arenxr3ta1fpDr uei;s teum(mpny4amt  feslsfaDrr(rooo0tpt  i3iysfm2umu s;u4artoirciytfa   ieo;t)srtm(r iudlmtn fvsa(  2umx oot4tpenmfciys a2umump (4 etrxf3oydlmt an ols sexoiopno1ol nmfvs () rrr( o;o4teto fciytls2umn p () renxo3iydoatrlneil()texr(opnudllt lncsas s2ururp;o4aexnii3iysfmDemu p;() reoxo ta1laDeliei;s)t2tmir3iu4apeemfeslsfa2umxr nu4tpt ioctldfa elnvpnt0 rtoxo totlat aivs;t t2xr(m oo1lme mfet sf 2rax poo1tpenmoctld s2rlnmpnt4aeerxo to1lp rauvsl(0 exmxrpou1aptelivta(fa2ta(moot1tex mi3iys mDum( s (4tlxrxf iy1lpD  uvi (0 rxmxo nudlp  lnei s) 2raur ;u4tlen ieiysfm2uluvp u4texoxocoydoaDeanvi s)teurim3oudlmte ncsatfs2tmurpou0opeoio3iasfm ua(vs;t4trtrmrcootfa raneslt  2urxo iy4am   feia(  Dumu  ou1oetnmi3iasla raumo;t0 exrif3ta1om   uei;t)sexmio nu4altelnvt t srraxrpoo0tltoii3iydfmDumn on(0tltoircta1opt  n i (0 rtr(o iodlpenmics t)a2tmxm nt1olxo icils mDeln o;u0aexoxo3ootoaDr uvsl()teto(m iodal e ics t) rumurooo1oexnio3tyd m2el(mon()tltoxf tadla rln o (  ruo(rpoo4aptnmivsas arrmumpou1tlenmfetls a rmn o;t)trenmrcoodfmDe ivsl()t2to(m iy4ole lneil()s2rm(m ou0apxomi3tatfsDrlnmp;(0alenmr oy1oatrln ols trurim3iodlltelnci ( srrmxronu4apt mf3iyd aDul(ms u4teerxr ta1omt an ils0s2tm(m3oy4ole lfci s) rrax  ;t1oee  i3tadfs uan ont4tetriociytoptrli o;s0 rxmim oo1lpeelfes s  2ta(rpno4oexnmfeiysls emump;t0texnifciydlaDelu i (0trxoir nodape lnvs ()aDtrur ;t0alx  fetyt m2raumon()artnmrcoo1lp r uvi t seuoiopoudape lnvtls)a2ra( o;t0teen iciasfa ul(vonu0 leoio iy1fpte nesls srum(o iodom n ietltf 2umu oou0ole ii3tysls2ea(ms;(4texrxo oadlpDr n i t seurxm no1lm emicils)s2rmurpot1open f3iydfmDean snu4arenir iotlpDeau ils)setrirpnydolenlfei s)aDrrxmono1opxnio3tad s2emu sn(4 etoirctytlat aies;t t2tr(o iodaptemncsls srtmum ;o4alt ioeiyd a ra(vp;t)alermrcoy1oaD lues;t0srurir3nodom nmnet tf rur(  ;u1alxn feiadlmDra(vo;t0alenxf oa1fm   ivi;()t2uoxopnudlpee ncsa(f 2rruro;o4opxn i3iasfs em(vo;(0aeeoir oa1fpteau i;s  etmir3nudap nlietatfs2urur ;t1opxoifctyt aDul( pn(0tetnir tatomtraneslt0sexmxm nydlpen fvt (fsrtaxmonu4aee if3tysls2rmump;(4tlxnir3iadfa e n s ( texmxrpoodllte ivi tf rtru  ou4alxoiictld s2emuvs;t)tltrmrctydlpDraies ()trxrxmpio4ap emnct (f 2rmum ou1alenmi3tyt s ul(ms;() rtoxr iytoateanei t srtmir3ou4lp emivsa(  Drrumpnt0tpxnmi3tld aDumnvo;(0 rtrmocty1fmtrai o ()seuo(m3iydapte nvsl( a2ua( p;u4ole miciydlmDuanvo;()aeeomociy1om eli s ()trxoxo3iudale  fes t sDurxm no0apx mfeildls2ulumon(0aetoircoytomt  i olt  eurim oodalte ncslsfartaurpot1apxniiciadfmDeaump;u4 ltrxrctatlm  li o;t  2tr(m3iodaltemfcia( arur(mpno0oex  i3iyd aDua(vs (4tetoif iadfpte ueils  rtrimpno4ll   iesasfsrumum ;u1oet mociasfm el(vont0trxrifctatoa e nesl(0sexrim nu1lm n nvslt  rra(rpno1openiieiasfa2ra(vp u4aexrif oydop r u sls0trur(o ny4lltemicsat)s2tmu  nt4tpeomoctadfmDel( s (4teermrciadom rai o;t trxrim3ny1lpe mfvt s)sDurxrpno0opeo fctysls rl(ms;() exrio ty1lmDr ueol() rtmio3iy4am  mnctltfs2rmxmono4ole moeilt aDrm(mo (4tetnifcoy1fmte n sls)srum(o3oy4om n ics s a2rrum nu0oee  i3iysfa2uluvo t4 rxnxocoodla r ies;s  exrxr iydoleemivil()srrmxmpou1aetoif3iad m rl(vp;u4 lenmr3iotlat anes (0 2trir3oodlme  fctat arrmumooo1aetnioeiadls2ea(vo () rxnmf3oodfateauvsls)t2urir io1lleemncias)a2umxmp;t1ope  i3iyd a2ranmonu0tetrxf3iytlptrlueo;s)t2trim3iodolt  iei s srrruro;u0oleo oetlsls ua(vo (4artrxf to1fa eli i;( seuo(o3ou1aleemnvil() Drr(r ;o0apxniictlt m elums u0artoir totfp   uvols0t2umxrpoy1oleelnvi () rrmuro;t1aexnio3tyt a eanmp;u0 eeoif3iodfaDe u o t texmir iodoptn ieta()a2tmxm ;u4aee io3tldls2rau sn() rtoxf tytoat  i ils)teto(rpnudaltemfvsas  Dtauro;o1tltn ictydla2uaums t4tltrir ta1opt luvs;()sexoxo3iu1ole lietlt artau  ;o0olt mf3ildlm ra(vo;u0artnir oadlm   n i;s0srtoxm3oo1altelncs s)srrm(moot0oexomo3tatls2ranvp;(0artnxf io1op r ueilt s2trxm iy1lmtnmicslt)sDrm( o;o1texnifcildla umuvo;u4 lenxfcto1fmDeanvo ( setmirpiu1ope lneil()aDrm( pnu0aee mf3iydls ulnvpnu) eeoxf tytop eaneolt0t2trxm3nudop  mnvtltfsDtauroou1opto ociydfa ua(vp (0tltrif3oadfmteaivol()t2tr(opiy1altnmfvsat) 2umxrpot1tex  o3tat a2eaumpnu0alxoxfctotfateaieils0texrim io1lp  lfesl(fa2tr(rpnu4aptnmieiyd s2rluvo;(4 exnxf3ta1fpteauvolt  rtm(opoydllee feia(  2rrxm ot4aeto o3iasfa2ulnms (0aexnxociatlm rli o;(0 2umxr3ny4lptemnvsl(fs2tmxmpnt4tleoioctyt mDrl(vsnt0artrmo todop  ai sls)srxmxo oy4ap n ici tfaDtmur ou1tee io3iasfm2rmn pnu0aeenxr oatoaDeaueols)teuoim oo4ll emfci t) Dra(ro;u4tex iiciadfm2umn p;t0 eerxr3oadoa eaivo (0 exrxr3ny1alte fcias)a2uaurpnt4tltnii3tat s elumo u0aexniociytfaDe uvo;t0tetrxr3nudlm nlfetlt)srrru  ot0tpxoii3ils m2ul( p;t0altoxo3oodfp elnvsl(0s2tr(o3iu1apeemfci (f Dtrxront0oexn feiaslmDran p ()alenxo3oodlmDr i ils sexmir3oydopt mivsa(fa2umxmp;o0opxnmietldlaDulump u)aeerio ia1op r u ilt teurxo3ou1omeelivsa() 2tmx pnt1texnmfctytla emuvo;t)trxnir tatlm   ueil()s2tmxopiu4op  lieilt) rur(r ;u1aeenmieilsls rmuvs u4alxoxfcoa1opDrluvs;s0srxo(opiy4opeemfctasf rtrumo;o0oeeomi3tysfsDrlnvpnu)alenmf3tydfpDeli i;(0 exmirpiydal  lfvi (fs2trur ;o0aet  ictytlmDelu p;(4 eenircia1lm eauvo t)texrxr oo1aptemfvsas) Dtaurp;o1openmfctat a ea(vsnt0trxnmo oydoa elnvs;s)s2umxo iodaptnlfci t sDum(mo;o0opt mociltls rm(monu4tltrirciotfaDe ies t)teuriopoydlmtnlicsatf rrmumpnt0aet mfciysla2rm(mont) lxomrcoydoatraieil()s2xm(opio1apeemivtltfsDuaxmpoo4aptn i3iyd m2eaums;u)aeerir3ootlm rlivs () exrxm3ny4omtelnctl()a2urxr nu4altnif3iyt sDran p;t)tlxnmf3tydlm elnes t)sexo(m iu4ap emieta(fs2uax oot4apenio3tasfsDea(ms ()texrio ia1lmtr uvi ( seumxr3oodaptn icsas)aDurxmo;o0teeoio3tasfm2ea(ms;t)tetrxf3oo1faD auvol(  rtrim3nudal nlieias)srrm(ront4aleomoeiytfa eln p;() rxnxf3to1laDeaivsl(  rxrio3ou4opt lnctatfsDtmuront1ope if3iys s2uau snu4aeerio3iotopD  ivo ( t2toirpoo1op emiei (farra(r ;o4tpenio3tas a um(ms;u)alenio iatlp rliei;t0seumxr3ny4ol nlfet tfsDtm(m no0opeomoctytfs eln o;t4altomf3io1fp rli s;() rxrxmpiodolte nvia()s2um(mp;o1tpt  icilt s emnmp t)aexoxfciodop rlu o t) ruo(m oodape  iei (  rtm(  ;u1oeenioetydfaDul(mp t)trxoif3tadoptranvolt  2umxr iu1oltnlictls)sDum(mpno1alxo fetaslmDuauvpnt)trxnxocoa1fat ln s;(0srtm(mpoo1omeemictlt)sDtmxrooo1oeenmf3ild aDua(monu)alermo to1opt  iei;t0t2xm(m iodlleemfvt tfsrrr(mo;t1opxnmieiytfm2emums u)texrmrctadlp ran ols0sexmio nydomenmfviltf rumu  nu0aet moctasls2rlnvp u)artrxrciy1opDe i slt0t2xr(rpoodope  ncia( a2rrxrp;t0oltomfctasfm2ua(msn()tlenxr iatom eli slt trurxmpoo1lp   nvtltfarrrxronu0tpeoifetysfa rmumo;t0 exrmr ootfa rli s (  exoxr iy4alt lnetl(fs2umxronu4olxomoetyslmDrm(mp (4trenio3oydla eanes t0 etm(r nodopen nvil() 2um(rpnu1oexnmf3tls s2emnvon(0aleoxr3oydlpDranvolt  rxrxr oo4optnmfet (  Dumumooo4tee if3ild s2emuvpn(0 leomfcio1fmteaivo s0s2toim nodalt micils artaumpno4optn i3ild m2eluvo (4tlxomr oatlmD an i;s0seumimpnodamen ics ()s2tm(rp;t4apx mfetls m uln p;t4trxrxr3iodlp rln i;s  2urxr ny1al elictltfa2rrxrono0apeoioetyd m2rmu snu0 etoxocootlp rlu s;t setoxm iudapenmnesas sruaumpno1oltn octat s umnmp;(0trtnircoa1omtraneslt0 exmxm3oydam e net s) 2ra(mp;u4olx  i3tydlm2rmumsnu4 lenxrcio1omDrauvsls)t2xrxmpno4opeelfvsasfa2rm(r ;u1alen fcils m elu on(0 etoif iadlaD  uvil(0sexrxrpou1olen ictasfartm(mooo1olxnifetas sDel( o (0trtrirctodlpDr nvsl(0 rxrxm nu1lp  mivslt) rta(rpot1ole ioeias sDrmuvpnu4 eermr oodlpDeauei;t) exrir oo4ap  lfvtlsf rraumo;u1tetoif3tatla2eau pn(0tlermo3oydoa  ai il(0 2umir nu1lp n nvt sf rtmxro;t1tltoifeiyslsDel(mp;u4treomrctatop raieol( sexrxrpnodame  fcsasfarrax pnt4ape mo3iyd s rluvsnu4tlxoio3ia1fptr ueil(0teuoiopoo4ame  ncs tfaDururp;o1apeoif3iydla2ua( snu0tlenxo io1fp  lu i;t  2umxo3nu1op e icslt  Dtaumpot1oet mieiytfm2umnvo t)aetnmrctatomt auvols)t2xoio iodlpt mies t)aDraur ;o1olxomoeiyslmDul( s u4 ltnxr3tytfat lnvo s) ruo(opiodllenmncsa(fsDuau  nt4teenmfeildfaDum(vsnu4 reomr3iatlpt  u s;( tetoxmpoo1ome mnei (farrmx  no1tpxn fctadla2umnmp t4 rxrir iydlaD  ivo ( sexm(r ou1lptnmfet t aDrmxrp;t1oetnmietlsfm ul(mpnt4teerio totoaDr i ils) etoxr iy1alt  ies ()a2rrxm ;u4alxnii3iltlsDeaump u) rermo3tydfm eluvs;(0sruo(o nydlptnmnvils)artmu oou1tltomieiasfaDrau sn(0tltoxo3todomDelivils)tetmim iudape mnct s s2urxmono1teto feiydfsDrmnmp;(0 reoxocoodoaD auvi;t0t2uo(o3oodamen net s)srtruronu0olenioeils aDrmn o u0texnir3iytoptrln sls)teuoxo3oo4llt lnet s)sDrmxr ;u1tlxomo3tlsfa2uan p (0 ltoxrcootlm r u o t0trumxr io1lme  nviatfa2tr(  ou1optnmi3iasla eanvo;t) etrxfctadlat  uvils0 2xoxr3iydlme  ict s a2rrxmpou1oetoioetasfa rmums t4texrir oatfmt lu ols s2umim3oodlltelnvil()srrrxmoou0tlx ii3tatlm rmnvp u0 lenxf3oydlmDraivs;( trtr(opnu1optelfvia( sDtrxrpou4oex ioetld s2em(mpnu0aetrxr3oatoa elivs;()teuoio3oy1lmen fvt sf rur(rono1tltn fetas aDumumo (4 rtomf3ia1fpt  nes;t s2xo(m nydomt lictls srumxmpot0aeenioctysfm2eau o;u0texnif3ia1fa rai o s0srtmimpoo1open nct ()aruaxro;t1oet  f3ild m2emn p t4aetrxoctotlp rlueo t)t2um(mpno4opeelfesls) 2trxrpno1oltnmieiltla rm(mp;(0teeoio oo1fat livo;( srtmiopou4optelietl( aDrrumo;t4ape iociysfs2emu on()arerxo3ta1
\ No newline at end of file
@@ -0,0 +1 @@
+neo ( trumim oudlptnlneiltf rtrurpot4apen oetysla umuvp t0 ltoxf3iodomDeluei ( texmimpiu4lpe mietat)a2rmu  ;u1ale  fciaslsDum(ms;(0tlxrmociotfatr nvs;s0seurir nydlmtnlict t) rrrx o;o4aex miciys s2umnvpnu0 rxoircoatlmt aueolt0trtmio3oy1apt  fes sf 2ra(ronu1tltoiieiytlaDem(vsnt0tlxrxr3ia1fmtr i i (  exrxopny4oltn nesls  rtaxrp;t4texomo3tydla ra(vpn()teenxfcio1fpt lnvo;()sexoio nu1amtn fctls)s2tmxr ;o4opx mo3iat mDeau p u4aexnmrciytlptrlu i t teumxo3iydlptnmiet (f Dtmx pnt0aptn f3tlt m2ea(mo;(0alxomr3iatfpteaieo;s0texoio3ou1lltemict t  2ur( pnu1tle moctasfa el(mpn(0 exnmociydoaD  i s;s)trumir oydape mneia( sDtm(roou1texniietasfm rmu snt) exnir3tydfa r nes;t) 2xrimpiudome mfcs t s2ur(mp;u1tlt  ictatls2rauvp;u0treoxocio1fm r u s;s seto(r nu1ale  icta()sDtm(roou1tptoifctldlaDulnmont)arxoiociotlatean il( s2xmxr ny1amenmfeia( aruax pnu0tetomieiysfa2emn snt4 renmfctytopDean i;s  2trxm3iy1alte iesas) 2rr(moou4aexo ociadlm rmnmsnt4tlxoxfcoodfmt  i i s0s2umio3nu1om elivta()s2trx pnu0opeo ieiytls rluvo;u4tltnxfcto1lp   uvil(0setm(r nudapte neias)artm( pou0ape io3tyd a2ranvonu4tlxoif3ty1fa   ueolt setr(m io1apt  ietasfsDrmu o;o1tlenmieils s2rm(vp;u4tltriociatomD lneo t t2umiopoy1lltemietl()srra(moou4tpx  o3tatls rau pnu)aeerxr oytomt ln i t t2uo(r3nu1altnlfvs t aDua(  ;u0opxomi3iadfsDum(mpnu4 lxnif3iydfp  livs ( teumim3iydomtn ietas) Draxr nt0tpeoiociasfs2ea(ms u)tetrxr3oodfa  aivo ( sexoxo iu1lmtn ncs () Drr(root1tetoifeias mDrmumont)alxrmoctotoaDe ies s0srtmimpno1altn nctas  2ta(rpno1tlxnifetatfmDrauvon() rxoio3iadomDeauvi s) etoim3iy4alee nciat  2taumpou0aeeoif3ilt m um(msnt)arxrio iy1oaD  neo;s0 eumxm3oo1lptn ivil() Dur(m ;o4teenmo3tasfm2emnvs;u0 lerxo3oydfat  n s;( srumxo3ou1olt mncsat s2rm(monu4oeeoii3iytfsDum(mp t) leoio iy1laDelnei s0 exmiopnodam nlnci t srtauro;o0ape ioctydfsDemu snt)artrxo oadopteaieo t0srumxo3iudam nlnes s)sDtmur ;t4oltniieiadfmDeanmont4 etomo3ty1omt  ivi;(0t2trxo3ou1op eliei tfsrua(  ;u0alt if3ilsfaDrlnvsn(4 rtrif3oa1oatrauei s s2xm(rpnodllenmiei t sDrrumpou0olxnmfeiasfaDel(vp u0 rermociadfpD  nvi;(0s2trirpou4ame  ncslt  rtmuronu1ale  oeilsfm2rmnvs (4tlxomfcoodop rlueilt trumio3oo4amtn icslt)s2uaumpnu1oexo o3tys mDumums ()aexoxr3io1opte uei (  2tmim ou4ll nlnes (  2raur ;t1tltn i3tat m ra(vo;t) reoifcia1lmt li ol(  rxmir iu1lmenlnes (  Duaxrpou4aptnmfctatfs um(vs u0 eeoifciadlm   nvo ( sruo(m oodll  mnvtl( s2tr( pnu0tlt  fciaslm2eanvon(0 etoio3totlmt an s;s  2trxr iy1ll elnvsl(f rrr(r nt0alt mfciytfmDuanvp u0 rtnifciydfatean i s0s2urio3oo1omte ivi s)aDuaxmpou4tex  fctlsla eaumo;(4altoxr3tatomte n s (0seurxo nydamenlnciatfsDtm(r no1apxn o3tatlm emnmsn()aexoxo3io1fmD  uvol(0t2trxo oy4al e nvtl()sDtr(  ;o1opt  f3tys m um(mp;t)altnxociy1laDrlueolt0s2tmio nu1llenlfct sfa2umum ou4oee moctlt a eluvsnu4tlxnxo iydfa rlnvsls)teuoiopoydop nmivil()aDrmum ou0ole ioctadlaDuan s;t4altomf iodlmD lieo s) rxrxm iy4apenmicia() 2ta(mooo1ale iocilsfaDemn sn(4trtrmr iodfmDrluei;s0 2uoxmpnydoptelietl()arrmur ot0ope  o3tlsfs uauvp ()tetoxfciydopte nvo (0srxmio nu4lmte fvi t s2rmu pot4olx  oeils m uanmsnt0arermf3iytlpD  u o;s texmxm3iodlp nlfetls)a2urxmpnu1oexoii3iys mDumnms;t0alxomfctatlpDe n ol( seuoim3ny4om nmnei s sDtm(  ot0tlxn ieiadls em( pn()aeeomrciydlm elnvsl()s2ur(r iu4llt lfcslsf rraxmpou0tltnmictydlm2umnvp t0 ltrio io1fp eauvsls)t2uo(o3oodlmee iei sfs2tmu  ;o0alxomoeilslm2el( o;() rxomf oy1fa eli i s)sexrio oydlmeemncsl(fs2taxrp;o4tee  fetytlaDem(mp;t0trermo tatop  ai s t)trxoim3ny1ol   ncsa(  Dum( o;u0alto i3tys m2rm(ms;(4alenio3iytlatr ueo ()s2xr(m3io4aptnmnesa(fs2trx  nu4tlt ioeilsls2emu pn()aeeoxrctydfm eln ol()s2tm(o ny4omtemncslt  rurxm nu4oetomicilslaDuanmo ()tleriocio1fmD luvol() exoir no1op elnvt () Drax p;t4tptn oeiatfmDrln p u0 ltomo ty1om rlivo;()tetmir3oodole mfeil()a2tm(m ;u4oeto feiys m2ra(vp;(4 reoir tatfate u i s s2xm(o oodlmenmfetat)artmurooo1texomfciyd sDelnmp;(4trxrxo to1omDe n s;(0s2uo(mpou4omtnlneil(fsDta(r oo4apx iictytlaDeauvs;t4alxoxf to1lmteai ils)t2uo(rpou4op nmfvs tfaDraumonu0oleomieils s2elnvpnu)aexoxf3iatfa r u i;( t2uoxmpno4lmeemneilt)sDrmxrp;u4aexo o3tltls2emums;t0texoifcoydopt auvilt)teuoirpny4optn nctls)sDumxmoou1apxomociadfaDeauvs;t0alxnxf3io1oatr ieo;s0 2uoirpny1lmenmiet tfsrtmumpoo0ole  f3iltls2em(vpnt4trtnxrcia1faDr n i;(0 etmim3iudopenmivsat) rum( pnt0apxoifetad s2elnms t0tetomr3oodomDr nes;s0sexoio iy4lmt mnvi (fsDta(r ;u4apenioctas a el(mo ()trxrir oadlm rlies s0s2xoxmpno1lle licta()srrm(m nu4tptoii3ias aDemnmo;(0aetnmfctydomte ieo;(  2tmxrpoy4lpt lics ()aDtm(mo;o0oee io3iaslm em(monu)trxrxf3oo1lmDelieo ( tetriopnodlm   iciltf rrau pnu1texoifciyt m emn p;()tltoif3ty1op elu o t  rxoxr ny1om elfctasfaDtr(m ;o0tet  ociltfaDumu pnu0tltnir3ty1fp  auvo t trxr(r no1om n ivtltfaDrmumooo0apx  f3iat sDuau s t0 rtomr3iodlm eanei;s seum(opoudlmeemnctatfartr(mont0oeenioeiydfmDrm( o t) leoifciotoatrlu o;t0truo(o nu1am elncsltf 2ur( oot1tet ii3tys s2uluvp t)teenircoytfpDrlu o;(0srxrxrpoo1ol e fci (f rra( o;o1oexnmo3iys s2em( o;u)texoxrcoy1fat an s t  2toxr3oo1op nmnvs sfsrra(m ;o0aex  fcilsfs2ul(vo ()aetrxo3iytomtrauvols srxo(o3no4oltnlfci s  rrau  nt0oee  ictlslm rmuvp (0 eermf ty1fat  uvols t2ur(r iu4ope  fes (f Dur(rpno1opt  ocils s eln on()areoir iadfmDeauei (0t2umxm3oudlle  fctl() Dururp;o0opeomieiltfa2umnms u4tltniociy1fptr ivi t)teum(o oodlm  lnesl(f Dumur ;t0aexnmociydla emnvs () ltnmr3oa1omDean ilt0 rxm(o no1lp elnvsl(faDrau o;o1aet  i3iytfsDra( p;(0 etoir oy1fm eluvi;t)trxoxr3iu1ameemivils) 2uaxmp;u4oetn fctad s2ranvont0aeeniociy1lm e nvo;t0 rtoxm oudlmenlneiatfaDtaxront0oetoioeiyd aDea( sn(4alxomocia1fa   uvs;t0s2xm(rpoo1op nmncsl( sDtaumoot0tee  ocias a umnmo t)arxnmf3iytoaDeaivi s0t2xmirpnudal  mnesa(  Dtaxrp;u4tlen fciad a um( snu)aetnxo3oodfaDrai i;()srur(o iy1lmtemics ()aDum(r ;o0apxomociasla2ua( p t4texrmf3oytlmD li o;s) 2xoirpiudape mivs ()aruau ono0tlxoif3ild mDulnmo;t) lxrxo3totop  ln s;s  rtmxo ou4op nlfcslt)a2ta(r nu4tlxnmfciydfm2emumon(4tlerir3ia1lat auei;t)t2uo(rpiu4omenlivtltf rrrxmoot1oleoifeild aDrlnmon(4aeenxr totlm r nvslt) rtr(m3no4optn nvt (f Dtruront1oleoifeilsls2eluvp u0 lxnmrcoatoa rlu ols t2uoxm3oydap elfvtl()arrr(rooo0apxnifciatlsDul(vo;t4tetoxo ootlpD lieo;s)t2xm(o3iu4lptnmnvsa(fsrta(rono4alt mfeiyslm2uau p;t)artrxrctodfp eln i;t0 2tr(m3iydal  micta()s2umxmpou4oexomf3iadla2ranms t)aetrxr ta1fmDrln o;t) eur(r3oodlptn ivilsfsrtmur ;u0olx ii3ias m rln ont4artnif3tatomDe ies s)t2xo(m3oo4lm n icsat  rrmx o;t1oee  i3iytlm ulnvsnt0aetrmr oodfmtrau ol(0 eumir3no1ole  fvi sfsDtax pnt1tetnio3tltfm emn pnt4 ltnxr3oatlaD  uvs t0s2xoirpiy4lptnlnctl() Durumo;u0aptnmfciasls2rlump;u) exomf iatop eanvi;( t2xr(opnydlm n fctlsfsDtaxrpnt1apen f3tlt m2ra(von()alxnif3tytoat  ueo s0 2uoxm3nydlmtnmfeils srta( o;u0ale iociltfs2rmnmp (0aeenxf oo1lat luvi;t0 rxmim iu1llt mict () rrm(r oo4apt mieiydls rmuvo u4aeermf iytlatraivo;t truoir3nodal   fcsl(fa2umumonu1tpxomfetytla eln s u) rxoxr iatom e uvs t s2toxo3no1ll nliesat  rtmx pou4aleoifciatfs umu snt0 reoxo oydoaD auvi t seuo(mpno4ape mfci s s2umuroou4apt ioeiytla2ul(ms (4artnxf3ty1lpt ai slt0 2trxr3ou1apeelieiasf Dtrxr no4oexnmieiyt mDrlnvo;u4tltrxr3oydfpDr n ol()trum(mpiu1ope lfcil( a2raxronu4ape mfctltfs eanvo;()artrxo ty1lp ranvo;()s2umxopoy1am elncsa( s2urxm ou4tpto o3ilsfmDeanmp u4trtrxf3ia1opte uei;( trumio oydam nmieiat s2urur ot4aee mo3iys mDumu pnt) etnir3oatlmtrlu i s0 2xmiopnu4omee fctls sDrrxmpou0tee iictldla ul( s () reomfcootfpteaueolt  2tm(r oo4lmt  nesl( s2tr(roou0tpxn octadfa2ra(vo;t0artnxocoa1opt  iei t)srtmxm oodaleelieils  ruax  nt4apx ifeiaslsDelu ont0tltrmo tytomt  nvo;t) eum(mpno1amt  fesas) rtm(ro;o1aexn oetasfm2rauvonu0trxrxo ty1fa eau o (  rtmir3oy1oleelnvtas)s2tr( onu0oeto iciasfs uluvp;(0 eerxr3tatla rlnvol(0truoxo oodlp   netl()srra(rp;t0ape  fciytla ra( p (0alerif oatlpDelnvo;t sruo(r oodaltn ieia()arurumpnt4tptnmfeilt m2eln sn(0 lermr3oytfp raieo;(0s2ur(r3oo1ome mivi s)s2trxronu4olxnioctyt aDuaumsnu)texomf3totlaDeaueil( setoxr iy1am nmnetas)a2umur ;t0olxoiieiltfm rm(mp u0artnxf tytfmteliei t0s2urxopoy4lltn nvsas aDrmum ot1openif3ils m ra(vo t0alenmociatop raneo ()srtmirpou1amtnmfvil()s2raum nt4aeeo f3tatlmDra( pn()altrxo3iydoa ran s (0 exmimpoydol nlfvta( s2urxmpou0opto oeils a el(mp ()tleomr3iatoptr uvs;t0 etm(r3iydamt mivsl(  Duaxmpnt1tpe  octyslm uluvo;() lxoir to1oaDe n s (0teumxo iy4am  mnctlt)arrrxmpno1aetomfeilt s ran snt)tlerio iydfmt liei;()trxr(o no1lp emicsatf 2raur nu1tlx mfeils m2elnvpnu4 eenxf3oy1lptelneol(0 2xrxopny4al e iet t)aDumumo;t4opxnii3tyd m elu s;u0tleoxf oadomDrlu i;s0 2tmir iu4llenmfes ()a2urxr nu1tpe moetltfs ranvsnu)tlenmr iytlatr ieo t) 2xrim3oy1lp  mietlsf Durx  nu0alxnii3iyd s2ra(mpnt4aexomf oadoaDeanei;t  rtm(r ou4amt micsl(fsrum(  ot1tpx mfetltlm2ranms;u0 eeomf3to1oa raneilt)t2urxm3oy4omenlfcsas  rtrur oo4alt micildfa rmnvs t)aleoxocia1fat  neo;()srtmiopnu1ap n fvt tf rtrxroou4tpeoifctas m2ulumont0 lxrxr3tatlmD  nei (0s2xrim nudol emics sf rrax o;o4texnif3tlslaDuan o;u4alxrxf tydomDe nvsls0t2urxo3nu1lle licil() rum(rooo1altnmietyt sDrluvsn() eenmfcto1fa eauei;()s2tm(r nu4ol nlnetat s2trurpoo4oltn i3iasfs elumo u)tetnxfcoa1latran o;t) rtoxm oodamtnmict ()aDurxro;t4apeoif3iasfs ul( o t0arerxociatoaDeliei ( t2umio3ny1amt mncilsf rtaump;t0alxniietldfa2ul( sn(0arermr3tadfa rluvils t2toxmpoydlltnlfesas)s2rmxm ou4oeeoioctydfaDumu s;()alxnxrctytlp r ies;s t2umxr oy4ape mfviat arurum ;t1apto icild m em( ont4 ltrxo3to1fmDr iei ()texmir iydlmeelietltfsDtm( p;u0oetomieilslmDran s;u4 rermr oa1fmt lnes t sexo(mpnydoltn iciltfs2um( o;t1opeoifctltlsDuluvo;t4 eermf3iydfpDr u o s t2umimpnudomenlivt (fs2raxmpot4optoiociasls uln s;() lenif3ia1fp   uvo;s0t2toim3no4om e fei sfarta(r ;u0alt mf3iysfa2ulnmsnt4 reoifcty1fm eaiei s setrir3io4apeelivtl(fa2raumooo0olt  ociyd s2emnmp u0 rtniociytfptraues s) rtrimpny1olen ieiltfsDrr(m ou4aeenmfciadla ea(msn(4alermf io1faD livs;()teuoxr nudol nlies tfsDuaum nt4apen o3tytfm umnvo t)aeeoxf3oatfpD lu o ()trxriopou4lm emfvsat srurx pou0open i3ias sDra( o t0 lenmf tadlpD anvo;t0 etoxrpou1alt lnvils)aDrr( ont4oetnmictyt a2umnvo t0 rxomfcoytop eanvs;t)s2xrio iy4lpe lnvtat aDtmx ont0tpe mi3ilslm2eauvpnt)tlxomociydfm eluvolt sexmim oy1ll nmiei ( srrm(r no4aexnmi3tlslm2rlnmon() rtomo totfate nes;t0 rxrio nu1olteliet ()srtrxr no4apeomf3iyd sDrluvo t0tlxrmrcty1fp ranvi ()texrir3no1lp elivilt) 2rau p;u0olxnmo3tatfm uln o;()altoxo iatopDelivi t0trtm(o oo1omtelnvsl(  Draxmo;u1opxnmo3tat a ulnmp u4trerifcto1la elieilt) ruoxopoodopt  ivi sfsDum(rp;t4altoii3tldls2ul(mp;u0 renio todlmt li ilt0 rurimpio1lptnmfvilt) Dta(root1optoiictlsfs rauvo;u4 rerir3todlmte ueo;s) exmxo oy4lpe mfviasfsDra( ono0tpt  ieiatlsDeluvs;()tlenxfctadfatelnvolt tetrim3no1altn feilt)arta(roou1tpeomi3iaslm2el(mo;(0 eerif iytoptr i olt0trtoxm3ny4ll emivsatf Durxm ou0apx mf3ilt s rl(vp;t) exoxo totopt an o;( teur(mpiodalte fvi tfartm(m ;t4tleo f3tldls2ran o (0arenio3totfm eaivslt) etm(opno1ame  ieil(faDtau p;u1oet  octytls2uln s;()texoxf3tadopDrlnvolt0t2uoxo3iudom nlict sf rrm(rp;t0tptn o3iat a2eau p u4 rtoif3oadom rlies t  2ur(opno1aptemiesasfsDtrx  no1altoifetldlm um(vo;t0 rxnxfcoytlmDr uei;t0srtoirpnydop emfeta()s2tmx  ;t0opt mo3ils m um( s (0trtomf3todopDeanvslt s2ur(opnu4am n nvils aDtaur ;u4optomi3ilslsDrmu ont4aetnio3oytfatran s t  rxr(r3oy4am  lnvt sfartaur ou4tpx mociat a ulumsnu)altrmo3oydfpDelnvo s)sexm(o iodomtemivias a2uau ono0olx mieilt aDrmnvon(0 etnir3todlm r neo s0s2uoxr3nu1ol emivtat sDta(  nt1aexn ieiys sDuauvp u4 etomrctatlpDeaueolt0srxr(m nydoleelfvia(fa2ur(  no0alx  feilsfm2elnvo;t) lxoif3tatlmtelueils trxm(o3oo4amenlivslsf Drrxr ;u1aptnioetydlsDel(mp t0artnif3oo1la ean i t) 2xrimpiu4al emfvtlt)a2uax pou0alx mf3ilt sDeanmp t) renxo3todfpDeanes t t2toir iudap  lnctlt)aDtm( ono1oeeo ociyd mDelump t4trtoxr3ia1omDran o s seurxo3nudam nmncsl( s2rr(mpot4opt mfciatfm rmumo;t4teenxfctadoa ranvol(0seuoxr3iodal nmnvtlt)a2trxroot1apeomietlt m uluvsnu0texnio3oo1opt  u o () 2xm(o3ny1amen ncta( s2umurp;o0olenmi3iltlmDumuvonu)tltnmfcoodoateai s s)t2tmxm3iydlle mnvtl(f 2rm(mont1aexo iciyd aDelnmo;(0 eeomf oy1fmDe ueo ( trumxo3iodalenmfes ( srtauro;u1apto fetlsla umnms u4 ltnmf3todfm rluvi s0texr(mpoydal e iesa(f Drr(rooo1tetnifeilt a2el(ms (0trxomf3iotom ranvi t) rtmio3iudomtn fesas)s2tm(  oo1ale ii3iasfa2eln onu)aeenmf3tatom elneo;t srurxrpnudope mfeilt  2rmump;t1oltnmfeiasfsDulu pnu0trtrmfctytopD  uvols) rto(o3ou1openmnvtat  rrm(rpot0apenmfeiysla2emu onu)tltrxf3iodla raiei (0s2trxmpou4amtelnvtasf rrau  nt0aptnmfetytla elu pnt) reniocia1fa   n s;s t2xoxo3ou1lptn icsasfsDtm( oou1oexn f3iadfaDrlump;u0altrio3oydfatraiei (  ruoxo io4lmeelncsltfaDtr(  ou0ale  feiytlaDeln s u0 ltrirctatlate iei ()t2uoio oudameelfesatf 2rau o;u1oee mfciat m2um(vo;u0aeeomo3todfmDeluvs;(0 exmimpio1op emnet s srtrumono1tlenmoeiad mDemn o u4alxrio3iadfpD an o;t trtoio3nydolt lfci (fsDraurp;o1oexniociatfa ra(vsnt4trxnxr oa1fa eaneo;t s2xo(o3ny1lmenlnesa()aDua(r ;t0oleniieildlm em(ms ()tlxomfcoo1fp eauvi ( teumxo3no4optelfet t)sDua(  ;t0apto f3tldfa2ra(msnu4teeomocty1oaD  nes;()srxrxmpoy4ol  mfesa(fsDuaxmo;u0aex if3iat a ranvs (0altoirctadfaDraies;t0setoir3nydam  lfeiltf rtmxm ;u4teenmoeiasfs2um( on()tetoxo iydlat  i ilt0srtmxr iodaltnlfetl(f Drauroou0altn o3tydls rmu p t0aetriociatlp r neo;s0trxrir iudlp  lnctls)arum(m ;t1teeomfciys aDumump u4tetrmr oydlpDr n ols  euoio3iu1alt  fesat)sDum(r ;o1aeto oeiat m2raumo;t0tetrmo ty1fpD aivo s0srxm(m nydamtn icsasf 2uru p;t4oeeomoeiysfa2rm( s;t4 ltrioctodlpDeau o s  2uoxm3io1ol nlfvias)a2rr(rpnt1apenmociatfm rm(vp () rtniociy1lp  ln i s  2trir io1lpeemfvi (  2umu  nt4tpxnio3tldla umnvsnt0alxrxf io1lmDeai i;() exrimpiydlmt mietltfaDuaxmooo1aetn oeiad s2rl( o;u)arxoiocoo1oa  li sls sruoxrpoo1lp e fvilt)s2rr(m ot0teeo octys aDranvpnt)alxoxfcoo1opDelnesls)seuo(m3iydllenlicsa(  2ur(  ;t4tpeomo3iatlmDrluvo t)treoxf3iadfp rlies ( srxoir oo1ape mfvtl()a2uru pou0apxnmoctytfsDea( s (4tltoio3io1fa e nei;t trur(o nudlmeelfvilt srtr(mpno4tpx  iciydfs ul( p u0altrmo ty1oa rliei t  rxrxm oy4ome lfvtl()a2tru o;t1teeo iciatfm uluvp;(0 rxoxr iadlmDraueol(0srumxm3no1lpe mivtlt)sDtmum nt0ale iieiatls2uan p t4 lxrxf iadomDe n s;(  rurim3iy4ome lietas) ruru ooo4tpxomf3iyslm rmuvp;u4trtrir iytfaDeauvs;t seumir oy1lleemfeils)arum(r ;t0tpto ietys aDumump t4artnio3tatoa eluvslt s2xrio oodlme lnvil( sDrr(mpou4alt if3iadfaDea( pnt0tlenio oydlptr n o t)s2xmxm3iydom nlfci ()srtau o;u0oetoifctadfs2elumsn() ltomf3iodfpD livol(0t2tmio ou4om   fciatfsDurx ono4ale ifctls m rau pnt0alxoxf3oatlpDrlueslt0sexm(rpno4lmtnlivs s s2taumonu4aexo ieild sDulumpnu0tetnxr3oo1oa  luvsls) ruo(m oy4lpen fvi tfarurumonu4aeen f3tatla2eln ont) rtrmoctadoptelivilt) etoxo3no4lme  nctas a2uauronu0olt mo3ilt mDuanvsn() exomr todlmDelu s ()s2tmxr ny4opeelfeiltfsrrmuroou4aexnmfeiadfaDua(vp;t) eeoxr oa1faDrauvo t)sexrirpnydom  livsl(f rua( pnt4alxoif3ildls2rlnvp;t)altrxf iotfa eanvi;()s2xr(r iy1am emnvi (fsrrr(  ;u0olxn iciyd a eau o;t4aexnmo3oo1oaDeai slt tetrxo3iu4al  liesl( arrmxro;o4oee io3ild a ul(vp;(0 rxoxf iotlmD ai olt) etr(r ny1lptnlfvs t)aDrr(mpou1oetnmicias a uluvpnt4tlermfctadfpDrlues;t) ruoim3no1op emfci sf Dta(m nu0texo feias sDem(vp t)alxrxrcio1fm  ai ols) 2xm(r3nu1amtn fcsl( a2tmxr nt0tlen ietatls rluvs;t0 lxnmo3iytlp  lueil()trxoimpoudll n netl( a2tmum ;t0tpt  f3tltfmDrm(vp u0tetoircoydfatr i ilt srtoxr3no4ap nmneiat)srua( oot1oeen i3ias s elump;(4tlxnxociy1opt  ueo;() rum(rpou4lleelfet ( s2tmx oot0optnioctas s2rmuvp (4 exrxf iydop  auvols) rum(r nodlp eliei ( srumumonu1oetnmoeiltfsDumnvs (4arerio ty1lp  lues;t)t2xo(m nu1opte ietl(fs2rau ono1ope ii3iyd mDelump () ltoioctodomtr neslt0s2tm(mpoudllt lfcsa() 2tmu onu1tetnifctltfaDrmuvo u0tlxrxo ootfp  anvs;t)t2toim3oo1olte nvsa()sDur( ooo1teenmoctyt aDrlnmpnu4tltrio3tatfaD ai o;s)t2to(o3nydolenlncslt  Draum oo4ape iictydfsDrmu s (0teeomrctotlpt lnvo s) 2toxopiu4om nmivi sf Drruroot4tlt  o3iytlm ulumsnu)tetrxociy1lp eauvs s) rtoxo3nodopeelnvs tfs2ta(m nu4alt ifctlsfa rln on(0arenmr oa1fa  an o;s) 2tmir3oo4lltemicsls) rrru oou4oltn fcilsfm em(mon(0artomr ootoatrluvi s  rxmim3no4ale lfvta(  2tru oou4aee moeiyslm2ran snt0tlerxociydfpDe uvo s  euoimpnudopee ivs t) rrr(ro;u0opx moeiytls eanms t0tltnmf3iadoaDelnvo t)t2xm(opiu1ope lfcias  rtmx  ;t0ale ifcias a ra(mp;()teeomo3ty1lpDeai il(  rurxrpio4ol e fvt sfa2tmxrpnu0tptn fctytfm2rmuvo t0alxniocto1lmtelnei s) rxr(m3oudaleelict (f Dta( pot4oexomociytls2uau p t4tetrmf3oo1lmD lu ilt)trur(opny1lltn feil(  Drau p;t1aptn octat m2um(ms ()trtomf iytomtran ils sexmim oo1ll nlnvtlt) Drrxm ou1optn o3iasfsDrlnvo;u)trxomr iytoaD  ues;t setr(r3nydlm nlfctasf 2rm(  ;u4tltniiciatfs2rmnvo t)trxoircoy1faDean ols)s2toxm io1am elneiat)sDta(  oo0tltnmocild s ranmpnu4aleriocto1laD  ieo;t srtmir3ou4lm  mfctl(  2urxr nu1oleoiictyt a2ua(mp u) lerio3oodfaD livs;t  rumio3no4lpenmfvi t arrmx p;o1olxniiciltls umuvpn(4 etnmoctatlmD lnei t t2toir3oy1al n ivt sfartaum ;o4texnifeiatfsDumuvp u4 lxoio to1op rlivs (0t2xoim3oy1llenmfvt ()sDrmu pnu0tlxoiociatlm rm(vpnu0trtnxo3io1omtr neo t)teuoimpoydalenmici s)aDtmx  nu4olto o3iasfaDumu p t0aexrxociatom ean o t) rtoxo3iudamee feslt)srraxront4opeoifeiyslmDulnvsnu4 rtoif3ootlpt  ueo;t  2uoim3oodomt  fei () Dtmxm ;o1aptoif3iltfaDrlums (0arerir3ta1lpt liei;s0t2tr(rpiy4ll n fvs sfarraump;o1alt ii3iasls rl(mpn(4texnxr ootfaDe uvs;(0srtoio3io4op nmics tf 2taumpou1tlen icildlaDua(vp t4areoio3tadlpDeauesl(0srxr(rpnu4lmt  nvia( a2uaumonu4tex iiciydfa eanvs;t)texoiocoytfp e u ol( seuoirpnu4oltnliciat)a2tmx oou4aetn o3iatlmDemumsnt0aeeoxf oa1oa   ieo ()texrxr3nu1op e ivs t aDrmump;t0olt mfeiyt a ra( s u0altomr ia1lmD ai sl() exrxopnu1ame  fct t  2rau p;u4aleomfetysls2ulnvp;t4artrxf oatop eluei s0texo(m3io1alenlnct s)srta(  ot4oltn o3tysfa rau pn(0 eerxf oadlpt  n s () rtmxr3oydlmen ivsa(faDtrxronu4aptn ieildla el( p;(0 leomr io1lpt  uvils) rur(m ou1ll nlfcsas) Dtrxmooo4alx  i3iyt a2rmnmp;()texoir oo1lpDrlueo;t s2um(r3oy1apenmiet tf Drm(  ot0oeeo o3iys a ul(vsnu0aetomfcoy1omD  u il() exoirpnu4amt mfvslsf 2trumo;o0alx ii3iydlsDranmp;u4tlerxo3oydoaDrlnvils) rurxo3ou1lm nmfes t)aDur(rono0opxnmoetytlm uln pn() exnmfcoa1lmteaivs ( t2xmimpny1olenmnvi s s2ta( pot0opt mi3ilt s2ea(vs (4artnmr iodopt auvi s0 eurxmpoo4om e fetat s2tmu poo4oeenifciytfm2um(mo (0aexnmf tytlptrlneo;(  exr(r3ny4ole lnctasfaDraxrp;t1alxn fctlsfsDranvo u0aeenxf3ia1lmD lues s0trtoio oo1openmivslsfartrur no0oee ifeiadfa rau ont) lermrciytfm elnvs;()trxoxm3nudope  fvtlsfsrrrumpou4oltniociadfs2emuvon() exrmfcio1oateai s s s2to(o ou4open nct s)srum( o;t1tlxnifctasfmDulnvs u0arerirciydlp  auvo (0 eurir ou1am   ivtatf rrau onu4tpx iociadfm el(vp ()alermociodla elu slt0 2uo(o oydal  mnvs ( s2trx  oo4oee  o3ildls2emumpnt)aeerxf oo1laDeln i s0teuoio oodlptnlneiat sDrmxm nu1tex mfetas a uau snu0aetomf3oodop eli o;s0seuoxo io4llt mneslt aDumx  ou1altnio3iydlm ulnms;t4alerir tytfptran i s)s2ur(r oy4ale  ict ()sruaxmp;o0oleoiieias sDrmuvo u)texnifcoo1oatelueils) 2xoio iy1apeelncsl(fartrx  no0apt  ictysls2rmnvs u4artoio3oadfpteanes ( tetm(opoo4am elivtl(  Dtmxm ;o1oltomf3iasfm2uan s t4tltoif ootoa rlueols)tetrio oo1lm nlnci tf 2tmxm no4ape iociydfsDrmnvp;()areomr3iotfm  au s;t) 2umio3nydome mnvt tf rtmxroot1alxnmoetldfm rau p t0aexrmr3iadlm eln ilt)t2xm(rpny1apenmics s  Dtrur ;t0oltnmoctyd s2rlnmo;t)aetoir iotlatr nes;( s2ur(m3oydoltnlfei (f rta(mp;o4optniieiysfs2rm(vs t0 lxnif iytoa eanes;t) eurir3oo1apee neiat) rurum ou0tleoif3ilsfm ean p;t4alenifctadfm eln il(0texmxm3nu4lme  fcs ( a2uau pot1olt moetytfm2elnmp t0 eeomf oodom r i s;(0srxmxo iodal e nctlt) Dtax  ;o1tee  ieiatlm2um( p (0alxnmociotfpteauesl(  rur(m oo4apt liei tfarur(  no4apx ifeildls rln p u4aeerir iy1fa r i o;t0 eurxrpiu1alenlfetas)sruaxmpno0olto o3tasls2elu pnt)tlxomo io1oate iei t s2trxopoy1amte nes ()a2tax  nu1tlenii3iadlmDem(vp t0 rtoxr ootlate u s t  rtriopiy4lp  lfeil(fsrrmu o;o1olxo fetltlm rmumo;(0 rxrif3iadop rln s;()srtoxo iodol e netl() rur(r ou0tet mocias s2rmnmonu4 rtrxr iatop raueo t0sruo(m3iydamtemnet (fs2uaump;o0apto ociydfm uln p;(4 rtrxrcty1fmDeai slt) rtmxm nu1am  lnct t)s2umx  oo1olt  iciadlaDrmnms t)trxnif tydfaDrli s ( sruoxr3iudap  mfcils  rtr(  ou1oetnmoeiasfa2ua( pn(4trxoxf3ootoptr n sl()seumimpio4lmeelfvtat)arumu pno4aleomi3iasls2rmump t) lxoirctotlm  lueol()srtoxr nydom n ieilsfsDrm(m no0ope mf3iysfm rm(vp t) eeomrciodfmDeluvs;s0 2umxo3oo1am e fvilsfa2trurpoo1alxnmieildlsDuanvsnu4aexrmo3tydfatrli o;t seum(m oy4apt lnvs s) 2uaurono4apxomfeiaslsDelu o;t4tetrxo3tytoaDraivsl( t2tm(m nudlmtelnei s s2umxmpoo4ole moeiadfm rmuvpn() etnmr3oy1oa   ivi;( t2tmxrpny1am elivia( s2urx poo1alt ifciyd m2rlums (0alxnio iatoa rli i;( srurxr iydlpenlnvsat)artaxmpoo0opt mi3iyd mDumuvo t) renxoctatoatran slt) eur(o3ou4lp nmicsl(fsDuax p;u0teto ictltlaDraumpn(0 eenmr iodlaDrlu o;(0trtm(opio1lpenmict ( srua(mo;t1tle  fciyt s umu pnt0tltoir3oydfmDe uvo;() etm(r3oo4aptemicia()aDrmum nt1tltoii3ilsfm2ra(msnt)altnmo3to1fmtrauvo (0tetmxm oy1ol nmnvs ( sruru ont0tee ioeiytlmDelu pnt4aetoir3oa1lm elu s;t sruoir3oudapt lfvt sf ruauro;u1tptnmictad s rm(ms;u0trtnircio1fa elnvsls) euo(m3nydap nlneiasfaDrmu p;u1tpe mo3iltfsDemu snu4artnxfcia1la raiesls)teumxm oydaleemfvtas aDuru pnt0oeenmf3tlsfm uanvs (4arenir iytop eli s t teurio3nodopenlnetl( srtaxrpou4opxoiieias aDeaums ()tltrxf3iy1omD lnvi ()tetoxo iu4lpenlicsl() 2rm(r ou4tle ifetadfm uanmo u) lxnmf oadlat  i i s)tetmio3iydol  lfeiatfsrrrxrono1apeniieiysla2rmumonu4areoifctatfmDrauvs;s)srxo(opoudal elfcs s)arrax  ;o0tltomf3iytfmDea(vo t)artomo iytfm r ueo ( t2um(mpno4omt miei s sDumum oo0oltoiicildlm2elnvpnu0alxoxf iydfpD lnvols)srurxo nu4olenlfcs t srtr( pnt0ole  octaslsDra(mp;(4texnxoctodlp  lues s0 rxr(opiu1lp  micias aDrr(rpoo0olt ioetldfaDum(vs u4 etoxrctytlp  an o;t)seuo(m3oy4om elnesls  Drrxmp;t1apx mi3tltlmDuanmpnu0trxrmr3tadoatrluvi s tetm(m ou4lmte nesatf rurxmont1opxnmfciaslaDranmpn(4aeeomf oydlpD livol( s2xr(rpnu1lm   icilt  2uax pot1olxo oetyt m2elnvont)alxrmo3oadlm  anvs s0s2urxopiy4al nlici t) rur(rp;t4oex  oeias m2rmuvs t) reomo3totoa rlivo;t)teuoxm3nydlme miciat srurx ont0olxoioeild m rl(mp (0tlxnxoctotfpDr uvsls texrxo iydomt miesa() Dur(mooo4oleoioeiyd m rl(mp (4alxomr iatla eanesls) eurxrpnu4optelivs s artmxmp;o1texnmieiatfm2emumpnt0arerif tydfmt aneo;()srur(r oy1amtnmnvsa() 2rau  ;t4aptn oeiltfm em( p u0trerxf oodfp elieo;t)setmxo iodlptnmictltfa2urxrpot0tpeoif3iltlsDul(vp;t)trxrio3oadlpteauvs;() euoio iu1lmenmivt t) Dtmxm ot1aexn ietyslaDrm( s () ltrmf ootfp   u slt)seuoxr iydape lnvi s  2rax p;t1tlt  octys a2umumon(4trenirctatfptraiei;(0 exriopny1lm e ivt sfarurxr nu0aetnifetatfm rluvpnt)tltrmf oadoate nei;s0texo(m3oy1oltn ncs ()srurx ooo1apt  oeilsfm umu onu4treoif3oy1latr n s t0t2trxopno1ope mfvtasfs2tax oou1oexomf3tlslmDulu snt0alxnxo3iodoa  auei;t) 2toxr nydlm  mieta() Dtr(mpoo0oetniociadfa eln o u)texnio3oytlate nvo ( trur(o3iu4lpenmnctat sDra(mo;o0alxomf3tys m rlnvs;t0 rxnmr iadfm rluvo s)s2trxm no4opte fctasf ruauroot4aex iocias m um( s;t0artomr oytla rln sl(  exo(m oudolenlics (f 2tm( o;u0oeenifetyd a2ulumpnu4 ltnir3ty1omD li i s0 etrxr3iydlm n ncia( aDtmu onu1oetoif3iltfsDrl(vo;(4 ltomr3iodfa rlnvols)texo(rpny4ope lnetasf rtaurpnu4teeo ociad s2rm( p u0 rtnxf3todlatrlivo;( tetoxr nu4ap e neiat)arrrurpnu4alt mictysfaDrm(msnu4alxniocoa1fp eai o s)sexrxopiudop  lnvs (f 2tau o;o0opx ifctls m rauvp;t) rtrmr3io1om   i i;s  eum(r3no4amee ieslt)sDururonu0open icilt m2emu p ()tltrxr3iatlpDeaiei;()truoir nydll   iviatf rrrurp;t0tltomfciytls rauvpnu) exnirciotoa rlivsls) rur(m iodal   fes ( sDrrumo;o1aet  iciadla uau onu4arerxoctytfpteluvi;s) rxo(rpnu4ol n ies t)a2rrumpnu0tlxoifeild sDrau p;u0 etnmr3oodlaD aivi (0teuoxm3iy4oltelictlt srrrxr nt0oltomoctyd sDua(mo u)arxoxr iytomtrlueo s0trumir iydlptelfctlt  rrru oot1texomi3iytla2rauvont0altriocoodlm   nei;t0t2uoxm3io4ame  ics s  Drr(  ;t4aptnmociaslm elnvpn(4aexnxr io1latrluei;t tetoxo3io4amtn ieils)a2ur(  ;o1tpxnmi3iad mDrm(mpn()altnxfcoatfp e ivo (0trumir iydamenmictasfaruax  ou4tltoifctys s em(mp u)tlenio3iotoaDelnvolt0setr(o3oudlle mnet sfsruau  ;t4optnif3tyslsDra(vp u4aexnio3io1lmte nvi ()srtrirpio1olenmfcilsfsDumxroot0tptomietadla2ua( on()arxoir3iatlpDr ueo;( s2tr(r3nydamtnlfei t)a2tm(mp;u0oetn feiydlm eluvp (0aexomf ta1fpteauvi;(0trxm(m3no1lmtnmiviat  Durum ;u1open ociat a2ra(ms u4arxrmr totop  lnes;t  rxoiopoy4lmtn icta(fsrumu o;u0opeo o3iatlaDra(vo t) leniociadlp eau s;s0 rumxm3oy1om nmies s aDum(rpnu0apxn oetyslaDuluvo u4 ltoxf tydoaDeaiesl(0 rxr(mpny4lm  mictas)srumumo;u0tlt ii3iadfa ua(vs;u4treoxr oytlatr ivs;s)trumim oodlleelfcslsf Duaxr nt4alxn o3iasla eaumpnu4trenif io1lmtelivils trxrxm iy4al nlivi t  2ta(mono4aex if3iatls em(mo t0aexnir3oa1laDeluvo;s srtm(m3iy4al nlnvils) rurx  nu4tpxn o3iad s2elu p t) exomr3to1lmD aies s0trxrim3ou4amtelicsat) 2trxrpnt1ole ioeiydfmDem( p u0 rxoxfciadoaDeanvi s0 rxrxo3nu4lle lnet ( sruaum nt4oleo ociadlm uan pnt0teerxo3tadom  livil(0srurxrpno4oleelfctatf Drrxr ot4tpeomo3ilsfmDeau pnu)tlxomr3oadom elnvs s srxo(m3iy1ll  mnctlt) 2ua(m ou0tpxniieiadla2rluvs (0tlermo ty1fmteluvils0 rtmimpiy1oleelfeils  2trurp;u4aetn icils a rlu on(4aeeoir tatfaDr u o;( texm(m no1omtnliesl(f Dumum ;t4tex  f3tls s2rmump u4tetrxf3to1lpD  uvo;t s2toxrpnu4lpt lfetlt  Durxrpot0aee mfciydla elumpnt0trxrmfctydomte ivi;t) 2trir3nu1ap nlnes (f rta(mpnt0ope mo3iytfa rln p t4 lxoircoo1laDeli o;()t2xr(rpnodape lfvsa() rrmuroou4olt mieiytlm2uau s;(0tlxnmr3iydla  aivs;(0t2tm(r nudlmen iciasfs2taumo;o1olt  o3iltlaDemn o t4areomr3iodoaDrauvilt)trtr(mpoudam e fvsltfaDtr(m nt0oeenifeils s rmnvpnu0artoircoodlate i s;t trumxo3oo1omtnmietlsfarrrxr ot1teeomo3iys a2rauvs;u)alenxf oatlaDelivs s) 2tm(opnudam  lncs ()artr(  ot1opx  feiytfsDemn snt0 renmr ootfpDr u s t) etmio iydom n fcs ()aDtruroot1oexn f3iyt s2umump;(4alerxr to1fm r ues t)setrim3no4ap emiei (fsrrm(  ;t0olxo i3ildfmDum( p;t0tltomf oytfpDe i o;()srumxmpiy1llt mnvtlt s2rmu  ot1tet mf3tlt s emu s;t0tltrif3iatlaD lnvs;t trxm(mpio4amtnmncia() 2tmum ot4oet io3iltlsDrmnms (4trxnmocootlmDrlnes;( t2uo(o3no1al emiviat)s2raur ou0oleo i3iltls2rauvp;u4areomf3oa1latelnei;s srxm(o nydopenlics s s2taxmono4optn i3iyd a emnvp;(0 etnxo tydopDeln o t  exoiopiodam emnesas  Dua( p;u4tee mfctldlmDuaump u0 eenmf3oodla rli o (0 euoxm oo4lltnmfvi sf rurx oot0oee  i3tldfm2uan snt4tltoiociatfaDeau o;t0 2xmxm nu4lptemnvsasfs2ur( onu1tlxniiciytlmDra( sn(0aetrif oodlmDr neol() rumxm3no4llenlnci ()aDum(rooo1tlt miciys s2rm(vo;t4 ltoxociodomDrln o;s0s2uoxm3nydape mfvi ()s2umum ou4tlxnmociatla2rluvs u0treoif iotoptranesl( sexrxmpnodlle  ncta()s2tmxrp;o0tlxoiiciys sDulnms;t0 exnir3iotlpD  iei;s  2xrxm3iodoltn fcilsfa2ur(moou4tpxn oetld mDea( o t)treoxo iydoa   nvo;s)seur(o iy1lpe  nvia()a2ur(mont1opto fciadfa em(msn(0 leomf tytop   ivs t) 2tr(m3ou4ll  lnetl(  rurum ;u0optoii3iasfmDul(vpnt4 reomf3iodfpt aivsl()s2uoxm oodom  mieta(fsDrr(mp;t0tleomictysfs emumont)tlenmf todfatr ueslt trxoiopiu1ll   fei tfsDtmxroou4tpen oeiadfs2eaums t)tlxnif to1lpD  u ol( sexr(r nu4amt lnet s)sDtau oot0tpx ifcild a rmn p;(4trermrciadfpteluvols  etrio nu1alee nvil(fsrtr(r no0aet mfciyslm2ua( p;(4tlerifctatomteln slt s2umim3oo1lpen feslt arumum ;u0alxoiociaslsDumn s u0trtnxr3ootla   ueo;s0 rur(mpoudapee neiat) Dtmu pnu1olxo fctytls ua(vsn(4alxrmo to1oa  li sl()seurxmpno4ome  nes t sDtrxmpou1apxomo3iyslm rmnms;u4 lermo oa1oaD  ieslt0seurxo3oy1lmee fvtas srurxroou1oeto fctld m em( snu)arxomr3oydfp raneslt setoirpoydom emnvs t)a2rax  oo4optnioeiaslmDra(msn()aeermo3oodlaDe i o t trtrirpiu4om   ivtlsfsDtmxrono4oexomo3tldfs el(vs;u0trxomr3to1fm r u slt) 2uoimpnu4ll nmnvta()aDumx  ou4opxomfeiyslm elnvp;u4aeeoxrctydlm e i s;s  euo(opiy4op n nvia() 2rrxmpot4texo ieiysla2ran p;(4aetnio3ta1fm  auvi ( s2xmio iydlle  fvil(  rur(m nt4opeomoeiytfaDumnvp () ltnif oodla e iei ()trtrxo3oy4olt lnesas sDta(  oo4apen feild aDea(vo;u4tltoxo tatlmD  uvi (0 rtrxr3oy1om   neta(fa2rmxr ;o4tet  ictyt s2eau o u0arxnmr3oadla raivsls0s2toxmpoudomtn feia()a2ua( pnu1alxo oetad aDranvo;u4tltoircoadomtelneil(0 etr(mpnydom emncsl(f rururo;u0oexn ocilslmDum( p t0 rxnxocoadoateli s;t seto(mpoydlme lnvtlsf Durxr ;u1alx  ieiyt mDua(vs;u4artrxocoo1laDr neo s)s2xoir3oo1ole  ncsls)srtaxm ;o0oexoio3iadlmDeauvs t4trxrmociydfmtrauvs t)teuriopoudll   ietlt)aDum( o;t4opto fciasls2um(vs t) renmr3tytfp  aiei;t  exr(o oodalt  fctl()sDrr(root0optnio3iytfaDelums (4altnmrcia1omD anvi;s)s2xo(rpnodlpee neta( sDra(  ;o4altnmoetltfm2raump (0arxrmo3ootlmte ivo;t0 rum(opno4lmeelnvtltfsDraxrp;u4aleo ictasfa2eau o;(0 exnmr oo1latelnvi t0s2xr(o oudolte fvt t  Dumx  ;o0texnio3ildfs uan p;() eenmf3iotfm eln o ()seuo(m3ny1ll nmfetls)aDumum ot1aet  feilsfsDeauvs t4tlxnio3oytfmD  uvs t)t2xrim oy1lltn ivtas)sDtrxmpoo0tlen i3tatlm2rmn s;u0artrifcoadfa  aieolt0s2xmio3nodop emnci ( s2tr(mpot1aexnmfcilsfs eanvpnt0alenxf io1fpt luvilt0s2toxrpnudlmt mfeil() Dua(  ou0oetnio3tas a2el(mon()aexnmf3iy1lmtr u i s sexmirpoydalee ncta(  2rmxr ;t1oleo fetadfs2uan pnu)tlermo ta1fatr u slt srxoim3iy4lltemnvslt) Dtaxrp;u0tee  i3iydlm umuvs;(4teeomoctotlaDeln olt)srtmxrpio1lp emieil( srtrx  ot0alto ieiatls2ranmo ()arxoio iytfa r ueo;s0teto(o iudamtn fvsat sDrmxr nt1tle iociasfsDemnmpnt4tlermo3oodlptr uei ( teurxm ny1omte nvi t s2rrumoot1opxnmi3tld m2um(vs;()alerir io1oa eliei () 2uo(m3oy4lltnmfct t a2trxr nu0alto feiysfs rl( snt4 leoxrcoatlptranei (  rtrio nodllee ictlt sDuau p;t0apx ifcils s elu o ()tltrifcoy1opDelnes;(0texrxm3nudlpee nci sfa2tmuront0oex mi3ildlsDumuvp (4arxrmr3iotlmDr iei;( t2to(m3iu1ll nlfeiasf 2rau pnu0alxomfeiyd m rln s t4alenmo3ia1fa rlnvslt0srtr(o3oodom n nesa()arurxmoou1tex mocildfs rmu pnu) reoxoctatoaDr ueol(0 etoio iu4alenmneias s2trxrpot0apenmieildfaDrau o t4aeermr3oytfa eauvs;t0 eum(rpoy4lltnmfcsa()a2tax onu1optnifeilsfa rmn s u)teeoxrcty1fpt anvs;( srxoim ou1lmeeliei s s2umx o;o0olt moetldlm rlu s t0tltrxr tatfptrlu i s0 2uoir3nodale mncsl()s2ua(r ou1oeen f3iasfsDeluvpnu0tlerxrcta1faD lnvo t0 exm(opny1ame livilsfsrrm(m ;o0apxn ociadfa ean p;(0aleomr3ty1opteanvs;t trurir iodopeelneils  rurx  ot1tptomictlsla2ea( pn() rxrif3oydoptelnvolt tetoim3io4om  lfeiat artmur no1opeoiieils mDrl(vs;t)texomo3oy1lptranvsls0 ruo(rpou1al  mfctlt)artrump;u1aex mo3iydlm rlumont4trxnif3todlaD li ols0texmxmpiydaltnlncsatfsDtaur no4tlenmictlsfm2rl(mo t)trxnmf iy1lmt an ils)trxmirpnodoleelnciatfs2trxm nu0optoifetydlmDum( p;(0texrmf3tydfp r uvols)trxrim oy1am   nvsltfs2raurp;t1tltnmfeiltfm2em( s t)tlerxf3oytlmDrlu o t) rxrim3iodlptnlfvs sfa2ra(  ;u4ope iieiat aDumnmo;(4aetnxo3ta1lmt ai sl()srxoxrpiu1omtnmnetlsfa2ur(  nu4aeeomiciasfmDul(vs u4 rxnxr oodoat lies s  eurim iy1lpeemnvsl( s2rrxrpot1teenmo3ilt m2el( onu0tlxnxo tatfmDe u o;( srxoirpou4lltnlfes t)aDuaxrpno1tleo fciatlm2ra(mp u0tetrmoctydlp r u olt0 rum(m3oo1om e netls  Dta(mooo0olto feildfmDeauvs;u0 etnxr iydfmDrli sl()trurxr3ny1opt licta(fsDur(rpot1aee ii3tyt sDelums;t) leomfcoadfmt an i;s  exmxo3ou4lp  mivtat)aDurxr ;o0tpe  feildls2ranmsnu0alenxr io1omDrauvsls)t2to(m no4am  lfei s)a2taumpou1tpxoifciytfmDranvo;t0aetnif3oadopte nvils)truriopnu4lleemfeil() rtaurp;u4aetnmietyt s umuvs () ltrxf3totoa   ies t)trtoxm3oy4lm emivil()a2trxmono0tltn oetltla rlumpnt)teeomfcto1fmtrli s;t texoio3io1ap e fcs tfarua(ro;o1aexomieiadls rmnmp;(4arxnxfcoodlm e i s;s) ruoxo3ou4alt mfesl()srrmu  ;t4opeo i3iyt m2rmuvo (4artrxrcoytomt livo;( tetmxrpio1lpeemfeta(f rum( ont0tle mf3tlsfaDranmo;t0alxrmf3totfptrai s;t  euoxmpiu1am  livsa(  2rrxmpou1teto o3iat s2ran s;t4 eenmf oy1lmD anei;t)srtr(o3oy4ol   nviatfsrtaxmp;o4teeomieiasls rmnvo;(4altrir oydlpD  nes t0 eum(opoo4apt livta( aDtru  nu1opeoifetlsfa2emu snu4aleoxrctodlm ranvi t s2xrxo io4lptnlfvil() Dtaur oo0tetnmieiatls2rm(mo;u0tlenmr3oatopt  uvi;t0setm(opno1op e fvs s  rurxr ;t4open o3iadfsDul(ms t)trtnxf3oy1fm rli olt) 2xoxopio4lpe  ici ()aDtr(m ;o0tex  iciatfs2ulnmonu0 lxnxo io1fpDe ueils) eum(o3iy4ap n ivia( a2tmxmpnu1alto ocildlm2rl(vs u4 renio oadoaDeaieolt0trxrxr3iy1lp  mnesat aDtru pou4oee ifetad m2rlnvp t4 leomoctatoaD auvols0s2ur(m3iy1alt  feils)s2tmx poo4opx mietyd s2eau on(0teerxrctodfm eluesl(0 rumirpnu4am   ieils) Dtrurooo4alt iietad s2ulump;u)aexomr io1lpDelneols)teum(m iu1omenmivs ( artmx  ot0opeo feiltfa2rl(msnu0aexnmo3oydfmt liesl(0 2xriopoy1lltnmictl(fsrtmxront1ole  ocilslsDum( o t0aetoif3ta1fmDr ieilt tetm(r3io4ll nlivta() Drrurpoo4tptomociltfa2rmn o u)aexnmo ty1la  anvi ( trxm(m iudaltnmieil(  2rr(mont1aeen f3tatfm2el(mp u)alxrif tatoaD  nvilt  euo(r no1alenlicsas  2tau  ;o4ale moeiaslm2ea( on(4aexrxociatom eai i;(0 2uoiopio4altn fct s aDtmur ;t0oee mictydlsDea(vp t4 rxoifcty1lpt  u olt) rxo(mpny1llt licsa( srurxro;o0opt  octytlm em(mpn(0tltomf3ty1lpteluvs ( trxm(r3oo4apt lfcta(fs2ur(m ;u1alenmfciyt a eau o;t4trxrir3oa1opte uvs;()s2umirpiu4lleelnvi ()s2ta( ono4tex io3ilsfm2ulnvs;u)trtnif3ia1lm   nvo s0 rurxo3ou4lm nlict tfa2ua(mp;o1alxomo3iadla2rl(mp u4tltrxrcia1opDeli i t)teurir nu1lmee nes tf Durur nu1optn i3tltlaDelnmp t0tlxrmf ootlat lueil(0trtrxopiy1lpt  fctasfa2tmu pot0apeoii3tlsls2ea(mo;(0trermo ootfpDrluvsl( srurxo io4ll n neslt  Duau  ;o1tptn ocilsls rmnvp;u)aeeoxr oydfmtelnei;t0srxoxopno1lpe micsl(fs2tr(r oo0alx mociadfaDuan s;()texnio3io1fm ean s t0trtm(o io1opee nvs s) rtrx p;t4alxnmoeiatlmDel( pnu0 eenxrcoadoa  aues s)s2tmxr3oodlpt mivtl(fa2tmum ou0aptnmf3iltlm rlumo;t0 lxnxf oo1faD au i;t) etoxm3nodol nlieta()sDrrx ont0olxoif3tys s em( p u)alxoxr3oadfp rlueil()t2uoim3oudoltnmneia()arurx p;u0oexnmictltla eanvs;t0altnmr3iatfateai o;( trurimpny1ole  fetl( sDtau pot0tlxniieiatfmDelnms t0 exomf3oydlm e n i s trxrxm3iu4lpt mfvtl( s2ra( pno0oleomfcildls rm(vpn() rtoif tadlpDe ivi ()s2xrir3ny1amee fvi s sDur(rpnu0tlxo o3iaslmDrlnmo;u)altnmfcia1lmt luei;t0 euoir3iydopeeliesasfa2ur(  ;o4aleomociaslmDeanmo u0trtrifctadfpDeanvi t  eum(o nu1ap elies ( sDtmumonu0tlx if3tadlm rl( ont4tlxnxr3iotoptrlueilt0t2tmio3nydape mnet s arrm(mpoo1tpxnmfeiltfsDea(mpnu)texrmocta1fpDe n s () rxrxm3oydom   feslt)a2taurp;t1oexnif3iltfa umnms;u0trtomr3oodlaDe ieolt)texoio iu1omtnlietat  Drmxrpot0tet iietas sDea(vo () rxoio tadfm eauvs t0tetrxo io4oltnlfvsltf Durum ou4teeoioeilslsDranms t)tetnxo tadfmDelnesl() etrxmpoodopen ietas) Drax oou4ole miciltfs2eluvo;(0tltrifciydoptrlies t  2toxo3oo4lm elivs (  rrru  ou0aexnmfeiytfm2ranmo;t)texomr iodoptr uvi;(  2ur(o3iudlpe lfct ( sDtr(  ot0teeoii3iys m2rauvo;u4arxomfcto1la ean i;t0t2toxm3nu4omenmicsa()artmxro;t1tltnifctldfmDraumo u)tltrmrcty1late n s t)trtr(r ou4om n iei (  2uau p;t0tptn ietytlm uluvo t4texrmrcoytlmD lu ol(0trxrxo3oy1opt mfetltfa2ua(r ;o0ope  octadlm2ranvo;t4trenxo3iytoaD  neo t0t2xrxm3iy4oltn ics (f Dra(mont0oeeoiictldlmDrlump;(0tetrxo iy1omtrai i;t) eum(r3io1omeelnvt ( sDrrumpnt0aptnmocils a2umu s u)tltoio3oydoaD aivi t  rxr(rpoo4alte fvs t) 2umxmont1alxnif3iys m umumsn(0tetoxr iydfpt ai s;s)s2xoirpiu4amt  fviasfs2ua(  ;o0ale ioetyd sDrm(vpn() lxoxr ia1oat anvs;s teumxo ny1lp  livtlt) Duax oot0openmfciytfm2uln s;(4tleomo totlat luvo;s0t2xrio3nu1apt mnciatfs2tax poo4tpxn ieildla2umumonu0aetrir iotlmD  ueo;t0srxmxo3oydll elfvt (fs2trx ono0aeto octasla2ulumsnu0 rtnmoctytoateln s;t0 etr(r3nodapt  ncias aDtr(  ot4oexn fciydfsDrln s;(0 renifcoodoaD livo;t0texoxmpoodoleelfvi sfsDrmx pnu4tlxniietatfs uauvs (0 etoxr3iotlaDrlnvo (0 rxmiopoy4optnlfctlsf Dum( ont1aeto octyslm rlnvo (4 lxoioctadoa eau i t0t2xoxopny4olte nciltfs2raumpno0oetnmf3iyd m2eanmo;u0 exnmr3tytlmDeln s;t0tetr(mpny4am nlnvil( srurx  nu0tlenmoetyd m2ulnvpnt)alerxrciotfaDraivs;(0 2umxo3no4ll n nvslt sDtrxr ou1apt mfetydls uln p (0trxnmrcoy1omD  uesls0t2uoim3iu1ap   fcs (f Dtau o;o4optniieiaslaDra( o t4arxrio iodlmDeaieo;() eumxm3iy1apen fct s) 2rr(rooo4olx mo3iaslm rmnvs;t)texnmf3oodlm elu s;t srtrim iu1al e ncia(f rumxront4aleo fcildlsDemnvo;u0 etnmo totlpDrlnei s0srxr(rpoodaltnmfvil(  2ta(m nt0tpen ieils a rm(vsnt0alxrio iy1lptr n i;s  etr(r oodal   nctl( arua(  ;o4tpenmfeiaslsDum(mp;(4altoxocoodfmDran o;(0s2tmir3oy1ame mnct tfaDtrum no4aptn f3ildfaDel(vo;(4 lxnmo oo1la elnei (0 rtoim3oodlmt lfcia()s2rmx o;t1alx mieiytlm ranmp;(4tltoxf oa1lptrau ols srxo(m no4ole  ics t a2rm(m ot0opxo i3tasfm2ra(von()treoio iadlpDeliei (0t2xm(r3ny1ape mfesas a2ta(moou0opxomoetydfs uauvpnu4aetoxo ta1fmtrau ilt  rtr(m ou1ale  neta(faDuau onu0apxnmi3tltlsDumumo u0 rxoxrciodlat lieo;s0texmim oydapenlfei s aDumum ;u0tleomfctlt sDum( ont) rtrifciotlaD  uvi;t s2uoxm3iy4lm n ncs ()srtmxm no4tetoii3tysla2rmuvpn(0aeeoxo3iatfp e i s t0trxrimpoy1amenmnvilt) Dumurpnt1aptomocilslaDra(mpnt0trtoir iotfm ean o s)srumirpoodlmtemfci sfa2rr(moot0altn f3ild a eanvs;(4aeenmo3oatomt  iei;(0 2uoirpnu1amenmivt sfs2rr(m oo1tex  o3iltfa2rmnvo;u0 lxoxociadlmD  ivo s) 2xrxmpou1lptemfcsa() Drmur ot0teeoifetld sDem(msnu)aexnxo3ty1fa r uei;t  rtmir3io4aptn ieslt)s2tmu onu0olxnmf3tlt sDel(mon()trerir iadlm r nvs;(0 2uoxopoy1altemicsl(  Dtr(ro;t1tleoiiciytfs2uaump ()aexnxocta1fmteluei;()seuo(mpnu1op n ieias  rrr( ooo1altnmfeiltfm umnmo;u)arxrxf ty1fa rlu o;s)t2tmiopnudol  livsls a2umu  no4oetniieiysfsDea( p (0 rtnio tatomt  uvs;s sruoxr oodal nmfvi (f rrmxmpou0olx moeiys sDum(msn(4tlxrxr3todfpt aieil(  2trxopoo1ap elnvtl() rua(  no1altoifciadls emn snt4trtrxr iadoa elieslt) exr(m3ou4lle  ivsl(f ruau  no4tptomfctatlsDelumsnu0tltnircoa1lmtraiei ()s2urio3nu1am  livias)a2um(mpot0olen oetlt s2eau p t4aetoxfctatfmD aivs;s s2xr(r ny1lpee nvtlsfs2rm( o;u1oee  feils s2rauvsnt0trenir3io1faDr uvo s) ruoxr nodameelncils) 2umx pou1aeeo o3iyd sDrluvs;t)texomo3iydfateaivi t0srtoiopiodlpee nvtlt a2trur ;u4oee  feiltfa emnvsn(0teeoio tytfat aivol(0 2xmio3ou1optelfesat) Dum(ro;o1alt  fcildfm rauvo (0altnif3oodfate u slt0t2umirpoodlpt livsa( a2ua(mo;u4oltnifciysfsDea( ont0aetrxrcia1lp rauei;s) 2trxo iu1om elncsltf 2trumooo1oet moeias m2umums (0trxoio ootlp raivi t) eur(opiy4lmtelfcsls) Durxmpnu0opxo ociadfm2elu s t4altoiociydomte ueo;() 2xoxr ny1lp elicslt aruaxm no0tpe mi3tltfm um( s t4aexrio io1op rluvo (0 2urxr3oy1lltn fviat)a2trxmo;u4oet mf3tat mDea(vp t0 etoifciodfpD auvs t  rxmxo3no4lpen fet t  Draxrpno0tlxomoeiasls2emu o (0trenmr ty1fmtr iei;t t2uoxr3oy1ll nlfciat sruaxmoot4tltnio3iadlsDul(vo t4 rtnmo todlp rlnvilt)s2uoirpiy1open fvtat sDurumpou4altomfeiadla ulu s u0 ltrmf oy1fmt anvols)texr(o iu1ole lfvsas arururpoo0oltoifciydfm uluvsn(4treoifcoydopDran olt)tetoxmpoodlpt  fciasfsruaxrpnu0apx mictytfm2ean p u4arxnxo3oadoatr ivo t  rtrio3ny4amenlnctas) 2raurpot4oeeo oeiatfsDemuvo u)trxrxr3iatomt li olt) rtoxo iy1apenlneilsf rta(r ;u0oleo ocild a2umn snu4trxnir tydfp eai ol( setmio3oo4alt mivia( sruaxm ;o0apto ieiys a emn p;t4 rerio3iodfp e nvils t2uo(rpoudlpee netls) Dtmxm ;o4oeen i3tas mDrauvp;u4trxnifcoydomDrlneo (0t2xrxmpiudlle  netas sDrm(r ot4apeomociysls2rm( s;(4tleoirctytla r nvo s) exm(m3ny1lpenmfesas sDtm( ooo1oet io3iytls2emumon(0 exnmr iodomD au s t)t2tmim3iy1omenlnet s)a2tmum ot0oexn oeiytfm2ra(mp (0 lenmfcto1latr ieo t)trtmxm oudaptnmnes (f 2umxrp;o4tee mieils a2rmnmon()arenxo3oa1laDrlueols) rtmxmpio1lm  lnvsas  Drr(mpnt0aeenmf3taslm uanms;t4alxriociadla eaieslt)s2tr(o nodal   ieiltfsrta(m ;o1ape mfcilt mDul( snu)tltomrcootfat  i i ( trtrio3iu1lmtn ncilt)s2ua(m ou4apeomoeiad m rlnvpn() etnxocootomDe uvi;t0srur(mpnudome  nctl()arua(  nu0tpeoiociadfm2rmuvs () ltrifcoytoat auvi t  2xmir oy4om   ivtltfsDtaumono1texo i3iasfsDrmnvpnt0 etoio3iy1fmt anei t0 rtrxr oo1lm   ivsasfs2rrxmp;o0tpxnifetls a ra( ont4aexoxfcootoateaivils  2xm(r3ou4lp  mfci ( srurxm ;u4olxomoetyt aDuaumont4 leomrciytom rau o;s0t2uoio3oydap nlfcsls)arrau p;t4tetnmociysfa2uln o u4 leomf ta1optr i i s srxr(m3ou1al emfvsa(f 2raumooo0oex mo3iad mDrmn p ()treomo iatlpDe n s;()s2umxopoy1am  liesl(  2rrx poo4alx  ieiat a emnmo (4 exomr3to1opDr nvi (0 etm(m iydapenlfcsatfsDuaur ou1aeenif3tltlsDumuvsnu4 rtnmo ia1op  aieo;s)t2uoxo3iudalt lics (f Duru  ;u1oeeniicias s rm(vsn() renif ootfpD auvi s) 2tr(mpnu1ol nmiesasfs2ua( pnu0tpx  fetadfa2umnms t0teerif3oytoptrlnvsls0sexoim3iudom emfeils)a2uau o;t1aleoio3iys mDem(ms;u4 exoxf3io1lm e iei;t) rumxo iodalenmneta( arrrurpno4aex mf3ils a rauvsn()teenmf3to1lmtranes t0t2xm(rpou4lmtnlivtas  rrm(rp;o0tle mfciasfs ul(ms u0aetrifcoa1fpD an il( teum(m3iu1lm n nci t)artax oot4oleomfciyt a rlu p u0aeenio ia1lm r u ols0 2to(mpiydam n ncslt srtaxm ;t4olenifciasls2eauvpnu4altnmr oytfmt lueols0 exm(m oodope miesas s2rrxrpno4tlt  i3tls mDua(vo;t) etrmo3iadfmtrln i;()t2umim nodoleeliesa(fs2rm( p;u4openmoeildfa2ul(mo (4texoxf3tadlp ran slt t2trxo iu1lpt mncil(fa2ta( pnu1alxomo3iltfa em(mpnu4texnxociy1omD anvi t  eur(opnu1ol  mivils a2rmum ou0texnioeiad m uluvo;u0 etrmr tydfaD  nes;()sexrir3oo1apt  netat)a2taur nu0apt iiciaslaDemnvs (4tltoifcoy1lmDranvs;(  2xoxm no4oleelfes tfsDrrurono1apxomieildfa uau s;u)arermr tydoateluei;() etoxo oo1ape mfvsl() 2ua(root1teen o3ilsfa2uan o;u)alxnif iotom  auvi;( t2um(r3iodlleemieta() rtm(  nt0tpeomfeiys s2rmn o;t4alxrxo oodfmD an s;t0 rtriopio4op nlicilt)sDua(m nt0teeoifciatfsDemumo;t0artoio3oydlmtean s;s teuoir3oy1op  lfeslt aDtmumpno1olto oeildlsDrm(mpnu)aeenxfciy1lat  nvo;s texmxopou4ameelneiatfaDra( p;u0olt  f3iad a rm( pnu4altnxo3iatoa eaies s)trumio3oo1altelneia(f rrrurpnu0tet  feiydfaDulumsnt0tlenxr ty1fatr u o;s0trurir3nudlp n nvsl() Dtrur nu0opt ioctys aDulnvont0aexrmf3tadfp e ieil( s2tmxmpoy4optemfcias)aDrr(  oo0olen ieiaslmDrlnvo () ltnmoctatlat li s 
\ No newline at end of file
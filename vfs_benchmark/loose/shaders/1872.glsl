@@ -0,0 +1 @@
+ivs;()teurxmpoy4lpeemnvs (  Dumx  nu1oeenmfeilt s2elnvpn(0artnmr iodoaDrln o s0 2xmir oydlptemiesa(f 2rrum ou1olt iieiltlsDranvs;(0 rtrifcto1fatrlivi;t)trxrxrpoy4amtnmietat)arua(ro;o4texo i3iatls2rlumo;u4aeeoxocto1omD lu o;t s2xrxopoy4lle mfcia(f rrrx o;t4tlenmi3iatfsDelumonu)teeoir3iotoaD livs;() rtoim iydopee ieiat)sruaur ;t0tle iociasfm2ulnvo (4tleoir3todoa  li i s texoxo3iy1ll nlfcsls) rtau p;o4olxo ociytlm ean pnt0trtnmociatlm eai s;t)t2umxrpnu1lp n nvilsfa2tr(m ;u0aee ioeiysfs2ean s;u4arenif3oydlatranes (0seuoio nu4ll nlnvtat  rra(rpno0alxomfciasla2um(mp u0aetrir to1lpDe ivil()t2toim3oy4llt mfctls aDrmurp;t0tptnmi3iltfs elu o;u)teeoio3iy1oa r ieo;t)tetrxr3oydoltemivil( artmxmpnt4oexomietltlm2rm(mo u0aeenxfcto1fp rlu s s s2tm(m oo4oltelicsl(fsDta(r ou0tpeo fetasfaDemn sn(0 rxoxfciatla elu i;( trto(o nu1lp nlnctas)a2ta( o;o4teenmieiatlsDulu s t)texnio3ootop e ieslt0 2xoxm iodop e ivils arraxrp;t0apen fciysls ean o u)tleomo iatfa  ai o;t)tetmiopnudlmen ieilt)sDuru pou4alt mieiyt aDua(mp ()aeenmf3ootlat lnvs ()srtrir nu1openlivia(f rtr(mpou1apt  ociatfmDrlnms (4aetrmoctadopDrln ols)s2ur(m nu4al n netltfaDtaum ou4tlxoifciatfsDel(monu)alxrio iodfp r n s;s  rtrxm iy4ll e nvi ()arrrx ono0tpt  feiysfmDumnmont) lerif3oytopD lnvs;s) rtr(m3iy1apeeliciat)sruaxmoou1altniociad mDrluvpn(0tlerxf oa1fpt lu s;s0srxrxo iu4olte fci s  Drrx  oo0oltoio3iytfaDeanmonu4aexnir3totoaDrluvolt  2xm(opno1lpe lfvia( srta(mpot4oee moeiltfa umuvo;t)aetomfcoadla  luvs;()t2xr(mpoodoptemnes (f Dum(m ;t0optoifeiyd aDrluvo (0trerio iodlpDran olt)s2toxm3nydlm  mfei t sDrr( o;t0open ociytfa ul(vp;u4 exrmocoydoaDraivilt s2xr(r3iudlmtemfcta( s2urx oot4aexoif3tltfa2eaumo t0tltrifcta1fatr neolt  rxr(m3iydam nmfcias sDtrxm ;o1tlto oeilt m2elums u4 lerxfcoatfp  luvo;s) 2trxo oydlpe  icslt  Drrxmont0olto fciasla ean o t)tlerio3oo1lpDr u sls trtoirpio4ame liesas a2uru oot4oltomociytfaDem(mp;u4aetrxo3iytopDe nes;() rurio3oudlmtelicsa(  2ta(m no0optnmi3iasfs2umn snu4 rxnif totfpt  uvo;t  rxmxo3iodlle lfei ( aDrau pno4tpt mieiltlm2rm(von(0altrio3iodopD au i t)sexrxr iudll   ivt t)sDuax  ;o4ape ioeilsls2rlu p (0 ltrmf3ia1fatelu s;(  rum(m3iy1olenlicta(  rta( ono4aetoioctldlsDul( p u)aexnio iydfaDrlies s)t2um(m3io4omtemieiatfsrraxmpnu4oex  i3ild aDrln snu)trerio3iotfpteaues;( sexrir nydlpenlivsat) Dur(r ou4apeo ociydls uln p;u4aetoir3ty1lat luei;(0 eum(o iy1opeelnesat)sDtax  ;t1tltniiciltlsDumn p u0trtoir3iydfmDrauvi s) 2xmxrpoudop n nct sf rtr(r ot0aeenioeiys mDrmuvsn(0 rerif3oo1om eanvs s s2umxr iu4am emnei (  Dta(m ;u1texo ietadlmDeluvs;t4 eerxrcoy1lmD an il(  2xr(mpiydlm nlieiasfartm(  ;u0tpxniieiydla2em(von() rxnxo ia1lpte n i (0teumxr iy1op  lies t a2tr(mp;u0alxn ociat s2ea( snt4aexnmf3to1omt anvi;t  2uoir3no4ape lietl(fsrraurp;u1tlt iieiyd a2em(vpnu4 lxrircoytfaDrluvi t) rxrxr3iy1amenlnvt t  rumx  nu1oee mietyslm2rlums u)arxnmr tadlaDrln ols)s2um(o oo4altnlfcils  rraxr oo0altnioetldls2ul(mpnu) renxf3ty1laDraivil(  ruoxr3ou1aleemict sf 2umur oo0tpxn ieilsls rmuvsnu4 rxnir3iydfptrlnvi;t0 2xr(m3no4amt  fvsltfa2tmu  ;o0open oetld m2elnvs t) rxnir ty1lm rauvi s0 eumxm ny4am eliei s sDur(m no4optnmieiyslm em( p (4 etrirciydfa eauei;(0trtoxr nu1alenlneiat aDumum nt4oetniicildfa2em(vpnt4tltrxf3iatfaDeaivil(0sexoxmpiu4altn ictl(fartmur ;o4ape  icildlsDemn s t) renmfcio1lmtr nvs (0tetr(r io1am emnes (  rtru o;o0alx miciatlsDran o u4areriocio1omD  u i;s)sruoio3oudll   fvt sfsruru onu4ape mo3tat m2rl( sn(0altnio3oy1lmteanvo;s)sexmxopoodom   fvsa(fsrrmxr ou4tleniietydlmDumuvs;t)tleoxo oy1op   u s;s) exo(mpoo1lpt mfetls sDrmu onu4texo o3iadlmDeluvs;t) rxnxfcootfpD  u o;t0 rxoio3oodllte ieias) 2urxr nt4tpeo iciasla rmumo;u4aetoio ia1fpt aueilt  euoxopou4ll   fct s arrr(mo;o1ope if3tldla2ra( s u)aetriociatfm  aivil(0sexoio oy4open nvtlt arta(mpoo0aptnmfetydfm ua(vo () leomrciy1oa e nvs () rtrirpiydoptnlivslt)srtruroot0oet mf3iatls2rmn s u)aeermf ty1fpt aieo;( trtmxrpoo4amt liviltfa2tmuront4tex io3iltfs2ul( snt4aeenmfctydoaDrai olt0t2um(mpnudalen ics ()sDra( p;u0oee mfetlslm rmumpnt0trtnxo iadfmt  n o ()seuo(m io1ap  micsls)s2ta(rono4altomfeiltfmDua(vo;u0alenxo3tadfpDeai sl( teuoio oy1openlnvia() Durxr ;o0aeeoifciytls em( o;u0 lxrxo3iadlaDrlu sl(0trum(rpio1ll emfeslt) Dra(r ou1olx iictyt a2uanmo;t0trxoxf oadomDelnei;t)t2xrxm3no4ll e iet ( srtrx  ;o1tetomociltfmDranvs;t4tlxriocoo1omDraivol(  rxo(r3iodol  lfei s)srur( ooo1aet iietyt aDum(vo u)aeenxoctotoa   ueol(  2uoio oodamtn fesls)sDtm(ro;o4aet  feiltlmDea(vont)tlxrif3tytfat lneolt)t2tr(o3iu4lpen iciltfsrtmxrono1altnio3tys a uanmsnt4 ltomfctytlmDeanvo;()t2um(m3ny1open nvsls)srraxmoou0oetnif3ilsla2ul(mp t0alxnirctotfatelneo;( s2toxrpiy1opt  ici ( aDurxrpou1ope ii3tyd s2rlnmp;(4 reoir3oydlmDe ivsls s2um(m oydom  mietlt) Draxrono4tpxomieias s emu o t4alxrif ta1lpDeaivil() exmxopou1omtelfesls srur(rooo1ale mietlt s2uln s t4 renmo ta1laDrli sls  rtmxr3oy1ameemivsas a2ra(moot4aleo oeiyd sDranvp;u0 rxnxf iy1faDrauvol(0seum(o oudolt mnct sf 2raxm nt0oee mo3iat m2ra( p t0 ltomf3ty1faD  uvs;()trtmio3oydop   fesa(f 2rmxm no4apeoiociltlm ra(mp;()tlenmo oadla eau s;t0sexmirpoudlpee fct sf Drr(monu1oexniieiyd m emnvsn(0tlxrxr3oo1laDrlueslt0 rxmiopiodamt  icslsfsDur(mo;o1apxnif3iat m2umnvp;u4tltomf3iydlp eanes;(0seurxr3nudll  lncsat)aDrr(rp;o1aet miciad m2rmump;(0 rxrmrciy1fmDe ivo;(0s2umimpoy4lpt lneilsfa2tm(r no0olx mfetat m2um(mo;t)teeoio3tadlpD  u i t0s2to(mpiu1apte ivils  rur(mo;t0tex iieiat aDrmnvonu0 rxnxf iodlmDrluvo t) euo(o io1al  mfvsl()aDrau  nt0oee mfciytlmDumumsn(4 rtoifcoodlat  ieo ()setrxr3ny4lptelicils)a2rrumpou4apxo fetysfaDrm(vo () ltrmr oydfatrai ils s2tm(mpoydamt mivsl(f rtrurp;u4oleomietatfa2eluvp;(4 etomr oodfm eanes;s)t2urirpiodlmenmieiatfs2rmxmont4tltnmo3tld sDumuvp;(4tltnxo3io1laDe u s s0tetoxr io4omt  ivils s2rm(r ou0tlx iiciatlaDumn snt4aexnxr3iadlmDeln i s0seuoim iydapt lfesls)aDraxr nt0oltnioctyslsDeaump;u0alerxr iodfpD lueo;s0 exoxopou4altn ivtas)aDumum ou4oetn o3iysla2ul(msnu)aeenir ta1omDe iesls) 2umir ny1opee fvt s)s2rmx poo4tpeo i3tadlaDeanvp;()tltnmoctotlm eaneilt0setoxm iu4lm nlfeia(fsrtr(rooo1tlen o3iyt m2ul(vo ()aexnxrcootlp eaueol(0 exoio3nudame lncslt)artmu pno0oltn ietas m2umuvsnu0arxrio3oodfaD  nvs s  exmxrpiu1lleemics () rum(mono1altnmiciat sDul(vs;t4trerif oadlmDe neo;t0setr(o io4lmeemfcias srrrxmpnt0openmi3ildfs ua(ms t)tltrmrcoodfaDeli s ( trxmir no1llte ietls)sDtrx  ;o1apx mo3tytfm rlnvo;(0tlxoiocoy1la e u il(0 euoxr3iy1lpte fetl()srtaxr ;o1oeeoio3iatla em(mont)aexnmr3tatlpDrlnvsl(0 2um(m ou1ameemiesa(f ruru o;u4tex  ictydfs2eluvs;t)tltrxf3iytlmt an o;(0trumxm iu4omtemfesas s2ur(rp;t0apxniieiadlmDulnms;() etrxr todfaD luvs;s)sexoir3io4omeelnvs t) rum(m ou0tltomo3tltfa2rauvp u4 renmo3iatomt luvo;s)sexm(m oo1al nliei t  2rm(mpou4aeenifctatfm umu s (0 eenmr3iy1fmDeaues (0 2xmim3nu1apen ncsasf 2taur nt1tlx  f3iydlmDrmuvo (4artrxo3oo1opte ivs;() exmxo3iy4lmtnmicsa( aDtmx  ;u1texn fcils aDuau s;(0aexrif oydop e ies;t0 euoxr ny4olenmfct () rtrxmo;o0olxomictltfsDrauvp t0 lxnmr3oodlm eaiesl(  etr(r no4ll nmfvt ()srtmxmpoo4opxnioeiad a2umuvs ()artnmr tadlp rli s;s  rxmxm3oydll e nctlt srraxro;o0oet if3iys m2um(vo u0 rtnmf3tydoptr neslt texrxopoo4lm  mneia()sDtm(ro;o1aeenmf3iadlmDea(vs;t0 exnir3iodfaD  u s t  2toim3nu1ll  livilt  2uaum no0ale mf3tasfs2elnmo t4 lenmf iadoatr uvol()srxrxo3io1lpt miet t srurxr ot4ape mi3ildls2ea( snt4alxrif iytoaD livs t  2um(r3io4op elivil(faDuax pot0opx  feildfs ulu snu0aetnio3todom ean ils0truoxo3iy4am   ncsa()s2rmuronu1aex mfeilsfsDumu o;(4alxnio iadlpt an o ()s2uoirpoy1om n ictas)a2ta( oot4teeniiciysfm uauvp t4trtoxf to1fpteaues;()trtoxrpny4llee nes ()sDumump;t1tleniictaslsDrlnmo t4aetomrcty1opDr ueo;( sexr(o oydale lfcs ()arrrxr no1aexo ietldfmDrm(mpnu4 renxrcoo1fm r n s;()trtmiopnydam elivi (fsrur( pnt1tet mo3tasfmDuln p u0arenircootom r uvi;(  rtoxo ny4ap  micsas)s2raumo;t0opx mociatfs2elnvp t4arerxr tatoat an o s0t2urxmpoy4am  mnet tf 2ra(  no4texo o3iydlmDran p;t)tlxnxr tydlaDelnvi t0 2toxo ou1lm nmneils  ruaxr ;u4olx  oeilsfm2eanvs u4altoif tydlmDeai o;t) 2trxrpiodlptemnctls)aDururoot4optn f3tydlaDrm( o t)tltrifciytfp r i ilt trurimpou1oltelfci () rtr(mpoo0tlxn i3tad s2rlnvp u)treomfcia1om r ies t0 2xrxr3iodaltelnesa() rtr(mpnu1opto iciltfm2rau o;(0trtrircio1fpt aivo;t seum(mpiy4lmtnlfet () rrmx ono0oltn fctad a2emnvp;t)teerxocia1oaDr neol(0 2toir3nudlm elnetat arrr( pou0olto feiydls umuvsn() rtrif3oy1fa ranvols t2uo(o oudaleelfvsltfa2trum oo4tpe  iciat a2rl(mp t4texrmrcia1lmD anvs;s0trumxr3nudamtelfeils srrax pou0tpe moeiydls2uln s u4trtnirciodlmtr u o t)t2toir3oudlm n ivsa() rumu  no1olxnioetlt m umn p;(0artomo totfp r uvil(0srtoio ou1lptn fvtl()artaumo;t1tle miciad aDem( p;u4aexnmfcoo1laDe ivs;(0 etrim nu4lptnlncilsfs2rrxro;t4olt  f3ild sDrlnms () rtnmo3tytlat  ivils)t2tmirpou1ll nlnet s) Dtrxm ;t1tltnmfcilsla el(msnt) exomfctotoatran i t)texmirpio1olte fcil( sDur( pno0oleo oeiadls el(monu) lxoxr3tytlm e u o;t0truo(o3oudlle  ieias)aDtaumo;o4tlen feiydlm2eaumonu4 renmo oo1fatrlivo;t  2xoim3oodopenmneta( sDurxr ;o4opxnmicildlm2umn p ()alermo tadom rln ol( srxoimpno4ole mnvt () 2ta(m ;u0oexnmoetldlaDrlnmp () etnmr3oy1fatr n s s0s2urxopoydalee ncias s2tr(mp;t0ape mi3iadfmDumumo;t4tetrifciadom raies (  rtm(opoudap   nesltfs2trx oou4tleomfeiyd m em(vs t4aetrir oydlate n o;t)texm(rpiodlmt mivta(fsDtaxm ou1oetoioctasfmDul(vs;t) ltnxf oadla rlnes;s0 eum(m iudamt  icsasfaDraum ou0ale  oeiad m2umn s;()teerxocto1lmtelivi t t2ur(rpno4opee neil( sDuaxrpou4oexoifetls s2rlnmpn() exrio to1lp eanvo s trum(m ou1ame lnesas)a2tmum no1tet mo3tls m em( p u4 eerxr iodfaDeanvs () exo(o oo1lmt lneia( aDrrxmoou4aetomoeiysfaDem( p u)trtrxf3iydlm ranei;t0s2xmio3nydolt mfcsl(fsrurumpnu0altnmiciatfm2elnmo;u4 rxomo oodom r ivil( srurio3iu1lmtnlicias  ruaum nu0tpe  f3iys aDelnmp u)treoirctatlmtrlu slt  rxmxo ou1lmee ncsl(  rrruroou4tee mfcilsfsDrm(vs;()tltrif3oo1lpDeluvil()trtmiopnydlmeelnciatf rtmxmpoo1aeeo o3iyt m elnvp;u)tlxomf tatlateauvi t0t2uo(o iudope lncil(fsDrauroot4opx miciydfmDrlnvpn(4treoxo3iatfpDelueslt  eum(m oo4ape  nci sfa2rau  oo0alxniociys a2el(mo;t) lxniocoodfmtrln olt0tetrimpnudlltnlncia()s2ta(mp;o0opxo icilt sDumnmon()aeenif3io1lp  aivil(0seurim3iy4lmtemncsatf 2trx  oo1tltomoctldfm2uanmpnu4trerxrcoa1lpD luvi t sexmxrpnydalenlies sf ruax pno0aetniociyd sDuanvs () renxf iatomDr ueol( setoim3nu4open ictl()aDrm(m ou1tpxn fetlsls ul(ms u0artomr ta1fmDe n s;s teumxo3ny1al emieia()sDuru  ;o0tpeo f3iadlmDrmuvp;u4 ltomrctytop ranvo ( s2xr(o oy4apenmietl(faDtruro;u4teeomietyt s em(vpnt0 eerxr ta1lmtrauei;s trtmxm3nu4om n ncsa(fsDrr(r ou1tpx ifeilt mDeaumonu0 rxoif3tytfaD li o t)tetm(rpoo4am n nvi t)sDraxrpou1apt  ictat s2elnvp;t)artrio3ty1lp   ues s0texmxmpny1ome  ici tfartmurpot1aleo ociydfa ea(vpn(4aeenmf3oodoaDrli s t trtrio ny4apenmietlsfsrtau ooo1tlxnii3iad m2rmnvpn(4 leomfcoytomtrlnvolt0sexoim ny4olte ncs ( aDtrxrooo4aetoiietasfs2ulnmont)tlerif3todfa rlu ils)trxm(opiodaleelfesl() Dum(m no1tltomoeiad m eanvs;u0arxoifctadlptrlneslt trumxrpiodalt  iciatfsrumumooo0aetomf3iltlm2uau pnu4altnxf ta1latr nvs s  2tr(o io1aptnmnciltf Dtmxmpno4tpxomociytlsDemu p;()aexnmf oadfatraivi;t0t2urxo ou4olt  ncsl( arum(m no4opxoiiciysfa2umuvo;(0 rxnxf oodomtrli s s trumxmpny1lmtnlici tfsrrax oot0tpxnmieiltlmDulu s;u0 rtrmo oodfmDe nvo s trxm(opny4olt mfcsasfsDurxmp;o1aptoifetldls2elnmo (4trtnxr ta1fatelnes;( trumxmpnu1ape mfcs sf 2ra(ronu0tlxn iciyd sDuluvsnt4 renxr iy1fpteauvo;t0s2xrio3nydaltnmfcsatf Dtm(r ot0teenmfciadfsDrmump t0trenxo3oydoa  livs t) etmxo3iudoptnmfcsat srurx poo1altnmo3iydfm2rm(mo;(0alermr oo1oaDr neo s)texoir3nu4op nmict () Dumumo;o1tpt moctatlsDemuvo u0tetnxo ootfatraueol() 2tm(mpnu4apt liesas)s2ur(mp;o0aee  fetadfa2eanms;t0 rtnxociydoa  lu i t teuoxm3oydlp e ncta(  rumur oo4tpxn ietys a umnmp u0 lxnif oatfpteluvilt)setm(r3nydope lfcs tfsrtax poo0ale  fciaslm2ran s;(4aeermr3oodoptr nes;(0s2uoim3oodaleemfesa()a2uax pot0apx iiciasfmDuanvs;u0tltnmfcoo1lmDrlivs;() exo(r io1alenlfvil(f Durx  ou4tle mocilsfmDumnms;t)texoir3totlaDrluvi s  eum(o3oydlp nliesa( sDtmu  nu4tpeomo3iasfs2ea(vsnu4aetoio oo1fa eau i s0 2xoxmpnu1lm n feiat  2taur ;t1tpxoif3iytls2ua(vs;t4 exomf oa1fatelu s;(0seurxmpnodam nliet ()srururp;o4tltnmf3iysla2elnvp u0 rtrifcoydlm eluvi;s)teumimpno1lpen netls  rua(  ;t1tpxniociat s elump;(0aetoiocoodla rlivolt  rxoxm iodomtelicilt sDuaumonu4tptnmi3iysls ul(vs u4aexnmr oydoaD anvi;t0srtr(mpoo1lmtemietas) Drau pnt0opxomi3taslm2elu p u0 eerir tytoptr i o;s) etmimpoo1oleelfeil()arrmu pnt4oltoif3ilt m el( snu4alxnxfcoydop rauvi;t0teuoio iu4om n ieslsfs2ur( pou4aex iiciys s2rl(mp;(0altrio3ty1fmD lnvo t)texoxm3iy1ol   icilt  Drax pno4teeoifeiytla2elu snt)tlxnxo3iatlpDeluvs t srxmio3iydoptemictasfaDraur ;t4tlt moetat a2uluvsn(0aexnxo3iytlmtelneil(0srtm(r3iy4opte icia()aDraxrpou0ole  o3iasfs2ua(mon(0tlenmo3oodopDrlueilt)texmir3no4opeemfciatf rurxm nt0olto oetyt mDel(vo;t0areomrcty1fpDranes s  2tmir nu4lltemncsat)a2tmuront1tet  ietat m2rm(msn()arenmfctotlpDr uei;t teto(m iodam  lnct s sDrr(r no0apt iiciydls ra(monu4aleoio3oa1la   n ol( srxm(o3oo1lp  mnvt sfartm(moou0tpe  i3ils mDea(mo u4 ltomf3iy1oa   uvo;s) 2uo(o nu4omenmict ()a2ua( ooo1apeomoctydfs2rmumo t0teeomf3oadfmtelivo;s)tetmxo ou1opt mictls) 2rau p;u0altoiicias sDea( onu)artrirctodoate n s;( s2toir3oydlmee fci (fs2rr(r oo1tex  ietad sDuanms;t) exnioctotfmDrlivs s0 eurxr3ny4ap elfetls srum(rpno4tpxnmieild mDrluvo (0tlerxrctydop r nesls trxoxmpou1ol e ictatfaDtr(ro;u4tleoioetysls2ra( on(4arxrirctatfmtraivs;t trxm(m iu1lm n ivtl(fsrur(  ou1oeeniociysfmDuanmpnu0trxrxrcoydlatr nvi;t) rto(r3oy1ole mivs ()aDtm( o;u1tpe  ictatlm2ulu o;t0 etrxr3oo1fpDranvo (0sexoimpoodopteliet ()s2rrxr oo4aexn ociydlaDumn o;(0artnircto1fm elnvi s srtm(rpiu4lm n fvsa( sDum(  ou4aexomfcildfs2uln pn()aexrmociadfpteluei t)tetoxopoo1al  mieils  rtrx oou4oee  f3iyt m2rm(mo;(4altoxo oytlaDraivolt) 2xm(r oydam  micsls  Drr(mpnt0opt io3ildlm ra( s;u0 etrmr oa1la r i i t0 2toim ny4ol nmncias) Dtmx oou4tpx  ociytla2umn ont4texnxo tytlmtr uvsls  etr(opiu4ll  mnvtat  2rrxr ou4apxo feild a ea(vp t4 eeoxrcoydfaDe uvi;s0 2xoio iu4amte feil( arrmx p;t1alx ioeilsfa umn pnu)arxoxr3oadlmDeaivils)teuo(o3iydlmenlfci t  ruaxrpnt0tlen fciatla2elumo;u4aexrmo3ta1om elueo;s0setoxopnu4lmtnmncsl()aDuru pnu4ale moetadla2uaump;t) lerxo ootoa e uvs;t)seuoir iydope  nct tfsrta(m ou0apx mieiasls2uan s;(0arxniociadfpteauei;s0 2tm(m3ny1apenmneiasfsDumu  ot4olxoii3iat s2raums t)artrir3oydop elu i;s texoir3iu4ap  mncsltf Drmur nt0alenmieiysla2rlnmp;u0 rtrxo3tatlpDrlnvols0s2xr(r3nydlltelfcil(  rtmur ou1oee  i3iyt a rlnvo u4treoxo3oa1omtrau i ( s2umxrpny1lpte ict tfa2um(mono1altn fciasfm elumpnu)tetnifctotlmtrlieslt  2um(m nodomenlfes ( a2rau ont4opt ii3iadlm2ul(vp;t) rxrxrciotlpt  neils t2uoxr nudamt  feia()aDua(mp;o1opx ioctyslsDumu o;t4 exrir3ia1faD lueo;(0 2tm(rpiy4ol nlnvt ( aruaxr nu0texn fcilt m2uan s;u4 lxnmr3totomDr uvols  2um(m oo1ap nmivil(fs2rrxronu0alxomi3iat aDum(mpn() renifctytla eai il(  2xrio oy1altnlivsa(  Dtmxrpnu4oex if3iys a rm(vp;u)tlxrifcty1lp   uvs s)tetrirpoudlm n nvi ( srtmu p;u0tpxomf3iltfmDel(mpnt0aexrio3oy1lpD ai s;s0texmxm3no1alte fvtl()a2tax  ot1tpeomoctadlsDrauvs;()treoir3oatla raneo;s0 2xrxopiu4ol   iesatf rtru o;u4tpeomicildlm2em( p (4tetrmo totfp eli ols)sexmiopoydlle  nctas a2rr(  ;t1aeenmociasfsDean p;t) exomf oo1fpt luvs;s0texrxr3oodlm nmncilt) rrr(  nt0opxnifciltls rl(vp;(4tetrif3iydlpDelieo;s) 2toxo3oy1aleeliviltfsDumxro;o1tpeoiicild a rl(mo;(0altomo iotoatean i;s s2to(rpny1lptemnvt t) Dum( oou0alen i3tls aDelu p u4 lxnmr3tydfp eai s (0setmxopoo4ame mivtatf Dtau  ;o4aexnii3tad sDel( onu0 reoircootoaDe uvs;(0 rxrimpiu4ll e nctls) Durx  nu4optoiociatlmDrl(vpnt)texomo ty1optrlivo s t2xo(r ou1lle  ivtasf 2ra(rono1oetoio3ilslsDeaumo;t0tlxrmr3iadfpDrlueols s2tmio3iu4oltemieias) 2ur( p;o4opx mfetatlm ulnmo;t0trxrxocoadlat  u ols0 exmiopou4lptemnetlt)aDtmxrono0tptnmoeiyd m eau on(4treoxr3iytfpD ln o s seuoxrpiodop emncsa(fa2rrurp;t4apxoii3iysfm2rlu o;u4 rerifctytlpteln o;s)texoxmpoydopen icias  2ur(m ou0tpxn o3ilt a rm(mon(4 ltnxf iatfateanvi (0trtoxrpiu1amte ivs sfs2umu  ;t4oee  fctyslmDulumpnt4tleomo oydla elu olt s2toxmpiu1apt  fvt s)s2rru  ;t1tlt iociyt a ranmo t) ltoio iytopDraivi;()teuo(opoudomt mict tfaDtmx  ;u0oetnifcilt m2rmumo t0trenir totfm elies ()srto(o3io4ll  mnctl()aDraurpot1tleo ietas sDumuvpnu4tlerxr oytlpDe ivol(0teurxr io4olen ictasfsrrr(rp;u0alxo ociyt s ra(ms;(0 rxoircoadoa  luvo;s0t2uo(opoudope mfcsls)aDra(rpot4oee iiciasfm2uluvsn(4aeenmf iatoa rlivi;t)srxrim iudlmte nviat) Dumurpnt1oexniocias s2emuvp;u)tlenmo tytfp eaivils)trtoir3no1oltemncs ()s2ra(r nt1oltn o3ilt a rau snt4trxnmo ia1lm rlnvi s)texoiopoydlpenlfcsat srta(r ou1tlx iociydlm2ulumsn()aexriociatlpteaues;s)tetoimpoodopeelivil(faDrrx o;o4tpxniictls a rm( s;t4arxrmr3iotfmDeaueol(0 2xrxr3ny1op n nesas) Dtaumpou1tpxn ietasfs rauvs t0trtnxf oytfmD  u s;s s2umxm nydapenmfvsa( s2rmxrp;o4olx mo3iltfm2rauvpnu0aexrmo3iotlateaivo;s)tetoxm3oo1omt lneiatfsDuaumo;t4tet  feild s2rlumsnt0tlxomrctodfa r u i;t)s2toxo iodoptelivtl(  rtr( p;o4ale mo3iltls2elnvsnu)tlxnio3oydlp  li ilt0 eurim iu1om n nvt s)aDrmxro;o0apx io3iyt s ul(mpnu4 etrio tydfpDeauei s0 rtrio no1opeelfcsl(  2ur(m ot1altnmieilsls2ea(vs;t)tetrxfcto1omD aieols trtmio3io1omtemict ()s2tr(rpoo0olenif3ilsfs ul( s;u4 lerxr oy1oat  ies s  2xoxrpoo1alt lieilt) 2tau ont4ole ioeiydlaDulnvonu)alxomo3ootlp   ivi (  etoim3oodope  ies sf rtrumo;o1tlenioeiyslaDrauvo;t0alxomfcia1fatranvsl( t2umxm nudop  lnvi () Dumx o;u0teen fcild m ua( o;u0tltrmf ootlmDrlu s ()s2to(m3oy4lptnmicsas  Dtaxronu4aeenmfciysfm2rmu sn(4artnio3oydoat lu s;t  etrimpoudoltn ietasfaDrr(mpnt1opto oetytlaDrl(vpn(0tetnxf3iytfpD lu sl(  exmxr3oydlmtnmiesl(f rtru o;u0tltoiiciytla el(vonu)artoxociotfpt an i;s sruoiopiu4lpen ics () rtmurpoo0texo iciatlaDemu pnt0arxrmo3ootla r uvs;s)seur(o nu1omee fesltfa2um( pou1teeoio3iatls rlnvonu) lxnxociytoat aneo t0 2uoxopoo1llen nvilt sDumumpot0oltnmicias s2rl(vo u4teenir3oatfpDe uvi;(0trumir3oodole  ivt ( artr( p;u4tltn feiysls2ra(vs () exrio tydop e n ils) 2xm(o3ou4aptemfetas srta(rpoo1aeto octydfa em(msn(4tlenxoctatopt  nei;()srurxo iu1lmenliesltfsDtr(rpoo1aleoifetlsfsDumnms;()tleoxf oadfp  luvs (0 etrirpnu1lp  lfeta()s2umumpno1tle ifetytfmDelnmo t4arenio iy1opt  nvsl() exm(m iy1ole mivs s  Duau oot4tpeomoctld mDrlu s t4 exnio3ta1omDelneilt0trtrir3ny4apenlnvtl(fsrrrxro;o0aptoii3iat m ra( p;t0 exnmfcoydomDrlu il()trxo(o3oy1lp nmfeiat  Dra(m oo0olen ociat m2uluvs (4artnxr totfate nvilt  rumxm iu4lp nlfeilsf rtm(rpou1aeto ietldls ua(msnu)alxomr3oytoatelu sl(0sexoir io1lmtelfeiat sruaurp;o1tptoifeiatfmDean snt0alxoxr3iadlm eai i;t)sexr(opoy4al elfet (fsDtrx oou0oltnif3tas m2em(vo;t) eeoxf ta1faD li s s0 2uoxr3nodalen iviat)s2tmxr ot1tpx  oeiad mDean o;t4 ltoxociydfa rlu ol()teuoir no1lmenmnvtas srra(  ou1tpx mo3iysfsDel(ms;(4trtoxr3oatlpDrli s;s)t2xoxo3ou1lpe  fcil(faDurx  ;t4altomictat mDumnvsnt4 leoir3todoptrlivs ()seurimpou1alenlncs t  rrmum ot0alx mi3tydlmDua( p (0tlermociatopDe n o t s2xo(opnodlmen icils)a2tmxroot0openif3ildlaDum(vs;u4tltrir3oa1fmte i ilt0 rxmimpiy1ap  lnetas)sDra( oot1tpt  ictytfa rlnmsnt4aexrmrctadlmDeln ols t2xr(r3nu1ame  ictl(  2umxr no1teeoio3tasla2ua(vo;u0alxrxrcio1lpD lnes t)tetoxo no1al nmnvs ()srur( onu0aptn fciytlm umnvont)alenmo iy1op  li sls0 2tmxrpiy1ole mfci ()srrm(m nu1olx mf3tatls2em(vp t4texrmfctodfm eanvo t srum(m3iy4am n nvtltf Dtaxrpot0oee io3tas s2uaump (0tetrmf oadfmte ueil()tetrxopnu1opte fci (farta(  ;t1olxn fcilslaDem( on(0alenmo3tatomtelies t)seurxo iodomtnmiesl() Drr(rpot4tpenmf3tldfs2el(mo u0arxrxr ty1lmtrlivi s trtoiopou1amee nci t)aDuaump;u1tlxoiociat m emnmonu0tlenif3oytomD  u ilt)tetrim oo1lme  ncia(faDraumoot4tpxn fciydfmDelu o t4 etnxocto1lat  ivi () exoirpno4op n ictlsfa2tmxr ;t0oltn i3iydfsDrmu pn()tltrxr iadlate neo s)srtmxo iodom  lfetas a2rrx pnu1opxniociys s rln p;(0 rtrifcta1om  ai s;s s2toir iu1amtnmfvsa()srurxmooo4apen fciyd a umuvo t0arxnxr3oo1op rai o;()trxmxr3iu1olt licsls)aDurxm ;o4texnmictadfs rauvsnu)tetrxr3iodla eli o t)s2xrio3oydap nmiciat)srtrum ;o1oltomi3iatls rmnvp;u0tleoxf tydfat ln o;(0 rxo(mpnudomen ici t)srumxmp;t1apx moeiys aDrmuvs (4trtoir3tytopDe ies;t0 eto(r3oudopt mfvias s2tm(mpno4aptn o3iysls rmu s t) exoif iytlpDrli s;t0 rtmio3iydameelfvsat s2taxr oo0tlx ii3iatlm2raumsnu0arxomr3iy1la  lneol()trxmxr3iu4apenmnct (fsrua(ront1apx  fetldlm uau ont) etoxr3ia1fmteauvo;t)truoxr oo4apt mnvtl() 2rmxro;t4tpx iieias mDeln p () rtnio iodfmtr n s t)s2uoxmpoy4lm elfes tf 2umx ooo0oleomieildlm rm(msnu)tetoir ty1fmDeai o;s)s2to(rpny1lp  lnci sf 2tm(mont1tleomfcilsls uauvpnt0 exoiocoadfa e nvo ()s2ur(m3iu4ameelfeta(f 2umu  nu0olxomf3iysfa2ul( pn(0alxnio3tytlp   uvsl(0sruoxo nodop nlnvt tfarrmur oo0opx mo3ilsla2rlnvo;t4 lxnif oatfa ranes t0truoim3io1op e fetl(fsDrr( oou4tpt iieiytlaDea(vo;u4trtrmocoadom r uvs;s)texoio ou4lmen ietasfaDrr(mp;u4aee miciat s ulnmon()trtrio tytla raiesls)s2xmxmpno1aleemivi tf rtax  no0aptomo3iadlm2eanvont0 eeoxr oydfat  n o;s)s2uoio3nudllt mfvilsfs2rmxmpou4opto o3tydlaDulnvo;(4trenxr iydop  liei (  rtrxo3oodapt lnesas) 2rm(mont4apxoiictltlsDrauvp u0 rxrxfcoa1omDe ueo (0srxr(m ou1apenmfetas)aDrr(  ou4tpx  f3tlslmDra(vo u4texoirciadla rlueo s0s2uo(m3oy4om elnei s  2umuro;o1tpxomo3iyt a2ulnvo;() exoio3tydomDelneo;t0t2um(m iy4aptelfeiltf 2rrxmonu0alxomo3tatfa elu p;u)aexoxoctatfpt  ieo (0s2uo(r3io4am emnvsa() rururp;u4oex ii3iydlaDul(msnu)aleomo3ta1lmtr i s;s0 2toiopoo1aptnlncslt)s2raumpot0oexoii3iysls2rm( s u) rtoxociotfp rlivo;s)s2umxo3oy1lme mfet s)arumxm nt1tpxn ietyslaDranvon()tltrio3tytomDrli ol() ruo(o3nudlmenlietatfs2tmumoou1aetomietytfs2eauvp;t0 rxoxo3oytla eln i;(0 exrim3oydamtnlfvt tf 2rr(mpnu1olx  icilsls uluvs u4alerxr3iadopte nvi s  2toxm3iodlmee fetls artm(  ;u1tlxo ictadlm2um( s t0 rxnxo3oa1op  aueo;t0tetr(r no4lptnmiesas sruaxm ;t4tptoioetadfs2ranmo;(4tetrmrctatomDelu i;t0trtoim3oudoltnlnvtl( sDta(mpot4tlx ii3tytla2emumo u)trtnmo3iy1faDeluvo s)t2trimpnu4ale  fvt (fsDrmum nu1tpx io3iytls emnvsnt4texnio todfptr uei;t srxmxo oudope mfvias)sDurxro;t0apen ieiytfsDran o t)texnxo3oytom  anei t  2trxo3oy1amtn nes t)s2urxronu1apxo iciytls2elnvont)texrmoctadlm  lu sls srtr(o oydaltelfcsa( s2umum nu1tltniieildfsDem(vs;() etrmo oa1oat lnvilt0 euo(r3iu1aptn nvil(faDumur ;o0tptomf3iad s ra( pnt0alermr oo1fm eluvils t2xrxr3io4oltn fctl()aDra(mpnt1tpenmoeiytfa2emnmont4tlenif3todfp e neolt) rumxr3ny4ol   ncs t artrum ;u0oex  i3ilt m ran on(4alxnmfcty1lm eai sl()trxoxmpou1amenmnct t)arurx o;o1oleomf3tltfsDran p t4 rerxf totoa   uvs t  rurim3iu4omeemivtlt) Dum(ro;o1aex  ociysls2uaums (0trxnxo3oadlp  aueols  rtrxm nu4am e nci t aDra( p;t1apx ifciyslm2ea(vpnu0 lxoxr3oy1lm eaues t srumio3oy4apen fcsls srtrxroou4open o3ilslsDulnmp (0 rtnio ty1op   n slt) 2xrxrpiudomenmict sfa2tm( o;o0tlt  ociyd s rmu sn(4alerxociydop rlies ()seumxmpno4lpt  iesa() Dtmx  ot1tltomfciadla ra(vp (4 eeoir oytfpDr uvi;s trxoiopiodllte fcta(  rtaxm ;t0olen f3tatfsDean o u)texomf iotfm eliesls t2xrxr3oo1oltemnviat  2tau p;o4tle mi3tadlm emn p u)trenxfciatlpDraiesls  ruo(opno4amt lnesa( aDumump;t4alto o3ildfaDem(ms;()arxomrciydlmtr ivs s)sexoim ny1lmee nesltfaDtmur nt1oexoioetldfs2emnms;u0aeeoircoodfa eaivils sexo(o3nodom nmfvtas)a2tr(ronu4alx mi3iyslm2emu snu)texomf oatop elivi (0trurim3nudop nlfcta()srua(r oo4olxomf3tys mDelnmp;(4aeeoir oa1fp e neolt srxoim3oy4ole lfcs s)s2urxm ;o0alt mfciysla2uluvpnu) rxrxo iydlaDe neils0trxrxo3oo4lmtnmieias  Drmuroot4tlx  ieilsfm2eauvont4tlxnxr ta1om eanvo;(0s2urxmpnodape  net t)a2trxr no0aet  fctlsfs2rau p u0tlxoir iodom  auvi;s srxriopoudaleelfvtlsfa2urxm ou0tpeo ietldlm2rln o u) eermr3ta1laDrlues;t srxrxr iodllee fes s srtaxmont1alxn o3ildfaDrm( pnt4teerirciatlmt  i il()srtmio oydomtnmfvsas  rtrxr nu0oltnmoetadfmDemu s t4areniocoydlp e ieolt0trxrirpnudolt lies t a2um(mono0altnioctatfsDul( p;u)trtomr3ootfaD  nei ( s2um(o3nydam emicils)s2raur no0apeo ieiatfs2eau p;(0 exnmrciatoa r iei ( s2to(o iydaleemneils)sDua(rp;t0tleo f3tysfm uluvsn(4tltnmocia1fatr ieil() rxrimpiydol n fet tfaDtr(roou1aetoii3iytla elnmonu)teerifciodlm   n o;() exrio3nodal nmietat)a2rr(r ot1oex mi3tyd aDua( ont4tlxrxf3iadoaDrai o;(0 exo(o iudlpt micia(fa2ua(  ot0oeenmfetldlmDumums u0trenxf3oytfatrlu o ()t2to(o oo1ll   nvtlt) Dtmum ot0opxoio3iytfs2umn o u4arenxoctotoptrluvi;( texo(o ou1am elivsl(farrru  oo1aleoiietysfs rlnmo u0tlxrmr3tydfaDrln s t)t2tr(r3oydale mnctltfsDrruroou4aee if3ilt s rluvsnt0arxrmo3tydfp   n s;s)s2xrxm3ny1ol n ncs (  Dtrxmp;t0oleoiociasfsDelu p;t4tetoio oa1oateln ols  2to(r3iydopt  ietatfsDta(rp;u0ale  ieild a rm(mp;t)arxoio oytfm   nes s0 2uoio3nydlltnmnetlt  Durx pnt4tpeomiciyd m2rm(msn(4 exoxr oo1lat  i s;s0trur(o io1omtnliet (fsDua(mpnt0alenmiciad a2um(vp;(0 eerxf iydlaDr nvo t t2toim ny4optn nesl( arrrur ;u1tpe ifeiad sDra( o;(4aexoxo io1omD aiei;t0trxrxo nodomee ivs (  2rmxrpou4aeenioeiytlaDeau on(0 rxnmfcootfa r nvol() 2xrxr3ny4alen fvs s srtaxro;o1apx mfetadls emumpn(4aexomr3ta1oaDeanvo;t0 eur(o io4ame mnes s)aDua( poo4oeen f3ilt sDeaumo t) lxrmr oydoptelu ils t2trirpio1lp nmivsat aDuaurpnt1ale iieils mDua(vsnt4 etnxrcootoaDrauvi t0seto(rpou4lp nliesat)a2ua(  no0oet moeiaslaDrm(mo;(0 rermo oodlmDr ivo (0 exmxopnudlle  feilsf rtrxm nu4tlen ieils aDrm(mp;u0 renxf3iodomD ln i;()texrxm oudlpenmneilsfsrtaxm ;u1aet mociysla2rluvo;u4arenmociy1laDr nvs;t) rxrxo3nodolenmnvi (fsrtru o;t0aeen f3iadls ulnvont)texnmocoy1fmteaivo () ruoiopiy1op nlfeilt s2tmur ou1ope moctadlmDulnvo;(0trxrxo3tadopD  i s s)tetm(opoudamenlfctl(  rrmxrp;t1opt ifctasla2em(vp;()aetrxfcoodlm rlivils setm(m io1omtnlfesatfsDta(m nu4aetnmfetydla rln snt0aeeriociatlmtelnes t  eur(rpiudomee ivt () Dta(  nu4aeeo i3iydfm2uauvsn(0tlenmr3iydfaD lieslt0trumxm3oo1olt livsas s2tm(mpno4tle mo3ilsls2eln pn(4teenmrctatfaDelnes ()tetrxo3ou1altnmiei tfs2ta(mo;o0tetoifeiyslaDel( o (0tlxnircoo1op rluesl( srxm(rpoydopt lncsls sDrrxrpoo0oeto ietlt m eln on(4 rtrio to1omDranvsl(0tetrxrpnu1altnlfci ( sDraxm ;u0opt iictldfm rmums;(0alenir3oydlpD  nvi;s)trxm(o3iy1ol  lnes t)aDrmuronu1alt ioetadls2ranvo;(4alxomrciytlpDrlueilt  2tmxr iydlm n ncias)s2ta(r ot0oexoifetadfmDrm(vp t4 lenmf3oadom e uvo;t) rxmxr3iydole lnct tfarrmurp;u0ale miciltfs2elumon(4alenif tytomtrluvi;(  2umxrpnu4lltnmnes ( aDtrx onu1oex if3tlslsDumnvont4 eeomr3ty1om rluvi ()trum(m3oo4ol  lnci tfa2urumono0tle  f3tltla2ua(vo;t)altrxo iodlate ieo;t) 2xrimpiu1altnlivtas)sDrau ono4tpe mi3tydlmDea( s t)arxrif ootfpDrluvol(0 rur(r3io1apt  nvs t)aDrauroou1aee mfciyt m ulnvo;(4aexnif3oy1lmDrlu il(0s2xrirpny4lp n fcsas  Dur(r ou0optnio3ilsfa eanmo;t0 rermr io1la elu il( s2trxr iu1oltelncsls  rtmur ot4ape mociat a rmu sn() ltrmo3iadfmtean slt0tetrxopno1lle  fet (f 2ta(  ;t4oet io3tltla ea(vpn(4trerxocoa1op eau i;t0srto(opnydapteliei ()s2umxmp;u0teeoifetltfa eauvo (0alxrmr tydfmDeau o s0srtoimpiodop   ncils  Draxro;u0olxn oeiadfmDean s;t0alxnxocia1om   nvo t  etmxmpoodalenmfvtl( aDururpnu0oltnmfeiytfs2uan p t) lxnmf3iadlaDeaivi t)sexrxo3iy1amt lnctlt arumx o;u4alxomfetad a2ra(vp () rtnxf oy1lmtranvs;t setoirpio4amen fcilsfs2um(r nu1optnmfetls a2em(mp;u)aetnmo3iotoaDrluvs;t0srxr(m nodlp nlivil( a2rax o;t0olx if3iat a uanvp t4trenio3oa1lm elnvo;() 2xrxm3oydlme livtas) rrmx  ou1tpxo oeiatla rluvo (4 eenmf tatfatr u slt) rur(mpny4ol elnci (fa2uaxmpot1oetoio3iyd a rauvs t4teeoif oa1fpDrauvolt0 exriopoodaltelics ( srra(mo;t4apx mfctadfm rm(msnu4 rxoxfcoo1fpD luvs s) 2tr(o nu1ope  icilt srrmxrpot0oeeniociyt sDumumo;()teeomf3totopDe i s;t0 rxm(m3oydaptelncias s2tm(monu4ale  octld sDuanmsnt0 eeoxfciy1faDe nvi (0trtoxrpiudamenlicil(faDurx  nt4oeenmi3ild a2umuvs t0 etrxfciatop elu o t trurimpno1olt lneia() 2tax p;t4oetoif3iltlsDrm( o u0 lxnxo ootom   nei t texmxrpiodlp nmfvils sDuau  no4tlx micils a2emuvs;u) ltnifcoy1fa eluei s) eur(mpou1lmtelfetl(f Drrx  nu4apx iociyd m2emn p t) lermr3ty1lmD  ivi t0 exr(o oodllenlfcsls  rrmxmpoo0oleomiciytlsDrlumo u0areomf oo1fptraieolt t2toiopiu4opee ics sfsDumxroou0oeen icils mDrm( o t0treoxrciotoa eanei ()s2urxo ny4omenmfvsasfs2rmu pnt0tlt mf3iadla rl(ms;t)tlxoxrctatfa rlivs s tetoxrpiu4lp   nctlsfs2rrxrpot4ole ifetlt sDeanvont0arxoif iotlp e ueilt0teuoim3nu1op elivt (faruaxm nt4tlxo f3ildfm uaums;(0aeenmrcoo1fmDeluvi (0t2umxm iudom   nviltfaDtaur nu4tpe  f3iyslm rmuvp;(0arxrio iytlm rli o s0trxo(o3nudomt mfvt s  rrr(rpnu0oexnmictat s ra( s;u)aleoxocia1omD ai ol(0srurxopoodll  mnetas)a2tr(m ;u0aexn feiasfa rmnvs u4 rxrio3ta1lm eai i;(  etmxrpiydomte nesas srur(m nu4tpe iictyt mDemuvo t0alenmocoytoa rai s;t)trtm(o oodllte neta(f 2uaxroot4tpe mf3iatlmDrlnvs u) eerxfciadlpDrlnvo (  etoxr oodomtn ivsa()aDrr(mpou4oexnioctatfm2ul(mo;u)artnxf ty1lp  lieo;() rto(opio4amte fvias)s2umxmo;u1tleniictytlm2ea(vs t) lxnmfcoytlateluvolt srtriopiydam n iet tf rrmu pnu1oetoio3iysfmDrlnms t0trxnirciadom e nvs s) exmio nu1aptelicia()aDumurpoo1aptn i3iltfs ea(mp;(4trtrir3oytomt  ivsls  etr(o iu1lp e nvs t)aDurxrpoo4texnmi3iytlm rl( o u0 lermf3oodfmtrlnvi (  rtmxm3iy1omt mfet s)aDur( pou1opeomo3iat m rl( s t0alerif ta1om rauvs;( trtmxm3nu4apenmnesa(  Drruront1alx  i3ildfmDrmnmpnu)arenif3oatfp   uvo t srur(mpou1ol nlncs t sDumu poo4aleomf3ilsfa2el( p (0artrxr3iotlp eauvsl(0texrir3ou4omtemneilsf Dtrur ;o1oltomf3ilt a emn p t0 etnmfciytfmDr n s t)s2xoxmpnodam nmies (fsDraumo;u1opeoif3ildla umuvonu4 rerxo oydfatrauvols) 2uoio3nudam  lfcslsfsDua(mpou4tleo o3iltfaDua( ont0 renxr3tadopD ai i;( srum(o3oodlltnlivta() 2uax onu4oleo ocias a ranvo;(4areoif io1laDeai ol()t2umxo3ny1al  mnct t s2rax  nu0opeomf3iad s emuvp t0altnio iy1la elneo;t)sruoir nodal  mfcil(  rurur no0alx iietysfm ulumsnt0altnir3tadlaDrauesl(0texo(rpiudal  mfesat) rua(r ou1alxnmfeild s2ranvp t4arermo ta1omDraivils0 2uoimpny4olenmici ()artmumooo1tptnio3tytlaDulu p;()artoxf todfa rlnvilt0 rxoio oydom nlnvs () Dumx  nu4oeeomo3tytfs2ul(ms;u0 lxnifciytom  au i;(0s2trirpoy4lpen fcilsf 2uauro;o4tpeomieiatlsDelnms;(4 eeomr iydlp eai ol( setmxmpnodlp emivsat)aDraxroot1aexnioeild a rm(mp;()areomr iadlmDelivi ( s2ur(mpou4amtn netl() 2rr(rpou0ale mfeiatfs2rm(ms t0alxrmo3oatla e u i s texm(o nodomtnlivia(  2rrxmpno1oeenmoctlt m2ulums;() eenxr ta1fat lneolt0s2umxr oo1lltnmfci sf Draxr nu0aet  o3iydfa2umuvs;(0aexnxr iytfat liesls) 2umimpiu4lle mneta(f rtr( pot1alxnifctatfs2elnmsnt0aeerir3iy1fpD lnesl( s2trim3iy1opt mfvslt aDuru pno1tpt  icias s2rmnms;t) reoxo3oydomt livil() 2xr(opoydlle mivtasfsDrmu poo0olt mfetyd a rlnmp t0 exnxr3oadopD  uvi s) etmir3ou1lm nliet tfsrrm(mpot4apxomo3tltfs2em(ms t)artrir iy1omte n s;( truoimpnudal  lfvsat)a2ta(rpnu0oeen iciatla2ua(vp;t)aleomo3iadfmD li olt texoiopoo4lmenmfct (fsDta( ooo1ape iieiyd m2elu sn()areoxr3iydla eauvi;s)trxoir iydoptemneil( sDtrx  nu0alx mo3iydfa eln s t)arxrxf3oy1op eaivol(0sexrio iudlmeelncsls) rtmx pnt1opxoii3iys s2eanvsn(0 eerxr iodfpDrlnesls) etmimpnu4amenlivslsf 2ua(mpnt4apxn octat s2emn p;t)arxnxfcoadfmt ln i ()sruoxo io1lm nlfvtl(  rrax poo0tpxn i3iltfs2rauvo t)aeeoifciotlpD  u o;t0srtoxr3ou4am n ivsat) 2tmx ooo4tptomoctydfm rlumpnt0arenmociadomDelnvilt0t2trirpoo4omenlnviltf Duaum ;u1oet mociat s ranms;() lenmr iydfp elivo;t0trxr(r3iydaptnmfvs ()s2tau  nu1aet  i3tldls2ea(vsnu0texomf3oytlmtelivilt  2umirpny1opeelfcsls)s2rmumoot1opeo f3tlsfaDul(vo;u)trxnmr tadlmDe neo;s teur(opnu1om emnvi (f 2umu  ;t0tpx  oeiydfa emn p;()texomo tytlptrlnvi;(  2uoim3oydlp n net t)a2tmu o;o4aeeomieiydla eluvo;(4 ltnif oadfmDeaivs;s)setrio3iudom elfeiasf 2trurpot4tlxoifetatlsDrmnmp;(4aexoxo oodfp e ues t  rxmiopny4llt lncia(fs2taxrp;t0tlt mociyd sDeanvp;(0alxoxo3oytop e ieilt) 2xmxo oo4llte iesa()sDrmx pnt0tlx mo3iys mDrmumpnu4 lxrxf3tadom e u o s) rxoxo3oudll  mnct t) Dra(r oo4tpenmocilsls2raumpnu4aexnxrcoa1fmt  u i t  exoxrpoo4aptn iesat) 2taur ;u0alxomoeiysfs em( onu4 rtrif3iytopD  nei;s srumim3nydaltnlfvsa(  rrrump;t4apx ii3iys aDea(vs u4trtrmf oytlmteanes;( srxrxopny4ole  ivilsfs2rmxmpou0tleomf3ilslmDemu pnt4altnmf io1omt  i s;(0s2xoim3nodalen nesltfsDumurp;t0opxn f3tyslmDranvo u4teerifcto1omD au i;t)tetoxm ny1lmtn ivsatfsrtaxrp;u0tleomietasfaDrm(mp ()trxoif oytlmDrlnvo (0setoxrpoy1ome licia() rraum nt1oet  ietadfa umumsn() leoirciadomt au o;(0t2tmxmpio4lmt mncsl()srrm(rp;t0aet  oetydfm emnvsn() rxnxr totoatrlivol(0 rtm(opno1lmtnlivslt)arraxm ou4apx mfctytfs2em(vs;t) eermocty1fm e u sls t2to(mpoy4aptelneslsfsrrm(rpot0oexomf3iltfs rl( pn(4 lxnxo io1fpte iei;( trtmxm oy4apenmfvt sfa2tau  oo0tptnif3iasfs el(mp t) ltrxociotfpDe i s ()trxm(r iudlm  miviltfsrraxmonu4tltoifciyd m rlnmsn()aleoxo3iatlp rlieo;()t2tmxm iudapt mnvilsf 2taum ou0teeo octytfm2umu o;()texnxf ia1faDrau s (  eto(r3io1amee ieiat) Drmu pot1tlxoifetaslmDel(mo;u4texriocoadomD an s s) exr(m oodlmt  fvi ()a2taur ;u1tetn feiaslmDul( p u)trtomr3oydlmDelivi s)texmir no1amee ivs tfsDraxmp;u0aee ii3tlt mDranvp;t4 exoxo oy1fmteln sl(0t2trxr3iy4op  lfct tfarumum oo4aetn i3ilt mDeanmsnu0 leoxf3iotlmtraueol( teuoxrpny1lp elietat) 2tmxmpou0tpen ieiydls el(vp;t4tlxrxrcoa1om rln s;s0trtmio3oy1ap nmfetl(fs2taxront1opt  ocildfs rmumsnu)tlxnif3oydoaDrluvs ()seur(o nudomen feta(  rrmx  ;t0tpxomociyd mDeanvs;() rxrmoctatfmt lnvo t) exo(opiodlp nmfetlsfa2uaxmont4tlto octldls rau pnt0artrmfctadop rauvo t)srxrirpno4opeemivsls)sDua(  ou1oetniiciat a2ea(mont4 rtrxo3iadlpDe ues;(0 rxmir nydomte fvs (f 2trxmoot0alt ii3iysla2uau pn() lxoxocto1fptr i o t sexoiopoodomtemfeil(fsDua(roou1opeo iciys aDrlnvs;() exnmf to1lm  aiesl(0texoxmpnodap nmfvias artmu p;o0oeto fcildfs2rluvpn(4tltoifctotfa raivol( seurxrpiydaptnmfviat aDumu  no4aee if3iltfsDul( o ()tlxrif oo1lm e u olt trum(o3iydlp   iesas aDtrxmpnt4tltnmiciydfm2umu s;(0tetrio3iotomtr i ols0tetoir3iodam  lfcs tfsrrmu  ;u1tetnio3iytfm2ra( o;() rtrmr oatfa ean s;t)trxmimpiodll emneia(f rtm(rono4aptomfciytlaDuanmpn(4 eenmf iydoatr u sls trumxr3no1aptnmict sf Dumxm ;o1apt moeilt aDumnms;(0 ltoxo3ia1fp e nei s) 2xmxrpny4lptn iesatfa2ra( o;t4aleomo3tltlsDuau o u4tetomo oodlpte uvs ()tetrio oo1alenlfes (  Drrum no0apen oetltla rm(vo;()artoxr3oo1oa  aieolt)trtoxr3oo1amenmnvtlsf rrm(  ;o0tlx  ieiys s emnms;u)tetomoctytomD livi;()teuoxo oudlm  mfvsa(  Dtmxr ;t4tlen fctydfa el(vonu0 rtrxr3iodoate uvolt t2tm(mpnudomtnmfvs (  rtm(  ot1tetoifcild a eau o t) lxnxo totfmD  ies;s0texr(m io4omen ivtlt aDrmurpot0alenif3iysla ua(vont4 lxrmo oatlaD  nvols0 eumxm3ou4ol  lfvta() Dumumpot4open feiltlsDrm(mpn(0 rxrxf3ootlmt  ieo;t) exrim3iu4ll elnvsa(fsrrrur nu4tle  fctyslsDrmnvs;t4 lxnxr oa1opDeli sls sexrxo3ou1ol  mfcta()s2ra(rono0alxo fciasla2el( s;() exrmocoo1laDr nvs;t t2uriopoydlp  mfesasf Dra(  ou4olt ifciasla2emumpnu0tlxnmo oadfmtrauei t0texr(opiy1lmenmncsat arta(rp;u1tex mociys a umnmo;t)arxoirciodfptelivi;s  2toxrpio4am nlnvtat)srrrump
\ No newline at end of file
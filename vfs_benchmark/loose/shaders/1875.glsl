@@ -0,0 +1 @@
+ues t texoirpiy1openmies s a2ta(monu4ale  ocildfm2uaump (0areoxr3tytfm rln i;()sexo(rpoo1openlnviat aruaur ;t4opto f3iatfs um(mp u0 exoif3oytfm e n s;(0teurim iy4alenlnvtlt)arrrxronu1opeo f3iyt sDemuvp;(4 leoxf ia1fa eliesl()trtm(m no1optemics s)artruro;u4oeenmoeiaslm2eanvo t) rtomf3io1oaDelneo;(0s2umio3oy4ol elicsas)a2ra(ro;t0alen ietas a rm( p t4aexrxrcoa1fm  an s;(0s2urxm iy4op emfeiltf Drax o;o4olx ifciatfa2rmuvp;u)tetrmo3ia1lmDr ivils  rtrir io4am  mnetas a2tr( poo0ole  o3ias s2em(vpnt4aexoircoodlpDe uesls0s2xoxo io1lmeemnetl(faDuaurpou0oeeomf3ilt mDuln p u4 rermr iatfm   i s;t) rxo(mpio4altnlfvias) Duau pno0tpx  ietadfsDrln o;u0tleoxo iodfmDr u i;( srxm(mpnudol e nvsls aDumu pno4tet  ieiyt s2elu onu0 rxnir3iodlaD  i s t srxmxmpoydlptemnvt s srtmu ooo4tpxo fetldfs2em(mp;t)arxoifciydoaDe ivi;(  2ur(m3ou1omeelicsa( aruaxrpnu0tle iictytlm um( on() rerir3iadoat aneols)trtr(m3oo1op  mfcias aDrr( pnu1tptoif3iytlm2ea(mo t)trxnmf3oadop r ueil() euoxrpoo1lp  mnvslsfa2tmump;t4alenmfctlsfa2emu s ()aetnxo3iatop r i ols teto(rpoudlleelict () 2tmum ;u4apt  oeildfm2rauvp u)aleoir3iy1omtr n i t srxm(r iy4oltemnvias srtax  ot0ope iictatlaDuauvs;t4trxrmo3oatlpDrluei;t0 2xmxo3io1lp   fvt t aDtr(mpnt1aptn oetydla ulumpnu)aetrxr ty1faD lues;t srxrir3ou4ame livt ( aDrr(ronu1teeoiieiydfa emuvsnu0aexoir3iytom rlueolt) rumir oydoltn nvi tfsrrr(rpot0olt io3ilsls2rau s;t0tlxnxrctodlpDrlnvs t0 rxmimpiodap nmnvtls)s2tmxm nt1oeeoiieildfa2rlnvs;(0alxrxr oadfmtrlies ()texrxr3iudopeelnvtl( sruaum ot0oet  o3tadfs ua(vs;()tetriociydfate u sls0 rumiopny4optnmnvt s)sDrmur ou0ape mieiatla2eauvo u)texnxf3iadfpt livo t  eum(rpoudlptelici t)arrmumo;u4alxn fetldlm2rmu onu4trxnif3tydopDe nvs;s trtmxrpoo1ol nlnvil(fa2ur(mo;o1aee mieiltlaDrmn pn() lenir3iydlptrlnes s setoio3nodllt lneiltfs2ta(rpno1aleniieiyt sDelu pnt0tlxomf ta1lmt  ies;t  etr(o io4llte nvtlt)a2ta(m oo4aet  o3iysfmDra( s;u0 leomfcoydlp r i o;( t2xoxm oy4omt mivi ()sDraxrpoo0apxnmociydfm2umu p t)aexnxo3ty1oaDrliei ()s2um(rpiu1lpe mfciatfsrtrur ou4altoif3iytla2eanmsnt0altomf todlmtelnvs t teumiopnodlmen neta(f ruaumpnt0aeenifeiat aDumn pnt0aeenmociy1lpteli sl(0trxr(mpoy1amtnmfeiat a2rmu pnt4alx  feiydla2rlump t4areoio3iadfpteanvol(0s2trio io1op n ivsa()aDtr( pnu0aee moeias a ra( s;t0aetoir3iydoa  li ilt0 2uriopoy1ame  fesasfaruaxr nt4texoio3ilslm2eaumsnu4tltnircty1latr neolt)trur(mpoydaleemivtlsf Drrx  nu0apxomoeils a rmu pnt4tltnxo todlmDrlivils t2uoxopnydam  mict sf 2tr(roou0alxn fciytfs2uanmp;t4teermf tydoa e i sls)s2uo(m3oo4oltnlnvias)sDra(mp;o1teen fcildlsDul(vp;t) reomf tytlptr ues s0teumxo iu4lp nmiesa(farurum nt4alen i3ilsfa2rlnmpn()altrmr3iatfpDr uei;s0t2xmxopiudll  mfeias)artaurpot4texoifetlslsDum(msnt)altomrciotlmD lnei ( teur(rpnu1lm nlfvsa( s2ta(roou4apxn ieildls ulumo t)tlermf3totlmtelueils) 2uoimpnu4amt mieslt sDrrxr oo4tpx mfciyd sDumnvs t4trxnir ty1omtrai i;s srxr(opou4om emivs (  rurxroou1aexomf3tlsfmDumu p t4aleoxrctotop  aueslt srumim3oudapt mfet s)s2ua( o;t4ole  f3iat m2eaumont0tetnxr3tytlaD lueo ( sruoxo3oy1ap emicsa(fa2rm(r ;t4altnmiciyt mDemnvs;u) lxrxf3oy1optean s s0 2trxrpiu1openmfetl(fs2raum nu4tpt iietldfa rmnvsnu4 etnmr3todfpD luvils0 etoim3iu4ope  iesa( sDtm( o;o4aleoioetlsfm rm( s;(0 lxoxo ta1oa rlies t0 etrimpou4ap nmivilt a2rrx p;o4aptoifctld m rluvp;(4alxrif oo1lmD  n s;() 2urirpio1oltnmnvsltfa2tau  ou0olt mfcilsla eanvp;t4trtrxrcta1fmDran s;t) 2tmxo3ny4lpe  nes (faDrmu  ;u4apt iieiyslsDea(vo;t)trtrxo3totla rai o;(  etmxmpou1amtnmnvilt aDur(rp;u1aeto fciltls2eauvs u4areoiocoo1omDrai slt)trurxr oy1ome licslt) rtmx o;u4alx iieilslsDuanvs;u)arxrifciatfaD anes;s0seumio3nu4am  mfvsa(  Duau  oo4tee mi3iltls2ua( o u4artnio3iotoa e u sl()texmxo nydap  lnciltfsDra( oou0oeeoifciad a umn sn() etrxf oytlaDr u i t0trxrirpoo4altnlnctas)s2trxrpno4tltomo3tlt aDrlnvo u0 lxrmrcoodomDeluvols0s2xrxrpny1lp n ncils)sDuax  ou0aleo i3iytlm rmuvpnu4tltnif oy1omte i ol(0 rxmxo nu1lm emicia(fsDraumooo1teenioeiltfaDeln on()alxomocoodomD  nes;s)truo(mpno4amen iet sf rtmx  nt4tpx mfctaslmDelums;t) rtnxr oo1lpt  u slt  rtrxo3nu4amenmnvt s)artmxr ;o4oleomocild s2rmump;t4arerxrciodomD aiei;( trtmim ou1llen nvt s) Dur(rp;t1oexnmfciat aDem(mp t0artrmfcty1om  au o t t2trxr3iudap elnesa( a2rauro;o4opx mocias a ul( on(0tltrir oy1omDrauvs;s)t2xm(m3nydale  fvils aDur(ro;u0apx  f3tyd a2eauvs;t4texomoctydom   uvs ()trurxopoy4lmt lfcias srrmu pou4oee  ieiysfs2rlu s;t0texnmf3io1fptr uvs ( trtr(o iu1lmtemneia()a2tmur ;u0ope iietltlm2ea(mo;(0tetoxo3iotfa e ivi s) rtmir nu4ll   fesls) rtaumpno4tltnii3tys a2emn p;(4artnir3iatlmDe uvil()teumxr3io4amt liciat)arurum ;u4oetniictatfs2ra(mp u0altrmfcoatfmDrln s;t) 2toir3ou1am   fcs sf Draumont4tpen ociat s uln p u)trenmo io1opt ln o ()trxoirpnodop  mncia( aDumxrp;u1texomieiadfaDemu s u0 etnmr oytoateln i;s)tetrio3iu4aleemivs (faDum(mo;t1tpxn ociytfm ean p;()altnifctydop  auei s0 2trxr nodoltemics s) 2tru p;o4oexo ieiys a rmumo u4 ltrifcoytfaDe nvs;(0s2xrimpny1altemneil( a2rax  ;t0opx if3taslm rm( pn(0teeoxr3oo1oa  lieo (0s2toxm3nu1lpt lncsltf Dumumpnu4alt ii3tltfsDeluvsnu)tlerir3io1fmt  uei;() 2to(opnydol e icsl( srtrump;u4opxnmo3ildlaDem( o (0aeenifciotlpteaivs t seumir iudll nlies t)a2tm(rpnu0tlxn ociltfs2elnvpn(0 lxoir to1oa e u sl( tetr(opoo4lle lfetas)a2ur(rp;o0olto fetysfa2rm( ont4alxoir3ootoaDrlu olt)s2uoxm ny1omeelieilt a2ur(mpnu1aeeniieiltls ea( p;(4 eeoxr3tydfa eaueilt0sexoxopiy1lm  lnctl()arrm(mpou4tltomoeiydfaDemu p t0 lxrir3tadfmtranei;() rumxm iu1llenmicilt  2ta(mooo4apx ioctytla ulnvs;t4 rtnxf iadfpt  ivo s)t2xm(m3oo1alenmfcs s  2uax ono1opeoioetydfs eau o;u4texrmf totlmD auvol()srxoirpno4lmt mieta( srrmxro;t0oltnmictys a rmump;t0 etrmo ty1lat au o;t) etm(r nudoleelnvi () rrrumpno4aleomf3ils a2rmn o;t)aeerxo iotlat  ieils  2tm(m3iy4op  mfcilsfs2ra(  no0oexnioctatfsDumn s ()alxnmf ia1fpt lieo s0s2xm(mpoy1lpen fvsls) 2uau  ;o0tle  fctatfa2elnvo;u4teenmocoatop  anvilt trxo(rpnodapee nei () rtax pno1tetnmiciydlm ua(ms;t4tlermf oo1lp rauvi;s trurir oodamtnmivi s)s2ra(  ot1apx mietldlm eaums;()aexoir3oydlat luesl( trtr(r iudlmee fcs s) rrmxmpot0apt ioeiysfm ul( s u)arxoxocoydlp   nvs;t  eto(m3iy4ll eliciat artm( poo1tpx mfeiaslsDrlu onu)alenmr3tytlat aueo (0 rtmimpiu4al nlnviasfsDrrurpno1teeo ieiltfm eaumont) lxnmo3tytfptelneols0 rurxm3nydamt lfetlt) Dtm(r ot4teto f3ildfm uanmpnu4tetnxoctydfmtr uvols sexrim nu4ll elfctas aDumxrp;t0tlx micilslsDelnmp t0 rtoiocty1fp  aueolt  eumxo3oy4lpt  icilt) 2rm( pnu4tpen fciytfs ulumpnu)trxrxrcty1fa eli o;s srum(m3oydopee fcs t aDraxro;o1tlxn o3ils m uanvs t4arenmr3tytfmDr uvi;(  2ur(o oodale  ieiltfartmxmp;t0optomociltlmDumnvpnu)altnirctatop  livo t sexrxopiydlltn icsltf rtrur ;o1tptnmi3ildls rmn pnt0teeoir oodfpD  u ilt) exr(r3oodlpenmicsasf 2um(ro;u1opt  feiad aDem(mo u)arxoir3ty1fptelivi;t0tetoiopio1opee ies ()s2umxrpot0tptn feiasfa2rmnmp u0 eenir oatlpt lneo t sexrxmpio4op n ics s)aDtrumpoo4alen feiad m rmu s (0 rerif3tytfaDelneils srurxo oy1llenmncslt)sDua(ro;t0tpt ii3ilslm2ranvo (0alermfcta1fmteau s;t0trum(r3oydoleemfcsa(fsDrmx pnu4apeoifciyd a2rl(ms;(4 exoxr ia1opt auesls  exrio3iy1altemivsa()aDuaxronu1oetnmfeias a emu pnu4 rxriocoydfpt anvs ( s2uoio3ny1aptemfci (  2trxmo;u0oeenmocias s umuvont4 rtoxrctatfaDrlieo t0s2ur(mpnu4opeelivslsf rurumo;u4opxo ocilsfsDel(mpn(0aeenmfcoa1la rlueil(0texo(o3nudll  micilsf 2rmx o;t4texnmo3ildlsDeaumpn()artoif3iytlpteau slt s2xo(opoodllte ivsa(  rrr(mont0aee mocilslaDuau pn(0tlerifctytoatr n s;( trto(r3io4lm n nesl(f ruaump;u1apenio3tysfs umnms;(4trermo iatoatrauvsls)t2trxmpou1lmtelnci s)s2umu  ;o0tpe mieiad a ulnmont4 ltnif3oo1lpt anei;t)seuoxo3oo4alen fvsl( a2tm( ont4oetoio3tydlmDrl(mp;t)altnxo oy1laDr u slt)srumir3ny1olt lfci ( srtrxrpou4aet iiciyt s2uanvp u0trenmf3tadlmtelieo (0trtrio ny4lleemnvia( a2tax ooo0optnmfeiyt mDuauvo u4trxrmf ta1faDeli i (0srurio3ou4ale miei sf rtr(ro;u1tlx moeiat s2rmuvp (0 lxrio oytlm  lueil() 2ur(o3iy1lmt mics ()a2ra(rp;t1apxnifciatfs ea(mo () lenirctytomDeai i;s tetr(o3io1llenmfcsa() rrru o;u0apxnmiciadfaDumump (0teenioctatfptrlues;(0sruoimpou4lpte iet t)srrmx  ou4apto fcildlm2elnms;u4texnifcootfpD lies () rtmir ou4op nmivsatfa2rrumono4tpt mieildfm ulu onu) leoxr3io1lat lnvi s srtr(m oudll n nvtat  rtmu  ou0apx iietytlaDeau sn(0 rxnir iodlmDrli s;s  etm(r oo1lp nmneta( a2uaxmoou1ale  ieiltfm rauvo u0tltnxr tatlmtr iei s texmir iu4lm  lfci sfa2trur no0aex  feilsfaDrmumsnu)artrio3iatlptrlu olt  ruoio iudolenlnvsat  rrr(r nt1alxo ieiadls eln pnu4alxoxo to1lpt  uesls s2urxrpiy4lle lfvtat)aDuaumpnu0texn ieiytla2em( s u)areniocia1lpD  i il(0setoxm3ny4olee icslt s2rr(monu1tpxnmf3ilsfa umuvp;u)aexrmr oatfmteaueo;t0 2xm(o iudamt mfetlsfsDrau ono4tpen fciaslaDum( s;u4artnmrcoatfpDeaivi;s  2uoxo3oudolenlfei () 2ua(ro;u4apeniocias s2rmn p t)tltoxr ta1fp  auei s  rxriopoy1olenlncsl()sDrrx o;t1oeto fetat m2emumo;(4 rtoiocio1oa eaneo;( truriopiu4am nlivtlsf 2trum ;u0tlxoii3ilt s2ul(vp t4 rtoir totoatrau s t t2tmxopnu4am nmictlsf 2um(ro;o1oet ifcilsfs2ea(von()alenmocoadomtelneo () rtr(mpiu1lmeemfvsa(fsrumurp;u4oeeniieiysfm umnmo;u) rxnxrcoytoate nvo ( seum(opiydal elfeta()srtr(r nu4tlxomoeilslm rm( snt)teenxrciotlpDraneils0tetrxm nu4ape  nvsl(  Dtrx  nt4tle miciytfs2ranmpnu0areriociodfp eau ol() rtoxrpoo1ap  lncsls) rtrumpnu0aex  ocild sDrmn onu) rtomo3io1laD livs;(0 rtr(m3no1lpt  iesltfs2rmxr no0aeenii3iyslm ul(mo t) ltriocoy1lmtrlueo;s s2tmio nydlmtnlnet sfaDrmumpoo4aetniietasfa2rluvs;u0trxrxf oydlaD aieo;(  rxoir3iydam n ncias)artaxmooo0oet io3tysfs uln o t) lxniocia1fmDeanvols)setm(r3iodlpee nvt t)aDuaump;u0tlt mo3ilsfa uln s t0aetrxo oy1lmDrauvi t trtm(rpiodll  livtl(fs2tmu oou1oeto fctls sDrmn snu4 lxnir3oa1laDrlu o;s) 2xrio iy4amen net t sDtrx  ;o1texnmfctatls eln pn(4 rxomr3oy1la e i sl(0 2xoirpiudam nmiciltfsDrrx o;t0alenio3iytls umnvpnt4texomo3ta1oa e ivs;(0srto(r3ny1amtnlnvia(fa2trx  no0tlt moeild aDemnms;u4alermrciytfm elnvi t seur(rpno1al nmietlt a2rmx  nt4alt miciyslaDuanvpnt0 lenxo oy1opD auvil(0trtoirpny1am  mfcia( sDtmu pou4apx  octldlaDem( s;t0tetrif3ia1fm rln o t0srumirpny4ap elfviltf rta(m ;t4aee  icild s uanvs;u)aleoxr iytoatrlneols0teuoimpio4op   fctl(f 2rmxrp;o4altn iciat s emumo;u0teermfcto1fatr uesls0texmim iudome  iesl(faDumurooo0aeen icilt m2emuvp;t0trtoxo3oa1lmDr i ols) rtmxm nu1ape mncsasf 2rr(mont0aee mo3tysfmDra( p;() rxomr3iydopt  i o;t0 ruo(r no4omenlfetls)srrau o;u0tee iiciasla um(ms u)artrio3iytoaDeaivo;s0srtrxm no1lmt  ivt ()aDtaurpou4ape  i3ildfa eauvont4trtoio iodlpDrauvo;( trtrxm3io1ap  lfetl(  rta(mooo4altnioetls aDumumon(0aetomf3iy1fptraiesls seuo(m3no4ol elfvi s  rtaur ou4texoiociydfs ea(vp ()tleoxrctodfptraueol()srtmiopnu4ol nlivsatfs2umumpou0tlxomoctldlsDelums u0tltrif3todoa eaneo t0 exoim iu4op nmicias  rrru p;u1tltomictlsla rmuvo;u4artnmrctadop r iei () exmim3iy4ll emfvt s) 2rmump;t1teen icildfm elnvp t4trtriocoytlmtr uvslt trxmio oo1openlncsa(fsDtrump;u0ale moctyt m ul(ms (0treoio3io1faDeai i ()seur(m ou1omt livta()s2ta( onu1aetn o3iysfaDeln s u4teeoxociytlpDr nvils) eur(m no1al  lfvs sfa2tau onu0tleo ieiydfaDemn s;t0 rtoif tatfmte nes ()srtmir no4ll  mfvtl( aDur(ront1tpt iieiyslmDrlnmo t)trermfcta1la rli ol(0 exmxo3oodol nlneiasfaDrmxmo;o4ole  oetyslm2rauvs t4 rtoxo tadopte ivi;t0trxrio nodamen fetl(farrmxr ot1tleoifctldls em(vo ()tlermfcto1oaD anvs;s)s2xr(rpio1lm   ivt (fsDtaxr ou1opxn i3tltls2umnmp;(4 rtoir3iy1lat  u sls0texo(rpny4ll   ivt sfa2rm(rpnt1apx mfctatls um(vs;(4 rtnifciydopDeaivi;t srtrir3io4lp  miei t)aDuau  no0aptn oeiydlaDrmnmo;u4 leomf3iatfatelivils) ruoxr3ou1ol n ici s)s2rmx  nu1tptomiciydfa elumpnt0aleomociytlat aieslt  2toxrpny4ol  mfcs ()sDtrxm ot0oeen fciadfs2raump;u4trtrio3todoatelivi;()t2trxr ny1alenlivsas)a2tax pot4optoioctydlm2eauvont) etrmfcio1oa r i i s) 2uo(mpiydap nlncs t  2rr(r no4tlenif3iytlaDum( p;(4teeoxf3ty1op  li o s) 2xr(o3nu1ol n ictlt  rtr(moot4texo oeiad aDemu o u0 renmf iytla  li s s0 rxmir3ou4am nlfcsl() 2rr(rp;t4olt  fetydfm2rlnvs;t4 exnmoctytlmt  ivi t  rtoio3io1al n feilt) rumx ooo0aexn octyt m2ea(vont)aeenir iadfa  luei;t0t2umio oydape licias)srtm( p;o0apen oeiatla2uaumonu)altnif3iatlmtelu i s)s2tmio3oo4ame mfcia(f Dumxm ;o1tpxniieiyd a ua( sn(0 lxnmocoodfaDraieols0sexoxm3oodlpeelfesa()aDtmxr oo0olxnmfeildla2umn s;u4artrxocty1fpD  u s s) euo(r3oy1lpeelfcil()a2rmuro;t0apx  ietldlm rl(mp;t) lxomfcoodlptelies t)t2trio ou4ope miesas)aDtm(roou4ape mfciltla2ea(vo;u0aetomrctadfp eanvolt0seumirpiu4lm  liei sfaruru p;o0apto iciasfs rln s ()artnifciy1lmDrlnvs ()setmxr3ny4lpt mfesa()s2ua(mpou4ale  o3iyd m2umuvo;u0tetnxo tydlpDran s;(0srxm(r oy4ap  lncslt) rtm(rp;u0apeo ieiys mDrau sn(4 lermfcoa1lp ean o;s0trumxopnu4ape mfctl( s2tm( p;t0apxomfciyd m el(vo;t) leomocoo1fa  aies s  exmxrpoy1lmte fvsltfa2tmum nt0oet ifeiltla eanvp;t)tlxrmr3ootoatrliesl(0trxr(opoy4optnlnvsl() Duru  no4tlxnmieiydfsDelumpnt0aetnif iydomtraieo;s) rurir oo1lleemncias)aDurxr ot4apeoioeiyt a2eauvs;t0artomf iy1lp rlues;()t2xm(mpny4alen feiat  Dtr(mo;u4olx io3iydfa2umums;u0trenxfcoodop rluvi ()tetoiopiodomte fcs s  2rr(rpou0tpen octysfs2emn pnu4trtoxo ia1lmD lnes;s0 exoxopiydam emfcslt)artm(rpoo0ole iictlt aDrl(msn(0 etrmf3oytfp e u i ( sruoiopnu1amenlfvs s) ruru p;t4optomfciad aDum( pn(0 reoifctydoptrlivi (0 eum(mpiydam emnciat aDuax poo1alt  o3tyd mDuluvo;t0 rxoxfciadfmt  uei t)seuoio3oy4am nlfcta(faDrau pou4tpeoifetasfm uluvs;(0tlxoio3ta1opDe nes s)t2xr(opiy4ap  lieias)s2ta(  nt0tptnifciatla2rmumsnu4aexrmociotoa ean s t)s2um(rpnu4lp n nctatf 2urxmp;t1altoiietltfa ea(ms;t)trerif iytfp  lu o;(0setr(opny1ape lfeiltfsDurxmono0apeo f3iad aDuan pn() rtnmfcio1oat lieslt0 exoxmpou1lmtemfvsatfa2tax  ;u4olxnmoctld m2uluvpnt0treoio3oo1lm r ueolt)srtrir3oodlp nlnci t  rrrump;t4aetnii3ils sDrlnvon(4 rxnxo3oydoaDe ueilt)s2xm(mpoudolenlivt t)arumu pnt4aptomieiat a rlumpnt0aexnmf todlmD aieils)srtoio oo4olee net (  Dtmurpot1altnifcildfsDea(mon(0 exoir to1lm rauvs;t trxoxo nodlpe mivtat  Dua(m no0aleo ocils a umnvp (4artomfcoo1om e nvs s0teto(m3oo1am nmfei t aDuaumo;o1apx mo3iatla2ran s u4 etomr3oydop   ieo ()t2xrir3oudam  micta() rumu pot4tpe  ietytla emuvp;u)arxoxf3iodomtrluvs ()texrxm iydll  livil( sDurxmont4oee mieiysfa ul(vsnu)alxrifcto1fptr nvi s seur(m nudopeemfciasfaDraurpno4aexo fciydfsDemuvsn(4arxrxr3oy1lptelu i;s0seumio no1altemncsl(fsDtax pno1tlen ieiyt s ua( pnt0teeomf tytoptr n il( t2trxr3oydomeemicsatfsrrm(r ;o1teenmi3iltlm umnvo t0 reomfctydoa eanvi ()trxm(opio4lmenmivsl()aDtr( oot4aex  ietyd s2um(vpnt4teenmociy1omD lueil(0t2urim ou4al nlnvil()srtm( pnt4alxnioctlt a2rlumo (4 lermrctodfa rln ols seuoxr nu1apenlivtl( arrmuroot4aleomfeiytla2eau p ()aeenifcto1lp r ivs;( setoiopnodlmt lfvs tfsDrr(ronu1ape ii3ilslsDumnmsnt0 ltomr iotfpDrlues;() etoiopoo4lpe mfvt t  Dum(moou0opxomoeilslsDeanmsnu4trtrmo oodomDe nvs s0trtmio ny4olt mfetl( srtm(mpnu4aex  fetys a ua( pnu4tlxomfciytla  livsls0srumim3iydlpt mfcsatfsrtm( onu4alxnio3tyslmDea( pn(0tlxomo3oatop   ivo;t) etr(o3iy1ap   feilsf Drrxr ot0aex  ociydfsDul(msn()teerif to1om rai olt) rxr(opiy4ll nlneiasf rraur ;t1tpxo oeiltla2umnmo t)tetrmrcty1lm  lnvo t texrio3no4ll n ivia()s2uax oou0aex ii3iydla2elumonu4 rtoir3iydfmDraueo (  rxmio oo4ape mnct s) rtrum no0aee io3iysfa rluvo t)trtrxf3tydfat  ivo;t)srtr(r ou4op n nvsas)sDrru  ;o1apxn ictldfm2rlump (0 lxrmrcoy1lpteanes (  etr(r no4amtelfesa()srum( ont0oexomf3iadls2rmuvs u0texrio3iotomt lneilt) rxm(r3iy1lp   fei ()a2tmxmp;t4olt ioetlsls2uanvs u)trxnmf3totlaDrlnvi s0 exm(rpou4llt lnes tfsDraxroot4aptoifetadlmDra( o;()tlxrmrcoydomtrau i s) rxmxo3no4opt  ncsa() 2tm( p;t0aptnifeild a umu s (4alenmociatom  auvsls0 rtm(opiudom e nvsatf rrauro;o0oee  feiatlmDemnmonu) lxoif3ootfmDe i s t0s2toio oodlmtnmictat srumxmooo1ape mfcias mDeaump;t4arxrif3ty1oat lues;(  rxo(o3nu1lp nlnctatfs2rmxrpno1aleomfcilt mDea( o;() rerif oo1fa raiei s  eumxopno4lpte ncil()aDumu o;u4oee io3tysfmDua(vs (4alxrmo to1lp rauvsls trxmim nu4lle  ietlsfa2urumpnu0ole io3iat m2rluvsn()alerxrcootlm rluei;t)t2xo(o3iodomee neils)a2trurooo4alx miciytfs ul( s t0tlenmr iotoa rluvs;t)setmim nodaleemietl(faDrmurp;o4apenmietytfsDea( pn(0altrxf3oatfp rlnes;t0srurio ny1ll n fvtlt arrm( pot0aeto feiat m2el( on(4aexriocoatopt anvi;( sexo(rpnu1alte fvi (faruau ono4tlto o3tatlm ua(vs (4 ltnif iatopDeaieilt0sexr(opoodomte fvs (  Drmxrpoo1opxn ietyslm2umuvs t)treoircootlmDr neslt)srtoxr ou4lptelnvsas sDrau  oo1tpeo ietysfm ea( s;u4alxrio totomt luesls)trxm(o ny1omtnlivi (fsDum( oot4apt  feiyt s uanms;(4treoxo3ia1fp raivi;t0 euoxo ny4oltn fciat  2ua(m ou4ole iictatlsDrl(vpn(0 exrxf3oydlaDrln ils setmxm iy4am  lfet t s2ururoou0oee  fciat a2el( s u0alxrircoy1omDraivs;()tetr(o3ny1apt  fvsa(f rrmu  ;u1tet moetlt m2um(ms;t) exoxr3todlat  ieils0tetrimpny4altelneias sDtrx  nt1aeeo oetaslm2em(ms;u)tltnir3tatfa e ues s s2ur(o3io4opt  fvs (  2rmum ;u4oleo i3tlslaDul(ms;u4 ltoir todlmtrli i (0trum(m3no1ap n ncil()artmxrp;u4oee ii3iadlm2rln p (0arenmoctytfptelu i ( trtm(rpny4opt  fcs t  2rr(moot4oexoifciatlsDelu s;u)alxoxf3ootlmtr iei s0s2xoxm3oudlpt  fvilt sDtr(r ou4apx io3tydfm ran snu)arxrioctotlmt  n ol(0tetrxo nydol e nci s)aDumur ;u4alxo ocildfs em(mp;(4aeenxf oy1oa  anei;()s2umxo iu1opt  ncsat)a2tau  ;o1aee ifciltls rmuvsnt4 lxrmr3io1lmDr n ol() exmxr3oydomte ivt (farraumo;u1olenifcias s2ra(ms;()trenxf3oytlmD lieo s t2tmxopoo4omeelfvtat sDtm(m nu0tlto ieiysls2ua(ms u)texnmo to1omt liei ( trxm(m iodaleemictl(f Dtaxront0ape  oeiltla2ranmsnu0alermr to1faDeau s t0s2xm(rpoydal  mfet t)aDtm(r oo0aeenmoeiyt a eanvs;(4tlxrxrciodfpDr ivo;s  rxo(m3ny1ape mfet s sDum(mont4tet ifctadfa2emu snt4tlxnio ia1fm rluvols  rtrio3no4omee ict (  Dum(mp;u0oltoii3iasfa um(mp (4 rtoxr ta1oatranvsls)t2toir oydlptnmicil( srrmuroou1opto fetatfs ul(vp;(4aeermrcoydfpDranvo s  rtrxo3oo4ale miet t) Drmu ont1opeoifeias m2ul(ms;(0 rxnxo tytfp rlneo (0srumxrpnudllenliei tfartm(mpnu1aetomoeildfsDumu pn(4altnmo3iodlm r u ilt)s2umxr no1lp e fesa(fsDumumonu1apeo i3iatla2emuvsn(4tetnmr3oadlmDe ivo s)texr(m nu1lp  mfcsl() 2tr(  no1tet moeiad a rl( p t4arxnxfctydlmtranvilt) etmim ny1amtnlnci ()s2ta(mpou0tle mietltfs emnvs u4treoifciadlmDr uei s)srtoiopoy4om elfvslt arta(mooo1texomi3iytlm uan p;u) ltnir3iytoateaiei t0seumxm iudale  nvi sf 2rm(mpoo4oex moctysfm ran pnt4aeermr todfmtraneolt  2trxm io4op  miei sfa2ra(rono4tee mfeiad m em(mp t) etrmr tatlmD luei;t0 exmxm3nu1lmtemieil() rra( ooo4tpeo icildlm2rmnmp t4aeerio3iydopteli o;s) 2urxo3nu4lmt lfvi s) 2uru  ;u1oexo ieiad a uauvpnt)tltnmf3totlpDrlnvi ()s2xmir oy4lpt  nvs (f 2um(m ;t0texnio3iyt s2ra( s (0 lenmo3oo1lp  aiesl( trxmxrpoodlmt lnetat) 2tr(m ;o0tlto o3tatfmDuan pn() rtnxr3oo1fa r n i t)t2trxrpiy1omtnmiet s srrmx  ou1alt io3tlslm2rluvp;u0 rxniocootfmD lu sl()teuo(rpoy1amenmfvsa() 2rmx o;t4tpe ii3tas s ean p t4 lenxr3totfm ean s;t0texr(r oydlm  livta()artax  ;t4altoiociys a2umu pnu4trenio iodomDeaueo;t0trtm(opiy4am  lieiatf Dtaxrp;t1oeeo ociad m2uau onu4 etrio tydfpD lueslt) rtrxm ny1ol e ivslsfaDtaxmont4tle ioetyslm2umuvo;t) rtrmrctotlmDe uvolt0seumim oy4ap e nvta( arurxmono1opx iociatla ul(vs;()altrio oy1lptelu o t  2xmxopio4lptnmivsasfaDtaurpoo0tltoio3ild a eauvon(4trxnio iatopD auvol(0 2tm(opiu1lp e ici s srtmu oot0tpt  fetatls2eauvs;u0alxnifciy1latr nesls0teto(rpny1lmt mfci t)sDra(  ou4alxoif3iaslsDemuvp u4artoioctadlpDe ieslt0 2trxm3iodlme mict t aDumxmo;o1teenio3iadla ea(ms u)aeenxf3iodop   i olt)t2toxr io4apee ivtatf Durxmoot1tpxn f3iat s2uan s;t0tlxrmocoo1laDeli sls)t2xm(o3ny4olenlfvta( arua(ro;u4apxoiictlsfaDra(vp;(0aetnmociadom  lnvs ( t2trxm3nu1aptelfeil( aDurumoou1tleo i3iltlaDelu s u4alxoio3tytlptr nvsls) rumio3iydom nmfctas)s2tmxm ;u4alx mo3ilslm uaums;t0aexnio3to1la   ivi;t)s2triopoo1olt mnviasf 2rmu ont0tex ifciyt s2ua(vs (4 renxo todlm ran s;t sexrxm3nu1lp nmieias)sDtmu  ;o1ope  ieiytfmDuluvs t) lenir iadlmtelies t0trtoxopiydamte nvs t) Draurpno1tlt  o3iydfa uan ont0 lxnmo iotop  ln ils) 2xoxmpnudom nlfvsls sDrm(r no0oee mociydfm emums (0 leomocoa1op raueo t  2to(rpiu1ale lfvi sf Dra(r ot4olxnii3ils m2ra(vpnt)alerxfctadfa ranesls0s2toiopno1amenlfvs t)sDra(mpou4altn f3ilslmDeanvsnu4 rtoxo tatlaDraivo;s0t2tmxm3oydaptnliet (f ruru oot1olxniociatfsDumums;t4aetrio3iadlmt luvol( s2umir nu1lptnmneia(fs2rmxrpnu4tlt ifciaslsDulnmp t0alxomrcoo1oaD lieilt0trxm(opiodolt lnvs s) 2tmum ot1apt mociadls rmnvo;t0 rermf3oatfmD ai s s  2xrxo nydam emieil() Dtrx  ou4tpt  f3ias aDuanms;()alenxfciodlm  an i;s0texr(r iu1op n ieiltfarumurpnu1tpe mfctyd a uanms (0 eenmf3oa1om eauvsls)texr(r3nydlmt  nesat srrrxmooo4oetomi3tld s2um( pnu0 exrxr totlaD aivo t)seuo(mpny1opeelfvilsfs2tax  ou1altnii3tysfa ea(vo (0teeoir todoa  aieilt  etm(opnodlm   nvsls) Duaumoot4tlen oeiaslm2elu p;(0tleoio oy1omt luvsl()t2tr(r3nydamenmnes sf rtmxr no4altniieiaslm uau s;u)teeoxfcootfm   nes s sruo(mpno4lle lfvi s) Duaurpou4aet mi3iatfs ul(ms;t0 ltomo3iotlmtelivi s) 2umir iodlm  mivi sf Drr(rp;t0oeto feiytlm rau p;u)trerioctotom  lnvol()s2uoxm iy4am   neil(fs2umx pnt1apt moeils m2ea(vsn()trxoxr iytoaD lues (0 2tm(rpnydape lfvtls)sDtr(mpnu0aee moetad s2rlumo (4artoxoctodlmDrli o;t srtrir3oy1ape  ncta(fs2rm(rpou4tptomo3iatlaDrmuvs () exomrctadop elu ils)srtm(opio4ol e ies (faDumu p;o4aexnif3tltfm ra(mp;t0 ltoir tydopDelnvilt0 ruoxr3io1op emncslsfs2rmxrpou4aptnmo3ilt a2rlums (0 reoxrcta1lm eli i;t0texoim oy4ol n nvias  2ra(mont0tlxoio3iad a ra(vs;(4aetomfctodla e nvs t0s2xrir nu1ame lncs t srur(rpnu0alx ifcildfa2rl(mont)artoxfciydfmD aivi t0setm(r no1olte fvtl(fsrua(  ou0apxnmf3tytfm2emnmon(4arxoxoctydlp  auvslt)srxo(r3ny4apenmfvs sfs2tm( o;t4oltnmfcils a2umumo;u4trtrio3ootla  aivsl()trurxm3ny4lp e neta(fsDtm(r ;o4tpxnioeilsfs2umn pnt4tetrxf3iodlm elieo;(0srxmxo3nodoltnmiesatfs2rr( ont1olx mi3ildlsDua(vs;u0 rxnif3iy1lpDrln i ( t2tr(r3nodlpee fvsls)aDrax pno0tlenmo3ildlaDem(mp t4 rxnxf3oy1faDrai o t sexr(m3nudlm e nvt ()a2um(rpoo4tleoii3tytlmDrl(vsn(4 rtoif iydlptelieo s)t2xoir iodop   iciltf Draur ou0aet io3iytla2eaump u0 exrio3tydoa rlueil( tetrim oydapt miet t)aDur(  ;t1olxoii3ilsla2uanmo u0aeermr3ta1faDeaneilt srtmir3oudomeemnei ( s2rauro;u1apxn feilsfsDraumonu0tleniocoy1lmtr nvsl(0s2uoiopno4lmee fcils  2taur ;t4ope mfetysfs umums (0trtrxf3oy1faD aieol(0setriopnudaltnmncs t arrr(mpnu1oltoiociltls2rm(mo u)trtnmo oytlmteaivo;t t2um(rpio1lm nmnvtat  2ua( pnu0aexo fctltfm2uan snt4tltrxo3tadlmtrlivo ()sexo(o3oudolee ieia() ruaxr no0aet  fcildfm2el(vonu4trtoir3iydfp  lieo;s)seto(o iu4lpt  nvi () rtrx pno1aet  ictadla2eaumo;t4 reoxocoydfpD  iei;t0 exr(mpio4omeemivs (fsrrrxrpou1tleo i3iytfs2elnvp u4trtrxr tytfp r n slt t2xr(opiy1aleelfvi s  2ta(r ;t1opx ii3tltlmDeluvp;(0 rtrircia1omDr ues;s)t2trim3no4alenmneil(f rururpot1oexnii3iltlaDulnmpn(4texnmo oydfaD lnes s teto(opoy1opt livtat s2um(ro;t0opxomfctls a2um(monu4artrxrcoydlp r u il(0teumxr3oodlp nmivslsf rtrumono4opeoiietltla2ua(vp;u)aetrxocoydfpte ies s0s2umxm3nu1lltnlfci sf 2raxmont1ole mfcils a2rlnmont4tlerir3tadlptr nvo s)trumxm3iy4ll  mictl(f rtrxr nt4tlx  ociadfs2emu s (4 eenir oytop  auvi s0 eurirpnodll e ncta()a2ur(r oo1opt mfeiydfmDumumo u)artrmrctadlatr n sls srurxmpou1oleemfvtatf Drm(ro;u4tetn i3iydls ea( s u)aetnmrcia1oatelu s;(0tetr(rpoy1apt  ncias sDtrurp;o1optnio3iysfa2ulu s;(0teenmfcoadopD auvilt sexm(r ou1omtelnetas)artmu oou0olt  octadfmDel(mp;(0aetoifcio1fmtrluvil()sexo(mpiydape lics s) rraumpno4tpe io3ilsfm ran o;u0 rerio3oa1fpD aneilt)s2tmir nudoptelnct s)aDtmx onu1aeeo o3iytfsDean p ()arxoxo oy1lpD anvsls) etrir nu4oltemfcsa( aDum(m ;t0oexomoeiydfsDeaumon(4teenio3iy1lp eai o;t)trumxrpio1llee ieta(fsDua(  ot4teeoif3tlsfa uluvo;()artomo ta1fa elnesl() 2xo(m iu1op  mivsas)a2ra(r ;t0teenmoeilsfm umuvp;u0tetrircoa1lp  lu ilt0texoxo3nodamt mncil( sDur( o;o1opt if3iyt sDel( snu4 lxnmfctytlatrli s s0setoxrpoydope mnctlsf ruru oot1opxomf3iadla el( pnu4trxomo oatom  ln s t0 rtm(mpoo1ome lfctlt) rtmxroot0tlenmi3iatfs eln o t0tetoxfcoa1lpD  ueo;( t2xm(r3iudoltn nei (f 2rmumooo0ope mo3iltfm el(ms;(0tleoxr3totlmDeaneo t srxoxo3io4alenmnvsat s2tax  oo4oltoioctas a2rl(vp;u0 rtoxf oytopD  n s (0tetm(o3oudop   feia()aDum(mp;o0tpt mieiltfs2el(vp u) rtomrcoa1fm e n o;() rum(o3nu1llt mietls  2rmxront1tptniociat m2umn pn(0trtnxrciatlm eanesl(0setmxrpiudam   nesls)s2tmurpoo0oeeoifciasfa um(mo () rxnifcto1lmtelu s;s) rtr(rpny1alee nvsat a2umu oou0apenifetlsla rlnvp ()altoxfcty1lmDeauvolt s2xrxr3nodll nlfcs s)sDrmx p;u4optoiiciydlaDemu o () rerirciatlp  au sls  rxrxo iodomtemfvias)aDtrum ;u4olxniietat s elnmo t4 etomo iodlateliei;t0 ruo(opiy4am emivs ()srtru  nt4opx mieiyt a rm(vp u4alermf3ta1fmt li o;() rtoim3no1am emnvsas a2tmu ono4texniociadfm rmn p;t) eeoif3oo1fate nvs;t  2ur(o nydomen ivta() 2uaur ou4ope mfetysfmDrm(vs;u) renircoy1lat au i s)trtoir no4ole mfctat) Dururpot0altoio3iysfmDranvp u0texnmr iodfaDe ueslt0t2xo(o3iy4al  lfvtls)sDtax pou4tpx  ictaslaDea(msnt4tlxnif3to1fmDraneo s)sruoxrpiu4apeemnct ()sDuax ont4aeeo feilsla2ulnvp;u0 rxoxr to1lm  aivo;t  eum(mpoo1lp n ivs t)srta(mpnu1apt miciasla eanvp u0 lermf oy1lm eanvsl(0 rurim3iodapt mnvsl(faDtrumo;t0altn ictldlm ulu pnu4arxnio3tadopDelneslt tetrim nu4lleemicsls)a2um(m nt4alx ioeild a2emn snu4tetnxocoo1fptrai i;( seurim3io1am e fvil( aDrr(mpnu0oltn feiydls2rlnvo;t4aetrxr iytlpDeaiesls)tetoimpoydamenmict (  2um( p;u0oeenmf3iasla rl(mp t4 reoircoy1lpD auei s0trxoirpno1oltnmfet tfa2rax oou1aetomo3ils m ea(vp;(4 rtnxr3oodopteai s (0 2tm(m3nydamee nct sfa2rmumono4aet mfciytfmDemuvp;u)tltnmr3iodlpte uvs;() 2umir oy1olen fvs s arra(monu0aex ii3iysfa raump;t4 lxrmrciy1lmDeau s ( s2trxrpiu1lm  mici () 2ururonu4tltnmo3iltfaDeluvp t)aexrif iydoatr i olt tetrim3oo1lmtn icsls)srrmxr nt0texomictadlmDrmnvo;() eeoxr3iytlm  auvolt t2um(m3iodlme livias)s2ta(mp;u0altoii3iydla eau snu)trtnio tatfmtrlnes t0trxrxr3nydap n fvs ( s2rru  nt4oexn fctasls ua(mo t4 eeoir3iy1oaDeau ils srxrim3iydoleemivsl(f rumu pou1tltn i3tydlm ua( snu)teeoifctotfptraieo t0srtmxo io4am e fciat sDtaumont0aetnmfetaslaDem(ms;u0alermf3iadopt  u i;()srum(o3oudlmt  nci tf rtrumpnt1opxo oeias mDran o;(0trtrxo3oatlm rliei;t)seur(r oo1apen nct (f rrrurp;o0alxoiictytfm rl(mpnt)altnifctytomteaues;()t2xmio iy4omt mfvi s  2urumo;u1texnmociat aDrlu snu) rtoxrciatlmD  ies;t0 eum(rpnu4llte nvt t)srur(r nt1apx ii3ias s2elnms;(0alxrmf3iydomDelieils0trxoxopoodome lfeil(  2ur(m no0optomf3tydlsDum(vsnt4tetnmo iy1lpD livil()srxmxrpiy1om nmivilt s2urx  nu1apt mieildls2rlu p t0arxrxr ia1opt  ues (0trurim3oydopte iesl()a2tm( o;t1opto o3ilslm2em(mp ()tltrif iatlm rli i ( texoxopio4apt  neia( s2truroot0texn ieiasls rm(vs;u)arenxo oo1laDranvsls srxoio3oudamt mfvias  2trum ;u4oetoifciat aDrlumonu4arenxr3oodfmD lues;t0trxoxm ny1ap n neilt  rua(r ;t1apxn feildfm emump;(0trermo ta1fatelnes t)t2toxmpno1oleemiviat s2rmu p;u4oleomictld m elu s u) rtoif3oydfmDelivo t) euoxopio4amenmnvsl(f rtmx pnt0oet  oeiyt a eanmo t0trtoxf3iodfate nvi t) 2tmxo3no4ap elnvi t  Dum(  ou0opto o3tadfaDuluvo;t)trtrxf3iatlpteaies;s0truoio iu4lmeemfci tfs2ur(r ot1tpxnifetlsfaDrmu o u)tlenio3tytfpteaivsls0s2um(m nudlpte nes ( arta(moou0alxnmo3iydfsDuanmpnt4trtomrciodomt lu s;()s2ur(o oodopte iesas arur(rpnu4tpe mociadfm ranmo u0 exnmr3oadopDr nes s)s2uoimpio4lpe mies tfsDtau p;u1apenmfetadfa umn p;t0tlxoiociatoaD  nvi (0 exmimpio4al e ivil()srua(ro;u4apenmieiytla rmu o u)altrmo iotoaD  u i;s0sexmxr ou4lltnmncsltfs2tm(mpoo1oet iiciltlmDulnvs;(4texoxf3todfpD  nei;()sexmiopiy4olt lnvia(  2rmx pou4oexo feiadfsDeauvo;()aexoxf3io1oaDr nvil( teuo(r3ny4olenliet s)srtax  no1apt  f3tydfaDra( s;u4aeeoxoctydlp elieo;(0 2tmiopou1lltnmfcsasfaruaxrpou0aet mfeiadfa umn p;(4 rtoif oadoa elnvils0sexr(o3iy4lmenmnct (fsDrau o;o4tet if3iys a2ul( p;() leomrcoatoaD lnvol() etrio3nu4lptemfvsl() rtaxrpnu4tle  o3ildfs emnvp u)aexoxo iy1fpDr uvs s)trumimpno4op   nesat aDraur ;u1oltnmf3iltlmDrlnvp u4artrmf ta1oat auvs;( setoir3no1lm   ncil()arra( p;o1alenioetaslsDea(mp (4artrmr3totlpDraueo;s0s2toxr oy4ap emnvsl(faDraxm ;o0openmo3iysfm2ulumon()tetrirciy1fptr n s;(  rtmir3iu1ol  mnciat) rum( o;u0tpxo o3tas a2eluvs;u) lerir3oadlpt auei;t)t2xmim3iudop nlnei (f 2ta( pou1opt mf3iysfa2ea( s t) rermo3oodoaDr u ils)teuoxm no1apt lfviatfa2rmurono0tptomf3tldfmDem(mon(4 rtoxo3oatfp e ivi s seuo(m ny1optnmicilt sDuaurpou4oetnmieiltlaDuln p t)teerxr3to1oatrlnvilt texm(rpoudolee ivtat  2raxm no0aex  i3iadls ea( snu0arxoiocio1lpDran o ()srtoxo iydolt mnvtls)s2rax p;t0tex iiciad a2umnmon(0trtoxo3oatfa elnvol( trtoim3oo1olt lictl()arra(mpnu0ole iiciatlmDea( on(0artnif iadomteln o s  2xrio iy4alt  ictatfsrtm( pno1apt mietltfs umu p u4aeeoirciodfmD au i t  2tmxmpoudlptemneil() Dtmur nt1tptn fcias aDuauvo;(4aetrircoadopD lnvo t seum(r3iudamte nesls)aDta( pnu1tlto fciyt mDulnvo;u)alxoifciotlat lnvi;t s2ur(o3iodap emfet ()srra(mpou0ale ii3ildfm2emuvo ()aetnxr tydlpt lnvi;s)s2tm(rpoo1om  mfvs ( arur(rooo0aexniiciyslm2rlums ()areoif3oatopD luvi;(0 2uoxopnudamt  fvs () Duax ono0teeomo3iys mDean sn(0trxoif oytopteau olt0 rurxm3nydoptnlnes t)arrm(m ot4aeeo o3tadfs2rauvs;() eeomo3tydopDr nvo;t0texm(mpoydlltnmnvsat  rum( ont4oet iietat a ea(msnt0arerio3iatomDeluvo (0 rur(mpoo1lmtelnci ()s2trum ou4tpt  fetlsla2ea( s u4teerif oa1fptrluei;s seur(r no4ame lfesl()s2raxmp;o1tlt mi3iat s el( o u0tltnxr oodoa eai ols0 2xmim3iu1amte fetls sDtaurp;t0tpt  oeildlm ra(mp;(0aeenxocio1omt lnvi ( truriopio1omtnmfetlsfsrum(mo;u4ole moetlsls eanvo;(4artrxo tatlpD li o (0t2xrxr3iydlleemnvsas) Drauro;u4opeo ictlsls2ra( pn(4artnmr totoatelieo t sexmxo3iy1opt lnvt s artru pot0aleniieias aDrmn s;t4trermf oydom eauvilt teumxo iy4ol nmivia() 2tr(mpnt1tptnmfeiydls2rl( p;t) ltnifcoadfm r nvs s0t2toxo3iodlmenmncsasf 2taum ou0apeomfctas aDrln s;t)tetnmf3oodoateaneo;s) euoxmpny4op n fetatfarta(  ;u0opx ifeiltfmDumn s;t0aetnircoydlaDrau ols sexoirpno4apen nctlsf 2urxrpno0tpeomiciad aDem(vs t)texnmf oy1laDelu ols  exoir nydlptelivi t aDtm(rpno4aeeniictytfs umu pnt0 reoio3iydoa elues;() rto(o oo1amt  iviat a2taxm ou4opeoifeias a rmu ont0altoio3tytoaDran i ( trxrir3iydol  lnesa()a2urxrpoo4oleoioeiatfs eluvp;t0tltnmr3ty1fmDr ueil( trxm(opoy1omte ivsasf Drrxmono4ole  i3iydlaDua(mo;()aexrif oodopteln il(  rxrio io4amt lncslt) 2taxmpot1oeenmoctlt m2uau o (0trtoxrctytlpteaneo t t2umir io1omte fcsa( aDraum nu4apenif3ilt m emn s;u0tetrmo3todlpt  i i t0srum(m3iodomeemicia( sDrm(moot4olen o3ildfa elums;t)alxoxr oo1op  lu ils)teto(m3oy4lmen ivt sfaDtmxmp;u1texomfeiatlm2emnvpnu4 ltoxo oodlm   i s ( trumirpoy1amt  nctls srumumoou4texnifcilsfs rl( s;u)tlxrir tadfmtranei ( tetrimpou1lmt mfeta(fa2tr( poo4opx mf3ias mDuanmp;u0arxoirciy1oat  u ilt seto(o oo1lmenmnes t artaum ;u4apxnmoctld mDeanvs;u)aleomfctotlatraueils srum(r3nydlltnmiesas) 2trxr nt4teeomo3tyd s2ra(mpnt0aexomo totlpt lnvil( t2triopiy4ame lfet ()srtmxrp;o0tlenmi3tldlaDemuvsnu4artoircty1omD  u olt)srxm(mpno1oltemnvia()srtru o;u4apt ifciasls2rm(mont) eerircty1la rai o;t0s2umio oodalt  icta( a2umuro;u0tetnmfeildla2ranmsn(4tlermr3iodlp  luvilt  2tm(r oo4aptnmnvtltf 2tr(m nt4tpe if3iys mDul( s;()tltrir io1faD aueil(0 2trxo3ny1apenlivias aDurumpoo1aeenifeias aDrmn s u0 leomocio1lm ean o;t t2trxm no1lmt mictlt)srrr( pnu1oeeoif3tadfmDulu pn()trtomf3oo1lmDrli s s0trxm(m iy4oltnmicsls)srrr(moou1apxniocildfsDea( s u) reoirciy1laD  uvil(0trurxm iy4opt  ivils srrmurpno0oee  ocild sDul(vp;t0aeenio3iy1op elivils  exoxm3ny1ope mfct (fartrumo;t4aexn ieiasfm rl( s ()trerifciotop  aueols)t2urimpiu4om n ictat)aDta(mono0ape ioeilt m2raump;t4alenmr3iotoaDe ueo;( t2umxm oy4ale lfet (f rtaxrp;t1aeeomi3iysls2ul( o;u) rxoir iytlate n s;t t2um(o3ou1lpen fcta(  2ua(rpot4tetomocild s eau o;t0 ltrxociadlpDr ivs;(0t2tmirpiudlltemfes t srtmxrpnt4teeoiictyd a2ranvs;() lerxr io1opDr uvo s0s2uoxr3ou4opeemnes s)srtax p;u0opt ioeils mDem(mo () rtnxfciotomDeaiei;s  2xm(m3oudlp n fesl( sDuaxm ;o1tpxo i3tyt s2elnmpnt)trtrio oatopD  i i;() rxrxo oudoptn icslt srra( p;u0tltoiietadla2rau snu0arenmr totopDr ueo (0trumio nu1aleemnes s)srrrx  ;u0tle mf3iyt m2ea(ms;t)trxrxr3oa1oaDr u ilt)sexrimpoo4alt  nvi (fartaump;o0oetn feiytfs uaumpnt) etrir ta1omDr ueo t trxrim3iu4alte icsas arurxmp;t0tlxo fctlsfmDrau pn(0alxrirctydfmte n i;() 2toiopio1aptnlivsl()srtmuro;o1tlt  i3tytfa2emn sn(4 etrmf3iytfmteanvsls) 2ur(m3ou1lp emfct t sDumu ont4oeeo feiad m2ea( p;t4artoxrcoytomt ai sls  2uoxo3ny4ame  ivt (faDua(m ;u1oet io3tltlmDel( pnu0 lxoir3to1optr neslt0tetm(m oudop e fvt (  Dumu pnt0oexnmfeias sDumuvsnu4tlxnif io1oat luei;t  eumio nudam e icslsfsrurxr ;o4altoiociadlsDumumpnu) lxrif ootfa elieo;( srxmxo nydopeemfes t srumxr nt0oetn ietysfmDrlu on(0aetoir3iodlmDranvolt sexoxo3iodaptemfviltfs2tr( o;u1oltoiieiadla ea(vp;(4 lerxr to1la r ivs;t0 rto(opiydomtnlnvtas artrur nt0tlxnifeiatlmDrm(ms u)tlxoifciodlat  ivi s setoiopnodol  mncsa()arta(mpou1tpenmfctltfs2emu p t) lxnir3iatfa r ies (0sexmir3no4lmte fesas  Dra( p;o4ole  fctldls eauvp () rerir tadfaDranvi;t t2xo(m iy4op nlivil( arraxmpot0apx  i3tydlm eau p t)alxniocoo1faDelneols0seto(o3nodapenmfes ()sDumu o;u0ale iieilt aDumn p;()tltoxf3oatopt lu o s0t2xoxopiodaleelicils  2rm(mp;u4tetnmi3tasla emumpnu0 lermf todlmt  ueo;t tetmxrpoo4ol   fcsls) ruauroou4ale ii3tlsfmDua( sn(0 exrifctotfaDe ivo;t  2xo(mpiudlpen fviat  Dtr( p;o0tpxomictadfmDrmn s t)altnif3tadoaDrlivi;t) eum(r oy1apeelncta()sDur(mont1aexnmf3iaslm2ranvsnt4tlerifciadoa  ai i t0trxrxopny4ll emnct s) rrmumoot0aetnmoetasfm2rm(vpnt)aexnmo3to1oa r nei t0 2xo(o3iydamtn ivslt)sDtaumpno1tleo o3ild a2elnms t4 renif3iydfmt  u i;( s2ur(opoy1altemneilt)srum(mo;o0tleoio3iadfmDra(mpn(4texomf oo1oa   nvolt)setm(o iy1omt livsa( srrr(roou4tpeo fetadlm eluvsnu0aetnxr tatomt  nei;t) 2xoio iy4openmnctas) Dtrump;u4aexnio3tldlaDuaumsn()alxnir iydfm rlneo () etmiopnu4ap   nvilt)aruaxrpnt0opx  i3iyt m2umnmp;t4trxrmf io1oatrlu i (0sruoxo iy1oltnlneias)srum( oot1texoii3iaslaDul(von(4 exrxo3oatom eluvi;(0 eumir iu1ll  mfvi t)arum(roou0oet ifcild s ra( p (0tlxoxf oy1faD  ivolt srxrxo iy4ope  fci sfs2rm(rpoo1ale ifeiytfaDua(mp;(0 rermociytfa raivo;s t2toxr iudamt  iviasfsrtaxmpnu0tptniociytlsDrl(vp (4 etrxf oo1lpteanvs s0 2tr(rpou4olenlncsat)s2uru p;u1oltnmfeiat s ulnvonu4tltnmr oydlpD livols)srtrxr3iudol emivs s) 2ta( p;u0tetnifcildfsDea(vs;u)aeerxr3oydlm  luvilt texo(o io1aptelncs t)artrurpnt0aexomieiytla2umums t)arxrmr io1om e uvils  etoxr oo1ol e fcslt s2ta(mpoo1altnmoeildlm rmn s;u0 reomr3iodopt au ols t2trir3oy1amt micsa(  2rmu pno4optoifeiasfm2ulu s;u) lxoxo3tydoatean o;t0trtoxr3oo1op  lncil(  Duau oou4tetniociltfaDulu pnu4 eenxo3ia1fa  auvi t0sruoxo3iu4opt  ncia()aDum(  ;t0ale ii3tyt a ua(vp (4 eermo3ty1op  an i s0s2urim3oo4lpte fcslt s2rmxmoot4olx io3iatfm raumon() eeomrciodopDe nvo;t  2um(o oo1oltnlnesa(fa2rmu ooo0aetnioctlt a el( s (0texrxf iydoatelnes t texo(m3io4ope  iesat) 2rmxmp;t1tpen fciltfa2rl(vo;t4 rtomr ia1om  luvs (0 rxrim nu1altnmncias  rra( oou0tpxoifeiyt s ra(vs t0treoxf3oatlm ean i;( trxr(rpoydom e nviatfsDum(moou0olxn ocilt s ulump;u0treomociatlmDeau s;t0 rumir oodamtnmnes s)srtmxr no4aeeniieild m2rmuvpnu) lenxr3todla eln i;t)setoxr oy4optelicsas) 2umu ono0olxomieiad m eauvs (4aeerxfciodopD luvs s srtmir nu4op  livtat)aDrmu ono0ole mictatla uan o (0trenif ootoaD lues (0seto(o nu4ol e fci t) Dtru oou0tlxnifeildlsDel(vs;u4texnmf iodom rai o ( texr(o oy1lmt lietlt)arur(r ot4tpx mo3iydls2rln snu0texoxrcta1faD liei;s t2xr(rpnodop  miesat) rur( ont0oet ifetytls uau s t)aexnir3ia1la  aneo s  exoimpoudlptemfes s srumumo;u4alxn f3iadlaDemnvs t4 eerxfcoodlaDranvsl(0 etr(mpoo4optnmicslt) ruaump;u1oleo fetatfa2rlumont)treoxf3tadoateauvil()s2um(m io4ape lncils sDtmu pnt0apx mociysfa rluvp (0tlenxrcoatlm  lnei t srtrio3ou1lpe mivs (fsDra( pnt0ope ifctlt s emnvp t)tleomo3ta1fmDr iesl() 2xrio iu1altelnvtas) Drmx p;u4aptomoeiyd s2rm(mp u)aexrxo totlmt luvo;s teto(mpio4lltnlfet t s2ururpnu0optnmicilt a rluvs u4aeeoircoytlm r uvi t0trtrxrpoudol emnvtatf rumu o;t1apenifciatfa emuvsnt0 etrmf io1omteanvols0trtoxmpiy1apt lfvi s arrr( ooo0optnmi3tltls2rm( o t0aeerio ty1lm  an i s0 rurir3iydamenlfci tfsrrm( oot4tptoifeiyt s2rauvon(0 ltoio3oytlpt  n i;(0s2to(r3no4lptnmicils)sDtr(r ot0tex mfctytfs emuvo ()artoxf3oadfmt  neo t)s2to(rpiydlmt  fvsa(fa2tax  ;o0tle ii3iatfaDra(vs;u0 lenio3to1omD  iei;t trurirpoodlp e fcils)s2umxmoot1aetn i3iatfsDuanvo u0 lxnif iy1oat auvs;( srto(o oo4ap  liviltf rtrxmont4optnmo3ildfm rmuvpn()trenmrciytlpte u ol(  2xrim iy1al  lnesl( a2rru ont0oexn f3iytfsDulump;t) rerxf3ootom r ueo;s srtrxm oy4lle  ivilsf Dur(mpot1olto oeiatlsDrluvp t4 eerxo3io1oate nvo s texmiopio4llen ivtl( a2umumpnt4alxniociysfa rl( s t0 etoxo iy1lpDranvilt srurxo oy1oleelieslt a2uau  ;t1oexnio3tys m ua(mo;t0trerxr3oy1fmD aueo (0 exriopoo1aptnlfesls)a2rax  nu4tpxniocildfm2rln on()trxoxo totfatrln s t) eurir3oo1altemnviltfarrruro;o1tpto o3tas m2ulu p () etrmo3tadlm  lueols)truo(rpiudom emfvtlt s2rau  ou1ole ioeiyslaDemn o t4aetrmo3iytopteauvolt0sexr(m3nodomtelfeil(  Dua(  ;t1oeenmfeiat m2umnmon()tlxoifcio1lat  ieslt)s2to(opno4omt  fvt sf Dtr(m no4apxn f3ilslm el(vpnu)teeoif3ty1opteaivs;()t2tm(r3ny4op  lnvta()a2trxm ou4ope  o3tatfsDelu pnt)trxrioctodlpt aiesl( s2um(r3nodamenmiesatfsrtmumpot1tlxn fetatlmDea(vo u4 etoxfcoodlmt  ueilt0trumxopou4ll nmfctas srtmxr no1apx  f3ildlaDranvp (0texnxocoodlm eau sl() 2xo(m3io4optnmivi t sDtaxmp;u1tpe iietadfm um(mont)teenxo ia1laDrauvo;t srxrxrpiudlmenlfetas)artm(  oo1opxomo3tysla2rauvo t4alerifctatlm rauvi t)t2xoxm3io1lpenlnvtl(fartaxmont4opeoii3iatlmDea(vp (4tltnif3tytomteaivsls0 euoir3ny1ap eliciatf rur(  nt4tptomfciyslaDuan o;u)altnio3tytoaD  ieo;s  etm(rpiu4op elicils)sDum(  no4tptomoetydfm2rauvonu) exrxo3tydlpD lnvs (0trurxrpnu4ole mfvsa()srumumpot1aeeoiietydfa2ua(vsnt0trtoxrcoa1laDrlu o;s0setrim oo4am e neslsfsrtmu onu0aee if3ild sDeauvs (4 leoxfcoadlat luvslt setoxo3oy4ap  miviltfartaurpoo0tlxn iciltla2eanvp;u0tetnmf3iytlaDr uei ()srur(r3oudllenlictltfaDtmx o;u4tetoii3iatlm2eanvp;u4areomr3iy1oaD ln ils)t2xmimpnydopenlfesltfs2ra(rooo0aee if3tys m2ea(vo (0altrmo3oa1lm elnes;s0 2tmxrpio1ol  lieiat a2ta(rp;o1alxomociatls2el(monu4aetnxf3io1laDr u ol(0sexm(m ou4op   ies (  2ua(m ot0apeomoeiad m2uaumsnt0tlxrio iydfate u o;t  rxoxrpiu4amt mfvsltf 2tmum ;o4ape moetydfaDemn p () lxoxo3oa1fp r i s;t)trtoxo nydom  mfvt t  2rrxmpoo0opto f3ild s2rauvs u) eeoxr tytlp r ueo;(  exrxo3iy4lp elnes ( arurumpnt0teto ociydfsDelnmp;(0artrmr ty1fpD lues;t) rtrxr3oy1llt lfvs sfarta( p;o4tet if3iysfm eln sn()aetrxr iotlm  lneil( teuoxo oydlle  nvtasfsDtm(r ou4tltomocias a2um(mo ()arxrmf3iadomDraueolt0 2uo(rpno1apte fesa( srtaurpno0tpe  fciad s umn snt0aeenxrciotfaD ai s (0 2uoir no1amtnlnvilt a2tmu p;u1tee if3tasla uanvs;u)tlenir oadlmte ieo s  2xriopio1lp nlfcsa()aDrrxr ot1alxo ociytla rln snt0 rermocoatlate nes s0 rtoxrpnydamtnmneil(fsruaumonu4opxo f3iadla2eauvo (4aetomr3oa1opt  ueo s0s2umxopou1lm nlnvil(fs2raxm nu1tlto feiad mDra(vp t4alenir3oo1op   ivil()texo(m oo4omt lnesatfs2tmxrpnt1tpenmiciadfaDul(vs t)trenir3iytfpDelieo t)setrirpiy1lp emfeilt aDrmumono0tleo i3ilsfa2um(msnu0teermo to1faD an ils  rxoir3iy1lmtelfcilsf 2rmu p;u0olenmietld m2ranmo u)tlxnircoytfpDrlu sl()seuoimpio4ape mivsatf rrrxm nu0olxn feiysfa rl(vs;u0artnxr3iy1omte ieo t  rumir nudolen feiltfsDrru oot4tleomo3tltfaDuln pnu0tlxnxfciadfa rliei (0teumxmpnu4alenlfvtls s2rr(m nu1aexoiocild sDemnvp t)tlenmr3ta1lat lu s t0trtrxo3no1lmt mfci tfsDta(  nt4aptoio3iyslmDrln ont0texrmr tatlmDeli slt0 eto(r iydlltnmici s aruru oot0aet mietaslsDra(vp;t4tlenxrcoytop rlu s t)s2tm(m3no1ap emies (fa2tm( ono0tpe mi3tasls2emnms (0 etrxoctotfatr ues s) rtoxo3iy4lmenlicias  Dtmu o;t1tee  o3tytfaDrlu s;t0arerxo oadlaDrlueo t s2uoimpiy1apeelnetas a2tmum nt4tpt  fciat m rlumont)tlxoircoy1lpDr nvo;s0 2xr(m3io4alt  fvs t) Duau o;t4olto feildfa emn snt4trtnxf3ootlmDr nvo (  rtoxm3nu1omenmietl() 2rru  ou1openifciysls2ra(mpn(0 rxnmo3iatomt lieo;() rtm(r3oudlme  ncils)s2ur(ront1tltnmieiatla ra(mp t4 lxnirciotfa   nvs (0s2xmxr3ny4lm  liviasfsrtrur ot0tpeo ociyd s em(vo;u4trtnmo3iytoat livilt) eumimpno4omenmnesa()srum(  ou0texnmi3tltlsDuluvsnt0trerxfciatfatrlu ols  rtmxo3nydoptnmnctltfsrra( pno4tlto ocilslm rmnms;u)aetnxoctadopteaneo s) 2tr(opno4ole  icsl(fs2ur(m nu0optnioeiasfs uluvs;(0 ltrif3oydoa  anvo t  2umxo io1ol nlfci t sDrrx  oo0tpx  octldla2ran snt0trxoif3oy1fmteluvilt0 rxrir3oo1lptemiesasfsDtrxmpoo0olxomfeiyt sDemn p;t0 etrio iydlmDrlneslt  exm(o3ny1lm   nes (f rum( pnt1oexoiieiyt a2em( pn(0tleomrcoadlpDelieo t seuo(o3nodam elnci tf Drax onu4apt mf3ilt m umn pnt4 reoxo3iodlm rlnvol(0tetmim3oodole mnvils)arurxmooo0oleoii3iatlaDumuvpnt0artrmf3oodfp ranvi (0sexrim3io4llee icilt)s2rm(  oo4aeen feiaslm ua(vs;u4 lxrmr3oatomD  uvilt s2xoio3io1aptelictl(faDurxmp;o4tlxnmoeiadlsDum( s;u0 ltrmr tytfm eaneils teuo(rpio4ap nmnesl(fs2ururoou0aeeomieiyt sDumnmon(4aetoxfctotomDeai sls)t2trxr3oy1lpenmneta(  2tau  ot4oet mfctltfm2el( s;(4 exrirctotopDeln o ()seum(opoy1lltn ivia()s2um( o;t1optn o3iatla uan ont4 lermr3io1fm rlies;s trxoiopoydlle  fesltfsDumurp;t4ale ifetltlaDumump (0 ltoxocty1opDeaivil() 2xoirpnudlpt  fes t sDtr(r nu1apt  iciatfaDel(mo u) exnio3ia1la   ues s)t2urimpny1ll e nvs t  rur(mp;o0aee mo3iyt m elu pn(0tltnmr tydfptelnvo;t0 2xo(r3iodamtnmfvs s  rumxrpoo4oexnii3tytfa umuvp t) lxnmr oo1om e i s s0t2tr(m3ou1am elnviatfsrra(r nt1oexnmi3iadfaDrlums;u0aeeoio oy1fpteli i ( trxoir3nu1opt mivtlt  rrrumpnu1tpt mf3tyt m2eauvpnu4altnmr3oo1lp eanvs;s0t2uoio nu1ll emnvs (f rur( pou4olxnmi3iltfs2rl(vo (0tlermr3iotom  anvo s)t2uoio oodopte fesls)arrmx  ou0oltn ictatfs ul(vo t4 ltoiocty1lpteaiesl() etrimpoo4alenmnvs ()sDrmumo;o4aeto fetlsfs2uanvon()aeeoio3tytom ean s t) eurxrpou1lpenmnvia(f rumx ont1tpe ifeiyd mDrlumsnt)tltnmfctydfmDrlivs;t)sruoir no1aleemicta( srtmu pno0aex  octldls ran snt) eeomf totomD aneo;t) 2to(opnu1amt lfvsatfsDrau onu1alxo ietlslaDem( o u)aexnxrcoa1fmteau o;s0srxmxr iy1lpe lncsltfsDururono4apxn iciyt a rmn snu0 rtomr3ia1fa e uvo ()t2tmxrpiy1op elfcsa( s2ra(r no0tlxn ietyd aDeanmont0alenxrciy1lm r nvs;s)t2xmir3oodomenliesat a2tmumoot4aetn ociltfa2ulnvsnt4trxrif oo1fmDraieo;t setoimpiudamte fcs t) rra( ono4optnmfciat mDul(msn()aeeoxf iydfp  ln il() exoir iu4llt mfcsltf rtrxr ;u1aptn feilsla ean s t4 etnir3iytlmDeluvs;(0texmim3iudlmeemivtl()artaumpot0tltnmoctldlaDrmumo u4aeerifctytlpte i i;t) etoio ou1lle mnctlt)sDrrx onu1olxoioctltls2rmu s ()trxrmrciotlptrlueol( trxo(r iu4open iesat  rua(rpno1tpen fetytlmDrau o t)altrxo3oytopDelivi t trtoio3nodlp emict s s2tm( p;t0opxnmi3iltfaDumn s ()arenmo ta1oaDeaneo;()t2urxmpnydale  ieiatfaDuru  ;t4aeenio3iaslm2rmuvsnu)arenxrctatomte nesls0texoxo io4oltnmnes s arrr(mooo1aptomieiytlmDra(mpnu) exomf3totfmteauvol() 2urimpiy4ope lnct s  ruaur nt1tlx io3tld s ul(vo;u) etnirctotla eli o s)t2toim iudap e ncilt sDtm(r ;o4ole mieiadfmDrmu s;u) lxoifciytlateaieols) rto(mpiudlmte ieiltf rra(  ot4oexomfetytfs2rmnms u4alxoir tatoate ueol()srxm(rpou1lpee nctls s2rrxr nu1apenmo3iatla2um( s u4artoio iodlaD ai sls0 2xm(r3iy4lm nmnctas)s2raumpot0tpx mietld a2umn p;u)alxnirctotfp rlivi ()trtm(mpny1lmtn nei (f rtax ono0tpe mieiysfs emu o (4 etnio iydfa  lnvo s)srxo(r nydapenliesltf 2uax  nu1oetn o3iatlmDuau s;()alxrxrcta1lmtran ol(0 rtrir3iy4optelfeiatf Duax  no0optoio3tldfs2umuvo;t0 etnif oydom rli o;s)sexrxmpoudlmee ics t) rra(m oo1tee  fetld s rmnvpnu)tlxnxr3iodoa raivs ()texmim iudomen neslt srrrx oot1tetn i3iydfa2em(mp;t4 rxoxrctodfat lnvil(0 exoxopno4apen fcs t  rrau o;o0tetnii3iydfm2emn s t0tetoxr iydlpDelneols trxrim3oydlle lfcslt sDurxmpoo4texnmfciydls uan p;t)trxrio3tatfm   ivs;t)srxm(opno4ap  mivt t)aDrrxr ot1oet  ieiltfmDemuvpn(0teenir3iy1lp ran s t) euoxr3oo4altelnvias)sDuau pnu4alenmo3ildla2emums;(4trxrmo iytfpDeaueils tetrirpoo4ll nlies s) Drmx p;o4aeeoioeils m ra(monu)treomr3tatlm eaueo s0setrxm iy4opeelnctl() 2ur( onu0aeeo fctytfm2em(vp u4altomo3tytfatranvo (0sexoxopoo1alen ieils  Dumxmpou4tltnmo3iaslm rluvp u4tltnxrciadla  ln i s0 euoxr3no4lpt  nesa()sDumu o;t4olxomi3iydlm rlums (0 rtnmrcoatoatelu s;(0 etoxm ny4am n nct t srrr(rpnu0opeomfeildfmDulnvs (4tlxnmo todop r i o s trxrirpiodale mnvils a2ta(r nu4opt  ictlslm2umuvo t4alxnxoctodlp r n olt trxoim3oydole mictat  2um(roou0opeoifeilsfs2rauvo;u) lxrmf to1fmD aues s0texoim nudomenmieslt aDtr(roou1tpxoio3iltlaDuauvs u0 rxnmrctatom  aiesl(0 eum(o iy1op n fcias aDtmu onu4tltnmfciltfs rmn on(0tltomf3iotlpDean i;t)trtoxopoudop nmivia( s2trur nt0tpt ioeils sDrmump t0tlxrxo todoatr i o;s) exrim oo1lm nlfvtls aDrruro;o4altoiictysfa2el( o;u4texnxr3oytlpteanvi;s t2xrxr iy1lmtnlfcsat) 2tau pot4tpt  ocilt m uluvo;t)trxrxfciotlmDelneols seurxopno1op elfet t) Dur(r nt4oee moetyd aDrmnmp u)tlxoiociotlptrauvi s) rumxr iodam elnctls)srrrxrpoo4texnmi3ilslm2uluvs t)aetrio ia1fp eln s;s0s2tmxo iy4apt mnci sfsDurx p;u0aleo octlslaDua(vp;u4texnmoctodlmtrli olt)texrimpnu4al   nes s  rtm(mpot1aet iiciysfs2ea(vsnt4 lxnircoytlp eai s;s)s2tmio iu1optemnesl(fs2rrxmo;o0apt  oetatfsDrluvs t)altnxo3oa1omDranvs;t seuoim nu4am emfctas  2rruronu1tpx iicias sDumuvp t0 rtnif tadoptranvi;t) rumim io4lpee nvs (fs2rau p;t0aee iieiasls rmu on(4 renxr oydoat an i;s s2umxr3oydamenmici tfaDrr( oot4tetoiietlslaDumnmpnt0alxoxfcta1lm rauvolt s2tm(m oodalenmfvta(  Drmx  no1oet moctat sDuluvont) rtoxo3oadfaD lu o;( t2urio3ny1lm e fvsl( sDrrx  ou1tpeomf3iltfs2emu s (0 rtnxo3io1om  li o s0s2toxmpny4ale mnetat)s2trxrpot1altomieiat m ean p t0aleoxo3todlm rlnvs;(0truo(opoo4ameelfvs tfsrrmxm nt0ape  ociyt m2ua(mp;t)alenxfctotfm   ies;t0trumxm nu4lpt  icslsf 2rrumpoo0aexomictasfmDeluvpn()teerif3totlmte iei;( truoir no1omtnmictl(fsDrrxr ot1tetniocilt sDeluvp;() ltnmfcoa1fatrluvs s0srtmxrpno1lltelnctl(f rrauront4tptomoctld sDranms;t0teeomf oytop   nes t  exoimpnudolen iciat srrmum nu0alt iociydfm elnms;t4 eerxf ta1lmteanvo;(  rxr(m nu4ol   ncs s arta(moot0aleoifetlslm2uauvp;u0teermo3ty1laDe i sls)setr(mpoydll   icsls arrru  ;t4apx iieiat a2ra(ms (0aetnir oatlmtrlu i;( texmxo nu1omte netltfsrrrxmpou4apeo oeias m2ul(mo;(4trtoir oatop e u i;s)teur(m3io4llt mnvtls) Dta( pnt0olenmietltfaDrln sn()tltrmf oa1lmt lu sl( texrxopou1ape mfes s sDurumo;u1texomf3iydfa rl(mp;t4trermf oadlatrlnvo ( teum(m io4lm nlfct t aDtru  nu0teeniictls m2ua( p u0aeenxf3ootlpt ai ilt setmimpnudamtn nci tfsDuau p;t1aetnifctlt m emums t0alxrifcta1lmt lueil()tetrxr io4lmenmivtatfa2rmxront1olenifcilsfaDrau p t0tetrmfcoa1omDr n i t srxoim ny4ope  fesl(fs2raxrpnu4tlx mfeiysfa2ua(vsnt)alerio todla elu s s  exoxrpiu4aptnlieiltf rrmxrpnt0ape mi3tltlm2ra( o;u)aetrmfcty1lat  n o;(0s2xrxr no1lleelictl(fsDrmxmo;u0alxn ictld a2ulu p t4tltomf iydfmtelu s;t) 2tmxr3nu4apte fcsl()srrm( ont4ole moeiltfm2ran on(0artrxfctadlmteluei;s0truoxm oy1lltnlfes ()sDrmx o;o0olxo ocilsla2rlumsn(4 rxoir3ootfat aivo;s)s2xo(o no4omenmfei s  2umurono0tlxoifetadlm elnvp t) eenio todopteauvo t0t2toxo ou1olenlnesa(f rtrxm ou4oeenmoctysfs2uau o (0 eeoir3tydfaD lu ols trxoio iodap elfct t  Draum nt4oeen octltls umu pnu)trenxfcoodfmDeaueo t  ruo(r oudapt lfes tfsDtrur ;t0tetnifciydla2ua( onu0tlxoxo3ta1lmDe i o;s)sexm(r3no1opeelivs t)a2uaurpnu0tpenmieiyt m2ea(ms;(0alermfcoadoaDr nvilt)teto(r oy4amtnlfvt ( a2umu  ;t0aee  f3iys mDeaumo;(0treniociatopDraieolt) 2xm(opiodop nlnvt ()arra(r ou4tpeoiictydla2umuvs u4arxnxo iydla  aiesls0setrxm3oodom   fvilsf rurur ;o0ape ii3iytls2eln o;t)trxrmf3to1opDrlu i s)t2um(mpnu4olte fctat sDta( oot1opeo fciyslsDulnvpnu)arerifcoatlm  luesls)seumim3ou1lmenlieiltf ruaxr ou1aleomoeiltla2rmu sn(0artrmrcty1la r n i;( setm(r io1llt  fvi s) 2tmu onu1tptnio3tasls ranvs (4trtnxr ty1lmtrli s () eum(m3oydalt mfvilsfsDum(m ot0apeomictytla uan snu0tetrxf ta1fptelies t)srtmir iodaltnlfcsas  2trurpoo1opt mo3ilsls rmn p t4altnmo3oo1omtranvi (0tetmimpny4ape lieilsfs2rrxmooo0oeeoifcils mDeluvonu4 reomf tadfp raivo (  exoio ou4ome  ies s  2raurooo0olen i3ildlm2rmums t4trxoxf3tydfmDr n ilt)s2umxm ny4ll  lfcs s s2rmx  no4tlx  fctad s rmump;t4aexrmr ootlp e nvo;t0 2toiopny1al n fvsatfsrurx  ;t1apt mieiys mDrm( p (4trtomo3tydlaDrlneo;s texm(r nu4llt  nes tfarrau  no0tle mociltfsDrl(vo (4arerifcoadlm  ai sl( tetmxmpno4lp  liesl(f Dtmxrpnt1ole  f3tadfa2uaump ()aetriocoodlm  li s;t0 2xr(rpoo1alen nes (fa2ur(  no1apxnmf3iadls ua(mpnt)aeerxo iodlm  livol(0s2urxr nu1opte fvs ( sDuru  ot4aptoiictld a2ua( pnu4 ltoxr oytfpteluvs;t  exoxr iy1omtnlfcil()a2rmxr oo1aetniociaslmDemnmo t)alerxociodfa rlnvo t sexo(m3nydllt  ies sf 2rrx o;t0ape  o3tltlaDra(mp u4 lxrxr iy1fmDraneo s) euoio3iudomtelivi s s2rmxr ot0tetomfciltla2eau s t)aexnxr3iytfmDr nvol( s2xmxrpnudll elivt t)s2rmu poo0tpxoii3iltfs2elumpnu0aexrxrcio1fptrliesls) rtmxopiodll  lnet sfsrta( oou4tlt mo3iadlm2rauvs ()trtrxrctytomDe iesls) 2xoxm iodape livsat arua( onu0tltoiiciyd sDeanvp ()trtrif3tatfm raueo;t0 ruoxr3oo4lpenlfetl()aDurx onu1aexn ictyd m ranvp t4trxrmrctadla   u ilt srtmxopno1alt mfesa()srra(rpot0aptnifctysfmDrmums u4 etnmo oy1op   nvo t) etrir3oo1llt  ncs () Dtax ono1opxn icildfsDelu p t4aetoxr3tadfp eluvs;t0srxrirpiydop nmivils)s2rrx poo4oleomfetlsfsDrlnmp;t4treoif iodfmt aieo (0tetr(mpiodamee fviat sDtr(ro;t1tlx  i3iytla2ua(msn(4aexnmf3oodoaDeliei;t) 2urxm ny4ome lfct s)arua( ooo4opx moeils a ul(ms (4 eeoio tadlpDean ol() 2toxopnu1ale  fvtl(fa2tru  oo0tltnioeiad s2ea( onu4trxnmf3oy1lateauvo;(0texoir iudolee ici s)srrmxmp;t4oet  iciyslm2ul(vs;()altnmf3iatfa r uei;t trxoimpnydlltnlfvtlt sDra(  no1teenioctlsfaDumnmp;(4arenmociatfaD  ivo;( tetriopou1optelicsas srrrx oou1alxn fetldfaDra(mo t0 etrmr tatoa eln s t teumir3nu1amte ictasf rrrx pnt4aeeo ictaslm2ul(ms t4tlermr oadlmD anvslt0s2trim nu1omt  nesls  2ra(m ;u0tetoii3iydlm umu on(0teeoxrciy1lpD li s ()texoir oydlmt mfcsas) 2taxm no0olto fcilsfa2ulumo;(4tetrir3oadfa  livol( trtr(r3iodomee nctl( sDtaum ot1tptnmieilt m2emnmonu)aleomo3oatlaDeluesls) 2tm(m nu4op  lncslsf 2ta(mont4olt  f3iasla2ranms;t)aexnmf3tadfpteln i s srtrxopoydap elictltf Dtr(ro;u1aex mi3ild m2um( p t0alerxfcio1fpDelnvi (0 2toxopnodapenlfei t)s2ua( p;u1teto f3ilsfs2rlnvsn(4aexrmo oa1fpDr u o s0 rum(o oydap  mivil(fa2raumpot0texn f3ilslaDuln o u4aetnmrcoa1oa ean o t)s2to(rpno1al n ics t aDuax  ot0apt mociytls2uluvpn(0 leoir ty1lm r nes;t  exmxo ny1ol emnct s)artm(m ot0tpe  f3iyd mDrmnmp;(4aexrmf iatfmD  i slt0 exrimpnu4lp  lfvtl(fsrrmurp;u4opxo o3ils s rluvon(0 exoxfcoytoaDe ieil()trxr(r iydom nlnctl()aDua( onu1opxomi3tatfaDrl(vo t4 exnifcoydlat lueolt)teumir3iodalenmfvi ()a2rmxm oo1oet ioctydfs2ua( o u4aexoif iy1faDe uvo s  etoxrpno1amenmnvta()a2urx pnu1tleomietas m rau p;(0trxoxf3ty1fpDelu o;s t2trxm iy4omt  fesltfsrrr(rpot4oet mf3iltfs uaump t4tltnif3tytlatelies t0 exo(o3nydal nmfct ( a2ta(rpnt1apxn fctlt mDranmo;(0 etnir oodlatr uvi;t) 2toxo ny1omt mivtas a2rr(rp;u4oleoif3ildfa uln o t) lenmocoydfmDrai slt)s2uriopio4amtemnctat srrau o;o4tltomoetydfsDulu s;t0tleoxfcoa1omtr ivi s0t2xrim io4lmenmnesasfs2rrxr nt1alto feilsfa ulnms u)aetoxr3oadlm ranvsls0srtoxo oydlm   nct s) Drrx  ;t1alto octat m ulums (0aleoxo oydlmtrliei;t setrxm3nudopenlivils)sDtrur nu1opxo f3iyd s rmu p;u0trerxf iatom  anvo t setm(r oydol  lfes tfaDuaur nu0texnifeiasls2elums t)trtrmo3io1la  anvilt0teuo(o3oo4ape  nvt s) Duaxroou0ope moeiyd sDran p;t0alxoif3oy1fm  an il(0t2toxm3iu1ll n nvtasfaDumx pno4ape mi3iasfa rmn p;u4aeeomfctodfmDrlnes s)t2uoxrpnydlp e nesas)s2raxro;u1aexomfctydfa2umu s t0 renxr3oa1fmte uei;s0 rurxopnu1op elivtatfa2umx onu1aexnioetadfaDrauvsnu4tlxomr iytlatr neo;t trtmxr3oy4aptelfcs tf Dtmuronu4tlt  o3iydlm rm( p;(4artrmfcty1fmt lu s;()tetoio3ny4lleemictl()s2tm(mpnu1olxomfctat a ul(mpnt0teenio3tadopD auvi t0seurxo3no1om  liesl(  rtru pot0aleoioeias mDelumo u) rtoir todlmDelu o;t tetrirpou1al nlfcsl( a2tau  nt0apxniieiasls eanmo t0trerxr totoaD lnvi;s0t2xr(mpno4ome mnvs sfsrtm( ooo4opxn feild s2rm(ms;u0 rxrxo3oatopDrauvs s0teuo(m iudalt licslt) ruru oot4optn f3iasfa2rluvs u0 rtrxfciy1lm eauvi ( t2toxm ou1oleelivsasfsrrmu onu0aleo ietydlm2em(vpn()alxoio3iatomtr ivo;s) rtmio nu1altnlnvils)srum( o;u4opxnmieild aDrlumpnt) ltrxfcoo1fm  luvs s)srxm(r iodapenlivsl( arrax p;o4tex  feiatfs2ranmo;u0trxoxf3oa1lmDr ieol( srxoxo no1lpenmnct (faDurxmonu4optnmfcias s2ul( snu0 exrio iytlmDeaneils0trtoio nu1lme  fci sfsrta(rpnt4oee mf3tas a2eanvo;()tetriociadfm e i i;s t2urxm3iudope  ieslsfsruax  ou4opx if3tatfs rmn ont)teenmf3io1lpDraies;( seuo(m3ny4open ncia(  rrruroou4oltomiciydfm rmumo;t0tlxnmr oy1fptrlivs t t2toxrpiy1ale lici s aDrm(ront1ole ii3iasfmDem(msnu4texnxocoadlmteaneols)srxrxm3iy4lptemfvslt)arrr(ro;t4aeenioctydlaDel(mont)texoxf ia1fmt an o;() 2urxm3nu4lpeelnetl( sDtmumpnu1apt  i3iadlm2ul(vo t4alxrir3ty1fmDe i o;( srxo(m3nodamee fci tfaDra(  ot0ape  ieildlm2eln o (4alenmfcio1lpDeauvi (0t2xmim3io4lme  nesa()sDumu  ;t0olxnmfctyt aDean pnu)trxoxr ty1laD lnei t trtm(o iu4lleelfeiat aruauronu0tltnmfeiad mDem(mo ()treoio3oa1fptraneo s s2xmxm iudlpteliei s aDtax  ;o1oee ii3tas sDua( p;u4texrxf3ty1lp rau i () 2trxopiodol   ict ( a2ra(m ;u0oetoiicildfs2rlnvont)arenifcto1oatrlivo (0s2umxmpnudlptn nct ()sruaurp;t4texo feiysfa2el( o;u4aexrmr3oadfa e ieolt0tetm(r3oo1ll nmnvtlt) rtmur nu1aeeniieiydls uaums;(4teeomf ootoa  aivi t srtr(mpnydoleemiesat)arrm( ono1aexo feiat m2elums;(4alxomf oatoaD anes () etoim ou4omt  nes ( aDraurp;o1aeeoiociys aDra(vsn(0tltoxo3tadlmt ai i;(0srtoim3no1aleelfvtas  Duax  nt4aptniieiyd sDra( o;()alxrircootomtrln s;s)trtmio3iy1ol e fcil( srurum ot1apxn fciyslsDemu o u4teerxr3iodopDranvilt) etmio iodlle mictltfs2um(mo;o0tpeniocild a rlnvs () ltoif oodoa r neo;()srxr(opnu1al  mneslsfsDumx o;t1tltoioeiltlsDrm(vs;(0aeenif3oo1lp rlu sls srxoxopoo1omt mncias  Dua(mp;o0tet ii3iltla emn sn(4 lxrmrctytlp r ieo t)texo(m3iydoptnmneslsfa2urx  oo1teeomf3ildls emu on() lxrio iotfp eluvi;()seumxm oydlpt  nctls aDtrxrpno0aeenmo3iadls2uaumo u)tlxnmrciotfp rln s;s t2xmirpou1lmt lnesas  ruaurpou1opxoii3tasfa ra( onu4trtrmf iydfm elnes t0t2tmir ny4lp elncs () rua(r nu1oet  i3iysfa2ulnms (0 rxoxrctadomt lieslt0trxrxmpiy4op nlics t aDtrumo;t0ole ifctlsfa2rmumont)altnmfcootomD  i s (  etoim3iodal e ieilsf Dta(mpot4ole  icias s ra(vont0tetoif3oy1laDraueslt  rtr(r3oo4ol emiviat  Dtr(r ;u0aexomieiasfm2ranvont)alerif io1optr ues;t)tetrxm3oodaptnlnciasfsruaumoot0oetomf3tysls um( o;u0 eenxr3ootfptr uvo;s0setoxm3nodlm nlnesl(  Drmxront1aleoifeiadlmDeln snt0texomr3tytoa e ivi (0tetoxr3oo4ame  nvi t) rtau  ot4tex mf3ias s ra(mp;u)alxrio oatfatrluei t)t2xr(o ny4alt livtlsfaruaxm no4tlxo oeilsfaDrlnms;() ltrir oa1lmDr u o;s)s2toir oo1lptnmfci tfsDur(m ou1tlt  ictydlm rl(vs;u4 lxnmf oatlpDeaivslt)tetmir3oy1openlfcslt)srraxroou4alxn o3iysfm2eln snt)texomo oa1la e i i t teurxmpny4opt  ncs t a2trxrono1olenmf3iltla eluvp t) lenmocio1laDelieo;( s2uo(r no4lm elneil( s2tmx o;u1olt mfcias s2uln p;t0aetrmr io1laDeln i ( s2xm(m nodapt lfciltfarra(mo;o4teenif3iydlm ul(msnu)tlxnxo3iatfp r ivols s2xoirpio1ol nmnvilsfsrtmu p;o4aptnifetat sDranmsnu4treomf3oydlpteaues s0 2urxm oydlltnlieia() rrauront4apt  o3ildls ea( ont4arenif oadoptr ivo t0 rtrim ny4ap nmfvsls)sDtmurp;o1opxo ictldlmDra( pnu0trtrxf3tytfatrau s;s  2tmim3oydal elnvtatf 2ra(mp;o0texomocild sDuln on(4aetnmo iotla elieslt0tetoim ny1omte nvsa( aDurxr oo1apxn ietad m2ranmo u0arxoiocoodlaDraieo;s0srto(r3iodlme mivia(  Dtaxro;u0oet mociyt a2uanvpnt) eermo3totfm   ueo;t0srur(r nodlptelfetas sDua(mp;o0tptoii3tldfa ul( p;()aexrif3ty1fa   u o ( s2xmxr no4lltnlnvi t aruaum nu1aptnmfctatfsDelnms;u4tltnir3ootlmD luvs s) rtmxopiy1lpenlfes (faDtmur ;u0apxnmfeilsla2ua(vp u0 rermfcto1latrai i (0srtoio3iudlmt mivs ( aDrrxro;o0tpenmfeiys sDem(vpn()trtrxocto1fa   i i (0s2tm(opoo4ole  ivtls sDrr( onu4altoio3iyt s2rlnms t)aeerxo3iotfm   u ol(  2uoiopno4lmtnlictas)artm(m ou1aexn oetlsls ulums t)tetnxf oodlptrlueo;s0srxr(o3ny1omtn ivslsfaDtr(m ;o1opxnioctat m emumo u) etnxo ootop eauvi ( seumir ny1lpte netat)s2umum oo1opeomfciltfs eau p;t0 exoio3oydlaD aiei t  2xo(m3oydllt  nciat) rtaxrpoo0tpeomocilsfaDea( pnt) eeoxfciatlat auei ( tetr(opny4amtnlnvia() Drr(  nt1opxnif3tasfm rmu p u0trxrxo iytopte nvo t)setoxo nudlmtn fvias) rum( ono4opxo iciltfsDea( p;(4 reomo3oy1opteluvo t seuo(m3iudllenmnei ()aruaum nt0ale  ictatlm2ulnmp u0tetrmf iy1lateau o;t sexmim3nodomenlfcsl(f 2umurp;t4teeoio3iad s2uaumo;(4tlxoiociydfaDeluei () exrxm oy4optnlneil(  Draumont1texomoctys a2rmu o (0aetnmf tadfpt  ueslt  eum(o ou4om nlivsls aruaumooo1aexoif3iytls2eanvs u4trxnif oodfa  luvi (0 eur(rpny1omte fvtl()s2ua(  ;u4oetnmieiytfaDrln o t0alenxr3ta1lp e uvo;(  exmxm3oydop n nctat aDrax p;u1alxn i3tytfm2rm(vs u4 ltrxr oodlm e uvo;t) 2toxo3iodamt micsa()s2tr(rpot0alx  f3ildfa uauvsnu0artoirciy1fpDe ivs ( texoiopoo4lm nmfvsat  Dtmxmp;o0apeo icils s uluvp;t0 ltrxo3totfa r ivi;t0 rtrxo3oy4apt mfvsltfsrtrurpnu0tetnmi3tas sDum(msn(0 rerifctotfaDeln i;s  etoxopoo4lmeemiesls) Dta(monu4tpen i3iytla ran on() eerio ia1oat  neols) rxoim oudaleemnvi t artrurpno4apenmi3iysfa2rmuvsnu) rtrio3ootopteaiesl()teuo(opoy1alenlnvsasfs2rmx pou1aleomf3tlt a2ranms t4 eeomf oodomt  uvi;( trtrxmpoy1ape mfviltfartm(mp;t4opeomfciadlmDean o;u) exomo3iotoa eaues;() eur(m io1amtn nvil(fs2rr( oou0tlxomocild s uluvs;u0artnirctydlptr ivi;s0 2xm(o nudal  livslt) 2tmur no4aleomfetadfs rau s t4altrxr3todoate nesls0sexmim nodamt livi ()srua(r ;u0tltnmoeiyt s em(ms (4texomf ootfm ean o;( s2tr(r3iudlpeelncta()aDum( pnu1opx miciydfsDua( ont)altnxr iy1fa  anes;s0 eurimpiudamtelfeias s2urxr ;o0aexoiicild s2rm(mo t)areoxr iadfmDranei;t0trtm(o oy4lm nmieiatfarumu pnt0ale mi3iasfm2em(mon(4aleoir3tadoatr i olt)trxrxr3iu1amt mnci ()aDumxmp;t4teen fciad m2ra(vpn()tlerxocootfmteaneolt teuoio3nydol  lnvsl(fsrtaxr nu1tpx  feildfa ulnvo;()tltnir iodop   u sl(  exoxrpiy4lmte nciat) Drax ooo1ape io3iadlm uln snt0 rxoxr3ia1oaD lu i t t2trirpoo4alte nvs ( sruaurp;o1optomfeiysfm ranvo;()aetrio todlmt aieo t) rtoio3oy4al  mfct tf Dum(mpnt0aet  o3iaslaDrau s t0 lxomocoydfp  lu i;s0 eto(m ou1lmeelfei s)a2ra(moot0alto f3iatla2ean p;(0 rtrxr3iytlpDr nvo;(0tetmimpnu1llenmnei s srrax ont0tlxoiiciatlsDeluvp u4altoif3tydoa  lnvol()t2toio3no1ll nlnvtat)a2tmur nu1tlxomietytfm rauvo;t0 rermr tatfpDraneils)s2trxr3oodlpeemics () 2rrxmoot4oexniicildls emnvsnu)tlenmr ta1fat lieils)teumio3oo4omtelivi tfs2rr(  ;o0aptnmietytfa em(mp;u4 etrmr3oatopDrlivo ()s2xr(m oodapenlfeias  rta(r no4opt moeiaslm rlnvs;(0areoxr3to1opteauvo;(0s2umxmpoo1omt livtlt)a2rrxro;t1ole mi3iysfmDuln pnu)arxomo tytoatr nvi;s0 2xr(r3ou1ale  fcias)a2umx poo4tex  o3iatls2um(ms u0teenir3oatlpDeanvolt t2tr(r iy4lmtnmfvtlt)aDrax  ot0tlenmi3ildfa2ul(vo u0 exomf3iydoaD an o t teum(o3iy1ll nmivtat  rrr(m no4oex  octyd s rmump (4alerxo3ta1lmDrli ils) rtoir nu1ll e iesa(fartaumpoo0oexnioetydlm2um( pnu0alxomf ia1lmD aueo;( trumxr3nydlpt mici tfsDtr( p;u0teto iciatfm2rl(mo () eeoio iy1lmDrlies;s)setmxrpiy4lme mictat a2tmu  nt4aptoifeildla2rlnms;u4tetrxrctodlpD lnvo;t) 2xmim oo1ale mivsltfaDta(rono0apt  feiltfa emu pnt4trtnxf oa1oaD lues;t0sexrio nydol   ict s) rtmumo;u1open fetytlm uluvo u0tlerircoo1la r uei () 2to(r iu1lltemiei t arrrxmonu0ope moetatfmDelnvs;u0trxnxrciy1oa ran s;t0 rxmim3iydlp elfeta(f 2uauro;o4aetniieiatfs em( p () eenmf oodlmDelivils0t2uo(o3nu1ale lnet t  rtau pno4apx  ietydlaDulnms (4tlxoxr3to1optean i;s0texmim io4lptnmfvta(f Dumx o;o1oleniiciasfaDea(mo t4 ltoirciadopteai i;( texmirpnu1openmfesa(f ruaurpno1apx mfeiysfaDrm(vp;u0arenio3oydfmDelies;() rtrxmpnu1lmee fcta( srua(m no0ope  i3tytla2uan p (0alermfcio1la e ivo;( trxoxr iu1ame  fvs s) Drrum ;t4alen fciydlm rlumo;t)trxnmo3iotfm rlues t0truoimpou4ap n ies sf Drmumooo1oexnifciydls em( snt0 etoxf to1fmteluei s) rxoxopoo1apeelnei (fsrrrxr nu1apxn fctyd mDrl(mo;()trxoio3oa1oatranvs;s)tetrirpnodlltemnet s srrr( p;t0ape iiciyd aDrau o;(4arerir3oadlp  au o;( srumir3oy1ape lnci (fa2um( pot1opx  ictydfs rmu p;(0alxrio iodfpDr uvolt s2xmxr3ny1apenlieils srua(mooo1aexnmoetls a2rmn snt)trxrxf iydfp e nvs;t0srxrio nu4lp eliei s s2rmu pno1aptoiieilsfm2el(vsn() ltoxr3oo1oat lnei s  exr(o3ny1aleemivt tfaDta( p;u0oleomi3ildlm2ean o;u)aetomrciy1la ranvsls tetmxmpiu4om emietlt) Durx o;t0tpeo i3iatlmDua(vpn(4teermf3iy1lm ran i t0s2xrio3oo4al n ncsa()a2ra(  oo1tle iictys aDul( o t)alxoir iytfa e nvslt)s2umim iy1ll n icsas) ruaxrp;o4aetnif3tasfa2ranmpnu0texnmf3iydla  lnvsls t2xo(opiydopenlnct sfsrum( oot0opx mfetltfm2um(vpn(4trxnifctotom  aueslt)sruoim no1opee fcs ()srumurooo0apt  f3iatfa2um(vs (0aeerxf tytlpD  ues ()srurxr3nudoptnmncsa(  Draurono4tptoifeiys mDeaums (4texnir3todfmtraivs;()tetrir iy4ap n nvi tfaDtmuronu0aexo oetyslm em( p;t0 rxrmf oo1oa elivs s)teum(o3nudamt lfetas)aDraumono1aptnmo3tadlm2rl(vp (0teenxf3oatomDrlnvsl( seumxm iudlptn fctas) 2tr(mo;t4tpxn icildls em( p;()tlxrmr3ootlpte ivi;t0t2xm(mpio1aptn ivs t  Durxmoou1oexnmoeilsfmDrl( p;t4artnxf tytlptr ieol() rxr(m3oodol elicsa()aDtmu onu1ape if3iydlm2rm(ms (4 etoxf3ootlat lies;t)srtrxr3oydlptemiciasfsrurx pou4ole mf3iysfaDrmu onu0 rtrmr oy1fmDranvi t0trxmxo nudal nlictls artmum nu1opxn o3tlsfs em(mo u)tltnmo3iydfmD anvs;t) rumxr3io1ope mnctas s2umu pnt0aeenmiciyt a2raums;u)arxoxrcoo1lm r u i;( tetr(r oydape lnvt s)arrruro;u1oetnmi3iad sDulump (4 leoxo todlmD  uvs s seumxopou4ol  lnci sf rrm(m ;t4oexnifeiysfsDea( p;(0texrxfciy1opt an o;t) rurxmpoo4opt lfvsa( aruax  ;u1oet mo3ilslm rmums;(4teeoio3ty1lmt  nesl()s2urxr oo1alt lfes s artau pnu4ope  fcilt mDemuvsnu4tetrmr ta1omtr nvols)trum(m nu4altelfcil(fs2urxro;o4alx  feiyt a emnvsnt0tleriocio1omD lnvilt0 rtrxr iudlp emfvslt)s2tmu pno1tlenmfeiyslmDelnmsnt0alermf tatfat li o;(0 2tm(o iydamtnmfcslsfsrrmxm oo4tetnmictytfm ea(vo;u)aeeoxrcootopDelu i ()t2trir3iodlpe  neta() rtaxm nu1alxo f3tys s2rmu pnt0alxnif3ta1lmte ivslt)s2tr(r3iudaptelfes t  Drax poo0alxnifcils a2ua( p;u4teeomf3tadlaDeliei s  ruoir3oo1ol n fet t  Duaxm ;o1alx mociysla2ua(vonu)trxrmr3ta1fm eluvs s  rumxrpno1amtnmnvt s srur(m ;o4opeomoeiasfs emuvp;t) lxrxf totoa rauvslt0sexo(rpnodamt mfvsltfsrua(r oo1texnmi3iadfs2ra( p (4alenio oa1fp elneol() 2xm(m3iu1lpee ies ( sDrmxmpou1aleoiocias mDuau pnt4teeoir oytlaDelivo ()t2xo(opiy1llt mivs sfa2ur(m nt0apeoiicilsla2rl(mp;u4aeenxo3oy1lmt  n sls)t2xo(mpiudamtnmnetl(  ruax  ;o1tptnif3tyslm ra(vs (4 exnxf tadlpteln s s) rtmxo iydop nmnciat) 2um( pnt1tlxn i3iydfa2rm( p t0alermr iy1omt  nvo t) ruriopoodamee nvsls) Dur(moou4olen ietasfsDrmnms t)alerifcoodoateluvsl()tetrxr no4lm elncilt  Drru p;t4openiieias m2uaumo;(4aeerxr tydoatelnvo ( t2xmxm3nu1openmncsat)aDrm(m ot4opeoio3iad sDrl(vs u)artnif3oytlp eaieol()texrio iydlpe  icsat)srrauro;t1tlxnmiciaslm2em(vpnt4aleoifcta1fa rlu s;s)trtrxr3nu4apenmneia(f Dta(mo;u1tpeoii3tys aDuluvo;u4tltrifctydfatelnvo s) rxr(o3oodll  lici t artm(moot1ole iictat mDelnms;u0 exnxf oadfm e n o t0 etoio3iy1ap  lietlt a2uaxr ;t0oet mi3iat mDraumsnt0 lxnmo tytfa rau slt0srxmxo iu1lp elicias)s2ur(monu4aleoio3ildls uan onu0 etnio ia1lptranei t0s2toxo3iy4lmte fetl(fa2tmxmp;u1alx ioctytfaDumumsnu)alxoxr3to1oa e ivolt  rum(r3io1amt liet t  Drmx onu0aeenioetysfa rln o;t) exomr3oy1op ranvi;t srtrir3oydal n nesasf rrmx ooo0tleomiciytfaDel(mp;(4tltnifciadlpt  n i;t) 2tr(opiu1apen iciasf Dua(m nu4olxoio3iadfs2emnvon() ltrmf oatfateaivs s0setm(m3iy1olee fvsa()aDtm(r no0tpxoiietydlm2rl( snu4aleoxo iy1lat  i i;(0 exoiopoo4llte fei s arua( p;o0tpxoiietlsfa2rmnvo;t0 reomf3tadlateanvslt texrio iydole mnvtl( s2umxronu4oexoifcias a ul(von()altoxo3tydlp eaiesl()texmxo3iu4lpeelicil( sDumxrp;o4tltniicilt m2el(ms u0aeermr3oadomtranvo;t)t2xoio3oudlptn ictas)a2umxmpno0oetomiciltls ran pnt4 rxrmf3ootlmDr ivs t srurim iydlm e iciltfsrraxmpoo4tex  fetyt m2elumon(0tltoxfcoatla  aivs;s0 eurxo iudlp nmnviat srtmu  ;t4aetnio3tldfm2em(ms;t) etrirctydfpt au sls)t2urir ou1ap   nctlsfs2umxrono0alx if3tadfm el(mp;u) lxrircia1fmt  ivs (  rtr(m3ny4oltelfvs tf Drmuroot0alenif3iatls emn p t0 lxoifcio1optrlnesls0sexm(mpoydlp e ivias)a2rm(m oo4oexnmi3iatls2uluvp u0trtrmr ia1optrlneols)s2urirpiudap  lneiasf 2rr( oou0ale moctlsfa2umu pnu4aleoxfcio1oa r iei t0s2xo(opoodaptn nct (fa2rmxrpot4aeto oeild sDrm( o;(4aeenxfcoodfp ean i;(  etoxr nodlpeemfctas a2taum ;u0tlxn ieiaslaDrlu s u0trermr3iotoaD  nei;t0tetrxm3io1ol emnvsatf 2ur(monu1tpeoiiciat aDrm( onu)tetnir3oadfatr u o;t)srxmim3nudlp   ivi s) 2ra( poo4apxn octld m2elnmp;(4 rxomfcto1opDr ieslt) 2urir3oudomtelfctat  ruaxro;t0tlx  f3iys s2rl( p u)altnxr ootfp r neils srxoxo3oo1op e fcilt srumum oo4tex mfeiys m2rm( o;t) reoxo oy1om eaueo;t  exm(o3oudll  mfct (farumxronu4ole iiciyd m2rmnvs;()tltrxfcoa1lm eaiei t0 rxo(o no4lme  nvtl( s2umum nu0o
\ No newline at end of file
@@ -0,0 +1 @@
+iei;t0 eurxopio4lptemfvtls)s2uaum ot0apenif3iltlm uan s;t0artniocty1fpteau ols  etriopiodomt lfesat)aruau  ;o1ope  i3iyt s2umnvsnt0areoif iotlm eaivolt  exmio3oydomtnmfvt (  rtmu  nu0teen oeiatfa elnms;t) etnioctodlpDeaivi;(0 2xrim iy4open ics s)s2rmxm no1alxo fciys m eluvp u4 reoio3iotfpDeaneo;s0 ruo(o io4alen fvsas aDumxmpoo1tpen ieiyt m ul(ms;(4artrif oadfat  nei s srxoimpnudap nlnvt sf 2rmumooo0opxnmictadfa2rmn pnu0 eenmrciatfmD  n i s truo(m iudlptelfeil(  2um(ront0aee ifeildfsDrmuvs u0 eenmr oatlateli sl(0teuo(mpoy4lm n fcs t) Drmu pnt4aeenmfciys a ul(mo u)teeoxocta1fptean i;s  2ur(opnodoptnmfctl(  2rrur nt1tet iictldfsDrm(vont)texrif oodfm e ues ()seum(opou4altnlivi t)srumu pnt0ope micilsfm ulumpnt4tlxrxr3ia1omD livsl( s2xrim nu1lleelfcsa(  2rax o;u4aetnmo3iadls2ea( p u)trenmo3io1oat an sls0 rumxm iy1llte feilsf Dtmxmp;t4tex ioeiys m2um(ms;u0arerxo3oo1oa e neil()trxmxo3oy4lmtn nvsa()srtaxrpot4apx  oeils m2rln on(4alxoxf3oa1om r uei s t2to(r3oo4al n ivta(f Dua( pno0alxn f3ildla2rln p u0trermr oytfpt aivi;s)s2xrirpnu4ame  feslsfs2ua(m nu1ape io3iydfaDumnmsnt)aetnmf oy1lp e ueols0 2tmxm3ny1ap nlfci s aruaxrpnt4alt iiciys mDelu sn() leoxo3tydfa e nvi () eum(m no1ol elfcsls)arrm(m ;t1tlx ioctysfaDran p;u0 ltrmf3oytlpD anvi;s)srxmim io4ap  mnvsa(fa2ur(mp;u1oeeo fciasfsDulumpnu4tlxoxr tatoat luvs;(0sexrio3iodap n ivs t srua(mo;o0tlxnmi3ilsla emn snt4tlxnircoadlaD  n ils0s2xoxmpny1olt liei s)arua(  ot0tex  o3iydfs2eau p;t4teenxf3tadlat auvo;()srumiopiodapen nvils) rraxrpnt4openmfetatfmDrmuvs ()aleomfctotfmDeanvs;() exrimpiodap  mfet s  Dtm( o;o4oeto iciydfs emnmp (4tlenmrciotlaDr ueo s setoxo iu1alee fei () 2urxm ;o0olen ictasla ulnmo;t0alxrxo3todlm rai ol(0s2toxm3oy4oltelfet s) rumu  nt4tleoiocias mDrmn pn()trxnxr oydfp rau o;s0 exrio3ny4lpe mfesas  Dta(mono0apxomoeiyd a2ea(vp;u4trxnmrcio1laD  ieo;t0teumxm nu4ll emicsat a2urump;t0tlt ifetldfa rm(vo u0tlxoifciadfm rlivs;t0srxrxo3nodolt  fcta(faDta(ro;t0oetoioeilsfs uluvs;()trerif ia1oa   nvo;()trtrxo3iudom e iei tf rurx p;u0olt  ociasls2ranmp t) renif totfaDrlnvs s tetoxmpno1al elncsa(  ruax o;o0ope  feiyd aDra(mo;(4 lermf iadlmte i ol()t2ur(r iu4am elfctl(f Duru oou0tetnioeiad m ulnvs;(0texnxf oodlpD ln i;()trtr(m iu1apt mnctlt  rur(rp;o4olxoifctys sDea(mo u0 rerxocoa1fa e nvslt0texoxo io1lmtn nvsls) 2uau pnt0tpxnmf3tad s el(mp t)alenxocoydfmte i ils s2xoimpny4omtemieia(f 2tmxmpnt0oexoiocilt a2eanmo;u0 rtnir iydlm r u s;t)srumim3nydll  lnes sfa2tax oot1oexn ictysfm2rmu s;u4 ltnxr oytoat  i i () euoxo ou1ll e nvil(  Dtrx  ;t4opxniietat s2ul(vs u0arenmf iodlmD  ies;()seumxo3iy4lp e nvs tfsruaxm ;o0tltnmf3iasfm2umn p;t0 rxrmfcio1fateaivo;( srtoxm iy1ale mfcia() 2rr( onu0opt mfciysls2ul( s;t4tlxoxf3oy1fat  u slt) euriopiu1ll emnvtlsf ruaurpnu1openii3tyd mDrlnmont0 lenio to1oa r neo;t)s2xr(mpny1ap  lncil( srra(moou4teenmiciltls ra(mpn()trenxr3oo1omteaues;()tetrxm3oy4lmen fes s) rtmx p;u0openmf3ilt m ea(mo;u4altrmrctatopDelnvi (  rxr(m3ou4lp e nes (fs2tr(rooo0aptoii3tyd a um(mp (4teermf3iy1fp rluvsls srumim io1lpt  fci s  Dumum no4texomfctadfsDel( p;()arxrmf3totomDraneo (0trxoxm3iy1omtemnvs s) 2rmxmpnu4olt  feilslmDem( s;u4 rerxoctotomtr n i;t) rxrxrpoo1ll   nctl()a2ra(mooo0tetnioetldla em(vp;u0aetrxo3oadlaD  iei s srxmxr3oodllt mfci t  ruaxmoou1apeomfciys a2umnmsn()teeoxr oydlp rluvils teto(r nu4omt  nvtlt aDtmxmoot1apxnif3tytfa2eanmsnu0altomoctydoaD li ols0tetmim3iodlmen ics s) rrr( ono1tpe mfeiadla umuvont) rxrmf3oo1lpD lnvilt)setmxm ny1lmtnlnct s) ruaum ;o0olenioetytla2ua(mp u0 etrxo todfm r ueo () exoirpoy4om emfcta( artm(mp;u1texnmietatfaDulu s;t4alerif iadfat  n i s) 2xm(opio4lpenlfvi tfa2rrur ;t0tpx  ieiadls em(msnu)aeerir oytfmtr ieo;t0trum(m iodamt mnvtls)arrm( o;t0opxo o3ias s rlumpn()tltnxrcta1la elu sl( s2toxopnu4amen fcs t s2rrxmpnt1tex  i3tytfa2umu s;t) rtnmo3oatfmtrlnvs;( setoim3iu4ol   ietl() rrr( ono4opt mieiys s2uanmo;t0tlenif todlpt  uvols)teum(m3oydllt  fcs () rrrurp;o0oltnioetyd sDrl(mp u4arerxoctotfatr ies s0trumxm io1omtn fvtls) 2tau  ou4aptoio3ildls2rluvon() rxnxo oy1lp  lu il()setoxmpny4lpt  nctlt  rumuro;t0aptniieiltfa eau pnu0areoxf3oy1lmtrlieo;(0t2urio3iydlmtemfvt t srtaxro;u1oexomfeiatlm eaumpnt0trtrmr3ta1faDeaivolt) 2to(m3io1lmtemies s  2rrx  ;u1tpto iciltfsDrlu p;(4teenio3oo1lp ran o;(0t2uoir3iu1al   ivilt  rtrurp;o0altoiicilsla umnmpn(0trtrir ootlmte u i ()tetoimpiu1lmee nvilt  Dtmx  oo1tptnif3tytfmDumump;t4tetrmf ootfa raivs;(0 rur(o3no4al n ieilt a2uaur no0teeoiieildfs rmnmp t0tlxoxrcio1oate u o s)t2toxrpiudomtn fci s) rta(r ;o0teeoifeiasla el(ms (4tlerif3iydoaD  neo (0t2uoir3oo4opee icsl( sDur(  ;u1oeenio3tydfs rmuvs;u)trxomocoa1opDr ivi;(0t2xm(rpnydole lfeta() 2rau  no0tptoiiciydfaDul( p;t4tleoxfcty1fatr ivo ()t2trim3io4opeelfcs ()sDumxrp;o0aet  o3iat aDra(vs u0treoxf3totop eaivo s0srur(m iodol  liciat  2urur no4ope miciydla2rluvs;(4artrmfciotomt livo;()teto(r3nu4alte ncilt sDum(rpnu0aeen ociytfaDemu onu0tlxoxf3tytlmD aivi t0 rxo(m3nu4am elfct (  Dumumpnu4oetnioctlsfm2ran ont4 lxomocoo1oaDr i ils)srtoxopou1am e ivsltf Draumo;t1tptn oeilsla2ea(monu4texomfciotfp  lnei;(0s2xoxmpio1omtemiei tf Dum(mooo0oet mfctasfs2elumo t)trtnmf3oytlm   nesls0s2umxm iy4lleelieta()s2rr(  no4aeeo fetys s rl( o;(4aetrir oa1oatrlnes;s texoxopoydaltemfesat) rta(mpno4altnmocilt s uaumo t4teerio3totfatr ieil(  rtmim3no4op nlfetas)s2umx onu1altnii3iytfa2eln s;u0 rtnxr iydlmDraneo;s0trtmimpio4lle mnvil(  rum(monu1tlxo oeias a umn p u) lxrmfcoadfmte uvs (0teumxo oodlptn nci (  2trur ot0alxnifctysfm rmnvo t0alerxf3ta1lmtr ueils)t2to(rpiy1lpee icslt) Durxm nt4aptn fciytfa2eln s;()trtnmo3iytoptr uvs;s)srum(m nu4op e fviat) 2tax ont4tptnioctadls2emnmpn()tetnmf3totfat livi t0 rtrir iu1omt mics s aDrr( oot1tet io3tyd m rlu sn(0tlxoxr3ootom e nei;t s2uo(opoy1optnlfci sfsrua(  ;u0apt ioeilt mDea(mpnu0areoio tydlm  aivo;()t2xrirpno1amtn ivsa(  Dtrump;u1texnii3tyd m2rm(mp;(4teeomr ta1fptraneo t0seto(r nydlpe  icta() 2tm(  nu1tpeniocild sDeluvp;(4tltnmr iadfmteaieolt0s2urxmpou1lpeeliesas aDtmumpoo4tpt ifetadfs uau sn(4artoxf tytomt  ieo t)srumxo3io1olt livtls)aDra( o;u4tlt if3iad sDemuvp;t)tlenxr oatlptrlnvol( trtrxopiy4ole mnvs ( aDra(rpnt4tptnioctydfm2ranvp;t0tltnir iydomt  u o;t) eum(m3nudlltnmnei t  Dumumpou0oexniieiytfs2rmuvs ()arxoifcootlpD lnvslt truo(mpoydape  ictlt)aDumurpou0tpeomieild a uaumpnt)aleomfcoo1fptr u s;s)texo(m3ou1amtemfvtl(fartrxrp;u1optomociyd mDel(mo;(4 rtnmf3iodoaDe u o (0 2toxm3oodlltemfcsl( aruaumo;t1tlx mfetasls ulumont)aeermo oydfmtelnei;() 2umxopiy1amtn fvil(faDtru oot0oltomieils mDraumpnu4artrifcoydlaDr n s;t0trxoimpny1ol emivta() 2rmx p;u1aex  feiatls rm(mp;u4 lerxf ta1fmtran s;t)trtoxopnudlp  lfvs (fsDtaurono0tpto ieiysfm2eln pnt4trenxocoydfpteaieilt  exmxm3iudllt lieiasf 2ururp;u0olt iociyslaDeauvo;u4arxrxr3iotopt livo;s  etr(o3nu4olt mfcsas)sDumu o;o1apeo icilt a2rmnvo;t0aeenifcoydoa e neolt s2xo(o nu1optelicilt)sDtmx pot0aex mo3tyt a2umn s;() exnxrciotfp  luesl() etmxm3io1lmtelncil(farurxro;o1aleo o3iydfmDrlnvs t0teenxf tytop elues t0texmxr iodal nmfei ()srtr(mp;u4alx ii3ildlmDua(ms;t)arenio3iadfmD  nvsls)seurim oy4lm  livtat  2um(  ;u1openio3tydfm rlnms;t)tltnio oytomt  ivo;()sexmim io1llen ivsls aDrax  ;t4tetnmo3iltfs2ranmo u)aetnxo3iy1lp  livo;()tetmim3io4open fctas  Dta(mpot4ole ifeiys aDum(mp;u)alxoxrctydfpDelnei;() 2xrimpoo4lmtnmivs s a2rax ooo1ope iocias aDrau p u0altrxfciadopt ai olt0setmirpnu1llenmnvias  2tru o;o1tpenmfciyslmDelumo;()tlenmo3tatfp  aies s  etrim ny1lpt livt sfa2ra(mpno4tpe ii3iltfsDum( s t)aeerxf3tytlateaieil() 2tm(opoo4lm emics () rum(r ;o0tleomo3iysfsDrmn p t4tetnifcoadfm r u ilt s2tmio3iy4omt mfcta(fsrtmu oot0tpto f3iytla umnmo;u0alxnmocto1fmteluvs;s)srtm(r3iy4amtemnesl()a2rrxm oo4optomoeiaslmDelu p;t)arxrio3iytla r uvsls0sruoxo3ny1am elfctat  2urxrp;o4tle ii3iyslm2raums;t0aexoio oo1lpt auei s t2tr(rpio4olenlnes tfsrtr(rooo4tee  octatfa2ea( s;u0tlxrxf3iodfatr uei;t)setrxo3iudlptnmnetas)srta(  ;u4oetn i3iydlmDumu on(0 exoxo iatlaDrlneo;t)t2trir no1ll   nei tfsDrm(mont1altn icildfaDea( o u4aexnxo3oadfpDelnes;t) 2xo(r3nudopte ivs tfs2rruro;u1tetoifciatlaDuan o;t0artrxociydlp   ivs;t0t2xmiopny1lmtemfeilt)a2raurpnt0ope mf3ildls ean snt0 rtoir ia1oateli ilt t2uoirpoydam n nctl() Drmur ;t0olxomfciatfs el(vp;t0altrmociytlptrlnvo s) etmim iudlmeelncsa(f rtmu oou1apx  o3iytlmDrlu pnt4teenio iadlp r u s s  rto(m ou4amenmncsas) 2tax o;u0tleoioctls aDum( s t)areoir io1op rai o;s0s2uoxrpny4oltnmfes s  rra(r ;t0aptn icias aDuluvp;(0arxoxfctydoateaivs (0 etoxm iu4lp emfcs s) Dumxrpou0oex mf3iadla emnvs;()trtomr3iatfaDelnvo (0 eto(rpny1lmenmfcias) 2um(roou0aexn fciadfa2rluvonu0tleomo iytlptelu i;t0sexo(m oo4ol emfvtltfaDtaump;o0aexomfctydls elnvsn(4 rxnxr3tydlatrli i t0seuoiopny4om  mfctl()srtaumont4oexoioeiat sDrlu s;(4artrmr3tydlmtr nvi (0t2xoir3oo1al nmfcils)srurxr oo1teeomi3tydfa2ulums;() rerxoctadlpDelivsl(  rxmimpoodomt mnctasfa2um(r nu0alxo fctlslsDelnms u)tltnxo3to1lptraivi;t  2toirpno1amenmici sf Dtrx  ot0oeeo fetlt sDuanvsnt) leomocoydom ranesl( teuoxrpou4lmtelncias s2tr(mont0ape  i3tasls2rmuvon(4tlxrircootfpDe ieols) rxrio iu4optemivtlt  2rmu pnu4oleoif3tyt sDranmp;t4tlxomr3oodlateaieslt)t2trirpiodol elfct () rtmum ;t1tpx miciltfm2rmuvsn(4aexoircia1fmtr nvolt  rurir3oy4amtn iet s  rur( ooo1texomoeiasla2ulump;t0aexrmr3iydlaDrlnvslt)trur(r ou1lmen nesl()a2ur(mpot4olenmoeiydfaDumnmsnt)arerxociadom r nvs s trurxopou1olt mics ()srtax pou1aet iiciasfa ranvs;() exnir3oydopD lu il(0t2umxo3oydaptemieta()a2rmu  nu1tex ifeiydfmDrlu p;t4aexomfctotopt  i i;t t2umxrpoodape  iet s)aDrrx  nt0oltn f3tydfmDel(mo u4 rtnxo oy1oaDrlneil() rurxmpoy1am  lfvslt  Dta( pou0aptomfciydlmDeluvp u0arenir3ootomDe ueslt0 exr(opno1lpee ivtat)s2uaumo;u1alxn octatlm rmums;u4artnxo3iy1fp  livi;t)s2xoiopio1omenmnvs (f rur(mooo1tpeomociatfs rmumsnu4 renxr tytopDe ues t)srumxm3nu4ol elnct tf Drmuroot1olt ifcilsla2elumo u4aexrmf ia1la elneo;() etr(m oy1lltemiesa(fsrtmurpoo4apt  o3iad m umuvon() etnmf3iy1opD lues (  rxm(m iy1ape  feil(faDtm(r ;t4tpe mf3taslaDul(vsn()aeerio oydfmtean ilt)seurxrpnudolee iei tf Dtau oou1tex ioeiltls2uau o () etniociodfpt lieilt)trtoxm oodap elfvtls)s2uaurp;u1tlt mi3iyd a2um(vp;u4aetnmf3tydomDeluvs;s) 2tm(mpiu4ame  ivil(fa2tmx p;t1oex  ieiatla2ea( sn(0 eenxf ta1lmt aueo (0 2to(opnu1ap emnvsl( sDur(mpno1tleo iciydla2rl( pnu)texomociy1lmD  nvo t) eto(r ou4omtn fvtat  rrrxmo;u4oeto o3tys aDrlumo;t0 rtomo iotomt luei s)setrir3ny1lm  miciat srra(  ;o4tlen oetld m2ulnvo;u) eermo oodfmDraivi;(  eto(r3oodlpt  nctas) 2umxrp;u0teenif3tadfs2rlnmpnt0tltoxf oo1fmtrlivi ()s2xoxr iy1ope  fet s)srtm(mpnu0aeen ieiytfm2umu s;t4trermo oydfpteauvolt srum(r3no1am  mies tf 2tm(  oo4texomiciaslaDemums;t)arerircoa1lmD  nei;() 2xmir3no1lmt mivt s a2umxrono0aet moeiasls um(vo;t)artrio todlptrlneo s)setoio ou1lmtnlietls) rrmxmo;u0oetomictysls2rlnvo;t4aetnifcto1lp  au olt0 rtoxo3iodoleelfci s)a2umu pnt1oee if3tytfaDua(vp t0 reomocoydomtrai slt t2xrio oo1om  mnvi s)srtrxmpot1teto o3ilt a ea(von(0teermo3oydoa  ln i;s trxoio3iu1ol  lfei t artmx o;t1tee if3iadfm2emnmpn(0 lxnmo3iadlp  livs () 2uoxr oudame mivtat  Dumumpoo0opeo oeiydlmDrluvs (4altoxr oydfpt au s;(0 etm(o3ny1lptn fcs (f 2tmu poo4aee ifetytls2ulnms u4artoio ootlp r uvo s0 eto(o3iy4oltnmiciasfaDuax  ot4opt mf3tad mDra(mp u) exnxocoadlpD lueils  2tmim oo4lle livi (faDur(mont0alenmociadla ean s t0trxrif3iatfmD  u sl() rtriopou1lltelict tfaDtrxr ou4tpx iiciltlmDem(vo t0tetrxo oydfa eliei t0texr(o3iy4lp nlfcia(f Dumu  oo4tet io3iyt aDran o (4tlenio3todoa ean s s)t2xrimpoy1om n neia(fa2ur(ront0tet mocilsfaDulump;t0texnif3ty1op rln olt)s2to(o3iy4lm emiesat  rtm(moou1apx ifeiysfaDean o t)trerxo3oa1om e ueslt texo(o3iydal n ncslt)sDumump;t1tpe mfcils aDrlnmpn(0tlxnio ta1oaD lueo;t0 rxo(rpiydopt  nvt ()s2uauroou4opxn o3ilslmDrmn p;t)aetoifcty1fa rln s t)tetoir iudaltemfvt t)a2rau o;o1olx iociytfs uluvo (4 ltrxo totlatraivol(0teurxm3oy4lptemfctls  Dua(m nu0altn fctysfm2emnmonu4aeeoif3oytoat lieo t)truoxo iy1ol n nct s srrax  ou4oeeoif3ild a ulu o;t4teerircootopD aueolt)srxoimpiudlm   net ( aDur(  oo1aptomfetlsla2elnmpnt0arenircto1lpt lueol( s2xo(m oodlltelnvt s)a2trxrpoo1tlx ifeiatfa ul( onu) etrio oa1lm e nei;(0teur(r3io4altelfetlsfa2umxmpot1aexo ieiydlmDul(vs;u4tetrir oodfmD  uvsl(0t2toxm oodopeemncil() 2tmx p;u0apxn octat mDul(msnu4aeermrctodfatr ivs;s  rumim nydap n fesasf 2taxm nu0apxn f3iadls2rlu p u0artoio iodfaDelieo;t tetrio3ou4op e fctasfarta(ro;o0alxo octysla2umuvp;t0 rxomf oatopD livs;t0setoirpio1lpee nctatfsrumumoot4tlxoif3tltfmDuauvsn(0 rtnif oodoaDeli sls srumir3nu4ol  mnci sfsDtrurpoo4tlt  ieiaslmDrlnmp;u0 rtoxr3totlat an ils0setrimpiy1ol elieiltfartax oot1aeenifciyslaDumu o t0treniocto1fmtranes (0srumxo3oy1om e ivtl(fa2rmxr nu1tex ifciadfa ea(vp;u)aeenxr3tatlpDrln ilt)texoiopoo4alt  fetas)a2tmxmo;u1aee  fctldfmDeau pn(0aeeoircio1lm eai o;( t2tmio iy1oltnmfetat)srumu  ;t0opt mieiysfm ulnvo (4tltrio3to1omtrlivo s0trurxm iu4alt micta( srtmum ;o1aexn fciydla uan o t)aexrxrctydfmte neo;s0seurir3oydlltn iesls)arrrxmp;t0tleoiicildlaDean on(0tlxoifciodfatelu s (0 euoxm3iy1oltnmfet s srrauront4tlxnmfeilsfs2rmu s u)tetnxf totlaDr nes;s0texr(r oy1lmenlnetls)s2um(mp;u0tetn ociadla2rmnvsn(0trxrxo tydlm e i ilt0srur(rpnu1apt micilt srumxr ou4olxo fciatlsDraumo;t0tltrxocta1la elues;( srtr(o oudlmt micsls) Drmxr ;t0texn ieiyd m2ran o;t4tleoxo3oadfp  aueo;t setmim ny4lm emfvi (f Dtaxro;u0tee mociatlm emu o u0tetnxo oy1latranesls t2trxr3oo1llen fcsa(  2rr(r oo0alt moeiytla2umn s u0 exnirciadlatelneol() 2xo(m3ou1ol nlnet (  Drau  ou0aeenio3tasls elump;u4trtoxf oytlp eai i;s trxm(r iy4op   ncsls) rrr(  ;u0alxnifciat sDeanmp u0 eeomr3iytopDranvslt texr(opoo4amtemies (faDumxr ;t1tex ifeiydls elumonu)alxrxr3io1lpD  u sl(0 2tmimpnu1lptemfetat srurur ot1apxnmieiat m2eaumo;u0trtrir oatfaD ln i ( t2uo(m nodom emfcslsf rrmx onu4tpeo i3iasls rau snu)trerxr io1fpDeli i;s)seurim3nu1lp e nvtasfsDrm(m no1opx  oeiatfs emuvo (0alermo tydlat  n i t0setr(o3nu1lpt mfvt s)s2tm(m ;u4apxoiiciytfa ulnmo (0arxrxr3ia1lmt  nes;t)sruoir ou1amt  ics s)srua(mo;u4altoif3iad s2elnvo;() etrircta1la e neils)teuoxr oo4op  lnviat) Dtmxm ot1tpt  f3ias s em(mpnu)texriocoydfmte nes;s0s2xoxm nudomeelnvia()a2uax  ou4apto i3iyt s2em(vpn()areomfcoytfm  anvs s0 2xo(o3ou1lmeeliesl(f Drax pnu1tptnii3tldla2emu ont4tetrxr3oodlp   uei;( sexoim nydlleelicia()a2rax o;o4tpx mieiyt s2emuvpnt4artrxr iatlmteanvi;t) rur(o3oo4ale mnvtls)sDur(rp;t0olx  i3tltla2rl(vo;u0tetrmfctotlp  luvol( srtr(m3nydoleelivtasfa2trx ont4tlx  i3tad s rl(ms;()altnxo ia1opt  nvslt0 2tmio3io1omee feta()s2raxmonu0aeto f3iydfs2rau onu4 renxo ty1omte n sls0sruoxmpnu1aptnlnesl(fs2rr(mpno1aexomfcildfsDrauvo u4 eerxf tytfpteanvilt) 2tmiopou1ale miei s)aDrmx pot1aptomfcildfa2ran s;u0 rtnmrctadlptr u o t) exrir oodlm elnvsltfsrua(mp;o1oeen o3tlslaDrm( s t) rtnxf3iadomtr ivil(0 rtm(mpoo1ll emnei () Drrx poo0ape ioetas s2rl(vp t)alenifciydlp elnvols) rtr(mpiudlmte netltf rtm(r oo1tle mfcilt s2ranmo ()arxrif3oatfate u s (0sexoim3no4om  lneta( s2rrxmono1apxo oeiytls el(vo;()tetrxr io1lpD lues (0t2trir ou4lle mneia(f 2uru pnu4oetn i3tat aDra(ms u) ltomrcty1om ran slt0 etrxo3no4op elnvt (f Dtmx oot4ape ifcils mDranvo u4 ltnxoctotomD  n s s)sexm(o3no1alenlivtas  2rm(m ;u0olx  fetat aDeau p u4alxoir ia1la r i slt teurir ou4ll nlnesasfartrxmp;t0tee  o3ildlm ea(mont0 lxoir3totlmtrlu ilt0 2trxo3no4llte nci s)a2rru  ot0opto oeiltla um(ms u4 exoif3io1la  aieo;( s2xo(m3iy4ape lfvi s  2rau  ou0opxnmfeilsfm2rmnvo u0texrmf3oatfp r uvi;t) 2xrxopiodam emnvt (f rra(r ot4oleoif3tlsfaDuan s;()aleoxrcty1fp  aues t0 eumio3io4lpenlfct tf 2ra(m ot1apx io3iatlm2ulump u)aexoxf oydlm rln s;s seurio ny1lmtelictat s2trurp;o0tleomietlt s eanmp;(4tlxomr3tytla raueo ( t2tmimpiudapeemies t)s2ur(ronu4oltn ieiys m2rm(vpnt4tltnxr to1fptrliei ( trtrxo3oo4lme livi (farum(r ;o0teeo o3tys aDumuvs (4 rxrxfcto1fp eaivs;t)t2trxm iy4omtelfeiltfa2ta(rpou1aetomoeiat s eau s;(4arxnxr iotoaD livs;t)s2uoio nu4aptn fcsat)arta(r nt1oexo oeildlaDea(mpnt)aexoif oa1optrliei s)srurxmpiudope lnvtls a2rmu  oo4alt iictlsla el(vo;u4 lenir3tytoaD lneil() rxrxrpiu4lp  lnvi (faDrm( onu4aexo o3iydlm2rlnmp;t4trermr oadlmtraies s0setoir iy1oltelfvsltfaDumx pnu0tlxnmociytlmDem(mon(4 lxnxrcoo1lat lu o;(  exrio oy1lm   iciat  Dumuront0aleo f3iyt a ranmpnt4texriociydoat li s t s2tm(rpoy1am nlncia( srrm( ooo4altn o3tytla2ul(vo t0tleoxocoydoptraieils)srxmxr nu1ol e fvi s  2raxmont4texomfeilsls2uanvp;u)alxrxr oy1op ean s t0texm(m3ny1apte nes ( arumu p;o4oet iictytfs el(ms;(0 reomo3iadfat luvsls sexoio3oo4ol  mfctl()sDrru pot0olt iociysla umu s;u4 etoxr oydfp  lneilt)trxoio3iydamtn fcias s2ur(rpnu1tpen fciydls2ra(vsnu)aexrmf3iodla eluvolt0trxoiopiy1omt lnvt t)aDurxrp;u0oee if3iysfm ua( o (0 eeoircoodlatrlieol(  exoxopou1apeemieiatfsDtmxroou4apxoioeiysfs2el( p u0 exnir3todlpD au sls0srxoio iy1am   feils artmu pno4aeen fctysfmDrl(mo u0tlxrmocoy1oateanvo;()teurio3nudam  mietlt a2trur ou1oltnif3tasfaDuanms;(4tltoxr oodop r ies s  2uo(m3ny1lm e fcs ()aruaump;u0tet  ieiad a elu pnu)aetomr ta1lmte ueols setrxm ou1omtnlfvslt sDtruro;t1tlt iociasls2eau s (4arxrxf ta1lp   uvil(0 2xrim3oudlptemfvsl(fsrrax ooo1oee  i3tatla2ulump;t0alerxf3iadfmDelieil(0 etrxm nodom  miviasfs2tauronu4olto f3iltlsDrm( pn(0 eermocoy1fate nvolt0setoimpiy4omeelfcils srta( pou0tlxn ociadla ua( p t4altnir oytlatr nei ()trxmim3ou1ome mfcs sf 2urumooo4oee iiciytlmDumump;t0treoxr3tydlp rlu i;t)s2uoxr nu4ope lnes s srururo;t0tex  oeiyd aDelnmpnt0 etriocoadom  auvs ( seto(rpoodoptn ieiasfaDrmum ;t0apenmi3iadfm em(vs u0alenmocoydlm rauvolt  euo(r no1lmenlfvs ()sDum(mpno1tlx mo3iatlm2ra(msnu0tltoxoctatlaDrai ols0s2tmxo iu1am nmfvtasfsDurx  nt1apxnifeiasfm uln pnu)tetoir oatlaDeluvsl( sruoxmpnodaltnlfctlt artmump;u0openmociltfm2uanvsn(0artnxr oytoaDeanei (0sexm(r3ny4lp nlfesas s2tax  nu0oex iociydfsDeanmpn(0arxoxf oatom r i i;s s2um(r oydomtelnesa()sruru ono4olx  ociysfa emnvp;(0treoxfcoo1lmD au il(0 2tm(mpiy4lpe mfvtls sDua(  oo0tlxomictlslsDuauvsn(0artoxo iotlp  aieo;s0trxo(m no1openmfct (fsrra( p;t1tlx ifeilsls2eaumpnt4artrxr3io1oaDelues;( trtm(o3io4ope  ies s s2taurooo4aptn ociadls2emnvsn(4aetrxrctytfp  an s s0 2tmxr io1lmenlnvs (faDra(m ;u4oee mi3iadlmDrl(vp;u0trxrmo3io1fmt anesl( s2xoio nudal nlfvtas arur( pno1tet ii3tydls2uanms t0aexnmr oo1la  auvo;s seuo(rpno1llenlnetltfsDrr( o;o0tetnifetld m2eanmo u0aexrxo tydla rlieils s2xm(mpno4apt lnesls) rrrur ;o1teenifcildfsDel(mp u)tlxrxfctytfm elu s s  2uoxrpio1al emfetlt)sDta(rpoo4openmfeiasls emuvsn(4treoio tadfmDr uvs ()setoxm3iu4lpt livt (f Drru  ou0ale if3iytfmDelumpnu0artrmf ootopD  nvo t setrxm3no4ol  micsls)s2ta(moot0apxn ieils s2rmums (0aeerxociatlm eanvs s seurxr3nydolee ict ()sDumu  nu1oexnmoetatfm2rmu snu) rxrxf3to1opD aneo;s)sexrimpiu4lpenmict () rumurpot1texo fetlsfm ul( p;t4aetomrcoatoaD  ueo;( t2triopoo4om nmicta(  2raum oo0oltoii3iys a2um( p (0arermocoydla eluei ( sexmxm oo1ll  licsl( aDtrur oo1tet mfeildlm2el( p;(4trxrmf tadlaDrli s s0s2xr(o3ou1altelieias) 2um(m ou4aex mictls m ea( pn(4aexoiocootlatrlu i () 2xo(m3iy1ape livsat)a2rmxrp;u0apeoiieilsfs2uan s;(0trxoxf tatlpD aiei s) rtoxr ou4openmnci () Drmurono1olxnio3iadlm2umnmp;t4 lenio io1fmD lu s t0 2uoirpnodam e fetl()artr(r nt0olenifeiatla raums u0tltrif3tadfaDrluvo s srtrxo3iu1lp n netl(fsDumum ;u4teto ieiyd mDulnmp u4 leoio3tydfmteauvils0t2xmxmpoy4ap elfcs t aDumxmpnu4apto fctyt m umn o u4tltoxfcta1faDelivo;t)t2tmim nu4ope mics sf 2rax pno4tleo fetadlsDulnmo;(0aeenmf3ia1lmtr u sl(0 ruo(o3iy1opte nesat) Dra( ont0oetn fciadlm2rmnms u)trenmr oadfm eluvs;(0 rxmiopiu4lm  mivslt a2ua(moot0alxo feiysfa2uanvp;t) etrmo ta1oat livils) ruoxo ou1ol emnvtls) 2tru pnt1apenmi3iysfa ea( s;u4trxrmrctytoptrau o s)s2toxm3iu1ll n nes (  2raxmp;t1aeeo ictadla uaumont)tlxoif3tydomDeli sl(0srumir io4lme micsa(f 2rr(rpnt1olx ioetysfmDea( o t)texomo tytlmDraivs;t) 2uoim nu4lpe lfci sf 2ta( o;o4tlxoifeiyslm2rmn p;u0 eenircootfm   ieslt)trxr(m3iu1ole  ivs s) Dta(mp;o0oetn f3iltla ra(vo;t0 exoxr3oo1la e ieo s0t2urir3nydol elivslt a2tm(moou0apt  oeiltla2umu p;(4 lenxocta1fmteauvil( s2umxm iy1lp elfcta(f rur(m oo4apt ifeiadlm em(ms;(4 rxniociadoptr nvols  2urxo nodal nmfesat)s2rmxr nu1tpxomo3ilsfs2ra(mp;u0texoio3oodomtelieo t) exm(m oo4ll nmnetl() 2uaum ou4apenioctldls2ul(vp u4trtoircta1omt auvsl(  exrxo iy4lmt mivslsfsrrmx o;t0oltnii3tltfa ul(mont)tetoxo3oydomD li s;t0srumxm3oo4lpe mnct t sruaxrpno1oex ifeilslsDemuvp;(4 etrir3iatlptelivs ()srurxo3ny4lpee iet s aDtrum no1olxn i3tldla rlu pnt)trerirctatfp eli ol(  rxm(m3oodll e fvtls)arrmu ooo0aee mf3iys s eanmo t4artrmo3oatopt lnvs;t  2uoimpiu4omeelfetlsfsrraum ;t4aetomfctldfsDum(mo (0trenmo3io1om r n sls0trxoxo3ny4olt mici ( sDtr( pnu1tetomf3tytfmDumumo (0arxrmr iodlpDeaneo ()sexr(m no4lp nmfciat sDrmxmonu1opto fciys mDel(monu)tltrio3io1lmDeanei;s  ruo(o3nu1lp nlfcias  rrm(r no4tltnmi3ils a2ra(mp ()treoif3iatfa eluvilt)trxmir3iudal elfci sfaDtmx o;u1oee  o3tld s2em( o u4 rtrifciatfptrln s s  etmxmpnodopte icta() Duaum nu1tltnifetadfs2ea( p;(4 rxnxf3oatoaDean s t) eurim3iudlpe  nvsls)a2rrur ;t1teto ocild aDrm( snt0 eermo oadlpteln i;( trto(r3nu4ap e fetat) rtm( p;o1opx ii3iatls rmnmon(0aeerif3ootlaD lnei t)s2umim oydlm elfcsat  Dtmu onu1tet  o3iatfs ranvp u)teenxrcto1omtrauvi t0srxoxr iydape  fesltf ruru  oo1alxnioeiysla uln p;(4aeenmr3to1omte uvo s trxrxr3oy4lm  lfeilt sDrrum ;t0olxnmi3iatlm2ua(vpn(0 etrmr3oydlpt lnvilt)sexm(r ny1lmtnlfvilsf Dur( p;t1olx ioctatlmDean o;(4 reoir ta1lm elnvs;s  2xrim3ou4lpenlnvtas)a2tr(mp;o1tlxoiieils m2ranvs t0teerif3oadlmteluvol(0srtmir3oudomee ici t aDtaurpnt1teeoio3ildfa2eau o;() eermo3oydfm  lnvols texmio3nudol elfet t)s2tm( onu4tpx  fetat a rm(vp;t0teeoxo3todfa r u sls teur(r3oy1al n nctas aDrrxm no0oexnmiciydfaDul(vpn()trerxf iotfmDrlnes t0srtmio3iudal e fct s arrm(m ou4tpxomi3iltlmDel(vp t)alenifciatlateaies;(  exmxopoo4ll  lnctas)srtm(roou4apxn o3tltfa eauvs;(0treomfctytfmtrlnvi s s2xo(m nudolenlneiasfarumu pnu4tpe ioetad a rluvs t4 exomfciatfa  lnvsl() etrim nydape lnet tfarurur ;u4apxnmi3iysla rlnmsn() ltrxf3oodfaD livolt) 2trio3iu1apte fctat aDra(mpnu0texomfctysfs rlu on() rermfcoodom r u s;s)s2uoxrpiodap elfesa(farum( oou4ole io3tytlmDemums;() renxo3iotlmtrlivols  2tm(m iy4lp emnvslsfsrtau p;u4olt mo3ild a2um( p;u4 rxrmo3iotlatr i o t0sexrir3io1ole lfetatfsDtm(m ;u4tex  ieils mDeaums;(0aeenio3iodla eaieslt0 euoxrpou4lleelfeiat  2rax p;u4oleo ictlsfa2ranvs u) etrxr oytlpte uvo ( t2umimpiu4lp elicta(  2tr(mo;t4optnio3ildfs rl( p (4aleoxf oadfa  auvolt)trxmimpnodoptn fcsl() rurxr nt1oet mo3ilsfm emuvont0artomf oy1fatrlu ilt0 2uoxopnu4ap eliviasfs2uaxmooo4apt moetydlm umuvp;t0 exoxr oy1fpDr uvo s) rtrxr3io1lp emfei t aDuaxr nt0aetoiociytfaDumu o;t) etrxf3iotoatr nei;()sruoiopny4amt lnctls  Drmxro;t4olxoii3ils s umump u4 etrmo oy1lpDeaiesl(  etoimpnu4omee icsltf 2tr( onu0oltnmiciltfmDeanvp t0 lenifciotom e ues s0 2umxrpiy1ap emfci ( srtaur ot1tetnmociytfm umnmp;u0tlermfctatfpDe uvsl(0seumxmpoo1lmt  fvi ()a2uaxr ou0alenioetldla2ulnvp;u0texrmrcoo1laD  i s s srtr(rpnudaltn nci ( arrrx pou0ope micias aDelums t)altrifcto1lmte i slt)s2tmim iy1omtemiesl(f Drru o;u4alt ioeiadlm2elu p;u0tetoir tytlm rlu o;s tetrxo nu4amt mnvs t) 2rmx oou0oee io3iys a rluvsnu) ltoxfciatom e u ols0s2xm(r io4alee nei t sruaum oo0oex iieiasls2rmnmpnt0tltnir3iadlatrluvils)t2xmxo3nydomtnmneia(f Dtm( o;o4olx ifciltfa2elu ont)aexoif3io1oaD auvi t  rxm(m3oydopenmfeilt artr(r oo0openmi3tasls uauvs;(0areoir3ia1fat aivilt) rtoxm3ou4opee fcils  2rm(ro;t1aexn i3iydlaDemums;u0tltomf3oo1fpte uvol(0setrxm3no4llenlncs tfsrrru ooo0apt mf3iadfs ua(mo t4alxrxo oadfmtraiei;()teto(opno4lmtnlict sfa2uax pnu4oetoii3tadlm ulu s;u4 ltomo tadla elnvils0 rtm(m oy4apt livt t) rtru o;o1apeo fcildfa uanvs u) rtrxo3oydfmteauvs;s  2uo(m3ou4lm   ivilt aDua( oou0tet ifeild a em( o t0 rermf3oydfp elues t) 2tr(r3oydome mnvt tf Dtrxmpnt0oee io3tld m2rl(vp (0teerxf iodoaD livi;s tetmio ny4olt lfvia() 2tm(r ;o0opt  octat m ua(msnu)aetomo iotfateaies;s0trur(r oo1am  miei tfa2rr(ro;o0alxnio3tyd aDuluvsnu0teeomocoytom e ieils) rxr(m3ny4ameemivsl()s2rrum ;o0opxoifeias m2el(mp (4altnifcio1fp eln o ( t2tm(m3oydapeelnciat) 2rr( oot4tpt moetlsfsDua(vp;t4 lxnmfciodfmt aneil( srtmxopio4alt livslt  Dtmur nt0oet mo3iasls elnvp t0trtnmocio1opDeluvi (0 2xoxo iu4al   nci s sDrrxmont4ole mo3iysls umuvsnu) lxnmf oydlat  uvs;s  etriopnudal   fvsasf 2trum oo1tlt mictyslsDuan s t)aeerxo3ootfa rlnvs;(0 ruo(o3ou1lpeelieta()aDraur ot0alen i3tytfa2umuvsnu4 ltrirciadoaD auei s) exo(r nu1altnlicta()arrru  ot1ole if3tadlmDrluvs;u)aexniociotlatean s ( t2xoiopoodlp   ivia()srtm(ronu4optoifcild m2el( o;u4arenio tatoa   uvo;s  exmirpoudomtemiet t srua(rpoo4aeenmieiysla2umu o;u0arxrmocto1fat  n o;(0teto(r iudalt mieil(faDtmuroou0ole  feiydlm emnvo;(4aexomocty1fpD lneo;() exrxr3oo1opt mfesas)artr( ono4altomfcilsfa2eluvs;(4 eerio to1omDrlneil(0sruo(o nydomte fviatfaDra(roou4aet  fctasfaDrm(vs u4altomo oadfm   ieo t s2toir3nodome lieia( a2umx ono0apx  ociadlm umuvsn(4 ltoiocto1om eli o s) 2tmxm iudllenmnet s sDumumonu0tee  oeiy
\ No newline at end of file
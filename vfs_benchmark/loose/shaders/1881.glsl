@@ -0,0 +1 @@
+nes;s) 2trimpoo4aleemnviatf Dtaxr ;t0aet mo3iadfsDemnvp;t0teerxo oo1faDr ivsls setrxo3ny4omtelieiat artm(r ;u1tetnmfetatfa ulums;t0teermf3ty1lpDelu s s)t2toxm iu4altnlies t)arurumo;o0texnmfeils aDea(mpnt0tleoioctodfm e n s;s t2uoxo nodapt mfci ()aDururoot4tle if3tadfmDulnmsn(4 ltomr totfa rli i s srxrxrpnudopeemncia(  2rrx  no4aetnio3iydls raumo (0alerio3oy1lmtran sls0 rtrxo3nodap e fctat  2tm(ront0oex iictad mDulnmsn(4trerifcoy1opDr iei;s0t2toxm3iu4lptelfcs t) rtm(mono4opt mieiysla um(vs;t4texrioctadom r ueo;s)srum(rpno4ap   ncsa( srur(ronu0oet ifciys m um(mo u)trxoxo3totoa  lu s;t setrim nu1ol nmivil( srumu  oo4tltnmfeild m emnmp;(4 exrxo todfpt  ivsls0 etoio oodap nlnci t  rraxmpno4altoif3iyt m2um(msnt0 exrmf3oo1lmD  i o;( texm(r3oudop nlieslt  rrmumono0tee mo3iadls2uanmpn()trxrmf oodopDrlu slt tetmxm oo4altnlfvsl()a2uax oot1tlenii3ildls umn ont4trxnio oytlp elnvo;( trxmim oudam e icia(fa2tmx ono1tle mieiad sDemums;t)texrmo3ta1latr nesl() rur(r nu4olt lfcsatfa2rmxm no0tlt iociyt a2ea( s;t0 exoxfcta1lmteluesl( seurio iu4lpe mfct t)s2ua(  ou4oeeomfcilsfaDem( on(4 rxrxo iytfp   n s;()tetm(o iy4olt  ncsasfartrum ;o1apt mfcildfmDeau s u0 ltomr iytlate ies;t0 2tmxo oo1opeemfvt t arrrumono0opt io3ildla rl(mp;t4trtoif oodoatraivi;s srxr(rpnydlleelivi t aDtmumpnt4aptomoctytfa2rl(vs;u)aetnmf iadlmD lu il()t2xr(mpoo4ap elicilsfs2tm( p;o1aet ioctls s uanms;t)artrmo3iatfmteau s s  rurxm3iudlp nmivsls a2urum ;t4texnio3iat s uaumonu0 rtrxo3oodlm  lneols  ruoim3no1alenmfciat)artm(rpno1altoif3tytfs2uanvo t0arxnxr3oodfm  an il(  ruo(r iu1ap emnvt (fa2tru pnt0olxo fetasfsDumnvp;u) eerif3tydlatelnvs;t  2uriopny1omeelicil( s2umu ono4oleoifcild m2rluvs (4 lxrxrctotfaDraivo;t0 exoxm nodoltnlieta(faDtax onu0tet mietltfaDel(vo;t)tltomo oadlmDe ieolt0tetr(rpoo4omen ivtls)a2ta(rpnt4apt  oetydfaDraumpnu)teenxr3oodfm eaieo ( texm(o oo1lpt lict tf 2rr( o;u0oeeniictldlaDrmnms;(4 exomo tytom   nvolt)trtoio oy4al emnctlt)sDrr( ont1tlen o3iatlmDemnmp;(4alenmf oa1oa  aiesls sexrxr ou4aptelivia(f 2ua(mpnu1tpe if3tytls2rauvsnu)trtrio ty1oaDelivo;s)t2tmio oo1ap e fvsas srrmx  oo1ale  o3iat m2eaump (4 rermociy1oa r ivs;(  2umiopno4lm  lici ()sDtrum ;o4aee mf3tytlsDuanmon(0treoxo oytlp r ieo s0t2toxr3ny1omte ict ()aDtaur oo4olx ii3tyslm uaumo;t0areoiociodfaDr nvilt) etoxo3ny4alen nvtas) rururo;t0tpt mi3iytla ul( sn()artnmr3io1fmD luvs s0setmxm3nudamtemfesatfaDtaxm ot0tpxo o3iltlsDem(mo () renmf3ootfpte ivi;t0t2to(o oodll   fci s)sDtrxm ;o4olenmo3iatfm2ua(mpnt0arerifcoydlmD aieslt0t2umim3iudlmeelnvil() 2tmum no0aeen o3iasfmDum(mo (0 rxnif3iatlat ln ils0 2xr(m nydamenlieta( s2urump;u4tetnmieiatfm2um(msn() ltnmf3oo1omtrlu o s setoxo3iudlltemfesas  2rmxr oo0opxomoeias s ea(mont0 eenxf3oa1oa r neo;() etm(o iudlme mfvt tfa2um(rpot0alto feiaslm uan o u0alxrxfctydfmtelnvo s0t2xo(o oo4olen ivtlt arururono0apxn iciadla ua( p;t0altoir3to1faD lnvi;( trtm(m3iodamen nes s) Dur(  nu4oleomfeias m ulu sn(0aetomr3tatomDeaueo;s)tetrim oydaltnmictat) rrax p;t1tpe iociytfsDeaumo;()areoif tydopDeau s;t)s2xrio nodame lnci (fsDraxmo;o4aex  fetas a ra(vs;t) ltnif iytlpD lieo ()srxo(m ou4lm nmfvtls) 2rru o;u0aeeoiiciys m rl( pnu)alxrxf3tatopteauei;s s2xo(r no1amtnlneil() 2tm(rp;o1aexn ictatfs um( s;u0 rxomf ta1fp   n ilt  2ur(mpoo1ome  fvs t)arrauro;t4olxomietyd aDrmnms;u)texomo todlp  aies;s0teur(r3oydomt lies ( arumxmp;u1optoioetltlm2ra(vp;t)trerif3oo1omDelu il()s2umxm3iy1amt  icils) rta(r ;o4alxnmfeild mDelump;u)trxrir3todfptrlu s ( seuoir3ny4lpe mfes s)aDtaxmooo0tlx ii3ilsfm2elu o ()aexrif iotlp rai i s0 2urxmpoodlltemiciasfartrxm ot4tee ioeias aDra( o;u0trerxrciadfatr n s;t  eurir ou1op emics (  Drr( pnt0aee mfeiyslm elumsn(0alxnifciodomtrlnvslt tetrxo3ou4open iei (fs2rau  ;o0opxo i3tys m ea(vs t4tleomr3tadom e n s;()texmir3iydolt lictlt) Dtmxrpnt0oleo i3ild m2ua( ont4 lxnio3ia1laD an o;t0teurim iudaltemicsls  rrmumoou1apxnifetas s rln ont0trxnmr iadlmtelieo;(0s2toxmpnodomeemncs (f Dtrumooo1tlx ioetas m2rauvsnt) exomf ta1fa r nvi;() etmir3iu1lm e fvslsf 2trx o;o0tltnmoctatlm rmu o;t4 eenmf tatomD ai il()t2urxopoo4ol e iesa( srtmum ot4aexn fciasfa ea( o (0artnmo3tytomte iei;t) ruoxr3oodomt lnes t) ruaxm no0tpt  i3iysfaDrl(mont)aetnmociy1lmD lieils) ruo(mpnu4lptnmfeia( s2rm(rono0olenmi3iad m elnvp;u) reomrcoy1faDe n il()trxriopno4lme mnct (f Dtmum ou1oleoii3iadls rmnmo;u4treoir3io1lateau ols0t2ur(o nudll nmnvi s  2tm(  ou1openio3iasfs em( s;(4 rtrmrciytfaDraneslt0trum(r3nydomeemfcilsfsDtm(rpoo1apx ioetas m2eau o u) lxrmocoa1lmDeaieo ()teur(r nodllt  ictls)aDtrxm ;t0opx if3iydfsDrlnms;t0aexrxo iodom  lueo s0 rumimpnu1lpeelivtatf rrmuro;o0texomociat a eaumo u4 rtrifctytoptraieolt s2toim io4lpen fes s srrau o;u1tltn oetydls emu p;u0aeeoifcto1lp eli ol()texr(mpio4lptn ivils  2tm( p;t0olx  iciydfa2emumsn()aetnmo3oydopD lu ols) 2toxm iu4alt mnvil( s2umxmono1tpt  i3iadlmDul(ms;u0tltoxr3iy1optr nvs s0 etoxmpio1lpt  fes ()a2taxmpnu0oeeomoetldlaDumuvsnu0treoif3iadlpDr ies s) 2um(o oo4apt lfcsas s2tr(mooo1oexo f3iat s2ea(mp;u4aexoiocio1fptr ivi t)sruoimpoodaptemfet ( aDtaxrpno0oee  i3iytla um(mont4aeenir tadfpDrlnvilt0srumiopoydoptnmfetlsfsDuaxmooo1alenio3iysla2eanmon(0tleomr io1om elivs;(0srtmxmpiy1altnlivsa()aDuaxmpno1oee mf3iltla2rmu o;(4texomo oatop  lieols  exoiopiu4op elicsa() rrax  nu1tlt  oetldlm rlu snt4aeerxf ty1op rlivils) 2toimpou4lpeelics tfs2rmumpno4oexomociytfa2emuvon(0aexnxf3oadoa rlu o ( tetoir iu1lptnlfcsl( sDrmxmo;o1aeto fciltla emuvo t)texnio3tytlpDrlivilt0 eum(m iodamtnlncsatf Drm(  ou0oex  ictlsfm2umu s (4texomo to1fate ies;(0srxoiopio4om nmnvtasfsDua(rono0tetn fciydla umums;u4aeenxoctydfat  nei;(0 eurxmpoy4ome mieta( sDrrurpnt1ape iociaslmDemump ()aeeoxo3oa1oat  iei;s seurxr iodlp nmivsasf Dum( p;u0optomo3iatfaDeauvp;u)tlenmrcoydfaDrln sl(  exmxrpiudom emnvtl( aDtru pnt1oee  ociytfa2emu o t)treomrcoatfpDelieol(0 etoxo3oo4lm  mfvt t)s2rm(moou4oee  feiyslm2umuvpn(0trxrxo tytoaDr ueslt  2xmim3iodlmen ies s  rtmuronu0apeomo3iad s2uan p (0treoxo3iodfpDeaivo;()truoxrpiudol emneiasf rrm(r ot0opeo fctatla2elnmp;(0tltoxf iadfpteli i;s s2umio oodoptemiei sfsrur(mpot4oex  f3ilt s2ea(mpn() eerxociodlaDr n ils truoxo3ny4amenlictat)sDtmxmp;o1olxnifeils mDemu s t)aetnxf iydlp  ln o s  rxrxm3ou4ap n nvs t  ruru p;o1apxniiciasfa ulnvp u) rxriocio1latelivo;s0t2uo(o nodll n fctltfartmxr ;o0oltomo3iat sDel( o (0tetrxf3tatfa  luvslt)trumxrpiudomt lfviat arumu  ;o0opxnmietyd a2eluvp () eeoxf oo1lm r uvi;s)s2umxo3no1aptnlncs s)aDuax  nu0tpeoiietlsls2uau o (4tetrmr3ty1lmt an s s)truo(mpnodlp  lncia() Durxmont0opeoiiciadfs eluvp;(0 exrirciatfptrlnvi;s)trtrirpio1lptemfct t)sDua(rp;u1tet mfeiasfs2raump;(4texrioctytfptrluei (0trtrxmpno4lpee feta(f 2urxmpot1oex mieiatfa2ulu s;u0tetnxr3tatfmt aivo;t  rtrxrpiu4ap  mnvs sf rtrx p;u4tpxoifeiatfaDea(vsnu4alxoircia1lmD  n s;s0t2xo(opoo4ap elics s) 2ra(rooo4tlxomieiasla2rau onu4aeerxrcoatfat  nvil() etoimpoy4alen neta(  Duaumpoo0oeenio3ias aDrln s (0tlxoxf3iytopDe ivo t)trxm(mpno4lpenlfvsat)arta(r nt1oltnmociytls emnmo t4artrifciadop   ues ()texoim iy1amee neiat aDum(m no0tlx mociatfaDemnvsnt0alxnio3ootfp  lies;s)t2xrxr iudop nmncsls) rrrx oou0oetnmicias a2ulnmo;t0tlerif3to1om   n il( s2tmxrpnu1ol nmfvsl()a2tax  ;t1opt mieiatfsDumu s;t4tltomo3tatfptelivo;()srxmxmpiy1om emivt (farrrx onu4aetoio3iys sDumuvo u)aleniocoodfmt  ivilt t2xmir3nu4lp e ivt (  rurx onu1oleo iciasfmDulumpnu4tetnmocootlmtr i i (0 exoimpoo1ole  icsl() rtm(rpnt1tpeomfcias a2rmu o;u0arxoxrctodlm e uesl() 2tr(r nu1openliet s) Drmum ;u1alxoio3ilsfs ra(vs u4 rtnif oatfp  lnvils srtrxm io4lm  mfcia( arra(rpot4apxn o3tasfsDulump;t4 exoifcoy1omDelivo;t0 rxoxm oydlmt lnvslt) 2umum nu4oltnif3iadlm2um(vo u)tlxoir oydoa  aivols0setoxmpnodalee fctl( aDum(r ;u4teen o3ildfsDeauvpnt4trxnio3iatomD lnvi s)teumxm3ou4am nlfet s a2raur oo4tlxnmoctlslmDuanvsnt) exnif oo1fpte n s s  rur(opoudomtnlnetat s2tm(rp;o0aetn fetltfa2ra( p t4aetnxo3oodoptr i sls) exm(rpou1optelivtas arrauronu4aptoiieilslm uanvo;u)arenmocoytopDelnvo;() rtrio iudom  livt t)a2rau  ou1olt  o3iatfs2rmnmo (0treoxociytlm eaieol(0teur(r3oy4op nlnci t a2urur no1oex if3tltfm raumon(4trxnxo tatopDrliei (  etmxm3ou1lm nliei s)artrumpnu1oltoioetls m ulumonu)texnxr oa1fptelu o t trumxm nu1lm  mncsasf ruax ono0olx ifcils s2rau o ()arenxr iy1opDe ivo;s0trxoxo nudllt lict s  rta(rono4aexnmoeilslm umuvs;() eenxociatfmt au i;(0 ruoxr iu4ll  lncsat  Dtm(ronu0oex iieiat s ulumsnt0altnir ta1lp  ln s s0srxrio iy1alee fvsltfsDrmxmooo0tetn feild aDrlu s (0 lxoxo ta1fptr i ilt  etrim oo1lpeemics t  rtmumooo4opx  f3iltfm elnvsnt4artnxfcoy1fmDelnvols0 rtm(o3oy4opte fetlt aDrau o;u1tlxniociytla ea(vo (0 ltrxf3oydoaDr ieol(  2urio3oo1ale livslsfs2tau pnu0oet io3iltla ea( on(4artomfcoatfa rlu i;( srtrir3no4omt mfcs t aDua(rp;u4oexn iciytfm ulu o;(4texnmfciy1omte uvs ()teumxopiy1apenlivtatf Durxr no1oex mfetadfm2em(mo;t0 reoirctotlpt li s;( texrxm3oo4al   netat) Dtaxmooo0tlx ii3iydlm eaumpn(4 rxoxo iotfaDeauvi (0s2xmim3nodlp  mnetltfsrumx  nu1altn i3iysfsDul(vp;u0altoio ia1fpt aueo s0 rurio oodomt  nci sfarum(mpou4tleomo3ilsfmDranmp;u0aexrmfcto1om  anvilt)teumio3iodom n ietltfarta(rono0alto feiltlsDrl( o;t0alxnifciy1fa  au s;s srtoio no1lpenlnctas) ruaurp;t1oex ii3tadfsDel(mon(0artnir3oatfa ranes t0t2ur(o3iy1lmt  icil( aDtrxrpot4aex ifctltfa2elnvont4 rxnif3tydop   nei t0s2xm(r3iu1lpte ies t srtru ono1oexn ociadfa emn pnt)alenmfcio1fmDr neo;s  euoxo3io1omtn nvia()s2trumono4oeeo feiatls rln onu4aetnio3iytoat an olt)sruo(m3oydaltnlnvtls  rtmur no0oeenif3iadls em(msnt)tetoir ia1fat au i t0t2xoxr nu4om   ncta( srraxmp;o1aeeoii3iys sDumn snt4 rtoxf iadom r uvo s srtoiopiy1omeelnvs ( s2tmum ;t1olxoifctyd a ea( s;(4trxrxf3oytlmDr ies s  2urio3oy1omt lnei tfsrrr( p;u4oeeomieiydfm2ua( s;u)tetnxr3iydlm elnes ( texrxopny1alenlnes () Dtm(rooo1oleomf3iyt s2eau onu4tlxoxrcoadfa  luvo;t) rurxopnu1ope lncil() 2um(r ot0opeo iciltlsDeln snu0aetnmfcootlptraues;s s2uoio io1ome mnctas)srra( onu1aeeo i3iysfm2uau pnt4areoxf3oodomtranvi;( s2urxrpoudll n nvs tf 2tmu  ;o4opeo i3tlsfsDranvo;t0tltomf tydfa  auvslt seur(m3iodapenlietls aDtaum ot4olxnmf3iatfa2eauvon(4 rxoir iotlaDe ivol(0 etm(rpoo4lme mnesas)s2uaump;t1alxoio3ild mDumumo;(0 etnxfcta1lptelivi;() rtr(r iydomenmfcias)sDtmx  ;o1teeomictlsla el( snu0 lenmfciy1om  aueo t teumxmpno4am e fct t)a2rr(rp;t4optniietys a2el(vont0 eeomf3to1fptrai i (0 2uo(opnodopeelicsls)sDtrumo;t1teeoio3iytlmDrmump;(4texnir3iatopD  n o t0s2urxo3oodlltnmnetls aruau  oo1opxnif3ildla rmuvp (0areoif3todfm  anvils)trumio3io4apt livsa() 2ta(ronu0aetomo3iatfmDua(mp t4areoifcoadfp rlueo;s t2xo(r ny4opt mivil()aDrmx p;o4optnii3tyd aDrauvon(4tlxnmo3ty1lpD ai o (0setmxm oy1ole lnvilsfsDtmx  ou0tpxn fctysfa emnmpnt4teenxfciy1oaDeau o;s0setmxrpiy1lm e ivi ( srraxmo;u4aexoif3ilt m2em(vp (4tlxnmf ty1fmte n sl( seumir iu4oltn fet t  Dua(rooo4oexnif3iyd m2uaums t0texrmrcta1lmtrluvo s s2urxrpio1lm n nviat)s2urx pnt0olx mf3iadfsDrluvont0 rerxocoo1lmt livilt texmxm3iydlp eliesa(  Drrxmpnt0opeomiciatls2el(mp;(4alxomrcoytlpt lu i ( t2xrio3iydol e fesl(f rta(ro;t0oleoiociydlm2el(ms u0 reomfciy1oatr uesl() etoxm oo1amen ivt (  Dra( pou4oltn i3iadla2ra(vonu)aetrmf iotfpDeau ilt0trxo(m3no4optelfvslsfs2rax  oo4oleo ictatlsDul( o u0trtnxo iy1oaD luvi;t) 2urimpiodaltnliesa( a2tmx pnt1opxn ociltlm2rmnvs u)teeomrctadfpDeaivo;()t2xr(m nodll emietls)arraumpou1oleoiiciadfsDum( o u4trtnif3iydlm   ivolt) eumim nu1ol n ivta( sruaxm no4oltomoeiyt aDuanvonu4 renio tytfmtran i;t sruoxr oudlpt  ivtlt a2tr(rp;t4aptniociydfm2umnvp;t0 exrxo todlm  luvo;( s2xmxo iy4ol nmietas arrax pot0tee  oeiadlmDrl( o t4artoir tytlaDeli s;s0 2tmxr3iu1lmtn feiatf Drmxrpnt0oeenmfeiysfmDum(msnu) exoiocoodfm r nes;(0t2to(opoydllen fvtas)aDtaxro;o4texniociat aDulumsnt0aexomr to1lp e nvi s)srxmxm3iydomenlncsas) 2tmu  ot0tee  oetatfaDum(vo;(4arxnmf iatfpD au ols)t2urxm3oy1am emivsa(fsDta(mpou4alt ioeiydlmDua( s u0trenxrcoodfmte nei;t0 2trxr3iu1op e ivs t)srumur nt4apxnmo3iyt s ulnmp u)trtnxo3ty1la elnvi;s0t2uoiopno1ame lfct ( sDtrx  ;o4olxniiciydlm uau o;t0aetnifciodlpt anvo;(  2uo(mpnu1omt lfvias s2umxrpnu1ape if3ilsls elnmo;t0alenxr tatlat an o (0 eur(o iodapeelnvilt)sruau pnu0tlenmociytfsDra(mon()alxrioctytla rlivo;t)srxo(r oodol emicsasfsrurx  ou0optn fcilt s2rln s u)altnxocoodoat an i t  etoiopoy1apee neia( s2uaxm ;t4openioeild a2rlums;(0alxomf tadfpDelneo;t0trtmxo3oo1aptemici () rua(m ;o1tltomfetldfmDulu s;u4aetoxf tydfa elu sl(  2xoio3ou4lmt lneils)sDrr(rooo1aeeomf3taslaDuln s u0texoif oydfp rau s;(0s2trir oo1lp elfvta( sDtrxrpnu1apto feiydfsDelu s;t0areoxo oadfptraivo;t teumxopio1ameemnetlt)srraxr nu0tlxomf3ils a uln sn(0tltnxf3ootfpDeli ils)seuoxo iy4olt mnvs (f Dtmu ont4alx mfetas a2uluvpnu4alxrmf3tadlpDeanvs t0 etmxm iudlpt mfciat)artau p;t4opxn f3tlt s rau o (4trxoiociydlmD  ivo s trxoio3nu1amenlnes t a2rmu  ;t4ope mfeilsfm rmums () etoiocoydfm r ivsls seur(opio1ol   ici ( srraum ot4optn o3ilsfsDuan ont)arxnxo3ty1faDeaueslt  2trir3io4lpe mivi ( aDrmumo;u0oee  octytfs rlump t4 leriocoydopD  n o;s srtoxo oy1lm emnct s)srrrx pnt4oex mieilt mDeauvo;(4 exrxf3oydom  auvi t0seuoxo oydlmt lfvs s srtmumpou4tpenioetldfm elums u0arxrmo3oy1lpDelnvi;t0 2toio iodllen nciasfa2rmu  ;t4tpxnifeiyt s umu s ()alerxrcty1la rlivo s0 eumio ny4lpte icsasf rum(m nt1oltn ietatlm rauvo u0aeerxo tytlmD lnvi;t)s2urxopnudam n neia()arrmx p;u0oltomf3tlsfmDulnvs;u0 etnxo iadlatranvsls texoiopoo1alt lietltfsDuaxmpnt4tetomi3tadlm2el(vo t4aeeoirctatlptr uvi t0 rxm(r no4altnmfcta(farum(ro;u1tet iieiatfmDuauvp;u0aeenxf oadlat  ues;t t2tr(m3no1am nmiet sfaDrmx onu4optn fctatfs elumpn(4 etoif3oy1lp  au ols0teurxmpoudape  iei (fsDurxr ;t0olxnmi3iysfaDrau on(0 eeoxf iadopt aiei t)s2urim3io1lmeelfeta( sDrm(mp;u0ale  oeiatlm2elumsnt0 rxniociy1optelnvi (0 rxrim iodlmeemnctls s2ta(r nt0tex ioctadfsDeanmp;(4alxomf3oatoateauvi;t trxrio3oo1altnmictlt)srumx  ;o1aexoif3tysfsDemnvo u0artrmo tadfptrlu sl(  2umirpoudopee fetat srrrxmp;u4opeomictysfa rl(vp u) renif ta1oaDeli o (0 2xm(m ou1omtnmncs s)sDrau ont0apx io3iyt a2ul(vo;(4aexrmo3tatoaD  uesl( s2xoxm nudoltnmnei s sDrm(  ot1apto iciyd mDeanmo (0altnif iadlp   uvs s setmio3iydopenmfesasfaDumxmooo1opt iiciysls rmu onu4tetrio iy1lm eli i ()srxrxrpoy1opt mieiltfs2uaurpot4alt mictltfs2rauvonu0tlenio3ta1fatr ues s srtm(o nydolt livs ( aDrm(  no0aexnioetasla2emuvp;t4 rxrif oadfmtelueil(  etr(r iy1aptnlfctl() 2trxro;o0tex mieiytfmDelnms;(4aeenxocoodoa   i s;s t2xmxo3iydame lfctat s2ra( p;o1tpenmicildfsDelnvp u)arenio to1la rln o ( t2toirpnydomee ncsa( arur( pno1olen i3tls m el( sn(0 lerxo3iytlm rln ils)s2urim ny1lp   fcs ()a2raxmoot1opxn feilt aDumnmsnt0aexrifctatoatelueilt0setm(o3iy4altn feia(fs2tmurpou1teenmfeiasfaDuauvp t) ltnif3iotfat  i s s)trurimpiu1lmee ivia( aDuru  oo1oltoiiciasfm elu o;(4arenmr3iatfptrlues s0s2trxopoy4amtnmietlt) 2ta(rpno0tex mo3tat s rmums u0tlerxo iy1fmDr i i ( trxm(m3ny4al elfcils)aDtax  no4alenmf3tat a umu s;()alerxr3io1oa elnvs;()trtr(opno1ame  netas)arumumo;t4oeenmieiyd sDrlums;u)altnifcto1late nesls)srurimpnu1altemnes ()s2taum ;o4oeeomi3ildfm2ua(ms ()trenxr3iotlp   uvo;t)tetrxr3ou4lp e ieslsfaDrm( ooo0texoio3tytlaDelnmsnu4 renmr tatoaDrlu o;t0texr(r3oy4ap emfei s)sDuauro;t4tee mf3iltfs rmu o t0trerir ootlm   ueo;(0s2xmir nudlp emfvils)a2rmx o;u4tltniieiadfaDum(monu4tltnxr3ia1lpDrln s s  2xr(mpnodop  lnvs sfa2uru onu0ope mieias s2rm(ms u0 ltriocoodlptelnvil()srtoxm3oo1lptelici t  2ur(mpoo0tetnmi3iatfa uluvpnu0tltnxo3tydla rlieo;( t2toxm3oodapte feslsfsDrm(  ;u4tex mf3iytls2rau o t) lxoxr iodfmtranvi;s0trur(o3ny4al  lnviat aDuau o;t0tpx mfciysfa emuvs () rxrif iydlpDran i;t0 euoir nu4om n fei sf 2ur(m ;u4opto o3ilsfa2rau sn(0alenmrctadfaDrau i (0s2uoim oo1omen ivta(f Drmurpou1tltniictadfaDemump;t4trxnir3tatoaDraues;t)srumio3nydolte fci tf Drmu pou1aetn oetytla2eanvp;t0 rxrxr tydfptrlivo;()texrim nu4altn fvslt)a2rmxm no1alxomf3tas a2eln ont0arxrmr tadom  aivo;s s2toxmpoy1optnmfeta( aDrrur ;u4oltn fciyt aDemuvp;t0aexrmf oydlaDrluvo s0srurim oo4oleelnvsat)srtm(  no4altoiiciysfm2ran sn(4tlxoir3oy1la   ieo;s sruoxrpiu1lmtnlneiat  2raxmpnt0aleniictaslmDuln o u)altrmo3oo1lpte iesl(  ruo(o iodomt lfesl()a2uax ono4ale  i3iat a2elnmpnu0 renxr3io1oaDeai i s teuoxmpnu1apte nciatf 2raxrpnt0olt  o3iytls2emnvsn(4aeenxr3oydfaDrlu il( s2xrxm3ou1ll emfcs t s2rmx  no0tlxnmo3tldfs rau s ()aexrio todlpt aueo (0s2trxopiy1opeeliei s aDtau o;o0opt  ieiydlmDum(vs u0 lenxrctatomD  ieil()t2tmxmpiydlltn fctas)sDur(r ;t0oexnmo3iasla emnvp;(4 eeoxocootoatelivi t)srxo(r ou4apeelnvslt)aDuax oou4tlxomociyt s2ran p;()trxoxf iadlpte i i;t)trtoir ou4lltn nctlsfa2ua(ro;u0ale if3ils m2ea(mpnt4 lermf oa1fa rlieols0trxoxr oo1llt mfcta(f 2rrx oot1apt mieiys aDrlu o t) rtoioctotopDr ivi;()s2urim oudomee ict ( aDrr(r oo1oetnmo3ilsls2uluvp;(0teenmf3iytlaDrlieslt trumxo3nu4al e iesls)aDtaum nu1tee  ietas a2eaumo;u0tetnmr oa1fp  ln i (  exo(m3ny4alee fes s s2rrxrono1tpenioetlt a2eaumpn()artnmrctodoptrlu s;()s2tmir3oydal   fvil()s2trx ont4tpx mfciysfsDel(vo u4tetnif iytoa eluei;t)sexrim3nudolt mfet ()s2rm(  no0olenifeiasfm rmn pn(0 eenmo totlmDranes;t  2xoxrpiy4amee ivt sfaDum(m ;o0aetn fcildls2ul( s;t0alermfctotoa rlies s0trxm(o3oydapt  fctlt)sDtau o;o1tpenioeiyslm eaump;u4trxnxf3iadfate ues t  2xrim3no4op nmnvtls  Dra( onu1oex  ociatlmDem(vo;u0 rermfctotfpD luei s0 2xrxrpny1amtemneilt)sDuru  ;o1olx  iciydfaDrluvp;t4tetomociodomt au sl(0s2toxr3nu1lm   ncil()s2tmumpoo1aptniiciasfm2el( o (4trxomocta1fptelivi;t  exmimpiu4amtelicsltfa2rm(mooo4apenmo3tad a2rluvsnt0 ltrmfcoytomteaivs;t)sexoim oy1aptnlfcia() rrmx pno0apxnmf3ildfs2uauvont0 ltrxo3oodlm r iei;(0 exmir3ny1ll nmnetatfaDurxmp;o0olx ii3ils m ea( o;(0artoif oatom rluvils)trtoir ny1ope mfvsas)sDurxmoot0teen octydlmDra( s;u4 rerxf3to1oaD  ueo ( teumxm no4ll elfcsat) 2trump;u4oee iietltfmDrmumo;(4 rtrmf3oy1fmtraieil( srurxm iy4lp nlici tfaDumx p;u0alt  o3ilsfa rmuvont4aeermr3oytfm e ivolt0s2xr(mpiydamenlneil(fartm(mp;t1aeeoifeilsls em(vp u4tetrxf oy1fat  neo;(0 rurim oy4lmeemfci ( s2rmxmp;o1aetn oeildls ua( snt)tetoxf3oatfmDeauei;s sruo(m oydlmeemfesat)srrrumpnt0altoiiciydlsDumnvs;u) rxrmo3oytlaD au i;s0t2toirpny1oleelfesat) Dum(r ;t0olt if3iasfs emuvo;u)tetrxf iydlmt aieo t  ruoxr iu4lmtemneiat)srur(mpnt1apx  f3tys m2um(vo t0artnmociy1faDeanvs (0srxrir iy1ope  ivsa( a2uax ono1tlt  ietls s2emuvpn() ltnif3to1om rlneo (0seumxo oo1alt liviltf rta(mo;t1tex ii3iytfa2rmu o ()trxnmfctadlpDeaueo;t)sexr(mpiy4amee nesls)s2tr( ono0apen feiasla2eln s;()alenmrciatoaDrlivi;(  rur(m3iodlmt lnci ( sDta(ront1oex  f3iatlm2um( on()artnir3iatfpt aneolt0srtrxopiudlp e ivi t) rumumo;t4ole mociadfa rau p;t)aeeomr io1om r uvol(0 exrim3oo4olen fes t)srta(m nt1tpx  f3tlt a2umnmp;(0tetoxfciytlaDe n slt0 etrxrpio1ol elnvsasf rtr( o;t0aexo o3iysfa uaump (0aetnmr3iytla  ai ol(0 rtm(rpio4ll   fvil( srrm( poo4aleoio3tasfm rm(vs u)tlxrxfctatomDeau sls0 2xrir3nu1ope lnci ()sDurur ot4oltniieiad a rm( pn(4aetoxo3iy1om r u i;t  euoim3iy4lmt lietas sDua( o;t1alenmiciasfs2em(vs;(0aeerxfctatfat li o;t  rtmxrpio4aptemicsl(f rrrumpot0tee iieilt m ulnvs u0tleoxo3iodlat  n s;s0trurxr ou4am  licsltf rta(r no4tlxnioeiysls2uanvp (4 eeoxo ia1fptr neols)teur(m iy1llen ivs ( aDrmxmont0tpeniietydls2uaumo (0tlxnircoodoateau i;( s2tr(m nu4alee ieil( sDtax  no1alx iociyd a um(von()trerircoy1fmtrlneilt)s2to(o iu4ole licsa( s2rrumooo4teeo ieiytfsDul(mo ()artnxo iatfmtrlnei s t2xmio3oodome  nvtat srtmu ooo1tptoifeiadfa umnmp ()aeerio3todfmt aueils  etoimpio1apenmfcia(fs2tmur ot0teenmfetld m um( ont0altrxo tatoaDrlnvi s t2urxrpnodol n ivtls aDtrxmp;t0aleniociad a2ra( ont)trtnxrcta1fa r u i t seuo(o3nudamenlnctls)aDrrumono4tpeo fctytfa2em(vpnt)trtomfctotomt  u i t0trxrir3iy1ap nlnci t srtau onu0olto fciat a2ua( snt) lxoio iadfatr ueo ()srxmir3oudoltelfeia() rumu pnt1aee  oeiydls rl(msnt)treriociytla eaueo;t) 2tm(r3nu1lme  nci s) Duaxro;u0tltnii3tlt mDuan o t0 lxnmr3oo1lpte u o;s0s2tmxo3nydam elfvsasfa2umx  ot0aptnifeilt a umuvp;()texoxf iotfmtrlivsl(0t2tmio3ou4ale  fvtltfa2tm(mono1aetnmoeiatfmDrmu sn(0 rtnmr to1lp eaivs;s  ruoirpiodlltemfvsls)sDur(rpot4aleomfeils sDem(ms u0tlerxf3iadfm  auvol()t2trir3oudopen fctlsfs2tmxmpou0aexniociat m2eluvo;t)artnif totlatrli i t)s2tmxo oo4lleelfvi t)aDua(mpou0oeen feiat sDeanvo;(0arenmf3iy1faDeaneols) 2um(opnudal n fetl(f rtmurono0apxo ieiad a ua( s u)trtrxr3iotfmD li i;s)srtrir3nudlptnlivs ( sDtr(root1tltnifcilt sDrlu p (0 etomfciatomD aneols)setmxo3iodam emfcilt)sDrru pou1alxoifeiys aDuau snt4artrio io1fa e n ols  2tm(o3ou1ope mfvilt arrax p;o0tptoif3taslsDrlnmon(0 eenmf todlpDelnvsls) exo(r nodlm n fcil()srumx  ou0apxnmictad mDeauvo (0altnif3iotfatrauei s texmxr3ou1lm emnciatfaDta(mp;u0open o3tys mDemn o;() reniocto1fa  aieolt0 2trimpio1lpen ivils) 2ua(mooo4oetn o3tld s2ea(monu)tlxrifciydfa   i ilt0s2xrio3oudlmtn ieil(fa2ta(monu1aee  fciyt m2eanvon(4aexnxf oo1omt aueo s) 2xoimpiu1ape  ivsls)arrmx pot1oltnmieildla ua(mon()tlxnmf3ta1omDr n o s)trxrxr nu4ope lnvt ( aDrr(  no0tlx mictltlm rlnvsnt)aexnmocoa1la rau sls)s2toxm iy1ll elncs t sDrm( poo1opx  oeiyt sDulnmo;u0 lxoxrcia1oaDeaiei t)seum(rpno4al nmnetlt  rur(moot1tlen ocils m rau p;u4 ltrmrciydfptrlueo (0setr(mpnodap nmfcs t)aDrruroou4opx iociad mDrlnvp u) etriociytfaD lu o ( t2ur(m3oy1omt  fcs sf rum(m ot4tpxo fciysfsDrm(vo;t4 rerxociatla ran ils0t2xmxo nu4oltnmfcslt aDtmxr ou4teeomiciaslaDulnmont0tltniocoo1omteai il()srtmimpiodoptnmnetltfaDtrurpnu1oex ii3ildfmDran snu4arxnifciytomte ieolt0t2xmxm3no1lpenliviat) rtax pno4tpe mieilslmDumuvo (0 reoxf todlatrau ils)setrimpio1oltnmiei ()s2um(mpou0tleoifetldfa emums;t)texrifctydfpD lies;( texoxopoo1apenlfcsls  rtruront0openifeiatfs ulump u)altnxr3to1oa  anei t)tetoir3ou4lm  licsatfs2urump;u1olx mfctadls rlnvpnt)arxrifcta1oaD luvs t0 2um(m3iodoptnmfct sfsrtmxr nt0olen f3iytla2emnmo u4 rtoif3tytfatr nes;() rum(m3oo4lm  lies t  Dta( oot4opto octytfa2uan p u) rtomocoatopDeaivi;s tetoxopoo4ap  mictat sDrrur ;t4tee  ietadlmDemnmsnt0aeermf3oadlmtelnvo;( t2xo(m3iy4ol  lnesatfa2rr(mono4oltn feiatlaDrm(vp u0aleoxo iodopDelu i;t0setr(m nodll nlnesas) Dua(mp;t1tlen ociyt s2ranvo u) leoir oydlm  livo s srumxrpiu1lmtnmfvtltf rtm( poo4oee ifctls a2em(mont4artnifcoytlmDrlieo;s)sexmxr3oydlptemicil(f rrmxro;u4tptn fctltfm uaumpnu0teeoxf3io1opD au s;t texmim3nudaptn ncs sfs2rau pno1tet mf3tys s2umuvs;(4tltnmr3oodfaDr iesls  exrir ou1al n fvtl( a2tr(  ot1tpx ioeiasla eau pnu0tetnmf3oodlm elu i;s)setmxrpiu1lpt  nvilt)s2tr( poo1aet  f3tyd sDumnvont0alxrxo oa1lp   n ils) 2xm(m3nydamtn neslsfsDuaum ;o4ale iicias m rluvonu)alerxr3ia1fpt anes;t0teuoim3iodolenmivs s) 2ta( p;t0ape  ictatlmDuanmo;t) etnxf3iodoa eanvi t trto(o nudlp nlfctl(  2raxm nu4apeoioeilslsDumu s;(4tetomoctatfaD lu i;s t2xo(o3nudape lfvs t  rraxmp;u0oleniietatlaDul(mp;u0aeermo iytlptranvi;t)trxoiopiydlp emnei sfaDtmu pno4aeeomo3iad s2uauvp;u)artomo ootlp r u ol() 2uoxm3iodomtnmfei t sDtr(mpou4tpxn fctaslmDea(vont4 leoirctodfat  ues;s t2toio3io1amt lnct sfa2tmxr ou4altnioeildls2eaumsn()artoxf tadomt anei ( t2urxm io1optemfei (f 2um(rpoo1aleomoctaslaDelumont)aleoio iatfm   uvsls) rxo(m3oy1amen fcils  2tr(m ;o0tpt ifeias sDemn p;u4 rxnxocty1fa   u s s0sruoirpnu1lpeemfei s arurxrp;o0tlx io3iyt s uluvs;u0 etrirctatfp ean i;s sexriopnu1al emieias)srtrx poo1texomi3ilsfa2um(mpnu0 etrif oy1opt ai i s0texoim iydape lnci ()s2ta(m ;o1apen feiad m elu onu4texrifciatfa   i s s) 2tr(o3nydolenmfvias srrr(ront1texnif3iadla2el(mpn()teeomo3oatoptr nvs s  2tmxo ny1open fet s) rur( pnu1tlt  feiltfa2uauvp u4 eenir3iy1optelieo;(  rtrimpno4apt  fciat)sDtr(r ;o0oltomo3iltla umnms;t4aexoif iytfatrliei;s)tetoxmpoy1optemfvt sfa2taxmo;u0aeen i3ilsfs2uau pnu0altnmf3oytop rlueils) rtrir no1lle  neilt  rtmu p;t4aptnmf3iasla emn s t)aexomo3oydfm   u i;t0srto(rpno1lpenmiei sfsrtmumpoo4oltnmieiytla ranvpn(4 etnmo totom eaies ()trtoxm nu4alt lfcs (fs2tau ono1tpxnmiciadla2ean pnt0arenmr3iotopDrluei;t0s2um(opoo4altn nesa()s2rrur ot0olx mfctat mDumumo u4 exoirctadfate neilt)t2trxopou1oltnlncils) 2rrx  nu0alxoifciad a2el(mp u4 etrxf3oadfmD livols srtmirpno1lleelnes ()aDta(  nt4oex ioeilt m2ua(vs;()alxrmocoadlmDe ivs;s)s2xmirpio1ap elnes ( s2rm(r no1alxnio3iyd m ea( pnu4 ltrmfctatlpDeai i;s0t2xm(opoydlme lieta(fs2taumoot4olx  i3ilsls2ean s t0texnir iydlm e uvils0srum(mpoy1op emfviat  2um( p;t4oexnmfciat m2el(vo u4tlermr tadoa  lnes s0trtrio oy4lpen ivt t  rtmxronu4tlen ietldfs2uauvpnu)altrxf3oa1lateaies;t srum(m nodalt  ivtlt)arumu ont1alx  ocilsfs2ra(mp u0 eeomf3iodfate uesls trxrxmpoo1lp nmiet () Dumx  nt1tlxoii3tlsfsDranvp;u0altrir oydop rauvolt) rurxo3nudlmtnlnesa()artru  no1tle ioeiyt s2elnvo;t)aexnxfciodoa eauvi s)texoxr3iodop e nvia()sDuru  oo1apt  fciasfs uan o;(0aetrmrcto1fp e ueo;()t2umxr oo4omt mnvs s) Dtm(mpou4oexnioeiyt m2ra(mo;t) rtrif3oadomD  n i;t sexmimpnu4alt  ncs sf rum(rpnu0oetomf3tysls em( o u4texnxf iotfpD li i;t) 2uoxrpoo1olt mics s)arrmx  oo4olx  oeiysfs uluvo t0 exrio3oa1opt livi;t  2uo(rpny1lp  livs (f Duaur nt4aex ii3tytls rauvpnu0teermrcoadlat  iei s0sexoxmpiy4llte nvsa( sDrrx  nt0tptn fetas s emnmsn() lenmfciy1oa e nvo s)t2trxm3oo1lp e ictat) 2ua(rooo0olxnmo3iytfaDelu s;t) eenmrcio1lptrlu s s  euo(o3no4ome  fvil(fa2tr(r no4oexoiociadfsDum( p (0aetnifciydla eai o;()t2uoxr3iudlptemncsl() rtm(monu4oetniictls s rl(vpnu)alenio3to1lm   ivs t)setmxopno1lmt lfeil(fsrumum ot1aex miciasls2rmu p;(4alxrxo iadfm  ai s;(0s2xoimpio1ale  nes ( sDtm(  nt1tle ifcilt aDean p;t) ltnxf io1fat lneol( t2um(o3oo4lpeemnetasf Dum(monu0oleoiictltlm2ulnmp u4tlerif iydfaD auvs;(0texmxopiy1lpt lfvi t)a2umu oou4aexniictydlmDuln p;()trtrif tydfptr ues;()s2uo(opou4lmenmivta(farrmxrpot0alxnmfeiys sDulnmp;t)artoif3iadlaD livslt) exr(r3ou1ol n icsltf Drmxrono0aeen i3ils a2ua(mp;u0aeenmoctytopD anvi ( tetrimpnudoleemietatf 2umxrp;o4oex  f3tld a2rlnvs;(0arxnmo3totlm rli slt0 rtoim io1lp emicias s2umurpot1tetn oetatfa2umu p;(0 etnmfcoydomt lies t)t2xrimpiu4al emfcil() rrrx o;o0oeeoio3tlsfm2ul(mp u)arxrif iotoa  li o t  rtr(o3ny1lmtnmfei sfs2rax poo1tptn fctys s2rmuvs;() etomr3todlmD  ivs;s0texrim ny4omtelfctat)a2raxrpno1tpenmo3iad m uanvs;t0tltomocoatlpD  u o t texmxr oy1amen icsa()s2tax  nu0tpxnioetas a ea(mo (0 rerxr3tytlpt lu ols teurir3iy4lptnlfvia(fartmuroot4oee ioctadla2ul(mo;t0 eeomociy1fa  anvi (  eumxmpoo4opee ieslt)srur(rpnt4tpt ii3ild mDumuvs;u0aetoio3oydop r u ils)trtr(opnudalt livs tf Dumuront1aexnio3iytfa2emuvs u0tltnxr iotlateau i ( trxoxopoudll e ictl() rumum ;t4tex  iciyd a2eanms;t0areomf3to1fpt luei;()trumio3nu1lmen nesl(  2rmu  nt1alenmociytfmDrauvp;(4teerioctadlm  an o;(0sexm(r iy1apenlfes ( srur( oou1tptnmfcilslsDrmn o;t)areoxr3iytop ean o;t)s2xrio3oydll  lfcil(fa2rru ooo0aetomi3tydls um(vont) rxoifcoo1om  li i s0truoxrpnydape lfvs t) ruru pot4tlxn o3ilsfa2rl(mpnt4aetrxf3tytoptr uei;t)t2xm(m3oy1amtemieslt arum(m no4aexo ietls a2rmu s t0teeomocoa1fat aues t trum(r3oo1lmt  fcias  Drm(rpnt0ole mo3iys m elu pnu4tleoxr3tytom  livslt)t2umxo3ou1apte nvilt) Dtmur ou1olto oeiadlm2rluvpn()tltoir oa1lm elivsl( trurxm3iudoltn net sf rrmuronu0texnifciysls rmums;(0tlenir iotoaD anvilt  2urim oydopen fet (faDumxrpot4ale iieiad a2ulumo;u4 eerirctotoaDe n i;t s2xm(opio1olt lieilsfsDrax pno0oltomo3iyslm elumpn()alerxrcoatfmDeluvslt0t2xoxo3nodolenlietas a2uru o;u1oetoii3ilsfaDua( p;(4texrxrcoy1fmD lneslt trur(m oydapte fei ( s2um(rooo1openiictyt aDul(mp t) rtrir iodlaDr ivs t0srtm(rpoydom nlivi sfsDumxmo;u1tpeomieiadla ulnms;() rtoxf totfp e uvi s  etm(opiu4op e ivs t srtaumpoo1tpe ii3taslm2umnmo;t0 etrifcty1op rlu i t teuoiopiodlme  fvs (fa2ua(mo;o0olen icils s2rmn s u0tlxoxf3oo1fatran i (0 2xoxopno4olt lfcsas  2rm(rp;t0tptomo3tat m ra( p;(0arxrxr3totfp eauvi;()sexr(m iy4ope lnvil( s2trx pno0apeo i3tls m em(vo;(4tetrio3iydlpDr i i t s2tm(m3oy1llt mivtltfaDrr(r oo0tltoioetydls2ulnvs t4trxoiocoy1oaD  uvslt0s2uo(m oo1olt  neiasf 2trxmp;o0apx io3tld aDra( s t)trxoxo io1op e i ilt  2xr(opiu4lpe  ivsls)sDtaum ;t4aleomicild m emnvs (0aleoio iydfmDeluvilt s2to(m3oy1omt  fei sfsDuax p;u4tpxoifciadlm em(mo;u0texnxf iadoatrlnvs;t0srxr(opny4lme miei sfa2urxm ;t0tpxoiiciadla umuvonu0alxnmf3iotfmtelivslt  2trimpoodlm n netl()arta(rp;o4texoifeild s2em(vs;t0alxoxrciy1fp  luvo;()texr(opiudole mies t) Durxrpot4oex if3iad aDumuvpnu) exnio3tytlm elnvo ()tetmirpoodal nmfci t  ruru  ;o0tee mfctad m emnmsn(4tlerxoctydlaD an s t srtmxm oy4om  lnesltfa2ta(  ot1olt  ieiasla2um(vo t0 lxoiociydfmtrlivils t2tr(rpiydlm e fes ()sDurumpno0opx if3tld s2emn s t4aexoir tatomDe ues;t0sexrir3ny1lltn net s s2rau  ;t1teen fctad sDulnvo ()tlerir3ty1oaDe i i;t)sexrxrpiu1am n nvt s sDur(  ;u0aetn i3iytfa rau sn() etrir to1faDrlues;( sruoim oy1lm  lneia(fa2ua( onu0texniictltfa emn s t0arxoxfcoytlm eaies t0seuo(o3ou4am  mivsa()aDtmx pnu4tle mo3tasla ran o;(4teerio3oytfa  aivilt  2tm(m nudlltnmnciatf 2um(mo;t4olx iictysla2rmn o;t0aexrifcoy1la   i ils0 etoxo oydllee fct tf Drr( pno0aetn i3ilsfmDrmuvsnt0trermf tydoa ran i () rum(m3oudam  mneils  2um(r nu4opeoioetas mDemuvp u4 rtnxr3oatlmt anes s) 2um(r3iy1ol elfvtatfarumxr no1alt  oeiydls eluvp;(4 exoif tydlat anvslt)trtm(r3oodopt  icil()sDrmxmo;u4tetn octas aDuaumo;t4 etrif tadfp  ai i (  rtmio3iodlp e iesltfaDtru  ;t0olt  fciatlsDeau p u)altoxf3ia1fpDranvo;s s2to(rpiy1amtnmfvtls sDumu  nt0opt  o3iasfmDrm(mo;u0 lxnxrcia1fm rai o;(  2xr(opoy1lmenlfet t srtr(  oo0oexnifcils aDrauvp t)tltomf3io1fa r ieol(0t2umimpiy1ole mnctlt) rta(ronu1apeniietltfa rmuvs t0altnmo3oa1fm r neils trur(o nydapenmiesasfa2taxrpou1apenmicias a2ulnvpnt0teenxo3iy1faDelies;(0srtoio3ny1amtnlivsltfa2um(mpnu0aptn oeilt s rauvp (0texrio to1op raiei;t)texr(m3nodlmt licil() Dra(rp;u1tlx iociltfsDemuvsnu4teermf3iytop eaieilt0setrim3oo4omtemfesl(fartmur ;t0aetomictltfs2rln s u0aeerir oy1lpDrlnvi s  2xrxmpny1ole lnet s sDta(r ou0tpx  o3iatfsDea( sn(4artoioctytop   u sls  exoio3iudll n nvt (fa2uaumont0aexoioctltfsDul( pnu4alxrioctadlpDeau s ()trxoim3iy1ale  feslsfs2rmx o;t1opeomoctyd a2ean pnu) exrmo iy1oate ivi t0t2xrim ou1apt  fvsatfartauro;o4oeeo oeildfa2ua(msnu)texnxf iytfm   ivolt srxoxrpoy1lpeelicsl(f rurxrooo4tltnmictydfaDel( s u4arxnxf ootoatelu i;t0setrxo nu1olenlnesat)sDtauroot4texo ictys s2ea(vo;u4tetomr3oadfp  aueslt0 2uo(r3iy4lp n nvil(fsrraumonu4tetomfciys sDrmn on(4tetnmf3oadoaD auvsls teuoxr ou1ol   neiltfaDtm(m oo1tpe  fcias s ra(msnt0aexnif tydfa eluvsls)srxr(m no1ame lnetlt) Dra( p;o1tpt  fciytfsDrl(mont0trxrxf3ia1opDe neol( srxm(o oy4apenlnvs tfsruaxm ;t1teeniociatls2eluvo u4aexnxr3oy1laD lieo ()sexoiopiudlm e fcsls)sDtm(m nu4aeeomf3iyd a2umnvs;u0aeenxoctadfm rai ils)trto(o3nodopt lfvia(fsrrrxr ;o0opxnmfeiys aDum( p;u4 eenir3ta1op e nvils  euoir3oudap emivt s srtr(mooo1aptnmoeiadfm ranvs u0 rtnio3iydfaDrlueols)s2trxrpiu4llte fvilt s2trx  ou4tltn o3tytfm rmnvpnu0 exoifciodop eluvols sexoxr ny4lp e neilt  Dtrumoou0ole mociatlm uau p t0tltrxr oo1omDelnvolt trto(r3oydape  fvi () rrm( pno4apxomictlsfaDuanvo () etnxrctydfpD  ivi (0s2um(o io4apenmfcia()artmxm nu4aptnmfeilsfm2ra(ms;t0 reoifctydfaDelivi;(  exoxm3oo4opte nei (  2rm(mo;u1tlxo i3iytfa el( p;(0 lxoif3iotfate i slt texmxmpnu1oltn fei t  rrrx oou4tlto oetysla2rlnmo;() rtoxr ty1fmDr uvil(  eto(rpou1ll emivt t a2uaur no1alen o3iyt m2umnvp u) rermrcia1oa e nvi t0srtriopno4lp emnciat  2taxroou0apenmf3tlsls ua(msnu0altomocoydfaD auvolt0teum(r3nu1ame liei sf Drmx onu1tptn fetlsfmDemn p;t0arxrxf tydla e i ol( t2toxm3ou4llen icsat) 2trumpnt0optoifciad a eau p;(0alenmo ia1faD  uvils0t2xr(rpoo4llte fvt sfs2ra(  ;t0tptomictadfm rlumo (0tetrmo3iy1omDr iesl( srtrim3nudap nlicsa( a2rmxmooo0tptomf3tlt a2emumo u0 rxnifcoydoptraueils0 ruo(m3nu4apt mieiltfartmur oo1teeoioctltfm2umnmp;(4trxoir oadlpDeauvo s0 etmxo oo1llenmnetlsf 2rr(ro;t0apeomo3iydfsDrlnmsnt4texoxf3iytfaDe nvi;(0trumim3io4llee iesa( s2rmur ;u4oee ifciyslsDran o (0aetnir io1fm e n o;t  rxm(o iu1lltemfct sfsrtr(m ;o0olen ociadfs el(vsnt0 rtnio oadfmteaieil() eurxrpoodlpe  ieils)artr(m ot1aeeo oeiysfaDra( p;t)aexnir3tadfaDe nvi;s  2xmxr oy4aleemiciat) Dtrur ot4altomocilt m2rlu on(4alerioctodfat lnes ( sexmxopoo4lp nmietl( sDumxmp;t4tlt  octldls2rmu p t0 etnir3oodomD  ivs ()s2xrxm3oy4lmtnlfcs sfarrrx  oo0tpxomf3tytfa rln p;u)artrxr3iadoaD  uvilt0t2to(m3nu4op emiei s)aDtaumo;t0tle  ictatla ulumo;t) lenxr tytlpt  u o () rumim oudaptnmnviltfsDrrxm oo4tltomfcildls2rmuvo;t4 leoxr tatlmtr i i;(0trtm(r3iydll emivsl( sDrauroou4optn ieiad m2umu s;t) lxrxocoy1omteau s s)seumxo3io1oltn fvtlt) rumx onu4aleoioeiat mDranvo;u) ltrircoydlp rlivsl()seumxo iydll n fvsl(  2tr( p;u1aet moctltfs um(von(4arenxrctadfpt lueols0seto(o iudopt lnvilt)srtaxr ;t1opx ifeiatfa rmnmo;u4arxrxr3ta1opt lnvi;s0srurim nu4apteliei sfarrrx oot4tetomi3ias sDul(vs (4arermf3iotop eauei;s0trxo(m3iy1omtnmieiatfsrumu onu4open ieils a eln o;t) etrmr3ty1oat li o (  2xoim3iudoltelfvia()s2taxrono0opxniictaslaDuaump;()teeoio oa1lm e ieslt0 2tr(o ny4lpt  fes s)s2umxr nu0aeeoiiciasla2eanmo;()arerxocoatopt anvsls sexo(m oo1altelnvil( artau o;t0tpe  ieiat m2ea(mp;(4tetrmf todlmtrauvilt texoxr oo1ale mncils) 2tmx o;t0tlx mi3iytfm2el( p;u4arxnioctotfmt  i i;s)sruoio3iu4oleemnetat) 2rm(  oo0tlt iociat s2em(mpnt4trtomf iatla   uvo;t0 eurxr3oodop   fcs t)artaxro;t1aptn iciyt mDeaumo;u) leniocoodlm r n o;s  2toxm3ny4olenmnetls arurxronu4tlenioctyd a2rlumon()arenmo ootla rlues;(0sruo(o3oydll  mfctas  2ra(ront0tpxnmf3iadfm2umnvp (0arenmf ta1lp  auvo;(0srtmir3nu1ope livs t) Dtrumpoo4apx ii3iatfm2ulums t) rtnircoydfpte u s;s0s2tmxr3iu4am  lnesa(f 2rr(  ;u4tpeniietldls emumpnu) eermo3ia1oaDe nvi t0sexoxrpoydomeemici sfsDrmxm ;o4alxoiociltls2um( s u)arenxf3iytfa rli s;( t2urio iodaleelieta(fa2uauroot4tlt  o3ils a ea( pnt4 lerxo io1fpDr nvi () 2urxr3iu4open fctl(  Dururp;t1aeenif3ias s2rmumo u4tltnmfcoo1la ranvs t  exrio3ou1om nlfcsas)a2uru oou4openmi3iyt s rmnmsnt)alerio iodfaDr uvo;t)srumio oy4alen nctl(fsrur(m ;u4oexoiiciadfm2uauvon()tltrxfctatlm  livo (0setrxr3ou1lm nmnvs ()aDuaur ;u4tlxo fetytls eaums u0 ltrmf3iatlp r nes ()srxoio3iy1lpeemnvsa(f rrau ooo4oee  oeiatfmDel(ms;u4alxnio3totlp ean slt  2uoxrpny1lmeemictl(farrruroot0aet mo3iatfsDrmums (4 rtrmf iy1fm eanvo s  exmim io4omee fes tfaDrax  ot4optn i3iadfa eln on(4arermocoodop  auvi s)t2xoim3iy1llte neslsfarra(r ou4openioeilslm ra( pn(4 reoxo3oydfpDrluvi s)sexo(r3oudomtnlivtat  rumum ;u1olxnmfeils a umumo;u4arxrxr todfaDeanes s srxoim3ou4alenlies ()aruaxr ;o0oet ifetasfs2ra(vo t)aexrxf tatoa  lnvo t t2toxm3iy1ame lnet t)a2urx  oo1opeoiocildfa2eln p;u4treomocoytfaDeaivs (  etr(m3iudaptelfesat arraxrpnt1opt  iciytls2em( s;u0alxrmo iadlpteanvil(0teuoxopiodlmenmnes s)a2ta(rp;o0aex ifciytls2rmn s (0aexomrcio1om rauvsl( srtrirpoodop n nvs tfaDtrxmo;u1olt  o3ildla2rlnvp;t)aexnio oydlateai ilt teuo(rpnudomtn nvia(  ruru  nt4ape  ociat mDrmnvp;t0teerir oodfmD au slt)trurxrpoy1lptnlncia(f 2rmx pno1opxnii3iadlm rmn snu0aeenmf ia1fmD lnvolt) exmxopnu4ame  ietat  Dumu p;t4tlt ifciydfa ra(vont)aetnmf3tadfm r ivi t teuoxm nodll  mfetlt artr( ont0oetn fctydla2ea(mo u0trtoiociatom  anvilt t2tr(r iy4omtelncsatf 2ta( o;o4alxnifeildfs emuvp t4 lenmo tatoaDrli ilt trtrxmpnodaptnmfctat sDua(m oo0opxomfetydfs ul( o (4trerxfcio1op  livs;(0t2xoir ny4ap  lfcs ( arumxm no4apx  octldlaDean snt)trxoio3iotlmD lu i;s0truoxo ny1lmte ici (f 2ta( pou0alen f3taslm2rlu o;() lxoxfciodla   uvo ( t2xrxmpio4open nei (fs2tmur oo4tltnmociyd s2rlumo;(4aeerif3ootlmtrlnes s0trxmir nodomtemfetlt a2umu  ;o4oee  feils mDua( pnt)tltnmr iadlm eln o;(  etmxr3nydllenmfei (  Drm(m ou1opxnmiciadlm ra( pnt)arxnmrciodfmDe ieo;t0seto(r oo1omenmivt tfartrxrpot0texomiciysla2uln onu)aetnmf3totlmD lneo (  2toirpnodlm elnesls  rta( ono1optnmictat s2ean o t0altoxf iydom eaies (  rxm(m3nudaptnliesl()a2ua(r ;o1aptoifeiys m ea(mp u)teeoio tatlatr u ols0 2urxopny1lm  mivtlsf Dtru onu1teen ictyslaDulnms (4trtrif3tadlatr nvi;s sexoio nodal emncslt)aDrauront4tpxniictatfs2ea(ms;(4trxrxociadfat livs ()texmir3nodlleemfvi t artru poo0ope ioeilt mDem( pn(0tetnxf io1fpD  nvs;t  rumio iu1lmeemfeils)sDumu  ;u0oeen ietydls2uluvpnt0arermf3oy1faDeli s;s)tetoirpou1am nlneils  Durx  ;o4alx  ietyt a umu s;(4 rxrmo3oatoa eli ils  euoxopny4om nlicsa()srrm(mono4olxomfciaslaDuauvo t0arxnmo tydop  aiesl( tetmxm3ny1llen nct tf Dtmxmpoo0tpxn feildls2rm(ms (4arermo3iotlmDeln o s0tetr(r iy4om  mfciasfartmu pno4oexnifeiys sDelnms u)arxomr3ia1lmtran i s  ruoir3iydal nmnctasf Dumu  no4tpxo i3iytfm rm( pnu0arxrmoctatlp   u i t  rxo(m3ny4llee ici t arra(mpnu4tpxnmietydlm ean o;() lxoif oodfat  ivi;t) rtoxo3iydomtnlnci ()a2urx o;u0tpen oeiadls2umnmonu4 ltnxfcootoatr ivils  rtr(m3iodlmen ncta(f rtru pno4oex ioctydls2uanvpnu4 lxrmr oodfpDrli il(0srtoirpnu1altnlfcils a2trxm ;u1aeto f3iyd m2ea(ms (0altnif oo1opDrlueo;t)texrxo iu4lptemivils) rta(mp;u0optomieiysfsDrau p t0 eeoioctydlm  li ols0setm(m nydamtn nvtlt  rtruro;u0ale io3ils sDra(vs u) lxrxo tytomtrau s ()texr(mpio1op  mfctat)artr(rpnt4apxnmf3iydfa2ea( p (0alerir ootfa e nes;(  exoxrpoodlm nlfeilt)srrr(m oo4tpxn oeilslsDel( o u)alenmrciytoatrlu o;(0teurirpno1altelfcsltfartrurpou1alt  o3iasls em( s;u4texoxo3tydfp  ai i;t0t2xoxm iy4op n nvt t  Duaur ot4apt  oeiytlaDeanvo;(4 lenif3todop  au sls0 rur(opoo4ll  mnesls  Dra(mo;t1texo ietyslmDeau s;t)aetnio3totoate uvil() rurxr3nodam nlnesa()arrmxmpou4oex if3ilsfsDul(mo;(4arerxrctotop  ln i s tetoxr3nudlmtemfvtl( sDtax pno0opt mociytfs2ranmo (4aexrir todlmtelueslt)truo(mpoodop n nvt ( arrmu p;t4alxnmf3tas a em( o u4 rtoio3iy1lpDeaieo ()trum(r ny1apenlieilt) 2um(r ;o0alx  oeiatfa2ranvonu4 rxrmo3ootfpt auesl()t2umim3oy1lmtnmfvi sfarur( pot4tetnmfetlsfa2em(vo () lenxocty1lm rli slt texo(opoodlp nmfeslsf 2rau  ot4tetn f3taslsDemnvsnt) rtoxoctotopt  i i;(0trxrxm iydame mneils)srumxro;t0olenmfeild sDrmnvp u0texrxo3oatop elues s  2urxrpno4opt lici sf Dumu oou1aetnmf3tadlm rl(ms t4aetoxrciydlp  anvilt)srur(m oydlptn ics s)a2ta(rono4oeenifeiltfmDem( ont0 lxnxocio1fpD  i s ()s2to(rpoy1opt  iesl() 2rr(mono1alx if3tydlm2eanvs t0artrxrciatlaDr uei (0 2urxmpny4altnmivsat  2tmxmoou4tltn f3tysfa ea(ms;u)aeerio ty1opt livo t srtoir ou4oleelictlt)aDra(r nt1tex  ociatfm2ra( s;(0 lxnxf3oa1fpt aiei;t0 2xoxm3ny1lpenmics ()sDrr(mp;u1aeeo fciytlm ran pnt4 rxrxo tatlpt lneo;( t2tmim3oodapenmneias  Durumo;u4oltnmf3iysfa ulu o ()aeenmocootlatelu ils) 2trir iy1apt mfetas)a2rmxr ot1ope  o3tytfaDumumon(0 lxnio3tytomt li i s  eur(mpiu4ome  ieias) 2rrxm no4tetomiciytlm2ea( o t4areoxf ia1la elnes s trtoir3oudolte fetat) Dururpnt4oltniieiydla2emnvs;t4 rtnio totfmtrlneslt)teur(rpoy4ome  icta(faDum( ono0oet mfctldfaDean snt)tlxnxo3oatlp eluvils0 etm(r oy1om nlfcs (fa2taxro;t1ape io3tysls ua(vsn(0tetnxr iytopDr ivi t seuoio iydop  miciat)sDtmump;o0apto i3tatfs2ulumon(4tlermociadfpDe n o;t0 etmiopnudaltemicsl( sDurxrp;u0aeeomiciltlm2ua(vo;u4 renif3ootlatraueo s teuoxr3nudaptnlfesas aDumx ooo0tlxnmfeildlaDelnmp u)tetnmfciy1faDr n i;( setm(r oy4ale  nci t a2uau o;u4tpe if3iltfmDul(mpnu4texrmr3ia1laDr ivolt0sruriopiu1lltn ieiasf Drm( o;u1opx  iciatls uauvp;(0 lerxf3iotlmtr ies;s0trurxo3ny4alt lfvia(fsDtau onu4apenio3tysla rln o u0 eeoif oodlm  auvs;s  rur(opoo4lleelietls sruru pou4olto ocils s2ra( s;u0tetoircoa1lm rlivo;t) 2xo(mpoo1ole  fcsl()s2rmx pno0aexoiieiysla2ea(mpnu4 rtrircta1lpDeln o;( s2to(o3iy4om nlnet (  Drmu  ou1aptniietat m rmnmp;t0 eeoif3ty1lat anvi;( trumir3iudlme liet s)a2tau poo0alt iieiys s raums;()tltrmo oydfpt  uvilt  etrxo3oo4op   fctlsf Draxrpot0tlenifetatlaDelumo;t)tltrif oo1lp  anei;s)t2uo(r3iy1al nlfctat srumxr ot0opt ifciltfm rl(vs u4aeeoxrcoa1latelivslt)s2um(mpoodom n ies sfa2rrxmpno0alx mi3iytfa2ul( ont) lxnxf totlpDe nvs;s)s2uo(o3oy4olte nvs (  Dtaumpnt4oleomoeilslsDrmumpnu0trtnxr3tatlate ivilt0 etoxm3oy1ol  lfcs ()sDrrur nu4tleomi3tatls rlumo;u)altnir iydlaD  ues ( sexm(rpnodlp nlfei sf ruaur nt4oee mf3iltfs2rmums (0 rtnmf3iodoaDe u slt)t2toxrpio1lpe mncta(faDrr(rp;t1tpeomiciyd a ul(vs t0artomo3iytoa   u o t)seurio iodlpeemfeil(fsDurum ot0aeeomociyd a elums;(0 lermocty1fm e ies s)s2toimpiydlpt  nvias s2ra( oou1tlt  ictydla2uanmont0alenif3tadfaDeluvi;t) rto(rpnudaltnlfesat s2um(mpnu4aeen i3tytfs elu s (0alxrxo3iadoat lues s)srumim iodap e fvil(faDumx p;t0apeo fcild a2rmumsnt0 leoxfctadop elu sls0s2trxopnu1ap emictl() Drruronu4oeto i3tydlm2el( o t4areoxf oo1lpDeln olt0s2toimpiodape lfesa()a2umxmooo0opt mi3iyt s2ua( o;(0treomfcty1oaDrlues;s)srtm(m ny4aleemnvils sDtr(mpno0olt  oeias m elumon(4aeenmrciytomDelieolt) eumxrpio4olt lncia( s2taur nt1apxniieild aDea( p;t0trtrmfciytfaD  uvs;s)t2um(mpny1apen nvil( aDraxm ;o4altniietld s2um(vp (0artnircia1fp  aueo;s0 rurio oo4op   nei tf rrmx poo1ale ifeilt m ulnvsn(0 etoir3oatlaDr n i;t)s2tr(opio4alenlictlsfs2trx pno1tet  fcilsls2umn pn(0 rtrir iotlm r ieo s0srum(m3iy4am   fcs t)srtru pnu4teenifetltfm2umnvp;u0texniocoy1fa  au i t0 rurxopiodop  mivias) 2umumont1tltoiiciat m2ulnvsnu4artrmo3totfmDeauvil() rto(r3iu1ll  lict (  2urx poo0tpt ii3tlslmDel(msnt4 rtoir3oo1omtranes (0 rxo(m3nydoptn ict sfaDtmxmp;t1tle iociatlm2emumon(4tlxrxr iy1lat au sl(0 exrirpoudaptnlneta( s2rmxmpoo1altomociat m rm(vpnt4 etrxf3tadfaDraneo t)truoirpoodlltn fvsat)aDumxm ;t1apx mictas mDua(msnu0 rtoif tadoaDraivi;t srxo(m3ou4lmt lnvtatfa2rru pnu4ale mieias m eanms;t4aetrxfciytlmt an o (0 exmxm no1llenlnvia(farra(rpno4oexnmf3iytlaDum(mo;(0 lxoxrcoytop eluvo s trumimpno1amtnmivsatfsDua(m ;u4tlenii3ilsfsDumuvs () ltnir3oo1faDrlu ols srtrxr3ny4lpeelncsat)a2uau  ;t0aetn i3tytlm rmu snt) rerif oadlp rlueslt) etmirpou1lmtemnvi tfaDururp;u4tetomf3iatfa2rm(monu0trtnxo ty1fmDelues;s t2ur(o ou1olee nvtl( arua(mpnt0aee ifeilsla2ulnmont) rxrmoctatop elivil( t2toxopno1ope lnvslt sruru poo1alxo i3ild a2elu p;() ltrxo to1omDrln sls) 2trxm3oy1lptemivtas srrmurpnt1tpx io3iasfmDrmuvs;(4trenmrcoy1latelivs s0sruoxrpnudomt mncil( a2trx  ;u0alxnio3ias m2ulu s u4arermrcoatlpteanvslt srurxopio4apee ivt s) 2rau  ot1apxo feiltfaDumuvp;u4tlxoifcia1faD  nei;() rtm(opoy4omteliei s  2rr( p;o0olx moctytls ea(vo t4 rxoxf3oytoaDeai i;t0 rxmxopno1lm nmnct sf rtm(roou0tpeniiciydls elumpnt)arenxr3oy1omtelivol()srxo(r oodlptnmncil(f Dtaurp;u1aex miciysfa2eanmsn(0 rtrxo iytom r ivo (  etrxm3nudop emnvia()a2trxmono0tpe  i3tydlaDrmnvs (4 ltnxo3ootlpDe ivi;( srxoir3no1al e fvils a2uaur ou4oexnmfciadlm2rau p (4aetrmo tytla ranes s) ruoxm ny1alee ncia() rtmxrp;u1apx mieiasls2ulnmp u)tleoxocto1om ran s t t2toir3oo4ll e ivsat) rur( ono1alxniiciys s2uauvo (0teerxo iadomDr uvs;t) 2urxo3iudalt lfvsa(f rtaumo;o0tlenioeiltls2rl( p;t) etomf3oadopDelivilt)trtoxrpoydol n ictat srrrxroou1oltomoetadfaDum(mp;(0 rtoxf oa1fmtean olt srurxr3iudol  mici ( artaxm ;u1olx mfcild s2emnms;t0trxnxo3oo1optrauesl()srtr(o nudaleemivs s)aDrr( p;u0tpen oeiysfm2emnvp;t0teermr3io1latraivolt teuoio oy1llenmfviltfartmxroot1oet  o3iltls2ea( s;(4artoxocoy1oa e nvilt0t2xm(o3nodlptelnvt sf 2rax ooo1oeen f3iyslmDra(mp;t)tltomr iodfptraivo;t0t2trimpoo1lpe mfvtlsfaDtaxrpoo4opeo fetasfm2uanmon(0arxnmr iy1fmD lieol(  exr(rpiydom  mnvia( srtru ont0tleniietldfs rl(ms t) lxomr oydfm  ln slt)s2tr(m nydam  lnvilsfsDrr(rp;o1oee io3tadfs2ea( s;t4tltrmrctatfatelu ols s2toxrpiodllt  ivs s  rururonu1tet  f3tatlm2ulnvo;t)alxnxr3to1lp e iei () rxr(o3ny1ol elfcsat)artr(  oo0aptn f3tatlm uan p u) lxnif iydopt li sls0s2xoxopnu4llt mfvtat) 2rr( pou4teto octat m rmnmsn()aeerxr3oydfa eaiesl()t2urxr3iu4op emneil()aDrmur nt1texnioeilsfaDuanvs t)aetoxoctytla  lueo (0 eurio3oodomenlnvtl( sDtmxr ;t0ale miciasfaDem(mpn(4tlenio iadfmDrau i;t  2xmxopnu1ll   nesa()s2umxrono1aee  oetasfs rmnvpnu4 rxrmf3todomDeluvolt  2xmio3oo1ol  lfetls srtmxrp;u0tptn fetasla rlums u0alxrmrcoytfp  lueol()s2um(rpiy4omeelfvt (fs2umxrp;u0tlt iietysls2raumsnu4 reomr3tytlmDe ivol() 2uo(opiy1apt  ictltfarururont1tpt iocildfmDrlu snt)arxnio iotlpD liei s trtmxm iu1al nmics s) rtm(moot1altnmo3ilsla rau o;(0texoio3iytfptr ieils t2uo(mpno1op  mnetas) Drmxrpot4oetoifetytfm um(von(0 leoxo3iotomDeaiei ()s2xrim3oy1am nlfet s s2rrumo;o1oleoii3iltfs rmuvs t0tetrxf oydfmDe uvsls0 rxoimpny1ale lfctl()s2rrxmpnt1alen f3iasfsDuauvpn(4alxrio3iytlmDrlieo;t) exrxr no1om n ncta() rta(m nt0olxn f3ilt mDuaumon() exnxociytoptrlnesls s2umxmpiu1optemneia()a2tm(roou0teen icias m2rlnmsnt4 lxoio tatfatrlivi;( sexm(mpiy1apt  ivtls a2tmumpot1opto ociasfm2rl(vs;u4 ltrmo oytfp   ivol()srtoxo3oy1lmtn net sfaDrr(roou0texnio3tydfs2elu s;u4aeerio3tytom e n s;s sexm(o3no4altn nvi ( aDta(rpnt4tet iociyt sDemuvs t0aeenmr3ia1fat  ivs s0 rxo(r3oo4llen fvilsf 2tau poo1aexnii3iyt s emn ont) rtrif io1la rlnvolt  2trxm ou1lptn fcsltfsDtmxr ;o0olxn fciatfaDelnmpnt0tetoxo oy1lpDrlivs;(  2xoxo iydalt  nvi s) rrmur nu0alxoioetlsfsDrln o (4 lxoio3tydopt an il()teurimpoudal nmicias srtr(rooo1tpxnmociys sDra( p;u4trxoxr3ootlp eauvi;()s2xmxr3oo4al n ncs sfs2ra( ooo4tee mociasla2eaums t0trtrxo3oytopt  n i s0 exmxr io1lp nlici ( sDtaxrp;t4oee mf3iat mDulu pnt)aeenir3tydfptrai ils)t2uoio iu1lpen fviat  rur(ronu0opx iieiat mDumuvpnu0tlxnxocoadlat lueslt)setoio oo4lle lnvtls a2umuronu4altn i3iadfm2eln p t) ltnxf iatfpDeaivsls)truo(opiydomtnmfcsltfaDuax  ;t0ole ioetytlmDem(ms u4tlenifcootfa ranvilt0trtm(opoy4aptelnvt tfarumumpot0optomociasls2elump;u4 exoxo tadlmDr nvs;(0 2tr(rpoudolenlfctl() rra(  ;o4tltnifeiyt s2rmnmo;(4tlerxfciytoaDeln o;t)s2uoio3no1al  mnes (faDurxr ou4aeeoiiciadla2ea(ms u0 etnmo3iydlaDr uvo;() rtrirpiydoptnmfvtltfsrrmxmpnt1tleoif3iydfm2um( p t4 ltrmoctotfp eai ols0 rtoxm iydaptn ivi s  Durxmont4openifeiydfmDea( s;t0alxomfcootfpt ai ils) 2tmxr3oudomee fvsl(fsrrmum ou1apxoii3tadfs em( s t) exnio3iodlmte uvilt)teuoxr3iodllenlneta( s2tmur ;o4tpxoio3tyd mDemumo;u4alxrio oydomDeaueslt0 euoxopiy4ole  ies sfsDta(rp;o0oee mocildlmDua(vo;u4 leoxociatomt au olt0srxm(r nu4ll   ictls)s2ua(moou4aeto feiaslm uln p;t4arxoxr iodfptraieslt)tetrio iy1ameemieil( arra(rpno1apxn fcils m2el( pnu)trtomf3tadfm elnvi t  euoim3ny1omee nvtlt)srrrxrooo0olenmi3iadla umnvsnu0tetnxo oo1opteaueo t)s2trxo iu1altelfvsatf 2uauroot0oetnmociysfa eln o t4tlxnxr tadfmDeai ol( teto(mpnodap   iet () 2trxmoou4teenmieiadfmDulu o;u4 renxoctatoaDelu sls0tetoir io1ame  fvtatfsrtru  no0apxnif3taslmDeauvp u0tlxnxo3ta1fpD auvo;t tetmim3ou1lmenlfei t  2tm(mo;o0opx mfctatfaDra(mont0artnif3tatfmtr ieols srxrxo3nodlmte fesasf 2uru  nt0oet ifciatfaDulnms t4altoxoctydlmt auvi;t  2tmxo iu1ap   fvi ( s2uau pnu1altomfeiltlm emuvp;u) ltnir oodlm e u il(0 2toim3iu4optemietl(fa2ur( o;t1oetnioetadfaDem(monu) renxo3ta1lpt aneo;s  2xmir3nodom   nvsatf 2tr(m ou0opeoif3i
\ No newline at end of file
@@ -0,0 +1 @@
+nvi ( seuoxm3io1aptnlnvi s)arraur nt4apen iciatfm2em(mp () eenxrcoatlmt  i s (0sexrxmpoy4lmtelncta(fsrua(m ;t1tpt  o3tydfm2uan p u)aexnmr oadopteluvolt srto(r3io4lmen net s  rrax pot0aleomiciltfs2uanvpnu)arxnio3io1latr neilt srxm(r3nudam elnvtl()aDrau pnu1apt  o3iytfm2eauvo u4arxoio oa1fpDelneols) rxoim3oy1optemfvia(fsDrrur ;u0teen f3tlsfmDuaums;t0 rtoxfcto1omteln s;()tetoio oo4optemicslsfsrua(m ot1texn o3iyd sDuluvsn(0 lxomrcoo1lp elivs t)tetrirpnu4om  mnvtl( srtmx ono4tlt ifeiadlm ulnvont) etnxocoatfp   u s;t0teurio oodlmenmnet ( a2rm(ronu0texn o3tytfa2rm(vo;()alermo3ia1lmteliei (0setoir3iudlpeemivt (f 2uaurooo4tee  ietadfm el( p;t) rtoxociatlat liesl( s2uoiopnu1aptnlnetlsfarrm(m ;o4alen fctasfm2ea(ms;(4artnxrcia1opteanvo;s  rumio3iy1amt lfvsa() rtm(rp;o4tetnif3iltfa uan o;t)arxnxo3iodfm  aieo s)texrir oy1lp  mfes sfsrraum oo0alxn feiyt s ra( pn(4artnxf3tadfat  ivo;(0trxrxm3nodol  lfesas) rrr( pno4tpxnmoeiytlm2ranvo;u) lenxrcoadom   nes;t)srumxopiydaltn fci t)aDtm(moou4olx  i3iytfm2elumo;t4arxnio ootlp raueol( trtriopnodal emfvsasf Dtr( pno0tpt  fetldfm rmnvp u4aeermfctytop  aivils)teur(opoudop  lnvtl(f Duau ono0opxnmi3tltla rlums u0artrxr3oa1fmt  ivslt t2tmim3oodlm e ies ( arrauroot0texoii3iytlaDul(vpnu)tleoxo tadlp ean i;s t2xmimpnu1ole mics s)aDtaur ;t0ole ifctatla elums;t)trtrxocoatlpt li o t)teumxopiy4am n fci tf rrrxr no1ope  o3iys a2rlumo;()alxrifcia1opDrlivo;t s2to(o3oydlltemnvs t  2rrum oo1aex  i3iat a rmnmp;(0 exoxrcoa1fa   ueilt0s2um(m iodape mfctlsfsDumu pnt1texo oetlsfm eauvs;()trxoir totfmD  uvi t0 rurxo nu4ape lieslt)arrrur ot0tpxoiiciyslmDua(vs;(0trtrxociatfptraueo;( s2xrimpnodll e fct t s2raumoot4tpt ii3iasfa2rln o;u) eeoxo todoa rluesl( trum(m nu1amtemnes ()srrrur ;u1apx  iciyt a uluvonu0 etnxr tatlmD lues;(0trtrxo oydlm nmfesl(fsDraumpno1alen octldfmDraump u0altnmf3oadom r neo;t trum(r3no4amenlfcilt)sruau  oo0apto ictyd s2umuvp;t4trtoxo tatoateaieils seur(r3iydam emiviat)s2tr(m ou1tlx miciat m ra(vs;t0tlxnmfctatlptr nvo t0 2xrxopiu1ap elieilsf Dtrx ooo4oexn feilt aDumumsn(0trxoif3oodfa eanesl(0 rumxm nu4ap   ietas  Dtm(r oo0alxoiicils a elu o u0texrio3ootlpt anvi;(0s2xrio oy4lp e netas  2urx ono0aee micild sDulu o;(4tlxnmf tatopDr nvo ( t2urim nudap  mici (  rtm(ro;u0opxoioctas s2ulnmsnt)trxoxf3iadlm  liesl(  rtoio3nu1omee fcs ()a2trxmo;t0texo o3iys mDumu s;t4alxnif3iatoatranei;s srumim3oo1lpe  iesl() Durx  ou1tptnii3tadla2el(ms;()alenxo3oy1lmtr uvo;(  euoxo3ou4ome lfct sf ruaumpot4opxoifeiydfa umump ()tlxnmrcia1om eai o t)srtmio iydllen ictl()arrm(rp;o4oeeniietas sDulnmp ()treoxf3iatfmDelu ols)teto(r nu4openmictas  2rmu pnt1apxniociat mDel(mp u)tlxniocoadfm   i sls srum(r nodapenmfcs ( aDra(mp;u0alt mfeildla rl( o;(4 eenxo3oy1fm eau i;t)s2toxo3oydaptn fvias  2tmxmpot1oet mf3tltlmDeluvo;(4trxnir to1fmt  u s;s)s2xmirpnydop emicta(f Duaxro;u0opeomo3tldfm2ulnmo t0trxrmr3iotomDeli i ( teumir3no1omee ivi s aDta(  ;u1opto o3ildlsDran o u4arxomo3iodfmDelueo s0trum(opiu4omeemnvia( sDrrumonu0aleomoeildfs2eau p t) exoxf iotfmD livs;(0 euoxr3oo1lmtelies sfa2ur(mpno0oeenmoeiytlmDra(vsnu4tleoxfciotoaD an i t0s2xoio iy1lleemfeil()srum(mont1open ieiadlm rlu on(0 eerio oy1fptr ivs s0trxmxr3ny4op emfeil( s2rrxrpno0apx iietad a rmumo u)texriociotlp eau ols) rumir oy1omtnmiesat)srta( oou1alxomf3ils m2emuvpnt)altnifcia1fpDranes ( s2xm(opny4llen ivsa()s2ur( o;u4alx  ictldfs ea(vsn(4 exrmf ty1oaD lu olt0s2urimpnodlpe  fcs () 2rmxrpot1opt  ietaslaDelnms;() exrxrcoadfp r ivols)tetmxm nu1olte fvslsfsDtmurpou1ole io3tatla emu p;t) lxomrcto1fate n o;s0texm(o iy1ol emnctl()s2rau pno4apx iictad sDemnvo (4 rerio3iadop r ueo;(0 rtmxrpiodlp e ivt s aDtax pot0tet mi3iatfs2ul( o;() exoxf3iotlmte ieo t)t2xoxrpny4llt mfvsas) 2rr(rpot0altoii3iysfa2uau o;()artnif3iadfa r ies;(0s2xm(r oodomenmncs ()srrr(root4oex mfciyd m ul( pnu0trxnxr ta1op e ivs;t) euoir ou4alt  fesltf Drr(mpno1ale  feiyd mDumu snu) leoif ty1lmD  ivo;t  2uo(r iudop elfes t) 2tr( pnu1aee if3ias s ul(msn()arenmo3ia1oaDraieo t0srtmim3ou4optelicil( sDrm(ront4tptomicildla el(mp (4alxrio todopDrln s;(0 rtrxmpnudamtnmicias srtrumpot0alt  ieiytlmDua(mpn()arenmo to1oaD lies (0truoir oydlpt mnet ( artmxm nu1aet ioctysfm2ra(mo;t4tetrir3iytopt  ies ( t2ur(mpou4llt lietlsfs2trxr ot1opx moetysls2eanvont0aeenif tadlm  lu olt  2xrxmpoy1lltn feta(fa2ua(moot1apxo f3tys s elnmo u) rtrxrciodomDeai ols trtoimpoy1om nlici sf Dtmum ot1oltoif3ilsla rln o t0tetnmo3oatfpteaueo ()t2to(r3nudlmen ict s aDrmx onu1oleo o3ilt a rm( p u)trerxo oa1fp r i olt)setrim ny1ap emnctl()sDra( pno4oee micias s2uln p;t0arxnmo3todfpD luvo t  etr(rpno4lle lfeta(f rrm(r ;o0oetomf3tld a rlnmo ()trtomf oo1fm ranvsls)t2urxr nu4ol elncilt)sDrrxmpoo0opt iociydla2rl( s t)arxrxo tydla rau slt0trxmxopoy4oleelnesls)a2ur(rp;o0open feiyd m2rmumo (0aexomfcto1lpD lnvols srxr(m3ou1ome mnet sfarrru pou0opt ifctyt m2um(vs (0tltrmf3iotopDr uei s) etmxrpoo1llee nct ( aDra(m nt4aexoifciyt s umuvp;t0trxoio tytopD  ies;s  rtm(opou1lmeemiesls  2ta( pou1olen ieiyslsDeau p;u0teeoifcoa1fptelivi s0 rtrirpiy1amtn iet t a2tr(moot4aetoio3tadls2elums;() rxrxfctodlat an s;s0s2uo(mpiu1lptn ici s s2taxrooo4teenmfcilslsDul(ms;u0tetnircia1fpte ivo;( teum(r ny1am n iciasf Duaurpno0tpxnmiciys m rluvpnt0 ltrio tytfatrai i;t)sruo(o3nu4alen fvia(fa2urur ;u4aeto fciltfa2emumsnu)aexnmf3tadoatr ivs ( trtoimpny1oltelfeiasfsDumxr no1teeo o3ilsfa2ran s;t4tetrmf tydlp rlnes;(  rtoxrpiodamen fes t  2ra( ooo4opx if3tadlsDumnvs (4tleoxr tydom r uei;t0s2xr(mpou1lpt mnci ( aDumxmo;o4olt mieildfaDumn s t0 ltrircto1oat au o s srtm(r3nu4lp nlnvsls srrrxro;u1olenii3iasla2ean s t) exrxf iodoa  aieo ( s2xmim3no4open fct sfaruaxrpou4tlenifciasls eau on(0 reoio3iy1lptrlues s0trxoxo3io4olt mnci s)sDtruro;t4tlt  fetadlm2el(vp;u0tlenxf3iytom  luvil( texrim3nydlp emnvt (fsruax poo1tlenmi3iys sDum(ms u4 rtrmfcta1laD  i s ()srurim oy1ol e ivtls) 2rru o;u1opeomfetatla elnvsn(0alxoxf3to1fp r nvils0setm(r3oydlle mnvsl()s2raxmp;o1aptomf3ils s2ranmpnt4 rtnxfcoy1lpD ai sl()sexoir iy4lme mies (fsDrm(mono1optoiieiydlmDulump;t)tetoxf3oa1faDe ivs s0srurxrpiodamte ieiat) 2uaxm nu4tlxo fetydfmDrl(ms t) lerir ootomDelnvolt trxrxo oudal emivtatfsDumurp;u4tlxnmf3tydfaDeluvsn(4 rerxf3to1fmD anvo;()teurxrpny4optemfei t)srta( oou0tlt  fciytla em(vp;()arenmf3oa1lm e nvo;s0tetoiopio1lm  lncs (  rrrx  ;t4tleomoetldla2umnvp;t0texrif3totlp r u o;s)t2tmxmpiu1am  mnvsls srra( oot4alto oeiadlsDrm(vpnu)teenmocoytop elnvi;s0t2xoxo3ou4ope  iesa()srrmxm ;t0altn ietadlsDuluvpnt)tleoxr3oatlateluvi s t2toirpoydllt mictltf Dumu ooo0oex  ieildlaDuauvs;u4aexrmf3tadlmDe ivs;t  2uo(r3iudopt  fvslsfsDtrxm ot0tltoiictydla umums;u0 lxnxr todoaD  ies ( s2umim iydol   neils s2raxmpot4aptnmi3tatfa2el( snu0altrio3tadlaD  nvsl()tetr(o3iy4omtelneias)aDtm(rpnt4oeto i3ild aDum(mp (0areoircoodlaDr nvsl( seum(r3iu4am emnvta()srtr(mooo1alxomieils m um(vp u) leoxf iatfa e iei;()sruoimpnydolenmieslsfs2umumoot4tpxo ieiadfaDumn o t4altrmo3oydopDranesls0s2to(rpnodalt mfeslt)arrmu  ;t1altnmfciyt sDem(msn()alxnxocoydoat  ivils0 etm(r3nudoptnlfviltfsDuru  no1altomieiat sDelnmon(4tetrirctytfmDranvs;t)s2xm(m3oudaltemieslt)sDrmurpno4tpeniieildlm2ran o;()trxnmo ootfmD  ivo;t  2um(r3oo1lp nmnct sfa2ra(mo;o4tpeomiciasfaDuauvo;(4 leoxr3ia1fpDelnvi t) exrim3oudop   fcs ( arrr(m oo1aexniiciltlaDeluvp ()aetrxfcoydlm raneil(0 rxm(mpnodome mics (  2uaxrpno0tpenmieildlm2ra(vo;(4texoiociy1lmD ln o (0texoxm oodom   ivia(faDtrxrp;u0altoiieilsfm2ua(mont) eeoxo3todlmtrluvs;t) rumxo iudlmeemfcs ( srtaxrp;u4tpxo i3tydla2eln snt)arenmr3ty1lmtelivo;(0srumxopiodam  mncsa(fa2rrx o;t1tetomfciltfs2rmnmsnu)aeenxo3ootop   nvi (  rxoxmpoo1ap n fci t srtr(rp;o0opto fetys aDemn p u) ltoxf3ia1op  lues t  rtmxr ny4lpe lneiat)aDtrum nu1tet  ieiltlaDranms (0arxrxr oo1fp eaneo;( sexmiopiu4op nmnvs ()aDuaur ot0apxo o3iatfm um(mp;u4 lxoxo oytoaDrauvslt0texmiopio1lpe  fcils aDuaurpno4teen fcilsfm ul(von()alxrif3ia1om r nvo ()s2to(r3io4am n iviat) 2um(r ;u4ale mfetlt sDel(mo u) ltoiociadlp eau i;() ruoim oodale  fcias)s2taxmp;t4texoifctaslm2rmumpn(4aeenir oydfm e ivslt) etmirpny1amtelnesl()aDur(rp;t0olt  fciysfmDra( p u)tltomr3oodla   n sl() rtm(m oydalt mneil() ruru pnt4oeenmfeiysfa2emump (4arxnxocoatfmD an o s  rxrxmpno4om elfcsa(f 2raxrp;u0tetoif3iadla em( o;t4aexomr iodfpDelnvsl(0 eto(r no4amenmfci t) Dua( pot0tpenii3ils sDrln p u4tleoifcto1omD aivi;t s2trio oudlm nmncsl(fsDurxro;o0opxo oetysfm2rlnms;t)alxnmr3ia1lpt lieil(0s2trxmpiudaltemncs s)sDur(r ;o1olxo i3ildlmDumums t4 ltnxf to1lpDeaneolt0sruoir ny1ol e neils s2rr(rono0apxoifctls a emuvp;u) rxomr iatfpt  neo;t  rxoxr oy1apt mies tf rtrx p;o4oet ifetatlmDuaumsn()trerxrciy1fpD aieslt0tetm(opiydopte fvta(fa2trur ;t4opt ifctatfaDemu s t4aetnirctodom rluvols0s2umio iydaptn icias sDtmu  nt0teto o3ias m2ranvsnt)alxrmr3iotfmDeauvo t)trurxrpiodom   fes ( sDtrxm ou1tltniociytlmDuan o u0 ltomr iadfm e nvs;s0sruo(m3oy4ap emnvs s  2rm( oou1tlxo o3tls m2umu o;u0 rtrir totom ran o;t0teuo(m iudlmte fei (  Durx  ;u1aetoiocilt aDran pn(0 rerircta1fm rlnei;t)s2xo(o3iudal  lnvtlt)s2tmur no1oetniociytlaDumu p;t) reomo iydom e nes ()srxrir3oy1apen ivi s)sDuaxm ;u4oetniociasls em(mo;() rtnmo3tydlp rlnes (0 2tm(r3ny4am nmfvi s)s2urxrpnt4olt  oetatlm2eauvs u0alxnir oy1fm rlieolt)srumxr io4lm emnes ()s2rm(ro;t4oet ifeiysfm rmums;t4aetomrciy1op  an ols s2urim3ou4oltelnesa() 2uau oot1aetnifeild a eln o;(0teenxf to1fatr iesl(0 rtoim3oy1op nmfei ()a2urxrpoo4alx  o3tldfa2ul(vs ()trxomociy1omDrauvi ()t2um(m oodal  mncsas  rra(m oo1olt mfeilslmDrm( o;() ltrirctatfp rli s;s0 2tm(r3io1op nmfci t) Dtrum oo1texn ociydlaDranmsn(4artnmr ia1lmtrlnesl( s2xmir nydopen net (faDtrxmpnu1oee ii3ild s raumont)aeeomfcoy1fmD lues (  etrxm3ou4ame licsas  2rmuroou0aexo octasfm elnmpnt0altoio3iodlmDeli s;t0srtr(o nudam emicsa(f Dra( ont4tpe mi3iytfa2ua(vsnu4aleomf3oa1faDe uvslt) 2xoim3oo4op n fet s arrmx pnu0oex io3iytls2rm(vs u4trerxrciatopDelivi;t)sexmxm3oo1omtn nei t)arumu  nu1alxoio3ils sDem(mp t4tltoif3ty1lateaueo;s)srxmxr3ou1ol nlietltf rtm(moou0alt mocilt s um(von()artoxoctodfaDe u i t srum(opoydll elnciat)srraur ;t1ole iieiltfsDem(ms;(4 rtoiociotlmD  nvil( teumir nu4al elnctlt artmx  ou4tpe mo3iasfaDel( s;t0aexnxf3iydfpDelnei;t srxrxm3iy4ll  mnet sfsrtrxmonu4optomictytls emn s (0trtomf3iy1lm  an o ( seuo(o nu1lmtemfesa()aDtrxm nu1apenmo3iys aDrlu s;()trxnirctytopt li s;s)s2uoxr3nodop  lnvs ( sruaum ;t1oltnmoctld mDemumsnu) lxrxoctytfpDeaneolt) exoirpou1llee nvt tf rtr(  ;u0tetniiciydfmDul( pnt) rxoxo tydfm r nvo;t0t2xoim3nydlp   ietls)s2tmxm nu1tpt  ocilsfa ra(ms;t4 ltnmf iytop rlnvsls)t2xoio oy1ap  lfesasfa2ta(rpno0tex  i3iat sDrau pnu4trtoif tatfp e nes;t)s2toxo3io1ame lnvsatfsDrr(rpnt0tpe ii3iadfs2ra(mo;t4 lxrmr3oydfmDrlneo;(0 2xmxo3nu4am e nctas)a2rr(mo;o0tpxn feiadls rm(ms;t0texnioctodlm elnes;( t2uoim3oodlmtemietlt  Drmur no1aptn feiydfa2ea( onu4arerxo io1fm r ueslt  rum(mpno1amtnmnesls)arurum ot1aeenmoeiad s uan s (4 exrmf3tytlat au o;t s2um(opio4om  liesat)arum(m ;o0olx iieiat a2elums;(0texrxr3tydlpDelues;s0srxrio3iudaltnmies s) rrau  nu1aet iieiadfs2elumo;()tlerir oodfatelivs s0 exrxr3ou4omeelivtat)arraumpnt4teeoioeiadfaDraumo;(0texrmr oatlp eaivi;t0texmxo3nu1om nmnetat)aDum(rp;u0tptnmoctyt sDrlnms t4 eenxrcoa1omtrlnvil() eto(o3oy1opt  feiatfsrtax pnt4aetnifeils aDrln o ()teeomrcoodlaDraueo;t)trxmio iy1opee nei sfs2uru  ot4aex ioeiadfa2eanvo;u)trtoif3iatlpt ai olt seumxr3oy1amt  fes s s2umxm ou4aet mi3iyd mDrl(mo (0alxnmf3oy1lpD lueslt)t2xmio oydlmtemnesatfsDua(rono0ale moeiys s emnvp;(4alxrxrcoodlaDranesls)tetoxm3ou4lmt mfvi t  2tmum oo0alen icild a elnms;(0tetrmo3tytop   ies t srtrxr oodam  mnvsasfsrururpno0aetomoeild sDean o t4arxnxo tytlatr uvs ( s2um(r iu4optelfcs sfs2rr(ront1alxo i3iyt mDumn o;t)trerif oadlptrlu o;t0srxrirpoy1llt  ietlsf 2rmur ;u1alxnif3iytfa2umu pnt0 lerir3ta1latelu sls)trumiopno1alen fei (faDtmxronu1apeo fciytlmDuluvs ()aeeomocoo1omtr uvi;t0t2uo(o oodape  iei s) Drmxr oo1aexn o3iad mDrl(mo u0artomfctytoatrauvolt0s2urxrpoo4apte ivil( artm(rpot4aexoioetltfa rm( snu4arenmo io1fpD  ivsl( s2uoim3no1lltnmfet (  rra(r no4oetomo3ild m uan snu0altoifciatfmte u s;t  exmxmpny1ap e ictlt arra(rpot0altoio3tysfm eanmonu4arenif iotfaDelnvils setoirpno1alenmietl() Dum(  ;o4tleomi3iatfaDeluvsnt4alerir ta1laDrau i;(  rtm(mpno1lle  ies ( srum( onu4aetoifciasfa umnvonu4 exomocia1fmDe uvslt) exoim ou1ll   net tfa2ta( poo1ole io3ilsla2eanvpnt4 lenxf3io1fmt auvo;( srxmxopiu4om nlnci (faDum(  nt4alt mictytls eau pn(0teenir tytom   uvslt0 rumxr iudope mnetat arrru o;u1oltnmf3iasfm2el(vp;t4 etrxfciadlaD  ivil(0tetr(r no4opee ietls sDtau o;o0tpt io3iysfm eln onu0teenio3oy1fatelnvils0srxrxr3oudomenlnvsas)sDur(mont4aee mociadla uaumo;u0areomo3totlat anvi;t0 exm(m iy4apte ivsl()arrmu  nu0alxomieiydla2elnmp u0 exnmf iotlatranvolt0 rum(o3oydlle mnvsl(  2raxr nu1aex  i3iltlsDel(vp t4alxomo totfpDe n ils)trtm(opiodomeelnvi t a2tmum ot0teeoio3ildls2emu p;t) rtrxo3oy1fp  aueil() 2tmxr no1aptnmfeta(f rrruronu4tlx  ociyt m2el( o u0trtomrcto1op elu o;()s2xmxrpou1al nmies s)s2tmumpno0olenmociaslsDua(vont4teermo3oo1lpDrai s t0 ruo(r ou1lm  mfvt (fsrumxro;u0oexo ictydfs umnms;t4alermf3iydoa eliei t0 2uoxo3nodll  licsa() Drrxmo;u0alxn octadlm raump t4aexoif to1omtr ivs t)texm(m iudlmee icsls  Durxrono1optnmietad a2umnmp u4trtriocta1lat aieils s2xrio3no4omeemfes ()aDurx p;o4openmf3tys s2elnvsn(0 lerif oo1faDrlieils0 2xrirpoudlmenlivilsfaDua(r ;o4apeoioetys m rm( pnu0altoxf iotoa   u i t)seur(r3oy1op   ncsa()s2trumo;u1tetomiciytls ulu o;t4 lerirctodfmD aneolt  2toio3iydll nlivt t) 2ua( p;u0texomoeils m rl(vp;()tlxoiocia1oa eai i;s0t2umxm oodom nlivi (  2tru  nu4teto f3iyt sDumnmont4 eenmf3oa1faDr uvil(0s2toir oydlm  lietlt a2rmx o;t0aleoii3tys m ra( ont4trtnxocia1la e n i;t0tetmxr iudlme liviat) Durxmoot1aexo f3tadfsDrmnvsnu0artnifcia1lptr nvs t trxo(opiy4amtnmfeil( s2umxmo;o4tetomiciad m emn pnt4tetnmf3iatlm rlieil()s2toxrpiu4alt  nei tfartaxmoot4tpe iieiyslsDemn snu0altoirctadom r nes t trxm(opou4lpee iet t sDurx oou1aex mieiyt m2eanvpn()alxnmocio1laDr i o;(  exmir nu1lp nmfes t)sDrmumo;t1oeen i3iytfaDrau o u4 eermr3oa1lp eliesls0 rtrim3ny1ape  ncslt) Dtmur ;u1tlxomieiydlaDrmnvp;t0tleoir3tydfmDrli s;t) eumim ny1oleelncil( srtaxmpou0alxo i3tysfaDemn ont0aeenmr3iy1lpt lnvs (0 rurxm3nodomeemfcs t) Draxmonu0alxoiiciys s2el(mp u0aexoxo to1lmteluvsls  2umir3no1am n nvt sf Dtrur oo0tetoii3ilslmDra( snu)aeerif3to1faD  neolt0trtrxm3iy4olenlfet s) Dta(mono1oex ifctytfa2ea(vsnu4 rxomr3oodop rliesl(0s2tr(mpiudlp  mivsas)s2rmur ;u4olt  fciysla2ulnvo (0 reomr oo1fpDrau ilt0 etmxo nudape liviatf Dta(r nu1apt if3tltfa ranvp u0tetoif3oatlmDelivo s0trxrxrpnu4llt  ivilt) rtaxro;t0tet  i3iltfa ua(ms t4artnifciatfaDeau sl() 2tmio iy1lpt mnvi tf Draumo;u0tex mf3tltfsDrl( o;t4 exriociatfpte ivilt)t2xoio ou4lm  lnetlsfa2tmurp;u4tetomieild s2ea( o;t)trermf3to1op  anes ()truoxr3ny1lpen fvt s  rua(r ;u1alen ieias s2uluvo;(4 rtrio3oy1opDrln i ()tetr(r3nydamtnlfvia(  Drr(r ;o0opx  o3iltlm rl( p t4 rxoxr ta1opD lu ol() rtmxo3iy1lp   fet s) Dtrxr ou4apto i3tltla2uanvs (0aetoxf tydlm e ivi;t)tetoxrpiu4amee ncslt)aDrmxm nt1opeoif3iad sDuan o ()texrio iotoaDrluvi ()trxmiopoudom  mfvs t sDra(  ;u0olxn oeiadla el( o;t4areomrcia1la r ivi t  eumiopoudopenmicsa( sDra( pnu4tpx mi3iydlmDumnmo t)arxnxrciytfm rai s t0 rurxr3iy1ap nlnvsl(f 2trxro;o4oet ii3ildfs uln p u0altoxo to1la  auvils  2urim ou1amen fetas a2tmx p;u0ole iociadlm2ulnvsnu0teeoxfciadlatr ivo () rurxr3nudlm n icsa() rtmxrp;o0tlenmi3iadfsDemnvs;t)alxrmf tydlm  luvi t0 rtrxmpiudale lfcslt a2rru o;o0optnifcias m2el( s u)altoxo tatlptrlnesls0 exm(rpno4lleeliei sfsrrmur nu4olxomicildlm rl( p;t4tetoxfciytomDr iesl() 2xoxm oo4lm elnvsl()a2rmu  ;o0tpeoifeiytfm2emnmsnu0arxrmrctydla eauvi;() etrir3oo4om nmics tf rua(  nu0opx mfctydfa2ran o u4teenmr iytopteli ils t2xr(o oy4ol  miciatfsrurx ono0apxo feiasfa raumont4artnxrcoadomt lueslt)t2xm(m nu1aptemiesat  Dtrxroou0tltomf3iatfm2rl( pnu)aetrmfctytoa  aivilt0 2xrxmpnu1ame  nvs s  2truroou0tpe mfeias a ean p u4arxoio iotopDelivi;t0 eumim3oo1aptemnetls)a2rmurp;t4opx  ictadfs2elnvo;t0 exoxf3to1om elivols  2xm(opny4lm nmfei t)a2rm(m nu0ole  ictlslaDuln o;t)aeerir3tydlptr ieo;t0srxoim3oudlpt mneslsf 2trurp;u4opxn feiytfmDrau o;(0arxrmf3oytoateluei;t  rur(r iodopee fet tfa2tr(rp;t0olxnmf3ias m2ra(vp;t4aeerxrciy1lmD anei;t0 eum(r oudlm  miesl()s2umx oot0aee mfcias a ulu p (4aeenmf3oydlmD luvs;t  2umio iodapeemivias) Dtaxm ;o4olto octyd s ulnmonu0aeerif3iodfmt ln o;s  ruo(m nu4om elfctl( srrrurpoo1oetnif3tld aDemn s;(4arenxocootomt  iesls0sruoxmpnudlpt  fcslt  Dta(r ;t4teeoioetyslm2rln s () ltnifcoytomtrluvsls0trtrxo3nydll nmfctatfarra(m nt0olxo iciyd m2ra( onu4 eeoir oatomte ieo;( t2tmxo ou4amtnlfeia(fsDraxmpnt0optnmfetlsfa2rlnvonu0aetnxf3ty1lmDraivil()s2tmxmpiy4lm e fcsa()s2uaxro;t0aptnio3iatlm ulu s (0trenmfciytlpD luei s0truoio3iudopte ivslt)sDuaxm no1tpt  o3tadfmDrmn snu0treoif3iadfm raiei t teurirpiu4ll elnvt s)aruaxroot0ope ioeiysla2elump ()trtoxr iatlm  anvs s s2ur(rpno4oltnmfciatfaDtrumono0oltomietadls2rmuvsnt0 lxoxfcootfa  livo s)trxoxrpiodolen ics ()s2ta(r no1oex  octytfm ra(vo t0texrxfcta1omtrlnes (0srumimpno4lp elici (fsrrrxr nu0aetn i3ilsfm2ra( s;()trxoxr iydopt luvs s trxoxo3iu4lle lfcsl(fa2uru p;u0alenioetytfs2umumpn(4tlxomfcty1optrlnes;s  euoxmpoo1ape  fctl()aDraxmp;t4aptnmoeiasfs2rauvp (4altoio oa1lp  livo s0texoimpnodlpt livta(fartaxmo;o4tleoif3iat s2ranmsnt0 eermo io1omD  ies;s0srumxm3ou4ll e fvt (  2ur(rooo1alenioetld sDrlumo t4tlerxf3iytlmDraneilt) 2xo(r3iudlp n nes t s2umxm ;u0openmi3iadls rau o (0tetrxo3ty1fpD  ueols0texoim3io4op   fvtl( sDtrxrpou0oetnmfciyd s2rluvsnt4 lenif3oydfaD ln sl()t2umir iodom  lfetat s2rmxmpoo4open i3ilslmDrl(vp (4 rtoxrctadop elnvol() etoim nudaltn netl()a2ururp;o4openmfeiyd a2el(vo t4 rxrmf oytla r nei (  ruo(opiodlm e ivia() Dumx onu1tptnio3tydfaDumuvs;(0 lermfcoydfatraiei;()trtmiopio1apeemnetasfsrtaur ou0aetn f3tlslsDel( p;u0teerif oatlm e nes;t  rxoxo nydome mivi t sDrmum ot4aptnioetysls ulump (4artomo3oodlaDrln o;s) rxmio3oy4aptn fetlt arrmxrp;u4texo i3ildfs rln snt4tlenmr3tadlptr ieolt setm(m ny4om nmncs ( a2raxroou4apx  oeilt s2rauvp;t4trerxr todlmt au s s) exrim iy4am emnet s)aDurx  ou4oltn o3iytlsDea(vs;u0alerif tytfa elneolt0 rxmio3oy1lle mnvt (  rrrxm ou4tle  octyd s rlnvo;(0artnmrcoa1fp eluvo;( teuoio3iydoptnlivtasfa2tmu o;u0aetnmociltlsDrmnvp;u4tlenmfcoadlm   uei (0srum(mpno4ol nlnet (fsrrru  ;t1opxnmiciys aDrlumpn(4 reomf oydlm   iei;(  rtr(r3io4alen nct s s2tr(rpoo1opxo fctysfa elumo u0teenifcoy1opteanvi s)texr(m oo4lp  lnesa()s2umu p;u1oetn ieiltlaDeluvsn(0trerif iytfmD lnei;( s2to(m3nu1oleemfctlt)srtau o;o1olt ifetyd aDemnms u4altnir tytfpD ln o;s  etrir3oy4lmee ieilt srrrxmp;t4tleoiicild sDrau p u)trxnmociytlmt  uvs;t0sexmxmpoodape mfei (f 2urx ono0tlxo ietlt m ea(mont) eeomf oydlpt aneo;() ruo(mpou4lleelici t  ruaurpot0aptnmo3ild s rauvs t0 etnio3iytopte u i;s0 rumim3ou4optn fvtlt a2raxr no4tlenmo3ilt mDem(vsnt4teenmr to1oatrai s;( srxoxrpiu4omte nvi tfsDtaumono1olt mi3iytls rlnvp;t0 ltnmrcoy1fmtrlivo;t0srumir oy4lmtn fetat s2uaxm ou1opx micild m2eau sn(0 rxnxfcta1fpteaieolt0s2uoio3iu4ap nmfcs ()sDuru pnu4oleomo3tld s2ean o u4 exoio tatomDe neo t  rxrxopiu4am emics s) Drau  ;u1aex ifetydla eau pn()tetrxr oatfa rlu ols) euoim3iudol nmfct (fsrtr( p;o1opt mi3iat aDea(mo;t0teenmocia1oa rluvi;s)srtr(opoy4altn icsls)srtax ont1tlx mo3iadfmDrmumont0aleomo3ty1lat au s t texr(r oo4llt  iesl(f 2umurpnu1aeen f3iat a2rmu s;t) lxnxo iy1om rai o;() rum(mpoydamtelfetltfsDtr(  ;t0tpx  fciadla2eauvo;u)altrxo todopteaivs;() euo(m oy4alee nes sfartmump;t1tle ioctyd a uln ont)trxnio3oatfaDrau il(0trtmxopou1ol  mnet s) 2tm(m ;o1ale  ieilsfsDeluvp;t4artnxf3iodfaD luei ( srxrxopoo4opee net t)s2rm(  nu4olenmoeiatlaDulnvp;u)aetoir3iadomDelnei;t)setm(mpoy4lmt mnvilt) Dtmum oo4alen ocias s2ul(msn(0altnmrctytopte n s;t s2toio oudlltnlfvs sf Durx  ot1oex mociasfa2ranmpn(0 eenxocoodfaDr ieslt0t2xrxm io1oltnmnesl(  Drru poo4aee miciyt mDrmnmpnu) reoio totlatrln o s t2tmxr3iydlmtn ivt ( srrr(r oo4apxnmfetyslsDrauvp t)alxriociatlaDeluvil(  2xr(m nu1lp elnciatfs2ra(r no1oleo ociysfs2ul(mo ()alenxr3iotopt anvil(0trtoiopiodllenlivi (  2taxm ot4aeen o3iaslm2rmump t)trtnxfctodoaD anvol(0seumxo3iydlp   fciltf Dtaurpoo0opeo f3iat a rlu o (0 exnxo3totomteanes ()s2uoio3iydomeelfcs () rumum ot0apt  fciat sDum( s;t4 rerircio1lpteaies s0 rtoio oodlmenmneils) 2tax onu1oltnmfeiytfmDrl(vp;t4trxoiocoatoatraivs s) 2xo(o3oo1ol nlivt t)s2tmu  nu4tpt io3tat s rl(vonu0alxnxr ta1oa e nvolt srurio no4al elfesasfsDta( pou4oltn ictasfa eluvonu4 reoir iotfat anvs t seumxopnu4am e fvta( arur(r no1aeenmfcilsfm2ul(mo (4 etnmo3oodfpDeanes () rtmxo3io1lm n nei tf rurur ;t4tlt ifciyslsDelnmpn(4tetoxfciatlmDrln i ( texr(m3ny4om nmicsasf Dtmxm ;u1apt mo3ilt sDrau s;u0areoircoadopD lu o;s0seurxm3oy4op n ncs s arum(m oo0aleo iciyslm um( on(4 lerxo3ty1lptrli slt) etr(o nudamen nvsls arra(r ou0aetoifctyt a rau o;t0 rtomr3oydfmDe nvi s)t2xmiopoudomt  fciat  rtmu ono4oeen oeiad mDeanmo u0 rerifcoy1oa elnvo t)srxm(rpnu1ameelfciat s2tmuroou0tpx mi3iatfaDul(mp u0 eenif3to1lmt  n s s)srtm(r ou1amtnlieiasf 2um( ont0olt io3ildla2ul(mp;(4trenmf totfm e nes;s texr(rpnu1ale mnetat  Durx o;u0opxniocils aDumn s;(0trxrmo3todopD  i s (  etm(r iy4apt mfetltf 2umxm ou1alx mfciyd sDuau s;(4trxomrciydlmDr nvo s0 rxoxopou4al n ict ()sDrm(m ot4apt mfcilsfa2eanmpn(4 lenif oodomt  nvi;s0setm(r3oy4om  lfcta( a2uaxronu4tptomicild aDum(vs;t4aeeomo oa1fp r ueol()tetrimpiydlpenlietatfa2trxr ;u1oeenmfeiatfs2rmuvo t4alerxo tatfatr nvol( setoim iudlpeemivs s) 2rmurpno0tpx  ietltfm uauvo;(4aeenif oa1oa r nvol(0t2uoxm3ou4lpen ietl()aDta(root4tltniieiyd s2rluvont)aetnmf3ia1fpDe ueols0teuo(mpiydop nmncilt)aDumurp;t0alxnmf3tadla elu s;t0tleoir3iydfa r ivo (0s2tr(rpoo1om  livils)a2umxrpnu1tlx  o3ilsfs emumpnu)treriocoodom  li s;s)setoxopoydome  ncsa()a2uaxrono0aptoifetyd m eanvo u4aeenif oydfa  aneils0 eumxrpiy4op elicsltfarumx o;u4olt iieilsfaDrlnvo (4aexnxr3tadlmtranvs;t0s2to(o oy1lpe mfvslsf Duru o;u1aexnio3ildls rmnvon() ltnxoctadfmtrau s () eur(r oydlmt lfcta() 2taxrp;t0tltomo3iaslsDeauvp (4aexoirciytlmDeaneolt) rxoirpnodlpe mncils  rumxmpoo0teenmictat sDrmuvon(0 etnxf3iy1oat auvo;s)t2uoio3nudamenmivil( a2ta( pnu1apx mfeiatla ranvp u4 exnxociodomD  u s t)tetmxrpno1ale mnetas)sDtaxmont0aeenmfctyt m2um(mo;(4tleoiociotfm r iei t0 euo(rpny1omtn nci sfaDrmx  ;t4tee moetyd a raums;u)tltoxfctatlaD lies;s)s2tmir3nu4olte nvs ()s2um(  ou4tpx  ociyt aDea(mo t0trxoirctadfatr nvi ( t2xrio io1lm e ivta( artaxro;t4optoiociatfa2eln p;u4 eenmrcootomtrai ilt0t2tmim ny1opeelncs t)sDumumo;u1opxomictltfm eanvp u0tlenxr ta1fm rlueo;()srxrxm iy1lm  mfvtat  2umur no1oetniiciasls ea( on(4tltnmrcootfatrlnes s setrirpiy4op n fvt s)aDum(rpou1tlx mieiysfm ua(msn(0aeermr3ta1lmt  nei;t  euoiopoo4open iesat  rrrxrpou1tee if3iyslmDuanvp u4altnmr to1la  ln ils)trxrxr3oy1ome  ivta(  rtax oot0aexnmf3iytla rlump;t0 ltnircto1lm ean i s s2urio nodam elneiatfa2tm(  no0teenio3iys a ean o;u) rtrirciydlaDe nvi s0seuoxr3nu1lpen icslsf Dtmx  ou1alen ocildla2eau pnt0alxomocio1oateaneo;t0t2um(m3ou4op nlieiat)artru o;t0oeen iciatlm2emnmp;t) lxnxr3ootopD  nei;s0 exoirpnu1lmtnlict t)s2tmur oo0opeo o3iasfaDuanmo;u4 exoir iotfpDran ol(  etrxm3oo4lltn nciat)s2raxmpno1tex ifcils s emn pn(0alxrir oodop   ueo;(0srxrirpnu4al  lfeia()a2ra( pot1ale ioctytlm ea(vp u4altnmfcoydfpD  nvslt0t2umxm3iu1lpte nei t srtr(moot1texn fciyd m2ra(vo;(4trerirciotoa elu olt0s2xoxmpiu1ole  ncsltfsDumxrooo4tpeo i3iytla umn s t0alerxoctatomD aneil(  eur(rpiu1opeelicsls sDtmx oou1oleo feias sDua(vpn(4tltomo3iytfaDe i o s s2uo(m io1oleemnei (fsrrrx  oo0apx mfciys m ulump u)teeoxf oatlm  lnvs;( t2xr(mpno4lp  lictlsfs2rmumonu0oltn ictlt s rln o u0tetoircootlmtr u ol(0teurirpiu4omtnmfet sfa2rr(  ;u4optoif3iasls2rl( on() rxomf3tytlatr n i;( srxrxr3iudoltn fetas  2tmxr nt4opx mictydfm2rau s u4trtnmrciadopDr u o;t)trur(rpoo1amt  nvi t  rrru o;o4opxoiicild m2ua(vs t0aetrmf3iy1fa r nvo;s0 rumim3oodamtemnvil() Drm(root0opx  fctatla2eaumsn(0tlxomf3ty1fm  anvolt)sruoxr3nydoleemneil(fs2ta(m ;t0tpto fetydlaDran onu4texrxfcia1fpD aueslt)texoir3io1ole liesl() 2rmxr no1tleo feiys sDeauvs;u4texnxr todfp elnvo;(0srtoxr3iydlmeemfctas)a2rrxr ;t1apx  f3tadlm umu o u4alenxr3oadfa eai s t0trxoxr ny1optn nvsa(  Dtm(mo;o1alxoioctatfs2umnvs u4 reomociy1oaDeauvi t srxmio io4ol nmfcilsfarrax pno0aet mo3ild sDul( p ()trxoxo3oa1latrauvol( s2tmim3iy4omenmicsa( arumxmpno4tptn feiatlsDem(vo;t0tetoifcoatlm rlieil( srxriopoy1lme mnvia(  2umumoou4tptomietytfs raump;u) exnxo3iotlmt ln i s0t2xoim oydlptnlict (  2ra(rp;o0oetoio3iat m2eanvp;(4aetnxfciydoptr neils)s2uoirpno1amee fvil(fsDrm(mpnt4tltomo3tadfs2rmnmsn(4trtoio3iadfp eanei (0t2xrxo3nydal   nvslsfs2uax  ot4opt mietas m2rauvp u0texoxrcootoatrau o;(  rxm(opoo4lpen ncs tf 2trx ono0open oetltfm uluvsnu4tltnxf oydfptelieilt tetr(rpou1omt mnct sfa2tmuroou4tle  o3tytlm rl(mp u0alxrir tydopDr ivs s0t2umio3iudamt mnetas) 2rrurp;o1tpxnioeiaslsDrmu s;u)artnif3tydfaDean il(0 exmim3ny4aptelicsl(f 2trurpno1oltomf3tysfaDeluvp;u)alxoxo oo1fatraieo s0setrim3nu1ap nlnvs s  rtrx  ;u1tpeomo3ias m ra(ms u)tetnxrciy1la   i il( s2tmxo no1al elivi t s2taxrp;u4apxn ociltfa el(vsnt0treriocoa1fatr nvi t0t2tm(r no4apeelictat)a2tmxmpnt1aetomictasfa2uanvpnt) etrxf3oytfaD  neo;s0 rtmimpnydalte fcil( aDtmxm ou0apxn iciydfm el( s;t4trenif oo1la eluvilt  2tmio3oudole lfcs (fsrur(mpnu4teeniieiltls2ulu o ()altnmr io1op rli ilt sruo(r oy1omenmncs t aDumurpoo0tee  feiatfs2uanvs (4aetrxf3oydfpt  ieols)teur(r no1opee ictls a2ur(  ;t4tpx mfctlslsDuln s;t0 rxnxo iodomDe nvo ()srtr(o iudal nmnei sfaDra(mp;u0oex iieiltfaDea( p;u) etnmr3ootfmtrauvs;s0 2xr(o oy1lm  lfeslsf rtrxrp;t1olto oetlsfmDelnmsnt4altomr oodlpDrli i;s srtoio nu4apeelnvil(  2tmxm nu1tex ifcildfs eanmp t0 rtnxf to1lmtelues s0srxr(m3io4oleelfvtltfa2tr(rp;u0opx  ieiyslm rl(vsn(4 rxnxr tytoaDrluesls seuo(opoudlptn nei s aDtau o;t1oetnmo3iltlm rlu p;u)aeeniocoydfmDrlivo s seuoir3no4apeemfvsasf Dtrur nu0olx moetasfsDrl(mp;u0teerif ia1opt  ieo s0trxriopoodlle mneil( sDraurpoo0oex  o3taslaDul(mpnt4teerir3oo1oatrlneols0 exm(opoy1llt mncs sfsrtm(mono4tltn f3ias sDranmo;() leoxoctatfatr uvo (  2uoxmpoo1omeelivi t) Dur(ro;o1teen i3tatfs emu p t4aexnmf todfmtrauvs;s texmxo3oy1lpe  ivilt) Durxrono0aetnmf3tad a2ranmsnt0 rerioctodomtr i i;(0 2uoim iu1lltn ies t)s2rrxro;u1opxomfeilsls2ulu p;t4 rxrifciadfpD  u i;s0trxoxr nu1lpte ncsas sDur(m oo0tpenmoctldls um(vp;(0arenifciytop   ivs () exm(rpoudaptn fci ( a2tm(moou0oltn ieiydls2rauvp (4trxnxo3oa1oaDe ivs s0srxo(mpiydoptnmieta( aDtax  ;u4ole moeild a2umnvo;u) lenio oatfat lues;( seumimpou4olenmieil(f 2ur(m ;t1apx mi3ias s2ra(ms;u0tlxnifctotopD  i o t t2xr(o ou4amee fvs sfs2tm(mooo1alxn fciysls uaumsn(4 rermr iydlatrluvo;s)setr(r3iu1ol n ict sf Dumurpno1olen f3iytfaDemn o t4alxnmo oatoa  aivslt  etoio nu1opt  neilt arrr(roou4tle  o3iys sDrmnvs;t4trtoircoadla  lu o;s teuriopoo1omt liciatfsrtmxront0tpx mfeiatfsDrmnvpn() reoifctadlaDr n o t  rtoirpio1lp elnet tf rur( pno1ape ifctlslsDrm( p t0trerxocoatfpteai il( t2umxo no1lm emivs s)aDtaxm oo1optoii3iatla2em(msn()tlxrmfcio1fm  au i ()teuoim3no1lp nmicilt  2uaum ;o4oee  oeilsfm2elu o;t4aeerxocoadfmDrli s;t  2trio oudam nmfeslt a2rrx ont1tpe iociytfa2emumsnt4 ltnio3iadomteli sls)t2uoxm3ny1lptelnvta()sDurxmpou0tlxoifcilsls2umnmsnu)arxomrciatlmDrau o ( sexmir nu4llt miesa(  Dtmur ;t0apeo oeilsla2ua(mp t) rtnircoytomD  uvols0trtr(m ny4lltemfet ( arra(rpno4opxo ieiyt a2rmuvs;t4trenxrciydoaDeau o s0srxmio nodal  mivs ()srumu  ;u1tlt  f3ilsfaDeanvsnu4 exnxr iytlmt au o t  exoxmpnodoltnmfvtlt  rtmx pou4oexnmiciyt a2rmumo u4teeomrcoy1opDr ues;t  rxmimpno1lptn net () rta(mpno0tptomfetasls2rmumo;u4 lermf3io1la eaivslt0 rtrimpoudapee fcsl( s2tr(m nu4tetoioctydfm2eaums t0tlxnioctytfmtelu o;() eurxr3oo4optelnetas s2urxmp;o1teto feiydfsDrmn snt0 exomo3totlmtr u o t)teuo(o3ou4ol emivtl()s2rmxro;t1oex iociys aDra(mo;t4 lxoxr3totfmDr uvi t0seumxopou4omeemfvi s) Dtau  ou0opx io3tadlm ra( o (4 renif oy1om   nvils t2xo(r ny1ll nmfci (fs2taxrpoo0alen feildlm2ul(vo t) exnio3ty1fmD  u sl(0t2toxo nydolt lnctltfa2rruroou1olxnio3ilsls ulu s;()alenir3oa1oat lu sls t2umio ny1oltelfct (  Dua(ronu0tpxnmoetlslsDemu on(0aeeoir3oatfm  livi s)seur(mpoodop e ies (faDumxr oo4alxoio3iat m eluvo;u)tltnmo oy1fp  luvil( tetoim iy4ap e ivtltfaDtaxmonu4tpt  o3iasla ea(mpnt) eenmf3tytlmDelivi;( trtm(rpno4op  lfvtat sDrrur nu0oexo feild mDea(vsnu4aleoxo ty1lat anvs t)texoxopnu1olenmiesat a2rm( pou1aexo ieiatfa2ul(vont0aeeoio oa1oat livo;s t2trxr ou1optnmivsa(fartmxrp;u4tlxn o3ildfa ulnmsn(4 exoxf3iydoa ranes ()srur(m iu4ll  mfvtltfa2rrxrp;t4tptn f3iytla2ulumsn(4alerio3oo1fa eluvo s seurxo oudaltelivi ( s2rmx onu0aleomfeildfm2umnmsnu)texomr iodfmtrln s;t) rto(o oy4ol nmfetlsfa2ra(r ot0olx iietydlm elnms u4trxrxrciotfmD aieilt0t2uoxr3nu4lpeelieslsfa2raxr ;u4tpenmf3iltlm eau pnt4trxnif oatoat livsls0 2uo(m3oo1op elivtat) rrr( oot4aeenmicildla2ra(vp;u)texomo3oatlaDr uvilt) exo(o3iy4lm nmnvs ( aDtm(mpnu0aeeo ocildfsDumnmo;u4 lerxo3iytomt auei;s tetmxo3oudlptemici s)aruaurpoo4aeto feiadfa rlumo;u0tleoxo3tydoat  ivs t tetmxo io4lmtn fcsas  rrau  nu4aeeomicilt aDea( p ()aeeoxf iotfmD lu s s) 2tmxopno1ame micta()arrr(ronu4aeto ietltls uanmo ()tltomfcootfpDraivo s  2xm(m oydal nlietlt srraxroou1tlxnmociatlm ul(mont) ltrmf3iadfptranvo;(0 exm(mpiodapt mnesas)arrr( p;u0aetnifciadlm umn o u0aetnio oydfa raiei;s0 2umirpiu4ap emnetlt a2rrxm no4alxo f3iys a ranmp;(0 eerir tatfp  aneils0s2xrim3no4opee ieils srrr( ooo1apxn o3iydlsDemnmo (4aleoxr3iadlaDr i i;s)srxrxm iu1apenlfcsas)srtm( ooo4ape  iciadfa2ulumo;(0altrir ootla ean i t0srtm(r nydomtemfvilsfsDum(rpoo0tlxoioetatlsDeauvsnu4 reoxo3oa1fm eanvo;s) etmim nu4op n nei s sDumx  nu0oleomo3iytlaDra(vo;t) eenir3oadlmD  ivi;s0texoio3io1omt lnet (fsrra(m ot1tet  f3iat m rm( o;u)texomr3ty1oatrauvo t sexoxm3ny1lp e ncs ( a2rau p;o4oexnmfctyt aDumuvp;u0alenxf3oodop e nes s) exr(m io1optemiesls artaxm oo1tleo ietydlsDeanvpn() etoxo3oa1omtr uvolt sexo(mpiu4aptemfeil(f 2raurp;t4alxoifcilt sDrm(mpnt0 exnxfcta1fpteau s ( t2xrir iy1lm n iesls)a2taumoot0tptnmo3iydlsDuau p;t4 rtrio ia1lm  luvo s0srur(rpiy1apenlfctat) Dtrxront4oeenmfciysla uau s;t0teeoxr ty1omD li i () rxm(r3iodom nlnci t)a2rr(rpnt0opeoif3tasls rl(msn(4 etrxo oadfm eaieslt0 rumio oo1lm nlneias)srua(rooo1opt mfcildlmDra( pnt4teeoircoy1fp eai ils srurim3oudlleemfcs t) 2ururpnu0olto oeildla um(vs;(0texrir3oo1oaDrlues;t0 ruo(r oudalen ivsatf Drm(mp;u0oltoiiciasfm um( s t)trtnifctodlp eaivi;(0trtm(opny1al  livi ()sDtmx pou0oleoii3tld sDumnvo (0aetoxo3tytlpDrli i t0trtm(r3nu1amt  fviasf rtr(m ot1opto fciadla2ua(mo;u0arerxr3oy1om ranvols0 etmxrpoo4lptelfvtls) Dtaum nu0altniieiydfm2rln s;u4teerioctatlmDe neo;s0t2toxr iodlpt mfctls)sDrmxm ot4ope mf3iaslmDemnmp ()aeeoioctadfpte n slt0 rxoxr iu4amee fvtl()aDuaxmp;u1alxnmi3iyd m2uaump (0 eenxr iodfpDrau o;(  rxoxm iy4al n nvs t  Drruronu0alxomi3iytla2ua(vo;t4 etomocoadfmD ai i;(  eto(m iydll e icia(f 2raxronu1tptoifctytfa rmu s;() ltoircia1fat  uvo t) exoxr nodapt  nci t srtrxmpnt4oeenmieilt a em( o u4 lermfcootomD anes t0texrio nu1alen nviasfa2rax ono0tptomictyt a um( pnt4trxrifcoadfptrau il(0s2xmir3iu4lmtnlnvtas  2urumoou1aeto i3tad m ranmp;u0trxnxrcoo1fpDelnes t0s2tm(o3ou4ol e icia(f 2urx  nu4tlt  ocils aDeln o;()aeenmfcootfmDraiei;()teuo(r3oy4open ivt (fs2umu o;u4openiieiysfs2ulu p t) etnmrcoatla raivo t) rtmxr3oo4ope  ietl() Drrx  ot0openmoetytfmDrmnvp ()aetrxrciotlat anvs;s  exm(mpoudop emnctas arurumpnu4olxnmieiat s2uauvsnt0texrioctodopDrlieo ()teumxr3ou4ol elfcils  Dtmu ono1aeeomictatfa uanvp t) etnxr3tatoatr u i;t0setmio3iu1ap nmietasf Dtru o;o4tltnmfeiydla2rlnvsn(4 rxoxr totlpD an i (0teumxr ny4lle lfei s srtaxr ou0apxoio3iytfaDra(vsnu0 exrifcio1fpte nvi;t seuoxmpnodal  mictl(fsDururo;o1apen feiyslaDranmp u4altomr tytlm rau i;t tetmxr3iu1lptn nvt (  Dur(ro;o1opeoii3ildfaDua(vonu4altnxf3oodom r n ols0 euoir iodom n ncs t)s2tau  nt4olx iociytlm uluvsnu)arenmf tydlmDe ivi;(0s2tr(r no4ape mivsatfsrumxrpoo4tlx  ieiydlm ea( s ()alenxf iytfm   u olt  rxrxo io4amtnlnetas  Dua(  ;o0olxoifciytfmDum(msnu0 exnxf3oa1lmte nvi;s0s2xm(opnu1lm nlicslsfartaumo;t0aleoioeiatlm um(ms u) etnmo oy1om eauvs t  exrxr3ou4aptemnei ()artrum no0tlx  i3iadla uluvonu0teerxo3tytlatelnvo;t  exoim oo1ope lfcta( a2rm(m ;u0opeoiiciytfm2eaump u)trtrif3oodom e nesls) eto(rpio4lltnmictls sDuax  ot0apt  i3tlsfa rm(ms;u4aexomrciy1fpD aues;s)teum(rpiy4lmeemfvils) rra(ro;t0opt moeiatlsDrmn p;u) eeoif oa1op   n o (0 exmxmpnu4lpte nvi ( arraxrpno1oleoiociadfmDemn s (4altnmociy1lm e ues;(0t2to(mpio1amtemfvsa( srua(r ;o0apto fcilslm em( pnu) reriociydlpDrauvi;s0s2urxm3oo4ameemfvtasf Draumo;u4aex  o3ias aDua(vonu0trtnir3todfpD  i sl(0 etrxmpiu4oltemics t) 2tmxroot0oeeo i3ild m ua(ms;(4 ltnmfctatlptr i s (0s2xo(r3iy1aptn fet (fsDum(mont4tlen oeiysla2um(ms t4 exoiocoa1lpteaues t) exrxm3io4lm  lneta()aDrm(  ;u1aeen oeiydfaDrauvo u)tltoio oatfateaueslt0seuoxo3oodapeelneils srtaxmoou4tex iictytfm rm(mon(4areoxo3oadoa   uei;t t2xo(m3nu1lme  nvsl()a2ur(mpno4tex if3tldlmDumu s;t0trerxo iatomtean i;t s2uoir3nydol  mnes (  2ta(root0oltnmiciaslm rln pnt4tlermr oadlmteluvs t trtrim iu4ol emnctatfartrx ono1apto fetatfm2uauvsnt) rxoio oa1oaDrlneo t  2xrxrpnudlleemivta( sDtrxroou0apx mi3iat sDrlu on(0trtnmo oodlptranvs;t)t2tmiopoy1ome licsa( aDtmxm nt1tpeomocildfsDrau p () lxoio3oydlmtr i s;() etmiopnu4oltemicsa(  2ururo;u4open o3tas m2raumo;t4 rtnir3oatom r i olt t2uoxo ny4om nmnci ( s2tr(r nt0aeenif3iasla rl( p t0 rxnmf iodlptrauvi (0truo(m nu4oltn ncilt  rtr(mooo0aet if3iyslaDulnmp;t4 rtnio3tatfm r uvo t)seuo(m no4ap  mnvtatfarrmum nu4tpto ociysfsDuauvo u)trenxfciotop r nvi s)trto(r ny1lp nlfci (  2ur(  ot4aetn o3tytfs2rlu s;u4tlxnmo3ia1fmDranvs;t) 2xrio iy4lpe mfei ()sDrrump;t0optoifetlt mDea(msn()trtnxf oodlp e nes s)s2xoxo iudom   neilt  rrm(r oo4tpeoif3iyt mDeln pnu0tlxoxf io1lmD lnvo;() 2xrxo iydalenmfcta(farrrx  ou1tleo f3iys s rlu s t)tltrmo3iy1faDrliesls0texmxr io4lp   fetltfsDumu  ot4aetniicild s2ea(vp;u0texoxo3iytom e n o;() 2xoxo iu1ll   fetasf Drrumoou0ope  f3iaslsDrm(vs t)tltomr3oatlaDean s t trumxopio4altemncs t  Dua(rpoo0aetoioctasls umnvp t)tlxnif3oo1oa eanvi;t0 euoio nu4olt mnvias a2ua(ro;o4tltoii3iyslm elnvo u) leoxrciatop  ln o;(0t2xmxmpoodomeemfctls s2tmxro;o0apt  f3iltfa emums;u0tltnmoctotla eaueilt0 rxo(mpio1lm nlnetl(f Duru pou0aexo icias m eau pn()alenir todlaDeaiei t t2trirpiudap nlfctls) Dum(mono0tpxoiicilsfa ulu sn()tltoifcty1lm r nvo;s)t2tm(m iu1amenlnct ( srrmuroou4ole mf3ild s ranmpnu0 etrxo3ty1lmDrlnvs;s seumir3oudom nmnvt sfsrrrxrpnu4apto f3tat aDrlu p t0artrmfcootlpteanvo;s)t2umir3ny4apeelneiltf Dur(rooo1apenii3iydfaDuluvpnt0 rtnxf iydla  aivi s srtoim iudolt mneta( arrmu  ;t1ale moeiad mDrm(vp;u)aetrif3tadop e n s s0 rto(rpnu4lpeemfesa(  2raxr no4alt  o3tatlmDrln o;u4texnmf3todfm e iei;t) 2tm(m oydaptemfei t)sDta(mont0oeen i3iad a2el(ms;(4altomoctatopD lneil(0truoir oy1om   neiasf Dta(mono0ale mi3iat m2uln o;(4 reoir3oytla   uesl(0 rxmxmpno4am  lietat)aDuaurpnu1open feiad m ua(vp;u)texnxr ootoatrln il() etoimpiy1optnmfvi ()arrmump;o1tpenii3ildfm2rm(vont)aetnxo3iy1lpt aueo t s2xrxr ou1al nlfeiatfarrax  no0tetomictldfmDulnmpn()alxnio iodfmtelnvil()s2uoxr nu1apt mnesa() rraxrpnt0aptoioetatlmDeauvont)trtomo tatfp  aneil(0 2xr(o ny4lmtn nvta(fsrrm(r ou0oetomocilsfaDumn p u4 rxnmo3tatlaD  n o;()s2toxm3ny1lle  fvtl(f rrmxro;u1oetnmociyd m uan p;(4texomfciytfp  lneols sexrio3oo4olen netl()s2rmx o;o0tlenifctatla2eluvs t4 eenmf3ty1optelieo ( t2uoxr3ny4lp nlnctl(farra(m ot1tpen o3iysfm umumsnt0 rxomo iatomDr ues s)t2uoimpiy1ope  fvsa(  rrm(m ou1alt  ieiytfs2uan snu4trxnif3tatfm  aueo;()seurim3oodamtnmnetat s2ua(m oo0tlx mi3iadfmDua( s t)tlxoiocoy1fmDeai o;s tetoxo3nu4lpenmfvslt)a2urxmo;o1opt mociydls2rlnvo;(4aexnmo3tydom e ivo (0seum(o io4apen netltfaruaxm nt4opx  iciyd aDumnvont) eeomr tadfmDe uvilt tetoxr3ny1omen netlt  2rrxrono4oleo fcild a2em(vonu) ltoxr3iadfp e n il(  rtmxr io1op   icsl(f 2rrumoot0oetomfctyd m ulnmp;(4teenif oytlpteanvsls t2ur(mpiodlme mieilt srrmum ;o0alt  iciytfa rln p;t0altrmo3oodfa  anvols)texmxr3oo1apee fviasfsrtmxmpnu1aetniictysfa2ua(vp u4 rtoiocoadfat livs;(0srurio nu4amtnlfet t)s2tm(mpno4alenmfciatfs2uanmp;u4 ltnmrciadla   u s;t0t2urim3nu1ape lfcs ( a2tr( onu1olxn f3iydls2el( s u)tlxrir3to1fpt auesls srxmir3nu1apeelnci t)a2umxm ;t0tpto feiytlm2ulu pn() rxomr oo1fa rli o (  euoxr3ny1ome  nvtasfs2rmuront1tlx mictldfmDua(mp;t)aetnxr3oy1lat lu il()sexrxm oy4op   fvslt aDurump;o0aeeomiciyd a2rm(vpn(4artrif3ty1om   ueo t  2uoir oy4alenlfes ( a2uax pou1teen i3iyt s2rlums;t0artnmf oytoptrlieils)texoxr3oudop  mivt ()sDua( ont0apt mociyt m eln p;u)texoxf3io1lmt aieo;t  exo(rpnydam emneil( sDtrxmpnu0ale ii3iyt mDum(vsn(0aetnxo3iodoa elneo;s) rur(r3ou1lp nmfesa()srra(  ot4tle if3iytlm um( snu0 eermfcta1fa rlnei t trtoxopoo4lmtelietat)artaxmpno4apen fetlsla2ulnms;() etnif iytoa eanvo t) euoimpnydal emieils)arta(r nu4tltnmieiyslm2rm(mp;t0 exrir oodoat  ieo;s)srxrxmpnudomt lfct sfaDrmxr oo0oeeo oeildfsDum( p;()tltrmr3oadom rln o t seuoir3no1alt lfctltf rtau oot4olt mi3tatfm raumo t0treoir iy1lm  luvs;t0s2tmimpnu4lmt  fvta()a2trumpoo4tpxo o3iyt mDelnms;u0altrir3oydopD ln s;t)s2xmxr3ou4op n nct t)a2urxrono0oetnif3iyd m2eaumo;t0 rtoif oa1omt li o ( srur(r iodlmt  nvs ()a2ururonu4tpt  ietatfm emumsn(4 eenxoctotlaDelues () rtrxm3no4alt mnetat sDumx o;o0tpen ictydfm umnvsnu0 lxnxo oytoa rauvo ()sexm(o3io1amt  ictat aDraxr nu1apxo f3iyt m2rl(vp u)altoxrciodfmtraueo;t)srxoio3no1opt lfesl()aDuaxmooo1oet  ietadlaDum(ms;u)texoif ootop eauesl( s2uo(mpoudll n netlt  rrm(ro;u1oleo o3iydfaDeln o u4altrxocoadoaDrai o (0trtrirpnu4apee nvil( arumur no0optn i3iydla2eanms;t0arxnmf ia1opt livo;s)texm(o iodol  lics t) rurump;t4tltomi3iydls rlnms u4tleoxr iatlpt lu s;s) 2xoxr iu1omen icta( sDrm( poo1ope moeiaslsDra( sn(0 rxnio3iotfpDr i slt s2tmio3ny4op nmietasfsrta(mp;o1oexo octadfsDulump;()alxnir3iotfpteanei;t)teur(rpiudope lnctlt) Dumum ;t4teeo f3tlsfm eluvonu4alenmo3ia1op r uvo;t  eurio3ou1ll  mnesas)aDtrx pot1tlto feiad a emnmpnu0trtrmo3oa1fa  luvi;s teurxr3iy4lmenlfvs ()aDtr(rpnt4apxoii3iatfaDuanvp t4teermocty1oa r nvs t)teurirpoy4llt mneia(fsDrm( poo4apxo o3iatfs rlnmonu4tltomo oydlaDeli sl()teto(o iudam nlfesl( srra(r ;u4alt mfciydfaDranmp;t4alxrircto1laD ai s;t0 2xr(rpno1apeemict s srua( ooo1aptomieiys a elumsn(0 exnmo3oydlat  uvsls) 2tr(o nodop  mivslt)sDta(mont4apeniiciydfs ra( s;t)tltnmo iadfp elieo;t setr(o3nydole mfciasf Dtau o;o4aexo i3iasfs2ul( p;t)texrxr iotfm elieo;t0trxoio oo4olee nvs t  rrmxm ot4tpt mi3ild sDem( p u4 etrxr oadfp   nvs;s0srxm(o3oudlmeelfvia(  rra( pou0tet mi3iyd mDrlu p (0 eermocootoa   uesl(0sexmxopio4aleemfvias  2raumo;u4alx io3tatlsDuln o;(0 reoxr3io1fp ranvil()teuo(m iudal  livia(fsrra(  ot1tltnmo3iadls2emuvsnt4tleoif3ta1laDe u s;t0t2tmxmpnodomt micslt aDtm( o;u4aptnifctadfaDrau s;u) leoio oa1fpDelies t texrxo iodame  fctl() Drm( ont0tex  o3iyt mDrmnmo;u)aetrir3tatla e u ilt0teuoxm nodol emnvtasf Dtaxrpno0texnmfeiyt mDraump;u0 etnmf oatomtr i i (0s2xoir nu4lp n nct (fs2uaxm oo4olx mieiysfaDrau o;(4alerxocoydfpD  nvslt tetm(o iy1lptnlfei () 2raur ;o4alxomf3iltla umu s u0tleoxr3tadopte nvs;(0trtoirpnodamt mfvtatfs2tmu pnu1aptomfeiytla2emnvo;(0texnxr ty1fm  aueilt0srto(o iydllee ieiat  Drrumont4olx if3tadla rauvp (0altrmfciadfmt auvi;(0srxo(o3iodlptn icia( s2umxm ot1alto oeils sDumu p t4 lxnxfcoatlmtrlivolt)t2xmio3iudoleemfeia()srumx  ;t1tlxoiociatls2uaumo;t) etrxr3todlm  aieols)teumxmpoo4lptnlieiltfaruru  ou1tet iicild a rm(mpnu0tlxoio todlmt aiei;t0srumiopny1lmtemfvi sf 2uax pnt1apt  octytlm rl( p;t0aeeoifctydfm  lneo t0t2umxo iu4lpe lfes s sDua(r no0opto ictlt s2um(monu0tlxrxo3oatoaDean olt0 rtrir3ou4al n icia()srtmumo;u0oexomfeiysfa2uaumo t4 exrxr3to1lat  i s;s0setmimpno4ll n fvs t srrmur ;t0teen o3tadlaDrlu p u0aeerir io1faDeaieslt0 2tmirpny1ol  mfesls) 2urxmono1ale io3iysfm2uan s;u4 eenmo3ta1oa eai i;( tetrim3oo4amte neilt sDtax  nt4aet ifetld m rmumo t0tetrxrctatfmtrlnesl()tetmirpio4am  mnes s) rumu  ou1ope ifetat a ean o;t0 rtrirctydomDeaivo t setmxo iy4lpeelnviat  Dta(ro;t0tee mietldfaDelu s;u0tlxrxf tytom raies;(  etmxr nudapeemfvsat)a2urxm ;o1aex  f3ilsla2rlump (4 etomf3oadlpte iei;s0 rumio3iy4aptnlivils)arrmum ;o4aexnifcildfmDrm(mo;(0arermoctadfpD ln ilt0 exrimpny1oltn ies ( s2taurpot4opt iociyd s rm( s;t0texoxf iotfa rlnvo;t)trxm(m oo1opeemnvtl( artmumoot4tetn ociltla2ul( o;t4 ltrif3iytlaDrli o t trtoir ny4lp emics (  2urx pou1olen i3tytlm2ulu s;(0 rxnmrcoo1op  lneol(0texr(rpiu1ale mfcilt)sDtaxmo;t1olenmfciltfa uln o;t0trtnxocio1lm e nvo;t  eur(o3oydoptemnet s)aDtmurpnu0tex ifcilslm2rmu onu4tltrmocto1opt aueo s  exmimpoy1ape  nviatfs2rau pnu1oexo o3tatfm umnmp;u4texomo3iodfm  lieils0s2tm(o3oodomt mneiat  rumxmpot1tpxoiictyd m emn s t0 ltnio3iodlm eluvs s)teto(o3iodomen nvs (  rtax pot1ope ifciat mDulu s t4teeoiocoo1op raivs;()texr(rpoo4ap elnei ()aDtr(m no1apx ioeiyd s eau s;(4 ltrifcoatfm  liei;(0sruo(r3no1ame  fei t  2taurpou0apxn fctyt aDemu o;u4trtrxf3iadfa r nvs ( tetrxr oy4al   fvtat)srtrxr ;u1tpxniieiat m umuvo;()tlermf tytopDrlnvo;s texo(r ny4omee neiltfarrrx oot4oltomo3iytla2rlnmo t0 lxnxr iadlp elues;(0 2uoxmpoudopte fvil()aDum( ont1aetomf3tlt s ul(mo;u0treomf oytlp e ieols seuo(m3oodllte nvtlt  rua(mo;u4ape ifcilsfm2emnvp;u4arxrir3iatomDrauei;s0teum(m oydlpe  fcsls)artr( oot1ape  oeiatfs2em(mpnt) etrio tytfa r ies;s sexoxr3io4ole mnctl()a2tr(rooo0opto ietlslm2em( o;(0 lxnif iodfmDeaueils)srxo(rpiodop elictlt  2ur(rpnt1aptn ictydfmDrmn p;t0tltrmo iadoa r uvils0 etm(m io4lmt lnvt () rtrur ;t1olt ifciltfm2rl( s u4tetoiociodlaDrauvolt0 ruoxm3oo4om nmivi t) Dtm( ont0tpe ifciysls ranms;()aexomo3to1lpD lneols) 2trim oo1ole lfesls) rumx o;t1tltnifetytlaDuan o;(4aleoxrctotlaDeai ils0teurxmpnu4olee ivi t)a2tru  nu0alxo i3tasls um(vs;(4tetnmo3iy1fa   uvi;( s2um(opny1am emnetl( srta( onu0tpxo fetls aDel(vp;(4 rxnxr oodfpDrlu olt0texo(opiy4lpeemneilsf ruau p;o4opto ociys a rmuvs (4 rtnxr oy1fmt lu s ()s2tm(r nu4lpt lietlt) 2urur nt0olxn octydlmDrmnmo t0 lxnxf iadfaD  neol()teuoirpny1ll nlncs t) rurxr ;o1aexomictatlm umn p;u)areomo oy1laD auvsl(0trtoim iudomeemieia(f rrrurooo4ole mf3iad s ea(vsnt4 reomo ia1lmDelies s0srurxm nydlltelneia(  Dtrur ou4alx  ieilt mDean s;(4trtnirctotoa e u s s0 rtm(o3nu1amenmnvt s)arraumo;t0olt  fctydfsDum( p;t4trermf tadlatrlnei s sexm(m3iodapenmivsatfa2um(rpno1apeomfctasfa rlnvont0tlxoifcoatoa rlivs;()t2toirpoydomt lnviatfaDrmx  ;u4tpeo ieiasfm2rmnvp u4 reomf iodomtrlueo ()teuo(rpnydomt lnei tf Drru ono4aetnmf3ildlmDrl(ms;u0areomrctytfmteli il( srxriopio1al elnvta( arumxrpot4tleoiictld s umuvon(0 lenxf3ta1fa eai sls  rxmxm3iodlltnlfetasfaDrm(m ;o1tpe mfctlt sDel(vont0 lxnxf3tydfpDelnvo;t)srto(m nudal elnviat srrmxrpoo0tlx  octlsfmDrmnvont) exomfctydfmtrlnei (0trxm(o3iydam elneia( sDurx ont0tlto fcilt mDemumont0aetriocootfp ean slt truoxopoy4omt lfetat arurx p;u4opeoifeiyd mDul(mp t4tleoxf3oo1fptrlnesl()s2xmim oydap nmnvt (f rrmump;u4oee  i3ildla2eanms () reoxfciy1om  aivs s trtmirpiy1llte ictl() rtmumont1aex if3iltfm rl(ms (4 ltrmf iy1lp ranvo t  rxrimpoy4omtelncsatfs2raxrp;o0aeenioetadfs2elnvsnu) exnxf ootlmDrlieo;t)t2trxr3oo4openmfesasfsDtrxmont0apenmo3iat m2ul(vp;u)trtnxr tadlm  anes;s) 2xrxm no1oltelivsl()arua( pno4apxnio3tat m2emnvo t0tetomocoa1op eaneols)trtr(m3ou4olt lnesls  rtaxmpot1teto i3iat a2rmu s;u4aexrmr oa1lptr u o;s0t2toio nodom   fcs tfs2trxmpnu4tltomoeiadlm2umnvo;t) lxrmocootoatrai o ()t2tr(m iu4optn nci sf Dra(ronu4tpxnio3ildla umn s (4tltrxfcio1optr uvo;t  2xmxmpnu1lmeemicsl(f 2raxm oo1tee ii3iad m uauvp;t)teeniocio1lmDelues t)s2umirpiy4optelicsasfa2ta(rpnt0opto fetytfs emn p t)texoirciytfaDranvs ()sexrim iydopee ictas aDrax oou1olxoifetasfm2eln s t0alxrmf3tydlp ranes;t sruoirpiy4omt mfvi ()aruaum ou1teeo ociytfsDuau p;() rerif3tytlmDraneo;() rtrirpoo1lm e ictlt aDtr(mpnu1apxomf3iltfm2rl( o;(0tetrxfctytfa eluvo s0s2uo(m3io1lpe  nesl()s2ta(m nt0apenmoeiat m emnms t4 lxrif3oydopDelneslt0 2uoirpnydol  lnvtl(  Drrx o;t4aetn f3iad s eluvont)trxoifcio1fa e n s;( tetrxm no1ap  lnet s)s2ur(rp;u0tpx  fciadlaDrl(vp t)trtniociytomt lueil( seurio3io1omt liei sf Dum(m no4oee mfctytls ul(ms u)aexomrcio1omtrln o (0s2tr(m3oo1amte iei t)arrrur nt4optnmf3iydfa2ran o t4 etnio3oy1fmDe ivilt0texmimpio1llen iei tfarrr(monu0apxo octytfs2eanmp;()trtnio3oydop rlivil()srumxm iodol n ivias srraxmonu4alt  o3ildfs ranvp;t0tlxnmf oa1opD  uvils0sexrxopnu4al  lncs (  Durxm no1tpe ioeilsfs2rm(ms;(0 etnxocoadfate n i t0texoxo iy1lltn ncsa() 2tm(rp;u4altomictat aDelu snt)tetoircoatfpD li s s)sruoxr no4ome lnvta() Dtmx ooo0alxnifciyt mDrauvsnt0tetnmf tytoate neo;t) rumxr nu4ol  mnctl(farta(rono4ape  ietadlaDum(vp;(4trxnxocootfa elueols) 2uo(m nudlmtn nvsas)aDurx p;t0alxoif3tldlmDrl(mo;u0arerio3ta1fmtraieol( trurim iu4lmt mfes s) rta(mpno4aee iieiadfm elu s;(0alxrif3tydfmDrai o s0sruo(r3ny1lmenmics t)arua(mpno1ale ii3tydfsDea(vpnt0 etrmociydfm  anvsl(  rur(opou4lpen ncilt)srurx  oo1oee  iciytfaDem( p;u0tlxnmr3iadlm rli i s)srxoio nydop n ncsl()arrm(mo;u4apt iociys sDua( p u0 rerir iotfp e nvsls  2tmim nudlmt  nci t)s2tm( pno4tpx mfcild s2ulu o;t4trxomf iodfmDeaieo;s0setoio nudlpe lfcia(faDrmxr no1aeeomf3iatls eaums t0tlxnir3oa1laDr i olt0 2xr(r3oodalt  fet ()arua(m ;t4ale  octldls rmnvont) ltrir3todoaDrlu sl(0truoir3nydlm elict s)s2ta(mpno4teeniocilsla ean o u4aeerxo3totlpte n s;t)s2urirpnydaltemfctasf Dtmuro;u1tle iiciys m ulnmonu) rxnxr3todopD aneo t srxmxm nudop elfes t) Dta( pno1oee mf3tld mDea(vo;u)arenxr3iodlaD lnei;(0teuoxopoo4al   iesl(fsDrmxm ;u4alenmociasfaDrlnvs t4aexoxr3iadlmte u ilt s2xrxo iodopte ici ()arumx poo4apxoiieild a uaums t4altnxr todopD ln i s0tetr(opiydolt lnei t sDrr( pnu0aet ioetadfaDua( onu4alerxrciy1faDe u i t)t2ur(opoudlpen iet ()srrr(rooo1opxoiiciadlm2umuvo t)trerirctatfmt an o ()setm(rpoy4oleelivt t)srrru  no4alxniiciyt sDel(vs u) lxrxf ty1la  lies ()sexr(o iydllte fet t)aDrr(mpoo1apxoiociad m eau o u4tleoxocoo1fpDe uvo;t0 rtm(opny4optnlfes ( s2uaurpou1oee moeiaslm2rlnmpnu0 leomr iy1fmD aieo;()setoxm oudlle mfetat a2raxrooo4oeeo fciyt s2um(vont0 rxnxf3iydoaDeai sl(0srumiopnodap  mieslt)arumx oot0tlxomf3tat a2ulump t) exomo ootfpDrau i;t  rtm(r io1lle miei sf 2taurp;u1tetoifctltfa2eln snt0aetomrcty1fm   nes;(  eurim3oudale licsls  rtm(  nu0tpeniiciatfm el( pnu0aetrifcta1optelnvi;s) rxrimpoo1opee nvsat s2ra(rpot1aex  fetltfa2um(vp;t) eenmo ta1omtrlies t  eurxopno1lmee nvtlt  rra( p;t4opxo i3iad sDumu p t)aexomr3ia1op rlnes;t sruo(o3iu4al  livi s sDtrxrono1tleoio3tad m umumo u)arxomrcoa1oatr nes;t  etoxo iy4ol emnvslt) Dta(rp;t0apt iictasfs2rmn s t)aexnxf3iytomDr ies t tetr(o iy4ome liciltf Dtmxmo;t4apeo fciydfm rlnmp u0arxrmf iodoaD ai o ( texoxmpiy1omee nviat sDrrx p;t4tpxnmfeildfs rmumpnt)texnir3tydoat  ivs;s srtoxo3oodol elfetl(fa2tau  ot0oexnifciad a ul(vsnt4trtomf iadlmD li s ( trxmimpoy1lme lfetlt  Dtmu o;t1opxomi3ilsfmDeluvo;(0trtrxf3tadomt  nes s0t2tmimpoydoltn icsl()artrum nu0altoioctyt a rmump;(0 rermr oa1fatraueo;()setrxo iy4alee fcs (  Drr(mo;t0tpenmieiadfmDelnvp (0 lxrxr totomD auvs (  2xmir3oy1olee ics ( srraumo;u0opt iieiltfm emumsnt4trenxfctadop eaivs s s2uoxo ou4ll  miet (fa2rm(m ou4opt  feiatlsDulump (0areriocoodfmDr ies (0t2uoim3oo1amen nes s) Drmu poo4tlt  f3tatfa rlu pnt4 lxrxr iadoaD lu slt seuoxopno1omtelneils a2ta(  nt0tpxomoeiltfm eln onu) rerifciatfaDrliei;t) exm(rpiodopt mfet tfa2ta(ro;u1oex  oeiydfs elnvs;() exrmrcoatfat livi;t  eurim3nu1ape mnct t)arum(  ;t1olto fetatla rluvs;(4arenxr3io1fmDean o;( t2xoim oy4ameemnei tf 2ua(monu1ale mieild aDem( pnu)teeomocoytfmDean i t srxo(mpiu1apeemics t aDrm(mpou0tet  f3iys a el(mo () lxnifctydfpD aivi s texmxm ny1aptn fei (f 2taxm ot0apt  ietad aDrau pnu)trxomr3totomD luvi;(0texmxr3iu1am emncsatfsDta( o;o0oex moctyt sDem( o;u0trtnir3io1oat anvo;t0srumxrpoo1ll nmivi sfs2rax p;o0tetnmoeiyd s umuvont0 ltoxo iadfa  lu il()sexmxopnydole lfeil() rraxm ;o0tlxoif3ils aDulu onu0trermfcoa1fmD  ivo s srtrxo io1apee iesls)a2rmu  ;t
\ No newline at end of file
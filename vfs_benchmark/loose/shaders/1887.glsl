@@ -0,0 +1 @@
+neils)srtr(o oy4ll emncsls sDrrurono1aet mictltlm ranvo;t0tlxoir totoaDrln olt truoirpno1apt mivs s) Durx  ou0aptomieiad aDul( p;(4 ltnir io1om eaueils)t2urim oy4ol n nvi (farraurpno0apeomfctyd s2uaumo;t0arxnif ty1lmteauvi;( t2umxm iu4lle lnvsat)a2tmumpou0opx  i3ildlm2umn o;u0 lxrif3oa1lmtr uei s t2toim3iydop nlnvsa( srtrxrono0opt ii3iadls2rlnvs;(0teeomfctytlatrlivolt trxm(m3iu4omt lnvia()s2rrxrpoo1apt  fciadls ra( ont4tetomf3tatlpD aneo;( s2uriopiu4lmt mics sfaDurx  ;t0apenifcild aDumuvs;u) lerio todlp rlneils0 rxrirpiy4ame  ncsls)arum(mp;o1aetoif3iatfs2um( o;(4trtrio3tadfmt  nvs;s trxr(mpny4ap  mfes s s2tm( pno0alen o3ilsfs2ua(mpn(0tleomocia1faD auvol(0trumxm3oo4lmt  nvsl( sDtaxronu0texn fctydls2emnmp t0tltrxr3tytfp eln i (0s2xmiopiy1lltnmfvs ( sDtau pnt4aee if3iaslsDumn snt) rtoio ootfptrlneil(  euo(m3iy4ol nlncsa(  Drmxrp;u4tpt mfciadlm2umnmp u0areoxf3tytop r n i t s2xr(o iu4om elncs sfsDtaurpot1olxo i3iad s2uanmo;t0 renif oo1oaDran i s seuoxo3nydlptelncsa( arraum nt4olxo oetysfsDeanvp (4aetoxo oatfptelies t t2xmxo iodopen nciat a2uax pno4tpt  feiyt m2rau o;()arxnxo oo1oa e n o ()trxoxopiydlmenmfvsasfs2tr(rpno1tpe io3iltfs uanmo;() ltrmrciy1faDr ueo t)seur(m3no4ap nmictas sDrm( pno1oleoiiciltls2ulnmo t)aexrif oo1fp  luvo;s trum(o oy1ol elfci ( sDrauroou4apxoiicilsfs2elnvpn(0 etrir3ia1omt  u o;s) exmxm oy1al  lnvs tf 2rrx ono1opto ociyslm2rau o;t) exnxociytop   i o t srtrxo3iodlleeliesls aDuaurono1oex ioctydlaDuln o () rxnmf todla  auvils)texm(opoy4altn fctl( a2rm( pnu4aeeniictyt sDuaums;()aeenir oodfmD  nvo;( s2xoir oudlltn fcta()s2tmurp;u4opto ietlsfa2ulnvp;(4trxnmr iotop eln i s) 2xmir3iudap n fctls  Durur nt4tle  feiad s ul( pn(4tetnmo3todoa eln slt0t2um(r no4om emneiltf Duaum oo0ale  ietlslsDuluvo;t4arxrxf ta1oatrlnvi;s) euoirpiu4open nvs t arta(mp;u0oeto o3tydfa eluvp (0texrmf3ty1fptrlieo;s)s2xrxm iudale mnei t)a2tmur oo0aeeoif3iys m2rl( snt)tleomf oytla ran o;(0t2trxm io4am nlfeiasf 2umurpnu4opeoioeiasls2rm(ms;(4tetrxo3iy1lp  lu i s0srumxm3oydape lfeil() rtau  ot1olxomo3tatlm rl(mo;()tlxnxrciydfmtraneo;(0 2triopou4ome lnvia( aDrrur no1opt moeilt s uanvont0aexomf to1optelieo ( srum(o3oo4llt mnvi s)artruront4tltnifetat mDrlnvo u0aleoxr3oadfa  lues s trurxr3no1llte nvs s) 2umx pou0aee mo3tys mDem(mpn(4arenxfciydopDrlneils sruoxm3ou4ale mfcs t  Draur ;o0olt moctldlsDrluvpnt0tltnmrcta1la e n s;s0trxoxmpoo4om emfcil()aDta(root0alx  fctysla rl(mo;t4alxrio iodoaDraues;t0s2tm(r nu4om elivs tf Dtrxmonu1aexo iciatla2elnvp (4 rtrir3tytla  anvs t0 rxoirpou4apt mncsatfsrrmxmoou0tpxo ociad s2um( sn(4trtnxr3to1laDelieilt0trxo(opny4ol  mnctls) 2tmxroou4tetoioetad a2rlump (4trtnir tatfatrlneil(0s2xmir3iy4lptemfes () 2ra(rpnt4oleniicilsls uln pn(4tltomo ta1lmtr nvol()sexmxo oy4op nlfvsatfsrra(m ;o4tpen fctadlaDrlnvp;u4tleomf3ootfa eluvolt  2tr(o3nodop nlfvi ( a2um(mp;u0olxomoeiasls2uau o;u4trxnmo tatfpDe n il( trtm(o nydole mfeia( artrumoot0olenioetytfs rluvpn(0 leoio3ia1op r ieo;t)t2xo(rpoodamte fetas) 2ra(rooo1olxnmo3ilsfa rau pnt4tltoir oy1om e i o ( setoxm3iy4opee fet s) Dur(rpnt1tltnii3iasls emnvo ()aeerif ia1lmD lu slt srtmir3oydlmeeliesas  2uaumoou4texo ocils aDrmuvsnt0altoxo iydfmDraieo s) 2toxopoy4al   fvtas arrmx onu0aetoiieiyt s2um(vo u)teerxf tytomDraieslt  rtmxr3nodll nlnvta()s2ua(m ;t1ole mfciytla2umums;t) ltoio iatoat ai olt0seumxopoy1llt mieiat)sDrau o;t0oee  o3tltfaDuanmo;t0arxomo3oy1omt aneilt0 rto(r3iu1ameemieilsf Dtm( pno0olxomocildlm rl(vp;u0 lxomf todlaDr uvi t)seurir3io4ol n nei s)sDtmxroou4texomoctasfm2elu s t0 reomfcoo1fmteaneo s)s2tmxr oo1ol emnet t)arrr(rpnu0tpenmfetatlsDeaump () lenir oodla r nvs;t0 rtr(m3oudom emiesl( sDum(m ot4tlxnmieils s2um( sn()altoir totfaDrlues ()t2tmxm nydam e nei s  Duaurpnt1tpeo ieiltlaDelnvs;t)tltomf3tadop elu olt t2uo(m3iudapenlfvs (fsrrrur nt0aetnii3tad m2emnvo;t0aleriocootopte ues;s  2umxm io1olenlnes s) 2urxront1olxn oeiat sDul( o;u0alxnirctotfm ean i;s  exmimpiy4lpenlfci s)a2trxmo;u4apto fciydls2ulump;u0treoxr3oa1la rluvo s)tetoxo nudaptn iciltf Drmxmonu0tlxnio3iydlm2rlnvp (0 leoir3oa1om eai o;s t2xm(r3no1aleemfvta(f 2tr(r ot4oee moetyt s2ran p;()aetnxrciydfp   nes s trtoimpiydoptelnetatfsrtmx  ;u0tpt ioetydlm2ranvp;(4altrif iatlmt lnvo t)t2urxmpno4lptn ivilt s2tau  ;o1tpxoii3tldfs ranvp (0 eenmo to1lpDraueolt0srtm(rpiydaptn nctl() 2rmump;o4oeeoioctatfmDelnvo;(4altrmrcoa1opD lieilt)trtoir nodlm nlivtat  rtrurp;u1opxnmfetasfsDulu p;t) lerxr3oa1fatelnvo;t0 etrxo ny1ome  fvsat)arurump;u0tleoio3iasfs uln s (4teeoio3io1fm rai o (0t2uoxo3oo1altemfvs ()aDua(rp;o4tlxn f3iytfs2rl( s (0 etnmo3iatfp rli s s0trtm(o iu1ll elfvia(fsrumxrp;o4alxnmietlsfsDrlnvp;t0tetnif tatfa e nvo;s) 2xoir oodolt  nesa()srtm(ront4alenifeiysfsDranvp;u0 etrxf oodfm   nvi;t t2toio3nudopeemivt s) 2rau poo4teeomi3iysfm ua( onu0 rermo iadlm   ues;(0texrxmpoudlpeemivsas) 2urxrooo4tpt mi3iys m elu p u)aexoio ootfp elu o (  etrim iu4om nlietlsfsrtau  no4tpenmieildfm2em( p t)aetnxf3oa1lm  an o s0t2umxmpoodlleelivsls a2ra(  nt1tetnmo3iasfa rmuvpn(0tlenmrcoodfpDr nesls sexmirpiydape lnetasfsrrm(mo;o1olenifciydfm2em(vp;u4artnmocta1omteaivo;s)sruoir3ou1omeemictat)arurx oot1optn oeias s2rmu s t4texrifciodlpD  i i t seuo(m3oo4op   ncia()sruru ooo1alt  fetad m2el(vp;t) etnifcoatoaD lieo s)tetrim ou4lm  lnetasf 2rm(rono4tetnmietls s2rm( p ()alxomo3oatlmte ies;s seuoxo3ou1amtnmiei t)artmu ono1tpx  i3iad m rmump u0tetnxo oadlatr n o ( s2urxm oydal emictl() 2uaxmpot1altnmfctat a eau s t0 etnmr3ootom eanei t t2xrxr no4olee net t)artrx  ou1oet mi3iys m emnvs;t)tlerircty1om  luvils)teuo(rpnu4lle livs () Dtmum ou4opeo ociytlm rmu s (0trtoiociadlaD li sl( trxmxm oo4ope lfeia(  2umx p;o1tltnioetadlsDeln s t0alermo totopDraieo;s  2toxm oy1apte feiatfsDrmx ono0aetnmf3ildlm2eaums () lxnmrciy1faD ai s s s2xoir3iu4lptnmfvil( sruaxr nt1tee ifetadfm2rmu pn()teerxf tytla elneo ()teumxo ou1olt liesls arum(mont4apxoii3taslm emnvp t)alerxfcootfmD luvils0trxoio iy4aleelivsat) Drr(moou1aptn f3ias s ua( o t)arxrio iadopDrlivi t) eur(r3ny1ol e feiasfsruau o;t1oee  octyd sDran snu)aeenmr3iytomtran i s)teumio3nodlmtnmfeta()a2umumpnt4teen i3iat s2ea( s (0 etnxrciydoaDeli ils texrio3oy1apeemfvia()srtru  no4texo oeils sDeanmsnu4 rxnmf oy1faD livi s teuoxm3oudlpee fcs t)a2tm(rpou4olt iicildfm2rm(vpnt4trenxrciatlm eln o s s2tm(m3no1om nlnctls) rtax ooo4tlt ii3iltfs ulu onu)tlxoxr3totfm  lnvo t setoxmpny4altnliviat) rurxmo;t0apx mocils s rlnvp t4arxnxfcootlp  lnei s0t2toim3nudlmte ictlt) Dtaumpnu4teto iciat a eln s () etoxociodlpt li s t)srxmio iy1llte nvtl(f Drru  ;t0oee micildlaDel( p;()artnir3tatlaDeau i ()t2umxr3nodlptnmivi t) Dtr( poo4tltnmf3tadls rmnvp ()aetomr oy1lmt  ivilt)t2xrxm3ny4omt mictlt) 2umx  no0tex ii3iydlm2em( p () renif3ty1fpteli ols0srum(o3no1lpeemfvil(fa2ua( pot4opto f3tatfa2uau o t)artrir iytomDelueol( s2xrxo oodlpeemnvta()aDrau ont1oex  fctls a em(monu0arxomfcoo1fmDr neols0 ruoirpnydol  mfetls)sDtaurono1tpenmociyd m2uau onu0trtnmr3totfptr nvo t)srxrim3oy4lle  iei s)aDrr(rpnu0tee ii3ild m2rl(vp () ltrxr3iydlmt aneolt) 2uo(opiy4am e fvi tfartau  ot0oee mfciytlm ranmsn(0tlenmrciytfat li i;s0 rxmiopio1oltnmncias)arrruroot0openmoctltlm eaums;(4artrxocty1lpteln s t)t2ur(o3iu1lm elfeslsfarrrxro;o1ole ifeild sDea(vo;t4teeomo oo1laDeluvilt s2trxr3oydlltnmietat)artmxrpnt1aee ifeiatfa2eanmo (0artrxrctotfmDe ieol(0texoiopio4oltnlnvias a2um(mp;u0tpeniiciadlmDemnmp;t4 rxniocoytomDelneslt setmxo ou4ll emfciltfsDrm(mp;t1oexnmo3ild aDem(vpn(0texrmo3iatom r ivo s  rto(r3oudap e fetl(f 2ur(mp;u0tleoiociatlm emnmo;u) rtoxo3iatlpDrluvsl( srumim3nudole  fet t arurxmp;u1optnifetys s2rauvpnu4 exrir3oytla e ieo s0trurxo io1am eliet t  ruaxmo;u4tpto ieild a ulnms;(0 ltrmf3oo1faD  ues;()setoimpnudal   ieslsfarumuront1teto o3iysla2rmn pnt) eenif ia1faDranvo s)t2ur(mpoo1om e iesat) Dra(  no1optn iciyd a emnmp;t)areoio3iatlmtr n s;t0trtrio3oy1llee feil( a2ur(  nu4apeo fctysfmDulnvsnt)arermfciatfp eaiei;(0trtr(o3iodll  livil( aruaxmoot4apenmi3tls aDrl( p;(4 rxrmrcty1fa eli olt)t2toir3oy4olte fvilt aDtr(root1aexo i3tatls umuvs t0 ltnmfctatlpDeauvo;s)srurirpoo4lp elnvtat a2rmu pot1alxnii3tatls2ulnmp;u0tlxoio iatfm eanvs s) rxoxo ny1opeelnci s) Drmxmonu0tlt moeiadla2emu pnu0tlerioctytopte i slt)srxoimpny1al elfesa(fsDrmxmo;o0ale iociasls emn pn(4aexoiociytlmtraivs s texriopnu1lltn iet tfsrtax  ;o1tle mfetldfsDemnvo;(4altoxo3iydoaDe u o s)texoimpny4am n ivs ( arumx pot1apt miciyt s uauvs;t0tltrxo3oy1oateanei;(0 etr(o3no1al n nctls a2taxmont0tpeoioctls s2rl(mpnt4 exoxo3oytfmtr i o s)srtoim iu1apenmfcslt sDumu o;t0oex mfeiydfa2ean o;u)trxrxrcoatlm  livil(0sexoim iudll e neil(fs2urx  ot4aptomicilt s2emu s;t4 renxocto1oatran i;t  eumirpou1lmenlfcsatfaDtm(mo;u4opx ioetas a2uanvs ()arxrir to1lptrlnvils0t2xmxo no1am nmfcsas  rta(rp;t4apeomociat m umnvo t0artoxrcio1la rlnvils)s2xrio oy1ale miet s srtm(rpnt4aleoiiciadlm2umuvsn(4 eeoxfcootfp raneils0 2urxmpno1ll n fet tf rrrur ;u4ale  feiyd m ua(vp (4altriocoo1fmD lneo (  eumxr oudll  mfeias sDuaum nt4aleomf3tls sDraumo;t0tlenxr3oo1fpD aueols seurim3oudole  ivil(farta(rpnu4openmo3tas a rmuvo u4arermrctodlp  lueo;(0s2tm(opny1optemncsl() 2taurpnu4oeeo oeiat mDelumont4 ltnxo todlp  lneo (0texoim iy4lm elivtlt)sDtm(m nu4aeto i3iad a2um( p u0 etnmf3tytfp e u s s0 exm(o io4om n nesltf rrrx p;o4aetn oeiaslmDrlnmsn()trtomo3ta1oa raivi (  rxm(mpio4lp emfci (  Dra(  ;u0opto f3iadlmDul(vsnt0tlerio oydfa raivol( texr(r3iy1amtemfvsa( sDtm(mp;o4tex  feildlmDul(vo;t)aleoio3tatlptraieo;s)srxoimpio1opeelnei (fsrrrumpnu0tltn o3tld aDem( s;(4 etrxo3ootlaDr i s s)setrxopoydapte netas) rtmurooo0tpx mfcilsfaDumumo (4 reoxrcto1lp raieo s0srtrxm iy4alt  ncils aDumxrooo1aetnmfcildfmDua( pn(4trerir3oo1lmtrluvol(  etriopoudopeelfet ()srtmx  oo1alto feildlaDra(vs () lxomo3tydfptrlies;t setm(m3oodap  lnvsas srra(r ;t0altomi3tadfm2uaums;u0 lenif3oadfm elnes;t)setrim3ou1lptnlietl()srurx  nu1apenmfeilslm umn s;u4alerir todlpD auvi;t trtrxr nu1al nlncsatf ruaxr nu1alt  f3iltla2emn p;() reoir3oa1omtrlu i s srxmimpoy1op nlfviatfsDrrxm ;u1aeeoiieildls rm(vo;t0 lxnir3tatfmt auvo s) eto(r3oo1ap e ivsa(fa2uaxm ;o0aptnifeild mDulump t0arxnio3oa1omtrai o (0 euoxrpiy4ap e ictltf 2rr(mpnt4tptoiieiysfmDeau onu4tetrifcoadfmtelieolt0teum(r iodol  micsa(fsrraxmpnt4openioeiltls2umu onu)aexrxr3iodlmt  ueo t  etoiopno4ap   fes t  2umxm oo1olxniiciyslm eanms;(4trxomf3iydomt luvs s  2tmxo oo4lltnlfvil()s2umu p;t0apxoifctls a2rln s u4 eerif3oa1lm rli olt) rtrim oy1lme lfci sfsruax  nt1olx io3iyslsDrmu p;t0tetrxf3ty1fmDrlu o s)t2tr(mpou1op   fcil( aDrm( poo4opeoif3tyt a2rlnms (4teenmrciydfaDr ivs s seumim iydll emnci sfa2umxmo;u1oeeniieiyd m2uln s t4areoirciodfptraneils seurxo3no4altn iesat)sDtru  no4oleomfeiadlm emump;t4texoir tydom rlnes;t0s2toio ou1oleelfvtl(f rtau  ou1tptomfetyd m ul( pnt4aexnir iytfpt aieo;t) rxmxo3io1ap nmicia(f rumu  ;t4apx mf3tldla2ra( o;(4 lxnmociy1oa  aueilt seuoirpoudllte fvtlsfa2tr( o;o0alt miciadfmDrauvs;(0artoxf oatlmD liesl(0t2tmxr no4op n ieils  Drmx  oo4tlxomfcildfsDua(msnu0tltnirciadfm  auvol( s2toxr3ny1om nlnctl(  rrrxrpou0aeenmfctytls rln p;t)areoxr oytomtelu o;(0trtr(r3oydamte ncia(f Drmum ;o0tlenifetltlsDrmnmo u)trtrmfctytla eln ils)s2xr(m3nydlle lnvs ()artmxronu4tlxnmfeilsfmDemnms;t4treoxf tatfaD anei t0tetrxr3oo1am e fvtasfarrmu p;o0oltnmoeiatfm eluvsnu)trenmf iadfptrluvi (0s2toxopiu1omeemncslsfartrx p;u0tpxnmo3iatlsDrmuvp;t)texoiociytla  lueo;s sexr(o3ou4llt  fctl() 2tr(m oo1tlenmf3ias a2emn onu0tltomf3iadla e ieo;s t2xrim3oy4al n netat  Dtaxrp;o0openiieiyd a eau o;(0alenxr oa1fa  luvolt) eur(rpiy4op  lneil( a2rr(r nt1ale mo3iytls emnvo u) etrmf3iydop  li i ( trumxopoydope mfctat sDrmur ;t4oet  o3iad m2ra(vsn()tlxrir3iotom elueo ()seuoxo no4llenmfvias) 2uru o;t4tpto ictys a eauvs;(4aeerif oodoa elies (0 exmxmpno4am  lfvs ()artmum no4apx mfeilt s2ranmo;()aeerxo oy1fmDrli slt) exr(m3iudll elicsas aDrmx p;t0alenmoetasfsDumn s;u0 lerif3tatop rlivi;(0 rxo(m oo1amt mfvta(farum(moot4teeo octysls el(vo;u)tltrmr todomteai s s0srxmxo3nodlptnlicsa()aDtmurp;u1oet ifctytls rlumpnt0 reoxo oadlmtrlueols t2xr(m3ou4om emfvsa(fs2uau pot1ope io3iyt s2ra(vo (0teenir ty1oa  au i;t) rurirpny4lmtnlfetlt aDrmump;t4apeniieiatfmDrl(msnt4trermr3iodfmDrlivolt0s2ur(o3iy1aptn nvias)srrmumoou0opeoiieias s umn p;u4artnmr3tadlptelu ilt0seur(r3oydoptnmiei s arrrxr ot0tptnmocias a eaumsn(0trxnxo3iodfpt aiei;s)s2uo(r3oy4olt  fetlt  Dtm(mono0aetnif3tls a2umnvon(4aetrmocoadlp eanvs (  rtrxopoy4ap n fesas sDurum nu0oeeoioeiyt a rm(vsnu)tlxnxrcoytfpDe n s (0trur(r3oudolenlfet ()a2tm(mpno4opxo ictyd m eaumsnt)tlerxo oytlpDrauvols0 2um(o3ou4al emietls  2tmxmpou1aexnmoeilt s emnvont)aetrxrcoadla e ueolt)teurimpoodamen nvsa(f rurx  oo4tltniiciydla2rm(vo;(0aetrirctotfptelnesls0 2umxo no1lmt lnvtl() 2taxmp;t0alt mi3ilsls2uanvpn(4aeeoxoctadoat lieols0texr(rpoy4opt lfct (fsDtrumpot0aex moeiys m2elu s u4altnxr iytla rlivo s  exoio3oudlp elieil(fsrtmxr nt4opx  feiydfa ulnvont4aexnxr oa1lpt au i;t trurim3oudlm nmncsas  rtrurpnu1olxnmi3iytls ua( s (4 lxnifciy1laD  nvsl( s2xrimpou4al nmnei () Dra(mpno4aexoii3iyt mDelnmpnu4texomrcoydlpD  nvo s0t2uoxo3oodape mnvsas)srrrx p;u4tptomi3tlt s rlu snt)trtrir3totfate n o ( srumir3iydapenmics tfs2uaxmpno4tlxnmfeiys a2uanvo u)tetoxo to1fpDe ies (0s2to(r iu1lm nlncsat) rra(m ;u1aexoif3tadfm2el( p t0tetnmrctodfatranvs t seuriopiydaptn nes ( s2rax p;t4opx io3tytls2uluvsnt0artoirctodfmDeaivi;( srurirpiodopee fcta(  rrauroou4apx  oeiltfsDeau s;t)artnmo3iy1op r u o;t trtrimpoodame  ivil( aDtmxmpnt4aleo ieiytlmDemn p;t)tlenxr3iytomtr i sls s2trim iudoltelfetas)arrrxmpnu4apxnmf3iyd sDrlump t0aexnircoo1lpDrln i () exrxrpiy1ap emfvsatf Duaurpnu0aptoif3iad mDean p;u) eenxr todom  lueslt srtoirpiydalen neia()s2rr(r ot4oltoifetas aDrlnvs t) lerxoctotlm  ln s;s)sexriopny1ol nmivtlt)srtru  ;o0opxo ocils s um(vs;t4 ltomf3iytlpDe n olt0 euoio nodlm   ivt sfsDraum no1tpxnifeiysfsDuanmo (4trxoifcoytfmt au i;(  2to(mpoy4oltemfvt t  rurum ;u0olxoio3ilsfm umu o;()alxnir3ia1oa eaieils) 2um(r no4amte ict sfsDtruro;o4optn octatlm2uln ont4 ltnir ta1lm  aivo;(0sexrxr io1lpe lnvtls) 2ur(monu4oetoii3iasfmDemumsnt4teenmfctydlat lnes;s s2umio3nu4lle  fctl(  Duax ooo0oet iociys s rm( p t) lxnmo3to1op   nei ()trtoxm ny4lme micia(faDrax pot1tltoifctasfs2uau p t4 rermr3oo1om  lieo;s0srxr(opou1optn iei t) Dtmxm ;o0tlxnif3tlt a2rmnvo;u)arxomf3oo1fatr n o;t)srumxr iu4opte nctlt artm(mooo1tleo feilsfm2eanmpnu0tltoif iy1omteln s t0 exmxopoy1lpt mfei () 2uax o;t1tltn oetls a2ua( snu4aleoxr tatlp  auei;t trtmxmpiy1lptelneils) rrax  oo1apxoiieiysfm ean on(4 lxoxo iadfat  i i s0t2trirpoo1omenlncta(fsrtaum ;u0alxo ietydfs ranmp u)tetoxo3todlpD lueils)s2urim3oo4ome lnvi t) Dtmumpnu0aetoii3ild aDeau s t4 rxomfcoatoatelivo () 2to(o nudole lfcslsfs2tmumpoo0tex io3iysfa2ua(mpn() rtoxf3ootom   neo t0s2xmio3no1openmnetat)arrax pot4olenmociydfa2rau o ()artoiocto1omD auvo (0sruoir iy1omt lncta(f Duaxrono4ape io3iasfs2ranmsnt4treomr3oatfp r ivsls sexm(r oy1om   fvt tfarrau pou1apxniieiasla2el(vpn() rtomf3oatlmDr n o t)trurio3iy1lp e iciat)aDur( pnt4apxoio3iasfmDum(mo;t)trtoxrctotlmte ieo t0s2umxr nodomee ivslt sDtmu onu1tptoif3iat sDrl(msn(0aeenirctadlm elu i t t2tr(opoydlpt  nciat  2ur(ro;o4tpenmoetas aDra(vo t0texoxf ta1laDe ivo s0s2xrxm3no4omeemnetltf rtrx ooo0teenioetat aDrau o;(0trxnxo io1fmtrlu slt)teuoiopny4ape  iciatfa2tmump;t4ale io3tltfs uauvo;u0arxomo oo1fpDr i i;s0 rtmxm3iy4lltn feiltfaDtruroot4alen f3tldls ra(mp u4alxoif3todfpte n i ()sexmimpiu4altn nvs s)s2ur(mo;o1tpt  oeiyslsDuln p;t4teenmrciydlm rlu s t)srxrxr oodopen fctl() 2uaxr ot4apt  i3ias sDulu p;u)teenxr io1faDrln sls0t2xoxrpoudomt mnvta() 2umxm nu1aexomoeiysfm2rmnmo () rtnmrcoy1fptr ues;s trxmirpoudoltn fctatfs2ur(ro;t0tlen o3iytls2ra(vs u4texrmf3oodfatraneol(0truoio iy1open iesl( a2trurooo0alx mi3iytls2rmu o;t0aetrmf3ty1fp r n ols) 2uo(m3oudameelfvtlt)aDrrx p;u0openmf3ils sDra(vp;u4alxrmo3oa1fpte uei;t)srxm(o ou4lp e ieilt s2uru ooo1apxo fciad a2ran pnu)artnmrciytlm rluei ()t2xo(opiu1ol e neia() rrau  ;t1oleo octatlsDel(mpnt4tlerifciytlpD lnvolt0 2to(r3ny4apen icslt)artmxmpoo0teenio3iyt m2umuvs (4arenif3oadla rli ol()t2uoio3oodlmeemnes (fsDurx p;u0tex iiciatfm el(mpn(4 ltrif iodlpDean slt0 rtrir3io1am n fvs t)sDrmuroot1altnmf3iytfs rlu snt) leomr3iodfpteln ils)texmxmpnodop elncias)sDua(  ;o1apxomfcilslmDum(mp (4trtrxoctadlp  livs;s0 rxrxopny1lmt  fci s)sDtax p;u0ape ioetydfaDelnmo;t)tlxoxocoydfmteanvs (0srtoio3iudolenlivils arumxm nu0texomf3tltla eln sn() rerxr3ootoa eau o;s)texriopnydol  lnctlsf Duru pnt1tptn f3tysla eauvo;t0 etoxfcoadlp  luei;t  rxoxmpoudlmee icta() Drr(  oo0tltnii3iyt s2eauvp;u0tlxrmr3totlatrauvo;s  ruoxmpiu1omt mnvt (  Dumx p;o1ape  oeiyd a elu s (0trxnir3ta1omDelnvil( s2tr(o3iydll e nvil()a2taxmono4olto iciytls uluvo;t)aexnxrcoadfatrai i s teuriopny4apee icsat)s2umx p;u1tpenmoctldla uanms;t0 lenxocootfaD luvsls0seurxm3ou4lpeemfvs s)srrrxm oo0aleo f3iat m2ulnvs;()trxrmo oy1fp  ai sl(0t2xr(opiy1lpe  ivtas) Dtmxmont1opx iicildfs rlu s t0teenxf oo1om  livi s)t2xrirpoydol  lnvsls artrxrpnu4tet mieiyd a2eauvs t)artrirciytfm rau ilt0texm(m3oy1ll  lfvil(fsDumu oot1ale ifeiytls2rlnvsnu0arermo oy1faDelnvo s s2uo(opiydlme  ncs t)a2taxmpnt0tptomoetatls2uanvo t)tlxnmrctadla  au i;( s2xoiopiudlmtelieslt)aDtrurpou4olxoifciadfs ul( pn(4alenio3tatoat lneo;s)trxm(r3iy1lm  mfeil( arrau pnu0altoio3iadfm2ul(vsnt4 eerir3oytomD  neol() rumxm3ou4oltn ies s)arraxm no0tltoiociadlsDum(ms;()tetnxrcia1fateauvi;s)teuoio iodomenmies tfarrau oot0aleoio3tytlm ea(ms t)trtniociy1lmteauvsls0seuo(o ou4apt livs t sruau poo1aeto feias aDrlnmo t0altnmo ty1oa  lues;()t2xm(rpoo1al nmicilt  2uru p;u4oexoifeiytls ea( s;()artnxfcoytfpDe ueil()tetm(m oudlpe mfvsl(  rrrx o;t4aptnmociytlmDrl(ms ()aetoxf ootlm  lnvs s)t2xmir oydale livtlsfartmxm nu4alxn ietytfsDeln s;(0alenmf3tadop   nvi t srxm(o iy4lle  ncia()sDumum nt0tee  oetytfs2elnvo;(0artrmoctadlaDrlu o;t0 2to(o3no4lm e nvilt) Drm(roou4tlxoioeiatlm2ea( o;t)tetoxfciadoa e i sl(0 rtoim oy4lmtelfvilt) ruru  ot4aexoiieiatfa ul(mo ()aetomr ia1latrlu ol() rtm(m ou1om n fcsls s2umu  nu1aptn o3ilt sDuluvo;t4 lxnmf3ootoatrau ils0tetoxr3oodamee fetlt  Dta( onu0apxnmfctyslaDeauvo;(4aleomo oo1lmD  ueslt0 euoxm oudlmt mfctl( sDtax pnu4olt if3tydfm elnmo (4trxrif tydfmt lues s  2uo(m iy1ol  liet (fsrtrumo;t0aee ii3ilt mDuaumpn(4altnmfciotfp rauvil(0t2xm(o nudapt lfesat)srrmx onu1optomo3ils a2emuvs (4 lxrmo oy1omtrau s t srurxm no1al nlfvs s) Drmxront1tetniietysfsDuanvs u4artrmf oytlpte n o t sexmxmpnydlmenmfvil(f rumxm oo1tpeo fciyt a2eluvon(0artoxfcoytlmtraieil(0seuo(r no1amte fvtas  rurxrpoo4tpeo fciatfs2ua(monu) rtrmo iatomt livi;t0 2xr(mpoy4op n fetlt  rtr(root1aeen feiydlm2emump;t)aetoir ia1lmDe ivs;s teumio oy1apeemietlsfa2tmu ono1aexnmietytlaDrm(vonu)trtnifcio1om   ies (0 exrxr3nu1amenlfcsl() 2rmx  nt4aee  oeilslaDrl( snt0aexrmrciadoptrlueo;s)s2tm(m nu1openlncil() rum(m ou0aee mo3iydfa em( o (0trtnmo oydfm eanvsls0s2xriopou1om e ivtls  Dtm(  ;u4alxn fetatlaDulnvo;t0tlxoifciytla rau ols)t2to(r3no4olenmfetls)srrr( pou1ole micild m eln o (0tltomf3tydfat aneil( trurxm iu4ap n ivt (  2urxrpot1olxomfciltlm2rlnmo (0aexrmfciodfmt auvolt0tetoir nodlmtnmnei t)aDua( oou4tex miciysfm2ranvonu) eenio3oa1omDean o;( sexoio iy1om   iciat) 2umu  nu4tpt mo3iaslmDulu snu4trermr tytoaD  i il()trxrxo3no4aptelfvta() 2rmu p;o1aptomfeias a rm(ms;t) exoif3iydlpteau o t) exmim no1llenlneia( sDumu oot4tpt moctldls ulnms;t) rermocoy1lpDe uvi;s)s2tr(rpnodolenlicil()arraxm oo0opeo oeiltlaDuaumsnu) etoir tytoatrau ilt0trxo(r iudoleelnci t  Dtrx o;t0oet mieiatls uan s (4 lxnir3iotoptranvi t) exrirpio1lmtn ivias aDuru pnt0aetnif3iatlsDra( pn() ltnmo3oatfpt  n o;()setoxmpiu1amen ncta(fa2tr(r nu0aee mf3iysfm ua( p;t0 lxoxrcio1lp rauvolt0 2xmxo3no4lp  lnetlt)s2uru  no0aptn f3iyt a2ul(vsnt0 reomfcootlmt auei s trxr(rpou4lme  nvsat  Duru pou1tpxoiiciatlm eanvs;u4aexrif3ootlpDraneilt) 2trxmpiu1ap emnvi tfaDur(rpnt1oeeomietatfs2eanvs () lxrxrctatomDr nvo t  rtmxr3nydop  lnvsat) 2rmxr no4tpe  fciadfm2uanvsnt)arenif3ta1fp  an i t  euoxm nodlmen iciasfsDrm(rpno0opeomicildfaDem( o u)tlxnif3oo1fm eln s (0trto(m3iy1altnmfcil(f 2rr(mo;u1oltnmf3tlsfs2ranvp t)altomocto1fpD lu ils)texoim iy4aptn nvsat  2tmu ono1tptn f3ils m2el(mp;(4tlenxo3to1fatelnei;s) exmir3nodoltnmieiasfa2taxr no0ape  octytlm rlnms u0 etnmfciydfa  luei;t0 eto(o ny1lmte icia(f Dumxmp;t1olto feiatfsDrln pn(0artomo oy1oateauei (0 2uriopno1oltemivs s)s2rr(rpnu1oleniiciysfm2eluvon(4 rermr tydoaDeli i;s) rxrio ny1op n iet tfsDuax onu4tle io3tlslm em(von()treomoctytla   nvo;t  2trxo iy1amt lici (  Dtr(mpoo0altnio3tlsfaDeluvp ()aetoxo3tydoaDr i olt)t2xoiopou4apen ictls) ruaur ;o4tpe mietas s2ra( o;u)texrxr tadlmtelieil( trxrir oo1lmenmnvtlt)s2urx  ;u1oeeo oetadls2ulnmonu0tltnxr3ootfm eln sl()s2toiopnu4lptnmfvsls aDtmur ;o4opeomi3iytlmDrau p;u0altnmf3tytfmDelivsl()setr(m3no4amee fvi ( aDra(rp;u0oltoiictasls umuvs u0 lenxf oytfm eluvil(0truoxo3oodlmtnmici sfarrr(  nu0aptnmi3ilt sDrm(mo;u4 leoio3oo1oaDelnvi s  ruoxm3oo4lmt lnes ()s2uax onu4olenmoeiltla2uln p;t)alermociotlm  aivs;()t2urxo3oy1ope  ieiat a2tru p;o0tlenmfeilsfmDea(vsnu) eenifcio1oa rluvs (0sexm(m ou1lpen ietas  rrmump;o0aeenmiciadfaDrau o;u4altrif iatoaDe ivs t s2tmio iu4alen netls aDua( o;u1teeo oeilsfa2ul(ms (0 lerir3io1op eaiei;( sexr(rpou1lpee fvsasfs2urxmpou1alt miciasfa el(mp;u)tlxnif3oydfa rluvo ( tetm(mpno1lmtnlivsl()s2uru pou1tpenifeildlmDrmn p;t0 lermrcia1fpD ln o;t  rxoxrpou4aptnlnvtl( artmxmono0tpeoifeiatfsDrluvonu)tltoir iodomt aies;s) euo(o oy1ome livt s arraumont4altn iciys a rmuvs;u4aetnio3iatlat ai ol(0s2trimpiydal  lnvi tfarrrum no0olx ifetlt m emu snt)trenxocoydfaDrlu s (0srtm(m ny4lptelfcias)aDurxmo;u0alx  i3ias sDeau p u4 etrxfciy1fmtelu s;( teurim3no1lm  lncs sf 2tmumpno0alx  f3iasfs2uauvo (0 rxnxocia1fmte u s () 2xm(r3oodoptn nvias) 2trxmpno4apx ioctlsfmDel(mp;t0arxoxo iotomt  u s t) rurio3oy1omtemfvi (fa2um( ooo1tle  iciatls rl(msn(0 rxrifcoatfmDrlneilt texmxr iy4lm nmici (fsrtr(m nu4tpxnmoetasfs2uau p;(4 eeomr3oo1fatr uvo (  rto(opio1ol   fvtatfsDta(m ot1oexnmi3tltla2rau p u4arerxf3ty1laD aivs;t0srxoxr3iu4lmtn ivt (fs2uax onu4teeo fcias a2ulu s u4 lxnio3iydoptelieo;( t2xrir3ny1op e ici t) 2ururpoo0apxo octatla2eau pnt)areomfciy1fp eanvi t0t2urirpnydomte netat) Dtaur ot0optn f3tytlaDelnvp u0 rxoxociydop e nei s)t2tr(rpou4am  mfcil( srtmu  ou0teeo ieiatlm2uln s;(4tlxnmfcio1lat anvilt) rxmirpou1ope  icsl()sDrmurp;t0tpenmictlsfmDrmumpn(4 reniocoodlpDr i i;t  2trir iu4ap elnvias s2uaxm nu0tle  f3ildlm rln o u4 lerxr oa1om e nei () 2tm(opno1ap emncsl( sDtr(mp;o4oltnifeiydls2rl( s;u4alxrmf iydfm  livs;s t2xmxmpoy4ope  icil(faDrm(m nt4alxoiictas mDrlu p t4 etrmf oa1fp e i s s s2ur(r3ny1lptemncsat aDraxm ;t4oet  octldfa2ulu p;t4 etoif3tytfmt  n s t) rtr(r3iodaptemiei (f rrmx pnu0texnii3ilsls ulump t)tltrmr ta1fp  lnvol( teumxrpio1llenmnctlsfsrua(mpoo0oeen fciadfmDemnvs;(0tltniociodlpDrai o;t) eurio3iu1llte fcils)a2tr( p;o0openmoctltla2el(ms;t)artnxf oy1fa  aueo;()srxrio iudlme  iei (  Dtm(ront4apxnmoeiat m2elu p;() eermo3ootlaD ai ils)t2trxm3iu1amtnlnvtat) rrmurp;o0oleomoeildfs2umumpn()aleoif ta1fpDrauesls trtmxmpoo1amte fcil()srrmur ot0apxoifeils s2elnvs;(4tltnif tytfp r iesls0s2um(m3oy4al emnetlsf 2rauroot0tee mfctlsfm2ea(ms;u4 ltoif totom   neo;t texoir iy1lpt mivsa()s2taxro;o4opxomo3tld a2ea(ms () lerxrcoatfa rlnei s0s2tm(o iu1ol emicsls) Drrurpnt1teen f3iad sDrl(ms;u)trenxo tatom e ueslt0 exmirpou1ll n iesas  2tmxro;u4apenifetyt m2rlu s;u0aetoio3tatopDe n s;t)srto(mpiy4ap nlnei (fsrtmuro;o0opt mocildlm2umu p;u)tlxnmrcoodfm r u ilt0 rur(rpiydol  licsat)artru o;u1optniiciatfm2ran p;u0tlxoio3oo1lpD  n i;s  euoio3nydom  mfciasf rtau pnt0oet  ieiytfmDum(vs;t)altoxo3iodlaDelies;() 2ur(r oy4llt lfeiasfaDtru ooo1tptnmiciltlmDeauvp t0 rtnir totlp  auvsl( sruo(mpnu4lltnmici s) 2taxmonu4oetomiciyt aDranmo;t)aeeoir3to1opt lnes;t seuo(opnu4ope lfvsl()a2tmxm no4aexo ociyd s2rmn snu0 leomfcty1lp eaivs s0 2xo(r no1lmtnlnetat)aDrruro;u4aptn o3tadla2rmuvpnt0 rxnir3totla e n i s)setmxr oudllt micias  Dtmxm ;u4opt if3tltlm2uluvs;()alermo3tatoa elnei (0sexrxm3io1om nlnesa(fa2taxmo;t4tetomieils m2rm(mo;u)arerir3oa1fmt  ivi;s0 rxmirpiodlm nlici s  Drru p;t0aexo ociad a ranms u)aetnxo3oodoate ivsls0t2xm(rpnudom nlnct t)s2uaurono1apt  iciysfmDua( o (4tlxnmr3ty1lmD li ils0 ruoio3iy4lle lfeias) 2um(r ou0tetnioeiytlmDumuvs;()trxomo tydoatranvo;s) rxr(m iu1am e nvil()srtaum ou0tet  ociad m2ua(vo;u) etnmo ootfm   n olt0s2uoxo oodam  lnci t artrx p;t4openmi3iadfa2rl(vp;()tetrxr ia1omDraues t0t2uo(mpiydap   icils) rtmx ono4apxo iciatla um(vpn(4trtomo tytopDrlu s;() rxr(r3nydol emiviat s2rrurpnt0tex iictydlsDumnms;u0aetnmo3oydfaD li slt0srtmimpiu4ol nlnvsl()arrr( o;u1tlxo ieiadlsDumnvo;t0trxriociytopD au i;t0sruoxmpou1al nmiet t)srrmx  ;t4tptnmieiatfsDumu sn(0tltnmr oadfmtrluei;(  2umxr3oydam nlietl(fartm( ont0tet ifeiytfa2ra(mp u0teermr3oytlaD ln o s0truoxr oodaltnlnvil()s2rmuro;t1olxniocildfa2eanms;t0 ltrxfciatlm elnvo;t trtoio3oo4am e ivtlsfa2tr(r ot4apx mociltfsDea( s t) rermf3oatop r u s (0sexoxr oo1ol e nctatfartmx o;t4tpe ifcildfmDelumpnt0 eermo3oa1op eli sls)trumxo3oy4ale livta()aDrrxm nt4aexn f3tyd aDeanmp t0aleriocoodomteli il(  exo(opoudlmt mivi t s2umxmont1aeeoif3tltls2ean pn()arxoir todfat  ieo ()trtrir3io4lpt lnvslsfarurx  nu4optnmfctytfm el(vsnu4arenxf3to1op elu il( s2xo(m iy1altelfcsl( aDtauro;t0tlenmo3ilsfa rmumpn(0trxrmf3iatop rau o;t tetoxrpio1amee ivta( sDtm(m ;t4apxomfctys s2ra( p;t0trxrmo3ty1oaDeauesl(0trxo(r3io4apenmiei s aDumxr nt1alxoiieiadlm ean o;u0tleoxfcoo1oaDraieolt s2tmirpiy4ap emncsatf rtmxmo;u0tleo oeiytlm elu p (4areomocoatlat lnei s0t2tmir oo1apeelfeta() 2trur ot0tet moeiadlaDuln p u)aeeomo oa1fat auvs;()s2toxm nu4ol nlnet tfsDuauro;o0tptoifeildla2em(vp () etoif ty1lat livs s0s2xoiopio1oltn nvslt  rraxmpou4tpxoifeilt sDrau pnu4arxrmr iadfmteaneslt s2xmxopoo1op e fcils  rrm(  nu4alt mociydfs ran p u) eeoir iytfa eanvs ()t2xr(r iu1llenmfvtat s2taxmono4alxoif3iltfa emuvpn(4aetrmoctotlp r ueol() 2trxm io1op elies s)aDurxrpnu0tpxomf3ilsfa2rln s;u0texrxr iatom e uei;t  rur(r oudoptn ncsltfa2ur(  oo1opxo o3ias s umuvs;t0texnmrcto1oaD li i;(0 exo(r ou4lmtn nvil(fs2raumo;t0tpeoiieiyt a ranmont0teenmo ty1lmDr n sls)seum(o nu1ame lieiat  Dtmxronu1alt  icildlmDeanmp t0 leoxf3tadfm elneo;t) rtmio3ny1am nlfctlt  Duax p;o0oet  oeiysfm rm(vo;t0teeomf oatop  luvi;t srxo(o3iy4lmeemfcias) Drrxmo;t0opto ieiatlaDrmuvsnt4tltoifcta1la rau i;t  exm(r3no1lmenmnct t aDtax  ot4oex mfetld s2um( pn(4trtrmrcty1lmDeln slt)t2tr(o3iudop  licia( s2urxm ;t0aexo ietasla uaums;t4arxoio oo1fmDrlu s;( srurxr3io1ll nmiciltf rra( pnt4tptomiciad s2ul( s;t4 rtrmo oatoa rauvs s t2tm(o3no4lpt mnei (f rua(mo;o4ape mfctadfaDrln p;u) rxnif iotfat aivi t)trxm(o3nydlmte ici t srumxrono0opeomfcilslm rluvo;t0 exrmr iodlmDe nvil() rumio nydlmt lnctlt  Drr(  ot0opto octytfs2ea(msnu4 rxnmrcio1opDrlneolt0texoiopoo4ll n nctlsfsrum(r ;t4opt  oeils a rmn s;t)arxoxfcoatom rln ol()t2ur(m3iudlmt mivsas)srtru pno4aexo oeiyd s2el(vs;t0aetrxocoydfmDelueilt)s2uoim iydlpte neil( s2urxrp;u1oltnmoeiat s elu p;u)areoxr3iatfaDe uvilt)trxo(opnudam nmneil(f Drmumonu0opxomi3tatla2uanvo t)aetnmf3oy1om r nei;()s2xoir3iy1llt mfes s) Duaxr ;t4aexn i3ild s um(monu0aeenxf3iydlmDe i sls)srtm(mpio1al emicsas aruaxronu0opxoiicildfaDulnvpn(0alenif iotfmtrln o t) rxrio3nu1lltn ivtasfs2raumpot4olt ifeiysfm eaums u0 lerio ootfpDeauvs t)s2trxr3oo4apenmnvsltf 2rrxmpoo4tlxoifeiatlsDrmn o;(0arermo3iatfp   ies s)srxr(mpou1ope lnvil()arrmxmo;o4aeto o3ilsfa2rl(mo;() etrir tadla e uei;t0 rtr(r iodlm emncias  ruaum nu0teenmf3iytfa2el(vo () etomo oo1la r nvi t)seur(r io4al  lnvtls a2ua(rpnt1texnio3iys a ulnmont)artnifcta1lptrlueo t)texmir ou1ale micsls sDtrum ;t1oleomieiltla2ulnvpn() ltoxo iatfpDrlu i t0 etoxopoydlpte nvtl( sDrru  nu4texomieildls2el( o t4teeoxr oodlateli ols0seuriopoodllt lfvil( sDtm(mo;u0tlt mi3ildlaDuauvonu4texnmf oodoat lnvi;(0t2uoim oy4ap n fetl(f Dumurooo4tptnii3ildls2rl( s;(0trenxo totomte nes;t teum(mpou1amen fvi tfsDtrx ono4oexomi3ilsfm2rmumo u)aleoir oodfa e neil( texoxm3oodolte ivsa()s2uau oou4tltnioetlslaDra(ms;u0tetnif3iodomDe ieilt trxrim3io4ap   ivi t  2tm(ronu4oee  oetadlaDrm(mp;u0 exrmf3iy1oaDeaneo;()srtmiopou4oltn nesatfs2um(rpou0texomictyt sDra(ms;u0trermocoodfmD  uvi () 2uo(r3iu4opt  ncia()a2rrur ;u4olxnmieiltfm el(mp u)artnio oytfat  ivo s0srtmir3oodlp elfesl()arur( pou0olxnmfciasls elu p;t0teeoxfctodfa eauvsl(0 rum(opnudol   ivi t arum( poo1opx mieiltlm umums t4tltrxrciotlm rlnes;( sruoim3oudop  lictas  2tm(m ;o1oee mfetytla emn pn()trtrxr iodlpte uvs ()seurimpiodlp elfvt (farrm(mpno4olenmo3ilslm ulu o;u)tlxrxf iotfm e ueols0 2uoim3iu1apt  fvs sf rraxr ;t4aeen ictadls2emuvonu) exnif3oatoaDr ivol( tetr(r oodlle  ies (farumump;o1tlx mi3iaslsDrl(msnt)altnxo3iytfpDe uvsls setmimpoy1am elnvilt)artmu p;t4alt  o3tld mDem(mont)tlxrif oy1op raiei t0 exm(o oo1ole lncs s a2urumo;t1opx if3iytfaDranvon(0treomo iydlmtraieo;t  exo(r3nodoptnlfesls  2rrumo;t4tpt iocils m rm( o;(0tltomo3oa1lmDe nvolt)srtoxo3iodomt mfvsa(fa2ra( o;t1olxoiiciatfs ua( o;() ltnxrciadom  lu o ()setr(o io4lleemfct ( sDra(  ot1apenmocildls2ul(ms ()tetoxo3tydfmD an ils0setoirpoydamtelnesltfsDrm(r ou4tpx iiciadfs2rl( pn(4 exrir oa1fptraueo t0 rtm(o3iudal eliet sf rrau  nt4alxnifeiltlmDrauvsnt0 eenmo totfpteln i t0seuo(opny4apen ivsa( aDrr(moou1teen f3ildla2uauvonu0teermo oo1lm  lues;(0 rtoxmpnydolenmiei sf Dtaumpoo1aee  iciltlm rau p;u0tltrif3io1fa e nvs s0t2xmim iy4al nmivsa( sDtr(mont4opxnmfctld mDua(ms t)tetrxocoytfpDr i i s setmxo3ou4op emfct ()sDrrump;t0oltnio3iadfm2el(ms;()texoxfcoadfaDrli o;t0 exrir3nu4am emfcsl()sDtaurpno0tltoif3tlt s2emu s (0trxrmf oydoatr i i t0sexrir oy4ll emfctat)sDtmx p;o4ale mi3iysls ea( o (4arxrir iodfat auvs s0seuo(rpou1lpte fvi sfsDta(mpnt1aexo fetlslaDul(monu4aexnir ia1fp rauvslt)trurxmpnu1ol n ncias sDuau p;u0alxomoeiytfm2eanvo;(0alxnmf3oy1late ieils sexoim ou4omenmneias srtru p;t1oeeo fetlt a2elu onu4arxomociotlm r n i;t)trxm(m iu4omt lfcia(fartmuro;o4tltomfciadlmDeaums t) lxoio oatoptrlnvs;s t2ur(opno4optnlncia(f 2ua(rp;o1tptoiicild aDrauvo u4 lxnxf3tadlpt auvsl(0 2umir io1apte ieslt) 2umumpnt4alxoifeiat a2em(mo;(4 exrxf iydoaD  nvilt  2urir3ou4llen fetls arua(mp;t1oexn o3tlt s2raump (4alxoio3iotfmtelivsl()srum(o3nodlm  lici s)artrxm oo4ape mf3tltfm rl(mont)tltoif3oytoa rlnvilt0t2tr(rpiy1lp nlnes s  2ururooo4tlenioetyt aDeaump (4 reomfcootoaDe nes;t)trtoxr iu1lpt mnvtas  rtmumo;o0aptnmo3tytfsDra(vsnu0tetnioctadom rau s;(0 rur(r oo1lmtelfeia(  rrmxm ;o1ole  ociatlm2eluvo t4aeenxf oadlmD  ivo;(0 rtrxo3iu4opee fetl(f 2tmur nu1tle iociyt m emn p;t)tltrirctodoa  auvolt)s2trxrpiy4oltnmics s)srua(rpnu4oeeo o3tlt s2eln o;(4tetnxrcoatopt auei t srur(rpou1ameemiet () 2tru ont4aee iieilsfsDrluvo ()tltrxf iy1lpte ieilt0 2xmir io1lme  nes s)aDumxmpnu1oetnmf3iysla2ra( o;(4tlenio3to1fptranvi;s) exmxo nu1lp nmnvtltf rtmumpot4tee mictad s um(vp ()trtrmfcoo1lm eaueo;s0 etr(opoy4op nlies t) 2trur ;o4tpx io3iltlaDemu p t)teeoir3todlaDrau slt teum(m nu4lpt mfct tfsDururont1apeomiciatfa2rm(vont0 etnxf tytlpteln s;s)teur(o3oydll emneilsf Drmu p;u4tltniietas a umnmpnu)texoif3tadop  aivi (0texr(r ou4opeemnesls  rtr(r nu1tlx  fciysfs2em( s;t)tltriocoatlp  lu s (0s2xo(r3no4amtemfct tfsrumu  ot1oexnmiciysfm uauvs;(4 eenmf iatlp  au s;t s2toxrpiydlmt lictl()sDtm(m ot0olenifeiyt a2em( s;()trxnmrciydop e neo;(0sexoim3nu4am nmncils)s2urxmooo4olenmfciasls2el( pnu4aexoxocta1lmDe ivs s setmxr3nu1amtnmivil(faruaumpot4ope  o3tad aDem(ms (0trerif oadoa eln i;() rxoir nu4am  mfvsl(fsrrmurp;t1alxnmfciysls2emn o (0arxnmocta1oat aueo;t0teum(opou4aptn ics sf rrrx pnt1optn o3ild a umump () eerir to1opt au sls) rxriopnu1lpe liviatf 2um(m nu4olenif3ildlmDuan s t) etomfciytlatrai ols0trxm(m ny4ap n netas)s2ra( p;u0tee iiciydla ua( p;t) lxomf3oydfpt lu ils)t2urxrpiodapenmivi t) 2ta(ront4tlt  f3tad s2rl(msnt4 lenmfctydoa raueslt)s2toiopoy4op  miesatfaDrmxr no1tptn fciatla2um(mo t0arxnxoctydlatrlu s ( seurxrpoy1op e nvt tfartr( onu1olt miciasfs2umnvs t)artnif iytomt  nei;(0 exr(mpnu4lmte ncs t arumur nu1tpt  iciad s ra(vsnu) etriocia1op  li s;t)setmirpou1am elnet s) Drm(mp;t0tptn fctat s2ean o u) rtrif tydlpt  ivil(0srtr(mpoo1ol emicias)sDrr(rp;o4aet ioeiyt a2rm(ms;(4
\ No newline at end of file
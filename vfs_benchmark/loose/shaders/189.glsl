@@ -0,0 +1 @@
+i i;( seurxo3oy1aptemiciat  rum(monu4oeeoifciat s2elumont4aeermr totfatraueo;s0 rumimpny1lleemietlt)sDtr( o;t4aexn ociatfm2emums;(4 rxoxf3ootlm  li s;t0trxrir oudomenmivsat)srrrurooo4tpeo fetld a emu onu0 rtnxr iy1fmD  nesl()s2xo(r3iydapt mictat)s2urxr ot4tpto ietadfa2rm( snu) reoxo3ootlat  ieo;s0 exoir ou4optemici tfs2tru o;u1apen iciatlm2eau p u) lxoxo ta1lp e nei s  eurimpoy4lptn nvs t sDrmxr no4ape  fciydfm2uluvs t4 leoxo3iydlpDean o s  2tr(m io4amt mnetlt)sDumx o;t4tetn oeiad sDraums t0trtnxocia1late ivo;(0 rxrir3io1ap nlneta( a2tax oot0oetn ietld m2ul( on(4aexnxr3iytfate ivs s)s2trirpnodlltnlnes sfs2um(rpou1apxomiciltfm2ulu o;(0tltnxfciy1omtr i olt)t2xoimpoudam e fesls)a2uaxm ;u4tlxoiietydfa rmums;t)altrmo oy1fp rluvo t  etm(r3ny4omtelfeiasfarta( p;t4apxoioctyd m eanmsn()aeeoxf3io1oa  aueo;s  eurxo iodalen nctl()arum(root0tpenmoeiasfa elnvpnt0aexoxo3iydfmDeluvsls) 2ur(o3oo1op emfet ()aDrmxm ;t1aexn octlt m2emu s t0arxnmr todoa  livolt)truoio io1lp  mfesat srrmu o;t1olt  feils sDelump;(0 rxomo oydlptelu il(0 rurio ou1llte icils)artmx  ot1olenmocildfsDrluvs;u4trxrir3iatfm ranvi;t trur(o3iy1ll e nctl() 2urxmoot4ale  ieias a ua(vp;u) ltoxf tydopD aivilt)sruo(o iu1ameelnvi s aDurx pnu0olt iiciat a2ulnmont0 exomocoo1oa e uvi ( s2um(m3iu1lptnmfvsas sDrr(  ;u1opt  i3iatfa2rlnmpnu4 exomrciotlmtrlivo s0 rumxrpnydlm n fct sfsrtax  ;t1aexo o3iys mDeln o;t0 rtomo3tadop   n o t s2ur(rpoudaptemnet t aDtmurpot1tle iietytfsDumuvsnu)artoioctodlmt luvsls)t2xoxr io1oltnmivtltf rrmum ;u1tlto f3tatfs2rlums;t)tleomfcio1oaDraieo t) eur(o nudalte ivtl( s2tmur ot4tlx  i3tysfm eaump;t0teeoif ta1opt anvo t  2xrimpou1om  lies (f 2rmumoou0tlenio3iydls umums;u) ltrirciydomte nvo () exmxr oo1lp emieils)aruax  ou4tet miciysfaDua( s () eerio oydfpDr i s t  rxrxopoudapt lnvtat)sDumx ont1texo iciyt m ea(vp () lxnmr io1omtrau o s  etoxm3no4alee fvsasf rtr(rpot0tpe  ieild s2ul(mo (0 lenmo3oodfm raneilt  2to(o3iydlpe mnvtls)s2trxr no1ope ii3tytls2emuvo;(0tltrxr3tadlm r u i;t0trtmxr3ou4ome  fet (farur( p;u0tlxoiociytfs2rluvo () rxnmo iytlpD auvi;()trurxo3oy1lp n nes ()sruaump;o0aexnmociad sDua(mo t4 rxnxf tadomtrlnvo;(  rumio iodll elfetls  rra( poo1apxo fcilsfa ulu s;(4arenif3iydlm elnvslt  2um(m3oo4al  lfeils)sDrmuro;o4tpeoio3tydla ea(vpnt)altnmfcoadlpDran s t) rxoxm3no1ap elneil(fa2urxmpot1alt ioetadla uanmon(0tlxnmo3oadlate n ils)trur(m3ny1olenlics t srur(m nt0texnmfeildlaDum( snu0tetrxociadfaD aneols t2uoir3nodoltnlnvtas sruaum ot4alxomfciydfm2emn p t)tetoxfciotlpteauvs;s) rxmxm3nu4ll  mfcs ()sDum( onu1alx moctytlaDeaumpn()aetomrciy1faDr ies t s2umim3iy1lpe  fetasfs2trumpno4tlt miciad m2ra(ms;t0artomocoytfp ean ols)s2trxr iodop nliviatf 2urumont1oeen i3tad a em(mont0 eerio iotop elnesl(  rum(rpiy1olt lnvia()a2rmxm nt4olenmicias m2ra(vs u) exoir3iodlm e ivo;( trtrim3oo1oleemieilt  rtaur ou0tpxnmociysfs2umuvo;t0artnmrciatoaDe ueo;s teumxm3oo4amtn nvi s)srumxront0oeeomietytlm2ranmo u4alxrmr to1lpDe ueol()setoxmpiydale mfciasfs2ururont1tlt iieiyd m ran onu4 eenxo3oytlaDe nes s) 2urir3ou1oltelfvilsfa2raxm nt1tet  fctls m rmuvp;t0tlxnxrciydfa e ueo s)sexmxo3iudlmtemnctlt a2rm(  ou0aleniiciytfa2umnvo;t) eenxoctatop elieo s) 2trxmpiodale mfvtasfsrtrx  nt1tpxnifeiyslaDemumsn(0 lermocoo1opDe u i;t0t2xo(r ou4omen ivias  rtmxmo;u4tptnmfctytlm2uln p t4aetnxrcoa1fa e ivsls0 etr(r nydom nmnet s srtmurp;t4aet iieiasfa ulu p;(4aeeoxr3oa1fpD an o s teumir nudlmte ivsls a2umumpoo0tetn iciadlsDum(vpnt4arxomocoatfp rlues;s)trtoio oy4lp  licsltfaDrax onu4aexo i3tlsls2uanvpnt0 eeoir3oadoaDelues s)texr(o3nudol   nvtat) rtru p;o1oet moeils m2em( o;(0 exrxrciadop rli sl()srumxo iodlp  lfvsl()a2ta(r ou4alt  ictyd m ul(mpnt) eenmrctytfa  livols  2umim3ou4aleelnct s aDurx ooo4tet iietlt sDumu o t)tleomocoatfmtr n ols) etrxr oudlpenmies t)aDta(ro;u4oeto ieiadfs2rlump;u)aetoxr3oadfpD  n ols)s2urxr3oo4ap nmfcils)s2rrxrpno0olto ictad s2rau s t4arxnir totop elues t0truo(mpoodllenlicsas)srra(m oo1tpe iietyd sDuauvs;t) rxomfctodlm rlneils setmxr io1lpeemiesltfs2tmxmoot1aleoif3tlsfs rmn sn(0 exoifctadop r u il(  2trxopnu4lme  fci ()arraump;u4opt iiciat sDrmnmp;u0arxrxr3iatoa e uvi t)t2to(opny1aptnlncs t)sDua(rpnu4alen o3ilslmDulumo (0 ltrxf iy1lp r u i;s)s2tmimpoydomen fvil( arrrxr ;t1olxomiciys mDemumo;u4 etrio3tadopDr neo;(0teumim iu1ol  lnetl()s2rau p;u4ole  i3iydfmDem( snt4 eerxf3io1fm elneolt0 exrxm no4alenmnvta(fsrta(r nu0tleo fcilt m2rauvsn() leomociodfpDr uvil(0teuo(mpiu1oleelictls  rua( pou4tex ifetadls2rmnvpnu)arxoxocoo1optr i sl() exmir3oo4op n nctlt a2umx  nt1tle iictadls em(mo t4 lermrciatfaDr u i s0teuoxm3iy4aptnmneia(fsrrrx  nt1oet mfcias m rl( p t)tetrxr3todomte ivi () exm(m3nodoptelietatf Draxmpot4oeto oeiasls eanvs t)tetoir3oydfp  aivil(0 2ur(r3oo4lpt mnet sfarrr(ronu4oetnmo3tydlm2em(vp;t4 rtomocia1opDeluvi;s0 2to(r3ny4op   ieslt)artm(rooo4teeomo3iatfm uauvp u4trxnir3oydopDraues;t) etrxmpio4al   nctlt  rrrumpno4aptnmoeild m2raump;u0 etnif ia1fmtrau s t)srxm(m3no1altelncta(f 2trx  nu1olx mf3iydlm2rl(vp ()arxrmf iotoa   nes;s0teur(opoy1llenlfviat) 2urxmont0tlt ifeilsls el( on(4 exnio3iytoa rln ols texrxm nudlleelnetasfarrmxmooo4olenmoetlslsDuln pnu0 lxoio totop eluvi;s0s2tmimpiy1llenlieiasfs2umxmpnu1olxn i3tysfs em(vpnu)aexomf3iy1fp eanvo;(  rxmxrpnu4aleemieiltfsDtaxrp;u1oexomoetydlmDel(mpnt0 eenif ta1lpD  ues;( seto(m nodol nlneils)aDumu  ou4olxnmiciltfa2umums;u)aeermf3iy1opt  u ilt0 2trim ou1oltnlfeiat sDrrxmo;t1olenmfetls m2eanvo;t) eenioctatoatr u ils  rxoir3iu4lpenlfvslt s2rax  nt1aexnmi3ildfmDrmnvo (0trtnxr3iydopt  ieols0teurxr oydalenlfcslsf 2tr(m oo4oetniociysls emn pnt0tltrmrciotfaD ai s t s2urxm3no4omenlfesa( s2rau  ;u4tptn feildla um(vo u0 rerifcootop   ueols  rumxo3ou4olen nes s srurumpoo4oexnif3tadfa2rauvsnt)trtoxf oatlmD auvi;t0trtoxmpny1lpenmict s) 2rau p;t4optomi3iad a2rmumo u)tleoxrcoytlmteln slt truoxm nu1lm nlfcias a2tmxr oo0ope  fciasfs2em(ms;t0alxnmr3iodlatr nvo;t0 2xr(m oodomt  nes t a2rr(m ;t0olenif3tat mDrmn on(4trxoio iatlmt ai o t  2toxr oy4open nvtas a2ururpot1alx iieilsfa2rauvo u)altoif io1fm elivi;(0srum(r ou1op   ictas a2ur(root0olx moeiysfa el( p t4 rxoxo oatfpD anvolt)s2tr(r oodlp emfet ( srur(m ;u1oeto iciadls2rl(vp u4tlenmrcto1lmDelivils0t2xmir3nydll e ncta(fsrur( ono4apt iocildfs ra(mo;u0 lxoir3todla rlnes t  rxmxrpiy1altnmivslt) Drmx  nt4altn oeiasfmDemu s u)trxrxfciytop rliesl() rtr(m ny4ap nmiesa( a2tmum nt0teen i3tltfa2ul(vpnt0areomr iydom rlivs ( t2uoxm3nydam nmicia() Dua(mooo4alt ioetldlaDuanvs;u0arenxfctodfpDr ivilt teuo(r3io4amenmnci sf rur(ront4aptoioctas mDemuvp;u0 rtrio3todfa r i o s)texmiopoydomt livi tf rtau p;u0aetnif3tadfa rlums u)artrmfcoytom rluvols) 2urxo3iy1ame lfvta(  rur(monu0optn i3iytfs2raums;() exomf tadla   i s t0trxo(opoydalenlnciasfsrta(mpot1tpeoioeiltlaDrmu s;t)aeerir oo1lptr nvo;()srurir3oo4om n fct s aDumxrpot4alx  o3tydlm rmnmpn()tltrmo iy1opDrauvi ( t2tmir iu1lpenmfcs sfa2rrx pno1optoiictadfmDrm(von() leomr ia1fm ranei;()s2xmxopnydaptelivt (fsrrrxmp;t4alxo fciatls emnvp;t) rtomo3iatfmtr ueilt setr(o iy4lptemfct t)a2ra(ronu0tlx ifctasla ranvsnu) eeoxf io1lpD  nei;t t2tmxr ny1llenmnctlt srrmu  ;u0aet mfetadlaDel(vo;t4trtomf3iytlm r i sls)t2xmxm3ny4lle liciltfs2umu pou0aee  feiasfmDel(vonu)texomr3io1op eaivo;t) euriopny1lp  lnvsls)s2umxm nu0alx io3iadfa2elums (0tleoxoctydoa  an i t) rxrxrpnudom n nci (fs2urxmoot0aex  f3tadla eaumpnt)tetrmf ta1lmt aiei;()t2trxopnodap emnesas) 2um(rpnu0olxoiicildfsDua(mont4 ltomo3io1fate u i;s)setrim ny4oleelfciltfaDtru pnt4aptnmfeiytla ul(mo;u)aeerxf oa1fm  ln sls) rtr(m nudop e nei t a2taxronu1tetoioeiytlm2rmu pnt)aexoiocoodopDean s;()setrxr io1ll n fvtlsfarum(mont0oeeo octytfm2uanvo;u0artnif3io1fm  livo t srtrxm3iodlmtn fcs t  rrm(rpno4oex mi3iydlm ranms;(0 ltoxr3iytfp elnvi (  eurxm3ou1apeemnei (faDrr(ront1tpt mfciat mDrmnmpnu0trtoxf iotomtelivo t)srxriopoo1ape  ncslsf 2ur(mp;o4olto f3iltfaDelumsn(0 etoxf3oytlmtrlu ilt) rumir iu4ll   ncil()sDumu p;o1optnmfctat sDua(mp u0tlxnirciodfpD li s;t0tetrir iu1ol emfes s a2urx pnu4optomf3tytlsDemnvo (4 etnmfctadfaDr ivilt)srumxr nu4apen fvs s sDrmu  nu0opto fciys m rmnmp u0 rxoifctotla elueo;s0sruo(o nu4opte nciatfsDumxm oo0ale  fciytfm rlump;t) rtrmr3iytopt  ivo () 2xmxo3ou1oltn icsl( arua(r nu4ale mietysla2rmums;(4altrmr oadlp r i o;( teumio iy4llen iet t)arur(r ;u1alt iiciasfa2ua( s (0 eerircoodlpDr nvi;s0 2xo(o iudlpt  neta()s2rmump;u1alen feildfs rlnmo t0 etoxrciadlaD luvo s0t2to(o io4omte ics sfaDra(  ;o1oltomieiytlaDumn s;(4tltnxr3todlmtr ivi;(0 2trxm3iu1ll nmfvilt)artrxmonu0apt ioctat m2rmuvs;t0alxoxo3todlpDelivi s s2triopoo4amtelfet ()srumumooo4oeenio3iadlm2ra(vo;(4tleomr3oytfatrau o (  rtrxmpou1lpt  nctl( sDuaumpnu4oeenmoctltlsDea(mp;t0 leoxo iydopt lnvo;t tetmxo3oy1opt  ncil(fsruru  ;u1alt mfciasls emu s;t4aeenmocoy1oat  nei s t2ur(mpny1lmee nvtasfartm(mont0tex moeiatlm rlnvpnt0 renxo3oodfmtr i o s texmim oydlmt micsatfa2rrum ;t0tlx  iciys a ean p;(0alxrir3oytoa e ivo;t texrxm nudap  lfctatf rrmumo;t4olx  feilslm2ua(mp t0texrir oo1lmtrlnvi ( trtmxrpiydomtnmieslsf Dtrump;t0olxn f3ilsfs rlnvonu4tltriocoadfmtrln sls)setrxr nodlmenmiei sfsrurxmonu4opx  octaslsDrlnmo (4altoir io1oat an sls0 rxo(o nu4omenmnes () rra(mpnt1tpeniietatlaDrmnvp u)aetnmoctotlpD aneo s  rtmxrpoy4ll  lfci t)srumx ont4tpt mieiatfaDem( o ()trxrir tadfaDe ieils0 rxm(m iy1op emictls)arraumonu0oex mf3tysls2ulu ont)aetrmo3tytoatraivsls0 exoxm3ny1optn ici (f rrm(m ;u4tpt ioctls aDeau snt4trtrif iy1fp e nvs;t)tetrxmpno1om  livil()sDraumpnu0ope  o3iyd s2uan o;t)alerxrcoydlmD lnvsl() 2tmxm3iydoptnmnesatfs2raurpnt0tlxn fcils s2raumo;(0 exoxf3tydlptraivs;s0 rxo(r oydop nmics s)arrmx pnt1oee  feiytla2em(mp;u4 ltrif iy1optrln o s srtrxr3iydll e fviasfs2taxront0ape  o3tydfs rmu sn(0 ltoxrcoydfmteluvolt) rtoxr iydom  mfci ( s2urx  ;o1apx mfetadfa rmumon(4aexnmf oo1lm eaues s0trtrio oy4aptnmicsasfs2rmxr ou4altnmf3tyslm2rmu pnt) eeomr3ta1fptrai o s0teur(o no4lmenlies () Draxmp;u0tpe  ieiys s2elnvsnt)tltrifciatlptrlnvolt0 etmxopiodol  mnvtlsfsrtmuro;u4oetnmfeiasla em(mont) etoxr3oy1lpDeaiei t0 rur(m iudom  lfvt t  2uaxrpou1olx mocild a rlumo u0 eerxo oy1lmtrluvi;(0t2xoxopnudopen fci () rtrxm ;o1oetn i3tat m2el(vp;(4 lxnmfcty1opDrauei t0trtrir3io1ll   fvtltfaDtm(m no1tpx mi3ildlmDumump (0areoxo3oo1fmDelnei;t s2toxr3iy1lp emnvt t a2trumo;o1apxo i3tytfs el( s;u)alxrxf iotlp rai i ( t2xrxr3nudol  mfet ( s2rm(mont0apeo ociyt a2ra(vpnt)alxnxo3iydlm  ai i t)srxm(o3iy1ame miesa(farrmu p;u4tpt ioetytls rlumpn(0trtrir iytfptranvs;(0t2tr(rpnodlpt mieilt sDua(mpno1olx mocildfm rauvonu)texomo3iotfateli s;(0tetr(o3io1lptnliviasfa2ta(ro;o4teeomi3ils s ul( o (4texrir3oa1fpDe ies;t) rxm(m iy1am  mfvilt arurx  ;t1oexn ieils s2um( s;u0 eermo3iodfpDrluvo (  2tm(o iy4ol   fcs ( sDrrur ;u1alx ii3tatlaDemuvo u4trxrmo tatfat  i il(0 2tm(o ny4om  mfes tfa2rmx pnt1tetn ictldfs2elnmp (0 renxr totlmteli ol()texmimpiy4lpe lnvs (f Drrx  no4altnmo3iltla elumon()trerif3io1faDraueolt srxr(r ny4al nlfcs (fsrtaumpou1ape mo3ilt a rlu p (4tlermr iytlpD lu s;() 2xmim nydomee nvsa(fsDua(rp;u0optoifeiydls ulu onu)arxnmf3oydfm elnvols) ruoxm iu4om n icsa()srtax oot4opt ifeils s2eln s u)aetoxo3tydlp  li o t0 exo(o oo4lpte ivi () Dtaxmoou0ole iietys sDrl( p t) rtnxf3iatop rln o;s0srxr(rpiu4omtnlfvilt) rrr(r nt1ole  o3iad a2ul( pn(4 exnir3oo1faDrai s;t trur(m iy4lpeemfvils arua(rpot1tltnii3ildfs2elnvo;u) etoxr iodop e neo t s2xrxrpoo4am e ieil() Dtmumpno4tlxnifeiltfsDua( p;u)texomfcto1fmtr ivo;t s2tmxrpoudapeelnes tfartmxmpou4tlx  i3tls aDeanvo;u4tltnxo iadfm eaies t)trxo(o3oydal  mnvtat sDtau  nu1tpxn ociysls emuvp (4 lenmo3totlateln i;s)srur(o3oo1ope lict ()aDua(m no4teenmf3iysfaDulu o;u0 ltrmf oydomDraieo;s)s2xmir3ny1op n nesl() 2raur ot1alenmfctadfs2em( s (4arxnirctatlatr nvil(0 etoirpno1ope mneiatf Drau poo0teen oeiytla2el(vsn()trtnxf oodoa eai s;s0t2uoxm3nu4opt lfcsa( sDrmxm ot4tpxoifetyt a2umnmsnu0texoif3iy1opDelieolt) eurirpio4lmtemnvsls)a2ur(rpot1apx mi3ild m rl(msnt0tlenircoo1opDeauei (0s2toxmpoudole lfvsas  2trxr ot0opt mi3tas sDuln p;() eeoif oytomD  ivs;s)truoir3nodlp   iesat) 2rmxmono0tpxomoetyd mDuaumonu0 rtoxo3oy1omDr u s;s0 etmxopoy1amte nei s)artrxro;o0olx if3ild a2emn s t4arenxfcty1fpDraivs;t0 2tmxr3oydlmenlfeta() rrr(mp;u0alxomf3tyd a2rluvp (0trxniocoatfa r iesl() 2trir3iu1om  lics s)srrmxmont0aptniicilsfa elumsnu)areomf to1oatrai i ()srurio3no1llen ietlt)sruaurono1oetn i3tatfa2eau o t4tlerxf oadfatrli ils)texo(mpoudomtnmici s) Durx p;t0opeoifeiaslsDelnms;(4tetrxo3oydlmDrlneols0seumxm nu4olee fci s a2tr(r ;u4aetn ocildls2ra(vs;t4tetomo3tadla  ai i;s0teuo(r nydal emici s) rumx  ou0oexoifetytlaDem(ms (4 etrxf3iatlm e ivo (0 euo(mpoo4om e fvta() rrmum nu4aeto o3tytlm2rlnms;(0arxrmf3tadom ran s;()trumir ou1amtelfvia( srta( ooo0olenioctasls rmnms;t0trtrxrctodla  li i s)s2umxopnydlpee nviasfaDua(mp;t4alxomietadlmDrl(vp;u4aetrxf3tadfmt anei ()srtoxrpoy1am elfciatfaDrr( o;u4alx  fciytfs ra( on(4alerio3to1oa  auvs;t0 rxrxm3oy1amt lnci () Draxr nu0olen i3iltfmDua( pnt)trxnmf3tytfm rau i;(0teumxm3oo1lmee fet t)aruax p;t1aetnmicildfaDra(vsnu)tltomfcoydfptr n i t)setr(o3oy1alenmnei s a2rau pnu1tex ii3ilsla rlu o;u0treomo3iotom  lueo;()seto(m iudapenmncia() Drm(m ;t4apen f3tydfaDua(msnt4tetnmf ta1om e uvol() 2tmxr3oo1am n ncsas)s2ur(rpno1aeeoiieiadfm emu s;u4alxrxr iydla r ueo;(0trurim3nu1lp   fctl()s2ta(mooo1tltn feildlmDrm( onu)areoxoctotlpt aies (  2xr(r3ny1apen iviat) rtmxr nu0tlt mociyslsDum(mpn()artnifcootfmtranes () 2xr(m ou4ope mncsa( aDrr(  oo4aee moctatla ea(vsnu4alerxf iodoaDrluvs;t0s2umio oo1lmtemnes s srtm(mp;u4aeeo fctltfsDrlu sn(0tlxoxf3oydlaDran sl()trxmxm3nydop elnvils) rrr(ront4tlt  fcilsfa2el( p u0 lermf ootoptelieo;s sexmxm nodll   fvi t)sDtrxrpno4altnmi3ildlm em( o t) etoxr3iytfmDraueilt0 2trxo oo1lp elnviat  Drm(  nt4texo i3tydfs emnvsnt) lxrifciodomtrlies () rtrir nodaltelfeilt)sDrmxr ou0apeoif3iyt a ulnmp;t4treomf3oydfm   uvo s0 etr(rpiu4lm emnciat)srrrxm ;t0alxnifetatfaDuaums;(4alenir3io1fatelnes;(0texoimpiodlltnlfcil(  2taum ;t0tpx  o3iyslmDumnmont) rtoir iadomD  i i;()texrirpoydam elfeilsfaDtrur nt4aexnif3iyslm2uan s (4 ltrxo3oadfa  lneols0trumxo3oydlmenlncs () Dtmx o;u1olt ii3iltfsDra(vsnu) lermo tydfa  ai o;t)srtmxrpiu1ole  ivtls)a2rax pnt0tpen f3tatfs2elnmonu4aeeoxocoo1fpte ueo;()srtoxo3iu4ame lnvi (f 2ur(mp;u4tlx mfcild m2emnvp () rtrmr oy1opte nei;s0srxoim nu4lmt lfetatf 2tmxrpot4olx ifciydla uluvp t) rtrmo3oytomDr uei;s)seuo(o3iu1lmte nctls  2urxm ou1olxomfctls sDemuvp;t4tltnifcto1omD livs (0trtmxmpoy1altelfei s  rrrxmo;t4aeto ieilsfa eluvo;t0teermo iy1op   nvs t teurim3io4lpee fvta(fsDur( pnu0aeeo o3iasla2ranmpnt0teermrciy1oatrli ol() exmxmpnu1lltnliesasfaDtr(mont0tet iietldlmDra( o u4tltnxfcoy1opD auvols seurir nudope  fvias)srtmu pou1aleomocilslm2em(vs u4tlermfciadlp  anvi;(0seurim nydlpen fciasfsDraxront4aleomoctytlsDra(mp;(4 rxoio oy1lpDeaieo;()sexoxm3ou1omtelieta()sruax o;t1apxn oetyt sDumn p;()tetoxf to1oatrlieil(0 rxo(rpny1al n nvtl() 2tr(m ot0altoifctyd m ulu p;t) rtrmr3totfa  au i;(0t2tmirpnydomee fcs ( s2raurooo4aptnii3tldfm2rl(vo u)trxnif3ty1lm rluvi;t t2xoir3iy1lp nliviat)s2trurono4tptn iciatfm rl(msnu)texrmr3oytop eau s;t)seum(r oo4ole  fcsl(fa2ua( p;o1texomi3iyd aDemumo ()teeoiociodopD  u ilt0srur(rpno4op elneiat)a2rmu ono4oeeoif3iat m2uauvp u)aetoirctotoaDrauvo s)trxm(o iydop  lnetl( a2urum nt0texo ieiysfs2eanmp u)trtrxf ia1lp  auei s  etoiopio1ome lnvi ( arum(r no0tltnmo3tys sDua( onu) lxomf ia1lpD  nei;(  2xmio3no4om  lfes tfartaumpnt1tpeo ieias aDumnmp;u)trtrif iatla  aues ()s2to(o3ny1lleelfctlt)a2um(monu4tltnmictydla2umnmont4 rxoxf3ty1fpteluvo t)trumiopoo4ope lnctlt)aDur(rpnt0apxo f3iat mDrlu pnu4tetoxf3iotlpDeanvo;s0seum(o3iy4lpen ies t sDtaump;t4aee ifeilt a2ul(vp (4 eerxfciatfp  anvs (0t2urxopnu1op  mfet (faDtrx p;o0tpx ifciysfs um(mp u0 exoxo tatomDr uvs;t0s2toirpiudolt mfeslsfsrrm(mo;o0opxoiiciysfm rmuvp;u)tltoxf iytfa e u o s0 2tr(m iy1apt lnvsls srtm(moot4opxnioetatfs uln snt0 ltrxf3iytfp  lu s (0 rur(mpiy1opeemfeslsfarrmuroou0apt io3iydfa raump;t)aetnmfcootlatranei;s0texmio iu1lp elfet s s2ur(rono0optn feiadls ulu s u) leoxr to1fa e iesl(0s2tmxm io4lp emfvi t)a2tau ont4oee mfciyd s2rauvs (4 exrif3totoptr u o t)s2umim3oo1om nlnvtlsf 2urxmono0aetomietld m ra(vsnu)alxnmr iatlm eaues;s sruo(m3iudlm   fvt s sDra(root1aleo fetltfa2rl( s u) eenio3oy1fpt li i;(0 exrxm no4om n ncs t) rrm( o;t0aeto feilsfa umnms;()trtnifctatoa elies;t0sruoio3io4om  mfcta( sDrmumpoo1tptomictyd a ul(vs;()aeeoir oydfpD  nesl( srur(o3iu4amenmfvtltfsDrrur oo1tlx mfctatlsDrmn p;t4 ltnmfcoadfaDeaueolt0s2xmim3no1amtelfeias)aruru ono1aee  iciad a umu p;u4arerxf ty1oaDr u s () rxmxmpiy4op e iviat)srumx  ;o4aeto ietytls2umnvs;t4 lxrmr3oodfpDrln o t srxr(r3oodlpeelfvs t) 2ra(mp;u0olxoifctadfmDrl(vpn() lerxfciy1lptrli o t  exo(o oy4op emivsl(fsruaump;t0optoiocild sDuauvp;()tlermr ia1omD  u s;t)srur(m3oy1aptnliei t)aDta(mpnu1aptoiieiatla eanvo;(0alerxfctydfa e n ol()texmirpiy1optelietlsfsDtaxrpou1alxn i3ilsfaDuaums;u4tltnxf3iytop r ies;t texmxo3ou4amenlicslsf 2ra( o;t0oeenifciyt m rmuvsnt)aeeoxr oo1lmDr ivolt)trtm(o3ou1omtn nvt (farur(rp;o4apto ociyd s rmn s;(0aeerif3iodla e i il() rxmxm3ou4lmtemfvta()s2trxmonu1ale iociatfa2el( on(0 rxrxo iytlat anvs;(  exmxm iy1op n fct sf Drmxrpot1aetomi3tlsfm2ea(mo;t4aeeriociy1lpDr ivi;t)srurxmpoo1lp  livslt) rrm( o;u1alt  ociatfm2eanmp t)aeermf3oa1lpD  ueslt0tetmxrpiu1ap n ics (fs2uaxro;u1aet  ocilsls em(vs t4aexoxfciodfmtr n i;s0 rxrxo3oo1ope  nesatfs2rmu  ;u1ape miciytlm2uanvs;t0altoxrcoy1faDrlueils sexo(r iodlpeelfes s)a2tru pnt4altn iciys a2el(ms (4teenmrcootoaDrlivo;t trtoxopno1opte ietlt aDurxm oo4texo oetydls2ua(vs () eerxf3todlmDeln o (0 2tm(r3iy1altnmnvsas srur(m ;u4aee moetytla2umums u)aexnmocoa1lpte ivolt trxmir no1ale mfesa()srraum ot4tpen fciasls uanmo;u0 rtoxf3iytop eliei;()texmir nu4oltnmnctat)srtmx  ;o0aptomieiytfm2ulu on()artrxrciatop  luvi;t trxrir oydalt mfei ( srumu ont1tlto oeiydls2rl(mpn(4texrmr3iadomDr uvsls0t2xr(o oo4llte ict s a2tmu  ;o0aexo o3iyt a elumon(0altrxf totop rlnvsls)t2tr(r3iy1lpt  fvtasf rraurp;o0olt ioetydla rl( o;t) lermfcootfmDrlnesls)srxmir nu1altnmfviat) 2tmurono0oet  ietyd s elu o () etomf3oatlm r uesls tetrxo iydom nlfeslt  rrrxm nt4oeenii3tltlm rlumo;(0 ltrxrciy1lmDe n o ( sruoimpou4lm n fetatfaDumxmpoo1oltomietaslm ua( s;u0 etoxr3ty1lmDrluvols)s2ur(m io4am nlfctat)aDta( pnu1apxo i3iaslmDum(mo;t0 rerxfctadlm  auvi (0 rum(mpno1al e ict (f Drrx ont1olxo f3tlsfa umnmpnt0 ltnmo oy1lm elivs t) 2trxr nodll e nei s) rrru p;o4oex iociyd a umn pnu)tltoir ta1fmDe ivi s0truoio nu4alenlfet s)s2ra(root1tltnmfeiatla2uan p;()tlerifcoo1lpD livs t0 exoirpio4olen nesls  rumur ;u1tlxoiictad m2rlu p;u)aexrio oo1omD aiesls)trxo(mpoydapt mfetas  rtm(mono4apxomfctld s rln pnu4 ltrxrcoatlatr nes s t2umxopoy1lpe mivt (  Drm(ro;o4opeoifeiydfs2ranvp;t0treoiocoydomteaiei s) 2tmio3nudap n netas)aDua(m ot4oeto fctad m2rau pnt)tetnmr iytlmD livi;( texrxr oo4op elncs tf Duaumpot1oeenmi3ilsfs ul( onu4 lxrxocoodla  aneils0t2xo(r oudlptemfet sf 2trxmoot4oexo iciyslmDrlnvo t4 ltnxo iadoatraueo t0teur(r3nydop e ivtlt arrm(rpoo4teenioeiat a rln p u4artnmoctodoate u ols srxmxo3oudap e iesa(fs2uaxrpnt1tee mfciytfaDuau sn(0 exrir tydfa   ieo;t teto(rpny4ame  nvta( artrx  nt1aptomi3iytfs rau o u4 leoxo3iy1lmDe nvils0t2toxm3nu1am e nctas a2ra(root1oexn f3iyslm ul(mo ()texnmo3oa1lpDr ivs;(0t2xm(opoo1ll elfvils)sruru p;u1teeniociasfa rau o t4 lxomr3iadomt livi;() etoimpiodam  mivslsfartm(root1olxo octasfs2rm(vs;t0 ltrif todfa e ivsls)srurim3iy4amtnmfesa(  2tmxmpot4ape iieiatla el(vo (4tlxomf tatfm elnvi t) etrxmpoo1al  livt tf Drm(ro;o1tptn f3iytla uauvsn() rtnmfciytomDran i;t0 2umim iy1lme micta( a2tr(r no0texoioetytls2ean ont4 eerxr3tadfaDeaieo s)s2uo(opiodamtemictltf 2tm(r oo4oeenmoetltlsDra(ms;(4trxnxoctatoa r nvols0trum(r3iy4ol   nci sf rrmumont0teeo i3tat m2uaums;u)aexomf iy1fa  aiei;( seumxr oo4lmee iei (fsrrr(rpoo0aptomfeiydlsDel(mo;t4tlenxrcoatop  anes;s)srtmio3nu1om nmfvsa() Dtm( pot1tpxn f3iadla2ulumont0teeoircoodlpte i ils) exoxr3io4op e ivi s)arumurp;o4apto feiytlaDuluvsnt)aexrio oy1faD an i t s2xo(m iy4omt lnes (faDua(rpot4opeomieilt sDumnvo;t4 lxrifciydlmt ai i t setrxo nu1optn fvtltfarurxrpnu1oexnmieiyt m ean pn()tetnio3ootfmtr ieo t sexrxm nu4op n nvi t  2ur(  ou4apeoiieiytlmDuanms;()alerxf3tadla e nvo;s) 2to(o oo4lltnmicias)sDraxmoou1ole ifetlt s ua(ms;u4trxrxr3iatlpD au ols0 ruoxr3iy4olte ivi s) ruax  ot4olxniociatls um( pnu)trenmociadom   neil(0texmim3ou4apenmivtatfs2ra(m nt1ale mo3tlt mDumn o;u0tltrxrcoy1fpD aueo t srur(m3ny1lp  mfvta( s2trxr ot1tlxnioetld a2ea(vs t4tleomocio1lat  uvils)srurir3ou4alenlicslsfaDuaxmo;o4tetnmieiltlsDra(ms u4 rtrxfcootlm e uvo;s trurir3iu4ll emnvil(faDrm(r nt1tlenif3iat s raums;u)aeerxr3iy1lmDrai i;t)s2umimpou4omtemivtlt srrmumont4oet  iciltlm ua(mo;t4aetoio to1lmtr nvs t0 eumxmpny1opeemfvtl( arum(mp;o1aetniicildlm2ua( s;t4 etrmrciy1fp rlu olt0trxmim3oy4ole  ics () Durum oo4apeo o3tls a uauvsnt)artnxf3todlaDeluvol(0srtr(opoodlleelivilt)s2ta( poo1apto i3ild m2eln o (0 lxrio tadfa r n s s)t2toirpou1lp nmietl(fs2ta( pou1apt mociytfm ul(vs;u)aexrmrcootfate iesl(  ruo(r io4lp elnetlsfsDrm( pou4alxoif3tadlaDemu s t) ltnxo iadlmtrln olt0sruoiopiydomtnmnvsl(f Durxm ;o4tlenmo3tldfaDeluvp (4aeerxr3ia1fpt lies;(0teuoiopiy1lpenmictlt aDtax  oo4apeoiicilsla2emu ont)aetnio tydomteauvi ( texmio iodoptelnciat  rum( oou1texnio3iatfaDrm( s u)alxrxo3oytfpD aiei;t) rur(m3oy4omtn ncilsf rur(m ;t0tltoifciaslaDumn o t) exoircty1la   ivolt0srtrir io4lpenlivt (faDrm(r ;u1tet iiciatla umnvp u4 etrmo iatfp eli s;()trtrio oy1ame lics (fsDtrx pou4alx  iciad mDua(mp (0trerif io1oat  ueo;(0sruoio nodll emnvi ()srua(monu4tpt  i3ilsfsDum(mpnt0 eenmr3iatomDr uvi;t0sexo(o oy4open nvsls)a2rmump;u4tlxoifetas aDem(vpnu4 renxrcoadlm rau slt t2um(rpoo4op emfcslt sDum(mpno1tleo i3iadfs uauvo t)artoxf iy1fpte ieils0 2toio3ou1ol  micsl() Duaxmo;o4teenmiciytfs2ean p;t) ltrmf ootopteau sl(0seuoim3nu1openmietas)artax  no4apeo ietlslm ua( p;(4aexomf3oytfp ranvi;() rxrirpoo4amtn ncilsfaDtmu  no4oexn f3ild sDum(msn(4 ltomrcoy1lmt lueo (0s2tm(o iy1llee nvtl(f 2rmxmp;o0oee  oeiyt m2elump (4 lenifctatfat anei s)setr(o3oydlleemfvias arua( oot0tpxoifcild mDrmn s;()arermo ia1opt lnes;t setm(opoudop nmfciltf Drrur ;t4aptnmfeiltfm rl(vo;u0trtnif oydfatr n s;s0 2toiopoy1lme mfei (f Dumum ou0tpxnioeiat a2rmuvonu0tetnmoctatfpD livi t t2xoxrpnudomeemnet s) Drm( pot4optomieiysfmDrl(vo;(0artoxr3iy1fatelivolt)seurxmpio1op emnvsls  2rmx onu1ape ioeias s uluvs u4aexrmf iydlm eai i s0 exo(r3iodlm emfvsat) Drmum ot4oeenifeiad s2uluvpnu4 rermo tytfmt lneolt seumxopiudlltelneilt) 2rrxm nt1aetomoeiadla rmump;(0aeenxocio1faDe uvils)sexmxrpoo1ope  ivtatfaDum( ont1apt io3iasfs eau o;(0aeerxo io1oaD lieo;s0truo(r3nydal  mies t  2rax  ;o4aetnmfetltla2em( s t4 ltrmoctotfaD  i o t)teumxm iu4amt mfcs sf 2um(r nt1opx mfciasfsDemumsn()alxoio totomDeaueo t)srumir io1ameemnesl(f Drm( pno1alxn i3tlsfsDelnmo;u4tltnxfcoytfp e i s;(0 eto(m oy1ol e iviasfa2tax pnt4alxnmietatfsDum(vsn(0 eenir tadom eaivo s0s2xmxo ny1omtn ncia(fsDum(r ;t1apeomietydlm2uanvsnu)tetnxf3oytfpte ivi s0s2xrxm3nodlpenlfcils)arum(mo;u1alxniieiatls umuvo (4tleoxrciatomteaneolt  rurxo nu1alee fvslsfaDta(m ;o4tlto feiysfa uluvonu4arxrifcootlpDr u s (0trto(o oy1lle lfcs t sDuaxr ot1olx mfeilt m2um( s u) eeomrcoa1om rlu o;s  rtm(o oudoptnlnetls a2rau oou0alxo o3iat a2rl(ms u0trxrmr oatfp rau olt) ruoim3iu4ap e iciatf Dta( pnu1tetn feiltla2raump;(4 rtnifcoo1fpt lu o;t)s2xrimpnudol  mnvt s  rrru  no0alxomo3iasfs rm(vp;(0aeermo3oatlmtrluesl() rxo(mpnodolte ncslt a2trurooo0oeto ieiad m elnmo;u4trxrmrcio1fpD  ivo;s0 rumxm oo4alen fetas)aDrrx pnu0tpx mfcils a2uln p;u)arxrxrciodlp r i s;t s2tm(o oo1omtemfeta(fa2rrxr ;o0alen fcild s2rmuvp () rxrxr ta1fp raivol(  etoim3iydop elfci sf Duru  nu4tptoii3iydfmDemums;u0texoxr oadlmD lu o t texrxo iodoltnmnctls)srrrx onu1tex ii3tydfm ulnmp t) exnif tytoa  ln olt  rtoim3oodom  mfet t) rrmxronu1ape mi3ils s2ra(vsnt4tlerir tatfpDean i t0 2tr(o3nydlpt micil( arrau  ot4tleomfciydlmDulu s;(0trxoxf3ia1fa  aiesl( sexoir nu1al   nvia(farumx oou0aeenmieiytls ulumont0 renmo totfp e ivs (  rtm(mpiu1om n fci t)arrrumonu1olt iictydfmDeau o;u4altoxf ty1fp rln o s  eto(o oy1omtn nvsas) rumxr ;o0aetnioeiad a2rl(mon() rtrircoy1oate ivo;s  2to(o nu1ome  ivi sfa2taur ;t4ape mfeiydla eaump;t4teenxrctodlpDr i s;(0trtriopio1omeelnesl(faDururoot4tpe i
\ No newline at end of file
@@ -0,0 +1 @@
+ivs t  rurxm3nydomtemfcs ( aDrau  nu4tltnmoeiadfsDelnvo u) eenmo oydop   ivs;(0s2umio3oydaltnmfctas s2tr(ro;o0ole  ictld m2rmnmo t4 exrirctadlmDrauvo;() exr(o3nudomtemfvs sf Dua( ooo1alxo ictltls rln p;t) ltnif3oatopDr nvs s seur(m io4ll n nvsat) Drm(mpnu1oetn o3taslsDrmnmont0aeenmfcoodfatelivi (0srtoir3oo1ape lfviltf rurum ot4aetoifciad m2eluvo u0 rtniocty1faDe nvo ( tetmxm oodole mfei t s2ua(mo;o0apx mf3iasfsDelump;u)treoxocio1opt aiesl(0 ruoxm ou4llt lfvsl(  rrau ooo1optnmfctys aDuau p;u0teerxf oadfptelieols setr(o3io4optnmfctl(farrmx o;u0aeen feiytls emu o (4aexnircta1fmDeanei t)s2toim3iu1amtn neia(fa2trum nu4texomfeiltls rm( s;t) rtoxo3oo1lpDe ueols)trum(o3no4ol nlfeilt)aDrrur ;u4tpx  oeils aDrm(vp (4 leniocto1lm  luvi;()t2xmio3oudame lncias srrm( pot0tet io3ilslsDeanmpn(0 etrxo3ootlmt anvi ( teum(r3oudoptn nctl( s2rax  ;t4altnioctaslm2um(vpn()alenio tatlmtr nvi ()t2tr(o nodol elics s srtrum ;t4aetomfetldfm rl(vp;u4artoio iytlp r i s (0 etoxr3oudamenmnviltfa2rmump;o1alt  fetatfm eluvp t0trxnmf3tadlm r i olt0truoxopiu4oltemfvt s) 2tax  ot1tetnmoeias a em(vsn(4tltoxf tatoaD aivo () etrxrpoy1omtelncsltf 2tmx o;t1altnio3tytfsDemn sn(0 exoxr tadomt aivi;s0sexrxopoudlle  ivs tfsrurum ;t0oex  oetlsfmDra(ms t4teenxo3iy1lm ean s s s2xm(o3nodlp eliesas)s2raxrono0aeeo ietadls ulumsn(4arerifctotlate neol() etrxo3iu4ameelnctls) Dum(mooo1texo ociys aDuanmo;(0 exrxr3iy1fp ran i (0sexrxr iu4lmen nei () rrrxr nu1aexo octld sDrlnvs (0trtnxo3oydoa eluvs s)srxrxm3ou1altemncs s s2umurono4ape mfctlsfmDrm(vs;t4 leoio3oytlaDe n o (0texoxrpoydolee icsls srtax o;t0opxnmieilsfa rl(mon(0tltrmo oodlptrln i ()teur(m3oydolte neslsfsDrrxmpoo4tlenif3tad m rlnvo (4texrxr oa1fm e nei;s)tetoiopny4alee ncsatf 2urx  ;o1alen f3iyd s uln o;t4altnxfciytla e n il( trxoim3nudomtnlfvsas sDtmx pnt1opxoiieiadfs2rmumpnu)trenmo todfmte nes;(0 2to(r3oydopee fcs (fsDuau pnu0oeeoifetlsfm rlnmo (0aexnxf totfm eluvil( srxrir oy4ale lfvi ( s2urum nu1oet mi3iytfa2rau s;u0aleoifcoadlat au ilt) etmxrpiudalen fvs tf 2rrxr ;u0opxn ociyd sDran o;(0teerio3tydomtraueo s teuo(rpiy1ope lfes ()aDum(ro;t4alxo o3iad m ulnmpnu4arxrxf oytfpDeli i;()sruoiopoy4lptnmfcs t) rrrxmont0oetomfeiadlmDrl( s;u)arxrxfciy1fpDeli s s0setoxrpnydolee netas)a2ta(  ;o4aee ifeiatlmDrmnmo;u0arxomrciatlptraneo;( trum(r ny4ap e nctat) Drrxmoot1tlen fctld s2ra(ms;t) rtnmr tadlpD lieo t0srxmio iu1amt  iesltfsrtmum no0aetnioetysfs rmump;()trtnmf ta1lmte nvs ( s2to(r ny1opee netasfsrtm( p;t0oltn ociytfm ranmo ()arenxrcootomDeln i s) rxmimpoy1lmtnlicslt  2rrxrp;o1oetoifctydla uanmont0alxomf ia1laDe iei t  etmirpnudlpe  fvias)aDta(m no4oetomfeiys m eaumon()arxrmrcoatopDr ues t0 rurxm iudapeemnvilt) Dur(r no0tptnmf3iat aDrmnmpnu0 eeoxfcoadfmDrli olt  eurxm3oydlmenmivt (fsDur(m no0olx if3iyt m emu s t4trtnxf tydlpt  i o;t)teuo(r3nu1ll elnvs sfaDrr(rp;o1alx  ociadfsDelu s;u4aeeoxr3iotlpDrlieils0trxr(m3ou1ap nlivta() Duaum ;t1opto f3tlsfs rlump u4 rtnxr iytomtrluvo ()s2urxm oudaptn fvsl( aDrm(mono1opt mietytfa2eluvo t4alxrxfciadlp e uvi ( truoir3iy1ape  neils)arrruroot0oetomiciasfs2em(vp;u4tlxrio3oo1fptran i;(0 eurxo3ou4omeemfvsa(farrruro;o0alt iiciasfsDum(vpnt)arxoir3oodomDran i t)s2xrxr ou4lmte ivil( arumx  nu1aex iicils mDua(mpnt0texomfcio1fpt  ieo t s2umxr nudape lieia( artm(roou0aeeo fciatfmDua(vp;()trerxf3oy1fptraneolt) etm(opny4ol   neias)arurxmoot4optnif3iad s2rm(mp;u)aetriocoo1fp eauvo t) exo(o3oodll   icsa( aDraumono0tpxnio3tydls2umu pn(0aeerifctytom ran s ( s2xm(r nydal   fctlsfa2trxmpnt1aeenmoeiytfaDea(vp;()alxrmo tytlaDrlnei;t)texoxm3oo1lpenlnvsas)a2rr(m ;o1olx ioctydfsDuauvon()aetrmo ootla   nvo;s  rurio3iu4optelfei s)sDta(rpno4tpt  o3iydlm umuvonu)tlerxfctotlm rln o;s) rxo(r nu4ame lfet t)a2umx p;o0opxn iciasfa2uanmo (0aexriociatoa   uei t0 2xrxrpiy4omt  ncsas)aDraxmo;u0olenifciytfsDulnvp u0artnxf3ootlm e n s;s)srtmxmpno1lmtnlfetat s2ta(rpoo1tle mietldfm2eln p;u4 renxrctydfa   u ols0 etm(o3nudapeemncsat)s2uaumpot4oet  o3ils a ea(mo ()trxrmo3totlmD  ieo (0 exrir io4am   neta()aDuax  ;o1optoii3ias aDuanms;t0teerir3ia1lm  anvsls  eumxm io1apen fvs (fsrra(  ou1oexnmi3ilslm2emu s;u4 etoio ia1fmt luvol()t2tmir3nudoltelncsltf Dum(  ou4ope ifciltls2uanvsnt4 exoxo3todoatelu i s  rumir3iudap   nvil(fs2uaumooo0ape mietlsla2rlnvpn(4 rtnmrctydomtrau o;()s2xo(rpny1ol nmivslt  rtmx  ou4alxomfetys m2uanvonu)alxnxr tadlm e u ol(0srur(mpiydalte iet sf 2rmxr nt0apenio3ildfa2ranvp;u)alenxo tatopDeau sl(0s2to(o3iy1ap emfciltf 2uau  no1aleo iciytls2um(mp;t0 eeoif ootomDr ivi;s0s2toxo3oy4ap nmnci t arraxr ot1tetoifctltfa ean pnu0 rtnifctotlmDelivo;s0 euo(opno4omtelfetls s2ra(m nu1teenmi3tad m eluvo;u)arermr io1oate nes s trtrxmpoudlmeemncia(fa2urxm nt1teto iciys mDrmuvs u0 reoxf3iotlaDrau s t s2xoxo ny1am emnet s s2ur( ooo1tetoifetys a uaumon(4aeenxr ty1lp  aneo;t0s2toxo3io1olte net (f 2umxmo;o0aptniieiytfs el( ont) etoxo iotom eau s () rumxm3oodllt  fvs sfsDrrx  ou4tlenmfctad mDeau s;(4tetnio3totlpD an s;s0 rtoirpoodomenmfvtl()sruau  ou0openmf3tat m2emuvp;(0treomr3oodlm rlnes s) 2trirpno4opt lfeiat) 2rmu pnt0ole miciadlm em(vp t) eenxo3oatlmt anvs;t  rxoxm iy4openlneias)aDumxr nt0opt miciasfm2elumonu4 rxrmocootfm  lneol()srxr(o no4alt mfvi tfsrraxrpno0aeeomfcild a2ulnms u4tleoif3tydfmtr nvi;s0s2uo(r3nu4altnmivs ( srtmur no0aet  ictasfa eluvo (0teerxo3oo1lmt  i sl(0tetoxopou4opeelneilsfsrrm(m nu1apx mictlslmDumumonu0tlxrircty1la e nvi;t0s2xmim3no1ome lictas) rtrxroot0aexnif3tyslmDelumpnt)arxnxo3to1fm e i il( tetrxopny1ap emieias  Drruroot1openmfeiatfmDrauvo;(0 renif iadlp elivo;s setmxo3nu4lpee iei (  Dururp;o0alx  iciatfa2ulumpn(0trxrxrciy1oa  auesl()teto(o3no4llt  nvt s sDumx pot4oet  fciytfs ulu sn(0 exnmf3ia1lp eaivs;s sruoxrpiodamtelivsls a2uaxm ot0aetnmfeiytla ranvo;(4 eerxf ta1om r nvsls s2xoxopou1altnliet ( a2umump;u1aeeoif3tlslsDum(mp (4 rxoir oatoa elieolt0s2ur(o iu4oltn ietlsfsrumur no4aetn iciytfm2ulu sn()aetnmr iodlmteln o t0trxo(opio4altnlnvta()sDrr( pot0opxn ocildlsDrauvo;u)teermrciotfptrlu o;(0trxoio oydap   neilsfartmur nu4oeeoii3iydfaDelu s u4tlxrifcta1fmDelies;s0teto(r iodlpt  icil(fsruaxront1oet mi3tydlmDrm( p;t)teenmfctadlaD  u s t0 etmir3nydlme  ict t artmum oo1alenif3iydlaDel(mon(4tltrxr tytfp  an s ()trxoir iu4altn icil( aDtaxr nt1tleoifctldfm ranms;u4texnmf3iodlp  lnvo;s0tetr(r iu1amte nvsas sDumx  nu0olx moeilslm2eln sn(4 eerxfcoodlp  lu slt0 2toxm3iy1ope lict s aDtr( oot4tpxomo3iydfs rauvon(4 rxoio to1fmD aueo t tetrim oydlmeelfvilsfartmu pnt0ale mo3iat aDumu o;t)artnxo3todfat luvil( s2trirpoo4amenmfvsatf 2tax  ;t4oetomi3iatfsDem(von(0tetomf3io1fpD  ueslt)setmimpio4ale lnvta( aDrrx  no1oexo ocildlsDul(msnt0areoirciy1fmt an ils  2xm(mpiydlleemfeiasfarur(  oo1tpt ifciatls eanmp t4teenmo iotla rlnvo;()texoxopny4lm emfeil(  Drrump;o1tpxoifeiydfmDulnmsn() rxoxf3ia1om rai o t0trxmir oo4olen neil(  2tm( pno0tet mieiasfsDum(mo u0tetoxr ty1laDeluvol()trtoxo iy1ll  lfcil()sDua( oot0tlenmfctasfa rmuvo;u0trtnxo3iodfaDe uesl(0teuriopno4lpt lfcs t artrurp;t4oex mfeiltlmDulnvs u0 eeomoctadfpDr ieo t srxoir3oudomenmfeta( s2taxrp;o0oexoifcils m ean p;t)trxnxf3iatfmD  ivo s teum(r3iy4am e fci tfaDrmx o;o0ape iieiatlaDumumo;u0 renxr io1opt  nei;t)t2trxr nu4lpe  nvsatfsDuax  oo1oeenmfeiys m raumpn(4 leomfcoa1op rli i t0s2umio3oudameemiciltf Drm( p;u1opxniieildfm2umuvs;u4tltoir oodopt auvolt0 rur(mpno1lmt  fetltfsDtrxrpno1aeto ictatlm um(vs t0aexomfcoatfp raiesl()trto(m iu1omt lici t aDtau ono0aexniieiltla eau s u4areriocoadfateaues s) 2xrxopiudamtn net s) rra(rpot4tpxn i3iytla2elnvo t0trtomr3oydlp rliei t  rumxopnydop n nvsas  Draxmoot1aetomoeildfa ranvp ()tetoxr3oy1oa e ues;(0t2xriopio4om  lict t)a2rr(mpot4tpe mfeildfmDumums (4tlerxocoytfmDelnei;()s2trir nydopte fcsas arrau  oo1aeen oetldls2ul(vp;t4 rxoxf iytlpD  uesl() 2to(mpiodamtelfct (f Dtr( o;u4tptnio3ias m ua(mo;u) ltrxo oodlaD auei t0trtm(r3io4ame lfci t sDumxr ;t4olx miciatlaDuau s u0tltrmr3tydlpDeln o;() 2trim oy1omtn icilt)a2rmxrp;o4teeomfeiltfaDrlu p;(0 lerircoadlateau i;t0tetmimpoy4amt  fcsl(  2rrump;u1altoifctldlm2emnvsn(4 exomo3oy1op rlivsl(  etrir oodomtnmfvias a2uaxrooo4oltn fctadfs ranvp (0alxomr3totop rauvo;(0 2toxr3iudam elnctl(faDrmx  nu4apto i3tydla2ra(vs;u4areomf3iotfmD lnvo;t0 rur(m ny1alte nct t) rtaxmpnt4aet iieildla ranvon(0tltrmf oy1lpD aies s  rtoim no4altnlnes t)arrmxrpno0oeeo iciyt sDel(vp;u) exnmr tytlmDranvsls  eurxr3io1ol   nci s aDtrx  nu4oee ioetldfa uanvs (4altnir3iatoat au o;( t2xmio nydale lnvt t)arrax o;o4opxnmo3iysfa2uaumpnt4 etoif3iatfm eaivo;s0 2toxo3oo1lmee fet (farua(mpnt1tpe mfciysfa em( s;t) lerxo ty1om rlieo;( s2xm(opoy4ap   ictl() rtmx  ot0oltnio3iaslaDrmnms t) ltoif3iotlptelues t0 etoimpiydlp   icsatf 2rau pnu0ale if3iatfa2el( p;u4alxnio3io1laDran il(0teurio nudopeemietl() rrrx p;t0olt  oeildls ua(vs;(0tetrmocto1lpD  ueslt0srxo(r nu1oleelfci ()artax  no4tet iocils aDumumo;t4tlermf3ta1fatelueo;t) 2xo(m nudol emfei (  2rmxr nu4optniiciyt a rmu o;(4 rxnmocio1fpDelies ( seum(o ou4omtn nvi t aDtrx pno4ale mi3iatls2umnms;(4teenxr3oytoa   uvo s0trxm(o3nu4alt lfvt t) Dtru  nu0aexoiiciltls rmnmon(4trxoxf iytfpD lu i;t  2tr(rpiu1op elfcil(farra(mp;t4oeeo o3tltla elnms (0altrmo3oa1lmDr i i;() 2urxrpoodapt lfei (fsDua(  nt0oeenifeilsfaDum( p;u0tleomr3to1lptranesl(  etmxm nu1lltnmneias)arraumpot1apto i3iadlsDemnms t) eerxo tadom   ivs;s  2tm(m oudalt lneiat arumxro;o0altomociasfaDea(msn()altoifciy1fmteliesls0 2xoimpny1apte ieiltf rum(r ;t0tex ii3tat a2eanvo;t0tltrif ta1lm  lieilt0 2tr(r3nudllt mncil(  rrrurp;u0tlx ifeias m2ul(mpn() etriociydla ranvo () 2xr(r nudomt  fvia(fa2umur nu1tpe ioetadlm2umuvp (4 etnif todoa  lnesls seto(r iy4lpenmnetltf Dtrumpot4apxnmi3ilslmDum( s;(4 rtrir oa1lpt lueils  euoio3nu4lmtemneilt aDumxrpnt4apt ioctydls2emnvp;()alerio3ta1lpte n s ( trtmio3nudol elicslt sDrrxm nt4oetn ocilt a rauvp u0alxnmocoa1lm e ieols  rurxr io4omenlietls) Dtru pnt1tle iieiytlmDul(ms t)treomf3iotfaDraivo t  2umimpiudam e fct (f Drmxrpnt4opt iieiytla umn o;t)arenirctodlatr ies;t)srtoio3nodam  mfvtl(  2rm(rooo4oex io3iysfm em(vo;t)alxnxo3iodlmteaueo s s2um(m oydam   ivs (fsDtruro;o0tlx mo3tyslaDrlnms;t) rxrmf iatoat  nvil(0setoio3oo1apenlfcslsf rtm(rp;u4oleoiociyd s rau p u0tlenxfcoodopt  uvsl()srtr(m3nu4ll n ivs (f rtm(rpou0aex  fcilt a rm( s;()trxnxf tadomt aivil()setoxm ou1ape lnctat) 2ta(monu1tlxo f3iasfm2elu o;() etnir3iotfpDelnvs;t0 rtrirpoodalte nesas s2tmxrpoo4tle mi3iat aDumn s (4 leomf3oytlpt aivi;t0 2uoxo3oudole lnciat) rua(r ;u4aeen fciytfm2emu p;u4tlerio3io1lpDrli slt0s2tmxopio1ol   feslt)sDtm(mo;u0tpxoio3tydfa uaumonu) etnmf iy1opteauvi;t)s2tr(mpnydop n fcs t sDtrumooo4tetnmietysfmDeluvp u0 lxoxo3oadla eluvs;t) rxr(rpou1aptn fcil( srrr(ro;o4opxomiciltlmDrmumo u) exoif3totoa r nes s sexoxmpnu4lme mnvslt  rrrxr ;o1olxnmoeiyd m2umnms;t)arxnxrcoatlm elieol(  etrir3oydllee ieils s2tr(mooo0opt iiciadfs2uanvo;(4arenio oadfatr nei;()texm(opiudap n fcs tfs2ta(moot1tpto feild a uln snt4tlxriocoatfp ranei (0trum(r3iu4lpe  fciat)a2uaxmpou1alxnioetyt a eauvp;(0areoxoctodfatrai i;(0s2trir nydlm e fetas aDrax p;u1opto ietys aDuan p;t4 etriocoydopte uvi () 2um(o3oy1lpe mivil()artrxmonu4aptoioeiysfs el(msn()texrif3tatfate ieolt)seuo(o oo1optnlfeslt srraxmooo0aeenmiciadls2umuvo t0altoio3oy1omDr nes;t0seuoxo iydlmt mivi tfsDuaumpot0opxomiciyd m um(ms;t0 exomfciodlpte neolt srxr(opoydapt lncsltf 2trurono0aee ifeiys aDel(vo;t)altomr3todlpD ln s t)t2to(r3ou4om   nvias artmxmp;u1tex  ociadls rlu pnt4 exoio3tydla rlnei;s s2um(o iy1aptemneiasfa2um(mpot1alenmiciad sDrmn o;u4arxoir tatfm eanes (0 eur(m ny1om  livs sf rtm(mpno1tpx  oeilsla2ulu on(0 eerxr to1latelueol(0t2xmir3nu1lpe  nesatf Drax onu1ope mfctysfm ra(mont0tetniociodfaD lies;() 2toim3oodlm elfeta( s2umum ou0oeeo feiytfsDuau s u4 leomf3totlmtr n olt) rtrimpnu1lp emivs tfsDtrum ou1tlenii3iysfmDua( s;()artrir3ty1la e uei;t0seurio3iy4op  lfvsl( arrmu ono1oexomoeiasls2umnvp;(0 rerxr totfpteli s;s s2trxr nydapt miviat) Duru p;t0tptnif3tyt mDrau on(0 reoxr tytlm   ivo t0 2toxrpoo4ome mnci ()a2uax  nt1apx mf3iyd s ea(mp;(0tlenir3iatfaDrlnvil(0trto(m nydlptnmneias) rtmx  ot1oetnmocilslm ul(mp t0altrxrctydopD  uvs;s  rxmirpiodll nmncs s aDur(rp;t0oeto f3tasfaDelnms (0 eeoifcty1fmDelu i s  2ur(rpiu4oleemfeta(  ruax o;t4ope io3iat aDuan o t4tetoxr3iatfa elnvs s)seurir oo4al emfesas) 2umurono1tltoioeiat mDel(vp t0teerifciytlaDelieil(0srur(m no1lpte fvsl(fartm(moot1tlxnifetltfm um( snt4texnmocoydfpt  nvo s  2xrio3ou4ape lnci () 2umxm no1oleomf3iysla2emu s;(4 etoir3tatlat ln s s)setm(rpio4ap emnetat)artrur ;o0tpen octldls em(msnu4alxrxr tatfaDrluei;s  ruoirpoo4lm  lfvtlt)s2urx poo1texn ieiyd mDrl(mo;t)tlxoxo3oy1fa   ivil( srxm(opoy1olt  nctltf 2rmxmoot4tpe io3tldfaDea(vsnu0 lxoiocootlptr ivol(0t2xmiopiodalt  fvi tf 2um(  ;u1apeo i3ils a2umn s;(0 rxrio3todlaD ai ils0 2trimpno4lle mfetl(f 2umu o;o1olxoioeiatla umnmo;u0tleoxo3ootom  luvi s)t2tm(opiydolen nci t)a2ra(r ;u1tpxomfciatlaDel(mpn() rxomf tadlpDelivo t0t2xo(m3iu1om e nvta(faDuru  ;u0tetn f3tld a ua(mp;(0 ltoxo3oa1fp  li il( s2toirpiy1omt lieslt) Dumu p;t1oee mieiys m ulnmo t)aexoif3iodlp  ln o;t) exrio no1lleemfcil(  2ur(m ;o1apxniieilsfa rlumo t)teerxf iy1lat lu i s) etrio ny1omtelfvtl()s2rmxmo;u4aeto oeiltfs2ranmo t) ltomr iy1fa eln o s texm(mpio1lltn ietlt aDrmx oot4tptoioeiasfs rm(vp t) rxomrctytoaDe i o;t  etmxrpnydll nmivi t  Dra(root4tpto fetytla el( o;()alxnmfcoytlmDeln o s)sexoio3iy4oltemiviltfarrrx o;t4oex ioctasfaDemn pnu4 etoif3ia1lp eaies s  rur(m3iudlltnlnvtas arur(ronu4olt iocildfs2ran pnt4tetnmr3to1omtrlivi t sexrxo3io1lp e fci ( sDtax p;u1tpt ioctasls2ul(vsn()arerxr3oadfatraivo;s  rxrxopiy4ol nlnvi t  2raur ot4tet moetytla rmnvp;(4arenio3oo1omt  ieo s  rxoxr nu4alenlncsl()aDrmxr ;t1texomo3iyt s uaumo;u0tetnifcoy1om e uvi;( teumiopoodlm emicta( srrmxro;u1tleomiciytls2ua(mo u4teeomf tydfpDrli sl()s2xo(m nydaptnlfeiat srtm(monu1optoiieilslmDumn s;u) rxrmf3oy1fpDraivi;t0 2trxrpno1ap  lnctl()srtaxmonu4texnmociyt mDrau o t)tlxoif3iadopDeanvi ()seumxo oo1lm nmfetatfaruau  ou1oetomociytfs rmn p;u4texnifcoydfa rlnes t  rxmxm3iy1amt  ict s) 2uax  no4oex ifeiyt m2ran onu0 leoxfctydoate neo;t0seuoim iu1lpeelictat  Dua(mpnu4tetomieilsls2eauvp (4 exrmo3iytlptrlnvs s) exmirpou1omtn nvsls)aDra(  ;o0alxniieiyd a rmnvs (4aetnirciotlmt lueilt seuoxm3ou4opeelnctlsfs2rrx  ;o4apx  ociltlm2ulnvp;t0aeeoxf io1fpD lneils) rumir ou4ope lnvi () 2tmum nt0olxnmocilsfa2ulumonu) ltrxo3oadomtr i i;t  2urir iu4opeelneias)a2umx pou1oltn ociltfm2uan p (0altriociadfa rln i;s0 rtmxmpnodape lfeilsfsrtmxrpot0altoiieiyd s2em(vo (4 ltnxfctadlptraneo;(  2toim3iy4al   fetlt s2ta(ro;o0oexnifeilt sDemu o;t4tlxrxf3oydfa eaies s0srxmxopoydlmtemics t  2rm(rpno0tpx ifetysfa emuvo;t) etoif oatfaDrlu olt trurir3ny4ll nlieiat)srrm(  nu1oeto octls m2ran s (4tetrmfcio1opDr u ol(0t2urirpno4opeelivsltf rrmurooo1tet moctys s2emn o (4trenxf ty1oa  lneolt0s2toxo3io4amen feil( a2tmx oot1tex  fciydfs2rlu s;u)arxnifctadoptelnes t0s2trxmpiu1llenlfctlsfsrum(ront1apxn fciydfs ul(vsn(4 etrmr ootlpDr neslt0teum(opno1lpen ici ( s2trumooo1oleomiciltls em(mp;t4arerir3iotfmtelu sls0t2trirpiy1aleemfvs () 2rrxmpnu1oltoii3tadfm rmnvo (4aetrmr totfp e i sl()trumxr3oodlmt mnvtl(farrr(r ;o4aetomoeiltlaDuluvsn(0teerxociatomDe ivi t0trtoxr io1llt mfviasf rua( pou1alx iieiydfs2um( s;u4 eenircia1omt ln o s0trxm(r iodlmen iet t  rtrx  nu4tee  ieiadls rmumont)arxrxrcio1lateanvols0 etmir iydome  ieils) Dta(ro;t0apenioctlsls emump;() rtoxfciydfpDr ivi t0s2xmxo nudll n ivilt)aDumu  oo1apxomf3iysls uan p (0 reoxf ta1opt lues;t  etrxr oodaltnlnet sfsrumu oot1aex  ietasla ea(mo;u) renmr3iydfp  lnvs;t  ruoxr iy1ll emncil( artrx  ;o0oee ifciysla2ra(ms (4aeenir oydop elieo;t0 2xo(mpoy1alen ieilsfsrumx pnt0tle ifeiltfaDraumo;u0aetoxfciotfa   n o;s)seuoimpou4aptelnvsatf rrr(mo;u0tlto oeildfa2umn pn()texoio3to1op e n o;s texo(m3iy4apte ieias a2umxmooo1opxoif3tat a2ua( s u)texomf3iytla rlnes;( t2toxo nu4omee fesasfarrrx pou4alxnmicilsfm um( s u0 exomr3to1lm e n i;s s2umir3iy4omenliciltfartmx o;u4opx mfctytls uaums;(4trerxf3ootfmD  ues s) 2umirpiodamtemnci (f 2tmxmont0teeomf3tadfs2el( o;t) eerxocoa1la r nvs ()trxmimpoo1op elneil( s2taumpnt4tetnmo3tyd s2ea(ms t4trtrxo3io1oa eaivo;s)teum(m nu4om n ivsa()a2ua( ont0aexo octltls2umumsnt)arerxrcto1oa e i i;s) rxr(o3oodaleemics t) 2raumo;t0opxnio3ilsfs emnvs;u)tltnmocoytla raneo s)srxo(m io1apeelfes t s2tm(mono4olt mi3iys aDelump u0 leoxo oadfp  aivi (  exrio nydlmtnmies (f Dtr( o;u4aexomfcilt mDrmnmp;()tetoxo oa1oaD  nvi;(0seum(m3nudop emfcias sDtru o;t4aeen f3ias mDemu p (0tlxoxrciadlp rauvs;s)t2xrir3iu4omeelfvtls)sruru p;o0tpxnmoetytlaDrl( p;t)alxrmrcoo1fa ean i;s trxrxr no1al   nvi t)sDraxroou0oet ifciat sDeanvpn(0 lxrxf iydlp   uesls0setmimpoo1ll  mnciat sDurxmpoo0tetn o3tatfa ea(von()tltoxo3oodoa e uvol( trtr(opio1oltn fesls sDurumoou0apt moeiadlmDuanmpnt)artnifcty1lmte nvi;(  rtoxo iu1ale  ivilt) rrm( oot4aee ifctytlaDelnmonu) rxomf3iytop rlneo;t  2uoxrpiodlmtemicias  2umu o;o1tlx iieiasfsDua(vo;t)trxnxo3oytfmDelnvils)t2um(r3oo4ll   nctl( s2trxro;o1tpx  oeiaslm el(mp t0treoir iytlmtr uvo s)texmirpiu4ale lnei ( sDtrur ;t0aleo icildls ra( s t4 rtomf oatfaDraneo;s0s2to(rpoodll nlnvtasfa2tru o;o1olx  oeias aDranmonu4 etnmo3tatfpte u i;s  2xoxmpoy4aptnmfvtatfs2taurp;o4apxn oetadfa2eau p t0aexomfctatlpD aneil() etr(m3ou4ol emivi ()sDumu p;t0alenioetyt m2umnmsnu4trxnmo3oo1oat ai i;()seumxm nu4ameemiesat)s2rmump;o0apx  icild m2eaump t)aleoif tatlate uvo;s)srurxr nudome mfci s) 2tmxrpot1alt  f3iysfm umnvo t4 ltrxr to1faDeauesl() 2urirpiydapeelfvs s) Duax ooo1texoiiciat m2em( pn(4altnmrctydfpDelneol( sexmim3oy4olt  ictas  rtmx oot4tltnmieiyt a em( s;t4teenifctodla   ivi t0s2xmim3oydllen ict t)artaxrp;o0tlto ociadfmDeanmp;t4trxoio oytfaDranvi t)t2uo(mpiy1apte ivsas  Dtru poo0opto o3iyd a2umu pnt4 exoxf3oadfat  ivi t  2tmxr iodopt mfvtat a2umump;u4tle  oeiys a2em(vs;()alxoir3ta1lmtrlivols0t2uoxrpoo1ap   fcsat srta(  ou1opx mfeiys s2um(vp (0trxnif3todoa rlnvols0 2tr(r3iodom e icilsf Dumxr no0oexnmicils a2umnmo t4 rxrircoodomt aiei;() rxmio oo4aleemfvil(f rrr(mpno0opxomo3tadfs2rau snu)arenmr oodoate ueol(  rxoxr3nu4lm nmictltfsrtr(mpnt1optomiciytla2um( o;()texnmr3tadfp rlu o;()t2toxopnodop nmicias) Duax ont1tpx mfciys a emn p (0alxoxfcia1fmD aueo t) euoirpnu1ape liesatfsDtmxmonu1aetn i3iatfs2umn o t0 eermr3ty1fpDelivol()trtrirpnu4lmee fcias a2trxmpou4oexomo3ildlaDrlnmsnu)artomrcoytom eauvi;( t2trxr ny4ameelnes s)sDtmu  nu1apxnii3tat m ra(mont)aetnxr3iodfp elueo;()s2tm(opnudapt  fvsls) Dtrur oo1tlxniieiasfm2rmn p (0alerir tatopDeauvo s0teum(o3nydalt livsas)aDurxrpnt1oltnmoctldfsDemnvpnt4 rtnio oy1fa r u i ()srtrxm3iy1ape lfvtasfsDumxr ou0alx mo3iltlm ea(vs;u0 lxrxrcio1lm r i o s0 2toxm oudameemncsa(  2tr(mont0tet iieias s2em(vs t)alerxfcoodom raivs t  euoir io1ape mncslsfs2umxr nt0optn iciyd s em(vo t4altoircio1oaDrlues s srumxm3nydom e ncsl(faDra(mpoo0olxn ocildfa ra(mo () rermociydoa eanei s setmxopoudll nlivs sf Dtr( p;u1tleomfctydfsDeaump t)aetnio3ta1lp rlivo;s0trxoxopno4ap   ncsas sruau pnt4tleoio3ias sDeln s ()alenmf3iodoaDean s s0 2xoxr ny4oltn fvt t)a2rmxmp;o1oltomi3iatls rluvs u) lxrmociy1lm rli slt)t2xoir3iy1lmtnmfviat s2uau o;u0texomfeiatlm2raumo t0artnxr ty1faDelies;t0srumir nudlpte icilsfa2taurpot4oet ii3iys m ea(vp u0 leoio iydopte nvslt0 rxoim3iy1ol  lfci t aDraumoou4oltnmictadlmDua( s ()trxnxo totlaDeauei ( tetmxm3oy1ame mfesls)srtmx  nu0tpen i3tltlaDrlu s;u4alenmf3iodfmD  nvo;s) euoim3oudamtn ivs ( sDua(mo;t1tee ioeiadlm2em( o u)tlxrxo io1fm   ivo;s0setrxr no1ll e iet t)aDrr(rp;o0oleo o3ilsla2ua(msnt) leomrcoo1fa r n s ()seur(r3iydoptnlfviat  ruau p;o4opeo f3iydlm em(vo;(0teeomo oy1fm r n o;(  etrir ou1apenmneia(farumxm ou0olto f3iatlm2ul( o () exrmf3iotom elnes;t0 2xm(mpoy1ol  mnviat)a2urumo;u1oltniocildfa ul(mo u4trxoif3oo1fpDr ivslt0s2tm(mpnu1lm emneta( aDtmu  ;o4oeeo o3ildfaDeanmp;u)texomf3oadfptrau i;() 2xmxopiy4altn nvsls) Drmxrp;o0ape moetltlaDuauvo t0 leoxf oy1lmtrluvi t)trtrxo3iy4lptemfvslsfsDurur ot4texnmictytla2eanmpn(0 ltnmoctodfa  lnvi (0 eumxopiu1lmt  fvsas)sDumum no4tpxo fctldfaDul(vo;(0tlermocta1lpteauvsls) 2xm(o iy4aptnmfeslt srtaxr no1aleo fcilt a2ran p;u)texnxr3oodom e neo t0t2tmxm oodomtemfct s) 2tmx oou1alt mfetas s2rl(vo (0trxomf tatfp   ies t trto(r oodapt mivia(fs2rmurpno1apt ifctyslsDulumont0 ltoxf3tydlpt auvo s  ruoim iy1ole  fvtlsf Dtau  oo0opeomiciytfmDuanmsn(4 etomo iadfm r nei;() 2um(m3io4lpte feslt  2raumpoo1tpe mociltfa2rl( pn(0alxnxrctydfaDeai s;() rtoxo3iu1llt  fctat sDtr(mpot0tlxnmo3iltfa2uluvp;t4tltrmf tytla elnvo;t s2xr(opiy4op   nvi (farum(roou4apto feiysfa ulu o t)aleoircio1fpDrln sl( truoxrpoo1lpeelivtat s2tm(  ;o4apeomf3iysfa rln s u4 rtoio3iatoa rluesls) 2tmxrpny1openmnvt t)aDraxrono1oexnmocilt a umnvp u4trxrxo3oa1lmDrau o t)srxmxm3iu1ap nlfes s)srtrx pno1opt  fcils m rlnmp;u)trenxr3oy1faDraieols) etmir3oo1om nmivtas)s2ta( p;u1apt mf3iyd sDum(vp;() ltomf3ta1lpt lu o;(0 rxm(o3io4lptnmnesls) Dtmurooo1teeniiciyslsDeaump u) etnmf3to1fat au i;s  rtmxr3iu1al n nesas sruaur ot0oex mfeiadlm2el(mp;u4teeomo3totlp r ivi;t0s2um(o3ou4lm   ivi s) rta( oot4tptoioctlt a2ea(vonu4tltrxocty1om  lnvols0 ruo(o no4ap  miviat)a2umxro;t4tpx mociadfs rlump;(0 ltomf3oydopDeanvs t0 2uo(r3oodomtnmnvsa(farua(rpot1aetn i3iytfa ranvp;u0teeoxf3iatlm eaueil()t2tmxr3oo1lpt mfvias s2rax  no0tee io3iad a2um( sn(0areomr oodomt  n i s)teumxm iu4lleemnesls)a2ta(ront0apenmieilt a uauvs;t0tetrxf3iotlpDeaueolt  rxmim iu4opt lieta( a2ta(r ;u0alenmo3iadla2ulnvsnt)teenmrcoy1fmDranvsl(0 rumxopnu1ap elieias)sDtr( poo1aexoifctad s umump;t4 eermr iatomtr u s (0teuo(rpoo4am e icsasfsrrrx pno1tlt moetlslsDrmn snu4 renif3oa1opDrluvi (  2tm(r3no4lp n ncsasf Drmxrpou4aleomi3tltlm uan pnt) rtnir ia1oatrlneo t0 2tmio3iy1apenmietls)srumx ooo1oleniieilsfs eanvp;u) rxomo3oytomDr ivi t  rurxopiy4ap  mnet () Dtmur ;t1alenmf3tlt a uaums t0 lxomr iytfa r ues;s)seuo(opoudoleelfvsl() ruaur ;u1tlt moeiadla rm( p u0arxoio3iotlpDr ies s0 2ur(mpio4llt lics s  2trurpou0aptnmfciltlsDumn p;u4aexrxf3totoa eaiei s  2toio oy1ameemici s aDtaxrpnt1aex mietas sDuau p;u4 eenir iodlp e i i s)seuo(r oodomen ivil(fsDrm(r ;u4tle mfciydfmDeluvp u) rtnmo3iytlmDr neols s2trxrpoodoltnlnvtlt) rrrumoot4aex mo3ilt sDemn p (4alxrxfcoodfatelnvo s) rxrimpiu4lp  lieiatf rrrumpno4oltniociysfaDumums;(0tlxnmr oodfm raivs t) rxo(rpoudlm nmncs s  rurxr no0olx ifciyd s rmn s t0trtrircootoa  lnvil()s2urio3ny4apt  ieslt)aDrmu pou0oleo oetatla uauvp;u4 rtoifcoa1la eluvs ()t2trxm3oydlpeemnvs t)aDur( p;o1alx ii3tlsfaDumnms t0tltnif tytfp  livi;()sexrio nu4lltnmfei s)sDtmuroou4aexniieiydla uluvo u4aetnmr iadoaD au i ( texo(r oo4oltemivi s)a2ur(moou1openmfeiys s2eau p t0 ltnioctodomD aivi () exrio oodop e ictas)srrr( poo1tetomietad mDea(vp () rxoio tadoa e i i s0sexmiopiydlltn ncias  Duauro;u4oetnmiciytfaDrmuvp (0 lxrif3iy1faDeaivsls s2uoxr nydllt lfcs tfsrtmum oo1tle iietadlaDeanmsnu4areomoctatlm   neo t0 rurxm no4optn ics (f 2um(r oo1apx  ieiadlsDrmnvsnu)aexnxrctotla r ivo;(0trurir3iudol emneils) rurxm no0opeomf3tydfs2eanmp (4aexrmf tatfp r ues;(  2urimpiy4al nlfci s)aDtaumpot0tle iiciadlaDumnvp;(0 rerif3ootlat auei t0trurxo3nydomt lfct sf Duaxmpnu1tlx mfetyd aDea( s;t) lxoxoctadop   nvi;t truoxopiydape mfes (fa2rmxmpou1apeoifcilt a2ea(ms;() exoif totlpDrlneo s)srtrxm3oudolte iei sfaDrm(mont0tpenmocild aDrmuvo t0altnio todomD lneols0srxmio3io1opee nvtlsf rtax pot0oltn i3tytfa2eanmp ()tlxoxf iodlm elieo ()seumxr3iu4altn ncias aDumumont1ope io3tatls ulu on(4aetnif3ta1lmDelu o;s texo(o3oodlpeemivsl(f rumum ou0tpt mo3iatls2eauvo;u0arxnmfcoatoateaneilt  rumio ou1lpenliet ( srum(rpou4optoio3iydfaDrl(vo;u4tlxrmrcoo1omDranvolt0sexrxmpoo1amt lfciatf rumu  ;u4teto f3iltfs2rmn s (4aetrmrcoadopDrlieils0trtmxo3iydlptnlivsat)a2uax o;u4aexniiciadfa um(vsnu)aeenif oydopte nesls0truo(o nydlpen ivi tfa2trurooo1opt iietadfm2ua(vs u)artoifciatlaD  ueo t) rtm(o3oy4am n iet s  rua(mooo1apxomf3iatfm rlump;u)arxrioctytfmte u s ( trumiopou4apenlicia()arrrx pou0teen fciasfm2umums;u0 reomf iytlpD  u ilt  rurir3no1lm e ieiltfarrr(mont0texnio3iaslm eanvo u) lxnmr oy1lmDe nvi;s0teumxr no4om nlnetl(fsDtmumpno4oetnmoeilsfs umumsnu)artrxr3todopD  nvs () rtoir3iudal   ncsasf rta( p;t1ale miciyd aDranvp (0altoxo3iydomD  n sl()truo(m nu1ame lfci ( sDtaxro;u1opxo f3iytls ra(vs t) lerxo3iodomt  u i t  2tmirpou1oleemfei ()aDrax  nu1aee  ociatfs2em( p t4areoiociadlaDelieo s0srxmxr nudlm n ncilt) rtau o;u4tetn o3iyd m2rln o;t) ltoxr tadla  au ilt0s2toirpnu1ap   feil() rurx o;o4oltomoeiysfm2uaumo (0aexnxr3iodla rai s;s)trurxr iodom elictltf 2ur(  ;o4apxn icias sDranvpn()alxrmr oytoa r u o;()texm(m3nodap emiei (  Dur( p;o1tet mieiad m em( p;t)aetrifcto1omteluvo s0srxrir3no1lle  fes t) 2umx  no4ole ioetysls ra(vs;t4trtniociydopte ies s)t2trxmpou4altnmiesa( a2tm(ro;t4aptnifetasfaDumuvsn(0aetrio3oytomtr uesls)trtoio ou4oleelnvt () rururpou0optnif3iydlaDul( snt) rxrmr iadlat ln ol()setrxo3iydom nlncils a2ta(monu1tlxnmictydfsDran s;()aeerxf3iydlpDrlu o;t0setrimpnodol  mieilsf rumxr nt1aeeoii3iasfsDulu s (4teeomf3io1om eauei (0teumio oo4al e nes s)s2rax  ou0apen i3iytlm ulu o t4 rxoxrcia1fmtr ivsls)t2xoxo3oudap nlictatf rtru  ;t0tpx iocildlmDrm(ms t) rtoxrcty1lpDrlu ils s2xr(m3nodol  mieslt)arumuro;u0aetn iciytfmDeau o;t4 eerir3oa1fp rli il()srurim3oo1ame  iet (f rtaxmpnu1alxomfctydfaDel(vs;(0tltnmfciotfm   nvols)srxo(mpio4oltnmici (faDtrxr ;u4tetnmietydla umn o;t) lxriociodfpt aivsls  2umio3ny4opee icsls s2ua( o;o0ape mf3iad s2eau p t)aleomo iotfmDe u i () rtoxopoodlltnmfctls sDuru ooo1aptoiicildfa2ra(vp t) exrmo3oy1lpD  nesl() rxmxo3iy4ol n fctlsfarrm(r oo4teen oetldla ea(mp;t)tltrmfciodopt anei;( truoimpno1lptnmnvs t)s2urxr ;o4opxn fciadfa emn o;u4aexrxo oodfm rln i (0 2xm(m iudllt  fetl(  rrrur ou1oex iiciyd a rl(vont4 lerxoctadfmDraieo;()sexo(rpoy4ap  mncsa( aDururp;o0apxo o3iltlaDem(ms u)altrxr io1oaDeln i;()setrxo3oudlp   fes tf 2rrxmont0tltoiociltfs2umump;t4 renxoctytfpt ln i;s0srxmio iodol nlnvslt a2tr(ront0tetn i3ilt mDrmnvs t4aetnif tadlatranei (0 2tr(r3ou4oltemnci ( srurx p;u0oee ii3iat a em(vo u)aexrxr tatlpDrlnesls0s2um(r3iy4om  mneias aDtaur ot4oee io3iyt a eau s u4altomfcio1om   u o;t0 ruo(opoo4lp nlivils sDtaxro;o0opx moeiyt aDulnvo u4 eeoircoytfaDrlu s;t t2uoxr3nu1ape lnesa(fsDum(  no1aleoioeiysfs2eanvon(4altnmrcoodlmD lu o (  rxoim iu1opee nvs sfaDur(  oo1apto ociysls em( o u)trtnxo iytlat aiei (  eto(mpoo4aleelnviat  2tmxrp;t4aeeoifciadlmDraump;t0altnif oydfptrauvsls)texrimpoy4lp  mfetl()srtaumo;u0open iciasfsDuauvo (0 eermf iy1lmD  u i s0 exr(m iu4ameelfcsat)srtaxr ou4aet  oeiat m2rm(vont4 eeoxr3oadfmt aieo s texmxo oy4lpt lfct sf 2truroot1oexn ietlslaDulu p;(4aetoxr3oadlat ai slt t2tmim nodlptnmieta( aDrm(root0aexnmoeilsfsDrau ont4teenif3todlp e i slt s2urio io4ap emnctls) Dtrx p;o1ale if3ilsfsDean p;t)artnxo tydfm  ln s s s2umxr oydopte ictls)aDta( oou0oetnmoeiydlm2uln o;t0tlenxr3oadfm e n s;()setrxr3nodaptn fcs t) Draxmont4aex  o3iyt sDel( p;t0trxoxo oatfa rluvo t)texmxo3iu1llte iviasfs2ua(rp;u4ale io3iys aDrm(mp;(0trxrmo iy1op e ieilt0 eur(o3no1al nmiesasf rua(rp;o0teeo icias a2emnvs u0tlenmfciytla eauvs () ruoxopio1op emics t) Dtmx onu4aeeomoetltls2ulumpnt0 lenio3ootlatraivs t0t2toxo ny1lpeelfciat artax pno1oltoiociltfsDeaums t)areoircta1fpD  n i;(0s2umxo3io4olt mnct ( sDraum nt4apt  fciadla2umuvsnt4 lermr oatoatelnvols0 etrir3oudame lfct tfsDurxm no1tpenifeiat m uau s;u0teeomoctydlpD lu s t0 exr(m iu1oleeliei t)srrrxm oo0tleomieiltlsDrlump (0 exrif iotfpt an slt)trumxr3nydopt mfct tfsrrrumpoo4apeo fcild aDeluvont0arxnxr oy1oate u i;(0trtrxmpoudopt  neta()s2ra( poo4aexniocildlmDrlu s (0alenxociotfmDr i i t0truo(m3io4alenlfvsa(farum(mono1apt moctasfs2rmn p (0 etnir3io1fm rlivol(0 etoxo ou1ll nlfvsas arurxroot0tlxn f3iydlaDuanmpn(0alermo oatlptr ieil()seto(opiodol e ictl( s2rrx ooo1alto o3ils a el(vo (4arerxfctatfp rai s;s)srumim3ou4op e fvs (  rraxrpoo0aeeomfetas mDrmnmonu0tetnmfcoydfatr nvo s  etmxm3nudlmt lncsas)aDta(ront4tlxoioeilsfmDul( p u0texnxfcoydla r n i ( srxo(rpoydolee fcsls  Dtr(mpot1tptnifeiyslm2um(mpn(0tlxrxf3todlp eaueo;t)t2toimpiy1lmt lnetasfaDum( poo4olenmo3iatla ulnvo t4 ltrir3oydla rai s;() rtrxr3ny4olenmictat  rurxroot4olxn f3iyt a2rm(vo t0 eeomfcoadlm  li s;t s2umxr3oodll nmncias)a2tm(r oo1teeomfciaslsDemnmo t)artomf3todlmtrai ol(  exmxrpiu1ope  ieias  2rmur nt4optnmoeilsfaDra(mp (0teerir totlp ran o s)srxr(m nydaltn iei ( srtr( ooo4aptnioeiat m eauvp t)aleoir3iy1omDeaivi;s0srxoxmpou4lpt mnvt t)sDua(m nu1alxnmi3ild aDra(vp t0 ltnxf3oo1lpteau s s0srurxo ny1opeelneiat s2ua( oot4optomieiatlsDea(mpnt0 eenxr3oa1fatrln o;s)truo(rpoy1omeemncs ( aDrmu pou4openmoetad a2ranmpnu0texnxf3oytlmteai s t) etoxm iu4opeemiei t sDua(rooo4ale  feiadfaDelnms;u)tlenxf io1lmt lnvilt seur(r oodame mfctlt) Drrxrp;t0tleo fcilsfaDem(vs (0texrircoa1lpDrluesl( t2tr(mpno1amtnmncia( aDrrurpot0olto ictatlmDumump;()arxnmr3io1fp   ivs ()seuo(mpiodome mici ()sDrmumooo0ale mo3ilslm2ulnmo t4alxrxr3oodlp eaieo;s setm(opnodom nmieil() Dum(rpno4apx  iciatls emuvs (0teenxr iatomtranvo;s0trtmxo iy1ope liei sf 2urxm nu1oexo octas sDrau pn()trenmf3iotfm e neilt)srxmimpny4aptelieslt aruaurpnu0apeo ieiltfm2eln sn(4 exnioctatopD li slt tetmir iu4openlivilsf rtrumpnt1tet mfeilsfa2uanms;t) etnxf to1fp eluei () 2tm(opnydom e ivsa() rua(mo;u4oet iieiytfs2ulu pn(0trtnxf ia1la r u s (0 euo(rpiydlptn fesls arrm( pno0alen oeiltlm ul( p;t4 lenir ta1fm r iei s t2uoir3iodlpeelfeta(  2tmxm ;u4oleo ocildfs2ua(mo;(0 eenxrcoo1laDrau o ( trxm(mpiudlp emfvilsfsDrau  no1apto ieiasla rluvo;u)artoxf3ta1lptrau i;s) 2urxo3oo1ll eliesltfaDrm(m ;u1olx mictldfmDem( o (4 etoxo3ootfp eaueolt)sexmxo iy1lpe mneslsfs2ta(r ot4oleomf3iyslsDeln p t4 rxrmrciotla rlueilt trtrxm3ny1lmtn neilt a2rruroot4alen iciyt s emumo t0 ltrmrciytfaDr ues;t)srtoio iu4ll emnctlt  2ua(mpno0tltomoetat s2ulnmsn(0texnxo3totoa e u i;(  rurxo3nu1ome  fvia( sDrax  ot4openifeias aDrmnvp t0 ltoxo3oadlmDr nvs;t  rtmxr3no4lle miesl()s2umumooo1aetomiciytls2rl(vsn()tetnxocia1fmD livi;s texo(r oodll e net () Dumx ooo0tlt  f3iadls el(mp;t4arxoxr iytfa ean o s) 2uoxm oodll elfci t) rta( ont1olt iociatfa2rmn sn()tetnxrciy1oaDe n s;s  eto(mpnu4lme lneil( artr(  ;o4tpxnmo3iydfs2um(mo;(0aeeniocoadfpD aiei;t trtrim3iy1ome  ncslt)aDrax  ;t0tex  o3tlsfaDel(mp;u) rxnmr3ty1lmD auvo;( trurir3oudoptelfcilsfaruaxrpot0tet mieildlsDemu snt4 rxnxociadopD lu o s0s2uoxrpny4amt licil( sDuax  ot1aleomfctytfm2emnmp;t0 ltnif3tatlatrau ils trtm(r3oydale lnciltfsrtaxmooo0alenii3ilsfm2ul(vpn(4tetnif3ootomtrlivo t teuoirpiu1omen fvtlsfs2rr( p;o1olxoioeiat a2el(vo t4 exrif tatlmt lnes;t0s2uoiopnudape  nvi tf 2uaxrpnu0altnif3iytfs2um(vpnt4altrxo3iadfa r ieo;(0s2xmim3oy4olte icta(f Dtr( o;t0olt ifctatfm uauvon(4tleoxf iydlmD  ueilt)texm(o3iu4lmen icilt arur(m nt0opt micilsfsDemn sn()altnifciy1lptr nei () rurirpiydolt miesa()arur(m ou4oeto octys a2ra(mp t) renmo iytlm  anvo (  2tmiopiu1altemfet ( sDururpnt1aptoii3iasfs ulu o;() rermr iatlmtrluvo;t0 rtoxm oydome livil(fs2tau p;u0aetn i3iytfs2rmnvo (4tlxrmf3tadfp  livil()srtrxo3ou4apenliciat) Dtau pou4apt ii3ils m emumo;t4 eeoif iytlmDr ues;s0 rurim ny4ameelfvi s)aDuru pnt1tex iiciyt sDem( o;t4tlenmo3totfpt anvo;s)t2umxm3ny1olt livsls  2umurpoo4aptn feildlmDum(ms;(0 etnmf oy1fpt  nei;(0tetriopoy4apt lfcia(fs2ta(moou1oexn o3iadlsDranms;()tlxrxf3oy1omt  nes (0 rum(r ny1olt lnctl()s2ururpou4oleomfeilsfm uaump u4arenmo tatfpt  ivo s0s2um(r3oo4aptnlfeil() 2raurpno1tpenif3iltlsDeluvp;(0arxnmf tadlate nvo;(0trxm(m oo4altn fcslt s2tm(  ;t0aetoifciydfs2el(ms (4 lermfciatfat livs t srxrxmpnodlptnmicsl( aDurx p;t0ope mfctyt m uanmon() rtrio3tytomtelueol()srtoxr io1optemicsltfsrtm(r ;o4aexomfciyt a ean o (0tetrmo3oo1oaD luvols  rurxm oodlmenlivs s)a2rr( o;o1tet  iciatfa umuvonu)aetrio3iodlateluvo;t0seuoiopny4ome mivi t s2ta(rp;t4opt  fctld a ua( o;(0texrmf3oytfpDraueo;(0seuo(r nudamtemictas)srrmx oou1tltn fcildla ulnvs;u0trtrxf3oodomtelivo;( setmxm iudamenlfes ()aDua(moou4tetn iciat s2uln pnt)aetoioctydoaD  nvi;s)srurxr iodol nlnci s a2tmur no0aptnifctat mDrlnms u4 lxnio tydfpD  nvslt)s2xm(opoo4aptnmies s)a2tru onu1olx  fctasla umnmo;(0teeoxo oodomDe u s;s0sexr(r3ny4ll  lfvtl()arum(moot0tlxoifciydla2rau s;(0tetnmf3ty1omD  nvi;s0trumiopiy1lmee nctl(  2rmu pot1opxo o3tas s eanmp;(0artrmfcta1lptrai o;s sexoimpou4lpen fes s)s2taurpnu4oleomfciltlaDelump (4 renmf ty1lm  lnvils0 exrxm3iudamt  fvslt) Dtaumpoo4tpxomo3iasfm2em(vs (0artrxo oodla ran sls t2toxm3oudoptelnvtls)a2tm(rp;u1alxoioctlsfaDumnms u)artnir3oatfptr ivs t) 2xrim3iu4lme  fesas) rrrur oo1tleniociadlm2emnvs;u4 exrmo iatoaD lnvs;t tetr(r3oudolenmnvtas srtrxmpot4oleo octasfa2ra(vs u)arerif oa1oat lnei;s  rxmiopnu4lm n fviltfa2rmumpou0tlx  f3tasls ul(mo u)alxnxrcoydlpt  nvil() rtm(o3no4op  licil(  rurxmpou1tlxo ieildfs ua(ms;() rxnio tadlpD lneslt t2trxr iy4amenlicsasfs2rrxm ;u1olxo fciad m2eluvpnu0texnxocty1la e nvils0trurir3iy1llte fcs t  rum( ooo0apxo oetydla emuvo;u4arxomr3oa1fm eauvol(0texrirpiy1optnliei (fa2urxm ot0teen f3tld a ua( sn(4alenmf3oodfmtranvsl(0seuo(rpou4ome  ictlsf rtmumpou1aeto fetat m elnvp (4aleoxocoadopteauvs (0sexoir3nu4ape mnvtasf Dtrurono0oex mo3tydfs eln o;t4areoxo3ty1fm eauvil()srxr(r no4olenmicias srrau p;o1optoifeiydlsDraumonu4 etoxr3iydlateai sls  2urxrpiy4olt micta()aDtru oou1aleoiietls s uanmp t)tltoiociy1fpt anes s)srto(m3nydap eliet t)aDrrx pnt0apx iiciyd a rmumo u)texnxociydlptraueols trxr(m ny1am
\ No newline at end of file
@@ -0,0 +1 @@
+u i;s0srtrirpoy4ome mnvt s  Dtmxm oo4tet  i3iydfs2eau s (4 rxrmf oy1fmtr ieo;() rtoxr iudam  livt s)a2umumo;u4aexn f3ildfsDuau o u)tltrirciatfatr i ol(0teum(r no4ll e nctl()aDumxr no4tpx moeiatla umuvsn(4 renxo iy1lpteaivols0s2tmio io1am   nesasfs2tax p;o1tptniociydlaDemnmp;(4 exoxrcoydopt luvi;s0sruo(rpoy4op elfcsat arrr(m ;u4olx iicias m2rmnvs;u4 reoxf oatfate ueils)s2xr(r3oydlleemfvs ()aDurx  ot0oee ioetlt a eln p;u0 rtrif oo1lmD  nvs ()tetm(m3iu1ame  nvil(f rum(ro;t0tpx ifetyslm umu onu0 etrio tytfpDrlnvols)s2urxo3iu1llte ietl()a2tmx ooo4tlx  i3iat sDulnvp;t4artnxf iytla e uvi;s0texmxr3nodol   nvtl() Drm(mpnt0tlt  iciatlm2elnmpnu)aeenif3io1fpDeli i t0t2xmim io1oltnmietls)s2ra(moot0alxo fcils aDrlump u0texrmr iatom r n o;s t2urirpoodame  nci (fa2tmum nt0altniiciyt sDumnvo (4aexnmf3oodoa eaieols0t2ur(r3oo1lm nlfvs s)a2trumont0tlxoioeiys aDua( ont4altoxf3oodfm elu s;s0tetoio3nodlpeelnesl(faruaumo;u1openii3iytls ul( s u0tleomocoa1fatrluei t  eum(opiydapenmfet (fsrtr( pnu4opt  ietys mDuauvpnt0texomr todoa e i ol(0seuoio3iu1llt lnesa(fsDrm(rp;o0tlxnifeiltfmDuauvsn(0texoxr3iy1lptrai ilt t2trio3nodlpe lfctas srum(mpou1tex  o3iydfs2ean sn() eenirctytlpDe uei s  ruoim3nu4alte ncilt) rraxmpnt1oeeoif3iyt s rl(mp;u4areoxociodlaD  uvs;t)trto(r3oo1optnlncsa(  rtaur nt4aetomf3iysfsDul( s t) exoir to1fp rluvi s trtmxmpnydlmt mfei t a2uru ono0tlx  fetls sDemuvp;(0 rtoxf3oadfptelivi;( srto(o3oo4lmt  fcil( srtaumonu4altnmf3tys s ranms;u4aetnxf iatlmt aiei;(  2urxo3oo4om e icil(f Draxmpoo4olxn feiyt s rau snu0altomo iotomDraivo;( sexrim3oudopeemncsltf rrrumpnu1ole mfeiyt s rauvsnu0aexrio tadla r ivi;s0trurxr ou1apen fcsa(  rtrurpnt0tlenmoeiadla ranvonu)aetomfcoytlmtelu o t)trxoxmpou4amte ivs (f Dtaxr ;u1opx ifciltfs ua(ms;()aexnmr3iatla elu i;()trum(r3no1lmenmfeils)sDuaxrpnt4apx mfciytfs ua( pn(4 leoxf3oydfpD an o s srxoiopno4oltemfvtas)aDrmuront4olx  fctadfs uanvon(4teerxf3ootfatrluvo t srxm(rpno1lleelivsas s2ua(mp;t0tlxn o3ild s2ulu o;u4teermfcta1opD  i ilt s2umim3no1ameelieiatfa2ra( o;t0alxniictas m el( o;(4 lermf3iadlp rluvs;s)trxr(opiy1lmeelicsl(faDumu  ot1tetnmi3iyd aDul(vo (4aexoircootfmDeluvs;s)s2triopiodam nlicsls aDrmur ;o1opx  icils sDra(mp () eenmociatlaDeaivs (0sexoxmpnu4opte iviat s2ua( ooo1tex  oeiydfa2uanms t4alenmocoodoat anei s) rtr(m oo1al n net s s2ur(  nt1apt  f3tldlm2ulnmo;(0 etomociadlmDr u il(  2xmxr3oy1lle miesas)artr( p;t0alen iciat s rau p u0 rtnir oy1faD anes s seur(m ou4ome  fctl()arur(  ou4oeenmictydls2ua( ont0trxomo3tytlatrlues t) 2xoir oodopeelfetatf rum( pou1olenifetys m rl(vp t) reomf3oadfaDeln i s)srtrxr3iydoleemivs tfaDtaur nu4aee ioeiyt mDul(vp;t4 eenir3tydomtrlnvs (0srumxr iodaltn fci (  2umxrp;o0aex  o3iysfa2rluvp;t) lenir3iadfm rlueils)trumiopnu4omenlicilt artmumpoo4apxnioetysfm uan p u0aetoxo3oy1fp  an s s)sruoxm3io4ope lfvs t)srtrurpnt1oee  ictadls2ra(vpnt)tltnif3oodlptrlueolt tetmir iydaltnlnvs (farumumoou0opxniiciatla ulu on(4alenmociodla eanvol(0 2umir oy1alen fciltf Dum(ronu0tpxoif3iadfm2rln o u0alxnifcio1oaDelu o;( tetm(rpoy1oltemiviasfaDua(rp;u4tet mfeiatfs umn p t4trxrxr3todfpDeluvi;s0sexm(m iu4omte fvtas  rra(  nu1olxo i3tytfm2ulumo u)aexrirctytfmDe i slt)setrimpou1optemfctlsf 2ur(moou4tlx mociyt a rm(ms (4alerif todopD liei;s t2xoim oodomt mnvsas  2rau onu4ope io3tyd s2emnvs;u) exnmocty1oateluvolt0t2xrim nydal e nvtls  Drrx o;t1aee micildfs2rmn pnu)tlxoxf iotfpDr u ols  2trir3iy4aleelnct t)s2tmxroou4tpxo iciaslsDum(mo;t4trtnmo3iodom  anvo s)seurxrpio4olenlfctasf Drmu  nu1apxoifetadlm2emump;t)texnir3tytfatraivslt0 2ur(m nodom e netls) ruau ono1tpe mocilt m eln o t)texomr oydfateaivols t2xmxo3io1opt lfci t) Dtmurpou1alxo ociyt a2rmnmo (0aleoxo tatfpD ln slt)setrxmpnodlp e netl() 2rrumpnu0opxnmfctas a2elumsnt0arxrxr3tatlmtelneo;t s2xmxrpiu1lmenmiei t sDuaum nt0apeo f3iadfa rl(vs u4tlenif iatlpDr uvs ( t2to(m3iu1lp n fesas) Dtmu  ;t4tlxoifciytfmDrlumpnt0 rxrmrciodoateanvo (  eto(m3oudlme lnctl(  2um( oou1oex  ictas m uluvpnu4 etrircio1oa rlivi;s t2xrim ou4lp  mfvi s sDrmu o;u0aetoio3ils a2eanvsn(4aeenifcty1lpDeauvo ()tetoxr nu4llteliei t)srra(mpoo0opxn fctlslm2rlnvs t)tetnmo3iy1fa  aivi (0 rxoim3oudlme lnvia() Dtmxrpnt1tlx  fciytfm2ulu pnt)aeeoir iytlptean ils) rxo(mpno4op  mfctls aDumu p;u0tpxomfctadfaDel(ms;t0 etomo3iotoatrlu ilt texrxo3ou4lmtnmfctltf rtmxm ou0opx mieiadfa2umn s u0altnmf3oy1faDelueols sexmxopou4lltemfvs t)s2rax  ou4alt moctlsfm rm(ms u) rxrmfcoa1oatrln i;s)sexr(m iydll elnvt s)a2rrx  ou1tltniieilsla emnvs u)alerxocio1laDeli s (0t2xrxr nudoptnlneils s2uax pnt1tlt mfciadfa2eln o u0 eeomr ia1faD lnvilt)t2xrxo3ny1lp nmnctltfaruaur ;t0tpto o3iyt sDrm(vpn(0 rerircto1fm   n i;() rtoxmpoo4ome  fci t srurx pou0tlx  ieilsfmDelnvsnu0tetrir3oodlm rai s s)srxoxopnu4optnmicias)sDtmx  nt1teeoio3iys sDumu p;(4 eeoxoctadomtraivols  eumirpio1ol elivs sf Duaum no0ale if3iasfs2ulnvsnt)artrxfciotop r n s s s2um(m3nudlmee icta(  Durxr nu1aleniociyd m ua( s;u0 reoir oodomDe ueolt0 etoxo3no4ol n ncta() Dtmxrpnu4oltn f3tltla ran s;u4alenifcio1la r u o;t0 2trio nu1ap n nvtlt a2trumpnt0teenmietysla2emnmsnt0teeoxr ia1opD  u i s)teum(r3iu4apt lfvtl()arururo;u1oee mo3tyt a rau s;t0aeenxfcoatfa  auvs t) 2tmimpiu4al nlfesasfsDtm(r oo1alt ifciyd s ul(vp u4 ltomocio1fpD lieo t)t2um(rpnu4alen fvias  rraumpno1tlxnif3ilt a ea(vp () renxf3ta1oa  luvo ( t2xrim iydlpenlncias  rua(moou1tetniocild m2uau on()aleoiociadla elu i s t2tmio3oy4op n fvs t sDrrxrp;o0oexnmiciasla2ul(mp;()aeeomf3totoaDr iei () exoxopiu4oleemivi s)aDra(rpou0alt if3tld s rmuvs;(4alenxo to1lp eli sl()tetoxm3nodlle  fet (fa2ra(mo;u4oeen f3iytlm2rln ont4 etrmr ia1laDrlies;(  rxrxo nu1olt mncias)srur( ooo4ape  i3tydlm2eanvsn(4 exnir iadlaDe ueo t)seuoiopiy4om nmnetat)srrmxmooo4aptomo3tatfa2emn snt)tleomr3iy1la  lneils)tetoxr3iy4om nmnvi s s2taurp;u0tltnmf3tyd s2emuvpnu) rxoxr3oydfp rau o ()teumxopnu1ll  mivia(fartaxmont1tpx  fciatlm uanvo () eeoir3to1op  lieo;t sruoxopoo1omee ietas sDtr( o;t0opxoifetldlmDem(vp t4tetrifcio1fatr nvs t0srur(mpny4apt mfeilt)s2urxrp;t0alxnioeilslaDranvpnu4trtoir ia1op ean s;t setoxopiudlpeelnvsa( aDra(r oo0teenif3iaslm2ra(vs ()alxomocto1omDranvolt seuoir ny1apenlnes t aDrm(mono1alxo i3ils aDel( o u4aetoxo iytfaDrau i;s t2tmim3no1omtnlnvslt artr(ro;o1oee mieildfa rlnvsn(0tetnxr3ty1fm rluvo;s  rxr(opno1op   nei sf Dra(rpnu0aleo fctld aDelu p u)aeenir ootfmtr i i t  rurxo oy4omte ies (  rtm(m nt0aet ifcildfa umumo u)arenxr tadoa e i o;t  eur(o oy1amt mfvtls)a2umxmp;t1oltnmfeiltlm2ua(vont4 rtnmf iy1lpDr ies t s2umio3oy1amtnmietasfa2ra( oou1oexnif3tls a rm(mpnu0texrioctatlmtr ueil() eurxr io1ll   nvs t)srrrx p;t0texn o3tyd s2rmn p;t) eenxrcio1fp raneslt  2ur(mpny1aptemnesa( sDta( p;o1tle ifetldfa2umu pnu)tetoxociy1fa   uvilt0srxoio3oo1omte iviltfaDrau p;u0ole mf3iltlm2ea(vp;()tetrxfcoytfaDr u i;()t2xrxrpoo4lptn nvt t  rtmu  no0tpxo fciat s2emnvpnu0tlxnio3tydlp eaivo t  rxrxrpoudomeemivsa()arta(m ;o4oeto octatlsDulums () lenmo iodoaDe n o ()seum(rpiy1alt  iei tfarur(mo;o0olxn f3iydfm eanvpn()tlxomo3iotoate nvs;(0t2tmxmpio1lpte fvs (f rururpno1apeomoeils sDuau s;u0teeoio3tytla ranvo (0t2xrxo ny4lm  mfctltfsrrmxm no1tltn f3iatfsDulu o;u)tetrmoctytomD li o (  rxm(rpiy4ome miesa()aDrru  ou1tpto oeiad s el( ont)tltrmrcty1latr uvs;t0t2umxrpnu4al nlfesls) rtmxmo;o0apxoif3iatfa2em( o u4 rxnmf to1oaDraneils0truoxmpnu4olenliesas)a2tm(mont0tetn ieiltfsDem(monu0arxnif oy1fat auvi (  2xoimpno1ame mfcsl(  rtr(mont4aexn feiydfa emumont4 ltnmr todlaDelnes (  rumxopoy4ap n nvi t)a2rr(roou0tlt mfcilsla2em(vpn(4 eeomocoytfmDrauvs s0srto(o iudomtn nesat) 2ra(rp;o1alt  ieiltla elnvpn(0altrir iadlat lnvils0trtmxopnodom e neslsf rtax onu1tpt io3iytls elu s;t)tetomr3oytlmDrlnvils truoxr3iydoptemnvtl(f 2rrxmooo1tpeoiieiatfmDel( snu) ltrmr oadoaDeaivi;s0teur(m3nu1ll e ictasfaDra(mpnu1tex mociyslmDranmo;u)alermrctotopDrln ol()t2xmxo ou1lp nmfvsasf rta( oou1apx mieiat s uaumonu4trtoxf3oytfa eau i t sruoxr oy4alt miei ()arrrur ou1tlt io3tysfm uln o u0artrmfcoatfpD luvi s trtm(rpoo4ap n nctls)arurxr nt0apenio3iytlsDel(vs t)aetrxfcootfa   nvolt t2tmim3iu4llenlneilsf Drm(m ;u4tptoii3iatlm2um(mo u)altnmfcty1opDraueo ( sexmirpou1lm  mivi tf Dtrxmo;u4teeo i3tyt m emn s;(0texrifciodfmDr nvs;t0 exm(o io1opte nvtl(f Dta(mp;o0olto fetldls2eau onu4 rxoxo3iatfa r iei;t  2ur(o3oy1lmenmnvslt arua( p;u4olen iciysfs2eaumsn() rerxf3iatfatran ilt truoxrpiu4oltnlfviat  rrm(  ;t0oeenmfcild a umnvs;(4 etrxr iy1oa elieo;t srxr(o iu4ap  mneilt) rrmx  oo4tpxn o3tadlm rlu s;t0aeerirctatlp rlivi;s0 rtrim3ny1ap elfet ( srtaurp;t1teeoif3tasla2elnms u0 rtnxf iy1fpt  ieo s)s2trxr oo4lp e ici t) rrrum ;o0tee micildfaDeanmpn(4 lxoif iodoa rlieo s) exr(m3io1am nmicia(fsrtau pot1tpxnmo3ild m elnmont4 etrmo totfmD  ivo t0trtrir3oy1apeemfetl(  2rrxr ;u4ape iieias m umuvp;u0tlenxf3todopDranvils  rur(m3iudll emfvsl(f ruaum nu4tltnmo3iatla2ul( o;t)altoxr3io1lpt ai sl() 2toxo3nydol e iet tfarta( o;u4alx ioeils aDulnms u0tetnircoo1fpDr nvo;( seuoxmpoy4am nlivia() Dum(mo;o0alxo ociydls2eauvon(0tlxrxr3iydfpDe ueo s seuoxr iudale  nct s  2rmumonu0tpx ioeiyslm2ranmpnu4aetnif3tytfp r n i;()trxr(o3oo4lp nmfci t)arum(r oo4apxnio3tatfm rlu s;()trxrxociadop e ivs t0 rxm(o3oy4ll  livsl()srurumo;u0oetn i3iydla2ul(ms t4tetrir3todlpt  neil()t2to(m3oo4op emfeilt) rrax p;u0optoiiciysfm2umu o;(4aeerxo oo1lmte nvilt)texrxo3nodlmeelfct s)artru p;u0olt io3iydlmDrmnms;u4 lerio ootoatelu sl(0 eum(r3oo4ape livtltf rtaxrpno1optn feiltla2emuvs;() exrmf3tydlp   uvs;()trxrir3io4apee iciltf rurxr ;o1aleoif3iltfaDrl(vsn() exnxr iotoaD livil(  2tmxm nu1olenlncia( sDtrurp;u4tetnmoctaslm eauvsnu)aetnif iy1om elues;s  exm(rpoodlpen iviasfarrrur ;t1apx  ieiadfmDel( pn(0tltoxf tatfmDrluei (0setmxm3no4oltn nct s s2raxmpnt1olxn o3iytlm ra(mp u0 eenir iadom   i s;t0srxo(mpiu4op e nvs ( srtmu  no4olt iocilsla emump;t4trerxo3ootomDrauvil()t2xmxmpnodolte nvsls  2ra(mo;u1opt moctysfsDrlnvpn() rtnifciy1la rlieo s0srtoim3ou4omt lnctatf rur(moou0altomi3tldfaDel(mo;t4tetrxo3tatlmt  nei;t)teur(o ou1ale mfet s) 2rm( ono1ope mi3iysfaDrlu on() lxoircoydomtr u ils0tetoio iudamtn nvia()aDur( oot0olxnifeiltlaDrmu pnu0arxoio3to1faDe neolt seurxr3oy4olte ivs t  rur(mp;t4oeenmi3tadfa2ra(mpnu4 lxnif oodfa rli s s) euoiopoo4al n fvtat artru pno4tex ifeiyslaDumnmon(0tlermr3tadlat  i s s)srtm(o3no1apee fcia(fsDrmxmpnu0tetomf3tasls2umu o;t4artrxo3todfate n s (0srxmim nu4om  lfeiat aDrax  oo4altnmieiadla2ranvs;t4 ltrio oo1laD lu s;t0texr(o3io4lptemnvtltf 2trxmpno1oltoiieiatfm ulump;u4arxomo oy1lm  aieo;( srumxmpoodopt miesasfs2uaxrpno1tetoiictltfm2rmn s;u)aeerio ia1fmDeanvs t)srurxopou4openmfesat)artrur nt1oeeo fciys m elump t)trtnir iy1omt aiesls)s2toxm3nydol  mfci t)s2tmurpou1tpeo icildfm umn o u0alenmf3iydlmtraivs;s  rxrir3iudopt  iet s) Dtr(mpnu0ope mictasfa uanvon(0 etnmfcoadom   i i;(0texmxopnu4optemivias aDtrumono0alxnmo3iytla2ea( o t4 eeoxo iodfmtraieilt)trxoxrpou1op  lncslt) 2uaumpou0altnioeiaslm2ranvo;t4texrxr3iydlmtrli i ( trxoxm3ny1al  mivi t)srtmumpou4aeto o3taslsDemnms () leomf iotfmtrli olt) ruoxm oo1altnmfesa(  2raum ;o1aexnio3tytls ea(mo;(0 lenmo iytopt aneo (  2xmirpiy1lme lies (fa2trxrp;o1oltnmoeiltlaDulnms;(0texrmociy1fm eln sl(0texoxopnu1op  lfvtlt sDraxroot0aetnio3tyt s rauvonu0aexnio3to1fa  lueo;(  2xrir no4apt lfcs t  rraxmpnu1tptnifcilt sDrmumpnt0 exomrcootlaDraneol(0t2xrxo oo4llen ivsltfaDtmu  nu0tptnmieiat s el( pnt4 ltomoctodoatr ivo;s)s2xmio iy1ame lfvta()aDrr(r ;t4opt iieilsfm rm( s (0trtoif3totfmtrluvi (0t2xoxr io4llenmnvs sfa2tax pou0oltnmf3iasfa ul( p u)alerxrcto1lpDrauei;t0 2xo(m oo4lmenmncta() Drmurpoo4aexnmoetlslmDra( sn() etomf oo1opt anvi t trxoir3oo4lme  fct s srtrumpnu4oeenmo3iydfa2umu snu4aleomr3iotlpt anvi;(  rxrim3io1lm n fet tf Dumumont0tlenmictas m eau o;u0artoxr oodfp  lneo s0trumim3iu1ale lfesasfsDtr(rpnu0olxnmo3ias m2eluvs;t4trxnif3oydfmtrluvs ( srtmxo iydap nlivsa( s2ua(root1oetomo3tltfmDea(mo;u0tlxrmo3oa1lmte u i t0tetrio io1om nmfvsls s2trurpoo0tetnifeildfaDuanvs;t0tlxoif tydlatraieo () ruoim ny4op  mnvtasf Draum ;u0tpto i3iltlmDea(vpn(0 rxnmociytfpDr n i t0srtoimpiydoltn ieil(f 2rmumpot0opx iiciadlmDrln s;u4teermfciadlmt an o (0t2xr(mpou4ll e iet s) 2rau o;u1apxnmociatlm ranvpnu)trtoxf3totop r i i;t seuo(m ou1lpe mfcs t aDur(m ou4aex ifeiytlmDelnvsnt0treomfcio1omt lueils)t2uoxm3oy1lle  nci ( a2rmxm ou1apeomoeiyd a2ea( p (4 etnmoctodopt lnvslt s2xrxm3oydom e ivtltfarta(mpno0tltomociad s2ul( on()treoxrcto1la r n i t0 ruoxm3oo1am   fvsatf rtrx oou1tltoiictls s el(ms ()tleoir ty1lat  n o (0 eumxr nodam e fvt s)arurx oou1tet mo3ilsfmDemnvp u0arenxr3iydoaDraiei;s0 2xmim3ny1lme mfvta(fsDuax o;u4altnmfeilt mDrlnmo (0treoif3iatop r uei;(  rxoxo3nudlpee ivtas)sDra(m ou4tetoio3ildfmDrlums;u)aeenmo3oydoa raivol(0trxmir3ny4ol e iesatf rrr(m ;t4olxomoeiytfa2elu onu4 reoxocoytlp eluvsl() rurir no1oltelivs ( aDrmur ou0oltnifeiltfa umn s;u4 lenmrcoadlmtrauvsls  2umxo3no4apen fet (f 2tr(mo;u1ole mieiytlsDumuvs;(0trtnmrciotla  ln o;t)sexoxm3oy1apen nvsls) rtmump;t1olxomicilsfs2umuvsnu) ltoxrctytoaD aivil(  rxr(o ny1oleelncsa()aDraur no4tee  fctytfs umumsnu)alxoxr3ia1fa eau i t)s2uo(o oudlme mivt t s2ua(ro;o0olen fetadlm umuvpn() etoirciytfpteluvi ( t2xrxo3oodll   nvi tfarur(mp;u4tptoifetls mDumn o;() exrxr3iydopt  nei s  rxm(o ny4omt  ncia(  2trxroot4altnif3tatfmDum(mp () lxrxf oa1fa  aivils0teumimpnu4lltemfetls sDtaur ot0oeeoioeiydfs2um(vo t4 exoxr oy1lm e iei;(0texm(rpiydll  lnct (f 2urump;t0openmfetasfs2emnmo u0texomr3todfpD luvo;s  exmir3oo1omenmici ()aDtmuroou0opxoifeildfm2ea( o;u4tlxnio ootlp rlivil(0s2to(mpiu1aptemiesltf rraum ou4alt if3iasfm2elumsnt0 renxf to1opDeanvs t) 2tm(r nodamtemfei t)s2rau o;t4tee iieiltls2ulnmpnu) leoir oatfat anvolt0 eurxo nu4amtn fct t s2uax  nu1aptnmf3iydla rau onu) etnxr oytlpD anvo;()tetmxrpoo4lltnlncta( srum(mpoo4aptn f3iytla2em(mp;u4 rerif3ty1lptr u ils0tetoxo nu1lmtnmfeiat sDum( pno0ale iietydlm ean p;(0 etrmr iodfaDeanvs ( texmxmpoo1om nlieia() 2uaxmp;o1oeeo oetadlaDelu on(4alxoir3oodlmt  n s ( t2um(mpiy4lmtemictat aDtmx ooo1aexnmfeias s2elnvs;() lxrif tatoptr uvsl() exmio3iodoltnmnet s arra(mpou4tpt mi3ild a2rl(vs;t0aeeoxf iodfmDelieils0 2uo(mpny4ll nlfcil() Dumum ;u4oetoifetltlm uanvs u0teenxrcio1oaDeluvol() etmim3iy4lltemnei ()s2tmxmpoo0opx  iciasls eau pnu0 rxnmocty1fpteli s s0sexm(mpny1ap nlietat)srum(mo;t4aexnif3tysla2el(vo u4trxrmf3tatoa rluvo;s t2umim3oy1open nesltf rtmumpot4aexnmfeiytla2rlu ont)treomo oodlpt ln ils  rtoiopny4omeelnei (faDurxrpnu1tpeoiocild mDelu pnu)tleomf io1oaDr uvsls0 2xmxopoodoleemivt t sDrau  ;u1tlx ifetad mDeanvs u4artoxf3oydfaD livsl( trurim no4ome mfeilsfarum(rpot4aeeniociydfa ra(ms;(4 rxrxf oydop eauei;s  ruoio no4optemnvils) 2tmuro;u0ope miciatlaDrmnvo (4alxnxf oy1lmDrluei t) 2xm(r oo1lmt lfvi s sDrmuro;o4oet moeilt s2elumo u4artrxo ia1lat lues;t srtr(r3nydaptemnvta( aDrmx pot4oexnmf3tld aDrl(vp;u) rxrxfcoy1om  au ils)srxm(o3oy1lmee ivias s2rrumpot4tetoifeilsla2uln ont4 exoxf oa1op eau s ()t2xmio oodlmt lnetas  rurx pno1oleniietld mDranvp (4 ltnmf3tydlpD aiei;s seumim3iu4ap  mfeia( srtaxm nu4tlx miciltla2uaums u) renmo3tydop ean s;t)s2uoxr3no1al emics (fsDtrxr ;u4optnmfetat a2ulumo;u)alxoio3oy1fmD lnvil(0s2xr(m iydamt  nvs t aDuax  ;o4altoiieilslaDran onu) etnmf3oy1fmDeli s;s0 exmiopnudolee nvil(  2umumpnt0tpt iieiytlm um(mpn(0aeerxr3oodom  ai o;s0srxm(o3nu4lltelnvt sfa2rmumoot4aeeo ieiadfm2ulnmp (4alenmr3to1op eli olt0s2umim3oydopt  nvslt) Dururoot1alt mictyt s ua( snt)artrxrciytopD aieo;()srxoirpno4lm elfvia( sDum(r ou4tle moctadfs2em(vpnt)tlenircoo1fp elieolt texo(r oy4omtnmnesas  rtr(  ot1aetn fetasfsDea(mont0 rxoifctatopDelieo;(  ruo(r oodol nmneias s2rrx pnt4alt ii3iasla em(ms;(4 lxoio3iatoatrau o (0 etm(r3nu4lp  mnct s)srra( poo4tpeo f3iatfmDea(msn()tlxoxf3oadfaD an il(0trtr(o3iudamee fcsl()aDumxm ;u4alxn ietad a umn p (0trxoxo3tadfpDr nvi ( trtoxm3iy1ap nlnvslt aDrmurpou4aptoiictlsfaDuaumonu0tlxnxrcty1fpDran slt  rtr(r3iu1olte fvsl()sDurx pot4tptnmfciys a rmnms;t0trxnxr oytfp  lnesl() rum(opio4lm elivilsf 2ua( p;u1alx ii3tasla eluvo t)tleoxr iodoat  ivsl(0sexm(r io4omtelnvsat) Drm(mpnu0ale ifetasfs umump t) rermr3ia1lmDe n o;(0texmxo3iu4lpeemfei s sDur(mont0oleo ieiadfs2uluvonu4 exrir3to1oaDrlueslt  rtoxo3nodameemfeilt) 2tmurpnu0aeeoiieildlm2rl( p;t0 rtoxr3oatlp  ln ils trxm(m iydal nlivtl() Duauront1opeomoeiysfaDea( p ()arerxf oo1lp  lueils t2tm(rpno1lm  lfcil()arua(m ou1aetoifeiytlmDeluvo (4aeeoxoctydfaDrlu o;s) rxm(opoy4ope lfes sfsrrm(mont1apt  fciatls2elumon() rtoxo totfpt  nvo t0srxoxm3iydll n nes ( aDtmxro;t4apt iieilsfsDumu p;t4 exrif3iadfat  nvs;(  rto(rpiodlmt lnvsat a2uax oot0oetn f3tadfs2rluvo;u0artnif io1fatelivo t0setrxmpny4alee ncsas sDra(  no4oexoifcias aDrluvo;t)tlxnxo iotoaD an slt tetoiopoydaltemfvtas)sDtaumooo0tetoifeiasfmDemump;() exnio to1om rluvo;s) rurxrpnu1am  mfci sfa2umxmp;o4oetn i3iytlsDrl(vp;t)altrxr oa1fat  nvsl( trtoxm3iodlm n ivsas a2ra(ront4tptomfciyt mDum( sn(0trerxr3oodopD lieo (0trxoiopnodllen neiat)aDrm(r ot1tpt io3ils m umuvon(4altoir tytfpD aueo;s0teurxm iy1amen nvslt) rtm( pnu1opeomoetlsfaDrmnmsnt0aetnio3iatomt aivs;(0t2toxo3ou1opte fcslt)a2rmx pnu4oltoioetasfaDuanmp;t4 etrmocoadoaDe ueolt seur(o3oydopen ivt (f rtmum oo1tpxo icildlmDean s u0 lerxrctydlm  lueo ( teurxrpno1apte fciatf Dumxrpoo0teen o3iytlmDel(vonu)tetoir3tatfm  liei;s)teuoio nudomtemfct (fsDumxm no4aeeoiietltfa ul(vo;(0 eenio3todfaDe i i;t0s2toxm iudll nmfeil( s2taur ou1tpx  ocilt sDulnvsnu4teenmo3totlm   nesls) exmim iy4lme lnet (  rrmumo;o4olxnmocildfs2eau snt)tetoxf3iatlm  ai s s srxmiopiu4ll eliei tf rtrxr ;u0alt  ocildfs ra(vpn(0texnmocoodlpteluei () rtr(m ou4lp n neils) rtauront0opto fctyd aDuaumonu4artnirciy1lmDrliei;(0 exoxr3oydllen ivilt a2uau  ;o1aex miciad aDra( p;u) exoif to1fm e n i (0trxoxopny1ole micsas) Dtm(rpoo1tpx moeildfm eau sn(4 lerxr io1opt li o ( srtm(o3ou4op  lfvtat)s2trxrooo1aexnmi3tldfm2rmnmsn()arermf oytlaDraivs;s0 2umxo nu4ol emncil(  2umxmpno1opx  ociydfs2ean pnu4areoio3todlatrln o;( teurim oydapt  ict t artrx ooo1optomi3ildla umnvo;u4aetrmf3tadlpDeauvi;s t2xm(rpoy1openlfvilsfa2rru  oo0oexo oeiydfmDelumon()tltnmr3ia1om eaieilt trumio3iu4omtemfet t)arra(m ou4aex mfeiysfmDum(ms u4trxoif3iadomt aiei t t2umxo oodlp  liesl(f 2rax ont4opxn fcils sDeluvp;()teerirctodfaD ln o;t) 2um(m3oydllenlncsa(f 2trxmo;o0tltnmfeils s rluvpn(4tetoxo3ta1faDraivi s)srxmimpiu1ol nlnviltfsDrmx oot1tltnioetydls rlnms t)tetrxf3totfp r u i (0srxmxm3nu4lpt mfvt (  Dtau  ;u4openmoctysfmDumuvp (4 lxrmf3ty1oat li slt  eumxopio1omen nvsatfs2tmum no4oexo i3iyd aDemuvo u0tltoxf oo1la  ln slt s2um(m3nudoptemfet s srrrx  no1ope mf3ias sDrm( snu0arxoxrcto1fmte uvo s0 eurxm nu4lpe lnvtls  2urxroot0oeto i3tys aDua( o;(4 ltnmo tytoa r iei;(0 rtoir3oy4ap  mnctasfsrrr(mpou4tetnioeiydla2uau p (4aexnxr to1opD aivi ()srum(rpou4open ncs s  rtmur ;u4oltomi3tlsfaDrm( o;t)teeoxf oytfmt li sl()trxrio ny4olt  nvil(f 2raum ot4apx  o3ilt mDel( o;() lxrmocio1fmD  nvs (0s2xmxr iu4ole lfvt s) Duax ooo1alt mieiydfmDumumont4tleoiociadlmt anei ( t2umxopou4omen icsl(f ruaxroou1opeoio3iyd a2emu p;(0aleriociytlaD anvols) etr(o3iu1om  lfcsl( srur( ooo4oleo oetltlm raumsnu0 lxnxr3totlaDr n ilt0s2uo(rpoydol   nesa()srrm(rp;u1olxn f3iltlsDum(ms;t) lxrircoa1oaDrlneilt texoxr3iydopeelnvi t)s2ur( o;o0ole  oetld mDemnms (0 etnmr tytopDr uei;s srxmir3iu1om  mivtl()artaxr nu1tet if3iltfaDrlnvp;u0aexniocio1laDeliei;s s2tr(mpiu4lpenmicta(f 2rmumoou0apx io3ilt a emnvs;(0tlxnmr3tydfpte nei (  eurxr3iydlm   ncs s arurx ooo0ape  ocilt a umnvs (0teeoxo todlm eai i ()srto(o oo1optelfesa()a2umu o;t0tlx  f3tld aDel(ms;() rxriociytlm eanvo (0trtoxr nydomteliviasfaDuaxroot0oltnmiciytfm uluvpn()aeenir iadoa   uvol( setmirpou4ape mietat)a2rmu p;u0tpt mieias mDumu o u0 exoxocootfm  aneol(0 rxr(m nydopt lfcia(  2tm(r ;o1tltnif3tatla2ulnvs (0tltomf tydomD  nvi;()texoxr iu4ale mncil(fa2um( ono1tpe  ietyd sDrau s;() rxrif3ty1fateluvol( s2tm(m oy1apenlictatf Duax  ou0oexo fetadfa eanvp u)texrif3oodfpt lu o;t0 rtmiopnudom elfciasfs2trump;o1tetn ictls m rln s;u4tlenmo3iadop e u ols0trtmxmpoodolen neia() rtrxrp;t1ope moeiysfmDemu s;t0aeermr iydfmte nes;( t2to(o3oudlmeelnviltfarrru p;u0oee miciad a2emu p;()aleoxr tatoa r neolt trtoxr ou1ll   iviat s2rrur ;o0aleomo3ilsls2emnvs;u)treoxf3tadoa e ieil(0t2trim oydap  livt sfsDtm(rp;u1alenmf3ildla2ran p;t4 ltnxfcoa1om r uvo (0s2tmim nu1amtn fctlt artrx  nt4ole  oetasls em(mp t4tlerif oadfpDraieo t s2uo(rpio1lmtnlneta(fsDrau pnt0apto ieiltls emuvp;t4tleniocio1fa eaueilt setmxrpoy1ol   fet ()s2rax o;o4opeomf3iltla2rm(vsnt) renmocoydoaDr ieilt s2xm(m nudap n nciltf Duaxmonu4alxnmi3iltlaDra(mo u)trxnmf3oadoaDr ues s s2xmim3ny1omeemfcsls sDtm(rp;o0tpt mociat a2eluvon() exnif3ia1la eauvo ()srtrirpiu4om   nctl()srrr(ront1tee iociasfa2uluvs;t4 eeoif iatfpt  ivi s0s2xrxopoydamenmfvslsf rtaxmoou0alt io3tld m2emnvs;()teenmo3ta1fp   ueo (0t2um(opou4ll  mivs ( arurxr no4ape  fciadfm rmnvp ()aetrmociotlatrluei;t trxo(rpou4lmte ncs t  Dum( oou0apt  fctad s rm(msn()artoio oodfpteli s s) rxrio3oudom nmfct t  rta(rpno1tex  o3tatfaDuauvs (4 eerir iydlp  lu i ( seuoio3iudlpt lieiasf 2um( o;u1aeenifetyslm rm(mp t)arxomo ty1oaDrlneolt0 2xrxm3iu4am nmfesatfsDtm(rpno4opt ii3iadla ea( o t)trtnio3iotfmt aueslt t2xmio ny4oltnlnvtatfa2umu pno4teenmfcils s el(vpnt4 lxomo ootfptelneols0srumxmpno4ole mfcs tf rua(ro;u1aee miciltfa2ua(mp;(0tltnmocta1lpD an o;(0t2toxo3nu4lm   ietls)sDur(m oo0tpen fctasfm2uan ont) etrxf3ty1oa   nvo ()s2uoim3nudlm   ictltf 2rrur ou0aeenmf3iydfm el(vpn()tltnmr oodfaDr ues s srtm(mpiu1olt mictls  ruru oou1apxoif3tyd m rm( o t) reniocoo1fp  anvils t2xm(o iudoptnlivtas)a2taumpot4oleomi3iasfa rl(msnu)tlxnmo todfa  lnvs ()setoio3no4alte fctls s2trxm ;o0opt mieiydfmDulnvon()altomo iotopt auvi () etrio iy1op e ictl()a2uax onu4olt moctlsls ul( o (0teeoif oa1fm  luvi;t)srxrir nydlm  mnciltfsDrrur ot0optnif3tls s rmn snu) ltomf tadom   nvil(0s2xrxr3io4al  lnvi s)srrrur ou1tlxoioeild aDemnvont0arenmf3iotfmtr neo;(0seumiopou4olt livilt) rrru  nt0optnmoeiysla rmn s t0tetomr3tadoat au i;t  rtoxmpiy1apt livia(  rtm(  ou4olto i3ilsls2eaumpnt) lxnmf3iytopDelnvsls)srxmxr io1am  mfct tfsDuaxr no0aee  fetyt aDrauvs;u) exomfciy1lmDrlneo;t trtr(rpio1omen nvtas) Drauront4tltoifeilslm2ua(ms (4altrif3tytlmDrau slt) etr(r3ou4lpe mfet s)s2rrx poo4open f3iasfa2ranvp;u0aleomo3iy1lpDeliei (0 2xmio3oy1optn ncsl( aDrrurpot0openmi3tydlm2um( s;u4artomfctytopDraueilt) 2xrxmpoo4lpe livsl( sDuau pnt0tpt mi3ils a rlums t)tlxnmr ty1lp ranvol( trur(o3iudalt  ivt s) rrmurp;t4altoiieils m rauvs;(4aexomfcia1opt li ils)trtmxopnu1alenmfes ( arua(rp;o0teeoioeiatfs rm(msnt)altnirctytopDran s (0 etoxm3ou4ap  lnvi s) 2ta(m nu1tltnioctlslm emnmp u4 lxnio oydfmteauvi;t setoxopno4lptnmfvt () Dumu oot1alen i3tld sDum(mo t4 lxomf3oadfpteanvs;(0t2xrim oudolt livt s srtmxr ou0apxo ietyd m umnvpn(0artrxr iatfmt luvo ()trxrxm3oudalt micilt)aDuaxm no4aetoiietaslmDem(vp (0 rtrifciy1la  li s;s)texm(rpoo4optn fctlt)a2tmx o;u1aexniiciasla emn s;(0alerifciy1fmDe uvi ()trum(m io4omtemfctat sDraxr no0tpeoifctys s2uanmp t0treoio tatfmtr i i t0 rum(opoy1om  mfcslt) 2uau onu0open iciys sDuanvpnt0 etoir3oytla eauesls0 2xmxm3oudapeemietas  Dumxmpou1texnio3iatlaDrm(mont4 exomrcoadfaD livo;s0t2xo(r ou4am nmfctatfs2uaurpoo4aptniictyd m ua(vp;t4aexnxo iadoa r uvo;(0 eurxopiy1ame mfei sfsDua(mpno1oltnii3iydfm2rl(vp ()tleomo oodomDr uvs;s trxm(opoydlmte neiat)aDur(mpnu4opt  feiyt a rm(mp;t) ltrir3io1fp rlues (0setm(r3io1lltnlfetasfa2uru p;o4tpeo ictyd m2rmumo;(4arxniocootfm raivil() 2tmir nydllt mnvt tf rur(  no4aetomfciltlm ua(vsnu0aexnircty1fpD  ies;s  rur(rpoy1lmen fcsl(fsDrrxroot0tpenifcild m ua(vo u) exrxo3ty1laDrlivol()s2umio nydll nlnvta(faDraurpoo0oeeo octat sDean o;u0tleoxfcoodfp rli o;( trumxopnu4llt mnesa(fsDtaxrpnu0aeto f3tytla2elu p (4artrxrciydfpD ln i ()srxo(o nu1opeelieslt)a2ua(m oo1alxomfetlsfa2ea( pn()arxnif tatfm raueo s) etmxm3io1apt mieilt sDra(mpno4openmfciadlaDeanvo u0tlenmr totoaDeaivsls0 2xrxr3oo4alt mfci sfsDtaur ;o4altnmf3iytlaDul(vs u4 exrmr3iytlaD  ivsl() etoxo nu1optemnvslsfaDtmum ;t4tlenmfeildfm rlumonu0arxomo3ta1fp r uvo;s  2xo(mpnodape mivsa() 2umx  nt1aleo ietat a uluvs;t4texnxo3tydfmDe neilt0s2uriopny4ol n fcil()s2taxrono4tlt  oetat s ra(mo;() rxnmr3tytop  au olt  eto(o3iy1omee fctltf rrmum ot0tlen ietltfaDel(mon()tetrir3iydomt  uvi s)trxmio3iodlpt mfvtas)aruau o;o1tpeo fetldfm umnvo u0tltomr iytlm eaies s0t2urxr3oo4lp nmfcsls arumxmp;t4aetomfeiyd aDrl(ms u4trxoxf oa1fmt  nes;()tetrirpiu4ol nmieilt)a2um(mo;u4ole iictaslaDemu o u)alerxr3io1oaDeliesl( trxmim no1amt micsltfsrrmuro;t0oex  o3iytls rm(msnt4tleomfcta1fmDrliei ( s2tm(opnudlmt  netatfsrrrxro;o0tlxniocils s2rmnmsn(0 etnmo3oytoaDeluvi s) 2xrio3io4lmt livtat)sDraum ot4apen ietldfm2ulnmpnt0tlermr todlm r ueo;t0s2tm(r3oodoltn ici s)aDumumo;t4ape moetys s eluvs;u) renmo3ty1fmtrln olt0seuoio3oydap e ivsl( arumx pou0tpe ioeiys m2umumo;t4 ltrio oodomD lnvo ()trtr(rpno1lp n icsls s2raxr ;t0aetnmfeiatlm ulnms ()trxoxf3oo1opDrau s;t  rumirpio4lltnmiciatfarrrxrp;t4opxoio3ildfm2rmump;u4 eerxf3iodfmtean olt)texmir3oy1olt  fesltfsDrm(mo;t0apxoiociltla2uln o ()alxrir3oa1faD ln s;t0tetmxmpiudamtelnci t)sDurxmono1apt io3tytls uau s ()arxomocia1omteauei t) ruoxr3iydomt lfet t aDtrxmp;u1tpxn feiatlsDemump u0tltrxr3iotlm rluvo;()sexoxm oodamt lnvta(  2rmxrpoo0olt iicilslmDrlu o;(4 ltoio3iy1op   ieo t  eumxrpio1llenlnesas)aDrm(m ;o1tpxn o3ildfa uau on()tlermo3tadlat lies (0 rtrxr oo1ap nmfcils)sDtr(  ;t0apeniiciasfsDranmpnt4aetoxo3iatlmD aivslt)t2trxrpoodomen ncsatfs2tm(rpno4tet  octas a2rmumo u)alxnmf3oa1oa eaivs s) eumxmpiydapee neilt) Drax ont4texomo3ilsfaDrmuvs;() leoxo oo1fp rau olt)t2to(r iy4lpenlfvsasfaDtax  ot4apeomi3iatfm um( pnt)areomo3iadfatrlnvi;( t2umir3ou4optn fvtas  Dtrx oot4aeeomf3tys mDranmonu)aetomr iy1oa   ieo;s  exrxr3nu4aptemfvs s)s2tru ono1aetnif3iytla2eluvsnt4tetnxr3iotlptrluvi t)srtmxo iudlp n fct s  rrr(mo;t0olxomieiydfsDrmn ont4texrxf iodoaDeluvo t) eum(o oy4am  mnetl(  Dtmxmp;u0texn ocildfm2rm( o t) rermrcoadfpDrlueols t2trxo oodlmt  nciltf 2uru  ;o4opx if3tlsfm ul(mo u0arenmf oy1latraneo;t  2urim iy1lmtn nvslt) rta(  nu0oetomi3ildla ulnmp () ltoxr3iodfaDeau o t s2xoxr nu1altemivsl(  2umurpnt4alx mfeiyt m2eaumon(0 rxrmr3ootfp rlivilt0 2xoio oo4amtemiciltfsDraxmoot1tpx mieils s2emuvs t4tlxrmr3oa1lp r nvo;s  2uoimpnydam   ivtlsfa2uaxmo;t1olxoifciytfa2umuvs t0 reoxo todla   n o t0trto(opnydameemnvil()s2rr(m no1apx mfctlsla ul(mo;(0treomf3oa1fmte u o t setoxr iu1ol  mfesatf 2uauro;t1ope  fetlsfmDulumo (0trenxo3oo1la r i s t)s2um(mpiu4lmt  icsls  Durum ;t1tet ioetldlm2umu ont0aleoxo tadopD  ies;() rtrxr oydaptn fesas) 2raump;o1apeo f3iatlaDeauvo t0altrxf3iydlaD  nvs (0 2to(m3oo4lptnlfvsls)aDua(rpou4ole mociatlm2rauvonu4 rxoioctydfm   uvils0 rumxr3nodomt  ici tfsDraumpno4apeoioctyslaDrmnmo t0tetoifciy1fpD lnvs ()seuoimpiu4lltnlivsat  Draumpnt1ope mieiatlmDelump;t4treoxf iotoa  lneils  rxrimpnu4lle mivtltfs2tru pnt4aeeomi3iys m2rm(vs () etomf oy1om  aies t s2tmxr nu4apenmfvt sf 2tr(rpnu0tlx mfctldfa ra( o u0teermocootlmt luvs (0t2xrxopno4ame  fvs (fa2rr(mpno0oee if3iydfs2elu s;u0alxrxr tadlp elivs s  rxo(m3nydlp nmfvtat  Dumxrooo0olx  octlt s2rmumo;t4 lxnxr3iodfmD  nesl(0teumxr nu1ll nmnes s)srum(ronu0tpe if3iysfs2rlu p u)alxomo3tydfpDr ieo;( tetoir nydolt lnctasfaDraxmono0olenioctasfa2ul(mo t)altrxo iytfpt an i ( trur(o3oo4lleelfci s)s2umumpnu4apeoifciad s2ra( o;u0 exnircoatoa  auei t trxoxm3nydaptelivils  Dtaur no4oexniociadfm2eanms;t0alenmo3iadoateau o;t t2xr(m oudol  mietl(f 2uaxrpnu0aee mictysls emuvont0aetomfciydlpDeau o;s srxrxopiodop elnvs (fartaum ou0tlt mf3iatfsDeanvo u4trenxo3tadlmteli o s s2to(rpny4optnmfei (fsDtr(mp;t0alenif3iyt s elnvp t4 lxoxrciodopt  i i (0s2xrirpou4oleelnvtas)srtmur nu4apeomoeiyt m2rlu onu0aetoxo3ta1op  luvolt0 exo(rpoy4lpee netltfa2uru o;t1openmf3tltlaDul(vo t4tltnio oatoateli o t)texoir3iy1ape mfctl(f 2trum ;u4optnio3iltfm ranvont) etoxr3tadla r i i s)t2uoxmpnydlp e netat)sDtm(mont4tpxn oetasfm rm(vs;(4 reoxr3tadfptrln o ()srxo(r nu4om  mfct s)aruaur ;u4olxnmictldls2eln s t0teenif oadfa r ivo;s) etoir iy1omtnmnvi s a2raxrpno0tex  ocild m uaumon(0tlerif3todlm e ivs t0trurxm3oy4amtnmnesls) Drau p;t4teeo feilsfa el(vpn(4 reomfctydfaDeauvs;s)setoxrpoo4lleemncsasfarumu pnu1oeeniociys a2emu s;(0areomo3iodfpDr uvols0trxoxo iydopee fes sf 2rau o;t1aex ifeiasfmDulu s t)aeenxo tytfmD auvolt0sexmxr iudlmtnmivtl(fs2rm( p;t0aptnii3iadfm2um(msnt4 rxrxfcoydfpD an ols sexoxrpny1oleemietasf rtm(m oo0alx  fetydfmDelnms ()artnirciatfptr uvolt0srtrir ny4apt lfetltfa2rrx pnu4tpxnmoeils sDraums u4areoxociytomt ln o s s2xmir ou1olenlfeslt)a2um( pnt4olenmfciadlsDul( p ()trxoxr3oy1laD  neol(0 2xrxo3ou1llenmnci t) rrau  ;t0oex ioetys s rmnvp (4alxomo3iydoatr ies s)tetoxo3oo1amtelivil(  rururonu1oexn feias a emn p u)aeermrcoy1fpDrauei ()tetm(mpiodapenmnci (f Dur( o;t4oet miciatfs ul(ms u4texnxf tatfpD livo;s srtr(m oudaleelfvta() rtr(r ;u1alxniocils m ulnmp (4 renif3tydfm rluvs;()s2uo(m io1ll nmfvs s sDrmurooo4opto i3iyd m2rluvs u4aetoifcoodoaDrluvo s)trxo(mpno4am emnct ( sruauronu0tee ii3tydlaDrmu p;t4trerio oy1fa r nvsl(0tetmxo no4om nmnvsl(fsDua(root4aeenifeiadlsDeaump;u4arxoioctydfat aieslt srxrir ny1ll emfci tf 2tr(rpnu4olxo ictlsfs ra( p u0aeeomr ty1lm ran i;s0 rxm(mpiy1lptnmfcia(f 2rmxrpno0olx iieildfs2el(vs t0 renio tadomt aieols)t2to(o3iu1am eliciltfs2taxm nu0oex  f3tytfa umn o t)trenxo3oo1fpD  uvilt)t2uoxm iu4apenliciasf Dta(  oo0olxnmf3tydfm umuvo;(0teerxrcoa1oa raivols) euoxopoo1omt licsa(f 2tauronu1oee mf3tlsfsDelnmp t0tlxrio3iatopDeliesl()s2xrxopoo1lltnmfcsat  2um(rpno1tptoif3tld a2el(vo;t0 rxoxr3todomD lueo t)trur(o ny1lpt  fei (faDtau oou0opt  iciyslsDrau o;u0 lxrif iytlptr ivs;s)t2um(opio4olee ieilsfaDrr(ro;u1tlt iietytfm rm( pnu4aetnirciadfmDe n i t texmxmpoudape mnes (f 2tm(m oo0tptomfetasfm2ulumo t0 eeoio oytla  lnvsls)t2urxr3nu4omeelncsls  Durx o;t1apxo feiatlsDem( p t0aexoifciatfat  u i;s trxmirpnu1lmtn ietat  Dur( onu4ole iiciytls2rln o u0 lenxr3oytlmDraueol()t2uo(rpoo4apenlnci (  Drmx  ou4aeenifetas m2rm( o;()aexnmr oy1fpt lneolt  rtmxm oy4ll   ncsat)aDrmur nu0tet io3iytla ulump;u)artrif3todfpDe ivils) 2xmxm3oodalte iesasfa2raur no1ale mfctlt s2rlnvs;(4 lenmf tatlm eli o ( trtmim3oudolt  fesa(f rraur nt4oltoiociys m2emums ()aeerxr ia1faDr ivil( texmim3oudlp nmfes t)sDrmuro;t1tlxnifciadla2uau sn(4aetnxfciytfmD aiei;s0t2xrxmpio1apt mneil( sDrmu p;t0oee mo3tytls2el(mo;u0 exomf oodoaDelivs t t2xr(opiydlpee ncsltfaDua( onu4opxnifciytfsDua(vp;(4 ltrxociy1lpDraneo;s0 rtoirpou4apeemieiltf rta(r ;u0oltomf3tlt s ean snu4 exrmo3totlm e ieils0trxmxm3ou1ole mnvtl(  rrau pot0opt mieiltlm2em(ms ()texnmrcoo1omtran i s trurxo3iydopte ivtas) Duaxront4oeenmfcilsfa rlu p t4 leoif3oadfmte nei;t)srxrxm3oydlp nmicsls s2ta( o;u0tet miciaslaDra(vp;(0arxoiociatopDrln o;s0 exmimpny1ole lfvta(faDtaxrpnt0aetnmfeiatls ua(monu0 ltnio3tadfatelnes s)srxmio3io4oltelfci sf 2umxm ;u4oet mi3tat s2rmnvo;u) rtnxf todoptelies;s0s2tmxopoydomee neia(f rrax  oo4tlt mociatfm2umumon(0alxnir3iotfmD aueo;t0t2tmim3iu1op elivias)s2taur ;t1aetomieias aDeluvonu) etomf tytfaDr u o ( seumxrpiu1ameelivils)aDta(mpnt1olen o3tld aDumnvp u0tltoio oydla  li s;( trxoxopnudomt  iviat)aDrru  nt4opto fciyt sDum( p t)arerxf oodlm ran il()sruoio no1lltemfes t)a2um(ronu1tpeomfciasfsDrmu pnt0 eerxf3oy1oaDr nei;s  rurirpiy4om  mfcsl( s2rmxrp;t4alen fetlslm2eluvp (0tleoxr3ty1op   uvs t)texr(r3iydlp n ncilt)s2tmx poo1olt  f3iydlsDran onu)trxomr3tatfpDe u o;s0 etrimpnu4lle mnciatfsrum(m ;u0teeoifcilsla2ulnms u)arxnif3ty1fmteau slt t2um(m3nydlmtn ivsls) ruau  ;o4oex  ociat sDumuvp (0alerxf tatfptr ivs (0 2trxopiydam  livi (  Dumu  nt4optniictadls2ranmo t4trermr3ta1lp raivo s0srxm(o3oodole  fvsas)s2ta( p;u4oet ifcias sDel(vo;() rtrmo3oytlmtelueo ( s2xrxo3iodaleemnvil(f Dumumoot1open ieiytfm uaums;u4artnmf3iadlm eaivolt0t2trimpio1al nlfcil(  2ua(roou0oltnmo3iydfm2el( ont)teermo ootlptrlieols0 rxm(mpio1om  mnvias)sDtrum nt0alenmfciysfsDelump;t) lenmr iytopD  uvol() 2xoio io1lpe  ivil(  2rrx onu1altoifeildfm2rl(von(4texoir tytfa  livol(  rxm(o ny1om n ictl( aDra(ronu4tlt ifeiasfa eauvo;t0 etoxfcio1omDe ivs s0s2um(mpoo1ale lnvilt a2tru  ;o4ole  iciadfs2ran o u0altnircio1fp rlu sls) 2um(m nu1lpt  fetlt arta(r ;u4teenmfeiad sDua( sn(4alerxf3oytlpDr ivi;t  2xrxopoodlmee iviat)srrax oot1apxomfeild aDrlnvp;()artoxociatlp   ivsls)seur(o oydal elnet () 2tm( o;u4tptomo3iad a um(vp;t)trtrmrciy1fptrlu ol(0 2um(r3oy4lme micsat sDtax p;o1tptomfeiat a2ul( pn(0aetnmf oo1lateln o;t  2xoxr iu4ameemncs ()srtaxrpoo0aet mfeiasfa umnvo;() rermr tadop   uvo;t0texmirpny4lpen fvtls  Dtruro;t0alx mieiytfmDranvpnt4 etrxf3ty1lpt anesl() eum(rpoodape mies sf Dur(  ou4texn oetldls ra(vo u) lenxr3tatfaDrlivs;( trtrxo3io1ap nmfvtls a2rm( pnt1tle  o3iydfs um(msn(4tltnmociotfaDrai s s)t2tmxr ou1lpe lnetat srtaur nt1alenmfeiys aDrm( on(4teeoxf tatlp raiesls)truo(o3oo1ame liesltfaDra(m ;o1tptoiieiytlaDemuvp;t4trtrxf ty1lpDrlivilt seuoxo3nu1om nlfeia(f Drmx  nt4tetn octlsfsDranmo;t0 eeoxf oatop elivo;t t2tr(rpoy1omenlivsa(faruaxm ot4tlenmociltfaDeluvp u4altnio3ty1oaDraivo;t0s2tr(mpno4lleelfeias)aDumxm ot1apenmfetlt m rmn sn(4 lxoxo to1opte ues t0srxoir3io1lptemfcsatfsrur(mooo1aleoioctldla2emn s;(4 rtrxfcoadfmD anvslt srurxm ou4lpeemnet s sruau o;t4oeeniieiaslaDeauvpnu4tlxoio3ta1fp   uvi s)sexmxm io1lmenmivslt) Dur(r no4oee if3tyt sDul(monu4altnxr3oo1laDeanvs ()t2umim3nydop e nvslt)sDururoou4opeomieils a ul(ms;(0trenirciotfaDeai i;s)t2uoxm3oy1omtemieilt  rtrum ;u0optoii3tyd a2uluvs u) ltnxr to1fa   ies s t2uoim3ou1om  mnetlt)artr(mono0apenmoetasfmDrmumo t0arxnmr oo1fm ran ilt0 eto(mpiy1lmtnmiet t srumx  nu4alt ioetatlm uanvpnt4 ltoxo oytlpD au i t)setr(m io4om e neta( s2urur ;u1apx ioetlslmDeauvs t) ltnmo3ootfmt ln o;()srum(o3ou1op e iesa( s2rr(m no1tlenmo3iltla rl(vp;u4 eenxf3io1la ran o;s0trur(opiy4amee icsas  ruru  nu0texnmo3iys aDem(mo (0texomocoa1lmteaivo;(0s2trxo3oo4lpen icilt) Duau p;u0texnioetydla2rm( snu4 eenmo iodfpD  ivi;t)setoxr3iydlptnmnesl() Drm(  ;o1oex iietltfm2ul(vsn() etnxociydfpDeluvols)s2xoxr3nodlltelfesltfa2rm(r ou0alxnmfctad m rm( o;(4aexoxfciatomDranvi;() etm(mpoudlpeelfctlsf Draxrpnu1openioetatfm2ra( p (0teenmr3totfat lneolt) 2tmxopnodlmee nvs sfsrtrx onu0oet ii3iydfm2eln s;t4tltnmo3to1oat ai s;s)texr(m3no4olenlneta()srur(mpou4aleoio3iltfmDranvs t)aeenmf3ia1fp e uvo t)srumxmpiodlp elneiltfa2uax poo1apto icilsfm emuvsnt)alermo iodomDe uei s  rtrir3iy1lle micilt) 2ur(r nu4apx  i3iytlmDelumsnu)altrmrciadfmte u il()setmio3ou4amen ieia()artm(mooo0apt mfctltlsDeaumpnt4trerio ta1faDr i i;()t2tr(opoo4ale lncsas a2rr(mono1tpeo fctytfm ua( ont) rtnmr oatfm e ivs ( s2xmxo3oudlp nmnvi (fs2um(rpoo1aetoiocilsfa2ulu o;(4alenmr3oytfmt lueilt)t2triopiu1omtn fes s a2urx onu1olxoiietasls2eaumo t4trenmrcoy1opteanvs;s s2umxr iy4ol emfes tfsDtax o;u4olxniiciasfa uanms;t4arenmrctytfm elnvol()t2tmir iodomte feslsf Drmumooo4alx mi3tls a raumsn(0 exnmfcoytopteaivol(  ruo(r nudap   fcslsfsrrmurp;o4aee  f3ilsfs rm( ont0tetnmf ia1omDr ies t  rtrxr3oy1llenmfvsat a2tm( ont0alt if3ilt s emnmo;()tetoio iodfmt  ivo;s0 exoiopiu4apee fvtat arrrumpoo4aex mictltfa eln p t0aeerxoctodlpte ivsl(0seto(mpou4ome mfvsas  Dtau o;o4aex mo3iad s2ua(vo;(0altrxfcoa1faDelueslt0s2toio3oy4al  mfeil(  rum(mooo0tpt mfciasla el( snu0 ltnioctytfm eaivs;s)trurxr iy1omt miesl( srrmu  nt4tet  i3ilslsDuau s;t)arerxfcia1lat luvo s)t2tr(rpoudope lnct tf rrm(ront0opto i3iatfs2uln pn()aexrmocoa1faDr i i;()setr(opny4ol elfvtl(faDta( pnu0oleniocild s uln o;u4 rxniociy1lptrlnes;t s2triopou4alen nvta( srtaurpou1opxoio3iltfsDuluvp t4trermr3ty1fat  uvo ()teumio nodom  mncia() Dua(r ;o0tleoifeilt s2rmn sn(0aetrio3oadla   u olt) rumirpoodlptelfcsat) rrmu p;o4oeeoiociaslm elnms;u)artnxfcto1omte u o;s sruoxopou1alt lfesls s2trx pot4olt mfeiatlm2ua(vo t0treoxoctodoa  anvs t  2xrxr ou1op elfvslt a2urx  no4tpeo ictytfmDran o;u0trxoif iytfpteluvo ()texm(r3iu1om  mfvta(  Dtm(m ;t4oeen fctytlm2em(vs (0 ltnirctotomD aies s0s2uoxopnu1optn ivt s)s2tmx poo0opeoif3iadla ul( o t0 ltnxocio1fptelu o (0 2to(opiu4apt  fvsl(fs2rr(mpnu4aeeoiiciys a2emnmo;()tleniocoydomtr ieo;() rum(o oodlmtemfeil()sDuaxroot1aet  o3iysls um(vp;t4trenmocty1lat  ues;( s2trio nodll emnvi sf 2rmx o;u0aex iietydlm eluvo;t)tltnxfciotoptrai o;()srxmxo iu1amtn neilt) 2rmx pno1texn ociyd s eluvo;(0aeenmfciy1fa eauei s t2toirpoydlmee iet sf rrru o;t1tee  fciysla umuvsnu4tetnxoctodfaD  nes;s)srur(rpio1openlfvs sfa2rmumpno1tlx  fciltla2ul(vonu0tlerxo3tytomtrlivolt0t2umxopio1opte fet sf rrmxroot0alxo oetadlmDrlumsn()tltnio3ty1la rluei s)t2umxr oodalenmnvt (faDtmxrpou1oeenifetatfs uaumsn(0tlenxr tytfp  aivi ( srxm(opiodape mfvtl()a2uaxmp;o1oeeo oeildfaDumumo (4aetoxoctatfmDraneol(0sruo(rpoo1llteliesa(f rrmump;t4tptomi3iys a rmu o u0artrmf oa1lmDrauesls0srtm(mpou4alenmnvs s)aDtr(  nt0aeeo oeiad s2uaump;t)arxomf3tatlpteanesls0tetr(rpoudllte nvias)a2trx  nu1aeeo octytfs2ranvsnu) etnmocoytfpD  ueols0srumxo no4am elnci ()sDrmx  oo4tpto i3tyslm ua( o;u) lenxrctatla ean ol() etoxrpoy4lpee iviat)s2umum nt0aexnmfctydlmDuln sn(0arenif to1lp r ueols s2xrxr3nodlleelfvsl() rtm( pno1tee iietyt s2ul(mo;t0teenmo oadomtrau s t)trxo(m3no4ap nliviatfaDtr(mpno0altnio3iltla2ulnvpnu)altniocoydfatraneo;t0sexo(r3nu4lm n fesasfarra(m nu1oee mfeildfaDelnmp;t0alxrxrciy1fptrauvo;() exmxrpio1lle  fcs s) Drmu  ot4alx mfciat mDem(vs;()arerio3tytlatelnvi;()teumxr nu4om emfeilt sDrmumoot4apx mf3tld sDea( onu4 lxnmo3oy1opt luvo ( s2uoir3io4ope lfesat  Drmurpou4olx iiciasfs2rlnmp t4 ltoio3iytom eau o s)srxo(rpoydameelnvsls  rtmu p;u0oltomfetltfmDrm( p;u)aeeniocoo1om  auvs t)srxrxmpoo1aleemneilt aDua(m ;t1aeeo fciydfmDel( s t)aetnio3oy1lmD  u o ( sruoimpnudape mnet ( s2rrxmpoo0tpenmoetasfa rmn o;u) rtomr oodfm rau sl(0t2xrimpiu4lm n icsasfsDtrumpou1tpt mocilsfsDemuvs;(0texnif iadopt aivs ()tetmio nudapt  iesl( a2trum nt0tlxnmfciatlm2rluvs;t) lenxr iotom rluvi;s0teuoio iy1om emfesat sDuaxm ;t4tpto fciltfm elnvpnu4 rtrio oytomDe nvil(  rtoxopiudlpe  nei s) 2uaumpou4aet mo3tatfm2eln onu)arenmf ta1fmDe iesl()sruoio nu4amtnlivilt s2uaxmoot4ole ioetas mDuln p;(4 lxnxr oy1lmDe ivo t)trxoimpou1lmtelncsat arum(mo;u1oeeoifetld s ul( p;t) exomo tytopDeai ols0 eumxm3iudopeemici t  ruaxrpou4tptoiocilt aDem(mp;u4 lxoir oydoptelneo s)texmxm ou4lmte nesas s2rr( o;u1aptomieilt m emuvp;(4 rxrir iatfa  ln i t t2tmxm3nu1am elnci (fs2tm( p;o1tet mictltla2emuvo;()trtnxf3oadlpDrai s;s  2tr(m3oodlm nmfcslt)sDuaxro;t0ale mociydfs rmn pnu4texnif todlp rlivsl(0sexmim3iy1olt micsl()a2rrxmpnt1oleo i3tld s2emumsnt0alxoxocio1faD lieo s  2umxo3ou4olt lfvias) ruaxrpno4aptoio3ild m2rmnmo;u0alxomr oatomtrau i;s)trxoxm3io1llenmfci (faDrrurpou4aet mo3ildlm2ulnvo;t0aetrxr tadlatrau s t) 2xrir3iu4ol elict s) 2rr(r ou0tlxn oeiys sDrlnvp (0 rxomr tatlp r neols)t2xoimpou1omt livi ( a2rr(  nu4tlxnii3iad a ranmp (0trxoifcoa1laDranvo;() 2tmxm3oodolee fvtlt)aDrauront0tleomictad aDemnmp;t4 eerxo3oa1oat  ieo s)setrio3ny4ape  fes ( arraumooo4oltomo3iatfm2um(vp u) eerio oytfmDrai ilt) ruoxo3nu1omtnmfcs t)aDtmumo;u0oeenmfeiysfm ranvont4 eermr oydlmtrlieo (  eumim io1op  mieiat sDurxm ;u0opeoii3tyd s2ea(vp t) lxoxocoodoaD lu ilt0s2urxr3iy1lpte fvsa( s2rrur ;u1tlxoifetltfmDeauvpnu0 renmociotfm eliei s0teuoiopiydomte nciatfsrrmur nu4alxo fctltlm rlnmo;(0aleoxo totlm e u olt t2to(r3nudlpee fct ()arraurp;o4apt  fciys a uauvp ()tlenio oodfaDrau s s0srxoiopoo4llenmfvil(fsrtmu poo0aex  oetydfm2ua(vs;(0alenxf3iy1fp r neo t) exoirpnu4apte nct (f Drrum oo4ape if3ilt s2em(mo;u0arenxrctatomDraues s0truoxr nu1am emnesat  rrrxrp;o4aeeo ietatfa2umu onu0aexrio3ty1oat  ivo s0 2uoxr3nydap   nesasfartrxm ;o1alxnmiciasfa2rlnmpn(0tltrio ia1opDeaies;s0teumio3iu4op   fvs s)a2taxm ot4oexn ictltfm rmnmsn() lxomo3oodfpt  ues;s)setm(mpiy4lmtnmiet (fs2tr(mpot4alto i3iltfaDran p;t4arxrmf3ty1lm eaiei ()sexo(m3nu1al   fvtas srta(m ou4aexomociyt a2ulums u4trtrio3iatfmDeluvo;() eur(o3ny1ll emnes t) 2tmxm nt1alx ifeiatla ra(vont)teenmfciadlptrlnvs;()t2umxo3oudlme lneil(f ruax  ou4olxomfciytfa ul(vs;u0aetoxocoo1lpDe i i;(0truoxmpou1ol   nviatfaDtmxmpnu1apxn i3ilsfmDrau snt0altrir3iatfaDrlnvolt) exmxm3no4apt lnes ( s2raurp;u1apen ieias mDelu o u0artrmf3iytfate uvsls0 2to(r iydoleemfvtltfa2rax p;o4open i3iytfa em(vs;(0artoxr3ty1latrlnvi s0teuo(o iudap nmnetatf 2ur(roou0alt  i3tas sDuluvp u0trerif3io1lpteanvi t  2xr(opoudlptemfvia( aDtm( pnt0opx  fciatlmDel(msn(4texnmr3ootfmteluvs;t t2uoimpnu1lptelivs t a2uaxmpoo0apxoioetydfs ul(vs;u)trxnmo3oy1lpD  i o;s0 exm(o3iy1ame  ncia()s2umxr ;u1aeenmicilt m eluvon(0 etrmfcty1om eli ils  etoim3io1olte fvtl() rurxmooo4aptoifetydla2ua(vp u)artoxf iotfmte ieo s  rxo(r nydapen fetlsf 2tr(  no1opt ifciyd m2rl(ms (4artrio3oa1la rau s s s2xoiopoodlmenmnct t)s2uaurooo1opxo octydfa ranvpnu4tlxnir3oatoa  anei ()setm(m3ny1apen net t  Durxr ;u1tltniieiytfsDeanvo (4aetoxoctydfm rlivi;s0seuoim3iu4ap elicilt aruaur ;t1tlxo f3tadfmDumu o;t) ltrmr ia1lm e ivsl()trxmirpiu1aleemnct (fsDrrx o;t4tetomo3ildfm2eln p u4altnmo3iytopDr ieol() 2xo(m nudolte neiltfsrua(mo;t1oet mfeiydfsDrmnmo;(4trenirciytla e n ilt0 rtoxr3nydlpee neia(fs2tm(  oo1tptnmicildlm ua(von(4aeeoir oodlmDr ieo;s s2tmxm3oy4lpee fvilt)srrax o;u0texoif3iltlaDeanmonu0teeoxo3to1oaDrlneo s) rxm(r iydllt lfeia(fa2ra(ro;o4ape mf3tlslaDulu s u)arenir3iotoatr ivo ()truoxo no4op elnei s a2raumont1opto icilt aDeau snt0aetrif todoa  lueo t s2uo(m3iy1ap n fesa() 2urumoot0openii3tatlmDrm(vo u0trenif3oa1omDeau i;(0teuoir io1oltn fei t  2ra(mont0oee mi3iyslaDel( p u4altnio totfp  lu s ( teuoim nu4lmtnmfes s a2ta(r ;u4texoio3iadfs2ea(vp u0 etomo oadfpDe ieo;t0sexoxm3iy4optelivtas)sDtau  nt1aetniiciyslsDeanmp;u0arxnif3tatla rluvo t)seur(m nu1lptemfvt s)sDuaxm ;o4olxoii3ildfsDuau s;(0areoxr iadfmDrlieo;(  rxoxr iodope  neias)srtrxmp;o4aeeo iciyd m ulnms u) exrir3oytfm   n s;s  exrxm ou4ap  micilt srta( p;o0alto feiyt sDeluvo;()trtnxfcoytfaDeanesls) rtrir3iydop e fciasf 2ra(rp;u4apto fciys a em(vs u4trenxfcto1fm e i ils0 rxoio io4al  lnei sfarraxr nt1tleomo3iadfmDrauvo;(0artrio3totlp r n s t texmiopiy1am n ict t) 2ta(root0optnmfetadla2eluvp t0teeriocia1lpDean o t s2toxopiodlpen ici sfsrrmu  nu0oetniociltlmDrm( o (0 renxr oatlp   nvo;()sexmio oodol  mici tfa2tax oot0oetnif3tatfmDumn pnu)teenxr3ta1oat  nvol(  rtmimpiudal   netlt  2tmu  no0aeeomoetydla2rm( o;t0trtrmo3ty1laD  nvs (0t2tmxm iu4lmtnmnet tf 2umuro;u0aptn o3iydfa2ean onu)trermr iy1lmt  nei s  2xm(opoy1amt mnct tfa2uau pot4texn oetytls ua(mo;t4artrxf3oydomt liesl(0trtmxm oy1al   fvil(fsrtm(ro;u4olenifctyd s umn snt4trenxf3todfaDr u slt0setrxo3oo4lm emneslt)arrmu oot1ole  fciadfaDrmuvo t0 exrmocia1fm  ai s s0s2xo(r oy1llenlfvs (fsrua( ono4altnif3tas s ul( p;(0 reoif iytfmtrai ilt)srtmxo oo1om  mncsat) rrruro;o4apx ioctat mDuluvp (4arenifcoo1omteli s;(0s2trxo oy1amt mfes t  rrr(m nu4opxomfeiyt m2rlnmonu)altrif iadfmteaieils s2umxmpoy4ame mfeils srtmumo;t0tlxo f3tyt aDemnvo;(0 ltoxf ta1fm  liei s setmxo3iodlp   nvil(f rrmur ;t1aexn f3tld a2ra(vs;t4aetnmf iotfp  liesls0 ruoir ny4lme micslt)aDtr(mp;t4altnmfcildlmDrlu p t)trxnxrctadla raues;(  rxmxmpiy1lltn feias a2tr(  nu1oetomoeiltla2rm(vpn()altnxf3io1lpt lu sl()s2urxm oy1lpte ict s)s2ur(rp;u1aex  fcildlsDrln sn()texrxo iytlp rlu ilt0 2umxr3no4lm e iei s  Drrxrpoo0tle ii3iatfa2ea( s;t4trtrircto1omDr nvs t seto(r3ny1oltnmics s  2tmu  ou4tlxomfctyt s ran s;t4 eenir oy1fm   ueo;s t2uo(mpoo1oltemiei tf rum( onu4tpeniiciasfs uau pn() leoircto1opte nes;t)teumim3io1olt  ncs s) Durxrpou0tlt mf3iytfa umnmo;t)trermfciodfmD livol()srtoxo iu1lpenmnctlsfarrr(r oo4tet  fetasfa uluvs;(4aexoifciytopDranvs t trxoirpnodaptn icilt) 2tmumono1oex if3iltlm2uaump;t4 rtrmr3oodfmt  neo;s0trtoxm3nu1aptnlneil()aDumx ont1apxoifciasfs rm(vo t)tltrir3iydoatraiei;s  exrxr nu4om nlivia( s2urum no4tetn fciatlaDrm( p u0teenif3iytomDeaivo;( setrio3ny1omtnlfci t  rrru o;o0ope ii3iasfmDeanvp t4trtrmo iodla  lu ols)t2umio nydom n ivtasfaDrmxr ;u0tlen fctlslmDrmn o;u4arxoioctatopDraueilt trxm(m3ou1lpenlfeil( aDtm(  nu1aeeomi3iydlsDua(mo t4 ltnxocoadlaDe neo (0s2xoxm iu1am n fes s srtmxrooo1oexnii3tys aDrlu o;t)arermf3iodlpt ln o;s0sexoxo ny1aptn ivsasfarua(r nt4apeo o3iadfa2elumpnu) etrxrciodoaDeauvs s0srumio nydlm  livtat) Drmxm ou4tlen oeiydlm rluvs;(4aeerxf3tytom  aues;(0 ruoimpoy1op emfesa(  2tmu  ;o4tlxo fctldla2rlu s t) rxrxo oadfpD anvi;s  etr(r3io1apeelicil(  rtmxm nt1oexnmoeias sDraumo t4arxoxrcia1lpD  nvi t0 exmim3oodll e nvia(fsDur(mpnu0tlxomicilslaDrl(mo (4arenir ia1late uvols0trxmxm3nydlmen fcilt)a2ur( o;t1tlxnmoctls m2emu s;u4trenxf iotom r ueo s0 etmim3iu1omeelnctasf 2tru o;u0ale micils a el(vs;t) etnxo3ty1fm e nei t  rxoxr3ny1lmtn nesa(fs2tm(  ;u4oexnmfciatfs ra(ms;u0trenxr3oydoat lneo;t0s2trxmpny1optnmivsas)artmu  ou0tlx moctaslaDrmnvo;(4 rxoif3oo1fa elnvi () rxrir3oudlpenmies sfaDta(rp;t1aexn f3tadlaDum(mon()tltoir tatfa elueo;()texmim3iudlpt mnes (fa2tax p;u0tlt  oeildfa uanvo u)arenxocoo1om ranes;()t2tm(rpiodope lfci () Dtmx pnu4oexomietydls ulnmon(0aexrxo iydom eaues t0t2xoxr no1amtn nvtasfa2rau onu1olxomiciasfa rmu s;u)arenif3iatlat  uei;(  rtmimpio4lp  lieilsfsrra( o;o1oltn iciadfs2uauvo;t0areoir oadlaD  neolt trxr(mpoy4opee feta()arra(mp;o0oetn ieiyslmDul(vpn()alxrmr3oodlaDe nvi;s srtmxo3ny4llte fetat sDumumo;u0apx if3iysls2raump;u4tetrmo to1fm elies;t  exoirpoo4ll nlfeils srrm(m nt0oet  ictadfaDeanmo (4aexnxo tytop   n s;t s2tr(o3oodaltnmnesat srta(rpou0tpxn ietlt s2rl(monu)teerio iatfmtraneilt0texrxrpoydlp emivtls) Draxmonu0opxn f3iadfm ulnmpn() exoir tydfa ranvo;t0 2toirpoo4lmee fvsltf ruax  ;o1tpx mictltlaDemu snt4altoif3ta1fmD anvilt)tetm(rpoydap nlfcsls s2tax pnt0aet  ociys m emnvpnt4 rtomr iatfpt luvsls0t2xmxm3no1lpen ict t) rurxrono1alt  feiltfs2el(vont0 exnxf3iotfpD  u i;s seuoimpiu1optnmnct t  2ta(mono4opt  octlt a ua(vpnu0 lxnxocoa1omDeaiei;()trxm(opnodaltelnvil()a2rr(ro;t4teeo f3tadls rmn o t0teenmr3oadlpDr ues t) 2urxr3io4olte fvias)a2taum ;u4apxn oeiad m ulnvsnt0 etnxr tadlmt liei (0trurxm3no4op  mfcsatf Draxroou4ole  fctlslm2eaums t0aetoir3oydom r i il() 2urxm3ou4omte ict ()aDra(m ;u4altoiieiyd a ul(vsnu) lxoif tydfmtranvs t truoxrpoy1omtn ivilt a2urxmo;t4tleomi3iltlmDel(mo t0 eenmf totla  livi (0t2toim iodll elivs s) rtmxro;t0oleniictys s2emn o;(0 rxrxo3iadfatrluvsls)srxr(m3iy4am elivs tfarrm(m nu0tle moeiyslsDumnvp ()alenirciydfa eli olt)s2xr(o iy4ll  mivt tfaDur( ont4tleoifetlt s2rlnmo u4 etrir tadlmt aues;t0t2triopoydom e fesl(fsrtr(ro;u1oex  feiysfsDrm(mo (0teermr3oy1oateln i;s) ruriopnu1altnlncils srta(  nu1olt miciytfs ra(vp;u) lxnircoo1om  aues;t0trtr(o3iydlptelivt tfa2umxmpnt4tlxoiociydla2rl(mpnu)trtnif iodlmDeaivsl(  eurim oy4omtnlnct ()a2umu pno4altomociltlm ra( s u0tetnioctatfpteli i;s0teto(r oudamen fvt s a2tax ono4alt mf3iyd aDrlumont)trxnmf3oadlateluvs;s) rurxopiodamtn ivils  2ur(  ot0tpxo ieiad m uau p;t0 etomr3oydfpte n o;s)srxr(mpiy4aptn iciatfsDtru  nt0altoioctadfa2ua(vo t0 rtrxrcootfptrlivolt sexr(rpiudlpeelieslsf rtmxmo;t0oleo fctyslmDuln s;u0artnxf3iy1omD ai s;()texoxr iodomenlfctlt)sDurxmpot4tetoioetydfs ua( pn() eermfcootfm eluvo;t srxrio iy1oleemnetasf 2rr(mpnu4olt  i3tatlm rmn p ()tlxnir oatlpDeanvils0 2xrxrpnu4ll n nesls)srur(ro;t4oee ii3tlt a2rmuvs;u4 renif3iatlmDe i i;t0tetmxm3nu4llt lfvilt s2taurpoo1altn fciat aDeanmo t4texnxocoodoptr n o ( seuoirpnydam  lfviat s2raurp;o0aeen oetadfs ul(mp u4texnmf todomDr ivs s)sruoim iy4ll emivtas srtmu pou0apx  o3iydfa2rmnmsnt)aeermf3ootom  aueo () etoimpny4am e nci s) Dtmu  ot1tlx  oeiasfs2em(vo;t)aetomociatlm e ivo;s0 rxoxo oo1ome  nvsat  rrm(  ou1alen ociadfs2uluvs t) exoxocia1lmteanvsls0s2xrxmpiodoleemneslt)s2rmxm oo0oee io3iadls ea(vp;t0 eenxf3oydlmtranvo;t)trxoim iu1amt mnctat) rrm( p;o4tltoii3iadfs2ul(vo ()alxoxf iotlaD  uvi;t)srto(r3ou4ll nmicil(  2rrurp;t4aetnmo3ilsfs2ranvsnu0tetnmf3totomte ivi;()teuriopno4ap e ncsas aDta( pot4aet  ieild sDra( p t4tlxrmo oatlmt li o;t)t2xrio3io1ol emfeiat)sDtau p;t4oeen icilt mDemnvo u4treoif3oytfmD  i slt0srxr(mpoy4lm  lfvt ()arururpou0oltnif3tatlm2em(ms;u0aetrxo totoatran i;s0trtmxm3oodopenmnesltfa2um(rp;o0opt  iciatfm eanvp;()artnxf ootla r iei s t2ur(opoy4lleemfcs tfs2urum ot1tptniocias mDua(ms;t4texomf3tytlpD  i ol(0 euo(o nu1lmt  ncsls s2uau  nu0tpx mfetlsls eanvpnt4 lxomr3oodoate nvolt trtm(m3nydome lneslsfsrrmumpnt0aleoiietlt a2ra(ms u0trtomf oytom  au o t) rtm(o iu1opeelncil()aruru pnu4oetnio3ilslsDrmumsnt)alxnxfciy1oa rli ols texmiopiudomt  ivtas)aDrmumont0tpenioctysfsDumu s;t)trxnmrctadlp e iei ( s2uoirpoodap emfctas arrau pnu4oex ioctydla2rmums t)trxnir3tytfm e u i;(0 2uoxrpnu1olt lncs t a2ua(root1apx  icild a umums (4aleoxrciydoatrlivil()srxmio no1lme  netl(farumxrpno1tltnif3iltlsDelump;u)tlxoifcoodfaDr i o s)srum(m3iy1lmtelnet ( arrm(rpno1apt  ocild aDraumpnu4trenir oytfpDeaieilt0 rumim iy4ope  icsl(faDrrum no4tpe io3ild m2ulu snu0texoif3oy1fmD lnvsls0 2to(rpnodopen fvsa( s2rmu o;t0oet mocils s2rl(ms;t4tetrifcoydoaD aivilt)teumim3iodomtn icslt)arrmx p;t1olx mfcils s2uln p;t) rtoxrcto1lptrauvi;s0 2trxrpnu1lmte nes tfartm(  ;t0tetoiociatfa em(mo;t4alxoxocoy1fpDeauvo t0truoio3nodapee fei t)sDumxrpnt4apx ii3tltfsDean s;u)trenioctotop ranvs;t0seurxo3io4llee fvsa(fsrrau onu0optnmfcildlm rau o;t)arxnmfciatoaDean o ()srxmxm3iydom elnei sfsrtr( pou0apenmiciyslaDrlump (4aetomf iotomtr i sl() 2xm(rpou1optelncil()s2rrxrpot0tptn feildla uau o u4tlxnxoctydfp r u s;t)s2trxm3oodal nlfcils a2rmum ;o1teen o3iydfsDum(vs;()trtrircootfa elnvslt0 2to(r3iudaltn fes sfs2rm(  oo0tee mfctlsfsDuan s;u) leniociy1oatr n s;t) rxoimpio4op elicilt s2um(r no4texoifeiysfa2ran o;(4aeenmf oatfm rau sls  2urxmpiudam elfesl()arra(r ;o1tlx moetld aDel( onu4aexrmo3tytfpte u ols0sexr(rpnydaptnmicslt srrrumono4tpt  ieias sDra(vp;t0 lxoir3ta1oaDeauvo;(0srurxmpoo4omt  nei s sDuru  ;t0tltomo3tat sDel( s t4 eerio io1oaDeauvo ( srtmxopnudoptemfcils a2rm(mpou0aex  ietytls2rmu pnt4aetoxr3ia1laDr n i;t0 eum(rpnodape mfetlsf rtrxrpou0teenmo3ildlm rm(vont)teermfctadfptrauei;s)srxoir3ny1op nlfctl(fartmurp;o0altoii3iydlm ua(mp u4tlermr3oadoptraivo;s0trxm(rpiu4ap nmnvia( arur(rooo1tltoiiciyt a ua( onu0teenifcoatop eaneo t)srtrim oydoltemfvt (  Drrxrpnu4ole  ietys a2ulnvo;t4alerxf ty1lpDrauvo;t) 2umimpou4llenmnctlsfaDta(mp;u4oleo f3tldfa2ul(vo t)trerxf oy1omtelnvo s0 ruo(o iodalenmnvtls)a2ua(ro;u0tet mfctadfa eanmonu4 exrxrctydfaD ai ol()srxrir3nodameelfcil(  Drmum ;t0tpt ii3ildfm2rm( pnu4tlxrxo3ta1laDe neo t tetr(opiu1omt miciasf 2tmxmpou4alto fciadls2ulnvpn(4 eenir io1fpDelneo;( t2ur(m3oudam elnvslsfsrtmxmp;t4aetomiciyt s emnmo (4 lxomrcoa1fpDeluvi (0trxoxrpno4ole mfei s)sDtm(  oo0teen ociltfa2uln o t0tlxnmr oo1omD au slt0setrio3oodam   net t) Dtrxroou0opeoifctadls ua(mp u0 exrxr oa1fp r neo s0sruo(mpny1aleelivta(  rtmu  oo1oleomictysfmDelu p (4 ltrmfcoy1fa ranei;(  etmxo3oy4amenlnctls  2rau pno1tle moctydlmDranmp;u0teenxr iadfateanvs ()setmir3nu4opt  fei t  rumxro;t1apxn i3iadfa2elnms;(0areoif io1fate nesl(0 etmxo3oy4aptnlfeslt) rta(mono4tlx miciyt mDuanvs t4 rerxrctytlm  lneo t)teto(r3iudame  fet t) rtaxmont1olen f3tltlaDuauvp;u4aetoxr oatla r nvol(0teur(o nodol n ncilt)srtrxrpnu0opx iieiasfs em(vs;u0 lxrir3to1lpDeluesl() 2ur(o iu1ll elfviat  rumxm oo0aetoioctasfm uauvo ()treoifctotla  lneo;t trurxrpoo1aptelnes s) Dtmur nt1oeeoii3tlsfs2eau on(0arxnmrcty1oatrlnesls  etmir3ny4lpte fvils)s2umx  no1tlxo ictytfa uaumo u)artoif to1oa  ln o t)setr(m oo1lmenlnvilsf 2tmxr oo4oee  oetatls emn s ()tleoio3iodfa eauvi t  eumirpnudol n neia() Dtruro;o4tptn i3tyd m el( sn(0aeenifcoytomDrln i t)s2um(mpio1om n ivi s sDtaxmpnt0tetomoetad mDuln s;()tetrxr oadlpteli o (0s2tr(r3iy4lmeelfci s)srta(m nu4aeto i3iydfs2emuvo t)aexoxo iy1oaDrlnvs;t0srxr(r3oo1aptn net (f 2rmxronu4tlt mi3iat s2eaumsnu4aleoir iy1op ran i s  etrxo3no4ll nmnci s) rrau ono0olx mieiltfm uln s u)artnxr3oydomteanvs s0 rurxr3iudlp  lfcsatfs2uaur ot1apxo fetadls umuvont) reoxo oadfaD ln ilt trurio3io1lm  lfvsatf 2rrxmo;u0oexnmoeild s2ea(vpnt0altnmr3ia1fmDr neols0 rtmxr3oy4ap  mictls) rrmxmpno4oeeniiciysfsDumu snt) eeoxrciodfate neo;(0texoxo io4lleemfvta(f rtmx ono0alto iciydfmDrmu s;u4 lenxo3oatlmDrluvsl(0s2xmim no4op  mfvt ()s2uax pno4alxnio3ilsls2umn snu4tlxomo3todoaD  nvi s srxrxopoy4aptnlivtl()sDrr( onu0opxoioetad aDrlu p;u0tlxrifcto1oa r ivil() 2trim oudlmte ietlsfaDta(r nu4tpt mo3tldlsDemnmo;t)aexoxrcoo1fa   u ilt0setoirpou1altn fvslt a2rr(  ;o0apt mfeiasfs ul(msn(4teenmo3iydfaDeaneo;s setm(r3nudol nlfei tfaDra(mooo1oee ii3tydlm uau snu)alenxfciy1fmDeaivilt)sexrim nu1omtelivil()aDurxront4aee  feiyslaDuaums t) rtoxrctadlmtelueo ()seur(o io4ap  mfvtl()aDtr(mpnt0tltnmieias sDumuvp t)alerir oydfm eauvo;t) eum(r3oo1olte nvsl(fartmumoot1opx  ieiasfa em( s u)trtnxf ty1fa  lies t) rum(o3oo1ap  liesls a2ur(mp;u0tee iietyt s elump (4 rtoircty1om   ivi s0teum(opiu1aptelivtls aDtmur nu0oeeomi3tld a ean p;t4aleoir3iodlmtrau o;t) rxoxo ou1omtelicia( aruaxmpno1optomocilt a2uaumsn()texniocootfat aneo s)sruoxopoy1oltnlfviltfa2tmu pno0tpeomi3iatlm rmu p t4 rxomfcty1lat  ivsls)s2trxrpny1ole mivtatfa2rmur ot0optomo3ildla eau o u0aeenircoydlmt lueolt0teuoimpoydlltelnesat) Dtr(m ot0olt mociys s2rlnmo t4aexrxf3iotfpte nvi;(0texmim3iudapenmfct tfartaxr oo4tlxnmfcias s2rlnmo;t4trtrxo3tydoateau i;t0setr(r ny4am emnvtlt)aDtmx ooo0tleo o3tysfa2ran pnt0artoif3tadlmDe ivs ( s2xmiopoo4lpt  nvtlsfsrrmx p;t0texoiicilsla rauvo;() lxoif3tadlmte iei;(0srto(o nu1opee fcsas  rraur ou4oltnmoetlsls emu s (0 rxoxr totfp ranvol(  2xmiopoydapt mnet ( s2rmum ;t0aptomicild s2eluvon(4aetrif oy1oa rlnei t) rxm(r3oudomte ieta()sDrmxrooo1altn f3tyslm rln s (4tltrmrcio1lmDeluvo;( srxmxr3no1omeemneilt)artrurpoo0tetnifctadlsDrlump u)teenmf3ta1optrli s t trumxr iudlpt  icsa( aDrr(  nt4alxoiieiyd aDeluvon() lxrircoodlatranvo s)srtoirpoo1ll   fvs ( aDua(mo;t1alx ii3tatfaDeanmo (0 renif iodlm  luvils  2uoim3iodopt lfvtas)s2urxmonu4oetoioeiydla ea(vsnu)arerio3iy1lat luvs;t0texmim iydlme mnvs t  2umxmpou4tleo octasfm2rm( s t4aetnmo3oadlaDrlu o s) rumxr3nudomee ivs s)a2rrump;o1open feiys sDuauvs;t4treniocoy1lpteaivi (  rxo(r iodlmte fct ( aDua(  nt1tleomf3iys a rmnms u) lxrmr3to1la raneo;s) rtoimpiy4apt liesasf 2urumoou4tlen fcias a em(mo u4texoir oy1omtrau slt trumxm io1ope miei tf 2tau ono4opxniieiysls2eanmpnu)aetrxf3iodfpDeaneslt)s2urxo3iy4op e nesas)artmurpoo1olen feiyslsDuauvo (4trxrircoadomD aivo ()srtmxo3io1lleelnvsa(f Duaxmpnt0alxnif3tldfmDrmu o t)tleoxr3iodfm  ln il(0s2umxm3nydameelfei ()srta(rpou1openii3iys mDem( s;t0alxrmr tatopDeln sls t2xr(rpio1lmenmnesat  2trx  no1apx miciltla uln pn(4 rxnmociydla rauvs s  2uriopny4lpenmietlt sDuaumpno1oetoioeiyt aDea( on(0texnmo3tytfmtraieo;()s2xm(r3ny4ll  mnetasf 2tmx ooo1tle mfciydfs2ul( sn(0 rerxo3iodlpD lues;s s2uo(o3oo4lptelivtas)s2tm(mp;o1optnif3iytlaDuanmsnu0aeenxrciodoaDraneo;() exmxo ou4ope mncil( s2taxroot0alx moetydfs2eaumon()arxrxr3oatopt aies;(0s2urxr3iydale  icta() Dtm(r no0aetnifciysfmDul( pnt0tetnio iadfaD  ies;t texoxo3ny4aleelicta(f 2rrx pnu1aee  ociatlmDuanmpn(4tlxrir iodfmDraieo;s trxm(o3oodap n nviat)s2uru  no4opxn ieiys a emnvo;(4tlxomo3io1op  li olt t2xrxopio4lmtelietat) Dtrum ot4tltnio3iadlm2ea(vp ()alenmf3to1lmtelivo;()tetrirpno1ome mneia(f rumum no0tlx mf3iatfs umn s;t)aleoxf3iytoaD aiei;t)trxm(o ny4lptemnes (faDuru p;t4aet mfeiadls2emn p u4tlerxr3oy1laDr u olt0 exrxo nu1lm  lfciltf Drmx  ;u4tex io3ilt m rluvs;u)aexnmocoydop  anes;s sexm(rpiydal emfes sf 2ra(mpnt1olxn o3iyd a rmnvs u4aexoif3tatfa e i slt0sexo(m3nu1omt  fei t sDrmx  oo0alxo i3tydfsDum( sn() lerxr3ta1op e iei t) 2xo(o3no1am n fet ()a2rm(r nu1tpeo ocild m2eau s;t)alxoif oatomtelneo;s0srurxm oo4llte ivt (farumx o;u1oetnmietas aDumu o;t0 exnio3iatlptraueo;t0s2umxo3oy1altnmnesat) rtmx ooo4texn feildlm2ua(mo;u) rtnxr3iotla   uvilt tetm(r3io4olt  nviatfsruaum ot1optomietls aDua(vo;t4alxnir oa1om eluei;( s2toxo iydol e neiat aDrrx  nu4oee iietyd m umumo;t4aexnmf tatlpDe n s t  euo(m3ou4omen fetat srrmx o;u0olxniieiysfa2rmuvs;()trtnif3to1lmDeaivs ()teurxr nydlpeeliesa(fa2tmumpoo1aexo ociltlaDeau s;u)aetnmo oy1op raiei t  eto(r3io1ll nlnet t)sDtrxmo;t0aet  fciadla uln on(4 lxoxo ootopDr i sls setm(r oodameemieil(f Dtrum nu4olxo i3tatls em(vsnt)texnmf oodop e nvo t0sexr(m3ny4ap elnet ()a2tau o;o1oltnmfeiasfs2elu s;t0tltrmfciytlp r nes;t0sexmiopnu1lm elnvs t)aDuau p;t1tex if3tat m2rl(von(0tetrifctadomDe ues t texo(mpno4lmenlnesl( a2taumo;u4aeeo ociadfa umn o (4teermr oy1faDrliei;(0srxmir iodop emieilsfa2tm(m no0aet  oeiaslaDuan o t0tlerxfcoytlmte nvo t0seto(mpnodop elfetlt)a2rmur ;t0tleomfetyt s em( pnt)trxrir3ia1op r ivi;()teto(mpoy1am e feslt srrmx poo1tleo fciltlmDrl(vo;() rerxo3to1fa  aies t)s2umxm3oudoptnlnvi sfaDuau pno0optnmfeiytlaDrl( o t4tltrio oo1fm   ivs;(0srum(m3oo1lmte ict t)arra(  oo4optn iciysfm rmu o;(4tlenir iytlp   u i;s srtoio ny1am nmieil()a2urxrooo4oexn ieildfmDul(vpnt)arenif io1fmt  ueslt0 2xm(o ny1om elnvs (farumxrono0apt  fctysla rl( p;u0 etoio tytomtraivsls)srtr(r oy4ope  nciat)sDtr(rpno0oet  ictat aDeluvs;() eeoxociadlptrai s ( s2xo(m iudllt mivt t)s2raumoou0aeeomiciyt s2rlnms t) eerifcoo1la   nvil( trurim3oy4omtemnci t arumxmono1tleo f3tyd mDra(von()alxomf oadomDeluvo s0seumxopio1op nlietlt artmxr nt0tee  fctld a em(vp;u)trerxo3iy1omD  uvo () 2uoim3no1lle mfciat) rur(mpnu0alxn o3iaslmDeaump;(4tetrxo to1oate uvi;(0 euoxo iy4opee ieil()a2tm(mooo4oexnifeilsfa uan s;t0arxrmo ootfaD  nes s0 rxoio3oy4ol   fciasfartr(mpoo4alx if3ildls2eaums t4trxnmf3todlm rlues s) exrimpnu1lm e fcsls) Dtrxm ;u4tpt mi3iyd a2el(mo;u0areoxoctatfp eaieo;( t2toim iy4altn nvs ()sDrr(m oo4ape  o3iadfm eluvo;t4aexoxo3todlm   ivols sexrxo nydop e fcta() 2umu  no1tlxomociysfaDeaump u) lxrmr tadfpDeluvilt) rtmim nydop nlici s)aDua(mo;u1apxo feiat s2em(msnt0trxnifcootfatr ieils0s2xr(r io4lp n fvi t a2rax  ot4tpx if3tltls umnmo u4 leomrcoy1fp eln olt0sexmiopnydlpe mfvsls)arrmxr no0alxn f3iat aDra( p u)texrmr oadlm   ieolt truoirpou1om  lfci (  2tmx p;o4aexomf3ias s elnvon(0teermo iadomtraneo s  2urim3oo4ap emict tfa2tau  oo1tex ioeiysla elu snu0aeermf3tatoaDrai sls teuoxo ou1op  lnctltf rrru o;u4tpeoioeiysfa2em(mont4 rtrmo iatfp rluei;s)srum(o3io1lm e ict s aDtaxro;t4apeniieiytla2rmnmp;(4 etrxoctytopte uvo;()s2xr(m nu1llenmici t  rur(mpnt1opxomietyt s eluvs;t4treoxf3oydlaDeanesl()trtmio io4optemfvtas)sDra(moot4oleomocils aDrluvo u)teenmo3tatfpt  uvo s texoxo nydame  iviat srrm(m nt1tlt  feildlsDumums t)alxnxf iy1lmtranvo (0 exm(m3oy1lmt lneias s2umu pot1alx mf3tadla2rl( s t4aexnifciy1fmDeauvs ()s2toiopiodlp nmfcs tf 2um( o;t4oetomociyslsDrl( p;t0trerxf oa1laDeaneils sexm(rpnudamt mfvi ()arrmxm ;u1tee mietyd s ra(mp (4 reoircoatopDeaneols texr(r oy4ole  fvil(  rtau poo0olx ifcilt mDeluvs;(0aleoircoodoaD au i;() 2toxr iydlme lfeils  rraumpoo4texn ieiltfs raumo;t4altnxf3oytopt  i ol() euo(r3oydom  mfcia( aDraur nt0tpxoif3iad s2rmuvon(4trxoir3iytlmDrluvilt  ruo(m ny4oltemiei ()s2ta(r no1olx ioetlslm2uaums;t) lenmrcio1fpt  ivi;s trtr(o3oy1olen iviatf rrr( poo4teeomiciad m ean p;u4 rtrxr3oa1faD lnei t0srxr(m nu4olte fcil(farumu pno1tpt miciat m2ulnvp ()tlxriocoy1lpDelu s ( seuo(o3nu1ope lnviat) rtau o;o0alen feilsla2rmnmo;t4aeeriociytlm raivs;t0srtriopno4lpt lies s sDta(mpot4aexnif3iat m uau p;t) ltnircoytop ranvi ( t2tm(m ny4al e nct () 2tr( oou1olenifciat s rlnmp () leomo iadoa elueo;t  2to(rpno4ap nmicsas)sDra(rp;u0aptnmoeiysla2uaumo;t)teeoif oy1oa   ueils0trur(mpio4lmt  nvta()aDurxmpoo1tle  ieildlaDel( s u)alermr3oo1fmD  uvs;t s2to(mpou1llte fct s) Dtmxr ;u1oeeoii3tydls rmnvs (0aexrirctydlp   ivsls0 rxr(mpiu4omee ivia() Draur ;u0aexomfetld mDean ont4tlxoxo3iadlmtrlneil() ruoim3io1olte fetls aDrrurpnu4alxomo3iat mDuluvonu4tlxnxoctadfptr uvo;() rtoxm3oodalee feias aDtr(m ;t4ole  oeiyt mDua( s;t4aetnmf3oytlp rli i;( trxmir3nu4lpe lnvt s srrrxr ou1apenif3iat s2ul( p;(4aleomocoodfptranvo s srxrxrpny4lptemnvtltf 2rru  oo4oee mictat s rmu o u)texnmocoadomtr u o s)sexmio3iodal   ietlt aDuax oot1aexoiociysfm2eln s;u0 exoircoytopte n sl( s2umim oy1oltn ietl(f 2ur(r no1alx  fctlt s eauvsnu4altrir iydlp  aneo s0trumio3oo1altemiet s  2rmur ;t0openiietlsla rmnms;t)aetrxr3tatom  lieo;s0sruo(r3oo1opee fes t sDrm(mo;o0olxo oeiasfsDra( p u0 lxnxo oodomtr n s;t  rurio3oudamen nvil()srtrxmoou0apenifctyslaDuluvs;(0teenxf to1omDe n i s0srurimpnodalen fvtlt arur(  nu4tptniocilt s eaums;t4 etnxo iodlpDrlu i;s0 etmiopnu1om emietls s2trxr nt4alx mi3tat s2eanvs;t4trenxf ootfpDeau i;t0 2xoxrpoodomt lfetlt srumx o;u4olen feiltlaDemnms;t) leoxo oa1opDean s t)tetmxo ny4lp n fvs (f rumu pnu4ape mictatlmDrm( onu4 etnxr oodomtrlu s (0 2uoxr nydolee nesa() Drmur nt1alxoif3iasfm eln s;u)trerxo3tytlm  aieols0trxrxmpio4al emivt (fsDua(m ;t0tpe moeiyslaDulump;t0arxrmfciytlp r uvo s srurxm nudaleemfetat)srumx  oo4ape  i3iat aDem(ms;(4aeerir3tydlm r n o;t0sexrxr oodlltnmieils a2rm( oou1opxnmfeiltfs umu p u)aexnir3ootoa eliesl(0 euo(m3iu1op eliciltf Drm(r ;o1opxn o3tlsfm2ra(vp;(4trtomo oa1fp elu s t0t2to(o nudop  mfctlt) rum(monu4optoiiciysfs rl(mpnt0aetrxr3oy1opt  ies (  2xrxm3oudolenlivt (fsruaxr nu1tptnmictaslm rauvp;u4trtnmo iodom rlivs;()srxmim nodlpt mnetl(  rraxmpno1alxn oeiltfm2rlnvpnu)aetnmr3oo1oaDrlneo s) 2xo(o3io4olenmfcsltf rumxrpou0olxomociyd a2eln s (4trenxf3iatfateanvs;()setoxr3oodaptelivi s sDta(  ot0alto fctas s elumsnu0 leoir3iy1om eauvi s srtmim io1amenmnesls) 2tmx ono4ale mictat a ranmp t)texnir3totlptelnei;(0 eumim nu4lpe lietat a2ua(  ;t1tpxnmocildfs2uaumo t)texrircoodom eaivi;t  exoir3ou4ale mfctls a2tmur ;t4tpen ociytfm um(vs;()aetoxfcoytfaDraueol( trtmir3nudalt livtas a2ta(r nu1oexnmictls m eln pn() lermocty1fmD anvo;t trum(r iu4ale mnetlt srrmxrp;u0tpxoiiciysla2elu p;()tlxoxf3to1omt  nvi s)setmxrpiy1op emnetl(fs2tr( o;o4oexoio3iytlmDul( sn(4trenio3to1lptrai s;t0seum(r iodopt lncia( srua(rooo1opxoiictytlsDrauvs (0tlxnmo oy1fptelnvi;(0 2ur(rpio1aptn netat)sDtm( ooo1oet ifeiydfa em(vs t0tlxnifciy1lmtean s;s0t2xr(r iudalte feiasf rtru o;o4oeto fcilslm uln o u0texomocoydoa   n o t  rur(r iu1lmeelfetl(fa2uaur no0olxoifctltlmDum( p;(4tetoxr io1fp ean il()texo(o3ny1ome mnvt s aDur(ro;o0tlen f3iat a2umu s () rermfcty1fpD lies;t0trtmirpiu4openlfvslsf Dtmuroot1alxomoeiysls rmnms;()trxrifcootom rlies t)tetoirpoo1olenlnetlsfsDum(ro;u1ole  i3iltfs ua( pnt0 exrir oa1lmDraiesls)trtm(opiy1lme mfci tfaDrmumpnt0altnif3iadls rlnmp u0arerifcoatlm rlieol()seuo(rpiy4ll n fcs t) rtrxr nu0oexnmoeiys m2rmu pnu4arxnir iydfm raues;(  etrxo nydlp  mfcslsfa2rr(  oo1alx  i3iat m2eln o;t)teenmocoy1oatrluvil() rxrxm3iy1olt lnvs ()artrurooo0oltn o3iytls em(vp (0tltrmf3oo1lmt aies s0texm(m iudop  lfcs ( srrrumpou4teen f3tytfs2eluvp;u0 etrxo3tytopt  ivo;t  rtrxo nu1opte fvsl() 2rrumo;t4ape  feilt aDuanvpn(4 exoxr3oo1lp ean i;s trtm(o oy1lm  micils) Dtaurpot0tptnio3tlsfaDelu o;u4aleriocia1fmDrlnvslt t2toxo3nu1omt mfeiat  2ta(moou0alxn feiaslmDumu o (0tetrmfcootfpDeaues;( sexr(m3no1optnlfes sfsrtmxr nu0apen f3iyt mDelnvp u) etrxf3oatomtr ueslt0trxr(o3ou4aptelfetls) 2ra( p;u1aeen f3tad s2uau o;u)trtrirctatlp   uei;( t2umxm3iy1lmte ieil()aDur(  ;o0openmieias a rl(mo;t)tltnxf3tatfmDe i il(0 rumxmpnodalt  neiat sDraumo;t4tpx mfetldlm elnvon()aeerir3ootla eau i;( truoir iy4ole lnvias) 2raxr no4tptomictlsfsDrl( onu0tltnmo tydlm   i i s)sexr(r iu1llee fetl( sDuaum ;u0altnmiciltlm uln p t0 exnxf ootopteln o;s)srxmio oy4alenmnvil( a2ur(ro;u4texn ieiltfs rmuvs;u0 etrmf3iodfat liei;( setmirpoudope  fvs t) Dtau ono1oet  fetadfs raumpnt)trtnxr3oodfpD lu o s  rxoim oydolte fct ()a2tmump;o1apxnmf3iad a rluvp;u0 reoxoctydfmteluei;t)s2tmim3iu1ameemfetlsfsrrrxr ;u1ale if3tltfm2elu s t)treomo3iydlm r iei t s2urxmpou4ol emfvs s)srurxrooo0ale mf3iydla2elumo;t)tetrio3oytoatraivsl(0s2xr(mpnodapenmfvtlt  rumxmp;o4optniocils a2em( pn()alenir3ty1oa r i o ()seuoxr nu1apee fvs t) rrru oot4tltomfciatfm2eluvo;(0trenxo3oo1oaD aueo (0 etrxmpnu4om e ivtat) Dum(m no1tpeo oetytlm2rl(vs;t4artnxrctydlp eaiei t)trtriopoo1ape lnvta() rumur nt4olt iieiad s ra( s u0 etoxoctadfm  au s ( t2xoxr3io4olenmnviat s2rmxm ;o4alxo feiys m em( o;t4teerif3oy1fp elnes (0 2uoxopiu4al emnci s) rtr(monu0oleomf3iasls el(vs;u)aexrif tadom   i s;()t2xrxmpou4llt  fctl(fa2raurp;o1tle mi3iysls rm(mp u) rerxr oy1fpDe neo s)trum(rpoy4op nmiet ()srur(roou0olxn ociydla el(mpn(4 etoir iotlaDrliesl(0setrirpnu4ll nlfvslsf 2ua(rp;t0tpx mfctasfs eln o u0alxnmo3iodlmDeln s;s)t2um(r3iydlm nmietlt  Dtau  nt4tlenioeiatfa rlu p;(4altrmo totoaD an i ( teuoxm io1apee nci (fsDtaurpnu1tlxoiieiadfsDumuvo u)texoxf oadfatrai slt trto(r3nudaltnmfciatfartmxro;u0tpt  ietasla2rm( snu)arenif3oydlateau s;( seuriopiy1omen ieilsfarum(  ;u0alto feiyt mDul(mo t0arxrir3ootfm   uvols0 eurxmpnodll nliciasf rraxrpoo0alxnmf3iadfs2umu s u4tetrxociodfpDe nvsl() rxo(m io4ap   fcils)a2umu pot0ope mfciadla em( p;u)tltrmf3ia1oaDr ues;(0sruo(r3oydope  iet s aDumxrp;t1tlxnmfeilslmDea(msnt0tltnif oodla   n i t0trum(r iydlle  fvt ( s2umxm nu0apxnmo3tyt s emn p;t) eeomr iodfate nes (  2uoimpiodlp n nes s artax ont1tex  f3iytfa2rauvp;(4alxomocoodlm ranvs;t)s2umir3ou1alte fvs (f rrrx  ;t0aeto i3iydfm umnvs;t4texrmo oa1opDeaiei;s0trxmiopoy1omen ivtltfs2umumo;o1aeeo fetytlm2rl( ont0trenmf totlm e nvi;s0 rxo(mpoy1lpeelies t) Dum(rpnt1tle  fciys sDel(vo t)tetomfciodlm  aieil() rxoio iy1ap  miei s sDrmx  no0alx  o3iatfa2um( p u0 rxniocto1lm elues (0tetr(o3ny1lltnmfvtls aDtrxr ou1apenmi3iad a elnvsn(0 lerio oytoate uvs t s2uoxrpoodale mivt () 2rm( p;o1oet  ociytls rm(mp;t4altoircoatop  aueo;(0teto(m ou4lptnmiesat)a2urxrpou1alxn feilt s2ua(vo ()aexoxfctatlpD  n ilt sexmim iodom n fetat)sDrrxro;o1opt iicilt s rmn p (0artoxfcta1faD an ilt) rumir3iu1olenmnvslt  2rm(ro;t1tpto ociyd sDua(vpnt) rtrir oydopD au s;() 2xoxo nudllt mivi s)s2ta(mpoo0tlxniieiatfa2eln o t0trtnxfcoydlpDraiei;(0 exoxm ou1amen iviasfs2ta(  ;t0tpeomf3tysfsDrluvo () lermo3oadfat  iei;( trtrxm3oodap   nvs t)srtmurono0olxo f3iasla um( o;u4tlenio3oodfpDelues;s setoxo3iy4ol  mivtatfsrtmu  ;t4olx ifctyslsDemu snu4 leoxfctytfmteai ilt)trtr(m3no4alee fvt ( aDtru  nt1aee mietasfa2rm( p t4aeeoifcio1laD ln s;t  2tm(rpnu1lm n neia( sDra(  ;t4opx iietat m rlu snu) eeoir iodlp r iei s)trxrxopou4lp elnvs tfa2tmump;u4teenioeildfa uanmsn()trtrxo oo1fa eaueo s seuo(m iy1lmenlicil(f rum(mono1optoif3ild a2ulnmp t0aleomfcoa1lp e ies;s) 2xr(r3ou1amen feil(fa2raxm nt1openiictydfsDelu o u4 rxnxr iadfmDeluvil(0 2xmxrpoo1lmtn nvi ()a2raum no0aet mieiasfmDelnmpn(4 lxrxr3oydlmtran i t trxmio no1lpenlnvil(farrmumonu0aex ifeiad s2rmnmo;u0trxrmf todlpDeli slt  2xmio iudom emfciat sDurx pnu1opeoiiciytfa emump t)alxoxrcoadfat lnvo s)seuoxr3iu4lp n ietat)aDum(mooo1aptnmi3ildls2ea( snt0 eeoxrcoodfaDr u ils)tetmirpoodole mici s)s2urx o;o1tlen fciytfs2uaumonu0tlxomo ta1oaD  uei;s srtoxm oy4alen ieia(  Dtmurp;u1oeenif3iatlaDeluvp t4tlxnio3todfa   uvo t)tetrir3io4apteliviat sDtrxmpno1apxo fcildfaDulnvp;t) leoxf3oy1laDr neil(  euoxmpiodam  mnvtlt a2ta(rpnu1olxoioctasfaDran p;(4 rtnmfcio1lm  lneo ()setm(mpiydop emfetl( aDuau pnt4texo o3tadlm rlu s;t0altrxf ty1fa raivol(  etm(opno4oltn icsls s2rruro;o4olxniocilt sDuluvon()trtnio3tytfp   ivi t  rum(mpnu4ole  ivsa()sDtax pno0teeomfcildfaDelumont)alenioctytfmDe ies;()texr(r3no1oleelivilt) Dtmxmoou1oleomfeiytfs ea(von(0tetomo ta1fp rli s ( trtoio no4op nlncil( srur(mp;t4texnmi3iydfa2ran s;t)aeenxociy1lmDeln ols) eumio ou1lpe mivtat s2tmxrpot4tlenmf3tlslm2rm(msnt) ltrmo iotfm eaieslt)trtmio3oodamtnlfetls) Dta(rpoo4tleo f3iyd aDra(vs () ltrmocoadop eli i t teurim3iydal elnei ()sDra(r ot0altnmfciltfaDemuvon(0trerxfcia1om e ueo s)setoim3nu1ope lnctatfs2umu poo0aee  oeiyt aDel(mp u0tltnmrctodfpD  n o () 2urxo iudlpt lneil()s2trum nu4tet  ietltla2el(mp;(4 renxo iy1oaDelieils0trxmir iudoptnmneslt)arrr(moot0texnmocildfs umnmo;(0trtnmfcoytlpDrai i;(0s2urxr oo4amt lnctas)a2rmu o;u4alx mfeilsfaDuauvsnt0tetnif oadfpte neilt s2um(mpnodlmtelfvs t  Dtax  nu0olto ieiltfaDul( p;u0 eeoxfciodfaDrauei t0srxm(rpio4am elfvsl()sruaxmpot4oltomfciytla2rluvo;(0 etnmrcoydoaD au i t0s2tr(rpoudoptnlnctat) 2rrx pou1olxo icildls2umumo;(4alxoxr oo1oaDelivi (0trtr(m3io1am   ivs (fs2rmu pnt1alxoifctydlmDrm( pn(0tetoxrcoodlmt ai slt) exr(opnudap nlnet () ruru p;t0oeto feiasfa2ean s;u0texrif iadlpDe ieilt)setr(rpno4al  mfctas)aDtm(rpoo0oleo oetas m2ulnvs;u4 rerio3ty1la   nvo ( tetoio ny4op emfcsls)a2rmx pnt1tlt if3tat s emnmo;() reoxocoa1fat livi t  rur(m iy4lmen ieslt a2rrx ont1tleoio3iytfs2umnvpnt)tlxnxfcty1lm e ueo (0srxmir3oy1ap emnctas) 2tmuroou0apxnifciyslmDrln s;t4tlxrmr to1oaDeanvs (0 rxo(r3nydal nlics s)sDuru pot0optoiictltfs ua(mpnu4 ltrirctodfaDeaivs;t teuoxr ny1al e nes (fsrrm(r oo0aptoioetasfa2rmu on() lenmr oadlmtelivi () ruoio iy1ol e icsasfsrtm( oou1olxniociysfmDemuvsnu4 exrif iodom r neo;s)sexmxm oo1oltemietl(  2ururpoo1tet mo3tytfa rmnmo (0 ltnxrctotlmDrlu s (0 eumxopno1oleemfvsls)sDraumo;u0oexnif3ils m ra( p;u)alermr3ta1oateaiei;t0 rxrxr ou1ap  mivs t) Duaxr ;o1alx  iciasfa elumon() lenio3oy1latrln i;t  eumim nodlle  feilsfaDum(m ;o0tpxomoeiadfsDemumo;(4 etrmo3ootopDraivs s)teurxr iu1opeelnciat  Drmuronu0tlx ioeiydlsDemu pnt)trtomf oy1fpD aiesl()tetm(opnodam e fviat)aDurx  nt4opxnmf3iat m2rl( o u4aetomfciadlp raieo (0srtoxm iy4open ivt t aDtmumono0altnioeiys aDua(vp;() reoxf3tydop r uvs s s2xmimpnu4am  mieiltf 2rm(mont1aee  fcilslmDeluvp;(0alxnmr ootoptraivs s) rtoirpiu1ame  nes sfa2tmurono4oleo feiyd mDea(mpnt0 etoifcoatlpt  n sl(0setrxm iu4olt  ies ()aDtm(m nt4texoif3iytla rm(vp;t4aexoxrcia1fpteaiei (0t2uoxm io4aptnmfvtls a2rmu poo1opxnmicildla2rluvs ()treoif todoate nvils0setm(mpiu1altelivia()srumxmont1tlx  f3tyd m uanmsn(4tlenio3oatfm e ivols0srtoim oy4altn ivi t sDrmu o;t1oltomociysfa rm( pn(4trtrio3oy1faDr i o t s2umxr3iu4lp n fes sfsrtruroot1texn iciadfaDea( snu4trerif3to1omDr n i;s srxmio3no4omtn nei (farum(r oo0oltomi3tldfaDeaums (4areoir3oatom eai ol(0trxr(o oudome mivt s arrr(ront0aetnif3iltfs2rln o;(4areomfctotfp rln o;(  exrxrpou4amenlncia() rrr( oot0alxoiieiys m2ua( snu0texomrciadomt  ivo s  etrxr3no4aleemfet s a2trxmo;u0olx  icildla rlu snt4 etoir oadfmtrlneo s sruo(o3ou1ameelict (f 2umxmono4texnmo3tls m2em(vpn()trxriocoadop e u o;s0t2umio3ny1al n feiltfsDum(m oo1apxnmicilsfmDumuvo (0 lermo tydlpteaivi;(0s2xmxr3io4am n ict t
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;s0seuoim oy4lpt mfvtas)sDurur nu4apx  iciyd a ulums;u4 exnifcoy1lmt li slt t2tm(rpoy1om e nct tf Dumum ;o0teeo o3tlt a umnvpnu0areomfctytlmt  iei;s0 2uo(rpoodaptemiet ()a2umu pnt4tlxnii3tlt mDumuvont4arxoiocoydfaDr u i t  exmio ou4alt  netasf Dtm(mooo1aptn iciydla2elu s;t4tleoxo3iytfpDelivi s0seurir3oy1olt  nvtl() 2ur( oot1aexo o3iatfa2eauvp u0aeerif3oy1optr nvolt trtmimpiy1ap nlnesa() 2rrx o;o0opx  fetys s2eanmo (0 exoxr3ty1opt  u i (  ruoir no1lpt  nvi s) Drm(  no0oexnmoeiadla el( sn(4alxnmociadfpt li s t  2xrirpio4ol nlfet sfsrta( p;t4aexnmfetydlm um(vsn(0tltrir oatlatr u ol() etoimpio1optnlneil(fs2tr(m ;t4apxnmicild a2eln s u)altnmr tydfmDranvs;s0seumxm3nodlptn feil()aDua(mp;u1tpxnmoeiad sDumuvp;(0tlxrif3oodoat lues () 2uoxm3oo4olenmfet t) Dtmx onu1tptn feiyslsDrmuvs u4aeeriociydlaDe ieslt0 2tmxrpiodapenlnvtlt)artmumpot4aee mo3ildfs uauvp (4altrio oodlmtrlnes t  2tmxrpnodal emnesls arrrurono4alxomoeiltlm ea( p u) etoif oytfatrln o;()t2umio3nydalt  ieilt)a2um(m ;t1tlxomietaslmDel( p ()tlxoxo oadlp e i i;s0t2xoxo3iudap  mnct sfa2trump;t1olxn f3iad a ean p;u0artoirciotlpt aivi s)sexoiopiu4ale mivtatfarurxmoou4tee  ocilsls2uluvonu4trtnmr3oy1oatr i sl() 2xo(m3iodoltnlfctas  2raxrpot0optomo3iyslm rauvo u4alerir3io1fmD  ieil() rtm(rpnu1om nlfctlsfaruaxrpno4oeto iciad sDelnvsnt0 etomfcio1fp ran s;t) 2uo(o iu1lmee fviatf Drru o;o0aetnio3ilsfm2emn pn()artoxr ty1oaDranvols srtrim3oy4lpeemici ()aDur(  ;t0optnmf3iasls2uluvp;u)trtnmr oydlmtr ivi s0t2xrio nu4lleemieil()artm(r oo4tle moetltfsDeaump u) lxoxfcta1fm r nvo t) etoxr3iydlpeemnet s)aDuaxrpoo0opxnif3iydfmDeluvsn()tetnmrctodomtelneslt t2tm(rpiu4lm n icias) 2rm(m nu0olxoifciad s elnvs (4treoir3iatfmDeai o s texrxm3oo1ll nlfvsat) Dururpoo0oetn i3iatfs2rmn p;u0 lxoxf iadla rluvi ()s2tr(m3oy1op n nvia(f 2rmurpoo1tee if3ilt a2rm( s;t4 rxoif3ia1laDe ies;( texoxmpnu1optnliesas s2um( oot1tle mieiatlaDua(monu4aexomociydomt  uvolt0srto(m3nudlm elietls)s2tmxmp;o0alx mf3tadlaDemuvp ()tleoir3ta1oaD  i ol(0setmxo3iodlmen fcsas s2umxr nu4aleomi3iydfaDel(monu4 rxnio3oydlmt ai sls)tetoimpnu4llenmieia( s2umumooo0apxnmfciyd sDumumo u4texnxo3todopDraivolt t2urxrpoydlmtnmiesl(fa2taump;t0aleniiciad a2uau ont)alxoxr3ootlpt aueslt)t2umio iydomeelies (  Dum(mont1opt mociatfsDean on(4 lxnxr3oydoptran il(0trtrxm3oo4amt mfctas s2umx o;u0texnii3tlt a2ra( pnt0 rtoxf tytlpteln s ()t2toxrpnudameelneslsf Dururont0aee  oeiatls rmump;t0trtnxf3iodla rauvi t) rum(r oy4aptelnei tf 2rax  nt1aetn fciys s rl(mo;(4aeenir ty1omtrli olt)srxmim3oydll emnetltf rtrxm nu0ape ioetytlsDul(mp;t4trtoif oo1fptrlnes () exoxo nudoltnlfeia()a2trxmoou1tetomfctydlm eanms;t0trenio3iytomtraies;s0tetrirpno4amte fctls  rrru o;u1opx mfciytfsDea(msnu0tetrif oatoa rli ol( t2xoxr3iy1lptn nei t sDtaxr ot1tle mi3iytls2elump;(4 ltrmr3ty1lm   u s;t t2urirpou4am   ncslt arrmum ;o0texnifcildfmDrmnms t4teeoircoa1oa  ai s s0 rtm(m io1ameemfcslt)a2rm( o;o1tpeomfeiyt a uauvonu4 eerxo3iadfmtrluei;t0tetr(mpny1ome mfeslt aDumx p;o1apxo o3tadlm uanms;(0 reoxf iy1op e nes t seto(opiy4olen ncsasf Dtmxr nt1tleoifciysfm eluvs;t0trtrif oo1lptranvi;s  etm(m3iy1am emfvsat  Dta(r ;t0tpxnii3tldla2eanmo (0tlxrmocoy1omDe neo t) rxoxr3ny4apt lfetls)s2umu  nt0opt  ietysfmDemn on(4arenio iy1faDr neo t trumxmpnudopee nesls aDraxm ;o1teenmociasfs2ran o (0tetrmfcootfmtelueo;s  eumiopiu1amenlfvtat  rtmxmp;u0alt  fctyslmDemnvo t0 etoxf oa1laDraivo t0 exmir3oodom  mnct (  rtm(r oo0optnifciydlmDemnmsnt4 eenif tydfm  ai olt0 rxr(opiy1ale lfvias s2tm(r nu0apeoif3iysla eaums ()tlenio3tytopte iei t tetoiopiydale livsls arua(mo;o1optnmieiydlaDrau snu4tlerif oa1laD livi;( srxoim oy1lpt  nvtls aDtru o;o0tptoiicias sDrl(msn(4aleoxf3iytfpDelies;(  2toxmpoydopeelfeias s2trxmpot4opto i3iadfsDeluvs u0alenir totomtraieo (  2xr(o3iu4ll e ict s)s2tmum nu1ale  o3tlsfsDrauvsnt4aeenmr oatlp   uvi;s t2xo(o oudlptnlfctltf rrau pot1opeomieildlsDrm( on(4tltnircto1late u o;s0srtr(rpny4lmeelfeiasf Dtaxm nt1tltn f3tld a ul(vpnu)tlxrxf3oydlm r u i;s0s2xm(r iy4ol n ivil(  2tau ont0tlxomfetatls2el( p u4 eenmf iy1oa   nvo;s t2um(r iy1lle mnct (f rtmx o;o0apenifctas m2umumpnt4 etoif ootlp e u o;s s2umio no4lpt mnvt s)s2rm(moou4tptn octltfmDrauvp t) etomr3totoptr ies;s)sexmio oy1al  lictas s2ur(  no0apt mfetls m2umnvp;t0aetoxo iy1fmtrlies;s0 2um(r iodlme lieilsfsrrau  ;o4tpx  ieias s rmn o;u)alxoio tydlmt  n il(  2xo(m3iy4olee nct sf 2raxmo;t1tex mf3ils a emumonu0 rtnmfcootfmD aneo s0tetmxr ny4lp nliciatfa2rruroou0optnmfciytlmDuauvp u0 exrirctydfm   u i t) 2xrxr nodlptelneta( sDrr(rp;u4tpenioetaslaDrmnvs t)arxrxo3iy1oaDrai o t0texm(m iy1al   icsas)sDrr(mpno0oex  iciltfm2rlu pnt4 rxnif totop rlneolt t2toiopoy4amtnmnvsas) 2tmxmo;t1tpeoifciasfs rlump t) exnmf iy1fmDeai o s sexo(mpoy4omt  fctls  Dra( p;t0tex mo3tlt m2ranmp u4aetrirctadomDrlneo s)srurim io4lpenlfei s  Dum(rpot1aee ifciysfa2rmnmo;(4arerxfcoodfa   i s s seuoirpio1altemiei t) 2tmx oot1opx mf3ias mDelu p;t0 ltrirctytfp   nvo t0 2urxmpnudalt lfvta() 2trxm ou1alxnio3iyt a2el( s t0 eenifciydfpDr ivsls0s2toir3nu1op e fes tf 2rrx p;u4aeenif3iydla2rl(vo;t) lxomr tydla  aneo;t)t2trxr oydlm nmnvil(faDrr(r ou0aptomiciytlm ea(vpnt0 exrircoydfp  ln o (  etrio3no1omeelivil( artax pou4tpxnmfctlslaDulump t4texomf iadfa e uvolt0tetr(opio1lptn nvilt) 2uax pno4oeeoifciat m rmn p;u0arenif3tadlp rauvs t setrxr3oo4lm elieiat)artmumo;o1aetoif3ils sDuanmpnu4 etnxr oodlp rluvslt t2xoxm3nydapt mnvsl(f rrmurp;t4teto ieild s ranmp u4texoif io1laDeaneols0s2uoiopou1ape  neiltf Dtr(  no1apt ioctltfm2rmumsnt)altomf tydlaDeauvols  2um(rpoydlpen fci (  Dumurooo0olxnmiciys a2emu p;t)altomf ootfmt aivo s)srxoxr3iu1optn ici tfsrta( pnt0apenii3tlsfm eln o;u4arxoxr ootlm r nes;t)setrxm3nudlmen ieiat  rtmxmp;o1aeeoif3iltls2raumo t) rtoif ta1fa rauvs t)s2urxr3no4al  mivtat a2umxmpoo1opxo feiaslm2rluvon()tlxnxo3iytfm rauvi (0s2urxmpiudom emnes s)s2urumpoo1tlt  feildlsDea(mo;u0 lxrxf3iydlm   n i s0srurxo io4ap  lnct ( a2umxrp;t1tptoii3tys aDeaump;()tleoxo io1oatean o (0srxo(mpny1omenlfvtasfsrtmx  ou0tpxomi3tadfa ua(vp ()artnxr todfm e nei;t0srumxr3oy4apenlfcils) rrm( pnu1alenif3iyslsDulump u0arxrmr3oodfmtrlieo s) rumio no1olenlici s)artaur ot1optoiiciat s2ul( s ()alxrmr oa1la e ies;t)sruoir3oo4lltelfviat  rra( pnu0ole ioctydfs ean on(0tlxoir iy1om rli i ()srurim iodlpe  ietlt) rum(rpno0oee mf3iadlaDemump;u0tlxrmr3tatfmD aivi;s texm(o nu4ap  lictls)aDur( oou4olx  fctad m2ua(vp t0trxnifcty1fpD  ies t) rxr(o ny4ome lfesasf rrm(r ;t4ale  iciltla rau p t4 renmo3todfm  lues;t sexoxm3iu4ole mfvs t aDtr(mpoo0ope  ieiyt a ul( s (0alerxf oytlpD lies;t srtrio oo4lmee ncsa( aDtrurp;o4teto o3tadls umumonu0areoxocoodlmt lies;t) eto(opnydlptemfviasfaDum(mooo0tex  ocilsfa2emump (0tltoxrcoy1lpt au o;t0 etr(mpiy4op emfci t) Dumx pno0apeo icild s2rmu o;t4 etrxf3iatlmt lu s;t trxoim iy1omte fet (fa2rruroou4aex mfeiltfaDel( s;t)trerxr iadomDran s;(0s2uoxrpoydoleemfvs t)s2ur(roou1apen o3tyd aDum(vsn(4trtrircoy1fp e i sls0texoxm3iudol n fci t) 2urum ;u1aleoif3tytfmDuln p t)altrxfcoo1lm rlueo s  rtrio nu1omte nvils)srua(r ;o0tetoiieilsfs2uanvo;t)trxrmr3ta1faDelnvilt)t2urxo oo1apte fctlt) rtaur no1aex  f3tadfa umnvo;()arerxr3iotfat  nvo t  etoiopiu1lmeemfci ( arta( pno4opt miciyt sDuaumo;t0trtnmfciotlm eluvslt setrio iudop eliviat sDuau  ;o4opx ioeild m2emnvpnt4tleoxo totopDrlnes t0s2xoir3nodomenlivsas srumxr ;o0tetomo3iadls umn pnt0teerxo3ia1opDr nvi;( s2um(rpoodal e ncta(fs2taxrpnt0tpx ioetydfs um(vo;(0aeenio io1oatrliesl()t2um(rpoodlme micsa(fa2umum ot1alt ifctls a2um(mo ()teeomf3iotfa ran slt)sexr(m oodllenmiei t sDtau pnu0olxoifeiyt mDuan p t0trermo iydfa ean s;t)sruo(r3ou4lme  fcia()aDrm(mpoo1tlxomfeilsls2rluvs (0aleoxr to1fp ran o (0 2xrirpno4amt lfei ()aDrau ont0olen octltfsDeanvo;t0 exnmr3ta1opD  nvo t0setoimpny1amee ncslt) 2um(ronu0tpx  iciltfsDelnvp t4 lxnxf iatlpD ai o;(  2xmxr3oodlpeelfcils)a2ur(mo;u0tex ii3ild sDum(vo;t)tlxoir3oodopt an ils)seumir3iodop e ict t)aDtmu oot1tle moeiaslmDumumonu4 rerirciadlmDraivs s) rur(m nydomtemfciat) 2tmxm nu1aeeomf3ilsls2rlnvs t)aexoio tadfmteau sl(0texr(mpny4ol e fvslt)artmxmo;u1apeniicilsfa2rmn snt0altnxo3todfa  livil(  eumir3oo4ol  lnvtas) Dur(moot0alx  fetad s um( snt)aeerxociotla  lu i;t  rum(rpnu1ap  mfvtltfa2tau  nt0tptn ictadfs2rl(mo ()tltrxr3oy1fm   uvsls0t2xm(r nudap emieslsfsrtaxronu4apeoioetys s emumsnt) rtnmociodfat auei;t0 exoio no4alte ncia(farrmxr ;t0texn ieiadfsDel(mp;t0trtrmr3io1fate n o t) etrxm oudal  mfct t s2taxm nt0optnmfciasfaDum(mpn(4tlxoif3oatla elu i;s0 2xrxmpou4lpeelnct t s2rmumono4aeeo octadlmDrln snt4artoif oytlmDr neo s)t2xmio3nu4openmnei s aDtax  nu0tptnmociyslsDrl( snt) reomoctadfpt lu i s0srxr(o3ou1omenlfes sfsDtauro;u1teeo o3tltfsDea(vo;t)tltnxocoydfm ean i;s) 2tr(r3oodlm emfvi tf 2rrxmp;t4olto o3iad a2um(mp u0arerifcta1lm r nvil(0setmxo ny4am nmictas)srrr(r nt0opxnmf3iydfa rm(vp u0 exrxociodopDraues s0srtm(o no1lmt  ictat s2rmxrooo4tlxn oetltfs2rlnvs t) etnif iatoa eaiesls  etmir3ou4lle micia()sDtrx onu1oeeo oetls m2rauvsnu) exnxf oo1opD  i s s)srurio iu4apenmieiatfs2um(mooo0tpeoifciydla2uln on(4 rtrmrcoadoateluvs;t0s2xmxmpio1lmt mnct ( srrrur ;u1oexnio3tlt a emn p;u)artnir iatfmDe ueil()trur(o ny1lp e nvs sfs2raxm nu0aeeniieils sDuau sn(0alermf io1la rauvs;s) exmxr3nudamtnlicsls)aDrrxro;u4tleomociysls el( s t)teeoxo3totlat au sls  2tmxmpoydop e fctat  2ta(rpoo1texoio3iasfs ra(msnu)tleoircoa1fmte nvsl(0srto(rpiy1olenlivia(fsrtm(m oo1oltnioctatfs emu o;u0 leoiociy1latr i i (0t2xrxopnu4apenlivi ( aDumxrono0tlxnii3iad m2rlnmp t0tlxnmf iotfpD  uvs;s0srxm(rpiudap nmict s srumu p;u0opxo i3iat s emu onu0tlenio3to1lpt aieslt  2umimpnu1openmicias)s2tmu ono0tlt iicils mDuluvpnu)aetrmf3oy1op   u ols)srum(rpou4lpenlivs t)aDrr(mont4alx iietyd s2rm(vsnt0tltrir3oy1lptrlneilt)seumxmpnydam   ncil() Dtaurp;u4oltn ociasla2el(vo;(0tlenir to1fpDrau i s s2tr(m3oy4lm e fvilt  2taxrpou0tlt  i3ildfa elnmont)tlxrxo tytopD aneol() 2xrimpiy1lmee fei (fsrum(mp;t1oet  oeiadla ul( o t0 lenxo iydfaDelu i;t0teur(m ny4omtnlfeils  2urx  no4tlt mictys mDea(vp;u4trtnmf3tydlpt  nvilt tetoxopnu4optnmieias)aDrmx onu4apt mfciyd s raumo u0arxoir iytfaDr ueils0s2trxo nu1apenlnct s  rtm(mp;u0tltnmo3iatla2ulnmpnt)arermf ty1opD  n o (0texo(r3nu4oltelicslsf Draxmpno1aex  ietadfa2umnvpnt4arenxr oodlptraivslt0t2toxrpny1al  mieilt srrmurpno0aexn i3tad aDranvo;u0alenmr3ta1la rlneslt  exoxo3oodoptemnvtas s2tr(m nu1altniociysls ulnvo;t4 ltrmo to1laDrlu s;t)sruoio no1ap   fvsl(fa2trur ot1oltn oeiatla2uanmont)arxnif oadfm eaivi (0t2ur(opoudalen ncs () rtm( pnt1oexnifetlt a uln pnu) eerxrcootfaD au o (0teuoir3no4apeemncils)aDtm(ronu4opeomiciltlmDeanvsnu0tetrir3oo1laD ai i s srumxo iydamt  ict t) 2rmuroot1alen oeiad a rmn pnt)arenio3oy1fm eau i () ruoxm3nu1lmenlict sfaDuaur ot0oexoif3iytfsDuauvont)trtrmocta1lm ean o;s srtmxo nodol elneia( s2rr(mono0ope  ieiysfm ulnvo (4trtrmo ia1omD aneo t0tetrxr3nydlmtemici s)arrmurpot4apxniiciasla2el(ms u0teeoir iodomDran s s0 2ur(opoudlltemivt s) rrru  ;u0ole mfctydlaDua(mo (0 lxrif tadlateliesls s2tm(m oodamt mneiat a2tr(rp;t1tleomfciydla2umn o;() exnxo oy1lm  lnei;s) rxoir3io4ope  nvs s) 2raxm ot0apeo ieild mDel(ms u0alxnif3oodfpDrlnvi;s seuoimpoydome mivsl(fs2uaxmo;u0ale ioeiatls2um(mp t0 lermr3totlm rlnei;()trum(m iy4apt  net t srrmxmp;u4aetomfeils a2emu o (4 lxrmfcoodlatelnvs t0t2uoxr3oy4am e feia(fs2rmxmpnt1tpe mf3ils m2em(mp;u)alxoxf3to1fpt auei s0teuoxrpiy1al n icias arrrxrpou1olx mfeiasfm eauvp;t4 lermr3ta1la e ues ( trxo(m3iy1lmt  icil(f 2tmuro;u0tpeo ictlsfa rmu s;t0 etrxo oa1op r nvs s setr(opny4lp  mieia(fs2tmum ;t1aet mociatlmDra(vsnu0aexnif3ta1fm eai s t trto(opoy4amen nct ( s2trumo;o4tlto ieiatfm uanms u4 rxnmociydoa eauvo;t)srtrimpiy4alte ictlsfs2ra(rooo4tle mi3ilsfm rauvp (4arxomf ootom  lieslt)tetm(r3iodal  lfesa(fa2rmurp;t1tex  octyslmDrm(mp (4areomo iodfm rlnvi;()sruoxr3nydaptnmfviat  2ra( o;t4opeo ieiysls ea(vsnt0aetnif tadfpD  nes t) 2tmio nodamenmiviat)arrmxmo;u4texo ociltfa2el(vpnt)tlxoif3iodlmtrlnvi t0 rum(rpio4ll nmieiltfa2rmxroot0alxnif3tydfsDumumsn(4 exrxfcio1lpDe nesl( t2to(m3ou4alt lfes s)s2tmu ont1aexomf3tat mDrl( s t)trxomrctotoa ranvo;t0teuo(rpoodap emnvtl(  Dumxmp;o0tlenmi3iyt mDrmn ont4 reoif3oo1latrau i ( trxrxrpny1llt mfvi s) Duaumpoo4aex mi3tltfmDul(vp u4trtrirciodoa ranesls0s2tm(o no4lpt  icil()s2urxrpnt1tpxnioctasfa2uanmont0altnxo3oatfmD  nei t0srtoxm3oydaptelivtls)a2trurp;t0alt mi3iytfaDua( p;t0trxnxo3oadfaDr ivo;s) 2xmxm3ou4llt mnvt (fsDrmx pot0aptomietys s2eanmo;u) ltnio iydlm raivsls0 ruoxo3iy4ol  mfeilt)s2rmxro;o0opeo ieilt a2el(monu4aeerircta1oa eanes () exoim3iodamt mnvi sfarrr(  ;t4alxniictytlsDelnmonu) ltoxo3oodfa   nes t0teumxmpiy1optn netatfa2trxmont0ape iietad sDem(mo;(0tlenmf tydfaD auei;t)s2umxm3iudlp nlnet t)a2uaxrpou4aptnifcildls2rauvpnu0artoio to1oat  nvs t0tetr(m3ny1lpeemnvtatfsrum(m oo4ole mf3iyd a2rmumont0alenir iadlmtr u i (0s2xr(m oo4ap  lncilsfs2umxronu4olxnifcilsfm rl(mpnu0 etrxr3ta1fp r uvs s)s2xoimpio4oleelicilt aDraxm nt0olxnmo3ias sDua(ms t4tetnif3todoaD lu s () 2xo(m3nodlle mfetatf 2rmu p;u4aeeo ociat m em(mpnu4 lenxo3to1fmD  nvilt0srtoir io1llte fviatfsDumumpoo0texniociaslm2emnmpnt) reomocoytopt lnvslt s2to(r nydomee ict tfa2rr(r ot4apxnioctysls2rlu on(4aetoirciatomD livo;()trto(mpio4omenmieiat aDtm(rp;t0tlxoif3ilt a eluvpnt4tlxoxrcty1opD anesl()trxoir3oydlptn fvsat srtaumoou4tet miciltla2uan p u4artnmo oo1faDr n i;t sexmxmpnu1lmt lncsa()aDumx pou4apx iociltls2em(mp u0 eerxf3iadfmDrlneolt  etmir3iy4om nlies ( aDur(rp;t0apxomicilt m rl(vs u)alenmrciotomt auvol() rtr(o iy1llt mfciat s2tmur nu0alx mf3ilt m rm( pnu0 etnxf3iodlaD lnvs;(0teum(mpiu1am nmies s)aDrr(mono0oltnmocildfa2rmn o t)trtriocta1la  lneols)sexoiopoodameemfvi ( s2rau p;o4tltomictltlm ra(mo;(0artnmf oatoateluvo s)teurxrpoydll nlfvtls)sDrau pnu0tet  oeils m2ua(vonu4trtnir3iadomDeluvo ( trxrim3io4oltnlfcsl(fsrrrxmpot1teeomicilsls ulnms;t)artnif3iydlaDraneslt t2triopno4llenmicsas)aDtaurono1ole  ictlsla2elnvsn(4texoxocoodop  anes t)t2trxm io1lm nmneiat  2rru oou0opx  octytfmDuauvsn(0texnxfcoadfmt  ivi;t)s2toxopny1lp n fct tfa2rax p;o1tpto oeils sDea( p t4tlxrmrcoytfatrli o;s0texrim ny1lp  mivs sfs2umu p;t4aetoifctadls rm( o;u)artomo3iy1oa elneols)t2xrxr oo4lmtnmict s)srtmxr ot0oet if3iysfaDumuvo t0 rerxr ta1oa e i i;t)seumirpou1lmeemivil(farumuroot4apt mietasla2um( pnt)arerxf oo1lat  ies;()t2ur(r3ny4ap nmfetl( srur( poo4aet  i3iat m2emnvo u0 ltnxo ta1fmtrau ol(0t2umxrpiu1olte ics ( s2rmx poo0ape ioetyd a2ua(mo;() exnxf3ia1omt  iei;()texoxm iodamtnmfciltfsDtrumonu1olx  iciasla em(vo;(0 etoxf iatlm e nvo s tetrxm iu4lp n ivtat)sDurx  oo1olxomi3iatfs2raumpnu4 renmo3iydlmt  u s (  rum(r3ny4llen nes (fa2ta(ro;o4tpx  i3tasfm em( s;(4tltoir iatlp   u sls)teumxr iu1llenmfetat)aruau poo0alxomo3iasfsDranvp t4aetnmfciy1fa rln s (  2trirpny1olee fvils a2rmuront0olxnmoctadfs2el(vs;t4aeerif3tadlat  u i s) rxoxr nu4amt lnes tfsDtaurp;t1olenmi3ilsfs2rm(vp;t4trtnio3iy1fpD ai ols0srurirpiu4lpe lnei s)aDtrxro;u4aleoiieiasls rm(ms;(4tetrmr oo1oatelneo;()tetoxrpnudlpe  fvslsfsrtmump;u1tpt  o3tytfm rmuvp;u)teenmf todfmte uvs;()tetrim no1ll eliei ()a2rmx  ot0opxn fciad s rmnmsnt4tleoifcoadlp e u il( s2umxo3ou1lm nliet tfartr(mp;u0altoioeiat mDeanvpn()tetomr3tatfmDrauvi ()s2urxopoy4ale mfct () 2rmx oou1tlt mfciatls ranvp t4arxrmf3oatfpt ln i t)srtm(r3oodlleemivilsfsrrm(r nu0apxn i3iysfs2rau s;t4 rxnmo tadfptelues;( setmxrpnodoltnmfvsls  2raxmp;u0oee mfetadfaDrl(vo u) rxrio totlmtrlivil( setmio3nu1lme  ictlt srrm( p;t0aee  o3ilsfa eanmo u4teerir3oadfateai s t0 etmxo iudaltn fct t)sDurur ;o0tltnmocias m2em(msn(4aexrmr to1fatrluvs;( sruoxr3ny1ap  mictl( sDtrum no0apx iictadlmDrmnms;(4alxrxf oo1fa elnvs;(0 exmxmpiy4ap n icsls)s2rax ono1apx iietas a uauvp (0tlerxo oodomDr ivo s0 etoxo iu1ape lfcia( srrrum nu4olx  f3tlslm uanvs ()tetoir oodopt li i t0teuoirpny1omtn fviat) 2trx pnu0opxoifeiyt s2eanmp;u0 etoxrcoytlptrlnes;s0texoxo oudol e iesa(fsDrrurpnu4oeeo f3iat m uauvp u4texrmr ootlmDeaneil(0srtmxm3nydol  lfvs tf rtmxro;o0tlen o3ild aDel(vo;t4 lerifciadoa eanesls srtmir3nudome lnes () Dtmxrpoo0opt  f3iltlsDea(mp u0aetoxo3to1oaDrluvi (0t2xmir oodll n netls  2tmx oot0olx moctatlsDuanvont0 rxrio3ia1lat au ilt)sruo(o oo1lp  lictat) 2urxrooo0oeen f3iad mDean s;(0alxomo3iydlpDrluvolt s2uoio3nodoleemnvsls  Draxmooo1ole if3ildlm eln pnu)aexoio tadoaDelivols  rtr(mpno4oleemnvs t  2urum ;u1alt io3iysls rlnvs t0 leoio oydfmtr uvo s  2um(r3iydap elfeiltfaDrm(rono4ole mfeiytfs2ea(mont0 exomr io1omt anes s0teur(opoy1lltn ncil()aDuaxro;o0opx iietatls rm(vs;t0aexrxf3tytlpD liesl() 2um(m3nudopeelietasfartrx o;o1olxn i3tatlaDrm( s;(0artoif tytlpDr nvolt0t2trir oudape  fvsat) Drr(m ;o1tpxnmfctltfs2ra(mo;u4tetnmo iytopteaivs;s seuoxo3ou4ape liviatfaDurxmp;o1tpenmoctydfa2um( snu4 eeoiocta1oaD aueilt s2urio oo1lmen neiltfsrrmx o;u4apx mo3iytls rm( o;(0trxomociodopte ivi (  2xoimpnu4olenlnvsl(f Dtrxr ;u4texoif3iydla2rlnmo;u)arxnio3oatfateauvo;(0 rur(r iu1aptelfctas srumur ;u1tpx ioeias a2rmuvonu0 rxnmfciydlaD  ies;(0srtm(rpoo1apenlies ( a2tax p;u0tpx iiciytls rm(ms (4texomo3ta1fmtr nei s texmxr oydopenmivia(fsDurxrpnt4alxo oeilsfaDrau p;u0alenxfctydfpD  i s ( trxo(r nydllenliei t  2tau pou0oeeoioctytfm2uau o ()alxoxr ootomDeau i;t)t2xrxo3ou1oltn icsl( aDtau  ou0alx moeils a em(mpn()aexoir ia1lp e i i s0t2xrxo iodaptemfvilsfa2ra( pou4apt ii3iydls umuvsn(4arenxfcoo1fa eanvs ( s2tmir oy4apt mnvi sfartm(  nu1apx ifeildfmDel(vs (4 leoir3oadoptr uesls0srxmxm3nydol nlncs t  rrmur no1aleomo3tldfs2rmuvpnu0alenir3oa1omt lnei t) rumxopou4lm   nvi ()srtrxmonu0tlxnmociytlaDulu pn(4tlerxr oy1fmte u i (  rxo(rpno4am emivsl(f rumur no1apeoifciyslaDuanms;(4aetrmr3todoptraueilt texr(r iudap emietl() 2rm(  nt1olx  i3iasfs2rlu s u0 rermr3oydlpD anvi s  ruoir3iy1ol emnci sfsrtrumont1olxnmfctatfsDem(vo (0trtomr3iotfa raues ( s2tmxr3nydom nlfes tfsDum(rpot0oeenif3iltlaDumn p;()treoio io1fm raneo t0srum(r nudamenlici () 2urxmo;o4oeenmf3taslaDem( s;t4altomr ty1oaD auvi s0 rxo(m iodalen fciatfsDurur ;o1tlxn octasfa umums u4aeermr3oytfaDrlivs;s trto(mpnodalte nci (fsrrmxrpnt1tpt  ieilsfm2umn p t4texrirctodomDelu olt0 ruo(o io4ap  mnesl() 2tmumo;t1olenmoetat m2emump t0 rtnxo3ty1faDelneil(0 2urxrpoy4al emncta(faDuru  oo1oex iieiltlaDumnmp (0 exomfcoo1lp rlnei;( s2tmxopiudomtn nvt tf Draxmoou1olxnii3iltlmDran p;() rtrmr3oadlpD anesls)trtr(rpno4lpt micsl(fs2umxrp;o0tee io3ildfa rmumonu)alenio io1laDeln sls trxo(rpoydllen nes ()s2rr(r no0opto oeiat sDelumo u) lxnxf oo1omtranei;s0 exm(mpiy4lmt  feslt)sDra( pnu1teen oeiltlm2ulnmo;u0treoiociy1omDrlu o (0s2xmio io4am nmicia(fa2trx o;t0tlxomoeilt s ua( snu0aexnxo3iodfpD lneo (0t2trim oodopt  nvs ( arta(  no0oleoii3ildlmDul(monu0 leoxociatfatr u s s)sexoxo3iodal nlieta()s2ra(  no4alx  f3tasfaDem( s t) exoio ta1fmteai il( texmio3iydale lfvt sfsrtaxr ;t1ale  ieiadlaDulu snu0 eerxrciydomDrluei s seto(m oy4omt mnvslt)aDuaump;u4olxo o3iad sDuluvpnt0arxomocoa1faD liei (0t2uo(rpiy1lmenlfvt ( sDtm(mo;o1alt iictls a rl(vo;u4tlerxr tytoatr ueo ( trurxr iu1lpee feiltf 2trxmpot0alxomoeiydlm rmu p u0alerxo iydfm raneslt  rxoir nu1apeemivia() 2rruro;o0aptoio3iydfs2ulu snu0texrmr3iatfmtrlu s t)setr(opou1olenmncta( sDurx  ou4tet  i3tldls rl( s (0tlerxrctatla   iesl(0s2uoiopny1op e nct s s2urxm ot4alt ifeiysla2uan p;t)altnir3iodomDe nei;( sexoxmpnydlp  lfvils  rtm(mpou0tltn ieils a elump;(4 rtnmf oytlmDeln i s)truo(o3oo4om n ies sf Drrxm ot0altnmieilsfs ea(vsnu)aexrio ta1lpD aueol(0 2tmirpiy1am  livilt)aDumump;o0aexo oeias m2rl( p t)trxoir3tydlpD lnvo s) 2ur(opio1lle lnesl(f 2tr(moot4opxnif3ias a eauvpn()aetnir3oytoatelu sl( srxrxm nu4lptnlncsl(fs2urxmono0tlto fctyt aDea( pnt4 etnxo3oatfp r nvs;( s2tm(r iu1opeelfvia(f rtax  nt4aet  ociyt m uanvsnt0 ltnxfctodlmD  i s;t)t2xmxopoo4oltnmfctlt  Draxro;o0tlt  fctlsfm2eauvs u0 exrif3to1oa rlnes ()s2xo(o iydom elnvsas)aDurx p;u1aexnmfcilt s2rl(mp;t0alxoif oydfptr ieo;t)seuo(rpiudamte neta()s2urxmooo0ape ifeilsfmDrln o;()tltrmociotfaD  nvs;s0setr(opnu1lle mivt s  Duaxmo;t4tlenio3tldla el( p (4 lerir3oytoateanvs s srtmxopiu4llt  iesl()s2rru ono0oexo octltfs ra(vsnu)alenmo3oy1fat  uvs;()srtrirpou1lm e ici tfaDrau  ot0tpxo f3iatfsDelnvp;u4tlermo3ta1fpt  i ols0t2tr(opno4llen fcsls sDtrxm ou4aet mo3tltfa ean p t0arenxr3iydlat liesls0 rxoio no1alt  ivtls)aDrm(mp;t1oet  feilsfm2rmump t0texnmrcta1lmt  nei ()srtrimpny4omte ies (faDtmumonu1olenmoetyt a2um(vp (4alerircta1lp r nei;s0 etoxr no4omen netat)a2uru pnt1aptniictys a rm(mp t) ltomf ty1laDranvol(0t2xo(m3oudomeemivta()arrrurpno4tpe ifciytla2um(mp (4alxnir3iydla elivs (0s2urxm no1omeemivsl( s2uau poo1tlxniociatlm ra(vs;(0trenxf oydfp e u i (0srtmim iydolt  nvi t)sruax  ou4alt  fctasfs eau pnu) exnmo todlm r neo s)s2um(r3nydlltn icsatfs2tmxrp;u4aex io3tldls2eluvpnt0 exnif3tatlmD  nvil(0s2tmxr oodam nlnvi s) rtr(ro;o4tpxo ociytlm rauvsnu) etoifciydom rluvo s)srxrxm3ny4al emfvsl(fs2rrurp;o1opx  ieilsls ea(mo ()trxomrcoa1lpDe ueils0sexo(m nu1alte nci sf rurx pnt1opt iietls s el(vs;t4 renio3iadlmtrau i;s  exrxopiy4omtemfciat)sDtmurpoo0oeenmiciadls2eanvont0 eenmr3iytlm elu ils)teumxo nydamtelfesasfsDtr( pno0aetnmoetasla rlu o u0aleniocoytfm ranvil()sexm(o iu1omenmfctls  2rmxrooo0apen ictld a uluvon(4 leoioctydfp  ai ol(0s2tmio ny1om eliesls) Dtr(mpnu1tpen oeiysfsDum(vs;u0alxrmf3tytlmDranvs;s)seumio oo1altn net (  2ua(mo;o4opx ifeiytfs2ul(vo u4texoir iy1lm elu o;t0srtrim3oo4llt  fvi s aDrauronu0oleo fetys aDum(mo t0trenio iotla   ivs;( s2xmimpiydoleemfcsatfs2tr(ro;t4tpeomfetydfa2elumo;u0aeeomrcoydlm e i s;(0 ruoxo ny1lptnmieiat)s2rauro;o1tet mi3tasla uluvp (0artnir oodlmDeaueo;s srtrim iudlle lfvsa( arumum ou1ope iietad m2emnmpn(0trxnmrcto1lmt auvils  eur(r3ny4omt  iesltfsrurxr nu4optn fctls m2emnmon(4aleoirciytfmtranvs s)t2tr(o oo1lmtnlfet s) rtrxro;u1aptoioeils a uanvp u)alxrmo iadlm   uvsl(  rxo(o3oudlmtnmfeilsf 2ta(moou0tlx ii3ils s ra(mo u4tltnmociy1laD luvs;s) etoir oo1amee fesas srtrurpoo0aeenio3tatls2ua(mp;(0 leoxo oydfpDe i ols0sexmxmpoo4amee icia() Duru  ot0apxo iciasfm2el(vp () eenifcootfptraiei;s)s2tr(m oy4aleemneias)a2urxronu0teto oetatlsDuauvs;u)alerio iydfpteanvols)teum(mpoy1apee fci s aDtax p;o4alenmocilt s el( s;t0trtrxfctytlaD lnvi s0 2xmio3iy4om   ieia(  Drmx p;u1oetnif3iltfm2eln pnu0aetnmociodlmDeluvo s0 2xoiopoo1ll elnvt s)a2umum ou4oet mi3iysls ranmpnu4 rxnmr3oydopDraivi (0sruo(opoydop e fcs t s2ua( p;u4oexnmocildfmDelu p;t) rerio3iy1lmtr nei () etr(m ou1lmtemivilt)aDrmumpoo1apxn ociysls rmnmp;t4tlxoxf iytlaDr neil(0s2tmxr nu4ol emfesa()a2uaumo;t0apenif3ias aDemnvs;u)teeoxo3todfa eluei t0s2urxrpio1amtn ivtlt)srrrump;o0ole mf3ildlaDum(msn(4 rtoxr iodomteau s;t0 ruo(rpnudam  lnetas)aDtmxront4tpe moetasla2uaumsnt) exrirciatlmtelnvo;(0t2urir3iydol  mnesls)artmumonu1tlt  feiydfaDul(ms;t0 rerxf3iadfaDelnvs;t sexrxrpnu4lltnmnesl()a2um(mp;o1oeeoif3iadla2rm( o u0texrxo3oy1fp   ueolt teuoxo3iy4omt  neil(  Dta(mo;t0tle  f3ilslmDrl( pn(0 ltrxf oo1op eln sls0srumxr io4lm e fvs t)srtrxm ou1apx micilsfa rauvsnt0alxomoctodlaDeluvo;t  2xrirpno1ol nmiesat) 2tr(mpot4tetniictatfs2emumsnu)teeomocoytla  aneo;(  rxrxopnu4ape  fvtatfarra(moou4oet ii3tasfsDuauvs (4aetnmf oy1lpt  ueslt seto(o3iu4lp nmnesls a2ur(m ot0ale iieilslsDemnmo;t0 rtrif tatop  livi (0 2ur(mpny4omen fcilt) Dtr( onu4altomo3iatfs rlu p;u0artoxo iatlmDeauvsl(0teuoirpoydole mfctlt aDrrum ;u1oetoifeiasla2uln pn(4 rxnio tydoaD  ueils srtr(o oydol nmnei sf Drr( pnu0apxn i3iadfm2ra( p t4artnifcio1laD  uesls) exm(opny4am emfeils aDuaxm oo0alxniociydfaDemums;u) eenxf ty1laD  ueolt t2ur(rpio4llt  nviat)a2rmurp;t1apxoii3iyd aDuaums u4aexnxf totfm  anvols0t2xr(mpio4lpee ict (  Draxro;u4oltomi3tydfm em( o;(4 ltoircoydlm r ivo;t trxo(o3iodol emieia(fsDtrxm nt1tee ifeils s rm(ms u4aexoirciotfpDr n slt)t2xmio3ou4omtnlivi t)srur( pot0olt  ietyd m umnms;u)tetrio oo1oatrai ils0 2xm(rpio4lmenmicilt aDrru ont1oeto ociys a ra( on()tetnxf3iadlm ran il(0 etoim3oydale mict sfa2rmu ooo4oet ifciydfa2umuvs ()alxoif iytfm e u sl(0t2xr(mpno4optn nvs t s2umu poo4opt mfetyd m uau s;u4tetoxo iodop rlnvol( s2xrio oudom emivslt) rtrurpou1tetoif3tydfaDum(vpn(4alxnxo3io1omt aieil(0sexrio oo4lpt lies ( srrm( o;u1aeenifctltlsDuanmo u)aexrmo tydfmtrli i;s  rurxopiydll emncsat) 2taxr nu1tlxomieildfaDrmuvo;()trxnmrctydomt aueols seuo(r3io1lpeeliciat) Dumx ono0aet mictaslmDra(mon(0trxnmfcootomteaivs t s2umir3oo4om nliviltf rtrurpou1altomo3iad s rluvpnt0tltoxr3tydlpD lneo (0srxo(o3nu1ole lnct tfa2trum no4aetn o3iasfm2rmu o u)texrmf3ia1la eluvi t) exoxrpou4oltemnvs t aDrr( p;t1tltnmfetydfsDraump t4tltrmrcty1lp eanvol() 2xrim3io1op e fvsa( a2umum ot0tlx ii3iydlsDrlumon(0 etoxr iy1fp r i s;s s2xmio3oy4opt mfcs t)a2tr( oot1tptn fciasla2elums (4 reomfctydlatelu o ( trtmxm iudop n nes t) 2rmxrp;u0aptn f3iyt s2rmuvo u4aetoxfcoo1fmtrluvs;( s2um(o oy1lpe  ivt t  2tax ont4oexomoetasla2el(mo;u0trtrxfciydlpDeaieo s)s2triopiy4lpe lfvtlt  ruaumooo1aetomf3iatls rlu o ()trtrxf ta1faD auvs t0srtoxm3oydam nlfvs ()aDum( onu4aetnifciltfs2eanmp (0 ltnio3ootfmtean s t) 2umir3oodamtemfcsa( srtmumonu0olenmoctlt aDra( p;u) lenifcta1lp rlu s s trto(r3oo1lpe lnvsa(fs2rr(  ;t4oee mfciatfa2umnms;t)altoxo iytlpDeluvs s)t2um(r3oo1lpte feiat a2raumo;o1aetnmociysfm2rluvo;u4tlermr todla ranvi;s s2xr(rpiodapt lfctltfsrua( o;o1oltoiictytla2el(mo;u4teerirciytfpDraneol()tetrim ny1lpeelfesl()srurumont4aptomictys sDrmuvo (4tlxrirciydlmteaieil( s2xr(mpiy4llte iei s)aDtax p;u4texomfctasfa rlnms;(4arenmfciytlpDeaieo (0srtoio3io1lmenmnciat sDtrumo;t4olxomfctadfs el(mp u4alxnmr to1om   uvo;t texrxopiudap nmnctatf ruau  nu4texnifeiys m2em( o u4alerif3oydlmte nes t0 eum(r nu1al n neslsf Dtmur ot1opeoifetytlaDrln on(4 etnmo ootlpDe nes t t2urir iu4ol elicsltfs2rau  ot1apxo o3tasls umu p t)artrif iotlpDelivo (  2xmim3no1opt mnvi ()a2uru o;t1openmictydls rlumsnu4tlenxfctatfp eaieo s  rumxopoy1om  mnesas)srur(root1tle mfctlt aDumuvsn(4texnio tadlptrai s s0srtm(r ou4al elnvsl(fsDua( pnt1apenmiciyslm2ua(ms;t4 exrxf todfat lues s t2tm(r no1lmeemivsa(f Dumxrp;t4tpx mf3tas a2rlu pn()areoif tadlaD ai i;s0trtrxm iu1ol emfvsa( srumxmp;o0texnmo3taslm uluvp;u0arxrif iydlaDr i olt)t2xmio3oo4llenmfcs s) Dtaxmo;o4oltoifciysfa2emn s;t4teeomoctytlaDe ieils)t2tm(m nu4lpee nvs () 2tr(m nu0olt mfeias aDrm(mo t4 lxrmr3io1lmD lnei;(0 exr(mpny1ole miciat s2umum ;u4tee mf3tydfsDrmums u0arenir oy1omte n il( srtmimpnydolt  icslsf Duaxr nt1oexnmf3iytfa2ulu onu4arenxocta1opDrluei;t  etrxopiydop elncs s sDrrurp;o0tex moeiyslaDuaums t4aeenxrctodlpDr n s t0srxoxmpoodom  lnei t)a2ua(rpou1optomietydfm2ulu sn()altomo3oytoate ueslt0setmimpoy1lle mieiat s2urxr ;o1tlenmieiatla2eauvo;t)aeeomr3iadfmteau i (0s2toxr3ou4ome  ncils arua(mpot0alxoioeiytla2rm(vs u4 etniociytfmDeluvols0teuoimpoo1om n nciatfaDrr(r ;t1tpx  ieiysfmDrln pn(4texnirciydlmtraivo t  2to(opou4lmt micta() rtax  nt0tpx mo3iydlsDea( p t4alermr3io1fatrluvsls)s2to(r3iudlmeelivtl( srururpnt0aptniociad aDrmnvon() rxnmo3iadlmDrauvi s) ruoir3iudlpeemfcsl(fa2tmxroot1tlt  ieilsfmDranmp u)altnmfciydoa elieilt)sexm(r3ny4llt lnvsatfaDtaxrpno1oeeoiociytfs2uaumonu)trxnmo3iytop elnesl()s2xm(m no1lmtemfvsa() 2um(rpot0apxo i3iatfaDulnvo u4alxoxr tatfp ran o;( s2umimpno4ap n ieias sruaumont0apt ifciasfs ra(vp t4aexomr iy1lmDranei s t2xoio iu4ope mfviat)sDtru p;o0tet iietasfa2em(mont4tltrxr3iodopDe uvs s0trxmxopny1ape lfcsl( sDra(r oo1aexoiocias a eaumonu4arxomfcio1fpt aivs;s  2to(r no4al n ncia(fsDrau ooo4oeenifciysfm emu s u4 ltoxf oa1fmDrluvo (  rur(m oy1ameemieilt) Durumpou1alto i3ildfm2rauvp (0 leoxocio1oaD  uvi t  2toirpiudol n nvta( arrru  nu1texnmi3tytfm2emu p;t4arenxoctatfmt lu i ()trtmxmpnodll   feil()srrruro;o4alxn oeiyd s emnvsn(0tltnxrcootfmtrliesl()sexoxr3no4lleemivta(  rraurpot0aetnifciydfm uluvp t0 renmf tytlp rlivo;t0t2tmim3iodalenmnetlt)srtaum ;t0alxo fcils m2uau s (4alerxf3tydfaDeaiei;t) rtmxrpoy4lpe lfvtls arta(  ot4olxnio3tasls elnmp t0aetrmo3tadoate iei;t)t2xrxo3nu1lptelncilt  rumxr ;o4aetnmictad mDuau on(4tlxnxfctodla e i i ()seto(m3oo1amen nesat  2tmuroou4alx iiciytfmDem(mo;t) rtnifcto1omD  nvil()sexoxr ny1lpenlnes tfsrtr(monu4openifetyd m2elumo ()aleoifciy1lpt  ies;t)t2trxm3iydomtemiciat) Durx poo1oetnioetasfmDel(von(0alxomo3io1lmDeanes () exm(r iu4lpee icils)s2ua(r oo4alxn i3tldfa ulumsnt)texomo3to1laD aieilt s2tr(opou4lm emicslt  Durumont1apenmieilslm2rlnmo (4tleoxrcoytlp  aues;s0sexrxopou4am emfcsasfsrrmum nu1aex mi3iyt a2emuvont0 leoif ty1lpD  nei;t0t2uoir no4ll emnciltfs2ra( p;o4alx  f3tlslsDrl( o t4 lxoxr ta1lp  aivi;(0srtr(rpiodopte fvtltfaDurum ot1apxn f3tasla eluvp t4 etoio ootfmD aieo s) rto(o3iy1al emietls)a2rru p;o1oee io3iydlsDrluvsnt0texnifciotoat  u sl()seuoim ny4alenlncs (fsrtrxm ot4oetn i3iatla uln s;t4trtoxf iatoa  lnesls0 rtmxm no4om eliesa(faDtru poo1oee moeilslmDea(vs;u) etrmocoydfpt  u o;s  exmxm3nydaptnlieias)s2urxrpnt0tltnmf3ildlm2rl(vsnu)trxrir ta1lp r n o s) 2xoir nodoptemici tfs2ta( o;u4tet mfetyt sDumnvp u) reomo3ootfptrlneils)t2xoxrpoudlmte fesat s2trur ;t1tlx  iciydfaDulnmp;() etnif iodlm   uei t0truoiopiydlpeelfvtas)sDrmur ;o0tleo f3tls mDrmnvonu)aeerxrcoodomteli s;( srxoim oy4om elfeslsfaDtru pno1oee moeiasfm2uauvo u4aetrmocoy1fat lu s;s)texmim no1al elfctls sDra(moou1oltn o3iadfa2ul(vo t4 etoxo3oa1fp eai s;t  etr(r3iodomenlfetl(  2uaxmont1tptn f3ildfa2uanvs t) renio oatlpD auvils0s2xrxm no1lm nlici ( sDur(rpou0tex  f3ilsfm2elnmp ()aexrxo3tytop rlieo s  rtrxmpiydol nlfvi sfa2tmu  oo0aex mfciyt aDra(ms t4tlxoio3ty1opDrln o s)t2urim3oodaltelncs t) 2rrxrpoo1teto o3iysfmDra(vs t)trtrxoctadlmt lu s;()s2uriopoudomtn fesl(fsDrax poo0olx mfeiys a2ua( p;u0altomrcoydfaDr i sls) rur(mpou1lpt miei ()a2urxro;t1oexniictyt s2rmnmo;(4tltoir3ia1omDrluvi;(  2to(m3oo4lptnmfeslsfsDtr(r ;u1tex mfciltla2rl(ms t0alenxf3iydlmt  i i t0 2urxo3iu4lmt mnetlt) Dtm(rpot1oleo fctlsfs rmu p;t4 etnifctadfaD au i s s2urio3oo1amenmncta()srrau  no4opto o3iatla umu s (0trxomoctydlmD au o;s  2xmir nudap  livtat)aDraxrpno4aex mietls m ea( s;u)trenmf3iydomD liei ( srxr(opnydaptelici t) rrruroot1tlt  oeilsfaDumn p t0 rerxrciytom elneol(0 rurxrpoodomee ivt sfsrtau o;o0tpxn oeildls2ra(vp u0artoxf3ta1lmt  n olt0s2xmio io4ap   neiatf 2urxrp;t1teeniiciytfm2ulumo;t0 renxr3oytla  anvi t) rtrxr3iu1lpee feil(f Dua(roou4alxomfciadla2ulumo;(4 etomf ootopDr nvi s0 2toxm3oo1apte netltfarur(rp;t4opxo ietaslm rl( o;(4trtrxrcootlptelieolt)s2um(r3iydalee fvi t)srtr(rpot4olen oeiadls2uanms;t)tetoxr tytfp   n il(  rxriopoy1lm nlivs ( arurx ono1oexnmieiyslm rau o;(0tltnmo3tytfatrai i;(  exm(o3oudome  nctl( arurxronu4alenmfcild s uluvs u)artoxo iydlpDe ies s0t2urxo ny1altnlfvtat  rtau pno1aetnifeiatlsDem(vo;t0 exoirctytlaDe i il()tetmiopiu4olteliesat)a2tr( ont1aetniociytfm eanmo t0teerxocoy1oatraneo (0 2urxm3iydolt  nei ()aruax  nu4oexo ieiysls2rln pn(0 exomf3oytfm eln o s0 2xrxr3ou4omtnlfvi s arrrxrpot4aet iicils aDelu s;u4 lxomf3iatom  anvil(0seuo(m iy1ll nlfcsl() rta(mpot4altnmiciasfs2rln s (4teenxoctydlaD  u olt0trtmxopoudolte fvt t) 2tm(rp;t0tpx iocias mDul( o u4texnmf iadlpDrlivi;s  2ur(rpiydlpenmnes sf Dtrx  ot0alxnmociltlm2rmuvont4aexrmociytoaDrlues;()sruo(r iydlmtelfcslt srum(rpnu0oleo feiys aDranmp;u)tleoxfcio1omt  n o;() euoimpnu4lmtelfvs ( sDuaum ou4oex  oeiytla2um( s (0 exoxr iy1latr ivsls)t2uoxmpnu4aptelnvtl( aDtm(moou4tlt ii3iatfm2ra(vp u4teeriocia1lm e nvo;t0trtoxmpnu4ap n ieia(  ruau  oo0tlxoioctltfa rl(vont0teenir oo1la r u i;t0 exmxmpnodape micsa()aDrrxm oo4teeo i3iatfa ulu o u4texrmf tadfpt  ies s0sexrim nu4ll nlnct s srrrumoou0aeto feiad m2elump;u0 lxnmf ta1lmtrlneo;()trxo(r3io4ope lfesas a2rm(r ot0tlxnifciadfa2eln pn() lerxrctadopD ln ols  2toim iu4opt lnes t)arumu  nt1olt moetys s um(vo u)arxrxo iydfp eli i;t0s2xmirpiodlmeemnvi (fsDuaxmpno0olt iiciasla2ulu p (4areoif3iatoa  auvs s0seuoiopny4am   ies s)a2trumpnu0teeomieiyt m rl(msnu0texnmo3todlpDeluvi;(0 2urir iydlmt  ivsasf Draumpou0texnmf3iltls ranmp u) eenirciatoa  anvi ( srxrxm3iu1ame lnetas)srrrx  ;u4olenif3tydlaDrlumon()altrmo oa1oa  auvo t srtrirpoudlme lfvtlsfartrxmpou4olxnmieilsls2el(ms;u4tetoxr3ty1fm  aues;t tetmir iu1ale lnet tf rtr(  ;t4apxo i3tlsls2eanvs;u)tltrmo3oytfaDean olt0srxr(r3oodlltemnetlt)s2ur(m ot4tleomf3ildfaDemuvp;() lxoir3oytlpDe u ilt0 rxo(o3ou4lptelnvs s  Draumooo1apxnmfctadfaDum(msnu4aleoio3tadlm  lnei t t2tm(mpiy4alt lfvtatf rumx  ot0aptnmictatfaDem(mo t4 lenxo tydoptr ivi;t0s2ur
\ No newline at end of file
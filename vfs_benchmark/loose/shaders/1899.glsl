@@ -0,0 +1 @@
+nei t teur(mpiodlm emnviat)sDuaxr ;u0tlx  i3iysls ran p t0aeerxf3oo1oaD  n ol( tetmxmpou1lmtn ictl(f Durxmpnu0opeomf3iyt m uln pnt0texoio iy1opDr ieo;t0srxmxm nudap nlnvsa()s2truro;u4opxnifciysfsDrmumo u4trermr3iydlp ranvs s0setrxr3iodlp  mnvt ()arurx p;t1tleo ictyd mDem(vsn(4artrmfcia1fmD  ivo (  2toxo3oy4altemfcta(farumx o;t4tpx  i3tadls2emnvp () leoxo3to1oaDr ueol()trtoxopnudlmen netlsfartrum no0opx mfciyd a ua( s ()aexrxo3oydlptelnvi t s2uoxrpny1oltnlnvtlt srrmxrp;o1alxnioeiyd sDemu p u) ltnifcto1faDelues (0 2uoxopiu1amte fvilsf Duax ooo4oet iociaslsDulnmo;() lenmr to1omD luvi (0t2tmim3oydlmtnmnctls)artax pnu0olxo oeiadfmDrauvp;u0 lxomf3iatfaD li i s s2tr(mpoodop n nci s  rua(ro;t1teenmieias a2umn p u0alxnmr3oadlm raneo;s)s2tr(o nudam nmfeils)artmxrp;t0optn i3tldlsDuauvs;t) rerircio1opDrlues;s0 rtrio nudllt  fetltfa2taumoou0opxnioeiyt s2rlnvo;u4tetrmo3tadlmtr ieo ()truoim3io1alt mictat srumx pot1tee  octyd a uln p;t4arxoif iydfatrauvils)seuoxrpoy4opte nvi (  Draxro;u1aleoif3tasfa2ul(vsn(4alenir oodlpteluei;t trurxm nodap n fciat) 2urx oot4openmfeiysfm ul(vo t4aexrmo iatlate ivo (0 exr(rpoo1altn ics ()aDrmx o;u1ope if3iyt a uanmpnu4 leomrcto1lmD  ieo s0trxrxo3nydamtemnei s)s2um(mo;o0aeeomo3iytfaDuaums;()trxnmoctatlpt anes t)s2uo(o oy1ape  ivia(  2trumoot0tet iocild mDrmnmo;t)alxoir3ty1fmtrai s;t0seumiopnu1lpenlfetltfaDum(mp;t1oet mfciatls2uau p;t0alerxrcoytfp e neo;s)t2urxrpny4oltelnvtls aDtaurp;u0alxo ieiytfa2ranms t4 ltnmocoa1oaDeln o ()seuo(o nudoleemncsl()a2ur(r ;o4tlxomoctlsfm eanmonu0artrxo3iadfaDr nes ( teur(m oudlm e fvi sfa2ta(rpnt1optnmfetasfa2rm(vsnu)trtrir iotfat aieo (0sexo(m3iydamtn fcta(f Drmx o;o1oleomoeiadlaDul(vs;u4arenmo oodomDr n ol()trxrxr3iudlm emivs s)artm(r ;t4tpx mfciat s um( p (4 lxrio3to1op rlivolt)trtoxr iudlpe lfeiltfaDtr(rp;t1aetniieiasla rl(mp;t0tetrmf3iydfptelivs ( srurxm iudole  fetlt)srumuro;u0opxoiocilsfs2umn p;u0alxomfctodfmt aivs;t) 2xmxm iodaptnlfet s  rrmxmo;o0alxniieiasfaDul(mo;(4aetniociotomteli i t)teur(mpou4oltelnvs sf 2rrxm nt4aetnmieiydlm2rmnmp u4 lxomf oo1opt livi t)s2xrim iudal emivsatfs2tm(ront0ape mfetlslaDelu on(4trtnmocoodlat li s;t)s2xmxr3oydom   fei (fartmxro;o1oexn f3iyslmDul( ont0artoiocoa1op e ueo (0 2xoxr nu1lpen ivtlt s2rr(mooo0oltoiietytlsDuaump t) eenxoctotfpDe neo s0srtmimpnodlpeelicsa() 2trumono4apxn i3ias aDua(mpnt0trtnxo tytoa  lnvo t0s2umxm3iy1apenmfeia(f 2um(moot4opto i3iltfmDum(mp (0texnio iodlmD ln ilt0seumirpiu1lp nlict tf 2ua( onu0aleniociat sDemumo;u0 etrmo3oy1op   uei t0 rum(m nydape lfctas  2urxmpoo1aee ioeilsla2emnvp t)tlenmrcta1oatrauvol( srxrxr3iydam emietas a2ur(moou0tetomoetlsls ul(vsnt)trxrir oo1omtr nvs;(  exo(m nudll nmicsltfarta( p;t1aetn ieiytla2elnmpnt4 rtnir oodlateauvsls seumir oy4ap elfet s sruaxm no0oeto f3tytla ua(ms u0tleoif3iytlatrau olt srxmxo3oy4alt liciat  2um( o;t1ape ioeiys aDel(mpnu4trxnir3oa1lmD  u s s texoxr3ny1apeemfvtasfsrumx  ;t1ape  fetasfsDemnvp;(0teenmf iadfp elu ilt) rxr(m3iudlm nlict t)aDtaxmpno1oex iieilslaDrm( pnt)altnmrcoydfpDrauvils seuo(rpiodlpenmicias a2tmuroot1apenmieiat m emu o;(4arxnmo iotfm r uvi;(0tetmxopio1ll elict sfarraurpnt1apxoiociltlaDeanmo (0tleoif3oatopDeaneo t)tetoxopno1olen ivi (f 2rm(mpot0ole mo3tytfs ulnvpnu4 lxoio3oy1op eai o;()t2xoio3ny1lpenmicilt  rrmumoou1apenmfciyd m2elnvs u) etrirciadfaD auei t0t2urxmpiu1am nlics s a2rrxro;t0oeeoioctyt aDeln s u0alxrmfcoydopD  u i;t  rtm(o3oo1amt mfei t aDta(r oo1alx  fciatls2eauvpnu0tlerifctytlmt luvs;( s2tr(mpnu1lm  mivt s)srrmump;u1aptnmoeiltfs ul(mo;t0alxnmf3iatfat lueols)s2xr(rpoy1al  lnvsls  Dur(mont0alenmfeiadlsDulnvp u0 rxnif3iy1om r u s;( srtoirpio4lptemfet tfa2rm(r no4opeoio3ils s2umnmsnu)artnxr3oy1oa raueo;(  2tr(rpiudomtnmictl( aDurxm ;u4tleo o3tasfa eauvp;t0 ltrif3iatfp r ueslt) 2xrxmpoy4omeeliesls) Drmu pnt1opx  octatfm em(vonu) exrxrcia1faDe neols s2uoio3ou4lpenlnetlt) rraxm ot0tpxn octadlm2rm(vp;() rxnir3oa1lm elneslt0 rtmio3iy4llenmfesatfsrumxmono1tleo o3tatls2umumsn(0aetomf3iatopteaieilt)sexo(o3ou1lmtelncsat) 2uru p;u4altnmfeiytfm2ulumo t0arenxo oatfatr i slt) euoir3oy4omeelfei ( s2taxm no0aex mf3tls a ean on() exoir ty1lmD livi s) 2xmxm3ny4llte neslsfsrtm(mpno0opeo oeiadfm umuvsn()altoif oa1oaDe nvo;(0 rumimpoy1lptn fviltfartaxmp;o1apenmieiltfmDea(vsnt)tltrxf ta1fpD lu o;t sexr(o iu1ameelnciat  Dumumono0tlt  feiadlaDeanms;u4arermr iadfmtr uvslt0sruriopnudope  nctlt s2ta(moot0opxo oetas aDrauvsnu4 etoif totfmDe i o;s trum(o3oy4lme  icsas)s2trxmoot1aetnifetadla2umn s u)aleoxf3oytfmD  ieil(0sexr(r3io4ameemncias) Dtrurp;u0tetoioeiytlaDelnvs u) leomr3ty1opDrai s t)srurirpou4lmtelfvias)a2tmxr oo0tetniocils aDul(msnu0 rtrmocootomtelivs s0s2uoxo3nudalee ivi tfsDtau  ;u0oeenmi3ils a uan pnu0arenifciydfpDrlivo;t)s2tr(o3io1amt  nvi s srua(r ;u1olxnifeiasls2rmnmpnu)altrxf3iodlp  au i;s0 eurxo3iu1lpenmietat srtr(r ;u0apx  fcilslm2rauvp (4tlxomo3io1la eai i s0 exm(m ny1ole mnet s) rua(rp;t0oexnio3tysfm emn snu)tlermf totlmtr ivo;()trtr(r3nudllt lictlsfs2raxrpnu0tltomoeiat s emnvs;t4 exrxr oadlptelu ilt  eumir nu1optelics ( aDrrurpnt4tpxoif3ias mDuau pnu) eerxr3oo1fpteaieslt trxmio iu4lp e ics (fsrum(mp;u0tleomoeiyd s2eanmsnt4 exoxrcta1opD  n i;s0trurxmpoodomt mnes ( arumx p;t1apxo f3tydls rlnvp ()tlxoxr3tydfp elivils) rtrxo3io4lm nlncslt)s2urumpou0texo feiadla2uau p () lxnmf totomDelnes;t s2xmir3nu1om elnvs ()sDrru  ;t0oltnii3iltla uluvpnu)trenif3ia1faD aivs t0t2xrim ou4olt  ieils)aDurxr ;o1ope mfetydfm eauvp;u)aleoxrcoytfm elies t0trtoxrpnu4lmtemfcsa( s2tru  ;u1alx ifciat m rl(vp;u)trxniocio1faD lu sl(0trto(mpoy4ap  mnvt t) rrrxmpou4tptoii3ias a elu p;(4aeeoxo3tadlaDraiei t)srurio3iu1aptn iciltf ruax o;o0oeeniietls sDua( o t)alxrxf oydopDeliei;t0s2xoio3io4lptelivils) 2tmxm ou1aetnii3ildfsDemn p;t0areoxf oydfmtr ieols)s2xm(m nu1aleemnvi s) 2tmxro;o0tpto fciltla2rl(ms t) exrifciadla   nvo;s0s2xrio iy4om   icsa(faDra(mono4ale mo3iad a ran p;u0 eermf3tytopD  i s;s0 exm(mpoy4oleelfvs (f rur(  no4ape mfcildls2ran o;t0 rermfcootoate n o;()truoxmpoy1op n ietls) 2tm(mont4teeomietltla2elnvs (0alxoio3iotfa rluvi t)trumio iydamt mncsl(f rua(rp;u4aee ifciat m em(mp;t)tlxrmo ia1fm  au i t0t2umim3oudamtn fci tfa2tmu p;u0ape ioeild sDemuvo;(0 lxrxo oodopDeaivils0 2uoxr3no1oleemfvt t)s2tmu o;o1olxn ociysfs2rl(mp;() renxo3iotomt  iesl( t2xrxr oodamtelfeiasfsDurumo;u4tpx mf3iaslaDuanms u)aetrmo iodopD anvi;t srxmim nu1ale  nvslsf rraxrooo1aet ifetltfs2ea(mo u4 rtrxfctadfa elues t t2xmim no4lpte fcsat  rtrxmpoo4aetn f3iat sDuanvpn() etrxf3tatfa elnes (0truoiopoudop emfvs t  Drmxr no0tlt  i3iytlm emn s t)texoio iotfpt livols teum(r iu1llt lfvil(fartm( poo4aeen i3iltfs2emnms u)tetrmf3io1lptelnvs;t srxr(o3ny1aptnlics () Draump;u1tlxo f3iytlaDra(mpnu0texoxocootoptr neo;(0srtmxm3ou4alen nesat  rrr(monu1ape  o3iysfmDum( s;u4aexnmrciadlp rau o;t t2umxr3iy4aleelnes t s2um(m ;t4tltn oeiltfs2ulu o t4alxrio oadlptr neils) rumxopiu4alt  fetl(  2rr(ro;o0aeeomfeias a2eln on(0tltomrctadlmt ai sls0 euoimpiodllt  fesltf Dtaxrono0tlt mfciysfa uanvo (4 exoxo iadfmDelueo t0 2uoxm nu1opte ivtlsfartm(mp;t1tlt  ociytlmDuln s;(4texnmf3ootopD auvo;t0srtmim oy1amtemnvi t  2tmum no4aex  o3taslmDrau p (0tetrir3oydfp elnei s0t2xrir3oydal elici s  Dtrurpnu4alxnmo3tys mDrau p t0 rermfcto1lp eanei;s0 2xrxrpiydlmte nci t)aDra(  nu4optomoctls a rmnvp (0teenxf iytfpt  uvi (  rtoir ou4ll   nvt t srtrx poo1tpxoif3iatlm ua( snt0treniocoa1lmDeanvi;(  exr(o3ou4lle  iesat)sruax onu1oexo ictys sDemnmsnu0altrmfctodom elu s ()srtmxr nu1am elictlsfs2ua( pot0altniictas sDelnvs t0texnxo oodlm r u o;s0 eum(o3io1amee neias  2tm(r ;t4opx micild s2eanmp;t)aleoxo oatop   nvo s)trxmio3iudaltnlies ( a2tax  nt0tpxomictltla ul( ont0arxoxr to1fa e uvols0 rtoimpoo1am nlivs t srum(rpot1texniictytfa um(ms;()tlerxr3oatom rlneo;( trumio iu1lpee nvtatfs2rau pnu0teeniociytlm2ul(vpnu)areomf3tydlmD ai i;t)teto(o iu4ll nlnvils a2um( ono4tlenmfciyd m2rauvpnt4aeeoif3todopDelu s s)trxmirpnodomt lfeil( sDrax  ;u0aexo fetlslm ulnvs;t)trtoif3todfmtraieo;t seur(r3iy4openlncslt) 2raxmo;o1apeomoctltlm2ranvo;(4 renxocoodfaD  i o (0teto(mpnodal elnvilt arrr( p;u4aetnmf3iadfs2uanmo u) rtrio3ta1fat  ivslt  eur(rpny1optn nes s  2tr(mpnt4oee  ieildlsDuanvs;t4aeeoxo3oydopt lu il(0srxrirpoydopt  ncs t) Draumono0oeto ictysfaDum(vs;(0 reoxf3ta1oatrauvi ()t2uo(r3iu1ameemfvta() 2urur ou0tpe miciatfmDuau s (4arxrio3iydlmDeanvi;t tetoimpiy1opee ieta(fs2tmum ;u4tee iietatlaDelumo t)arenir3oa1omt anei s) 2umimpoy4lm nlies s)arrauro;t1oltomf3tlslsDrauvs t4aetoxf3iotop r uesl()texr(o io1amt mfvia()s2uax  ou0tlx iictasls rmu o t4 rxnxf3totfa r i i;()t2xrio oo1lmtemicta( artr( p;t4ale ioeiadfm ua(msnu) etniocoo1fpte n i t  etrir3nudom  livt (fs2ur(  ;t1tpxnmfciydfm2eanmo;u)tlenxr to1fa r n olt)srtoxo oydaleemncsasfsDrmur ot0aetoifctldlm uau snt) rxrmr oodomDeaieo s srxoxr no1olen fcs (  2urumpou4ole mociysfaDul( onu4aetrxociotlmDeau s;t  ruoio ou4aleemncs t sDurx pnu1aptnmoctyslm uanms;(0arxomrciotlp eanvs;()setriopiu4apt lici ( arurxr oo4tee mf3tldlm umu on()trtrirciatopDr ieo (0srtm(rpiy4amte fetlt arumum ;o4oexn fcias m2ea( p t) etrxr3io1opDr ieo s) rurirpoy1opte fct s srtmxmonu0tlxnmf3tytls ulnmsnt)texrifciatfaDeaueilt0tetr(m oydolt mnvias)a2ta(ro;u4aetomo3tat mDra(vsn()artnxf oodfpD lu s;(  rxr(r oo1ll nlfeil( arta(mont1tetnmfeias mDulums t)tltrxo3ty1la rluvsl() 2to(r3io4lptemici s  rtrumo;o0tpt  icils s ra( onu4alenxr3oodoaD ln s;t setoio3iodapt licsatf 2uaum ou0opt if3tlsla2emuvp;u4altrxrciadom e iesl()seuoxr oydllee neils aDta(mpoo4tlt  i3tydfa2eln s u4 eenir oydfpD  ueil( s2umxrpno1lltemfeiat  2uaxr ;u1tlxoifeiltlmDulnvs u)arenio iy1lp rai i (  2tm(mpiodlme  icsa( srraur ;t1tpe ifctasls uau s;u)texrxfcootfmD aues;s)t2trxopoo1alt  nvtlsfsDrrump;o0opx mi3ild s ua( o;u4 rxnmo3iotfaDrlnes s sruoim ny4lm n netas  2rrx p;u0tpto oeiasfs ra(mpnu)treoircoydlm eln o () etr(o3iodlltnmnesl()s2urumpou0aeenif3tytfsDul( o u)aeerif3to1lmtr nei (0srxrxm3no1ol n nei t s2trur ;t0tleo ietat a2ua(mp;()altrxrcty1op r uei t)trxm(o3oodaltnmfci sfaDtaxrpot1alen ieiytla2emn s;t4artoir3iytomD lnvilt) 2tmxm ny1lmeemfcsa( artmx  ou4tlen ocildfmDrlumpnt0arxnif todomDeauvils0s2tmxm3iu1am emncs t) 2umxrpot0ale mfeildlmDra(mp t4arxrxf3oo1fmDe nvi;t0 2trxr iu1lmee ictls aruaump;o4opeomo3iys s2elump;t4aeermr todfm eanes s)s2tmim3oydaltn ncsl( artrxm nt0tpt  i3iaslm2ul(vs;()trxrxr oydfp eanvi;t) euoim3nydap   fei t  2ta(rp;u1oeeniieiys a ul( o;t0 ltrxfcta1la  auvs;s) rurxrpio4lmeelnvslt)sruaxr ;u4opxn i3iatlmDemump t0arermrciy1laDeaieo ()srxrio3io1ll nmfciasf Drrx  ;t1aex mieiytlmDumu s;u)alermf iodopD an il(0 etoir3nydalee ivs s)a2um( pnu1tpxoif3ilsfm2eaump u4texnxf3todfptr u ilt t2toimpiy1am nlfci s arrmu ono0alx io3ildfaDul( on(0texomr ta1fm   neo;s)tetoxm3oy1lpen neil(  Durx poo4tptnifetlsfs2rmn o;(0 etoiocia1lmDelivsl() rurir3oydamte nvs s  2umxro;t1oetnifetatlmDeau sn(0artoio ia1opD  ivi;t) etm(m3iy4om  lfet tfaDraxr ;u1aex  f3ild m2rauvo;(0trtrxo3iytfa raivi;(0trumio3no1ape mnvi t)sDuauront4tpen octlt a2ulnvs;(4texnxr3oa1faD luvs t0srxmxo3iy1llee neslt sDta(mooo1tlx mfciytlm2ean s u4 eenmr todoaDrlu i () euoir3io4ole mnvtasf rrax pnt4apenioetytfm rl( sn()teermr iydomteln s s) 2umimpnu4am   ivtlt aDtau p;t1oee mi3tys mDua( on(4artnxf3oa1lmD luei;s0trtmxo3ny4oleeliviat arururo;o4aetnio3ildlm ulu p;(4trermoctotlpt livsls s2xoxm oo1apeemfetlt)sDtr(r ou1tlt  o3ils mDelumont4aexoxo3oydop  li olt)s2trxr oy1apee ict tfsDtau p;u4oeeomietatla2um( p;()aetrxo tytlm  lieo;(0teum(r3iu1ol nlnci tfsrtaum ;u0alxnmiciytlaDua( o () reomfcty1opDranvi;( s2xrxopou4alen nvtls) Drmxm ;o0tetn ietytlaDel(ms t)arerir3ia1opDeluvs;t0 2xm(m oydopt lfvtat) 2tmu  ;o1oleoiociadlm elu s;t4aexnmf iodomDeai olt)trur(mpoudlleelfesltfa2uaumonu0tpxniiciatls2ulumo t4 lxrir to1opDrai s s s2tm(opoo1ame lfctat  Dtaur ot0alxomoctydlaDumu p (0 etnxr oa1fa  an i t0s2urirpnodol n fes s) Dumxr nt4tleo feiadfa rl(vsnt4artrmr3iodfpDe n i;(0sexo(r oudap nlncsls)s2rrurpnt1tpxniictls m ulnmonu4tlxoifcoa1lmtr u s ()seuoxm3iy1oleelfcs s  rta( ono0oltn f3ildfs2uau p;t)tlermo3tatopt  ivo;t)tetmimpnudomt  feilt s2umurp;t1tltnmo3iatfa2umnvp u) leniocoydlaDr ieo;t0 rumiopoy4llte icsa() Dtr(r ot4oleomietldfaDrmnvp u0teenifcoa1omteauvs s)sexr(o3oo4lp e ieta()sruaxmpou0ape  fciatfm2rlu onu0 eerir3iytoptelnvs (0srtmir iodlpe liciat)srua(moou4opxoii3iatfs2rluvs;u4trxrxocio1opteau i;()setoxrpiydoltelnctltf Drmurpno4opxomoetadfm2rl( s u0arxnxf3ootomD  neslt0tetr(m3io1lpt livsasfaDrru ono4tltnmocilslsDelnvpnu4 eenmr iadomteaivsl(0s2xmxopnydlpeemfcslsfsDtmxr ;o0ape  fctyslsDelumo;u4tlermrcoadfaDr n i;t)sruoxmpny4omenmfetas)aDrmxrpoo1olx ifcildlm2uau s (4trxrxf3oo1oat  i slt0 2xoir oydaleemfei tfsrrm(moot0tlt iociadla2eaump u4tltnxrctadfmtrliei () 2xoxo iu1opeemneias aDta(mpno1tlxomictltfm emuvp u) lenmfciydfmte nvslt) 2to(m3nodolt licias aDumum ot4opxo ociat sDrm(mo;t)aetnioctatlpDraneo s0trtoxmpny1am nlfct (faDuaumo;t0tlxoii3iyt s rluvsn(4 renif totlaDelnvi;t teum(opno4ll emietlt sDur( pou4apeoiieiyd a2rm(vpn(0 exomr3to1laDe ivo (  rtoimpiy4lleelfetl(fartrx pou1olxoifeiysfa2ea(ms;t)arxnmf3oodlmtelu o (0srtrxmpou4omtelnet s) 2urumpnt1aeeomi3tldlaDea( pn(4alenxo3iytlaD  ivslt0 rxoio3iydamtelneiasfarrmumono0tet mf3tatls2em(vont)tlxnio3oa1opDrlu o;t0s2urxo oo4ap  mnes t s2raumo;t1tpeomi3iytlsDumumo;(0 etrxr ia1fp   n s s) 2uo(o3iy1ameemfcsas sDtmxmo;t1alxomo3iadla2umu s;(4 rtrmf tatom rln o;s) exr(m3oodoltnmneslt)sDtm(mp;u4tpxnmf3tytlm rmu on()texrxr iytomDeli o;t0srxoxm io1ll nmictlsfaDrrum nu1tex  ictasfaDraumo;t4trerxr3oadfpt  uvi t0 2umxm3io1amenlivtasfsrumx  ou1aexnioctaslmDrau o;()aeenir3iodfmte iei;()seurimpno1opt  nviltfsDrrxmpno1tpto fciasfs2ulu s t4 ltrmocoy1lmDraues;( truoxm3ou4optnlneilsfa2taum nt0aleo i3iat s2rm(ms t0 reomf3oytoptr nvi ()trtriopnu4ole mfvi s  2uaxmo;u1openmietasfm2umnmp;u4trtomf3totfa  au o ( srur(o ou1apenlnvsltfa2tmum nu4alx  i3ildfs ranvp;u0teeoiociadoaD aneilt)seumxr3io1lmenlnctatfa2ta(ro;u4tetnifeiytlmDuan p;u) rerxo3ia1lmD anvslt  rum(m3io1apt mneiat srtrxm ;t0aleniieils mDrluvs;()arxnxr tadomDelu o t) 2toim iy1lpen iesas sDra( pnt0alxniocildlm2el( o;u0tlermocootlmDr neil() exr(mpio4amt mici (farta( pnt1oee mi3ilslmDumu pnu)tltnxfcta1lat lnes;t t2xm(m ny1lpt mivs tfaDtmurpoo0tpto ietlsfs umuvsnt4arxnmr3oatlptr neol(0texrxr3iy4om elfvt (  Dumxmooo1tleo o3iytfa um( p;t)alermfcto1lmtranei;(0sruoio nu1apt mfeiltf rtrumpnt0aetniiciad s2rmu s;(4 rxnmf3todfmDr ivolt tetrxmpoo1am nlictl() Dur(root0tpxoif3iytla2rl(mo;() rxoxr oadoa r ueils) rxoir3ny1ome livt tf Durxronu4teen i3tyd a elnms t) ltrir ty1fmDe uvo ( srtrxmpnudlpt mnes t) Drmumoot1olen ietydla emnvp u)tlxnir iotla rluvo t0 exoimpoy4lme mfvi t)a2urxrooo1apto f3tysfs ua( p;t4artnxr3totfatr uei s)setr(r3iydal  mfvs t)srtr(rooo1texn fetysfsDrauvp;t4 ltrxrciytomD lu s s0 etrir io4oltemici tfaDua(r ;o0apt  ietysls2eln snt0aeeoif ootfpDelu o s t2trimpio1lltnmnciat) rtax oot0apen f3iytfa2umums u0aexnxf totlmteaivi ()tetr(opiodol nmfct () rtmxmp;t4opx ii3iltfs ulu on(0aetnxf3oatop  aiei;s trtoim3ny1altn fvias s2uru pnt1oeeo o3tldfs2ul(mpnu4tlxrio3totfptrlneo ()seumio iy4lp e ivias s2rmu onu0tee  iciltlaDuanvs t4 lxoio iytfa   uvo t) 2xmxrpoydlp  mivtltf Dumx ono4ale ifeils s ulumo t0 etomfctatomtr ues;s  rtmxm3iy4ole lici (faruau p;t4apeoif3tyslmDrlu o u4aetoxf3tydlm  lnvs t0trtrxmpnodlpeelnvs ()arumxm nt1oltnmfcildlmDumumo;u) lxrxf3tadlmtrau o () rumim3no4al emietasfa2uaxm ou0ope  octltfs2ul( o (0tlenmo tatlp rln ils)t2uoxo3nydol n iei sf Drm(rooo4aetoiieiad s ulnmsnu4tetrmr3oydlat auvo s t2to(mpnu1ll  micsat  2urx  nt4apto oetlt a2um(mo;(0alenmrctytopD  neols0setmxmpno1olt  fvsl(fs2raum ;u4altn oetlsfs eaump;t)tetnifcoa1lpte n s s0sexmxr oy1apenmnvs (  2ta(rpnt4opxomocias a uanvont4arxnxoctotlmDeaivi t  etrxrpno4lm n ictat  Drrxrpnu0aetoifciydla rln p;u4 lxomf iy1fmt anvi t  2xoxmpio1altn ivslt) ruau  nu0tlen o3tasls2ra( snu0 lxoir iodfmt livo;s) 2umxm3oodlpen net s)a2ra(mono0ope ifetadfa2ea(mp;(0 rtnxo3tydlmte nvo s  2urxm3io1amtn ies tf 2um( ono0tptn f3iltlaDra( p;t4arxnmrcto1lpDe nvsl()setmxr oudol nlncias)aDumu pnt0aexn iciydlm2ra( p;t)tlxrifciy1fpDrlu o ( s2uoxr3nydll   ncs tfa2rrurpno0olxniieildlsDelums t4aexnxf3iatopDe nvs;s) exmir3oo1ole  netas)srta(ront1texo ieiyt sDulnvsnu0aeenmoctodlmte u i;()texmio3nudomeemivsl()aDtm(ronu0opto oeiltfm2umn o;u4 rtoxr3iadoptelueslt)trurxrpiu4llenmfvil(fsrurx oou4alx ii3ild aDua( s;() rtoxr3iatlat  uvi t0srtrir iodllt  fetl()aDrmum ot4aet  f3tatlmDrm(vo u0 eeriocoy1oa ranvolt  ruoxo oudal nlietas  2raxroou0oltoioeiytfs2um(mp;(0aeenxo oydop rauvilt0texmiopio4al nlfvi s  2tm(root0aleomo3tysls2ulnms;t0arenmfcoytoaDe ivo ( sexrxo no1lle  fctltfsrtaxrpnt0apto oetld a emn on() eeoifciydlp e i s t0srto(o no1oltnlicsa(f rtmurp;t0olxn fctls mDumuvs;t)altoxoctadfa rai i;( tetrxopny4lp n iesl(  2taxrpnt4olen feiltfaDumnvs () lenxfcoa1latran i;t  2urxmpno4amenmfei sf ruaxrpnt1tlxoifeildlm2uluvp;u0teeoif3ta1omDr nes t texriopny4lptelfciat)s2rrurono0olt mf3ils a ea(vs;(4 lerxfcia1latelnvi;() 2xoim oy4apenmnei s srrm(m ;o1aexoioetydlm uauvs;() leoxrciodopD  nesl( t2ur(opoy4lme mfei t srrrx p;o1tlxomieiltfm2eanms;t4 exnmr3iydfaD auei ( seuo(m3ou4ap nmivslsf rua( pnt4opxomfctld s ulumpnu0 eeoif tytoa e neilt0 2trio oo1omte fvs s srraxro;o0optn ocias m2uauvs u4aexoiociy1lpt aieo;t0setm(mpoy4al  mivsltfaDtmxrpnu0teeomf3iatfm uauvsn(0tlxrxf oa1oatean o t texoim nu4lp n fctlt) rrru  ;u1apto ocias s em(vs;(0 eerxfcootlaDe nvsl(0setoxopiodameelnvs (  2rax oou0tlto f3tlt s2em(vsnu4 leomfcoytfm elnvsls0 etm(m3nodaleemnviltfaDuaur oo4oltnmictydlm emnmon(4 eeoxrctadoatr u s;s teurxrpiu4op nlfvsa(fs2raxrpnu0ope  o3ils aDeaumpnu)texrir3tadfmDe i slt t2xoim3iy1apenlfesa(f rtax pou4oeeomfciys sDemu s () rerxrcia1latrlieslt  exo(o3iodamtelfeia( srtm(rpnt4altn i3iys m2rmump t0alenmf3oy1laDrai o s)t2tmxr iy1omee ict s)sDtmumonu1ape  ociatla2eaumpnt4texrio3iadfptrli o;(  rtm(o iodalenlfcs s a2urur ;o0optn ieiatfm2rmumsnu4aexomf3ta1oatrli sls0 2uoxm oudam nmfetls)s2tax  ou1opxomi3iadfmDrmn o t)aexnmf oatoaDrlueo;()srtm(o oy1llenmfctasf Dua(  ;u1tpe  fctatfa ul( sn()texomo3iy1fa r ivs;t trtriopny4ll e ncil(f Dtrumpot4opt  ictatla umnvs;t)aeeriociotomtr n o (0trtmxm3iy1lmt mnviltfs2trx  ot4apx mfctlsfaDel( snt0 lenxr3io1omt luei;(0 2xrio ou1ope  fei tfa2raurp;t1aetnioctld sDua(mp t0 rtomo oatlaDrai ilt srum(o3oy1ole  ncsl(fartru pnu0tee mi3tasfa rm(vo (4trtrio3iatlp ean slt seurir3oy4ome lfvslsfarraumooo1ole  i3tatlm2rln s;u)arermf3oadom rlnes ( srtoxmpoy1op  lnes s) Dtaxro;u1oexn o3ildlaDranvon(0aexoxfcoydfpDe nes;s0 euoxm3oy1ope lncil()sDrrxr no1aeeo ieiat mDrmu o (4trerxo ta1fa rauvilt0s2xriopnu1ame lfes t)a2rr( o;u1tlxo ieiltfm eln s;(0tlxrirciy1fp r n s t  rtm(r ou4apte ncia()artmxrp;o1tpt  iciydfaDumuvp u4treoxo3iydfa rlu s t  2uoim3no4lptelncs s  rrmu  no1oleoiiciadlm2ran sn()artomf3oadoa  aueolt teur(r3nydapeemiesls s2tr(mpoo4aptoioctyt a2emnmo (4tlenif3oydoa  ln i s s2xoxm io4ll emnctltfsDtr(rpou0tlxoiociysla ea(mo;u0aeeomf3ty1lat auei;( t2umxo iy4al nlncsa(  2tr(r ;o4apt  feiltfs2umumon(0aetomrcia1fptrli s t)t2uoxm no1olt lfeilt)arum(mpoo4oeeoio3ilt a emu p u4alxnir oodopD livi;(0s2ur(mpoydop nmnvi sfarua(m no4opt io3tyt a ulump;() exoxr3iydlm r nvo;t seuoiopiu1ape lneiatfsrtm(  ot0oet  ieias s rl(monu4 rtoio oy1lptraies;t  rxo(r3io4alte fvs t aruaxrooo4tlenif3iytlm rluvo ()tleomoctotopteai o t srtrxm3oo1lm emnvt tf 2tmxrpno1aleo i3iltfs el(vo t0 rtoxr3tytomDe neil( t2trxr3oodlp   nct (  Dtrx oou1opx  f3tatlm um(mpn()trtnxo3iadlpDe i i t0truo(o3ny1llee nvia( srrrxrpoo0tex ioeiys mDuan ont4aexnmoctytfmte n olt s2tmio3ou4lmtnmfcslt srtmxm nt1tle  iciytlmDua( s;(4alxrifciotoate u sl()s2tmxm oo1amen fvtlt sDrm(rpno1oeeniieiyslmDemuvon(4aexnxociydlp e u il( trtoxo3io4llee fciasf rtm( o;t0texo ictltls2rm( s u)artoxfcoy1fmDeauvsl( truoxrpoo4lp n fvtl() 2uru  ou1ole  o3ilt m rmu o u0treomr oodoa  auvi t  2xmir3iy4alt lnvs s  rtrxm ;t0opt mf3tydla2ulums;t0 rerirctydopDe u olt  rxm(r3iy4opt  nvils) 2umumont0openifcildfm umnms;t) rtrioctotlmt  n s (0sexmxr3ny4lpeelfviltfaDumx onu4tltomfeiatla elnmp;()tltnmr ia1lateau ils  rtmim3iy4omenlicsl()sDurumpno1tpeoiocildls rau p;(0aeerxo oodfpt  nvo t) rum(o ny1omtelnvi (farurxr ;o4ale  i3tat m2elumo (4 lxrxf3ty1optrlivi () rtmxrpiydamen ieslt sDra(rooo0aetnmieiatfsDulnvs;(4altnio3ia1optr ivi;t0teumirpiodam emnvtasfarur( pou4oexnioeiat a ea( s t4aetnxr3oo1lmt li ilt0t2xrir oy4am   fvsat)aDrmu poo1tlxo f3iadlm rm(vs t)teenxo oydop r uvols trxo(r ny4amtnlici (fsrur( o;t4apxnmiciyt m2eluvpn(0tleomocoydlptrluei;(0seurir3nydalenmfcsat)a2tm(  no4alenmf3iyt m rau p;t0tetoxfcoytfm r n i;s0 etoirpoy1lpe mnci t) 2rrx p;t4tlt mf3tad s rluvsnu4tlermociatop   n s t0truo(r oydlm elnciat srrmurono1altnmf3tad m2rmnms (4trtoxr ty1latrlueo () exrir3ou1ll nlnct ()sDrr(mpot4oee ifcildlm2eluvo;(4 lermo io1fat  i s;s)s2to(m nydolt mnvsat aDua( o;t0oexnmoeiasls2raums;t0 reniociydoatrlues;s  rurxm nydamt lnctlt  Drrur ;u1aee mictys aDrm(msnu4aetrif ty1op rlivs;(0trur(o3oydoltn ncil(fsDumxm ;o0oet moctld a2elnmp;() lenif3totom r nesl(0t2uo(opnu4am e ici () Dra(mpnt1opt iiciad a2raumo;(4tlxnxr3oy1oa e ues ( sruo(o3nu4lmen neil()a2uaur no4apeo o3ilsfaDrm(vp;(0 etrmoctydomt an sl()trxoir3io4op   ieiatfs2rrx oot0apxnmf3iad a2emn pn()tltnircoodop eaivols)texmxr3iodlleemnciat)srtm( pnt0apxoii3tys mDrln s ()artoir3iadom raiei t0trtr(r3iu1ll   nciat) 2umurono1tle ifciys aDrmnvont) rxoxfctytlm   ivs t0 euoimpnydop e nct () rrr(rp;u1tpx mo3tls a2ulump (4arxnxf tytomD auvilt  2um(o io4aleelicsl()s2uaxrpot1aet mfctys sDrl(mo;t)aetrxo3oydlp r iei;t0srtrxopny1opee ncil(farumxm no1olen fctld sDel(vs (4trxnif3ootopt  neils teur(o3iy4lpenlivtas) 2ur(mono0tet ii3tatlaDulums;u4aleoir3tadfaDrai ol( srxo(m3oudaptn ncslsf Durx oot0tlx if3iltlaDua(vsnt)alxnmr3oydoatrlu i t truo(opiy4llt lfvt (fs2tm(ro;u1tle ifeiytls2uluvo u)tltrxocootlmtraivol(0sexoxm oydol   ivi sfartmu ont0aptoiiciad s em( s;u4trtnmoctotfmDr nvi t s2xm(m oy1omte ictas  rrau o;o4aeen i3tas a ua( sn(4 ltnmr3ty1laDr ues t0teurirpou1ll e ivta() 2umu p;o1olx ioetlsfa2ra(msnu4 rxriocootoptr nvo;() 2uo(r3nu1alt lncs tf Draxmo;u1texoiieiyt sDulnmp u4aeerxfcta1fa elivi;()s2xm(r iy4lp  mivt (farrmurp;t1tee mfetasfm2emnvs t)tetnxrctytfat  n s;s0trurxm3oydole  fcslt)aDtax pnu1tpxn oeiad s uan p (0artnxrctotlpDe nvs;t0 rtrirpiu4am elies () 2tau poo4olen iciytlsDemnmsnu)texoifciadfp ran o s)trxm(m3nudamenmnctlt) Dra(r ;u0ape mf3tad a uan o;(0arxrxo iatfpDe i i;t0srxo(m iy1op  lnvta()sDurxmo;t0oet mo3iyd a2el( p t) lxrxfcoy1oate uvo;s t2uoio oudlm   nesa( aDrmxr nu0olx  feiadfm ean o;u4 eenmf todop  lnei;(0srxo(opiu4lmenmfvta(faDuauroot1tlxoio3iad s eanms;t4aexomfcio1lmD  i i s0trxoxm3iy1apt mfeta( a2trxr nt1olx  i3ilt sDrln o;()artnmr oodfpDraieil(  rxmxo iu4llenliesas aDtr(rpoo1aeen f3iadfs2rm(msnt0 exnifciy1fpD aivilt trtrir oy1openmncsat)s2ta(rp;o4oet mfciyslmDrmuvo u4 exrio iydop eln o;( srtrxmpoydllt  ieilt) 2umxrp;o4tee  ieildfm2rl(vp;u0 eenmr3tytfmtranvs;s) etmim3iu1ope micslsfa2rrxrpot0tpt moctltfm eanmsn()tltnif io1lpt  i sls0s2toimpio1omtnmnct t arraur ot1aexn ocild aDulnmsn(0aetomf totopD auvs;t)trtoxmpoo4lpe  icil(f 2taur nu0apxn oetlslaDrmnmo u) renxrciytlm eai s t srtrimpoy1amt mnvtas a2tm(root4apx iietltlmDel( pnt0trxoxr oydoptelues;t0seuoim iy4lm emies () Dra(mpnu0aexomfctltla2eln p;()tltoio tadomD lneils s2uo(r ou4ll elnctltfs2ur(m oo1tpenmieiytlm2eaumpn() rxrxf iydom e ieo;( seumio3iydamtnlfcta() 2rmumo;u1oltniietys m ua(mp;(4aeenxo oa1omD lnes;s)seurxo ou4al nlicslt)arumurpoo1aet  o3iatfaDran p;u4areoir3ty1lm ran i;s0teurio3ny4llee fcsls)a2taumoot0oeenif3tysfm ra(vo;(0 lxrmf3to1fa  livi;s)s2xo(m3nodlp nmfvt s sDra(mp;u4oexnif3ildfs2eln o u0aexrxo3iy1om  anvolt)setoxr3nydlpen nei s)s2truronu0aleomfeiltfa2eanvs;(0tleniocoydoa  lueo s0 etrirpno1amt livta(fsDur(moot4aptoif3tlsfmDulnvon() rxrxo3oydopDraivs s0 rumxopiydape mnesl(  Drmumono1aptniicild mDrlu on(0tlxnxfciydfa elnvols) exoxm iy4al  mfvtatf Dumx onu4tptoioctatls uaumo;t4 etoircoodla raies t0trtrxmpoy1alt miei sfs2taump;o0aptomfciltls rmuvpnt) leomo tydlmt aieo;s) etr(r3iu1apt lneias  ruau oot0tetomo3tatfm2eanmp;() reoxo to1opDranvsl(0s2trxm3ou1om nlncil() rtau p;u4alt iictat mDelnms;t0tlxnxocia1fateau ols)teurxm3no4lpeemivils)s2taxronu1teeomoctyt s uan s;t4 rerxr tatfa rlueo t) 2um(r3nu4ome lieta() rtruroou1oee  f3iadfaDrmu ont0 lxrmr3iotlaD  ues s s2xmxr3nu4al nmfesas  rrmuro;o4tetniocias aDem( sn()trenir3tadfm ranvo (  eumimpnu4op elicsat) 2ur(mo;u4oetoioeiasfmDrmumo () rtnir iotom  lnvsls0 etm(rpiu4apt mfetas  2rm( p;o1tet  fciltla2eau o u)texnmf3oadomDranvolt) 2urxm nu1apte ies s) rur(rp;u1oet  ictldfaDuan on(0tltomr ootlaD auvi s)srxo(r3ou1apt  nvsl( aDum( pot1olenmietlslaDumn snt) rxnir iydomtrlivo;(  rur(opnudoleelfcs s)s2urxr nu0oeenmicils s umu s;t0altnmo3tydoa  aieslt)srurxo nodllt  ivtls) 2rrurp;t1tet iieiytlaDemuvp;u4texomf3tytlaDrli il(  ruo(o3nydoptnmnvi ( arrrxr ou0tee  oetltfa uaumo t0trerir3iatop  aies;s) 2tr(o ou4optelies s) 2trurp;o1aexoif3tyslm eau snt0tetnxf to1oa eauvi s0srumxr io1apenlivsl()aDtax pnt4tee mfciadla2rm(vo u0alerir3iytfpDelueo s) eumim oudomenmfci t  Dum(rp;t4oee mfciadfa2emu p (4tltoio3iy1fptrauvslt t2toirpny1lmeelfetat srtmu pou4tpxomieilslm2emnvp u4arxrir3iytoateauvi t)srtm(opio4oltnmicsasf 2rr( onu1oetoioeildls2ul(vs t4texnmoctytlp  au i t) eumiopiydlmtelfvsa(  rrrxrp;o1tetomf3tad a ua(ms t0 ltoif iy1om r uvs;( srxmim oy4amte fciat) 2um( o;t4olxnmietytfa2uluvp u0tlerxf oa1oat lnvi s) 2tmxrpny1apt lfetlt)aDtr( poo4opx if3iad m emumsnt0aleoxr ootfa e u il(0 2toiopiudale mfvsl( sDrrxro;t0opt ifcilslaDua( s;(4tetoir3oy1fp eln o;t)srxm(o oydal  lnvtltfaDumur ;u0alx  o3iyd sDel( o;u0 etnmrciodla rli s;()t2tmxm3iodoleemfvi s aDurxr ;o4tlx  feiltls2ra(mo ()aeenmr3iy1lmD livols) 2um(o nu1altelnvt sfa2taxmp;o4oexomi3tldfs ea(msn(4aleomo3totfmte uvs ()trxo(r nudamen ivt ()arta(r oo4tlt mi3tas s2em(vsn(4 exnir3oydopDeaneol(0seum(o iy1lp nlfetasfa2trxro;o0aeen oeiyd s2rm( on(0texoxr3iy1lpteau sls)t2xoxr3nydaltelneiatfa2rr(mp;o4opxomiciydfsDuan s;u)teeomo oodop eaneo;t)trtm(o io4om nmivsatfaDur(moou0oeeoif3iyt s um(vp u4 exoir3tytfm raivo;t) 2toimpoodlpenmfcs t) rrm(mpou1tptnii3ilt a2uluvp u)teenio3todfm rau ols s2uoxm3ny4lpt mfvia()arurum oo4ope ioctyslsDelu o;u) rtomf tadoa e ivo t seuoio3nu1amen icils  rtru  no1opt mieiyd s2rm(vs u4 renmo3ootfp  luvils  rxr(r iu4lp  livsls)sDrrurono1aeto feilt s2uau s ()aetrio3ty1fm eln o;s sexm(m ny1lm nmfviat)srraum nu0tltoiiciasla ea(vsn(4 rtoxocoydlpteaieslt s2tmxo io1ll nlicil(fs2raur ;t4tltnmoeiadfmDelumo;u4tetoir iodoa e ueslt0srtoio3iudap   ies (  Drr(rpnt0tetoifeiys a2em( ont) rtoxfcty1lpD  u o;t)seumxmpiudale lfetlt) ruaur oo4oeeomo3tadlm rl(mont0 ltnxo3oadlp eaiesl()setoxr oy4omeemicias)aDtmx pno4tlxn ictyt a em(vo;(0tleoioctotlaDrai ils  2xoio iudal   fcs t  Dumxm ;t1oexo iciyd m2emn p u4tetnif oadlpt  i slt0 euo(o3nydopt  fct ()sruax o;u4aet  fetlsfaDumuvp ()aexomrctydlaD livo (0sexrxr3iu1lme  fcsa(f rur(  ;t1apeo oeiydfaDrmn p;t0tlxnmocoydlaDeauvo;t) 2uoxmpiy1lp nmnvs ( srtmuro;u1aleo o3tytls2rm( s u0alermr ty1fmte u olt  ruoxm ny4alt  neils)srum(mp;t1apto fetytla el(ms u0 leoxfcio1fatraueils0trxrxm3nudlmte net sf 2rrumont1olt iociyd aDuln pnt) exomocoo1lptr ivi;s0texm(rpoodlm  mfetas  Drr(r ;t4oltnmoctadls eanmp;()texrif tatfmt  ueo;(0texrirpoo1ole  ici ()srtm( pou1tetnmi3ils m rlumpn(4tleomf3ia1oat anei s) rurir3iy4om   netl()artr(m nt4altoio3i
\ No newline at end of file
@@ -0,0 +1 @@
+ivsl( s2tr(mpio1amt lfcsl() 2rr(mpot0apeo feiyt m ua(ms;t)trxnmrcto1fmtraiei () euoxr oodape mfcs (f Dumx pnt1tlx mocils m emn snt0artoir3tatfmte uvi ( sexr(r3nu1llteliviat a2urxront0tetniieilt s raump;u) ltnmfcoa1fa  luvi;() rtoxrpiudlptelnvia()a2tm(mont0olxoii3ilt m2uluvs;t0 lxrif tydla  lnvi;s0sexr(o3oudamenlfetatfaDum(rp;u1alxnmi3iydfsDrln onu4texrxr3oadopDrlnes t  rxmim iy4lp e iciatf 2rau pnu4aleoifciyt aDulu o u4altnmoctodlpDelnei;s0teumim iydlpt lfvsl(fa2uau ono0apt mieilsla ra(vs;t4 leriocoydlmteauvi;t)tetm(m3no1opt lnvta(fa2uau p;u0tex iieiyt m rm( s u0trerxfcto1oaDrlivo t)trtrim3ou4lltelnctat)arur(rpoo1alt mi3tasla2elu p;t4 rtrifciydlmtraues;t  2tmio3no4alenmivilsf Dtmump;u4apeoio3tysfs ulu sn() lerirciydom e n s ( srxrio3iodlmtn ivi ()artmxronu0alxnifciytfa elnms;u4altnxfcty1fpDeauvo;(0t2toiopoodomte fcsl()artrumpoo1tlt  feiysfm rluvpnt4 eeoircty1lmte n o;s truoir nu1omeelncta(fa2ta(r oo1apt mfctasfs2rmn snt0tlxomr tatlp e n o s)srtm(r3nu4lleemnvsa(fsrta(mo;t0aleoifeilsfaDua(ms u0tlerxociytfptraues;()srxmimpiu1opt  fct s  2ua( onu1ape  ietltfa ulnmpn(4 eermf ta1latrlu i s0trxm(opnodlm   nvil()aDrrxr ;u4tpenmi3iyt mDem( sn(4 etrio iotoaD  n i;t s2umio3oy1al  lfes s) 2ra(ro;u0texoioeiytfa2uan o;t0alxomo3oy1lm r uvslt0 rxo(opnudale lietas arum(mp;o0ale ifetlsls ulnmp u0teerxf oydlatr i olt) 2umxo3nodop  mfvtasf 2tmu pot0altnmicilt s2el(vsnt0 rtoxfcta1fpDrai o t)texmimpiudop n ivsl(f rrrum nu1oexo o3ilt s rl(vsnu4 leoxr tytlate u i t0teuo(o ny4ap  miviltf 2rru oot4tpxoioeiat m rluvsnt0aexoif ty1laDr u sls) rurxo3nudlm   ivtlsf Drmumpou1apxnifciatfa elnmp u4aetomfcoy1fmD aueo t)texr(m3io4llenmieia(fsrtmx p;t1aeenii3iydls ua(mpn(0artoxf3todla r uvi (  ruoxm3nudal e nes ()a2tax  ;o0apxnii3iytfa eanvp;()tlenmr3todlpDr u sls trtrxrpiy1omtn nvtasf rta(m ot0tlx mf3iatlaDea(vo u0 rxrif oodop raieo t)t2uoxr iodlme  fei sf rtax pou4oleomo3ils m2uan pnu)tetnifcoadfa eanes;t)s2uoir oydoptnmnctat)s2rm(r ;t4ale moeias a2ea( o;(4tlenxr iytlpDrlues ()s2tr(m no4apte ietatf rtm(ro;u0altomf3iatfaDumu snt0aleoifciodfpDrau s s0t2xr(opiu1am   iviat aDurum nu0tlxn ieiytla umnvpn(0aetoif3io1lp elnesl(  2trio3iodam e nesl( arumx  no1tlx  ociad m2ulnmont0 rxnirctadlatrau slt  rum(m3ny4altnlictls  rrm(r ou4tlt ifeiydlsDuanmpn(4aeeoifcootfpDe u ol(0 rumxrpno4ol e ivtlsfs2taxmo;t0oet  feiadlmDelu o t0tetnmfciydlp eanvs;s setrxo oo4ape  fvtltf rtmum ;o4apxo ieias s2ulu s;u4altomf3iy1oat liei;s)trum(opiudlmenlivs (fsDrmxrpot1tlxniieiad sDum(mp u4trxomoctodfmDrluvs;() 2xmxm3no1lp emnetls srua( ont0tltomfetasfs ea(ms;t0teenxoctydoa r neo t) rumio oydam e ivs (f Dtrxr oo1optoiieiydlm2ulnvo t0tetrmfcootfa rauvo;( sexmim3ou4ol   fesat)arur(rpou1oee mf3iad a2eanvo u)aleomr3oytfmDelueol(  2tr(rpoudomt  ncil(faDrmu  oo0tpto o3tasls2raumon(4 eerxo ia1la raieo;t0t2uo(opiy1alt lfvsl() rra(r oo1tltnmfeiad a eaums u) eerxr3oodlptraneols  2xm(o3iy4apenmici ( a2ta(rpot0tltnifctltfa eanmp t)aetrxo io1fatelieolt0 rurio iydlpenmivt s s2taxrp;o0apxniociasla2ulnvp;t)treriocia1fm rai ols)s2tmio3oodol   fvtatfa2umur ;t4apeo ieild m ua(vonu0teeomf iytlm  an o s truoio iydal emies t artmx o;t1tltnmociys m2elnmpnt0 ltoifcia1fmDe u i;() exoiopiudol   fcsas)aruaxr ;t0altomietat a ulump t0 leomfciy1fpt li s s sexrxopno4ap  miei (  ruax  oo1tlxomi3iadfsDelnvp t4tlxomr iatlp  auvs;(0t2trim io4amtnmnes ()srtm(mp;u4ape  f3ildla eauvs;t4tetoxf tydfp r nvo;t t2urio3no4omt  icsatfsrraxro;o4tlxnmo3tldls2ra(monu)trtomr3oatoptraieols t2tmxrpnydll   feta(fs2ta(moou4olto fetld a2elnvon(4 ltnmocootfa  aueo;t s2uo(m oo4opt lieiasf Drrump;u1altnifciltfa2emnmont)arerir3io1fm  livo s  eumio3iudopt  ics ()arum(mp;u0altoii3ildfaDem( p t)aetomociodoat an ils)srxm(mpiydol nlicsa(fsrtaxmono4apxoiieiyd s2ul(vo;()aexoio oytfp eli o (  etoxm nu4lmeelnvi (f Dtmxrpnu4altn i3iysfs2emumo u0 etomo3iytlm elies s)s2xr(r iy1omtemict s s2rau p;o4altnmfeias sDea( o;t)trxomrciadopDe iei;t0trxoxm3nudalee nviltfsrtmx  no4altnifeiaslsDuau onu)areomfciadomtrlues (0srtmio3nu1alee net ( aDtr(r nt4tltnifcilt a rmuvo;t0aetrif ootfaDeaneo t  rumxr ny4altn ncils  rta(m ;u4tltoiietldfmDrmnms;t0tlxnifcoatfa  luvo t0s2um(mpnodomtnmfci t)s2taurp;t0opx ifctyt aDemnms;(0tltnmo todomte n s;s)srum(rpiydamtemfvils) 2tr(m ou0oee  fciyd m2rlnmp t0 lenio oytopte ivolt srumio iodaptnliesl()arrm(mooo1ole iieiytfaDrm(mp ()texnmf3iydoatrluvi t0t2urir3no4lpeelfetls)srumu o;t0texn i3iydlaDraump (4 rxnmf3tatlm rlu o (  2xoio nydamt mnviatf rurumo;t0tpto ociytfaDul(msn(0 exnxf totfaD auvi;t srxmxm ou4llenlnctatfarumxr ;u1oleomoctaslaDeau p;u0alerxo3oodopD au ils)t2xrxr oy1lpte ictl( sDur(rpot0tpxnii3tatfm ra( sn(0 ltoxr3tadfmD aueil(0s2um(r3nu1lle lfvi ()sDrauront4tpeomictasls rlu p ()altnir iadla  aivi;(  2xoxm3iu1am e ies s) rrru  oo4opeo feiysla2rlnmo (4 lxnmfcoytlp r iesls0 2xr(r iu1op nlnesat  rua(mpno4teeo f3tls sDuluvont4 ltomo3ia1fp  aieolt  eto(mpoy1lpt  netatf 2umx  ;o1altn iciltls umuvp (0texnxf3to1fa e uei ()t2uo(rpio4lpe lnctl()arraxrpno1apx  ieilsfa2em(mo u0alxrifctotlmteauei;s tetrxr3ou4amte ict s)srtmu o;t1aetnmiciys s um(vp;t4 rxrmr3oa1fmDr nvs;s0 etrirpny4ope  nvsasf 2ra(mo;o1olt  oetldlsDrmnvs u4 rtomf3oodom e ivs s0setm(m nodam e net tfsrra(mooo0apeo i3iaslaDra(vsnt0tltnxrciytfptrli ils0texoim3oy1ap nmncsat) rurx p;o1apxnmi3tytfs rlnvo t0 lxomrcoadlaDeau o;()tetoimpnu4lptnmnvs sfaDurur ot4tltnio3ils a2rmums (0teeoxr ia1fa ranvslt)srto(o iodll elivt () rra(  ot0tet iieilslaDeluvo (4aeeoxo oatopt aivol() 2toxr3ny1amt  iviatfa2raurpot4opto octls m rau o t0teenir3ootlm  anvo t)teurirpno1optelneia( a2tmxmo;t1tpxomoctld a2rau s t0trxoxr tatfmD  ieslt)s2toim oo1alte nci ()sDum(r ;o1olxn fctys s2uanvsnt0 rermrcia1opt livs;t srxo(m iy4ol   fcils  Dtmxrp;u1tltnioeiyd m rlnmsn(4 etnir3iadlaD  ivo;s t2xm(o iy4openmieiatfaDrr(mpno1teenif3iysfsDuauvs t4 eeomr3oydlptelnes;t0s2urxrpnu1lle  ics s)s2uru  nt4apx if3iytfaDrmn p (4 lxomocoa1faD  iei t) ruo(r io1lleelfcsas  rum(rp;u0aexoif3tadfm um(vp u0tlxrxr3tydlptr nei t0 rxoxm io4ll emncs (  rtmx o;u4tpto feiltls umumo (4 eenirciy1fmte ues () ruo(opou4lmen fcs sfa2tr(m ou4olxn f3ilsfs um(mo;t4 ltrmocootlaDe i o t)texr(m3io1ope  fvsls artm(mo;t4tlto fctysfa rmuvs;t0 rtnmf oodlpDraneo s)seuoxr3nudopt  ivilsfaDtrx oou4olt  iciadls2uauvsn(0 ltomo3tydlptelnvolt t2xoim3iy1lpen nctlsfsrra(  oo1olxn f3iasfs rmnvs ()tlenif iotfmtelnei t0 2urxr iy1apenlnvs t s2rr(r nt4apeo o3iasfaDel(vo (4tlxnif3ta1lpD au ol()t2tm(m nydlp nlfciatf 2tm(m ;t4aleoif3ilsfs uan p;u4arenif3oydomtrliei;s0t2trir3nu1am nlnct s) 2trxr oo4alenmiciytfmDem(mo;u4alxrmo3oodlm eaieo s0trtoxo nu1amt mivtas  2tru p;t4aee  f3ildlm el( o u)alxnmociy1omDranvolt)tetr(o oy4olt  fvi s)arur( oou4olxo o3iydls2umnmp (0tltnxo iydfa  auvi;s  2uoiopnu1am emfvil() rtmu onu4aeenmietat m2rln ont)aetrircoadlp eaues (  etrxopoydal emfeta( aDuaur ;t0aex  ociltls2emumsnu0arxnir3iydlmt  ivsls) 2ur(m oudamtnmnvtasfs2uaxmp;u0tex io3iadlm2uluvo;(0arenmr3oadfate nvi s  rxr(opiy4olt mfcils) rrr(rpoo1oexnif3iydfa uluvp (0 eenmo oo1omtr u i t) ruoio3oodllt mict (fs2umu pno4alt  ociatfmDua(mp;t0arxnmr oodlmD  ueo (0 2umim3oydam n ncilt artm(ro;o1teeoii3iydla rlu pn(0trenir3tatfp r u s;t0 2urxr3ny1amtelncsa(f 2rmum oo0tee  ociyslm ua( p u0aetrmr oytfp eai o;t0 2xo(opoy1aleemietl( sDtmx p;t1aetomieiaslm2rlnvp;(0aleoirctytlpte nvo;t0texo(m iu4amte nvi sfs2rr(m ;t4apeniictlsfm2rmnmont0 eeomr3oy1la raueil()t2urio3iy4aleemfctasfaDtmxmonu1alxn ociasfsDemnmp t0 eermr3totop  aivi s)s2tmxo nydlmtn neslt) Drr( ono0oex mfeias a rau o;(4trermoctodomt  i olt)seuoxm oo4ol emnvtat  2ra(mont0opeomiciasfs2uanmo;t) reniociy1fp   u slt)sruo(r3ou1lpee neils  rtru o;u1aptniiciydfa rlnvs;u4aexrio tatlm rau s;t s2toiopoudomee fcs t)sDrax ont1tleoifctltls2ua( on()areoifcio1fa eaieil() rtmimpiodlpt  fctls)aDrrx poo1tpxnif3ias s2rmnvp;(4trenmf3oadlm r iei t0s2ur(opnu4lmtelivs (  rtrxmpnt0olen o3tlt aDulumpnt)altnmfcoadoatrau o;() exmim oo1alee ivslt  Drrumpno0tpe  i3ilsfmDel(vpn(0tltomocoytopD an s;s)srtoxopoo1omt mivtltf Drrxm ;o0tetn oeiytla uln o;()trtoio3oodopD an s (  eumxo ou4op e fvs (fsrrm(ro;u4oeen f3tys a2ulnms u)teenxr tadfp eauesl() rxoxopio4am   fcsl(  Draumpot4aeeo i3ilslaDemuvo (0 exrmf iodlmDelueo t0 exo(rpoo1ome mfvtatfaDtru p;o4teenmoetldfa2rm(ms;t)aeermf3totfptr nvo;(0 rxr(o3no1am nmfcils) rua(moou1tpx mo3iasfm2ra( p;t) leoio3to1fmt  neils sruo(mpno1ol emivia(  rururo;u0aetnmictyslm2el(vp;u0teerif3ootopteluvils0s2umxopoo1lle  ietls) rtmxm ou0tptn iciatla ea( o (0trtoif totfm rli o;t)t2xoxo3nydomt lnvtat)a2rrx poo0alxoio3iatfa ean s;u4 rtoifcoy1fm   nvs;s  2xrimpoodlmenlfvta(f rraxm ;o1alxn oetadlaDrlu pnu0tlenmf3tytlateaues ()sruo(o3nydlpeemnvia(f Dtmxmont4apxo ietls sDelnms;(4trerir3to1fmD an il(0trtoxm ny4opeelietat aDuauront0oltomf3iytlmDulu pnu)alxnmo3oodlm  anvs;s0 etmim3iu1ol elfeia( sruaxm ot4aeen ietat s elnvpnu0aexoircto1lp  lnesl(  2xmim iydllenlivi s) 2ra( ooo4ape  i3tys a2um(vsnt0aexrmo3tadfmDr ivs t) rtmxr iydol  lfct sfarurxmp;o4teeo i3iadlm elnvsn()tlenxf3oy1oaDrlies s0t2urxm3oudlmenlieia(f Dumx o;t1opxoiocildfmDeluvo;u)trtnmr ia1fmtelnvolt)s2xm(m3iodoltemictat a2tru oot4tltoio3ilsla2ul(monu0tleomf3tytfa r ueo (0tetrxrpoy1apt lneil()srtm(m oo0opxnmi3iyd s eaums;(0aexnifciatfpte ueslt setmxmpio1olen nvslsfaruaump;u4texniocild sDrl(monu4 rtrxr iy1fp ranes;t sruoir oy1ll n ivtlt)srtmu ooo4tlx  iciyt m emnmp (0 ltnxr3iatfaDrln il(0t2trxmpio1oltn fcia(fs2rruronu0tltnio3iaslsDranvp u)treoxfcta1oatr i i;(0srxr(rpny1lp  lietls sDur( onu1ole  iciysla rl(vs;t0aeeoio oadlaD aivs (0teum(o3ou1lp nmncs t)s2uaxm ;t1tpx iicilslmDel(von(0arxrmociodfp elneo;s texrio3iydalt  fcils  2ur(rono4tleoif3tysfa2rm(vs u) etoxr3io1lpDeauvsl() 2xm(rpiy1ol n fvslt  2rmu  ;u4tptnmo3iadlsDrmnmpn(4 exrio3ty1lpD  uvslt0 rum(rpnu1aptemivs () Dtm(rpnu0oeen o3iltlm ra(mpnu) lxoxfctadlmDrluvs s)tetr(mpiy4am  mictl(  Drmu ooo4tlxnmfciaslmDel( o u)arermf oo1fptrauei;s)s2xoxopiodaltn ictls) Drr( o;u0tlxomi3tlsls uan o;t0trxnmo3iotoaDr uvo;t)t2um(o iy4oltnlicia(faDtm(mo;t1tlenmoeiadlm ua( pnu)artoxf todfmD liesl()teuo(m oy1openmncsl(fa2raurooo0olenifeils m2emnms u0tlenio oydlm   uei;s0s2urxm io4lmenmiet s) 2ra(mooo0teen oetldlm2eanvs (4 rtrxo3tadla raneslt texoio io4omee fcs s) rua(ro;t4opeomo3ildfm eau p;u0tlenmf iytla  livs;t teur(o3ny4opte fvtas)sruax o;o0tpt  icildfm rmnmp (4altrxr iy1fptr uvols  2uo(m3iy4op nmnvilt)s2rmxrono0oee moeiltfm rm(mo ()arxnxf3ty1fp e ivsl( srurxm oo1omtnlnvsas a2tmxr ;o0tlt  f3iadls rmuvonu0 etrxf3tytlm eli o;(  2uoim no1om n nei tfaDtaxroot4aeeo o3tls mDul( o;u0 lxnircio1omDraieilt texoim3nudllee neslt  Durur nu1tlenmo3tlslm2eanvsnu4alxoxfcoadlatelivi;t) 2um(r nu4lme mfcsas  Draum ou0olt ifetatfm rl(vs;t4trerif oodlmtr ivo;s sruoxmpnu4lme mneiasf Dumxmp;t1teeoiicias m2rlnmp (0aeeriocio1fa   ueo s) 2xo(o3nu4lme mfcs ( srraurpnt0alt iieiatfm uanvo t) ltomo oadfm rli i t0s2triopoydlpe lnes tfa2rmu pou1alxn oeilsfs ranmo;(4arxnir oytomtrlivs;( s2xmirpnodamt liciltf 2raxmp;o0aexn o3tys s eln pnt0areriociatlateln s;t)t2xoio oo1lp nmietat)srrrx oot0ole mietyslmDrl(msnu0 eerircootla e ies s0 rxo(r3iy4apte fct ( s2rr( pot0teen octysfmDrmu s ()tleoxociy1omDraieo s tetoiopiu4alee nes s s2taxm ;t4oeenmfctltls2ulu ont) exnio3io1opDelivs;t srtrxo ou1lmenlivtas)s2rmu pou0apxn ieils a2uluvs;u) lxoif oadlm e ies t)t2uo(o3nydaptelfesas)aDtr(mo;o4ape  feils s2ra( o (0arxoir3oatomDrlnei;( trtmim ny4oltnlncs ()s2raxm ;t0oeenio3iytlaDul(ms ()altoxf3oytomDe u o s) 2trio oo4apt liei sfaDrrxronu4tleo oeiadfsDem(mo t)arxnmoctydoatranes ( texmxrpio4ome lneil() 2raumo;o4apx mfeiytfmDemn p (0tltomf3oodoa eli s (0 2uoimpiudllt miesa(  2uaumo;u1altniieiatlsDran pnu) rxrxf3oy1om  aivo;s t2trxrpiy1oltemneia(f rururooo4opxo icild aDrlnms u4aeeomr3iydfaDr nvi t t2trir3iudlpen nvs s)a2uaur ou4alx mf3tadfm2rmnms t0 etomfcia1fpteln i t)teuoxr oydapt mivta() Drrxm ;u0olxnmieiasfsDrmumsn()aexnxr3io1laDe neo;s) 2toxo3iu1lm   fvsls sDuaum ou4aleoifciydlaDul(mp;(0tltoirciotomtrli o t)srtrxo3oudaltn nvi s)srum( pnu1tlx  icias a uan snu0artrxr ty1fa   nes s0setoim ou4lpt mies s  2tru p;o4aetoiietydfs rl(mpnu0trtoxo todlpt  nvs (  exrxo iu4olenlfetatfa2tmur ot4texo i3iasfm2em(vo t4trenmr oodomtean i ( t2umio ny4am n ieslsf rrmum ;t1texniictltfsDra(mp u0 ltnxrcoa1omt luvs;t0sexrio oo1om nmfeils) 2um(ront0olt mo3tasfa2ulnvo u) lxrxf oy1lmtr i s;s)srtmxr iudll n ncta( s2raur ou4tlxoio3iysls uanmo u4 ltomr3ty1oaDeaneol(0t2uoio3iodameemivi s s2uaurp;u1ope moeiatfa emnvo t)aetnif tadlaDrai s;(0s2xoxr3nodope lneta() Dua( pnt1tlxn ocias s2umn o;u4aetnxrctadfaDe ivs ()s2toir io1ameelnvilt srtrx  ;t1oet mf3tadla rl(mp;() rtnio ia1fm eluvs (0 rtoxo3iy4apte fvs () 2rmxr ;t1opeo ictaslaDumnvs;t4aleoxr3oy1om   uvolt0 2uoxo ou1lpt mfvtasf rraxr ot1ale  feiysfm el( ont0aexoio tytom elu olt0 rtrxr3nudlmenmivsas a2taxm no0tle ioeils mDel( sn(4aexrir oadfp e uvo ()s2uoimpnudap emnvsa()s2ta(mpou1texo feilslmDel(vs;t)trxoircty1faDr ivo t setmio3iydlpen fciltfarum(mp;o0ape  i3ilsfaDelnvsn(4aexnxo3todoaDelnvol( setoio nodapenlfvt (fsrtmurpou0tetomiciysfa eanmo u4arenxf oy1fateln i;()t2toirpiudalt  ict s  2trumpnt1tpxn fciad a2uluvo;t4aetnxrcoo1lpDean i;t) rum(opoy1openlici s)s2trxrpnu1tpeo i3tadlaDum(vs u4aexnmo tadlm ean i (0 euoio iydom n fvi t a2rmxr ou4tleniietysls elnmo;(4trenxo3iytom  lues;s)s2umir nu1ll  mnes ( s2ta(r oo4tptoifciltfm2eln o u)alerif3oo1fp e nvsls)tetm(r3no1omenlfvtl()aDtax  nt4aleomi3ils s em(vpnu4 exoiociydla  aivol()texmio nu1lle  fcias) rrr( ooo4opto ocild m ulnvo t0arxomrctadfa  lneo ()s2tr(rpoo4ape  iviltfsDtmu pno0apxomi3tls sDemn s;(0aetnio3oadoateaivs;s0t2umxopoodolte icias)srur(r ;o0aetn oeilt aDuaump;u4trerxr3oadlm  ln s;t texrim3oy1lm  lnvs ( srtmxr ;u1alt  i3iytla um( pnt4tetrif3ta1fp elnvil()srurxr oy4optnmnet ()aDra( ono4tpenioeilsfa emn s t0aetrmr oytla  luvi s  rumxm3nu1ape lici s  ruru  nt4oeeoio3tld mDrlumsn(4 rtoxr3oydopteln i t)tetrxmpoydaltelivt (f ruaum ;o4tlx  oeiyd sDrmn o (0tlerio3iotlaDeau sl(0srur(m iodam e feilsfa2rr(rp;u4apenmfctlsla um( o;t4aleoio tydfpDe i i;s teurxopiodole  feilsf Duaurpoo0tltniociasfmDua( p;(4 ltrif oydlat  ues;(0s2xr(r iodop emictls) rtrxroot4tpx iiciasls2em( s ()teenmo oytopDe iei;(0sruoirpio4ll n nvt s  Dua(rpou0apenioeilsla elnmp t0 rxrxr iatlmDr ies ()s2xoirpoo1om elieilt a2uax p;u1aeenifetas m2rl( sn() lerxf ty1omD anes t) exo(rpoodllte icia(f 2ur(monu4tpeniocils sDrm( p;() rtoio todfa eauvi (0 eumxo ny4apee fes s s2urumont4tleo ieiasfaDemnmp (0 etniociatop raivo;(  exmirpnudol nlnvta() rumxrpnu0altoiieiadla elumo (0 eeoxrciotlp  ai o;s s2trxo no4ll emivsasfs2tau ono4tptoifcildls2rl( p;t4 lxnxr3iotlatelneil()sexm(mpny1llt mfvsltfsrtm(r ;o4apto oeilslm2eluvp (4aexnmr3iadopD  nvo ( sexrim3io4alenmivil()sDraxr ;o0tpeo i3iat a ul( s;u4aeenif iotlm elivs;()sexr(r3iy1amtelnesl(f Drmx pnt4tptn ictas aDulnmp;(0trtnxrciodoa   n i s)trxrxrpoy4lm  mnesl()s2umxmpnu0tlto feiadfa2umu p;()tlenif iatfpt  ieolt0srurio iodlmtnlicta()aDtrxm ;t0aet iiciyt a2rlnmp ()aeerxr3oytlpDelivs;t) etm(m3iu4ope  ivia(f 2tm(mono4opeomo3iltfa eaump u4 rxnir ty1la e nvs s)teur(opnu1ape  nvtat)srurxmp;o1tpenmi3tadfsDelnvsnu) lxoir3oytoa  lues;s)sexrir3iudape  fci ( aDurx p;t1aeeo f3tys m2rln pnu4 lenif tadlmtrlneilt)t2um(m ny1aleelfet tf 2tm(r nu1olen i3tldlsDem(mp;(4altoxf oodlmtr ues;s0sruoir iodam  lieilt)a2uaurpoo1tleo ociytfm uan p;t4 rtrxo3oadfatrai o;t0srur(o no4lltelfes s aDrr(mpno1oee  o3iyt mDrl(mo;(4altnir tadlatelivo t) exr(m io4aptelneiat  ruax o;t0oeenii3ilsfaDrlnvonu4tetnmr3oa1lmDeaivsls0setoir3no1amee fes ( aDtaum ;u0oltoifciysfaDuanms;t0tltrxr3iatfpt auvs;()t2trxr3ou4apeemfcs s) Drr(rpot0tpt ifeiatls rmn snt)aetoxocoy1fpDr nvsls)s2tm(mpiudop emfcs t  ruru o;o1oexnmo3tadlsDeanmsn(4tlxnmf oa1fmDrli s;t)t2uo(r3iy4amt  fcsltfaDtr(  ;u0aetomieiyslaDrl(vpn()tlenmfctotfateliei;s s2xmiopoodllt licil(f 2umu p;u4ole iictas a ran p ()areoif oy1la rai ols tetoim ou4alenlicta(fs2ur(mp;t1oetomfeiadlaDua( o;u4alxrxr totoaD auvs;s  rumxm3no1al n ict tfsrrmum oo4oeeomieiadla2ea( p;u4 rtrxrctodlm raivi t seuoimpnudopee nvsat aDta(rpou0tee  oetyd m rl(vpn(4teeoif3tatfp elieolt seuoiopiu4lp nmfviatfa2uax o;o4oleoiieiatfm um(ms ()teerxf totla   u sl()srurxm oy1lp nmfeiat srraxmont4aex mf3iadlmDemnvsn()tlxrxocoytlmDranvs;t trurio3iy4lpe mnctltfsDurur nt0olxnmi3iydfs2em( s;t0trxrxo io1om  li il( srtmxmpny1ap emnvsas)a2umurp;u1tleomociltfaDeaumsnu4artrxo3ootoa e ieo t  ruoirpno1al e fes sf 2rr(mo;u1tpx mo3iyd mDrmn pnu4areoxr3todomD auvo t srxrxr nydlpe  nei (f 2tm( o;u4oet  ocilslaDemu pnu0 rtomf oytfaDe i o;s)sexo(opio4apt  fcsatfsrtmx  ;t4oex iociltfm elu snt0alxnir tatfmDr ieol( trtmir3nudope micil()aDuau  ;o1aetniiciltla uluvo;t4 rxnmo iodomDelnvols)trtmir3oodoptnlivsls a2um(m nt4opx  i3iatfs2elu o (0tlxnmo3ia1fm eau ilt  eurxo3iy1altnlnes (f rtmxmooo0tee miciyt s eluvo;()treomfctatlmDrli o;s) 2trio3ny4amtnlnei ()aDtmu pou4tpt mfctatfm2ranvont0trxoxo3ia1oa rlneo s0 rumxm nydlp nlivsatfs2umx ooo1alenmoctadfs uau snt0aeermrctatlmte uvolt tetrir iydlp n ncilt s2urxmpnt1aeenmfeiatls2rl(msnu4trermr3io1lpDrln slt)s2toxo oy1ope lics s  Dtmxmont0oet ifetldfa2uaums t4artnifctadopDrauvi (0trumxm iu1al e ncil(fs2tmx o;u0opxo feiydlm2uln p;u4 rtomr3iotfp  lnvilt)texoxm iodomenlietatfs2tmum ;u4tle  fciyt sDel(vsnt4 rtrir3ta1oa   ivo;t)setmxrpoodomtemfctatf Drr( oou1opeo fetltfm el(ms;u0treoir todoptraivo (0 exrxmpou4am nlieta(  rtr( onu1tpto ociaslaDrmn sn(4tetnxrcoo1lpte ivsl(0sexoxrpiu4olenmnvta( a2umxmp;u4oltnmiciltfsDrmn o;t0arxnmr to1oa eanvs;(0s2xr(r3ny1al n ivt ()a2rmxro;t0tlxo octas aDuauvp;t) lxnif oydopt li sl() rumir oydolt mfviltfarraumpno4tpenmfctltfs2ul( p;t0 etoxf3iy1fpDraivi;t  exrxrpnudop  lneilt aDtrx p;u4aexnmoeiydfmDemuvs;u) rtniocty1fptrlieilt s2xr(r nydlpee iei s) rrm(mpnu0teenii3ildfs2rl( p (4aexnmrcoy1fmteluvi;t) exm(m nudll  mivtltf Dtmumpoo0oleomietyd s eanvo;u0 rxnio to1fmD auvslt0teur(rpiu1ap nliesat)a2rm(  nt0optomieiydlm2emumo (0 exrxfciatlmtrluvils0s2uo(rpio4ap n nvi t aDtm(  ou0tlxoiictyd aDumumpnu0 lerxo3tatfa eanei s)teuoim no1ol e nvtl(  rtr(ront4ape mfciysfm2eanvon(4altoxr3iotlpDelieol()sexrxopou4openmicsa()arrax o;o4opx mo3iat a2uanms u4aexnif oydlp   i il(  rxr(opio1am  mict (farumxmooo0aet  i3iltlm ra(vsnu)aleoxo3oo1fp e nvo s)teuoxm3no4opeelfvtat)srta(mooo4tlxnio3tysla2ran o u4tlxnxf3tydopDeaiesls0s2to(o oy1ape  fcsls)sDtau ooo1olxoioeiltla2um(mo;t) ltrmf3totfaD  uvil() 2trxrpnu4ome lnvsls aruaxmoot0tet mf3ilslm2rlnmo;u)aetoxr oy1faDran il() rxr(m3iy4am elnvt s)sDrr(monu4opxo iciyd s ea(mp (4 leoxo to1lmteaieo;s0srurxo3oy4ol elnei ( aDtr(rpnu1aetomietysls2raumonu0 exrirctytop  ai i;s0setoio3ou4am elfviasfa2uaurono0ape  ieiad aDuauvont)tetomfciydlp   nvi t) eumxm iy1om  mnvt sfa2ta(rpoo1aee  ieiytfsDuln o (4tetoio3oatfp  luvi;t0sexoxmpiudoltnlfeiat s2raxmooo4alenmo3iydlm uluvo t0aetrxo oa1opt lnvo t0tetmxmpno4op n fctl() Dtmurpnu4oee mi3iltls um( s (4 etnxo iytoate ueo s  euoxopnudlm  livil(fsrumur nu4tex mociytfsDumnvsnu0alerxociadfpteanes;( t2tr(o oy1op nmfesat  rrr(roou1tptomo3tyd m2uanvsnu) rtnif iotlm ranvol(0t2xm(o3oodlm  mnctasfaDrmum no4apto fctys aDemnmo;u4texomf3ta1fpte nesls trur(o iy1altelies () 2raumpnu1optnmiciasfs2raumont4aeermf3oa1lpte i o;s)t2xmim iu4opt  iei ( arur(moou1ole mfciys a rl( ont0 reoif tadlmt aivols)seto(r3ny4llen fvta( sDrr( poo1texo o3iatfa rau s (4texrxo3oatlm  luvols sexrir io1lptnmivi t)s2ta(  ;t4aee ioetadfmDelnvsnu0trxomr tadfaDrau ol() 2xmxm oudom elfcia( arurxrp;u4aet iiciys s ra(vo;t4 rxrif3tydoatr ueo;t)trtr(opoy1oltelfei ( s2trur ;u1aleomfeiydlsDean pnt4trxoxo3ootomDelneslt0t2tmio oudameemnvs s aDrmu p;o0aleomfeiaslm2elnmo t) lenxocoydlm  luvs s0t2um(r ny1amtnlnvsl(  2umx  ;t1tpeoii3ias sDel(mp;(0trxnxf3iatfmte nes s0 etrirpnodamtemnctl() Duaurpot1apeniietltla elump u0arxrmr3tatfa  lues t0teumir oodomenlfcsas)a2rrx  nt0teeomocilsfs eau p t) etrmf tadfaDraivs;s s2tmxm iodlme mncsltf rrmxm nt4olxniieiydfm um(mp;t0tlenmo iodopt lneslt)s2trxm no1al  lnvta( a2urumo;t0tleoifeild s2ul( snt)altomfctytfmt anvsl( trtrxmpny4lpt  fetat)s2umu oot4apeomociasfa2rm(vo;()artnir ootoa rai ils t2uo(opiudopeelfet s)s2umu ono1alen ocils a uanvp ()tlenxo3iytlmD li i;s  ruriopnydamtnmncsat  rraxmpnu1oeto ociasfa ulu s () etnif3iytoateaivs;s0t2umiopiy4om nmfvilt s2urxmo;u0oetnmoctydlm2rauvp u)arenmo3tydlmD  uvsl() 2tm(m3ou1omt mnet (farrr( ooo4oex ifetldfm2rmn s u)tetnxo3oytla  auvo;s)truo(r oodop   fcias aDraumono1teen feils m ea(mp u4tltrxo3ootfaDr nvil()texm(m3no4lltemfes t)s2ta(r no4aeen ictlslm um(mont0tltrifctydfa e ivi ()sexmxm ou4ameemfeia( aDta( pnu0aexn iciadfa emums u4 exrmfciadlaD  u i;t sexoim oy1apt mnviltf ruaxr ou1open feiasfm2umuvsnu)aeerxfcoa1op e uvs;s0 exrirpoo4lpeemics ()s2tr(mp;t1aet mfctyt m ul(mont4 rerir oa1omt  i ilt0s2toxm3oo4lm emncsatfa2rrxmooo1aet iociyslm2rl(vp u0 lxnif3oodlmtraivil( s2toim nodlpenmnctl(f ruax  no1tpxo ieiaslm2rm(vp u4 etoxfctadlmtranvil() 2urim3oydaptnmneil(fa2tmxmp;t1oex  feiys aDrl(vs t)artnmf3iotoaD lnei;(0setoxo oo4lle  ivi s srtrx pot1tlt  ictld a2rlnmp;u0 lxoxo oytlm eluvslt) rxoxr nodol  liei s s2ur(mpnt0teeo fetadfa2eanvpnt4 exomocta1lmt lieilt) 2xr(mpnudolee fvil(f rtmx  ou1oetn fciasls el(mo t4 exoio todlaDelnei;t  2tr(m oudolee fetlt  2urxr ;o0tleo iciat m2ea(vp t4 rtrxf tadfaDe nvs s0setrio3oy4altnlfvi ( a2trurpno4teto oeiltfa ua(msnt)artoircta1op   ivils teum(m no4lp emiei () Drmumo;o0aetomietytfa2ra( snt0aexomf3totlpt aieslt)s2urxm3no1lltelfcilt  rrmuro;o0apxoif3tysls uanvpnt0treomr todla rlivo t)trto(o iydlle lncsa(fsDurxro;o1ole iocias m elnvpnt) ltoircoo1fmD  u s;s0 eto(m oy1lpe miesa( s2umurpou1oet ioeiaslsDua(mo ()treomfcoa1lp rlu ols) etoir3iodamee ict tf 2uaxm ot4oetoifciytfm rmn o;(0texnmf3iotlp  luvo s s2to(r ou1lmee ivi (farta(  oo0opxnmoeild mDua(vp;t)texrxr3tydlpDrauvsls0srtm(opny4lpt  iesasf Dra(r ;u4teenifctadlm rauvs t0texnxo iy1optr ivi t) rxoxo3nudap emnvtasf Dtmxm ;t0opx ioeiadlsDran s;() ltrif ootlmDe ivs ( trxo(o3ou4lp emnei t  Dumumo;t4opxoif3tatlaDuln p t)tetrmr ty1lp r ieil( seuoxo nodam  lfci s  Dumxrpou0oee mociltfa umnms t0tlxoio oydfm  luvils0 2xr(o nydlm e fei s  ruaumpoo0oeen o3iytlm rau p;()aeeoxf tytlpD anei (0 2to(opoudlm emivslt aDtmxrpno1tee  feiad a2em(vsnu0 eermr3iodoaDeanvils)seuo(mpiodlp nlivsa( a2umxro;o1alt iictytla2ul(mp t0 renxf3ty1fa r uvs;(0 rtoxo nu4lmtnmivilsf 2rr(  nt4teeoiociat s2elu o;u4alxoxfciodoat  u i;s0srxmimpou1lleeliciat) rtr(rp;o4oetnioetltfa ua(mo t4 rtnmr3iy1opDe nes t)trxmirpio4altnmfcs s  2trumo;o1ale ii3iadla2rmuvo u0altnmrctotlaDeaivi ()seto(o oodop  lnet t)aDrrx  ot4aee io3tasfmDelumonu)arenmfciatlmDrlnvs ( sexmiopoodolte ivta(fs2trur ot1tptn oeiysfa rlump u4tlxnxr oatop r nvi s  2tmio ou4lm   fet sf 2rm(mpoo1alto o3tyt a emnvo;t0aexrir iydlp  an o s s2umio3oudlmee nvtas aDtaur ot0oeto feiaslm2eau onu0arerif tadfa eanvo ()sruoio3oodlleemfcils) Duaxmpot1ole mociltla2ea(mp u)artnmr oytlmtrai s ()s2toxo oydom n feil( aDta(m oo1opxomoeildlmDel(vo;u0teeoxo3oatomtraivslt)srtrir no1ope  nvilt  Dum(mpnu1alt ioctlt m umu s ()arxnio3tytlaD livs s  ruo(m3nu1lpt  fesat)arumum ;t0open ociat m2umn s t4 etnxf io1fmt  u i;t) rtmxr3nydlleelivta(  rumurpoo0apxniietyd m rmn p;(0arenxr3oa1oaDeai s t)srur(r oudalt mivs s aDtr(  ot4ape  icils m emn o;() etrxo3ia1om elu s;t s2umir3iy4omenlfcsa( sDra(  nu0oltoifctat m rau p (0texnxf oo1fmDeaueo s0 rtmxr oo4lpt mnvsat)a2rax pot1oleoiieiadlsDeanmonu0tetnxo oo1fa  aues t0s2tr(m oy4lltelfcs s srrrx o;o1altomoetat s uanms t)aetnmr oatop elu i;s0trumxrpio4omte netasf 2rmumo;u4opxnifcild a2ul(vp;u)tlxrmrcootfa  lu il(0 euoxm ou4opt lnvt () rumur ;o4oeenmfciat aDuln s t0aleoxr3iydom  lnvilt0 eur(m iy1aptemfetls sDrrx p;t0opx ifciltls umn s t0arenir3iodomDran s t)trumxopou1amenlfvta() Dumu o;t4texo iciat s rauvs;t)arenir iytfpDr neo;s  rtoxr3oo4lle lnct tfsDum( o;o0aptomfcildlmDemuvs;()areomr oodlmt  u o s)sexmxr ny4am nmnvt t)srtr(mpnt4tle moeilsfm2uln ont0 lenxrcio1optrau i;t0trxmimpoo4lltnlnvta(fa2ur(mp;u4opeo iciytlmDeln p u) lxnxo3oydlm r ieolt s2tm(r3no4lleelfvilsfa2taurpnt1apenmo3iadls rl( p t4 ltoir oa1fmD an il()s2trxrpoy4oleelfctas  Dumumpot0olxniocilsfm2um( onu4 rtnir iodfaDrli i (0trurirpno1ll e iciat) rtrxr ;o1tet mieiys mDrmnvs;t)alxnmr3iadlmte nvil(  eum(r nodapt mnetat arurur ;o4aexomo3ias sDrm(mp;u0aexoxrcia1lpte nei ( sruoxr ny4lpt mieil()srrrum ou0apxn oeiytfs umnvp;t0alxoxfciotlp rluvs;s srxmir oo4lpe  icsa() Duau o;o0apt ifeilsfmDulnmo;()aleoif3iytlaDrlieo;(0 etrio oydaltemfei tfsrrrxro;o0tetoiieias s2umuvs t0 leomfcia1fmte nvols s2trir3iu1altn neia(  rua( pot0tpxnmictatlmDuanvon(4tleomo3iatfpDraieo t)t2xmxo3nu1lm  mnetl( aDurur ot4alxnmfetltfs elump;(4trxnmr iodlpDe uvs t trxo(r3nudop e nesa(f Durxmonu4oexoii3tysfsDua(vo;u0aeenxr oo1lp rai s;s)t2uoim3oudlpenlnet sfsruru  oo4aeeomociysfm rlnms ()trxnmf ta1op elnvo () 2xmimpnydalt  ics tf ruaump;t0texoiociasfa2umnvo t0 reoio ia1fpt li o ( trxmir iu1altemnct sfs2taxrpnt4apt  o3iydfs2el(mp (0tetnmr3oadoptrauvo;s)t2toxm3iudomtnlfetas  Dtaxmonu4tex mfcildls rmuvsnu) rxoxr iy1lp   n s t truriopoy4lp nlnet sfs2umxmoou4alen oetyt m rln p;u4tlxrxocta1lmDe neols0seuoio oudap   nctl(  Dumumont4oetn i3tytlsDrlnvo;t0 rtoif3oydfaDeln s s texrxo3iydopeelfvia( arrm(r oo1teenio3iyslm umnmp (4arxrxfcoytfpD  iei;t  rtmiopou1lmtnlfesls  2tauronu1tlenmieiat m2ea(vs;t4aetoxoctydlptraivi t s2xm(m oy4omenlicsls) rrrumooo1tet moetasls uan o t4trtoiocto1latrluvils)srxmimpoo1lp  mncsl() 2ur(r oo1teenmfeild a2elnvp t0aexnio iydfatr i ol(0 rto(r iu1om n fvi sfs2tmu  ;u0tlt iietydfs2ea( o (0aexoxociytom raues;t s2trimpoo4om e fct t)sDua(r ;o4oeto fcils m2rmnmp () exoio3tydoptr n i;() 2xo(opnodll emfcta()aDraur nu0oexomo3iytlmDuluvpnt0tlxrmocoadfptrlies ()srxoio no1omenmnetlt)s2rru p;t4apeoii3tysls2uaumon(4 eermo3todfatelneolt setm(o3nu1ope  ictltfa2rru o;u4ape io3tlt sDeanvo u4aleomfcoo1fp  anei;s)sexo(o no1lle mfcsl(f Dtm(  nu4altnioetasfmDumu s t0artrio3iadlp eaieilt) 2tmio3iodlle mietl( sDumum ot1optnmieils m2rmn sn(4 rxnmr oadoa  an ilt)t2tmxo3oo4op nmivta()s2taur oo1opxniictat sDuau s u) lxoxocoy1fmD an s t0t2umio iy1op nliciltfs2rrxrp;t1tpxnmfciadla umn o u)artoioctodfat anvo;()seto(r3ny1aleelivi sfs2rruront4tptnioeias m ua( s u0tlxnxrciotlpDeaieilt0 2urio oy1al elictlsfarumxmp;u4tlx iociyt m uau o;u)alenmo3oodlm  lieo;s0trxmiopiodamee icslsfarrmxm ;t1tpx mo3tas a rm(ms;(4aexnmfcta1om  lnvo t  rxmxr nodolenmivsls) rrrurpno4ole ifeiydlaDul(mont) lerif tatop rluvi;t0teum(o iydlptnmnctat sDtmxm nu1opxoifcildfmDemnvp;u)aeerxo3iodlmt an sl(0 exmxr3no1lmee fviasfs2rmur ou1aptomfctyd a2eanmpnt4trtrirctatla e u ols)teuoxrpoo4omt mfvi s) ruaxr ;o1texo ieiydlmDemnvo t) rtomr3tadfaDrau o s) 2toim ny4al n ieils sDrrurono1alxnmo3tlsfa2umumo;t0trtnxf3oydla eauvils  rtrimpio1al   iet ( s2uaxrp;t0oetomfciytfs uauvs;()alxrmr3tydopteauvs t0teuo(r oy4olenmfcslsf Dtm( o;o4tex  i3iadfaDem(mp ()texnxrcta1fmD aiei;t texmio nu1opt  neilt  rta(root4ale ifeilslsDraump (0trtnmf3iy1omt au o;t0 etm(mpiudam   nei (  rrrxrpot4texoifciat a emn p t4 lenmf tytfat lueol()srxrio3io1llen fvias sDuaump;t0tpenmieiatfa umuvs u0 lxrxr oodlpD  n sls  etoimpiy1amte ncsasfs2tmx p;t0aee mi3tltfaDel( s;t)aeenmo tydomt lueo s0trto(r3iydal nlnvi t)a2uaumo;t1oexnifetysfm ra( p;()tetoxo iy1late u ols)tetm(m oo4opt mfcils) rurx o;u1olto octydlm2em( ont4 eerxociatla r ivo;s0tetr(o3oudlp elfet () 2rmxr ;u4ope  f3iad sDum(vs (4 etoio tydop e u s;s s2xoxm3oy1lleemnvi tf rra(mpnu0aex if3tld s2ranvpnu4 etrir3oodfm  aiei;(0tetr(o3no1lm nmfetl() rtr(r oo1tlxo o3tldls2umuvp;t4tetnmoctodopDraueilt0sexoimpno4lpe lfeil( arum(mont1apeomfeiad mDra(vp;(0aeeoiocty1fmt lueo s trtrxmpnodal elnciat s2uaxm ou0aptn o3iydlm2eanmp;t)tlxnmfcoadfmtrli il(0tetrio iy4alt  fes t arur(mp;t4tpenmf3ilsla2uluvs;() lxomf3tytlp rluvslt0teum(rpoo1llenmfvi s)a2tmu poo4tptomf3tas sDuanvs;(4 rxoifcoytopD lu i t)teuoimpoodom emfvsls)s2tr(rpno4olen oeiyslsDemu o t0aetrxfctodlptr ivi t)trur(o no4lm  mfvi s)sDtmu o;u1aptniictld m2uan o (0alxoxocta1oa e i i;s)sexmirpio1lmenmnctasfa2tm(mp;t0tle moctlt m2emuvpnu4tlxomr3ootlp elu o;t  2tmxrpoo1lptnlici sfarumxm nu4tpe ioetlt a2umums ()altoxf3oatop   n s;s0s2toim iy4lltnmieta(  Dtmum nu4oleoifeiltlsDemn ont4 lxoxf3io1fmDrlu i t) rtoio3iy1ale lnvt s  rumu  no0opeo f3iltfm2uanvo;u)areoxrciotfp r ivsls  2xr(o3io4lp  mivsls)aDur(ro;o0aleoioetasfm elu s;u) ltnxf iotfmtrlnvi s)seurio ou4ap n fet t)srtrx p;u0oetnmo3ilsfa2eln o;u0 etomocia1lp e neo;( s2to(opno4opte ivs s)s2rrxrp;t4tlt iieiydfs2uauvpnt4 ltrmr3iytoatelivi;(0setrxm3iudlp   ivtlsfsrtrx p;o0aptn ocilsfm2ulnmo;t)alenxo iatop   ueslt)t2xmxmpnu4alee neia(f 2ur(mp;o4tle miciydfm2ua(vont)tltnmf3tytomt lnvsls) euriopiu1lp n nciasfsrua(ro;u1tle iocildls rlu pn(0 rtoifcoadopt livilt t2uo(mpio1lp e nesa() Drmur ot1alt  oeiytfa emums;t0trtoxo3oa1lmDeluvs;()sexoirpnu1aptelivias artr(  oo4tet if3tlslsDraumo;(0aleomrciytopt an i;(0 rurir3oudomt mnvsa( srtrumpoo0aetoioeilsls2rmumsnu) exnmfciydopt  uvi;t0 2uoxr oodllenlfctatfs2trumont0tpxnmi3iysfm um( p;t0alerxr3tadlmDran s;s0texr(rpno1lm n fes t)s2ta(mooo4tleniociatfaDuln snt0trxniocoydfmDe uvs;t0texmir iudamee nctlt sDtaxrp;o0tptomfciys mDel( p t0arenxr3tytopDraueo ( t2trio iy4apen ictl()arua(r ;u4oex mocilt s ua( pnt0trtoxo3oy1faDrai s s0tetrimpiu1lp e ici ()s2tmumpno0tex ifeiatfm2emumonu)tlenifcty1opDrlnvilt0trurxo3iodam elict ( arraump;o1altnmi3tad mDrl(von(4tlxnmr oatoatrauvilt trumxo3iu4op n ivs s)aDuau o;u4olxoio3iadfmDemn p;t) rxrmfcootlmt aivo s) etm(mpou4amtemictltfa2urumpno0ole mi3iytfm2elu ont0 ltriocoydoat ai o;t s2xrxo3iodop n ivtas  Drr(m no0opt mociytfsDeau s;(4 rxrxf iotla eli o ( srtoirpoo1opt lnvsl(  Dtaumpou1aexoiocilsfsDumn s t)trtnio3iodlaDelu ilt)trto(r3io4oltnmncslt sDuru oou0olenmo3iatla rm(ms;t0teeoxociodlm eaieslt0 rxrxr3io1amen nvi ()sDrmx p;o1aptomfeiyt aDuaums t)tleoxr oo1fmtrli olt sexm(r3ny1alte nvs (farraxmpno4olxniocilslmDumn snt0 renmo3iadlm rlies s0seurxmpnydalen nci t) 2rmu poo1tpx  octyt a2ulumsnt4altoxr3iy1oa rlnvol(0t2tmxr3nu4ap n nvt s a2rr(rpnt4opt ioeilt sDum(ms u)alxrxo iytfmDe uvs t  rtm(o3io1amtnmivtls)artmu p;u1apx moeiydlm2umn s;u4 etrxo tatfptr i i s  2um(opio4am nmict sfsruru  ou4oet iieiysfaDrmn p;t0altrir ia1lmD anesl( trxrxo no1llt mnctltfsrurumono0oee io3tyslm2rl( o;t4 ltrxf iatlm elnesls t2xrxm3iu4omt  fcia()srrrumoot1oex ioetadfaDumu p;u)altnirciatfa elnvil(  rurxo3io4lp nmnvtat) Dtauroou0aleo o3iytfm2uanms (4tlxrmo iodfmD lieils0 2tmxr3no1lpe  nvsls)srtr( oot4tleomietatls2rm(vs;u4aexoxf to1lm eaies;s)srtr(o3iudam emfet sfs2ur( o;t1tltoioetydls2ua( o;()trxnifcoo1oaDe u o;s) 2umiopny4lmtelivt s)arrmxr oo0aexoio3tyd a elump (4 lerif tatlp  lnvsl( s2triopno1oltelnvi (  2ua(r ;o0aee  i3tlslaDulnvs t0 ltnir iytlp r ieolt)trxoxmpoydllenmivilt)sDtmx  ou4aptnif3iatlm emu p;(4 rtoxo3oytlaDean ols0 etmxo3nydllenlieslt s2rru o;t1oexomf3ias m2um(mp u4tetnmo ia1lmt  uvil() rtrir nodlmtemivsa(  2rax  ;o1tpe mi3iadlaDean p t4alxoxo oo1omDe ivol()srum(rpny4lpe mivtas arumxm nu1altnmoetlt s emnvp t) rxnir iotfpDe ivsls s2uoirpoo1oltnmnes tf 2trxrp;o1oetniociysfsDrmnvs ()tltnmo oy1opD lueo;(  exm(r ny1lmte feta(f rurumpnu0tlt  f3ilt a2rl(mp;t0tlenxrctadopD  uvi;s setrxr3ou4altemfctlt a2rrurpnt0apx mfetysfm uan pn() etnif oa1lmDr i o ( t2xr(m nydlptelictlt)artr(root1tlt  i3iadls2um(vsnt4 leoio3oydlmte iei;t)setoio3iu1ll   fcils)sDuru  no0tpenmiciaslm ulnvon(0 leoirctodfa   n sl() eurxo3nu1am nlfcslsfaDrmxm ;o0tee  f3iyt mDeluvsnt4arxrir oa1oatr n sl(0srxoimpou1om   ivi t  ruaum ou0alto fciytfs2uanms ()arxnmo3ta1lmD  uvilt0texr(mpoy1altnmictl(faruau  ;u0apxoiieiyt a rl(vpn(0 rtnmfcoa1om  aueolt)srtmio iodamee ieta(  Dumxm ;u1ape  oetadfm rmuvo;u0teermrctodoaDraies;s0t2uo(o3io4opee nciat) Dtm( ooo4olen f3tlsfm2rlumo;(4 rxnmo todlmteli il()s2xoimpnu1al nmneilsfaDtmumont0tpxo ieiadfa2rmnvs () rxnirctatfm elieo s)texmxo3nydaptn fcslsfarrrxm ot4aetn f3iydfs rln o t0 leoxrcoydfp   iei;s s2trim iydlm elivsatf Duauro;o0apx  fctysfmDrlnvo;u0tlxoxo3oa1oaDran sl(0 2xm(rpiu1ame lncias  2ta(  ;u4apt  ieiltla2umu snt)tlxrifciytlp  ai sls)t2ur(o3no1ope  nctlsfaDtaxrp;u1openioeild s2uau s;() eerxfcia1fa e ueslt)srtoxrpiy1lm emfcia(fsrtm( o;o1tle ii3ils s umnvo;(0 rerirctydomDe n o;s) 2tmio3no1lmte nesa()aDtrxro;o1aexoio3iadls2ua(ms;u0 eermf oadfpDeau o (0 rxmir3io1lmeelnctl(fs2umurono0aex  oetldfm2uanmp;(4tltrmr3oydfmt ai o;s0 2tm(o3iodll  licia(fsDtmxr nt4aet  fctyd a ulumo;t0trtnircoatlmDeaivo;t) rxrxo iu4lpee fes (faDtr( pou1oexn oeilslm2rauvsn(0aleomr iy1omt  ueo ()texrxm iu4ole lncta(fartm( pot4tpenifeiydlaDemuvpn()trenxociy1lpDeln slt0teum(mpno4lm emfctat aDrmx o;t4tet ifeiatlmDua( p;t4altomo3oo1lm r u ilt sexrxm3nu1ll elietlsf 2rmx o;t0oeen fetldlm2raump t4trtrmfcootlateau i;s sruoimpou1op  mnetas a2trx oot4ape  feiysfsDeau o u4 eenxrcty1fmDeluei;s0srxrxo iudalt  fei t  rrm( p;t1opx ifeild m um(msnu4trermrctadlpt  ues;t0texr(o3io1op nmiviatf 2umu  ;t1tet if3ilsfaDulnvo;t4artnxr oytfmt au sls0s2uoir3no4op e nvs s  Dtaxr ;o4aptoifetysfm2eau p;(0 rtnircoo1lp  livi (0 rxrxo3nu4lptnmicsl(f rrrxrpou0apeo o3ias a rln o u0trxoioctatlpDeau ilt seumxopno1al  lnei t)sruaxmo;u1teto oeilt m2ra( on(4aeenmociy1fp e ivs ()trto(o ou4apte nvtls  Dtmumpnu0texn oeiltfm rl( snu4trerif tadlaD auvo (0trur(r ou1al nlnetltfsrrmur ;o1tlt iieiytfm rm(mo t0tlerxo oytop  lneol(  2xo(opoo1ope  fesa(farrm(rp;t1ole ifctytls2em(ms;u0 lxrxo todlm e uvo;()teur(opny4lle lnvia(fsDum( ont4oleomi3tls aDrau p;(0aeenmr3oa1lm e u slt)t2trirpiu4al  lfctl()s2tm(r ;o1aptomfeiytla2rmnmo (4tlxnircto1latraieil(  rtoio3nodalenmfcia()sDtaur ;o0oeen o3iyslsDul(vs ()areomfcoatlm   n o;( s2um(rpiy1ap n fvtltf Drr(  nt0oltnmoeildfmDrmnmp;u4 lenir3todlpDeaues;s0 rtoxr iy4amen ivs (farraxmo;t0oeenmfeiltla ul(vp (4tetrmocia1fpDelieil()t2ur(o3oydoptelnctlt arra(  ;o0tpe mf3tlslaDul(vp;u)aexnir3io1fa  an o s trxoir ou4open nvt ()srur(m no0tlen octls aDranvs t)areoxocio1fa e i o;( s2xm(m3oo1al  lfvsat  2ururpnu4aleo f3tltfs2em( s t0arxrmfcty1omt auei;() rxoxo3oo4omeemnetltfsDurumoot1aex ioetyt s2ulu snt)aeerxf totlmD lneo s trum(o3iy1altemfcsatfs2rrx poo4tpxo o3iydfs ra(mo;()trxriocoydfmDelivs;() exrxr ou4ll elivt (fsDtmum ot0oetomicils aDulu s;()alxomf3io1lpD an slt setm(opnu4lm nmivs t  2ta( o;o0oex  ociadla ea(mo (4alerxf3tytfpD  neo;(  2trxo3nu1ap nlieiat)arrau pnt1texn ocias aDul(vs;t)aexrir3iatfmtraueols0texoxo3io1om n iesatfs2urxro;o1alx  oetldfa2ulnvont)trtnxr iodlptraivslt)srxmxrpnu1opt mfvsl(faDrau  nt1oexoifeilsfaDrln p t4tetriociytomDr iei;s0 eto(o3oy4ol e fvta( sDtmumpot4texo ietltfa emuvo;(4 rxrmo3oadlpt ln s t)srumio3iy4openlnet s) 2rru pnu0tpt  o3tytls ulnmo u)aetrxf3iytlmDraueslt s2umim iu1apt mfetat  rur( onu1tlxomi3iltlm rm(mp;u)tltomr tatlm rlu s;s tetrim io1llen nvtl(  rumu onu0oexomf3ias a ra( o u0 etrio ia1omte ueo;t)s2xmxr oudlp n iciasf rtaxmp;u1opxomfciys mDemnmp;t4tlxrmfcoadopteaneilt0 2trio oy4opeeliesl()sDumurpot1aeen fetatfa2ranms (0trxomo3iydla  lnei s)setmimpiydopt mivsas arraxroot4apeomo3tatfs ul(mp;u4arerxr3iadlatelieilt)s2xo(rpoy1lp elfetls  rtrum ;t0tlxo fciasla elnvo t) etrmocta1op   uvols0trum(m oy4oleemfvsl(  2tru pou4opxnmocildfa rmu o u0tlxnmr tydlpDelueo;s0s2tm(opiu4omee iesl(fs2rrumpoo1apxoif3iys m2ra(vo;(0tlxrir3todfptrlivilt0seurim3io4amtemfctl( s2ta(m oo4altoioctldla2ul( o u)alxoxo iydfa rlneilt0 eurxm oodol   nvs s a2rruro;o1opxn oetlsfa2eanvpn(0 eeoxociodfmDeai o;t)s2xoirpno1opt mnvs s)arrmxrpot0teeomiciysfs rmnvs;t)alxnxocta1lat auvo (0seumio3iydapt mfet t) rtrxmono4alxn o3iasla elnmp;()tltrmfciodlp   ueils0teuoio ou1lptnlnet t a2taxm ;o0oeenmfctydfm2elu pn()tetrmf3oytfate u i s tetoxr3no4ome licils)s2taxrp;t0tlxn i3ilslsDean p u0 etoxf oodfmtelu ols0sruoxm io4alenlicsl( sDta(rpno1opto i3tlt a umnmont)tltniocta1om  auvil(0t2uo(r3oydlpenlnes ()s2tr( pnt0tptnmfetysfm rmuvp;() exrxo3oodfpD lueo t0tetm(m3ou1ll  lfvtas  rraumpou1tlenifciyd m2eau p u)aetrmrctotfp  ai ols texoio3iy1lmtemici (faDtmxm oo0oexnmfeiatla2el( o;(0arerxrciadom r ieo t)srto(mpiu1op emfeias  2umxr ;u0alt mfctydfmDrmn o;u) reoxf3oo1opteauesls)setoim3oodam  mictasf 2rmxmooo4apxnifetadfmDua( s ()artrir ta1oa elu sl(  rumxo3io1alteliciatf 2trxr ou1tpxomieiatlaDrauvs;u)trxoif3tytfmte uvo;(0t2xmim nydop n ies (  Drrur nt4apto f3tldlm rm(vo;u4treoxrcoydomteai i (  euoxmpoudap  lfeil( srraxmooo0aetn f3ildfm ea( p u) rxoxf3ty1lpteanei s)t2tmxm iy1optnmfvta()artm(r ;t1opxomo3iytfs2um(vs u)aexnxociotom r u il()tetm(o3iu4oltnlivtlsf Drmxmpno4teeo oeiatls emnms u4 lermfciodlpDelnvi t0srxo(o no1optelnvtl(  2ua(  no0optomietldlaDum( o t4tltrmo iytopDr ivs;t setmir3iy1omtn feiltf rumx  ;t0alenioeiat a um( pnt)trxrxfcoydfm rluvi s0trtoxrpnu1alenlfesa( sDtmxr ;t4tle moetltlsDrl( sn(4 eenxo ia1fatr ieilt trxo(opio1omeemfvs ( s2tauro;u4olxn o3ils a rau on()tetrif3ia1oa e n ilt trtr(rpiudal n netat)a2tr(mo;o0teto f3iytla2eau snu0tltnir ootfpDrlieol(  etr(r3ou1apen fvia(fa2tmuroou4tpxoifeiatlsDrln p;u0aexnmr3to1omDrauei;t t2xrxrpoudoltemieils)sDur(root1oltn o3tasls2um(mpn(4 exoxo oo1fp rau ol( t2uoirpou4ole mnesltfsrtrxroot0optoioeiltfs eauvpnu4 exrmo oadlmD  n o s0sexrxm io4omenmnvs (fa2rm(r nt0apen oeiysls2em(vp t)altomr3tydop rli s;s texoir iudamee nvt sf Dum( pnu1olen fetysfs2ea( o u4teeoif tadfp eauvols0trtrxr3oudomen nvt tfs2tr( pno0ale iiciat a2el(mon() rxoxf oadfatranvi t0teto(mpiodlm n net t a2urum no0ope iicild s rl(mp;u4tleoio ootoaDe n o ()s2xmir3io1oltemiet t s2umxmpnu1aexn ociatlm2emu o u0arxomf3ta1laDrlieo ()texoim3oo1op elfcslsf 2ur( onu4texo ietyt mDulnms;u)treoif3iytfp rai o;t trxoxrpoudlpt  iesa( aDtrumonu0optn oetad a uau p;u)teeoif3iydlp  aivi t0sexoxm3nu4ap n fvi t  Drr( oot4alt ifciytls uau s u0areomo3tytomDe i ils)t2uo(opiy4ll e fet t sDtrurp;t0tpeo fctytla umuvp t)aexoir3tadlpt ai s;(0 2tmirpiodaptelfctl() Draxr nu4oeto feiasfs ua(vo u0tetrmfcootomDrluvs;s0seur(o3no1omte fesls  Drr( pnt1oexomoeiltfmDulnvon(0aexoif3iodoat lnvi;t0 2umir3oo4olen fcs (fa2ur(mpoo4apeoifcildlmDumu sn(0 rxrxfctadlptrau s;t0 2tmxmpiu1openmneiasf rraxro;u4alxo ocilslsDrl(msn(4 lxnmf iodfmt  uvi;s srtoxm3iu4lmt  ncils  Dum( ooo4tpxo o3iasls emnvs t)trxoir totoate ies s  rtr(r3no1amtnlfcsl()srua(root1tetniocilsfa ranmonu0arxnmfctydfa e uesls setr(o3iu1llen neiatfaDuaxro;o0alt  ieiatfm2eauvp;u)tltoxoctodomD  neol(0trxrxrpnudlmte feiat srtruro;o0oleomf3tltfmDum(mpn(4 rtrif3tadop rlu o;t0seumio oy4omenmivtas)arrmxr no0apxnii3iadla rau o u)tleomf iotfptelivi;(  rumxrpio1lp e fcils s2rr( o;t4teenmiciydlaDua(mo;t4artrxr ty1fmtrlneo;s srxmio nydame lnesa( srrru ooo4aleo iciatfs rmnms t4tleomr3oydfmDrlies t0 2xrio3nydaptelfesa(  Dtmx ono4oetoiieiyslm2eluvo u4tlenmo oodfpDraivi s) 2xmxr no4omen nvils)aDuaxmpot4aeenii3tatfs rm(vs;(4tleoxoctodla ean ilt seuo(m oo1aptelnctlt s2rm(rpnu0teeomociydlm rmumon(4teenir3io1oaDrai i t trxoxmpoo1omtnlics s a2tmu  ;o0oeeoii3iadla2el(mp ()aleomr oodopD lu olt0t2xmxopiodll eliesl(f rum( p;u4aetnmf3iatfs2ea(mont4 eeoir3tydfa  anvo;s)setm(o oydam n ivslsf 2trxmoot4apx  fciat m2rmu on(0 ltrxfciydom  anvolt0s2ur(r3oo1omeemfes s)a2taump;t0opt  feiydla ua(vpn() rxnif tadlp elnvo t t2xmirpnydllt mnvta(fa2tmxmont1oleoif3tysfm2eaums u)tlxomo io1faDranvo;( trurim oodop nlfvt ( sDtaxrooo4tlenmfeilsfs rmuvs ()arenxo3oy1fmD ai sl( t2um(opoy4aptelfvi ()artaumont0tpeoifctlsfsDuanms u)tetoxr3io1oaDe nesl(0s2toxopno1ol nlieta()a2rmum ;t1opt  o3iytla rluvo;(4tlenifciadlmDr uvsl( t2uoirpny1apeemfvt (f rtax oou0opeoio3iaslsDrm(msn(4trermr3oydopDr iei t) ruoxr iodlm   ivtatfsrra(mp;t1tlenmf3iysfa emuvon(4aetnxrctadoatrlivi;( setrio3oy4lme mneia(faruaum ou0aeeo octys mDumn o (4trtoxfcio1om raivi;s)texm(o3iodomeemncsl( aruax oou1oetoioetld s ua(mo u0aeeoif ia1fat anesl(0sruoiopou4lp emictas)srrrxroou4aee mfcilsfm2rauvp;(4 rxoifciy1lmDranvi;s  etr(o3oy4lp  lfctls)s2rmxmo;t0opx iiciytlaDra(mon(4treoxf oytoa rauvilt0teuoimpiy4llt  fcils  Dtrx  nu4aleomo3ils s2uau o;u4artnir3tytomDeli slt)truoim3iu1omtemncil()arurxro;u0optomociadla2em(vo;u0 ltrircoydlpDrauvsls0texoirpiy4altnlfct (fa2rrxmo;t0tlenmo3tlt sDrmnmpn(0teeomr3iatfat luvo;s0setr(m iy1lp   feiasf 2uru ooo1olxomf3tlsfs ranmon(4aeeoif tadfm eluvolt0t2xrxmpno4ll nlnetls)a2trxmpou4aptn o3iytlsDeau pnu)aexrio oydfp eanes s0 rxoxopnydlpenlivs tfartmum nt0oeen oeiyt m2uaump (4 rermr3io1fat li o;(0t2tm(rpio4llt lnctlt)s2rr(monu1oltnmo3tldla2ea( o (4arxrmr3oytlptr ivils0seurxm3nodapee icil(fsrrm(mo;t0tpen oeiys a2uluvpnt) exnxo ta1op rlu ils teuo(r3iydome livt (faruau  ou4opxn f3iydfa ua(vsnt0arenmocoydfmD au i;s)srxmir ny1lm elfvs s arrrurpou4oetoiieiyslmDraumo u4 renmrcoytlat li slt0t2xmim io1lpe lfeiat srtmxrpoo0olxomfeiytlsDua(mpnt4 eenif3totfmDelnvs;s)trxrxm oudolte nvias) rur(r ;t1tleoifeilt m eanvont)aetnir iatfaDraneol()s2umir3oy1lpe livtl() rtmu  no0oex mfeiytfa2ul( onu0teermo iadfmD li sl()sruoxo3iodlme  ivtl(  2ur( pno0olx ifcildla2rm( s (0trtrxr iatlpDr uvs t  exm(o nodome mfvsasfa2tm(  ou0oet  feiys a2emums t0trtnmr3iy1oate n o;s tetmxr3nodll e fvsls)sDrrurp;u0ape iiciltfsDem(mp;()aexrmr oadfatelnes (0tetmxm3no1lpeelfcilt)srra( oou0teen iciadls2rlump;t0 rxrmocia1oaDrauvslt texr(m3nu1ome  ivta( sDraum nt4oltoiiciasfm2rmn o ()tlxrif oytoaDraivs (  2trxrpio1omeelnetlsf rua(mo;o4aetnmo3iysfa2uau s u0 rxrxr3tydfpDelu il()srto(r iy4om elicta(fsrrm( pot0aetomo3ildls2ulnvsnt4 rxnxo iydopteluvs t0seuoir ny4al emfvtl(  2ta( pou4apt moeiadfsDelnmp;t4 reoio ta1fmt ai o;(0trxoimpny1omte iesat)srrrx pot0oeen i3iadls eau o u0trxnmo3ty1lmtraueo s)setoim3oydlp n feslt)srtrx  ot4tltomfciatfmDrlnms;t4 eerir3ty1optranvs s  rumiopiydapte ics (f Duax  ;t4aet mociat s2um( p t0trxrif3oatom raivo ()setmxmpiy1alee ieiatfarrr( p;u0tlxomi3tlslsDel( s;u0 lerxr io1fpD li o;t  etm(m3ny4ol   fciasfartm(mont1oex io3tlsla ua( o;u4tltnirciatoa   iei ()t2xr(o ny4lmtnlfeil( a2rr(  ot0tet ioeiatlaDranvp;t)tetrif3oatlm  lueo;()srto(r ny4ol  micsl(fsruru  nt1optomi3iyt s2ulumo u)tlxrir oy1lpD  i i t texoxm3oudal e nesl(faDumumooo0optniociadfm2eanmpnt0 rermo oo1lm eanei;()s2xrim3oo4lmtemnei sfaDrmu  ot0aex ifetadla rmn pn(4alxrmf tadfa elu ilt) 2xmim oy1alt lfetltfsDtmum ou1olxn octlsfm2el(mp;(0altomo iydlatr i ils) 2umxr3ou1lpte nes t arta(root0tlenif3iys aDranvo (4teerir oy1fp rlivol(0 rxmir3iy4am e ictls s2uau pou1tlxo i3iys s umuvp;t)teeoio3iydlatrauvil(0trumxrpnodlptemieilsfs2urx pot4alxn iciyslm umump (0altnirciodfpt li i;t)t2xrxm iydll e fvil( s2trxmonu1aeenmoeiysfsDrlnvo u4trenxo tadfmDe uvo s  2to(r nu4om elietltf 2trx p;u0alen f3iydlmDem( p;t) lenioctytlmDrlnei;(  rtm(opno4lp n fci s) rum(rpnu4oetn i3iatls2rm( p;u)aetnif iotfmteaueils)texrxm ny4lmt  fctl() Drm(ro;t0aee  f3ild s2ranms u4altnifcoa1fa elieslt)t2xm(r oydap e nvil(fsDtrxrpno0alxn fciys s ua(monu0 etoifciydfpD lieo t t2um(r no4aptemnvs t)aDrrxm ot4alenmoeiyslm rlumont0trxoio iydfmtran i t) ruo(m iu1ol nliei t)srtmump;o1altnioeildlmDuau p;t4trxoiocio1fmt aueo s0srtm(o ny4ll  lnvsls)arrau  ;t4apx  ociydla2emu p u0 ltrmo3iytlpDr uvi t0texrxopiy4omtemnetlt sruru  no0tee  ictyd a2emnmsn(0 lxrmr tatlmDeaivi;() rtmiopiudlpt  iet t srtm(r ;o1teenii3tatla2um( pnt4arenxf3ia1omDelieilt)t2toxo iudamtelicsas aDtru  nt0oexnmo3tysfm2ul(vp (4treoxo totomtelivo s0 2xoimpiy1lpee ivtasfs2ra(rp;t4tpen feiltlmDeanmpnt4tlenmf3oa1fmt lu o ( t2tr(r3ny4lleemivt s) rtax  nt4aexomoeiyt m2rm(ms;(4 reoxo oy1lm rli o t  2urxmpoudopte fvt tfaDra( onu1olx mf3iatfs2ea( on() ltnxrctotfp rai s t srumxr3nodape mfci () Draxrpou0openii3iatla2rmump;(0altrmrciatfatraieolt0texoio io4lmtemnvi sfa2tm( pnu0alxnioetatfs emnmsnu4tlenxr3ty1laDrai o;t  rtrxo3no4al e neil(  rrr(ronu0open o3iytfsDua( o (4 exrmr totlm elneo (0sexrxo no1omtemnvtasfsDua(  nt4teeniieiltla um( snu0 rxrxrctotlaDeluvo;s0 2uoiopoy4lm elnvsas) 2umxrpou1oeenmoeiydfsDem(mp;(4trerif3to1lpDraueols0texoxo3ny1omenmivslt)sDum(m ;t4tex ii3tld s umnvs (4 ltnmr tadoaDe nvi ( t2tm(r oydll emnei (f rta( pou0teeoiiciyslaDea(ms u)aexoxr3iodomtrliesl(0t2trimpoo1lpteliesl(fsruax p;t4tlxo ocils a rlums;t0 eenirctotomt livslt sexmxr3iydopte nvias)srtmu  ou0teeoif3iltlmDua(vs;t4aetrxr3tadfpte u o;() 2umim3io4alt mivtl(fs2rmx ont1tlt ii3iltfa2ulu s u)altnxf oo1fpD aueo () ruoirpiodllenmnvta( aDur( pou4apx mfetlt sDuanvs t4aexomrcoatlatraueslt  etoiopiydlm  licsatf rta(mpnu0tltnmfcils sDumu p t4altrxfcoydomDr u s s) 2umio3nu1lm   fviasfsDumxr ;t4optnmfeiatla2ea(vpnt) eeoiocootop eln o ()texr(m nydapte icia(fs2taur ot4optomi3iltfsDrln snu) exrmr oy1fpD luvo;(0 exm(o3oy4lme licsa(  2tmurp;u4texn octatlm emn o;t0aetrxr oo1opt an olt0 2umxr3iu4om nlncsat)arumxrp;t1tlen f3tat m ulumpn(4 lxrmo iodomt  ivsl() rum(m3oodlp e ivt sf 2rrurpot4opxnmo3ild s umnvo;(4 exrxf3iotlp  auei t0srtmiopiy4omt  ics sf Draumpoo4aet ifctadfaDrm(vo u0tlerir io1fp eaivi;t)texmimpoy1ll nlncsatfaDraumo;o1oexo i3ildfs rmu p t0trtnif tytomDeli o ( srumimpnu1apt licsl(fa2rmu poo4oexn ieiydlmDulumsnu0trerio oytfpDranvo;t0setrxm nu4openlnvs (faDtru pot0apxnmi3ias s ea( onu4altoxr iotfp rai sl()srxoxrpiy1lp  mfetl()arumu pou1tlt io3iltla2ean pnu4arermocty1lm  lu i;s srxmirpoydaptnmics ( aDtax o;u1opxomicils m eln p u4 lxrxr oy1oate nesls)trxrxmpoy1lmee fetat  Dtmxm no1ope mi3ilslm ea(monu0aeeoxrcty1fmDe u ol(  rtr(r3iu4lp  mnesas  2tax oou0opt  fetadlm el( snt4tlenxo3oydfa  au s s  exm(o3oudlpteliesas) Dra( o;u0ape miciat a2emu s (4 eerif3tytoptean s;s s2xoiopoy4lpe mncsltfarur(  ;t4tpe mfciltlm ul( pnu0artnxrctatfatr n ils)s2xrxrpoo4op n nesat)s2tmxmono0olx iociatlm2emu pnt4 lenxfcio1om r i o;t0t2trio3io4alenmicil(  rtaxm no4aexn i3tys mDrmn s t0trenmo3tydfmDran o;()truoxo3nodolt mies s arrru p;o1altn feiadla2eln p u4trxrirciatlp r ivs t0 etr(o3iodol e iesa(  rraxr ;u4optnmfciatfm2eaumont0alxoxrcoodfatelnvi;s trxoxo oo4ap  lfvtlt a2tmu pno4aee ifctas m elnmsnu) rxrxr tatlm   i slt s2xmxmpno1ape mfvi s a2umxro;u1apx mfciys sDrauvo;()tleoxoctatoptraneo (0texmxrpiodam e ncslt aDtrur ot1tpto i3ildfs ulu p;(4trtnif3tydomDrluvi s0t2urxm oo4lleemfvtl()artrx poo4tptnifeiatlsDemnmon(0artrifcoytla elivs;(0t2xmxrpnu1ale  nesl(fs2uru p;u0oex mfeilt s el( s;u)tetrio3oadfm r nvi;t tetr(m oo1omte iciasfaDtrurpou4aeeomf3iadfs2ea( pn(0 rxoio oodlaDrln o s0srtm(o3iy4olee ictltfsrtr(  ot1aee  fciadls2elnms u0alerxocoy1oaDr u s s srur(mpoo1olen nci ()sDtmu  ;o4apxn f3tatlsDem( pnu4arerif3iadlmtrli ils) 2toxo3iy1ole  iei ( srururpou0tex  f3iad a ranmo u4alenmr3tadomt  nes s0seum(m nydom n nvilt a2rmur nu1tlx iictasfa2uanmp;t0tlxrxr3to1oatean i;(0s2tmim3io4ll elieiatfarurx  ou0tltnmieild aDea( on()teerio to1late ivi;(0 rxmxopnodap   ivt (farrm(m nt4oex ii3ils a2elnvp t0treoir oatlpD aivs;t0trxm(mpnu1lpt mictl(f 2rrxrp;o0apeoiieiadfm emumont0aexnmo3iytlp  li s t0texo(m nydolt mncia(  rua(monu1opt  fetldfmDrmums;t)trxnxociytfmD an olt teuoir iodolt mneils arurxmont4alenio3tadfm elnmo;t) lxnxocoatfptr ivo (0sruriopoy4om   ivsl() rraxr ;u0oleoiictls m2um(vont)tlenmr3to1la   u s;t t2xo(opio1lp elfctat arrm(r ot1tleomictld s rmu p (0teenxf3ia1latelneolt0srumir iydllen icsatf rtmx  ;u4apxo ictytfaDeau pn(4tleoxr3io1oa   i ils t2xm(mpoydlleemncsa()s2ur(ronu4aetn fciydls ran onu0artrmfciytfp eanvo;( srxo(r nydomenmictlt  Dtm(rpnt4apxo ieiadfsDrluvs (4aexrxf todop raueols  2xmio3iu4ope miei (fs2tmx poo1opx moeiydlaDranms;(4 rxrif to1fm elivs (0 etmxopnydomt miviatfarumu o;o4tpeoifeiyd sDra(vo u) exrmo oytfp elnei () rurimpoo4ape lnesatf Draxmo;u0opxomi3ilslmDuanmsnt0 etrmr3iydfmDe ueo;t teumxm io1al  mneil(fsrraxrp;o0tltniicilt a2eluvp;u0aetoxfcoadlmtelie
\ No newline at end of file
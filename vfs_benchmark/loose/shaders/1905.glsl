@@ -0,0 +1 @@
+nes t0 2trxr ny1ape  ieia(faDtm(mooo4apxomiciltlmDulu pnu0 rxrir iadfa eanvs;( t2xr(r iudol   ncils a2rrur ;o1tlxo fctasfa rlump;(4aeeoio iatlmt lu sls teumxo3iydaleemfeta( arrau  ;u1tlxo octatfa ranvsn(0tlxnif iatopt anes;t)seuoxrpoodom elivs t) 2trum ;o1tpeo fetysfaDeanmp;(4treoifcoydfa e i s t s2xriopoo1am emfetlsfa2um(rpoo1oltnmf3iatfaDranvp u) renxo3ty1oateauvol(0s2uo(m3iydam elivt tfa2rmurooo4aexomicild m2ea(msnu)aetoio3tadfmD lu s;s)trur(o3oodlmen fcsltfarrauront0aleo iciltls2ua( s;t) lxnxr ia1la  ai o;s  2xrxo io4lp nmncias sDtauroot4opxnmfeiydlm um(vo;u4alxrxf oytlp   iei;(0s2to(m nu4olt mfesls a2uru ono1optomfeiysfaDrmums;()tltrxocoodoateauvs t)setm(m nudlmeemfci s aDrruroot0tpeo iciytfmDua( p;u4altnmfctatfm  luesl( srurxrpiudlltnmiciasf Drrx poo4tpe  octas s2em(vsn()aexrxo3iadoate ivs;s)trto(rpiy1amt mfeilsf rraur ;u1tpenmfeiasls2uanms;t4tltrxf oy1fm rli sls0setmxmpiodolt mnvsl(  Dumu p;u0tpt mfetadfaDrluvp t4trerio3ia1oaD  ivo;t0seur(r3nu4lmtemfvsat s2tau o;u0optn o3ildls eau o t0arxnio3io1opDraieo;s)t2uo(o ou1lpe lfcsatf 2uru poo0oex mieiys sDea( o u0tltrmf3ta1fptr nvil(  rxrxr oy1amt mnctls arumu poo1opxo fetydlm2ra(vs;u0 exrir todfm e i o;( t2toxmpny4altnlnvs tf Drrxronu4tee ifciltfsDul(vp;t0tetoiocio1fmD lu olt)trxr(r3nydapenlfvia(  Dtmxm nu1olxo i3iatlm emn p t)artnir tydfm   ivol(  euoxm3io1aptemnci s)sDra(  ;o0apx ifeiyd sDea(vpnt)tetnmf tatom elieo;s) eum(r3oo1om  mivtltfaDtr(mo;t4alxn oeias a rau o u0arerxrcoy1lmtrln o;t)sexmim3nodapen fetat a2taump;o0oex ii3iysfm2rl(mpn() ltoif tydlm raiei;s) 2xrir3ou4am nmivi tfarrrx o;o1tle io3ildfs2eanvpnt)artnir3iadfa eauvo ()tetrirpio1lpt  icsas)srraxmp;u4alt  iciydfs ua( s ()aeerxo todfa elues;( trxm(r3nu1am nmfcs (fsrtruro;u4oeeo fctldla2ul(vs;u0arenir iodfp r nvo;(0 etr(m3ny1altnlici s a2um(mont1oeeniictyd sDran ont4artnxr3oadlpte n i s s2trxo3iy4om nmfcs tfsDrmu  no1tle if3tasfm2umu p u4trenxoctadfmtelu o (  rxmxmpnudlmt  fei tfsrraur ;o0tpeoifeiyt sDeln p;u0areoxr iodfmDeluvo t0 2toim nu4ape mfei sfs2trx poo4oexnio3iaslm2ra(msn(4 ltrxfciydomDe u ils)trumir oudamtemfesas) rtrxm ;u1texnii3tatls em(ms (4tlxoir3ootlaDrluvs;t)setm(m ou4lpe  fct s s2uru pno1oet ifetyd aDea( p;(0 rtnio oytfa elivilt seuo(r3no4apt mnvi t)aDtaumo;o0tptomf3iysls ulu on() eeomr totopDeaueolt  2tm(r3nodll   net () 2uru p;u4alxomictytfm ulu o t4 renmocoatla rauei;( trur(m3oo1al elfct ()srur(r nt0olt  iciltlm el(monu0aeeoxo io1fp eanvs;(0trtrxr oodop nmicsl(  rtaxroot1optn feiat a ua(mo;u) rtomocto1opD  n ols  rxmir nydlmtelfci tfsDua(m oo1altoioctadlmDean s;(4texnmr oa1om  li o;( srxr(o nodomtemfcsa() 2uau  nt0tex ioeiad s2rluvpnt4tetrxo3ty1lpDeai ol(  2tr(m ny4lm   fvs t  2rr(rp;t1aexnioetadla2ua( p t4artnmo oydfm r uvs;t0trur(mpno1amenlfctltfa2raxmoot1alxniicildfs2ul(ms;u0 lxrxr oadfmtrai ols  rtrxrpiu4lp n fvtlsfaDtrumpnt0tle  ocildfm2umump;u4arxrxr3ta1la eai s t0 eur(m io4ol   fes (fsrrmumooo1oee mfeiysfa2umuvonu) rermrctydop   uei;(0s2xmio oo4al  lfctlt)s2rrxr no4olxo f3tas a eanvsn() etomrctadla e i s;t) rtm(rpoydaptnlnesls aDrr(rpot4apx  f3tytfm ulu s (4teermr3oydlmt au s;(  2toxo iy4oltelfvs t)a2um( pot1tptniocilsfa2emnmon(4artnif oodfm  au s s t2toxrpny4lptnmfvtl(farua( p;o0olenmf3tytls2raumsnt) reniocia1late ieo;() eumir oo4lp  mnet (  2rr(mp;o0tlen ocildlsDel( o (0 rxnir iytlm   u i (  exr(r oo4om   fetat)a2uaxm oo4alenmoeiltfm2elnvont0 exoxf3totfaD anvo;(0 rxo(mpnodll n fvsa( sDua(monu4opx iieildls2uanmp (0 exnifciatfmDeluvo () etm(rpiy1lm  mietlt  2rrur no1ope  fciytfa uaump u) rtomfcootomD  ueolt s2urio3ou1aptelnvia( s2trxm nu4ole micias s2elumo;(0 leriocia1omDe neo t  eto(m nydalt lnesls aDtmxmoot0aeenio3tls s uau pnu0 eermf3oodfp eauvolt0 eumir3iu1lle  iet ()sDtmxmpno1olt ii3iyslaDum(msnu0arermr totopDr uvs s0t2umiopiu4op n netls aDrrump;t1tle iociadlm2umuvo u0 eerifciadlpD auvi t s2xrxo3ou4omte fvtlt)srrr(rono4tlx ifetltls em(vo;t)trerif3tatlat anei t  rxmio3oy1aleemnetlt  Drmx pot0apenioctltls2eanmsn(4aexomo oatom   nes ( sexrxm3oo4ol nlietl()s2ururont4opxoif3iasfsDuaump t4alxrmo iy1opDrauei ( s2tmxr3io4ol nmfct t s2rm(m ;o1apxoif3tydls2em(vs;()arxnifcoadfaDrlivi;s t2umimpio1ole lfvt s)sDraxm ;u0ole  o3tltfs rln o;u4artnif ootopD  nei ()tetoim3io1lpt livsasf rrr(root1apxnifetys mDelnvo t4texnmrcoadlaDrlnvsls0s2tr(o3iydol  lfvi ( aDtrxr nu1aet if3iytla2rmn pnu)texnxo3oadfaDrai sl(0 2ur(m3oydale liei t sDrm(r no4tpto icilsla2umnmo;(4 rtoxfcoydlm eau olt) ruoio oo4ole mici (fs2raum nt4aeenmi3tasla2ua(mo (0teeoif oa1lpDeau o;()truo(o ou1lpt  fvilt)aDrrxrono4alenifciltla2umnmpn(0texrxociodlpDrlu ol() rxr(mpoo4oltelfeslsfsDum(ront1teeoioeildfm2em(vpnu0aeeomr3oy1lpD auvo;t  2xr(m3no4ap  lfei (fs2ur(ro;o4tlxoio3iyd s rmu snu)arxoxfcoodfmtrli sls)seumimpou4openmiesl(f 2ta(mpoo4oet mocildla2rlumsnt0altomrcta1lm   nei;s) exoxo3io4aptnlfcsltf rrrumont1olx  i3iydla2umn pn(0altrmf3iatomtrlu i t)teumxm3oo4aptn ivt s) rurum ;t1tle  i3iadlmDumu o u0aeeoxr ootlatr nvi;t)trtrir3nu4lpee ivtat sDumum oo0apxnmfeiad s2emump t4tetrxr tytomtran sl(0trxo(o3nodlm e neiat  2rrx oot0opx  f3iltfm uluvs;u) rerifciytfmD  ivo s s2uoxo iu1al  mnetat)srrru poo4tpe iictltfm2ea(vs (4tetnircoadfp eanvo ()texmxo nydapeelfetl(farua( pnu1tlto o3iytlm2ea(ms () lxoxr iytoa  lnvs t)truo(rpiydale lici tf 2uau  nu0tle ii3tyd a2ran o t)arxrmr ootlp e n il()s2trio3nudlme miciltfarta(roou4oltoiieiyt m rl(vont0treoio iadfat luvs;( trurir nydolte icsa()aruru  no1olenmoeilsfmDuaumo t0 rerif3ta1fp rln ol( s2umirpnu1al  lfvs t) rta(r oo1aee  feiadls rlnms (0tlxrif oo1oa rln sl(0teto(mpoo4lle livtat  Dua(r no1oet mo3iydfa ua(mp;t0tlerxr3ootlpDe ieo s)texr(m3oodome  fvt t srrm( p;u4aetnif3tys a2emumonu4tlxrmf3oo1om eanvi;t)seumir nydlmenmnes () 2urxrpnt1ape  f3tasfa emnvo t)aexrxf iadoptr nvs;(0tetoio oodoleelieils)a2trxro;t1aetomietysfa elnvp;(0 rerxrcoadopDean slt0 2xoxm3oy1opt lnci sf 2taxm ot0aptnmo3tld mDeanmonu)treoio3iatoat aieslt) eto(o nydole mnctl(fsDumumont1texniictldfm2rau o t)texrmocoydlpDeaivo ()texrxm3io4olt lfesa(  Dtm( pnu4alt  fciysfs2uluvpn(4tlxnircoytomte nvo;(0teumirpoo1am e ivtls)aDtrxrpnu0olx  oetyd a2rl(vo (0aetnmf tydlm elues t s2tmxopny1ap  mnciatf 2rm(  no4olto i3tyd mDrm(vo t0teermr todfm eln o s)s2tmxrpno1lpenlneta(f 2um(m ;u4tpx  i3tldfa2ea(vp;(0texoifciytlptrluei s texrxm3oy4omtnlieslsf ruaxrp;o0alxoii3tyslsDel( o;t0artoioctatlm e n slt  2trio io4apenmfcil(fa2rru o;t1tpeomoeilslaDeln s;t4aetomociadlm raueo;t0 2umxrpoo1optn ict t) Dtr( pou0opxniieildlmDulnvp () renxo tatopD ln s (  rxrim iy1lleeliei ()s2rrumont4tee ifeiasls2ua(msnu0 lxnmo3tytoat  nvi;s sexmxm3iu4lmeelicsa() rta(moot0teto iciytlsDrluvp;()aeeniociatfm  liei;( teumim3iu1optelnvs t  rrmxront1ale  o3tld a2rmu o;t)areoifcoa1fptr u il()srurir3nu1lp e fei sfsDrmur ;u1alx  ieiyt a2um(vp t0 rxomo3oy1lmtelnvs t)sruoiopoy1al nmfvsls srtaxm ou4opxoifctls a2rmnms u4 rtoxfcty1lp r uvo s)sexmxmpoudal n ivtl(  rtaxroou1aeto o3ildla ua(vo u)trxomo tydop r ivols)texoxopoo1ope  nci s  Dta( oou0aeenio3ilt mDulnmpnu)arermr ia1oatr ueo ( setoir oo1opt mfcilt  Dur(m nt4apt  o3iatlm rm(vo;u4trtoif3iatfpte ivol() 2trxr3nodapeelivi t)arururp;u4apeo oetltla2umnvsnu4tetnmfcoy1op ean o s  2xoir io1ol  mivs s)srrr(mpnt4aptn i3iytla rluvpn() etomo ta1fatr ivo s)t2trxo3oydapeelfvtl(fartau  no0oex moetyslm elumonu0 exnmf3oatopDrlnvs;s sexrimpnodame lfesls  rrau  ou4apx ii3iad m2rluvpn(0 eeomr iy1om eli sl( seumim iy4al nlfeslsfs2tau pou1tptomfetadlm2ran s u0texoxo tadlptrlivilt0 2to(r3nu4om   neils)aDua(r ot0apto i3ildfs2emnms;u0 ltoxf io1oatr ieo;t)sruoxm io1om emfesl( arua(r nu4tpt  ictat aDumuvsnt0 renmfciy1lptran i;s  2toxrpoo4omte fcs t sDrr(mo;t1altoiieild s ul(vpnt0 rxnmocoa1fmtr ueslt0trxr(mpio1lptnlncs () 2uaum nt0aexoiiciysla2ea(mo (4 lxrxfcootopteaiei s0 rtmim oo1llt mfvsa(f 2uaxm nu0opeo oeildfsDea(vp u0tlxnxocoy1lp eluvslt  exmir3iydapt lietl()sDuau o;t0teeoiiciytfs2eaumo;t4aetrircoatlptr ivi;t) etr(r3iy1lptnlfcsltfs2rau o;u0tet  octasfm uauvs;t4tleoio oy1lpDe ues;t0trtrio no4omen ncslt) 2tmumo;o4aptoiieiasfsDran s (4 lxoirciydla eauesls  rxoxr3iy4amtelfcsat)srra(ro;o4ole iietldfa2ran s;(4texrxrciodfatelnvil()srxmxm3oy4lp nlivsl(  rur(mont4openmo3iytfa2rmn s;t4 rxomfcoadlpDrau o ( t2uo(r3no1lmte ietlt)s2rrx  oo1tlenmi3iyt m2ua(vp t4 rtoxf totomD li i t0 2tm(m oy4al emies sfartaxmoot0olx  feiytlaDrmnvs t)tleniocoodlaDelieils  euoirpoudol elivtls srur(rp;u0oexnmf3iys a2uanmpnt)tetomr totomDeli i ( s2tr(mpiudoltemnei t)s2rrumpou0tpt  fetadls2ul(monu)tetoxr iydomDrlivils0 etmiopny4apeemnvilsfaDra(ro;t0apt  oetld a2em(mpn(4trtnir3iatlpDrln i t  rur(opoo4optelfvt s) Duau pot0tlxo i3ilsla rmnvs;u)artrxoctydlmDeln o t0s2uoxrpio1op nmicsls)arurxr oo0tltnmf3tldlm2uluvonu0 exnir todopteau o t)sexrim oy4al   nvt tfsrtr(rpnu0opeomoctys aDuln s u0texrifcia1la r ivo;(  etoim nodom   ivia(farrm(  ;t1tee  o3iasfmDuanmp;t0arxnmo3oatfmDr i o s  exrxrpiu1lme lfeiasfa2ra(mo;u1tpx  f3iydla ra(vp t0 lxomf3ia1oateaieolt  etrir3iu4lm  lfvs tf Drmum nu1apto oetyt mDrm( p u)tleoio oatopDe u ilt)trurirpiy4alte neias a2ua(mp;o0ope ifetadfmDrl( p (4arxniocty1opDrai sls)trxmir iy1lpeemfei t sDrr(r ;t0opt  oeiys aDel(vs t)trtoiociodomDrauvo;t0 rtrxr3nu1lleelnes (fa2tau pno1altnmf3iadla elnms ()tltnmf tadlptean il( sexoxm iydopeelivsltfarraurp;u4tpt  oeiydfm2emn p u4aeeomo totlpD  nesl(0sruo(r nu4lp nlnci (fs2urump;o0apt io3tyd aDumnmpn(0 lxoir tadlp eaivs t0 2urxopiu1olen fcil(  rurx  no0altoii3tlt a rln o;u0 rtnirciotlaD lues;s teum(opoudapee iesat  rtaurp;t1oleomociydlm elnmsnu4texriocta1faDean i;t0 rumxm nudop nmneiltf 2uaump;t1tet  feilslsDrluvp;t0altrir iytfaDrauvs (  rumir3iy1lmtn ivs ( srurump;t4apto iciytla2umuvs () etnxr iodopt  n s;s tetoxm ou1om  lfetlt) Dtm(moot1tpxomi3ilt s2uluvon(4 lxnmfcta1fmDe n o t trtmio3ny4llt mfeta(fs2rmxmoot1opx  feiatlmDelnmo;t4tltoirciodfpDrai o s0seurxr nydlme  nciat sDrmuro;u1tleoifeiydfm um(mp ()trxnirciotfmteau ils0 rumxr io4altelnctasfaDtax pnt0oex moeiat aDemnvs;t4tltoio iydomt lu ol()srurxrpno4lpe lnes sf 2ua(mo;o4tpxo iciyt sDuau pn(0texnxr ty1lmtraieo t0 rxrio oo4aptnmfvils) rumur oo1aet mfeiytla2ul(vp;u)aeenxr3ty1laDeaues;( seto(r3iu1amtn ncta(f 2rmumo;t1ale moeiaslm2elu p t0trtnxfcoadla rliei t)teuoxr3oudlpenmnesl(f Dumur nu4texomi3iadlsDumu o;t) rxrxf iadlmtrlueilt0setoxr3oo1lmtelivtlt)artax  nt1teto o3iytfs2uauvp;(0texoxrciy1latr i s () rxrim oy4lltnmnci s a2uaurp;u4olt  feiyd aDua(msnu) lxrircootfa e i i (0 eum(mpou4oltnmneil(fsDrrx  ;t4aexnmoctadlm2uaumo u0tlenxr iadoa eanvol(0texrir iu4lpte fct s)aDumxr no1apt miciadfaDulnms ()teeoif3iy1fp ean s (0t2xm(mpoo1olte ieta()artm(m nu0tee moctytfaDum( o;u) etnif iodfptr u o (0sexrxmpoo4lptemncsls srtmxm nt1aleomoctys m eanmsn() exoircto1opteaivi ( s2tmio oy4lleelnvi ( a2ur( o;t1tetoiociysfmDelnms;()trenir3oadfmte u s;(0trtoir3nu1ole  fetl()s2rruro;t4ole miciysla2elnmonu0trxnxo ty1op   u s ()seumir3iodaptelfviasf Dta(mo;o4oex mfctad aDrmu ont) rxnmr oytlatrln s;t  2umxm3oo4lpte icil()a2tm( oou1aleo oetlt s umnvon()artrxo3ta1fat anvo;t)trumxr3oo1op elivsa( a2uax  nu1olxoiictytls um(vsnt4teerxocoytlaDr nei;t0t2umxo nudomen fctlt) rua( o;t4oltnifetldfa2em(vs u0tleoxo3oadfmt aies t0trtmir3ou4lpe  ietlt)arrm(moou1oetomi3tatfs rlnmsnu)alxomfciadlmDr ivs;t  exoxr iodapenmnetatfs2rmu  ou0ole ifeiltlm emnmont) reoxociodoa elnvs s) rxm(r oy1alenmivtasf Drrx onu1oex mfetyt m umnmo u) ltoxf oadopDraivs s)trto(mpio4amtemivt (  rumxrpnu4teenmieiytlm2ra(vp u0artoxr oadfptr n ils tetr(r3ny4llt mivt t aDuaum no0alxo f3ilsfm2rl(vp t4texnxr ty1lpt lnei t) eumio3ou4omtnlnciat  2rr(ro;u1alen fciyd a2ulumsn(0 lxnxr3to1omtrlieil(0t2uo(rpnu4ol nliet tfarum(m oo1tpxoifciad a2eaumo;t0texomfciytom eaues t)teum(mpou1ll e nvt sfsDtrurpot4tet  i3ilsfaDranvo t0tltomr3oytlate iei;(0 2urirpoodlle mfvt t arumu oou1texnmfetldlmDumuvp;t)teeoxf3oy1omte uvs t) 2xm(rpoo4ape mfetlt arumu  ;u4tex iociltfs2rm(vo;t0teermr tatla eau ols) rtmxr3ny1apt  ncslt s2um(ro;o1aexn i3tydfaDul(vp;(0 eerxocoatlmD  uei s)trxmio3iu4lm nlnviat artruro;o0tpxomo3iyd aDra( snu)arenmf oa1fa eai i () rtrxr3nydopt  ivs tfaDtmxront1oetnif3iat a2ea( pn(4tlermoctydfatr ueilt0trtoxm3iu4omtnmnvilt) rum(  no1oetoioetytfaDumuvs ()aeermo3iodoaDeliei s)setoir oydal nmivt s srtmu ont4oee  feils m2umnmon(4 rxomfciotom r uesl(0t2tmxr oy1al nlfci t  2raxr ;t1altomoctatlmDul(vpn(4texnmr iatoatelnvo;s)sexmxmpio1ol e ivta(  Durur ou1oltoiieiasls emu p;t4trtrxo iodfate neols0trxr(r3iydlmeelieta() Dta( o;o0olxnio3iyslm2rlu ont4 rxnifcoodoatelnesl(  2xr(rpiudol  mnvt s a2um(mooo0opxnmietldlsDem(vs;t)tlenxf io1omD aueo;()seuoirpnodame lfei tf rtaum ot4tleo ietatls eln s t4 leniociy1fptrlneo t t2uoio ny4oltn fct sfs2umxmpou4tetomfciltfs2rmn p u4 lenirctydfm rai ils)trtoxm3no4lp elnci tfa2tr(rp;u1olxn ieiadfsDrmnvo t4 rtnmf3totoatrln i t0texrio3oy4apee nvi t  ruau  ;t1teenii3tatfs2eau snu)trxnmf3oy1fpD lnvs t0 rto(rpnu4om  lfvsa(fa2rm(r ot1oexoiicils m rmnvs u) etrxf3totlatrauei;(0 2urir3nu1lmtn ncta(  Dum(r ot1tet  feiys aDean o t4texoxocia1omDeau s t) 2xm(m oo4lltn nvtls)artrxm ;u0tpeniicilslsDrm( o;t4aexnir3oydoat aivo;t) rxoxr3nudlp e nei t  Drrx oou4optnioeils aDrmums;u4 lenmrcty1op r nvo;t  2uoir3nudolenmivi ( s2uru pou1tee moeild sDelnvsnt4teenxr todlat lnvo;t0s2toim iy1openmfeiatfaDur(m ot0tee  ieiad s2eauvon()trtnifcta1la raiei;t)trurir3iu4apen fetls)srtrx  ou4tlxn ociasfa ulnmon(0artoxf3iydfpDeau o;()setmxo nodamtemfvt tf 2uaxro;o4oexn i3tytfmDraump;t) reoxr3oo1op elieilt0 euoxrpiu4lmtemivsltfs2rmumo;t0teeoifctld s ulnvo u)tleomf oodfatean ils  2urxr io4lptnlfcia(fsDua(m ;t1tlxoioeilslmDea(mon(4 eenxfcoadlmt an i s) eum(rpnu4lm nmiesa(  rur( pnu0aee  o3tldls2eanmo u0artomf tydla rlues t s2toxr io1lptemietas)arrr(r oo4oetnii3ias s2eluvs ()arxnxrctytoaDe i o (  2tmxopiy1op nliciltfaDta(rp;u4oetoiietydla rl(vont) etrio iodfmD aieol()seumxo3no1omee nvsl()aDtm( p;u0aexomo3ils mDum( o;(4trxoir3tydlaDr ivo;t)tetoxopoy4lmtn fcs tfs2tmxrpnt1tex ii3taslm eanms u)arxnxo iotomtrln s s  rxrio iu4altn iet t sDrrxmonu4apxo i3iytfsDem(ms;(0aexrmr todfat au sl() rtmxo3oo1al nmnctas) 2raumpou4apeoifcilsfm umnvp t)aleomociydla e ueo (  2toir3nodlleemictl()a2rmurpnu1optn ietyslm2emnmp;t4texomfctotfa elieslt teuo(m3oy4lmtnmnvt tfaDuaumooo4tpe  fciysfs rm( snt) eenmrciytlaDe neol(  2xoio oy4apt  ncs ( a2taump;u1tee miciltfm ul(vo ()texoio oatfatelnei s sexrio oodlm elictl()aDrru pou1tptomfeiltfaDrl( snu4 rxnif ootoa   iei;t0 eto(rpoy4lmt  fesl()srumu  ;o0aexn ictydlmDrl(vo t4trtoxr iytfmD au ilt0 2xrxr3oo1lp   fctl( a2uaump;t1tltomi3ilsfm ua(vpnt)arenio oytlmDr i s (  exr(m3iydllt lnvsl(  2raxmp;u1aee io3iatla rau o ()aetrircia1fm eauvo;s)teur(o oydome lfcsl( srtm(r nt1optoioeiatls elumpnt4 rtrio oydomDe u ols srumxr3oy4op elfeiasfsDtmx pou0aetomoetatfsDulumsn(4 rxoio iotopD aieo s)setrxo3nydlltnmncia()aDta(m ;o1oetoif3iyd s2elumo;u0aexnmr3iadlmDrlues;()t2um(r3no1amen ictat arrax oou0aeto i3ildls ra(mo t4 ltrif3iodom   neo t srxo(r iu4ape mncsat  Dra(  no0aex ifcils a2um(vpnt4trerxr3ta1lat  ieils)seurxrpiy1ale mies t)a2ururono1tee  iciltfa rl(mont) ltomr3iadlmte n ols0trxmxm3oodameelnes t a2urum no0aeeniietaslm2raumsnu4tetrir3totoa  aivilt trtmiopno4om nmivtls srtaxrpoo4opxnmieilslaDemnvpnt)arxnxo oy1oa r uei t srxoxm3iydlp nmfcsa( srrrum ;t4alxo ociltlm2rmumo t4tleomf iadfpt  u olt trxm(rpou4lle lnvtls sDuau oot1oexnmi3ilslsDulnvpn(0aexoxf3iadfpD li ils0texm(opnu1lleemneta( a2uaurp;o4alxnmociad aDuaumpnu0arerxf iodlpt aues t  2uo(m iu4ll emieils)srtr(  oo1alx  ictydfm2rl(vo;t) rtomfcoy1opDeaueols0texrxrpiy1apeemieslt sDumumpou1oeeomo3tlsla2ranmo;(4tltrifciy1oat auesls)texoio ny4amt  fvsl(fs2tm( pou1tee mo3iadfa elnvp;u4tltrxfciydlat  ivi t)s2toxr oudolt mictlt) 2rr(mp;t4ape io3tls a2uanvp;t4 eenxr3oytoptr ues (0s2xoxr3nu4al  mict s  Dum(  ou1oet  oeildfmDeanmp;(0 ltnir3ty1op   nvo;t texmim3no1lle  nct (  rta(r oo1apeoifciat s2eaumsn(0altoir oydla   i o ( srtm(m ny1ame lici s a2rr(mpnu0altoif3iydfs rlnvs t4 ltnmf oa1omDr nvol(0 2xm(rpnodlmt  fei s s2rau  ;o0alxn ociys s rl( onu4artrmo3ta1lp  auvs;t0 rtoxmpnodap  lictltfa2tru ont1aex mo3tysfm2emnmo;t) exnxf tydom e ueo ()t2xoxr iodlp  lfvilt)a2urum nt1ape iieiysfs rau p u0 rtrmrciatomD livo s0truo(r3iy4opt  fvia()srtax o;o0oet mfctyt sDrl( o;u)alxrirciy1fp  au ilt) ruoxopiy4am nmfeilt  2rru ono1tlx if3iydfsDrl(von(4aexnmrcio1late neo;t0 etm(o iydllt mnct s sDrm(m ;o4tlt io3iatlm2rmnms u)arxnif iy1omDrluvo t  2xmio nu1lmeemivi () rtr(m ;t1opxomfciasfa2emn s;u0 rtomo oa1lpt livol( s2toimpou4oltnmiesl( sDrax p;t0tpe  i3ilsfs eanvont4tlxrif3iy1la eau s;s srurxopoo1aptemnesl() Dtru o;t4tlxomf3tad sDrmu snu4 lxnmr io1fa  au i;t0seurxr3iy4apen ictls)srum(moot0apx ifetlslmDea(mpnu0trxrif3ty1fpt lnvols)trxm(opno1llte fciasfaDrmx  ot4aee mf3iltlsDeluvs t0aleoxr3oo1fm eln s s)teumxm3oo4oltemicia( sruauront4optnmo3iadlsDul( pnu)arxriociadlm e n o s0 eumxr3ny1lmee ies s srtmx o;o4open ociyd m umuvonu0tltrxo3oodla   n o t sexm(o iu1altnmiesat) 2um( oou0tlxn fciys aDran o;(4teenxf3oodfmDr u sls trtrxo3oy4lle  ivsltf 2truro;u4olen ieiltlm2emu ont0arermr tydlatrlnes ()teuoio3iu1olt lfei t)a2rrxmono0tptoifeild aDuan onu) lxnir iadoa  livs;s0 exoxm oydopenlics s artaur ;t1apeomfciydlsDeanmsnt4aexrmo3iatfpDeln sls)srxoxo3no1apen ncils arua( onu4tlxn octatla rlnvo u4aleoxr oytlmDrli sl( teumim iudoltemfctl( s2ur( ono0opxnmoctls s2rl( pn()aexoxociadlmDr i s t0t2xmxm3iudlp nlncils)artmx  no1alx  i3iltfmDemnvp;t0trermr ootop  luvs;t0 exmxm3oy4omtelfcsa()arrmxro;u4tet mo3iatlm umnmpnu0texnir iydoa elivolt0t2tmimpiydlp emfes sf Drm(r ;u0tlt mociyslaDrmums;t) ltomr tadlaDelieilt)trxoxr3ou1openlneias)s2rr(rono1apeoioctasfaDumuvsnu0 renirciydomDraivi;s0setrirpoy1omenmiciat arrrxmpnt0olx  f3iatfs emumo u0 etrmoctotlm   i i (0texr(rpoy4amtemncs tfsrrm(rpou0aee ifeiydls2ul(mo;(4 eeoio iytfpDraiei;( truo(o iu1ape livils  rtmxr nt1tptoif3ils a rluvsnt4trxnmr to1fpDr ies;t setr(r3nu1alee nvt t)s2urxmp;o0texnmietlsls2rl( s;()altoir totlmDeaues (0truoxm3iodam  lneilt  Dtmxro;u4ole  fciatla rl(mpnt4treoxo3ia1lpt  u slt) eur(rpio1lp nmnci tfaDraxmo;t0teeoif3tatfsDumn o;u4tetrxf3ootomDranes;s)t2ur(r3iydlp nmnvsa( s2uaum nu0tpxoio3tydfs2rln pnu) ltomfcoydlaDrlnvslt  exmxopiudlm  mictat)sDtaump;t4oetn i3ildfaDra( p;u0areomr3oydlptrliei;( trxoirpny1ap elivs (  Draur nt4aeen oetls sDuluvo;u)teeomr3oy1oateauei;(0s2toxo nudapt  ictls) 2umxmp;t1oltomoctyt m2um( s u0 lxnmf3iodopt aivo (0t2uoio ou4llen nvtlsfa2ta( pnt1alx  ociadfa uln ont4 renmr3iy1fm elnei;t0s2xm(mpiy4om emiei t)aDuaurpnu4optnioctls m2elnms t4tlxrxfciotom  li s t)sexr(o3iodop nlnes tf Dur( pot4tlen oeiadfs umnvp;t0 lermr tatomDr ivs;( trtrxr3iy1al nmfvi () ruaxrpoo0alen o3ilt sDrl(mp;t) exoxo oadfp eaivolt0setm(o3oudoptelietatfa2tau o;u0oee ioeiytfsDrm(vont4tlerxo ia1fm elivol(0 2xo(rpiy4lltelfesatfaruru  ;u4teto iciadfm ul(ms (4tltoir ia1lmD luei;s tetr(m ou1ameemictasfaDrrxrpno4alt ifeilsla umnvsnu4 rxrir ootlaDeai i s texmxo3oydamtelicsa( srurxmpno1tle mocilt sDuaumpnt4 rxnmf ta1lmteli i;t teurim ou4lpeemivslsfs2tmumpno4tetnioetytfm2ranvp;u0 eeomo iatlm rlnes s t2tmirpiu1lle lfeslt  Dtrumpoo4apt iieiltfs2elu o (0areomf3oydfp  lnvo s0 2toxopiy4lp nmnvslt)s2urxmp;u0tee  f3iysfa um( p;u0 lxnmf oadoa ran s;s)trxm(o3iy4lpt mfctltfsrur(mpnu0tpxo fcilsfs2emn onu0arxoifcto1oat anvi t) eum(o3iudomeelfvil() 2ua(  ;u4altnmieiad a2ra(msn(4arxoxocoatla eln ol(0t2urxr ny4ome  fvsl( aruaumooo0tpx  fctat m2umuvonu) eenmfctatoat  ueolt  etmxo3oo1lme licsat)s2rrx  oo1olxoif3ildlmDrauvp;t)tltnir iodfp eai i;(0setmxo3no4oltn neilsfarrmxront4tpeoif3iydfm um(ms t4tlermr3ta1omtrlnvols0 rxo(opno1lpenlies t) Drm(m ;t0altn oeilsfa uanvo (0 eerxr3oydfmt lues (0teto(m oo1ap emnvi ()arrmxr oo1tee  o3tas s2ea(vp;(4teerxr oadfpDeaueil() rxm(opnu1ame lfeias srra(r nt1tpt if3iytfm emumo;u)tltomo3totlmDe uvo ()trxmio3iu1ol e iet t)aDurur ot0oex  i3tad m rau ont0tlxnio tytomtrauvs;t)tetmim nydape  ivsls s2trxrp;u4tlto o3iat m2uau sn(4tlxomrciodopt ai ol()srxo(m3nydap nmfvt s artrxmont4tex io3tlt aDemn snu0trenmr3oa1fatr ues (0trxoxo nudlmenlfeia()arum(  ot4aexoiiciyt s2ra( p t)tleriocio1laDelu i;(0sexrim3iu1ale lfvi tfaruau pnu1oexnifctys aDrmnmpnu4tltnmf3tydlaD auvil() rur(o oy1ll  lfctasfaDrru poo1aex io3ilsfa umn onu4arxnmo3iadlmDelueo t) 2xmxmpou1lleelfeiltfa2um(rono4aetnio3iadfmDrl( p u)aetoxr3oo1fpDe ieols0s2tmim oydll n ivs (fa2ta( o;o1oeenmo3iltfm rau o;u)tlerif iodfmDe iesls  rxrir nodlp emncta( sDraum no1aex iieiyt m2rmnmo u0alxrmf3tytoa  li ol()trxo(m3ou1aptelfeia(  Dtmumoot1oeen i3iadfmDrmuvp;(4alxrxo oytlpteauvs;t t2xmio3oydlmte ivt tfarta(rpot1texnmietasfm ranvp u)tetrxo oadlmDeliei (0 exrim oo1amen nvilt)s2uau oot1aet mfetydfm2el(ms;t) etomr3ta1la rluei;(  2xmxmpny1lmtemneias artaum no4ale  iciytfm2umnmp;u0trtomo io1faDr i i t texr(mpiu1opeemicsl()aDrau  nt0tptoio3ildfm2rmnvp t)tltrmo3oy1omD  neil(  2xm(m iodopt  neia(fsDraxmpnt0opeo f3ildla2ulump;u4 ltrircoodomD  i s s)s2tmxmpno1lptelietltfaDtaxm ;u0aexoio3ils m emn on(0 rtnxf3ty1fpD auvi t0 etr(m no4omt livtlt arrm(mo;t1tlenmf3tyt mDua(vo (4aleoxo3oa1lp   nvsl( seurir3oydope mfviat) rrm( ono4altnii3ilslm ea( onu0 ltoxfcia1faDr ivslt)srxoxrpio1lp emnvil(  Dtrxr ou0olt  o3iatfm rau p u0altomf oydomt aiesls0tetr(o3ou1lleemfcilt)sDuaurpot4altoioeiad mDeanvp;() leoio3oodomDr uvs;s t2xm(r3no4lmeemivsat)sDrruro;o1tetnmiciadlmDua(ms u0 exrxo3iotom  lues s) rxrir no4amen nes (f 2rmxm ;u1opeo octaslmDul(vs;(4trxrxfcoodfp  lneolt) 2xo(m io1oltnlietlsf Dtaxr ;t1aeeo oeiytfs2ulnvp t0arerif3to1fm  aneo (  rxoxmpno4amee fvslt)s2truro;t1optnmfcildls ea( p;t0alenxoctytlmte n o;s0srumxm
\ No newline at end of file
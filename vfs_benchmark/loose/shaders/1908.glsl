@@ -0,0 +1 @@
+ivs;( trurim3oy1amte nctltf Dtr(rpnt1oeeoioetysla eaump t4 leomfcty1lmDrln sl() eumirpoydopenmfct t)a2ra( pno1alt mfctat a2rluvp (4tetoxf3io1omtrluvo s sexrio iu4alenmfvsas)srtaxm ;u4opx mo3tltfmDemuvpnu4 etoif io1fmt  n s;s0t2umxm3ou1ap e nciltfaDuaxmo;o0ale moeilslsDrln o u4 reoif ootfmDe nvolt0s2xoxr3nudop e nvi ( a2rrxmp;o1teen fciatfa2emumonu4aetnir ty1oa rlnvs;(0t2xrxrpny4lmtelfvtltfsrtmuronu0tle  i3tldls2ulu p t)tetrxf ty1oa e i o;s)srtmir3iy4om nmieias)sDtru  nu4opeoif3tltfsDel(vo t4 rxomr3tydlmte u sls0 ruoimpoo1amtemies ()aDrr( p;o0apxnii3tldls umuvp () rxrioctydlaDelnvsls)sexrim ou4lp emncs (  rta(mpnu1tle  fctyd m ua(vsnt4 ltrmr3oadlate ivo;(  rxoxmpiu4al e ivsat) Dta(moou0opt mieiatlm eanvp t0trxnirciodopDraivs;() rxoio iu4omtelfvt sfa2rrxrpot0tltoiictlslsDelnvp t0tetomo3ta1fpte i i;t0sexr(o oo1op nmfviatfs2uaxmo;u4optoiiciytfm eanms () rxnxo iatfaDeai slt  exr(o nudlm   fcs sfsDta(rpnt1aexo ociltlm ra(vs;(4 eenxrciy1omD au s;t) rtr(rpoo1lmee fctls sDtmxront0tptnmf3iydlaDemn s t)alermfciy1lpDranvs (  2xoxmpoydlmte fctlsf Dtru o;t4opxnmfeiltfs ra( p;()altrmo tadfmt auesl()teto(opoy1om nlivslt) 2rr( pnu4olxn icild m2em(vs;(4artrmrciytopDrln ol( teumxo3io1apeemncs ( aDururoot4aee  fctyslm rmn sn() rtrmr oa1lm  anei;t0setmir3io1lme lnct s a2tr(r ou1oex  feiatfa2rmu o;t) etrmrcoy1lmtr ieolt0 etoir nu4om nmivtl( aruru p;o0apxo oeiytlaDumn s;u4alenxf iatfm e neo s  rurxr3oodol elnesat aDuru  nu4alxoif3tysla2emu o;(0 lxoircoa1oaD lnes s0sexm(o ou1lpeelics t  Dtruronu4opxn o3iatfa ua( pn(0tlxomo3tadfp eai sls0 rxm(r ny4alee fctas)a2ta(m ;u4apxo fctyt m2elnvont0tltoxocoy1omD  ies;t trxm(m3nu1lmenlnvi sfartr(rpnt4oetnifciltfa rm(vsnt4aeermfciatfaDelnvi;(  2tm(r3oo1omee fvta( artrx p;u4tlt  i3iadlaDra(vs u0aetrxo3oatfatrlueo s)srumirpoo1lmen neilt  2tau o;o1aleo o3iyt mDean p t)texoxfciatlmDranvil(  etmimpoy4ole  ictltfsrtr(mo;u1alx  ictldlsDeaumpn()arxrxrcoytlp   u ilt) 2xoxrpnodlmen nvi (faDrmxrpno4alt mictatlsDel(vo;t4 ltrmocoytoa   nvsls0trtrio oy4ap elnvs tfa2tax oou0opxomfciat s rlumo;u0aetriocoo1om  liei s  etmxo ou1lp  lfetat sDrrxro;t0teen f3tadlaDrlnvo;(4aexnmf3tydfmt  ivs;t)t2to(r oodol emfetat)s2umx  ;u4tex mietysla uaumsn(0treoircto1lm rai i;t sexmim no1am e icia()s2umx o;t4tlxnii3ilslaDem( p;u0alxoxociydlpte uvslt0setrxmpio4op nlnetas)sDumu onu0opxnioctadfs ean s;t0 lenif ta1lm   uei ()setr(r3ny1ame  fvi ( aruaurpnu0oleniicils a umn ont4tetnifciotla eauvs s tetr(rpoydaptn ivtasfsDuaxmont4opxn o3tat aDrl(vo t4aeeoio3todfmDelu s t0sexrio3nu1lmt  fct tfsrrau  ;t0tpxomfctydfsDranmo;()aeerxociodlaD luvs;()trtrxm3nu1llt lictas sDta(rpnt4alx mfciatls2raumpnu4alxomo iotoa  lnvi s)s2ur(m oo4al   ietl(fs2ur(  no1oetnmfetyt m2elnvp t) etrmf3iytopDranei;(0texmirpio4aleemfct (farrr( pnt4aex  ocild s2eau o u0trxnxr iydoptrli o (0 2xrim nydolt lfctas s2tmxmooo1texomfeilsfa2uaumo;u)artrir3tytomDr uei s  2tmio3nydalt lfctltfa2tau  oo1aeeo fciytlaDumumpn(4 rtrmr3oadomDrluvo t0 rurxm oydaltemicias s2ra(rpno0olxo octlt sDum( pnt0tltoif ty1lmtr ies ()teumir3no4ome lneta( s2ra(  ;t0tpxnifciasfa eaumpnt)trxnxrcoatfat  ueo;(0 exoim no4ameemnvias sDra(moou1aetoif3tatfm2eluvo ()trtrmr3oydfa  auvi (0 2to(m3iudolen ivias)a2rrumpou1tlenmiciyd mDumuvo;u4areoif3oodlmte i o;s0 2xo(rpiy4amtnlfet s)arrm(ronu4aleo o3tat s2emn ont0trtomo tydomtraneo s  etrxrpny1lptnlnvias arrrxmono1aex moeiysfm2eaumsnt)texnxr3iatlmtr ueo s0 etrxrpnydlmenlncilt  Dtmur ot0olen ieiatlaDrl( snt)alerxr3oytfm  lnei (0seurirpoudomen iviat)sDtax  ;o0tpenifeiytlaDrau s;u) rtnxr3ia1fatrli s;s0t2tm(opno1ole  ictatfs2trx p;o4opxo f3iasls2rmumpnu0areoir3ty1oaDr n slt) exoimpou1am n iesas sDuaur nu4oleo fetyt m2ean on(0aeeoxr3iydoatr ies;s s2umio3nu4op nmici (f 2taxmoou1oex mfeildlsDrau s;u0aeenxoctytomt  ueolt0tetm(m3ou1apen ivsa(faDururpoo1alx  oeiysfa2rlu pnu0texomr iodopte n i;t) 2xoim3nodapenlfvs t arurx  no4aex miciadfm rlums (4aeeomf oadlp  lnesls teurim iodol e fvil(faDrmx p;u1alxo f3tad a eaums;t0tleomfciydfm e n s s)s2xmim iy4lmenlieia( aDuaumo;t0tlxo oeilsfa2eluvpnu)aeeoxr3oydla rlnei ( truo(opoo1aptelncsl()a2rmx pot1aeto fctlt m ua(vs;u)tlxrir3to1lat aivi t s2umio3iu4al emiei s artaum no1alt iocilt a2el( p t0trerxr iydlatranvol(  rur(r iydop n ivsat)sDuax p;u0aeeomfctasls uanvs u0arxrmf3iydfmte iesl( seurir iy4ale miesltfa2rmxroot1apxn o3tas m ra(vsn()tltniociotopD  n slt0sexrim3oudamt mnvsa()s2ururpou1apen i3iys m2ea(mp (4trxoirciatop  lieol(0trxm(m iu4lpt lnvtas  rtruro;u1opxo fetltlaDra(vo t0 etnmf ia1omte neil(0t2xrim3iy1lmte ncilt)aDtm(rp;o0aptnmfeildlmDuaumo u0texrxf to1fpt  ieols sexo(o3nudape mfcs sfs2ur(mp;o0alt  f3tadfmDeau s u4tlxrmo3todop eanvi;(  2umir3ny4ameemfcil(f 2ta(r ;o4apt  oeiysfsDel( p;u)artomf3oytlaDelivolt seumxmpoo4om elfeil(f ruaxmp;t0tee ii3iltfs2rlump;t4treomr iodom elies;(0texoxopoy4opeelfet sfarrru  no0olenmfeils a2rl(vo;()arenxf3todopD auei;t0s2toirpou4al  lieslsfartr(mo;t4aeen ociltlaDeanvsn(0artnif oytoaDraieo;(0s2to(mpou4oltn ieta(fsDtrxrpou4opx  iciyd m2rmu on() rxrxr tytoaDe uvil( truoirpiudoptnlieilsf 2tau pot4olen ieilslm2emnmo u0alermo oy1laDr u slt)s2urim nudlpt mics s arra( ooo1texomoeiltlmDrmu pnt4tltrir io1fp r n il(0 etmxopnydlme lfvsas  2umx oou1oexoifeiydfm ra(mo;u0texrioctydoateluei;s) 2toxopoy4ll n fvtat srrmur oo0tpt mi3tltla eln s;u0aeerio3ootom r uei;s0seurir nudomtemnct ()aDur(mo;u0oet  ociyt s rm(mo;()arerxfcto1lat lnesl() 2tmimpiy4omt licia(  rtr(r nu4alxo oeilsfm2el(vo;t4 eeriocoytoatrluvi;t seur(mpoydalee fes ()a2uaxm ;u0tleoiiciyd m ulnvo;t0 ltoifcty1opDeanvs;s0truoio oy4ame  fcsltfs2trur nu4teeoioctldfa2rl(mpn()teeomrciatfa  aivi;t0 euo(o3oodole micsltf Dtr( o;t4alenmociltfmDulnmont0 rtrifcoydomD au sl() rtr(o nydomee nvtlt s2rr(mono4apen oetas s rm(mo (0aeenif3ta1lptrlnvi t)trtm(m io4ll emnvi (f rtauro;u1ale  ociat m rm(vonu4alerxf3iytfptran i s0t2xoimpou4ol   ies ( a2rrum ;t0olxnmieiydfsDeanvo t4tetomrcoodopteaiei;s)texoxr3io4am emfcsl( s2um(root1tle  feiad mDul(vp u4 lxoio3iy1fmtrlivils0 2uo(r3oodap  mfeil( s2trxm no1aee iictat sDuauvo;t4texnmf iytfateluei;( srxo(m3ou4am n netat sDtax  ;o4oex miciatls ulumo;(4altomo3to1lmDr u s;t)seto(opnodlmtn nvils s2ra(mpou4ale ii3tydls uluvo;u0trtrmr oo1omDeli i t) etr(rpiu4apt lnvi s  2umum ;u0apen fetls aDra(mo t4aexoxf oa1fa ean i;s)tetoxm oudalenmicslsfaDtau  oo1olxniieiadls2um(msn(0 lxniocoodlmD  n s t  rtrxo nodlm e nct (  Dtru ono1opxoifctasfa2umnvs;(4tleoio oadlpDeauei;s)trxoiopoo1ol elivi t)arum(mpnu0alxoif3iytfm ea( o;(4 eenxfctydomDeauvi t0trto(mpiu4ome mfvs t aDtr(m ;o0tetoii3tltla2uaumsn()trtnmfcty1laDrluvi (0 ruo(r3iodlltemnvtasfsrrmu oot4aeenii3iasfa uanmp;u)arxnxo3oo1fpDrlneo ( trxrir3nydape  net (  2tau pot4tltnmociad a2uluvsnt)treomfcia1fpt lieo s)teuoio ny1ll nlncia(  rtmuront1openifcilslsDelumont4 lenif3oodop r i s t  rxrim3nu4lp elfciltf Drmur ou0oleoioetldfs rm( pnt4 ltomf io1omtr uvi t t2urimpiy4lpt lics s)srua(ro;u4aet  ociyt s raums t)texoxf io1fp e ies;t tetrio nydlmt  iesl( s2rau p;o1opx moetysfsDemnmp (0aexoxo3iadfa r n ols)teurir no4apeelivi (f rum(r ou0apt mf3tyslaDeaumsnt4aleomocoy1omDeau s s0s2xoxm3nu1amt  nciatfarum( p;o4tlt  ociat sDrmumo;t0aeermr3tatfpDrlivi;s t2toio3oudopen fci sfarrau o;t4alxnmoctydla ra(ms t0teerxfciatomD auvo t)teumxmpoo4llenmnvt (f Drrx ont1opx  ocild m rmuvo;u0arerxf3oodfa rln i s0sexrxo ny4lpt lfet t sDtmu  ;u1oexomietydlaDeanmp t)aexoif ia1om  auvslt0tetmir3nudape livia(  Duax  ;t1apenmi3ilsla2eanms;u4aexnxocoodlat  u ols)srtoimpno1optelnvtls  Dra(r ;o0tlxo oeiadfm ranvp t4alxrmfciotfpt au i s s2uo(m iu4op  miet t  2taumpou0apt  iciasfsDumu s;(4 rtrmrciodlaDraivol(0s2tmimpnodal   fvs t)a2rm(r ;o4alxn o3tltls ea(ms t0alxriocty1op e i o;t) 2umiopoo1lmtn fctls)aDtm(m ou4tpxoioeiyd m2raump;t4tetoircoa1fat  ieol( tetrir iy1omeemnvilt sDurumpou4aetnioeiadlm2umuvp t4trtoxr iodlaDrln slt)t2xmxm3nu4lltemnvs t s2tmur nt0oeeomiciyt aDemn s;u0aeerif io1fm e nvslt) 2to(r3no4oleemfetlt  rtau  ;t4ape mf3iyslsDeanvo u)alenircoadlpDr neslt)trxm(o3iu1ale lfviat)sDrru  ;u4tlx  oeiys mDrmnvo u) rtrmociy1fat luvols teuoio oy4ol e nciltf rumum nt0oltnmi3tldfa2rm(vonu0trtrmf3oadla elnes t0seurxrpou1alt mnctas arua(rp;u1tpx iieilsfm2ra(vs;(4 exnifctatomDrluei;s texr(rpno4ol e netl(fs2rr(mpnu4tleomociydfm2umuvonu0 rtrxr oytfm e u sl(0 eurxopio4lmeelfctlsf rtmurpou4apt mo3iatfm elnmpnt0arxrmr ta1fmDean s s0t2umxo iu1omenlfciat sDrax  nu4oltoii3iyt m eln sn() ltoiocoytfm raneilt)s2umir3no4oltnlfei tfarrmu  no0aleo iciadlsDrm(vsnu) etoxo3iy1opDrluvil(  rum(m3iodaptn icta(f 2rmu  ;o1teeo ietadlaDrmu o u)tltrmr ootlmDrluei;(0teurxm3oodlmt lnet ( sDrrxmoot1tltomoctldfmDrm(vp;u)arxnmf oydla  ai i;s0trxmxr iudapee ietat a2umx pnu1apeoiicias s rau on(0 lerif oadfmte u ols setmim iydlmtnliviat srrmx  nt4tlt  i3ias a2uan p u4aeeoxf tydomte ueo ( trurim oydal e ivia( aDtru  oo0tptoioeilsls2rau p u0 etrxo3ia1fm  aieolt)tetr(m nydll emnctat)s2ra(ront0tet  ieiltls2rmu p;(0 exoif oodoat lies s)tetm(m nodom  mieils aDtruronu0openmi3tysfsDumn s;() rxoif3iatom rlnvo;t)s2uoxmpiydlm elivs (fsDrmurooo0teeniiciad mDea( p (4 rxnmfciodfmtrln o t0s2toiopoudlp n fesls  Duaumooo1tpenmiciyt mDua(ms;u)teermo oadfatrai o;s0 2urirpoy1lpt lncia(  Drmumpno1tlxn ictyslsDum( snt0tlxnmr totfpDe u i s srtm(r3iu1aleemnciltfsrtmxrono4aptn oeildfaDuauvonu0alxomo iydomtrluvi s  exrxmpou4aptemfvi s) Drrxm ;o1aetoiiciysfa2eauvo;u)arxomo3ty1lp  aies;s)texoim ny4ol n fciat arrrxroot1tpto fctad sDrluvp (4aetrxf3iy1fa rai s;s0 eurio iudamt miesl(farum( pnt0tpeoifctasfs eanvs (4 ltomf oydla eaies;s srxo(o3ou1omt mfet (  Dra( oou0oltnmfctatfa uaumpnt0 rtrmo oo1fpDrlivi s)sexr(mpiydaltnmnei ()a2taumoot0oeeomiciytfs uanmpnu0aexrifcoy1omte ivsls) 2urir3iudopen fcils arurxmpot1tptnmi3iydlsDul( snu0 exrxo3iytfa r u i () 2uoxm iydlmtnlnvils)sDtrurooo0aexnif3iltlm2em(ms t)trtoio3ootoateaueil(0t2uoir oodll  mfeiat) Dtru p;t0tlx mo3tltlm2rm(vo (4tlxnxo iytfm   uvils) rtmirpio1ll nmfciltf 2um(mp;u1tex mieiasfa2uln p (0texrxf3todla e nvo;t) rtmxm3nu1lm n iesat s2rruro;t1tpxo oetatfa2ran p;(0 lenmo oadfmD anesl(0t2ur(rpoydopt  ncs tfsDua( oot0opeomoeiadfm uauvpn(4 etrmf tatfate uvsls) rxr(r3ou4llen fesa( sDraur nt1texnif3tysfmDeln s;(0arenmo3oytlate neols  2xoiopiu4op emfctas)sDumuroot1apt iieiat aDrm( p (4teeoir oadla  an s t)setrxrpnydam  mfvi s) Dtrumooo0oeeoif3tys m uan s (4aeeniocia1lateaivols trxrxo3iu1amee iet (faDrrurp;o0ole ifetysfa uanvs u)alxrir3ootfp eau sls s2tm(opnu4lp nmfcil(faDtr(r ot4oleniiciatfm2rau pnt0tetrirctydfp rlivi;() 2xrir io4alt  ivslt)sDrmxmpno0alx ioeiydlmDul(mp;u0alerio iydlptrlies (0sexoim3oy1am nmfes tfsDtau o;t1aex  o3iadls2ulnvs t0arxomr3oo1opDrli olt  exmio3iydlme liesat s2ta( ono1olenii3tlt sDra(ms t4alxrxo ootlm r i s;s0 rto(m iydomtemivi () Drr( poo1oleoifctltlmDemums;t)arxnir3iodomtelnvi;( t2toxr iy1lltnlfctat  2rr(roou0alxnioeiydlm emuvs;t)tltomo3oatlaDr u i;t0 2trimpoy4ale lieia( srtr(mo;u1alxoifetysfm2eau p;(4arenxo3tadlpD lnes () 2trxr io1lpen nvtat  2umur ;t4aet  feiys aDrauvsnt4 rxrxfctotoaDe ivo ( s2xrxm iodopt micils  Dta( p;o4tex ifeilslm ulumpnu) etomr3ta1fp  ln s;s)seumxmpiudomenlfcia(  Draur ;o4tpx if3tydfm emnvo u0 etrmr to1faD  i slt)sexo(o no1omtelnvsl(f rtmx  ;o4oee  oeiatfs ulnmo;t0aetrxocoatlmteaies (  exmxo iodameelfesls) 2rmurp;u4opto ieiysfmDrmuvp t0tltrxr oadoatraivi;t0tetmxrpiodop emnet s  Dumx  ot1teenmociaslaDrl(monu4 leoxocoadfm eliei s)texrxm oo4lme  fcil(f 2uru  nt4aet mfciydls uluvp u)trtnxoctytomD  ueo;()t2xr(m3no4om e nctls) rrm(ro;o0aee  iciydla umn s;(4teerif tydopD li sls)t2umio3io4llt mnvtltf 2rru o;u1tpx mo3iysls2ea( on()trxnif3todfat  nvo s tetoirpno1apeelfvt tfsrrmumooo1apeniociasla rl(vp;t4tlxnmo tadla r nei;s  exrxm no1lmenmnctl()a2ur( p;o1tptomf3tlsfmDrm(mon(0trerio ia1fatrln ol() eur(o3ny4ome mics t srua(  ot1opxnmfctldlm2emn o t0 eeriociy1fat  n o s seumir3iodale livs ( sDrrxr ;t0olxoioctyslmDrmnvs;(4 eerxfctodfpteau sls) exm(rpno4omt liciasf Dtrxmpoo0tpx mfctatfa ul(vp;u4 rerio3oydfpDrln sl(0teurxr oodamtnlfciat) 2uaur no1tpenmo3iydfa eanvsnu) ltnif3tadom eln sl(0seto(mpoudole  nctls)aDtrx onu0tltoifctldlm2ulnmsn(4artoir oadfpt anei;( srtmxrpou4lp  lfct (f Dtau ont1alxnifciadlaDumnmont4 eermo iytfpt au slt)seto(r3iu1omen icsat)s2ta(m ;o1tlt mfciat aDemuvo;t4 lxoxf totfatrlueo ( s2uo(opiu1op elfctl(fsDraxro;o0tee ifetldfa2ulnvsnt4 exrxr3oo1oaDrauei;( srumxmpnydolt mfes sf Dtaurpnu0tee mi3iysfmDuanmonu4aexrmr3oo1lm e nvo ()t2uo(o iu1omen ics t  Dtmu o;t1alt  ociat mDulump;(4 rtomr to1fpteln s t t2ur(o iu1opeemnetas)sDtrx  ou4olto octaslaDumnvsnu0teerxo to1fptr i s;t0seto(m3nydlmte feslt)aDuaum ot4tetnmi3tad a ua( p;t0 rtoirctodfatr u ils srtrxm3no1omt livsatfsruaxront4tlx  fctasls rm(vo;t) rtrmrcoydoptrau o;s0t2xm(mpoudapenlneias)s2raum no1aetnmictysfmDumumonu0 eenxr ty1omDe nes ()tetrir ou1llt licias) rumxm ot1olt ioetldfm rluvsnu4tlenifciydfaDr ieil( s2to(r3oydop  mietlt)sDrmu p;u4olx io3ilsfa2rmuvo (4aexnxo oydoaDr ueols) rxoxr oodamtnlieiat sDra(ront0open feias a ua(mp u4 eeoio oatoate ivi s)trxmxm3no1omeelncsltfaDrr(m nu4aee  o3tys s2el( p;t0altoxr oytomDrau i t0texo(o oodap n nci s srur(mpot1ale  i3iltls2umn o;t0 lenxf3todopDe neils0seum(mpnu4ol  lictat)srrmurp;u4texomf3iasfs emnvp;t0teermo3io1oateaivs;()trtoxmpny1open neia( aruau ont1tltn f3iad m2ulu s;u)arxoxociadlateai o ()sexo(o nydlmtnmicils s2trxr ;u1apenii3tatfa2el(mon()trtnxo3iodfmDrau o;s)texrim3oydlp nlnetl(fsrum(m nu0aleomoctys sDean pnt0aeermo oytfm r u i;( srurimpou1op nlivs sfsrtaum ot0alx iieiatfs umnvp (4 eeoioctatomDrauvo t0 2xoxm3iudam  lieiltfa2umu poo0alen feiyslm2eanms;(4trtnir3tadla elneo;s0sexrirpoodope  fci t  Dtmur no4apeoiieildfsDrauvp ()texnifctydlaDrlu i s0srxmim ou4lle  nesat  2tmx  ou4oleoiiciysla2el(mp (4artnirctytomDrlu o s0 eto(m nu4ap n net tfs2ur(rpot0aet  ictldfsDumums;t0tltomo3tadlat lues s srtm(rpnu4ape lieta(fsrtr( o;u0aeenmo3iadlm2eanvo t4arerio3ootoptelnei;t) etoxo3oydopenlfei tf Drmxm ;t1apt mi3ils mDrmumo t4tlenxr iodfp ran s;t0 exo(rpou1ope  feta()srtm(  no4alt mictlsfmDeau o u4aetrio oydlp ranvsl() rum(r ny4openliesl()sDur(monu4aex if3iyd s ea(mon()artnircta1laDrlneo;t)teuo(o oodllen fct s sDuau  no1tex  feiydfm uaump;() leoxr oa1lptranvo;s sexm(r3oy1lmen ivtasf 2rrurooo1tlenmoctatlsDum(vo;()alxnio tydfm rlivil( t2umim no1lpe  fvslt srrm( oou0oeeomfeiadlm2em(mpnt)tetoir3tadopDrauvo s  rtrxr3nu4omtemivs s)sruauronu4texomfetltfsDuanvs u)areoif3ta1oatrau o s0s2um(m3no1op emfetls  rua(r nu1olen f3iyd m umu s t4tlxnif totlatrli ilt)s2trim oo1lmenlnetatf rumx  ot1texn oeiat s ua( snt4alermo oadfaD  ues;s0 2urimpiodlmen fvt (faDra(rpot4texniictasfs2rln s u4tlxnmoctydop elieo;(0teuo(m nodlptnmnvta(fsDra(moou4aexn i3tysfs2emnmp u0aetoxo3ta1faD  i o s)truo(m nu1lme lnei t)s2taxr ;t0apxn ieiyslmDrmuvo;t4 eermr oadfa e i ols0 rxoirpno4ale  nvias)sDuauro;o0apxomiciat s2uluvo;t) renxocty1oatelu sl( trum(o oudam nlfeiasf 2uaxr ;o0oltomiciytfa2ean p () rtnio io1lpt ai o;(0s2toimpio4am e fvtlt)srrrur nu1oee mocild aDuanvs u)tlxrirctatlp  au s;s)tetrxr oydolenlfvt t arrr( p;t1altnmieildfm raump u0aleoxr oa1laDrli o;t)s2uoim ou4op n nci ()a2urxmooo0tltoioeils a2um(mp t)trxnxf3oy1fatrln i;s0srxrio ou1ap  lneias)sDrr( pnu4alxo iciydfm eauvs;t0aetomocia1fm rluvi;t0 exrim3iydol elnvt s) Dtr( poo4oleomoetytfm rmn o u4 leoio oydom raies;s teurir3oy1lpenmfciltf 2rmu  ;o4tptn fetlt s2rmu s;u)tlxnio3oodomDrluvo t0 rtoxo iy4om   nctasfaruru  oo0texoiiciydlsDuan pnu4trtnxrctydfpD  ieol(0t2ur(m oy1ol  mfvs sfaDrr(roou0olt mo3iatfsDrauvon()tltoio oydfpD liesls)texm(opny1amen ietls) Drmur ot0tee mictydfm2ranvont4tlxnmr3ty1fmDr uvol()trurxm oy1ap e fesltfa2raurp;u1apeo feiat mDrl(mo (4aexnmo3oy1fpD aivo;t texoxr iudlm  mfesl(  Dtr( p;t0olxoifctlslaDum(ms;(0aetoirciydfp r ueo;s teuoio iu4lpt mnvia( s2ua(mpno0aetoii3iyd sDua(mp t4trtrir3iotlatran i t0t2xoxo iy1lm n nes t srur( o;t0aexnifeiltla uanvs u0 reoifcoodfmteauvsls s2xm(mpiy4alen nvi (fs2taumo;o4aptn oeiat aDuauvo;u0aeenmf tatlmtelnes (0 exrir oo4optnlivslsfarrmur ;o4tlxniocias a2rauvo t4aexnxo io1laDr ivolt) rxrxm iudaltelnctltf rrm(mp;o0olxniieiasfs uluvonu)arxnxo3tytopDelnvil(0 rtm(r3nu4ap  lfciat s2um( p;o4aptnmo3tysfm ra(vo;(4alxoxocia1fmDr nvolt trumxo3no4ome mieia(fa2raumooo0aeeomfctysla rm( p (0 etrmo oadlmDrlivilt  2xrio ou4amee netls  2tr(mo;o1tpen ieildfs2rluvp (0trxomociatfpte ieo;(0sexr(m3ou4oleemncsls artau  ;o0olxo o3iat sDumn o u4tltnmr iytopDelnes ( teumxr3no4lmtelicsatfsrururpot4aptn octys a2rm( s t0 exomociydopt  i ils0srxrxmpiu4al  lfciat) rtaxmoou1tltnmictyt s rmnvpnt)texrif iotlmteai o s0s2trio3ny1ll e nesat a2tm(ront1aexn fcild s2eaumon(0artnif oadopteliei;( seumiopny4llt lnciatfaDtrxro;o1oeen oeiydfa2emnvs;(4 eenxfcootoptr nvsls) rumxo iydll nlfvtls) 2rrur no0aexn fctasfs emumonu)aeerxf ootoaDr iesl( teurirpnodalt lnes tfa2tm(mont1aetnmi3ilsfs2rm(mpnu)aetnmr3to1fpD au s;(  euoxr3ny1apeemnvtltf rrrx ooo1altnioetatfa2ulums t0 exrir3tatfaDrln il()srum(mpou4lltnmfvi (fs2ra(  nu0tpxomictydlsDelnvsnt4trxoifcoa1laDeaneilt) rxoio no4lpeemnvs sf rtmx p;o1apxnmf3ild mDeln o (4aeenxo3iadomtr n ols0 2tmxrpnu1lmt  nesas) 2taum nt1tltn o3iat m2ua(mpn(4 eenxf3iytfateaivolt sexoxr3nu4om n fci t a2rrurp;u0olx  o3ildla umnmp u0arxrmrcoytfpt auvi;t  rumimpnu4al e neilsfartmu  nt1aet mieild mDelnmo (0arxoio3totom eanvo;t  rtrio ou4am nlncs t) 2rrumoou4oleomf3iaslsDrluvs;()treoxr3tadfaDeauvolt0 rtm(m3iu4lm elivsas) rurxm ;t1tle ifeildfa rln p t)teerxrcia1opDeaueilt0setmxm3io1am   ict () Drrumpou1apxoiociyslmDemumo;t0tltoxf3ootlpDr i ols)seum(m3oudlmt mfcs t s2rrxr ;o4ope ifeils s2ua(monu0aeenmocoo1fp e uvs (0s2xrxr3no4openmivsl( arra(  no0opxnifeildls ul(vo;t0altnxocootlp  au s;s)trxmim3iu4ll nmncslt)aDuau pou0oltomociad a uan snt) reoif3tatfpteauvs (0 euoir3iy1ameemfcil( aDraxro;u0apeomfciyd a um(vo;u)tltnmr oadfat  uvo (0 rumir oydam   nvtltf 2rr(r ot0oeto fctasfaDrl(mp;t4aeenir3oydop   nei;s0trxr(opou4amtelnvils)aDtrxm ;o1tetomfciyd sDulumo t4trtoifcta1fptelneo;()srumxmpoodapte nvil(farrrx pno1tpe io3iytfsDumnvsn(0aexnxf3ta1fptelnvol()texo(rpiydalt mncsls)sDur(  ou0alenmfciydls rlu o u0alxnir3tatfp rlnvs t)s2toxr iy1lmeelfvtlt) rtrumo;t0alt mo3ilslaDumu o t0aexrmr3ta1lmDeliei;(0s2uoxrpoudamt  ivs s)srta(r ;t1aleo oeilsfaDumu p;u) ltnmf3iatlat ln s ()trurxmpoo1lm elnetatfaDuax  ;t0oexn ociadlsDelnmo u0 eeomocoo1fp ranvil()srtoiopoo1oleemiet sfsDrrxrp;t0tlxnmfciat sDeaumpnu0 lenxocty1fpDe n i;t t2um(o3io1ol nmfeias) ruaxrpou0olxo ieiad s rau p u) rxnmoctadfaD  ueo s) rxmxm nudal  lfcta(  Dururpot1oet mictas aDrl(mo;(4trenmf3iatfpDr nesls teumir3io4op n ivtltfartrxrp;t1tpeoii3iltfm2umnvpn(4arenxr oadop e nvs s0 2xoimpio4omeemivsl() Duaumono0oeen oeiltfm2em( o t0aexrir oy1lmDrauvi s)seumim ou4ap   ivs t s2rrumpnu4apx mfctltfa uan s u0 rxnxo iatomDrau s;(0teto(r nu1optnmfcsl(fa2um(r ;u1alenmo3tytfm rlu o u4 etnxr tydlmtelies (0 exmim3iodll n fetltfarua(ront4tlxnioeiad aDrmnmsnt4tetrxf3oy1fpDeaivsl()trurirpio4olt mieil(fa2trxm ;u4ape mf3tlt m elnms t)trtnmocootfmDe uvo t)srxmimpiu1ol n neils  Draumo;o1oeeoif3iltfs eaums ()texomr3tadoatranvslt0 rtoim io4apte ies (f rururono1apx  f3iydlm rauvs (0tltoioctytop   nvo (0 rxoim3io4olt livsat a2urum ;u0olen feiadlmDemn sn(4 eerxo iotlat auei;t)srurxo3iu1ape mfctlt)sDurxro;o4tlx iiciydlm2rluvp ()trxnmo3oa1lpDrlnvs t)s2xr(r3ou4olte ivil(  2ra(  ;t1oetn octlt s2raumo;()arermr tydfp eluvolt0t2umxm3ny1op  micslt  2tm(m ;u0aeeomoetysfs2ea( o;()alxrmo to1lpDe ivi s)sruoir iu4amt mneia(fs2rau pnu1tpe iictlt m eanmo;u0 lxoif iydomD lu o;()trxoirpou4ol elictlt) rtrur nu4opx ii3iadfs uau pn(4altnmrcio1fmD  ues t)srur(rpnu4op  lfcsas) Dur(r ou4oeeoif3tytfsDea(mp;u)artoir todfp r nvslt)teurim oo1olen fct (  Dtr(mpot0tpxomicilt a2ul( pnu4artoifctadfpD  u o;( seum(r iydopt  iesasfaDrru pnu1tlt  ieild m2em(mo;u4arxrmo iytomt lneo;t)trtmxr oy4op  lfci ()s2tm(mpoo0alt mf3tatfsDumu o u0trtnmo3oa1omtelnesl()srxoim3iydalenmies ()sDumu pnt4apeomoctytlaDulnvs u0aeerircoy1oat lieolt0teur(r nudaltn fvtl(fsrua(rpnt4opeomictltfs eauvs;u)aeerio to1fpte nvi s0t2xmirpoo1olen fci tfa2um(  ou4tlt ifciaslm rmuvp u)tlxnifciydfatrlivsl() 2xmim iudal   ivtas  2um(  nt1tpxniieiasfsDrlump ()alenmo3ty1lpDr ivi t)t2trxr3oodlmtnmietat) rum( p;t0oet mietld a ua(vp () ltrxocoa1la rlueols tetrir3io1llt mnvsat) rrr(rpot1aeenmocias sDrmnmo;u) leoirctydfmtelneo;(0seuoim iu4ll n fesa()arua(r ;u0oet iocildls2ranvon(0 eeoif3oodfaDrlneo;( trxrxm3io1amen nesat) rtrxmo;t1opxo o3tlsls2rmnmo u0 rtniociatlmt  uvi;t0 euo(rpiu1llte nvt
\ No newline at end of file
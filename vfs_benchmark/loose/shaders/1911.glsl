@@ -0,0 +1 @@
+uei;s trxm(m io1lm elivtlsfaDuau  nt4ope  i3iltlsDrlumo;t0artomr3oodlaDe uvi s)s2xmirpoy4lp emiesl()srrrurp;t0oetnmociltfm2uln p;u4tlxoio3iatfaDelivs (  rumir nodaltelicilsfsDrmxrp;o0oex miciytfm el(vont4 eerio to1fmD  n s;t0trxrxo3ou1lmt mieil( a2umumont1oexomoeiydfa rau o;t)tlenmr3oa1oat au i (0seto(m oy1lp nlfcsa(  Drr( pno4tetomf3ild m2umnvont0tlerio oa1fmDr ivo t0 2umxr3nydapen ieta( a2ua(r no4tetomoetyd mDul(vs;()artoio to1fptrluvo;s  rtoiopiu4opt lnvsl() 2rmxmo;t0tptnmfctas s umnvpnu0 eenirctadfmDelues s srtoxopiy1lptemfvt t)s2umx  oo4aetn o3ilsfmDel( pnt4aexnioctotomt  neo;t seuo(m oo4ape mivt s)srtrxr ;u0aptnifetytlsDuan o u0aexrmoctadfpDr u ol()trurxr no1ole mfcsas)arum(mp;o0aetnmieiad aDranmo;u0 ltnioctydlm  luei s)t2uoir3iu4ol emnvsl(f Draxm nt0teto fciydlm2uau p t4 eeomo to1faDeaivo;s0t2uo(mpny1lptnlnetas) 2rm(  nt4ope ii3tysfaDrlumsnu)artoifcio1fat  i i;t  2to(o nu4lpee nei s)aDrr(m nu4tlt  o3tld mDea(ms ()aeermrciotoa rln sl() eur(m ny1ol emivt s) 2trurono0texoiietltlm emn onu4aexoiocootfpDraieilt) 2xo(r oo4lpen fctl( srrrxmont1tlt mfetlsfsDulnvs;() etnxociytoptrlues;t0t2xriopoodomtnlfvi t)a2uru o;u4oet ii3iytla2uluvonu4 rtnmr ootfaD lnvo;t0trxmxopno4ame lnci sfaDtmxro;u4apxniietat sDel(vsnu4alxoir oydlmD  i o ( sexrim io4aleemncslt)srurx ono0ole  oeild s rm( onu) rtoircoatfa eanvs;( s2uo(r ny4alenmieia() rumx  ou1aex ioctatfmDemuvs;u)tetomr3tadomDr ivils0srxm(m3oy4ope lnes s) rtax pno0opt ioetlt m2emnvpnt) etnmr3iytopteli ol( tetoxo3iudamtnmfvtat  rurx  nt1alxoiociysls2uauvpnu0aexnio3oatlpDeln ils0teumirpnu4aptnmfvilt)s2raum oo4oetn icias s ea(vsn(4altrmr3tytfateaivol(  2tr(m no1am  lfet s) 2tmurp;u1tlxnif3tas a rln s u0artnmociadlp  lnvi (0 rxrir nu4al e iet t)sDuaxmont1opxoio3tatlm rmuvs t0 lermfciydlaD luesl( truo(opio4ol nlivs (f rrr(rpou1tpxn ieiltfaDua( o t)trenif3ta1oaDe uei;t)t2uoimpny1olt miesas  rur( p;t4aexomoeilsfmDulump u4tltnmr oadfp e ies t)tetr(m no1apeelnvs ( artrurooo4oex  feild s2el(mo t) renxo oytla   uvi t t2trxmpoudlpenliciat sDua(mo;t4texnmiciytfm2rmu o;t)arerxf iotfmDeaivols  2tm(r nudome  fct t  Drmxrp;o0olen f3ils m um(vs;t4 lxrxrctotomt anvol() rxriopiydal  lnctlt  rum(rpot4ape  ieiydls2umuvo;(4 rermrciatlp rlieo t0texm(m iodlpt mici s)sDtr(ro;o4tetnmocildfs2rlnvp;t0 lenxociytlp rai i s)s2xmir3io4ome mfcs t  2uaumoou4altnmf3iad a2rln s;t)aeeomfcio1oaD ai o;s0 2xm(r oo4lm   fctls arrrur ;u0opxnifetat m eau o;(0 leoxfcty1fmtrlivil()truoxr oodamtemivi t) 2uaxrpno4aee  iciltfa elu p;(4trxoxf iadopteanvi ( srum(o3ou1ole lictasfaruaxm ou0aeen ieiadlm elnvp t0alxoifcoo1fpDr nei;s0s2urim3oo4amen nctatf Dta( p;t0aexo iciyslmDrlnvs u4 rermr ia1faDeln s;t0 etoxm3iu4ole  nctatf 2uax  no4tptomi3iltlm rauvs;u) lxrif oatfm e nvilt0 2xoxopiy1openlfcil()aDrax pot0oetn fciasfsDulumonu) lxrxf iotfmt anei;( srurimpoo4opt lfvs s)sDtr(ro;u0aee  oeilt mDra(von(0 exoxocootop e n s (  rxo(rpiy4lptelnesls s2rrxmpot4oetoifeiltfmDum(vp t0 lxrmr3iodfpDr ies s0s2xoim3ny4amtnmieia(f 2raurp;o0oetnmictys mDemnmpn(0areoxr tadlmt luvs;( texr(o ny1alte feslsf Durur ;t4aleoioeiyt m rluvsnu4aeenmf oo1oat livo s0srtrxo3iu1lmtemietat)srum( ooo0altn f3iysfsDeaump u)teenxf io1opteaueils0 rtoxo ou4am nlfctat)a2uau  no0opxo oeiyslmDuan s;t) reoxocto1lpD lnesl()trxmxmpno4op nmnvtlt s2tmx  ou0alt mi3iltfm2um( o;u0 eeoxf iodoate nesls0seur(m3iudaleelfct ( s2urx pno0alenifciasfsDeau on()aexomf iytlmD aueils0trtmxo ny4om emfctat)s2raxm no0alen feiysla2rmnvs;u4arxnxf3ty1lpDrluei s) rxoim ou4optn icslsf rtr( ont4oeeo o3ild m2emnvp;()aetoif oy1laD auvs;t0srtrir3no4lmenmfvsa( artm( onu4oetnmf3ilt mDrl(vpnt)altomo tydfateln s;t  rxoir3ou4lle lieta(f Draumonu1aexnifetasfsDrl(vpnu0aleomr3tydoptranes s0seur(o iydlp  mnvs (  Duaumoot0oeeomiciytfmDul( o t4aeermoctatoa  ln i;(0srtm(m3nudlp elfet (farrmum ;u1tee moeiydfm rm( o;()tetoio iadopte uvi;(0 rur(mpiy1lpt mnvsl(fs2rr(moou4oltoioeild m ra(mp u)alenxr tydlatrau il( teumxm no1omt  ivi t sDurx  nt1olt ii3iatfs uaump;()trxoifcoatla   nvolt) 2tmio nydol nmncsasf 2ta(rp;u1tlxn f3iytfmDua(vo;u0 ltoirciy1om rli o;(0 2xmio no1lmte ncslt aDua( o;o1aex ii3tltfaDuau snt0tlxriocoa1fm   n ols0t2uoxm nudap   fvias sDtmump;o1openii3tysfm ul(vont0 etoir oo1fmDrauvils t2xm(m iy1om nmiet t) Duaxr ;u0tpenif3iadfsDrmnmsn(0altoiocoa1lmtean i s) exmir ny4ol elnvsl(fs2rm(r oo0tlxnmf3tls s2ul(msnt4 reomfciatfatr uvsls0t2toxm3io1lpen neiat)sDtmxmont0tptomi3iasfs em(mpnt) eeomf oydfp  anvi;(  etoir3oy4lmtnlncsas)aDtru ono0olt if3tas m2ran pnu4tltoifctadom rli slt0srum(m3oo1olt livils) Draum oo4oet  ictytlm ua( pnu0tlxomfctydla r u ilt0 exo(m oo4openmivsa(fartrumpou1ale ifeiyslaDemn o u)aleniocoo1fp rlu ils0setoxm iodlptnmfctl()s2tr(rpoo4tltoiocildfa rlump (0 reomf oodfmtraueils0 2um(r3nu1lm nmfei t)a2taumpou4olx  o3ild m2rmumo u)treoif3oydfpD  ies ( s2to(opiy4amenlncs s)s2uaumont0olx mfciat a2umuvsnu) leoxf ta1fmDeluvs;s texmxr iodlle mict (  Duru o;o0tlt mfciatfs2ea( o t)artrxf3todlmD lu s s0teum(m3iudome lncs tfa2rrxrp;o4olxoiieiasfs2ulnvs;u0aetoifctatfmDe n slt0t2xm(rpiudlmt  ncias)a2uax pot1olx  fciyt s uanvp;u0 lxrxr ootoat  ueo;( srurir ou4aptnlnciat)sDta( pno0tpxnmo3tltla ul( s;u4aexnmo ta1laDe ivol( tetoio3iudapen ivia(fsrraxmpnu1ale  i3tas a2uanvonu0alxnxf tatlmDe neilt)trxrxm3iydaltelfci s)s2ta(mpoo4oeen i3tyt a rm( ont0 eermo todfp r nvs;t t2toimpoy4om  lfvil()sDrmxroot4aeto oeiyslmDrm( o t4aetnif3tatopDe n ilt)texm(r3nydop elnesl(fsrtru pnt4oltoifeiys a2umn snt4 etrifciydfmteauvilt) 2toirpnu4op n fet s aDururpot0aexo feild mDul(mp;u0aetomf todfpD  n ols)t2trir3iydlltnmncsas aDumumpno1olt io3tadlmDeanvo;(0 etnxrciytlmDe u i;()texmir ny1al   ncs t sDraxrpot4oet mfetysfa2rm(monu0teeoifcoatfa r nvo t0t2urxo nu4om elneils) rtaur no0oexomfetlt s2ea( o u4altoio3iodomt aieo ()t2tmxo iu4lmt  ivs ( aDraum nt1tlt  f3iysls2elnvp t) reoxociydlptrln s;t truoxmpou1opt mncsas) Dtm(  ;t4tetoioeiyt m2ea(vpnu4tlxrir3iadlpt li ilt)seuoiopou1ole  nci ()aDrax  nu1opto ieildfm2emuvs;(0 lxnmf oydfp   n i;() 2umxr iy4apt lnct tfsrraxroou1oexo fctyslmDrlums u0 etnifcoodomDeaivs;t) 2tm(m3iy4lm nmivsl(fa2uru ooo4tex ii3ild m el( ont)aetrmrcoo1laDr ivo;t) exr(opiydome  iesat)sDur(rpoo1tpeoiieiltla um(mo t4aetrif oa1fa rlu s (0t2tmim nu1am elivsls)sDururpno0tlxoio3iasfa ulu p u0 exnxr3oy1laDeauesl()s2toio ny4lpen fvs tfaDtr(  ou1apxomiciydfmDem( pnu4 ltrmf3ia1lp r nei;( srum(r3oo1lpen fcil()arumurp;u1tpeo ociadls2rmuvs () rxrif ty1lmtrlneo t)texoxr io1lpe livsa(faDrmx  oo4oeeomfetldfa2eauvonu4 renxr tadlaD lu s;s)truoimpiu4lp  licil()sDrmurpnt4aeenmo3ilsfsDranmp;t)aexomr iotlatrluvi t truoxo iy4lm  livtas s2raumpno0olxnmociys aDel(vs;(0trtoircootlpD  ies;s  euoxmpno4ameemiei ()aDumx pnu4tetnio3iyslm2ulnvs u4trenif3totopDeai o t)s2tmim ny1ap elncsltf 2trump;u4aeeo i3iadls2ua( s t4arxrxf3oy1lp   u s s0seumxo oo4altn fei s)sDtmumonu1aexo fcild s2rl(mo;u0 exomf3ia1latrli i;t)srtoirpio4ape  fetatfsDuru  no4tetoiietld m2raump;t)aleoxf3io1latr i o (0s2toxo3oudaleemfcs ()s2ur(  no4optniieiltfa2rl( o;u0tlerxo ty1laD lu s;t0 ruoxr3oodole lictasf 2trum nt0teenmfctasfa2rauvs t)alxrif ty1faDrlu s (0seurxopny1lmtelietls)s2trurpot1alx ioeiatfm2rauvp u)aeenmo io1opt lieol() rxr(opnydol elnes sfaDrmx p;t4ale mf3tydfs2um(ms t4alermo tydlmtelues t)srxrxrpnu4lmtemivtas)s2ua(m ;u4apeo feiatlsDranvont)aeermo todlm   uvs;() 2to(rpio1ap   ics t) rum(  ;o1oleo iciat s2eluvs;t0aleomfciydlateluesl( texmxopoy4lmtnlivt s) 2rru  nu0tpe io3iydla rl(mpn(0 lxnmrctadlmtrluei;t0t2trio3oo1lleemncsas)aDtmum ;u0teenmoctld sDum( s (0trtoxr oydfm   nvolt  ruoxm oy4lmtnmfes t)aDtaxro;o1tptn ieiadfs2rmnvs t0artoxr3oodoate n o;t0 exmio io4aptelfvs t) Drmx ooo4oltn ociadlaDrlumo u) reomf to1latelnvi;(0 exo(r iodlm nmnvt t)srua(mpno1tpeoifetldfs eauvont0 rxoio oa1om e uesl(0texo(o3oy1lm  lnvs ( sDrr( ont0aeto oetas mDumu on(4 leoio tytfpt aieol(0s2tmxr ou1ap n iei sf 2tr(mpnt1aetoii3iytfmDran o;t4teenxoctydla elieo;s  exmxr3oydlltemivs t)aDrm( p;o0teenio3iasfmDemuvp u4tlxomfciodlmtr uesls)teto(rpoy4lmtnmfes ()srumump;t0oleniieiasfs2um( s (0artoxo3oadopDraiei;s) rxmxr oo4ol n iei s aDrmumoou1tetoifetytfsDeauvp;u0 lxrxr3totoa  aueolt)t2uoir ou1ole mfctls)s2tmu ono0tlx mfeiat a uanms;(0 leomrciadfpDeaues s truoir ou4aptn nvtas aDurxmonu0optomoeiadlmDumumo t) ltoir3ootlmtelnvo t0seuo(o ny1lmtnmfvs sfsrtr(r ;o4apxn iciatlmDea(mont4 leoif ta1omDeluvol()srxr(m3no1om elfcils  2urxmpnu1aeenmo3tytlmDrl(vo;(0trtrmfctadoaDrlnes;t)t2xm(o3no4oltnlfeslt)aDrau p;u4tpto octadfa ra(mo u0aexrmf3todopt lues s) rurxopny4op emnctl( srrr(r ou0apt mi3iytfa ulnmon(0tlxnir3tytlp eluesls)s2toir3nodap n ict t)aDraxro;t1oet moeiadfm2ua(vs () rxomo oodlmt an il()setrirpio4ope lfes () 2uaxmpnt1aetn i3iatls2uluvpnu4tlermo3ootoate neilt)trxo(m ny4oleemfvi ( aDtrxr ;u0oltoiiciatfs2rm( onu4aeerxocoy1omtelnes t  rtr(m3iudlltnlfci ( aruaxmooo0olx  oeiyt a2uln p u0 lxrxf tatla raiesls0sruoxo3iodamt  fcias sDuaumooo1alxomoeiadfa2umnvo u4artrxo3tadlpDeanesls0 rurxr3oodaltemnetas)srrm(m ;o1teto fetad a em(ms u4altnxfcoa1optrlnvs (0 rtmio3iy1omenlictatfsrtrxrpou0tle ii3tyt sDumump t)alxoifcoa1fatrli ilt) rumiopoy4opeemnvia() 2umxrpnt1aetnioeildlmDra(vp (0 lxnif3ia1lm e n i (0trxrir3nodlmt mfeiatf Drmumo;t0tlxo fetlsls2ea( o t0 rxoxo3oodomte uei;s sexrxopnu4altnmnvi t s2rr(  nt0teeomfeiyt a uaump t4tlenio oy1lpteln ils) eurxm3oo4aleelici s)sDrrxmpou0aeen ociys mDumuvo t)teeoxr3iatopDelneslt0 2trxm nu1olee nvs sfaDrrx pno1alxn o3tydfm emu p;u0 lerxrcootlaDraivilt)trxo(m3nydap e iet () 2trxmp;u1alxomi3ilt m2ran ont4aetrxo ty1fm ranes () rxmxr3ou1lm elfctatfaDta(m ;o4alxnmf3iltfs el(vp;(4aexoio3iytlpDrlnvil( s2xm(opoydoltnlnvsatfa2ur(mpoo0tlxomfeils a2rauvs (0 ltnio oodlmtrlu slt) 2ur(m oudlm nmfei (  Dtm(m ot1ope micias a2ul( p t4 eermo ta1oatranvi s  exmio3oodlp nlivs t a2tm(rpno0oexomiciatlm2el(ms (0teermf oa1faDelivi t0srumiopio1lp e ieslt)arrmxrono4opeoioctatfsDum(ms t0teenxf3oytlp r ieilt teuo(opiudlmte netlsfa2rrxrono1olen feias sDemuvpnt0altnmocoa1faDran sl( t2xm(rpnodlmeelnvtat)s2tru pou1texoiiciyslm2rauvp t0tetnmo iytlate nes s) 2xoirpiu1apen fvtl(  Draumo;t0tetnmocild aDulumo t)aexomfciotlp rlu s;s0trum(mpiudame mneilt  Drmx pnu0olt ifctyd sDrmuvo u0tlermo tatopt  ueils) 2to(o3no1lp elfcsa(  rrmxrono0aexnmi3tat sDumu o;u) rtoir3ta1fmt an olt setrxr no4lptnmiesat) 2uru o;t1ale  oeilt a2eln on(0alxrif3oydlp rlneols)srxrxo3nydom n iviltfs2rmxm ;o1oeenmfetydfm2uau o u4 lxnxocoytopDe ueo s  euo(r iodaltemfeilsfartrxrpno4apx iictatlmDrau on() eeomf iodlp e neo;s srumxr io4ome lnvtlsfsrta(  ;u0tpeniieils a em( snu)trtnioctatfatelues;t)teurimpiu1open icsl( srra(moou4oetnioetls a eau p u4 eeoxf3tytfa  lnvil(0setoio3oydllen nvi ()arua(mp;o4tex  fcilsfmDul(vp;()areomrctatopte n o s)setrio iu4apeelfesl(  2rau p;o1tlenmfciadfm uln on() lerxr3ty1la ranesl() rtrimpoydlmt  iviatf 2ur( pnu4oet  o3iyt a2em(msn(4 exnxf3oy1la   uvsl(  2xrim oy4omtemicsasf Duru oot0aee  ocild a rl(ms u0arxrmocoytlp ean sls t2xmir3nudlltemivta(f 2ra(rp;u4optoii3ils m eau o t)tleoio tydlpDrluvo t t2to(r no1ap emivt sf rrmxmono4oeenioetatfmDulnvp (0alxnxocoydfmtrlneo () 2uoir io1lptn fet t)arta(moou0ope mociys m2em(monu) renioctotfmDean s s  rxo(r3io1altnmiet (f 2rax pot1tlxomociltfm rau s u0altoir3iotlm  auvo;s t2xo(r oo1om emnctas)s2rmur nu1apxnmfciasla2rau o;u0tlxrir tadlp rlnesls  euoxrpno1ap elfcs ( arrmxro;o1olxomociatls2ulu p;(0 etnxo3iatlaDeaieilt)setmxmpio4lp e fcsat) Durxr nt4opxo fctas a2ulnmp u4tlxrirciotomteli i t s2xrir no4al emfvi s)arumx  no1aexn i3iyt a2um(vonu0 renmf tadoa  lieil(0s2trxm nodal e fctat  rtrum ot4aptomocilt mDra(mpnu0 lxoir tadopDe nvi s0s2xoxo oydlmtnlfcsl(faDumu pot4oetoiociyt m em(mo ()trtoxfcoadlaDraivs;s) rtmiopny1op   fcsl( aDraxm nt0tpe mfetadfmDem(vp (0aeenio3tatfaD au s s  2uoxrpnydap   fvils) 2rr(mo;o0teto ociydls2ul(vp;t0tetomrciodfp ean i () ruoim3iy1lmtemnetat)a2trx  ou1tpe moetltlaDrmumo;u)trtnmrctotomDeanes;t)t2ur(mpiudapenmfcil(fa2rr(ront0oee moetas s ea( p;u4 lxniocia1lat lnvs t0s2to(o3no1lp n fvsl(  Dumx  nt0alx  i3iaslaDeanvs;t0artrmfcoatlaDrlneslt  2trxr3no1ale lnvsasf 2trxmpno1openmo3iytlmDemuvp u4artrif iodfpt aneo t0 rur(m3iu1lp e fcsa() 2rmxronu1aleomoetaslm2umuvp u)trenir oatfmtrai o;s) 2xmir oy1omtn nesas)aDrmxro;u1aex mfetydlm2ua(mont0aeenxf3iydlpt  nvo;s s2xo(o iu1amee ivia(faDrr(mo;u1open f3iadlsDeluvp u)tetnxfciydla   i ol( s2umxrpnudap emivsas)a2tax o;o0apen i3tlslm ea(mo;()arermo3oo1omt ai sls0sruoio oo4omen nviltf Dur(mp;o4aeeoifetad a rlnmsn(4alenir3iotopDe n i t  2tmxrpoydapee ictlt artax o;u1ale iiciadfm2rm(ms;u0aleomo3iadla  lieo t)tetmxmpou1opt mnci tfarumuro;o0tetnioeilslmDrmuvs t) rxnmf3iydomtrau sls texo(o3oydlltelncia()aDra(r oo4oeen o3iydlmDrl( o;u4 lenif totlatraivsl()seuo(r3ou1ol  lfvi t)srtmxm ;t0opeomoeilt s ua( s u) leriociadfat an s;s0 rxm(o3iy1lm  lfet t)arta(r oo0aeto f3tasfaDeanvo t0 renmf tatom   nvs;t0seurio3oo4oltnmfvtat)a2uaur oo4tpenmieiysla umuvs;()aetrxf iatlaDelu ils0texm(m3nu1lp eliesls s2ua( oou0aeeomociaslmDel(vo;t)treoiocoo1fpDeai i;t)texr(r nu1opee nvtlt) rtm(mpot1texnmieildlm em(mo t0trxoxo3oytom r i ols sexo(o3iudoptn fesa(  Durumpnu1ole mictlsla2elnvp;u0aeeoir3ia1optrln olt s2toirpno1amee nctlt)srur(rp;u4tptoiietys mDra( o;t4aexrxfciy1lpDrli s;( seto(opnydll nmnctls)sDta(rp;o0olx ii3iltlmDrm( onu)aeerxr3oo1fa   nvi;()seumirpoo4aptnlics s)arrau o;u4ale  ictasfs rl( pnt0tlxoxfcoodopDeau s (0trtmiopny4om nmiesl(fs2rax  oo4teto ietysfa umnvpnu)texoio3oo1fpDranvil()sexmiopnydole lietas) ruaxmo;o1oltnioeilt m2uauvon(4 lxrio tadomtrlnei;t tetrxmpiodapenlfvt s sDtaxmp;t4tpxnifetadlsDrluvsnt)tltnxfciotopDrlies t)t2uoir3ny4lpe  fvil(  Durum ;t1ole if3tytlm2ul(vs;t4trtrmfcoytopDr nvi (0seto(r iudlm nlfesl( arrr(  ;t4teto f3ildfs2um(vo;t)tetnioctodfa r uvs () rxr(rpio4ale lfcsl(fa2urum oo4tetnifctldls um( o;(4 leoxrcoo1oa   uei;t)srxoirpoodame livi (fa2ta(moot4apxo i3iyslaDrlnvpnu0teerif iytoaD  nesls teuoxrpoo1olenlfeslt srrau ont4tetniictldlaDeau o;u4artnio3oadfmtrlivs;t)srur(m3oy1om nlncs s  Dtru  ;u4tlxn fetyd sDel(vp ()tltoir iotlaDe neils0srtm(r oy4lm   ivtasfsDrrum ;o1tptnioctas s2rlnvo;()texnxf3oatlmtr ues s)s2xoim iodllee fct t)srumxmpno1alx  octysfmDum(mpnt4tetrmrcto1fa rln ols)srtrxr3iu4omt mfvi tfa2rm(  ot1alt moetlt sDua(msnu0teenmr oytomtrlnes t0trtmxr3no4ll  lieilt) rtm(  ot4aex  f3iydlmDemuvs (4tlenifctotla eanvs s0teto(o3iy4ap e nct s)aDur(monu1openmieilt sDuluvp;u4 rtrxfctatlaD anes s)trtmio iy4ll  mnctl( srtrum oo4oetn ictlslaDuluvsn() rtrifcoadlptean s;s0srxr(mpiu1optemfvt s  Durxr no0oet moeilslm2emn pn() ltomo ta1lpDeluvo t)t2umxmpnydam e icilt) Dum( poo4tpxo feilslsDumnmo u) rxnxr3todlm r ivi;s) exoxmpiy4omeemncias a2tr(mo;t0olxn ieiydfa ea(mpn() rxrxr3ootlpteluei;s  rtrir3ou4op elfvsls  2urumpou4opeomi3iad s rmnvo;t)arxoifcoydoaDelieolt t2trxm3ou1om nlfvil(  2trx pot1apeomoeiysfm ulu on(0aeerio3io1lmtrlieolt) 2uriopou1ope  iesls)sDur(rono4tltnio3tysls2umn p u) etomr3oytop  ai o s  2tr(opnodameemnei t) Drm(rpoo0oeeoio3iadfs raumsnt4alenxrctytoatr ues;(0teumxo3ou1aptn neiatfa2uax  ;o0tpx  f3tlt s2rlnvpnt0treomr iytomt lieols tetr(m oy4llenlnvt t)aDtr(mo;o4apx if3iasfa el(msn(0 lxnio oydfp  aivo;s0srumxo iu4lpeelfvias)a2tau o;o1ole mfciytla2umumo (4 etrio tytomtrlneo s)s2xoxopiy1am  lfvilsfaruaxmo;u1aex  i3iltlm ul(vonu0 lermr tadlpDelieo ()seurxm3iu4om  mfvsa() rraum ;u0tet iiciaslsDem(ms;u) rtoircoatfpD livs;t srtoio oy4al  mneil()aDrr(mp;o1aptnmoeiltlsDrl(ms;u4treoxocta1faDrlneolt0 etmir3oy1llt lict sfarrmxmp;t4tpt moetltfm2um(vpn()tlxomf3iy1oateluvs;t) 2toxmpny4oltemnvil(fs2tr(rp;t0tptnmo3iad s el(mpnu)aetrmrciodfa e ies s0 2tmiopiy4al emnciatfa2raxmoou1opt moeiasls rl(ms () rtoiociadfp  ln o;s  rum(o3iodope  fvtasfs2umurpot0tpeniieildlaDrmuvo u4aexrmr3iydfa eauei;t)s2xm(opiy1op n fvtlsf rraxrono4tpxniieiltlsDel( o;u0 eenir tatfmt lnei;s texr(opoo4ope livs t sDtr( onu1oleo f3iytlsDuauvont)tlenxo3iotopteaiei;s0 rxrio oo1amenlfci s srtr(ro;o0oexo fetysla uluvs;u) etnif3iatfpt  ieo t0 2umxo3oy1lmt  ictas s2raxr oo4alenmieild m2emumonu4altrmfctodlpD ln i;( t2ur(m ny1ol e ivil(fsDtax  ou0openmi3tlt m2eauvp;u0 renxrctytomD ai o;t  2xoxm nudlptnmfvt sfsrur(moot0tpt mieias a2uan s t4 eenxo ta1lpt au i t0seuo(r oo1omtemivslsfsrtax p;u4tltnmfetldfs2rl( o;u4 renmfctydlpt  uvs t tetmim3oudalen ivia(f rumxro;t0aptn fciysfmDrmn o;u0 eenmocoo1omD lueo;t s2urxrpnodapte fcsls)aDtrur ot4apxniociydfm2umumo t) rerio3todfm eluvo;t s2xmim3iu1lmen ncsat)sDurxmpot1aptn i3ild a rln o (0 etnmf totlp rlieol(0srtrxm3nu4lme lnei t a2tr(mpot1tpxnii3tls s rmn ont0alenxf ia1fpDe ivo t  2uo(o3oodol e ncsas)arrmx ont1tle ii3tasla rlu p;u4aleoxf ta1optean sls seumxo3ny1llen fesls  Drrxroot4tex io3tytlsDul( p ()trerxf3tydfp rlueils  etr(o ou4lpt lnvt sfsDrrx  ot1apxniicilsfm ulnmo;u)tetnir3todfmte i s;(0s2ur(m3iy4lpt licsa()a2umx  no0apeoif3iydfs uaumpn()tetnmocoo1fa r ueo;s)sexr(mpoy1lp nlfct () 2ta(rpnu4aleomf3ilt m rau p;u0aetnxfcoy1lmDr u i t0 2xm(r iudlpenmfci s  Dum( oou1alenio3iatlm2uln onu4artnmr3iydop   u o s srxrio3oy1ap nmfctl() Dtm(mp;o0oetnio3tydfa el(mon(4tetrifcoodfaD livi t0teumxo3nodlm nlfesl(fs2uru p;t1tltn ocild s ra(msnt4trerio iodfat aivo;s0 2to(r no1al nlfcil()sDra(  ou0texn f3iadlsDrlump u0trerifcoa1oat au o;t)s2xriopiu4op  mivsat artm( onu4opt iicils sDulu ont4aexrxrciy1fmD lu i;t srtmim3ou1alt  fvilt  2urump;o0ape ii3iydlsDelnmonu0alenxf3totfaD ai i ( srtr(m ou4llenmieilt srtrur no0aex mi3ilslaDua( sn(4aeerif3totopD  nes;t0 euo(m ny4apee ietltfsDra(rpnu1oexn f3iad aDrluvsnu4 lxrir iytlaD  i i;( teumxopiydomee ncia(f ruaxrp;t0alxnmfctys aDel( s ()arermo3ty1late u s t  exr(rpoo4amee ncia()sDrmu p;t1apx  o3ildfm elu o;t0arenifctydfmte nvs s seurim iodomeemfei (f rtmumo;t1aex  f3iysla2um(mp;t4tlxoifciodlatr u s;s)srxm(m ou1apt mneiltfsDtmump;o0aet io3ilsla2eanvp u) rtrxf iydoat  neols)s2xmxopoy1oltnmnvsl() rtru pot1teenif3iysfs2umn s;t)tlenxf tadlaDe uvs;t)srxo(opio4olenlnvias) rtaxm nu0tleoifeilt s2rluvo () reoio oytlptean s;t) rxm(r no4apeemneiasfaDtr(rono4ale mfciyd aDrln s u0aexnxf io1fat luvo;s)truoxmpnu1lm emfesat)a2tmx o;u4opt  oeilsfs el(mpnu4tleomo3tatomtranesl() 2urio iodomeelicsatfsrrrx poo1tlxomicildfs2el(vont4aexrmo iatlmtrluesl(0sruoimpoy4ol nlivtls)srum(  nu4tet ifeiytls2um(vs t4artomf3iydoat luvs;()t2tr(m oy4alen fctat a2raumpou4tee mfeiytfa2uauvo;t0aetnmf ootfpteli s;t) euoio ny4olt mieiltfartm(  ou4optnmoeiyt a ranvo (0artomfctadfp eaies t0srxoxo oodlleemicia()s2rau pou4olt  o3iat mDua(vs ()altrmr ia1omDrlivo;s0 2xoim3ou1al elnet t a2uauro;o1opeo fetasla ea( p (0tetnxo3oy1fateai o;t srtm(o iydlpen fcsas)srrr( poo0tlto octadfs ul( p;(0 ltrif3tatfpDeai o;s0tetm(m3oydop nmneiatf rrm( p;o0tlxnmietasfa ranmo t0areoxr tydlmteaivsl( t2urir3iu1apenmfctls) rrax pot1aeeoii3iyslaDeln sn(0treoir3oytlmt  ivi s t2tm(rpoo4amt miesls s2uax oou0oexo fciasfa2uanmp;()artriociatfpt lnvsls)sexmio3nudam elnci ()srtrxmpoo0oetnmoctytfs2rauvs (0arxrxo totfpte uvol() rtm(r ny1lmtemivtat aDta(root0openmfciyd s emuvs u4 exnmo tatlpte ueo s)sexoir3nu1al  mncs ()arraxr ;u1alxn oeiasfa emuvp;t4 ltnxf oydop  lnes;() 2tmxm ny4ap elfvtas) Drr(rpnu1aeeoiietadlaDelnvo;t0treoio todfmt aueo;()teurimpnu4ape mfvt tf 2umu  oo1opxnmfciydfs2rm(vp (0artnxocto1lpD  ieo;s0truo(o3nodol emictas) rrr(mo;o4aeeniieilsfs rmu pnt0aeeoir3iatfpDrluvilt)teuoxrpoudame  nvtlt sDua(  ;u4aexo ociltfa uaumonu4teeomo3ia1fp  aueil(0seurxopoo4lpenlnvsas arrr(mp;o4aee iociaslaDum(mp u)arxnirctotlaDe ueo;()truo(o3oy1opt  ivi s aDta(rpnu1oltomociatfa2ul(vpnt0aexoif3iydfm rluei;()t2ur(o no4lpe lies ( artau o;u4apenifetlsfm2emumsn(4texrir ia1optrlivslt0 etrio3ny4lmt mnetas) ruau oot0aleoii3iadla2rlumont) etomoctatfaDrln sl( sexo(opiodomeelnvta()sDrru  nu0ope miciadlmDrl(vo t4tlxrmo3tadoptrln s;s0s2xrimpiu1olenlfcils  rtm(r nt4apxoif3iydls2umuvp;u)tlerxr3iadopD ai sls) eto(r3nu1omtelnvsltf Duaump;t0texomf3tyd a ran sn() lenxf oytoptranvo;()srxm(o3no1om n fci t)aDrr(ro;t4teenio3tyslmDraums u4 etnxrcia1oa r nvs t  rurxopnydll   fes ()srta(root4alxoiicildfaDemums;t4teeomo3io1fmtrau o;( teurir oy4lm e fetlt)sDra(r nt1oeenmoeiadfaDel( s u)aeermr to1om   neil(  rtoxr3iy4alt  neslt)artaum no4apx ioctyt m rlnmp (0 lxnmfctodfa rauvi;(0srumim3iudam   nvt t)a2umxmpnt4tet mf3ild a um(vo (4alxomr3iydop e uei ( teur(rpny1amen ivs t) rtaxmoot1olenmieils mDeanmo u0aeenifctydomte neslt) 2xm(m3iydlpe  neia(  Drr(root4apeo f3tas m um( s ()tlxnif3oydlmD lieil(0srxrxm3iy4oleelfes t sDraxrp;o1teeo ieildlaDemumo;t)alenif oadlaDeaivols0 exr(rpiudllt lnct s aDua(rp;u4oee mieilt s uanvs;(4areoxf oatfpDranes t trxr(o3ou4lmenlnctat a2ta(  no0opt moeiasfa2el( s ()aexrifcoydlmtran sls)texoxr3no4olt mnesltf Dumumpou0aexnioeiyd a rmuvon(4treomr iatlp ranvsl(0 exoxrpiodomt mnviatfartmumo;o1tpenifciysfm2uluvpnt) lenifctadfatrlnesl() exoir oudomtelivtl() 2taum oo1ape mfetas a2rlump () etrmocto1fp elieils0srxoimpno1apt lnvia( sDtmx pot4aetomieilsfs2rlnvsn() rxnircoytfpteaieilt0 ruriopiy1ol n icsas)arumx  nt0apxoif3iatla2eanvp;() etrmr oa1lmDrluvi s) 2xoir oo1amenmfvs tf Draurpnt4tptniictytfa ua(mp () lxnmf3totopte iei;( t2xo(o3nudamenmnesltfsruax p;o0aexo i3iltfmDrm(mpnt4teerioctydlpDe ues;t0 ruoir3iy1omt mfeta(faruru poo4apx ioeiasfs rm(ms;t0trxoxo tydoaD aueo (0texrim3nu4ol e nes t  2trumpou0apxnmf3tasfa ul(vo;u0alermrctodfm  auvi;t  2xr(r iy1lle mfciat  rtm(  nu1tpen f3iydlsDrmums;(0altrmfciytlm ranes;s s2xo(mpiu4opte net sfa2ra( p;u4oeto f3iatfsDrm( pnt4tltnxociytlpteaieilt teurxo ny4am  mfct (fs2uaxmono4aee mf3iat m ranms (4aleoxr3oy1lmteaueil(0t2umio iodol emfei (  rrm(mpou1tpe miciatfs2eaums u0texrmo ty1lpDr ueo s0 rto(o io4ll  lnci s) rtaxmp;t1apxo octydfa2ua(vp;t0areomrciodlpDran il()teur(rpio4lme  ncs sfs2ururpnu1aetnmictlt m2rl(mpn(4tetrxrciadlpDrauvo s0sexmxmpoy1lm e ncslt)a2ra(m ot4tpxo f3iad s2ulnvo u)trxrircto1opDe i s;()t2tmxopio1lpte fes sf 2uaur nu1oetomieildfm ran snt4tltriociadoaDraiei;t  etmir3iy1lm n ieiatf 2taur nt1olen ieildls2eau o;t4tetnir3oatfatelnvols) eurim nu4optnmnvs s)sDrmuro;t0tee  fciysfs ua(mpnt)aexnxo3tadlptrlnvi;t trxo(mpoo1llt lneiatfs2raxro;o1tpt  o3iad mDulnvo;t)areomr oodomDeln o;( srurir3oydlptemnviatfs2umxm nu1oexo feiltfs ul(mp;() exnif oydfp  luvo;() euoxr nodlme lncsl( sDrmxm no4tlx mfeiytls rlnms t)artrmo3ootlptr iei s srxrir nodlm nmicsas) ruauront1teto fciydfmDuanmp u0 eenxr3ootla e ivo t)t2xm(o nodol nmnetat)a2taxr no1tpe io3ilsfm rmu on(4 exrxr ia1oa  anvo;(0 2trio3ou1optelieslt  2rmump;u4tetn f3tyslsDemnms t) rtrir3ty1fa   ivo s)sexrxr3oo1alenmfcs tf Dumxm ;u0teenmo3ilt mDulums;t)aeeoiocoatomtr ueol(0srxmiopno4al  lnci tfarrm(m oo0teeoiiciyt s rmnvp (0aeenxocta1oaDrluvs;t)setm(m no4al nmfctl(fa2trx  oo0oet iociysfsDeau onu)artrmr tadfaDe neolt0sruo(mpno1op   fciltf Drau o;u4oeenmf3tyt s2elu s;t0 leomo3iatop rlies;s0 euoxm3oo4lp nlnctat  Durum oo1tlenifetas a emnmp t) exrmo3oa1oaDr u olt)sexr(o iy4aleemfci tfa2umx oot0tleoio3tydla2ua(von(4tlxrmfctydfmtrlues s)texrxopnudamte fvsls)arraxm no1apx  feiat sDra( p u0arxrxfciytlm eluvo;s srxr(o3nodll nmnviasf 2ua(r no0apx mietatla2emn sn(0arxrmfcoo1opDr ueolt)sruoirpou4olt mfct sf Drmur ;u4alto f3tldls em(mo ()aetrir ty1lpD li ils)trurxr ny4altelnvi tfarta( p;t4alt mfcildfa2em(vs;u0tleomo3oodfmDraiei t)t2umxopoydamtnmnct t)srurxmoot1olto ocildlm el( pn() exoxo3iodop elues;(0 rurio nodalee fetls  2ua(rpot1aet  i3ias s2ul(vo;t) etoxf3iadfaDr ivs;s)teum(mpoudomenlfei s  2ua( ooo0tpt  o3tld aDeluvpn(0aetoxf iy1omt  n s (0srumxm io1op n fetl(f 2tr(m ou1apx  fctad sDuauvs t4texniociytfmDr nvs;()s2tmim3nodam emieta()a2uax poo1oeeomi3tltlaDra(vo;t4 rxoio tadlmtrai sl()sexrxopnodolt  icia()sDtrxr ot1tlt mfctadla eln s u0alenmfciotla e iei;t0srxrxm3oo4opee fvs s srtr(  oo1tle  f3iat mDel( pn()arxnircia1om e ivi;t) rtm(o nydaltn ncsa(f rtmxmont1ope iocilsfaDem(ms;(4 lermo3iy1fm rluei s)texoimpiydlm  lnvt s a2rr(m no1tpx ifciltlm ra(vsn(4 etoirctydopteliei;s0trumim no1ameemfetlsf 2rmx  ;u1ope mi3iltls rmn s;(4trtnir3oa1om e uesls)t2urim3iu1amtemfetlt  Dum(  ou4tlx iictyt s emums;t0artrmrciatfpDraivsls)t2tmir3iy4apte nvta( a2rmuro;o0tpeomiciyd aDraump (4 rtrmoctytfa elnvo;t  ruoxopny4omtelncsa( srumxm ;o1aex moeiasls2ra(ms (4 lenxocoy1opte i olt0 2xrxo oodlpeelnvt s sDrrx o;o4ole  o3iyd a2ea( o u4 leoxr3tatlpt an olt t2tmim iu4ol n fvt s) Dtaurpnt4tptoii3ias a2ea(vp;u0aexnxo ty1op rauvo s s2xm(opny4apeemict s)a2um(  oo4apeo icilslm umums (0alxrmf iotlaD  ies;(  2toxr nodom   ncta()arrr( pnu0oee  ieiat sDem(vsnt0tltrxf iydlp r i s s)s2xoxmpiudlm emivi () rurxmpoo0aexnio3iydfa2rlums;u4 rxomr3oydfpt  ueslt s2umir3oodape lfci s)a2rmxmp;o4olx ii3taslsDulu o ()tlxnir3oytlm   uvsl(  etrim oodam n nvi (faDta(rpou4aexoifciytfa2rm(vs;t)altrxo oy1oaD aiei s)t2umiopiu1lptn fesa(fs2uru p;t0opeo fcildfa2ulump;u4arxnxoctotfmD  ues;()srxrxo3iodom e ieiatf Dururoot4oetnmocildlm rl(ms t0tlerxf iatoaDeai s;t)s2uoxrpoodlm nlneia() 2ta(rono0tltnmocilt mDua(mo;(4 rtrxf todfateauei ()s2trxr oo1al n nesa()aDumxro;t1alxnifeild mDua( p u4 rerxf3tydoateau ols  etrxo oydlmen fcs sfsrrm(  nt1olxo octadls ra( o;(4 rxomr oy1fa rlnvils0srxoim3oy4lm n fetl(fa2rmxmont4texnmfctasfs em( on(4tlerxr oa1fmt lnei;s0trtrim3ou1amee neia()a2ur(r nt1olx mietasfs umu pnu4 eenxf3ty1opDr n il(0seum(opiodoltnmfct (  Dtmu pot1tex if3ilslaDraumsnu0 rtriociytfaD au o t)seuoxr nu4ap  miet tf rraxroou0aee  f3iltlm2rl(mpnu4aetrxr oatoateaivi;()sexoxm3oydalt mfvsas) 2ta(m ;o1apxnmfetat mDrmuvo u)alenxfcoydlmDrln i;s)trxmxrpiu1oltemies tfs2rmxroot4olxnif3iysfmDumnvs;(4 rxnmocoadfpt livs t)s2uoxopny1ameelncil( artaxmpnu1opxnioetaslmDeln on(4 ltoxfcoatla  lu s;() 2uo(o3oo4openmnvtltf Dtr(m ;u4teen f3iyt mDum(mo;t) etnmr3iy1lptr n o;()sexrir oodlm emfctl() rua(rpnu1aexomf3iltfmDrm(ms;t) renmociotlaDrlivslt0 2uo(o iydomt lnctas  Dra( p;t0oex iociadfa2uaumpnu0 reomr oa1fm e u slt0s2xriopoy1olte net t s2tau ono0opx  ieils sDuaumo u4trenxo ty1laDrli i s  exrxopnodlmt  nvias s2umuro;o0tpeo f3iys aDem(mo (4alxnir3iy1oaDe nvol( srtrirpiodal   nct tfsDrrxm oo1opxn fctlsfs2emnvont4 lxoif3iy1fm   ieslt)setr(rpiydom e ivias) rtax  oo0aetnmfctysfa2umnmo t4trxoio iodlp rlnvi t)s2toio no1am  lfcilt  Dtau  oo0aptnif3tlsla ul(ms;t4aeerxf3ty1fpt  nvi t0 exm(m3nu1lm  mnvils) Duau  ot1alxoiieiatfm eaumsn(4tlenifciatfmDrlieo s)srtr(o ou4ol n icta(fs2taumo;t4altnmi3ilsfs umu onu0 lxomo iatop eln ils  rumio io1lpe lfvil( arum(mpoo0oeenmo3tad mDrmu p;()teerir3oatopteli i ()s2xrxm nodomte ivslsfsrumum no0oex  oeias aDuan o;()tlenmo tatop r n o t) 2uriopio1altnlnvslt)aDrm(r nu0opeomi3tlslsDrmnmo;t) ltoxo tatlm r u i;s0 euo(mpiudoltelnvsltfs2umxmp;o4apx  ociasfmDulnvsnt)trtnxf3oatlm r ivsls)trtrxr iu4lpe  fesl()aDtm(ro;t0apxo f3iatfs2elnmont4 leriocty1laD  nvs (0t2um(opno1altnlfvt ( arur(r nu4alenio3iydlaDelums u4 rtnmfcoydfaDr n i;s trto(mpnodlmeemnei ()arrr( poo4texomf3tadfaDemuvonu4aleomr tytlmte iei;t s2xrxopou1ap nmicsltfarra(m ;u0tptomoeiyd s umnmp;u0trxniociodfm eaiei ( trxmiopno1amtemfvtl(  2tmurpot0tlt moeiydlsDrlumo;u0 rermr3iy1optrlueols) rtr(o3no4altnlneilt)s2rmxrp;o0aptoiietls sDrm( on()alxrxr3iatopteau s;s) 2to(r oo4lm elics s s2trxm ;u0apx  o3iatfm2umnmont) exrirctatfpt  u s;(0 rxoir3oo1aptnlnvsat arta(r ou4aeeoiiciatfs um(msnu)tetnmo todoptrai o;( tetrxopiu4am   ics ()sDrrxrp;u1teenmieilslm2el(mp u) ltomr3iydlmDe ieilt)s2trxr3nu4ome  feslt) Drrxmpnt4oetniiciadfsDrmuvs;(0teerir3tatomDeauvs t)teuo(m nu4lm   ivta()sruau  nt4aeeoii3iysfaDeln p;u) eeomrctydfa eauvo s  2urimpoydam   ivta( artmu pnt0opt ioeiysfs2uln s t)tleoxr3oo1fmteluvol(  eumio3iy4ll emncias)arra(rpnt4aleomictydfm ulumpnu0alxrmo3oa1opD lneil(  euoim3iu4lpe  fctasf 2trur ;o0aeen feils m2ua( snt4 eenifctydfp e ivo t teum(opoo4lmeelfet tf 2urur ot4olxomfcils sDrlums;(0 exnif3oatfmDr uvo;s0 eurir ny4op n fesl( a2ua(r no4tetoii3tadfaDean o;(4tlerxf oadlm  auvi;(0texoio ou1ome mnvt tfaDtrxrp;o0tltoioeiydls emnmo u4trxrif tadfm  anesls0trtoxmpno4ome mnvta( arraxr ou0ape ii3iat sDumumo (4 rtoir io1fm r i o;t0texo(o3io4olenlnvs ()srtmx  nt0apxomicils s emuvs;(0teenmrctotfa e uei;s texr(o3no1amt liet (f rumx  nt1olx ioctyslsDelnvp (0 rtnio tatlm  an s ()s2um(opiy4apt  fcias arrrx poo1teen i3iytfa umu s (4trtomr3iodlmDeln olt) 2toxm3oo4opte nctls)aDta(m oo4tlenioctasfm2eanvs;(0aeeoircootlpteaiesls)trxmxm ny1lmeemfct s)s2rmu ont4altnioeiatfmDra(vp t4tetnmf oo1oa eaneo;s setoxmpiu4lltn ivt (  Durumpoo1apx moctytfm2ua( s (4aeeoxfctotoaD  u o;s0teurio3oo1alenlfvtat)a2uau  ot4olxoifeiltlm rm( o t0areoxfcootlmD aies;t srtrxmpiy4lm e fvtasf 2urx  nt1tlen octaslm elnmo (4aetrircoadlpDr uvi (0 eto(r3ou1ol e nvs ( srur( pnt4tleo fctldfm2um( p t4aetrxr3tydom  anes;( srxo(r3nydlltelivia() rra(rp;u4tpt  ociys m ea(vp;u0aexrio to1fatr uei ( s2umxopio4om  mneta(  rtr( o;u0aptniociyt m2umnvp (0arenmfciy1fmt ln i s0 eto(o3oydolt  nvt ( s2umur ;o1ope miciysls emnmp;u0trenmocoadfmteaivo;s)teur(m io1amte netl(fs2uaxmp;o0opto ieild a2rmu p u) rxoxo3iatfate i ils0seto(m3oydameemnesatfs2trxrpoo1alxn octasfa2ua( on(4 rxoir tadla r nes;( seum(r3iydol n ieta() rtrxroot4oleoifciyt a ea(mpnu)tlxnio oatfp rauvo t) rxo(o oy4lpenmfvt s srtm(  oo1aleniiciatla ran s t0aetoxrciydlmDeaneo;t trtoir oydlm e ivslt a2rm(  nt1texoiiciadla emnvo;t4 rtnif3iotlpt li o s  euoir3no4ape mfctat)sDtaurpnt1oex ioeiad aDrln s u4 lxnxf tydlmt lnvs s) etmxopnodalen ncsat)srtm(mpnt0oexoiietyd s ea(vp;t) lxnircia1la rlu ilt teuo(m3oodal  mnvsl() rum(mpoo1oleoif3ilslm2rl(vpnu0 rxnxf oydoaD  u o;s0sexoxo ny1op nmiet (f Dra( poo0aptnio3ilslm emnvo;u4alerxf iytlate n s;() euoxm ny1oltemnct t arta(rono0tlenmfeildlmDeanvs;u) rtrmr3ta1faDe n o;t s2uoirpny1ole  nctl( aruaurono0aeen i3iys m ra( s;(0alxrxo3tadlate i s t t2umim ou4ome mietasfaDuaurp;t1tee mfeiaslaDemu onu4treoxf3ty1lp e i i;( trxrxopio4omte ivi s sDtmu pnu1olxo fctad a umnvp;u4 leoxrctotfmD  uvils0 2xr(m oudll nlfctl(f rraumo;t0aee mieilsfm elnms t4teenmf ia1lpDrauvs (0 exrio3oo4lp  mfctlt)s2rrur ot4alxomi3iatfm uan o;(4trtnxo tadomtraneo s0 rtm(o ou1omtn ncs s) 2ur(mp;u1oetoioeiatls rm(vp;()tlxrxrcoydoaD  u o s0trtmxmpno4lpe mfeta(  Dumx pnt4apx mfeildfmDrm(vpnt4alxomf3ia1oat ai i t  etmxr no4ll elncsa() 2uau  no4tee mfetytla2ra(mp;t0 renmocoy1fat lu slt trtrxrpnu4lmt lfeil(f 2tmxm ;t1opxniiciaslm2ranms u0trtrxo3ty1op  au i (  etmxo nu4ameelivils s2rr( poo1apenmf3iydfs2umnvo t)trxoif3ia1oaD anes ( s2xrio3nu4ame lnvt t aDua(rpnt1apenmictlt m2ua( o;u4altnxrcoadomDe ieo;s s2xrxmpoy1om e net (fsrururooo0tpxn o3tatla uanms;()alxoxocoytom e n o t0 rur(m iy1omtnmfcsas aDrrxr no1aeto ociadfm emums;u)artnio oy1omt  u ols0 2trxm3nydoltnmnesasfsruax poo1tptoiocildfm2em(monu4 rtoif tydlptean o s0trtrimpiu1lme mncsltfaDurxroou4apeomfciltfa eln p u4 rxoio3iydlatr ieil() etrir iy1omeemfes sf Drm( p;t0aet mf3iad s2ua(ms u)tetnmf3oadfp r i sls  exr(r3ou1lmt  nvt sf Dtaur oo1texn i3iys s rau p;(0aeerir oadom e n i;s0srxrim3io4lltnliciat s2uru pot4aeto fctat s rl( pnu)arerif ta1oatrlueil(  2uoim nu4lleemfetat arrmx  nt4tpe iociltfs umnvs t0arxoxr3ty1laDr i i;t  2xm(mpno4lm n ietas)arraum ;u0aeeniociasfs um(vo;(4aetnmoctadlaDraueslt0trtoxo3nydam n ncsltfsrrau pnt0tetnmf3iadlsDuanvs u)aeenifctodomteluei s0t2xm(mpny1omte nvs s aDururpou4aetomfetadfa2em( s;t) exnmrctytlpD lnvo;s)trxmiopnu1opt  ietlsfarum( pot4opto fciytlmDulnmo u0 rxoxf3iotoa eli o;(0s2xrio3iodoltelncsls) Draumo;u1tlenii3iadlmDrm( ont) lxoif oodfa   ivilt) euo(m no1alt  nvil(fsrra(  oo4tptn o3iysfsDel( o t)artnmr3io1fmD lnvil( setoxopio4llenlnciltfarur( pou0olt ii3iadfm2elumpn(4tlxnmo3ty1op  livo () euoim3oudam   fcslt)sDtmxmpou4oleomoctytfs2ean o;t) etoxf io1lpteli il()s2umxrpoodapt  ncia() Dra(rooo4apeomoetad sDrluvsnt)aetnxf3ia1omDrauei s0t2tr(o3nudal  lnvtl(fs2ur(rpnt1tpxniiciltfs emumo;t0tetrxf3iy1lpteanei;s  2trir nydop  mfei s aDrru pou0aexn ieiatfa2eanvp;u4trtnxrcto1fpDr nvi;s0srxrio ny1opt lncil(f Durxr ou0tltoiieiatls rlnvsnu4 etnifciatlptr n il(0 eto(m3iydlm nlieils) rrmu pot1alxn fciyt aDrm(vpn(0 ltrxrciodfmt liei s0texm(r nu4altnlnetatfsDumur ;t0alx  i3ild mDuanvo;(4tetrmf3tatfpt  uvslt setr(r3no1lmenmfes t)sDumuroou4tpe  ieias m uluvpnt0aeeomo3oatomD lieols) 2urimpou4omtn fcsls  rta( o;o0tltnmo3iasfs rauvs;u0trtnmrciadoa  auvolt) 2to(r no4apeemncils)s2rrxr ;t0tlxniietlt mDrlnmpn()aetrmf ty1fp ranei s  ruo(m nudlm elietl(f rtrxr ou1olxomietyd m rm(ms u0tetomociadfp ran o;( t2xm(rpiudllee fviatfaDtax ont4alxo o3tytfa2elnmsn()treoifcoydomDr u s;t0 eum(o iydomtnlneils srurumpot0aleo fetasfs rl(msn(0tltrir3iotom r uvsl( sexmxr iydomeemiei s aruau pot1tlx iictad m el(vo;()trerxfcto1lmt  uvs s)s2tmxo3ny4lm nlfvils a2trx  no0opx mo3tysfsDua( snu)altoio totlp r n o s  etr(mpny1omtn ivt s)aDtrxmpnt4apt ioeiytfmDumnvs;()aexrmf3oa1fa rluesls0s2xm(rpnu1am  lnesa(  Duaxmpoo0oeeoif3iytfmDra( on()altnio3tydfaDeanvo;s0t2urxopnudoptemfcsl() rtrxm nu4tee  i3iad s2rau o ()tltnmr io1omte nes;() 2urxo3no1lmtelncta(farumx pnt4tex  feiytfa uluvp u)tetnxf3ty1fmDe nvolt srumir3oo1omtn iesl() rumur ot1tlen iciydfaDul(vo () ltnio3io1la  aivs ()t2umir3nudaleelnci t)aDrrxronu0olt mfeiad mDuaump;t)aexnif3oa1fpt  nvs s)seto(m no4lpe  fvsas arra(  no1aex io3tadfa2eanvsn(4teerir3totlmDraueslt  eumim oy1amt lneilsf Dra(r nu4oee mi3tlsla umump;(0trxoio oo1lmtrlieil(0texo(opiodlmt  fciatf Dtmur ;o1oee  feiltlaDuluvo;(0 exnmr3oatfp  auvi;s)srxrio nu4am e fcsa()arua( o;u4tlt  f3tldfmDuau s (4treomrctatlpte ueols) rtrxo3iy1ol e fvslsfsrraxmooo0ape  f3ilsfs emnmp;() rtoif ootlmDrauvol(0t2tm(m ou1lmenliei s  2uru  ;u0oltnmoetaslaDuaums (4trermrcoodlaDr u s;() 2urxrpiydal  lfeia( s2ta( p;u0tetoifetyd s eanvpnu)trxnxr3iotomt  ieol(  etrxr ou1ap  lnet tfaDrmxrp;o4tlto iciyslsDul(von()texoxo iadfmtrau slt trxrio3io4lmeemivias artm(mo;u4tex if3tadls ra( p;()tltnmf iatla elnvils  2uoxo3iodapt mietas a2uau ont1aexnioeiatlm2uanvo;t4artoxo3oodfmDr ies s0truo(rpoy1op  mivslt arraurpnt4texoii3ildlm el(ms;u) lerxfcoydom rlueo;t0sexoim oydomeelies t  2tmx o;t0optomfciyt s2eanvpnt0trxnmo3todlpte uvsls0 2tm(opiudapeemnctat) rra(  ot1tptomfciytls2em(vpnt4texoifcoa1laD  iei t0srtoim3oo4optnmfvta()sDum(  nu4alxomi3ild a ean o;u4 lenxf3tatfmtr ieslt0trxm(m nudomen ieia(fsrta(mpou0opt if3ild m2umums;() lenif3tytlatrli s s)s2xoxo oodlm n feta(farrr(rpoo4aetnmfctasfa umuvp u4 rxnxr iytlpDrlnvolt0t2xo(r3oy1lpenlnctlsf Dra(ro;t4tpt ifctatfs2ul(msnu) lxrif3iadomte ivsls setoirpio1oltemieil()arrm( o;u4alx  ociadfaDrmn onu0tetrmociotlaD  neolt) rxm(rpnu1lme lncs t  Duaxr ;u1alx ifeilt sDrl(von(4alxnxr3ia1late nvs;t) eurio iydomtelnei t)s2tm(m no1oetoiicild aDumn s t0teerxo3ootfaDr u s;t) etmxo iydlmenlfcsasfaDumur ;o1olxnifctldlm rm( snu0 lxnxr iytoa  li i;t) eumxr3oo1lmee fetls a2uax ono4alx mi3iydfmDem(mp ()tlenmfcoadlpDraues () rumim3iudaleelfvsa(fsrrrxro;t0olxnmfeias s2eanvpn(0aexoif3tatoatrlnesls)srxo(m oo1lm e netat)srrr(rpot1tpeomoeiyt sDrmumsnu)trerifctadlpDr uvo t  2tr(m ny1ome lictat)aDrrxr ;o0teenio3ildls rl( snt4 etrirciydlmtr n i ( t2tr(o3oo1lptnlnviat) 2rmumono4tetn f3tlsfm2elnvp;t)tlxoiocoy1lmt anes ()trtoxr3iudap nmietltf 2umum ;t4aex  iciytlaDeaumo;u)arxrxf3to1oaD  ues t0s2uoxm no4alt  ivs tf Dur(m nu1tpenifeiysfs2elu onu) rxoxf iy1fat lieilt)teumim3ny4ale  iciltfa2rmum nu0olx ifeiadfsDranvs;t4 lxnifcto1lmtelu o;()texrxo ny4lptn fctlt artrxmono4oleoifeiyslmDea(vpnt)trxomo3iadfmDe n ol(  rxoiopio4om emfctasfa2ua(r oo1alxn iciltfsDeaums;(0aeerxr iy1fate ies (0sexr(m oo1al elnvsat) 2rauront4tlx  fetyd s uanmp;u4 ltomr iy1oa  aivi s0trur(m iy4om nmfei t)artax  oo0apenioctas aDua(vs;()arerxfciotfpD  u ilt0srxrxrpiy1lmeemfct ( s2rrum oo1apx  f3ias a eln p t4trtomf oatfm  luvo;s) rxoxr oydal elnetasf Dtm(  ;t0aet  f3ildfaDrlnmo t4 lxrio3tydoateliei;s) rurio nu4ame miesltfsDurx ooo4texomfetld sDemumo t0 ltoio oydfpD lnei t)s2umir nodaptnmfeil( a2taxm ou1apto ieiatls em( o;t4tlxomr totom  luei t0 2umimpio1ll  lncsa(  Drm(rpou0olxnmoeilsfa2ulnvont0tlxrmfciotfmD luesl( srtmim io1amtelnei ()sDtaxmo;o1tex mociat s2um( s (4aeenmo ty1oa   ieslt s2xmxm oudam  lnciatf Drr( pot4tlx iictysfaDuan sn(0tltnxf3oo1lmDe u o ()setr(mpny1alte nvil( a2ua(mpou0ole mictasla eanvs (4tlerxo iodfat  nvsl( s2xoxm3ou4olt mivilt  rtru  nt0aeeomi3iadla2rmnvpnt0aetrxoctotfpte i o;t teumxmpiodomee fetl()srrr( pnt0optn fciysfsDeln p;u) rxnmo iytla  anvi;s)s2to(o ny1lle  neiatfarum( o;t1tlenifctls s ulnms;t4tlenxo3todlat anvi (0 eumxr3iodlpe mictas  Duru pnu4aet ifciltla ea( p;u) lerioctodoaDelivi (0 etmim iu4omte iesas)aDuau p;u4oexo i3iaslaDranvsnu0arermf oo1optr nes;s0 2xmio oo1ap emicsl(f 2trumo;o4tle  f3iydlmDel( sn(4trenir3iatom ean o;t) 2tmir no1al elfvias  2umu poo1altn icild m emn p;u4artrmrcoatomD aieo;t)teto(r3oy1lp e ictl(fartmxmp;u1olto ociat aDuauvp ()artrmociadfm   n s (0 etmxr3oy4lpt mnetas  Dtr( o;o1aeenii3iad s elu s u4aeermf to1faDrlnvo t)t2tmiopnu4altnmnvtlt)aDurxro;t4aetoioeiltlmDrl(vsn()aexrmr todoa rln sls  rxm(opoy1lm elfesat) Draxrp;u4apto oeias s rauvp (0trtnxf oadlmtrliei s0 2urxopiu4optnmfcs tfs2rrur ;u1olt moctasls el(mont4tetrmo oo1lmtelivolt)s2uoir3nu4ol nmivil(f 2uaum nt4apen fciydfm rm(vs;(4 leomocoatoat  nvo ()trxoio3oydamtn fcsls)sDur(roou0tleo f3iltlsDumnmp;t)trxnir3ia1opD  uvo;t)truo(mpou4lltnmnesatfsDumu oot1aex iictytfm ul(msn()tetrifcoydlmDelu s;() 2uoxm nodaptnmfetat sDrr(rpno4tltomocilt m rmums t4teenif3oo1la e nvo;s srtriopou1lltelnvs sfarum(ro;u4tetomictys s2rmn pn(0alerxf3ty1la ranei;s0texoxr no1am  mncs t) rraxr oo0tle  o3ilslmDuanvpnt)arxnmf3oadlaD au s s)setoxr iu1lp nmivsa( aDur( oot4tee ioeiys s rmumo u0areoxo3io1lpte ivols  2urxr oy4lm  lnesat sruaxmp;u4opxo ociytfs umnvo t0tlenmfctytlateanei;s)teurimpoo4altelnei sfaDra(moou1tpenmocildlaDrau o t4aeeoxf3io1fmDeanes;s) rtrxrpou4apenmiesa(  Dumumpno1aexoio3iydfsDrmnvo ()aeerxr3io1lpDe ivol(0 2xr(r oydalen ncia() Duaumpot4tpxomoetas a rmuvp (4tleoif iotfa ran olt)s2xrimpoudll n icsa(fartrxr oo4aetn i3iadfs2ulump;u4aexnifctatfat aieo t s2um(o3nydopenmnesa( s2taum ;o1altoiieils mDulnvs u) rtrmo oadoa  luvi;s)s2xr(r iu4ap e nctasf Dtaxm nu4tex  ieild m rmn o;() rxoifcta1op rau sl(0srtrirpnydome mfvtltfa2urx  ;t4tlxo oeiltlsDem(vp;()aexnifciydom elnvo;( sexmio nodapenlfesa()a2umxrp;u0opxo octlslsDeanvsn() exrmo totoate uvo;(0 rum(opny4ole  fctat  rtru  ot0tpxn f3iyslm2emnmont4tltoxf tytfmDean s (0 etoimpoy1apeemfet t)artmx  ot0ale ii3tadfs2rlu pn(0 lermo tatoa e i olt trxoxo iudome lnvtl(  2ta(mpot0alenioetysfm2umu s (0texnmfciatfaDr nvs (  rto(m oydom elfesa(fsDrmxr ot1ope ii3tldla2uluvsnu)aleriocio1op  ai s;()t2xmir3iy1ame lnetlt srtaum nu1aex iieiyslsDelums;u0 ltrif iodla  luvil(0tetoxm io1oleelfei tf 2rrxmo;o0tltnmietltls2rm(mpnt0tleoir oadlaD ln sl()t2xo(r ny4om elivsasf ruaxrpot4oet io3iyt mDea(vsnu4aetnxrctadfmtrlneo t trtmim oodlpt mnei (fa2rrurpou1tlxnifeiyt a emnvs (4alxnircoydfpD ai o (  etrxr3io4al emnciatf Dtrumooo0aeto octldfa2ranvs;t4arxrir3iatfa  anvsl( trtmim ny4oltnmfvsat)aDraurono4aet moeild sDra(vonu4tlxnmo oa1omte u olt srxoir iu1ape  ietl(fs2taxmo;t4tltnmoetls sDrmn o u) lerxr3oo1oat  uvo;(  eur(mpno1oltnlfvtl(f Dumump;u4aexn oeilsfm2ranmo;t4artomr3tytom   ueols setr(r3iu1al eliesatfsDuax  nt4oltomociatfa2rm(vo () etrmo3oatoat livs t)seuoxr oo4lm emnci t) rtrx pnt1aetoiictadla2ranmo;u4 etoir3totfpte i s;t  rto(o3oy1ol elieias  2uaxmpoo4tetnmoeiysfm el(vs;(4 reoio iytoa   ues;s)srum(r iy1lmenlivta()a2tmxrpnt0olxoif3tad m2rl(ms (0 etoxo ootom eaivi s) 2xr(m3nudlleemivilt s2ra(r nt4tlx  i3ils s2rmnmpn() ltomrciatlm  luei;()srtriopiydal emfeiat)aDtru o;u4alx  ictyt a rauvo t0 ltrmociatfm eauvo ( s2xo(m iy1al elnvs s)arrax o;t0optniictytlm2rau s t0alenmf3ty1fatelivols)seumirpiudolt lfet tfa2um(r no1aex ifcilsfa um(mp u4aeenmo3ty1lm r uvils) 2xrio iu4lptnlieils) Drm(rp;t1openio3iaslsDua(mont)texomfcty1fat luesl(0s2urimpiudllenmncsas  2taum ;u1texoif3tltls2rln on()tetrxf3oytomtrlivs;s0trxriopnu4ll nlivi t)sDrr( o;o0tetoioeiadlmDuanvs;(4teeoiociadlmDr nvi t0 2uoxm oy4llt lfvsls) Dra( ont0teeo oetasfa uluvs;()tlxomo oatom r ieo t) euoxo io4ope mfvs (fsDra(r nu1apxnmietls m um(mo t4aetrir oo1oat auvi;t) 2toiopoy1lme lfeil()s2uru  ou4oetn ocildls2rmnmo;(4alxnxf tydlm eauvils0sexrxmpnu1altnlictl(f Drru oou4tleo fcilslm2rl( o;u0tetnxo to1omDeanei t)s2xrxo3iy4altnmnesls s2ur(mpot0tlx mfeiasfm2ea(vs t0tetrio tatlpD aivo;()sexrxrpiu1opt mnesat) Dum( oot1oex  oeils a raums t4trermoctodlmt au ils srxm(o iu4lmee nvsa() 2uauro;o1olx mi3iydlm2rmumo u) lxnmfctotfmtelueolt)t2xo(o iodapenlietl(faDtr(ro;u1tle moeiyslm rm(msn(4tlxnio3oo1faD luvs;(0 rxr(rpiy1opeelncs (fa2rax  oo0aeeo i3ias s2eanmpnt0teenifcoa1laD au i (0seurxo oydamt mfet ( aDra(m nu1oetomoetyd mDrm(von()aexoio3iytlmD li s t  2trir3io1lpe mivi (  2umxr ;u0apxnmocildfa2em( o;t) eeniocty1opte n s;()tetoxo3oo4lpen nctl( s2raumoot0apxomfctasfmDrm(vo;u) eenxfcoo1oateliei;(0trxmio nu4amte neils  rumxrono1apxoiociatfmDrm(mo;u4alxnio3oytoa r nei t0srtmiopio4olt mfcs tf 2uru pno0alenmfciytls2ran onu4 lenif3oydlptrau o s  rtoxr3iu4apt lnvil(f rrrx p;u0texnifctydlm rluvo;(0 lxrio3oo1oatr ieo s)s2xrirpno4llt  fctltfa2rr(r ot1ale ifeilsfm2umu onu4 renir iodop  lnesl(0trurxo iodal nmnvta(fa2rrum ;t0olto o3iadfm2rmuvon()trxrxocoadoatrau sl( s2xoxr3iudol emnci s  2rau pno4alxo o3ilslm umnmsnt)alerxr oa1lmD anes;s0trxr(r3io1llenmici ()a2uax ont0tetomietlslmDrmu s;u0altnio todop  lnesls0 2uo(m ny4lp  mnesatfarum(mono0aleomo3ilsla elnms;() etrmrctatoa rlieol(0srur(o3nydomte netl()a2umu pnu4tlxoioctad sDrlnvo;u)aeeoirciydla rlnvils) 2umxr no1lm nlieslsfsrur( pnt1teeo feiatlmDea(vp () ltoxf oytla r nvs ( t2um(m3oy1olenlictlsfsrrrumont1apt ifciasla2rmuvs t4tltnxocio1lmt  iei;t)truoxm3oydom nlfctl( aruaumooo1tee  oeiaslm rlnvs;(4trxnxf ty1fatr nvi t0tetoim iudam   iesl()s2rau pno4tptnii3iyd a2emnvs t) lxnxr iatlpteaueilt texrir nydape liet ()s2tr(  ;t1ole  ieilt aDrlumsnt)tlxomfciytfmDe uvs;(0 ruo(r oo4am nlnvslt srurx pnu0tlenmieiyslmDemumpn(4 exniocoa1oaDrlnvo;t srxo(m nudlltnlfeiltf Duaumo;o1tpt  o3ils sDelu p;t0 etrifctydoaD ln i (  2toxm nu1open fci t s2rmu  nu4olen f3ildls rlums;(4 ltrir3iy1opDe ieo s0t2xrio io1llen neias a2raum ot4tlxn ociytlaDea(ms t0aetrifcta1oa  lneslt) rumiopoudam emfctls) rua(mpno1tlxomictlsfm um(vonu4alxoxr3todfptelueils0trtoxm3oudllt  feil( aDrmurp;t4ole  f3ias s um(vpn(0 ltnxfciotfp  an s ( setrir3iodlp nmici tfa2rr(m ou4aeenif3tyd sDemnmp;u0trxnmo3ootopt anvo t0 exrim3nodoltemnetlt)a2taxmp;t0aptn f3ild mDraumonu0trermfcoydlaDeauvi t) 2xmxmpiodaltemfciatfarrr(rpou0openifctldls2emn p ()tlxnio3iotfpD au olt) 2umxm3oy1lpt mieil( a2tru  no0apeoifeildlm2umuvp;()tetomo oatfmDr uvi ()seuoio iu1lltelncs t  Dtmum ou4tpeniieiltls2uaums;u4 etnif3tytoaDrluvols  rumxmpiodolt  fes tfaDtaumoou1tltoiociatlsDrm(vpnu0teermrcoy1om  lies ( s2tm(mpnudaltemfet sfaDrmu  ;t4tetn i3iat m uauvs u4teerxf tatlpt anvsls) 2uo(m3nu1omenlfvi ()sDtaum nu4oex  ietldfa rauvon()tetrmfciytoa  luei;s seto(r3iydomtn fci t)a2tau  no0aexn ietlslmDra( ont0arxoiociytfptelu olt) ruoimpnu4al nmnvsat srrru o;t4oex mi3iytls2uanms;u0aexoircio1omtran ol( s2toxmpnodamee feil(fsDtrumono1oexo iciaslmDulums u0alxnxrctotlaDrlnes (0s2xrxmpou1om emict (fs2taurp;t4oex  feiltls elnms u0aeenxf oytop eliesl( sexo(m3oo1ome  fvtasfs2ua(  ou1tpx iiciat sDem(monu0artnmf3oodlpDeli il( trurxm3oodal nmfcsasfaDrru ont4ale mociaslm ulu pn(4tlenir3tatfmDeaneo;() rtmxo iy1omee nci tf Dumx ont0texo o3iat mDua(ms u4texoio todfptr n ols)sruoim3nudomeemfvilt) Dtr(rono0aexn ictat s rmnvpnt) reomoctotopD li ils)srtoim3oydaleelnvsas  2rm(roou4aetnio3iyslaDra(mo t4teenxo iodlptrai o s truoxo io1omtnlivslt sDurum ;u0optn i3ilt aDemnvs;()aetoxf ia1opte neo;t0s2uoxo iodoptemfvi s  2ur(mp;t4oexoioeiltfs2eluvo;(4aeenmrcoo1fpDe nesls  eumio io1lmt  ivt sfsDtaxrp;t0aex moctas sDeau onu)tlxoioctytlm  lu s t0 ruoimpiodalee fvi t aDumxmp;o0tltoiociytfm2umnvs;t0trtoir ta1fpD  uvi;( srtmxo oodam  lnviltfarum(  no4opxoifciyt a2emn o u0 rtrio3iytla   u o;( srtmir3iy4om  lict tf 2uru  nu0ole io3iadfs em(msn()tlxnxf3oatlat lieo;(0t2xoimpio1ap  mfcs ()a2umx poo0tle  i3iasfs2rlnmsn(4teerxf3iodfaD au s;(  exoxr3iodapeelncsa(  2umxront1aeenii3tadfs rmnmo u4 rtrio3iodlpDr ivslt) exr(r ou1am   ncsas)a2raxmp;t0oeeo ieiydlm2ul( s () etnmf3oo1opt  ivo s0t2trim oo4lp   neils)arur(mono0opx miciydfa2eauvsn(4 ltnmo3ia1oaD aueol(0sexo(o3oo1aleemfvil( srrmxrp;t0ale mfetadlsDrlump (0aexoxociodfpte n o ( srtr(o oy1lpe mfci t sDra(mont0tlxniocilsls2uln s;(0aexnio3iadlaDelies;t)trumir3ou1amtnmietl(fsrua( p;o1aexnmietasla2raumont0 exnxr3oatom   ivs;t) 2xoimpno4al   ict t)aDrrurp;o0tex  ieiydfm eauvont4 rxnxocoy1optrlnei;s  2xm(mpny4amtn fct ( aDtmx pnt4oexnifctat mDelu o;u4tlenxociatomt anvs;(0setoiopoydoltnlieilt)a2trx  ot1tlxoif3iasfaDelnvo t0teeoxf totlmD  n sls0 2xrir oy1aptemivilsf 2ua(  ;t1tltoioetltlaDrl( p u) lxoir totoptraivi;s s2to(m oy1olt mfvtl()sDtm( p;o4altoio3tldls2ra(mpnu4tlxnmo oytlm raueil() eumxr io1lltnlivs ()srrau  ;o4tltomi3iytfmDul(vo;t) ltrircoa1fmDranvi;s)t2xmim nu1optnlfctas)aDurumo;t1tlxomociys aDem( o (0 renmocoytop eaueilt  2xmirpiu4lpe mfct (  2ur( ono4oltniieiytfm elu snu0areoxo oodfpDe ieo s0seur(r nu4lpee ict tfaDua(  ou1apeomieildls2elu pnu4 rxrxfcootopD anei;t)trxr(mpny4omee feia() 2rm(rono0altoifeild m ranvo;u4 rxoiocoo1oaD  n i;( s2trxm oodolt mfes tfa2rau pot1aetniieiatlm2el(vp (0 reoif3oa1omtrai ol(0 etrxopnodal nlnesa(  2rrxronu0tpxomfetyd a2rluvo;u0 eenmf3oy1lm e nvi;s  euoim iydope lfci ()s2ua(rpot0oltomieiysfs2elnms;u4 rxoxr ta1oatrlivo;()s2trxrpiudoltemies ()arrruro;o4apeomoeiatfmDrmn p u4tltoio3todoate u olt0s2urio3oudalt lncilt  rrmxmpoo4aex mf3ildfaDrm(msnt4 rtrif3iodomtranvo;(  rurxrpio1llee fvs ()aDuaumo;t4tlenii3iytlm2eau pnu0 rtrif3oydop  ai s t0 2toxopoo1ape miet sfs2rm(  nu4tee mictasfmDemuvs;()texrxrciotlmt ai s ( srtm(mpoydalen nesat s2tmxm nu1openmieiadlsDem( p;t4trenxo ta1oaD auvs;t0srxoxmpny1ole lfesatfartmxmooo0olxomictydfsDrlnms;t)aeenmr3to1omDe ueo;(0 etmir3no1ale  iet t a2raxrpno4opeomoeils a rlu s;t4alenmo3oa1fatr ueo;t)s2to(r3oy1oltemfcsat)a2ur( onu1ope iietlsfm eluvsnu0texoif oadfm  aivsls)seuoir3ny4openmfvs tfsrtaur no0alen feiadlm2ua(mo t0 ltrir iodlat au s;()t2xrxo3ny4lptnmfci t)srurxrpoo1apxnmfeiatfaDra( p t0aexoxo3ty1optr u o;(0sexmxr3oo1lme  icil( srrrumpnu0tlto o3tytlmDrlu s;u0trerxo oytoat lueils0s2uoxrpoy1oltn netat a2tmuronu1openioctlsfaDemnvs;(4 lxrmf3tytlp eauvs;(  rurxo3iudlptemfvs (fsrumu pot4aet  oeiadlsDraump;u)trtnir iytlmDe n s;(  2tmxmpnudllen fvs ( a2ur( p;t1opx ifeiltfa ea(vo;(4 reomfctadlm e nvs;s0 eurio3ou1lleelfes t sDur(rpot1oltn o3tytls2rln o;t)trxoir3ta1laD lies (0tetm(r3iu4oltnlncsa()aDumxmonu4tex mfeildfa2ulu s;u4 exomo3oydfpDeaieo s0t2uo(opiodlp elnciasfs2um( pot4oleo i3iys aDumu pnu0trtoxrctytfmDr ues;s)srtmxopou4openmnvtltfs2taxmpnu0tltomieiltlm umnvo;u0tlenmociy1lmDe ies t0trtoim3iu4lptnlnei t  2rr(  ot1aetniieilt s rmn snu4 rxrmf3oodlm e ueo ( s2tr(mpoy4ape mnvt ( aDtrur no4tltoii3tytlm2rlump (4teenmo3iotlpDeaueslt)trtmxmpno1lptelncsls srraxmpno0tee mo3tatlm rm(vo t4altrir3oadfatr iesls texriopoydam nmfeilt)a2ra(m nu1aleo fciyt s uanmont) eerif3iodlatrlneils truriopiy4olte icsatfsDua( pot4tlxnioetysla umu o;t0altnir oadfpteaiei t sruoiopno1amen neia()aDrmu  ot1aptoifciyd a rlnvp;t0 ltoxr ia1oa   i s;s s2to(r3ou1ope  nvt t)arrm( pnt4aptomietld s2raums u)alxnmf3iytfpD aneo;t  eur(o3oudlp nlict (farurumpno0tpt miciadlsDrlnvonu0areomo tadfpDrauvolt0sexm(mpoodapenmfesa(f ruax pnt0aet mictldla umnvo u) eermo3tydfa r nei;t0t2to(m iodlpee ictls srtaxrono0olt if3ild mDrlnvsnt0texrir3ty1om r ivs;t t2urim nydll n ncsa(farrm(rpot4ape ioeiytfm2rlnmonu) etrxr3oadfm  lnei;s0teuoio3nodom nmfcsl(fs2trxrpoo1apen ociytlm emu s;(4artoio3oo1fpDr uvilt)sexoir oo1olenlfcsa()srtaumono4aee iiciad s2el( p u)tlxrmf oadoateauvsls s2xoxr ny4ome  fcs t arrr(  ou4tlenioeias m eanvpnu0aexnir3ta1fmtelivo;()t2trir3nu1lm  lnet sfsrrr( p;o0tpt  o3iadfm uln p () etoxocoatoa elueo s0s2tmxopiy1amtemivilt)aDua( pou4apt ifciysla2ra(mp;t4artnmo oytoa   ivo;(0 2tmiopny1lmt mivi s sDur(rono1aptnifciyt s eanmon(4artrif ty1opD lu s;s0teurir io1om n ivt t a2um(m nt1oeeo o3ias m ul(msnt0tlxnio oodopteaues;s trxmimpnu4al e nci sfsrrrx pno4alxniiciasla2rlnvpn(4aeeoir ootfmt ai o ()seto(rpno1ale  nvi (fsrtaum nt1apx  ieiasla rau p (4trtnmfcoy1oat luei s0tetoxr3oo1lltemncs t)s2umurooo1oee io3ildfa el(vp;u)trtrxr iotlmt lu s s  rxmxmpio4ol  mfvsa( a2ta(moou4tptoii3tltlm2rl(vonu4trxoir ootoateanvols)sexoim io4apt  ivias sDumumo;o4tet  o3tad m ra(vp;t) eenxr3iy1om e nes;()s2uo(m3ny4apeelfeias)sDrru p;o1aptn oetysfsDua(vp ()texrmr iydlp rln s;( teumxmpoudopte nei ( a2ua(rpoo4oetomociadfs elumonu)tlenircia1lmD  i il(0s2xrirpiydlpte nvilt)artr(mp;t4tpto f3ias a2uluvp;(4 rerxr3oy1omte i s;s) etoirpou4am e fvia() rua(ro;o4tltomi3iaslsDrlnvs u4tlerirciodlpDeanvi s)s2trir3nydopte fcsas  Dtaumpoo0aptn feildla rl(mon(0 leomfctydfm rln i t0setriopnu4oltelfctas aDur(  ;t4oltniictadlaDean pnt0aleomo oatlp elueo;( sruoio ny1amtn fvsl(f rra(r ou0oex if3iatls2ul(vo (0aexoxf3oodfp e i o;t s2uo(m iy4am e ncsas)sDrmx pnu1tptnioeilslsDrluvonu4 reoxo3oydomtr n s;()t2xrimpiudop  lnvt t aDra(  ou0tex if3ilt m el(mpnt)aexoxo3oy1fmte ivsls0 2xoxm io1ol elietls  Dtr(  no1apenifciltla rmnvp;t4aeenmo to1fpte nvs s) 2to(rpoo4ol elieia(fsDrrxmo;t1altoiictlsfa ulu p (0teerifcoa1faDrlieo ()s2toxopio4lpt lnct s) rtrxmonu1aleomictat mDum( o;u0 rtoir3oa1oa rlneils0srtrio nudllt  fvi t arrmur no4tlx ioetyslaDulumon(0 etoif todomD  u i ()s2urir iy4apen icsas)aDra(  ;o4optniieiat m2ea( o ()altnmf3iotoateliei;() 2tm(o no1op  mnet () rumxm ot0oee moeildfmDemnms;()tltniocoadlptr nes s) rxm(m3oydlmte fei ()sDrr(  ;o4altniictat m2rl( o u0aetrmo io1opDelnvi s  rxmir iydlmen fesa(faDtmx  ou1opxnmfciat a2uln onu4 lxomo totfaDrlnvol(0 2uoio3nudopen net t)s2rmumoot4tpt mfctlsfsDul(mo t0trxoxo3ta1fa   ieo ( setrio3ny1ame mfeil(  rrru p;o1aetn f3tlslaDel(vo t4tetrxf3oydoa e ueo;t) eumxr oo4ame lfvs () Dum(mo;o1tltn octatfa2uluvsnu0 ltrirctadlpDrai i;( t2uo(o no4lp elnet t aDumurp;t1oee  ociat a uluvsnu)arerio ta1fptrlnvs s0trxrir oodapenlieil() rururpoo4alenmoeiysfm umu p (0tltoxf oatlaDelivo ()seurim iydomenlivtl()a2uaxm oo4ale moeiysls rlnvp t4 rermrctotfpDeauvi;t0 rtoxrpno4amtn netl(f Drrx o;t0oeenmoetasfm ranms;u4 lxrxr3oy1fp raieo;s0 etmir3no1alt mnci s a2ua(root4tpe ifetldlm uln pnu4 lxrxrcia1lmteln i s  exr(m nu4openlfctatfaDumx  ot1ole mieiadfa2eaump;t4trxrir oatoaDe nes s)srxr(m3ny1om nlieia(faDrmxroou1tpenmi3iatfm2ua(vs t)alxrxr3tytfmDeai o s srxmxm oydlptnmict t  rrmxmont4aleomiciasfm eau p;()alenxf ty1op ran sl() 2um(r3iodal n neiltf Dtrxr ;o4opxo feiadfs2em( o;(4texoif3iatfateluvs ( s2xrio3nu1om e iciat)s2ur(mpnt0altnmi3tat aDuaump t0artrxo3oa1oaD li s;(0 etmxo iy4lpenlictl()aDuau  no4ope if3ils a rmu p;u)trerircia1lptr iei;s0teuo(o3nu4lp n fci ( a2tm(moou0opx iociyt a2ran s u0alxrxoctodfm raivilt  2xmim3ny1omee ncs (  Drmxr ou4tex  ictasfa2uan snu4arenmo3oy1fmtrauei;t)t2tmio oo4omte fci t sDrmx o;t0aex ioeiatfm rl( s;u4tlxnmr3oadfmDrli s;s0sruo(m3nu4op  mivsltf rrr( oou4tlt  fetadfm umu p;t)trxrioctodfm rau s;()tetoxr3nodamenlfvsl()a2urur ou4teeomoetytfs emn on()artoio3oodlp  anvi t0 rumirpoudal  liesl(fsDrmx  nt0alenifctld a2ulu sn() etnxf3tydfateaueo;t tetmir3oydol emfctl() rtm( p;o4oexo fciadlaDemuvs t0trxomf3todom   ueo;s)seur(o io4lpen netls  2um(moot0tpt  ociltlm rmnmo;u)aeerxf oo1lmtelueol(0 rurir3iy1alt  nvia(f rrax pou1tee ii3ildls2ranmsn(4tlenxr3oo1fa r i i;s)t2uoxm3iu1op nlfctls srrmu  nu0opxomo3tasfs2emu sn()aetoir oo1lmDeai o t) 2tm(rpoydlpenlnvil(  rumu pot4ope if3tyslm2elumpnu)altoxr3oadop eai o (0s2tm(rpny4altnmfcsl(  2umx ono1aeenioeiyd sD
\ No newline at end of file
@@ -0,0 +1 @@
+nesl(0trtmio no1lp  mivtat  Drrxm ;u1tpx  octlslaDraumo;u4teeoio todoa  lueo t seuo(r oo1apeelnctlt)sDum(mpno1olen o3iys s2emuvsnu0trtniocoo1oatr u s;t)s2um(r oudoptnmnet t  Dra(rooo0teto ictadfaDua(mpn(4arenio ootfmtraivi;(0sexmxopoy1lmeemfvsa(fsDrrx pnu1alx mieiyt a2eanvs (4aeeniocia1faDe nei;( seuoirpny1am n ieiatf rrr(  no0oex  oetad a2umnvp;u4arxnmo3todlmDeanvi (0 2tmir3oydoltemfesas)sDrrxmpnu0aeeomi3iadfa2rluvp;() exrif3oy1oa   ivo s teurimpny1ope  ietlt)srrm( o;o4apeo ictadla2umnms t0alenmo3tydopDeai o ()srtoxopnu4llenmnvias)a2tmx  nu4tpxnmfeilt s2uaums;(0altrxo ia1la e ivo s0truoxopoo1lpe mnesat a2tax ono0apt ifcild sDem(vp;u4arxrio3oy1omtelnvilt) rxo(mpno1ap  mnet tfa2taumo;t1aetomfctys mDumnvo t4artnxrciydomDe uesls) rtrim3io4aptnlieta() 2rmu  nu0tpx  o3ias s uan o;t)tltnif3todlp eli o t)texoxo3iu4llen nvia(fsrurxront1tpx micils s ra(vo u)tlenmocty1fat li sl() rtrxo3nu1olenmfvil( srurxr oo0aet micildfa2emuvo;(4 lxrxrciy1lmDrluvs;s) rtrir nu4lpenmivt (  2uru o;o4apeo oeiytfa2ea( s ()arenxrctytoateln s s0t2tr(opnudopenlfeias  2tr(moot1oexoio3iasfaDuaump u0 eerxf3tytfmteai o;s)t2umiopou4optn iviat arrmur ;t4olxomiciytlm2um(mpnu4aetomo3tytfaD auvi;t0 rxr(m ou4ole mnvtl()sDumum ;t0aeeo f3iasfm eanvp (0 etoif tydfpte nei t)t2xmim iu1op n ivta() 2rmxr no1openii3tas a2emnvp u4alxrxo3iydla elieolt srtr(opoydol  mneias) 2tm(m nu4aeen i3iatla raumo;u)tlxnirctadoat au s t)t2xmxrpoo1amtn fvsasfa2urumo;t1optoiicildlm rl(vont) leomr tytfp   n o (0sruoxo3nu1op elnetas)srrrxr nu0apeniietytfmDuanmp;(4tlxnmo3iodla e uei;s trxm(opiodlmenliciat)srrr(  nu0tpx iietytla2el(mp;(0 leoxf3oa1lpt lneo s0teur(mpiu1lme  nvs tf ruauro;t0tex  o3tatfmDum(mp;()trenxr3iydfm eaivs;(0setoxrpny1ope lneta( aDuaurooo0aet ioeiyt aDuanmp (0aeenir3oydlptr i i (0srum(rpou4omee icsat sDua(  nt0tptn oetadfm emnvpnt)aexoio3ty1la  aiesls0texoxr ou1lpte ies t)s2tm(mpno1alen iciasfa umnmon(0trtnxociytlmte ivs t  etrxmpno4lptnliciasfsDtaurpoo1apenmi3iat a eau o;u4teenmoctatoa rlnvs s)s2xoirpoydamt mivsatf Dra(r nt1openio3iat s el(vonu) eermf io1fptelues;t)s2xoirpny1lptn fvtas)srtr(rp;u0tpxnmiciatlaDemuvpnt) rerxr3oodlm rai i t  rxrxr3nodameemnvtat sDra(mont4aet miciltfs2rluvpnt4tlerifcio1fa  lnes;s setmiopoo1lptnlfctlt sDtmu p;o0tltn ociyd aDrmn pnt) lxnif iotfpteauvs;(0srtoir3oo4ol emieiltfa2trx onu0olxn f3iydfa2eauvs;t4 eerir3iotfmD lnei (0 rto(r iodam emnciasfs2tmxr oo4aetn ictadfs umuvp (0aetoxr3oodom   ieols  rtmxo oo4olt  nvs t) 2raxrp;t0tltomi3tat sDul(vsnt)tetnxfctodfmDeluvi t0 exoxm ny4lm emfcil(f Durumpnu1tltnifciys mDrmnvs;u)areomo oodfm  aueo;s0 rtm(o3io1ll  lnei sf rumx  ou4tltniociltlmDul(vont0areoxf iatfpD  u s;s s2umir iudlptnmnesa(fa2urx p;t1oexomo3iatfs2emuvs () lxrmr to1oaD ai s ( srtmir ny1lpt  ivil() Duaumoot1ape  i3iadls2ulu o ()trxoif ia1oaDrlu s t0s2tmxr iydolen netltfartmum ou4tleoioeiysfa rm(vs;u0 rxnxf3oadlmDe ivslt)srumxm oy1lptelnct s sDum(mpnu0opeomoeiys s2ua( onu4 rermociytfmDraneslt)texrxmpou1oltemivils) 2urxmp;t4tlxn i3ildls rauvo;t0aetrxrctytlpteanvo ()sexmir3nu4omt lietls aDraurpnt4aeen ietad m rm(vo u4aeenif oa1om  lieols  rxrxrpiy1ameemnci s)aruaxrpot0tee ioeildfa2emnms t4artnio totomDelu i t0sexo(rpoo4ap nmnesat sDraxmoou1aet  o3iltfs2emnms;() exoxf3ia1lpD lies (0srumim oo1al e iesa(  2um( pot0optoifetydla uln p;u0aetrio3iatop e n s t0 rurimpiodam  mfei s s2ta(m oo1ole mf3tlt a ua(vsn(4 rtoxr3ty1fmt lnesls)truoimpny4altnlfvt s sDraurpou4aeen oetys s2ul(mo t4trxomr iydfp elivi s0 rurir nu4ll emnvtl() rurx  ot0alxomociytlm eaumpnu0aexnircoytopDeaueo s s2uo(opoodlm n ncias) 2raxmpot4tpx mi3tatlm rm(vo;t0 lxrio ta1lpte ivs;(0setrimpou1omt lfci s aDtm(  nu4oexniociydfaDulu o;u4aeeoif iytlaDrluvi (  eumxo iy1op  liviat)a2tmx o;u1tlx  f3tad mDra( pnu4trxrmf3totlmDran o;t teuoir3oo4op nmiei s)aDtr(root4teeoifcilsla eaumon(0arxoxr3iadlp e ivi s0trtmir3oo4alte fciltf rrmumo;u1oexo o3iadfs2rlnms (4aexoxf3iadopDran o s) rxoio3iu1om nlnvt t aDtm(  no4tptoif3ild aDrl(monu4tleoio3iotla rlueo (0seuo(opoodlltemivsasf 2taur ;o4opt mo3tltlmDean on(4 lerxf3tatomD  u sl(0 2tr(r3oudlp e fvtls)artr(r ;o1apxnifeiytfs2um( pnt)aeenir3oatfmt ln i (0setm(rpno1lmt  ieiat  rur(  ot1apxoio3iydfs2el( snt4 exrio iatoa e n s;t  2uo(m nu1ol  micsl()a2rrum nu0tpx mi3iydls2umnms t0arenxfctadfatran sl( seumxm iy4al  mivsls  rra(mpnt1alxo ictyt a2elumont0aeeoxf3oa1la rau o s trxmim3nudamtn ncias aDum(m ou0aetoiociysfa2emnmpnu0tltrifcoydfaDeln s;(0teur(rpoo1optn iviatf Dua(m no1tpeoiictyt m2umnmo u)aexrxo3oy1fm rluvo t)teuo(m oudlp   fvtasf Dtr(mpoo1altomf3iyd m2ul( o;u)arenxf ootop r ues (0s2xoir3io4openmiet t aDtm(root0tpxniicild mDrl(vs;u) rtnio3todlmtrlueslt setoim iu4optnlnei (  2ta(m oo0altomiciydfaDrmumo;() eenmf iytlp rlneo (0setm(o3iu1am   nvt t) rtmu  ;t0oeto ietydfmDulums;()aexrio3oatfa  lues t) 2xo(m3no4opte ivt sf Drrxmp;t0apxnii3tys a2ea( pn(4aeenmocoytfpDe n sl(  2to(opio1olee icsl( a2uaum ;u1olt  fcils a rlump;u0aetoio oy1om rlu i t)texo(rpny1amtnlivt t)sDta(ronu0optnmoeiydfa rmump;(4aeeoxrcia1opt  i o;s)tetmio3oudoltelnesa()a2um(mpno4oexo oeias s eanmpn(4 leomfcoadlaD  neil(  etrxo oo4opte fci ( a2rru  ;o4opx io3tyt a2ul(mo (0 leomr3oa1oaDelues;t)seum(r no4ame lfct s aDraum oo4oex mietad a2ua( o;u0 lxoxf ty1lmt aivo;t  rto(mpiydll   ivsatfsrraumpnt1tltomiciasls eaump;t4artomfcoadlpDe ivo () 2trir3ou4alt mfvi s  rraxrpot1oet  oeiat s ulums t)trtnxf oydop  anvs t0s2toio iodlpe  icils aDrr(rpnu1texomi3ild m2em( o (4teeomr3tatfp   ivs s)seumir nu1optemneil()srumxro;u0oee ioeiys mDelnmp;(0 etrir totlmtrlies;s  exo(r oo1om nlfvsas)srtmxm oo1aex moctys a uluvpnt4trtomrctydopt  neols0seumim iy4ol  mfcilt s2uaurooo0oetnmietydfm emnvo;u)arxriocoytfm   ieo;t) 2tr(rpiy4llt lnetasf Duau oou0tptn fetysfa2eaumo t)teenifcoodom  aivo;s sruoxo3iudoltnmics (fs2rmxmont0tpeomiciad aDem( pnt)treoirciadlm r n s t0 rtm(r3iydal   iciat)sDra( o;t0tlxoiocilt s2rlu p;t)tetrmo tytoaDean i s tetm(mpiudomt mnvi ()a2tm(rooo4tpxoiieiydlm ul( o;(4altoxr ootfpDeai o t0 etr(mpoodop nmnvsl( arrr( poo4oet iietytlm2ulu s;u0arerif3ta1fa r nvo t0tetrim nudlp emnvils srur( o;o0oexniieiltlaDelnvpn(4alenircoodfptr i o ()trtrir nudole lfcta()s2tmu pnu4opxomoetad s2uau o t)arenio3tadlat liesls truoiopno4llee ict t) Dtm(  no0apenifeilslmDra(ms u4 leomo3tatfm rln s;s)s2tm(o no4aptnmncsls aDra(mpnu0ale  ieiys m2el(vpnu0tetnifciodoa e uvs;s  ruoxm iydope  neslt)s2rrumoot1teen i3ildfaDrmnvpnu) rtoir oodfaDranei;t sexmim3oy1llen iesls a2rm(moot1opt mieiyslm ra(mp u0trerxfctadlpte uvo;t) 2xm(r oo4amtn ict ()sDtm(  no1aptniociasls ulnvs (4 rtnxrcia1oaD anvo (  rxm(o3oodalee ncils) 2ua(moot4opt mfciytls2rmnvp (0arenmociydfpDeli s;(0srtmxr3oy1lp  mfvsasfsDra(mo;o0aetnmfetldfsDeanvo;()aetomf totfaDelivil() etr(o io4ome  ncslsfartru oot4olt micilsls2rl( p (4teenmo3oytom e uvs;( t2trim3oo4lm nlnvia( arumxr ou0alxnioeilsla2ea(ms;u4 etrxociydoptrai i t0t2urio3oo1lmtnmncta()a2trx pnu0opxniieilsla em(mon(4arxrxrcta1lpt ai i t0 2ur(mpoo4alee fesltfarum( ono0altoiietyd s ul(vsnt)tetrmf oatfa rlnvs t0 rurimpoy4amenlfcsl()sDta(rpou1aeeo oeiadfsDra(vp;u0arenir tatop r uei t) eumxo3oo4al  mnvtl()sDur(mo;o0aptoif3iatfm el(mp;t0artnmf3tytfmD lnvo;s trtoxo3oydlmtnmfvs (faDra(mo;t1aptn ieiytla eanvs;(4 leoxoctytlp r neo t0t2umxo3oy4amtnlnet ()srrr(m nt1oltnmoeiydfaDrlu ont0 ltnircoydfmtran s;s)sexmio3oy1omtn icia(f Drrx ono0aptomocilt mDemnvsnu) rxomo tytlmD  ivo ( trtrxrpiu1optelfvilt sDuax p;o0apeo o3iltfmDrmnvp t)texnio3tatlate n ol()s2ur(opoy4lm e iet s)aDuau  ou4alxo ieiatfs rmnvpnt4tlenmfcoatoaDr ieslt trxrim3io1omen ivi () rtrurpou4tleo icilsfm2uau p t)trxrif iytlmDrliesls)t2umir oo4ape  neslt srua(m ;t0oleo iciyt s2rln s;(4texnioctatfm eluvs;()t2um(opno4ap nlieta()s2rmxmpot1apt mfciydls2ua( ont4tetrmfciytop   ues t setmxopiy4ol   ncs t)aDra(rpnt4oexn ociatlaDrlums (4aleomf oadlaDrauvs;(0trxmir3ou4opte ies s)a2tmu  oo4tetnmfcild s eanmp;t4aeenmoctotlp  an o s tetm(r no1lmenmict sfsDraumpnu1ale mfeiatlmDrmumsnu0aeermr3tytfmt auvs;(0 eurxmpiudoltn ieiat  2umu p;u4apxn i3iys a rluvpn(0tleoxr io1fa e i s s) 2tmio3nudlp nlfes s s2uaxmo;o0tltnii3iydla umnvs u) renio3ty1fpDe ueo;t)trxoxm3iydlmtnmivsa() rurx pnu0aexoio3ilsfsDrau s;() lenxf tadop e ies;t) rtoxrpiy1ap e nes s)aDtaxr ot4tptoiieiadfa2eln snu) rxnxf to1opt livs;t t2toir ny1lmen fet ( a2ra(  ;o4tle ioeild s eaums t0 lenxr3ia1op elnei;s)truoxrpny1olt  ivtltfsrtmum ;t0oet  o3tat a2rmn onu4aetrif3iodlm elueilt0 euriopio1lmeelnet sfa2um(ronu0opx  ociyt mDrmu snu4aexomr3io1latr uei;s0srurim3nudopee fcta()srrmxr nu1tlt ii3ild aDum( o;t)alxnxocoadlp elu s (0 2trir iu1apte nvsatfa2rrx p;u1tpxn oetad a rm(vo;()texrmf iatlatraieilt s2xmxm nu4om e ivsas)sDur( onu0alx mi3ilsfm emnmo t)tetnif oa1omD anes;s)trumxm3iu4lpee fei sf 2um(mpou0opx iocildlm2el( pnt4alxoir ootla eau o ( trtmxr no4om  mfeia() Dtax  ou0apx moetatfa elnvs t4areomf tydfaD  i o () etr(rpiy1lptnlfes t a2rmumpou1tle miciydfmDrl(vs;u) lxrxrciadlptr ieol(0 rtmio3nydome  ieils)srua(rp;o0alxniieiat a2rl( o;t)alxrif oadoatean s;s0trtmirpno1ameemnes ( aDtm( p;t4oeeomoetaslm2eanmpn(0tltrmfcto1lateaneo t0sexmir nydllte fvsl(  rraur nu4oeenmf3ilt a ranmo u0 exomrcoadfmDelieols0srtoxm nu4amtn ivslt a2taxrono1openmo3iadlmDemnvpn(0 lerxo oytlp rlu sls)texoir iodolenlncsasfa2rru ont0alenmociys s2em(msnu4tlxoif oa1fatrlieo ()s2umim nu4llee fcsasf Dra(m nu4oet if3iadfa2umuvsnt)tlerxo iatfa e neil(0 rxm(m io4altn fctls  2um(r nt1aeeo ieiyd mDrmnvp;(4areoxociytlat lueo t tetr(opio4lmtnmfvi tf rumx p;t1oex iiciaslm2eln p u4arxoir3oydom eln i;t0 rxmir io1olenmfesasfsDtr(mpot0opxnio3iatlaDrmnmpnt)tlxrioctodoaD li sls0srto(r3ny1al nmfvils)artrxm ;u1ope  o3tyt m2ra( s u4aeerxr to1op rlnei;t tetrxrpoydapenmnci ()a2ua(mpou1aeeo octasla2uln p u)tlxrxfciytfp e nvo;( srurxr oudomen fct sfsDrr(mp;u1opx ii3ildlaDul(mp;t4 rtnio3oodlmD au i;t sexrxrpoo4lleemfeias srtaum no0oet mietaslsDul( onu0 rtrmf3ta1lmDrluei t0seumio3iydopt mici ( aDuau p;t1aex moctldlm umn sn(4tltoiocoo1opt an slt0s2xo(r ou1omeeliciat)a2uaxmpno1oee mfciydls uauvo (0aetomo oa1fptrlu s;( teto(o iudol emnes (fa2ua(  ou1apxo octltlsDrlums t)arenxrcoy1lm ean s;s0trxrxo3iudap n nesls) Durx  ;o0opto feiyt m em(mp t)alenmrcta1fm eaivo;t  2xoxm3oodaltnlivsls) 2tauro;u1olt mociad aDrmumo (0 leoxr tydlaDeluvs;t0s2um(o3oy4llenlnesatf rur(  ot4apt iocilsfa eauvsnu0 eeoxf3todfpDe nvil(0seumxo oydlmt lfvs t aDuaumpot4olt ifeildlm2emnvp u4aeenxf ty1op e nes s srtoiopoo4aptelnvtlt)sDtm( ooo4tpxoiieias s2rl(mo (4trtnmo oy1oaDeliesls0srxoxrpiy1ameelies ( a2ta(r ;o4tptn o3iydfsDul( p;(0arermfctatopDr nvils0 2xrxm io1ale  nvsas)a2rrx p;u0teenmo3iyd a eanmp t)alerxfcto1fateaies;t texrirpoo1omenlnvtl( a2ur( p;u0teenifetytlm2ulnvpn(4trermo oy1om eaiei (0sexrxo3iy1lmt mnci sfa2tmxmo;t4aeto f3iasfsDean onu)tleoxoctodlmDrlueolt0trxrio oo4ape  fctl()sDtau onu0tetomo3iadlm rmumpn()tetomr iatoaDeaueo s0srtmxr nu4lleemivslt)aDrmxmpnt0opx  f3iytfm2ranvo;(0 eerxr totfa raueslt0t2toxm nudaleemncsl(  2tmx pnu4oltnmoctys aDea(mpn(0areoiocta1lmDe neilt  rtr(mpnu4lltnlicia()srumxro;o1apeoioetys m2umn o u4 ltrmf ootfp  aueolt0s2xriopoo1ame mnvt sfs2umxmp;t1tlto feiasla ulumo u0 lxrxr3iy1fa  lieo;s0srxoiopnu1llenmfct t)sDum(r nu1tleoioeiydfs2rmu ont)altoir3iytlp  auvols0srtm(m oydope lneslsfaDumx pot1oex iieiatfs2ua( s () rtnifcia1lpDeluvsl( truoir3iodal elfeta( s2rmx o;t1ape if3ilt aDemnvs;()teeoxo oadlaDelivsl()trtr(r nodap  lnctl(fsrtm( o;u1apenmfeiydls umn s t0 ltoif tatfa ran i;s) 2umxm ou4lm elivtas)aDrrx  ;u1aeto o3iad mDumnvsnt)alxnmf ootlm eaneolt t2urir oo1op nmics sfa2ur(mooo1oeeo feiat m2rm(vs u0aexnmf3ty1omDeaivs;t sexrio3nudopee icsasfa2umumo;o4ale  oeiydfsDraumsnu4altnxf tatlm  luei s seumim3ou1am  mfvsa(fs2rm(mo;u4olxn o3tltfaDemums;t)aetomr3iytfp rauvs t) 2ur(rpiydlm  lfcs s  Dtau p;t4alxnmi3ils m eln onu4tleoxrcoa1fpD livo;t)t2toxr io1ale livtas srtmx o;t4opxomo3tld a2umump;u0aetnmrcoadlaD  ueo;s0 2toimpiu4op n fvt ()sDtrum nu4tex iietat m el(vonu4tlxomo totfptelieo;t0 ruo(mpiydop n ncia()srumxrpno0aexn ociadlm2ua(vs u0tlxomo iy1omDrauesl(0srumxo3nodaltn ieia(faDurxmo;t4apx iicilsfm2emuvpn(0treoxf3oa1latraiei;s0t2tmxrpoo4alt lieslt aDrrx oou4opt  ocilslm eau s;u4tltnif iytlpDrlnvs s srtoimpiu1ol n fvslsf rrr(m ;o0optn i3tatlaDean s (4 lxomf iotoaDelueil(0teurir nu1lm n fei s aruau p;o0ope mo3iltla2em(mo;()tlxoircoa1lp rlieilt)trxm(r iu4lmeemfcilsf Dtax  ot4tet mociyt s eauvp t)texrmo oytlmD lies;()sexmirpiodaptelncs (  Dta(rp;o0tet mi3tydlaDemn o;t) ltnxfctytfmtr uvs;t s2xoim iodlp  lfvta( sDurumpno4opt mf3iaslaDumuvpnt0aeerif ootlatr u s;t)texrio no1oleemiei t)s2umx oou4teeo f3iadfmDumnvo u0tleoxociatlpt lueo;()srtmxr3iydale lnvi (fa2ua(rpnt0alx  ieiyd sDua(mp u4arerio ty1laD  ies;t t2ur(rpoo4lp  lfctl( aDraxm nt4aleo ieiydlsDuaump u4trtomf3ootfpDr i s;s0sexoim oydoleemfvsa(fsDtrx ooo1tptomociat a rlnmsnt0aexrmo oatfm rlnvsls)s2urio ny4alt  fvia(fs2uru ont0tlxoiociyd aDeau snu4tlenmfcoo1lp elnvs;t  exoxopny4oltnlnei s)aDua(mo;t4aex io3iltfmDem( s u)aeeoxo3iatopD  ivs;s) 2uoir iudam nmiciat  2rru pnu1aetoifeiat s umu o;t4areoxr iatfmt anei;(  rxoxr3nydll  mfeias)arua(rono4tpenmictls a2um(mo;t0arerxo oadop r u o (  ruo(opou4lltelnciasf ruru onu0oeeo icildls emn o;(4aeeoxf oydlpDr nvi;s0 ruo(o ou1lp  mfeta( s2tax ono4tlxnifciysfaDrauvs;u4tlenmfcty1oat lu o ()t2xmir nodol nmncta()a2ra(rono4aetn iciyd mDea(mp u4arerxr3ty1laDeaivi ( srxrxmpio4olt  nctat  Dtmu  ;o4open i3tytfa2rm( onu)teerif3ta1fmD  neolt)tetoxo oydop elfcs ()arur(mooo1oltnioetadfs2eluvs;(0 lxoio3ty1opt  uvsls)s2xrxo3ny4ap nlfetas s2tmumont4ole  i3tat m rm( pn(4tetrxf3iydfatrauvils trtm(r3iy4altnlfesatf Dua( ono0tpx iieiaslmDrlnvp;() exrir3iytoaD  ivol(0texmim ny4lle  ivtlt s2tr(mo;t4altnmf3ilsfm rluvp;t)aeerxf3ia1faDranvo;s0s2uo(opoydlle  ict tfsrtmxr ou1apx  octyd a rl( s;u)trxnxfcoa1fpt livilt0srtrimpnu1lpt mncsls s2urxront1tptn fciat s2ra(mo;u0 rxrxf oa1op rlivils  euoxr no4ll nmivt s aDururpnu4ole  oeias s ua(vo;(0 eeoir iodfa eauvs t) eumio3oo1altnliesltfs2ra(rpno0tet  iciat a2rln pn(4 lxnxo iydomDrliei (  2xoxo nudopenlfetasfsrtrumo;t1ole ifciyd a rlums () lxrxf ta1la eaieslt0t2um(m3oo4ll   nvt (farua( o;o0aeen iciydfsDemu s t) lenxf oatfm rauesl(0 rtoxr3ou4lm emncsasfa2rruro;u1altoiiciyd sDrl( pn() rtrmo iy1fpteluvi (  2umxmpiudoleelnci () rur( onu4tptnmocilsfm emumo (0 ltnmf3iodfpDrlueo ( trtoimpiu4olenlnei ( a2rrx pot1aleomoctasls rau ont4 rxnio tytoa rauvs ()seurim3oydlm emnctatfa2raurpnt1oexnmieild s uaumo;t0 renxr3iatfa e ieo t)texm(r ou4lmeemfvi (fsDraurpou1tle iictys m uau s u)arenxr ia1lp r neo ()s2xr(r3oydomtemfei ( sDraxm nt4tpe mfciad m2eauvs t)artnir tatfmtr n sls0 ruoirpno4ll  livsas s2taum no0tpe  o3tls aDra(ms;t4altrxrcoydomDe ivo s0 rumxm3oy4olt  ict t)aDrmx o;u1oetomfcild aDemumo u4artrxr3iytoate n ol()t2uo(m3oy1om nmiesat)s2rrurpnt1tleo feilsfm rlu o;t4 rxniocootoateai sl(0truo(o3nu4ll   ivsasf rur(rp;u0olt  o3ild s rm(vs;u)trtrif oytfptraueslt0 ruriopoo4lme lfetl()sruaxmooo0alx mo3tys sDeaumpnu0 lxomf io1omt li ils t2xrim nudaltn fci (fs2rauro;u1tpe io3iadfa2emnmp;u0teerxo oo1lpD  uvs t) rxr(r3nodop emfvi () 2raxmont0apx io3ildlmDem( o;(0trxrxf3iotlpteauvi;t0t2um(m oudlm   nvslsfsDtruro;o0oltn f3tasla eau pnt) rerio3ty1oaDr nvol(0s2xoxm nu1lmt  feil( a2taxroot4aexoii3iysfa ranmo;u0arerif to1omDr iei s srur(rpiodape  fei ()s2rau ont0oetomoetlt s2uln ont)texnir3io1lmDr neo t)trto(o3nydll  mieil( sruau  ;u1optn fcilt a em(monu0teerirctytoate ieil() rtoio iydlmtelnct (fa2rm(mpou1tex ifciysfm ua(mo;u)alerxo3iydlptraieils)setm(r3iy4amen icil(  Durx p;u4oeenii3iaslm ulu on(0 rxoxfcoatla rlieo;s  eurim3oo4llte ieta(f rrrur nt0tlx mo3tadla2emu p (4aexrxr ootlpte uvs;t) eum(o nudaptnlfvtasf 2urumo;o1aptomocild m2umn ont) ltnmo tadoaDrlieo s)sexoim3no4ol emivsl(fs2ururpou1optoii3tasfmDemuvsnt4tetrmfciydfm  ai s s)seuoim oudlltnlfeslsfa2rrxroot4opt if3iatfm rl( p u4tltoio iadopt aieo t0seurirpiu1apt mneilt srrm(rono4alxomoeiysfs ranvonu0aetnif3oo1oatean sl() 2tmxmpoo1lmen fvilsfa2ua(rpot0oetomoetldfsDrlnmsnt) etrif3totopteanes s) 2xrir oo4altnmfcslsfsDrmu pnu4apxnmfcias s2emu o;(0aetoxf iodomD aieilt  etr(rpny4oltnmfvt t)arua(  nu1olxnmieiytfm el( onu)alxnxociydop eluvsl(0texm(o oydal   fet t)a2tau  ;t4aleo o3iltla umnvp (4tlenir3iodom  ln ilt)srtmio3ou1ameemicia(  2ta(  nt0opt  iciatfa umnmont0texoxr3iodomD  ieo () 2urimpnydlle lnesat) 2taumpoo4openmociydla rmn o t0areoif3tytomD  uei t0t2xr(mpiu1lptnlfcsls) rrmu o;t1aexo fciytlmDrmnmp t4 leomfctytlmDrlueilt)s2xo(r nudomenlfvtltfarum( ont1ale  fctat aDua(monu0tetomf3oydoaDelnvilt0 rtr(o oo4ameemivtl() 2urx ooo0olto ociasfmDea(vp u0tlenmf oodfa  anvi;()sexrxr3nu4lpeemicils)s2rru  ;o0aeeomoetasls ul( snt) rxrmf iy1omDe nvolt) etmim3oy4lpt  iciasfaDtr(  ;o0opxnmieiytlmDulumo t0 ltoio iotfptrauvi;t)srxoir3nodame  fvta(fa2umxrp;o4tltnmi3tysfa2rlnms t0texrmo3ta1fm  aieil() 2tm(r ou4al nlfeia(  2rm(  nt0opeo fetyt s emnmo t4 lxrmr3tatop r neslt0trumim oy1lmt liesas)a2trum ;t4tlxnmo3iyt s2ranvo;u) etnio3to1opte uei s0 2xrxopoy4alenlietl() 2ta(r ;t1tpen ieias sDumuvpn(0aleomociadoa raivo;( trtrxopou1lmeelfviatfartmu ooo0tex mietadlaDrm(ms;()tetnxo to1lmtrai i s)texmxo nudlm  lfvt sfsDrmx o;o1tpxn f3iys s ranvsnt) rtrxfctytlpteaivo;s srtrio3iu1lptnlfetls aDtr(m nt4tet  ocildla2em( o;()teenxr3oatfa   nes ( t2trxo iy1am emfesa()sDtm(moot1optomietltlmDulumo;t)aeeomf iytfm  luvo;()texr(rpoudlmt  fctlsf rur(  ot4tleo ieias s2rlump;u4 eeoxocia1lpD  neo t trtoxmpou4llt  ncsl( sDtrx  nt1aetomoeild s umnvp u0 lenxo3io1om eai s () rxmimpnydoltnmfvtltfsrtmu  nu4oex mieildlsDeanvp u0 rxomf3iydfa elieo;()texm(rpnu1ole  fes s  ruaxrpou1oeenmociyt a2uanms;t) exrxocoydlptr nvi;s s2uoimpou4alenliet t srtmur nu4optn ieiasls el(vo t4tleoio totlm r u i t t2trimpio4ap elnvs sfs2raumoou0olenmi3ild m uau o;t)arermr tydop eau s;t)s2xo(r3oy4aptnlnesa(f 2urxrpnt0oee iociasfa um(mo () rtrmrctodomDr uvil( trtrxm ny4lmt mfetatfa2rr( oou1tetn feiydla ulu o;u0trtnmocty1omDelivsls)trum(o ny4oltnlfcsl( a2uaump;t1teenii3tytla rmn p t) lxnif3io1opDrlivs t)sexmir3no4lpe  nctltfs2uaxrono0tlx  f3iytls ulnvsnu)aexomr3oydoaDe ies t)teuoim3iu4apeemfct s srraxrono1aee mictldlsDel( o u0 lenxo iodla   ivi;t0 rxmxo iudlpenlnesa(  rtm( poo1tleomf3iaslaDum(vonu4trxrio3oadfmD ai o;s) rxmxo no4am emivs ( sDrax  nt0olxn i3iyd s2elu p u0trtomf3ia1fa r n i;(0 2urxm oudol  mieiltf rtaxmono4tlt io3tldla ulnvo t0 lenmo3tytomDelu o t teto(m3nydameelivi ( sDua(mp;u0apeo fciadfa ul(ms t0 exrmr tadlmtrluvo (0truoxr oo4omt mnviat a2tmum nt1altoiieiat m2ulumont) reoxf3oatfa elivs;t0tetmir3iy1omtn fcs s)srtaxroou4tet  ietytla2rmnmp;t4 rxnxf3iodlmteaueslt0t2xm(m3oodlmtnlietls) 2ra(  no4alto i3ild sDra(mpn(4 rxrio3oodlaD  i sls0seuo(mpnu4al elivi ( srum(mo;t1ale ifetadlaDrmumo;u4tlerxocoa1oa r u o (  2tm(o iy1lpee nvt s s2tmurpot4teenmf3iad aDeanvpnt) rxnir iodom eanvslt)srtrxopoodlmtemncia(  Drrx oot1tlxnioetlslmDranmp u0arxrxrcoytfaD liei;s0 rtm(r iu1lp   ivtat)srtrxmo;o1tle iieiytls rm(mont0 eenmo3oytlm  liei t0texrio ou4am n nviltfsrta( pou4oleo f3ilsfm ranvs;u) lerxr3io1om r nesl(0texo(opiu1olt lfetat)a2taxm ot4olxomfciadlmDuanvp (0tlenxocoydopteln i;s0trtr(o3nydam emfesls sDra(mp;u1tetnmo3tlt aDul( o u)tlenxocta1opt aies;t)srtr(mpiy1ape  iet t)sDtmx o;t1texniicildfsDel(mpnu0trxoir3iotoaDe ieolt)seumxr oy1lmt  nviatfartr(m nu4oex  ociydlsDranvon()alermfciy1fp elnvo t0sexm(rpou4ome  fcia(  Drrurooo4aeeomo3iytlsDuluvp;() rtnxr3oatlmteau sl()t2um(r3nu1lme miesas)aDumx  ;o0alxnmf3tld s2eanvsn(0 rtrmf3io1fpDran i;s  2xmxmpnu1lltemnei sfa2uauroot4oex  o3tldla2eaump;t0tlenif3ty1om  an ils  2umxrpiu4lm emnciatf Dum(  ot1opxn fciadlm2umnvonu)tlxrxo io1fpDrli i ( trxm(m nydop  mfcs sfaruau p;t4tetn icild sDuanmo () rtoif3iy1oaDeanesl(0s2tmirpoy4lpeemncsltf 2umxrono0tee ifctltfa2rln o;(4 lxoir to1fpD lu s;t)teumxo oy1lle lnvsa()arrrum nu1tlt moeiydfs em( s;t)texrmoctodfpDrln s;(0teuoim3ny1lpee fcsltfa2tr(rpot4teeo ieilslaDelnmont0 lxnir3iytom rau o s) ruo(mpio1am  lict ()aDumum ;t4tlt mietld m2ran o u4 ltomfciotoa eauei (0srxriopiy4omt mnci s  rtrxmono0tleoif3tatla uau s (4 rtnmr3oo1la eanes;(  2tmir nodaleemnvia(  Drrxro;t1olt mocilsla em(msnu0texnif oo1opDe uvs ()s2umxopoo1optelics s sDum(mpot4openioeiaslmDeaumonu4texrxf iadopteauvil( texoiopnodop n fci (f 2um(mpnu0opeo octys m ulu s u)trxnif to1lpDr n sl(  rum(o oodale mics (f ruax p;o0altomiciydfsDeluvp;(0 etoxo oy1op raieils srxoir3nodaptemictlt srtrx p;u1texoioetysla rlu s t)tlxoifctotopD livo t) 2umxr iy4omtemictat)srumum ;t1aexnioeilt a2uln p;(0aetomo3tadla  au sls  rtriopiu4om  lfvsa(  2tr(mono4teto f3iytls2rl( pnt) eermf3totoptelneols) rxr(rpnu1am   fctasf 2ta(rpnu0apxn octatlm emn on(4 renmr oa1fp  ai i t0srxm(rpio1lpeelfcil(fa2ta(mono4tee ioeiatla2uluvo;u)trxnxf3oy1laDeanesls  rtr(r nu1ame mfcsasf 2rm(mp;u0tpt ii3tyt s rmnmont0 lenif3tytfmtrlueo ()t2urxr nydom n fct s)s2uaxmpot1apenmo3ildfm2um(monu0teenxrciotfmtrln s;t  2urimpoodom emfvsls aDta( poo1tlxomietyt s emuvp u4tetoif3oatfmDe n s;t) etm(m nu4lmtemfctas)arrrxmpno4olxnmo3iat s2ranmp;t0texnmf3iytlate ivslt s2toimpiydolee ivta( arua(mono4optn oeiatfs2ul( on()texnxo3oydfpDrluvo;s srtm(m nodoptnmfeilt  2rr(mpnu0olxnifcildlaDumnmp;u4aeerir3todfpte neslt tetrxmpiydlmtn ieias  2raxrpoo4tptnif3ilslmDumnmp (0 rxrif ta1opD auvi;(  rtoxr3nydol  mfei s) rtrxmpnu0tex iocias sDea( s u0alxnmfciydfmtrln olt trto(opiy1lltemfcsa(  Dtaxro;o1tlxnif3iadlsDemnvp;t4 rtrxocoytfmDeauvsls)srxrim3oy4lme lfvsa()srrm(  no0aptn oeiytfa uaumsnt4artoif3iadlp   nvs;t0seuoxr nu1omte ivt (fsDurum ;t0teeo o3iydla el( o u) lxnircoytfptelu s s) exrir oodameelict tfsruauroot4tex  f3tldls2umnvpnt0texoir3iotfm rlnvi;t) rxmimpoo4optelics (  Dtmu o;t1oexo ociadlaDel(vpnu0alxnir3oytfm eauvo t setrxmpiydape mnct ()s2tmumpou4oleoioetydfs2emnvon(0tltnio3oytlaDe nvol(  rumimpoydameemnct tfsDrrurono4alxn oetatfs2raums;u0 rtomf3tytomDranvolt  etoir3ny4lmtelieias)sDua(r ;o0openmi3iatla em(vsn(0 etnmo totlmtr neil()t2xm(r nudopeemfvs t s2uax o;o0tleoioetltlsDeluvo u4trtnif oatopDe nes s) 2trxmpio4lmtelncilsfarta( ono0opx iociasfmDua( o u0trtoxfcia1la  aivs;t texmxr3oodlm e fvsatf 2rrur no1tleoioeiatlm uauvs u0 rtrirctytfa  anei ( s2umxopnu1openmfeilt)srra(r nu4olxomf3ild mDea(ms (4 rxoio iydoa  ai olt)tetoio3iu4op  mfviat) rrru ooo1aeto f3ildlaDrmuvs;(4aetniociytla   u o;t s2xoir3iu4aptnlics (fsrum(  nu0apto oeiad sDeanvo;(0artnxfcoy1om r n s;t)t2um(r3ny1opt mfesls)aDrrxroou1tltoiietydlmDuau p;t0 leoifciy1fptelnvs;() eumxr3iudolee fct (farrmxr nu1tet mictytla2elumsnu0aleomrctodlpD aivi;s)srxm(opoy4lme lietlsf 2tau pno4altnmi3iytfm uln sn(0aexoxr tatlaDeanei;s0s2xrio3no1amt lici ( aDrr(ro;t4oexo ictas a2em(ms;t4tltoio iatlmt lneo t  euoxm oo4ol nliviasf 2umxmooo1apenmf3iytfmDemu p t0aeenmociatoa eauvi;( srxoxo3nu1omt  nvsasfs2trxr nt0texo ieilsla rmu p;t0 eermo3ia1om ean o t0texoxo nu1lltemfesatfa2umur oo0altoiocils a rlnmsnt4alxrmr3iotlpD au s;s  2uriopoy4omtelnetasfsrtm(rpno4ole  iciysla2rl( snt0aetoxoctytomtrluvi s t2toxrpoo1omeemicslsfs2rmump;u4ope mo3tas sDemn s u0 rxrif oa1fmD  ueols seto(opny4ale  ics () 2ururp;t4alxn octaslaDum(vs (4tlenxo3iydlmt anei (0 euoxo nu1olen ietatfs2ur( p;u4aptnif3ild s2ul(mp;t0 eeoif oydlpD anei;s  2tmxopnydaltemivs (fa2ta( poo1ale mfeildlsDea(mo t0tltrifcoa1lmD  neilt0trtm(opou1apeelicslsfa2rm(rpou1tptn o3iltfaDrlnvs (4aetnmrcto1faDrliei ()seur(o ny4amenmfcia()a2um(m ;o1tpxnmieilt sDul(vpn(4tlerxo3iytop   neols teuo(o iydlm  liesas  rrrxmp;o4tpenmoetasfaDem( o () rerircoytlmtelues ()trxmirpnu4olee fcsatfsrrr(ro;o4aleomo3tat s2umnms t) exomf io1lptr n ilt seuoirpno1lle mfcta()a2rrxronu4olto f3tasfs eanvp u4tlerif tydlmDranvo t)s2xrxo3nu1am e icsa( arrmxmp;u4altniieiad a2rl(mo t)arxoifcty1oa r u i;s)trxrio iu4alt  netasf rrr(m ;o1teenii3iasfmDul(mont0alxrmf iadlmDe u o;t s2umim3iy4lme lnvsas a2rmu  nt4aet  fcilt s2eau sn(0tetrio oo1lp elieo s  2um(opoydlp nlfvsa(  2taurooo0apxn fciad mDulumont0 eeoir todopDrau i ( srumxo3nu4lp emfei t)arrrx  nt0tptnmfeilsfmDrmu snu4aexoio totfp ranes t t2xmim3no4ole  ieiasfaDumxm ;o0apeo feiysfmDumu o u) exomocoy1lat  n olt0sexoxm oudll nmnet t) Drrump;u4oeeoifctydlaDul( o (4tlenio io1oa e ivil( s2xo(r nudal nmnesatfarra( pno1aetnioetytlm2rl( p t0trtnmf3iytfmDelieil() 2xrxr3ny1lmen nvtls aDrmx p;u4teenmi3iysfmDrm( ont0 ltomrctytfm rai o s) 2xmxmpiy1altemnvs s)arumx poo4tptnif3iat mDrlnvs;t4artomr oytoa rlieolt0texrxmpiu4opt mnetas) Draxmp;u4oex ioctlslaDulump t4trenmr tydlp r ivs;(0trtmxr iy4om nmnvta(faDurumont4aleoif3iyslm ulnvonu4teenmo3oatlat  nvo;() rxmir3iy4ap   fetat s2um( oou1apenmi3tyd s uau o;t)tleoir3iadlptraivil( s2urxrpoudlm nmnvtlsfs2uau pno4oeenmocildlaDraums;() rtoxrctadlmDr ueo;s) exr(o iudlpte fcta(fsDum(  ot4teeoioeiltfs rm(vo;t4trxnio tytfp r n i;s)srumim3no1lm  lneils srrr(mo;t1oex  ocils mDrmnvo t0aetoirciodfa e u i;() 2umxmpoodol   fvs () Draxr nu1ale  f3iyslaDemnmpnu4 lenmrcoo1faDrlivs;t) rumiopnu1ll nmicslt)aDrmxmo;o0aptnmo3iyt mDeln s;(4altnxfciy1oaDrln o;s teuoxopoo4ap nlicsa( srta(m ot0altoifctld m eau o;u4 etoircto1lm r i i;()sruo(r3oy1amtemivi s aDtaxm ;t1oexo ieildfaDumumont4tltnxo iy1oaD  ies s)trxrxr oy1lleeliciltf Dtmx ont1olx ifetytfs2ra(vo t) etnmf3ty1laDrli ils)trxmxr oo4aptn fvtlt)srtaxr oo4apxo o3tadfa2umnvs u0treoif ta1laDe nei t  2umxm oydlltelnvi t a2ra(  nt0oltniieiadls2em(ms;()altoif3totfatr nvils tetrimpiy4amtnmnvi tfa2rrxmpno1oet  f3ilt mDulu o t0artoir3ootlpD  nvsl() 2uo(m iy1lm emfvt t) Dur(moot4tpto ieiadfa2rln o u) exrif3todlp e n i;t t2xo(mpno4lm  lfcsa(fsrtrxrono1oetomicils m elums (0trxoiocoatlm elieo;(  rtmirpiy1lm nlict s srtrurp;o4ale  fctyt s2rmuvonu4 eenxr3ootlp  aues;s sexmirpio1lp   fvils aDtaumo;t4apto feild mDrl( o;t) leoxfcoa1la  aneils0texmio3iydome mfcilt) rtr(rp;t0optnmoeiad s ranmo u)tltomocty1omteln o t)s2tmir3ou4ll nmfcilt)s2rmxm ou4olx mi3tysls uan p;t4 reoxfctotfaD  uei (0 rtr(o iu4oltemivt t aDua(  oo4apxoio3tasfa2rlu ont4alxrifcoodfpD  u o t0 ruoxm ny1op emfvi tf 2taur ;t1tlxn fciatfa2uanmo t0arenxr ootlm  au o;()setmxopoudomtemictl(  rrmurp;o4teenmfciydla umnvs;u0 lxrxo3oytfmDrlu o t trurxm oydopt lncs s)a2um(  ;u0tpe io3tyslmDul(vo;u) rermr3oo1fmt aies s t2trio ny4alen ictlt) 2ur(moou1tpx  oetyd sDrlu on(4 lermo iotom eln i ( trxrir3iy1ll elnvi tfsrtmxro;t0tlxoio3ias m rmump t0alermo3iodlptr nvs s0 rxoio no4al n fvtat)aDrrumo;t1oleoiocildfsDumu s u0 renxr oodlaDeanvi (0trxoirpnydom elfvs (faDtm(mp;t0aet io3tadfa eluvp;(0altnio3oo1lp   nvo;(0 eurir ou1apee ivsas sDumurpno4oleoiiciadlmDemnvp t0treoifcoo1om  luvo;(  etrio3oudlptn fcsltfsDua(mono4aptnifciysfmDemums;()arenmociydfpt  n i t)t2xrxmpoo1apee neiasfa2rrx pot4oee iicild m ran s (4tltrxr3tydoptrlivil(0setmxopoudam  mnci s sDtaxrp;u1oetomo3tlsfaDuauvs;()altoif iodlat  ivo;s)s2xr(m3nu4al  liviatfaDtrxrooo4oltnmo3tlt a2ulump;(0teerir3iotop   nvi s srtoxrpoydlmt mnvsat)aDumumonu4tlxomfctytlsDelu on(4altrmo io1fm r nvols t2urxrpiy4op e fvta(faDuaur oo0opxoiictydfaDuanmo t4 etoxr3iotfmD ai il(0t2xoxr3nydlp nlnct s)s2ua(mooo4tpxoiocias sDra(vo;u)aeenio3tydop  luvs;() rxmxr3iudll  lnct ( srurxmp;t4aleo f3tyt s ea(mpnu0trtnxo oatfptrli i (  2ur(r iu1aleelfvta(farra(r ;t4tle  iciysls2ul( snt4 ltoircoy1omtrlnei s0s2uoirpoo1omte fvs t srtrurpoo0tpeomociad s2emnms t) eeomf3oa1omtr nvs s0teuo(r3ny1lpt  fvtlsfsrrm(roou1ope  f3tas s rl(vpnu) reoxo3oatlm  luei (0 rtr(o3oy4op e fvil(f Duaur ;u1tetoifetyd a2eaumsnt0 leoxocio1fp rluvs t s2umiopnu1om e fesls) rtrum ot1opt  ociasls2eln o;t0 reoxr3iytopt  ieslt s2urxr iy1omeemnctlt)a2ur( oou0opto f3tydfa elnvp (4 exnmo3iytopt lu sls  eto(opiydopte fesat)aDrmu pou4alenmiciydls emnvo u0tlxrxfctadlm eai o t0 exrxm3iu1al nmnvils aDuru  ;u1oexo oeiatfm2ul(mo t4 lxnxo ta1fa e i ilt0 exmir nu1omenlieils sDtr( oou0aexo oeildfsDeau o;t)altrif3to1om r ues t tetm(opou4opeelnvsl(  rtrum no0aex ioeiyt a2em(mo;t)texrirciodfpD  ueo (0sexmir3ny1ap  lics t sDtrumpnt4alt  ociysla ean pnt) reoifctotlpDrau s s0s2tr(m3no1oltelfetat)a2rrump;t4apx mfeiytfaDuluvp t4artnmf io1lmDelu s s)s2toim ny4lmenmicslt)a2uaurp;o4oexnifeias m emums t) rxomo3tydfa e i i t)teto(o no1ole  ivias)s2tr(  nt0alx  fciys m elumo (0trtnmo3ootlp r ueo t)t2trim3ou4alt  fcta( aDum(moot4teeoif3iadfs2ea(msnt4 lxoxfctadfa r nei s  exr(rpnydomen ieslt) Drm(r ot4opx ifeiyd s ua(vo;t0 ltomrciotfaDrlu sls  rxrimpny1lmtnlfvsl()aDtru ont0tleo ieiytlsDuauvp (4aeeoifciodlptr u ils0sexmxopou1lpen ncia( a2umumpno0oexnmoeiytlsDul(vpn(4aexoio oodop rlivo;t0t2uoxr3no1al e fes t arrm(  ;o1apt iociatfaDulu sn(0trtnxo3iytfpD auvo;(0 eto(mpiydaltelfvs tfaDtau  no4tpen ieildfm ra(mo;u4tltrxo3oydoa e uvi t0 2tmxo oy1lme  fviltfsDrru  ;o1aee mf3ias m2ran snt)tltrxo3to1fptr nvslt seuo(rpnudolt mfcs t sruru ont0oltomoetadfa2eluvo t) rxoxo3tydop r i ol()t2tr(o oo4opt mivia( aDtm(m ;u0aexnioeiyd mDea(vo u0 rtoif ootfpDrli s;( trurir3oodom e ieils  2rrur no0aex mi3ild s2rl(vont0 rtoir tatomDr neo;s)srxm(m oodamtemfesa(  2rrxront0oexn f3iadfa2eluvpnt)alxnmrcoodlp ranvs;s setr(r3nu4op   neta(f Drr(r ou0tpenmo3iltfa2ua( ont4tetnmfcoydfmt  neslt)tetr(rpou4amtemnet ()aDrmump;t1tlenmfeiysfa eaump;(4alenmr3oatlm eai sl(0 2xo(o nudomtnlicsat  2rmu onu1oltomieiltfs eau ont)altrxf totomt  nvilt  2xoxo3nydol n nvias  2rmx p;o1aet  f3tytlm rauvp;t4tetnmr ty1lmtr ivi s  eurio oo4op   ictls artmxmo;t1optoio3iyslmDum(ms;u) rxoxf3iytopD au s t teurxmpoodamt lics (fsDtaxroot4oeeomfeiad m um( p;t4aexrir io1la e u o;t)trxmxrpiydapt lnetlt  Draxr nu4oex mietat aDrm(mpn()arxrif3iy1lmtrlnvo;t  2xo(o3iu4lp  mfvsls) Dum( ooo0altnmietysfa2ean p;(4tlerxr3iodlp eanvi () exmim iudal n nvs ()a2uaum ;u4tex mf3iasls ua(vpnt) etrmo3tadfptrlu i t  2xm(r io1ll nmiciat  rtrxrpno0teeniociasfsDraumsnt0alxrmocoo1fm  anvs;s0t2uoxopno1omenlfciltfaruaur no1olxn ietys sDuanmp t0tltrio3iodfp rlies;( t2ur(o3oo4amtn fct t artmxrpno0texnmi3tltfaDra(von()trxomo3oydfat  u i;t)s2xoim nodoptemivi sfsrumurpot1tltnmf3iytfmDumnvo;u0 lxnif3oo1laDeaivo t0trtrim3iu1apte ieils s2trxr ;u4opxo ociasls rauvpn() exoxrcoy1oa   nes;t0 rtmxrpnu1omt liesasfs2rax  ;o4tlt  fetysfmDulump;t0aetnmrciodoa e n i s0srxm(m no1ll nlivs ()a2trxr ot4apen o3ildfm2eaumonu4arxoio totoaDeaivo;(0trur(rpou1oltnmfvs t  2uau o;u4tpenmfeias s2ean o;() exnxr3iytla rauvil( sexmxm iydam nlfet s  rum( pou0opt mfeiyt a2umu p t)tlenir ia1lat  u i t texr(r oodop  lfvi sfs2raxr ;o0oee mociasfm2eaump;u) eerio oytopDrlnvs s trtm(o3nudomtemics t)a2uru pot0apxn oeiytla2umnvo t)tleniociatomt  u ils) 2xrim oy1ale mict (fsDtru  ;t1teenmiciytfsDem( p t4trtomfctadlmt  u ils  euoxm nu1apt lfes ()aDta(mooo4oeeniieiad s2emu ont0artrxr3oo1oa raivsls0 2ur(m3iy4ameemncsa( a2tax ooo0olxnmoetadlm rmump t4trxnio3iodla  anei;s0 2xr(opoydalenlici s s2urur nt0tpxnmo3iatfa um( p;(4aetrxr3oo1lm rau ols)t2ur(m3oo1aptnmfvia() Drru p;u4opto fctad s2emump t)aexomociy1la eaivi;t0t2xoxo3iu1omt  iet s  rrmxro;t4tltnmf3iaslm2elump t0 leoxo ta1om  anvi;(0 rxoiopoy1op  liesltf Dra( ont0opt iietadla2ran o u)artrmo oadop  auvi ()seurxr3oydlmenmfct t  rtaxrpno1tpto o3tlsls rmnvp t0 etnmfctodoaD aneil() rxmiopiy4ome  neilt)s2trxmoot4tex  ocilsls ea(vpn(4artnir3iotla  aueo (0s2uoxr3ny4apt  nvs sfarta(rono1tlxoio3tld aDemuvon()alxriociydoaDe ueo t srtmxrpnydal n fetlsf 2tm(r nu0alxomoeilsla ua(mont0 etnmfctodlp eauei;t0s2trim3iydol nlnei ()sDrau o;u0apto ociasls ea(vo u4aetrifcta1oaDranes ()trxmim3ou4ale  fei t a2um( onu1tlxoio3tlslaDelnvs u4tlermr3oo1omtr ieo (  etmirpiu4lpt mfct sfa2umur ;u1ale  fctat aDemu o (0tltrmf3io1opDr n i;s0t2tmim3oy4ol  mnvta(  Dtmurp;u1aexomo3iat a emums () rxnxo oa1optrauvilt)seum(o iydamt mnetlt sDtrx p;u4tpt miciadlmDrmn p u4trxnmr3oo1lm   u o s)srxm(r iudam   neiasf 2tru p;o4tlto ocildfm2uanmp;()arenmo3ty1faDr uvi;(  eto(r3oy4amtnlivi sfa2tru o;o4tlxoii3tas mDrm(mp t)tlxnxo3to1oa   ivo (0 2toxo3nudolenmnctlt)s2rru onu4oeeoiociasfa2rlnmp t)trerifciodlm  luvil(0trxr(opiodll elfcil(  rurumo;u0tle mf3iys m rlnvpnu)aleoxr tydla   ieil() 2tmirpnu4altelnesl() 2tau ooo4apeo i3tyslm2rluvonu)arerif3ty1lm rlivi s)t2xoxopiydomtnmfcias s2urxr ;o0tetn f3tydfaDuanmpnt4texrxocoadla  an i s) 2xo(mpny1ol elnviltfa2um(mp;o4ope  f3ils aDrm(mp;u) rtrif3totoaD luvi;s0srtoimpiy4omte nctls s2ta(roou1tltoioctaslm2uaump (4arxoif3oo1oa e iesls0 exmirpoo1amte ieil()aDurxront0oltn ocildfa el(vo ()trerxo3iatoa rlnvs t0tetmxrpnydamtelivs ()s2rr(r nt1tetniieiasla el( o t) eeoxo3iodoatrli s s)s2toxo iydlmtn fcsls s2ta( oot4opx mo3tytfm2eanvpnt0arenmr3iy1lm r nvols teumxr oy4lle mfei tf rtax ooo1texnii3iyt sDrl(vs;()tltrxr3todfp   ieo;( t2xrio iudlltn nvt tf Dtaxmpnu0tleomoctasfa umu onu) renir oy1lmte u ilt0trxm(m3ny4al n nesatfs2rau  ;u1tee iicild mDelums;(4aleoxf3tatfp  an o;s) 2to(opnu1lmt lnetlsfartr(r no4aetn f3ild mDum(mp t0 leoirciytoaDe uvol( srxrim nu4olte ictl(  Dtmxmpou4alto o3iyd m2rluvont) eeoxr todfmt an ils  eto(r oo4lpt mnvta()s2ta(  nu1aetn f3ild s ulumo;t4trtnif3oytlp r nvi;(0seumxm3iu1opte ncsas)s2ta( ooo1tee mo3iys s2eanvs;t4tetrircootfa ran sl( teum(o oy1am nlict s s2ta( o;o0alenmoetldfm2ean o;t4 eerxr ty1fa eau il(0srxr(r ou1om n neilt arrru ont0oetoifetysfs2emn p u4aetoxr iydomD ai o;s t2xrio ny1aptn net s s2uax ono1oeenio3ilsfa2rmu o (4texrxrciadfpD an ils srtr(r no1oleemivilt)a2ua(  ou1ope  oetldls2el(vsnt)tleoir iatfmD  n s s) rtrxo3oy4al  mivsl(faDtrxr nt1opt moctasla rluvont0tetoir3oa1lpDeauvs;t) 2xm(rpoudapenmncsat a2tmx oou4ape mf3ias aDel(vsnu0 rtoxrctytfmDrlivi s0tetoxo3iu4omt  iei (f Dtr( o;o4ale ifciys mDemnmo;(4aleomocto1lp  lnvs ()seto(opoo1ope  neilt)sDumurpoo1alxomo3iatfa umnvs;t0trxoio totfm   ueil() exoxo3ou4lmte neiat sDtru pot4tee moctys m rl( o;t)trxnxocoytlp  lueols t2uo(rpno1lp elnvsasfaDtrxrp;o1apxnif3tat m2emump;t)tltrifciadlmt  ieolt0s2tm(m iu4opt mfct s  Dra(m no4oeen iciytls2rmu snt4aetrir iydlaDraivs;t0 2tmxo3iy4aleelieias)arum(mo;t4tpto i3tltlmDrmumonu)arenmo oy1fate ieo;() 2trxmpny4lpe mfes tfartrum ot1tpe moeiytlm ra(mp u) ltoxo oytlp raivil(  2xrxr3nu4lle mivilsf rumxmp;o0oeenmfeiadfa2um(vs (4arxoif3iydlpte uei;t)srxoxr nudopeelnciat aruaur nu1aleniociltfm2um( snt) rxrmf oadla r nvs;s)setrim3ny1oltemfetl(fsDrr(  ot1tpeniociyd s uaumpnt4 eenio oa1lp ran sls)s2xm(o io1ape mivia(  2um(rpnt1oexnioeiasls2ulump (4tetrxfctodoaD aueo;s tetm(mpny4lmte ncs s s2ra(rooo4altn oeiad m umn o u)tlerif3oytlm   nvsls)t2toio3oydome miesls) Dtmxmpot4oet miciatfaDuaump t0artrxfctadfaDelies;s0 exrxm3iy1lpe lnvsasfs2uaxmono4aee mf3tlslaDumnvo;t0teenmf io1op rauvil()trxoxr ny4apt mnesa( a2tm( pno1apx  fcild a eluvs;(0alxnmr iatoaDrau sls)s2toxopoy1oltn ncsa( sDurx  nt1tpeomi3tysla umnvs t4tlxomo ta1fp  ln s;()t2umxopoo1lpt  ivtl()sDum( ooo0opt mfciltfm rlnvp t4aeerxociydoa elu ols s2urxm3oo1amee ici tfsDta(m ot1alx  oetadfs2emumpnu4tlxnxoctytfpD  ivslt seumxrpiydlltnlncilsfs2tmxmooo0tptomoetytla2ua(vsn()aexomf ty1la rlu o t)srxo(o3nu1lp nmfvt t)sDtrurono4olxomi3tat s uan s (0 renio ta1lpt aieo s seuoxrpoo1am  mfct t)aDurxmoot4tpenmi3ilt s elnvs;(4 renxr todop   ivs;s0 eumxr3oy4am nlivi t  2rmxrpoo4alenifetad sDumuvs;() ltoirciotoaDe i o (  exoxopny1lpe mfvi sfsDtaxrpoo1alxoiictlslsDrluvs t0artrxr tadoat ai i t0 etrxm nu1oltemncil(f rrru pnu0olx  octydfa2ulnmp;t)arxnir3ta1fa  ln o t sexmir oudllte ivs (  2rax ono0oex  i3ilsla umu p;u)tltoif iodfaDe i i;(0teumxo3iy4ol n fvias srum(mpot4tex ifeilsls ranvp u0teenmr3iotlaDrau o t  2xm(r3oo4omenlfvta()aDtrxmo;t4olxoifciadls2ea(vsnt4artomo3oydfpDeauei t  etmirpno1ap   fcsa() Durur nt1oee ifcildla2ra( s;u4 lerio3oa1la eaneo;s0srumxo oodalenmfctas) Dta(rpou1openmiciysfa2ra(vs t0arxrxf3oytlpte u ilt setmio oodapeelieil(farrmxr nt4ole  o3ilt a2emn pnu) exrio tytlmt anvsls) 2xrio ny4lm  mivsls)a2uau oou0tltnmietatfa2rmnvp;t4 lxrmfctytop   n s (0texm(opiodomt lnctlt sDum(m oo1apx  oetat sDemu pnt4teenmf3iodlmte ivs;t0 etmiopiy1ole liciat arur( pnt4texn oeiadla rl(ms;u0areoir3oadla raivi;s s2uoxr3iy4om e fesl() Dtrur oo1opt if3tat s2rmn p;u0aeeoxf oydopDean o;t0tetrxmpiu1oleelfvia() Dtmxmo;t1olxnifeilsla emnvsnu0 etomf oy1fmD  nvo s)sexo(m3oy1lpe  fctlt aDuauro;t4tex  oeiadls ua(vs t4aeenxrctatomDr u s t) eumimpiu4am  mfcia( sDtaurpnu4apenii3iysfm2ul(ms;u0aexnio3to1lmDranvo ()trxmxr3oo4omt micsltfarur(  no0optnmfciad mDra(mo;(4texoiociadfm  ln o;()teur(o io1am elivsa() Duaumpoo4tpt  f3iydfm rluvp;()alerxrcoodom  aueilt0seuoxo3oodamte ncsasfaDurxrpoo0olxn ociytlm ul(mp;() lxrioctydomD  i o;s seumirpny4olenlnet t)sDtr(r ;t1apt mo3iad aDeau o t4 ltrio iytla r u o t)setmxr oudamte nvt sf rurxront0opeomf3iasfaDrluvp;u) lxoir iy1fpDelneo;s)t2xoxopiudol  lncsl(farumx  ;u0tpenif3tasfa rln o u0tetrir3ty1fatelnvols  rtmxr nodaptemfcs t  2urx ono1tpe mocils s elnmp;(4tlerircia1om eluei ( texm(o3ou4aleelfctls sruru ont0tptoioeildlsDul(mo;t)arxoxf3oo1opDean s;(  2to(mpoudalt mics t a2um( p;t0aetn fciytfsDrm( snt) rxrio3iotomteau o ()setoxr iy4om emieiat) rtm(  ot0tpxn ieiltlm um( s;t4texnmrctytoaD aueils  etoim3iydapeemfvslsf Draur ;u4tlxn ieiytlm um(mo u0 etrifctytoa  au slt)trtmxm ou1lle  nvsa(f 2taurp;u4oltoifeiasfmDrlnmon()tleoxf3oytlaDe ieo;t s2xrxr3no4lmeelnvi s)aDrr(  nt1altomfctlsfs2ua(vp u4altoifctotfpD  ivi t0sruoxmpoo4aptelfvias) rrm(mpnu4aexnmf3iys s eaumo (4 exnmf3oatfmt  n s (0tetoxm3ny1llte ivsls artrx o;u4olxomo3iydfs rm(mo;u0 rtoio3totfm eaneo (  rxm(mpoudam   nvias)arrmx ono0altn fetldfmDemuvo (4trtnxo3iy1fateauvs;t)srur(r3oudlm n feil(faDurxro;u0opx mo3tytlmDel(mon(0arxnxr iatlm r n s;s) ruoxo no4lmtelict s  rta(rp;o1olx  feiysfaDra( on()alxomo oadopD ai s;t)t2xm(o3iy4ameemiesltfsrrm( pou1tet io3tyd aDuanmp (0aexrmrcoa1fa eaies (  rxmxr nu1olenlfeil(fs2rrxmoou0apxoii3iasfaDrmu on()trtrioctytoptr iei;()texoim3iy1lmt mnvsl()sDur(mo;u0apx iiciys s2ea( p;u)aetnxr3iadlm e n i;( trxm(m iodapt  icsasf 2uaurono1apt mocildlaDraump t)tetoif iadfaDran o;( t2xo(opiu1lltn fctlt aDrm( ont1aex ioeiytfm2em(mp t4trtrmr iadfateai sls0 exrxmpoodomt mnctlt s2tm(ront4tptnmfciat s em( on(4 eeoxrcoy1oaDran s;t srxmxrpnodop  micsltfaruaxmoou4ape ioctad mDuaumonu0arxrxfciotfm  au s s0sexmiopoodlle  fctls)artmu  ;u0aexoiociltfm ulnvp u0tetoxfcoy1fat  nes;() 2xoxopnu4lpte nvt t) Dtmu ooo1opxn o3iatfs2uluvsnt4 eermrcia1fmDelnes t s2to(rpoo1ame  fvsa(f 2urur nt4tet mfeias s rm( sn()tltnxociytfpD aues;s0seumiopio4om n fcs (fsrtrurono0oeeomietyd m em( s ()teenmr to1fm rlieo;(0 rxo(mpnydamt mnvs (  rrru pnt0tltoio3iltla ranmsnt)tetoxo3iydomt ln i;t  eumiopoodap nlfcsat) Dtmxrp;t4olxo oeiys sDemnvp;(0teenircty1lm eauvo s0srtoio3ny1al  lfctls) rumurpot0aex io3tyd s2el(mp u) ltomf3oydoate u s;s t2toirpoydomeemicslsfsrrrx  ;o1aeeniicils a uluvo;u4trtriocoy1omt an ol()s2tmxr3oo1omt lncsa()sDurxrono1tee ioetys m ranvp;t0tltoio3ty1fmtrlnvil() rxm(mpnu4omtemneiat  2raxr ;u4tpeomi3tyd s eauvp t4altomrcio1omtrln s t0srum(mpou1omen ictat) 2tmxmo;t0tleomieildfm rmnmp;(4arermrcoo1fmD  ies s0teto(m nudolenlnesl(fsDtm(mpou1tpx mf3ilsfs2raumo;u4 renxocootlp eanvo;s0 etmir3iu4apt  nvias srrmxmont0tpxo o3iaslaDuluvo t0tltrmf tytoptrluvol()srur(mpoo4op n fet s srtmu  ;o0aetoio3ias s rlnms;t)aetnxf3to1om ean sls t2xmim3oydopenmnci ()sDum(m ot1aee mf3iyd m uan o t0 etnifcty1lpD  i s ()srtoir3nu4op e ict ( srrrurooo1oetoii3tat mDrlnvs;u0alenxr ootlaDelnvol()sexm(o iy4aptnlncsa(fs2ur(rp;u4texnmf3tytfa umnmo;(0trenxr oadomtr i ilt)texrir3ou4alenlfvilt arrm(r nt0tlenif3tls sDul(ms u4 reoirctodlmtelies;()sexmiopny1omtn ict (f 2rmxr ou0tpxnif3iyt sDum( on(4aleoif io1lm rln o (  etmxrpoodlle lnvi t  2trx onu4aexoioeiyslaDemuvp;u4tlenifciydfpt  nvs;t)sexo(o3no4ol  lfvtls)s2um( poo1oetomfeiysfm2rm( on() rxnmfcoytfptelies t) rur(o3ou4ope mfcsatf 2umxm ;o4oet mo3tlsfm2rlnmo t4tlxoxf iy1omDelnes () euo(r3io4ap n netat artrxmo;o4oltnii3tydfm2rmumsnt0tlenxf3oatlmD ln s ()t2xmxr nodap nmfeilsfsrrmx ooo0tpto fciysfsDem(vp;t) renmrctotla  aivi;(0srurxr iudam elnciatfaDuaxmoou1tlx iieiasfs emnvp u0 rxomo totop  luvo s trtmxr ou1optemictltfsrur(rpnu1oeenmfciatlm um( ont4texomrciadlpt auei;s teuo(opoo4ape  nvi s)a2ta(ront4teeoiiciytlmDrlums;t0arxrmr3oo1omtrauei;t)srxo(m3oo1ope livtlt)aDrmxmpou0teeoioctlt m em( onu) eermfcto1omteaueo;t srurxm iudalenlfeiltfaDraurpou1tee mociatfaDemuvsnt0aleomociy1omDrauvilt)s2uo(o oy4llte nvsl() rtmx oot1tex ii3tasfs2ulnmsn(4trtnmf3iotopt  i s ( seumxm3iy1amt livs ()s2raump;o4oltomiciysls uaums;u)aeerxo todlptrln ils seuo(mpio1ll e nvi t srrruroou0optomoeiysfm umn pnu)tetoxo3oy1optr n i ( s2um(rpnydlm n iciat aDur(m no0tee mietltfa ua( p () etnxf oytfpDe n o;()setr(o3oodale licsa(f rtrxronu0altoifetatfa emu s;u0altnifctodfpt lues s) exmxm ou4lm nlnvil(f 2ua(r nu1teenioeiat a em( p;u0 exrif3oy1fatrln ilt0teurxm3iy4ap n fcil()s2ua(rpot4tpen octadfmDum(vsn(0aetomr oo1laDe uvi t)t2tmxopoudom  lietls)sDur(m ;t1texoifetltfaDul(vp u4 reoxf3totfm raneslt)s2trxrpou1omeemnci t) rrau  ;u4tle mf3tydfmDul(mp;u0 eenmo3tadoatelies;s0texr(opoy1apt mnvt ( sDua(mono1tlenmoetldlaDemnmo u0trxoif3oadoatrln i s srxoir no4apenmiei t s2rr(r ;o4aptoiictyd a2ea( p;(0 etoirciotla e n o;t)trxrxm oy4omtnmnvs sfartm(ro;t0oetomf3ilsfs2ul(vs u) rtomf3ty1fmD an s;s0 rtoim iudlm e fei t)a2tmxm ot4teenmoctlt m ra(vs;t) rtrif tadopteanvilt0trto(o3iudll  lici s) rrru  ot0tpt ifciasla uanmo u0 eenxociotlm   ivo;(  etoimpiu4lpe licsas  Drr(  no1opt  fciatlm2rmums;t4 rtnir3tydoaDelies (0 2umxr3no1omeelnvtatfarrax  ;u1aex  f3ildlaDrm(ms;t) etnxfctytfaDeau il(  rxoxr3io1lm   nvtl(fartaxmont0apt moctysls eau onu0tlxrxo oadfpD livo;t0 2toio3io4ope mnvtlsfsDurumoot4teen ieiadfa emuvo;(4 exoxo io1omtelneol()seto(m3ny1omen icia( sDrmum ;u4olxnmf3iydfm2umumo u)texrxo3iodoaDrlues (0 2tmxr3nu1ole lfet ( aDra(rpno4apt  iciaslaDumuvo t)tetomo tadfm  aneols  rxoio3ou4ol emfvtat)aDtmu o;u1tpx  o3iad s2rl(vs;u) eeomf tatoa  au ilt truo(o3no1olee fei sfaDtauront4tltoif3iyt m2elu o;t0trtomocoydfmDrlues;(  eurim iy4ol e nvsl()aDraxmo;o1oeto ictydfa el( snt) lxnioctytfm r ivs;s0seurir3io4op emictat  rra(rono1tlx iieildfm2ul(vsn(0trenxo3iotla r neo;s)trur(r iudoptnmfctat aDtr(mpnu0aetoioetlt s2rln s;t0 etnxfcootopDrlnvslt  rxmxo3ny4lle lneia( srrmx ooo4tpt mfcias m2el( o;u0 leoifcio1op elivils srum(o oo1opee nes t) rtru o;t4tptnifeiydlaDumu s (4 rtrmf3iotfm  luvils0 exmxr3nudoptemfeta( sDtmur ou4apx iiciad m2rmumpn(0aexrifctatoatrau ol( t2xmimpoydal elncias arumxmoot0aexnifctatfs rmn p ()teeomrcoodlmt  nvo;s) rxriopoo1om emnet (f Drrum ;u1oexnmfeilsfaDeaump (0trtomfcta1fateai i (0 2to(o nudoptnlfctls)sDrmu  ot0alxnii3iytfs2el( pnt4aetrxo tydfatranei t0 rxrir oudlptnmictas sruru pno0teen fcild m elnmp;(4 lenir iy1laD lieol()s2toxr3iu4om elnctas  Dta(m nt4apto fciadlsDuanmp;u4 eenio3iotfpDelnvs;s)trtoxm iu4lpt  ieslt sDtaumpot4aetnifeiadlmDumn sn()aetrir3tadfp eauvs;t0 2xmir3io1ape  icsl() rrauro;u4tex iocias s ea( snu)alxniociydopteai s t0setr(o nu4lpenliet () Dtrxrpno0tlxnmo3iys sDumnvs t0arxrxociytomtr ueo ( srtrxmpio4apt mfetltfs2tru oou1apt ioctysls2um( onu)texoxr3iatfaDranvs;(0t2um(r3ny4olen neil( a2rm(mont4oexo ociytlmDuan o;()arenir todlpDrlivs;t)srumxo ny4al nlicil(f Dtrxrono0tpt  o3iad sDuanmp;t4artoxociydfpDrauvilt0s2xoir io4apenmnvils) rra( oot0alx  i3taslaDuluvp;u)aetnxr oadoat  nes s0s2tm(opoy4lp n neia(fsrurur nt4tltniietltfaDuan on()teermr3todlpD  u s ()t2toir3oo4amtnlfesas s2rmxm ou1apeoiictlsfaDrmnvont)artrmo iotoa   n s;t)s2xrir ou1ol nmictas  2ta(rono0tpxnmoeildlm2ra( p u4trtrmo3oa1faD au s s0s2xrir3no4alte fvta() rraumpot0aptoiieils s2eauvp;u0trtoxfctytfa r uvo;t)t2xo(o3ny1al e neia(  2uru  ;o1opt  oeilsfm uauvo;t0alxrir iy1opte uvols)teuoxo3iudapt mics t s2ua(mont4oeto fcias s2umnvp;t4alenmfciatlmt  u o s)trxmxopnudaltemneiatfsrta( poo0ape io3tas a emnmp (0 lxomo oo1fp rauvilt0t2ur(m3nudapte nct (f rtau oot4tpx io3tyd a2ea(vonu)altrifcootfp elneolt0 exm(m3oy1altemfcilt)aDrrumo;t1alxn ictydla elnvo u0arerxfciydfaD anvs s) etmxo3iy1ame lfvi tf Dtrx pno4aee mo3ilsla elnvp (0 ltnmrciotlateanvo;() rurxr3oudal  lfctlt srrmx pnu1tet iieilsfa2rmuvo;()artrif ia1fp eanvi;s0sexmio iodlpe lfvt s arurur nt4olxo i3ilsfa eluvp t4texrmf iodlp e nvo;(0 2xm(m iy1ole  fct t)sDrm(m oo0olt  fetydfm elu p t)arerio3ta1optr nvi;t0trto(opio4olen nct s) Dtaxmpnu4alx iictytfs uluvs u4 ltrxo to1fp elnei;s0seurxrpou4lle  ieias  rrm( oou4tptn fciyt aDrmuvonu4 rtoif iodoaD  n i;s srxmxo oudap  mfetasf rrmxmo;o0aee  fciydfs eluvo;(0 exnio iotlmDraieilt setoirpoo1alt lfeta()a2rr(rpno4texniietatfm eanmpn(4tlerirctatlpt anvs s s2xmxm3oydamte nvi tf Drrumpot1olxnif3iytfm umuvs t4artnmf iydlm e nvils sexoim oo1opt lfesl(  rum(m ou0aptn ietadla2rlu ont4tlxnxf3tadlmDe u i;t seurxr3no4lpee iei ( aDraxrpnu1altnmoetat a2rlumon()teeoxr3iy1fp eli i s)tetrim3iudlm e ivils aDtmxrpoo0aet mociysla rlu p;()trtrmf3oadfat  ueol(  rtoxm3iodopt lnei s)a2tm( ono0openmi3iytlaDrlu s;u) rermf3oo1lmte ieolt0teurxopiy4op emncs t) Dtm(mpoo1alenmoctyslm ranvont) eeomrctodlateli sl()tetrxrpio4lmtemicta( a2raxr oo0tet mociaslm2eau p t)aetn
\ No newline at end of file
@@ -0,0 +1 @@
+i ol(  etm(o ou4lp e iesltfa2trxrp;t0oee  feils a rmnvp t) exomf iy1faDr ieo;s  rtrim3iy4ome lnei (fa2tr(r no1tee  oeiysfs elumont) etomociadlp e u o;()tetm(m3nydopt mics t  rrmur ot4tlxoifciytfa rm(mo;u4tlenmrcto1lpDr ueslt  2trirpio1opeelies ()srumump;t4apt  octytfm2el(mpn()tlerxr3todlp   uei t)truoim3iu4lme mnctas) Dra( oou4altomf3tatlmDuaumpnu0 eeriociodlmD au il() exoxr3oodlm emfvi t a2ta( onu1oetoiocilt m2umuvp;(0 reomocio1fate uvi (  rumxm iydlptemfct s)aDuaxr no0tpt iociysls elu ont)tlermf oodlatrlnvi ()srxmxm3oy1lpe lfei (  rtaxmoou1altnifeiysfa2rmn p;(4 ltnxfctotoptr uvols0seuoim iy4alte nvia(fsDua(  ;o0altn iciysfmDemumo;t)aeeoifctotfpD ln s;t seto(o3iydlmt mfcilt  2ur(  ;o1tetnmi3ild m2el(vo;t4artoxf iadfmDelueol()texm(r3oudlmtelncilt  2umxr ;o1tpx moeildfm ul(vp t)areomf iotlm r i o s trum(r iy1optnlfct (fartr(m ;t0tlenmi3iadfm ean p;t)trtrxf to1la   uvs;t0 rumxrpoo1aptn icsas)sDtmu  ;t0ope iieiadlm2rlnvs;t0tltomocto1oatelies;(0trum(m3ny4llenmfvia(fa2tm(r ot1aetomfciytfs elnvo u)tlxrio oadop rlueol( seurir3iydam  mfvias a2urxr ot4teto octydla eanmo (0tlerir3iadopDr u slt0t2xoxr3nydaptnlnesls  2uau  ;u0oleoioeiyt aDrl(ms t)arenifcio1lpDe n i s  2tmxo oudale mfvt ( srtm(m no0oet  ieiaslm ea(vpn(0treoxfctydom  auvi;(0s2xoxm3iu4op nmieia( srrmump;u4opto feiat mDulu s u0trtomfciytfp rli sls) rtrxo3iu1apen ietas aruru pno1ale  iciad s2ua( s;u0tetrif3tatlpDe ueo;() etr(mpoudopeelncs s)srtmur ot1tlxoifciysfs2umums u4 etnmocoatfmtraivo (0srxm(mpoo4ol  lfvi sfsDumum nt4aeeomociydlm rmumsn(0aeeoxfcoodoatrlies;t trtmir3io1omte fcslt  2um(r no4altnmoeiad s2eanmo;u4 reoxf to1lateluvs s seto(mpou4lmtemnesa(faDrmxmpnt0oee  f3tydls eauvp;t4altrmo tatfmt lieo (0srxmir iudaltnmnvi s a2tmumpnt0tet if3tyt sDrluvp;t4tetnmocoytoatr nesl()s2xrxo3oy4omtnmics () 2ua(r nu1tlxn iciadls um(mo;(0artrxrciatlpDeluvs t sexoxr oy1amt mfcta(faDrmurpot1opeomfciad m uauvs;t)tlxrxr3ia1lmt auvs;s0tetm(m3io1amt  ietat arur(mo;o4opt mi3tldfa eaumsn(0 etnio3iytlmD aneo t  rtoio3iodopte feiasf rumx ono1optnmieiasla2rm(vp;u) etoxf3io1fatelivi t t2xr(r3oudam elnei () 2rr(r nu0oex mf3tadfsDrmnmo ()altoiocoodlptrlnvil(0trxrimpiodaptelnctl(  rrmur ;o1tleoif3iydlaDrm(mp;() lxomrcoytopteaueo s  2urxopiy1altnmici s a2tru ont0oetoif3ilsfm ea(mo t) rtrifcoytlmD  uvi ()tetoxrpiydole mivias  2uru ooo1ole ifciytfs ranms t4arxrmr oy1fatrli o () euoiopoo1llt  ivtas)sDtrum ;u4ole mfetlsfs emums;u4teenxo iatlpDelivs;s)sexrxrpou4opte ncil()s2tru ont0aptniiciat s2rmnvp;t0 lerir to1fm elnes;t)truoimpoydap elfcsl()srrrumooo0tpe  oeils m umnmo;(0 eenxo iadlptrlivs ( s2tmim no1omtemncia()sDtaum ou0apxnifctasfmDelu o;u) ltnmocia1fp rln s s s2urxm ou1alen ivils)aDrm( pot4aexn fetad s rmumo;t)texnio io1fmtranvi;t0 2umir oudoptelncs ( sDrm(r ou4tpt io3ildlmDran pn(4 etrmf iotlm r ivi;() eumxo ou1llt mfvtlt)s2taxr nu0aet  ocils s2rm( o (0arerxfcoydlaDr neo t  exmxopiu1optelici sf Dtmu onu0tpt  oetld m rm(ms;(0 exrmr oadomt an s t0seurxopny1opt mfvt s sDumxmono1oeenmfciyslm2ranmo (0 lxrmrcoa1omD anvo (0tetmxm oy1lltelfeta(fs2ua(m ot1tex ifetysfa ean p;t4aetnmo3ty1op raueilt0sexo(opny1am  mfvt t)arraxro;t1aee mfciytls ea(von(4 etrmfciodoat ln olt0 etrim3ny4apee fci t) 2taxrpnt4olto f3iad sDea(vonu) rxnxo oa1lpD lnesls)t2tr(rpoy1llt miei s) 2ur(ro;u1opxomfetltfm rlu o () etnio to1lmt anei;s)s2uoxo3iu1opt liet tf 2uaxr oo1olxoio3iadls rm(vs ()tltnxfcty1lmDranvols0 rxr(o3ny4olt mfetls)s2umum oo4tpe ioeiyd aDelu on(4aexrio3oydlaD ai sl() euo(rpoo4ale lnvsl(f rtru p;u1oeeomf3tldfs emnvsnu0tltoircoydlpDeanvi;(  exmio oodole  icia(f rtmxro;u0olx mf3tad m2ul(monu0tetnmr3iytfmDrauvslt0 euoxr iy4llee ietas)a2umxr ;u0ole  fciyd aDrm(vpnt0areomo3to1lateaneilt0texrxmpno4lm   fvilsfs2trum ;u4apen fcilsfa2ulnmont4alxrxrcio1la raivi t s2umir3nudllt  iesas aDua(rpnu0texn oetyt s ran o;()tlenmf tydfpDr i i s0 rtoxo3nu4ap nlncia(fa2ra(rpot1opt iietyslsDrln o (0teeoir oy1fptrlu sls0t2xmimpiu4lmtn ietas arurx oou0teenmi3tytls emump;(4alxrifcto1fatelieol()s2urxmpiu1lp elnvi (  Dtruro;t4alt mocils m2rl(msnu0 etrif iodlaDraiei t srumiopiy1omtemfetasf rtr( pnt4tetnifeiltlsDrmnmp (4 etrxo oytom ranvs;()srtm(o iy1alenlict s  Duaumpnt0alxn iciasfm emnmp;t0aeermr ta1om eli s (0 exrxrpoy1aptemfeil()a2raur oo1tltomf3iyd aDumumo;u) rxrxo3oytlmDran sls srtmir io1lme lfct ()a2urx ono0aetnmi3ils a raums;u)arxnif oatlat ai o t0 rtrxm io1oleelnvs s  2rrurpnt4oexnmfctadls eau s;t)aeeomr iodlmD livol()seumiopiydome mictls)sDrmxr nt0olx mo3iltlmDumnmsnt0trerio3iydopt  uvils0trtoxopoydllen nvias) rumxrpot4apeomietyd mDran s (0aetrxr to1oaD  ueo;t)s2ur(r ny1alenmiviltfsDtrurp;u0tpto iciadla2uln snt)tltomociodoa e u sls) 2xrimpny4lm  lncilt a2ra(mp;o0aetn oetys mDum( pnu) rtniocty1faDelivs;() ruoim iydomt mies (f rtrumpou4ope io3ildlm2elnvp (0alenmf3tydlp raiei t  rtmxr3nodape lfviltfs2tau o;u4tlx io3iltlm rau o;u) lenxf oodlmDeli o;( truoxr3oydlmtn fvslsfa2um( oou0oex iiciyt m rl( pnu0alxoircto1lp  lueols s2xr(r3oo1al nmivilt sDur(mpot4tpe mf3iydfmDumumsnu0aeeomo3oadom ean s;t0setmxmpny4lpt mnetls)a2ur(  ;u1alen f3iyt a ea(ms (0arxoxo3tadfa r u i;s)srtrio oo1oltn fvs sfaDtrurpno0tlto i3ild sDrmn o () lxrir3iotfptr uvi ( seurxr ou4ole mnvtl( arrrx ono1olxnmfcilslmDrmuvo t4altrio3todomteaivs;t  2toio iu1lptn nvils)a2ururoot4apxnifeildlm2ulu onu4tlxomr3tatopt luvs;( t2toio no4apenmict (  Dtaxmo;o4optnmfeildfs emn o t0areoifcoy1lm r nvols0srxoirpiy4ll  mfeta()a2rmu pou0tptnmo3iytfs2ran s ()tetnxf3iodoa e ivol( trxmim oodapenlfcil()srumumpno0olxo octlslm2ua(ms;(4alxoio io1la ranes;(0s2xmir3nudlp  lfvs s)srtmumpoo0apt mf3iasfmDemuvpnu4trtrmociotom ranesls0trxoxo3iy4am  mnet (faDtmuroot4tet  o3ilt s elnvs;t) etnxr iy1la  livs;t  2to(r3iy1amt lfvt t)sDrru  ;o1apx  ociyt mDrl( ont)altoif3oytfmt  iei ()teuoirpny1am   fcil(  Dtrurp;o0alenioeiatfa ul(mo u0trxoirctotopteln ils)truoio3nydomee ivslt)s2um(roou4tetn i3tltfm2umn p;u0aexnmrctadoatelneils teto(mpny4alee fvt ()aDumxmp;u1aeen ocild sDrm(msn(0aeermfctatlatrlivs;s0 rtrxr iu4lp emietl()aDtrurpno1oex ifciytfa2el( s t)altnmr oo1lp eai ol() 2xmiopnu4lmtnmnvslt) 2rrxm ;o0tex ioeiydfs ulu s;u0trxnio iatfmDeauvo t0 exoiopoodll nlfct tfsDtaurpou4opeoifeilt s2eanmo u) rxnir oadlmD  nei (  rxrxm iy1om   fvs s a2ta(mono0texomictld m rauvo;t4teenxfcia1fm elnes s srtrimpoo1llt  fvils)artm(  nu4oleomietasfs2rmuvpn(4 lerxr iy1fpteaueo t0trumxo3oo1om nlfvs (faDtr(r ;o4aleo iciysfs2raump (0tleoio oytfpt ln s;t0t2xm(r nodape lnvs s) Drmxm nu0oleomfciytfmDelnvsnt) rxoxrcoatfa e ivs t0 etr(o nydaltelnes s aDtr(mp;u0oeeomfeias mDraump t4arxrxr oatlptrauesls0s2trxo3iudlmtemfes s  2rrxr nt0aeeomieiat a eluvp;t0 exrxrctatfmDeaiei;()srumirpiu1ope mnvslt sDurum ot1olxo fciys a rln pn(0altoir3iatlpDeaiei s)sexrio iu4al elici s)srrax pnt4open ocils m2umn o;u4 etrmrcoodlpDeanvslt) rtoxr oudaltn iet (  rua(rono1olt  f3iyd s rmn on()tlenmo3oa1oaDeaivsls setmxrpou4ol nmfesltf Dra(rpot0olt mf3iyd s raumpnt4 rtnxfcoa1opDe ies;(0 2xmxopno1apeemfei t s2rmxmoot0openmf3iatlaDumums u0alxoxfctotfmD  i olt0 etr(r io4opt lnvt (f rra(m no4opeo ictadlm umnmo;t) leomo3iadlpD  u i;t t2umxr oydoltnmivtls)a2rax  ;o4oet  fciyd a2umnvs u0 exomo3ty1oaDrlnes () rxm(mpiodopee ics ()srrm(root1oeto f3iasfa eau snu)alxnmf3oo1opDrlu s;t0srxrxrpnydamt  fesatfsrtmump;o1olenii3ils sDea(vs t)aetnmo iotopDe ivilt  exrir nu4lpe mfcs s arua(mpno4optnifciytfsDemn p;t0 lxrxr oatlptelieo;t trxmio iodlltelnvi s aDtaumpnu4tlt  o3iatla ulnvp;()alerir ta1faD  n i;(0sruoio3no4oltnmncs s aDrrxr oo4opt mi3iys s ulnvsn()teenxrcoo1omtrauvo t0s2toir3iydole  iesat) rtrx oot1apxomi3tlsfm2ulu s (4 lxnxf3totla  aivo;s  rur(r ny1amtn ncia(fartr(r oo1altniociatfs2rl(mont) lxriociotoatelueils  exrxr3iy4lpen ietlt) Drm(moot1apxo o3ildla rmn p;()texrxociy1oa   nvsls) rtr(m ny4amt licslt)sDum(rpot1ope mietyslm el(ms;u0aeerxo oytlmtrlueo s0 ruoir3nu4amee fetlt)aDumx  ot0ape if3iat m2emn ont)aeenircoy1lmDr ivilt0 rto(opnu1amen fei (  rtm(mpoo0aleoifctlsfmDeaums u4teermf3oo1lp   i i;t0 rtoio ny4oltemfesls  rta(r oo1apxnmoetatfs rl(mo;()teeoxr tydlat  ies t)setoxopoodlm  mneilsfsDraxrpoo0tpen oeiytls2rlnvs;(0arxnmfcty1omD aieslt  etmxm iy4ameelnvsa(fsDtau  nu0aexomoctld aDran sn(0trxoxrcta1fpt li ol()s2umiopno1ap  lfct ( s2uau oou1olxniieiysls2rauvonu4tlxnxfciy1fmD lneo s seto(opnudaltelieta( s2umu  ;t0teenmo3iasfs rm(vo t4aeenifciydfmtrlivo;s) etrxo iu1oltn fesa(fa2tm(r ;t4tee if3iyt a2eaumo ()tltnir oadfp e n ols)t2xr(m oudalt lfetlt)s2tax pnu4tpeoiicild s emu p t) eeomo3ia1fp   nvol(0 etrxr iydolt  nctas)sDuauront1apenmfctydfs uluvs;u)trxrio iy1omtrau s;t) 2ur(rpiu1lm elnvilsfartm(  ;t0oetnii3tydfmDrluvont0 lxnxo tydlmtrlivol( t2xmio no4ap   fctasfs2tmx ont1opto ieild a rmumon(0aeeoir ia1fm  auvo t  2xoxm nudlpt livia(  Dumx pou0tpe ioetltls ra(mo u)artrxfctadomt  nei t seuo(r oydamte nctasfa2tmur ;u1olenioeiytlm umnvs t0aleoio iydfmt  ueslt0t2xrio io4al e nvils  rrm(r ;t1aeeo o3tat mDemuvon(4aexriocio1fptraiei t0trtoiopiudomenmnetas)aDtrxm ;o4aetoifeild aDul( snu4arxrif tydoa e ueol(0srurxm ou4ole mnvtas)s2trx  nt1tetomictyt s ul( o u0teeoioctotfpteliei t0 euoxr nodoleelnetlt  2rm(  ot4opxnifctytlaDeln p;(4 renxrcoy1faD anvolt0 2xriopno1lpenmnetlsfsDrmxrpnt1aexo fcilsfaDeluvs () rxnmrcia1lpDelu ol(0srxmxo3io4olt micsat) ruau ono0oeenmoctatfmDulnmp u) etnio oydoa e neo;(  eurxm3no4om  miei sf rtau pnu0apeomictad aDea( pnu)tetriocoadlat  nvs;s  2tmxo3oo4lltemfvsasfsrua(r ou4aexn f3iatfm ua(vpn(0tltomo totoa  ln o;( s2trxr3no4omtemieilt srua(mp;t4tpxn i3tat mDra(vp;u0aeerio oodlaDe neils)s2uoxrpnu4altn fesat aruaur ;t0alxomf3iysfa2rmuvon(4arenir tatfmDrlnvs;(0setoio3oudam   icsatfaDta( pnt4tpxnmfctys mDrm( o;(0 etrmo3tatlp r i i;t) ruo(o oudapeelnvtlt)sDrmumpoo1opxomfciytfm ea(mo (4 etnmo to1oaD  n s;(  rtr(m3iodlmenmnvsas arur(root0olenmoetasls em(vont0arxomf iatoa rlivo s teuo(opny4opt lfvt sf 2tmur ;t0aexomocias a2rlnmonu4tleomo3tadfpD lu s;( t2tr(r3no4lmt  feiatf Dua(r ;u4texomf3ilsls um(mp;u0tleoxrctotfa rluei;t  euo(o3iy1ol e ivslt)aDrmur oo0alt ifctas m2rmnmpnu) ltrxf3ootlpDr n ols) exr(o iudam  lfvtlsfs2trx  no1aexnmo3tasla ean pnt0 rxrxr io1oatr u o;s0s2xoxmpnu4ol emneilt) Drmxr nu0oet  fctltfmDemn p;() lxnmrcoo1lpteaieil()teuoxo3ou1am  licsl( sruauro;u1tex  feias aDuau o;u4 ltoir3tytlaD lu o () rur(r oudlme  ieils)sDuau pot1tlxnmi3tls m uaums;u)alenmfciodla r u s;s s2xmiopno1om nlict (farrax ont0olxoioeilsla2rln p u0tleomfciadfmteaivs;t) 2toir3oo4lm elfctat arurxrpno1aetoif3iltfsDel(vo t4altrifcoo1fpDr u s s0srxm(opiodlptnlietlt  Dtmx pnt4tet io3ild a2em(ms t)trxnxr oa1fp ran s s0s2tr(rpno1aptn nvtatfsrumumpnu0altn ociyt s eanvp;(0aeenxo3oy1lm rlnvo s t2tmio3no4apen ics s  rumxmo;u1ole iocilslmDrmuvs;t4trenxr3oy1fmD  ueo;s) rumirpoy1lptnlicsl(fsDta(m nu4tex moetad s um(mo t)altrmr3ootlm ranvil(0 2xoim iu4lmenlics sfaDtax o;u1tetoiiciasfs2uan o;t0 lerxrcoydom e u i s)tetoio3ou1lp  mivsa(f Dua(rp;u4ope  o3ilsls2uau s;()alxnmf iotop r ivslt srur(mpiy1lmt lncs t)sDum( ono4optnmo3iatla uauvon(0treomfctatfa elu s;(0 exmxo io4apt mivilsfsrtaxrpou4aexnmfctytfa2emnmo u0arerif iy1oaDeauvo s0 etriopiu4lp  lncsas  2rmur nt0alx ioeiatfaDelu p t0trerifctodlpDeau i;t0 2xriopiu4lm e ncsl() rtmu  ou0aeenioeildlm rmn s;u0artnxo ta1oaD  ueilt)truoiopoudale mivil()srtaxro;o4opeoifetls m2um( o;(4aexnmr3oydom ranvo;( s2xr(opoo1ap n ietas sDta(rpnt0tpxo ociltfm2ranmsnu4tleoxociydlat lieo;s)tetoxm oy4ap  lictat artrxrooo1opt mieild a rmnvpn(0 rtoxr3oydfpDrlneils)trtoio3nu1lle mivil( arumxm ou0oetomoctldlsDrm(vsnu4 eenmr3ootoa rln i ()teuo(o iy4lp nmicils sDuau ooo1tle  ietydfmDelnvonu)teerxfciytomte n ils0srtriopiodlpeemfcsl( sruaxm ;o1tpeo o3iatfmDul( s;(0aetnir3iytfatrai il()t2xmxo oy1op  mfeslt s2rrumpou4tee iiciysfa ul(mo;(0aeerxo3oa1lp eli s t  ruoir ou4lle mneilsfs2tm(mo;t1opt  fetatfmDum(ms;t4arxoxocoydfp e n sl(0 euoxr3iy4ap n fctat)srrmx ont1aet ifciltlsDem(vo t)aeerir oytopDe ues s0 2to(rpoo4lle mivsasf Duaumpnt0aexniocildlm2ulnmonu0tetomf ootomtr ueils) exo(opoudal nmnetlt  Duau  nt0aexomoeiysfa2ua( snt0 eenmo tydfpDrln o s t2umxrpoy4omenmnvsa( s2uaxmpno4apto f3iasfm2umump t4 renxr oo1oaDrluvsls0srxo(m3nudope lfeta()s2rm( pnu0apxn o3ildfm elu o;u4artrxoctotfmD lnvil() 2xm(o iu4altnmicils  Dra(m nu0tltn fcildfa2umn p;u4 rxnmf3tydlptelues;(  eurxrpoudopt mfciat sDurx oot1tlxo f3iasfs2eaumpnt4teermfciydopteanes;()sruo(opny1lp emivs sf rrrx  nt1tleo octydls ea( o (0tlxoxrctotfp   uvo;t0trxoxr3nudamtnlnvil( arrmu  ;t1aeto oeilsfa2emnmpn()alxnio tadopDe uvol() 2xrxrpou4ll elfvs (farumx p;t4aex mi3iytfm ra( s;t)aeeoxo3iatlmDr uvi;(  etrio io4apt  nei s)s2rrxrp;o0apt iieiadfm2rl(vp;u0altnmrcoodomDelueo s s2uoxopoy4apeelicslsfsDraurp;t1oetomictytlm ua( o u4 renxr tatomte i o;t trtrir3ou1llte icsa() 2trx ono4oexnif3tls sDuanmo u4tetoxr oytfmtelivi t0srtr(opnu1altelfet (faDtr(mo;t0tltn ictyslm rmu pnt0 ltoirctotfat  uei t0srur(o oo4lme  icsat)a2rmxmpnu4altniiciyt a2rl(vp u) etoxo3to1omDeaiei;(0 rur(m3io4lp eliet (f rrm(mpoo0tleoii3iysfaDumnmp u)aleoxocoadfpDr nvs s0sruoiopoy4alenmietat sDtaum oo1tpx ioeildfs uanvs t) eerxf3ta1opteluvo;(  2xoxr3oydamen fvtatf 2urx poo1opt ii3iysls uanvp u) ltnxrciodoa  aies;()trtr(mpio1lle  fcslt s2tmu  ;o0tlxoif3tldfs2umn p;t4trerxf3tytfa eauvs s0t2umir nodop   icsas a2tm(  ;t4aee if3tytls2um(vsnu0 rermf iytfpD aivo ()srxrxm3iu1lp  lfet s)a2rrx  nt1aptn octatfm2rm(ms (4 etnir io1oa ean s t setrim3iydlmt lnesa() rra(mono1oeeniietadlsDeaump t4tetrmo iytfat  n ilt)s2urir3iy1lltelnesltfs2tr(root0aptomiciysfm uanmpnt4aeeoxocoo1opDrlnvslt s2xoiopnodlpenmicsls) Dtmum nt1olt iieiydlsDrln p u4alxrxr ty1lmt lnvo;s0teurxrpou4lpe mnci ()aDra(  no1oexn icildfm2ea( s;u0 etnmfciydomte nvo;(  exmxopio4olte nvsa( arur(r nu4aee ifctls a rmuvs;()trtrio totlatraueols t2xo(o iudaltn icsasfaDuau o;t4alen fciadfm2uan pnt0tleoxr3io1omDr uvslt) 2toxr3iu1omt lfvslsf rtmum ;u0oee  fctydlm um( p t4alerxf3oydfmDeauvs () etmir3no1om nmnctas) 2uau p;t0tetn oeiadfmDrl(ms;(4artnxo3oa1oa rlnvs;t)s2uoxmpnu4lm elivtasf rurxro;u1oee ii3iyd sDuanvon(0trxnxf3iotfm r n i t  exoir3iu4ll n nvsat)s2rrx poo1tlen iciadlm um(ms u)altoiocoatfpDeauvils) 2toxo3oo4open fctat)arrr(ro;o1altniiciadls umn o;t4 reoif tatfat lnei ()t2trxo3iodom nlfeilt) 2tax poo1alt  fcils s2emnvo t4areomo3io1fpDean i s0setrimpnudomeelncs tfs2taxront0tpt ifeilslsDem( sn()artrxr oodopt lnesls  2xrir3io1omenmfci s)aDra( pnt4aet miciasla eau s () rxoiocoo1oa eli i (0setr(m oydlp nlnetlt sDrau ont1apen ictlslm2eanmo (4 rxnxfctotla e ues s0sexo(m3nydam  lfvta()s2ta(roou0tlxn i3tydfa2uanms t4texnxo3iydlp eauvs;()s2xrxmpny4apt  ivslt s2trx p;o4tlto fetys m2rlnmsnt4 ltoir ty1lat  n ols0teur(opoudlpt lnvs (  Dra(mpou0tpx  i3tat s rauvonu0texnmo todopDeliesl( t2um(r iy4al  mfcs t)sDumxr ;o1tltnio3tasla2umn s;(4areoif oo1faD  ueils  2uoxo3ny4altnlfet ( srrm(mooo0oex ii3tltfaDua(mpn()tltnmf iy1faDe n o;(0 2umir3iy4altn ieiltf 2umx oou1tptnio3tlsla2rmnmpnu4alerir ta1lpD  uvslt srumxmpio1lp nmfes tfsDuax ono1aet mfeildfm2el(vo;u0arerxocoy1fpt livsl( t2xrio3oydlpe mnci ( aDrrump;u1apeniictadlmDranvp u4 eenmoctotopteluvols0s2xm(m3iudopeelivilt aDrrx ont1oltnmoeiytlm ua(mo;u4arxnif iatlat  ieol( setmxo3ny1lle  fcsa(fs2ra(mooo4opeo f3ilt a2elu p u)arxrir3oo1lmt auvolt0texmxm no4ol nmncias s2tmxrp;t1olxomociytlmDrm(mont4aetnxrcoadfaDrlueilt0t2urio io4ap nlfcsatfaDtrurpoo0aee  feias s em(ms t4 lerxocoo1oa rlivo;s texmir iy4oleelfcsa(fartrxmooo0aleoifcilsfs2raump (0aeenir iotfpD  uvo (0 rxmiopno4alt lnctat) 2rmx ono0aexomf3iltla rmnmo;t4alxnxoctotopt  uesl(  etm(r3ou1optn nvs (fa2ra(  ;t1opxo ociadlmDuluvp t0aeenmocoadoaDeauvi;( trxrir iu4alen icia()aDra(rpou0tpto f3tat sDuanmonu0 lermf todlaDeau o;( tetrxrpiu1omtnlivs (faDtr(  oo1aeenmo3ias a2em(vpnu0 leoio totlpD  ivi (0texoimpnudole  nvtl(fsDtr(m ot0aet  ieiysfs umnvs;t)tlxrmo oodoa eluvols0 euoir3no1amtnmfvtl()aDtmxm ;o4teenmietytfaDrmnmsnu0tltnmf iadlat aueo;(0sruoxr3no1apte feils)sDur(roou4tleomictldfm2rl( snt0aeerxrcta1opt anesl()t2xm(o3iu4ap nmiesls) 2urump;u4tlxn iciasfa2rm(vpnu4aleomf3ia1oaDelivs (0t2ur(opoo4ole lfet ()arrru  oo4oex miciadfs2um(mont)alerio ty1fp   ueols  2tm(opoodopte nvsatf Durxm ot1apxnioetldls emuvp t4areomo3oo1fp  ai olt teumiopnodam  mfvsa() 2um(r ;o1oexomociat aDel( s u4 lenxo3totfpD lies;s0 2urxo iudlmtelfetl()a2um(mpnt1aeen f3tatfm2ul(mon()artnxfciy1oatraies t0texmir oo4lmeemnei (f 2ur( o;o0tpxomoetysfa2uanmsnt0tleomfcia1la ean ol( s2tmio nu4op  lfeias srua(moou1oex io3iytlm rmumsnu)arenmoctytfpD  nes s srum(o3oudalt  nvils s2umump;t4apeomfeiyd s rlums t0 eeomfcootlaD lueo;( tetoimpoy1ll e nvtat) rrax o;u0optn ociytfm2ea(vp;() eeoif3io1lpD  ivols)seurxopoodlmtnlfcia( srtm(m no0tle  icils sDrl(mpn(0tltomf3tadlp r neslt teuoxm iy1openlictat)srrmx  nu4oexn fetlt s emuvon()texoif oadfpteau s;(0 eto(opnu1lp   ieslsfs2tmu  nu0teenmf3iytfmDemn p u4aeeoir3ia1laDr ieo ( t2tr(opny4omeelneil(fsrta(m ;o1oetoioeiltla emn o;(4aeenircootfate n ols)srtrxm iu4altemnctat)arrr( poo4alto fciydls2eaums;u)aexrmfcoatopD auvi;t) euoim iy4lm nmfcs s  rumxro;u4aee mf3iadfs2uanmp;u0 rtomf3oatom eaneslt0texoir3iydap e nvt s)artrurono0tlx  fciydfsDemums;(0 lxrxo iotoaDrauvo s)srxrirpiodlltnmies tfsDtm(mp;t1tee ioeiysfm2eanvsnu4 eeoxrcoa1om r ivi;s t2toxo iodoptn ivi t)s2urumpoo4apxomiciadfm uaump t4aetrxrcoa1lpDeluesls) rur(m3iy1optnlncilt)a2truronu4oltn i3iysla2umn o t0 ltoxr io1oatelneilt0srum(r iy1ole lnvils)artmu  nu4opx ii3tld a2ulnvo (4 rxnmo oy1lateai ols0 rxmxo ou1apt  fet (f rumumpno4olxnio3iad m rmn s;(4tetoxfctatlmtrlueo (0 exoimpnu1al emnetl()sDuax pnu4optoiiciys a2eauvonu)tetrxocoa1fat liei;s) 2to(rpoodomenmfviatf 2uax oou4altn iciatlm um(vo;u)trtrif3oatfaDean ols t2xm(r nudlle  fcsas sruauroot0oexoiiciytlsDemnmpnu4tlermr tatopte i s t  rxrirpnu4om  livsls)s2raxrono4oleo icildfm2elnms t0tltoio3tadfpD au olt0trxoxm io4ape  ivt tf rrr(m ot1olxo ietadfa rm( s;t)alenif3iodfaD  nvs ( s2ur(r ou4op n neslt) Drm( pot4tpe ioctltfsDel( snu) lenxf3oodomtraiei;s0s2umxr3nu4omtn nvi t aDrrurpnt0alxnmf3ilslaDul(mo t4aleomocoa1lptraneolt0 rur(mpio1olen ivsa( aDtmumono4opxomfetldls2ulumo (4trtnif todomDr uvi;t seumxrpno4lpt  feia()a2rmu  ot4oet ii3ildfs2rlu o (0aeerif3iatlm eln o ( tetr(r nodalee icsa(fsrraurpou1apxnioetatfs2rmn o;(0 leomf iatlp r n s;() exo(o3oodll emnvsasf Drrurpoo0apeomociatfm2em(mpnu4arerxr3oo1laDeauvsls  2xrxo ny4llt  fct s)a2raxmont1altomi3tat mDua(mpnt0 rermfctadfm r uei () rtrir3nudamtnmiviltf rrax poo4tlx ioeiad m elu pnu4tetoxo3ta1fa  lnvolt0 2uoxr oy1lptemfcia() Dur(rooo0tpenmicildfm2elnvp;t4tlenxr3oatlp rauvi s srtmir oudapt lnvsas a2trur ou0aeto ociyd a em(vpnu0tlxnxociatlaDr ivo s0 rurxm3io1openmfci (f Dtm(  ou4texomf3iatls2uluvsn(0tlenxr3ia1omD aiei;(0 exrxr oy4lp  lnet tfsrtmur ou0opeo iciad a2ul( o () lenxr3io1lmDe i o t)setrxr oodam nlnei t a2ua(r ot0alxoii3tld mDum( p u0aexoio3oytfmteln o (0trtmxr io1lpt mivt sfa2tm(moot0tlt iiciaslm eanvp;u4aleomocoodoaDelu olt trtrxo3oydlpenmneta(  rurx ooo0openifciltls2uln s (4aexoxfcoo1fatranesl(  eum(o3iodapt lieta(f Dta(rp;u4tpeomfctydfs2ul( p t)tlxnmrcty1lpDe uvslt setoimpnu4lmtelfetat  Dtrxmo;u4alt ifciys sDem(mo (0texrxr3oa1lm eluvs;s)trtr(r nodom nmiet sfaDtrur ou4teeomi3iyt s2ul( snt4 rtoxr oytomDelnvsls)texoxm ny4olt  iesl(fs2tmx  ;t0olxomoeiyd m rm( s u0alxoxo3totop  luvs;s  ruoxo3iu4ape lics (farrru ooo1olenifetys a elnms t0artnircty1lm rlivils srxoxr io1ope  nciltf 2rrxmono4oltnmi3iysfs2rlnmp t0trtnirctotla elieils0 rtrim ny1lpenmivtls srtru pot0tetoifcild m uln snu)trxnmf iy1lm  aivils tetrxr ny4olee fvslsfarta(rpnt0altniiciyd mDemnms;t0 lerxocoy1lmte i s s0 rtr(m iy1olte nvil( s2rr(r ;o4oee iocilsfs uaump (0aetoxf oo1faD an s t0trtr(r3nu4lmt mncta( aDur(m oo4oetniocils s rl(msnu4 etoio3tatfat auvs;s)texm(mpou1ape mnviltf Dtrx pnt0oltnif3iytlm umu s u)tltrirciotopt aivsls)truoxrpnudaptnmfcil(  2tax ooo0opt io3ilt sDrmnvs;u) rtnmf tydla   n i s0texrxrpiudapeemfct t) rtr(m ou1tleo octad aDrm( onu0trenxo oy1lmtrln s t0t2tr(m3io1apen iciat) 2rr(r no0alenmoctydlsDrmnvp;u0alerir3iytopte uvol(0s2xoim3no4optn fvias)a2tmur no0texomieiysla2um(vo;(0arenmfciytlp e i i t)t2urir3oy4amt mnesltf Drru pno1oleoioetydfs ea(mpn() eermo tatlp r u o;s s2tm(o iy4lpe mnet (  rtrxrpot0apt mociyt a rl( ont4 rtrxf3iydfat  u i;(0srumxopnodom  mnesl( sDrmurpou1aeen feiytfmDuaums;(0altoif oatlat anvslt t2xoxopny4amee neslt)sruaur nt1tpxn f3iltfs2ul(ms;t0aeenxfcoodoptelneols  exm(rpiodll nlnesat)a2urx o;u4teen feiat mDrlums t) lxnxo3oadomtelu i (  etrir oudal n feils aDtax pot0alxniociadfsDem( pnu0texrmrcoo1lmDranvsl()teurirpoo1oltnlici (f ruaum ;u4oee  o3ilslmDelu o t) lxoifcto1oa r n sl(0setm(mpiu4op   nei sfa2tau  ot1oee iictyt a2rlump u0 exnxo3ootlpDrauvi;s s2tr(opou4ame mneias) Durxr ou4aee ioetlsla2ua(vo;u0tlenmo3iotlp  ai i ()texr(m3nu1lm  mfvtl()s2tr(mpnu1alt  octytlm2rmnms;t0trtoxf ootop elies t  2uoxmpnu1lptelieslt) Dtm(rooo1openio3iat m eln s;t) eeoxo oatlp eaiei;t  2umxr3ny4omee ncs t sDtrxroou0open fctadfs rlump u) rxrxfcoydfpDeanvilt teumirpoo1openlneiat sDurx pnt4tptnioeiadfa2ua(msn(4teeomr3ootlmt  i s;s  exoimpny4amtnlnvsls)aDrrur ;u4oetoiieiydlaDeluvo;u4 lxrxo3iadlmDr ivil(0tetoxm3ny1alen fvt ()sDum( oou0texoio3iadfsDuaump (4aetrir3totfatr ivs s) exmirpno4omtemfvtasfsDtm(mo;t4ope mociadfa2ea(vs;(4artrxrctadlm elu i (0t2xrio3oydamtnmncia() 2tmumonu1tpeo fetytlmDra( snt)arxnxr ty1op eaieo;s srurxmpoy4ap  mfvt s sDtrurpoo0alxoif3ilsfm el( o;t)teeoxf tytopt  i o;(0 ruo(m oydamenmicsa( srumum nu4aeto iciyt mDeluvp;u0tltoxf oytfm eaies (0 2xmio3nudop nmnct s a2raumpoo0tpxnmoeilsfmDumnmonu0 etrmo3io1laDraivo;s0t2uoxr3oo1lmen ivi ()srtr(m ;o0oetn fciatfm2umn p;() lermo3oydomte n sl(0teur(opny1lle mfcsa()s2ra( ont1oleomietldlsDrauvs t)arxrxocootfmtranvo;s0s2to(r oodopen nesl()s2umxm ;t4alx ifeilt mDrmn onu0tltrxociy1lm   i o ( tetm(o3iu4opeelieta()s2tm(mp;t0tlxoif3iysfs elu o;(4tetoif3iotfm ean ols0trxr(r oydlpenmfvs (  rrrxrpoo4tpenioetldlmDumnvs;u0arermrctotlpteln sl(0 exr(r io4lm e ici sfarururpot4tee ifciydfm rau s;u)texrio to1lptrau s;t0t2toxo3iodal nlfvilt)a2um(r nu1apeoiietldlaDrmu pnt0trtrxfcoatomDeln i (0srto(m nudlm elici t)srtru p;o1olto oeiasfaDelump ()teeoxf tadfpD li o (  etoio3io4amt lnvs t) rururoou0alxo iciat aDrlnmsnu0 ltnir3to1om r n s s)srxrxrpoodop  mneil() rra(rpot0tet mo3iys m elnvpnt4artrif3to1opD  i sls trurxm3oy1lm e fciat) 2urump;t1tetn ietydlsDul(vs t)altrxo3ta1latraivils  exr(rpoydome lfci tfsrrmum nu4aexo f3iaslaDumnvp;(0aexnxf tytfmt auvi;s0s2xr(m io1olte fetat) 2taum nu4oexn ieild aDemums (4tetomo3oo1la  lnvi;t  2xrxo oydal e nes sfaDtrur ot0oeeo o3tld s2emnmo t)alxnmocoa1omD aieo;t t2trirpoydllte nvsltfsrtaxm nu4optn fetldfsDem( s;(4 eenmo3tatom   ivs;s)t2tmxo3ny1op  mictlt sDumx  ;o0optoio3iadla um( p;(4trenxf3tadom eli i t0 euo(o oy4lmt mnctat)sDrmum ou1apen feildlm2rlnmsn(4aexrxrcoy1omDrai s;t)t2tmxm3oo1lltnmieiatfarumxmo;t1tltn o3iytls2rlums;t4aexnmfciydom eai i t0 exr(rpny4am e icils  rrm(r nu0apeo oeils s2ranvp;t)alxrmr tatfpD  n i ()srxo(m3iu4ll n fvtls) Dumxmont1ape miciasfmDrlump;t0trtomfcootlpD aieols0 ruoxopiy1ll emicslsfartmumo;o4tet mfeiytfa2rlu on()texoirctatfp ranvols0teuoiopno4omtn ictl()s2rmxrooo1tlx io3iyslm ua( s (0tltoir oy1oaDe ieolt sexmio iydape  neil(fs2rmu ont1alt ioctytla uanvp;t)alxoio3ty1lm  lnvo;t)srtoxo ou4llenmfctl() Dum(ront1alxoioetls s2rm( p u4 exoifciadoptrln o (0 2umxrpiy4open fci t) 2rau o;o1aexo icias m elu sn()altnir oo1fp eai i (0 rto(mpoudllt mivtlt) rtmxm nt1alenio3tltfmDumnvon(0trxrifcoadlp rln s s0srumim3oodll e iviat sDtr( p;t4alxn f3ias s rauvonu4 ltnxf3iadlpD lnvs;() etmxm iodaleelicsl()aDurx p;t1opx  feilslm2emuvsnt0 rxoir io1lat auvilt)t2xo(m oodlmtnlfvils) Duaxmpno1teenio3iytfm2uln o;u0artrmrcootlmtraieolt)s2uoimpnydll   nci t a2urxmpot1apxomoetld a2umu o t4 eerir3ty1om ran i (0t2xrxopou4ap e fcta()sDta( o;u4aetoifciad m2um( p u) rermf iadoatrlnes;s0 euo(o nudoleelies ()aruaxrp;t1tpt iocildlsDrlu s t0 rtoiocoadlp e u o s) exmxr3nu1lmt  ncs tf rrm( o;t4oltnmociyt s2umnms u)teenif3ty1laDrln o s)t2xm(r iy4om   ivtlt)aDtau ono4tlx iictydfsDum(vpn(4tltnmoctatlaD auvsls) ruoxm3io4olee neil()a2ur(  no4alxo o3ilsfmDrmumo;()arxnxo iytop rau o t0sruo(r iu1lpenlfvs ( sDrmxrp;u4tptoioeiytlm rl(vo;(4tltnmo3oatfatrluei ()sexoxo iudoleemfciltf rtrxmpnu4tltoiocilt s eluvp (4 rtomr3iydfm  lueols)t2xrio3nodal  lfes ()sDraxmpno0oetniictyt m2eln ont4trtoio totfa e nvil()trtoxr oydolenmfvslsfarraum no1aptomf3tydla emn sn(0aetnxo iy1la rau i s0t2tm(o ny1ol  miet s aDraumpou1tlx ifctatlmDea( s;t)artrio3tytopt  neo s0s2xoirpio1altemfvsa(fs2tm(  ot1oexoiieias m em(mo u) rxnxr3iodop  lies s) eur(rpnu1olt  ncsls) 2umuro;u0tpeomfcils s2em(mp;(4tleoircio1fm  auvi t0trtm(r3nu4om nmfci tfa2rmx  ot1aet micildlm2rmnvsnu)arenxf3tadfat lu s;t0s2urio3oodam   ietlt) 2raumpou4tltomi3iadfsDumnmsnt) ltomo3iotlmDeanvolt0teur(rpoudapte feiltfsDra(rp;t1oeen iciysfm emnvs;u4tlxoxocty1om rluvs t) exm(m iudaptn ivt ( sDtaxm nt4aeto f3ildlmDelnms;(0tlxoxf iydfatr nvols  2uoxm3nu4altnmivsa(fs2raurono0oetnmf3tlsfaDua(von()aetrmo3oadlat auvsls) rtoxr3nu4ap  mivs ( srtaumpou4tlt moeiltfs2uan o;(0 ltrmf iytfpt li i;(0t2tmio iydomtelivtltfarua(ronu4aleo oetat a eaums t0tlxomr3oodoa rlu s;t)texrxm3nudlpe lnciasfaDtr(m ;o1tlxn fetlsfmDul(ms;u4tlxnmoctotla  lieo t t2ur(m3nydoptemivsat)aDtrurooo0texn feiltls ua(mp ()trxnir3oatlpD  ivs t0srur(r3io4ol elfetl() 2rmumo;o4opxomo3tytlmDemu s;u4trtoir oytoateluvo t trtoirpiu4lpt  iviasfsrtmx  ;t4oexomfeiatfs uauvs u)aetnmf iotla r n s;( srtm(o iudapt  fctasfarraurpot4tlx  icilslmDrluvpnt)aetrxo todomtr uvsls0 rxrxo3ou1ale lnvsasf Drm(m nt1apxnmoeiydfa eaumo;(0aexoir3oy1la  ai s s  2xo(r iy4amtelivsa()srra(mp;o4tex mf3ils mDeln o (0trerxf oatfp e n s t) etmxmpnodlpen neta()srrrum oo4olt  feiysla uan snu0tlxriociodfatraueolt trtrio ou1lleelivs t)sDtmuront0apenmfctas mDeanmpn()tlerif iy1la e nesl(0sruo(mpou1omtnmnet (fa2tmx  ;u0aleomi3iys m2uau o u0aeeoircoydlmtr nes s0 2xo(mpou1ap elnet (  Dtr(rpou4oexomfetld mDraumo (0 etnxf3oadoatelu ol() eumxrpoy4ome mfes t aDurx ont0opxoif3iatla elnmp;t0tlenmrcoadoate ivi s trur(m ou1omtnlnviat)srraxm ;o4altn octys s umumo;t0arxomo3iadopDr nvs t0srtm(m nu4olt  fcilt)srta(  nu4alx io3tytls2rl( p u)tlxrio tadlpDrluvo;s0 2uoxo io1omt lfetlt)a2trxr nu0aetniociadfm rlums u)alxrmfciadlp   ivslt0setr(r3iydopen nvil( a2uau poo0apenmoctlt s2ranvo;t4artoxfciatlpD  uvolt  exoio3nodlm nmnes sfa2tmumpno1alxoiieildfaDeluvsn(0 lxrxo oytomD  ies t) 2uo(m3oudop nlfvi tfsrtr(roou4opxomoctat sDra(mp (4arxnir oydlm r n ilt0 rurim oy4olt mnvtat  rrmxr ;u4tpt if3ilsfm2ua(vs (0 ltoxr iatlmtraieo t seur(m3ny1lme  icils a2ta(r ot0oex mi3iasfa rlnvpn(4trtrxr tytfmtelies;s0seuoio nydlme  ieslt a2tau oot0teen i3tlsls2rlu pnu) exoirctadomteauvilt0 2xmxrpnu1al e fvias)aDtm(rooo1tltn f3ild sDrlu o u0 rtrxf3ta1optelnvi;( seto(o3oy4olte fet sfa2tmx p;t0aeto feiyd a elu snu)tlermr iadla   ivs;()t2trxo iudam nlnei tfsDraxront0tlxo f3iadfm ua( sn(0 rerio tadfmDr nvs;t)trxmxmpny4lme  fet s s2ur(mpnu1teenifeiadls2rau s;u4altomr3totfaD ai s s  2trxopnu4altn nvtas) Duaxmp;t1texnifetlsfa uln sn(4trerxr tadom   u s;(0s2toirpoodoleelncs s)aDumxro;t4alx  ocildls rl(vp;()teenirctadfp raivsl(0setr(o3io4amenlnet t  2tmx  nu0oetomf3tlsla2uanvo;t4trxrmr3iotfmD au s ()teurxrpou4alee neilt  2tmur ou4apt ioetldla ulumpnu4 eeoio3tadfa r ivi;t)t2to(o3nodomt micsat) Dtr(  ou0aetnif3ildfm2ulnmo u)arxoir3oadoa   uvsl( s2um(m nu1am e ncils  2tmu  no1apen feiydfs2emumsn(0tlxrif oydomDranei t  rtoimpou1ll e iesa( srum( onu4oet miciatlmDean p;t0tlermf3io1lm rluvi;(0sexrirpnodal e icsltf rrmxrp;t0alxoifeiyslaDulnmo;u)aeeoxf oytfpt auvs;s trumxr iy1lltelivtas sDta(rpot4tlenmicias s uanmo;(4tltrifctodlpte n ols  rtr(r oy4am nlnvilt artaum ;t0apxnio3tysfa ra( p;(0tltrif oatfptelnvol(  exoxr3oydop nlfvsasfa2tm(rp;u1alt  octasfa rmn pn(4aetomrcoo1om raueol( s2uo(rpoo1amt lnvs t  Dta(rpoo0aexnmf3tyslaDrln o;u)texnmo3iatfa  lneolt setrxr nydalen fvslsf 2rau o;u4alenifeiat a eluvo;u4altrif oy1optran sl(0 2xo(rpnodlpe miesl( s2urumooo0teenif3tysfmDrm(mpnu4 ltrio3tadlaD  uvsl( setr(m iudalen fvi sf rrmur ot1tpenif3iasfmDrm(vsn(4 exoxr3iytfptrln sl(0srum(mpiy1omt  nvsl(  Dtax onu4oexo f3iysfa rau p (0tleoxocoydfpDe uvs s0seto(rpoy1ll e feia()s2tmxront0opeomicilt aDul(mp;t0aetoxfciadop elnvol(0sruoim iu4openmfcilt  Duaxronu4apx  i3iasfaDrl(vp;t0 leoio oadoa r neilt)tetoim io4lltnlfet tf rumur ;t4aexoii3taslaDemnvp;u4 eeoxf3oytlate nvs;t0teur(m nodope lfesa(f Dum(mp;o0oexomi3iaslm2ul(vsnu0alxnxrciadfpteaneo (0 rxoxm iydlpeemfcsat)artm(rp;u4olt mfeiatfa2ua(vo;(4alerir3iodlate i i t trtrirpoodaleemnciatfa2urxm oo4tetn i3ildfa2el(msnu)aleomo3tydlat lnvs;s0 rumxopoy1al   fesat)a2rrumono1olxnmf3iad s um( p u0 rtrioctydop   neo;s s2ur(m iy4lltnmfes tfsDtaxront4aptn fctld a uanmont0 rxnxfcoatlaDeluei;t s2ur(o no4lpe  nctltf rraurpou0tpe  i3iytls2emn pn(0trxomf totlp r u i;t)srxriopiu1lmeemnvia(  2umx  oo1oeenmfctlsfa umu ont0teerxocoo1lat aieo s)s2xo(rpiy4altelfeia( s2trxmpno4aetnii3iytlsDul(ms ()tlxrir3ia1omt auei;t) 2xr(o3iu1lpt  nvtatfsDtrxmo;t1tpt mieias s2umnvp;t0aetrir oadlm eaivi () rurim ou4alenmictas) 2raxrpnu4oex mf3tys a rl(vs (4arenmfctatlat anvs;t0 2xmxmpiy4am  livi t arua(rpno4aptoio3ils s rmnvo u)aexnmr3iatom r i s t0 exrim3nudlmenlnvias)a2ra(rpoo4alt  iciadfm2rl( snt4arerio3oadla  auvo () 2xr(rpoy1omt lnvi ( artrxm ;t0olt  i3ilt a ul(vp;t4arenmrcia1omD au o;s  rxoxo3iy4ope lncta() 2raxrpou1oltnmi3tldlm2elnmp;(0arerir ootopt lnvo t)s2tmio oo1omte ivilt) Durxmpot4tlt ifeiytls elnvpnt0trxomr3iy1fp raieo;(  rxmxm nodlltelncta(  rrr(  ot0aeeoio3ildfm ua( pn(0 lermfciatfmtelieols)s2xm(mpoodoltemneta(  ruau p;u4opeo i3ild m2eauvs;(0aeermrcootopD li il(  2xr(mpiy4lptemfesl(f 2ururpnt4aex  fciysfs uanvp;t0alenxf3oydlaDeaivo s0tetm(m iydll nlfvt s)aDtr(mp;t4altnii3tlt a rl( p u) lxnmfcoydfaDrln o;()teuo(o ou1lmenmiei () rrax  nt1apx ii3iyd aDrm(vs t4teeoxf oydlat lneo s)t2xmio3ny1lp nmfvta()srra(mont4aee ioctys sDul(vo;(4 rtnxocoytlaD  ues (0s2xo(o3iydapt mivi (  Dtrx  ;u4aleoioetydfmDrm(mp (0altoxoctydfpDeln i;(  2xm(mpnudol nlicil(fsrraxro;o1teen fcils a2ranvp;u) rtoxociotfat auvi;() rtmxo iodlptnlici s  Duaur ;o4altoiociysfa2rauvsnt4trxrifctodfpDr neil()trxm(r nodoltnlfetl()aDurum ;u1olxn octltfaDuan snu4 lenmfciadfa  anvs;t0t2to(o oodlp elics ( srrax o;o1texoifctytfs uanvonu4treomf oytfmDelu o;() rtmxm3io4apt liviatf 2ur( o;o1oee io3tyd a uluvon(4 rtnmfcoy1lptelues t tetoio3iu1lp nmnetlsfaDrm( o;u0tpx iocilt s rm(vp t) eeomf3ty1fmDelu i t)s2toio ou4omee fetasf rur(mooo1aeen o3iltfs2uln p;u4tltrioctytfpt  uvi;s)truoxrpoo1omte feil(f rur(m oo1altnmieiad s rmnvs;u0tlerif oo1oaD lnvs;( seurio iu4al  micil(  rrax o;t1tpx iieilsfmDem( o;u)trerif oodopt anes;( teur(opiudlpe lfvt sf 2ur( o;o0opeoii3iasls2eanvs u) exoxociytlmDranes;t0 exo(rpio4ol  lieslt arua( oot1apt mociydls emu s;t) ltnif tydoat aues;s0 etoim ou4lptemieta(fa2urxrpoo0ale mo3ildfaDrlu pn(4arxnmo tadoat  nvo;t0truoxo nu4lpeemicsasfsrur(rpoo4tpx moctys m rl(mpn(4alerio3iydomD  u s (0s2xrimpoo4omte iesa(  Drru o;t4aetnio3iat a2umnvo u)tlxnircoy1op e nvi (0srumim3ou1llte feiltf 2tmxmp;t4tltnmoctatfs2ean o;u) rtnmoctatom e nvs;t) 2umiopiy4ap  livtlt)aDurum nu0alenio3ilsfa2eaump u0alxoxfctotoaDrlnesls0teurio iu4ape  iesasf 2rruro;t4tee iictytla2umn sn()tltoif3iotfa elu sls0seto(o no1lpe lncs s) Dumx ont1ape ii3tasfs2rau s;t)treomf3iy1faDraneils0 2xoxrpny4ap  lfeia( s2uaxmonu4tetn i3iad m2ulnmsnt) exrmr3tatlat lueo t0 etoimpnudopt mivilt srururont4olen ieiat s ea(vs;t0 reoif3ty1faDeai i;t s2tm(o nu1oltelfciasfaDtrum ou1oeeoifciyd s umuvo;t) exoir tadlm  ln s s0sexoirpoy4omtnmfctl() 2umu  ou0opt moeiytfm ra(vo t4 lxrif3ta1fp  lnvi (0seumir iy4lm   netltf 2umur nu1tet iiciys a2umumsnu)tlenif totfmDe i ols s2urxrpoodlle mnciat  2rrumpoo0tleomoctyt m eauvpn()trxoio3oatomt lu s;t0 2xr(m3nudllee iesl( sDraurooo1alt iicilsfsDea(ms u0aetoir3oadlm e i i ( srxr(opou1omtn ivils a2taxro;o4aleomfctlt mDulu o;(0alxoio3tytfatelivs;( seum(o3nu4open iesasf 2umxrono0oleoio3iyd m ulnmo;(4treomo3io1la rau sls0s2to(o nudal elivsas)s2tmxrpou4tpeo oetysfsDuanvp (4aleomf oydoat aieo s) 2urir3ny1omenlietlt  2ua(ro;u0tptoif3ilt aDumuvs t0tetnmr todom  auvi;s)srtm(o3nudomtnlfvtat srtax ooo4apxnioeiydfs emn o u0 lxrmr iy1oatrln o t sruoim iy4aptnlivs (  2tmx  oo0olt  f3tltfa2rlu p;(4alenmr oadopDranei;s0 rurirpiu1apenmnet (  Duru poo0tpxn fciyt s2ua(mon(0aexoifcta1fmD ai olt0tetoxm oy1amtelivtlt) 2umurp;u1tleoii3ilslm2em(vsn(4aexrxr3oytlmD  ies;() rtmim3iu1llte ncsls) Dtaxmont1oleoiociadlm uau s;u)texnxocta1laD an s s)trxrxr3no4ope  fcs t)a2ur( oot0opeo iciasfm ean o;()tetrirctadlm rlieslt  exm(rpoo1ol nlfcsa() Dumu onu4alenmf3iad s2ulnvs;(0trxnir oadoatelivo s) rumxopiy1lmt  nct t s2uaxr ;o1tlxomoetytfa rlnvo ()tleomr iydfa eln sl(0s2xo(o ou1opee fet ()sDur(m ;u1oltn ictat m ul( pnt4 ltoir oadomDeau s t0srxrxo oydam  mneiat a2trxm oo4altn f3iltla umnms;(4 lenxr3ia1lptrlues;t)teur(r3oy4lptelicsat) rur(m ;u4tee  icilt mDelu o (0aeermo ta1latran o;s0setrxopiu4lmt lncs t  2tru pnu0alt ioetldlm2ul(vpnu0tltoxrcoadopte n s;t0setmio3nu1ol elfctas  2umu ooo4tet moeiltfaDea(ms (4texnmrctodlaD  iei ( sruoimpnydaltelivsl(  2um(m ;t4altn feiasls eau p;(0arerif3tytom r ivolt s2to(m3iu4lm e ietlt)srrru  ;t4opx if3iadfm ea(vp;t4 lenmoctotoa r uvols)teurio oydomt  ietat)arraxm no0oet mieiydfs2uauvp;t4aexnxf3ootoa eai il()s2to(o3oo4lmtelfvil()s2ra(r ;u1open o3iltfs raums t0 lxoxo oadfpDrlieil(0t2uoxr iodaleemncslt arrax ont4optoii3iyt m2ul(vsnu4 lermf3oy1fa r nvolt0teuoxo ny1ol nliciasf rtruront1tlxnif3tatfs rln o () eeoir3tydlat ai s;() rxmxrpio1am e neiltfarrrxro;t1altn o3ildfm eanmp;t4 exrmocoadfpD luei s0s2um(opnodlptnlnesa()artmx  nt1opeomfeias m2ra(ms ()arxoif ootopD aivi s)t2tmim iy4lle lfvt sfs2tr(rpou0alx if3tldfs2eanvsnt)tetrmr totfmt aueo;t  euoxr3oydlltnmfesls a2uaxmpou4oeeniietlsfa2uln pn(0alerxo3tadoaD  uei;t) rtr(m3oudlpeelnvsat s2uaurpot0aexo o3iad a uauvp;u0 rxrircoo1la r u o s0s2tr(m nodomtnmnctat srrau  oo0tlen iciys sDrl(msn(4texoxf3iadopDelies;(  2tmio3nodlmeelfesasf rta(  no4olt  fciltfs2ulnvont4 ltrifctatfmteaivsls) rxmio ou1op  lncsatf 2uau  oo0ole mociasfs el(vsnt)aexomfcoodoate ivo ()teurxmpiu1ol elnesat)a2ur(ront4ale  ieiydfa2umump t0arenmo3oydoa  aivolt)s2umiopoydalenmfcs s srumumono1tlxomfciasla eln s;() ltnxo tytfmDelu ilt0 rur(r iu1ll elict s)arurur oo0aeeo oeiadlsDrmu o;(4 ltrxrciatop  aiesl( t2umxopio4lpt  nctlsfaDuau ooo1opx mf3ilslmDrmn p t0 exoioctatfpt anvs ()sexoio3iodalenlivi sfa2rr( pou1olx iieiydfm2emums;u) renifcoydfmD lneo;( srxm(r ny1opt  ivsls) rta(rono4aexoifeilt s2umnvs t0texrmf to1lat livols) rtmxm ou4ape  ieslsf Drmur ;t1tpenmo3ils mDean o;t)tlermocto1fpD aivils) rtmxm3nodal  lfet tfsrrrxmp;t4tptnifcild aDemnvs t)aexnxr iytfat  u o;t)teurirpiy4olee ics s s2rr(rp;t1opeoioeiyd mDrm(vo;t0aeeoif tadfmt ln o (0 2tr(opou4ape lncta()sDumx  nt0tpx mfetadfm2ulnvs t4 etnxf tadop rln o s  2tmio3io4amenmivilt  Duau  ;o4aetnmfetlsfs rauvpnu4alxoxfcio1optrlivslt0texm(rpou4olee neiatfa2rrumpnu0tlt mfciadla rmnmont4tetoxo3io1lmDrlnvs s  2uoim oodll elietltf 2ra(mp;t4aex ifctydfa ulnmp;u)teerirctodla  lueilt)trxmio3no1lpenmncsa( sDtaxm ou4ope  ietadfs2elnmo t4aexrir3ia1faDean o;(0sexr(o3no1apt mfvt ( a2tmxr no1alx  i3iadls2umu pnu) exrxo io1fa rlnes t t2xm(o iu4amenlfct (fs2ta( poo1ape mo3tytlsDea(msn(4texrxo3oo1lat  uei;()trxmxopoo1om emietas) 2uaur ot1oex mieilsfa2emuvs;u) ltrircoydopD lues;s t2tm(r no4op nlies (farrrx pnu4tleoioeild m rmnmp u) reoxf io1fmtr ivslt  etr(opno1apenlfviat  2umu  nt1oeeomo3iltfs uln p t0 rtrmfcio1lat aivi t0sexrxmpio4apeelieslt sDua(mono4apt  i3iys a em(mo u0 rxoio iatlpDr ivo t trurir3no4ap elnetltfarua(moot0ole mociatfs2elums u4 ltoir ty1fpte nvo;t0 2uo(r iu4lmtnmnvs s  ruaurooo1alen o3iasfs ran p u4arxrxr ootfm   ies;(0 2trxopio1olenlfcsl(f Dumxm nu4teenif3iatlm2eanmp u)altnif3tadfmDeaneil( t2urxo3iudlm n iviat artm(r no0olt mfeiaslm rauvp (4 exrifciatomtr neols  2to(m3nu4ale mfcsa()sDtrurpot4tpt ii3tad sDua(mpnu0 renmocootlaDr nvi s0trurio3io1alt  nvias s2tmu  nu4tpt mi3ilsla rm(vo;u)arxrxo to1fpDelivo;t  2to(o3iy4altnlfesls sDua(  ot0tet io3iydfaDua(mp;u4 etomr3iy1opt lieolt0 etriopoo4lmenmfcs t)arurumoou0apxo o3iys m rm(mont4aexnxf to1lmD lnvsl()trxrxr3oy1opt lnvtas)sDua( ono4tlxnmoeiltla2umums u0trerxf oy1fp e iei s0 2xmxm3iy1lptelivils) Dra(rpot0oetn oeiatfm umumsn(4tlerio ootfaD  nes s0 euo(m no1lle mnvsas)a2uaumooo0aptnmi3iasla rmu s () exomr oo1lat  ivi t teto(o oy1al  livi s)srumxrpoo4olt if3tas s rmnmo t)trtnmociytfmt  uvi;t0srurimpio4ole lfcsas sDra(ront4oleomfcias mDel(mpn()texoxr oodfmDraieo s teur(r3iu1lmt livi s) rrmxmpou1tpxoiictltfm uan s;u)tlerxf to1lpt an s t0sexrxopoo4lm  lfct s srrr(r ;u0teeniicildla2rau sn(4alxomociotomDr uvsls)trtrxr ou4op nlictlt)srumx ono4opto oetltfa2el(vs;u4arxrmf oatomte nvilt) exmirpno1ape mnet t  rrmu onu0tet  f3ilsfs2ra(vsnu4alxomo3iytomteln sls trtmxm3oudalee fvsasfsrrmxro;u0oeenifeildls uauvonu4artrmfctatlmt lneils0teuoio oo4olen nes (farrrxrp;t0aleoifetas a2ranvsnu)arxnmr3ia1opteli sls) 2tr(m3oy4ll nmict sfarrru pnu0oee moeiysla2elnmp u) renxf3oytfmtrlivo s srxmiopiu4apt  icia( a2tauro;o1tpx  ociytlm rm( o;t) exnio tydomDeauesls  2xo(rpnydame mivi (f rtrumpot1olt ifcilt a eluvp;t4tetrif ta1fp rln s;t  eumxm3ny4lptnmiesl(  Duaurono4oee iiciysfs2emu s;u0 exnirciadlp  aivi;t0 2to(mpnodamtnlncs () 2uaxm nu4tltoifetydfs eau snt4altrmfcto1fm elnvi s) rxo(m3nudaltemfviat) 2rm(m ;u1teenmiciytls ea(vonu4trxnircoo1fmDrluei ()seurxo iodamee fctlt  2tr(mp;o1oleoif3iydfm2el(ms (0 lxnifciydla r ues;s)seumim oodop elfvi sfaDrr( o;u4oeenmoeils s ra(vont4tetnmf iydlaDean s t  rxo(m iodlpt lncsl()sDuau  ou4tet mietltla umnvont0tlxoir3tytlmt luvo s) 2xrxrpou4al emivtlt artrxront1tlxnioctadfs rm(vs;(4 lxrxf3iy1lmt  u i t  rxoir iy1alt  ivtlt sDuax ooo1tptniocilt aDranmsnt0tetrmf3totoptrauvo t)t2xrio oo1apt livslt)sDraxr ;u1optnmf3iasfs emuvp () etomf3oatlat  nes t  2xm(o ny1ll  mietas)aDrrx oot0oetnioeiadfm2ul( p;(0 rxnmo oatlp e ivi (0sruo(mpoodlp n ietlsfaDraumo;o1ole miciasfmDem(msnu0aeeoxr3to1op ean il(  2tm(m iudapee ncia( sDtmum ot1tetn f3ilt m2rlumsnt)altoifciy1fmD  n sls0trumirpio4oltnmneslt a2raxro;t1aexn feiytfm2emnmsnt) lxrircta1fat auei;t  exmirpio1oltelies t aDtm( p;u4aptnmi3iysfaDumnvpnt) lxniocootlm   nvols) 2ur(o3oy4llenmnvi tfsrrrxmo;t4oetn oeiys sDrmuvs (4 ltoxfctatlateai i ( t2tr(opiu1altelfcsas  rrrx pou4aetnii3iatlsDranmsnt) eerio ta1opt luvs s0trxo(o3oo1altnlneiat sDrrxmooo1tltnmiciad s2elnvp t4altrmrciy1lmDr ieo t)t2xmimpio1ape  nci s)arra(rono1openio3iysfaDemnvsn(4 rxoirciydopDeln s s trtmxr3ou1optemfcs ( artmumpoo4aptomi3iytla umu ont4 ltoxf3totfatr nei;( tetmirpno4lle  fei sfsDua(m ;o1oexo f3iys aDea(vpnu0arenio ta1faD aneslt0 rtmxmpnu1amtnlfvil( s2rr( o;o1aex if3ilsla2elnvs;(4aetoxocto1lp e u o (0 exr(r iy4opt micias arur(mpou4opxo ictys mDumumo (0treoircoytfmDeai o t)seum(o3no4oltn fcils a2tmu  no4aetoiictlsfsDelnms;t)tlxrxoctadfp eluvsl()t2umxo3nydoltnlnvsa( srra(rpoo4opxo ieiltls2rm(mp (0 lenif tadlpDean s () 2uoimpiudale  nei ()arrrxrpnu0tpxomfciytls2raumo t4tlxnxf3oo1lpDe ueslt) exrxo oo1olen nvi (f rrrxroou0altnmocildlaDeanmo;t4alenmr tatom eau i ()texmirpny4omt livsls a2tau onu4teen ociysfs uanvsnt)trtrxf tatfa rlivs s  euoim3io4apenmfvt tfs2ururono1tle iicildlmDel(mon()tetnio3tadlpDrauvil(0 2uoxr3iudlm e nvsa(  2ua( ono1apen ociasla umnmp;u0alxrir3iotomt  ieo ()setmiopoodolt  fciatf 2umxront4tltniietldla2ul( s u) rtrxfciotoatrln s;t0 rxmxr3iudopt lnvsatfsrurumpno4oex mociadlmDuanvp t)aetoif3iotop eaueils  rxm(rpny4ameelnvs s)artmxr ;o0olx ifetydfs rl(vs u4trtrmfcoytomte ivs (0trxm(m3nodal   fct (farur(m nt0apt mo3iysfs2ran o;t4teerxf3ta1la eaivilt0 eurxrpnodap  mivias  2tmu  ou1oeenio3iyt s ulu p (4 lxnxfciodlm  lnvo t srxmxmpno1lptnliei t)a2tax pno4aleoifctatfaDem(vsnt4alxnmr3iadlp   uvi t)truo(mpiu1alenmieilsfarururo;o1olx ii3tlsfaDuanmp u4 lxnmr todfmD  i i;() rurxmpnydaleemieiat sDrax pnt0alx  iciadfm2ul(mon(4artnxrcoydlpDe nes t t2xmir nodopt mieiasfaDtr(mp;t4tpen o3iytfm2ul( p u)artoifcoydlat aieo t)teuoxmpiy1olen iesas) Drrur nu1apxnii3iad s rauvo (4aetoxrcto1oa rlivols)teumxo iy1ll elnesa() Drru ooo1teenmocilsla2ean o t)tetrxocoa1fmDrlieils texr(m3ou1lp   nctatfartrxrpnu1apxomf3tad m2eau o (0treoxociy1laDrlu s;s)texrxm io4om emnvs s a2trxmpot0olenif3ilsfs2ul(vpn()artrifcoadfmtrau s s0 etmimpoydlp emnvt s) Dum(rp;o0ole mo3tasfa rmnvo u) exrxfcoodlm eaieilt0srxrxr3iy1om e nvslt) rua(mo;t1tptnmociyd m uan p;() rxrmrcoo1fpt anvsl( teuo(o nu1al nlnet t  rtrxm nt1tex  o3tydfm2rm(mo ()artomo iydlptranvi;s s2uoxr3ny4al eliet (f 2umx p;u0tpeomfetyslmDuauvp u4 ltoxf3tydfpt lnes t  rtmxo3ny4lpte fetl(  2rmu oou0texnioetys mDean o (0trtoxr3iydlptraivolt)texo(m3nydlptemictatfsrtrurp;o0oltnmieiysfmDem( snu4trtrioctytoa raivo;(  2xo(m oo4amenmietls arra(rpou0aee  fciatfs2eauvont0teerio ia1fa  au slt0s2to(opiy1olenmicsl(fa2tax ooo1tpeomoeiasfs em( p;u0altomr3iy1op  lnei;t trxmir3ny4ll nmfei t arrr( ont0ale  ociltla um( o (4aetrif tytlpt ln ol()setoxo3oy1alen fvs ()a2rr( p;t1apen fciysfm emn o u)texnmocoo1oa e uvo;()t2uoio ny1llenlnvt s a2rru  ;t0aee iietytfaDemu snu) rxoif3iy1lmDeau sl()s2urxm ou1opte fesls) 2uaxmpou1tex mietyd a elump;(4tltrmf3to1optelu s;t0srtr(r3no4llt mnvta( aDrrumpou1oexn fcild sDra(mpnu)areriocta1fmD  n o ( sexmimpio1lptn ieias)srum(m ou1oetoii3tas m2rauvs (0 etoxf3tatfateln o;s0trurxm3ou4lpe  ictasfaDrm( pou1tex ii3iatfm umnmp t4artoxr3iydomDr n o s0s2to(r3iudol elnci ( sruaumoou4oltnmo3taslm2ea(mp;t4tetoxr oodlmDranvsl()tetrim3oo4lmte ivi (fsrrm(r nu4tpxniociyt aDelnvo;t)aetnirciadfmtelu ilt tetoxr3oy4lpt  nvtl(fsrtmx  nu0tptoiieias mDumumo;t0tltrmr3ty1lmtranvi t0s2xrxr3io1alee fesa(f rrrumont4apxnio3iytfs eauvpnu4 rxoxf iadla eluvols)trur(opiy1ole mnesa(fsDtm(  ;u1tlenioetat sDemuvsnt4trtrxr iydomDr n i s t2xm(m nydopt  feia()arta( ono0tetnio3ild a2ran pnu)treoircootfpDrlneils srumxo3nydal emiei sf Dtr(root4oleoiiciadlm rm(vs (0aeeomfcoytlmteluei (0setoim3io1ol emnesa()arrrurpno0tpenifciasfm2raumont0 eeoxfcoadfm rai s () rtrxopoy4apenmiet sf 2um( o;o4tltoii3tytla rlums;u0tlerifciy1oaDranvol( srurxo no4lm n iviat)s2rmurp;o4tpeoifctls mDeau s (4trtnir3tydlp   ueilt0 2tmxm3iu4lmtemnvta()aDurxrpno0oeen i3iys m eaumsnu)trxrmo iydfm e ieo s)teuoxm oodlltemivtltfa2raur nt4opto fetlt m2rl(mp u)teeoxf3iadfmte uvi s) 2ur(m no1llenlnvtl( arrmxm ot4tle  o3iydfs2el(mp;(0aetomf totfp  aiei s)setoim3io4optn fvi s)arra(mo;t0oltn f3tad s2elnvp (0trxnmr3todlaD aueils trxo(o3nu4oleelietasfaDuaxroou4aleo o3ias a ua( o;(4 ltomo iytopDelueo t) 2um(r iudomt mfesas) 2tmxm ;o0oeeoifeiytfa2rlu o;t4 renif tatop elueolt)texmxo3nydlpte nvilt)arra(rp;t1oetnmfciltfsDelnvpnu4trtnmf oadfatraiei s  2trim3oo4oltn ictatfsDtr(m ;o0aexoif3iytfa emnms t4 etrxfctodfaDr i o s0teuoxo no4omte ict tfarumu pou4alxomociad a rauvsnt4alxnifciodopDrln o;t t2xmxr3oy4omtn ivta() 2tmx onu0tex  feiyt aDeln pnt)arermf3ty1fmD aivo t) 2uoirpou4lmeelnci s  Drmx oot4ole iictatlm2rlu s;()aetrmr3ia1lp   nvi;( t2uriopio4opte nvsl(fs2rmxmo;u0oet mo3iadlm2eauvo;u0aexomfctadfa r nvo;t tetm(mpoodlm nlici sfa2taump;o4opxnmi3tydlmDrlnmo;t0 exrmf ia1fptr i ils)srtrim3nu1llee fci ( sDtauronu1optnmo3iatfa ulnmonu4alxnmocoo1lmDrliesls0s2xoio3nodale  iei (f Drau p;t1alt miciydfsDeau ont0alxrif iy1om r ues;t srxo(r3ny4ap e nvs s)arta(  ;t1opxnmieilt mDrm(vo;t0tetoifctytomDr nvi (0tetr(rpiydllee ivi t) rua(monu1apxnii3ias s ean sn(0aexnio3oa1om  ai i;t texm(r oy1ol   neia()srrmxmp;o0openif3ild m2el(mp;() eenifcty1la  aieo;( srtoxm ou1amte ivi ( sDuaxmpot1aee  f3iysfmDran o u4 rxrir3oydfpDelnes;s s2urxr3oydopen fvil( srtax oou4texn i3iasfa2rlnmp;u)tleriocoatfp  anes;(0sruoir3oo1lm nmnei t srurxr ;t4olenif3iys m ra( o (4 rtnxr oytlp  ai o;t)t2xoim3oo1om  lfeias)a2rm(mooo1olx mo3tyt a eluvpnt0arxrmf oytfp rau o;t0 etoim3ny4ap  mneilt) Drrxm ou4tleo feiydfsDrmnmo t0tltnifcoydfpDrln ol(  rtrim iy4al   nctlt  2taxro;o4oltnifciatfm2eauvs;(0aexrmo3tatoa rln ols0 2umim3iudamt mnetltf rtm(mont1opt  fctatlmDeau pnt4 lerif oytlat auvs;( tetoiopoodllte fvia( a2taxmpnt0oeto ictys m emu onu4arxrmf iytoatraivs s)srurir3nu1op nlnesas sDtr(roou1aptn fcils a eau pnu) renmo3iadlaD au o ( trtrirpiu4lmen nvia() 2um(  ou0aleniociytlaDulnvp;()trxrio oadlm  aivols s2xmio3iy1ale  fetlt  Duru ont0apxn fciatlm2eanvo t0 ltrio oa1fp  au i t0 etoxmpno1ome mfei t) 2tau  nt4aeeomfcild aDrauvpn(4 exnmo3oytfaDr u olt0 rtr(o3nu1open fvtltf rurxm no0apt iietld a2rmn s;(4 ltomo3oo1fatrli ilt0 rxr(o3iudolt mneta(fsrum(  ;u0aleomieiydlsDel( o;t)aleomr3ia1om   ivi;s srurir3nydoptemnvtl() rta(ro;u4aptnii3ils s umnvonu4 rxrif3iadlpDranes ()texoio3oo1olte fvsl( sDrrxmpou1opx mociyt m2rl(vo;()texomf io1fat  ueolt)sexmio3iudaptelfvilt srrru  ;t4aeto fetltfmDrlnvp;t)tltoxr3oa1lp e n o s)trurxrpnudlp nmnei sf 2ua(  ;o0apt mo3tyd m emu pnt4 rtoiocoydoate i slt teumir3io1lle mfcs t) rtau  ;u4tlxoii3ilt m2ua(vp;t4areoxrciodlp r iei s0teurxrpoy1llee fetasfa2taum nt0oet ii3tldls2elnvsn(4 rxrmr iydlp   uvi;s teuoim3ny4lme lics ( srrrur nt0oee ioeiat s rmnvs u0altnir oydfaDr i ol( sexriopnudlme  ivi ( s2ta(mp;t1oexomoctydfs emumpnu0arerif oy1latelu o t0srum(opiydop nlfvs tf 2taur ou1oee iietydlmDrl( pnt0 renmr iydfmte uvi;t  euo(rpnudlltelnvtlt  Drr(rp;o4alxn fetytfm2rmnvp (0 rxnxr oy1oa raues s0t2uoxrpiu1lmtnlnviatfs2umxmp;o0oltomieiytfa2uluvpnu)arenxr3oadoaDr u sls0 exmio nu4lpt mfetlsfsrtmur ;u1apx mieild a ra(vo;t0 rerxr3tydlpDraueslt seum(m nodom n fvi t)sruru  ou4oet  ociys a2ulums u) ltomo oodfmDrlu ols  rumxmpoy4apte fvt s)a2taxm nu1olxnmfeiatfs2ul(mpn(4 ltoir3iydop   n i (  eum(r3io4lltnmfcs s)artau pnt0alxomfciad m2ul(msnt4trxnmf3iotfmDrlieil() etrxo nydomeemicsas)srumur nu0apt  oeiyslm2umnvo;(4 rtoir3oa1lp rlieol( t2urimpny1aptn fcs sfs2ra(rpnu1opxo ociyd a eanmonu)treoiocootlmt  nei t0 rxmirpio1oltemieiat a2ur(root4aleomo3tlt s uauvs;u0trenmfciotlat  ivo;(0srumxopno1opee ivs tfsrum(mpoo1oltnmfetyt m uaumpnu)trtrif3tydfpD  ieslt)trur(o oydllenlivt tfsrtaum oo1alxo ociadfs emuvp;(0aleomfcio1lp e i ilt  rxm(r3io1ol n iei t)aDra(root0tee  ociytfs el(vo;u0 lxnmf iydlaD  uei s0setmxm3io4lm n ieta(  rurxmo;o1tlxoifeiadls2ra(vs t0tlenxf3iytlm ranvs;t0setrio3nydllen nei s)s2ua(m ou1apxomfctldls uanvo (4altrxrcoo1fateanes s0 2umio3io4op  miesatf 2uauro;u1apt mi3iyd s2eluvo t)aexomfctadfaD luvi s0srtm(o ny4lmtemncs s aDrmumpou0texoioctys s um(mo u) rerif3iytfpt livs;t0s2xm(o3ou1apte iei t a2urxr ;u0tpxnmiciys s2ua(vp u4aeerio3io1fm   uvs;t)sexmirpnudlltelieslt  Draxro;u1apxomoetasfs2ean o;t0 leomf3to1lmtelnvs;(  exrir iudlptn fesa( arrr(ro;u1tlx  fetld m2ulu o u4trxrxfcoo1om rlu ilt  2trxm3no1apenlfei t a2rrxmpno4oetn f3iytlsDuln p (4trxomo oy1oa eanvo t) 2tmimpnu4lptn fvi s  2urur nt0tlt  f3iad s2rmnmp u) leoxr iodopte nesl( sruriopnu4oltnmnci s  rrm(mooo0oeeo icildfaDumuvs;u)aetoif3totlm e ivo;t)sruo(m3oo4ol  mnvtlsfaruau poo0optniieiasfsDraump ()aetrmrctotopD  ivilt)t2toir oy4opeemnesasfs2rrxm nu1oleomo3iltlsDrm(von(4 lermrciatfmDe uei;(0sruo(r3iu1ame mfcs s)srrrxr nt1apx mfcild aDumnvp;t0teenxrciadfaD lues s0tetmxr3iy4ale lnet sf Drmx ono4alen ictadfs em( s;()arerif3to1fatr n ols)trxmimpio4oleemneslsf 2ururoou1optomoetysfm emumpnt0aetrif3iadoat aivil(  etrir oo1lmtn fvsas  rumum oo4tpe if3iys aDem(vo;(4texrmr3tadlatr n o t  etmxr3oy1al nmfvils) rrru  ot0alenmf3iyt aDulnvp t4aleoxr3iadla eauvi t s2umio3iu4olen neiat) 2uax p;t1tpe ioeiyd mDemn s t0trxoxr3iytfm e ivs (0s2toir3no1amenmfct t a2raur nt4aptnmietlslmDeanmon(0tetnxoctadop ean i;s) eurxo3no4al elfet sf rumxrpnt0apxoii3tyd a2rmu p;u4 rtrmfctatlm r uvs s  etoio3iy1lmtemiesasf rtaump;t0alxnmfetls m eauvo (0aeeomociytfpte ivols0teurxr3oudam  livtls)srrax oot0aetoio3tlslaDra(vo t0aleoio3iy1op rluvsl()seuoxm nodame lfcsa(fsrtm(mpot0oee mieilsla rluvpnu4 rerio3tatfmtrluvsls t2xoxr nu4opte nvsa(f Dtru pnu0alx if3tadfa uluvp;t0altnio to1op r nvo;s)s2toxo ou4lleelfvil(  rtr(  ;o4opxnmieiasfm2rlnmo t0 lenxf3iy1omDrln s t0texriopou1ome  ivi t)s2rrxmpot0oet micilsfa ulnmpn(0 etrmocoydop rluvi;t s2xm(m nudome  iet tfaDrmumo;t1alxo ociatfsDeanmp t)trenifcta1fate ieo ( trtr(mpoodaptn nvia() Drr(ro;t1opt mietatfmDrlnmont) exrir3iy1lateluvs t0srxmiopoydale  netatfsrra(r ;o4tetn fetldfs umn o;t0 lxoxocta1lmt an o;t tetmim io1lmt lnetlt) rtaxrpno1altoiociydlsDua( pn() etrmf3to1fm  aieol(0t2urim3ou4om nlnetl(fsrtr( o;o4olt iociatfm ulumo t0 exoir ia1lm  au sls0 rxr(r3ou4lm  lnei (f rtmu ooo4alt  octydla2rl(vo;u4 leomf tatopDranes t)teurxr3ou4op emfcils)a2ur( onu0texoifeilsfm ea(vs;u) rxomocoy1omDr u ilt)setmxr3iu4lp  lnvsl(f Drru  nu4aee mo3tldla2umnvo;t0 lxrmr to1omDe ies;(0s2uoio oodolee ncilt  Dta(  nt0tlx mf3iyslaDelums;t0 etrmrciy1fpt ln il(0srurxmpiodomt  ictl()s2uru  ou4olt moeiytfaDeauvs ()artrif3tatlm eaiei t t2urxopnydol nmfct (fsDtr(ro;o4aexn ieiys m rlnms u)tltnif io1om ean s;s) exrim3no4ale mnvsatf 2rmur ;t4aexo ietyt a2ulu pnt) eeomrciytlmD ln i;(0s2tm(mpiodlmen ivsasf 2ra(mpnt1oeenmf3tld sDuluvs ()tetnxfctadoaD ln o;s)srurir3oudaltelnei t aDtax  ;t1apx  fcilsla ua(mpn(4trxnmoctydoa eaieil(0texmimpou4lptn feiasf 2rmx p;o1aex if3tlsls um( s;()arxnmfcoy1om rlnvo;s)setoim3oodlmtnmivtlt)s2tr( o;t0tlenioctyd a elu s t)tetrxociotom ran i;t)texm(r3iydlltnmnci (f 2truronu0oeenmociys m ra(vs t0tltnmocoodoaDrlu s t0 2tr(r3ny1omt mnvtasfsrumu o;u4apx mfctlt s2eauvpn()aexrmo3oadlm ran i s)t2xo(m3oodlp   fes (fsrtau p;o0alt mi3ias s2rlu p u0tlxoxo tytfat livi;(0 2ur(mpoo4ole mictl()a2tmu oot0tptoifeiltfs2emn pnu0 etnmoctytopD au i s) 2xrim ny4amt  ivtlt aDtaump;u0opeoii3iasls2ra(mp ()trtoxf oo1fmte nes t trxr(o oo4lm  mfci (fs2urx  nu0ope mf3iatfsDrl(mpnu) rtrioctotfp  auvs t)tetoim ou4lm   ivt (fs2raxm nu4oex mfeiytlm2em(mp (0aexoiociatoatrauvi;( s2uo(r3ou1apte fvi ()srtm(  ;t4aexn icilslm2uanmp;t)trtrmf iytfm rlnvi;(  2ur(m no1apenmnctlt srum(m ;t4ape if3tasls emnmont4aeenmocoatlm  ln o s)seumir3io4ame  ncs (  Dtrxr ot1tptniictas s eluvpn()treoxo3iydomD anvs;s) 2xoxmpny1ameeliciat arumxr ;t4aeto feilsfa2rmnvp t) rerxr3ootoa e n o;s)trtmxr3ny1ll n nvil( aDtmuroot1oeeomociatfa2eaump;()alerxfcio1fp  auvo s sexoimpny1lme  ncsasf rta(moot0tpe ii3iydfaDra(ms;u)alxoiocty1omD livo;t0trurxr no1lp   nviltf 2ua(  no1tetnmoeilt aDuan snt4artnio todop rli o t setr(o iu4om  mietat) Drax pou4opeomiciad s em(vs () eenxr tatlmteaiei (0 exrir no1oleelnvtls s2raumo;u0aee ii3iytfs elumsnu0alxomo oadoaDeln s;s  euoio iy1amenmivta(f rrru ono0aeenifetad mDum( o;u4altrxf3iydfmDrli s;s)s2uoxmpoo1lltn nci ()s2taumo;o0tleoiiciysls ranvp;u0 exoxfcoadlm rluvs ()teur(rpoy4llt livtasf Dtrxmpnu1aptnio3tatfmDeluvpnt0trtrif todfp  ln s t0t2urxr oodomt  ictatfsrra(r ;t0oetn o3tadls um( p;(4aexrir3oo1op e nes;s  2xrir3ou1llenlict ()srta(  nu0tpeniieiad s em(msn()trenxrcoytfpDeai i t  2umimpny1ap  mfei s)a2rmuronu0aexoif3iydla2uan ont0treomr oo1oa  anvi;( texmxm3oydlm nlnvilt  2ra(ro;o1aet mfetltfm2emu o t) renmr oydopD aies;s srtoimpio1oleelfvil()arum(rpno0oeeo fciytfmDem(ms;u0tlxoxr ia1lp ean s ( s2umio3iu1lle mfvi tf 2taumpou0oet mfctytfa eanmpnu4 lxoif oa1fm e nei s0trurxo3io1lleeliesltfarur( p;o1tpe mi3ils mDulu o;u)altrmo oydfaD aivi s srum(o3nudlle lfvt () Dumurp;t0oex mociytfa2ulu on(0 rxrxfcia1latr ies t)trtrxo3oy1ome  nei t srtr(ro;o0tpt if3iatlaDrlu s;u4artnxrctatoaDelnvi t0t2xrirpoy1alt licta(  2tm(  nt4opx iieiasfs uaumo;(4 exnio3oadlpD an ols0 2tm(r io4ll e fcta( arrmu  nu0oltnmoetlsfs rlu o u4 lenxfcoytoa eaneil()texoxmpiy1lltnlfvt s)a2rm(m nt4aeenif3tyd s2rlu p;u0texrxf3tadlmDrau s (  ruoim nu1lpt mfcil(farua(mpnu4aet mf3tasfm2rl( p (0tlxomr3iadomtrlueslt0trxoio3nu4oltnlfeia(f Drax ono4apenio3ils m2uluvs t0tlxoxf totopDr ivil()srtm(r3iu4altn fct s  2ta(rpot4tleo fctyd mDrmn s;u) exomrcoatomD  neo t0srxoir3oudolenlfcsl(  2uaum ;o4apx mfciasfmDumnmsnu4alenxf iytfa rauei t0s2um(r iy4amenmfei s) Dtmu o;u1tptnmfciad m ea(vpnu0trtrif tadopteli ol(0seumim nodamee neia(  Drm(r nt1tlx  iciydfsDeaumo ()trtnxr iatopD aneslt)teumiopou1ol nlncias)sDtax pou4tltnmfetad a2umnvs () rerxrcia1oat  n s;( tetrxm3no1lmenlfetas)srrr(monu0oleomoeiltfm el(ms;u4texrmf3oatfpt  u ilt tetrim3iydol  mneia( s2umu pot1oee mf3ilsfm2rm(vo t0 rtnmf3totlmteaiei;(  2xo(m oydoltn ieta(f 2urum nu4aeen f3iadfmDumums ()teenmf oatomtrau s;t t2um(mpiodaptnlnes s)aDtauront1tltn ieilt sDran p;t0 etomocoadlaDrlnesl( trurxrpoydll elnei () rta(r nu4olen fciadls ulnvo;t) rtrmf3totlmtr nvi;s0s2ur(o oudllenmivta()s2tmxr ot1tet mfeiltfa ra( p u) eermf3tytfa eluvo;t  rxoim iydlm  livtat)sDtrum oo4apto oeiys s2ua(vo t0 leoif ta1fp e nvi t0s2uriopnu4openlieiasfsrrau o;u0aleomf3iyd m eau o (4aetrmo ootlm ean o s)s2xmio3nydam nlics ()srtr(  nt0tpx if3ilsla ranvp;(4arxnircto1fpD lieslt)texoxr oydopee nvil( sDuauroot1teenii3iatfmDemu p;t4 rxnxf ootfptelivo ()s2xoxm3iu4lltemiesatfs2rmurp;o1altn f3iad s eln snu4texrirciadlmtr i o s0trxo(m ou1lleeliesls) Drrx  ou4tet io3iadlsDuaums u)aeenmr3iadomDe n i s  rxr(r3oo4op e ncs (f 2ua(moou4ale mociasfa2el(msnt) reriocoo1omtraivs;s t2trim io1oltnmiesa(  2taxmp;o1opxnmieiltfs2uluvo u0aexomo3ta1opD livo t0 2ur(rpoy4opeemnviasfa2umx p;o0openmi3ildfmDrauvpnt4aetnxrctytlp  livo s) eurxm3oo1optemivias)aDrm( poo4aetn ieiadlaDumuvs (4artrmf oytfm raivs s)seuo(r iudlltemiesa( a2umxr nu0oex mo3tlt aDelnvp (0aeeoif3tytlm  lnvi (0 2uo(r iy1lp n ivt s aDrm(m nt1tpx mf3iydla ea(vs;(0aexnmf oodlpt ai i;() 2to(r io4omenmncilsfsDtrur ;u4olenmfctld sDelnmo;t)arxomrciotlm  lu ilt) 2tmir oydaltnmfci () rururp;u4tetn ietyt s2rmu on(4 rtoio3tytomtr uvi ()s2umim3io1olenlicsl(f Drm(m ot0oetnmfeilslm2uauvs t4aeeomf3ia1oatraueols0srxo(m iudll  mivsas  rua(m ;o4altnmocilsfmDrmnmo;(4trtrif oadopDrln i t0trurim iodamt mnvil()a2ur(  nu0oltnif3tlt a2em(mo;(0 lxomf3to1lpte n slt t2tmimpnu1oltemnet s s2rax pot0aee iieiydfsDrmuvo (0 leoxr3iodfaDraneo s0t2uoio oy1op elnei ()a2ra(m ou0optn feiatla2uaumonu0 exnxrcootlmD an s t)t2urxopoy4lm elfviatfarrrx ono0olen fetlt a ra( o;u0alenmf oytlaDe uei t0t2tm(r3oydlle mfeiasfsrurxrpou1aee io3ilsla rl(vs;(0artrxociytlp elieslt)t2trio ou4ol nmiei (f rtrump;t0opt mfciltfa ranmp;t4artnxo oadoate n s s0srumir no4lme lfvia() 2rrx pou4opt mi3iltla2ulu o;t0teenxf3oytfpDeln s t0s2umir3io1al e nci t) 2rmxrpnt1apxn f3iad m2eln s () lxoxociotoat  uvs;t  exoxo oudlmee fes tf Dumxrpnu4oetnmieilt mDeanmp u)trtoxf3iytom eai i s s2uo(mpio4lm nmnvs tf 2trx  no4teenio3iydlm2ulnvpn(0trtrircty1lmtrln olt0sexrxm iy4llt  fesa()srtr(ro;o0oexo i3iadls rmu o;u) renxocoa1laDrlu o t) exoio iudope  ict s) 2um(m ou4tpen oeilt mDem(mo u4aexomr oy1fpDraivi s)sexmir3nu1omt lnvs t)s2umumont1alx ii3iatfs umumo (0arxoio3ia1lmDraivil() etmiopno1ol n icsas a2ur(  nu1tleoifeils m rln s;(4tlxrir todfate ivi s) rxrim3nu1ll emicil()a2rrx ont1tpeomfciysla eauvpnu)altnmoctatla   nes s t2tm(o3ny1apenmfesat) 2rru p;o4oeenmocilt m2elu sn(4alenxocoytomDraues t srxm(o3oo4ole livi (f rur(  ou4tptomi3tat s2um( p;(0aeenxrctydlptr i s s0t2uoxr3no1lmtnmfcilt) Dra(  nt0aet mo3ild aDem( o (4 etnif iodfmD livo (  eurir3oo1lm nlfes s) 2rmu o;t4olxoifetltfs ranvo;(4tetomr tytoaDrlu s s sexmir iydamtn fvias aDtmu pnt1apx ii3iltfsDea(mo;u0aetnmo oo1fptrlu i s0 2umxm3io1lleemicsat)sruaxm ;o0apt  octad a ranvsn(4tlerxrcoadoatrlu i t0 2xrxm iy1lpenmnctlt)s2rm(r ou1teeomoeiltfs emuvo t)tlerir3iatfpDr ivs t  2tmir oy1lpenmfvs tf rrmumo;u1olto oeiydlm uanvs;(4alxnxo3oatlpD aivsls0srtm(opny1amt lfcil( a2ua(rpnu0oltomocilt sDemu sn(4alenmfciodlpt aueo;s0 exoxm3oo4aptnmnesa() rumx pnt0tpxnioctltla elu p;u)tltnxf todoateauvo;t t2xm(opny1ap e ieslt)sDurumpou0tet if3tlsls2uluvont) ltrmo3tytlpDe i ol() ruoxm oy1lmee iei (  Dtaum ot0ape  i3tysfs2elnmpnu0trtriociodoa   i il(0s2urxrpnydamtnmicsat  2tmumpot0aet iieiad m uluvsn(0 etrio tydlp e iesls0s2uo(o3nydll elivi sf 2ra(mp;o0tet mfcias sDuaums t)alxnirciotlaDeai o;( seurirpiodlmen neils arur( ooo1ale iietldfmDra(vsnt4trxnxo3tydomDelu i;s) rxmiopnu4op nlieslt)sDrm(rpnt4tet mi3ildlsDuluvo;t0aetoifctatlmD  i i;t0tetmxm iodlmeeliet sf Dta( o;o4tee mfeiydfs umu s u) etrmocoatla rluvo t setoimpiudap  mfvtas)aDuauroou1aee moeiyslm el( o;()alxnxocoydom  lneils tetoir3ny1ol  mfvtltfs2urxrpot4aexnmi3iytls2rluvs;u0arerxrcty1fpD  ivilt0 rumxrpny4apeelfei t s2tm(m ou4tltniicils a2umn pnu0tltnircta1fpteanes;(0 eumxopiy4ol elici t) 2uaurp;u1aexnmoetytla ul(vo () reoiociy1fpteluvsl( teuoxopny1optnmfci ( sDumurpnu4texoio3iltla2rln p;t) rtrxf ootfpD  uesls)seuo(m nudopeelfcslt s2ra( ooo4ape  octas s rln s;() eerifctatom  anvi;t0 ruoxr3iydapt  fvtls srtmxmo;u1oeeomfetltfaDea( p t)teenioctytfpDrluvslt)trxoimpoo4llte fes t  rrrumpno1alt iociad s2uaums;u0artrircta1lat luei t)srum(o oo4am emfeta(fa2rru pou4oexoiociad aDuanmpn() leoxf3tatlm e n i t)srxmir3nudlpenmicils aDrm( o;t1oeen fciatlmDrluvp;t0aeenmr ty1fmteanvol( seto(m3ou4altnmnct t  Drm(  nt1optomi3iytfaDean o t4 ltoxf3oy1om rln o (  euo(o3oo1ale lnvia(farta(mooo4tlt  ociysfm ra(msnt4trxrmr ootlm   u o s)tetm(mpno4open fctls  2rrxrp;t4apxnmo3tysfaDulu o u)trtnxociydopDeli il(0s2trir oydom e fvi (  Dtm( ono4aex  fetytla uan p;t0tetriociadfa eanei ( seurimpno4ol emici tf 2rr(r nu1oexoif3ias m ua(mo;u0artnmfciotlaDraivs t)srurio nydapeemivsasf Drmu onu0aee  i3tltla2emnvo u4trxnxf to1lmDe ueol(  rumxrpiu4amen fctl( aDrmx p;u0opeo f3iadlm2elnvsnt) lxoxf oytlaD an i t)setm(rpou4aleelnvs s srurx  no4altoiociadfmDranmp;(4teenmrciytlate n s (0 2tmxm iudlm n ivt t s2ur( poo1teenioeiytlm uaumo u0aexrxf3oa1opDrliesls srtmxrpiy1openmfvsasfarumx pno0tpeomfeiad s ua(mpnt4trtnio oadfp rauvo;t  rurio oydlpe  fesa(f rrrum nu0aexomfciltfs2ua( p t4aeeomf oa1laD aivilt s2xrir io1altnmfeiltf 2umx  ou1tpx mf3iasla2ul( pn(0 rxomocoo1fa eanvs;s setoimpiodlptemfctatfsrtmurono0alx  feild aDumump;t)trermo3oydoatelivs;t)t2trxo io1om nlfesl(f Dtr(m no0oleoii3ilsfa2el(mo u4aetrir3iodoptelivolt s2tmio3oo1llt  fesat sDrm(m ot0oltnmoctlt aDrm(vp (4altrir tadfmDrluei ( sexr(m3iy4lm  lfct (fsrur(mpno1tptn ociatfa ua(mo;t)aexnmo3iytoa eaiei s  ruo(o3oy1am  livtas sDtax oot0alx ifeiytfsDuaumo t0aeeoir oodfpDeln slt0seto(m iu4lmte ivslt  Dra(mpnt4opt mf3ildla2rlu o;t0 rxnxr3iatfaDrlu s;(0 rtr(r ny4lpenmici ()a2rm(m ou4oee mfciys s ean p () etnmo3ta1fptr nvo t) rtrim3oydlm emivil(faruauront1tltomoetasfa um( s ()trtnxr iatla   u ols) 2uoio ny4oleelies s aDtau p;o1oet ifeiltla2rm(mp u0 lenxf3ta1lp   uvils0tetrxopnudom   nvi sfs2raxr ;o4optnmo3iytlmDelumo t) rtoifcoadlm r nei t0s2uo(o3io1apenmfviat aDur(m nt0tleo o3iat s rmnvs (4alxoxo3iadoat  nes;( t2xm(mpiudlle mfet s) rrrum ;t1tltoii3iytfsDem( o;u4tlerif iydfmD  nvs;(0 rumxo ou1lm  lfet s) Dumxm nt1tlxoif3tlsfmDea( sn(4aetomr oy1om  livsl( srum(mpoydlptn fcsa()sDtrum oo1opeomo3iys s em(vo t) rermfciodfaD  iei s)seuoxm3nydapenmnvs (fs2trx  ;u1tleo ieiydfa rln s;(4teermf3to1late ivi ()seto(r ou1olen nviat) Dtmxr ou0aee mi3tas a rlnvp t)tlerif oytlmt  ueils setrxr iodlpt  ivta(f rta(roou1olx iictlslmDua(mp t)aeermr3to1opt auei t setoir3iy4ape mfcta( sDuaxmp;t1tpen ietyd m2rl(ms;t4artoifciydlatrlivo;t) rtmio3oudlltnmfet () Dum(rp;u0tptomi3tls m2em(mo;(0 rxnmo3tadfat ai s ()teumxr3ou1apt liei tf 2rru ooo0oeeomfctlsla elnvsnt0tleoxrcoadlpDraivs ( s2xmimpiy4lm elietls)sDrmxr nt4olxo i3ildfm2um(vonu0alerxrciadfpD an s t  2xoxm3oydap e nvsa() 2tm(moot4tet ii3tld s rmnms u4trtomrcty1lp rau o;s0srtrxo3oodlpt  iesa()srrrurpoo4oetn oetadlsDumuvp;u4
\ No newline at end of file
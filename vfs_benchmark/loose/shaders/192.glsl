@@ -0,0 +1 @@
+n o;() eur(rpnu4omt micias)s2um(rpnt4oex  i3ilsfaDulumsnt0altrio oa1oat ln i (0seto(o oudomt mfeils  Draumont0tpto fetytfmDea( o;() lxrxrctodfpDeaiei;s)t2xr(opoudaltemnctltf 2tr( onu4apx moctatfs eau sn() exrxocio1op raivi (0srtm(m nodlm emfvias)sDtrxrp;u0tlenmi3tldfs2ranvo;t4tlerxo3ootlatr ueo;t t2xoimpoo4am e fcilt)arua(roou1tlenif3tls a2eauvont4 etoioctotlm r i olt0 2xo(r oudop elict t  2rr(ronu4aptn feiys sDem(vo u4 rtrxf iydlpte ieo;(0t2um(o no1ol e net ()a2raum ;o0oexnifetltls2rmnms t0aleoiocoydfaD ai i s0t2urim3ou4lptnlieil()a2trxro;t4alt mf3taslaDranvsn(0tlenxociadfmD  uvilt0srxmio iu1ape lfcilt sDtmxmo;u0tptomieias mDua(vs ()arerxr3ta1om   neolt)trurxmpnydale lnesl( sruaxrpoo1teeoifeiaslm rmnvp u)tlxrmrciydlp rln sl( truoirpiodlmt mietlt sDumumpou1openifetlt aDrlnvs u4aetrmf3iy1fpDraieolt trurxr no1apen fei s aDuaurp;o1aeen ociytfa2ua(vs (0 reoxr iydlat an i;t0srumxm iy4olenmfvt tf 2ua(rp;o0apeomieiadlsDulnms t4aleoxo totomte i il() rtmirpoydam  mncslt sDuaur oo1opx  fciltlm2raump;u4aexrxo3tadla  lnvils0srtoxr3iodomtelicta( srurx  ou0aeeoiociyt m uauvsn(0alxomocoytlp rlies t)srurirpoy4omenlnet tfsDua(r oo4aptnii3iadfm2uau s t0arerir3oo1fa  lnesls)srxoimpoy4al  mfctas  2ur(  ;u0tptn ieiyt aDelu sn(4 rtnmr3iotfa e ivil(  rtrxr3iudom nmfesl() 2ua( ooo1tltnmieiytfmDrm(vonu0 ltrxf to1oate n i;t)t2ur(r io1lp  lfci s)s2uau  ou1aptnioetltfmDumnvp;u4tltrir3iatop eln slt tetoiopou4lp n fviat) rrm(rooo1apto fctydls2em(vp t) rtrxr3tytfaD  i o ( s2uoim io4aleelfes t  Dtm(  ou1tpeo oeiaslsDeanvo (0trermfcoytla eauvi ()t2xmimpoudlmen nct tf Dtmurpno0tex  ocilsls2ulumo (4arxnxr3oy1laD  nes t t2toxo3io1op  mneilt)arururpoo1tpe if3ilt aDeau ont)trxnif oadlp eai slt  2uo(r iu1openmnvtas)a2rm( p;u4optnmictydls em(vpnt) lxnif3tytfat li o s0texrimpoo4lmtn nci ()a2rax poo0apenio3tlsls rlnmonu)teenmf ty1oaD liei t0s2tr(m3nydol n iesatf 2ua(r ;u1apxomoeils aDumnmo;t)teenmf3oy1oaD  u o;t  exmim3iy4al   ics ( sDtmx pnt0opto f3iytfaDrmn p u)trxnmocoo1fa rau s;t0sexrim nu1llt mneias  2raxrp;u1alx  o3iatla emums u) exrmfcoodlmDeluei ()trtoim ny1amtnmieiat  Drmur nu0aet mi3iaslm2ea(vs t)aetrxfciotomDraueilt0t2trim iu1omt mfcils) 2tax oot1tetomi3iydfs2ulumsnt4 eenxo ty1op   ues (0srtrxrpiu4al e nvi sf rta(r nu4ope mfeiyt a2rm(vpn() rxomr3iodopDrli sls)sexm(opiu4am   fviat sDrr(m oo4tleomfetadla rl(vs (4teeomf3tatom eanes s0 rxoxr ny1lm nlict s s2rmuro;o1oexoioeiad m rlnvs;t4 eeoxr io1la  li sl() euoimpnodlptn ieias a2tax  ot0oexnmoetysfm2umuvsnt0texnirctodoptrai ol(0 exrim oy4omee fet (fsrtmx p;u0tlxnmfetadlaDrlu s u4texnxr tadlaD ln i;s0 rtr(m3oy1lle micta(  2umu pnu0tlxnifciltfa2elnvs;t4aetnir3todom e ivsl(0truo(r3no1alen nei sfaDta(roou0oex ifeiysfm em( pn(0teenxo3iatom rau sls  2xmxrpny1ap  mfesa( s2ra(r ot0optnioeild a2rmump u0aexoxfcia1faD lnvi (0t2trxr iy1ol  mivtls sDumx  nu0oet ifctldfa el(vo u4 renxr3ty1oa eauvo s s2xoxopoodopeemivtas  Dumxr ;t1texoiociytls rmuvont4treoxociadfptrlnes s tetoxmpiydomee fei tf rrmuronu1optnioctydls uan p u0texoiociydlpD aivi;t  rxoxm3nydlmee neslsfaDrr(  no1opxo f3iltfs2umuvp;(4alenio3iytla  lnei s0 etrxmpno1ll   ivslt aDrr(  ;o1tle mi3iysfs2ua(mpnt4aexoxr3totomDeanvi s0sexo(mpno4olenmnvt ( srta( o;u0olx  o3ild aDrlums (4 etomocto1laDe nvs s0t2xmir ou1al  lnvsas aDumxr nt0aexoioctydla um(vpn(4 lxnmr tydlptrlieo ( s2umxo3nu1lp nlnesls)srumu  ;o0oeeo ociatlmDel( pnt0teerxr3oytlmt aieslt)sruoim iu1lm elnctl()aDtr(  nt0alto feiysfmDeaumonu)artrxfctytfa ran ils0setriopio4ale lncs s)s2rr(  ot4tetomf3iat m2umu ont4 rtriocoo1fm e nes;(  exrxmpoodomtelnctlt)s2trxrooo4tetn ociasfsDulu p u4trtrmo3oadopteaieils texo(mpoudop nmneslt)arrru p;u1aexo f3iys aDrmu pnu0alerxf3ia1lp   n s s  etoim ny4lltnmivi (fsDuax ooo1olt mociatls2um(mo (0texoxr tadoa e n ils)trumxr ou4lmtnmfes t a2uax oot0tlto ieiadfs um( p (4aleomfciydlpDeanvs ( trumir3iydopt miciasfarrr(m nt0opxnioetyt sDra( o (4trxomfcoadomD  iei;s  eumim io4om   fct t a2raur ou4tpt  ieiytla2emnvo t0tlxnmfctatom rlivo t  2trxr no1lpeemncsat)aruax o;u4tet moeiasfm2ranmsnu0tetrxo3iotfpDe uvols  2tr(m iudlpenlici (fa2urxr ;t0aee  oeild sDua(msn(4 ltnif3to1om ran ils0t2urio iy4lp  lici s)srtrumo;u1apxoifctydls2uauvo;t)tlxoir io1omD  uvsls)s2xoio io1alt mnvsas)a2raxmpno0olxn ictas aDrm(vp;(0tleoir oadla  auvo;(0trxmio3oy4lp emfes (  2tmxr no4aex iiciadfaDemu snu) ltrmo3iy1laD lu sl(0trtrxr oy1opt  ncias  Dum(mo;t4tetomoetls s emnmpnu0alxnxr oodoa elies t t2urxo3ny1opee nvta(fsrurur nu1tetomfeiyslaDem(msnu4tlxoif3oy1fp   n ol(  2xr(opoudop  mncsat)srtaum nt0opxnmi3tat aDulumo;t0aetnxf iodoa eln o s srtm(r3iydll nlivsltfs2urumo;o0tleomfeiyd s2emu o u)arerxrciadfmteau o t0 rxr(r3ny1lm   neil(fa2tm(mono0tleniicils s2rm( pnu4aeeomf3iodfatr nvol(  rum(m ny1lmte fvtas)sDrrxmpnu1tle mo3iytfa ea(vont4tlenxo3to1oa rlnvs s0 2urio3iu1alt  nvsl()artau  oo4apt  fctlsla2rl(mp t)trtomr to1faD ai sls0 2xm(o3ou4ole  fvt s srrrxmoot1tleomieiyd m2elumon(0arxrif3ty1oaDranes;t  rtmxo3iydap  mnetls) 2tax pnu1olxnioeilt mDrlnmo;t0alxnxf todfp eanvsls s2xoiopoy4olte nct t)sDua(mpno4aet  ietasla ulnvo t0 lxoxfcoo1faDr ivils0trurxo iodlptemnvt ( sDtmur ou4aleomfeiyt s umnvsn()aleomfcoadoaDe ueilt)trto(r oodal elivtl( s2ra(r no0aetn ociyslm eanmp;u) renxrctydlaD ln o;s s2umir3io1lm nlnctas)srumxmono1aeeo i3tadfa raums;u)trermf oo1fmt ai il(  2to(r iu4al elfeiat  2uau ono0alenio3ilsfa umn on(4 exnio3iodoatrlnes;t teum(rpiy1alt lics (fs2rau o;u0alen ieiadla ul(vs;() lxrxf3oydoa eanvi;t teurxrpio1am nlivi t  2rmu onu1olx mocildla uln o;t4trtoxf3oy1omteau slt0teumir3iudalt lieias sDrmurp;t0oexn oeiat m2raums;()tlxoxrcoodop   nvo;(0sruo(rpiydamtnlfvi s  rtr(rpoo4apxnmieiadfa2rl(vpnt4texoxr3ta1oa eluvi;(0srxm(rpou1om emnes s) Dtm(m ;u0oleo f3iys m2rmnvo () exrmf3oytlat aneilt0 2xmir3io1lpe mfeiltfsDurxrooo4alt io3iysfm2em(msn(4 etrxrcoydlmt anvo;t s2urxmpio4lp nlnvsat  2ua(mooo0aptniiciydfm2rmnmpnu)tleoxo ia1fpte ies;s trxoim3io4ol e fcs t)sDum(mpno0tptomoeiad m2rmuvo;t0tltrmocoodoaDeai i ( t2xr(r io4om n fcs tfaDrm(ronu1opto fciasfa ulums u0 lxnmr3ia1oat anvo;s tetrxopio1open ncsas aDuau ont0ale miciadlsDrauvo u4 etoxr3totlmt ai o ()srtm(m3oy1olt mfeilsfsrtm(root4alxoiicilsfa2rlnmsnt)treoxf3io1fmt  uesls  rxrir3iy4lp nlnesa(fs2urxrpoo4tpe io3iltlm ra( s;(0aexrio3iotopD  i i ( srtm(r oudapt mivia()s2rru pot4tet ii3ildfs ul(vsn(0treomfcoa1omD lies t0sexoim3nu4alt lfcs tf rum(r ou4ale iictasla2uan s;u4tetoioctytfmDrlivo ( setrxo3io4ap nlnvs s) Durumpnu1olx miciatfa raump t) etnmf totfptelnvi;s) 2um(o3oo1omeemivsas  rrau p;t0opt  ietadls2ua( pn(0texrio oy1om rln olt)trxm(o oudomenlfvslsfsrraur nu4tpt ii3tyslm rmuvp;u0arxnxo3oy1fp  livi;( srxrxm3oudlmee iesltf Dtaxm ;o4opxomf3ilsfa ulu snu0 ltomf3ty1lpDeli olt) rtoir3oodalt  fvslsf Drr(mp;u1alenmfeiyt s2eanvpnt) etnxr tydlmtraueilt0s2toirpno4lpe  fcsas s2uaxmpou4tleoii3iatfm uanmo;u4 rtoxr oo1lm rluvi;s  eumxo no4lm  lfesas a2rrxmooo4aptnioetld sDulnvp;t4alxoioctadfmt au i t sexmxrpoy4lm nlieias) Dra( onu0oeeomiciatlm uluvpn(4alxnio iadfpD  n sls)texm(m oo4opt  fetatfa2um(ro;o0tpxnmfeiyt s2ua(vont4aetnmr3oy1oat li s t) etmxo3iy4lle  fvilt  rraur ;o4oexnmfeiydfm elnmpnu4alxnxo todlp rliei;()t2xm(o io4ole mnvi s)a2um( pno1tee iietysfm elums t4 ltnxo totoaDe n slt0teumir3nu4optemies sfsDtmx oou1oet if3iys m2rmnvp;t0arxoir3iytlm  lieo;(  2umir oydlmeeliei s)sDtru onu4oee  ocilt s ulnvs;u4 rxrmr iotfmDrauvi;t0 2trio iu4lmeelict (  2um( pot0tleoio3tls m2eau p;(0tltnif ia1lmt aies;s)s2trxm nudop eliet t  2rrxm ot0tleo f3iys mDumu snt)artnmf iodoaDe uei s)setmxr oo4lme lnei s sDtru  ;u1apen fetytls umumo t0aetnxo to1oaD aivi t  exr(o3no1lp e iviat srrru oou4opeo oeias a umnms;(4 rtnmocoodlp rau ils t2xmxrpoo4opt micta()sDtmx  nt4apt ioctyslm2rluvo u)alxrxf3tytfa r u s;()teumxr3iu4omtelfetas) 2ra(mo;t4oleniieias s2eauvp;u) ltoxo3iytom  auvols)srurim ou4lp nmict tfa2umxm nu4texoio3tlsls2em(vsnt4 rxnmrciatfaDe ivo;s)s2umir3iydamt livsl(f Dur(rpoo1alenio3ilsfaDrlnvpnu0 rxrxo3ty1lm rauvs;s0texmim nydlme mivtlt  rra(mpot0aeto o3iyt m2eauvp;u4aleomr tydfp rlu s t0 rurir3iudamtn ietat  Draumont0tpenmoctltla rm(vo t4trtrirciotfa eaueilt0 etoirpno4om  liciltfaDtrx ooo1apxomiciydla2ra(mo u4teermo3oy1omDranei;t0setriopou4altemnvi tf rrm( pnt0ole mietasfa um( o (4 lxoxrcto1op r u i;(0 rxoxmpou1ope lnvsatfsDrax pnt4oex  f3tasfa2elnmsnt0texoxo3oo1laD  ieilt0s2trxr nydom  lncsltfsDumxm ;u0tleoiicildlm rmnvsn(4aetnxf iy1optrli ol( t2xoxrpoy1lme  fvtls  Dtmxmp;o4tetomoctydlm2rmu o;t0 rtnmo ia1fpDrai il(0 rxm(o oy1ale  fesa( sDumum ;o0optoifciyd a rm( s;(4arxnxrcia1fpDelneilt trtoirpoy1ol elfvt t) 2ua(  no0ole io3iydlm2uan snt) eenio tatfmDeanvil( t2urxrpiudll  liei (faDtmurp;t4tlto f3ilslm2ul(vs;u0tltriocoa1lmD  ieol() rtr(o iodap emici s  2ta(m ot4tpen ietadlsDrlnmp ()areoxr ty1fp  ln o;t)tetrxrpnudll emietl() Dta(  ;t4tltoiociytfs ulu s;u)tlxrxrcoytoat lueo;(0setrxo oo4lm emfvtas)arrruront4tlenmiciasls umn ont4aleoif3tytom ranvs;t0srxmxr3oy1lpe  feiat)sDtm(rooo0texo fctydlsDel(vs;()tetrmf3iydfateanvs ()trtrir oudomenmivt (faDuauro;o0optoio3iat m rlump (0 rtrxo tadfp r ies;s sexrxm nodaptemiesa(f 2uaurooo4olx  fctyt m emnvp;u0arenmf3iotlatelnvi s0 2xrir io1lptnlnvs tf rtax  ou0opeomoctytfa2rlnms;u4tlxnxf oadfmDelnvils t2trxo oudlptemfesltf rraur nt0tet ii3tldlmDuanms;u4texnxr3iatlaD aieo (0 2trimpiy1apte nctasfsDuax p;t0apenmieiltfs eluvpnt4teeoio iodoat livo ()trtmxmpnu4opeemfcsas aDrax  ;o4oleomociatlaDuln s;t4alxomociy1om rlnvo;s)t2xo(r3ny4ll   fct s s2tr(rp;o4ape mf3iad mDemu p (0aeeoif3ty1laDr neo s0 2xoim oudamtelnciatfa2taxrp;t0texn icils sDulu pnt4altnmf3ty1fatr iei s trxoxo oodomte nesa()a2um(  ;u0opxomietytfs ulu o (0 leniocoo1lp rlnvol(0trtrxopny4apenlivils sDum(mpot4olxnio3iaslmDrm(vsnu) reomr oodlatelu s;s trxr(o3ny1ll  mivsls a2ta(ronu0ale ii3tasls2rmuvsn(0trtrir3tydlp rli ols) 2xo(m oudopee ietas) rumxmp;o0ale miciyt mDea(vo t4alermrcoa1fate uvilt0tetm(m3oo1oltnlnvt () rtruront0openiictatlsDrmu s;t)trermo3oy1la e u ols s2xr(opoydom n fctl() 2umurp;o4texomf3iatls2eln o t)altomo3iadfat au i;s teto(mpio1oltnliei s)srrrur no4opeo f3iadfm2ea(ms (4 exnxr3ootoaD  i o (0 rumim ny1am  lncsat srrm( ont1teto i3ilslsDraums;t4trxnmr3iotlm e nvslt s2xmxmpnydopte nctas aDrm(mono1tetomoetad s uluvp;u0 rtrif3tadla eanvsl()seuoirpou1lleemncslsfsDtax o;t4aptn i3tasfsDrlu pn()tlenmrcio1fa  auei t)setrxmpnu1aleemiet t)s2umxmp;u0tle mieiat a2uluvon(4 eerxo tydop  li olt s2umiopno1lpen nvils aDtr(  oo4aet  feild m2emnmp;u0altoxfcty1fm rlu sl(0seurxr iy4ome  fcils)s2ua( pno4oetn o3tad a eau s;t4teenifciodla rlueil(0 rxrio3iu1lpe mivsl() 2trx  no1olx mf3ilsfs2rmump;u0trxrmo iatoa   u olt)t2xoxr3oudlpeelicsls) 2rauroou0tltomo3iltfm2emuvonu0tlxnmocoy1lpt anes (  rumir3ou1lpe mfei s  2ua(  nt0alxoioeiydla2umums () eermoctydopt ai s;( texoxrpoo1oleelfctlt) rraur nt4aexnmfctltfm rmnvp ()teeoio3to1opt  uvsls  2tmir nydap nmnctl( arumumo;t0aeeo feiysfs rm(vp u) etnif tatoat aivol( s2toxmpoodlpe  nvs sf rra(rp;u0oee if3tys aDrm(vs (0treoif3ootlpDe ueil(0 2tmimpiu4omtemneta()sDur(moot0tltn fcils a2ul(ms (0aexnxf3iotfpDr neol()tetrxr oy1om   nei () 2tmxm ;u4tlxn feiyt s em(vo (4 rtomo3oadlp r ues;s0t2toxrpoodomtelfvtls) rum(monu1teeo ieiadfmDulu p;(4alxnxo oatom   ivi t0t2trxm ny1om nlfeias sDrmxrpou1aetn iciadfa ulump t0 rxoxo3iotoa  au s t sexo(m3iudom e ics s a2tm(rpou1teen oeils a2rauvp;u4 rtoio iy1optrluvo;t sexr(o ny4apenmiciat)sDtaxmont4olxomictys mDeau p u)alerxoctydoatrlu sl() eur(m iu1olee fctltf 2tax pou0ape  octadfm2raums t)alxoif3ta1oa  livi () 2uo(o3oo4lptn ivil(f 2ra(  oo4oee if3iytls ran s;u)alxnif3ta1fpDe nvi;(0 euoxm3ou1lme mnetlt)a2tr(rp;o1oltnmiciadfs2rm( snu4 rtoircootomte iei;t)s2toio3no4alenliesltf Durxr ;o0apx  oeiatfm2rlu o;t0aetnmf oydfmteai ol(0teum(mpno4olt liet ( aDtr( ooo1ope ioetytls em( s () eeoxf iytlmt au i;t  rurxr oy4lpenlnctat)srrr(mooo0olenmf3iysfmDrln s;u)artrir tydlaD aiei;(  rtoxo iydoptnmncilsfaDtmx p;o1apeo ietldfm ua(msn(0 rxomrctydlp e i s ()truoxr3iydap e fviltfarra(mooo1opeoiiciyslm2em(mon(4 ltrifcio1lp   u i t0 2trio3ny1optemnvilt s2trxmp;o1tpto o3iatlaDea(vo;u)aexrxocoytom r ieo s0 rumim ny4aptnmfes sfaDra(rp;t0tlen ieiatla ul( on(0 rermocoa1laDeauvi t  rtoxr ou4optnlncs tfs2rmum ou0alx  i3iatla rmn o t)tleoxf tadlaDe ieil(0setmxr3no4apt mnvsat s2raxmoou4altomi3ildfsDrm(vo u4trtnmf3oydlp elivo (0t2tm(o oydapeemfeia(fsrumu ont4olx ioeiatfmDul( o t4 rerxr3ty1lpD  iesls  2to(rpiydam  lnvils aDtaurooo4alxoif3ilslaDuluvpnu4alxnmf3io1op  liei t0 rurxo ny1om  mics t  rurumpoo1optoiictadfs emu p;()trtoioctytlp rai o;()sexoirpiodalt lfetls srrrxroou1tleomoeias sDem( o u4arenirciadomt aueo;( trto(o3ny1lpenmfctltfarrau pno4olto fetyt s rlnmpnt0alenir3totlmte ivs;(  2umimpiudlp  mfei (f rra(moou0tpxomo3iltfs rl(mpnt0alxnmrctodlm ean o;s0t2umxmpiu4amtnmici sfa2tmxm ot4tleo f3tls a2ean sn(4artnmfcoytoa rau s;s  exm(r iydlp   fet tfsDuax pou4aptn i3ils sDel(vo ()trxrio3iytoaD aneo ()srtmxrpiy4op   fvtatfsDra( oou4texnifetyt a umnmp;u)trtrio3tydlatrln ils)seurxr3ou1lle lfvias  rumx ono1tetomieildfsDulums t4aleomocoydoptrluvs;(0t2uoio oudomtelfvi t  2rmurpou4apxn ictydlmDemnms t0aeeoxo3ty1fa e iesl() rtrio nodaptemfcsl()sDumump;t1optn oeiadlm2ra( p t4arxnxr3todfmte ivols0srtrim iu1al nlfvtlt)aDrrum ;o4aet ioetasfm2ua(vp (0alxnmr tadla   n o () exoxopiy4aptelivta()arrmx poo1oee ifetyt sDum( o;t) exoxf3ta1lp elues;t0s2xmio3oudlp  lfetls  Drrx o;o4oetomf3ilsfa eln p;t)trxomr ty1lm  livs t)sruoir3oo4lmtnlivslt  rrmxrpnt4tpto octas mDelu p;() rxnxr3io1fmt  uvi s) 2xrxr3nu1opt lfctlt  2tr(  ;o4tlenmociyt m umnmpnt0tetrxfcoydlaDeai i t) 2xoxr3oy1al nlfvt t s2rau o;t4olx ii3tad s2eanvpn(4tlenxf tydoateluvo s)teurxrpou1ol elfctl() Dua( pno0aptnio3ias a2elumsnu)tlerio ty1lp r uei ( sexr(mpiudal emnes s  rtmu o;t1teenmoetatlaDumnmonu0artomo oytfa eai o;(0 exm(m nydalenlfcsatfa2urxr ou1ale iietlsls2ulnvsn()alermf3oo1lmtrlu i (0 2um(m oodlmtn fciasfsrraxmpoo0tpeoif3ildlm ra( s;u4tleoio3tatlmDelueols texoxo3oodaptelictlt)s2rax p;t4aetomiciatls2ua( p;t4aexnmf3iydopt lnvs (  euoxr3io1lmen fvtl(fsrtm(monu0tpe mfciat aDrlumo t4texrifcta1fmDeln o;(0tetoirpiydoptnlnctas)sDum( onu4olxomieiys m2ran sn()tltoif io1lat an o t)t2xoxopiu4openmfct ()a2rmum ;o0teeo iciad m ea( s (4 lxoir3oydla eanvs (0trum(r3ny4om   nvt s  Duau p;o0oexomo3tytlm ra( s;t)trxoxf3tytlaDrlu il(0 exrirpou4ol elnvsa(farrmxmpot4tetoioeild sDranms u) exoxo3tytfa eanvo (0s2toim nu1apt  nvsltf Drmxmpno1apto i3taslm2emn s (4treomf3iytlaDraneol(0 2uoxo3oo1llt mfcia(  rtmx o;u1tet mf3ilsls2ua(msn(0 lerio io1fa  li i;s0 rxrir iy4omtemietas)sruaurpnu0oeeo fcias m rlnvsnt0artomf3io1fmteau sl() rto(o nydlpte nvsa() 2urx ont1oexn feiltlsDuan s (4treoio3oydopDeai s t s2tmxo oy1ole livslsfsDta(mp;o0teeoiicildla rl(ms;()arerxo ia1laDeluvi;( seum(r no1op  miesltf ruax onu1tpt iiciad aDem( o;t4tltoir3oytlpD an s;()srto(m no4op elieslt) 2tm(r ;u4aee mfciys m elnmo;t4 lenifctotomteai ilt0 rumxopnu1lltemnciat srtrxrp;u4alxn oetlslm2umums;u0texrif3oo1fp  livs s)texriopno1lptnmiesls artmxronu0aeeo f3iad mDul(vo u0treoxf oydomD ai s s0 etrimpio1alen icsas sDuau pot1alx  feild aDel(mon() exrxr iydopt  neo t  eum(rpnu4opee ncs s aDtr(ro;t1tpxo fciltfs2em(mp;t4 rxoio3oatopDe ivolt  rumim3iydop e neslt  rra(rpot1optoifciydfa emnmpn(4aetrxo3iodoptrlueslt seuoir3oudam  mfvi tfs2ur(m ;u0oexoiociatlm2ua(mo t0 rtomr3tatlm eluvi t) exmxo3ny1ameelneia() 2um(roou4aleomf3ils mDranmon(4arxnxo3iatfp  li olt)seuoimpnu4ll  lict t aruaumont1aex  ocils a umump u4 exrmf3oytoa e nvi t) exoio3ou4al n iet ( sDrrxr nt0tpxnifetls sDemnms t)trtnmr iydla e u o s0 2umxr3oo1llt  ics (f ruax ont0apto feiyt s2ranmsnt0tetnif3oo1omD li i;t s2tr(o3ou4lp  mfciasfarraum no0texn ieiydlm rm(vo;u4arxrifciydomt aivo s s2tmir ny4apee icsl()sDtrxmo;o1alenmoctat m rm(vs;u4 rerirciydopD  i il()t2xoxr ny4ap nlnvtlt  Dtm(  nu4tetn iciytfa rm(ms t4trxoxr3oy1op   u o ()setmxm ou1apt mivs t  rrmxmpot0tpenmfctyt a2ulnvsn(0 lxnmo3oydom   nvol(  2uoxopnu4ope  ivils sDtr(rp;u1olxnmoetysla2umump u0 lxrxo oytlptelneo t0texm(rpiy4ome  icilt) Dua(rpoo4oexoio3iadfs rl(von() exnif oadlaDr nvil() etr(mpoy4ol  mfvtl(faDtmu p;u4texo ociyslmDumu p;t0tltnif oadom eau i s0t2xo(m3oy1ole lnetlt)sDum(root4tpeomoctldla2rm(vp t) etnmr tydfmte uei;t trumim3oodale lfct t) Dtru  ;t1opx  o3ildfaDeluvo;t0aeeoxr iadoaDrlnvil()srto(opoodlm   ivtls)a2rm(  nt0tpeo ieiyd m2rauvsn(4trtrmr3oa1opteli s t  eum(r oodlm   neias)aDrru pnt0aptomoctysla ul(vp u)tltnxo ta1opD  nvsl(  rtmio ny1olee nvi ( srurum ;u4tleomi3iyslmDuan p (0 lxrxo3iatfp rlnes ()seurimpny1op emfvsa(f 2tmxr ;o1alxn i3iltfaDulu p;t0artnmr iytoaDeaivsl(0 rxoxr3oudal elfeiat)a2raur nu1alt moetasfm2ulnmo;t0aetrxf tadfaDelivs;() ruoxo oydlmenmfvsltfarrauro;u1alt ifetlsfsDemnmsnu)alerxr3tadlpD  i o s  rum(mpio4lpee fvt s) rrrxmp;t4opxnifciytfsDea( o;t4trtoxo iadom r nvol(0 2tmxm3iydlle mfvsltfs2rrur nu4alx  o3iysfm2umnvo u4 lxoxo ty1op rlueo;() rtr(r3nu4lm nmfvtat a2ra(rpou4aptoifcild s2ua(mo;t4 rtoioctytlat  ieol(0 rxr(o3ou1omt  netasf 2umu ono4opt iictlsfa rlnvp;t) etomrctatoptelnvsl(0teurir3iu1oltelictlt s2tru o;u4ole ifetlslm rau s () etrxo iatfm   uvi;t0setmxmpoydlm e fci ()a2rrx ont4altn o3tyt m2emnmp t0 etoxrciotlateln o;s0texrir oudalenlfesat sDrru  ot4oexo octysfs ulnms u4tltnxo3oa1lm   ieo;t srxm(o no4alt  nvil(fa2uau  ot4ale  i3tydfa ranmo t0 rtomocia1om raivi (0sruoiopiu4am   fesas  Dum(rono1tee moeiysfsDelu p (4tetnxfcty1lpDrlies s0 rxoxr iy1olee ieils)artrur nu0opx  icilsfm elnvpnt4teerxo io1op rauvi s0 euo(opoy4lme  ietlt s2tmum ;o1oetoii3tadlaDemnvsn(0 ltoxf iotoaDelnvi;() 2uoir oudomen ieia()a2ua(mont4oet mfeiltfsDranmpnu4aexoir3oydfmt lnes ( t2xo(m3no4altnlict sfs2rru p;t0tpxnifctlslm2ra(vs t0 leriocoo1oa rlnvi t) exrxmpnu4aleemicsat a2ua(m ou1tetnioetysfs2ulu p;t0trerir tydoa eauvi t  rtm(mpno1ape mnci ()aDurumoot1apen ieiadfm2em( p;t4altnmfctotop r uvols0t2xrxr3oydlltnmnvs s)artm(mpoo4tltnio3tys sDeln s;t4arxnifcoy1faDr n ils)t2tmir oo4optnmfvias)arta(  ;o4oee  o3iat aDran on()teeoif3tydop ean o;(0sexo(r ou1lmtnmict s s2umx  ot1alt io3ilt s2rl(mp;()trerif3iotfmtrlnvslt  rxoim ny1ll nlfes tfartax poo0tleo oeiysfa2em( ont0 exoio3oy1omDr u i t0t2trim oudol elnesasf 2taurpou0tlx iieiadfm2eauvsn() etomr iodfpte u o;()tetm(r io4opte ivi t)aDuaumont0olt  oeiatla el( p u)aexrircoatfm eauvs;( texmxm3ou1alte ieils) rraumpot0tlen feiyd s elu p u)teenif oydlp rli s s) euo(o ou4ll emfcsa()s2uru p;o1altoio3iydlm umu s (0 rxomf oodoate n slt0trto(m3iu1op nmivia()srta(ro;u0opx mietyt aDumn o (0 rxoiocoatomt auvs t0 rxmxo iodolee netltfaDurxmpot1oex  iciatfm ranmo;u0 leomf oy1lpDean s;t)t2toir3iu4olt mnvias)arurx ooo0tetniociyslmDrmuvs u0tlenir oodom   neol()setrir no1opte fvia()arrr( pnt1opeo icild sDea( ont4 lermocio1fmtrau s;()s2urxopnodamee iviasfsrrr(r no0tptomf3tlslaDran p (0teeomo3iodfpte ivs;s0s2umxmpoy1ope mnciltfsDrax pnt1opx  f3iydlmDea( s t4 rtnio iydomt aneo t srxrirpiy1am  mnvsltfs2rru pnu0tlen i3tyd m rl(vont)aeeoxf iatlatrau ilt texrxr3iudlptn feia()aDrrurpnu4oex mo3tldlmDemu p;u4 etoxr3oatla  aueo;s)texo(m3nudal nmicil(f 2raur oo4tlto ietysfm ra(vp u)trxnmr3iotfpteau sls0s2umxmpoy1om eliesa()sDta( pou4aeeoiiciys s2ua(mpnt4teeoir totlatrluvol( teur(rpny1lp nmicsas  ruax ont4altnmictys a umnvpnt4aleoif ta1lmtrlieo;(0 rurxmpoo1lptemneil( s2taurooo1aee mo3iytfm elnvsnu4 ltnirciydoa  li ol(0 2tmxr3oy1ameemnvt ( sDtr( ont1aetoiocias s2ulumsnu0altnxo3iotfm ranesls)texm(o io1amtnmictas srumuro;t1olt mieiad s ul( sn(4tlxnmo3oodlaDe ieils  exm(opny1apeemfetltfaDrmur ;u1tltoifciyslm uau p ()trxrmf iydlatrlu i;s  2xm(r3ny4apee ivi () rum( o;u1olt iicilt a eanvon(4 etrir3oo1lmte n slt) exrxopou1opt lici ( srtm(mp;u4oeto iciltlmDeauvp u) ltrxr ta1fmt an ol( t2ur(opoodlmenmnvilt  Drmurono0tlxoiiciadfs2uaumo (0trxoircta1lat  u ol( srxrirpiudlmenmivtat  2ta(mp;o4aet mfctltfsDua(mont0aetoxr todlm r nvs t0texrir3iu1op emfetat  Dtaurooo4tlen o3taslsDeaumonu0tltoifctodlp   nvs;s seuo(mpno1opee iesat)sDuaxm ;o1oetnmoeiaslm2emn o t4tlxnxfctydfm  luvol( t2tr(r nu1al  mnci ( aDrru poo0tlt  i3tat a ra(vp u4 rxnifcoo1lmDeli s t0sexoirpoy4om n fvsatfsDtmxro;o0alenii3tld mDra( s;t0 ltnxrctatop elneo t  eurxr3nydoltnlfei s  2ur(  oo0tex ii3iys a2uanvon() lxrmo io1optraieo ( tetoimpiodlmtnlfctlt  rrmx pot4oeeomoctat aDemuvo;() rtnmfctytfate uvolt s2toxopnodap e fctls aDrr( p;t1optnioctltls2ulnmp t4 rtnifcoo1fa   i o s s2ur(rpiu1alen nctls) rrrurooo4teeniocilsfaDel(vo;(0tlenif tatomtr i s;s0 eurio oodomen ivsa(  rta(r ;o0aex ifciatlaDrlnmo (4trxomr3iytlpt anvo t)truoimpiodllen fes ()aruax  oo4apx ioctad m rm(mo (0 etrxo ty1fa  anesls0s2xrir nu4oltelivtl(  Dumuroot0tlxomo3ils sDum(vo t0 eerxo oydoa eau olt0 rtrxo oudop emieiat) Dtrurpno4tee  fetasls ulu o;t4artnxrctotlatrlnes (0 ruo(r oy4om elicsa()sDra(r nu1oeenmi3tasls2em(vs;(0tltomo iy1fpt ln o;t sexoimpnudol nlnvtl(f 2trxrpnu0apeo iciyd s2uanms (0aeeoio3iydla eauei s) 2toxm oodll emneslsf Dtrxm ;u0tlxomi3tytls uluvp t4 etomo3iadop r iei;s0srxo(m ny4om nmfvsat)sDrm(  ;t4opx mf3tlt a2uan pnu4trxomr3ty1fmt  i o;()texmxopiy4aleemictlt) 2rmurpou4oet ii3tldls elump t4trenxr ia1lm eanvi;( tetoirpiy1lpt  fcs (f Dtmumoou1olxnmoetld s emnvpnt4 exomo3ia1om  ln o s)t2xmxm3oy4lme liviat)arua(m ou1oetn i3tlsfs2rln o u) lxoxr iadfa r n i s) 2umxm iy1lp elfetl(f rraxmont4optnmfeiaslm2ulump;u) rxrxrcoytopDr u o;t) 2xo(m iu1omtn fvs tfarurumoot1tptnmfeiys m em(vsnt) renmf3oytoate nesl(0 exrim3io1omtelfetasfsrrax  ot0tee  feildfm uauvpnt) exrmfctotfm elneo;( trtmir oo4ape lneilt) 2rrum no4aptn i3tadla uaumsnu4artrxo tydomDr nei t0trtoir iy4oleelfcs sf 2ra(ro;t4alt  fcils s2uan o;t)texnxr3todoptr uvi (0seurxo iy1lp n ncs t)aDtmxmo;o1opeomictysfm2eanvs;t) lenmociodom rai o;s0 rxm(o3nu1ap  lnei sf Dur( p;o1olenifeiat sDrl(vs;(0altnmr3oydfpD  nvs t  ruoxr3oy1ll emfesl( arumx oou0aex mfctltla eauvp (0alxrio ta1la ranei s)srurio3iydaptelnetltfaDta(  ;t4olx mieildlmDumumo ()trxrmr iatopte neil(0 rtm(o oudap elnvsasf 2um(m ;o4aptomf3tat mDea(vsnt0 rtnmf3tydfaD aneilt)tetm(m ny4amtemnesls sruaumooo4tlt  fetltls uan p;u0tlxoiocta1lm raieols)trtoirpnudlptnmfctlsfaDururo;u4oeen octldfm umnmp;(4 rtrmr ta1omDrauvo t  eumxo nudlle  ivt ( s2uax p;t4ale  f3iysls ra(vs t0 rxomrciodomt  ueils0tetmir3oo1lm nlfvs s)artm( poo4aleo oeiltfa ranms;t4 lxrif3todfpDeln sls)s2tmxr3io4op  liviltf 2tmxrpnu0alen fciysfa rluvonu4tetomf3totlpt auvs t0trxm(opiudap emnetas aDta(  oo4tlx iociasls2uanvp;u0tetnmo3iy1opDeauei;t  2umxo io4lp n ivias  Drmxr ;t4aleomfciltfs rl(msn(4 etrir oydlatelieslt0t2tmxm3iudapt mfesl()srtmxm oo0alx  o3iydlm2rmnmo;t4aexoxo3oadfp   u s;t s2trirpio4llenmfet ( sDurxr ;t0teeomictytls um(mp;t)aeeomr ta1lateai s s)sexo(o3ny1opee nvtlt) 2tax p;u4apx  o3ildlmDrlnvp;t)aetoxr oo1om elieo;() rumir oy4lp nlivi (fs2ur(rpnt4tlt  i3iat a rmnmsnu)areoxrctotfpDelnvi () 2xrimpiydllt lncilsfsDtmxmonu1tptomfciydlm ua( on()aetniocta1lateau o (0texrxr no1omenmfcilsfs2uaxront1tpxnii3iyslmDelums;u4texrxr3tydlmDeln slt  eur(m3oy1lptnmietl()s2uaum ;t1tet  i3iad m uluvs () lxoxf3to1omtraivsl(0 etm(o oydaptelics (fa2rax pou4teen o3tldfm ua(mp ()trxnxoctydlmD ln sls0 2xoirpou1oltelfcilt srra(ro;u4aetnif3tas a2rl(vs u0trenif iodfp rlu i t)tetrxm io1op n netl( artrxm nu4oeenif3iyd sDrauvo;u0altnxf oytoatrlivs s s2trxm ny4lp  lfetat  rum(  nu1oee ioctlsla2el(vs (0arenmrciytoaD aieo s)s2uo(o ou4opt  ict tf rumumoot4aleomoetas a2elnvp;t0 lxoxf3iotomt anvi s)s2xriopiu1om elfviatfarurur nu0aeeomo3tat sDrm(vs;()tlxnif tadfaD auvo t0teumio ou1am nmfet (f rraxm ;u1aee  feilslm ranms t4tlenir ty1fmtraues (  2xr(r oudomenmfetat a2rr(ront0oexomi3iasls rlnvo (4aetnxoctodopte nvs;s trxo(m3iy1olt mfct ()sDtrx ono0oltnmiciytlmDrmuvp u0tetrmr3tydfat lies;()srxrim3ny4am  mfvi s)a2ra(mpou1aptn oetys mDrm(monu)alerxf oodfm raies (0seum(m3ny4alee ivil(fsrrmump;u1aeeo fctlt s2ra( pnu0trerio oa1lp  aieo;()t2xoxm3nydlptnmicsatf 2trx poo4tlxo o3ilt s2ea( s (0tlxoiocoadfpte ivs ()sexrxr3oy1ll nlfetatfa2rmuront0open o3iat mDemnmp;t0altrmocoatoptr ies s0s2xmim3nydalenmfct tfaDtm( pno1texn i3iysla2el( p u)tlxrmf oadfmt  uvo;s)trtoim no4olee nctl(faDtr(rpnt0alt  fctatla2eluvpnu)teenmo oytomDelnvs () eurxr nudlpt  ncs s)artmum nt0oltomieiltlsDuluvo (4 reoio tatfp  anvolt) 2xmxr nydape mnes s  ruaumonu1texnmo3iyd mDumn p;t4 rtrmocta1fmDe u o t  2tmirpoudoleelici (fs2ta(rono1alxo ietltfaDra(vo;u) leomo oo1lmte n s t  rxoxopio1amenlfesasfaDtaxmoot0olenmf3tydls2em( p;()aexoxoctodop  aueo s)t2tm(m3nodol  lnesasfa2taxro;t4olt ifciaslm ea(ms u0trenxr3totom r n o;t) etrxrpno4lltnmfet sfaDtr(rp;o0oexn o3iasfa2elnmp u) exoifcoa1oateai i;()s2uoxm3oy1lmtnmivias  2tr(rooo1oetomo3tysls2ra(vs;(4artnxrcoadfm e uvi;(0 2urio iu1ale lfcslsfsrrr(  ot1ope ifeildfm ulnvo t)artnmf3tatlm  lieil(  2tr(mpoo4lme mfvia() rtm(ro;t4oleoif3ias sDea( p t)alxrmocootoa  lueo (0t2uoxo3iu1altn fei tfa2tmuroot0tltnioeiytfm2rl(vs u4tlenifcto1laDrauesl(  2xm(m oo4lptemnvias  2tmurpot4apto feiysfa2rmn pnu)tlxnmo3iy1lpt  ieols)s2umxr oydlpeelicta(f 2uaxr ;u0oltn f3iyslmDrl(vo;t4tetrir3oodfpD  ivs;t) rxoxr oo4lp e fvias) 2tm(rp;u0texo ieiltfa2rm(vont4 etrxfctodlpDrliei;( s2uo(m3iu4al elietas) Dumxmono4aexo i3ilslm2rmnmo;t)trxnxf todomtean i ()s2trim oudllte fvsls  Dtaur oo4opeo feildls2rmnmo u4texomf3todoptelivs t trxrio iodlmenmnci () 2uaxr ot1tpxn iciatlaDulu onu0tlxrmf3iytfateaiei t)seuoir3oydll nmfviatf ruax o;t0tpt mo3tytfm2ea(mont)alxrmr3tytla eln ol( s2urxm ou1ll n ivi () rtr(m ;u4aexn oeiltfs ra(ms;t)alenxfcoa1oatean ols)trxoxm3nudomee ivilt aDrm(mp;t4aeen oeiltfa2rm(vs;(4 leomr totfptr u i;t)t2uoirpny1ll n neils)srrm(rpoo0aetn i3iydlsDumuvp t) renio3oo1oaDr u i t s2umxm3iy4apte ivt t arurum nt0olxn i3tad m2elnvo t4 ltnxr oo1omt li ilt)texr(r3ny4oltn nesat  2tm(r ;t1alxomfeiydfa2umu o u0tlxnmr oo1om rlivols0tetmxo no4olee nctat arururont0oeeoifciyt sDrl(msnt4 etnxocio1fm   uvilt)srxrimpoy1lmtelnvslt)a2uaurpno1tlto octltfm uaums;t) lenxf tytoateluvsls0tetrir ou4ap  lfetlt)artrx p;t1aet ioetadfaDra(vsnu0areoxrctotlm rauvils)sruo(m3no4amt livsls srrmxrono1oltnmoctyt a uluvo;(0areoxr3todomDrau slt)t2urim nu1ap nlfes t) Dta( pot4olxnmoeilt aDrlump (4 exnxr oadlaDe n i;() 2ur(r3ou4oltn nvtat)artmumono4teeomieiydfs uauvon()arenmfctodlmt auvs s)srtrxrpny1amt lncil(  Dtm( oou4oet ifctltfs rln pn(4 exoir3iatlp ean s (0texoio3no4lpenmfviat)a2taur nu0oleoiociltfmDran o (4aeenmf3oadlmtr ueo;s0 rtoxm nu1apenmici s aDtr(m nt0aleoifeias s2ul(vo;t4tleomfcoo1lm e uvol() rtm(r3io4lpen nvsas) rtmxmp;t4oltoio3tasfs2emu o t0 etnif iydlmD anei t0trur(opiy4opeemfeilt  Drrum nt1aexomfeiltfa rl(monu4 etrxr io1fa e n s s0s2um(r3iydopt mneia()srurx p;o4opxoii3iad a2eanvo;t)artoxf3oadlmDeln i ( truo(mpio1ol emncias  2rmx p;u4oee moctysfm2emu pnu4altrirciydom rai ols0s2tmxopoo4lp e ietat sruru pno0olx  fciad a2rmn p (0alerxocty1fmDelnes s tetrir ny4apt mfci ( a2trxrp;u4olto i3iaslm rlnvp (0 exnio ootlp elnvs t0teto(opoo4apeelfvi ( sDra(r nt4tlxnif3ilt aDrl(mp (0trtrio3tatfmDraivi;(0setmxrpnu1amenlfctlt s2rmum ou4aexo f3iys mDel(vs;u)aetomo tatomD aivsl(0teto(o3nudom e ivtatfaDraur oo1apx iicild sDrlu pn()tltoio3iotfptr ivi ( s2urxm3iydol emneiat)srtax  ;o0alx if3iatfs rl(mo;()tlxnmo ty1fpteau o;(0s2to(o iydopeelfvt (  Dtm(r no0tpen ietadlmDumu o;u0tltoxr3to1lp r nes;( s2umimpoydale lnct tf ruau p;t0ape io3tysfsDuauvo;t0 leomocoa1fmDrln o;s0 2urir3iu4oltnlfvt t)a2rrurpot4tpeoiociytfaDrlnvs;t)aetomr3iatlptraivsl(0 eumxr iydllt lneslsfartr( pnt0teenio3tyt a uau onu0 lxrmocootfatrlu o ()tetm(r iu4ap  mfcil( srumu p;t4oeeoiietltlsDua(vs;u)alerxocia1op r n s;()sexmxm nudlmt lietltfaDrmu  nu4tlt mfciadlaDrm(mp t4 rxrxf3tytlpte ueo (0trxrxmpiydolen nvtatfsDtr(mpnu4olt mietydfaDrm(ms;t)aetrmrctydfpt lu s;()texoxm iu4lleelnet t  Dumur ;o4tlx  fctlsla2um(mo;t)alenmf iotlpt ln i;()sruoir oo1llen nesltf Dua(mpou0tex ii3ildla elnmpnu) eermr oa1fa eaies ( t2toim nu1apenlneias)srtr(r nu1aeeoifcilsfs ua(mp t)trtomfctadfat  iei t  exo(m oudamte nvsltfa2trxmp;o0oeeo ocilslm2emu s;() etrmr ootfpteli s () etoxm oydapenmfeils)sDta(  ;t4oeenmieilsfsDrluvs t)aexnxocoa1fa   nvi s srumio3nu1omeelfcs sfaDrrxmont0openiocils mDran ont0 rxomf iotfa eaieols) 2ur(mpnu1lpe mnvia(fsruaxmo;t1olx mi3tydfa2uaump;t)teerxoctodfmt lieolt)t2ur(m3oo4lm  lnei tfs2rr(  ;t4tlen o3ils m rmuvo (4tetnif3iadfat aueo;s0trxoimpoodame  ivsltf rtru ooo0tlxn icias m uanvo t4aleoxr3oo1fmteaues s) euoim3iy1lp e ivsa( sDur(rpoo1teeomi3tatla ulu p;u4 rxnmf3ootla  au i ()srum(rpiudllte ivi sfs2ur( pou4open ociytls2ea(mont)tlxnirciatfatrlivi;s0 rxr(m3oodamee ivtlt  ruaxmp;u1olenmo3iasfm um(mont)trerio3io1fmtrau i t t2uo(r3iy4amtemfcsls artaurpnu4alxo feils aDrmnmo;(0arerir3todop ran o t)s2uo(m nudal elfeil()sDumump;t4tex  f3ias a2ra(vo;t4 etrir oytlmteaneo;t)srumxo oydomtelnctat srumumonu4altnmfeiatfmDulnmp ()aeerio tadlmt auvi;t srtrxo iodap e ivsa(farrmu  ou0oexniietat m eaumo;t)treoir iodomDr n o;s  2uoxm ny1op  liesa(  rrmumpnu0opx  oeiltla2umnmo u0alxrxr iotfp  aieils0srurxo ny4ol nmnvi (faDumx p;u4oltoioeiyd m umuvsnu0tlxrxr3iatoaDr u o ( seumiopnydopenmnvsl(fs2umxrp;u0aee mo3tlt a2emuvon()tlxnif tatoa eai sl()t2xm(r3iodlm nmictat sDtaumo;t0aexn ociytfaDuau o u)aexoxf oydoa ranei t  eum(o io1ap nlies ()srraxmp;t1tleoifctytfmDumnvo;u4 reomf3oydlpDrlu sls0 rumxmpnodlp  lnvils a2taxro;t4aeenmf3ilt s ea(vp t0 etnmr3tytopD aivs;s)tetrim io4lleemies t aDtmx o;t0oee mfeilsfm uln s;u0aeerxrciydlpDr neo t)s2urio3nu1openlnesl( sDrm(  ;o0tpeoioctys a ulump;u) exoio3oadlm elieo ()s2trxo nydolt micsas) Draurp;u0oet  i3iadfaDrau p (4trtnif3iy1omDeai slt0tetrxmpoodape mfviltfsDtm( oou0tle io3tyd a uan p u)tltnmr iydop r ivo;t0t2um(m3oo4am e nctls aDrmxm ot1ale ioeiydfmDumnmpnu4 rtnif iy1oaDrlnvs s)trtmxr iudom   icias  2uau  ou4oex  f3ildfm um( pnt)alenmf ta1laDr nei (0texmxmpny1ameelneta()a2tau p;u4oetnmo3iatfmDulumsnt0 exrir oo1oa  lu o (0srtoio no4amtnmict s) rrr(r oo1tlxoii3iaslaDel(ms () exomociy1lm eln s t0texoxr oy4oleemnctl(fsrta(mpnt0tlx  f3ilsla ea(vp;u0texrxf oydfpt  n ol( sexmimpiu4am  mncsasf rururpno4apenio3ildfs el( o u4aeeoif iotfp rlneilt0trtoio iudlp nmiet sfs2raurpnu1texo feiydlmDelumo u0trtrir iadomDraiesls0 euoxr oo4ame miesas)s2trxro;t4tex mf3tld a2eau snt0altnifcoadfa eau o;s srto(opiy4optemiesasfsDrmu ono4aet  ieiysfm ra(ms;t)areomfcoatlmtelueslt0trxrxr nu4apeelivt sfs2ta(  no4aet iieildfs2ul(mo t0areomr oytopDr i slt0tetoir nodame mfcsls) Dtr(mo;u0alxoiiciyd mDulu p t0alerxo ta1lpDe n i ()srtr(rpiu4lpte nvt t)s2rmurp;u4aetnmoctadlm2rlnmp u0tetrmr3oa1om   neo;t)teuoio3nodlme lfvtl() rtr(r ot4aet  f3ils sDuau s u0 lxrif3iotoaD ai i;()t2tm(rpiydap nlfesas)artrxroot1tltnmoetydlm ua(vonu0aeermo oa1op  lues;(0 2xoxr iydol  mivta( aDrmx oou0opxniieiltfsDuln pn() lxomo oatopt  ivi (0s2tr(r nu1omte fci s a2urumo;t0oexomfctatlm2ua(vo;(4texoir to1optr uvil(0srtoim3iy1amt  ncsls)aDra(mpnu4opx if3iyd a ean on(0 eenxf3oy1la r i i;s) eto(m iu4lpee ivi s artmx oou4tlt mi3tltla2uln onu)aexrif tatfmt aieo t) etoio3nudlle mfvs s)a2rrx p;u0oeenmfciytlaDemnvo;() exoxo3oatlatr uvi s)trtmim3oy4om   netas  rraxmpoo0aeenii3iasfsDrau ont4arermo3oytfpteau ils trurimpiydlpte nvtasfsDuax ono1opeoioeiatfmDeaumonu0tlerir3oadoa  livils0t2uoio3no4lptemfvtat  2uru pnu0olxoii3iyt m2rmnms;(0aetrxfcio1laDran i;t t2toxr oo4al nlfvi t)a2rauro;u4oex if3ildlsDel( onu)alxrif3iydoa rlu s;(  rxo(opiu4apt  fes s  rumxmp;o0aee ioeils m2eau s u4tltomf oodoptelueo s) exoimpoo1olt lfvi (  rraxrooo0aexomi3iyd s rmu on() reomfciydom ranvsl(0 rtm(o3nodlleelncias aDraxro;t1apt ifeils s rlnms;() etnxf oy1fpte nvils setr(r3nudal nmfvi tfaDtrxmp;o4oee ifctldlm ra(vsnu) rxnmo iatopDrluvsls s2urir nodlm elnci s)s2umumo;t0opeo f3iysfaDuluvs () rermf oo1lat aivs;()s2xoiopiudolte nei sfaDur(  nt4tetoiiciyt aDum(mp;u4tleoifctydoatrli sl()trum(mpnydap nlneia() Duaumpnt1oeeoiietadfm2rluvs;u4tltrir tytopDr nvol(  exmxrpnodlptnlfcs s  rrax p;u1tptn fctltfaDul(vo t)altnmr3totfm  aivs;t0teuriopou1am elnvi s sDtaxr ou1oet iicildfm ulumsnu4teerxr iy1omDe uvo s trtoxopnydol e ict s  2tm( p;u1tltn octlt a elu p ()tleoifcoa1lm rauvs;()t2umirpiodoptnmiet ()sDtm(ro;u0oeto ocias mDea(ms;t0artnmo3iatlm rli i;t trumxo iodolte ivs () 2truro;t0opeomo3iysfs el(vp;u4aleoir iydfaD  n s s0 eurxrpiudamt lneiasfsDtrxrpnu4alxomfeiltlm2ea( snu0 rxrmfcoa1fpD luvs ()tetoxmpoo1op nmiviatf 2tr(  nu1oeeo o3iysls2ua( o ()arxoif3oatfp  au o;()srtmirpoo1am emictat)srur(rooo0olxoiociytla rln o u0 lxnxrctadoaDeaneolt)t2to(r3oo4ol  lfeilsfs2tmuro;t4olxnmieildfaDra(vsnt4 eenxf iytfmDran slt)trtmxo3io1ap  liviatfsDtax ooo0teeo ictysfa2rmump (0 rxrio3iydfaD anes t0setoxmpnodole  fvslt)sruax onu4oee  feilsfa2em(mo t)arermrctadlatean o;(0s2um(r3oy1open fesa( s2ua( poo4aet ioetydlm2uauvp t) etnmrctotlp rlnvo ()t2uoir3ou4lmtnlneslt)aDraur ou1aex miciytfs2ulu o u0trtomr ia1omteln i t0srxr(r oo4apenmnvta( srrm( p;u4tleniieiyt mDrm(vp;u4arxrxo iatfaD  u o;s  2uoxo3iu4ol e fei sf 2uaurpou0teeomfetlslm2rlnvpn(0 etoio oadlmDr neo s) rumiopou4lm n nei (f Dum(mp;o4oeen fciysfm ulu pnu)tltoxocta1oa   ues;t  2umir iy4lmtelfctlt) ruax pot0tetnioetlslmDea(mo (4aeermf io1om rli s (  rto(o ou4lmt mivil( aDur(r ou0tpxomieiadfa2umu o;t0altrxfcoodop r ues (0trum(m3nu1lptnlfetas)srrau  nu4alx  o3iadla ulumo;u0alermf oytfmD auei;( trtmio3oudop nlnvslt sDum(rp;o1tleomf3iatfmDra(mp;u0alxomo3ia1latelneo;( trxoxr nu1amtemneilt  2tmx  ;u0ape  iciadls2elnms;t4artnir3ty1fpDrluvilt0 rto(r ny1lm   ieiltfsrtrxmo;o0tpt  ieiad m2rlums;t4arxomociodfmDe nei (0 rtoxr3iu4ol  mfetl(fsDuaurono4tex ii3iytfa el(msnu)trxrmocoo1fp r uvols  rxoio3iy1ap  mfct ( aDuax  ot4tetoiociytfs2ra(mpnu) lerxr iydfateln o (0srxr(rpoy4olee ictls  2umumpnu4openmieild sDrlu s (0trermf3oytfpDrlivi;()t2xmxr3iu1lleemieil(fartax  ;u4tpx mietysfa el( s t4 eenxo oydlm  livi s0sexrim io1olt  icsatfs2umxr nt1optoiietltla umnvont0teerxr3iadla  anvo s  2um(m nodll  mfetas srrm(  oo0apeniicils a rluvs (4 rtnifciytfatrlnvs t) rumxmpnudlpt mivs t)sDrmurpno0opxn feiyt a2rau p (4 leomr3iydlp  luei;s0s2xm(rpoodoleeliesa( a2taxmpoo4tpx ii3iad a uaumo u0treomf iotfpteaues t0trum(m ou4ap elnctl() 2tmx oou4tetomi3iaslaDranvs (4alerioctotoatrauvolt)trur(mpiudaltnlicsls)s2rmx onu4openio3tasls2ul(vsnu)tltoxr3ia1lpt lnvi s0 rurir3no4llt livilt sDrm(rp;t4tex mi3iysls2emumsnu0 rxrifctatfpD lieo s  2tmirpoudol  mncsls a2rm( ono1texnmieiydfa2ea(ms u0tetnmf3to1fpD  uvslt0srxmxopiudap  lfvt sfsDtmx p;o0aeto f3iytla2rm( o;t)tetrmr oadla rln o;s0setoim io1lmte ivias) rumxront4tlt iietldfsDrmums;() ltrxo tytlmDraivils  rxriopoo4llt lietltfsrrmu pou1opxoioetydla rl( ont0arxnir tadoptranvo;()tetr(o iu4lme lfetl(fsDur(  no1altoifciat sDrmnmp (0artnmo3iodfmt  i s ()srxo(o3iu1om n ivsa()sDtmxr no1opt mi3tldlmDrmump (0areoif to1lmDelivs s0 etoxm3nudlm elivilsfarraxmono4optnmf3iyt mDumn o;() etoif3ty1lmDeauvi t0setoio nydopt lies tf ruax  ;u0alt mfeiytla uaumonu4altnmo oy1fmt aivi;s) rxm(o3iydal  mfetl(f 2um(  ;u0apx mfetlsls2ul(vp (0aetrmr3ootopt  ueol(0srtmio nodoltn ivt t)s2tr( ooo0aleomf3iydlmDumnvs;u) rtnmr tytom  aiei;s  ruoio3oy4am elfeias  2rmxmpnt1texnmi3tysfm rl(msn(4aeenxociytfa   nvo;(0 rtmir nu4apeemivt t  rumxrpoo0alt iociadlsDrm( snu0tetomf todlmDe uvs;t0srtm(r iydalte neslt aDrrxr nt1tpen iciltfm2ra(vp;u4trxnif iatomt  uvi ( setr(r oodlpe lnetas)sDrrur nt1alx ioeiytfm ea(vs u0 rtnif3oydfatraieilt trxrxopnu4oltemiesat)aDua(ront1aexn fctydlmDranvs ()altrif tydlaDeanvslt)trxrxm ou4amte icil( aDrmxmono4apxomi3ias a elu p;(4 etnmr3ootfmDeauesls  rxoio iu1ape  icilsfarra( pou1teto ocilt a2ra(mo (4areoxf iytoa ranei;() ruoxm3no1alenmnvias)srurxmpnt1opx mocias a2ua( pnt)texnir3tydoaDeauvi;(0trxmimpou1llenlfvi ( sDraxmo;t0aexn fciad a rau snt4aeeomf3to1omtr ueol()srxm(m3ny1lm e icia(fa2tr(r oo4oleomoeildfm2uau pn(4 exoifcoydop e ivo;s0t2tmir iu4lmtelnvil()srtmxmoot1alxn iciyt m2rauvonu) lenif tadfmDelneols0setoxm3oy1lp  lici s artaump;t1apt mfciadfm2rluvp t0trenio tatfaDranesl(0s2trxopny4openmietas a2tm(  nu1alx ifctltfa uanmo t) rxomf3iodoatr uvo;s t2trxrpno1omtnlietlt sDrrxmo;o4aex if3iatlaDuln pnu0 exnmo tadoat  ies;t)s2xo(m io1oltemfctasf Dtaxr ;o1olenmf3iad a2ea( s t) ltrio3tadfmDr nvs ( trtrim3no4om  lictas) rurur ;u4tleoio3tlt a ul(ms t) lxoiociytlpt luvi;s)texoxmpnu1lm nmivta( a2ra(rpot0aexomfeiysfs2el(ms;u4aexrxo3iotlaDr n o t0sexrxr nydolte fciat) Dtr(m ;u1apenmiciadfm2uau o u4 ltrmo3ty1opteai il()setoxm no1lle  ncs t) 2raxr nu1tleo o3ilsls2em(vo;t4tlxnxocty1oat aiei t srum(rpny4lm  lfvs s  2uaxrpot0tpe  feiydls rauvp (0 rxrmr oatlpDrli o (0 rxo(o3nu1altemivt (farum(r oo0tlxn fetas s2rmnvs ()aexrifcootfpteaneols t2uo(rpoy1apeemnctl(fs2tmur ;o4opxn oeils aDemnmsnu0 exrmoctadlatrlnvo;() rxm(o nu4olen ivs (fs2ra(  ot4opt  oeiatls2rmuvp;t4arxomo3iotomtrlieol(  2tm(rpnu1aptnlnvtls  rumu pnu4opeoiietydfmDeanvpn()tlxoiocia1laD  nesls0teurxo3nydalt mfesa() rta(rpoo0ape ioeiytfmDrl( o;()alxrmf3ia1la   ivols truoio3iy1altnmnci tfsruaumo;t4oetnmf3tlt aDrluvo;t)altrxrcio1laDeanvs;() etm(r3ny1amt mnciatfsDrau pnt1alxomiciltfmDrm(vo (0 rxrxf tadoatr ivo t  eumxo iodaltemncia(fsDtm(mpnu0oexo o3ild m2ul( s ()trtoif3totopDeau il( teumxo3iu4op   fviatf Draum ;t1ope ifciyd a2ua( p;u0trerxf3iodla rluvi s)srxrim3ny4ap nlfvi t) Dtaxmo;u4tle  i3ils aDuau p u)tetoir oatfa elivs;s)sruoxmpoy1apt mnvilt  rraxm ot1tlen f3tasfm rmuvs t4arxomrctatoa r neil( texrxopnu1am   feiltfarra( pou4apenio3iat sDuln s ()trtrxo oo1lptr u ols0tetmxopiy1ope mici t)arumxmo;t4optomoeiat m ranvs t) rtrxr3iotlpt anvi;( srtmxm oy4lmtnmfcil()aDtrump;o1olxn ietysfm2uauvs (4tlenio ia1fmt livi t)sexmxrpou1llee fei t artmu  oo4tlt mf3iatlm rmuvont4tltoif totoaDe ueo;s teum(rpno1ape mnvsl(  rumum nu1tlxn o3tatlmDulnmonu) lxoio3to1opte nvo;()trxrir ny1amen ivt t s2tm(r ot1texoii3iltlmDea(mp;(4tlerio3iotfpDr n i;()s2trxopiodoptnmnesas) Duaumo;o0teeomfetyd s emn s (4 rxnmr iy1oaDe uvi s)trtmxrpoodllt  fvs (f Dtm( p;o1olxo o3iasfaDrln o t0arxoirciydfate u o;() rtoxr3iu1ope  ivtl( s2umuronu0aptoiociadlsDumumpnt)tlenmr tytlmteaiesls)trtrir3nu1ol nlnesat a2um(r oo1oexoioetydla ul(vp;u4tetnxo ty1op raneo s0 rur(o3iu4lm nmnetat  rta(mp;u0opxnmfciadla2ul( on()tltnxr tadfatr n s;s0 exmxr oodolenlnviat s2rmx pou4tpen i3iltlm2uauvs t4 renif3tydop   uvol( texrio oodolenmfci t artaurp;t1ape mfctydfa um( p;t)trxnxf3tydlatranvi () 2uoio oo4altelies sf Dua( o;u1aexoifetydfsDelnvo u)tleomf oodfptean slt  rtr(m3oydope lfci tfsDra(r ;t0opxnio3tlsfaDran p () ltrir3oa1oaD lnvo;t0 ruo(o3nydap  lfeils)a2rm(ro;u1alt mo3tltfs emn o ()tlxrmo3iotfp ean s;t s2xrim3nu1lm elieiltfsDrr(ro;o4ape mictldfm2ul(vs;(0alenmocoa1fa r neil(0 2tmxmpio4olt  nvtls sDraum ;u0tptomo3ildlsDrm(vpnt)trtnxf ootlm  lnei;( s2toimpiu1lm  mici t srrax p;o1oleo ieils sDemn o;u0tlenxrctatfmt lieil(0sexmirpnudlle mncsl(farra(ro;u0alxn ieilsfmDrlu o ()aetoir ootfm r nesl() 2xm(o iu4lme lneilt s2trur no1open i3tad a rm(ms;t0tlenmfciatopt aieo;(  ruoiopoo4op   ivta(fa2tr( ono0tlxnmfcilsls2ul(msnt4tetrxrciadfmDrlu i;(0 2umxr no1ol nmfcia()sDum( ont0oleo octld aDrlu pn(4 exrxf3totop r ieilt teuo(o3oo1olenmivs sfs2umxmoot1tlx mfetldfaDeauvs (0aetnif3iotlmD lueolt0 2uo(o nydomt mfctls) rrmu  ou4tlenmieias s2emn o;t)arxomr tatoaDr nvil() 2tmxr nydopenmiei () rtau pot4oleoio3tasla ra(vsnt4trtnifciytfpDe ivil()teuo(r3oy4lmenlfci t)sDtmu pno1tpeoifeiytls2elu ont0aexnir3ia1fmtelu i;t0teurio ny1llen iei s sDtm(mpnt0aetoioetadfaDua(mo (0 lxniocta1oat  ivi (0srxo(opou4omtnmfvi s a2umur nt0olxo ieiltfa uan onu0altoxr oa1fm ranvs;t s2urxrpio4ape lfvi sf rtrxrp;u4tpxnifeiadlaDrm(vp;u0aexomo3oy1fp rln i;t s2to(r3ou4lleeliet s)aDrm(root1oeto feiat m ulumpnt4texoxo oy1fa eluvslt)t2urxo3no4oltelfci s sDra( oot1tpen oetatfa rluvp u4trxrmo3tytomDr ieol(0s2toxr oy1ll nmnvt sfa2tau o;t0apenmf3tatla emu pnt0arxnmr oytlp rauei;t0teurim nu1ame lnvtl() Dua( ooo0olx mfeiat m rm(mon(4trermf3ty1omtranvolt)srxoirpoodaltnmnet sf Durxm ou4tptnio3iytfsDeln s u4texnifcootop   nei;()t2uo(m3io1amenlncslt arua(rpnu4texnif3ilsfa2uaumsnu)altrxfcootfa   n ils0trxrxr nydop  lfeil( srrax ont1aetomieilt a rlnvo t4 etrmfcty1oaD an ol()texrxo iu1lmtnlncsltfarua(rp;u1oetomfeiaslm2emums t0tlenmfcty1lp eaieols)trxmxm3oy4om nlietasfa2umu oou4alxn iciad a rlnmp u) rtnif tydfpteluvs t0 2umirpoodopeemnciltfs2ra(rpnu4optoioeias a um( p;() rxnxf tydop rliei t0 exoxopiu4lm  livs s) Dtrur ;u1ape iieiadfa ua(ms t)alxoxo3oydfmDelnvo t0 2tmxr3iy1omtnlfesasfa2umx p;o4aex ioeiys s rmnmon() ltomr3to1op r nvils)s2tm(r3oy4ale mnvil() Drr(r oo4aleoifetatla2rmnmo;()arxnxoctatop rln i ()s2uo(opno4op n fvt ()sDrmxm ;o4tlenmociltfm ul(vo;u4aexoiocoatoa eauvols) 2tr(mpiy4lptnmivta(fsruaxmo;o1tle io3ias mDranvs u) ltrxociydopt anvol( teuo(o oydome  ivilt)aDta(  ;t1tpx ifctls a2rauvs (4alxnxociotlateli i;s)t2trxo3io4alen fetlt)sDuaur oo4aetoiietlslm ul( p;t4trtnxo3ia1laDrlivo;t)t2xoirpnodlpeemivslt)a2ua(ront0oltn ociytlm rau s t4alermf io1fa eln i;t  eurim io1lmte fctlt  Dumxro;t4teeoifciytfmDrmnvo;()trxrmo oydfateau i t s2toio iydoltn ies (fsrra(rpno4oltn ieilsfsDel( o u0trermo3ta1lp elies (0srurir iu4aptn nct tf 2tm(  no1alx mociysfa2elnvp t)aeerxo3ty1omtr nvslt)s2urxo3no1lp  lfeilt  rrru  oo0optoii3iytfsDrmn sn(0aetrxr ia1opD li i (0texo(o oydol e nvi t  Dtrxmo;u1openmoeiltlsDul(mo t4 lxnxf3ty1lmDe n i;()srtoxr3oy4ol eliet tf Draumpoo1tltoifeiys s2el(mpn(0aeenio3ta1oateanvo;(0s2uoxrpiydlltelncs sfsDrr(rpoo4opto oetltls2eauvo;(4areoxfctadoptrlnvo;s0trtrxopoodomee fvtatfa2uau pnt1alt  i3iyt s umnvo u4arenxr ootfa r nes s0 rtm(r iudom   ict sf rraxrpot1tetoiiciltfsDumnvont4 rtnmo iatfa  aueils0 etr(opoy4al nmfvs (f 2tau pnu0optnio3tasls2rmumsnu0 exrmo3oa1fpDrlivils trxmxr iy1omtn ncs t srurxmoou4tleo feils m2rmu ont4altnio3to1op r i il() etrxr iodamtn nesl(f 2umxm oo1oexn ietatfm eanvon(4trxnmf3oa1op raiei;t0texrir3nudlpt lfvta(fs2urxront0aleoii3iltfaDrmnmp t)trtnxo3ootlpDr ivsls)t2xo(mpio1ole miesl( srtmxrpnu1aeeniiciadlmDumn s;t) reomocta1lpDr ueils)trxm(o nydalt miesa()arrmurpno0alto ieiytls rmn snu4altrifcio1omDrln o;t  euoim ny1omt  net () 2urxmo;t4alen ieilsfa2rm(mp (0 lxnxr3ootomtr u s;t srurim3no4lme mfesls)a2rrxro;t0texnmiciltla2em(mp;t) exrxo3oa1opD  ivi t)t2xr(r oodllenlics ()sDur(r ;o0aeeniociasfaDuau o u0 leomo tytlpD  uvi (0t2umxrpno1ap e nesls  Dumxrooo4openmfcild mDrlumo t4 etoxrcoo1lmDr u s;( teurxrpiy4apen fei (fs2trxm no0tpxomo3iatfaDeluvpn(0altoif oodfp elieols0teuoir3io1ll n ictasfaDuax o;t0oex mo3iysfm2ul(vo ()trxomf3todoatrlivs t srxr(o iy4lme mieias a2urxmpot0tpt  octls a elnmpnt4tleomo todfpDelneo;t)s2umio iy1ll nmfvsa() rtau pot4aetnmf3ilt m el(ms;(0 rxoirctydoaD ai i;()trxoim nodlmt  icias aDtm(moot1oltn ieiyt mDeau snt)aexoifcia1fpDeau o s  exmxm nudom   ieiltfaDrrx  nu0alxomfciadls2ea( o u4aetoxr oatlaDranes;(  exmxo oo1aleemfetl(fartr(monu4aeenifeiltlaDem(ms t0 etnif3todfm ranei;( seurimpiy1amt lnesas)aDuaur oo4alxnif3iadfa2rauvsn() rermociy1oatelu o t)t2trir3io4opt lfvias  rtrxr ;o1olx mocilt a ua(vs u4trxrircto1op elnvi t) eur(opou1altn ieiat artaur nu1apenifcilsfa2rauvs;u4tltoxociydfaD anvo t)tetmxopiodom e fctatf rurur ;o0apen f3tasfaDua( on()alerxfciy1fp  an s t teum(opou4ope  fetas)aDrrxmpou4oleoifeiadfa2umuvsn()trerio iytoaD lnvo () exrir3iodole mfeiat)aDraxr nu4texoio3iyt m2rm(vs t) ltnir iatlmtrln i t) rur(o3oo4om e nes t)a2umurpou4texnmo3ildls umnvp;t0texoiociodomtrauvo;t)teurxm oodale  icil(fa2ta(r ;u4tlxo ocild s2el(vp (0 ltomr tydlmtraivil(  rtm(o3nudamen ies tfsrraxmono4alxo iciyd sDranvsnt)arermf3tytfatelneol(0s2umxm oudlm elnctatf 2rrum nt4tlxoii3tas s rl(vsnu)trerio oatoa   ieo;t)srurxr3iy4ol emneslt a2tr(rpno1tle ifeiaslsDrl(mo (0alenio todoa r neo t  2xmxopou4op nlicta(fsrrrxro;t1aet moetld sDuluvs u4tleoxocoa1omD  i o s0 ruoio3iu4ome mnciltfsDumumpnu4opto f3tyt m rm(mp;u0tlxrio totla r nvi;s0 2xmim oydlpe lncsltfsrtmxrp;t1aleo i3iytfs rlnvs;(0altnxo3iotoate ieo s t2xm(r iy1openmicsls)s2umump;t0ale iociydls2ean sn(4tleoio ootopteaneo t)t2tm(m ou4lmee netls  Drrumoou4oltomoetls a2umumon()trxnio3oadfmtraues t0seto(rpoudalenmfvil(fsrrruro;t1olx  ieiad m2uanmo () lxnir3iydom   ivslt0teumxo oudamtnlnesl(f Dumu ooo4tpenmietysfsDul( o t4 rxrifcoydlatr uvi;s t2trxo ny1amtnmivsls a2ta(r ;o1opx mietysfmDulumsnt0 exomrciatomDeluvsl()texoiopiy1om  lnvils  2ururpoo1apt  oetltlm2eluvsnu0arxomo todlpt aivi s truoxo oy1lmen ncslt)artru poo1oexoii3iaslm umu o (0altnmfciadfa raneols)s2um(m iu1amenmfctat  2tr(r ;o1aeeo f3iysla eanvp (0teermo oa1fm   uei;(0seurim3oy1lpte nvt ( srrr(monu1alt mocilsfs2rmn pnt)altoir3oytoatean i s0 2tmio3io1lmtemnvsasfaDtru p;u0tltn f3iat a um(mont) renif3tytlmDeanvo t0 etm(o3io4lptnmfcilt a2uauront1tpt mfciad s elu s (0aetnmf3iotlp r n i;t0srxm(m3oo4ol   fvtasfs2rr(mpoo0aexn oeilslaDrl(vs u)aexrif3tatfaD anvs s)trxm(m nydlmeemfes t)s2ua( p;o4tptomietlsls2ra(vo;(4tlenmr3iydfa eauvs;(0teumirpiudaltn nci tfs2ua( pou1aexnifetydfm2ra(vonu0alxnmr oadfpD  uesl()tetmxm3nydamtnmiei t)a2rrx o;u4apeo f3iatfm2rmu o (4 etrir tatoptrau il( tetmxopiu1lptn nvsls)s2rm(r ;t4aptnio3iatlsDeanvont0 rtrxo tadoa e u i;s)t2toxm oo1amt mfct t sDtrxrpnt1tpenmi3iltfmDra(vp;u0 exoxr3iadlp eaueo s0s2xrxr io4altemfvia(fsrurur ;u0opxn ietas mDemn o t0tlxnif iydfmtranei t trum(r3iydomt  fes sfs2rm(rono4oltomociyslmDul(msnt) exoxociatla   nvs (0setrxo nu4am   nvi t aDrr( ono1apx mfetyd a2rmuvs u0artoircoytlm rlnei (  eumxm iy1llt livi s a2rm(rpnu0tptoioctad s2el( pn(4 etomfciydopDeaivsls0texrxopiydllt livilsfsDua( oot1olxoiieiat m rmums (4artnirciatfmDrai i;t trtoimpio1llee ietlt srtrxmpnt4aex  fctyslaDelnmpnu0 exnmocty1fpD lies;(  2tm(o3io1lp elfetlt s2raurpnt0oltnmieiad s ul(mo;(4teermfciadlmDeaneo s s2xmimpnydoptelnctas sruaxrp;o0tpto i3tld m2rluvs;()alermr oytfa raieols srtoim nudllee ncils  2tmx poo0oltomieiydfsDemuvsn(0trtoir3oy1oa r neo t0 2xrxr ou1alt lictas)s2rauronu4apt  oeildlsDeauvo;u) lermfctytop eli s t  rum(mpoy1ome micsas) rurxr ou4oetnif3iytlm rluvo;u) ltoio3ootlaD ln o;(  2toxm3iu4ol   nciatf 2ta(mpoo1tlxnmfciytla2emu on()teerircoo1fpt ai i;t  exrxm nu4altnmiesas) 2rrumpnu1tpe  oeilsls rmnvs t4arxnifcootlmDeaivils)t2xoxopiudopenlnvs t)aDrmxm ou0tpt iicildfaDem(mp;t) rtrmf iotlm rau s t0srurxm ny4am  lici sfsDrmxrpnu1tlt  o3iytlm em(mp;(0artrmr iadlmD livsls) 2trxm oy4lmt  fesl()srua(m ot1oee mi3tydfs uau p;u0alermrcta1omtran s (  2xm(m ou1ame  ivtas a2ua(  nu1tpt iietadlm2elu s;t) eeomo3totfaDrau ols0s2trxopiu4lptnmfvtas)arrmumono0oeeomieiatlmDel(ms t4tetnir3oo1lmtr u i t0texoimpio1amen nvsas s2trxr ;o4apenmo3iaslaDuauvpnu)arermo3iadlaDeaneo ()s2xoxm3iudll emfesl(fa2rau pnt0oeeomieiyslsDran o t0texrmf3iotla rauvi s teur(m no4alenmnes ( aDtm(r ;t1tex mfeiysfs2ulnvs;u4tlenxfcootoa e n o;s seuoxr3oo1om  liesas)srurx oot0teen i3ildfs emu o;u0 exnmocia1lp e u s t0teum(mpnu1lptnlfcia(fs2tr(m ;u0tpxnmfciatla2em( p;u0 exnxo ta1fatrlieo;t) ruoxr iodllt mnvtat s2ua( p;u1tlx  iciatfm ul(mp (4trxoxr3tytfp r u ilt sruo(m io1oltemfvs t sDuaxr nu4tptomf3tasla eanms;(4 rxoio3oadoaD aivo t)teurim3oy1lpe livtat)s2ra(m nu0aexn iciyslm2ua( o u4tltrmf3iodfmDelneil() 2xoxr3oo4amtelnvia( a2raum no0olenio3tlt m2eauvs ()texrif iatoptr neils  eur(m ou4apte ncslsf Duauront4oet  fctyd s uan o;u)alxnxfcty1fmtr uvs ()s2xmirpnu4lptelnvt tf 2tmur ;o4tlxnmieildfa eanvsnu)tlxrifciodfptranvi;()sexmxr3nydll n ivt t a2tr(m oo1opxomiciasfm ea(vs (0 exrif iydfatrluvils  2toxopnydlme lnvs s)sDtmxrpno0oex iietld m uln pnu)teeoxf3io1opt aivil( truo(r oudome lnvils srrrx pnt0oeto oetys mDulnmo t) ltoxfciydomtraiei s seum(r iodlpe mictl(fs2ra(mooo0tleomfctaslm umnvpnt4tetnxf3iatopD anei (0 etoxopoudapeelnctl( aDtr(moot4tlxn f3tlt m2ra( o;t0aexnifcty1oatelivs (0teum(o iu1ap emnes sfartmur ;t1alto i3tlt m umu pnu4 etnircto1late neo t0setrim3io4lm elnctl(f rurxro;t1alen fetatls ua( s;t)aeenir3totlm rlnvo;s0 exm(opiy4aptnlnvs (fa2uaurpno0texnifetytlm rlnvsnt)trxrirciy1fp   neo;s0seumxopny1optelivslsfsDuau  ;o1tetoifeiadla2em(vsn(4 rxomf3oadlpt  n ols0texrxrpnu1al e fvsls  Duax  ;u1tpxnmi3tyd aDrmnvs;(4 reomfciatopDeaies;s0trxoxr3oydalt  nvias) 2rm( pno0tpen fctyt a rlums u)tlxrxr oa1omD  ies (0tetr(mpiu1lp nlieta( sruaxmonu0tetn octytfm rau o u0teeomo oydfptrai i t s2uoiopio1lp  lncs t) rrrx oot0olen i3iytlm2emnvp u4altnio iatfa eluvs;s)srxrirpno1lpeemiciltf 2ua( ono0ole io3iadlaDumnmon(0alxnxrcoy1lpD aueols s2xr(o3no4opt livsl( aDtax onu4ole  ieiydfsDra(ms;u4aetnxrciodlptelues;(  eur(o3iydaptelneilt)sDtru ono0aptnifetas a ulnmo t) renirciy1fatr n o;t)texmxmpiodapeelfeiatfsrtmx ont1tpe ifctad a2ul(vo;t0 rxomociy1fm  aivsls  rtmir3oodape lfcsas) 2ua(mont0ape iieiatlm2ea(von(0arenxf3oy1oatrln i (0 exmir3iudlp   netl() 2ra(ro;t0tleniiciyt a eln p;u0texnxoctatlpD an i;()trxo(rpoydlptn ics t)aDumxm ou4opxo ieiys sDel( s u4 exrxrcoytoa  auvs;s)s2xoirpou4am emfviltfaDtmx pot4tleoifeils s2rl( o;t4 rtnif3iytomte u i ( sexmxmpoydalt  ici (f 2tmxm ;u1aet ioeias s rm(mpnu4 ltnmf3ty1oatrlnes;s0tetrim3oydom  mivia(fs2trumpou1aeeo f3tas a rm(mo t0teeoir3ia1oaDeluei;s  2uo(rpiydamtn fcs ( s2rru oou4tle  f3tyd s2uan p t4altomr3iy1fmD  i i (0texr(opou1alt mnesasfsDurumo;u4tpe ifeias m2uan p;u)trxnxfctydfaDelueils0 2toimpou4ameemnctat a2ururont1tpx  ociyd s emu p u4 rxnio3ty1op  aivil(0 rumir3ou1omt lnvsl() rtaxmont1tpt mfeiadlmDeaumpn()trxnir3io1fp raies () 2toirpiu1lltnlicia( sDuau ont4oexn oetys sDel( s;u4 etoiocio1omte ieo t0s2xoxmpoodll elfei ( s2tm(ro;u0tet io3iysfs em( s;u0aetomr3oodlat  nei s0trurxo nodll   nviasfaDtr(moou1ole ioeiytfs uau p u)trtrmrciotop eaieol(0trxmiopiu4ape liesasfsDur(r ;t1aetnio3tld mDra(mo (0arxrio iatoat ai ol(0srxoxo3nudolen fvi ()sDrrum nt1apt if3iad aDuanmsnt0 ltrif3oo1om   n ol()seumir io1oleemfci ( srrm(m ;u1tpe  f3iydlsDemnmsn(4tleoif3oadfp rluesls  rum(r iudap emnci s  Drr( p;t0alxn o3iatlsDuau p (0 lxnio oatfmtrluesl(  rxrxo io1alte fes ( srumxmpnu0teeo icias mDra(vp;u0aexnxrctydoat an slt  rtr(r iu1ole  nvsas) 2uaurp;t1oexo f3ildfaDrm(ms;u)arxrmrctotopDrauvi;s  exoio3nu1ome miesl(fsrrrx  nt1oeeo fciys s2uau o;(0teeoir3oy1oa  auesls t2xo(r3no4apenmivil() Dtrx p;t4oeeomietysls2el( s t0 rerxo tatfpDr nvi s) 2xo(r3nu4ape mnetlt  Duau ont4altn octyd sDumuvp u4trxoxf iadfat auei;t  rxmiopiu1lle mnet tf Dtaur ;u0tetnio3iydlmDeln o;(4 ltrio3tydlmtr ieols  rxr(opno4ope lies s a2ur(mont0aetnmi3tlslaDelump t0 lerio3iydomtr u ils s2xm(r3iudam elnctat) Dtr( oot0oetnifetasfs2umums (4altrir totlpt lieo s sexr(m iy1ap nmietlt srrmur no4tpx ifciyslaDum( pn(4 rxoio3totfm  luvs;s) exmxopnu4ll nlivsl(fsrrm(rp;u0olt  o3iltfa ul(ms t)artnxr3ty1opt  u i s setrxmpou4ol elfcta()sDrrumpou0alx mo3iadlaDum(msnt0trtnxf tadomDelivs;s s2tmim no4olte nesa( aDta(m no4teeo feilt m emuvo t0aexrio3oydop  au o s) rtm(r3ny4am elnvsl(f 2tr(rooo1ope ifetat s2el(mp t4 renmr3todla ran o;s)s2xmirpiy1om emict ( arurxr ot1tlen o3iad a elnvp t0 lenxr oo1fpD anvi () ruoio iudomeelietatfaDum(  ;o0apx  i3iysls uan p t)tetomo todopt  nvo s) exriopiy4ame lnvs sfsDtr(mpot0apenifciyd mDulnmont4alerxo iytlmDrlnei;s seto(mpiydopt lneta()arur(rpno1olxoio3ild sDem(msnt4 etrxr oadlm e neo;s0teto(r3ny1lm nmietas)a2umxrp;o1tpxn o3iatfa eanvo t4aetnxociy1laDranvol() 2tmirpiy1op nlivil(f Dur( pou1tpeomi3ild s uluvs;u4 eenxo iy1fptrlnvslt0teuoxr oy4ap   neia() Durxmpno4ope  ieias a2ul(vp;u) etrxo3tydfm  au o;s) euoim iy1om n fvsl(f Dtau ooo1ope mfeias m2rl( p (0aeeomr3ta1oa  lnes s0s2toxm nodlp n neiat)sDrm(ro;u1tle micild s rmn o t4aexoirciotfp  lueo;s0srtoxm oo1opt  ivia(fsDrau pou0tlt mfeildlaDumnvo t0tltoxocoo1laD aivs s teurxr3iy1lm  lfetl(fsDtaxmooo4aeeomfeiyt a emums u4alenio3oytlmD  i il(0sruoxr3ou1lpeelnvi tf 2rr(rpou0oexoiocias mDrlnvpnu)aetoir iodlm  auvi () 2xrir ny4aptn ieilt aDuax pnu1aee mictlt mDua(mo t)teeomfcta1fm eaies t teum(m nodom nmiesls)arrrxro;o0alxo fciatlm um( snu0aeenmr3oa1latraies t) exoir oo1lptnmfvias)a2uaxrpoo4teeoifeilt mDrmn o u) exomfciodop e nvsl()srto(m3iudalen ivtls sDua( p;o0olenioctat a ulu s;t4 rerxr iytlaD  uvs;t0t2trim3no1lp e fvslt a2trum ;o1aeeoifetyt a um( pnu4arermfcoydlm   u il() 2trxo3iu1lpt lnesls)sDtmxmo;t0tpt  fctltlm ua( s;t)tlxrxf oatlp r u sl(  etmxmpoydol nlnvt s srrauronu0tleoii3tlsfsDem(vo t0 renio ootop e n s s) 2umim3ou4lm nlfviasfaDraxmpnu1oetnif3iyt s rlu p t0tltrio ta1la e i ols) 2xm(mpny4lltnmfct t) 2rmum ;t0oet iiciltlm2rm(vs;(0artrxr iadomDe ivsls)t2xo(r nodolt  fesls)arrrur ;u1olxo octatfs2uanmsnu4alxrxo3ta1lpD anvols)seum(opiu1om nlictl() Draumooo4tetomf3iltlmDrm(vsn()alerir3oa1fp eli o ()t2xmim iy4apt livtl( artru poo0opxnio3tltlaDem(mo (4aleomr3iy1om rluvi;t trxoxm oudame lnvt (  Dtm(ronu1opt  ociasfs2ul(mp;(0trxoxf3oatopD  i i (0setmxr3iu1ale mneiltf Drm(  nu1tetnmociyd s rl( o;()alerio3tydoaDraivo s srxo(r3iudale mnvi tf rumu poo4aex  ociat a2el(ms;(0 eenxr3tatla   nvols  ruoxo ou1ol n ieil( srumu  nu1tetnioetyslm2rlump u4tltnir3iy1om e ieslt teum(rpny4am elietas)aDtr(mo;o1tptnii3ilt mDuluvo (0 eenio3to1omDrluvols)srurim oudomenmivtasfsrurump;t4ope  fciaslm ranmsnu) reomfciy1oaD anvils)trxm(o3oydlmtnlnetas)aDrau ono0apeo iciyslsDelnmo u4aetnxo3oa1faD lu o t)texm(r oy4lltnmnesl() Durxrpou1oltn ieiydls ulnvpnu4tltomo3iytlm rln o;t0 rtoim iy4llenmfei t) 2umx o;u1ope mfeiadlmDrmuvo;u)trerir oodlm r neol(0tetmxr3nydamtemictl()s2tmumpnt1olxn iciad m2um( pnt0alxoio3iydom r uei s  2trirpoy1alte ieilt)sDur( pnu0tptoif3iadfmDeln o (4 lxrxf io1opDeluesl( teurxmpoudll   ictltfaDrru pnu1tpt mo3iaslmDelnmpn(4tltnxf io1fpDrai ol()srxm(m iydamee ncs t srur(rpot1tlxnif3tadls2eaumont)teeoio3oa1fpte u s;(0t2tmxr3iydolenlnvtas)aDumum ;u1tex iictlsfsDelu o t4 rtrmo iy1omDrlu o t setoxo ny1lleemnvsa(f 2tmx ont1apx  fciyslsDelu o;() lxrxfcoydoa eanei ()s2toxo iodamee ncsl(farrrx  nu1aee ioctltfsDrln o u)altrmf iotopDr u il( s2tmxopiydaltn fvta()s2urx ont4tpxnifciat m rau pn(0tlenmf oytfptr ivo (0sruoxo oy4am elnvtlt)artaxr ou1aptnioeiltfm2el(ms;(4 rtomo oo1oa ranvi;s0teuoio3iydll emneta()srtmxrpot4opx miciydlaDem( pn(0alxnir oa1op r nvo;()srtr(rpiu1opeemietat s2raxm nu4oltn o3tadfaDua(ms ()teerio3oy1oaDean ol(  eumir io1optelici t srum( pnu1tpt mo3tlt s raumsnt4arxoxfcty1omt ln o s0t2urio iy4omen nes ()srurxmoot4ape mo3iyd sDraumpnu)alxoio3tadlpDe u ilt)teto(opoo4al n fvt sfaDraxmonu0apxoii3iat aDuln p;t0alxoiocio1fat  ieo s0 2uoir3io4apenlfei t)srum(mono0teeomictad a2emuvo;()altoirciodopteln sl(0t2umxrpoy4lptelnetlt) Dtax  nu0texo icilsfs emuvpn(0aetnir3iadfp ean ilt0 2tmirpiu1ol   fcilt)sDrr(mo;u4tpeomf3tytlm eln p u4trtrmocoodlmDrln s;s0srtoir3oodom emivt t) rrrx poo4apxomfetlsla2em( o t) ltoiocoa1opteaneils0srtr(mpny1ll  lfvi s s2taumo;o1olenmfciltfaDelumsnu4texoir3oatlm raivsl()s2tmim no1ole mieias a2taxr no1tpe moeiat m uan sn(4treoio3iatfa elnvol(0teto(o3iu1lle mietas a2rmumont0olt  feiatfa ul(msnu0teenmocta1omt  uvols0 etoxmpio4lpenmfcs (  Drrx p;t0aet ioeiyd m eanms ()tetomrctatlptr uei;t0trxmxm oy4lp n iviasf Dta( o;t4opto fciadls2rlnmsn() lxriocoy1la elueo s0 rtmxopnu4lmenlics (f Dumumont0opxo o3ildla2rln o;u0tlxoxo ia1opteaues;( srxoir3iy4am emncsasf Dua(mpou0opt iocildfsDumnms;(4 lenxrcto1opDe ivs;()t2xrxm oo1ap   ici t)a2rmur ;o1aee mo3ilsfaDulnms t4 lxoifcia1la  ai o;s) rumim nu4olte feiasfaruaxrpoo4tltn ieiad m rmums;()altnifctadomtrln ol( sruoxrpio4ameelfei t)a2tr(  ot1aptomi3ildfm ulnmpnt0tlxrio iatfptrln i t) 2tmxm ou4om elnesls s2rrxmo;o4olxo oetltla raumsn()aexrirciytfatr u i;(  rum(m3iu1al nmfcslt) rum(mo;t0tlx iiciltla2ea(ms;u4teenmo tytopte i ils0seto(mpoo4lmtnlfvil(  Drm( oou1alxoifctydfaDrau o t0trerxrcto1fp eli o t  etoir ou1ameelivs (f Durumono1tlx  octltfsDea(vs;u) lenio3tadom  aieilt srxrxrpoo1om   fvs t) 2uauronu0apxoifeiyd a2ua( onu0arxrmo tatfptraivs;t0seumimpiodlltn fvtls s2rmxrpnu4openiicildlmDemnvonu4 exomo3ty1fa eln ol() 2urio ny1llte ictas)aDua(r ;t4tpto feilt s eau p;(0altoxo3iytfmt  ivo;s)seum(m ou4al elfvi t srtm( ooo1aleoioeiasla ua(vonu4alxoxr iydlm  aneolt srtm(opiydopeelieias)sDuaumpot1olxn oeiyslaDrmnvpnu)areomo to1fp eanvs t)texmxrpny4lp nlfcsls)sDrm(ronu4oex ii3iatfmDem(vs;t0 leoirctatfpDeaieols  eum(m3no4lltnmivi s) Duaxm ou0opxn i3iadfmDrlu s ()tltrif oatopt  n olt  2ur(m no1lptnmnetlt a2ta(roou1oltomfctydlmDeanvsnt0altrmocootlmteanvilt texo(o3oy4lp nmietlt srtmurpno0opeo o3tldls2ua(vs;(0aeermocty1omt livs;t) eum(o3oo1apee nvi t)sDua( ont0oetn i3ildlaDeauvp;() exrxo3tatlm  livi t)s2tr(opoudlmeemfvia() Dur( p;t0tltnmoctldlmDuluvs t) exnxr3oydoptrauvils0setrio no1lmeemnci s srtrum nt0tpeo fctltla uauvp t) renio3iodfpt an i;()s2xrim iu1lmt mnvs ( a2ra(rooo4ope  o3iat m2umnvo;u4teenif iadoat lneils)trtoiopiydape micsls)aDrru pnt1tpeomf3ildfaDea(vpnu)aetoio3oy1la   uvi ()texm(mpoo1lmenmncsls) rtm(ro;u0aeeomo3iytlaDelumpnt4trermocia1fpDe nvs s)trxoxr3ny1optemfes t  Dtm(  no0teto fetad m uanvonu)artnmf iodfpDr uei;() 2um(r3nu4ame lfvil(fs2um( ooo1tex mieiaslsDemnmo;()altnxr3oydoa  li sls0srxmxm oudamen ieilt sDra(mo;o1aeeomictytla uau p u0tlxrifcty1fmt  n i () 2xm(opou4lpte ivsasf 2ur(r no0ale  oeiltfaDumuvpnt)tltnmo ootoat ln s;s0 exo(o nydoltn neilt  rrau ono4alto f3iadfs eanmp;t0 lxnxr3oy1lptranei;s  ruoxo ny1lpenlnetltfa2tm( onu4open fciadls2eaumon(0arxrxociy1faD aiei t t2xm(m3oo4opeemfci (fsrtr( ont1olxoii3iydlmDuaums u)teeoiocoo1op rli o t)s2xr(m oy1amt  icsltf Dumxront4oleo o3ias s2emuvo;t4 eeoxrciotomtelivs (  rxr(m nydam nlicia( a2uau  ot1tleniiciytls rlnmp;t)arerxr3oodlmDrluvil( sexrxrpoy1olt mnvt s arta(rp;u1olx ifeiadlmDulnms;t0alenxocoo1laD livolt0t2ur(r3ny1ape lfvt t  Dumurp;t0aeeo feiyd a2rlump;(0tltrmfctadoaDeln o;t)srtm(rpnudame  ncia( sDtrxrpnu0aetniieilt s eanms t0tleoio3tydfpt auvslt t2toir3io4am elnet t) Dua(roou0tetoif3iltfa uanmsnu4altnmo3iodop e n ols  etrirpio4amt lfvi ( a2tmuronu4aet  octadfs uanms;t0teerifcootlptrlnvolt  rxrxr3nydlltn ies ()artmum ;u1oeeomo3tlt mDran onu)aetnmocto1la rln o t)trxr(r3ny1lptn ncta(f Dumxmp;o0opeomfetld mDua( o;()alxoif iadop e ivil(0srtmio ou4llt mneiatfa2uax p;o1teeniiciysfm rau s;t0altnxf3iy1lpDe ivs;t srxoxm oy4ame  nctlt  2rr(mpot0tlenioetlsfaDrl(vpnu0alxomfcoa1oa  aivilt)srtoxopoudlm e netas a2rmurpot1opeoiieiadfmDuln ont4 ltnmf todomtrln i;s)srxrxr no1lmte ivtlt)a2urxr ;t0oeeo octld sDranms u0 rtrxocoa1op elnvo;s  exm(m3oo4ome mncils aDtaxmo;o4altn fetadlaDra(mp;t)aexrmrctadomtraivsl(0 rtmimpoodapte iet tfarumxrpoo0aee mo3ias m2emnvonu)aetrmr oytlp elues;s0 rto(r nu1ape  ieta(f 2trx pnt4tpenmfeiyt m ran snu0tlerxf oytlmD lnvi;( tetm(m ny1ope lnesls)a2taxmp;t4alto i3iltla2ea( pn(4aexrmr3iy1fmD li o ( s2toxopno4amee ieia()sDurump;t4teto i3ils sDean s;u0areomo ta1op r n o ( seto(o3oo4altnlfeiat) rtr(mo;u1oexnmoeildlsDrmn p (0 lenxf3iodomt  ies s0 2toio3iy1lmen fcsl(f rtrx ooo4oexomoetad sDeanvont4 lerir3iy1fmDr n ol(0s2toim3nodam  mfcil()a2um(rp;o0alxnif3iadfsDrl(msnt)artnir oytla r ueo;s) etrio iu1omtnlfcia(f ruaumoou0aeen ociytlmDem( sn(0tlxrif oytfat an i s)srxo(r oy1olenmfcta(  2tmuro;o1tle  i3iydfa2emnmo ()arxriocoytlmDelu o;()trxr(r ou4ap  lfvils  2tm( o;t4ape iieiysfsDuanmo;(0 lermr to1op ean s;s t2toio oudapeelfvt ()s2raumpnu0tltnio3iat s um( sn(0arenmr oadfp eaiei s s2uoxmpoydom   iesa( sruaur ;u4teen oeilslaDea( snu) lxnxo3iytoaDr ivo;s0srtm(o3iy1amtn neiasfaDraxmo;u1olen fetatfm2uanmpnt)aetoiocia1laD liesls0 2tmimpoydlp nlfcs s a2uaxr ot0aexo fciasfmDemnvo u0 exomrctotlaD an ols0seur(r3iy4omt lfei ( s2tm(rp;t4alxo octysfs ra( o () lxoir3oadlptrlivo;s)teumim oydoptn nctl(fsDraxm ot4oexo i3tldfa2ua(msnt0alxnxo ia1lm eli s;t) 2xr(opiodllenlivsas)arurum ;o1olxomfciytlm2em( o;u4 etomfcia1oa eli o;s  2umxopnodlpeemfctatf 2um(m nu1tltoii3tyt m2umnms;t)aetoio tadlmtran i s)sruo(o oodam n nvs s) ruaxmont1aleomf3ildfmDemuvs;t)tlxnir3io1opDeai o s) 2xmxo3iudope  ivtas) Dtrx pnu1tet mfetat m2umn pn(4 lxomr3oodop ran sl( srtm(m iudoltemnct sf 2rr(rpoo4oleo i3tyd s2rmnvont)aexomrcto1fp elnes t0t2xoir3oy4ol nlncilsf rumum ot4oeto fcils sDelumpn(0aetrif3ia1la eli il(0t2uoxm3iy4olenmfvtlt  2rmx p;u0tlt  oeiltlaDem(mp;t4tlxrmr to1lat anes t)trxo(r3iudlptnmicslt)artmxrpnt0opxn i3tltfm2rl(vp;u) rxnmo3totoat  iei t) rur(opnydlpt  nvt t srtm(mpot4tptomiciyd sDem(vsn(0tltnifctodoaDelivs s t2xrxopnydolt mnesasfsDumxm ;o1tpt ioeiaslm ea(vpnt0areomf oodoaD aneils0 eurxo3oy4lptelfctls  2tm(m nu1apxnmo3tltfs rmu s ()aexomrcoadomDean i;(0 ruoxr3oy4omee iesa()aDrmx ont4apxo o3iysls uau o;u)tltoircto1fm eluvs (  2uo(m ou1optnlivias  2urxrp;u1aleomietysls2rlumpnt)trtrxr iotfm e nvils  ruriopoy1amtelivsasf rtmuroot0tpto i3iytlmDrm( s t4 leomocoytfmDeluesls t2umxopnodope mneil(f Dtmumo;u4opxn f3iysla eauvp;t0tetnxr iy1lmt  ueo (0trto(m io4lpt micilt) Drm(mp;o1opxo feildfm2eln snt4 reoxrcty1lpDe ivi () exrxr3nodlm  mieils)aDurxrpou0aptn i3iyd s ra( o;t4tetrirctadlaDr ivs;t t2um(r oo1alt miei s sDtm(r ;t1tpeoio3tasfa rl(von() rxnxocia1omt livs s)teto(o oy4ope  fcil()s2tau pou4tpx  ociyslsDel(vp ()trxomrcoadom eaivols) exm(r ou4olt  netasf 2rrxm ot4aptnioeiys a ea(mp u4 rxoxr3tydom elivi ( setrxm3ou1lmenmncil( sDuax pnt1teenmfeildfm2rln on(4tlxrxf3totlmtrli o t)setoir3nudal emfcslsfs2ua( pnt4opxomo3tadlmDemumsn(4aleomocto1oate nvi (  exm(o oy1lleemfetl()srrax  no1tpe  ietasfa2rlump;u) lxrif iydoaDr n slt0s2ur(r ny1olee icia()arumump;o4teen ieiltfa2umump t0aexoxfctotfpD auvs;s) rtoio3io4olenmfvta( aDrmu  ;o4tetoifciasfm2ea(mo u)tltrxf iytfptraneo ( trxoxm3io1ol n fvt t)aDur(m oo4tle ifctaslmDumu s (4 rxoiociy1optelivi;s0srurxo io4al n nesa()a2tmuro;u0oeen ieiatls rmnmo;u) exnmf iatfp   ueo;()sruoim iudale lfcsa() rraxrpno4aeen i3iysfm2eanmo t)arxrifcia1oatrau s;t  eurxrpiu4amtn ivsl(fa2raumo;u1alt  ociad m el(vp;t4 eenifcoadlmDr ieols)seumiopoy1alt  ici t a2um( pot4ape  o3ilt s emu p u0 renmfctatlp ran olt sruoxmpiydlptnmfeta(faDumumono1tpxnmfeiys s2rlumpnt) etrifcoodfatr uvi t0sexrxm oudlptemnctlt) 2trumoot0tpt ioeiltlsDua(vonu4 rtomr3oodlm  au o s0srurio nudlm nmiviasfs2ta(ro;u0apeomociatls el(vo t4 eenxr3oatla  aieol()t2tr(r nudlmtnlivilt) rrm( pot0tpxniietat s emuvp (0texnxfciydoat li o;t t2toir nodal e iesltfsDtr(  nu1texnmo3ilsla2rl(mp t)aleoiocoodopD aivol(0 exrxopoy4omenmnci sfsDtr( p;o1tle  f3iyd s2ulums;t0tlxrxo3oodfateaieo ()srxo(o oudlm   ivs tfaDrmxr nu1oetomoeiad a em(msn(4 exoirciadfat aieils0t2toxo3ou4olee icsa()sDtm(rp;u0altomietad a rmuvpnu) rxnir iatlm rau s t)sexo(r no4al n nesa(  2um(roou4alx  f3iltla2eauvp t4 rxnxocio1lpDeaueils  2tm(m iu4amtn nviatfs2um(mooo0oleoiiciys sDuanms (4 rxrxr tatop e u s;( t2xrio3ny4omtn ncsa(  rtmurpoo0ope mociatfa rm(mp u)arxrmr ootfa  auvs s)setrir3no1lmtnmfes (fsrta( pno0alt io3iasfa2um( p t0artomr3oy1omDeai il() 2trirpiudlm nmfcs (fa2trx  oo0opx  i3tyt a eanmo t4tetrio oadlmt li i (0texoxmpiydoptnmnvtas) rumur ;o1aet  icildlsDumn pn()treoxo3totfaDrlnei s0sexo(r3nu4oltemfes (fa2rru  ;t1tetoii3tlt mDua(vp;t0teerircootlp rlieo;s) 2toim3ny4ame livt s artmur ;u0tptniociadfa uan ont) rerxo oy1late u o s s2uoir3io1optnmfvsls)srtmuro;t0aee io3tydfa2eaumon(4aleoir iytom elivs;t trumxrpny1alt lfei ()artmx  nt0aeen f3iyslm2uanmo u) rtnmoctotoa eli ol(0teur(r oydaptnlncs tfa2tax  nt4apenmfeias m eaump;(4tetomo ia1laD auvo t0texmxm iu1optnlncs t) rum(mpno0oexoifeilslmDranvs u4aetnmfciotop   u s s t2uoxopiydlpee fes () rurumo;t1apto ociys m umumon()areoxociytfp  li i;s) exrxo oudam  licilsf rur(mooo0oltoif3iys m2rlnvp t0 lenmoctytfp eanvi;s) 2umxrpnodlpt mivi sf Dtrump;o1tpt ioeias mDranms;() lenif3iatlaD ai s t)setmimpou4lp e ict (farrax oot4tlenmiciltla elumo t4areoir3to1lpD  uvsl(0 rtr(m3oydol n ivsat  2tm( pno1oltoioeiasls2emn o t0 leoircoodopDeli s;t0sexoio3no4lpt mfes ( sDuaxronu0oexomoetltfsDumn s t)texoif3to1optelnesl()srum(r3iy4ll nlneilsf 2rm(rooo0alxnmieilt s2ea(mp u)aexrio3oydomD  nes t)seum(mpiy4omtelivil(farrm(mpou0tltniicilt s2ul(mo t0 eenxfcoa1fptr nvs;s0sruoim3nu4amen icil(faDur( ont0apxoii3ilsfs2rl(vs;(4 etnio io1lateln ols setoim3no4al n ivi s s2tm(m no1oleniiciadfmDeanvp t) lxnmoctadomDelneo ()s2tm(rpiodlmte ivi tfaDrmu  nt1aptoif3iat a2rlnmonu)aeerxfcoytfmD  nvi ()trtr(mpiodopt mnci t)a2rau p;u0optn f3iad aDeaump;t4areoxr oytfm   ueol( t2ur(r oo1oltemnvtas) rtr(m ;u0oeeo i3iysls rmumpnt4treoxf ootlatrai sls0 ruoxr iydomte feiatfs2rmurp;o1tptomf3tysfmDemnmp u)tetrmo3oadopteaieo s s2tmir ou4lltnlneil( aruaxro;t1tpx  iciatls rmu p u4 etrxfcoy1fa eln sls)seurim3nudomte ivtls)sDurur nt1tpt mieiyslsDulu s u0 eenmf3oadlp  au ols)t2trxr iu1op nmiviltfarrmumoou1aexnmociaslaDra(ms u4 ltrmfciy1fmD aues t0seto(r ny1llenlnvtl(fsrua(mo;t4tpenmoctydla ea(vpnu0 etoio tydfaD lneolt0t2toim nudlltn fviasfa2rmump;u1aeeo f3ildlm2rlnvp;u4 lxnxf iadlp e ivolt t2uoir nydalenlnctatf 2tmumoou1aleo icilsfa2rauvonu0arermo3oo1lpD liei;()seumiopou4amtnlfesl(  rrmxr oo0apenmieiytls2eluvp;u)tetnxr iadopD  uei;(  ruo(m3ou4omte iesl(  rra(mpot4texo iciasla2rm(vo u4teeomrcio1fmteln s (0 etrxr3oy4open iesas a2tau ono0apxomo3iaslmDrlnvs;u0 reoircio1fmD  nvo;(  2uriopiy1am nmfetlt)arrrxro;o1aee mo3iltfa emump (4areomf oo1fpDr u sls) 2xoxrpno4omenlncs t)sDrrx o;t1olxo iciytfsDrmnvsnu0aetnmr tydom   uesl(  2ur(r3ou1lp e ictat) rtax onu4altniocildfaDum(vp t0 rxrirciodoateluvslt)tetrxm3oy1oltnmfeil( aDra(rp;o4oexnmictlsfm2em(vs u0artrxf iatlpDe n sls) eumxmpiudlm elfctl( arurxmpnu0tltomi3iatfm umuvo u4artoxociodlmteluvs t srtr(r3oy1lp emnct s)s2urx o;t4tltnio3tldls2em( sn()texrircto1opDr n s;t) rtr(opoodopeelietasfa2uaxm ;t4aee mictyd s elnmp t0teerif3iotfmDranei s  ruoiopno4am e ietls)s2rru oou1apx ifctlsfm uluvo;(4tetomo iotlat aivo t0tetr(opoy4lltn fvs (fs2tmumo;t4aex if3tysfm umumsn()tlxnmo oy1oaDelnvolt0trxmim iu4llenlietls)s2rmxm ;o0alen i3iadls2uanms;() eerio3todfm   uvo;( s2tm(rpoodam  livils) rumu onu1opx  iciadlm2ul(vp u)altnif ootlm  an i;() ruoxo3iu1omt  ietl()aDtmur ;t1tpx ioeilsfs2ua(vsnt0teeoifciytfpD  nvo;t0s2tmxm3oodol  lneia(fa2ua(moot0alt mo3ild m2rmu pnt0texnxf to1lp eaueslt) 2xrxrpnodllt  nvia( srrmxmpno0oltoiieiys a ulnvsnt0trenio3ty1fmD  iesls) 2umxm3ny4lm  mict (f Dra(ro;u0alenii3iad s ea( o u4altnir3ty1omDr i ol()srxo(o3oy4ome mnvs (  Dtmx o;u0tex  ictldfm2emnvo u0 etrxr3tadfateauvs s s2xmim oy4omen ncs ()a2rm(  ;u4tpenmfciyd a umnvsnt0aetoxo todlmtelivs ( sruo(r3ny4op elnet sfarum(rpou1opxnmi3tldls2ul( ont4altrmo3tadfa r u o t) 2uoim iu4aptelfesl(  Dtax pnt1aex  octat m ulu s;u)areomo ia1oa   uvsl( s2uoxm nodlle lfvsas s2rmxm ot0tpenmietysfmDeluvo u)tetnmf tydomD  ueil(0s2toxr oudlme  ictlsfsrtrx ono1oltn ociad m2ua(mo (0 ltnir totopDr ueo () 2umxm3no1ll nliet ()a2tau pnt4ole iiciatla2umump u)tleomo ty1omtelneo s)trxmim3nudopenmivtls) Dtaumpoo0aet iiciys sDeanms;()aexrxrctydlpteanvil() rxmir3io1lp n ivtat  ruau ooo1oltnmo3iatlm2rlnmo (0texnmo iydomt luei;t0texmxrpiudll
\ No newline at end of file
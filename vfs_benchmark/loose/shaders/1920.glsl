@@ -0,0 +1 @@
+nes;t) rtrxmpiu1lpeemfvt tfaDtrxr nu0opxo i3tyt s2eau s () exomf3iodfm r uvils0teuo(r iydllt mfctlt)srrrxm no4oexomfciytlm umn s;(4 lxnxo3ta1faD ai s t)s2toir3oy1llenlictl()srtmxr ;t0tpen ocilt a2em(vo ()alxoircoadfm raueolt trtoiopoudlmt  netlt  Dtaxmooo1texn ociydfs2ua(vo t0trxrir3ootopD lu i t srtoimpoodome mivi (f rurxr oo4oexnio3tyt sDum(vo;t)arxoir iotop elueols t2xo(opoydlm elncsl()srra( onu4tpe mi3ild a2emnmo u0tlenmf to1fp  li o;()trumxrpoydap e nes t)artau ooo4tpen ociasfs el(ms (0tlxnif3iodoat lneo t)trxmimpio1ole mncslt) rra(r nt4oltomo3iatfs2rl(vsnu)trenmr tytlp r u s;( t2xm(o ou4am n nvias)artmumpno0tlx if3tydfa2emuvp u4trxomf oatlpt  ivs;( teuoxm oydapt mieil(fs2uaumpnt4texnifeiytfm rl( p;(0 eenircoadla  auvo;s0s2urio3iodamee nvtat) 2um(r no0tlt mf3ils mDrm(mpn()artnmr iotfmt li olt seuo(opny1alenlfviasfsDur( oou1alen oeiad m uluvp;(0 ltrmrcoytlaD  nvs;() rtoxopnodoltemfeiasfsruax  no4aptn fciasfa ul(ms;()aetrir3iatoa ean s s  rum(mpio1am  lict t)arurx  ;o0aeeoiicilt sDuau o;t0treomr todomt  uei t0 rur(mpio4olenlici sfarur( ont1aptnio3iyslsDulums;(0 rerxr oatoa elues t t2xoxm oudamenlnci s  Dta( onu0aptomi3tltlaDeauvsnu0trtoxr3to1lpDrln s;t)t2xr(opnu1omtelfvtlt)srrax  nt4oexomoeiysfaDul( s;t0arxoif3io1oaDrluei (0 2to(r oodalenlfvi tf rtrxmooo4aex mieiasla2ul(vs (4 lxrir3iy1fa ranei s  exoxo ny1apt lfviasfsDua(mo;o4ape moeils m ul( o (0texnmrctydfmtraivo;()sruoir3nudllt mivi sfsDra( oou4alx mictlsla2rl(vsnt)teermf iytfptr ueils0texr(r ou1open fcias artru o;o4aex mfetltfs ul(vo u0 lxrif3tydfpt livs;s truo(o nu4amt licsas  2umx pno4opxn iciad sDuln snt4tltniocoo1fmD aues ( s2to(o3nydol e ivs sf 2tmuronu4aexniociyt a rau o t)altnmo tytlm eli i;t0t2urirpiy4om nlnct ()aruau oot4tex io3iasfs raumo;u)aetnxo3iydlp rlneol(0t2urxrpiy4aptnlnetltf Drrxmo;o0oleoif3iad s2umnmo u4 ltoxo totfm  aneo;t) rxm(opou1lpe mivt () 2uaxm nu0alx  ictytlsDrl( p u4tlxnxr oadlmtrluesl( texrxr3nodllenlfetltfsDra(m nu0alxoiietasla umnvsnu0tleomr3todlaDr ivi;( truoim ny4op elncs s arumxroot4aee  f3iltla2rmums;t4tlxrmf3tytom  ai o;s0 etr(r oy1lp emncil()srumu pnt1optn fciaslmDrmuvp;()teeoxr3oytlm rli sls  2xmxrpoydll  lfvs s) Drrumont4aee  fcilsfm2uau o t0 rtrxocoy1fmte nvi ()trtoio3iy1lm emncs s  2urur ou4ole mietas s rlu ont) leoif tatopD ln s s)seuoir3oo1altemivt (fsrtau pou1tptoiietadfa rau s (4 lxoxf3tatopteai i s0texmiopnudaptelfvt s aDua(  ;u1apt moetydls rm( pnt0trtrif iytfaDeai sls  exm(rpoy1opt  netas)a2tmxrp;o0olx mfctat aDua( p t)artoxfcio1oat lnes s srumio3nu1ap e nvia()a2tau o;u4tlxomociadla rl(vs;u)arenxo3tatlaDe i s t)srtmio iy1apte ivs sfs2trxm oo1aptn feiatlmDua(von(4 lxoif3ootfat  nvo;()seumimpiu1amen fct sfsrraurp;u4opeo ieiatlmDum(msnt0teermo tytomteanvs;s srxoxrpnodomte fesa()aDtaxmoou1oexo feiatls2ranmo u0trxoxo iy1fa eluvslt0s2xrxrpoodom e ivias)arurur ot0tpxn octadls2umnmo u)tlerxo ia1fmte iei t0srtoir iydlm emneias  rtax p;o0apxnmoeilsfm2em(mp ()arxrif iytlmDrauvi;s0s2umir3oo1opt mfvs s)sDrrxm no0tpe mfetltlm ulump u)tlxoio iodlpD lneo;t)texr(o3oy4lpeemivia(fa2umx  oo0apxnif3iysfaDum( o u) renxr tydfateauvi t)texrxr3oudlm e fetltfsrurum nt0aexomi3tasla eln p;t0 etrxr oydop e ivols)s2urxr3iodale  nvia(f ruau o;u1oetoiiciydfa el( p u0tlxnifcoa1lpDrlues s  rtmxm3oo4ope miciat)aDtm(mp;o4opxnmo3iyslmDuau p ()treoxo tytoa rluvil()s2toio3iy1omee fvilsf 2um( p;u1teenmoetlsla2emu s u4aeenif oadfpDrluvs (  etoxr3io1lmtelfvslt s2uaumono1apto iciyt m ranmp u)artnxfcoatop  lnvs t) rxmir3ou4lmeemnes sfaDrrxmo;u4olxnmociydfm2rl( p;u4 rxnxr3oadfpte uvil(  rxo(o oy1oleemfcslt sDtr(mpoo1oee io3tytfa rl(mp u0 ltoxf io1lpte nvsls texr(mpoudlmtnmfei t) rtm( p;u0alxniieild mDem(msnu4aeeoxo3oytfatrlnvo ( trto(mpoy1am nmfeilt s2tm(r nt0ape  o3ildfsDea( o;u4 lxrmo3ta1opDelnvo;s0s2trir3iu4amt mfvslt) 2ur(mpnt1alxo octatfm2uln onu0 eermo iydfaDe ies;()sexmxr3ny1olenmneiasfa2rmx p;t4ope  f3tyt s2uanmo;(4 eeomrctytop elies;t)trtmirpio1lpt  nvi sfa2rmu oot1teto f3ilsfa2umnms;u)aeenmo3iatfp  au s s s2xm(r3nudam  lfetatfs2taurp;o1ale mfciytls2eanms;(0tlenif3iodfa elnvs;t)trtm(opnodlltemfei s sDtmu pnu4aleo o3ils sDelnvon(0aexrxo ia1fpDrliei s0trxoiopoo4ap nmfet tfaDuaxro;o4oetnmfetydfmDrmnvo u) lenxociy1fmDeaueo s0setm(mpno4alenlfetas)sDta(mooo0tet ifcias aDrl( o;(4aeenmfctotomtr uvslt0srxmir iodalte feta(  Dtm(roou0aee ifctasfa raumont)altrio iydlm  lieil(0truo(mpiudol e fvsl(fsDumumono1optomictat a eaumsn(0 leriociodfmDeli s t0trum(mpoo4amt  nesl(fs2rm(m oo4oexnifciadlaDumuvsn(4altnxo oadomD lieo (0t2xoxr oo4optnlnvtl(  ruaum no4aleo ictydfmDuaums u) exomr3oytla r u ils srtr(r oo4aleelicsa( artaur ot1tpeo fctyd aDrln o t0tltoio ootlp   ieols teuoxm3iy1optelfcta(faDrrxronu0aetomoeiasfa rm( o u4 rermfctytomt luvs (  rumimpoudameelfes sfartm(  nt1tleoioetydlm2el(mo t4 ltnmr tydfm e nvsl()sexm(r3oo4aptnmnesls) ruaxm nt4alen ociadfm2rln p;u4tltomo3iotoaDrauvi (0sexrimpnodlle mfet s aDuau  oo4tex  o3ildfm rau onu0aetnxf3totoa  ai s;(0s2toxo3ou4al n iesas aruau pot0oeeomo3ilt s rauvont4alxoxf3oa1lm rli o;s)t2ur(m3ou1om  mieil(faDua(ro;o4tet  ieiys a emn p (0 ltomf3tytlmDe uei;s0srurxrpnudaltn netls) 2uax  ;t0tlenii3iyt m2em( pn(4alxrir3tytla  ai s t0 ruoxo iy4amtelnetls aDua( pot4opx mietasfa2rm(vo ()altnirciydla r ivolt0s2uoir iy4lpenmfvtls)arrrxro;u4optnmi3ias s2eaums t0 etoxr3iadomtr i s s0 2xoio ou4ap  mnesa( aDtaumono0texoioetys m2ul(msn(0tetoiocootfmteli o s0srtrxr io1oltelnet s  Drmxmont0aetn iciad a2raums t4artniocoa1faD  ieils0seurxm iy1lpeelfcia(f ruaxr ;t1apxo fctatlm2rl(vp u0alxrxociotoptrlueslt0 2urirpiodlpe liet ()a2rmx pno1olxnmieiltfm ul(mp u0aleomfcio1lpDeanes;s sexmxr oo1ll nmivtlsfartaxmpnu4olxn ocild sDuanmp;(0trerxociytlat an i (0srxriopou4om elivil( s2taxront4aexn iciasfm2ra(vpnu) rtnio3iatop r uvi ( t2um(o nydopt lfcil() rtmxmono0apxnmfeils mDrlu p t0aleomo tadoptr uei;(0 rurim3ny4apee fvtasfaDrr(  ;o4openmf3tyt m2ra( p t4arxoxf iadfp   u o;s)t2trir3oo4ale mnesas aDta(  ;u1oeeo iciys s rmumonu0trtrxr totlpDeaivs;t texrxopnudop eliviatf Dra(r ot4tpxo feiyd m2rau pnu)arxrioctydlm r uvolt)trxoim3iudlme  ivt tfs2trurp;u4aptnmieiytlmDumnmsnu0teerif tatopDeanvilt  etoiopnydlptnlici ()a2rrx pou4altnifetldfsDeaums u)tlxrio iytomteaivi;()trumxm iu1lm  lfcia() Dua( pnu1tet mfcilsfm2ea(vsnu0aetnir ty1fm   n i;s seuoxopiu4om nlfci tfa2trump;u0texn f3tytfs rm( o;u)tltnmf ia1lpDr i s t) rurir iudlle lnvsa(  2tru oot4oleo o3ils mDra( s u4altomf ty1op rlieils) exriopiodlpenmicil()srtm(mpno1oexo ieiltfs um(monu)tetoxo3ta1fpteluvo s)trurim3nodlp  mfctas  Duru  ;t1oleoif3iatlsDumuvp;t)teenmfcoodlp e ivo;t0sexrxr3iodlpt  fet (  Dra( ooo1tle  ieiydls2rm(vsnt0trermr3ootlp   nvs;()srxrxopny4op nlfvia()sDrm(  nt0tee ioctytls2elumpn(4trtrxf3ia1laDranesls  2uoxo3nu1aptnmivi (fsDrau p;t1oltnioctysfm2rmnvpnu0trxrif3tatfm e ivols t2xrim ou1lp n nvsat  rumx ooo0opeo o3ild a ra(ms;t4 rxnxfcoytoa raueo;s)setmir3iodlmtnmfeiat)aDtax oot4open ieildfm2eau snu0treoir3totlatelnes;(  rxmxo3iy1alen iesls sDrm( pot0apx iicildfmDrl( o;()treomf3iatomtranes;()srtrxr3nu1lmee nvsat artm( p;t1oetnmictadfs2elumpnu0treoircio1lpDr uvi s sruo(r oydlm n nes ()s2ur( pou0tetoioeiyt a2rlums u4 rtrio3iodopDr ivi s setoirpiodale lfesl(f rtmumont0tet if3ildlm2rl(vo;()trxnir iotla eaivil()setoxr iodam  mfvil(f rtr( oot1tpt  f3tadlmDrlu p (0treomrciodlm e ueo;s)seuoxmpiodap elfcs (fa2rmxmp;u4alto iciltfm el(vp;(0 lxnio io1fpDr u o s  eto(o nudolee ictls artrumoou1oetn fctasfmDuan snu4aexnxr3tydfmtrlnes;s0trxrir nu1lmenmncs ( arumu oot4ope  fetyd a eau s t4tlxoifcoodfat lu i s) 2tr(rpoo4apt lfesa(f Drr( p;u1tle mfetltla umn s;u4tltnxo tytoptran o;s  exr(o3oo4ap  lnvi ()artaurpou1oleomieiys m2ranmonu4arxomo ty1fa  lnvi ()teumxr nu1lpe  ivilt)srrr(mpno0oex moetls m elnvp u4tltnif tytlp eai o t0s2xoxmpiy4lm e fcs ( arra(  ;u0tpen feiytls uan pn() rxnirctadfpDe ues;s)t2xoxopoy4lp nmivsl( s2tmxmooo0oexoii3iadlmDuluvs t4tlxoxo3oa1lptrauvs;t0s2uo(rpno4lle lnct t)artr( o;o1aexomfeiad s2rmumo;t4alxrifctodfate nvs;(0t2toxr ny1omen nvi ( aDum( ooo0oexn o3ils a rluvs;(4tetnmf3oa1oa eai s;t srxrxr3iodomeemncslt  Drru  nu0oexnifciydfs2rmnvp t0artrmr ta1lm  li o s) eum(o3iy4lp  mfci s) rta(  ;u0aleoifeilt mDuau pnu) rxrxo ia1optrln sl() rxo(mpoy4lm nlfet ( sDta(  ot1oleomoeiyd m2umuvs;t0 rxnmocoy1fm rai s t0 exoxo3oo4llee icsatfs2rau ont1optnioeiltlmDemn ont4trerir oatfaD  uvolt)srtmim nudop nlivia() ruax pou4oexnioeiat aDeau pnu)tlerirciy1laDrlnvi;s  2urxrpiy1lptelicsas)srrm(moot1apxoifeildfs2em(vpnt0aleomrcio1oa r ivols0teumxo nodamt mivilt)s2ua( ono0texnmfeiatfs ea(mp t0trxoif todfp  livi (0s2xmimpou4amt  nvslt a2tr(ro;t1aeeomfetyslm ulnvo;u) lxrxo iy1fp eliei;s0 2ur(rpou1amenmfeilt arra(  ;o0tpx mieildfm ulu pnt4tltomf tydfmt auei t) 2tr(m nudamtemieia() Drr(r ;u4teenmf3iyd m2rau ont0arxrirciotom ean o;s) 2umio3iy4amt lictas srua(  ;u4tpt mociasla emums;t)texnmo3to1laDeauvs;s)sruoxo3oodlme micias)sDurxm ;t4tpto iciltlsDulump;u0arxnxfcoa1lmt anvsls0 2xoiopoodap elfvt (faDum(rpno4altn fciad aDrmu pn(4altrxfcoa1fmD  nei s)sexoxo iodome  nes s)arrmum ;u4tptniiciydla2rlu s u0 rtoio3iydfpDr ivo;()trtoiopnu4olee fvt tfarua( o;u1alxoioctatfa rl( pn(4arenxf3ta1lpDrln sls teuo(m3oodllt mfvsat) 2rrxrp;o0teeoif3tad s2emnmpn(0 rtoxf3oa1fp rluvols srurxrpiu1ll n nesat) Dtr(m ;u0oeeoii3tatlmDulu snu4trtrxo iodlpDrauei;s)s2tmxm iy4apeemnvs sfs2urx pou4aexoif3tytfa2uln o;u)aetoxrcty1fmtrlivo;(  2urim3oy1lm emnvs tfarur(ro;t4opxoiiciydlm2rmnvo;u)texnir tydfpDrlies;t)texmxo ny1omt lnct (f 2rrxrpot4oeen ocilslmDeauvp;u4tltoxr ta1oa  anvslt)srtmxrpoo1ol  mnvtas sDrruro;u0apen fcildfm2ra( o (4 ltomf ta1opDe uvils0 rumio ou4ole lneia()artr(rp;u0aet ioetytls umu o u4alxnxocoy1lmDeluvi (0trxrxo3iu4apt  fesat)arurxm oo0olto f3iatfaDuluvo;(4 reoio3oo1fateaies (0texoxo3oydapt  ncslt)arrm(m nu4tlt ioeiyt s2ean pnu0teermfcta1lpDelivi ( tetm(opiydamt  nct s)s2uru o;u1tleo fctydfm2emnmo;u4trxnirciatfmDeln slt0sexmirpny1lp   nctat) 2tmur ot0oltoiicildfs2ea(ms;u4treoxrcoy1fpDelu o t)srxmxo oo1oltelfvt ()srumxroot1openmociat s2rmnvsn()trxrir3tadfp  aivo;s) exo(rpno4lmtn fetl( artmu o;o0tleo i3iytfsDeaumpnt4 rtomfctadoatrau ols0seumxo3no1openlicils aDtmxr oo0oeeomictld a um( p;t0tlerxfctotop e uei;s)srtr(mpny1aptemicsa(fsDuaxr no0apenmfeils s2ea( pn(4texomocoy1fpDr n o;t t2xrxrpou1lp   nvtat) 2tax p;u4ope mi3iytfm rmuvs t) exoxf3iadoate neo s0srtmir io1op   feilt) 2rmurpnt1tle moeildlm2emumpn(0 rermo3ty1lpteanes t0 rto(mpoydll   fctls) rtru oou0apeo f3tldlmDelums ()texomrcoo1fpt  n ols s2umiopnydal  livia(f rua(r ;t0texo ociltfaDemuvon()aexrxfcia1faDeau ols)seur(r no1apte netatfs2rru  no0aexo octltfa2uauvs u0 rxoir iatoaDe ivolt)trtr(mpnydlm e nci s) 2tax onu0oeto f3iasla um( sn()tetnmr oytfpDeanesls)srurxr oy4altemfesls) 2um(mpnt0aet  i3tadfsDrmnmp t) lxoxocio1la rlneo s) rxm(r nudlltnmfcil( a2umur ;t1apxomieiltfs2ea(vpn(0 rtrmo3iotlmD li o (0s2urxmpoo1omtelicilt arrrxrp;t0opeo iciyt aDum(vont0 rtrxo iodfmt  i o s texrxmpoo1om elivsl(fs2tm(m ;o4alxomfctatfaDelnmsnt)aexrmo oa1latraivi s) exm(rpoo4lmen ietat)sDtaxmpoo4aexoii3iadlsDuanvpnu)alxrxf3ia1fp r nvi;(  rxm(rpoy1lm n fcslt) ruru pnt0apeomociasfm2umn pn(4arxrir3io1lm  liei;t0trxrir iu1lptnlfcslt s2rru oot1texomf3tltfa ulu s (4 etrirctydfm r nvo s trtmxm no4ap e neta(  Dumurooo1aexnmfciydfm ul(vpnt0trtrxr ootfatrau sl()srumxo3iu4ap elnvt (fsrtaxmooo1tlenif3iasfmDrau s;(4tlxrmr3tydlpt anvol(0s2xm(m3nu4ame mfcil(fsrtrxr ;o0oetnio3iytla rm(vonu4trtrif io1fptrln i;t0trto(o3nydol n fcs (fsDtrxmont1openmfeiytfmDranmpnt)tlenxf3to1lm eliei;(0sexm(m iy4apeelnvsat) rtrxrpnt4olxo iciadla umu s ()artomo todlp raies;()trtm(o no4op  mfcil(  Dum(r ;t0aptnifetldlsDem(ms u)trxnmr3tatfm e n olt0 rtrxr3oodaltn fctlsfa2umumono4oet  f3iad sDea(vp u4tlenmo to1fpD luvo;s)trtmim3nydll nlfciat)srrru ono0ape iietydfa uan pnu4arermo3iotlp  aieo;()sexr(mpny1aleemncsas artm(r ou1olxnmoetls a2eauvsn(0 rtnxr ia1fm eaiei;t0setr(rpio1aptn neia(f 2tr(m ot4tpenmicild s ua(vp (4tlermr3iodfmt lieo s)seurxo3io1am   ieslt)sDrmumoot0oee mi3iasfa el(mo u4treriocoytfpDe ieol()seurim3io4oleemfcsl()srrm(mono4teeomicias s rlnmp u0trtrxr oodlp e uvs s)texrio iu1olt lneta()sDum( o;u1alx  fctysla2umnvo (4alxrir3iytop  ln i ( t2xo(opny1llenmncta()aDrrxmp;t0opxoiiciyt s el(mp;u)tetoxo ta1lptrln o t) eto(r3no1lm   icsas artaur no0apxoiiciasfa2rmuvs u)aeenir ty1fpteaiei ()trxo(m ou1optemicslt s2rrump;o0opt  fciatlaDua(vp;(0tlerif ta1la  lnvi;(  exrxrpou1lp   nes t s2rrxmoou0apenmiciatls ranmo ()trtrmfcoytopD  nei (0s2xm(m io4ame lnvsa()arurx  ;o4alt mf3tlt m um( on(0trenmo ootfatr i s;t)s2xmiopno1lmte ivi sfa2ra( p;t1aleo o3iydfs2rlnms;(0alxomo tadlateau sl(0srxmxm iydope mfciatf 2rrx o;u1oetn oeiadfm um(mo (0aetrir3iatfm eaueolt  etrxo3iydlmee iesls)a2uaurpno1apeoif3tltls2emnmo;u0altnxo ty1oa  au i t0 ruoxo ny4lpenmfei sfs2rru o;o4olxomfciatfm2rmnvs u0 etoxo ty1fpDeli o;t srxoio iudopeemncslt) Dumu pnu0tet iicildfa2uanvpnu0aleomr tadopDe nvi (0 ruoxmpno4oltelfciat)aDrm(r nu0altn icildfsDem(ms;(4 rtnir3oo1fate ueils)t2urxmpnudlmenmfcta(  Dumxm nu1aptn ictldla ea(vo;(4texrxf ty1lp  luei;s0trxm(m oydlmeemfei s) rrmxmpno1tlx iieiltls2umumpnu0aexnio3todfmD  ivo s t2uo(r3nodlmtemfcia()aDurxronu0optnmoeiat s2ea(mo u)trxrmocoy1latr nvo t)t2trir nu4lltemiesltf rrr(ro;t1apx io3iadfs uanmp (0 rtoir3iy1opteauvo ()s2xrim nodalee ivtlt) rurx poo0optnio3tat a ra(ms;u)alxrxf oatlpDraivi;s)seuoxo3nu4ameemfesls s2rm(m ;u1oeen f3iyslsDulu o;(4arxnxf3oa1faDr ies;t0srxo(mpno1ll   ietat)sDua(mo;u0tptnmo3tldla2raums;(4artnifctadfat  uei;s0tetrxo oo4amee ivtatf 2tm(m nu0oex  fciytfs2emu on(0 eenmr3tadoptr ivi t  2xmim io4llen neiatfs2tm(moot1aeeomfeils s ulnmonu0 exrif3oydoa  an ilt)srtoxo3iy1lltemfcs () rrax pnt0tpxnifcildlmDua( p;()aetnxf tatomDrln slt  exoim3oo1lpe liesas) Durxrp;t1aleoiietyd aDrln pn() leomoctydfpD luvil( trurxr ou1aleelnvt s) Duax  ot1tetnmiciysfm uan s u0 rxoxf3iodomte ueil(  eumiopou4lme  ietl()arumumoot0tpxn i3tatlm em( sn(4 rxomo iadomteluvs;s) eto(m ou4apenmnesltfsrumu o;o0open oeilt aDean o;(4tetrmo3tytla e ivsls0s2umim no4om e fetatf rrm(rpou4aeeniociysfa2uan s;u0 ltrmociadfmDr nvi;(0setoimpoo4ll e iei s) Duaxm no4oet iieiasfaDra( s;t0arerxf iotfa ran o t0 rum(rpno4al  liet s) ruaxmpnt4openmfetldls2ea(mp t4texniocootlpte n ilt0trxoio oydole mfcs t sDur(rpnu0alxomi3iad m rmuvo u)aeermo3oatoat  ueols sexoirpiu4ame  ivsatfs2taxr ou1apxo o3tydlmDrmn o;t4tlerxf3iytla  lu olt seuoxo nudlmenmnctl( a2uaur ou4tpxomoeiltlm rmn o u)alxoio iy1lmtranei s0teuoxo no4aptnmnetl(fs2rr(rono1tpxnmfeilt aDuauvonu4 eerio iy1omt livo s0 rtmir nydal n icia(  Drru oou1tlxomf3iadfsDulu p;t0tleomo oadfm eanvols s2xmxr3oudol nmfcsa()sDtmurp;o0oexomfcild m2uanvsn(0treoio tadop eluvsls)trtm(mpno4alenmnct () Dta(moou1aee moeiysls2emuvo;t) lenmo tadlaDe n olt  etrxm iudoltn icsatfarum(  ;u4tlxnmfctatfa2emnms t4 exoxr oo1optrau o;s0tetm(r3nu1omenlfei (fsDua(monu4tetniociad m2ul(mpnt4 rtrir3oo1oat  i o t)trtoxrpoy1apenlneias a2rmumpnu0tlt ifetlt mDuanvp (0teerxf ta1lmDr nes;s0 2xmio3no4lpenliviat artr( oot1oeeoiieilsfa2rluvs u4arenmr ty1lp  anvs (0t2tm(m3iydal nlfctatf 2uaur ;o4aexn feiydlm ranmp;t)trerxrciydla r neil( t2trxm3iu4ll  mfcsls srur(roou0apxniiciadfa2uln s u0aexrir3tadfp  ai s;(  2uoxrpou4ol n nvsltf Dua( ooo4aee moetyt m rlnmo t4tetrmf3iy1fmDe uvs;s)s2xrxmpiu1ll n fet t)sDrax  oo0openmociad mDran p;(4aexomo oadlm eliesl() etoxrpoudomtelietl(fsDum(mooo0tleo oeilsfaDrlnms t) rtoxf oa1fm e uvi;s)trtm(o3iu1ll elietls)s2trumpoo0apxoii3ias mDeluvs;u)tltomrciy1lptr i o (  etr(opoudopte nes s  Dur( oou1ale ii3iyt s ul(mpnu0aetrxrciotfaDraues;s s2xm(opny1lmtemncil()sDtrumonu1alxniictls aDua(vsnt4 rxomo3oy1fa elues (0 etr(m oy4lmtnmnes (  2tr( oou4tex  o3ild a2eluvs u0 lerxociadfaD ai s s)seurir no1lleemiet t)sDrr( pnt4tex io3ilt m ea(mp;t)aexrxfctytlp  ai s s trur(o3ny4am e nviltfaDuru o;t1tlx mieiatla2ranms u)treoxrcootoatrlneo;s  rum(o no1lp n feilt a2umumpnu1aeen fctyt sDemums;u0aeerircoytfpte u i s)trtrxo3oudlm  lfvtat) 2tm(rpno4tltn ociltlm2ulnvo u0aleoircio1lmtr neo s sexmxr3iu4omenmnvt tf ruru p;t4apt ifeiatfs2uanmo (0teerxr3iadfmtr n s;t)t2xm(m3oydolte ictas) ruax ont0tle mo3tytlm2elump (0tltrir iytfm rlu ol( setrxm3ny4ll n iesa( sDurur ;u4oeenmfctltlmDeln snu4 renmo3ia1lpDe ivils) rtoiopoudolt mncilt)sDrmxmono0olxomo3ias a rmums u)trerio3oo1faDe nes;t)sexm(o3nodal nlfcias) rtmx ooo4aptomoetydfm2rmumpnu0 etoxf3ia1fa  auvi t0 rxo(o3nu4al emnet t)s2uaump;o4ope mieiyt m rl(vp;()arxrmr ia1fm eaivils  rtr(m3iodapeemfvs ()s2ururo;t0tpx ioeiytla raumsn(0 ltomr3oa1lmtrauei ( seumir ny4lltn nvs t)aDrr(rooo0tpxo ociydla2rln pnu4teeoxr iodomte ivi;t)seumir oo4ape  fes (fsDtrx o;o4aeeoiiciatfa2uauvpnt4tleoxr3iytlmD aies t)s2urio nu4apen neilsfsrrm(m ot1aee mieiltls2el(msnu)artoxf3oydlaD  n sls0seto(opoydlp  licsls  2trx  ou4alt ioetatfmDem( p t0altnir tytlpD ai i;(0srtm(o3iy4alt  ivt () Durxm no1oeen f3iys mDrmnvs;t)alxoio3oadlp r ueo;(  2xrim iu4lmeemiei (fsDtm(ro;t4opeomoeilslaDul(vp;u)aeerif ty1faD lu olt0 etmxm nydop n ivi s)s2tmxr oo4apt mociadfm rl(mpnu)artnxr3tytlm rlueolt trxoxrpno4apteliesltf rrm(mpot4tlxomi3ild aDelump;t0 renmr tadfmtranesls0s2umxr3iu4op emnci tfsDua(rpnt1aetnmicild m eluvs t)trxomo3ty1fpt  i ils  exrim nu1ame mnei (faDrrum ot0apx if3iyd a ulnms t4tetnxfctytlatelivilt  2tm(rpno1ome  ictls)srrmxmp;t4apx  f3tyd mDrmnvo;t0 ltoxo iadom eaivi (0setoxo ou4ll emnvsat) rur( poo1oet ifciysla2emn s u)teermo3totoat  nvol(0teto(m3nudlm emicil(f 2uaum oo4oeeomi3iad aDuan s;u0tleomociytfpDrluvil()texoim iu1ap   neias) Dtaxr ;o1teeo o3iadls uauvp () eermfcio1la e i i;s t2to(m3iodam  lieilsfsruaxmoot1aeeomfctydlaDrmnvo;u4tltrirciatlpt au ols0 exrxr oo4ale  ietl()s2uau ono4aex ioeiyt a ranvon(0artnmocootomDe nvolt0trxm(mpoodllen nvs s)aDtaumpno0apeo feiatfa um(vsnt)trtrir3oo1opDrli olt sexoir no4ame lieiasf Dtrxrpnt1ope  ieiysfa emumonu0 ltrxr oatom e u o t) etoirpiudomt lfesls  rrrxroou4tetoiocildfa rln s t4trenxrctadlmtelues;t trxr(mpiydlpt mivta( s2uau  nt4olx  octadfa ra( s u0trenmrctadomt aueo;()teur(r iy1om nmnvtlsf 2trur ;u4tpx mfeiatfa rmumont4 rtnir ootlaD livolt  etoxo oodlpen fcs tfaDra(ronu1tetn fctydfa um(mp u0 eeomf3ia1late uvils srxr(o3no4apenmfvs s sruaurp;u0aptn f3iatla emn o;u4aetrmr iatfp rli o;t  2uo(m iu4amen ncslt)sDrrx  ;u1oex io3tydfa2emnms;t)aeenmf ta1fmteaues s)t2xm(rpiu1aptnmncil() 2ta(  ;u0tpxnmocilslaDuanmp;t)arxnmrctodlatrluei (0t2xoxm oy1ap  miet t)s2tm(ront0aetoio3iyd m uln on(0altrxoctydlat  u i;()trtm(opiu1apt lneia(  Draumono0oexoioetys sDean pn(0alenmf iytlmDr n s;t sexrim ny4oltnlnvta(f rtmurp;u4opt ioeiyslaDumnvon()aexnxo oodlmt luvi t  2xrxr iodop  lnciasf Drrxr nt1aexomietlsfm rlnvp u4aexnmf tytoa eaueol( s2xoir3no1apt livtlt)srrr(  ot1oleoioctyd mDeluvp;(4tltrirciy1fpt  nesl()seum(o3oudllte netlt)artmxrpnu1apxnio3ils sDra( o;u0 rxrircoydomte nei;s  2tm(o3io4opt lncsas  rtau  ;o0ole mi3tys mDrl(vsn(0 eerif3oa1laD  ies t  rtmio ny1ol  licilt)aDtrur oo1teeomi3ilsla2rmumo u)aeenif tadfpD aiei;s trxm(mpoo4apt mici t)srrmum oo1aleomo3tadfsDul( on(4artoirciy1omtraivo s0 etrir3io4ol  mics s)s2tr(rp;u4apxo fciltlm rm(vp (0 rxomf ootlp rau ols s2to(o3oo4ope lietlt arurum nt1optnmieiadls rmnms;()teeoirciydfateau i s0s2xm(m3no4ale mivia( arur(  ou0apxo i3ilt aDeanvpnt0arxnxfcoytopDelneo;t srurxo3no4lmtn nci (fsDua( ono0aeeo fctltfm2eluvon()trtnxf io1lmtrau olt) 2trxr ny1am elivt s  rrmu ooo1openio3tls m rmn s (0artomo iy1oaDeanvslt0trurxmpno1lmeemnvsltfsrua(mpno1ope if3tldlmDrln s u0artrmo3iydlaDranes;(0s2tm(opoy4am elivs sfaDrmu  oo4tlxo oeiadla ua(vonu4 lxomfciydomD luvi;s)s2ur(m3ny4omt mnei tf 2taxmo;t1olxomfeiydla rlump;u) leoir oa1op rau o;()seumxr3ou1omeemfci s aDraumoot4opeoif3ilsls2ulnms;u)alxrxr3ia1latran i;s) rtoirpiu1lpen fciltf 2ur(rpou4teeo f3tytla2rm(vo;t4 rxoxocoy1omD lu olt  etrimpnu4llee nviatfsrumxr ;t1apenifetltfm ua(msnu)artnmrcty1lmt aivi;s)t2xm(r oydomt  iciat) Drmxm ;o4tptnifctyd aDuluvs u)trxnifcoa1op rlnvs;t)srurxr oudale lncta(  Dtrum ;t0tpxomiciysfa2rm(vs;() eeomo3ta1lmD  nvi (0teur(o iy4op  mnei () 2trx poo1tlxo f3tys aDulu snt4altnxrctotlm  liei;t  rtoxm iu4am emfetl()s2trxm ;t4olenifctytfm ul( s u0tlxrxr3tatlp eau slt0seumir3no4lp e nes (fs2taxrpou0alxnif3ildfs2elumonu4 etrif3iadomDr neilt)s2tmim3io4lpen ieia()srum( poo0openmi3tat a2ean s u4artnmr3oodlpDrlivs s tetr(rpoy4lme  fvsltfa2um( o;o4tlxnmfcilslm2emnms;u4 etoir oytoaDrlnei;s srxoirpny1al n neta( arurump;t0ole  i3iltfs rmn o t0texrio3iy1oa  au s;t0srxmim nu4ome  nes s)artr(moot0oee io3iydlmDrlumpnu)treoif3oa1lm e i o s  exrim iu1ol nlivta(  2umumpot0ape  ietaslm ulnmp;u0aetnxf3tydlpD ai s;t0srum(m3iy4omtelneslt a2raxmp;u0tlxn oetyslsDrl( on(4 etnir tatom  lnvslt0trxo(rpoy1lptnlivsls a2urumpou4aleoiietlt s ulnmonu4 etoxf3to1om   u s;s)truoiopoo1omee fes s) 2urur oo1tptnmf3iysfs2rl( o;(0aeenmf iadoat aieo;( teumxo nydalt lneils)srta( oou0aexniieiadlm eau ont0 reoxo3tadfmD  uvs t tetriopny4olt  fvsl(f 2taumonu0oleo o3iytfs2uanmp;t0tlxnif oatfmD aneol() exrim3nudlpt mnet ()artax  ou0tlx ioetlsls elumo (4 rermo tydlmt au o s)srxrxmpoudlmenlivtasf rtmur nt1apxoii3iyslsDuln snu) renir iodop e uvo (0srxmxr3no1ole  neia(f Drrxrpnu1oexnmi3iysfa2ulumpn(0aeeoxrcoo1lat  nvo;t0 2uoiopou4lle lfci sf 2tmumoot1apeo fciltla elu p;(4 rxnmf3iytomtrlnvi t0t2urir3io1llt mnes tf rrmu onu1ole iiciyt mDrluvp (4alxrmrcoatoaD lieols)sexmxr3ny4al n fct tf 2ua(r ;t4tetnifciadfa um(mo;(0 reniociy1fp e ivil() exriopoydalenlfct t sDrrxr ;t0olt mfeiyd m2rlu o;t4 lerxo tytfptrauvo;()s2xrirpnydlleemfeta(fsruaur ;o0aexn ictysls rlu p;(4 exnxo3iodla  auvs;s0t2uoim3ou1amtelfetat)arrr(rp;t1oeen octat a2ra( p;u4tlxoxr3oodfaDelu olt0seumim ou1aptemnvtls a2umxrp;t1teeomf3tytla2em(vs t0aetoir oo1lp eanvo ()setr(opiy1ame  ivias)a2tr(r ot4altomoeias sDumn s;u4 lxoifciy1lp elneol( srtoio3oy4omtnlfci sfartmx o;o4tlt mfciadlm2um(vs t0texoiocoo1lm   ieo;() euo(r nydalt lfctl(farrmurp;u1tpeo f3ias m rlnms;u)trermrctytom rluvo;(  exrio3oy4am nlfetat  rrm(  ;o0oltnmfctadfm2ra( s (0arerxr3ia1lpte ivsl(0teum(m3io1ope mncias)aDumx  nu4oeeo fctldls rau pnu4tlxnmo oadfp rliesl()s2xr(m ou4lp  lfes s)aDurxmpoo0tlxnmoeilt sDuan p t4arerxr ootomtrauvi;t  2trxm3nodomeelfcs ()sDurx ooo1texomfctltlsDuanvs t0 eeoio todlp ean i t0 rxmxopou1al n iet t) 2rrx  ;u1tee moctatfm2emnmonu)tltomf3oadfmD  neol(0 ruo(o iudom nmieslt s2uaxro;u4alxn ieiltfs2ran s;t)altoxf3todla   ues;t texrio3oudopeemncs s) 2urxrono1texn oeiatfa2ea(monu0 rerio ootfpt aies;t0t2trxr ou4om emnctas)arrmu ooo1tpeniictydlaDua(vs (0alermr3to1lpDranvi s0 eurio ou1amte iesltfsrta( onu4tex mfeildls2ean p t0tltoxo3iydlptrliei t  rumxmpoy4op  lnvtas)srtmxr no1aptnio3iysls2eln s;(0tltnirciytlpD  i s () 2xr(r3ou1omtnmnet (fa2uaxroou1tet ifctyslaDea(vs;(0 ltrmocta1fmDrliei (0trxrimpoydllenlnciat  2tm( ooo0oeto fciyt m2uau o;u)alxomr3ia1om  anvols t2toimpiy4apt lfvtltfsrrmxr nt4altnmiciydfm rmnmsn(4tlerifciatfptran sl(0t2umxr io1lmt  iesatf 2urumono0olxniiciltls ea( o t0alenxf iy1fpD aies t0 rurxr3no1ap  mneils aDtmx ont1optnifetatfm um(vs;() rtoif tytfpDe ieol(0 ruo(mpiu4apeemfcias arumxr ou0olt ifetasfs2emnvs t)trerir3ty1faDr ieslt  eurirpnydllt  ictl(  rrr(m ot4oexnmf3tld mDumnvo;u)tetrio tytomDelues;()srum(r3iodomee fviasf rum(m ;u1olx mfeils m uan p;u0tlenircty1fmt  nvs s trum(opiydllee netas  Dtaxmoou4tpt io3iadls emnvo;t)alerioctytomD lu slt)trum(r3oy1altelieta(fsrtru  ;o1tptomo3iltla el( p t0trxnxrcoadfmDe uvs;t  rum(o3iu1ol   fcsls aDtmxmoou4tpt if3tysfa rlnmpn()aexnif3oadfpD ln s;(0tetrxrpnodalt  fcsa()sDtmumpot1opeoifeiadfm2umu p (0arxnmo3tatlaDe i s;t0sexm(o3nu4alenmnes t srtmxrpnu0tet  oeiysla ean o;t4 etnmr3iydoaD lnvslt  2xo(r3iy1om  lfvsl( sDurxrooo4altoioctytls ua(vpn(0arermr oydfmD  i ilt  etoxm3oodol nmfesls sDtrx p;u1tlt  fcils sDranvp;u) rxomr iytfp   nvi t) 2tmirpnu4ap  mivi ( srrrx pnt0opxoiieildfsDra(ms;()teenmf3iy1lateli i;(  etr(mpiy1aleemnet ()sDrrum ou4alt mictas a2rlnvo;t0teerio tatfmD lnvs s)srxmim3ny1om e icsas)srtr(mp;u0oetn fctas m uauvsnu)aetrmf iotoateau ilt0t2tmxo ou4omt mnctatfsDum(m nt1tptniocils m ra(ms;u0aeenmr3iodlpDrluvs s t2um(m iu1omtelivsasfsrrmxm ot0alto f3tyt aDemump u0 rerio tydfaD lies ()trurxo3nu1lltemfes sfsDraurpoo4tlx  fcilsfm2elnms;u0 eerxo todlaD  uvi () rto(o3nu1ome lnvils srtrxrp;t4oeeoio3iadfa emn s u)texoxr3ia1fmDelnvo ()t2tr(m iy4ope livtat) rtru pnt1aeeomo3iasla2rm(mont4 lenmo iatfmDraues t0 exr(r3oydlle lietltfs2ra(r oo0tpt  f3iltla emn on()trtnxo iadoptrluesl(0seuoxo3io1ole mfci t  ruax  nu0aptnioeils mDrmn p (0 exnmr tadfm elu ils) eurxo oo1lpe mfct t) Duaum no1aet  i3ildla um( onu0 lxnmr tydoa eau s;()s2trir3oudape mnet t srrmx  no0tltn fetydfs eau s t0teenmr3oy1omt au i s texmim iydlm elicil(f rtrurpoo0olxoii3tatfa2eanvs t0 ltrmr ia1omD livs (0 rxmxm3no1lmtelnvilsfaDraxro;t4oetoii3ils m eauvo (4 lxrmfciydfmt aivs;t  2uoxrpiydap emfcil( aDtm(m ;t4ale io3tltlm2uau s;u0alerir3ootoatrlieo;s0trum(o oy1apeelncsasfa2umx o;u1alto feiydfs ua(msnu)tlermfciatlpD  ues;( s2toirpoydome  ics ( aDraum ot0aexn ociltlm ran o t)tetomr ty1lateluei s) rtrirpio4amtelfcsat sruru  ot1oexn o3iadfsDem(vp;() eenxrctadomDe i o (0 etoim oo1optnlfesat)artrx ont0optnmietysfa2em( pnt4aeenmo3iy1fmtrlues;()tetrxo oo1lpee fcs (f rrau pot1oexnii3tas mDulnvo;()artoif3totfaDelnvils0srxr(rpno4lmeelivsls  2rrumpot1texomfciasfa rlu snu0aeeoiocootoate uvs;t0trur(r iu1amenlfviatfa2rmxmo;t0tle  o3tysfs2rl(vp t) etoiocio1om r n s s s2tmimpny1ol n icsatf 2umu  nt0olxn i3iydls2rmnms u) leoxr3tadfptrlnesl()teto(opoo1am n nvia(farurur nt4aet ii3iyd sDuluvp;(4alxriocoodlp  au sls0setrxopoo1lmtnlneias  rrau  ;u0teenmoctldfa2rm(mont0arenxr3iodfaDr u s s trxo(o ou1al e fesa(  Drm(mpnu4tpe mfctas m ulump (0 etoxo oydoatr ueilt0 exoiopou4opeemivs (f ruau pnt4olt moctlt s ean o t4treomr iy1lmtr u o (0t2umxr3ou4lptnmfvsl(fa2uaxroou4alxn ocildlaDem( sn() rtnif3iadlm e uvolt s2toio iu4omee iviatfaDrm(ronu4aexo oeias a uanvp (4 exnio3oa1fa e neol(0 etoxm3oodalee ncsas) Dua(mo;t0olenmo3iydla uanmon()tetoirctadfaDeli s (0t2xmxm3ou4lp n feiasfaDum(m ;o0oeenmiciysfm2em( sn(0 etnmrctydlp  aiei;s0 2tr(rpno4lmen ietl()s2uax  ot4texoif3tasfa2eau on() reoxfcta1fatrlneils) exrio3ny1ll   feslsfsDta(mo;o1oleoiociatfsDrmu s t)tetnxfcto1omte n i;s) rtrim nu4olee ieia( srra(  no1tlenio3iltfmDranmo () etoxfcta1la r n slt)tetoxr oydapenmnvsas)aDuax  nt1oltomf3tls aDulums (0 rtnxo ia1laDrlneo;(0t2uoxo no1ome  fes sf Dtmu  ot0alenmfeiysfsDemu p u4tetnmf oo1oate neslt)t2tmio3iudapenlfvia(  2tru ont1aetnifeiatfa rlnms;t4 lenmf3to1fmD  uvi;s)texmxmpou4op  mfei sfaDtm(rp;t4olenifctatfs ua(mont0altnmo oa1omDraieslt s2xoxr3no1ame  fvt ( sDtaxm nt0openif3tlsfmDrlu p ()aeeniociatla eln s (0trum(r oodopenlfciltfsDraxrono0oeen ieiadls2eanmpn(4 rxrxrciotop e nei;t0 rtmir3no4am nlivt ( s2tru  ot4ale moeiysls raumsnu4 ltrxrctatoaD  nei;(  ruoxrpoy4omtelietlt)s2raxm nu0olxnmieiaslaDulumsnt0tltomfciotomDranes;t)teumio3iy1alenlics t) Dra(roou0apeo iciysla umnvs (4artnxo3tadop e ivi t trurxmpiy1amen fvtasfa2rm(moot0tpto fetadlaDumuvonu)tlxrmf oo1lmt auvi;() etoxr3oydapen ietls arrmx pnu1tpxnmociyslm2uaump;()trerxf totoa  au o t  2uo(opno4altelfes tfaDumu poo1alt mietltfsDum(vp (0alxoxr iadfmDranei;s0 rtoxr oo1alte ivta()srrmuroou1tlt ifctlslm2ulums;u)trenif3oa1fpte ieo;()t2xr(m3ny4ame mnvt tfaDumu oot4apenmietysfm ul(msnu)aeenmfcoydfmt an i;s0trtmir oydap nmnvil( aDuax  ou1aetnmoeiad mDuau pnu4aeenif3iadlat ln sl( trurxm oodlleemfvtas s2ur(r nt4oltnio3taslsDulumont0tlxrif to1fpte u i;s0trtoxmpno1optemfeias)aDrmx ono1optoii3ildla ra(vpnu0trxoio totop rau i s0 euo(opoudoptelnctat)artau ooo0optomiciys s ua(mp;u)areoircoydlmD anvs;s0 exrir iy1omt livtat s2urx ono4optomoetlt aDea( s u4artrio3tydlptean o ( trtmxopio4alen neta(f 2rm(m nt0aptoifeils aDem(msnt) eenir3ty1lmteluei t teuoir ou1lptelnesat s2raxr oo1olto icildlmDea( p u4altrxf oydlmteln sl(  2urxr3io4ol   nes tfs2umu  ;o4tlx  ociys a umums;(0 rxrmr ty1oa r ivo t0 etrio iudlmeemici ()artaurooo0aee mociad a2em(vo u)tetoxoctatom  luvi;t0srur(m ou4omt micta( sDrmuronu0oee  o3iyt aDelump t)trtrxocoadlateauvo s s2tmim iy1amt lfcsa(f ruau ooo4apxo ieiydls2ra( sn()tltomoctotoa rln i t teur(mpiu1am  miet tfa2taxmp;u4tpe moeias mDulu p;u0 lenio iydopDrlueo;(0 2xmxr3ou1lptemnvs sfsDtrxrp;t4oetoio3ild sDemu s u4 rxoir iatfpDeau o;s0seuoir3io4al nmfvs t)a2urump;o4aexoif3iltlsDelump;t4trerio3ootoaDelueil( texmxr3nu4op e fesl(  2uaump;o4tltnifeiad sDum( pnu0alxrxf3tadoa   ues t0truo(mpoydlltemfci sfarrmuro;o4tlxnmi3tyt mDea(ms;u0texoxocto1opD  uei;t0 rxm(o nu4amenmfeils srtrxr ;t1olenifcias mDua(mp u0 renmf3totla  luei;(0t2tmxmpou1al  mfctlt  2raurp;t0ape mfeildfsDrm(vp (0areomf3oytlpDraies;s) 2xoiopnudale  ieils) Dtrx pnt4oee  i3iydlsDraumo;t4 leoir ty1oaDrau o ()texoxm nudlmenlneil(farurumono4aetn i3tldfa2uln p t0tltrmrcty1lm rluvolt seurir nudope livs sfarrrum ;u1aexo fciysls ra(ms (0aexrmo3tytlpDranei;()tetrxmpio1ll  mieils)srra(mo;o4tpeoiieiltfs2em( s t) rtrifctydfmte uei (0seumim3iudopenlfcsatf Durxmp;t4teenioctytfm2eanvp;t4 ltomocoydoatelnesl(0t2trirpoy1apenmicslsf rtrxrpnt0tlxoioctad mDelnvsnt)teenxr iytfmteauvo (0tetoir oy1ape  ncsa( sDrr( pno1alxo ieiys mDrluvs;t)artnxo tydfp  auvsls0trxo(o3iy4omee ieta()aDuru pnt4apto iciydla ul(vsn(0 lermociydfmtr uvsls t2trio iydopt lfcilt  Drr(mpou4opto o3tltfa eauvsn()aexnxociy1opDeaues;(0trtoir iu4amtnlneilt)a2tr(m nu0tleo ietyt mDeln p;()arxoirciadfa e iei s tetmim3nydom elnctat)sDuaurpoo0tlto fctlsfs2emnvo;u)texoiocio1fmt  nvs s  2xr(m ou1lltnlfvsltfsruax  ou1openmf3iydfsDumnmsnu4 rxoxo3oadomDe i s;s  exoim oy4apenlfvtat)sDtaxr nu4olxo ocias m eau p u)aetnir3oo1oatr i o s)t2xrim iu4ome lfei sfa2tauro;u1aeeomocils sDel( o ()teenircoadfmtean sls0 eto(o3oodlm   nei s) rrm(  ;u4oexo fetasfs2umnvo;(4 rtrio3oy1op  au ols)texm(rpno4ll elnvt ()a2tm(rono0apxomfetasfa2ranvon(4trxrxr iotfatraivols srxoimpnu4altnlfcs s arrax poo0tpe iieiydlaDel( p;t0 rtoxociotfpt aivi;()trumir oo1lp  lies t)sDrmxm nt1tleomiciyd a2raums u) eenxr iotlp ran o;t0 2toir io1lp  licil( a2rr(rono0teto f3tls aDrmu sn()treoxo iotomt anvilt)seurxm oy1oltnmfes ()aDurur ou0aptn f3iatfm2um(mo (4texrxo3tydlm rluei;s)teum(r3iodomt  fciat)aDumxront0altnifeiysfa ean snt) rxrifctydfpteanvi t0 eurxrpiodapt  nct sfs2rrx pno0apxnii3iasfa2elnvp;u4 etnxf todoa elieo;t) 2urir io1ap   ivs ( s2tr( pnt0olxoifeilsfaDumu pnt)treoxo3tatfa  aieils0trxo(m3nu1optnlfet ( s2rm(mo;t0tpe mo3tyt s2rlums;(4texoxrcootlmD an s;t) 2xoxmpiydapeemiet t a2umum ;t4tpenioeiyslsDuaumpnt0tlerio3iodomt  ies;t srtm(m io1ol n fvsatfarrmurp;o0tlxnmfeildfs um(ms ()arermrcootfp r nvils0 euo(rpnodamt mivsl()aDua(mpoo4opxn ictydlsDrmn p;u0treomo ta1fp e ivs t s2trio3no1al elivta()s2ta(mpot0aetomfetaslm2ea(vsnu0texrmocoodlp r u i;t)teuoxo3no1amenlict sfarrm(r ou1tpx  octydfm2elnmon()trenxo3iytoaDr ueo;()trxo(o oy4altemfvt sfarumurpot4ole  octldlm em(mo (0aetoif iadlat anvs s0sexrimpoy4alee icsas sDtrx o;t0aexoiiciytfmDrmnmpn(0 ltrir3io1laDeai s (0teumimpiy4ope mnes t  rumumpot1tlxo feias s2ulnvp;t0 lxoxrcto1laD ln o (0t2xriopiu4ll emfvsls)a2urxmonu4apx ioeiatfaDrl(mo;t)tetnmo totlmD aues;t srxm(r3oo4alenlicias  2rmur ou4olt  f3tyslsDean snu4 ltomr oatfaD livs;( s2tr(r3ny1aptemfcias) 2ua(r ou4ape  octldfm2rm( ont4 lxomf iy1om raieols  2umio3iy4lleelicsa(f rur(  ;t1opxomo3iytfsDelu pnt0tlxnmo iadoa eanei;t)s2uoxo oydlm nlivta(fs2uaumpnu1aexomocildfm2uanmo;t0 lerir oa1omDeau o t0tetrxo nu4lp emfesasfsrum(ro;t1alt micilsfmDuaums;u) rtrxo3oy1lat  u o s srumirpiodamtelfcslsfsDum(  no4oleo feiysfs rluvp;u0 reomf tadfaDrauvs;( srtoio nu4lmte fetlt  2urxmo;o4opxo f3ildfa2ulnms;()altrxr3todoaDrauvi s)s2xmimpiodome  neias) 2raxmo;o1aee mo3iltlsDran p ()aeeoxr3iy1lm e uvs;s texoxopiy4om   fvs s) rtrurpoo1olxn icildfs2rm(vont)texrmocio1omt  n s s0sexo(r ny4ome  ictatf Dtaxrono4tlxniietld m emn p t) ltniocoytfmDeaieo (0trxoirpoo1lpt  nvt t) Drau pno4ale  fetyt m ul(vsn(0tetrxfctytfm rluvi s) exo(m3oydlptnmiesatf rtrur ;t4oet  ociyslsDra(vo t4trenifctotom r uvs;s srtmimpoydlm  mnesl(  2taurp;o4opt iieiydfmDea(mo;(4 reoirctytoaD auvol() 2xm(opoy1opeelncsa( srra(rp;t4oex  f3tadlm2uau p;u4tetnircootfaD aiei (0setrio3nu1ll eliviatf 2urxro;t4oeeo ieiltfm2el(vs t4 exomo3oa1fpDe i olt t2urir3oudlmt mictls arurxm nu0tpxniiciatfs rmn p ()trxomfciy1fat anes;(  ruoxr3oodam nlnei ( arumxmp;o0tptomf3tltlm2el(vsnt0 rtnxf3io1fm eau s;s)srtm(o iy1lmte ictat arurur ;o4tpx ioeiyt mDuanvp;t0 rtomo3tadfp   ieol()s2uoiopiodomenlieiat srrmxrpoo4aleoif3iasla2emnvo;(4artnio iodomt auvsl() rtrxm nu1lpt lfesa()a2ta(  no1altnmieiysfaDemuvsnt0tetnxfciytlmtrlnei ( texmio iydomt mfvs s s2rmx o;u4tptnifeilslsDum(ms;t)aeenmfciadla  livo;s  2toio iydlltelfvslt) 2ua(m ou4aet mfeiys sDumn p t) eenif3ta1fm rlues (0 2xmio iy4lmeelies s)s2taur nu0tlxo o3ildla2ra(mp t4 renmr iotfmtr u ols0s2xrio ny1ll emfvia(f rumumo;u0tpxnmictyslaDumnms u0arxoxf ootfpDr ies;s0trtm(m3iu1lpenmfcs s)s2rrxroot4apxo feiatlm rm(vonu)artomr oa1lpteau i s)srxmimpnodap   ici s)a2rrur no4tpeo o3tasla rlumpnt0 rtrxr3oodfptr nes s texoir3nodomtelnesl() Drau pnu1aex ifeildlmDeau onu0aetoio ia1fmt an i;s) rtrirpoudope mfctatf rtm(m ot1ale  i3tldls2emu p;(4 eenmfcoa1omD aivs (0sexrxm3oydamee fcsl(fsrum(roou1aetnmfcilsfs umnvo;t4 rtomfctydla r ivo;t0tetoxo3no4llen icta()aDtau o;u0opeo fctltfa ra( o ()tetnmo3iy1lm eln il(  rxrirpoy1lle mietlt  2trxront1open fctydfs ua(mont4aetnirctodoa r ieol(0 etrxr3iodopenmncilt  rrm(ro;t0teenmietlslm rluvp;u0 lenmociatlmDrluvo;s  2ur(m3nudomtnmfet ( s2rmump;u4tex iieiat a ranms (0 rtrxo to1lmtrlies s s2xo(r oo4omt lfvsl(f Drau pnu4alxomi3iys m2ranvsnu0tleomr3tytop  auvi ( teto(rpno1llenmfci (fs2rmu pou1open ictat a ea( pn(0tlxomr3iotopt  u i s  rtm(opnodll e ncslt  Draum ou0ape  f3tyt m emu s u4 leoxf3oadopDelu s s  rumio oy1ap   nvta(f rum(mpot4olxoiieiadfs uau pn(4tlenxo todlmD  nes ( s2trxmpnu1oltnmictls sDuau o;t1oex  ocild a2eanmp;(0trxrmrctatfm  auvsl() 2umim3oo1ape mfctl()a2rmumpnt0tex  oeilslsDrln snu0arxrifcoydfpD aneslt0teuo(r3oy4alt lnvias)a2urxr ou1teto fetas s ulnmp t4 rtnirctodfp r nvils0 rxm(m ou4lm   fesas  2ururpnu4apx iietasla uauvo;(4aexnmr iydoaDr n s t0 rxrxm3nodlm  mnet t  Drau p;u4olxn octlslm2emuvp u4altoxf3ia1faDelivi;s0texmxo oo4amenmics sfa2taxroou1opto ieiytls rmn ont)tltrxf ootfmt  ueols)s2umxm iudlm  mfeta()s2rruro;t1tlxomf3iysfm ul( p t)arxrircoo1lpDrlues;s  2toiopoy4lp e icsa()s2ur(r ou0opx mo3tytlmDulu pnt0 exoifciotla  lieolt)setrxr3oy1ll emfei s)aDraxmont1opxo oeilslsDrlu pnu4trxnio3iytlpD  ueslt t2to(mpiy1lmeelnetat) rrm( p;t4alxo i3ias m2rl(vpnt)altnif3iydoaDrlnvo (0sexo(m3oy1lp n ietat)a2ua(m ;t0tet  ietat s2rm(vo u0trtnmr ty1omDran i;()sruo(r3nu1oltelnei t  2tmur ;o0ole if3ildfmDemuvpnt4artoxr oydfpDr u s;s trxoxm iu1lmt lfcs sf Dtaxm ;t1aptniieiatlaDuau s t4 leoioctydop r nes ()sexrim3ou4optemfvtat)s2raumpno4apt ifeild s2ulnmpnu)trxrmocoodoaDrlivil(0sexrim no1apen fciat  rrm(m ot0apt  f3iysla ean pnu)alenxr3oa1fat luvols)seto(r nudoltelneiat)aruru oot0aet ifeiad a rlnvo ()aetrio tydfpt lnvs;s0seuo(opio1altnliesa() 2taurp;t0aleomocildfsDuanmo;u4altomr tydlp  an o t  rto(rpiy1altelicsl()srur(  ou0tet ifctadla rlu p;() leoif3to1optrluvil(0t2toir3nodom n ietlt aDum(r ;o1tlto oeiasfa rm(vp;t)aetomo3oytoptr ueo;( srxmxo3nu1lmeelfcslt  rrmx oou4tlto o3iasfm2umuvs;u0 leoxr3oodfpte n s t)s2uoir3oodapee nvtl()aDua(moot4ope iieiytfa rm( s;t)aleomf to1oa elivols0sruriopou1op   nei (  rurumono0oltoifctadfa uanmp;(4 ltrxo3oydlmDraieols)sexoirpnu1altemfvs s  Dur(rpnt4alt  f3iltlmDrmnmo;(0tetrxf3iodfa elnvols srtoxo io1om  licsls  2taxmp;o1oltoioeias s2elnvs;t) exrxf3oa1fp  livs (0s2trio3oodap n nvi s)artmx ono4aet ifeiltfm2um( snu0teerxo3oadfmDelues;( t2uoio iydlptnmfct t) Dtr(rooo4tpe mfeiad sDrauvsn(0alenif3oatfp rlueo s)texmxopny4ameemiet t  rurxm ou0tex ii3iadlsDem( o;u4tltrio ty1lm r uvil( teurim3oy4am e fctat)a2tr(rp;o4texoiietyslm rmnms;t4arenmrcto1fp r nvols) euoir3oy1oltemfctl(  rra( pno0apxomfciydls2rlumsnt4alxrxrciy1lpDrli i;s)setmir iu1lmenlivtls aDraxro;o0tetnif3iytfm2rl(msnt0teerir3totom rlivo ( trtm(o3nu4lmeelnciltfsrrmxmp;o1tleoifctadfs2uanmon() eeoxo3oatlaD  nvsls) 2urxm3oy4lmee ncilt) rrm(mpou4alt mfciyslaDrl(mp;t4tetnxociodlmDraueils0 rum(rpoydlmtemfctlt srur(rp;o4oltniietytfa rm( p t0 lxrmocoytfa elieslt0 etoxm nydlpee fvsatfs2umx pnu1alx if3iysls elu pn(4trxnxocio1fa elneol() eumxrpoy4open nvtlt s2urxmpno0tpen octldls elnmp;u4texnmo3tydfmtr uei;t)setmio ny4lm elies sfarurx p;t0aeto i3tysls uln p;t0artrmfciodlmt ai s;t0srxm(o3iy1lptelnctas)srtru p;o1tet ii3iasfs um(vp;(4areoif ia1fate i o;s0t2xm(o3iu4ape  nvilt) ruru  nt1aptomieiydlm ranvonu4altoxr3tatom   neols trtoxo iy1ame mnvsat)sDtmxmont0aex mfciydfs rmu o (0alxrmfctydfmDranvol()seumir nu1lm e ivtasfartaumpou4optn fciasfmDrmnvs ()trxoxfcootopD lnvi;s0srtoio3ny1amtn nct s)sDuau ono1ale miciydlmDeau p (4tltnmf3iytlp r neil(0texoir3oo1apt mfvsl()aDua(rp;o1aexnmi3ilsla ea(vsnt4alxoxo oadlpt luvs s  eumxr3io4lmeemieiatf rta(roou1oltoif3tadfm em( ont)trxnxfciy1omtrlivsls0seuoir iu1alt mfvils) Dtrxmpoo1ope mfciad s2ua( p;u)teenif oo1op  auvilt sexoxm3oy1lm emfei sfsrurx o;u4apenifciasls rl(msnu)trxnxf oatlaDrln i t0 rtm(o3no1amenlfvils) 2tmuronu1oltn feiyd a eauvsnu) eerir tytoaDr u s s trtr(m iudlme liet tf Draum no1tlt mfctldfm2em( p;()aexoxo3iodlm   nesls) 2umir3iydlltemfei s)a2tm(  oo4tet ioctlsls ea(vpnt4aexrmf3ta1lmt lueo t  rtm(rpno1lmenmnci sf Dtm(r ou4alx  f3iatfs rauvs t0arxnir todopDelnvslt seurim3iudoptemivi ()srtru p;o4tltomf3iydfa2eaumo;(4 rermfcoadfp rlnvi (0s2to(opiodolen iet tfsrtrx  ot4aex if3iatfa rmn ont4trermocoy1faDeaneslt srtrirpoo1optelici ()srtaumpot0tlx micildfa um(mpn() ltomrctadfmteluvo;t srtoxopno4lmtnlfvs sfs2uaumoou1aptn ociltls umnvo;t4trtnir3iatom rli sls0t2to(r oodalenlieil() 2ur(r ;t1aet mieiyd aDumn o;u)trenxo3iydfa rluvo;s)t2umir ny1llt mneiasfs2rmxrpno1optn fcias m uanvp;t4tlxnir oa1fa e ues;(  rxm(o3ny1lpt lics tf Dtaum nu4tpto icild m2uln o u)tltomrcoo1fmteauei ( t2xoim3iudopenliet t sDtrxrp;o0apt  i3ilsls um(mpnu0 lxnif3iy1laD ai i t0 rtoxm3iy4am nmnctas) rta(ro;t4aetnmoctatfm2el( pnu)trxnmr ta1lpDeluvs;t0 exmio io1ap elicsas  2taxm ;t4oetomieiadfm emnmo u4 rxoxr3iydfaD li o;t trtmio iy1lm elnesl(f 2umxm nt1aeeo feiytfs em(vs t4aeerifciotoaDr neilt srxoimpnudome  neiasf Drmurooo0olto ociat a ran on()alenxfcoydla r ieo s)sruoim no4ll   ncsas s2uaur ;u4ale mi3iat aDul(vsn() renifciatom eanesls)tetmxo oydomeemneil( artm(  ;o4tet ii3tadfm2umumont0 rtnmfciodlp raieols0t2toir3oo4lpee icia(  Dtrxmpot0aetoio3tydfa2elu snu4teenircio1fa r u i t)t2trxrpiu4ll n fesltf Dtrxmpnt1olx  f3iydls2ranvo;u4alxnirciodlm  aies s trto(m3iy1ol emnci tfa2ur(ront4oeto i3tas s emnvp;t0 etnmr3ootlptrau i s sexoir oo1lpt  icil(f 2rru onu4teen fciyslm ul(vo t) ltrio tatfp rai s s0 rum(m iudaptnmiei ()a2tmum ;u4tet mo3iadfaDrlnvs;(0alxnxfcoy1faDrli o;( s2to(rpou1ape miesatf rrrxmo;u0tlx ifctlt sDemu pnu)tlenmf iytfaDr neolt setrio iy4lle  fetl()sDumu pno0tpenmieiysfa2el(vo t) renxo oatlaDeaieil(0seuoxo3io1olt lfvilsfaDrrurpno1apxoiocias a eluvo (4 ltoxf3oy1fptelivo;t)s2xo(r3nudol e ncsat aruaump;o4tpxo octydfa rm(vp ()trermrcio1optrau i s) 2xo(rpnodoleeliesa(farra( pou1tpeomoctaslm2uln sn(4altnmo3ia1faD lnes t)trtmim nodol e ncil(f 2rauro;o4tpx if3iat m rmn sn(0 ltrmrcto1laDrlneo ( s2trxmpoudolt  fvsas  Drax ont1aex mo3iydfa rauvp;t0aeenxfcto1fmDr uesl(  eurimpoudlmenmfvslt) 2urxmo;u1texn o3tytlm2rl( p u4alxnxo3iytoateanvol(0trurxmpnudlpte ivi s artmu p;u0ole iicilt m umn o;u) exomo3ootoaDe i s t)t2tr(r3nydale mfci t)sDrr(mp;o4teenif3iatlm rmn s;u)tetoifctadfp r ivs s0tetr(o3iudll nliviasfa2rrurpoo1apxomf3iatlmDrm(ms;(0alxnxrctotlp elueilt s2xoim nu4aptn iciasf ruaxr ot4oltnmictydla2um(vo;(4arerxfctotfa rlieo ()t2umxo3iy1am nlieiat  rurx pnu0tpt ii3ias sDrlumsn(0aexomf tydlp elieo ()t2tmio oo1apt  fctat)aDuaxr ;o4tpxniictadlm ulnmsnu)texoxf oydlaDrlieo (0 ruo(m nudaltn nvs ( a2rmxrpnt0aeenif3iad s2um(monu4aeenxfcoy1op rliei;(0s2tr(r no4ap  lfcsa()srrmxmono0apx ii3iadfaDea(mp;u) renxr3iadlp eluvo t)sexmir oy1al nliet (fsDtrxrpou1oexo fciasfsDumn pnt) rtoioctytoptraues;t setoxmpoy4llen fetlt a2uau pot1ole mictat s uanmp (4tetomr3ty1fm r ies t0srtmxm3no1ole  ncsas arta(m ot1opxniiciyt s2rl(mo t4arerio3ia1lpDr ivs;t0trtmir oydop  mfesls sDtru onu1tpeomfciyd aDra(vo (4altnxfcio1lmtrluvs;s srur(o oy4lp  lfvias)sDrrxr oo4olxn oeiytls umu p;(0arxrmf3oo1fm r i sls)srtr(o iu1ll  lnesls)arrm(m ou0alxn fctad mDean o;t)aetoxr oa1op  luei t trxriopnu1amen nviatfsrtr(rpnu1tpeomi3iytfs umnvp;()tltoxf3totlpDr uei;( sruo(o iy1omtnmfeiatf rurumo;t1aeenmocias a2rluvsnu0 etomr iadfm eaueo;s trtoxr nu4optemieia()artr(  nt0oetomf3ild m2ea( sn()aexomfctadfmDrli i t0 rxm(mpoydomtnmfes ()aDuru  ou4oet mfeiytfs2rm( snu4arerirctydlatr u s;s0sexmxr3iodlptemfei t) Dumx p;o4tpeo ieiad a ran sn(4 rtrif3oytfa   ieils  exoir iy4ap emiet sf rtauro;t4oee mi3iys mDrm(vo (4trenmo3ta1lmDrauvs t) 2urxr3nydapee nctat)a2taxr ;t1teeo f3iyt m el(vo;() lxoxf3tydlat  u s;s)t2xm(rpiu4ame  fvi sfsDurxm ;t1opxo ietyd m em( o t) rxnxocoa1opte nvi;t0 ruoxrpio1lm  lictl(fa2tr(mp;t1tle ifciltlm ul(vpnt4texoif oytopDrluvo;t)tetmxr nydamtn nviasfsrrm( o;u0tpxn icild a ea(vs u)tetnxf ootfmDeau i;t  2trim3oudapeelieiltfs2tm(r ;t4aeeomocild a umu s t4treoir3tadlp eluei t0 2xm(r3nydole lnvi t  2umu onu1tptomf3iytfsDuauvs () eeomo3iytomte nvo s)srxoim oodlmenlnesatfs2rrx p;u1tpxnmoctldfs ua(vp t4trxoxr iy1latranvi t)trtoxo nydlmt lfetlt)artmxmpot4teeo ociys s2eanvo;u) lerxf3to1oa r uvsl( teto(r3iu1al elivslt s2rm(mpot1tptoifciatfa2ul(mp;u0trerircootoatelnvil() euoimpou1olenlfcia() rrrum oo0tpxn ocild s2eluvs t4aetomf oadla  li i;()s2to(mpio4lpte fei s)sDuaxmo;u0tpxomoctldfm emnvpnu0trtrmfcoodomteai o;(  etrxo3no4op nmivt t)aDta(rpnt4alto fctytfsDulu p;u4 rerxr3ootoa ean s;s)teumxo no4lle  fvtatfartr(m ;o4tptn fcild a ran p t)areomr iytoaD  u o t0truo(opio1ol e icsas)s2rrx p;o1tet mfctasfaDulnmp;t4aeerif3oo1laDeauvo s)s2toir no4am n nct sfarrax onu0oltn o3tltls2rlnvp (4alxomr3tadfpt  ivs s srurim3no1aptnlfci ( aDra(mo;u4opxomociyt s ul(vo u0alerio oatlaDr ues t seurir3no1lm  mfeiltfs2rau  ot0oleniietltfsDumnvpnt4teeoxoctytfmDe neo t)s2xoxrpnu4alte nvt t a2truro;u1apeo o3tltfaDranmp u)trenirciatfatraivi s  rtoirpnodlpt lnei tfa2ra(rp;o4tee  ociysls emuvp (4 lxrif tatom   uvolt sexoxm oo4lp   netl(  Drmu pnt1oee mieiadfaDeluvp (4teeoifcoatlp rlieo;(0 rxr(opiu4olen ieils aDur(mpot0tet  oeiyd sDrmnvsn(4arerxo io1lmDr u ol()t2toxr3nodolt mfvtls s2rrxrpou1opx  fctas m2rln snt0texomrciatfpt  uei;t  2xr(m nu1apen fcias arrmurpno0tlx iociatfa el(vo;u0 etnmf3tadfpDe n i (0sexmxm3oydaltnmnes s) 2raxm ou1apt mfcild mDumumpn(4areoxr3iy1latrlieo ()seuo(rpio1op e fciat)sDtm(m no1apenii3iadfsDrl(monu0aexnxf3io1fptr i il(0teuoxo oy4ap e fviasfarta(rono1olxn oeild mDranmon(0alerxf io1fa  au olt) exrxmpnu4om nmics t)a2umx  ;u0aptnifciytfa el(vpnu4texrmf oo1fateluvil(0s2trxm nu4lleemnvi ()a2trxmo;t1opeomieiydfa2el( o;(4texoif3oadlpte u i;s)s2xoxopoydolee iesa( artaxm nt0tpxo ocildfmDulu pnu)texrmf3oadlp rau s () etoim io1amee ivil( arurxmoot4aleo feildfmDrmnvsn(4trxnifctatfa e u o;s srtmirpiodlmtelfctlt  2umxrpoo1oetniieiydla um(ms (0aetnxrctotlat  uvsls s2toxm nydoptn ici sfa2ua(mpnt1tpx  fctad m2eln snt4 rxnmociydop  anei;()teumxmpiodop e netls  2trum ;u1olt ifeiat s rl(mp;t0trxrmr ia1op  ln o;s  euoim ny4om emicsls artrumooo1apt mo3tld aDul( snu0alxomo io1fptrli slt)s2umimpiodomtnlfcs s sDrru pnu1oeto i3iydlm umn p;u0tlxrxo3tatfpt an o;()trumxm3nu4lp nliet sf Dtrurono1tpx  oetad s ulnvonu)aetrir oatlp  livils t2umio oy1lmee ncils aDtax pnt4oleomietls a ul(vo;(0arxnir iotfa  auvils) 2umio iy4lle  nctltfarraxr ot1ape  oeiat mDeanms u) lxrircoy1lp elivol(0t2tmio ou1omt  fei () 2trurono0alenmieiyt m2ulump;t0 reoxr oo1op  luvils) rumir oy4ap elnvsa(fa2tmxm oo1tex mociys m2ulumont4trtomrciy1fp e ues s0s2umiopiydam nlfeta(fs2urxmpot1opxomfeiatlmDua(mp u0texnifctydfaDe ivslt s2xr(r iy4lle mncsls s2umxmp;u4opxniocilslsDranmo (4areoiociydla elu i;t trxoxr3iodol nlivil( sDtaxm nt0teeo f3tas s ua( p;t0aetoxf iadfmteauvo s0 2uoxo3nydlleemfesls)artaurp;o1oleoifetldfs emumo;t0tetoir3ia1fmtean ols texm(mpoydlle  ivta(fsrua( ono4tpenmf3iydla2rln ont) exnir oydlm   i ols0tetr(m oodapenlnctasf rtaum nt4alenioctlsfaDuln o;t4areriocoydlat luei t s2trio3ou1al e ietas) 2tax  oo1tlt mi3tydlm rlu pn(0tlerxrciydopte u i t0 rxm(opoudlmen ivs ( aDra( p;o1aleomf3iydfaDum( sn() rtnio3tatlmte ues;(0trtmimpiu1lp emfci t  2urum ;t0texo feiatla ea(von(0tlenxo3oadoa rlnes;()tetoimpno1lp   ivta(f rrmu p;u0alxoiiciasfa rl(vo u4aexrxo ta1oaDeanesls t2tmim3no1ol nlnct s)aDuaumpou4tpeoiiciatla2rl(vp (0arxoio iy1lm   ivol()texr(o nu4apt liesl()sDrax pot0oeenio3iytla el( s t4aleomfciotoa e neslt0 rxrir oo4lm   nei sf Dtru o;o4tlxnifeildla2eauvont0 reoir3oa1lat lnei;t trtoxm nu4lm nmfcs ()sDua(  ;o4tlx mietltfaDuanmsnu4aeerxo3ootopt au sl( t2uoir oo1ome  fci s a2ua(mo;u1teeniictlsfa el(vo;(4teeoif3tatlpD au ol()trxoimpiu4lmeelieil(f Dumxmp;o0oeeomictaslaDea(mont4texnxr ia1fpDeanvi;s0srum(opno4ll nmfci s)srtmxrpnt1tpeoii3ildla eaums;t) lxnmr ootoaDe n ilt) exm(o3io4ll e ies tfsDtax p;t0aexnii3iat s ran o u4trxoif iydop r nvi s srtm(o3oy4lptnlivs t srur(mo;u0tee  oeiasla2ea(vs (0alermf todfa rlies;t t2xr(opoo4op n nvslt srrmum nu1texnifeiytfaDran o t) lxrif3iy1op eln o t  2uoxo iodape mncta(farrmur no4tpeomieiatla2umu p;u0altrmo3oodfm raueo;(0s2uo(r3nodal nlneilt aDurxmo;u0tet io3tadfs rau s u4 eermociotlaD lnvs t trxmio no1lpe mieiat)aruaxrpnt0ape  fctydla2emumsnt4artoir oydopDrlnesls)setr(r3ou1al   ietl(fa2ur(rp;t0opxo f3ils a rlumo t) lxrircio1fa  li o;s) rtmirpiy4am n neil(  Dtau p;u4optn ietltfm2rlnms (4 lxrxf iy1fmDrlueo t)teto(r oudlp elnvil()srtm(  ;o0apxoifciat m2eln p;t)arenmr oatlp r ivs t) rtmxrpno4ll n fvsat)srtrxrooo1tpe io3iad aDua(mpnu0treoxoctadopDr neo t)s2uoir3iu1ap nlivs s)sDrr( pot0oleomoetlsla2ea(mo;u4arxnircootomDrlnvs;s  2uo(opiydope  nvt t) 2tr(r nu1tet mfeias aDrln pn() renmr oo1om   ieo ()s2uoio iodaptnmfcs t  2trurpno4alt  ietydfsDrlnmo;u4 lermfciodlp r nvs;s)seuoir3ny1ol nmfcs t srraxrp;t4aetoiietat mDea(mp (4aleoxrcia1oaDr u s s)s2toxr ny1lmtnlnesat)sDraxmo;u4aleo octydfa ranvsnu0aexnxr3oydoaDe nvo ( srtmxo nu1llenmneil() rtr(rono4aetn ieildfmDranvonu)trtoxo3ty1opDelueols)t2toiopou1lmeelfcsas sDtr( pnu1olenmf3iydfa rl(vs ()alenmf3iatfm e ieo;()srtoxr3oo1op  mivt (f Draumono4aetn feiltfa2emu pnu) eermf oytoaDr n i (0seurir io4ameemncsat)aDuax p;o1opeo oeiyt aDeanmonu4tlxnmrcta1lpteln s () ruoxr3no1apt lneilsfs2truronu1opxomociydls2ea( p () rtrxociodfat aivs () rtrim oydome lfcs ()a2tm(  ;o0opt  i3ilsfa rm(vs u4tetrxrctydoaD lnvols  etrxopny1apt  ncta(fa2uaxr ;u4alt if3tadlm2umuvp u0aeenmrctytoat li o;()srtmxm3ou4lltelivtl(fsDumu pnt4aetoiiciytfm2emnvs (0tlxnxrctadfptrluvil()t2uoxm3iu1omenlfvtas) Drrx p;o0oex  ietat s uaumo;t0arenmo3tytfmtranei ( s2umim3ny4omeemnei t  rrax o;t0aleoiicias sDel( s t0 eenxr3iadfm  aueslt)sexr(o3nudame mnesl(faDtau  nt4tet  feiadfmDeln s;t0tltnmf oatfpt lieol()setm(mpoy1lm e fes (fsDrmumont4aexoif3ilsfmDrmn on() lxnmr3tydop rai s () exo(rpoo4apte iviltfa2taxm no1apx iietatls ranms u)treoxf ootfmDrli ils  2to(o oy1amen fvs t)srrmxr ;u0olx mf3ildfaDumuvs;t4 leomf3iotfpDr uvs t texoxr3oo4opt mfei (fsrtmxr ;o1opxomictyt s2uan o u)alxoir3oatfaDelu o s0 euoim3ny1lp nmneslsf 2ururpot4optn f3tasla2eluvpnt0arxomf3oatfp e ueil()trur(o nodlmtemnvil(  2rm(rp;t0optn octys m uanvsn(0 etoif to1fp  lies;(0 2xrir ou1lp n fviltf Drau  no1tlx io3iltla2rl(vs u)texomf iy1fpD an i ()seurirpny1oltnlics ( a2tm(  ot1ape  iciat mDel( o;t4altoxocoytlmD ai olt)s2uo(rpnydapt  ieils sDuauro;u4alx io3iydfm2rmnvo u4altrxrcio1fm eai s;(0srto(r3ou1lm elfvsl( s2ta(  ot4aee iieiys a2umn snu) exoxr3io1fptrluvs t0tetmir3oo1ap nlfetls a2raump;t0tlx io3iltlsDraump t)texoir3ty1lp e nei t0srxmimpoo4ame  icia()a2taurpnu1oltniictys s umnms;u4trxomfcoatfatr ues s0trtrxm ou4ll n fesatfarrm(mo;u0altomi3iyslsDranmon(4arxrmo3oodfmtr u o;(0trxm(m3iu4oleelneia( srrr(rp;o1teeo f3ias s em(vpnu4 exomf ootlatrlueol( trtoxmpoy1
\ No newline at end of file
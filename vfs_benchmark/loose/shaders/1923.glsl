@@ -0,0 +1 @@
+neo;( s2xoxo iu1op  lneias arta( pou0tltnmo3tyt sDel( p (0tetnxo oodfpDeaues;s)sruo(m nudlp  mieia(f Dtm(rono4tee if3iadfa uln s;u)altomociotomt aivslt0t2um(o3oo4amtnmnetasf Dra(rp;t1tpe ioctlslmDea(mp u0altoif3oo1lptrlivil(0 eurim3iudoltnlfvsl( aDrmumont0tptn ieilsfaDumuvp t4tetomociytopt  neols tetr(m iu4lmtelnci ()a2rrurp;u0tlxnifciysfa ra( s u) lerxf tatlp elues ( srtrirpoudlle  iviat aDuau p;u1olx ioetyt m emuvo;()alxoxo3oa1oateln s (0 2umxopny1lle mies tfs2tax  no4olen feiysfmDrl(msn(4 rxomo3tatoatr uvo ( s2xoxr3nudoptelicsl() 2rax  oo4texo fciatfm emn s t0 etnir3to1lp eluei;s0seuoxm3ou4ale  ietas) rum(mo;u1tpeoio3iyd m2rl(vo (0areomo iotoa  au ol( srtoxr no4ale licia(f Draxrp;u4tpt  iciadfa rmnvs;(4alenif3tadlatr nvolt)s2uo(opnu4lle mfctat)sruaxmpnt4aptnioetys mDel(mon(4 rxrif3oo1faD li i;s srxriopoodlp emfei s)a2rmx o;t0apx iicildlaDrmu s (4arenmo3iytlmte i o;(  rxr(r3ny1lm  lfeias s2uaurp;t4apx  i3tlsfmDrl( o u4arxomfctodlateau ol(0srtmir iudalenlnetas)aDraxmo;u1olt  octyt mDeanvp (0alxrxf iatfatraivs (0 exoxo oydlp n ietat)s2umx  no4opt  ictytfs rmnvp u) rtnio3iy1fm rai s;s sexr(m oo1amtemneta( srumxrono1tle  fctatfm2eaumo;(4aetnmr iatlpD  uei;s0 2xrxo oo1lm n feta(fs2tr(mont1tpeniiciyt m ulnmo u4aleoir tadfmDr n olt setmxo nydaltemncsl()sDurxr ou4altomi3iltfm eluvpnt4 exomf3oa1omt  n i t)setrxo nudlltn ictl() Durum nu1aee io3iatla2um(mo u4tetnxf tydfat au o;t0trxr(r3nu1lme mfvtls)a2rmumpnt1aex iieiyslm eauvp;(4arerxr ty1om e nvo;(0 eum(m3oy1amt mnvta( srtrxrpnu0oeeo o3ilsfaDrlu on(4aexoir totlm e uei;t)srtoxrpoodal  lfctltfsDumx o;o1apxoifeiatfaDumu o;(4 lxrxfcoy1fm r nvs s0 rtmio io4alt lnviat  Dtmxrpnu1oexoifeiyd sDra(vo t4 rtrxr3oy1lmt  uvols texr(r ny4omtemiei (f 2rrx pnu4tpeo octat m rmn onu0 rtrxocoodoaDeaivs (0trxr(m3io1ale lfvsa(  2ra(mpou0apx  ietas aDelnmo;(0 etrir todlate ueo;(0 rxmim ny4omee ivt (farum(r ;t0tltn iciadfsDumu o;u0tleomrcoytoaDrlueols)t2toim iodlltn nei tfs2trx ont0olt iicildfmDelu o u) eenifciydopD livilt seur(rpnudap  lnei ( arrrxmoou0ape ifeiadlsDranms;t)arermoctydfmte ieilt  2xo(m3io1lmtelfes t a2tax  nu4oltomiciys s ra( pn(0altrirciadom eaivi (0 2xrir iy4lp  micias  Dtaurp;t1oltn f3ilt sDeaums;()tetoirciytfa rli o () rxrirpou1op nmict t  Dua(mp;o4apxo ietyd s ua(vo u)trenmfcto1laDr ueo;(0 2trxopio1lptn ies tfs2tmxr ;o1altomietydfs2um(vs;t) etrmo to1fmtelivo s)truriopoo1apt lnct ()artaurpou4texnmf3ils s ranvo;(4arxnxf ta1lmte u o;t t2to(opno4ll n ivias  2tru p;o0oex mociydfs2umuvo (0aexoxrciytfatelieils0tetr(m oydaptemfcslt) rrax p;t4texnifciadlmDrmu o (4arermf3iotopDr n o t)t2xo(o oydalee netasfartmx  ;o1apxo o3tat aDeau p;() rxnif3ootlaD  ivols0srxrxo3ou4lpenmivias) 2rr(monu1texomi3tytlm ran p;()altnxf3totopDeaiei;( trtrxm3iudoltelietl()arrax pnu1tee  f3iys m rlnvsnu)tlenxf3oo1lmt aivo t s2ur(opnu4op n netat  Drmumo;u4tleoii3iasla uln p;(0aeenifciotoaD livs s trxr(mpoo4amenlictat) 2rauroot0alenmfetytfa2ea( s u)teenir3tytomt  i i t0 rtr(opoo4altelneslsfa2ururo;t4teenmiciatfsDeaump t4trxnmfctadoaDr iei s  2umimpiu4omtnlfet s  ruaurpnu1tlt  fctadla2emnvs u4teerio3oy1la r ueils0 exm(o3iy1amt lies s)sDrax  nt4alxnif3iad aDrm( s t)aetnio totlpt an i;t0 2xm(rpiu1omenmncia(faDurump;u4oleo fcild a2uln o;u4teenxocty1omDr nvs;s)s2xmxo3oydlmenmivi (f Drru  no1tpxn ocild a elnvon()tltrxo tatfp  aueols)s2uoir oodomenmneia( s2umx  no1opxo ieiatla eluvo;u0arenmf3oodoaD luvs (0trxm(r3iudal  lneils)aDurxm no1tlen ieiytlm rl(mont)tlxoiocoydfat  ieo;s setrimpoy4al e ncilt) 2raxmpno4altn ictydfa elnvo t4tlerxfctotlpt aivil()trxm(o nu1lp e ieiltfs2umxrpnu0oexoif3ild a2ranmo;t4alxoxrcoo1lmDe uei t) 2to(rpnudol nmivsa(  2tr(rpnt1teenio3iydfm umu s;t4 rerir3ta1lm eaieo;s) exrxr iydlpt liviasf 2uru o;u0apt ioetlsla ul( ont4alerxociatoaDeauvil()t2xr(rpnydlmenlnvsls)srrruroot0tpenmietys s rl(ms t0aexnmoctodfa eanei (0trtmxr3oo4am nmfvilt  2urumpno1apeo fciyslmDea(mo t)artrmf3ty1laDe ivs;t)tetmiopnudlme  fcils)sDrrx  ;o0oex ifciasfa2ea(vp;(4 etnxo3ia1lm rau s;t  etmim iy1lm   ivsa(  Duaxr ;u0apeomicildls rm(ms t4trerxf3iodfp raivo;t)texrxo no1lp   nctat  rtrxm oo1tpenmi3iatfa2umnvsnt4arxnmo3io1opDeanei t)teumxo oodll emietatfa2rax pnu4tpto oeiadla2rln s u)alxnif3io1op  aivi t)sexmirpoo4ol nmfcslt  rua(m no0tlxn fctldla2ra(vo;u0trenir3iy1faDr ivols0t2xrxr nu4aptnmnvsat) 2tmxm ;t1aeen feiydfm2emuvs;(0tlenxociatoptelnes;s) 2ur(o3iu4lpe lfvi () rtrumonu0open feiyd aDel(vsnt0trenxo oatfp  ln s t t2tmxopou1alt lfct ()arrrxrpou1tpe  i3iyt a2uanvp;t4aetomo oy1op  lnvilt) rtm(rpiu1omt miesa(farrm(r ou0tlx iociaslmDelump;t4altrxf3ootopDe n s;s0s2xo(opnodolenliciatf 2rrx ono1tlenmf3iltfa2rm(ms u4 rxrio iatlm   neilt t2uo(m3ou1al nlfvsasfaDraurono4altomoctltlmDeaump;t0 eeoxo3ty1fm e nvil()srxo(rpoydap n nct s)a2tr(rpou1apto fetltfs2ra( pnt4arxnxr3totom rluvo t tetoxmpoydop emivt t s2um(mont4apxoio3iasfaDranvs;t0tlermfcio1la rlueols s2xmxo iy4ap emfesl( aDtm( pou1aetnmi3iysfs2rmnmsn(4texoxocoa1lm r n il( s2ur(mpiy1lpt lfctltfs2tmurp;u0altoiictysla2rau pn(4texrio oo1fm eaneolt t2uoio oy4op nlivs s)artru ono0tetomo3ild a2ea(mo;t4aexrmr3oo1fmtr ies t0 eurxopoo4lle micilt  rtr(  nt4alenmfeiatfm2umumont4tlenxr3iy1oa eli i;s)t2tr(r3nydom  mfesatf ruaurp;t1oetnio3iad mDrmnmo;()tltnxocta1fmD livol(  etr(m nu4om n fvi tfsrrau pnt1oeenii3ils m rlnmo;t4arxnxr ootfate ivs s0t2um(opiudlp elieslsf 2ur(monu0tleo ictad sDeanms t4 lxoxociy1fmte nei (0s2ur(o oy1lme lfvs (f Dumx ont4oexnmfeiadfmDelnms;t)alxomo iodlaD aivo;() euo(m oydop  micil(faDtau  nt0texo octys mDra(vo;u4artnmf oy1lpDeai o;t) rtoxrpoy4altelfvtas  rtm(mo;o1tpeo o3iat a eauvo u0 leoir3oa1fpDe i sl(0 2urirpiu1llt mici s) Drmxmo;u4olxomfciys mDea(ms;t4altnxrctotomtraieo s0sruoxo3nu4omtnlieil() Dtauro;t4tlxnmfctldfm2ulnms;(0teeoxr iotlpte ueo;t) exmxr3io1am elnvil() rrmumoot4aptomietydfa eanvpnu4 lxoir oadop   iei;s  ruoxm ny4amtn fet s a2rmu o;t0alt moetytlm ran o;() eeoxr ta1lptraues ()s2umio nydoptn icta(fsrtrxmpoo1aeeo i3iltfm2rlnvp ()arxrio3io1oa e nesl( t2xm(m ou1al  lncs (f rraxmo;t4opto oeiadla ul(vs t4treoxoctodomteluvi (0sruoxm3oo4ol  mietlsfs2rmurpot1tpenmieiasfs ua(mo ()tlxrxf oa1oaD  nvslt  exr(r ny4ol  mieilt s2rm(rpnu1tpenmo3iatfs2eanvs u0tlxnmo3oo1lmtr n i t tetoxr3ny1am nmivs () 2tmx ont4oetnif3iatlmDelnmp u)trtrir3iatopt au i;(0s2xo(o3nu1ale mneilt) rtr(mo;u0aptomfeiat s2umuvp t0 rxrxrciatop  luvil()s2umir iu1apenmies sfa2trxro;u1apxn oeiysls elump (0teenif iatlatrlneo;( seuoim oodol nmnciat)arrm(m ;o4aee mietyd s2rm(vpnu4 ltrmf oydfpD  uesl()sexoxmpnu1lptnlfci (  Draur ou1tpxnmi3tad mDem(vpnu4altnir iydlate n o;t) etmir iu1ll n ncia( srurumo;u4tetn ocilt m eluvo t)arxnif ootoa ranes s) etrxo no4amtemnvs ( s2ururpou4olx ii3iydfm2emuvpnu)arxnxrcto1lmt aieo;t trtmxo3oo4olt  ictls)arur(r ;t4opx iiciatlm em(vs (0trtomrctatop  luvi;t s2ur(mpiydlltnmnetasf Dta( pnu4opxomoctls aDumn o t4trenirctydoatranei t0teurxopou1lp  lnesa()sDtmxmp;t1tlen oeiyslsDul(mo;()aetoxr3oatlmte nvo (0 2umxr oo4amen fvt s  rrmxm ou0tpt  o3tldfm2rlu s;t0 lermo3todfatrlnvi t0tetr(opoo1lpenlfesas sDua(ro;u1altniieiasfs2rl(mpnt0aexoxo iatfatraivi;s t2uoxr oodape  fvsa(fa2rrx pnu1oee io3ild sDum(ms;(0tltrxocto1latr ues;( t2xrimpio1apt  nesat srta(roou4aee  ietydlsDraumsnt0trenxfcoytla eliei;s  rxmimpoo1ope lfetltf Dua( ono4aetoif3ias sDra(ms;u0trxrmfctydla   nvsl(0 ruoiopnu1lm  mnvtat)aDtruro;o0opxnioctltla2eauvsn(4 exoxf3iy1oaD  ivi;( t2urxopiy4olen fcsl()aDtaumo;u1opxo ieiyslm uan o;(4tleomf tatlp elnvols)trxmiopou4op emictls  rta(  nt1oetoiietldls ean o;u) lxoxrctadoa  aueols seto(m3nu1ll e ivsl( artm(mo;o0aetn ietlsfa rlnmsnt4areoifcootlpDelivi s  rtm(r oo1ol emfcslt)arra(moou4aex if3iyt a uan s;u0alxrircio1omD anesl() eumxrpio4optemnesasfsruaxrpoo1apx  feiyd m2rl(von(4altrmrctydlmt aneo t s2trxopiodomeemieia(f rum(mpnu1tpx moeiasla2rmumo (0 etrifcootoptrauvolt0setmirpnodape  iesas sDta(ronu0apx  o3iasfaDem(mpnu) lxomocoo1op  aivi (  rumiopiu1al elicilt  2tmxrooo4opx mf3iyd m2um(vo;u0tltnio oadlmDeanvs;(0 exm(m3iodomeeliei ( sDtm( onu0teenif3iatfa2emn p;t4tetnmfcty1omt ai i;(0t2tm(opiydomenlicils) ruaxmpno1tpenioctydlsDean pnt0aetnxfcoytop e ivil( srumxr3iu1alee feta( aDurum ;t0aeenmf3iad m el(mont0tetrxf3iydlateli s;s seurirpou1opt mici (fs2tax ooo0tpen fctad m2rm(monu0areoiocty1latr ieo t0 2uo(o oodam n fctl() Durx pot0tlt io3ilt a ran p u0 rxrir tatoa e nvol( seur(opoodlm n fes (fsrtmu pnt1opxnmoeiysfaDelnmpnt4 etnxr3to1fpDelneo;t0trxmxmpnodolt lfcsasf Dtaump;t1opxo fciys m2umu s;u0tlxrmrciodfm eaivi;t0t2tmirpiodlm n fvt (fs2rr(m nt0apxnmociltlm2rmnmsnt)aeenif3iytfa rliei s tetmio3iu4llee fviat) rrrumont0aee  oeiytfs ulumpnu0 rtniocoodla   uvs (0 rumir3oudamen nesas aDraum no1tle  ocilt m2elu o;t) eerxo tytlmt  i olt  eur(opou1ap n icsl( srrmur nu1ope  f3tad m2em(vp u0aetoxo3iadlmD lneils s2trirpno4oltn feslt)arurxmpno1oetoif3ilsla emuvs;u)trtnmf3tydfaD  n slt0t2um(m no1lpenlfcta( s2umx oou0ape ifetysfm rl(vonu4teenxf3ta1fm e ivolt) exmim3nodomt  fcsl()s2trum nt4apeomfciydfsDuanms t4 exnxfciodfpD li o;s) etrim3io1omeemfcia()a2tmxr nu4altomieias m2uau o u0tlenmfciadfa  li sls) ruoxm3oy4amt mnviat  rtr(  ou0olx if3ilsls rmu s t4aetnio3tytopt  iesl() rxoir iu1alt  ivil( s2tmxronu4olxn oeilsfs eau o;(4 rxoxo3oy1om rli ols0trur(o3ny1apt  ncias) Durxmo;u4opxnmfeiytlmDrln p t4 exoxf tadlatrli s ()t2xoxrpnodop n ivsl() 2taxmpnt0optn fciasfaDrlnms u) reoxr3ia1fmt  i s;t)srxmxr nudalte netasfaDuaum no1olt mo3ias m eau s;t4aexoxf3iatom raueilt0srum(o3no1omt  icsa( srtru pnu4opxo i3iadlsDuanmp (0artomf iytlmDr nei ( trum(m oy1optemnetlt aDtmur no4tpx moeiydfa rm(mo (4texnxocoatfm ranvi t)s2umio oy1op nlics sfs2uru p;o4alxo ociad a ua( o;t4 eermr iydlmD  nvslt sruo(mpou1llt  net (  Drm(ro;t1oee mfetad a uanms t0alxnirciotfat  ivs s)srxmimpiu4lle  neia(  2rrxr nt4ole iocild a2rmn s;u0teenioctytfmDe uvsl()texr(mpiy1ll  licilt) Dra(moot4teen octlsfs emnms t4 eenmfctatla eln slt t2uoiopnydlmee fciat sDum(mpnu1apeomoetas mDum(ms u) rtnxrcty1lm r uvsl( trxoirpny1ap emnetas  rtr(mpot0tptoii3iat a2ra(mp (0artoif oa1opDelnvo (0 rxoxmpoodole mfcilt)aDtmx onu1aeen iciydlsDea(vs u4alerifctotlaDrlnvilt0tetm(r io1op n nesl(fsDrrx  ;t1alto ociytlaDuauvpn(0artrio3oadfptrlu o ( teto(o nydop nmnei ()srrmur nu0opeoioeilt s2emn pnt) ltnxr iodfmt  n o t) 2urxm3iydlm n fci s aDtm( poo1alx mf3iat sDelu s;u0areoxr3oo1lm r nes s0texoiopiodlm nmiet sf Dumx o;u1aeto ieiat s rm(vo t4trxnxo iy1oaDr u o;()sexmim3no1lpte fvta( s2ua( p;t4tlxomfciyslm ua(msn(0aetoiocta1fmD lnei;s trur(o3iodlpe  ici ( sDtrx  nt1aexoio3iatlmDuaump;u0 lxoxfctotfm raivi;(  rxrio oo1altnmfctlsfsrumxmpnt1alxn f3tls m elnmpnu0tetoir3tatlmt lnes s  2urxm3io4ap nlnes (  2rmu pno1oltniocildla2rlnvpn(4texrmr tytfpDelnes;s) rumio nu4lm   nvils  2tmur oo4oexoif3ils a elumo u0 eermo3iy1fmtraies;s t2xm(m3oy4opt mfvs s  Dtax  nt1oeenmf3ils a eanms u0 rtoif oadfaDeluei t)sruoim iu1omte ies (  Dumxmp;u4oetnifciatlmDeanmpn(4tltoio3iotopD li i t) rurxr3ou1am nlictat a2tmum ;t0tptnioeiytlaDuln s () etnircia1oaD anvo ()srxm(r iy4opee fcs t) Dua( ono0teeo oetytfa rl( s u0tleomfciotlat li o;t) 2xmxm nudalenmncs sf 2tmxm nu4tpxo i3tlsfm uln s;u)texoxf iytlaDeauei;s0t2xo(rpiydll elfvs s) 2tmu pnt4tpx ifetasfm2ul(vo u4altnifcty1lpDrai o () ruoxrpoydlmt mfvi s)aDur( ont0oexniietyslsDeaump t)aeeoirctotoa  livs;s)t2xmio io1omtnmfvilt)srtmump;o1ape mi3iasfsDumump;(0arxnircoa1lmDe uvslt  rxmxrpoo4am   feiasf rum(rpot1texn ietysfsDum( s;(0 etnxf ty1om e i o s)srxm(o io1amtn fesas)s2ua(  ;t4aeeoifetysfsDrauvs;(4 exrmf oadlm eln o;s)texrxm3nu4lp  lfci sf Drr( p;o4oltn octls a elu p;t0texnmo iy1lmD aieo;t)srxr(r3oo1al nmicta(fsrur(m oo4oeeoioctldfa2ulnvsnu0alxoir ootfa  ln s;(  exmxrpno4apee ncsa(  rtau o;t0tee  feild a umu pnu0altomfcta1op   neol(0 2tm(m3nodlpeemnvt (f 2rm( pou1oee mfciydfa2ea(vp t)arxoxfciadlm e nvo;( sexrxo3iodal nmnvslsfa2um(ront1oeeniociasfaDrl(msn()aeenifcoadoate uvi;( t2toxr3iydllte ies ()arra( o;o0apt ifeiyslsDuln snt0artrxf3tadfaDe n o;s) etmio3iu4altnmiet sfaDtmumont0tle io3tyd aDumumpnu0tlenio tadfmt anei;s0 rur(r3oudamenlics (fartrx pnt4apxn fciyslaDumuvon()areoio iytfptrlnesl( teum(m no1lmeemici s)arua( pnt0optnifcilslmDrluvp;()tlxoiociatoa e uvs ( trtoim oydlp   fcils) Draxronu1ole  ocilslaDraump;u0arerifcoo1fptrlu olt)texmxmpno1aptelfvi sfarrmum ;o0oltoii3iytfaDumnvs t0artrxo oodfp raivo ()srtr(r ny1ll elfvia( srrau oou1texo ociat m ua(mp;(4areoxocty1fmt aueo t0srtrio io1lmenmneia(fsrrrxm ;u0apt if3iasfs2uanvs (4 lenmrctytlpDeanvs t0 rxrimpoy4al  lfesat)srraumoou0tpxoio3iysls ulnvs;u0 exnmo oodlptran i s  2xo(m oy4lmenmies (fa2uaxroou4tlen ieiytfa2rm( snt4altrio ootla rli o;( sruo(r nudllenlicil()s2ra(  ;t0olxomieils m2em( snt)trxomrcoa1fa  auesls0texrimpio1aleemnci (farum( o;t1alxniieiys m elu pnu)teeoif3oytlmDr nesls  eto(r3oy1aleemfvil(  rtaxm ou1oeto feiasfaDuln pnu0tlenmr3ty1lmDr uvils) eurxopny4alte fetls  2rm(rp;u4olxnmi3iad s2ea( p;(4 ltnxrciodlp elneo;t) 2trim3iy4alt miesat)s2ta(mooo1ope  i3iasfa2umumsnu4 rxrxf iotoa  an o s)sexoiopoydom elneiasfsDrrxront1olxn oeiat aDrmu s t4arxomr3oodlpteaivs;t t2xrxo oydape  iet t s2umu pou4tetomiciltfa2rmumo;u)altnir io1opD  nei s0 rxr(opnu1lpenlfvi tf Dtmumonu0olxomiciadfa rl(mp u0tetrmrcootoate i sls0 exmxo3iydomtemivtlt sDta(  ;u0oleomfetlsfaDua(vpn(4alxnxrcoa1oa   i o (0 eto(m nudomte netat) Drmxr ;u4teeomietatfm2ean o t)altnmocoy1op  livs ()trxoirpoy1ale mneiasf rtmumooo4aeeoiiciat m rlnmo u4 exoxr3todfat an s;(0 eum(o nudap emfeta() rua(m ot4teeomictadla2emumo u) renmr3oydfaDrauei;s0s2tm(m3oydlltnlnet t s2ta(moou0tltoif3taslm rmn on(4arxrxo iadfm r nei t)srtrxm nodop nlfetat s2uaur nt4oetn icilt sDrmnmsn(4tltnifciodfpt anvsl()teumxm3oy4lpee iet sfa2raxmpoo4oexomietyt m rl(mp u0artnxo3iotoptelueolt)s2urim3ny1om nmnvs t  2trur ou0aexo fctad a2rlu pn()arermrcoo1omt luvs;()srumxr3iodaltnmietasfs2rrumooo0opxoio3ilt aDrlumo t) etomo ta1opteliei;t0 2urxrpny4lp emfes s)srrmurpoo1aeen fciytfm uauvpnt0 etomf oo1opD ai o;( truoxrpnodomeelncsatf Duax poo4optn o3iltfs2ra(vsn(4teenmf ty1faD  n olt0t2xoxo3iydole mfvslt)s2truroot0ope mo3tldfm2emnvp;(0areriocoydfat ln sl(  exr(r3iudopt mneiasfa2ra(ro;o1tetoifcildfmDua(mpnu4 exoif iotfmDe n i t0t2xmxo3iy4oltelics s arta(r ot0altnmietldla emuvs t0trenxr3tadlptr nvs (  2uo(o iydal   fcil( artrxm nu4alxoiicildfs2em(msn(4tetrir oy1lpD  ivo;t0 rxmiopny4olt mnviat srumxmono0open ictys a uau s;t4aexrio3oadlatrau i s0 eto(r3oy1lmtnmivs tfsDtax  no4apto feiltfs ea(mo (0 lxrmfcoa1fptran o;() rtoim3oydom   nci ()sDtrurpnt4teeomociatlsDulnvp;u0 ltoir3oodfaD lnei;s0srtm(m nodaltnmiet s arraxr ;o1olxo oetytfsDulnvonu) etnxr3iydfm e ues ( s2tm(m3nudale mivs t)aDuaur nt0apenmictas m rm(mo;() eerxo3tytfmD aneol()t2tmio3oudap nlfviatfa2tmu  ;o0ole  octaslmDelumont4areomo3oodoate ies t  2xmxo3ou4opeemies t)aDra(mpnu1alt iietltfa2eanvsnu4aexrmf tadfm   nvslt0 exoxmpiodal e ieiat a2ta( pou0teto iciys mDrmnmo t4trxoxf oa1faDeau slt)teuo(r iy4olte iet (f Drrxm ;u4tex ifcilsfs2eauvo t0teeomr3tadlmt auesls t2tmir nu1lm elnvi t)a2tmu o;t0teto ieiat s umuvp;(4 lenxo3oy1fmtelu sl( srtr(m oudoptn ict ( a2raxrp;u4altoifeiysfsDem( s u0 reoif3oatoaDelivilt0s2umxm iodoltn ict (fsDtm(mooo4tpt iieiyd mDrau o;()tleoxo3ootoaD anvi t  etrxo3oo1altnlfei ( artrxmono4aeeomi3tyt sDel(vp;u4arxomr oy1laD  uvo (0 2xo(m3io1ap  mnvi t)s2ua(rp;t1oetoii3ilt aDelums;(0 rxrxf oy1lp rlues;t0teuoirpiydolee ivsl(  rrrurp;o0aetn oetasfa ranmo u)arxrxo3ootopteanvs;(0trumxm oydal e nvs t a2tru  nt4apxnif3ils mDran s;t4 etrmo3totlptean s t  ruo(o3nydamenmivs () Dtr(mpnt0olt if3ild s rlnvpnu4trermo ia1lmteai il()texr(o iy4opt mnvi (  2rr( ono0tetomfetydla2em(vo u4 reoir oy1fat aneo ( s2ur(o oudalee fcsls a2umx pno0alen o3ilsfaDelnmon()alxoifcta1fpt  n i t teto(o3oy1ll   ietatfs2urx ont1aetn ieilt m2rmnvp;t4teeoio3iatomDrauvs;t s2xrimpoy1lpe  ivia(f 2uaumont1olxnmoeiyslm umn on() rermr iatfmD au i t0sexoiopnydlmtnmicilt srtmx onu4tltomoetldla2uauvp u) eerir3iadom rlnvs;s0trxmxm3nydaptelivils srtaxmp;u1apxn i3iltlmDranvs;t4 lxrxfciodlate ues t  2xr(opoydapeemfviatfsDrrx poo1oeenmfctatfaDuluvpn(4areoxo3oadlmDr ies;t sexmxmpou1op  mivil()s2ta(r no1oetoif3iytls rmn pnu0 lxrxf oodopD  ueils)s2umiopoo1lme  iesat)srrmxm oo0oltnmfciytfsDea(vsn() rtomf oadom raueo () rurimpiudomen fvt s)srtrx p;t4oex ioetysfa ea( o (4 rtoxo3oytlmD an il()teurio iy1am  lfvt tf 2rrxronu1aee mo3iyd m rmuvo u4tltrxfctydfm  auvolt  etoxm io1om emieil( aDumxr ;o1oleo i3ilsls rmn p u0arermf oytoptrlu i;()seur(rpno4ame mnes s  rrmx o;t0tpe  ieiadfsDelump t4alxnir3oy1omt  ueolt trtrirpou4ll nmnvils)sDur(root1tptniieias mDeaump u) eenxocia1fmD ai s ()teto(mpoydom  mfesl(fa2uau  nu1oexoiieiad s um( o t4 rtomo3iy1fmtrai s t)s2ur(mpiy4ame lnctl( s2tmur no1oeen ietld a ra(ms;(0trtrmf3iy1op  aiei;()trtrxm3iu1om  liet (fa2um(rpnu0oetnmfetlslmDel(vonu0 rxrmf tytfp   neolt texmxmpiy4ope  ivta()sDtm( p;o1olen oeiyt s2ua(vo;u0 lxnio3todfate ivi;t)srxoxm3ou1lmtelivtl(fsDta(mo;t1tpeomoetldfa uluvp () rxnmo oodlm  anvols0trxo(m iodapte ieslsf Dumx pno0tleoioeiaslm2emump (4aexomr iydfate n ol()srtoxo iu4omenmnetas s2um( pno4teto oeiydfm2elnvo;u)treoiocoatfa rlneo;(0truoxr3nu4al  miet t)s2rrur ot0ope io3ils a ul(mon()tlxnir ia1lpteau i;s)srumxo3iy4lmenlnet ( s2rr( p;t1tlto o3ild a2ua(mp u0tltnif oa1laDeai ols) exmir3io4ole  fet (fsrtmxmp;u4tpxomoeias m2emn s;u)tltrif3oytlmDranei;() eurxrpiydlp n netlsf rrmxmp;o1oetoio3iadfa rmu p;u)tlxoxr to1lp  lies ()sexmir3iu4olt  ivi ( s2rr(mont0aexnio3tytls rln p (0 exomo ty1omDr uvilt0s2xrir iudolen ivt
\ No newline at end of file
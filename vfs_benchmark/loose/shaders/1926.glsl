@@ -0,0 +1 @@
+nvil() rurir nydlltnmfetl()aDrrxroot4ale mieildfa2rmums t4 rtnmf tydfa  luvolt)seuoirpiu4lmte nes ()aDur(r ;t1tee  fetldls2ulu p () ltrmr io1oaDr ueolt)t2tm(m3oy1lp nlicsl(  2ra(  nt0apen iciyt mDean s;t4trxrif iydoaD  nes;t0s2xmxr nu4optn feilt  rrr( oot1apxoii3tlt a2elnvont4alxoxo3io1lp   nvo;s t2umxm3nu4alen nvi (fsrum(mp;t1tpx  i3ilt s emumpnu)alxomo iotlpDrlneilt s2xmxm iu1lltn fei t a2tmurpoo4aee mietltls ulu s;(0 reoxfcootlm  an o;t) exm(rpiudalt livs t  2rrur ;u1opeomo3iytls um(ms;t)aeermr3oa1omDeluvs;s texrir3iodomenmfvt ()a2umx  no4tlenioeiyd s em(vpn(0aeerircootlp  lnvi t0trtr(o3ny4amt licsas)a2rmx  oo1alx ioeildfs2rlnmo;t0 exrio3ta1laD  ueo;s) 2tmxopiydap   fvs (faDrmxronu4apxoiiciadlsDrauvo;t0trxnxr3ta1lm rauei;t0 rumio3nodalen ict t)arrm(mo;t1tleoifetadfaDrlnvo;u0 etrif to1omte n o (0 rumxr3oy4oltn fvtatf 2rrumoot1aeenio3iyt sDuln snu)teeoir tydfp rliei s)trtmxm ny1lmen ncil(  Dtmx pno0opxnif3tatfaDrlump (0 ltrmrcootlm e u i;(  2xmio3ny1lp e fciatfs2raxro;o0tee mfeilsla uauvp;()texnxfciodfate u s ()srxr(o nu1ap n ieil() Dtaur no1olx if3iyd mDeaumsnt4tltnif ta1om   u s t) rurio ny1ope mnct tfs2rr(m ot1teeoii3tas aDuauvp;u) leoif3oodfp  aivs;s)trurio iu4llen fvta()s2ur(mont4tpx  i3iytls rlnvon() rtoxo to1omD ai o t0 rxrxopiu1apenlictas)sruaurpnu1aexo o3iat s uluvpn(0tlxomo3oydlm rli o;s)t2uoim ou4lp elncs s)a2rmx pnt0teen o3tatfm2el(mo (0trxomo3tytlpDe ivi;()seur(opou4opeeliet s) 2ra(m ;t1opto oeiydfsDrauvo;()tltrmo oodlpt  n slt)teuoxo oodome  net t aDumu  no1aleniociasfmDuaums;u4 rermo3ootoaDr uei s  exm(r3nydop  mncs t)s2umumo;o4apxn f3iasfmDrl(mo;(4arxoxf iydlpt anvilt0t2um(rpoo4al n ictlt)sDrax pot1ape mfeiad sDuaumsnt0 eermr3ty1omDrau i;t tetmxr3ou4ll  lfesas)s2umxrp;u0apxoiietasls uan ont0trtrifctotomtr iesl()srxo(o3oydam emnviasfaDurxr nu1olto feiydfaDrmn s t0 etnmrcoatfmt luvs t0sruoxmpiudlm elnctatf rur(r nu1oexomietld s umumo;(4 etnmf oy1omt au sls0 rtr(m iy1olee fvsas srtruront4tptomoctldfm2um( s (4 eeoxr3oydfmt  ueols setm(m no4aptemfes ()sDur(ronu4tle mociltlm ra(mpn()arermf ootop rai olt  2xrxo3nodapeelnvtatf 2ur( ooo0tlx mictytla um(vsnu0 rxnir3iotfptean s s0s2to(r io4ol   nei () rum(r nt1teto i3tyd a2eln o;u0arxoxo oodom rlivolt t2ur(r no1lmeemfct sf Drrur ;o0aeto oetlslm2ulumonu)tetnxo3tatoat  u ils truoxrpnydal   nvi ( arumurpot4opxomf3iyd m2em(ms;()arerio3tydla   n o s0 2xrir nodlmtnmfcil( s2taxmpou1tpt  octltfaDea( pnu)areoio3ta1oa  auvils)trxoxopiu1omte nvsl()srtm(r nt0tltoifctytfm2rmuvp () lerifcio1fmDrlivilt) eur(mpnudll nlfet t  2tr(m nt1teeo ociad aDeau p u4artrmf3to1fp elu o;(0t2xrim3iy4lp  livsas) rrmu o;o4ale  fciadlm2ranms t0artriociodop eaivol( t2xm(opnu1om nmfeiatfa2rm(rpoo1oee if3iat m2rau p;t4trenxf iy1fateanes;()seuo(rpio1ole  nvi t)srurxro;o1olxnmo3tlslmDel(vo u0areoxo tadop rai s ( sexmimpnydap  lnvi t)srtmum ;u0oexn o3iysfs elump (4alxniocoodlmtean sls0s2uo(rpoudop nlfesat)s2tmxmo;u0tetomfeilt sDemnmp ()trxrxfciotomDrauvs (0s2xmir oodom n netl( aDrmurpot4alt  o3iytla ulnvsn(0tleomr iydom elnvilt s2to(r3iydomeemictls)sDrrur no4opxo i3ild aDean s;u0altoio ta1om eln i t0 rum(o3ny1lltnlfvsat  2rru oot1tlxo i3tydfa2eau onu)areoxr oo1faDranvi;s  2umir3oy4openmictl(  2umx oot1alenii3iyd m rm(vp;u4 rxomf ootfmteau i ()srumxr3oodomte nvs s  rraum nu4altomfeildlm2em( p;(0trxomfciotfmt anvi t srurxrpoydlmenmnetl(  2tm(mo;u4olx moeiltlm2eluvp;u0tlxnio3ty1omDeaieil(  euriopio4olt mnesltfarraxrpnt0apx  o3iadfaDrm( p ()tlxnircoodfateaiesls0t2toxo ou4apt lfet s)a2tmur no1ole iieiytfaDum(mo u4tleoxf iatom e iesl(0 etr(m ny4lptemfci ( aDtm( pno4tptnmo3ias sDrluvp t0artrif ia1lp  aneslt  rtmxopiy4lp  mivil( s2tmx p;o0apxomociaslaDelumpn(4teenircoatfp  li o;t0 2toim3iydamtemfciltfsrua(  no1tpen f3ils sDrauvs (0texnio3totla eau ilt)t2xoiopoo1olenmnetl(f Dtax o;t4apeomo3tytla2ra( o;t0trxrxociodlp elu sl()setoir no1op elfcias)arur( oou4aee iieild s2ulnms t4aeermrcto1lm ean olt  rtmir3iydol e fes s  rurumpno0tetniietatls rlums;t)arenio3todfaDr i olt0srumxr oodaleemnvslsfartaxront4opxnifctyd m ua(vo u4areomf3oodoa   ues;t0s2xr(r io1amtemnct (fsDurxrono0tlt  f3iadfm2umuvonu0tlenifcio1fatrai ols0t2xrio oy4lpenlnet sfaDuax oou4tpt  icias aDrl( p u0 lenxf3iydfat  n slt srum(r nudlpe mnciat a2umum no0opxn ocildlsDrmu s ()alxnxf3to1fa   n o s)srxo(r iu4ole micia(f Durx ono4aeenmf3iasfmDua( on(4 renmocia1lat lnvo;( t2uo(r3oy4op  lfcias  rum(mpot4alt  i3ild mDem(ms;()alermf oatla   ivo t) 2to(r3oodal eliesasf rtr( o;t4tetomoetatlmDran p u)teeoxf3tatlateaueols  rumxo nudom   nvs () 2rmu  nt0tpx  f3ildlaDemu o;u4tleoxf3oy1fmtr uvi ()s2xm(o3oydolte netltfsDuaxrp;t4opt  feiydlaDrmumo;u4trxoxf tadlmt  nvol() 2uo(o ou4oltemfvsl(  2umxmo;o4tpenif3iadlm eln o t0altrif3ta1fm eauvo ( s2urxo3oodap e ivta(fsDuaxm ;t4tptoiictysfa emnvo t) rtoxo3oa1lat li sls srtmxrpno1lme  fcia() rumx  no0opxn f3iltls rlu s u)aeeoif3iatop eluvs t)s2xoir no1lmeemnvtas)a2uaxroou4aex ifeias m2rl( o u) etnmrctydomD  ies s t2toxrpny4amt  fcs (faDumxrp;u4tee  o3ildfmDelnmp t)trxrir tytoat aivs s0setrirpnydlptelicsls sDrrumpoo1opeomfeiadla elnmp u0 leoxf iadom rlnvils) exm(mpno4lmeeliet tf 2tm(  ;o0tet io3taslm el(vsn(0tlxrmf iytoaD  nvo;(0trxr(o no4al e ici t)srrmx o;o0aex  octytfs2emu pnu0 etoio3tytoatelueo t0seuoxm3ny1altnmfctlt)aDta( pot4alto fctlsls uau p t4tetoxfcoytoa rlivs s0 etoxr3nudaptn fvsatfaDurx pno1tleoiietad a rl(vs u0 rxomo3oy1opte n s;()t2xoirpoydopee ncs s) rtaurpno4alenmf3ildla rl(vp;t)tlermr3to1fpDrlnvols srumxm nydalt lfvs s sDumxr oo4apx mietld sDrmnms (4arxnif ta1fatrai ilt0texmxm ou4omtnmicslsfa2ur(rooo4tleoifeiatfa rauvont0 ltniocoatopDe u s;( t2to(o3ny1apen fctlt)sDrmxrpnt4tptn fciltlmDel(vs t0 rxoxfcto1oatranei;s  exrxrpno1lleelnctasf rumxmoot4texnio3iat s rm( p ()tlxrio3iydomDe uesls0trtmxr3nudomte nes s aDrrxmp;u4tpx ioeils s ean s (0 etrif3oatfm r n s;() 2tmim nu4amtemfcs s  rtm(monu0tpenii3ilt m rl( snt4tltrmf todom e uvslt trtr(r iodomt lfviatfsDtmxr ot0aexomociatfa eanvpn() exoxf3to1opDeanvs;t trxrxr3oodol   nvtltfs2trxr nu4aptoiicilslmDelu p;()arxrmr iodopD  ieol(0sruo(o3nodal emnct ( a2ta(rpot4apxn ietas s rmu p t)teeoxo ia1faD ai s;s trurxo ny4op   nctl( a2rm(rooo4tet  i3iltlm2um(mo;u)texoircta1fm e neo;s s2xmir ou1al   nviasf Dumurooo1apeomiciadfs2uauvo u4 lxnmfcta1opDr n s;s0trxoiopoy4ll e fet t) 2tmur ;o0tleomoctyslmDrm( o (0aleomr io1om rlu ilt) 2uoim iudlptnlivtl(fsrrauro;o4apx iiciatla2rauvp;t0trtnxociatlpD  ivols0t2xr(o3io1am e ncslt) 2rrumpno4oltn fcildlmDelu s (0tltrio ootlateln o (  2xr(o3ny1ap e nvsltfaDtaxmonu1tptomo3ilt m2ean sn(4aetrxrcoodopDr i s;t)trto(r3oy4ol  mies (faDtruront1tpxo ieiaslaDrm(vpnu)arxrir3iytfptraneo s0texm(o3oo4lpt  ivi tf 2urxrp;u1olx  fciysfm rmnvs t0tltrmf3oodlat  ieo s0trxoxr3nu1op   iet t)sDrrumooo0olto o3iat m2rl(msnt0arxnxf ootfpD au il(  ruoxm nu1lp emnvslt)arumxrp;u4tlxoiietysfs2um(msn(4aexrmrcoatfmDr uesls)trurxm3iy1omtnliesat aruaxr ;o0oeenmicild sDulu p;(0 rtnir ta1oat aivslt0setoxo oydop nmfes sfsrtmxro;u1oexnmo3iasla2ea(vo;()trerir3ta1latrlnesl()t2uoxo iu4apte nvs s  2rrur ot4oeen fcild a rau s;(4treoio iatoat li i;( sexrxm3iodlpeemfeil( srtaxm nt1tpenmiciytlsDum(ms (0trxnxf todomt lues s)truoxopiodale mietatf Dum( pou4opxoifciltla ranvo;t4 eenir3oytlp rln o;t) rxrxm no1ll emivslt)s2rmump;o4olxnmf3iatla2ulumo t)alxomo3totop raivo;( t2xoxr nudll  mivi () rumum ;o1open o3iysfa2ranvsnt0teenif oa1op rli il(  etrxopoydomeelivt ()sDur(mp;u0apxn oeiysla2eanmo;u4treomfcoodfpt lnei t srtoxmpoodlpenlnctls  2ur(moou1oltomiciadfm ranmont)altrmo3oa1oa r n olt) 2ur(m3oydlmt liviasf Durx pno1ole  ictytfs emn s u4 reomoctydlm rlivs;s)srxoio3io4om e nct ( s2uaxmo;t0tpx  f3tasla elu p t)arxoxf3ty1faDe u slt srtoir3iu1lmt mfvs s)sDtrumpot4aeeoif3tydfa2emn o (4aleoxocto1lmt  u sls s2trio3no4lpt mnetat)s2tm( pou4tee  o3iys s emnvp;(4alerif3ta1oa eau i;t0 exoimpiudlm emietasfsDtm( p;t0alen o3ilt aDum(mo (0 reomo3io1opt anvsl()sexmxrpnu1alenlictlsfs2tm(r nu1oetoio3iadlsDumn s;(0altrmf3tadlatr neo;(0trtmimpny4alen icta(  Dtmx pnt1oltomi3ias s2rl( p;u4trerir oa1op eau s (0 exmir3iy1apeemfetlt)a2uaxm nt1aeenifeiltfa2ua(mo;()altnmf totfmDe ueols srxm(m io4om elfcsls)sDra(r ;u0tlxomf3iadlm ulums;u)tltoircoatlat  i sls)teuo(r ny4am e nciatfaDur(m ;o0optn i3tad mDuaump t4 etomo3iy1laDeaueo (0srto(opiy4ame mnci ( aDtm(  oo0alto f3ias m rmumo t4 lxrir3iatlptraiei ()texmxo3iodamtn nesatfsrrax pot0alt ifetlsfaDem(von() eeoxrciotfm   n o;(0trtr(mpny1ll   fvtltf rraxmpnu1altnii3ilslmDelnvp;()texomr3iy1fatrau sls0srxoio io1lpt  net (fsrra( pot4aptn octydls2rmnvo (0 eenxo iydlpt  u i s trxrir oo1omt lfviat)aDum(mo;o1tpe  ieild m ran p (0alenio iy1fa raueo ( srxmim3iy4al  lfci (f 2tau o;o0tlx mfcilt mDuln sn() reoif ty1fm elnvi ( trtm(opiy1llenmfvt () Drr(mpoo0aexo ociydfa2rmn ont4arenmr3iytlp eln il(  2toxr iy4lleelfvtat)sDra( ont0tpt ifeildls eanmsnu) ltnxo3oa1lp  lnvs s  2xriopoo1lmenlncs t  Dra(m ;u0tpxoifeiyd mDrlnmo u4tlenxo tadop  aneols0 rtrxm oodlp nmnvi t  Dum( pnt4oeen fcildlaDean pnu4trenir tatfmDeanesl()s2trim nudalen nvi ( arua(  nt4opt iociytfmDemnmp t0tltrmocia1oa  aies t0srumir iu1amtnlics t) Drr( onu4oltnmocilsla2rm(mo;t4areoio iadfpD  u sl(0s2umio3iudamt mfvtasfaDurxroou1opeo i3iltla rl(mo u0 eenxo3oatla rln o t0srtrxo oo4am   fctlt)a2rrurpnu4alt moeild s2ul(vs t)trxnir3iydoa rli ol( t2toxo ny1apt mics s  Drrur ;u4teto o3iyt s rm( o;t4 rxrio3oydlaD an ols0setrio3iu4ll e icil(faDurxronu4opeomoeiydfs2ua( s;()trtomf3tadlmtelu s s)seurxr iudapen fviltfsDrmx poo0oeeomfciadlmDeln o u4altnir3oo1lmDraivsl()sexm(rpiydoltnlnetltfa2tmuro;u1olxo oeiys a2umnms;(0 rtnxrciodfaDr uvol() rxrxrpiu1lm n neia() 2trumoou1olxnio3tys sDua( p t4trxomo ta1fpD aneolt srxo(o nu1am emfvsl(faDra(roou1oet if3tat s rmu p u4alxoif3tydlp   iei;(0teur(r3no1lme lneiltfs2ur(ro;u0opeomf3iyt a2uauvp;()aexnif ia1fmte u olt0trtmxo3oy4lm e net tf Drm(r ;u4aet  ictyslm2um( on(4 eenmr oa1fptr u i;s)trxm(o iy4optnmfvtls s2uaxr ;u1oee  fctad m elnmpnt) rtoirciytlmt lnvsl( s2uoxm oydopt  fctl(f 2ta(m ;u0oexo fctadla2eauvs;(0 eenif3tatoa  aneol(0 ruoxrpoudlm emfcta()aDtr( pot0aptoii3iyd a2rlu o u0aetnmr3iy1lm e ieo;( srxoxmpny1ll   nct sfsDuaxr oo0opxnmfcildfm2elnvon()tetnmo oydomteaieo t srtm(r3iudomt  ncsa( sDua(m ;o0tet  f3ildla ea(vs u)artnxfciadlaDelnvils  2um(m ou4ape  ies t srtmxmoot1apx if3iaslsDemu s t0texoiocoo1fa r uei;s trxrxr oudol  mfvsls) 2rax p;o0ope mociadfmDuanmo t4artrxf3oydlp rli s s0 rurirpoudolt lfcta( srtmx p;u1tpen feiadfmDuauvpn(4tlerxf tadoaDr u o;s) 2tmio iydam n nci (  Duaxrp;t4apto i3iltfs2rmnvp u0 ltrirciodoateauvsl(0s2xm(r3nudop elnctas aDrm(mp;u0altn ociadls2rl(vo (4 eermf3tytlmtrau o;t  rxo(opiu1ole lnes s)srrmum ot1teeoii3tatla ul(monu0tltnxr3oa1fp r nvs t)t2tmio iu4llt  feiltf rrmxroou1openifciyd a rlu onu0tltrxo3iy1oa elivo;()tetoio3oo4lmen fci s s2rrumpoo1aptoioeiasfmDem(msn(4 rerif3oa1lpt  i ilt) rtmimpnydlpenmnviat)arurxm no1optnmiciaslmDranvp;(4tetnmo oydfpDranei s) euo(m3iodom n nesl(faDumumonu4aptomoeils a uanvs (0tlenxf ootlmDraieo;s s2xr(mpno1aleemfvtl()s2rmxr ;u0opxo icildfsDuln p;t)artoio oadlpte nei t trxmxo3iudapeemnvtat)aDta(moot1opxo octadfa ra(vs;u0trtomo oy1fmDr uvs t0s2xoio no1alenmfetls)srum(r oo4oeenmfciatlsDeauvpnu0treoxf tydfmt  i sls0t2umxm3io4oleemivi ()s2um(m ou0oeen octldfs2rl( snt0texomo io1optrai o;t trtr(o oodop  lnvsatf rumuront4alx  f3iyd s ra( o;()tltnifciytomtrlu ols setoxr oy1ome lfcsls sDraxrpot0texnifeiltlmDrmnvsnt) eerio3to1om rli o s)t2xrio oo1lptelietas) 2raxmono4tleoioeiydfs2raumo (4tlxrmfcio1fm eaiei t0 etmxm iydomenmict s sDtau onu1olxoifctysfa2umnmo;()trxomf3ia1oatrli i s srtmxr3nu1ol emietat a2tm(  no0tpen i3tatfm2uauvp;(4arxoxf3oydlpD lnvo s  etmio3io1lmee fvs s  2rm(rp;u0apxnmf3iadfa2el(vo;t)aetrifciytfptranesls trxrir3nudalen ncils)sDua(mono1ale ioeildfa2eaump;u4trtrmrciytfm ranei t0 2uriopou1om elfet s)sDtrxrpoo4tptn o3iysfm uaumo;t0 rtrxf3todlpt an s s trtoxr3no4lle mfvi (  2urx  nt0oexn i3ilt s ua(vonu4 exomo oodfa  ln o;s0t2xm(m oo4om  mfcil( a2tr( o;u4apxnmietlslm2uanmo u0alxrmf3tadfat  nvo t) 2xmir3ny4ap  mncsat arrr(m ;u0alto oeilsfm2umn p;(4 exrxo ta1oaDe uvi s texo(o oydlme mfcslsfs2rax p;t1apxnioetytfm2uanms;u) lxomr3oodoatrli sl( srtm(o ny4op  mfcslt a2rmxmp;o4teeomfciydlaDemnmo t)trxnxrciy1lp rai o t  2xoim ou1lme mnvtl()sDtax oou1apeo octasfa uan pn()arxnmf oo1opte iesl(  exr(o3nodalenlfvtatfaDra(mp;t4opxnmi3iat aDem(vp u0areomf iatlaD  ivi;s t2xoxmpiu4lpe livtlsfsrumu pou0teeo ietasfs2umumo;u)texomo iydfm elnei (0t2urxo3ny4omtelfcia( artmx o;t1tlxo ieiytfaDrlnmpnt4 exnio3iatfp e ues t  2toimpiudalenlfcs s)sDra(mono1aet mociaslm raumon(0 ltomfcoa1fmDrlneils)t2xmxrpnydap elfei t) rumur ;t0opxnio3tydls rmuvo;t)trtnmrcootfmDeaneo;t)srtoxopoo4ame mnvsatfs2rr(m ot1aet  ietyt aDelump;t0trxoxo3tydlmD  u ilt0srtrxo iy4apt mfetas  rurxrp;t4oetn ietlt a rmnvo;(0tlxniocoatfaD aivo;( teur(o3ou1ap nmfcta(fs2tm(m ou0oltomictatla rmump ()aetrmociadla  an slt)srxmim3ny1ale  fvils  Dtmu ont0olxnifeiytlm2rln s t0 rxnif3oytfate nvi t t2uriopiy1ape mfvtatfaDur(ro;o1tltn iciatla2ul( p;t4 rtnxrcty1fptran o;() 2tr(opiu1lp e nvilt sDumxrpnt1olenmieiys mDem(vo;t4texrmfciodlm e nes s0s2urxrpnodalen fcsl( arra( pnu0aex miciysfa2raums u0 rxrif3tadfmte nes s) exrxmpou1llt mics t a2rmxrpou1aetomo3tad m eau p u0 rtnmo3todfmD  neols)srxrxr3nydame livs sf 2urx pnu4tlxo f3iydfa ranvo () eermrctatlmDrli sl( t2urimpoydapt  ietltf rtrumpnu0aex  fcias a2ua( s (4aeenmfctadfpteaues s)tetoxrpio1amenlnesa(fa2um(rpno1apxnmfetat mDrmuvp t) renxrcoo1fp r u i;s srxrir nudll nlnet t)srtrurpnt4aeenmo3iydfm2rluvs;(0tlxnxf3tatfmtraneo;s0 eur(r3nu4ameeliciatf Drm( p;u0tpxnmo3tlsfaDua(vs;t4trxriociodlmDeauei s seur(r3nu1am  mfvias  2ur(rpno1tpeoifeildfsDemnvp;u4tltoxrcoy1oate nvi;t  rtrim oudlle lfvt sfs2rmu p;u0olto o3tas a2umu o;u4tlxnir3iydopt auvols0s2xoim iodlm  lnct s sDumxmp;u4tpt mfciaslmDrl(vp;t4trermocoo1la rlivs t)t2to(m oo4lmtnlnei (f 2umxm ou0olx moctadlm rm(vs t4 exnif iy1opD  i olt) rtm(r3iodop  lnvs s)srtrxm ;u4ale if3tlsfs ran o u0trxniocoydopt  u i s)trxmxo iy1lleemfcsls a2tru pnu1olxomfctldls uanms;t4aeeomoctotfp raies;()s2umxo3nodllenlnesat)a2uax  ;u0teeoif3tls s2ranvpnu)aexrmr tatla rlu o t  ruo(m nudom n nvslsfaDrrurpnu4aptomfctltlaDuanvont4trtoirciytlmte ivo s0 2umxr3ny4omeemfciat)s2raxrpnt1oltomfeiydfaDelu onu0artrxr3oy1la rlu s s0 2xmxopnu1llenlfci (f Dumu pot1tlxomfetyt a2rmuvs t0 reoxr ia1oatr uei t0 exoxrpiydll   nvs () 2rr( pnu4aee mi3iydfa2rmnms (0arerxr oodla elnes t sruo(r3oy1oltnlivtas arrrurpot1teenii3ias m2rau s;u0trtoio iydfpt lneols setoio oudamtn feiatfartmxmp;o4tpe ii3iatfa uln p;t4tetriocio1fpDr ueols0 2umimpny1ape  nvtltfs2rrur nt1ope if3iat s ra(vp;u0trxnxf3oadoate uei (0 ruoxo3ou1lm  lfvias aDumxmpnu1tet mieiat m ea(vonu0 rtoxr to1oaDranvi (  euoir nu4lp nlnvia(fsrtr(  ou4alx iictysla2uauvp u0tlenir oytomtrlnvs (0srto(r3ou4llen ncsl( arurump;u0aptnii3tadfs2raumon(4alerxociadlmD aueo (0 2umxm oo1lmtemfes ()sDrmxmpnt4apeomfciysfm2uan o;u4 ltrxocia1omte ivi;s)t2xrxo3nu1lm emieil()a2tmxrpnt1aetnmfctltlm2ran o u4 ltomfctadlmD ln ils)trurir3no1om  mivslt)s2raxrono1apt  oetad s emums u)artrir3ootfmteaneil( teuoxr ou4ameelietasf rrru pnt1openiieiaslmDel( sn(0 etoif tytfmt lueo t s2xrirpou4ame mict ( aDrm(mpnt1tetnio3tas m rlu p ()altrif3iytomDrlnvo;t trur(o3ou1aptn ivt ()srtrurpot4oexn ociltfmDea(vsnt) lenio iytlmtr i olt0t2urxr3no1amenlfcsls)s2uaum ot4aexomietldfsDrl(mpn(0areoio3iotoaDrau i s t2to(rpiy4ll   fvsa(  Dtm(roou4opeoiictad mDeaumo;t)teenxf oadopteauvo t)t2xrir nudlm emict ()arrr(rpnt4tlx  ictysfs rl(vs;t)tlxoio tydlm elivo;(0 rxo(m3nudlp nlnctas) 2urxmp;o1tpeoifcilt mDeau p u4tlxomfctytlpDeli ols0 2xoim nu1omeelfvi t) rtrxrpou1texn fcildfmDuau s u4alxrmociydfpDr ivo;t sexr(rpnodome  ictas arrrx o;t1opeo o3iasfs rmuvon(4trxrxr3oadoaDelnvols) rtmim ny4lm elnct t srra(rp;t4tpeoioeiat a uanmp;t0tltoifcio1op eanvs;()s2xrir iu1ll nmfet ( a2rru  no0tlxnmoeiadfmDum(vp (4 renmr3io1la r u s;()trtrimpno4ameemfctat) Drax  ot4tptnioctydlmDean snu4 eenif3iydfa e nvs (0srtr(r3oodop nmfvs sfsrtmump;u4oeto ietltfs2uauvon(0 lxoifciadlpt  u sl()tetoxo3io1amt mfesas)a2rr(mo;t4oltn oeiys a2eanms;(0texoio tadfpteluvi;s)texrxr oudaptelici (fsDrmxr ou1tlx mietatla ulu p;()aleomfcta1fmt aueo ( truoxr3oy4lpeemncsls)srrm( oou1oleo i3iyt mDrmu p;t4 rtnmf3iydoat lueo;s  etr(o oy1lltelncta(farur(rooo1aeenmo3iltlsDrmump;t0tlxrmfcta1fm   uvs t)texr(o3iu1ope mfet ( artrx ooo4olxnifeilsls em( o;u0teerif ta1opDr ies t0tetrim io1lp emfvils)arra(mpou0optn octatfmDeanvs;t0tltoio iadoaDelies;s trumir iu4lltnlfesl()sDtm(roou1tpen fetytls el(ms;u0 eeoxr todopt  uvsl(  eto(mpiudlmt lieta()aDtmumont1optnif3iys a2rlu o u)trtrxf iotoaDeaies;(0trtrio3iu1ol  lnvt t) rtmurooo4tptnmfeiytlm2ul(mo;(0trxrxo iydlatraies t trxrio io4lp   feia()srtmuro;t1oltoif3ildfsDua(vs;t)teenxf3to1laD ai olt0t2tm(r nu4lp nlnvsasf 2tr(  ;u4alx mi3ilslmDeanms (0 eenxr3iotfptrlu o;( t2xo(rpno4lmtemnetl(f Drmu  ou0tlxn octldlm rmnvp t) lxnifcty1oateliei;(0 rur(rpny1om n nvi (f Dumx  ;t0tptn f3iatlsDem(mp t4arxnircoo1fm eli s s trum(mpnodapte ieia() Dumxrono0tpx  oetlt m2uan s;t) renxfciadlatrlieslt) 2trirpnudamtnlivtl()sDrmxm ou1opeo i3tlslm2ea( pnu0aeeoxr oatlm  ln ils)texoxo oo4lpee fei () rum(rpou0ope mf3iys a2rauvs;u4teenxr oodlmt li o ( srxrio nu1lp e fetlsfarraum ou1tltnif3iltlsDrm(mp t0texriocta1lmteliei s)texrxm3io4openmfci s) 2ua(m ;o0tlen fcildfs ua(vpnt0 exnxf ia1omteaues;t)srtmim nu4ap  lfesa() 2urum oo0aptoifctasfa2eau s u4aleomrcoo1oatr n sls)s2urxopoo4lpe mict tfaruru  ;u1teen iciys s ulnms;t) rxoxrctydlpt au s t0texmxm ou1ap n fvtlsf Drruront0oee moetys aDul(vp;(0alxrirctydlpteln s ( texr(mpoy1ole lics s) 2uaxmpoo4opt mo3ildla2ra( pnt)texnif tatlm   uvi;t)trtm(o3iodopee ieia( s2urxmpno4teto o3ildlm2elump;()trtrioctytom  liei;t) 2tr(o ny4om  mneta(  Duaumo;o1oex io3tydls2um(mo () rtoxfctadfp e iesls s2um(r oydomt lnesl()aDuaxm ;o4aeeo ietydfm ra( o;u4tetoxo3tydoaDrlieo;t s2tmimpnydlp nlfvtl(  Dtaxrpno1aee mf3tydlm2rlnvsnt4tltnmr iodfp eanvi;s seuo(o oudaptnlncil( sDtr( pou1olx mfeiatfm ua(vs;u0tetnmf3todom   uei s0 rtrio3oy4op   ivi s aDtax  ou4ope mietaslm emuvo;u4aexrmr3oatfm  lueilt)sexoxm3no4lmtelfeia() Dtau pno4tlto feildfs2rlnmo u) exoircoytlmD  u o;s)texoxopnodlme  icsl( sruau pou4tptnmi3iaslaDraumsnu0altrmociytfa  aieil(0 etr(m3nodlmt mfvs tf Dum(rp;t1oex mf3iadls2rluvp (4tetoxoctadfmDe ueo;t0tetmimpoodap n ncsat)srraxr ;t0oeenmo3tas aDran o;t) exrxf io1oaDrau i;(0srxrir oodlp nmfvtlt) rraxmont4alxomfeiad a emn s u0 lxoxrcty1fp elivilt0 ruo(m no4lpt  fvi ()srtr(mp;u0tpxo iciad m rlnvs u0alenio oy1faDr ivi;()setmimpoy1llt lics (  Dururooo0tptnmoetydlsDelnmp;u)trxomr3to1latrai sls0sexmxm3oudap  lnvias  Drrxmpnt0aet mietlt a elu o t0arerxf3ootop eli ols  eurir3no1opt licia()s2urur no4apeo f3tyd sDem(ms;u4trtrif iytfaD lnvi;t)sruoim3nodalen fetls) 2truro;t1olen fcildlsDel(vsn() rtomfciytomteauvs;s trxm(r no1alee fcs t)s2tmx pno0aee mfciadfs2rluvonu) lenxf3ia1lmDrlnvs;( s2xmxo3nodllenlfesltfarta(m ot4alt ifcildfm ea( o;(0altnmo oodopDrlnvol(0teurxmpoy1aptelfes (  2urumoou0olt  f3iatfm2rlnms (0 lxrif3iytfp  aivolt)trxrxm iu4amt lici s)s2umuro;t1tltniocils mDumn o;t0alenmf3oytfm  anei;s t2xrxrpny1lm  lfes s sDumxrpou0oltnmi3iysfsDem(vpnu0 rermf tytom eai s;() rurio3oy4llee ics ( a2umurpnu0opeoiociyslmDeau sn(0tetnmocty1fp rlivi t0texoxm ny1ole  nct s srtmur nt4alxo fcias m rmumont0tlxomocio1fpDrlivsl(0t2uo(rpnu1am emivtas) Drm(rpnt1tetoio3tytfa2ul(vo t0texomocia1op e n i;s0srurxo3no4op nlfci s) Dumxmp;u1aeeo o3tydfs2ranms t)trtoir to1faD ai s t)sexr(m nodap elieilsfaDrr(m oo4oltn i3iatfa eluvp;t4 lxrifcia1omt livo t)s2tmio ou1ole lnvi ()srurumooo0aptniieiatls2ea(msnt4 rxrxo3oa1lp  lnvi t t2xrim ou1lp nlivtls)arur(monu1ale mo3tad mDuaumo;u4aetnmrctotfm rai sls0s2trim3ou1om nmici t)sDrax  nu0tpxn f3iytfm2ea( pn(4 lxnifcoodfpD luvi;(0setoxm3io4amtnmnci t  Dtrxr ;t4olt ifetldla2raumsn(4 rxoxo3oodfa rlnvsls0s2xm(r ny1altnliei ()s2rr(ronu4apt mf3iyd m2ulnms u0artrmo3tydfmtran o s0 eumir no1amee nvtls)s2rrxmp;u4oet mf3iysfmDelnvo u4tetrmr todom   ivo s setm(o iydolt lnviatf rrr(mono1aex mo3tys aDel(vp;u4texnxf oytop r ues;s) 2xmxo3nydlp   fes t) 2tmumoou4tee  fctyslmDrlu p t)tetoxf3to1optrai i s  rtmimpiydol e netl(  Duaxrpou0apxnmfeias aDeau o;()altnmo3oa1lpteanvslt  2xoir3iu1lltnlnetls)a2rm(m nu4olt moetysfm em(mp;() ltoxrcta1lmteau o s)trxo(mpoudole mict sfaDtaxrp;t4apxnifeiytfa2ranms;(4 exoif3io1la rln ol(0trxm(m3iu1opee nei s s2uaxmo;u1opeomfctlsfsDranmp;t0tlxomo oytfm  lu i t  2tr(r3iodapen nvsa( a2rmxmpou1apxn feiltlm2em(msnu4alxoxf3iadoa  aivo;t  2trxm oy4am emnei sf rum(ronu1aeeoii3tldlm eln pn(0 rtnmociadlaDeauvi s trum(m nu4lmtn nci ()arurx pnt1teeomo3tydfaDulnvonu0 leoirciadfmt lnes;()srxrxrpoudap elnvtlsfaDta(mp;t0tetn fctys sDuanmp ()aexomr iotoptr uvsl( t2tmio3no4apenlfesasfsrrr(rpnt0opxoifciatfs em(von() lxoifcty1oa  lneo;s)seuoxr3nudoltnlfesat)a2taxronu0tpt moetltla uau pnt4aeerxrctotoa   nes t0s2umiopiydal nlnctas  Dtrxmp;o0olxn ociad a elums u4 lxnxfcoo1late i il() 2urxr ou4op elivs (farua(r ou0oeeo ieiatfm2rluvp;(0arermo oydlaDr uvi;( teuo(o3oo4opt lieia(fa2umx pno1tltnifeiys a ulnvo u4trxoioctodopDelivs;s)t2toxo oudomtemiesl() Dtmum nu0olxo ieiytls2emn snt0 renxo iadfaDrlies s)teuo(mpno4omenmfctasfs2rmu p;o1aptoifeias a elnvo t)alxniocoodfatranvo s0t2tr(m3no4omeemfet tf rta(ro;t1openmoetlt m uauvo;t0tetrmf tydfatr nvo t s2toxm3oodameemivi ()sDurxro;o1aexn ociat a rlnms t)tetrxrcoydlm ranesls0sexoir nydlltn fcsl( s2umxr ;t1tpt  ociadlaDeaums;u) etnmf3oa1omtr nvols0s2xr(m3nodlpen fvilt artr(m ;u0tpt ii3tyd aDrmuvpnt4 lxoif ty1lm elnvi;(0srumirpoy1omen ivilt)artru ono4oltnmoetatls2rmump (0aetrif iatoaDr nvilt)s2xm(r iu1ap   ivta(f 2um(mp;o0teeniictad mDul(vsn(4 rxomr oy1fm raivs;s)tetm(r nu4lmtemieslt)s2tmx oou1apen oetyt s uanvo t) rermo iotfp e n ol( srurxmpoy1ll e icilt)a2taxrp;o1teen i3iatfmDea(mp t0aetoiocootomtr ieolt) rum(o iudlpenmivtl( a2um(rono4apeo feilsla2umnvo t) rxrmrctydopte ues;t0seurim3oydlm  mnci s a2rmxrp;t0opto i3iad aDrau pnt4teeoioctotlp   ivilt0t2to(o nu1apte ncil( aDtmurono1aleo ietas sDel( pnu0 rxoir3tatfm  luvs;(  2xrxr no1lltelivtat  2raxrp;u0ape  ociat a2ulnvp;t4 rtrir3iodopteai ols)srur(opiu4om nlfviat)a2uaurp;o4optoio3ias a2rmuvs;u) rxrxr3iadfa eau s;s0srto(rpou1ole lies ()s2urx p;u0tpxniociatfm uln p u)tlxrmrciatlmD  n sls) ruoxo3nydlpeelnct ( arta(mpoo0aetoiieias m rmumont4tetnioctodopteli s;t  etrio3nu4lmt mfei sfa2uau pot1optomoctys a eanvs;u)tltoxocto1fmD  uvo;s0 rurxo oy1lleemfctl() rrau  nu0tee  oeildlm2ua(ms;(0 etrxr3oadoa rln ils trumiopiu1lm  mics (  Drmxrp;u1apeniieiasfm2emnmsnt0alxrxf oytlmt livsl(0texrxopoo4alee ietlsf 2rmur nu4tptomi3tatla2ea(vs t4aeerxr3tadfp rluvi;t srto(m3nodal elnci tfsDumxroot1tetomociydfa uaumsn(0arxoxrciydoaD  ues (0sexmxm3iudal   ivi tfarra(m oo0optnif3tatfa2uluvp (4altnxf totopt lnesls)seum(rpiy4oltelnesat  Dtrum ;u4alxn iciys sDeaumonu0 ltnxocta1op ranvi;s s2xrim nu1omenlnvil( arrax  ot4aleo fciysfa2ea(mp;(4trxrio3oatlpt lnei;( seto(o3iydlm emicil(f Dtmxr ;o4tlx mietys mDrmnmsnt0 rtoio ootlptelneo;(0sexmxmpio4altemfct s)arrmur ou1alxomoeiatlm rmumo;t0arxriocoa1lmt  nvs t0 exm(opiodll   fei s) rur(rooo1olt ioeiysfaDuau p;()aeeoiocoo1lptr ues t0s2toir3ny4ll nmiei ()sDua( o;o4opx  o3iasls ulumo u0trermfctytla  li s (0srtmir oodolte ivi tfs2rrxro;u4aptomfeiadfa ulnmo;u0trtnirciotlmte uvil()s2xoxo3iydoptemiesls aDtau p;t0olt mf3tasfa rl(vs;u4tlenmocoatlat  nvs t) exoxrpiodolt  fvsl(  rtauro;o1tpeniociatlsDuan o () etnmo3iotop rluvi;(0srtmio3ny1ll elfvslsfsrua(  ou4aee ifcild sDeanvs t) rxrirctydom r u s ()s2toim io4ll  licsl()aDtr(root4aetniiciadlmDrln s;u0aetrmrcoatfa rlies;() rumxr nu1omt lncta(fsDurxmooo4openmo3tas aDrl( o u) rtoif oydoa ranvs;(0 euo(o iu1alee ncil(  Duaumonu0open i3tys a2rmn o t0altnxo3oy1fm rau slt  exmxm io1openmfci tfsDrm(m oo4aeeomociasfaDeln s;u)arxnxo totlpDrai o () 2uoxo3iy4al  mneiatfa2tmu o;t1oexoii3ils sDelnvs u0 etnxocto1fa r n ols0seto(m3nodap e fvi (fa2ua(rp;t1olt mo3ilsla2rlu onu)arenmocoa1oaD  uvi t)t2trim no1omtnmnvil(faDrrxmont4aetnmi3iaslm emnvo u)tleoif iadfateauvs t)teumio3oodaleelietat)a2tau o;o0oetn ociltfs emump u4 lxomf iydfaD  n s;(0truoxopio1apte nvsls) Drm(m ;o0tltnioetys m eln snt0tltrmrcta1fptr neo;t0 2xrxopiodom  lnctls s2ra(moou1texoifeiyslm ul( s t0aeenmoctotlaDe nvol(  rtmir oodomtemfeiltf Duaxm ;t1oee  fetysfm2eanvsnt)tleoxr3ia1fm eaivs;t)trtrim3iu4am emnei s  Dur(mpno0tex mictld sDem(vo;u)altnmo iydlaDrlies;s)trxoio3iu1opt  feias  Drr(  oo1tpe mfciatlm em( pn() lxrmf3oa1faDr ueo;(  ruoxo oudlpenmnctl( a2tmxm ;u1tlxoiiciasls2ea(mo;u0trxnmrciytfmt  ivs t trumxrpny1lp  mncilsf Dum(m ;t1apxniieilslm2rlnvp;()tlerxr oatfmDe neo;(0 rumxopiy1lp nlfct tfsruau pot1aexnioeilt a2elu sn(4 eerxrcoo1lp   nei () rxmxopnydomtnlfesa( srua(  ou4olxnio3ils m2umn s;()trtomf oatoatrlivs s  rtmir ny1opt  fvils) rum(m ;u0oltnifetldfmDelnvs t)alxomocoodfmte u o t0s2urimpiodape mnesl(  2umx onu0teto octytfm2uanvs;t0 rxnircta1fmDrau o ()teurimpny1omtn ivs s aDtrur no4apxoifciadfs elu pnu) lerio3oo1lmD  i ol(0 rxm(rpou1aleemnci s) 2ra(rp;t1tlenmo3iaslsDemnmont0trtrxo iadfa rauvi (  rto(r3ou1apenlfvsl( sDum(r ;t1olt mfctasfs2uan p t) rtrxf3iy1op raneilt)setrimpoo4ll  lfcs t  2ur(r ou0alen fcilsfa2rlnvont4 renir iatoptr u ils) etmim3nu1om elnei t sDumx pnu1tpe mieilsfa2eanvonu0arenifctotfm e uvo;t0s2xmio3no1olt  nesa(f rrru ont0tptomietldfs2emu snt0artnxo3tytoaDraueo;()srxrxmpny1amtemfvsa( arrrxmo;o4oleomoeild a rl( onu)trtoxf3oa1fmt au i;(0 euoim nydlltnmnetat s2ra(m ot1oeeo oeiasfm2ranmon()tltnxr3ia1fmDeau il()srxo(m nu1omt  fciltf Dtrxrooo4aptoiieilsfaDemumsnt)aeerir3tydoat ai ol() etrirpny1ll elfvtls  2rrumo;o4oleomfciasfaDumumont)alxnxfciatomt lnvo;()sexoim3oy4opee ieta(  rrru  ot4oet  f3iasfm2ra(vsn()arxrmo3oydoptelu s ( srto(r no4ome  fvias)a2ra( o;t4tpxo ieiadfa el(vs;u0tlxnir totlmte ies t  eumxrpno1lltn ieta() Duaur ;o1alxn oetlsfsDrl(vo t) etrmrciytopte n s ()setoir3iu4aptn nci () Durxm ou4alxniiciasfmDumnvpnu)trermf3oydlm rlneo;(  etmxm3no1opeemiciat  2ua(mpno0opt ii3tasla um(vp;(4trxrmr3oadoa   u o;s texrim3nodamtnlicsa(f rra(monu4opeoio3tyd aDra(vs u4trtrxoctadoatr neo;(0 2to(r3io4lme mfcslt artmxrpoo4oetniicild a2ra( onu) ltrir iatoptr nei s sruo(m oy4omenlncias)a2tr( p;t0tpxn iciadlm2elnvpnu) renxrctydlaDrluvs (  2tr(mpnu1omen neilt artmur ;o4tlt moetls m eanms;(4teenmrcoytopteliei t)tetm(m3oy1lmee iet tf Dtr(ronu4alt mieild s em(mo (4artoxo ty1lpteai ol(0 euoxm3io4llt lfesls)srua( pou0aleo ictat m eauvsnt)texnir3to1oaDrluvs s trtrxr3iu1ap nmfei t aDrmumont4tet ioctlsla eluvo () ltrmociytlatelieslt) rumio oy4llt lieil( arrru  no1tpxniieiasfa umuvpn(4 exomr3oo1fptr u i t0s2umio oo4optelfeta()aDtrxrp;o4oex ioctadfa umumo (4tlxnxo3tatlatr ivsls0s2tr(opnydllen ivil()a2tm(roou0aee  feiytfs2eauvp (4tltrif3ta1fmt  ivi s0 2urim nodalenmfvsl()s2ra( pno1apxo oetltfmDelums u4tlxrxfcootfm rauvs;t0trtmxmpou1amtemfcsatf rraxm ;o4oetnifciad s uan p t)artrirciytlmDeluvils)teto(mpnu4lmtnmnviasfs2rax p;o1opxn f3ilsfs ranms;t) lxrio iatomDr ues s0trxmxrpiu1lpt mfesls srumxmo;t1altnmfeiasfs2rm( sn(4tetomf3oy1om e u il( trxrxo3iudopenlfcslt a2umx  nu4tpt  f3tld aDulnmp (4 lxrxo3tydlmteluvi s trur(m io4lptemies tf 2rm( oou4aex ifeiyt s2emnmpnu)tleoxfciytlp  livs s  rxoimpoo4altemncsasf rrrxm no4alto feildfm2uluvp t) renirctadlmD livs;s) 2tm(m nydap  lfvt s artr(  nu4altoii3iys mDrl( o;t4altomo3ia1lpDr i i;t setr(o oy1lm n nctltfaDtm(ro;u0tltnif3tatlm2ua(mp;t) exrxr3iytoaDrlivslt srtoxrpoudope livsat s2tauro;o4tetn oeiyd a2uauvo ()tlxnxo totfm eanei;s  rxmxrpiy1lpeemiviat) 2tm(rono4aeen oeiadlmDum(vpn()alerxo iydopDr n il() eto(r iydame mneil(  ruaxr ;u0apeomfcils sDul(vpn(0texoio3iydoateanes;t trxo(r oy1alenmneiat)aDumumpnu1tpeo ieias s2elumsn(0teenxrcty1faDeluei;s0s2umirpio1lptnmfctlt)srraum ou4texniietlslm umumon(0texnmf iydlp  livo;s trum(r iudoltnmnetlsf Drau ont1tptnii3ildla eauvo;t)aexoxf ty1omteluvs;t0 rum(r oo1ll  mfvsls) 2rm(rpnu0apx  ietys s2emuvo;u0texniocootopt  ivol( truoio iy1omen iet sfs2ur(m ;t1ale ii3iys sDumnmp;(4 lenmrctodlmDeau slt)t2umio3io1om n ivtlt) 2ur(mpnt0aetnio3ild mDemn s t) rtoxo3iy1op ran sl() 2tm(o nydopen fei (faDrmuro;o0open ictls a2eauvp;u4 exoxr oo1lp elneslt) rto(m nydop  mnvsls srrrxm nt1tee  ociyslaDeau o t)trxoif3io1omtrliei ()truoir3oy4lpt mncias arta(r nu1tet  o3iysfs uluvo u4 eeoio3tatoaDrlnvsl(  eurxo3oudalenmnct ( arum( o;t0opt  f3ild mDel( o;t)tleoio3todlm rluvslt) ruoxo3nu1om elfesl( a2rrxrp;u4apxnmfciatlmDeluvo;()tlxnxr3oo1fa   i o;t0seum(r nu1ape lfci (farrrurp;u4opxnmfcilt m2rlu pnu0teerxfcoadlpDeai s;(0teumxrpnydll nlnetltf rrmx p;o0optomiciytla2rl(vo u4arxoir tydomtelivi;t trxrxr io1ap n nvta()aruaxroou1aet  f3tls a2rauvon() eerirciatfmt  nvi t) 2trio3oodam   ivtl()s2rax oou4ope ioeiytfs elumo u0 eerxfcta1lm r ues;()seumirpoydlp elneil()a2rrx onu0opxoioeiydfs ulu s;t0alxoifcoo1fmD auvs s)seurir3iu4om e ivt tfsrrrxm ou4olt mieils mDuauvon(4teenxfctodom   nvi;(0srxrxr3no1lptn nesl( sDua(r nu1aeen ocild aDrln snt) ltoifcoa1fp  aueo;(0sexo(mpou4om   nci s)aDtau pou0tlx if3ilt a ea(vonu4aetrxr3oo1oatrlnvo;s0 rxo(rpou1al e fet s sDta(mo;u1oetniocildfa2elnms ()texrir3iytoatr ues;(0teto(m3nudole mfvsat  rrr(r ou0oetn feiasfsDeau o () rtrir3iadlmtraieo t0 2toir iy1altnmies (fsDumumpot0oexo i3iadfm uauvs t4 lxnxo oy1faD  ivol()tetoio oo1omt lneslt srur(  ou0aptomieilt s2uan snt4trtrmfcoa1lpt au i;t teuo(o iodap emiciatf rrmurono4oeenioeiyslsDran snt4aetoxrcoatfmtrlieo;( s2uoxr io4ap   nes s) Dtrx p;t1oetn f3iad aDuaumpnt4tlxomrciy1lp raivi;s0s2xoxo3nu4lp elnctl() Drr(  nu0ape ifctysfa2rluvsnu0tlxrifciy1la   nesls)srtoirpno4olt mnvi (fs2umumpnt4aptnifciatlm2rm(mp;(0aexriocto1lp r nvo t) 2xo(m io1olt mfcs t) rrmu p;t4oltoifciltfaDranvs u4tetoxo iodop rluvs;s0trtrxrpno1al   ieiat a2uau oot4ape mfctys m2uanmont4arxrio3io1oatrlnvo;s)srxmio nu4lptnmnvt t)arraum ;t1olt moeiyd mDrlnmsnt4aleoxo oa1op e nei s0teto(o3oy1opeemfvt ()arumxmoou1tet mociydfs ul(vs;u) exoxo oa1opt  u i;( srtmir ny4alenlfet t)s2tru  ;o1teen f3iyd s elnmp;u4 exnir oatfaDeli s;( t2xm(m3no4ap  mics t) 2trurpoo0opx mociys a raums u4tltoxo3to1fatr ieslt)sruo(mpiu1ll nmnvils) 2rauroou1tet mocild m2umu p;u0trtomociotfat luvi;t)texoxm oy4am  lfcsltf Dtm(  oo0aeeomf3tltla2eanvp u4 eeoio3oo1lmDeanvo ()setrio3nu4lmtemnvs ( srrrx o;t0aptnifctyd s umnmp;t4trtrxr3ty1laDe ivils0s2xrxo ou4ol nlncia(fs2umu p;t0aptniictltlsDua(vo;() lxnxr iodomtr n slt0seto(r no1ameelfvi (f Drm(rp;o0oetoiictlslmDuln pn(4 rtoifciy1lateli olt)sruoirpoodap n fcils) rtmxr ;t4tpxo ociltlaDulnms t0 rtnxo todfpDe u s s)trtmxm3nu1lm nlictltfa2rr(roou1optoioetlt m uanmo u0alerio todfaD lieo;t) 2tmir3oy4altnmfct t arumurp;o1opeoio3iyt aDrauvs u) rtrmocto1oaD auei s)srurxr3oudamenlncia(f rtr(moot4texn fetadlmDra( s () rxoxf3totfa  lu il(  2tr(o oo4lptnmivt s sDrr(rpou4aet  ictadls ra(mon(4 eenxfcoodlaDr ivils) rtoxrpou4alt  fet tfaDtaxrpou1aeenmietlt a rauvsnt4alenxfcoydop  anvo s0s2xrimpio1ap e fei t artaurpoo0alt iieiydla rl( o;u)treomf3io1oateaivs;s sruo(r3iu4lp   netls aDrm(  no4tpen i3iyslm2umn s;t0 eeomfcta1oaD lnvs;s0 2tmimpiodap e feia(fsDrrumo;t1olxnmfetydla rl( s t)tltrxo3to1faDraivi t) 2uoim3iy4lptnlnetasfa2uau pnu1apto ieildfs ul(vs;u4 exrmf iydopDranvo;s0 rtoio3oudop nmiei tf 2urxmont1apt mfeiad s2um(vp t) reoxociydfa eli s (  2urir3io1apenmfeia()artrxro;o4tlt mieildls2umnvp u)artrifcoydfp ranvo (  exo(r3iu4op nmietl()s2tm(  ;u0aptomocias mDum( ont)trermfcta1faDeaueol( s2xmxmpnodope lfcsasf 2tmu  no4olx ioeild sDrlu ont4 ltnxfciadlpDrlu i;t)s2xriopiy4op  mfciltfsDta(  ou0oet ifctys s raumsnt)trenifcto1omD  n il()s2urxopio4altn fci s  rumum ;o1ape mfetasfm ua(vp u0 etrmr3io1latrlieolt  exo(opiy4ll emncslt s2umur ;t4oltnio3iydls rl( s t0 eerxf oodopD  u ols0trtmim iydaptnlncsasfs2rau o;o4aptoioctydls el(mo;u0teerxr3totfmt  ivo;t  2tm(m3oo4opeemfvs tfartmu  nu0oeen ictldfsDea(vpn() lxoxfcio1lpD luvo;t)tetmxmpio4olte iviltfs2tmum oo4optnioetlsla2umn snt)alerxocty1opD ln o t0s2tmxrpiu1lmt  nci s  rrruront0oexomfctadlm2rm( o u) etoifcto1lm  aueilt0 etmiopoo4llt  neia( arraxr ;u4olx  ociys a eau o;(4 eerircootop   i s s0s2trxrpoo1lmte ivi sfaDtm(  nu4apxnioetaslmDeanms () etnmf3tydomDeaiei;t)s2xoim3iydoltnlfvsa()srrax o;t1oleo i3iltfm ean sn()alxnmoctadom  ln o ( srtr(r ou4ll  mnctl(fa2ra(m ;o0olto ociyslaDumn o (4 rtoxfctytlpteanvo s)teuoimpoo4alt lnviasfsrurxm oo1olen fciyd mDrmuvo;t0alxrxrciatfaD auei s  rumio3ou4ll  lieiltfsrta(rpnt0ape  ictasfs ean p;t0artrmr3tatom rlivsl( t2urir3nu4ameelivt (f 2tr(mont4aetomo3iasfs2ea(vo u0 lxrif to1omt lu i;s0 eumxr oo4al emivtl()srtrx  nt1teto icilslsDumuvo ()alxoifcty1fateaivolt0 2umir iydape  fctl(faruaxrooo4tee iietadlaDeluvont)tltnxociy1lmDr n o;()trtmxm3oy1lpt mivi t a2tm(ronu0tltoifciatfm2ranmo u0tlxrmr3oodlmteau s;(0seumio iodlpenmicils  Dtru  nt4alx ioeiad m2umnvonu)tlxrmf oytopt li i s s2xrxopio1optemnci tfarrr(ronu1alxnmf3iysfmDul(vo t) renmr ta1fmt  nvo s0 2xo(m3oo1lp  lnvi (f 2tm(roou4open ictydfs2umnvp u)aetrxf iodomD  uei;t0t2xo(opiu4ap  lfvtat arumu  oo4olxomo3iydfmDum( o;u0 ltrir iotoptr u ols0teurxr3iy4aptn nviatfa2uau  nu4tlxomoeildfmDel(vp;(4 rxomo ty1lpD ln ils0truo(m3oodap  lnvslt)s2rr(m ;t0tptn iciltfm2uanmp;t)aleoirciytoaD  ivils0 2tmim3nu4openmfcsatfsrtaxroot0opxo oetlt s rmnmo t0 rxoxf3iodom ranvo;s setoim iu4openlfvslsf rumx  ;t4aptnioeilsls2el( snt4 rxnxf ta1opte ues;s)texmim3io1aleemnci t) 2raumont4aeenmi3ildfsDrl(mo u0 ltrxf3iadfp elnvilt0tetoio nydlltn ncsat)a2tmurp;u1tlxn ietlsls elnvpn(0 lxoxr3iotom  auesl(0srtoxo3no4alt  fesat)aDtr(m ou0tpe mo3iat a eln p u)altnxocoydlatrlnvo;t0 rxm(opiu4omenlfeilt) 2tau pnt4opt mf3iydfsDumn on(0 lenmr ootla rai o;t0 rxm(rpio4oleemictat  rum(  nu4tpt  iciat s elnmo u4tlenio3oo1lmteau i s) eumxr io4apenmnctlt  2taxmono4tle iocildlaDrmump u0aexrxf3totomDranes;t  2xoxopiudam nlfvilt)srrrxmooo4olto ociyt m em( p u) rxrioctodoat auei;t trxr(m ny4olt liesltfa2umumpnt1oeto ictas a umnvs;u)tlxoxr3oodlm rlnvils  rxm(m io4amenmiesl( a2ur(  nu0aexnif3iltfa2uauvonu)aleoio3iadoa rlivolt sexrxmpiudameelies () Dtmum ;u4texo ieiydlsDeanmonu4 ltoxo3io1optr ieils) rurxo3no4lptelnvil(  Duru  ou0alxnmfeias mDul(vpnu4aetrmo iadfpD lu s;s)s2urxo iu1altn ncta(  rrmumpnt1opt ioetyd mDulums;u0tlerxf oytfm elu s t texoxo oy4lptemictls  rtm( ont1tlxnmicildla eaumo;u)trxrxr3oadomtrai i t0 2xo(rpoydol  lict sf rtru ono1oleomfciltla elu snu) rtoio totoa r i s s trur(o3oy1ll n ivtas) rtr(rpot0aex mf3iatfmDrm(von(0trtoxr3oydfpDeluvi;(0 2uoxo3io4ome mnesls)arua( oot1alt ifeilsfmDumnvo (4trenmocta1lmt lues;(0teum(o iydlpeelfvtl( a2rm(  nu1tpeomf3tysfm2em( o t) leomf iotfmDeaueils)seumio3no4lpenlnct (farrrxm ;t4tlxo f3tlsfs2uan p (4artomrciodfm e ueo s)srtr(r3ny1ol emneils aDrm(m nu4aexo oetatlm2eau on(0aleomrcoatlaD livolt) rtm(r3iu1ome livs t) 2rmu o;t1aee  oetatfa2rlu o (4tetoir oadla elnvs ()srxm(r nudal emivtlsfs2umu ont1oexoif3iyt mDeau s;(4texnxo3to1lmt lnes;t0teuoxmpiodopte ivias s2rau  no1apenioetld m ra(vs u4 rtnmrctadfmDeaivo (  2um(rpnu4ale  icils srua( p;u1tpx iociysla el(vo;u4teermo oy1fpD li sls)setmir nodameelivtl(fa2rr(r ;t4tpe mictysfs2rm(mp u) rtrmr3tatfate ies;s) 2toxm3iy4alte iei s)sDur(r ou1oetomiciasls um(vont4trtnxoctodfm   neo;t)s2urxrpiodam nlfvi (faDrm( oot0apeo f3ilt m emn o u) rxoif oydopDr ivs t0 rtmxo3nudale  neil()srrmxrono0texo ietls mDrmnvo;t4 leoifcoytoaDeli o s)seurxrpiudopenmici s  Dum( poo4oexnifctydfa ea( o u4tetrio totomtelivols)setr(rpoo1op   net t sDumumo;u0tpen o3tlslmDulnvs;t) etnmf3ta1omt  uei ( tetmim oydame  nciat s2tm(mp;t1altoif3iatfm2rlnms;t0aexnxo ty1omDelneslt0tetm(mpou1lptnmicsls)sDrau  nu0texomfciyt m eanvpnu4arxomf iytoatrlnvs;(0srurxrpoy4lp elnvtasf 2tau p;u4tpxnio3ildlmDelnmonu)areniocoy1op rln olt) 2um(opiudol   icsls) 2ur(m ;t0optniiciysls emnvo;u0aeenif3iadlmDranvol(0truriopny1om  mics (f Dua( oou4aeeoio3iatfm2emnvs t0 rxrmo3iytlate u o;s  2uriopny4llen ncsatfs2um( pou4olxoifciasfmDran on(4arxoir3to1fm   uvo ()sexrxr iudam e netas artaumoot1open fetasla2raumsn()arxnif oodfa rauvils0t2toio3iu4ol e nvsl( sDumu pnu4tpxn ictadlm2rm(msnt)trenir3oydomte uvi s) 2xoxr3ny1lltnlnetl() rra(mono1opx mfcildls2rm(mo;()artrmrcootla e nvs (0texoio3ou1alt lnciatfarrmx  no1aexnio3taslmDea(vpnu0trtomo oy1om   u i (  euo(rpiudomtnlivta(farrax  no0oeen fciytfs elnmo;()tetoxr tatfat  uvo s)sexoio no1llt lnesl() Drru poo1alenmoetadfa uau p t)aexoxf3iytlat  i sls)setoio iu1amen ncta(f rumumpou1tltnio3iadlsDrluvpnt0tetnxr3oo1lmDrai s;t srum(m3ny4ome lnvt tf Dtru ont0aee iociasfs2emuvsn(0trenmr3iatom r ues;()t2toir3oy1ome  fcil()a2tau  nu4altn fciadfm eanvsnt0 rxoxrciodoate ueslt  rxoio3nudllenlnetasfsrum(monu4ale mi3ils a2uln p ()trxnioctydfmD lneo;( teurirpny1lpenmnctl( aDrmxrpou4texomfctaslaDemnvo ()altrirciodop   u i t0trurxopiy4amtemnctat) rur(r nu0tpt mo3ilslm rau o u) renmf iydopte ivo s)s2tmxrpio4alen fviltfa2ur( pno0tpt ifeiltlm rlnvpnu) rtnio oy1fa   ueils  eumxo3iy1llt mieiat aDumumoot4tpx mo3tydfs2umu o;t0teeoir iydfmDran i t0trtr(o3oydol e nvt t) 2rmxrpnu1oexomieiysla eaums;u0texrmfcoatlmD  i s s)sexoxo3iu4amtnlncils srtau  ou0tlx if3iys a2el(mo u)altrmfciotfpDr ivi t)trxmim iodamtn nei t) Dtaump;o0apxo feiltfs2emn o;()tlermr oadoa  aivo;(  etrxo oydal elfcslt aDtrum nt4aee  iciysfm ran p (4tlxrxf tatomDrlneilt s2xriopiudopen neiat) 2rrx pnu4oetnmfctas s emn o;t)trtoxo3oy1om elnvs t0 2tr(mpoydam nmivtatfaDrr(  ;o1tpeoioetatlm eluvp t)tlxrxrcoodlp  livi t0sruo(m ny1amen ictls  2tmurpno0altnmoeilt aDrau p;t4trtoif3totlm elivo;s seur(o ou1om   fctlt)srraxrp;t4olx ifciyt m uanvp;u)altnircta1fa eaieslt  exo(m3nydale lfct s sDuaxmo;t4alxo f3iad mDemnms;t4tltrxo3ootfpDeli slt) 2uoxm3iudlmeelnvtl()a2tr( onu4oex mociasls2ua( o u0arermfcty1op  anvo (0texo(m3iu4apenmnvsatfarrauro;o4tleoiiciltlmDulnms u4 etrxoctytlm r uvi;s srxrxmpnu1ap nlnviatfaDuax  nu4oex io3tld m eau pnt0artnxr3oa1lm ranvi;t  rumio nodal emnesat aDumurp;t1aeeomicias aDrluvpn() lxoir tatoa eaies s)s2umim3iy4ameelicsasfsDtmx  ou0oeeoioctyt a2ra(vs (4treoxr3oytlpt an i;(  2toxr3ny4omenlfvsa(faDtr(mpno1aptomfciydla2rmu pnu0aeerxo3oadlptrli i;s)teur(r ny1lpt lfcils) 2rmu p;t1tlxnmfciasfa2emumo t4 lxomf3iytlptrauvo;t0s2xmimpny1optnmnvias  Dum(m nu1tpe  f3iysla2uauvsnt4artrmr3totoptrau s s  eumirpoydlmte fesls)sruaumono0tlt miciysla eln o;(0 exrxrcoydomt anvolt0 2um(m no4alt mietltf 2urxmont1altn o3ilt s2ua(mo u0aexoxociodfpt  ivs t teur(mpiy4lptnmieia() Drmumont1teto fctytlm2eluvp;t0 eeoircty1oatrau s;t trtoxopnodomt mieiatf Drm(rpot4tetniiciatls ul(vs;(0 ltnmfcio1fm   nvolt0s2uoxopiy1ll nmfetas)arur(mpnt1oexn i3ilt m rmuvs;(0aeeoio io1fpt aivols0s2uoxr oy4omtnmneil()srur(rpou1olt  i3iatla2ulu o;() renxr iotoat auvi;s  rxoxrpnydoptn ivia()aruau pnu1apx mfetld aDuanvp ()tlxnxr io1oat  nvo t  ruoiopiydol nmnctls) Draxmoot4alxoiieild mDrl(mon(0 renxr ia1omD lnes s)s2toxr3ou4amenlics t  Dumxrpnu0olxo f3iltla2ea(vsnt) etrxrcoadlp rln ols0 rxriopny4lmte fvsa( srrrx onu1opxomfeiltlmDulu o;(4 etoxo oydoatr i o;() eurim iudlme mietls aDrmxm ;u0olxnii3iyt s2rmn o (4areoio iatfmt  ueo;()seuoxopoo1op e fei (fsDtax  nu0tlt  ietas sDrl( snu0arxoxr3ootfm ranvi;() 2xr(opiodamenmivi ( s2rax  no0opxo oeiydlsDrm(msn(4arxrircty1laDe i i t  2urxo oo4omt mivsas) Dtmuro;o0aleo o3iydfs2elu snu0 ltomrciadlmDeaieils t2uriopoy4ll  mnvs s)srrru pno0aee mfeildfm ua( pn()texnifcoytlpte neil( setoxopno1lptnlivslt  Drmxrp;u0tpenifcilsfm2uauvo u0alenmr oadomtr uvs;( seurim oo4al n fvs t sDur(mo;t0oet ifciyd s ra( ont4artrif iy1fptr uvi;(0teuoxr nu1ll e ictl()srta(r nu0aex mo3ild s2umnvpnt) lenir tytlmDrauei;t0 exm(m ny1ll e iei ()aDumum ;t1apxn i3tltfs el( p t4trenmr3totfm rln o s)setoir3oy4oltn ncsas a2ur(  ;t4oet ifeils aDrlump ()artrxrcoadlpD lieo;t texoirpiudopt  iesasfs2rmxro;o1ale iictyd sDul( snt4 renif ootoaD anei;t texoxmpiy4lme lnvs t) 2rmxmo;t1oetomfetytfm ul(mp (4aetoif3iytfaDrlneils) 2xr(o3iy4lm emnci (f rtmumont0aexoif3ils m2rmnmo;(0aeenxrctodlpt au i;(0 rtrxopoo1optemict t)s2uaur nu4tpe ifctat s2rln snt0aleoxo iodlpt aiei;(  2urxm3nydap   ivi ()srtr(mpnu1apt moctlt s2eanms t4alxoxf todomt  n s;s trto(r oo4lleelnvi tf rumumpno0oleo oeilsfsDemnvsnt)trxnifctotoaDeli o s0 eumxr3nu1op nmivsasfs2urx ont1openii3ias s2rm(ms ()tetnio3tadlp r nvi s0 exoxm3oy4apte ivi t s2ra(mono0oetoioeiys mDumn s;u0aleoiocio1lpD ai s (0t2tm(r3ou1lle lfcsl(  Dra(ro;o0aptnmf3iydfs2rlumo;u4aexnxfcoo1oa   ueo;s) exoirpnydlm   ieia(f 2umxmpnu1oexnio3iytlm2umump;u)tetnmrciatoatr ivi;t) rum(m3iydapen fctat  2rmxmont4tpxoiieiatfm2elnmo;() eeoir to1opt luvs s)s2umxopoodaltnlneiatf rtmx  no0apeomietadlm2raumo u0arxnmrciytlaD lneo s) rxrxopoy1openmnesl( aDrm(  oo0tlx moeildlm2rmnvs;t0 eenifcoodop e uvs;()seumio iu4lpenmieiat)aDrmur oo0opxnii3tys aDrau p t0 eerxo oodomDr n o s)seumxm ny4lm  liviatfsrtm(mono4opxn o3iyd a2eanmonu0teenio3tytoat aneo t) 2tmim nu1ap  liei tfaDrmum ;t1opt mfciltls ran o t0aexrmr3oydfmDe n i;t s2trxrpoo1amt mfvs tfsDuaum ;u0texnif3iadla rmnvo t0altrif tatlmDrluvi;s) rtmiopoydoltelnetlt a2urx  ou0tee mo3tldlm2umn ont0 exnmociotfpD  nvols)t2xo(o ou1amt liet s)sDta( ont0apxo feiltlmDrl(msnu)artnxfcoatlpte i o;t  2xoxm3iu4ope liviatfsrumxr nu4aetoifeiytlsDrlumpnu)tltomocoadlpDe u i ( trtrxm ou4alt  fvt sfsruaum nu1teen fctydlm uauvpn(4 ltoxr3iodoatrau olt texoiopou4lp nmfvs sfs2tr(m nu4oee mo3iatls2em( p;t0trxrmrciydopt lu sls)trtrimpoy1lmt livt tfa2taxmpot0optoif3iysfaDulu o u)altoif3iatlp eau i s0 2tmxopiy1lm  mfet t) rrrumooo4tlxo fetysfaDeanvpnu)aetrif iydoptrluvi (0setmxrpnodlp  mnvtl( aDtax p;t4oeeo i3ildfs2ranvs () reoif oydfpt  ivi ( trxm(m iudol elncsas sDua( o;t1open oetat mDea( snu)tlxnxf tydfpDrlnvo;t0trtr(m iu4olee neias aDumurooo4teenifeildfm ra(vs;u4 eerxr ta1lp rlieo (0s2xrxm3nu1om e ncsa()srum(m ot0aet  o3tydlm umnvo ()alxoxf3oo1lpt luei s0srxriopoo4altelfctl(fa2raxr oo4olxnmi3ilsls2ulu sn(0aetomf todfmt ai ol(0trxmxo3oydlltnlietlsfa2rauro;u0alx  iciat a emn s (4 rxoxrctodfaD  u o;( seto(m nodalt mnetat a2raur nt0tltoii3ild mDelu o u4 lxoiociotfmt  ivo;t0t2xmxo3ny1amte ivsls srraurpnu4tpxo ieiatlm2elnvp (4areomr iy1om  lueo;s) eurxr oudam   ietasfsrrax onu1opxn oetlt m ulnmo;u4trtomr oo1laDrau sl(0 2xmxrpiy4amt lneils) 2rr( pou4aleoiietlslaDuaumo t0areoxo tadom r ieol(0 2xrim oudope lnvtls)arrm(rpot4oltn o3tyslsDrau o t) eeomrcta1om ran sls  eto(o ny1ope mnct s) Drmu pnt4tlxomociys s ulu p;(0texoxrcty1lat aivsls s2xrir iu1apeemivsa()artax  no4olt mi3iaslm uanms t) ltrmo3oodfat  i s;s)trxr(opio1olte ictls sDrmxm ;t1aex ifciadfmDrluvo (4trxrmrctatlpteaivo t)texmxopio4llte nvi ( sDumxmo;u0aexn o3tys s ua(ms;u0tlxniocio1opDr ueo;s srxr(r3iydamen fesas) 2umx ont0apxniietadfa2uauvon(4texrmr iy1lmtrlnvils)srtoxm3no4lltelncilt)sDumx  ou1tet  feildfs umnms;t)tlxnif ia1lpt luvsl()tetoxmpio4lp e fvs t  rtax  nu0alxomfeils a eau ont4 ltnxf oy1op rai s t sexoir3iydamt  ncsasf Dum( o;t4tlxomo3ild mDemnms t0aeenir iadfm  aues () 2tmxr3oy4omt licsa(fs2ur( ooo4aeenmociys a2emuvo t4teerio oo1omt  i i;s t2xrxmpny4ap emivs t  2um(r ;o4apenmfeilsfs eanvsn(4tleomr3to1la r nvilt texmio ny4opeeliesatfa2rrumoou1aet mocildls rl( p t) eenmo oydopD auvs t  rtoxr oo4lltn ivta( s2raxroot0tleo ictlt s2elnvo (0alxomo oytlmDraiei () rurim3iy1apt  fci s srtrump;u1oetn i3iltlaDul( o;u0arxoir oydoat lnes ()t2umxo oodll   ncias srua(  ot0tet  f3tldfmDelu o u)trxoxr oytoa e nvols)texrir3ou1lpt mivtat  Durump;o1tlt  ocilt m emu p (4artomf oo1laD an slt  rto(m nudap e feilt)s2raurpou0alx  ociasfaDrluvs () eeoif3todfmDelnvsls0 eurxr3oo1om e iesa()artax  no4aptnmociltfs eanvonu)tetoir3to1fmt auvo ( t2uo(r iydllt liesl(  Duau oou0oexomi3ils m eln p u)aeeoif ia1oaD  ueo s)s2urxo3no1lmtn fcs ( arurxrp;u0teenmi3ilt s eluvo t) rxnif3iadfmDraivi t)srxoiopou1om elneiatf 2rrxr oo4tlto icias a umnvont4 etnif oa1lmD  iesls srtrxm3iudal emnesls)sDua(m oo1apxn fetatlm uanms;(0tlermrciadfp e ivsl( seto(r iudamtemfvs t)artax o;t4tetn oetadfm2ua(vp () etrir iatoatraueo (0setm(rpio4llte nctltfsDtm(  ou4apeomoeias m ranvo;u) ltrmf3iy1fatrli i s)trxrxo3iy4ol   fvsls  Draxmoot0oetn iciytlm emu s;t) ltriocio1la e u ilt  exrir iy4lpen fcs (  rrr(r ;o1opt mi3tas mDra( onu0trtrxfcoydfa r ues;(  euoxr iu4omtn icilt sDumx ono1olt  ociatls2ra( pnt0teerif3to1lm   uei;()seumxm ou4lmt mies t srum(monu0olxnioeiytfmDrmn sn(4trxrxf oatfmt anei s0setr(r3no4ole lnct s s2rm(  no4tetomieils aDrl( o (0aetnif oatlpD an o;(  rumxmpny4lpte nvtat a2truro;o1alx  octytfmDrmnmsnt0 lxrirciy1op ranes;t)truoim io1amee ncia(f Durum ot0apeomietytlmDrl(vo ()aleoxr ty1lp e ieol() rxmxo3oo1lle lnetatf ruau  ot1ope  ociytfs umnvon() rtrmrciy1opD  neo t0 etrxm no4ame lnei t)aDtaurpoo1altomo3tyd a2elnvont4 rxrmfcoa1lp eli s t0setm(r3oo1amenlnciat arumu  ou0tpx ioctytfa elu o;t) rxnxr tadfateai o;(  eum(mpoy4ole mfct t)srtr(m no4oee ifetlt m2ranmo t4 eerxrcoytoptelnvi (  rxmxr3no4lmtnlfvt t)s2rau  no4tee ioctyt s2eanvon(4aexnifcoadfaDeanvs s)t2xr(mpoy4ameelfcsasf rum(root1opxoifctld m rmnvp t4 lenio3tytom r u olt)trxm(r3oy4lm e nei tfarrmurpno1aptnio3ils mDulumonu4 rxrxrctadfatelues;( srtm(rpiy4am n iviasf rtmxr ;o0optn fetltfmDulnmpnu0 exrxo tatla  aieil(  rumimpny1llee fviatf 2urumoot0tpe ifciltls2emuvs;t0altrxo3iytoatraues;(  2xrxr oydop  mnvt t)s2rax  ;o1tlt ioctydfaDrlumpnt0tltnif io1om eanvslt  eurxo3no4lpt lfvsl()s2rmxm ot1oee miciydfs2uauvs ()tltrir to1lp  anvolt  rxmxr3nodop nlict tfaDurxrooo1tet mfctyt mDrm(vpnt0aeenmfcio1oaDeaieo ( teumir3iydll nlict s)a2rrxmo;u4alt  ocildfs umu o u4treomfctytom raneo s)t2umxr3iu4optemnciat)arraur oo4texnmoeiaslsDrmn s;u)trermo iotlp ean olt0srtr(rpio1lp   fcias)sDuax ooo0alto fctydla2umnmsn(0 rxrmociy1la   ueilt) etr(rpoo4optemfcsls  Dtmumpou1oee io3ilslmDrl( snu4texoxf ootfp rauei;t s2xr(r3iodap  mfcs (f 2tmx pot0olxoifeiysfm2rm(msnt)trerifctydomt an s ( s2tr(rpou1ope mfci t arrr(mpno1tleomoeiys m2ulu snt4trtrmo3iatfmD  u i s) eur(o no4lm nlieslsfsDrmxmoou0tlt  ociys mDumuvp (4aeeomo3iodlpDrln o;t  2ur(r nydlp elietatfa2uau  ;t0tlx  ieilsfaDeluvsn(0aeenmr3todfm  liesl()srtmxr3iodolee ncias)arraumooo4texomoeildfa rau p;t)trenif3iytlatr uvo (  etrxrpiudllen fciltfsrrrxmonu4alxo f3ild a rlnvsn(0arxomo todoa elu il( trumxopio1op  licta()srtmu oot0teeo o3tat aDranvo;t0tetnxf iatoa  ai ols)s2umxr3iodoltn ncs s sDuru  nu4ale mfciltla rmu o;(0 exomr3oatfaD  nvi;t0seto(m3iudlp emfeiatfs2tr(  ;u0apxomoeias aDra(ms;u4tltomfcta1fptrli o (0 exm(o3iu4lmt lieia() 2umxmoot1aee iocilsla2em(vs;(0areoxo iodlp  aivi;t)texr(o iu4lm emfei s)arumxmooo1tpt  ociltlsDrmn on(4 exnxo3todopDeau ol(0 2tmirpny4alenlfesa(f rrm( o;u1alxnii3ias aDuln p;t)aetnif3iytom  lnes;s)s2to(opno1ll  mfciat)srrrumpot4apxomoetytfa2eau s;(4trtrmr ootfp   u sl( trxoirpny1apt lfcslt) 2uru  no0altn iciltfa2rmumpnt) rtoio3iotla r n o ()texrxr nu1olee nctlt) rrax pnu1tetn o3tyt sDelnvsnt0 rxnxf iy1opDe ivi;(  eumxo ou1optelnvias  rtm(  no0oltomi3iatlsDulnmon(0trxoif ootopDr n i t0 rurxo3no1lp   fcslt)a2rmu oot1oetnii3tydfa2eln p;u)tetnmr3tydlm rln slt0srur(opiy1lpen iesls artmurpnu0oeenmi3tltlm rl(mp;() lxrmoctodlp   uvo ()s2xmir oodam elnvs sf rum(m ot4tpx io3ias mDulu p u4 etomr oatfaDran ol()srxmxmpiodamenlnei (fsrtmu ont4olt iociytlsDrmump t0trermr iotlp   i s (0 etrir3nu4lmtn fesat  2tmu oot0texnmfetls m eanvs (4 lenmf3tydlaDrlu il( srtmxm3iy4olenmfeils srtru ont1opt ifeiltls umn p u0artnif3oatfpDeanvilt) 2xrxo nudll e nesat)srtau p;u0tleo fciltfm ua( s;(4 exnmr3tydomtelivs t0seuo(rpno4ll  lfetat) Dumxro;o0oetnmiciysfsDrlumo (4tltnxr iytlmt li i t  2urim3oo1ol elfvtl(fsrtr(  nt1oexnmfeilsfm2rmnmon(0 rtnmrcia1op ean o;s)s2ur(opno4aleelivils)aDumumoot4alx iietat m rl(vo;(0alxrmr3oo1fp  aueo (0tetm(r ny1al n nvtas)a2taxmoou4optnmfctlsls uau s;u)trxnxocootlmD auesls)t2xmim3ny4om nmivils arumuro;u4oleniieiat aDumnmon() lxomf iotfmteau o t  etmir no4omtnlfvsls) ruru pno0tpx  f3iltlsDuanms u)treoxo3iydomD anvs;t0teumxmpou1ap nlici s a2tr(rp;t1tpxnmoeiltfa2emnvon(4areoxo3oadfaDrauvsls)tetmio3iy1ap nlivils srtrxm nu4apt mo3iltlm em( snu)texrio to1fmDraueo;s tetm(r3iy1lpee nesl()a2rr(m ou4oleoioctas m2rln o (4aexnmr iodfaDran s ()setoxopio4lpe  ieiat aDurxm no1aexnioetadla2uluvp;u4altnxf oodom  lieol(0 rumxo3iodame  fes tf Dua( oou1alt iociysfs2rmnmsnt)texniociy1lm  anvo () 2toio3no4olenlneil(f rtr(rp;t0opxo fetas m ra(vsn() etrxf oydfm e neo;t  2um(o3nu1ll nmnvi s)artrx pnu0tlenmf3tas mDrmums (4aeermrctydfa rlivols) ruo(rpnu1omtn fvia(  rrmum no4opt ioctad s rm( s u0areoxf3ootoaDelivil()teumxr3ny4amtnmivsat s2raxroou0tpx mictadfs em(vo u) etomf oy1lmt  ivi s0t2xmxo3iydap  mnvilt  rra(mpnu0oex  f3iydls el( p;(0aetnmf iydomD  uvs;s0trur(rpny4op e ici sfaDrrurpoo4aeenif3tyd a em( snu0aeenirciydfpte i o;(0trtrxr3ny4lmt lfeia( aDuaxmo;o0apxoifctydlm um(vo t)trxoiocia1lpteaues s0t2xm(o iydlme  ictl(fa2rrxrono0alt mfeils m emumo u)altrmf tytopDr ivs s s2xr(m iydlle  neia()arrr(root1oee  ietld mDrau p;() eeoir totfa e n il()srtmirpio4ameemnctl(faDta(mo;t0optn o3iydfa2rlu snt0tltnmocoy1lmtr ivs;s)s2um(o ny4aptnmicsa(fartrur ot1tleniiciasfaDrauvp;t4tltrxfctydopDean olt0setmimpnu1lme mnvil(fsDraxm ;t4opt miciydfm2umnvs (4teenxociotopt au s;t  eurir3iu4ape lfvs (  Duau  nt1oex mi3tlt s ea(vsnt) rermociatlmD  ies t)s2xrxo3io1lmenmieslsfsrurxrpot1aex io3iat aDrlumo t4artrirciadoptran ils0 2xmir nu4lm nmnet ( s2umurpot4tleo ictatfm ran p;u)tleoxfcoatfp r u ol(0srxo(r oudolt mfetl() Drrumpou1opeomfcildfaDea(vsnt4 lenxr iatomtrli ils t2to(o3iy4omte fcsat s2umx p;o1tltnmfciydlmDeln o u0alerio io1fpteluvi;()srtoxmpou4op emnes (  Dumx o;t1tlenmoeild sDrlnvp;t)artnir oadop e n ils0tetoirpnodope lnct t sruaxr ;u4tpe mieiltfs em(vsnt)areoxo oa1oaDe i i s)tetrxrpoo1lmt lieslt)arrr(root4alen o3iydfaDelnms t0alxoxr3io1fate u il() eum(o3iudamen nes sfa2tax ont1opt  ictldlmDemn o t4 eenir3tatfm   ieo;( trto(rpnu4altemicta()aruaumpno0opeoioctydlaDea(ms u4tetrmr3ty1lmteaiei;(0texr(m3io4lmeemictat) Durx  ot4apen oeildfsDean s;u0 lxoxfcoatla  auvi;s)s2umxm3iu1lmee feil(faDur(r ;o1olx if3iat a2ranmpnt4 lxoir iytlpD  neo;s t2toxm3oo1am  liet ( srur(ro;t1tlxn o3tad m uanmp;t0aleoif oa1op eaiei;t)trxm(r ny1ol nmict ( srtaxrono0tlt ifciydlaDrmnvp u4altoio io1fa elivol(0trumim ny1lp nlietat)artmumpot0olen oetys mDrl(mp ()arxoir3oytlp eanei;s0t2trxr iodolt lfcil(faDtmurpou4tlxoiociad a emn pn(0texrxo oadlp  livsl() rumio oo1altnlfet tfs2rmurpot1aexn ieiasfm2umnmo u4tlxrmf3oydfmtrlivils)t2tmim nudam emnciasfs2umxmpot0tltoiieiad s2rmump;u0 ltnif3ootlp   neo;t)s2urirpoy4opte fvil( arrmurono0aptn fciytfmDrln o t0 eenxf todfmDelivolt)trxmxo nodom   netlt srumurpou0tlt  f3tytla um(vp;u)artrxfciydfp eauvs;s0t2xmxo oy1ameemncia(fs2umurpoo0ale ifeiadls emnmp (4aexoxr tydoaD luvi t  rtrxr iodole  fct ( sDum(rpou1oet iietltfs rln s t0aeermfciy1lpDrai ols  euoxmpoo4altnlfvtlt) rtmuront1opt ioeilsfa rmu ont4alermociytlp  luei;s0 exoim3oy4ame lnvt (fsrrr( o;t1oet  oetyd s2ul(mo;u0teeriociotfmD livo;t)t2xr(mpiu1op  mnciatfaDtaur ou4aet micilsfs2ra(mpn(4arxrmrctytom eli sls t2ur(m3nodame  fctas sDtm(r ou0olxomi3tldfsDra(vp t0arxnio3oytop   uvolt  2um(rpoo1oleemfes t  Drrx p;u0alx  f3iydls2ra( onu)tlerir3ta1fpDrlivs s0setmxmpou4ol  mncta( a2urxm ;t4a
\ No newline at end of file
@@ -0,0 +1 @@
+nvs s trumxo3no1ol nlfei sfaDtmx poo0oetoifctysfa2umu s u0artnio iodfptelu i s) 2toim iy1open fvt t aruaum no0aexoifctatls um(vsnu)arxnmrcoa1op   ieolt)trurxrpnodlpe  nes sfsrrmu oou4tltnmfeiysfs2el( on(0texrmo iydfaD au ilt) etoxm io1lmtnmnctas a2rru p;o1oee micildlm2uauvpn(4altrxr to1faDr i i;s0srxmir3iu1al nlfvslsfsrum(mpot0tpe mf3iys aDelnmo;t0texomo3iodfat  ieo;t) 2trir iodal nmfes tf 2ua(rp;u1tptn fetls a2em(ms u0altnif3tadlmDrlnvslt)trxmxrpiy4ape livtat  rtrumpnu4tpeo oeilsfa eluvo ()aeeomrctatfmtrlueo t)seuoxopiudol  mfvs t)aDtaumoou4tpxn i3tas m ean s u4 rerxf3iy1oaDeln i s0s2toxo3ou1lm nlfcslsfaDraxr ou0tle mo3tlsfm2eln o;u)trxrxo3iotomt ln s;s) exmimpio4op   feil()artmx  ;u0tptnmo3tad a rlu ont4 exrmfcoo1fmDeaues (0s2tmxr3ny1olt lfcta()a2urxmo;u1oleoifciydfs2rmn p ()aexnio3oadlpt au s;t teuoim iudlm  lncslt) Drau o;t4olxniiciat s2ran o;u)teeoirctodfm rlnvo ( sexoxm ou1apenlnvi () 2uaurpoo0olt  icilsfsDrauvp u4tlenmo3to1omteau s;( sruo(mpiu1apeelfetlt s2raumo;t0aeto o3iydlsDranmon(4trxrif3tadfaDrauvolt) 2xoio3nu1op n nvta(f Drm( o;u0ope  ocias sDumums (0trxoxo3totlpDelues;s0trtr(o3iodlpt  nvilt  Dum(r ot4aee iietyt mDran sn(4trtrxocto1fpt lnvs;s  ruoxopiy1lme  fciltfaDur( oot4apen o3tlslsDuaumsnu0texoxr oy1fpDranei;(0 etmxo3oo1llte nei tfsDur(mpnu1teen oeildls eanvo;() lerxr3tytfaD lnvols0trum(r iydalenmfvtat)srtau pnu0tpxo fetytlm rlums u4tlermfctytla e n ilt  rtrxo no1lleemfvil(fsDrrx onu1aleo ieiat s elnvo (0 rxoxociotfatrau sl(0seumxo oo1lmtelietlsf Dtr(  no0tpx iociatls2rlnvon(0tetrxf3iydlaD  ieo;s t2ur(rpnu1lpt  fvt t a2uax  no4olx  fctysfsDrmnvpnu0 leniocio1lpt lnvo ( trxm(mpiy1lpe lfetat aDum(mpoo4teeomociad mDraumsnt0treoir3ty1omDr i o;()setmiopiydoptelfvs t) rururp;t4tetn i3iys m2ea( s u4aeenmo iy1omt  u i;(  etm(r oo4lm nmnet (  2trxrp;u1ope io3taslm2umnmont0 ltrxr3tytfmtrlu o (0texoio3nodll  lncil(f rum(rpnu1oexomi3tysls ean p;t0tleoxo oydlmD  uvol(0 rtrxrpio1al elfvi ()sDrax o;o0tltn iciatls2rlnmo t) etoxf3ty1oat anei t)srxo(o3ny4lpte fvslt)a2tmxmpnu0oex  f3tldlm rl( onu)aexnircoodfpDr ues;(0t2to(mpny1llen neta( a2taurooo1apeomoeiatfm eanvpnt4altrmf oa1lmt luesls srurxo iudolt mncs tfa2uaump;t1ole  ociat m2ua( p;t0 ltnxo3iodop e ivo;( t2xoxm nudlmtelfctlt) 2rmxmpnt1tptnmiciltfmDemump;u) lxoir3tydlateluvi t)s2um(m iy4lmtemieiat)a2raxmp;u4apx ifcilsfm uln pnu4trtomf3iytlpDeluesls  rurxopnudll nmivtl()a2tmumpot1tetnmfeiys m2rmnvp (4 ltoif3oodlmtrlu sls srxoiopiu4lm elfcias aDurxmont4aet mi3iyd a2raums () lenxr oy1omDrluei;s0setmio iodomte ivsls)aDtmxrp;t1teeo i3ild a2elumsnu0 ltnmfcootlmtranvo t  2xmim3ny1alee nvs (  2rru pnu0olenifcild m2ea(mo (4 rtrir oy1fa e nvi ( s2xmxo3ny1ll  mneta(f 2ur(mono1oee  octldfs emuvo ()arxnmfcoytlpt lu ol(0s2xoirpiudapeelfci (f 2ua(mp;u4aee if3iaslmDumnvpn()altnmr iotomDrau o;t)trxmir iy1apen ivtatfarrrxmp;u1apxo i3tydlm2ua(vo t)trxnmf oa1opD aivolt0 ruoim iy4ope mivsl(fsrtau p;u4teeoio3iltfmDrlu p u0 lerio3oy1lptr i sls) 2xo(m3iu4openmnetasfa2rrxmpou4oltoii3iad a rmu p t4artnxf oy1fp  luvs;t  rur(m nydal  lncsl()sDrmx  ;t0tpxomfeiadlaDrl(vp u4aeenxo3to1om eln o ( sruoir3oydoptn ivta() Draumooo4oex mociad aDelu s;(4 lxrio3oa1oatrln i t)t2xoiopiu4ap n nviasfs2tmu oou0tpeo fetys s2uau p;() ltnmo tytfa   ivslt0tetmxopno1llee net t arumxmpnu0altomieiytlsDem(mp;u)altoxf todlp e u sl(0tetmxm3nudaptnlfvsat srtm(rpnu4oeeomi3tasfmDulums;u4tltrif3iatlat lnvi;s) 2xrxopoy1am  lfvs (  2ua(root4oexn ietyt m2ra( ont4alxrir oa1omtrau il() 2toxm io4ol nmnci () rurxm ;u0oetnifcilt sDrmnvsn(4 lenmocoydop  auvs;t srumxr3oudoltn ivt s s2rrumpnt1tlenmieiatlm umu p;()alxnmr3iatfmDeln il(0srtr(r nu1lltn ictls) 2umxmpou4tlx mo3tat s2rmn ont) ltomfcoodfpDe ueslt0sexmir oudam elictls)s2trxm nt0tet  fcilsla2ulnvo;t4texoxociotoaDe nvo ( srumxo3oodapte fvt (  2raur nt4olto iciysfsDulnvo;u4trenircoatlpDraueolt)trtrxr3no1om nlnesa() Drrx p;u0tpeo i3iat m2emnvs ()artoxr oy1lpt  ueils0s2urir3no4llt  ictltfaDraxm nt4tptnif3ilsfa rmuvs;t)teeomr3iy1fa eai i;s  2toxr oodam   nvsls)s2umxmoou1oetomf3ilt s uluvs;(0 lerif ootomDeai il(0t2urio ny4al nmnvsasfaruru pno4oeenmf3iltls2ea( p t) eermf3ty1fatr ieo;s)truoir no1olee fvsatfaDraxr nu4tpeomfctlslm2um( s t4 renio totlaDeluvi ()seuoxo ou1ale mnvslt)aDur( o;u1tlt  i3tlslm2rl(vo u0artoif iydla rlues;s  eumxopno4op n ivils  Dtaurp;u1olx  ieiatlmDeanvp t0texnxfcta1lmt  uvi;t sexm(opiu1op nmieia( aDrmum ou4oet  f3ilslm2rlu p u4 rxomo tatfpt ai o;t  ruoxmpno1omte nci t  rrmum ;t0opto fcilslmDel( pn() lxrxo3iadfaDe i il( t2umir3iy1apee nesa(fa2trumo;t4aet ii3iatfa rlumsnu4 etoir ia1oa rlneo (0tetm(rpiy1alt mivs s) rta(r ;t4apxn icilsfm2um(vsn(4 ltoxr ootlmte neilt) etrimpiu1lp nmicsatfartau p;t0aexoiociad a2eln pnt0teenmr iytlm r ivils0sexo(mpnu4omtemivi sf rtm(  ;u0tpxoif3iadlmDrm( p t)alxnxf3oo1lpDranesls srumir iy1lptnmncslt srua(rpoo4optomiciltfmDeanmo u) renmf oa1fm eli ils0 ruoir3iu1lltelietas)aDta(  ;t1apeoio3tlsfs2ul(mp;u0aeenio3oydoateauei s)sexm(rpiudal nmnvi t aDumxro;o0ope iieild s ranmpn(0 renifctydfate iei s srtrxopiudame lfctltfs2uaxmonu0opxomiciyt m2raums u) rxrxo3tatfp r nei t teuoxr3ny1om elfvsat a2rmxr nt0aleomo3ias m um(vpn(0artoxr ty1oaDr ieslt  rxm(m3nu1oltn nvi sfsDumx  nt0altn ietlslaDemn o;t0 rtomr3todop  ln s;s)sexrxo ou4lle  fvi s)srtm(rpnu0texnif3iat m rauvs t0tleoxr3iadla ran i s0 rtrxr oodole lictl(fsrur(root0tltoif3iydfsDumuvs t)aetomo ta1oa e ivs;()srxr(m oydale lfesls) rrm( o;u1apx mf3tyd m uan s u4altoxr3tatomD aueils0sexmio3no4open fctlt)arrau poo0oee mieiydlmDum(vp u) lxomrctotoa r uvolt)srtm(r3io4alenlnvt ( srraxr ;t0aptnmoctltfs2emnmsn() ltnxfcootlmt anvi;(0tetr(o oodam  lfcsl()s2rr(m ou1ole  fcildfmDrm( on(0texnmo ootfpt lnvsl()s2urio nudaltemicsltfsrtr(mpot4tpx moeiytfm2rmnvs (0artomr3iotopDelnvs s s2uoirpiydlmtn ivs t)a2um(  nt0tle mfciadfaDem( p u0 ltrifciy1lmDean s;t0srtoiopno4lm nlics s  Drrurp;u0optoio3tadlsDulnmo (0 eeoxociytoptraneolt0srxr(m3oo4ome lnviltf Dur(mpoo4oexomfciaslaDea( o t0altrxf oatop rau olt)t2xr(rpoydlme lfvi s)sDta(mo;t4olx  feiatls2eluvp;u4arenmocio1laDeli ilt0t2tmim oy1lme mnvsa()aDur(rpnu1tpx mietyd m uaump;()tlxrxf3ty1fp e ueilt0 2ur(mpio1llee nctl(fa2tmur ;t0olt mf3tatls rmumpnt4 ltomfciadlatr u ol(0 2umirpiu4ame lfctas) Dta(mo;o4oltoiiciatfm umnvonu4 etnmf oy1fmD lneolt0 etr(opnydlptemfcias sDrrur ;t4alto o3iasfaDua( o;t0areoxr3iodlaDr ivi ( srxo(opnu1ale  nesas)a2uaxr oo1oeenmi3ildfs2eanmo t) rxrxr3ootlptrlnvs;() etmxm iydoptn ivt (  2umur nt0ole moeilsfs el(vsnt4altoir3ootoaDr nvi;s0sexr(opiudamenlics (f Drrxrono4aptn ictyt m ul(vo (0tetnmr3oydfat  nei;( t2xrxopiu4ap nlfetl( aDum(ro;t0tle mfetas s2rauvp;t0 rtrmr3iydop eauvs;t0setmirpoydap e fesl( aruau pou0aetn ietatls2ua(vo;()texrio3tadfp  anes ()seum(r3oy4alee fvtl() Dtmu  ;o0tee if3ilt a el(vo;(0 renmo3iotfp   nvi t)srxoio io4lm e nci sf 2trumo;t4ole mi3iad aDea( s u)texrmf3oo1fpDrai sl()s2ur(r oodlm elfct tf 2rmx o;t4optomi3ildlsDelu ont0 etnif3iotopDrlueo;(0texmxmpoy4om  lfeta(f 2urxm no1tlt  ieias sDem(mo;(4tlxnmocoatlmt  i o;t0seuoxmpiydllte ivtat)srtrur nu1tltoifetytfsDrau pn(4teerxr oo1faDr ieols) 2xrio oy4ape mict sfs2rr(m ;t0tet mfetltlm uluvs;(0 etnxocoydlmD an o (  2to(o3oo1ope  ietlt)srua(r no4tltn ociasls ranmont4alxomr iodomD  u il(0 eumxmpiy4oltnlictat arua(rp;t4oet  ictys s2um( p u0arxrir oy1fp e n ilt  eum(o3iu4olt licia(f Draum ot4tet ioeils sDua(vo;t)aetrif oytoa  au o;(  exoxm3io1ome livs ()aDumuroou1oeeo oeiatfaDuln o t0aeeoxo to1oat  ivol( sruoim oodap   fvt s sDumur nt4teto ietatlmDum(mo;u)teeoxr tytopDeaueo t trto(r3nudaltelivs s)aruaum nt0tltnmoctldlm2ul(vs;t4tetoio3iodlp  lnes;s tetoir3nu4omee icsls)sDtmx pot4oeen iciys m emn s t4teeoxf3iytlp eauei;s  2xr(m nu1apt lictat a2ur(rpnu1opto iciyt s eln pnu4trtnmo to1fmtelivsls0 eurirpny1amtelfvslt)sDua(rpoo0alxn ociydla ra( o ()teermr iodfpD li i;t0 rtoxo3oudam elnciat a2tm(rpno4texn ietyslaDean p u0 ltnif oydomD  neo (0 2xrir oo4ol elfeiatf Dum(rpot4ape  ociyt a eanmp (0texoio3oy1latrau i s0sruoxm3ou4aleelnetls arur(rp;u1aet  octldlm2ua(vs t)teeomocoatop rliesl()srtrio3iydaltnlnetat) rtaxm ot0olxo o3tyt a ranvs;u4trtrmr3io1op eaivo;t0 2tmxopiydom emnesas s2um( o;t4tpxnifeiyslsDrm(vs u4alenir to1faDr ueo s s2xmio3nodal  lieias aDuaum no1oeeo fciasfs2umn ont0 reomo oy1op   n i ( srtm(rpoudlltemfvtls arrrxmpnt1aee io3ias mDean pn() eerxf3ta1fmt lues t)t2xm(o nu1altn fcsatfsDtm(rono4teen ieild mDeaumo t4arerxo ta1laDr ueil( srum(mpny4om  mfvi t aDraxmp;o4aet  f3tltfm2emuvont0 lenir ty1lm   nvi;t  2tr(m iy1ole mncil()aDumx p;u1apenmoctyslm2rlu s;t) eerxo totlaDelu olt trxo(o oy4ale  ncias aDumxmpot0texn feiltlm uauvo;t4 rerxrcoydlaD lnvi s) euoxmpio1al elnvs s aDtax ont1alt  iciytfm2rmumsn(4alenmf3tatfp r u o;() rxrxopiu4open fetls) rrmur oo4aet  i3iatlmDrmu s;(0tlenmrciy1oat  i i () 2urim ny4am n nvs (f Drrx pot0aeenif3iydfm ranmsnt0tltrxf3iatla  anes;t sexr(rpio1amte ivi t  2taxm ou1tlxnmi3iydfa2eanvo (4aeerxf iydfa rluvs;t0t2xmxr nodap e iei tf 2tr(  ou4tetnmoetytlmDuanvp t) ltnircoa1la r n s;(  euoxo oy4lmenmnesatfsDraxrpno1tpxn f3iadfm2rlnmp;t)aetnif iadfpDrln s;s) exm(o3iu1lltemneil(fs2raumonu0texniiciltls emu onu0arxrmo3ta1lpDeauvs;t  rxr(m3nu1alee ietas)s2trxm ;u4apeniocias mDel( o;t4trtnif3ty1lmDeli ols0srtm(o3oudlm   fes s s2urum nu4tptn ociytlmDel(vs u4tlxnircta1oa rauvs;s) 2trxo nydoptelfvs s)s2ta(mono0opeoiociadlm2eanvp (0trtoiocoa1oa  aneil()tetoim oodlle lfesat)aDrrumpoo1tlto f3iydfs2ea( o u) etrxr iotfateanvsl( srxrxm no4op nmieiat s2raxr nt1tpenio3iyt m rm(ms;t)trtomrcoatomteln o t)trtmxopnodlm  lietltfs2uaxr ou0tlto fetadfs2emump t0 lxniocia1lmD  i s s) eurimpoy1lm emici (faDrru ont1teto iciad a2ulnvont0tltoioctotom e ivi;(0 eurxm3oodolt mfvia( a2tmu  ;o0tltnmf3ildfm ua( snt0tlxomfctadlaDe ueol() 2xmio3ny4ap  lfeia()srtmu  no0olxo ociydlsDrlnmonu4trxnxo3to1lmt lueols s2trxopnu4aptemictl(fartr(  ;o4oexnioetasfs rl( on(4 eeomo3iodoatraiei t)srxoxo oo1lpt  ivia(  Dtm(root1oexn o3tls m2emuvsn()tltrmo3tytopteau i;t0trxoiopnu1am   nciltf rua(ronu4optnmo3iasla2rlnmpnt0texnmocoydla raieils)srtoxrpno1om  lnvi tf Draxmp;o0tet ii3iysfm2ra(vo u4aexnmf oa1fmD aieo (0sexo(m nodopee ncs sf 2rmu onu1apxo o3iydla el(vo (0alenir oadopt aueolt)s2urxopno1am nmicia()artmxrp;o1aex mo3tatfaDeaumont)trtnmf iy1lateanes s)trum(o3no1lpe mnes t  rrmumpno4oetnmo3iltfsDuan on(4artniociotlatrln s ()trxmxm3iydal nlnvsl()s2ua(mp;t4tee mfctadla emumo;t0alenmr ia1lptrlies;t0teumxmpiu4am elivils  2rrx oou4tltnmfcias s2rmnmo t0trermrctotop r n i s  exo(m3ou1lm elivi t a2rru o;o4aptoifeiytlm2el(mp (4 etoir3oy1la ran sl( setmxo3ou1lpt  ivs t)a2uru  ;u0alenii3iydlaDelu p;u4artoif3todlpD  n o s trxo(opoudome lics ( sDuaur oo4tex  iciltlsDrlu o;()altnioctotfmtrau i;(0trxr(o iudlmee ivsasf 2urum no0tpxo fciydfm2um( pnt0aetrxfcoytlpDrlueils trtrxopoydol  lnvtl(fartaxm ;o1aeeoii3iatfm2uln o;(0artrio3ia1fat au o;s) 2xoir iy4alte ici (f 2taumo;o0tlx ifcias s rmnvo () eerxr3oadomtr i s (0t2xr(opiy1alenlicil()srra(mont0tleo ictldfaDranvpnt0 rtomf3iodla eli s;t seumim iudomenmictat) rur(rp;t4aeeoiicildlaDrm(mpnu) lenmrcto1la r ueilt0trxriopnodopeemnvt (  2uau ont4altnmf3ildfa emnmp;(0 rtoxf totomt  ivi t)srur(m ny4ape lnei t) rrruront0ape  ietadfm rl( on(4 lxrio3tatom   n o;s trxmxo io4lptnlivs s s2ta(rp;o1aeen i3iat a2el( p (4trtrioctodlm rai o (0srtr(mpoudamte nvta() Durxrpou1altoiocils m2ua(mp;t) etomr3oa1omDeauvs t0trtrxm ou4aleelnvsls) 2tmuro;t4oee  fctadfaDemumsnt)trtrif ty1lat lu o t) ruoxr3oodlmen fct ()a2urxmp;o1aeeoio3tad m rlu o;(0alxrir io1fm rlivilt0setrio oo4al   feta() Duax ooo0ole moeiasfmDum( p t0trtrmr3tatlpDe i s t  euoxo3io1lpt lnvt ()sDtrurpno1teeo feiadls eauvpnu)arxnmr tatfmDraneil(  eum(o oo1lpenlfetl()s2ua(m nu0apx  i3ildfsDulumo;(0artnio3tydfa  lu sls0 2tm(o3oy1amt mieils) Duaurpot0aetnio3iasfs2ul(vs;()areoxo3iydlaD  ues;s0s2uoxr3iudlmtemfeia(  Drau  ou4alxomocildlm2rau pn(0arxomocoodfa r uvo;t)t2trir3iydaptn ivia(  2ra(root0olx mf3ilsfm2ean p;u4 rtomf totopDeaneo;t0trxoxmpnydal e nvsl()s2tru ono4aeen iciyd mDum(ms u4trxrmo3oytomteln ils)t2toxrpio1ale  ivs ()srurx ont4tpenif3ildfmDemuvsnu4texoxf3ta1faD lues;s)texmir nudopte nviat srraur nu1tptnmiciyt aDel(vonu) leoifcoo1late n s ()t2urxmpiu4om e nciat)sDrrum nt0teeomietys m2ulnvs;t0 rtrif3oa1fmtrln s;s sexrim3nydaptn ivils s2um(monu0tet  i3iltfs ul(vp (4trerxf oydomDe u s;() exmir3iu1optnmnet s)sDurx pnu4tlxnmfetyslaDemn snu4 lxoioctotla rai i;s s2um(o3nydom   fci (fs2rm( o;o1texniiciys m2ean p u4altrirctydop  an i;(0 euo(m3iydal e ivias) Dtmxmoot1aet  fctasla eau pnu4tlxomrcto1laD  neo;t0sexmxopny1lpt lfeta(farrau  ;u1tex  oeilsfm2eanvp t0alxoxocta1lm r n s;t)t2xmio3ny4opt  ietls) Dtrxm ot1olx  o3iadlm ra(mpnu)tltomfcta1fpt lneilt trxrxm iu1am n ncs s)sDrrxr ot1alxo fetat s2ul(ms;t4 eerio iodoptrauesls)seum(r3iu1omenlnetat)a2umur nt0tle io3iat mDrm(mp;() ltrif ia1oa  luvs s0 exo(r3oudoptemnviat  Dua(  nt0texnmiciadfmDuaump u0 etnmf iydfmD ln ol( t2uoir nodlm nlnvsas)a2taxm nu4tex ifctaslaDea(von(4 eerxfcta1omDelieilt  2tr(m iydam  mies t)s2umumpnu0tle moeiltlmDeaump;t)texnmf3oydop  lnvi;()trum(m oydlptnlivils) rum( pnt4aex  fctadfa2emuvon() exoxo oatoaDr i i (0s2uo(opiu1lpte nvsl(  Dum(mo;t0opxo oeiasfs2emnvp;u0 eeoifciydlaDrai i s t2umxmpoo1ll  lncia()srumx  ou1alt miciysfm2rm( p t4alxrio oy1oat  n o;s s2ur(m3iu1lm  mfci tfartaxm ou1olx ifciydfm ra(vs;(0alxnifcoo1laDeaues t) eum(r ou1lltelfes s)s2trumooo0tlto i3ilsfs ra( p;u4areoxoctadfaDrlnvo t0 2xmxrpny1amtelici t) 2tauro;o0aeeomo3iadlmDra(vo;u0areomfctadla   nvi t s2uo(r3iydoptemivtls)a2tmxrpnu1tlx mo3iasls ea(vp;(0altrmociy1lp eaivils)texrxo3iudlmt lnes s) 2truronu1optn oeiysfs2elu pnu4aetrmoctotfptran ilt srxoxo3iudamenliesasf Dtrx pno0alenmocildfm uln ont0treoxf oo1fm   ueil( t2xmio oy1al emfesa(  2ra( ooo0opeoifeilt a2ua( snu)arxrmocoo1oa r ieol( texo(r3no4ap emfctas aDrr(rpnt0oltnmietlsla ua( p;(4altrxr tytom raueols0 rtrxrpou1optnlfeia(fsDrrxmpot1texo feias sDrlnmp (4trxnmfcoy1fp r uei;() 2xo(m3oudalen iciat s2tmx ono0opeo iciyslm2ea(mp (0 eerxfcoodoptrlueolt t2urio3ou4aptnliet s)a2taxront4oexn feiasla2emu pnu0tltomf totoaDeln o ()t2triopny1lm nmieilsfa2umumo;u0oexn ietysfm2um(mont)teerir3oadlpDr uesls tetriopnudol  mnctlt  Dtmx p;o0tee mfeiyslm2em(vpnu4 etoiocia1lmD ln s t)t2umiopoo1lpee fvsltfs2uaumpnu0oee ioctydfmDelu o;(0aexoir3iydopt au i;( trtm(o3oy4lmt  ict t)a2uaxrpou0altoiiciadls uanvsn(4tetnxf3oadom r nvo ( srur(o3nudlm n fei sfa2trurooo1opto o3iaslm2rlumsnt) renmfcio1lmtr i olt) 2xmxr iydole miciat) 2tmxm no1aleo oetld m rlnmp;t)alerif tytfpD  nvsls) rxrxr oydlltnlnesas) rtrump;u4oleo ociasls2elu o t) ltoxr ty1faDelueo ( seur(rpiy4aptnlfvsl(  rrm( pnu4ope  ieildfa uanvont0 rxrxo3oydlpDe nvi t srxmxrpiydame  fvilt)s2umum oo0tpeomfetydfs ea(mo t4 rtoxf to1oaDr ueo;s sruoxr3no1ap elfvsl(f Duax  ;t4apeomo3iltls2ua(vp;u)texoioctatfat  ivs;(0t2xmxrpnu1alt lnetas  rraxrpoo4tpxniiciat a2rluvont)alxnxfcty1la r u o s0 2uoxo iydam n ietls)s2raum ot4oexnifetatla rln pnu)tltrmr iytlpDe i i;s)s2xr(mpiu1lmtnlneslt) ruaxmono0opeoio3tydlm2rl(vsnt0tlerir3todlm   nvilt) 2xo(m nydlmtn ietl(faDumumonu0tetnif3tls sDua( on() lermrciydlptrluvo t0t2um(o3oy1lm emfct tfaDtm(m nu1olx  i3tadfs2em(vonu0tetoircoodfa rlivols t2trxo3io1lptnlivil( srtm(m no4tlt moetydfs2rl(ms;u)artoircoodlmDrln i t) exoxr iy4altelncs ( aDrm(r nu0teen fciadlaDulnms t4 rtnxo3oytlaDrau i;s t2tr(r3nudol  mivi tfs2umurpnu0aexnifeilslaDuanmp t0alenir tatopt  n ol(0s2trxr nydlp e fciat) 2rmxmpot0apeoioeiadfa2uanmsnu0tetrmoctatfaD au s;(  euoxo3ny4omenlncs s sDtaur ;u1tpt  o3iydlm eln ont)trenifcoodlatean s ()trtr(m oy4omt lietat) rra( oou4opeomi3ildfmDum(mp;t0teeoxo oodla  lu o s  exr(m3ou1lm   fcslsf Dum(  ;o1olxnmocild aDulnvp (4tlxomrcoytoat li i (0 ruoxmpiodlm n fvia(f rtr(rono0olxn o3iydlmDea( o t4aeermrcia1lptrauvs s  eto(rpoodomenmfctasf 2ta(mo;t1ope if3tltls emuvs u0texnio3tytfptr uvol(0 rxoio nu1lltnlfeiatf 2uax  ou1tlxn fctls m em( o t0 leoircoydoat lu s;t0trtrxm oy1openmfetl(fartr(r ou4tpx mfciltla emumo;u4arxnxr totfaDr i sl()t2xmxr3no4am   ietatfs2ta(monu1tetnio3iys m2umuvp;t) ltrxo3ta1fm eau o;s trtrxopio1ll nmfcs t  Drau  ;t1texo ietytlmDua(mo u0 exnmo iy1la raivsl() 2urio iydaltnlnetlt arrax pnu1oetoiiciadlm eluvsnu)tetnmf iadlat  uvolt) rtmxr oo4lle licsatfarta(rpnt0tlxo f3tas mDulnmsnt)tetomrciy1omt luei t  etoio no4aptelnvtl() Drrxm ou4aexnmf3taslm2ulu onu0 lermr oydoa  lues s)srtrxr3iy4ll nmivia()sruaxmpnu4tex mfeiyslm rmumsnu4altomrciatlp  an o;t seuoimpnydomtelfetas) rur(  nu0tpe ifctad a eluvsn(0 rxrxo3ty1lm   uvi;s  2urim3oy4om e nvt sfs2uaump;u1tpxomfciatlaDea( p (0 etomo oo1op eauvilt0t2trxmpoy4llte fcsa()aDtaumo;u4tlt mf3iyd s emn s u0tltnirctodomt anvs;() rxrxr ou4alen nvt s) 2rmxrpnt0aetnioctadls2uluvsn(4 exrif3iydfmDe nvi;(0teumir oudop emiesat aDtr(  nu4apt mieiltfa2umumo u4 lxrxo3tadlm rli o;s) 2urxo3oydlmee fcslt  rrrxmont4opt  ieilsla2emnmo t4tetomo iatlpteanvs (0 exmxrpou1ol nlnes ( sDrmx  oo1oexomfctasla ul( s u0artnmoctadla rai o;(0seurimpou1oltemfctl( sDua(ront1aeeomo3iadlm2umump t4tetrxo3ia1lm ran ol( srumxo io4lmtnlfct sfa2taxrpnt0tpx mictld s elu p;(4tltomociy1fa eanvs t) etr(r oy1ope mncs () rtrx poo0oexn f3iyt m ul( p (4tetomfciytoa rauvs;t0texrxo oydol nmnesl(fa2urx  ot1tltn feiysfs um(vs u) etomo oo1fpteauvo t)s2tmxo ou4olt  neils a2rrur nu1apeomfciatfm rluvpnt0 rtnmocto1fmDr uvo s0srumxr3iydlpen nesls)a2umxro;u0tleomi3iadfs2el(vont4alxrxo oadfp e ieils  exm(opnudalte nci t)sDumxr ot4tle moeiysfs ul( p ()tlerxrcio1fpDraueil( t2toio3iodam  lnctl(  2taxrp;o0oex if3iad m2ul(vsnt4 lxnmoctatfat li o;s0trtrxopiudamt mnvsat s2ra(r nt0oeto f3tysfaDemn p;t4tetnxrcia1fmte n o s0trtoxrpoo1al n ncils)s2urump;t0tleomi3tlsfm2umump u)tltnxr ty1fm r ieils) 2uo(o3io1al elfeilt a2truro;o4oetoioeiyslaDrln o t4teeomr tatoa eanvo;s)t2xmio nu1ameelneias  Durx pou4altoifciyt mDranvpnu0tetrmr iodoa rau s t)trtmxm3nu4ol elicsa(f Dtmur oo1aleoiietytfs uanmp;u)texrmr iodlmtr u slt0texoxr iodomee ivsas) rurxmono1tltniictltla2rauvs;u4 rxnmo3iotlpt  ueol(  rurxmpiu1open ics s)aDuau  ou0aptoiieiyt mDumuvo (0 rxrif3oydlpteluvs;( s2trxr3nodop  micsl() Dtr( poo1aexnmfeiytla rmnvs u4 leoxf iydfptelueolt teuoio iy1alenmnci t  Drmxm ;u4tptnmoeilsla um(vo;(0aeenif3oo1lpD luvsl() rtmxm3iydll e iet s) 2tax ooo0oetn feiatfm2um( snu0 renmo3oydlaD  nes s srxoxo nodaptnmivtatf Dtrxmoou0texomocilt m umu s;u4altoio iatfp  lnei t setmir no1oltelietls) 2urxrooo0aeto ieildfa eanvsn(4trxoirciatoat  neslt0trur(m3iu1ol e fei t)aDtmxmpoo4oet mfcildlmDrm( p t4aetnmr3iotfp rlneil()trtmxr nydoleemfetl()s2tmxrpot0olx  ocilt s2elu s;t4alerir to1la  an s;( t2xr(r io4lm n nvsat s2tmumpnt4aptomociyslmDeln s u)artoxo3tydom raivo;s) etrxr3oudlmenliei ()arum( o;o0tpxomieiadlm em(vonu) ltnifctydoaDe uvils0teur(m oo1llen nes ()a2trx pou1tltnmoeias m2ul( sn() eeoxf3oadomD luvi t t2xoxr oo4op nlfcilsf Durumo;o1olenmfeilslm um( pn() eeomrctydlmtrlu i (0texrxrpno4oltemnci s)s2taxrpot0texo o3ias a2ua(mo;(4aleoircta1oa eaivol(0tetoxrpoy1ole lfci ( aDtr( pno4olxoioctldfs rl(mp t4aetnmrciydfaDrau slt0t2umim oodam emnvsa(f ruaxrpnu0tee  iciyd mDeauvp;(0 lenmf3tydfa eln ol(0tetoir nudlmtelietls) rrr(mp;u0ope moctasfm2rl( p;t0artnircty1fm e ueo s)seto(o3iy1ame lfcsatfsrtmum ;t0opxo ieildls umnvo;u4aexnxfcoytfa   i s;(0s2tmio3iy1ale mnetas)sDrr(rpot4teeoii3tydfs ea( s u) ltriociy1lat aivo;t)srxmir3oo1al n ieil(fsDtrxmoot4aexomfctlsfsDuau pn(4alxnxocoo1fptrln o;t0 eurxo3io1omtemfct tf 2taxr ;o4oeenmf3tlsfs eanmo;u4tlenmo3ta1opt  n slt)srtriopnu4ope  fvsatfs2uru  nt4alx ii3ias mDrl(vp;t4 lxnxfciydlmtrliei;t0s2urxo iu1omen fet s aruaumono4oeen o3iydfa2uan on(0 eeomo iy1lmtrlu olt)trtrxopoo1al  mivi s srrr(rpoo1alxo fetys a2el(vonu0altrxr3totlm eaieo s) 2urxopoodoltnmfciat artaurp;t1apxnioeiyt a2rl(vont)tleomrctatop  auvi;s) rxm(opnodam e fvt t) 2tmu  ;o4oetoio3iasla2emn pnt0 leoircoadfpDrlneils)s2um(mpno4ol  lfesa(fsDtru o;t1tltomoeiatls2uanmo t4artnxo ia1la e ieo;t0 2xmxr iy4apenlics (  Dua(r no1aeenmictlt a2rauvp;t0tlxoir tadlmDeliei (0sruoir3iy1lmeemictl()arur( poo4oet  o3ilslaDrau p ()arxoir3iy1lpDe u i;t s2ur(r3oo4omtn ivta( s2uaxrpnu0olt miciys m ea( p t0 lxnmo3oatfaDe i sls0 2um(r3nu1lm emfeilsfaruau p;u4oexo ocild m2rmuvp;u0aleoio iotfp  au olt)srxrxo3oo1openmivs t arra( o;t4oeeoiocilt m2umums;t4aeeoxfciotfp eau ol( s2xmio iudapeelfet ( a2rrurono1aee micildla el(mo u0tltoxo3oadla eauesls srurio iu4llt  fct sfsDrax pot0oleomf3iyd aDea(ms t4aexrxociydlp   u i;s0sexmio3oy1ope mfviat) 2rmur nu1apxoiieild a rlump (0texoxociy1fa rluvol( trxmxo iy1olen ivtlsfartaxrp;u0ole mf3iadfmDuau s;u) lerxr oydfpDran o t0setoxo ny4oleemivtlsfsrta(ro;u4aeeo ociltfsDrln p t0trtrxr iydlm rluvi;(0 rumim oydopeemnvtltfsDraurpot0aleomociytlm2rl(mp;t4trxomo3iydfat luesls0truoiopiy1apen iei t a2rru pnu0apeoiocild m ua( s;u)tlerxr3iadom eluvils)sexm(m3nudlpee nctlsfaDrmu ooo0apxo octydfsDuln p;t4arermo3to1la r u s t)seto(opnudome mncs tfsrtm( p;t4teeoiocilsfa2rlu snt4areomf3totla r i s s  2trxr3iu4ap  mneta(faDtau o;u1apx ioetas mDulnvpnt0alxnxo io1lptrau ol()trum(o3oodlmte iesas  rrrxm nt4oeenif3ildfa ul( s u0 exomfcty1lp  lues;t  eto(rpoo1am elivsltfa2uaxm no4apeo f3tysfsDua(ms u4 lerir3oa1oatrai s t) rum(r3nudlmenmfcsls)srum(r nu4olxnmoetydfa2rlnmsnt4tlxrifctotfmte i s;()tetm(r3iodole  fei s srur(monu1apt  oeiltla2elums u4trxomf iotlpDrliei;t srxrio iodamee nvilt)s2ua(mpou1tlxnmoctasfa2ul(monu4artrxr tytlp ran ilt) rurxopnydll elict ()sruaxmoot0aee mf3iaslm rmuvsnu4alenio ta1fmD auei t0trum(o3no1lmtemietl(  rtrxm nt4teeo iciat s2ra(vs (4altrmrcoadfateaiesls0trtmxr3iydap  lneta(f Dua(m nt0teeniietldlm emumsnu0artnir3oatopteluvo t  2ur(o3nudlmt lfcs ( s2uru pnt1aleoii3tlsfa2uaumsn(0arxrifciydfaDrli o t) 2xoirpno4ol  livsas a2rrxm ;o4oee mocias m2ranvs t4trxnmfctytlaDeau sl( s2xm(rpno1om e nesa(f 2urxrp;u0aexo fcils s rm( pnt4tetomrctodlmDrauei t) ruoxmpno4ope lfvs t)aDrmxr ou0alen oeiytla ra( s;t4aexnmf oatlpDrauvslt srur(r iudomeelfetlt  2rm(mpnt0olxn fctldfs ua( s;u4aeeoio3iodfat luvsl(0s2xoxm no1omenlnvi (faDraxront0oee  icildlm umums;u4tltrircoydoat an s (0tetm(rpoo4alen fet (fsrraxmonu1tetomi3tytfa2em(mont0treoio ty1opDr iei;t0 2xm(opiy1ope lfctat)arrau oou1tetn fctat s umump t0 rtoxf tatla r nvilt s2toir3ou1altn nvs s)sDur(rooo1apx  fetldla2emn o (0tltrxrcoo1lmDrlnvi ( trxrxmpnudom   icilt)s2rr(m ot0opx ifetyt s2ea( sn()alxomr tydfat  ieilt)srumiopiodal elncsas)aDtax  ;u4alenioeils s2raumo;(0teeomf oatfp e n i;( trtr(mpoy4omt lictat a2ra(mp;t4olx moeiys m umnms (4 exrxo3oadoaD  ivs t)t2toxrpny1lme mncsl()srrm(r ;o0tptoiocilslaDea(vpnt) exnir3oy1fmtelneo;t)tetmxmpnydolenmnes ( s2umu onu1ole  oetlsfsDelumpnu0 reoifciodlm ean o;s0t2xoio3ny4opt lnvtl(f ruru pou4oleo o3iasfa2elnms;(4 rtnmo3iy1fm r i o;t t2xmxo nu1lmtn neiasf Drmuroou1tltoioctytfsDeauvo;u4arerifcoo1laD li s s)srumim oudaptnlfvtltfa2tmurpoo4tle mi3iytlsDumumpnt0altrif3iodom elu s s) exrxm3no4al nlncslsfsDumumo;o1teto f3tyd s elu pn()altrxrciy1lpD  nei () rxr(o3oodalenmictlt  2ra( o;u4tex iieiadla2rmumo;(0trtrmf3iodfpteauvo;(0srxrxmpoydapee fctltfaDtrxro;o4opxnmoetadfs um(ms;t) lerir totfmDeai olt0setrir3oudoptnmfvi (  Duaxmo;t4altomfctldlsDeau s ()texoxfciytlpDe ueo;s0seurxr oy1ol n fcsltf Dtmu p;o1alenmo3iydlsDelumo;t0 lxnir3oodlmt livs;t0srxoxmpoo1ap n fetlsfa2tm(m ot4aexniocild aDea(von()teermociydlmDr ivi;t t2toim iudalenlnvi s  ruaur ou0aexn i3iasls2eau o;()arenxf iy1lat aneols tetm(mpiydlp e ietas aDurx  ;u4aetnifeiytfmDrlnvs u)aexnxf3oadoaDelivs s) eumir nudlp nlnvt () 2urx onu1ape if3tatlm ua( p;u0aeenxr oa1lp   ivo ()srum(opno4omtelfcsasfa2um(m ;u4aptn oetls mDrlu p t0 lenxf ia1omte i i t)setm(r3nudol e iesltfs2tr(r nu1optomoctydls2emnvsn(0trxnxr ootomtraivslt0t2toxm3ny4lp elfci sf 2rax o;u4apxnifetadls emnmpn(4 reomociadop e ivs;s s2tm(r oo4lp e nct t) 2raurp;u0olen ociltfaDra(mpnu)trxoxf3iytopDeau o ()sruo(m3oodlpen ieslsf rrmxm ou4tetomfcils mDum(vsnu4 ltrxo3iotlaDr uvols  rxrxo3nu4amtnmfes s  rraumpot1tlt ioeiys s2eluvont) lxnmr iatoatelivi t0trtrxo iu1ll e iet ()aDtaurpnu4alxnif3tld m eln o u4trxrxo ia1optr nvols t2uoxrpiy1aptnmfctltf Dtmurp;t4tptoiictlt aDean snu0arerxo oydfat li o t t2urxm3iudll  mfes t) rrax  oo1oeeniociysls2rl(vont0 etniociadlmDrlu sl(0 exoxrpio1lmt mictltf 2rrxmpnu4oexnio3tatfs2eau s u) rtnif3iadfmD luei;t setoxo iydom emictat  Drm(mo;u0optoif3tysfa raumpn(4alenioctatop elueo;t  rtmimpny4ll elieiatf Dum( onu4oltn ocils s2em(vo;u4arxnmr todfp r u ils) 2um(m oudapenmics sf 2ua( p;t0olxoio3tys a2umu p;t)altrif todlatr n ol( sexmio3oo1apen nvsltfa2ur(m ;t1texn octydlsDemumo;u)aetrxrciydoatrai i s sruoxr oodlmt mivilt arua(mpnu4tpto feilsfmDeanvs ()texnxf3iadomtr ues s setrxo ou1apeemncil( a2ua(m nu0ape  fctydlmDumn p u4 eeomf oydom e nes;s)t2urxmpny4lm n nei tfa2um(mpnu4ole moeiydls ran o t4 etrir iodfpD anvs (0tetrxrpoodapt lfctat) 2ra(ro;o4olxnmictls s2rl( o t0 rtomfcoatopte u s;s0s2xmirpou1altn ivi s sDta(r ou4tee mictysfs2um(vs;t)altoxf3ootop   uvils srtmirpnu1ameemiesl( s2raurpoo4apxnio3tlsla2ul(mp u4trxomf3ta1lpDe uvol()s2xrim iodolt lnetas s2urumo;t1oeeoifeiytfm eanmo;t) etnmf oydla raneo s  rxr(r3nu1amte nesa() Dua(mpnu0opxomi3iyd m2elu p () etrxocoytlpD anvo;s0 euo(m nydope lnetls) 2um(r ;o0oetnmociasla rl(mon(0aexrxo3oo1omDelnvilt0s2umim io4aptnlnetas)aDum(m ;o4aexnmieiytls ulnvp (4trtrxr3tatlpDrli o t)srxmxr nodamee neiat) 2tmxronu4tle  fctat a uauvp (0tetnmo oodfm r ivi (0t2trxr3oy4ol e ncil()sDuax ooo4aet if3tyd s eluvs () rtnmo iodfm  lnvsls0t2xrxm3oy4ame mfes s  Drr( o;t0apeoioeilsfaDulumo;t) rxrxrciadfmte n sl()texrim nu4altnlieia()s2rr( pou0tpxo ieiad sDrmn o;()arxoif3iotlmDeluvols t2uoiopnudopenlfvsasfsDtrurono1aeen oetydla rln on(0 rxoircoy1fmDelu s t0 2toxopiu1oltelnet tf Dra(mpno0opeoio3iltlm2ul(mo;t) etrxr tytfm  lnes t0t2xmxm3oo4lltelivtlt)srrr(  ;u1alxnifciytfa umums u0teermocto1optran s t)s2xm(r3no1amtn fcsls aDtaur ;u4tpeomf3ild mDrmumon(0aeenio3oy1oate ivo;s)trtmxo iu1ol   fcsl( aDtrxmpnt0oex  i3tyt aDul(vp u0artrifctydlmDe u i;s0seuoxr nydop elfctlt) rta(rp;o1tltn i3iys aDua(von()areoif3oatfa eli i t)trxo(o no1olenliciltfaDua( pnu4olxnmfeiyt s2ul(mp;t)tltrmfctatla e u o s0s2tr(m3nu1am  lfesa() rtm(r no1oexn f3iydlm umnmpnu4tlenmfcio1lmt aivo t texoxopiu4ol nlivtl( srtau o;o0aptomi3tldla2ran on(4 lermr3tytlaD  nvi;t0 ruoxrpnu4lp n iciltf 2taur oo1tetnmf3iysla2rln p ()tlxnmf iy1fmDeln i;t  2uo(mpno4ll emfcs tfsDra(  ;t4tlxoifctyt aDeau o;t4aexnxo3oo1omDr neo;s)srto(o3io1lmen ict sfs2ur(ro;t0teenifeiltfaDum(mo;t) reomrctodfaD lies;s tetmxopnu1amtelncsa() rtr(m ;u1tpxnif3iat aDuln o t)trtoif totlpD liei t)setr(rpnu4apt mfvt tfa2uau ooo4olxnmo3tadls emu p t0aexrmo totfpDelueo;t)texmxm nu4alen ivil()sDur(r ;u4ale  f3iyslm ua(vs;u)alerxr3iy1latrau o ()srxm(m oudlmen nvil() 2rau oot0oee mf3iyt s umnmpnt0arxnmo tadomtranvs;t0srxmxmpny4lpenlnvtl()sDurxmonu1texn o3tat s2eaums;() lxrir3iy1oa eaiei;t0trur(mpoy4oltn fvt t  rrmu  ;o0openifeiytfsDrlnmo ()alermr3iydlmDr ieols s2trxo nudalt  fetas  2tmu poo4tet  o3ias a2rmn o;t4aeeoxo3to1fp eanei;()seuoio3iodlltnmfcsas)srtru  nt4aexnmi3iysfsDrlnvpn(4trxomrciotlaD lueols) 2toir3io1alenlnvtl( s2rr(monu4aeeoiiciys mDemu snt4 rtoxfciydfpte ivs;(0 2um(mpou4lptnmfvi sf 2trxmpnu0tee mf3iaslsDul( onu0trermo3ty1faDe i o s0s2umirpny1lptnlfvsa()srrmx ont4tleo feiytfa emnvo;t4tleomo3oy1omDe nvo;() 2uo(rpno4aptemnvs () Drr(r oo4opxomfciatfa2umnms u0texoxf oadfmDr u o (0setriopoy1aptnlnvtat)sDumu  ;o1aeeoio3iyslsDranvsnt0 eenif oa1lptelueil()srxm(o3nudapee fvi (  Dtm( ooo4aptniociyt m ua( o;t4 etoxr iatlaDr uvo t trumxmpoo1omtelieias s2tmxmpnu0olx  o3iltfm2rm(vpnt4tlenxf iydom   ivi;t)trtoxrpno1lpt  feilsfsrrax  ;o4olxnmo3tasfmDua(mon(4 lxrxrcoadlaD aivo;s0s2toir3ou4ameelivs s) 2ra(rpoo1ope mfetyd a eaump;(4 rxrmf3oatfmt au s (0 rurxm iodlm   fct (fsDtaur ;t1optnioetaslsDrmu pnt) exoxo3iadom   ies (0s2xoxrpiu1lmtnmfeiat)srrm( p;u4alt mi3iysls2ra( p;t4 rtrircoodop  aivs t teuo(m nu4lleemfvtls)srur(  ;t0aetoif3tadlmDemnvs;t4areoir3iydoate i i;()srtmirpiydlpenlncs t arurumono0opx  f3iadlsDul(vsn(0alenmrcoo1lp rlieol(  etoxo iydome mfcs t sDur(root4olxniieilsfmDeaump u)arxrxr oydopteaiei;t)trtm(r3no1olte nctl(  rtr( o;u1tptomoeiadla2umuvont4trtnmf3oytoaDr ues ()srtoxm3iy1amtnmncslt  2tr(  nt1tptn o3tysfa rau p (4 etnmr3oa1fpD lnvo t  rurxo nydapt micsat a2ta(mp;o1oet mociytfm2eauvo;t0 lxnio3tatlmtr i s;()s2uoxmpnu4ll  mnet ()a2rrumono4oet  f3iyd s ea( o;u)artoxfcoodom eauvi s srtoio iu1lp emfctasf 2rmum ;o4open i3ildfa em(vs t)texnioctydlmDe ivi (0srxm(opnu1lpee nci tf rtrumpoo0oltoii3tys a ul(mont0artrmocia1fpDe nvo;s0trxrio iydaptnlivi s)s2tru pno4oeeo f3iadfaDelnmo;t0tlenxf3ia1op raies s0srtmir oy1lm e nct sfs2umxrp;o0apeo octyslaDulu s u4trtomociy1lmDrlivi;(0s2tm(r3oy1lptelivi sfs2rau  oo4apeoifciadla2em( s u0treoif to1lpDelu s;()s2umxrpoy4llte feil() 2tauroou1oex  ieiytfs2ranmpnt4aexnxfciodfa e nvo s)seurimpoo1ameemiesat s2umxmoot1apt ii3ildfm emums u0aexoir3iadfp r ivi s) 2xrxo3no1lltnlics t srrau  ;t1oeeo i3iad s ulu p t0 lxnircoy1oate u sls0 rtm(r3ny4omte nct t)srrr( p;o1apxomieiysfs emuvp;t4trxrir oydom rai i;(0 2uo(rpiodol  lfcsas) Drr(  ;u4ole mo3iltlaDrl(vo t4teeoio iadlmteauvs;s)setmio nu4apenmfvt ()s2um(  no0tex  ieiys s rm(msnu0 exrxf oatfmteluvo s)setm(o3iy1al  lnvils)aDta(m ;o0tlxn icils mDum(ms u) lxnif3tatlpteauvols)srtoir oo4amenmfcsls)arumumpnu0optnioeias a2ua(von()trxnxf ta1lmtrli s;( setrirpoudlmtnmivsas) 2umur ;o0tex ifeiytfsDuanmpnu) etrmocoodop   uvols seurxrpnodlleelfetasfsDum(mo;t0tpeoifctltls2ulums t) etrifcoatoa  lueo ( sexo(m3iy1ll   ivi t)aDraump;o4tltoio3ildfa2el(monu4tetoxo3tadfaDe uvol()trxrio ou4al  lfvta(  Drm(  nu4apt moctls aDemn s;t0tlenmrctytlpt  i ols0srxo(m iudlp n fctlsfartr(r nu4alxomicilt m2uauvsn()altnxo3oatlpD li il( t2umiopno4alenlnct t s2tmxro;u4oex  feiys mDeanms;t) exrir3oydlp elivslt trxmxo3oy1ap elivilt)a2um( p;o0aeenmieilsls ua(mp (4aeenir3oydopD aneo t0 rxriopio4ameemivia(f rtau o;t4aetoif3iatfm el(vsn(4tetnmf ia1fm ran il(0 rtrxo iu1optnmics t srumxro;o4apeoii3tlsla2el(vo (0artnmo oy1fm  auvo;t0 2urxr3oudol   nctl(fsrumurpou0aexo fciysla ranvsnu4texrmr3iytlaD aivils  2xr(rpiu1lltn ivtas) Drax ooo4opt mietatlm ul( o;u4 leoifcia1om eluvil()teumxopiodom e iet s) 2ra(m ;u1optn feiatlm ul(msnt4arerir oadfp  li o s srurxrpoo1alte nes t)sDtmxr ot0alenioetyslaDra(vs;u4aexrmocootlatr n i;s) 2xoxopno1lp  miei t arurumo;u0aet mieiad s ean pnt) rerifciydfm  auei s)sexr(rpoo4lmeemfci s srurum ;t0teeo o3iltfmDrlnvon(4teeomo3oatfaDeanes;s0teurxm oodlmtn fvia( sDraurpnt1apt mfctlt sDrlu on(4 rxoxo3oytop  au o;s setrxm ny1omtemfvt sfa2trx  nt1tpto f3iytlaDemuvp;u0treoxrcio1laDraiesl()s2tr(opnydale  fesa(f rtr( ono0aeto i3iasls em(msnt4aeeoxfcta1fm eanvol( t2umxopiu4al  lneiltfa2raxrpot4oexn oeildfa2rmn s u) rtoxf ia1fatrln s t  etoir nu4optelict s s2trurpou1oetn octys a emnms;t0 ltoxf3iotfpteauesl()s2xrxo3oy1optemiet tf Drmur nu1oeenmietytfa2ea(mo;t)alermf oydfmDr neo t0tetoxr3oo4al emfcils  rua(root1optoifeilt mDuln s;u) etomrcta1fatr u i;t)srtmxr ny1amee ictltf 2rr(r ;u4oee iiciaslsDran pnt0 eenir tytomD ln s;s0 ruoio oo1apen ietl()aDraxroou0apeniociatla2em( on(0 ltoxo tadlp e ieol(0srxrxr ny1lm nmicsa(f 2trum oo0tpxomf3tyt sDrmuvo;(4 ltrifctytfm e ueilt0 rtr(mpou4lm n ivsl(farrm(rpou0tpx  iciyt s el(mo;t0aeermr iatla eai s;s)srtm(o io1ll emiviatfa2trurpno0aexn o3iyd s rln o u4arxnmr oodopDr ivi;( s2tmimpio1lmt  feiatf Dtrxm ;o4altnioeiat mDrmu o u0artnio3tatlmtr iei (0trxrxo3nodlltemnvt s)artmxm nu0alxnifeils a2ulu p;()tlxoxr io1omtranesls)srxrir io1am n fcsasf rua(mo;o0teen oeiaslm eauvo ()trenmrctydomtr ies;s  2tmxrpoudamee ietasfsDtrurp;o1oeeo f3iadls2el( p;(4arenmo oytfpDeaiei;t0srxoxopiy4amt livsa(f Drm(m ;o0tptn fciadfaDulnmo;u4 lxomf3iodopt livols)seumim iy1alen iciat)s2umu  ;t0alxoiietyd mDea(vs;(0trtnxr oy1opDe uvs (0teuoir3io4ll elncsat)a2taumo;u0apen ictasfm2ra(vpnu4arxnifciydfaD lneils)srtmir iudom   ivsat)a2rmx  ;t0tpxn ociltlsDumnmsnt0teeomo3iotoateaiei s)t2xrirpio4apt mfvtlt s2tm(rooo4alxomfeilsla rln s t0treoxo ootoptrluei;t0setmio3oudlltnlieilt)a2tau p;o4alx moeiadlsDea( o u) etoif todfat  iei;(  exmxrpoo4ol emivi tf rumxrpou1oetomo3ildfsDranvsnt)tltnmo3iy1fp ean o;t)s2tmimpoo4lmteliei s sruau  ;t0openifeiltls2rln p;t) eenmf iy1omDrln o;s  eur(r3nudol   ncilt  2ra(m ot4tet iicils s2rmnmpnu4tltnio3iy1fm  lnes s)seuo(r3iudlpen nvi t  2tax pno1tlenmi3tat m elums;u4aexnxo3oadla  livi s setoxm no1ol nmici ()aruax onu4tpx  oeiyd sDumuvont) lerxrciatoate iei;t  euoxr3oo1apte nes t)srtmxrp;o1opeoii3iasfs eanvs;u0texnxfcty1fmt anvo;s t2xr(mpiy4llenmneslsfa2tr( poo1tpxnmictlsfm raump u)aexnmf ta1opD  nvo t0t2um(opoydllen ieils)a2tmxm ;o1apenmi3iyd m2uanmp u0tlxnxf3todfat  ivi t) 2umxr3io1om elfvs (farumx  ;o4alt mi3iyt mDea(mo;()tetrmrciytlmt aieo () 2xr(r3oy4optnmictat) Dtmx  ou4aetnioeiysfmDumuvs;(4 eeniocoy1omDe ieols)srxr(m3iudoltnmnet s  rrr(rpou4tptoio3iltla umnmo ()alerif oodlmDe ivil(0 rxrxr oydlp   netls)s2taxr ;o0tex io3iyt a2umuvsnu0 lermf oydfa ean i;t0 rxoxr3iu1alt  nvslsfarum(rpot0tet  ietadlmDraump;u) etoirciytlmDr i s s0sruo(r ou1llte fvsltfaDrmumpou0tle mo3ildlaDuau o t4aexomf iydfpDeluei t  rtr(rpnudal emfetasfaruaumoot4texo ociysla2ulnmp;(0 eermr3todop r uvi (0seum(o3oo4al  mneta(faDtaxmo;t1alxniocilt a2rl(mo;(0aexoxr iodoatelnvs;() rtm(m oydlleelnvtlt a2ua(moot4aetn ieiydfaDra(vsnt0 etrxo3iydlp  ai s t t2ur(m nu1ome lfvsa(fa2urxm ou0ope  iciydla2el(vpnt0areoxociydlpDr uvilt  eurxmpny4optelfvt t)srumxmpoo1tlxo ietysfmDemu ont4artrxo3oytomDe nesls seum(opny4ameelicils s2ua(r ot1tetn feiyslaDelnmon(4trxriociodfmtrlu s;s0texmxrpoo4altemies (fsDurxro;o0olxomociad m em(mp;u) ltrmo tydopDr i i;s t2ur(r oy4lm  mfctlt)aDrmxm oo0ole  ieiadfm2elnmon(4aeeoxf tytfpte i o s)trurxmpnodome livtlt)a2ta( p;t4oeen i3iyd s rmuvs;()artrmo3oadopt aiei (0seuoirpoudlmenmivtatfs2taur ;o1altomfetls m eanvs u0 lxoxr3iytfp eli s;(  euoxr io1am e ieils  Dum(  no0openmoetldfm eln o t0 rxnmr3ty1om   u i ()tetrxm3io1oleemnvilt) 2truroou1opeomieiasfm uau s u) exomo3ta1latrauvi;t  rtoir io4op nlfeslt  2ur( oou1olto f3iydlm ua(vpn(0tetrxr oydlmD lnei;()teur(mpny4al nlfvs s) Draur nt1olxomfeiyt m2ua( p u0treomocoo1omD ai slt) etmio oydope lietat)aDrm( onu0tpxo ieiadfa2rluvonu0arermf todlm   uvo;t trxmxopnodamte netltf Dua( pnt1tlx ifeiytfm uanmon(0tlxnmr iydfmDean s;s trxrir nydamt lnetlsf rrax  oo4tetoiociad a eluvs t)arxnmo3io1oaDeanvols0 2tmir iodll nlfcsasf rtr(mp;u0oleoifetlsfs2emumpnt) eerxfcio1opD  u o;t  exm(o nudamee fcslt)aDtrxmp;t4ope mfetltfm2ranvs;t4texomf3oodfaDe u olt) exm(opnudoptnmics () Dta(root1alenifeild m ea( snt)arxrmf3ootomDeaivs s0trtoxr nu1ol emfviasf 2urxrp;o4apto oeiyt sDea( onu0aleomo tatfaDelu o;()t2urirpoudlp e nctl()aDra(r no4tpx  ociydfa eauvo t)aeeoir3oodfmte ieo;(0texr(r3oodaptnmieil(fartaxro;u0texn ictadfsDuanvp;(4tlenif oadfmDeaivi t0 etm(r iy4opte ieilt sDurxr ot1ape  f3iltls2umumpn()teenmocoytlpte ueo;s) ruoiopnodom emfet (f rua( poo1tlt iocilt a2ulumo;(0arenirciodfaDelneilt tetm(mpiy1alt lncilsfa2rmuroou0tptn fciydfa ran pnu)tlxoir3tydfp rlies;(0trtrir3nu1lltemneta(fsDraxrpot0aetnifeils m2rauvp;u0 lenmr3ootla e ivo (0tetrim3iu1llen fvtasfsrtau o;u4optn i3iadfsDumu s u4aetrifcto1lptraivi;t0 etoxo3oo4ope  ies t s2tmu pno0alxoiictytls eaums;u0 etnmr oa1lp rlneslt)t2xoir io4opt lfcils)s2raxront4olto feiyt m2em(vs;t0 rerxo oodfateauvo t)sruriopoudol  lfcs s  2ra(mp;t0oeto ociatlm ul(vont0 rxnmr3oy1oaDeaivi;(  euoim ou1optelivt ( arta( pno4olt ifeilsfs2ra(mp;u0trtnmr3iatla e uvslt0srurxmpiy4llen nctas) Duau o;o0aetn fctysla elnvo u4tetrxo3io1om rlueolt s2xoxo oy1lptnmfvsltf rraxmp;u1tptnif3iydfm ul(mpnu4 exrxf oydfpte nes;t sexoxr oy1apee ietasfsrtaumono1tlto fciys m ra( pn(0 rxomo3iytomDrlnvslt0 2umxm3no1om e fvs ()srumur no1olxn i3ils m umnvont)aeeomr3ootlp ran i s)trto(rpnu1lm nmiesls)srtaum no0aptnifeiasls2umumsnu4 lxoxr iodom  anvs (0 rxoxo ou1ol elivi (  rtaxm nu0oexo ictltfs ul( pn(0 exnmocia1fatrlueo t sexo(r3ou4lpen fvilsfa2tau p;u4alx  fciatls uanvpnt4 exrio iydla rauvil(0teumio oodolenlnvilt  Drruronu4tet iiciadfa2ulu p u0texrir3oy1oaD aues s texm(r3ny4olenlnviat  2rrum ;t4optoifciatfs2el( s (4 rtnxr3to1optelnvo s) 2toxopoo1lmtnlivsl(fa2tau ooo1tpeo feiltfs2emnvsn()trxomf oytlm eli i;s) rxoxmpny4lp nlivias)s2tmumo;t1tlxnmfeiadlaDulump t0aexomr ia1om rauvi (  2to(m3oudlmee fcsls  2ra( oot1ape mietadla rlumont0alenmociatomDrli sl(0trtmir oodlmtnlfvslt) rua(rpot1tptnmf3tadls2em(vo ()tetrioctatlpt lnei;s0seuo(r3no1omtnmieilsf Drrxm ;o1oeeo oetadlm emnvont4tlermf3iy1omDr ieslt) 2tmirpoy4am e neslt sDrm( pno4oeeniiciyt a2eauvsn(4tetnxr3tatlaDr i i;(0 2xmxo ou1apt mnvias  rum(mont0oetnifctls s rmu s u0tlermociadlaD  u o t)t2umxr ny1am nlivi ()sDuauro;o0opxoiocias s2rmuvsn() rtrxf tydomt lueo (  ruoiopiodam nmnci (fs2raur ;t4tpt  feiyslmDulnvo t0 lxnifcoa1fp e ieo;( srxmxm ny1om  lnctat  Duau pnt1altniicilsls2uan p u0 etnir3oadfateau o t)teur(opny4op  lfetl()sDrrxmo;t0olto i3iad m2rm(vsnt0arxrifciytlm rlnes t s2to(rpio4ap elnesl( s2raumooo4tet  fciadfa rlnvo;t4aeerio3ootoa e ueilt)seumir nudope mieilt a2trxr ot4alenmoetaslmDrmnvo (4 lerxoctatfa  aueo;() 2urxm nu1op  mnetltf Drrurpno1tleomicilsfmDrauvo (0aeeniociy1faD  nvs;t) rtr(o iu1olte feiasf 2tr(mpoo1tptnifetad s elnmo t4tlxrir3oatfaD ln s;t) exm(r3iodlm nmieias s2tm(rp;o0oexomi3iysla em(vo;u0 ltoir tytlmD lu o (0srtrxo3nydomt lfei ( s2rmxrpno0tlxoifctydlaDuanvp;u0 exrxf oatfmDeauei;t0 2urxrpnu1om  lfvtlsfa2urxr ou1openmf3iadlm emn o (0 exnircio1lpt aieslt)trxmio io1lle mfeils  rurx  nt4aex mietld mDrmumpnu)aexrxf3oa1laD  u o (0t2toirpoy1aleelnvt (f 2ur(m ;t0tltniocilsls raumo (0trerxf3totoa eaivs t teuoirpiydomtnmfvils)srta(mpou1tltn ociltlm el(vo;(0tetrxr3ty1fp  au s s0 2xmxr3io1ll  lnvt sfarrru ooo4ape  f3iatls eau pn(0 etnxocoo1omtran s;t) 2xr(r iy1al  mfesas  Dua( pno1olenifeild aDrmu s ()aexomo3iytoaDe n o;( teumir3ou1lmtemfci sf 2uaurpou1tlenii3tadfm2rauvs (0 rtrifciytfmtelu i t) rum(mpiodll  mnetlsfartmum nu1oetn ocilsfmDulumsnu4tltrioctodfpDe neol(0 etrio nu4ap nmivil( a2rau  oo4altn f3ild a elnvs u4tlxnir iatfmteai i;t0 rtrxopny1llen ict tf rua(mpno4tptnmieiaslsDranvont)teeniocootomDeai i;s  2xrio io1ol nmiesls  Duaxm nu4oeto feiys s2ua( ont4tleomrcoytfptr nvo;s) rurxmpou4ap  mfcta(fsrra(rpoo1apenmo3tls m2eanmo;(4 exrif3oatfp raivs t0 2uoio ny4apt  nei t arur(mooo1tet miciydla2elump u0 rxrxo3to1fpDranvi;s srtm(opoodamenlfeias  2ra(rp;t0tleoiieilsfm ran sn()tetrmr oadop  lu i t)t2xrirpiodameemicsatf rua( ono4ope micildfmDra(vp;()tlxnmf todomt  uvi () exoxmpiy4apt  iet t)arrrxr ;t0tex  f3iat sDea(mpnu0 leoif3tadlatr uvols)setm(o iy4ol nlnetas  rrrxmooo0optomiciatlaDeanmpnt0tltnxr oydlaDr i sl(0texmxrpno1olenmieias)artaxrpno1tpt  iciat a emnmo t0aleoif io1lmDeluei s sexmir iy1amenmiei s)aruaxm ;u0aexo ieild s um( s t)areoir3iatfmtelivsls0t2toxmpoo4omtelncs t a2ururoou4aptoiietatla2umumsnt4 reoxfctydlatelivilt0srumxr3iy1omeelfct (faDraumpoo4tlt  o3ilsfa2rl( pn()artrxf3ty1lpDeaueo t t2umirpou1omtnmfesls s2umurpnu4alxoif3iltfaDua( o;u0 lxnmf3io1lmt  nei t0 exrim3ou1ome  ivsas)srumump;o4oetnmo3iasfm uluvs t0 rtnxfcoodlpDr ivsls)srtr(o oy1lp n neilt sDtr(r nt0aeeomociyt s2ua(ms;(4 rxrir3iydfpD auvi;t) eur(o3no1omee nesa(fs2urumpnt4aleoiociatfs2ul(mont0 exrmocoydfaDe ues ()seur(opio1apee net s s2uaumoou4opeomf3tasfs2em( p (4trtomr iydlpD au s ()s2trir iy4om elnesa()sDrrum ;u4olenmoetad mDeauvp;t4aexnxf iatlp eaieilt sexmxr nu4ale  fvilt  rrax oou1tpen o3tyt s ua(vpnt)artrmf3iytlmD anvslt0t2xrir nu1opt  ncsat)a2trxr ;u0oexnif3iadfm2rlnvs u4aexnir to1la ran o;t0s2ur(m3ny1apt  nes tf rumxmo;t1ope mo3iad a2ul(vpnu4 lxnxr ootlmtr i i ()texmxr3iy1lmt micilt) Dta(rpno0opeoioeiydfm ranvp;u)tlerir3oodfp  luvslt)setoir3oydol  mivtas)aDrau pou0texoifeiysfm2ul(vpn(4 lermo3tatfmtelues;t0texoxmpou1ale  nviasfartaxmo;u0tetomoeilsfaDelnvo u)trenmfcoa1lpD  uvi () rxr(opnudlpeemfvta(f rrr( oou4teeomfctlslsDumums t) eenxf ty1lm  li s () etmiopoo4lmenlfetas)a2tau  ;t1oeeo i3iydfm ul( o u0tltoifctytlmDranvsl( trxrirpnydlle mivsa(faDtm(mpno0tlx iociytlm ulnvp u4tltomr tydfatran ilt0 etmxr3no4op emfeia(  Draurp;t1tex  oeiysfa2rmnmo (0alxrir3iadomDrli o (0 2tm(r oy1ol emfci (  2uaxm nt1opxn f3iadls2ua(vp;t0arenmr3oodop elues t0srxoxrpiu1ap elnvslt artaumpou4tee  i3iys s el( snu0tetomf3to1lp rlivo (0t2xriopiy1lptnmnesa() Drrur no0teto fctat s rm( o;t)treoxf oatfm rauvsls s2uoim3io1ll  lfcs (  2rm(m ;t4tpxn f3ilslsDea(mo;()artnxr oy1opt anei ( t2trirpou4olen fctl()sDrmu  ;o1aex  ocild sDemn p u)altomo tadfp e uvils0trxm(mpno4omtemiviat sDumx pot1ale io3iytfm2rmu p (4tetomrctytlmteaiesl(0 rumxm ou4lleemiviat)s2ta(m no0aee io3tad m ran s u) lxoif3ta1opD  nvil( t2xmim nu4omeemivias)s2tax pnu1olx moetasfm2uanmp (0 lerxo3oodlpDr n o;t s2uo(m3iy4lpeelfciatfs2rrx ooo4altomo3iat mDua(vo t) rxoxo to1fat au i;s srtrxrpoydalt mnciat  rur(moou0tpt  i3iatfm2em( p;t4tetrmo oy1lptelnvils0tetmirpiodlp nlivi t)sDurxmpnu0tex  oetatlm2el(vs t) rxoir oy1fa eaivs t srurxr iu1al n ici t  Drm(m ;t4aptoifetad m uaums (0tltrmociotoate ivs () 2uoxm3io4lle mncia( s2rrx  nu0tpx ifetltlmDraums;t0 ltnmocoy1opteanvi;t  rxo(r oydlptnmncias arur(moou4altomoeiasfm2rl(vp;t)arenmr io1lm r iei;() exr(m3oudll   ivs tfsrraurpnt0olt mo3iatlaDemnmsnu4trxnxocoadlmDranes t)teurirpno4ap elfeslt)aDumxr no4aleoii3ilsfs2umnms () lxrmo oydoptr nes t) rxm(o nudap n feil()srrrump;o0tlx  ietas sDeaump t0alerxr3iytlm   nes;s)t2uo(m3no4apee fct ()arrau  oo4tleniociatla rm( s;u4 ltoxo3totfpD an sls truoxm oo4ope lneia(faDraurpno4teeoifetatlm2eln ont4tlxoir3iy1fa eluvslt) 2umxo iy4lpeeliesasf rtm(r ;t0apx iietydfmDrmuvsn(4aeenio3iatlp r uvo s) etmiopou4alt mfvtl(fa2urx o;u1alx ifetlsfs em( s t4tetnmf ty1fmD lueo;t)srtm(r iudoleemfvs tf rrax  no0opxoiocildls ra( sn(0aleoif3oodoatrlneo;t0 2uoiopiodalen fcia(  rum(rpoo1openif3tyd s ul( s;u)aexomf io1fatelivs;(0 euoio oo1lp  licsas) Duau ont1oee io3ilsfmDem( p;u) eeomocoo1lptrauvo;(0 ruo(r no1ol nlneslt  rraxmont4oet mociysla eluvo;u4artnif tydomt livil(0s2trxr3oo4apte nvtl()aDurx  oo4teeomi3tasfmDrau pnt)trermr ta1lpDe ieo;( srxoiopiudlmeelivs (fartauroou0aexn octydfaDumn o (4 ltoiocia1fa r nvs s trxoxopiodale  fvtatfaDrrxmo;t0apxniociatfm2umn onu4arxoxf3tydlmtelues;( trxr(o iy1al e fet s)a2urxm ;t1olx  fctatlsDeluvp u0tlxrxf3ty1fpte u s () rtrxo io1amtelfviat) rtru oou4aeeoifctydfs2rauvo;u) etrxf ty1fmtean s;(0texoim ou4lm   iesasfsrtaxrpoo4oetoifeiydfmDrauvp;u4 ltomr3tadomDeaieolt0 rtoirpoo1aptnlnviasfaDtaxrpnu1tex mfciadlm2umumo;t4arxrxo iy1faDr uvi;() rxmio iodlmt  ictlt sDraxmo;u1aeeo oeiadfa2ranvsnt)tetrxf3totoat lnei s sexr(mpiydome lnct s s2ua( onu4aetn feiat m em(ms u)arxoio iadoaD lu ils0 ruoxmpoo1ol e ics t  Dta(rpnt4optniiciatfsDelnvo t4 rtrxf3todlateln i;t) 2umio nudal  mnviat s2ur(rooo1olen i3iadls2rm(mont) lerxr oytfatrai ilt)teuoxmpoy4olte ivsl() 2rrx ooo4alx ii3iysfm2eau pn(4 eeoircoo1fpte i il() euo(m no1alte neta( aDtauro;o0tltoio3iadla elnvp u4aexoxf3oa1optrluvolt) exrxrpno1ll emies t srumu ono0aleomi3iys a rm(vp;(0arxrir totlmtrlieslt t2urio3ny4lm e nvt t)aDtru  oo4tlt  fctydla2rl(mon(0treoxo tydfmDr neo;s0srtrir oydlm nmictat aDumxmp;u4tpxnmo3tldfaDumnmon()tetnxr3tadfaD lu s;t sruoio3iydaptnlnetl()aDrm(rpot4oetn i3tadfs rl(mp (0tetrxo oy1omtr u s s)t2uo(mpno4ol nmivtasfsDtm(ront4ape mocildlaDulu pn(0 eenif3tytlp rlnvol() etmxrpny4al  lfes s sruaurpnu1oee ifctyd s ra(vs;u)arenxr3tatfpD luvsl(0 rxrxrpoy1ll emfcia()aDuau p;u0olt miciltfs2el( p;(4arenxr3todlpD ln il( texoxm3io4al nmfvils  2rmumoot1oltn fciytfm2emumon(0artoircoatoat anei;s t2toxr iy4omenlfci s) ruaum ot0oexo o3tydfm2eauvs;u)tlerxo3oydopt  uvs s0seurirpnu4amtemfci t)arrmxro;o0apeo o3iat sDel(vs;t0tlxnmrcoytfat lnvil(0 2tr(m3ny1oltelics (fs2ur(mpoo4opeoiociat a2elnmsn(4tetnmf3oo1opteau i s0 exoxrpiodlptnmies s sDtax  ;t4apeomo3iltls2ulnvo;t0arxoxfciytomDrlnei;t tetmim3oy4llenmfctl() Duaxrpot4aleoiocildfsDea( p;u4 etnxf iy1fm rlnei s  2to(o3iu1lmte fvil( arrmumo;u0optoifctadlm uanvo;t)tetnio3ta1oaDrai sls sexrio iodapeelivs (  Dtmuro;u1oeeo octlt s emnvsnt0 lxnxocoytopte uvo s trtoxm3iy4alenmiesl(f Drmxro;o0oexo o3iad m rl(von(0alerir3iy1lpDe neol() etoio ny1omtelfcs s)a2rrxr ou4apxnifctls aDrmu pnu4 eeoif3oodlatr neo t0tetr(o iy4al  mieiatfarua(mo;t1alxnioeiydfa ul( o;(0 lxnmf3iotla r i il( t2urxmpiu1ap nmnctls)aDrmu pou0olxnioeiatfa2ra( s (4altrir todfptr nvo t  rtr(r3no4am emfvslt)srraum ;t0apxoiociad m2uanmpn(4teerxo ia1lmteaues;()setrxm3iodam n iet s)aDurxmoou4apxn ietyd m2eanvp t4areomr tytomDeluei t)trtr(r3nu1lltemfeslsfsDrrx  nt4oexo i3tytla2rm(vp u4arenxr iydfm raues;t texmio3nudaptelivi ( artrx pot0olt mieiyt s rm(vp;u4arxoxfciodfmDrlnes;t0 rxmir ny1lme miesl( arrm(ronu4oltomoeiysfs2eanvp;t4trxnif ia1lm eln s;( setm(r3ou4ap elies t)aDurx  no1apeomf3tytfaDum(vs ()trtrmo3ootfm r ivo (0srumimpiu1ap nmiviat aDrmu oou4optnmfetatlsDea(vp;u)tlxomf3oy1fpteli ilt0 etrxmpou4ap e nvs t arur(ro;u4opxniictytlaDrmnmp u)aeenir3oo1fat au olt0s2ur(m iu1ll n nvta( sDrm(m ;t0oexomi3tasfs2rlnvs (4arxrxf3iodfm  auvs t  2xo(o ou4ap  liesls a2uau ooo0ale mi3iyt m2el( s t4aetnxr oydlpt  i s t  rtmir3ny1lmeelnesls) 2taxmono4teto ieilsfa2rm( snu4 rtrxrciodoaDelivils tetoir3oo4omtn iesls)srtmumpnu4ale ifciatls2umnvs t) exnmr3ootfatr ieils)trxmxrpnodap emfvtasfartmx  ;u0tpeomfetasfm2rlumo;(0 lxrir3io1op eln olt0tetm(mpoodlpee fetlt  Dtrxro;o0tpt io3iltls2el(vs;(4trxoxo ta1lpD anesl(0 2uoxrpnudll  mnvi s s2ua( pot0oetnio3tat mDul(vs t0 ltoif3io1faDeln s s t2umiopnodoltemivt sfsrtm(r no0aleomf3iytls2rl( p;u) exnxo3to1omtr n s;s setm(m3oudlpe  netas  2rr(r no1aex ioctys mDra(vpn() etrif3tatfpD ai i;(0 rxr(m3nodlmenlnvsl()a2raxr ;o0olx ioeils a ulu sn(4 exnmociodfat livils)setm(opoodam  miesl( a2rrxrooo1oee  f3ilt a ea( ont) ltnxf tydfaDranei t srxr(o3ou1ap  mnesl( arrr(r no4olxo f3ildfs2eanmsnt) rtoxo3ta1fmtraivs;s0sexr(mpoudlpt mfvtl()srua(m oo1tptnmfeiydfaDemuvs u0 lermf3tadlptrli s;() 2tmir3ny4lpeemiet ( sDua( p;t1teen icilsfsDranvs;u) ltrxf3iy1fpDelivo t)s2xrim nu4am e nesa()arrm(  nu0ape mf3tys sDrmuvo;t0 etnmo oadom rli s s srurimpio4lm nlfeiat) Drrx  nt4tlxoii3iytls el(vo;()texoxociytfaDeanvol(  2urir oy1lpt mnet (fs2um(ro;u0texnif3tlsfm uan p t)arxoxocto1lpt auvsls)srum(rpiu4lmenmictlt aDtm(rpot1apxnmfeiltlmDem( p;(4trtoif oa1fpDrlu ilt seurxopou4lmen ieils)sDrm(mpot4alx  i3iat m ua(mo t0trxrmf3oydfmDr neo;(0 etr(m3iodap emivs t sDtm(m ;o4alxoiietlt a2rlnvont4 lermo3ty1la r ivols0t2tr(m oudaltnmfeils) 2rmxrpno4apxoii3iltls rl( p;(0texnmo oo1fm r uei s0trumim3nu1llte ies t sDumxronu1tetomoeiatlsDem(vont0aexrxf to1faDelueslt0 2urxopiydlpe  nei t)aDtm(mpou0oex mfcild s rluvo;t0aexrmf3todfa elivo t0 2ur(m3iudlme mivslt) Dumuroou1opxomiciasls2uanmp ()trtrxociydom ran ols setmio nudlmenlfctas artrum nt4teto ieiadfs2ea( o (0artnxr tatlpt aneo;s texoxrpoydoptemieilt arumxrooo0aexo ociydfmDumnmo t0 lxomr3iy1om elu o;( setmxo3iodam   ict sf rtr(mp;u4teenmicilsla ean p t4aleomocoy1lmD an o;( sruo(m iu1lmt miesas  Dtm( o;u1aexomo3iltla2em(vs (0 rxoir3tatoaD lnvolt0sexrxm io1lm nmfctls  Dtaxro;u4olxnmfeiasfs2ulnvo t0 reomo3iy1omt  u il( srxoir oydllt lnvil( aDrmurpot0ape io3tldfs2rlnvo () lerir iy1fat lnei;t0s2xo(m3oy4optnlfcsa() Dtrxr ;o1apxn oeildfa2uauvs u4alenxf3ootop ranvolt) 2umir iodam  mfctlt) rrau pou0aexniociatfs uau s;t) rtnmr3ia1lpt anvi t)srtrxm iodllen netlsf 2ra(rpno0aetoifeiys m rmu sn()altrxocoodfa  auei ()s2tm(opnu4ll  lnvi () 2umumpot4ale ii3ilsfa elu p (0altnmo tytfp rluvils) 2trimpiy1ape licsl( aDrmxr no1tptn f3tytlsDua(vp (4 lxoxrciytfatran i;s seur(mpiydomee nvsl()a2ur(r ;t4oexoioeiydlaDelnmo;(0tltrxociatfmDeaieo;t0trtoim3ou4opeelneil()arra(  oo1aet iicildfm2uaumonu)artrxr3ty1omt anes;s setmirpou1omte fet sf rtr(rp;o1alx ioeils mDuln s u4trtnirctatfm r uvo s) 2um(m nudap  lfesas)s2rru pot1oetomfeild a2uluvpnu0altnmo iy1omDe n i t s2um(r3iodole lncsa(fartm( pno4tee  o3iatla2eaump;u4texoxr3tydfptr uvols) 2um(m3nydomtelfctatf Drr(mpnu0opxo iciat mDrmnms u0 etrirciy1oat  ieo (0 2urio iu1ll emieilsf 2trx pno1tee mociys a eln p ()trermf3iatomDelivo;s srxoirpnudlpee fct ( arum(r ot4aee  i3iltfaDea(mpnt)aeeoir iydlmtelnvi;(0teuoxo3iodalenmnctas  2ua(ront1oetnii3iasfm2rauvp;t0 exoxf iotfm raivolt)truoxo3nodomt lnci t s2uaxmo;o4tetn ociadlsDranmpnt) rxomrctodfpDe i i;t)trtoxopiy4lltemnes (fsrtm(mpnt4openmicild sDemn pn(0trxomf3oodomteanvi;t)texoiopou1ame  nvil(faDta(r ;u1tlxniictat m2eauvont4texoif3iodlm   n sl(  exmiopoudlp  mfei tfs2rmuront4apenio3tlsfm elnmo;(0 eeomrcoo1fp ran i (0 rtrxm3iy4ap e ncslt)sDtmxmoou0altnmicias a2umnvo u0tltoir3totoaDrai i ()texrxm3io1al elfvilt sDtm( ono4aexn i3iydfm2el(vs t) ltnir iadlatran o t0teum(m3no4ome  fcil(f Drau  oo0opx ifciltla ra(mp;(0trenxfcty1om   ivols0sexrxr3io1lmtemfvt ( aDurxront4teenifeiad s uluvs t4arxrmfciytop e ivs;(  2uoir3nodal elnviatfaDrmumo;t0optnmiciysfaDum(monu)tetnir3totfp elnei;t s2xmir oo4aptn nvtl()srum(  ot4tltomoctydfs2ulumsnu4areoxf tytlmtrln i s0 ruoxmpio4aleemictas s2um(mp;o4oeeniocildfmDuln s u4trtrir3tydlpteaneo;s  exoiopoo1omtemncs tfs2rm(m ;t4tpeoiociatlm2rl( pnu4aeenxf3io1lmD lueil(0tetoxr nydamen ivs ()arrmxm ;t4texo f3iytfm2ul( pn()tltoio3iy1lm  anvo t)srxrxm3iodlm   fes s s2urumo;u1tptniocildlmDrm(vo u4 eeoxf todfmt anvs s) 2to(o3oo1omee icsa()a2raum nt4tpe ifctlt m rmu s t0tleomf iotlaDran ilt tetoxo3iu1oltelnesasf 2umxr ou4ale mf3iytla ua(vo () exnxf iodlp rlnes;( t2xo(opiodamt mivi (  2rmur ot1tpeoif3tls aDean s (0aetnxo3iy1omDrli i s0seuoir no4omtn ncs (fsrrax  nt1oleoifeiatlmDra(von(4aexnmr3ootfaDe iei;t)trtm(opiy4lle mncilsfaDumx poo0oexomictatfa emu pnu0tlxnir tytlptrli ols0srxoio oydom  mici ( s2um(rpot4altnio3taslaDem(mo;(4 lxrmocty1opt  i ol(0srur(m3oydlmtnlicsat arua(rpnu1tptnmfeilsla rmumo u4 rxoio3tytfmDeauei ( seum(mpnu1lp e fcs s)s2ta(m ;o1oetoioctytls rln p;t)alxnmf3oy1omDranvs;s t2ur(r3no1llenlfcs t a2raur ou1tpxomf3tld s2elnmo;() etrmrcoatlmt liei s0 eurxr3nydopee fci t)a2taumpoo4olxnifciadfaDuluvp;u) etrio ty1lmDrli o;(0seur(rpnu4op emnct t a2rru pnt0olxomfeiltlm um(mont0tltomr3tytfptr ivi ( setmiopnu1opeelneilsfs2tmur ;t1tle iicias s umnmo;t4arxnir3oatoptr nvo () eurxr oy4alenmfctls)a2umxmpou1oltnii3tls mDea(msnu4tlxrir3iy1fmDean sls) etm(r iu4llt lneslt srur( ono4alen ociydfm elump (0tlenioctodlat lieo s texrxm oodopt  nesls sDra(  oo1teeoioeiytfaDeln pn(4tlxrxf todlm raies t)s2uo(mpio1oltnlivslt  2rr(r ;u1aexomi3tat s rlnvo t) rtoxo3io1fp e uvs ( srxmim oydope  ivs s  Drauroot4oex mo3tldla emu o u4 etomf oadlm r ieilt  exmio oudopte net s) Dumx p;u1tee ifciydlsDuaump ()trenxr ia1fp rluvo;() 2urir3ny4alte fcslt  2ururono0altnioetysfs2ul( snu)tltrxr3iy1fm  an o;( srxrxr3no1ll e nvia()arta(mo;u0aeenmfciytls2ra( snu0alxrxf iotlat  ieols) eurio io4lmtn fesas a2urxmpno4alt mietadla2emnmp;()aexoxrctadop   uvilt0 etm(o nu1ame lnciat)sruauro;t1ale mf3tadfsDel( o;(0 exoxocio1opt ai slt) rumim iydom emfctat)s2ua( ono0teen octls a2el( p t4 etrirctydla r n s s0 exr(o io1lpt  fvil( artaxrpnu0olxoiociydlmDumnvp ()alerirciy1fm elneolt srxm(o oy4al e iesas aDta(r ou1tpen octat mDemuvsnt)texrxf iatoaD ai s;s srtrim3oy4omtn fcsl()aDur(mo;u1olenmiciatlaDemumo ()tlxnir oa1oateanvo;() rxrxm iydolen nci s a2rr(mp;t4tlxomieiaslaDra(mo t) rxomo3oytomDeaivi;s0s2xm(r nu4lp  licta()a2uax onu1apxn fciadlmDrm(vpnu4 eeoxo tydlm  livi;t) exmxrpoo1omt  fvt tfa2uru ont1apeo oeiyd aDemuvs u)trxomf oadfmte u o (  2xr(o iy1lp   fciasfa2urxm nt1apenmictyd m ua(mp () reomo tydlatelnvi t trxoir3ou4lleemfci ()a2uru pno4opx mocilsls2rlnms;() rermrcoytoa  li i;t) rur(r iy4ole lneia(f Drmxm ot4tpto i3iltla2ra(vp;u0 exomfctodlp eauvs;s0teum(rpiy1ale miesa() Duaum nt1oltomoetldlsDum(msnt4alermfctatoa eaueils  2toio nydam nlfcsl( sDurxmoou0olt mf3iat m elnms u4 rermrciodfpteanvo;( trxm(r3oo4alt mies t)aDrrx o;u4olt mociyd m2umnvon(0 rtoio tadfp  lu sl(0trtrxm3iu1amee ici t aDurumont4apt moctldls2uan p;u)aexrmociadoaD  ieilt0sruo(rpoo4al emieslt srraump;u4tpxnmocils sDel(vo u4trxrirciatlpDraneol( s2xmir3oy1lpenmfetls)sDuaumo;u4ale ii3iatlsDuau s u0altrxo3iotlp e u ol(0texrxo3ou1llenmneta(farurxr ;u1oexomf3iys a ra(mo;u)teeoxo3oa1lpDean ol() 2xrxm3io1oltnmfcsa()arurump;t0aptomfeiadfmDumuvp;(4 ltrxr3ty1optelues (0srtoxmpiodamee iesl()aDtmxroou4teen o3iyt s2ulumo u4trtoxr3oytlm e ies;t0 exo(o nodomt  nei (farur(monu4apeniiciadfaDeau p t)tltrircoy1op r uvil(0 etrxmpou1ome mnci tfaDtmx ont0tee ioetlsfa2rm(vsnu)tltomf3iotfmteaivol(  euo(o oo4ol  mietl()sDrmu oot1apt mo3tyd aDum(ms;u0alenif3iydlatrlnvo s0s2xmir3nudope  ivi t aDum(  ou1tltn f3iysfa2elumo t4tlxoxo oatfp  lnvi;()trtm(rpiudoltnlnvs s aDtm(mpou4aexomoetlt sDrau s (4arxrmociotoa rlivo;s0 2umir3ny1lmt micsatf 2umxrp;t1tpx  o3iltfa rauvsnt) lxrxf3iytlat lieol(  euoim nodope  ies sfsDrmumpno0teenifeildlm rlu ont0aetrxf3oydfpD ai o ()truoio nu4lleemncs ( a2uaxmpnu1tptniietydfm2rlu s;(4arerir3iotlatr ueo ()s2xo(opio1lmenlneil()srrmumo;t1tlxniictltfsDem(mpnt0areoir oo1lpDeluvo;s0 2xoxrpno4lmtn netat sruru p;o0tlx  f3ildfaDeau p;t0aexrmo io1lp eai s;(0 rtm(m3oo4llt lfvia(  Drm(mono1tltomieiydfa umnmsnt0trtnmf tadoa  an olt) rurimpny1aptnmicia(fsDtrum oo1texn icildlaDrmums;(4aexnxf iodlm e i o s)srur(r ny4lm  mfet s)s2umu pnt1tle  i3iysla2rlnvpnu4alxnif iotla r iei s  euo(o3ou1lmtnlfetas  Durxm oo1alxnmfetysfm rmu p t0tltoxr oydfp  auvs;( truo(opiydopenliviasfaDuaum ou0tlx iicias a ranvsn(0tlxomrciodla  au slt)s2tmxr3oodaltnmfetasf rtrumoot0opx  octldfs el(vont4 etnmr ta1opD  n s;(0texmir3no4olt micsl()a2taurpot0tpeo feiytlaDra(vpn(4 etrmf3iy1om e ueolt0tetm(opno1lpeemfeia(f 2uaxrp;u4olxniociatls ulnvsn(0tetnifcio1lp rlivi;(  2urim no1al  livs ( sDraur ou1tetnmo3iltfa ulnvonu0trenxr oatoa  li sl(0trxo(r3oodoltn icsasfaDuru ono1apto ieils sDum( p;(4tlerxocoa1lmtelu sl( s2uoirpoy4ameemivsa(f rururo;u4alxo icilsfmDelump;(4arxoif3ootlaD  nvi;t)t2xoir io4oleelfvtlsf Dra(ro;u1tltn feiysfaDem( onu4trxoifcia1opt aues t)srto(o3nydoptemfet (fa2ra(m ;o4oltoif3iytfa2um(vo;u0treomociodlaDelu s;(0srtrxo nodape mictasfsrum(moou1aex io3tydfa2rm(ms;(4alxnmr3oy1lmt lneo s0s2xo(opio1lp n fetls srrmxro;u0oex mfeias a2rmuvpn(0 ltoxo oydlateaivs () rxm(mpiy1lpte ietl(fsrrrumonu4ape ifeildls ua( s;u)tetoioctadoa r nvo;(0tetrxmpnu4amtnlfcta( a2tmxrpno1aetniocildfs emumsnu)areriocoy1oaDeaneol( s2toio3iodllt  netltfsruau oot4tpt  ieiaslm emnmp u4altoio3oydlaDr ivs;s0t2xo(r3iy1ap elieilsfs2umx o;t4aexnmfcils a2um(mp u) rermo oydoat ai s ()sexo(r oy4apenlnctl()srrmump;u4aeeoiieild m um(mo;u) ltnircia1la rluvs;( texo(r no1lm   fvi tfarrm(r ;o4ope miciasfa rluvo;t0aexomr3oytfatrluei;s0teurim3iu1ope mfvta( s2rm(  nt1oleoiictyt s2ul(vs;()tlerxfciatlmtranesl()s2xo(opno4llte ivia(fsrua( pot1tpxo i3iyd a eanvp;(0arxrmf3iotoat lnei t0 2umir nodopeelnesl(fsDrmum nu1tlxnmietadfs2rmnms (4aexnmr oy1fpD aues s0 etm(m3oodop e nvilt)s2rrxmonu1texo ietadls ul(mpnt)trermocta1lpteli o;() 2trxr3nodlp nlfetlsf 2ur(ro;t4oetn iciytls2ua(mont0 lxrxf3iatfpteaueil(0texmxmpiy1lm e fvsl(faDtm(m ou4tlenmiciat mDranvo t4tetomf3oodom e uvi;s)sexrxo3iy4ap emncsa( sDtmxrpno4optnmicildlm ua(ms;u)tlxnmo oytom elivsls0sexr(opoo1oltn nvil( arua( pnt4aetomo3ildlm2ean s u0tlxnmfctatfat luvsl(0texr(mpiu4lmeemfvsls  2rrurpoo4tpeniociysfm ua(ms;t4tlxrmrcoydom eaieilt)t2xmxm3iudlmt mivtat  rtmum ;u0alx ioeilt a2uau pnt)tetnxf iytlpteanvs s  rtoiopoo1lme mfcias)aDrmxrpnu1oexniieiytfs em(mp u4aetomf ty1lpD  u o s  rtmir ny1amtnlfcsat)s2ra(mp;u1teenmfcilslm2eanmo (4aeeoif3iadfaD luvolt trto(m3nu4om   fci tfs2rmx ono1apxn octys m umu p t)aexoif iodoa eaivsls0 rur(r3io4lltnlicta( aruau pnt4alx if3iydfsDeluvs u)texoio3to1lpD li s s0trtoxr3oy4lpee ivsas  ruaxrp;o0oetnifetyslm ranmo (0 renmf3ty1fpt lneils0trxrxr ou1llt  fetltfsrur(ro;o0olx  f3ilsfsDra(vpnt)altrirctatomDeluvs;s) eumimpiydal nmfcsl(fa2ua(m nt1opxnmi3ild s uluvo;(4aexnmr3ty1late u s;t  2to(o nu1ole miviatf rrmu  nt0ope io3iadfs ul( s;t)treomf3oydfaDr ivs;() rxmxm oo1lmeemivil()sDurxrpnu4tlto ociasfa2ra(vsn()alenio iy1fm rli ols)tetmxr iy1ap nmfcs ()a2trxr nt0tpxomi3ild m ra( onu)altrmf3oadomDrliei;t)tetoio ou1apeeliesls) Drmum ou1ope mietatlm rmnvon()aleoio iadoat livi ()trxoxrpnudam nliei (  rumxront1oexomo3iltfa emn s;t0aleomr to1fm e ueo;( t2uoxr3iydol emnvil(fartrxr ;t4oeeomi3tysfs2em( s;u4 rtomfcio1lm eli slt0srxmxm3nu4omeeliei ()arrax pou4olt  o3iytlsDranvpnu) rtrmrcoytopt aieo;(  rxrxr oo1lptnlieslt a2tm(r ot4aeen ociyslm em(mo;t0aleoif iodopte uvol( tetrxm nu4ale  iviltf 2rau pou1tpt mietltls2umnvs;t4artoxociy1opte u o t) rxmio iodomenmici t  2taurooo1ale iiciysls rauvo;()artnxocoodfptr n i;s trxoxmpiy1lm nlieiasf Dtmur nu4oex  iciad a2rl( p;t)tetnxf3tadlp  anvolt0srtm(m3oy1am  lfesasf Drr(ronu0tpxnmf3tytfm uanms t0alenif oadoatraueo t  etoirpio4alen fct (  rumur ;u0aet ioctytls umnvs;(4trtnxr oydlaDr iesls  eto(o3oy1ale mivils)srtr(r ;u4apxn fctasls2uln sn()arenxo3tytlm r neol()srumiopnu1opt lnvslt s2taum ot0aeenmfeiydlsDel(vp (4tleomo3oodfpDe nes s0seumxopiy1lpen fetls)s2tm( pnu1olenmo3tys a2rluvs t0aeeomr3iatopDrli ols) rtoxopno4op   fet s) rurxr ot0apxnmieiatfaDelnvonu4 etnirctytopDrlu s t trtm(rpnodop   nesl( aDurumpnt1aeeoif3iat m2rmump t0aexoif ia1fa rlnvs;( s2tmxrpiy4aptn iesasf rtm(m nu4apeniiciyslmDelnvs;t4arxnir tydlatean i s0t2tr(opnu4apt  ncil(  2taurpnu4olx if3tasfaDea(vs;u0tltrxr iydlmte neo (0srtoir3nydalte nci sf Dra(mpoo0ope mociat s2rau o u4tlxrxf iadlmt  u ols)tetrimpnudop nmfvt s  rtrxrpnu1tlen ieiyt a ul( o u4 exoxo3to1lateaivs t  eurim3nydomte icia(fsDurur nu4tltn f3tysfaDemnms;t0alxomrctodlpDrai ols s2tmimpiu1op n fet sfaDurx oot4aetomi3ilt a2ranvp;t0tlerio3tydfpD  u i t)t2tm(m3oo4olenlivslt)srurxmoou0aeen ieild m2emumsnt)trtoif oodomtr i i t)teurir ny4op   fvsat srta(mpnt1altnmietytfm rl(mp;t0 renmocoytlaDr nvilt)t2xoxrpou4lltnmfes (f Drauro;u1apx  o3iltlm2eau o (4tltrmfctatom   n ols0texrxm3iydlp nmics s  rua( pnu0aeeo i3iyslm uan s t4artrmociodoa e uvs s0t2xrxm oo1ol nmnvt s)arraumoot0opeoii3iytlm eluvsnu4 ltnxocoa1fm eau sls)s2xmxo3no4omeemivsat  rtmx oou0tlxnmfciltfmDrluvs t4 reomo iytfmte u ilt s2tr(mpio1ameemfct ()aDururp;t1oeto fciysfsDrm( onu4 rerio3ia1laDranvils) exr(o3oo4lm   neil(fsrurx poo0oeen fctytfm2ran snt)alxrxr3iydlp eanei;t s2urxopiodlp e ietl(fa2urx ooo4tpx mi3tad m ulnmont)texnio oytlpteluvi t)srtoxm3oo4amt  ivtlt)aDrmum ;o0opxoifctysla elu o u)tetoxr oodom r ivol()srur(r3io4om n nctlt) 2tmx pno0olxnio3iltla2umn pn(0tlxoxocia1oate nvsls)s2xoim3nu4lpeemnctlsf Drrx p;o1apenioctlsfsDrm( o (0aexomr3oodopD an ils) exrirpou4llt mnvilt)sDtrxrpoo1aexomf3ils a2ran sn(4 eenxrcoodlate ivo;s0setmimpou1lltn fvs s) 2umumono1aee io3iadlmDeluvo u4tltnxr3oatlptrln ilt) 2xoio3ny1optn iciat) 2uaum ;t4tlenifeiltfs el( pnt4arxrmr3oodopte i i (0s2urirpiodom nmfvsa()srur(rp;u0altn i3iatls2rmums (0 eenircoatfp rluvsls0 2tmxopnodal  lfvils) rta( ono1tpeoiocilslm el(vo t) rxnmf oo1oaDelnvo;s  2toir nu1lltnmfes tfarrmxro;o0tlen icilsla rlums;u0 reoxo iodom eau ols0seum(r iodlm elnvilt)artmuro;t1tptnifetytfmDrlumsn(0tlenxo oo1omteli o;t) eurio3nu1lmen fvia( sDumxmo;t1olxnmociatfsDeau s (4aeeoxfcia1lat li il( trtrio3iu1olt lies t) Drrxronu4ale if3ils a2el(vpnu0arxoioctytfp e ivs ()sruoir3oy1om nmnvias a2rr(  ;o0oltnmoetyt m2el(mo (4areoir oytlm eln sl(0setr(r ou1llenmnvsas arumumpno4oex  feiad s2rln s ()tlxrifciadoate n s ()sexo(rpnydlle  ivia(fartaur nu0alt  o3iadls emu sn(0treomrcty1lmtr u ol( teur(m iu4llte iesat srraump;u1olt ifetlsfsDel(vs t4altrio tytlpt anvslt  etoxrpiu4ale mfctltfsDtmxmpno1oex iociad a rm( on(0aleomr oa1latr ivo s0 eur(rpiudol e ncs (  rtrumpno4tltnio3iysfa2uauvp u)tleoxoctatfm  auvols  rto(mpoy4alee feilt srtrxr nt4oleomo3iatlm ul( p u0aetrxf oatla r neslt srum(mpiu1ol emnvi t)aDtax o;o0oetomfeiad a ran p t)aexoirciatlmtr n o;t  exmim ny4lpenmieslt)aDrmurono0tlxn fctyd m elnvont0trxrmo oydoaD lnvi (  rtoxm3nodale mivtls)a2ur(m ot0aptnmietasfa ea( p;u0trxoirctotop rlu s s tetr(opoo4llenlfcs s  Drrxr ot1oleoiietld a raumont0tleoxr3iodomt livsl(0trxrxr3oy1ole lics s  Duru  ;t4alxnmoeilsla2rauvonu0tltnmf3oydop rlieil( t2umxr3oodam  mivs s)aDtmu  nt1oetoifeildfm2uauvs;(0tlxrio iotfpDraivol(  2to(r io1al nlnvi (fs2uaxmo;u0ape  octysfm rm(vpn(0texoxf3oo1om r ueilt0srtr(rpiu4lp  lnciat) Dra( p;t1aetnif3tydfs rmuvpnt4aexoio3oodlateln i s)srurir oy1ap emncsat) Dra(mo;t4tpto ociyt a2eanmo;(4 exnmo ta1fmD  ues (  eurxopiu4omtnlfvils aDtau pnt1tpxnio3iltfa2ulnvo (0 leoxr3oy1opDeluvo;s  ruoir3nodol emnei ( sDtrurpoo1apxn ietlsla2umums;t4 ltoxr3ta1lpDr uei;s0sexr(o3oo1oleelfeias)s2tmu  nu0alxn ieiytfm2rmn s;(4arxnxocta1fp   n ilt)srum(r3oydap  lfci sfa2trxrooo4tet mfeiytla2emnvo;t0 exoif oydfatrauvol()sexmxopio4olte fvtat)aDta(mo;o4aptnio3tadfmDuaumsnt4 etoxf3iadoa  li o ()setoimpoo4amtnmfetl(f rraxm nt1aeeomieiydfa rmuvs;(0 rtnifciodfat lu o;(0 2xo(o iodalen fci s srumu  nt4tpt mo3tldfm2rm(vs;u)tlxomrciotfaDraivi;s)setm(opoudal  mneia( a2tr(rp;u4texo f3tldlsDrmnmo u4 lenif tytlp eai s () rur(r3oodom  livsa( a2ur(ro;t1aetnmoctat a2rmnmp (0 rxnxf3ta1lpDeluvols)t2xmim3oo4ll emicsa( aDurx  oo0tlt ioetlsfmDuln onu)aexnmr ty1fpte ues () exrirpoy1lp  mnvta(fsrtau onu1tetoioctltls2ea(mp;t0alxrxrciytlmDeai i ( trtr(rpoo4apee fctl( arurxm ot0tetoio3tlt m ul(mp (4aexnmfciydfa eauvo t0trtrxr iudal nlfvsl( sDtmxm ;u0tle mo3iydlm rauvp;u4tleoif3tadlp  aivo;(0t2toxr3nu4llee iei t arua( ono0apt mfciytfaDuln onu4 ltoir3ia1laDraueo;( sexo(r3ou4omeelivt (fa2ua(rono1alenmiciatlm2eanms;(0trtnmr3ootopD  i olt) rtr(m ny1olt  ncsat  rtru pnu1tlxomociys mDel(mo u) eeomo io1laDeaueo (0 etmxrpoudlltn iesat s2ua(rp;u4oet  f3iys aDran p u0teenxf3iytfmD lueo t)seumxo3nudal e icsat)a2umxmpou4tle ioeiat m ulump (0tltnxo3oatom  auvo s) rurxmpny4lptelieias)artru  no1oexomoctls mDea(ms u4alenmr iodom e uvo s) rtoxr3no4lp  mfei (f 2tru ont0texnmoctat aDel(vsnt4 ltnxo oadfaDelneo s0s2trxr oy1lp  mieiatfsDra(rp;o4opt ii3ild m2rm(vo (0tlxnif iadlat ln olt0 rurxo oo4lp e iet t)srrmxm ;t0apeoioetasfs2rlumon() reoxfcootfmDe ieols0 eumir3oudomen fvs ()artru  ou4tle moetydls rmumo (4tlxoxf3iytlaDe u ils)sexr(rpoy1om e ivt s  Drru  nu4aptnmf3tys s el(ms u0 lenio3iadfat ln olt0srxrxm no4ale mietlt)a2trx pnt4aptnif3ilt a2em(vo;(4arxoifcoatlm rlues;( sexoim oy1lp nlncia(  rtmumpnt1oetomfctad mDulump ()areomr ia1fp   uvilt0 rxmir3no4apenmictat)aDua(mont0tltn oetldfm2umn p;t) etrir3ia1op  lu o t)seuoxopiy1lmeelivt s) rtau  nu0tpeoioeias mDum(mont)aeenmrcoadla r nvils)s2tr(opou1al e fesl(  2um(r nt0tpe  o3iytls ea(vp t)artnxocootla   ueslt)s2to(mpiydam elncsa(farrau ooo0aee  i3iys sDeluvs;t0 ltnxf tytoaD livs;(0 etm(o3oydlm   nvi () ruaurooo4olxomoctydfm ra(vp (4aetoir3ta1fm  aies;( texm(m3oydlpe liesa()srtm(m ;o0tex ioeilt a2el(vs;t)teeoircta1faD aueolt tetoxmpio4llee ivi () rtmxmooo1tpxn i3iad m2emump t0aexnmr3tatomte ueo;t0t2tm(m io1apeelivt () 2uaxmoot0tetnmfeiadlsDrl(von(0trxomfcoa1lmtr u ils)srum(r nu4ole lnvilsfs2rrxm ot4apx mi3iaslmDul( s;u4 exriocta1lmtranvi;(0truoxo nodlp nmietas  ruaxr ;o4opx micildfm2rau pn()texoifcoy1lpt  nei t0sexmim3nu1ap n fvi t arrm(r nt4oex  i3tadfs elnms;t0artomociadfp r uvs;s  2umxmpiudlmtemicil() Dra( p;u4optnmfcils aDraumonu4aexnxf oytfaD  nes t0trxrimpiudlpeemnesl(  rtrum ;u1olx iieils sDranvon(4artnmoctytfa  ln o s)s2trxo iodaltemfeiasfs2rm(mono4texn ietad m umuvo t4tltrxf ia1fatrauvi;s  euoxm oudll nmiet tfaDrmump;o4oleomi3iad sDrm(mp u)teermociotopDeaivs;s  2xrxm3oo4ap  mnetlt)artrxm nt0ape iieild mDul(msnu)teenmfciotom  lnvo;t0srtrxm3nu1apenmnctat) rrmuro;o4oeenmociyd mDrm(vp;(4 rtnmoctydfmD  ies;( srtrxr ou4oltnlncs t)aDumxmonu1opeomo3iytlaDuan ont0trxnmr3todlmD luvo;t)srtm(mpny4opt mfct tfsrtaxroot4apt mi3tytlm2uauvo u0trtnxo to1oa r u o;t) exo(opou1lmtelnvi t) Drau oot0openioctas a ulu o;u4 rtnxocty1lpDr ivi t  euoirpio4opt  fei s sruaur ou4aex mietltla elu s (4trxoioctotlaD  u ol() rtrxrpoydlmtemictls)aDur(m no1tpx mfctltfa2rlnmp (4 eeoio iy1fatrluvi t  rtoiopiudapen nvils)aDtru ont4oleomietltlaDuauvo;t0 eeoxf oo1fmt  uvi t0teurxm3io1omt  icsat  2urxmpnu1apxnif3iad m emu s;u) rtrmo tatlmtrluvs s  rxoiopnu4llt  nvtas s2tax p;o0aexnmi3iyd s rmump;(4arxrxo ty1laD  n sl()sexmim3oydlm   fvs tfaDuaxmp;o1tltoiieilsfa ua( s (0altoifctatlpt ai o;() 2xoxopoudlltelici tf 2uax  ;u4openmieiysls ean ont0arerifciatoate neslt) 2tmimpou1omt  nvsat) Dua( o;o1opxomi3tad s rlnvp;t4 etrmr3iadfp  anei () rtmir3oy4lle mneiat)a2taxroot4apenif3iatla2ulu s (0trenmoctytlatrlies t0 rxoir3oodlp   ivi ()a2um(mo;u0oleo ieiyd s umums u4tlxrmoctytfp eaueo t0truo(m nodalte net (f 2rmumpoo4tpt mfcildlaDemums;u4 etnxo tadfp r uvsl() exmio oydap  lnvta(fsrrm(rooo1tlt  ictyt mDul( p;t4tltomo3ta1faD  u il()teuriopoydomeelnei ()sDtmx  ot1ale mi3tltlsDranmp () lxnir ootlat aivol() exrxr3io4op nlfciat) Durx  oo4tpe mociadfm2ranvo;t4trxnmfcoadoaDrluvolt  2to(m oudameeliciltf Dta(mooo4tlenifcils aDul(vp t0aexoir3iadlm eaueolt0tetrio ou1lm   nvtat aDrmxro;t1opto o3iadlaDemumsnu0 ltoirctydomD anvils0s2uoim3iy1lmtemivslt sDrm(moou4tle mfciatla2ra(mpnu)aexoxo3iydfp elnvs ()sexo(r3oo4ap  mnvi sf Draumpnt4opxniieiaslm2raums;t)aeenif oodfatrai s s)s2xoxmpio4ol n ncia(  2rmxrp;o1opx mfeilslm2ua( s;t0texnir3todfaDe i o;(  rtr(r iy4lm n ieia(  Dumxmoou0oee iociltfa eau ont0trenmf3tadlpDe nesl()setoiopoodlpt lfvilt aruau  oo1aleo i3ildlm ul(vs (0tetoir3oatom rlieo (0 exoir nu4open fvi tfartm(rono0oltn ictydlsDuluvsn(0arxrir tydfa elu sl()trxoxm nydom n fvi s)artm( pnt1ale mieiasls2rm( ont4teerio to1fm eaivo;()tetm(r ou4openlnvt sf 2tau ooo0oetn ieiat a elums;()texomo oy1op e ivsls0 2umir3nu4amtelnci sfsDtmx ono4oexo ociltla2rau pnu0trxrmf3tydlp  auesl()t2umir3no1ol n ieilt)artrxmpnu1tee mi3iad a2ra(vs t4aeenxr oodfmD au o s) 2tmio nydolenmfesa() rtaum oo1ole  i3ildlm ul(mont0texrmo3iatla rauei;t0sexrxrpio4alee ics s arururpou4tpto i3iytfa2ulump;u) rxrmf3tytopDr neolt seuoxo3ou4lmenlfetl(  rumu onu4olxomieiltfa2el( o u4trxrmoctatlmDr uvi s0setm(opiy1llte fvtltfsrraurpou1apenmi3tydlm ul(vo;t4artnxf oy1lateaueo;s  exmim3oy4opt lfvsat  Drrur oo1oltnmi3iytlm um( pn(0treomr3iatfaDelnvo ( t2um(m iydolt lnvtat aDuaxr nt4alt ii3iltfa2eanmp;(0tleoiocoo1faDe nei t  euoxr ou4omtemivsls) Draxrpno0apx  oetyslaDemu snu)tetnir totfp  lnes t0s2uoxo nudamenlieslsf Dta(r ;u1tle iociltfs2rln o t)tlxoxrciy1fpt  nes t0truriopiodopenmies tfarra(r no4optomfeiadlsDulnvs;t) lxnifcoydfptraivi;t) eumxm nydapt  netatfa2uaur ;t4alxnmieiatla2ul( ont0 eerirciadlp elues;(  rxr(mpny1om nmfvs sfartaxrooo1opeoiieildlaDrau ont)tetoxo io1fpDeli o;t0trumio3iydlmen fvs ()a2raxmpoo0oex  fetldla el( pnt) rxnio3iatoa raivi (  2xmiopny4omtelfei (  2rr(r ot4aet  ictlsfs2rln pn()alxrmfctytlaDeluei s0truoxr iu4openlncilt)aDra(ront0oet if3tytlaDranvo ()tlxnmf3iy1om rauvs ( tetoimpoy1ope  fcs ()artr(ro;u0tlen oeils sDrm( ont0texnxociotfmD anei (  rxoxo3oodaptemicsa()aDur(  ;o4altnifeiasfaDrl( s (0teenxrctodoa rlnesls  etoiopiu4lp nlfes t sDua( onu0oetomi3iad s elnvo t0teeoif tydoa  au s t0tetmxopio4am nlfeiasfsrtax  ou4tle  ieiatfm ranvo t4tltoirctatlpDrlivols0 ruo(opiodlm  lies s)sDra(moot0tltomo3iatlsDuauvo;(0 etnif3iytlmteaiesls s2um(r3no4lpt liesa(f 2urx  oo4tleo i3ildfa elnvo u4texrmr3oodlmD  ivsl(  exmxo iu4lpen icia(fa2tmxmooo1teeniicilsfs2elnvon(4altrmf3totfp r u slt srur(m3nu1oltnliet s)aDur( ono1apeoifciyslsDelums;(4tlenmr oo1op rlu i t  ruo(r ou4amtn fvtas)s2umxrpnt1tptoiieiltfa2ea(vonu0texrmr3oy1fa elieo () 2trxr3oydopee nvsl(  2ua(rooo0tex iietlsfsDua(mo u4treomfcia1oa eauvol( t2uo(m iu1lmtn icsa(f rtrx pou0optn feilsfs2eau ont0 eerioctytfatrluvs t) rumxr iudoltnlfvt s  Dtmxr ;u0aee  oeildfsDrluvp t0 rxrmf oy1opDe uvols0 2tm(r3iy4am nmfvtas  rua( pou4altnif3ilslm2uaumo;u) eeoxfcootfat  uvols)sruoxmpny4omtnmncsasfs2raxmp;o4altomicilslmDean on() lxnifctodoaD  nvo t0s2xo(opiu4openmncia()s2tmumo;u1aeen i3ildfm2um(vp t)trtrmo iy1la e ivol(0s2xoxm3nudalt  fvs sfarumx o;u0opx  oetls m um(ms;t)trtomo3tadlmt auvslt t2
\ No newline at end of file
@@ -0,0 +1 @@
+u o s  rur(opiodolt miesl(f rrrx  nu0apt  i3iytla2umuvsnt0aeeoif totopDeai o s0texr(opiydlpteliciat)aDtmur ;o4tex  feiatla ua(vpnu0 renmrcoytfmtr nes;t0trtoxmpoo4amen ncias srum( pnu4alx mfciysfs rlu s u0 rxoxrcoo1fmtr nvols)teurimpno4apenlnvia()sDurur no0tlx moetld m ulums;t) rtrxr3iy1optrlnvi;()srto(mpoydomtemfctlt) 2rru oot4tpxomocildfa elnms;(4artrxrcoy1fpt aiei;t  eurxm3nudlle  nvtlt) rtaxrooo4optomi3iydfaDean p (0artoxo iotopt anvo t seurxo oydlmtelicil(f 2tmump;u0oetnifeiydlaDelu pnu4arenxo3todlaDe neolt s2umio no1optn fvsasfa2rmu ono4aee io3tydfsDemu s;u)tetomo3iy1oaD  ivi;s sexr(r ny1omt lnviltfsDtauronu4alxnio3ilsfaDra( p u) lxnmocia1opt aiesls)tetm(m3oy1lpenliei ()aDtaxmono1tleoiociytla em(vpnt)tlxoio3tatlaDraues s0 exmir3oy4lme  neil(fa2taur nt4apt mfetasls2elnmo;u)artnxo3iodlpt auei;t)trxmxr oy4ll  livs t)s2ta(rooo4oetomietatlsDel(mpnu4 ltnmf ta1fat lu i s0sexoxm io1oltemivil()arumx  ou1teen o3tatls ea(mo;t4alermo totfmDelu s (0t2xoxo nodop  liet ( a2uaur ;u0oet mi3tls m uau onu)tlxnmfcoa1fp   nei (0texoio3iudol nmncils srrrx  ;t1tleomocild sDelnmo;u) exnxo3oatfa r uvs (  rto(m no4ll  lnesasf Durxmpno4tlxn ociltfa2ran o;u)arermrcoo1fmtrlivs;s0tetoim oy1olenmfci t)s2rmuro;t1ale ifciysfsDumnvs;u0altnioctytoaD aies s  2xo(m3nudapt  iet s) Dtrx  ;o1tleomicildfm umu s;u) leomr iytfmtr i olt sexoio io1lpenlnctlt s2ta(ro;u4aeen f3ilt a2rmuvp u) rtrif3oydfpt li o;t t2xrxo oudapte nvs s  Drr(ro;o1oeto oeiadfmDuan on()tlenirciotfmt aueo t)seuo(o3oudolte fci t aDurumpno0opt moeiytls2eau s t4aexnmr3iadfa r nvsls sexr(r iu4lltemnctl(  rum(monu4alx mictlsfm uanmp (0tetomrcty1lp e i sls0teuoxr iydlle mfvsas a2ra(ro;t1tpxnmoeiyt s2uan s t0trtrif3ty1fm ran o (0 ruoirpou4lptnmnvslsf 2raurpnt0altn oeilt s emnvs u4 rxomo3tadlptelivi;()s2umxm no1lmeemivta(farurxm ot4oet iiciasls2ul(mo (0aexnmo3iotopD luvi;t seum(opoydllte nvsls  2tmxm ;o4oeeoiieilt a2emuvsnu)tltnmr ty1lp eaivils  2uriopoydope lfei (f 2umumoot0altoiieild mDemnmpnt) rtnmfcoytfm elu i s)srxrio ny4ap nmfesl(f rtmxm ;o4olto iciydla rmumo;() reoif oadopDean s ( teuo(r3oo4llt mneiatfa2rmx pnt1tpx ifciatfm2rmn p u) exoir ootlp e ivi;t) 2uoirpnu4lpee fet t aDurx o;u1oetomfeiaslm2ra(von(0texnxocio1lmt ln s;()trtm(m nudamtn icsa( sDra(m nu0optnmf3tyd aDrluvpnt)tetnxo3oa1oa eau ols s2toim3ou4opt mnvt ()srrmxm nt0apxniietadls rmump;t0 leoifctydoa eaneo ()teto(m iodalenlfciasf 2uaum ;o0apx  feiasfs ulnvs;()altnxf3iytoa ean o ( t2uoir3ny1op e fcsls) 2tru p;o1tpto oetltls2ul(vsnt0tetoiocoadfpD aneils) exoiopiu1ll emfes ( a2ra(  nu1tltnmf3tyd aDul( p t4tlenioctytlp  aues;s setmxm3no4omtemneta()sDtaxmpot1tetnif3iatfa2umnvo;(0altoifcoy1lpteaivs;(0t2toxo iy1om e fci ()srtrxmp;u1aexoioetadfs rmn snt0teeomr3iotfpt li il( srtmxr oo1ol elictat  Dtauronu1aet  i3iat s eln pnu0 rtoxr iodfa r ivol( truoxrpio1lltemncilsf Dtru pou4olt ifciad a rm(ms;t0trtnmrcoadoptrlnei s0t2toimpiu1apt  ict (fa2umu pnt0ale  feiytla emnvonu) rerxoctydlp eanvsls)t2um(rpou1ome  neiltfs2rax p;u0oltnmoetysfm eaumo;u)trerxociodlp  anvo t s2xo(o3oydole  fesls  rrmur nu1opt  feilsla umums t0texrmo iotlptelu s;t setmim3oodopeelfvtltf Dtr(  ;t0tex mi3taslsDrm(ms;u0artoxrctodlmDrlueo s)s2xo(o iu4amen fetasfsrurx o;t4oex ifeiyd a2rmnvp;u4areoir ootla e nes;s  etmir no1optn fesl( aDrr(mono0tltnmoeiys m2uln on(0alerxocoodlpDrlivs;s)s2xrxrpnudlmt  iei t  Drr( poo4ale ifeild m eanmpnu0 ltnio iytlp eaueo s0sexoxo3no1al e fei t)srrrxm no1aptn octyd aDelu p;u0altrmo totlm  auvsl()t2to(m3oo1ame lnvils) Durx ont4tle io3iytfm2ran snu) etrxfciotoa rauvo;s)s2um(rpiodap  mnvils  2raurp;o0aptnmiciydfm2rl(mp;u0tetnxf3iytfp ran slt  2xmir3ny1lmeelfeilt)aDtm(ro;t4aexomieiydla rmumont4tltrxr3ootlmte nvo;()trtriopny1lm  mnvt tfsDta(mono0tlxniiciysfm2ul(vpnt4 etnxf3ty1lm rln slt srumxo ou4ape  ictl(  Dua(ro;t4tpto i3iatlaDul(von()aeenmr iatoa   i i t0 rtrio3oodol n ieta(  rurumono4olt moetad sDrmn p;t0 rxrifciydopDr neo t0 2urxr3iu4ale mivias)s2tmx pou0tpxoifetatlaDrmnvp (0trxoirctytfm ean ilt) rur(opiudapte fvta() rtmump;t0tptniieiat a em( snu0teenxf3ootoa elneols trxmxmpoy4apenmicta(fs2rmx  nt0tpxn i3iyt a2eauvs;u0trermo3iatfmDran s s)srxoxo3ny1optnmfetatfsDuaur nu1tlto oetadlaDrmnvsnt)trxomf3to1opDrauvs t) rtr(m3oo4lltemics t)srtmxr ;o1tpxomfciyslsDemnvpn()tetrxfcia1la elieo t) rtmxm3nydopte ies t)aDrm(  ou0apeomi3ild sDrmn s;u)alerxo oy1oa r uei;t0 exrio oo1altemfvslt  2umxmpnu0tltnif3ild aDra(msn() eeoxo ia1omD lueslt0trto(mpoodlp nliet t s2rau  nt1apeoifetlsfs2umu sn(0 eerifcoo1oa rln s;t  2trxm3oo4lp   fvi () 2rm(  ;t4tet  icild m rl( s u) eermr3oy1lp   ieol(0trurim3iu4ll e netl(fsDum( pnu4tee iictldlm rln s (0areoif3tydlp rlnvi;( seumxmpou4ol nlies ()aruau  ;t4opxoif3tltfa rmu s;u0tetnxf3tatfmD  ivo () rxrirpiy4opt  fciatfartax  ;o0opxnii3tltfmDelnmp u0arxrxr3iodfaDrln i;(  eumir3oy4altnlies (  2rr( ont0aex ii3tlslm2ran p u0 lxnifcto1laDrauesls) 2xmimpoy1ol n ictl(fsDta(m nu1tee mi3iys sDra( s u0tetnio3ta1lmD aivs;() rur(r oo4altemncilt) 2rmumo;o1tpxnifcildlmDua( onu0alerif oadoaDelu i;s) 2tm(m3iu1lptnliesatfa2ta(mo;t4tlxomo3iasla rln pnu) leoio3io1fat lieo;()sruoxr nu4apeelncs (fsDtmurpnt1aetnmi3tltfs emn o;t0tltrmo ta1fpte nvo;t  etm(o oo4lmtnmnviltfa2rrumpoo4tpxnioeiytfa eln o u0tlenifcoytoateaiei;t  2uoxrpoy4al  mnctasfsDrax pnt4alx iocildfa ulnvs;t)teerir3iy1fpDe ivilt)s2toxr3io1llt  neil(  2umu pou4apx moetls m2uaumpnt0 etnir3tadop rluvo s0setr(opny1lp emfvslsfsDrmum ou4oleoiociytls2um(vo;t4altnio iotlpt aieils0srxrxm oy1lm nlfct sf Dum(monu0tpeomfeiat a emumpn() ltomf3oy1fpDr nvolt t2to(r iy1llt lfeta(farrmu p;o1opeo oeiltfs2rlnms;t) etoxocto1fp r ieils) exoir3oy1apt livt t a2ra(root4openmoeils a ul(vs;u) renxf ta1op ean i;()s2xr(o ny1ole lfci sfaDrm(rpou0tpxoifciysla rluvp;(0tetnxf3tadfa   ueo t texm(mpnu1op  lncslsfaDur(moot1aptoifctyd a2rluvp;t4areoxr to1opD  nes s0s2ur(rpno1opt mfeta( s2rm(mo;o0oet mf3iasfs uau p (4texoxo oy1op rlnvs t0 2xmxr io1ome  nvtltfa2taxr ;o1olx  iciasfa eln s t0tlerioctatopDe uei s0setmim nydlmen ietlsfsDuax o;u0tlx mociltls uln pn()aetnxo to1lpte uvi;t s2xoxo oy1lpt liesa( s2trxronu0olxoiicilsfm2um( snt0 eerxocta1opDran s s0tetmxo3oudlltn fcslsf 2rr(m nt4aet iociysfa uanvo;u)trxrif3tytfmDeaues s)s2tmxopio1om e iviltf rtau o;u4teeo ociatla rau pnt)aetoif3iytopDe u i ()seum(opnudame mncs ( srtmur ;t0tlt  o3iasfa2rlnvo;t0trenio3tadlaDraueo ( s2toirpoudlp  lfvia()a2ur( poo1opt moeiytfa2ul(mp;u) rxrxociy1lmD luvol( srxmimpiu1op nlnetat)srrrum nu4texomiciydfa2em( s t0tetrio oydfmt luvs;s0trtr(r iodlptemiesas srta(m oo0tee ioeiytlm eln ont4 lxnirciadfa eanvs;(0t2xo(o3oydopenmfesl( sDrm(  nu4teen oeiyt a2uau o;t) etnif ootomt ln i t tetmiopio4opeelfeil(  Dra(r nt1tet  ietld s rlnmsnt4altoxf oydomDr nvi s0s2xmxr3nudlp nmfet tfaDururonu0apt moeild aDrl(vs t)tetrmf iotoa e nvsl(  euoimpio1llt lfctltf Duru p;u1tpt mi3ilt s uluvp t4 rtnir oy1lmDe ivo (0tetmxm3ou1altn nvs () rtau pot4ape io3tat sDel(vs t0arxoif3totfa r n olt  exmir nydale  fvtas aDraumo;t1aee iieiydfmDelumpnu)tetnxf3ootopDelu sls)t2uoxo3oudope mnes s  2tm( poo4aex if3iydfm2ean s;t0tlenif oo1om e ivo;(0s2um(rpiydam emnci (f 2um(  ;u0oetn i3iatla2elnms;u4tlxoifcoa1optelivs;t0 2xrxmpiy1aptnlfvi s a2urur ou1open o3tltls2eaumpnt0 lermfciytlmt  ues;s seuo(o io1omtn fes t s2umx  ot1oex mfciyd a eauvpn(4alenir3tytfpDeanesls0trum(opiy4amtnmncslt)sDtrxr ;o4tptomf3ias aDum( s;u4artrir3oadom e ieils0t2uoim io1ll nlfvsa() 2uru p;o0apx mociys s um( o;t0 exoxrcia1oaDe ivs;(  2toxrpio1lle lnvi (  Dra(mpnt1texnif3tadfaDran s (4altrxf3totop r ieol(  rxoxm oy1am  mfcilt) 2rmum ou4tle mi3iad a el(mo u)tetnmf tadfpDean s;(0s2xo(o3nu4op nmfcia(fs2taxr no1oetoifctyslm2el(mp t0 etoxf ia1oaD  iei s teuo(m3iu4ape  fei sf 2tr(  ot1tpe  ociatfs2ulumpnt0altnif3ootlpD livo;() 2tmxm oy1omtemnvilsfsDumxmp;u0aex ifeiaslsDrauvo u0 rxomfcootfpDr i i;s0 2tmxo3io1lle micia( a2ua( oou0tltn fetatfs2uln o t)arxnioctodlat  ivo;t)srtr(r3oo4lpeemivt (f 2taxmpnu0olxomfciasls rl(vo;t) lxomf3iatfa elieolt0t2trxr3oy1am emicia( s2urur oo4aptniociydfmDulumpnu4trtoifcoo1lm r nvs (0trxoxo3nudol   ivs (f Durur no4teeo ietat a rln s t4 lermocoytlp raieilt  rumio3oodaptemfvtltf Drax pou1openmictldfs ra( p;t4 lxoxo3iydoat  n o t0seuoim3iu1lmtnlnvtat  2uru o;o0tlx moetltlaDraumo;u0trxnxfciadfmDr ies s) 2tmxm ny4al elfeilt aDtrx  oo0tlxnmi3tasfa2um( p;(4tleoxf oydop eaivi s0teuo(opoydlp elfesls) Dtru o;t1optomfeiatfsDelnvo u0tltnxf3iodfpD aieo;s t2urim3oy1alt miei t)aDraxm ;t4olt  o3ildlsDumu o;u)artomo3oa1fmDeaneol(  rurxrpiy4aptelncsl()sDuaxmp;t1alx  fctltfsDrl(ms;u)tetomociadlmDrlnvil( s2urir ou4lpenlfci t a2tmu  nt0oetomfeiys m rauvp t0 etrmfciotlm  auvi;s) rxmxm iy4al e nvta( s2rru p;t0ope mfeiytls ran pnt) etrxr oo1omDrli ils0trtr(r ou4aleemfcs tf Dtmum no0alx  octldfm2emu o () lxomo ty1laDeauei;t)t2tr(o nydop   iesa(f rtr(mono1apxnioetltfm uanmp t0tetnifciatfa eluvi t0 2uoxm nu1opte nctls) Drrxmp;t4aexoiocias aDuan o;(0 lenxocty1fatr uvsl( srtoiopiydaptn icta(fa2rmurpou4apxoif3iltlm2ea( s;t0tlxnirctodfmD  nvs;t)srxmxmpiy1oleemivtat) 2trx oou0olt ioeiydfmDem( s;()texoxf tatoatrlnvil(  eto(r3ou4lpt lieils)artr(rp;u1aeeomoetatlaDrmums;()tltrircoatfateaneo;t0srtrxm ou1op  lfvtas)aDum(  ;t1tlt miciydla rau s u0aexomo3ia1omDeaies s t2tmio ou1llenlfvtatfsDraum nu0tlxo octydfm emn pnt)trtoxo3iytoa r u o s s2uoxo iudlptn ivslsfs2tr( pnu0opto i3iadlaDuln pnu)artnmociodfa raiei;t)tetoxo no4omte icta(fsrur(m oo4tleomf3ils m rl(vo;t4 leoxrctytfm elivo (0 2trxrpno4ol elfeiat  2rrx ono1tpx  fcils m2ranms t) renxo3oadom  an s t0s2um(m ny1lpt mnvt t  2taumo;t4oexnmf3iadfm emn snu)arxrmocoa1lp eln i;t texmxr ny4am  lfcsa( a2rmxmono0oexomfcildlm umnvsnt4aleoxr oy1fp   ieslt0s2trir3nu4lpt  net sf 2tmxm no0tptoioeias a2eaumo;u4trenio3oa1opDe ivi t)s2xm(opoy4ope  nesa(fsrua(monu0oeeo ocildfm rmuvp u4 renmo iytlaDe u ol(  rur(rpno1lpeemfeiat)sDtaxrpno1oex ioetadlmDeanmo;u4teeoircoadfp eln s () etr(mpoudllenlicil()s2uaurpno4tetniieildfm uaump;t)arxoxfciotlmt lnvi ( t2xoxo3oodol n icsat  Drau ooo0tlxniiciysfm2eluvp ()trxrxfctadoatr n o t sexr(m3oy1ale lies t aDuru ont0optnmi3ild sDuaump () rxomrciy1laDr nvi;(0 exoxr ny4lm  licsl(f rrmuro;u4texo fciatlmDum(vs t0tlxnif totfaD  i s;(  eumio ny1amt livsatfsDrru ont1apen i3iys sDra(vo;()artomf3iodoptr n i;s)setoio oy4lptemnvta(fsrtmumpou0optomfeiys sDuauvont)altnxr3todoa eaieils0 2um(o3oy1al e ivs ( aDtmurooo0openifciad a2umuvsnt0 rxoxf tadlp  an sls truoxr3nudol nmicia()sDrruroot4opx  oeiytfa2rm( p;(4 lerir3to1oaDraues s0 2um(rpio1ll nlnetl() rrmumpou1teeniietltfa2em( pnt4treomr ta1fmt livils) 2uoxo nu1lmee nvs ( arurxrp;o0alxo fctls m uauvo t4 lxrmr3to1lpD ai olt s2xo(rpny1om nmfviatfaDuaum ot1optn i3iatfs eln snt4trerirciotfp eluvs;t trxm(m3ny1ll  livtl(fs2ra(mpnt0tpxnifciytlm elnmsn() exrio3iadoaDeanei (  2urxopiudal  mici ()aDtr(rp;o4apt  octldls eluvo;u)trtnmo oytom rlivs ()sexo(r3ou4openmfvilt)aDra( o;o1opxo fetytlsDuau o u)aexomr oydlpteluvi (0sruo(m3oudam n iviat)a2tmxmoot0ole  o3iytls ul(vs;()alerir3ta1lmt  ivi t srtmio oy4al   fesa(f 2rmump;u1olt iociydfsDrl( s (4aeerxfciy1lpDeli s s  2urxo iydoptn ici s  Drau oot1tpenio3tytla2rmnvpnu0 rtomf3ia1fmte u o;()s2uoir io4olee neiatfa2rrxr no1olen f3iltfa ul(vonu4tltnmrciodlm  aneol(0t2uoir3oo1llen iesltf 2umx p;t4tlxnifetat a rln p;t) rtnxf oo1oate n i s trtmxr3nu1llt  nvtat srrrx onu4apenii3ildla2ra(vo;t) lerxocootoa  anes;()texrxr io4ape  ivtlt srtaumo;u4tlt  ieilsfsDuanvp u0 rxoxo3ta1fp e n o;t)tetrxr no4ll nmfeias) 2trumpoo0teenmf3iadlm rlumsnu4aleoir oytfm  lu s;(0sexm(r3oo1amtn iet s  Dumurpot4olx  o3tatls emump;(4 exoir3iodom r ies;t0srxr(opoodoptemnvs tf 2tm(m ot1oex  oetaslm2um(vo t4tlxrxr iodoaD aivs;(  exmio oydale lfcias aDur(r ou4apxomfeiytfm2raumo t4trxomo todfm r uei s)t2xmxrpiydlm  liesls)srtrur ou1apx  o3iydla2umnvpnu0teenircio1fatrlu o;(0srxmir3no1op  mncilt)s2trxront1apxoio3tld s2ulnms t0altoxo3oytlmDranes;t  rtrirpno4lptn ietasf rtmxmpnt0apeomfeiyslsDumnvonu)tetoxrctadla rauvi s)texoirpoo4opt mfcsls)sDrauront0openiieiysfsDulums;u0 rxrmr3oadlptrlieols t2trxm ny1amte ivtasfaDumu  ot1tpxnifeilt m eauvonu4 ltnxf totfpteluvils0setrim3ou1alenlfctlsfsDtmxmo;u0apxo iciyt s um( ont) rxoiociadfm e n o t0trtr(o3iydlpeelfvsasfa2rrxrpno4apen f3iasfa2um(vo;u) rtomo oadoa rln o;(0trtmxm3oo4lptemivtl( aDuaxmpot0tltnmieiadfm ul( p t0 rtnmo3totlpDeaneo t0trto(mpnu4op   fvia( sDrax  ou0opxo fetasfmDum(ms;(4altnxoctodlm r i s;t0seumxr3nu1al nlivta()srrmx o;u0tpt iociyslm umn snu)tleoir3to1oatr iei;(0trxo(m oo4omtelivtls)arrmum ;t4alx mieiad aDrmn pn()aexoxf ta1lmD ai ilt)s2tr(m iodomtn nes () Dtr(mono1tptomociatlm2rln s;t)arxnmr tadfaD lu slt t2uoim nodomtnlfvsl(fsrumu o;o1altomoctldls2ulu p;(4aeeoircoy1op  lnvol()trtrxrpiu1am  micslt  2urxmpot0oet  ieiadfs rmn o t4 eerxoctodfateaivo t0t2ur(rpoo1aptnlfcta(f rtaurp;o1oleoioetydls rauvs (0 rxomr io1lptrluvs;s) etoio3nodapen fvilt s2rmu  ;t1tetn ieiltlm rm( p (0 etoio3oy1fm raivs t0 rtriopno1ap   fvta(  2rmu p;o4apxoifciysfsDum(vo ()aetrxf3iytop raivolt0t2xrir iy1ol n fctas)a2trumpnu4tpto ieilslmDum(msn(0 lxnio3to1oaD au sl(0trxm(o iy4ale  ncta( a2trxr nt4aet  o3tydls eaumpn() exoxo3oatfa raieol()t2umim oudlm nlfvt t)aDtm(r ;u0apt ioctldlmDea( s t) rxoio3iydfateli ilt)s2uoir oy4ope mnvil()a2rm(r nt1teeo o3tltlm2ua(mo () exrxf3tydopDeai s;t t2xrxm nudomtelfviatfa2tr( pou4aeeo icildlm2el(monu0aexnir3iadom rlnvil(0 2umxr nu4lleemnvilt)a2taum ;o4olxniiciyt mDrmnms;()arerxo iatopDelu slt)sruoirpny4optemfeia(f 2tr(monu4altn ictls s ea(vpnu0 ltnmfcoadomD aneols) exmxopio4ale lnetl()aDtax  nu4tle mieiys s2elu p (4 etrmo3tytfa rluvo s)s2uo(opoy1lpeelies t a2umumpoo4oexniieiytfa2um(vs (4arxrxo3oatfpDeliei t)trxriopoodol nmieils  Dtr(  ;t0apeoifciys aDemnmo t) rerir3tytlatrlueilt) rxoxm3iy1lmtnmncs (f 2taur ;o1tpxoio3tat s2ean p;() ltrxf oodfm rlivi;()sexrxo iu1ole lfei (fsDrmxm ;t0oex  feilt a2ra(mo;t0trxomo oadopDean s s)t2xo(r3ou1omt  fetltf rtm(mooo4tleo feiydfm em(vs;t)arxrif oa1lp  lieo;t) rurir3iy4aleelici s) rraxmpnu1aet  oeildls2rmn o;u)trxoxo todoa  livslt  2tr(opiy1al elicta(f 2tax  ot1ale if3tldlm2emuvsnt0 rxoxr3tydlpDrln sls)tetr(m3io4al nmfvt ()srraxm ot1apen ictadls2emn pn()arerxr oatoptrln i (0t2urxr3io1om e iet s sDuaump;o4optomo3iltfa rluvp ()aexoxo3oodfpDr ivsls0srtm(rpnudapenmictl() rumxmono4oetoiiciydlm rlnvsnu0alermf3ty1oaDeaiei t)teumirpiy4om e nci t sDtm( pnu0alx mfetat m ranvp (0 exriocoo1omDeaies;t0t2xrxm3iudll elfei s)s2ra(rpot1tee  o3tadfa ra(mo;t0arenir3oo1latrlueils) exm(mpoy1op e nci () rrmu p;u0ale  i3iltls2eau ont0trxnir3ia1opDrai i;t srxmxopio1lltnmfcil(fsruau pnu0tet ioetls a2rauvp;t0alxomf tadfm  ai il(  etm(r3iudlme  fct () rta( p;o4ope ifeiytlm ran p;t4alxoif iodlat  ueo;s)srur(o3iy4am emfctlt)srtaxro;u1oetnmfetysla2rmu o t4alerio oydlmDelnes (0sexrxm3io4opt mnei (fsrtr(m ot4tlen ocilslmDrl(monu4tltomf ta1oatelu sls)setmxr3nu1olen nct s  rraxrp;u0aleoif3iatls2umnvs;u0aleomfcoa1lm rli i t) rxo(o3no4lp e fcsasf Drru  oo4alxnmoeiydfs2rl(vsn(0 reoir oa1fmt  nes;()teuoxm3oy4oleelivi t)s2um(ro;t1aexnioetadlmDuan o;t)altoio3ty1fmDe u s s0 eumxr ny1ll nlivsl()sDra( pnu0aetoifetydlm rauvp u)teerio iodop  livo (  exoir3nudom e ietl() 2umurpnt4opto oetldfm2ra( pnt)areoxrciatlm r nes;t0 exoim3no1amte neils)arraxr ot4oeeo oeiltls ranmsnu0 rtnmfcty1oate nvi ( t2trir oo4llt  nvs s  Drm( p;o4oexnmfcildfa2em(mo;u4treomrcoa1op r n s (0 exoim oudop   fvt tf Dur(rpnt0apxnifeiytls2umn snu0teerxr tatoa e n ilt0 exm(r ou4al n ivias  2taxmp;o0tlenifeildla2elnvo;(0alxnircoydlm e ueol(0trxrxr3ou1opte icilt aDrmxroot4tltomfeiytls rl(vp t4 lerif ootfmtelueo;t)srxm(m3iy1altelicia( a2trumpnu0altoio3ilsfs2ul(mp u4trtrxf3ta1fm  auvslt)sexr(opno4ol nlnetl()s2tmxmpoo0tptnmfetltfmDulu pn(0alxoif tytlpD an sls teumxm3iy1olt  ncsas)s2tmxr oo1optn octasfm2rl( o u4trxoio3iytfm r i i;s  2xoimpnu4am emnvs s) rtrx pnu4altnmfcilsfa2rm( on(0artnmr oy1fmt  nei;t0 rurxr3iu1ol nlnctat)srtaxm no4tlx  ociadls el( o;t)trtomf to1faDrli ilt0trxmxm no1aptemfvt sfartmxroou1oee  o3iatfa2eanvo;u4texoxfciodlmtelues s0 rtr(r3nudlpt lnesatfa2raum nt4oltnio3iasls2rm(ms t4tlxnir oo1om rlies s truoxopoo1ameelnviat)a2tmx  ou4teeoifctysfsDua( p t4trtniocty1fateli slt) 2toxmpou4aptelivilt) Dta(mont4tlxn fctasfs2rmums u0arxrio oytomt an o;s0texm(opoy1omenlfcsa()sDtrx poo0tetoif3iltls eluvpn(0alerif3oy1lat  uesl(0t2xr(rpno4aptnlfesl( a2trxronu4tle iietadfm rlums;u0alxrifcoytfp e ivi;s)s2xmxm3iydomt lnvsls) 2rm(mp;t1oleoiieiltls uluvs;u)alenmr tadom rln o;t)trtm(opiu4lptelfvsl()sDrrx pnt4apxoioeils a2rm(vs;() etomr tatop elivo;t trtoxr3ny4opte fvils sDumxmont4alxomociltfs2ul( p u4 ltoxr tatlm   u o s0s2xm(o iodolt lfvia(  ruaxmont1teeoiociyt aDuauvont)trtnxo iodlpDeau o () 2xrir ny1lmt mnetl() rua( oot0alt  feiad aDea(mp (4 rxoio tadomtrauei;()t2tr(r no4al elnciat arua(mpoo0tlxomf3tatfaDeau onu)altriocty1fmDr nei;s)t2umio3oy4aleelnetl( s2ururonu1alt mfctydlaDeln o t4areomf ootomtrau s;t seumio oy4lle  nci ()a2tmuro;t1aptomfetys s umuvsn()tlxomfctydlmtr ivo s0 exoirpoydamt mfetas arumx  nt0tpxnmoeiytfmDeanvs;t) eeoifctotopD luvi s0t2to(mpoydom  liet ( aDuru o;u1alx mictas a raums;()altrxo oytfmtrluei;t)s2tmxm oo1lpeemies t) rtru o;t1tee ioetlsfa2uln p;() etomf oy1la  li s;t0srxmio ou4apeelnvtls a2umx p;t1tetoioeiydlmDumu o t0trtrxf3ty1oa  lnvs;t0trtmir ny1ameemfcsat a2rm(  ;o0oet ifeiatls2uanmo (4 reoxo ootfat  ivolt)srtoimpiodap nlietl(f rtmxmonu4olx  oeiasls2raumo (0 exoir3tydfmDe ueols  rxmxr iy1altnmfct t s2raxmoot0olxnifeils m em( pnu)arenxfcoo1oa e ieolt0sruo(m ny1ale mfes () 2ta(rp;u4alx mociydlm eauvpnt0aetnmociadlmDrli s t srtoxr iodamt lieiat aDrm(r ou4oetomietldlm ea(mo;t) rtnxr3oytlp  anvs t  rxmxmpio4opeemicia(f rraxmpot0oleomfeias m ranmpnu)trtoxocoytlate u i () 2xrir oy4al nlfcil() rtau p;o1tpe  iciytfa2el( o;t0artrmo iotlpDraiei t)sexm(rpoy4lpe micslsf 2uru p;o0tlx io3ilsfs eaumon(0arxnxo3to1fmD au i;( s2xrim3iy4openmnvsas)s2umxmo;t0tee  ietatfsDulnmpnu4 rtniocoa1fate nvo t0t2xmimpio1openlictltf 2ur(rono1tltomo3ils m ean o;u4trermrciydfpDraies;s s2um(opnudllt micsl(  2rmumpot0altoiietasfa2ulumpnu0tltrmfcoydla rau olt teuo(o3iu4ome  fcil()srtrur nu1texnio3iasla2uanmp u) exoxo3iadlptraivo;s0teumio3oydom nmncsl(f Durxm ot0oleoii3iys m ea(ms;u0 rtnxrcoadoatr n s s0trxoim3oo1lpee ivia( a2uru  nu1aeto oeias mDumu on()alxrif3iydfa elueilt)t2umimpnu1amt mfciat)s2ra(r ou0aexo feiysfs2rln pn(4alerxf3to1lmtrln i s trumio3ny1lm  mfcsltfaDrr(mo;u4apenif3tldfm uan s;t)aetnmfciytlp eaieil(0trtrir oo1ol  mies ( s2ta(rp;u1opx  oetlsfaDemump ()tltoir3todlat aivols)sexr(rpoudapeelfcs t)sDrmx  ou4tpeo oeilsfmDranmo;t)aexomociatoaDr uvs s)s2xoio3oudlltemncs t)aDtrumont0oex mi3ilt s ran onu0 ltnir3oytlaDelivo;s)srxoxr3no4op nlfeslt)aruaxrpot4tpe iociyd a eluvs u4 rtnio3ia1lp e i i (  rto(m iudamee nvs (fsDta(rooo1aeeo feild a rlump t)tleoir totfaD anvi;s0 2xoxo3iudol n fcta(  rumxrpnt1tlx  fcias sDrm( p ()tlxrio ootopDelu o t srtrio3ou1altelnetltfsDtaxm ;o0olx mf3tatfs umnmonu4arenir tydlp   iei;s0 exm(r3iy1lme  ivslt aDrrxmpno1apt io3tadla elnvs;u4 rxoxr3oytlp eau sls) rxr(o ou4lp e fes s  Draum ;u4tetoio3ilsfmDeanms;(4aexnir3tatfm e uvi;s)t2tmxo ou1lle lnesls) 2tr(rpou1tpx  i3ils a2em(ms t4artoxf3oadopDe u slt
\ No newline at end of file
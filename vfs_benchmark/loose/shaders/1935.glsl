@@ -0,0 +1 @@
+ueolt0seumirpoy1lp elfctl()artrx pnu0apxnif3ilslmDeanvp;u4aetrxo tytlm eauesl(0srxo(o nydape lfct t)aDtrxro;o0aleo f3ildlaDemump;u4tltrmfcoa1optrluvils0texm(opiu1lmtelnetls  2rmum ot1oeto iciysfs2em(vo u0aeeomf tydlpDrai slt)seurxr ou1aptelfcsl( srumxm oo0openiocildla2rlu s;u)altoircootlpD  nvs;() etrxm3iu1aptnlnvi s)sruax p;t1ole  fctldfs2eaums t4 rtrxr oytfa rlu i;()seuoir io4oltnmnctlt) 2ua(mp;o0tpto o3iyt s rlu o (0trtnxo oodlpt  n o s) eurxrpoo4optelieta( a2rr(mono4aptomiciasfaDea(vonu0tlerxr iadoat lu s s0 2um(r ou1lpee nctl(fa2tax  ;u1aex ifcias s em( s t0tltoxf iy1lmD  uesls0t2trxo3io1ol elnetl(fsDtm( ont4ole  i3ilsla rl(mont4artnxf todoaDelnei ()texoxo3iu1op nlfciat  rrmxm oo4aptoif3iltls ul(mp u4 rxnio io1fmDeli s;t)setrxrpoydapt lict s)artm(rono1ole ifeils a2umu o;(4alermf3oodopD aivi t)s2toxmpio4omtemfvsl() rtr( ont4teen o3iysls2ea(ms;()texnxo3tytfat ln ils  2to(m3io1amenlnvi ()aDumur nt1tee  octysfsDumn onu)altoir ta1op e u s;t)s2xoim3no1lptelnctl(fs2rrumooo0aetnmi3ilsfaDrmnvpn(4teerxr to1fptrai o;(0trxr(o3iu1opeemfct () Dumu pou0altnio3ildfsDrmuvonu4aeerxo iatomDe ivi () 2xoim3oudomen nesl(fa2tm(mo;t4olxnmfeiaslsDelumonu)tlermrciytfmte nei;(  rtmir io4lme miviat sDraumoot1teeoioctysls uauvo;u4 lenir iadlpDeauvi;t0 etoxo oo4altnmfctas)a2umum ;u4aptomiciatls rlnmonu)artoioctydfa r nvil( texo(m3iu1aleemfvi t)sDtm(  ou0tle if3ild aDuaums (4tlerir tytla  lneo t tetrxm3oudomeemiciatfs2um(monu1optnii3tyslsDrlnvp;u0altnmr3iotlm elu i ()t2uoxm oo4lmen nct ()srumum nu0optoioeiltlm eaumsnu0trtnxfcto1omte n ils0 2tmio3iy4amt  ivi (farur(moot4tptomi3iadlaDrmumo;(0 rtrxfcootomtranvs;t0trxrim3nodll   fvtatf Drmur ;o1aex  feildfm2rmuvsnu4aetoif ta1oa  au s;t)teuoxr nu1amtn fvsl(f Dururoot4olenmf3ils m rlu p (0artnmo ia1lm   nvo (0seuoxr oo4lleemfes (fsrrax p;u0aeenioeiydls2emnmsnt0artnxociy1oa e ues t0t2tmir nu1al elfctltfaDua(ro;u4oetnmi3tyt aDem(mpnt4tltrxf3iatlat  ivo s)t2ur(m3no1oltnliviasfartm( pou4aet iiciatlm2elump;t)aeeoxrcta1la  aivols0setmimpoodop n ics (fa2rmu  ou1tlt  o3ild sDrmu onu4altnxo iadlateaiei;s) rxrxopiudomee ieia()sDumu  nt1texo fciadlsDelu o t) reoif3oydlpDrai il()setm(o no4ol  mnvs ()a2ta(  nu4tptoioeiadla2eluvp;u)artnio tadfpD an i;s0 2ur(opnydlm e ivtas) 2um(ro;u0tlxo ieiadfa2rmnvpnt0arxomoctatlmtran ilt) 2uoio3nodlpee fcil(f 2ta( pnt0tltomf3ils a2rlu pnt)tleoxf3iodfat anei;s)t2uo(m3nydop nmnes s  2um(ro;t1aet ifeiadlm rmu snu) ltnxr oydlpDrai i ( seumim iu1open ictas)artrur ;u1aex  ietldlm2ulu s u0 etomfciy1opDe i o;s  etrxmpnodlmee ictls)a2uax  ot1tlenifetlt s2uanmont)tleomr ta1om rlnvs;(  2uoio iu4ll   ncslsfarrmu ono1opxnmo3tldfa uluvp;t) rerxoctodfpD  ieilt0srum(mpou1lmt lfcs s s2rm(ro;t0apeo o3ilsls2ra(vpn(0areomf3oydfp rai i;( trtr(m no1ole micsls arrmxmo;u4tet mf3tat a el(mo;u4 rxomr iydomt livo t srxo(o iy1ll n nvias)sDurumonu1opt mfeilsfsDrlnvp (0 eerxr ootlat ln s s  2xm(o iy1amt lfvslt) rtmu ono0alx mf3tatfa rlumonu0 eermr3iadfa raieslt0trxrio iydalt  fcsl(  2taxronu4opx  ieilslsDrlu ont4trerifctytlmt  ieo t  exoir3nydoptelfesat  rrrxroou1tex moetld aDumnvo u) exnifctadoa eln i s  2xmxo io1apeelietltf Dtrx ooo1aexnifeiys aDeln o;u)tlxrifcio1fmD  neilt)truo(opny4ameemfeiasfaDtr(  ;o1aleomo3ild mDrlums;u) etoxo3iotla raieil(0 rtrim nydlmtelfetlsf 2ur(r no4oet ioctyd m2ul(vp u)aetnxocoa1lmtr ivs;t)sruo(opiodamenlfet ()sruru  ;t1apx iiciasfs rlu p t)aexrmocty1oatrlivolt s2uo(r oodll  miesatf rua(m ;o4alxnioeiysls umn pnu0altrmr iotfpDelivs;s) rtrimpiu1lme  feil()a2tm( pno1tetnii3tls aDuanmpnt)aetoiocia1oaDr neil()t2toxm oydome livs tfarra( p;t4tpxnmoetlsfa rau s u0alxrif ootfmtr uvo;t s2toxr3nodlltn fciat) rrrur no1aptomieilsfaDrmnmo;t0tlenirctodlmt  ueo t)s2uo(mpno1llt liet ()srurxronu0teeomfeiydfa ean p t) lxoif todop eau o s s2ur(r3iu1ope mfcilt)s2rm(rp;u4altn ociyd aDeluvon(4arenifciytoa  lieo;s t2xoirpoy1lp  mivsl( aDururoot1oltnii3tadfsDra(vo;t) etrmf ty1fp r u o s  2tmio3nu1ol  livi ()srtmump;o4oet mo3ildfsDemn onu) ltrir3iodlaDrlu sls  rtoxm3io4lptelfcsl() rraxrpnt0tee  feiyt a2uaumsnt4 rerxoctydla rlnvs t  2toxo3nu1apenmnvsltfaDtmumpoo1alxniietysla2ulnmp u0aetrxo tytfptr i s s teurxopiu4ll e ivtl(fa2taump;t4tee io3tysfa emuvp t4teenmoctotopDr u olt t2umxo3no4lleelfvtls  Dtrurpoo1tpeo i3ilsfm ran ont4 eermf3oadlpt  nvs;()setrim3io4am  livias)s2umurpoo0apx if3tltfmDrlnms () eerxf3iotfaDe i s;t)s2urim3oydlmenlictltf Drm( poo0opxo fciadfs2ea(mp t) rtnmfcoodlpt ai i;s sexmxmpiu1lle lieia()s2uau ooo0tle moeiydfa2raump;()teerio oytfmDeaneslt0sexr(rpny4lpe livilsfsrtm(m ;u4tpxo f3ildfmDea(mo () exoxr3iodopD  nvi;t0s2to(rpio4ap elnetas aDtm( o;o4ale moeiyt mDul(mo u0aetoifcoydlatrai o;t0setrxopiu4am   netlt srumxr oo1aexoif3tydlmDemnmp (0 rtnxr3oytla rauvsls0 2xrim nu1lle lnct (  Dtm( o;u0optnmi3iatlaDem(ms t)trtrif3oodop rlneolt) 2tm(m iudllenmfcta( arta(r ;o0tptoifciaslm uanmon()artnirciadop  li il(0t2to(m io4apeemivtl( a2umxrpno4tpeomo3tytfs2ea(mp;u)arxniocoa1omtelneo ( teuoxo3ny4om eliet sfa2urxm ou4tlxomoctasls2umump;u4aleomocoy1omDrln o ()s2xoio3oo4ap   fcilt)arururp;t0olt ioctlslsDuluvp;u) eermf tytom  lu slt sexr(m io4ol elnvsls)sDtru pno0aleomo3tysfa elu pnu4artoiociadoatrliei ()seurxo oo4ame lncs (  Drm(  ou0tee  f3iysfm2rmu s;t)arxrxr3io1laDr ivo t0t2xmimpiu1lpe  fcil( arurxrpou1tpxoio3ildlsDumn snu4 ltnir iytfaDeli s;t)t2to(r iy4lmtemfet tf rtr(mo;u0tpx mietlsfa2rauvp u)tltoxrcootlaDelnes;s)trurir no4openlfeslsf 2uax p;o0oleomieiad s el( s;u0 rxrio iytlmDeli ol(0 rtmir3oydopeelneiat s2tru  nu4aexn oetas a2rmu on(4 exrif3oa1op  auvs (0 etr(r3nu1am elfcia(fsDumx o;u1tlxoioetasla eluvo;t4tlxnxocto1lptran sl(0 2xm(opnodaltemncil()srtaxmo;u1oeeoio3tatlm2umuvpnt4aeeomfctodomDrlneo ()t2trimpoydope  icsltfsDtmxmpnt4tet  o3tysfs rau pnt4tlxnircoa1om e nei (  2uo(r oy4altemies (fsrrr(rpnt1ape moetld s2elumo u4 rtrif oo1faDrau i ( srur(mpiudlmtnlictl(f Dta(rpno1tlen feilt s2em(von() eenircoatlaDrai il(0 rxrxo3oodll e iesl() Dtaxr no1aptnio3tas s em(msn()trtnxr ty1oat an i ( trxr(o no1lpe  icils srumxrpou1tpt mieilt s2emnmsn() ltrio3todop eaivo () rurxopiu4lmtnlnvsa( srtaxmpno4oleo fctlt a2em(mon(4altrmo3tydlmtr uei t) 2toxr3oy4ap nlieils)aruaxrpnu4aleoiocildfmDulums;t4teenifciadomt anvi t0t2xm(opiudapenmfeias  2urumo;u1teenmoctytlm umnvo ()tlxrmfctotlatr i i;s trtr(rpiudol nlnet t)srtm(  ou1tetomfctltls2uanvs;(4 lxnifcty1lmteaneil(0teumxo3oudlmtnmncil( s2tru onu4olenmoeiydfaDum(ms u4alermo3tytoa rlueo;t  etoio oy4op elfvsls)aDtmxro;o1tptnmi3iadfmDemuvo;t0texoir ty1om r ieo;t t2xrxo ou4lltnlies (farrmu p;u0teeomo3iadfm2ua( p;() ltrmo oadlatrli o ()seumirpoudopeelietasfsruaum no0alxo o3tat mDrl(vo;(0 lxoxr3oa1opD lueo s)teurirpiodol elfeilt  Dtmxro;u1aee io3iysfs uan pn(0 lxoxrciy1fmDrln s s0 2xoxm iy4lmen net t) rra(  ot0ale  icildlm ean onu0artnio3iy1fm r iei;( s2toxmpny4amen nvsltfsDtmx  nt0oeen fcils m rl( snu)tltrmr3iadfp r uvs ( s2xr(mpnodlmen iciat)sDrau oou0alxoio3iatla eln o (0tetrir totla rlnei;() 2tr(o3iydalte ieia()srraum no0opxn i3iad sDumn pnu0aexrir iadopD aies t0setrio3oy4omenmnvi t  2tm(mpnu4olx mieiadlm eaumsnt4 lerif iodomt an o;s0 2tm(m ou1om n ncsas)s2tmx pno0oltoiieiyslmDumn snt0 etrif3iadop eluesls srumio3oo4olen ics tfs2uaur nt4optoiictytfa2um(vs;u0aeeomo3to1fm elueols) 2umio oydome mncsat  Durur ou1teenmf3tyslmDeanvsn(0 eerxo3oydfateaneslt) rxrir oo1lle lfesls) Dur(mo;u1oexnmiciltfs rm( snu4artriocoatlmtelnes;t0 2urxopiu1lpte nvtat  ruaur oo4oex  ieiydfm ulu p u0 eeoxr to1omDraies () etr(opio4opeemnetlsfs2taum ;t4texomfcild mDulnvo;u) lxrxf3iy1fpDe ivo s s2uoxm3nudop n fvil()arraxmp;u4aee iiciasfaDumnvs u0tleoxr iytoaDranvslt  rtoxrpoodamt lfeia()a2um( pnt4aex if3tadla2ua( p;(0 rtrxo oatfpD  u s;s) euo(r ou4oltnmfctls)a2tm(monu0aptnifetadlmDelnmo;(4artnioctodfptrau sls)sexo(mpnodlpt mncsasfsrumurpno0ape  o3iatls uluvpnt)areoioctatfaD aiesl( t2toxm oy1omenlfvt tf rtrxrp;u0alx  fciadls2umu p;u)tlxomr ia1oa e nvi;t) 2trxrpoy4omenmiesat)sDumu oot4tee miciyd mDea( p u4 rtnmocootoate n sls  2xmir3oy1al   fvtlt)s2rr(ro;u1olenmi3iysfs ul(von(4texrmo3io1la elieilt)tetm(o oodomtemneils)arur( p;t0aleo fetadlm eauvp (0artrifciodfa rlu o (0 2uoxrpoy1oltnmnetas sDumur oo4olen oeiys a umnmo;(0alxoxr oodlp  an o;s)s2ur(o oy1olte neta(fartm( ooo4oee ioetad a el(mo;u)tetnif iadoat ln i s0s2xmxo oydapee fvtltf 2umx o;t1aetnmfctadla2ul(vonu)altrmocoa1fmDean s t)t2xrir3oy4ap elivsltf 2rr(ro;o0tpx  f3ildlaDem( s;t4 rtrmociatfpte nei;t) etoim iu4om n iciat)aDtm( ono1oexoiociad sDelu o (0 lxrxrcto1oa  ln slt0 etoio3oudolenlivs s)sDtaur ;o1tlxn f3tlsfmDrln snu4altrxo3iatfmt au o t)texrxmpiy1amtn fcilt)s2raxronu0oleo oeias mDul( p u)alxrmf tytlmDeluvils trtm(m iydal nlicias s2umxmono4openmfeiatfm em( ont0 rtrioctytfateaiesls0 rumxmpnydamtemivi s)srumum ;u0tltnmiciytfa2ul( o u)treoirctatfmtean il() rtmim iy1omt lnci (fsDtmx  nu4apxo ociysfa2rm( p (4tlxnmrcoa1lmt lnesls0 rxmxo3no1lpe  icia()srrr(  ;u0texomoeild aDrlnmsnu)arermfcoy1fatrli ils)trtr(m3iudape  nci ()aDrrurpnu0tleo o3tyt m elnmont0aeenxr3iy1fp rlueo;()s2umxm3oy4om elfvsl(farta(rpno1tlxn fctyd a rmu p (4artnxfciatfaDean il(0t2xrio iy1lp  lneiasfs2ua(r oo4olt iociltlm ranvs;t0 rtoir iodfatr n i;s  exmxm nu4lpt mnesatf Dtmx oou4opxo ociadlmDem(msnt4 exnircoa1lm r nvsls)t2trirpio4om nmnes tfarrru ooo1tltomieiaslm ean s;u0trtrxfcoatla e nvo;s texm(r oudlmtemfes (f Drmx pou4tpxn ictld s eln s (0texrio3ia1fptraneo;s0 etrir3nodlme lnct sf 2umxmpno0opxoio3tasla2rl(mp (0treoiocoadlmDrai o;t)t2umimpoodoptnlfeil(f 2trx pnu0oee mieilsfm emnmsnt0trenxo iatlp raues;t)texr(o3oy4lpenmfcs () rrru o;u4texoiociyd m el(monu4tlxnmo tadfmte u o;s tetmio3nu4optemncta() rtaxr ;t0opx  oeiyslmDemuvon(4aexnxr3iatlat  n o;(0 exoxm nodaltelicilsfaDurumoou4aet mictatlmDea(vs;u) leomocoatla raivo;s)t2umirpoudlptnlivsa( artmuront0tlenif3tydlmDrlu snu)arxnif todlm   uvil(0s2um(o3oudolenmici (  2urxr nu4tpe ii3iytlaDrmums;t) ltnmf iy1fm rlieil( truoir3no1olenlfvias arrru  no0aptomieiydla2ua(ms;u4teeomo3iydlmD luvsl(0 rur(m3nydlm e nctatf Drr(rpot0oleomfciltfa2uan p;(0teenxo oy1oa  auei (0 eurxm3no1ome mneta(f Drax  ;u0teenioctadfmDeluvs;(4aeeoxfcto1lpD liei;t) 2xoxm iu1ope micias sDrru p;t1opt  fctytfm rauvo t0 rxnmo tytfatr nvi;t setrimpnodoptelieia()aDraxmonu1optoio3iadls2em( p;(4 rerirctatfmtrluvilt)srtrxo3ny4open icslt  2rru onu4tlx  fctysfs ra(mp;t4 etnmociydfmDeaivo s0 etrxrpiydlpe mnct tf rraxro;t1tetnmocild aDrmnmo;t)tetrmfciodlmtrlu s s  2xoio iodlmtemncsa(fa2rrx  nu0tlt if3tat mDua(ms;t4texnio3iytfa  aueils0trtoxr3nudap  lict (  Duau ono0tptn fctldfaDumuvo t)arxrxr iydomtr neo;s trxoxopiodalenmnes sf rtmxrpoo0tee moeiytlmDrl( onu0 ltrmf ta1oat  u o;t0 rtrim3oudll   ivt s)s2rauro;t4aeeo i3iat s2eln s u)teerxfciadla ean i t) eurxo ou1lmtemnvi ( sDuaxmono1ale  ietlt a eln pnt0alxnxr3oo1fatelnvol( sexr(rpio4al  lfesatfsDra(r oo4texnifciysfsDrmnvpnt4 exomf oo1fmDrlnvo;()s2ur(opoudop   neiasfsruax poo0tlto feiyt s em( snt)arxrmr oy1lpDelneo;s0 eurir3iy4lpt lfesa() 2uru pou4tpe io3iytfa uluvsnu)trerxo3ia1oa e u i;s) 2tmxm3ny1ol   fvtls  rtrxro;o4oexo feilt aDea(vp;(4aeenir tadfm rlieils)s2ur(m3oydal   netls aDtax pnt4tltnmf3iad mDul(vpn() reoiocoo1fmD  ies;(  2tm(m3nu1omeelfvslt)srrax pou4altnmi3iys a2ulnmpnu4aetoif oy1lpDr n s;t)trxmir3iodame lfvias  2rrur ;o1aee if3iasfs elnvo;(0arenxfcoadfmte ivolt)t2um(r iydlltn ietltfa2ra(m no1opto f3iydfm2ul( snu4 eenxo iodfp  ln i s0t2toim iodaleelfeil(fartaxmo;t1teeoifctysla2el(mp u)alxnxocootoaDr u o ( texoir3no1am elfcsasfarrmxront1oex mieiys mDrm( s ()trerxociotla r ieilt0 rxrir ny4ap nlivs ()aDrm(  ;t0tle  feiatfa umn p;t) leoir oytomDe ieolt) rurimpio4omeemici tfarua( ono0apeo ieildlmDua( snu0tltnxf iadfp e u o ()t2xmxo3iu4lle  ici s  2ur(mpoo0tpxomfeild s um(vo u0aetrir3iydlpD  n s;t)t2toio3nodoltelivsl(f 2umx pou1tltnmieiltfsDea( sn(4arenxocoadlpDeauvi ( sexoim iodlpe  icsl()aDuaumo;o0tleoifetytlmDrmuvsn(4 rtoif tadlatr uei s)t2urxo nu4oleelneta()a2raxmpot4optomocilt a2rlnvpnu0aexoxf3tytfa  ln ol()s2tmirpiodol  mncta(f rua(rono4tpeoii3iydfaDrlumo;(4 leoxo todomD  uesl(0s2xrimpou4ll  mfvilsfaruaxmo;o0aptomieilsfmDrm( o t4 ltoif ia1fmtran o (0 etr(rpno4lltelncil()s2rax oot0opxomociltlm rl(vs (0 eenif3oatlmtrai o;(  rur(r ou1alenlnvi sfa2uaur no4tee ifetls m umnvpnu) ltoxfciadlp e iesl(  2tmxmpny4aptnlivt t) 2rmx  ;u4teeoif3tadfm2raump;(0 leoxf todopDrau s;s) etrxr no4lleemneslt)aruaxr nt0apen f3iasfsDum(vo (0trtnmr oytoate nvs;(0srxriopiy1aptnmnvtlt s2rax  ;t1olx mociadls2elu o t0trerif3oydfmt anes t s2toxo3iudlp  livsatfa2rrurpnu1olx mf3iadfs rmuvo u4tetrif totfaD aivo;() 2xm(r3no4apeelnvta(faDtrxrp;t4olxomoctydlmDuanvsn(4aexoxrcia1oa  lnes;t sexo(r nu4ol nmict s)s2tau  ot1texn i3iatlm eanmsnu)trxnir io1fmt anvs s trxo(mpou1oltelfct s) Dtr(m ot0aet  f3iasfaDrmnmp (4artrmf3iytomtelnvolt sexoxopoy1am  mfvils)sruax  oo0tetomf3ilsfa2ea(mo;t)trtoif3iatlp e u i t0seumiopiu1ap  lfcsatfsrrmurpno4aptnmf3iatlm2rmnvo;()altrmr iadfp r ivo;s)sexmir oo4alt livsltf rtrx oot4oltnmfeiasla uaumo t0trxnircoadfa rlneilt setrio3iydap n nviasfa2uaxm nt1oexnifetytfmDemnvp;t0trxnmocootlm   nvol( trtm(r3ou4oltn icilt aDrr(rp;u4olenifetlt s ulnvpnu) etrxrciy1latrlnes s  rxoio nydolte neils  2uax o;t0alxn oetyslsDum( onu)altrio iy1fm   i s s0 rxmio3nu4aptnmfesat  Dtrum ;u1aee ii3tldfm2rln p;t4alxnmrcoy1op  luvo t0t2xrimpiu1lm  mfetl(farrmurp;u4tet  icilslm uanvp (0tetniocio1om  lneol()t2xoxm oodlmtnmneia(f 2uaxro;u1tlx mf3iaslm emuvo;t4aetomrcoydoaDe iei;s texo(o ou1ll n fesa() Dra(rp;u4tpt moeiyt sDeluvs u4 etrxr3to1oa rli olt)srumimpou4oltelfctas  Dum(  ;o1tetnmi3tydfa2el( p u)arxomfcoy1fat auvsls0 etoim3no1oltelfctl()sDuru  no0alt  i3tldfs em(vs (4artnxr tatlmDelieolt) rtoir io1om e iei ( arururpot1olt  i3iasfs eln ont)artoxfcoadfmte ies t srurxopnodoptnmnvt ( sDtm(r ;t1oleoifeiatlm2ulumont)texnmfcoodlm e n o;s0s2ur(m nodol  lfeia(fs2rmu o;o4opeo fctysfaDel( p t4aexomo totfa eli s;s)teurxm3iu4amtemieta()a2um(r ou0tet mfcilsfsDuan p t0 leomrcoy1fmDeluei;(0teuo(o3iy4ll   fcsas aDum( poo4aex moctaslm ran s t) reomr tydomt aieo;() rxo(mpoo1omenlneslsfa2taxmoot0ape  fciyt a rm(mpnu4 rtoio3io1opDr n o;s setm(m oy1am e ietls) 2umu o;o4tptnmf3tldfa ranmo;t)treoiocio1la eluei s  exmimpou1ol  mnvt sfarurxm oo0apxnmi3ildlm2rm( o u0aeeoio tatla eaiesl()truo(o3nodlltnlfciltf Dumuro;t0optomietydfa2ea(ms;(4 lerxfctydomt anesl( texoirpoodlpeelnvi s  2trurpot0open feiyt s umnmo (0alerir3iydfa   neo ()trtrim3oo4lpt  nci t)a2ur( pnu4olxn o3tysfa2el( pnt)tltoir io1laDe n o ()texr(o3iy1optnlnes t  Draxr ;t1tpxn fciat m2el( p (0tlxrif iy1laDrluvols) 2xoxr3iodolt mict () rtm( p;u4apt  fctytfa elu o (0 rxnmr io1fpD  uvs;t t2xm(opiy1ol eliesasfsDuaum ot1tee ifeils m2rmnvon(0 rtnxocty1laDrlieo (0srxoxmpny4lm n ies tfsDtax  ;t4tlx moctyt a2elnmpnu)aeerxo tydlmD livi (  exoim3io1openlict t  2tru o;u4oee ifeiys sDem( sn()aetoxr oy1lpteauvil()trurim3nydamtn ivt t srum(rpnt0opx ioctys mDuan s;u0 rxoxr3oy1oatrln s t srurxm3ny1ap e neslsfa2tru pou0tpt  ociys s2eanms u)artoxf3to1fm e ues s0t2ur(rpno1omt lfetas a2tmxroou1altn i3iyd m emu p u4 rxrxfciydlpD  ivi t sexm(mpou1optnmfcsas) Dur(rpou0tpxo feiltfs2rm( o;()alxrxociodoa  ln i s0 ruoim ny1op   nvtltfsDur(ro;u1oee ioetld aDuaumon()trerif3oadfm eauvil(  2trio nu1ap n iciasf Duru onu0olxnifeiat m rauvsnu) eerir oodfm raieo;t s2trir io1op e neslt  2rrxr ;o0teen iciatla2um(vs;()altnxo3oo1lpDeauvi t srxoir3iy1olt lict (fa2uaumono4tetoif3iasfa rmu p;u0aexomocoa1faDraivo s t2tm(o3oydoptnlicslt)srtm(mpnt1oeeomfctasfm2ulnms;(0aetnxf3to1fmteaiei ( s2urir3oy1ap   ncs (fa2uaumpno4olenmieiltfa ul(mo (0tltomf3iy1lmDelu sl( seur(o3ou1lp nlict tfs2rmx o;t4tleo feiytfs rlums u4 rerxo iodlmtrauvols0seumxr nu1omt  icsls)sDrmxm nu1aetn octydlaDrmuvsnu4aeenmo3iatlmD ai i;() eurxr3iu4ll emncs sfaDtr(m ot1aexnmo3ilt mDum( s t0treoif3oo1lmDeanvs s0srtm(o3iy1aptnmictlsf Dum( o;u1texoiicild s2rlnms;u0texomr3iy1lp eau o t0 2tmim3iydam  lnetas)s2trumont1alxn ociytlsDua( pn() rtoifcoadlpteanvs ()tetoio oudlptemics s) 2ua( oot4tle  ictasfs2ul(mont)teeoifciydfmt lueolt seumxr3oodalenlicsl(f 2rmur nt0optnio3tytfsDel(vont4 rxomf3to1late uvo (  eurxo3io1op n fctat  rurxronu0tet io3ilslm elu p (4alxnir3oy1oate u ols0 ruo(rpno1ap e ivs t)a2urx o;u0opt  feiydlaDuaumpnu4texnxrcty1lat luvi;()t2tmim iu1aptnmnei () rrm(m ;u4olen ieiatfm2um( onu)trenxr oo1fpte uvo ( seuoir3no1ameelfesls sDuaumoou0tpxomfeiaslaDeluvs;t0 lxoxr3oydoa r n il(0s2xoxo iodole  icilsf 2umxmp;t4olt if3iyslaDrl(mpn() rtoio3iytoatr uvs;s)s2uo(r3ny4aptelfvsasf 2umurooo0olxnmociydfa2ra( p t0 ltoxo3tydoat aueils t2uoir3oy1oleemicil( a2rmu  no1tetn oeiysfs emuvo t4tltrir3oo1fmtr i ols  2to(opno1ll nmiviatf 2uax pno0tlx iictatla2emums () rtrio3tydlmDeluvo;t  etrxo3iydaleeliei ()s2umxm oo4oet ifetlsfa2ul(ms u)alxnif oy1lmD  i sl(0srurxrpnydomtelnvtasfarrm(mpou1oeeniociys aDelumo u0 exoxfctadlpt ai i;t) 2umirpou4alenlfcsa(f Drm(rpnt1texomfeiyt s2uau pnu0 rtnmo oytlpDran olt sruoim oo1ale  fei () 2umuroou4oetnmi3tadls2uanvs u0 rtrmr3tytlp r ivs;(  rto(o3ou4olt  ivil( arrmu pnt1optnmo3tydlm2emn p t4 lenmo3iy1oaDraueo s0 2umim3iy4amte fcsl(fs2uaxm ot4tpxniiciyd sDrlump;(4trxnmrcty1optraueol( seum(opou1alee fvta( aDrrx  ou0oleomfeiydfmDelu onu)alermf ty1lmtean i s)teum(mpoydal n fciasfs2tr( ont4olx ii3iat m2eanvp u)tlxrxfcty1oate n s;s0t2toim3nu4amtnlfeias arumxmoou0tetomoetat a2ul( p;u)arxrif3oatlmtrau i;t0s2toim iy1alen iviltf 2ua( ont1tpx mi3ilsla2ulnmp t) rerio oydfmtr n s s) rur(rpoo1optelnesa()arrr( oot1aeeoifciatfs rmuvsn()areomo todoaDeli i;t srtoxm ou4ol  mfei s)s2uax pnu0tptnifetydls ra( snu4alxrxf3ia1oatr nvs t)srtmxm ny4oltemnvt sfs2rrx pno1olxoiociat aDrm( s u4 ltnxociytfp  anvi t) 2xr(m3iydlmeelfviltfsrtaxmpno1olenifeiatfsDuluvo;u4 etnioctadlmDe u o (0sexrxm oy4lp   fetls a2uaxmpoo1oeeo o3tat sDumu ont0altniocio1fa   neilt0 rxo(m iy4op n fcta()a2urumont1aeto ieiyt s emn p u)altrir oytlpt li olt  rto(r ou1olt lfeils)aDrmum nt4oetoiociadfs2ul( snt)teenmr oo1om e ieol( sexoxo3oydol  mivt ()s2rr(r oo1oeeoioeias sDra( o t4tleoif3totoaDr i s;t)trtmxm io1lmee fei tfsDumurpoo1oet if3iatlsDrm( p;(0tlenifciytfaDean s t)t2xoxm nudoptnmnet s) Dtmur nt4oeenifciytfsDuan s;u4tetomo tytlmD lnvi s  ruoxopny1altn ivi tfsDumumonu0aeen i3iydla2rlums t0alermo3oadoa e nvs (0texrir iu1apeemncta(fa2ur( o;o0tlxomoetatfmDelnvpnu0 ltnir3tatop e uvo (0 rtmir iu1ap n icsltfarrm(rpno4tpen f3iad a ran pnu) rtnmo iydfp rlnes (0t2umxm3ny4aptnmfcs t s2raxmoot0oleomocildfaDulnmp;u0trerio3oytfaDeanvi s teuo(o3ny1ome lics () rrax pnu0olx  o3iytls2uln s u0teenxocoatlptrli s;t tetr(r no4omt  feils  Durx  nt1olx iociadls ua(mp u0 ltoxo oatfm raues;() rtmxopiu1ame mnvi () 2rr( p;u0ope  i3tad a rlump;()alerir ta1oate i i ()teurxo no1lptn nct ()sDrruroot4tetoio3tltla2rmnmp;t)texrxr to1laDeaivi;t)s2umio3oy4al emfcsl(fs2umumpno0tpeomfcild aDem( s (0 rtoioctadlaD au ol() rur(m3nodoltelfesltfsrtmxro;u4tlxo oetlsfa emump;t4 rtrxr3to1oa r nvi;t)setmxr iu4lmtnlict (  2rmxroot0oexnioetltlm2ean pn(4aexnmo ta1om ranvolt  2tmim3iydop nlnvs sf rraxmpno1aptn fciys sDrlnmp (4tetnxr totomt  u s;(  2urxrpiy4opt  nvtl() 2uaur ;o1tlx mfeildfm2ul( s;(4arenmrctadopt li i t0 2xo(opnu1lm n ncsls)srra(  no0oex ifetas s2umu o (4tlxrifcty1fmteanes;s)s2tm(m3nudom  lnci ( a2urx pnu0aptomi3ilt sDeanvont0texoxo iy1lpDrli ilt  rtoir oy1ame mivtl(fa2umu pnu0tpenioctltfm2rl(vp;(4artnxocoa1fpDe uvols0s2toim3oy4opt lfvsls)s2tmxrono0alx  i3iad s2uln p;(0alenif3iytla rlieilt trtoxmpiy4alen fvsasfarta(m oo4aetn i3iltla2ean ont4trxriociotlpt aueo t  2xmxm iy1lptelneiatfsrurxroou1ale  feiyd s2uanmo;t)altoxfcia1lpD anvo s0setrxm oo1ole lnes (fa2tm(  nt0tpxn octldlaDra(mp u4 lenxo totopt  nesls)t2to(r nudam n ici t a2rrur ;u4opt moeiytlmDrm( pnt) lxriocootomtran olt tetr(r ou4omenmietasfarrrum nt1tlxn feiyd sDeluvs u4tlxoio3ia1fpDe ueo;s t2xm(m iy4omeemnei ()s2rmumpou1teto iciyt aDea(vont) rxomo3tatlmtrlues ()srtr(m3ny1lpe mfet t)s2ra( o;u1opeomoeild a ran p t)alxriocoa1fpt  uvolt0t2um(rpou4opt mnvsl(fa2ra(monu1tltomietldlsDemumont0aleomo io1la  an s (0trxoirpny4omtemnetas srtaur nt1olt  iciyt s ua(vonu)trtrif3iatoa rlu ils)teuoio3ou1omee ici s arraumo;t1alx ifciatfs uanvsn(4 rtrxr iydomte ivslt s2xoxopnu1lp emnesls  2tmump;u1optoiictld m2emnvo u0aexrmo3iy1lat lu slt truoxopno4al nlfcias)s2rru pou0oltn icildls ea(vo u0 rtnmrcia1oaDeaieolt0tetm(r oydlm emnctasfsDrau  ;o1aexomfciydfmDumuvs t0aeeomo iodoaDr u o;(0 euoxo3nydam emnct ( srrrurpot4olenmictydfm2ul( o t4 lxnio3ootomt lneo s0 euoxo3iydaptemivsas)aDrmx pnt0texoiociyslm2em( pnu)altnxf oytfmtraieils  rtrim nudap elnetl()srraxrp;u0apt mfciytlm2uanmpnu4aetnxf3iydlatean il()trtmio3oydameemfcil(f rtmxrono4texo o3ias aDranmpnt) etnmr3iadlmDr ies t)t2tr(m3oydop nmivtas  2rm(  ;o1ape  oetytla2elnmo;(0 eerxr to1opte nes t trxrxo3no4om n netls) Draxrpou4aex ifciatfm2em( p t4arxniociydlat aies;t) rto(m3no1omeeliesatfsrua(m ou4olenmf3tad m rauvpnt0arerif ty1opDeaivs t0 rurxo iodom  lics s) rumxrpoo0oleoiociasla rmnmpnu4 etnmociytfpDeaivol(0seur(r3iodol e fvtltfaruaum ;t0ope  i3iad s2eauvs;u0trxrmfctydlaDe ies t tetoxrpiu1om e fcia()aDtr(m ou0tltn i3ilsfs rm(vpnt)aleomfcta1faD li ils srto(opio4olenmnei s) Dra( o;o1teeomoctydfmDelu on(0tetoxrcoa1fm elnei;s)t2xoxopoy4lp  lfcs sf Dumum ot0aet mieildls2eauvo t)trxrifciy1opteai i t  euoio iydlptemnvs ( a2urx pno4ole iociys sDranvo u)trxrmf oydom eaivo;t)srurirpnodlme  feilt)s2umurooo1tltnioeiyslsDrmnvp;() eerir iotlptelieols trtoim3nydopte fvi ()artmxmpou1tex mf3tld mDumnms t4aetoxf3oy1fm rli o;s s2umxrpio4oltnmiet (  Draxrono0aetomoeiys aDeau snu4aexoxf3oodlmt lu s;s teto(m nudlmtemics tfa2rmx  nt0oetn o3ilslm umnvon(4tlenxr3ootlmtrlnvo s)s2umio3nu4ale mnvias  2umxm ;t1altomociytlm2ua(vsn(4arerifctytopt  nvi;s0 etmio nydol elfct s aDua(mo;o1olxoiociydls2elu p;() rerifctadla elneo s)sruoxm iydlm  lnei t)s2tmxrono0ope  fctltls2ea(vo;u4tleriocoo1fmDeau i;( seuoio iy4opt mfcsa( sruaurp;t0tltomfeiytfa2umump;()aeenmf todlm elnvol( srur(o3no1opte nvia()s2urxr ;t0aetnmoeiydla2umnmp;t0alerif tytlp   uvo t0t2xmxopiu1ameemieta(fsrua(mpnu1oetoiociatfmDemnmsnu0texrxf io1fm elivo;(0s2tr(rpiudol nlfeilsf 2um(mp;o4aexomociytlm uan s (0tlxnmf ta1omt  ies;s0sexmio3oodllt lfcil(faDumxmpoo4aptnio3ils s eau o t4teenmo todlp ran slt seto(m ou4ll elneslt)arrrumoot0opeomf3iydlm2ranms;u)artnxr3oytlp  aivs;()sruoirpiu4ap elnctatfaDuaxronu1tptnmf3iadla2em(mpnu4alenxo to1om e u s t trxoimpoudope mivsls)a2ra(rpnt1alto i3iatfa eau s t0teenir3totlat  ivi s setmirpnu4ap n nvt s) rtru p;o1apx if3iadls2eanvon(0alxnircoadlatrlies s trtr(o3iu1lp nlfvsls)arrru onu0tlenmf3iatfaDeauvs u)areoxf ia1lmDrli ils t2xr(m3nu1amtelnvt tf Drrx p;u0tlxomocils a2eln o t4aexrxf3iytoaD lnvs s)t2xo(o3io1ope mict (  2ur(m ou1texn feiltfa rl(ms;(4 ltrmrciytfp e ivslt  euoim3io4altnmnvt (fs2tmuronu1alx  ocils sDem( s;t0trxomo3todlmDrauvi;() exoxr3oo1alte ivslt)arumur ot0tpt iiciyslsDulnmon(0texrmfcta1oat  ues s0t2xoxrpoydop nlivs s)a2tm(mo;u0opxomoetatlm2rlnvont4 exoxociatoa eli sl(0sexoim3oo1ope lieil(fa2umumpot4aleo oeiyd a emn ont0tlerxr3oydfm eai ol(0trurir iydlm nmieiat a2uaxm nt0teto oeiysfs ea(von() exnioctytfp  aueol() exr(m nudaltnlivt tf Drrurpoo0olxoifeiyslm2ul( o u0trxrxr oa1lm rln il( srtrio nu4ap  micsl(  Drmumont4aptn i3iadfs2rl(vs (4altoio3oodfa rau ilt)t2umxm ou1amtemfcsatf 2tmxro;u4apeniociydls eauvp;t)tlxrxf oadlmtrlnvs;(0t2xrio ny4oltnmivtasfa2tmu o;t1tpt mociydfa rmnmonu0arermo oytlp rlueo;()setrxrpnu4ame lfctat)aDtr(m ;t0opeomo3iaslsDumuvpn(4 lxrir3iatfatranvs ()t2tmio3oo4lpenmneslt sDtrxrono4olt mf3tas m ul( s u4 exnmo3to1fpDe i i s  rxmio3no1ape  fvt (  rrrxrono0oltn fciat s2rau s t0 rxrmfctodlpDe uvs;s) exoxm3oydop e icta() rum(mpnt0olx  ieilsfmDum(mo u)teeoio oytfm rlnes;() 2umim3iydalen fcs ( s2ur(mpoo0olx  feiat s2ul(mpnt)altnxf3oydlmteauvs;()srtoxm nydlp nmnvils) 2rm(m nt1aexo fcilslm ra(vpnt) eeoir oodlatranvi t)s2xoio3iodameelfviat s2taxrooo0tlxn fctltlsDrauvont) eeomr3iy1lm rluvs;s0srur(rpoodape mfvi s  2ua(ront0apt mociltla2uanms;u4alxoiocia1fp r n s ()sruo(r ou1oltn ivsl(  2rmumono1opt mi3tldlm2raumo;t)tetrxr3ia1opDranvo ( setoimpny1lle  fci sfsruax pou4oetoifciaslm2emu snt4 exrxf oytfa  livi t) eur(mpiydll e nvs s  rum(mp;o4alx if3tlsla2rm( sn(4 etomf3oytfm raneo;() 2urxr oo4lmt micil(f 2rm( ono1tpeniieias mDeauvsnu)aleomr tydlptr uvs t)trtrxo3no4oltnlietlt s2rmxrp;t4tpt  ociys aDrlnmo;u)tltoiocoy1lmD  uvi;s  2trirpnydale mfeiat  2trx  ;o0altniicils aDran o;u4tltrio3tydopDean i;t0 rxoiopoy1al   ieiatfs2tmxront0tpxomfcild a ra(vsnt) etrmf iodfpDeluvslt sexrio3iy1olenmncs s s2umurp;t1aleomoeiad m2rauvp t0teermf ta1omD  uei ()seum(rpiu4altn nvia(fa2tr( pnu1oet ii3iadlsDeauvs;u0 lxrir3iatfate ieo t0 2xriopiy4lmeelncs ()s2umuront4alt mf3tydla2elnms u4aetoxo iydfmt  uvs;s s2xoxm3iu4apt lnvil() Dum( oot0ope mictatfmDemn p u4arxomociytoaDrli s;( trumirpoodlmtnliei ()sDrau ono0aex ifciyt a ra( s;t4 ltomo3ty1lmDrai sl()trxrxo no4om   fvtl(faDtrumoot0tet mf3ilsfsDum(vp;t0 etomocoy1fmteluvs;( teumxrpiudomt lictl(f 2trump;t0oetnii3tas aDuan ont4alxriociadoa  lneo s0 eurxm no1aptemfctl()sDrrump;t1tleomfeildfsDeln o;(0 rtrmo oodfa  au i;t0t2tr(r3io4am e fcsat arta( poo4aexnifctysls2rm(vp;(4 rxoxf3ta1fptrlivo (0 eumim iu1om nmfvsas a2ur(ronu0tltoif3iytfm2em(vpnt)trenmociy1laD lieo;s0t2xrio oy1lpeemivi (fs2rau oou0apt mfetltfa2rmuvs u)texomo ootomDe neslt  2uriopiy4om e ivtas s2urxr ;u1tlxniiciltfs2uau p;u0trenxfcty1fmD au i s  rxmxo3iu4lm nmnet tfs2uau pou4tet  ociasfm uan pnu0aeenmo3totlatrau s t0 eurxr3oy4omeelicilsfarrr(ro;t1alt iietatls2rau s;t)tltomf3io1fmDeauvo s  rtm(r3oy4lm   ictasf Dra(roou0tltn o3tld mDelnvp;u4tetrmr iadlat livo ()t2to(m nydlpe  fvsa()aDtr(root1oexniieiltla rl(vo t) ltomo3oydop r n o ( t2xmxopiodlpeeliei ( arrrumono0oetn fcilt aDrln on(4altrxf3totfmt aneo;( texm(m nu1llt livsltf 2umumo;t4olenio3iydla2rl( on(0teeomrctodfa  aivil(0 2xmiopoo4amtelnesa( srtrx  ;o0apxomociydlmDrau o;t4 eeomr3tadlm r ieil( tetmim iu1omtemivt t) Dra(mont4altomfeilsls rmuvs;t4 rermf oydfpDeau i;t  rtr(r3ou4omenlfei tfs2umumoou4tle  ietldfm2rmn pn()tlxrir3oa1lmteauvilt0setmxr3oy4lpt micsl( s2taumo;o1apeoiiciatfm2ea(mo t0alenxf3oydoaDe ieslt)t2umxmpnydlmte nvsatfa2uau ooo1tptn i3tls m elumpn(0alenir3oa1fatrluvs t  2toxopiydamte ncta() 2tax  no0oet mieilsfm2ranmsnu0tetrmr ty1fa r neolt0s2xr(opou4om emfetlt s2rmx pno1oleoiietas a2emumo u0tlxnifcoydom elnvs () rxrimpou1ol  lictl()aDtrx pnu4olxo fcildfa ul(mp;t4alerxrctydlmt auvilt0 eum(o nudoleemncs (f Drrx pnu1oeeoioeiat mDemnms t4arxnif oydlmD aivi;t teurxm oudom e fvtat)a2rauro;t0aex  f3iltls emnvsnu)arxoircio1fp eaieo;s srtriopiodamee ivilsf Dtr(  nt1alxomictyd aDul(vs;u)alenxfciadlateli s;s)srur(m no4lp elfctlt)a2ra(rp;o0tpt  iciltlm eauvp;t0 ltrio oa1fpD  ueols teuoio iu4om emncs (  ruaxr ;t4aetoif3iytfmDrmump;t0 leomrciotlmDeluvo t) rxm(mpou4lm nlnctatfaDtaumoou0alx io3iat s2rm(mp;u0 lerxr iadlm eai ols) eto(m3oo4lmee fvsls  2raxmoou0oexomicias a rm(mpn(4 lerxo3iotomt lnei ()sruoxo3iodlmtemfcslsfs2urx oou0opt mfeilt s ul(ms t0 leoio3oy1om elnvo s teumxo nu4op n netasfa2um(moou0opeomiciytlsDum(ms t4texomo3oo1lmt  uei ()srtm(o io1ol e ncsa(fsrrrurpno4tltnifeilt mDumuvo;t4trtnio3iotfp e ueo t)s2xoio nodlp nlfcsl(  Drm(mo;o0apeomociatls2eauvs u) lxrir ta1fmDraieo t0 rum(r3oo4ll emnci t)srurxrpnu1tpe ii3tld m um(vs;u0tetnio3oy1fa eau o ()t2xm(r ny1lltnmncia()aDrmu o;u1tle  i3iydla rl(vo t) etrxr tytoa  luvsls0 rtrim oodlm   ieias aruauroou1tlt  fetltlmDem(vo;(0alxrxr oo1fatelu s s0 2uo(opiydopte fetltfartau  ot0aexnio3tat mDulnms;(4 reomr oo1oa raieil( srxmxr oydaleemfesls sDrm(r nu4oetn ietyt a2rln s;t4alenif iy1fmtraivi;( trumxmpou1ll e icsa(fartrum no1aptoio3ilsla ulnvonu4tetrir3totfmt lneols  rumio3ny1aptnmnct sfaruaxroot1tlx  oeilslm um(vo t0trenxo tadlpDr n i;s texo(m oodlm n fet t srua(m ou0tpeomi3iyd sDrm(vs;()trtrmoctatla ranei () rtr(rpoydlm  miei (faruaxmooo4oeen ieiadlaDrmnms;(4tltnio oo1latraueo;s  rxmim oy4al  lfci t) rra(ro;o4olxomi3ilsfs2eau o;u)areoxfciadfate ueils t2um(r3oodlptelnctls sDua( ont4tptomo3iys s2ua( ont)arxrmoctydlmte u sls tetm(r3nu4op nlncias)aDrr(rp;o4aetnioctld m2rlnvs (4aexrmr3oodopt lu i;() 2tr(m oudome mfcia(farrr( o;u4altoio3tld sDrm( on(4tetnio tydlp eaueilt) 2umim no4apenmnvs (f 2umur ;u4oexnio3tydfmDeluvpnu0texoxfctadfa rlivol( t2tmimpoy1omtn neiasfa2trx p;u0ole  f3tlt mDel( snu0tltoxoctotomDelnvo;t)s2tmxrpny4altn fcilt artm(r oo1aex  ocilsfa rmnmpnu0trtrxfctytlpDr neo;()srumir3nu1apenlncs (fsDtaurpoo1opxnmoeiaslsDrmnvs;(0trxoif3iy1lpt aivo s)truoimpio1omeeliesa() Dtru  ;u0optoifeiysfm2em(vpn(4tlxnxrcio1opteanei;t)t2to(r io1ope mivi s a2ua(moot0apeo i3iysls2ranmp;u)aexoio3oa1oaDeaueils srum(r iy4olt  nei t arta(ro;u1oeeoifeiad m emuvonu) renmr3todom  ln s (  exoxm nu4lm nmiesltfsrur(mo;t4optn feils m ra(mp;u0 etnxr3oadlpDeluvslt)seur(r3ou1lmenmfcil( aDumum ou1tpx ifctls m2rmu p;u0tltoxr3iodlp e i o s)texmxr3nydamtn fctlt)a2urum ;o0tpt iiciad m2ulnvonu4aetoxf3oatlatr i sls)t2xoim oy4lmte fetltfartr( pnu0aex  i3tlt mDrmn p;u4arxriocia1laDeanes s0 exmir3nu1lme  nviat s2rr(m ;t4olxn oeiltlmDeln p u0aeeniociodlmte n sls0setmim oodope lnviatfsruaumpot4oexnio3tys s2el(mpnt)tleomfcootfptran i;t)trtoiopou4opt mfvt t srrax oou0ope  i3ias aDranvs (4trenif iytom e uvs s seto(opiu1ap elfeia( aDrrxr ;u1opeo ictltfa elu sn(0tlenifcoo1fa eanvs t0texmirpno1oltelivsl()arrr( o;u4tet mo3iadfs rmn o u0trtrxf tydop  li il()t2xmxr3nudal   fctat)artmxrp;o0oltn iciys a2ranvs (4alxrxociydoateli slt0 eurxo ou4lmenlfeiasf 2ra(mooo0oeenmfeiyd mDuanvp;t4tetoxo ia1opteau s;t  rtmio3oudomee fcs s sDtaum nu0apxo f3iytfsDelnvsn(0tlxnmo tadfatrlnes s0 etrxr nu4lm elncil( arrmurp;u1alenif3tadlmDeanmo;u4trtrifctotoa eanes;t)setoir oy4apenmicilt) Drr(m ;t4tlxoifciyd a el( s u0arxnxo tydfaDeanvsls) exoio no4oltnmnes sfarrrum ou1tlenifciltfs2eln o;u4tlerir ootlaD livol( trxrxm nu1aleelfvs s aDtm(ro;o0tltnifeiytfm2ulnvo;(4 rtoxr3io1op  lieo t teur(m iudaltelivi ( a2rr(r ;u4aet io3iyd s rlnvsnu0 lerir3oa1fmDeaues (0texoimpoodlle mictls)aDuaum ;t0ole ifeiydlmDem(vpnu)aexriocoa1fa eaneo s  rtr(m oo4ame mfcs s) Dtm(r ot1tlxnmocildfm2ua(mo;t0tlerioctodoat  i i t)sexoim3nodllen neils artaumoou0teeniictytlm2umnvs (4aexrmrcto1lm  lieols srtoirpnu4lle miesat  Drr(m nt0teeoiiciat a2raump;t) eermrcoytopDr ueil() 2xrxo3iy4lpenlictas arta(rpot0altnifciyt a el(vo;t0altnir oydlm  aivols trtrim3oy4lmte ici t  rraurooo4aet ifciltlm uln o;(0aexnmf3todfateanvo s  etm(mpiy1apt lnci s sDtmur ;o0tpe ifcilsfs2uauvonu0tlenxr oy1om rau o t)srtmiopiy1om elfvtls)a2ur(ronu4apxnmieiydlaDemu o (0aeeomrcoa1optr nvol(  2urxopny4lmtnlfvilt sDrr(m no4tlx  ieildls2elnvp u0arxnir oa1oate nvs;t)s2uoio oo4altn nvilt)a2tr(mo;o4tet mfeiatlsDrm(vo (0 rermf to1la e uvs;( srtrir nu4open ies t s2rrxr ot4tetnmicilt mDea(msnt) lenxf3io1latrlnvo;(0srxmxopio1om emivs (  2rau ooo0tetn fcildlm elu p;u0treoifcoy1lm e ueols  exoxo iy1lpe  nvsatfs2tmumpot0teenifcilsfsDulums t0tlxomr3tadfp ran i (0 2toxmpoo4amenmnetlt)a2ra(roou1oltnmoeiydlsDum( s;t0 lxoxrcoo1lmtr nvil( t2xoxr oo1omee fvtat aDrru pnu0alt mo3tys mDran snu4aeenmocoadop rau o s)sexr(m3ou1llen feil(faruru pnt0open feiatls ean s;u4alermocta1fatrauvo t s2xrir oydolee fes () 2rmumo;o0tlen feiys m rlnms;()alxnmocoatlpt au o s0 rtm(r ou4ameelnvtat s2urxm ou0apeniociltfsDulums t0 exoiociytop elu i ()t2ur(r oo1lmtelnvi sfsDumxmpot4olxnmicils sDea(mo t0 rtnxf oydopteaneo;s0texoim3oo4alen feiat srrmxrpnt1opx ifetysfa2rl(ms (0 rerxfciy1fmteliei;s t2trirpnodaltnmiei t a2uau oot4tlxnmi3tlt sDrm( pn(0arenxfciadfpDe uei t0t2umio iy4omt mneslsf rta( o;u0oet ioetldfs el( s (0tlxnir3tydomtr u sls) rtrxr nu1lme  nciasfsrrmxrooo0aeeoiieiadlmDeauvp;t)trermr3tytlmt luvs t) eurim3nu4apt  fvils  2tmum no0opto fctadfa2um( pnt0 rxnmf tydlm e ues;s0setoiopou1open nvil(fs2trur nt0olt mfctld s2uan o u)tetrmr iydlptrlivs ()t2uoxr3iu1ap e ivsat) 2uaur nu1oexo feiyt mDul(vp;t4 rtrxf3ta1lm eli i;t)s2xr(o nu1oleelfei t s2rru pnt1tlxnmfctat sDeanvo;t4alxrxr ia1fmtrai i s)texoxr io4alenmivsatfartm( o;u1aetn ociat a2rm(vo t) exnir tadoaDranvi;t0 2umimpnudaltelicilsfsrua(m no4oleniieild m2ea( p;t0 exrmo3ootfp   i o;( tetr(o3oydomte nesl(f Dumur nt4aee io3tysls2em( o;(0 etoxf3to1lpDr ivo t0setrxr oy4amt mnvsa(  2ra(m ou0oexoioeiydfsDumnvo (4 etrmocio1la rauvolt  etmirpiodlpee ictl(fa2rmxmooo4oleoifetyt mDrmnvsn(4arerxoctadfaD an i t  2uoxr oo4lp  lfcsat)arurum nu1tle  f3tatlsDea(vo;u0 rxrir ootlm r uvolt)setmiopny1al nmics t) 2rmu pnu1altnmi3ias a eanms;(4 lxoxf iotla rlneils0t2xr(mpoo1lpenlicsas arrmx p;u1tpxo oeiadlmDrl( pnu0treomfcoo1lmt lieslt teto(r3oydlmt lnvias  2urx p;u0alx ifeiat m emnvs;u4areoir oo1fpDeaies;(0tetmxrpiy1al n fes t aDuax pnu0olxo i3ils mDem(vo;(4tlermociodomtelnesl(0 2trir3iy4llenlfeia()sDraxm nu0olxoii3ildfm2rlnvpn(0 ltrmf3ootlp  luvils0srtr(m3iu4ll  lncsas  Dum(mont0tpxn ieildls ul(vont)altrir3iadoa e u o t)texrio ny4omeelivt (fs2trxr ;o0tex mf3tas s2em( ont0 exnxo iytfpt li i s0s2ur(opnu4openliei (f rta( pnt0opeo ictldfs2rm(vont0 rtrmo ia1opteanvo;t)seurxm3iudlmt lfcta(  2rmx  ot1altomfciys aDrm(mpnu)tlenxrctadfpt ai i;( tetrxm iydamenlfet t s2taur ot0texo fetlt a2umumpn(4tlxrmociatlat liei;s s2to(opiu4olte nvs s)a2raxmp;t0opt mo3ild s2elnvonu0 exoxf3ty1omD luvo;s  exm(o nodaleemicta( a2trxrpot4tpxnif3tysfs rmuvpnu4 ltomfcio1lptrli ilt0s2tm(mpiodlp  lfvsl() Dtrxr oo1oleo i3ils m2rmu s u4aetrxf3oa1fp eaiesls0srtmiopoydamtemfvsas)s2tr(mpno0apx  feildfaDemn snu4tltomfcoytlp rlnei t  rxm(o no4lmeelnvs sfsDtrxm nu4tltnmfeilslsDrluvp u)altomo3ia1op e ieslt tetoxo oo4lme mncta(fsDtmxmono0aeen o3tlsfs2eluvp;u)tlenxr io1op eanvsls  etrxo iudole  fesas  Drax ono4olx  feiatls eau onu4 etrio3iotop   u i t texm(r3no4lpe  fvi (f 2tm( oou1tleoifciadfs2um(ms u0artoif iotfmt  u sl(  rur(o3iy1oltnmfvsat)sDrr( pot4oet if3ildlmDeanvp u)alerxo3oodfp  aies s t2to(rpio1op   fcil(f rtm(rp;o1apt if3ils a rlu s u)alxoio3iodlpt  ues;s)trtoxrpiu1olt  nct s)sDtmumoou1aee micilslm el( sn(0texomr3iy1lp   iesls0trxrxr3io1amenmies tf Dtauro;t4alt mo3iasfs2el(ms t4alxomf ia1laDe nvo;s0trxrir3nodope  fvias  2rm( ont1alen ieiatfsDuau s (4 eenxo3oatomtr nesls s2toxo iy4amte fvt sf 2rm(mono1olxnmf3iatfs2emumpn() renmf ia1opD lneil()setoxo iu4oltelfciat)artrx pnu0tltomieiat mDrauvo t4 exoxf iotoaD  n o (0s2xo(rpnu4omenmnetatfs2tm(  nt4olxnmfcils a eaumo u) ltnxf3oo1opte uvi;t0srxo(mpiu4ope  ncs s aDrmurp;t4ale mfeiysls2ranmp;(0texnmf oadla elnvs t texrio nu4ameemfcs s  Draur no4ole  fcilsfa ulumsn(4 eerirctydoa rli s;t0seurxmpnodlmte feiat sDuax ooo1oetn icils a2ra(mo t4 etoxocio1fat au o t)s2xrxo3oy1opeelivsa( arrrxmpno1oee ifciytfmDrmnmpn()tleoircio1lp  lu sl( sexrir iu1lltnmicilt  rtrxr ;o4tpeo ociadfa2rau p t0aeeoircoodfat lnei;(0t2xm(rpnu4lmenmfcils)srtax ono0texo fciydfs2umnmsnt0tltnmo todoa r neslt)tetriopoodalt livil(fs2ra(rpoo1tpe  feiasla2uanvo u) rxrio iytfpD lueol(0 2tr(r3nu1lp  mfet sfsDra( ooo1tee ii3iys aDea(vp;u0tlerxf3iodfmDr u i t0trxmxm iydll nmncilt)s2rau ono1ope moctadlsDel(ms (4aetoir3oytomD aneils0t2tm(o nu1altelnesa( arrm(mpno1tpxomi3tls a2ulumo;()aexnxrcoydopt liesl( srtr(rpoudlme licil( a2taxr nu0apto ocild m2emnmo u4 renmr3iydopD  u s;t s2um(mpoodlpt  ietlt)a2tr(rpnu4opt iicildlmDem( o t4 exnmr ta1lat lnvi;t0t2um(o oy1optnlfeias aDumuronu0opx mi3iytlsDeanvp t0 ltrmo3ia1omt ai sls)s2urxrpoy1opte nvi () rrrurpnt1opeo octltfa2uaumsnu4trerxo3oydfp eaivs t)s2toxmpiu1lle lnviatf 2uaxm ;u4opxn icilslaDrlnvs;t4texnxfciytlmt auvslt srxoxm io4omeemneilt artm( pnu0alxoiiciydlm emuvp u) rtnxfctotoaDeanes ( s2xo(o iy4lptn fvils) Dtm(  nu4oeeomo3iltls emu p t4 lxnmo tatfpDrau ols)srxrirpnu4om  mfvtat  Drmurp;u1aptniictasfm2um( p;()trtrif3iydlm  auesl() etoxrpny4lme mfct s  2trxmpnt4alxn f3tyd s rmuvs;t0tlxrxo3iytlaDrluesls) ruoimpio1apeelfet ( sruaumpou0alxomicild s2eau pnt4trenmf3iydla rli i s)srtm(opoodapte ivtatfa2rmu  ;u4tlt  ietytfmDua(vp;(0aexnmo oy1opDr neils0 etrxm ou4lptnmici (fsDrmu ooo1opx  iciatlaDrm( o (0 rxnir3totfp ranes;(0seum(o3ny1lm  mietl()srrr(mono4apxn i3tadlaDeaumo u)trermo3iadfp eaies (0 rxm(mpoudlm  mfvs t srurxrp;o4apx miciasls2eanms t4tetrmo io1fp rlu i;s0t2xoir3nodop  lict s a2tr(r nt4teenmo3tldlsDelnmsnt) lxrmr3iodlp e neo;t0 2xoxr3io4ol   ncta(f 2rmu  ou0alto ieiadls rl(mpnt)trermrctydopDrlnvols seuoxo3nu1amte neiatf 2umxm nu4ole mieiyslsDeanmp;()aetrxocoodoaDrauei;s0 etm(mpio4ame  ivs tf Dtm(rooo4tee  i3tadls2ua(von()alermr3todlptelneo;s texmiopnudop   ncta(fs2ua( pnu4open icild a ranvs u0arxnmrcoo1fmtelivslt setmim3ny4alenlneiat a2ur(rpot1tpeo icilsla rl(vp t0trerxrcia1fm eaieslt0 euoxrpno4amt lncslt a2tmxro;o0aet mo3tytls eau s;(4treoio3oatlatr ivols  exmiopoodom nmfetas)sDtr(  ;t4apto ictlt s rmumo;u4tleoif3todlaDeauvsls)seuoim3oo1al  lfvia(fa2raumpot1tpx iiciyd aDel(mp;u)aexomr iytoat  i i (0trxr(mpiy4ole  nvi t  rraump;t1olxnmf3iadla umuvs;()teeoxf3totoaDe i s;( s2uoir3nudame lfvtasf Dtmxmo;u4olxo feilsls elu o u4teeoxoctodomD  neols)texmirpou4am emietltfs2tmx ont4texn f3tad a uanmp;()trxnifcoy1fatrln ols0 rxo(m3oydoptn ivtat artaur ;t1aexnmfeildfmDrm( onu4trtnir totlpt au o;s0setmir iy4op nlnvil( s2rmxmpou0tpxomfciydfm2eanvsnu)texrxr3oy1lp r uvi s) exr(opnydomtelfvt s  Drmx oot1olenmf3tatfm2ea(mp ()aleomoctotfpt  uvilt  2trxrpio1ape  ivi s) rta(mono1olenmietldfs2rm(vo u) lxnxo oodopD luvo;t0srurxm oudameemfct t) rra(r ;u0oex  f3tlt mDuau on(4 exnmrctotfp  anei;t0srtr(r3nu1oltnlfvil() 2um(moot4ole moetlsls2em( o;()tlxrxocoytfp eaneo;s) rtr(mpnydaptemfctas) Drrxrpot0oetn fctydla um(mo t0texoxf3oo1faDeln i t  2um(mpou4openlivtlt)s2trx  ;t0oet  ietysfsDuanvsn(4 ltrxo oytlmt  ues t) eum(mpoy1am  mnvs s)a2umx  nt0optnmieiytls2eanvs;t)treniocootomD lu i;s0tetoir nudlmenmfesl()a2raurpou0aexnii3iadfm ean p;t)trerxoctodoat aueo (0 rxr(mpny4optelnci ()a2rmu onu0aptoiociysfaDemu snt0texoxr oy1fatrlivi;t)sexo(mpno4opee ici s sDtr(mono1open oeiltfa2rlnvsnu0arxoxo oodfptrai sl()t2trxr oydapt  neilt  2tm( ooo1a
\ No newline at end of file
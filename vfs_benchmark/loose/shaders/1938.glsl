@@ -0,0 +1 @@
+i s t0t2tm(r oy4omenlivia( aDtru  ;t0opxoioctlsfsDem( pn()tleoircoydop r nvs;( sexm(o ny4lm n netl()sDumxr nu4oex mfctys a2uanvo u0alenircoa1fmtranvol() rxm(o ny1lptnlnvsls  Drrxm ;u4tpxnmfetyd m2umumon()texrircta1fmt  neol(0s2urirpoudap n fvs t  Dum(rpoo1tpto o3tyslm2ulnvsn()tlxoxf iodlatr i ols0t2xoxo oy4am  mnvslt)arumu  oo0tlx iictldfm2rauvonu0tlerxf oydfmtrluei;s srurxrpiu1altnmieias)srua(mo;t0apeoii3tasfs2rlnvsn(0altrmo tydfp   uvsl()s2tm(o3iy1ope mfcsas arrrurono4aee miciytlsDuluvs t0 reomo3iatom raneo;( sexoir ny4lpt lnctasf Dta(mo;o1olx mfctat a ra(vpn() leoxr3oadfatelivi;s0 2uoir3oydamenmfctat) rrax oou1apxoiietatfa2ra(mpnt4alenmo3oadfpDr n ils setrxopny4lpte nesl( srrax p;o4oeenmi3iydfm rl(mp u0treoir3tatop  lnvi;s)srxmimpiydoptnmfct ( srta(r no1altnmf3iltfm elu s () ltrxocoatlm  ln s t s2xo(o3io1lltnlicsl()artmum ot4opt  oeiatfs elu sn(0tlxrxo3ty1fm e ieol(0s2xo(opio4oltelfvia(fsrurxmpou4aeenmictadfsDrmu o;()treomo3iotlat lu il( srum(mpiu1amte fes ( aDrmuro;o1tpt  fciys s ulums;() etomf3oa1oa ranvslt  2uoxo3oo1aptn netls  Dumxro;t1ape moeiat m2eau o t)aetnxrciatfaDrlues s seuoxmpny4lmee icslt sDra(mo;o0tetomfciatlsDel(vsnt4tlenmfctodfpt lnvols trum(o oodaptelfei t a2uau  ;u4texo iciyd s umnvp u0alenmfctadom   nes;(0 rum(m oo4apt micta()artaxrpou0olxoiietadla2ra( s () exomocoy1lp r ieo t trtmim oydlle mivtlt)sDuaxroou0ole mfctadls elu sn()tlxrmo ty1fmDrli i s) etmir3oudlpt  nviasfa2urumpot4apeoif3tldfm2umnmont)artnxo3oodomD  u i s)srur(m3oo4ope lnesas)sDtaur ;t0olxo feilsfsDem( on(4tlxnmo3iydfpD au s;(0 rxoio3no4lm elfetls)arrm(  ou1tpeoioeiydla2ra( on(4trxoxo iodfm eli i;()srxoxrpoy4alenlnvsl() 2tm(mont4altoii3ilsfmDuanms;u) eenio3iodla ean o s)setmimpoy1amtnmnviatfaDumu onu1oetn ociat s2rmnvs;()arxomo3oydlmt aivolt texo(o io4llee fvt t s2trxmp;o4tpeo o3tatfm ul(mpnt)aeeoxo3tytfa r uvsls  2tmxmpoo1lltnlneilsfarur(ro;t1oexomi3tatlsDeanvsnu) exnmr to1fm   uvi (0 2trxrpiu1am nlnvtas)artaxmono0aet  feiyslsDrln s;()trxrmf3oytlmD an s;t  rtoxr3nu1alen net s sDta(r ;u4oltomfcildfs ranvsnt)altomociydfa eaiei;s0 etr(o oo4apen ictls)a2ra(ro;t0olxnmfciltls rauvp;(0texomrctytfpD lies;()t2trxo3ny1oltemfes (  Dtau pot0aeeoif3tltlm2rauvon(4aeenif3ty1la   n ils)texo(o3nu1ol  mfvsl()sruaxr ot4tlt  o3iytls2ulumonu4aleoif tatopte ivils0t2xoim nu4opeemietl()aDrmu  ;u0opto ieiytls2ranmo t0 lxoir tytlate uvols)sexo(m oydap elieils a2umur nt0oexn feias m raumsnu4trtrmo ty1fatrlneolt0 2xmxopiy4ol e nvi ( s2tr(ronu1tleomfeilt sDumnms t4 etoxrctatfaD  uesls)t2urir3nu1lmeemnetl( srurur no4aetn iciatlsDel(ms;t0teermo oatfm elueo t0sruo(o3nudllt mnesa( aDrr(mpou0teeniociatfs2ean sn(4teermo3iydlpt  i il() ruo(o iy1ap n iesat sDrrurpnu1teeoii3ils aDua(vo (4aexnir iodfaD anvol(  euoir3nodlp   icslt) 2rmx  ;u4tpenmoctlt a um( p;u)trxoxr todlpDranvils trxoxrpoo1lmtnmncsl()srrr(ro;o1tlxnmieiatls ean snt4 lxnxr to1fmt li s;s  exmxo3oo1lm  mnesat arrru oot0oeeomoeias a2ulumsnt4texnmr3iadfpD ai s;t)tetmir ny4omtelneiatfarumumo;t1apeomi3iytfa rlu o u0arxrxocty1fm raieo ()seumxr nudll nlfvia()srta(r ;o4tlt io3iat aDrmn on(0tetoif3tydoptr i o;s0trtoim3iudllenliei t arur(r ;u4olxo oeiyd aDelnms (4alxnxf3totlmD  ieilt)s2trxo nodlptelivi s srum( o;o0aexn fcildfa ra(vsnt0alenmfcoydfptrli i s) eur(m io4ll nmneias)srta(monu0tleoifetadfsDrmu o;(4 ltoxf3oadlpt  nesl( s2xoiopnodlpenmnetlt a2tmum ou4oexnmi3ildfm rlnvs u0 etnir todopDean slt0 2tm(rpiydol n nci ( srta(mo;o0alxnio3ils s2ra(vont0tetrir3todla eaivol(0s2umim oy1ap n feilt) 2trxmpoo4aetnifeias aDrmn s u0alxnmf oydfm  au o;t)t2xr(r3iu4al nlnvtlt) rumumonu4tpx mfeildlsDelu o t4trenxr iytlpteaivol()seum(o no4lpenlfeiatfa2ua(  nu1aexoiiciadla um(mo;(0 renmo3oo1lmD  i ol(0 eumim iy1oltnlfes s) 2ta(m nu0aetnifeiydlmDran p;t4alxnmr3todoate neolt0t2uoxo3oo4opeelfcsl() 2trumpnu1oleo feils m elnvp;t4tetoifcoo1oaD li s s) rxrxr3nudomenlnvi t s2rmumooo0tpe ifctld sDrlnvpnt0 eeoxoctytlpteluvilt t2uriopoudamtn icsls srtm(mpou0tpxniieiysla rlnvp t)tetomf3iydlmDrai o;t  rxmxopiu4ameelnetls)aDtmu ooo1olenmociyslmDemn p u)areomr ootom e uesl() 2toim3io1amt  neia() 2ur( ooo1aex mictasls ra(vo;u)altrxo3iytlmtrai i;(0setoxr io1oltn fvtat  Drrur oo4aexomoeiaslsDel(mp;u4arxrxocoy1lp e ieols0 rumxr oodal n fcsas)a2tr( oou1oleniietytlmDuanmp;(4trtoxf3iatfaDrlnvo (  euoio nu1ll n fviat) ruaur ;u4opeoiociltla2el(vo;t) exoxfcootopD liesls trumxm3oy4olenlnesls  Durx poo1tee iiciysfa2ranmo t0alxrmfcoydop eauei;()trto(o nudlmtelfviat  2tmx pot4alx  ietltfa eln p t0tltnxo io1fpDr neo s0 rxoxo iudllee fet t aDraurpnu4tetn o3tatls2umu p u4teermr3oodla raneo;s srxoir oy4lpe  fvtl() 2urumpnt0ape  oetadlmDrl(vo u)tlerir ta1lpte u ils0teum(r3io4ap nlnctl(farum(rpoo0oetn icias m uanvp;u)alenircoydfp   nvil() rurio3iodalt  nei (f 2rmxmonu4tptomoeiys s uan o t4 lenmfcoatlmDelnvol() etrxm nydamenmiet sfarrax o;u4oleo i3iaslmDuluvo u) lxrxrctatfa eaivo s t2xr(r3iodop emict s)a2rrur ;o1opt ii3iaslsDum(vp;t4 eenxo3todlaDeauvs;s)trumim ou1lmtnlnei ( aDta( ont1alxn octatlaDra(vs t)arxnir3totfpt lies s trumim3io4amen fvtls  2rmx ont1olxo o3ias s2el(mp;u4arerxf3io1fa elnvo s t2xrim3iu4olte fci () Drrx  nu0olxo oeiltfs2uauvsn() exrxo3oytlmtraneslt t2ur(m3oudop  mfetl( aDtaxm ;t0alt ii3iat a2el(mo;(0areoir oo1op elivs s)trur(mpiudlmeelfcsa()s2raxmpnu4opx mociysls uanvp u4aexrxr3oatla eln i ( trumim3nu4lp   ics t  rraum ou1openmfetltfsDuanms;t0 eermocoodfmD anvi;t trtm(m oudaltnlivils)s2tmu  nt4alenmfeiadlm2el( snu0aexoir3ootfm ean s;t t2xmim3iydlmenmivias srrmxrp;o4olxo ietadla2ua( p u4tlxnmf3todoa eaivs t) 2uo(m3nu1aleelivsl(f 2tmxmont4tlt mfeiat m2uaump;u)texrxf3to1opteaues;t setmxopnu4optemfvt t  2tr(ro;u4olxnifeiasfa emnmp u4aeeomr oo1lateau o t0 2xm(o nu4alt  ies s sDua(rp;t1teen ocild sDranms ()trxnir oydomDrluvslt) exrio iy4ll n ieia() Duaur ;t1alxo iciadfaDea( ont4trtnifcio1fa ran sls  ruoiopoodoptemnvsltfartmxmp;o0tltnmi3tatla2emnms;t) lerxoctytomDeai i;(0 ruoir ou1oltnlieslt) rtrx  no1oleo fctadlm2uan p;(0tlerxo3to1opDraues;(  2xrxr ny1amt  ivt s sruaumont0olxnio3ils a2uln ont4altnmocootfm eaneils  rur(r io1alte ncias)a2taumo;o1teenmf3tlt mDemu s;u)trxnxr iadoptelnei s trumxrpou1ll   fei s)aDrrx ont1aptomieilsfa rlnvs t)tlxrmf3ty1fm rlues;t texoirpio1altelnet s)aDumxrp;t1apxomfciltlmDel( pn(4aeeoiocoatfpDr uvs;s0srxoir iudlme mnvi sfa2trurono0alt iociyslmDelnms t4tlxrxrcty1fp rluei s) rxrxmpiy4lp emnvta(f rua(  oo0tpxnii3tyslmDea(mo;t0treoifctydfmD  nvo;(0texoxmpnydol emncil( a2trur oo4oexo f3ils m uau o u)tetrxo3iadlpte n o ()srxmir3ny4lptelfvsl( sDur(m ;o1alxnifeiatfm2eln onu4aexrmr3oodfmtr uvils)srtm(m nydlleemnetl( srtax pou1teeoioetad a rmn o;(4altrif3oadom  luei;()s2tmxr ny4lltemfcias) rtru poo1aeen o3iasla um( snt0 rtnir todlaD  n ol( sexoirpiu4op  lieia() rur(r ou0opxoiociyd s ul( pnu)artnif iatlpDeaivsl(0tetr(r oy4am   ncsatfarrmxmpoo1oeeomo3tas sDuanvsnt) lxnmoctodfpDelnes;(0t2tmiopnydapt  fes ()arum(r ou4oet mo3iasls2uan p u)tleoir oadopteaivil() etoim iy4ap emfvsltf 2tr(m no1opxn ocils aDumumsnt)alxnxf3oa1la  aivils) 2xrio3oy4ale mieslt srumxm nt0oltn fetls m umnmp u4 eeomfcto1oat  n il(0 rxmxo3iydap  lfvsl()aDurxmooo4aexnmi3iasls eaump;t0 ltoxrciatlpDrlies ( seuoiopny4omtemfetl() 2ta(mp;u4aetoifciydlaDuau s ()teerxoctodoa   nvs t s2umio3oydoltnmncsl(faDurum ou4teenmo3iatfs ul(vs t)trxrif3oatfate u sl()s2xrir3iydlptnmnesa( aDtaumpno4tpeomieiltfm2ul(mp u4 rxoif oo1lpDraivolt  etr(mpnudal elieslt  rtaxro;o0tpe  ietad m ulnvsnu) lenxo3totfaD liesl( sexrxm ny4lpt licsl(  rrax poo0opt moetytfa2ua(msnt0trerir3iotop  luei t)tetoir3iu1ale lfvt tfsrraxm ;t1aptnii3ils sDrluvo u4alenir oa1faDranei s s2tm(o3nu1ap   nvsa() Dtaurono4aleomo3tasfaDel(vo;t4 rxnmo ia1fpteli il(0t2tmio3oudapenlncslsf Drrxr ou0oee io3iytls2ea(vsnt4tetrmf tadlpD  i sls)s2trir iy1olenlnvsls  2urx ono1tex  oeiadlmDuln s u4aexnio3oydlpt  i o s s2um(m3nu1ll n feil()a2rmumpnu1aeen oeiltfa2uauvs;u)tlxnio3iatlmt  ieo;s seum(opiydome  iesasf Duaxmpno1olt  ociydfs2ul(vpnu4treomf todlmDe nesls0srtm(o3io4optnlnvt ()sDraxr ;o4olen o3tyd s2rau o;t)tltnmf3ta1opte i slt  rur(o3io1ll nlnvs tfaDrrxm no0tleo ictytla2emuvs;t) rxrxf3iotfat ai ilt)t2uriopoudlle  fvsat)s2umu  ot1tpxoio3ilslm2ran p;u)teerioctadomDrai il()srxr(mpnu1llt  nci t) Dra(mont1alto fctltlsDumn p (4 eenif to1om eau ils) 2xr(opnudolt  iet tf Dumumpnu1apt if3iydlsDea( s;u)aetniociotfmDelues () rxoiopoudoltemfesltfs2umxmo;o0oltomiciysla ul(vsn(0arenxr3iatlm rauvi;( trxrxr3oy1olee ieil(  Dtr(  oo4ale  f3iasfs ea(msnu4tlxoxo3ta1lpDr n s;s srto(r3iudal elncias)a2taurpot4tlenmfctad s2umnmp;t)trtrio3ty1omt  ivols)trtr(m3oodol emivsasfa2tr(mp;u1tpe  ictasfa2umnvs t)texrxf3oodfpt li ils texm(opno4ll  miei s)artmxrpno1tle moeils m umnvo;u)alxnxo iy1fpt lueolt  rto(r ou1amtelfcsa()a2urx p;o1tlt moctysfa raumonu) lxnxf oydfaD lu s (0srxr(o3nodal emncsatf rrauroou1tpxomiciltfsDuau o;t0tlenxf3ta1faDran i;s0 2tmiopiydlltnmnvsl(  2ra(m oo4aptn feiydfmDuluvo;t4aetnxf3oy1lmte iei;(  ruoxmpiy4ol emfei t arumumo;o0tpxn i3ildfs2uan o t0alenmrciy1fm  ln sl(0s2urirpno4omtnlfvsas s2rm( oou4oetnmo3iltlsDemump u4 reomrciy1la r u s;(0 etrxm nu4omee nvsat)artmxrpno0apxo feilslaDrluvp;t)texnxr3oy1lmDr iei;(0 2ur(rpiy4ole mieils  Dur(m ot4apx mo3iltlsDum(mo;(4treoxo3oy1laD an i t) rur(m3io1lle mfvt tf Dra( pnu1tpto ociat a ua(vs;u0aetoxo3ty1fm  aneil(0s2umxm3iy4ape  ncs ( aDrm(ro;u1optomf3iydlmDum(monu0 etnir tadfmteln s t s2urxm ou4ope micils)aDraxrp;o0tetomf3iyt s emuvs u4trxnmr tytfm r nei s  2trirpiodlm e nct t) rrrxrooo1opxn ocilt a2em(vsnt) lxnio3iotlpteai i;t0srtoimpno4al nmfvsat sDrmxmp;u0oeeoiieiyd s uluvo;(0tlxoir3oa1fpD livo;t t2xmxm3oodolt  fvta( s2rmxrp;t1olx  i3tytlmDrlu on(0trtoir3io1oaDe ivs s0 rumxr3no1altnmivsl() 2rru pnt4tetoiiciltfm2umnmsn(0texoxr3iadfmD  uei s texo(r3iy4om  mfesls)srum(rpnt4tlxnmf3iydfa rlnvsnt0altrmo3iytfmtean o s s2ur(rpoo4lltnlneil()s2rauront0apt ioeildlsDuan s;t4tlxoxo3io1fmD  nvs;t  exmio3iu1ale  ncs (f Dua(rpnu0aetoioetadfs eaumo t0tlerir iydfp eaivols truo(r oudllte nvs t) 2taurp;o4altomfctytfs uan pn(0artnmf oodfat ai s;t)s2umxmpiy1aptnlnviat  Duaxr nu1tptn i3iytfm2ulnvp u0artoif ia1fm  lueil( trumxmpiu1am emfci ( a2urumpnt1olto fetldfs em(mp t0aleoxrcio1late uvs;() ruoirpou1oltelivtat aDrrxro;t0tlxnmociyslmDulnmp ()arxoif todfa eanvo;s t2tr(o oodop nmicsl( srrm( p;o4apenmi3ilsfm ua(vp (0arxoxr3totfm  livs ( sexrir oodolenmneiltfarrru  oo4alt mfctat m2emnvs;()tltrmo tadomDelieo (0 eto(mpoudome lici t srtau pnt4opxnioetldlsDulu on(4alxomr iytlmD livi t) exo(mpoy4ale  fcs (faDtmx onu0aee  icilt m2rm(vo;t4trenxrcia1fa e uei;s0tetoir ou4llen nvs sfartax pot1olen iciadla um(vp;u0aetrio oytfmDranvolt)srur(r3ny1op emnes (fsDraxmpot0aleoiocilt m ulumpn(4aetnif3iadfaDelueols0 etm(m3iudoptelfvsa()arra(rpoo4opto octyslaDemn s ()trerif to1fmDelneo s0tetriopno1lmeemfes t arra(rono4oleomo3iyslaDumn s;(0 rxnxfcoatomDrli sls0srtrimpoudop elivi t) rrr(r ot4aleo oeias s rmnvo;(4tltoxr to1om  livs ( t2uo(mpnudop   nesatfa2taxr ;u0olen i3tatla uau pnt) rxomociatfaDeaies;s)s2uo(mpny1apte ietat aruau pnu0oeeniietltfaDulnms u) rtomocty1latranvo t seum(opoodamte nctls)sDuaumo;u0apenmfciad aDrau s;(0teenmfciatfaDeluvi;s s2uoxr3nydamtnlfvtas) Dtm(m nu1aleo octydla2umn s;u4 exoxrcoo1omtraivs;s seuoxr3io4lmtnmfvs s)artr(m no4tlto ocildfsDrmn on(0altnmocoo1fpt  uvs;s0srxm(m3nydamt  nei t)srua(root4tpt iiciad a rlu snt0texrio3oa1fa   neil(0srtr(r no4ll elnviasfarrm(mo;o0oee mocils aDulu o (4tleomrcio1lat an o ( seur(r3nydllen iet () rtaxm oo1tet mietlsfa2ulnmont) exrxr3iodfp   neil( trurxr3ny4llee nvia(  Duax ont4alt ii3ilsfaDul(vo u4trtoxf iodfmDe ieo (0trurirpnudomen nvs () Durum oo0tltoio3ias a emu snu4 lxnir oatfmDelu il() rxo(opiu4ame lnctatf Drmump;t0aleomictys aDuaums;t4teerxoctydlatraueo;t srurim3oo1ameelici t aruru  no1aetomieiat mDrau o t)trxoxocoadfaDrau s;() exoio oodopenlfes sfsDum( oot4aexnioctldfm2rlnmo;(4tleoxfciydlaD li i;t0srtrio nydlpe  neta( s2rm(mono1aexn ociatlsDranvont4trtomr oytomD lu s;s0sexmxo3io1lm nmiesat)s2rr(rpno4olx mi3tls sDumuvo;t4 exomfcootfa   uvs t trtm(o3nodolenmnet t a2tr(r ou4aexo fetadlsDel( on(4 etoifctotlaDrlneo;t0t2um(opiu1omee fvta(f 2taum ;t1opx mf3tyd m2em(mpnt)tlenmocio1fp e iei;s  rtrxm nu1om emfcsltfaDrm(rpou1aet miciysla umu s;t4 rerxoctytoa  lueols0 2tm(o3nu1ol n icilt srrmx oou1ope moetls sDeau on(4altoxocoydlmDraivi s)teumxmpny4lpt lneiat)a2tr(rpnt4olxn feiadlaDua( p;u)altnir oadlpt anvs s trxm(o3iydalt lnetas)a2uau  ou4oetnmf3tatfs2emu s;() lxnmrcootoat li ol(0trxr(mpno1ameelfvtlt)artm(rono1opxo o3ias mDrlnmo (0trtoxo3oodfpDrluei;s)s2xm(r3iu1openmictas)srrax ont4ole  iciadlm rl(vpnu0arxrio3tatlaDe neo;s0trtr(opoy4lmt  fct s sruaxmono4ale  feiltla uan sn()teenmr oatlateauvsls)t2xm(r3no1ol elfct s)a2tr(mp;o4tptomociad m um(vo u) ltrmf3iadomt lies s) 2tm(mpio4apt mfcilt  2ta(  ou1tleoiieiysls ra(vpnu)treoxf ta1omtrli i s  2uo(r3nydlp nmneia(farurxm nt0aexn ieiadfs2umn s t4 rtomo tytlpDe neilt t2xoim ou4optnmnvi s) 2trx poo0alx mi3tatlsDel( pn(4treoxfctatla e n o;( trtmxr iy4amt mfesa(fsDua( o;u4aleo iciatfs umn s u) lenmf3oy1fa  lueols)tetrxm3ou4alt mnet (fsrtr(r nt0olen ieiyt a2uln o (4 lenif tydfa elues t)trumir3iy4altnlivtls  2ta(m ou0aetniieias m ua( onu)aeermo oo1opDr ieols t2tr(mpou4lm emies ()srrruronu0alxo oeildla2elu s;t4tlxoif iadlp  livi t) exmim3oy1oltnmnvtlsfaDtru pou4tpt  ietatfs2rm(msnt)alxnioctadlaDrln sl( teur(r nodll  mncia(f rtrurp;t0tlx ifciys aDemnvp;(0tetrmo3ta1fptelivo (0srxoxm3ny1ap n fvslt artrxm ;o4altnmfetltls el(vp u0 exrxfciydop r ivols0srtmxo nodal nlictl(faruaxm nu1olxo ietld s umu snu)altoiocta1faDran ols  rxm(r3nu1lme  iviltfs2urxmont1olxomfcilsls ua(msnt0 lxrmrciodopt luvs t) exoxm3oy4altnmfesl()arrax onu0oexoiieilt aDelnmp;t) ltnmo todfpDrauvi;s)sexo(rpiu4ameelfcslt  Duauro;t4apxnmieiaslsDumums;u)tltoxo oa1om e n sls0srtoiopou4ol elfcsatfsrurxmooo0olxn fctydla2emuvs t0altrmf3io1faDrlnes s)srxr(opiudome lncta() 2raxm ;o1tee mi3tlslm2rmu p (4 lxrxrciotopte uei;(  etoxr3ny4ome  nvta(f rtrxr ;t0aet iicias mDemuvp;() eenxo oytfaDraneslt0 2xmimpio4al   fcs t srua(m ;o4aee ii3iatls uanvs ()aetoio oy1fmDeau i;(0s2um(r3io4opeelfciasfsDumx o;u1tltnmoetas a2rlu pnt)trtnmr tatomt auvol( s2xoir3iydome lnci sfsDtmx pot4aetoifciltfs ul(vsnt4tetnxf3iatom eanvo;( setmxm iydam  livslsf rtrumpno4tpxoii3tasfs el(vp (0 lxnifciodfmDelivs;( tetoim3nudom  lnei t) rra( ooo0aex mocilsfa2umu o;(0trenmo3oatopteaueol(0 exoxo nu4amen nct s) Draur nu1olen oeiatls2um(mont0 rxrirciytlmtraivols t2xrxopiudal nmnes t  2rmumo;u0oeenif3iasfs2ulnmo t)arerio3oytfpteluvs;t s2xmxopiudamtn fcsat a2rru oot1alto octldla um( s t4aeeoxf tytopte u i s) rxm(m3oy1alt  ivt s sDrmump;u0oeeo ieiadlsDrlums;t)arerxf to1fp rlnvo;t seuoio3iydamee nctls srrrum ou4teeomf3iatfsDemu on()arxnircoodfmDeliei ()tetm(r3nydop e fetasfsrumx  nu1tle ifctadlm ea(mp;t4aexnmr3oy1lmDelnvol(0 2xr(mpiydale lneslsf 2rm( ont4tlx  feiad m2rmnmo;() rtomf ootomt lu ils  eumimpoy4oltnmiei t)aruax poo0tlx io3iadfm em(mon(4alxnio ty1lptrlnvs t0s2xoirpnu1lpenmfetlt s2rrxrp;o1aptnmoetltfa ran o (0 exrmo oo1oa   i i;(  rtrxo ou1ll   fcias)arua(rpnu4aex iieiatfm2ra(vs;t0 leoifcio1fp  auvs t0trxm(rpnydlm n nvsa(  2taurp;o1olen iciydlmDuanvp (0aexomf tytopDraiei t)s2xo(o3oo1lpenlfvsasf Duaxm nt4aetomoctlt a2ulu o;t4 etrif tadfpDrlnvi ( truoio iu4lle mncsl(fa2um( ont1tetnifcias aDrauvsnu) ltnxrctotla raiei s)seurim oy4om emfvs tfaDtr(rpot0tpxn f3tydlsDrmn pnu0 eenmr ia1op rlnei s0t2umirpny4lp e ictltf Dtaxmpot4apto f3iat a2rlnvp t4 rtnmr oo1lmt  ieolt  rxrim3io4optn fct s s2taxr oo4oeenmoctltla rl( p;()tleoxrcoodomDr i o t  2tmirpoudalt lfvsatfa2raxmp;o4oleniieiasls ra(vs;() rxrxf iodopDrlueo t)s2xrim iu1lltemictl() Drr(rpno4tlx  feiytfs2uln s t0alxrxociydfaDran ils srtmxr nu4ome  fct s) Drmxm oo0oeto ieiat a rln p;()treoirctydfp e nvi;s0t2uoir oo1ameelncil() Drr(r oo4tlx  i3iadls2el(mp u4 rxomrctatlm   nvslt trxmxopno1amt mfes (fsrrmu  ot1texn ieiat m2ul( p (4alxnxf oytfmt  nvi (0srtoim3oo1omen ivslsfarrm(ro;u0opt mocilslm2rlnmo;() ltnxo3to1oa   u sls0s2toxopio1aptnmncsa(farrrxmoou0aexoioeiadfs2ulnmp u)tlxrmocoodfat  nvo;s)setoim3oudomen ivt tfa2rm( o;o4aee mi3iasfa2rm(vo;(0aetomrcoa1lmtranvo;t)srxrxr3nydlmee fvi s arta(root1ape iiciyd m ean snu)arermr ty1op  luvol(  rtriopny1ape mnet t)sDuaxmono4oex mf3iytfs uln o u4texrmo ty1lp  aiei s trxo(r iu4lltemnvtlt sDumu pno0ale mfeiytfs rl(vs (0 lxrir oodfmtrli i t0sexrxrpiy4lme mfvta(fsDrrumpnt0oeeo fetat s ea(mo;(0 ltrxoctytfpDean il(0 rxmxm3oo4om nmivt ( s2tm(  nu1tle miciatla2eanvsnu4 rtomo oa1fmDeaivs ()trxo(r3no4lltnlfeiat) rra(rooo4olto f3iltlaDrau p u) rxoxrciydfptelneo ()trxrim3iodop e nvsls)a2rmxmo;o4texnmictydfa rmn snt4 rtnmfcoy1omDrlivsl(0seurxrpiodlp  mnci s)srrmumo;u0alt ioeiatfa ul( p (0 renio3oodfmtelieolt) 2toxm nydlmeemncia( srra(ro;o1tltnmieiysfa2elnvs t0trenxf oadfp  luei;(  rumxo3io4altemnvslsfaDuaxro;o4alxoif3iltla em( snt)tlxoif tydlatrluei s)trto(r iy1omtn fcsltfaDtmu oot4apt iieiytlmDra(mo;(4 rxoio3iadfm e i ols teumirpiodol   ivias sDta(rp;t0aexomi3iasfs2um( p u)tltomr tadopDe i o s0trtm(r no4op emfes ( a2urxm ;t1aetoif3ildfm2el( s;(0 etnxr3io1opDe i ols  rtrir3oudom e ivtl() Duaxmp;o1alto feild a2eluvsnt4tetnxo3iytfaD aieo;s) rxo(rpiydlmte fcia()srraxmoou1tleo fciadlm2emn snt0alxrif3io1omt auvo s) etmim iu4am nmncsl( srtr( p;t1apxnmf3tydfs ulnmon(0 eeomr3to1fa rlies;t)srxo(rpiodop elivsas  2rrum nu0ape if3tys s umu s;t4aetnxr3todfptelnvs;s)trtoxm nu1ol nlivi s sDrm(  ;o0opt io3tls aDrm( ont0artomr iytop   i sls) exmiopoy4altnmfvtls srta(rpou4tpt mfciadls2rauvp;t)trxnmf3iatfmDelnes;t) 2umir3ou4amte fei s srraxmpoo4tltomoeiat aDeln snt)teeoir oytlm rli s (  eumxm3nydoptemivslsfaDraumo;t4olenifciys a2rauvo () lenmf totoaD  n ilt0tetmir3ou1olen fvs t  Dra(roou0tet ii3tytfaDumuvs;()alerircoo1lp rlu o s0srxmxo3iy1lm n fct s) rta( pnu0oexnifciysfs em( onu4trtnxr ootlaDeli il() ruo(o3oydameelieilt) 2tmxm nu0olx ioeiasfs2eanvont4 renir3ia1la   uvs ()srxrir3ny1om nmfvsls)srrmum nt1alxomictls m2eau snu4trxoif3ootopD lu o () euoxrpnu4oltnlncils srum(mont4opt if3iydlm2ulnvsn(4arenif todfm rlu ils s2trimpoo1lm  mneta(  Drmxrono1tex mictltfmDuluvonu0alerxf iodlp  auvi s)trxoxrpny1op  licils) Duaxm ;t0aexomocilsfaDrmu onu4treoxf3oydfaDeanvi t s2xmim iu4ll nlfctlsfa2rmum ;t0alx mo3iadfmDrmnmo;t4treniociadfm  lnes;(  rxoio ou1lp nlnei t  2rrxmpnu4olt iieiys m eau p;t4tetrxf iadfmD anei;s0 rurir oo1om emnei ( sDtr(rp;o0texoio3tytfm umnmp;u4 lxnmf3iy1faD ln i t0 ruo(m iodamtemfcsatfarrmxmpou4opxnmociytfaDua(vo ()texrmr3iy1la eluvs t)srxm(opoy1ll nmnes () Drr(mooo1optn ieias a umn ont4 rtrmo todfm eanesl(  euo(o3io1opte ivsl(  2ta(  ou0tetnmoeiyd aDul( p;u0 exrio iydlptrauvi;()texrxo3iy4omt  fvtat sDur(r ;t4oexnmfctat a eanvs u0 lxnir oadfm elnvo;() rtmxopoudal nmncils a2tmxrpot4teeo feild m2rl(vs;t4 exoio3ty1oaDeaieils0sexr(m3iu4am  lfet sfsDurxmono1apeoif3iyd a rmuvo;t4aexrmf3ty1lm eaies;t0 2tmxm3nodapt  fvilsfs2ururo;t0tle mi3iysfs emn pnu) eenmrctatoaDr uvo;s  2tm(rpiodop elivt t aDtaxm ;u4aeeo feiydfa eluvs t) eeoiocoo1fp eai sls) rurim io1amtemfct sfa2ra( pot4tleomictadfs2umn sn(4texrxrcoo1la  an sls)s2umiopiy4alt lfetls sDra(mo;u4teeoiietysfs rlnvsn(0 exnio3totlpDrauvi;()t2tmxr ny4altnmfvs (  rrmx pnt1alx  iciytfs2elnms;t) reriocoadfp   i o;s0 etoir no1olenmneilsfsrrmu  ;u0aetn octltlaDrln o u)tetoxr oa1lmD  i ol( srxm(r no1lm elnvsl(fa2tmu pnu0tltniocils s2el(mp;t)aleoxo3io1fateanvolt)texm(opoy1lpt  nvslt srrmxrpot4aleo oetysfmDelnms t0tltnir3tadop elu o;s  2umxrpou1llt  feia(  2um(r oo0tltoii3tyd mDrl(ms;u4aexniocoodlmteai i s0t2um(m iydlme mfeil()srurx o;t4aptnmfeilsla2rlnvon() lxnio3oy1fmD  u i ()trxrio iu4lpenmivtlt aDrrx  ;o4apen o3ild aDum(vsnt4alxomf to1omtr ivi () exm(opio4opeelfviasfa2tr(moot0aetnmfcildfs em( p t0 lenxo iytlm raivilt0 rxo(o3io1amtelnvsa() Dur(mp;t1optniictysla2eanmpnt) eeomr io1fp elies (0sexm(rpoy1alee ivslt)a2ra( oot4altoiocild aDuaumsnt0artnif3oatlp   ieols) rtmxr oo1amtelfvt t)srrrumono1aex  ociatlmDuln p u4aexrxo3iatfmDeli ols)t2xm(opno1optnlivsasf Dumur ot4aeto ietas s eauvp u4aexrxr oo1omDelivs s  ruoxm io1llte ics () rtmum ot4apt io3iyslm elnmonu) lermf totfm   ueilt0s2tr(o iy4opee nvtl(fs2rmumoou1aptomfciatlaDrlnmpnu0 rxriocia1lm e u o;s  2um(m iydlm n iesa(fa2trxm ;t0apto fciat m rmumo u4tlxnif3oadopD lu ol(0 2umio3no4lltn icsl( aDtru p;u4teen fcias s rmnmo () ltoir to1fpDe i s;t)setmxo oudop e fcil( a2uaumoou1tlx mo3iys a2ranvont) ltomf3ootfaDeaivol()sruoim3ny4lmtemics t) rumxmo;t4apenio3tytlaDua( s;t4aetnxr3tatoa rli o s seum(rpio1omtemivsasfaDtax oou0oleo iciydlm umnmp;t)teeoio3tydfpt  u il(  rxmir3oudal emnetasfsDur(m oo0tltoiietysfaDra( p t0 rermf iatlaDranvi;t seumiopno4openmnvtasfsrtmx ooo0apx ii3ild m2uanvpn(0 rtnmf todopDr nvs;( t2xmio iy1lptnmies t s2rmxr ;t4tee ifciatfmDel(mpnu4alxrio iy1laDr ivo ()seur(o nudll  mnvsl( srrr(mp;o0oeenii3iyt a rmuvont) eerxf3iytfm  au s;t) rxo(m nu4lltnmnvtls sDrmuront4tleo ictlsls ua(ms;u0 etrmo3iatlaDraiei t  2xoxm oy4am   nesl( aDtrxmoot1opto i3ild m ran p (4altnmr3iotop eaiesls srxrxo3no4ole  iet ()aDua( ont0tlt iociltfa ea(vo;u) ltnmocoytfa e ies;(  rxr(r iudolee fetltfsrrmuro;u0tltn ieilsfs2uaumon(4alxomf oadla rlnes;t0seurxr3io1lmt  ies sfa2trur ;o0aex  i3tad s rmnmp u)texrxf oydlmt auvo;t0s2xr(rpou1lm  mivtls)aDrax  ot0oltoii3iltfm2emumo t)altnxr ty1faD  ies s)trtr(opiudlpte nvt ()srtaumo;t0aexn oeiatfs rlnvon(0aexoxo oo1fpteaivo s)seurxopoy4lptnlncsa(fsrtax pno4aee  o3tatls eln on(0 eerxrctadlmtelnvolt0t2xmio iu1opeelfci (fa2umumoot4ole mi3iadls ea(mo () rtomrcto1oaD  i ils  2umxmpiu4amtnlfei () Duaurpnu0teto f3iydlmDrl(vs;u0trtoir3iy1la eaivols0t2tmxm3ou4al nmfcil(faDtrum ou0tlenmocilsfs2rlu pn(0alxnmr oadlmt liei (  rtr(mpny1amt  ictasfartrx o;u0aetnii3ils s uauvs;u0 eenmo tatlmDran i t)t2uoxr3oy4ope miesas sDrm(mpoo1teeomociatfa2rmu p;u)trxnxr tytfa r n ol( tetr(r3oy1om n feil()artrxmpno0aleniociatla2rlu p (0teeoxr iotlmDe i sls)srtoxo3no4om  livi t)aDurx pou0tltnioctatlaDrmn snt0teenircoytlpDraivs ()trxoxo3oydlptnmfeia( srtm(mo;o4optn fcildls emnvs ()trtoifcoy1om  aivi (0trtrir3nodam n neta( aruaxr nu0texnmi3iltfa rmnms;t)texnio tadlm r u ils)setmxm3oo1altnmfvi t)artmx  nu1ape  ictls aDem( s;u4trtnio tatop eaieo (  ruoim nudame lfvsat s2tmumoou4oexo oeilt m eln o;(0 eerir3ty1omDrai o;t0 2xm(rpiy1ap nlnctls)srtru poo0opt  feiasla rmuvs;t0 exoxr ootfa  li s s0texoirpiudop nlnviat  2rm( onu1aexo i3ilslmDumumon()trtnmo3iy1lp  anvi s0t2xm(m3ny4lptnmnct ( s2rr(  ;t4tee mi3ilsfmDulnmp;(4tlxrxf3oa1opDrlueslt)s2xmxrpny4om elfvs ()s2ur(m ;u0tpe ii3iatfs um( o;u) lermr3oatlp eln o s s2trim3nu4lmen iesa(  Dra(moot4tet  f3ildla emu ont)tetrmr iadlaDrlnvi;t  rurir ou1lpeemnes t sDumxrp;t4tlx moeildlmDea(vsn() ltoir3tydlm rln i (0t2trxr nu4ap e fetl()s2rmx pnt1ole if3tatfm2rm( o u0tetnio3oo1oateau o t0 eurxr ou1al n fvsasf rur(m ou4olxo ociat m2rau o;(0tetrxr3oa1lpD au s t0sexoxrpou1lmtn ictas aDrrum no0texomfcildfm ul( s (4 eeoxf3iatopDrlu i;s  etm(m iudlmeelivilsfartmurpnu1aleo fciad s rlnvs;(4 lerxo3iadfa rlnvo t0trurxr oy4al nmnvt ( a2rr(mpnu4aexnmo3iadfs2ean p t4treomr3ia1fa eli i;(  2xmirpiu1ap elnci (faDumu  ot4ole  ieiydlaDemnvon(0arxnifcootfaD anvi;s0s2urim oy4ap  mivs t)aDrmum nu1tpx iietlsla2ra(monu0 exrio3iotoaDr n o s0 2urxr nu1lmtnmivil()a2rr(mono4tleomoeilsfm2ranms (0 ltrxo3oodoa eaivi;( sexoxopoo4lpe lnvsatfarrm(mo;u4tpeo feiyt m2uanvo u)texnmr3oatfmDrauesls)s2xoimpoy1aptelivil() rrax poo4tlto f3ildla uanvs;u0tltrifciytfm eai ol(0truo(opiodlm nlfctltfsDtrx  nt4tlxnio3iatfm ean pnt) exrmr iotlp e n i;t t2to(r3ou1llte ivsasf 2rm(m ;t1aetn ictas s2rln p (4texoxf3oytfaDrlnvol(0t2tmio iu4lmtnlfctas)s2umu  ot0ape mfeiyslm ra(vpnu4altnxf iotfaDelnvo;t texrio3iu4oltnlieias)sDuax  ;o4tpenioeiytlaDulu s;(0tleoxocoytfpt livs;t) rxo(r iydolte ivia()srurxmont0tptnmociad m ra(ms u4tlenxocto1fp r iei;s  2to(r nu1am   ncilt)aDurxmp;u0oetomf3ils a uanvp t)areriocto1fpD lnvi s s2xoxo iy1lmt  icsas srrrumo;o0apxo oeiydlm2ulu p u4 lenxr iatopt ai ilt0t2xrir3iudlltnliei s artr(mp;o1tet mfetasls2ranvo ()arxrmf iytomt  iei;(0 rxmirpiydll  mnvtlt) rra(m ;u0tetn ieilsla2uaums;() rtrio tadlpD  ueolt0trxmir nydllee nesls)srtau ono0aptn oeilsfa2el(mp;u0 ltomr3oytfm  livils0seurxo oy4alen ics () 2uaxm oo1olxo o3tldfs ra(vs ()trtoxrciodoateauvo;s)trurio3oydapt livs sfarrmxrp;u1oet if3ild sDeln p t) etomo ty1fmt lu s (  2toim io1ol   fvsltf Drru  oo4tlx  i3iatlm rl( onu)aeeoifcootlm raivo;( teur(r3iodomee net t  rtr(mp;t0oeen i3iytfsDel(vp;(0aeenio oo1omt  u i ()setrio oo1optn nei s  2tmx ono4tlt mictls s2eaumont0 exnifcoatlmt  u o () ruoirpoy1olenlfctat  Dtaumo;t4aetn feiydfa2eaumo;() eerxocio1lmteanes;t  2xm(opoudom emivilt)sDuaumpou1opxn f3tas s ulumo;t0aeerir3oa1la r nes t)t2tmxmpio1am nlies ( sDumum ot0oet  ieiadlm2ea(mo (0arermo oo1opt liei ( trumio io1ap emicslt sDum(mono0apx miciytlsDum(mont0 rxrifcoo1fpt liei;t0trxo(r iu4lltnlfcsas)a2ta(mpot0aeeniieiltfs ua(vs u0tlxnio iodfptraies s0t2xoxo3oo4ll  mfcsas  Dra(r ot1olto octasla rauvpnt)artrxocoa1fa rluei s  rtrir nudlle lncilt) rtmx pot0alx mfctlsfaDel( o (0 rtnxo io1fat  n s;()t2tmim3io4olt lfvt tf 2taum nu1tpenii3tytls emn on(4artnmocio1lp raieo (0t2umxr3oodlpenlietls)sDrauroou0tlx  i3iat s el(vs;u4texrxr3iy1optranes;t0srur(m3iodam  mfctat)aDua( o;u1alx  ictad m2rmnmo u0tltrircoa1opDelu s;()tetmiopnodol emnct t)s2urxmpou0tltoiieiaslsDrm( pnt4trxrxocia1omt aivo (0setrxo oy1olenlicsl( a2raurpot4teeo ictyd sDel( snu0 rtnmo tytomD anes s t2triopiudomee ncsatf Dra(root4tpeoio3tlt s um( s;t0treomfciytoa eaiei (0trtr(r iy4ap nlnes () rtax o;o0olto ocilt a2eau o t) rtnxo oadfat auvil()srxrxmpny1aptnlncilsfarrau  nt0olxomfciyd m ea(mpn(0artriociodopt  nvsls) 2uo(mpiydol n ieslsfsrrmu poo1tpx ioeilt s2ulums ()areomr3io1fmDe uvi;t0tetrim3iu4altelnvsl(f 2ra(  no1opxnmiciasla2ulnvp u4texoxf oatfmte ieol() 2urxmpoodole mnesat s2raurp;o1ape mociytlsDra(vp;t0artnmfciytlpD anei ()texm(opnudam n ictat sDua(m ot1tetnio3iatlm em(vonu) rermo tatlpDraneo;(  rxm(mpny1ap nlfvsas)srrm( onu0apt iieiltfmDelnmo;(0trtnxr3iatfmte ueolt0srtmim nu4apeemnesa(f Dtrx oou4opxo ieiydlm2uaumpn()tetoxr to1op rluvi;t t2um(o iodopte fci sfaruax pot4ope ioetadls2rmuvs u)tltomo oo1oate uvs;s trumirpou1lptnmnetasfaDrmxm ;o4opeoio3tld mDrlnvsnt0 rtrir oy1faD  i i () euoxmpiy4optnlivtat s2tr(  ;t4oex  i3iysfm uauvpn()teermocoy1optelu sls0srtm(m oodll  lnet t)aDtrxmpnu4apx mo3ias sDrlumo u) reoircoatlmt lnvo s t2uoxo3nu1apen nesls) rrmum nu4tpenioetadfm rlnmp;t0 etoir3tytfmteaivil( setoim ny1ome lfvs s) 2umu  ;o4optomi3iadlm2ra( p u0aexrxocia1opD lueslt s2urxm oudal emfvta( srur( pou1tleomo3iydls2uauvp t0 leomr tydlpD livs;(0texmiopoy1lmtnmnvil()sDtauroou4tltn ietasfm rmnmont4teenmrcto1fat lueolt) eumir no1lm emfcsa(fsrrmx poo0oleniociysfmDelumsnt4tetrmfciotla eau i;s)sexoxm iu4alt lfvilt)sDumxm oo1aetomf3ilt m umn s (0trtoif tadfmtrauei t0teurxm iydlmeemivias) rrrum ;o4tpto oeiyd a2ul(mont) ltomo3oa1fatrluvo s texmio3nu1olt  ivi s a2ra(m ou1tlt  ieiys a2uan snu) rxrio3todom rlu i ( truoxo3oudll e ivslsfaruaxrpou1tpeomfciyd m um(mpnu0tltomr3oadfaD li o;t0 ruoxo3no1al nlnct s  Drmxm ot0tltoii3iyslm rl(vo;t0aeenio iatfpt ai o s  rxo(r iudomt lietat) Dtaum ou4tpxo oeiys a2elnvon(0teenifcoodfm rlu i s0 exrxo3ou4lmt mieia()aDurxro;u4teenifeiadla em( pnt)artrmf tydfaD  uvo ()setoim3no1amen nei tf Dra(ront0opx iictatlm ranmo (4tlxoifciy1lpte ueols  exoxr3nodapen net tfs2rmumonu1tpe  ieiyd m ulnvp u) etomfciytomDrlnesl()texmxm iudoptemici s arumxroou0alto oetadfm ranvpn()arermo totlpDeauvi t  eurimpio4open ict t srum(  no1apx  i3iad a2rm(monu0alxrioctadlptelu olt seuoxo nydol  lict tf Dur( p;u0oexo ictld a eln p;(4alxoio iy1faD ln slt) 2uoxmpny4lme lnct s) Durxm nu1oeto feiatls el( p;t4artrxo totfm rauesls) rtoimpiu4amen neil(f rtmx ono1oexnmiciadls ua(mp u)tlxnxocoa1fpD  i i ( tetrxopnydamteliesat) rur(ro;t1aetn o3tydla2ra(ms () lxrxrctydfp  anes s0 rtmxm3nydam nmneslt)arum(mpoo0opxnii3iadfsDeau s;u0aeerxf3oodoaDrai o s0seuoio3iudoleemictls) Dtax pnt4oeto ociat a2umumo;(4trxoifciotomt li olt)trumim oudolee fvia(fsDumuro;t0teenmociyt sDra( s t)alxrmf oydfa rlies;s)trxr(r3nodolt mivi ( artm(r ot4tpt mfeiyt m2eanmo;u0trenxf io1omt lieo;()tetoxo oy1alenmnvtasfsDua(  nt4oet  oeiatfs2rmnvp;() ltrxrctotfate n o;t trum(m3iu1olee nvi t aDumxrp;u0oltoiietlt a2uau snu) lxnio3ootfm eai o;t0trtm(mpiydamtnmiesat) Dtmxrono1oetoioeilt aDum( p;u4tltoxfctydlp  livolt trtriopno4lm   ies t)aDrmumpot1oexo o3tyt mDea( snt)aexrmf3oa1lpDrai ols  exr(mpiu4omee fesatfaDumxrp;t0opxoiociasla2eluvs u4texnio to1om eli s;()s2xrim3oudlme mivslsfaDtmu  nt4tlxnioctydfm2umumpnu)tltrio to1lm rlues;s)trtoirpny4ape lietl( s2tm(r nu4apt ifciadls emn p;(4 eenio ty1lpDeaieo;s0srxm(r3nodalt lnvta()aDta(rp;t4oeeoifetyd a ran o t4 lenxfcoy1lmt lneo;s  euoxr io1oleeliesa( srtaumpot4olt ifctldfm um( snu)tlxnxo3todoptr neo;s)trto(r3nu1lmenmfcslt a2uau ono4oltomoeiatlm uauvp;t4aexrmfcto1lptrlnvo;t  rtrxrpoy1omenlnei ( a2uaxm ou1aexomietas s2uaump;(4teenir3oytfaD ln s;t)tetr(o iy4ol  lfvia() Drmxr ;o0tpenmf3tytfs rmn pnt4 leoxr3tytoptranes;s t2xrio io1opt  nvtl()aDuru pnt0opx ii3tldfs rmn o;(4 exoirctytoa e ues;( trumim iu1lpt miet s)a2trum ot0tleomieiltfsDrlumpnu0trtrmf ta1laD an o s t2xo(r iudameeliesa() Drm(r no1opx mfeilt s eau s u) rtnifctytlpte ueo;t)s2ur(o nu1ale livils)a2tm(mp;u4oexnii3iadla2ranvs;t0tltnxr3oo1omt  n ils0tetrirpoodop emfvtasfsDumx poo1olx iieilt m2em(mo;t4aexrmo oa1oatelues ()srxoir3ny1am   ies s) Dtmumo;o4aet mieiyd s eluvsnu0 exoifcoydopDraieo t0 rum(o oy1alenmnvsa(farur(rono0tetoiiciadfa ra(mp;t4teenxfcoydlpDe n i;t)texoxmpny4apenlfetas  rrmu p;u0teen i3iydla rluvs;(4tetoxo oatfm  ln s ( t2xrim3nudom nmfesa() Dtax o;o0tle  fciasls emu p t4trenircoy1oateluvols  rtrir3nu1ll emnetas)a2ururpou0teenifetldla2rmums (4trtnxr to1op  aieslt0 2um(o ou4omtemictl( a2taxroou0aeen i3iytfm rmn s t4aetomr3iadlaDe ivilt)sexoxmpiydom elfvi ()aDtau o;t4opt  f3iltls2rlnmpnt)trtnxo iy1fa ranvsls0s2toxr3ny1lleemnvsat arra(  ;o4tleoioctytlm eanms;u4 lenir ootlaDrai s;s)trtrxopoo1omenlnct s) rrmx o;t4oltoifetyd m umnvo;u)texnmr iytlmt  ueils s2xm(opny4altelfcsa(  2raxmp;u0aex mfcilt mDemn snu0trxnir to1laDeai ils0 2uo(r nydopt mnvt (farrmx  ou1tetnio3iydls eaums t)areomfctodoate ivi ()t2xmxo oy1open nvi t)s2raur nt1tee ii3iydfsDrlnvp (0tlerxr iodfp   n s ( trxo(rpno1lltn ietlt)sDra(mp;o1tee  oetld aDuanms;u0aetoif3ia1lp rlnesls) 2tr(o ny4amtnmiesas)sDurxr ;t4texn iciydlmDel( snt)tetrmoctytlmDeaies;t0texmxo no4optn fctas arrmu  nu0tlx ii3iasfmDulnvsnt0tltrmf ty1faDe ueslt)t2tm(o3no1ap  lfvsl()s2ua(  nu0aetnmo3iatfs rm( p;() lermf3totom  aiei;(  exr(r3io4ap  lncilt  2tmumpot1tlt iiciytls2rl(vsnt0teeoxo3iodfpDe neil( trtrxm3iudal nmfvs s)aDra( onu0oleomf3iys a umn sn()tltoxr oa1op r ueo;(0teurimpio4llt lfeilt) Dtrumono1tetoiietltlsDrluvp u0texoio iotfmDrau o;(0 rtoxo iu1oltn nvsa(fa2tax  nt0teeniictytfs emums t)aetnif3tytlp eluvs;t)texmxo3oydolenmncsas  rta( o;o0apxn ietlslaDuluvont)tlxrxrcoydlaDeluvi s)trxrxrpou1amtnlnvtas) rtmur ;t0apxn ietydlm umn p;u0teenxf iatomte nvs ()t2xm(o ou1omenmnci ( a2uaxrpou4tle iociatls2elnvsn(4 eerir ta1la  luvs s)s2ur(o iu4opt mieil(  Dtmxmo;u0oetoio3iyd a2ul(msnu0 reomfctatopteaueo t s2uoirpio1lp n nei t) Drr( pnu0teeoiociat a2eau p;u4 etnmfcia1lmtrlnesl(0seum(opiy1optnlfvsas artaumpoo0oexnioeiasfmDul( p;(0aetoxocoy1opDranvo (0teumxmpny4amen ieilt)srraurpot1opxoioeiyslsDrl(vp t4 exrif3tydoaDrluvo;s0texrirpny1al nmnetas  Drm(rono4apx io3iadlaDem(vo u)tetoirciy1lateanvslt)s2toio no1amt mfcsls) Dta(m ot0oetn ieildls2el(ms;t4 lenir tadoa   neo t) exmim3ou1lpe lncils)sDtmurpou4teen octyslsDulu p;(0arxnirciatfptrli o;(0trtoio3nodol e icsa(f Drax p;o1oltn o3tyd sDulnvp;u0aetoxociy1omtraueils)texo(mpoodlpe mnes (  rrr(m no1tet  i3tasfs2em(mo;u) ltrif iytfmDrlneo ( srto(opnu1lpee fci tfaDtrurp;t1oetomocild aDulump;u0tlxrmo3ty1opD aivi;t0sexmirpoydamtelnct t) Drmuronu0tetn octys mDean p;(0trtomf oa1laD ln i t)t2tm(m3iu1lmenmncias)aDtrx ont4olen oetysfa elnmo (4trtnmf oadfpt  ies ()setm(m3io1op   nvt t)s2ua(m ot4tlxoiociltlm2rmuvo;u)teerxfcoodfaD  uvi;t0sexmimpoodomt mfctltfsrrrum nu1teto fetadfm rlnmsnt)treomrciadoat  i s;s  etoxmpiu1optemiei s) Dua(mp;t4alen oeiltfm2emums;t0aeenmr3tadoptr i il(0t2xmxm3iu1olt mivtls)srtaxmonu1aetomietat a emumo;t)tlxnmrctodlmte nvs;t  2ur(opou1ol  mfet tfsDrax  ;u0aex  i3iltlm2ul(mo;(4 eerxocoydfaDr ivi;()texoiopno4lmt  nvsls a2trxrpot0tetoioeiyslsDrmnvs;u4tlermf ty1oat  iesls  rtrim3oo4olen ietasfs2uau  oo0teen ictlt a ulu p;u0aeerir3iytomD lneol( truoir nydalenlncta()s2rrurp;o0tpx  o3tysfs eau p;t)teenio3tydopDrau s;()texoxm3iy1optemnviat) Dtr(r ot1oet  ietytlaDranvp;t4tlxrmr iytfa r nvi (0trurxo oo1optnlnctl(f rrmuront4aetnii3tltlsDrlnvpn() lenxociodlm eaivo t0s2umirpnudop nlnei (fa2tmumont1ope io3ils m2rm(vs u)aetrxo iadfmDr i s t0 etrirpnodlm   fet s)srrau pnt4tlen feiytlmDulumo (0 eermfciy1omte nvs;( srtoxm oy4aleelfvilt  ruax  nu0tee  o3tyt a2raums u4altnxf oy1oaDe n s t0srxrir3nudalt  nvsat a2ta(ronu4aex mfciatls2eaumsnu)arenxr io1lmt li o;t0texoxmpou1omtnliesa()aDuax pou1alt iietlsfaDelnvs;u0 etomrcoatoa r nvo;s teumxrpoudlle  nctl(fartm(  ou4texnii3tat a ra( p;(0arenxo3iatfaDr uvsl()t2umxopnodomen nesls aDraum ;u0olenio3iysfm2um(mp;u4alxoif3iadfaDrli ol(0 rxm(m3iy4lltelfes t) Drmxm oo4aeeomo3ilsfmDra(vp t4 etoirciydlm   u o s0 etr(r ny4altn nci t)sDuaum ;u1apt ioetatls ra(vo;u4 rtrxr3todfateauvi;s trtmxrpiu4apee nci ( arumu oot4oexniietadla elnvon(0 lenif iatfp e nei s)truoimpoodlmtnmfvtltf rtaur ;t1oetn oeiltfa uluvp;t0 eeoxf iotopD lnvils srxoxrpny1opeelivs sfsDtaxroot1oee moctydfa ulu o;t4 rtnio3totfa ran o t0sexoxopio4apt mfvi t a2um( poo1apeoifeiytls2rlumont0tlxrmf3to1fmtranei;t  rtm(m iu1lmt mfcsat arrr( o;u0aexnmfeiyd mDulnmpnt0 eenif oytoaD lnes;s)s2uo(m3iu1ape  icias)sDtax pnu0tpxoifeiydfmDumnvo;(4 etnmo ty1om   u o;s)t2xmxm3iudom  lieiasfaDurxronu1aet moeiltls2uanms t0aexomrciatfaDr nei;t t2urxo oo1lmee fcta( sDuaum ;u4oet  o3iytlm2ra(mo (0 rxoxf3iotoptr iesl( t2umir ou1alen nviatf 2ua(m ;t4optn ietatfa2umn p;u)trtnxr3io1fmDraues;t)trtmxr ny1omtn ncsatfsrtrxr oo0olxo o3iyt sDranmsnt4trermf oy1fp  lieol( sexo(o3io4lmt  fvt s a2taumoou0oee ioeilsfs umumon(0arxrif3oydop   i s s  etrir nu4lmtemiciat) 2tr( p;t4tee  f3tldfa2uauvp t0tlenmocoatfmtr i sl()texo(opiydaptelnviat) Drm(ronu1oet mietydfsDulums t4 lenxr3oy1oa ranei;s)t2toio iydlpee fcsa(fsrtru ono1aptnio3iasfs2uau s;u4tlenio3iy1fp rauvsls0 rxmxo3oydapeelnvtl() 2raxmoot4opx mo3iltlsDrluvs (4tlxnio tadfpDrli o ( seuo(mpiy1ol  lfcslt aDrax  no4alxnmf3ilt mDeauvpnt)aleoir ty1oa r ueilt)srtrio nudapt mnciasfaDrau  oo0tpeo ociadfm2ra(vs (4 ltrxf ootopte ueil()srxmio iydlmeelfeiat)s2um(mont0tpxnmiciytfmDeaums t4tleoxf3oodomDrli i;s) 2uoiopiu1llt lfei t  2umuroot1oet  o3iltlaDelu s t)alerir ty1fm  anvo;()seur(o nu1optelfctlt aDtrxmp;o1tleomociyd aDrmnmpn() exrir3oy1oaDe n slt t2xm(rpiy1optnlfvi s s2rmxmono1apx io3ildlm2ranvsn(0 ltnxf3oadlatelies;t seur(m3oy1apt mivsatf ruaxmo;o1ope iietasls2ea(mp;t0 etrxr oo1omtrln s;s  rur(o iudll nlieia(f rta(roou4oexo fciasfa rl(msnt0alerxrcoodfmtelu s;s0 2xmir3oudomt livs s  2tr(m ot0ape ifeiltls rmu snu4alxrio3ootoatrlu s;s trumim no4al   fvt () rrmx pnt0ape  fctlslm rln pnu)tetoxf3iatop ran sls trumim3oy4lpte nvsat) 2rr( pno0optn o3iltlmDuluvo;u0artoif iy1fp eln ols  eur(r oo4amee iviat) 2rm( p;t0tle  oeilt a2rln p t0aexoifctodlaDeauvslt0texr(opny4ape lnvsls  2tr( ont1apxoiieiyt sDua( s u4tltomf3iodfp e uvsls)sexr(r oy4oleemncilt)srtrxrpoo1apx mf3iadfs um(mpnt4arerxrcto1om eln s ()t2xm(r nydop nmnciasfs2tm(m nu1olx  ictytfs em(mpnu0artrifciy1lm eanvil()trxmim oydaltnlfeiltfaDrm(r oo1ale mf3iatfa2rm(vonu0 eeoif oytfmD lu ils0texo(o3iodom  mnvt s sDrm(mpno4alxn f3iltfaDeau s u4teeoxociodoate nvi t)sexoxm no1ope mivilt) Dua(rpnt1tpx  i3iltfm rlnmonu4 renxo3oatlatr iesls) 2toxr iy1lmtemict t)aDrmumono4ale moetltfmDranvs;u) etrxr to1fmt  ivi;t0tetr(r io4lpt licil(faDtrum ;t4tetn fciytlm rm(ms t4trenxfciydfpD auei s  rtmiopoydopeelfcs sf 2tm(r ;o1teeomoetldfs2rlnvsnu0 ltrir3oytomte uei;t0s2toxrpno4oltn ieta(f 2raxmo;o1oexn octltfa2em(mon(4aeenir3ia1omD  uvi;()setm(m3no1op n nes s)s2rm(  ;o4olxomfetytlaDrmnmpnu)artnxf iy1fmteaivs (0 2urim3oodlpt mnvia( s2trxm ;t1oetn f3iysfa rlnms t0 lxrio tydfat  u o;() rxoir oudlmtnmieta(fsDrmu poo0apen octat s emnvp ()teerxfcto1fp  lnei;(0sexo(m3ou1am  lfesl( sDumxmpot1tltomi3ild a emnmont4trtrmr oo1lat  uvo;()t2uoxo3oudamtnmncsa()a2uru  nu0alxnmf3iltls2elnvon(0tetnmr3iatlmD aueo t0texoxmpoo4lptnlicilsfs2umxm nt1oleo fcild sDulu o (4tlxoif3oa1fpteauvs;s0 rur(mpiu1lmenmfvt ()sDrru pno1oeeoioctys m2ua(vp;u0artomrcty1fa e uvols)setr(m3iu1lm  liet sf Draurpno4texomo3tatls2ulump;t0trermo3ta1fp  au s;( s2tmim3oodop n ncil() Dta( onu1oet  octldls2rluvpn(0trenir3oodoatrluvol( srurim nu4al  licta(fsDrr( onu0apenif3tat s2elnvsnu)aetoxo iodfpt lu i;t seto(m oodlmenlnes s srrmu pnu4ope ioeiat s2emnmo u4texrxf iodom  luvolt  2tr(r nydopeemfeilt sDumx p;u1tlen octasfa ul(vsnu4altnxf3oodopDe i olt  rtmim nodlmt lfcsls)arumurooo4aptoio3tlt aDemn ont4tlxomr3oy1lptean ols0srtmir ny4openmivtl(f 2raxr nu0aptn ocild mDuln p;u4 rtrio3ia1lmtr u i;s0t2um(m iydamt liesat)sDtaump;o1olxniieilt m rl(vpnu4alxnmr3tatopte n s;t s2uo(r iudll nlfetl(fsrrm(m nt1ale io3tytla raump;t) etnirctydfmDranvs;( setrirpoy1opee ieta( aDua( pnu1tlenmf3tatfs2emu sn(0tleoio3iadomD an i;s0srxoir3io4al elfeslt s2uaur nt1oexn ietysfa uanmont0aetnxociotfp   i i (0setoxr3io1amee ieias)srrau  no4alxn fctls a rmu s (0trtnif3oadoaDranvi;t texo(rpno1ll n nvs s  2tmum ou1oex iicildfmDrl( s;u4areoxr3iadla ean ols)s2urir iy4lp emfetlt) 2rm(r ;u1olx io3tydfm2rmnmo;()tetomo totlmte u o;t setoxr3iy4amtn fet s)artru  no1tpe iieiatlsDrlumont) ltnxo3oo1laDrli ol() etr(m3nodoleelfeslt)sDuax onu4tlenifeiltfa2rlnvsnu0aexrir3ia1la raueil( t2xr(m3io4lpt lfes (fartmuronu0oetn icildlaDum( p;(4teermo tytfp  anei t teum(r3ny4aptnlietlt)artaxr ot0aet ioeiysla emnms;() exrif3iytfm e nei () exmim3nydomtemivi ( aDta(ro;u1opxniicildlaDuaumo;u4 ltrxr tatomtelueols)s2tm(opiu4lmeemnesat arrmx ooo4tpeoiietasls uau o;u)aetrir3ty1oaD li sl() rxrxopny4llen fesat)arur( o;u0tetnmi3ildfs2umnms u4alxrirciotfat aieil() 2xmxm3ny4om   iesat)sDur(  nt0altnmfeiydfs rlu ont)teeomocto1lmDean sl( trxm(rpnu1apeelnvtls) rurumo;o0apenio3tlsfaDranmon(0 rxniociatlpt ai o s0srurirpnudopeelies (fs2rr( o;t0tptn f3iyd aDumumpn()artrir3iydfaD  uvi;()t2xmxo3no4lmt lnetlt)sDumxmono4olenmi3ild aDel(ms t) rtrxf oy1op   i i;() eto(m3io1aleemiei tfs2rmx  ;t0tle mf3iatls2uau on(0tlxoxf3iatomDelneolt) rurxm ny1ameemivtls) 2uaurpnt4tpxnmieiytlaDelumo (0trxrmo3oytop r nes;s  2xmxrpny1lm   nvsl(f 2rr(ro;t1oetniietlt s2uan s u4alxnif iy1fm e i sl(  rur(m no1lmtemncilt  2rmxrooo0apto oeilsfsDum( s;(0 exnif oa1fm rauvs;t0 rto(rpno4om emivtls)srtax pnt0apxomo3iydfa ua(vs t)tlxomo3io1lmDr ueolt0truo(m iu1amenmivtl( srumum ;u0tlen ieiatfmDrl( snt4 ltnmr3oytfp  ai sls)srum(r iy1oltelfeia()s2ta(mpoo0ope ifcild m2em(mp (0aexomo oadlm rluei s0srxm(m oudlm   fvsl()srurumonu0olenmf3tytfs2rmump;u0trxnmr iatop r uvolt) 2um(o3oydal emncs s)srra(mooo1olxnmi3tyt s ea(mo;u)tltnir3iatop eau sls)setmir no4llen ivsls  rtmxrpnt1tlxoii3iytls2rau onu0teenir oydoptrauvilt) etrio3iydal emnviat sDtmuronu1oex mictysfs2ea(mont0tlxnxrciodlmte nvolt t2xoxopny4am  lnvtas aDraumont1teen oeiytfsDua(ms;(0teerxr iatfpD  neo t0s2uoxopnodom   ies t  rraurooo4aptoio3ild a umu s;(0artnmr oadfp rli s t s2umir3iydlm   ncs s) 2uaxr oo1openioeilslaDuanvsnt0 lenmf tadlp  lneo (0seumirpiy4lpeemnvi s)s2tm(moot4tex ifeildla umu o u4alerircta1fmteanvi;s) 2xoxr3nu4ol   ict t  2rmurono1tee  feils s uauvs;() ltoio3ootfpt luei t) 2xm(opou1om emnesltfs2urx pot0aexoioetatfaDrlnms t4 eeoxo3todoptrlivi s0texrxo iu1ol  mietat  2ua(m no1oetn icild aDra(vpnu0 rtomrcoytopD anei t  exoxmpnu1lpte nes ( sDurx onu4oltnmoeias a eaums;u0 lerxoctydom  ln olt)t2xr(mpnodame mivils)aDumx onu0tltnmf3tad m2uanmp;u)aetoxf iytop  aues t)trxoxopnodamenlncsasfsrrrumpot1aptoio3tys a2ran p u4tlerir ty1faD lneo t t2tmxo3nydoptnlies ()s2tau o;u4olen ieiytlmDelu p;t0tlenxf3iy1fmteanei;()trto(o3iydaptn fcs t aDuaurooo0ope mictldfmDeln pn(4tltrxr ia1lm elivs (0teuo(r3no1lpt mfet s s2rmxmoot4ape mo3iltfa rm(vs (0teenmfcoytoatrau ils trumio nu4om   feiat sDtmx o;o4tltomf3ilslmDrau o;t0 etrio tytlpDrlivsls s2urxm3no4lm nlivi tf 2urxr nu4aleo f3tad sDelumont0 leoif iodlm eaiei ()teuoir3oy1oltnlfvs () 2tax  no1opt  i3iltfs el( s t)artrifctadomD  uei;t0texrxm io4al n fvil(  Dumx  no0olxoio3ilsla ulnms t0altrxoctydfm e ueo;t s2uoxo3oy4ope mneils) Durxro;o0opxnmoeiatlm ua(mpn(0arxrmocoadopteaieo;t0t2xoim3oy1llt mnesa() rtr(rpnu1olenmi3iadlsDelu p (4aetrxoctadfpDr nvi t) etrio oo4lpen fesl()srtm( ooo4alxnio3tldfa uauvpn(0altoxo3oadomDeaieils0sruoxr iy1amee fctlt arrrxroou4opeo ociadls eau p t) exrmo iodlmDeaieslt) rxrxm oy4ole mfeils aDrm(mo;o4olx iictat m el(msnu0trxnxocootomDeauvi;t) ruoim oy4lp   fvs t)sDur(mp;t0tltniietatfmDran p;()trerxf3iodoateli s () 2to(mpou4amee icsa()aDtmur no0aeeo f3tadfm rauvs u0 rtoxo3oadlmDrau s () etrio nu4lle lnesat)aDtmu p;u0tlxn fctadla2ul( sn()trxrxfcta1lmtr ueil() exrxmpnu1amenmnct s)aDrr(mp;t0tlxoifciaslaDra( s;u) lxrir tadlmtrlnei;(0t2xmxrpnudlltelfeslt sDtmu poo4texomieildfm rmumpnu0 renmf iotlat  ueo;t  etmxmpnu4ol  mivt tf Dtax  ;u4tltoiiciad m ua( p (0 rtnmrcia1omD  u o s0 rto(opny4lmenlfvsls aDuax onu1aee  oeiasla rlnvp;t0tltomrcto1fm   i o;t0seurim no4lptemivslt) rtmxm ot0oleoiociatlm2rauvp;u4alxoxo3iotopte n ols0 euo(o iu4lp eliesa(fs2raxmpnu1alxomictad mDua(vp;t) lxnir iydfp r nei;s0texm(r no4lltnmicilt)s2rmum no0tptnmiciydfm uln o;(4 ltomociotlm elu i;s)s2toimpny1lpenmict sf 2ra(r ;t4opeo ictytfmDumuvpn() lxoxociydfaDr uvo;s)srtr(m3oudop nlfetls)arraurono4tlenmfetasls2umn o;t) lermrcoadlmt li i t truoirpou1al elnctltfartmurpou1tetomieiad m2rmnmp;(0 eenif3tadfa elu o s  ruoxr no4lmtelnvslt a2rau poo0aetn fcias mDrauvonu4 ltnio oatomte nei;(0 exoxr io4olen iviat sDtax o;u1alto ociadfaDrmn o;u)artrmf iatoa r nvo (0s2xrxr no1aptnlfvtl()sDtr(rpno1altn oetaslsDumnmo;t4arxrircoa1lpteluvo t t2xmxo3no1lpt  ncsls  2umx oot0tlt ii3tldla ulumo;(4teermo3oo1lmtrauesls t2xmxopiydoptemfctls)aDtru  oo4olenmo3iysfa2el(vp t0texrifcoytfaD anesl() euoimpiu1lpt mnvt sfa2tr(  no0tpe moeiydlm ran p t0tetoxrctodfpt aneo ()trxm(o3oo1am emneil(f Dur(mono0alt ioctadfaDelnvs t) etrmo3oydlptrlieo;() rtrxm iodlpe  fcsa(fsrtm(mp;o4aetomoctytfmDeanmpn()artomf3io1lm rai i s seuo(o iodlme  fviasfs2umxr ou1aee mf3ildfmDulnvpn(4 etrmo oytfa ranei (0s2toio3io4ame licsatfarrr( p;u1alx moctatfsDua( p () rermocoodlm r nvs s srxmimpiy4ale  feiat)s2trxr ot1tltomo3tyt a ul( pnt4texoxf3iytlatr ivs s) ruoxm3oydalte nci ()a2trur ;t1opeoiictlsfm2el(mp;(0aexnmr ta1fpD an i;( t2xm(mpny4lp e ieslsfsrtr(rpno4tet  iciad aDuan p;t0 ltoir3oa1lm r nvs;()srtr(r3oodome  icilt)aDrru pnt1tpe ii3tytfmDra(msnu0aexomf ootfpt  ieilt  etmxm3nudlpeelncs s a2urxmpot0aetnmf3tldfaDemuvs u0trerxr ta1opDrln s t)setoxr iy1oltemicilt srurumpoo1
\ No newline at end of file
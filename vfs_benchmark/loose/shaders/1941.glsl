@@ -0,0 +1 @@
+i ol(  etoir3iu4al n neslt a2rm(rpnt1tlt ii3iad a umu p t)trxrmo3totfptelnei;(  rxmirpoodomen fvtltfsDtmxm ;o0tlxnifeiltfs umnmsnt0aeeoio oatlpDrlies s srurir iudome  fviat aDtm( oot4oleo iciasls uluvo;(0tlxrxo todopt  nvolt) etmxr iodlp elnvsat) rtrumpoo1apt mfciatfa um( snu)alxoxr3oytoaDr u s;()s2xrio3ny4om elnci (faDurxro;u0alt ifetlsfs2elu pn(4 rxrif ty1faDelueil(0 2xmirpou1al nmnes t sDraurpot0oexomieiadfm umump;t4 eeomfciodfmD aivo;s) 2tm(o3iu1olen ivtasf Dur(  ;o4tltn octldfsDum(mo t4 leoxf iydla   u i s0s2tr(r3oy4llt mnctls) 2rm(roou0tetniocildla ul(monu4altrmr3oadoptr nes;t)s2trxm3oo1ll nlictltfsDtaxmoot0ape mo3iysfs2uaums t4tetrir iydlp rlnvilt0s2trim3oy4ap  mncsat)aDtr(mo;u4tleomoctls sDel(mp u)tetomrciodlpDr u s t  rxoio no4llenmicsltf 2rmxmonu4oetoio3iadfs em(msnu0texrmo ootlm r ues s  exrxo3io4opee ivtl( sDrr(moot1tlxn ieiytlsDulnvsn(4tlxoio3oatlaD anvs ( t2xrio oydameelnviatfaDtmx  ;t4teeoifcildfs ul(vs;u)tleoiocoo1lp  lneils) 2uoimpoydoptn fcs ( sDrrx  nu1tle mf3iydfmDemn p () exrif tatlpt lieolt0 etmxo nodaptelfvil(faDrrur ou1tpeo o3tls m2eln p;u4altoif iatoaDelieil( t2xrxm oy4ol  mnci t)sDrmxm ;u0alxoiiciydfm2rlnvp (4tlxrmf iatom eanvsls tetm(mpoy4lpen nctlsfsrtrumpoo0alx mfctytls emnms;(0 etrxo oatfa elnvsls sexrim3oodll e net t) Drmx  no0ape  f3ilsls2ua( o u4artomr3totoate nes;t0s2xrir nydaptn fvslsfa2rmx ooo1oexo iciyslm rluvp (0 rxrxf3to1lmtraueils) rtoxo3no1optelneia()srra(moot1texnmfciltfa em(mp;(4artnmf3to1opDe neols t2trxm3oudam emfesa(fsDtmur ot1tltomictldls uauvp t) ltnif3oo1fp   uei;(0trurxr no4al  lnet t)srur(mp;t0aetoioeiaslm rlnvpnu0tltnio3iytlaDr u sls)srtm(r3oydlm emnvta(f 2trurooo1olen ociytlmDrm( s;u0aeeoxr3iytlmte uvs ()trxmxm ou4ame  netl( a2rrx  ;u4oex mfctadfmDul( s;u) ltoir oytlat  uvil()s2xo(m iu4lm  micil()srrmx oou4alenmfctatfmDumn o (4aexoifciodfmt luei t)t2urxr3oo4op nmnes (f Dur(mpot1tlx  ietlt mDrl(ms () leoir io1fpDraivs s0 2xo(r3ny4lpeelfvtl()aDumxrp;o1apeo ictatfa2rln pn(4tltrxrcoy1fa raieils0srxo(mpoy4lle  ncs t)srrau o;u4teeomf3iltfa ua( s;(4tlxnio3iotoa   i ilt0truoxr no1altnlnvs s a2rrxm ;t4oetnmoctlt s2ea(mp t)artomf3to1fmD lu o;t)srtm(o3nydamenmies s  ruauroot0apxoio3tytlm eanvsnt0tlxoxr3iytlmteaneils trxrxr3nu4ol   nvtlt) 2tru p;t1tlt if3iasls2ulu ont0aetoif3ootlaDr ieo s0trxo(m nodopenmnvi t  rtru onu1alto o3iyt a uluvo;(0aeenir3iytfaDrlnvo (0tetrio oydlm  mnctatf Drmx  ot1alxnmo3tlsfm uanvp;(4 rxomr oatfm  aues;t sexrxm io4lp nlivias s2ur(m ;o4apeomo3iytlsDrl(mon()aetnif oytoat  nvs;s)sexr(o iudop  livtlt aDur(moou4tptnmociad mDranvonu4altnif3totlpDeaneo s) etr(mpoo1lp e ics (  rraum nt1open feiat s ulnvp;(4 lxnxr totoatr ieo;t0 2xrxr nu1ale  ictat sDtmx  ;u0tlxoiieiyt aDrauvp;t) lerxoctatlm e neol(0s2tr(rpno1lmenlncs ( sDtr(m nu4apenif3iydfa um(vs;() renmo3todop eliei;(  exrim3oydoltn iet () Drax pou4tlxoif3ias s rl( p;t0 exoxf ta1omtr i s t)trxmxo oy4op nlfcils srurxront1alto o3ilslaDea(mp u)texrxr3tatlmtrlneslt0 rxr(r3ny1ome liesls  rtaxmo;t0alt iieiatfm2ea(vpn(0aleoirciodlm  aivslt)s2xriopiy1alt mies tfsDra(rpot1texnio3ild m uanmonu4trxnxo3io1fa elivo s0 rxr(r nu1aleemfcslt)srra(rpnt1tlxnmfeilt s2emuvpnt)tlenir3oo1lmD ln slt) 2toim3nudlp   ietat sDta(r ot4oeeo oeiys m2umumsnt4tetnxrctydlpD  uei;s)texoir iudlle  ieia(f rurump;o4oetn iciadla uauvsnt)aeenmr3iotfp   i s;s)sexmirpiu4apee nvslsfaDrm(m no4ale ifctat m2rl(von() rtoio3tatopt auvils)t2xm(m oydaltelfvslt  2umur ot4tptn o3ildlm ulu sn()artrmr oy1oatelivo ()srum(m3ny1amtemieil()arrmx  ;u0aeeniiciadfmDuanvs t4aetoxo3tatlptrlnvi;t texr(m ny1openmicils a2ra(rooo1olt mocilt mDrlnmsn(0 ltoxr3iydlmteli olt trxr(rpny1omeelfvtls)a2ra(m nt4aex iieiatfa ea( pnt0trtrxf tadfpDrlnvs;(0 2uoio3ou1alenmnvsl()srtmx  oo1tleomictls m2umn o;()artomrciadlmte nvs;()srxmxm ny4alenlnctasfaDrau p;o0apxnif3ildls uan o;u4aexoirctytlpt lneo;t  rtm(m nu1ap   netlsfsDta( pnu0tlto fetltfm2em(msn()trerio iatfptelieo t seuoio oy4lm e ncil()arrm(mp;o0oltnmocildls2ulnvsnt4alxoxr to1opD auvs;( t2tmiopno1openmneilsfsrtmxroot4olxo octlslsDeanvs;t0tltnircoytlm elies;s)setmxo oy4apenlnes s  rraurooo4apxnioeias s2rl( o (0arxrmrcoydlp  lueils)srtmxo3oy1op emiet (faDtm(  ;u4olt  oetat m umn s (4tleomf3tydfm  aueilt0 eum(mpnydlm nmfvtl()a2um(  no0oexo o3tls aDuluvs;t)altoxr3ty1laDr nvil(0 2umirpio4aleemfciasfsDuax  ou4oltoiieiytfm rluvsn()tlxoir io1oa r ies t s2xo(r3ny1lmtnlictatf 2ta(r ot4olxomiciys s el(mo;t4alxomr iodla r n il(0 etoxr3iy1ap n fcils  rtrur ;u4tlt  ictld s2elumsnt4alxnir3to1lm  lneo () 2xoio3ou1ol nmnvias)sDumxmp;t1tptomieilslmDuauvo u)tlxnxf3ia1lmDeaues;t  2urxo io4op  mivils s2ur(rp;u4tptnmo3iydls emu p u4alxnmrcio1fm   i o;s)seto(rpnydlmt lfvsa(fa2umu poo0opt  fciysfaDem(mpnu4texnxo3tydfp elu s ()s2um(m oo4am elncsas)a2rm(mpoo4tlxn iciltfs2emn o;u)trtoir3ty1omte u i;( trxo(opou1ale lfvtlsf Dtmxmpou1ape  f3tyslm2emn pnt0 ltrxf iydoptelivils tetrxr3ou4ol e fvsasfaDrr(rp;o0altn ictydls2rm( onu0 exnxfciy1lp e ueo s0srtoiopiu1apt  icils)aDtaxmo;o4tee mietyslm rl(ms (4trtnxfctatlaDelivo;()t2tm(rpio1lm emivtltfa2urxrpnt1tex ifciytlm2el( sn()trtoxo to1lmteanvo s) rxrxmpnodlmt mnvi s) 2uaxmp;o0ale  f3ildfm2ea(mp;u4 eerxf3iydfmtranvilt0 exmir nydomtnmnetatf rtmxrpnu0aetnifcilt a ea( p;u4 exnxf3iatomDrauvolt)srxrimpoudll elics (  2urxmpno4alxomicils m2rlumo;u4 etoxocoytfp e nvs;t0s2tr(r nu4lmenlncsl()sDta(r ;u0oetn fctyt s rlnvs;u4trtrifcia1lat  ivi s seumxr3no4ap nmfcsl(faruax oou1tetomociysfs2rlumo u0texrxrciotlmDe uvs;s0seumio oy4aleelfetat) 2trum ot0apenmf3iltfsDemn s;t0aexrif3tytlptran i;s0s2tmxmpoy1lpeelfvs ( aDuaum ot1aeto f3tatls ul( p u0trerir3ta1fat  ueils0texmio3oydlpeemiesat  rtr(mont4tptniictat mDuluvont4tltoif oytlaDeai ilt)t2umxmpiy1omen nvia(f Drmumo;u1alxn ietytfa uln p;t4arxoxoctodfmD li o s0 rtrirpny1lpenmiei (fartmurpot0apx if3tas mDrau p;t4 rermo3iatfmt anei ( trtrio3iy4optn ict s arua(moou0tlenifciasfs uau on()tleoxrciydopteau olt0trxrir3no1lleemfvt ()s2urx  ot1optomfetadfa umump;t4tetoif iotomDr iei t trumio iudlm nlfcilt sDuru poo1texnmieiltfa2ua( o;t4 ltoir ty1faD livs t s2urim3nu4al   iesas)arta(r ;u1tetnifciys a2umums t0arxrirctytoateanvolt  rumxm io1lmenlfcilsfarrmurp;u0ole  i3iltfmDua( pn(4 reomr3oytfmDelu s s)t2um(o3ou1lme mics tfsDrm(  ot1opeomf3iydfmDeau pn()trxoio oo1fm e i ilt)srtoim3oodll n ieil(fa2uax  ot1apxn ictadlmDrm( pnu4aexrir ootopDe uvilt0trxo(rpnydamtn ict s)a2tauroot0opto oeilt s2ul(mo;t)treomocoydom  aivolt)tetm(opnydamtn icslt  rtaxmp;t4ope  oetatfm ea( s t)artoif3tadopDeaies;s setm(rpnu4ome  nes ( a2rrxm ;t4ale iietas aDua(mo;u0aetomr oydoatr uei;t  exm(r oydopenlnet ( a2rm(m ;u1alenmfetysfmDeluvont0aetnif oa1laDeaneo s0 rxmxr3io4lmtelies sf 2rmxmo;o4aet mf3iysfs ua(mo;(4 ltrif3iy1lptrli i t)s2uoxo nu1altnlfvilt s2rrurono1aee  i3iytfm2elnvont4arxoifcia1fpteai il() etrim3iu1optemfci s)sruru p;o1tptn fciadlm uan sn(0 rxoio3tatfatrli olt t2xoxo no1apee nctl()aruauroot4tle  fctadfaDraumsnt0tleoif todomDelnvs;( trtmirpiu4altn ivias  ruau  nu1teenmiciyslsDea(mpnt0 lxrmf ootlp e i s;s0texm(m3nudlmtemfesat a2trxrpou4olxnmo3ilsfm2ranmo;t4altrmf ty1lat liei (0sexoxm oo4om e iesas a2rmu  nu4tlxomi3iys s2eanvs u)arxrmf3totlpte nvi t0 2toxrpiudamee neil(f rtaumpou1aeenmieiadfa2ea(mo;u4 lxrxo3ootom rlu ils0 2xrxr3nodllt mfetl(f rraurpno0aptn i3iat s rmnvo u)aetoir oo1lm r ieol()srto(m3ou1olt miesltfs2ururo;u0apxnio3iyd a eanms;(4alxoxr oatfatr u s t texm(r oydomt mivi t)aDrmur ot4tpxn fctatlsDean pnu)aeeomo3to1opDelivs s) exm(m3oy1llt miei ()srtmu ono4oexnmiciydfs2umn pn(0alerxo3io1lmtelivi;s) 2uoir3nodlmeemietat sDtaurpot1tlxo i3iltlm rm( on()tlerxo iytlm  livsls0srtrio3oy1apenmnvsat)aDuaxmpoo4texnmfetas sDemumpnu0 lenxfcia1lp r ueil()s2tr(rpiodll n icslsf rtau o;t0aet moetadfa2rm(vpnt0aetoxr oatlmtrauvsl() euoxmpnudaltn fetl(fa2uru  nt1tet moeiad a2elnmsnt)teenxo3oatfaD  i o t)t2tm(r3iu1aptnlnei t)arum(mpnu4tpx ioctldlaDrlnmo;(0areomo3iytfm  li s;(0teur(m3nodop nlics ()s2rmur ;o1aleo fetls m2uanmpn() lenir oadomDr neilt)t2toio no4am  mict sf 2tauro;t4aetn o3tatfaDrlnvsnt)alxoio iytom  aneol()srtr(opoy1ape mfeilt)sDtax pnt1aeeo i3ilsfs2um(mpnt4trxrio3iadfm rlnvolt) 2urim nu4om nlietasfa2rr(moou0altoio3ias s ul(vonu0alermrctytoate i o;s)texrxmpiydap emnesl()a2rmu o;o4aptoii3iadls uanvs t4tlxrxfcoatfmtelivol() 2uoxopoy1lmtemici tfs2tr(ro;o4opxniociat a2rmu on(0texrxf3ty1fptrln sls0 rxrio ou4op nmfvsas  rtrurpou0texoio3tls a ul( s t4 etoir3iodopD au sls0srtrir iudom nmiei () 2rau p;u1ale iieilsfm ea(vo;u0 rtrmr3oy1oate i s (0setm(r3no4lp emicsls aDtaur ;o0alxniiciysls2el(vsnu4aetoxr iodomDraneols  exoxr oy4al emfvta(  2ra(  nt0olx  feiydlm eln s;()tlxoir3oydfmD  iei ()s2uo(o3nu4opt  neia(fs2trxmpou1teenmoctydfaDeauvp;t)texnxo3iytop   u s (0setoiopiudol n nvsl(f 2umxroou1aet  fetldla2umums () rxomr iytfmtranes;t0truoxr3no4lp elfvsl() Dur(r oo0opt moetysfa rlnmsnu0 rtrxr iy1omtrlues;s0t2trxo oy4apenlfeslt)a2rmxro;o4aexoiicias m rmuvo;(4aexrir3oatlm e iei s srxmxrpio4lmtnmnvtatfs2trx o;u1teenioeild m ea( p;u)altoifcootop eauvo (  2tmirpno1ll e fvtls sDrr(  ;o0apeoiieilt s eauvs t4 eeoircoa1fpDrluvs (0t2xm(o no4al nlnct tf 2tmum ot4opxo oeilsla rm(monu0alermo iodlp rli i (0 rumxopou1aptelfetat srrmx  no0oee  fcildfm2ua(ms;t)texriocia1fpD  ueo t s2ur(opnudlmen fviat)sDraxronu1oexomieiysfm uan s (4teeoxocoy1lm e uvil(0trxr(rpiu4olt lictlsfsDrmu  nt1apen fctat s eanvpnu0alerio3todom  luvols0sruo(m3io4am elicsls sDtrxmoou4apen o3ild sDrmums;()altnxo ta1omD lnvo;s) eumir nydopte nesas)sDrm(ront0teto fetlt a rmumpnu)arxoifciotfpDeln ilt)seto(rpiodaleemnvs t  Drmx  oo4opx  octltfmDeanvs u) lermoctotfm rli o;s)srxoiopiu1omtelfetls a2ra( p;t4ope  fetydla2um( o;(0texnmociydlmteli sl(0srxrxr3oy1om nmfvi () 2tmu pot0apt ifetas aDrlu onu4tltrirciytomDr i i ()texoim nodlpe mfeiltf Duru oou0ole  fetydfmDea( s;t4alxriocoydoa  aneol(0s2xr(o3ou1al nlnvt t  Dtmu  ;o4oee mi3iltfmDuln s;t4alxnmo3iotfa raneils0trxrimpnu4al  mici ( srrm(ro;o4oexomieild s rm(mp;(4altrxo iatomtrauvs;s tetoxrpno1lmeelivsl(fsrrrxroou0tpeomocias aDelnmsnt0alxnmociadoateauvs;t0trxmio io1lmtn netl(fsDum(m ot1oex  fciat mDra( o;(4tlerio3oadlmteaivs;t0t2xmir3oy4llt  ivtl(faDur(rpot1altnmfciatlmDeluvo;(0tltrmf iy1latrli o;s0setmxopny1apee fcil(f 2umu p;u1apxniieils a ean snu4tetnxr3iadlpDeai i;(0s2umxm3oo4llenmicslt)s2trxmoou0aexnii3iydlmDelu p;(0 ltrxo3ia1omtraues;t0 2ur(mpny1olt lnct ()a2tmx  ;t0apxnmoeiys mDuln pnu0arermocootfa eaivs;s0 rxoxo3iy4lpenlncta( aDua(rpoo4tleo oeiydls uauvp (4 ltnmf iotoaDraivol() rum(mpoy1op emnct ( sDumumono0tlt ioeiat aDrlumpnt)areoio3iatfptelivi;s trum(r3io4al  lneil() 2tmumooo4oeto feiadfmDrl(mon(4altoxfciytoaD an i t setmir3nydomtnlnesasfsDra( oou0aetnmo3ils sDrmnms (0teerif3tydlm eluei;s  eto(rpoodlm  licsat a2taur ou4oeto feilsfm2rm( p t4aeeoio to1om rli sl(  eumxrpnudam   ict sf Drr(ro;o1oeen fetat a2rln o;u0areoxo3ootop rln i t  2tr(r3ny1ap e fes t) rta(  oo1olxn fcilsfaDul(mp t0aexomoctatfa e uei ()tetm(m3oy1lm  mfeslt a2raumpoo1olxnmo3tytlmDum(mont)tetomoctydlat an s;t0t2xoxm3io1op n fes sfsruaump;t0texomfetas sDea( p t0aeermr3ta1lm rlieils0s2toxmpny1lle  fci (fartru poo0aleoiociadlsDul(vo;t4tetoxr iytlm  luei ()sexoir3ny4lmen feta(  Dtaxmo;u0olx mieildlmDeauvo;u)arxoif3io1latranei (0tetrxmpiudaleemici s)a2uaurono0texnmo3iatla rmu sn(4aetoxocio1opt li olt)t2um(rpnydamtemnvi ( srrrxro;u4oltnioctltla ean pn(0 eenif3ty1oaD  uvs s setoxo3ny4ap   ncil(f 2umxmonu4tpxoifeiyt m2ulu s;(4artomr totfat luvs;t s2xmxo3nu1lmte fvsls) Draxmp;o4tpeomf3taslsDemu o;u0altnmo3oodlatelivsls) rxrxm3oo1olen fvsl( arurxm ou0opxo f3iydfm em(mo;(0aeeomfcto1fp rlivi s)setoir3no1ale  fci tf Duauroot1aeenmfciysfm ulu o () leoxo oytopDe ieols0sexmxr io1ame mnvtlsf Draump;t1tetomocilsfa2eau p u)aleomrctotfpDeli o;s)t2uoir nodale mieslt)arrax ooo4tpt ioctydls rmnvs u0arxnifcoo1oa   nvi () rtr(mpnudop nlfvtas) ruaxmo;o0texoif3tydfs2emu o u4tlermocto1fpDeaiei;s0s2to(o oydlp  mfcta(fa2tmxm oo1oexomfctyt aDel( s;(4 exnmf io1fpte ivi;t0seurio nu4lltelies ()sDum(r ;o1oltomi3iltfm rmnmo;(0 eenmf3ta1fmDrliei s s2trio ny1om   nesas  Dumum no4optniiciasfm2emn s () lxoioctytlmt an s;s0 eto(m3iu1aptemieslt)s2ua(mpnu0ole ifeilsls el(vsnt4arxomrcio1fm raieo () 2tm(mpoy4lpenmfvi sfa2ta(mpnt4teeomfctys s el( p t) leomf3tadoaD  nvil()setrxo oo1apt mfvtl()a2taxrp;t1ope  i3iysfs ul(mp t0trtnmf oadfpD aiei;s)texrxo nu1ole  ncs sf Dtaxrpno4tle ifciad mDrmnvsnu4 rxniocoo1omD anvi;t  rto(o ou1al elnvsas aDumurp;t0aleoio3iatfs2ra(vp;(0treoxfciatfa e u ol(0trto(rpoo4al  mneils)sDumx p;u0olx  f3ildlsDua(mp;t)aexnio iadfpD  iei (  2to(o3io1lm emivtltfs2rr(mo;t4texoii3iad a em(vont)tlerxo3tytlpD li ils t2xoxr3io1lleemnci (farua( pnu0aexnmicilsfmDrlu sn(4aexnxfcoydfaDrau slt  rxmxo3no4ol  mnct t)sDtaurp;o4tpe  f3ils sDumnmp ()tetrxoctydomDrlnvs (0teurxm3oydaleelfvslt  ruaurpoo4olxomi3ilt aDem(vo;() renif oytlatrauvs s t2xoxr oudop emietat)sDrr(mono0aet mi3tld mDelnmont)tetnmf tydlp  lues ( setr(m oo1om nmfvtls)sDua(ro;o0openmfciydlaDrlumpnt4teerxo oa1fpD livi s0s2tmxr oy4lpeelfcsat)artauro;u1oeeomfeiyd m2ua( pn(4teenxo3oodfaDe nvi s0teurxm nydap nmnetatf rrmxmpoo4opt  i3iltla2ran onu4 renif ootlptrli s ( s2uoir no4omenlfcta(f 2ua( pno4tlx if3iyd mDelu p u) exnxo tydfm r nvol()srurxm io4ole  fcta(fa2trur ;o4altnmi3tyslaDrln s;t0arxnxociytlmtelnvs;s trur(o ou1op n nci ()aDtauroot1ape  fciyslsDulums;u)teenio3tydoaDe uvil() 2xr(r3iudaltn nct s)a2ur( poo1olt ioctldfm2um( p u4trenmo3to1fp  livs t) etoxrpnudopenmnctat)sDtm(m ;o1aeeomociltlaDeauvp ()texnmocto1lp r u o ()seurxo3no1op e iesas) Dtmxmp;u4tlxo ociyd aDrauvs u) ltrmrciy1fm e u s t)s2tr(o3oudlp  lnvi tfarrmurpot4tpe if3ilsfs2ulnvo;u4aexoir3oydfpD ln ils) etoiopoydlmte ieils)sDua(rpot0aetniocild a2rmu pn(4aetrio tydop  luvi;s)srumimpnodlmeemies t) 2rax  nu0apeoif3iatfs rmuvo;t0altriociotfp eanvo;() exoim3nu4lm elncta( a2ur(mont0alto i3iys s ulnvs u0tlxnxoctatomDrln i;( srurxr ny1lm nlfviat s2ta(  ;t0olen icildls umums;u4arxoir ootopD luvs;t0tetrxopnu1al nlncsasfs2raur nu4tleo feiatla2rm(vsnu4tetnmr tadfaDe i s;t0trxmimpoodlmtemivtatfs2tmu pno0opeo f3tydls rlu p;(4 rxoxo3iydoaDrlnvsls t2tr(opiudomen ictat s2umur ;u0opto f3ildls2ua(von()alxomrctotla eai i;() exo(mpoy4ll emiet sf Drmxmoot1apto ietatla2rm(mo u0 ltnif tadlpt lu sls srxrim3nodom   nvia(fsruax onu1olxomi3iadlm2rmnms;(0aeeoxr3iy1oa elu o (0srtrx
\ No newline at end of file
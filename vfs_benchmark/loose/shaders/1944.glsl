@@ -0,0 +1 @@
+u s t)seuoxo nodam  lfvt ( sDrru  ;o0aetoifeildfa2rmnvo;t4areomf3oytoat livi s0trxmxr iydlltelict sf rtm(m ;o1aeeniiciadfa2elumo t0 renxr3tytlatelivs;(0srurim iodll  lfesat)srtmxr ;u0tpx  f3iysfaDrauvs;u4altrxf3tytlp  auvs;(  eur(m3ou4lmte ncs t  Durum nu0aex mf3iltla ulnmp;t0 lxnmr3oytfatr ieo;() euo(m3oydomt  fctatf rrau  ;o0olto fciasfsDua(vsn()aleoir oa1omDe neo;t)srurxm iu4oleelnes ( s2ta(r oo1tetn fetyt a rm(vo () lermocio1oat  uei;t)teurxm3iudoptelicsa(fa2ur(m ou1olxn feiltfm rlnvont) eerxo3iodfm rli slt) rxoim nu4oltnmfcsat s2umx o;t1alx mo3tasls2eanmsn(4arxnir ia1fmtr ueo t0t2tmxr3iu4am nlict s)srum(r oo0tlenmi3iytla ra(mp;()altrif tydomDranvi t  rxrxm3oo1lme  ivsatf 2rmxro;o0olenii3tydfm2rm( p;t0tetoiocoydoa e nvols)s2um(rpiu1ap  mnvtltfa2ururont1altoii3tytlsDrmumo () rxomo3io1lp r ueols t2xrxmpnu1amtnlict s  2taurpou0alxomfeiadfa ean p;t4tleoir3oy1fm  lnes s)seurxm ny4lmee ivilt srrm(rp;u4tpen o3iat a umump () lenmf3oo1om elivsls srtmir3no1al   ivsls)arra(m ;o4apx if3iatfm rmnvp t) eenio3oy1fp eauvo;(0 rxr(opiydal nlncsasfs2rrx ono4oee mictysfa2ranvs (4trxrxfcoa1om   neol(0srxmxo3iy4lle  ivils a2tmurp;o4opxn o3ils m eln on(4 lxnxo3iytfa raieol(  exoxo oo1lm nlfet sfa2ua(  no4alenmo3tldfs ua(vs u4texomo iatfaD  ieo;s)srum(mpnudllenmieiltfartr(mooo1olenmiciltfa2em(vsnt) ltoxfciadoaDeli s;s)tetoim3iudap nmivsa()s2tmx o;u4tpeoifetat m rluvsnu) eenio3tydlateai i;t) 2xmxrpnydlm  miesasfsDrmxrpot4aeto ociltfa rln onu)trtrxf oa1oaDrluvslt trto(r ny1lltemictas) 2umur ;u0oeeoiieiad m2umn s u0aeerxfcoodfpt aivolt0 eum(opiy1ll nmnvia(f 2umxmpnt1apen iciasfm2el( onu4texrifctotlaDraueo ( srtrio3ou1op  mieia(f 2tmxr oo4opxoifetltlm2rlumsn()artrmo iytlat luvs s0texrirpoodlpte fvsasfaDrru ono4ale  i3iadla rmu pn(0 ltnxrctytom elueo s)s2xmxo ny4apenmictl(fartrxmp;u4aeenmo3iytls emu sn(0tlxnmf3iodlateaueslt)srxoxr nodopen ncsas)srrmx p;u0olt moetys m2emn s t4 rxrifcoy1fate ivslt)s2tr(m3nu4ll e ies s srtrxmpou4olenmociytfaDrmuvp;u0 lenxf3totlpDr ieols0seurxm iudolenmictasf rurum no4tet miciys s2raump u0 ltomo tatom r i ilt)t2tmir3iu4omt mfvi s arta(rp;o1teen o3ils s rlnmp;(4teerxo oy1faDrauvs t0s2urxr oo4om emfvtls)srurxrp;t4aex iiciadfa emu p;t4trermo oodfmDeau ol( trtoir3iu1amtemfes tfarraumoot0opx mietad sDel(ms;t0alxrmfcty1fmtelu s s0sexo(r3oo1opeelictl(fa2tmum oo1apxomfeildlmDelnvp u0 eenircty1fp ran i t t2xrxopiudlp nlnvil(  Dtm(mo;t0apxo i3iydfaDelnvp u4trtoxf3oydop r ivolt0 exr(mpny1al elfvslsfartrurono0ape mfeiltfm ulnmont4trxoir3oadfm e ivol(0srtmxm3iu4om elfesls) 2umur nt1tpen o3iytfs emn on(0teerxrctatlmD aivi;s srxo(opnudllt licsasfa2raxm oo4oleoiieiysla2umu o;u0tleoxfcoydlmDrai o s  2um(r ou1op  mfvil()sDrm(moot0tee ifeiysla2rmu pnu0 lxoifciatfptrai i s0 eum(r3iy1llenmnetl(  2rmx  ;o4apto f3iasls ulnvs;u4trenifcoydoaDeanvo;s  exoxopiy1ame  nviat  2tmumooo1apt  f3ils m rluvp (0 rtnmo todlaD li i;t seumio iudoltelfcsl(f Dtm(roou4apxn f3tls aDra( o;t)trerifcoo1lp raivo s) rxrxo nydopt  nvils s2tm(mo;u4ape mfctyd sDranmo;(4tltoxo3iodfa rai o;s) eurxm3oydomt  nvi ( srrmxmpnt0tex ifetas m2rluvo;u0aeenxr3tatoateauvol(  2xo(r no4lpe lnvt t) Drrxmonu0optnioeildfs uln o (0aeenxr oytomDeluvo (0srtmxopou1opt lnvi (f 2taum nt0apxnii3iltfa2emnvs ()alxnxociatopDelnes;t t2umxr iu4ll e ncia( a2rmx  ou0tlxoiiciltfa ua( o t)alxnxf iatoaD  uvs t0 rum(o3no4omeemictlt sDua(r nu4tex iietadlsDem(vsnu4 rtrxrciy1oaDr ies ()s2trxr3ou4apen feias  2ur(m no1oexnmiciat s2ul(mo u0texrmf ta1fpD  n o s0seur(r3iy1lpe  icta( aDrmumo;o4oltniieiyd m2uaumo u) rxrmocoo1fatr ivil() 2xmxopio4altemicsat  2ur(mp;t4aexnioeiasfm2el(mp;u0trtnmf3ootlmDrln i;s)srxoir3oo1lltnmivsa( a2uru  nt1oeto fciyd m2rlnvon()arermr ia1la r ivolt)seuo(m3oudamtnlfetl()s2raumpno4apt moeiad a um(vonu0 leomfciadoa elivilt)teumiopiydalee fci (faDtmurpou4aleniieild a2rmump t4teenxrcoytfpDran i t0trxoxo3oy4lmte fvt t)sDurxr oo1tpenio3ias m2umumo;t) etriocoy1op   n o (0trurirpio1omenlivsas)sDumurp;u4tle  i3iad a eluvs u0tltnxfciodomD  n s t  exoxrpoodalenmnesat)sDrm(rp;u0tex  fctltls2rl(mp;u0 rtrmf todomtr ues;t0 2toxopiodalt lfvils  Dtrx p;u1apt  feiadfs2rl( p t0altnxocoydlpDrai s t  2uoio3io1lleemnvslsfaDra(mono1tex mfeiydlaDulnmo t0teermocoytfa e ivs s t2umim oo4lm e fvtlt)sDrmurooo4oex  fctad sDumumpnt0texnmrcta1fateln il()teum(r3iodllenlfvt s aDtrur ;o4oetniictyt m ulumonu0tltoxfciotoa rlnvi t) rto(rpoo1lpee fcs t) Durxr nt4oeen i3ils aDrmn o;u)artnmo iy1lm   ivsl( setoxr3iu1op   ncsat  2rau pou4openifctas mDumumpnt4trxoxo3tytop ranvolt0setoxo3ny1lpt livsl(  rtr(mpoo1aee iocias mDem(vs ()tlenio iy1opDraueo;s  2uoim3io4am  mfcs ()srraxm ou0aleoifcilt aDulu s;u4 lenir3oadomtelueslt s2umxo oodal e fesas s2rrurpnu0aetn icias sDelumpnu)artrmf iy1fp r nes t trtm(rpnu1op n nvs sfaDtmxmoot1tpen o3iasfs2emumonu0 leoifcootom  ai i;t) 2xrio3iy1opeelnviat  Dtrxroot1opto oeils aDean p u4artnxr3iy1lpDranvils)trxoir oy4omtelietasfsrrmuroot1alx mo3tasfs ua( p;(4tltoxfctytla  livo;s)teurir3io1lpenlfct ()s2ta(mpnu4oee  o3iyt s2ua( pnu0teeoxr3ootfa  ln sls)trxmim3iu4ap   ieia(f Dtaumo;o1tpe moctat a rm( onu) rtnmr ty1lmDrlueolt)s2xrirpiu1omt mfet t  2uau poo0olto f3ilsfm2uluvs u0artoxrciatlaD livi;t) 2toim3oy1alen feil(f Dua(mo;o0teeomociytlaDel( p t) rtrxo todlaD  ies s)teto(opiy1lpe licil(f 2rax pnt0ape mfeiatlaDrmuvp t4trxnmr3ta1oatr uvsl( s2xr(mpio1om  mfetl( srumumpoo1tlx ifctatlsDea(vo;t)aeerio3ootlm elieol()trtm(m3iy1opeelnvs t  rum(  ;o4oleomfetyd mDrmnmp;t)tlermr tytfa eanei;t t2ur(o3oy1lp e iet (fsDrrxr nt0aexo f3ildla ra(ms u0trtrxrciatopD lnvs s0 2urxrpiu4ll  mnes t)s2uru  ;t4tpx  f3iysfm2rluvs u)trerxfciy1lmDrau ils t2toxm3iydll nlnviatfs2trum no1oeen o3iys aDrlnvonu4tleomr iytfateanvi s srxr(opoo4oleemneia(f rrrum ot0alxn ociys s emnvs;t4 eeoir totlatrauvo t s2um(m oo1altemieil( s2uru  ;u1tpt  ietls a2um(mp;t)tlenir3oa1lat  ieols sexmio nudapte ict ()aDrmx p;o4apx  i3iytls eln s;u)altnxfcoy1op  ai s;s)t2uriopnu4ole lnci tfaDra(r oo0tle moeiysfm umnvonu)tlxomf3tadfateai s s s2xrxmpiy4ll  lfei s)aDua(mpno1texn feiatlm el(vpnt)arxnmr3iy1lp   i o s trtr(o3no4op  lnei ()sDtaxrpnu0aee mieildlaDrau s u4trerir iadom e ieo t) rtoim no1ol nmnetl(fsDua(m ;u4ope mi3ilt mDua( o t0trxomr3iodlaDeauvi;(0 exm(opnodamt  ivtls  rtau  nt0tex ifeiasfa ean o u) lxnio3tatlm eln i;s)setoiopoodom n netas srtm(mono1alto ieias s2rlnmp;u4trtrxocootlptrlnes s0t2tmir3no1amenmnes t srurx oou4opt  oetadla ranvp;u)tetoircoytlatrlneil(0 exmir nu1ame mnvsa(faDrmurp;u1alto fciad m el( onu4altomrciytfm  aivo;t s2xmxm oodol   iviat sDrru  nt4oleomociadlm2ua(vp (4 rxnmr oatomD anei (0srtr(o iu4al  micsls) rumxro;u4ale  ieiytfm2rlnvp;u)tlxrxrctatfp rauei (0 2um(m3oudom e ivtlsfartru p;u0aptnifeiad m um(vs;u4arenxr3oatfat lnes t)s2urir nydame  icias s2urx pnu1aexnmiciat a2ea( pn(4tltrmr3iy1fpDranvo s s2umiopio1ome  fcil() 2tmxmp;t4aexnmictatlm2ulums;t0altoifctadfat anvs (0texoxo3iu4oleelfvs t  Durumpno0opxnifciyt aDemu p t)aeeoxo3iodomDrluei s0 2urxopiu4am nmnesa(  2taurp;u1apxnio3ilslmDemuvsn()aeenxfctadom eau o;( trtoio3oo1lm   nctas)aDuax  ;o4opxniietytlmDrm(vo () exoxo io1fp rlnvslt)s2um(m3oydlme  iesa(fa2trxr nu4aeen feiatfa2umums;(4 lermr3ootopDrlivi t0tetmxo3no4llt mnvta(f rur(m nt0oltoiietatfs rln o;()tetomr3ia1opD  n olt0trxmim3no4ome lncs t)sDrax o;o4alxn iciys s emn s;(0 exriocty1opDrln s s0t2urxm io4lmtelfesls  Durumo;u4ope mf3ildfaDuau onu0 lenmoctodlatrlivo (0t2tm(opnudomenlfvsls)s2tmxr ot0opx mi3ilt m2elu pn(0artoxr iatfaDeaueo s) rxr(r3oydomtnlfvtls)sDur(roou0apen fciaslsDrl( pn()arxoxo iatfmtelieo t0 rtrirpiy4amt mnvtls)aDrrx  no4tptoioctls aDeau onu) rxnmf3oadlpDe ies (0s2xr(r3iy4omenmfet ()arrmu  nu0tetnmfeiad m2ea(vo (4artrmf tydoat au sls teurxm ny4ol e netl(fsrtmu pou1tex mi3tydla eluvpnt0alxomrcio1lptrluvsl(0 rtoiopnu1llte nct ( aDumxr nt4aetoii3iysfsDuaump;u4 rtoxfcta1lp   uvs;( srxoxr no4lpte feslt  2tr(m no1ape  fciatlaDemump;(4 rtnmr3oa1lmtrluvo;()t2xoir no1lleemiesas)aDuax pnu0aptomf3iltfs2ul(vs;(4 exnxrcoadoat  i i s  2tm(o oo1ap e ncil( artru p;u1aptn ieiydls uanmp ()tlxnifciytomtrli i;t)tetr(o3nodame  fcsas)a2rrx  no4tpxnioeilslsDrmnvsnt4 eerxfctodfpDrluei t t2xr(rpnudoptn neiasfsDua( ont0tee ifciytfaDuan on(4tleoif iadfmDe ivi;s t2trxrpiu4lmeelivi t s2uaxmpno0altnmoeias a ran s (0texomfciatomD aivi;t seur(opiydole mietl(f 2rrxro;u1alenmo3ilsla2el(vs;(4 lxomo3to1fptrluvi s s2tmirpiu4al e fvsls) 2rmu oot0oexn fetyslm uluvsnt0aexrmrctodlp e nvolt) 2uoxmpoy1lptnlnetls s2ra(  ;o1texo feias mDelu o;(0 rxnio oa1fp r neols tetm(opno4lp nmfetasfs2umu pou1oet mieiaslsDemumo t) rtoif3todfm eanes;s)t2xrim nu1alee ietlt s2trxmpou1tpt ii3iyt a umnmonu) eeoxf iytlmt  uvolt0s2um(m3iy1am nmfcs t srrrxrono1olx  feiadla2el( s (0 etnmfciotfm  ai s s)teuoxr iy1ope  ivi (faDraurono1tlxoif3ildla ua(ms;u)tetrmrcia1fa elu i;s sexm(r3ou1apeemnvtat  rua(m nu1alenmf3ild s2umn o (4 ltnmf iadlp e i o;s0s2tm(o oydom nmiesatf 2rr(mp;o0oex  fciltfm2emnvsnt)tlxomf oodoptrluvi (0 exr(mpio1aptnlnvi (  2ra( poo0apt  fctytla2elu p;(0 rerxo3ootom e ueols0 etm(mpnodom nlnesat s2rrurpnu0tlxomfetasfmDel(von(0tleoxr oytomDe nvo ( seuo(m3no1lmtn ncsltf 2rau ont1opxo ieilsfsDuauvpnt0trtoxr3ootfaDe u s;s0tetm(r iudlp elietls)artm(mont4tpxomociaslm2elumo (0altomf3oatfpt lnes t0 exmxr nudale lfei t)s2uau o;u0tlt iictlsfm ulu p;()tlxrmrctodlmt ai sl() rurimpiy4ome mnct t)s2rr( poo1oex iociyslm rm(mp;t)tltoxrcoytfp eluvol(0 2tmimpoy4ameemncs tf rtaxmooo0tpx  fctyslmDumnmo (0 exrircia1fa r uvil(0 rxr(r3ny4ll   ncs s aruauroot0alenioeildlm2elnmo u4areoxr3iatlp rlu ols)tetr(mpny1al n fcilt  rtrxm oo4oeto ieiyd s rmnms;u4arxnio3tatfp rauvi;t) eumirpny4omt lfcsas sDrau o;o1oetnii3iatlm em( s;(0trxrxf3iatfp elnei;()s2toxm3oo4ol  lfeil() rrm(mo;t0apt iiciytla2em(mo ()arxnxo io1fptean i () rxmxo3oo1op e ieta()artr(mono0tle mi3iytfa2rlumpnu)alxoifciatfm e uvsl(0seuoiopoudol nlfeil( srur( oou1tpeomiciyslaDemu p;u) reoir3io1omtr uvil()trtm(rpiydaltn fvsas)a2rm( p;u0olxn oeildfm2emn p u0aetomf3iatlaDelivo s) rtrxr3oydomt miesltf 2tmx  oo0alenioetytfs ul(msnu4trxrxo iodfateanei;(0s2um(m ou4lpe mfei tfsrtm(m ou4aee iictatlmDra(vo u)tlxrxf ty1fp r n ils srtm(r oo4amtemnvsls)sDrr( pot1oeeoifciyd sDel(msnt) etoxr3iytlatelues;s) rtrxo iu4ol   nvi sfs2rmu ooo0aetomfetltla umums;u4 eenif oa1opt anvo ()teum(o3io1am   fcs (fsrum(ront4tlt ioeiltfaDulump;t4tltnmf3oydlpDeaieils) eum(m iy4lle mfcias arumxroou0apenii3iasla2rm(mont)arxoxrcootfa  anvi;s0srtrxrpnodamen ivt sfarraumoou0tpx  f3iatlm2raums u4aetrifciotfpt aneslt s2uo(o ou1oleelfvilsfs2umxr ou1texo ieiytfs umn p;t0arenmrctatoaD lnes s) exmxrpnu1lle  fcs sfa2tmxr oo4aeenmfetlslm uau p;()altrmo3iatfaD liei t0 etm(m3ou4aptnlnviat  Dta(m oo4aptoifetlsfm2um(vo;(4artrio ty1lm   u o t  rtm(m oodol  lfvsls sDrmur oo4alt mi3iasla um(vp;t4aetrmociytlaD aiesls)srurxo oydam   ies t arurum nu1aptn feilsfsDeauvp t4tetnxo oo1fatrluvi;t)srum(rpiu1lp n fvtat)artrx o;u0ope ii3iytla2rlumpnu0tltoxfcoatfmD aieils0 exr(m iydal elivtas) Dtm(m no0alto feiyt s2raums ()tlxoif tadoaDe uvi;t t2toxo3no1ape mietl() 2umxr nt1tet if3iatfsDel(ms;t)tlerxo3iadfptr u i t)t2toim iy1am e fvilt sDur( oou4tex mfeiysfa ranvp;u4 ltrmf3iatfaD aueo s0sexrio3ny1amte ivtat srtm(r ;u1tpxomi3iltfa2elnmo ()artoircoy1fpt au o () rtrir oo1ome livslt  rrax p;t4tee ioeiysla2ra(vo u)alxrxo3tydla e i o;t seuoxo ny1ole mnesa(  Drmuroou4tpenmfeildfsDeln p (4 exoxo3oytfmD  uvilt0s2umxm ou4ap n fes ()sDrmxr nu1tee mfciys s emn onu0altrio3iotlpt luvi;t teurir3nu4op e ivia()aDra(rp;u1aet if3ildls rl(ms ()altnifcoydfmD  ies t sexrio no4lpeemnvs t sDraumo;t0alxn ieilsls rlnvo t0 etnio todomte u s t  2xr(o3iudape  fvt sfsrumurpot0tleo o3iyd aDrmuvsnu0tltoio3iadfateai sls)srxoiopiudapenlnet (farua(roou0opx  o3iydlsDumuvpnt0tlxoif3tatoat lnei;t) exr(m3oo4am emfci t  Dur(root4aleoiociat a2rlnmsnt0 lxrxo3oy1fatrlivi t)texo(m3ny1lmeelfetl()sDtmxronu1olenifeilsfa emuvo;t)aeerxf3iatlpteauvi;() etoxr oodom nmivi s)a2ta(monu0alxnioeiatfaDrl(vs () ltoxr tadlateau slt0 ruo(o io4llt mfvsat)srur(root0texnmoeilslaDrlnmpn(4tltrxf3ia1laDe u s ()trto(r3nodoptn nci t  Dtrxrpnt1tpeoifctysls2rmu s;t) ltoir3oadla rlnei;(0s2uoxo iy1amt livta() 2trum oo1aexo f3tlsfs ea(vo ()areoxf iydfpDe i olt  exrio iodaltn fvia() ruaumpnu4aeeomi3iydls umump;(0altnmrctodfmteliei s) euo(o3ny1am nmfvi tf rrmu ooo4oetn fetyt s rl( s t0 etnio3oytoptrlneo (0t2trimpou1om   ieilt srurxmpnt4apeomfctydlsDumu p (4artoxfciatoate iei s s2xrxo3ny1omtemfcilt)sDtrxmp;t0opt mo3iadla2rlnmonu4 eenmrcoo1opDrlivo s texr(m3oy4ale  ieil()artru  ot1ope  ocilsfa2el(mp u4arerifciytla e n o s0srtoim3iydaltemnesat)aruax pnu0tlxoiiciadfaDeanms;u4arenmrciadop r n olt)s2uoio ny1altnmiesl(fsrtmuro;t0opt moeiys mDelnmpn(4 eermr tadopD ln ilt0texm(mpoudlmenmnvt () rta(rp;u0tlx iieias s elu s;u4aeeoxociytfptr ues (0 etrxo3iydlpeelnvi ()a2ua(ro;t1tlt io3tadfaDelnmpnt) eeomo3io1fpteanvi s0trxmir3iydaptn netat)s2urxm nu4oexomociltfa2ulu pnt)tetnircoy1oaDrlu i s) 2xmxmpiy1om  lfviasfsDrr(r ou0olxomi3iytlaDel(mon(0texrifctadoate i sls)sruoxm3nodameemicilt) 2trx  ot0tptomictydfs2rluvon(4tlerif3oadlpt lnes ( texmim3oo4ole mieil(  Drru o;o0apx miciydfaDrlnmsn(0teenmo oa1faD lnvo ( s2tm(m iydom emnes s)arumxmp;t1oex iieiys s ua( p ()alenif tadlptr ivo t)t2xo(o oo4ol emietl()arrau pou4olxn ociyd m eanvp t) ltrxf iy1oatraies t srtmxm oodam emnesas) Drmur ;o4olxoiietls a2rlu snu4trxnif3iodlpte u s;()trtmir io1lmte fvsas a2rr(  ot4apx if3iasla2umumpn(0 rxnif3iotomtr neo s  etrxr3ny4lpeelncia(f rtmumonu4oetomoctlslm um( o u4arxnxrcia1lmtrauvo;s) exr(r3nydomtn netatfarrr(mo;t0aexnii3iatls2rlumo;(4aetnmfcoatlaDeauvi (0trumxm no1opt lfes s s2rmu p;t4ape io3ildfaDel(vpnu0trtnir iotoa  aivo;() 2tmxrpou4lpee ieil(  rtm(moou0olenii3tyslaDrlnvo;() etomo3tydlpD li s;t sruoir ou1ame mivs ()artaumo;t1aptniieias m uauvp u4areoxr ootlmDelivo t)srur(o3ou4ame lnvtl()a2um(rpou4aptomoetysfa umn ont4 ltrxo totfp   neslt0 etr(r3ny4ale lieil(faDtrumpoo4altn i3ilsfa rlnvpn() ltomfcio1lptr nei t0t2umim ny4ol n ivi s) rrm( pnu0oexoioctlsla ranvp;u)alenmr to1oaDrln s;t0s2triopoy1lm   iesa()srrrx pnt1aeto ietatlm2um(vonu0aetoxf3iodlmtr neo ( srumirpoo4apenmictl(fs2uau pot4tex mf3iltla umu p u4altnir3oa1lmt ai o;t)trxoiopou4lpe mfctasfaDtmurp;o4alenmieiadfmDumumont)tltnio oydfat an o;(0trtrxo3nydamtnlivt t  rrmxmooo4tpe mi3tysfaDemnvs;u) ltnioctodla elu o;t0trum(m3oy1lmtelfctl() Duru ono0aptn iciltfsDeln p;t)aetnio3oatoatr ivo;( t2tm(m3io1aptemieils aDua(rpno4tleoiieilsls2rluvsn() eenifcoa1lmt aiei s)tetr(opoy1ap  mfvt s)srtrxmp;o4tpx mfeiys mDranmo;u0trxoif3tatoaDe uvs s) rtrxm3oy1lptelnet s)srtrumo;t4tltn fctat m umn o;()artrmocoy1fpD  ivs;s0t2to(m3nodamt  fvil()aDua(mpnu1aeenifciysfm2ua(mp;t) renioctytlat aieo s t2uoio nodam e nvsa() rumx  nu1oetnif3iyd m eanmp (0artrxf io1fm elu ol(0 etrio nudop   ici (fsDtmum ;t4tlxn o3iltfmDrmn s;(0trxnxf3tatlpteli o (0trxm(mpoudame  nci sf Dtmxroot1tltnmietat m2el( pn(4 etnmf3iy1lp eaneo s)s2xmxm3oydope  ivtl(fs2tm(mpnt0olxomociltfa ra( p;t0alxoif ootfm raneo (0t2trim3nydopte nct s) Drm( pnu0tpt iietltls2el( o;(4 lxoif to1oaDr nvo () exrir3nodom n ici tfsrrmumooo1olenmoctys s2umn on(4 lerir tydlp  auei s0trur(mpiodlle lietls) Dua(r oo4tptnmo3tyt a rmnmo (0 renxrciy1laDr uvol(0 2xoxm3nodom nmfctlt  rrax pno4texoifctyt aDranmp;u0texoxr tytop eluvils0s2xoir nudoltemiciat s2rrurooo4opxomfeilt a2rmumo;t0 eermr3ta1fmDr ies s0 exo(mpnydomt mfvtl(fs2uaump;o4apeo ocildlmDra(vsnt0tltnxf oo1lmtrluvi s  eumimpoodolenmietls  Dururp;o4tetn icias m2umn on(4 leoxo3totopD lu s;s0t2urxopou4ol  mfct t)a2trxrpno0opxn ictldfmDea(ms u4alxnir to1om rauvsls0teumxr3iy4olenmfeta(  2uru o;t1teeoiiciatlaDraumo () exrmrcty1opt li s t)t2umio oo1olte nesl( a2ur(roou4optn octlslsDeauvp;u) reomf ootomDr uvs;t0t2urim3io1llt mfct s arum(mont4alto ietldla2rl(vpnt0areoif3ta1optrau s t trum(opnu1aptnlnes ()aDtmx poo1tptniiciyslaDum(mp t) rtrmf3tytlm e ieo t s2xmir3iu4apeelieias s2tr( p;o4tex ii3ildls2ua( on(0 reoxfctatlm elueilt0trxr(m ny4lmteliei ( aDrm(mpot0olx  ietytlmDel( pnt0 exnir3ty1oa   ivo;()s2um(rpio4alt micilt  Duaumo;o4opxn ociadfs2rmnmont0 exnircoo1oatr i ols sruoxr3ny1lptelnvil( s2trxm ot4tpeo ietad a2umu s;(0teeoio todfp r uvi;s0s2tr(o3oudameelicslt  2rrxro;u1apt ioctyd a2emumsnu0 etrifcoatla   uei s sexmir nudlptnlieiltfaDrmum ;o1alx ioetlslsDemuvo t0texrxo3ta1lm eaivo ( seumimpiu1optn fci ()aDrr(  ;o0alx iociltfm rl( s;t0trtrmo3tatla   uvol( trtrir3nu4ame mfes t) 2uaum ;u1opxoiieiyt m rau p u4tltrxr totoa raiei;s  ruo(mpnu1aptnlivtl() rraum nt0oetnio3tydfaDrmuvs;t0 renxr3iydlmD  nvs t) 2trxmpny1openmnvi (  Draxmo;t4ape mf3tlsfs2um(mo u4arxoxo ta1la  ai sls0srur(opnodlmee ivta()aDumx  nt1opxo iciatfsDraumpnt)treoioctydlp elueil()srxr(m3iudape lnet t)s2uaumonu0tpenmociatla2uluvsnu4 exoxf3oodlaD aieo (0 etoxr oo1ape  fcil( sDumxmoot1tpeomfctltlm umu s u) etrircio1lmt  n s;(0srtmxrpno4aptelivs ()a2ta( o;o1teeo i3iaslsDuauvs (0 exnxf3iatlmD lueo ( srxo(r iu1op   fciatf 2umum no1tlt  fctatfa ra( sn(0 etriociydfptelneols0tetrxo nudamt lfcslt aDraum no1tpe mociys a2emn snu) exnifcoo1oat  ies t) rxr(rpiy1om nlfvs t)arumuront0oltnioeildla ra( p;() eenmf tadlaD lnvs t) 2ur(r oodlmtemies sfs2rr(  ;t1apenif3ildls2uanmsnu0 lxrifciydfpD ln s (0texo(mpiudaptnmnvsa()a2tmu o;o4alenmieiyd aDean p () exoxr tytfa  auvs;( setmio nydap nmfeiasf rrrx  ou0ope mo3tltfs2emu ont4treoiociatlateauvo ()sexrxrpoy4opt lnei s) 2tmu pot0oex  o3iltls rm(ms;u4altoxr tatla eln o t texoir3nudlp  mnct s)srumx  ;t1ole  o3tysfa ul(mp u0 etnio iytom ran ols setr(m3oo1lp   netl()sDrau pot4teeoiietls sDel(mo (4 rtrxoctadfate ivils  etoir oy4al n ivsat a2rrurpno1ape micilt m rln o (4 ltomocty1la  ai i t0 rxr(o3nu1lmtnlicsas)s2uau pou1aexo ietyd sDelu pnt0aetrxo3oadla eaivi;s)teurxo3oy4ole  nes s a2umu p;o4apxo f3iadfa2uan o t) leoxo oo1fmD lu o;t0 eto(o3iu4lpe  nes tf Duaumono0apen fetldfa2emuvs t0tlxoxf todlmtrlnvolt  rum(m nydaltelfcilsfa2tmurpoo0alxomfctlsfm2ulnms (0artomfcoydlp   u i s0 2uoxo oudalenmfvil(fs2ururpnu1apx mi3tadlm rau p t4 rxnioctydom elu o t)s2ur(m3no1oltn nvt (f rumu p;t0tlenmfetyt mDuanvs u4 exnxf io1op ean s;s s2xmxr oudape lneslt) Drrx onu1tpe  ieiatfa rlnvpnt4alxnmr3oytlmtrli ol( s2tm(o no1amtemfeils) Dtmump;u4oeeo fetydfs2eluvpnt)arxnxfcoatla  anei t)s2umxm nudll   nciatfsDtax  ou0alx mfctad a2rauvonu) lxrxr3iy1omD lnvslt)tetmxopiy4llte ncs (f Dur(r oo4alx if3iad a2umu snt0trtoxf ootoat lneslt  exm(r3oo1lm nlieias)srtm( poo4tex mf3iaslaDrm(vs;(0 lxrif ootfa  lueo;t)teur(m3iy4alt lnesls s2tr( poo0tpe io3iatfmDrlumonu0 lxnxf3oytomDranei s t2xrxopnu1openlnvilt s2ra(monu4optnii3taslm2rau s t4 rtomo oa1op  lueo (0teumxo oudomen nvs s arrrx pnu4apx iociydlaDrl( s;t4alxoif3ta1lm rln s s0 2xrimpou1om  mnvia() 2taurp;u1tltn oetytlm2rmumsnt)aeeoircty1fmDrai s;t)teumimpiodapeemncs t  rua(mo;t1tpe  iciytfa2rlnvon(0 rtrio oodlm rlivo s tetrxo3no4alee ici tfs2raurooo1olt ioctyslm ulumo (4artrir3ia1fptrluvol(0sexo(mpnu4lpeemfvtatfarra( pou1oleomietat mDelnmo u4tetoifcoy1lp  ai i (0seurxo3oydamenmncsl()sDururoot4aptnioeiadfs um(vp;(4aetnmrciydfmtrlu s;t tetriopoydllenlnetat)arrax pnu0aex ii3ias mDelu o;(4 leoxocoadfpt  ivs s  rxrxm3oodom   fctltf rrr(m ;u1tpenmieiat s rl( o;t)aexoircoydomDrli s;s  2trxr3iu4alt livilt  rrm(r ;u4oleomieiltfm2ua( s u0 lxnio3oa1om e ivs t0trxo(rpiodoltelnei s  2ta(ront1aexnmoeiytfsDuluvp t0arermf3ta1oa elnei s0s2urxo3ny4alenlnesa(fs2urur ot0oeto i3iyt m2emnmont0 eermf3iytfmD  n sls0trxmxrpiy1alenmiciatfartrumono1oltoiiciyd sDrmnmo;(4artnif3oodop   uvo;()t2urio no1alee nesa( arum(m ;t4alx ii3tltlsDrl(vs u0arxomo totomtrlues;t)t2ur(m3nu1aptnlfet (  2tm(r ou4alxomo3ilt s raums u)tlxnir3ta1oa  aieol(0 exr(m3ny1amt  nviat artaxmpno4aleo oeiysls2rm(ms;t)trtrmocta1lp  lu sls trurxr oudlmen ncs s) Duru onu4apenif3iadfa2umumpn(0tltnmo3iadlm eauvi;s)t2tmxopnudope  fet (faDraur ot0open fetadlm ea(mpnu0texoiociodlpD lieo;(0seto(mpny4lme livia( aruaxmo;o0tpe  ieilsfmDrlnmo t)altnif3oy1fpD lnvi s)teur(rpoudamt  ncslt)sruaum ;t0oltnmo3ias m rlnvo;t0 exrmociodoa r nei;t)t2urxr3oydap e feiat)a2tm( ooo1alxomo3iyd aDrl(mo;t)altrio3iatlp elues;t0 exrir oo4lpeemfvilsfsDtaxro;u4tpeoifeilsfs2um( p;t4trenxf3iotlpteaneols0srxrxo ou1omte feiasf Dururooo4opx mfeiadfs rlnvp;u4 etnmr3oo1lmt  u i;s  etmxr ou4apte nvslsfa2rru o;o4alx  fetydlsDemn snt0 renif oadlm eaueols srtr(r3iu1open ietls) rtm(r oo0olt  oetatls2eluvp u4 etoxrcoadlaDe ieolt0s2xm(r3ou1apeemieiatfsDtaur oo4oet mfciysfaDumu s t)treoxo3oytfp r u o ( t2uo(opoydame mnetls) rtmu  ou0tlenif3taslm umn snt)alxrxrctatla rau i;s0 euo(r io1altelfvilsf 2um(m ;o0tle mf3tad mDuluvs;t4trtrir oytlpte ueo;t)trxo(m io4llt miciat)srtax oou1altn oeiltlmDra(msnu4aexnxr3iatfa eau o;s0trtmimpoydom emicsa( a2rr( p;u1aeen ieiasfs2rlnvs;() eenio3iytoateauvi;t srurir nu1op elneiltfa2ta(rpnt0tpx  f3ias m uln p u0treoir tydlm e nes (0 2to(r3oo1ole mnesa(f Dua( pnu4texo i3tyt sDumu p;u)aexrmf3iydlmtrliei;t texo(mpny1alee fetl()sDum(  nu0tetoiieildlsDrl( ont0 renxocio1fp e ivs;(  rtriopiudaptn ivtasf rtmxr oo0tlxn iciaslaDrlumont)areoxrciadop r ies;( s2umxr3no1apen netasfaruru  ou1tptn octldfs rmnvo t4tleoircoy1fa elivilt0teumxr ny1ale  ivtlt artmx poo1aeen ociltfs rmnvo (4tltomf iy1lp  anvol(0s2tm(o oo4am nmfvt s  rurxro;o4oetoifciat sDumnvpnt4 etnxo tydlat  u i;t0srxoxo3iydlmenmictat aDrmxmpou0ale  f3tyd aDua( pnu) lenmo3ia1fmt  uei s t2urio3oydlme lneiltfaruaumpot1oet ifcild sDulnvsnt) rermo3to1fm rlnvils0s2xoxmpio1lmtn fes s a2tm(mp;o0alt mi3iyd s2rmnms u4 eeoirctydop ranvilt0s2urim io1lleelnctat)a2rr(m ot0oleoioeils s2eauvp;t4 rxrxr3oytlmDrlu il( srxm(r3iy1op e neilt a2rrur nt0aeenioetatls2rlnmpnt4 lxrif tadlmt lieil(0 2umxmpiu1lp  mfes tfa2rrx ono0oeenii3iytlm2umnms ()alxoxfciadlmt ln s s) rtrimpiu1om n ivia(f ruaxro;u1olenmfcildfs2umuvp (0aetnmo tadlm rlnvi;t t2urir3nydom  mnes s arurxmono4oet iiciytls2rlu s (0 eerir oadomDeau s s setoiopoo1om nlnct sfa2rrxr ;t0tlx ifetyd a rmu s;t0teeomocootoa elnesl()t2urio3nu1lp  miviltf Draxrpou4ape miciydfa uanvp;u0 etrmr3oodlmDraneslt)srxoir iy1am nmfvilsf Duaumoot0tlt if3iytfs um(mp;(0alenmr oy1la  ln i;s t2umimpnudomtn ictat) rtrxr ;u0apen o3tysla2elnvo u0aexoxocoodfptrlnei t  eto(mpiy1lmeelietl(  Dtrx o;t1aee  feiltfs2em(vo;u)trtrmr3oy1opteli s;s sexrir3oydlme lfvsa(fsDtrumoot1oexo fciadls2ul( pn()artniociy1lpt aivs s s2toim3iydlle lncsasfa2uax  ;u0opxn iciydfs2ean p;t0 lxnmfciy1lp   ueo;s  exrio iy1lmeemfct t sDrrxm ;u1apxo feilslm2emnmp;t0altrxr tytlaD lies t)texr(rpou4lleemfvtls artrx poo0tetnifetaslaDem(vsn(4 rtnmfcty1fm rlnvs;t0sexmir oo4lpe mfcta( a2uaur oo0aexniociadls2umn s;u0areomf3oy1op r i o;( sruoio ny4op elivs s)a2tm(r ;u4oetniieiltlm2rm(vpnt0 renxo oodfa rlnvolt texmxrpiu4lmt  nvtl( sDrr(m ;o4ale mociasfs2eln s t)tltrxf oydfaDrlnvsl( texoxr oo4ome  fetlt)arrmxm oo1tpenii3ias m2uln s u)texrir ia1la rlnvolt  etoiopnu1alt mfetas aruru oot1aptnif3tatfa2ranvp u)altoir oytom  lieo;(0 rxo(o ou4lmte icsl(fsDrrxrpnu0aetn feiasfmDrl(ms t)texnxrctotomtrln o t0srto(o ny4lp  mici t  2uaxr ot1tle io3iyd a rlnvp;u4altrmocoodla eaueol(0srur(rpnodlpte nviltf 2tm(rono0aetomieildfaDrlums;u) lxnirctadoaDr neils)s2uoimpou1amee ivs t artmu  ;u4alxnifciytfs2ua( p u4aleoxf ta1fpDr ues (  2xrxmpoo4lp  lfctl(  rurx p;t0aptn feildfaDel( s;t4aetnxf3ty1opteluvi;( srxoimpou1lpte ies () ruaxmp;o4altnif3ilsfa rl(vo;(4altomfctodla  lnvs;s) rxoxo3iydale  ncsl( aruaur ou0apenioetaslaDeauvp (4aleoir ty1lpDr nvs s0srtrio oo4olt  nei tfa2tmu p;u1oex  o3iytls rl( on(4tltnxfcto1fpteaies;s0trtm(m iodlleelfcilt)s2rmu pou4aeenmi3tyslm2ra(mo u0artnmrcio1lmte uvi ()tetrio3oy4op  lfcil(f 2rm( pno0oee  o3iytlm2eanvo;() rxnmf3to1laDeau i s)texoio iudomte icsl( s2ua(m ou4tpto octys a2um(mp ()texnmo3oa1fp   u o;s  rxmxo3oy1al  mict t) Drr( o;t0aexomieiydls eln s (0arxrmr ia1fmt ai o t)srxmio3nu4alee fcilsfaDumu p;o0oeenii3iltfa2uluvp t0trxrmr3totomt  ivil( tetoxm3ny4om e fvsas)sDurx oou0apenii3iltlm2emump u0tlenir to1opte nvs;()sruoxm3io1ol e icil(faDuax o;o4oexnmfeilt sDem(vs;()areoxf io1lp   ueilt)s2xrxr nu1am elneiatfsrua( poo4tlen i3iydlm2rl(vs u0 rxnmfctytfatrlu i;t  2xoxmpoy1ap nlivsl( s2tm(moot4apxnmoctld m2ua(mo;() rtoiocio1op rlivs;(0 rum(rpno4lleemnvt s sDuax ooo4tpx io3iaslm um( o;t0 lenxf oatopDrluvol(0 euoim nodoltelictasfarumur ;o0aetoioetld s2rmnvo (0 lxoio ia1lp  luei (0trur(m nu1lmt lfvia()aDururpnu0alxniieildfa rauvsnu)alenxrcio1oa  lu o;s0texmir nu4omtemivi s a2ra(r oo0olt mi3tysls2ra(ms;(0 rxrxocty1om eluvo s t2trirpiu1amen iesat)sDumumonu4tleomo3iys m2ulu pn(4arxomf3ootfmtran s;t)s2umxrpoo1ap emnvt ()s2tr(r oo4tleo feiadfm2ul(vsnu) rxoxo ta1lmt  neil(0teumir nydopt  ieta(fsrrmu pnt4tltoii3iytlm2rlu onu4alxnxrctatfat lieolt)texr(mpoy1ale mivsl(fa2ra(m ou0opt mf3tls a rmn snt0trxrmf3tatfa   uei ()t2xrxopiu4oltn ncs () rrrxronu1tpeomfctas a umuvp;u) lxoxf3tydoa  li o ()t2xoxr3iydlp n ncs (fs2umxmooo1opt ifetld m2umnvp;u) lxomf todfmDrlu i (0 etr(mpnu1omeemivtl(  Dtm( ono1aetoioetasla ulnvpn(0aexnmf3oa1lmDeli i;s0s2um(opnu4lp nlnes t) Duaxroot0apeoiietydlsDeluvpn(4tltrmocoydoa  aivsl()trtm(mpou1ame lnvia( arururpnt0oeen iciys s um(vs (4tleoir3ty1fp rai o (0t2tmim ou4altnmfviat) 2trxmpoo4oexnmf3iydfa rlu on() rxrxo3iodoaDeai il()trtm(mpou1lme lfesltfarur(ront1aptomfeiyslsDea(vp;u0tltoxo3iydfmtrlieslt0truo(m3no1ll emictls)artmxmo;o1opeoiictld s2ulnvs;u0tltrmocio1fp r ieilt tetrxo3oy4opeelncs s)a2tmxmoou0aexomfctas a2ul(vont4aetrmr3ty1fmD  ivo;t0t2urxo3oodoltnmnesa()aDurur nt1ale ii3iydfa rm(vp;t0arxrxo3oatlp e n s;s)sruoio3io1ll e ietas)s2rrumono4opeoiietydlm rm(mp () eenxf to1oa  lnvo t)srtm(m3iu1om n fvs tf Dtmump;t1tpx  oetytfm2emnvs (0 ltrmf ty1lptrln i ( trxo(o3no1lltnmncsat a2ra(  no4opxn i3tas s2uan p;(0tleriocoadlpteai i ( t2urxrpoo1olen fetl( s2rr( o;u1aee  i3tytfs emn o;u)aeeomr3oa1faD  ivi;t0tetoxopiy4amt  nes t)a2umx poo1ope  oetydfm elnvo;t)altnmf3totom elies ( sexr(m ny4lmeemnci tfaDrmu o;t4tleniietat m2ulnmo (0 rxrmrciodfm e ies s)teurxo3iu4lmtelfct t) 2uax pnt0tltn ietadfa2ulums t4artoir3to1fpDr ivolt)s2uoxrpoy4lpe  ict sf 2rm( oot4apenii3iltfm2umnmo () eenxo oa1lmtrlivo s0 etoir iodal emfvtatfarrmuronu0apt if3tytfm ul(vsnu)aeerio iy1lmt luvi t teumxr nudaleelicil(fsruaxronu0olto i3tlsfaDrm(vs;t4tleriocoytfmDeli s s)srxmir3oo1olenmfctl( sDurum ;t0texn feiat sDuanvo;u) eermo3oy1lp   u ol(0srxmxr io1llenlnes t)a2ta( o;o4tpeo fctys mDumu o u0treomr3iadoa eaivo (  2urxo3oodoltnmnvtl(fsDrax pno1tlxn o3ias aDemu p u4 reomrcoa1la  lues;(0 euoxo3no4opeemnesl(farrruro;u0aet ioeiydfs eanvo t4 rxoir todop elnei t) 2xmxo3no4om elfetlt s2rruroou1ope if3tad a uaumo;u)trtnmf3ty1laDrau olt0trtm(o oydale lfcil(  2rm(rp;o1aeenmfetadlsDrlnvo;t4aexoxociotlaD  n o (  2xrxrpnu1omtn ivtatfs2tr(m ;t0tptnmieilslm uluvs (0tlermr3tytfmDrlneilt0 etr(o3oy1opeelfvilt  Dua( oou0openmo3iysfm rlnvp;t0 etoio oydlpD ln il( trtr(mpiudlltelncilt  2rrx  nu1alxnioetat s um(vo;(0texrir ty1lmteliei ()sexrxopnydaptn fesat) rurxm ;u1teenmo3tltfa ulu s;u4trxoif todfmteli il()sruoxmpny1amenmfvtls artax pou0opt moeiasfsDrlnvo;t0aetrmf iytom   uvo;s seur(rpno1amtnmnvt (f Dtax ont4ole mf3ilt a eluvp;t0 rxoioctatfpD ai s;( tetoir3iudalenlfes (  ruru pnu4teeo fctytfm uln o t) rtrmo iatomt  i o (0srumxo oy4alt mnvtas arrrxrpno4tlen f3iatfs2rlu on()trtrio ta1fp  lneil(0 rur(r3oydolenlfct (fsrrmump;t4opt iociysls ul(mp;() lxoir3iy1fateaies;() rxmxo3iudomteliet s arumx  ou0aleo i3iaslsDrm(mp;(4tlenifcoytfm rau sl()tetoxmpiodal  mfvs (  2ra(mpou1tet if3ildfa ul(mo t0aetnmr3ia1opteaivs () 2tr(m3oydapt lfviat aDrrxmoot1oetnmieias a ean p;t)tlxnxrctodfateli i t)s2uoxm ou1alenmfcs s)aDtax  nt1tltomociytfs2elu s;(0trerir totfat livilt)trum(r nu4lm e netat)a2rau  ;o0alxn octltfaDum(vp;t4tltrmo3iy1oatr ivi;s trxoxm3oodlle lfcsa(fa2umxroot0teeoiociadfs rmnvp t)alxrxrciydlm rli o;( srtoir nydllt  nvt tf 2trumont4tpt  f3iadfs2uaumpn(4teeoiociadfpt lueo t  exm(m3oy1am n nvt t)sDtau o;u4apxomfeilsfsDulnvpnu)trxomf3io1op eaneo;t0srumio iudlm  livtlt)sDraum nu1oltnmoetadfa ua( s ()arerxf3iy1fatran o s  etoio ou4omeelneta( artrxmpnu0tleoiiciad a ean p;t0tlxrxf3tytlmt ln o;s  ruoim iy1alee fcsl(f Dua(m ou0aexoifciyt a2umuvpn(0trtrxfctadfpte u o;s)s2xmiopou4lpt miesl(  rrrur nt0tlxomictatlm2elump;t4artnmrciodfp elivs;t t2tmxo oy4ope lnvsa(  rrmur ;t1teenmoeiytfm ulums;u4 exoxrctodlp  lu il( s2um(o oudlmtn iei t)s2uaum nu4aet mfeiytls2ea(vs;u)aexrir3io1omtr i s;(  ruoirpoo4alen nvslsfs2taxmp;u4alx  fetytls2eanmpnu) etoio iy1laDranes s0 2uo(o3io1lp n iesat aDurxr nt1altomoctasfs2rl(vo;t0aexnifciydfpt luvi;() eurio iu4apenlncils  rra(mooo0oetoiictysls umums;t0texnmo3ia1fmD lnvslt  rxoim3nu1ale mneias arrax p;u4tltn feilsls ulu snu)trtrmf3oodfaD  ivo s0 rum(o iy4omenlfvi s) rrau  oo1tptoiiciatfa el(vonu) etoifctotla eluvi (0 rumio3nu1op  mivsasf rua( pou1oltomoeildlsDean o;u0 etnio totlmtrln i;t  2ur(r3no1op nlici s  Dum(mpnt1opxomoeiytfa rm( p;(0aeenxf3tydfptrauvi t0s2xoim3oy1lm  mfvsat) rrm(ro;o1aex ioetad mDua(ms u4aexomrcty1fa   ivolt) exm(m nu1apenlnvt sfa2tmurp;o0alx mi3iyd aDua( snt0 renmf3oy1optrauei ()trum(m3iu1lmtnmfcta()s2ta(  nt0tpenifetaslmDemumpnt4arxoxr oadfmtrlieo s0setr(r iodll emivt sfs2raumpnt1tetn ociyd s2emumo t)tlxomocia1opteauvs;t  2uo(r ou4ameeliei sfarrr(rono4oltnmieiydlsDumump (0artomr3tytfptelnvi (0teum(r3nudap e fviat)s2uaum ;t4apxn ociasfm eluvon(4tlxniocootlpDrauesls)trxmim3iu1lpt mfctasfaDrrx  ;t1tpeomfciadfs um(vsnt4aeenif3to1laDe uei s)seto(mpnu4op nmnvi ( sDuaum ;u0tet mo3tysfmDrl( o t0 eeoifcoodfmt lu il(0 exoim3ny1lp elici () Drr(m ;u1aptoioctasfa elnmsn(4aexrmf3oy1fm  lueolt0s2urir3nu1aleemfvt sfsrurx ono1oexo o3tasfsDemnvpnu)tetnxo oydfat an s s)t2to(o3iu1lpen nvt t a2umumpoo0alt ifctytla2rln o;t4tetnxocta1la rln o;s0 2xoir nu4lpenmnctl(  2rrxrpou1opx io3tldfsDrm(ms (4alxoio3ta1op elu s t  2to(m3nudllt  fetl(  Dta(r no0opx  fciyd sDrmu s u0aeenxoctytfaDr u ilt teumxrpoo1omtelicslt)srrr(m ;o4opxnioetldfs eluvsnu)texrxfcoytfpteluvo ()seuoir3nu4lme  ies ()s2uaumo;t4tetoii3iltfaDea( p u0aeerxf3oadoptr uvo s0 exoxmpiu4llenlivsat  2uaump;u0tlenioetat mDrl( s;u)aetrxr oadfptr nvsls  eum(o3oo4llte fvs t srtmxmonu4aetnmfetyt m rmu onu) reomf io1fmDrli i ( s2ur(mpou1lpen fvs ()s2tmu ooo0tetniieiasfm2ran snu0alenir3iodop   ueo;()srto(r3oy1altnlnes t)srur(mpnt1aee mietydfs eanms (0alenxfcia1om  ln i;s) etr(o3nydom e ivi s  Duauro;o0teeoiieiaslmDuan o ()trxoxf io1fm rli o t0 exrxo3iu1op   iesas aDtmur ot4texn ociysfa2ul( o;u0artrxrciotlmDe n o t0sexm(m iy4olenlnctl()a2taxr ;u0optoif3tltls eanvsnt0 ltoiocootfptelnes;s s2tr(r3ou4opee fes t sruru pnt1optomi3iydfm2rl( sn(4areoxociydfmteli o s srto(m ou4ome  fesltf Dtm(  ;u1ole  feiatfaDum(vp t)tetnmo ia1laD  i sl() eurxrpio4op   feia(f rumur nu1aexomociltlm2eau snu)arxrmoctodopDeaneolt  2xoim oy1omeelivtat arrr(rpoo1apxoiicilt aDel(ms;u0alxnxrciydlm  luvslt  2um(opoy4omeelnvi (fsrrr(mp;o4aeto oetltla2rlu pn(0tlxoxo ta1om rlnes;t0t2tr(rpnodol   nci tfsrrrurp;u1apto fctad m2rln o t)aetrio3ootfpDe uvs ( trxoirpiudopt  fvi sfaDumurpot4apxn fciatfa2uanvpn(4arerxrctatfp   ieols0tetrxm oudal e iet ( s2uaurpno1tee io3ias a2ran snu)tlxnmr oatfat an i;t0sexrir io1alte nvta(  2rmuroou1altoiiciatfaDranvp (0aeeoiocio1opDeaivi;t trxrio3iu4lpeelieilsfa2rru ooo4tetnmieild s rl(ms;u)aeeoif3ty1fmDelnvs t0trtrxmpiudaptnmnci (f rrr(root1tpt mfeiydla2um(vonu4 rxoio ootlaDelnvi s) exo(m3iydlltn fvslsf rta(  ou1teeomoeildfa2el(ms t0 rtoircoydlpDr u o s teurxm3iydolt  nvi tfa2raxmpnu1openmfeiat s em( p;t)aetnxocoydla ran i t)trxrxr3nu4ope mivta(fsDurx  no0oee moctas m ul(vo (0trxrxr3oodfpteaieil() 2um(o3iy4omt mfcs ()s2rmum ot1tptniicildfsDrm(mp (0 rxomrcty1omt anei t s2tmxr ou4ome mfes () 2taumono0tet  iciytfaDemnvo;u0 lxnxo3ootop  ai ols  2umir ou4ape mici sf Dua(rpnu4tpto icils s el(vo;t0 lxnir oodlm rau sls)s2xmio ny1lpee icia()s2umx  ot4tlt mo3iadla2ulumsnt4aexniocoodoate u ol()srtoxm3iu4amt lfeta(fsDrrxmpoo4aee ifetat sDumumpnt4texomo iydomD auvi s0seur(mpny4am nlivsl()a2ra( ont0tlto oeiyt a2rau p t4trxoirciydlmDr n ils  2trxm iodlpt mivsls) ruaumono1openmi3tlslm ua(vp t0 eerxf iytlm   uvi;s0trxriopiy4al e feilt) Dra(moot4tpe mo3ilt a2rmnvon(4tlxoio iy1oaDrlues t0 ruoiopiu1al e ieta(f 2umu pnu0aleomfeiydfm2el( snt4 etnmf3oa1lm e ies (0teurxm3nudlle  fvtat  2umx pno4ole io3iltfa2eanms;t4 lenxo oydlate uvs;t)s2xmxo iy4am   neil()aDtaxrpoo0tpxo o3tat mDemnvpnu0 exnxfciytfmD  uvi () rtmiopnu4lm n ivsa(fa2umxmp;t4tpx  f3iatlm el(mp (0 lermf3totopDean sl()tetmim3io1omt lfet s a2tmxmoou1tlx mi3iadfmDum(mp t0trerxo iatom  anei;()s2uoxmpoy1om nmnetas srtmxr nt4aeen o3tad m2eanvsn(4trenxocia1op eaues ( srxmxr3nodlpeelnvs s srum(rpno1oetomi3ilslm elnvpnu4 rxrxf ta1om  auesl(0t2umirpoydale  ictl( aDta( pou0texn oeilt aDean s;t)alxnif3iotomDeln ol(  etoxr3iydlmtn nesat  Draxrpno4olto fcildfs eln p;u0 lerir3io1opDr uvo;t  2xrxr ny1al emfviasfs2ua(mono4opt mfeiat a2ea( s u4 eenmfcoytopD lueils) 2xrxopoy1ome  ncta()artaxrooo0olt mo3iytfs emumo t4arxrmo3ootfmD  iei;s setm(r3ny1al emivtlt)sDraxmoou1altnmociyt s rmnmo;(0 eerxrcoytlmDrli s (0texmxo3ou4om emivsat aDrmx o;u4tpt  oeiysfs2rmn o u4arenmrciatla r n ils0teurio oudopenlnesl(fs2umu  ot1oltomfeildfs ranvon() lxnxo iodfateln s;t texm(r3no4op   feiltfsDtrxro;u1aetomfcild m2uanms u4alxoxo3todfaD ln s;()srtoir3nu4omt mnei t) Drm(r ;t1oltomoetld a2um( snu0arerxo oo1lpt ai olt) rxoxmpno1oltemneslt sDrm(m no0opx  f3tad s emuvpnu)tetoxo3oydfatr i o t0 rumxr3iy4omen ncilt)srrr(  no4oexoiicias s rauvs;t)aexomr totoa e ivilt)teur(mpiudlpe licsls) rrru  nt1tpe  i3iys a rm(ms;() lxrmr iodlm rln o;(0tetoir3oydop  mnei ()srrm(rpno1open fctatfm ra(vsnu4 exomo oytfpt an sl()t2um(o3oodap nmnvslsfs2tmuro;o0aexo fctydlm2eanvp;u4teenmfciadoaDr nvs;s trur(r3ny4ame mfetl() 2rmu pnu4tpt ii3tltlm eluvo (4aetrmr3iodfptelnes () rumir3oodomt lfvsltfsrrmxmpnu1tlenifetydfs2rmu p (4tltrxr3oytlpDr ivo;s0srurxr3iy4optnliei t)a2rm(mpou1tpe ioctldfmDulumpnu0altrio3totoaD  n sls  etmxrpno4lmtnlfciltfs2trum nu0tpt  icilt m umnvo t)tleoif tatoa eaieo s)sexr(m iu4lpenlfcsa( srur(ronu0opxnii3tas a2rau s;t4aetrmfciydlm ean ols0s2xmim iy1am  lnes s a2ua(mo;o4oex mf3iltfsDemump u0texnxr3io1fa raueo s)trxr(r3iu1lmtn ivtltf 2ur(  ;o1oexnmo3iltfmDumnmp;t)arermfcoytfa r n i s tetoimpiu4ol nlnvs t  Dtm(mp;t0olt mictydfmDum( o;u4teeomrcoy1fmtr ies;s  rumiopiydlpe lieilt) 2trx o;u4aleomi3tlsfm2rm(mpnu)tlerircta1fateaues;s) 2xmxmpoodameemnvt ( a2rau o;t4aexn octlt s2uauvo;u4altrxr3io1oa  aivs s  2xo(r oo4al nlivs ()s2rrx oot4ale  ocilt m2uanvsnu0 exniociydfp   iei ()t2trxo io1lmtnliei (faDrau  ;o1ale if3tadla2rmu o ()tltrir todoaDeaueslt0trxmxopnu4aptnmivs () 2uau p;t1oltomoctlt s2elumsnt4areomf oadfm rlneo;t sexoio3ny1ale  nvt s)a2tr(rpnt0opt mfcildfm2elu pn(4aeermr io1opt lnvs s0teumim iy1open ict t  2rau o;u1olx  iciadls uau snt)aexrxr totlmtr nvs;t srtmimpoydaptn nct t) 2rmump;u0oeeomietadla rm(vp;()teenmfcoy1latrlnei t) exrio no4llt mfei t)srtr(r ;u0oet ii3iytlsDum(vs u4 etoxf3ta1op r uei t s2tmim3iy1am   fei sfs2uaxro;t4oexomfeiysfa uauvsn(4tlerio3oytopDe uvsl( s2xm(m oudale  fvsatfa2uaxm ;u0alxoioeildfa ua( o u)aetoxocoo1omtr neo ()tetrxopnu1llenmiei s) rur(mp;t1tleoif3tyslm2uln s t)tetrir3iatlpt aiei;s)s2xoir3oydlpte ivilt) 2uaumpno1apxomi3tldla2eaump u0alxomfciadfmt li s s0srxrxrpoo4lmtnlfesls)sDumxro;o1tleomi3ilt m umumo;t0 exomr io1om rlnes (0sexmim3io4lpt lncsatfa2ur( oou1olen ociytlaDumnvpnt4 lxrxfciydlpte uvo s srtm(o3oy1ameemietat  Dra(m ;t0olxo ietltfmDra(vo ()alxoifcoatlpt an sl()s2to(m3ny1opee icil(faDtr(ro;u1tptoiocils mDrmnms u4 exrmrcio1fmtr i o s)trxrir3nydaptemneia()srtmur ou4aet  i3tlslmDeanvonu4teeomr3ootoa e i ols0sexoxm3io1am elics tfsDrm(mp;o0teenmfctld mDrmumonu)alxrmo3iytfmt au olt0 eurxr3nu1lpen iei s)sDtaxmpnu0alxn ieiyd s2rlnmsnu4alxrxr iotfp  an i t0seuo(mpiydop n neta() 2tru ooo1olenmociytlmDum( s;u)texomf3ia1oa eaivo s0teurxo3no1llt  neiatfaDtrum nt1apeo ieildlmDumnmp;u0arerxf iy1op r uvo;t)sexm(mpiudal  lfesasf Drrxrp;u0olxo i3tldlm2um( on(0alxoxr io1lm   i s (  eurxo3nudlmtelfesls)srrmumo;t0tpen ietldla rmnmp;t)tltnmo3tytfaDeai i;t0sexr(o3no1amen neil()s2trum no1alxn fcias sDuluvpnt0aetoxrcoo1lptranvs;() 2urir io4lmt  fvs t)arum(rp;u4tleoiieiydlm2rl( pn() exnir to1op  aieilt0setm(mpiydopeelfetatfsrurxrpno4tpto feiyd s eauvsnu4trtomf3iytoatranvi;()trxrxr3oodlpe lfeslsf 2ur(rp;o4opt ioctasfmDem( p;u0tltrxf oatfm rlueil( srxrxo3oo4ope miesls  Drr( pot4alto f3ildfm ranvp;()teenio iatoa e u ol() rtr(mpiudamtn nciltfsrum(rpnt4tpxo i3iaslmDulu pnu0trxrmf io1opD  uvi t) etmir3ny4apt lnvi s s2rmx pnu4oleomoctytls2rluvp u4aetnxrcoa1lpt li sls0teur(o iodal  mfesl(fsrtaxmpot1oexnioeiatfa el(ms;u0teermo iadop e n i;t)teto(rpiy1om nlneiat)sDraxmono4aetnii3ildla2ea(vp t) rermfcia1opt anei;(0seumiopno4lme lfvsls srumu p;o0tlto f3tyt a rm(mpn(0 renmo3iytlm eluvo;(0 2tm(mpny1aleelicil(  2rr(r oo4alx mf3iadls2em(mp;(0aeerxf3iy1fatraiei ()trur(o3oy1am e iesas  Drr(m ;o1tltoioeiltfsDuau s;()texnifciodlatr n o s  eurxrpiydamte fcsa(fs2rmxr ;u4apenmieilsfm2el( p;(0alxnio3iy1la e u o;( s2xmim3iu1om elieta( arua(mo;t4aeenmo3ilt a ul(mo (4tetrio iatomt luvs;t0sexo(mpou1al  lfvs tf rtm( oou1tptoifciasla2emnvpnt0alenmo to1opDrln ilt) 2trio3oy4aptnlfetlt) Duauront1tleo i3iydlaDea(mont)aeeoir iydoa  auvo (  exm(o3oo4llenmncsa(fsrumx  no1tpt if3tydlm em( sn()alenxrcoo1fat au o;(  2uoir io1al  mivi ()a2rr(  no0oex mo3iatfa uan s () eenio iotfmteanvo s)texmxr iydap nmfci (fsrta(  nt0tpeoio3iad sDrauvsnt) etoxrctytlatr n s;s0seurim nudlptn nvtat)srrm(rp;o4tetomfciytfsDua(vp t4teenxrciodlmDraueil() 2trxr nodap nlivsas)a2tru p;t1apen ietyd m rmnvs u0texoir ootlm r iei;(0s2xr(r nu1optemivi (fs2ta(  ;u0apxn feild m2uau o;u)aeerifctydfa elneol()teur(m ou1ol nmivta(fsrrrurooo1tet mociysfaDel(vo;u0tlerifcta1fmD lu i (  2uo(mpoo1llenmici ()srrm(  ;t1olx ifeiyd aDuan on(0 exnir oadlptr i il(0srtm(m no1ap nmfci s) Dum( o;o0tptn ieiyt sDeanvo u4alerir3to1fpDrlnvi t) 2uoimpny1lptnlnct sf rtax pot4oexnmiciltls2um(vs (0artrmo3iydlpD lueo;t0 euo(o3no1lpt mncs ( artrxmpot1apen f3tldlm2ua( pnt)aetrmf oytfat  uvil(0 rum(r3no4ome lnet ( sDtrxmp;u4apx iieildfsDrl( s t)trerxo3oodlate n o () eum(m3ny1lptn ivsls)s2tmur ;t1aeeo oeils a um( s (0altrxo3ootfpt anvslt0 rtmim3iydape lnvilt sDtrxmo;t4oltoii3iysla umnmp (0tlxomo3ia1opDeaueslt0s2uoimpiy1lleelnct sfsrra(moot1oex iociys s ulnmon(4areomf3totlp  anvo;( srtoxm oo1altn ivs sf rrau p;t1oeenmietatlaDrluvs (4aeeoifcoadlmtr ieslt0 rum(rpoo1opeemiei t)srrm(root4alxomoeiys mDraumpnt4aexnif3todlatrauvs;s0s2xmim iu4al  mfci tfaDtrxmo;o1aleniietatlaDum(ms;() eermo oatfaDrlivi s)srxr(m ou4ale mfci (farua(m ;o4tpxn fcilsfa emnvs u4alxrxr oo1fmD  i s (0tetoxr oy4al e iesatfaDtaxr oo4olxomoeiat s eau o;(4 ltrirctadlmtraueo () rxr(o3iydom e nci tfaDtrumo;u1altomi3iad aDuluvp (4alxoxocoadfaD  ies s0t2xrir3oudamt mivt sfs2ur(mpoo0optnmfeiadfsDrl(vs;u0arxoxo3tadop rluvolt  rto(m ny1lmeemfvta( s2tmxmp;o4aee miciat aDrl(vonu4 lxnxo iodfpDr u sl() 2xoim iydam nmncslt  Dum(rpnu0tee mi3iyd mDumuvp u4 ltrir ty1fat aueslt)s2xmiopnodal nlivil() Dtr(mpot0altomf3tas a2rauvs;u0aetnxf ootomDeau o t0trxrimpoydlmteliviasfaDuax pno4opt mfetldfsDra( o;u0 etoxf3iodlm raiei ( s2uoxmpou1oltemnei t arurxrp;o0teeo oetydfaDemnvsnt4treomocoa1fm raueslt  ruoxopnodameemfvil()a2rm(mpoo4tlx ifeiat a2rluvo (4 rerxfciodoaDe n sls)teuoir3ny1omtnlieiat) 2trur nu4aeen feilsfm uanmon(0trtoir oo1omDranvolt s2xr(mpnodlpte fvt t)s2tmx oot4tptoii3tatfaDrluvo ()tetriociotoatr i olt0 rtm(m ny4alee fvsl(fsrumxr no4tetomfeiytfa2emuvp u4 lenio3oy1oa rauvils  2xmxo oo4aptnlicsa(fsrumx  ;o1tpxoiociysfa uanvo;u0arxnirciydom elnvi ()sruo(mpnu1amtnmfet t  Duru oou1tptn f3iltfm rl(monu) eenif3ta1laD au o t0 etmimpno4lle lnctatf 2trxrp;o0teeo ociydls rl(msnt0arxrif iodfptrai i;()t2umxopiu4lptemncia(faDurxmont0aexniicias mDul(mo (0treoiociydlp elnvs s  2trio3nydole lncilt) 2tmuroou1opt if3tatfm rlnmp u4aexnmfctadlmD  n i s  rtoxmpoo4olenlncsl( srrrx  nu1oltomi3iadfm el( pnu) exnmrcootlm  auvi s  eum(o3oo1ale lnvtls)sDrrx  ot4apenifciadfm uluvs;t) lxrircoadlm rli ils  2xoir3oy4om n fvs t  rtmumo;o4tpxo iciadlaDem(vs (4artoxf3oodfpteau i;(0t2tr(m3io1lpeelneta(faDua( o;u4olxoioetytfm rlnvsnt0 reoxr3tatfpt  nvi ( texoiopoodoptn fcil(  Drmumo;o4tlxo o3taslmDrmumont)altnmo ia1lmD  uvi;s srto(r no4lm emnvt tfaruaxro;u0altomfetldfaDuln p;t4 renifcoodomte n o;(0 rxm(o3io1amt mictas  Drmxrpoo0aeenmfetytla2ulump t0tltnxo3iotlpD lu i s) euo(mpny1ol e ivsasfaDtr( ono4aexomietldlaDrl( sn(4tetrxf to1opt lnei;t0s2to(r3ny4lme mnctasfa2um(ronu1tpeoii3tls s2ea( p u0altnmo3iotfmteai ils) rurxr iy4ale  ivsat sDtmx  nt1aexniieiasfa rmump;u4artrmo todoa  an olt)t2trxopou4op  mivsl( srrrurono1aeto fciatls2uan s;t4 eerifciatfmt lueo s srtoio3nu4lm  lietasfs2ur(  ou1oeenii3tat aDuanmp ()aexrxf ootfat anvi;t0 eurxopnu1lm emnciat  rtax o;t1optoiociytfs2ra(mo t4 exrmr3totlpDrli s (0srtmirpiy1olt  ictls) rumx  ot0aeeoif3ilslaDuanms;t4 rtrmr iy1omD lueo;s0 rxo(m ny1ole  ieia( artau o;t4aex iicilt a eauvp u0treoirciytfpt an s s srurim oydam  lnctat aruaxr ;t4tlxn ictydlm2rlnmsn() rtoxo3oy1fat  nvol(  ruoxo iodap emfcia(f Duaxronu4aeen i3tatfs2rl( p;t)aexoio oo1optraues;t0sexmimpio4lmtn nviasfaDra(mpoo1aeenmociadfa uan o;(0teerxr3todopD  ivo (0s2xmir no4am e ivsat)a2umxrpnu0aeenmo3ildla eaumsnt0 lxrxocta1fpD livs;s s2uoio3oy4amtn fcs () Dta(rono4olenmo3tldla2emumpn(4arxomf3iotla r iei ()sruoirpoy1llt mfet ( sDtaur oo0oltomoctytfm2umnmo;(4trtnmo to1laDe u olt s2urxrpio4ol  lieta(  Dumum nu0open f3iltlmDelnmo;()trtomf tydla   n o ()sexr(opiydol nmiviatfaDrr(ront1tle  oeiadfs rm( pnt4 rxnmoctotlm  aneo;t seumimpnu1lp elivsat)aDraxro;u1aex  oeiytfs ean ont0trerio3tytop  ai olt)s2uoir3nu4ap nlnvt ()aDrr( pnu1ale iicildfa ulnmp;t)artoio totoa  aivilt0t2trirpio1ap nlneslt)s2rau  nt0texo iciytfa2umn p;(4teenxrcio1omDrauvi;s0sexr(m3iy4olt  iet s)s2rmu o;t0tetn f3iytls uanvo t0 ltrmr tatfmD luvolt)trxm(o iydlp  livtas)arrr( ooo1tex iictltlaDeanvs t4areoif3oy1lateluvsls trto(r3iy1ameemivta(f 2rmurp;t1texniieiadls rmn o t4aetrircoydlm eaies;(0s2xmirpno1lme mnvtl()sDrrxrpnu0olt mictlt s eaumo;()arxnmr oadopteaues ( s2xmio nodlmtn ics s a2rru pnu0opxn ociydla umnvsnu0 rerir ootoat  i i s0teurio3oy1ape lfeslsf ruru  nu1tpt  o3iasfa ea(msn()aexnirctodlaD aies (0sexriopno1apeelivtls)sDua(  oo4oeen ieiyt s ul(vo (4 eeoir3ia1omtr n o t0s2urio3oodal  lnct ( srurxm ou1texomi3tys s ulu p;u0artnir3ty1oaDeaneo;t0texrimpoodoptnmfvt (f Drax ono4apto iciydlaDel(mo t) rtoxr3tytfaDr uvolt0texmir3ou1lltnlnvsat) Durumpoo0texomictydfsDrmumpnt4tetrxrcoa1fmD au o;t)t2xr(mpnu4al  lnctlt) Draumpou0altnmietysfs ea( p;u)aleomf oytopDeaivs;s) 2uoxo3oydoltnmfvia( a2rrurpnt0aetoii3iyslaDem( p;(0arxomr oydlaD aieols t2xoiopio4al nlfetltf Dua( onu1tlen octatfm2rlu o;t0arxomo ia1lat aiesls) ruoim3nu1lp n nvsat)srur( o;t0apto fciat s2umnvo;t)tltrio oadfmt lu s s)texoir3nu1olte ivi s) 2tm(  ;u0oeeoif3iydfm2ra( p u0texrmf3todom r nes (0s2umio3iy1amt  nvi tfsrtaxm ;o1tpto fetydlaDrm(ms;u) ltrmocoatlm r n i;( s2um(mpoodllen nvta() rumu pnt0openmoeiytla2ua(ms;t)tlerio3iytla rlnes;s)seurxr3nydam nlneiatf 2um( pno1tleniociys s2rl( o;(4trtnmf3io1om  auvi t)sexm(m oy4lle lnesl() rtm(  ot1ole ioeiyt a ea(monu)arxomociadfpDeli s s0t2xmio3no1ome mnviatfa2trxm ot4apeniiciyt s2eauvp;t0 rtnxf ty1optr neo s0teuoiopoy4llen nci ( arrr(rpno0teeo oetaslm2um( sn(0 ltomr3oodfmDeln s;t  eurxo3no1oltnmnvsasf 2ra( poo4olt  oeiltfmDul(mpnu4 renircoadoaDr ueo;s) 2uoirpou4amee fci sfsrrrxroot4opxnmieils a ea(vsnt4arxrmfciydlmDe ueo t) rxoxo3iy1ope lietlsf rraxrpnt0tle mieildfa umn o;t) rxrmf iydlpDeaieo t) rur(m3io1alt licsas arrm(rp;o0aetomoeiltla rmumonu0alerio oy1fat aues;t0 2tmxrpiydll   nvs (farurx pnt0aee ifcildlaDrau s u0tlxrmfcoy1om   neilt)srtmirpiy4lle  neiltfsrumum no0opxnmfciadfm2rm(monu4arxoxf3iadfate i o;s) 2xmim no1optn fvsat  Drm( pno0oeeomfciatla emn pnt0aeerif3ia1fpDraivi t s2urirpoy1opt  neia()s2ururp;o4teeomicildfa ran o (0texomr3iatopDeli i t setrir3ou1alen netls)sDtrx ono0tpeoiietydlmDel( p;u) rtrir iydlpDe n o;(0 2tmxmpnudlp n ncta() rra(r ;o0aptomfciltla rmn on(0alxomr3tatlm  ai il(0 etmxrpou1amte nvta(fs2um( ooo1tpx ifcildlsDrmump;(4tltrmo3io1laDelu s;() 2tmio oydale  nvilt)aDuaxm ;u4altnioeildfaDumuvonu4 leoirctydop raneo (0 2xmirpoydap nlnesa(fsDrmx  nt1tpeo ieiltls2elumsnu4alenmf tadfp  auei;(0 etoxr3nu1open fcs s)aDtrx  ;o1tpe mocildfmDulnms;t4 ltomf oytfm   n o;t0 exrir nudom nmnvils) 2tau p;o4apeomo3tldfs2el(vp u0aeermo iadomDelnesl(  rtrio ou1omee icslsfartaxmono1oee ifciytfa2uluvon(4alenioctytlpDe ivi ( s2urir oudom  lfvilt)arta( ooo4aptnifeiysfaDrmnvp (0 rermf3iodopD  ivi s)t2tmio oy4ole lieils) Drrx oou4olt mocildfa2rmumo ()teerxo3tatfpDeanvi t) rur(r3iy1olt lncslsfarua(rpoo4tpe  feilslsDelu onu)arxrir3iotop  ai s t0 2xm(m3oydllt lnci ()s2rmu ont4tlxo f3iat a em(vs;u)tltrxfctydfmDeanvs;s setmio iy1ape micsat)sDtmx ooo1tpxn ieiad s ul(mo;t) rxnxr iodfmDe i ols srxmir ou1amenmncils s2raum ou1opx  ociytlm2rl(mpn(0areoxocta1op  ai s;s)s2uoim3iu1lleemfesas)sDraxmoot0apxn feils s um(vp u4 rerircto1fm  lues (0seurim oodalenlfcs sfsrraxmp;t4aeeomiciytlsDrl(vo u4areriocoa1omtelivilt0 exoxo3iu1lm e ivi ()s2rr(r ;o4aptn octasfsDeln p;u4trxnmo3ty1faDe i i;t0 2tmxm3oy4lp nmfcta(  2ururpoo4tetn ictytls ean s;t4tetomfcoodomDrlivslt srxo(r ou4ll nmncta(fa2umxr nu4altoifctlt a em(mo;(4artoircia1omD aieil() 2trio iy4open icias)artru o;t4aetnifciyd sDuau s t4 lxnio ootfmD livo;( setrxopnodalenmnvtat arrm(  ;t0tex mfctysla2rmn pnu0aexnxo3iy1optr nvi;s) rxmir io4omtelicsat  Duaum ;t4tlxn i3iatfsDeanmp t0tltoxo iotfp  lu o;()s2tm(o3oudlm nlnetl(fs2tmum ;o4alxoioctlt a2rmu s t4trermo3todlpt  n ils0 2xrxo3nu4lptemicil(  Dua(mpot4aptn ietldlm ea(mo t)trxoxociadoat  ueo ( trumxrpiu4lptnmfetls)arrauro;t0oetoiietyt sDuaums t0 reoif oydoatranei;(0t2tmio oo1lm nmncta()artrx pnu1teenmo3tltlm emuvon(0 lxrxf3iytfm rlieo t t2trxrpoo4opee neils arrmum ou1altoif3tatlsDrm( on(4texoxr3ty1lmtr neolt0tetrxopiodop elfei ()artmump;t0texn oeiydla2ul( pn(0aeenxr3iotopte nei s0 exr(mpiu1alte nei (  rtr(rp;o0alx ifetld aDrlnms;u4 lxnxociadlp eaneo;() rto(m3ou1openlnvias a2rmumo;o4texo i3tytfmDumn s;t)alxrmocta1lm  livo;(  2trim oo4al elfeiatf rtmxro;u0aetniictat a2rmnvsnu4treoir3oydlpt  ueslt0t2xrxopiy1op n fet tfsrrmumo;t0opt  i3iatlsDra(mo t0artomo todla  lu o s srumir ny1ole lieils)arrau  ;t4olen f3iytla2rln o;t)arerxf3ia1la e ueils  eurir iu4amtn fvs s a2rrxmpno1tlenmoeiad s rlnvp;(4 exoircoadfp elivo;s) 2xmxm oo4ap eliet s  2rau oot4ale  iciadls2rl( on()aetrif iadlpDrlnvi ( s2xr(o3oy4ole  fet ( srumxr ;o0altnifciydlmDem(mpn()trxnxo ta1laDrlnei;t0t2tr(opiydlmtnlnvsat sDtax ono4tlenifciadlm2umums;u4alenio tadlpDrln ilt)tetoimpio1lmt mfeil(f 2uaxr ;o0tpx mociytfm ul( ont)tlenxfcoydlp r neo;(  rxrimpiy4op emfct (fsrurx  nt4tltnii3tydfs raumsnu) exrif iydfa  lueo;t) 2trxm3oy4om n iei (  ruaxmpot4oexoifeiytlsDrlums t4 rerxo todfmD  n s s sexrxr3iu1opeelivilsf Drmxro;t0tetoiiciysls2ranvp;t) leomr3ia1lmt ai o;( srur(r iodomt mictlt)s2rau  no1opeo o3tat m um(vp t)tetoiocoydfatr n s;t)trxrxmpiy1llen nesa() 2trumpou4apxo ociytfs2um( s;u0tetnxo3tydfmD aiei (0 eurir oo4alt mnvia(  2rrxm ;u0aleoii3iysfsDrlu s (4tleoir3iydlmDr uei (0trur(r oodlpe  ncil( sDtaxm ;t4oexomo3tls sDumn s;t4tltnir oatlateluvs ()sexoxmpio1ll nmictatfaDtaurooo0alxo ociad a2ua(vo;()trtoirciadop r uei t  2um(m iy1alenmnct t s2rru pot0ole  i3iydfs ea(vo;u)areomf oodlpD lueo;()seuoio3iydlm nlies tfs2urxrpou0alx ii3iasfaDul(vp t4altoif3iytoat lueo t0trxr(o3nudameemncs (fsDtax o;t1oeeomieiatfs2raumo t0trxrxo oo1faDelivi;s  etrxmpiodamen fvsl( srtmxro;u4apxn ieiatfa2uan snt4texnir tadoptrlnvi;(0teum(m nu1optnmfvias) 2tmx o;u1oexniociys s ran o u0areoir3oytoptraivi t teuoir3iudlm emicia( artr(  oo4ape  o3tytlaDeluvo u4 rxnio ta1fm   i s;( teumxr nydam n iesls)sDra(mono0apx  ietadlsDran p;t0trtnxr ty1laDe ivi;t0srtoxo3oydapt liviasf 2rm(rpnt0ape  o3ias a2rluvp (0texomo to1om  lnvs;s0teumxr3iydal e fctatf Dtaxrpno0tpx iicils mDrlu ont)arxnxr tytomt  nes ( teuoio3ny1am  lnciatf 2um(mono4ape  iciad mDuln snt0aeeoirciydfpteanes (0srumxo3ou4lle micias  ruaxroot0oeeo f3tytfmDrlnvsnu4trtnio oy1oateaivs;s) 2tm(rpoo4ol nlfcs ()sDtmx onu4altn o3ildfm2emnmo () rtrif3ia1oaD  uvs s srumio3ny1al   fvs s artrxro;t0ale  i3iysfa2rlnmont) rxrmr iydlm raues s) etoxm iy1open fvta(  2tmu o;u0altnmoctlsfmDelu onu)aetomf io1om  auvil(0tetoxmpoy4om e ictlt)srrax
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;t  rtmxopiudamte icia( arrrx p;t0oetn ieilt sDeanmp;(0tltrmo iotoptran s;t)trtmim3iu1lp nmnvt tfsrrmump;t4tle mietlt m ulu s;u) etnmf3oodlmD  uvs;(0seuoxr3nudolen fctlsf Dtaumo;t0oetomieiyt m em(ms;t0arxomoctotlm e u ils)t2xr(m oy4lmt lfes t)s2tm(  ot4tpt  oeilt sDelnvp;t)trtoxrciodlpD au s s)texrxmpoo1lle mfcias sDraxmp;t4oee ifeiyslsDulumpnu) ltoxocia1lpDe u s;s0truo(mpno1olt lfet ()sDumxr nu4tet  oeiatls ulu o () exomf3tydfmtr ieils0trxrio3iudalee ietltfs2tmumo;t4aleoioetadlmDrmnvonu4altoir iy1omDeai il() etoxr oy4ole mnvtatfartrx  oo1apt  o3iadfaDum( pn(4aexnmocoo1lp elieo;( sexrxrpoo1lpe  netat s2rm(rpnt0ape iieiyd a rau o;(0 rxrxr tadlmDrai ol()s2toxopou1lm e fci t)srrmxm nt1opx mictad a rmnmo u4 lxrir3ty1fat auvolt0srxoiopoy4amenmfcs s arurxmp;t1oeeniicias m umumo;t)arxnxf3oadopDeanes;s0s2um(m3ny4omtemfetl()arrr(m no0tpx  feiyslm ulums;()arxrif3iotlaDelnvs t sruo(r no1ol eliet s sDta(mono1tlxniiciyt a2ua(mon(4arerirctytlmtelneol( seuo(o oudole mncsas sDtrxm ;o1tpe  ocilt s ulu p;(4tlermr iy1fpDeanei s)trtoim oydoptemieia()s2rax  ;o0alx  ictaslmDrm(mo;t0tltnxo3tydom  lnesl(0t2to(mpnu1apen fci s)artr(monu0oltoiietldls2umu onu0alenmr tatoaD aues s0setoio oo1oltemfetlsfa2taump;t0olen i3tydlm2ranmp ()trermr oydomDe neo;( seuo(o nu1lptn fviat)arrm(  ;u0aexo icilslsDrm(vo;u0alxoxr3iydlmD  neo;s  2toxmpiy4ol nlfvsls s2ua(rooo4aexniieias sDra(msnu)trerir iatla e ues s0texoir3no1opte fes s)a2rmxm ;t0aee  icildfa2em(ms u)teerio3iy1op r uvs s)t2tm(m oo4amtn ncsa( srrm(moot1oetniietysls2rm(msnt4tlenxo ty1lptrlnes;s0 rtr(m3iudopeemfeils arrmxm ;u4tet if3iys aDumn ont) eermociadfa rluvsl(  etmim nodlltnmfesls)sDrm(  nu1alxnioeiydls2rl( s;u) eenxf3iatlmteaieslt0seumim oudal elncil(f rrru oou1apenmi3iyt m2rluvs;()alxomocta1omte uvs;s0teuoio no4apeemfet s  rrrxrp;t0ape mf3tydls2um( snt0aleoif iy1optrln i s tetr(opiu1llen fcils aDra(ro;o0apeomfctltls el(msn() exoxo to1lmD  u i;t0 rtrir iy1oltelivtlt sDra(  nu1optn fctlsfa2uau snu4 leoxfciotlaDr iei t0srxrim ny1ol   fvtl(  2rmu o;u0ale moeiysla2emumo t4altoircootlm elu sls0 euo(rpiodlpen net (farrmxm no4aexnif3tldls2raumpn(0 rtoxocoadlm elnvslt tetrir3nydlltnmfetl( s2trxrp;u4aexomi3iytla2emuvpnu) eenxoctadfpt  neols)s2uo(mpnu4apeemieia(f Drr(r ;o4aptniieiyd a um( p;t0tetrir oy1oaDr nes;s)srtoxm oodam   ics s) rrrum no0oexnio3iytlaDulump u4tetrxr3oodom r neils0trto(m3iy1amtnmivsas)arua(m ;o0apeniociydfa2uln o (4teerxf oytlm  ai o;()t2xrimpiodop  mnvia() rurur ;t4aet iieild m2rluvpnt0 lenxr3iytomtr nei ( s2to(rpnodlmtn ncs sfa2rmxmoou1tpt  ieiatlsDrauvp;(4tetoxo3iadfatrlnvi (0sruoio iy4ll nlnvsasf rrmx  ;o4tee moetlsfsDul( o t)treoif ia1faDeli i s  2xmir oy1openlnct t)aDum(root0ope  oeiyd s ea( snu4 rtnirciodlpDe u s (0 etrim3ou4amt  ivtat) rum(m ;o0tpxniociyslaDumnmsn(0tltoxociadfpteln i;(0sruoio nudome licsasf rtaurpnt4olen ociltfm uan p t) etnmrcoatla r n s;s  exrim3oy4al n nei tfa2trxmp;u1aex ifeiad sDua(mp (4 rtnxrcoatlm e n sls0srtoxo3nydame mici ()arta(rpoo0alt  i3iydlm rl( pnt)tleoxr3tatfp r uvi;()t2xm(opou4llt lfetl( aDtm( onu0aet mf3iadfa2ul(mpn(4trtnmr3oadfmDr nvi ( t2xmio io4op n nesl(  rra(mo;o0ale if3tltfa uluvs u)teenir oytfaD  n ols0srxrir3iudlltemfeils  rtm(m ;o1olt mf3tlt a rmnvs;(4 ltnio oy1omt ai i;s texr(m oy4lmtnmfet s)s2rm(  ;u4opeomoeilslsDumnvo t)tetnmo totoa eau slt) rtoxr oo1lpe  nvi t arraxmpnu0teeo ieiyslmDel( pn() rtrio ty1optraneils0seumim3nu1al emnet tfarrmuro;u4tpxn i3tyt mDelnvs (4aetnxo3iydfaD  ueolt0 2tmxopno1lmenmfci ()srtm(  ;o4tltn ieild s2uanmp;u4aetrio3iydoatelnvs t0 2xrir iu4amte ivtlt aDuaxm ;o1olt ioeilslm eln o u0 rxrirctatfm r nvolt teum(rpnu1opeemfvt s aDrrurpnu0alx ifctys mDean snt)tetrmr3ootoatr ues;( teuoio oo4olenlicsas a2rmxmp;u1tlx mf3tld s2rln pn() ltrxr3oo1lp rln o;s t2xoxopoy4opeelivslsfaDumu  ou4tpx io3iys a elnvs;u)aleoxr3ia1omtelivilt0srto(opio4ol nmfvilt  Dua( o;o4alx mociltlm elums;(0altrmrcty1fp eaies t teum(opny4lpenlfctls s2urump;t4aeto fcilt sDrluvpn() rtrmr3oy1omDeluvols  rtm(r3nu4amt lfvi tfs2rr(r ;t4ale  oeils a2uanvpnt4aexnmr3tydlaDraieol( srxo(m3iy1altn ivta(faDrruro;o4oleoio3iydls ean snt4trenxo3ootomDraieils0srurxo oo1ole livtasfsrua(mo;t1aptnmoeild m2el( p (0aetnxo3oo1lm e ivs s0srxmxo3iudlpe mfet s  Dtax p;u1aetnmoctytfa2elnmo;t)tlxrir iadfm elivsl()seuoirpnudlmtn nci ( aDrm(m oo0oetnmi3ilt sDrmnvpnt)tltrmr totfp r uvs;t) 2xoxmpiy4lpeemnet t a2rrx  no1opxnii3iyt aDea(vp;t)trerif3tytoate uvsl(0 2uoxo3no4opte ieilsfaDururo;t4tex iicils s2emnvsn(4tlenircootfatean i;t0 rtr(m oy4am nlnctat) Duaum ;u4apxo o3tydfsDran p t)teeomo3oytfm r i ols  rumir nydlp nmfcslsf 2uaxroot1tee  f3ilt aDemnvpnt0aexrxrcoa1fa rlnvols) 2xrir3ny4apt mfvtl()a2rm(rpnu4ole  o3tasfmDran pnt4 lerxocoy1lm e ivslt seuo(r3io4altnmietls  2rmxmp;t4tlx ifeiltlm ua( pnu)aetoiocio1fmD aneolt0trur(m3io4am  mncia(  Durx pno4apx  o3iad mDrmumsn() eerifcoydlp ranvo;(  2toio3oo4amtemnvt t srua(mp;t1alen oeiysfs2ul( s;(4trxoxf iy1lpD  uvs t0t2toxopiudlltemivi t  Durxmonu1apx iictas s2elnvs u0aleniociotfmteluvolt  exmxm3iy1lm e ics t s2ua(r no4tlt moetat a rl( snu0 rtrmo3ty1latrlnvsl(0teur(r oo1op emfetl()a2um(mpnu0tet  i3iytlsDel(mp;(0texomociotlpDrauesls  eumxr3oudlpte netls) rumu o;o1olenii3iatls2raumo;t)teerxocto1omDrlueo;()s2umxopoudam nmicil() 2trumpoo0aeen i3iys aDrm(vo u0 rtrmocoa1lmD liei (0 etm(m oydape mieiatfaDtm(rp;u1aex mfeias aDemu p u4 eeoif totlm raivi;s s2urxm3iy1lptnliesl() rrmxrooo0olenifctlt a2uanvo;t) rtrxfcta1oa r u s (0 etrir3ou1aptnmnvia()sDtaum nu4aeto i3iadlsDulnvsn(0treomf oa1om   uvs;t) eurxrpou1om   ics s) Drm( oot4apt moctld a rauvon(4areomociydop  luvi;t teuoir3oudlp nlnetltfaDumuro;u0tlxn oetat m rm(vont0 ltomf3totomtelu s (  2xo(m nu4ole mneils) Draxm no4oleomfciysfm2elums;u4alxomo ootlm  au i;t)t2xmxopnodapt mieta(f 2uau ooo1alxn i3iytla rau sn() rermo io1omtrln olt0 rxmimpny1ame  fvi sfsruaurooo0opeomoeiyd mDeluvpnu0aleoxocoa1fptelneolt0t2tmir3nodllen fei t sDrrurpnu4apx  ietytfsDrmnvont0aetrmo3tydlpDean i;(  exrxr3io1lmtelicil(fs2uaxmo;t1oeeo fciltfs2emu p (4tltrxocoytopt auvs;(0t2tmio ou4lmeelnes s artr( ono0olen fciltlaDua(vo;t0tltrif todomt  ivi;t  2umxrpoo1ll e ict ( sDrrxm oo1alt ii3ilsfsDuau pnu0 rtoxocoy1fatrli i;s0 rurxr nodam elivilt) Drauront4olxoioetadlm2emn on(0teermf3iatfp rli o () rto(m3oo1opee fes s  2uaxmono4oetn icildla2rluvo (4aeerxf3oodoaD luvol( teur(o io4op nmivsas srrmum oo1oet mocild m rlumo ()arxomr3iotfpD  ueil(  rxrir3iy1aptn fcta(f rum( oou1texnioeilsfa rmuvsn(4artrxo3io1omte i slt setmir iu4omenmivil()aDtm( p;u4oex mo3ias sDua(mo u)tetoifciotfp r uvo t) rxoxm io1lle lnvta(  Duaump;o0apxn o3tls aDeanvsn()teenxfciotfatrlu s;t tetr(m3nodlpt  nct tfs2ra(  ;t1oexo i3iatfs uaumont)tlxoxo oodoatr n s;s t2xmiopiydal emfeiasf Dtrumooo1ape  oeild a2umumonu4tlenxfciadlmtelu s ()srxrxm nydlm emfctat)sruaumo;u1alt mo3iadfaDemu s;t4aetrmo3oydfmtr ivo;(0 eurim3oy4opt lfcs (fs2rm(m nt1ole  feiyt aDum(ms;u4teerif to1omDeau s;t trxoim iu1apen feilt aDtmu o;u4tlxomfeiasfm2ua( o (4 rxoxf tadfpD  nvs;()srtoir ny4ll nlnctl(faDumuro;u1teenmi3iad sDul(mon()teerif iodlm   ieo;s0 etoir no4lp emnvt sfs2rmumpou0olxomoetatfmDrmumo (4aexrxf totfmt lnvils0srxoim ny4lpt  nviasfs2um(  nu1tptn i3tltfaDelu s;u0 exnio3ia1fp   nvolt) exoxo3iodlmeelivi sfaruauront4aex if3tasla rmnmonu0tlxrxf3tydlm eauei;s)srtmio oydlpen ietl(  2uau  nu1tet mfeiyt mDrau p u)arxnmr3iotomt  uvo s)srxm(mpnydomt mfvtlsfa2rm(m no0aetoiieiysfa eanvs t0alenmr iadfp e uei;(0 rxoxopiu1apeemictas)sDrru pnt1apxo ieilsfm2ranmp t)alxnxoctotlp e ivs (0setm(o no4altelivsas)arrm(rp;u4tpt  ocild m ulu snt0 rtnif3oatlp eln sls0 2uoirpoy1omenlneilsf Dtmxm ;t0oleo fcildfa ua( o;t0aexrir3to1op  lu o t)setrxmpou1aptnlfvsl( srraxmpoo0tpeomo3ias s2rmumonu4arxrirctodopDraieo s tetmir3nu1ll  mnvsa(fsrrmxmoou0tptomiciltfa el(vont0 ltoxociotlmtranvo;t s2xo(mpno1oltemivtls sDtr(mo;t1aetoiociadla2ra(vsnu0altnirciotfa   ivo s0 2xmxmpno1op emieslt) rurxmoot4open octysfm2ua(vpnu4tltrmo3iytlpDelueo ( truo(opny4am  mivs ( srrrurp;u0tpen i3iadls rlnvo u) rxnmf3io1lpD anes;()srxmxmpoydamtnlnvi ()sDurum ou0aet  octatfs2rl( s;t0alxrmr3tatlp  lnvi (0t2toiopno1aleemivsat  Dtm(rpnu4opx mi3ild sDul(vs;(4 lxoir3iodlptraivsls0 rto(r iu4amt mivtat)sDumuroou4texo f3iat aDelnmont4arxrifciodlpteln o;() rxrimpoy4apee fcs t)srtrumo;u0opt  i3tyt sDumu p;()arxnmr iodomtrlu o t  etoxm ny4lltelnetas a2tmum nt4tetn octatfs2umumo;()artnio iadfmD lnei t)srtm(o3iydomenlietls)aDtm(rpno0olx io3iytlmDuau o (0 eeoxo3iotlpt  iesls)trxrxr ny4alt lfesa()artru pou4tpx miciat m2eauvpn(0trxrmociotopD anvs s0trxrxo3io4altelnvils) 2tmx  oo0olto ictytlm2uluvo (0 ltnmr iadlateli i s0 rur(mpno1lp nlfvsl()srtaur ;o0tlt mfetytlm2ranmo (0tltrmo3iytlmDraues s) eto(rpou1am nlici sfaDtrxrpnu1olxo oetys m em(monu) lxoioctytomD auvil()t2toxrpio1oltemfcsat)s2umumpnt1alxn iciaslsDra(vsnt0 exnirciytlmteln s ( teumxo iudol n net s  Dtaxmp;u0oleoiiciytfa raumsnt0treomr3oodlptr nvi s0trxo(r3nu1lptn nci sf rtaurpoo1aleoifeiatls2um( p;t4artoio3oo1fmDr ueo ()setrio nudame miesls aDtr(  ;u0tlxnmfeild m2ulumsnt4 rxoxfctytfmtelu s;s0srxr(m3nodlptemnesa(fa2umx  no4opt  oeias aDelu o ()aeenxo iotlpDean o;(0 ruoirpoydoptnlncsa( sDtmu pnt4tpeo f3tytfa2uaumonu0arxomf3io1fpt  neils)trtr(r3no1om elnetat  rum( poo1tetn o3iysls2rm( s;u4tltrif tadlp rlnes s teuoir nudlmtn nvtl(fsDta(r ;u4opxoif3ild m2elu snu4aleoxo oa1lpDrli i (0s2toxopio1apte nvsl()artmuronu1aeeoiieiatfs el(mp t0trtoxo3tatopDr ivi ( trtr(m oy1lmen ivi ()arrm( o;t0opx  ociasfmDelumo;u0 exomrctadoatr nei;t srto(opnu4am nmiet s sruaur ou0aetnioctysfmDeln onu4 lxrmfcto1omt aieils t2triopoodame lfes (fa2uax pnu0tpt ioeilsfa rm(vs;()aeeoir oy1fatrlu o;s0srtrxo oudlpenlfciat sDumum ;t1tltniieiatfsDuauvsnt0 eerxr3ia1optrln o s)s2xm(m iu4lpenlnvtatfs2urx oou0oexo oeiydfm2um(vp t4aexnmfciy1lp r nes;s  exoxr nudap nlfvslt) Dur(  ;t0tpt  f3iat m uluvpnt4 ltrxrcia1fpt  nvsls0setmio3oodllee nvtlt a2umuro;t1apxomocias sDeanmsnt4artrxr3iy1lpDeaieil( texoxmpny4oleemncslt)artaur ou0tlto ociydfs2ua(vo;(4 rxrif oa1fat lnvol() ruoxrpoy4lle lfet sfa2ra(mpno4oet  ictlsfm2emumonu) rxriociy1lmD  ivs;(  rtmir3nodoltnliet s s2uaxm ot0aee micildfa2rauvs;u4 ltrxr oatlmDeaues;(0t2tmir3io1oleelfcsas)srur( o;t4aet mociaslm eauvsn()arenxf ty1lp r uvilt)t2xm(rpiodoltemicia(f rta(m no0oetnifciys m2rmnvp t0aetnmo iodlptr n o t) eurim3ou4lmeemivil( sDtm( poo0ole io3ild a2ea( pnt0trxrxf iytoaDrluvo;t0 rxmir3oodlmenliet sfa2urxro;t0texomociyd m eau p;u)arxnir3to1laDeluvi;(0setr(m3iy4olt lnvsa(  rrrx  oo4tptnii3tldls ul(ms ()tltrmrcoodoa r n i t teuriopiu1lpt liesat s2rr(mo;t4optn fctldfm rm( o;() lenmf3oydlatranei s)setr(r3ny4aptemnes s s2umxronu0oex mfciatls rmnvont4teerxr3oo1oaD an ols s2xoxr3no4aptnmnvt s)sDrmu o;o1tltnmfeias mDulnms;u)aexnxf3iydla raivo (0 2xr(rpoudlmtnlnvsl(fsDua(r nt1apt miciydlaDrl(mp t0 exrxo ta1fm ran ols) rurxm3oy1lmenmncsat s2rauroot0aptomociaslm2ulnmont4alenmfciatomDrai i;t)srxm(rpny4aleemictl(fsrtrurpnu0tlx ifetls m2ra(mo;(4 rtoir totlptraueo;()t2urir3ou1ome miei t)s2trur ot1opeoifciydfa2rmuvo;(4 ltnif3ty1opDelnvo;s0trxmim3oodolt lfetltfa2rmx  ;o0aetn i3ildlmDeauvp;(0tetoxo3oadfp e u ol() rtmim3ou4apt  feil()sDur( poo0oeeo ictys s2ulnmo;(0tlxomf iatlpDe uvol()seumir no1lmtnlnctls) 2ra(mo;u1oetnmf3iytfaDulnms u)treoxr3iadfa  ai ils0texrir3oudlm n iet t s2tm(rp;t4oet ioetasfa uaums;t0tlxoxoctytoa   nei s0trtrxopiu1al emncils) rumum ot0oetnifeild sDulnvonu4areoxr tatlmDr ues;t)tetmxm nu4lm n fcs (farraxro;t1alx  i3iys a rlnvp;u0arxnmoctatlpte i sl() rtmxo no1op elietlt)arrru o;t4optnmfetad a rm( p;()alxomfciadlmD aivol(0 rxmiopiu1alt  nctls) rurxm ;o4oeeomoctytfsDrln s;t)tlxrio3oodfpteanei t0tetm(r3nudaleemfetasfsDurum ou1opx  ietltfaDra( snu4 ltrmfciy1fmDeanvils0 etr(r3iodome  fcs t sDtm( pno4opt  o3ild s ea( o t4trtoifcia1fatelivs s0teur(mpiudll n icilt) Dra(mono4aetoif3iysfa rmumsn(0tlxnxf3tatfpDe ivi s0 exm(o3nu1lm e fcilsf Drau  no1texomictydfa rlnmo;u0altnir3totlmDeaivs;(0 rxm(o iu4lle  fetasf Dtaxm ;t4oleniieils sDraump;u)aeeomo3iotlaDeluvi s)s2xm(r3ou1lpte ivsa(fsDrax pnu0opeo o3tlt mDulumsnu)arerxo3tadfpDe ivslt0 exr(r3nu4lmtnmici tf Drr(r ;u4aptnifeilt mDel(ms (0alermoctatlmtelnes t srxo(mpoo1lltnlnctasfs2ra(ronu1tltn fctldlm2rm( s;t0aexoiocoatomt lnvslt s2xmim3nudll nmnet ( sDrm(moot0oee iietysfs2rmn s (0tetoir oodfm e nvolt t2to(m oydol nlnvia(  2trxrpno4aexoiociaslm2ran pnu4aeeoir ta1lmDrluvi;s srxo(rpiu4alen fvtl()artmum nt1teeoiietyd m rl( pn(0 eenmr tatfa   n i ( s2umxrpno4opt liviatfsDra(mp;t4oee  oeiad a2ra( onu0artoxf io1la e i s;( trtmxopoo1lmenmnei () 2umx pot4opx ifciadfs rmumsnt4 rtomf oatlpt lu o t texo(r iy4ol emfvtatf 2uax  oo4tee mfetldls2rl(vs;(0tlxoxo3ty1oaDeaueo s t2xr(r oy4om n neslt arur( oot1oeenmoctatfm emnvpn(4 renio3ta1opt  i s s)texoimpiu1optemiviltfa2tr(mont1tlxomieiat aDrl(ms t)texomr3oo1lpte ieol(  2trxr3iy1am n fvslt  2trx pno1aeto o3ildls2el(mp;()tlenxf oo1lmteln il()s2trim3iydlm   nei t arrmx  ;u0tex iieiysla2uaumpnu)aleomf3to1lmD lnvi;t) 2xr(r oy1lpe lnviat)sDtaum no4tltoifcias m2emnmp u0aeenxr3ootfateaueilt)trxm(opnudal nmivi s srua(m nu4olxnmf3tlt s emn p;t4texrxr3iotopteln o;()s2xmim ou4al eliet t) Dua( pnu4ope ioctysfsDel( o u4trtrmf3oatfmt anvs () exo(o3nodamtn icils)srtrxmpnu1oeeomfeiydlmDuln pnu0tetomo todoaDelnvo;(0setmxo io1llt lfeiat sDta(rpot4tlenmfcilsfm eanmo ()tlxnmfcty1fmD  ivi;()texm(m3nu1olt mnvsa( sDtr( p;o4olxoiocildfsDemnmpnu4 leoxfcto1lpt  iei;s t2xr(rpnudapt mivtlt)s2tau ono4aex mf3ils m2eaums;(0 eeomo iotoatr n s s)sruoio nodaptelfcta(fsrumxmoot4tetomiciad sDuanms t0aexnio iatoateanvo;t)t2umio io1ape livsas sDuauro;u1tetomfeild a eauvp (0tlxrio3oa1omDelu s (0truoxopiu1lmt  fci s) 2umxmoot0apt  fciydlmDrluvs t0altnio ia1optrlivo;s0s2xoxm oo1llee nvilt sDtmxr ;t1tetn fetyt s eauvsn(0trxoxr iy1lpDraieo s0srxmio no1om  lfvsasfsDurump;o1teeomf3iat mDrlumsnt4 exnmo iy1fpt anvols0setmxo oudolen ivtatfs2tmumont1tlen iciasfs ua(vp u0teenmr3io1lmDranes ()srxoxr ou1amenmieiatfaDuaxro;o0opt mi3tlsls2ea(msn(4arermfciydfat  nei;s)t2xoirpio4aptnmfet s)aDrrxrpno0altomfetyslm ua( p;u0alxoxr iatopt an s;s0srur(mpno4lpt lnesltf 2rrur nt4aexomf3tat m umnmp;(0 etrio iadfm eaneslt sexoxm iudomtemivt s)sruaurpoo4ape mf3ildfa ulnvs t0 eeoxf totfaDrau i () euo(o oydlle mnvil(fsDraxrp;u0aexnmieilslaDua( snt4aeenmf3tatfpD auvs;(0t2xoxo iu1ll elicsas s2umu  no4oet ifeiytfs elnmp;u4trxoif iy1omteluvo (  etrxm3oydlmtnlieiltfsrra(r nu4aptnmieilsfa2emuvp;() lenmocoadomDelues;t  2trxr oudomtemics ()s2urxroot0apeoioctls m eluvp;t0alxrmrctotla eaivilt)tetrxrpou1llt  fcia(fsDtm(  ou1aee mo3iytlaDumnmp;u0 renif oo1fpD ai s () 2uoxo3oodomee fvilt srrm(mp;t4oltniociad a2em(mo;u) rxnxr3ty1fpD  nvo ( sexmir3iydamtemiesat a2ra(  no1aexnmoeiasfsDumuvsnu)teenmfctytoaD ai o t)s2xrirpnodalee icsas)a2rmu  nu0opx  icildfm eau p;t0trtrxf iytomtelnei;( texr(rpoy1amtn fcs sfaDrm(  ot0altnif3tysfaDrlnvonu4 lerxf iy1optr iesl( t2um(m ou4olte nvs ()a2uau  ot0aeeo iciasls2umn s ()trtnxo io1fmtrlivs;t0tetrxm oo4ope  icslt  2ur( oou0tex  iciat sDrmn onu0 rtoif ta1fa e nvo s  rurxrpou4apt licslt) rtr( pnt1teeo o3tldfm2el(mp u)alxomo3oodlptr ueolt0trtmio iudlmeeliviatfaDumur ;o4oetn f3tltfmDraump u)arxrmo iy1omtraueo;s)truo(m3nu1ol   fesl( artaum ;u1tetnmo3ilslm eaump (4trtrmr iatfmDe i i ( s2trxopoudamtnmictat)sDraumonu0aptn ictls mDea(vp (0artrir iodfa   ies;t setrim3oo1al  lnetltfa2rr( o;t0altomicias m el(ms;t0trtrxocto1la   nvs (0seurxr iudam  lfcsa() 2trurono0texo oeiasls em(monu4texniocio1lp eluvs;(0teuo(r3iodllte fvtlt artaurpot0aptnifciasfsDuln p t4aexnmr3to1fptrau olt0 rurio iu1lpe lfeilsf rraump;t0teenmo3tls m rl( s u)treoxr oodlaDelnvs s)s2urimpiy4lmtnmicsa(fsDua(rooo4oleomi3tydlsDulnmo;u4trenio3oydlaDe nvs s0t2xm(rpiu4op nmnvsls a2ur(m no0olx  octldfmDem(ms () exrxocoatfmtrlnei;s seurim no1ole mics tfs2uru p;t4ale iietatlm em(mpn() eerif3oydomDrlneo t0seurxo3oudap elictls s2trumpou1alxniieils a2ranms t4aetrmrctydfpt  ieo;t setm(rpnu4ome  ivs tfsrururoot4teeomocildlaDum(vo;t0tetnmr3iydoa eau ols0 rxrio3iu4olt  nes s)s2umu o;o0tpx mociydfa ul(vo;u4arxnmr3iy1opDe u s;(0tetoir3io1lm nlfeias)aDrmu ono4ape  i3iad sDelnvs (4 rxnifcoy1latrlu ils srxrim3iy4lpen fet s  ruaumont0optn ictytlaDrauvsn(0 etrio3ia1fm   i i s s2trimpny1amen nvt ()arur(mo;t0oex ifctld aDemn sn()aeerir3totoatrai o s0 rtrimpou4llee feil() rta(rpno0oexo i3ils m2um( p ()artomf iytopDeauvs t tetrxr3iu4optelnetat  Dumur ;o4tleo oetldfs2umn s;t4 ltnir3oytlmD  ivsl(0 2tr(m3nydlptnlfvil() 2tm(  ;t1tptomo3ildlmDua(mo;(4 eenxo iydfptrlneilt0 euoxo3io1amtnliesas arrrx  ;u0alenif3tlsfaDrm(vo;u4tlermociadlpD  u o;s) 2tm(mpiudamt micslsfs2trx  ;o1alxoifctas a emu s;u0trxomocto1fa  au s;()teuoxr no4opt mfeta(farra(m ;o4tpxn feiydfaDrmumsn()altoircoodoat  u i s)trtoxopou1amtnmnvtl( artrur ;o4tpen fctysfm2um( p;u0 leoiociatlp raivol(  rxo(r nu4aptelncia(  2uaum no0oeeo f3iadfm rm(mpn(0artnxo3ia1om rlnvols0 2xrim3oy4ale  fesa(fsrrmxrono4apxnioeiasla rmuvsnu4artoif iydfpD ln s;(  rum(m3ny1lme mivil(  rra(rpot4olenmi3iltlaDemnvs;(0aeenmo io1oa e iei;t0 rxrio oo1lp elfvia() rur(m ou1olenifctydls ul( pn()tltnmfciotoa eli olt) 2tr(r3ou1llee fct t) Duau pot1tpx ifciltfm ul( s;t0aexrmociotlaDelnvo;t s2uo(mpoodlmtemictlt s2rmx  nt0ape  fctat a2eau snu0trxrxrcoytoaDrluei ()tetmiopnudop  mfct sfs2uaxmpou1oeeo oeiyd aDulu sn()altnxr oa1laD aiei;( seuoim3iodal  mivils a2rrur oo0apt iociyd a2eau on(4aetriocootlmt auvil( s2toxo nodamt licsls a2rr( ooo1tlen iciadfs ea(mp () renmr iy1oaDelueo;t) exoim io4am n fcsasf 2tm( pot1tpen f3ilt a2um( s t4 rtrifciadomD anvs (  rxmxo nydlmen fcslt)s2uax poo1alx  ieias s uanvs;u0alxrxr to1opt  ies;t0srtm(mpou1apt mfvsas)aDtmxr ot0olxomoeilt a em( on(4 etniocoydoa e nvo t0 etmxr ny1alenmncslsfsrrrxr ;o4tle io3tatls2eauvo;u4trenircootlaDranvi;s)s2urirpio4opt  fci t a2uru poo1tpt mfctldfa2ul(ms u4trxnxf tydlm elu s s sexrxo3oo4ome mivs (fartau poo0tpxo oetldfaDrluvs;u0tltrmo3tytlatrli i ( s2uoxm3oudlp nlnetl() Drrurono1aptoio3iytla elumpnu0arxnmo iotlpteaivsl()setoim3ny4ameemicsa(  Dta( p;t0alto fctysfa2rmnms;t)arenif3iatoaDelueslt sexrio3nudom  lnvtas)s2tmx p;t0apeoioeiat m emu pn() rermfcoodlp  an s;t s2urio iy1openlivi tfs2uru poo4apxniicilt s2uln p;t4aetrxo3oadlp  liesls)t2xriopio1lptelici ( s2umu pno1tlx  o3ilsfmDemn o u)tltnxfciadfmt lnvo s s2urxrpiodlptelfcias srrruronu0oeen oetadla ul(msnu0 eenmf todop   i i;() rtmio3nu4op  mfctas s2uru  no1aeenmi3tldla emuvs;t) exrmr3oa1lmt  neo s) rxo(o iydamenlicias)arua( ont1apxo o3iatls2rau p;(0tlxoxo ty1lp   nei t)srxoirpnodap  mfeilt artr(mo;u1tleniieildfmDem( o t4altrio3todopDr i i;()srxm(o nydll nmnetlsf 2taur ou1oet  i3iat a rlumsnt0aetomf3tytfmtelu o;t0 rur(opoy4am e fvtls arumxmpou4tpeoii3iadlmDelnmp;u0 rxoxo3io1fptraivilt)tetmir3nodlptn icia()sDurum ou1teenmf3ildfa2emu pnu0teenir3tatfp e ivi s srxrxr oo4op  mnct (f rumx pot1apxoio3iatfaDea( o u0tetoxf ta1fmtr u o ( seurim no1om n fet (  2ur( oou4tex ioeildfs um( pn(0trtnio to1fm ran o t)s2umir3ny4oltnmfei t  2ur(m no1olenmo3iytfm emuvs ()texrmo iodla   nvo;t tetr(m no4lmenmncs s  rurxmpno1teeo o3iatfm2umnms;(0artrxfcoy1lpDe i o;t) 2ur(mpiudam elncsa() Drax o;u0tlxomictydfa2elu s (4aeermr oytopteluvi;s)sexoim nydlpte nesat  Dra(mo;o0tpx  fetysls eln p u0 exoir3iatfmD ln il(0texrxo3iy1olenmfvt t sDtm(mpno1oleo ocildls rmumsn(4tetrxr3tytfmDe i i;()s2xr(r iudlp nlfesa() Drmxmpoo0alenifeiad mDeln p;u0arxrmrcia1lp eaueo t0t2tmim3oy1ome lneslt artm(r nt1aleo fcils s rlnmont4texrmf3tadomte n s t0sexmimpio4oltemnvi s artru ono0apxn oeilsfm2umu o t4 rxnxrcoa1fpteli sls) eur(opnydaptemfvsls  2tmx pou0aex iieiltfa2ua( onu4arxnmo to1fat lieo (  2xrim oy1ol  mieilt)aDraxrono1tlxn ictad s2uluvo;u)teenxf tadfpDeaues;s0sexmio3oudoptemncsas)aDrru oou0tet ioeiasfm eln onu)aexnmrcta1fpteanvo;(0trxrir nodamtn iesa()srua(rpnt0tltn i3iydla2rl(vo t4 exrxfcoydop elieol()truriopoy1ale  ivsl() ruaxrp;t4tpxn fetyd s2elnvsnt4 lenxr oodfp  aiei;t)tetrir3oy4oltnlici tf 2taxr ot1tptnii3tyd m rln o (0teeoio3iotom  auvols  exmxm3io1op  mnetl( s2rmumo;o1alxniociltla em(vs (0artnirciotlaDr u i;s0s2xo(m3ny1lp  lici t a2rr(mo;o0teeo f3tyt aDrlumo;u0alenxr oydfp r u o (  etm(m3iydlptemfetls  Dtrxm ;u4oet ifetyt a uln p;(0trermfcoa1opte nvi;(0sexr(opio1ll emnes ()a2urumpoo4tlen oetydfa2em( p;()aetnxr io1om   nes;s srxoxm3iodlptnmfesat artr(  oo0olxoii3iatfa2ea( pnt4 etoifcoodfmDelneols)srxrirpiu1lm emnci (  2umuro;o1open i3tydlm umnvpnu)tlerir oa1omtrlneils0srumim nydlme lneils a2rr(m ot4tleo ieildls2eauvo;u0tlxomr3oadfptean s t  eurim nu4ole  nciat)s2urur ot1tetniocild a rmnvs;t4 lxrifcoa1lpte nvsl() rtm(m nudlptn ivi ()arrrxm ot4texomfeiyt m rm(mp;u4 leoiocoadfa rluvslt)srtm(r3iu4llt mnvi ()a2taum no4aex iiciatls rlnvp;u)trxoxr oa1latrlies s  2xm(r no1omt  nct s s2umxr ;u1alenmfcildls eanmpn()trtnifcta1fa  ai s;s t2umxr3iudaptn nci t)artr(mpnt1tet mfeiasls ea(mo t) lerio3tydfpD  neolt) rxo(mpoydlmt mieiatfa2ra( p;t4olto f3iyslm2umumsnt)arenxocoatfpDr u s;(0 eumir3nu1lptelnetas) 2rru ont1tpxomo3tldfs2ul( p (0treoifctotlpteaneol( srtrxm3oydam nlivils aDraum ou1opx  oeiyslm um(vs t4aeermr3ia1fat lnes t) euoxr oodomeemivt s sDtm( pot4alxo f3iadfs2rmumo;()aetnxociy1fpDeaivs;t truo(r iodapt licslt)srum( ont1olx mietld s rmumo;()artoiocio1fpDr n s;(0 etrxo3nodlp nmfesls)arrrxr nt4apto ictydls2rmn s;() etomfciydfaD ln i;s  2xrir oodal n ici t)srraxrp;o4oet if3tls m2uan on(4artoxoctodfaDrai i;t0truoim oo4om   ncta(f Dra( p;u1tlt iiciatls2uanmpnu) lxnifctytlmtelu ol(  ruoxm oodll   fvt s artr(  nu4aexoioeiyd s2rl( s;u0 exnmf ootfm rlneo;s teumio3oo4lpeemfci s)srtmxr no0optoifeiytfaDul(vp;u0treriociodfpD li i ()srxr(m nu1ol e iei ()s2rm(mpot4alt iociltlm elu p;u4texrmociytfaDr ueilt s2tmxo3iodlmt  ivs (fsDrrxmpoo1apto i3iad s rm( p;u0 eenircoa1oat lnvsl(0t2uoxm3io4lmee fei (  Dtmxrpot4oexn o3iaslsDelumpnt4 exrir iotfm rluei;t s2toimpno4ale  ncias) Durx  ;u4teenmociytfs emu p;u0 lenxo3io1op eaivi s  exrir3iu1amtnlfet t aDrr(  ;t1apx moetldls2ua(vp u) eeomocoydomD  nvs (0srtm(r3oudlp   nct (fsDtmu ooo0olxnmocild s em(vs;u0 rtniocia1fmte i o;s texoxmpio4am   fetl()aDtmumpno0tptn f3ildla rau s;u0alxnmo3totlmD an s;s truo(mpiodomtelieiltfaDta(ront1ape mfeiydfm em(ms u4arermfcootlp elivo (0 ruo(m3oy4op e ivsls sDta(m nu4oleomoeiltfaDrlu o;u4 exoxrcoo1lm   nes;t0s2tmiopno4ame lfcta(  2ra(m ot0olt mfctls a ulu snt4areomfciotoa   ivslt t2xrio nudlpt lfeia(fs2tm(rpot0olto o3iyslm2ran s;u)texnxf todfptr i s s trtriopoodap n ncs s)a2tmu p;t0tleoiiciyd a el(vp (0 lxrif3ia1fat  i s;t t2xr(rpnodole mfcilsf rtaxrpou4alxoii3tys m rm(vp;(0aexnmr iodoaDrlnvi;( sruoir no4op emfesa() rur(rpno0tptnmf3iadla uln snt4tlenircty1opD anei t0 exm(r3oy1lmeemfvil()a2urxro;u1aleo feildla eaumsnu4aetomr tadoaDe i i;t)tetr(o3ou4ope mfvsl( arrru oou1tpt if3iys s eanms;t) etnmo oodlaDranvslt)s2xmim3iydopt lici s arurumpnu4alt  fetldfs ulums u0teermrcoadfmDeaueil( trtoio oodlmee fcsl() Drmxmono0tee  oetyt a rluvonu0 lxrir3oodfaDrlu i;s0setr(m3ny4ame mivsa()arua(r ;o4texnii3iadfaDrl( o;t4 ltrif oy1late uvols texmxrpnu1apen neslsfsrtm( o;o0aexnmfciyslm2um(vs;(4 rtnxociotlm e ueo;s  eumxrpnydom   neiltfarta( o;u1aeenmfeilsla2rm(vp;(4aexrifciotfat  u ilt)srxrxm3oo4lm emivs s) rurx pnt4aeeo o3iltfs2ra(mo;u) rxrmo3iadfa  livs;t seurxr3no1ome  fct t)srtrum ot4opxo fctyt a umump;(0arxrxrciytfate neol()truo(o3no4ole  fci t srrmx pnu0tpt  oeiyt mDelnmo u0tetnxf3iytopt  uei s seurxo oo4lpt  ictas) rtax  nu1oeenmfciydfa rlumo t4 lxomr3tydlmD an sl(  2toirpiodlmt miesltfartr(  ot0aet ioetldfs emnvpn(4aexrxfcoadlmt liesls0 2tm(r3io1ame mfcil(  Dtaum ou0oeeomf3iytfaDuan ont4arxnircto1optean s;t t2trxm no4al  mietl()srrrum oo0alx mociyt a raumsnt) lxrxo oadlmDrlnes ()t2xmxmpoo1op nlnesas) 2trxm nt0tlen ieildls emumo;t) leomo iotfp e u s s0srxmirpnu4olenlfcsa(fsDrm(monu4ape miciadfaDeanmp t0 ltnio tytfpteaivo s)teur(o3oydalee ivsls artmx  no4tet iiciysfs el(vont)trxomfcoo1op raiesl()setm(r3iydol  lfctl()sDtrxm ou4apxnii3iltla2eanvs t0 rxrmr3to1fatrlnvsls seurir ou4ll   neias sDtr(m no0alxniicild m ra(ms t) rtnxr iatlat  ivols)srurimpiy4ale livs (fsDtr(r oo4apenmoctltfm2uluvpnu4 eenmrcio1lp eauvo t tetmimpiy4ol  lici (  rrrx p;o0texomociat s2rm( snt) rtrxocoy1lp rauei () rxoio iudlpt mfesa()sDuaxmo;u0oltnmfctadla rln o;() exomr iadoatr ivi;s  exoxo3oodam  mnvtl( a2uax oou4tetoiieiat s rm( on(0treoxo3tydfpDe n ils)trxmir no1lp   iet s  Dumumpot0aeeoiicildfm ulu onu4 eenif oytlat  nvilt) rxo(opoy1om   fvslt a2tm( o;t1ale mi3ild a2uan p;u)teeomfcoytomDrau s;( srur(r iodopte fvias)s2umxrono4ope io3tysfs umnvsn() lxomf3iotfa eli s ( t2umio3no4ale livils) Dua( o;o4aeeo ieilsfm2ranmp t) lxoxr3tydlptrli i;t s2to(m no1ol   fet (f rtm(roou1tpeoifciltfs2rmn o;()aetnxo iotfmtrli i s0 etmxo ou4al elnctlt)srur(mpno1alx mfetasfmDeau p u0areomrcoo1fp r ivs;s sexmxo nu1lmeemfei ( aDtmu  ou0oleoifeiys s rau s;(4tetnmf3totfpDelivo;(  rxo(mpno1ope miciatfarum(moou4apx io3iysfs2rm(vpn()areoxf3totfp  livils)s2uoxr oy4alenliesasf Drmxrono0optnio3tys a elu o (4 ltnxf3oatfatrlnvsl()t2umio3iodap nmicilt  Draxront1aeto iciltls2rmn snt0aexnif tydlmD lnei;()srtrxo3oo4llenmfvt s) 2rmx o;o4oeeoii3iyt aDrm(vs;u0tlxrif io1lat  iei;(  etr(m iu4ol e fci t arrr(rono1aetn feilsfm rmumo;t0aleomfcia1fmt  ivs t) 2xoxo3oy4lmee fetat  rtaxm ;t1alxoioetasfa emnvpnt4alxoif tatla  livs;s)t2umio no4lmt  nvi t)sDurum ot1optoiictytlaDelnmpnt)alxrif3oa1opDr ivo;s  euoio3nydamenmncia() rumxmpnu4apt iietatfm ulnvs;t4tlenmr oatfmDrlnvi;s)sruoxr oodop emictl(fs2rr(r ;t1oexn o3iad a rlnmpnu4trxnifcoo1laDe nvs;(0trxr(mpiodopte fctltfs2tau poo1oee mictldfmDra(monu4trxnir todfaD  uvs s) rxoxopny1lm  mnvsas)a2taur ou0tpxnif3iydfaDumu p;() eerif3ty1laD lieol(0 euo(o ou4omenlnvslt)s2taxm ;o4tetnmietas mDra(vont0arxrif tytfpDe ivi t  rtr(rpno4lmtnmivta(fs2rrx o;u0tetnmoctatfaDulu snu0altrxfciydom ean o;t) 2trimpnudaptemfctls s2urxmont0tptoiociadfa ranvo;t0tlenxoctydomDr u ilt0trtoiopoodopte ietl(farraxmooo0texoiieilt s2el(vpn(4trxnmo iotopDr ueo s0srurir iy1lmtnlivsas)aDtr(mono4tlxn f3tys a2uaums t0 rtriocty1la ranei;s) eumxmpio1ale  icta(fsruaur nt4tpxoio3iydfmDemnvo;t)alxrxo3iotfaDelnes;t)trtrio oy1apenliet s s2um(monu0aet mf3ildla ra(vsnt0aexrio3iodomDr uvs;s0srumxm oy1llenmictas)s2raum ;o0opxnmi3tas sDua(vp;t0tlxnmf3iatfp elieols srxo(rpny1ome lnvsatfaDtrxm ;t1tetomiciadfa2ul(msnt) rtniocoo1opte n i s  eumimpnodal  mivtlt)sDtm(rp;t1aptnmfciatla ulu snt4 ltrio iadfa raivo;(0tetoxm3oo1omen ivs s s2uru pnt0oetoiociys sDulnvp u0 rerxo3tydlm  lnes;t  exmim3ny1ope mivslt)a2trxm ;t4aet  iciatlsDra( s (4teenxrcoa1laDraiesls  rtrxmpiy4lltemfvilt sDumxm nu4tpeo feildlm elums;u4aexrmr3iadfp rlnesl(  2uoxr ou4amt  ietat)s2ur(mont4opxnmfeiydlm2ea(vs u) eenif todfpte u s;t)sexmir ny4om nmnvta(fsrra(r ou0teeo o3tadfmDul(vo u) eerxfciodfmtranvo;s0 2tmxr3io1optelfcsa(f rtmur nt1oet  i3tyt a ranmp t4altomo iytlat liei t)sruoim3ny4lmt livtls aDtaumo;u1tetnii3iad mDelumpnt) rxnif oo1fptelnvi;t  2uoirpoo4lpe livtls sDraxr oo1tlx if3ildfs elnvo;t0 exrmr ia1opDeauvi s  2xmxopiy1om elfviltf 2ta(roou4olenmf3ias a emumsn(0 ltrxf3oo1fmD  nei s srumxo ny4ap nlics ()artau  ;u4altnmfeiatfs2umu p;u) lenmo3oo1lmtrlies;( seumxm3nodaptnlfvslsf rur(  ;u0oltomfcildlsDul(vs;(0 lxomf3oydfaDrlu i s)trxoxo ou1alenlivils srumxr oo4aee  oeildlm2ran o (0tltomf3todfa eluvi t) eum(rpiodole  iesat aDrr(rpot4tleniociat a rmnmo;u0 rtnxo3oydfmDrlnvo;t s2toxo3nudamtemncsasfaDtr(mp;u1aetomf3ilsfs eluvsnt) eenifciotop rliei;()t2to(r oo4am n fvsa(f rtmxrpno4apxnifctytlm2ranms;u0teenxfctatlm  lu s;t trtrxmpno1oleemfeiltfs2urxroot4tet iietaslaDulnms;(0altrmo oadfptrluei t0s2to(o3nu1ll nlfctls)a2tmu p;u1aleo ieiaslm uanvon(0aleriocio1fatelivs;s0 exmxrpio4opte nei tfsDraxmp;u4tpxo ietad sDean o;t0 lerxo oatoptelneo s0setmio3oo1amtn ies t)s2tr(m ot0oet mfetltfa ea(mp;()artnir3ta1lm  li o s0s2xoim oudoltnmfviltfs2ur(monu1tpxnmo3ils sDemnvo;(4aexrxfcoytla eliei;t)trumimpoo4ameemiei ( srtaumonu4texomieils s rau p u4 rtomo oodoa r uvo;(  rto(m3iodapeemfesat) Drrxro;t4aeeniieiytls2ea(vo u0 leoif3todfmDrlivo;t0srumxmpoydaltnmfesls) 2umuro;o0tpto f3taslmDemums t4trxoio tydlat an sls0s2ur(rpny4op nmfvil(  2tmx  nu4ope  f3tatfs um( p u4arxrifcio1lateai o;s)srurxr3iodolt mivs (faDumurp;o1aet mfciysla2umuvo ()alerif ootlmDrlu i;s t2xmim3iy1omtn ivsl()s2rm(  ;u4apto oeiyslm2uan p;t) eeoxr oytfmDr iei;t  euoirpny4lmtn ivilsfs2ta( p;o4tltomoeiltlsDum(vp (4teermf3oytlat li i s srtmio iu1apte nctlt  2tm( p;o0opx mi3tys s rl(mo ()altrmoctadomD aues (  2toxo iy1lme lfci () rumx onu0tlxoiieils sDuluvs (4 eeniociadfa eaivils)srtmiopiu1lle lneil( srrmu pou4altnioeiadfs elnvs (0 etomrciatlp   uvo;t  eurim iy1amtnlfci tfartrumonu0oexn octydla2uln o;t4trtoxocia1fpte u slt  rtr(rpiu4lmtemfvslt)a2ra(m ;o1apxo o3tasfs2rauvo t4 ltoif ia1fp  lnes s0seto(r oo4omt mfvi s  rraxmono0tlxo o3ias s ul(vp t0 lxomo3tytoat  n ils  2tr(o iu1altelfei tfa2rr(mono0olxo i3iltla2uanvp t0alxrxf iodfm elueol()s2urxo3nydoptnlieta( s2uaxr ;t0olenmictyd m2emn s;(4trtnirciodlmDelu sls) rtmirpiy4olt mietl( a2trxmono0ape iociltlmDelnvs;u)alenmrciy1fp elnesls) exoxm3iy4ap  lnctltfsrtmurono1tee moetasfa rau p;t4 lxoxr3ia1fp eai ils s2umio iodape livtas sDrr( pou4ale if3tadls emnvsnt4 lxnxfcoy1lp  anvi ()tetmimpoo4apeemivs s) Drau o;t4oee mi3tydfm2rlu sn(0aexnxf3oo1fa raieo;(0teuoxmpiudlpeelnvta(fa2rau o;t0tpe ii3tadfs ranmpnu4 lxnir iytlaDeai ilt)texm(o iudll nmfetls aDtrx pnu0opeoioctysla rlnmp u0artrir oatop elues;s0sexoxm ny1lpenlfetlt aDrmurpou1tptoiociysfs2em(mp t4 eerxo3oodfp   uvol(0trtrio3iudllte fciat srrrx  ;t0ale mo3tltla eanvon()tetrxo3iy1fp eauvo;( t2uoxrpnodame lfei s)srrmuro;t1tpeoifciltfs rln s u0aexrxf ootlatelnvol(0texoxopnu1ol   fetatf rtru pnt0olen i3iydfs2ra( p;t4teerxr3oatfmtr uei t0 2tmiopoo1omee ietl(f 2rmu pou0tee  ietlsfs2uanvont)arxrif3oy1fm r u sls) exoir3iodlle lies () ruaxr ;u4opxoiocils aDum(vp (4tlxnir iatfaD lues;t  2uoxm iudap nmfvsa( s2urx poo4apen o3iatls ulnmpnu)tetrxr iy1lpDeau sl( s2to(mpiudop  licils artr(mpno1tex  icild a2rauvo;(0aetomo iotlmtraivo;s trxm(m3ny4apenmics sf 2um(mpno1aet ii3ias s uluvs ()trtoxr3oytfp r ivs;s  2umxr iu1ol n nvilt)s2ta(mo;u0ole  ictadls rmn onu0 renif oytom rlu o;(0 rxm(rpiu1omtelnetas aDtr( oot4apxn o3tatls2rlnmo t0 rtrir3iy1lpteliei;s t2umimpny4op emfctl( artaurooo0olxnio3ilslmDuauvp (4tleoio ty1omDe neolt0texrxo oy1llenmncsasfsDtmur ou1aetn octldfsDrm(vp ()treoxociydfpDrlies;t0trurio3ou1ol  lfeslt)srrrumono4oetnioctls a rmumon(0 leomr totoaDr uvslt0srxoiopou1lptemict s a2uax p;u1apxomo3iyd a emn snt4aeeoxocoadoaDr ueo;()t2toim ny4op emnct (fs2tmxr ou1tpx ioctydls2rl( snt0aexoxf ia1fptrlu o t  eurxr oo4apenlfet t  rtm(mo;o1olxomf3tadfsDra( ont4 eerxo3tadop rlnvsls s2xrim iu4ope  ietat aDuaxmont1oeeniieiasfs2eluvs;t)treoif to1oaDeanei (0s2xrim nodalt  fvt s)a2tr(r ou1apx mieildfsDem(vo;t4 lxnxf oydfp   n ilt) 2xoxrpoy1lltn nctatf 2taumonu1aeen ieias m2ra(vs;(0 eermo iydoaD aneo;s) etrxmpoudomeemfcta( s2ua( p;o1oet mictyd aDrlump;u)aeenmr iadopteaiei;( t2xmio nodlmt  ncils sDum(m nt0altomfeilsfa2el(vonu0arxomfcoodopDr ueolt) rtmxopou1op n fet ()sDum(  ;o0alenii3iad s2ua( s t) lenxf tadom  lieols0 2tm(o nudope  netl()s2tmxro;t0oex mietyslmDrlnms;t0texrmocoo1lptr neo t tetrxr iodlm elfesat  rraur no4oexomocildfa rmnmp t) rxnmr oa1fmDrluvo;t0trurio3nydap emics t)srrmuroou0opt mfeiyt s2rmums (0 rtrio3ootfa r i o;(  ruo(r3nu1lmtemfcia(f rraur no4aexomfciydfs2uau p;()texoir3iatlmDr uvi;s0truo(o3nodll emncs tfsrrr(rooo0alx ifctas a2ulnvo;(4areoxr3tadoat auvsls  2trimpoy1am n fcsas) rrrum ;u1aet ifciad a2ulu pn(0tlenxrcty1optrlu s s  exmxrpoy4lpenlfctlt aDrm(moot0opt  iciyslsDrln p;()trxriociydlp eaues (0s2toirpoo1altelivt (fs2rrx ono1tlen i3iys a2rmnmonu4arxoxfcoatomt aivs t0srurir iy4lmt lncs ( sDtrumpnu1oet mf3iyd a elnmsnu) reoxr3ootfmt  ivsl(  eumxmpnu4om emfvtas arraurp;u0apx ifciltfs2rm( pnu)altrmf3tydfmDraieo t)seumim ou1op e fcs (farua( poo1ale  ieiyt sDel( p;t4trtoirctotlptr nvs;s)t2toxm3oodol e nei s) rtmx  nt4texnmictadlm em( s;t4aeermo iatlmtrlnvi;s  euo(o3oudll  lncs sfsrrrxmonu4tpeo octysfaDra(vo t) rxoxfcoadopt  u sls0trumir oydlptn ictltfs2umumpou4aleo octydlsDeanvs;t0trtnmf ootfmD lnvil()texmim iydopeemfctas) 2trur nt0apt mictld mDeanvo;u) rtrir totlpDrlueo () rtrxr3oodop nlnetltf Drau pot0tetnmfetyt sDeau o;t) lenxfciotfp elnes s0t2xr(o oydlmeemfvslsfarrmxm nu0tetnmi3iyd s2uluvo;t) exrircoydopteliei;t0srtoxopiodolenmfcsls  Duaxr nu1aee mo3iatlsDrm(mon(0altrifctytomD livi;(0trxrxr ou4ap  livtatf rrrxr ;u1tex  ietys m2rluvp t4altoifcty1omDrlu i;t0srumxo3io4lmtnlicia() 2ra(mpnt0opxoiiciyd aDra(vo t4trtnxrciydlat aueolt0 rtrxo3oo4lptelivslt s2ra( o;u4apenifciydls em(vp;(0trxoio3iy1lateai s;s0t2tr(m3nudol   ncsas)arrmx ont1tet  ietaslm rl(vp t0teerio tydoatr u s;()s2xoxr3ou1opt mfesltfa2uru onu4oexnmiciasfs rmnvonu0 eerif oydlmtrluvilt)t2tmxr ny1olee fvilt)aDtmu  oo1aleo i3iltla el(mp;(4 reoxo3iytomDraneolt seuoxr3nudopen ivta()a2rmumpnt0tex  fcias aDemnvs u)aetnxf ootfat  neo;s srxmir3oy1lm nmncia(  2rau poo1ope  o3iytfs uauvp;t)arxrxf3oo1omDeluvils)srum(rpiy1optelnes s a2rruro;u0aeen o3iasfa2ul( on(4 rtnir3tatfpt lueil( s2toxrpiudoltn ivsl(  2rr(  no4tpeniictyd aDrlumpn(4aexrmf iytfmteaiei;s)s2xoxopno1lle  ivias  rtm( pot0teen o3tlslm2rmuvonu4altomo3oo1op rln o;t  rumxmpoodlpenmfcilsfsrtmumo;u4apx  feiad a2rlu s u0aeermf3totlatraiei;t  exoxrpou4ll  miciasf rrru pot1aee ifcils a2rmnmont) lerxf3iytomD li s;t)trtmio3oudap emfesa(fartrur ;t1aptn icildla el( p ()alerifctotlat  u i t sexm(opnu1altnmivtatfarurxmp;o1alen fctytfsDea(vsn(4 leomf3oadoat ln o s) eurxo no1lpenmnetls artr(mpnt0opx miciytfs ra( ont0alerif iotop   i ols)truoxmpoodapeelncslt s2umurp;o0opxn feiys s2ua(vp t4tltrio oo1lp raieo;t  eum(m3io1ll nlnvtasf Dtax pnt4olx  iciyt a2uau o (4trxomr3tydomDeaivsls)trtmxm3nu4omen ivilt)aDuax pot1apto oeiltfm2ul( onu4tlenxo3iytlp elneo s)srto(o3oydll nlnei () rur(moou4aee mo3tys m emnmpnt4 lerxrcio1fm elueolt)sexmxo iy4lme lnvs tfa2rm(rp;o0apx  f3iltls umnmo;(0aeerxo to1oa   uei;s t2xmxmpoudol   fctl(f 2rmxrpoo0ole ifetydfa2rl(vs;(0aexomf3todfaDelu ils  2ur(opou1optemnes (f Dtaumo;o0apto i3iyd aDem(von(0texrxf3ootfa   ivsl(0t2ur(r3oo1ale  fesa(f 2trx  ;u0aexn fcias a2rl( on(0altriocoydfmD  uvs s0 etmimpiu4ameemnvslt) 2ra(  ot4aeto ociytlsDrln pnu0alxomocootoa  li olt teur(r iy4op  lncta() 2uaumpnt4oetoiietatfa ra(vo;(4 lxnio tadopDelu s ( truoxr ny4amteliei ()aruaxm ;o4tetomf3iltfa ea( p;u)trerir oa1oatrln sl(0 etrxr3iu4oleelfcsl(fs2ur(m oo0ope mfeilsla2umn p u) rermo oy1fmD  nes;() 2trxrpiodlltnmnesl(  rrmx pnu4aeenmfeiyt m2umu p;(4 leoxf oytop rlivsls0texoxr3oo4lmtemietatfa2ururooo4tlx  i3iytfa ua(von(4trenmf3oatlmtrai il() rto(o nodol nmfvsas) 2raur ;t4oleoif3iltls2ul( s u)aeeniociatoatrauvilt0tetm(o oydlle lneia(f 2trx pnt0ope  feiadlm2eanvs;u)trtnxociodfmte nes t)s2xr(mpiy1olenliesas) 2tr(r ;o4olt mieiltlsDrmnvo;u4teeoioctadopD ln slt0seurxopiy4lltnmietatfs2uaxmoou1tpe  ietas a2rm( pn() lerifciotop   n ol(0setmio3nu1altnmiei ()s2uaum ;t4ale  fetldlsDrmn p ()teenxr3oa1laDranvolt) euoiopoo1om n nvta(fsDtrurono0opxomfeiasfsDeanmpnt4tltrmrciotfaDranvi;s  rur(o nydop  licta(f rrrxm ;t0apx io3iyslm um(mo u0 rtnio iy1omteauei ( tetoio ou1am emnvs ()a2ra( onu1olto oeiyt s2ranms u0 renircto1lmD ln sls)srtr(m iudam  livtat artm(monu0aeto fcilt m2eauvsnu)trtnmocoytopDe nvo;t0s2tmxo no1openlfcta(fa2trurp;u1oleo oeiyd m2emu o (0altrmociatlmt ln il(  etmio oudalt  ncsasfartmu p;t1apto fcilsfmDuaums;t) lxnmocoodfptrln s;t0s2tm(mpiy1ome  ieia(fsDrauroot0olxnioetydls rmu p;u4trermo to1fp eau ils  2tm(mpny4ape lfet ()aruaxrooo1tlt mictatlm2emu pnt) lxrmo to1om   uvo;t0srum(mpiydlptnlnctls  2rm( ooo4alxoifciytlsDrmnmp u) rxriociytlatr ies s0tetrxopoy1lmte fes s  2ra(mo;o4olt  ociysls el(vs;u4teermocoadlatrlnvo;(0srtmiopnu4op  mnetls) 2tr(root0tpxoioeild mDua(mp (0tetrir3oy1fatrlnvo t)s2xmim iu1omt mnvt sf 2uru ont1tpe iictasfs2ulnmpnt0 reoif totomDelues s0 2toiopoo4aptelfcsls  rtmxr ;o1aetnmiciltfm2umump;(4trxrmo iytopD  ues;t0trurxopny4opte nvils) rrr( onu0aleomi3iytfmDul( p (4 etnif3iytlmt  ueo;( texoio3iydameelicias)aDrmu  nu0oltnmiciydfm eaump;t)tlxoxr3oy1omteai ol(0s2ur(mpoo1amte neslt a2rrx  nt0apxo ieiydfa rauvo (0 rxomocoadlatr ieolt s2toimpnu1amtemnctl(faDuaurono4aexn oetatfsDeanvo u4 etnmo ty1la r n olt0teuoxo3oo1amtnmivi ()sDrmu ont0opt  oeiydfm ra(mpn() rxomf3iodomte ieols seuo(r3no1alenmneilt  ruaur nu1aeeo ociatfm umu p t) exoio tadfpDelivil(0sexrxr3oy4lpte fcs tfsDrru pnu1opxo o3iasfs um(mo t0trtrxrcty1oa rlnes;() 2trim3no4lltn fesa( srtmx oou0optoii3iytfa2umu s u4aleoxfcty1lm rlivs;( t2uoim3oy4lmt lfvilt sDurum nu1tex  feiatlaDrmn p;u) etnmr3oo1lm   ies;(0 2toim3ny4lpeelicsasf Dra( pnu0aptomi3ilsfmDraump;u) ltnif3tytla r uvol(0truoxo oudaptn ncs s)a2trur ;u0oex  fciadls umu s u)trtnmf3iy1fat  i s;() etoio3ou1lltnlfesltf Draxrpoo4tltoifcildls2umn s;t) eenif3totfa eaiesl()seumim3nudapenliesltf rra(m ;o1opx  iciltlm2um(vonu4areoifcoytfm raneolt0trxmxr ou1lptn icsas aDtrxro;o0opeomietld m ulumpnt) eeomr3iytlm raivolt0s2urir3iu4aptn ies ( srrmu p;u1oexo oetyt m2umnvont)tleniocty1lpt anes;t)s2toir3iy4al emietasfs2rau oou1aleo ociadfm2uanvsnu0areomfctatoaDr ues;t0srxrxopoy4om e ivtl( sDur(  oo4ape mfctltlaDean on() ltoxr3tydfatelneilt)t2umxr3no4ale mfvsas aDtr(  nu0tetoiiciys m ua(vp t4aexomr3iadoa elu il(0setm(m3iy1ale mnesls)s2urxmpnt1tlxomo3ild s2um(mp;t0 ltoir3oatoatrlivi t0 exm(m nodapt  neslsfsrtmumo;t0aet  ietltfs2ua( o;t) ltoxo totfa raueil(  2trimpny1aptnmfvs s) rrrx ono1oetn oeiat mDeln p t4 rtrxfciytlp raieol( srxr(r3ou4lpen nviat  rur(ro;u1aexoiociasla2uan sn(0aexnmr3tadlm r nes s teumxrpnydll nliviat arrrxmonu0opxnifcildfsDran s (0aexrmrciatfmt lnvilt0 exo(rpiy4ope lfetas) rtau o;o4oexoiieiatlmDuaums u4alxoircootlpt aues t0s2tmiopnudomen fctasfs2taxro;u4apx moctasfsDel(vonu4 rtnxrcio1fa elivo s  etoim3io1llen fes t arum( pnt0alx mfetytls rlu o;t) rtoxr3to1om   uvs s)teto(m3oo4lpenlfvs tfa2umumoou4tlxoiieiyslsDel(mp;u0 leoxfcoo1oa  ln o;t0srumxo nudaleeliei s)aDua(r oo0optnmo3iytfsDemuvp (4aetrio iotlatrlnes (0 etr(o3no4ape lnciasfaDrax o;o0oee ifeiysla2rlnvp (0 rxrxrciatfmDr nvs;t0s2xr(r3nu4ameelivtat sDra(rpnt1olxomicils a rl(vpnu0alenmr totoa raies;s trumxopno1lme lfviat sDtrxm nt0ale  fcildfsDumnvpnt)aetrircoo1lm elnei ( srur(r3oy4lmee fcsat) 2tmxmpnu4aeto o3iyt a el(mpn(4arerif3tydomDrlivs;t)sexr(r oy1lltemfcs s)s2rrurono1tpxomiciydlm2rlumo;t4texomo iodfpteau ilt  exoimpoy4omenmfcs ()arrmumpnt1oet  f3iys mDran p u4aetomo3to1omtean s;( s2xmxr ou1llee fcta()aDua(r nt1aeenioeildla2ulnvpnt)aexrio tadfaD  n ils  etmxr3ou1lpe  nviltf Dra(r ot4tleoif3tltfaDrluvo t0tetnxf ia1fpDeanes;t0trxoxm3nudlpee fci (  2ur( ooo1oeto i3iytla emu o;t4treoxr iotfmDr ivi;s trxoxr iydol e fctl()a2um(  ou4opxo o3iytlm2rl(vp (0 lxnir oodoat lnvils) 2tm(rpoy1ole lfvtltfarur(mo;o0aee mf3ilsfs rau pnt0aeenxocia1opD  neilt  ruoiopiy4lltnmncsls) Dtr( o;o4oltn i3ils s2raumonu4 eenmo iydla eauvs;(0trtm(r3io1om  lnvt t artrxrono4tlt  o3iadfsDrl(vo u) rtoxo iy1fm   i o;t) euoir iodal   ictat srumumonu4tle  f3tydfs ulnmsnt)altoio ia1lm e nvsls)t2um(m iodllen ieta()arumum ot0texo fciltfs2raumonu) renir3tydfmte n s;()sruo(opiy4ll   neilsfaDtrxmooo4optomfetatls ra(mpn(4 lxnmrctydfptrliei;()s2xoio nodlpt lfcsas aDrrxmp;o4oeenmfeiltlaDeanmo;(4tetrircoo1om  aneolt0s2um(opio4lme mivs s) rrrx ont0tpenmociltlmDuau sn(0altrifcoadfm ran sls0 euo(m no4apee nvtl(fsDrr( pnt4olx iiciyt m em( s;t)tlenxrctadla  aieol(0texr(m3oydomt lnesa(  Dtaump;u1oltoiictad sDrl( s;u4aetrxf3iotfmDr i i;( trtmim3oydomt lfctlt aruaxr ;o4tpen oetadfa uauvpn(0tltrmo3iytlmt au o s0 etrxm iu4lltnlicsat s2tm( pnu0oeen i3tltlmDemumo;(4tleoir iydfpDe uei;t) etr(m3no4oleelnct t)a2rauro;u4apeniiciad sDemumo;t4aexrxrcoa1fmDeanvilt) rxr(m oy4ap e iciat)sDrmu  ot4olxnioeiyslsDeln p;u0tltniocoa1laD  nvo;t)t2urir3iodaptn fvi t aDumu p;o4aetn icilsfmDran o () rxnxf3tatom  ln o ( texm(m ny1llenlietlt aDrau pno4tptoifctlsfs2eauvp;u)aetomfctodfptrli ilt0trtoimpnodom emnci ( a2trxmpou4tex  fetat sDrmuvp ()artnxr oodfa ran i;s) etm(m3oo1olenmivi s  Dtmx  no4tpeoifcilsla2emuvpnu0 rtrxr iadoa   ivs (0s2trim3oy1olee fvt tf Drrump;o0olxn o3iad s2elumo t4 renmociy1lat lieo ()trxrir iodoptnlnes (fs2ra( pou0apxo f3tld aDumuvsn(0trerxr oa1la elueo;s t2xrirpnydom nlfct s  2umx  ou0oexo ociyt mDel(mont)trtrmo3tadlpDeanes;() exmxo3nodlmtelivtasfa2ra( onu1olxo fetadlm2eanmp;()altrmociotfmte ivo t0srtoxrpou1lp elieilt) rtrumpoo4apt moeiysfa2ranmp;u4 etnxo3iadoptr n i s) 2to(opnydlp   ivslsfsDraxmont0texn i3iydfm ra( p;t)aleoxo3tydop  an i;t0 rumxopny4lm nmfesl(fs2tm(m ;t1aeeoii3ildfa ulnvs;t)alxoxociy1laDrluesl(0s2toio iu4lltelfvilt) Drru p;o4opt ii3iyd mDrlumo;u4 rxomr3oodlmDeauei;(0 2umim no1lltn nvia( srrr(m ;t1teen icildfm uaums;u4 exoxf oo1oa   n s;t0 eto(m3nu4op emivslt srumx o;t1oex  i3tas m2rl(vp;t0 etrxo ta1fmDe u ol(  ruo(m nudllee fctas) rtrur nu0alx miciytfs2rmumont4 rtoxrcoodlaDrlivo;(0t2ur(m iudol e ieil(  rumxm no4tet ioeiytlm eaumpn(4trtrmr oadfmDrlivs;s)t2toxr3oo1lp nlfetl()s2rru pot0aeenifctlt a2el(vo t0trtnxfctotopD  n s;t)trtmirpoo1am elfvtlt srtm( ooo1oetoioctatlm2uluvon() eenxo tadfp r nvi;t0srxmxr3oy1lp elicslsfsrrmum ;t0tlen feiasfmDea(mo;(4trtnxrciytfaDraies;s) rxmir3oo1aptn feslt aDta(rpnu0oltnifcild s2rmu o t0 reoxo3tytomteanvi (0seto(o3oudome  nesls arrmu oot4tex  feiytfm2el(ms u0tleoxo oatomt  n i ()teurxmpno4alenlfvt tf Dra(r ;u0tlenif3ilsla uauvs;t0 lxoifciadom eliei t) ruriopnudll nmfesltf 2ur(mpoo0teenmiciadls2eanvo u4 rtnmocta1op  an sls srxm(o io1altelicsat sDtmur ot4olxomieiad s2ul( p;(0aleomr to1fm eaneols0teuoiopno1open ncs s)srrr(  ;u1tptnii3ilsls ean o t4teeomocty1fpD ln i s0s2xm(r oo1alt  ivt (fsrrmxmooo4apto ocildlmDeluvo (0texrif io1lp eanvo s0trurir io1lm emfct t aruaxm ou4tex  i3iadls2rl(vs;(0aetrmr3iadlp e nvi s0 2umirpiu4olenlnet sfartr(m ot1tlx ioetadla rl( pnt0 rxnmocootomD anvi t  2xrir3no1omtn fvil(  2rmu  ;t1tex  ieiydls umnvs;t4alerif tatoa elnei s0sruo(r iudam nlnctat a2tax ooo0tex iicilsfm ran sn(4 exrir3iotlaD au o;t0teuo(o iydllt mfvi sf rraump;u1tltn ictysfm rlnmp;u)trxnmo3oa1om r ueo;(0s2tmxrpno1omt livt sfsrta(  no4olxnif3tat s rlnmsnt)arenmo iytfpD  i slt0t2urim ou1amtemnviat  rraxmpnu0oltomociadfaDrlnvo;t0tleomo3iydlaD luvs s0trxrxo3io4opeemfvt s)aDtmxr oo1olxnmo3ild m2umu o;t4aexomf3oydlatr nvs;(0trtoxo3no1open fci (  Dtmumpoo4oeen ocils s2umu o (4alenircoy1lptrau i ( s2uoxo no1apt  nvta(faruaum ot1aetnii3ilsfs ean o t4aetoxf3tatlm eanvi t)trxmim iudlmenmfeiltfaDrru ono1tlx ifeiltla rl(vo t4tlxoxf tytoa rauvs t) 2xoxmpnu4lp nmfctl(fsDrau  ;t1apeo o3tls a2um( o t4altnmf oo1lmt  ieols)t2xoir3iu4ol nmfctl(  rrrurooo1aptnifeiytfs2em(vsnu) rtoirctotfpD au s;s0srtrxr oydomte fvtas arurxroou1tlt mfetysfs2ul(ms t)arermfcoodoate iei (  exo(mpoo1alte ictlt sDtaxrpoo4aetnmiciydlm2ea( s t)alenxr3iatop rauvs t trxo(o3ou1lp  mivsat sDtaxront1tpe  feiad a rluvo (4aleomocio1oa e nvol(0trto(rpio1amtnmnct s srrmumpnt1alxoii3iyslaDuau o;u4 etoxr3oatlaDe nvil(0 2xoxm3oudaltnlfetatf Dtmu  ;u1oeeomoeiat a2rau p;t4alxnxr3ty1lp e uvsl(  eurxm3nu1lptn fvtlsf rurx  nt1tpt iociytla rl(monu)tlenir iydfmt au o;(0teurxr ou4alee fciatfa2urump;o0aexnmfeilt a2eauvs;t0teenir3iytfaDrauvols)srxrio iy1ol n ivs s a2ur(m ot1tpxo ietydlm uau o ()alxnirciodlm rlivil(0teum(o3no4am n ivi t)srtrxroou0tpxnifctyt s rm(vont4altnmfciadlmDeaieol()trxrio3nu4omen ncil(fa2ta(rp;t4oeeomfeiyd m2uaumpnu)altnir ia1om e uvs s0teuo(m oudlm emfvia(  rtaurpno1oee  ietltfs2rauvp;(4tltnmrctadoate ieo ()trtoim3oydll e ictat a2rmu oou1oleomfciltfs em(vp;u0aetrmf iadlate ivo () 2xrxr nydlm emivsl(fsDua(monu4oeeomfetatlm2ea( s;u0trtoxf3ia1omDrln i s0 exmxr nu4lm  mici tf Dta( pno1tetomictasls2ulnvon(4 rtnxocty1oaDelu ilt s2tr(r3oo4al emfvslsfsrtmx onu4aet mfctyd m2elumpnu4tlerxo3tytopte ivolt)t2urimpio4ome  fvt sfsDtru p;t0oex  ieiat sDul(vo;u0treoir ta1lmtr i o;s  2xrim oudapenlnvtl(  Dua(ront0tpt mf3ilsfmDumu p;() etrxr oytlpDr i ols0 euo(r3nydlleelfeta() Dum(roou0tleoifeiasfa2raump ()aeermf3to1fpD  uesl(0texoim oy4op e iesl(faDrruro;o0texoif3iatlm rl(vsnt0 leoircia1opDeai i;s0s2xrxm3iudalenlfciat a2tmu o;o4oex  o3iyslaDrauvp;u0alxnxr iotfaD aneo;(  ruoxr oudol   ncsasf 2ua( o;u4texo o3tltls2ulnmsn()tetoxfctydlmteluvol() exm(rpiu4oltelnetls s2raxmo;t4tptnmi3tytfmDrmnmo t0 rxomo oodop rlnvi t)sexmxr3oodap e fvsl( sDtr(mpnu1openmoetlsfsDea( o t4aeenmf tatomD aies;t seuo(r io4lm emictlsf rurxmpot1tpx  f3iltfm emnvp;u4trtrmrciodfmtelieslt)trxmxr3iy4om  lnvs t sDua(rpot0ape  fciltfa2rl( s;u0 exoio3oodfaDrauvolt  2tmim nu4lp  mies tfsrtmxrpnt1tlx io3tasfa rm(msn() ltoif3oodlpDrau s;s truo(o iudol nmnvilsf 2tmurp;t0opeomfetatlm2um(vpnu0teerxr3oydfpD  u sl()tetmio no4opte fes t a2ra( ono4aeeo fcilsls2raump;(4artoxf3iydlpDrlnes (0texrxr3oydopt livt ( arurx  ;t4olx miciydfsDuau o (4 eeomfciydoa rlueo s0sexo(rpoy4alt livs (  rrrx ont0tptnmo3tad aDelumon()altrmrcoydopt  i o t) 2xo(o3iudlpe mivsa() ruaxmp;u4apenmfciys m2ua(von(0arerifciodlaD  u i;t0setmxm3iudom nmfes (fa2uru ont1olenmictasfs2em( p u0aetrxrciy1omteluvo s)trtmxo oy4ale lfciasf 2trurooo4aptoioctyd sDum(mo;(4 rxrxf iadomDeln i () exm(r nydomtnlfes (f 2raxr ou1tle ifeilsfa el(vo;u4tlxomocty1faDelivols) rxoxo iy4amenmieiat) 2uaxm nt1apt miciydla ea( o;(4tltoxo3iotoaD lneo s) eto(m3oydlm n fvtlsf Duaxrpnu0alto fetlsfs elumpnu)tltoxr tydomt livs (0 2toimpio4apt  nei t sDua(  ;t0aleoifctlsfm2rm( on() rtnxr3io1omD  uvo;()t2ur(o3iodom elnetls aDurxr nu0tlen iciyslaDuanvo t) lxomr3iadlaDeauei;s0srxrxm3no4lm nmnvs (fa2rmxm ot0aleoiietad s2em(mp () exnmr tydlpDrluesls) rumxrpio1opeelfet s) Dtaurooo0tptn fctydla ra( o u4treoxrcoydoa r i ilt setmimpoudalt lnvi s a2umxrp;o1apxoiieiaslmDel(mo;u)trtnmfcoadlm ean s t)seurxo3nydlpenmfvsatfs2taxr nu4olxnmoetyd aDumn pn(4 eenmr3iotla eauvslt)seur(opnydap elictls  rtax o;t1tetnmo3iasfmDrmnvo t)aleomf3oy1faD auvsl()sruoirpnydamtemietat  Duaxmo;u1altoif3ils a uaums;u)aexoiocia1fm eauei s texoim no1llt  fvt tf rtm(rpou4tpx mi3iydfmDumumpn()arxoir oy1lp eai i;( s2ur(m no1omeeliesl()a2urumpot4apxo ociat s rmnvp (4 exomr3ia1faD luvo;()s2xr(o no4oltnmfct ()arrr(r ot4aexo f3iatlmDemn o;u0arxnio iydfmtrlu olt)s2umir3ny4lm emics s a2ur(ro;t0oeeo ocildfa2um(mo;() rtoio3oa1lmD  uvols setrimpoydamee feta() 2uaurp;t4alx micilslm2rlnvp (0arxoxo3iy1oa eln o (  rtmim3oydalt lfvs t s2ur(moou0opxoifetydlmDran pn(0tltrxr3iytlm elnvo s0 eto(mpnudlmeelnetls s2tm(m ou0apx mfeiltlmDem(vs (4 ltnmo oatfmte uei;s0trum(m io1ope licslt  rurxmooo4aeenmfetlt s2rluvsnt0arxnxr3iy1oa   nvs (0trxr(mpiodoptnlnet sfaDtru p;t1oexoif3iadfs ean p;t4alxnmr oy1la eau o s)s2xoio io4llenlfvslsfs2ta( ont0oeeomoeild m eaums t)alerxr ootoaD  n ilt0 2tmxr3oy1lpeemfetlt a2rrxr nt1optn f3iadlsDrlu o (0aeeoif3tydomDeaneilt sexmirpiydlmtn ies s artmu pou0apx iiciys m elnmo ()tleoiocoytoaDean s s0t2xoxr3iudlm nlfvsa(  rtrxrpnt4oetnmf3ias a2emn s t0aexoircoadopDeaieo;t0 2trxm3iydomen nct t)aruax  ot1tleomi3iysls2ranvpn()artnxr iy1oat lies s0trtmxo oodoltnmfcils aDtmx ont4tpenmi3tad a rm(vpn(0 exomr totfa rlnvs () ruo(mpny4lpt  fcslsfsDtr(r ;o1tetomfciltlsDel(vsnt4treomr3ty1oa   ues s0sexoimpoo1altnlnvs t)srum(mo;o1tpe miciadfa2ulums;u)tltrio iy1fat au sl(0s2tmio oy1op nlics s)aDuaxrpoo1aeeomf3tatlm umu ont0tleomrcty1lpDelu o;s0trto(mpoodlltemfcta( arumxro;u4tet  octlt m rmn s (4 ltoif3totom   iei;t srtoiopoodamen icsas)s2rrurpot1opx iictydfmDulnmp;u)altoxf3totfa  anvo t t2toxm oudalen ici t  2tr(m oo1tpto fciyslmDra(vo;u4alerxo3oy1oatran ilt setmirpny4om elfvt s) 2rax pot0oltn ieiadla2uln s u) rtrmo iadfpDeluvilt)t2xr(opnu1lme  fcs sf 2urxr no4tlt mf3iad a eau pnu0aeeomr3tydfa r nvo s0 2xo(mpoydapen nvt s srtauro;u0apenmf3iydfsDrm(mo t)aexrif3iadlat au i;t) etmio3io4altemnviatfa2ra(rp;u0oeenii3iyslm2um( s;u4arxnmf oo1latelies ()s2xr(r ny1lm nlnet ( sDtrx o;o4tlx mfeiad a ulnvsnt4alenxfctodfa elnvolt t2umxo3oydamte ivt t) 2trur nu4oeeoiiciasls emn snt0 exnxr3totlm r ivs;s0 rtm(r oudaptemnvsasfaDumum ou4olen i3iasfa elnmont)texoir3oytfm eai slt)s2trio3no4omt livsa() rum(  ;t1alenmoeiat sDeln p t)aetrmr oodoaDelnesl(  eumxopnudamtn nvs t sDum( o;u4olxnif3iad m2em(vpn() rxoio ootlm r nvo t)s2uo(r oy4om n fctat  Draurpou0apxo o3iytfs2rm(vs (4texrmrcoy1oateau ils0 exrir3oydlmen fetlt) rrmxm ou1apenmoeildfa em(monu4 lxrmrcia1omDeaivols0srxoxm3no1opee iei tfs2rru oot1oee iociad aDua( s u0arxomo tadlm   uvil()t2toxo3iu4amt mfet (  2urumpno4ale mfeiydfa em( o;u4 rtoif3iatlmteanvo;(0 euoio3io1ll  micsls) 2rm(rono0teen oeiasla2ulumo;t4trtomfcoodlp e uvo;() 2ur(o io1lp nlfesat sDtaum nt4apeo fcilt aDelnmp;u4trermr ty1oatrauvs t)teurxr3nudllt  nesls sDrm(r nu0oexn o3iat mDeaump (0alxnio3iadla  au ils trto(r3nu1lp  miesat) rrax p;u1apxn f3tadls emums (4 etomfciytfm rlnvi;s)setr(mpoydoleemivs t  rraxm no4tlxnifciadfaDum(msnu0aetnif3oadomDeai s;t0s2xo(r3oodame  ici ( aDumu pot1tpxo oetysla2elumsnu)arenxr3oydfmte u ol(0t2ur(o3iodomenmnvt tfa2tmx  ;u4aetn ietlslaDumuvpn()texoir3iatfpD  n ilt s2tmxm nu4aptn fcsa() rrmu  ;o4texn i3iydls2rlums;()teermo oadopDr u i;t0 rxrxopiudame lfcil(fsrta(  ot0tetomoetyslm2rmumpn() eerxociytom  an s s s2xrxm nydaltelfcils srrmu oot1oetnmictydlmDemn o;u4tltnmr3iydfmtrau s t  rxoio iu4omtnmfei ( srtrur ot0olx  ieiysls2uau s;(0 leomocoodla eaues;t setrxm3oo1omenmncs s) rtr(rp;u4tlxn i3tasls2el(vsnt)tltrif ta1opD  uvolt s2umxrpny4lpee fct t  Dtmxmont4tptnmfeiltlaDeln p t0tetnxr3to1lpteli i ()teuoiopnydam  lfvtl(  rrm( poo0tpx  o3iysla2rm(vs (4tlenir3oatlmD lnes s0 2urimpoodameelnvt s) rtruro;u4tpxnio3tys aDeau o u) eeoxf io1lmt  nvs;s0tetoxr3no4ap emncil(  rurx pnu4open ieiatlm ran s;t0aexrmo to1latraues t)setoxo3oydlm elnvta(fa2um( ont0tptnmi3iadfm2umumont) etoxrcia1faDe nvs t0 2trim3oydom elncta()sDtau ooo4tet  f3ils m rmn o;t4tltnxfcoydomtraivo;t)texoxm3oo4lmtelivta(  2raur ;o1alxnmoeiyt s um(mpnt)artrmf3iadoa elnvil(  etm(r3ny4lp nmics tfs2tmxmp;o0teeo i3tas mDuluvo;t) ltnxo oodfmD ai slt0 exrxrpou1amen fcsat)artmxrpou0aee ii3tytfmDemumonu0 etrxo3iy1lmt  nes (0srurio3iu4oltnlnvt s sDraump;t1ale mf3iyd s2uluvp;t0trxnio3oatoa elueil()t2tm(o ou1ll  mieilt srta(r ;u0altniietlsfm2raums (0trxnmf3ta1fatraiesls) 2tmxo3iodam  mnvi s)srrmu pnt0olxo icildls eluvo ()trtnmfcta1la rliei;t tetmxr oudopen fvsls)sDur(mpot1texoii3tydla2umn s t4tlxnmoctadoat lnei;s0 etrxopnudolenlivt s s2tmu o;t1tle mfcild aDumump u0tleoxo3iadlatrli s t) 2tm(o3oo4op nlieta()sruau o;o0tetomicilslsDra( pn(0aetoif to1lp   uvol( s2urio3ny1ome  nctltf rrmxm no4apx  feiys m rmn s;(4altoir3oy1fmtraues s0s2trxrpio1ll nlfciat aDra(mo;t1tleo ieilt a2raump t0tlxoxr3tadoatr n s s0t2toimpiydlpenmfctas  2urum oo4alx  ocilsla rl(vpn(0trtrif3iydfpD aneols0srtm(rpoydale lfctat) rrrx p;u4opxoifeiys aDemumo ()tleoif oydopDe uvol( texmirpoydlmt mictlt  2umxmo;o1aee  f3iatlaDuan p ()tlenmfcia1lat lnvo ()texoio3nudap  mivilt arur(m ;u1alt mietldfsDul(vo;()trxriociadfmD ai i;s) eurirpiu4oleelfvsl( s2tru  no1opxnmoeiytlaDelums;u4 rxoxf3todfat  nvs s t2xo(m oodlp elfct tfs2ua(r nt0open oeiaslmDra(mpnt)tleoirciotfat luei t)t2xoim ny1amt  iet sf 2rr(rp;o4tex io3tldlm em(vs;u) rerifciytlpD  n s s)srtmimpoydam nlivi s)sDtru p;t4aeeomociydfa2um(mp (0tltoxfctotla  aiei t0se
\ No newline at end of file
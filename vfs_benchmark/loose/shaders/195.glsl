@@ -0,0 +1 @@
+neils0s2umxrpoo1lpeemneil()sruru oot0ale moetlt a2ea(vp;u) rxrif3todlaD  ies ()setoir3oy1lmtemnvt ( sDrm(mo;o0opxnifeiytlm2elnvs (4alxnif3ta1fa eaueils  etm(m3iudale  icsas a2trum nu4oee ioeiad sDumu p;t)tlxnmo3oydlmD auvi;s) 2urxr iu4lp e icil(faDrm(m ;u1tptn o3iyd aDea(mp;(0altrif ty1lm rlnvol(0trxm(r nudll n nvs sfartaur ;u1tlen fetlsls2emump (4trtnxr tytfmtean o t)seur(o3io1omenlnctls srrmxmoot4tpto ietyslm em( p;u0 etrmo oadlpDelnvo ( s2urxo3nodalt licslt  rrau ono1olt  ieiaslaDra(mpnu)aeermrcia1om   nvi;t0t2ur(o3nudamt mictls sDraxm ot0tlxoii3tyt s ulu o;t)teenio3iydlaDe n i;() etrimpoydlp n icilt a2rmurpno0tlxnioetatlmDumuvp t) eenif3oytfpt aivol(0 exrxr3io1ol elivi s  rtmxmonu4apto ictlslaDuauvs;t0 lxrif3ia1op r iei;()trtoxo3nu4amt micsas  Drmxronu0teen oeiysls2ua( o (0 rtnif3oytfat  ivo s0 rtoxr3nu1lpeemfei s artaurono1ole  f3iadls2emumsn(0 lxnxfcoy1laDeli slt  2trirpiy1olte fctlt)aDta(mp;u1alt iictaslmDra( o u0trtoxf3tytfpD an o s trxmxo3oodaltelncsa()s2tmu  ;u0apx  feiyslm ul(mo;u)tlxnxf oatfp elieil( t2umim3oy1am   fcsls)sruaum ou0oeeo icilt m2rmn p t0 etomo3iatopt an o (0trxoxo3iy1ome micsas)aDrrur ;o1optomfeiydfm2ea( pnu4alenmf3ia1opDrlu i;t setoimpoo4aptnlfetasfa2rmxm ;t1alto i3tys s2rmnmo;u4teeoio ta1faDeauei t t2ur(mpoudll n nctltfs2rmxr ou1aet if3iyt s2ua(ms t) rtomrctydlptrauvs s  exmirpio1om  lnci (fsrrruront1oeeo ociaslm uan o u) rxrmr3iotoaD  i o;(0 2xr(mpiu1lltelneils)artmuront4tpe ifciyslm um(vsnu)tltrir todoa  luei;t)texmxr3nydalenlies s sDumurpoo4oeeo f3iasls2uan pnt4 lerir3iotfatelu i;t setoim3nodll nmfvsl()aDtmxmp;t1alx io3tytlsDrmu on(0arenmoctytomDe ivslt)teuoxm ny4omeelfesat)s2uaxr no4tee mieiytla rmnvs;t0tleoxfcia1fpDelivolt0trxmxm oudoltemicil()srraum oo1tltomi3iad sDelumo;(4 renxr oytlp   n s (0 rxoxr io1altemivilsf Drau ooo1oleniicils a2rmnmp t0 exnmr iodfmDeanvs () 2trio iu1ale mivtasfaruaxrono0tptoiietydlm2elums t)texomf ty1lpD aneolt0 2xrxm iudol  lictlt)a2uax poo4oleomf3iytla rlu s u0tetrifciodopDelues;(0t2xrxo io1lltn nvsls arrauronu4oltn fctytls rlumsn(0 exnxf ootfm  lneilt s2ur(mpnu1omtnliei (f 2rax ono1oetomf3ilt s em(vpnu) leoxr3oy1op rlivsls0srxr(m ny4op n nesas)aDtaumo;t4teen f3tltlsDulnmsnt0tlxrxrcty1lpDr i o;( srtm(o3oo1op emfcs (fa2uaxmont4opt mi3iasfs2emumo u0aeenmrciydom  aivol() eumxo nu4olt  nvias aDtmum ;o0tptoifctltfm2em( snt4alxnxf oydfmtelnvi (0 2toxo3io4ll e fet tf Drmumoot0apxoifciadlm2eauvo t4trtoxrcoy1fptelieo;t trxr(opiu1ale  netltfaDrmxm oo0oeenmf3tyd a2rmu onu4tltrmf3ia1lmtraivi t) 2trim3iydoptnlfcs s)srumx o;o1tlen fciysfs rlnmsnu) lxrxfcoytfpt  nvolt0 exrio3ny1al emfes sfaDuaxmo;t1tleo oetytfaDemnvsnt0texomo3tatfpD lnvs;(0teuoxmpiy1opeelfcslsfsrrr(ro;t1alxo feias a eln p;(4alxnxf iotomtean ilt srtrim nydap nlict t) Drm(  oo0olenmociyt mDrlu pnt)tlerxo3iotfp raues;t0 rurxo oo1olen ivsls aDta(mpnt0aet iiciyslmDulnvpnt)texnxr oytlp r ieolt0trtoxm oo4llenmivtls)a2tmxr ;u1teeo feiysfa em(monu0tlenxf3iytfaDraivsls0 2umio io4ap e fvsasfa2tax  nt0opx  ociltls rau s t)treoifcoo1lpDr n i s) ruoir oodlptnmnet sf rtm(mpnt0apt  ieiltlaDem( p;u4 eermf iytfpDe uvslt  ruoxr3iodolee nvsl(  rurur ot1tpe mfeias s2uau p t) rtrxo iotfp  luvi;t)s2toio3oodllte ics s  rrm( oot4aetoio3tlsfs rln onu4artnmf3totoaD  u i;()sexmxm3iu4amtemics tf rrm( p;u1oetnioeildlm2umnmpnu4alxoxo oy1faDeaueilt0 eumirpiydaltnmfeils sDrmx oot0olt mfetytfsDemuvsn() rtrxf3oy1fm rli o;s s2toxr3no4lmee fct t s2rr(  nt0tle mf3ildfs rmn p t0trtomo3io1fa rli il( teuoxm nudame mieiltfs2rr(m ;o1tptomi3iasfm2rlnms;t4 ltrifciotlpt lneil()t2umir oy4lm n ici tfaDtau  no0tpt moetydla2emnvp u) etnxf oa1fatrlies;s0 2urxo3oo4ole mfet t) Dum( ooo1oltomfeiytlm emn s t4trerxr tadop eauvo;(0srumimpou4lp nmneta( arrmx  nt0aee  fciltfs ra(vsnt0teerxrcoa1om   ivilt0t2to(m3no1lpe  ivslt a2taxrpoo4aexoifcildlmDrm(mo t0tltrxo3oy1fptr uvilt)s2uoim3ou4al  micia(  Dtm(m ;o0texn f3tatfm2umu s u)texrxr tydlat lu i;(0 2ur(o3ou4al  liei s  rtmxm ;t0oexoif3iyd m rlums ()aetoxo3to1fm eanesl(0srxrio oy4opeemfeslsfa2rau pno4apeoio3iytlmDulumo;t4trtoxr iatop  liei;s trtmim3iy4om e neta(faDrmxrpou4tex  f3iydfs rauvs;t)trtoxo tytla eluvils)trtmim ou4aptemncs () rrr(rp;u1texo o3iydfmDuaums;t) rermociotlpD aiesl(0srtrio iu1al elici t)a2trx o;o1olxomo3taslsDulnmsn(0arerioctodoatrlivs;t  eur(opio1lptemietl(fsrraur ;u1tee ii3iyd mDra(mp;(4 rxomoctadfmtrlnvils  etr(opiy4am n iesatfsruaxr no1tpxomfctadlm2ul(vs;t4 lxrxo ty1lmDrlneils0srtrir iodaltemfvia()arum(mpnu1aetn i3iydfm em(vs t4 ltnmrctatopDran i (0sexmxrpiydlmtemnei (  rtmumpot1opxn f3ilsfs rmnvo;t4aeerif3oadfa  au il(  2umir3oy1omenlfes s)sDurx o;o1oexnmo3tadfa2el(vs;t) etrmo3oadomt an sl()t2urxr iudopt lfct tfaDrmur ou4opto fctyt m2rmu pn(4aetnir3oytlate iei s)tetrxm iy4opeelfct ( srua( oou4apx mi3tat s emums;(0aleoif3iotomDr n s;t texo(mpou4ll  mnci (  Dra(mont1aetnmfciatlsDelumsnt4arxoxo oytomt aieol()tetoio3io4aptemiet s srtax o;o1oex mo3ilt sDrau s (4 leomocoadoa rlies s)trtoir3iudap e ivilsfsDrrump;o0altomfctyslm ranmo u4artoio tydfpt ln s t tetmir3oo1apt mncsls aDtaxmo;u1aex  o3iysfs2ra(vs t)arxrio oadfptrlivols0tetoiopoo1altnliviatf Drr(  nt0oetn o3iys sDra( pn(4treomfcto1fp e uvo ()s2xoir io4lm emfetlt a2ta(r nu0ale  fetldls2eau p;(4 etnif3iodoatrlies ( s2xoxo3iu1apenmneia(fsDta(m nu0tet mf3tltlm2uaumonu4 rtrifciodlpDraiei;s)srumxr3iodaltemietasfa2um(rooo1tltoii3iys a2rmnmp;(4artoxf3ty1lmtrlneslt)setmirpoodll elfct s  ruaxm ;u1altn i3tatfs2emu s;()altnxoctodfa   nvs t  2xoiopoy4lp   fvils arraxrpot1opto ietld m2rm(vs;u0trenxrctotfa rauei s) 2tmxr nydlpt lnetl(f rtm(rpno4apx io3iatfmDem( o;u)teenmo oy1fpD luvo;t)t2ur(o3nydop emfvtl( a2ta(m ou4tpt mfciltla2umump () rxoir oydomt lnei;t seumxr3iydol elfct s srraum no1ope mf3ilt m2um(vo;(4 ltoio tytfpD  ivo;(  euoxmpnu4amen ieta() rtrurpoo4aex iiciydfsDran s u4 exrmr3tadom   ues t  rxmiopio1optn ncilt) Duaxm ;o4tlxnmieild m em(vsnu0teeoxocta1la e ivils  rxr(m3iy4llt mnetat)srraum ;t1oee mi3tas a ra(mpnt0trtrxo3todfaD li ol(0t2umxopoo4lm n neiasf Duaumo;t0aetoii3iys m2ua(mp u)arenxoctytomDelivil()srto(rpnudomtnlfesat) ruru o;u4tlt ioctldlmDumums;t0tleoxo ootlp r ieil() etmxr3nodllenlnctls aruaxmpou1tet  octltfaDum( on(4texoifcoa1la   ies s0truriopnudop emnetls a2ra(mpno1tet mi3iasfmDuluvs;u4 lxrmrcty1fmte ieil()srtmim oy4ape micil(  Dur(roou4apx iieild m2em(vsnu4tetoxf3oy1opDr nvolt  2urim io4ope  ivias)srrmxrpou0tlto ieilslaDra(mon(0 lxnxociytlaD lues t) 2xrxo iy1ll emfctatf rtmxmoot1oex mfciadlaDeauvs t0tlxnmr3iydfaDeai slt)sexrxo nu1ll elnvil() 2ur(  ou0altoif3iyd s ul(mo;t)altomf tadla   nes;t0sexm(m3oydlpenmfvi t)sDurxronu4oltnmoctasfm2ulnvpnu4 lxomr3tytfpt livs ( setrim oo4llt miciat aDua( oou0alxomictysls2elumpnt0tlxnxrcoytlmt ln i t0 rum(r3ny4ole mncsl()aDta(rpno4ale mfeilt s2rmuvs (4arxomo tydfpte ivo;s0 eur(o no4lmte nvsa() Dur( p;o1alt iociat sDul(vs;u0aexrmr3to1laDrlnvsls0srurxopno4lmeelnesls arumurpnu1alxo feils m2el(mo;u0alxoxr3oy1optr nvo t0teurxm3ou1am nmfvil() Dur(  oo0aexo fctasls rluvs t)areriocta1opt anvo;(0s2umimpiodalen ictlsfsrtaxm ot1apxniiciat sDrl( ont0 eenio io1latrlneol( setmiopiodomen icsasf Dtr(ro;o1tle  ietlslmDulnmsnt0 ltnmr3iytfpD au o t0 2uoxm3ou4altnmfei t arraxronu0apenmo3tls m2rm(vp t0aeenif3oatlmtranvsl(  2xmxo iy1lptemict ( artaum ou1aptn oeiatfaDelu p t) eerxrciatoa elivs s0texoxm nodom emfeia(fsrum(mo;t1ope  ieilt s rl(vo u) rtrircia1lmDrauvi t sruriopiu4lp  lietlt)sDur(  ot1ape  feiytfa2emumo;t4areoxfctatfm   n i;t t2umir3oo4lpt lnes () 2tm( p;t1optnmiciat s rmu snt4 rtrio3ootfpDeauvsls0srurxr nudlm  mict ( sDur(mooo4oetn o3iysla ulu o;(4teerio3ty1oate ueo;( texmxmpoodole mnvi s aDraxm ot4tetniietlt m ranmsnt4 etnxo oa1fmD aivo;s s2urxopoudlm e fvsa(fa2trxr nu4olxnmicils a ulnmp (0tleoiocoodfm eauvi;t) exmxr3oodlmte ics s)a2rru pno4altnifctadfa rmu pnt)aeenmrciydfaD anvi;t  rumxm oy4lltnmnei (farua(mont0tpt mfcils sDem( p;u4alenxocta1la rlnei ()srtm(opio4lp e fvtas arumx o;t0tpxoiieiyd sDum(ms;u0tltrmf io1lp eliesl( trtmxr ou1lltnmics (f rumu  nt4ape moetasls2el(vpnu4texomr iy1fmDr u s;(0t2umim oudoptnlfviat  rtaur ;t1opxo ieilsfa2uluvp;u4 etomr3iytom e nei;s0sexoxr3iu1lpe lieia(farraxmpoo4tlxo f3iltlm ra( s t0aetnxocto1op  luvi ()setrxopio4lmtnlnesatf rra(  ;t1optnmietlsla ean s;t0 etnxociydfmD  u o s t2uoxrpiu4lpt mnvtasfa2umxmpot4olx ifcilt m2rmnvont0alxnxrciotopDeaivo;t0texrio3no1ap  mfcias)sDtruronu4tlxoioeiasls2umump;u0arxnmf oodoat  u sls0 exoirpiydol  lncs (farrrxmont0tltnii3ilt a2ul(monu4tetnir ta1fmt  n o s  euoxm iydope lnvil() Dtau  ;o0aptnmfciasls2em(vo t)treoxf tadopt  ivols0s2um(mpnudame lncilt  2trxr ou4oexo o3ilsfm2uauvo;()teeomrcoadomDe u il(0 euoiopiy1ap e neiasfsrumu ono0tlxo oeiys s rmn o (0aetnxfciytlpt  nes s0 exr(rpiodlpen fcsasfsrrm(mo;t4tpe  ociad m elu s;u4aetrxf tatfmtr n i;t0srto(mpiu4al  mfeta( a2tru ono4aptnmocildls2uauvonu) lxrmfcoo1om  an s t)seur(r oy4alenlieil(f rumxm ou0aetnmoeiys s2umn pn() lxoxfcoa1lm   uvi s  2xrxrpiu1ll nmiciasfsruaumonu4tpe ifciatfs2emuvpnt)teeoir iotoatelnvi t) 2xo(opoo1omen ncilt)s2urx onu4opxoio3tlslmDrl( o t0 lxnmrctydfpDelneo t setrxm3oo1lleelncsl(fsrraxro;o1olxomicias s uluvp t) eeomrcta1opt  i il(  rxrxmpnudomtemfvslsfs2tmu pou1olx  fcild s rl(vont4alerxr3oodoa eluvsl(0trxo(rpiu1apenlfvsa() Dum( onu1tlxoifetys sDranmp u4tetrxf3tytfpDran o;( s2uoirpiy1ll   neta(fsDtaxrpoo1oexnio3iydfsDulumo;t0alxrxo oa1fa eauei;s0 2xr(m3nydolen fcslt sDururpot0tlen ictas m2ul(vo;t0alxrmo3iydfateanvols t2xmxm nu1ap nlfcs tf rtmur oo4olt  fetltlsDea(vsnt0 lenxfcoodopDelieo;s)trtmio3nudal nmfvil( aDtm(r oo4olt mo3tls s rmu on()aetrio io1oa elies;()seurio oo1lle  neilt)a2tmxm ou0opt mo3iat a elump;u)aetnxfciytfaDe i olt0trtoio iydlm  miesls  rrmu pnt0tlxn i3iyd m2ua(vs () lxoxociytlaDeaneilt0s2um(r oudomtn icils  Dta(m nt1oleoifetytlmDeau s t)alerio oydlmteanvi;s0 etmim3ny1ap nlivilt)aDumxro;o4oeenmi3tadls uluvp () ltnifctatomDe ues;s)t2umxo io1amee ncslt  2rm(m nu0ope if3iydfm2ulu snu) rerir3totlmteai ilt0 etm(m3io4lm nmfet s)a2rrxmp;o1apx  feiyt s rl(vsn(0 renir oadlm raneols0 etm(m3oydalt lieiat s2trxr no0oee iicilslsDulu s t0 etoifcty1faDr ivo s0 2uoxr3io4ll nlnesa(  2tmxmpot0oetoiieiytfa emump;u4texoio oatla e i i ()t2urim3ny4alee nvsls aDua(ro;o0teen i3ils s rl(mon()aetrmociadfaDran sls  rtmxr no1al nlnvs tf 2rrxr ot4apeo i3iadlm umuvonu4texoxfciatlmDr i o () 2tm(m3io1oltemietl(fa2urxmoot4tet  ocilsla um(msn()tlenmf3oo1faD aiei s)texmxm3ou1ap elietas a2tau pno4alxo f3iytlm2rlnvp (0 reoxr todoat lnvslt)s2uoio ny1lpt lfcs (f Dtm(mpno4tle  oeiltfs2ra( p t) eeomf3iatom   u o;s  etrio3ou1optelfeslt)aDta(mpnu0tee  oetyd sDem(mpn()teeomf oatoa e ivolt s2uoim3iudalt mfes t aDuaxrono0ole ioetydfs2elumonu)trtnxfctytfmD  ies;s0 rtr(opoodom nmicslt)aDumx pnt1aleoioeild sDel(vpnt) ltnxo3ta1fmteluvs t)tetmim3iy4llt mnci () ruaxmpou0tetnioetys sDuau s;t)trenif3iy1la eanvs;( s2um(r3oodap   fcilsfarua(rpnt0olx mf3iat aDrlnms u)tetnif3oydfat  nes;t0 2umio ny4ap  lfvta( artmxmpno0ape mf3iatfmDeaums;()alxnmo3to1fp e uesl()trurxmpoydlmen fei () 2urxr ;t0aexnmietydlm elnvpnu0 rtrxf3ia1lpDr n i;()t2uo(o io1openlieslt a2urxrp;t0tpeomoeiatfm eaump t) lxrif tytlp  li i;(  rtoim3iodlpenlfctas) Dtru  no1aeeoiictytfa2uluvs t0arermr tatlaD  n o (0trumxr iy1ll  mfes t)s2tr( pou0oltnif3ildfa2umn s u0 rxrmo3oatomDrln s t)srtmxopoudoptnlies tf rra(m no1tpeo fctasls rm(mp u4 ltomf3iadop   u i s  rxrim3oy4opeemfeslsfarrrxm oo0oleomfctadla2um( o;u4 lerxf3oodfpD lneolt)sexrim3ou1alenlnesl(fsrtm(m no1opeoiociltfaDrl( o;(4tetrir oatfatrln ilt0trxmiopoudlp e nvilt s2trxm nt0olxnif3tadlmDelu pnu)teenircoa1omDelueolt s2umimpoo1ole licsltfaDururo;u4aexnii3iasls ulnms ()aexrxf tadfateai i;()sexo(m3iy1optn fvs (f 2raxm nt0opto ieiatlmDrm(vs;u0 eenifcoytfp eau sls0trtrxo nydom nmicsl() 2uau  ;u0texoiictat sDeauvs t) etniociadfa  anvo;(0t2to(mpnu1lmenmnvi t)srum( oot4tlenmi3tad a ulnvs;(0tetrxr3oatlatrlivolt t2xmxr3io1optemnei s) rrmu ont4aexnmf3iasfm rl( p u4aeeoioctotfaD  nes;s0s2tm(m3nu4ap   fcta( arraxr nt1tpx ioeiadfaDeau o;u0 rxrmf iadlpDr ies (  rxmxopno1ap elfcilt artaumoot4aexnmoeiytfa2rlnmont4alenmrcoy1om r ivils srxmirpnodam nmici ()a2raxmo;t4aeen oeildlmDumnvs;(4aeerxfciydfaD  n o t)trxoirpoudol nlfct s aDtm(rooo1aeenio3iydfm ul( o;(0 lxrmr3oy1lmtrluvi;t trurio iu1lptn fctl()artr(m ou0olxn o3ildlm2ra( p (0alxoxr oa1la e ivs;t)trxoirpiu4al eliciat)artr(m ;o1apenmi3ilt a rm(vs;()aetnxrcootfptrli o t trxrir3oy1opte nes t) rtmxm oo1opx ifeiyd s ea(vs;(4 ltrxo3ia1omD lu o t0seuoxm nu1ll nmfet ()aDumumpou1oltnio3iadls2el(msnu4texrircia1faD  i ils s2toio3ny1al  lneiasfs2raur ;t0tltniietytfa ul( pn(4alxrxo totopt li olt trtoir no1lmt  ivt () 2trxr oo1opxnmi3tls m2umu s;u)aeeomo3todfa   neo;s t2xmxo3oo4lmt miei t)s2rmx ooo4opxnioeiadfaDeau s u)artomrcta1fm  aivo;( srumxrpny1lp nlfcsl(fa2ua(moot0tpe ioeiadls rlump (0 lxrxo3ta1op r i o (0 etmxo3nu1omee fviltfsruaumoot4openio3tatfs umuvo ()altrif3iodoa   iesls)trtmio3iu4lp  mictl()sDrrurpoo0aeen fetasfs uln p;u)alxrxfciodla  auesls0 2xmxo3nodap  lnvia() rtrxr ;t1tle ifetysfa2rlnvp u)alxomrcio1lp  li s ( trurxm3nudameelnvsa(fsrumur nt4texniietltlm2elumsnu) lenxo iydlp ranvil( srxoxrpnu1lm  lfcs tf rrmuroot4olenmo3iltls rmn s;()artnif ia1faDe i ol(  rxr(rpno4al nlnvtltfsDtmumpot4olen feiaslsDelu sn(0tleoxocia1fmD  i o;s)s2to(o3iy4ap nmiet sfa2tm(mp;t4tlt mocias mDrlnvo;(4tlxoxrciotlaDe i o;s)s2xrxo3nodlltn net t aDra(r no1tet ii3tld s uanvo;()trxrifctytom rlnvo;()teurio oydape lfci ()arrruro;t1alenmo3iad s ua(ms;t)arxrif iadfmDe u s;s) rumxo ou1ap elnctlt aDumx p;u4aetnmociad a emuvs;u0 ltrioctytfp rlnvo t0t2xoxopiodlp nmivi ( arra(mo;t4ape  f3tysls umumpnt0teermfcoa1lm  lu i;t  rtmxo oodlmtn ncs t aDtm(rpnt1olt iietyd sDeln p;t)texrircoatlpte nvol( t2tmxm nu1opeemietas  Drr(m ;t1oet ifetad mDum( ont)aeermf3oodfp  aivs;(0t2xoir3iy1op elnvil(faDuaxr ot4tlt iictlt a2ra(ms;t)trermrciotfatr u ilt0trum(opou4omee nvi sfartmxr ot1tptn o3tltlm2ea(vo t4 exrif3oytomte u o s  2xmio3iudoleelfvtlsfartm(r nu0opxnmieilsfsDrl( o u)trerif iytfp rau i;t0trxr(m3iu4alee netlsf 2ur(ro;t0aeeomf3iytlm ra( s t0aetomo ootfmDrln i s0seumio3nodlptemncsls) Draxrpnu0alenmf3ils a uanvo (4artnmfcoodfm  an olt0 ruoxrpno4lmeelivils sDraxroot4alt io3tatla rauvp u4 leoifcoa1lat aiei s) etr(opnudop nlnes (faDta(m ;u0tlx mi3tat aDemnvo u0tltomoctatlpDraieils)trtm(rpnudlme  netatfs2taxmont1ole mo3iltlm2ean o;u0 exoxf ia1omtrln il(0s2uoio nu4opt  icta(fsDtmxmpou1tleoio3iys sDul(msnt0aeeoxf3iotfm elu o ( trtoxo iodlmtnmiesas sruauro;t4oltnmfeiysfm2um( pnt4 eerxo tytfatraneol( sruriopoo4ap emics t  rurx ono0tpto f3tld mDumuvsnt0 rxoxo oy1fp  anvo s0sexoio nudapt lici ()a2umuroou0oex  feiltlm umn o;t4trxoxo3ty1lpteaieols0seurxr3iy1apeemnetas)aDua(mo;t1oex  f3tyd s2um( pnu0 rtrif io1fpDean slt)srxoio3ny1lle mfciltfaDta( pno4alenmo3tlslmDumnvpnu)tltnxociytop  auvo;(0s2to(m nudom  liet sfa2ra(ro;u1apt iictltlsDuauvp t0 renir ta1fa e i ilt0srto(r iydlm  livia(f 2ururoou0teenioeilslaDrm( onu4 eenio3oadfptr nvo (0trxo(m iodopenmneia( s2raxm ot0opxnioeiydls2ea(vo t4texrmf3oa1omt li s (0s2ur(opoudlmtnmivt t aDra(mp;u4tetnmfeiatla2uln o t4alenxr iotfpDr ueolt0trtmxo3nodom n fcilsf 2urxronu4oeto i3tlt aDel( sn(0 lenif iy1lm ran s s0truoxm3nu4llenmncsatfa2urx p;o4tet mfciadfa2ean o;u)arxnxociytoaD lu sls  etmir3iy4ap n fvtatfs2rm(m no1opxnmicildls ul(mp;t)trxoxr3iotopt anesl(0truo(mpoy1ame mfei t) rrrxroou0oeeomociyslm uluvo t4aleomr ta1opDr iei ()srurir3iy4lleemnvs tf rrr(r oo1alx moctydfm2rln onu)alenircoodlpD li s t) ruo(mpny1ol elfvs ( aDtmuro;t4alto o3ildls2ua(msnt)treriocoatomDrauei;(0 2xm(r oy4optnmfet () Dur( p;u0oexnii3iytlmDum(vs u4artnmf3tytfpDeliei;s)t2uoirpiudlpt mnvta(f rtmxr ou0apxn ociyd a2rm(vp;(0 reomrcoy1opteaivi;()srum(o3nodom  liei tfsDtaxr oo4altnmiciyt a eanmont4 exrxrcio1lmte nvo;s0setmxopny1lpt mies s srtm( pnu0apxoifcilsla ul(vpnt0tetnmr tatlp   iei;t0 rxoxm3oydoptnlnvi s)srua( p;o1tpxnifetysfa2ra(vo;(0arxomo3to1fpt  i i s0t2uriopiudam emiviat a2um(rp;t0alx  ociysfaDrauvs t4 lxoio3tadlmtrlneol()s2xo(rpou4ol nmneia()srururont0aex mfctatfm2rmuvpnt)texrxr3oatlp e uvi s)s2urxr iu1ol e nvs t aDum(mo;o4tet io3tysls2ranvo t0aeenxo3tydoaD  nvo;s0teuoio3nu1llee fvslt) 2tm(root1teto fetyt a2rlnmon()tlxomfciy1lpDrlneilt0 rxr(opno4lpe  fcsltfarumu o;o4alen o3ils a2rmnms t4 etoxrciodoa r n o;s0srtm(o3iy1am   nvsls srtaxm nu0tltomietatla umu s;(4 etoxo3oo1lpD ai o s0t2xm(r no1lpt  nvt t a2rauroou4aeto ociatfa um( s ()alenxf3io1fmDeluvolt) 2ur(o oy4omtemietat  Dtmxr ;u0oet miciytfs2em(vp (0 exrxf3ta1latrli ols0seumimpiy4lptn nvsat artaxr ;u1apx iociytlm2ea( s t0artoxrcoo1fatrlnesl()trurxo nodaleemfvsa()srurur ;u1altoioeiysfsDuln on() rxrxf iatlp elnvi;t tetm(o iodlmee feta(f Drr(ro;u0oeen fctlt s2rau p u4texnxo tatlmD aneols0tetrim3ou1alenmnesat) 2urxmonu0tle ifciysls2eau pn(4texrxrcoydfaD anvs s0 etoio iu1lme livi t s2tmxmpot1olxnmf3ildls2um(ms () lenio3io1fp rlivs ( trtoiopnu4opt livs ( a2umurp;u4teeoii3tysfs rlu snt) etnxr oydomD livils0teuo(rpio4lpt lietasfs2raumonu0apx iiciltfs2umu onu4alerxf oytomDraues s0srxmir3oo4lmeelicsat)artmuronu4olenif3tldfs ranmp;()teenxoctodfm elivo;t0srxoirpoo1amtelivsls aDtrxrpno0ope mociaslsDrm(vp;u0 rtoifciadla eanvs s0s2uriopnydopt lici sfarum(moou0opxnifeiat a ean snu)trtoifcoodfa ean s;s  2xrir oo4amen net sfsDrax o;t0aet mictadfaDua(vo;t4 ltnif oadlpDeaivi s teurxmpoo4ll n iet ( aDrrxm oo0oexomfetltfs2ra(vo;t0 exrmf totlatrluvil(0teuo(o iy1alenmfvtat) rta(rp;t1tleoio3tas a2uanmp u4aetoif3iodlm e nvi;t) rxo(r iu1lptnlicsls) rua(r no4tlen oeildlm uln p t4 eenmr iytfat lues ()trtr(opiy1lptnmiesl(  2trxront4apeo feiydfaDrmu p;t) rerif3iotomtelueo s)seuoxr iy4lm  lfvsatf 2rrumo;u1oeto i3iys a2umu pn(0tlxomo3iydoa  lieslt0 rurxo3oy1ale miei sfaDua(m ou1aeto ieilsla2eaump (0aetnxrciadfmDraivsls t2xmxr3oydap  micil( s2rr(rpou0oex  fciltfs2rm(vpnt0altnxo ty1omD livo;(  rtm(m ny4apt mici (  2rmxrpou0altoiiciydfm em(vo (4trtrifcto1lat  u ol() rto(o3iydom eliciasfs2rrurp;u4altn oeiydlmDum(vo;t4tlxrmo oa1om rai o;t)srtr(mpiy1apt mics (fsDuaur nu0teeniietad s rlu s;u) rtnxr3iadlmDeau s;()t2xmim3iu1amt mfvs tfsDtmumpou1optoiiciltfa2rl( o t4 rxnxf iy1laD lnvo s)seum(r3iydaltemici (fsDtr(  nt1oee io3iyt m2ua( ont0trxnxr3oy1lpte nvi;( sruriopiu4ope  net tfaDtm(m ou1altoiieiatfsDrluvp;u) lerxr3ta1fm e ivi t  etmxm ou1lpt miciasf rum(m ot4oltomi3ild sDeanvo;t4 exrxo oo1lpD  i o ( sruoxo3nodlmen nctls) 2tmxrp;o1ape mociyt aDua(ms;u0treomo3oy1lm e nvslt s2xoxmpiy4ap nmicsas  Duaur oo4teto i3iydlsDul( s;t4artnircoo1fm   i il(0 rxoiopnydlmtnlici tfsDraum nu4opeo ietytlsDuanvo;u)aetoifctadlp eau o ( tetmirpiudlp  mfcia(f rururoot0tpx if3iaslsDranvsn(4tlxrir3iydlm rlu i;( seto(r oudlpenmiei s)srrm(monu0oetomf3tytfa2eanms u)trxnifciy1lm  luei s)seurxr3iudom   fvtas  Durxmpno4aee mfciysfs2rmuvont)trtoir3iadlatrliei t s2tmimpoudal nmieiasfsrurxmpnu4ole mfetydla ean ont4trxnmfcoytfm  aneo;s0truoxm3iodom e nesasfa2tru  ou4tle  oeiydlm rmnvont)tetoir tydlpDeauvi;t0 rurxo iydalte iei t srumxmont4tpeniieild s ranvp;t4 rtnmo iydoat au o;() 2tm(mpiydap n fcias srraurpou1aetoiociatfm umn s;()alenif3to1latraueslt)sexm(mpiy1ale mnetl(faDurx ooo1tlto f3ildfm2rmu pn(4 leoxo to1fpt luvi ( trxmio ou1olt  ics ()srrmu poo0ape  feiyd mDra( p (0texrxf3oy1la rlnvs;() eurxr iudam n nctls)a2rru ooo1oleo oeild s emnvs (4 reoio3oatfptrlnvs s)seur(o oy1lmen fvsas  rua( pou0optoifeils sDeaums;u0artrirciodlpt  i o;(  2tmimpnydlp  liesasf 2tm(  ot1tlt ii3iltla rlnmp u) lxnxf3iydlpDrlnvs (0t2trxr oo1ll nmnvi t)a2tau  ot1oexnifeiyslaDumums t4 etrxf3iotopDr ivi;s  rtrirpio1lp n nvtlt a2rmur ;u4tle  iciyslm2rmnms t) eenxr ootfmDe uesls)t2triopoodome  ictltfa2rmx p;o0tpeo o3iat sDuaums;u)trxoxf3tadfm eanvi;t t2xm(r iydaleelnviltfa2tm(roou4tlto ociys sDra(ms;t0 rtriocoa1fm elnei;s) euoxr3oo4ol   fcia(fsrrr(rp;o4tltn iciltlm ul(vs () rxomr iotoa  livs s) exrxo nu4ol n nes sf rrm(roou4tlx iiciadlmDra(vp;t)tetnxocoy1fpte uvi ()tetm(opoo1lpenmnct tfaDtaxrpoo1aee ioctytfaDrln s;u)aeenxrciotlate u sls0 2uo(o io1lpen nviatfs2rmumpou0altn oeias m uln s t0 eenxfciodlpte ivsl(0 exmim3iudlpee ncs (faDum( pot4apxoiociytfs rauvs;(0artoxf3iotoat li i (0s2toxm ny1omenlnciasfsrrmuro;o1alxnmieiadfm2umu p (4 rxnif iytfpDrli s ()srxr(r3iodap   feia(f 2rr(r ;u0aee  ieiydfa2uan ont)alxrmo ia1optrau i t0 rtoxo3iydaptelncsatfa2tmx ont1tetoifciysls2ul( p;t4 eerxrcoatfa rlivilt)s2xmxopiy4ol elncs t s2ur(ro;u1oexniieiat s uan pn(4aexnmfciydlptelu i s0 2umxr3oy4alen ncil(f 2rmx onu4openmieildfmDra(ms;u0tlenifciadopt anvsl(0setoir oodapt mnetls s2tm( p;u0oetomf3iys sDrmumo;t4tleniocoytfmt  ivi;t srtr(o3nudomeemivs t)sDrrxmpot1oex  fetad m2rmu ont0aleoifcta1fptelnei;s0 exmxmpio4alt  ivi (f Duaxmp;t4altnmociydlsDuanvo (4 eeoxo3iotopD  uvo (0setoxr oodlp e nvi tfsrtaxmo;o4olx iietyd sDrmn o ()aeeoxr3iadopD ln i;(0s2xoxm3oodale lnct t arua(rooo4aex mi3tytlmDua(mp;u)aexoir oadfmDe u s (0 etoimpiudlmenmfcia(f rta(m ou1ope  octasla umnmo (4 ltrmf3oytfmDr nvi s)seurxr3ou1lmeemivslt aDtm(mpnu0apeomictadla uau ont4 rerir3ootlmD  i sl()srtoxr iydamt  fvslsf 2rau ooo0aptnmictad a2rln p;t)texrxoctadfaDrlieols0s2urio io1alte nvt t artrump;t0apt  ictltlsDul(vs t0 lerir io1opD auvo;t seuoimpny4opt  ncsl(fs2urxrooo1tetoifetysls umn pnt0arxrir tadoa e ivs;t0srxr(mpoo1ope  nct t aDtmxrp;o1alx  ociatfa el(mo u4aeerxoctytoat  uvol(  exoxrpnudop  lfvtls)artaxrpnu4tptoio3iadlsDul(mo;t4 eerir totoa e i i t srxrimpio4al  mnci sfaDta(m ;t1apt ii3iltfa2umnmp;(4 rxrxf3iotomt an ols srxmxopno4ameemneias) 2trur ou4tle mo3iltlsDean p (4aetoxrcoa1faD lneo () euoiopnu1ale  nesa( arumxr ou0olt mi3iaslmDrlnvpnu) etnioctotomDrai s;t0s2umirpoo4op nlicsa(f 2tmxr ;t0opeo oeiadfa2eluvsnt4 reomf to1lmDeliesl(0srtm(rpoydapenmicta() rumu  ou1tetoii3tldfa rmnmp;(0 exnif totlmt  nvo;t0 rtoxo3iu4omt lfvtlsfs2uaxmo;t1ole mociltlm umn o;() ltoio3to1laDrlnvs;( trtr(opoy4alee nvt tfaDtr(m ;t0aeeo octldls ulu o u0arerxr iatfmDrluvs;s t2uoio3ny4am emivtatf 2raump;u1aeto o3tadlsDemnmsnu4 rerio ia1oaDraneils)s2tm(o3io1ol n nctat) rtm( pot1oltnifeiytfsDuauvp;u4 ltnmo totlmDr ivs t0t2umim iy4ap   nesat) Dururpoo1oexnmi3ild s2um(ms;t) ltnmr iodfp r ueols) 2xoxr ou1lpe  nvsl(fa2rmu p;t4opxn iciltfs rm(vo u4treoio oytlat aneil(0s2trxrpno4op elict ( s2rru pot0olx  i3iasla2el( ont4tetnmf3oa1faD ln ils) eum(r oy4ameelivsls)aruauront4tptn ocias aDrl(vo;u)artrifcoy1faDe ues;( trumxr3ny1lpt mics () rurxm ;o0openif3iadls2rlnvs;t0trerif3oadlpDelnes t)setr(m3iodol nlivtl()a2rrxm oo1tpenmieiatfs ra(vo (4aexnir3iytoa   i sls0sexoxrpoodam elneias sDraxrpot0olenmo3iyt mDrmuvp;t)trxomocoa1oaD aueils0 exo(o3iu4op n fet s)arrm( pnt0olt  iciydls2ra(vo;u)altomf io1fatelnvi;s  2xr(r ou1ap   fvsatf 2rr(mpoo4tlx  fetytfaDel(mo;t)aexomr iy1oaDeaneslt setoimpoodom n nei tfaDrr( pou1oleomfciytfs2el(vp;u0treoxrcty1oaDrln s;t0sexmim3ny1lm n fvsl(  rumxroot1teto o3iadfsDumuvonu0tetomociydlaDrln i (0texrir3iydlp emictl(fsrrrx onu4tlto f3tls a2elu p;()areomr3iytlm eau o;(0t2urxrpoydalt mfcsasf Draxrpno0apenmoeiadfaDul(mpnt4altnxo3iatfpDeliei s)texoir3iodaptemfcils a2trx o;o1tpen ictys a elnmp;u0tlerxfciadla  lneo;(0 etmxm3nydop nmnci t) 2rmxmoou1tpe  fetlt m ua(vo;(0 rermfcoodop  au sls0srurxmpoodopt  fcsa( srtr(r nu4alxnmociaslm2rln o;u4 renxr3tydla eln o;s0seuoxrpio4al  mnei ()arta(rpnt4aex mfeild a eau o u) rerio3iy1opDr n ilt)seur(o3iy1al nmicta( a2tmxmp;t0altn ietydfa uaums;u)teeoxocoodomDranvs;t t2toirpou4amte nesa()a2tr(m nu0oex  feiys aDemu p ()tleoxr io1om eau olt)srxrxo iu1opte nvi ()arraxmoou4tetn o3tasfs2rauvonu)arenmocty1oat lueo;s)s2toio3oy4aptn ies t artaumpnu0aex mfciysfs2elnvo t)aexoio oatlatr n i s  2xoir3io1am  micsl(fartm(m ;t1oexo ociytfs2ua( p u)altnmo iodlatr u ils0sexrxopoo4optelictltf Dumxmonu1apxnifetatfa ua(vo t0teenio tydlmDr u olt)texoirpny1ole  icsl(fartruroou1opt mf3iytlaDuluvpn(0teeoif tadfmD aivi;t) exm(r3oudope mfesas)srrmx ono0apxo oeiat aDrluvsn(4trxrif3oo1lp raieo;s texrxr iu4om  lfvt sfs2taxmo;o0ope  f3iat s eln pn()tlxoxoctydfmD  i o;s)s2xr(opou4lptn iesa()s2rr(root1oeen i3ild s2ea(ms t0 lxoirciy1om e ivolt0 exr(mpnu1lp n iesl(fs2taxro;o1aptniiciyt aDea(ms (0aetoiocia1fat  uei;s texm(o3ou4lmtn fvt t) Dua(r ;u4open feils a2uauvp () rtoxf oadfp elu o (  2trxr ou1ll  livsl()aDrrum oo0oex if3iatfs2rl(vp u0arxoxfcoatopDr uvs;t)srxmim nodoltnmnetl( a2uax ooo4apeo o3iatfmDrauvs t4tlenxoctytopDraivils sexoir iy4al   ieias srtr( p;u1oet mi3iad sDel( sn(4 eeoifciydlp rauei;t0seuoxr iu4lltn ivtlt a2rm(mono1olt  fciatfa2elnvsn(4tlenir iotopDe i ilt)trurio ny4lmtnmnvs ()arra(rp;u1olx mictltlmDrau pnt4artomr3oadoate uei;s)sexoxo io4ale lict s  2trum ;u1tpxnioeiltfm rmu p () lxnif3tytom rluvol() euoio nu4op  mictls s2rmxr nt0optnmietlt a2emn o (0texrmocoa1fm rln ilt0 2xmxm3iy4lpee neia()srtrurpno0olx mfciyt mDul(vo t)aeenxr3ootop e ieolt0 2xmim oodoptnmiesl()s2uru pou4olxnmoeiys m2uau o;t) exnmo iydlpDelivo ( srtm(r3iy1op n ncilt) ruax ont0tetoifcilsfa ranmp t0 leomrcio1fateanvols0s2xmio3iu1lmt mfcs sfaDrmump;t4oex mociydlm2ulu snt0texoirctydomD  iei;s  rxrxo iu1ap nmietl() rtrxmo;o4oet  o3tlsfsDrl(vpnt4arxnmr oodlaD  ivo;t) eurxo3ny1alt  ietlt)sruaumo;o1ope mfctydfa rl( snu0 leoxo3iadfatrauvi (  ruoxm ny1oltnmivs t) 2rax oou1aeeoifetldfm elumpnu)trxrmf todomtelieols0trtmirpno1lm nlfcilt)srrax pnu1oltnmo3tat mDemnvp;()arxniocia1fatrlneo t  etmxm oy4ape  neilt)sDuaump;o0olxoif3tlt m2rmn pnt)trxrmo3iy1lmDeliesl() 2xoiopoo1lmteliei ()a2raxmono1apx iieils a emuvp u0 exomocty1la   ivi () 2tmxo3ny4opt mics (fsDrr(mp;o0alxomfctad sDem( p t)alerxfciydfptr nvs t trurxopoydoltelfesat arrrxmo;o4tlto octydlmDrl(von(0 lenmr iydlmD aueol(0 ruoxopoo1olte fvtas) rum(mono1alxomoeildfm2rm( o (4 eerif3oodfmtraieo;s0trurxrpoo1ll   ivi () rrr(mpnu4aetn o3iatfs2ea( p;(0 leoio3io1lp r uvi s  rurio3no1lle  fesa(  2uaur ;t0tlx  oeiasls ra(vpn()tlermo iatfpDean i;s0s2uoimpnu1ome mivta(f Dur( pnu4aleoifeiytfm2rl( p t0trxnio ia1opDeli i t0 rxmxopnu4ol  mnvias srta( ooo1opeoiietytlsDel(mont4alermr iytlmtelivi s0srum(mpnu4om  lnet s aDrm(rp;t1tetoii3tlsfm uan p u) eeoio ia1fat  iei;t sexo(r io1ope lfci s) 2taxmooo1tlt miciyt m2elu s;() leoxf3iadom raies;t0 2ur(r oudap e nvtas)a2tm(mooo1olenif3ilslm elumpnt4 renir oytfptrluei ()texr(r3oudome mfcia(fsDtrumo;o1oltoio3ilt s2rl( p t0 rtrio todfpDe nvo;() 2uoim oo1lpee ncia(faDurx poo4tlxomfciytlaDrl(mp (0trtrxociytfmtrau s s)t2umiopoodlltelivtl( aDrr(mont1aexoioetad m ul(mo;u4artnmfciatopt  u ol(  2umxo3io4olenmieilt)arrrur nt1aee mociaslm eluvo u) exomociatoaD aivi (0teurim oudlp nlictltfa2ua(monu4aeeo feiydfaDul( on(4 ltrmo oatom e neo;t0tetrio no4am n ies ( sDtmu p;o1apenmi3tas a2eau s u0alenir3iy1opDe uei;s0s2xo(mpoodaltnlietat artm(m ;t0apxnif3iat a2umnvpn() eeomo oo1laD li o;s0teurxo io1lp emnvsat) 2urur nt4ape ifciatfmDrl( onu4 leriocoatfmDelues ( t2toir iy1opte ncsatf rurumono0tee mfciyt m ea( o t0tltomfcoo1oatrai sl()sruoxmpnodopeelfcsl()s2umxm no1aleoiicilsfmDulnvs t4aetrmo3iotoaDrauvol(0t2xmxr nydome mncs ()aDua(rono4tlt  fciyd m2elumon(0 rtrxr3iy1oaDeai ol(0 rxrio nu4amtnmies ( s2tr(r ;o1aeenmf3tad m elnmo;()alxnir ty1lmtean o;(0s2umiopou4ameemivilt a2um( p;t0aleoiietld a um(vpn(0 lxnircoydoaDeanvi t  2umir oydop nmnetatfarurx ooo0tetniociyd aDeln o;(4 rxnmo3to1opD luvols0srurio3nudomeemfvils aDtax p;o4olxnifetlsls ra(vsn(0texnmf iytfmtelieo () etmxmpnydomt  fvslt srtmx pnu4aeen o3ils s ulnmsnu0 reomrctodfaD aieilt t2xoio oo4al n feslt)aDrrxmoou0tex if3ildfaDrauvo;u)aleoif3oodoateauvsl(  2xo(m3nydam e ivsas) Drruronu1olxomo3tatls rmuvpnt4areoir3iytlm   ivo t0 euoirpnu1ll n ies () 2ta(r ;t1alt mietldls emnvp u4 lxnxfciatoa   neolt0 rtoio ou4lp  lieiat a2rau ono0aeto feias a2uaumo;u0 lxnxr3totfpDr n o;s0 2um(m3iydalt licsl( sDum(ro;o0oee miciltfa ea(vsnu4 reoir tatom rai i;() rurxo3nydomtnlicsasfsrurx p;o0tee mo3tlt s ra(vpnt)arermr totom  lnvs t)trxrxo3nu4amenlfet tfarrr( ono1apxn iciaslm ra(vsnu4tlxoif3iotlpDr ueil()srto(r3iy1apte ieil()aDrm(ront4texomiciydlmDemnmsn()aexnir iadfmD  ueo s0 eumxo3iudlmenlncia(farta(rpot1optnmoetldfa2uau s;u)aleomfctotop  ln i;t s2ur(rpoodlmt  ncia(fsDrru pot0teenmictad s2ranvp;u0tlxnmo oa1oa r uvs t) etmxr3ny4lp emfcils)srrm(mont4oltoio3ildfmDumuvs u4alxoxf3oa1fpDr u sl(  2xr(rpny4lm nmfviltf Dta(rpoo4altomoeils aDem(vsnu0tltnmfcootfmt aues ()t2xmirpou1lpeemfet t)s2uru o;t0ale mieildfs rau p;t0aeerxociytlp e u ol(0setmim ou1lmt  iei s  Dta(monu4tptnmoeiatfs rmuvs;u) renmf iytoaDelueo;()t2xmim nu4ale  ivta(f 2ta(mpou1aeto o3tltfm2rmn p;u0 exoxf3oodom  aiesl() rurimpiudape mfciatfa2tmx  no0tpe  i3tld s elnms () exomf tytlptrlueil()setr(mpny4lm  micil( sDtmxrooo4aet iiciys aDrmnvo;()aeenxf oytopD livi (0texrim io4lpt  nvi s)artmxmpoo1tlxoioeiasla2eau s u4aleoxf3iy1fmtrliei ()seuo(rpiy1lleelnvt t)aDuaxmo;o1alx  oetytfs rmump;t0alenio3to1fmD auei s)s2umxr ny4altnmfci t a2rm(mono0teeomo3iydfaDraump;t4aetrio3ty1lmD  uvslt) rurio3iu4oltnlivsat a2tr(m nu0tltomieild a ul(vp u4 lxoif3oy1om rlnei ( s2uo(m3iy1ale mivils  2rmumoou0tpt mfeiltlsDel(ms u0 exoio3oatlpD aiesls0 2urxo3ny1am   iciasfsrrmumoot1tlt ifeiad sDeauvonu4 rxnif3iodfmDelu s;s texrirpiy4lle mnvsat)srtm( oou4tptnmi3tysfm emumo;u4tlxomf3iytomD  i ols  2xmxopoodape  icilt aDtaxm ou4tpto oeiys m2ea(msnt4alermf3tadfm   u slt)truo(r iu1lmen netls)a2rmur oo1apt io3tasfsDumu p;u4tlenxo iatlmDeaneols trxo(o3ou4lpeelfet t)arta(rooo0opx  ictls a ea(vs u0arxrio to1fatr n i t)texoirpiydol e ieil( srtru  nu0altoiicild m ua( o;u4 eenir3totfpt au i;( s2toio ou1oltemfesa() Dum(mp;t4tpt  f3tlt aDumnvo;(4texoxrcoadfaD lneolt0 exr(r3nu4apeelivsatfartru pno4tpt ifciys m2rmumo u4altrio3to1fm rlu s (  rxoimpoydll  mneta( s2um(mooo0opxomoctasfs2ua( p u0tlerio3ta1om eli i t t2uoimpio1opt mfvt (  Drmxr nt0teenii3iatlsDum(vo;(4trtomrctytoa   uvi;() rtr(m3iudap emnetlt artrurpnu1aleniieiasfs2ea(mpnt)tlxoxf tydlmtranesls trtm(opio4altn ivsl()srrr( pnt0aeeo ieiatlm2rm(ms u4artniocoydom ean sl(  euo(m3oo4lpenlfetlt artmurooo0ope mfetadfa eluvs u) exrxr3iytlaDrln ol(0 rxo(o3io1olee nvi (fs2umu ono1texn ieilsfm um(von(4trxrir io1oateau s;t t2toio3oodapt mnvt s)srtmxmpot4aexo oeiasfs emums;u)tlenxfcia1optelieil()t2urim3ou1optelfet ()artaumo;u0oleoiieilsla rmump u0alerxrciodop rlnes;s0srumxrpnu1al n ietl() ruaxm ;u4opt ioeiadlm2rlu o ()tltnif3iotfaDean o;(0tetoim nudlmenlivi t)s2raxmpou1teto o3ild m rm( o;t)altoio3iodfmteluvil(0t2xmir3ou1ll emfvil(  2ururo;t1opeo fctls s2ul(mp;(0 lxomf oodopD lnei ( srurim no1omtn netl( sruru ooo4olen octltfm ra(vont4 ltoir tatfaD  i i s) rtmxr nudllt mict sfarta(m ;t4oexomfetydfm emumo;(4 rxoio3oo1oa raneilt srxrxopiudaptelivs t  Dur(rp;u4opxnmieild m2um( o t0 lxnmr3oa1fmtrau il(  ruriopnydomen nctatfs2rr(  ou1ape mfctld s elnvp;u)aexoxo3ia1fmte ieo;( srxr(o iydlp emfcsls)sDum(mpot0olen feilsla2uan p u0 lenircty1fa   uei () eto(o oodalee nvias) rtax  ou0opeo i3iysla2ua(msnu)teeomfctodfmD  nvs;( t2trirpiu1apeelnctatfarrr(mo;o1teeo feiltla eluvp t4tetnir3to1faD ai slt tetrxopoy4am elivsl( aDum( oot4apxoioetas sDrauvon(0 rermrctydfm elu ol()trtrxm io1ll elncsa( aDrrxro;t0tltnif3ild m rmuvpnt) rerxr3todlptrau o ()s2ur(r3ou4lmte nes sfsrtru oou4teenioctat sDelnmpnt0areoxf3iydlpt luei t0trumxopoo1opte iviasfsDur(rooo1oet  ictysfm2umu s u4tltrmf3iodfpDr ueo;()s2xm(m3oo4am n nes () rrmxrpou1olx miciasfsDel(mo u0 etniocoy1fpD  uvo s)s2xo(o iudlm   ictasfsrrr(ro;u4teen ieiyd a uaump;u)aexomr oodfm r ues;(  rum(m3nudom  mfvtlt)s2uaum ;u0tet if3ildlaDrluvo;u)tlxnmr3ia1oate ivs s)sexo(m io4apeelivs (fa2taur oo1optoif3iadfa uan s;() lerir iytom  auvsl( tetrxr nu1lleemici tfa2rmump;o4aptoioeilslmDumumpn(0texrmf tatom raneil( trxm(rpno4amtnmnvs ()aDurxm nu1tpxniietatfs2uanvs u4aetnxociotop  aieo;t0trtoimpny1lltelicsl(f 2uau oou1tlxoifeiatfa2uln pn(0aexrxf3ootlm ran i;t0 etr(o oy1opee nvta(f Dua(mont0altnmoctyd s2umuvon()trxrxo3iodfm  au o (0 etoxo3iudlm elicsl()arurx onu4aeto o3iyt aDel(ms t4alerxo ta1oaD  neilt0teurio3iydlp nlnct ()sDua(mpot4tpeniieild m2elnms t0aeerxf3ia1lp  ai o t)sruoio3iodop  mfvia()srra(rpoo0ape mfeiadfs2uauvo;()trxoxf3to1laDraueol( teumxm3oydlm elivil()sDtrxrpnu1tpxoif3iltfm rau o u4 eeoxo3totlm rlu s t0 rxrim3io4amte ivtat)a2tmu  ot4alx iocias s2eln o t)altrmrcoa1lpDeaiesl( setoio3no1amtelncsl()sDtrurpnt1olen i3iytla2rl(msnt)aetnmrciotomDe uvi (0 2toio3oydol nlfvtatf Dum(m ;t0optniieiytls2ulu snu0altnio3oa1fa   n i t0srtmxopnudllt  ictlsfsrurxm ot0opx iietydfmDrm(vs;u0aleoir3oa1fmD an s;t)trtmxm3ou1lpenliviat  2uauronu1aexo o3taslm eau sn()aetomf tytfa ean ols0 2xrxr no1op   fvsas)sDumxmont4oeeomi3tltlm ulnmpn() rxrxfctatomtrauesls  2toim3nu1lm elnet (fsrrau pnt0aeto o3tld aDumnmp;()trenio ty1fa   nvol(0trxo(r3ou4op  mfcias arraxm ;o4aex  oeiytls ranvsnu0aeeomf3iatlpD  ueolt0t2uoio nydaltemfesat  rtmxro;o1apenmo3iydlm ra(vo;() ltnirciodfaDeau i (0teumiopiodlmtnmiviltf rtr(mp;o1ole  ieiyslmDum(von(0 lenmociadoat au o (0sexo(m iodlltnmneta()srtru pot1aeen iciysfsDemuvo;(4tetnmr3oo1faDr nvsls)t2xr(rpny4omt mfcsatf 2taxm nu0tlx mo3iltfm2rm(vs;t4 rtnxo oydla  lu o s t2uoio oo4am elfes tf rrau o;u0tpxniictlslm2umnmp ()teermrcio1lmD  u i;s)t2to(r3oo1lpe  nesat)arurx  oo4oeeo octytfs ul(ms t0 rxnmf io1lpD ai ols0 rtm(m iy1lpe mfeta(  Draxmpnt0olt io3tltlmDul(vo ()aexoxo to1omDeai s s  2trim3oo4amt lncia() Dtrur oo1aeeo o3iadfa2rluvs;t0 eenxr3todop  lnvs s)t2toxo3oodllt micilsfaDrmxrooo4oeenifctltlmDraump;u0 exnircto1la elieo;( s2xrio3no1lp nlivsl( sDrrumont1tex  fciysfs2el(vont4 eeomociadoatraieols tetoxo ny4lmeemivta() 2rmxrp;o4oeeomietasfs2rl(mp t0 lermr3iytfp elueil(  etoxo3iudlmenlicsas)s2umurp;u4aet  ietytfm uauvs t4texnxr to1faDr n i s s2toxopiy1ameemfci ()srra(  ;t1tpt iietys aDea(mp () ltrir3totomteanes s)t2uoxo3ou4opte nvia( sDtax o;o1aleoifciltfs rmu s;u0 rtnxfctotoaDe i s s0t2xmxr3iudapeelfetl( sDrr( pnu0aeenmfciys m rmnmsn()teeoxr3oodfmDrlivi;t0 rumimpnydoptn nvta()srrrxmo;t1alto fciadfaDra(vpn()trtoxo3oy1fp r n ils  rtmxr3iodllt mfvta() Dtrumpno0teeomo3iad m2ranvs t0tleoircia1opDean o t0 2xoxo nudolte neiltfa2rmxmpnu1teeo iciad a ran p ()alxnmocia1oat livs t0trtmxo3nu4lpe  net (fa2ra(rpot0opxoii3tlt m2uln p;u4tetnxo3oydlp r n ol() eum(mpiodllee fvt s)srtmxr ;u1oexn ieiyslaDemuvp;t0 rtomfciodopDe u o (0truoio iu4lpt mfei (  Duaxm oo1alt  fcildfmDrl(msnu4texomfctadlm rlieo;( s2tm(r io4op nlfvsls s2tmurp;u0tlt mociytfm emuvsnt)texnxr ia1lmt  n o;( sexoio3oudapeemnvtat)sDtrxmo;u1tet  i3iydls2elumo u4 lxrmr iy1om rluvs s t2uoxmpoudlmt mfeia(fartm(mo;u0oexnmfeiyd s2um(mo t0texomo3ty1op  lueo;t)trxmxm oy1ll elnvt () rtaur ;o0apxoioctasls em(vp t4 rxrxr3tadlpDeau i;s)s2tmimpio4lptnlnesl(  2raumpno1tetn feias sDulnvpnt0aetoxo3oa1omDr ivsls0srumim oydome mfvtl(f 2um(  ot0ape ifeiad mDel(ms;t)tleomoctodoa eauvi s seto(r nu4opt lfei ( artr(r nt4opx iiciytls umnvon(0 exoxo ootlpDe uei s0 eurxrpoy1ll  mfcilsf Dta(r ;o0optnif3iadlm2ra(von(4alxoif ootopt ai o;t  2tmxmpoy4olenlics s)sDuax ono0optomo3iatfaDrm(mo;()tetrxo iy1lm rlnvi;(  euo(mpnydlpte ics ()aDtr(rp;u1aeeo icias a rlnvsn(4tltomf3iydlmte uvs t0setmimpny4altelnetlt)aruaurpot0tpt mo3iydls emuvs u0teerifctytoatr nesl(0tetrxmpiy4lptn nei ()a2uaxmpot4opt moeiysfaDra( snt) rtoxr3iydoat aueil( s2tr(rpiy1ope  icsl()s2raxm nu1olxo i3tadfs uanvpnt4 rxrifctadfaDeauvslt0s2xrxm nodomen iei s) Dtaxront0aptomoctys m2um( p;u4tetomf3tatlpt  u o t  etoxmpoy1lle  icias)sDraxrooo1alt mo3ilslaDeanvo ()tlxrir3oadoaD lnes;s0t2uoxo iydlmtnmiet (f Dtrur no4aexniieiad sDrluvp u4teenxo tydoa rln i;t t2xrir oydaltn fvsas)srtmxm nu0tlt ifetlt a2rln pn()aetrir ia1fmDeaneo t0trumim ny1op emnetat)s2urur oo1tlx  fcilsfm uau ont4teeoirctytopt auvs;s0setm(mpiu4lp nlnctltfs2umumono1tetnioeild mDrau s;u4 etnmf tadom raueil() 2tm(m ny4omtnmietlsf Dua(m ;o1tptomfeilsls2el(mpn(0 reoircoo1lpD aieolt)srur(rpnu1alen iesasfsrum(m nt1open i3ils a em(mp u)teeomfctatoa elivil( s2um(m nu4apen neias  Dtmurpno1tpt  octyslmDul(ms;u4tltnxocio1oatrlieo t0 rxr(r3ou1op elfetl(f 2rmu p;u0apxo o3ilt aDeanvp;()texomfctadlmtrai i ( s2urxrpiy1al  mnci s)aDrm(rooo1tlx  ictydfsDemnvp;()trxoxo oy1lp  lneslt0 etmxrpoo4apt mnci tf rur(mono4aeen ietasfm el(vonu) etnxf iodfm  lieo;t)t2urxopiu4lltemfei (  Drrurpnt1altomfetldfa2umu p t)altnxociatlmDeaieslt s2umxo3iu1olt  nvslt)aDtmxronu4aetoifciydfm um(mp;u0aleoxo3oy1fpDrlieo t)trxmir iu1apee net s)aDraumpno1texo feilslaDra(ms t0arenmf oatlpDeau sl( trxmxrpoydlmenlncils)srurxr ou0aeeomieiad m rm( pnu) rtnxo3oydoptrli ilt trtrir3iu4ap  lnetasfs2rrx p;u4apenmoctysls2elnms;()tlxnxrciydlp rai sls seuo(r nu1lmt  nvs ( s2ua( pot1apxomietasfaDulnvo;u)altrmf oodlpDrlivils0 rurxr oo1ole mfvt s) 2ra(ronu1apt mfciasfa rlnmpnu) ltrmo oadfpt au ol(0 2xrxo3nu1alen ieiat) rtaur oo1oleoioctldfaDumu p (4aetomf totlaDrauvsls teumirpoudll  mfei t)sDtaxr oo4aet ioetytlsDemums;t0tlxnmrciatomD lies t sruoxr oo1am elneiat)srururont0tlx  ieiydfs em( p;t0altnmo iatla  anvilt0 2xmimpnu4aleelieils arum( pou4texo fciydfs2ul( s t4alenxocoy1fa elnvols)trum(r nu4lpt mfvil( artrumpnu1tpeo feiltlm2uanvs;(0 etrifcoo1fm   uvslt)t2urxo3oo4ol n nctls arrax  ;u1opt mo3tytfmDrm( o t4aeermfciatfmD au o;(0 2umiopno1olenliei sfsDtrx o;t0ope mociys a2eauvs;t4trermf3iy1opt  u i ( teumxm iy4lltemnei s aDuaxroot4apxniictys s2rm(vs;u4trtriocia1faDe n i;( s2ur(o3nu4op n icta()s2umxmpnt4tptnifeiatla um(vo (4 rtrxr tytfa rlues s) exmir3io4am  lnvils)sDtr(rp;o1tpto ocildfaDrl(msnt4tlxomrcty1fp r nvo;s)trxrxo3nudlp  mneiat a2umxr ;t1olxn fctytfs2elnvpn(4 eenxo3tydfaD lneol()t2umir ny1op nlfvs t) 2rrxrp;u1oleomiciltfa2rl(vpn()altnxociatlmte nvs;s0 exmxr3no4llt  fctlt  rua(mpnt1aetnioeilsfm em(monu4 reoxf oa1lp r n s;t0s2xmio3iydol  mict (  Drm(  oo0tltn f3ils a rau p;t0arerxfctodfp eauvs t)seuoxr3io1ol e neiat)srurum ou4texn i3ilslm2uanmp u4alxrmfciatlaDrlnvil( srxmio3io4lmeemnvt t)s2ua( o;u1teenioeildfa2rau s;(0arxrif to1omte u i;s  rtrxopnudomeelncslsfarrrx ont0alxomf3ildla2el(vpnu)areoxr to1om eaieol( sruoim3ny4ameemneiasfs2tm(  nu0tpe iicilslm rmumo u4 eeomf oadfmt  u s () exmiopny4lp e fvsa() Dtm(mp;o4aetnmi3iadfa2ul(monu)arxomfcto1opDrlies s teum(m3oo1am e feiat) 2trurp;t4tptnio3ils aDelnvp;t0tltoio ia1fatr n s (0t2ur(o3oodalt mfcia(faDtaxmo;t1tltoiieiyd aDrmuvo;u)arermfciadfptr i ils texoimpoy4lm  mnvs tfa2um(ro;t0opxn ociadfa rmu o u) rxoir iatla eaivs s0sruoir3nu1ll  lfeta()aDur(m no4aex ii3ils a elumo t4 rxnxfciydfmD  nesls s2urim3oy4llenlfctat) Dta(m ou1aetoifciasfm2rluvon()treomf3to1lpt aivo t)srtmim3oy4amtnlnct t sDtmx p;u1apx ifctldlaDuanmo u)tlermr oo1lp eaiei s) rtrxr3io4amen fes t  2urumpoo4tlx  octysla ean s;t0 rxnif oa1lpteaueo;s s2umirpiy4om n fcsl() Dtaxr ;u1alenmiciysfsDrln p;()alerio3tydopteliesls trtoim nudaptelicia(  rum(  ou1tlx  i3iysfaDrau ont)altnif3iytlmtr i slt0trtrir nudlm nlietlt aruax pnu1alxo o3ilsfs2ra( s;u0artrmfcoy1fateln sl( s2urirpiu1ll  mfct tfs2raxmpot0texniociytfaDean p t) eeoircio1faD lnvi t  rtmiopoy1op   nci ()a2umx onu1tet ifctyslsDemnvp (0aetnmfcootla  luvi s)sexrio3oy4ll   ictls) rta(ronu4olenmfciad m ea(mo u) etoxfctadoa elivs;s0sexmxo io4llt lnesl()s2rmum ot0tle  octlsls umnmsnu)tlenir3ta1fa  an ils)s2xmirpnu4lpenlnesl(fs2uru  ou0alt moetls aDua( s t4treomfcootopt aivs;s trtmiopoydomt mnviatfs2trumo;o1oetoii3ildfmDelums;t4aexrxo3tydlmtraivi;s0seuoimpio4aleelfeils)aDrmumooo0tpe iocild sDea( o t) lerxf tytop eauvsls)seuoxo ou1lmtnmiei t)s2taur nu1opeo oetltls elnmsnu)arxrmocoy1fatrln s;(0seur(r iy1optelnvt s srrruro;t0texoio3iadfs ea(vp t)aeerxo iotlaDean sl() exmxo oo1altelieta( a2ra(mp;u1ope ifetlsfa elu p (0alerifciodlatrlu sl( trur(m iydoleelivia() rtaxrpoo0oltnif3ias s2umu snu0altoio3oadfmD  neo;()t2um(r io1lmeelneils artrxmpnt0tetomoctydlm2rm( s;t0 leomr3ty1lmteli ilt s2trxo oy1ame  icsls  rtmxr oo0aeeoifeiasla2ea(monu4 etomoctatlmD  nvi;t0srxo(m3nu4omtemietl()a2rmu o;o1tlxo i3iadlsDrmnvp;t4trtnxo3oydoa rai o t)srtmir3iudale  nvs sf Dur(r ;t1opxo f3iytfa rlnvp u0trtoxf tadom r u i;s) eurir3nu4ap elfcs s  rrau  ou1oet  feiytfa2rl(ms;t0 eeriocoodom rlneols seto(m nu4om  mnct ()a2ta(mooo1olt io3iat s2uaumo t4tlxnxr oadfpD auvo;t)setrxr nu4lme lnvsls)s2rmx  ou0olxoioeiyd m uluvs t0 ltrmf3totfmDelu i;()texoir ny1optnmnctatf 2rmum oo1opx mfciysfsDrlnvp;() ltnif3iodlaDeaivslt sruo(m3iy4amenlictas s2ua(mp;o1open feiatlaDrmu p u4treomfcio1fm rlieo s seuoxmpiy4am elietatfaDurx p;u0tpx  icilsls emums t0aexrxrcty1fp  lnvi t  etm(m3oo1amtelfei ()aDurxmpno0olto o3iasfm eauvo u)tetnmo3iy1laD  nvs;()t2xo(r oy4ameelict tf 2rm( pot1apen f3iyt m2ulump t4tltoir3oydopDr uvil( setoirpnodll   ici t)s2rrx  ;t1apxoifetltfsDelnmonu0altrmociodoaDraies;t s2tr(r oy1lp nlfcsatfsDtaxm ot0oee io3ild a el( p;(4 lxrxf tytoptranvi (0trtoxmpiodlp e ncils s2rmu  ;u4oltomieiasla emn snt)tleoxf oadfp eanes;t s2tm(mpnu4apenlnctl(fs2ua(r ;u4tlto oetad aDra(mont)texrmrctydla  ln olt0 exrir oy1omt mncsatfaDtau  no1aex  ietys mDumumo;u)arxnmr oy1omD luesls0s2xrxr3oudaltnmncia()a2tru ooo4tpen feiyt s2emump (4arenif tytoaDr nvo ()seuoirpiodlm nmict t)arur(rp;u0alx mfetyd a emn o;u)teeoir oy1om rln s s srxo(o oudlme licta(f rtrur ;o4tee  ieiltfm2emuvp;(0 rtnxr3oa1fa   ueolt0srtmxo iudlp e fcsasfsrtrumont0aexomietldfaDrm( snt)alermocoodfp   nesl()t2xm(m io1aptnmfet s sDumu pnu4opxnifetltfmDrmu o;(4 etomf3iy1fpt au sl(  rxm(o3iy1lm   fetlsf 2ta(monu4teeo f3tyt a ra( p;u0 eeomo3tatlmt  ivi;(0teuoimpiy1omtn ivt (faDtmx  nt1tlt  oeiyslm2ul(msnt)artrxocto1lat lnvo ( t2tm(m iy1ameeliciasf rrrxmooo4oexoioeiyt s rauvs u)tltnmocootlpte u i t0 rxmxm3ou1amt  ivt s)a2ua(mooo1teenmfcilsfsDumnvs;u)alxomr3iy1op r uei;t)trxrim3iu4ol nmnesl()s2rmu o;u0aeeomi3ilslm2ua(vs;u4trxnir3totoaD lnvslt sexmio oudllt lfctlt srrmxrpou4opx moetat aDeluvs u4aexoxocoatfp eai ol(  eum(o3nu4omenlnctas  Dum(mpnu1apen octat s ean sn(0tltrxr3iatlm e nvs s0s2xoiopnu1amtelfvi s arrmu pnt1apx  fetat s rl( snt4 rxnmrcoo1fpDeaneols  rxmxmpoo1amtemfvtat s2tmumo;u1opxoiociydfm elnvp;() lxnmf3tydoa e neo ()setrir oudop elieil(fs2ta(r nt0tex if3iasfm2ran p u0texrmo3iydomDeluei ()texm(m3iodamee fcsls)aDta(m oo1alxnmoeiasfaDua(vsnu4trxnxf3iydoaD aues s)s2xrxr3nu4lleelieils aDrrxm ;t4alx  oeildla2ra( pnu0tltrif tytfa e uvs;( s2umiopiu4omenmfctatfarumxm ou4texnmfcild aDuln o;() ltnif3oadfa e uvi;t0 2uriopiy4lp nlfeiat)a2taumpnt1tet mi3iys s el(mo;u0aeeomf todfate uvs;(0texm(r ny1lmeelictat  rumurpou4tpx iietyd s2ranvp;(4 exoif3iatlptrlu o (0t2tm(r3iu4al nmictat  Dtm(monu0apxn i3iytfa ulnmo ()aetrio totlp   ieo;s truo(r3no4lmt mncsl(  rtmxrpnu0texomf3taslm2eauvp;()texnif3oatfa  lnei (  rur(m iudlpe livi (fsDtrxro;u0oeenmf3tltfa ua(mpnu)aetrxf iatlaDraueils  2urxo3iydoptnmfctat)s2tr(m nt1tlxoif3tysls rl(mp;(0tlenxr totlatraiei;s)s2to(o3nydaltnmnct tfsrtr(  no4apxn ietys m uaumpnu)treoxfctatfpD lnvo s)s2xrxm nu4aptnmnvs t)a2ua(m ;t1texnioeiysfs ul( p;u)arxnmr ia1lmt aieo;(0texmir3nu1lmtnlnctls)sDrr(r oo4open fciltfm emu s u)aetoir iodom eaneols)trxoxrpoo4omenmicsltfsDtru pnt4tlxomictytfs2rmnms u0 rxoif3oytop eau sls  2trxr ou4lmeemnciat)a2taxmonu0aexn octyt aDuanvo;t0tltoxo ta1omDeai o t)t2toxm iu1llenmneilt  Dtmxm no4tetnifctls m2rau o t4arxoxrciadfmDrauvs ()s2xr(mpnodlme  nvs () rrrumooo0apxn oeiydlm ea( s;u0tltoifcoytfpDeauvi;t sexr(r3nudope lfvs s)a2rr(m nu0apx mfetad a eanms u4 etoir3oydopDe i o s)tetr(o3iydllee fcsat) rua(mp;u4ole miciasfa2rm( o;(0 renif oydop  ln il(0seurxm3io4ll   ict s s2tr( pou0alx miciyt s2el(vo;()teerioctatfm rlneo;(0setoxmpnu4lmeemicsl(fsDumx  ;o0apxnmfeiad s ran pnt0aexnxr ta1fat aieslt texo(r nudomee ici t)artru ono1apx iieiatfa2emu s;u4teenmr tadopDean o (0s2urxm nudal n net (f rrm( pou1tptnmoeiasfa rm(ms;t) rtoif oo1laDr i i;()setmio ou4amt livia()sDrr(m nu1tleniociltlmDrl(vs (4 exoif3iodfmteli s s0 etrxo nudap nmnesas)aDtmx  nu1tptoifeiat a emu s u0 leomrciotfm  lieo s0 rxoim3oy1ol  lfctasf Durur ;t4tpt moetltlm2emn p t) rtnmf oydfm   uesl(0 2xr(r oy1llenmfci t  2rrum ;u1oeen o3ils aDem( s u)arxoxfcty1op  lu i s seuoimpny1aptelfct s) Dur(r nu4aptnmictldlaDea( p t4tlxrxf oo1opD lnei;s0s2toxopny1lp   fesltf Dtrumo;u0tetomfeilt s ean pn(4teenircty1lp eau ilt0 2uoxmpnodoleemfci (fs2trxrooo4opeo o3tadlmDra(mpn() ltomo3oatfm e n ilt) rxr(m3iy4om emnetl() 2rr( poo1apx ii3iadlsDrlu s;(0 renioctodoa elneslt tetmxm3iodop emfes (f rrrxmooo1alxo f3tld a2umuvp;u0altniocoo1om e u ils0 ruo(rpny4amenmnvslt) Dum(root4apto i3ildfa el( o;t0arxoxocoy1fa   nvsl(0texm(opoudol emfeiat aDuaxr no4tpto fetys a2rl(vo;t0artnmf ia1fp  anvsl() euoim no4lptnlnes t  2umxmo;t0tlen oeiadlmDrm(vs u)texrioctytfaDr u s;s0 eumxr3ny4omt mnct t sDrm(rpoo0tex mfcilsfmDumnmsnt4aetomr3iytfa  an s;s) 2ur(o3iy4lm  lnvias sDuaumpoo0teenmieiasfaDrmuvsnt)tetoxr3iydop rli o t0 etoxr3oudlle  nes t a2rrxrpno4aetnmictlsla ea(vsnu)trxnmo3oadlm raivo;() 2toiopny1om n ieiat) Duaum ;u4aptomictytlm ea( sn(4aexrxrciotlp e ivo;() euo(m3oydale lfct s  2ra( pot0ale if3iatlm rm( p;(0treomo ia1fp   n o;t0 exoir3iodal   icia(  2rmu p;o0teeo ociadls2emn snt)arxoxf oatlm  auvilt0trtrxo nodlptnmfvta(fs2tmx  no1alenifetls a2ua(msn(0 ltrif3ta1la rluvs;t teuoio nu4om nlictas)s2uaxmpno4tpxoiieiltlm rlnmo t0aeermfciodlatrlnvs t  eurio3oy4altemivtls srrrxmpou0oltnio3tydfm2umu pnt4teenmr3oadomDeauvilt  rtr(r iy4altemicsa(fsDum(r ot4olxomfctydla rl(mp;(0 eeoxo iodoaD aieils0s2umimpny4lmt  fei s) 2uaump;t1oexomi3tasls2rmn onu4 lenxr3oodoaDeluei;s) eurim ou4lmtelncsltf Draxrpot1tet  ieiltfs ul(vonu4artnir iotfm   n o s0srumir ny1aleelicslt sDrmxront4tltn fciydfs emuvs (0 lxrxrciodfa raues;t  2xoxm nu4lp n ivt ( arumxr nu0alto i3tatlsDumuvs ()tlenxfciytlatr uei;(0trxoxr3nu4alt lnvia( aDtru o;o0olxn ocildls2emu p;() lxomr3iatfa eliei;()teurimpou1lpte fviat a2tm(ronu4opt mfeiat sDemnvo;u4tetnif tatopDrauvsl(0 rumim ny1apenmfvt sf rrmxm ;o4oexnmf3iatfm2rlums;t4 rtnmociadlatr u sls  rumxmpiu4lme micsltf Dtrum nt4oltnmf3iyslm2um(vo t) reoifcty1fp r i o;s0s2tmxr nodamt lfetat s2rmu  nt0ale  oeildfa2emn s;u4teenmfcia1optr uei s0teumir oy4ameemivtl( s2umxrpno0olxomo3iydfm uluvpnt) exrxr3totopDelnvolt)trumir nudlmen ics sf rrm(mpoo1oltn i3iltfsDeaumsn() eeomf3to1laDrln o;t s2xrxrpou4llt  ieils) 2rmxrooo1tpto icilsfs ua(mpnu0 exnmf oodomtr i o;t0trtr(m iu1lltnmivt s  rrr(r nu1oleo feiyd s2ulnms u4tltnxo3tatlpD  ivs;t0trxm(rpiu4lmenmivt () 2ua( ooo1apxn i3tlt s2eln sn()aexrmfcta1omte i o (  rxm(m3nodole lfei t)sDurumpnt4aetomo3tyt a2eauvp;t0trermo3ootoatr nvi;(0 2urxo3iu4aptn fcias aDur(mooo4tetomfcild s rmumo (0tlxoxr io1lp  au olt0t2ur(mpio1altelnetatf rtm(mpou4tptomf3iat mDeaumo;u0texnxfciatlmt livslt)texrxopou1ap nlnetat)sDrrum oo1oltoifeiatfsDrmums t)treoifcoo1omDeln o;s0trxmxrpoodol nlfviat) ruru poo0tet  oeildlmDul(mon() etrmr oodlmD  ivs;(0srtr(r nu4opee fcs sfsrrru  nt4tpt moctydlm2uau sn(4 ltnio tydomt livil(  exoimpoo1am e ncta( sDuauronu4opxoiietatlmDuan o (0teeoxrcoa1lp eau s t)tetmio3iydal n fviat)sDtrx p;o1tleoif3tltfa2emn o;(4 lxnmoctytfmD ai i s tetrxm3nu1lmt livi tfarrm(rpnu1apx  ocilsfs2uaumo;(4 lxomf3oodlaD ai s;(0trum(o no4ap emnvia(fsrua(m nu0tet  o3iydls rlnvo;t)arxnxf oytoa rlieo;()trtmxo oudom emfetls sDurx pnu0tpeoio3iytfa elu s u)alermr iatom rln o;s)t2xmirpoy1lmen nesasfarumu oot0oeeo feilsla2el( o u)tleomfciadomt lueo;s0trxo(o oydlme lnctatfsDurxm ot1teto o3iaslmDumuvp u4trtoif tydopt  iei s srtmxo3oo4aleelieias srtm(m nu0aex mf3tadla2elu pnu0 lxoxo oadfpDe u i;t0trxmxrpoo1apte netl()arrmum ot4oltnmf3ils sDulnvo;(4alxrmoctatoateau s;s0teum(m oodlp nmfvtls artau  ;t1apxomfctydlaDul(vsnt0arxnio3oydomDrai ils0srtm(o nudlmt mfvi ()artrxrpou4alt mf3iytlm elnmo;t)trtoirctotop elu i;t) 2xoxr ou1om  livsa(faDrm(mp;t1oleo i3iydlm um( s;(0 leoio oadlatrlivi;s0t2tr(o3ou1lpenlnesas aDum(moot0olx  ieiydfs umu p;(4 ltrmf3to1optrluvilt0seum(r3nu4lpte feta(  rrax  ;t1olx  oetltfmDemn pn(0altniociadfa raivs t  rxr(o3iydop   nvt tf 2taxr ;u0tleoif3iasfa2elumsn()teerioctytfat aneo;t setr(opno4apt lici t) 2uaxmoou1texo feiatls2rl(msn(0artomrcoatfpteli ol(0srxrxrpoydope  netlsfarraxmont0alt ioctas aDua(vo t4aeeoxr ty1lptrai s ()sexrirpnu1lm emicsat sDur( ono4tpenmf3iadls2ranms t4 ltoxf tadfm rli sls0trumimpoy4lp nmiviat sDrm(rp;o4alx mfctlslm2ul(mo (0 eenxr3iatfaDeaneilt)texo(opnu1ol nlici s) 2taxmo;u0teeo feild m2uaumsnu0tltomf3ootlptranvs;t0 eurxm oy1apt lictasfarua(ro;u0aptnifctlt mDrmu p (0tlxrif todop eai s ()seurxr ou1al elicils  2tmu  nt0oetoioeild s2emu p;u)alerxf3tytfm eaivo t0srurim3nudoltnlfvs (  rrmur ;o0aexoif3tas s2eanvs;() lenmo oatoat ai slt) 2trxm ou4ap emfetat  rtmxr ;t4opx  fctytls2rm( pn()treoxrciadoa  an ils0srumirpio4ap e ictatfs2urxm ou4alxoiietadlm rlnmp t0 etnxo3ty1fmDeln sl(0 rtmim3nu4am nlfvsltf Dtax oot0tet if3ildlaDrl( p t4aexrif3iy1lm  anei ( t2xo(o3no4am nlncs (f 2raxm ;t1aetomfeilsla rlu p;t4 lenxf3ty1lpteln o;(0 2xm(o3iudlp nmivs s)sDrrxr nt1aexniieiltlsDrl( p;()tleomr3ootfpDraieils0texrxo3iudomeemiesas sDrrxroot4tlxnii3tldfmDea(von(4alxnmociydlm elnes;s srxo(m3oy1lp   fvilt)a2rau pno0olt ifetad mDumums;t0artoir3iytfmDrlieolt  2xm(r3no1om  lnesltfaDrm(m nt1apxnif3iasfsDuauvp;t4aetnxocio1lm elivo s trxmxr nu4apeelfcsa(  Durxmont0aptoioeiydfaDel(mp u0 ltomo3tydopD auvi t0 rtmxm3oy4om e fvil( aDumx ooo1tptn i3iltfa2ul(mont4 lenmfcta1fmD li o t)texm(o ou1apeelnvs (  2uaxmpoo0aetnmi3tyd mDumnvs u0tlxnmfctotom eaueils)seurxo iudamtnliciatfsDraxmo;o4aee mi3iytfm2elumsn(0tlxnirciotlpDrau slt  exoxo3oo1om   nvi ( arum(rpot0tpxomo3tat m2uluvp;u0aeerirciotomtran o s t2xmir ny1openmnvils aDrrxmoot4opeoif3ildlaDrauvo (4tlerxocoa1oa rauvs;( t2xm(opiu1al  mfvt t sDuaxrpot4aet mi3tasfa uanvsn()alxrxo3oy1fp eaueo ( sruoxr ou1alte fvs s s2tru pot0tpx  oeiys a2emnvo;t4 eenxocoa1la eauvo ( t2xoxr3nydll elieia( a2rrur ou1aptnmietlsfsDelnmpnu)tleomf3totla eaivo s0sruoxr nodlmtn neilt)s2tm(mp;u4tlxnif3tlslm2rmnms;u)aetriocoytopD  nei;(  exoxr iydame mfcs t) rurumpnt4oeeoii3iatfs ul( ont)altrmf3iodlaDeanesls trxr(mpny4lpee nesl()arrmxro;t4aeenmfetyt a2umuvp;t)tlxnmfctytop rauvils) 2xm(m3nudolenmfvils)srtmumoot1tpxn oetas s2ranvont)alermo3iadomD livo (0 exoir nydale  iviasfsrtr(r nt4olxnifctlsls2um(vp u0tetoioctadlpDrluesls0srxrxm3iydame  nvi sfaruau p;o4tex if3iyd sDra( s;t0 lxnxf oa1opt lnvo s  2xmim3oydoleemfvtls srrr( ono1opxn oeiatla2ran snt4 eeoif3tytomt luvil( t2xr(r3iu1ll nmivils) 2rm(  ;t0apeomo3tldls rm(vsnt) rxnxr3oytlmteaiei;t)s2urim3iy4lpeelivt (f Dum( ont1oeen i3iadlm eaums;u)alenmf3iytfptraues;(0tetoim3io4lleeliciat aDrrur oo4tpxomieiytla eaump;t0texoirctadlm rln sl()t2umxm3ny4amtn icsat aDraurp;t4tpenii3iydlmDelnmsnt0artnxo3iy1latrlnvi ( sexrxr nu1openmfvslt sruax p;o4altoiictlsfs2el(mpn(0teenmfcoo1oat  i s (0sexmio iu1ale  fvtatf rra(m oo1tptnmoeiasfmDrmuvont0tltomo ty1fm   u ilt)trxoxm3iu1ll emnvslt) Dra(ront4aleoii3iydlaDea( p u0aetomr oodla  luvilt)seur(m3oy1open fctls)sDuru  ;u1tltoiietld a umnvp t)aleomociatfp  auvo;t  euo(r no1omee ivslt) 2um(  nu4tpxomieiys s ulu o;u0trxrif3tatfpt  u o s)srumim iodll nlfeils)aDum( ooo1aexomociydfa em( o;(0teeoxrctatlmDe ueo;s0 rtmio oo4aptemiet ()aDrm( pnt1oex mfeiltlmDrmu s (0tlxoif iytfmt lu sl()s2to(o3iudalenlfvtls) rumxm oo0oltoio3ils m2umnvp u4trxnxf3oytopDr nvol( srur(o3nu4lptnmnctlsf 2trxrpnu0alt mi3iytla rl(mpn(0 lxrmf ia1latrliesls0tetoxrpoy1omenlnesls)arrr(  nt4tlen f3iad a rluvpnu0trxrxrcoytfa r uvo s)trtmim io4omte fci ( artaur nu4oexoii3iytlm2umnms;(0treomociodlpD aieils0 exmimpou4am n nes s sDururo;t0oee iieildfsDrmnvo u4tltrmr iodfpDr n ils)setr(rpnydap  mncslt)arraxmonu1olxo fetltlaDrm( p;u0trenmr3iotlptr ueo s)sexm(o nudope  ivsltf Dtaumoot0oleo i3iasfa rl(vonu4 lxrxoctodlpDeaneol(0teumxo io4lmenlnctl( a2umurpou0altoifciysla2eauvp u4arxrmocoydlat  i s t trumimpoy4lpee nvtat srrmumpoo0olen ietyslm ua(vpnu4tlenmfctotlpD lu o s0 exr(m ny4olte nci s) Dtmumpno1aexn i3iatfa2em(ms u0 ltoir iy1lp e neolt)s2toimpiy1ole mici t)a2tm(ro;t4aet ioeilsfm2eauvs u4 leomr oytom  auvslt0srtoxr3nodlp   ieiat)aDrmumpnt4tetniociydfa ranmo;t4treoirciy1fa eai s;()trxoimpnodoltnmfes t)s2uau  ;t1opt  ieiltfm2rln s u4alxnxocootfp   nvil(0 ruoxr3oy4apeelietlsf 2raum ;t1tee mo3iasfaDrluvs;(0trenmrctodfaDraneil(0seurxopiy1openmncs s aDrm(m nt1tlxnmo3iyd m2emn on(4 lxoiociy1laDrlueo (0 etriopio1lpenmfvsas)srrm(  ou4aexoiieiydfm2rl(vp t4arenxfcia1om elnvi;(0 2xrir no4ame mfetls aDumur nu1oetn oeiasfs rlnmp () exrirctadoa rluvilt0s2toirpoy1apt lfet s sruru ooo0tle  i3tasfm ra( o;t) exomo oy1lmtraneils0texoir ny4lpe micta()sDrrxm ot4tpx iiciyt aDemn o;(4 rerxo3iatfmt luvils t2umxopiodlptemics t)a2taumpot4apeo fcils s2eaumsnu4trxnxf3ty1fp  luei (  2to(o iy1ol  mictlt  2rr(m ot4ape ii3ild m2rl( o;u)aexoif3tatopteluvils0 eumxm oy4opt mfciat)srtrxrpnu1alxomoeildfm ranvs;u4aeenmo3oadla  aues (0t2xrxm3oy4lpenlivsl(f ruaur oo1aee  i3ias aDrau pnt) reomf ia1fpt  i o;s)sexoio iodolenmiei sfsDrrur nt0olxn iciltlsDemumo (0aeeriocoadomD  ivo;t0srum(r iydaptelietl( sruaxm ;u4oexoif3ildfa umuvp;(4 rxoif3iodfa rlivils sexmiopoo1ol  livsas sDurxroot0oexo fciys m2em( p;u4 rerir3tytlpt auvslt)trto(r3no1lpt  ict tf rtaumono0aet  fctatfs2ra(monu0aetrifctydoa  luei t seumirpoo1ll  miesas) rurxrpnt4opto i3iytfmDeanvs;u4tlxnmrciytlmt luvs t  ruoimpou1ape  icsls) Dtmu ooo0apt if3iad a2ranmp (4trtoifciy1lpD lu s;s0 2tr(o3nu1optn fci t)arra(r oo0opeo ieiytfm rm(mp ()aetrxr todopDr nes ( sexr(o3oodop emfes ()sDra(mo;t4tpt  feiytlm rmn s (4aeermr3oo1om eanes s0srur(mpnydoleelfetat) 2ta(ronu1tee ioetldlm2rlnvo;()trxnmfciydoatr iei s0 2um(mpnudlme  neiat) Drr(mont0apxnio3iys aDrau p;u0 etoio ty1laD  uvols srurxrpou4apte netlt)s2ta(rpou0oetn f3iyt a2rl(mp (4alxomocootlat lnei s0t2xmim3nu1ll nlfes t)srrrur ou4tltoifetydla ul(vo;u)aeerirctodfaD  ivi s) eto(m iy4ol  mieiasfarraxmono0aetniiciltlaDrl(vs;t)aetoio oy1lp r i s s) 2xm(o3no4altnlfetatf 2rrumpoo1ope iociadlmDrm(msnu) etnxo oytom eaivs;s)trxo(r3iydam e nvias)sruau p;u1apxniicilslaDum(mp;u4altrif3iodfa r ueslt)s2xoiopio1aleelnvtat artmxrpoo1alxnmi3iasfs rm( o;()trxrir oytop  lu olt0 rtm(opiy1opt  ici s a2umxrp;u4alt if3tadlmDrlums u0trtrmr3iatomtr ivilt)trto(rpiy4om nlfvslt sDrrxmo;o0apxnii3ias a2emuvp u)tlxoircoydomte u s t)s2uoxopoudomt  fvi (faDurxm nu1teenif3iltfa2ua(ms;t4teenif todfaDrauvs (0 euoxrpoy4am elfvils)aDrmxm no4teeo oeiytfsDeanvo u0arenio3totoateaueols0 rurio oudaptnmfvt ()aDrmumpno4tlx  feiysfs ul( o;u0 lxomf iy1la   uvo;(0t2uriopnudop nmfct tf Drmu o;u1alen ieiatfm ranmp t)altnmr iatlpDeli s (  2urxr io4olte nvs tfsrumx  no0tet  ieiydfs2el(ms;u0alxoxr tydop eaueo;t0 rtrxmpiudlmenlieil()srtr(  nu0apt moctysfmDel(mp;u) leniocootoaDr u o;s  eumxo3iu1oltelfci ()artr(m ou0tlenii3tlsla emn s u)areomf oo1oaDraies;s  rxo(r3ny1lp e fes tfsrumumonu4opt mociasfa ua(vo u0 rtoxo3oadfaDrauvi (0t2uoxopio4lmee iesat s2tmu oou0tpxoifeiydfsDemnvs t)artrircoadlaDe u ils srxrxrpio4amenlietas a2rmu o;u0oleoioetatlaDea( sn(0teenircty1oat  ueil()srtoxm ou1lpen fvil(  2tm(mpot1oltoii3iltlsDumnvsnt)arxrxrcoa1fm  lu il()seum(rpou4al nlnct ( srtrxmpot1opxo ietldfaDrlu sn()tlenmfcoy1fmtr ivo (  euo(o3iu1lme mfctl(farrauro;t4apxomieiys s2rluvp;t)teenxociydoa ranvs;t)srxoxm nydomtemfctl(f rrru  ;t1tle iiciysfm ul( p t)trenxrcoo1laDr i s;s0sexm(r3oy1om   nvsls s2uaum ou4alx ii3tatla el( s u4arenir oydfaDrln o () 2toxo oy4apenmictat)sDrrurpoo4tetomo3iad s rl(vp (4alenmo3iytfp ean i;s0 rxr(m3oy4lm elietl(fs2rrxm no1oeenmo3tadls2emuvpn(4aetoiociodoa rluei s0 rtrim oo1lleemnct ()s2umurp;t0texoif3iys aDum(mo;()areoirctodopDrlnvols0srtmimpiu4opeemicsa(fa2rm(rpno4oet iociadlm ea(vsnt4alxoxf oodlm r uvsl(0texmxmpnu1lltemfci sf 2um(mp;t4teen ieiyt mDumuvpn(0 lxomf3tatfateln s;s teuoim nu4lltelneils  2ua(r nt4tlx io3iytlsDumnvonu)arenxr ty1la raivo s0t2trio ou1ame  fvilt a2rmump;t1tetomiciydfm2eanms;t)trenxociadoatrlnvs s0texr(m3oydlle  ietatfartmuro;o1apxoifeiadfa rmumo t4aetnmo ta1fptrauvi (0sexoiopiodomen fvs ()arrrxmpnt1alxn ietlsfs umuvo;(4 lerxocia1laDelu sls  etmxr3iydlm emictatfa2uax oot4olenmo3iyt sDrm(msnu0artoxocoadfmte uvo;(  exoxmpoudoptelicsat) Dumx oot0apxnif3iadlm uan ont0tlxniociodlmD  i s;s texoim nodlpeelfeiasfarta(r ;t1aeeomfeiltls em(mp;(0aeenir3ia1opDean i (  rxmxr oodopte neiltfarurxrp;t4apeo f3tlsla2ra( p;t0trxrif oadfateli sls0srumxr iu4apee nvsl(fsrum(  nt4apxoiieiatlm ranmon(4tetrxf3iotop e uvol(0 eumxo oy4op nlivslt)a2trxmp;o0tpen fciytfs ea( s;(0alermr iydfpDelues s tetrxo3nydll  mivs (  Drr(m nu1aeeniociadlaDrlnmo;u4treomo oydla r uvo;(0setoxopnu4omtn fcilsf 2uaur ;t4oleomfciasfm em(mon(0arxomf oatfp eauvi () 2uoiopiu4lltnmnvs tfa2umxmont0aptoiiciyd s eanvo;t) eeoxo iodfpD lnvilt  rur(mpoy1optelivia() rra(mpnt1altn f3tasfs2rauvo;t)alerxr3tydfmD  ieilt0trxmir ou4alenmnct t)s2raxrono1texo ociyt mDum(vo;t0trxrir io1oaDrlues;t seuo(o ou1om  mfvtas)sDrr(mo;t4oee ifciysfmDrmu sn(0altoxfctodlpt lu ols0s2toirpnudale  fcsl(fs2rru p;t4opt mi3iytlmDulu s;(0arxoxr oy1op  lnes;s) 2tmxo iy4ame  fvi t)s2uau pnu1ope ii3ild mDua( s t0 ltrmo totlatr ues;s sexo(m3ou4ome  fes s srrmx p;u0oeto fctat s2eanvs;(4alerir3iadlatrluvi;(0t2uoir oo4lp nmfvsas)a2urur nt1altnii3tadls2rmumo t0 eeoio ia1lpt  nesl( teuo(mpno4alee fctat  rrmumpou4open feiltfsDeln p;()trtrmfctadomDr uvolt0trxo(r ou4altnmncsa()s2uru ont4oltoioeilsfmDrl( o ()texrmo3to1oat anvol( t2xrim3iudll n ieias)sruaump;u0aexnii3iydfsDra(vpnt)texoxo3to1opD  uvol(0trto(m3oudlltnlfcils  rrm(  ;o4ape iieiaslaDrmumonu4 eenmo oa1lmteaneilt)s2toim3iu1ope mivt (  Durumoou4tpeo oetadfa uanvs t)texrio oytom  auvs () eumxo3ny1amen ivilsfsDrrxmoou1tpxomfcildfm2rlumont) lxnircia1fm e uvi;t sruo(mpiy1om nlfctlt)srtr(  nt4oexn ictat sDrmn s;()tltoirctatoaDr ueo;(0 rtm(opio4lle mnes t a2taurp;t1tlx mi3ias a2rmnmp;u4tltoxf3iotlpt ai slt) rto(r iodole mici (fa2rr( p;o0opto ociydfs umumpn(0trxnmf ootlate nes (0srum(o nu1open neilsfsDururo;u4olt ioeiltla emn pnu0aeenifciytfmDelivslt srur(r3no1omen fcia(fartru  nt1ole  o3tasfsDrmuvonu0arxrmfciydoa  livs;t sexm(r3no1lmen fvi ( arrax  nt0tlx  fcilsla2el( ont) renifcoo1omDeanvo;s)trxoir3io1llt mictl(fa2rrxr ou1aetn icils m2eaumo;u0trxrmf3iodoa e nei t)trtoir oo1ole lfvsatfarrrum ;t0alen iciadfaDrl(ms;() lxrir todfaDeai s;s0 2urim oy1alt  ivias)a2trxrooo4oex iieild s ul(ms t4altomf3oodfm eliesls0 rtm(m nu1lleelnci s) 2tmu  ;t1aeeo i3iyslmDelnvo t0 ltomrctadfm rlnei s)tetoxrpiy4omenmfeils)sDrmx pno1olxoio3iat mDumu o u4tltrir3ia1oaDeli o;s  rxoir oy4optelicils sDrr(mpoo1oee ifeilt m rmumsn() etrif3iy1op rai i;t)seuo(mpno1llen iviasf Drmxroou0olenifciysfaDran on() leoxoctydfaD aueilt)srxm(r3ou1omen ivi s a2rm(mo;u0aeto f3iyd mDuan snu0 lenmf3iydlaD lnvs t  rtoxopoo1oleelfctltf rtaumpnu0oltomfciyt sDumuvs;t0aleoxf to1oa eau sls0tetoxr nu1am elici sfsruaxm ou1tpeomfetydfa2eanms;t)trxoxocty1lpDeanvol()trxr(m ny1omtelfcilt) rtaumo;o4aet mfciatls2emumsnu0arxrir totfpDeaueilt  exmio3iu1lltnlnetat) 2tmumo;o1tee mo3iadfm uluvo;(4tltoxo3iotlm elivol()s2umxrpno4lltnmfvi s  Dra(  ;u1apt ifeiadfsDemn onu4artrifcoytlpDr u il(0srxrxrpoo4lptemfesltfaDrru p;o4apeo ociadfmDuanvo;u4tetoxf3io1opDr uesl()trxrio3oudap  mnvi t)srrm(mooo1apeoioetat sDum( s;(0alxomf io1fmteliesl()texo(o3oy1altnlnet s s2trumo;t0apt  octad s2rm( s u) lxnxocoodfm e n olt t2uo(opny1optemivs ()aDumu oou4tpx  ietadfm2em(mo;u4aleoifcoodfmD lueol()trur(r3iy1lpen nvsl(f 2umxrpnu1oltnio3iatfm uaumo t)trxnxocia1omtelnvilt0t2xoxo3ny4lme  fet t sDrm( pnu0opx  o3iyt aDeau pn()trerxf iy1fatrluvi;( truoiopiu4ape  fctas)a2tru p;t4aex ii3ildla2ea( p (0aetnmocoatlpDrauvs ()s2xrir3ou4lmen ieil()sDtmxmooo0alen ociyt sDean ont0altoif iy1fm ranei;s)setm(r ny1op nmfct (f rtaurpnt4oexo oetat m emums;(0 rtrir3ta1fateanvo s teurxr ou4al elivtasfa2ta(m nt0alenmfctasfs2rmuvp;u0arxrmr ta1fp ran s;( trtoio ny1llee iviat) rtmxr ot4olt iieiltfmDelnmo (4arxrxo tadlpDe ivs (  exo(rpiodomt lfvtlt)artrxmp;o4oeenioetld a eaumon(4 exrxo oydfaDelieolt0 rxo(mpou4lm nlictls  rtr( p;o4olxo icilsfs2emn p ()tlxrxf oodoaDrlivi;( sruo(m iy1lp emietlt) Dtm(m nu0tle mfctatlmDul(mon() lxrxr3iytomteluvi;t0truo(opnodom emncil(fs2rmu p;u1altn ietadlm2rm(mp u0 ltnxr oatlaD lueo (0 2tmimpny1ap   ivtl(  2um(mp;u1ale  fetadfs ean s;(4areoxf3oy1lpt  uvi;s0tetoxmpio1lp  lfei (fartmxm nt1apxnmfetyd a2umu ont0tltoif oa1la raieo ( setrxrpoudll n ncta() rrm(m ;u4tpt  fciadlm elums;t)artnmf3oy1om  ln olt setoim ny1aptnmfet sfartmurono1olx moetasfm2em( o u0 eeoxf iodfmtr nvi t0truoirpou4ope mfci (fsDuax oou0tleniieiltfaDul(mp;u4 lxrxocoy1fp rln sls0trtmxr ny4altemivi ( srur( poo0apxoifctytfmDem(mp;(4altrmo3todfp   i sl( t2uo(r oy4ll elnvta()s2tmumpnu4oltniocilslm2uaump ()aetoxocootfa   nvols)sexo(o3nudamtn ietl(faDraxmpou4teenmi3iadfa rmn p u4texrmr3ta1lat li ils0s2xrim3oy1ol emfes sf 2uru  nu4texnmfeiatfm emnms u0 rerxrctadom  auvi;t0sexrir iu1omte netlt aDtr(moou0aet ifetas aDuanvs;(0trtnmf tatop eanvils  etmxopnu1olenmfvsas  Dum( pnt1aexomo3tas m uanmo;u)artoxr oodlm elu sl( t2xoxopio4am eliesltfs2tr( ono0tlenif3ilsfm ua( p;u4 eerxr3iy1fmt lueols) rtrxr oodomenlncsas) Drmu pnu0ole mfeiytfm2ea( p;u0 rtnircta1omD auvs s)teuo(r3nodlptnmiesl(  2rmxmo;t1oleoif3iydfs ean s () lerifciydoa e u i;t)t2trxm3iy1lmenmnvsat) rurum oo1oetniicilslm2uluvsn()trtoir oatfmteluei t seurimpnydlpenliesasf rrm(m oo0oeenmiciatla2ulumo t4texomf3oytlatr neo () eto(o3iu4aptemfctasfsDraxm ot0opeo ieild a ul(vs (0 lerxf3iytla r u ilt0teuoxo3no4omt  fvils)s2uaxro;t4alto o3iytfa2emums () reoifcoa1fpDeauei;t)s2tmimpiudlme mieiat sDrrxm ;o1tlxo oeiyt a2ua(vp;()tleoxociotla rauvil(0s2xo(o nydlp elnct s) 2rr( pot0tpt  oetldfs2emn pn(4tltrmr oatlpD lu ils0 2tmxr3oodameemnvil( sDtaxmp;t4tet ioeiyd s2rmu o;() rxomrcoodlmDelivols0setm(mpoudapenlivils)aDrru ont4aptn iciysfmDrlnvo t4alermfcoy1fa  ai olt)s2xo(o oydamt lfeilt aDtrxrp;t0tpe mo3iadlmDrauvsnu) renxo oytomD  n s;s0tetrxopiudaltnliei ()srta(m nt4tptoioeildfs rlnvs t0 reoxocoodopDr uvi t)srtmirpiudom n nvtat  Drmu ont4tle  oetydfaDeauvon() eenxf oatlm  an ols) etmxo3no1lm elfvi t) Dtmx pno0aetoiiciytlm emnvpnu4 rtrxo3ootfpDelivo;t)tetrxo no4ol n fcsas  Dra(rp;u1altniiciltls2uluvo;u)arenmo io1lm r uvs;s0sruoxopiu4oltnlicil(  2umx poo1ale  o3tlsfsDra(vs;() lxrxocto1fatelu olt) 2urim oo1optnmnet t) 2rmxmo;u4aexniicilt s emnms (4tetnmo3iy1oa eaieo t0s2tmxopoodllenliei s)arua(m nu4ole ioctat s2uln p;u0tetomr ia1lmtrlies ()t2xrxmpnu4olee iesas aDtaur ;u1aex mfetldlm2rlu p;t)aexnmo3ia1lmDeluei;s0trur(mpiy4ll  mict sf 2umum ;t1teenmocias a2rlnvo;()alxnxocoodoa e ivi;(0trxmir io4llt  icilt sruaurpoo4apxomf3tldfa2rlumpnt4alxoxr to1lpDeanei ( srto(mpiy4apenlfcsls  2rm(mp;o4ape  iciydfm em(mo;u)trenxf3ia1om  ai s ( teumir3ny1ap e nctl()sDtrx ont1open octyt sDem( s u4tltomr3to1omt luvs t)t2urim nu1lpeelfvilsf Drax pnu0opx ifeiasfm2ulnvpnu) exrxo3iodomDranesl()trumxrpoudole  ncsa(fsDrr( pnu4olt  fctytlm rlu p;(4artrir3iytlpDe i slt) 2xmxrpnu1lme livi () 2rmumpou4alt  fcilslaDumnmo;u)treomo3tadoaDe uvi;s sexmxmpnu1lleelfcsls arrau p;o1oleniocildlsDrm(mo;u0 etrmf3iatom eauvi;t  rtmxopio4lltnlnctlsfarrrur ot0oltnmi3tls s uan snu0altnir iydlmDeauvi;s)s2tr(m io1omtnmicsas sDrrxmo;u4texomieiasls2ran pn(4tetomf iydlaD  i o t0truo(r oy1aleemfcia(f 2ua(ro;o1alt mfciltla2emuvs;(0aeenmo tatopt auvi;s0 rtmxo oy4oleelivtlt s2urumpnt0ale ifcildlsDrlnmp u4 ltrir iotopDe uvo (  2xrimpiodaltelfcta(  2tmumo;u4texoifeiydlmDea( s t4trtrmrciodlp  aieo (  euoxrpoy4omtelnvt s)aDrr(  nu1apeo o3iadfmDemuvs u4tltrifcoatomtr ueol(0trumim iudamtnlies s sDumump;u1olto ietas m2um( o ()arxrmo oytfmDrlivi s0trtmirpnydam  mncslsf 2um(  nt1tlx ioeiltls2rauvont)altrmfcoadom e nei;t0srtrir no1lpte nci () Dumx oot4aptnmfctyt s rmnvpnt0trxnxo tydoatr ueo;( trum(rpno4am emietlt)arra(m oo1olxo f3tasfa2eln p u0tltoxr3todfat  ies;(0 exo(o3io4aleelfeta(fsrua(mp;o4aleoif3iytfa2umu p t0tleoifcoytlp e ieol( s2urxm iodop n fvtl( aDta(r ot1ale  f3iadlaDrlu s;u)trtrxr tatfmDran i;()sexr(o3no1omenlicta(  rtaumo;u1tpt io3iydlaDea(ms t4 lxomfcia1lateaieolt trxrxo io1om n ics (f rrr( p;u0texoif3tld mDeluvont0alerio3ty1omDe neo;(0t2tmio io4ameelneil() Dtrumo;t1aee mfeildlaDra(mon()aetomociytlpD auvs;(0tetrxm io4lmee ivil( a2tm(moou0oltomocils s2ulu s u0 rtnif3oo1fat aieo s0t2umir3oo4am   ivtlt)sDraxmo;u0ope  fetatfsDranms u4 rxnxr oy1faD liei t0teumirpny1lmt lfvi s)aDrrur no0ape  ociatla ua(vp;(4artomr3iadlmteaieils0trurxmpoy4amen fvslt arrm(r ot0tlto o3ilsfs2ra( s t4 eenmr oa1optr i ol(  2trxmpno1ale lfctltfsruru o;o0aetomoctltla uanvp t0texoxocto1oaDr neslt0trumimpoudol e netl(  rrmxmo;o0oee moeiytlm2umuvp t0 lerxocia1fmDr nvols  rxmir3iudoleelicsltfs2tmxro;t1apenifeild a2emn o t0tetrmo oytom   uvi;s)s2xriopou1am  mieta(fsDtm(mont1alen fctat a2rlnmont4aexnif3ta1lmtelnvi (  exr(o3io4apenmieil() rtaur oo4aexnmo3iytla2el(ms;(4 exomrcoo1lm eauvs t)t2xm(opoy4op   ictat sDtr(mp;t4aeen fetat aDumnmon(4aexnmfcoo1omDrau i t)s2um(r3oy4omenmfci ()s2urxroou0oetn ieiys s uluvo;(0 lxnxr tatlmDeauvslt0t2um(o3oodllen ict () 2um( o;o4olto ocils aDea(vo () rtomf3iy1omDelieo s0srtrim ou1lptemneil()a2uau pnt4tet miciasfs ulumont) eerxf oydfm  luesls t2xoxr oy4omtemivt sfs2um(m no4olt  o3iysfm2ra(vsnt4tetomo tydfaDelnes () 2to(mpiy1ale livil()srurur nt0ole  iciydfs2eanvpnt0aetnmfcty1la r uvo;t0tetm(m3ny1ll emfctatf rua(rpoo1tetn ietyd m uanvo;(0texrxrciadfatrauei;( trxmxr3oodalt  nvslsfs2rmu o;t4oexo octysfs2uaumon(4texnxf iadlptr u o s)texmxr oo4lpte fcsl(  Drmxmo;o1tpeomfetlsla2ea(vsn(4trtnxr3oytlaD  ivs ( srtoxrpiydll n icil( a2ra(rono1tpe iictadlm ra(vsn()tetnio ia1la ean o;t) 2xrir3nydolt  ivsatfsrtm(m no1alxnif3iytlm elu sn(4aeenxo to1lmtranvi s0setoimpoo1al e ncs s artau  ou0oet mieild mDemnvsnt4tltnmo3ootom r nvi;t  2urim io4lmtn iet s  Dtru onu1optnifetys a rmump;u0aleomo oo1oaD  nes;s0tetmio3oydllee fetlsf rurxmo;t1alenifetlslm uanmp u0trtnmf3iytom  ln i;s0seurxr3oudamtnmivt s) Dtm(m ;u0olenio3tlt m2ua(vs;(4aeeoxfcoytom   nvi t0t2xrxo ou4lm e ietls s2rmxmo;u0open ieilslaDulnmo t) rtoircoodomteli s;t texoxr3oydolt  fvsl(  ruaumont4aex moetys s emnmon() ltrirctadfmDe n ilt0 euoir nydll  mfciasfsrtr( pno0opx iictad m2umn s (4 ltrif3ty1lpt auei;t0tetm(m3iydap   feta() rraxm nt4tlen o3ilt s ea( p;t0aetoxr oy1fmteaues;s) rtm(m3oodap nmivi t s2taxm ;u0oet  i3iltfs uau s t) ltnxo oy1fa ranvi;t0srurxmpio4optn ieslsfaDrru oot1alxomociad mDrmnmsn()artnmrciadlmtr ivi t0truoxr3nu1lm elfvs tf Dur(ronu0oltnii3iadlmDrmn s u4texnmoctodlaDr n sl() eto(o3iodom eliesl(fa2ua( p;o4oleo o3tad a2ulnmp ()aetoxr io1lptrau ils truoim3io1apt mnci (fsDraxmono1opeo i3iatfm2emuvpnt)teeoifciytoaD  n ilt0 2uo(o nydlm emictls)arrrxro;t4tle ioeildfsDrlnvpn()aeenifctadfat lnvslt0srumir no1lp e ncsls) rrmxmo;t4tee mietysla2emn ont)trtomoctatlpteaivsl( setrxo nu4apeelivta( arta( p;o1aetomfciytla2ulnvonu0trxoxo iotfpt  u s;t)t2xm(r oy1ll  lnetl( sDrm(rp;t4alx  ociyt a2em(mpn()arxomocia1fateln ols texmio3nu1olenmnvsas) rumx pou4tleomfetaslm2ranmo (0trtrio3oadopDeliesls0t2xoxm iudole mics sf rrmu ooo1aeen ieiytlmDem(ms;()aexrxr iy1fpDr nvo s texoio oo4ameemfvt sf 2umx ooo1oleomietat m rlumonu)trxnxf3oo1fmte nei s  eumxmpoy4oleelivs t  Draxmpnu4alxo ietyd s2emn s (4arerio ia1lptelivol()trurxopiu4ap e ncta() Dra( pnu4tlx mocildlm umn on(0alenmocoodla e uvi t srtr(m3no1ape miciat arumu p;o4aexomi3iltla uauvo t0tltrir iydfat lieslt0srxoim3iudom n fvias sDumxm nu4aet  o3tyslaDemuvs ()tleomo3ty1fmt  u i (0truoir3iudap nlietlsfsDrr(mp;t4texo iciltfa2uan s;()arerxf iadlmtr neo;(  etm(m nodlp nmfvi sf Dtm(mpoo1oleoif3iytfmDean p;t4 eermo3iytop  ln o;s)sexoxr iodlpeelivsltfsrta(  ot1olt  feiyslaDua(vsnt0tetrxrcoatfate ivi t) rtmxo oo4op elfvsa( srra(r ot4opt ifciatla2um( snt) etnioctodom eauvi;t t2xo(m3oy1om n fvtatfs2uru  nu4oetn fetlsla um(monu0 etomociy1oaDran o;( tetmxo3ou1lpeelfvtl(fs2rmur ot1tptoiieias s uauvs;t4 eenio3oydfpDelivols)truoio oudope  ivt s s2rrump;o1texomfeiatfs2eaums u0aetoifctadlate neols) 2tr(opiy1lp n ici s aDumuronu1oeto icildfaDranms (4teenif oydfmtrlu slt) rtoirpio4amt mivias)aDta(mpoo0olxnioeiyd a2rm(mpnt) eerxfcoa1lm   n o t0srtoxo3iu1ll emictls)srua(ro;o4aetnif3iltlm2ea( o;(0aeeoiocta1la   nesl( s2xoxr ou1al   nvsl() rtax ono0apxoif3tysfm ra( p;(4texnmf3iy1fat ln s t0sexmxrpnodlmte fvs s)s2urxmpou4aet ioctldla2uluvs;t0aeeriociatomtrlueilt) exrxrpnu1oltemncs t aDraxm ot4aex  ieiad mDrluvs u0aetrirciydoaD ai slt)srtoxr3oy1ap e fvilt a2taxr ;u1tpx iociyslsDrl( s u4tleoio3oytlpte u ils0trtriopoo4lpe  fvslsfarrax ont0opeoif3tas sDumump;(4tlxomo iy1laDe neil()s2uo(opnu1omt lfeilsf 2taxro;t0aetnifetldfaDemnms;t4 lxnmo io1lmDelu olt) 2xr(mpoudopenmivsat) 2umxr oo4tex  oeiyslm2eluvo u0areriociydfa eaueilt0teur
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;t  2xmxrpiudape lfvils sDtau p;o1tle moeildla uau p (0tltrifciydfaD  ivi;(0 rtoimpou1omtelfct (f Dtrumpno1aexnmi3tldlaDea(mo;() rtrmfciy1opte ues ()texrio iy4lle miei s)srtru onu4tlxoio3iysfa2rmn s (4altnxr3iydfptr i i ()texrio3no4opt  fvs ( aruax  nu4apxoiietldlmDrmu o;(0aeerxf3oa1omte ivi;s0trtmxm3no1ale lnvtltfaDrmx  ou1oltniictld m rmn pnu0arxoif3tydlpt  ivslt teurxo3oo1amtn nvs tfa2raxm nu0tpx mfciadfa2eaump;(4tleomo3oa1opDrlivs;()t2xrxm3ny4aleemncil()sDtaur nt1optn feiyd aDrauvp;u0 exrmo3tydfmD lnvilt sexmxopou1omeelivta( aruaumo;u1tpt mfeiysfmDuau snt4 ltoiocootomteli s s0s2trxr3ou4lpt lfetls) 2umxr ;o4olxnmo3ilslm umnmpn(4 ltnir3oodfptelieo (0 rurxr3iy4olt mivta()s2um( p;t4opt ii3tat s elnvs u)trenir3iytlmteaiei ( setoir3iy4amenmictls)arur(mpoo1ole  ocildlm emuvo;t)trenmocio1fa   i il( s2xrxm oy1lp  mivs sfs2ua(mo;t4oexnif3ilsfs el(mont4aeermf iotop r n s () rtoxo3iu4lmtnlnci tfs2uau oot0alxomfeiytfs2rln o;t)trxoxf ty1om r ueolt s2trxrpnu1ap  liesat  Dtmx pot1opxnmo3tasfs2eln p u4artrxf oydoaDeanes;t)t2trio nu4ame lneiasf rrm( p;o0aeenmfcilt a2emnvs u0 ltriociydlptr n s;(0 etr(mpoy4om e nvi (f 2tm(rooo1olt  o3iadla2emumsnu0texrxfcoatlpt aivolt  eur(m nudlltelfeslsfa2trxr nu4opx ioctyt a ra( o t4arenmociadlpD liei;t s2trirpiy4op emfeta( sDraum ;t1tleoiieilt s2uanvp;u)trenmf3tydomDe ueols0 eur(m3nu1al elfcs (fsDtmumpou0aet if3iydfa2uauvo;u4 ltrmrcoo1opDr ies () euoxrpoodlmenlivtatf 2ururoot4oetoiiciad sDuan o u4tetoioctadoaDeaivo;s0s2uoxopoy1llee fctls)artm(ront4oet iietldla2rmnvpnt4trxomociydlmteln sls teuo(rpoy1ale lnci (  Dta(  ;u4apxnmf3ils s2ra( o u4teeriocoatomte iei s0 euriopiudlltelivia( srua(rono4apx iociatlm2rm(vs u4alenioctydoptelivo s  2xr(o3no1omtnmivslt arra(  no4opto ieild mDrm(ms (4aeenmr oy1fa   neil( trtm(mpou1lpeemnetas  Dtrxrp;o4tlxo o3ils aDuanvo ()treoircio1omDeli ols0s2ur(rpoy1alenmivslt)sDtrx pno4olx mo3tatlaDulu pn(4 rtrmrcootfm   ueil( teum(rpoo4lp nmnet sfartm(mooo0aex  iciltls2em(monu0 rerio iodlm eaies s trtmio3oo1ap emncs tfs2ta( pnt1aleniociasfmDrmn p (0tltoif iotopDrln ol() rtr(m3oydlp  miesltfs2taurp;u4tlxomoctltls2ra(mo u)alerxf3oodlmtr nvols) etrxo3oy1lpee ivs t aDrrumooo4teeo i3ilsfsDea(mo u4 renxfctytfm e uvsls t2trim iu1ll  mfvtlsfaruaumpot4optn oetydfsDrmnmon(0 lenio iy1faDeauvi;()srum(mpiudolenmnci sfaDtr( pnu0oetn ieiatfs2emnmpnt4 rxrif oatfmtrai o s0teuo(r nodap e fviat sDtmu ooo4apxn fciat m raums (4trxnif3totlpt ln slt s2toir3no1lm n netltf Durxmp;u1tpx  ociltls elnvp;() lxnmfcia1fpDrli s t  eto(opoudlm elieil( s2rmu poo4tpxoioeiadfm ea( onu0tlxrxo3tydfa e ivilt0 etrxmpiu1am elncsl( s2uaumonu4alt moetas a uln p;u0tlenmr iytoate nvs;(  rtoxo3nodlmtemivtls)a2ra(r nt0texnifetysla2eau o;u)texnmf io1lp raneo;s0t2trxrpio1llenmfvt tfaDtax  ;u4tle  fetltfa2rmnmp;t4trtnirciodop  auvi ()t2triopnu4optnlfet ()a2trx  ;u1oetomi3tyd m2ua( s;(4 rtnmo tatomDr ieo s srtm(m no4amt  ncs (f rta(ro;t4teenioeiysfsDrauvpn(4arxrir3oatfaDrln i t0seto(opny1olt  ictas a2rrur ou4tee mo3tasfa rlnmpnu4 ltrir3ia1op eli i (0srxmirpoo4aleelivs s)arrrxmoot1tet mieilt mDem(ms;t4altomr3ootfmtran o;( seum(r3ou1lpenlnctat) rrrx o;u0teeomoeiydfmDeau on(4 rtnmrcoa1latean i;( trur(o3iy4llt mivs sfa2tmxrono0oee iictytfm2ra(vs;u0alerio oa1lmDrli o;t sexoxo3ou1opeemfvils srrr( pno0oee moetas a2uauvs t4 etoxf io1oaDeaivs ()tetmiopoudale mneslt  Drmumpot0tetoifcils mDemnmsnt)trxrxocoa1fm ean sl(  rxm(o3nu4ap  miet t  Dtrxmp;o1opx mfcilsfaDrm(mo u)aeerxr todlmteluei t0t2uoio3iu1optnmicsas) 2ur(rono1optomoeiltlaDel(mp;(0aleoio3iotomDeaueil()srurirpoo1op  lfcias a2rmxmpot4altnifciyslm2el(vpnu4tlenmrciydfa e ivo s srtmxm3iy4lpt lfeilt sDur(rp;o4alx  f3ilslsDum( o (4arenif3tatfm raneo;t trtoxm3iy4apt mfcil(f 2rr(ront0teenmo3iad a uanvp t4tlxoio3ty1lp   nvil(0 rxr(m3nu4lp nlnvsasfsDra( pnt0olxo ieils a umu p (0 lenmf3ia1optran o;t  exoir3ou1omtemfvsas) Durxmpot4altomieils a2em(vo (0alermo oa1op e i s;s tetmimpoo1lm  licias)srrrxrpou4oltomf3tlslm umnvo u) exrio tydlpteanvsls)t2toim3iydoptemfcsas) rra( pot1tptnmocildfmDulnms (0tlxnxr to1fm r neo s) eum(rpiu1lpt lfvsasfsruaxronu1tltoif3iadlsDulums;(4arxomo io1lmD anvi;s) 2um(opio4oltnlfcslt artru ooo0tlxnii3ilt a2rmums t4trtnir3iatlp  livolt0 rxoxrpio4om elfetls)aDtmur ;t4aleo i3iltfm ra(von(0 leomo3oytom rlieols0srxmio3ny4am nlfes s)aDta( pnu1alt  oeias a2ua( p;(0aetnxfcia1omteauvilt teuoir oudaptelnct t  2umxrono0oleo ieiltfm umu o u)artomo todla eanesls0s2xmxr no1alt lfvtlsf ruru o;u0oexniieild a uluvonu)artomr oatlpDe ieil(0sexrio ou4altn fet s arrru  nt1oeto fctysfsDemnvsnu) exnxo3ia1oaD  i ilt0 exmxmpiodllenlfviat)s2tmxrp;t1teenio3iltfa2rl(vsn()teerxfctodomD  uvs t trtrir3iu1optnmncs s a2ra(  ou1oeeo ocilsfm uaumsnt0aetoxr3ootlate i o;s s2tr(r nu4lltn nci ( arta( oot0apxo o3tatfaDrl(von()tltoifcootfmt  n s s0 etoiopoy4ll  lfvsa( sDuax onu1optnifciltfm uau o t0artrmrctatomt auei ()t2trxopiu1lm emies tf rta(  ;u4open ietas a2ranvs;()tltnif3iytoatrliesls  2toimpiu1optelneslt)s2umxroou1apx mictat mDum( p;()trxnxf to1omtelueo;s)texrxmpiu4lptnlfvsas srra(rp;o0apxnmictlslmDeaumonu4alermfctodomDranei t t2uoir nu1llte fvsls a2umurpno4aex ioctatfsDrm(vs t4 lxnmfcoytlpteluvils  eumxo3oo1op  livtlsf Dta(rpot0olt if3tlt a2ua( snt)aetrxrcty1lpDeanvsls teto(mpiodlpe  nvtasfsDra(ro;t0altomo3tadlm2ulump;t4teeoxr oatoaD an i;s t2uoirpno4om nmfcsa( artm( poo0tpx ioeilsls2ulnmsnt0 exnxo3ty1op r u o (0srxoio oy4amte ivs t srtaur ;t0tleo fctaslm em(vs t4texoxocoy1op e ues ()teurim3iydllt mnvt s)sDurxm ot0aetnmieils m2uanmo (0 eerir iadlp raieo t sruriopoy4om nlies s)sDtru pou1tpeomietatlm2ua(mp u0altrmoctodlp  lu ols0t2uo(o nu4lpenlies t a2rau o;o1tpxo i3iad s2ea(vp u0tltnio3ootlm   u o;t0trurio iy4apt lnvt t)s2um(ro;u0oleomiciat a2el(vsnu4altoif oytlm raueol(  2uoxm3nu1omenmivi t  2raumoou4apeoifeiyslm2ra( o;(0 rtnxr3oydfpt aieil() 2urxr3ny4amt  fcsa(  rtm( ono4oex  feiysfm2rau s (0teeoir oydfaDeanvils t2xoimpou1lptnmnetl() Drrxro;o0apx ifeiadfa rauvo;() ltomf3tydlm rluei (0texmxo oudopeelfvt ()s2rmu  ou1olxn f3iatls um(vp u)arxomocio1fmDrau o t  2uo(rpny1ll elicias  2um( ooo0oeeomfeiys sDuauvs;u0tltomf3oodomDr uei;s0texrir ou4ol nlfes sf Drr(m ou0ale moeiys s el( s t0texrmoctytlpteluvo;t tetrio nudopenlieilsf 2rau o;o0oetomo3ilt s2rm( o;t)arenmoctadfp eluvils t2toxmpno4apenmneiat srra(rpou1olxoif3iltls2umuvsnu)texrmf oy1opD auvol( tetmio3iu4om n fesl(farrax pou1alxoifcias s2ulums t4aeerxr oadfaD  nvi;t)sexoim oy4ol  mivtas) 2rru ooo4tpeo i3iysfs2uauvp u4texnifctadfa   n o (0 2xmir3iy4omeelfeia(  rrrxro;t1aexn icias a2ranmpn(0 etoxocoo1faD  ies;t)trtmxopnydam n nvia(f Dtmxr ;o0apto icils s uau s;u4tlenmf iytomteliei s  2xr(rpiydale mfeia()artax o;o4apx  oeiltlaDrl( sn(4aeerxo3ty1lmtrln ilt0 rtmxr3oy1aptnmnetasf rtrxmo;t4tle moeiysla em(monu0trxnir iatfa  auesl(  rumirpiu4omtnmnvi t aDrmxro;o1tpe  fciaslsDeanvsn(0 rtnio to1fmDrlnes;t) rtmxopou4ap e ictatfa2urumooo0teeoio3iytfa2ra(mp u)trxnio3to1lmDrlnes t  rtmim ny4lmt  fvsas)aDuaxro;u0aexn ictlsls2em(mo;u0aeermocootom eaivo;()t2to(m3ny4op emfcsasfsDuaum ;t0ope ioeiasla2rlumsnu4artoxf3ty1oate nes ( t2toio3oo1aptnlncsasf 2ua(rooo4tetnioetlsfa rauvp;u) etrxr3iytom eai s;s)texm(m3oy1om  mfvtasfa2uaxmont0alxoiieiad s2rluvs;u0tetnio tydfat ln s;t0 2umxo nu4apeemfcilt a2ua(m ot0optnif3iat m um(vs;(4aexomf3tydfm elueil(  exmio3ny4llt lfei s artr(ronu0alxniiciys m2rmn o u4aeerxo tytfmDrlueols) eum(o no1lltnlncsl( a2ta(mo;u4aetomi3ias s2rlumpnt4aeerirctydfa eauvs t) etoxm3iy1lp   nesat a2umu onu0altn icilslm ul( s;(4trxnxf3tytlatr i sls)teuo(m oodlmte iet (fa2um(rpno1open ieiyslm2rau snt)trxnio3todfm  livs t)srxmxm3oo1oltemnciat)aDtmurp;o1optoiiciad sDuau snt4alxnmr3iatoatelies t0seurio3iudolee net s)sDuaumpnt1tpto icias a2emn o ()trxoiociadfmDe uei;t) 2uo(m ou1op n feilt)s2ra(  nt4alx  o3tltfs ra( p;(4 exnxrciotlmtr n i;t)setmxmpou4oltnmfetatf Drr( pno4tlen fctytfa rmuvs;u0tltnxfciotlaDr u s ()s2xmxmpiy1op e ict tf 2ururpno0apeomoeilt aDul(mp;u) eeoif tydomtranei t  2trxr io4ap elnctat)aDurxront1alt moeiltfa ean p (4artrxfcto1lmt ln slt0s2toxmpou4om nlfcsl( arrrx pot1opxomi3iatfs2el(vs;t0tltomf3oydop ranvo;s)trto(rpiy4olte ivia(f 2ur(r no4tlt mociasfaDul(vp u4aexrif iytomDeau slt0 rurxopoo4open ietatf rumxro;o0tpe mfeiasfsDrl(mont0 rtomrctytom ranvsl(0s2uo(o3ou4om  mnviasfsDtaxrpot4oltoiieiadfa emuvs;t)aexoxocto1fpDrliei;s0 rxr(o oodlltemnetlt a2ta(r ou4tetomociysfmDrmnmpn(0aetrifciytfptrlneilt trtrio ny1omeemfvsa(faDur(rpnu4tet mo3tyd m rm( s;u0 exoxocta1fmtelivs s)t2xrim3iudomtn nvtlsfs2trxmpnt4tpeniietadls2umn pnu0artrmf3to1oatrlnesls0t2uoio iy4alenlfesat)a2tmxr ot0tlxnifciatlmDumu snt) renmr io1lmt  nvi () etmiopoydlp nlneta() 2tr(rp;u0oexnmo3iad m2ea(mont0trerxoctotoaD  ivi t0setoiopny1lpt mneil(f 2ra( poo1aleoifeild s2ean s t0 rxoio3todfmDraivilt) rurxr3oy4apenlnei sf Drmx  ;t1oetomfciadlaDelnvo;u0 rxrio3oatlat aivils)trur(m nodllte ivsatf rrm(mont0ale mo3iydls2rlu on(0trxoif3ootlpD auvo ( s2ur(opno1ame mivi tfaDrrumpnu4teeniiciysfs ulu o u0tlenmo3oa1optrlies;(0t2to(r3nu1lptnliesl() Duaxm no0teenmf3ilslm um(mo;t)aetnxf3ty1lpDraivs s)s2tmxopio1am nmnctas sDrm(  nt4tpe  fctldfaDuluvp (0arxoirciotoaDe neil()s2ur(r3oo1openmfvil( s2ua( ooo1tex ioeild aDum(mp;(4altoxf3tydlaD au il(0 rxr(r3iy1openmfes (farta(m ;o0oex ii3iltla ranmo t4altoxrctatlptelnvolt setoxr oo1ap  miciatfsrra(mpot1tee mietatlm2uln s t0trtrxo iy1late nvi (  rtr(m iy4om  mncta(f Dtaurooo0tpx mictadfs2eln pnt0alerifcoo1lmDr neo;s0s2trir3nodllte fvtatf rtr(mo;u0olenio3iadfm eau p t4trxnif3oa1fmDelnvo s0t2urxr nu4amenmivil( srum(r no0olx  o3tltfs2rln onu4artnmf iadoptrauvsl( setrxm oo1olte fcsl(fa2rrumo;u1apx  ietyt a2ua( o;t) etnmf3tydfp  ln s;s)tetmio3ou1oleelnesas sDtmurpoo0apeo o3ild a2ranmo ()tetnmoctotlmtrai o s)trxm(mpno1ole lfei s s2tm(r no1tee mo3tatla eau s u) rtoirctytlaD  ues t  etm(opno1ap   fcsl(faDrm(mpnu0apenio3iltla uau o;()tlenmo3todomDeauvsl( s2ur(o3ou4ameemicia() Drau ooo1tet mi3tldla2rau on(4treomf3tytoaDeauvo s)t2tmirpnodaltnmict t  Durx ono1alenmfciydfa rm( pn(4 ltnxo3tydlmtrauei;s0s2umirpio4lpe  fvsas s2trxrpoo0aeeomfciatla2ulnvp;u0trtnmo3iadfmD lu ols) rxrimpou1amt  fcs tfsrtrum no1apx  ociadfs2eaumo t)teenxf3ty1faDraivsl( t2xo(m3ou1omtemnes s) rrrum ;o1tpenmfeiat s2rmu s;u)tltoiocio1fpt  iesls0 rtoxo3nu1op nmfcs t a2rmum nu4tpx  f3iat sDem(vpnu)arxnircootlatrluvo;s truoxr3nodlp  lfcsas) rtr( oou4aetomfcild m2ua(vo;()trenxf3oodomtrlneols)setm(m3oo4ol  lfvs (f rur(rono4oltnmi3iytlmDrauvo t4aexnmoctydoat  i ilt s2uo(opnodapenlics t)artru ooo4aeeo o3tlsfa2uluvo;t0 rerxf3to1fmDr uesl(0texmio iu4am elnctl(fsDrr( poo0ope  ieiyd m umumpnt)artrxocoo1op eauvo (0 eur(r3iydlpt lietatf rra(mono1oexnif3iltfsDemuvp;u4artrxf3oy1la   ivilt0s2trxm3nu1opt mneiasfaDrm( pno4texnmociltfs2ean p;(4 leoxo ootlp elivslt0sruoxm3oo4ol nmiciasfsDtauront4tpt mf3tls s2emumo t4teerircoatfateau ol( trtoir iu4ll emnvi s) rtmumpnt4aleoiocildls2eaums;(4alxnxrciytlmtr ivo s0sexoimpny1olen nei s) Duaxmpoo4tle  fetld m2eanvpnu)artnmf3oydlmt  uvilt  rxrxo3nu4am nlivsas) Dtru ooo4oexnifetyt mDraump;(0treoxr tytlmDeanvi;s) 2urio oy1amtnliciltfsrrrurp;t0apxo fciydfa2ra(vo (0texrmf tydomtrlnvs;t)seurxrpoo4openliesa()a2urumo;t1alxn fciyd m rau s;u4trxrmo3iodfpte u il(  eum(opoo1ap emnvtlsfa2uaumpnu1apeniieiyd sDeln on(0tlxoxo3tytfmDrai i t srtmir nydom  lici t)aDrruro;o1oltoioeils sDrmn p u)altrxr3to1la   i o;s)trxrxm oudop  mnvtls)s2rm(mo;u0aeeomf3ias a ea(vs () etnxr ia1lmDr n i;t0 2tmir3nydomtelivs sfaDtaurpnu1open ociat a emu p ()texnxfcoodlate u s s trtrxr no1optn nvilt  Drmxm nu0oex mfeias a rmnvs t4artomo oadoa eauvo s  euoxo3io4ope  ictas) rrr(m no1tpto f3ilsfsDulumo;(0 etrmf3ty1omtelivi;()teurxm3nydamenlicta(fs2ua(r oo4tee mictat a2rlnvpnt0 etoxociotlpD  i o;s) 2um(r ou1amt  net t s2taur ;u1opt iiciysla elnmpn(0teenifcoadopDe ies;s)srxoxm iu4llt mfct s  rrau p;o1oltn ictadfm2uluvs u)tltoifcoatfp  auvsls0srur(o3ou4al e icia( aDtrxmonu4oet iociadlmDemuvpn() lxrmf3oatlmDeau ils)truriopno4op  mfcsas  rrm(rooo0oltnifeiad aDranms;t)arerxo iodfpDe uvs;t  2urimpiydlm n fvilt s2ra(moot1oee  f3iadfaDem(vsn(4arenif3tytlaD an i t srtrxr oy4lp e ics () 2ur(ro;t1tlx moeiltfm2rlump;u4alxrxf3iodlmD  ieil(0trumir3iy1aleemnvsat srrmu p;o1tpx mieiltla2el(vs;t)treomr3todoa e ieslt)sexmxm nodlpenmivils  rrrumpoo4ale  fctysfm emumsn(0aeenxrctytlaD livo t)trxo(m nu4al nmnvsl(f 2tmu pnt4olx iictltfa2ul(mpnu0tlxrxocto1la eaivil(0sruoxopnudlpe  net ( a2taxr ;t1oeenifctlsfm rlnms;t0tlenxrcoadfpt lnvi;t0texrxopoodlp  lfvtl(fa2um(rpnu0tetomoctyt a eanvs;()trxnmf ootoate nes s)texmxm3oodomtelictas sDtruront4oet io3iasfm2um( s (0tlxrmociatopDrlnvi ( tetoio nu1lpe lfesas)a2rrxrpou4tlenmociydfmDemuvonu0 ltnxf iodfpDe i slt0seur(m nudole mivtlt sDtr(mpou1ape ifciasfaDuanvo;(0 rtnxf3iydomD lieol( t2uoio3ny1ol nmfei sfs2rrx ont0alxnmfetysls uau s;u0trtnxr3oadfaD  nei (0 eumxo ny4ameemnvslsfs2uru pno0olt  fciat sDem( sn()trtnio tatfaDr i s (0srumir3iodlm  mnvia()sDtrxmpoo0olxniieildfs2rm( pnu4texnifciatop eli i;t sexrirpoudapt mncsat)s2urxrpnt1ole  f3iys a elnmo t4altnxocoy1fp rauei t  2xmxr iu4ope mfvtl()sDuaxm ;o4aee  ociadfaDranmon()texoxr tadfa  aneolt0 etrimpiodamenmneilsf Dur(m oo0tet  ieias aDelnms;(0arenxf3oa1fate i il()srxo(m3ou4op  mfeilt sDrm(monu4tlt moctad a ea( sn() rtnxr3oo1lm eluvolt)texoir3io1llen nvt () Draxm ;u0alxomictasfmDulnmp;(4 etnmf3oo1fmD auvi s s2toimpiu1am emfei s) rtrum ;t1oexnifetlsla emuvs u0 exoirctadfa rluvsls)texmxo3ny1ape livtls)arur(mpno0oleomoeiatfm eau pn()artoxo ty1omD auesls0 rum(o3iy4om n fct sfa2tmur nt1apxo ocildls emu onu) reoir3iytlaD lies;(0srtr(o3ny4amenmfeil( a2rmx pno0optomictltfm2ul( sn(4 exomrctotfaDelnvs t t2trirpiudllenmncils aDta(mpoo4oeeo feiysfa2rm(vp (0treoxrciodoat lieils srxoiopoodap e nvi t) 2um( ono4tetnioeiysls um( o;t0 eeomocoodfp raivs t0 rtmiopou1ameemfvsl()a2rrxm ot1ape  f3iadfa2elu s u4aexnio ootomDelueil(0s2xoxm iodame lfcilt sDtrx p;t4apx mfcias m2umuvsnt0arxnir iydfat lnvo () rxrxopiydopen ncsasf rtru oou0aex mieias sDeluvp ()trerxo3iodop   ieslt srum(mpoy1ome  fvtl(fartmx pou0oeeo o3tas m eaump u0 rxoxfciodom rai o;t)trxoio3iudapt  nesls  rta(rpou4alto oeiad mDraumsn(4alermrciatfp ean ols0truoir iy4lpeemiei ()aDumx o;u4opto i3tas s2rlums u)aetrxfctydfa rlnvo;s t2uo(opoo1lpenmietlt  rtaxrpnt0aeeomietatfa emumont) lerxr oodlmD an olt)trumio iu1al emics () 2urxroot4aleo f3tasfm2uanvp;t)texnmociydfa e i i s)t2xmio3oy1op e nesl() 2rr(rp;u0oee ioetlt m2eanvp u4aexnxr3ootfpDranvo;(  rumir3nu1lpenlnetas) rurxrp;t1oeen fetys s uln ont)alenmfcoo1fateai s t)srtm(rpou4ale  ncsat)a2rmx  nu1oleomoeiyd s rl(vp (4 eermr3iatopD ln s (  2trxm iydlm  lnvsl(f 2raxrp;o1oeenmieiysfa2umu p t) eeomr3tytlpt aiei;()texmxr oo4lp nlivs s)srurx p;u4oexomietltlm2ra( pn(4areoircoatfmtranes ( s2uoirpiu1ale  fetlsfsrrrxmpno0oet  ociatfs ra(msnt)texrxociy1lptelnvs;t0t2xmxm3ou4apeemncias a2tru  nt0tptomieiasla ra(vp;t0 lxnifcoodom  lnvols0srurimpou1ol nmnciat)aDtr(mpoo4apxo o3iadlaDeanvo;t0tltnirciatlateai s t0 etmxm3nudlmt livsl(faDtaxrp;o4texoiiciaslm rlumpnu0 eeoxo iatlaD  n i s)seuoiopoydope  ncilt  2rm(  ;u4oeeniieildfm rau snu4 ltrio io1fptr neslt0t2trxr oy4lpenmfetat)srum( ooo0opxniociatls em( o;t4arxnio oatfp e nes;t0trxmxmpny1lpe liet () 2tmx p;o1oetn f3iad a el( pnt0 lxnmo oatfpt  ivs t) 2trimpnu4omt mnesat aruaumono0ale  o3tadfsDean on(0texrxf3iydlateanvs t0 eurimpoo4amtn net (f rua(r ;u4tlxniieiasfs2ea(msnt0teermo oa1opte nes (  exmim3iy4lltnmnetl(  Dur( pnu1alt  oeild m2el(vont)trxnxo tadlmDr ieil(0s2toim oo1lpe  ies t) rumx  ot1tlx  f3tas s umnms;()trtnmf iatoptelivi;t)s2toxr oudoptnlietl(f rta(m ou0oet micilslaDrmn p ()tlxrxr iytfpDeln s;(0teumxo io1ale mneslt  Draum nu1olt mietysla eaump;(4 ltomf tydlpDr n slt)sexm(r oy1olt mfciat) 2ua(  ;t4teeoiiciasfmDelnvs u)tetoxocoodlaDeau i s sexoio3nodopeelnvsltfarra(mpou4oee  feiysla rl( s (4aeermf3oodop  lnvslt)s2xrxr3no1ape lfctas s2rrxmoou4oee mociadlsDulu snu)tltoxr3ta1faD an s;( trtm(opoy1ap   feiat)sDtmump;u0olx  fctys m2rlu snt4 lermo oodlaD  ies (0s2uoim3iu1ale  feslsfsrrmur ;t4oexn ociyd mDrluvs u0altrxr oodfaD livs;s0s2uoim oodol emnvt ()a2ur(m ;o0opxnmi3iyt aDuaump u4 exrxf3tadom  lueo;(0sexr(rpny4al  lnvsltf Dtmxrpoo4oeto fciaslm2el(vs (4tleoxociatop elues;t0srtrxo3oo1amt  fei (f Dtmu  nu0alt mo3tysfa rmu o;u) etoxo3tadfatelnvil(0 2trim ou1lm  mfct t)aDraxroou4oeenii3iat sDemu pn(4trenxf3oy1lp  lneo;s0teumio iy4lptnmnct () rrmxmo;o0apxnmietadlaDraumont)aetomo iydfm  lieils0srumio3oudapeemicslsf rtax  ;t0tptomictltfa2rmu p t0artnir oatlpD lnvol( trxmimpou4om  mfvta(f Dtrx  ot1aex moctatfa emu pn(0alxrxf iatfa   nvs () rxmio3iy4altnlneia( aDuau  oo0tlxn iciat m2elu s u4alxnif3oo1lm   i s;s)seto(r oo4lme micsa(  Dtru  ;t0tlt  icilt mDumumo;t0 etnxr3tatla rlieo s srxoio3oydlp  lies () rraurono0oexomoeiydfmDrm(vp;t0tltoxfctatfm   uvslt0 etmxm3iudolt mncsat  2tm( p;u1olt  ociad sDua( onu)arxrxr tydop   u s s0 2urirpno4ome mneia(faDtrxrpot0opxnmf3iad m2emnvsnu)trtrif iytlpD au o s)srtoir ny1amenlfei t  rumu o;u0oetoifctatlm umnvo;u4aeerio3tatopDrlnvo;()trtrirpiu1lm   feilt  2uru o;u4aptnmo3tlsla2uan p;u0alermo ta1lmD anvs s t2tmxo3oy1am  lnctas  2tm(rono0olxomoetytla2rmu s u4 etoxo oatlmt lieslt) rtmxr3oo1llt  fetl( srtrxro;u1alxo o3ilsfmDrm(mp;(0 renxo3iydlmt lnes;t t2to(o3io1olen nvils)arururono4alx ifeiytfsDra( ont4alenirciytfmD  uvilt sexrir nudaptn nci t arumu p;o4oet ifeiadlm2emnvsnt4aleoxrcoatfmteai sls t2uo(r3nydamtn nvs tfa2rru pnt1apt miciltfsDem(vo (4 rxoiocoodlp r uei s) euriopoy1lmtnmnes s)srurum nu4tpe mf3ils sDulump;t0 lenmrciydla  lueo;( seuoxmpoo1am   iesas) Dtr(moou1olt if3iasls2ea(msn(4 eermo3ty1lptraivi t0 ruoir oy4lmeemncslsfarur(m ;u1tlto ietys aDranmp (0 rxnxf iotlm eau sls  exmxr3no4olt mics ( a2uaurono4olxnmi3ilslm2ua( s (4teenmr oodomte iesls)trto(o3ou4apt lictl(f rrmum ;t0tetnioeiat mDulumsn()altnmfcootfaDraueols)t2xm(rpou4amte fvs t)aDurx  ;t4apxn i3iad a rmnmo t)trxnifctadlp e nvsl(0setrio3oo1apenlfvi t)s2ta(ro;u1tpx  octlsls2emuvp u)alxoio3iytfpD  uvs s)trxmirpiodalt  icil( artru pou4opt iicils m2eluvsnt4teenxo3iodlm  lu sls)trxrimpiodam nmnvsas)aDrrxro;o0ale mf3ilsla emn o;u0texrif3iytfaD  u i t  2toxm3ny1omtn fvtasfaDurxm nu4tpxnmiciyslm rau pnt0tleoxr ia1fp e nvols0 2trirpoo4lm emnvia( srrrx pno0olenifcilsfs2el( p (4tltoio todlptrlnvo;t0t2xr(r3iudolee iet t  rrmxmpou0oetomiciadfa rmnms;u4 rtrmo iatlmt lieolt0srur(o ou4amee ictltf rtm(mo;t1ope  feiysla2ulnvpnu)trtoxo3oatomtrlnvi ()s2umir3iy4optemivi ( s2umxmo;t1apxnioctad m2rl( s t)arenxf3iotfpDran s;s0trxr(o3io1alenmfvsat) 2tmu  ot1tptomi3iatlmDel( s;u4 exnxr oydoa r neols)t2xo(r iodomtnlfvsas  rrmu  nu0apt  iciys sDeln s;t)arenir iydomtrauvs t0 rxrim3iu1am e nes ()artmxrpnu0aleo fetytls ranvp (4 lxoio3iytomD aivsls) rxo(r3iodol nlfct s aDuaxrpoo1openmfeiaslm eau o t)tlenio3ta1lm elies s0 exoirpiudape livils s2rax p;u1aeeoifetas a2rluvo;u)trxnmf tytfp r u o;()srtrim oodalt mfcsltf Dumx  ;t1oee  fctltls ra(ms;u0aleomrciotfa   ueolt  2xo(m nydlmenlieilt)arurum no4aex mieiad s umnvo u0aexnxf3oy1lmt  ivi t) ruo(m3oydomee net t) 2ua(m ;u0tet iiciytfsDem(vonu4 etrio tydla rlueolt0s2tmim oo1lp elfvsltf 2rruro;o0texo oeiytlsDeanvsnu0artrmr3oytfpD aneolt) etoxopny4llee fesatfaDra( ooo4alto fetls s2ulnmo t4 eenmr ta1fa rlueo s s2uo(o3ny4apt liei sfs2tm( pot1oet mfeiasls el(vs;t)arxrio oa1latrlivi;s s2um(o oo1lmteliet t arrrxmont4texniociadlm rlu pn(0 rtrifcoodfpD lnes;() rtrxm3oo1opt lnes sfaDumx  ;o0alxoio3iadla rl(mo u0trtoxf3io1oa e n i s0t2ur(opoydame  netlt) Drrxm ot4tlxnmfctyslm2umuvon(0texrio3tydomtrlies s0seumiopnu1ol e icslt  Drmu pou0openmi3iadls2raumo;u0 lermr3oadla  ai sl()s2xrxrpoodale  nesatfartaxm ;u0aptnio3iyslaDel(vo ()trtriociydoatrlu o t0 ruoiopiy4opt micslt sDrr(roou0optnmi3iadfmDumuvpnu)arerir3oatlpDrlnei t) etm(opnu4lp emncsasfsDra(mpnt4aee mf3ilsfm umn p (0 ltoxr io1oaDr uvol(0setr(r3oo4lmtelfet s)a2ua(r nt4apxoifeias a2eluvo (0texoir3iy1omD  nes t0 eurir ny4altn iei ( aDtaxm nt0opxomo3tldfm2ua( p u) etnmr3tatfmtran s t t2toio oydlm n icsltf Duaum ou1ape  i3tldlsDeau o (4aetnxfctotop eaueo;t)seuo(opiodaptnlnvsas sDurxmooo4oltoii3ild a uanmsnt0aexrmocoo1lmDeanes;s0 ruoxr ny1lptn iesat)a2taxrp;u0aexomiciytfs elu p () ltomociatoa ran i;t0texmxr oo1lm nmfct t sruru  nu0teeomfeiys a2rlumo;(4aexnxrctotlmt  u s;s0t2ur(mpnu1alenlivi sfartr(  ;t1tlto feiytfa2eaums;u0tlerxf ootopDe ieil() etrir3ou4ame  ivilt a2rm( oot0aptomictatfmDumuvs t4tetnxf oatfa rln s;t0srtoxm iydam n ivil(faruau pot1aeto feildls ulnmp;u0altrmfciatop rau o t)s2xmirpno1oltelictat) 2ua(r oo1oeeomfetlt aDranmp;u0texnif3todla eaies s) 2xoimpnydlmenlfcslt artru pot1aexnmoeiltla el(mo ()trtrxr iadlptr iei t  rur(o3oo4apenlnvsas s2umx  nt1aee miciyd m2umuvp;()aexnif oytfa rauvs;s  2umir ny4omt mfetasfaDtmx  no1apx  f3tlsfaDeanms;(0 etrxo oatlm  ln ols setmxmpnydlpeelnvtltfsrta( ooo0apeo fetasfm rl(ms;t)tetoif3oadopDe nvs (0t2uriopnu4opt  fvsa(faDrmum oo0ole iieiysls2rlu pnt0texrxrctatlmDraieolt0tetmimpnu4amt lnct tf Duaur ;t0apxo o3tys a ua( s (4artnxfctadom ranvols s2xrimpiodaltemiet t a2tau pnt4tpx moeiyd sDumu snu4altrxfcoy1faDelu i;( s2um(o iudolte iei t)srtaumpoo4tpen fciat a2ul(vp t0tetomf3to1lpteli s s  rumxr3nu4lm nmictls aDur( p;t1aetniiciasfm elu o;t) eeoxf totomtr nes s0srtmio oy1omtnlfcilt)sDtmurp;t4oexnmoctas sDulumpnt)aeenxr3iodomt au i s0s2tr(rpiodal e ietatf Draxmpnt4oeeomfeiad mDrln pn()altoif3tatlp eluei;(0 rtr(m iodoptn ivsl( aDtauro;o4aetn f3iat sDuanvp t)texomfcoy1fatr iesl( s2xmim3iy4altnmfvs t) 2urxr nu0alxn iciysfmDulu pnu)alxnif3iydlp rlu i (0setm(opny1oltelfet tf ruaxm nu0aptn fetat m umn p;(4tlxomo ty1lp   ies;t0 2toiopnydol   nctl() Dtmxr oo4ape  oeildfsDemums;t4 exnxo3ty1fmtrlivo s srxrxrpnu1am n nes tf ruax pno4tltnii3tlsla2um(vs (4 rxnio io1lat  nvi;() 2xm(mpio4lpe lfci s  2urur nt0tet if3tadla2ulnvsn(4 rtomrciy1fmD  uvi;t0texmxopio1op nmnci t)arumum ot0optnifetls sDranvsnu4tltomr iodfaD aues;t)t2tr(m iu4opt lfcil(fsDrru pnu4tlen feiyslmDulu pn(0arenxfctydomD  neil(0 2toxmpiudomtemneia() rua(mpou1aeeomfctyslm2rau s;u0 lxrmr todoa r ivslt0 rtmxr nudopte ncsat arrmur ;u0tpeomoctyd sDrluvp t0aeermf iadoa   n i s  exrxopno4lpe  fct tfarrruront1alxnmoeiaslm2eaums (4 lxnir3iotfmt aivo ()s2uoirpou4ol e ics s sruaump;t1tet mictadfa emumsnt0 ltoif3tydlpDelneils0s2tr(opiy1ape mncsl( arur(  ou4tpt  fctlslsDrl( on()trenxo iydlmDeau i;s t2umio3ou4am   iei sf 2ur(root4aptnio3tltls2ra(ms;t) rtoxr3iydfmteaivolt0 rtoxr nu1amee fvs tf 2trumpno4aetn o3iysfm ulu pnt0 etoio3io1fpD  ivs;(0teumxopio1alenlfcslt)arrrur ;o4oeto ictyt aDeanmpnu0 lxoif iadla  li o t) exrio iudop nmnctat s2tm(r oo4teenii3iatfs2ea( p;u)trtoif3iotlp rln i;t)truoimpiodol e fciltfaDtru  ;t1oex miciydfsDulnmon(4 rtrxoctytomt auvo ()tetr(m iudamtnmfes sf 2ua(rooo0tltoifctytfa2uanvp;(4aexomr3tatoat  nvo t seumim no1lmtemncil(fsrumurpou1aeeniiciat a ra(vp;u4 renmf3iytlmtrau ils0s2uoxo oudlp nmncs t)artr(mpot0oexoifciydfm2eanvs (0tetoirctydfa   u s (0setrim3iy1optnmivtls sDtaxmpou4olxnmictyd m uln s;(0artoxf3iy1fpDeaieslt0t2tmio3iu4om n nviat)a2ta(mo;u4oetnifeiatlm2emnvs u4 lenmr iadfm r ivols0sexoxm3io4lmtnmnetlt)s2tmu pno0texn ictls s em(vpnu) lxnirciotom e ieil(0t2umxm3oydlp  lfct ( arrruro;t4tle mieiyslsDrlu o;(0areomf tydfmDeliesls0trtrimpiy4lptelfvt ()aDrru  ou0tex  ocilsfs rmnms t4aetnxfctadfmD  u sl(0 rtrim3iydlm e ivsa(fa2rrxront1oetomfciatlaDrm( pnt4trtnxoctotlptrluvsls setm(opio4olenliei t  Drrx  ;t0tpt  ictydfm2rl( o t4areniociotlaDe nvol() etm(m nodlme  icias)sDrrum ;u1tlxoio3tltlm2eanmo;(0trtoxo3oa1fpt luei;( s2toxo3io4ale  ieia(fsDuaxr no4aeto fcias s el(vonu4texomr3totfpte uvilt  2uo(m oudoltnmncils) rrm(mo;u1oetnif3ildfa2um( o;(4arxnifcoadomtr nvs;t)srurio iu1ol e ivsatf 2ta( p;o1tetniieiasfs2ul(vpnu0tleoio oodfp   i s;t)truoxr3nodolt mnctlt srur(  oo4apx ioeiyd m elnvo u0aetoif oatfp elivo ()s2xmxo3iy1omtnlfetlt)aruru poo1oexn fctltfmDelump;u4tetrif3totopD  i o () exm(m nydolt  iei () 2trxr ot0tltn i3tydlsDemu o (0aexoxrctadlptrlu s;s0 rtmxm oydlm emietlt artaump;u4apeoiieias s elu pnu0 lxnxr3oadfmtr ivo;( sruoxopnu4olt livsatf Dta(r nu1olenmfeiad s ua( p t0 reoircia1lmDelivo;(0seuoxmpoodlp elivils)aDururooo0aetomi3ilt mDeau o;(0 reomfciotfaDean s;s)tetrio3nu4ope  nct tfartrur nu4aetomfeild sDua( snt0trtoir3oodlm  lnes;t0s2tmio iy1opte fetat) Dumum ot0oltn ieiltlm2ea(mp;u) leomrciotfpD  nvolt  exo(r3oudaltelicslt  2rm(r ;t1oexo fetldla2uau o u0trxoxfctydfptelnvsl(0s2ur(m nodaltelnvil()sDtmu p;t1tlt  octlsfsDuln o;t0altomo3ty1fpDelneslt)s2ur(opiu4llenlnes ()sDtrxm ot0apxnmoctadfm2emn o (4 ltrif ootfpt aueo;s) rtrxo3iydalt mnvsat) 2rrurpnt4texnio3tlsfs2el(ms;(4aexnirciodoaDrli ilt seuoxm iudll elicsls)srtrxrpou0tpenmociltfa2rauvp u0trtrmr3iadlaDrlivs t) eumxr3iu4llt mfetatf rua( onu1tltomi3tadfa rm(vpn(0texrmf iadlatr nvo s0seuoxrpny1opte fvtas  2rmumo;u4alt  fctltfm2rlnvsn(0teeoxfctytomDr uvs;() rtmxr3oydop nlfcsl()sDua(mp;t1altnmieilsfs eau pn()arxrmfcoo1omDe nes;s)t2xr(o3nudolenlietls s2tmur ;t0tpx  o3iys a2um( ont) eerir3oy1opt  ueslt0s2ur(m3nudolenmncilsf 2ta(mpot1opx  f3iytfs eanvo u) ltomr3oytoaDraivs;( texm(m3oy4omt micsls  2tm(r oo0olt  o3tyd m2emnmpnt4 lxoio3totfat auvi t)srxm(r3nu1alt  netatfaDtax  ou4teen ietys s eluvs;t0 rxnxr3iydlm r nvo;s0 eum(m3nodoptemncsat aDrmxmpnu0tle mociasfs ra(mpnu0tetnif iodomDean ils)t2to(rpnu1oltnlncsat a2tmxrpou1tleomictatla rlu p;u) ltoir tatfp e ies;( srtr(o io4lpeelies s) rtr(ro;t1optoifctasla2rmnmsn(0trtrif iatom eau o s0 etmimpiu1ole lnvtlt)a2ta( p;o4tpt  f3tysfa2rlumont0aetoxo3totop e nvi;s) rurxr3iu1ap nlnei sf rtr(rpoo1tetnioctydfa2eauvo;(4 rerxo iytoaDe ivi (  etmio ou1op e iciatfsrra( ooo1aee iociad s2ua(mpnt0 lxomo oo1oat  ueo t)teumim3oydal e netls a2rmumpoo1oee mo3iydls2rlnmon(0alerxf3oydlmD aueo;s tetrxr3nudope  nvsa()aDtru o;t0teeoifctltla rl(vp;t4altomr oatfpD  i sls srurxo3nydole  iesl(f 2ur(  no1apt  ietyt m2uanvp;u0tlxoxo oadfmD lu olt  exrirpio1ole lfeia()aDurxmpnu0tet  i3tyd aDelnmo u4teenxo3io1omD aies t t2xmir3nudal nlfciat)s2uru pou1oeen octatfm2emu s;()trenxfctydfpDraneolt) rxrim ny4ll nlfes tfarraurpnu4aex mfcils m ra(vo () rxrio3tytomteluvils0setm(rpou1ape licslt)a2ur(r nt0apxnio3ias a2uau pn(0tlenio3ta1lp  lu s ()t2xrxrpiydap nlnvsl() 2rrumpou4tlen iciaslmDua( s;t0trtrmo iy1lmt ln o;s)texoxm oy1om  lies ( artauroou0tlxnioeiydfs uauvonu)tleniociydop eai s ( texo(r3iydll nmfvi s)s2trx ono0alxo o3iadlmDrm(mp;(4 eeoiocoydoa r i i;t)sruoim3ou1lptemivsls  rum(  ;u4aleoii3ildla2eauvp;(4 rtnxo tatfmDranvo (0t2tr(mpnu4lmtelicilt) 2rm( poo4opeomoeiltfs umump;u4 rtrxo3to1lpt  neols  rxoxo3nudlm nmicsltfsDrru  ;t4tetoifeiatfsDumumon(4tlxnxf3ootlmDr ieo ( s2urir oo4omtnlictat  2rrx poo1oeeomf3iad a2elums ()trerxo3oatfp eauvo s0seto(m3iy4ole livil() rta(rpou0opto feiytfm2uanms u0 ltnxf3iy1om rluvi;t0seumxm3iu1lpt livsas  2taurpnt4opto fcils m2rln ont0 ltrmr oatfmDr uvsls)s2tr(m3iu4opeemivsltf Drr(  ;t1aeenifcils mDumnvp () rtrmf3tydlm eliei;(0 rxriopoo1amtnmfetatfsDtau ont1opxoii3ias a um(vont)alxrxr iadfptrauvs;(0trurxo3iudalt  fvils  Durxm ;o1alx mfcildlsDeaump (0tlxoxfcty1lm eau o;( teuo(rpiy1am   nvsat)aDtm(m nt4tee mfeild m2rluvo;u0treoif oydlateln o s teto(mpnu1ll elivtat  Dtmxro;o1tleo fciaslaDuln s;()tlxoxo3iy1oaD lies s)trtoio oo1lp n feta( a2tr(  ot4apt mfetys m2rmnvp;t)trxnirciatlm r ivilt0 2umxo3nu1amen n
\ No newline at end of file
@@ -0,0 +1 @@
+neo;t s2uoxrpnu1lme mfvs t a2rrxr ;t4opeoiiciydlmDel(vp;t4tetrxociytfatrai i;s0trto(m nudamenmfetasfsrumxrpot0apx  o3iasfm2umumo;t0 leoiocoo1op e i o;( srur(o nydom e nctl()a2taur nu0aexnmietlt s2ra( onu0altnmfcoytomtelnei s setoirpnudomtelivsasfsDrru  ;t1alenifciasfm emnmon(4altrxf oatla  aueilt0 rto(m iydlle  fctl(farrrx pnu4aptoioctltlsDumumsn(0 ltnir io1oaD  ieil(0 rtmxm3nu1lp e icil()srrr(root0aexomfctysls uan p;t)tlxoxr tadfpDe u i s0trurio3oydapee ics (f 2trum oo4openmietlsfaDeau o;()aexrxfcoatlmDe uvs;s)teto(o3oodap   icsl(  2rm(m nu4oee io3iltlm elums (0alxrio3tytoate neo (  2xr(opou4ole mnesa(farum( p;t4aleomi3tadfs2rl(vsnu0 exrir3iotlmDr i sls0trxmxrpou1openmfetlt  rrrum ot4tpt  f3iad a ua( snt) lenxo ia1oatelueo ( srtmxopiu4alte fci t)a2rrx ono1tpt mfciysls2umuvs;t) reomo3to1late uvsl( seurirpnu4lpee nvi tfaDtm(rooo0aexn fcildla2ra(mo t4 etnxf3iatfmDr ueo;s  ruoiopnodopeelnesl(f Drrxrpou4oexn f3ias mDrl(vpnu) exoxfciydomteaivi;s)s2uoir nudoltemnctls  2ururpou1tpxnioctasfa2ua(vs t4 leoio3tydlm  li s s0 rtr(o nodomen ivsa()sDururp;t1tex  fciyt m2rau o u4 leoxociotlaD  nvolt seuoir3nu1om elnciltfa2rmu o;u0olxn feildlm el( snt0aexnxr iadfpDeaueils0 rtmxrpnodlp emnet t)a2ur(ro;u1aptomo3tldfa emnvont4 rerir3tatlmDelivo ()texmim io1lpte fcsat a2uru  no0olx mictatlmDul(ms t)aleniocoydlatr neil(0tetm(o3iy1altn feias)arrr(m ;t4alen octydfs rl(vs ()aexnxf iodfpDr u o;(0srtr(m no1lpt mfcsls aDtmxmo;u4oeto f3iydls2ulnvsnt)trxnmocoo1lmteauei t)srumim iudlm   fctltfsrta(monu1altoiictysfaDumn s;t)tleoircta1lp rlu il(  2urxrpiu4ll emneilsf Dtrxr ;u4alt mfciysfmDem(mpnt)trxoxf3ty1oa   n i;(  rtr(o3oo1om  mfvslt)aDuau pnu1apx mfeiyt a uluvs;(4texrmf iotla e n sl()s2tr(r3iy1al nmnvtas) 2tm(rp;t4oexnif3iydlm2ea( snt4tetrifcoatlpteaueilt srxm(m3iudlm  lnesat  2taumpoo0opx mo3tltfm ea(ms t4 eeoxr3oydom r ivils)s2xoxopoydomtn nes ()artmum ;o1olx ifciatfm el(von(0alerio ta1omteluvo;s)trtmiopny4lptn ivs s) rurum ot0ape mo3tasla2eau sn() ltoir totla raivslt0trtrir ou1ap nmncs ( arum(mono0aex ifetys a el(vp t0tltrxo iotoa eanesls  etr(o iu1lm n fviatf rur(moot0aptomoeilt m2el(ms t4aetnmfctydfmDrau o s0seurim oo4lmen ncs () rtrxrpot0tpen o3tls sDea( p;t4 eeomo3ootfaD aieo;t  2umxr oudlltnlncia(f Duru onu4oexomf3tltfsDel( p;t0aeenxo ootlptr i o (0texoxopiudol n ncsa( sDua( ooo4olt if3iytlsDua(vpnt4altnmf3tytfmt luei ()trxoiopno1omtn ivia( aDumu pot1oleoifctasfa uanvpnt4trxnmf oy1latr i s s0srur(o3nudameelivi sf Dta(m ot4apen ieiytlm rauvp t0trtoifciotomDelnvsls  rtm(o iu4opt lfvias) rtm(mpno4tpxn f3ilt m2umnmpnt) etrxr3ty1lat  ueo;() rurxo iu4lpenlivs s)srtm(rp;u0apen octlt a2umu o t0tltrmo iydfptraiei;t) etrxr oodamtnmieiat  rrrxrpou0olx  i3tat a ran o;u0alxrmo oatoaDe i i (0texmim3nodlp emfctltfaDta(rpot0tpeoio3tlslsDea(ms (4tltoir ty1op   u i;() 2trxo iu4amtnmfcta() Dtm(rpnt0aee ifeiadfsDel(vp;t0 etrio iodfaD lueol( tetmxm3oy4om  lfctltfsDum(r ;o1tleo o3iysfs ean o;(4aexomrcoa1fmDrln o;()sexm(opoydaleemnvtl(fa2tmxmoou4tltoif3ilslmDeau p;()aexomfctatopDelneslt)t2tr(m3iudopt  ncs tfa2trurono0texnmoeild m rm(msnu0aeenmf oa1opte n s;s)trumim3ny1lp emnei sf 2ra( ont0aet iicilsla2ulnmonu)trxrmf iatfatrluei;s)sexr(o nu4lmtemivtlt) rrrurooo1aeen f3tadlsDemums;u)aexnmo3iadfptr u s t)trtrxrpny1om nmncta( a2ta(roou0aex mfciyslsDelnmpn() lxrmo3iadlpte ivo;s  2xmxm no4am  mfvilsfs2raxmp;o0tltomoeiat aDemumpnu0artrmo3iadfmDe nvs (0 2umim3oudap emfvslt srtau  nu0tlxn ietydfm2uaumo;(0tetoxf oodfa rli i;( s2urxo oydap nlfes sfa2trx  ;u1aee  i3ild s2el(vs;u)tlerir3tatom elnvs;( truoxrpnu4ale  fes t s2ra(moou0aetnifeilsfs umn s (0aexniocoo1lmt  ueo s)s2urirpnu4llt mics ( a2ta( poo4tlxn oeiad aDumu o (0 etrmf3oy1fpDeaueolt0t2toxr oo1omenmnvsl(fsDtrurpoo4tltoioctysls eln s;()teenmfciydfatelnvs;()s2tmxopny1op nmfcta(fsrrrxrpoo1optnmiciasfm uanmpnu) ltomo ta1fm elueslt) rumir3nu4om nlnci ( a2rm(rp;u1apt  oeiaslsDelu p (4aleoxr oa1la ranvils0s2xrirpno1amtnlfviltfsDtau ono4ape if3iatla emnmpn(4tlenio iadomD lu ils s2urxr iu1lmeelfvt (fsruaum ;o0tlx ioetasfaDulums;t4 etoxrciytlpDe ueilt  rur(o oodolen fcsl(faDuau pno0aex  o3iyd m2uaums u4 eermfcta1lmDrli s;( s2toxmpoydope mneiasfsDtmuroot1tetoiiciltfs ulnmont4trxoxfcoodomte u olt0trurxm3no1llt mfet s srum( pot0aet  ieiys sDuaump u0artrxrctadfaD au o s seuo(m oy1omenmfvi (f Dtm(r ;t4texomoctasfs ra(vo;()artnmfciotopDr iei t  rxoxopoy4lptn ies (  2ur( p;o4tltoifetysfs ua(vp;u4 ltnxf iy1lmteai sls)seuo(rpoodopen iet t  Drmurpnu0opt  fciyslm rmu s;t0 lxoxfcoatoa r uei;s t2tr(r3nu1lp emfcil(  rra(root1tee miciaslmDulu s u0 renmf ia1oaD aivo s)t2xm(m3iydllenlnctls)a2umx o;u4ale mfcildfa2ranmp;(4altnmo oa1lpt aivi s t2trxo io4al  lnetls a2rr( o;t4aeen feiydfs eau o () rerir3oy1oat aivi;()srtrxo3oo4al e iei s)aDrmur ot0oexoioetydlsDrm( s t4trtomociadlatelu i;s0srto(r ny1omen iesl(f 2ua( pnu1tetnif3tld sDeau ont4alxrmoctydoateli i s)s2xo(r3nudopeemfvs ( s2tr(  ou1olxnmoeiatfsDua( ont0altnmo3iytlmD lieo;( s2uoiopny1omt lnvt t a2raurpot0opxo i3iydfa2rlumont0 etrir3iydlpDeau o s seuo(m io1amtnmneslt)aDraxrpnu4tpt  ictasfm2rl(vo u4aeeoircootla rlneo t)texo(mpno1apee ict s  Dum(rooo1openiictldlaDrluvs;(0 leoiociadop elnei ()trxrxr oy4aleemncs sf 2rrx ont1tlt miciatlmDrmnvonu4tltoxo3oatoa r ivi (  2xrim iydapenmfctlt  2uaump;u1aexoif3iys s2ranvpn(0tltoio ia1oaDraueo (0trur(r3io4omtnmfct (  Dtaxm oo4oltomocildlaDemnvs u)artrmfcoy1lp elneol( srtoimpny1lmee nes (fa2umum nu4aetnioeiysfm2rmnvp t4tlenir oodop   nes;s  eur(o3nudlptn ncils  rraum no1tpeoif3ias s2eau sn()tlermr tatlpt aueolt0 rur(m nudoleelicsl(f rtrurpnt1tpxomi3iat m2ra( o;u)altrxf3ta1la r ueo;t) 2uo(r iy1ol  mfcias) Dra(moou4optnmoeiatlmDemn pnu4 etnmoctadoat livs ( s2xm(opiydamtnlnvs t)srurxm ot0alx ifciadfa ea(mpnu) ltnmoctydom e u ilt0srumir3oudopt micsl(f 2ra( pot1apen fcias mDuan s;t) rxoxfcto1fmtrlivs;( sruoxr oy4aptn icias) Drmxroou0optnmieilsfs2uaumsnu0aexomo iodfp  lieo (0 2xoxm3iu4op nlfvt s) Drrxmpnt0ole ifeiad s rmuvsnt)arxnifcoytfp   u o t)texr(r3oy1lp elivtltfaDuaur ;u0teenif3ilt m2rm(vs ()arxrmociotfmtrlies;t)srxoxo ny4ol nmneia(fa2uax  ;u1alt  f3iys m eaumo u4tlxoif3ootoa e i s;s0s2uriopnudomt mfeslt)srur( pnt4alxnifcias aDul(mo (4 ltrir3iotoa r nvs s t2xrir3iodlp  mfct s a2tru onu1alenioeiyd mDumn s (4tlenmoctatfp eli i;()seuo(r3iudlleelietlt)aDra( o;o1openifctatls rmnms u)tlxomf3to1la elnvs t)sexm(m3nodlp nlfeil(  rtr(rpnt4tee moetatlaDrmn ont)texnirciotoa rlies;s0s2urio3oo1lm nmnct ( a2umumpnt4olt ifciadlm uan p;u4 leomf oodlaDe u i;s sruo(mpny4alte nci tfs2tax p;u0tlx mfeiadfa2ea( snu0 etomo3totopDr ivi;(0s2urio iy1ol elieil(f rtmuroot4ape  fciyd s2umuvo;(4aeerir3oadla   nvo;()trtmiopiu1lmt lfctatfarum(r no4oexoio3iyd aDeanvp;()tetrxf oo1om r ivo ()srtoio3iy1lptnlncta()s2um(m ;o4tleo ictld s rau o;t)texrifctytomD  ueols)setrir iodapen nvsl( a2taurp;o1tltn ociytlaDrlu on(4aexoir3tydfmDran s s0t2xoiopnydopee nct t srtrxmonu4open feiatfm2emnmp;u0 lenxf io1lpt luvi s0 2xr(mpiy4amt mfeilt)srta( poo4ope  fciydfaDea(mp t0alenio io1faD aueols)sexoim3iy1lltnmfei ()srtmu  no4oetniieiad aDua(vp (0 ltoxo3oy1oat  uei s  etoxo iudomte nesls sruau  ot4alxnmf3tyd sDrl(vo (0aetnmo3iotfp  lu s;( srurir3iudapteliei sfsrta(m nt0aptnif3tyd a2uanmsn() ltnxoctodomD ln ils)setmiopoy4llt lfciat) Dtmx  nt1tlxoio3tldfa2rln s;u4texoifciytfm eau i;() eumxo3no4lmenlfvslt)a2urxro;o4opxnii3iasls2umnvpn()tetrmf ty1oaDrlnei () rtm(r nu4ame mnviat)a2ta(monu0oee moeiasfa2um( o t0trenmo3iatoaDe i s;t0trtmxrpoy4lm emivt (fa2ra(mpoo1apen i3iyd aDrlu p;t4aetnxocoatlp  lueo s)sexmir iodom nlicsat) rrr(  ou1teeoii3tadls rauvs t0 lxoircoatlaDr nvi s t2tm(m3nodome mfvias) 2uaxmono4ape ii3iltfmDrlu s;(0trxnxo3iodlptrliei t)t2xmxrpoy4apt lneslsfsDuax p;o4oleomoeilt mDrln onu4tleoir3tatlpteaivo s) rurio ou4lm nmnvsat)s2urum ot0oeen oetadla2raumo;u4trxnir oa1fpDelnesl(0trtr(opiodal e nvs ()sDtaump;o4teenmoctlslsDrln o;t)alxnircoadoaDrli sl() exoirpny1lltnlfvi s) rurumoou0aexoio3iasfs uaump;u)texnircootfat livo;s setr(o nu4lm elieilsf 2rru pno0altnio3tatla2eauvs (0trerircoa1fptrlnvs ()t2umxm io4openmicsls)sDtaxm ;t0tpeomfetlt s2eln s ()aeeoio3oadoa rai ils)srur(r oydam nmivta(  2umumo;u0oee iieilsfmDeanvo t)arxnir3iadlaDeai s ()s2uoxmpnu1omtemfvsatf Dtru poo1tpe moctadlm2elnvp;t4 rerir3oy1opte nei s  2xrxo3iu4lpe lfvilt) ruau o;t4oee mietldlm em(ms;u)trtrif oytlp   ueils)trtmim ny4om  mfesat s2rrumo;u4aeen ocilsla el( p;u0alxrmo to1lm   uesl() eumiopou1ole  ivi s)sDurumo;t1opx if3iadfmDemu s;t4tlxnxfciodfaDeln o;t) etmirpiy4lp nmfcsls  rraxro;o4apxomieiad aDel(ms;u4aetnxrciatlpDr nvils  etrxrpnu1al n nvtl(f rum(m nu4optoiieildla el(mp;() rtnif oy1oa   i o s s2xmxm3nydalt  fvil( s2urumoou4apt mf3ias m uaums;u0tltnmf ia1lmte n ol()trtmxmpou4opt lfct () 2tmumo;t0oee moetls sDul( onu4trxomfcoadlpteai sls) rtoxm3io1lp  lfcsl()aDuau o;u4tlto ietadfa2uln p;()alxnxf oo1lmDean ols0texrio3oy4alee feiatfsrtru ono0oee mieiasfaDulnvp (0trenxo ty1fpteln i;t)trxoxrpiodapeelnvi s artaur oo1tex iociadla emump ()aetrio3oy1fp   i s t)srtmxm iudlmenlfci tf Dtm(  ou0olxo ieildfsDea(mpnu0artnmr iodlptrluvs;(0srxrxrpoo1amenmivt ()s2trurpou1oet iicias aDelu p;u0treomrcootfmteauvo ( srtm(opnu1aptnmivtls aDtm(mp;u0tet moetydlmDelumpnu0trxnmo oo1lm elies t)trumir iodap emici s arrax o;o0olxnifetaslm2eln p u)alxrmr3oo1fp eanvs (0trtm(o3iydlmt lnvsas)sDra(m ot4olto f3tltls ulu s;t0altrxo3totfptrau i;s) rxm(opnu4am e fcil( a2tr(  ot1opto i3iadfa2em( o;u) ltnirctadlm e ivo;(0trum(mpou1apt mfvia()aDum(  nt4apxnioeiysfm uanvpnt)alxrifciy1lmtraivils)t2uo(r nudamee ncils)s2rr(mpot0tetomo3tltlm2rm(mpnu4texrir3iydlmtean i;(0sexrxo3iodlme mnctl(fartr(mpno1tlt mfctytfa2eanvp;(4 ltoirciodfa  li i ()setr(mpiodop emieslsfs2tmx  ;o4tlxoiicildfa2rmump u0texomf3iadfp rln olt setmxm iy4alen ieilsfa2uaxro;t0oee ioetytla2em(vp;(4aeeomociytfaD lu o;s)trtoxm oo1ap e netlsfs2rm(r ou1opx mi3tyd mDumuvo;t)artniociodfpDelnes t texrxr no4omte ict s  Dtau onu0opx  fctldlsDumu o (0trxrir3tydfm   ivi;s s2xoxo ny1ame mnci ()sDta( ont1olto o3tlsls2um( o;()aeenmf3iydfat lnes;t)trtoirpny4lm nlieta(  Dumum nu4oeenioeildfm2rmuvpnu) lenir3oadlat livs;s)trur(r nu1altnmncslt)s2urxrpou0tpxomi3ildfmDuauvo u0trxnmrciodfatrlnei;(0 exrimpio1lm   fciatfarur(m nt1apxoio3iytlm2ulumsnu4altnmr oydoatrli sl(0 etoxr3nodolte net s sDurxm ;t4ope ifeiadlsDulnms;(4 ltrmrciytlpteliesls)trxrimpno1lp emfet (  2taxmpou1apt ii3iltfsDrmump;u0alxrxrcootlmtr u s;t)teumimpiu4ame mnesatfsDtr(mo;o1tlenmfeiys s2um(vsnu4tetrxf3iatoaDrauvo s0 rtriopiy4omen fctas)arrmumonu1teeoiociyt m ul( p;t4texnio oatopDeln o;(0s2tmxopiu1omtnmfcsls)srtrur no1ape iietytla emuvs;u) exnif iytfaD an s;( trxo(r3iy1altemiesa( srtr(rpno1tex mfeiatfmDemnvo t)arxnmr3tadfmt  ivs;(0s2xoxr3ny1altnlnviasf 2rm(rpno0opeoii3iaslsDum( p;t4 ltnxo3oa1omDrauvi;(0 2toirpnodamt lncs s)artmump;o1ape mietatfs2eanvp (0tlxrxfcio1fmteluvi;t  rtm(rpoodoltnmnetl()a2umx  no0oex moeildls2um(mo (4artrmr3iatoptrli o;(0sruriopoy1oltemfvi tfsDua(ro;t1aet  i3iaslsDumump ()altrmo3tatomD auvs;s)srur(rpoy4ole lici (farrmx pno4tetn fciltfmDulnvo;u) exnxf3ta1oatraneslt)seto(o3nu1oltnlnvi sfs2rru  oo4tpeoioeiydfa2eauvont4 reoxociadop eln i;s s2ur(m nu1ll  mfeiltf Drmx  oo1apenmicilt a rmu p t)alxrmf iodom   uvi ( s2xoxrpnydolenmfetlt  Draumpot1aetoiocildla ul( s;u)arerxf todfatraneilt)seuoimpoy4lptemneils) rrru  ;t0tpt ioeild aDel(ms (4 rerxfctydfp  lnei s)trtm(rpnu1alt mies s sruauro;t0olt io3iasfa2umumo;(4aexomo3oydfaDrli o;t)srtmxm iu4lle  nvs s)artrxrooo4alxn f3tlslsDuaumon()aeenmfcoytoptrln slt)trumxo3no1omtnmivil()a2taumpnu0oleomf3iyslmDea(mp u0trenif3todlmtranei ()tetmxrpiu1amee nvtl(f Dra(  oo1aetn fciyslsDulnvo;()treriocoodlp eaivsl() exoxr no4optemneilt) 2rr(r no1open fetadlm raumo t0trenif ta1oat li o t texriopoo1ole livsasfaDrmxr ;u0ale ii3tydfsDem(vsn()trenxr3oa1faDe i o ()trxmxr no4openmfct t)sDrm( ont4tlxo ieiyd s ulnvs;(4aexrxo3to1lm rlieolt)t2uriopoodome  ivtat a2rm( pou0tpt  ictys s2eauvp t) lxoif iydlaD aueo;s0seurxmpiu1lm  lnei s artmxm no4opxnioeias a2ranmp (0trxoif oa1oatraieol() euoim3oodopeemfvia(fsDumxro;u1oee moetadla ra( snu0 renif3todomteauvo;()s2urxr nu4al nmnvslt)sDuaxr ot4oeto ictysla2elnmp u0altoxo iotoa   n s t srtmxm3nydom   fcs s)arrmx oot4ale  o3iydfs uanmp;(4 rtnmo oo1opDeln i;(0setm(opny4lpte ivsl() rtm(r ;u0aetnmfeild aDua( onu0 eenxr3iytfm ran s;()srxrio nudll n ict t a2rmx pno0tpeoioetlsls2umnmp t) lxoxf ia1lmte ivo;t t2xmxrpiydolte nvil( a2umxr oo0tetoiietlsfm elump;(4 rxniocto1faDeaueolt trxm(r oodamtelfcsl() 2rrxm ou0tpeoii3ilslmDul( s;t)aexnxfcoo1fpD  nesls sexoim3oydllen ivsls)s2rrxm nt0oee  feildla2uan snt)teenmfciatoateanei s  rxmxo iu1ll   net sfa2rmxm ot0ole  ociytfm rmnvsnu)tleomf3oydoaDr u o t)sexm(mpiudlpen ivt s) Draurp;o4teeniicilsfa emnvsnu0trxomo ta1omteln s t0trtoxo3iudll emivtas)s2um( poo4opxnioeiatfaDuau s (0trtrmr3iydop eanvsl( t2uoir3io4omtemivsa(f rurumont0aexo feiatfm2ua( pn(0alxrir3ootlm  lues (  2um(o3iydapenmneta(f 2tm(mo;o4oexniictydfaDrluvo t) rerxo3ta1lmt lnvo (0t2xmir3nu1omt  nei t  2umxmpnt1aex  o3iadfaDel(mp u)alenxfctotop  lueo;t0 2xo(m3nydameelfciasfaDumum ot4tpe  fetlsls ran s t4 etnmr3tatoateanvi s  rurxr3oo1lm   ietls arrru ont0oetomf3tlt mDrauvpnu4tltoio ta1op e u i () rxmxmpnydamtnlieias)a2taumo;u1oetniiciadlm2rluvsnt0tlxrxr3iytfatrluesl(0t2uoirpny1ap e ivsat)a2uaxrpnt0opxn octyt mDuau p;u4tlxnir oadlmDe uvs;s0s2uoirpiudoleemnesl(  Dtrumo;t4tpe mi3iatla2em(mpnt)aeerir oytfptran o t)s2uoxo nu4ol nmicsat a2tmur ;u0aexomfcild s2ran snu4tlxrmr ia1lpDrlnes t0tetm(opnu1ome lnvtl()arrauroot1opxn fciatfm2ra( o t)altomfciytlpD li o;t0 2umir iy1ole  neslt)a2um(roou1ole mo3tltls ua(mo;u)texnxo oa1omt au i;t0 exmxopio4aptnmfvtls  Drm(m ;o4tet  iciyslm rmnmpnt0 lxoxrctodfmtelnes;s trxmxr io4llt lfciat  Dumum ;u4openio3tltfsDel( s;u4aexnmr iy1lm  lnvo t0sexrxo oy4lmenlivsa( aDrrxmonu1apeoiietydlm2um( onu0texriocio1fmtrauvsl() 2xoim iu4am nlnct () 2trum ou1aptniiciydls2rlump ()arxrxf3iy1omtrlnes;() 2uo(o nu4omee ict s a2rm(m nt4tptniieiatls2umu s (4 lxoif tydlmDrlnvo ( t2umxm ou1lpte ivs tf Dtm(moot0oet  i3iytls2umu pn()tlxoxfciydoa rlneo s t2tm(o3oudol elfvsltfsrua( pnu4tlx mf3iaslmDea(vsnu0altnxf ty1optrai ols0srxr(mpnu4llte fctltf rumurpnu1texomo3iadfs2emu p;t)teeomociotfptr n i s srtrxo ou1lmtnmnvtasfaDum(ro;o1olxnmiciltls2ul(msnu4alxriocoydopDe nvi t)texrxo3ou4alt lfei ( srtmur ;o4oexn i3tasfsDeanms;t) etoif oodlat aieo;s)trtr(rpoydam e fvi s)sDtax onu4opxomfetys aDuanvp;(4teerxrcoatfmD luvo;s0s2uoxo3oy1lpee nei ()a2um(  ;u1tpe ioctad s2umnms t4aeenxf3oatfaDeli o;(0seurxr oydlp elivslsfa2um(m ;t4tee  ocilsla emuvp t4 exrio3totlpteluvi;(0t2umxopiu4ap  lfei (fs2tmxr ;t1alenmociyd s2rm( o (4alenmr ia1lpDrluvo s  2xo(r oy1al n ivil( s2ta(r nu4tpenmfctydfs2ulu s;u) rtrxf3tatlpDr n ols s2xrxr oy4ll elfvs sf Dua( pnu4olt io3iydls eaumo t0arenmf3totfaD aivs t0 2trxr3iudlp nlfes s)aDtr(mpnt0oex mfetld m2ra(vs;(0 rtoifcoadlmtrlieo (  etrio nudamtnlfeta(fs2umurpnt0aetnmfctadlsDeluvpn()arenif ty1fatranes t srtrir iy1ome  iet (fsruaxrpot1ope ii3tat sDumnvsnu4aetrir3ia1omDe ueo;t0s2uo(o3oodam n ivsl()artmxrono0olx ii3tlt m uau ont) exnxr3oo1opt anvil(0srtr(m3io1lm  lnci t sDtmx pnu1oleoiieiadfs ua(vo;u0aetoxfctadfa r uvo;(  rxrxmpiodol n ncsltfs2umx  nt1tee mieilsfmDumnmo u0texnir3tydlpteaieils s2uoxrpnu4amtn feslt) rtm(moot1tet mfciasfa rm(ms t0 etoxo3tytom   i i t s2ur(o ny1oltnmnctl( arta(ro;t1aee mfcildlm umuvp u0tltniociadlmtrluvolt)t2umxo oudlp emnvi t)aDraur ot0apeoiictltlaDrluvp t0 lerxoctytlaD aneo;s s2xoir3oy1lm   fvs ( sDrmuront4aeeo i3tadfa ul(mont0 reniocoadlp elneolt truoxrpiydal nliesasfaruaum nu1tlx  ociadls2emnmp;(4arenir3totfm elneolt0trtmimpou4op  mivias s2raurpoo0olx  octadfsDrmnmsnu4aeerxocia1lmDrlivo;t  rxoxrpiydopen ncsls sDuauroot0tlxo fctas s2uln o u4alxrxrcty1lpteaivolt sexrir ny4lpte fvia( aDtruro;o4tpe ii3iatfs emnvonu) rtnio ootlmteln s t0trurxopoo1aleelnctl()a2urxmpou4aee moetld mDumuvsnt0areomfcio1opD lues;( teum(r3nu1al nmnviat aDumxro;t1opeoiocias a2ul( on(4aleoxo3oadopte iei (0 2xm(opoodam elnet (  Drr(mp;t4ape mo3tat s2rmnvon(4trerxr iydoaD luei ()sruo(r3oo1lme mivilsf 2tru  nu0alxoif3tat m uanmpnt0altoir ootomDr nei;s0 euo(o3nu4ame mneil( sDrmx  oo0optnmoeiydfa2elu o;()alerirctotfpDrln i s0sruriopno4oltn ieias s2um(rpnu1apen o3tydls elums;(4trxrirctydfptr n o;t0t2toimpnudal   fet () Durxmoou1apxnmoeiys s2rlnms;u0tetomr3iotopt  iei t srtm(r oodlm nmfes sf rtaxr ;t1alt iiciyd aDuln pn(0tetrmociy1oatelneslt)srxrio3ou4am  lieiatf Dtru  nu1teeoifciaslsDua(mo (4texnxr3ty1lmt  uvi t)texm(m3iy4lmtelfeil(fa2rr(  ;o4tet  oeiltfsDrlumo t0 exnxf3tytfa e ieo t tetrxm ou4lp nlnvt tfs2rax pot4tlenmicildfm uanms t) rtniocio1opD aivolt srxrir3oydaptnlnesl() Dtaxmp;t4apx ifciydlaDumumpn(0 exomfcoatfm  lnvs t0 exrxopoydlpen fvsas a2tmu onu0tlxo feiyslsDua(vs;t4altrio oydfat  i s;( sexmxrpoodol nmneils) rra(ronu1tpto feiytfmDumump t4aexnmrctotoaD  uvil(0trtrim oudlme lfetat)aruru pnu0aex iieiys s rmuvp u0 rxoxr3todfpD  ivil()tetrirpiy1ap   fcs sfsDrm( poo4tpxnioctaslmDrl(vo (4alxrxfcoytlateln s;t0sexr(m3no1om nmnvs t)sDtr( onu0apxn f3iat m ul( p;(4alerxo tadfa raiei;s teto(r3no1openmivtls)s2urxm ot4tptoioeiys s2umn o (4teeoxf iytfaDr u s t)trxoxo3iu4omeemici ( srumxm ou1aex  octasfs ul(vsnt4alxrio iodfptr uvolt)tetmxopno4am nmictas srurx pou0oleo o3iad m2elnvpn() rtoio3oadlmtr ivo s)setrir3iudomtemfvt ( srtrxrooo0olx moeiatla rln o t)aexrio3oa1omDeanei t0t2ur(m3iodlp nlictltf 2taum no4aex  f3iydfm2rlums;()tleoif iatlaDeanei;t0 euoirpoodll  mnesat a2tauroot0tee ioetatlmDuauvs u)alxoxo3oydla raieol(0 2triopio4lm  lnvs s arta(rooo1oex ioeiysla2rm(vo u4 rxnmrciy1lpDr nvo;s trtrxmpou1opt lnvtlt)arrr( ono4olxnmoeiatfs2ua( s t4alxomf ty1faDe ivs s0 euoio oudoltnlnvilsfs2tax ont0tptnif3iatfa emn o u0tltnxociadla eanvs s0 ruo(m iy4lpt micias  2trxr ;t1opxnifctld mDraumo;u4 rerxociotfaD livs (0seurio io4omen fctls)srur(  nt0oltniieiydla rm(vo u0arxomo3iodfmDeaieo t)t2xo(mpou4lm  lfvsls)s2rauro;o0opt mfctadfa ran snu4tleriocta1opDe nei;(0 exmxo oodalt  nesltfaDtm(r ;t1opxo f3iasls2ua(ms (0 eermo3to1oa rlivilt  2toxo oy1lmee ivt (  Draur ou1alenmfetytfs2rm(vo () ltrif to1lpDr ieo (0setoxmpoy1ale mnesl(f 2rru  ot0tpxo f3tlsfs rln sn() rxrxo to1lmt auvo;() 2umiopnu1lme lncsat)arta( pou1open f3iysla2ean pnu)tltrif3oo1la r uvi s  2xm(r3iydaleemfcil(  rrmurpot4aptomi3iatfmDemnmp ()teeoxrctytlptrli o;( srxr(m iodap elfci s) Dtmx pnu1olt if3tysla eau s (4 eeoif iatomte uei;t  exmim3iy1lmtelfcsas s2tax  ot0alxoiieiltfm2uanvon(0tltoxo tadfa rlnes ()seur(m3iu1ap e nvsa( artm( ooo0tpxnii3iadfm2emu s;(4 rtoxocoatlaDeln s;s  rtoxr iu1alenmictat) Drr(ro;t0tlx ioeias s rm(vo;u4 eeomf3iatlateaiei (0srxrxo3oy1om   fvt s) 2ta(root1aptomfeiytfm umumo u0trerifcoodoaDeanesls)t2ur(m io1apt  nvi s)aDtrxrono1opxn ieiydls2ea( pn(4tetrio3tatlptr ies ()s2trirpno1apte fetl( s2trxrooo1oeenmfctld s2uln onu4 rtrxr iydoaDeaivs t0s2tmir oodlpte fci ()arua(mpnu0tlenioeiytfa2rl(ms;(0tlenif3iytfmD aieo;(  etrim3ou1ameelicsl(farra(m ;o4oleo ociysls um( p u0aleomf3tadom elivi;s t2tmxo oydame mnvi tf 2tmumpno0tlenmfeiytlmDrmn sn()artomfctydlmDrauvs;() rtrxopou1op e iesltf rtm( oot1optoii3iad m2rm( sn(0artrxo3iatopt lneilt0srxrxr io4am   iesa( sruaumoot4tlxomietld m ulnvp (4aeerxrciodfptran o;()trxrxo ny4lptelnvils  rtr(mpnt4ope mfetas a2umn o (0teerxr iydlmD ai s;s trto(r3nu4llt mnci (fsrrr(mo;u4olt ifetad sDuanms;(4aetomr3tadom rlieo s) 2urirpio4ap e fvsltfa2rm(ronu4optomietlslaDum(vo t4 rxnmo oadoaDrauesl( s2to(rpio4al   ivt ()sDrrum ;o4alenmieiysfs2uln onu0artnio3iadfmteai s s  exoim3no1ale  nvilt srra(m no4tex mietyd mDumnvpnu0 exrxf oydlaDr uvs ( s2xoxr iu1lpenlfei s)aDrr(monu4optoif3iat s ul(vsnu4arxoxocoy1omt  ueols t2xrimpio4omtnmfvtls)srrauronu1alto oeiad aDuauvs t4aeeoxoctydfptrlu s () ruo(r no1lle livtl()s2tm(r ;o1oexnmi3iad aDul( p;u4trenmo tydlpt lieo s srxo(o iodaptnlncsasfarrm(rpou4tlxnif3iat m elnvp;t4tlenxfcootlptrln ils  2uriopnudllenmfvt s)s2tm(r oo4tee mfciltlsDea( o t0 ltnio tytom elieols t2xmio io1lm e nvtasf rrrum ;u1aptnmicildfm umn p;u)teenif ty1lmDelnei t)trtr(m iudom nlfes t sDtru  ot4tpeomfeiatla2rluvsnt0tltrxr3oydlaDrau s;t0trumiopny1amenmncil(faDurum ou1altoiociytfa uan s (4tltrmf3tatfmD auei;t0trxo(mpiu1amenmncs ()s2tm(mpot4texomietadla uauvsnu)alxoxo3ty1laD aueil()t2xo(o3oudlltn fvtl() rrr( p;u4opt mieilslm2eauvp;u4 rxnio oydfa ean ilt0t2uoxr3nudapenmnct (fartrxr nt4tleniociasla um(mpnt4alxrmf3ia1omDeluvsl(0truoiopoudape  fviatfs2raurpou4opto i3ilsfaDrl(mo;() reoir iydoa eaieo s0 exo(opno1lptemneil(  2urxro;o1aex mo3iyd mDelu snu0 rtoio oo1lm raivol(0srxr(opny1oltelneta( arta(rpnu4olxnmictad s eaumpnt0arenifcty1omt lieo;() rumxr oodame lfvsat s2raxmpoo1oexnmi3iyt a rln o t0tlxoircty1op  luvo s  2uo(mpou4lpe livsas)s2rru p;t4aptniietatfm umu p;u4 rxoirciadfmDrlies s0 eurxr3iy4lltemfvi () rur(rpot0oee  o3iasla umnmpnu0 ltoif3oadfm ran sls)srtoxmpiodapeemieia(  rrm( o;u1altoioetaslm uan pnu0trxrifcoo1fmDran ols texoxo3iydlleelfviat)arrrxmoot4oetnmf3tlslmDeauvo u0trtnifcoytlaDe uvi s0s2trxo3oudlmtnmncslsfsrtau pno1oeto ieiadls ra( o u4artnio3ty1opt li s t tetmiopoudalt  fvt s)srtrum nu4olt mietlt sDrm(vsnt0 ltrxociodoa eli o t0 rurim oudomenlnvsasfsrumxmooo4tpeoio3tytls2uanms ()trenif3iy1fp eai ilt) rtr(rpio1lmt  fvsa( a2trump;u0tltomfeilt mDem( snu4alxnxfciy1lptelnei s  rtrxm3no1amtn ivs t srtmxro;u4opeoio3ild s2rmuvpnu0 etnxo3oadlat au i (0s2xmim iudlpen ivtltf Drmxmpnt0aeenioeiltfa elu ont4 eeomo oytomDranvi (0t2toxrpou4llt  fcs (  2trur ;o0oeeoii3tatfm rmnvs;(4 lxomr3io1fp  auvs s)texmxrpoy1omt mncs t a2trurpnt1aleniictldlm ulnmpn(0tlxrir3ia1oaDelneols)teumxm nodom  livtatf 2tmx  ;u4aexomfeiys m2rau pnt4 eenxo3io1latelues s)teurim oo4apen fvsa(f Dtmump;t4oee mf3iys a2em(msn() lxnmr3oydlatrli il()srumim3oodale livsltf 2rax oot4aeenmf3iydfm2rauvs (0 rerirciydfp rlneo t)srur(o3oy1aleelncsatfs2taum oo0teenmfeiytfmDrmums;t)alxnxrcoydomDeaneil()seumim3oo4amenlieta()aDumxrono1optoii3tat sDra(vs u4 lenmfctotfa eaivs;s trxr(rpiu4lpenmneil( arurx pot4olxnmo3iyslm elnvont) ltrxr3tydfateliesls) 2xrxmpoydlme  icilt  rtmxmpot0tlxnmo3ilt m2uluvsn(0 lxomo iytlp r ueo t) 2xo(r oydaltemfvtl( aDraxm oo1teeo ictys mDeaumo;t0teeoio3todfp rluvo t t2urxm io1op elfci ( a2rmx onu4teeo ociat sDuanms u)tltrir3totfptrlues;s0 eto(m3nu4am  mnct t aDtm(r oo0ope  i3iysfm uanmo t4artomr oy1omDeanvsl() exm(m nydal  mieil(f rtax pou1tltoifeiytfm2rmums;u)aeenir tadoatr uvo;s texrir3nodal e ncs ()srrr(mpnt0aeto o3iltfa elums u4 renxf3ta1lpt  i o t0trxoxr3oydllt  ivtas  Dta(mpot1tle ioctys m2em( pnu4artoxr oo1omt aiei s0texrxo oy4lpe mnvs s)a2taumonu1apx mi3iysls eau p () etomo totfaD livo;()srumxrpiydlmen nesa(f 2taump;t0tetoiieildfm2rmn o;t0texomrciotfp r uesls)srtoxm oydol n nct tfsrtmxro;o0tpx  f3tltfaDemnvs t0 leoirciydlat  ieilt0t2uo(mpiydamt lnvsltf rraxrpno0tptoiociyt mDemuvs u) lxoio3oydoateluvs;s0trtm(opiu4openliesas) Dtrxroou0alx mf3ilsfs2ulnms u)tltrxf to1fm elnvs;s0 2xoim iu4omtnlivtat) 2uaumpot0oetnifcilsfm umu s;(0alxoxf3todom raueilt0srxoxm3ny1om   ieiat)a2urxmoou4oeeo i3tasla eluvonu)teerir io1omDeln s s0sexo(o nudaptn nctlt srtaxr no0tltn ieiltfs2ea(vpnu4altrmf3tatom  lnvolt0seuoim3oo4al e fesatf 2taxm nu4alt  ictysfs ra( o;(0tlxomo3ty1fmtelues;(0seum(rpnydalte ivsls  rtrxmono4aexo oeiydfaDrmnvp t) rxnirctotop e uvo;s0sexmiopno1op  mfvs tfa2ra( o;o4oeenmfciys mDumuvpnt4trtoif oydfpDelneilt0srtm(opnydapt liesa()srtmx o;o0oleoioeilsls2uln o ()trerifcoa1fate ueo () rum(r iodop elnvilsfs2taxrpnt0oeto oeiadfmDeanvo () ltrir oydoateln slt) rxrim no4lpt mfvtl()a2rr(mp;u4tleomfeiatls2uln p (0tltrxfcoytlpDrlnes;t0 rurimpoydllt lict t) rtaur ;u0aetnioeiysfs2elnmo t) rxomr3todlpD  n ilt)s2uoirpiu4lmen fet s)sDtmx  ou4aeeomoetydfsDem(mon(4alxoircoytlm ranvi;s0t2xo(r oodap emnet tf Drrx ono1altnmocild mDrl( p;t0 eermf3tytlp r u ilt0trtrxo3ny1lptelivia()aDrr(ront0olxoifeiyd s eanms;() rtrxfcoa1fpt lnvslt) 2xmio3ou1olt lictls  Durxmpnt0aleoifciytls umuvp;t0 leoxo3ootlmD  nvols0texo(o3nudapte fvi sfsDuru pnu1tlto fctydlaDeln o t4 exrmr iodlaDe ues s) eumxo3iu4lmtnlfcias aDrrumpnu1tlt  f3iasfm eau p;u4tlxrxf3iydomDe nvols)trtrim3oo1ol e ivsat  Dtax pnu1oeto octyd s2em(vo;t0arenmo oydfp rau i (0trtr(r no4lm   ies ( aruaxro;o4opxo o3tltfa el( pnu) rtnif3tatlmD ln i;( teuoxrpiydom nmfcs () rta(mpou4oltoifciytfa2ea(vp (0arxnifcoo1fm raneilt)tetr(m3iy4ll   ncsa()a2tm(r ou1tptoii3iytls2ul(vs;t4teerxfcty1fa eaivs t0t2uoxm3oudlpenmnvi tfs2ra(mont0opxo fcils aDem(vp u) exrio ta1fa elieo (0setr(mpnu4apen ivtls)s2rr( poo0texnmf3iysfs2elnms u0 lxnmo3ta1op  lu i ()sexm(rpnydaptnmfei ( arrmxm ou4olt  fetlsfsDemuvs;u) exnxo tadlm   i s ( truo(m iodam nlici ( aDur(m nt1oeen fctysfaDrlnmp;()trxomo totlaDrai ilt0trurimpiudopte fes s  2trum nu4apeniictad aDulumo;(4alerio3iytfat lnvsls)texrxm3iodlmeemfciasfaDtaxr ;o4ape mietysls rl(mont4aeenir iydlaDe ies s  rumxo oudom elneils s2uaurooo4apxo oeilsfm2rl( p;u0 etrmf oa1lmD lieolt) rxo(mpou1llte fvsl()a2rr( o;u4ole  ociltfa2em( on()arxoifcootlptr uvs s srxr(m3iy4lltn neils)sDur(mpoo4aptn i3iytlm uluvp ()teeomr iadomD  nvo (0setmiopnydlmeemncsl()s2tr(m ;t0optn fetat mDeau p t0aexrmfctotfmtr n il() 2tm(o nu4lme liviltfarraxrp;t4open fetltls rlu s t)arxnmo iy1lpteau s (0seto(m oo4llenlfvia(  rrm(  nt4tpe iieildfsDuan o (4altrmo ta1fm rauvs;s)t2xrio3nodomtnmfcsltfsDra(r nu0openmoeiydlmDrau pn(4 exrir3iytla  lu sls)setoxr ou4alenmfcsls srrrxrpnu4aet iociltlmDumnvont4texriocty1lm   ieo t)srto(opoy1ole mnvi ()aDrrx  ot0texomi3tadfs2ea(mo;u)artnio3todlatrlues s) 2uoimpnodamenlicslt s2rrxroou4texnio3iydfaDelu o (4treoio ty1la   n il(0truoiopoudoltnlivt (  rrm(r ;u4tlenio3tldls raumo (0 lenio3iatlmD  u i;t)teum(r no4optnlfetlt) rra(rono1oetoiieiyt s2rm(vont) rxoxrctydoaDeaiei;t0 exo(mpno1lptn ieslsfaruaxrp;u4ape mfciadlm elnvo (0aetnmo3iotfateanvsl( texrio oodll nmivi s arum(ro;o4oeeoii3tydfaDemuvp;u0tetrmf3tadfp rlnesls0 2xoxm ou1al e ieta()arumurpot0optn ieias aDrm(vs t4texoir3iotfpDrlnvols srurio3nu1al emfesatf rum(mpnt1aptomo3iatfa2ea( s u4alermf iatomt  i s;s0texrio3nudlltn ieil(  ruax o;u0aeeoifeiat aDra(vo u)altoio3tadla  aueo;t  2tmxo3io4oltemfct sfsDtr( ont4alxomoctadfa elumpn(0aleoio io1fpDeluesl(0 2xoir io1ol  lnctasfs2taxmpnu1tleo o3iyt sDemn s;u4 eeoif3iydoa  auvslt0truoiopoy4om nmncsas sDum(mp;t1aleoiicild a2ua( o;(0 rxnmo3iadlateli olt0 euo(o oo4omt liei ( sDrmx pot0teeomf3tytla2rmu s;(0aetoxr3oydlpD lneol(0texo(o no1ll   ieia(fsrumxmo;t4alxoif3iytfa2rau ont0areomfcta1oa   neo s  etmxopoo1altelncs s aDrrur ;t0opxo ieilsfsDulnvs;(0tlxnxr oydopteluei ()tetriopoo4amt mfvt s)aDuaur ou1tlt mociltlm eluvo;u) rtrxrcto1lmD  u o s)srxoxo no1lpeelicia(f rrrurp;u4oltomf3iltlsDua(mo u0tlxnirctadfmD anvi;t)t2xoxo3iu1lptnmici s)aDtru pou1ole  i3ildlaDrln s;(4alenmo to1op rlneils)trtr(m3iu1ll nmicsatfartaum nu1tpenmoeiydlsDulnvo;u4altnio iytla  an s;t0 2xoir ou4op elictat)sDurxrpnt1opxnmo3iltfs2emu o t4arxnio todlpt  nes s) eurim io4ll  mneilt)srur( ono4tpe ifciad sDulump;()altnxo3iydla e i il()t2umio nudlltnmnes (  2tm(rp;o0texo feiad mDranvsn(4arxomfcoatlmDraivs;s0seur(r iy1lme  ict t arumxr ;u0aleoifctas sDuanmo;(0areoif ta1lm elu o;t)srum(o ou1oltnmnetl( sruau  oo1tpt mfetas mDeaumpn() etnxo3oadom elieo;s trtr(opny1lptnlnes ( sDtm(m oo4aptnmf3tltlmDulnvpn(0 lxnmf io1oaDrlivsls s2xrxo iy1ll nmivil( arum( p;o4tetnifctatlm uaumo;t4aexomfciytoaD  nvo t teumxo io4om emfvtl()sruaxmpnu4olto fciltls rlu on() ltoxo3oytopD  u s;(0 exo(rpiodomtnlfcil()artmumpou0ole mf3iatls2ra( s;(4aetnxo iodoa   nei;( seuoxo nudlm  lfetltf 2urxmpnt1teeoifeild mDeanmp ()trenmrctadopt aneols)trumxo iodopenlici (fsDur(mo;u0tlt moetys a ul(ms;u)artoxfciotom rauvs;t trxoir3oy4ap elfciasf 2rmuront4alx iociatlm2eluvs;u4aeeoio3ty1lm r nes s)t2um(o3iy1llenlfcs t  2tru o;u4tetnii3tytfmDuluvpn()tlxoircoy1oa   ivils truoim3nu1lltelnci ()aDtrum ;u1ope mo3ilsfm eln o;t0aexoiocty1fpDeln i;t)s2xoimpoudlmtnmicsas)srurx  ;u4oetomo3ilt m2ra(vp t4 lenxf oydoate ivi;t truo(m3iodapeemict ( s2rr( oot1tpeomictyslsDea(mp;t0treoxo totoat li s (  etoxrpiy1oltnlivias sDtaum ;u1oeen octyd m2rlnvs u) lerxr todom  lies;s sexm(m3io4ope  nct t)arumu pno0aeto iciltlsDemuvon()trenxf3ia1op  luvi;t0 2ur(r nu4altnmivsatfa2taur nt1tltoio3iad s rlu pnu0trtnmo3oa1fmD ai ols  exo(r nu4omtn fcias arta(rpoo1tee mo3iatlsDelu s;()trenxo ta1fm elies;t tetoxr oudomt livia( s2tru pno1tex moetatfm umu sn(0texoxf3tytom eliei (0t2xmxr no1aptnmivsls arurum ;t0tlenmo3iatlm ua(vp ()trxrmo3ootfa e u s;t)s2tm(r iu1ol   nviasfsDua(mpou1oet ioetld a2rmuvp t0artnif3oy1lpD  uvi s0seto(r3ny4amtn fes ()aruaxr ;o0tlxomfetytla rlnmp;(0tltomr io1la ean ils0 2xoxm3oudomenmictatfartmuro;u4tlt  ieiltfa2eauvpnt0 rxnif ootlmt  nvi;s seurxm nudll emfvt ( srrr(moot0apxomoetldlm2eauvp t0 ltoir iy1lpte u ol(0teuoxo3nydop n nvtls sDrr( pnu4alen oeiltfsDuanvo u4aetoifctytlpDe n o;(0seumir iodoptnlfeiat) Durxm nu1aetnmo3iad s2rlums u4aetnif3iatfpDranvs;s srumxr iy4al nlfvta(f 2raxmono1apt moetyd s rmn o;u4 exrmo ta1lpD li ils  ruo(o3nu1omeelfes s  2taxr ;t0alxn icilsls2eau p;u4artrio3ootlmDr i i;s0sexrxm no1om nlnciat a2rm(mo;u1teen i3iytlm2ulnvo;(0aexnxf3ia1om   u ilt s2urxr3iydopt mfetl()aDuax poo4ale  o3ias a2eluvs t4trxnifciytoa eaies ( trxoxopno4altn fvi sf Dumu p;o4tpen feildfaDem(mo u)altoxrcoo1oa  an o s)sexoirpiu1op nlfeiat aDraurpnu4oeeomfctadfm2eanmpnt0arxnio3ootfatraivi;s setoxo oy1ll  mfes t  rraurpoo0tpt iietydlm2uln pnt)tltoxfcoodomtr u s;s srxmxo ny4omtnlfeiat)a2raurp;t1tpeo feiadlsDrm( pnu)trerxrctadlatr ivsls teuoio iudlmeemnvsl(f Dumumpno0tee  o3iytfs2ul(mo;t4arenmo ootfpDeanvi s)srxm(opou1ap   icia( sDur(m ;o1aexnmociasfs2umu snt0 exnir3oatlpDr ieolt)s2xmxo oudale  ivta()aDrmxm ;o0tpenmi3ilt mDrlumpnu0teerxo3oydfm e nei;s0 2tmir iu1aptemfcil(f rrru pou4opxoifciytfaDeauvo;(0aexnmfctatfaD  ueslt)s2umxo ny1ome  ieilt s2tmxrp;u4tee mfeilslmDrlums u0alxoxrciydlaD anes;t t2toxr nodomee nviltf rumx  no0tpt mieiydfm ulnvp;()trxoirctytoaDranei;s0 2tmxm3io1lp e feta()sDum(mont1tee mociltfa2rmuvs;u4aetoio3iatlaDr nes;t) rtoim iu1omeemfvt tfa2ua(rpot4alx if3ildfaDra(vo;u0aexomf3todlpDraivo s teur(r io4lpt  ivilt) Duaurp;u1opeomociatlmDulumonu)trtoifcoadlpDeauvils0sexoxr3nu4amtnmfvtas a2rr( ooo0ape if3iydlm rlnmpnu4treoif oy1fmD luvi;(0 2xoxr3iudoleelnvsl()s2ta(m ot0tpeomi3tydlsDeluvp;t4 rerir iytomt  ivo s)srtmxm nu1alenlicta() 2rrump;t4olx iicilt s raumpnt4 rtnmr iatomt luei;s0 rxrir oodamen fcsas sDraxrpnt4tltomo3iytlm2umu snu0alxrmf3tadlpDr ies t)trto(r3iodlmenmnesat s2raur oo4aeeo fcild s2ulumsnt)tleomociydfateli o t0 etrio iudlpt mnctl()aDtax p;u0tetomictyslaDrmumo;t4artnir3iydla  aueil()s2tr(o iy1ameemiciasf 2ur(m nt4aetnmoeiat aDuanmon()trtrio oy1lmDrln ol()tetrxopnu1om emfvslt  rraxro;o1oet iicilt s rmumonu) exrmo3tadfaDrln i;() 2uoxm3nu4oltelfctlsfaDra( p;t0apen oetasla em(von()areoxf tytlmD  u s (0sexo(m3iu1lpt  netasf 2tr(m nu4altn octysfa elu s;t0tltnir3oytfp eanei s0s2xmxm iu1llte fciat) Drruroot0ole ii3iad m emu onu0 exnir oatfptelu s (0t2xoxm3oy1ll e nvt s srtauro;u4aetnmocilsls2rau ont0altrmf iodfmDelneo (0seum(opoy1llt mfcsat)a2umumpoo0opeoif3tlsfs uanmpnu4tltnir to1fmDeaueil(0 rumirpnu1am  lnct s s2rmu o;o4texnmo3tyslm2emuvonu4artoio3ty1opD luvs () etrimpnu1lptemieslt s2trx  ;u0tlenmoeiadfmDel(mo (4 rtrmo3ta1optelivo;t s2uoim3oodom emfetlt)aDrrum ;u4oeto o3iltlsDeln pnt0 eenio tadfa eauesl(0 etm(opnydalenmfviltf 2rmxmoot4aexn ictas mDean s t0altrif oy1lmtrlieolt)sruoxopno4lmen nes s)a2rrump;o4tltn ociasfs ua( p t0teeoir3oytop eanes;t seuoxo iydam elfeias)a2uru pnt4apen oetls a2em(mo t) rxrxf3ty1lp r n ilt)sexoimpou1al   ici tf Dur( ono1tex mfctas a rm(mo (0aetrxo oytlmDrlues;t0texo(rpiodamee icil(fa2ra(ro;t1alx mo3ilt sDrl(von()tlxnmf oa1fa e nesl(  euo(mpiodopee nvsl(fsDtrx  ;t1tlt ifeiasls2ea( on(0trxrmf iy1oaDraneo t0srxr(o3iy1oltnlfvia(fartmu onu4tlxoiocils s2em(mp;() lenmo oatfpteluvi ()tetrimpny4amtnmfvsls sDum(m ;o1ale ifcias s2emnvp;()aexnmfcto1lp rliei ()t2xmxr3io4ll e ictasfsDtm(m ou4openmicias a2em(vp;u4 etoxf iy1lpD livolt) rxmio3oudlp elnei (fsDumu o;u1teeomoeiytfm2ulnvo;(0 rxoxf tytlaD lu o;(0srxrxo3iu4ll  mieiatfartaxm oo1alxomo3tas s rmn o u0altoif3ia1fat an i (0texr(o3oodaltelnvsat s2rmump;u1aptnioeiysfa2eln pnu4altnmo3iodfpt  uvs;s) exrimpoy4amt lictat)artmurp;u1aleoifcildfa rmu o;u)arenmr3tydoaD  i i ()s2xmio3io4ole  fct tfsrrax oou0olxnmietasfs rmuvo;t0 renxo totom ran i;(  2xmxmpnudlpt mivtl( a2ra(rpou4oltniiciyd s2el(mo;t4arxnmr tatfpDr u ils0t2ur(opio4lm e fcils aDurxmonu0aeeniieias aDraumpn()aetrmfctadoaD ln ol( srtoxo oydalt lfci s aDta(rpot4tltn fcilsfm rmnms;u)arxrmo to1fm  lueo (0 euoxm3nu4lm e ivs t s2rmur ou1apxnioctyd m2ulnms t) ltniocoytlpD luvi (0teurxo ou1al n ivs sf Drmumpnt1tlx  i3iyslmDua(mp;()aeeoifcty1opDr i s;t0texoim oy1lmen fct (fs2rmurp;t1aptoii3tlt a2ulnmo;u0tlxnif3ootfaDrai i s) eum(r iy4ape lfvsa()sDur(  ;u0texnmf3tltfs rau s;t0arenmr3to1fmDrlivs;() etm(o oy1al n ivi t  rrr( oou0oet iociadfa2el( p (0 rtnxr3ty1lm e uesl( sexrxm3iy1amtnmfviat  rum(rono4aexomo3tytfm2rm(vpnt) etrmr iadlateluvs;()t2tmio3no1aptnmfeils aDuaur oo0oleomfcias s em(mp ()alxoif3tatfmtrlues;t s2xo(o3iy1lpe lneias arrmumpnu4tlxomoeiad m2rlnmp;()altrio3ootfaDe u o;t setm(m3ny1lpen ivsasf rta(r ;t1oee  icias mDemnmsnu4teeoif oo1fateau i;t0texoir3oy4ap emnvta(f 2tau pnt0oeen i3tytfa ua( o;(4artrmrcoytopt livs (0tetoiopno1opt lnei t)sDtrx o;u4apxomietysla2uluvs (0 lxnxr iodopD lies;( srxoim3nudolenmnci tfsDra(  ;o1apx mfeiadfa ea( o t0 lxoxfcia1opte u s (0 etrir iydale mfeta(farrr(rono0apt ifeiysfm ua(mpnt) etrxo oadfa e ueo (0 2xrim iy4oleemfet ( aruru  no1apxo o3tad a2em(mo (0tltnir iatlpteluvo;()s2tr(o oydapeemieia(f Drau  ;u1olx  ieilsla2rl( s;(0 etriocoydlmDeaieol(0srxrxm no4al nlnctltfa2uax pot1alxn octydfsDrmn o;(4tetrmfciatfa e nvils0 2toimpou4lm  mnctl(f Dtaxrpnu1opxo fctas a2rm( p;(4trtrxf to1lpt  uvil()sruoxr iu4op n icilsfsDtaxr ou4teeo ociadfa umu o u4 exrir3ia1fmDeluvs ( trum(rpnu1ame mnetl()a2tru  ;u4tpxnii3ilsfs ra(mpnu0 reoxr totfmDrln s;t)t2xo(r nu4ll   fvtls srtmxr ot4aexnifeiydfmDumnmp;u0 rxoifciodoptraieo;(  exrir ny1al e iet tfs2rr( pot1opxomoeildla ulumsn()teenifciatlp rliei;t  2toxo iudole  fvta()sDum(  ou0tlx  feiysfs umnmpnu0arenmr3ta1la  lu i;t0t2xrio3oydlmtn icslsfsrtm( oot1apx  ociysfm2elumo;()tlermf3ta1fp  lneo s0 eurim3iy1lltn net (f rtmu p;t4tpxn i3tlsfa um(vp ()alxoio3iotlp rluvol() exr(r3iy4opeemieta(  rtmurp;u4oexn o3iytls eaump;u)alerxf3iadlmD lieo;( seuo(o3nu4om n net t s2uaxmooo4tlto i3iadlm uauvsnt4 etrxr3oa1oat luvi;t0srtr(m iudlp emieia()s2umxr nu4texomo3iysfa2ea(msn(0altnxf3iydoatelu ilt  eurio iydlp  lfct (f rrmx pnt4oex mf3ilsfa rl( o;u) lenmr oadla   n sl() 2xm(opiy1alt  ivtas)arrmx ooo1aex iocild m ra(mpnt0alermfctydfmDe ieo (  rxoim iu4ame lies tfa2ra( ono4aetnio3tydla2elumpnt)artnxr3oydomDe n ol()t2uoxo iydlp nlietltf Durxrooo4apxomfeiasls2um(vo;(4aeerxo oy1opDr nesls texoim3iu4altnmfes sfa2ra(m oo4tpx ii3iysla2elumonu4 exnmrciodfa r i olt0s2xrimpio4lpenmfvslt sDtaxm nt4texn oetasfsDelu o t)arenmr tydlpt  ues (0sexo(o3nudlmenlfci ( s2ra(ront4apxo oetad m rauvo;u0arxoir tatfmD lneslt)tetmirpio4lpe mfesl( aDumumoot4aet  ociyt sDrmn p;u0altnmf3oo1fm r ieo;()trto(r oy1ame mivt t srur(  no1oee ifeilsla rmuvpn(0 ltnmf3oadlp rau o t) ruoxopiydlptemfvia( a2trum no1apenii3tat s2ua( pnu0arenmr oo1fm e iei;(0t2tmxm3no4omen fctltf rraumpno4opeomictad s2ea( p t) eeoxo3iydlaD  nvi;t)t2trxr oo4lmtemnesasf Dra(rp;o1apeo o3tyslaDrauvp u0 rtnmf iy1lpD  i o (0s2xo(rpiu4opee nct t  2umxrpno0apto fciysfs2rmn snt4 etomrciotlate nei;s) rum(r3ny1ol  lfet (f Durumono4aexnmi3iydfa rl(vo;u)tltrmf oytlmDe n o s0srxr(m3nu4omeelneias sDuaxmoot4tex mi3iysls2uauvs (4 reoxocoy1lmt  u sl(0t2xr(o oudamtn fcsltf rrau onu1oeenmo3ils mDem( pnt0alenmf tydlaDranes;( srxriopiydame mnci s)sDrr( ont1tlt iietaslm2ra(vpnu0trxrxr3oo1fmDe nesls)t2toxo ny1ol  mnct s  rur(  ;t1tpx ifeils m rauvonu0 exoir tydoaD lieo;t) 2uo(o nu4olee nesa(fs2urumoot1opx mo3iat s el(vo (4 etnxr3iy1op r nvi t)seuoxopnydlltnlivilsf ruaxr ;t1tpxn ieild m2eanms u4areomo ty1lpt luvo s t2xoirpiodamtnlnvils)sDtmum no0oltomocildls2em( ont0 exomf3iodomDrlnvo (0 exmxr iu1oltn fvs (  2ur(rpou0alxnifciytfs2eau s (0artomf3oadfm  lneo s) rurio ou1lme mneil()aDuaxm nt1optn i3tad m elump t)tlxomf oy1omD ln i t  2xrxmpoodllen fvt ()aDtau o;u4teen feiysfs eanmpnt4trxriocoodfm  au ilt0t2um(opiydale lfci () 2tr(m ot0tpt iociatfa rl( onu4trxoxocoo1faDran s;t tetoxmpiy4lptnmics s  Dtmxmo;u1teeniictlsls emnmp;u)tleomf3oytlmDranvo;s  rxmxo3nu1al emncias) 2tr(mooo1tpe mociydfs uaumo t4 leoio iodoptrluei t)teurxm no1lm e ivtl(  2ur(mono0aeeoiicildfm2rau o;u)artoxr3ia1lm eln il( s2uoxo3oo1lle mictl()s2tax  ;o0tpxn feiyt sDrlumpnu4trxrxociadopteln i;t s2umio oy4alen iciat  Dtaxr ot0tpen oetlslm2elumo t) rermr tatfpt  iesl() 2xmir nudam emfesat  2trumont0oet iiciadla em( o t4texriociydop   ieilt  etr(rpnu1al  miei s srrmu poo4oetn fciydlsDumnmont4aeeoirctytfa  anvol()trum(r3nu4ll nmivsls arrmuro;t0alxnmictld m eauvs u0 exrif3oadoptr nvs;t0tetr(opio1am  mfctas)a2tmu  ;t0tltoifcilt mDemuvpnu)arxoxo oodla ranesl()srxrir3io4alee fesa(  rrr( onu4alxo ieiadlmDelnvs;u)alenmf iodopt au o;t)t2xmirpiu1ope  ivtat) Dumu poo4aeeoio3iad m2ulnvo t) lxrxf3ia1fmte nes t sruoio3no1omtelnet sfsDuax oot0tlt iieiysls2uanmo;t0 exnmocoatfmD ln o s) rumxr iu4alenmivslsfarrm(rpnu1apx if3ild aDuln on()tltomf3iotlm eln sl()t2xoimpny4alenlncsat)srraxr oo1tlxo f3iad mDem(von(0trxomfcta1fp   ieol()sexm(rpnu4lle  nvil(  Draxront4oex mfeilt mDumuvsn(4arenmr3iy1oatran olt0 2to(r3nudlle mivi () rra(rp;u1aeeomo3ias a2rmuvp;u)trtrmocoytoptrau i;() 2umxrpnu4lm nlicslsfaDuax poo4alx moetysla eln pnu0 exoxr3tatlm  anvil( s2umiopoo4lpt mncsas arrru  ;t1oetn i3ild aDuln on()tleomf ty1faDeau sl() eum(mpou4lleemfci (faDraurpou0aet moeildls2eanvs;(4aexnmo3tydomte iei;t teumxmpiydap nlfcsls)aruaum no0opt ii3iatla2uln p t4aexrir todla e neil()t2uoxmpnudomt  nvta( srrm(r ;t0olxniictasla rmnmp ()tlerif oatoaD anei s  rurxm3iydlm   icsasf Drrumono4texoiietas a2rluvo (0 lxomf ia1fpD  ueil( trum(r oodaltn nvil( artm(r no0apx  ociysfs2raumo (0arenmr tatlmDe i o () rxoio3iu4lpeelfct (farrauro;o4aleo feiasfs eaumont0 renircootlmteanvi s0 rto(rpiu4lp n fvi s)aDtaum oo0oleo f3tydfa2rlu o;u0teeoif3ia1latean ol()s2xoxr3oodole lnctas)srra(m ;o1oltn f3ilsfa2eluvs;t4areoxr oadom  an sls)s2ur(r3nu1ame mnvtl( srtm(m nu4aetoioeilsls2rln s u)altoif3iatlpDeauvo;( sexoirpiudame lnci () 2rr(r ;u1tltnmo3iytfmDuau s;t4teenmrctydfm eaivi t truoir3oo1amtn iei ( srtm(m nt4oetniieilt mDua(mp;u4 lxnif iodfmt anvi;t) rtoio3ou1ap  mnetat a2rax pnu1tptoiiciyt s2ulnvsnt0aexnifciydlmDrau s s0t2uoxm oy4omenmfvias srua(ro;o1alxo o3ildfsDuaumsnt)alerxo tatomtraiei;(0 2tm(o io4lmt  ivi s a2trurooo1apt moctas s eauvo;(4 exnxf3iodla e i o;(0 2xoxr nudlpe mnctltf Dumumpoo4aptnmieiyt a ul( sn() lerif3iotfaDeaies;t)seto(rpiydoltemfesa(f Draxm ou0aeto ociadfa2umnvp;()aeeomr3to1omDean i;s)setrxopou1apt mnes t a2ua(rp;t4oexniieiatfa rlnvonu4tltomo ty1fp   u ols  rurio3nodam  mncta(fsDta(rp;u1tlxo f3tadlm ul(vpn(0 reomf iatlmD aues;s) etoio3ou1op elnvs t)s2tmxm ;u1opeoif3iyd sDra( o (0arerircoodfa   i sl() 2xoxm ny4openmfet t  2tr( pou4oexo ieiyd a2ean p (0tetrxoctotlp eliei;t) 2umxrpoo4olt lncs s)aDurump;u1ope ifcilt sDel( o u4treniocoytfmDelu ils0 2xoim3oydlpe lnvsltf rtr(ronu1tpxomo3tytlm ul(ms;(0 eenifctotlm raieols0trto(m oudalee nviat)sDrrx  oo1tpeoii3iydla2umn p;t) etrmr tadop eai s ()s2to(opoy4amtnmncs t)srum(  ou0olt mi3tadfa2rl( pn() reomf3ootlpt anvo ( seumirpny1op nmiesas)a2rr(root0opx mictytla2el(vp;()artrmrciytfmteai o t0trtrxo3io4lp elivtas)sDrr( o;u1tpeomfciytfm2umn p;t4arxomfcio1faD auvi;s srtm(rpoydapee neia()a2rrumooo4oex  oetydlsDua(mp;(4 etrxfciydlm r i i t  rtm(r nu4lpt mfvi ( sDrau  ;u1aeto iciasla ulums;t4altrir3ootoat livs t0 2uoir3oodlmtemfcsl(f 2raum no1oeeniociadfm2ra(vsn(4 rtoif3iydlaD  iei t)s2xoxo3io1ape mivtat)sDrm(  ;o0ale ioctld a eau s u) exrircoy1oaD anvsls texrio3oydop elicias)srrm(  ;t4aleomo3iadfm eln p ()trxoxociy1la raneo;()srtmxm nodop  lies ()a2um(  ;u4tet  fetyd sDeau s;t4trxrmf tydfptrlnes;t0t2xm(mpno4alenliesas)arurxmonu0aleomfctls a2em(vo ()aeerifcootfm r ueols0tetmir nodll  lneilt) 2trx o;u1opt ifeiysfm ea(vpnu0texnmo oodla e nvi;() eurxm oo4ll  mfeils s2taxmo;t1tptoifeiadla2eaums;u)tltrxocoytomD  ues s s2xr(rpnydaleelnvt ()s2tmurp;o4texo oeilsfm el(vs;t)arxnxr3oadfate nesl()t2umim3ny4lpe  netl( srtaumpou4teenmoctltlm2elumsnt) rxomociadoatr nes (0 rumxr iy1omen nvtasf rum(roou0olxo i3tldlm rl(vo t4 leoxf3iodfpDranei;t trxr(o3oo4am emies sf 2rau pnu4tlt mi3tysfm emnvp t0 ltoirctatoaDe n i s0teto(mpoy1apenlivias) 2uaxmo;t4oetoio3tyd a2rau p u0tetrmf3totomtrli o t0truoio ou4aptemfcsatfsrurx  no4olt ioeiadlm rauvs u0 eenmo3tydfat aivs t0 rxoir3io1olen fet (f rra(r ;u1oet  fcilt s2ranvsnu4aleoxr iotlaDe uei t s2tm(o oo4lm e nvsa()sDra(mpou0olxnmi3tysla2umnms;u)tetnmociy1fmDr neo (0srur(o ou4lp   ies t)aDtax oot1opeoifeiasfm2ea( sn(0 lerxrciadlaD luvi;s0teuoim3iydlptn ietls sDraxr ;t0tpenioeias aDrmums u)arxrxfctydlmte nvs;() rtoxo3ou1omtemicilt a2tmx p;o0oexnmo3tytfaDulu sn()trtrxf3iadlpDelneo s0t2trim oydamee nctls srur( pno0ape  oetydla ul(vo;t4tlxnxf3tatopDe nvi (0 euriopio1aptnmfcs t)aDtaxrpnt4apxnmf3iydlm2em( s;t4arxnxr oo1latrai s;s0 rurio nu4lleemicils arrmu ono0aleomi3iysfs2uaums;t) lxnxo3iodlm rlivolt)setmxm3iu1aleemfvs t)aDtr(m ;t4apxo ieiaslmDumn o;t4tltoif3io1oaDr u o t sexo(r3no1lp   nvias sDurxroot4opxnmf3tydlmDuau p;u0trxnmf3ia1op  au o s trxoxm3oo1lm n iet t  Drmu  ;t4ope moetltls emn o u0aexnircoodom  liei s)t2to(m io4alte ietas)sDtmx  ou4tpt mieiyslsDeauvo (0trxnmf iadlpt lneol( t2uo(o ou4opte ivt s aDuax  ;o1tlto f3tat s2ranvsn(4aetnircoydlmDelues s  eum(r iy1ll nmnvsls  Duru pnt0oex mieiltls ulnvs u0tlerxfctotopD livi t0s2umxopnodalen icias)a2rmx onu4aetnmietldls eaump u)tltnxf3tatomDranvs t)seumxm3no4aleemicsl(faDrmumo;t0tex  i3iysfs uaumo;t4 leoxf iydfpD luvs ()setmimpnodolt mfctlt s2rmx p;u4oetomf3ilsfmDrln o t4 rerxrcio1oat  iei;(  2tm(mpoy4lpenmivilsf 2uaxrono0altomf3tytfmDrlnvs u0 etnir3tytfm raivo;()trtmirpoo4am   fvils srtmxr ot4openmi3iysfaDua(mo;(0 rxrmf3oa1lm eanvils0 etmiopno1altn fvtat)s2tmumoou4oeto fetasfmDean s;u4aeermfciodoa e u ols t2tr(o3iydllee ictatfaDraumo;t1oleomfciydfa2eanmsnt)artrirctodoaD  i olt srto(o io4alenmnesa(faDtr( oot4texoio3iysfm emnvsn()trtrxfciatlmDr uei t)t2trxr nodame  ietlt srtmxronu1tee ifetas sDrm(vo;t4tlerxf ootoptr i s;t)t2xmxrpoudoltelfvsl(fa2rmxro;t0texo f3iyt aDemnvsnu4trermf3iydlaD auesl()texo(o no4ll nmnvsls  Dtm( oou1apto ictlsla emnmp;(4teeomr tytfmDr i i s  rxoxr3iu4ale lfcs ()sDrru o;u4aex  oeiasfs eanmp t0tltoif3oa1lpD au s t setmio3no4amtelfcsltfsrra(m ;o1tlx ifciys aDranvon()alxrxf3oatfptrlnvslt0srxo(o oy1lmen fcil() 2tm(m ;u1aet ii3ildlm2emu p;t4 renxrciatfmt  ueil(0s2xm(o3nodom emfesas aDtrxmo;o0olt mo3ild m2rm(mont4alxnmfctydlptr n ilt  exr(o oodaptemfes t) Duru p;t4apeomiciltls rm(vo t0 rxrirciadoat  neo t) 2ur(m3iu4am elnviasfartrx  nt1oetoio3iytfa ul(vs u4altrif oadlpDeliesls0 exrir oydalenlfcias  Dtmur ou0oeeniictlt a2rmumon()aexnmrciadlmt aneslt  rxr(m3oy1ape liesls)a2tm(ro;u4aeen iciadlm rlnmonu0altoirciadop  an i;s)sexrxmpiydam  mnvtat) rtaurpot0apxnmo3tadlmDrm(vs;t0tltomf io1lm  lueslt0teum(mpno4lm elfcta() Drr(r ;t0aetnmicilt sDrl(vp;u0areomr iy1opDrlnei;s0 exr(opoo4apen ietls) 2tau oou4teen oeilsfa2el( p t4tetoirciy1optrli sls  rxm(m nodap   iesl()arua(rono4teenmf3iat s2rm( o;t0 lermocta1fp  livo;t texmir3ou1ope lfvil()a2tr(r ot4tpe if3tad mDuauvo u4 eermoctodoat auvil(0trum(r3nu1amte fesasfartax pot0teeoio3ilsla ra(ms (4arenif3tatlp elnvi;(0trtmim iu1lltn fvs (fsrtrx ont0tex  ietytfm2umnvp;t4altoio3iytfpDrln o;(0 rtrio3oodaltnlfvtat) Drru pnu0olxo i3tas s2rmnmp;t) etrif oadlmD  uvols  exmimpno1lpe lfcia( srtrx poo4aeto f3tatfaDraumo (4aexnifcto1fmt lnvi;s0sexoio3no4ll n nesls)arurx ont4oleoioctysfa2rm(mp;u0altrmr tatomtrli ol()tetmim iy4ame  ieta()a2ra( o;u1tlt  o3iatlm rl(mp t)trtnir io1lp eau slt0s2uo(m3nudlmte fcs s  rur(mpno1tpxoiieiytfa eanvp u0 eenxrcoy1oat  uvi;(  ruo(r3oudapee icsas)sDrmxmono0tpxoioctadfmDul(vp;t) lenxocoa1omtelnvs s)trtmim3oy1lmt mfcs s)a2rr(mpnt4oltomicildls2rm(mo ()tlxrmo iatlmD lies;s)tetmiopiodamee nvias) 2truroot4olx  iciatls ranmpnt)aleoxo3tadoa rauesls) eumxr3no1lptnmictl() Dumum ;o4oetoiociat m ra( s;u) rtnxf3iatomDraiei;s setoxmpiy4lmtelnct t srraxmp;t0altnmf3tytls2rl(mo;()trxrxf tatoptrau i s)setrxr3ny4ll nmncilt) rrr(ro;t4ope iiciad m2em(ms ()artrxr3iatfpDe neslt0setm(mpnydlmee fetasfaDrmx o;t0aee ifctldls rmumonu4tetnxf3iytoaDeanei;t) exrim nodal elnvils aDurx ono4aet ioeils a ua(ms u4 exoio3io1fa  aivo;s0t2uo(m3io4alt  fesat)srtrxm oo0oltoifeiydfa2rl(vo t)artoxoctytfmD  nvo t0 etoxo ou1op elnctlt)sDrmurpou0tptoiieildlm2el(ms (0 rxrir iytfa  aneols) 2tmirpoodom e ics s srta(rpot4opt iociatfa elu o t) eerxr oydlaDelivi;(0 2uoio3iodlp  mnvsl() 2taumo;o1ape miciltls rl( s;t0texoio ty1opD an o s) rxmiopiydol e ici t)a2taxro;t0tpxnioctad m2um( sn() eeoiociydlaDeli i () 2urxm iu1lptelieiat)aDtm(m ot1opt mociltfm2ul(mp;t) lerio3oydlmteauvs (0 eumxo ny1am  lfcia()s2rrum ;t1tpxnmieiatfa2ra(vp u4trxomfciodom r neo t0t2umio3oodomtelietlsf 2rax p;o4tltoifetyt mDeluvo;(0 lxnxocoatop e i olt)srtoiopiy1lp elfes t) rrm(mooo4tltnifciadlm2umn o u4tlenmrcoo1fp eau i;( s2xmxrpiy1al  lnviat  2ur( ooo0apxnmieildlaDul(monu) eermociodom ean il()setoxo io4aptnmfetatfsDra(mpoo1ole ifetasfa2rmumo;u0aeerxo3ta1la e uei ()sexoxm3ou1apen icsas)s2rmu o;u1olxo feias m2rmu s;u0aexomf oadfaDr ieo;()trtmxo iydamt  feil(f Dtrum oo1olen ieiasls2rlu on(0altoirciadomDr ivi;s) ruo(mpno4altnliesltfa2urxr ou4aetnio3tad a2eln p u)tltrio3ta1omt ai o ()s2uo(rpiu1ale livtatfsrrau o;o0tpxnif3tysfs2el( o (0arxoxo3oadlmtrlnesl( s2toiopoudlp  mivtlt  2rr( pnt1ope  fciltfs ulnvp t4 etoio ta1omt lieslt t2ur(r io1lmt licsasfartrxmp;t4teenifeiltfaDelnvs t4 leoxfctotlpDr uvil()t2trxm iy4ll emfvsas  2tr(rpnt1oexnmfeiydlm2uau p (4tlxnmf3oatopt  u i;s0 2trxo no1am   fvi tfs2rau oot4olx moeilslaDum(ms;u4 ltrir todfmt  ivsls) 2to(r3no1am e fesat artau oot4olen ieiydfsDemump u)tetrmf ia1oat  uvo;t  rtr(m3iy4al n iei (f 2rr(mpoo0aeeoifcildfaDranms;u0 eerif iydomD livols)s2trirpoo4ol  lictlsf rtm(mpou4tltnifciyd s2uauvsnt4artnxr3iydfp   nvs t seurxmpiu4ll nlfei s aruaxmoot0olx  ictysla ranms ()altnxocoo1fmDraues;s  ruo(opoy1ope mnes () rum( p;t4aleoio3tat sDrln s (0arxnir tytfa elivs;(0s2trio3no4opt mfcsasf Drr(m ;u0tpto o3iydlm2emumo u4 etnxf3ta1fptrau ils  exoiopiodapt lfvtltfaDuaxmpot0tetomo3iltfm ul(ms u4aeeoxr3oatlpteanvo s  rxm(o oo4lpeemivi s)a2tm(mpot1tpxnmiciysla el(vs u0arxoxrcia1fpDeanvils0t2umxopno4olenmiviat  2tr(moot0olt mo3iadla2rl(mp ()arenmfcoa1omD lu s t tetmim3nydaleemivi () rrax  oo4aeeoifciasfsDemnvo;t0 etriocto1omDrau i s) eum(r oodoleemfeiat) rurumoou0ape iiciadlaDumuvo;u0tetrxf3ta1fa e nvs ()setrio nodlpe mfvtat)arrmumoot4oet  i3iasfmDelump;(0trtoif3io1opD auvi;t t2urxm no1ol nlnctlt sDtaxmpnu0oet ioeiytfaDumnmonu4texrxr3iytlmDrauvi s0t2trir iy1lpe lnci ()artmx  ot4tleoio3tytfsDrm(vp;u0trerxr iotoptrlies;t0 2umir3oo1op n neilt aDurum ot0opt ioetydls um(vo;u4tlxnxo ty1faD lneo;(  2to(mpou4lltnmfcil(  2ua(m ;t4olx  ociys a2el(mp;(0 lxrxo3oydomDeauvi;t)srumirpio4olee icilt a2ta( p;u4openmi3ias sDumump;u)tltnmf iotlaD lu i (0trxmxrpnu4lp  lnvs ( aDtrur ;o1aeenif3ils m2emuvo u4trenmr ootlpt aieol()setoxm io4lmtn iesa(f rtaurp;u0apto oeiadla2rm(mo;t4 eenxf3tatlm eli il(0 ruo(opny1olt mnctlt)sruaxm nt0texn fetasfa emn p;(0artoxf ia1fmtraivs;t)trtrxrpoodlle lfcs s)a2trumo;t1ape ifetlsfs2umu p;u0 lxniocoa1lateau ilt) eum(mpiu4aleelfct sfsrrrx p;t1oetoif3ils s2ul(msn(4teenmo3oydfaDr u o;s s2xrir ny1lpe lfeil( sDuax  no0aexnifctlt mDel(vo u4aexomf3oatomDraivslt0 eum(opio1amtelfei (f 2umxroot0oex iiciat a2rlnvonu0 eerxo3iatomt aueil( t2uoim3iu4ol emfctas srrm(mp;o1ole  fciat m2ul(mon() rxrxr iy1fpDelues;s s2xrxm3oo1lme lietl(f Dta(moou4optnio3ilslsDemump;t)tetrmocoatfaD  u i s trurxr3ou4op   fesl(fsDuaxrp;u0tleoioctatfmDrmu o ()trerio3oo1lm rln sl(0trtm(r3nu1open nciat) rtruroot4tptniocildfm2raums ()texnmr3oytlpteai ils)t2toxr3iu1ap  lfvsatf 2rmu  nt0openioetat m2el(ms u4 rermr iatlpteau il( sexoxo nydll n iet (  Dra(mo;o4aee moetytla raump u) eerxfcoatlatr ueols0srxoir3no1apenlfei ( sDtru p;o4tpt io3iatfmDeanvpn(0trtnmr3oatfat an i s sexoxopiy1lmenlictat  2tau  oo0opxoif3ildfs ra(mo (0 etoxr oadlmD  uvs (  2trimpnu1lltnmfet s arur(  oo1ole  ieilt s2emn o t4trtomf3oadoate i s s)tetrir3oo1lpte nci ()sDta(mpot1tpxo ieiytlsDra(vpnt0aleoxf iy1lmDeluvi t0trxoxo3nodoltn ncs sfs2ur(m ;t4opxn i3iaslm rlu o;t)aetrmrcoodlmtr n il(0 2xoir3oo1altelncta( aDtrumo;t1aeen i3iltfa em(mo t4aeerxoctodfmt ln i t t2xo(rpnu1ameemfvtls)srtru  ot0aexnmoeiaslaDem(mpnt)tltrxf oa1laD  i sls trxmio ny1ll elnesatf 2ta(m ;o1apxn feiysfaDrlu p u) etoifcoytopDeaies;s)trto(o iudal  mnvtl(faDrrx o;o0apxo fetldfm uan s t0aexnifctatoa elnvolt0t2trxr io1ole mnesas) 2rmx  ;o0tptnioeiatls uau p;t)tltoifcoadlp eluei;t srum(mpiudapt mnct s) 2rmx pnt1alt ioctldla ul(mpn(0aetrxr3to1lmDr uvils t2xrxo3nu4om  mietasfsrrrx pnu4alt mfcilsla ulnvpnt4texoxr todlmDraivs s s2xm(m3iu4optnmivtltfaDrmur ;t1tlenioeiltlaDraump u)aeerifcoatla  aueo t s2toiopno4ol e ncsl()sruax onu0tlenmietasfmDel( s t0altnxrcoodoa rluvslt t2xr(o3iudol   netl( aDua(rpot0opx  oeiatfs ra(vo;(4trtomociadfp rlivs;s sexmir3nu1ame mfesas  rua(mp;t1tle  ietlslm2uau pnt)tetnmo3iydlp r n s;t)trxo(opou4al nlivi t srtru pnt1alxo oetldlsDum(ms (4arenxf ia1lptr ivo;s)srum(m3oodop n fesat)a2uaxmp;u0tlen icils mDua(vsnu) etoxf oodfmt anvols0srtrxr3no1ape mict s s2rrxmooo4aptomfciadfa2umnvs u0aexrmrctytfmtrlivo t0trxr(o3iodamt lnvs ( aDra(rpnt0oet mictydfsDrlnms t)arermr3tatfmtean i;s tetmim oydapt  fcias)sDrmumpoo1tlxn ictltla ranmpnt)aetrif3ta1omDr ueo;()s2xrxr3no1ol  lnct () 2raurono4tltnmi3ils s2uauvonu0trtomo3iy1la   i o t0trurio3nu1lmee nvs t sDum(mono0aee iietad m ranmp;t4areomo iotopD lu o ( s2xoxm3ny1ap elnct (f rta( p;u0aptn f3ilsfsDran snu)aleoio oo1lmteluesl()texmio oydalenlieilt  Dtau  no0tpeoif3iytlsDuan p;(0 rtrmr3oytfa rlu s;t0sexo(o3iu4ap n nesls a2rrur nt4opxo ictldlmDrl(monu4 lerxf3io1lpDeaivs ( t2xrxm iy4om  miet (fa2rrx  ;o0ale  octatfs eanvpnu0 lerircio1op  liei;s0tetoir oy1lme mfesltfsrua( p;t4tetomiciasls uanmp;u4aeeoircootlpteaneo ()setr(mpnydape mfeiltf 2umuro;u1oleoii3iatfsDean o (4 etomociy1fatrauvs;(  ruoim3no4opee fvsl(fs2trur ;t4alxnifetaslmDra( o;() eenif3totlmtrln i;t  exoio nodoltelfcsls)aDraxmp;u0apx ifcildlsDrm( p;(0 lenxfctotfpt  neo;s0srxmxr3nu4ll  lnvs tfs2rr( poo1altnmi3iatlaDul( s (0aeerxf3iadoatean o;()seto(m3oodomt  iviatfsrrmumooo0opt mi3tadfmDrlu pnt) exomf oydlmDrlu i t  rxoim oydlm e fesa()aDtm(r ;t0olx mo3ils sDrauvp;t0aexoir3oydfptraueol()truoir ny4optemnetls  Dumurp;o0tptn oeilslaDelnmsn(4 rerir3iy1fmD  u ol() euoim nu1lle  ieia( srrmxmpoo0altniieild m rluvo u)texnxf3oydlptrlieils  rurim oo4omte nctatfaDrmumono0teeo i3ils sDra(mp (0trtrifctatfp  ln sls tetoirpou4oltemfctas)srumxmono0alxn ieiytlmDemn p;() lxrxr3ty1omDrln olt0sexoir3ny4ome livi sfs2um(ront1opxn fciatls eanvo u4aetnxf3iydlatelu i t0trumio3io1apenlnvsat) rta(m ou4aetn feildlmDua(vp ()aeerxr3todlp  ln slt0srto(m oodalen fetl( a2tru ont4tetnif3iyt m2rm(mpn(4aetnifcoydlptr uesl( s2toim3io1amtelfet ( a2tr(r no1oexn fctytfa2ulums (0teeoxf oo1omteai i s)tetrir3oudop e ncsas aDtm(  ;u0alxn i3iyslm em( o (0arxrircoadfatelnesl()t2uoxr3oo1om elfeilsfs2tmurono0texomieiysfaDeluvsnt4texrif iatom r nvolt0 2xmxm ou1ol  lfcil( s2raxmont0texnii3tlt s2umu sn(0arermo iatlpD an i;t)s2umimpnodlm e nctasfaruaumpou1texn ociysfm2ulu pn(0teeomf3tytla e uei t0srxm(m io4lleemnvi (fs2um(mooo1alt iietasfsDrau p;u4 lerxf3iytfa raueil(  2xmxrpoudolen nvt t aDtrur ot4tpxnmoctatls umuvs u) lxomr3oy1omtrauvs;s0tetr(rpoy4am n ivtl()arrrurpou0olto oeiatlm2rm(msn(0aetrif3ia1lptr n o;s)tetoirpno4lp nmfcil( s2ta( ono1olxnii3tysfmDuanvsnt0 ltoiociytla elnvslt)sexrir nudllte ies () Dta(r nu4apeo ieiat sDuln on(0trtrxr ta1latrluesls0 2ur(mpno1am nlivi tfaDraxrp;o1tlenmieiydfa em(ms;t0 lerxr3iotfmDelnei;t0t2uoxo oo1lm elfet t s2umuro;o4aleo feiasls2ra(vp u4 lenif oa1fpD aivi;s0s2umxo nu4llte nvi s)aDtmurp;u4apx  oetlslmDulnms u0alxoxf3iydlpteaneil()trxoxo ou1ape mnci s s2urx  ou0aetnif3tldfm2em(mp (0tltnxf oatoa   ues (  exmim3ny4lm n fet s sDtmxmonu4tpen fcias aDumn s u0texnmf oadfmDr ivils)teumxo ou1openliesat)s2rm(roou1opx ifeiatls eluvon() leoir ootop   u ilt s2toim nydlleemfvi s a2uaxmo;u1apenifeias aDrm(mp;u0 exnir tadoaDrln s t)seumio iydlmenmfci sfaDra( p;u4opt  f3iyd sDumumo;u) lxnxr3oadop   ueo s sruoxm3nydole  nvta() 2tr( o;o0tpen feiytfm uan p;(0tetnmo oadfmD  u o;() exoxm oy1al n feil(  2ur( o;o1texnioctatls2el( p ()trxoiocty1op   n o ( s2trir3ny1ole lncsasfarrmx pnu1aeeoii3iytfm rl(mpn(0 rxriociydlp rau i s0s2uo(o3oy4amenmfcs tfs2um(mont4opt  fctas s rlu snt0alermf3iydlat lnvi;s truoiopoudlpe lnctlt)s2tmumpno0ole ifciadfa ul(vonu4arxrxf tadfmDrlnvi t srtmim iy4llenlnct s sDtrx  ;o0tex iieiydlsDuaumon(0texnmf3tatfpDeanvslt)s2xriopnu4olt lncs (f rraum ou1tptnmoctasla2elumo;u)texomo io1la rli slt0 exo(m no4altemfeiat sDta(m ;u1aeeoiieils a2rlums;u)teermfcoatfm  aivi;t sexoim ny1altemfesltf rrmxmp;o1alen ociytla2ul( s;(0 rxnmrcoydomtrlneol() rxrxr io1am e nct (  Duau p;u4oeeomf3iatlsDrauvs u)aexrif3oatfpt lnvi ( srxmir3oo1omtn fcta( sDrm(mooo4alx iictatfs2ulnvs;u) exnmf iotfptr nvs;(0setoio oodoltemncsas) rum(  nu4oee iicilsfs2ea(vsnu4 eenmrcty1oat lueo (0 euoxo3nudlleemfvtat  Dtrurono0tlx ifctltfm umn pn()aleoircto1lmDeau o;( srurir iu1apenlnes t aDur(m nt1aptniieiad m rm( s u0aetnmr oadfmt  uvs;( srurir iydomtnlnvsl(faDtm( poo1texn icildlm2ra(msnu4tleoxoctytop r nvs;t) etrxr3io1lptelici ( a2trxmoou0tptoio3iytfm2um(vp
\ No newline at end of file
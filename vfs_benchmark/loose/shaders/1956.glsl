@@ -0,0 +1 @@
+n olt0t2xoir3nu4optn ivtl( a2um(  nu0oeen ieias aDem(vp;(0arerir iy1faDe neslt)texrim ou4oleemnvsa(fsruaxmont1oeeomo3iydlm emuvs;(0 exrxoctodlp   i s s t2umxrpiy1omt mfetat  2rr(mpot1oet  ieildls2em(vpnu) exrir3to1op   neo;s)trtmxr3io4altn fciltfsDtm(rono1oetomiciydlmDemn s;(0alxnio3ty1fat  n ils)trtmirpiu1ape  fci s) ruaumpoo0altn f3tadla ra( s (4trxnio3oy1op  livols0 euriopiu4lpe mnvs s)sDum(m nu1aeenmf3iytfsDrln on(0 eenxo iytlp e nvslt srtmiopio4lm n nciat srtrumo;o0apto i3iysfm uanvont4 ltrxo3oatla eai slt) 2umxr ou1ap  lics s aDur(mpoo4oex mfetls s2eln p u4 rerxrctydlm  lnei;t) rxr(r nodlle lfcs ()srrm(mpnu0opt  i3iydlaDel( o;u) eeoxfcoa1fm e ueils0setoio3nudaltnlnei s a2taum oo4oexn ietydlsDeanmo u)arenmfctydfaDrli o;t0trtrir oodlltnlfetl()a2tr(m no1apeo octytfs2eau s;t0tlerxf3iodlateau ils) rxr(mpoodolt lncia()a2ua(mooo1texoiociltlmDrm( s;u4 renxoctytomtr nvsl(0srtoxm3iodlpe mivt (fa2uru p;u1oeeo ociatfaDeln pn(0tltrxrcoadfmt ai s;s s2urxm3oudapteliei t)srrau  ;t4tptomo3iysls rl( on(4aeeomo3iadlaDeaneo (  2xoxopiy1opt mneslsfa2rr( p;u4oexoiietatls ea(vp;(4alxnmo3ootfpteln o t0 exrio3oodapen fctl(fsDumxmo;u0olenioctad a2eanmpnu0 etnir3ootom eau i;(  exoxmpio1omeemivsa(  2tmxrpnt4aexo feiltfs2umu p;t)alxrircta1opDeauvolt)truo(o iudole livslt  rurxro;o0tpen i3ildls2emnmont0alxoif3iotopt lu s s)trtrxo3ny1lm nmfci sfa2ur(mp;u0tlt ifetat s rmn p;u4tlerifcoadfpDe u ils)trtmio nu4op  lnes tf Dtmur oo0tlxn f3iytfm2eanvp;t0 eenmrcoytfmDr nes;()setrirpiy4omeemiviltf Dtrxr no1aex if3iadfa uanvs;t4tleomf3oodfmtrauvil(  exrir ou4al emneia(f Dra( p;t4apt  ietas mDemu onu4arxoif3tydoatr uvsl(  eto(mpio1lm emfei tfaDra(  ;u4opxnmoeiatfs2umnmo u)tltoxf3oo1la rauvo;(0srtm(opoo4lpte fcsl()sDur(mooo0altoiieiatfa eln s (0trermo3tydfaDrai s t) eurio3iy1altnmnvia()srrmu ono0tlx  feiyslaDeaums;()aetrmo3oa1fptelieilt) rtrirpnu1amt  nviat) Drmumonu4olx miciyt s2eauvs u0 ltomo3tatlpt auei s0texmxo oy1alt  iviat)s2trumooo1tee ii3iydla2umump (0 lxomfcta1fpDraueo s)teto(opoy1ol   icils)arrru poo1alt mocils s2um( sn()alerxf3oatlmDe ivslt0s2tmxo iu4omt lfcia( srrr(ronu1olt ifciytlmDrlumont)alxrmf3tydopD luvo () 2xo(r iodllt lnvs sfsDrm(  nt0opxomfciatfs2ra(vp u4aetomo ta1lmDeaivils s2uoxm oo1llen ici sfaruau p;o0oeen o3iydls2rmuvs t4 reoir3to1fmD luvil(  2uoxrpiu4aptn neslt)arrrxroot4aleomieiytfmDeau o;t0arxrmr3to1omDean i;t  eur(rpoodap elfciltfarur(mooo0ape ioetlt s2ulnvpnu0artnxr ty1fmD luei;() 2umio nodameelnct s) 2um(r ou4opt ioeils aDel(vo u) lxomo to1fm e i ils) rtoxmpoydlpe licta(fs2urxr nu4tpenifeildfs rmn p;u)aeeoxo io1lmDr n sl(0s2uo(r3nu4lp  liei s) rta(rpot1aleoiocildla emnmo t)texrxrcoy1lp  au o s srxmxo3iy1am nmfci sfa2rmxr ;t1oleo i3ilslm eaumo;(0trxrxrcoa1fa eaivs;(0s2uoxo iydomte nvt t) rua(r ou4alt mietatfsDuln o u0 eeoxf3oo1lm  lneo s0texoxm ou1lmt lieslt s2uaxrono4tpto ictytfs2um(msnt)treoir oydfm e i s (  etmxr nodaltnlivs tfaDtr(mpnu4apx ioeiatfs2umnms;t0trtomr3oatoatrln o (0t2toio iu4lm nlfct tf Dum( o;u1tpeo ocias a eauvp;t0tlxomr3tytopteanvolt  rtmiopno4oleelfvs t)srum( o;t4altoiocils s rmumsn()trxnifctydomtraneslt  2um(o3nu1op n fetlt)aDraum nu0aeenmf3tydla el(mont4treoxo oadlpteluvil(0 rur(o io4omtelietltf Dtaxro;o1oetomicilslm rluvon(4 rtrmo todomDrlnvi;s0 2xm(r3oy4oleemfctatfsrtm(r ot0tle  i3ias m ul(mpnt)tltomfcoa1la e uvo (0 etoxo iu4ll  mnci sf rtrx  ;u1tptoii3tyt mDrmnmon(4teenir oo1fa   iei;( srtr(mpnu4oltnlfvsas)s2rr(mpnu1tlt mi3tyslsDemuvont) lenxociatfpDeaueilt0 rur(o3io1lm emfeta(f rrrumo;o1tleoiictldfmDumuvs u4tltomrctytlmDrlu ols)srtr(r3no4ameelnvtasfa2urum oo1tet mocilt a uln o;u0aetomoctadfptr u i;s0srxmxm3iy1lp  liei (  rurx onu4apen octasfs rlnmon() eermf3oytfp r neil(  rumxo ou1lpenlfesa(fs2rm(rpnt0ole ifcils mDum( s;t4alerxr io1om  aueilt setmim3io1amtelfesa(  rrrumpnu1apto ictat aDrln pnt4 rxrmf iodlm   u sl()texmim nydalte fcslt srrrxronu4opxn feild a2ul(vonu0arxoir3ootfmtrli sl( t2uoirpiydaltnmnet (fs2rmuro;t4aex mf3iad m rl(mo;()altnxo to1om raies;()texm(o iu4ame  ieiltfsrrrumo;o0tee mf3iys m rl( s;(4 exrmo iy1omDeau olt0teurxopio1al  mnct () 2taumpou4alxnifetlsfa2rm( s;u4trtrxfcto1oate n il(0tetmimpiydoltemfvia( aDtmxmp;o0opx  i3tad a rauvo;u)treoxrctodfat anes s0srxmio3oo4lleemncslsfa2rrx o;o0opeomietasfsDeanvs;t4aeenmf3totfpD lneils) 2xmxr oy4oltemfeilt a2trumono4olt  o3iysla2umuvpnu) rtrxr iydomD li s;( t2urxm ny4ap nlncs s) rtaxroou1apxniietatlm emn s u0 renxf3oa1lpt  nvs t)seuoxm oo1olenmnvsa(fs2raumo;u4apxo fetysls2ran sn()arermr iadfpD  uvs;s setr(opoo4llt mfet t arraum ;t4tlenif3taslsDra( p ()tleomo tatlmteauei;() 2tmxm3nu1op nlfcsat)srurumo;o0olxomf3iatlaDulnvo (0trenir ta1lmt  u olt teum(rpiu1apee icia(f Dtmuro;t1aex  oeias a el(mo;u4tetnxf3tytfa  lneo;(0setmimpnu4ope livi sfa2tmumpoo4aexoiieiasfaDua(mo;u0 exrir3iotfmteli s;t0 eum(mpiu4ap  lneia() 2rmum ;u1aexo ieiat m2rmnvp u4altnmf3oatom  aivol()seuo(mpiydoltnmfct ( s2rr(ro;u0alx mo3tatfa2ra( o;u0 exomo oo1oaDe n ilt0t2urir oudop n neta(f Draum ;t4alt mf3iatls rl( p;t0 ltoxr3iotopDrau o;t)srxmxopou4omt lfet s)a2rmxmpoo4tlxoii3ils a2umuvo;u)trenmr totfateanvo s seumim nydll elieils) Durxm nu4tltomf3iatlsDum( pn(0aetoio todop  anvs;(0 2ur(r iu4llee feslt aDurum nt4oexniicildfmDem(vo;u) renio oatfmtelneol(  rxoxo3nydap emnct ( aDtaumo;o0oex  ocilsfm em(vo u) exnxo ootfaDe ieol( t2toxm3iudom elfeiltfsruax  ;t4alenmoetadls umnmon() rtrmf3ia1op e u s s0srtoxopiu1olt mnvi (f 2tmur ;t1tleoiiciydfs rauvpn(0 lxnmf3to1la   ivil()s2trxopoo1lpe  fci (farrrxroou1tpenioeiadla ran p u4areomfcoydoaDeaivs t)trxoxm oy4llte ieiltfa2rrxm nt1apx mi3tadls2em(vo (4 reoxr iadlpteli sls0 2xriopoudopeelivtls a2tr(m oo0aex ii3tadlaDuluvont4 ltoxocoatlptrlu ilt0s2toxo iu1lptnlnvilt  ruaxmo;o1olxnmf3ils s2eauvon(4areoxo3todopDeanvo ()teur(mpio4aptn ict (fs2tmx oou1tetnioetatlsDua(ms;t) rtrif3oodlmteli il()trto(r no1lpee icsltf rtm(mpoo4tpxomoeiyd a rl(ms;t)alenio3oadoa rlnvsl(0setmxm oo4olee fcsasfsDurxrpoo0altomf3iytfsDumu onu4 etnio oatfmte nvo;(0 2trir ny1ll n ivsls)arumx pot0oetniieiaslmDemump;t4 rtrmo io1optelieo;t)sruo(m3oy1apeelnvtasfarumu  ou1apxnmf3iatlaDemu p u4 lxrmociydoa eauei t0teum(r oy1lpen fcils a2ta( o;u4ope ioctyd m2eaumo (0tlxnifctydla elu s s0setmxopnodamtnlivsa()sDrrxrpot1oetoiictytls2raump;t0tleoxf3oytomteluei;t)s2um(mpiudap   fetatfsDrmxro;t4tpeoioetyt a el(vsnu4trtoxfcoytfmtean o;t)trtmxrpoo1al  lnvsl()arumxr ot1altn o3ilslsDum(mo;t)trxoxrcta1la eliei s)texoim3iy1am  lnei t  ruax pno0tpxnmf3tytla rm(mont4 reomr iytlp  anes;s) 2urxr iudal  lietas)srtr( poo4olenif3ilslsDem(vs;u0 lxrxf tatomt  uvo;t  rto(m oo1lltemfei t)arrrumooo4oetn fcias aDumnms u0tlxomrctotfmt luvo;(0sexr(o3iy4lleemfvtlt  Dtauro;t4apxn i3iadfaDemn s (0aetomo io1fp rlnesls s2umir3oo1op n ietat  rtm( pno0aptn f3tyd a ra(vo u4 lermfciodopt  u i;s0texoxm oudapt lnct ()sDta(  ou0apeomoeiytfa2rmumpnt4tltomr3oytoaD  uvols) 2xr(r nudomee ivsa(f rta(moot0teen oeild m rln p t0alxomf3ta1lmDelivs (  2urio3nydolt lietls s2tmxm oo4teenmf3iyt a rau s;u0tltnxo3iytlptr nvo t)srxmio ny1optnlfeils srumxm ;o4oexomociytlsDemuvs t0 eerxrcoo1lm rln s ()setoxo3ny4ole lfcsatfa2uau pnt4opxnmieildfa2rmu p;t0 lxnircoodlatranei t0trurim oo1amen icia(  Drrurp;t1opx mo3iytls rlumo;u4 eerxr iatoaDeanes t)s2trirpno1optn fvtat)s2tmurooo4aeeomocias aDrl(vp;()tetnmf3iydfa e ueo;s t2uo(rpoodome mivs sfaDtmurono1teen ieiysfa rl(vont0arerifciodlmtraies;s  etoxm3oy1llt lfcsa()a2uax o;u4alxo ietltla2eanmo t0 ltomo3oodomDrai s;( setm(r3ny4am elies s artru onu0olenio3iysla2ra(vp;u)aleomfciatop  au il(  2xo(m3io4lm nlivtl(  Draumont4tle if3ildfa umnvo (0alenxrctadfa raneo;t truo(opiu1lpe mivsls)s2rm(ro;t1aleo fciltfaDra(ms;()tlxnxfctadoaDe i il(  rxoio3nu1ap nmnci sfarurxroot4aeeomfciydfmDea(vs;u0arenxfcoadoatrlueilt t2tr(o iy4ap  livslt  2tau ont1tle iiciatfm eanmo;u0alxoirctotfat au ols0srxrir iy1opt mnesasfarta(rpot4ope ifeiydlaDuan p t0trenxf3iatfa rai i;s t2uoxm3io1ll nlnesl(f 2rax pot1oetn fcild m2em(msn(0 exrir3iatlmDrlnvolt srtmxm3oo1apee iet t) Drm(rpot1apto i3tyt sDumn o u0areoxr ta1fp raieo;( texmir3no4om e nvt sfsDtmuronu0aex  iciatls2raumpn()alxoxo3iy1op eai i;(  2uoxo oodamen ictlt)a2tr(ronu1tetniociad a uaump;(4trxnmf oa1om eai il(0 rtmxo oo4om  micslt)a2um(r ;t1alxomoeilsfs uanvs t0teeomf iotfateanes;(0texo(m oydol  lfcsa()srum(r ;t0alenmiciltls ea( o ()arxomr iydlaD anes;t0s2to(o nodap nmfcsas  rtm( ono0tpt  iciyslaDrmumo;() eermo3tatlat  uvsls0 ruo(opiu1ole  fvsl(  Drmur ;o0opxnmfcilt a emump t4 exomo3iotfp rln olt  exmimpnodlpte iei tfsrta(  ot1optoioctad m2raumonu4areoirctatlaD luvi;t0 2toxrpiu1am  mfeil()aDumx pou1apxo ietytfaDea( s (4trtrxr tydlmt luvi;t0srurxrpiudll n neiatf Drr(m no0ape  octld a umums;(0 exnxfcta1lptelues;s  exo(opnudolee fesa(fsDrrx  no0oet if3iasfa2um(vpn(0 reomr3todoatelu i;s0srtr(o iy1am   nvt t)artax p;u0olxn ieiltls umu pn(0arxnxr iy1opDraies t)tetrim io4lm n ivt t  Duaxrp;o1aexnmietasls rluvsn(0tltomf oatfa  li slt  rumir3iy1optn fcslt  ruauroot0alxn feild s2ea(vpnu0 exrxocoatoaDeaivs ( trur(r oo1apee netlt)aDtmurp;u4oltnif3iydfs rmnmp t) leoircoydlat auvo s) rxoxopnodoleemivi s sDtru p;o0optomf3ilslm uln o;t4arxoir iytopte n s s) etr(m3nydaleemfetasfaDtm(rp;u1aex ifciytls2ran pnu0teeomfctytfat livs;t s2uoirpoy4lltnmfcil()srrr(mpou4optoioeildls rmuvp u) lerxf oadlmD auei () 2trir3oo1ll   ivs t)a2tau  ;u1ale moeildlm2uauvs u0 renxociatfm r ies;s t2urxopoo4lltn nvtltfaDrmurp;o1tlxnifeiatlmDelumsnu4 rtnif oa1lm eaieolt t2xoir3io4lm nmfeiltf rtax o;t4optn fetydlm2ra(vs t4 lenxr tatop  au i;(0t2ur(o3oo4op n icsat a2ta(mp;t4tptnii3iytfs2rauvp (4teeoir oo1la  luesl(0trurxm no1am n fvtls)sDuau  ou1tptomi3tytlaDrl( o;u0arenirctytfp e i o;t sexmxo io4ll  lnctas srtr(mo;o0oee mfeilslmDel(vpn()trxnmr oydfm  au s;s  rxo(o oudameelieias  rrrum ot4tlenmf3tyt aDrlu o t)trxoio iydlpD luvi t0s2xrxm3iu4llt  ivsas  rrmur no4teenmociysfm2ra(mo;t4aexnmr io1la   neo;(  etm(m iu4altnlfvtasfaDua(rp;t0alt mfciydfmDuau p;u) lerxf iotlp rlnes s)t2um(rpoodolenmncia(fsDtmx  ou1oltomiciysfmDulnms ()texoxocoatomtranvi;(0srum(m3ny1alt lfet t) Dur(rp;o1aet mieias sDrm( snt4 ltoir3oadfm  au i s setrxr3nudape  fes t)a2ra(r no1altn fciadfm2um(vpnu4 lermo oy1omDr n o;s)srxmiopnu1lmen nei s  Dtm(r ;o0texomf3iatla umu snt0trtnirciytlatr u i;()setoxm3nydllt lnctls)a2tax  oo0tetnii3iadls2uanmo;u) ltoircoodfpD an i;( srtrimpio4op elnvs sf 2ra(mpoo0opeomfciat s2ra( o t4alxrir3iotfa e n sl()tetoim oy1al elicsasf Dtrurp;t4tltoifctysfsDrmnmont) eerxo3io1om e n ils  rtrimpoudll  lneias s2trxro;u1apt mo3tasls2ulnvs u4trtnirciy1oaDrlues s s2xoxm oo1ol emfetltfsrtm(ro;u1alt  iciysfsDrm( s ()texnif3tadoa  lieo t) eurio oudope mictlt) Dumx pou0aptn ictyd m ea(vpnu4artnif3iatlaD au ol()tetoxopiodaptemietl(  rtaxrpnt0aptomf3tldlm emu s;t4areomfciydfaDeli i s)sexmirpio4lmenlictat  2tm( pou0oltn ociysfa2uan o u) rtnxo3oo1omDrlu ilt)srtoiopny1omenmiet tfa2umum ou1oee  icilsfm2ra(ms;(0 rxomfciatlmDr ueils s2um(m3iu1lme livt s) rraxmo;o4aptn fciyd m uanmsnt0trxrmo iydfatr uvi (0 2xm(rpiydopt mnvi tfa2urxmont1alto iciys s2rlnmon() etnmr3oydfmDe nvil() 2um(m io4lp  lnetas srrmump;t1tpeomfciltfmDul(mpnu)tlxoif3iy1lpt aivi;(0t2umxrpnu1lpeemnvslsfa2tm(r nu4oexnii3iat s uan s;t4arxomo3iytop e u slt) exoxmpio1lm  licilt a2rr(ro;u4tleomo3tatfsDea( s;(0aexnir todfpDrauesls) exoxr nu1lle  ieiat)srtmurooo1opxn fciydfmDuauvon()altoxrciatopte ieilt) 2uo(m3ou1alt liet sfs2tmxmo;t1ape  oetad mDea(mp (4alxoif oa1optrlivi s0sexmio iu1apt livil() Drr( oot1tlx ifciyt a2rl(vo u4 lxrmr ty1optrlies;s)t2tmir iudaptnmfvt tfsDuaumpoo4tltomfciatfs2ulnmp;(4tetnxr3ta1fp  au o;s)s2xo(m ou1am  lnes () 2rruro;t1olto ocias mDrmnvp;t)tltnxf3todomD ai sls srumxr io4am emnct tfsrtr( pnu4alen oeiydlsDuluvp (4aetoxf3oadfm elnvsls) exrxmpnydamenlictl( aDrmxro;o0tex mf3ilsfm eanvs;u0 etomociodop eaneslt s2uo(r oy1alenlicias)a2rmur ot4tlxo oeiytfa uanmp;t0 etrxfcoa1laD an o (0texr(o3no4olen fct sfa2trumont0apxoioetasfs2rauvo;t)texoif iydomte nes s) 2uoxopiydop  lnct t srtrx oou1alxn f3iytfm2emnmsnu4tlenio3oatopt  nvs s0teur(m3iodopt  fct t srum(mo;o0olxoii3iys m2em(vs t0trermo3iadfatrlivols0 rtm(mpnu4aptnmivt (fs2ur(m oo1tpenmfeiaslmDel( onu4 exoiocio1om   u o;s0s2toxrpiudomtemnctls  ruaurono4oexnio3tlslm2rlumo () lxomo oy1fptelu o ( texmio oodap e ivsa() rururoot0aexo oetlsfmDumnms;u4aetoxf iatomDeanvol(0 exrir nodal nlivtasfarrax pou4oleo f3iltfsDul(mo;(4tlxrir3oa1faD anvi s0 rtoxrpio4ope  fvsls  rurxrpno1alt  ictyd a2raums t) etnxo totfatr nvs t srtoxm3io4al n fvils)s2uaum ;t1tptniieiatfm2rm(vpn(4 etomr totla  lieo;t sruoxm ny1ol emietltfaDumu o;o4tpxnmo3iydlaDrlnvont)trxrif iotlptrau s;t tetrio3oo4aleelivils) Dururpno0alenioetytla uan pnu4 rtomr3tatfp e i ols)trtr(o oo1ome licsl( sDum(moot0optnmf3ilsla umnmp t4 eeoxr oytlp eau ils)t2toiopiu4lptnmfctas srur( oot0alxo f3iydfa2elnms t0 etomr tadop eauvslt teumio3oo4llt  nvia(f Draxrp;t4alxniieiydfs2ra(vo u)aleomf oadomDelnei ( teurxr iu1lp e neiltfsDraurp;t4alenifetat aDuln s;(4alerir iadlaDeln o;t  rtoxm3oy1op n iesl()arra(moou4aptn ieiadlsDumu o;t)altnmf io1oat  nvs t0teumimpiydlltelncsl(  rtr( o;t0oee mietlt a umnvo;t)aetnmocia1oa r ueilt)srxoxr3iy4lm nmfctlt sDtax pot1alxomfeiltfm eaumonu0tlxoio ty1lmtrlu o;s  exrxrpio1al  lncsasf Drm(m ;u4tptoifctldfm2em(mo;t4 renmfcio1oaDr nei t0t2toim oy4lp   ivsl(f Dtru pno1tptoiiciasfa2rmn s;u0trxnxf oytomt  ieols)tetmxmpou4apeemfcsls  Dtax  ou0tlxoiocild a ra(mo;u4aetnmf iydlmt au o s0 etr(o iy1am nmfesat)a2taxr oo1olx  o3ias m el(vonu) reomo3oa1fp e uvolt0 rto(o oudlm emicia() rrrxmont0apxn ieiasfm umu s;t0tetnmf io1fm eli o;t s2trxo3ny4lpe lfcta(fsDurxroou4texo i3ils mDrmu s u0aexomo3totoatelnvi;( srtoxopiu1lmenlfcils artm(mpou4olto iciyslsDranms;(4 exoir3tadop  auvol()teuoxopio1lm elnvslsf rtm(r no4tee  oetyslaDemuvont)trtrxrcoodoa e iei;( trxmimpou1omtemfviat  2urx p;u4tpe  oeild s uluvs;(0 exnir iatomtrlivs;t)t2toxm io1lpeelnvil(fsrurxm ;u1ale  oeiys aDrm(vpn()aeeoxfcio1lmtr i sl()s2xoxmpoy4aptemncsa( a2tmx  ;o0oeeo octydfm ran sn()artoir3oo1lmt  uvo ( seum(r3iudop nmietl()sDraumpnu0alxn ieildlmDemuvpn()artrxfciatla eli i (0s2uo(o oy4amt  feias) rtmxm ou4teenif3iydlsDua(vpnu4teenifciytlpDrlnes (0 2uo(r3io1omeeliciat)sDrm(rpou0oet  f3iydfm2rl( o;u4artoirctotoa eai o;t) 2xo(mpoudllte ivtl(fsrtaum nu0altnmi3iltfm2eanmo t4trxoxrcootlm r u i (  eumxr iu4lm  lfei t s2ua( pot4oexn fciysfm2eaumon()alxoxf ta1laDraues;(  2xoxo3no1oltelicslt)s2urxr no4apxnmociys a umnvp (0trxoxr3io1oat anvs;s0teurim3nu4omen nvi t) rtmxr ;o4olx mictatlaDeau pnt)aeerir oo1lm  ln ol()sexm(o oo1lmenlnct t  rumu  oo0aeeo f3iytls ea(mo;(0teeoifcoy1op  luvs;()s2tmxr3nydom  mfvsl()aDuaum ot4tpxomiciad mDrmnvo;u) etnxrctotfp   n il(0s2uoxm3ou4lmtelivsa( srrr(  nu0apen f3iltla eau p;u0trxrio3tatoptranvol(  euo(r3no1om emnctas artaumo;u4tex ifeiad a2rl(vpnu) eenmf iodoat  ivs t  etmxm oy4lmeemfvsltfaDuru pnu4oetoioeiatls2rauvsnu4 eeoxf oytfptr n il( s2tmxmpno4al  mnesa( arurx  nu0oexomicils mDeanvonu0 rtomr3ty1lpt lu i;(0truo(o nudal nlncsat srtmx  oo1oee mi3tad mDeln o;t4 ltrxr oadfmD lueils0texoxmpiydale mivi () rtm( p;u1texomo3iltls2umuvpn(0 rxoxo iotfmtr nei (0 2urir nu1lmtelfei tfs2rrxmooo0ole  oetaslm2ra(ms;t4aexnioctotlateluvs t  rxm(m3oy1om n ies t) rtm( pnt4tltnif3tlt s emuvpnt4 rerxr3iotfat  uei;(0s2urxo nudamt mfcsasfaDtrxrp;u4tltnif3tld aDumnvs;(4alxrxo3iy1op r nes s s2urxo oo1omteliet tf 2taxmo;t0teeoio3ilslsDulnvp u0 exnif3oytlaD ai o;t0 ruo(m iydom n ivsls) rtmx p;t1ope moctltfsDuan o;t)arxnxfciydoat  ivs;s) rxmxrpny1lpenlfcsasfsDuaxr nt1tex  oeiyt sDea(vs;(4 eenxo iatfmDr iei;s t2urxm nodaltemnviat)s2umxrpnt0opt ifetyd sDul( p t4tleoxo3oodoaDran sls0 2xmim3iy1op emieia()s2tmu  ;u0tlx  fcild m ulnvs (4tltrifcoytfaDeauvol(0 rto(opno1lltn nci () Dtmu p;u1oee mf3iltfs um(msnu4areoifctodopDe n ils0trurxmpny4lp nlfcslsf Drr(m ;u0optn o3iysla2ulnvs;u)arenxr iotfmte n s s0t2xo(r3iu1lpen fvia(  2rrxro;t0oetnmo3iatlm2ulnvo;(0texoxo3to1fptrlneo t)s2tmir3nudamtelfvilt aDumxm ;t1aet iietys a2eluvp;t0artnxo3tatlateauvolt  rum(o nu1llen netlsfs2rrumpou1oexomociasfsDea( p;t4 rtoxf ootop eanvo;t0 2um(r no1lpte fvilt)sDtauro;o1open i3iadlaDelumsnu) rxoxrcty1lm  aneo;s0tetriopoo1ale lncsas)a2raxmp;u4texomietltlaDumnvp t)tlenxfcta1optr ivi s0 euo(r3ny1lme mfvilt) 2uaur ;t4olx mi3tatlmDeau o;t)teenmo ootlp  li i s0srur(o3oudlltnmicias srrm(ronu1olt ioeiad m2eauvs (4 lxoir todoaDrlueo;t srxrxm nu1ol  lnes (fsDuaurp;t1apeomietydfmDrl(vp;u0tltoxocoo1la   nvo;t  2xm(m iu4lpte nes () Drr(mont4olenio3tadlmDem(mo;(0texomo3to1fmtrau ils0 eurxrpnu1amt lfvt t)arrm( pou4opx mf3iasfm uaumont)alerirctotfa e neil()s2umxm3iodomen ics t aDrax p;o4texn feildfm2uanmo;u)artrxf3io1lmteau sls0s2xm(r3iy4lmeemnvi sfaDumxrooo4opeomf3iyt a ra(vo u4tltnxr oo1oa elieo;() rxmxo ou4omeelnvi s a2tauro;t0opeo feiltfs emnvont0teerxf ia1lp r n ol(0s2xmirpoo4ll e fvt t aDumurpnu0tlx mf3iatlsDrmuvsnt)altoif oodfaD lu s;t0teuo(m3no1openmfcs s) 2rr(mpnu0aex iietatls2rl( o t4aexnmfctodlmDe ueo s t2urir nydlp   fcilt)aDtmu  ;o4tlxnmieiad mDuanmsn(0tlxrxo tatoa r u ols)s2xmimpnu4open ncta()aDua(mooo4tetoioetld sDelnmp (4aexnxfciotfm elnvi;s)s2uoxo3iydlpeelnvsat)sDuaxm ;u4optnifetld a rln pnu)altnmrcia1lpDr nvs t t2uoxrpou4aptemncsl(  Dumum ;o4oex  feiytlm2uln pnt4 rxrxf to1opD ln s;s t2tmim3iu4lm  lfvsas  Dta(  ;t1apxnifcild s2el( snu4aexnio3ootoaD an i;t)truoio3no4lpe lfviasfsrra( pnt0texoif3iad s2ra(mp u)tleoxf3oatlmt ai ol( trxm(rpoo1amtn ivs sf rumxmpno0ape mietyd aDul(vp t4aeenxfcoo1lmDeln o;() rur(m nodap  mfei s  Dra( onu4tltoioetld mDua(vpnu)teeomocto1lpDranvs;(0 2uriopnudape mncia(f Duaxr ;o0aeto i3ilsfaDea(ms u0teerxf3oadlatran i;t0 2xr(o3ny4lpe mfeias) Dtrumpou4tpxniiciytlm rlnvo t) rtoif3tatfm   ieo (0srurxr ou1omen neilsf 2ur(rpno4tpxnmietlt mDum(ms;() lermocoodomDelneils  2uoxo io1al elnct ( sDtaxm ;o0opx mfcilt sDum(vs t4trenif oadoa   n sls0t2xoxr no1ome mivslt s2ua(ro;o0apxnioeilsfm ra( s;(0arxrir3oadopDrai sls  2um(m ou1lmt  fctl(f 2tr(rpnu0open fetls sDemn o;u4 rtnxf3tatopD auvs;(0seumir iu4aptelivsa( arta( pnt4tle  feilslm eluvs;()texrmfctodfmDrlnvslt0seur(m3ou1llenlivi t)arrm(r nu0openmictydfa ea( s u)tleoio3totopDr i ils  etoxo ny4ape livi ( a2ra(  ;u4apt  ieild s2elnvp;u0 rxrxocoa1fmt lu ilt) exmimpiy4lptemieilt)s2ua( o;u0aet moeiydls ua( p u0 rtrir iytlatran o;s trumxr3io1opeemnetasfs2tmumono1opx  i3tydfm ua(vpnu) reoifciodlpteaieo;s)seumir iydoptemivsa(farrmu  ;u4opx mfetadfa ea( p t) ltoir oodfmt lnvs t0srtrir oo1lm eliei sfartmxro;u4texo iciadlsDumnmont0aexrif3iytfpDr ivsl(0texo(o oo4op   ivsltfsDrru  ;t1tpt  o3tytfm um( sn(0 rxrmf3to1lptr uvol()setoiopoudopeelnvs (fartmumont4tetoiocilt mDemnvp;(0 reoir3iodla   n i s0trtoxm iodlpt  fetasfa2rm(rpnt0aetoiicildfm2ul(vp;t) ltnir3totoa r uvs;(0texmim iydlpt mnesls)srum(r oo0oeto fciatlaDrm(vs u0tltoxo3iydfpte nes s) euo(m3oo1optnmiesa(fs2ta(mp;t0tle iiciltla eln snt) leoircoy1late ies;s)texoirpoudlp elnetlsf Drmumo;o0oleoioctls a ulu o t) rxrxf tytopDrlnei t  rxoxopoudol   fct s) rtrx o;t0tle ifeiad a2rln s;t)trxrmfciadla rai o;t0srumxmpiy4ll e nvilt) rrmum ;t1opx ioeild m2el( s t)treomr3oatfm   ues t0trum(o iydll emncs s)a2trxr oo4tpx  iciatfm2rm(mo;t4 etoif3iatlm r nes;()seum(r3oodlp nlnes (  2ua(mo;t1alxnmietas mDemuvo ()tetomf todop elu o s0trxm(o ou1lm elivils  Dur(mo;o0olt ifetad a rlnvp t)arerxo3io1op   ivolt)srtrim3no4apen neias)arrau pot1aexomo3iydls2uau o t4trtnxr iydlpt ai sl() rtrxopno4llenmncslt aDtmur ;o4oet iociadlm uanvp (0aexoif oodfm rai o;s)seuoxr3oo1llenmfes s srrrurpot4aptnmf3iaslmDrlnvo;()alenxr3ia1omDe u i s trxoio iu4ll e ncils)s2uru  ot4apx iieils s2ua(msn()teerioctadfmtrln i;s) euoxo3oydlpt mfvt t)sDra(ront1apeomfeildfs2elu p;(0areoxf3oadla  livolt t2um(o oy1alte fvs s)aDrm(ro;t0tle ioeiasfa2raumonu)areomf3totlp eau s;t0truo(r io4op  lfetl( sDua(mpnt0olxnifeiytfsDraumo t) ltnmr3todoa   nvo (0s2xmimpnodolt  nvils) Dur(rpot0tptomfeiad m rln p;u0teeoxrcio1fpD  ivsls srtmxr3nudamt mnvsl(farumx pno0tlxo oeildfs uanmp u) lerio ta1fpDrlnvo t0setrir io4omtnlieta(farrm(mp;u0apxomf3iaslaDrln snt) rermr3iadlpt aueol(  rum(rpiudaptn ncslsf 2rm(rp;o1oeeomf3iltfm2rau sn()arxrxocia1lpt ai i;t0s2uo(rpou1omt lfesa( arum(ronu0tex  feildfa ea(vs;t4trxriocootfm rai ols trto(o iu4amtelnet sf Drau o;u4olxnmieiydla ul( ont4aeermr ty1op  ln o;s t2trim3oo4ope licsasf 2tm( pno4olxnmieiadla ea( snu0trtnmo tadop eau o t) 2xo(opnudalee ivs ()srrr(mont4optn ociltfmDuanvo;t0tltoifcta1lmt lnvs t)trtoio3oo4openlfcsa()aDtm( oou1tlenii3tldfsDea(vs t0tltnxfcio1laDeln o ()t2tr(o iu1op e neta( sDrrumo;u4oltnifciaslaDrauvo;u0 rtnmr iy1lptrlieo t) ruo(o iudaptn nct ()arrru  ou0tpx io3iatla em( snu4trtniociotfm  anvil(0t2toio oydll elieiasfsDrm(ro;t0optnmo3iadfsDra(mo;u) lenir3tadfp  aneils)sruoxr3oo4om  lics s s2tm(mont1tpt ioeiysfa2emn o t)treomr ia1fmDe u s;s  etrxo nu1al elicsat  Durxmpnu0tle iieilsfsDemu o;u4 eeoiociatopD lnvi s0s2xm(o nu4lpt  ivsa(f 2ur(rooo4ape mo3iasls2rm( p;()arxoif3oa1lm rlnvo;( teuoxr3no1apt miet s)a2um(root4apx ifeildfs umu o;t4 eenxr iytom rlivi;( s2tr(mpoy4om e nctatf Dtax  nt4tpeniictatfmDulu s;u) rtrmociatfm eaiei;s)s2uoxo iudlleelieslsfsDur( onu1optniocils a2el( pnt4alxnifciodoatrau il( texr(o3nu4opte ivia()arrrxmp;u0opxo feiysla em(mont)altnmfciatfpDrai i s sruoxr oudlmt livsasfsrur( pou0teeo ocilsfaDem(monu)tltoir oo1fm eanvs (0trxr(m3oy1lmtnmfcils a2tmx  no0tee ifetyt aDem(ms t0tltrio3io1lm elnvo s0teumxr3iy1llt  nvslt) 2umuronu0apeo ocilslsDrl(ms;(0aleomr3oy1faD an i ()srurxopoydlpeemici (  ruau  ;o0apenmfeiatlmDua(vsn(4tlxnioctotfmDrlu sls  etrirpoo4lltn fvt (fa2uaur ;t1tleomictlsls2uau s (4trtrxf tadla r u olt t2toxopoo4aptnmfviasfs2raxr ;o0texo i3iadlmDrm(vo;u)texoxo3ty1lmDeau i;s)s2tmxo iydlm nlfctas)sDrm( ono1oexn ocilt m2rm(ms ()alerio iatopteluvi (  2xmxmpou1lme livsat)a2ua( ono0tetnioctlt m2ranvsn() lxrif3todlm  livsls  etm(o3io4openliviltf rurxrp;t4altn f3iyd a2rlump;u4tetoxo3oytlaDraneo (  2uoim3io4lm   nvi t  Dur(m ;u1oexnif3iadfaDeaump t0 lxoir iotomtr ies;s0tetmim3iu4ape mfet t a2rr(r oo4texniieiytlaDum( p;t0trerxo todfpDeaneo (0teuoxmpio1ll nlnvtasf Duru  nt4tlt moetat sDea( s;()tlenxf oatopD luvo;t sruoimpiu1omen icil()sDur(r ;t1aex ifctyd s elnms;u)alerxo3iatlpDr uvo;(  rtmirpoydlpenmfvi tfs2ra(m ou4alt  octls s2rl(vp u4altomo oadfp elnvo;t0 etmir3nu4lpeelfes s srra(m nu4tptomoeils aDean ont0tlxrio3tydlmtrlueo;s trxoxr oydoltnmiet sf Drm(m no1olx ifeiytlsDulums (0tltoif tydoptrln o t0trtoim nodlleemivs t) 2trxronu0alxnmfcilt m rmu snt)arxoioctodoa   i o s0 2xmxr3no4lm nlfvt t)srrmur nt4opt mocildfm um(vo;u4artnmrcoydoateluvs s  ruoxrpno1lp  lncs () 2ua( pnu0alt  o3iltlm2elnvp u4aexrxf iydla rlu o ()s2toxrpoudom elnviatf rumxrpoo1oexnio3tadfaDelu snt4 rerxrciytfatrauvolt0s2umxopoodolt  fvs tfsDtru pnt4aexn o3iytfs2ea(vo u4aetnmo iatopD  uvo (  eumxr3oo1omte fcsa()artau  nt4tlxnioctytfsDuluvo;u0 rxrmf ty1lmteaies s)s2tmxrpou1lmee fesas)aDrrumont0apxo f3tatfm ul(mp;u4tlxomo3oadlm raivils0teum(rpio1omt livsl()srta(m ;u4oetomf3iytfa eluvp;t)aeermoctotfpDelu sls0s2uoxrpiodamenmfei () Duaxrooo1aet iiciyd m2rl(mp t0arxrxf3iy1omDraivo;()t2trxopnydom n ictat artmurpou4ale ioctlt sDuluvs t)artrir io1fmDrauei t) eurxrpiodlpe lfet () Dum( ono4tpe ifetlt a2rl(vp (0tlxnmr iatfaDeluei;t trxrxo3io4ole mfvtlt arur( p;u0teeomociydfm elnvs u0tlxnxrctadfpD lies t0sexmim oydomtnmfvtlt a2umum ;t4opxnii3ilslmDrmumsn() exoir ia1opDrlnesls0setrio iy1oleelnvias)a2urxrpno1aet if3iasla2rmuvsnt4 eermfcoadlpDr neo t  euoxo nydope  nesltf Duaxm oo0olt  fciltfm rmnvp;t4 etrxr3tydfaDelnes s s2urxrpou4lp e ictas  rrmxr ;t0aeeoifciatlsDumnmp;u4 rtnxf todoatrau sls0trto(opou4ap nmivsl()aDtmurpou0tle mieiltfa2uaumonu)artrir3tatoa  lueilt0s2trxr3oudll  lnvtl( aDrrxm ou0tleomfeias sDem(vo;t)alenmr3oy1opDr nvi t setoxr iudame mictl(fsDtrur ;o0olxnifeildlm ulnmo;u4arxnxf tydomt  u ol()s2ur(r iudlme  ivs tfsDurump;t0oexoiociltls eanvs u0arxrioctadoptraieolt) euo(m ou4lmtnlnci t aDraumpot1apt  octldfsDuanms (0tlxnxo3ta1fm rauei s0trtmxr3oo4ape mfesls  2umu ono1tpx  f3ildlm2umnvpnu0aexoir iy1lat lieilt)s2xrim3iy4oltnmfcs s  Dtmumpoo1tpx iociyd mDeau o;t0tltrxf iotfat li sls0srtr(mpiydomtnmfesa(  rrr(  no1aetnio3iltfa rm( o;t4 leoio3oadomD  ivolt)s2urxmpio1olee ict s srurumo;u0oexo icildfs2umnvo (0altnif3oo1fpD  u i;s0s2uoxopnudal nmnctas s2tr(root0aeto feiasfaDeanvo t4tlxrmf iydfpte ieo t t2urxr3oydlme  ietlt  rra(  ;o0tptoiociydfs2rmumo;u)areomfciytoaD li i t  ruoio iydom nmies sfaDuaur ;u1ale iictysfsDul(ms u) eenio3iydfpt anes;t  eur(rpiy1lmeelnei ( sDuaumono0alx mfciatfs2um( o () rxnif iatoatrlnvsl( srurio io4lmtelivt ()srrr(rpoo4ale mf3iasfa umn ont4teeoxr oadfmD  n o;()srtoxm iodlm emies tf rumumo;u4tpxomictltla rl( pnu0arenxo3oo1oa  li i t)teumxr3iudolt licias) Dua(r ;u4oltoiieiytlm elnmp;(4arxnxfciydfaDrlieo s)texm(m nodllt mnes sf rtau ono1aptn ieiydfsDumnvp;u4 eenifcootlmt ln i;t  exm(m3oo1altnmfcsa( aDururoou0tleomi3ildfs emnvonu) lxoxo iydfptean o (0srtoim3iy4omeelfvtl() Dtmum oo0ope ii3iydlm rauvpnu) rxnxr iadfptelnvilt0 rumxmpio1omtemfviat)aDta(  ou4oleniiciyt s rlu p;u4 lxnifcoatlat lneils) etr(mpio1omtemiet s)arumur ou1opeo i3ilslmDeanms ()tetomo iadfm  ai s (0teum(rpoydam eliciasf rtaxmpnu0opxn fcils s2um( ont)teeomocoodlateanes;(0 rxoxm nudlptemietat a2rr(r ;o0aexn o3ilt mDulumo;()trerio oodfmt  n i;s0trxrir3iu4apen neta(fsrtm(mo;t1aex if3iysfsDumumpnu4trxnxf tatfpD aivslt)srumxr3nydolt mfct ()sDuau ooo4alxo fctatla2ul(mo;()arxrxrcio1fa r nvo;(0 ruo(o3no4omtn nvta(fa2uaurpno4tpen iciltfaDemn snt)arxomfctadlateau ols0t2trir3nudomen fvi sf 2taumoou0tlenio3tytfsDuanvp;u) ltrxrctydfatr uvolt srxo(o io4llt  nvt t)sDtm(rp;t4aet mictatfa ul( s;t)treoxr3iatoaDeanes s0 rumxm nu4omenliesas sDumuro;o4aetomfctat aDem(vo u4teeomo oytfmDe ieolt) eumxmpno1lmt  feiasfsDuaum ot1olt  ictatfm ean s ()texnxr iadopt au i;t)tetm(m nu4omenlneia(fa2uaum no1alt  f3iltla ua(vonu4 lerxf3iydlp elivols)truoir3iu1lmt lnvias)arraurpno1tex moeiatlm2umnvo;(4artnif oy1op e ueol()srtoxm ny1oleelicia(fa2raurpou1aetnifctasfaDrln s t)arenmo3oatlaD  n i;s0 2umxr iy1lp 
\ No newline at end of file
@@ -0,0 +1 @@
+ueil( trurim oo4olee fcilt  2taur ot4alxn ictys a2eln p;() eenmoctodoaD lnvsls0 rurimpoodale  ict () Dtmu  ;u4opto iciyslaDulnmo;t0texnio3iy1lm rluvo s)s2tr(o3iy1ll  licias aDumxmpno0oee mfciltlsDea(mp;t)texnxo3oatfa r uvi;s0 eurxm ou4lmtnmncsas) Dur(r ot0tlenmo3iat m uanmo t0 lenmr3io1oa rlneil(0trtoxo3oy1apenlnvsls)aDtrxrpnt0oeeniiciasfm2em(vo;(0 lxomr3oo1lpDelueil(0trum(o iu4omenmfvil()srrax ont1oex ifetatfs2ua(mp;t4 exrmo iodopDe ivol( srurio io1lmen fesa( s2urxmpnt0oltnmfeiys m2rmnvsn(0texoio tytom ean i t0trum(o3ny4ame mietasfsrumu p;o1tpxn ieiadfsDemums ()aetrio3tydlpD lueo;(0sexmir3io4apeemnviat)aDurxr ou0altnmfeias s el(vo;(0trenir tydlmt lneo;s0srtr(r3nudolenmnvtl()arraxmpno4olxomf3iad a ranmsnt)aexoif3oo1opteanvil(0t2xm(m oodlptelictlsf Dtrump;o0apxomi3iatlm emumo t4altoio3tatomt anvo;(  2toir3ou4amen iei (  rrrxrp;t4openiieiaslmDuluvonu4teeoifcootfpDr ueo s t2xm(m3ou4ll nlivsas a2ur(mpoo1alx  feiytls2ea(vs ()trerxf tatoat luesl(0setmxo oo1lmtemncilt) rtr(rpnu4ope  ociysfs2eln onu0 rtomo3oo1lm elneils s2umxo3iudam   ivils) rumxrpou4oexo fciatfa rmnvpnu4tltomf iatop elnvi;t0t2uoxm3nu1olt lfcta() 2umxro;t4tpt ifeiyd mDum(msnt4 lxrmrcty1oa  lieil( srxmxr3iy4lptelivia( aDurxroou1oet  f3ilsfs umuvpn()alxnio3iotfp rlues s0srurxm nodlltnmictlt) Dra(ro;t0olt  fctas sDumu s;t) leoxfctydlptelnei;t)setrxm iy4amte fctl( s2trxroou0olxnmo3ildlsDel(vo u4trxnmf iadla r nvo (  etoxr3iydam nlivi s arrru pou4tleo o3iydfa eauvs t0tltnmr3tytlmDr ivo;()seto(rpoo4ol n neslt  rum(mpnt4oee mfetatlsDumuvp t0tetrxr3ty1fpDranvol() 2xr(m3no1lpt  ict s) Dtm( onu4oee ii3ias s2um(mo (4teenir3ootom e u s;t) etr(mpno1lltemnvtls aDta(mont1tleoifctat m2rlumo;t) rxnifcootlmD aueslt s2toxopou4llen fet t a2taur no0aptn o3iadlm2ulnvonu)trtnxo3tatfptrlnei;t t2toio3iu4lmtnlfet ( arrr(m nu4tetn i3iatla el( s u)arxnxfcoodomte ueolt srtmir3oy1opt mivtls s2tru pno1olx mfctys m2ulump;(0alxnmf tytlaDe ueilt)srxmim3nydolen nvi (f rrmxrpou1oetomietysfsDul(mp t4 lermo oadfp rluvs t) rtr(opoodap  mfvilsfaruau o;t1texniieiyd s2elnvs;u4 eenmr3iy1lm  lnes;( s2toxopiy1lp  miesl() rtaur ;o4oetoifeiyslaDra( s;t)trtoif iydoa e uvslt0setmiopnudlmtemnvi () rrm(  no4tleo ociasls el(mpnt4 rxrxo oatfa r nesls) eumir nu1lpe mietas sDtaum ot4tlt moeiad m2uan s u)aeermrciy1la rln olt) exmxrpoy4ole  fci s) Drmu  ;t4openifetldla rmnvsn(4alenxr3oodlmDr uvi (0 2umxo nydllenmncs ()arrrx  nu0aleoifeiytlm2rauvs ()artnxr3tadoa r uesls0setmxm3nu1aleelnctl( aDtmxmpou0oetnio3tlsfs rau p;t)tltnio3to1la  lu i s0 eumxr oodlm nlivi s a2rr(rp;u1aeenmiciyt a emums () rxnmf ta1fp eanvs s srtmiopno4amenmicsltf 2trum oo0opxnmiciytfm eaumo;u0trxrxfcoydfatrluei;(0 2tr(o ny4lp nlics (f 2tmuro;u0opxoioeiytla2ua( o u0aeeoxo tatlm rli i;s  rxoio io1ole  ici sfaDuaur ou4aleoioeiyt sDem( o;u0aexrmf3to1late ues () exmim ny1omt liesasf Dumumonu0ole  fctad a2ra( o;(4 eenxf3tydlpteluvo;(0sexrir3oo4ole mfesatfsDtm(mpnu4aexnioctyd aDrm( p t) lxomociydlmDrlnvs ()srurxr3iu1ll   fctatfs2rau onu0tptn oeiasfs ra(mpn()altnmocty1oa  an ils0srto(rpny4ol nlfvslt)sDrr(r ou4apxniociyd a2rauvont)tlxnir iodoaDeauvi;(0tetoiopoydlm n icsa(  rtm( pno0oltnii3tltfa emuvsnt4arenxr3oa1omD anes;( s2uo(rpoy1lmt  nei ( arrmxr ;t4tet io3iytlm2em(mp t)tlxnxo3tytopDrauvsl(0sexmiopoudll emict ()s2rmxrpnu4tpt  i3tatlm umnms;u4 lerxf oo1fa rln ilt) rxrxr iu1omtemfvs (fsruaurpno1tpen ieiat m rmn o;t) renmf totoptr uvs t0srum(m3nu1ole lictls a2rr(ronu4tpx  fetad a ul(vsnt)texoiocoa1fmt lneols srxoim3no1aptnmivsat) ruau p;o4tptnmictlsla2ea( s;u4 leomf3iy1fpt  uvslt seurxo io4op nmiciatf Dtm(mo;u4olxnmf3iydfs2ulu on(0arenif oodfm  lnvslt)srtrxm no4aleemnes tfaDurxmo;u4opeoioetls aDuauvs;(4tlxrmf todfa  livs;s0texr(r3iu1lme lfesl(faDtax o;o4olxo ietyt s rm( s;u) exoio3ia1laDrlneils tetrxopiodame  iciat  rtm(mpoo4aptnmo3iat a ran onu0aexomr3oydoaDeauvils)tetmio oodole licil( sDum(m ot0olto octls aDuan p;t4alxomr3ia1lateluvo s)tetm(m ny4omtnlncs ()a2rmxr ;o1aexnmi3iys m2eanmpnt4trermo3oodomD ai il(0texm(rpiydapt  fes ( s2tmxmpot1aptnif3tlsla ra( o () rxrirciotfpt aivslt0texo(r iy1olenmnvs tf rur(mp;t0tetnmieiytlm2uauvo u4 lxnif tydom rluei;t)t2uoxopoudome lnetat  2ua(m ou0tet mieiatlm2eauvsn()teerxr tytomtelneolt) 2uo(mpoy4amtelfetls a2tau  ou4apeo f3tas a ra(vp u0 rxoiocoydop  aieols t2tm(o3nu4ap emnvils)arta(rpnt1aptn f3tltlmDuauvs u) lxomf tydomDe neilt seur(r iu4lpt lnei (fa2rau  oo1oet mi3tatls umu pn()aeerxociydfp  luvo;()t2trxopnu4lmtnlicta()artruroou1alt  ociyslsDulnvo (4 rxnir iydfp  aueols0s2umimpiudomeemnci (  rtrxm ;t0aeen i3tydla2rmnvs t4aeenir todlpDrlueslt0 rtmxm3ny1op emiet t s2ra(mpou4tpt io3iys m2ea(ms u4aexoxfcio1op rlnvs t sruoxr no4omeelncs tfa2ra(mp;t0ope  ieilsla2rm(ms t4trtrif oadlmDrlu o s)texoxm3io1am n nvslt a2tmxmpnt4opxo i3tld s umu snt4 leoio todfpDeau s s0texm(m iu4llt mivs (farrrxronu0apen oeiat s2em( on(0teenmf3totlatr n ol(  rtm(m nu4al e ictl(fsrtrum ;u4alt  f3ildla emuvsn(4aeermocoatla elu o;t t2xmxo iydomen feil(f Drru p;t0ale miciytfsDeau s t)artnxr iydopte ieo;( srtmxr3oo4olt  nct ( s2uru poo1aet  ictlsla emu o u)tltrxf oytop ran o;(0s2uoiopiodlptn netl()s2trurono4tetoii3iyt a emu on(0 etoif tatla eln ilt) exrim iodapee nct t)aDrauroou0tlxnifciltfs2uan p;(0 lxrmo ta1op eai s t) 2xrir nu4al emnctl( a2trurono4olxo octld s2emump;(4tlxrxo ootlpD  uvs;s)sruoxopny4lleelfct ()srua( o;t1teeoifciyd s umu snt4 lenircoatomDranvi;t0 2toxm3oydamte fesa(f rtr(  oo0tee moeiytfmDrlu p;u)trtnmfcto1omDr u olt  rxr(rpio4optnmfcia(fsrua( ont0aptniieiat a emuvpnu4aeeoir3iodlate i i;s)s2trim oudapenliesatfa2uau  nt0tlto o3tytlaDua(vsnt)alxrio tatfpDranvi ()srtr(o nudope mics (faDuaxmpot4aleoif3iyt mDrauvo t)tetrxrciytfmtran s t0trtr(r3io4oleemfeias) 2tmumonu4aeeo icildlm2ua(mo t4aeeoifcto1oaD lieols)srxrio nodoltelieta(fa2umxrpot0aptnio3tlt a2umu s t) eeomr iodoa r ies s0 rxoim ou1amte fcsltfsDtr(mo;u1alenmoctytls2uanvs u4 lxrifciotfpDrluei;(  2xo(o oy1aleelivs t)a2trxmpot1tlx mi3ilslaDulnvo;u)tltnir3to1lpt  ivo;s) rurxr3ny4omtelfvslsf Duau  ;u1opto f3iadfa elu s;u0 etrxo3oydlp  lneo s) eumxm no4omen fciat)aDuaxm ou4ape ifcilsfsDrl(vpnt0 renmfcoodfpD liei ()s2xoim3oudlptemnesasfs2uauroou4tleoif3tas m rl(mon(4 ltomrciydom   uvi;t0 rtmxopoy4opte nvi s srum(m ou4opxoifctltlsDrl(vpn(4arxoirciatlp  anvs;s0trxoxo3nodllenmncilt)sDtrurooo0tpto ieiydfaDranvo (0aetoif ia1lat lnvi;(0 2umxopno1op  mnvs s)srrrxmonu0ole  o3iytfs rmuvp (0areoir3totlm  aues t0sruoir oo4op eliet s) rrax  no4olenmf3ilt m ra(vs;t4arxnir tatlmDeaueo;(0t2xmim3nudap elfet t)arrm(m nt4ole  f3tadlm rmnvs;(4 etoiociodlmD au o s)texm(r nudamtn fvs tfsDra( pou0ole io3iasfm emnmo;(0artrmrcootla r nvsls) 2uo(m3nodale  neil()aDumxrpoo1teto ociadfs2ua( o;u0 reoir3tatfmtrlieils srtm(opou1alenmnct t)a2tm(m nt1alxnmoeiys s2rm(vo;u0 rxniocoytfmDeli i t  eurxr iu4lleelfeilsfsDur(  ;o4aet mieiysfaDeauvp ()altnif3io1fa rai s;(  exoio ny1op  mnvs t  2tru  nu1olxn o3iyd a rl( snu0aetrmf totfpt an o s texoir nu1alte iei s sDta(  nt1oeenioeiyslm eanmsn() lxnxoctydlat livo;(  eurxo3iy4ame  fcs s)sDtrxm ;u4tlx mietydfs ulnmp;u4aleoxr3iadoptelnvsls0trxrim3no1lleelneta( arrm( p;t1apx ii3iasfm2eanvo t4aeerif oatfpt lneslt seumirpnu1opt  fcs t) 2tau pnu0tlx  octlslaDra(vo u0 lxnmocoatfpDr nvo;s)trurxm nodope mnvt sfaDta(mo;o4tpeniieiadls rmuvo;t0 eeomo3oy1lpD lneo s)seuoxrpnodam   ictlsfsrraurp;t4ole mociytlsDeluvs;(4trtnmoctatomDe uei;s)srur(mpoudal emfvi ()a2uaxr ;t4tlx mo3ildls2elnvo (4tltoioctadoate n i;s0srxm(rpnydlptelictas aDuaum ou0tlenmicild s2rm( pn(0alerio oo1lpD  nes ( texr(o oo4am   ncsatfaDrmu  no0opeomi3tydfmDranmp;(0tlxrir3oodlaDeau sl(0 rxo(o no1lmtnmnvs sfaDraurpnt0tpenmfeilsfaDrmuvon()areoxr iotlpD  n olt  2xo(m3nu4lpt  ncsa( arrm(roou1tpx mf3iyt a uluvp u0tltoxrcoo1oaDeln o (0trtmxopiy4amenlnvt ()sDtm(ro;u1oeeo fetasfa eaums;u) ltoif3iytlp e uvs s)t2tmirpny4oltemfvsatfsDum(rpno1tpx ioeild mDuanvsnt0 etnmf iy1oaDeauvil()trxrxo iu1am emfesltfaDtr( ono1oex iocildlsDuaumpn(4 leomr tytfpte n i;s) 2xo(o ou1lmte nvta() rrrxm ;o0optomfciytla rm(mp;u0 etrifcia1omt lueo ()t2uoio iudlpeelfcilt) 2tmum ;t0teeomfciadfsDraumon()altrxf todfptrlivi () rtm(r ny1om  mivi s)srtru  oo1tltn ieias s eauvpnt4aexomf3totfmtean i s)t2xoxr3nu1alee iesls aDur(r nu1apx mfeiydfm rln o;t0arenmrctydla raivi ( srxm(opoy1ap elieias  2raxront0oet moctat s2ulu s (0tetrircto1opte nei;( srtm(opiy1am   nctlt s2rmxro;u4tee iieias sDulumo u0alenxo oydlmDeaueo;s0t2tm(mpnudame  feslt)s2ua(rpou4olen fciaslm rmums u)aleoif tadfatrau o t0srxmxm3oudameeliesl()a2tr( p;o1tptomociyslm uauvsnt0 etrif totoptrln i;t) 2tmxo3nu1lltnlncsls)srtmxmoou0oetnii3ilt a2el(mp;t4 rerif3oatfp eauvil(0 rxrio3no1alenlieia(fsruau pno4oetnmfetatfs2uanmon(0 rtrxo3tydoaDe ieo;(0t2xr(m ou4apenmneilsfa2urur ;t1oleo o3iatfa2ra(vpnu)artrmo iydfptrli s;() 2urxr nodlm nlnctas)srta(mpnu1tpenmoeilsfmDumumpnt4 rtoxr iytomDr nvilt)s2trxr3oo1op n ncia( a2tmx  oo1alxnioetldfmDrmnmo;u0tleoircoa1lpt lu o;s  2xrxmpny1lltelfctltfs2raumpno1tlx  oetytfs ean s;(0 rermr oydlpt liei;s seuo(opoudlmt lies tf rrmxr nu1tlxniociydlaDeluvonu)teeoxfcoo1op raivs;( teum(opiydalt mies tfartr(  no0apxnmfeildfaDelnvo (0 rtomociy1lmtrau o t srtmim3nu4lptnmfetatfarta(ront0opx mo3iysls ranms t0teenxocootoat auei;()tetm(o3io4ome mfetlt a2uaum ;u0tlt  ocildfs eln s () exrxr3oy1la e nvo ()s2tmio iodop elieilsfs2ur(rpot1tltoioctasfs2rlu pnt4artrxfcoatla  livo;s trtmimpno4omen nvi sf Dtr(rooo0ope ifeiat a2rmn sn(4 eenio to1oat  u i (0srtmxopoy4lp elncias srrr(  ;t1tlx  f3ilsla eaumpnt4aexoio3to1omtran s s0 rur(r3io1ll elfcta() Drrurp;u4tpt  fciad a2raumpnu)texnxo3todoatr uvi;s0srxm(m ny4apenmnviatf rtrum ;o1oexomf3iatlaDel( pn() ltrio3totfaDrauvs (0srtrxr ou4ope lfcta() 2rrumo;o0tle iieiyt m ranmp u4aetrmfcoa1opDeaueol()setmio nu4lptnlicsl(f rumur ;o1tetomf3ilslsDrln o t4trtnif3oytfmtrlivolt0 rtmxr ny4apeemfctas) Duax oou4apt iicilsfa2uauvs t)tlxrxrciadlmtrlivolt  eum(opoo1llee icsa(f Dtrurono1oeenmo3iatlm2ulnvs u0altnmo iadomt  i o;(0 2to(r no4ll n nvtat) 2rmuronu1aee mfcildfa eau p u4aexoio tydfa eai i;s) etmxm3oo1optemnci (faDtaxmoou1aptoii3ils sDra(vo;()aexomo3iytla ranvilt0s2urirpoy1lmt mivtlt)s2tmxmo;u0oleo i3tld m2umu p t0 exnxfctotoa  lues;t truoio oodop e nes (faDrrumo;t0tpxn ocildfs2emnmo t0aeeriocoa1omte ivs t)teum(m3no4llteliei tf 2umumono0opeo fctld m elnvsnt0tlxrxfcta1faD  i sl(  exrio ou1opt lfctlt) Durxrp;t4tleo feilslm2rl( pnu4 lerxr iodoptrlu sl(  2umirpoo1oleemfctlsfarra(mono1opeoioctysla um(mp (4alerio3iytfa   n il(0tetmxm iudapt  feil(f rtaxr oo1tpt  oeils mDuln s u0tleriociy1lpt lnvi;(0 exmirpoy4om e ivi ()sDururpno4tpen ociysls umu ont)altrmo iodoatr i olt s2xrir nu4ll e ncsl( arra( o;o4tlx  o3iasfsDeln p (0aetrxf3oadfm   uvs;t)trurxr3io1ll   fciat)arrm(m oo0tle  fciadlm um(vpnu)alerxrcoytfp rai sl(0 exo(o nudalt mnvs (fa2urxronu4aetnioctad mDrau o;t) etoxocoatlaDeau o t)texm(r3nudlpt lnetlt aDumurpot1tpx mociasla ulnvs u0altoxo oo1om e ueo;s0s2uoirpno4apeeliviatfsDur( ooo4oetn o3tytfs rmuvo t) ltrxf ootfatelneo ()tetoxrpio1ole livsl() rrrxrono4alt  o3tlsla2uanms u) reoxo3oydoaD lueo;( t2xmim3nydll  livtlt)aruaurpnt4alt ioctyt s2um(ms;(0 exoxo oa1lm   nvo t t2uo(r oodlltnmiei () ruaxmpoo1aex  fciyd s2ra( sn(4alenir ta1fp eauvi t0trxrirpiy1oltnlfes sfsrtaurpot4opxoiictysfa elnvp u0tltoioctatla rliei;( trtr(mpoudam nlfctat arrmx p;u1apxoiietas s2emnvo;u)tetnif3iodlatelnes ( s2xoxmpny1altemfci sfa2tru  ;u1alt  o3tytla2emnvo (4trxnxf3ty1op  lneols0 2uoxo iudll n ieilt aDraxmpnu4tpxoifeiltfm elnvs (4trtnmfcty1faDeaivols0srxrxo oy1altemnes () 2taurpno1oex  fciaslaDel(vsn(0tlxnio iytfm ran ilt)seumxr3nudlptnmfeslsfsDtmxrooo0tetnifeias s2em(vp u4 exnxocoa1lmt  uvs;s)s2toirpiu4op  lfcs t a2raur nt0ape moeildla2rm(vo;(4areoif3todla r nei s0 rumxm3no1lltemfcsa( s2rmumo;u4tlt mieiytfa rm(mo (0 rerxr oydom  an s;(0srxrxopiu1apenmnvs t  rtm( pou4teeomoctydfm2ua(vsnu0 lxnio oydoaDrlu s s0 exrim3oo1ole lfctas a2tax p;u0tpeomi3ias aDulnvsn() lxoifciadoaDrln i;t teto(m ou1opt  nvilt) 2uru  ;t1opxn i3ildfa umnvpnu)arxnmfcoadoa rlnvilt trtrim3iudal   neia()aruaxm no1optomoctldfm uauvpnu0aetnxr iatlmDe n i s  exr(mpiodop  miesat  rumxmo;t4opxn iciyt a2emump u)texrmr ta1fptrai i s seuoxr3ou1oltelfei sfsDrrx pot4aee mictytfs ulnmp;u0tlxoio3iatopteln sl(0t2toim3io1alee feia(fs2tr(ro;o4tex io3tldfa rm(vo u4 rxnifcoatopDeau ilt0tetrir oy4lpt  ncia(fa2ra(rpnt4apenmocilsla el(vsnt4tlxnxfciadomDrai olt0setrxrpoudape micsl(  rtrxmooo0open f3tyd m2rln sn(0aexnxrctytomDean s;s0 exoio iy1aleemnct t)sDuaxro;t4tlxoifeiltfm2rlnmp;()texoxocta1fmtrlnvslt0srxrxmpio1lm  livsltfs2tmxmo;o4olt  o3iltls rln p;t)tetnxo iotop   u o s)srtr(m iu4am elfei (f 2tmx  oo0aptoif3iadlmDum(vs;u4tltoio oydfa rai slt  ruo(opoy4open ieias)s2trxmono0tlenmfeiyt aDuln p ()tetnmo iatoaDr i i;( s2ur(o3oodlle liesasfa2ta(m no4aex mociys s rmumo u0tltrmo oo1la  aivolt0srtmxr oydomtnmfcilt)s2umxmpnt0opx moetysls rmnmonu0aexomr tytomtelneo s)s2umir oodap nlncia( s2urxr ou4aeeo f3iytfmDrln p;t)tleomf3oy1oa ran o (0sexoxmpoodopeemfvi ()artr(m ;o0opxnmi3tldfs2ra(vp;u4 ltnmrcoy1fptr ivsls trxm(mpou4omtnlfvil( s2raum nt4apenii3iydls2ran p;t) lermf3iytoa elnvo;s)texoxmpoo4al  lncilt) Duaxrpoo4ope ii3iys m ua(mp;t0teenir3iytoaD auvol() rto(opny4aptemnctatfsDrau ooo0opx ii3iydlm2rmnmp;u) rxnxf iotlpDe uvs t)seurxm3iodom  lnvs t)artmu o;o0aetn o3ils sDuluvs;u)tlerif oytop  an s s0trumir3ny1alt lies t)aruaur ou4olxnifcilt s2ulnmo;() rtrirctytfmtr n i;( srxrxo io4ole  fct tf Dumumo;u0oeeomf3tyd sDrl( p;(4artnio oadfate nei (0texoxr nu1om  mfesl(  2rm(mo;o1texoiociys a2rauvpn(4 eeoircootlpt lneils  2trxr no1lmenmnvia(f rururp;u1oet io3iydfa rlnvsnu0tlxoio tydom r u ols0 2uo(m3iodam n nvsa( a2urx pot0alx  iciltfs eaums;(0 eeomocoydlpte u i () eum(o iy1ale lfet t)sDrrumpnu1oeeo iciydfmDemu ont0trtrxrcoadfa eanes t sexmiopoo1al  lfetls  rtaxr no0alenmfciatfsDeauvpnu)alermo3iodfateaivi;s0srxrimpoydlmt miesat aDtru  nu1aeeoiictyt s2uluvo (0 reoir3to1la   u o;s0setrirpoudlm  mivi s srrmurp;o4tlxoifetad s2eanvs;t4 exomo iy1op rli sls0t2to(m3oy4ol   ivs s  2rau  oo4aexo f3iatfaDeauvs;(0tlenxocoadlaD anvo s t2toio no4lp nlictl(f Duru o;t4texnmiciatfsDem( sn()trxnir3iatomDelivilt)s2xmxopny4oltemfci () rumx oot0aexnmieiatlaDrm( on(0aetnir3iy1latrli sl()setr(m nodomtelnctl(f Dtrxmoou0olen feiltfmDulnvs () exnmo3totfpDeluvils)sexmirpiu4op  mfet tfa2trumpnt1aleniietyd a eaump t) ltomf3oadoa rliei (0texoio nudlleelivtasf 2trxmooo1altnmi3iyd sDumn o t) exnxfctadlpDrli i;()trtoxo3nydomtnlneil()a2tru  ;u1tpe mociytfa2rlnmp;u4aetnxr tadlp r uvs ( teur(r iudoptelieiatfs2ra(moou4ole  oeils aDelnvs;t)trxriocoodfptr ieolt) rtoxrpiodop  lies ( arrrxrpno0tlenif3iltla rlumo ()artrirciodfpD luvi s)t2trirpiy4oleelnvs (faDtmu  ;o1tex moeias a2rmums;u0 lxrir todlptelies;s  2xriopnu1op elfcs sfaDua(rpou4tpxnmictadfaDrl( s ()aetrir iotlaDeaieolt t2tr(o3iu4lm elfvi s artmurpno1olx mieiadfm umumsn(0 rtrir3iodlat aivs;t0 rtrxo oo1aptn fcsatf Dumxmoot0olt if3ildfsDeau s;t0arxnmrciytoat au o s)s2xoiopnudolt lfcs s)a2ur(  ;t4aexn fctltlsDrmu p;t)tlxrxo tytlateai ols0sruoxr oydop e ncia(farrax ono0tetnioctatls2ea(vpn(0teerif3io1faDraies;() etrxo iu4apenlnvs t artrurpnu1tle mfciydlm2el(mp t0 rtrxfcoytlaDr nvol(0t2xmir3nydlpeemnes tfsrrrurp;t4ape miciysls umn o;(0aexrmo tydomDr nvilt)tetrim nu1llte nvia()srum(mo;o4aeeomi3tltfsDum( p;(4aexoir iydfpDelieols0seurxr io4lptemnet t  rurxmoou0opt  icias s2ulnvo u4aeerxf oodlpDr ivo () 2to(o3iydome mici sfartrumpou0oetn f3iltls uaumpn(0aeermf iadfat  nvs (0t2uoimpnu4om   iei t)sDraurp;u0tpe mfctyt mDulumont0alermrciytlm r nvo ( sexoxo3oy1ope  ivtl()aruru  ;t4optniictyt a umnvs (0tltrxrcto1fa rauei (0setrxo iodamt mies tf Drrurpoo1opeoifctasfa2uauvpn() reomr3io1fp e nvs;(0t2trxm oo4am nmivsat) rua(r ot4alxnmfctys m ua(vont4 rtrio iodlpt au i;s0sexoio oo4alenlnciat sDrm(m nt1tlxo i3iyt sDeln p;t4artomrctytlateaieilt0seuoxmpno4amt micil( artrumo;o0tpeomieiad aDuln pnt) lxoif3oadoate n i;s)sexrio3nu4opt  fcil() rumu o;t4teeo icilt aDuln o t) rtoxf3ia1om eaiei ( t2trxm nu4ll nmnetatfaDururont4tlxo feiytlm uan sn(4 etoxfciydoa raivo s setoim3oudlpt lfvs tf 2tmx o;u0ape if3ild mDeln ont0tetrxr todlmt aivi ( t2xrxopno4apte icia()s2rmuro;t1tpxn i3tyd aDem(mont0 leomf3to1lp  li ol(0srurxr ny1omenlfei ()sDrmxmont1aetnmfeiat a um( p t0aexrio oatfm  lneol( sexr(m3io4lm n icslt)aDrmu  ou0opx  i3tydfsDemnvsnt4 exrio3ty1oa raies;(0 exmxo3oydope  icsl() ruaurpou1tlt moetadfs rlu on() exrmfciydlm  lu i () 2tmxm nu4ol   neiat) Drrx pnt1tlxnmoctldfa2el(mo;() eermf3oodfpt  nvs;t setrxo oy1lmenlnvi s) rtaurpno1oeeoii3tysfmDuauvon() rtriocoydoaD lnvi (0trum(m3iu4lle  fcsa(fa2uau  ;o0tle mi3ias a el(vs;t0 ltrmr3oatfaDrli o t srumim3no4olenlieias srrau o;o1alen octys s2uan on(0tlxnxf oo1oat au s;t)sruoxr3oo1amt  iesas)a2um(m nt4oeenmoeild s2ul(vp;t0tlxoxoctadlpDe i sl(0seuo(o3iydal  mnvsat)a2tr(m nu0opxnio3tytfm uau p u) exnxrcto1fp rlnvi s0trxm(o ou4apen nvta( s2trx  no1aet  ieiasla2umnmsn()tltrmo3to1lmDraueolt)setoiopio4oltn iesa(  2tm(  ;t0aleoio3iatfm eluvo t4tetrifciodomtr uvo;s0srxo(o oydoptemici (  Dururp;t0opx  i3iatfmDulnvsn()tltnxo3ia1fat anvo;( srxrxr ou1om e nvs ()a2rmu p;t4altoifeiad sDul(vpn() lxrxrcoadom eaivol(  exrir nydlptn ieia( sruaxmo;u0oetoio3tasfa2rlnvonu4texrir iodop r u s (0 rtmir ou1alenmfetlt)sruaxm ;o4olto ociytfs emnvo (0 lxrio oo1fat lneil()setmirpio4ole  nvil(fs2tauront1oex  feiytla rmu o;(4 rxnxocoytoat liei () rxm(o oy1altnlnvt (farrr( p;t0aetn f3tysfs rau o;(4aetnio3iytoat ai olt0srtmir ou4lmt  nvsat)s2rm( ooo0aeeomo3taslm2ra( o u4alxnmr3iydlp rlu o;s0teurio3ny1aptemnvt ( s2rmumpot0optnioeiatfs2umuvo () reoiocoy1fp  aues ()srtriopoydome lnvs ( s2trx  oo4tleomi3ildfsDelu snu0texrirctadomDrlneolt sexmir3iudope  icias a2umumoot1olt  oeias s umnvo t0aleoxf3to1fateluvs s srto(m nu1lm nmnetlt)s2ra(r ou1tpeomo3tytls rlu s (4 rtomf3ia1lm r n il(0s2uoxm3ou4apee fetls sruaurp;t4aeenmfeiys a2ra( o t0 etrxo3oy1op  anvsl(0 rtr(mpoy4ap emfesatfs2tru p;t1tlxn iciadfm2ra(mo;() lermrcoytopDeaivs t  eur(o ny4ap nlfviat) 2tmu p;t0opt if3tasfs elump;u0alxoio3ty1fp  li o (  ruoxo nodapt lncsasfarrrx pno4tltomi3iysfm ranvpnu0 rerxr tytoatr iesl(0srtrir3oydllenlivilt)sDuru p;t0aexnifeildfaDraump t4texnmr3oytfpt anvo t) 2tmim3iodaltn fvtas arua(ronu1alenmi3ilt s2uau s t)tltoirciydlpD anvs t)s2tm(r iodapt livs t)s2umurp;o1openifctlslaDum(vs t0trxrir3iytfat  neils s2toxm iu4alee nciatfsrraxrpot0tpt ii3tasla el( pnt0 rxomr3iadla  anvols)sexoxm3oy4altnmiet t aDrr(moou4tptn ieiltlmDrmnms;(4teenxo3ia1laDr u o (  2xo(m3oo1op emfcsa()sDtr(mo;o0tleoiietat a2umuvo (4texrmf ta1opD  nvil()srxr(mpoo1lltnmnct ( artmur ;u4tlx ifctyd mDrmnmonu0texoxfcio1lm raieo s s2um(m nudoleelnesa() 2tm(  ot0oleniicias a2el( o;u)aexrmo oa1lmDr uesl( setrio3iydll  mict (  2rmump;u0aptn feiyt aDrauvs (4aexoif iatlpD  nvs;s  rtrim iu1am  lfeta() rua(mpot0oeenif3tas a ua(mo;()arenir iotop elnvil( seumiopiydapte ncsls arrm(  ot0aex  ociasfm2ua( s;() etomocoatom   uvol( t2xmiopiydamenlnvslt  Durumpou1tee iietat m2eanvo;u4aetrmr3totoptrlnvo;s) ruoxr3oo1ol nmictat)arur(rp;u1teto iciatfa emu s u4trtrmfctytlatrlueil( tetoirpoo1lm eliesls)sDtm( p;t0ope  oeiyt s ranvo () leoir3oy1omDelivo ()s2uoio3iu1ol nlfct () 2tr(roou4olto ociytfsDulnvon()aetrif io1oa  ai s t  2uoirpoodlme lnct sfarrru p;o1opx  ieiat a ra( pnu)treoifcootomt anvil()texr(m3iodal e ieiatf rrmx ono4alt mfciys sDuauvsnt4tetnxf3ootopD aueils seurxm iydapt mivsat)srua(mpno0tptomociydfaDeln onu4aetomrcty1lp eli o t s2xoxmpoo4omee iet s artm( ont0ole mfciytls eanmo;(0aetnmo3todfatr u ils  rtm(m nodomenmivil(fs2taxmp;t1tlt mo3tlslaDemnvont) ltrio3tadlm e nes;( s2tmir iodal n ietat)s2rrumo;t4texniiciadlsDrmnmpnu0 etrxf ootlp e n s;s0trtrio3ou4lp nlnes t aDtrxmp;t1olxnmoctltls em(vs;(0aexoxocoy1fptelnes;s0 exoir iudamtemncilsfaDumump;o1tleo o3tatfm eln snu)tetrxfcto1lp  luvsls)srxr(opou1opte nct t)arrr( pou4alt ifctasla rm( s;(4 eeomfcoo1fm rln o;s0 rtoxrpnudlme mfet t srrm( onu4opxnmfciys m2ea(vp t4tltrif oy1lmteanes (0 2urir3ou1lle lfvtat aDrm(moot4oetnifeiysla em(vs;u) rerxf3tydomtr uvi (  eurir3iodll nmfei t)s2rmumo;o4oltomocildfaDrmnmo (0arermr3ootopDr nvolt srumxmpnydlp n fci tfsDumx ooo4aetnmf3iytfs ua(vpn()aexomo3tydlat lu o;s0t2urxopnudll   fvs (f 2tmump;o1opt if3iyd s2eanvont0tlxnxfctytfa eai s ( trxmio no1amenlfvi sf Dur(m nu1oltn fciytfaDulu sn()aetnio3iytlaD an i ( t2tm(o3oudlp nmnvsls srumu p;u0apxoifeiys mDumuvo;() leomf3iadoptelueolt s2xoio nudoleelicsatfartaxrooo1tlt  o3iys mDranvp;u4tlxrmrctodlptrli ils0 2xoirpou1lpenmfctas)arrru pou0olxomictyd a2uan pnu0 rtoir tytom eanei;s0t2xo(m3no4lptn ivsa( a2urx pno4alt mo3ildfmDel(vsnt0arxnxo tatoa e u s;t0trtoio3oo4ameelnetat)sDrmxmp;t1oetn feiydfm uanvo;() eeoircty1latr ies ( s2xmio iydllee nvsat)a2ua(rpou0opt  ocias sDumu o;() eerifctodomD  ivslt)sexr(o3oodopeemiciltfsDrmuro;t0opeoiiciat s2rau snt0 lenir3iadfp e i i;(0sexoir iu1am n nvil()aDrmur nt0teeomi3tlslm ranmont4aexrif3tytlp rlivi ()s2urim iydlme  ivils a2ua(rp;o1tpe  f3ias m ea(vpnt0 rxrxf iy1laDrli i;()s2xm(o3oo1aptemfvi ( arrru oot0oleniictltlmDemums t4 rxrmo iytlaDr neils)t2xo(r no1amee nvils)arumxmoou0aet ioeiytlmDra(ms u4 ltnxr3oatom  lieolt0teuoio oydlptelfeiatfaDururooo4openiiciltls2rm(monu4tltoir iydfa  ln il( s2xmxm nodal   iviat s2tmxmp;u0apxoifciltfsDelu pn()arxrxr iotfm rli sl() eumxmpio1omtemiet t)sDrrum ;t4oexo oeiytfs2umuvo t0aeeoxr oy1lp ran ol( setm(m3oo1lp nlivsas) 2raumo;o4apt if3iyslaDum(vo;t)tlerir iodlptrlivsls tetrio3ny1ol  mfvs t  rrm(mooo1tet ii3ils mDumn o;(4 rxoxf3iytoaDeaiei s0trtoxrpoy1apte neiat)artmxmpoo1apxo ocildfs2ua(vo t)arxomocoydlpt anvi;t  exmxm3oo4lm emnvi t sDtr( p;u1apxnifeiysfs rauvon()tltomo3oo1lpD auei ( sexoimpoydom elfvtas s2rr(rpou4tpeomo3tatlmDulumsnt) renmf ia1omDe ueils0setm(r3iydom   ivias  2ur(moot1teeomiciatls2eau o u0alxrif3oa1la eauvils sexoiopnodlp   fvslt a2raxro;o0ope  iciat s2ulu s;()alermrciy1oaDeauvslt) ruoxo3oudopt lnctltf 2tau  no1apen fciyt s ulnvo u4trtoxr3oy1lmt lieo;s)texrxm3iy1om  lfvt tf rumxmpot4texo o3tyslm rauvpnt4trtrmo oytlmtr n olt t2toimpou1lpenlfct (faDuaur ou0tee  feiatlm rlu s;u4 exoxrcoadlatr neols  ruoir3ou4apee ivs ()s2ur( pou0tex  ociysfs2raums u) exoio3iadfp  lnvs;s0srxoxopnudol n ics s srtru  ot1apen f3tld m rmu s (4aeenxfciadfat  neo t s2ur(mpoy4lme  iet () rua( p;u0optnmieiaslm2rmnvsn() renxr3tadfatrli o s)trtriopiy4lpen ieta()srra( p;o0oetn i3ildfs2uanvs t4 lerio3ootoa eliei s s2urio oydlleemict sfsDurx  ;t0aeto f3ildls eanmo u) leomr oytop   ues;t0seuoimpiu1omtnlnei sf rtax p;o0oee  i3ilsfaDrlums (0tlerxo3ty1lpD lneolt0srxo(mpou4amt  icta()srrrxr nu0oltn fciad s rmuvonu)aeenxocoatfp ran s;t srxoxmpiudome lfes s aDtr(m nt1tetomfciysfs ul(vp;u0 lxoxoctytomtrlivs;s)teumxmpoodlptn nesat) 2taxrooo1aeeo oeiltfs2rlnms;u4arxomrciadomt anesl(0trtoim3nydom elivs sf Duax o;u1olt mi3ildlm ulnvsnu0 rtoxo iy1lat luvs;t)texrimpiydlleemivtl()s2ur(r no0tlenii3tltlaDemn p;t)texoxocto1latrlnvo (  2tmir3oodapenmncta(f 2rr(rpnt1aex if3ilt s2rl( on(0 renmf3iytfpDr uvsl( seum(opiudolt  fct (fs2trx  oo1oleoiicildlm2emums u4artnxocto1la   uvils)t2xriopiudaltelict s a2rrxmo;o1tlxnifetat mDemums;u4trxoxo3oy1opDeaivs t0 2trxo nudllenmietasfsrtr(  no4aptoifciytfs2ua(vsnt4 renmr3oydopt an sl(  2xoxm iudlpe mfvt ()sDtmu  no0oeto ociytfaDumumo ()aetoifcoytopDelnvo t0 2xrxmpoudalt  ncil(  rtax  ;u0aptnmoeiltfs ra(vp;u4aexnxrciotla   n s s0 ruoiopnudomtemicias arrr(mpot1tleo i3iad a rau pnt0altrmrcoo1fptraivil( sruoim3oudolte ietas  Dur(mo;t1tlx iociltla rlumont0 lxrif ta1opDeanvi;s)trtoxo3no4amt mncs (faDrmxro;o1oltn f3ild s rln pnt0trenifctotfmteaivs (  eurir3io4apee iciasfsDrmu pno1opto fetys aDuauvs;() eeomrcootlpDrln o t) 2uoxr3oodomtemies t aDtmx  ;t4tetomietasfs rl(msn()aeenif3tadlmte u sl( trtm(r3iydlp nlfeil() Dtm(m ;u1teenifetasls2rlnvont0 rtnirctodoaDr i ols0 etm(rpoydop elfvi ()aDrrxrp;o4apxnmo3tasfs rmnvsnu0teerir ia1la eln o (  rxm(r no1aptemici ()arrm(roou4aeeoifeiatfa ul( s t4 rxomrctytomtr nes t)trxo(o3oydol   nvsl()a2ururp;t4oeeomieildfa uluvp;u4 eerxr3oodomte neils) 2trxopnu4olee ietas sDrr(monu1opxnmietasla el(mpnt4tlxoxr3to1lp   u o t  eto(rpnu4apenmnei t)aDraum no1texomictysfm2rmnvsn(0tetnxrcoa1lpt an o ( s2toxr ou4lpe lfvil()arraump;u1olx  o3iyd s ean o ()trtnxf totoa raieolt)tetrimpnu1amtemfvs t) rtaumono0aptoifcilslm rm(von(4tlxrmfctatfa rluvilt)teumxo3iodlmtelncsls) Dumum nt1tptn ieiydfm umump;(4tetoxf oatomDraies;s0texr(o3oodamt mivias) rraur ;u1oltnmictltls2ra(msn(0arxoxrcoatop eaieo t) 2xrio oy4ll   iciasfa2ta(m ;o1oeeo ictls m eln o (0 rtnxf3oydfpD  neils) 2uo(mpiy4aptnmfci (f Duaxmpoo1opxnioetys aDrm(vo u)alxoircty1opDelieil(0 rtmxo3iudoltnlfct s  rtm(r nt0oltn fetls aDel( p;t4 exrio oadoat  uvo;( trtr(r3iu4lle mfvia()aDrrur nu4olxo ociasfaDelumsn() lerxocootlptelueils texrir3nodll nmfvsls)sDta(mpnu4tptn f3iadfsDrl(vp;(0alxoxocoytlp elu i;s  rxr(m3ou1omee iciatfs2ua(r nt1aeen f3ilsfmDelump;(4trerio3ootlaDraies;s) exrir3iy4amtn ieil() 2uax  no1teenio3tatls2ulnmo u4arxnmo ty1fmt anes t texmirpio4op e ict t  rrrx  ou0opxoif3tatfs em(mp ()altoir3ia1om e uvslt srxm(r oy1llte nvta(faDtm( ono0oex ifeilsfmDumump;u)trenxr3oodoaDr ueo t) 2uoxm ou1lptnlfcsatfaDrr( pot0oet iieildlm rmuvp u4areomf3ty1omDrlivil()truoxm3iodlp emfvsas)sDrrumpnt0ape mieiadlaDul(vpnt)tltomociy1fpte uvo t teuo(m3io4op  lnvs (  Dum(m nt1alx  o3tltfs2um( pnu0trtoxo3iatfpDr ivo;s s2uo(o oudamtnlnvia(  rum( pnu1tleoio3iad a2ul(ms t4 etnir3iatoaDr iei (0 rur(o iy4lmtnmicias)arrau o;t4oeeomo3tytfs2rm(ms u)artnmfctytlmtrlueil(0seum(m3oy1al nlnes s) Dtm( onu1alxn ieilsla el(mont0tlxnioctotopD  i o s) eum(opnu1ame lfciat)aDtrxmpnt1opxniieiytfa ra(mont) renmr ty1fpteauvo;t0 etoirpiodaptn ietlt)aDtrxrp;t4olenmociltla2eau o;t)tlxomf3io1oa  lieol( trxr(rpio4omeelfvtas  rrmuroot0oet  ociyt mDemums;u0aexrif3to1fmDeauvols0texmim3oudamtnmncslsfsrraxrpnu0oleoiictld aDrmump;t0tlxoircoodoptr u s t0seumxrpiodole  ncsa() Drmumonu4tet  f3iysfmDrau p;t)teenxf oadopt anvs;t teumir3iu4ome  fetas)aruaxm ;t1tpxoif3iytfm ua( o;t)aetrxfcootlmDrauvs;s seurio no4apt  icil(fsDtr( pno4apeo icild s ua( pnt0arenxr3oodlm ran i;(0trxoxm io1apeelfvs sf rtmxm ;u1aetn feiatfsDel( o;t0tetrirctytfptelivs t0texo(r3oo1alt livta(  Dumxrpot0oetnif3iadfsDuluvp;()teeoxoctotlaDr ueil(0s2umio no1lmen iet t  2urx onu1tpeo ociad s rmnmp t0 eeoxr3oy1fpte uvs;t)tetoxo3oo4am   fcils)aDuaxroot0apt mfeilsfm rln snu)tlxrio tatfpt luei;t  rtmir3nodlltemicsas)aDurxm ot0ape ifctlslmDemump;t4aetrxr oa1opt auvilt t2uoimpoo1lltnlfvt tfartaxro;u1apen ieildfs ra( p ()aetrxo3tydoate i o;s teumir3nu1ol emnci s a2rm( p;t1aexn i3ilslsDumn p (0 ltrif oadopt lu o ()s2umxrpoudlmtelfvsasfsrrmumpoo1aptoiiciat m2rlnmon() lerxf oytomD livi;s0 2xoio oo4ame lnetat aDra(moou4aeen feiysfmDrluvp t)trtoif oodopt aueolt0 2umio3iy4lpe miei s)a2urxmo;u4aex mo3iyd a2rlnvp;t)tlxomfctytlpDeanes;s)sexoim no1am nmfet s aDurxr no4ole miciltfsDel( pnu0alxoir oy1lmDeauvo ( teumxr nydolenmietls  rraxr ;u1tee mietldfs2uluvo u0trxnxr3iy1lmtraneo ()t2umim3iu1aptnlieilt)arraxmpno0ale ifciatla2uanmsnt4tetriociadomt luvslt0 rto(opiodom e feils)a2rrxmoou0tee  oeilsfa2umnmon(0trxrxo3ia1lpDeanvo s  eumxrpiu4ll   nvsatfs2rmum nt1apen i3tyd a2rl(vonu0trxoxo todopteaueol( teuo(rpoo1llenlfeil( srtr( o;u4texnif3iydfaDelnmp t) leoif oa1fp raues ( t2umxo3iydamt  ivsas)srur(  ou0tlen iciysfs2ul(vo;(4 eerxo iadlaD  i o;(0s2uo(r3oydll nliesls  rtm(mpou1apxn iciatfm2rl(vsn(4 ltnxr3iatfmtrluvi;t trumirpiy4omenlivt tf rtrx  nt0apto oeiasfsDea( s u0 leoifcty1fate i o;( seurir3nu1lpee ncsatfaDur( o;t1opxo o3ildla umnms t4arerxr3oo1optraneilt)s2xrxo3io4lm n nvs (fsruru o;o1apen f3iatls2ra( p;u4 lerxo3oodop raivilt)trto(mpoy4ll eliviltfa2tm(mpno1tle  ieiydfs rm(vo (0trxomrcty1om rln o () rumiopiy1lleelnvils)a2tru pou4opt  i3iysls ra( pn(4 eenifciadfate uvols  exrxrpiy4lle  fvt (fs2tax  ot0aexomi3tys s um( pnt4teenxf iydoate n o;t) exoirpoudapeelivslt  Dtau  ;o0olt mfetydlm rm(vpnt0trtoxrcia1fptrlieo ( sexmxmpoy4alenlnvt ( sDtr(rp;t0aex mfctyd s rm(monu0aeermo3ty1op  ai i;t0 rtmxm3ou4lmeelncil( s2ua(mo;o0opeo ieiydfsDrlnvpn()treomo3io1faD li ilt teuo(o io4ome mfvi tf rrr(  nt1olxn ietyd sDea(monu0tltomrctatfpt aneo ()trxr(r3iu1ope  ietas)s2tauroou4opt iiciaslaDelums;t0trxnir3oadlaDrli o s)texmxopnu1al  mivslt)aDuau pnu0tlenmf3iyd a2ea(mont0artnif oatoa r uvo;t)t2umxm ou1ap elfcs ()s2tm(rooo0tltnmi3iasfa2em(mp;t4arxnxfciydlm r u i s tetmxm3iy4lm  lfvia( s2tr(m ;o0tlxnif3iysfa rlnvs;t0 reomf3oatfmtelneo ()s2ur(opou4lme mnet () Dtaur ;o0alx ifciydfmDelu o ()areomrciadfaD  u ol()s2tr(mpiu1lpenlicsatfarrru  nu0oeeo octlsfa2ul(msnu)teenxr3ta1lmD aiesl(0 euo(r3oo1alt  fciat)arra(  ;u1oeeo o3ils mDeauvo;t)artnxf iodopteauvo;( trtm(mpou4om nmfvslsf Dtru  ;o1apto f3iasfa umnmo ()teeomr3oodlptraieolt srurimpnodlmenmfvsls)artmx  ;u1alxo i3iadlmDem(msnt0tltrxr3tydfpDr uvo ( sexm(m3oodoleemivta(f rrr(ro;t0apxo oetat mDulu o;(0arenxo3oadfm eanvs ( s2ur(mpoy1apt licilt) 2uru p;u1aeeoioeiltfs2uan ont) ltrircty1fpt  n i t0 2tm(m nu4altelnct tfaDtmx pot4tlxomociltls2em(mpnu)teenmrcto1fm eaivils)srurxm no4ameemfvs t sruru pou4opxoif3iytlsDelu s t4 eenxrciy1opDrlivi;s0trumxmpny1lpee ictlsfaDtmxro;u4optnmfeiltfmDulnmpn()trerir ia1laD aues;(0srurxopio4am elivslt)a2umxmo;t1tlt iieiysfa2rlu pnu0treoifcoa1fatr u sls) rurio oydame micsat aDurumpnu4apenioeiadls emn onu4trtoxr3totfp r ivs t)t2tmiopoo1op nmfcs t)srtax pnu0opto oeilsfmDra(mp u)treriocoydfaDr i ols) 2um(r nudopte ncsls  Drau  nu4oexnmfciydlaDemnvo;u0tlenmo todlm eluesls)texoxmpiu1om emfviat s2rmurpou4olt ii3tytla2emuvo (4trtrmo oa1lpD  nvs s)sexm(m3oodap nmnetlt sDrm(rp;u1apxnmo3tasla rlnvpn(0 rtrmrctotfat  uei s0t2uo(mpiydopenmnvs tf Dra( p;u4oltnioeilsfa rm( p () leoxr3iytom  an sls0t2xoim ny4lleemivsat sDtrxmpot4alxnifciad s rmuvpn(0tltrio3oa1omteaues;s0texm(r io4alen nvsa() 2trxmo;o0ale  fetadlaDrl(vp t0 lxrif oydlpt lu s;t) rurxr nudllenlnviat) Durx p;o1opeoiieiytlm rmn pnu) lxomr3oo1lat aueol(  2xoxmpoo4olt  ics sfartr(  ot0tetomoeiytfsDrlnmon(4 renmo3ia1lm r n ilt0 rxrxo ou1lptnmnciat)srta( ooo0teenmoetydls2rlnmp;(0aetrxr iotoa eai s s)srxoxr ny1ap n fvsas srtm( oou0alx  ociltfmDrlnvs;t0trtnxr ootla rai s;t)s2urir3iy1ol elfet s)a2raurpnt4tpenif3ils s eau s;u)trtnxfctydlpD luvs ( srumxo no1ape lietl( sDrau p;t0aeeo ietat a2rmnvont4 exnif3iytomtraneils s2xoim iy4lpenlfvtas)sDur(m ;o0alx iieildlaDeanmsn(4tlxrxf3iotlat luvi;t)s2xm(rpoy1omeelfvsasfsDrau  nu4apx  icils aDem(vsnu)aexomr3ta1omtrln o;t0t2xmxrpiu4altemnet s)aDuaxmp;o1tetn ictld s umn pn(0 ltniociadom eaies;()trto(mpio4lleemneiltfs2tauroou1alxomiciad a rlu o;(0tltoxr iodlaDeanes ( setmirpnydomee ieslt) Drm(mo;o4tetoiieils m2ua(msnu0 rermf tadfp  auei;t) 2ur(mpou1aptn ivi s) 2tr( pno0aetnii3iys m2rmuvs;t0artnmocoodfmteaiei;s0t2xoirpiydalt lnetls) rurxrp;u0tetnmictat s2rluvsn(4tlenxr3oydopte nes ( trxm(opiydal   iviatf rrrur nt4aeeo o3iltla2elumonu0 renxfctytlmDelieilt) 2uo(m3oydop eliesa( sDtau o;u0oltnmoeils sDem(vpnt4alenxocoydla  auvilt)s2xrxo3oo1llte fesa()aDtrumpou1tlto f3ildls eanvs t)teenioctadlat ai s;s texr(o no4llt  ncsl(f rra(r nu4tpeo ociydls ulumon()aeeoif ootlaDelueslt0 2uoio3oy4aptnlfviatfa2umxrpnu1tpe io3tls mDem( snu4artrmr oa1omtrauvi t0 rxrio nudlmee ivsltfsrta(  no1optoii3iytlaDrm( o;t4 reomf3oytfaD anvs t)s2ur(o oodal n ivilsfsrur( oot4oex ifeilslaDemn s;()aetrif3ia1faDrlueo;(  2um(rpiu1op emfeta(f 2raxrpot0opxoifeiys m2ra(mon(0alxoir3ty1oa eanvil(  exmimpnu1lmte netl(farrmxmo;u4apeo ociysfs2um(mp u)texnxociotfm rlieil()t2toxmpnodlptnlfet t)srurum no1opxnio3iasfaDuaumonu) exrxf iotfpDe ieils t2xo(mpoy1lmeelicia()arra(ro;t1oex ifctyd sDumn pnt4teeomr iatla  au o;t)srtrxm iu1ol  lfvsat)arraum nt4tlt mi3tydlmDrau s (4texomociatfpt ai s;(  2xo(opoo4lp n fctl()s2rrurpnt4oetomietltfs ua(vo;t)tlenir3io1oa eluvols0s2xrxo3no1om nmnvs ( arraum oo1apt ifeiat a2rluvo;u0tleoxrciy1oaDeai slt)s2tm(r nu4ap elivs sf rta(rp;u4oeeoifetls aDrm(vp;(0aexomrcty1fm r u o;s) eumim oo1ole  icil() 2urumooo4tleomi3iad s2em(mo;t4trtoio3ta1fp eaueils0 2trir3iy4ome  icia( srtr(rpnu0tltnii3iaslm rmnvo;(0tlxrmfctydfpDeluvsls0t2trxr iy1opt lnvia(  2tmurooo1apxoio3iyslm umnvs t0arxoxf3totla   uvi t0teur(m ou1ame  ivt sf 2ua(rpnt0alxn octld a2rmuvp;()trtomfcootomt  ieo s0srtm(r oodol elfct (  rrm(m ou1tle  f3iysfaDeauvs u)alxnmr3oodfa   i o s0srtrimpoo4ol n nviatfsrur(m no4apx  f3ilsfaDel(mont0 eenmocoatfmt  u o;t0trxmir3oo1op   feia(fsDuaurp;u4tlx mfciasfm rm(monu4 rtrmr3oatfaDeli olt0teto(m3oo1al   fctas)aDua(rpnt0oltomfcildfs2rlnmo t4 rerifcoo1fptr ieo (  eumxo oy4altn neilt aDrm(  ;t0tex mfciat s rau ont4arerxr iytfp e n i;s0 2urim nodaltnlncs s)s2rm( onu0ale mo3tydls2umuvs (4 etomf iadomDeai il(0teto(o3io4lp n ivils  Dur( pno0tet mieiydfa2rmump u4trtnmf iotfpt auvs;t0setr(m iydaltn icslt arum(r oo1aetoio3ildlm ua( pnu4 lenmo3iatomD li i;t0 rtrxr3nu1omeelfcs (  Dtax o;t0oex  f3tysla2elu p;(4teeoxrciodlaD  n s t srtrim3nydlptn fes tfsDtaur ;u4tpx  oetat s2emu p (4aexnif3ootlmD aues;t0s2to(r no4ope  neilt) 2rmx  nt1oex ii3ilsfs rlnmpn(0trxrxrcio1faDeanvo t0tetriopoydlmtemnesas)s2urxmp;u0alt ii3iatlmDrm( sn()tlxoifcootlat liei (  ruo(opiu1ole  ics ()s2ua(rp;u4tex iietltfs ua(ms;(0artnif oodfa  lnei;s) rtrio3nu4lpte neils)aDuru  nu4aexoif3tltla2emu s;t) etnir oodlp eaivi t)t2uo(opno4alen ivtas) 2uax onu0tltoifeilsfs el(ms;t4arenmr oodfa rau s;s0 eum(m3oy4apenmfvsl()a2um(rooo0tetnmo3tadlaDuau sn()teeomo ootoa  lieo;s0teto(rpiodopenmivsl()aDum(  no4aex  ietlt mDea( snu)tlermocoatopteluvo;t s2xrim3no4oltelivil()a2tm(m nt0oltnmi3tydla2emnvs t4 lxoxf3oadoptrauei s0 rxrxm3ny1lme lfvsl() rraxr ;o1tpt iiciadfs2emums ()texomf3tadla  an i;t0srxriopno1olee ncsltf 2rmu  oo1alxoiietydfaDeln pnu)arxnif oatfmt anvols0srum(m3nydol n fet t) 2uau  ou4alx  o3ild mDem( o;u0aeerxo3tadoatrlivils0s2um(m3iy1lltelfcs t  2umx ooo0tlt  iciytlm ea(mp;u4tetnxf3totlptelnvs;(0 ruoio iodoltelictls) Dumx  ;o4opxo o3ilsfa eanvo (0aetrmr3tytlp  ln il(0setm(o oy1lptn fvtls srtru oou1tptnifciys s elnvp u0 leoifcoodomDrln s;()setr(o iydamt  ivsa( a2tmur ot1aeeomo3tad s ra(vo t0trenxr3oo1oateanvs;s0trumio3oudllee ncsat artax p;t0aeeoif3tydfs2el( ont)aleniocta1oa   nei;t)t2triopio4lpt mfeia(f Dra(  ot0apt  oeiyd a eanmsnt0arenio todlmtrau ilt0teuoxo oy1al nlnei s  rtmx  nt4tex  o3iytfa2rl(msn(4teenif to1lpt aues t)setr(m oy1lp e icslt)a2umum ;u0tleo oetls s ulu p;t)tltomfciotop raieo ( s2trir iy4omenmfeta() 2tr(r nt0ale if3ildfmDeln s u0 rxnif3ia1lm rluesl(  2tr(mpiy1lmtemics (faDtmu pno4ape io3ias s rl( pnu)arxrxfcoytoptrln ilt)t2tmxrpoydopte nvtas  rtm(r ot4aetn oetld s2eln p;t0 ltrmr3ootfpDelnvi;()tetrxm3no4aleemnes tfsrtmu p;o4alt  ociaslsDeanmo;(4 etnir oa1lmD lnvi;() rtoir oy1al  mivt (f Dum(ront4oltoiicildfmDumnvs t4alenxo3totfmD  ues s0s2tm(r3no1omeelnvtls)artr(mont4aet mieiad m rlump t)teeoir3oa1lpDeli i;(0setoxm3ny4am e fvsltfaDra(r nt4altnmo3ias s rl(vo;u0treoir oydomD lu o;s)teto(o nu1ol elfeta(faDtmu o;u1aeen ociyslaDeanmon()arxrxo3to1lm  luvo;t)trxrxo3nydomt mivsa( a2tau o;u4ope  ociytlaDuanms;t) rxrxr ootfpteaivs;t0s2tr(opoy4omtnlivs t  2trumpot0alx ifetytfmDrlumsnu4 eenxocoydfaDrlues t0texoir ny4lpenmietlt  2rrxmpnu4alxomi3tld mDulu snu0 rermrciotopDrlneo t s2xrxr io1lp   fcs t)aDra(r nu0optnmociytla ulnmon(4 lxoxrcto1fm rauvo;s)srtr(m iu4altnlivil( sDrmxmo;u1tpx  oetld s umnmo ()aetnir iadlmt  i s;s  rto(m3nodal elietl(fa2uaur no0oltnmi3tltfm eaump;u0 lxrxr iadlp r uvs;t)srtrxo oudam elnci ( aDrmu  ;t0olt mociadfsDea(ms;t4arxnxrcootlp  lieil(  2umxmpiu1optnmneil()s2ta( pot1aptnmiciat m2rmumon() ltomr tatomteaivsl(0texmir3oo4apee ict ()s2uaumpot0ope if3iytla2ulu s;()texrir3ootop ranvo;() euoxr nu1altn fcs t sDur(r oo1tpen octadlm umnmont4aleoxo3oo1faD aneo ( srxoiopny4lltnmicsas) rtau oou4aeto feiyslm2rl(mp u0 eeoif todlaDrluesls  euo(rpiy4lpen ict s  rumx o;u1ope  oetatls um(vp u0teeoir3iydfptrlnei s0 eumir3nodlme lfvsltfaDuru ooo1tlt ifctadls ea(mp () lxnmo3iadlmteanvo;(  euoxo iu4llt lnvt t) rum( ont4tpen iciad a2ua(vs u4aetnirciytfpD aues;()srum(m iy4lptemfcsa()arrrxr ;t0teen ieiasfa2ra(vp;u) renmo todfm   ivols srxoxo ou4amt  ncta() 2rm(rooo4oet ifetlslm2rmnvs;t4arerio3tatomtrln ils s2tmxo3ou1optemivtls)s2uaur ou0tetoif3ias s2rm( o ()altomo3iodfptraivs;(0t2tm(m oydapt  fct s artr(rp;o1tpx iiciytfs emums u0teermociydoat lu ol() exmiopiodop nlfvi tfsrurx pno0tex  i3tltlmDrm(ms;t4 ltrxr oadfp e nes;s  rxmxm3iu4oltnmfcsatfsrrrum nt1oetoiiciyd mDel( snt0 eeoio3iatlpDeaivols0 rxrio3nu4llenmfciat)s2tm(  ou0oetn f3iytfsDuanvo;t0 rxnmo3ty1omt  neils0tetmim3ou1lmenmicsasfa2raxr ou1optoiociyt aDrmuvs t) rerxrcoodoaD  uvi s0srtm(o oydllt  nciat aDtr(m ;o0aee iociat a2elums;u4artrio iy1faD  ivs;()t2xrio3no1lpt  nctls sDrax  nt1ale mi3tadfsDeanms;u4treoxr tydomDrai o;t0trum(r3io1ame licilt a2uaxr nt1aee ii3tydlaDum(vpnu4alerxf tatfpt  ivilt  rurxr3nu4am nlfetat)srrmx  ;u4ole  oetldfmDrau on(4 ltnio3iytfmDeaueo t)srtmxmpiu1apeelfvta() rra(mo;t4tpxoio3tadla2uaumo t4trerxf3tytfmDrlivs (0seto(rpnu1apen ncils aDurxront0apx  f3tls a ulump ()tetrxf ootlaD  n i;()setrxm iu4altn ies t a2uaxmo;o1aexnmfeild m2emu p (4tlerxo3ia1fp rli ilt0 rtoxr3nu4alee fvil() 2uaxrpno0alt ifciadlmDelump t4arxrio tydop r ieo t0sexmxr iydome lnci (f Drr(  oo0apxomieild m elums (0 lxnif3oytfatr uvol()t2xoxr3ny1ap n iei t  rrrurpoo0opt  ociysfmDrluvo u4 rtnif3tydomt livslt sexrxmpnudaptnlfetltfsrrax onu4tee mfcildfm rl(vsnt)alenmr3oy1op rln s s)trxmim3ny1am nlnci sf 2uaur nt4apxn feildfm2eanms;u0trxrxo3oy1omDe ivolt0tetm(opiy4omeemnvsas s2rr(mpou4aetnmociadfa2emumpnt0 etnxo iadoaDeaieslt  ruoxm3oo4amen iciatf rtr(mo;u0apxnio3tltlm rl(vpnu)texrircty1lpt  ivsls0sexrxm3oo4omtelieilt) Drmxro;u1tpx  ietatfsDrl(vont4artnio tatfm  livs (0 rto(o oy4om  mnetl( srrm( pnu0ale  o3ilsfs2eaums u0tltnir tatlm rauesls0srumir no1ape miesatfsDtaxmpnu0tltomo3iasfm2uluvp (0 eerif3oo1la eau o t  rto(opno1om n fcilt  2rrxro;o0aee  f3iyt s el( o;u0aeenmociotfmDe u ols  etriopou4ome mfetas a2urx ooo0apxn oeias sDuaums u4trxoifctytfm rau sls0seuoxrpnu4aptelicilt)aDrmx ont4tltoiieiydlaDua(mo u) ltoir3iy1op r n o;t s2uoxrpio4olt mfvsat a2rr(  ot0olto ociasfsDemump t0tlermr3to1faDrlneolt t2xmim no1lmtnmfet t)sDum(  nt4oee  i3tltfa rmnmsnt4treomrciodoate u sls setoim3nudoptnliet t artmxrooo4aetnmoeiasfaDrlu sn(4aetnmf ty1fp rlneilt0setmim iu1apeelfesls sDurur ;u4tpe ii3tadfaDeau onu4 rxrifcia1omteauesl(  rtrir3iu4omee ies ( arrmum nu0tltoioeilt sDemu s;t) ltnif3to1lmDr n o s0tetrim nu1ameemivtltfaDta(ro;t0texoiieiydlaDelnvsn(0texnif3tytoaD  ies;s)trumim oo4ope  netl() rta( p;o4apeomfeiadfs uauvp (4 leriocto1fatrlieo s  2trim3oy4amtemnct ()s2um(ro;t1oltnmf3iatla2eanmo u4altrmf3oa1fm  lueils  2tr(opoy4op e fcsl() Dtrx  ;u1aleomieiyt aDeanvo;u0 lxomrciotlmtrlu o s s2tr(m ou1aptn nviat s2umur ;t0ope mieilslm em(vsn(0trenif oadfpDe iei;s) 2xm(rpoydam e nctlt)artmumoot4oltomociydls2rl( s t0aeeomfcto1faD aivs;s) eumiopiudlpe mfcsat a2rrxm nt4tee ioeiatlaDeanvp;() eenirctatfmDeaiei;s)trurxm nydalt lnvs tfsrurxmonu0oeen ieiat s2umuvs u0alenio3iatlaDran i s0t2uoio3nu1open ictas)arurx  oo0oeto octyt a uaums u)texnxr3iytom   n olt0s2xm(opoydlptemivsa(  rra(m nt1teeoioetydls2emums (4 ltnmr oo1omtelieilt0t2tr(o3iudolte nesls s2umx ono1aee miciadlm2ul(mont4altniocia1la raivsls  euo(m3nudlm nlncias)artr(m ot0optniiciydls rl( s;u)trxomo3ta1omD lueslt)s2uoim oo4altnliei tf rur(rpno1tlto ictas s2umu s;u4trtnxrcoa1lp   nei;s0 2umxm no4optelicsls) 2ra(mooo4alen o3tasla2rlnvs;u)aetnmrcta1opDraiei t)srtr(mpoy4lpeemieiasf Drru  ;o1tlxnmoctydla2ua(ms ()aeenirctotfa eai s;t0 2xrir3no4lmenlncs sfa2rrx  oo1texo feiat mDrl(vo;(0 exnio oatoa   nvolt  eurxm nu4omenlnvt t)sDtaumoot0oee  ietatfm2emu o t4altnioctadlat  nvi;t) 2um(r iydolenmfvsat)a2ra(mo;o0opto ieildfm2uauvpn(4 rxnmrctytomteluesl(0 exoxmpio4am elnei tf 2um(ront4oltnmfetltfa2ul(vsnu) etoif3io1omte neils)t2toxmpiydlpen fesasfartaurpnt4tpxomoeilt mDul( onu4artoif iy1latrlnes (0srtmxm iu1lltnlnvt s srur(rpnu1tlx mfeiltfm2raump t4 rtoio3oytomtraueo;()srtoimpoydapen ncs (farur(mpoo4oexo icias s2rauvont) rxrircoadom   uei;s0srtmio iy4ome  nvi sf ruaum oo1tpen ietytla2emnmp;(4 reoircty1latr ies s0 exo(mpiu1opte fvi s  2ra(ro;o4tleo f3tyt sDrau p;t4 ltrir iotom  aivs;t0 eur(r iu4optnlnei s s2umxm ;o4tlxnmociadfa2ean pnt0alxrmo iadfptr ivs;t0 2toxm3oy1al nmnvi (  rrm(m ou0oleo ictydfa2rmuvont4aetoio oa1la eanvi s) euoirpio1openmfetas  2rrxro;t1teeoiiciltlm ranvo (4alxoif oy1omD lu s t) 2umimpou1lltn nes t)arraumpno4tlx  feias s2emuvo;u0treoif3oydfmtrluvi t0 rtmxr iu1optn fei ()aDtmxrooo1tle mociad m eanvsn(0 exnif ootfpt  iesl( t2toio io4llen nvtl()arrru  ;u4tpeo o3ilt s2uluvsnu4altnif iytop rauvi t0s2xrxr nydll elicils)arua(rp;u0tleo f3iydla ulu o;() lxrxf iadlat  n sl( t2toirpio1al   net t  Drrxr ;o4opt  f3iydlsDrauvo u)aexomr3oy1laDeaneo s srtoxr oydoltn nvsa(fa2tr(mp;o1alen fciyt sDeau s;t4texomo3tydla  aies s s2xoir3no4lp  lneias aDrmumonu4oee ifciysls2ra(msn(4 renir to1oat aieil(0 2tmim iu1ameelfcias sruaxrpoo4oeeoiocilsfa ul(mo u)trxomr3ta1opt au sls0t2xo(r3ou4olte icia() 2ua(m no0ope ioeiyd a rlump (0 rxnifctodfp r uvs t)trumxr3ou4am  lnct t aDtm(rpnt4texoiicils sDelums ()trtrxfcoo1lm eaueo;s t2urxrpny1lp n ivs ( aDtru  ;t0opt iiciyt aDemuvsnt0teenmo3oatlateauvs t0s2toir3oo4llte ncsls  rrm(  nt0open i3ild a ua(ms;()tleoif3iatla e iesl()seum(o no4omtelfcsatfaDtr(r ;t1aeenii3iadfaDem(mp (0arxoif iy1fm rlivils)texo(o3nu1ale lics s) Drmumpot0tlx ioeild aDuluvon(4tetoxo3iotlaDr ivi (0t2tr(r3no1lptn fvt tfa2trx  ou0aeeomoeiadls ran snu0aexrmf3oytlpDrlueilt  rtrxm3ny1opte nvta( a2ururonu4opeo ieiytls ul( on(0 ltrxr todomtrlivi t) rtrxopiu1lptnmivtas srum(rpoo0tltniieiasfs2rm( o;t)aetrmfcootom ranvo;t t2toimpou4alee nctas  2uaxro;o0teeomieiydfm2em( o (4treoir iydomDr i o s  euo(m iudale  fvil( aDta(ro;o0teto o3iad s2eanvp u)aexoxo3ty1omtelivo;()srxoio3iodolt  fesl( arrmxr ou0opxn oeildfm elu o;u)artoirctatom  lnvi s  euoio3oo1lme miesl()srurxm ot1aeen o3iyd sDumnmo;u4 exrif3iytlptrli i;s trxriopoydlme  fvsl() rtmxrpou1aee mfetyd s2rmnvo;(0trxnif3tatopD au s;() rxm(o io1amtn ivi s) Drmu o;u0teenmo3iydls2uanmp;t4alxrirctadfpD aivi ( seumxm3ou4ole lfeiasfa2urxrpou1aexnmoeils a2uaumo;t) etnio oytlat  n o;t)texoim iu1omtemnvs t)arrru pno4alto i3iasfaDul( p;u)altrxo ta1opteanes ( teur(r3io4lm nlfeia() rrmxmo;o1aeeomoctysfsDrln onu0trxnxo totlpD ln i;(  etmio3nu4op  mfei sf Drm(ronu4olxo o3tatlmDeanmp;u0 reomf3io1lp eai slt0sexmiopiu1op n nvt (f 2ua(rooo4ole  iciadfa2ua( p;t4texrif iy1laDrli il( texoxmpoydalenlfei tf Dtm(mp;o4ale  ictldlm2eauvon(0 rermrctytfa e ivols seur(o ny1lpt mfeta()s2uaumonu0olxo oeiltfa2emu o;()trermfcoadlpte n olt truo(r io4lleelfes t)srumxmp;t0tetnmfetas m eaump;t0aexnio3iodfmt lnei s)sexm(m3io4om nmiviatfarra( p;u0oexn oeiyd a ean s u)tleoxocoa1fat  ieolt)trto(r oo4lme licsa(  rurx pnu0alx  fciad aDemumo u0 rtrmo3io1fptrauvilt) 2xr(m3nydllt miviat)srrmxmono1tlto i3tyt s ul(vont)arxnircoadfmDrlivo t  eumxr3oudlmenlneslt aDururont4aex moeiasfmDua(ms;u4 eerxo3oadopDrlnes (0 etm(opio4alt mnvt t)s2urum ;t1oltomf3iytlmDuanvs;t0areoxf tydfmDe iesl()texrxr iy4ale lnci s) Duau  nt0olxn o3iaslm rlnmo;(0aetnmf3iodopDraues;s)t2umxo oy4op e net sfaDrmumpot1opt ioctadlsDra(vs u0 etnio3ta1lpDr u o;s)teurxmpiydop elfvta(faDtax ont0ole mfetld a2ua(vp u)trtnir ia1lmtrauei (  rxrirpiodlmeemivias a2rrxronu0tpe ioeiytls2rluvs;u4trtrir tadfmDelnvi (0texo(r3iu4ole lfci ()artax  nt1oet mi3ildls ua(vs (0aeeoxo3oodoatrlues ( tetrxo3no1al nmfvia( srtru ont0aex  oeiat sDrmumo (4tleoxfcoatopDrlivo s0 rtoim nu1llte ivt ( aruru onu1tleo ocild mDelnvo;(4tetoioctydfm  aivs;s  rxmio3iodamtnmietas)s2rmxmo;t0oltomoctld mDumumo u0artomf3totfpD luvi;(0trxmirpou4ame lnciat s2uru p;u4opto fciyd s el( p t0tlxnxfcoy1optr nvo (0trxoxmpiu1lm elnvsatfs2tr( pno4oeeomfciltlm2el(vo (0texrmr3iatoa eai i;s)tetoim3iodllenmici ()sDurxmont4aptnif3iatfa2elu s u4trxnmf oadopD
\ No newline at end of file
@@ -0,0 +1 @@
+ueo;s texmxr3iudll nmfctlt) Dur(m ;o1alx  oetldfs rm(msn(0 eermr iydlmt  u s;( sexoxr3no1am  mfcia() Dua(moot1aet mociatfs2rlnmpn(4tlxomo3ty1lmD auvs t)t2xmim3iudlmt mfci sf 2um(m ou0alen oeiydlmDrlu p u4 renmr3io1fm rlnvo s trur(mpnu4amt  ivi ()srumurpnu0opxo ociytfmDelumo u0texnxrcoytlpD ai i;()srtr(mpiy1lpenlivtl()s2rm(mooo4oleoioeiadlm eauvo (0teenir3oo1fp eli o;t  2xr(o3no4openmncs ( sDum( onu0apeoifeiydfs2ran s;t)alxoxf3oo1lmD lnvi;s0setrxopno1am e fvtl(  2rm( p;t1tpeomfeild aDem( p t)aexrmocio1faD  ieilt seurxrpio4alt lncs t  rurum oo0alt mfeiydfa ra(mo ()teerio3to1fpD  nes;t)srtrio oodome mfcs (fs2trumoot0tlen feiatla2ua( o t)tltnio io1lpt ai olt  rur(r io4aleemfcil(fsDrrx  nu0tlenmfetydfm2rlu p;() lxnmo3ta1omtr u il() 2xmir oudal n nesl()srtm( oot0olx mfeild s2uln p;(0trenif3oydfmDrlnvolt) etrxo3iu1am  mfcia(faDrmxrpot4tet io3ias aDrl( s;u4 eeoxr3iotoaDeau s s sexrxm3oo4amte nvia()a2tm(  ;u1teeoiieiaslm rmuvont0alxnif3iadlpDelnvs;s t2trio3io1aptnlncta()sDumxr nu4oeeo f3tlsfm rm(mpnt)altnmf ty1fmD anvo;t0tetrxr no1ol e fei s)aDtrxmpoo4tet ifetat s2el(ms;()aeerxoctadlpDrlueols0srtrimpou4llt mfvsl(  2urumonu1ole mieiadfa ul(vs (4 ltnmr3oytlptelu olt0tetm(mpnu4ome  nvi s arrau ooo1apt ii3tydla2em(mo;u)teerxr3iadlateau ils0 eumxo oodlleelfeiasfaDtaxrp;o0teen ictat a rmuvpn()tlenmf3oatlaDrluei s0 rxo(o3ou1lleelfci t) 2tm( p;o4tlxn feiydfm em(mo;u0 renirctodfmtelu s ()t2trir3iy4omeelnvt tfsrtm( pou1ape ioetydfmDua(ms t4 rtoir3ootfmDelivslt)teumim3ny4lpe  fei tf Dra(mooo0olenmociad a2ranmsnt4alxnmf3todlaDeluvol(  etm(o3iudomtn ivs (  rurumo;u4aptnio3tytfs2emumo;t0alxnxf oodlaD an i;s) exoxmpnu4alt micsas srumu  ot1oeeoioctlsfm ulnvs t4 ltoir iy1lmteli il(0sexm(mpnudam  lnviltfsrurx ooo0apt miciad aDea( s;t0arxnif ia1fmtranvi;()sexmxm3oy1lm  lfes t s2tm(r nt4oleo ieiydla2el(mp;()aeermf tytom e ivi;(  2trxm no4ape lnvs sfsruax ont4oexo fciad m2em( p;u0aeermf3tydoptr ivolt0 exoxo oodopte neslt)aDtrumpno0alxo o3iatfa eluvo;u0 renmfcoatomDrlu o (0srtoxmpny1omt mfvt (f Dumur nt4aptoifetytfa rluvo;() eeoxrcootla elies;s0 rtrim3oodal n ncsl( aDtmurp;u4aleomfctasfsDumump t4tleoxf3oytfa e n i (  exrxr iodop emicsltf Drru  ;o1tltniocilslmDrmn o;(4arxrmr3tatlmDe ueols seuoxrpoo4alee nei (f Dra(m ;t0teeo fctytfs ul( snu4arerif3tadopDelivi;t)t2tmxm nu4lpeelneslt) 2uru ono4tpto ociat mDrmn o t)alermr ta1lpD  n s ( truoiopoo1ape lfctl()srtmxm oo1tpxoifciyt a2rlu p;(0 renxfciotfptelneil(  2xo(m3ny1om  mfcs sfs2trxr ;t1oltomictatfaDeluvont4tlxrmr3iytomDr n o;s)srumxm nu1ole  iei ()s2taum ;t0opxnmoeiysls emumo;t4 renxo tatoptrlivols0setrxr ou4apt lics t  Duax pno0tpx mi3tldfm2eanvs u0trxnxociatlmtrlnes;s0 rtr(m iodll e fvil( aDtm(  oo4tlen i3tldfm2uan p;u0teerxrcoo1faD  ieo s0t2xr(m3nodoptnlfvtls)a2tru pot1tlx  ieias s eanvpnu4tetrmfcoodomD aueslt0teurxmpiu4aptelncil()aDtmxmonu4tpeo o3iadlm uaumsnt)altnmo io1opD  uvo;(  ruo(opnydope mivia(faDurum no1tpxo i3iyt mDemuvp;u0aexnmf todlm eaivil(0t2tm(r no4llee fes sfaDta(m ;o4tlenifeiytlmDumnms t4 ltnif io1lmDelnvi (  rtmxm3no4ol n fctlt)a2urxrpnu1texnmiciadla2um(vp;()texrxo oytoaD luvi;t)trtmxo oo1ole  fviat)s2tru  ;o0oltniiciyslsDem(vs;(4arxnxf3totfa rlueo t) rumxo3nu4am n fct t)a2rmu pnu1oex  ociydla2emuvsn(0 etrxoctytop raivil( setrxmpio1ll e fcias  Dtru  ot4apto fetyslmDrmu o (4aexrxfciotlp rauei ( trtr(m3oo4llt lies tfa2tmxmont0ole moctat m rmnmpn() eeomrcoydlm  anvs s) eumimpnu4apeemnci sfarrmx o;o1tet mieiys mDua(vp;(0aetrmo ootfaDe n ols)trxmxr3ny1lmtemnet ()srtaxmo;o0apx io3iyd mDum(ms t4teeomoctatlat lneo;s)t2tmimpoydlpeelnesl(fa2tmur nu4tetn feilt m2rluvo;t0arenxo3oa1oat ai i;( teuoxrpiu4ap elnetls) Durump;o4tpt mo3iad mDem( on(0 eeoxrctadlp eli sl( teurir iudalee ici tfsDumxrp;t4alxo fetatls2em(vo;t)altnxr oytop rluvs;t0srum(r oydlmtelfvtat srumur ou1opto i3tlsfm ea(mp () etrxo3ta1omD lnesl() rtmxm nu1lptnmivsa(  rumxm no0open f3iydfm2emnvp;(0 lermf todfatrlieolt)srxrxo3ou4ape mfctlsf rtrxr ;o1tex mfctldls rln p;u) exoif3iotoaDrau i;()s2xrxopnodome mieils)s2trxroou0aeeomo3iydlaDul(mo;(0 rtniociatfmte nesls trumxm3oo1amtn fvtltf Dtaumpoo1aexnif3iat a umnms u4 lxrxrctodlaDr n o ()t2xoxo no4optemnvt tfs2tm(mpot4apx io3tlsfs2ra( p;()altrmf3tadfaDeauei t)s2xrimpnydaltelfetas a2tmump;o4tpx  iciatfa ua(vo;(0tleoxrcoydfpDrau s;() 2tmim3io4om n fvi sfaruaumoot4tetniociyd s2eluvs;(0 eerxociydlm e neols  rxoxo oudlle lnvs t s2rr(r ;o4ape moeiad a emumo t0trxoxf iodfp eauvs;s0 eur(o oo4al nmiciat  rtrum nt0alenmf3tysfaDelnvs t0 lxnif oytlm eliei;t) 2xr(r3iudlm  lietls)a2tmxrpou0tpx mfcildfs emn s ()aexnmf3oo1fmte n s (0srxr(rpoo4apt  fet sfa2rmxmont4tpen f3ild a2ra( pnu4 etrxr oatfmteaieo;s)s2trxo iy1ameelivsatfsrtmu p;u4aeen ictysls el( o;(0trenmf ootlpt li s t) 2toimpoodlp   fei sfsDtrumoot0oee ii3tlslsDuau s;u0arxrir totlm raivi;t)setmimpno4lmtemnesas) Dua(r oo4tle miciat s el( o u) etrmf3iodfmDraiei s)sexrxr nudam elnvs s  rtmum oo1tlt mociydfa emu p;u) ltnxo tatop rlivi;s) exo(o3iydolen neils)a2ta(mont1tet ioetadfsDumnmo;() rxrxf oydlp  ai i s)seur(m iodaleelicsas a2raxm ot4olt mo3tltls um(vo;t0arerifctadlmtelnvi;t) eumxr3oodolteliet () Dum(m nu1alx  ieiat aDulnvo;(4 ltnmo3io1omteluvi;(  rumimpoydomeelfcs s aDtrxro;o1ope ifctadlm rmu s;t4texriocta1oa ran sls s2ur(m3iy1ol e icta( a2tru pou4ale ii3tas sDulu pnu4alenioctodfpDeaivs;( t2xr(m oudllen fci s sDua(mpnt4olt  i3ilsfa2ea( p;u0artrir oodoatranei t)trtmir3ny1ll emivs (f rtm( oou4apt ioeiyt a uau pnt4 rxrxo tatlat  n s t0 exo(o3io4om e ies tf rua(monu1alxomoeiydfaDranvsnu) lenxr3tytop r ueo;(  eum(o iodaltemfctatfs2umurono0texoifciyt a rm(msnu)arxoif3ty1lmDrai sl()tetoxo3oy1lp elfcilt sDur(mp;u0tpeo iciytfs elnms;() etnir iy1laDean o t  ruoxrpiy4amtnlfcta( s2tm(  nt4tpen ietyslaDrluvont)tetnxo3oatla rai o ()s2uo(mpno4ape lfciasf Durum ;o1opxnmfeiydfsDemn snt4 rxnmo totlatr n o (0s2um(r3oydoltemivtat  2ra(rpoo0alxn ociyd m2rlnmsnu4 etomfciodom raneo ()s2xoxm nudome  icia(f rtrumpno1tpt miciatls em(ms u0 rxrmr to1omDrlneslt0t2xo(r oudam  mfvsls sDra(mp;u4teto ocilslm umn p (4alxrmo3tatlat  nvil()t2umxo io1ameemneil() 2tmxronu4tpt iociydla uauvpn(4tlermf3ta1la r ivs ()srtoxm iy4lle lnvta(fsrua(r nt0oet mf3iysfa umumo;t)teeriocootoaDeli s;(0 rxoxr3ou4lme lnctasfarum(ront1tpxo iciyd a2eanmon(4 rtrxocio1la  anvol() 2toxm3ou1al n fetas a2tm(mooo1opxnifcildlm elnvs () exoif3iatoaDelieils  exr(rpoo1op   nvtas) Dua(rpno4optniociyt a emumo t) etomf oodop raiei;t) etmirpnydalt lfvsl()s2tm(ro;o0apt if3iyd m2rmu o (4tltoio oa1laD lieo;t)tetm(o no4op elieia(f rtm(mo;t0tltoioctlsfs2um( o;t) reoircoatfptean slt0texmxo3iydomtnlncias a2rrumo;o1opxnmf3iad s ulu onu) rxrxo oadfm eaieo s0srtmxo iy4om e fes tf Dtax onu4oltomfetys mDeaums t0 eeomr iotfpt  neo;(  rtoxmpnodolen feil(f Dua( o;t0opeomfciadfmDrlnvs t4tleomo oydomtrlnvsl()trtr(o oo4lm  mnes s aDrrx  ou1oexomf3tys s emu p;u4 ltrio3oy1lp r ueo;s)trxoxr3oo4optelfvtas sDur(  ot0oexnio3iyslaDelnmont4aeeoifcto1omDeauesls tetrxmpnudapeelieta(  rtr(r ;t0alen ietytfsDulnmo;()aeenxfcia1latrlivils srtoirpny4amt  iesls)artrurpou0aee mo3iltlm ranms;() leniocoatopt  ues;s setm(rpoydlm nmictlt) Dtmurpoo0opt mieiatlmDrl(vsn(4tetnmr iatomt  n i t  etm(mpny4ole  nvil(farumx p;t4olt  fetatlm rln snt4alxrmfcoatlmDe u i;t)tetmxo3oudol  mfcia() 2umxroou4aet mo3ils m umu on(0alxnircoatoaDr n s;t0trxoxm3io1llee nes ( sruru pno0aexn o3iltlm emnvont) renmr3iy1om rluei;t0t2uoxmpiudll elici ( a2tau poo0oeenmo3iytfaDrl(vp;u0tlenxrcoytlptrlu o;s0 2xo(o3io4op e ivtl()srtmxmpou1apeoif3tldfa umu snt)trxomociadlpt  ieolt truo(o3io4lp emnvt ()sDururpno1aeenifeiysfs2rmuvpn()trtomf3iy1oate i sls)t2xm(m nu1alenmiesl()arua( oot4alen oetyd s2el(vpn() lerifciotlp   ivo;s)tetmiopou4lp nmncta()a2rmxmp;t1opx  ietys aDuanmo;t)artomrcoodfm eln ols setrxmpno4lm   fetatfaDtm(mpnt4apxomi3iytfs rm(vp t)tlenmrcoodlptrauei;t)t2umxr oodomtnmivt t)aDtm(  ;u1oeen i3iyd sDrl( s (4treoxr ia1op ean i;s teuoxrpoodllee nci tfsrururpou4aet mf3iysfs2umnmp t)aexoif iy1lpDelnvs;t0trxr(o3ou4om e fciat)s2tmxrpno0apen i3ildlmDumnms ()alxrmr oytoaDelivs (0tetoxo3oudapeemncs s aDta( p;o4tpxomo3iydfmDeaumo;u)tleomr ta1lmtrlivolt)texo(o3ou1om e fvt s aDtaurpoo0tlt ioctysfs eln s;(0trtnif3totoaDraivo;s sexoio3iodoptn fvi t) rrm(m ot0openmo3iysfa2ul(mon(4tltoir3iy1laD  nvs t)trxm(o ou1lmeelncilsf rrr(r nt4texnmi3iadfm2uauvs;() exrmfcoa1optrai i;( srumir3iu4aptnlnctltf 2umumo;t0olxnmfciydfaDraumo (0trtoxfctadfa e i s;s  2xm(rpiudal  mivi t sDtmu pnu1tex ifctad a rauvonu0trxnmf tatlatr u s s srto(o3iu1om  lictat)aruaurpnt4ope ifeiaslm2el(mo;(4 exniocoytom rai ol()teum(o oy1ale  ict t  rrax  ;o0olt mietadlsDeln o (0texnircto1omt lneslt) exmxo3ou4lmtn ivi (  2raurp;t4oexnmo3tas m ua(msnu4tlerxrciodlmD luvi;s  ruo(r no4ameelfcsas artmur ou4opxoiieiytla2eln s;t0texrxrciodlatr nes t0tetmxo oudlptnlivsa(fartmx  ;t4opeo feiysla ea(vpnu4texnir tytfpDr nvsl()trtrim iu1om nmieil(fs2tmx ooo4oeeomfctydfaDel(ms t0 lxrmf3tytomt an ols  rtmxopoodlp e ict (fa2um( pou1ole iiciysfm2ua(vo;(0altrmf oydlate ivo t) etmxm oo1am  mfet t s2rau ooo4teen oeiat s2em(ms;t0 leoxr3oadlpD au o s0srtrir iu1amenmivi s) rta(m nu1texnmociatfm2el(ms;u0altnif3iotfatranes ()setmio3oydamte nvi s a2rrxr ou4aleo i3iltlm2em(vo (0aeermrctydop rlneo;s0 rtrxm3iudlme mivt t s2taum nu0tptomi3ilt a emump (4texomfctadfmDe i ils0seumxopnu1lptn icilt)aDrau oou4aleo i3iltfm ra(vonu4aeeoxo oydfa   ivs;(  euoxr3nudlmtelfet tfsrraxmpnt0texnmoeildlm ranms t) leoxf ta1fm  aivs () rtm(m3oo4oltnmfvia()arum(  no1olt mi3tadfs2uln o;t)tleomfcty1oa e i s;( setr(m nu4op  lfvtl(fsrtaurpoo0aeenmi3iasfa2rl( p u) reoxrcio1lp ranvslt sexm(o iu4amtemietls)s2rrurp;t4tlto ieias aDuan sn(4trxrif3ootop eluvols  2trio3ou4lpt licta(fa2um(m ;o1aetoio3iysfa2elnmont) eeoxr3oo1fmteaues;t  rto(opnodlpt mnes (  Dtaumo;t0aex if3iytfm2ranmp;t0 lermfcoo1op   uei;s) exo(r3iodape  neia(  rua( p;u4ape  o3iltlsDemump t)aexnmr oatfmDeai s;()srxrirpio4opee iesasf rrmxrp;u1oeen feiydfs2elums;t4alenxr oatoatrln o ()t2to(r iudlmtnlfeiat)sDtmu o;u0olt iieiyt a elnvp;u4tlenio io1fm  anvi s teuoir iudlm elivtl()a2rru pno0aetnif3tltlsDranvo;u4tltnir3to1fat lneo;(  exmxm3nodoptnliviltf Durxmonu4aeenmfctydlaDra(mont)arermr3iadoateanvi ( srxmio3ou1lleeliciasfs2urx  ;t0oeeomo3iytls2uanvs () rtoif3ta1la elnes;t srxoirpnodlpt lfcsl( s2rmu pnu0altnmfetas s uln ont0aleomr tydla   uvo t0 euo(m3iu1amt  fct tf 2tr( onu1tlxoiiciatfs2uanmo ()tltrxf3oo1oateluvo t)trtrxopnodlpeemicsl(f 2ur(mo;t0tpxoio3ils a2rm(vp;t0tleoio3iadopt luei t t2xrimpnydolenmfcsat)artm(  ot1tpeoioeild s2ua(vo;t0 rxrxo ta1fpDe neo t)setrirpio4lpen ncs ()arrmumoot1tpxomoetytla ul(ms;t0trtnmf to1fm rluvs;t0 etoxm3ou4llte nvi ( aDta(r nu1olxoii3iasfmDumu o (4 rtnif3iatoate neols)s2trio no4lmtn netas) 2uru  oo0altnmociaslm raumo;u0 rerxo3oatfpDr iei;t)srxoxmpio1olee nciltfs2um(ro;u4aleo fetldfs2ulnvp t0 eerxrcoo1op raueo t)tetoio oo4ol nlivilt a2uaxrp;u0tet io3taslm um(mo t4 rtnmociy1lmD aueo ()t2to(m3iy4alen icsat)a2trx o;u0tlx iictadla rlnmp t)alerxfcty1fate uvolt0t2ur(r3oydlltnlicsa(fs2rmumo;u1tetoio3iys a2ua(vpnu)tlxrxocoydfp  liesl(  exoim3io4lm elivsat)aDrmumoou4olenmociad a eln o u4teeoir oatopD lnesls  2tr(o3nu4llenmicia() Durum oo4ole ioetasfm ea(vs;t)trenmo ia1optrau s (0 rxr(rpnydamen fvtl()artrxmooo4tetnif3tldlm umuvs t)aetnio3tadlpte uvol() 2urxm iy1apenmiesl() Dra(r ot4opt if3tyd mDrlnmsn(4tlxnxo ia1fm r ivils  2xmxm oy4opeemici t  Duru onu1apeoiieiatfmDrm(vp;t4aexomo to1oaDrlneo ( trxrxm no4lp  mfvs tfsDta(rono1aetn fciltlm2rm(vs;u) rtrio3tatfa  aues;()s2xrir3oo1om emicilt srua(root1aetnifctldfaDrlu o t0tlxomfciatfa  ai o;(0teuriopou4opte fvsas)artr(  ot1apt  f3iysfs rluvpnu4 rxnmrcoadfm  lnvols0srxoir3oydoptnlfvia(fsDum(m ;o0oet  octls s2emump u0aexnmo3iy1opD li o (0 2urxopoudlmtelncs s arra(m ;t1oeeoifcias s rm(mo;u)trxnmr3ootopD aneols texr(o nudlleelfviatf rtmum ou0tptn oetydlm emnms t0 etrmr tadlp rlueolt texm(o iodaltnmncsatfsrtaur ;o0oet mietltlm raumpnu)trtnio3oydomDe n o s trurio3iodop  mivs t)aDuru p;t4olt  f3iytfmDel(vs;t4trenifciodlm ean ols  etr(rpiodameemnviatf rraxrpnu0teeo f3iasfs2uluvp t) reoxf3iatlmte iei s  exmxm no4oltnlicilt) rtmxmp;o0olx iietas aDrauvonu)artnif3iy1fm r nei s srtoim oodap e nvt (  rtrxroou4opx  iciytfa ulnmo (0 rtoifcoytomte uei;()t2tmxrpoy1opeemfvs s srrmurpno4oeeniictysfs2uau pnt4 rxnxfciy1lptr i slt0s2tmio oo1lpt lfcslsfaDuru  nt0alt io3iatls eau onu4 rxnircoy1oateliei s)t2toio3nu4olen nvil(fsDurxronu1tex mf3tyt mDrmumpnt0 eerio3tadfp elu i (0teum(rpio4lptnlici () rrm(mpnu0apxomociydlsDulnms;u0arxrmo oy1lmt li o;s0tetr(o3io1lpe  nes ()aDumurpnu4apeoifciad aDrmu pn(4aeerxociadom  ai s;s0setoxmpnodapt mfvi tfarumumpoo4tpt ifcias m2uaums;(0 rerifctatfa rlueo ( s2umimpnudlle miet t  Dtrxmpno1optn icilsfm2eluvs t4alxnirctytlmDeaueo (  2xr(opnu4amenmfvi tfa2rmuro;u1olxnmieiadfa2ul(vo;()trenxr oy1omtranvsls  euoim ou4ap nlfet s  Drrx  ;u4apenifeiltls rl(mo;u0tetnxociatoatr i ilt0s2xrirpou4ll  mivt s)srururonu1optnmfetlslm el(mp t)aetoiocta1fp  aivs t0s2urim nu1amt  fctls  Durxrpnt1tpen ociltla2rluvs;u)tlenxf3oodopDranvs;t0s2tm(m3iy1al e nctlt)aDraurooo4altniiciyslm elnvpnu)texnmo3oatfpt  iei () rxoir3ou1am n nciltfsDtm(mpnt0olt  feiatfsDuaumont0teermo iotfptr ieil()texo(m iydole mivta(fa2rm(m no1apxo o3ildlmDemuvp t0altoxr iydlaDelues;s0 rtoxm oydlp e ictl(fsrrrxrp;u1aeeomfetatfa2um(vs t)arerxrciodoat ai s t)srtm(m3oo4alte nvslt)sDtr(rono1oexn oetltfaDuln s u4aexnmr oydlaD aivs;( sexoxr no4apt lfcs s aDraumont4olt iociadfs um(mo;(0tlxnir iodopDrlnvslt)sruo(r ou4amtemici sfarraur oo0oexo o3tasfm2ul(ms ()trxnmo iodoa e uvs ()t2xr(mpoo1lmee fes (f rtm(m ;t0tpenmociys aDemn o t)altnmf iy1fa  lneols trxo(mpoo1altelnvilt)aDrm(mont4apt iocildlmDrmnmo t0aeenircoodopDr n ols s2tr(rpiu1aleemivta(f 2uaxm ;u0oetnii3iltls2eau p;u) exomo to1opt au sls srxm(r3ou4lptnlnvia( a2tru  ou4tex moeiasla ra(vo;(4 exrmf3ootoatr ieo;t) euo(r nu4aptemici t  Dum(r nt4alenmoeias mDel( pnu4tlxniocia1fat  nei;( s2tmimpiy1lpenlicsat  rtrur nu0olt mociysfa rl(ms;u) lxoif3oo1fmD  uvils  2uoxopou1al nmictlt) 2rmump;o1oexnifetysfm um( snt4 etomrcoatlp rln i;s texmir nydom nmfvt ( sDua(  ;t4oexnifciad aDul(mo u)trtoxo totfpte i il()t2tmir3iodlpenlncs t)s2um(ront1aetn fctyslmDra( o;u0 ltrmr3oodfm   n s t)trxrim iy1ap n fes tf 2ta(r nt0tltn fciat s2eau s u4artrmf oo1lpDraivslt) rtrxm3ou1openmfcsas)a2tmumpou1aeenmoetat m2uan p u)tltoif tadlpD aues;t)texmir ou4lpt  ict ()arrrxmooo1altn f3iydfmDem(vo;u)alenxrctotfmtrauvo;t setoxm3oo1olen nvia(f Dumx oot4oetnifeiat aDelnvo;u)arxnmf3iatfaDr i o;s) 2um(opnudole mneil( sDtrxmpot4aet  f3iltlaDul(mpnt4tlxoxf oa1lmtraiei;t0teur(mpiy4ll   feilsfa2truro;t1apeoifctaslm2uau s u)treoxr3io1lmtr ieslt trtmxr3iydlle miei ( arrrx pno0aleoioctltls umnmo t0 rermo3totopD lueo ( tetmimpnodam nmfes ( a2ua(rooo4oltoioeilsfs ranvs u0 rxrmfciodlaD aies;s)srum(o3oydolte fviltfs2ua(mo;o0opxn o3ilt s2ulnvs u4tlxnmr iatopDrlues;(0 rxrxr ou4opeemivi t aDtax  oo4alxo ieiatla2umnmo;t4 rtrif oatfat  ueo;t) exr(opiudlpeelncta(f Dum(mpnt0opxo fciys s2ra(mont4arxoxf ty1laD auvi;s)trxmim ou4ol  mfviltfa2ra(mono1tleniictatfmDrlums;u0aetnmr3ia1lmt lu o;t)teuoiopio1lmtnlfesls arum( oot1aex  fciytfa uanvo;u4trtrmf oadoaD ai ols)srtr(mpiy1lm nmicia() 2rru p;t1aptomociadla rm( o;u) rxoirctotoa  au s;s)t2to(mpnudaltnlfetlt  rrrx ont0apeo f3tadlm2um(vsn(0tlerirciytlpD an il(0trxrim3nu1alenlici sfsDtr(r nt0opeomieildlsDran o t4 lxnmf3iytfmD lu s;t0trxm(o3oy4ll  lnvias)artmxr ;u1opto i3iadlmDelnmo (4tltrxrctydop r ieil(0srtr(r iu1amt  fetat) 2um(ronu0aetnmf3tldla2el( pnt0tltnmfcoydlm r ivs;s)trurxm oydoltemivsasfsrtm(  no4oexn o3iasls emuvp u0 eermf3oatopDe n o ( t2tmxm3oo4llt mivsas s2tru  ot0tpxnmfetysfs2rm(monu0alxrxr totomtr ivo;( s2toxm3oudop n nctas aDrrx  nt0tpe  octlsfm uaumpnu0 eermrciydfm eaueo t)texr(m3iy4ame mfvsas s2uru ooo0tetnmo3iysls uauvon() eenmr iytfa  lueo (0t2tmxo nudopt mnetls)aDta(ro;o0aet iieias s2ulu snt)alerir tydfpD  n s s  rumio oo1lp elnvs s sDrmxrpnt0apto ociad s ra(vpnu4tlxrifcoy1optrluvols)t2um(r iu1aptnlfcs sf ruax onu1aptnmicildla ulnms;(4aeeoxo3iy1fp e i il()s2xm(mpoydaptemfcs s srrmu p;o1tpxnmfciatfsDrmn p (4trxnir iydlp   ueils0s2toir iu1ame miei tf 2tax ono1apenmociltla2emnvp t0tlenmr iotoaD  u o;s sexoxo iodoltn fci s)arraxr ;o1apt io3iyd s2eaums t4tetrxocoytfptelnvi (  2umxr3iy4aptnmicsat  Durum ot1alxn ietadfm uln o u0texomo iatoaDe ivi;t tetrxopny4opee nesas sDurxrooo0alt  ociadla2em(monu4tltnmr3oy1latr ueols trtmir3oo4ll  miei t) 2rru  ou0aexn o3iatfm rm( p;u4 rtnxo3tytlaD lneo t0trtoxmpny1apte fvil(  2rmur ;u0tptoio3iatla rmnvsn()arerifctadlm rluvsls)srtoxm3io1oltemict ( aDur(mpou0opxoif3iydfm2ua(mp;t)treoio3to1opDr ueilt srxo(r3oudom   neslsf Duax pno4tpxomfciat m ua(mon(4tetoxf3ty1fmDelneols)teumim oo1ap e fet s)artrur ;u1tpe mfciltfaDea(mp u4 eenifcoatfpDeaiei;(0 rtoim3iydlp nlnvt sfa2uax oou0tptomfcilt sDul(mo t0 eerxf ia1lptrln o;(0 ruoxo ou4aptnmiei s)sruax ont0oeto iciyslaDrmu s u0 lxrxo3todlpDe ueo ()t2xrirpnodomenmiet (fa2tr( o;t0optn o3ils m umnms ()trtnmo ta1lpt  uei;s s2uoxmpnydolt  ivia()a2rr(ro;t1ole  fcild s2rl(vo;t4 renxo3iy1fa  lueolt srto(o3io4om nmivtls)sDrrxro;o0tptn oeiydlm2rmnms (0aetoxrcoodom  an i t t2xm(m3ny1op nmnesls s2urxmono0altoifeiytfs2ul( s (4altnxocoytoptran o;t  rxmxo ny4al nlivi sfa2ua(mo;u4olto ociydlsDumnmo u4texoxr iy1opt an slt0trurxo3iudlleelicsasfs2rau  nu1oeeomociysfm2rmnvo u) rxoxf tadlm rai o (0s2tmimpoudlp n fei () Duaxmonu4oltnmi3iasfaDemnvon(4 eenmr oa1fm e nvs;()setm(mpnodamee ivi s) rrmxmpno0alxnioctas mDrl( snu4texrmo3iotoptelies ( sexm(r3oydlmen feta(f rtrx o;o4oltoioctasfm uaumo () lenxf io1laDeaues (  2xm(r oo4ome liet sf rrm(mo;t1apxnmoeiytlaDrmums;u0 rxnxo3iadlpteai i;(0t2tm(mpnudal n nvs s)s2taxr ;u0tptn feiydlsDul( s t0 leoxr oo1fatr n i;s  2ur(m3ou1lm elfci (  rtm(m nt1tet mfciat sDuanmpn(4texnxr3iydla ean ols0srtrio3ou4al elfctltfs2ururoou1aexnmietltfsDulnvo u)trxrmoctadfaDrli i;t0teurim3nudomee fciatfsrrrum oo0opeomo3iyt m umumont4 etrxoctydfa r i sl(  euoiopnodlp elncil() rrmurp;o0tleomf3iltfaDua( snt)teenmr todlp   ivo;t)tetrir iudame  icsat aDuaxm ot4texnio3iltfmDumuvonu4 leomfciadfmteai o;() eum(r oydoleemieilt)aDrrx p;t0tpt ifcildfmDrm( snt4areoxr tadoa ranes t) rxr(r oy4ap nmiesat  Dta(r no1apeo ieildfs2rm(mont0 lxnxr todopD  nvi s)sruo(opnydamtnmfcsa(fsDtax o;t4tetomictldfs ranmo;(4teeomr oa1oa   ivs (0trtm(r nu4lm nmici s aDrr(r ot1tpxnmf3iadfsDra(vp;u) rtnif3to1fateli olt)truo(m oo1om  livtlt) rum(r oo1tpt moetlt m umnmpn() lenmr oatfp rlieol(  etr(r3oydol nmieias) 2tmum ;u1aptoif3iyd aDelu o;(4tetnmrctatfpt au sls)texm(r3oy4om emivias)s2ur(r oo1aee  o3tlsls2rauvont4 reoio oatlmt li s (  exm(o3no4om n nes ( s2rrxmo;t0aexn i3iysls2rlu p;t0tltomr ia1laD li o t srxo(m oo4lmeemiesls  Dtax o;o1oexo i3tls a uluvs u0 leoio3iadomDe ivilt)texmimpny4lpeemici ( arua(m nt1olx mieiad m2raums u0texoxfcto1faDeauvsls0srxmxo oo1lmt licils)srum( pot4tex  ieiyt s emu s ()trxrxf oodoa elnei s0seurio nydllenmfvta() 2ta(mpno4opeoifeiysfs eluvp u0altnxocio1lmDr n i t0s2xoxopny1lp e ieslt)aruru oot4alxnmietad aDeln s u4 ltriocoa1oa raueol()s2xr(m nodale mnei ()aDua(rono4tpt  fetlsfs2ulnmpnt0tlerir3iydfmDr ueolt srtrxr3iudlp n netlsf rtmxroou0altnif3ilt s2rluvo;u4tlermociotoa rau o t  2uo(o3oydomtnmfcia()a2taxrpou0tltnio3tatla ea(vp u4texomfctodlmtrluei;t s2xoimpny1lmt  nvtas s2trxro;u4aetniieiltfaDeluvo t4tlermr ty1lp  au o;(  2trxr iu4apee fetlt  rta(r ;t0tlenifeiydfs umuvs;t4 eerxrcia1oa rln slt srtoxrpou1ap  mieslt  rrax onu1opxoii3iydfm elnms;(0tltnmo3oa1optelivi s0 exmxo nudol emivsltfaDtrumpnu0olxo fciasfa2ua(msnt4 etoxo oytlpte ivslt0t2xrxm3oudamenmncsa()sDraum nu1tleo icilsla uluvo;(4trxnir tadomte nvols)srtm(rpnydaltn neia( aDuaxmpou4tee  iciadfs ua(mpnt) ltnmr iatfp elneo;t) 2xm(rpiudomtemiet ( sDta( pnu0apxo ieilt aDrmnvo;u4arxnxr iytfaD lu i s) rto(opno4aptemfet s srrruro;u0opxniictytfa ean o;t4teenio iy1lpt  nvi;t)t2xmio io1lpen neil(fartau  ou0aex ifciytls2rmnmp;u4altomr oadfpte nvs s0t2xm(mpnodamt lics t)arur(mo;o1aexo oeilt mDuanvo;(0teermf oodfa elivo;t) 2um(m3oo4opt mfeil( srtaur ;u4apto octydfa uauvs t4aeermr3totoa elueo;t truoimpoudaltnmicsas)s2rmur ;t0oltomo3ilsla2rauvs ()arxrxf oytoaDr uesls sexrxr3oydol e neiatfsDua(rp;t4tlx io3iysfs2ea(vs;u) rxoir oadlpD liei;(0sexrir3oodopen ivslsfartmumpou1openmo3iad mDeau s (0 eenxr3to1omt au ils)setrimpoy4alte fctl( a2tmum ;u4oex io3iltls rau o;(4trtnxfciotoaDrln i;s0srxoxo3nudll  mictlt  rra(r ;u0tlxoiociyt sDelnvpnu)artnxo3ia1lp rli sl(0trto(r3oy4aptemics s arua(mp;u4tlxnmf3iat sDemu ont0 eenmo iy1fm rlu i t0s2uoxmpiu1omenlfvias arrrum ;u4apto feiatls rm(ms;t4 exrircootomDe nvil(  2trxo3oydoleelneiat sDrrxmono1oetnmfeias a2ulnvsn(4tlerxo3tytlatr i ol()srtoxm iodlpen fvtl(f Dtmxr ;o1tlxnmieias s2em(vpnt)trenmo3iodlpte nvi () rxrio oo1ll nliciat  2ra(mpot0opx iietyslaDrl(mpn(4aetoxo3oydopDr ivo ( texr(m3oy1omtn fcsa( aDrr(r nu4aetoiiciatla2elnvo;u4trxrir oytom rli ils0seur(o no1lpt mfes sfsDum(rp;u1aet mf3tld s uanms;t0 reoxo oa1op r ivs;s) rxm(m3iu4omtn nctls)aDumum ot0oltnif3iltla ran s t0aexoio todfpDraivi;t) rtr(m3no1amtn fei tf Dumx  ou0texniieiltla em(vont4aeeomfcio1op rln o s)t2toio3ny4alt lfci ( s2urumpnu4tlt  feias a em( p t0alxrifciotlmtr uvs ( truoir nydol emnvtas)sruaur ot4tex mfcild a2eanmsn(0tlxnif3iotopt aues ()srur(m nudlmenlieilt)sDtr(  no1aexoif3tys aDel( pn()tlenmf oy1om  an i s0trtrxrpoydomeemicils s2tmu  nu0tpeomiciaslm em( on(4arxrir3ty1lm rai s;(0 rxoxm oydapee nciat)srrru pnt0apt mictld s elu o (4tetnxo oa1lp r neslt srtmxrpno1ol elfesas) Dtmxmont4olt ioctyt sDrmn pnt0 eeoxo totoaDe uvil( trumir3ny1al  mnei tf rum( oot1opx io3tadlm ea(vpnt)artrmr oo1op ranvo s)trxo(o3oy1amen ies t)a2tr( p;t0oexoif3ildfa ulnvs u4alxoifcio1lptran ols trtoir3iodlleelieilt s2taumono4tet mf3iydfs2ra(vsnt4tltrmf3iodfptelneo;t0s2uoxopio4op e nesl()srtm(ro;o0apxn oetadfm2emnvsnu4tetnircoa1oa  auvo t srxoio iu1lm emiet tfs2tm( poo1apto fetat aDrln s;u4 rtnxr iotlmDr u slt tetrxm iu4ame mfes (fa2umxrpno4optnio3ildfs el( s t4texnxr todopD lnvi t0 eurim ou1am n net s) rua(rpou0texn ociysfs eanvon(4arerircio1omDr i sls) euo(mpnudaptnlfvt t srraur nu0tptoiociatla umn o;u4aexnxfctodlmte ieo;s0s2urxm iodlpte ietlt)a2taxm oo0tpe moctlsls uau p u4aexoxf3ty1lmDrlueo;t0 ruoxr oydoltn nes t  Durx  ou4oleoioeiadfs uaump (4artoif oy1laDranvo t s2xoxopiodlmtemfvtls) Drrxrp;u1apxnmoetyt s2elnvp;u4trerxr to1op r iei;s  2toim iy4ameelfvtls aDrmx p;u0oeen i3tysfsDem(vs;u4tltrmo3iodoptelnvol( seurir3iydoptnmncsltf rtrum ot1alto octys a raumsn(0texrir3iytomt lu o;t s2tmxm3no4olenmfeias)srurur ot1olxoii3iatlm eluvs;t)tlxrxf oatfp e nei;(0teurir oo4olenlfvtlsfsDrm(mpou4tee moeiadfs2eaumo u)tetrxoctatomD  u s;s) ruoio iy1llte fviatfaDrmu pno1aetomieiyt a emu s;u0arxrif3ootom eli ols sexmio3oo4ope  iesat artru o;t4tpen f3iaslaDemump t)trenxfcoa1laDelu ils0 2xm(o iodlm  lneia(  rrmurpnt0opeoif3taslaDul(mp t)tleoio3iodlatr uvs () 2xrxo nudlp  mieil() rrrur ;o1tlto o3ils a umu s;(0trerif iytla elnei s0 rum(o3oy4opt  fcsls  Drmu ont0apeo ieiydlm2ua(ms u)texrxo iodlp   nvils) eur(r iodapen nvils) Drmumooo1tpenmiciytlsDea( pnu0teeomo oytomtrln i;s)t2xr(o nudam emncsatf rtax  ou0tpt iicild m2uluvon(4tlenmr3oadlpDeau sls  2trimpnodolt mieia(f 2trumpot4oexoioctytfa2um(mon(0 reomf3oatla eai sls  ruo(r3oodll elfes sf 2ta(rpou1aetoii3iatla2uan onu4tlxomoctydlmte uvils0s2toirpnodale lfesl(fsDurxro;o0aexniieiadfa2emnmsnu4texoio3oy1lmt  nei;t trtoxo3no4lpen fvtls sDtm(r ;o4tlxomoetls aDel( s u4arxomoctodfaDrlivi t)setmio3io4llenmnvtat  2ur(r ;u4tpenmi3ilsls uauvont0teerif3totop e ivo ( t2xrxm3io4optelicilt arta(mpou1tpxomictltlaDum( p;t)treomr3tydoa  aivols truo(o3oy4ol   iei s)sDtax  ot1opeoif3tld s ra(ms u0artnmfciy1laDrlnvils0s2trxr3iu4ll emicsltfaDra(mp;u4olxo o3iadla ranmpnu0 exrio iydlp eaueo t)seuoxmpny1alt lfvsat)s2tru p;u1oltn ieiad s2rm(ms;u4artnmocoa1optr uvs;s t2ur(o oudapenmieias)srrmxr oo4ale  f3ias s2umn s;(4 renmrcoa1laDran i;s) euoxr3oo4ome livt (fs2tmxrooo0aex  i3tasfa2ea(mp;()arxrxfciatla e u i (0teumxrpny4lle  nesl(fsruaxm nu1alx  feias a eauvp;u) rtnxrcoo1oateau slt0srxmim ny1ll   fvi tfsDrr(rp;t4oltnifetytlm elu p u4 ltomrciydfmDran slt) rumxrpiodopt miciatfaDurx o;u4oeto f3tyslmDem( onu0teenmr io1om elnes t0setrirpoy4am   ivi s)sDtru ono4oeenmfeiydfs uln p;u)aexnir todla r nei;t  rumxrpiudomtnlivsls)sDururp;u0teenif3ildfsDemumo;u0arxnmfctydlpD an i t  2xr(r nudlm n fvta( aDurxmoou1tltn feiad a ea(vp;u0aeenif oadopD liei;t) rurxmpny1op  mnvslt  rrm(ro;u1alt  iciyt a2emump (4 eenxoctadop rlnvo t  2um(r oy4lp  mivt s srurx pnu4olxn ictatfa2uau o;t4alerio ootom eln s;( seuoxopio1ame  fei sfsDur( oou4olt  fetas m uluvo;t)teenxf tytfmt liesl()setmir nu4lmeemfvsas)a2tmum ;u4texo f3ild s2emu p t4alxrio oodlptelueo t0srxmim oy1lmt lfvsas s2tmxrp;t0teto feild m2rmumsnu0tlenmrcoo1op   neo t) 2xmim oo4apeelfci (f Dtr(mo;u4apx  feild mDrmuvpnu) etomr oatoaDeanes (0tetmxm3io4opt  ncta( s2taurp;u4tltniictadlaDul(vs;() exrmf oydla ean sls0t2xm(m oy4lm nlfvtas arumxrpou1tetn ictasfa2umn s;t)aexomo iytlm eaueo s setrimpiodal nmieias)s2rax pot0tpx mfeils m umuvs;t4trtrmo3oa1op e u s s) rtm(mpoydll nlics ( srumurpoo1aetomfctyd m eauvs t4 eeoxr tadomD anvils teur(mpnydllenlicias)srta( o;t4olxn fcilt mDua(mont)aetrircoa1oat ai sl(0teurxr3nu1op  mivi ()s2tmuroot4oee moctlsfm2emuvs;()trenmr3oytom eauvi t)srurxm ou4lp  lnvtls s2uau oou4opxn fciasfa2el(vo;t)tetrio ta1fpt  neolt setoxo3iu1apeemneil(f 2uaurono0alxo ociadfsDumnvs u) eenif3tytlmD  u ols0 eto(r iodam eliesasfsDra(ro;u4tle moeiat sDrl(msn(4aeenio3tadfmtrluvols0 exmxm ny4op elfvsa( sDuau poo1aleomfetad s eaump;u) lerioctytfat  ueolt0 2xmimpou4lm elici (fs2ururo;u1tpe io3tas s2ranvp;t0aetrmo to1opD  u olt) eur(m iodlmeemietlsf 2rrx  no4tpt ifeildlm2rluvo t)tlxrmrcto1la rau o t0 2urxm3iu1ole mnvt t arrrxro;o4tptnmictls mDel( snu0texoifctatlat lnvs;t  2xoxr3ou1ol emfciasfsDrr(r no0oeeomiciytfa2rm(mont0aeeoxrcta1opD luvi;t0 rumxm oo1lpen ictls) 2uaur ot4alxn f3tas sDrau o t4alxnircia1oate nvs;s sexoxo iy4lmtnmfvsatf rtaump;u0tpeoio3iat mDul(vo t4trenmo3ta1fatraneol()seuoxr3nu1ole lfvsas) Drrum nu1oeenmf3iyt sDum( on()arenxr3ta1fm  ai s t setrimpnudapteliviltfs2ra(monu0aeto i3iys m ean on(0 lxoxf3to1lmDrlnvs;( t2tr(m3nodam e ivt tfa2tm( pnt0oeeomiciyslm2rln pn()artnxrctodomteau o () exmim3io1am emicta( a2tm(  ot0ope mocias s emnvsn() lxnxfcoy1oaDeanvo t0seto(rpoudopenmfci sfsrrmxrpot0teeo o3tls a um(vo u)alxrmf tydfm  an o;s0srurio3oudalenlnes (faDtm(mpno0aexomieiytfsDran p;u)aexnifcoy1om ran i t tetm(m oo1opt liciltfa2rau oot1tpx ifeiyd m2elu pnt0alxnxr tytoaDr u s t) rtrxr3ny1amtemfvsat s2tmu p;u4opxnmo3iyt m2rmnmont0arxoxf oa1optelnes;( s2tmxo3io4op   fei t)srraum ;t4aptomoctysfsDem(mo ()aetomr3tytfm  luvo;s0trtoxrpiy4lm nmnesatfs2uru poo1tlx moeiatfs rlnmon(4aexnir3iatomDelnvs;s)t2um(r iy1ol  mnctl()arraum ;t0tlt mociltfmDrmnvon(4altnmo3todfmtr u s;()sexmio3nodllenmfcia()aDtrxr ;o0oeeoiieiyslm2uau ont)alxnio3iytoptr ueo s0s2uoimpoo1op nlfeiat  2ua(ront0tpt ioeild a umn onu)areoif oadop  lnvsl()texo(o3oo4al  lncsasfa2ta(rpnt4tlenifcilt m el( p t4 renxr3totlat anvs s0truoxmpnydlme lnctlt a2tmxmont4opx iieild s2emnvs u0 lxnmr oo1om eai o s  exrimpiy1llenmnei (f Dtaxr no0tpxoifetls a ea(mo (4 rtnif oo1fpD aiesl(0 eur(m3no4aptnliesat) Draum ot1apto oeilsfa2elnvp;(0aeenxrctydlmDe ivo s0tetr(o3nodom  miet ( aDum(rpou1oexn fctydfm2ulnmo;t) ltnxr3io1fp r ivolt) 2uoim iu1ll nmfesa(f 2tmxmp;u0texnmociltfa2eluvsn()aexrxr iodoptr i i;s) exoxm oodol elfcilsfs2umumooo1teto ictydfa rl(vs;(4 exrxfcoadomteln i s  2tm(m3oo4om  lnetat)s2ra(ro;o0optoio3iasfm2rmnvo;(4 rxrmo ia1omD  ues ()tetrxo no1olt mnciatfartau oot1alto octatlm umu o u0tlxnxf oa1lmteauvol(  exriopnu1ole lfesa( sruaxro;u4aexomfctyd a2umuvp;(0tlenxo3ty1op rauvo;t s2xr(m3iu4ol nlfei s  2umur nu0aexn f3ilsfmDra(monu0teerxociotla raivs;t0s2xo(mpoydlm emfviat)a2rmxrpnt1tlxomociadfsDuln pnu) rxnio oo1lat ai slt) rtrir3oy4amt liesa()aDrmumpou4oeeomoeiydls el(vo (0tltoir oa1lat lnvolt  2xmio iy4lpe  ivsa( arra( o;t0aet if3iadfm rmuvp;(4tlermo iy1fa eluvs s tetmimpoy1llen ncs (farumxmp;t1tpeomietyt mDemn p;t)altoif3totoaD  u s;t  rxrxrpiu4amenmictl(fa2tm( pnu1oltoifeiyslm2rl(vont4tleoxo to1omDe u i;s0t2tmxr oudam e netas)arrrx ont4oet io3tadfa um( snu)tlxoxrctadlatranesls0 2trxo nu1lleemnvsa(  2uaxr ;u4opeoif3ias a2ua( o;t0aleoio3tydfpt ai ilt) 2xr(opoydal  mnei sfs2rmxm ;o1aexomociydfs2rauvont)arxoir oadfmD  ieslt  rxrio oydoltnmncs s)srtrur ;u4oleo feils s2uan s u4areoifcoydfmDrauvo;t)t2urxmpoy1amtelfcsatf rrmxm ot0texomi3tlt sDel( p (4 rxnxo3oadfatranvs;() 2tmxo oy1llenmfctltfsrur(mpou4oeenmo3ilt sDum( p t4aetoif tadoatr ues (  etoiopoudlp   ics ( a2ua(mo;o1aptnmi3tyd m ulu p;t0arxoxr3oydlateluvi s  etmir iodalenlieil(f Drm(  ;t4oex mfctlslmDel(vs;(0areoif oadoa elnes s)s2xo(rpou4optn nvs s srtr(rpoo4texniietldfs emumsn(4aexrxf tadfat li s t t2urim3oudllen netas)srrmurp;t4oeeo f3iys s2umnvonu)aeeoir3iodop   iei ( t2toir iydam emiei s)arur( oou4aeen oeiatfm2uanvo ()aetoiociotlpt lu slt srtrir3iodomte fci sfaDtm( p;t1ale mociaslmDrluvont4altnxr ootfpDrlnvs t  2uo(m3nydllt  fvslt) 2rmur ou0oet ifeiytfsDel(mp;u)trtnxrcta1omDrlu o;t s2trxm3iu4lltnlneilsfsDtr(rpnu1tlx  fetld m umu o t) eerir ia1omDr n o;t)t2umir3iudamtemfetl()a2urxr ot1aetomociytfaDrmnvsnu0trxrxr tatoateaiesl()tetriopoydameemfvs ()srrauro;o4opeomfeiadfs2emu o;u)altrmo iy1oatrln s;t0trxo(o oy1ap  liei () 2tmx o;u1oet  oeias s rln s;t4 etnxr3totfpt aies t0 etoio3oydlpeemnet t artru ono0teenmociltlm ra(mp;(0 lxnio totopt lnes t0 ruo(o nydamte iviasfs2ta(mp;u4tleoiicild sDua( s;(4tetnxo3iadlatelnvilt)texo(r3no1lle mivtls) Drmu o;o0olx iictaslm uluvp (0 lerir3oo1fmDeaivo t sexmir3iudap nlfci t  Duau o;u1aet mfeiyd mDrlnvp t0tltomr3tatlmDr iesl(  ruo(o oy1amt lici (f 2trumooo1ole iociyslmDrmn p;(0alermf3totfmt aivi;( s2xr(r no4lm  lfcta( aDtmxr ou0oltnmoetasfsDeanmp (0 etoif iatfmt ln i;s) 2xr(m3oodlme  fcil(fsDrmur nt1opx mi3ildlm2uanmo;t)tlxrio3to1lpDr i s t) exrxrpnydlpenmiesasfsrtrx ooo1apenmfeiysfm2eln p;(4 reoircoadlp r ueo;()trtm(opoo4amtemfvt t)s2rr(ronu4oexnmoeiltfs2uan p;()tlxnmo3ootoptrlneslt srxmxm3iodamte ncsa(f rra( o;t1teenmieiasfa emuvs t4trtnmf3oydfpD aivi;t0trtoxrpnydoltn ivtltfaDtm(r ot0opt moeiysfaDel( pn()trtoxr3oy1lmDrlivs s0trtmir nodam n fcs tfarrru o;u4apt  iciydfaDuln s (4 rtoxo3oytlp rlnei s0 2tm(rpny4apeelneiatfarurxro;t4alxomfeiyd a emnvsnu4tetrirciy1faDeauvol(0t2um(o oy4omee nctas s2rmxr no4teeoiietadfaDumn sn()trxnxrcio1fpD an o t0texoio ou4lpe mfvt tfaruax ooo0teto octytlm eluvo;()altoxf to1fateln s (0 rur(r nu4op  lfct ()aDumuroou4oexo iciatla rmnvpn(4 rtomocoatfaD  n o;(0 2urxo no1lmtn netlsfsrumum ;t1apt mf3tasfs ulnvp (4arerxociadlm  lues;s)srtoir ou4alee fesatfsDurxroou4aetnif3ild s uau s u)arxnxo oadlmtrai ols)t2xoxm nudlm n feias) Drr(mpoo1oet mo3iyslsDumums;t4texnmr3iotlaDe ivolt0srxrxmpio4am  lfei ()arrrxrpnu4aeen oetls m2umnms (4 ltrif3oatfm r i o t0trtrir3iy4op   ietat)a2um(rpoo4aexoif3iysfm2em( p;u0tetrmr3oo1omtelivsl()t2toirpno1lptn nvil( a2umum ;o1alx ioeiadla ea(vsnu0artoiocootomDe neo;t0 2tm(r iudalt lictl()arur(roou1tlt ioeiytfm em(vpn(4tltomfcia1opDr n s;t0t2xm(o no4alt micsatfsrumxront4aexoiicilt mDrmuvo u0aetnmr oo1fmtr u ol()srtrirpnudll emivtls) rtaurpnu4alto o3tldlm eanmp;t0areoifciy1lmtr i olt)srurxo iydoptemncsls  2ta( o;t4oex  ieiyd s2eln p (0aexrir3iodoa  lues t s2toxr3nydll   fctl( s2tmx  ;t0tlto o3tlt aDelu s;() exrioctotom   uvi t0 exmxm oy1altnmfcias)s2rr(mpno0tpe mi3ilsfs2ulumo (4 rxnir3tadlp   i s t)srtrir3iu1lmeemncia(f 2rrxr oo0tlx mo3ilslaDea( s ()aeenmr tatfpt lneo;(  euoim io1al nmncs s  Dum(mo;u0aet  oeilt m eln o t0 rtoio ty1la  livils0 rtr(r3nydllt lncsat s2tmxmpnt4oeeoii3tyd aDrau p;t)artoif tytfaD lieo s) exmxmpoo1lmtelneta()s2rau  oo0tpe mo3iydfmDuaump t4teenxo3totlmt ai o;s t2tm(mpoudam nmnct ()a2taxrooo1tetnmf3iasla eluvp t4tleoifcoydlmDeanvo s  eurxm no1aptemfcil( aDtmumpoo0aeeoiieiad sDuan snt0 exnircoadfm  anesls)sruoxr3ny4ame  fesls)arumuronu4oltoio3tld s2raump t) exnxr3oo1oaDe nvi s) rum(o3nudopt lici (f 2rmumpno4olenifeias aDrmums (0 exrmr iytop ranvi;s0setr(o iy4apt  feta(fa2tmxro;t0opt  o3iysfa emnvpnu0tlerxr3ty1lat  ieo t) eur(o oy1lmt  nvias) rrr( oot4tpt  fciasls ranvs (0 renif to1lmD luvol()trxmxrpiodole  ncil( sDtaxrp;u0aetnmfeiasfaDranmpnt0aetnxf3tatoaD  ues;s0t2tm(r nodapen nvi s)aDuax  no4tee mo3iasfs eluvs;t) renifciy1fmD  i i;(0 rxoxo3iu1amenlfciltfarraxrpnu4tlto o3tas a2ranvsnt)tetriociatlp rluesl( s2xoxo3iudope  fvilt  Dum(rpoo4olx moeiytfaDemu s;t4areoxo tytop  aies s s2xo(mpoo1lltnlicil( a2um( pnu4opxnmf3iytfs uau p;(4alxomociydopt li s s t2trirpoo1ope mivslsfs2tm(mpot1opt if3tldlm ea(mp (4artoircoydfatrlueils) exrio3iudap nlici t  2tru ont1aexnmoetatlm2eau on(4altrxocoydfpD lu i;s)t2xmirpiy1olt miesls aDra(r ou0aee  fctasla em( o;t)alxnmr3totfmDr i ils0 exoir oudlmenmfet tfartau ooo1alxo fctls m umums;(0tleoxr3tadfateai i;t texmxmpoy4omtn nviat)a2ra( pot0aptnmfctlt s2ra(vs;t) lxomocoo1oa   ieol( trxmxmpiu1amt mfciat)aDuaurp;u1olenifciyslsDeauvs (4tltnmociotoa eluvol(0trxr(m oo4om  mfeilsfsrum(ro;o0tpxn feiydfa2rm( o t0teeomoctatoaDr i ol(0 exm(m iu1lmte fes (fs2uax  nt1optn oetadfa ea(vs t)tlermo3iytfpD  ues t) eurxm3oy4omtn fvtlsfa2uaur ;t4aetn fctat a2emu o;(0altrio3totlm rln sl(  euo(m3nu1alt lnvta()a2raurp;t4ape ioeias s ul( s u0tlerio3tatlaD lnei t t2tr(rpoudlpee ivi (f Drax ooo1tptniociadla uln ont4tleoif3iatlaDeau ilt)tetoxrpno1openlnei s  rra(mpou1aleomfeils mDrlumo (0 renxrcoatlat an o;s teurio nodlp  lfes tf Drr(mooo0oex mociadfa2rm( p u) exrifcoodla r ieo;s t2tr(rpny4apeelnvtatf rurxr ;u4olt ifeils m2emn o;t0aetomfcto1opte i i;t)sexrim3oudomenmfci tfs2raxmont0altoif3iyt aDul(mpn(4 reomf3totoa  anvs ()s2tmir oy4lmenlfvsl() rur(rpoo4openmieiadls2rauvs;t)aetoio3oytlpDeanei;( srxoxr3ny1llen ncia()sDuax pnt1olt mfeilt aDeln sn(0alxnio3todfm   ivil(0s2tr(m3nydapt lieta(fa2uaump;o1teenmfeils s emnvsnu) lxrmf3oytfa rlivo (  rum(opoy1ale  fcsls  rurxmo;u0aptomoctldfsDran o t4trxrxf iadlmDe nvs s srumxo iy1ol nlncta()arrrx  nt1oex  ieiad s2emums;(0trtrmfciydla eanei;s0teuo(opiu4am  mietls)a2tmum ;t4aee mieildfa2rmnvo t0 exoir ia1lmt  ivi;s0truoio nu1lm nmfct sf 2uaxront4apxomf3iatla ran on(4tlxnxrctodla eaiei;s  2tmxr io1amt mivsa(fsDta(r ou0opxoii3tltfs rau s (4tlxrif3ia1fa eaneo;s srxrir3oo4lp nlivs s)arumu  ot0aex ii3ilt s2umu ont4altnmf3ia1la rlivs;( srxrxopoo4openmivias s2rm(m nt4aex iociatfm eluvpnt0arxnmf3ia1lm eau i t0 etrxr3oydlp  mivt s a2uax  ;o4tptnifetldfmDrlu p;t)alenxr3iydfate u slt0s2xrxmpiodop  mieslt) 2ur( oou1apx mf3ilsfm2uanvsnt0 exnmr ta1lmtr ivi ()setmirpoo1om nlivs (faDtau p;o4alto feiadla ea( s;u)tlenircoatfmD auvolt  etrxr no1lp   nctl(f Dumx  no4teen o3iasfm elnmp ()tltrxr3io1lpDrluei;s seuoir3oodlltnlietl( arrrumo;u1tet ioeildlaDulnvs u4 eeomociodopDe u s;t srto(o3iu4ol emfvsa(faDrr( ont0optoioeilslmDrmu pnt)tlerxrcto1fmt lueo (0 rurxr3no1lp  lfvsl(faDtr(r ;u4opxoifeiltfs2uauvp;t4 etrmf3tatlm e ivo t)trxoxo oy1om  mfvtas)s2tmx pno0oltniiciadfaDumnmo;(0 leomo3oa1fate n i;()srtm(o oydlm n nci sf Dua(m ot1alx  i3tlt aDem( o;u4artrxrciy1oaDrluei s) exmxo oydlpe  fei ()arra( p;u1apeniicias a2em(mp;(0trxrxrcoodoaD luei t)s2toxo3iudamtelfvsl()srtaxr ;o4alt ioeilslaDumu o u)alxnif3todomt  iei;s)trum(rpoy4lp n ivtat) 2tax pot0apx  f3iltfa eanmp () etriocoadfatelu i t0 2xoxr nudope micsl( s2ur(ro;o1oet  feiytfm umumo u) etnir3oo1laDeai ols0 rxrir ou4alt lietas)a2rr(mp;u1olxnif3iys mDeluvpnu0 etrif3tytfmD anvs ( s2toxm3oo4ll elnci t sDtmu onu1tex ii3iydfa2ea( onu4tetrxo3oa1omDraivo;t0trtr(mpiu4alt  iciasfarrr(rpnu0aexnmf3iyd aDemuvsn() ltnxo oydopteaiei;t  2tmir3iy4omtn ivsat)srumum no0aexn ietytfa rm( o;u0areoxo tydlpt au i t)trxmxr3no1al nmicsasfaDur(  ot0oexoif3iydfm2rmnvp u)alerif oo1omDeaues;()s2umio ny1lm e fvt sf Dtm(mo;o0apeniieiytla2ulnvp t) rtomr oadomte ivi;(  2urxm3ny1altemics () 2rm( o;t1opto oetatlm ranvo () rxrmf oodoatrliei s seto(r iu1alen nvsl(f Dumxmoou4aeeoiietatfsDumn o;u)artrxf ootfptrluei s0 euriopou4amee ieslt  2uaxroot4oltoio3tytfaDra(vont) reomf oy1fpD aues;t)srxmxrpoudop n ncias  2raxmpou1optn f3tatla2um(vs;()trtnio3tadla r uvo ( trxo(rpnudal emnctas)sDtmx oou4ole  oeiatlsDrmnvp ()tetnmocoa1fa eluvi t0 2xmio3oo1ape  fvtls)s2ra(  nu0tptnmo3iysla2ranvp t4 reoio3ootlp ean slt0srur(o3no4omeelfcta( a2rr( p;o0oeeomociasls2emn o (0 exrif iydlp rluvo;( srxrxo3ou4aptemivtlt s2um( pno1ape  f3iltlm rm(mont0arxnioctatlatrli i;s teurxm oy4llt mfcs sfarraxr oo1tlxoiociysla2elnvpn()alxnmf ootfatelivi;(0t2xrim oy1apee ncias arraxmpnt4tleo f3iydfs emnvp;t)texoif iotla  au o s0teuoxo3oudom nlfcsas)aDrrxr ot0aeeo ocilsfs2umnvsnt4 eermoctodoatranvsl() euoir oodam nmnetls) 2taum ou1alt iieiyd m rm( s t0arermociodfat lueo t trxo(o iudlltnmfetls aDtr(moou0opxn i3tyt aDranmpnu) eeomo oy1latr nvi;(  2umirpno4lpe lfcsl()aDrax  nt1tltnmieiltla2umn o;(4 rxrxocia1optr nvo ()texr(m3oydal  mfetlt  rtru pnu4tltn f3tadfm2el(vont)alenmr totlmtr u i;s) etoim3nu4ll nlicsl( sDtaxmooo1oexo f3iatfmDrmumo t)teerir3ta1fa  aneils)texo(m3oo4ll elnci ()arumu  oo4ape mictasfm rm(vpnt4altrifctotfp  lnvo (  eur(r oo4am nmncslt)srumxm ;t1apenmociyt aDrauvs;(4 rxrmrctotfm ean o;() exmxm3io1openlfvsat) Dtm(mpou4olx io3iat sDra( snt)aeeoifcia1fmDr neo s0teto(o oy4omt livsl()aDtr(m oo0oet iocilt s umn on(0tetrxo tatop eauvs t0setmxr io4op   fvsas s2ur(m no0tet ifeiyt m ulnvs () etoioctytopDeaneo t) eum(rpiu1lltn netatfa2tm(mono1teeomfeiasfs ea(mpnt4 lenir3tadfa  an slt  rtrimpoo1lltnlfvs ()aDtmxrpoo1tet  oeiytlmDulu on(4trerio totlaDe uvo;s t2trxo iudam emfvi t)arraumooo1tlt  icilt aDeau pn(0tltoxrcta1lateaueo t trumxm3nu1ap elfeilsf 2rr( ooo1tlen o3iasla rmumpnt)altoxrctotlaDrli il()sruoxo3oo4olenmncils)s2trumooo0tlt mf3tysfs2eln s;(4artnxrcoy1faD lneo;t)tetrio3ou1amtemnetlsfsrtmxr ;u1tleoioeiat mDra(mo;u0 leoxfcto1op eaivil( srxmxr no4lpte ict s)a2tm(m ;o1tpx  i3iysfaDuaumonu4aeeoxocoy1opDelu s s) ruoxr3oo1optnlfeslt)artrur oo0apenii3iatfaDrmnvp;t4 lenxfcio1laDeluei () 2tmxrpno1ap eliet tfaDuauronu1apeomfcilsfm2uauvo u0artrmo iatfaDrlivi;s trtoimpnu1omtnmnet sf rrru  ;t1teenmfeils sDrlnvp;u4arxnxfcto1fmDeln olt t2trir3iudale  nes t  Drauront1apt mi3iltfm uluvont0 ltomo tydopt an i;t)t2toxm3nu4altelnvt ( arur( pou4apeomi3tadlaDranvs (0trtnir3ootfpD lnei (0srxrim nu4am e icils  2ua( poo0alxn f3iysfsDrln snu4tlxnxo3iatlp eln s;(0s2um(o3io1oltn ivta()s2rau  ;o4aexn fcilt m umnmon(4trxnmo iotfaDrln s;t)seuoio nodale mfcslt)sDrrxro;t0optoiieiadfm2em(vs;u4trxnxfcty1fmtrlieo s t2tm(r3io4aptnlfeiatfs2rmumoou4aexo oeias m2um( o;u0aeenxo oo1lmtr ieol(  rxmir3oudlmee fctltf Draumpou1ope iieilt aDra(vp;t4texoio to1fmtrai ils trtoirpnodomtn fvilt)arurxmo;o0texnii3iydls ulums u) etrir io1faD lnvs;( t2tr(m3oodlltn nvil(fsDraxmo;o4tpt miciyslm2rau s t)alxoir ta1fmtrlnvils)trtrirpoo4ape  ieils aDtrurpno0tleomoeild m2raumpn(4aeerio3iy1oatean o;s  2toio3iy4amenmnvilsf Drmx o;t1olxnmoeildlm eaumsn(0aeeoxf oadlaDran il(0 etmxmpny1lle mnetltfarur( o;u0apenmi3tysfa rau o;t)tlxoif3oydfmteluvol()t2urim3ou4amtelivilt)a2rax o;t4alxo ieiydfmDulu s (0tlenmo oa1fmt au o (0 rumir iy1lp nlnesa(f 2taxrp;u0ole if3tld a2uanms t4 rxrmocio1op   i s t t2xmxopiu1om n ncs (faDum( oou4alx mfeiasla ea(mo;(4trtnio3oatfatelivs ()trtoxm3oydole  icilt aDrmumooo1tetnmf3tat m2rmumo ()aexrxr ty1fpDelivs;s)truo(r3iy4omtnmnei t  2tm(r oo1oee ii3iydlaDrm(ms u0 rermr oa1opDraiei;(  2umxm3iy4lm nlnvtls a2rrurpnt1tlxn iciasls raumont) lxnxf oo1optrlivsl() exmimpnu4omeemncsltfaDtr( pot1olx ifciatfmDrmuvsnt0tetoxo todlm e neils t2xoio3ou1al emneil(fsDta(rpnt1altomo3iys m um(monu) ltrmr tatopte n sls)teuoio iodomtelfeta( aDua(mpot1oex ii3ilsfa2el( pnt0altrxo3ia1fpD livi;s0 exr(r no1lme liei ()sDuau oot4tpt mieildls el( sn(0 lxnxocto1lp raueo;s)t2xm(rpny1om elnvils  2tr( onu1opxoioetatfmDua( p;(0 rxrircootlpDelnvolt0t2xrir3oydap  lfeilt sruau  nt4altomicildls2rl( o;t0trtoxfcoatfmt aiei ()t2toir iu1ape lncsas aDrr(m no1tpx  oetltls2rm(vpn(4 etrxo3tadoaDraneol(0 euo(m3iy1lmen ivslsfsrrrx  oo4tlxo ocildfsDua(von(0 eerif3ta1lpDrauei;()srxmir3io4lm emfct s)arur(r ;o4opx ifeiytlsDuln o;(4trenmr todoat  nvi;s  eumxo3oy4ope  feslt)aruax  nt4oeeo iciat mDrau o t) rerxo3iotopte n s s0 rxoir oydlme  fvtas  rrr(  nt1olxnii3tydfm rau o t) exoio3oadlmt  i i s)srxoxmpou1lmt mnvsasfsrur(rpno0openmietlt s ranvp u0altnxfcia1lmDe nes (  2xoxm iu4olenlicsas)sDuaxmo;u0olxn f3iasfm emnmon()altoifcio1lm r n slt)s2ur(m3oo4lpeelivtat arur(r ;u4tptn icilsfs ra(vsnt) rtrmo iodfpD ln o t)t2to(opnodoleelicsls a2taxmoou0tptomieiyt s2rau snu4 lerif oadfaDr ivi t)t2uo(m3ou1lp nlietltfa2raumoot0tpenmicilt a elumsn()aexrxociydfm r uvo () 2xm(o no1lm elnei s aDrmumo;t1oeeoiiciys s2ra( s;t)alerxf io1oa rlnvols0s2tr(r iudameemneia( s2tr( ont1tpxo f3ild m2um( s t4 lerxr iytlm rlivo;( trxr(o ny1ol   ncs (faDtm( pnu1apt iiciytlm2ua(monu0tlxrxo oodfmDeln o t texriopno1lmt lnviat) Drmxrooo1tptomoeiydfs2uln o;u0teenir3tydfmDrlu i;( s2toxm oo1ol nlicslt) rrr(root1oetoifeild s umumo;(0aeenio iydlp rau o;s0teurxr iydlmeemnei tfsDtr(ronu1aex mietadfs rmnvp;u0 exrircoadfat  ivilt)s2xmim no1ap emfcsas)a2rrxr ;u1tet mfeiad s2rln o;u) renxfcoytfp elnvo;s truo(r3nu1lmeemncslt sDua(rp;o4tetomf3ildfs2emnvs;u0texoxocoadop rlu sls srxriopiy4amt mnvsl()srtaumooo0tpxoiiciaslsDeanmo;(0artrxf3tatfate i i t)srxoxo3iy4ll nlfcs ()sDtr(  ;t4tlenmoeilt s2em( o t0aeermf3oydom  li s t s2xrimpoy4ll e ncta( a2umumo;u1oexn f3iasfa ulnvs (0trenifctotopt  n i ()t2xoxrpiu1ole livtltfsDra(  ;t1olen o3iatls2umnvp;(0alxnmo3todoatr uvols  eur(m3oy4optelncsl( a2umum ;u1oetnio3tlsfm emu ont4altnio tytla eauvi;(0texoim3oodlle lneil( s2rrum ;u1tptoifctld s2um(vp u0aexoxo3tydomtran s;t)t2tr(o oo1altnmiet (fsDtmu oot0oleo octytfs2emu s t4teeoxo3tadop   ivs t  etmxopio1omtnlfeia(f 2umur ou4tetoiicild s ulumo;u0tlxnmocto1la  au il( s2xrxm nodlltelfvsas arrrxmp;t1alxoiicias m2umumo t)altrxfcoy1op   nvs t0srum(m3iodal elnviat aDtm(rpnt1apxoioetys m eanmp;u4altrxo oa1fateai i s)seuoim3nydal n ies t sruaxrooo1oexn fetlsfmDumu s u0areomrctytoaD lieo;() 2xoirpoudllt lnetatf 2ua( o;o0apeomoetys a rlu s t4 leoio3oy1laDrluvi;s0s2xo(rpny1amenmicta()s2ra( pnu0opeomoeilt m rmnmpn(4 exnio3iotopDelivs;s0t2trxm nu4om elicias sDrr(ronu4alx moetltlm rmumo;u)trtnxfcoo1lp ran o s) exr(mpiu4al  micias)artax  ;o0opt  f3ils s rm( o;t0 lxoif oydop elieils) rumio3oodamtnlfcsas) rurx pnu1aetoifciadfs2rmums;t0 exnir3to1optelu ols)teumir iu1ap nlici t  ruau poo4tlxniieiat sDuaumo;(0altrmo3oydlm eluei t  2xmxr iu4llen iet tfarua(r ;t4oeeoioctad m2emnvp u4artrxfctatlp e ivols)teur(m no4ole lici sfa2tmum ;u0aptoioctadla2umuvs;t0 eeomf3oadfp r i s;s seurxm3oo4lmt mfcsas)aDraump;o1tlx mociyslm2rmn o;u4trxrmrcoy1fm rauvi;s) 2toir3no4ap emfcilsfaDumu p;t0opxnioctytlm2ea(mo;t0trtoxf oo1faDr ivol( texrir iydoptn fesatf 2ua(  ot1tpxnmicils mDrmnvo (4 exrmo3oa1op  lnvsls) rtmiopoudap nmneslt artaur oo1texoii3iyt mDuan s u0treoxo ootla rlnesl(  rtmio iu1ape  fesasf Dta(mont4ope io3tyd aDemn pnu)arxnio iadfp raieslt  exrxr ny1lmtelicilsf rrmurpnt0apxomoeiyt a emu snt)alxnir3tadfmt anvs s s2tmio iu4lpen ncias) Dta(r nu4aetniieilsfmDrlnvs;t) reoiocoatlm  ai sl() rur(r3ou1ap e fvs s a2ua(m ou4openmo3iytlm um(vonu) rtnif oodop elues ( srxr(rpoodlltnmneilt sDrm(m ot0alx mietad aDulnvpnu)aeenmf ta1lm  luei;(0s2xrxr nudlmeemnvtlt)artaur ;o4ape mi3ilsfs umnmo;u)teenif3iatlpt aivi;()sexoio3oodlptnliciat)s2umu  ;o0opto ieils aDem( pn(0aeerirciodfat  i ilt)srxrxm io4lme  fes (  Dtmu p;o1texoio3tld a um( o u0aetoio oodfmte ueo s s2to(o iy4al  mnet ()s2rm(mo;t4tpto icias s2umn s (4tleoif3iotfmDr uvil(0 ruoxm iydome lnvilt)aDtmumpnt0opxn f3iad m2um( s t4trtnxfciydoptrluvi s)seuoiopno4lp  mnctls arra(r ;o0tle ifeiydls rm(msnt0artnxo oy1oat au s;s)teur(rpio1llte ictltfa2rmu o;t0aptnioetldfaDrl(ms;t0alenio iodla  an o (0trxm(m nodomt mnci (faDur( pot1aptoioeilsfa2uaums t4arenircty1fat  ueils t2umir iydoltelict t  Drmxrpno1oetn oeiatla2uaumont0 rxnir3tatfat lu ols) etr(opny4lpt  ncia()aDrm(mpoo0olx mi3tltls2uau o u0trtnif3oa1lp elues ( texriopoo1ape lfcslsfarraxr ot1tleoii3ilslm emnvsnu4tltrir3ty1fp r u olt)s2uoxr ou1omtnmicilt)sDrm(mpno4apxnioetydfmDemnms;u)tltoxrciatlm eaieol() 2tr(r3oodlm emfvsas)a2raurpoo4oltn oeilt m uanmo t)tleoircty1fmDeln i t0 eurxm oo1am elictlt sruax onu4ale mf3iatla2rl(vp (0tetnmfciydomt auvs;(0 rurxmpiydoltnlici t a2rmu  ;t4tleomoeiatfaDuanvs u)artoxo oadomDrai i ()trtrio3oo4am   iei tf ruax  oo4alxnmfciltls2um(mp;(4trenmr iy1opDranei t  rxmxmpoy4lmtn fvtasfs2ta( pno1tpeo feiat aDrm(vpnt0 ltnmf3oatopteaueil(0t2xr(o3io1ole livt (f Dum(  ou4apt moetadlm eanmo u)aeermf ty1op ranes t0s2xoirpiy1ll emfes sfsDta(mpnu4apenmictls s emnms u) reoxfcoytlaD  ivi;() 2uo(o3iu4om   fvsa(f 2tmx pnt4ape mfetlsfs emnms;(0 leomo tadopDeaieils  rurxr oo1amtn fctl()s2uru p;t4ale mo3tys mDraumpn(4aexrxr3ia1la  luvols0 2uo(rpnudamtn iciat) 2tauront1oetomo3iltfs rlu p;u0trtrir3iotlmD anvi t)s2xmxm3iy4lltnlfesa()sDurx  ;o0tle ioeils s umnmo (4aeerxr3oadoatr nvs s srxmiopnodlmt  ncslsfs2rm( pno0aetn i3iadfaDul(mo u0 exnmo3tytomD ln ols)t2uoim ou4lm nmfcia()srurxro;o1aleomictydfs um(mpnu4 lxrmfcia1lptrauvo s  rxmxm nydop  lfvi s)a2rrump;o0oltnio3ias a rmnmont4 eenir3oy1la  auesl() rxm(m oy1lpenlfei t)artmxrpnt0oleoiictas s rl(ms;t)trtrmrcoatlm eaiei;t0seum(mpiy4lpenlnvs s)sDtru pnu0tlt  o3iyt a umumsnu)artomrctodfpDr n s t)t2ur(r3nodopt mivta()a2tru o;o4opxo oeiltls2elnvont0tlxnmociadoa r nvs;(  rtoxm3oydam elfvs t aDtrxr ;t4aee  fetad s2ulnms t0artnxo3tatlmDr ues t)seur(o nu1olen iesltfa2umurp;u0apenmo3tat aDuanvp;(0artoio3tatlp eaueil(0setoxopnodaltelicils)sDtax pnu0texoifctytlsDeln o t4 renif oy1lmte nvo;t)trxmir no4lmtemies ( sDra(mp;t0aptn feiytla2umnvp;(0 lxrxf oo1oaDr ivi;t  rxrim nydol  lfeil(  2trur ;u4tltnio3iltfm2rl(vo;t0trtoxr3oadfmDr ivilt0t2xo(r nudoptemncil(fsrraxro
\ No newline at end of file
@@ -0,0 +1 @@
+ieils0s2tm(r ny1lltemfesl( arua(mo;u4aleomi3iadfmDumnmpnu0altnxr3iodlm eaneo;s0 rxo(r oudom e ietltfsDrr(mpnu0aexomfeilt mDea( o () etomoctotfmDr i i;()t2xrxm ny4ale mncias) Draum ;u4olto ociytlm em(monu4arxoif3totfpDe u s t) rto(m oo1alen fetltfa2umum ot0aex  f3ilslm emnmo t4arxnmrctytlm eanvslt)srxmxr3oy1lltnlfetltfsDum( p;u1openiiciat s2ean pnt)tltomr3ta1fpteli sls tetoxr3io4ol  lncsat)a2tm(  ot1apt mictldla2rmnmonu4aeeomf ta1fm eanes (0trxr(o3nu1am n nesas) 2rrump;t4aexn ictytlsDel( o (4tltomr ty1op  aivslt srtmxr ny4lle  ies s  2tm(rp;u4ope mieiydfaDrmnvp t0 lenmf3oo1fpDelieils srum(r3ou1amtn fvtl( arrr(  no0olt if3iydfaDuan o ()arxniocio1fat auvo;t  euo(o no4oleemfvt t)srrmumo;u1tlenmietltfs2rmn s u0 eeoircoa1omDrau slt  2xrxr oodlptnlictas srum(r oo1tpt iieiasfa2ulumo u)teeomf3totfmte i o;s) 2trim3nu4omt lfvsas s2rm(r ;o1apenioctys a rmnvo;()aexoxfcto1oatr uei;s) 2xo(rpou1lp n fvsa() Dtrxrpnt4tltoifeiys a rlnvs;t4tlerxfcio1oaDrai o;() rtm(o3oo4olt  iesasf Drm(  ;t1oltnmfeiaslmDulumo;t0artnxociotlpD ln o;t  2urxm3nydomte icsat s2taxronu1tee iicias s el(vs;()altoiocio1om elieo;t0 2xrxo3nudllte ivt s)sDrm(ro;u1tet iictld aDemn s;()aeeniocty1la   nvs s)seur(r oodam   fcsat) Dtru o;t1aeeoifctltfmDrmu p;t4 lenmo ty1faDrlu ilt  2tmio3oo1olen nciat)srta( pot4tpt iicilslm2ul( snt0 eermf3totlmtran i t  2uoxm3ny4lm n fcs s) 2rmxmooo4apxn fctyd s ulu p;() rxoif iy1lm rlneo;() 2tm(r3nu1opee fvi s  Duru  ot4olxo i3iat aDem(vpn()tlermo3oy1omDe iesl(0s2um(o3iudaltn nvtls) rtru onu4aee mi3iatls uluvont)texoif todoaD an i;() 2um(rpoo1al   fctas)sDrm( pot4aeto o3ildfm2ra( p ()trxrmfciatop e n il( srtmxm oydamte fcslsfs2rmurp;u1olxoif3iad mDem(mp u0teeomo oydfmDr n i t srxm(r oy1aptelnvtasfa2ua(m ou0olt mi3tltfaDra( p;t0altoif3oadom eau o;s trtoio3nu4ol emivtl( srraumpot4tpxnmoetys s2rm(mont4artoio3oo1fmtrluvo;(0 rxrir ny4altnlfesas aDtaump;t4apxnmf3ild a uaumo;u4tleomf tatopDran il()setmxr oy4lmt livslt aDtrx  ot4texn fctyt sDumump (4 exomo to1fm  auvi s t2uoxopio4omt miviat  2trx ont1tptnmo3iad aDumn p u4 ltrxociytfmt lues s) 2xr(rpou1omte nvi t)arraump;t1alxoifcias m2el(mp;u0 lerxf ty1fmDrli i;t setoir ou1apte icsl(f rrm(mooo4aeeo ociyd s ulums u0tetoxr3ootfp  lueslt  rtoxmpnydaleemfvsa(fs2um(m ou0olt  iciydfsDrmn o;u)trtoxf ia1lmDrlnvo s) 2to(rpnudlp n nvi ()sDrr(  no0oet mo3tad m uanmp;u0 rxrirciy1om elu sls s2uoxm oo1lp  mfvs t) rtm(ront1aee mo3tydfs ua(vont)alxomo3iytfpt  i ils) 2umir3nu4op e fvtl()aDtru ooo4aleoif3iydlsDranvonu0aexnmoctodlpt luvs;t0texm(m3ny4aleelnvi s s2um(ro;t1oltnmieiydfs uan o;()texrio ta1oa elueo t0 exmxm nu4altnmncs (  rum(  ot4oetnmociadfm rmuvonu) ltnif3tadlaDrliei;s)srxoirpny4altnlnvs t sDtmumooo0opxn ictlt s2elu p;u4aeeoif tydlpDe i o;(0 2trim iodamtelfvil(  rrmuront0teenmoctatfaDem(mo t) lxoxf3iytop e n o;( t2um(mpoo4lmtelicsa(faDtrxmpnt4altoif3iltfm2ulumo;u)aetoxf3iy1laD au o;t0t2urxm3oo1amte fcils  2um( pot1tee mfeiysfs2eluvp;(4 rxnxfciytop elies () rtm(mpny4ol e netltfsrrm(mpou1tlx mocilsfs2uanvsn()tlerircio1opteanvo;s0trum(rpnudlpt mivslt  rumu  oo1ape moetysfa eaumo;t4areriocoodoa r ueols  rxmxm nodllenmnvtls arua(  ;o0tptniicias m2rl(vo t4aetnxfciotlm raivil()s2tr(m iu4alt mnci s)a2tmu  ou1olxomociadfm2rl(vo t4arxnif3iadoat  neol() rumxmpno4ameemfvilt)sDraump;t1olxn ietls aDum( o t4alxomo oy1oatran i t s2xo(opoodomtemfcsl(f rtr(mpot1tpxn ocild s emn p;(4areoxoctadop rli i;s0srtrio3ou4oltn net tf Dtaxr nt4tpenii3ildfm eanvs;t4 eeoxfctotlpDeln olt) 2urxm3iy4amt mfvi (fsDra(mo;u0aleo ietasfm rl(vp;t4treoxf io1lm elnesls0trtmim3iudlmee fcil()sDtmxr no1tpe mietldfs raumo t0 lxrxrcoatfaD luvo t tetrim3iodam elfesls  2rm( o;t0altnmieilsfmDrl(vo ()aeeoxrcoadopte ieil(  ruoimpoudaptnmieta( s2uau o;o4ape io3tat mDum( p t4tltnio iydfa elnvols)trtr(rpnydole  ivils)s2tmxroou4oetomfeildls2ean snt0alenir3tydfp  ln i;t)trtmxm oy1lm nmnes (  ruauroou1tleoioeiasfm ua(ms;t0tlenif3tydom ran s;s0 rxr(o iudlme lfvs (fartmu ono4oetomi3iadls uln o;t4 leoxo iatlp r uvs;(0 exr(o ny4opee feias arurx pno4tee io3tad a2raump t4 reoxrcto1lmDrlieo t0 2uoirpiydoltn iesls aDtmu onu0aexo fciasfm ra(vont) leoxf oadlmDr i ols)s2xm(m3oo4lmeemnvsat)srtmum no1aptnifeiatfa2umumpn(0tlxrxrctatlptrauesls0truo(mpnu1al nlnesls)srrr(r nt4oet ii3ilslmDuauvs;(0aetrifciatfaD auei ( s2xriopiu1oltemicilt) rrrur ot0tpx  fciydfm2emump;u) etrmoctytlptr u s;s) eurimpoy1lmtn iei t) rurx  ;o4tlxomfeiasfsDulu sn(0tltnxf tydfpDelu i;t0 2toiopiu4optn ivi () Duaxmp;t0opxnioetydlsDul(mp t4aetnmfcio1op r ies;s0t2urio nodllt  fcs t sDum(  no1altn f3tadls2rlnvo;()alxoir3tydlpDe uvs ()t2toxo3nudaleelfetasfaruaurp;t0opxnmfctysfa2emnvpnu4teenio iytoa e u o;(0srumxopoy1ll nlivilt sDurx pnu0aetn fciysfsDra(vo;u4 lxoir tadfp elnvsls  2tmim3iu1opte nvt () 2tr(moot1alxn feilslmDrmnmpnt)altoir totfa  lnvs ( s2xoim3iy1ap   nct () Drr(mo;o0tptnmfctatla emnmo;(0 rxnif io1optr neo;t0texmxr3oo1llt mfctlsf rrau pou0aexomoeild s emn p;(0aetrio iatfm r uei s trxr(mpnu4lmt  ivtl() Dtm( o;o0aptoioctadlm emuvsnu0tlxoifciotlmD  u ils0 rxmxo3nudalenmnci t) Dtmumo;u0tpxnii3tldlmDeanmon(0altrircio1fpteanvs;s0trxrio iu4apenmiviatf Dtm( pot0aet  f3iytfmDrlu pnt0artoif oytomDelueo;s  exm(rpnydole mnciat)aDtm(m ou1tlxnmoeiatlaDelu p;u4aexnmf3iytfm eaivilt0tetmir ny4aptn fei (  Dumxrpnt1tlxo i3iysfa2rau sn(4aetnio ta1fmtraivil()s2uoxopoy1lp nlivsl()s2tmx p;u4tee iieiadfa2uaumo ()teerif oodlpDr n i;s0seur(opoo1olt mivsl(fsDta(r nu1olx mi3tasfaDelnvs (0areoxf tydfmDe ieo;s)trumxrpiudol  mfes (f rra(  ;u4ope mfeilt a2umn pn()altrmf3io1fmDr nei;s texmxo3nu1ol nmfvs tf rurumoou4oetnmieiadlmDemuvon()artomo3oydomte ueilt) rtmxr3iu1opt lfes s) rrrumoou4aetomfetadls ea(vs;u0 renmo3totfm elnvi;(0 rtrir ny4apte ivi sf 2umur ;u4apeo feiltla rau on(4 exrxfciytfmtraivs t  rxm(mpiy4lp nlfes t)a2ta(ro;o4ole  o3iltls el( pn(0aexrmo tydfp   ueo;s0t2to(o3io4am emfvtat)sDtmx p;o0opxn fctyd aDeln o u0aetrmf iytomDe uesls0srxr(opou1ol elfctat)aruau  ou1oee mf3iadfa2elums;t0teermr3tydoptrlu i;(0setm(opoodap emicslt)arrrxrp;t4texo i3tltlaDrm(ms;()aeenxrcoa1fp eln ols) 2urxrpny1alenlietltfsDua(ro;u4alx mfciasls rlumpn(0aexomo3tatfaDeluvsls0 euo(mpny1ll emncta() Dtrum ;t1alxomf3ias aDul(vo t4tlxnmf oodfa e ivs ()s2xr(o3oy4ole mnctls)s2umu  ;o4tpto fetydlm uluvp u)aeerif todlpD ai i;t t2trimpoo4al nmfesl()sDrrur ot4texn oeiad sDelu s;t4trerxo ootom rlnvols0 2tmir nudamtnmivslt  rrmurp;u4aptn fetatfs2rluvs t4altoir iy1fmt  neo t0s2xmir3iodlltnlnciat)sDrmuro;o0tltn oeiydlsDuanmp u)artrmf3oa1opDrlivo;()srtmimpiu4omenliesls  rrrxrooo1tpe iociat aDua(mo ()tlxomo oodlmDrluvi;() 2xo(m oy4ll emicsls) 2um(mont4teen fetasla2rl(ms t4tlenmr iy1lp rluei s) 2toio oydap n fetls  2trur ;u1teen feiad aDrl(vpnt)texnircio1lm eli i () 2xrxr oo4amtnlfvil( arumx p;o4tpxnmf3iysfa2rl(vpn(0tetnmf3iadfa   ueo;t) ruoxo3nu4lmeemnvias  2tmurp;t1alx mieildlaDeanvs;u0 ltrxo3todfp e u o ( seuoio iodam   ncs t  2rau oou1tlxnmociydls2el( pnu0texrifctadla rli olt0sexmio iy4llt mfesls arta(root1oexoio3iat mDelumo;(0tlxnmfciy1optelneil(  ruoxopny1am elict tf 2ta(r nu1alx  f3iytfm2ul(vp;()altnmociytlp eanvo s  etr(mpio4lm e ivtls)srur(m ;u4tpt mfciys sDrauvs u4tlxrmf ootlmtrai slt trumio nu1lm elivi ( sDumur ;u0tlxnifctytfmDuanms (0arxrmo oatlatrlies;t  etm(m3nodlpt miei s) 2urump;u1oet ioctlt m elnmo;(0tltrxocootfp elnvo s)sexoxmpnydolte fvs s  Dtr(mpnt4tee iieildls2emnvpnu)altnmrciy1laD lneo;s s2uo(o nodoleelietasfartmxro;o1alx  iciydlaDrauvpn(0tlxrxfcoatfat anvs;t0 2xrxr3ou1al  mnetl(  2uaxrono4tee mfciadfm ulu o;t)alermf3ty1fmDe u ol(  ruo(r ny1am elicta( a2rr(rp;u1alenifctlt s eaumsn()tlerxr3iytoptran s (0 rtmir3nu4oltemnetl()srrrur ;u1olt moetys m2rmuvs (4alxnxf ty1fpt luvolt srtm(m3nudolenlnvi sfa2rmx oou0opx  o3tad sDul(vo t0 exrmf ia1fat  nvs ()srxr(r nydlptnlfet t)srrau p;t4aeeo fctyt aDeluvo;t4trerxf3iy1lpt anvi;s seuo(r iydlpee icias)a2tr(m oo0aeenio3iysls ulu o ()teeomoctydopteai sls  2xr(r3io4openmici (  Drr(rpou1tpeo feias sDuauvs u4 lerxfciatfmDraiesl()t2umxrpoo1ll elfeia( srra(m ou1tpt miciadlm2el( s (4 lermf iy1lmDrlnvo s seuo(m3no4apte feiat a2raum nu4alxoifcils sDul(ms;()aeeomfctotlm eauvi (0 rurxopiy1am emfviat  ruauront0opt mieiasfm2uluvp;t0trxoirciadfp rau i () euoxo nudlle  feiatfarrrx o;o0opx ioctasfa2ul(vp;t4arxnxo3io1fm rlnvs;s srxr(m3ou4omt lfctat)artau pot4oeenioeiatla rmump ()tltnir3oytla rlivil()setmio3ou1opee neil(f Dum(mp;t4optoioctys s emnmo u)trenir3ootlaDeauvo;s)trumxm ou1apen icslsf ruauro;t1tpt  o3tad a em(mp t0alxnxocoydopDr uvo s0setoir3oy4om e nvs s a2ta( pnt0aeeniociad s rm(vs;(4tetnioctatfa  lieslt  eumio ny4omt lictl()s2um(rono0opt mfciytfs2ua(mo t0altrxo ty1om   i s;s)sexrxopou1lpeemfvtlt  rum(mono4olxoifetltfmDul(vpnt4 ltnxr3tydfa  lnesls0 2tmxr3iu4opee nci (f 2tmur ot4tlxo ietydfaDelnvpn() etoxr iydlm eluvo t0texo(mpoo4ope  fvsas  Durxrp;t0tpxnmfciyd m2rln ont0 rtrxo3to1fmDe nvols0 2umio oo4omen icta(f 2ra( pnu1opt ii3iyt s2rmnmo t4arxnmf3oy1oat aneol( sexoxo oodomeemnci ( a2ua(r nt1apeoiieiatlm2eauvo u)texrmf iadfpDrauvi;s0texm(r3oy1apt  iviasfaDrm(mpnt1tpxn oeiytfm2ul(vpnu4altomo3totlateauvo;s srxr(opoo1ame  fvtasfaDtau o;o1opto oetas s ulumsnt0trtoxrctytopDeau ilt0teuo(mpny1ll elfeias sDtru  nt4olxo fetlsfa umnvs () rtnxr ta1opt auvol(0trxm(rpiydape  ieia()aDta(mp;o1aet io3iltls2ulnvp;t4 ltoif tydlptr u ol( trxm(m3ny4olen fcia(  2tmurono4tlt ioeiltfm2el(mp;(4 rxrifcoo1lp rli s;( teurxo oy4ame mncs (f 2rrxmpno4aptomieiadfs2ua( snu0tltoxfcto1faDrlueo;t seto(rpou1apeemivslt) Drax pnu4texo fcildfsDeanmsn() lxrir oodfmDe i ols t2uo(o3io1lleemfvilt s2ra(r ot4aex ii3tad sDua(vont)arermociadlptrlnvo;(0setm(m3oodapt mfvtltf Dtm(rpnu1olx mieiltlm2uauvs () exrif3io1lat an s s)s2umiopou1aptnlfes s  rrmxr nt4tlto o3tat m2eluvonu0 etomr iy1fpD aneolt  eto(rpio1lp  lnesas)a2rm(mo;o0opt mfeiatla em(vsnt) ltrir tatlm raues t0t2xrio3oy1lpen iei t a2tm(m ot1tltnifetyt sDulump;(0trxriocoytfaDrauvs;t) 2tr(mpiu4lpee fesl(f rum(mpou0aptoio3iydfs rlnmo;t) leniociytfmD aivs;s sexm(mpoo4llen ici (fs2taxm no0opxnif3ilslsDrl(vpn(0arermfcia1oaDelu i () 2xo(m3oo4apeelieils) Dtax pot4oex iietlt a2ulnms;u4trenxf oadlp r ivo;t0 ruoxmpiydope lfcs (  rraum ;u4apxnmfeiadls em( o t0aeeoifcto1om rlu s s0srtoxo iydllenmfeiatfartrxrpoo1tpeoii3tysfs2eauvsn()alxnmr iy1op eluei;s t2trirpno4llenmfvsls)sDumu o;u1alto f3tas s umn snu)trenifcootom elieo s0t2xmxr3nu4alen fct ()a2tm( pnu0altoiicild m eluvs u)arxnmrciy1fm rlneo;s  2urxr oudol  micsa(f Dum( o;u0tpeoiiciat s ea(mpnu)tlerio ootoaD an i s0teurimpiodlm e nei ()arrmxront4altn fciaslm2ea( s;()trerxf iotfmt lnvo;(0trto(mpoo1apt mnesasfs2ur(rpot1optomo3iatfa emnms t0 rxomr3io1lm elivo (  2trxr nudam elfvsa( s2umxr ;u1tleoioeildla el( p (4 reomf oatla e n o s  etoiopiydap n fetlsfarrm(m no0ole ifetad mDra(mpn(4 eerif todfptr u o t0 2trir3oydomt  nvt ( s2ta(moot4alx mf3ildlsDeauvsnu0 lxrio3todla e neo;( t2to(o oudll nmivia(fsruaump;o1opx  fetysfm2rlnms u)alenmfcootoa   u o s  2tm(o nodolt mnvs s srrr(mpnt0optoiociasls uaums u0 exnmr iodfptr i i s0tetm(m3iudom nmfetl(f rra(mpno0aetn o3iatfaDeauvon(4tleomo3iydfateluvolt0sexoxmpny4al  lnes (f Dtrurp;o0tptomfcias a2eauvp;u0aeeomf3iytlm  liei s)s2urxm ou1am nlncilt s2tau p;t1aeeomieiyt aDemu o;u0 rtrmf ty1faD aueilt0s2xrirpoo4apt mivtltfa2raur oo1oee mf3ils a2eanmp t) reomf oadoatrln s;t0 eumxopoy1lptnlnvi (f Dur(  ot0tptomfeiytla rluvsnu4 rerif oytfm  an ols sexrxmpoydamen fvs (  Drmxront1aptnmo3ias aDrauvo;t4aeerxr3oytfaDe ueil(0seuoxmpnu4ap n nesatfs2ur(  ;t0tpt  ictys aDeluvo;u0 eeoxr3iadlm  li s;t)trtoxmpou1am elies ( srtrx  nu0alx ii3tltfm ua(mp;()tltrxo3tatlatraueo t0texr(r3nydalen iesas) Drmx pno0alxoioetlt sDel( snt)altrif oa1lmDean i ( t2tmxm iu4lp emnes () 2tmxmoot4texn ociltla2eanvp (0tlxomociy1la eliei ( s2umxo3iu4lle mnvt sfa2tm(ro;o0opxomfetyslm ran onu0 lxniociydlmDrlivi;s t2xrxr3ou4al  lfci (  2urxro;o1tpx  fctlsfmDemums () eeomocia1opDeanei;(  2uoxr3iudapeelfvs s)a2ta(  ou4tleomf3iasfa2ul( o;(4trxrif3iydfatelivi s0seuo(o3nydom n fci tfsDrmxmont0olxomi3iytfsDrauvo u0altnxo3tadfpDeliei () rxmimpou1ol emfeias  2uru o;o0oet mf3tytfs2rm( p;u4aeenifciadlmDranvs t)srxoirpoo1openlnctas)sDtmum ot1aeto ociyt sDel(mo;(4alenxo3todlptranvi s)seur(mpiu4lme mnci ()s2rrump;o1tlx mf3iat m um(ms ()teeomfcta1oa eaivo;s0sexoxr3ny4om nlies ()s2tmumonu1tpxoio3tyslm2umu ont) exnxr3ia1fm  lnvs;s  rto(m io4opeemics (f Dtax  nt1opxomiciytfmDrmnvont4aetoxf3io1oa   iesl(0srumim nodap nmfetl(  2raumpnt1openio3iytlm2emu o t)tlenxrciy1opD  nvs ( truo(o io4lmtn nes (f rrrx onu4opeoioeiyslmDumums;u0tltrmf3todfmD livs s  2tmxo3oydol nlnvsls a2taxr ;u4oexnmo3iltfm ea( ont4alenmocto1lpDeli i;t) 2umirpnydop nmicil(fa2ta(root0oetn ociadla umu o;t4altoif3ootlmD aivs s0 2tm(m io1oltnlfcils)artmxmono1aetomietadlmDumu p;u0 rtomfcoa1fmteluvo;s) 2tr(m nu4lm emivs (  rua(ront0altomictydfsDuanvs t)teeoxf tytfp  aivs ()s2xo(o oodlmt  feia(faDraxm oo4apt mietas s2eanvp;u)altrxf3tadom  lneo s  2urir iydapeelfet tfsDtr(moot4tltoif3tysls2um( on(0tlenxrciatomDe nvs (0trxrxo nu4lpt lfetlsf rtm(moot1alxoifeiltfs rl(vpnu0teeoxociodoptrluesl() eumxo iodlm  liviat  2umu pnt1aexomicild s2rmn s (4altomf3oadfpDr nvo;s0sruoxmpiu1ope mnci tfs2um(r ou0aleoif3iysfa2eanvs;(4altnir3iytomtr ues s seurim3nodomtn nviat)a2tmxmonu4oleomociysla2rmu snt4 ltoxf3iotlateaivslt setmxm oodomt mivs t artaum no0aex iicildfs rln o ()tltnmocia1fm  lnvs;s)seum(o3no1optnlict ()arurx p;t4aptomoeilt m umnvs;t0aetrxo oytfatrluvs t0 etoxo iy4ll   fesl(fs2rax  nt1tleoii3tytlsDum(mp t4artrxf3io1fmDeluvo ( s2urxopiy4lm  lfctls sDrrumo;t1texniictlsla2eauvp (4 ltnio3ty1faD lu s t srumio3nodame lfetlt srtr(  ou0ale ifciatfa2uauvonu)trtoif ootlptr ivs;()s2xoxopoo1lm nlfvs t)srra(m nu1alen fctaslmDum(mo u)alermfcia1lmt auvs t  2urxm3nydolte nvs sf 2ra(r oo4aleoifetltlmDel(msnu4 exomr oodlpDrauei s) euo(opiy4amt  fctl() rur( o;o1tle  ieiasfs rluvont)tleoxr oydlp eaneo;(0srxoxmpny1lptelfeils srururoot0aptnioetld a umnvsn(4teenxo iatlmt lneo;(0 etrxo ny1ol nlicsatfa2umxmont0oleoii3ilsla ea(monu) rtnir3oy1omtraueo ()seumxr3io1lmeemici s)aDuax oou0tlx mf3ias sDeanmo t4tlxrmf3iotomt  u ilt)texr(o3iu1ole mfcil( s2taxrpnu0aexoifcilt s elu onu0tetoxr3ty1fat li s;t0 rumxo3oydol elfes sfsDtmuroot4olxoiieildlm2el(vp t)arxnxf tatopt anvolt0trxoxm io4ole livta()aDtrxmpou4texomoetlsla emumon(4texoxf oa1omtr uvo t texmim3nu1open neiltf 2uaxr ot4texnif3iltlm2emnvsnu4alerio3iytla e ivi;t0s2xr(m oy4aleelfet ()a2ua(rpno0ape mi3tytfs2elnvpn(4 etnif3iadfp elues;s  rtr(o3iu1alenlneiltf ruaxront0oleoifctysfa2eln p;()trtrirctatlpDeau i t srxrxr iudomt lfvilsfaDtmumpou0tltnmfetydlaDuluvs t)arerxf3iodfmt auvs ()srumirpnudolen fvi (fsrurumont1alxo fetyslm2el(vsnt0tlxomo ta1oatraivi;t0 2tmxopoodame mfvi () rrau  ot4olxomoctasfm ra(vo;t) renir3iodlpDraieo ()setm(rpiydolt  nvsas) Duau ont0apenii3tytfa el( s (0texrxrciy1fptranei;s0s2trimpiu1op nmicilsfarumxm ot1olxniietad mDrlnvo t0arerirciytfm r u i t) etr(r nydlltelnvtls sDrr(mp;u1olx moetys a2ra( o t4texrifcoatfp e nvo;t)s2tm(mpiy1lp emnvtat sDum(ro;o4apx mf3ilslm2rlnms u)tetnmf3ty1lm e n sls s2umio3nydlmen ictat)aDumxro;o0teenmf3tatlm eln s;t4aexnxociydfm elivo ()srur(r3iy4al nmfcs () 2rmu o;t4oltnifciysla rlu snu4areoifciotop raies;t)trtrim3nydol  mfcs ( s2um( oou1altoiiciltfs ra(vp t4teerxf3ty1omDeln o;t) rtr(o iy4ole mfcil()aDrr(r no4tetnifciltlm2umn s u0tlxnmf oytfmtranvsl()srtm(rpio1lpen fcsas) Dtrxmonu4ole  i3iatfa2um( s t)alxrmfcoy1oaDrlnvs (0t2umxmpiu4ll emnvs t)sDrrxrpou4aee iociytlmDrl( pnu)tlerxrciy1faD ln s;() exrim no1lp elicil(fsrtr(r ;u4apxn fciyt a uln pn(4 rtrmr3oatop   uvol(0 2xmxo iydopt lfei s srrr(m ;t0apt
\ No newline at end of file
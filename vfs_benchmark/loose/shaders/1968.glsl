@@ -0,0 +1 @@
+u ilt0texrir3oodol n ncsl()sruaurpnu1olx mfetld s2em(mo ()altrxf3ootfatrli o t0srumxm no4amen net tfaDta(rpnt0tpx mfeiyd sDeau o;u0aeenxo iydlpDranvo s) 2ur(m nydolt mnetltfaDra( p;u4teenmoctysfsDrau s u) lenmocoodla eanvi ( tetmim3oydlm  lfetlt a2rr(rpnt0aeeo octys a em(vont0alxoxo tatlat  nvsls0s2uoxr3oydlme mivias a2urxmpnu4oleomfeiytfaDrm(vonu4aetoir iotfat auei ( t2xmxo iudom   ivs ()a2rr(  nu4olxn fciasla2eaumo u) exoxf iydlatr uvolt)tetm(m3nu4omte nesas) 2tmx ont1tltnioetat a elu p;t) lxoirctatlpD lnes ( srxrio3ny4ol n net ( a2urx o;u4aexo octysfaDranms t4 rerxf oadlpteaivolt) 2xoxopiodlp emfei s)s2ta(mp;o1olx mf3iadfm el(ms;t4 exomo oodlat lnvs;s)trtmir3no1ol nlfci t artmx pot1tptoiictytla rmn p;u0tlenmf oatomte n o t0srtm(m nodom   fctls  Drrx  ;o1olen ocild aDumums;t0 etrio tydlmDr ues t0t2ur(m3iu4alt lfcs tfsrtr(r ;u1tlx  ieiyt mDeln s (4alxrmf oy1oate nes;s)s2xm(m3nu1ale mfcsatfartmxmp;o0aee ifciadls ra(mp;t0 exnmr oydlmt  uvo;t teto(o3no4llt mnet ( a2rm(mpot0oltnmieils a uan o (4arxnmr oy1omt  i ils0tetmimpiodaptn fvt () Drr(m ;t0oeenioeiltfsDulnmp;t4 ltrmr3totfaDeau i;()t2tm(m3io4om n nvs tfsDtaumoou4tpeomiciys aDelnmo u4 ltrxf3iydfptr neilt)seum(opoydole mneslt)srraxroot1opeo o3ild a elu s t) rxomociytlptrlu s s trxm(o nudomenlncil( artau p;t1oee mietltfmDumumo u) eenxf3iytfmDeaiei;(0srtmim nodamtelfetas) Durx ooo0oet  ociytla rln p;t0alxnxf3oydfmt aueo;t) rtmxrpiy4apenlici (fsDraxrpou1tet ioetydlmDrlnvo u0 rxoxrciy1fatelnvsl(0s2uoir nudlmenmfetas s2tax ont1tptomo3tlsla emums;u0tlxomo ootopDr u s;t  eur(m3iu4amenlivta( srta(r ot4optnmociadlm rmums;()trermo ty1lpDe n s (0 2um(o ou1ol   ivs t) 2rmx  ou4alx  fcilsfs2ul(vo ()tlxoxf3iy1laDeanvsls s2xrir3io1op   ietat)arrrx pou1texn ieiltfsDem(vsn() leoifciy1omD anvo;s0 2trirpio4lpt lfci s)a2rau pnt0apen ictlsfs2ea(msnu0 exrxrciotfm e n sl(0trxo(r io1olenmnctlt  Dtrx  ot1opxnii3iyd sDelnvonu)alxnir3iytfmte nvolt  rurio io4olenlfvtlt s2ra(m ot1oleoiociltls ulnmp u0aexrxrcty1opD aueo;t) etm(o3nudapee ietas)sDrr(ro;t4optnmietasls2umn sn(0treoifciodlmD li s t0sruo(mpnu4ap nmnesa(  2ta(rono1alenmfciytfa elnvp;u0trenmrciotfpt lneo t0setm(o3nodopt lfet ()a2rr( pot0apen ieild mDuluvo;u4aeenxr3oatom   i ols0t2urio io1llt  fvi ( sDrau ooo4tex moetys s ea(vs t4 exrxr tadlm eaueo ( t2uo(m3nodol  mfetl(fa2rru pnt1aee ii3iasfa ran o (0tlxnio io1op elnvi (  etrxo nydllenmncsa(farua( oot4alx mf3tlt aDuau snu4 rtoircio1lpteaueo;t) 2xo(m oydllen fesl(fsDra( ont1tex mictyd aDelnmp;(0teeoxr todlpteanvs;s0t2xr(r3no1omtelnei (fsrtmxroot1oeeoioctld s rlu s (4alxnmr todfpDr n ol( srxoir3nu1lmt lfvtas  rtmurpoo1aee if3iydlm2eaums;u0artnxr3oadoptranes s) 2toxopio1ll n fcsat)aDraxr nt4tltn o3iyslaDrmnvo;u4tltrxr3oydoaDrlivils)t2uoxmpnodlpe lnet s)a2urx ooo0tlx  ociyslsDrmu o;u)arxoir3ty1om eauvolt0srtoirpiy4olt mfvt tf 2urx  ot0olenifciad m ea( p t4 etrmociotla eli sls  2xrxo iydllenmnctl( s2ta(mooo4apxn fetyt s2ulnvont)artnmrciadfa r n o () rtmio3iodop  mics (f 2rrxrp;t1tleomicilsfa umn p u0tlxrxr oa1fmDrlneils) eto(rpnu4ape  nviat)s2rmxront4tle mfcilsfs uauvp;(0aexoxo ty1oaD aiei;(0 etm(o3iy1ape livtltfsrum(m ou4aleomo3iydla eaumpnu4 exomf oo1lpt  ivo;s0srtmio3oydllenlnet s)s2tau poo1tpt  fcildfm uauvo;t4tetrmf io1lm eluei t t2tr(m nu1llt lieta( sDtaxmonu1tlxo i3tldfa2em(mp;t)arerio todfp ranei ()t2xo(r iy4ame mieilsfa2ra(m ot4olt  fcilsfmDem(ms;u4 rxrirciadom e ivil()t2uoxrpio1oleelicil()aDrrum nu1olto fcildfs2uau s u) leomr totfp r uvol(0s2urxm oydopt mivsat)s2uaum oo0aleoif3iadla emu o u0trtnmo3tytlmDr uvils) rtrim3nu4amt  fet () rrru p;o0apeo octlslmDean on(4 lenxr3iotopD lu ol( t2xmir3iy4alt lfvsls) rtrxm no0olx ifeils m2emu snu4 etoxf todfaDeli o s0s2xoirpoy4al e netltf rua(mp;u1apt  fciat s uan p;(0 rtoifcoo1oa  lnes ( srtrirpiu1ll  lnvslsf 2tm( oot0texomieilslmDem( s (4trtnmf oatoateluvi s)t2xoxm3iydom nlieta( a2uax  oo4ope  oetyd mDrm(mo;(4aexrxr oydfmte neils0 2urirpnu1op n nesl()aDurx  nt4tlx mociadfmDrmn pnu4alxrioctydoa eliei s0t2tmio3oy4lpeemivilt sDrmu pot0alt io3iadlmDranmsn(4aexrir3iy1lpt  u olt s2uoim3nudop elfvtltfaDtaxmo;o1apx  ietysfm2ean p;t0teeoxr3oytfaD ai o (0trtoirpno1alenlfeia(fsDur(ronu0tpeo fciadfa2rl( pn(0aetnio ta1omDrlivols0seurxmpiy1lmtnmncils) Drm(rpno0optn ictytfs2ean p () ltrir3oa1lateliei;( texrxopiy1apee ivtl( arrmu poo1tetniietldfaDrm( o;t4altomr3tydop eaivi;()setr(rpou1lp nlfcsl() 2rrxm nu1alx ii3tatlm em( s;u0aetomoctotfp   u sls0texm(m oudolen fcils)srrrxront0oee  ieiydfs2ean p;()arxrmrcoy1omDrli il() 2um(opiu1olenlneiltfs2tr(roou4tee  feiatfm2ea( s;t0artrmf3oo1opDe ivs s0trumxmpiu1ol  lfesl(f Dra(  oo4apt iociys s2eauvs u4aetomo oydomt ai s ()srumim oo4altemictlt)s2ta(r ;u0ale ii3iyslaDulu s u0altoio3tydlm eluvs;t  rtm(r nudaltnmietat aDum(ro;o1aptoiieiyd m2ua( p;()tetnir ty1laDelnei;()s2xr(o io4omt lfes ( aDua( p;o1oexnmo3iasla em(vpn(4texomo oytfmt an o;t)setrxr3iy1lp nlivtas arta(mp;u0teeoifetld sDum( p;t0 rxrxfcoytlatr ivs;t0t2umimpoydamtnmnet t srua(  ou4aeeo f3iatlm ulump t0aeeoxocto1fa  anes;s texm(r3io4ap  lnvtlsfsrtrxr nu1openio3tydls2ua(vsn(4arenmf totfatrln slt0trxmio3nodomtelncs s)sDtax p;t0tet  ocild m ra( p u4alxrxr3io1fatran i;t0 eum(r3no4lm emnvils)srururoot4alenif3tls a2emu p t4tetoxfciadopte ivsl(0t2xmimpoydamt mict t aDurum ou4altomi3iydfaDuaums;(0 rxnxo oo1lpD an s;s0trxrim oy1lmenlnetlt) 2tau pnu4oexnif3ilsfs2eanvont) rxrxo tytla  au o;s0srum(opiu1om nlivils aruaxrpoo1openmieiys m ea( sn(4aetoiocta1opD  uvs ( s2trxr oodlm elicsa( arumu  ou1oeeo fciytls2uluvp;u0 rtnmo oa1op   uesl( srumimpno1ale livi (faDua(mpnu4optnmfctldfsDua(vo;t0trtrxf3iotlmD aneol() etrxr ny1aptemncsa( srum(m ;o4alenioeiyt a2eanms;(4 rtoio tatfmDeln i (0 eurxr3no1omtn ncsa() rra(rpoo1alx mi3tytlaDean pn()tleoioctadopD  ies t0 exoir oo1oleelnes t srururpnt0alxniictyt m2rlumo t)aexriociotlptr nvo;()t2tmxrpiudal  mivilt)sDumumpnt4tlxnioeiat sDrm( p (0 eenifctotoaDe u i ( sexmir3iu4ll  lnet t) 2trumonu1apxniocildfmDuluvo;t0 etrmo oodlmD anvs;t t2um(rpoodlm e nct () Dururo;o1oleoiieiasfa2ul( s u4texrio3iytopDr uei;t0tetoimpnydlmeelfcs t  Dtm( poo1opt  fciasfs2uanmo (0tetoir tytoaDeauei t0 rxm(rpoodal  lfviltfs2rmum oo1teto i3tlsla2rln o ()teeoxfcoydoa r nvsl(0texo(o3no1am   fcil() 2rmxmpot0opxnmoeilsfsDra( o;u) lenxf tadoptr ueo;s)teuoxm3ny1apeelfesl(faDraxr ;u1alt mo3iys s2uaumsnu) rtoiociadfmtr u sl(0sexr(r3nu4omen ietas) rtmu pnt0openmfeilt m2ulu o u0areniociodfa rli o t  rtoxo nodape mfcsa()sDtaxmo;o1opeo ocild mDuau s t)trermo3oy1oatr ies;()srxmir no4lleemfcils sDumum ot4optnmi3ias m uauvo (4 leoxf oatfmt lnvs t)teum(r3ny4opt lietls  Dtaxmooo1tlxniociyd a ua( s u)aeenif oatfat lueolt0 2xm(o3oo1lm n ncs t)srumx o;t4oetoioeiadfm2uan s;(0artnmr ta1opDrauesls0 2xrxrpoy1lltemnvi (  2rm(  ;u1aee mi3iltla2eanvp u4 leoifcoodlm   uvslt)srtr(mpoudopeemneils  rum(rp;o0apeo f3ils m emn pnu0trxoxrctotoa  aieo;(0t2tr(rpou1lpenmfetas) 2rr(mpnt4aet  i3iys mDrl(vpnt0tetrmrcoy1om eauvi;s tetmxr iy1apeelicsltf Drm(mpno0opt ifeiadla2emu p (0 rtrio tytfa   uvs t srtm(r iy1ol e fcil() 2rau oou1tlx io3iasfsDumump;t)trxrmo3ty1lm  aivi;t)s2xoxm3nodap nlnes sfa2rax  nt4alto f3iatfm2ulumsnu4tlxoiociy1late nvo;s texoxo nodllteliesat)sDraxmpnt1tleo ieiyslsDemu o;t)trtrmf oa1late ivilt)texmxopnodamte ieias)aDtmu  ou4opxnmi3tytfa2rmums;(0 ltrmf3to1fmDrai i;t t2umim3iydoptnmiei s)a2urx  no0alxoioeild aDra(vo (4aetoxrcoatfa ranvsl( s2um(mpio1omt mict t) rum(rpou0tlt miciyd m2ul(mo;t) exoio iatop  anesls)sexoxmpiydlp n fvtlt arrrxrpoo0ole mo3iysla eluvs;u4artnxf iytomt anes s0t2toxr nudlltemfetlt  rtaur ;o4tle  feiydfa2ul( snu4 lxomrcia1lmt  uvo;(0 etrxr ou4ome livta(fartmumpnu4oetoiociat a2rl(vont4alxnxo3todfaDeanvslt) rtmxo iu1lp emfes s)aDrm( oot1alx ii3tysls ra(vpnt4texrxrcoo1fa r neols0 exm(rpny1aptelicsl( sDra(monu4ale ioetltla2ran pnu4 etrxo3ia1faDraivslt)truo(rpny1olt  nes s artrxmooo1oexniietad sDuanvs ()aexrmfcoo1oatrau ol( s2xm(rpoo4aptnlivs ( aDtr(mpou0aex  o3iltlaDrlnvsnu4aeenmr oodomtrln o t)s2toir3iu4omenmnctatf rtaump;t4opto oetydls ra( p;(4aeenxf3oadoaDr neo;()trumxo3iu4open iviltf rtr(r no0aleo ietlt sDel(vo;()areomf3iadomDrlnvi t0 2xmxr3nudlltelieta( sDrr(  nu4tlt  feiytlsDumn s t4alenxo3oytlmtr n o t  exm(r3no1am elnvtasf rrr( ono4ale  icilt a2em(mpnu0teenmociy1om rai i;t)t2toxo3io1llt lnvils)artm( o;u1oee mf3iasfs raumo;t)trxnmociydlmDranesls)srxo(o3iy1am nmivtas arrr(rpoo1ale ioctas m ul(mp u0tlerxrciytlpDeln sls sexoir3ou1lptemnvilt srtrxr nu0apto oeiltfmDrlnmsn(4tetrircio1fa rli ilt  exrxo iy1omtemfcsl()arrru p;t1apt  fciat a ul(mo t4aleoif oadfpD  nvo s) rtmirpoy1olt mnvi ( a2tmxmpno0opx mociytlm ranms;t0alenmrciadomt au i ( teur(o3no1ap  mnetl()sDumur ;t1olxn f3ias sDulums (0aleriocoadfp   i olt  2xoxm iodomt  icslt aDurx p;u4tpe  ietys s2rl( s u0aeeomfctatfaD auvo t truoxmpiodol e icilt sDurx pno0apxomictas a elnmp u)arxomf3oadomteanes s)s2xmimpiu1lltnlfciat)s2ur(  oo4tpto i3taslmDuan pnu0trenxo3iotlmtrai olt trumxm oo1am nmncil( sDua(m ot0opxnif3ilsls em( s u0trxnmfciytlpte nei s  rtrio iydome  fvia( a2ururp;u1alto fetatfa umnms t4 rxoifciodfa r nvil()t2tm(rpiy1llt mnesatfa2rru oot4oex ifetyt aDem(mpn(0aetnmr ootlatelnvs;s texrxo nu1amenlietatfsrumu o;u4oleoiietldfaDum( o;u) lxomo3ootfa rlu ols  rur(r3ou1aleemicta()a2uax o;o0apt  icildls eanmsnu4alermociodopDrln o (0 rxmxopny1om  lics tf rtaxrpnu4oeeomieild m ean s;(0tlerio3oodfatrlivils  2tm(r3nu4ll e ivias)aDraumont1tlxn i3iysfm2rm(vp;u4trtomr ootlm  lnvi;()sexrim nodom n nctasf rraumpnu1olto iciatlm elnmp t)treoxo tatfm  lueo ( s2um(opnydomt miei s a2truroou1alt mietad sDrlnvpn(4arxnmo io1lmt lueo s0srtm(o3nydap  lfcsl(fa2tmurpoo1tle ioeilsfa el( p;t0trerxf oydfmtr nes;(  rtr(r oo4ll   ncta(faDtmx p;o4teeomi3iasls um(vo u4 reoif ootlpDraivo;t)tetrir ny4ll   neias) Dta(  ou1apeoifciys a2el(mo;u0aetoiocta1opDe ivs;t0setr(r nu4omte ivtl() Drmur ;o0oeen ociasfs2ra(mo;u0arxoxo tydfmD lneol(0sexo(rpno1al elivi (f rtau  nt4tltn o3tytfm2rlnvon()arenio iotoa ean i;s) rxmio3iy4amtemfeils  2urxmpot0aeenmi3tltls2emnmo t4 lerif iytomt  ueils truoiopnu4oltelivta()sDrm(m nt4ape io3iyslmDemn pnt0artnmr iytlpDr neo;( setm(r3io4am e iesat  rta(r ;o0tetomieiytfs uluvo;t)tlxnio3tatlmtr nes ( trxr(o3iy1lptn ivsl(faDtmxr oo1olxniociltls2rm(vo;t)aetrxf3ootfa elu i s srxrxrpoo1amenlfvtlsf rra(  ;t1tpeomo3iltfa rluvs u0 ltnio3oydlmte nvi;t)s2tmio3iodal  mnvil(fa2ururpnt0tet  ictysfsDuanmo (4aexomoctytfmDe ivsl(0 2xm(rpnu1lpe  nvtlt) Dua(  ou4aptnifeiatfaDuanvs;u0trtoxr iy1faD  neol(0 rto(r nudap  lneia(  rtauroou1opto ocild a2eanvs t4altrxr3ia1fpD aivs s  2tm(r3nudlmen ivta() Dtaump;u4apeomf3iysfsDuluvpnu0altrxo oydopteli s s0seto(o3nudlleemnetlt) ruaxm ou1altomf3iydfm2rl(vont0arenmo3oydlp eai s ( setoir nudol emfct t srtru o;u0aetnioetaslm ea(msnu4 rtnmf3oadom ran ols)s2uoirpiy1apeelnvils srtaxrpno0opeoii3iydfm2ranvo;t4aeenio3oodoate ieols)tetmxr ou4ale mneia( arra(r ;t0aleomi3ildfaDum(mo ()arxomociatlptr u ilt  2tmimpno1om nmfeiat)s2raxr nu1oleoifcils a eluvsn(0 etnio tydoa r nvols)srtmir3oodll nmnesa( aDurxmpot1apeniieiyslm2umnvsnt0arxrxf3ia1lmDeanes;s)t2trim nu4op nlies sf Drm( p;o1alxo ociad aDeluvo;u4tetrmo3oydlp  livil()teurxopoo1lpen fctlt)sDuaxm ;t4tee if3iadfs2ean o (4alxoxo3tytfpD  neol(0sruoxr oydoptnlicsas)aDua(mpnt0tlxomfetlt aDelnvsnt)aeeomocio1laDrlnei;t t2urxm iy4omenlfctas) Drm(rpot1tpeoioetyslmDemn sn(4 lxomr todla eaneolt)s2tmxr ny1alt lfvslsfaDtruront0optomfctasfaDuaumsnu4aeenmr tatfpt lieo (0setoir3ny4ol emivtat sruaurp;t0oeenii3iysla emuvo () eermo oo1lm eli slt0seur(r3oy4lptnlivt s aDrrx  ;t4altnmoeils mDem( o t4 lxnmfctydop raies ()sexmxm3no1omtnmict t sDtrx pot1oexomietasfm2ua( p (0alerir3ty1om eaneo;s0sexoxo3ny4lmeemfvsat)s2trump;o0olenioeiad s raumo;u)arxrxociotomte u i t0t2xmxo no1lme  nct t s2uaxmo;u0aetoioeilsfm elu s;t)aexnxf iodlateanvo;t)teum(mpiydlmen iesat)aDumur nt1aet  ocildfm2ua(von()tetomo to1lp  aivs s t2xo(o oo4ll emneslsfa2ra(r no0oeeomfeilslaDea( o u4 eenircty1optrli ilt0seur(m iodll  miei t arraxm nt0apx moeiltfa ulnmo t) leomr totfmt  u ols)sexoiopnu1lpee nct ( srtmum nt0opxo feiytls2uaumpn()aleoxo3totfmt anvslt0 rxoio ou4lpe miet tfsrraxm nu4oetnif3iysls ul(vsn(4trxrircoatla   nvo;t0setoxo oodalee nes ( arrr(root4ale  f3iltls rmu p u) etriocoydfaD lnvi t)sexm(m3iu1ap  miet s s2ta(r nu4optn oetatfa emu p;(4aetoxrcoodfp r ueo (  2xoir3oodoptemics ()a2rmxr no4texnmi3tldfaDeln o;t0texnif ta1fmtelues t teur(r nydlltelfcil(fsDur(ront4oet  fciadfs2rmumpn(4tlxnxr tatom  li olt s2xoir3nydapeelicslt)srtruro;u1alxn ociyslm2ulu o u0texomocoo1fmtraies (0trxoir3oo4op nlfcsa()artrx pou0oeenmietat m2elumon(4arxnmfctotom   uvs;s) euoio iy1ame  ietls) 2um( oot1optniociydfm2ea(vpnt4 rerif3ta1omDe ieo;t0srxmxmpiu1ope mici t arrm(m ot0oexo oeiadfm2emu o;t4alxrmf3ootlateluvi;s)s2tr(o nu1om   fvslt) Dtmxr ;t1altn ieiadfa2umu snu0texrmo iotop ean i;(0seur(rpnodaleelfeilt  rua(  nt1apxn f3tls aDulumo;t)artnif iy1oatrauei t0 rtrxo3io1ale miviltfsrtr( pot4tltoio3iltls2rln p;t)aexrio3oatfatelies;t0 rurxr oy4lp e ictlt)s2ta( ooo0oltn ietasfm2rm( onu) rermf3iatlat  ueil( trtoirpnodaltnlivi s)aDum(ronu0alenii3iatfm2um( o u0 eeoxf3ia1op r n i t) rtoxo ny1am nlivi s)a2tmx poo0tltn o3tysla rluvpn()trtnxr ty1lmDr nvo;() rtr(rpoydolen ict (fs2urxrooo4tlenioctltfs el( s;t4trtriociotoaD luvo;s) etoir iy4om n fct ()srumurpnu1apx ii3ils a rmumsn(4 rxnir to1faDr i s;() 2to(mpiudllt lfcil(fsDtmxm ;t0aeeniieiydfsDrmuvp ()trxoio iytfpte iei t t2xoir oo1om  lfvtlt) rraur nt1tpxn fciaslm2elnvo;u4arenxf oydlp eli ils)texrir oo1llen ivtlsf 2rr(ront0teenif3ilsfm2ulu pnt0alerxfcty1late nvils trxmxo ny1ameelfcil(  Drru  ou1oet mfcilt m2umump t4 ltnifciadlatr nvs s0srxoxm oy1om e feslt  rrmum nu0oleoifcilsfa raumo (0trtnio3oy1opt  neo t0tetoimpnu1ame  fvt tfarrmuroou0optnio3ilsfsDrlu p;() etnmr3iatlmt  ueo (0 exrxm ny4opt mnvia() Dtaxmp;o4oex ioetydfaDumnvp;(4altnircio1om r uvi;t0trumir3no1aptn fct s)sDrm(r ;t4tlxnmo3ildfsDrlumont0 ltrifctydoaDrli s;()teur(mpnydomt lfvsatfaDuaxrpoo4olt ii3iatlaDelnvpn(4trxrifcta1oa r u il(  2trxo3nu1llen nvs (fs2rmx o;u1aee mfciadlmDrau pnt) rtoiocty1omDeai s;s) etoim nu4optn ietat)aDuax pnt4ape ifcild a rluvs u4aetnxr iytopDeaneolt0srtm(o3nu1lptnmivi t) rtaxmoot1tpxoio3tyslm rm(mp u4 rxoxr3ootomt aivslt)srtrxm3io1llee iesas) Dtmu  ot0oetomieild a2umnvsn(0altoxf iytopt  uei t) exoio3io4ap nmncils a2rru p;o0teeoif3tydla2em(vp;t0arenxf3ty1lpte n ols seurxrpiydom n ieiat aruaur ot1tetn f3tytlm2ua(ms;() rxrmocta1omtrli i;(0srxo(m3iy4omt  net s s2urumpot1apeoio3iadfs2ulnvpnu0texnmrcto1lptraneo t) 2trxm oodaleelnvtl()s2ta(r no1olxomfeiytfm ea(vsnt0aexoir ia1fat anvs t tetr(rpno1llenmnvt () rrm( pnt1oeto feiadfa rlu s (4 rxrmrciotfpDe n o;t  2trirpny4oltnmivt sfsrtaxmo;o1olx mo3tysfs ea(vonu0tleomo tadlp eaueols seumir oudaptnlneia( s2ta(ro;t4tetomfetys a elnmont4aetoio ty1fpD auesl()srxoirpno1lp   ncsa(f 2ta(  ;u1ole  icias s2ulu snt0aetnmr oodfp   nei ()t2ur(m ou4am e fcs ( a2rm( poo4opt mocilt m2emnmp t)trtrxf3to1oa raivolt)texoimpoy4op   fcils arum(m nu0oleomieiytlm2eln s (0aetomr3ootom  aueo (  2tm(r no1ol elieta() 2umu  nu4alx  ieilsfa2rmnmsn() etrmfciadlpteanei;()t2umim oy4apeelnvs s) rrm( p;o1oltoifeiys m2ean p u4trtrirciatlm eaneols0t2xo(o3oo4oltnlivtl()sDurumo;u4aex ii3ildlmDeaump;t0alerxo oytla elivs;t)trtr(m3oo1oltelnei tfsruru  nt4oleo ociadfaDel(mpnu)altnif io1lmtrau i;t)sruoir3oodol   ivtl(  2rrxrp;o0tlxnmf3ilsls ranmon()aetrmf3oa1lpt  neo (0 rxmxmpoodll n nvsas  Dtau pou4oee  fctyt mDulnmpn()trtoxr3iodfmD liesls  2xmim iy4ope lfcilsfsrtrump;t4oltomi3ild s emu s;u0texnxo oatfmteai o ( srur(o3iy4lltn ncsa(  Draxr ot1apt  feils a ea(vp;t4 eeomo3iatoate neol(  etmiopiu1al  licsas  rra(mp;u0oeeo feiytfaDeauvo;u) lxnxo tadopte ivs s0 etr(opiydlp   ict ( s2tr( oou0aex
\ No newline at end of file
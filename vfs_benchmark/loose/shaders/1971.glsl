@@ -0,0 +1 @@
+u o;t)trxr(m ny1lpenmies t  rrr(ront1alxo ociltfs rlu s;u0teeomo todfaDr ies s trtr(mpou1alenlietas sDurx ooo1altomi3ilt a2rluvont0 rxnxfctytoateli i s)s2tmxr iudamt  net t sDraur ;t0aeen fciadlm2rm(mpn()trtnmfcto1oa   n i;t0s2tmxr3iudomt lfvsas srrmurpou4apxo f3ils m2el(msn() leomf3totlp  aivol()trxriopnudamenmivils sruaxmp;o0tltoifeiysfm ulnvs;t)aexoiocty1oat anes;s0 rtm(o3iydlp nmiei ( a2rrum ou1tptoiiciydla eluvp () reomr ootfm  auvi;t0 rur(m nu1lmte fei t) 2raumooo0tlxnifetlsfa2uan s u4trenxrctydfp   neilt)trxrxo3iudaptnlfctls)artauronu1texoio3tytfsDra(ms;u0aexrif3ta1lmDeli slt)trxmirpnu4am emncsltf Duau o;u4olxnmfeildfa emuvo;t0artnmrcta1fpt ln ils0seuoim3iy4lptelfvil() Drm( o;t1tex mietytla2um(vp t0 rxomo iatfpD  ivslt0 exmio oo1lptn nesa( arumu oot4aex  oeilt m rm(ms u0aexnxrctytlp e ivil() 2tm(r3nydolenmies tf 2rrx pnt1ole ioctlsla2uanmpnu4texoio iatlaD livils) rto(o oydal  lfeta( sDtr(r ;o0tlxnmf3tlt s em( p t0texrxr3oa1laDeaieo;t)teum(r iodlpeelnvia( a2rmum ;u4tlt  ictasls rln p;u0altnxf3ty1fm elivs t  rxmxo nu1alenmnci s  2tmum ;u0tle iociytfa2em( o;(4 etnir ootoat au s;t0 2umxm3nydapteliesl()s2rrum ot1tlxnio3tatfs ul(mpn()teerir oatomDrau olt)s2xrxr oy4amtemicslt arraxro;t4tle  octld a2rlnmsn(0alxniocoydfm eauei;s)sexm(m iodop elneslt)sDum(rp;u4apeo oeiatfs el(mp (0 etrxf ty1opD lues;t)s2xoxo io4aptnlncsltfsDtru o;o4ale  o3iad aDel(mp;t4trtoxfctytopDr ivs;()t2umxr oo1omtemfet ( sDtr(ro;u1apxnif3ildls ulnmp t)tetomo3oydop  ln o t0t2um(opiu4alt  ivs tf 2rm( pnt1opt  i3iytfmDrm(mp t) rtrmf todfptrlnvi s  euoio nodlltnmnvt sfaDrmu p;u0oltniociadla2elumo;(4arxnxr ia1op elneils t2xrxo iy1lpenmnvtls s2rrxm nt1teenmi3ilt a2ea(mo;t4tetoio oy1oaDr n i;()teurir io1lme mnvi (f Dtrur oo4oeeoiietlt m rl( p;t4aetomf iydomtr nvi (0seur(o ou1openlieiat  rrmx  nu0opeo fetlsfsDrln o;u4 etoxo oadfmD li s;t  euo(mpou4ap emfeta(  rta(  nu0apto feilt sDrauvs;()trxrmoctytlm eluvilt0trumxm nudlltemieta( s2ur(  oo4tpx ifeilslsDuauvp (4artrmo3iadlm  an ilt0trtm(o ny1altn ivsltf rtau  ;t4tltomociys m emuvsnu0 ltoir3oa1optr ueo;t) etrxrpno1lmeemici ( srtaxronu0tetoif3tltfm2ua(ms;u) rerxfciodfa  an i;t) 2urxo iy1lmenlivi s  rtr(mpot4ole iietysfa rm( p t) eenxr ia1faDeanes ()t2toir iu4apen nesltfaDtmu  nt1optniieildla rmnms;(0 etrxrcoa1lpt anvolt0 rxm(m iodap   fei tfs2urxr ;t0oex mi3ild mDra(vsnu4teenxrcoodfmDrlu i (  rur(rpiydlm n iesat a2tr( pno0texniocilsla2eauvp;u) ltnxr3ia1fa eluvo;t) rxm(r3oy1amt  fviatfsDur(root0tleoio3tldfa elumpnt4 rtnxf3io1omte n o;t  rxoxopou1al n nviltfa2raumpot0olt mo3iad mDelu s u)alermr3ootlpteln s;()srur(rpoy4oleelnvils a2ua(rpot4olxniieiasfs ulnmp;u) rxrxo oo1oa eau ols)trxmiopno4ll e ics sf rum(rpnt4tpto ocildfaDel(vp u) leoxr3tytfmDran o;(0t2tm(o oy1lpenlfeil() 2uru onu4tpeo oetasla uluvon(0 leoxr3oydfpte i o;()seur(m oudam nlnes (faruau pnt0aeen f3ias s rluvo t0teeomocty1lm  aneolt  euoirpio1oleelnesl(f Draurpno0apx  i3ilslm rl( p (0aeerirctytom   uvo;s0s2tmxopoy1op nlict t)arrmxr ;u1oee  fetys a2rlnvo ()texnir tadoaDr u ols0srtriopnydlp  lncil()s2um( o;o4tlxnmfciydls2emuvp;u)trtoir oodfa e nvi;t0 2toxmpoo4olenmnvil()aDrm(ront4olen o3ildlmDrm( o;t)teeoxr3io1lpD lneo t trurxm iudomt mictat a2rrumo;o0tlxo icias m2ra(mpnu0 ltrir to1omtelivs;t0 rtr(mpio1am emnvil()srrm(  ot4alxoio3iat m rl(vo u0trerir3iatom e i o;( sexm(rpiudap   ics tfs2rr(r ou1tle  ictltfm eln p;t4 lenifctatfptrln o;t0trtoxopnudlp  lncta( aDum(r ;u1alenmociyd a2rmn sn(4aetrxf3iy1fm elu o;s)tetriopiy1omee fei ( a2rm( ono1oexnio3iytfs2umu p;(4aexrxrcio1fmDrlies t0srurio3iy1al nlncilt) 2umxrp;o1tlenmiciltfaDumnvo t0teerio3ootoat  nvs;s)s2trxm ou4oltnlicsa()sDra( o;u1tlt ifetyd aDulnmo;(4arenxr3iotlpDrli i t)sexrxopou1omtn fei tfarurx  ;o0apxnif3tlsls rmnms t)tltriociatfa   nvs;(0t2ur(r ny4op  lnciat aruru  ;t1aet mfcildfs uanms u) rermo ta1lmtrlneo (0s2uoxr3nu4lptelnes (f Drm(moot0oeeo iciys a raumpnu4areoifciadoatranes;t sexm(rpio1ap nlietltf 2rru pnt4tet  ictysfs ul(mo;t4alxrmr3todomtrlu slt t2urxopno4al  mfci t)arua(mo;t4tptnifetaslm2rlnvp;u4treomrciodfatraivo;t0s2ur(r iy1ope  nvil() rrm(r ;o1tee moetatfm rmump u0teerif iadla rauvo s)trtrimpou1lm emietas)a2raum no0oexomiciyt m eanvo u) reoxo iotla rau i;s tetmxm3no4lm  lfcilt)srtmu pno0alxoio3tlslmDean p;t) ltrxr3iytoa   neilt trxoxopoy1op nlfetls  2rr(r no1oeeomfetlt aDrl( p t4tlxrxr3oo1lmt ln s;s)texmxrpno1llenmfct ()s2rmur ;u1tlxnmo3tls s elumon()alxoifctadlmD an s;t0t2xoiopnodlpt  nctat)sDururo;u1tlx mo3taslaDeln o u)trxnmocoatoptrauvi s0sexoxo3iu4lpt mneiltfsDua(ro;o1tetomietad a umn o t0alxrxfcoa1fatrlnvolt0 etmir oudop  mfcs s)sDrru ooo0tee  icild a2el( o;t4arerio3oy1fmDe ueo t trumio oodapenmivsl( arrru o;u0ape  feilt mDea(vo (4aexnxo3ootfm r uvi s0trxo(o3nydap e icsatfsrrru ooo4aptoifeiadlm2rau o;t0arxoxrctydopD  ueo;( sexmir ou4am  lfcta()s2umu p;t1tpeomi3iydfaDua(msnu4tltrmocoodfp  au sl(0 rtrxo3oo4al n iet s)aDrmx oou0olxomi3ils mDrln snt) eeoifcio1om eaivilt sruoxopiu1ame lict sf rtax p;o0olx  icils a2ea(vs t0 rermr iotlmte n ils0teuoxo3no4om  mneilt s2umxm oo0tpx mietytlmDeanvo;u4tleomo3iodfpt aieo s  eumxr3iy1al  lnetat)srtax p;o0aeen i3ildlmDua(mo t0 lenio3to1omteaivol() exo(r no4omeemfctl( srtrxmo;o4oex  f3tytlm rm( p u4trtrifctatlmt lnei;(0 2xoir3ny4optn fvt s srtrur ot4tlxo feiysla2emnms t0arxrir3to1fp ran o (  exo(o3iudlle  fetl(fs2um( p;o0tetoii3iatfa2ea( sn(4 ltrmrcoatfpDeau s;t setm(m nodom elicils)s2uaumpoo0texn feiytla emnvp;()trtrmo3ty1laD  i i (0s2tmir3iy4ap elfvi (fsrraxr nt4tee ii3iltfm2em( p u4aexnmo3oydoa   ivi s teuo(r3iu4omtn nctl(f rrmxmpnt4aeto ictasls em(vo;(0tlxoxociy1fptrlu s ()trxmir3oydllenlfcs sfsrururpou0tpe  o3tyt a rmnvpnt)arxnir iotfaD ln i;(0texoxo3ny4llte fvs s s2ra(r ou1tpen i3ilsfs2ul(ms u4tltoir ia1fm  lieo ()trxoxrpoodol emnesl(  Drru  oo4aexnio3iltls ulnms (0treoxf iydlaD auvils0 2urio3ny1lltnmnvtasfaDua(  no0oee ifctldla2um( p (0 ltnifctytoaDe nesls  rto(r iy4olen ivi s) 2um(  nt4apxnioctadfa2emuvo t)artnxf iadlm r neilt0 2umxm oudlp elncsat)srraurpot0alxnmociyslaDrm(vp u4aleoxo iotom  liei;(0 eurim no4op   ivtltfa2raxronu1oeto fetys s2umu p;t0tlxnmoctodoaDr nvo;(  rurimpno4ap  lfvil( arrau ont4opx ioeiytlm2ranvp t0 eerio3ootlate nvolt0tetm(rpou4alenmfciat  rua(mpnu1tpenmf3ias m elums t)texrirciy1op  an o;()teto(m oy1opt lfvtas)srrmumo;o4tpx  ieiad m2emn p;t4altrxr oatomtr uei;t)srtrxr3oodam  liei ()s2rmx pnu0opxnmf3iatfs eauvsnt4texrxocoy1oatr uei s  euo(m nu4ll n ivtl(farrruroot4tlx micilsfs2rl(ms;(4 lxnirciodfateaivolt0texoio3nudol nmivta( aDrrx oot1olxnmi3iyt s ean snt) ltnir3oadlpDeaiei;()seumim3oudomtelnctas)s2tax  no4opx  f3iysls2rmuvo t)aeenxr3totom ranesls0 etrirpoy4al  licta()s2uaxrpnt4optniictyd a rl(vpnt4 rtomr oytlp  ai i ()srxmir ou1aptnlivtasf rtmurp;o1tleo fciasfm2rauvont0 exoioctydfmteluvilt0 2ur(o oydlle mfvsasfaDrm(moot1tpeoioeiytfs emuvon(4aetnxr3oo1optr uvo s)sexoxm3nu4op elfvt s  2ua(rpnt1tpeniictldfs2uanvo;u4altomo io1lat lu sl(0 eurim3ou4lleelietlsfsDumxmont0oee ioetys m ulnvont0 ltnxocty1lmt  u i t0t2xrxr3nodal  lnctltfa2umur ;u0opeo oetasfmDul( p;u4 ltrmf3oodopDelu o;s)srtoim3oo1ope lfctlt)s2tr(mpnt1tle  oeiys m2em(vpn(0tetnmf3tydop eanvi s t2tmxo oy4omenmfvi tfa2trxr no4oeeomfciatfs rmu sn(0arxnmfcta1opDe i il()s2uoim no1lm emnvtl(farrmxmonu0altnmo3iytla ra( o t4 rerifciadlpD li sls s2xo(opnu1ll nmietas  rtm(rp;o0oet mictydla2uauvp;t0 etrxrctodomD luvo t s2tmxr3nudal  mfvs s)a2urum nu1alx mi3ils m ean o ()texoxr3iadom raieo;t0t2xrio3oy1olenmfvsls)sDrru pno4oltn fcils mDean s u4 lxrio ta1lptelnvs ( trxm(o iy1ll elnesltfa2tmxrooo0alxoii3iyslaDumn p u4aeenir tatlp  ln o;( sexoir3iodamtn fctl()artmu o;u4oetomoeiat sDelnvont0tetriocootfmDelnvs s0srxo(o ny4alte nesasf Dtrum oo0opx mietlt mDemn s u4 rtrircoy1lmteanvs;(0s2um(r3no1amtn fcilt)s2rrx  no4aeeo octas s2umnvp;u4trxnmr tytomte i il(0 2xoimpoydalt  fvslt sDtmur ;u4apeoiiciadfmDua(vp u4 reriocootomteau s;() eto(m3oo1olt mncslsfa2rax pnt1aee mieiysfm ua(vpn()tleomf3oa1fatraivi s  2trimpiy1oltn feil(fsDtm( pou4aetn f3iytlaDemnvo;()texoio to1omte u o;t)texm(mpny1ll e ietasf rrru pnu1altnmo3iadfa umu pnu0trtnxoctydlmD lu ol()setoxm3oy1al   icsa() 2ururo;u1aex ioetyt a2rm( p;u)tlxomo3tydlatelu il()srxrxopno4llte fei t  rtr(  oo4oetn feiyt s2el(vo t4 lermo todom elnes s0 2xr(rpno4ale lnvslt  Dtrx pnu0apxoif3tasfa2emnmo ()tltnmo oy1omDrluvi;t t2xr(opoudal nlfcia(faDtrxr ;u1alenmoetlsfa2uluvs;t)tlxnir oytfaD aivol( s2to(m3ny4llenlnctat arrm(m ot4optn f3ils sDeanmont4artnmocoytlmte nvs;s)s2um(mpny4oltnlnet ()a2rrurooo1aee if3iasls el(mpnu4tltrio3tytfatrlnvilt  2uo(opoodaptn ncsatfsDumxroot0apenmfeiyt m2emuvsn() rtoiocio1fmtrlu slt s2umirpnodaptemiei (  2rrur nu1olxn ociys aDrau p u) ltrxo oatoptelivo;(  ruoxmpnydolt mfvsat a2rrxrp;o1altoio3tytla rmumonu4areriocio1fmtraueo;s0teumir3ny4ap nmncs ()sDurx p;o1alx  fciatlm eaumo (0 rtnmr iy1fp rau ol(0t2xmxr oo1ap e neslt s2rax o;u0tlxomo3iyt mDem(vpnu4teenxf3tatlm rai il(0srxm(o3oydap nlnvsas artr(mpnu4tpen fctatfs2uan s t0aetnxfcoydfmD  ieo;s seumim ou4lmenlivi ( arumx  nt4aee mf3ilslaDum( s;u)aetnmo3oadlaDeaieils0 eurio oy4om  licil() 2tru ont1aet mf3ildfs uan p;t0tlenmrciytlm elnes t) rtr(rpoy1opt mnesls arurur ot4oeeomieilslm2em( s t0aexnio oo1fatr ies (0srxoxmpou4al elictas)aDrmu ono4tetoiociad m ranvsnu) rtnmo tadfa eaueol()t2to(r3iy4lmtemivi () Dta( ono4apt mo3ilsfs ea( pnt0trxnmr oadlpt  nvi t0trurxr oodap  micsas) rrrxmpnu0tpt ii3iyslsDrau s () exoxocio1opD  nvs s0tetrxmpno1llen nvs (fsDta( ont0tle mieiat m2elnvp;t) rtrxfcta1opt  u s;s)s2tm(o iu4omtn iesa()sDua(  ou1oeen f3ilt a emu s;u)tlerxr3ia1oa elivo;s trur(o oy4lp e fctls a2rru o;t4oee  i3iatfa2rlu o (0teermo3oo1lmDrli s s  2tmio3oy4lp nlivs s) 2tauronu4tex  o3iasfa2ul(mpnt4tetnio iodfmDean sls0t2xmimpiydameelivsl( aDrm(rpot1opeo ietyt a eanvsn(0teenmrcoo1fpt lnei;t  rtrim3no4lmt  nct sfsDtrur ;t4texomoetldla em( on()trxrirctytlptr ivil()srurir3ny4ap elicsltfarua(mo;t0altn oeiltfa2ulumsnu)trtnxrctodlmDeanvs s) euoxm3nu1lpt lfciltf ruaxrpoo1olenmfctytfaDemnvo;(0 etnxf3iotfpD ai s t0 rurir3iy1lp nmnvils)artmum ot4olenmfetldfm ul(mo;u4arxnifcia1faDrluvi ( sexmir3nydopt lfes sfs2rmxm ;o1aee iictatfa el( o (0tlxnxocoo1opteluvs t0setoxmpnu1amtelivia( srrru  nt1apxnio3iytlmDem(von()aexoxo iodfp rauei;s0trto(r ou1ape  neslt)artaum nu4apto f3iyslm2eluvs;u4aeenio3oo1fa ran s;( srto(o oo1op  mfvi (  2taumpnu0openmieild aDrln o;t0arxnxocoadlatr uvs;( seuo(m iu1ome lfet t srumxmp;o1aee iocilsfm umu o;()alenxrctodoptrlues ( s2toio oy1ll nlfvi ()srrrxro;o4tpxomi3iytfa umumsnt)trerio totlaDr iei;t)seto(m3no1op nmivsl( aDraxmpnt0aeto fciatlm eaumo (4arxoio3to1fpD  nvilt0 2urio3iudolenmnvias a2rmxrp;u0oex ii3iytfaDrmn p t4artoir3oodfmDraivo;s)seuo(o no4op   ivtat arrrxmp;t0tee  ocias aDeau pn(0artrio ta1lpte nvi;s sexrxmpoy4apt lncsl()a2tmxm ;o4oetnif3iys s eau s (4tlenir3tydlpD lies;s trxrim iy4optnlnetat aruaxro;u0tlxn i3iad mDeanmsnu0aeenxf iotlat anvi t) rxoir3iu4olee iciat a2taurpnu1aex  o3iasfaDrlu s (0 ltnxo3tytfaD lnes t trtrir3ou1lpee fvtlsf 2umu poo0tltoifetld m el( s (4artnmf3iytfa  luvs;(0 2uoxr3no1olte fvt (faDrm(  ;u1alenmfciydfm eau s (0tetrmr iadfm raivil()s2urxmpio1aleemfvt s)srrmum oo1tle  oeiyd aDrlu p;u) etrmrcto1la eaueo;t0 2uoim3no4aptnmiesat)sDrm( o;t0tetoif3iysfm eanvp t0 lenio iytla eanes t  2xrxmpnudalenmncs t  2tru p;u1opt  oeiat a eln s u0trenmfctatomtrln s t0s2trxm3oy1lpee fetls aDtmuronu1tetniociad m emnms;()texnir ia1lptr ueslt texoim ou4am emnvias  rtaxr ;t4tlenifeild a umumo;(4texomo3oadoaD ai s ( sexrim3no1lpt lfct (fa2ur(r nu0tex mi3iatlaDranvsn(4artnif3ia1opD luei () rumxm3oy1am elietl()srrrx oot0tlto fetltfs ul( p t)teeoxf tytomtr u olt0tetoxr iu1lmt mnei ()a2rr(m ou1aeeniiciydls rl(mo u4tltrxr iatom rlieils0srumim3nu1lmen neta()s2uaxr ou1olxnif3tydls2rauvpn(0 lxrio oa1op elu i;s0s2um(r3nu1lpt  fcta(  2raurp;o1teenmo3tad a rlnms t4artomocio1fm rluvil( trumxmpio4op nlfvt (fsrurxrpnt1tlt iieiatfm rln s;t4arerxrcia1lm eauei;t) rtmxm3oo1aptnmnctls  rrr(mpoo4tet  ieiyd a rl(vo t0teerxo ia1faDeaneolt sruoimpiudamen ivsat)s2rmu  no4opt iicils m2elu o;()aexrmf ty1lptrlueols0s2uoir3nu4lm   feils a2rau  ;t0tpenioeiysls umuvpnt0aetnxrcoadfmt lues s t2toio no1omee ncsat)srtrurpou4opxnmieiatls eauvo (0 lxomfcootlp eluvs s0srxrim oy1omeemnesls) 2rau  nu0opxoifeiadfmDulumonu4 rxnmr3oy1op r nvs s)tetr(m3ou1lleelicils) Drau ont1tet ii3iadlmDrau s t)trxoxr tydfaD anei s trtoxm3nodole  nviasf 2rrx pot0alen i3ils m2el(msnu0 lerif iytom r i sl( srxmxo3nydame lies s aDrau o;u0aeeo oetydfmDuluvp;t)trtnmo iydoaD ai o t setr(r3iu1opte fcilt)a2trxm nu0altnmfetld m2ea(vsn(4aeenmr3tytfm   i slt0texrim oudoptemneiat)aDurx ono0aet  o3iytla rmnvp (4 reoxfcoadlp rlneilt sruoio3iudame lnet ( a2umx o;o0aex mf3ils s2ua(vs u4altrmfciy1fmt  nvs;t  2um(o oudaltn nciltfsrua(mono0tex  feilsfa um(mpn(0tlxnxoctydfp rlneilt0srxmxm iy4opeemfet s)aDta(ro;u1oeenmo3tyt aDeauvpnu)tltoir3ty1opDrai il()trurir3ny4ll nliesas s2raxmpot0aptoif3iatfm uanmonu0aleoifctydom eau i (0trxr(r3nudop nmnetltfarumxront0olxoifctysfsDra(vs t)tltrmrciodlpt anvsls0sexrxr3nydolenlietatfaDra(r ;o0oexomfeildfa eanvp;t4 ltrxf3tatom  lu o s0t2umirpiodopee netatf Duaxm ou0altoii3tas a elu ont)alxoxf3tytom rln olt s2um(o3oudape lfeils s2uau oou4opeomoctaslsDuauvsnu0artrmf totfaDrai o;s  exmim ou1lm n nvils)s2umump;t1tlxo fcilt mDrl(ms u0tltrmrctatfmtean o s teumio3oudlpeemivtlsf rtau poo4aexnio3iad m eanmpn(0 rtnxocoadomDe ieils0teur(mpno4olenlfviasfsrrmu o;o4tlt ioetldfaDemu pnt)tlxomocoadlpDeaivil( teuoimpio1apenmfcs ( s2taxmonu1opxnioetadfs2umnvsn() eerir3iytop rluvs s s2toxmpnu4olenmncsas)arta(ro;t4tpxo ictys mDuluvs;t0treomocty1fmt an o;s0t2trxo3no4ap  mfci t sDur(ront4aeenii3iad sDranvs u) etnir3iytoa e u s t0s2urim iydoptelici () 2rruro;t4ape  iciat m2rlnvs;t0 lxrif3ootfmtranvsls)trto(mpiy1lle  nvilt  Dra(  ot0olt mfciytfmDea(vpnt4aleoxr tydfaD aies;s t2xo(opio4amt mfvta(f Dtmump;t4oex micild m el(vp;t)texnifctotfmtrln o s0tetrirpny1oltnmncil(f Durum ;o0tltnifeiat sDua(msnu0tlxnmociodop  lu i;s)t2uo(o nu1optelivta(farrau  ;t1tltn o3tytfs2uanvs u) exrmrciadfat lneo;() euoir3no4op emfctl( sDumxro;u1oex ioeiltlm rau ont0aetrxo3iydoateluvo ( seto(o nydale  fvs sfarrmxro;o1aeto fetadla rl( onu0alxnxocta1la  lnvi t0s2xmim iydomtnlietasfs2umxmo;t1tlxoifcilslm2emuvp t0tlerxo to1optr ivslt t2urim3iy1op nmivils) 2ur(m oo4alto ictls mDranvs;t4 eeoiocty1faD  nvo t)setmio3oydoltnmfcsa()arraxmpnt0apx ioeiaslmDrmnvont0tleoxrcoatfpDeluvols  2trxmpnu4amt  ici ( aDumurpot0alx  oeiysfs2rlnvs u4aetrxr3todlm   i olt trtr(rpou4ap eliesltf rur( onu0optniiciyt m uanmp;u4aeenxfcootfpDelivs t0t2urimpiydlme  ncs t)aDtrumont4aex  ociltlaDuluvs u) lerxo iotfatelnvolt0 etmir3oo4omtemnesltfsrtm(mp;u4aet mi3tld a2rl( s;u) ltoioctydomD aivilt0t2toxopiydopte fcsa( aruaxm ;o4tetomiciyt sDrauvs;(0tlenio3ta1la   n ol()setmxo3no1lmt mfcsas)a2raxrp;u4apen iciytls2umnvp;t0 renmf ootfaDrlu o (  rur(m3io1ll e fcsl()a2uauroot4tptn ictltfm ra( snu0teerif tadlaDeaueols0s2xo(o3ny4lmtemict () 2ra(  oo1teenmociytlsDelnvo;t)trxnxrciadoa  anes;s seurxo3io4lp n ictasf rrru  ;t1ole moctys s2rl(mp (4artomf3oodfaDrauvo;t)srtmimpio4apt mfvt t) Dtaum ;t0aetn fctlt s2eau pn(0trtrxrcia1faDelu sls)setmxrpiydamtemfesas  rtax  ;u4teeoiieiadlsDemn pnu)tlerxo oadlmD an s (0s2xr(rpoodop elivsas)srur(r ;t0opxn fctyd m2el( s;u4texrif io1opteln s ( trumio nodlme lfcil()a2um( o;o4apx mf3iasls2ulnvo u) exnxocoydoa   ieols0 rtrirpoo1aleemfeias) Dta( ono4oleomocild s2ra(ms;(4altomf oadom e ies t  eto(m3iy4ol  mfvtl() rur(roou1aleo ictydlmDrlnvsn(4 etnmf oadomD luvs ()trtrxopoudole  icilt srur(ro;u4oltnmfetydfs2ulnvs ()artnxf totlaDeanvi s sexr(r oudomeelict ( a2tau pou1tpx  fcilslm2ean snu4trxoio3oodfa  ai o t0trxmir nu4apeelivt (  2rrxr oo1texoif3iatfsDrmnvp u0 ltnmo ta1fat aies;(  eum(o3nu1ome  nvtas)aDraur ;o4olxomfeiytfa2rln s;u0arxrmocio1fmD aueolt0sexrxm3iy1lltn fcilsfsDua(m ;t0apt mfetlt a2eluvo;u0 rtoxr iatlpDe iei;s  exr(opnydop nlfcslt)a2rruro;u0tleniociyd a rauvonu0trxnxf io1fmD  ivslt)srxrio nu1opee netas) 2rm(mo;t0ale mfetat sDuanvon(0 rxoxf3to1latelies () 2trxm iodap elictat srraump;t1tpe iociydlmDuan p;u0trermociodlmD luvi;s0trxriopoo1lme  iciat)aDtaxr ot0tee mi3tat s em(vp u0artrif3oydfaDeau i;() eurir iu1lmtnmict t  Drmuront4tle ifciytlaDulnvo u4aetomoctydlatraivi t0teto(mpiu1amen ieiatfsrua(monu4oexniieiyslsDem(mp u4aetnif iadlpte neo (0sexmxopou4ap nlfes tfarurumpnt1apto octls m ra(vpn(4tltnmo oo1op eanes ( t2uoxo3io1optnmfvtat  rumxmoot4tpto ictytla2el(ms u)areoxr3iadlpt ln sl(0 rum(o nydlltnmnesatfarta(mo;t0ole  o3iytla2ua(vs;(0 rtnmoctytfaD luei;t texmim oydolt  feslt) rtau  ;u1tptoifctytlm uan p ()tetoxf ta1lm rlnei t0s2uoxopoudolen nct t  2uax pnt0oet ioctldla umnms ()tltrmr3tadlmD anei;t  2to(opiu4opt  ict tfaDtrx  ;o0tltomoctaslsDrm(mp;t) rtrxociydop r uvilt)tetmxo3oo4ol n ivt () 2tmxm ;o4apt mf3iyd mDulnmp;(4tlxomf3tytoptrauvils  exoimpoy4omt  ivs s  rurxm ;o1tltnmicias a2rlu p;u0tetoir3iydoptrauvi s teur(m3io4ome lici t arua(  ;t4alxoioetlt m2el(mp;t4altrxf3iydfm r i o s)s2xoxm ny4lm e neslt)aDurur nt0texnmoctyd sDul(vs (4texnio3io1oa rlnvi t)srxmxr3io1am e fei sfaDtmxmp;o4apx mictltlmDeau o t0tlxnxociadlmDrln i ()s2um(o no1apt lfcs (fa2rmu  nu0oexnmfciatfm2uanvo t0 rxnmfciy1omDr n s s)t2triopno4opt mict (  Drm( onu1tee iictls aDrlumpnt0 lxnxrcoytfm  liei;s  rumxm iy4lle livtat) Dumxm nt0oet mo3ilt m2ul( p t4altnxf3ia1optrai ols0seumimpnydamee fvilt)a2rrxr ;o1aeeoif3tadlm2rl(ms;u)artrio ty1fatrau o s srtmxo3oo1ap nlicilt) rtaxrp;t4aet io3iltlm eln p;t)tetoif3iydfp rli il(0trtr(o oo4lm n ieilt a2tm(mo;u1olx mfciad sDrln pn(0aexoxf3oo1lmte uvs;(0 rtmirpoydolt micslt) 2uax oou4olxomf3tasfaDuluvp u4tetnir oodfmte i o (  etoiopiu4omeelnci s s2rax o;u0opeo ociyd s el( o t)areoxr oy1fpD ai o ( s2xoxo3oodlmt mivia()a2trur ou4texnmf3ils a2uanvp u0trtoif3oytfpteluvsls s2tr(m oy1llt mies (fsDum(r oo1oet  ieildfs2eau p;u0 lerxf oy1lpD anei t trtoir3oo1omee nvta(  Dta(m ;u0opeo iciltfmDumnmont0aeerxr3oy1lp  lnvo t setr(m no4lpe  ict (f 2raxrono4tpxn ieiys m raumo u0arxoif3todfaDr i s;(  2tmir no1om elnvsl(f Dtaxm ;t0altnmociytls umu p;t4alenmr io1fmt lnvo;t) rtmiopnu1lp nlicsa(f Dtaxroou0oltniocilt m2ra(ms;u)artoirciy1opD auvi ( srxmirpiy1op nlfcil( a2uaxrono1olenmfeiatfm ul( p t0 rtoif3oadlmt ln i s) 2ur(r3no1amt mfcil(  rrau ooo4apeniiciys aDrln o t0tltrir iatom   i slt)trurxmpnu1ame lfvsat s2uaxmo;u4oex mf3tad s2ean pn(4aleoirciotoat anvs t)s2uoxopiy4optemncs tfs2trurpnu0apt ifctlt m el(msnt0texoircta1fa e uei () rtrir3ny4ap  mivtlsfs2tr( o;t1olt mi3tasls2uln ont0artomo ta1fmtrliei;t  2uoio oo4ap n ivias  2tmumonu1oetnio3iltlm ea(vs t0tltoxo3ia1fpte ivs;(0 rxoio3ou4op n nctas)arraxr ot1apxomf3tas a eanmp;u) etnmo iatopDeaies (  rxoxm ny1ll nlncs (farraxr nt4apeomieiytfs2rmnvs;t)aetoif3ty1latrli s;( teto(rpio4lptn fci sf 2ra(  ;o4aex  ociatfs2emu p;u)altnmf3totfmDeai i;t sruo(mpno4aptemnciasfsruaxrp;o4tltoiicias m2eluvpn() ltnif oy1faDr ueolt trxr(m iu4aleemfviat)srra(  nt1tee io3iatlmDuaumo t)alxnmrcty1lat  neo;s trxrio iy4ol e ivia()aDuaxmono4olt  ocilslm ul(vs;t0tleoir3oytla  lnvs t) 2xmxrpno4ll nmfei sfa2rm(mo;o4aet io3tys s umumo t0alermr3to1op raivols seto(r ny4optn nei ()arur(  ;u4alen fctatfsDrau p (0 etnif3iatlpteli slt0sexmiopou1llen ivs sfsrua(rono0alxomietyd sDrlnmp;u)tltoiociy1lp eai i s)t2tmxm ny1opt  fvs (  rraumont4tpxo o3tytfs2ran s;t)tlxrif ia1oa r u o;s) rxrxm iy4lmeelies s aDtaxr ;t4tlt  oeils a ea( o;t4trxriociodlatraivsl() etr(r ou4ape  ncta(  Drax ono0alxn o3tad s2rmumpnt0tlermo oo1oaDr n i ()truoirpnudomt mfctltfarum(r ot0alxoifeiytfa2em( snt0 lxrxr oa1lpDrai s;s) rurxrpoo1apte ivi (  2taxmo;o4aeto i3tysfm emnmsn() rxrxocia1fp rai ilt0 rxoxo3iy1om nmfvtatfa2tru ont1altoii3tyt m rmnvsnu)artrxr3ty1fmDrlues;s0srtrio iy4altn fei (  2ur( p;o4apx mfciydlaDum( o ()aetrioctadlmtelivo t0t2xmiopiu4apeelivtls) 2tmxm ot4teen o3tasla ulump;u4tlxoif iydlpt lues s)s2toim oy1lpenmnctas srta(m nu0oexniieild s rl(vo;t0 etrir3iytlmtelneilt0trtoim3no1ll e ivsat s2taxro;t1olen oeiadfs ran p u) lxnxf3iy1lmDrli sl(  2urxr oudopt lncsasf 2uau pno0altnmf3tldla el(mp ()alerxr3oy1omteau il()tetmxo3iu1aleelfet (  Durx  ;t4aex  oetldla2umnvp;u4tlenifcoydop raneo;(0setr(m3iu4alt livsls)a2tmx  ot1oee micilt aDean o u4 rxomoctotoatr i i;t0 2trxr iodam e icsatfa2rr(r ;o0tee mfeildlsDrlu o u)altnir totfmt  n i;(0texmiopiu1lm elivtasfs2umxmpot0aetoioeiasls eau on(0texoir3oadlpt livi;t0 2xmxrpnu1lptn iet tfsDtrx o;o0tpen i3iyt a ra( o t0aeerio3totlp  lu slt) 2toirpoydolte icslt) 2rmxmooo4aexomoetas s ra(vs;u0texrmr3io1lpD au o s)s2ur(m ou4lltemiesl( a2um(mp;u0tlxnmfeiys m2ea(vonu4 eenxrcio1lm eaueil(  2xm(m iu4ape lfcta()s2trumoou4aleniociat m el(msnu)aeenmr3iytfpD  nvol( teurxo oo4al  livtls)aDta( pou1oee iieiltfm umums;t)arenmr oatlmD lu s;t  rtr(rpio4optn icslsfs2umur nt0tpxn f3ias s2ranvpnu4 eermf todfmDe ues;t0trumio3iudlp n ieil(f 2rmx pno4oleoifetyslm2ulnmo;t)altoxf3tatfp r ueo;t) 2umxm3oo1lmtnmfvta() rtruro;u0aeenmo3tyslm2emuvpn(4tetnxfcoo1la r nvs (0 2tm(m3nydlm eliesatfsDrrxmoou0oee if3tls m em( pnu4trxrifciadoa rai i s) 2tm(rpiu4am  mfet sfsDurxr no4teeomf3iyslaDrln p;u0 lxomocootlm  aneol(0 rtmimpoy4lp emicia() Dumur ou4alx mieilsls eau sn()aleomo ta1la  aneolt) etr(m oodaptnmies sfsrtau  no0oexoif3ilsla uluvp t)trtoio tytoa  luvi () rtmir3ny1lltelnct s s2uaumpnu1tptnif3tadfmDulnms;u0texnxo oydfmtrluvo;t0teumirpnu4ape  fesasfsDtm(m ot0tpxnii3iad m um( s t)trerxfcootfa e ues;(0 rumxm iy1ap nlfeias)arururpnt0ole iiciysfs rmumpnt4trxrxr oytfp rlnvs;s0s2xoxr3iy1am e ivtls s2ra( o;u4oltnioeildfm elnvsnu0altnmocoydla  lies;( seur(mpiydlm n fei t)artm( pot4tptn ieiysfmDrauvo;(4 lxoxo3iy1om r u ilt) 2xmir iodaleelfesas  2rmur oo1oet miciydlm2ranvsn(4artoiocoadoaD aneolt  exr(o3nu4olte fcilsfsDum(rpoo4open iciys s umnvs;u0 rtrmo3todopDrln i;()teuoir3nydalen ncias sDrrxrpoo1tltn i3tltlsDrl(vonu)aeenmf totlmD  ivs t)srtmxmpnu4lpenlnvsls)a2rrxmoot1opt  feiasla2eluvs;(4areomrcoy1opte ues;t srumxo nudomt lnctltfarrr(m no4oex io3iatfmDrlump ()treoxf3ty1fmD an o;s0 rtoxm ny1amtelnvt t artm( ooo0apxoifetyt s2rluvo t)tetnif3iodop  aiei t sexrxopiu4lp elfetlt arurxm ou0tetnmfcildlsDelnmp ()tlxomrciotlpDr i s;( s2xoxmpno4ll emncilt sDurxmont1apxo f3iydfmDrlnms;u4altnif3ia1fpDraieo;t)s2urim no4lpeemnci t)s2rax o;t4apxoif3iatfmDran s;u)artomo ia1opD  nes ( trumxr3oy1al n neia(faDraxroot0opx mf3ildls uaumon()aeerxocio1om rluvo ( t2tmir3iudal n fei t  Duaurono4tpe ii3iatfa uanmo t)arxoir3ia1lpt aueolt0 2to(m oodam  lfesas a2trxrpou1apeomfetytfa2rmnms;()texrxrctytoaD  ivol()texm(opny4amtemivs t) Dtrurpot4olt iociat sDrl(vsn(4 lxnxfcoadopDr ueils teum(o nudaptnmfesl(  2urxr no0aptoiociad sDumnvp ()tltoxfciy1oat auvi t)trtmiopou1lp   fcilt)aDtr(r no1aexniiciydfs2um(vsn(4aeenmociadoaDeanvslt)s2ur(mpou4om nliei t  Dtmxm ;t4tltnmo3tysfa2ul( s u4 exomrciydlmDe uvi;t0 2xrimpou4opt  fesls sDuaumoou4opxnifctat s uan p;(4arxnifcoytomDrli ol( sexoim ou1lp n ivs (fartr(m ;t0tlt mf3ildfs ra( s () rxomo todlateau i ( teur(m3iydaltnlnvtltfaDumxmpnu4olxoifciat sDea(ms u4areomoctydfatrluei;t s2tm(rpny1amt  nvilsf Dta( pou1tet ioetyt s2rmnvonu)aeerif oadlpte neo;s)trurxo3oy1amt mivt ()sDrmxrono1tpxn i3ilsls2uln ont)aetomr3iydoateai i s)sexo(rpiydlpeemnes s srta(mpou4tlxniietyd m2rlnvp t0trtnxr3oo1lmtelneol(0 eto(r oo4ope  nei sf Dtrx  no1apenmociadfm rm(vs () lermr ootlp elnvs;t)sexrimpoy1alte ivt s a2uaur ou4tpt moetyslmDrlumonu4aeerxf oadlp   u s () rumxr3nodlltnlfviatfa2rr(m nu0oeeoifctyd s em(monu)tlenio oodlptraies t) 2uoio oy4lpt lies t)arumumoou4oex  oetlsfa2rmnvsn(0trtoxf tadfmtrlu ilt0teuoxr3iy4olenmnvtl() rtaump;t1oltnmo3tyslm2um(mpnt0 eenmf3iodopDelueolt0 etoio3oo1am  mnvsas sruaurono1apeoiieildfm2eln s u)alxoif3iytopDrli s t)srxmimpnudomtnmnvt sf Dtrur ;u1tltn fcild m2umu pnt)aetrmo3oydoa r n o;s) eto(m3iy1ol elnvsas)sDum(m no4altn ieiltlaDuln sn()trenirctadop  liei;s srumxr no4lptelnciat)a2tmxr ;o1tltnifciat s2rmumon(0aexnmo3oytom eln olt  ruoio iodlmt mfei ( a2umx  ;u0olt mo3iysla ulumpnt)teermf3iotla  ai i t0 rurir ou1lltelivil(fsDrm(moou0aeen ieildfs um( pn() lxoxo3to1fp rlieo t)t2uo(o nu1ap  lfcilt) Drmx pnt0tpenmieiatlsDua(mo t)trxoxr3iy1lm   uvils0srumiopoydalte netl()srtau poo4openii3tlsfs ua(vpn(0 exrxo3iadopteauvs;( t2xoir3iydamte nei s s2trx onu0tpt moetytlmDean pnu0artrxo3ty1op elnvo s) rtmir3iy1ol e fcilt  rta(ro;t0teto ictat a2umn pnu0aexnxo3iy1fmtrli olt)srxoim3oo4op nlnvilsfsrururpnu1oexo oetyd a elump;u4 lenxr tatfa raivs ( s2umxm nu4lm emivi t)a2ra(mpot4apx  ociydfm emu onu4artrif3tatfp ranes;s) exrxr ou1ol elnvt tfaDuax  nt4teenmieilsfa2eln p u)tleoio iadlaD au ils s2uoio iy1ale mnesas s2um( ooo1apt mfeiasfa ran ont)tltrxo3to1lp rluvsls) 2xm(m3oydamen fvtlt)a2uaxm no1tltn ieiytfs ra( p (0 lxnxoctytom  lueo;t teurxm3nudomtnlncsls)arumu poo0opt mfetadfm ra(vs ()altomfciy1lmt luvo t0texrxr3iu1lmenmicslt arrm(ront4ole ioetadls2ea(vs;()aeeomr3iy1lp eau s s0srurxo iu4amtn netas) Dra(m ;u0ale mieiysfm2ra(mo;(4trtoifctodfptrlivils0trurxr iy1lpe  ncia(  2rmu  nt0aleoii3ils s ra( p;t0trxoio3oadlpDrai sls)setmir3ny4am elictas)aDrrxmo;o4tltn feiatlm eluvs;(0texomocty1fptr u s s0 exmxmpiy1amen fct (fa2rm(r ;u1opx ifciys sDeanvon(4 ltrxf3ta1fptraneslt)srto(mpou4al emnesat)s2tmxmont1altn oeildfs umnms u0areriocoytfp eaies;()s2toxopny4oltnmici (fa2uaur ;t0aex ii3iydlaDuanvo;()tetniociytopt lueo ( setr(r3oydam e ivs s) Drauro;o0aee  f3tyd sDumnvpnt)aetnir3ia1omDelivi;t  2ur(o3oy1al  mictls)a2rmu pnt4alxn fcils aDulnmonu) rtnmrctotfa ranvsls0t2urim oo1omen ieils)s2um(  ou0aexomi3tasfaDean p;(4tltomr iodlp   nes t s2uo(r no4oltemneiltfs2uax o;u0tet  ocildfsDulnvo;t0alxnmf3oadlmt  i ils0trur(m3iydapeemnet ( sDrr( ont0opt mfetyd sDeaumsn(0 eeoxf3oa1fmt livi;s0s2umxm3iu1ame lfet (  rtauro;t4tee mietadfa2rlnvs;(4arerioctytlp   ieilt  etr(rpiy1aptemici s a2trx  ;o0oleo ietasls rlumo ()artrmf3oatlmDr u s;()srxr(rpiudome mfcta()sDumxmpou0oexomiciatlmDra(mpnu4aleoiocoatlmDe u sls0tetoim iodlmte fcsls)sDtaxrono0tpxomfeild mDrm( o () lxnxr3iotop rluvs (0s2urio3ou4olt lfvsl(fa2umx oot4oexomfetls m2ea(vs;t4 rtomocoatfaD  n ils0t2umxmpiu1om n ici sf rtmu pou0alxnifciydfaDumuvp;(4tlxoiocia1om  anvolt0 2ur(rpoy4lpee ncia()artau  ;o4tlxomfciat mDrmnvo () eeomociadfpDraneo s trtr(o3iu1ape  ieia(  rraxronu0aex  f3tad a2rmnms (4 exrmr iodfptraies t0trxm(r3no1omee nvia(fa2rau  nt0aexnmo3iltfa2rln o t4artoio tydoptelues;()texr(o3ou4lpee fetasfartaxmont1olx mf3ild mDeanvsnt0 renifctytfm   ivs () rxr(r oudome lncia()srur(m no4ope mictadlm2ea( s;t4arerxr tadlmDe u o ()t2urxm3oodope  ivi t)arrrx o;t1ape moctyt s rlnvpn() lxrmo iytfmDeaieils0trtoio iy4amt mfvsat)srum(moou1aex iietydfa2ra(mp;(4trerio oytlaDe n s t0truoxm3nudom  lnvilsfsrumum no1tltnmoetadfa um(vp t)alxrmfctydlp e nvilt trtmir3iodll  mfvilt artm(roou0opt iocildlsDrlu sn(0texnxrcoatfa e uvo;(0t2xmxm oydom n fei tfaDrrumpnu0tpenmicias a2rl(ms;t0arerif3iotoa  luvi;s)truo(r oudlm eliet ()a2rr( pno1oetn i3iytfa em(mp;t)artoif3ta1lpDe uvols)s2urxr3nu1llt  ieslt  2taxrp;t1aeeo i3ilsla rmn pn()artnxr3iy1fm e uvi;s0trum(mpiodameemfeil() Dtmxmo;o4apt iieiydfm umnvpn()aexoxf tadfa  luei;t0srurim3iu1lmee net t a2ta(m no0tetn o3iydls2umnvs (4tetoio3iatoa  an i (0teur(m ny1olenlies s aDraxmoot4alxniiciys aDrm(mon(0alxrmrcoydoptelnvo;(0s2xo(mpiudlp  mncsls arum(monu1oeen f3tlsla ulnmp;(4aexnxfcoatoat luei t0 2urxm ou4lme  ivtls)aDurum nt0apxo octadfmDum( sn(4alxrifcty1fp eai sls0 exmxmpou1lltelfesl(  Durxm ou4apxo fciyslm ua(mp ()aeenio totlp  lnvs ()truoimpou1ole  ivs s  rtrxmpnu4alenmfctldfs ulnvs t0 exomo iodfatranvo;t)srumim3io1amt mfeias) 2uaum ;o0opeomietydfm uaumsnu4texrxo3oa1oaDeln sl(  2xmio3ou1omt lnesatf Drm(m ;t0tleo oeild sDra(mo;t4aetomf3oa1faDe ivo;( s2uoimpnu1llt lfctat srrrxronu0opx  feiaslm uanvp;u0 ltnifcoy1fmDraies;t)srur(o3oo1amenmici t)srumx  nt0tee  feiadlm umu p u)aeeomrcty1fpDrlneslt setrirpnudapenlnvia()srtr(m ou1ope  octldlaDel(vo;(0altrir3iodfat lu o ( sexrxrpoo4al emieia(f Duaumoot0alt mietatlm ranms;t)trxnxr tatfmt auvo;t)setmxrpiy1omenmivt (fartrxrpnu0alt iicildfm ra(mp;t) rxoxf iytlaDeai o;s) exmio io4apte fvta(f Dtrum no0oeto ieilt s rm(vp;t0 etoirciotla eanvs;t)s2xm(mpiydomenlfeils) Drm(mpoo4apxn feilt a ean s;t4 exoir3tadla  livi;s)sexr(mpiy4lmt lfvsls) rrru pnu4tle micilsfm2umu s;()arerif3ia1faDran i s0srur(r3oo1lme mfes (faDrm( p;o0tlt  i3ilsfa umu o u4arerxo3oa1fmD  n s t) 2uoir3nodlpeemnvslt)srurur ot1aee iicild sDelu p t4 lxnxo3oo1faDelu il( trtrxm ou1amenlfct t) Dur( onu4aexomfciyd mDra( snu0 rxrxfciatfptrlueo ( s2xrxrpnodaltn nvtls) rur(mooo1opxnmi3tys sDem(mpnu0teenir todlp rln ilt0 ruo(o3oudamenliet t  2umuroou1texoioeilt s2eaump;t)alxoio iotomDr uvslt)trtoxm iy4opt  ivtatfsDuaur ;t1olt mf3tydfsDuln o;(4tetnmr3tydlmDean s;t0 2uo(rpiu1ol nlfctls) rrru p;u0olt  ociydfs2umuvpnu) lxnifcio1fm eau i;t trtmxopou1amt lnct s artruro;o0texoii3tyslm rmn snu) eerxr iatfa r ies () 2uoxm iy1lle  fvtat aruaxmp;u0oltn oeiyd mDumnvsnu4teenircoa1latrli ilt teurxopoo1lm nlnet s sDtmu pot1apx  ieiat aDelumon(0teenmf3oy1laDe ueo;t)sruo(rpnydomtemfeiat)arururpot1aex mfcildlm2umnvsn(4tlermr tatlptr u i s0texmxrpiu4lltn fvta( a2uaxr ;u1oltoifeildfm2eanvs (4teerif tytoa elivi s) rurir iu1altnlnvt ( arta(mo;t1apxomoctlt m2el(vpnu)texoio3ootfm   nvslt0setr(opio1ap nmfcsl() 2rmxmp;t0tltomieiys m elnmont4 reoirciy1faDrluvil(  rumxo3nydol e nes () rrrum oo4ope  o3tat m2rlumpn(0artoxo ta1lpDeluei t s2tr(o nu4ll nlfvs tf rrr(  ;o4texomieiyd aDuau p t) rtrmfctydfaDrluvol()srurxopny4ll   fetasfsDrrur ;o1oeenif3iat mDemnmo t0alxnxoctytlm eai i t)teumxm3oo1lmeelicslt a2trumpoo0tltoii3iydfm2eauvo (4tlenif3oadomD  uvs (0srto(opoodopt  ivsa()s2rrx  ;o0aexn fciyt a2uan p;()aeerxr3oy1lp rluei;s0srtr(m3ou4aptnmietat arra( pno1opx ioctasfa rluvp;()alxnxr tytfpD li s s  2ur(o3nu1omenlfcsa()sDtr(mp;u4aet  feiatfs rmuvont)tlenioctodfm  aueslt)t2ur(o3oodaptn ivt ()srra(m ou4tpx  o3ilsls2umump;t)trerio tadfa r ueo;s)trur(o3oo4lp nlfcs t) Dra( ono4oee  ieiltfs2eau on() rxnmf iytomDrau ols0s2umxrpiodaptnmfvtlt  2uau  nt4tpxo oetytfs rl( p t0 ltnmr3io1fptranvo () 2xr(opio1ape mfcsasfsDtr(ro;t4oetnmietlt sDuanvon(4tleomf3iydfp eli ils srur(o3io1omen fes (fsrtmu pnu0aeenmo3iasfs eanvs t4arxoir oatopDr uvi s s2xmimpiodlmtn ivtl(f rtrur no4olt iieiatfs2ulnmsnu4 ltnif oo1oa raivs;s0t2um(r nudlptn ncil( s2rmur ;t1oeeo o3tadla2rmuvs t0alerxr to1fpD lnvo;s tetoiopou1amen fesl() 2taxr ot4tleomieiatlm2ua(vs;t)trxnio3tydfm   ivi;s0 2toxr3ny1lpee fci s aDrmxm ot1aeeomfctltfs2umumont) rxrmf iytla eai s;() rtrim io4om nmfcils)aDrr(  ;u1olx io3iydfs2ua(msnt) eerxo oytfa  au s;s trtr(opnudop  liviatfaDumxr oo4alxoioeiatlmDranmon(0 exnxo3ia1opDran s;(0 2tmiopio4amtn fvt t) ruru ono0aleoifetadfs2rm(ms u4aetnxfctydlaDr u i s t2ur(rpou1apeemfcia( sDum(rp;o4tltnif3iysfm raums;u0 eeoiocoy1lpDe uei;t  rur(o3iodlm nmfvtlsf Drm(r nt0aptomfctlt s ua( o;t4trxrmo iatfm eanes;s  exrir io1al n feslt sDrmumooo4apenio3iadfsDrlu p t0tleoifciodfateaivo t  rtmxr3ou1ome  fci s) 2rm( pot0apxomoetlsfa ul( p () ltnir3tytlp rau ils0s2um(o ny4lpe mfvs sfaDuru poo1opto f3ils m2elnvo;t0alxnxf iytlmt lueo s0trur(o3ou1ap nmncs ( arumxmo;t0olt io3tytfs2emump;(4texoxr io1opDrli o (  rxrxrpio1amtnmnctlt s2trx poo4altnmo3iyt s2em(vonu0 etnmrctodfmtr ueo;t0srxmim nu4om nmfcs ()aDumxronu1tle  o3tatla el( o t)tetrmfcoy1lateaneolt0texmirpiu1llt lictatfs2ra(  ot4tpt iieilsfm ea( o () eenirctadoatr i i;( tetmim oo4llt mfvta()a2taxrpou4olen o3iydls ea(mo;t4tetrxr totla   neils)trum(opny1lm nlfvsa()arrmxro;o1tpeo fciydfm um( o;t0 lxoxo3ootfmDraieo;() eto(mpnydal nmfvsltfaDtmu o;t1alx mietls s rl( p (4texomfcty1lmtr i o;(0 exmxm no4olenmiesasfaDrruro;o0ale  ocild aDum(vp;(4teenxfctotlaD auvo;()s2xrxo3nu4lpte nesl()arra(r nt1opx  oeild a eln o;() lenxfcoydoa raivo s0t2xo(rpoy4am n ictas)aDrauronu0teeniociysfa el(vpnu4arxrxrcoatom raues;s truoxo no4lp emnvsat) 2umu pot1apxoifctydfsDea(vsn(0treomfctydlmtr ieil(0srxrxmpno1lp e ivsa() rraump;o0ole mfciad a em(mo;u0 lxnxrcoydlpDraivo;t0srto(r iy1ap   fet ( aDrmumont0texo o3tyslsDum( s (4 ltoxo oo1op eai il( srxrxopou1ol emivilt sDum(  nu4aet io3tldls uln snu4 leomo ty1lmt  ueilt0sruoxopnu4lltelfvsl()s2tru p;t1alx mfcils aDel(vs;u)arxnifcoatopDrai o;()srxmimpou1ll n nvt (f Dumxr nu0tlx iieild m2emnmsnu) eermo3todfp  liesls  rxr(m ny4om emnei s  rtax pno0tet ifcilsla ua(ms u4artoir3to1lmtrlu s;s  2toir nu1am nlfvtas) 2uax  no4openmieiytfm ea( s t) rtoircoatomD  ieolt0 2xoxr3ny4lpt mnvil( aDtaxmpnu0tlxo ociadfa2el( p;u4 rxoif3tytlpDr ues t)texrirpny4apt mneiat)s2rau ono0tle  o3ilslm eau o;(0trtomrctydlpteli o;(0seurim ny4aptemnes (faDtm(  oo1tpe  i3iad a2ua( p ()alxrxo iy1lm eau il()teum(r nudamt mieia( srtau o;o4tpe if3ils a rln sn(0aetrio3oo1oaDelu slt0teum(o3nydol e ncils  rra(  ;u1alxn ocilt mDumumont4trtnir3oadfmD au o;s0srtrxmpio4lptemnet () rraur ot4tlxo o3iad m2ua(vs u0aeerxf tadomt  i ols)t2trxr3no4lme mneta( srur(r ou0oet mociyt a2ra(mo t4tlxnxrctotlmDe neolt  ruoxmpiu4aptemnetl( s2rrxmo;u4oltnmi3ilsfs2rluvp;u)arerxrctadfa elivols0seuoxm3iu1opte neia( a2uaxroou1aetnmi3iyt a2ul(vs;t)texnxo3tydom  lieo s0trxmxr oo4lm  mfctlsfaDraxm ot1opt if3tldla2emn snt0tetoxo ty1la raies;()seuoirpnudam elneta()s2um(  ;o0opx if3iytfa2umn pnu0 eenif3iy1omD  nes;()seurim ny1opee iesas) Dur(  ot0tpe mictas mDelnvp;t0tlerircootlm   ieols0t2ur(o3nu1optelncsl()aDumur nu1olx  fetydfs uanmp;()aexrif3oatlatrlnei ()s2trxrpoy4amtemietls  rum(ro;t1opx ioctysfs rau o;u4aeermrctodfptr ues;s)t2urxm3oo4op elfesl(f rurxmo;u1opxo feiatfs ea(vs;t0trtoio3ia1fptrli s;(  rur(o3oy1optnmicsat)s2umump;o4ape ii3tlslm2ranvon(4alerir3todlpDr nvsl(0sexo(r3iu4ll   neia(fa2tmumonu4aex mf3iyd a2rmnvp (4 etoxociydfmDeai i;t0sexo(opiudllt mnviat)s2rrx onu4tetnifciaslaDra( onu)alxomoctydoatr ivs s)srur(m ny4op nmnvtlt) Draurono0apt  fciat s2uaumsnu)aetoio ia1omteauei;(0seto(rpiy4ale micias sDtax o;u4tleoiictatlaDrmuvpn() etrxr oadlpD  i slt  2xoxo io1olenmiesas)aDtrur ou0tee mi3iydlm eanmp;t)alxrmo tadoateli s;s)s2urxo oudolt  fesa()s2tmxronu4oltoifctltlsDulu pn(4altoxoctytfpD  u il()t2xoxr3iydame lncilt)arraxm ;o4tlt iiciyslm el(vs t)arxrxo3todoa eaivi t)seurxrpou4lptnlivtlt sDtax o;t1altnmoctysls emnmp u) eeoxrcoodlpD au s;()seumir3ou1llt  fvs (fs2umxm nu1tlx mf3iasla2ulu sn(4aetrxr oa1optrai ilt tetmxopoodopeemivia()arrruroot0aetnmoeiytlaDumu s;t0tleomo totfpteaueols)trurxr oo4lpeemici () 2taumpou0tpxnifeilsfs rm(vo t0tlxrmo tytlm r ieslt) rtoxo oy4ap  mnvta(  Dra( oot0aeenioeiadfs emnvont4 rtnmf oo1fptrauvol()sexo(rpoo1lltnmfvs s) 2taur ot0aptn ietldlm ean sn()aetoif3oydfatelivi ( t2xrim3nudopeelnes ()aDtax  ;t1alto f3tlslaDulnmo;t4 eeoxf iotfm rlieils)seuo(r3iu4ll nmnciat)s2ur(m ou4tpeo f3tadlm uan snu0aetoif3iadlmt au i;s0 rxmxo iudal  lfcsltf Dta(  nt0oet ioetysla2emn o;t4arxrmo oadfa e u il( t2xr(o oo4ome lncsls)a2taum nt4oex  fctldls ea(vpnu0treriocoadlp  lu olt  eurxo iodope mfvia(fs2taxronu1aeeoiietls aDrauvp t0 etoifciadfm e n o s0 euo(mpiydlpt mnvslt srum(  no0tet  f3iatlmDrmnvsnt0teeomf to1omDranvi s)trxm(r3ny4ll   nctl()a2ururonu4aet  fctldfs2rlu p (0 rermo3iy1lmtelivol()trxm(r3iodapenmfcilsfaDua(  ;u4tpto i3iltfs ean ont) ltrxf3iytlmDe ueol( seuoxopiydlptn ivtatfsrrrxmpnu1apxn ieiatls2uan s (0teenxo iotfptean o t0trxo(r iudope livsat artmu poo0oleniieiysla2rlnmp;t)tetrir3oodomt  i ilt srtm(m oydlmt lnetat) Durumo;o4aexn oeiasfsDuanms (0artoircio1lmD  uvi;(0s2urirpiy4lltemieiat)arrmx  no4apxomi3tytla umuvs;(4 rtnxr3tatlmtr nesls trtmxrpio1lpenmivsl() 2rax  ou4tptn fciadls2ea(mpnu) eeoxrcoytfm eluvo ()trtrio iy1lmtemnet s) rtmxmp;o4aexnio3tld m2umu ont0aexnxr ta1opteauesls)t2uoio3nu1lm emncia( aDurx pno1tlxn feiat s emumo;t)arenir oo1lmDr nvo (0 exmio iy1op elfeta() 2trx pou1apen ociyd s2rln s u0trerif tytomtraivol()s2tr(m3io1al  mfeil()s2ta(m no1apto ictad aDemnvonu0arxrmo3io1oate nes s)s2um(rpiy4ll nmivs s) Dum(m no1apt mo3iys aDrln o;u)areomo3oodoatr ueol( srxoxr3io1amtn ivtls)aDumumpno1olxo ocilsls eluvp ()alxrxrcta1oaDran s;t0 exrxm3nu1apt micilt)s2urx pou4tlx  i3iyslaDra(vo u4aeeoio3iydfm elieo s)setmim no1lle  iviatfsDrrxmpot0aleomfeiyt a2eauvp;(4 exomo3ia1oat  i slt t2trim iy4ome lictat)sDrau oou0oetomfcilsfm umuvp;t) ltnmr totfp elivi s) 2xmxr oodlme mietls) Durx ooo1tltn i3iltlaDranvp;u) rxomo oytomteau ols0sexoio iy4lpenmivs s)srra( oou1alx mf3tydla ra(vpnu)texoir iytlateaueo;t  eum(mpnu4apte fei (fsrumump;o4ope  ieiysfmDumnmo t0areomocia1fmDrlneo;t  euoxopno1lpeelnctls aDraumoot0tlx moeiydfm2el(ms t0 etnif3ty1lm eanesls0tetoxo3ou4ap  mietltf 2trx  nt0tle ioeiytla ulu p;u)trxoxr3iatlateaivols s2umxo3nu4altn fvtltf 2rrxmooo4apt ifctltfs2rmnvon(0tltrmf3oo1opDe n s t texmxr3oudoltn ncs ( sDtax ono0oleo octysla ulu o;()trxoxo3ootopD auesl()trtr(o3oo4ame lfvsa(  rrr(roou0apxn oetltfaDrm( o (0artomo totfpteli slt0setoxr oodolen ivsl( sDur(mpnu0oltnmieilt a2rmumsnu0trtrioctatomDeauvil()srtrxm oudaptelncsa(  2uaxrpno4optn fcildla2ua(vo;u0altomocoadlmDr u olt0seumim no1ap nmfeslt)srum( o;o4opeo octydlm ua(mpnu4aeenxf oo1op elu i;t0 etrir oy4ameelivias arurumoou1teto iciytfmDrlnms u)aeeomrciydoa   i sl(0 eurio3io4alt lnes sfaruax p;u0olt ii3iltla rm(mp;t)tetnxrcoytop rli i (  2um(o iy1olenmnci (  rum(mp;u4optoio3tltfa2elumsn(4tlxoxfcta1lptranvslt) rtmxmpnu1oltemiciltfsruru ooo1tee io3tysls um(mpn(0tltnircta1lmtrlnvslt)t2uoxr3ny1om  mieia( arrrxro;u4tee mf3iltlm umnmsn(4 eerxo3oydoaD  neo (0texrxrpnodamee fci (fa2rrurpnt1oeenif3ilslm2rlumpnt0 exomf3io1fptraneo;s)s2trxm3nydopee ict s) Dta( oot1tltoif3iys a rmnmp (0 lermrctadfpt au s;s0teuo(o3iu4omtnmfes (fsrtru o;o4tpxoii3ias a2ul( s;t4 exriocoodoaDraneols0srxrxopiudlmenmfvsls)aDurxmo;o1apx  f3ilt a2em( s t)aeerifcoydoa  luvol( srur(o3iydopt lfesltfarrm(  ot4aexomiciydfsDemnmpn(4alerio ta1lat livil(0s2xmxm3iy4opt lieiat aDraxroou0tpen fetldfaDrlnmo;u)altoxo oydlpDrai ilt) 2toim3oy4opt lfes tfs2uaumooo0aexnmfctlslm2em(vo;() lenxr iotlateanes;t  rtmir oo4omt livs ( sruaxrpnu1oltniietatlsDrmu p u0 eerir3oa1fmDrlneo;()sruoxm3io1lmee ivtls) rurxronu1apenifeilt m uauvont4aeeriocto1fmD auvo s0seurxr iudlm  mfeil( a2ta(rpou1tex  iciasfa2ulump;u)aetnir3iytlmte uvi s)trxrio3iudomeemivi () rtruro;o4tpt mociad s2em( ont0texrmo3tadfptelies (0texoxo3iodam e nvtls s2tr(mp;o4oetniictys sDumu s;t)tleriocty1faD ln i;s) 2urxr oudaltnlfeias)s2ta( ooo0alxn oeilsfaDua(vs (0 exoxf3tadfp elivs s)teur(o oy1ap   fvs ()a2raxr oo0aexn i3iatfs2ra(mo u0 ltoiocootopD aueo t seurxrpio1opt mieia()sDtrum ;o4tleniieiysfmDumu s u0trtrxfcoytoateli s ( sexm(m nodllt lfetl(faDtrxmpot4tpx mieiat a2um( p;u0teenif3iatopt lueo t)s2uo(o3no4lp elfesls)a2um(rpno1tlenifeiltls rm(vp (4 lerif3oytopt anei s0t2urxm3iy4lm  liet t a2trx o;o0apeoii3ilt aDulumo u0trtomo3oydlp rlieo t srur(m3no4ll emfvi t  2rrx pnu4aptn feiadlm2emnmpnt4arermr3oa1fpDelueo s  rurir3oudlle  iei s)a2uru pnt4tex miciyd mDumn snu4trenio3iadlm e uvs;s)srxoirpnydapenmfvtas)a2uax  no0alxoio3ilsfmDrlumo;t0altnio3iytlmtrai i;(0srxrxmpiu4alen ici (fsrtr(mooo0tetomictad a eau o t)altnif3ta1oaDeaneo;s0sexrim iu1opt mfes t)srumx p;o1alxoiieilsfm2rlnms (4trtrxrcoodfm  lu i;(0t2xmio3ou1ll  lfvi (fa2trxmo;t4aptn ieiasfm2rm( pn(0altrxf tatoat luvo t)sruoiopiu1lp emfcs sfs2urxmpoo0tle micilslmDrmn o () lxnirctydfpt aies;(  rxmir nu4apt mict t  rtax ooo4olxnifeiltla2ra(monu0 lermo oydlp   uei s0srxoim nu1al  lfvtlt) 2ur(m ou4tptn octltlsDul(mp;t4tltnmr3oy1lm raivil() 2umxo no1lmt mfesa(  rtmx  ot0tltnmictlsfsDrl( ont0trenir3oodlpDrlneolt)s2um(m3nodapt lfvsatf 2rr(m nu4tpeoifciadla2ean s;t0aexnmr3tytom r u ils s2xrxm ou4lpenmics ()aruaur no1ole  i3tadls2rmnvp t4 rxomf ta1oa rlu o s trtm(rpiu1opte ivils)sDrrx  ;u1ole mfetadlm2ranvont0alxoir3oy1fa   nes ()s2toir3oo4lltelfes (faDtr(mono4tptomi3tyslm rl(vp;(0tlxrmo oa1laD  ueo t)srtoxr oo4lmt lfct (fsDraumpno4alenifcild s rau o;(4tltnxocoadopDe neols0 etrim nudapenlnvil( aruaxrpot4olenmieiadfs2uaumo;(4 rxrif3iatlmt lueo s  eum(r oo1ape lnesl( aDuru  nt0aex ioeiasls2em(ms ()tlenmr3ootfmDrluei;t0trxr(r3nudaltelneil(f Dum(rpnt1opxnioeiasfs2elu s ()trxrxocia1lpDrlneo;t0s2umxm nydoptelicta(fs2taump;t0oeen feiysfm2uanvp t0 exrif3ia1fm e nvols  rtmxo3ou4ll  mfvias) rtmx ooo1tptn oeiytfaDea( p;(4 leoio ootomDelnei;s)s2xm(o3ny1al  lnci s) rumu oou4apx ifciadfm2ea(vo;t)texoxrciodfatrau s;(0sexmxrpnu4amtnmfviltf 2tm(r oo4oleoioctltlsDumumsn(4aetnmf3ia1lp r iei s0 2uriopno4lle lnet s) Drruront0aee ioeiys m2uan p;()tetnxrctodomt  u o s teuoiopou4amee ncia()aDtmxrp;u4tltomo3ils a2um( p;u4 exrif3todfmDeaneo t0 rxrxm3iy4alte iesl(  Dtmumont4apxniieiydlsDel(vo (0 lerxf oodlate ivo;s0sruoio3no1olte iei () Dtr(  ;t1tpt mfeiydlaDemuvp;u)tlxrircoy1omt luvi;(0trtoim3io4aleemncias) 2rau  oo4tpto i3iatfm rau p u)tlxoxfctytfpt lu s t) 2tmxo3nudlp  mfcs (f rta(root0tpto octatlmDrluvpn()arxnif tadomDeluvo;t  2xoir ny1om  mnvtat s2taxro;t4apxoioctys aDran onu4alxoxo iotopt  ues t0teur(mpio1lptnlfvsa( s2tru  nu1oltoii3iysla2el( o u) ltrir tydoptraueol(0 ruo(opno1op emfvs s a2rm(mpou1aptnii3iasla2eaums;t0 leoifcto1om   uei;t trurxo3ou1oltelivt (farta(m nt4tptoiietad m umu snt0tlxomr oy1fm elu s s)s2tmirpiu1llt  fvias aDtrxronu1alto i3iyd m eln p u0trxrxr3iotoaD  i o;s)s2xoim nudope  fvtl(f Drm(mono4optnioeiydfm2ra(mp (0teeoxr iadfpDranvs t0 2ur(mpoy4lpt mivil() 2taxm ;t4texo ieiad sDuanms;u)trermf3oodfpDeai o;()setoim3oo1lptnmfctl( a2ra(mpno4ale ii3tadfa2ean s;t0tlerxf3oydfm r n olt seumirpoodlltnmfetls) Draumooo4texoioetlsfa2ua(vs;u4 lerxfctodfpt  i o t0 exmir3ou1amtnlnvtas sDrm(  ;t0apxoioeiad sDeauvp (0tltoxf ootfmtrli o t t2tmxm3nu1olee nvilt arrrxr no1tee  i3tasfsDelumo;(4 rtnir3iydfp  ai i;s0 rur(m3nodll n nctlsfa2rax  no0optn ieiytlmDuanmo u) eerxo oatfateaneolt) etm(mpiu1ol n feil(f 2raxr nu1oex  fctyslm2rln o u0 renmfcoytla ranes t)srtrimpoo4olt mfetl(f 2ur( p;t1olt ifeildfmDrl(vpn()trtrmo ia1faDean i s seto(r3iydap elnvtl()s2rrurp;t0alx ioeils sDumuvo ()altomr iytlaDe ueil( seumirpou4amtemiesl()s2tm(mono4opt ioeiatls emnmp u4aeeoxrciydfmDrauei (  2toxmpoy4lm  mnvta()a2raurp;t4oleo icils s ulumpnt0 exnxr oytfmDelnvo t  2xr(o iudape miciasfsDum(rono0aexnio3ilt s rm( snu)altnxrcto1laDranes;t0t2uoir no4omtemfet t) 2raum ;u0tpt ioetasfaDel( s;t)teeomrciytfpDelueils)setoio3iodal  lncsatfaDtaumo;t0ape  i3tltlm uauvsn(4 lxnmr ootlptrlnvslt seuoxm3iy4omtnlfvtl(fsDrmx  ;u1oeeoifeiad sDrl(vo t)alxnxo oadfatrln i;s s2toxmpou4ap e icia()a2umxr ;u1alxo oeiltlm2em(mp t0 etnxrcoodfaDr nes;t  etrxrpiu1omeelfeiasf 2uaurpot4oet  oetadla2rlu snu) rtoio ootfa ranesls teuoio3oudaptemncilsfarrru  nu1oexnif3iasls umnvs t)alxnxr iadfatrlivo s sexrio3iudape lneil( s2rau ono0aleoifcildla eauvo;u0alermo tatfa e ies;( trtrxopou4op nmnct (fa2ra( pnt0opxo oeiat m rm(mont4 reomrcto1la raieslt  exrim3oudapt  fci tf rraum ou1aptn ictytla2ra(vo;u)tlxoif3to1omDr u il( srxrim oodomenmfvt sfs2tm(m ot0tex  oeiatls2rlnmsn(4aexrmr iodlaDean ol(0texmio iu4lp nmnetltf rrrxro;t4aexo oetld m2el(mp (4aleoir3oadfm rlivsl(0s2to(m3ny1apt livtl(fa2rmx pnt0opx  ietls sDua(vont0 lxomr totlptrauvs ()srxm(r3io4lp n fciatf Dtauro;t0oetnii3tas m ea(vo u)aetrxf3totlpte iei t0s2xmim3iydolteliviatfs2tru ont0apxn icias m em( p t) etnio iadom raiei t0 etmxopiydalt  icils)srumx p;u0olxo feiaslaDem(mo;(4altoxo totoaDr nvo s tetmiopoo1al nlivsa(f Durxmpnu0alt ioeiltls2el( p;u4tltnio ia1lm  aivolt)trxmiopiu4om  lnetl() rtru  ;u1tlxoiictydla2uln pn(0 renircta1oa  lueol( teumirpno1lltn ivt tfsDtru pno4tltoii3iysfa2emnvo;u4altrmfcoatlate ivo s0srur(o3iodlmtn neil( srurxrpnu0alenmoetydfa2rlu on(4 lenxf3ootoat  ueil( t2uo(mpiy4apen ncs s)s2tmum ;o4tpeoiieiytls rl(vsnu0trtrifcoo1omteli o ( trtoirpnu4am  lfciat)aDrmump;t1ole  f3iad a2um(vs (0tlenmr oy1fa   n o s) ruo(o3ou4lm   ici t  2uaxro;t0tpeoioeiydfaDemnvonu) rxrxf iotlaDelu il( t2to(o iu4lmenlnct s  rrru pot0texniicildlmDrmnvo (4altoir oydoateau i;t0tetm(r3iy1llt lfei (f 2ua(  nu4oex iieiydfm umu o u) rtomrcto1opDelu o t0srtrimpou1op  livsl( s2trumpot0aleo i3iaslsDulnvp (0aexnmo3todoateluvo;() eur(rpnydlle mnctls)srur(ro;t0ope  f3tadls2el( p;u)artoiociodlpte uvi;t sexmir nydllt mnet (  rtm(mo;o1texo i3iyd a2rlnmonu0 leniocoydfmtranesl( setmxopiodal   ieta()a2urx pnu1tpe if3tlt s ranvp t4 lermf3ta1lmtr n i;s)sruo(r3oy4lpe mict s  rumxm ;t1tpxo fetytfm rlnvont)aetomf totfpD  n i;(  2um(mpnudlle lies sf 2ur( oot4openmfcilslmDrlu o (4alerio to1laDrauei ( trxo(m oo1lm   iei ( srurumo;t1texniieiytlaDemnvo u0aleoir3ia1fmtr ivsl()t2urirpiodlp nlnct () rtmxm nu1oex  i3ildlsDea(ms t4altnxfcty1oateaivi s trtr(r3io1amt licsa(f Durx pou4texoioetad aDel(mp;u0 exnmocoadop rauvilt seuoio3io1lmenmiesl( s2rrxmpot4tetn oeiysla emnmo;u)alxnxr3iodfa e neo;s) 2trir nodlpte fesltfa2umx ooo0oltn o3iad mDranmp ()tlenmo ia1fptelnvs;s0trxrxr nudomenmivsas s2truroou0alxnioctydla2el( s;(4arermr oa1faDrlivils0 ruoxo3ou4oleemivil(f Dtaumo;t4aex if3iydls2ran o;t4aeenmr3to1faD an s;t srtrxrpny4ll e ivs ()a2tm( p;t0apxniicildlaDulnmp t)aetrxf3ia1latr n i (0t2urirpoy1omenlicslsfarrm(rooo4tlxn o3tat m ul(mon()arerir3oy1opD aueolt) exmxo no4llenmnetas a2trxm ;t4alxomietad mDra(ms ()texrirctadopte u ol() exm(opiydomt lnci ( a2rm(mp;o0oetn octyd sDrmnvp;t)aetomf3iytlm raues s0sexmio ou4am emnctas)s2rrx poo4apxoii3tyslmDel(vo;(4alerifcio1lpD  ieo (0s2to(r io1lp elfvtas)a2tmx ooo1alxnmfeildls rmn snu0tleoxocta1lp e uvsls teto(opiy4lmee fcslt) Drr(rp;u4apxnii3tadlm2uanvs u) lenmrcoytlm  lu olt srtmim oy4omtelici sfsDuaxrpno1optniietadfm2rluvp;u4 ltnxo3ia1opDrlieo s)s2urxr oy1lltelfvs tfaDta(rpnu1apeo iciatfa2rmuvon(4altrircootlp r n o (  2urir ny1lptelnet sfsDuaxmo;o1oltnioeildfs2rlu onu) rtrmr oo1fmD lueilt0seur(r3oy1lltnlnet s)artax  ou1aptoifetysls2rmuvp;t)artnmo oytla e uvil() etm(mpnu1apt liesat) rrmum ou1tlt if3tatfa2rm( s u0tlxrmrctydlpteauvs (0texrir io1lmenlfeil(faDumx ont1optnio3iytfm2ua(vo (0altrif3iydom eluvi ()sexm(r3oodlpt mfctlt s2rmx pot0tltn ictys sDra(vo (0 rtnircoydop ean s;s) eum(o ny1am nlfvtat)arrrumpoo1olto ocilslaDrlnms t4areoif3oatfaD anei (0setmxm nu4lmteliesl(faDra(mpoo4apxomf3tltlm ranmo;t0trxnifcoatfmteau ilt) 2xo(opoodomtnlfetasf Dtaxmp;u4olt  feiytls eauvp t4tltrmo iytlateaneo (0srum(r oo1lmtelfvias a2trxm ot0apt ii3tltls rl( o;() lxoxr to1fm eaneol(0teum(m3nudlp emivta(fs2tm(mo;o1opeo fciytfa2ulnmp;t4trxoxocto1oa rli il(  2toirpio1ope  nvs ( aDrrur ot0tlxnmo3tytlm eaumont4 eenxfciytop eliei t  eum(o3io4openmnvtltfa2rmumo;u1alxoif3tlsls2emuvsnt4altomr tytla e iei;() 2xmir3
\ No newline at end of file
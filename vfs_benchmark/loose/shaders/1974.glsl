@@ -0,0 +1 @@
+n ols) 2um(mpoo1amt mictltfarrrumo;t1tpt  ieiadla2emnvp ()teeoxo3todfaD ln o t)s2ur(opno4am nmncsl(  rum(mpot0tex mieiad sDem( s;(0texnir oodoa  lneol() etriopiydame mfct s)srua(monu0aptn oetyslm eaumonu4 rtnmr3oatlaDean o;()t2urxmpnu4om  lietas)arua(mpno0tleoif3ilsfa ean onu)texnxr3iytoptrlnes ( sexmim3ou4ome lfei t)srtmxm nu1ape  f3tytfmDul(mon(4texomoctotoatelnvs;s  exrxm3iy4amenmncil()artr( o;u0tltoioctasla2ra(vo;t4tlxoxocio1lpt luvo t t2uo(opnu4open fcs () 2tr( onu0ole ii3tad s emnvonu4 ltnmrciydlpteaivi s) 2uoxmpny4ape lnvtat  rra(mo;t4oetniicias aDrau s;()aeermf oytfa rln il(0 2trxo iy1llt  nvi t)s2rrumoou1alxo i3iad m uan pnu4aeerif iadomDe ivslt)seur(o oy1om  lfcil()artaxrpou4oeeomoctls s rmnvs;t4trenir totom e n o t)texm(o3iy4lle lnvilt)sDtrur ou4alxoifctyd a el(vpnu0aetniocoytlm  ai sl( seurirpno4lpenliet ()s2tmumpnu4tptomf3iysfs2umuvp;t0texriocoadfm e u s s)s2xo(mpoy1lmt  ncsl()a2ururo;t4tptoif3ilt mDrmums;u4altrirctotom e ivs;()srxmio io1opt mfci s)a2tax  ;o1aleo oeiyt mDem( p t0tleoif iydfaDean o t)teur(m io1om e icsa(farumxm oo1tlxo oeiyslaDeau o;u4 leoxo3iotlaDr ivs;t0teum(rpnudlmenmiei t sDtax o;o4oetnifetydls ra( p t)tlxrmr todfm ranei;(0sexrxr3nudlm nmiet (fs2ua( p;t1ape iietltlm rluvo (0arxnio3iy1fa   uvi s trurir oudaltelivt sfs2uaxmoou4tptoifctld s2elnms;t4alxnxfctydlpte u ols)teumim ou1ome mnviatfs2urx oou0oexoif3tadlaDemuvpnu0trtnmrciytlpDelu s t0t2uoimpny1apee fesls) Drrxmono0alenmi3iys a2el( on()trerxociytfp rlies;()trtm(opou1amen nei tfarra(m ou0alto o3iys s2rln pnu4tlerif3oodom r uesl(  ruoxr iy1llt lfvi tf 2rau  ;t0tet iicilt s umu p t4tlxoif3iydfm  ln o t s2um(opoydom  mici t)srta( p;u0olx ii3ildfsDuln ont4arenxf3iadoa elnvols0 exr(r3iudal emivt s)sDumurooo4apeo oeiydfmDrm( p;u4trtomo iydlm   ivs ()srtriopno1am emivs (f rta(rooo0aee ioeilslmDeanmo t) rxnmr3tydlmt aies;(  etrio nu4ole mfetls)s2rmx  ot1ape  f3ildfs em(mo;t0 etnmf3oo1lpt  uvo;()t2umxopiy4lltelieil() rua(mo;t1aet moctydfm rl(mp;()aetrmociatomte ieo (0t2urxo3iu1llen fes tfs2um(mo;o4tltnmf3iydfa uaumon(0aeeomr tytlateanvo;t)seumiopoo4op   feils)srumxro;t1tptnio3tas m umu o;u4tltnmf to1oa elueo;s srtr(mpiodaptemnesl() rum(ro;o0aee mo3iadlaDea(vo;t4aexrifciydlmDe i o;s)trxr(mpoudamtnmnvias)a2ta(  ou4alxo i3tysfmDrlu p;u0 rxoxociotfa r nvolt)t2trxm3no1altemivt sfs2taurpot4tpxn ocilt mDrm( pn()trenif ia1op e nei;(0trtmxm ny1ole mncsa( aDta(ront4tpenmietatfa2raumpnu0aexnir3oydlatr u o s0seum(r iydom emieiat  2rmu o;o1oltomi3tyslaDulu pnt4tleoxfcoa1omtean s;s t2uoio iydlptnmncil(farrrxmpnt0aee  o3tasfs um( p ()tlxnmo3iotlmtrauvs;t0 rur(o nodameelnes (  2uax  oo1tpxn feiadfmDuauvs;(0altoio3iadlpDraueo;t)teuoxm3nu4lp emfcs s) rtrx ono4ape  ietyd m2ra(ms u) eeoxf oodlaDeai s s0 exo(r oy1optn fvt t srtaum no4ope  ieiyslsDuan o t0arxnmocta1lmDr uvi () 2xm(rpnydome mnciat)a2um(r no4tpx moctadlmDumu s () eerio ta1om eanes;t)tetrxo3no4lm e fcsltfaDta(  ;o0alxo o3tasla2ul( snu4teenif3iytfmD  ieolt setrxrpny4al nliet tf rurx  nu4tlxo ociadfm elnmo (4aleoiocoydop ranes;(0trxoxo no1apen nei s aDrru oou1olxnmieiytfsDel( o;(4aetrifctotfmt lu ol() rur(rpiodoptnmnviltf rtr(mp;u0apxomoetydls ul(mpn(4tltnir oydla e ies;t) eum(r3iydlp n ncs ()a2rrur nu1tptnmf3tadfm uanmp ()altnxf3tatfm  lueo ( t2trxr nodal nlfeia()sDur(r no0ope mi3iat a2rm(mpnu)tetomo3iatlmtr ueils0 2ur(r ou1oltnmnet sf ruau pnu1apt mfeilt m2rm(mo;(4tlxrxrciytlpt anvi t  eto(r io1omee fesltfsDtrxmooo4optomfciltfs2ulu o (0teermo oadfm r uvs;t  ruoir iodal e fctas)arum( p;t4olto feiasfa2ul(mp;t) lxomf3iotfa eaueo s0 ruoir oudomeelnciltfarraxmpnu4tlx  o3tld s2rmnmp;t0alxoir3ootfm e u i;s tetm(m iydlme  fvsls)a2rmxr ou4aeeo ociat a um( snu0tetnmfciy1opDr n i ( t2to(mpiodlptelietas)sDua(  oo4tpeoio3ilsfs2em( p;(0 leoxrcoa1op elivol()teur(opoo4op n ncsl(faDtrxmo;t4teeomf3ilsfa2ra(vo;(0altoiocia1opDeau ilt)sexrxm3io1lltnmnvs sfs2rau oou1alen oetad s ea( pnt) lerxf iadlp  au sls0trur(o io1llenlncs ()a2ua(r ot1tpx mociatlm rluvo;u)tltnir3todlmD  ueo;(0t2umxm3ou1al e netl(fa2rrxmont4apxn iciat s2umumo (0tlenxrctodlmDr nvo s)s2uoimpoodamen nci sf 2rm(mpot4apen feiys sDumn ont0 exrxf3ta1lm rlnes;t setm(opiudap e netasfaDta(m nu1aee mi3tyslm2uau p t0 lermrcoodlpDr iei;()s2um(m3oudapt  ncs s)aDrm(r oo0oex  i3ias sDranvp;t0 ltrmfcootfp  ai s t t2um(rpno1lptnlfvt s) rtmu oot0oeto i3tytfa2rm(mpn(0 leomr oydla rlnes;t t2tmir3ou1ap  lieta(  Drr(m ot1aetn oetas sDrlnvo u)trtoxo3todfmD aues s trtm(rpoy4ape  fvi sfsDraxrpnt4oex iictldlsDrluvsnt4arerircoa1la elieo;( srxm(rpiu4lltelieslsfa2ta( ono0aeeniiciysfa rm(mpn(4trxnmr3oodfmt ai i t)seumxrpnydll   ivsas  2umu  no1oeeniicils s rmu ont4trxomrciodfate ueo;() 2umimpou1lp e ivi sf Drau ooo1olxo fetltlaDemnmp;(0trtrxfcty1lmDe i i (  2uoxmpiy1lpeemfcsa( aDrau ooo4oex mf3iad s2rln o () exoif ta1fatr uvi;t texoxm ou4lptemfeta()s2tm( ont0alenmf3ias s emu o t4 lxrircoy1lmDr ivo;s teum(opiu4altnmfvslt)arrm(ro;t0olxoif3tyt m eau o t)altnio oo1faDran i;( t2tmirpiy1opt lncta( a2rrumooo1oleniocild s2ulnmpnu4 lxnmr3tytfaDean sls0trtoxrpnodam  mfvta(fs2ur(ronu0tpt ifciysls rl( p u)texomf iadla r ieo s0sexr(r io1olt mncia( srtm( ont1alt mieiad mDua( p;u)alenxr3todfpt au o (  rtr(r oo4lmt mivt s  rraur ;u1texoiictys s umnmp t)texoxr iydomDeluei;(0seurio3nodal elicslt arum(r ;t1tltoioeiasfa rln ont0teeoxr tadoatelieo s)s2xmxrpoy1am  lnct (  Dtmum ;o1oeen ieiysla um(vo t4aetrioctodlpDeanvo;s)srtoxmpnydom nliesls a2uau o;o0oex mieiyd s eaums (4tetoxrctadfmDean s ()t2ur(m ou4amee fcsasfa2trx  ou1apxnmfeiytfm rlums u4tetrir3ootoaDeli ols  exrir nu4lmenmietltfa2uru  no4tpe miciad s ua( s t)aeenmf oa1lmte uei s) 2xm(rpnu4omenmnes s s2rrxmp;t4tleo octlslaDrm(msnu0trtoxr ta1lp eau s (  2xoxr ou4omteliesl()srtau  ot0aptoif3tltfsDemuvsnu) etoio3tydla r n sls)s2xm(r oo4lltnmneta(fsrtm(rono0tpxnmo3iyt m raums;t)alxrxr3oy1lp ran s;s  2to(o3iodlp n fet s) Dra( ont0tet if3ilsls2uan o;(4trtoxo totop rlneo;( trxoim3oydlp e nvi ()sDumxroot1ope mf3iatfm el(vsn(0aeeoir ty1fa e ieilt)s2urxo3oodlmt mncil( srraxm nt1open f3iyd mDum( p;u)texrio to1fp  lnvo ( teuoimpiy4op n ivtat) rumumoot4tex  ietyd m eanms;u)trtriocoy1fmtran s;s  rxo(opnu1ale  ietl(faDtrur ;u1tetn octyd a rm( s u4arerxf totlp r u slt t2trir iy1optelfvt ( aruau pnu1tltnifciltls ea(ms u4aexnmfcoatfm   uvilt0tetoxo3iodole lfcs sfarumxmono4tpe mi3tadfa ea( on()tltrxo3io1lmDelu ils0 2urio ny1ame lfvias)aDtaxr ;u1tpxo o3iyt s eanvo;u)aleoxo3tatfmDeauei t)srxoxr no4op elfvt s a2tm( p;u1ale mf3tytfa umnms;t)artoir3iytlpDrlu o;() ruoimpoydlpe lnvtls s2ra(m no1tleoii3tlt s rmn pn(0artrxociadfm ean o;() rtmiopnydapeemnesa() 2rrxmp;t1oeenmi3ildfaDra(mp (4tetoifcoo1op r n s s0seurxo no4ol elnesatfsrrmu pot4oleoiiciytla2em(von() exrif3oo1lm eanvols s2trxmpio4lme  fcs sfs2trxm ou1tpx mieiyd m2uau o;u) exoio3iytla rauei;( sexrirpny4ope  fcta( a2raur ;u0altnifctys a ranmpnt4alenxf3iytfmt aieo t) euoimpiydamenmfct (fs2uaur no4apen feils s2ul(mo;(0 exomf tytla e i i;s srtoxm oo1al nlneta( aDuru  nt4tleomi3ils m rmumsn(4alenmr3oodlaD liei;s)seuoxmpny1lltelncs ()s2raxmono1tpe  ietldlsDuanmo;t4 etoir oydlmt an ol(0sruoir no4lle mivsasf rurump;u1openii3iyt m rm(ms;u)aexrxrcta1oaD li o s  euoio nodap emfctl( artaum no1tex io3ilsfm2rmums;u0artnmo ta1oa e ueil(0srxr(rpnu1lmeemivtl( sDtau p;t0ope  oetat sDulumsn(4texnxociadomte uvil(0srumir3ny4lmtnmfeiat s2tr(m nu1alx ifeiad aDulumo (0aeermo ty1fat ai s;t) rxmxm oydam nmfvtl() 2tm(rpnt0olt mfciydfm2el(vo t)trxrir3oytomtr iei s setoimpiy1ope mfeils aDur(m nu1olen icilt mDelu p t4 eermociy1lmD  nvs s t2tr(opnu1op  mivs t) rraxr ou4tpenifeiadlm um(vpn() etnxr3iy1oaDr u s;s0seurio no1oltnmictlt)artr(rpou1apxoifctys a ulnvo;u)aeerio oy1fp rluvols0 etm(mpoodamte icias arrm( pnt1olx  iciadfa2umu pn(0trxnxr oy1omD anvolt)tetrir nudlmtn iesl(faDururpno4tpeniociytlsDua(monu)artnmo oydlat lnes;t)seto(r3no1op n ncsls sDta( o;u0aee io3iatfs emu p;t0texrmf iy1fp  livsl(0 2trxm3ou1op elfct t)sDtaum ou4open fciydla rm(mo u4aetrmrcio1fp eli ols s2xm(r io4lpen iviltfaDurur nu0aeeo ocilsfs2eau o t) ltnxo io1lmtr nvs;()srxo(r3oo1lle mfesas aDtm(mo;o4apto octadfa el( p t)aetomr3io1fpt li s t0t2uo(r no1al n ncsl() ruauronu4aptnifetltla2emuvpnt)tetnxf ia1lp e ivol()seurim3iydaltemivsl( aDumx p;t4oetnifeiltfm eln pnt4 rxrxfcoatomDeauvo;(0t2uo(mpiy1om  mfes t sDta(rono4tpeo ietydfsDulu snu)teeoir todfatr uvi;s) rtr(m3oo1ap n ieils  Dua(rpou4aetomf3iysfa2ulnvp (0tltrmf3totlatr ies;s s2xoim oudape mfctlt) Drm(rooo0oetomieiltlm umu pnu0alxrxrctadomDrai ilt srxrim io1lm  lfvsa()aDraumo;o4tpxoioctasla2um( p;t)tltoxf iydopD aies;s)seumxm3no1lpenmnei sfa2rr(rpoo4tpx moeild sDrauvp;t0treoxo3iatoate ivs;s)srxm(opny4om e ivi sfs2urxroou0ole ii3ilslm ea( s u4teermr3ta1fmDran i s) exo(rpiu1lme mfvs sfsrtrx  ;o4aeto i3tlsla2rau snu0 eerio3ty1fpD li ols s2urxopio1aptn fei s) 2tr(r ;u0olen octltfm ea(ms (0trxnxo3ootom eaueo;()s2xmxopnudll   ietatf 2tr( ooo1optn o3tydfm ulnmp ()altnxo3oytla eaivo t)t2toxr nu1alt mfeslsf Dtm( pno4olxomi3iasfa rm(mon(4tltnxo3tadfpDe neo t0trtoxopiydamtnlivt t) 2tm(rpou0alxnifctltfa2um(mpn()trtoxr oodom rau ol()texoio iy4lp nmfciasf 2um(ro;t0tpeoii3iltfa2um(vo t)aexrxf3oydopt lneo t  ruoimpoy1ape mfcs ()arurumo;t1altn fcild a2rlnvonu)tltoiocoatop   ivi t)seumiopny1lp   fvsl( arum( p;t1oee  o3iatfm umnvsnu4alxoif3totfatelueols0trxmxr3io1llee nct (faDra(mp;o4oee mi3iyd mDuaump;u0arenifctytla r n slt)truoxrpny1ome  ici t)s2tax  ;o0opx  fciydfsDemnmp t)teerif3todoat lnvo;s  rurxm ny4optnmnesat a2ururoou4aexo fetyd a2uanvo;u0arxniociodfaD  ivol(0seurxo oydapt mfet t  rra(moou4tptnmocild m2rmumo;t)trtnxr3todop  anvi s s2xo(opoydlpenmivt sfsrur(moou4oexn i3iys s ua( s;t4altnmr totfat anvo;( teurxrpoodlmee ivi tfaDtaxmooo1tpto fetlsfm2uln o;u)altoif ia1faDe ivils0srtoxr3iu4opeelnvsat)arua(ro;t0tpt io3iydfa umnvpnu4tetomr3ia1fm eanesls0 2toimpiu4lltnmfvtas srta(mo;u0oleoioetyt a2uluvp t) rtrif oadomteau o t)srtm(m3oy1apeemfesat)s2tmurooo1opx  oeiyt a el(ms;u4 rxrio totlmtran slt0t2umio3oudlpe lfes s)aDuaurpou4oex if3iatfaDemumo u4 rxrmr3iy1opteauvo;t0 rurio nudamtn ncslt srtmx  ou4aex ifciasla2rln pn()treoxr iytoat aueo;t)t2um(o3nu4ape mfvs (  rraxrp;t1aeeomo3iaslm ranmo;(0alxoif3ootomtr ivo t0t2xoxo ou4amtelfvias  2taur ot1tleo iciyslsDemnvsnt4arenif3iodlm elivo;t  rto(opno1olee ncilsf ruax pno0tptomfctlt s2elump (4 rxrif3ia1lmD an s;(0 eum(r3ny1apt  fvslt arrau  oo0tee  feias m2em( o;t0aetnio3oadom eaivo;s tetmio3oudap  lfes tfa2umx pnu0alx  fctadla2elumo;(4 eerifcty1fp  ai o;s0 rtmxm3oudapenmfei tf Dtr(m nt1oeenmoeiaslm ulnms (4artrmr iatfmDraieols seuoirpnydll e nvils aDrmxmp;u0tpto f3tyd sDemnvs;u0aetoio3oydla  anvi;( s2xrxm3oudlmt lies () rurumpnu1oeto fetlsfs ra( on(4tlxnif3tatom e u sls0 rtmiopiy1al nliei s arrru p;o4apen i3tldls ul(vsnt4aleoioctydfp eaneilt0s2xoxopnu4amtnlfcia()a2tmu pnt0olen o3tadfm2ulnmpn(0arermo3iadfmtrlu ol()teuo(o iodllt mnetl()a2tax poo0tpeoifciytlm ranvs ()trtnxociatfatrluvi;()s2uoim3iudape mictls)s2taxr ot1tlxnif3ild s2emumo t)arenxo oydfatrai sls)s2xr(o3oo1apt lfesatf 2tru pno4alxomi3iasfa ea(vp u4aexrif oa1op r n i t) ruoxr3iodol nmnvtlt)artmxmo;o1aexoif3ils a rlump (4 eeoir oatfpDrai o t t2um(m3oydlm  mnvsas) 2uaum ;o4aet ifcild a2elu p;u0 ltoxf3oydlmD aies t  2xoiopio1al  mict s) 2taumooo4alt ioctadlm uanvp u0tltoxo ty1fatraivs;s0texr(r3ou1apen ietat) Dtmxmoou0tltn fetatlm emn pn()aeerir3oydfpD an i;( tetr(m3nydoptnlivt s)arra(m ;t0oetoif3iat m rlnmp;(4alxoxrciodoa raues;s srxrio3oodomtelivtls aDraxr nt0oltn i3iytls2rmnvs;t4tlermoctytfmDeau s ( s2tmirpoy4om n ictat sDrrxmonu1tpxo ieiysls2rl(ms;u0teeoioctytomD  nvsl() eur(m3iydlmtnlict tfsrtm(ront4tpenii3tatfsDelumpnu4 rermfciadlaDeluvo;t) rxo(o iy1lltn iesat) Dtaxro;o1olenmi3ils a2ea( o u0altnir3ta1omD ai s () eurxm3oo4lpt mnctls  rtaxm ot0opeo fetlsfaDeau s;(4 lxrxf3oa1lpDranvolt  rxrxr iu1apt mnctl( a2urxro;u4tltoiieiatls um(ms u4texnircta1oaD  n s ( s2xoxr3oy4ll nlfeiat srurum nu1tle  f3iatls2uluvsnt0altnxf3iadopDe uvols0 2toiopiu4ll n icias)s2taxrp;t0alx io3iad s elums (0trenmr tydlatr uesls0 2xm(m3ou4lmt mieil()sruaxm oo0tpx micilt a um( s t) eenio3ty1fp   ies;(0 rxmxopiodap e fct s)aruaxrono4tlto i3tyt a2rl(mont) lxrmrctodlaDe ueolt  2xr(o no1ameelivi s)arumuro;u4tex ifctatls ea(mo;t0tlxrmf iydlaDrln o t0t2xrio3oodam e fvtat) 2tau poo0aetnifeiytlaDra(ms;u4 rtrmocoo1oa rli s;( trtoiopno1ap nmiei t)s2tr( ont1tet iietydfm2um(monu)teeomo oadfmDelues;t0trxm(rpoudolt liesltfaruaurpnu0tpt moeiaslaDuluvo;u4 renir to1faDeaies s0 2toim3oy1apte fesa(f Dua(rp;u1aleoif3tatfa eln o;t4tlxoif iotfmDelnvo;()srxrxm iodal e fvilt) rrrump;u4tpxn f3ild m ul(mp;u)arxnmrciydlaDeln s;s0t2trxm3no4lmte ictls)aDrm(ro;o4oeto ictysls ulums;u)aeenxocty1fp   u i (0s2xmimpoodol nmnvtlsf 2ur(  oo1olxniietydls elnmp u0arxoio3tydfmt  ivils sexoxm iu4amt lnciatf Drr(r ;o4tetnmi3iytfmDulump u4 etoxo3ty1fmDe ieo ()s2urxrpnodll n neia( s2urxrpnu1aexo iciasla2rl(vo u4tetoxrctodoptraivol() rtr(o3nydop n nvsasf 2tmumooo0altn o3iasla2ul( s (4trenir3iydomtr nvs t0 2toxm nu4om emncsas sDrmxmpot1tleomocilt mDrlums;(4 rxnxf3oodoatelu ilt  rtmio3iu1apenlnvtlt) Dua(r ot4olen feiltfs eauvs t0areomf3iytlat ln s;t sexmxr3iu4ol nlneil()a2umxrp;u4aetn ictatfm2elu onu0 leriocoo1lm r ivsl(0s2tmxmpou1ape lici () Drmu  ;t4tet mfeiatls rmuvs u) eermr3ootlaD an s t0seumxmpiodome  fcilsfs2ur( pnu1aeeomf3ias m2ulnvs (0treoxf3iydlpD an ols  eumirpnodom nmnetl( arumu  no0tlt io3iltla2ran o;()aexomrcoy1fa elu o;() eumxm3oy1lptemivsat)sDtru ont1aleomo3iasfaDrlnvs;u)teeoxr3tydfpD auvo;t s2tmir3nu1opeemfvs t  Dtm( pou0apenmfctytfs2rm(ms u4tlxrir io1latrlu s;( srxmio iodomtemnctls)srtmx  ;t1tptomictltla2el( s;t)treoircoytfm  lues s)t2xmio3iu4am n icias)s2rm(monu0tpen o3ild aDrlums u4aetoxr iadomDeanes;s0tetoir no4ll n nctls  ruaxmpno1aexo octltla2rmnvpn()teeriocty1omteluvo t0srur(m iu4ll elfeil(  Drrumono4tex mf3iyslsDelu o t)arxoircoytlmDeauei;s0t2xm(r ny4amtnmfctatfarumx ooo4olenifciaslm2rlumpn(0tlxomo ty1lp e ieo;t)srtoim3io1lm elfcsas) 2tm(mont0oexoif3tltlm2ua( s;(0 rxomr3tadoa rluvo;s  rtoxr3ou4alee iet s)srrrx pnu4texomietyd aDra(mo;u0alxoio3iy1fmtrli i;s  euoxo oo1amen fvs s srurxmo;u1opxoio3iltls2umnmo;()texrxo ta1laD luei;t)t2toio oodll nlfesa()a2rr(rpnt4oexoiiciyd m2rmnvs;t4treriociodla rluei (0t2tm(r3nu4lp nlnct () 2taxro;t0tlxnmfciys mDea(vs;t0aetrmo oydomtraieilt)t2urim oy4optelncsltfa2ur( oot4ope mieiad m umu onu)alxrio oodfptrln i;s  2trirpio4lpeelies (f Drrxrpnt4olxoifetydls emums;(4texrmf3iatlmDr i o;(  rtrxm3no1omtn nvils) Dua(ro;u0olxnmoetyd a2rlnvon(0aleoxr iadfpDelivo;s0s2toxrpno1omte nvtlt  Duaumont4ope moetydla um( snu4arermrctatoa rln o;(0 rxmxm3nu4am  mfcias s2ur(mont4oetn ociltla rlu s;(0arxrmocoydomt  uvo s0srxoim3nudll  lnvias a2um( ooo4open oetlsfsDul(vs (0 lxrxf3ia1lmte uvo;t) rtoio3iy1oltelicsat  2rm(mpnt1apxn ocildlmDuaumo;()altrif3tadfat  i i;t setr(opnu1altnmics (fs2um(m no4aleoifctldfm2emu s;(4 rxrxf to1fm elu slt  rurxo3nydaptnlfvsat)arumxrpnt4aexnmf3tltlmDumumpnt0trxomoctytop r nvi;s t2xrio3nu1ol n nvslt) 2tauronu1alt  octlt aDumu s;u)aexoxf ootlp   uesls  2um(m io1lpen nei s s2rr( oou4aptoio3iydls eln p;(0areoio3oydlmDrli o t0setm(o oy4alt  nvi s) 2ua(rpou4oetniiciaslmDrm( s;t0 exrir3iatfmD  ivilt) rxrirpiu1aptelivslt s2uru onu1openioeiadfa2rlums ()alxoxrcto1fpD  i olt)teur(mpio1ame lfet sfsrra( p;t1opto ictlt a2rm( o;u4 eeoxr iydomtelnvi;s trtm(m ny4opt lncs t a2um(r ;o4tee mi3iltfs2el(mp t) leoxr ootoat ai i ( t2tm(r iy4ole lfeilt) 2uaxr nt0alxoif3iyt aDemn s;(4 exrxrciytlpt lueo;t) rxoxm3nu1ame lnvtltf Dtru p;o0olxomieiysfaDuanvp u)aeerxr3oo1lat  ueo t0s2xrirpno4olee net (fsrrrump;u4tlto ieiydfa2um( o;u0tetoxo3iy1oat  ivo s0s2tmxr3iydlp nlivtls) 2tmxr ;u0olxnif3iysls2rmums u4arxomf oydfmt anvils  2xm(r3nodomte ivt s  rrmur oo4opt mieiasfaDum( pn(0tlxnifcoa1fpt li o s)seum(o3iudop nlfcia()srrauro;t1tltoifeiysfsDrl(mo;()alxrif oo1fatr u ols  2urxmpiu1lp nmiet s) rrm( o;t4oeeniicildlmDum(mo;t)aetomrcoytfmtrln i;s0t2trxopiy1apee neilt srrr(mont0tlt if3iasfs ulu o;(0 ltrio3tadla eln slt  2toxm oudopt  fesa()sDtaxrono1tpeoiieiasfm eanms t4alxrmocoo1oa elnvo;(0srum(m3nu1lle  nvi s)s2rmx poo4aetnmi3tyd mDua( s t)aexoxo totfaD auvo ()t2urxo3io1apen nesat  rrmxmpno1aexoio3tltfs2eauvon()trenxrcia1oat livs () ruoim3oy4aptemfvs s a2uau oou0oexo feiltfm ulnvo;u) rxoxf3oytopteln s s) 2uoio oodole lici s)aDtauroou0oee ifeiat a2rmumo;u0 ltoircio1lmDrauvi ()s2uo(m nodlle lnvtltf 2urxm ou4open feiadlsDum(ms ()altnmr oydfaD  iei () eurxr3nydlpt  fvt s) rumxm nu0aptn ieiyt a2ua(vsnt4tltnxf tytlp rau s;( s2toio nu1omt  ivta(fa2ur(moou4tpt mi3iasls el(vont4alxnmr3oo1op   u slt)truoiopny1om nmfvt ( arumxront0apx  ieiltlm uaump t4 lenmr3ia1lp r neslt0seumxmpoy1amte feiasf 2uau onu0aet mf3ildfaDean s;()aeerio3to1fm r i o;( srurxm oo4opeemivsa(f Drrum ;t1apeoii3tatfm rmnvp t)arenir oydoa  ai ils)trum(mpiu1opt mncs t s2um(r ;u1aptomo3iatfm eluvo;() rxrif3ia1faDrln s;t)srxoim nu4lpeelfvsls s2umu ont1openmfctatls2umuvpn()alxoio3iytopte ivi;() 2uo(opnudlptemfci t) rur(moou4aexo f3iys m2emnmp;t4 rxnxf3io1fatrli sl( srumio ou1optemfvi sf rrmurpno0aptoifcils sDea(mp u)tlxomoctotlmtr ueo;t srurxr3no4apenliei ()aDuau oot0tee mociatfaDean pnt) ltrxo oydlaDrau il(0t2ur(o3iu1ap elncil(fartmu  ot0aet  oeiysfa2elumon(0 etrxrcty1op eaneo t tetoimpny4oltnlicsa( sDua(r oo0openmictyd aDulums t) ltnmf3oy1fatrauvilt0srurxr nudll e ieta(f 2ra(rp;u4texoiieiasfs2ranmpnt0tltoxr3iy1laDranvs;s0 rtriopiydlltnmiei t)a2taxro;u1apeoiicild mDul(mo;u4alenmr3to1lateai o s  2xrxrpoudlpt lfvi (faDrrxr ;o1opxoio3iatfa umnvp (0tltoio iy1lmtr uvs t)s2ur(opou4ale  ivtl(  rrmurp;u0ole mieiasfsDrln ont)areoir iadlp  auvils0sexmxo no4am   ivi ( srta(m nt0texoifctytfm rlump (4altnmf3iy1fmDe nvo;()s2xm(r3ou1lptemfvtlt) rumu pnt0ape moctadls umnmpnu)alenmr3ty1opt luvol(  rtmir nydame  fvi s  Dua( ono4texomi3tys aDrmu snt0trenmf tatopDr i o;s0 rto(mpiydomenlfeslsfa2ururo;t1tlxoiieiyd sDemuvo u)trxrxr3oodopDeluvs () rur(m3nu4altn fvsa()s2umxro;t4alt  oeiyd a emu o;t0aeerio3oatlptraueils)s2um(o3oodom  mnetlt)sDtru pot1opx mictytfa ranmo;()tlenxo tatfp r i ilt teto(r oy4optnmivias)a2rmu oou4openii3iyd a ulnmp;()texnio3oo1fptelnes;s)srtmxo io1lmtnlnviat)a2rrurooo1altnmocildla rlnms;u0tlenxocta1fpD  ues;t) exmxo3nu4lm e nvsa(f 2um(mp;o4aeen fctlsls uauvp;(4 etrmr3iydlmDrlnes t  exoim3oo4omen nes s  rua( poo1tlto fciytls eaumon(4tleoxrciydlpDranvi s s2trir3ou1al  lncs ( s2rmu  ot1oexoifctlslm2ea(ms (4teermr3oo1laDrauvs;s  rtrxrpny4lmee fcsls  Dtaurp;u0aetnmociytlmDumuvsnt0areoif ootoa   ivs s trtrio oodlptnlfvsat) Dtrxmpnt0oetoii3iatlm ra(mo;()teerio3ootoatraivilt  rtmirpoydaltemiet (fs2rmum ;o0tpenioeiysfs2ranmsn(4 exrmo tytfmDe uei;s0t2tm(o3iudllte ivi ( sDrruro;o0tet ii3ilsla2emnvont)treoxfcty1oat ln sl(0teurio3nydlmt  ncia(f 2ra(r nu1ale if3tlt mDrmu o (0aeeoxf3ootlatr i i ()texrxr nodlme lnei (f Durxr ou1tpe iieilsfs rlnmonu4trxnxoctytlmDrau ols)texoim3oo4amenlncil(fartax ont0aptnii3ilslm rau pnu4 exnifcia1la  an i (  etrxrpio4lle livs t)sDumur nt4tlx  fetltls2rln o;t0trerirciytom rlnvs;() etmir3oudom  mfvils) Dta( oou0tltn f3tys sDranvs;(0 exnxrcoy1om  aneo s trxr(m io4lp elneilt) Dta(mo;u4oexnmi3ild s elnvsn(0 etoxo ta1lmtelnvsl( sruoirpiu1opt mnesas)aruaurono1alxn fcias s2rmnvp u4arxoioctadfpt an s s)trtm(opoo1ame liviat)s2tm(mont0alt  iciad sDrmumo u) lenmo3oytopDeanvol() rurio ou4oltelics ( srrrxrooo1tpxo ieilt m2ul(vp (4aexoxf3ty1fm  lieolt  ruoxo3ou1op e ivtl()srtmu poo4tpx if3iadfs eau o t0aeeoxr3oydfat  n sls srxm(mpiy4am n fetas)arta(  ;o0alt  feiatfmDumnvpnt4texrmr3iodoa r iesl(0t2tmim ny1ame lfcta(f 2rmxr nu1oexnmociytfa rau o;t0tlxomr3iodlpDr nvilt teum(o3nodlpeemiesltfs2ur(r nt4tlt moetadfs ulu o;()alenmociy1op eauesl(  ruoxm oo1ale mnvil(fsrrax p;t4tlxnmfeiaslsDrmn s;u)alxrir3oa1faDranvi s srxriopio4apenlncia(fsruru p;u1tpx moeiad mDeauvpnu) leoxfciytfa elnvs;s)trtrxo3iy4lm emfcs ( sDtmumooo1aexoiieiysfs2ulnmonu4tltrmfctytlp  auvols)seuo(o3io1lmtn fvia()a2raxrpot0ole iiciltfa2emnvs (4 ltrxf3iadfp  ln i;t  euoimpno4lpt mfctlsf rrmxm oo4tex moeiasfa umnvo;t0texomociotfa  aneol(0seuoir3nudlpt lnei s aruauro;o0oltoii3iydla2ulu onu0tetoxo3io1om  au o;() eto(mpou4ol e ncsas)arra( ont1oexn octls s ea(vsnu4 rermr3iydfmt anvsl(0trxm(r3io4lleemivt s)aDrmumpno1aexnmieilslsDrmu p u)arenxf3oytla rluvo;t)seuoxo oudal nmies t)a2trx p;t4tpxnmf3iadfs emnmpnu4tlxrxo io1fp r nes s) exr(m ou4alen nes t)s2ur(mpnt4teenmfeiatlm2eauvp (4arenmr3oodfmte i s;( seuo(rpiu1lleemfei s)sDraxrpnu1tee  o3iyt a rmums u)treomo3oatlp   nvs;(  exoxr oo1omte nesls a2rmx  no1apxn feiadlsDrl(vpnu0alenmociytfmD  n ilt0srtm(m3io1ameemfvt (f rtaumoot0tex mi3iys sDeau o;() eerxo3iotfm r n il()sexr(r3oodllt mfcta()aDur(  ;o4ape  fciys s2rlums u0tleoio3to1lptrai slt0tetoim3ou4amtn iesls a2uaxr nu0oltoio3iysfa eln p ()artrxr todfa elies t0s2urxo iy4olt  nvtas) rrrum ;t4alxnmictyd a ea( p;u4tltomrcoo1oa   nvsls0 2xoxr3oo1oltemnvsl()a2tm(m nt1apen oetltfs umuvpn() ltoifciodop eaues s0s2xoimpio4lm elietat arra(m no4teeo fctatfm2uau p t0alerxr iydlmt  nvo;s s2to(r3oy4ole mnvsa()a2rmurpnt1aetnifetlsfsDea(mo u0 exrxoctytla rauvi s0sexmiopnodalte ncslt sDurxrpot1opxn icild s2ea(mo;t0arxoxf3ta1fpDran o () eto(m3iodol n fesat srtrum nu4tpeo f3iadla ul( snu)areomf3oytop eau i;()texrxr nydlpte ivtls  2rm( p;t4aetomictadls2rmu o (0 lxnir ty1fpDeau i () etmir3oo1amtemietatfsrrmu o;t4olto ieildlmDuluvsnu0 eermf ta1fp  anvi t  etr(m3ny1lm emictasf 2trumo;o0teeoiietydls el(vo u0tetrif3tytfat ai ol( truoim3iy1lm elivtlt)a2rr(ro;o1tetoifctytfa em( o;(4arerircoydfmtr i s;( teuoxr3iudolen fci sfsDuax  nt1alto f3ilt s rlnmp;(0aeenmo3todlatr ivi t)tetoio io1ll nlict s) rtaxm nt1altnii3ilt aDel(ms t4areoifcoatlaDeaneils)t2umiopoo1olte fet sfsrtaumo;o1opx  ictlsfsDumu o (4aexoif ty1op   u o;s)trtoirpoy4om nmnvsat) Dum(  no4teeniociyt s2rluvsnu)tlermr oytlaDrauvs s)setrirpnodapee fvta(fs2umxr nu1aexomf3tld m eau p (4trxrmr3oydlmDr ueol()t2xmxmpnu4optnlfcilt srum(rpnt4altoioeiyt s umnvp ()alxoxo3iadlm  lieilt seuo(o io1op   fvta()sDtaurpoo1apxnmoeildfmDumuvs;u0 renmoctytlaDean il(0setm(mpiy1ap nlfesatf 2taumonu4tetnmociadlaDelnvon(4 lxrxocio1oa elnvsls0trtrim ou4omenlnetl() Dtmumpnt4tpxomocilslmDrm(mo ()trtoxf ootfpDr u ols)texoim io4apeelfvi t)a2uaur ;t0tlen i3ilsfaDra(vs t0arxnxo iydfmte i o s0s2tm(r3oy1am nmivsltfarraxmono4opt mociydfa2rauvs;() renif oy1lpDe nvs;(  rtoxmpiy1alte fes t)sruaurpnt4aetomfcilsfa2rluvo u)texriocootoaDraieslt)trxrio iy4amtnmici (  Dumumpno0tlt io3ildfaDelnvp;u4 reoir3oodomtr ivol( texo(r3ou1ope livsas sDra(ro;u0oltn octad a2ulu o;t0 rerifcootoa eluvs;s setoirpnudal e ivi sf rumu  no4apen ictltfa2rauvs u4 lenxf oa1lm r neo (0 rxoio3oy1ll  mncs t srta(mp;o0aexnmf3tlslaDel(msn() etrxfciotfat  nvi s  2toir iy4oleelieil()s2uau  oo4altnif3iasfsDrl( ont) rerxf tytfpDe u i t0sexr(o3oy4lltnlneta(f Dtax ont0texo fctydfsDeanmpnt0aexnircto1om r iei s trxoim3oy4omenmictlt sDuaurpoo0olx ioctyt aDra( pnu) ltnxrcto1optelieo s)s2urirpiydlme mfct () 2rrxmoot1opt  ociytlm ranms u4 ltnifciotfmtrluei ( seum(o iydol  lietl(  Dtmxr ;u0aex  fctldla rmuvp;u4trtnio tatla  lieslt  2xr(m ny4amte ncsas)aDtmum ;u4apx  feiyd sDemn s;(0 rerxr ia1omtraueol( s2umxo io1ol  lfvs tfsDta(m no0oet moetasla2el(vp;t0 ltoio ootfpD  n i;s0trur(mpnudlpee feta(f Durxmo;u1oetnii3iadfa elnvo u)tltnir todom rlivo (  etoio ou4op   ncslt)aDtmu o;u1teenmi3ilslm2ulnvo t4tlerio oo1oaDrauvs;t0 rxrxr3no1lpt lfcta( arur(mo;t4ale  o3iydfsDrl(vs t)areoir iy1fmD ai i;s s2xr(r oo4omt mfcslsf 2rmxro;u4oetnii3tls aDem( on()trtoxf3tatfpt auvi t0srum(m3oo4am e feia( a2rr(mpno4tpxo i3tlt sDumn onu) lenmf3iy1lp eaueo t s2tmxm iu4ll e nvi (fsrrau  nt4teeomictld sDem(vp t)tetrmocoadfptrlieo (0srtrirpou4aptelncslt s2rm(m nt4tlen icilsfa2em(mpnu4tltrir iy1fp r nvs;t0t2umim3oudam e neia() rtrurp;o4olxoio3tad s2em(vp;u)texrxrciy1fat  nvols)teto(mpiu1llt mnvs t) rtmxrooo0opxniociytlaDulnms;t)alxnxf to1oa   ieil()teuriopno1omenlfci t  rrmump;o1tetn feiydfs2ra( snt)tltoxo tadoate uvs;()seumir iy4aptn ncsas)a2rrumpno0tltnmieiatla umuvs;()aetoif3tadop  auvi t)trxmir oo4alt lics t  rurxmpou1oet  oeildfs eln snu) eerioctytfmDr ivols)t2urir oo1olenlnes s)srrmx p;o1apx ii3tys s2uluvs t0 rermr oadlpt  ies t0s2urxo ou1ape livtlsf rtmu p;t0apxnifeiysfmDrmnmo;()tltoiocootlmDraivi t sexo(opiudlptn ictlsfsrta(m nt0apt  o3tydls2um( pn()tltoxf3oatlm  lnvi s)truo(mpny1ap  livil(faruaum ;u1aleo f3iltfsDelumpnt4artnif3oadlm eanvi;t)t2umxm oo1ape lfcsltfs2uaxmoot0aee  feiadfmDeln s u)alerio3iytlaDe ieo s sexm(m iu1ol nmfvt ( aDrr(ro;u0opx mocildla ra( sn(0tlxomr iodoatrauei (0s2uo(mpnydal n iei t)arrmxmpno1aptnmociytlaDrm( s;t0altoir3ty1lp e nes t tetmim3nudlptn nesls  rtrurooo0tlx  ocilslaDuanmp t4trxnmfcty1opteln o t) exrxmpno4lmeelncs s)srtr(r ou0tlxniociadlsDumu s t4 ltomfctatlpteau s ( srxr(o3iydop  licil( a2tmu  nt4oeenmictadlmDuanmo;u0aeerxocoadfatelnvsl(0 ruo(o nydlmte nvsl(  rurxmoou1alx ii3tytfm elnmon(4aeerxrctatlmteauei ( teto(r oodll emfvtls srrru onu1tex if3ilsla2rlums u0texnxf3oadfpt  ieolt0trtoimpnudome  iet tfs2ua( o;t0tptoiieiltls elu s;()alenxo3oy1lm  anei;t0t2um(o iydap elfvt s)aruau oou0apto f3ilslsDelnms;t)alxomo iydfa   nvi;s)texoio3iy4altemict (faDumx  ;t1tlxnifetysls eanmp t4aexnxrciatfmt  ueil() rxoxm iudam e icta(f 2tr( ont1olxnmietyt s2el( s;()tetnxf ia1optraieo;()trto(r oo4lleemivt tfsDrmx pnt1tet iocildfsDumu o (0texnif io1laDeauvi;t trtmim io1apeelfvs tfarrmxrpnu0olt  o3tadfm rm( s t)tltrio ootfpt auvi;s teuo(o3iu4llen fvsat)s2uaxrpnt0tle iieias mDum(vsnt0arxnmfciytopDelivsls)teuoirpou4opt mnvslsfsruru  ou0opxn fetysfaDrmu p;u4trxomr ta1fpD  u sl(  euoimpiodam nmnvia() Draxro;u4aet  f3iad s2um( s () lxnmociotfm e uesls)teuoir3iodoptnmivsa()a2tm( ont1tetnmfctldlmDraumo u0trtoir tatfm e neils0 2trirpiu4ap e fcilsf Durxmoot1oltn o3tadls ra(msnt) eenxfcio1fpt luei;()tetoirpoydoltemnvtl(  Dua(moot4opeo ietatls2ul(vs;t4trxoir3oytoatran i t)srtoio3oy4lptn nes t sDumum nu0tlxn oeiysfm2rl( s u4tlerio oytlmt auvi;t0 rtoio3nydol n nes tf Drmurpoo1teeo i3iat a ranvont) rxnirciatfm  au o;s t2xm(o3oy1om e ivs s sDur(r oo1aetn ieiat a ua( p () lxrxfcio1op  aieolt0srxoirpny1optelnesl() Dur(m ;u1opx mfeiltfs emu sn(4 eerxfctodoaD li ils0srxo(m3iu1opt  ivt ()arrau  nt1ape  ociatla el(mp ()aleoif3oydomD  neil() rxr(o ny4lpte nvi tf 2ua( pou1alt mi3iydfm2ra(mo ()aeerxrcty1lmte neols0teto(mpio4lm nmfctl( sDuaxrp;o4ale mictls a2ea(vo;(4alxrio3ootfate ieo t0srxm(mpoudaleelfetas)sDtm(root0oee mo3iltlaDemumo;t)aetnxr totomtranvil()srtr(r oo1ope mfvi t) rtm(moou4olx ifeild sDel(vp;t0altomf3to1fat aivi ( s2um(rpnudlm   icias)s2rmxm no1tpe if3tyt s2rm(ms;t4tltomo3iydlm e uvi t0srxmiopoo4olenmnvtas  2tau  nu0apenioetaslm2umnvonu0tltomoctadlp r uvsls0t2tm(opoydlptnmfvs s)srumxrp;u1aet ifciad aDranmp;t)alxomf oadomtr nvo;t  2tr(r3nu1lle  ivt tfsrua( ooo0olxn i3iyslm rmu snu4arenmo oatlm eaiei t)seurxr iy1lptnmfctltf Dtmxrp;u1tpen fetat m rmumont)aleomr io1lmteauvol(0setr(o3iy4am nlfvs tf Durxr ;t4oexoiiciadlaDrm(vo;t) renir3to1fpt livo;(0srto(mpiudlpeelnctatfa2raurp;t4ope miciys a uauvo;u) rxrmfcty1fpt lieo (0 rtrxo iudap  mivtlsf rtaur oo0ope mo3ild mDra( p;t0 rxoio3oy1omte u s;t)trumirpnudllenmieiltfsDrru pnt0aex iictadfsDumums;t4 rtrioctytfa eluvs;(0seurxo iu1apte iciasfaDtmxmo;u0alt mieiltfs2em( p t) rtrmo ty1fa eau slt0tetmxmpiudolte fcil( sDurumont1aex miciys m2eauvo;u0aeeriocoatopDe ivols0tetoir oo4al emietlt sDuau p;u0aeeo icildfmDeanvpnu0arenio oy1fm r i o (0t2xo(opny4oltnmiet tfa2rm(mpot1oeto ictydlm2rlump;u)tlxrmrciodfa rli sl(0teum(opnodlmtemiesa(fsDrr(moot0aeenmiciasfmDua(mo (0arxnxf3ootlpt  ivo;t s2to(o3ou1lmtnmici tfs2um(mpou4tlxniociyd s2rlnvo u4alerxr oa1fpte neil() rurimpny4lltnmnesl(f Drm( pnu0alxomoeildla2emu o;t4trenif iadfmte u slt)trtrxo3io4lp  lncs t arta(m nu1teeoio3iltfa ul( s u4arenmo3iy1fmt  ivi t0teum(m3nu4amtn fcslsf rum(mp;t1optoifeiydfm rmu p;(0trtoirciydlmD  nvs t0srurxm3nu4al e nvtlsfsrtr(  ;t4opxoiociysla2el(mp;(0arxnif todoate u ils) rumirpno1ol nmnvtl(fa2trx o;t4teeo o3ilsla um(mp u4artnmo3io1lpt  nvi;t0srurxr3oo1al nmiesltfa2tax  ;u0ope io3tltfm ea(mo u4altrxr3tadfaDr u ols0t2umxopoydlpte fci ( s2tmx  ot4ope  oeiat aDranvo ()tlenxfciytomDe n ols0s2umxm iodome lfcilt)srra( p;u4altnmieiltfsDumnmpnu0areoio tytla eln s s)t2urxopoy4ope  nvtltf Dtr(  ;u1ape  oeiad mDemnmo;()alxrxo tadlaD  ies;t setmim3ny1ape livils)sDtmx pnt1tlxnii3iys mDelu s;(4trtnxrcoatopDeanvi t)srxm(m iu4llt lieiatfa2tm(rp;u0olx  oeiytls eanmpn(0 ltrifctatfptr ueols sruoirpiy1lmee fvsasf 2tmxmpou4aeenifeildfaDumnvs u4areniociy1fmt auesls tetoim3iy1lp  lnvs ( sDumx onu4tltomfciatlmDum(vs u4trtnxo3iydlpt an i (0t2xmxr iu4llenmnvtl() rrm(rpou1olxn f3ias s2ea( s;u4 renir3oatlm rlu ils srtr(r3oydlltnmfesl()a2ra(  oo0aleomo3ildfsDemn onu)tetomfcoo1opt luvi;s)trumxmpnydale mieiatfarumurpnt1texnmo3tasls eanmpn(4 eeoir to1oaDrlnvils)trxmxr no4omt lics s) 2umxmpnu1olxo ietlt mDua(vs ()aetnmfctydlp e ueo t t2toxo3ny4llenmieslsfsDua( pno0tlenmo3iysla2rlu p;u)teeoioctatfmte uvs t)s2xrxr3ou1om n fesatf rua(mpnu1tlxniietadlm2emump t4tlxnmr tadopteli s t)trxmxm3nu4lmen iciltfsrurum oo4optnmf3iat s ul(vs;t)trtnir3iatomt  ivs;() eurir3iu4altelies s) Draumpot0alt  f3iltla ea( snu4trtnifctadfaDe nesls s2urirpoy4ameemfct (fa2ur( o;o4oetn o3iydfs rmuvo;(0tltrxf3to1optr u o;s t2tmio3ou1ameemfeiasfs2tm(  ou4tlto feiad s rlnmp;u0aeenir3iotomtr nvs;(0srum(o oudoltn iei s aDum(rpou4oee  ociatfa2um(vs t0 rxrmr io1fateln o (0 2to(o oo4apenlici t  rtau  ;o4tpeomf3iasls2umnvs;()trtnmr oytop eanes;s)sexoxr ou4oltemfvtl(  rur(r no1oetoifeiaslmDelums (0tlxnxo oadoaD aieils)seumio3oo1ol nmivilt aDrrur no1aetoif3iaslaDean s t4tleoio oy1lpt luei t0t2uo(r3oudal nmnetas) Dtmumont4oex mfeiad s2eln snu4 lxoxo oy1op  liei t t2to(mpoudlm e ivsls)sDtmu o;o1tptn oeils s2el(mp t4alermf3iotlmD ai i s)truo(r3io1lle lnet t aDuaxront0tpx mfeiytlsDrlnvpn(4tltnmo oatoptelueo () euo(opnudal emnctasfa2rrx  nt1olx io3iytlm2ean s;t0aetnmr3oydfmtrli sls0 2ur(o ny4ole liet ()sDraurooo1oltnmictld a rln o u)areoxo oodop r neols) 2uo(r oudlle lncs (f 2rmx onu4aexo ieilsla rl( o;t4 eermf3iotlaD livs;s t2uoir iu4op e ncia() rrrxm ou1ope mo3iltls2uln o;t4 lxoifcia1faDrlu i (0 ruoxm oo1lm emies (f Drr( o;t1tle  feiaslsDuanms;(4tltrxfciotlmtelues (0trtm(m oo1ap emncta(  Dtr(rpnu0olenmf3tytfa emnmsnt)teerxo iotoa elu s s sruoxrpnudlpeelivsat arurumoou4tet ioctasfa ea( pnt)aeerif iotoaD au sls texoimpoudome livilt sDrrxmp;o0oetomf3tlsla uanmp () ltoxo iatlmtrauvs;(0 rtmio3ny1llt mfcs (f rtru o;o0tpeomoctyd mDrau p;t4 ltomo3ootlm  li ol()s2to(m ny1omenlneias)arrru ono1aexn fctytlsDrmu o t)tltoxociodlmD aieo t seumirpiu4ol e icia(fartmxrono4tpe ioeilsfaDemuvp;(4arerxr oydlpt  u o s)srumio iodopeelivsatf Drr(rpnu4tle  oetysfsDran s;t) etoxr iotfa  lu ol( srxo(r3ny4lpeelfet ()a2ur(r ou1aetnifetatfa2ranms u4tltrmf tadomD  u olt0 euoxrpny4alte ietas a2rr( pou4tptniieiydfsDumnmo t0 rxrmfctadlpD  ieo;() 2xrxo iu1lle mfvsl( sDrrxmp;t4oetoifeiatlm2ulnmp;u0alenxr oadlmDraivo;s) 2xo(m iudlpen iesasfsDrmx pou1tetn ociatls umn pnu0tetrif3to1optrai sls0s2toxo nodllenlnvtlt  Draump;t4tet  i3iatfs2uanmo (4 rxrmo3oodfat lneils) exr(r3ny1am   iesatfaDtr( o;u4aexoif3ilt m2rmnvp;u4trenxf oa1fmD luvi s0t2trirpoudolee nviasf rrrumpno0tleomoctldlaDuaumo u0arenxr3oy1fp rai s (  2xm(mpou1oleemfvsa( aDuaxmoot0oeen iciysfa ea( snt0 etrmf3iy1opt anvs;(0 2xoir3iu1olt  nvt ()srrmxrpou1ope ifctltlsDemnmo;(4 lermf3ootlatraueo s0s2tmxm io4lle  icsas) rrruro;o0openii3iasfaDrauvsnu)alxnxocta1fmDe i o;t0seum(mpnodom nmfet s a2trxront4tet iietltfsDea(vs;u4texomr3tadomtraueo;(  etmxr3ou4llt  fcslt)srrmum ot0oexoioetadfs2umumo;t0 rxomr3oo1oateaues t0truo(opnu4omtn iviasfs2rr(  nu0tleo octad s2um(vo ()teenmo3oy1omD lneols)sexoimpiy1aptemfetlt  Dtmu pou0altnmoctltla2emuvp (4arenxfcto1oatr u i ()setoio3nydlp   icias srtaxm ;u4texnmi3iadfmDuauvo;t0 ltrxfctytfa eluvs t texrxr3ny1am nmnctl( a2taxmpot1tpe ifciat s um(vonu4arxnxo3iy1lm elueo;t0 etmxm3iudap n fct t)srur(mono0aetnmocilsfaDelu p u)tlxomf oadopDraivs (0setoxm3iu4apeelnct ()aDtrx ooo4oleo fcildlsDuauvo;t0texrmf3io1faD livils)teumxopoo4ame lieil( s2rr(mont1aexniociys mDranmsnu0 ltnmo3oydfa raivo;t) etr(m iu4oleelfei t a2tax  oo4olx  f3iysls rmu s;t0 leomo oatoatr u o;t)srxr(m3nudal emivtat)srta(m ;t1ope ioeild m2rm(vo;u0trtrir3iadom rln o ( seuoimpiu1omtnlncias a2raxront0oleomoeiydfmDrmnvont)areoxr ty1omDe ueols0 2tmxopno4am e ivil()sDta(mp;u1aptoio3iatla2eaumo;(4altrxo ta1lmD auvo;()t2xoio3iy1lpen fcslsfsDtaxrpno4apxomi3iaslsDumumont)artomf tadopD lnvs (  2tr(r io4openmfcsl( aDuaum no4tle moeilsfmDulumsnu4treoiocoatlaD  ies (0s2uoio oo4lp e nes tf 2rmumpnu0tlt  fciyslaDel(ms;u4trenif3iydlat  i o t trxr(r3iu4lp n icils artmxm ;u1opxomo3ias s2eauvs;t)arxnircoo1optrlues;(0t2xoxr3iu1llte fvi (fsDuaxroou0oexomieild mDuln p t)alxrir3iotlmDean i ( s2tm(opoydol n fcsat) 2rmx oou0aptoif3iad a2um(msnu) lerif oadoa elivi s0tetmimpoy1lm  mici t  2tmumpnu0oex  ieilt a ua(mo t0 exnir3oytfmtrlivi;s trxmxo oo1lpe livils  2rrurpou4tpen iciytls2eaumon() leomf3iydfatr ivo;t0t2urir3oudolt mnei t  ruau o;u4tlx if3tltlm umuvp;()tlxrmr iytfmt aneilt0trur(o3nodal e ictls)a2trumo;o1oltnmoctlslmDea(vp;(0tltrmrctodfaDe ues;s0trtm(r3nodamtemieil(fs2raxmp;u4tee io3tltls rm(mp t0aeermo oo1lmDran s;s  etm(opnudome mnci (  2tru ooo4alenmi3iad a rmu p;(0 lxnxr3tytlat ai il()s2triopno4op nlivs (fartm(m ;t1tee iictat s2umuvon()trtoioctadlmD  ueol( tetrxr3no4lleemfvtasf rur(mont1opxoiocildfs2eanmpn()aetnxf iadfate ieil()s2tr(opiydomte fcsas) Draxrpno4olxnmf3iltlm2uluvo ()aetoxr3oodom rlnvs;( srxriopiu1lpe  nvs tfsDrmu  ;t1oltn o3iadlm rmu p;u4teenmr iotfpteluesl()s2uo(rpiudoptemfvt s s2rauro;o1apx ioeiatla uluvo;u)tltnmr ta1laDr u ilt  euoxrpoy1ome mnvtl( sDtrxr ;u1altnmi3tat m ulu on(4 exnxf iydfmt auvo s  etm(o3iy4am nmivslt)s2urxrp;o4tlen i3ildfa rmnvon()treoxf iatlpDrau ols  etoxm nu1al nmivt t)s2rmx  nu1oexoiiciydlmDrl(mp u0aetoxf3iadlat lu ol() euo(o3nodlm nmnvtls aDururpot1opxo ieias a uau o;t0aeenifcoy1lat au s;s0srtr(r oy4op nlncsa()a2ra(mo;o0tetoio3iatla rl(mo;(0 renxr iatfp  auvo t  ruo(r3nu4lle  nvtlt a2umxmont0apen f3tldls umnmpnt) rerxf to1oaD  ueo;s0srtmio ny1llte ics sfsDrm(m ou0oex mfcild m2rl( s;()aeermf3ty1fpDeaiesls) rxmiopny1op   fesas)srua(  ou4tpxnmoctld a2emn ont0trxomf todop eau s;s0t2tr(m3no1lptemivsas)sDumxmpnt1aetnii3iadfmDrlu p;u0arermr3iydoaDean s;s  eur(rpiu1ll nmneiatfsrtmxm oo4aexomicildfmDemuvonu) leoircootfa elneo ()s2xrio3iy4lm e ivsatfarua(mp;t1tlx mfetysfs ul(vp (4 rermfciy1fpDrlnvo (0t2um(r3no1ap   nvt t)aDuaum ;o4tpxnmictat a2ranvsnt4 etrif3ta1lateluvo t0 etr(r iudllt lfctl(fs2uau pno4tlxn i3ildfm2elums;(0artrxfcia1fptr nvo s0 exoxr3ny1ol n fcil()srraxmpou0tpxo oeiydls ua(msnt)trxomf tadlm r nei s  rtm(o no1lpeelieiltf rrau pou4alt mo3tydla ul(vo t) rermr todop r ieo;t)trxmxm ou4al nlnesls arraur ;o0tet ii3iadfm2elnmo;()altnmr3iytlm   ues;( t2xrxrpnodopen fcia(  rraxrpot0olxo ocilsla em(mp;u4aetrmrctytoptean sl( s2um(o oo1ale mivsl(fs2umuro;o0olxn feiydfm rl(mo;t4 lxrio3oodomteli s ( setmirpoy4lmt  icsa()artmxm ;u4olto oeiat a2ra( pnu) renmr iydopD li s s s2xr(rpio1ome  ncsa( s2rrx ono4tle  octls a2ra(vonu4 lxomf3tydfptrauvo;s0srtm(r3nydam elnet t)arumx onu1teeo f3ildls emumo;(4trtnmr ootomDr nvo s)s2uoirpoudom  mivi t)a2tr(mono1opt  f3ils aDulnvsn(4artnmr tydlpteli o;t0srtmxm nudllt lici sfa2raumpot1alxnmi3iyd m2eaumo;u0 rtrxrcoodfaDelivs;s)texoxr iydopenmivilt) Draxmoot4tet iiciltla umnmon(4 exrxo3ootfm  livo t0t2tr(opoydamenlfci s  2rmump;t0tpen ietydla2rmn p u0arxoir3iytla rlivols0 2ur(rpno4lmtn netat sDrrur nu0tltoiiciydfs ulnvonu0 lxrio ty1lm e i o;(0 2toim3io4lp emiei s)arra(mpno1tetnifciyt a2emump (4aetnif3iydoptr u i;s  2tr(rpno4lptn ncs sf 2tr( p;u4aex  ocildlm2uln s t4 rxrircio1opDr ues;t)trtmimpiudlltelnvia(fsrrru oou4olxniietydlaDum( pnt0artrio iadfptrlivo;s)t2xm(rpny4altnlivia(f Drmur nu1tpenio3tas sDua(ms (4 rtnmf3oodoa   nvo;(0seumxrpno1ope lfvsa(f rtm(m nu4tlxniictysla2ranmo;t4 etoxo to1latrai o t0setrir oy4opt mfet sfarra(rpnt0teto oeiatla umnvp;t0alxoxfctatlmtr nei;t)trtr(o3nu1ll  mfet ( arumx  oo0apxo fciyslm2eanvpnu4 rtnmfcoadfa ean s t)trxoxr io4ape  ivia(f rurur ;u1ape  iciltls2ulumo;t4 ltrio iotfaDr u s;t t2xmxm iu4ameelfetl(  Draxrpno0opx if3iyd s umuvs;(0aexnmfcta1fateanes;()setm(m3ny1lmen ivia( s2rr( p;t4teeoif3tldla uanvp () eermr ia1la elnei;( srto(m iy1lm  lnvtat)aDra(mp;o4oexn ieiysfaDrmnvo t)aeeniocia1lpDr iei s srxo(r3nu1ape lictasf Dtrxmo;u0tlxnmocilsfa el(monu4arxrio3ia1opDr i o;t)s2xmirpoydamenlnctltfaDrru  ;u1optn ietyslaDumn s (0trenifcoydoa  au slt0 2tm(opoodaptelivilsf 2rax  no4tpxnio3ias aDelnvo;t)tlxoxo3tytopteanes;t) euo(m no1ap elies t srrmurpot0ale  oeiat a2uauvpn(0tetoxo3oo1opte u i;t0t2urimpiydlltnmfeiasfartmum ;o1aleomfeiysfm eaums (0tetrif3iy1fptelnvi ( srurxm3ou1lp   ietat)a2raxrp;o1olx  i3tad mDran p u4trenifcta1fmDeauvil(  rtrxo3iu4lpenlfci tf rtmxm ;t0oexn oetatfs2eau o;u0 reriocoadfpDrai o;( s2toxr nu1olee ivi t)sDtrumonu1tee ioeilt m2ua(vsn(0texrxrciy1fpt aiei;s0trtrxr3nydameemfeta( artaumono4opxnifetatlm2uaumpnt0tetoir3oytlmDelu i ()trxmio io1ole mfvia(fsDra(mpno4opxomieild m ulnmsn(0 lermf ta1lmt aies;s tetoxrpoo1op   fvilt)sDua( oot0apenmfeiadfs el(vonu0alenifciytlm eaivils srur(o nydopte fcslt) Drmx onu1tlx  icilslsDeanvo;() rxrxrcoa1faDe ivsl() 2xriopiu1lmenmivslsf Duru  ;t1oltn fciadlsDra( snt4 eenmf3ootopDelnvo (0s2um(rpnudop n nvsat)artm(roou1alxnmi3tatls2rl(vo (4altoxf3todlatraivols0trtm(r3oy1lm nmfci ()s2tru  no1apto i3ildlm ua(vsnt)aeenmo tytlm rli o s)tetrxopiu1lmt mfesa()aDuru oou1aetn feiys aDulnvpnu0arerxf iodfa  li i s  exriopno4lmenmicta(fsrtrur no1oetomfciadfa2eanvpnu)artnmo tytfa rau i;(  etoxopnodomenliesls aDrmu  nt4aexo octytfs ul(vp u) lenmr3todfaDrln sl()trumxr3iudopee fvsa()a2umxro;u4oexo o3iytfsDean s;t)aeenxo oytfat  ivo ( t2xrxm nydlmtnlfcsasfs2umx pno0ole if3ilt m elu s (4 rtoiociytfaDeliei t) rum(r3nudameemfciat arrax p;t0tpx  o3iytlm ea(ms u)texrxo3iotfp elnes s  2xr(r ny4lleelivi s) 2tru o;t4altniieiyslsDuluvo u4artrmo oy1op ranvi;t teum(rpno4amtemnetl()aDrr(mpot1apxnmfeiaslmDrl(vo (4tleomf tydfpt auvols0seur(m3nydome lnetl(farua(ront1alto fetadfaDrlumonu) lerio3io1oatranvs;s0 rur(rpiy4am nmfesa(fsrurxr oo0tlxoioeildfaDea( o t4tlerxfciodlaD lnvi ()s2trxm ou1optelfes s)a2uax pot1olx ifeiydls2rl( pn(0texomf3oy1fat lu i;t0 2xr(m iydal  lfeilt) 2truro;t1tpxo o3iat aDel(mo;u)aetoifciydlp eluvo;()s2xrxrpiu4ol elnetatfs2rm( pno4oeenmi3tlslaDuluvo t)alxnmociatfmDrlu o;(0 rtmim iy1ope miesas)a2tauroou1tleo iciysfsDel(mo;(4 rxrxr oatfpDeaies t0texoim3iy4llenmfct t sDrrxm ot1opt if3iatls ranvs;t0alermf3ta1laDr i o t srxm(o3nodaleemfei sfsDumu pou1oex ioctadlm em( p (0artnxo3oydlpDr u s;t)setoxm3io1lp   iciat aDur(mpoo4tlt  f3iydfs2eln s;(0 rtrio3ia1oa   uvs;s srxrim no1ameelfesas) Dur(  no0ole moctydfsDraumo;u0texnxr to1la e uvi;t0 rumxr3oydaptemfei ( srta( o;t4apx mf3iadlsDumumpn()alxrir3todlm  lu ilt0s2xrim nydol elncias sDuaum ;t4altomi3ilsls2rlnms (4tlxomf3iytfm rln o;t0texr(r no4lp emfcsat sruau p;o0opx  oetatls ra(mp;u0 leoxf iydopDr nvs t0 rumirpiudol elicilt) 2trxmpnu1teenmociltfs2em(vp;t)aexnmfciatopDeai s t srtmio3iodlle lfctas)sDtaxrooo1aexoii3iysfs umn s t0 etrir3totoatr n olt) etm(o3oy4alt  ivs (faDtr(r no0olxnmieiyslaDra( pn(0teerirctatom eaivi;s0t2urxm ou1lptnmnct () Drmxmpou0opxomictad m ra(vpn() leriociodfm elivi (0 2tm(opnydlp elfei (fs2rm(mp;u4aeto ictys s2rmnms u4 rxrxr3tadoatraivi;t)tetoxr nodlltemneslt arurumpno1alt mfciltfa2rm(mo;t4 eerxr3oo1fpteau i (0truoxm3io4omt lfviasf rrr( pou1openmoeiasfm um( p;(0aleoiocoydop eluvsl( texmir oy4ol n fctas s2uaxmpot4tptn octydla rauvs;u0 lermf iytoaDr ues t0tetoxr3ou1amtemnctls) Dur(r ;u1apxoioeils a ua(vont) exrxr3iotlmte ues t  rto(m oo1olte neilt srtmxr ou4texniieiad a2emu o u4aetnioctadoatranvs s)setrimpio4lltemictl(fa2rau pnu0openii3ildlm umn s;(4alenio3oadomte neilt) euoim io1al nlfvtlsfartaur ot4oeto ictldlaDemumo t0 exnifciotfp   nvi t texo(m oodame lies s s2trx onu0olxnmoeildfa ulump (0 eenmrctydfmD  neslt0trtr(r iy1apenlncias sDrrur ot0alenifeiasfa emuvp u0texoif tydfpDrluvs;t) 2uo(r oudam   feias sDur( pno1aptn oeiydfs ra(mp;u4texrxo oy1omte nvslt0 exoimpiodlleelicslsf 2ur( pno4tpeo f3tyt sDelnmonu4 ltrmf tydlpte i o;(0 eto(o ou1ap emici sfa2uaxronu1tle mfeilsfa2rmu p u0altnif ta1oaD  i slt srurxmpoo1op elfvsa() rumuroou0oexo o3tytfa2uau pnt) eerio3ootlp  anei;(  ruoxr iy4ol  lics ( sDum(r ;u0tpto feiatfm uau pnu)tetrmr3tadopt livi;s0 etoio3nu4lpte fei sfartm(rpou4tpx mieiat s uln p;u4trermoctotlpt ai i;(0 exo(r3iodomenmies sf rrrumo;t0tpen iciydla uauvs t)teerxociodfp e nei s0 eumiopoo1olee icsltfs2um(mpno0aleoii3tls m2eluvsnu)tltrio iy1fmt aivo (0 exoxm3iy1llte fvs ()aDumuroot1opt iocias m uanmo;(0arxnifciatla elivs s)srxmiopnodole mfcta()srtrumpnt0tlenmoetlsfaDea(mp;(4texrxf3iadomDrlivils)s2uoio iy4olenlieta(  2tmx pnu0tle  f3ilsfsDrmnmp;u) lxrmf iydom   uesls) etmxrpnu1amtelncsls  rrm( o;t1aptomieiadfmDum(mo () lxoxo3ia1lpDe ieo;(0srumxm3iy1ll elnvta() Dtmxmpnu4tex  ietadfs um(vo;u)tlenxr oytlp  lueslt0s2xr(mpio4ll nlnctat) rrr( p;t4aee ifeiadfa2ra( snu)alxrxrctodfp elueo;t  2urxopoy4lpte fetls srra(mpno0oltoioeildlm2rlnvo;u0aetoifciatfpDr ueol(0s2tmimpoo1ol  lnctasfs2umuro;t4oexnmocilsls ra(mon(0 lxnio3io1opD  n i t) rur(r oo4apt mfvslt srta(ronu0aexoifeiyd m2ul(vo () exnif iytfaD luvils truoxr iudom n ietl(  Dtmum nu1aex ifetysfaDrmuvpn(4 lerir iydom rluvs;s)tetoiopio4alenmnesas aDurxrpot4aee  o3tat s ul( o t4altnmo oo1fp  lieo;t) rum(mpoy4ome mfetas)arta(mpnu0apeomociyslsDuan sn(0 etnif3oatfptelues;t teuoim3nydam e ieils srua(m nt1opt  f3tyslmDrmnmont0trxoxfcia1oatelieslt s2trxo iu4lleelieta() 2rm(mpot0openiictys m2umn s t4 exrmr3iotopD ai ol(0trxo(o3oo4ope  ncsltfsrrr(  ;o0tlxoioeiat a rl(vpn(4trtrif3oo1op r nei;t srto(m ou1omtnlfvsatfsrtm(  ou0tptnmfcildfs2uau p;u4alxrifcoadfpDr n o;s)t2xmxr iydal elietls)aDum(ront0tpeo fciytfa emumpn()arxnmociy1fpD  i ilt0 2xo(m3oo4ll nmivtls)sDrmuro;o4optoifeiyt a2ua( ont4areoxrcty1oa   n i s  exm(o3ny4lp  mivsatf rta(r ou1aexoif3iaslmDeauvs;()tlxomf3totlate nvi;s0seumxrpou4opt livsl( sruax pnt0ale mfciaslmDrl(mp;u)trenirciydla eanvo s0trurxrpoy1llt liesat)a2rm(m oo4tptnii3iat mDean p;u0aexrio oo1fpD auvi t srto(rpiydaptelnctasf Dtauro;o1oltoif3tysfa el( sn()aeenxo3oadopDe nvsl()t2tm(opoy4lmeemivs t  Drm(  nu0aptniictltfa ran o u4tetrmo3oadoat ai sl() rtoim iydape  fet tf 2tm(moou0tex moeiyd s2um(monu)altoirctadopDranvolt tetm(r3ou4llenliei s sDua( pnt0alx iicilsla2eln on(0aetnif oa1oaD  u i;(0trtmirpoodoptemfct sf Drrxr oo1opxo oetls mDemump (4 etnir3tydfmtrlnvs;() 2trirpoudapenmfei t) 2urx pnu4open feilt a ua( p;() reoxocoytlat lieo;t0s2urxmpno1lmeemnet ( aDumumonu4aptn f3tldfmDumn p u4tlxnxf oadfmD ai olt s2xm(m3oo1aptnmfvsl()a2uaur nt4opxnioeiydfs2emnmpnu4aeenmo iodlatrlnes;( trurxr no4omtelnei sfs2rr(ro;o1aleoiieiltlm2uanmpnt) rerxoctotomDr ivi;s) etrxr3nu4oleeliciatf 2rru o;u4aptniociytfs2ranvo u4 etoifcoydlaDe u ols)texoio3iydome  neilt s2tau oot1tleo ocilsls2uaump t4 ltrxo3tatfmte neslt0t2to(m3io4amtnmfvsls artmu ont1aex mo3ildla2ea(vp;(0teeomr3totfpt ln o;t t2toimpoy4ap  lncs s  2ua(rpou1tpt mo3ilt a2el(mp t0treoxf3ootfmteluvil(  2tr(m3ny4ope lnesa()sDurxrpnt4teto o3iyd aDrau p t4 ltnxf iodfp rln o;t) 2xrirpiy4ope livtasfa2rmuroou4opx if3tltla2em(mp;t0trenircio1fpte u slt0 rtr(o iu1amtemfcsas)arrmx pou0oee  i3iadlm rlnmp;t)arxoxf iodlmDrauvi t texoio iodal n fvils) 2tm( pno0aetnmieiytfaDulnmo (0trxnxr iytfp r u sl(0tetoir nodomt mivils)a2tr(m ou0tee ii3iyslaDeanvs u)tlxrmoctotlpte ivi (  eurxrpiydlpt lnesl()s2umxrp;o1aee ioeiydfm2em( s;t4trenmr oatfptr nvo;() 2tmim iudlleelics (faDrau pno0apenmfeildfs2rlnms;(0trxoif3oo1fp  lu i;s)s2uoxm io1apenmfvs s) Duaur nu1ope iietatlm umu s;(0aeenmfcoy1lp e n sls)teumio3oydlptnlfesltf 2umxmp;t1alx mf3iysla ul(mp u)altnmr ta1oa   ies s0srum(r ou1ap nmiesls)arrr(m ou1apx  ietadfa rmnmont) exoif iy1fpteluvs ( s2xmxr nudal n fet sfaDrru pot4tleomi3iyt m ul(vsnu4aetomfciodoa e nvs s s2to(opou1am elnvsa()s2tax  ot1oet mi3iyslmDua(vsnt)trxnio todom r n olt)teuoio3nu4lm nmiei (farrrxrpot4aexomf3iasfs ul( s;u4 exnmf3iatfpDe u o s0s2xoiopny4lptelneiatfa2raxmpoo4opeomoetys aDul( p;(0 lxoxr3todfat luvils s2umxr oo4lmee fvtlt)s2rru ooo1aleniietydlaDra(msnt0 reoif3iodfaDrli s t sruoimpno1ame mncs ( aDrm(  ;t4tltn f3iatlmDem( s;t0tleoxo3iadlpte n i s0 2um(rpny4lp e ncslt a2rru o;u1tleo o3iyt mDeau p ()artniociytfm   ivi;()t2xrir3oy1olee iesa( sDrm(  ;o0teeoiicilsfsDea(vpnu4alxnmo3oa1oat lieolt0trxrir3iodop emfcil(  Dtmx  ;u1tex io3iatls2eauvsnu4aeermr3totomDrliei s0texmir3oo4opt lnetlt)aDrmxr oo0olto i3iad m rmu sn()tltrir3oadfmtean ol(  2xo(mpoodaleemnei tf rtr(mont4tpxo ieias sDran pn(0 etoxf iydoa  aivo;s) rtoim3nu1apenmnvs s s2uaxmpnt4aexomictat aDrmumpn(4aetnxrctytfm rli o;s teumxopoodolt mneta(f 2urx  ;u1opt io3iyd m uau o (0 exrmfcoatfa elivs;(0srtm(o3nu4amte neslsf rrmxroot0olxo ietyt a rm(vp u0alenifctadfa rlneol( sexmxo3nudlmtnmfet t) 2raxmpou0aet mfciytfs2ea(vs u)trxnmfcio1la eauvsls tetrxmpno4alen fci ( sDrm(r no0tle iieiatlmDum(vp t4teenxr3ootomtr ueo ()s2umio iu1oleemfvtlsf rraurpoo4tet mietat m2ul(ms;(0aexnxr3totom rai ilt)s2tmiopoy1amtnlfcta( srrmx  oo1aeenmfeiad a2rmnmo u4aeenxo iotoptrluvsls) exmxo3iydapte nctlt)arrm( o;t0tpeoioeias aDuanms u0tlxrifcoo1lmtr n i;(0sexmxo ou1apenmies s  2rru p;u1opxo i3iyd aDeluvs;(0teerio3totop  ai o;t)sexo(mpiodlm e iesas  2ur(mpno4oltomieiatfm umnmon()tlxrxrciydfm  auvs ( seuoxrpoodlm  mfctls) Dtau  oo1tet ifeils mDulums;u)alxrif oytfpDe nvo;(0 2xmiopnydlleemfctl()sDur(m nu1olto fciys s ran sn(0alxoiociytfa eln o;( t2tmir oy4lp  lfes sf Dum(mpou1oeenmo3tad a ranvs;u) etnmo oadfmDrai slt)teum(mpiy1ll  lfcias  rurum ot4oeen f3iltls ra(mp u)aeenxo3ia1la  li slt0t2um(r3nodapenlnci (  Duax  ot1aetoioctlslsDrmu pnu4 etnmf3ootomD  nvs;(0t2xo(rpny1lmtn nct t)arrmx o;o4oex mocils s2ua( onu0 exriociatfptrauvi;t trxo(m3iudllt  nctls) Dumu poo0aex ii3tad s eauvp;t4 ltrxr3iytlm eauvilt trtm(mpio1lptn icsltfs2raum nu4tetnif3iasfmDeluvp;u4aexrif3oo1lpD  n o ()tetmxrpiudolee fesatf Dtaxmpnu1tpxnif3tlslm umn p;u4 ltnmrcoatla   ieo;s0srum(r io4opt  ivtlsfarrmxr ;t1tpxnmo3ildlm em(von(4trenxr ootfaD  i ilt)teuoxopoo1apte ncil( a2umxro;u0teeoii3tldlsDeln o;(4 lxoio iadom elueo;t  2ur(opiodopeelivs s s2tm( ont0oex ifciatla2eanvpn()arenxo3tatomteanvil()sexrio nu1lmee nctl(  2rr( poo0aeeo o3ildlsDran s t4arerxr3oytoaDraiei;(0s2toim iy4am nlfes s a2trx  ;u1tpt if3iydls ua( pnt)tlxrioctydomtr i slt)trurxm3nudolee nvtatfaDuaumonu0apeo o3iad a2rmuvonu4 lerxo oatfpt  ieo ()setoim3oydolee ivslt  Drax p;u1ole  fciadls2rm( s u)tlxoio iydlateli olt0seur(r3nudapenlicilt) 2rmu  oo4tpx iieiyd aDum(mo u4 eerir iotlaDran o;t)trxmxr3oodamt livia(f 2umx  ;o4olen iciatlm2ra(ms;u4treoxr totopDrauesl(0setmxrpnu1ole mfvt s  2tmurpot4tpx  oetat s2eluvo;t4arxoio3ia1fm e ieils0teto(m nudamt mfcsls)sDrmurpou0olt ii3iyt m ranmont) exnmo3oa1la   nesls)trtm(o iu1olt lfcs s)artmumono1aptnmoctadlsDumuvs;(4texrifctodomteaneil() 2ur(o3ou1olte icsas)aDuau ooo4tpe  f3iatfa rluvp;(0tltoxr3totfpte u i;s0 eurimpno1opeelici (fs2tmur ot1olxn icilt mDulnmon(0 exrmf3oadoaD  ivs t0seumxo3nu1apee ieslt arur(mo;u4opx  ieias a ranvo t4alxomo oy1fmD  n s t)teuo(o3iu4al elietatf Dtr(mont4tpx  octyt a rmnmo;t0 lenmfcoatomt lnei s0texmxr3nodalenmnvtl()aruru  no4tltoii3iytfmDel(ms;t4trtrircio1opDelivi s  rxmir io4openlies sf 2uru pnu1teeo f3tyd a uaumsnt)alenxr iadomt luvo;t  euoirpnodoltemnvsls)s2trum ;u0oee mocilslmDrlu p u) leoifciadlpDelivs;( trxo(mpoudom nmfet t)artau poo0apxnifciad sDul(vs u) rerifctydopDeanvo;() etrxopno1ope lfeias) 2urx poo0tpeniieiaslmDemnvo;t0 eenmo3ty1oatelu i;(  rxmxr io1ap n nei s  rtrxmooo4alxoiiciytfa2rl( o;(0 rerifcoadla rauvs;t texmxm no1amen fcia()sDtaxm nt4alxn f3iad sDeau on()aetrif3oydfmtranei;(  2xrxmpoo4op emivta(faDur(monu4tee mociltlaDum(vont4arenmf3totlmDeai i;s)t2tm(m3io1lpe mfetltfs2raur ;u4apeoif3iydfa2ea(mp;(4aexomf tatlmteaiei;s0 exoxm3no1lptelivia()aDra(m oo4tpeoiictldla2elums;u) lerio3oa1fptelneo t)srtrir iy1op nlfci tfaDta(moou0aexn fctydlmDuluvo u4aeenxo3to1oat aieil( t2umxr3iydapeemnvtat) 2um(ronu0tptomi3iytfaDrlnms u0alxrxfctodop r n i () rxoir3iy4om n fvi s)artr(mp;t0altnmfetys m2ul(mo u0 lenmo3ta1laD auvi t)t2umxo3iu4lltnlnvsat s2tau  nt4apx  oeiyslaDelump;t)treoxr tadlmD li o t)s2umxo3no1al emnet ( a2trxmoot1openifeiys m uln o (4 ltomocta1fm rlnvsl(0 eumxo oy4aptnmicsat s2ur(r nu4aet mi3ilt a emumon() exomr3oydopDe ivi;(0s2tmxr nodlptn fetls)srur(moot1tlxo ictys mDrm(mpnu4altrxr todfmtr uesl(0texoimpnodapeemicta( aruauro;o4tleoifctyslm uanvp () ltomf tadlmDrai s;t0 etmimpno1ll n ieslt  2tmxront0tet  ociatfsDrm(vpnt0alxnmfcto1fptr i s (  rtm(o3iydoptemfvslsf 2urx  ou1opxo f3iadls2emn p t4 eeomf3iydlaD aueol( srtrirpoodam   ictatfs2raxmpou4aptoiieiadfsDuan pn()trtriociytlpDeln i;s) 2xm(o oy4ope lfvtas arrm(rp;t4oetnii3iatfaDeln s;t) leoio3ta1lmDe neils0truriopnu4al n fesas  rur(rp;u1opeoii3iasla2rmnmsn(0 rxrif iy1fptelnvi t)srxrxm3oy1lmtnlnvi s)aDtrx p;o0aetoioctyd aDra(vonu4trxrioctodfm  livi s)t2xoimpiu4omenlivilsfsrum( o;o0tleomoeils a2ulnvp t4 etrir3oadopDr neo;s0trtmio iy4omeelfvi () rumu  no0ole moetys a2emuvo (4 lxrmf oy1optrlueslt srxoxr3nudal e feils  2ur(r ;t1tpx miciadlaDumuvo () lxrmrciadop  au o t teuoxmpio1amtnmfvsls)sDtaum ou1olen i3iltfm ran s;u4tlenmfcoatoa  lieilt0t2um(o iy1lmenmnetlt)s2uaumpnu0oee mfetasla em(vo;t)aeeriocoy1omtraueil() 2tmir oy1al e fcia()sDtrx  nt0aeeoifeiydfa2uaump (0aetomrciotfm rlnvs;t)texr(o iu1ol  lietltf 2umxroot4aeto ieiytls2ra( o;(0alxnmo3oy1lm r n s (0 2tr(m no1lpt mfctl(f rrmum nt1optomoetldfs2ra( snu0trtnmf3iodfpt auvil()t2ur(r iy1opteliei (  Dtrurooo4tltoiocildfmDeaump;()alermoctatop elu slt) 2xm(r ou4olen fetat aDrmur ;u4aet mf3tasfsDrl(ms (0alxnxf3ta1lpDeaueols)t2xr(r iy1omtelnctltf 2trxmoou1alto f3iydla ua(vpnu) lxnir3totfmte iesls)s2xr(r oo1amtnlicil(f rtru p;u0oet moetatfs2uauvo () etnxfciotlmDeluei;t)srto(r iydape micsltfa2taump;t0tltoiicildlsDemnvo;u4 etrxr3iytfa r i olt seur(rpou1al n nes () Dtauroot4ale if3iyd s rm(mpn(4trtrxf3oo1fmt lu i;( s2tr(o ny4ame lfes tfaDtm(ro;t1altniocilsfm em( s (4 rxrxf oadfpt  nvsl( srtmxo3ou1omtnmncslt a2ur(  ;o0oet mfeiltlm ra(vs t)trxoio iodoat aies ()texr(m3oy1altnmicsat) 2raxm ot4tlenmieiyd s2rlump;t4tlenio3to1faDraneo;t texm(o oo4lp nlictatfs2umx  ou0optnmieiat m rlnvp;()trtoxocta1oaDrluvs t)srtoxr io1ap n nvil(fs2tmxroot0olxomociyd aDeau p;t4 ltnmfctydlaDrlu ilt srxoxr3nu4ll elneia( srrmxrpou1oexnmoeils sDulums t4trxrio iatlaD lnvslt truoxopiu4olen nvias s2truroou1apxn ociyd m ulu pnu0teerirciytom eai olt0tetoim3oudlleemivtls  rurxrpoo1opx io3iys m2rl(vpnu)teenmo iydfate ieslt trtrxo3io1llt  fetl(  Dtm(root1opt mieiadfm2el( sn()aetoxo totfm eaivsls)texrir3iodole lnvt ( s2urxroou1tlx  o3tatfa elu on()aetrmr3iy1om  aieo;(0srumimpio1lme licsl(fsrua( ono1teen i3iatlm elumpnt)tltnmf oydfmtraneo (0 exrxo nu1optelfcs ( a2tm(mpot0tltoio3tyt s2emn pn() lxomf oo1fp ranes (0 eto(r oy4lptn net (  2ta(rpno0oetnmoeiad s2ean o (4 exoxfciodfp eln ils) rtrir iu1apeemiet tfsrraxm oo1oeeomoeildlaDran on()trxrif iodfpD  n i;s)texm(r ny4opt lnvt s)aruaxmp;o1olxnmf3ias m elnmo t) lenmrctadopte ueil(0 2xrirpoydope mfeta()srurx o;o0tpeo ictldfm2umumsnu0artniociodlmteluvils0trtoir3no4ol n neia() Dur(m ou4opto fciasfm2umnmo ()tlxrirctadlmt luvs;(0 rtoio iy4omt lnvils)a2urx p;u4alxomfeiasfaDumnms t4arxrmf3iydlp e ues (0 ruoio iy1lpenmfes s)aruau o;u1alx miciasfs rmu s;u4alxnxo3ootom rauvo;s) exoio3no4om nlnes t a2ta(m nu4opx ifciysfm2emumo;u) exrmo3tytomDean i t)t2um(o oo4lp nmncsat)artrxm ot0tptn oetlsfm2umnvs;u0tlxrio3oo1omDeliei s srur(opoy4lm  mnetls arur(mont1aetnif3iatfsDul(vs u)teenif to1faDe nes;s0tetmirpio1llee fvi tf Dtau  no4tpenmo3iyslmDeaums (0 lenmo ia1opDr i o t)trur(opiy1apenmies tf rrr(mpno4oetomieiasfa2uanmsn(4 exrmfciadlpDelies;s) 2xm(mpnodal n ictls  Durx ont4aptomiciysfm2rl( p;t0tlermr oytopD  n i (  rtr(m io1op  livt t arrm(rono1alt ioeiadlaDul(vs (4 ltoxf3oa1fmD  u olt)s2toim ny4oltnmivi t) Durx onu0oltomocils a eaums u0 ltrxr ootomtr ies s  euo(o3ny1lpenmnvia(faDtax  no1ape  f3iys mDemnvs;t)aleomo3to1lmD  nvi;s)srtrxm oy1am  livtlsfs2rmu p;t1aetn fciatlmDrmn pnu)trxomr tatfm  lnvi;t) ruo(r no4lpt  ivtas) Duaxront0olt iictytfa um( p u) eenmo ootlatrln s t tetr(m nudamenlfct (  Duaurpnu4oeenmi3tlsfa rmnvs;()trenifciatfmt anvs (0s2umir iydlmeelfvsas)a2um(r ou0alto octadls uanvsnt)altrmfcoa1fpD an s t0 eum(r3oydomtn fcia( sDrax o;u0alxnmfetls s2uan snt0altnir3iadfm ranes;t) 2xr(rpiy1lmenlivias)arrrxroot0texnii3iyt m2elums;u4areoiociydfmDr nes;s0srumxm3nodal elnesa(fs2rr(rpot0tlx  ocilsfm rmnmpnt0 ltnir3ia1lm rai s;t trur(r3nu4ol n fei ()s2uru  ot4opxo f3iasfmDemuvo (4aeeomfciatoateauvi t trxo(mpnu4op e nvsl() rumu  ;t4tpxoifciad mDelums;t0areoir oatlmte uvi;t)setrxrpiodlpeemncs t)sDrrx ono1tleomf3ildlm2rmuvp;u4 lermo3tadoa   n ol()truoio oy4lltn ictat)arta(monu1apxomfeiadlsDum( s t)aeeoif tatlp  au i t)s2trim3iodlme lfviatfa2trxrpnt0ale mo3iad a2rau o;u4tetomf3oodoaDeai sl()tetmimpnudlp emivslsfa2tru  nu4aee ifeiytfs2ranvpn(4 rtoxfciatoaDe uvi;()trxo(opnu4lmeelici ()s2rr(rp;u0altoii3iatls em( pn()tlxnxo ia1opt aivi;s) rxmio nu1lm elivi () Dum( onu0tex mieiadls2ulnmpnt)altnxfcto1faD ai sls)seumxm nu4omen ietl(fsDrm( o;t1optnmieiysla2ran p;u0 rermo3oa1oat  ivsls s2xm(o iu4lm elnvtatf rtmu pnu0alenioeiydfm eanvs () eeomr3iy1opteli ol()sexm(r3io1al  mfciat)aDrmxm oo4opxnmfeild
\ No newline at end of file
@@ -0,0 +1 @@
+nvi (0t2xo(o3iu4olee ivi s a2ua(m nt0oleoif3ias aDuauvp (4 lxrmf3todomDeai ils)srur(m3nu1op  mfcsltfsDumx  nu1altomf3ilsla2ranvs;(0 eeomocoy1fpteau i (  etrirpny4lltnlnvsl(f rumx o;t4tpen ietysla rl(mo t4tetnmr3iytfpt livi;s0 etoim3ou1ap nmncs s)aDta(moot0oet  f3tytfa ulumo;u4trxnir ootlaD ai i;s)tetrxr iudll n neiltfaDrrxrp;t0alt io3iysls rl(vpnu4trxrir oy1lm rli ils0srxmxm io4olenmietas aDrau pou0apeo fcilsls ranvont)tleoio3oydfa r ivi;t0srxr(o oo1optelfetatf 2uau  oo4apt moeilsla2rm(vs (4 eenxo iodop eluvo;( s2tmirpnydap   nviltf 2urxront0teeniictldfs2emuvp (0 ltnmrcoa1optr uvo (  etoxm nu1ap  mici (  Dur(rpnu0tlxomociltfsDeanmp;(0 ltrxr3ty1lmte neols)setmimpio1opte feia(f Drrur ;t0tee ii3ild aDemuvo u0aetnxfcoa1lm elnvi t0trtm(o ou4aptelnvsasf rua(ro;u1alt ii3iadla2uluvs;(0 etrmf3iydfpt aivi t)s2uoxo iodapeemieilsfsDra(ro;o1oltniieiltfaDuan p (0aeeoxf3ootlaD livs s)t2to(opou4apt  iet sfaDur( oot1tlt  ieiatla2rl( p t)areomo ootfp rliesl()srxmxmpno1lmt mnvi s)aDrmurp;u1oee ioetlsla rau s u)tlerxo ta1oaDr uvol(0 etoxm3nodalenmnctlt) Dtm(r ot4aptn octytlm ranms u0texnmocoydfaDr ieo;()seur(r nudope  ncsa( aDuax  ;u1tetomo3iasls2raumpnu0altrmo oydla ran s;s)trxr(mpny4lptemfeil()artax  ;o0alxo i3iys a2rluvp;u)alxrxoctodfpDrli i (0tetrxmpiu4amtemfvtl(f rum(mp;o4tpxomf3iyt s2uln pnu)trxrxo3oytfpDe u sls0 exmxr nodalenlict sf 2um(mp;u4alxnioeilsfs2uaumon(0tlxrmr3oo1fat aueo;() 2xmxo3oy1lp elietlt arumx  nt1apeomoeiatfa2umums u0 lxnifcoodoptrluvo;(0trurxo3ou4lmte ictasf Dtaxront0olen ociydfm2eau ont) rxnmo3iatfpDr n o;t)trxo(mpou4ap e ictat a2rrxrp;u4apx  ietys s emums;u0 eerxr3oadfmDe uei () eto(r no4lp   feilt  2rm(  ot1aex  octysfs2rau s;t0aleoio3todlmtranei;t0sruoir nudol eliesl(fsrur(mo;u0olenif3iadfm2em(vp;t4artomf3io1lptrlieo;s)seuoio3oodlmtelicslt  2ta(moot0apxomfctas m2ra(vo;(4trxoxf tytlmDeaneo ( s2xoxopou4al nlfctltfaDur(r ou1olxnii3iytfm2elums;u)artrmfcto1opt anvolt) rxo(m3ny4llteliet tf Dumumooo4alto ieiyslm2um(vs ()areomrciatfp raneo;( srum(opoydal   ieiltfaDumumont1tlx ioeiatlmDra(vo;(4tetoxo3to1op  ai sl( t2tmxo3nodaptemivi t  Drmumpno0olx  fetldls umuvp;t4areriocio1omtelnvo;s)teuo(o3oy1aleemicslsfartrxmonu1olt  fctltfm rln o;(0altrmo3oodfpD anei ( srxmxr3iy4apenmfvias s2trum ;u0opx  oeiaslm emnvs u4treoxrcoodla ranesls  etoxmpiy1lmt livsl(faDrrur nt0aptn o3iyslaDua(mpnu4trxoir todla rlnvi t) 2urio ou4llt mfei t) 2taumoot4tpeomieiysfmDrmnvs;u)aetnmf ta1fp  ai sls0trxr(opno4lmee fesltfsrta( o;u4aexniociadfsDea(ms;(4 etnio ty1omD aivil()seuo(r3io1lpt mnet (faDtaxronu0tetomi3iat m2eau on()alxnxf3ty1oa   n s ( trxoxm iu4lpenmivtltf Dta(mpoo4opeoifeiyd aDemump ()trtnirctydfa  aneo;s s2uo(o nodlmtn nvt ( srrm( pot4oexo octlslsDemnvs;u0aeermrcoytlatr u ols trtr(rpoy4lp nlneiasf 2rrxm nt1tpxomfciadfm2uau pn()trxomfctadomt aivil(0 rurxm oudalenmictatf Dur(rpou0alx ifetadla umnmpnu4trxomfcio1fptr ues s)texrir nodam nliciat sDtm(  ot1ale  o3iat m2eau snt)tlenmocoadla raues t s2xr(o3nu4aptnmfesls sDtaum ;t4oetoio3ildls2ul(vsnt0 leoif3tytlaDr n o t0s2urirpou4amtelfctat s2rm( oou1tex mietad sDelumon()texoxo3tydfptraneo (0 euo(opiydapeemfciltfsrumx oou4aex  i3ilsla ea( p (4tlermr3oytoptrai i t)sexr(o3nudapee ies sfa2urumpnu0olx ifeildfm eluvpnu)arenxociytoaDranvs;(0 rxoxo3iodll emnvil(fsDuax  ou1tetn ociad s elump;t0 rxnxrciytfpD aiei;s  rto(r nu4apte icil(  2urxrp;t4oeeo oetad a2emu s;()aexrxr3ootoa e uvi;(  exmxo3nudam e fesas aDrmx  nu4oex iictld a2ul(mon(4 renifciadomD  ivi;t s2trxmpnodam elicia(f Draxm ;t4olt  oeilsfm uan p;u)trtnmr3to1lpDe ivslt) 2to(m nudlle lfvt s) Duau poo0opxnmfeias m ulnmo u)tlxoxr iodoa e ivsls  2xoio nu1amt  fci sfsrtmu  ot1oeenifetad m2rauvp;(0 rtnmr3todfm e nvsls0 rxoxo ou1ll n ncs ( s2ururo;t4optnmicias m uanmsn(0arxnio3iodoaDeau sl(0s2umxopoo1op   fvs s sDtru p;t0opxo ictad m rln ont)aetrxr3tydfm eanvo;()truo(opiu4optnmnes t a2tmx ono0teeo ieilsla2eluvpnt)altoif3iatfpD ai o;( teuo(o3oo4ol emnei (f Dum(moou4aptoifctld a eln s;(4arxoxf3tatlaDranvsls) ruoxmpnu1lptn ivsa()s2tm(mp;o4olto i3tatfm2elu o;u4trxoxo to1lmDe ivo;( sexrxopno4al  mfetls) Dtrxrpno0tetn i3tldls2el(vs t) lxrmf iy1fatelivs;s0teuriopnudamtn iciasfa2rmum ;t1olt iieiyt a2umuvsnu4aexrxo todlmteauesls trxoxo no1ome mncslt  2trx o;u1teeomietas a2uanvs;u)aetrmf3oytopD auvil( trxo(m oy4lm nmfetlsfsDuaumpno0oetoiocils s el( pnu) ltnmfcoo1oaDrluvi s) rxo(mpoo1opt mnetlt aDuaur no1altnmoeildfm2raums (4teerir tytfmDe ueo;()teuoimpiudlpe lncslt aDtmxr ou0aeeo oeilsfs rln s;u0 rxoxo iadomDrlieilt0t2uoxo3ou4lmt mfvsl() 2rru  ;u1tlt io3iltfa raump ()treoxrctotoatr nvi;s)srumio oudapeemfesat) rrmxr no0tet moeiysfs2rl(mont0teeoif ty1fpD  nvo;s)t2xmirpoo1amt lnvslsfs2ua(  ;o1oexn ociaslm2ra(vp;u) eenircoa1lpteaueolt srtr(rpoo4amtnmfes sf Dtaur no4olx mfctltfm eauvp;u) rerio3oatfa e nvo t  rtr(m ou1lm nlfvsasfs2ta(rp;t4tltnmfctytlaDeaumo;(4 lerio iadfp  an o s)texrxmpio4open iet sf Dur( pnu4alenifciyslaDuau snt0tlxrxocta1lp r u i s)s2umxmpiodamt  fcslt srrmurpou0tpe  f3tydlm2emuvs;(4aleoif3io1om elnvi;s0sexr(r ny1op n icsas  rrm(mp;t0aleoiictas a ul(vpn(4aexnir3tydlm rlues;t0t2tmxm ny4omtelncs s  rur(roou4oeeo i3ilsfsDemnvsnt0tetoif ta1op rlu s s srum(opoo1opee fvi tfaDurur no4aex iociyd sDra( s;u)tlxrir oatfmt  ues;t0 2toimpny4am nmfctl()a2tr(moou1opeoiociat a rm(vp () rxnmo oydom r i o;s t2toxm3oo1aleemicsls)a2rru p;u4tee  ociysfs2ra(mo;t4trtnir iodfmD  iei;s teumir3oo1lleelnet ( a2trur ;t4olt  o3tlsfsDemnvo;t0arerxo oo1fp   ueols)s2ur(r3iy1ale  fetls)arrmxroot4tlxomo3tatls umu pnu0trtnmf3oa1laD auvi;s)t2uoxm oy4ape miei ( a2tm(mpou1aee  oetatlaDrm(ms;(4 exnxrcoadlp  ai i (0srtmio3nu1omenlfvt s)arrr(mpoo4tpxo fciasfa ranmp;t4trtoxo3oydla elivsl(0 exmiopno1apenmnvsatf Drmx  ;u1tlxo feiatla2em(vpnu0texnxr3iy1fm ran o t0texrir3no1llenlfeiat)sDurxront4teenmo3tlsfa2ua(mo u0aexrioctatlatean ils)tetmxm nodamtnlivilt  Drr(r oo4alx mfeiltla2ul(mpnt4 ltoxr oa1fpD anvi () eurxmpoy1op nmfvtat  2tr(r no1tleo o3iysfsDraump (4alxoxf tytfm  lu o;s0srtrio no1om  mfctat)s2tru  ;u0ale  ietatfaDran p;u)trenmf tytfptelivils srxmxm iydap elictls)srrrxrpno4tet mf3tytlmDrmu s;t0tlxrmfciytlpte u il(  exoio iodom  lici t)s2um( o;u4tpxn fetld m ul(mp u)tetnifciadoaD au o;s)trurxrpoodlptelicsasf 2ua(roou1oetoiieiat s2uln s u) reoio3iydfpDelueo () exrimpoydole mfciasfaDumu  no4olto octldfs2ul(vo;(0 etrmociotomt aues ()trumxopou1ame mneilt sDuau oot1texnif3iatla uluvs (0 lxoxo tadlpt  n i;t)sexrxopoodlle  nctasfsDurumo;u0aeeomocild sDemn p;t)tlxnifctydfpDrlnvi (0trtoir ny4ome livta(  2rmx onu1aeeniiciasfs2emnvo t0aeenxr3oatlm eaivs (  rxoxm3oy4lm  mici tf 2rr(mp;u1aetn o3taslsDrmn s;t4teerioctotomD li o;t srxrxmpno4aptelfvi t  Dtax o;t4oetoii3iyd mDem(vp;u4tlenmrciy1fptraueo;s t2um(r3iodol n fcs s  rtrumonu4aeen f3iydlmDem(vs;u4altnxociadlmDr i ilt  eto(rpou4ome lfvsl()a2umxr nu0olenifciad m2umnms u0 exoxfcoydlm rlivilt0seuo(opio1lm nmietatfaDurumo;u4opt iociyd m el(ms u0texomfciy1faDelieo;s)seurxrpno4opeemncsa( sDur(ro;u1altnifetatfm2uluvp (0areoxr3tytfmD  uei;s0srtoxm no1amenlneilt) ruau  no0apxomf3iydlm rlnmp (0tetrxfciotfatelieo t teumxr3oydapt  ivi s s2ra( ont4tpenioeild sDrl(mp;u) exrifciadop  an o (0s2xoir3oy1ol e ieta(fsDum(ro;o1opxnmiciltlm um(ms;u4alxnmr oa1fpDrln ils0 2umim3oydllt mnciasfaruau pou4oltnifcilsfa ua( snu) lenmf3oytfm e u s;() rtoxmpoudlle mnctatfsDta( p;u1aee iictlsla ran s (0arenifcoy1fmDrlieolt trxoxmpno1amee fctlsfaDur(rp;t4alx ifeils a2umu on(4arxoxf3oy1om e nvs s s2xmxm io1llt mnetl()sDraxrpoo0olt iietlsfs rlnmo (0arxrxf3iotoat  neo;t seum(mpoo4lmtnmfcsl(fa2tmur no4ope iictlslm eanmonu4trxomf ia1optrlueo s)trxr(opio4ll e iei (fa2trxm nt0tpeo i3tatfs um( o;u4tlxomoctotfpDe ueslt sexmxm3oydam nmnvta() ruax  ;t1tpeo feiatfm2ulu pnt0trtrmrcta1lptelu i t0 rurxo ou4lmt lncias  Durump;u0apxnif3ils a uaump (4 lerxf3to1oateln s;t0trum(o no1olt  fctlt)a2tmxmpou1ope mo3iydfm2rln p;t4 rxnmociytfate neo;s0s2to(r3oudame livt t)a2taxrp;u0aee ifciaslm2ra(vp ()trxrxr totfpteanvs;( srxmxo3oydopenlnvt s s2umurp;u1tle mo3iyd aDrm(vo (4alxniocoytlm ean i s seur(m no4ame  icil(fa2tr(mp;t1aleo ociysla2emu o ()tetrxfcoatfpDrluvolt0seuo(r3iu4apeemnct s arrax onu0tle ifeiad aDrmuvp;(4trenxo3oadlatr i olt0 rur(o3ou4apt lfetas a2raurp;o4tlen o3tad sDrmn p;u0trtrxo3oydomteluvs;t  etm(mpoudape lfei () 2rmumo;o4oetomf3iydfs2rau snu4 rtnxf3ty1omt  nei ( s2to(o nydol  mfvi (  2rruront1oee if3ildlmDeaumsnt4alxoxr3tydoa  aivi t)trto(rpoo1aleemfeias)srta(rpnt1aee  oetyd m2ul(vsnu)tltnmf iy1om elieils) rxm(m ny1am e iciatfarrrxmpou0tpe miciadfmDrm(monu)tlenifciadfa r uvi;( t2tmim3oudapt  nesa(f 2tr(rono0tltnmfciyt a2em( on() etnir iatlatrluvi s)setr(m3no4ll emicsas  2uaumono4aexnmoctas sDeauvont0tltnio oadfm  li ilt  2umim oy1lpte iviat)aDumxm ot4tpxoio3taslaDrm( snu) exrxo3tatfatranvsl( s2tm(r3iu4amenmies sfsrrrump;o0aexo ietasfs2rmuvp t0 etnio3totfat ln ils0seuoirpoy1al nlncsat srrr(rpou0olxomfeiyt aDulnmpnt4 lermr3iydopDrln s t)s2uoiopiy4om emfetl(fsDtmxr ot1tlxniiciatfmDrl( p u4arerxr3ootfpDranvilt0s2xr(m io4ap nlieilsfsDur(moou4alt ii3iyd m2uluvpn(0artnxf tadfm  aueo;s  euo(r nu4lme licta( arrrxrp;o4tpeniocildls2emnmonu4trtrmr3oadlm eaneo;s0 etm(r io4amenliesa(  2ua(r ou1olen ieiysls raumsnu0artrxf iotoat an sls trtr(mpnydlpeemivsasfs2tr(mo;o4alx ii3tls s uluvo;(4 ltoif ootopDeaueolt0s2umxmpno1opee nctatf 2rrxmpnu4apenmi3iasfa rlump ()tltrxo3oatfp eluei s0t2um(m oy1om elfcsat)srrmx oou4texn feiysfmDea(mont4 lxrxrciotlm  anvils) rtrxr nu4lpen nciasfsDum(mpnt1opeoif3iyd sDul(vs;(0aeenmo iotom rlnvil(0srumxm3iydoltn fvsls) Dum(  ;u4oleoifeiatlsDemnmonu0 rtoxo3io1fp   ieils srtrimpiy1lle lfct t s2tau  nt1ape if3tysla2emn s t4aexrif3ia1omDe n i;t) rxrimpou4opt lfvsl()aruaump;o1alx mf3tlsfm2em(mpnt) lxrifctydomDelueo t srto(opny4lmt lncsas  Dtmum nt4tex ii3iltfs2umn s;u4 eenxf to1fptrau s t  rxo(m nodllt lici t)a2rmum ;u1aeeo oetysfs2ranvp (0trtnirctadlat lieo;(0texrxopnudllee ivta( a2ra( p;o0texnio3tas m2rmnvs u0alxnxr3iydfm raueo;t seumimpiy4al n fvtlsfsrrr(mp;u1olxn ociytfm2uluvo (0 rxnxoctytfatelivs;t  rtmxopiodoleelneilsfsDurur ou0olto iciad a2rau o (4tetrxocoo1fpDr nvsls) exoirpnodolt mfvsatfaDtmxr nt4optnif3tasfm ea( s t4 rxnmr iatfmt lnvil(0 rxoxm nu1om   ncs (fsDuru  nu1tpe io3ias a uanvp;t4alenxr iytop  anei t  2tr(m3iodll elnvtatf rrrx pnt1oetoiociad s2em(vp;(4aexnxfcoo1opD livo () rto(r3oo4ole lieia(fsrraum no0opeo i3iatls2rl(vsn(0 lerio oatlpte ivo;s s2xo(mpio1alenlfvt (fa2umu ono4alenifetadfa ranvpn(4alerxr3oydoptelivs (0 etmir oo1am   ncslsf Dtmx pnu1alenifeildfs2rl(vonu4 rxoiocoo1laDelneo;s t2ur(mpiydllenlietlt)sruaxrp;u1tpx  fetyt m umnmo;(4trxrmf3oy1fptelu s ( setm(r3nydaptemnvt (f 2um(ronu0tlenmfciltlsDrluvp (4 lxnxo oadop elnei (0srto(rpiy1om nlnetl(  Drmu pou4ole  i3ilt s ran on(0tltrxr3tytla elnvolt)truo(rpnu4lpenlfes s a2rru  nt4teeo i3iltfs emnms t)arxoir3tadopt  iei;( setr(r oy4lmeemivias srtr(ronu4open ietatfmDulnvp;u4aexoxr3oytfmte ivo s s2uo(o3oudoptelfciat)a2umx  no4tpxo feils a2uauvsnu4aetrio oodfp rluvs t  etr(o oy1lptelfes sfa2um( pou0tpenii3ilsls rlu o t0 lxoio3todoaDr n s s trtrxo3ou1am nlnct sfsrrmumpou4aee  oeiydlaDelu p;t0 lxrmr3ootlpteln o (  exo(mpoudlmee nvsltfa2um( oot1alxoioeilt m umnvsnu) lenio3oydfat anvilt0 2xo(r iydomt lnetas aDumurpno0aexomoctydfs2ua(vo u) lermf iatlat anvols) rum(rpoydllen fvs (f ruauroot4tpx mi3iadls2uln onu4 rxnxo3tytfaDrlneo s0 2tm(r3ny4lleemfvt ( sDtmxm no4tpx mf3tyslaDrl( ont4teenxr3iydop e ueo t) exrxm nydoptnmics tf 2taumpnt4apto ieiltfsDrmu snt)artrxr ta1omD  ues s  rxr(rpnodlmte fcta()aDrmumpno4texn feilslsDeauvont4artomr3oodopDe ivil(  rtrio3nydllt mfciatf rtmumonu1opx mfctad m rmuvo (0texnxr3oytfptr uvolt0tetr(o3ou1al nmncil(f Dtmu pno1tpxo ieiat m uanmsnu) ltoio3iytla ran ilt)texm(m no1om emicsat)srtaxm oo0aetn ictldfs2eanvo t) ltrxr3oa1fmt auei (0trtmimpiy1opee ict s s2ra(rp;u0oltn f3iasfa el(vp;t4tltrmo3oo1fpt auvs s sexmxo3nydamen fes (  2trxrp;u4aex  ieiatla ranmp;()artnircta1om r u ols0s2trim iudope lnvias) 2um(mpou1opx mf3iltls2ua( s t4tetoxociytfm e n slt0 2uoir3iodalenmivtl() 2taumooo4aleo iciysfm2ranmsnu)texnmocoydomD lieol()truo(o iodale lfvtl(f 2raxroot1apx  i3ils m2umuvo (0 rxnxo3tatfat  nvs s)texrxr ou1lpte nesat sDta(rpoo1tet if3tysla rlu p (0trxrio oa1omt lu o;s)seumxm3iydomte nvta()artau  ;u4opeomfeiasfs2um( o u0trxnmrcoy1fmtr neol(0t2xrxo3oo1lptn nci t)sDur(mont1olxnifetys m2ea(ms () exrir3to1oate ueols trurio3no4am n fvtlt)aDrmurp;t4tle mo3tyd m ua(mo t4alxoxf3oa1omDrauvols) rtmxmpny1oltn nvsat)artruroot4teeoioctlt sDeanvo;(0 rxnir ia1fm eanes;( texmxm3oydll e nvi tf 2urum ou1olt mo3ildfa rmuvpnu0 lenif3ia1oa r n slt t2xoxo3oudom emnei s)a2ua(ro;t1oetniieiltls2el( p;u4trxnxr iodlat li ilt  ruo(r3io4lltnmicia()srrrum ;u4oex mfciat aDea( p (4texrif to1la ranvsl()srxr(mpiu4lleelnvilt)a2ra(ro;o4opxn f3iys a2um(vp u)tlxomf3iadlptrlivslt  rumxrpny4oltnlfctat)sDtrumooo1tpto o3ild m rauvp u) lenir iodfmt luvs ( seuo(opny1lm e fvils aDur(rono0tet mietasfmDuauvpnt0aexnmf3oatlm eanvo ( trxoxopnodom  mncsatfa2rrx ono4aee  oeiyt m uln s (4 rxoxr ia1fm  anei s s2xmxmpiy4ol  mietas)aDtmxr nt1alx iocild m2em( p t4alxnif iadfmDeln o t srtoxo io4ol  mictls sDraxmoot1tet mfciat s uaums t) lxnir3oodfmD  n s;s texmio iy1am n fei t s2rmum ;o4apt  octytls2rlnvsnu4 exoxr3ootop   ivsl(0trumxm io1altnmnvilsfsrurur no4oex ifeildfsDulnvsnt0 lenxfcta1oateauvs;( setoxr oodaleemfcsls aDra(mono1tlxnmoctlt m2emn p (4texnmo3iytlatr uvi;(0trtm(opiy1llte fciasfs2ua(rpot0tet mo3iltfm2el(msnt0tlenir tadfmD  ivo (  exmim oodamtnmfes ( a2tr(rpno0apto o3iadlm2ua( s u0 rtnxfciotop  ln ol( teumxm3iy1altnlfvslsf Dum(rooo4tpt if3iydls2rln snt)tlerxf3iydlaD lnei s0 rtr(r3ou1amenlietat)srua( o;t0oeen o3ilt a rlnmsn(4 rtnirciydoaD anvolt seumir iu1omenlnvt sfsDtaumpoo1alx  i3iasfaDrm(vsn(4tlerifciytlaDran o t)seum(r iydom  livsl(  2umxmpnu0aptnmietls s rmuvo;(0aeenmf3to1op e i i s0sruo(mpiudlp emici t)a2umu  oo4teto oeiasfs2emuvpnu4teeoxo3iotfa raivs;s)srurir3oy4omenmncs sfs2tru o;t0aleomf3ils sDrmnvp t0trenir to1lp rlueo s seum(r3oudamte iviasf 2urx o;o4oee  iciysfa2umu pn() exnio oy1la rlies t tetrxr ou4apenmfvsat  Dumx ooo1aptoifeiytfa2eluvsnu0aetnmr3iadfpDrlivols texmim3iy4am elnci s)aDur(mpnt0optomicilt s2eau p t4tlxoio iy1op rli ols0trxoio3iy4ame lfvt ()artru ono1tpe  f3iadfs rluvs (4tleomo oydfmteli s;t0srxoxr ou1amen nesas) Drax oot0aex ifeiysfmDeanvp;t4aeenirctadoa r n slt teur(o3ou4olee fctl() Drr(r oo4oexnmf3iyt a ulums;(0 lerxo iadla  luvil( texo(m3ny4omenmfvtas) Draxrp;u1optn octasfmDrm( o;() etnmo3tadfatelueolt  2trimpiy4am  mieils) 2rm(rono0oleo octldfaDulumo (4texnmrcoy1opDelneo;s  euo(rpiudolt  nvs t)s2taxm ;t4opeoiictld aDul( o (0trxrif ia1omD  u i;s) etrxrpiy4aptelfvias)s2tr( pno0aexo iciysfs2em(mpnu0trermocoadoa r uei;(0 rurir io1ol nlnei (fsDtmxmpot1teeoiieildlsDuauvonu4 lxrirctotfmtraiesl(  rurio3nu1ameemnciltfaDtaum ;o0opx ioeiydfs2elnvp u)altomfcoy1fp r ivsl()tetoxopoo1ole lncilt s2rm(rpnt0aetomo3tadfsDrmnmp u4tetrmr3ootfpDe u i;( truoxm3io4lle lnvta() 2uax  no1tltoiicildfaDuluvs;t0aexnxfcoytfptelivsls) 2tr(m nodomtnlnctls  Dum( o;o0oex io3iyd s2ul(monu)teermrcoadlpDeaiesls srtr(mpiydapt liviasfaDtax o;u4oex iieiyd a2uluvo t)arermfcoydlm raieo;s setm(m iy4optnmfvtltfsDra( pnu1aptomfetlsfm2eluvsnu4tetnmr ty1lmteluei;(  rurxrpiu1lmtemieilt arum(moot4tpxnmoeiydfaDrauvo;u) ltomo oy1late uvi s0trxr(r3nudam e nvt s)sDur(ro;t1oeenif3iltfa2uanms;u4 rerir oo1fmt lneol(0 exm(opiydap e icias)aDta(r ;u0oeenioetls aDeluvs u0 leoir iadlpt  nvols trtm(o ny4amen icilsf 2rmxrooo0oeeo ociydfa rln pn(4 leomo totop eai s (0 2trir3io4amen fvia()srrr(moot4apxnmf3iadls2emn o t4trxomr oa1fmDeaueilt) 2xrxr ny4lm  liesat s2uaxmpnu0apenmieiat m2emums t0tleoio3iydlm e uvs;t trurxopiy1op nmivt ( artau pnt4tex ii3iys aDulumpn()trxrxocoy1fpDeanvsl(0 2toxr oydlmtn fetls a2umxr ot4aeeoiociad m2emnvp;()tlenmr3totlp ean i;s)sruoim3io4lpenlfeslsfartr( o;t1apt  octytlaDem( o t)tltnmo3iotlp rai o s srtoirpnu1op nlfctat) rurxm ;o0aexn f3iaslm2eln ont0aeermo3oo1fmDeln s t0s2toxm3iy1lp   net (faDua(r oo4teeo o3ildlsDrmn p u)tleoxrciotfaD an i;t0 exoxo3nydameemfeslt)srraurooo4olt io3iysfa el(vp (0arenmociotopte nvs t0 2trxopiu1open nvt sf rtau oou4tptn i3ils mDrmu o;t4trtrxr ootlm rlieo;s0 ruoxr nudll  lncta( a2rm( p;t1tltn i3iasls2rl(ms;t4 exnxf iotfp  ln sl( tetm(opnu4alte ncia(fsDtmu o;u4oetn fciltfmDra( pnt)treoxo iadopDrli ols srxrxm oo1om nmnctl()s2tmur nu0opt  ietad a2ra( s u4 rtoxo oo1fpDrai s;s t2trxr3oodlptnlfvsa(fsruaurpoo1texomoeildfsDelump t4 exoxr oytop eanvs s sruoxmpiydolte net t  ruaxm ;o0apeo fetyd m elumpn(4altnio oytom eaies s seuoio3ou4lptelfviasfs2tmxro;o4tptn i3iltlm elnvo (0trtnio tatomDeauei t)teuo(m3nu1op nlies s artr(mp;o0oet mfeilsfs2uanmont0trtrxr3tadlmte ies s) eto(o3io1amtelnctlsfs2raumpnt4aeeomieilsfa ra(ms;(4 lerxo3ootlp  aiesl( trxoxr iodol emivsltfa2taumonu0ope io3iat mDem(vs u0trtomo tadfpD ln o;( setoir io1omt mfeias) 2tm(roou1tptnif3iydfs2ea(ms u0aeermo3ia1faD an olt) etmio3oy4amee nvils s2ur( ont0tex ifeiytlmDra(mo t0aleoiociytopDr i sls) ruoxo nodol nmnctlt  2tm(mp;t0tpxomo3iadlaDra(vs u) reoirciytfp eanvi () euoxm3iu4alt mnctls)a2ua(mooo1texo iciysfa em( p;t)aeerio ootfpt li i;s0 2urxr3nodaleemfvsls) rtm(rpot4oetn o3iadfaDrlu p;t)tlxrxr tydomtean ols) etm(o oy4lp n ivtlt  2taxrp;o0tltnmiciltfsDul(vo;u4alermo tytfpDean i s s2tr(m oodam   fet tf rtmum nt0tet ifciltfm rauvo (0teeoio io1la r ivi;(  2xo(mpou4lmtn fvta(  2tr( p;t4tetnmo3ilt mDul(vsn()alxrio ta1lpteluvs s t2toir3oo1om elfcta( srrmxr nu1tle ii3iat s eanvsnu0trxnxr tytfa e neo ()t2urir3nudlme mictltfsrrmxr ot4aeeoifeildlmDea( snu4tetnifcia1oa eai ilt seum(rpio1llt mnesl(fsrumxmp;t0tlto oeiadfa rl(vo u0alxoxr3todoaDr uvi ( tetmxr io1ll elictatf Dtr(ro;u0tle ifciadfa ra(ms;t) exrmoctytfm  lnvil()trtrio3iy1alenmietls arrmxmpnt0teen i3ildfs2el(mp;u4arenxrctytfa ranvsls)sexo(opnudlmtemiei s)a2taum nu0aetnifctadfs ea(vpn(0 eerif3tadomDraiesls trxo(mpio4ape lnetlsf 2rrurooo1olt ii3tltfs2ra( p u4aexrif3tytlpteai o;s0s2xr(rpoudlpte nes s) Drru oou1aleo f3tysfa2rlump;u4 reoif ootoaD lneilt)trxriopiydal n icil( sDta(mpou4tlxoioeiltlm ul(vs;u)altoio iadfa raneo t0 2xrir3nodap   fesa(  Dumxmpoo0aet mfcilt sDra( o;u) reoir ia1op   u ol()seto(r ny4omtnmivtl(fa2umu  ot1oleo i3iydla2ulu o u) eenio io1late u sl()teuoxmpoydamenmfcia(fsrtmxrpnu1tpe ifciatfa uanmp;()tetnio oy1lm r n ol(0s2xmxmpno4lm nlivils s2tr( pnt0ole mociys s rm(vo;(0alenmo3ootfm rauei ()t2um(r3nu1ol   fetl(fs2raurpnt4apxomictysfa uln on(0tltrmo3oo1fp rauvs;(  rxmimpou1omt  ies t  Draxrpou4tle ifciyt a2ra(vs;t) ltrmo oatlmt  i o;(0 exrir3no1amtn fctls)srrmxmpnu4alxomoctysfm2emnvpnt0tlxoxr ootfpDeli s;()srur(m no1ope  fcsas) 2rr(ro;t0tpen ociysfaDelump;(4 exnio tytop  anvo ()t2toimpny4lm nmnct s)s2rm(rp;u1aptomf3tyt mDelu o;t0 rxoxr ty1la r ivils0 rtoir3oy4ll n ivsa( sDraxmpoo0olxomi3ild s rl(ms ()trtnmo iy1fmt lieols0sruo(m3iy4omeemncsas) rum(mp;o0tet  oeiadfm ul(mpnu4trxoxocoy1la rln s;(0seuoio nu4olt mnvtas arurxmpou0aee  f3iatla2rm(vont) lxrxocoatopDrlivo s teurir3no4ol nlnct t) Dtrumpnt1aeenmf3tatlm2emnmo;u4artoxociotfmDrliei s)texrxo oy1omt lncsl(f 2taxr ou1aleo o3ias s ulnvsnt0 exnxr oo1omteaneo;s)srtrxmpiu4optemfvi tfsDrrumpnu4olxo i3iydfsDrm( o (4alxomr oydfmteli o;t tetmir oo4oltelfvi ( aruru p;t1tlxn iciasfaDulumont0arxoio iotoptran i (0sexrirpoy1om e nvtlsf rtm(rpno4oltn f3iadlsDrm(vs;u4tetoio tadfmD ai ol( texoim iodal emict ()srumxmo;o0tlxoifeildfa2uln p;(4areriociodoaDe nvols0 2tr(opny4ap nlfetat arum(  ;u0optnmoeiasfa rlump (0aetomo3io1lmDran i;(0s2trim3nudom e feil() 2taxrpot0oleo ieiyt a2ul(msnu) renmfctadopteln olt trxoxo3nudlm   ieta(f rua(mpot1oltnifciasla2ea(mp;u0texoif3oa1lpD aiei t s2uriopoo4ap   nes t) rrm(ro;o0ape mfetadfm2eaump u0areoxrcoy1lp   i i t s2tmxrpoodapenmnctlsfaDuax p;t1tlt  fetldfs2rl(vp u0tetoxo oo1op   nvi s) 2xoir3nudamenmfcs tfartrxr nu4tpx mfciltfa rl(vo;u4 exnxo3io1fm ranvo;t)s2xrxmpnu1ll nlnvta( a2trx p;u4oleomi3tytfsDra( s () eermr3iadlpt  n s;t truo(o iy1om emfvilt  rrauroou4tltoifctltlm umumo t)arenxf oatfp r i il(  rxoir oo1llte ivsa()aDur(root4texnioeiysfa2eanvo;u4alxrmo3oodoa  li ol()sruo(o3oydam n fesa()artrx o;t1apto o3iydla umuvont)trtomf ta1om   nvo t  etmxr oy1lmtn fctlt) Dtru  nu4tex micils m eauvsn(0altoio3iatlptrlivo t)t2xoir io1optnmiesatfs2tr(mp;o1tlt  feilt s2emuvo u0aexnmf3iytopDeaieils s2trir ou4amt lnct tfaDrr( pot0aptoiictlsfa um(mo;t)aexnmfctatoa   ivo () eumxm oy4apte nvsa( srtr(rp;t1tlt  ictltls2emump;(4aetoif oa1opteaneolt s2xoir3no1omtn nvsa(f Dur(r ;t1oet  i3iys mDem(ms u0 etoioctotlaDeaneo;()seum(m3oy4aptnlivi t)a2uauro;u0tlxnif3ildfmDum( o (0aleomfcia1oaDran s;() eurxr iy1ap emnes ()srrrx  ;o0tee ifctysfm umumo t)arxoif iydlpD  neil() 2xrim3no4open iei t s2rax ont1tptoifetasfm2emuvp u)trxnxo3tydfmt livils trxm(m io1omtnmfeias  2uaurpoo4openioctatlmDuan o t0alxnifcootop raieol() rum(mpiudoleelncias) Drrurpnu1opx io3tytlmDumuvonu4 etrmo iydfmDrlnvs;s)tetm(o3oo4apeelivtl()sDraurp;u4olx iociad mDelums ()aetoifcoo1lm eluvilt) eurio3nudlmenmneils s2rau ooo0optoifctlslmDea(mp ()teerxf tadlat li o t trtmxr3iy4lpeelfvslt)sDuax  ;u1alenmicils sDeanvo t) lxrxfcoa1fpD li o;( srxm(rpiydap e iesls a2rm(rp;t0tptn oeils mDrl(vs u4tlerir todfpt  nei;s)sruoxr oudlm  mfvs s s2tmx  ;t0opxo feiasfm rm(vp t)tlenmo3tytlat  n s;(0trtr(r3oo4al elivt tfsDua( p;o0open ociytfmDrmump (4tlxnxf3oatlp elu s;t)srxmim ny1am   ivsls)s2umumono0tlxo fetys m2ulnvpn() rxnmr oa1opt an s;t seto(r ou4omte fvt tfarurx  no4optn i3iadla ulnmsnt0aetnmfcoodlpt  neo;() exoir3nydope  fct s aDtmxmont0optnif3ildlsDel(vo u0 eermrciadfp eai sl( s2umirpiudlpt  nctat arua(  ;u0opt  ocils a ua( pnu0 renxr3ta1fa  aies;t0t2um(mpny1lltnlnet sfsrua(m ;u1open o3tasls2uln o u0tlenxrcta1faDran olt)s2tmim3io4lm emnvs t)srua(r no4tpeo ociysla2ulu onu4 etrif to1om   neils) rtr(o3oo4lptnlivtltfsrrau pot0tpen feilt m2rmnms t)aetrxrctytlp eanei;()t2xoxm3no4om  mfetltfaDrm(rooo0oee ii3iatla2emu o t0tetoxr ta1fmt ln s;t  eurim ny4apeemneslsfaDum( p;o0aeto fciytfm2ua(vp;u)aexoioctadfaDe neolt0 rxmxo3iu1al  mfcils)artr(  ;t0oeen ocias s2uanvonu0trxrio3oo1latr iei (0seum(r oo4am nmnvtatfsDumumpoo1tpe  iciys a ua(mpnu)altrxo3oadfaDean o t0trxoirpoydoltemfet s)aDtm( ooo4openmfciltfa2rm(ms;u)tlxnircto1fmD aieo;t)t2um(m3io4lpt lics ( srur(m no4tpe  ietysfs rl(vs;u4aeeoxr iytomDeanei t)texo(m ny4lp  mnvsl(fsruaumpou0oex  f3ilt a umums;t4altrirciodoate ueilt  2xoim3ny4ap nlfviltf rrmurpou1apxomf3tasfm eln o;u4 lxrio3ia1op  au sl()trxmxr oudaltemncs t srtau pot4optoioctld m emuvo t4texnio3oa1lmD an s s)t2ur(o iy1lmen ict sfa2ta(  oo4ale ii3iad a ul(ms (4aeerio3iatoaD au s ( teum(opoo4lp  lieils aDtr(mont0aee mf3ildlsDrmu s;(0trxnir3io1fa raivo s0 2uoir3iu1optelnvtatfaDur( o;u0aexomi3ilt a2uauvp t)trxrxf ta1fateaies;()t2umxm no1ale mfetas)a2rmurpno0optnmf3ild mDeau on()texnmrcio1oaDe iei;t)t2xoxm nydol nmiesa(f rrrx p;t1tlto fetlsls el( ont0aetoxf3iydfptrauvsl( s2xmiopoudame  ieilt)s2rm(  nu0tpeniieilslaDuanvp;t0alermf iytfpDraieo;t)teto(r3io4omeemivil(  Durumpot4olenmoetldfm2ra(vs t)aeenmfctadoaDe uvol()s2urir3iy4amtn fciat)srua( o;u1tptomoetas sDuanmpnt)treoxf3io1om eln s;s) 2xm(m nu1apeemiesatf 2trumpnt1ale ioetldla2um(msnu)trenxr iodlpDrli i ()srtmimpnydom e fvi t) Dumx onu4oetomieiatls2rau o t)arxnmo3iytfm e u i t)texmxmpno1llee fesl()sDra(rpou0aetoioeilt aDrlu o;u4aetomo3to1fateln o;(0texmio ou1lp elnesat  Dtm(r nu0opeomociadfm ul(vs;u0altnmf3iatla eaivs;()teuoxr iydlpe lneiat) 2um(m ;o1aleoiociyd s ranvpn(0artnxfcoa1om  anei;( teurim ou4ope mnvil()sDrm(mono1teenii3iydls2um(vs (0 leomo3oadomD luvol(  rxm(o io1omtelfcils)aDuax  ot1aex  oetad sDel( p ()tltrmo3iydfaDrlu s;( trtrimpou4alt  nctltfartruroou1aeeoiiciaslm2emnvpnu4 rtoxrcoy1fpD  nvsl( srtm(mpnydopee nei (f ruaxr no0tetnioctls a ra(mpnt0altrmo3iytomDrlueols)seuoxm nu1omenlfcta()a2tr(rpnt0aptomfeiyd m2emuvsnu4tlxoxfcoatopD ai olt0teuo(o nu4llenlncslsf Dtrx  oo4apx  feiyt aDrmnmo t0tltomr3oatoa  aueo s) etrio3ny4am n nvi t)sDtm(m ;o4alt  o3iyd s2rluvpn()trtomfcoodfmD  i o t0srtrxo3ny4ape lncias)s2ra( p;u1apx mf3ilsfa um(vp;(4texrio oy1lm rlnei;t0t2xoio oudop elnesat)srra(mpoo4aptoif3iytfa eauvpnu0 eeomr oytlpt lu o;s seumxr3oydapt lfetas s2urxr ;u4opxo o3tatfm2rl(vp;t) etrir3iydlpD  ieol( t2uoxo iydaltemfcs sfartru  ot1oeenmieildls rmuvs ()arxnxfciytoa   nvs;t0 etrimpou4amtelfvs t aDtau o;u4ale mo3iat sDum( s (0 etomr io1omteln slt) 2xrxr oo1ap  mfes ( arurur oo4aleoioctyt aDrmumsnt)aeerirciatlmt  i o (  eto(mpoy4lptn nei (f Dtmu ont0opt iiciytlaDeauvp u)aeeoif3oytoa rlu o s0srtmxo oodamt liviat)a2rmxr ;u0aeto ieild a ea(mo (4aexrxr3oodfaD  neol()seumxr iodoleemfeiat a2tr(  ou1oeeo ocildlaDum(mon(4alxomr oatlat lneolt)truo(rpnudap n feilt a2um(r nt1optnioctas a ra( on(0 ltomrciatfpD lu i;( setm(o3iy4olenmies (faDurum ;o0aee mo3tas a ran p;t)aleomf3tatfmD lnei s trurio3nu4ap emieiasfaDtmuroou0aee moeildfm2uauvs (4arenxf ia1fmteln i;t)srxoir oy4lltnmfet s)srtmx  ot4apxoii3tyslmDelnvsn()tlxrmfcoydlm  au ilt  2xoimpiydalte nci ()a2rr(rpno0oltomf3iytfs emnmo;t0aeeoxfctotoaDr uvol(0truoirpiu4openlncil( srtau p;u0altnmfeiyslm2uluvs;t0 lxrmf3oa1opt lueol() 2urxopoudllenlncsa( sDrmur oo1aex ioeildfa ra( onu4trtnir to1lpDe u o;s0 2toxm3iy1amt liesl(f Dumx pot0optnifetatls ran o;t) lxoxo oadoptrluesls t2xoxr iodop emictlsfaDrm(m ;o1oleo iciytfm2rln p u0trtomfctatfmDeaies;(  rxo(m3nu1al nmivtls srtrump;o4opxnif3tldfsDrm( pn()arermr oodlptelnesls s2uo(m iu1llt licils) rurxmo;o4tpx ifctydlaDrau p t0arermr3to1faDran il( teum(rpoodaptnmfcilt) rtr(m oo1oexniietlsfs ra(mpnu)tlenxrciotop r neo;t0texriopoudale  iet t  rtau ono0open ieiyt a2rmnmp;t) ltnxf3oy1om raivolt)seuoiopiy1apenlnesl( s2ta( ooo0tpe mfciltla em(mp (0 lenmr tytfmtr ues;s0teum(opiy1lpee fetls s2urxro;u4tpenmfeiasla rmuvo;u0trtnxf3to1lmtelivilt)srum(mpny1am emfcslsfs2ta(mpot4olxnio3ilt s2ranvo t0artnmo oatla rli i (0 ruo(o3nu4lptelfvtls arur(r no1alt ioctasfmDrlumo t0arxnirciydfmDraneolt0 2urxr nu4omenlfvsl() rtaum oo1optn iciysla2ulnvp ()artrmo totfmte u o t)sexo(rpoy4lpen iesas) Dtm( p;u1aex mi3iytlm ra(vo t4teenxfcootfptraivi;(0s2urxo io4al nmivt (f Dra(mpnu1aex ioctyslm2rmnms;t4 exrif3iadoa e ies ( srxo(m ny4om  livtas aDumurp;o0opt  fetld s2em(mo t0 reoxoctytlmt livilt0s2toiopnudlm e fct ()aDtr(mo;t0opx ifetydls uanmpn()aexrmr3tatoaDeanei;s  2xmio3oodomeeliet s a2rr(m nu1apxnioeiys a2ran p t4teenxfcoatfatranvslt0trumiopnudamte fvt s  2uau ono1tleomieiasfa ul(vs;()tlenxo3oadla   u o;t s2xmxm nu1lpe micsls srraxm ;u1alt mfetyt aDumumsnt0texrifcoodlmtr i ils s2tmio iudalt mnct t)artmx o;u1tleomictlsfaDul(mon(0aeermo oadfatrlu ilt0teurio io1am nmfei ( a2rm(r ;t4aptoiietldls elumsn() ltomocoatoatelivs s0teuo(m oo1ap nlieta( aDtaxm ou0tlx  o3iytlm2eaump;u0trerif3to1oaDraueol(0sruo(opoudop  lnciasf 2uax oou4teto ocilsla eanmsn()aeerxociatfp e nesls  euo(r3io4lp
\ No newline at end of file
@@ -0,0 +1 @@
+uvs;s0 rxoxrpiu1ol   ivi (f 2tr(mp;u1teeoifciltlm um( p;t) lxnmo3ta1opD  nvo;s s2uo(opoy1ol nmfetlsfartau  ;t0apxo icils s emuvo (0arenir oytfm   ieilt)s2uoxr3nudapte netls) 2tmur ou0apxoioeiysfm2ra( s;u) rxomr3oo1oatr ueo;t)trxoio no1lm elfeia(  2taurono1oee  fetyt sDulnmo u)aetnio3iotlmt  uei;s tetmim3no1altnmnvsa() Dur(  ;t1olt mo3iys s2ranvs;t4aeenxo3oytfp  ln s;s0trtoxr3ny4llee neiatfs2tmurono0aeenmfeilt a ra(msnt0 eenmf oo1om  an i;() 2xmimpiu4alen ics sfarrruro;t0oee mfciatfmDuan p t)tltrxf3ia1opDean o;s tetm(r3iydameelivsltfsrrr(monu1tee  iciyd aDemn snu0arxoxr3iadom r u i;(0 2xmxm3oy4olt lfetl(fsDua(mp;o1tlenmo3iadfm2rm(vpn(0trxnif3ta1fptranvols  etrxm iy1omtnlivs s)a2ur(  ou4tpe  feiys sDrln p;t4tlenxr oa1fa  lieol() rxoiopny1openlici s) 2rm(m ;o4aetomocias aDul( p ()aetomo3oytlm r n o;s setmir3io1ale  iet s)s2rr(monu4opt  octytla2umu s;u4tltnxr3oadfm r neil(  2toxopnydom elicilt  Dra(ro;o4aex iietad s ul(ms t0aexoxociotlaDe u il()trto(opno4alenlfvtat)aDrm( ont4aleo i3tysfaDel(vp;() rtrifctytfmtrlieo;(0tetm(m oy4lmee fei t sDrmxrpoo4oee  o3tltfs2ul(vp;u)tetrifciytlatr nvols  2uoim no4lmen ivtl()s2rrum ou4olx mf3iatlaDuln p t0trtnxo3iotla  aueo;()seuoim io1al nmnes ()s2raxronu0tleomi3iltlmDrmumsnu) rtnmo tydop raivi;(  2uoxm nudllee netltfsDur( p;u0openii3tydfa2ea(mp;u4arxnmfcio1oa  lueo;(0srur(rpoodamenlnvils)srurxro;o4tle mf3iyt s2ranvon(4 rtoxfciydlm e u o;t)srxrxopoy1lm nlfesat srtr( pou4olxo o3iydlaDelumpnu) rxoxo iodfpte ieo;t0t2to(o3ou1op emnvs tfarraxr oo0oex ifctlslmDelump;(4aeeoif ia1lpDrlnvs s)t2urxm3ou4amen ieilt) rtauroou4tpeoioeiysfsDuan o u)teerir3iatfm rln il(0 rxrir3oydom nmnesls  Dtmxroot4tptoif3iydla eanvs;(4trenmfctytopDe u s s) rxriopio4llee icia(fs2rmu  ;t0ope mf3iytfa2umn pnt4 lenxoctatlatelu o ( t2trimpoy4am emiciltfsDrm(m nu0tetnmociad a2elu s;()tetoio iy1op  au o t)s2uoim3nudlpt lfvs (f 2tm(rpnu0olx moetlt s2emump;t)alxnxr ia1fp eluvo s teto(r3oo4lmtnmnesatf rra(m no1openiieiytfs ra(vs;t) lerxf3to1fptelieils0s2uo(m nodlpenmfviat) Drmur ;o0altn i3iltfm2ea(vp t)aleoxf3oo1fpDrluvs;( texoim oo4oltnmnvsl(f 2raxm ;o1aex mieiytlsDeauvs;u4tetnmo3oo1fm rlu slt s2tmxo no4lpe mncias  rua(m ;o1tpeo fctasla ranmsnt4 lenir iydlmt lneil( t2uoxopio1amt lfvilt) Dur(r oo4optnio3iyslmDemnms (4tltoif oodfpt ai o t0 exm(o oydamtnlfctls srtau pnt1alx if3iatfm rmump t)artomr3totoaDe nvi s0trtmio3nu1al nmnvtat  Dum( poo4aptomfctys m rmu on() exnif3oadop e ivsls0sexmxm nu1amt lncs s)srtrumpnu0tpeoifctltla uluvo;u0treoxr3totla e ies;s teur(o3oodaptnlfesa()a2uax pno4tpen ociasfaDra( snu0trerir3iy1lmt  uvs;t srtmim ou4ope lnvtls)aDtr(mpou4tptoiictytfm2emnvpn()teerxf3oatfpt li i s0setr(opoo4lmee ivi tfaDrax pot4aleo ociad s rm(msnt0tleoxr3ia1fmtraieo () euoir nodam elfesltf 2rrurooo0oltomictatlsDuauvs;(0 eeoxociotom  an i t)s2xm(mpno1opt lictltf rururo;t4oeenmiciad s2rau p t) rtrxfciy1opte neo;(0trtrimpnodom nmfvsa(fs2taxmoou1aetomo3iys a eanmp u) exrxr3oydopt lneslt srurxr3iy1lptn ivtas)aDuru poo1opx if3tatfm2rmu ont0trtoxo iytfmtrluvi t0sruoir no1lltn nvta() rtmxrono4oetnmoeiadlmDrm(vpnt)trtoxfcoatop eauvsl()s2xoxrpnodomeelnctls  Dur(rp;u1ope iictldls el(vs t)tlxrmf3iodla eaueslt texmxm io4omte netas aDtau  ou0aeeoio3tadfm ul( p ()altnxfcoo1om ran o t  rto(o iy4lmtelfvtltfarumumo;t0alt ifciltfm2emnmp (0 ltrircoo1lat  ivo;t) rtoxr3ou4al elfvta() rtrx onu1tle iociasfmDemnvs;(0tleoir3oo1fm e nvo s) 2tm(o iudom eliet s)aDtrur ;t1tpeo feild s rln onu) renmf3ootfm  livs s0s2umxo3nu1lp n neiat  rumxm ;u4aeeo f3tls s ranmo;(0aetnir3todlateaneslt) rxr(rpiy4om elnvtat s2tmx oot0aexoiieiatlm ul(mp (0 rtnxo3ta1lmte uvo;( s2xr(m3nydlmtnmfesasf rum(m ;o4open iciydls2em(von()aexrifctatoaD  i s s0trxrir nudlm   icil( sDta( ooo0tpxn fctls s rmn o (4aeerio3iytoaDr i olt0truoxr3ou4om nlietatfartr(mo;t1tpeomfctys sDumums;t)areomo todlpt  u s;s srumim no1amenmiet tfarraum no0olx ifeiyt a rlums t4alenxo3tadlp eaueo ()srxrxo3nu4lmen ivil(  2rmxrpoo4apx  oeiysfm2eaums (4tleoiocta1opDr i i (0s2tm(rpiudomt mncs ()sDra( ono0oex  ictas m2ua(mo;u)altrio3tatoatr ivol()tetoxopno1op elfvi t)aDum(rpou0oetnmiciytls2ul( p;t)tltoxf ia1lpDr u ol(0seuoxrpno1ll emfcsat s2tm( o;u0aetomicild m elu s u4 lenxfciodfaD  uvils0 rur(o iy1lmen ictltfsDraxronu4tlt mf3iad s uaums t)teenmr3iy1fa  aueil(0 rtr(r3iu1ll nlics t)sDta(mpno1opx ioetld a2rlnmonu0aetrmr tydfmDr i s s0trxoir nu1aptelnviasfaDurur ot0tee  fetas sDumump;(0aleoxfctadlatr neols trtrxr3iodom elivs s srtrxr ou1oetnio3tltfmDeaumo;u)teerif tadla e n i s0trtoxo io1altnlncs s arumxmp;t1oee ioetatfaDrauvs;u0tleriociy1lmte ieo (0s2xmio3nu1lp  licilsfsrrrx  ;o1tleo i3ilt s2el( pn(4trxrxrcoo1oateli ils0t2xrirpny1lptnmicsatfarur(mont4oexoiictaslsDrm(mp (0areoio3oytlmD li ils)trtm(mpiu1om nlnctls)aruru o;t1oleomi3tas m2rau on(4texrxf iodfmDe n olt0srtoxo3iu4optemneils artaum no0tex mf3tyd a uluvs;()trtrifcoytoat auesls)s2urxrpiydlptn ict () 2umxm ;o4altoio3iadfsDuauvsnt4 lxrxocia1oateaivolt trum(mpnydopte fesat sDrau pou0tlto ieiydfa eluvp t0aetoiociy1laDrlneol(0srxoir oo1lp e ics s a2uru  no0tlt mfeiadlaDrl( snt0arerxrciodfmtrln olt)teumxrpnydlm n icslt srtr( oot0tlen ociltlaDrl( s;u0 exrmf iatlm eluei;t  rurxopnydamtnliei tf 2rr(mpou4aptnif3iytfaDumnmp;u0 rxoif tytoptrau s (0truoirpoydlmt livs () rtmxro;t4teen oeiat mDean snu0tetoxr iytlaDe u s;s0s2trxmpno1lmee nvi (fartrxrpnt1oee  ietytlm ea( pnu0alxomrcoa1lp  lueil(0 2xmxopoo1ap  mnvilt) rtmxmpou1ope micildfs umnmo;u) lxoxf3ia1faDe ueils trtrxopnu1apt lietl()a2ra( oou4apxo oetys mDuauvont0 renmo3ty1omt ln sl() rum(r ny1lp e nei t)arurxmoot1optn f3iys s rmnvp;(0aexrmr to1fpte ieo;(0 exmxm3oodlm n ictas) 2trxronu4aeenmoeilsfa2rl(mp u)artrir iadoa e ieo;s  2tmir3oy4am  mfvsat)a2trx  ;o0aetn o3ildlm um(vonu)areoxoctotoa eanes t setrxrpoudlptelncsas) 2ur(rp;t0tetomf3tldfmDrl( snu4tlenmo ia1lpDraivo s) exm(opio4om  mnctls)arurum ;o1opx  icildfaDrlu pnu) rtomrctadfmt anvol(0teur(o3nydlp   nvtlt  Dtrur ;u1altnifeils sDelnmon()teerxr3to1op rln o s seurxm ou1ap nmfesls a2rm(monu0opeomiciatfa2uau p u0 ltoxocoytfa rluvs;s seur(opoo4olenlfvtlt sDrm(rpno4aeeoifciat s eanvo t0arxrxo iatfaDraivsls srtriopoo1op elfvsasfsrtmumpno0opeoifctatlm2emn o;u4 ltoxr iytfpteliei;t s2uoxr iy4lp n nesl(  rrax  nu0alxoiociatlm2rluvs;t) lxoxocoy1lmt lueils)sexmxm3ny4om  mivilt)arumu ont4tlt ioetld a2ua(vs (4altomrcoy1lpDr ivi;t0s2umim3oo1optn fvias a2raurpnu1opxoiieilslmDumuvo;u0 ltoir3oy1lmteanei ( srxo(r oy1ll  mivi ( srrmumonu0oexoifeiltfa2eanms;u0trtoxf oo1fptr i ils)texoxo nu4lmee ivt tf rtmu  ou4aeeoiiciad m2elnvp u0alxnifcoydfa raneo;s)teurxo3oudlp  miet sf ruau ont4tlx mociadlmDem(mpn(0 rtnxrcoydfm rau o (0seurxrpoodllt livil()arrm(mo;t1aeen oetydlm2ra(mo t)alxoxr iatfmD auvi;s0s2uoxmpou1ap  lfvs () 2tmxm ot1oeenif3ilsfsDrl( s () rxnxo3tatfatraieils)t2urxrpiu4olt  ivil() Dua(ro;t4opto ociyt sDem( o;()tlxoif totlp eln s (0 etrxrpiudlp elnvias) 2rau p;u4tpx  oeias s2rlumpnu4aleoifcta1optranei;s0srtrio iu1lptnlnes ()srtrxmp;u4opxomi3tys s ua(mp t)tetnif tatlmDr ieo (0s2toimpiy4ameelietas) rtrx ono1texnioeiad m2emn p (0 rerxfcio1opteaueils sruoim3iu4ap emnvil(f 2rm(rp;u0ale iiciatlmDrlumo (4altnmr tatla rln ol(0 2toxo3iodlle lfei s  rumuro;t4aee  f3tld s elu p t0trtoxrciotfp   ues s)s2tm(mpoo4olenmfesa(f Dua(  no0tetomfeiyslm2ranmont)alenxo ia1fpD ln s;s0 rtoxm nu4lptnlnet ( s2ra( pot1alenmociltfaDrmums;(0trtomfctatfp eaivi s seurxm3iudam nlneiat)arur(roou0apx mieiydfs2emuvont)trxrxf ootoa  li s;t)texmxo3io1op  mnet sf 2urx poo4teeomf3tys mDulums (4 ltoio iytomDe i o;()t2xm(opoo4amee iesltf 2trur no4tpxomoeiatfmDraump u4tltoir3oo1la raiei (  exrim3oy1opt  feia( s2ra(mp;u1tpxnmfetlsfaDelu on() ltrmrciatlm eluvsl() 2xoir oy1alen iesls)srrrurono4tpxnmieiat sDrm(vp;t4aleoxo iydop  lnvi s s2tmxo oudlp n fci s  rrrurpoo4ole  f3iyd m el(vs u0alxrifciodop   nvs t)texm(m3ny1llenmncs (fsrrmurpnt0ape ifeildfs2uanvp t)teermocoytlmDr ieil( teumxo3ny1lmenmnvilt)arumxmooo4tpx  o3iydfmDem(msnu4aeermoctadfp raivil() etriopoy1lmt  iesa( sDumx  ;u4ale ifeild s um( s u)tetnmocoatom eluvs;t  etoxr3nudll nlncil( sDta(  ;o4teeo o3iadla rmn pn(0alermr ia1lpDr uvi s t2xoiopoo4amenlicslsf 2rm( p;u1tpt io3ilsls2eln ont0tleoxfctodom eauvs;s0 etoxopou4aleemfci t)arraurpnt0tex mf3ildfa2eln p;u) etoif3tytopD anvo;t  etrimpou1om elfvs t)sDta( ooo0opx  i3iatfa2raumon()alxomfciadla  lu s (0t2uoxm oy1omte nviat)s2rrum ou4apeo o3ilsfa rmnmsnt4 eerxr totfpDelueolt) etrirpoo1am nlfet s s2raxr ;t4opxnifciad m elu o u0 lxnmrcoatfpDean olt)s2tmxr3nu1omeemics t)s2um( poo1ole ioetasfs2uauvpnt0aeerxrcoy1fatr i o s teurxm nodopte fes t aDraurp;t4aet mociatfm rmn snt4aeeomo3io1oat  ueol(0 2xr(o oy1amenlncsas)a2tr(  no4tpt  fetas s2uln ont) eeoirciodlmDranvo;(0 2tm(m3io4aptemnvilt)srurxmono1openmi3iytls2eluvsnu4trtriocoytlatrlu o s)texo(m ou4ape  nvtas  Dtmu  nu4optnifetytla2rlnmon(0aeenir to1fmtraivi s) 2um(m3nudoleeliesl(f 2umur no0apeo octytfmDrmums u0texoir tatlptraieo (0s2xoxm3ou1al  mfcsltfarua(mp;o0optoiociatfm2rauvsn(0 lxomo iatlmte ues s0 rumxopoodaleemfcils)s2um( ooo0tpx  i3iyt sDulu o;(4tetnxfcoatfm rlies (  rurio iydomenmici sfaDuaxmp;t1olxoiietlt m2emnvp;u0 exnxf3iatoptran o;s0tetmxo io4lme mncilsfarrmx pou4aet moeiytlm rl(vonu4aexoxrciytlp   ues;() 2trio3io4ape  nei ()srumxrp;o1alenmfciatfsDraump;t0 lxrio3to1lm eluvi ()t2xmiopnu4lpe mfeils sDtmumont0oltoioctatls2emnvp (4 eeomrcoytlpteanvo;(0srxmimpoodame  fesa()srra(mpnu4tleo o3ildfa2uanvs t4aeeoio tadfpt lu s (  2trxr3nydaptemnctasf 2trxr ot0aexo ociat a elums;t)teerifcty1fp elues t trtmir iy4alen nvia()sDumxrpot1oexnmo3iydla ea(vpnt) rxomf3oadoaD  nesl( texoxmpoydom  lics sfsDtau pot1olxn o3tatlmDuanvp;(0altrxo totfm  auesl()sexmxm nudopeemnctlt) rrrurpno4tptnifctyd m um(mon()tlxrmr ta1fptrauvi t)tetmxmpio1lpe  fct s)srraxmo;o4tex iiciasfm ea(vp u) lermociatom rauvi;( trto(o ny1al n ietat) 2umuro;o4olt  ociasls ra(vp t4aexnir tatfmt  nvol(0tetoxmpnydalenmivt t) 2ta(r oo1tptn fetydfs2ranmpn(4 ltoircoydfpD ai i (0 etoxrpny1lmtelfei sfsDuru p;o0tltnmi3tat m2eanmo;t4 leomrciytfmt aies t  rtrir nodam   net t) Dtaxr ou0alx ioeils mDeanmpnu4 lermr oodom  auvslt  rxmiopou1apt livtl(f rraum ;u1alt mfeiad sDelnvont0tltrxf iotlpDr uvils srtm(o3iy4am e feils)s2ta( ono1opx iiciytlm2ua( pnu) lermo ta1omDranei;() eurir3nydal  lfvs () Drm(r ;o4apt if3tld mDem( o;t0 lxnxo3ia1lmDraneo t0tetoxmpnu1om emnet t)srurxront1olxoiieiatfaDelnvs u4texoio3ty1om elu s;(0t2um(o3iudlpenlfcsasf 2um(ro;t0texnmfeiltfa um( s t0aetomfcoa1laDeau s s)srxoxm3oo1apeelnct tfaDtmu poo1oee  oetldlmDrl( o t0 rerircoa1oaDr n o s  2umxm no1am   icil()srumump;u1tee  ocias aDuanvs t) exoxf3to1lptean s;(0seuoir3iudlmeemfvs sfa2trurp;o4oltn fciysls ulumo;()altoir3ia1lptr n o;s0texr(mpnu4ol  lfvilt  rraumpnt0tpx mfciltlmDuauvo;t)tlxnif3tatomDrlivilt t2trxopnodop e ict (fa2rmx pnu4ope if3ild sDelumpnt)tetrmfctadlatraueol(0texoxrpiudop  lnvilt)a2ta(mpno1tlx  feiysls2el( s;u4 lenif3iy1fpDeau o;s) rtm(r nu1amt lnet () 2taxm oo4tleo icilsfm rlu s u0arenmfciotlpte ueo;s  2to(r ou4al elncil(  2rrxr nt1tpto i3ilslm2ua(mp;t4arenmr iy1omtean o;s  exr(rpiu4aleemfciat)s2umu  oo1tleo ieild s2elnmo (0 exoio3oy1fm eai il( srxrim3iy1om e nvi s) Dtmxrpno1tptnmocils s2elnmo u4aeenir tatomtr i o;t)srtrim iy1altelnetlsf 2rmxrpnt4tpenif3tad a2rauvpn(0aexnmo to1fp e ivi s)truoio io4amen fvt tfaDuru  ;o0oeeoioeiat aDra(vs;u4altoxr oydlpDe u o;s  2uoim3oy1apt lnvilt) Dumxmono1tptomictysfa ranvp;t)texnio oodfm eaneo t0 etrim ny1lp nlnes s  2uaumpot0tee mfctatfa2uanvsnt0altrxfcoo1opteau sl( sruoxr3oo1ole mfcias) Duaxrp;o1opxnio3iasfa2uau o u0texnif oy1oaDrliesls)srtmxmpno4olt mnetl(  rraxm ;o0tex moeiys s ra( o;u)tlenmr iatop elueo;t  eto(r nu4am nlnvta()sDumu p;u0aeto feiadlm2emump;t4tltnxf oydfmDr u sls)s2xr(m3iu4llt mictat sDua(m nu0oltnmi3iatfm um(mp;t0tlxnxr3tytlp  an i (0seuoio iydlpte fcs t sDtm(  ;t1ape  o3iat sDra(ms;t) leoxfcoa1op e nei;t0sexrirpio4apee ncil() rumxrpno0olt mieiytfm2ua( p;(4areomr3oy1lpD ln ilt)setmxr3iu1ope liviasf 2umxmpno0apxoio3ildfs2rm(vp;u4 leomr oadlmDeanvs t)trtoir ny1ope mfvsl(fsrtrxr no1apenmfctldlsDuanmp t)teerir oatfa r u i;s0 2uoxo iudam  mnvsl(  2uau  ;u0opxn f3ildlmDemu o (0tlxomo3ia1optelnes ( trtrxr3no1apenlnctat)s2ua(m oo1altnmfeiad m ulnmp;(0arxrifcoydfmtelieolt srtmxmpnu1ol nmnvi t) Dumu  ot1aeeoii3tls s rluvon(4trxomr todomtrau ols srxrim oy4apt livi ( s2tmxm ;o4oetoio3iydls2umnmont4trtnmf3oytfp r ieilt)setr(rpnu1op  mfvsas sDurx ooo0alenmictat m uln s;t4 leomo iadoateln o s)trtmir iy4omeemfes sfsrrrur nu1tleomf3tadlm emu p (0 lxnir oytlptean olt t2tm(o nudapt micil(f rrmxmonu1tlenifctaslm2uluvs;() eeoxo to1lmtrai s t0teum(r3iu4opeelivi ( s2tmuront0aexn fetasfsDrlnvo () renifciydlaDrau s;s) rxmiopny1am   icias) rurump;t0aex iiciytls em(vp;(4 rxniocio1laDe nvs;s  eto(o3iy4amt  fesas sruaxrp;u1oexoio3tyd sDeau p;()artrxr3oatfp  au o;( srto(o oo4optnmfeiat s2ra( p;t1tetoifeiyslsDelnvo (0 etomfctadoaDrlu o;(0 2um(r io1ol eliesat)s2taxrono4tptomo3iys a ua(vs u)trxrio3todfmD  u o ( texrxm3nu1omenlict t s2taumo;t1oetn ociatfm2emu p () leoxo3oodlmtrlu s;t)srxm(o3iydap emnes (f rrm(ro;o0olt mfciys s elnvs u) eenxr to1op r ivol( trurxm3oodom   ietasf Dra(r ou0teeoioeildfa2em(mo;()tlerir3iytfmtrln ilt s2xoxmpno1amt  ncslsfarrm(rp;u4teeoii3taslaDeanvp u0alenmr3todlpDelu i;t0s2urxr3iy4ome  nctlt aDtm(r no1tpe ifeiadlm uanmp ()arermo3oo1fp raiei t)s2xmxm3ny4op nmnesat) rtr( o;o0tlxomf3iltfa2emump;t) rxnifcoy1fa eln ilt)seurir oudlmt  ictl()sDurxm nt4tpeniictltls2ea( p ()teeoio3oa1fp rlnei s  2uoxmpnydlp e nvtls aDta(m oo1ope iieils a ua(mo;t4teermr tytlmD liei s0t2xr(o3no4lme micilt aDuru ont4oet  ieiyslm uln p;t4tlxnmo3iatlptrlivo t0sexrxm3iu4lmtnmfvtls  2ua(r nt1oetn o3tydlm2eauvp;(4artrmo oo1faDrai s t)sruoir3nodopen iet s s2ra(mo;o4tptnmo3iysla2ul(vo;u) rtoxr tadoateau o t0trurxmpoudameemfvtat  2urxro;u4oeeo o3tls sDul(ms u)arxnmf to1laDraieol( t2xrxr oudlltn ncslsfa2ur(mo;o0tpe  ietlslmDem( o u)artnio oatomDeaivs t) rxr(opny4altn nvsl(faDtaump;t4olxniiciysfsDelnvo t4alenif iotlm elnvslt)trxoxr iudlpenlneilt sDrmx o;u4tptomf3iytfsDrlums (4areoxo iatlmD lnei ()sruoimpnodolt  netasf Durxmp;u4alxomi3tydla2emu o u) lenmociodlpD  u s;(0srxr(r3iydole  fcs (  Dtaurooo1olx  oeiysla2ul(vonu)tlerxocoadop elivol( t2toxr3io4lmt lneiat arurxmo;o4tptn oetldlmDelnmp (4 renif3tatfmtelivo;s0 exmiopny1lptn fvsasfartru  ou4oltniictlsfs2rln p u4 ltnmf3ootfmDelueilt) rtoio nu4lltn neia( sDrrxmo;u4ole mo3ilt a rlumpn(4 rtrxoctotoptr uvols texrio oy1aptn fetls a2rau p;t1aetoio3tydfm2ran o;u) lenifciadfpDrauvi t  2xr(rpnudlmenmnvias aDumxm oo0ale  oetydfs2uau o t0trxrxo3tadfpDr n i s trto(r oy1olt mnctls s2taur ;u0oetn icild aDua(ms;u)teenio iotomt  ivo;s s2tmimpiy1amte ici t)arrm(moot1tpxn o3iatlm rmn o;t) eeoir to1fpD  nvo;(0 2umxopno1ol nlfeiasf 2rr(  nu1apen o3ild mDul(mpnt) ltnirctadomD luei;t  rurir3nudapt liesa() rrrxroou1tltnifciatfs2ra(mp;(4texrxf3ootfpDr ivo;() exo(mpoudop nmfctat)a2trumo;t4tet iieils m elnmo t0arenxfciytomt an o;s0trtrir oy1lle  fet t srua(m ot0tpenmoctatfs el(ms;(0altrio3oa1fmt  nvsls)texrxopnu4aptelnvia(fsDrr( oot4aee ioetltla uau s (0 rtniocoy1la eliei s  eurxm ny4llte fcsl( a2uauro;u0alt mo3tldfs2elnmp;(0teeoxf3oatomDrauei s)trxmirpoo1ol  lnvtat) Drr(  ou4tlenmfeiatla ulums u4 ltoio totfptrlu o t)trumiopnydomen fcilt) rrr(r no0tet mi3tltfa ean p t) lxnxf3ia1fa   u i;( t2xrim oy4ll emnvsltf ruru  ot0tpe  ieiatlaDrln p;t)trxrxocty1fp e ueol(  2urxrpnydlmtelfvsls)aDtau p;u1oetn iciyt s2el(vpn(4tltrmr tadoatr n sl() 2uoxo iy1opee feil() Dtrxm ;t1oex ii3iyt a2eln p t4arenir tydlate nvsl( tetr(mpoo1lmt lnetl( srtmurono4olx iiciad s eluvpnt4trermo3iy1omD  uvils t2uoiopnu1oltn nvta(fsrrrxmpno1tlxnioetatfmDul(vo;u4 rxnmr3oytfa r i s;()texoxr3oo1lpee ncs s  2tr(  ot0tpt mf3ias a2rluvsnt) eermfciytfpDr uvo (0setoim iu1am   nvs (f 2raumont4tlt io3ias s2elu pn()trxoir iytom r ivo;t) etoxr iudlpee ivsls a2uau oot1texoifciydfs elu pnt)tetrxrciy1fmtelieo s) exmxr ny1ol   feiat  Dtrxront0aleoiietasls2ra( p ()tlxrxoctydfa eau i s0 2umxr oydomtelict sfaDrrxmont4opeomociasla2eln pnu0 leomrcoatfp eai olt t2xmxr3iydope  netas)arurur nt4texo feilt sDrmu sn(0aexnif3tatlatranes s  etrir nodlmee ietls)aDurumpnt4olt ifctldfm2ran o u4texoif3totfm eaies (  2xrxo no1lpenmnesasf Dtrx  ;o4tlt mfeild m2eanmp;(4tltoxo oytfmtelu s t)sexoio oydoleemnciat srra( o;o4oeeo o3tldlaDumumo (0alxomr3iytop elnvo s0trtrio ny4lpeemivsas) Dtr(mono4tet  o3tysfm2emuvs;t4treoxr3oa1optranes;(0t2ur(r3oydolen fet s  Drmx ono0oeenmoeiatla uan o (0tetrxfcoodopt ai ils0t2uoxm3nudlleemfcia(  Dumx p;u0tlx  ociyslm2um(mo;t0artnircoatlatrlues;t)s2umxopnydal emnvsl() Duaxro;o4aexoifciys m em(mo;()trxrxo tatlm  luvslt)teur(rpoo1altnliviat a2ur(mooo0tet ii3iltfmDeauvp u)teenmfciatfmt  ivilt s2tm(r no1op  miviat srtau  nt1aleoifctldlaDeluvpnu4tlxnmf oa1optelnesls) 2xoxmpno1ol elnetlt  rrm(m ot4tpxnmieiatls2umnvp;t0 exoifciydfptr ies;s)srxm(o iydll  mncsatfsDra(  nu0opxo o3tydls ea(vp;u4 exomo oydop  au s ( sruoim iodap n fesat srumxront4opx  feiysfsDea( p (0 exoxr3tatlm elueo s truoio3nydlmtnmfvt t aDumxrp;u1opxomfciltlm2uan p;()arxrio3todom e n ils)teumxo iy1lm nmfvsas)s2raxmonu0optnii3iyslm ranms;u)aexrxr io1fm  aueslt trtrim oy4amte neils  rrmxr ;u0aetniociysfs el(msn(4 rerxociytfa r u o (  2umimpoy4omt  fei s)aruru  ;t4opx ioctytla ranvpnt0texnmr oo1lm  auvs;( t2xoiopno4lpeemfctls sDuaur no0texomo3tys a2el(ms u) etoxocoadfaD aivi t trxm(m3iodom n nctls artm(rono0apxniietytfa uau p;u0trerir ootfm eau ilt)trtr(r nu4aptelfctls  Drax  ;u4oetoifciatfs ulnmo;()teenmrcoy1omtean o t texmxrpnydll elfvs (f Duaxmp;o1aptoiietysla2el(von()artomfcoodoa  auvs;(0 rxoir3iodlmt  ictls)sruaumpno0aee mfetadlaDelnvo t)alxrxrcto1fmtrln olt0sexrio ny1olen ivils) rtrumpnt0aeto o3iasla2uauvs;t)tetrio oo1fm e uvo;s0 2tr(rpiodomenmfvtas) Dumxmoot1tpeo ociydlm uan sn(4altrirciydfm  aies;t  exmiopoy1amt  ictlt)a2rrxr ;u0aeenioetas m2rlnmpnt4aeermf3iytom eaneol(0texoim3iy1am emfeils a2rmxro;t1aexn i3ilsfa ulnvo u) renmocoa1fm r u il(  etoxo no4open fciat aDrmx onu4altoiocilslsDrl(ms u0 eeomrciotlmDeaivs t0sexo(r oo1llt lfviat)artm(rpnt1tex ifctyt m2elnmo;t0aexnif3oo1omDran s (  rxo(m3oo4al emnet t srrax  oo0aeeomieildfa2em(vs ()trxrxr iatlmDr neo t trumxmpnu1lptelfcs tf Duaurp;t1alx  f3ils sDemnmsnu)arxrxr tatla eluvi t0srumiopiu1op n neias  rrax  nt1aeeomi3iytfm2em(vpnt0 rerxr3tydla   nes;(0s2xoir io4apt mnctas aDuaxm ;t1apxoioeilt m2raums (4arxrif to1op eluesl(  2tm(o3nu1lptemictasfs2urumoou4tle iietytls2elumsn()alenif3oytlmtelnvs s0sexmir ny4lptnmivtlt)sDta(monu4aeto ieiydfm2rlnvs u4aexomf iodoptr nvo;s)seto(r ou4amtelnvtl() Drmuro;u4opxnmfeilsfm emnvo t)altnmfctydfat lu s (0setrxrpoudlp nlncsat) rumxrpno0alxo oetys a2ea(vp (0 rxrir3tatlatrluei t0teur(mpnydaleemfvt s)arraurpnu0alxnmo3tydfm2em( snu4tetoxf oydlmDrlivs ( sexoio3nodopenmncsatfartru  oo0apenmi3tatls2ul(vp;(0trxrmo iotfp r n o s  2umio3iu4aptnmiesls)arrmu  oo4tpto feiysla umump u4trtoif tatomDeai s (0 2urxr3oy4amte nvi (fs2tru  ot0tpe ifciltfaDemnmo t)aeeomo iotfmtelu o;() etrio3io4optnmicsl(faDtmurpnt1oet mieias a2ul( p;()arxnxrciytlpDrlneo;s)s2xr(r io4alen ici s)srtr(m ;t1ope mf3iatls2el(mp;u)trtrmfctydlaDrlivo (  eurim3no1lm  lici s)arra(mpnu1oetoii3iys m um(vont4 rtrmo3oa1oaDe ieo s) rumio oy4am emict (fartru  ot0oex mieiytlmDrmnmpnu0 etnxo3todlm  ai sl( t2xr(m nu1al e netatf 2tm(m ;o1optnmf3tldfa2um(mp;u) lxoxfcia1fp  an o;() 2tm(m3oo1ol n feslt arua(  ;o0oetnifetat sDulnvp;t0 leomfcoodlpDran ils)teuoxmpiu4lptelnesas)s2rr(  ot4apx mictat s2rm(mo t4teenxociatlpt livilt setmim3iu1lpt  ncsl(fsDumur ou1opx ii3iytfm2eau s;u0aetoio oa1fatrln i t) 2urir3ny1lptemfctas a2uaur nt0aex  feiadlaDuluvont4alerxf tytlpD  nvslt0setmiopiodalt  nes t) Duaxr nu0aeenmfciys a2rmuvonu0 ltnir3oadfmt  uvs () exrxr3oo1am n fet s sDtaumo;t0opt mi3ild a elu onu)aleomr3tytfmDrlnesls seuoir3io1llt lnvi (fa2tax  nt0aet moeildfm uanmo () lxrxo3tytfaD  nvi t)s2xmxrpnodop nlfvsa( srrauro;t4optn oeilsls rmu s (0alerif3ta1lpt aieols)s2toim3iu4al nlnvsl()aDurxrpno1alx mfeiytls uan ont0trtnio iotla raivil( seum(r iy1ame mfcs () 2ta( pot4texnifcilsfs2emnms;u0 exnifctytla eln ilt  euoxr3oy1omtnmiviasf Draumpoo0aet  f3ias s2emn s ()arxnmo ootopte ivslt0sruoio nydol n nctat srtaxm ot4olx  i3tad a2rluvsnt) lxoio ty1oa r ieo s) 2triopoydame lneias) rtrxmono4opxnmietadls ea(vsn()alxoio3iydfpt aneols0 rtoxr nu4omte ncs (fa2rr( pnt4oetoiiciaslm2rm(vpnt) rxoxf3iy1laDraivo;t0tetoirpoy1ap n nci (f Dtr(ronu4optoiociyt s rm( o;u)tltrir to1opt lu s;t trxmxm3nydop   iviat) 2trurpoo1tex iietatfm rlu p u4artoxr iotlpt lnvo;()t2xo(opiu4ape  fetat) rtaxmo;o4olenmo3iytla el( o;u)tlxrxo tydlmt aieo;t) 2xmim3nu4lm e fetatfa2ra(  no4oleoio3iadfaDuau s t0 lermrctatlpDean o;s)setm(m iu4om nliesatf 2rr(mpnu4aeeo ieiad sDeau pnu0aeerxrciodoatr u i;(0seur(opoudaptemncil(fsDtr( oot4oexo oeias m2umumpn(0tleoiociodfmt aneolt truoiopiu4lmenlicslt)arua(m ;u4aex mfciatla eauvp;u)trxnxfctodfm elivs;s0 eurirpnudlltelnvilt sDur(mono1ole ii3tlt s um( snt4 rxnmfcoydlat luvils sruo(m oo1ope  fvilsfs2trx  ot4tlx  ietyt a ulums;u4artrio tatoaD anvil()trto(r no4oleelnvi t  2trumpnu4oeen fcildlmDemnmp u0tlerio tatoptelivs t0truoxopnudap  mivsltfa2rauronu0tee  f3tyd aDrmuvs t4 lxnif3iytlateaieol()texrxmpny1omeemictlt) 2urumo;o1oetomociyd a2uanmsnu) exrxr3iydlatrln o t tetr(m iudll nmfetat) Dtmuront0oleoii3iydfs uanmp;t) lxnxo3iytlm r ivs t  etoxmpoydlpen ivs ( s2urxrpot4optnmieiasfm uan snt)trerxo ta1optr uei;(  exoxm3iu1lptnmfetl( srua( pnu4alxniicils aDuaums u0 rerio3iatoa eluvo s  eum(r3nudlmtemnviat)sDrmxrpnt1teeomoeiysfm2elu o t4 lxoir3oy1om   u i;(0 rxrxmpiy4lm  mict s s2ur(rpnu0aeenmf3iltfaDea(mpn(0aexrir3ia1fmDeauei;t0seurim3io1am nmfcsas s2tr(monu1aetoifciaslsDrmn o () rtnxo3oo1fp elues ()sexrxmpnydop nmfcs sfsDrr( pnu0tlt mictatfsDemnvs;u4trtomr3io1fpDean i;(0 eurim io1ale mfvs (  rurx  ot1apeomf3iadlmDrlu o;u)artrxr totfat  nvo t teuoim oo4ap  mfcslt  2tmx o;u1aet iociat mDeln o u4alxoxrcta1fm  lu o;(0s2xoxm3oo1lle mivsat)artmumpou4aexoii3iatfmDul(mo (0 rxnxfcty1lpteaueo;()truo(r3oo4apenlfcsls) 2rru p;o0tpeoiiciadfs rlnmp u) eenif3todfmDe ivo () 2xmim nodalt  fctatfsDua(m ;u0teenmociysla2emump t4tltriociy1faDranvs;s trxr(m nu4op emfcta()s2ur(ro;o0tpto iciasla2rmnvs;t4arxrio todfpt lnvo;s)t2xoir iydopt mfvsat)s2ua(  ;o0olenio3ildlmDumnvon(0 reoif tatfmt  u o;s)t2ur(opiodlpe lfvilsfa2rru  nu0aet iiciltfm ulumo () rtomf oodomt auvi;(0 rxm(opou4lp nlfvt t  Dumu o;o1oetnmieiytfsDeluvpn(0 renmrcoy1lpDr ivsl( truoxm3iu4am e nvil() rtrxr ;u4aeen feils s ul(ms;u0alenmocta1lp rln il()teuoirpio1ll elicslt  rtm( pno4apenioeils m rlnmonu)trtomr3iotoa r ues;t)teurio ny1ape  ivslt)srtmurono0tee  ieiytfaDrl(vo (4aeenio ia1fat lnvo;t0tetr(m ou1om nlneil(  Dua( ono0alxnmo3iys a2rlnvpn(4 etnmrciatlptelues t t2xr(opio1lm  mivtas)s2rrumono1apxoifcildfmDuaump;u0tleoir ta1oa rlieo s  rxrim oy1aptn ivt t  ruru pou4tle moctlsfs rlnms (0tetnxf iotfptrliesl(0 2umio no4amtelncsltf Draxrooo0teeniictyd aDem(mon(4 etnmfcty1fmtrlnvi s t2umir ou1aptemieslsfsrrm(ront0tpeoiociatfa2ua(vp ()teeomr iy1opteauvi;s0 rumxrpno4ol nliviat artr(m ;u0alxoif3ilt s uanvont0tlxnxfcoodlmDeliei;s)seur(m3io1optnliviltf Drm(rpoo0opeomo3ilt a2rm( sn(4areomrciytomteauvo t trtoirpiy1lmtnmfvt t srrrxm no4olt  oetys s2umnmp (0altnmfctotomDeln ils0 rxrio nydam nmieiat)sruaump;u1tptnmieiydlmDuau pnt0aetnxf ia1fmte ivilt0 rxo(opoy1lltnlnvta( aDtrxro;u1aeenmo3iys sDulnmo (4texrir3ta1fatrauvo;t trurir oo4lptelnes ( aDtaurpot4tpeo fetaslsDua( onu) rxnmf iy1lat lieo;(0t2tr(rpiydope mfetltf 2tm( oot0olxn o3ils m el( p u) lxrxr ootlat luvsls0seur(r3iudapenmfvias)sDuaxrooo0aetomictltfm rl( onu4texrif iy1oa eaivi (0 2xrxm3oudlme mnctls)s2rr(mpnu4alxomfciydfa2umnvpn(4aeerifcoydfptr nvs;s)srxoxmpnudolenmiesatfs2rmxm nt4olxnmoetadfsDea( o (4arxnif oydomD  nvs (0 2tr(mpiydope  netasf 2urx poo4texoif3iasla2rlu pnt) lxniocio1oa eanvo;( texrirpiu4ll  mfviatfaDtrxront1olx mfciyd sDrl( p;(0 ltrmf oo1la  li olt0 euoir3ou4olt mivilsf Dur(rooo0tpx mietls mDulnvo u) exnxf3iotopt lueo;t trxrxopoo1lmtemfeilsfsrtmumoou1tex  f3tlsfmDumn p;(0arxomo iy1lmtrluvs;s0s2xm(mpiodlmtnlnviasf rtaxmpno0tpeniociyt a2ranvo t) eeomocto1lp  lu i t)t2xrim3nu4amee neiatf rtaumpot1oexnmoeiyd aDrm( snt4arenirctotoaDelnei;t)srtm(rpoo1op nlnctl(  2tmumpnu0aex ioetas aDrlnvs u0trenio totop   u o;t0 rumiopny1ap emfes tfa2tr(m oo4optnio3ildfa2uau pnu0artomrcoa1oateluvo t) 2umir3nydoptnlnvsls  Durxr ot4aetomieildfs2raums u0aeenifciodlp  aueol(0 rxr(o3no1opte fvi tf Dum(  ot0apeo feiys mDrln s;u0arxnxo tadfp eau s;()teurxmpoy4lmtn ics (f rra(root0aee if3tydla emu o;u4 eenmfciatlpDelu sl( teumim nu1omtn ivils sruru pnt4tltnifeiadlm uauvo;u4artoxo3tydlp  auvol( trtmim3oodll elieias arumu o;t0tlt ifetld m em( p;(0trenmr ootom r uvo ( teum(mpoo4ale mfetl(fsDtaxmpno1alx mfciltls uan p t4aexrxrcoytfmteanvs s0 exo(opou4ol n nesl(fs2rrxmpou4tex mo3ils a2elu s ()trtrmr totfpDeai i t  rtoxr oy1optnlncs (f Dtrx  ou4olxo o3iltla ulnmo u)tlxomo3oadfp ean s;t) rtm(rpiy1openlfesa(fartmx  oo0tptnifeiyd mDumnvon()texnxf3ootlat ln olt0truo(m3nu4ame mncsas  Dtr(  ou1oex mictat s2rluvo ()areoio3oytfa e i o;(  2uriopio1omtnlfesl( artaur nu4tlto o3iltls2rauvp u4 lxrmr iydoaD an i;( s2tr(r nu1opt lnetls arrmurooo1texoifeiatfm ran p t)tlenio tatopDeli sl( srtm(r3oy4apt lfeta(  2tmurp;o1oet  i3ilt mDraump t)texoif iatlaDe iesl(0srtm(m3nudlme licilt)arum(  nt1opxnifeiydlmDea(monu)tltnmf3oadfmDeln ols truo(r iu1altn ivi sfa2taxmp;o0aexomicilsls2rln s t0altrif3todlpD aueolt  2xmxopnu4omen ncil()a2rr(m nt1tptn fciat s rl(msnu4 eenif iydlatr n il() rumir nodal nlnei tfsDtaxrpnu0tpenmf3iydfsDrm(vs u)aexrmo3tytoaD ln s;s seuo(opoy1alt lnciat  Durxr ;o4alx ifeiatfaDra(vo u4 rtomr3oy1fpD  ivils tetrxo3nudome liei s a2tm( pno1tleo ictldfm2ul(mp;()tltnio3tadlatrluvil(  exriopoy1olee iesltfs2umxmo;t0tle iietlsla2rlnvs;(4texrxo3oy1lptelu i;( srtr(r no4lptn nvt tfaruru pot1tleomoctlt a eaums u0teerxo3tatlmDrau o;t t2toxm oodome mfcias arur(r ot0optn ictasfm2ulump;(0arenio3iodlmtr nes s)t2xmimpny1llenmivtas) Dtru oot0teenmictadfm eln onu4arxrifcoa1lpDrliei;(0seuoio3oy4ome mivi t srurx  ;u1oex  feiys mDumums;t)aeenxociydlpD li olt srxo(m3oy4lpen iet s) rur(mono4opxn fciyslmDem(mp u0arxoxr oytop e nvilt)sruoio3ny4om   icsatf rtmumpou1oee ioeiasla2eauvpnu4aetrioctatomDrluvol()srtr(m3nu1op  mnetlsfartmxmpno4aleomfciyslaDrluvs;t4 etomr3ta1lmt  ivs s trtmxo iy4amt mfciasf 2taumo;t1aetomo3tys mDemnvs;u)artnmr3iydopt  uvols s2tm(rpiy1ap emfvtasfaDtrx onu0opxomfeiadfa2rm( p t4aexoxr tadlpt anvo;s)teurxo iu4ol emnviat)srrmum no1apenifctatfsDemnvo;t0tetnioctydlaDeli ols)trto(r3iydope  fesat srrm(ro;t0aleo feiydls uau o;(0 ltnmf3tydlp rlnvo;() etrio oydlptnmfesl()sDum( ooo0alxomieiyt m rmump u) lxrxrcoodlat lnvols s2to(o3nydape mncta(farua( ono0texn o3taslm ulu s;(0alenmo oo1fmte i o t tetoir3oy4alt  nctasfartmxroot1olto oeiaslmDrmnmp;()arxoxf oa1lm ean slt)srxoim oy4op emivtl()arua(  nu1aetn f3tys aDul(ms;()tltnifctodoate iei t0trumxmpoo1olenlnciat) 2rmx p;o0optoiieiysfa uanvo t)arenmo3iydoptraivi;t0seuoimpiodlpe lnctat)s2uaum ;t4oee io3tat sDeln s u0trerio3totop r ivs s setrim3ny1olenliesa()s2umxr oo4olt ifeilt sDua( pnt)aeenmo3iatlaD ai s s)s2uo(mpoy4ll  lnetl( s2raxmono0olxn ociytlaDemn o (4alxoir3oytlaDrauvi t)t2trxrpiu1apt miet tf 2rm( p;o0aeen octydls2el(vpnu4texrmocty1omtrlivi;( trumxmpnudlmenmnviltfsDtaumo;o0oltomocildfm2emnvon() eeomr io1la eau il(0 euoir ny4openmicslt s2rmx p;u0aeto fetldfs umnvs u) rtnmocio1lmDe n o;(  rxr(m3iu4ll  mfesas)s2rmx  ;o1oexomo3iasls2rlnms u) rxnxo3iadlat ai ols0srtr(r3nu4om n feta(  rtmx ont4aptn ieilt m eauvs;t4trxrxo oydop e u o s) rumxm3iu4lmtnmict (fsDurxr ;u1ale  ieiyd a2em(vp;u0arxnmf3oo1opD au sl()t2xo(m3oo1lm  licsa()sDumxmonu4tex  o3iadls2rlumsnu0 lxnxrcio1fa eai i;( truoxr iodam e fvslt sruau  oo4oexnmictldlm el(vo u0 exnmf3tydoaDelieolt0s2xoir iudoptemietas)aDumxmpnt0olxn fcilslsDuanmo ()trxomf to1fm eluvs t0texrxopoy1lltn neiatfsDtrxr ;u0olto oeilt m emnvs;t0 exnmr3tydom rauvs ( teurxrpiu1omt  ici sfaDrmu  nu0oleniociatlaDemnvp t)aetomf3ootfatrauvs ( srurxo3nu1llt mfes s)s2rax ooo4altnif3iydfsDrm(mo;u0aetoxocoatlpte nesls0t2tmxopiu4lle  ivtltfaDrax o;t4apto ictltlsDrmn p;(4 ltoxfciatlm rluvs t) 2tm(rpiy4om nlfei tf ruaxr ;t0apeoii3ilt s rau pnt)trxomfciodop ranvsl() 2toir3oo4llenmnet s aDta(rpoo0apt io3iytlsDulnvp u4 leoif io1lmtean sls) eumxm nodapenliciatfsrtm(m ou0aex  i3iadlm2rlnmp;t4artnmfcoadlmDrlu o s  exmim3oodop n icils)s2uax o;t1tlx miciad s ea( snu0artnxoctatfateli s;s0 eto(o oo4lptelfvsas)srra(mo;u1ape mfeiasfm rlnvs;u4 etnir io1lmt luei s texoxrpiydomte nesl(faDum( ono4oleoioeiatfm ranms;()altomr3iy1fp e i i;s)srtrim3nudapeemnetlsfsrrrumoot1alt  f3iys m ul(vs t0trenmr3tadlpDrlivs;s0 2xoxr oy4ape  fciatf 2ur( oou1aeeomi3iatlaDuaums;u)tetrmf3ootlatelu o t0s2urio nudolee ivils) rtr(m ou4aeenmi3ilsfm um( s (0texoifctydopDeaivs;s0seurir3iu1llen ies t)artm( pnu4tpxnifcias a2um( pn()tlxrifctydla   nvil(  rtrxr3iy1altnliciltf rraxrpot1open oetadfsDea(vo (0arerioctatoaDrln i;s)texm(m ny4ap  lfvslt aDtmxr ;t1tle mfciydla elumo (4artrxrctotomt anvs t  ruoimpoo4omen nctatfs2uaxmooo4tpto octas aDemn o u0tltrmo3iytlp   u sls)s2xr(m3oy4olte nvtl(fsrraxmpnt0aleo i3iadfs2umump () lerio3oy1la rliei;( s2umxm io1oleelnesatfa2trurpoo1opeomo3tyt s um(ms;u)trxoir iatlm eauvi ()srurxm iy4am elicsl()a2urxr oo4tetnmocilt m2ea(vpnu4tlxrif to1opte i i (0 2tr(m3io1ope mfei t  2rauroou4alxnmieilsfa2ua(msn()tleoxr tatfaDraivi;( t2umir ny4omtnmies ()a2rmxroou0tpxnii3ias s2ulnvsnt0aexnxr todfp rlivs (0t2tr(o3oy4ll nmneil()aDumu ooo4openmo3tls m elumont)trxoxr3to1fmDeaieo;t  eurir iodalenmivsasfsDuaxm nt4optoiociatlm rmuvo;u4 etnmrciy1lm ean s t)t2trxm iudam nmfci tfaDrax ono4altoifciltfm2ra( p;u)alxrmo3iatlm eluvsls)s2tr(o nu4op   neslsf Drr(rp;u0opxomo3iasfsDuau o;u4 rtniocoydfmDe uvol(  eurim nydop nmies tfa2ua( ono4opxnmfctatfs2emnmo t)arermrcoodfpDraueols0srxr(m3iodapee nct t)s2uax o;t1olt  fciydfs2emuvo;u4artrmfcoa1lp eanvil(  rxr(rpoydol   fctat) Drmu o;t1tpx ifeiysls2el(mo;t0tltnif tadlpt lu ils tetoimpou4lle  fvi (farrmu pou4apxo ieiyt aDrau o u4alxrxf3io1op rluvi s)s2tr(r iu4lpee ncs t)a2rax  nt0teeomf3tyt m2rmnvp;u0texrxo3ootom e nvo;s0t2tmirpnudaltnmici t sDumxmpot4alxnmi3iasls2umump;u)tlerxfciy1oatranvi ()sexrim3ny4lptnlfctlsf rta( oot0texnmo3ildls el( ont0trenxfcoytoa r n ols0sexrim oo4altnmiesa( srrr( ono4opxnifciadlm2ran snu)aeeomr3iytop r ivi s) rxmirpou4ll e fesls)a2ururoou4ape miciat aDeaums u4tlenmr3iotoa eauvi;( tetoxm3io4amtemnetl(  2rrum ;u0tlenmfetyt mDea(vpnt) rtomfcta1om elivs;s0 rxoxmpoydlptnlfcsa()artaxrp;o1olxn fcilt m2elnvs t0areoxocoadlaDr uei;s0s2uoio iy4optn nvsa( sDur(mpoo4olx moeiysfa2ranvo;(4 lxomo oodomDeauvi (0srxoir3no1apeelnes t)aDrmx ooo0ope mieiat s elnvsnt0tltrmo tadopt lnvilt tetoxo ou4optemnctatf 2rrxmont0tpt mictadlmDea(ms;t) eeniocootomDran i t teuo(m ny4apenlneil( s2uaumooo1apenmocilt a2ean s;()tltnxr iydlpt  i ils0 exmxo nu1lleemnctls)aDtmumont4aeto fciydfm2em(ms t) etnir oytlat  n s;t)teumxr3nu4lpenlnvs sf rra(m ;u1teto o3iltfs2emnmpnu0arxnir3ootfmt lu i;t0trxmiopiodll n fesatfa2tmxm ot0tltomictldlsDelnms t)alxnir3oo1op eaueo s)srumxmpny1om nmivta()srtr( pot1alxn o3iatla2rmnvs u4alermo3iotoptr nes t)s2ur(mpiudap   nci t  Dtaxr ;o0aetoioetydlm2eaumo t) etnmr oydlat livi s0 euo(r nudoleemivsa( s2raurpnu4tetoifetysfmDeanvo (0 ltoif3ootfp rli o;s0srtr(rpnu4al nmfesl()a2tmu onu1tleo fctltlaDelnvo t4aeermf3oydlm   u slt)t2uoxr3nudam  mivsa(f 2umur ;o0aee ioeiaslsDum( p t0 renio tatlmteaivols0seuoxm nu1lp e iviatfaDtrxronu4tltoii3iadfm rmumo;t4aleoio3oa1lpDrai ils  euoxrpiu1olte ivtas  rrrurpoo4alxo oetatfm rl( s;(4aexoxf iotlaDeauvslt s2tmiopny1ap e iet t  rrmumpoo1ale io3ils s2uanmo ()artnif iy1om elneo s0 exmio3ou1lpeemiei tfs2rr( ono1optnmo3iytfaDua( sn(0trxrmr ootlptr ieo;(0srurxr ou1ameemicil(  rtm(moot0tlx io3iatfmDuauvo;(4aetnirciatfpD an s t)srtmim3nodom n fci sf 2tr(m ;t1apxo fetadlm ulnms t0altnmr ta1fmD lnei;s)setoxo nu4llt mnvtls) 2ta(m no0ape mfetlt m2rmu o ()tlxoir oo1opDelieo;s)sexrxr3oydoleemnesa() 2tru  ;o4tlto feilsfs eanvo;u) exrir3iotom elueil(  exm(opoy4omt mfvt ( aDrmu  ;o4tpx iieiadlm ranmonu0tlxrxo3oo1optelu i () 2xrxmpoy4lm   fvsasfa2trxrp;o4oeeomiciys a2ul( p t)teenmrcoytfateln olt  rxoiopnudlpe mfctasf 2rmum ;o4teeoiiciysfsDemn o t4arenxfcty1oat au s;(0t2uoxo nudaptemnvt s)a2um(moou0tpeo o3ias aDem( pn(0 etnmf3ia1omDeauei (  rxm(r oodomeelfvtltf Dur(ront4oexn oeilt aDumumsnu4tlxriocootop  lueo;(0texmir3io1lp  mnvsl()a2rm(  ;o4oexoif3iad m uln o u0tlenmr3ta1om  ai s;(0 rurxr nodamt micta()a2um(mpoo4tltoiieilt m2uan o (4 leoif3tadom rli o s t2trio3nydomeelfvilsfsDtax pnt1aetnioeiatls2umnms;t)trxoxr ty1oaD auvils0srtrir3iy4al   neilsf rtmu p;o1tlxnmf3iysfm ra( s t0arxrmo to1faDelivilt  exoio iudlp e icsa(fs2rrxm ;o4tlxomfeiyd m2rln on() rxoioctadfm   n o;( seuo(o3nodol  lfcsls)s2umumo;o4texnifciys m rlnms;()trermociodoa rln o;()t2uo(r3nodomen fci () Dta(mo;t0olxo octat mDeau p;u4trenif ta1lm   n s;() rxo(m3nu1apee iei tf 2tr(m nt1altoifciyt s2elums t4trtnif ia1lm raivi ( sexrxopio1lmtelivs t srra(  ot1alto feias aDul(mpnt0alxrxf ia1faD aivols0 ruoimpoy1amtelneilt)a2rr(rp;u0oetn f3tlt a2el(vp;t4 ltnmrctytoptraneilt srurxo3iu1ape mnvilt)arrmxmont1oltoio3tatlsDeanvo u)altnmo to1fa elivsl() rum(m iudome  nesasfsDtrxmpou1apx micilsfs2raums u4tltrir iotfa e uvi s0sexmim ou1lme  iet sf 2ua(r oo4oeenmi3tas m2em(mp;(4alxniocoatlmt au s;s  etm(m ny4amt lnesl()aDuax o;o0alx ifeilsfm2em( onu4arxrmfctadopDr uvo (  euoxm3nodopt mnciltfs2rm(  ou4tpe if3tlslmDeauvp t0tlenmrcoadfmDe nei;s0trxo(m3iodllee neslt arur(mpnu1aexn ictlt mDulnmpnu4trxniocia1la elu s ()srtoiopoo4apen fesa(farurxrp;o4tpxomf3iatlmDemn p t4tetrio3ta1fpte i s;t0truoimpou4ope mnvtl()sDtmx o;u4tpenifctyslaDulnvp;(4 lenir3iatop eli sls0 exo(r3oy1lmtelnvias s2raum nu1teeomfciys s2uau p t)arenxrctytlpte neslt0 exrxopiydlmeemfci (faDum(rpnu1tex ii3iydfsDrmnvo;()tetomf oodoaDe i sl(0 2tm(m3iudop  mnetlt) rraxrpot0olxomfeiltlm2emnms (4 lxnmf3tadomDrlneo;s seuoio3iu4ol nlfvilt  rur(monu1tpxoiocias m2ul( s;(0aeerxf ta1oa e uvs;s seumxo iy1ome lneiat)a2trx  ou4ale  oeils aDrauvo;() lenxr3oydfpDrlnvo ( t2trxr3ou4llee iei (fsrtruro;o0aexoio3tldfs eanvo t)tetnmf to1lpDrliei t0teto(m oodlpenmfvi t) 2um(r ;u4tle ii3tat s2rau s;u4trxrio3iatoaDean o;t0setrim3ny1al n ncs () Drrxmpou0olt ifciltfa2rm(vonu)arerxr3iy1lm   ivs;(0 2xoxopno1amte fei (farraxrp;o4oleoiictyd a uau o;u4 exrmf3iotoa elu i t tetmxmpiodopt  fvsatf 2umxro;u1tee  f3iasfmDuan s;(4aetrmr iy1oa rlieils0 exoirpoy1altelieias) 2rr(ro;t1tptn octld aDra( pnt0tlxomr oo1oaD aivols0trto(mpoodamt  fvtas) 2uaxmpoo4aet ifciadfs umuvpn(4tlxnmo iotla   u s s)setoxopnudomte fvs s)aDrrx o;t1ope iociltls ua(mpnt)alxomfcoy1lmt  uvi;( trtmxo oydol emnvsat)artmxr nu1olt ifeils sDelnvp t0arxrmr3oa1faD  ivolt)s2umimpiydap nlivil(  rrrumono1apenmociasfm2ulnvs t) rxrmr iotfp   ieo;t0srtmio no1om emfctlt) Duaxm oo0opx mf3iat s eanvs t0treoif todlmtrai s ()srtr(r iodlltelnetlt) Dra(ro;u0oetnmf3iysls2ulnms u4artrxo iotlm r ueo;( t2xrxmpoydamen nctls aDuaur oo0aexomi3iasfsDrm(vs t0 rtnxr3iy1faD auvi;( t2tm(opiodlmen iviat) 2uaurooo0ape moetlsfaDulu s;()alxrxr ty1om e n i s  exm(o3iodlmteliei s) rtr(ront4tlt if3tydlaDelnvpnt)trtrio3oo1fa r i i s) rxoxo3iudlp elnci t srtru p;u1olt  feildfm2em(vp;t4 exoio oatfmDeluei;t) etoxmpou4llenlieias)aDtax o;u4tlto feiasla2ea(mpnt4arxoxoctotla rliei;(0trxrim oy1al emfct ( s2tm( onu4oetnmi3iyslsDuanvont4 lenio3to1lateln i s  exm(mpnydlleelfviatfartax oot4ole mi3iatfs2elnvsnt0aetoif tatlpD li o;s0 euriopiy4olt mfvsatfarrau  no4oee  i3ilslm2umn pnt) exoir3totoa eliei;()srtrxopny4ol n fcs (fa2rr(m ;u1aleomf3ias s elump;t)trxrmf iodoat auvsls) rtrxr iy1llt mfvt sf rraurpnu4ape  f3tad a umuvsn()teenio3iadoat lieilt srtrxr oudll n icias s2rr(rpot4alx mo3tas s2rlums u0tlenio3ta1omDeanvo s trxm(o3ny1am n iei sf 2tax onu0apx ifcilslm elnvsnu)texrmo3tydop rln ols texr(m no4ol nmnei s arurump;o0aee ifetld a elnms;t4tlxnmrciatfp e ies;(  eumiopiu4lptnmneslt srrm(mpot4altoifctadfsDelumpnt4arermf oytlp e nes (  euoxo oy4lpe lfviat aDrr(  ;t0tpe  o3tas a uln s u4alxnmf3iatlaDe uvo;s teuoio ny1ap e icsltf rur(m ot1tpxoii3tatlsDuanmsnt) rxnirctydlmD  neslt0trurxr ou4aptnmnvs s)arraum nt4tpx moeiytls2rmumsn(4 rxoxo iadoptr u o t srxmirpoo4lm  lfetat s2raur ;u4tlt  oeildfmDem(vpnu)treoxrciytfa elnvils s2urxm oo4lp emfeil() 2tm( ono0oet  o3tlt s uln o;t0tltnxf iydlpDe ieo t s2tm(rpoydlpenmfet sfa2raxmpno4tltnmfctadlm rauvo;u)tlxoxrcoydlm  aiei t sexoxo3iu4oltnmivtl( srum(ro;t0tet ifeiyd a2rmnmpn(4 eeoxf oy1laDeai sl( s2xm(o3oo4lmtnlietlt  2tmxmpou1texo f3ils aDel(mo;t)arerxr ty1opDr nei ()teum(mpny1ol   fvslt arta(mo;o4teto i3ilslsDelnmsnu0 eenmr oadlmtr ivols s2uoimpny1lpen fei (fsrta(mo;t4olx ifciyd m2eluvp u0aetoxr oydomDrlnvslt s2xmio3oy4lmt mfctlt)s2rrx p;t1opxoif3iltls2emnmonu0tltnmo3ta1fpte u s;t  2to(m3io1altelfvt s)aDurxmp;o4opeoifetltlm2eaumsn(4 reomo iotoateln i;t)s2uo(o no1lmen neia()srra(r ;u1tlt miciydlm2umu onu)tltrmf oytfmDelnesls srurir3oydoptn fesl(  Dumxr nt1tpxn icias sDem(vo;(0 rxnmo3oydoaDrlnvs;t0 euoxo3iu1ol e fciatf 2umxr ou1aet mf3tyt mDul( s t0 rermf ta1opDeln s s  2um(m ou4lp   icsls) rumu p;u1teen oeiltlm eaumo () ltrirciotla e n o;t tetrirpiu4lmenmictatfaDumu pnt0aeeoiietat m emnvont)trerxf3oytom r uvi;t t2toxr no1ale lnvtatfsruru  oo4apxoifeiysfs emnvo t0teenirctotla  an il( trxmxo nu4aptn fvil( srumur ;t0optn feiydla el( s;t0 rxnio3ia1optelnvo t)tetmxrpiy1llt mnesat) 2ur(mpot0tpxoiietyd s umn s u0aexnio totlm  aivs s0s2uoir3oy4lmt  nvia( srtru  oo1tet  oeias a2rmnmp u4aleoircoodlatrluvo s tetr(opiu4opeelfcil( aDua(rpno0aeenmfciltfmDean o;t) exnxf3oodoa   uesl()s2trxo3oudamtn fviatfs2umuroou1tlt  feiad aDemuvs;(4altoxf oatfa  lneils0t2tmim3ou1op emnesa(faDrrx  ;t4alx  oeiat a ra(mon(4 ltrxr oydfmD  ivs;s)truo(m nodam e ivtltfs2rmx  ou0ole mo3tasfm elnvs;u0aetnxr iotomD anvs t setr(rpnudlp   ietl()aDrm(  ou4oexo ocilt mDemu p u)alxrxrciytla elivs;(0srxrim3iy1omtemneias)sDtau  ou0teeniociytfm2rluvp;t)tltoio3iy1oa   uei;s)trxoir io4llee fvtls srtax pno0tpx if3tytfmDrln p u0 ltrif3iatfmDr ues;s seto(o3no1lmenmnetlsf 2trx  ot4teeo f3iytfmDumums;t0arenxo oydfatranvs ()sexo(m nu4omt  netasf Dtru p;u0oeeomo3iadfs ran s u) etnxo tadla rau s s0texr(o3no1ol e iciltf Dua( onu4alxniociad s em( s t0 eeoio oodoaD luvs t  2tmim3ny4lp   fvtas)aDtr(ronu0alxomoeias s2rl(vo ()arenir3iotla eanvs;s)teuoiopiudalenlfetatfarrmu  nt0oltn o3tldlmDel( p (4trxomr3iytoaDeln sl()s2umim3ny1alenlneilt srtax poo1tpxomfciadlaDea(msnt) lxrmo3oytfpD aneslt trtr(m3oudlpe lfciasfsruauronu0oexnmo3tltlmDel( o;u4 exrmf io1laD  ueo (  rtr(m3nudlmte ivsls) rumxrpnu0tpenmoeiysfs rluvo u4alxnxf3iydfpDe ies;s trxr(rpou4lme mncil(  2tax pot0aex mfeiat s2ulu pn()alermf3tadfaD  uvi;t seurxmpnodaptn ivsa() ruaxrp;o4ole mieiltfm2um(vp ()aetoif3oa1fp ranvs t0s2trxr3iu4lpe lnvi t)sDta(  ;o1apxnmfcilsfmDumn pnt0 etnxfctotomt aivi s  2tmim ou4llt lfesa(f Dtmxro;o1ale  fctat sDeluvonu)artrio3oytfptr n o;t0 rtmio3no1lpeemnvsltf Dtax onu4tlt mfeiyslm2eanvpnu0trtrxf3tydfp r uvi;t0t2umxmpio4omenlnesa(fs2trxrp;t0oexomo3iyd a2umu snt) reoiociytomtelnei s0seum(mpoo4al  lfeil() rurx oou0oetomfetydfa rau pnt0trxnif iodla e u ilt teurio nu1amenmnci s arua(rpot4aexo ieiatla2ra( s;t4tltomo3tydfpDr u olt0 2ur(m ou1aptnmietat arraum ot0optnmo3iyt s2ea(mon(4 ltrxr3ta1fa r uvilt)trur(o nodol   fetas  Drm(r ot1apeomfeiad sDua(vont4 eeoiocoadlatelieols0s2xrxopiy1lp e fes s artax  no1olto fetytla2uan s;(0 leoxf oatlp eln s;t sexoxrpiodoptemietlt s2tmur no4oee  f3tyd s2rm( p u)aeerifctadlaDrlnvi;s0seur(rpno1lp e fcsatf 2urx  ;o1oeenmo3tls a2rlnvp (4artrxf oydfp elu o t)t2uoiopnu1om  livtls srua( oot1opxo octlt mDran pnt) lxoxfcoy1fa elnvilt trtrxo3nu1lltn fctltfsDrr(r nt0tptnii3tlsfm umuvpnt)aeenir3to1fpD lueils)setr(m3oo1lmtemivi () rua( pno0oee iicildlmDemu ont)tlxomr3oy1oa rauvs t) rtmxo3iy1am elnct ( aDtm(ro;t1tpxn f3tysls um( o u) etriocia1oaDranei s  euoio3ny4lmtnlnetat) 2umxrp;u1alxomfetydls2ulu pn(0 eenmoctydoaDrlu o (0setmir3oo4op elivsas)srra( p;u0tpt  i3tys a2eln s;t) exoxoctydoaD lu s (0 etoimpno4omenlfvslsf rtau ont4tlenioeiysfm2uanmo ()trenif tadlpteluvsl(0 rxm(rpno4olte ics (fsrtru onu1alxoiociytls ulu o (4trxrir totomDeln sl() exrio oo1op  mivi s) Drrum oo1opxnif3iltla umu o;u)tetrioctodfpD  ivolt seuo(o3nudol e fetls  rurx pnt4oexnifciatla ul(msnt0tlxrxf iadlp  anvs;()srxmxm3iy1olte ics ()artrur ;t0tlx  fctys a ea(vsnu0trerif3to1lmteluei;t sruoxr iy4lle mnetls) 2rru  oo0teenioeilsfm2rlump;(0tetnmo3iadop eaiei;s0s2urxr iydomtnlfvtas)s2rrx p;u0tpeomociltfm ulnvsn(4altnxo iy1opDranvsl()trurimpou4lptnlfei t a2tru ono0opeo ociytfa emump;t4 exoio3oa1om r nvils) etmio3nu4olenmieiatf Dtrx p;u1oee mo3tldfs umnvp t0tlxnxfctotlpte uvo;t0texmirpou4oleemnvtasf 2tm(r no1oexn fetlsls2ua( o (0alenmr3io1lmDr nei s)s2toxrpiudape mfei ()sDtrurpoo0tpto i3iltfm2ea( snt0altomoctytlp r neo () exo(r nu4omenmicsat)s2rm( ont1texniocias s ua(vs u0aexnxrciytfp eaivo (0s2tmim3ny1amt  fet s)sDtaumpnu0aet  ocilslaDemnvp;(4arxoxf oatfpDrlneo t0s2umxmpio4ll n ieia(fsDuru pot0tle iiciys s uau p t4aetrxr3iotfatrlues;( t2xrio ny4altnlfvi () Dtrxr nu1tptnmf3iysfa raumont4arxniocty1op e n i t  ruoim iy1lme  ieil(faDraurpnu4oleo f3ilslmDelnms;u0 eerxf3oadfp r i i ()tetr(m oodal nmfci tfsrtrxmpoo4aex io3tlslm2emums;u4trxomr ta1oat  nvslt  2xm(r ny1ameemfcsa(  rtmumo;o0oexomo3tys a rmnvs;u)aetoifctodlp e n ilt0tetoxrpoodlmt  ncs s)aDrax o;t0olxoioeiysls2eanmo;() etnio iadopt au o t)sruo(r oo4ll elfctl() Dua(mpoo1oex mfciad m ua( o;t0aeeomf3ootlmDrluvs ( sruoxr ou1om   nci s artaxm ot0aeeniieiyt m2ea(msnu0aetoxo iodfaDelu i (0seurir3io1op n ncsl(  2ta( o;t0openiiciydls rln snu0trxnxoctadfmDeli s s s2tmxmpnudom   neil()s2rr(m ;o0oltn ociydla umu pn()tlxnifctydfmteluvi () rtoim3nu4lpee iei s)sDtmum ou4aetoifeiltfa2ulump (4 leoif3oa1lmtrli sl( t2xm(rpnydap n nvsls)s2tru pnu1aet ii3taslsDulnvs;t)tlxoif3oydlp r u s;t)t2trir3no1op elivsas arum( ono4oltnmoeiysfs2ulnvp;u)arerifciadfpD lieilt)t2umir nu4ol emncilsfsrua(  nu4apt mfeiasla2rm( sn(4arxrxr io1faD aneilt0s2uoxopiu1ll n nviasf 2umu  nt0oex  oetytlsDul( pnu0tlerif ta1lptrauvs (0t2xo(o3nudlptn ics sfa2raumo;t4ale  i3iat m ra(vpn(0 rxnif iotfmD  uei;s0 rtm(opnu4lmt mncsatfs2tm(rpoo0ope  ieild sDrluvo;t4teeoiocoy1fmD ai ols)sruo(o3nudolenmiesa()arrau pnu1aleoifcildlsDra( s u) renxr3to1lmteln sls0texm(o oudaleemnctatfa2umumonu4opx mfeild mDemn p;t4teeomo oydfatr uvi;()t2tmir iydame livi t) rta(  ;t0aleoifeiysfmDrauvs;() rxnxf tadfmD luvslt)seuoxr3ou1ll  mfvs t)a2rmu o;t1oltnii3iat s umnvs;t)artnmrciotomtelu ol(0t2urxo3ny1alt  icsl()sDtr(ronu1alto feias a2el( s;t)aexrxf iotlp rlnvsls0srto(mpoo1opt mneias)sDta(  ;u4olxnmi3iatfmDelums u) rtnmfctodopDe uvols0 eto(rpnydll  lfvs tfsDuru  ot4alx moctltlmDemumsn(4 exomo oatop e nes s0srtoir3iu1omeelfcia(f 2tax  nu1alt ioctadfm raums t0trermrcoytomDrauvols0seto(rpoodlm nmieil(  2rm(rp;o1texnio3ildls rm( pnu4treoxrctytlateanvslt sruo(opou4op elnci tfsrumur ;u1oexnmocias s eanvs;()trenxfctotfatr nvi;s)t2toim oo4om  lnciatf Dtmxmoot0optn f3tas aDean s;t4 exrxr3ta1lpDr ueils0sexr(m3oo4lpe  nvsltfsrra(mp;t4oet mocilsfaDrmnmo;()artnmr ia1fate uesls  euoirpnu4op e fesat)sDtr(mo;u4alxoiicilslm uan snt)artrmr ta1fpD ln i;t)t2xmxopiydlp nlnesas)srurxm ot0apto ieiltls ua( onu)arxnxr to1fm ranes;t  eum(opnydapt lieils)aDtr( oou0oltomocilsls2rl(vo u4aetrir iadopDranei;t setmxr oydaptelfcsl()arua(  nt0apx  oetatla2uanms (4tlermf oy1opDelies t) exrxo3ou4lpenmnci t srurumonu1oetomoeiaslaDuau p;() rtrif3tatlat  nvs t trum(rpnydlm   ici (farrmu  ot1tpenioetlsls el( onu4aeenmr3iodfmtrlnvsl() rtrim3iudll  mict s  2tr(  nu1aexo oeiat a2ranvo (0trtnmrcoydoaDeanei s)teurir no1apee ivta( s2tm( pnt4oeenmieiasfmDuanvsnu)alenxo iodoa rlueil( sexoim io1om e fvt ( srtaxro;o1alxomieiys sDul(vp;(0aleoxr3tadla rlueolt)s2tr(o no1lpt  netat aruau ont0aleo fetlt mDrmumo;u0trenxr to1oa r neils t2tmxopoo4om elnvias aDrm( pnu4apeoifeils aDranms;u0 leoxo3io1fm r uvo;s0trxo(o oo4amenmnctl(faDra(mpoo0alto o3iltla2emn s u4trtnmf tadla eau i;()setmiopoo4omtemivt (f 2rau pnu1oltomo3ildfaDuluvpnu) rtoif3tadlptrlieo (0teto(mpoo4amt lfcsl(  Drau  ot0olx miciad a2raums t4 etrmo3tytoatr u s;s0setoxmpno4op emivt t  rrmu o;o0tltnmi3tlsfa2ra( o;(0arenxf3ta1omDelieilt trtmxm3iu4alenlivs ()arum(ront4ope  f3iysla2uauvonu0 exrirciydlmtrlu i (  exrirpiydlmtnlictasfartrur nu1tpxn iciasla rl( pn() etrmo iadfat anes;s tetoxmpoydaptnlnvtatf 2umxrono0aex ifetasfsDemnmpn(0 rerio iotfateliei s0 2uoio3io4al  lnei t s2tm(mp;u4oetoif3iatfmDrmn o;(4altoxo3oatomDeaieo (0 eum(mpio4olenlivtlsfaDuaxmoou4alen oeiad a2uln sn(0tlxnmocoodlaDeauvo;t setoiopno1lmen ivt t) rur(mpoo1oeto ictls aDuaump t4trtrxo3iotfmte ivo;( tetrxrpno4op nmfcsa( aDtr(rpnu1ole mictasla2em(mpn() rxoxo3io1lptrlivo t0 etmiopnodal   fcs () 2tm(ro;o0opeo ociasfs2ra( s;t4 etrmr tydlpt  u o;()tetrxr iu4lltemnet tfs2um(m ot1olt mfciysls2rauvp (0 reoxociotlptean s s  2umirpno1ll nlfes s)sDumur nt0olen ieiytls2rlnvsn(4 etrmf tatfmte iei;s srur(mpoy1lmtn ici tf Dtaxmp;u4oet  f3ias s eln pnu) ltnircoodom eaieslt)seto(o nudome lictlt)srrruront0tlxoif3iasfm umuvpnt)tetnmoctydfaDeaneslt) 2tmim3ny1lltemnetat aDuaxm ;t0tlxnioetysfs2rm( s u4 rxnmoctadfa   nes;t sexrxr oydlm elfvias  2taxrp;o4tpt moetydlaDulu snu4artrxo oydlmD  i sl( srtoxm3nudameelietl(  2rax oou1tpxomieiys a ea(mo;t4 eeoio3ootfa  ai s t0 rurxr nu1alenlivs (faDrmxrpnu0tlxn oeiat mDra(vpnu4alxoir oytfmD  nvo;s0 exrir3nudalen nvt t sDumxmo;t1olxnifciatlsDrmu snu4teenmf3tytlp ranei;s) ruoio oo1am nlfvslt)aDra(  ;o4tpxnifctyd m uluvo u0 eenio3oy1opD  uvilt0s2trxm3ny4ol  lnes ( arum(mo;t0apeoio3iytlaDrm(vp;t)aetoir tytfm rln o t0sexrir io4lm  mfeiat aDrrxrooo4apeniocils mDeaump t)aexrmf tatopDe i ol()srxo(o iudll   nctlt s2tr(  nu1oeto ieilsfaDul( o;u)trtnxr iodlmDeluei;t0teurxo3nudome lnvsls)srum(moot1alt if3ilsls uau s;t4 leomf3oa1lmtean i s)trtmimpoy4amenmfei s)a2ua(r ot4alxnif3iyd s2umuvp;u) eeoif ootfpD aueslt) rtrxr3iy4amenmfcsas s2um(rp;o4opx  f3tysfm rm( s;t)tleoir3oytlm rlueo;s)t2xo(rpiy1ol e feil( aDurx  ot0oeenmoetadlm uanvs (0teeoxf3iytfatr n s;(  2tr(r3iu4altelivt s arururoot0ole ii3iyt m2umuvpnt)arxrxrcoa1fmDeaues;t seurim3ou4aptn fvtltf 2taxm oo1aexn feiadfm2eln on(0aeeoir3iydoatelnei;s  exrxm3iy4llenmneilt srrrxmp;o4tpxomictasfs2rlu p;()tlxoio tadop e uesls)s2uoxo3iy4olenmnvsasf Draxr ;t0oeto ietad mDemnvo t0altnxo3iodoatr ieils)t2xo(m3iudolenlneslsfa2tm(mont1tpx  ociatfs eanvs t4 lxnifciytlpDr ues;s  exo(r ny4lmt mieil(faDumx  nu4oeenmfeiasla umnvs;(4tlerio3iydfpDrlies;s0 2uoim3oy4apt lies s)a2umxrpnt4tptomoetytfmDea(vpn() reomo io1faDraieol()trxo(rpoodomee neta(f 2ur(rpoo0oexn oeiatls2ra( s (0treomr3io1faD  nvslt  etr(o3nudll n nvils) Dtrump;o4apt mociadfs2em(vs u4tleoiocoodlaD anvi;s texmxo3oo1lmtnlncs (fa2tm( onu4teeo f3iasls2uanms (0 eermrctydom elivi;t)trxmir3oo4ap emics sfaDtau  nu0tptn f3iydfa2rlnms;(4tlxnir3oatlaDraivils0t2tmxopoo4oleemncsls)aDuaum ot4tpxomictydfs2rluvpn()tetnxo3todoa   uvo t0trxrim3nodolte ivias s2urx p;u4oee moctld s umnmsnu4tlxoxr iydomtelnvi t  2tmio3iy4alt licslt) 2rm( oot0tpxomi3iytfa uau s u0trxoxo oo1fpte u i;s  euoio no1ll elicias)aDrr(mo;u0oltn ieild m el(mp;() ltrir3iotfpteaieols0tetoim3oodal elivi (fsDrrx oou0aeeo o3tydfa em( o u0tlxnmo3iadfaDe i i;()t2urxo3ou4altelneias srra(mont0oeeniictasls rmuvont4aexnxocoo1fmteaueols0 2xoirpoydolenmivtat  2trxmpot4oltnifciltfm em( snu4tlermo iotlmDe u slt)srtm(m3oudlmtelfvs (f 2tr( pnu0apt  fctls s ea( o;t)teerxf iydfpD lu i ( t2uo(o no1lle lnei (fs2tm( o;t4texomociat aDum(vpnu4areoio iatoptraies s  rtrir iu4lpeelfetat srtr(ro;u1alen oetas sDem(vs;(0texnir oo1fmDeli o;()t2xrxr oo1lmen ivs tfsrumxrp;o1ale  octasfs ulnmo;u4texoifctytlatrluvo;() rumimpiydlpte fctatfs2uau o;o1open f3ild m2uauvs u0 leoiocoydomteaivol(  rumxm3io1oltnmnvsat) Dtau ont1apxomieiys sDelu pnt) lermfcoodlmDeaneil(0t2xm(r3io1lpen feiasfsDrr( ono4tlto ieiadlmDumums;t0 ltnxo3iotlptr u i;()trxo(mpny4ol nmfvsls)a2rrx  nu1tlxoii3tasla umn p t0 rermo oytfp r ivi t) rurxm iu1ol  lneslsfaDumxr nt1oexnioctatls rm(mp;t)altoxrcoytfpDrai o;t0 2xrxr oy4om nmiei t) Dtrumpnt0tlxnmfciydlaDrlnvp u) lxrmfctadop eaneo t)trxm(o iudlltelivi sfs2tau pot4aetnifcils s umnvp t0arxrif3io1om rln i (0seurxm no1ope lnvilt s2urxrpoo4aetnmf3ild s2ua(mo u)aetnmr3iytlp elivo;t0trurir3nodamt  nvtlt sDtauroot4tpe if3ias a emn s ()trerxf3iy1opDrlu sls)s2uoxm no1lpte fvsas artaurp;t0apenioeiasfsDrmumo (4 rtrmocoatla eln o;(0 2uriopoudolt  ivsat sDtmxrpou0tpeoioctas m2em(vp t4tlenioctytfptraieols) etriopny4optemnctl(f 2rr(r oo1oex iociltfs2eluvpn(4treoif totoaDe ivi;t)srtriopiodlm nlieta() Duauroot0tpeniiciaslsDuanmsnt) rxnifcoytfmteau o (  rxo(m3oydamenlfci () 2rmur ;o1apeomo3tld a2ul(mo;u0 etrir3oy1lptran s t srxoimpiodape lfviatfsDtr(rp;u4tleniieildfa2umump;u)aetrxociadlm rlu o;s tetmirpno1altnlfvsat sDtmumoou4tpxn f3tat mDel(vp;(4treoxf ootoaD  u olt)t2xrio3oydom  mnvtl(fa2trxr ;o4altn ieils mDuln ont0alxoxf3totomt lueilt)srtrirpou4lm elncs tfarur(ront4olt  oetld sDra(vo (0altrmf iodoa eli o;t tetoxr3iodlle lfes tf 2tm(mpou1apt mfeiadfm2rmu snt4altrxf oa1fm eliei;s)tetmiopny1lpee fet t)sDua(rpou4alxniieiytls em(vo t0 exoxrciy1om  livils0t2to(mpnu1lmte nctlt  2rmur ;t1tex mietyd a2uanmpnu0trerxr3iatopD  n sl()texrxmpny1lpt  nvt (faDuaumo;o4alx ioctasfsDumu o t)areoxocoydfm rlneils setmimpnu1ape  nvsas) 2ta( pno0aetoiicias a rmu s;t0 ltrmf3ia1fat  ues t trum(r3oodalenmnvsat)sDua(r ou4tpt mf3iat a2uln o u4trenmociydlm  lieo s0srxmimpno4alt liei t)aDur(ro;u4tpeoio3tytfs rmnvp () rxrxf3io1fp r ivs t)teum(m iy4openmictls srtr(rp;u1openmoeiad s eanmo;u0 lxoif3todomDelnesl()tetm(r3nu1llen ics (f 2ta(r nu4oexnmiciad sDelumsnu) lxnxrcootomtrauvils) 2urirpiodlp  lfet s) 2urx p;u0tltn oetytls2uanvonu0aeeoxocoy1oa eaues;t)srum(o ou1olt miviat) 2ur(  oo1teen o3tlslm2uanvo t4tleoxfcty1oa  lieil(0srxm(r3oy1ope lfei (faDtaurono4oexnmo3tyd a ra( o;(0teermocoo1lpDraneols)srxrio oydlpenmnctas)sDtaxrp;o4apeniicilsfa2rau o;u4areoiocia1lp eln i (0srtmxo3no1lmt mnvilt)s2trxrooo1tex  ictldfm elu p t)tltrio3iy1la elivo;s trxr(o iy1ape mictls  2urxmont1apxniocildfa rmn o u4 etnir3oa1omtelnvo;s truoxm3ny4ape lnvil( sDtrur oo1apxn feils s eauvo (0areoio oatlpt auei t t2toim io1amenmneils  2tax  ;o0oleoifetad s2emnvs;(0alerxf3oy1fpD aieils)tetoxo3iu1omtemicsasfarua(mont4tetnmoeiysls ea(ms (4aetrifcoydlptrluvo;s0sruoim3oy1lme lfcs ()aDraxmoou1oleo oetas sDuan p;u0tltomf oadfptrauvols)t2xr(rpou1op nlnctlt)aDtr( pno4aptn ieiaslm2rluvo (0texrmfctytomteluvs ()t2xoxopnu1lm emfvia(  Dtm(ro;u1oleomfciydlsDraumo (0 ltnir3iytfpte u o;t) eumiopnudlp emncsls)artrum ;u0tetnmfeiydfa umn s;t4alerxo3iatlmDe u i (0 rtm(opiy1ole mieta( srum(r ;u4ale  o3iatfm2eluvs;u) leomr oodla r n sls0 etoir nudlpee ics t  rtaumpnu0alxo i3iyt m2ua( ont) rerio3iy1fateai i t0 rtm(o3iodam  miesls)aDumxmp;t0tlxnifeiytfa um(vs;u0texomociytfaD an s (0t2tr(o3nudome mfei sfs2umxmo;o1aee if3tatfa2ua(vo;(4teerir3oo1lpt anvo;t0 2xmxrpiydamte ieiltfsrra( poo1ole  feiyt a2eln pnt4tltnxo3oodfp r ueil() rxrir3oo1ole mnci ( s2rrxm ;t0tpeomfeiydfsDemnmon()trerir3oo1fp raiei t0s2xrirpiu4apeelnct sf Drax  ;o0aetn ieiat m rauvpn()alenxf3to1fpt lieilt)setrir oodopeelnvi s)srraur oo4oex  ietltfs uan sn(0tltrxrctotlaD auvo () 2trxrpno1optn ivs t)arur( ono1optn ieilsfmDran ont0trtrmo ty1fpteai o;()tetoiopiydop nlnct t a2tmxmono4opxomo3ias a2umu on(4 rxnxf tatomD ai o;s)seuoio nodapenmfvt () Drmxront0tleo feiad mDeluvp;u4 reoxf tydfateln olt t2tr(m3nodlptelnetas aDta(mont4aetnmfcildfa rau o t0 reoiocootfat  ieo;t  rtrir io4olenliesls  2rax  nu0tpt mo3iysfm rauvo t0tlermo3iatopDeauvi (0 2ur(r ny4aleelfvsa(fsrtaur ;u0oee  fcildfa2el(vp t)aleoir3to1oat anvi;s0trxmxrpiodlmeemnesls)sDum(r ou1aetnmf3iat s2uaump;t4 ltoif3tatomtr i o s s2uo(o oydalt  fctat) Duaumonu4tpeomf3iltlm2umn sn()trermf oadlp eauvi;(  exr(opoo1ap  mfvslt) 2urx pnu0tptoif3tldfaDum(mo;u0teenmrcoa1opD ln o;( srtoxm3nydal nlfvs () Drr(mo;t4tlxomociadla2rauvs;u0teenmr oytlaD auei t0 2tmiopno1lmt mfcs s aDrru p;u4aet mi3iydlm2uan s u4altomr3oa1lmtelu s t)tetmirpiudlpenmictlt  rur(moot0apto o3tas m eauvpn(4trtrmr tatlm  aivils) rur(o3iy1open net sfs2taxr ;o0aeeomiciyd m uluvs;t4arxnio oadoa e u s t)texo(o3no4om nlivsl()srrmxmonu4oexoiiciatfmDemnvo;(0arxrmr oatfm elu i;s0 exrxo iu4am e iet sfaDurx oou4opt iietls aDumuvonu0alxrxr3oodfmDraies;t)truoxo3oy1lptnmnctls) 2rmu  no4aex  octldfmDuluvo ()texrxr3iatfp eliesl(0 2urio nu1altn iciat srrmur no1opxnifciyt s2emnvp;u4 renmfctatfa eai i s sexoim3iy4llen iciasf rurur oo4openifeilt a um(msn()trtnxociodfp r iesl(0srto(rpou4alee nvsat arur(mp;t4opeomoeiysfsDraumpnt0 ltrmrcia1op   n il( srxrxr io4ape lnes (fsrta(rp;u0aleoifeiltfaDumnmsnu0 ltoxrcta1oatelies;()setm(mpou1lmen feils aruaumoou4ole mfciyd sDraumpnu)aexnxrciydfm  ai s;(0texo(opiy4oleemivtl(f rrrxmp;u4tlt if3tyt aDumnvon()alxoio ootfpte ivs;t)setriopoo1al elicta()a2tmu pno4tpx ifeild m uanvp t0 ltrir3iytlat lues;(0setr(m3io1op  mfct t)sDta(mpnt1ape iietlslaDrmu pnu4tetoifcio1oa raieilt0teuo(mpnu1omt mfcsl() rtmu p;o0alx  octas sDemn p u0trxrmrcto1lp rai o;t0texmxrpiu1openmiet ()sruax ont1alxn i3tys mDulnvp;() ltrxocootlmDrlneolt)tetmxr3iydal emies ( a2taump;u0apeomfeiasfm2rmump (0 eenir io1fmDelnesls) rtr(mpnydomte nei (  rtru  nt0alto oeiasfm rmnvon(4tetrmr oydlpDr neo;t) 2tmxopou4ope mfesat arumumpou4oetnioctlslmDrm( o (4teenmr3oy1fptr ies t)texmxo3ny4lpt lncsa()sruaump;t0ope moeiysfmDumn s (0 eenmo iodopte ieo;t0seuoxr3io4amte fei s) rur(  oo4tle iociasfm2uau p;u0texoxf totla rai ilt) 2toirpiydolenmfvs ()srtaurpnt4ope  fciyt sDuanvo;u4alxomr3tadlpteai il(0trumxr iy1olt mfctatfarrr(rpnt0alx mocias s em( o;t4 etnmrciatfaDran ils0trtmirpiy4lle  ncilt a2tm(monu4ope  fciad sDua(vp t4 ltnxo oytop e i ol()trurio iudomtnmnvt ()sDumxmpou1oet  oeiytfs2ra(vsn(0 lxoir3tydom elnesls)srxo(m3nu4optn neia(  Durum no1tle  oetyslsDrmumsnu0 lenircty1lmteaivs (0teur(opnudol nlivsa(farra( o;o0tlx mf3iasls um(vsnt)artnif3oa1oa ran o t)s2xrxr3oy1lpen fet ()arrmxrp;u0apto ieias m2elnmo;t0trerxo iy1oaDrlnvs;t) 2to(o oodalt livtlt) 2ur( o;t4tetn feiys a uln snu0artrir iadfmtraueo () 2umxm oo1lp e nvs t)sDua(moou4oex moeiytlmDua(von(0alxoxfcoydfmtraueilt  2tr(o iy4ll n fct tfaDurxrpou0openioetlsla elump;t) reomrcio1lmtr ivi (0srxrio io1olte ies s  rua(m ;o4aptnmieiydlsDumuvs;(0 exnxf3iatlaDr u olt)t2xm(mpnydomt mfvt (fsDta(r nu4apeomociydfa el(vo;()areomociydlmte nes t s2xmxr3no1op nlfvtls aDta( pot4tpt  oetld aDelnvsnt)tetnif3ta1oaD  u i;t t2trxr nu4olt miesls s2trumoot4aexo i3iasla2rm(vp u) rxrxf3ta1fmt  ueilt)setr(mpnudlme lnvtl() rrmumoot4apxnifctls mDemuvs u0 lxoir ootfp eau s s setmxo3nu1lltn fvsas aDtr(  no4alxomfciatfsDrl( o t0tltoxrciy1fp raieilt  2tmxm3iy1lm emncsas sruaur ou0tpx  ocils s emu p (4texrxf3totfpDr uvils0srxmir3nu1op  lfvslt  rua(rpnt1opt io3iysla2uan sn()alermr iadoa elivslt t2to(m iodal   feta(f 2tmxr oo4aetn o3tyt a emnvo u0trenircoadopDrlivols)texoxr3ny1lmte fvia(f rtmxmono4olxo fcilsfsDul(vo t0 eermf todfptrli sl( srum(o3iodllen fetls a2uaurpnt1olenmoetyslmDea(msnu0tlerxf3iatoaDrau s;()tetmirpiy4opte ncslsfsDururooo4apxn ociyd a2rln p;t0tlenioctodopD anvs s) etmxr no4al nmnctas artr(rp;u1aexo f3tld mDuluvs t)tltnmrcia1fa e i s;t0 2xrxo3iydamtnlnvils aDur(m ot4apt mfciadla rlnvp t)arenxrcootlm rauei t0s2trxmpou4am   ivs (faDtmx o;o0aptn f3iysfaDul(msn(0 rtnir tadlatrliei;(0s2toio iu4alen neias) Dra(mo;t1tptoiiciat a uanmo;() lxrmr oy1lmDran o;s sexm(mpoydopte fci tfarrr( o;t1tlxoio3iltlaDranvs () etnif iy1fa rai s;t)seumim io4apt  ncil() 2taur ;o4texnmfctls m umuvon(4trxrxf3ootfpD aieolt0teto(r io1open ivsat)a2rr(mpoo0altniociltlmDrln o;t0altoircto1fa rlnvo;( s2um(r io1apte feia() 2taumo;u1olt  i3tld m rl(mo;()aeeomo3iytop ran sl(0setr(r3iodame mnctlt) rra(r oo1opx io3ilsfm2emnvsnt4 lxnxr3iydfm r ues s sexm(opiu4lmt livsl(fsrurxrpot0altomfeiat s emuvsn() eermr3tatfpt aieo;t t2urir iydal e icsl()a2raumono1alx  fciad mDel(vo;u4texoio iy1fateanvo t0t2trio oy4omee fvsl(  Duaurpnu4oexnmo3iasfs rluvp ()texniocio1omDrli o;s seur(mpiy4ap e nes sfaDtr(r oo1aetoio3tlsfs2uaump;u4teermf3oodomtelu i ()texmxm nydlmtn fci () Dum(  ;o0olx moctytlaDrl( pnt0alxomrcoy1opt aivo t)s2tmimpoy1openlfvtl(faDum(m ot0texnioeiysfa2elnvo (0areoiociy1faDraiei;s0 2xm(m oy4ome  ncia( aDtaur nt4tlen ictydfs umu snu) rtrxfctotfptrai o s0 rtmio3nodap nlieta( aDtrur ;u1aetoifciadlm emuvon()arxnmf3iotlmtelneil(0 rumirpoy1oltnmneiltfs2tr(mo;u1opxoiieiys sDelu o t0arxoxf to1laDraueilt0 2xm(mpnydlmee fvt (fsDtru p;u4apx moeiatla2rmums u0 ltnmr3oy1fa e nvo;t0s2uoio3iu1lp emfct () Drm(mo;u4alto ieiatla2ranmo u)tetoxf io1lp elu o;(0t2xoir oudape lictlt  Dta( pou0aeto ociad a ul(vo (4 lxoxf oytlptelneils0 ruoim io4olt  fvs t)aDrmxr ot1apx mietat s2rlnmpnt0trxnxf3tytfm e i o ( s2xm(m3nydop  mnvsls  Dtrumpnt0apt ii3ilsfmDumuvp u)texomfcio1fmt aiei;t  rxr(o3iu1am nmfvtl()aDuaumoou0aleo ietatfs2emnmont0trtoxf ia1fpte ivs;( srtm(o3iodol   ncils) rtaxrpnt1teeo fctldla rl(mo;(0 eerxf3ta1fmD  neilt tetoiopoudamt  neias)s2rm(mp;u1tpe mictatfm2ulumo t0 exnio oodlmt lneil(0 rtmim iudlm nmfetlt) rrruroou4oltnmi3iydfs ranms;(0tltrxfcoy1faDraneo ( srtr(o3no1am elivslsf 2rax poo1tee iociatfa2um(ms ()texnmr3ia1op eau ils)seuoxrpnudame livt t  2taxm ;u0alxnmf3ils aDrl( s;t4tetnir iydomt ai o ( t2xr(rpoydam   nviat) Dta(mp;o4aexnmo3tadfs el(vs u)arxrmf tydlpt luvsls)srtm(m3no1om n nct ()sDrr(rpoo4aexn fctadfaDua( s;t)aeeoir tadlm r ueils0teuoxo oudlm  livsl(  rrm(r ;o4tlxomoctlt mDua(vp ()aeenmo totlm e i slt) rtrxopoy4omt lnviltf rurxmpnu1teenmf3tlt aDemnmo ()aeenio3iytoa   uei t)tetm(o ny4ap  mfctas a2tmurpnu4tpto fcilt m rauvp;u4arenmo totlaDrlneslt0 2xoiopio1lp n nvs t srtrxro;u0aetomieiasfa um(mon()aexnir3iatopD  i o (0srxmxo ny1altemfvtltfsDrax pnu4aeto octadfs2em( snu)aeeomo3iadoatrlnvi;s setrimpoo4altemncils srur( ono1aetn i3tas s rl(mp;(4 rtnif3oydlptr ivs t  etrxm oudapee fcsl( a2rm(r ou0opto fcildfa2ulnvonu4 ltnxrctytfmD lnes;s0 eurxm iydoltelivt s)aDtrur nt4oexnmfciydlaDulnmo ()arenxo iadfatranvo;t  etoxopno1ameelicil( sDrr(rpnt1oeenmi3iys a rlnmp ()trenmf oy1faDelnvi;(  rur(rpiodomee ict tfa2urum ou4apeomocildlmDemu on()aexoir3totfmD  iei s)texr(m iu4ome  ivslt)a2rauro;o4aet if3iadfm2rmuvo;u)areriocootoa rlies;()setrimpnu1amenlnvsls arua(roou4tpt  o3iydfaDuluvp u)trenmocty1lm  luvo (  2urxrpiodlptn fct s  Dta(rpou4tlen fciadfs el(ms;t0artrxo ta1lm  ln sls0setoxr oo1lptnlnes sfsrrauro;u4tpxniociatfs2uan pnu0aleoxf tatfatrlu s s0 2umir nu4ap e net s) rrr(mo;t0tlxnioeiydfm2rlnmont4arenio ootlaDr nei s)t2toxr nydomenmnes s)srtaxm ;o4altn oetytlm eau o;t0tlermr oy1fp rauvolt tetoxmpoodoptnlnvilsf rrmxmpnt4oexoiieiadfsDua(vo;t0aeenmociotfa elnvilt0t2tmxo3oydamenlfvi s srum(rooo4opx  ieild aDul(mp;()artrmr3iodfmteaueil(0tetm(r iydamt  ivtas) Duaxmo;o4olxnif3iad aDumu o t0 ltomo iatfp e ieil(0trtoxo nydll  lfesas  Drmu oou0oetn feiatfaDua(vp;(0aexnxo iy1oat anes t tetrir3oy4oltnlnvtat)srumxro;o1aeeomo3tld aDulu s;u)texrmo3iy1omDelivs;s t2xr(m oo1omtn nct s) Dtrxrp;u4olenioctatfaDelnmp;u) ltrxf to1fatr u s (  rtmimpno1lleemiesatfarrrx pnt4aex mieiatfaDe
\ No newline at end of file
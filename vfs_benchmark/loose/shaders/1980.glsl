@@ -0,0 +1 @@
+ivil()s2xmxrpiu1lptelivi (  Drmuro;o0tetoifcilslm2uanmp (0trenio iadomtr u ilt0 ruo(m nydlmenmiesasfsrrau  nt4aptomiciadfa emn p t4texomo3todopD lieilt0teuoxr3oo4olen nei t sDur(mont1aeenmfciyslsDuaums u0aeermrcta1opDrau ilt0t2uoir ny1olee iviat  Dra(mo;o4aeen i3ilt s2rl( p u4 etrifcoydfm r nesl(0srtm(o3oodapee nei t) Dumum nu0apeomfciyd a2ran o;t0teerio iydfmD  i s;t  2ur(r nydol n ici tf 2um(m no4teeo oetasfm rm(vonu4 renircootoaD aues;() 2toxo3nu1ap e fetlsfarua(rpnu1oetniocilsls2umnmo ()aeeomo3oydlmtraueo;t) 2umiopnodop emivtls)s2tmx  ;o1aptn f3tydfm rlumonu) exnxoctodfmDrlnvo (0 2uoim3oydomtnlicsls) 2uaxrpou4aetomfetld aDea( sn(0aexoio3iotoptrlivil()s2toir3oo4opte netls a2ta(rpoo4openio3iasfm emu onu0trenxr iatfa rluvolt0 exoxm3iodomte ivsl( sDur(rp;u0tlenioeiytlm rmump () eenxr iotfaD  u il()s2tmxo3iu1openlivtltfsrrax  ;u4alx ifctydfs ea(msnu4tltnxr oydlp rlnvi;( setmio ou1olenmivi ()sruaxro;t0tpe iiciasfs uanvsnt4treomf oo1omD li s;s  2um(mpnudlmtelfcsa()arurxm ;u1aex iicias mDrlu pnt4 reoxocta1laD au sl() rtrirpnudll  lieilt)s2uax  nu4olt mfetysfa eaumont0 eeoirciydla e n olt0s2tmxopoodole  ieiat  rrmx o;o1alt ii3tad m um(vs (0alenmrcoytlmt aiesls) 2xoxo3iydam  mivs s s2truro;o1ole  f3iydfs uluvsn(0teenif tydlaDrln s;t) eum(r nodaptemnct () rta(ro;o4opx  fcias m2eluvpnt0trerifcoo1lpDrluesls0s2ur(mpnu1apenlfcs t)sDtmu  ot1tle miciadfa2umn o;u) rxomr oytfpD  u slt0trumir3oudoptemfes ()s2ua( ont0tpxnioctat m rm( p (0 reoir3oa1fp rlnvo t0tetoir3oo4ll elnctasfaDrau pno1aetnmi3tysfmDuln on(0aeenmocootomD aivs;s) rtm(r3no4olee nvs tfaDraurp;t4tetnio3ilt mDrluvo () ltrir3oatom eai i;(0trxmir iu1ap nlies ()a2ra(r ;u1opeomocias m2ulnvsnt0 exrmo tadoa ranvs;s tetrirpiu1oltelnvslsf Drm(r nt1ope mocils aDulnmp u4tlenxfcoytfmD an il()srtrirpnudllee nvtl(fsrua(monu0apxn o3iadls elu onu)tltrio ia1op r ivs s)srtoim3ny1apenlnes t s2umxrpoo1tpe if3ils a elnvs (0tetrmrcoy1fp e ivo s)sexoim3io4olen fcslt a2umxmpot0olt miciysfaDeauvsnt)aeenmrcty1oatr n i;t t2xo(o io1lm  lies ( a2umx ono0tlxniietytfaDrln o;(0tlxnmr3oatfmDeln i t)s2toir ou1lmtn iviasfaDta(m oo0tetomi3tyd s2umuvpnu0 lxrifcoydom rau o;()trtmir3ou1ll elnvt ( s2rm( poo1aptomfciyd m el(vp;() rtnxrciytfmDe n sl() rxo(o ou4lmtn fvias arua(ronu1openmf3iltfmDelnvsnt0tetrxf iotop rln sl( trur(o3oudlpe mivtl( sDraxm ;o4oexo o3taslsDeanvpnu0 eenxf3oy1faD au il(0trtrxr3ny4lme mivsls aDur(  oo1olx  ictasfmDeauvo ()texoxf iy1faDelnes;s0sexo(mpnodlptnmnvsa(f Dtaxro;o4aeeomoeiydfm eau s;u)texrifcio1fpD lneols)s2tr(m3iydome mfvtlsfsruaxm ;o4aptnmf3tyt a2umuvpnt)artnirciydlaDrlu ol(0 eto(opny4ll  lfetlt)arumxroou4oexo iciltls umumo t4arxoxrcoa1fptrlnvo t trtm(m oo1ll e fei (f rrr(ront0olx ii3tlsfa elu pn(4aexrmr3iadfa  an o;s0 etm(r nu4al eliviltfsrrrx oou0aexn fetyd m eanvont4 lxrmr iy1lateluvol( s2uoxo nu4lpeelfeia() rua( poo4aex mietaslm2emu s;u)aeenxfcoydfaDrln i s  exmio nudapeelivtlt srur( poo1tpxo f3iyslsDua( snu0arerio3oodfatelneol()seumxr oo4lpte nes tf rrmurp;u4tpt mieildlmDrau o;t)tlermociatfmDr nesls0 2uoxr3iydomenmivslt)s2umu o;u4opt mi3iasfs ranmsn(0areoxociydomtrlu sl( srxmirpiy4omee ncia()a2tmxrpou1alxnmieiat sDeluvs (0aeenxf3to1fm eluei;s0seurxm iu1optelnctls arrax ono1tle  icild mDra(vp;t)tetnif3oytop eaivslt0texo(m no4apt  ncs sfaDtm(ront0opt  f3ils mDrl(von()aexnmf3totlatr ueol(0 ruo(o nodlm nmictltfarra(r ;t4openif3ilsfs uaumon(4aexoxr3tytlm elnesls0 2umxr3iu4oltnmfcslt  rtaxmo;t1oetn i3tadlm2umuvp ()arerir oo1latraneo t0srxrio ny4al nmnei sfa2ua(  ;t4alxomf3iad m2umn p;t4 rxoxf3iydlmDrln i t tetrio iydlm e ivi t)sDumu o;t0apenmf3tlt s2um( o u)trxnxo tytomD an o s0 euoiopnu1alen ivilt  rrmuroot4tpt  i3ias a ulnvp t) exnmo iydfat aueilt s2xm(o3oydap e icta(fartrx  oo4texo feiyt a elums (0alxrir ta1la e n s;s0seurimpiodamt livilt)sDurx pnt4ape mo3tat s2rl(ms (4texnxoctotlmDraivilt)truoir iudopt lnvtl( a2tr( ont4opeoii3iys s2ranmont)texrmf iytfa raneslt0 exmim ou4lpeemfvsltfaDtrx  nu4opt ii3tysfm uln o;(0teerxr3iatoaDeaues;s t2tr(m ou4op nmneilsfa2trx  nu1olx mociyt m2rmuvo t)teeoxfcoydlateluvilt)teurio3io4ameemfesls)srum( pnu1tet ifeiysfs2emu p ()tltrio iytfa   n s;s0teuoim3iodomenmfet s s2ua(  nt4oet  i3iadlsDrlu ont)alenxf3iy1oaDe uvs;s trtoim3io4lpte feia( arrmxro;u1tpeoif3iytlm emu o u4 ltrxf ty1oatrlnvs;s) etmim oudomtemietat  2ur(rpnt0tltn o3iat mDem( o;u)tetnirctodlaD  ieo;(  etrxr3no1olt mnetasfarur( pnt4tlx  feiyslm um(vsnt) rtrir3ta1latranei s0s2urirpnydll nlieils)arrr(  ou4aeen oetyslmDra(ms;t0artoxr oydop eluvslt0s2xr(rpou4omte nvils) Durxr nt1tet mf3tyt aDrm( p;u) ltrif oadlmtelu o;s setmxr ny4olt lnviltfa2trxmp;t0oex mo3tad mDeauvs;t0 lxomr oadfa r u i;()s2xmxr oydam n ics t) 2rr( ono4aeeoioctltlm ranvp u4artoiocoa1fmtr uvo t0teuoxmpou1amee iei (fsDrmx pno1oetnmf3tasla2eauvs ()arermf oy1fmt lnvo t0t2xoxm oy4omtnlicia( s2ur(mpou4olx ioeilslaDua(msnu)trxnifctydfm rluvs;(0 rum(opny4lp  lnct t aDum( ono0oeen feilslm2em( p (0 reoxr3iydomDe ueols)truo(opno1oltnlfes sfaDumu pou0oeeomoetadls2rm( s (4 etrxr io1opt ln o (0trurxr nodame  fciat  Dumu  ;o0opx mietatfaDul(vont) etomf oodlpDrlueo;t0t2tm(rpio4lpe lnetatfs2ua(mono4aleo i3tldfs2ea(vp u4artriocta1op e ieslt)trxmir iu1am nliet t  Duaxrpnu4tle mf3iatfs2rmumon(0texoxo3tatfmDr nvil( tetm(opiu4amee ivsas srrmx  ot4apen iciatlsDulnvpnt0aeerxr ty1fa eaueol(0trxr(mpiy4amenlneil( srrr(  ou4ope  f3ilt a2ul(vo (0teeomr3iy1fm rauvol()srur(m3io4al nmfesa(fa2rax ooo4tetoioctad aDuln p;t4 rerif3iytfa  au sl()trxmim3no1ale mnet () 2raxmont4opeo iciys m um( o;t4tleomo3oodfat  u o (0srxoir nudlpe  ics s)sDraur nu4tpxoioeilsfs2ean sn()aeerif3oadom   ieo (0seto(m iu4opt mfcta(  rrrumpno0altomi3ilt s uan on(4 exrio3oatlaDrai il()s2toir3nudomte ietat)srtm(mp;o4ale if3iytls2ul( p;t0 renio tydlm e ivs;t)setoxo iydol emncsa(fsrumuroou1oet  ociydfs2elnvo u)trxoxrctytfaDr uei t)seurimpoy4ll  mnvsatfartmxroou1oleo fetatfsDelumo u)texrxo3oatlaDelieo t srto(m3iy4lm e fvt s) rrrxmpnu0oee  ictatfs2elnvont0teerxr oo1fmteauvi (0 rxmxmpnu4olt  feiat)srumuro;u4tle  fciltlm2ua( s;t) eermo tytfaDeluvs ()trum(m iu1opte ieia()sDtauro;o1oltn feiat sDem(vp t)aetrxr oy1lpD luvs s0 etr(mpiudll emfcsls a2taxmpot4tlto o3iysfsDeanmpnt)trtomf totlat ln i;t)sexrxmpnu4altemnei s a2trurpno0aex  ociys s ulumo;t4teeoioctadopDr neols  euo(o oy4omte icsls  Dtrumpoo0texoif3ilt a rmnmp;(0tltrxociy1fpDr i s;s trxm(mpou4aleelfvtltfsrrr(mp;o0alx mfctyslaDeaumsn(0 leoifctydlatr n i t0srxo(o oydopte ivias sDuru ont1apxoiictytla ra(vo;t0teerxocty1fmDr nei;t0 2um(rpiydop emivtl() rua( ooo4tex  f3ils s ul( s t) rxrif3ootlpt  i o s0sexo(mpiu4alt lfesl(  2uaum ou1tlenioctlsls2uauvp u0 rxrir3ootlaDe ues;( s2xm(mpou4ome lfet (fs
\ No newline at end of file
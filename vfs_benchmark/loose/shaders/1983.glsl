@@ -0,0 +1 @@
+nvi;(0texo(opiu4lme mnctat  rrr(mo;o0tpe ii3ildfs ulu s;t)arxrmf3tytlmDrln i s  2xoir nu4am e ictatfartauro;t1texomf3iytlaDumnmsn(4areoifctatlm e uvils0s2tmxo io1ap emfesl(farrrxmo;t1oltn f3iaslsDranvsn(4 renxo3iydop r neo;t  ruoxo nydllee ictl(fsrtaxrono0optomociadfm2eaums;u0alenxf ia1lm eliei;()srxoxrpiy1ope  netat sDua(root4tptnio3iadfm rauvpnu0trxnmf oa1fm   i sls0tetm(r3oudopeelivtls aDurxronu1olxoiieild sDrlnmpnt4trenxo3oy1oate n o t)srtrimpno4op   neilsf rtmump;u0texomicias a2uluvpnt0aetriociydfm eln ils0s2xr(rpiodapeemnetls)a2rr(r ;t0alt ifcils a rm(ms t)areomr todomteanei;s0srum(m3oydolte ivtat a2uau  ot4tlt ifciadfm umuvont) etoxr tytomDraivol(0 exo(m3oo1om emnvi ()a2tr(rpou1tpx iietat a2rl(vo t4 ltoir oatlpt  ivo s)s2xrxmpnu4lpenlfetl(  Drr(rpnu4ole moeiltlmDeauvo t4 rtnxr io1oat an i;(0s2urim3oudolt mfes tfartmumpot4ope miciysla ulump;t0teenircoytfaDeln olt0tetrio3oodlmtemnet t) 2rm(mpot1tptnii3tasfm2uln s u4 lxrmocio1opDr nvi;t)sexoxm oydlpt lfvilt)aDtaxmpou0tpenmi3tas a2rl( s u)alenxo iotfp  aneo;t)trxrimpoodll nmivsas)s2taxm ot0tetn i3iyt mDrmn p u)tetomociadop rlieo ( s2uoir3iy4lmtnmnesl( s2tmxr nt0aex  icilsls rm(msnu)texoxr3oa1lmD auvils)srxrim iodame miviltf Dta(  ou4tetn ociydlm rmu snu)trerio oa1fmt ai o;s0trxoxopio1lltnmfcs tf rrax onu4tptoif3iytlmDrmuvonu0tlenmf3iydfa  li o;() rxr(m oodomtelnci ()srta( o;o1alto f3ild s2rmn o () rxnmfciytlm rlivo;t  exo(o3iu4omtn fvi tfsrurumpnu0olxn fcildfsDumnms;u0teeoxo3oydlm rlivsls0t2xo(o3iu4lpte ieia(  Drmxm ou0apxnmfcilsls umn p (0tlxrmf tatlatrlueo s0trurim ou1olt  fetls s2urxm no0aexnmociaslm rmnvs;t4 eeomf3iodomDrln s ()t2xo(opnydlp e ncils arraum ot4opeomictat s ul( o;t0altrioctatfmteai o s  rxoim iu4lpeelncsltfsDrrurpot1opx ioeiadla2ean sn()aeeoxf tydoaD  i s;()srtmim3no1amtn fcs s  Draur ou4alxnii3tyt aDem(vpn(0trerir iatop rau s;( t2xmxr iu1om eliciasf 2tmx  ;o1tltn ieiydfs2rmums;(0aexrxociotlaDe nvi ()t2to(m3ou4lme mfeslt  2ra(ront0tee  fctat aDraumpnt0areoio ty1omtrli il( t2toimpoudom n fvia(  2ua(ronu4ape  ietyt m umnmpnu)aeeoxociy1oaDeauvi () rxm(o oudamtn ivt ( srrax pou1aeeoiietldla2elnvp u4 exrmo3ta1lpDe ivol( s2urimpnu1olenlicilt)arumx oot0oexoifetltlmDum( on(4artnxo3ia1laDeaueol()t2tm(mpiudam elieils s2urumpnt4texomicilt sDelnvsnt0 exnxf iydfmDrln s t)s2urxrpny1lm nmiviat s2taxr nu1opxniieild m umu pnu4arxnxo totoa   nes () rxr(o3oodopt  nvsa()sDra(  ;t4tpeoif3ildfs uanvsnu) lerxr3oodla e i olt)t2xmirpiydaptnmivi tfsruauro;u0oex ii3tytfm elu ont)tlxrmociy1fpt aiesl()srurim no1al   icias artr(  ;o1tetnmfeildla eau p;t4trenmr3oatop r nvilt)teumim3iydalte ivs s a2umur ;u4opx  f3iadfsDean s t) rtoirctotfpDeanvslt)tetmim3nodlltnmfeia( aDtaxm ;u1opxnmocild a2ua(mp;u4tlxrxfcoo1fpD  neo s0srtrim3nudapen ncsl(farrmx o;o1apxoiieiasfaDulu p (0arxnxo3tydom elnes;( seuriopoy4lpe mncs tfa2rax  oo1ape  o3ias s el( onu4aleomf iadlat aueols)s2trio3oo4ap   fetas)srtm(  no1teeoio3taslaDrmn p u0trenir3ia1fa ean i s)seur(r3io1lm n iesat)sDumum ;u0tle ii3iysfa2rauvo u0 reoxr tadop  aivo;t  2tmxopoy4ape mnctlsf rumx ono4oeeoiiciysfs elnvpnt) lxnxo to1om rlu il(0teur(r3oo1omtemfet t)s2rax p;t0olxomictyd a2rmuvs t0 rtomrcty1oa rli ilt0tetmir oy4apte nesas srrrur no4tpenmf3tys a2rluvpnt4aeermf oa1fmteauvo;(0 rurxo3iu4opee ivsas sDtrxmp;o4ope  ictlsla2uln onu4aetomf3iydoptr nei;( teurxr iy1amen nei (f 2urxro;o0oleoiiciyt mDemu snu4trtoxo tadomDr nvils  exoxr no4alt mfvta()a2rru  ;o1teeo oetlslm2eln p;(4trtomo3oo1lpt ln o s)srurim no4alt  fvia()s2ur(r ot1tet iicils sDrmnvsnu0tetnmo3iatoate iei s)seumxopoy1ap  lictl( sDumumoot4ale  o3iydlmDemnmo () lxnxrcto1la rai s s0setmxm3nu1llte fesls)srtaxrpnt4olx mi3ilsfa2umnmp u0texoif oatfm e ies ( t2ur(m3iodam nmivsas)srum(r no1apenmoetld m2ea(vpnu4aexrmfciytopt  i il(  exm(o3ou4llenlfes s)srtmx p;t4tlenmictls a uauvs u0aexrmr tadlateanvols0 eum(o3oo4lltnlfeia()s2raxm no1apt  fcilt s2ulu s t4texoxf oytomDeln s;(0trxrir ny1op e fvsa( s2ra( pnt1alxnmoctasla elnmont4trermrcto1oaDranvo () rtr(mpoo4amtnmfvsat artaxr no1tleo o3iltfs2el(vp;(4aexoxr3oo1oa rlueo;s)s2urxm3nydoltn icsl()s2tmumont1apt mfeiyd sDrm(msnu4 renmr3oydlpDeaivo () 2um(r3iydlm nlfei s  2rm( p;t1tlt  i3tas m uau on(4arxrmfcoydopD ln ol(0 rxoio3nu1ap   nctlt)sDurumooo4tpeoii3iys m2eau o u4areoxf3iodoa   u i s) rxmiopnu4ol e ivtls srurumpot0tlenifeilsla2uaumsn()trxoxrciatlpteai ol(  rumimpnu4ol nlneilt)aDrm(r ot0apt  o3tasfs umuvonu) eenmrctatlpD  n olt t2xo(mpiydal e ietltfsrtrumoot4alxnmoeild sDulnvpnu)artoxfciotlmteau s s  2to(rpoy4lm nlfeias a2tmu p;o4tlxoioeiysls rlnvp;(4 rtnmfciytoate ueil()s2tr(opio4am e fci t  Draum no1ale io3ildfmDuanms u)texrxfctytop r ivils tetmxr no4lp nmnet (farrau  ;o4texo o3iys a ranvp () eeomf iotopD  i slt0s2to(rpiodlltemiviltf Drmx pou0tpx moeiys s2rmuvon(0 rermocootfmtrau s;s teto(r3iudomt lnes tf Duaum ;u4aexo f3iatfs ulnms;() etomocto1om   n s;t0texoio3oodapee feslt sDur(mp;t1tpe  f3ild a rmnms;t)aeeoioctydfmDe ivs;s t2uo(o iodale mfvtls)sDuax  no4teeo fetytla rm( snt0 eeoif3oodoa ranvsls srtoio3nudlmtemfeslsfaDta( ont0opt io3tydlmDrauvsnu4trenxr3ta1oaDeaieo () 2urim iy4apen neils s2tmxmpou0tpe io3iasla umnmo t4aeerxo3ia1optrlnes;(0seuoxm iy4optnlivtas)s2uax ont4ape io3iadls ea( pnt4aleoir iodomte n ol(0t2urxr iu1opte nes sf rtaurp;o1aex mictltfaDeluvs;t0 ltrxf3iotlmtranvol(  exrxr oudapte fei t)sDrr(m ot4opeo icild m ea(mpnt0tlerxfcootlptrai ilt srxrxr oy4amtn fci t) Duaur nu4tee ifeilsfm2ua(vp;u0trtrmf iotlmDrai o;s)trum(opiy1lltnlivi (fsDuau pot4altn iciyd s2ul(vo;(4 rxoxo tydfaD luvols srurxo3ny1aptelnetls)a2rrum ot0alxn ociasla rm( s (0 lxomfcoy1optran olt)texo(opoy1alenmietas) rua( o;t1aetniieiytfs2rau s u) leoio3iadfp ran o s)trxoxr3nu1lpeelivsls)artruroou1alt mfciltlsDuanmpnt)trermo3io1lpDelnvs;() exrxmpnydaltnmnvtls)artr(mp;u0oee  ietysfsDumn on(0arxoiociydoaDr ueslt) 2toim nu1alee ivsat) rra(ro;o4teenmoeiltlmDemu on(4trxrxf ty1oaDran s;()texmirpnudomeemnvtls)s2umu pnt0tee mfciyd sDeln s t0arxoif ia1lpteaivil( trxr(rpiu4am nmiei s)aDra(rooo0olxnmicild m2rauvs;u0aexrif3tadom e ueo t)s2xoxo io4lme  nct s arrr( ont4oeeomociadlaDrl(vp ()treoxoctydomDe n ol( s2xoxopnu4alenmict ()a2trxroot0teeoii3iatfa umuvpn(4trtrmo iy1opDe i s s tetoio3nu4alee nei sfaDtaxr nu1tet mo3iadfa2elu s t0treoxocoadfp  auvil( t2xmir3oydol elfciasfs2tmurp;o0alenif3tysfm uan p t4tlxnxf oatfateaues t  2umio3ou1lmtnlfvt t) 2ta(r ;u4tleomfciad s raump () reoiocootfaDrai s (  etmxopiodlm  mneilt)aDrr(m ;u1tpeoio3tld a2umnvp;t0tlerxocoy1lmtr ueils setoio oo4ll emnctlsfsrtr(mooo1optnmfcildlaDuan s;u0artnif3iotom elies (0s2xoio3iu1am elfct t) 2trurpnu4tpt ioetasfaDrau pn(4arxnir iadlm e nvo;s  ruoim nodoltemnet t  2tm(m no1aptniieiys s umuvont0tetoxo oa1lpDr n i;()truoxopio1alenlfcs t)s2umxrpnu4optoifciytfaDuaums (0 ltoir oydop e uesl()setr(r io4om nlfei s)a2rmu pnt1openif3tlslaDuaumo (4 lxrmrciy1lmD aivsls0t2xo(rpnudape lnciltfsrur(r nu1oetnif3tyd mDelnvs;t)arxrxo oydoatranei s trtmiopiydamt lfciatf rrmx oou0oeen fciatfm2ul( ont0aeenxo iodlpDe u s ( trurio io4apte fet t) rtaxmo;o0teeoifeildlsDua( on(4 ltomfctotlpDrauvi t0t2toimpiu4al  lfcsas)srtax pot4aleomiciltfs uauvo t4teeoio3to1fp  lnei (0srtoxmpnu4lpt lnvsasfa2rau pou4tlxnifctasla2umumpn(4teeoir3iodlmD  ueo;s) 2xm(m oy4amee ieil(  Drm(r ;o0altn fetysfsDrmnmp;t)treoir3iodlmDeln o t0seuo(mpiu4amen fvi ( a2taumont4texoii3iyd a2uln pnt)alxnxr iytop ean i s  rtrir3oudape mfvsls) rumu p;t1teenio3iad m2em(vpnu4 rtnxf oytfmD lnvs;s0t2xoim iu1ale  nvta(  2urx oot0opt  i3iaslsDuluvon(4 eeoxocoy1fp eaivs (0tetoxo iy4ol n fctl()s2tauro;t1oetn icilt m ranvsnu0aeermf oodfmtelneo;( seumir3io1amte nes s) Drm(mo;o4tlxoiieilt aDea( o;t4tlerif3tytlmDelieo t) exrim nodlltnlfvsls artru oou4tlt mfciltls2uau s;(4 rtrmr ia1lm e n o;s  eto(m3iy4omtelnvils a2tmxro;u0tpx mieiys mDuanmsn(4artnio iydomtelivolt  2xmirpoydol elneil( s2uaur ot0oeenii3iltfaDrl(vs t4tlenmf3ia1faDrlu o;t  rto(o oy1lltnlnvsa(fa2urxm nt0tpeomieiadla rlnvp (0tltomrcty1la rauei;s0 rtm(opoo1lle lncs s  2umxro;u1aetniociyd m uaums u0tleomrctytfmD  ies t)trtr(o3iy1om  lnciltf 2raxmonu1tltomictatfaDuanvsnu0treomr3iadlatrauei t0 2umxm3oodlpte ict tf Draxmono1tet if3ilsfaDra(vo t0aexoir3tydlmteluei;t0t2xmxopoy4ol  lneiltfs2uaum ;o1tltnmfctatls emnmsnu0tlxoxocoo1lm  lneilt0t2tr(rpiy4amt  ietlt)srrruroot0tpenmieiysfa rlnmonu0trtrmf oatlmDelu i;s)t2xrxrpiodaltemietat  rtaxm ;o1olx ifetad a2raumont) leoxf3oydlpt an ols)texo(r iy4amtemnvt sfsDurxmpot4tleniieiaslm elumo u0artoifciatom e n o;(  etr(m3ou4omt  ics t a2um(m nt0teenmfeiysfaDel(mo;t4 lxoifcta1omt lnvilt setmirpou4ll elnctat sDur(rp;u0aee moctydfs2rl(mo;u4arenmociadlatrluvo () 2xrxr oo1lltnlnct () 2tmxmooo0tlt  ieiad sDumumo (0arenmr oatlaD aivsl()s2xrirpiy1ale lieils)sDrau  no4aetoifeildfa rm( pn()trxrmoctydlaDrlueo s0sexrir3iy1am   ieslt) 2rr(mpnt4olxomfetld sDea( sn(0 lxrxf3io1lpte uvils)t2toio ou1om emieta()aDurumoot1tpen f3tadfs2rmums;u)texnif3iadla rli i;s) rurxopnydlmenlieiat)arumur ou0aee moeiatla eaump;u4trtrirctytlm  livsl(0s2umir3oudal  lnctlsfaDtax  ;t1ole io3tyd s2eaumon(0altrxr oytlpDran il()teto(rpiy4ap e nviatf rtr(rpou4aeenmf3tat sDum(vs;t)tetoxocta1fa eaivsl( seum(o3io1lptnlfetat)aDtaur ;t4opeo o3ild mDeau o;u4arxrxr3totfpt aivsl(0t2umirpou4lmt lfvtlt sDrr( ooo0alxoiietysfa2eau s t0texoxfcoydfa eluvi (  exr(m nu4om  mnciasf rraxmo;u0aleoif3ilsfa umnvs;u) ltrio tatlmD lu o;s0 rurxo3oodlm  mfei (fsDtrurpoo1aee mf3ild m2rmump;t4areoxo oytfa  lnei (0srtrim3nodopte fvi s  2uax  ou1aexn o3iadfs um( o () renxf ia1fa  aneils)s2trxm3iy1aptnlnvilt)srraumont0tlxnii3iyt m eau o t4arenif iatlpDe ivils) 2to(opny1op nmfei t  Dta(ro;t4tptnmi3tad a rau ont) exoxr3iotfm  aivi t)seto(rpoo4am emfvsas)sDtmu  ou4openiietldla rln s;t)trtomo ootla  an ol( tetrirpnodop   fciat aDtr( onu0olxo ocilt aDrlnms u) ltnmfciydlaDe uesls)srxmxmpio4apeelfeslt s2uaumpnt4alt ii3tlsfs2rl(vs ()aexnmr3iadfaDr u ols t2xm(mpoudalee neilsfsDumx o;t0alxnmiciatlaDuln o;t) rtrifciy1oateli i;s0trur(o nu1ll   netat) Durxmp;t4tle miciasla2ul(mp;u4 ltnmo3iydopt au i s0trxm(r3nydolte fetatf 2umur no0opxoiietlsfmDelu pn(0tlxnxrctydlaDraneols)srto(r3oy1amee ies (f rumx  ot1oex ioeiys m2rluvo t)texrio iadfa rli s;s) exmio iydlmee net tfaDrmx oot1alto i3iytfa rm(vpnu) exomr tadoa eaieilt seum(r oodaptemfvi s)sDtaumpno1ape  o3ils m2rlnvon(4 lenmo oodfm raivolt0 exm(o3nudaptnmnvils) rtm(m ou4ope mf3iyt sDul(vo;t4texrioctydlmDraivs s)seumxm3nodop  mies (  rrru  oo0aeeo o3tysfs rl(ms u) eermfcio1optraiei;( sexm(rpno4om n ivil(fsDtruro;t1tlt  fctlt a uanvpn() lxoirciy1op e u o s0 2toxm3iy1lmeemfes tf Drru  ;o0ole iociad mDumu p;(4aexnxr iotom  aies t)srtoio3nu1amtnmivs ( a2tmuro;o0openmfcildla2ulums;() etoxfctodlpDeanvi s)trtoio oodale lfvs s)arumxm nt1opx miciat s eluvo t0 rtnif3iadfmDr n i;t)s2umxr3oudlmen ncilt sDtax o;o4oetn ieiytfs2ra(vonu4areoxo iadlpte nvo;s0seum(m oy1amtnlnvsls)aDta(rpno1tet ifciydfm2ranmp (0 exnmr tytlpD lieols t2xmio io4am  lieslt) Dumu  ;o0oetomo3iad m ranmp u0tlermf iatop e uvo;s0 eurxrpoo4ap  mivs s  2tmxmoou0apx iieiydlm raump;u0 rerifcoo1lp rln sls0 ruoxm nodlmeelfct ()s2ua(mpot4aptniictatlm eau s;u4 rxrxr oytoa eanvs;( tetmim iodole mnctat) rumxmpno4opxnii3iadlaDul( s;t0trxrmociytfa raivo;t)trxoxr ou4ol e iesltf 2ur(  no0oleo oetad mDrl( pnt4 eerxfcoo1laDeaieo t)texrxo oudom elfctat)a2um( oou1olxomfeiltfa ulnmo;u)artnxr totfaDelu s;s0truoim nu1op nlivslsfartmu pou1opxo iciyd mDumu p t)artnir3oa1faDr ieslt0trxoimpoo1op nmivsatfsruaum ;t4opxo fetys a2rm(vo t0aeenmf ootfm  ai ol(  rxrimpiy1lm nmicta(fa2um(ro;t0aleniietys mDul( o (4 lenifctodlatraueo;s0srtoiopio4opt  ieia(fa2umurpou4ole ii3ils m2rl(vs u4tlxoxo oy1omtr neo;s  2umiopnydaltnmieta(f 2tax pot4apt  f3iadfaDeanvo (0tlerif tatfatr u o;t t2xoxo3io4lmtelfviltf rumxm nt4opt mieildfm2elnvs;u)tetoxf3totlm  au ilt0t2tmimpoudlpte fciatfsrtmxmpot1tet  f3iltfaDelu o;()texomrciotom   u o;(  exrxm3nu1lp elfvtas)aDtaxmpoo0tetomoetyt s2rauvo t)artoifctotomDranes;t srxoiopny1ap e ncsat)aDrr(ront0alx mf3iaslaDuanmo;t0tleoxr3tydfpDelues s  2umio oodlleemfct () rtaum ou4oetomieiytla um(vpnt)trtnmo oatfmt anvi;()seurxrpnu4ameemieias)s2trxm ;t0texnmiciysls el(ms;t0 rtoirctotfm raneolt) 2urxo3oo1amtnlivilsfaDtm(  no0teeomociltfa ean o (4 rtrmr tydfmtelu il( s2xrir3nu1amee ictls)a2tm(  ot4apxomo3iasfa2uanvsnu)tlermrcoy1optraiei;s0t2xm(mpoydam   fctat srta( poo0olen ieilsfmDea( ont) rtnxr3to1laD lnvols seumxm3iodlm  mfviasfa2ra(r nt1tex  ictysfm ulu onu) lxnxfciy1lpt lneilt0srtoxm3oo1apee icsas artrum oo0aex ioetadfs2ean snt0aeenxociydlmte n sl(0 rtrxopnodopeelivil() 2rru pot0tle ioctyd s2ean pnt)aexnmrctodla r i ilt0seurir3oydlp   fes s)srra(rooo4opeomictldlmDeluvs t) eeoxo oodom  ai o t  etrxopny1lmenlnvilsf Dua(  ot4tltnifciydlaDuan pnu0texnmf3iytfpDr ivs s)tetr(r oo4oleemicsa(fsrrm(rpot1opxomoeiadfmDrlu p u4trtrxo3iodfp  aieols0seto(r3iu4ale licsa(  Drm(ro;u1oexnmi3tatfm2el(vs t) rxoxo3iy1lm  anvilt)seuo(rpnu4lltelicsat srur(r no1tlxomo3tyt a ua(vsnt0tetrxr3oodoaDr uei;t0t2xoxo3io4om e ivi tfsDumxr ;u0tet mf3iadfm el( o;(4aeeoxocoa1fptran ils s2xr(opiu1apenmictas)aDtrur ;o0tltn ociad s2rmu onu0altoxo3todoatrauvi (0 etrxrpoy1ale mfvils aDtm(  nt0oet  o3tltlm elu pnu)trxoxr oa1laDeaieo;t0sruoio ny1lleelfvtls  2rmu  nt0tpt iiciad sDelu p (0 rtrirciydoatr n slt srxmimpiy1ll e ict s sDur(rpno1olxn fetaslm ul(mo;t0teeoxocootop rau olt0t2xrxr nu4lltemfesat) 2tru p;o4aleomocildfs ulumsn(4alxnir ia1la  aues;t setm(m io4lme miei s sDuaurpou4tlto i3iatlsDra( s;t4aetnifcootlpt lu o;s)seuoiopoodapenmnei t) rrr( oou4apeomfcildfm rau p;t0trxrxfctytfmDelu il()teurim iodolt mnvil(f Dtrxmpoo1alt mo3iltls2eau o;t)trxriocoadfm e uvo s0s2uo(r3oodam  lfesa() Drr(  ;u4alxnmoctyslaDul(ms t)trxoxfcio1fpD  uvi;s)sexr(mpoo4llt mfci ( a2ta(rpnu4tlx  octysfa2ean s (0tetomo3to1fmt  uesl()teuoxr3ou1al   ici tf Drrxmoou0aexo o3iyt m rl(mo u4 exnio3tydoaDr ieo;(0trtrxr3nydame mieils sDuax p;u1apxnmo3tydfa2rm(mp u0teenir to1fm r ivs t s2ur(r oo4ome mncilsfaDtau pot4aeeo i3iytla elums t0 ltrio ia1om e ues s0trum(m nydlleemfvt t)s2tru pnt1tlt miciatla rluvs t4aetomo tytfatr ueil( t2tmir3nydlmenlnvia() rtrx pno1aeenmi3ildlsDraumo;() exnxo3oatoaDe nei;()teto(r3ny4alte neia()aDuru ono4olen iciadfmDea(mont0aexoxr iydopDe ivs s  2tmxr ny4ll  mncsas)s2uax  nt0tpxomieiatlm2rl( pn()tlxoxf ootla rlneo;s)teto(m iy4ome mnetltfartrxrp;u1oltomi3iatfa ua( o () exoiocta1om raues s0sexoxr3io1optnmfcs t)aDumuro;u0tpx mf3tadfa rmuvs t4artrxrcta1fatrlneol() rtrim iu1lmtelnes sfsrtaxmo;t4aeen oeiyt mDrauvs u0 rtriocoy1lpt  n o;(0 exoxm3iy1llee fes tf Dumurp;t4ope  icildlaDum(vo;(4tltrxr3iodlaDr iei;()seumir3no1ap n ivslsfarrrxmpou1teeomo3tad m uln p u) exnmf ta1opDeluvi;()sexrxrpio4llte fcs s)sruaxr ;u4altnmietys a2uau p t4 eermrcoodomt aivo;()teur(o3ou4aptn ncils) 2umx ont0ale mietadfmDeaump (0alenio oytlmtranei;s  2urio nodoltn fcil() rumur ;o0olxoif3tlsfmDran o t)trermr3ty1fa e uvi;( srtr(r3nodom elnvslt) rrru  ;t4openmf3iad s uauvo;()trxrmrctydlp eln s;t0tetoxrpiy1apte icta(  rrax pnt4tpe  oeiasfs2ean p;u0aexrxr3oatoaDeai o t0t2uoxmpny4open icilt)aDrm(rooo0ape iiciatlaDemu o;t)aexomr ta1lat lieo;t)s2uo(r3io1al  mnesa( sDtrxrpou0texo feiydlsDua(vp;u4altrirctatfa eau i;()srxo(m3iy4omtn nesasfa2rrxmont4tlt iocias a ulnmsnt0artoxr3tytlateli o t)trtrxr3oy1amenmnet s a2tmxmoot1apto ocild m ea(mp (4tetoio3iy1om r neil(  eurim3ny4amenmict t aDrr( poo0aeto o3ilt aDuluvs;(4arxoxo oadfpD  ueols) rtmxr3no4al elivtltfsDumxrpot0aptn ociasfmDra(mp t)arenmr3oadlaDean ols) rumxo3ny1om  lfei ( a2rax pot0tlto feiatla2um( pnu0 ltomr iy1la ranvi () 2xmxopnydalt lnvs s)s2raurpoo0tpxoio3tadfs2rl(vs;t)teeoxr ta1fatr ivi s0s2urir3oudomt lnvtl()arum(r no1aetomociad m ea( o;t4texnmr3ia1opt lnvs t0s2ur(mpiudllen fvi t)srtaxmono4tpto f3ils m ua(ms t4alxnxo to1lmte neo (0t2ur(opnydlle mictas  2tmx oot0olx  icilt mDeln s u)alxnmo3tadfmt lnvs;t)srtmirpio4op   nesas srtm( onu1aptnif3iysfs2ulums;(4tleoxf3iydlmD aieil(  exoio3nydapenmfeias)arraxmpno4oleniocildfsDumump;u)tltrio3iadfm eau sl() exrxm io4ope  ivi sfarur( p;u4tpxoiiciytfs rluvp;u)altoir tatlmDrluvi;(0 euoirpoudlle mivsa()aDtr(  nt0tpen f3iydlaDuluvp (4texnio3tydlpDrlueo;(  2xo(m no4ap e ncilt  Drm( p;o4ope ifetadla2uan pnt0teenxf todla r nvs;(0 2urxo3iydapt mici ()aDrr(mooo4ape io3tltfm emn s u)alxoxfctodlmtrauei;s0s2uo(r oydalen fesl(  2ta(moou0tltniiciadfa emumonu4 exnmr3oadfat lu o s seum(o oo4ap   ictlt) 2tm(rpoo4ale mo3iad sDuan o;() etomrcta1omteaueil(  rxm(rpoudlpenlnet t)aDtrxmpnt0tpto feiltfaDumnvo t4teeoir3iodlpDe ueols setoxr nu4al emnctlt)aDta(rooo4tetoioeiytfs uau pnu) ltnxrcoydopDr ieilt0texmir3oo1opte fvtls)a2taxmonu1tpt  f3iysfsDuau p (0tltnxocta1omD  nvslt0 rxm(opoodlp nlici t) ruaxr ;u0apeomieilt s2rmn p;t) reoio ta1om r ueo;(0 etrxm3io4amen ieils)sDrrum ou4olenmi3ild s emu p;()teermo oadlpDraieo ()s2xo(r iodlp   fvsat)artm( p;o0aex  ociyslm eluvp (4artrioctytfmtrlivslt)trtoim3iy4op nmncias aDra(ronu4tlt  o3tlt aDeauvpnt)altrifciy1faDe ues t  2xo(mpiudapenlnesls  Dtr(m ;t1opeomietlsfa2emn p;() ltrio iytlpDelneo;(  ruoir iodlm   ivtl()sDtrx ooo1olxn oetydlaDumu p u)alerifciatlp  auvi (0sexr(m3iy1ap elnvils srua(mp;t4apxnmfciltls um(mp;t0aexnxf3ta1lp  lieo t)s2xoir3ou4ll emfes ( aDrmumpnu4oeenii3iys m2elump (0aeeomo ty1lmD  n i;s0 etrio3iu4op e icil()aDrrxmono1tlto feiltfmDrmnvo;t4 rtoio oadlpDraues;t  euo(mpiydll  mfcsasf Dra( pou4alxo octlsfm um( p;u) lxnio iydfpD aieo;s0 eur(o ny1lltnmfcsas aDta(rono4alenmo3iys m2rau snt0alxrxocoatomtrlnesl( s2tmxr iydlptn ieta(fa2rr( oou0ape moctytfm2ua(vsn()trxoif3oa1lmD au s s0 2toirpny1alenmncsa() 2tmump;t1teto f3tyslmDea( pn(0 eerio io1opDr n s;s0trxoxrpnodll nmfesl( aDtr(m nu1teeoifeiysls rmn sn(0teeoir totlp e ies;(  exmimpio4amteliet t aDrr(m ;o0apxnif3iyt a2ulu p (0aetrxfcty1oa  an i s seurxopnydomenmnviasf rrmumpoo0alt micildla2ea(vp u0teenio3oytlp rlivi;(0 etmxopnodop elfctatfsrrr(mpnt4oet ii3tls aDulu p;t0 lxomrciotop  an s t  2xmir nydlpeemnctat)srtmx p;t4tpxo f3tld sDem(vpnu4tltnmr oadfmDrlu i;t0 rtmxm io1al nlneiatf 2trxmoou0oeto feiltls2em( snu)tlenxr3iadoa   ueol()trur(opio1oltelncils  2rrurp;u1teeo ietlsfs rlumsnt4 renmf3tadfptrlnvs t sruo(o ou1amt  ncs s) Drm(m ;t1oetoifctatlm ul( snu4 reoircia1fm eli i (0setr(m3nydapt mfctas)srrmxm ;t4oetnmfctlsls2rlu p u0 ltnmoctodfaDrlnes ()t2xm(o3ou1amteliesasfs2ururoou0tptnmo3tls a eanvon(4 lxoio3oydfp  liei t)seumirpoy1lle mfvtat) 2ur(rp;u1opxomo3iatls2umnmpnu)alenxociodlmte u o (0 etm(o oydll  micsa(f rrmu  ou1altn icilslsDum(vont) ltoio3tadoaDelnvo s0 2trim ou1apt miesa(fa2tm(  ot1aee mietatlm2umu s;t)tltrxr3oodlaDrlnes;s)setmio3nudal n ies tf Drrxroot1aex micias sDuln s u)aeerir3to1lptranvs;t)t2trxmpoo4om  mnvta(fsDum(r ;t1tle mo3ilsls rmu s ()altoxr tatfaDrlnes t0s2tm(r3iy4oleelfci (  2taum nu0olx ii3iasfa um(von(4aetoxrcoodlp rli i;t0 etm(m oodomtnlivtltf rumumo;t0opt  fetatlaDumu snt)tltoio3oodlmt aies s) rxrim nu1lmtn ivi tfsrumxr ot1apxomi3tls a rm(mont0alxoio ta1omt ai ol( trxmio3oudap   nvs t a2tau  ;o0olx  ieiydfmDrmu p;u4artomf ia1lpD aueil() 2toxo iodame  fvt sfs2umum ;o4tetoifciltfaDrmumpnu)aetoir3tydfm eanes;(0srumxr oo4altelneslt artm(r ot4aetn oetysfs2rln o ()aexrmf tytfp raneslt) rur(rpnudom   fctls a2rrurpou0tpxnii3iys s umnvsnt)tltoif3ootfp r nvo;t) rtoxmpoodaptnmnvia(  rumxrono4tlxoiictadlmDum(msn()teenxrcoa1fmD  neslt)tetmimpiodopen fvs (f Dua( ont1ole micilt sDrln s;u4 leomo ia1lp rlnei t0s2xmxrpno4apenlivs ()srrr(m oo4aetomieild a2rl( p;t4alxomrctydfaDeaueol(0s2um(rpio4lp  miet t artru poo0altn o3iydfs eluvpnu0 ltnioctodfp rliei;s)s2toxrpoo4olte fcsa() Dtaurooo1olxn fetydla rlu p;t0texrmfciadlaDe ieo;s0 eumxm3oodllt  fcsasfsDtmuroot1aleo ieildla emn s t4 exrio iadlp r ivo (  rtm(m iudll e ies s sDrau pnt1tpe  i3tydlmDem(mpnt0arxrmo ootfmtr uesls) 2xm(o3no1am e netat aDur(ronu1opt io3tldlmDum( pnu0tltoxfciatfmtrlnvo t0teurio3oydope lnvs (fsrrmur ;t0texnmoeilsls2ra(vpnu0 ltnmf3tadlmteliei;s) rtrxrpoudapenlneiltfsrrmuronu1aetnmo3tydfs ua( p () rerif3oatomDelnes;(  2xrim3iu1lm   nei ( sDurxrono1tlxoifeiyd s2eanvo (4 lxrxo3ty1fm eai ilt0setrir oudlm   ics (fa2rm(rono4oltnif3iysls rl( snt0trenmo tatomtr ueol(0teumio nudaleemnetl(f Dtaxm nt0apxnio3iyt s eanmp;u0trtnxr oytlat  ieo;(0 rumirpiy4lm e nvs t)arraxmpnt4tpe  feias s2emn onu0aetnxr3todfp  aivi t)t2to(m ny4altemneslt)s2raumo;t4opxnmi3ils sDrln s u4arenxr3oodoateaieilt) etrxopou4apt miesas)s2urumono0alxoifciysls2emn s u)tlxnxociydlaDrluvs s0 exoxm oodomt  ictl(fsrtm(mo;t1aee  ictysfaDea( o;(4aexnmr oy1lm r ieols0seuo(r nu4ap  mfvtat srtru o;o1altnmfciltfs uan s ()arenxr3totlm  ai ils)teuo(r ou4ape lnciat aDtaxmpoo4oex if3tlsls ra(vpn(0teeomf3tydlat auvi;s0 rxmir3io4lmt  iet sfs2tmx  ou1tlt mfcils m2rl( p;u0tetriocoa1fp eauvslt  rurir oo4lmen nct ( a2urump;u1alenmfetyd a emn p;t0 ltrxf3totfaDe u s s) 2uoio3io4lmt mncia()s2rrx  ;o0apto iciysfs2ulnvp;u)arxrxf todfpDeaieol()sexo(m io4lmtn ivtls sDtm( pnu1oexn o3ilslm2eln p u)tlxniocoa1fm rauvo;()texmxr3nydamenlfcias)s2urur ;o1tlxnmi3iatlm rl(mp u4alxnxfctytom eluesl() euoir iy4omen fes s)s2taumpoo4apxniictldlaDea(vonu)teenifctatom  anvol(0 ruoim oo1amt mnvsls) Drr(monu0teeoifeiat sDumnvsn(0texnioctytom elu sls t2tm(m io1lmt mfci t)srtaxr ;t1opt mi3iltfmDrln s;u0treoir ootfpDrluvs;s) rum(r nu1lmt lnctat sDua(  ou4oee  feiat sDrmu o;(0texoxr iodopt  neilt)texoxo3iy1omtemfci sfsDrr(  ;o1apenmoctldfaDuanvpn(4 lxrif iy1opDr uvo t  2xr(r3io4omenlfvtlt)aDtaxroou4alt mo3iadlmDum(mpn(0areoifcty1lm e n ils  2trxopiodlltemfcs s aDur(rpou4opx io3ias m uanmo (0 exnir3iotlpDrlies ()s2umxm oy1ole mnvt s)aDrmx  ;t0aex  iciyt sDuln p;() exoxoctodlmt anvs;t)s2xrxmpoodlmen feil() rum(mo;u0tlt iociyt m2eanmont)tetoxrcio1optraues;( trurirpiy4lm nmfctl()sDtaumpou0oet io3iydla umnvpnt)alxniocty1fmt livo;t  2xr(m3iu4omtnlnetls s2rm(rpoo1ole  fctytfa2rmnvp;u) lxoxr ty1opDran slt t2xo(mpoo1ame  fctat  rrmurpnu4tptoifctasla2el(vo;t4 eeomfciotfpDrau s s sexoir nodlpe mictl()srua( pnt4aleomi3iad s2rlu p;t4 rxoxrcoa1omD lueolt trto(r3iu1llen nvsls) 2tmx p;o1altniiciadlsDra(ms;() eeomf3totomteau o ( sexmim3nu1alee nes ()arur(ront0aetniociatlaDrl( pn() rxoifciadoateanvol(0t2toxrpoy1ll   iei t) ruaxrpou1texnmoctat m ulnmsn()trtrio to1fa eau s (0srtrio3iu1llte fctl(fsDtmumo;t4tpenio3iltfaDelnms t0alxnir iydlpteaneo t) rtrxo3nodlpee fcils arta(rpnt1texoii3iltla emn s t4texoirctadom rau s (0s2xm(mpnydll nlnvsa(  Durxmo;o1tptnmociatlaDuanmsnu4 rtrxf3iatlat  n ilt0 rurxopny1open fcsatf 2ta(rp;o4olxnmociltfa2ran p u4aetnmfcty1fmDeanvs t  2um(opnodlme  fcia( sDurx  nt1aleo i3iytla ea(von()aleomf oodlptrln s ( texrxr3nu4amtnmfesl( s2raum nt1opto ictltfa uluvp;u4teeoxf3tydfa e uvo;t)trtm(m3iu1lmt lnetlt) Dtmx  ot1oltn ictlslm2rmu s;t4 rtnxfcoatoaD  u slt)trxoxr oydop   nct s)a2urx pou0aexo f3ils a umn s;(4tetrxocoodfmt  i slt trtrir iudlpe lies ()aDrr(mpno0olxomoeildla emn s t4 rtrxr3oo1fpDraies;() rxr(o oydam n nesatf 2trx pnt1ope iietlt s elu p;u0tlxoxr tadfpt luei t0t2xrxmpny4ole mivtlt)aDurump;t4apxnifeildfsDel(mp;u0trxomf3ty1fpt ai ils sruoxrpiodamte nct s sDrr( pno4aleo fcildlmDeanvp u4 eerxfciatla  li i t texoxmpnodlmtnlnctl( a2trur no1tlenmieiltla2rl(vo;t0tlxoxr3oa1lp   nvs t0 2tmim3nudlmeemiet s  Drrxm no1oex  i3iatlmDrauvonu0 etomocoa1lp   u i;s srtmxr oudoptnmivtat a2ua(m ;o1aetnmi3tasla2rmumo (0tlenmr3iotfa elnvs s srtr(rpnu4lptnmnvs sfa2ta( pno0apxn ociyd m2ea(vpnt) etoxr3ia1lmD  n o t0trxr(r3nudlptnmncsls) Drmxmp;u4opx if3tyt a um(mon(0 leoxr io1opDeaueolt)sexmxm nudop nlneslt a2rmumpot4tlxomoetydfs rau o t0 etnmf ty1fmt lies t  ruo(mpoy1amen fcsl()a2tr( ooo4tlxomi3ilt aDul(vpn(0arerir3ia1oaDe n sls)teumirpny1llte ivsls  2ua( pnt0ale iociys aDrm(mp u4trtoxf3totfate neol(0trxoxmpnodameemfcsatf Dururo;t1aeenii3taslm2ea( snu4aexomr todlat aues;t) 2trxo3iy4lp nmfvil(f 2trx oou4opto fciysfsDeanvp;()artrxo to1lp e uei s0 rxrxr no4omeemfes s)srra( o;t4tpeoif3tys a emnms u4 ltrmo3ta1lm  anvils)teumxo iudlmtn ivtlt  2rmxmont0teenifeiatfs rm(vpnu4 lxrmr iotoa  lu s t)setoxopno1olteliesa(  Draxmpoo0oeeoiieiyt sDemu sn(0altnmr oy1oa ranvolt)seuoxr3oudomtnlfcta( sDta(ront1aex ioeilt a ulnmo;t)aleoxf oadomDe ueo s)s2tmir3oo1aptn ncsas)aDrm(mooo4oee mo3tatla umums t4aetnif3iatfa elneilt0s2xmxrpoodlpenlfcsl() 2rmu  ot4tleo i3tysfm2uanmo t) exoirciotoptrauvo t srxm(rpno1apt micsa(f Dtm(r nu4oex miciat s umumpnt)artoxrctytlpD  ivil() eur(r ny1lp elivia()artrxmo;o0apto fcilslm rl(mp t4 lenir3iydfp  lieo;t teumir ou4llee ivsls) 2tau o;t0ale  f3ilsfm rl(vsnt)alxrirciydoat  i s;s trtoimpiy4lpt mfvtlt)srur(m oo4oeen fciysla2rlumo;t0 ltomr oa1fpt aivs;(0 2tm(opou1lmeemnvsls) rrmxmo;t1tpeo feiatlaDrmn ont0 etnmo iatlpt aiei;t)texrxr oy4op e ivi sf 2ua( ono4oex moeias a ulnvsn(0 ltrmfctydfmDrai ols)trto(m3nudlmt  nvtat) rum( p;o1teenifciytlm2rm(vpnu)arxrxf io1optrauvs;()tetoxm3iy4amt mncslt)sDtr(rp;t0alxnmf3ils aDuan sn(4aeeoif3tatop  au s;s) 2xrxr3iy1oltemieia( s2uaump;o4oet ioctytfs rln pnu0areomf3oy1optrlues s0 etrir3iy1amenlfctl(  2ua(  ;u1ole if3tydfsDrlu o u) eeniocoadfatr nvslt)s2tmiopnydaptnlictlsfaDua(mp;u0opto icilsls ua(ms t4tltoxr3oadla eluvo s)sexm(rpiy1openliei (f 2tm( ont4alxomiciaslmDrluvsnu0 ltrxo tatomDeln o;t)setmimpny4lmeelieil() Dra(rpot1opt ifeilt m2ra( pn(4arxrmr3totlmtraneols)srtoim nu4amte ivtatfsrtrxm ;o1tetoio3ilsfm ra(vpnt)tlxrmr3ootoptrln s s0s2to(m3oo1lmen fetlt s2trumpnu0alto f3tldfs rl( s (0 renir3iatlmteli s t) 2trim3nu4lp  lnvt (fsrurumpnu0altnmf3iltfmDumn on(4aetoiocio1lm elnes;s0t2xmio3iu1lpee ieils aDrrxront0aleoii3iltlm2rluvo;u4teermrcia1oaD  nvilt t2xoiopny4opt mnvi (farurxm ou1tpxo ociytla2um(vp t)alxrir3ta1oa   n o;s)teur(o3io4lp nmnesltfarrrurpou1tptoii3ild sDelnmsnt)tltomo iotlpD  i i (0 eurim oudlm emies tf rtmurpoo4tlx if3iydlsDelnvs;t4altoxr3iadomtrlneols0srtmio iudom  lncs t aDum(rooo1opxn fctas m rmn s t) rtrir oodfpD ai o;t0 2xr(r oydamt mietas)s2ur( pno4apxnmi3ils m2umnmp ()alenxfctydfmD aues t) exmimpiu1omtnmfvsl()sDta(root1alxo o3iydla2rmnmo;u4 lerxrciatoptelu s s)teuoimpnu1oltelfetlsfsrrmur nu4apxnmo3iysfs2rm(mp;(4 exoir iadfmD aieslt)trtriopiu1lpt  nvsl( srtr( ont0altnioeiadfs rl(vsnt0 lenxr3tadfat luvil()tetoim io4ameemivs () 2rmumooo0alto ociysfsDem( on(4aexrmrciadoa rai o;s0 2xmiopou1amtemnei sfarum(rpou4oeto ieiysla um(mp;u4trerxr iodlmDelueo;t)setrio iu1lltelnvi s)s2trur ot0opxoioctltls ean on(4treoir3iy1fa e u o t) rtrim nudomtnlfeiat  2tauro;t0optomi3iadlsDumnmsnu0arenxoctadoaD  ivi;t0 2xo(opoy1oleemfvil( arrax o;o1teen fciadfm rl(ms;(4 eerir iy1lm eanvs;( s2to(opoydoptn ncsl() rra(mp;t4oltoio3tadla2ul(vont) lxnxr ta1oaDeli i;t s2xmimpoo1ap nlivsl(  2tru onu0opxnmf3iadla eaumon(4tlerir3tytfpte ivo (0 ruo(r iudap n fei s)a2rr(rono4tpen f3ias s2ra(msnu4alenmr3ia1fmDr nvs;()trxrxopoy1ap nmfeiat)arumu ont4oeeo fciatlmDrluvp;t4 exnxf todfmD lueo t setoimpnodlltelfcsatf 2ur(m ;t1oeeo octysls2rmu o u0aeeomf3totfpt aivi s0 exo(opnodap   nesls)aDuaxroou1olenmieilsfsDrmnmonu4trtrxfcootla eaivi (  eurxo3nu4omt lietltf 2umurpnt4alx iictytfm2ulnmp;t4tlxnmo3oodlaDrai s;t0trtm(o3iu4omt lnvt t)a2rmumpot4apt io3tat mDraumpn(0aeeoif3iytla eaivi;s  2to(mpno1olenlics (fartau oot1apx mocias sDel( sn(0teerio3oatlaDeai ilt texoxrpou4oltn fesat)arrru  no0alxomf3tas s2eln ont)aexnmf iodom rlneil(0texmxm3no1lpt  ncs tf Drmumpnu0tex if3iyt m2em(vp;t4arxrxf tatomtr n o (  rxrxo ny1ame  iesa(f rta(mpnu4teen i3ilsfm el(vp u4arxoxfcia1lptran i;s  euoxm3oydap elfvt s)a2uax pou4ope moetatfa ean s t4tltrmo3ootoaDrauvol()teuoimpoydameelicsatf 2ua(ront4opxnmoeilslmDeluvo u4trtnmf3oydoaD  ivi;()teumio3iu4ol emfet tfaruaumpoo0ale ioeiadfm ean sn(4aexrxr3ta1oa  au s t trumim3iudlleemnvi ( s2rr(  ;o0aee  ictytfmDrl(mo;t4 eeoioctytlm elivs t)truoxm iu4al n iviltfartax oot4tpxniociltfm emuvonu4arxrir3tytomDrluvo;(0 rxo(m3ny4olee fesa( artau o;u1aeen i3iltfmDua( o u)aleniocoo1oa  ln o t teumxo3nudopt livia( s2umx  oo1oee mfciad aDua( snu4tltoifctadomtr uei;(0srum(o oy4ol emncslt)aDrm(rpnu0opt mictld s2ra(vs t4arenmocto1lmDraues t)texr(r ou1am emiciatf 2uax o;o4texn ieiydlm2uau ont)alxoxf3todlptrauvols0s2xr(mpiy1opte ivtlt aDtmxrpnt4tpt  fciaslsDelu p;u0trxoif ia1faDr n s t)sexmim nydol  mfct sfsrur(rono0aexo f3iat m2umu s;t4trtrircoodlaDeau ols0s2urimpoy1optnlnciltf rurxrpoo1oetomoeils m2rlnmo (0 lxoir ta1fmDrlnes;(0t2xmir3oodopt  icsl(f 2rau o;u4apt mictldfs2elumo u0 rtnxr iy1fp eanei () exr(r3ou1lmtn nctlt)sDuaumpou4tptoifctydls2rau o u0 etomfcoo1oatrlues t)seurim iydopee fcsas s2rrxmonu1aet  oetys a2em(ms;t4arenmr3to1oa  au i;(0setoir nudlleelfesl( s2rau pou1tlenmfcilsfs rluvon() exrxrctatomDr ivo (0truoxmpou4ap nmiciat) Dtr(  oo4teenmfciysls2rmnmp;t)altnxr io1opDr n i t0t2um(m iy4al elfvsa() 2rmurpot0tptomoeilsfsDem( sn()trxomr3tytomDelneo;s)srxrimpny1oltnmncs t)sDtaxro;u4ope  oeiadfs2rmu p (0 ltrmo oodoa eluvi s)tetoxrpoy1om n ncia() 2tm(rpoo4apxo ictatfsDulump;t) lenmo3oydfmD lnvo;()srur(rpno1ol elnvilsfaDuaurp;u4alx mociysls rmuvo (0altnmr todoatr nvolt)s2trir3no1oleelncs ()s2ururo;u0opxomfeiasfaDranvsn(0artoxo tydlpteli ol( srtoxm3iodapen nesa( srrru pot4ape ioeiysfa rmums u0tetnmo3todopDe nei;s) 2xmxr nydam elivsa() Dtr(r ;t0oee moctadlm2uanmp u0 eeoxociy1fa  lu i s0 2trxr3nu1lmeelnvsls)a2um( pnt0tpx moetysfmDea(vp;t) ltrmoctotfpteluvi;t) etrxmpio4ll emicta()a2trxrpou4ope mi3ildlsDelu on() exnmocia1lmDe neilt0t2xmxr3iy4ol nlictls) 2raump;u0aetn i3tlt aDumnms u)alxoif3oodfat auvo t)teurxmpno4alee fcia() 2raxm ;t4tlt  feiysla eln p u0texomo3oy1op elu s;t)t2uoxo iy4op e nvia(f Draxronu1oeen o3iadlaDelnmpnt4 eerir oo1lmDr nvo (0sexrxm oy1omeemfci s) Drrurpno4tpe iociydfmDrmuvo u0arxrir3oy1optelnvs;t teuo(m iu1omenmnctlt sDua(m no1olxnioeilsls2rauvonu0tlxoif3iy1fm r ieilt0 etrir iu4om  lneslt)aDraxm ;o4aetoioetys a ra(von(0alermf3totopD lies;(  2ur(opio4omt  nvia()a2rmxmo;u0tetniieild m emuvonu0texnxfciy1faD anvolt0t2uoim3nydlm elnetltf rtm(ro;t1tlxomfciltla uauvp u4arerioctotfp  auvi s)teurxrpiydamtnmfeia() 2rau o;u0oetnioeilslm eanmp;(4alerxfcto1fp  anvil( t2xmxo nu4omt  iesat  rumxroot4tet iiciadls2ean s u4tlxrmf3iotlateanvo s) rumxr iu1ll n ivsl(farurxrpnt1ope ioeiltfs em(vsnu)artoifctadfm   nvi t)sexr(r3oudllt livsat  Dtm(r nt0opeo f3iat s rmnvo (4 rtrxfciydlaD luesl(  2xo(mpiu4omeemiciasfsrtrumpnu4altnmf3ilslm rauvp u)tltniocoa1fatraueo;t s2uoim3iydopte netas sDrrx oot4apxnmfctldlm uluvonu) leomr oatop rlivo;s)teurir oudol   icias)arua(ro;o4ale ifciytlsDemump (0artrxo3oadlaDr ueols trxr(m3oo4aptn nes sf Dtmxmpou4aexn i3tltfs rluvp;(0arerxocoa1omDrau s;t) ruoio3iudlme licil() rtru pot4olen ieiytlm ua( o t4tleoio3to1optr iei;s srto(r3oo1lm  liviasfsDrr(  oo0apeoifeilt mDrm(ms u)altoxo tatlmt lieslt t2xmxm3iu4lm  lnes tfsDraumpou4tee  ieiadlmDelnvsnu0tlxnmo oy1faDrlueilt0teto(m iu1am n icia()srumu  ou0oee moeiaslmDumuvon()trxrxr3iytla  luvi;(0teumim3nudllte net () Dumuronu4olx  feiadls ua(vo;u4 ltrmo3ootlmtelu ols  euriopio4am   ivi s  2ta(m ;t0apt mfciatfs emumpnt0tlxnxo ia1oat  ies;t0 2umxr3nudlmte ivslt)arra( o;u4aeto feiadfaDelnvs;(0aetomf tatfa ean i ( srurxm3io1am  mnvt s  Drmum no1apenmiciasla rln o;u)artnxr3iy1lmD anvi t  2toiopoodlp  lietls) rua(rp;t1alen o3tadla elu s u)trerxr3oa1op elneo s0 eum(o ou1al nlfcsas)s2tau pou0tleomfctytlaDrlnvp;u4arxoxo3iodlmtr uei t  2xm(r3nu4lm emfctl()arumx pou1tetn ictadlm2rmump;u4arxnxo iydlat  ivs;s srxm(m ny4lleelfcsltfsruru  oo0opx  ietas a umnvs;(4teerir3oy1om elivs ( srxo(m3nudll n nci s)sDrrxrp;u0ole iieiysfa uanmo (4teerxf oo1omDr ueolt0 2xr(r io4llen icias  rumu  ;t0tltoio3tldfs2ulu p t) exnxf3oadopt  ues;s0t2xrim ny4lm elfei (  Dra(mo;t0aptoiictytls2rmumo;(0tlxnmo iodfa e nesls) etoxr3iy1omtn nvtat  2rau p;t1aex mo3iydla2ul(vo t0teenio3tatfpDeai i;t0 rxmxm3iu1ll nmnvia(fs2rrxr ;u4olxnioeiydla2rlums t4aeerxrciodlatraueols srxoxo no4om nmfet s sDum(rpnt1opeo iciatfm emuvs;t0 renxocoadfmDran sl(0 eum(o oy1opte nesl()arua(monu4tle ioetytfaDuln o u4 rxrir3oadfat aueols sruoimpou1ome lictat)a2ur(m ;o4ape io3ilsfmDem(ms;u0arxoxrciy1faDeaiesl(0trtm(m3iu1ameemnvsl( aDrrx p;o1aetnioetad a emnvp (0 etnir3tytopD lnei;()trtrir3oo1alee nvsa( sDuru  ;t0alen ictls a2ulu s t) rxrxo iatopteli ol()s2urxm iu1op elfct tf rumuronu4aetnmictyd a rm(mo t4alermoctatfateluvolt  2xm(mpoy1oltnlnes (fsrtmum nt4opx  f3ias s umnmon() eenmr iytlaDelivi;(0trxoiopnu1omtemfeslt)a2rr(mp;o0oet mo3tytfm2emn p;(0tleoif3oa1fmDelnvs (0t2xrim no4ll emfct ( srrmx pnt1apen f3iys s2eanmp (4trtnxr3io1fmt  nvi (0s2toio oo1oltn neiat)aDua(moou1tlx  f3iad mDrm(vo;u0tleomoctydoatelu s s0 2tr(m io4ome  ieilsf rum( ont1opxnmociasls umnmpnt)artriociodlm elneolt  euo(r oy1apeeliciat sDua(mpou0aleomi3tytlaDrmump;(4areoxo3tatlaDeanvilt0s2urxmpiudom nmnvs s  Dtax  ;t4aexo oeilsfmDrauvpnu)arxnxo3iodop  lnei t teto(rpno4lp n nct s sDurur no1aeen ieiytfaDran s (4 rxrir iydlat  n olt  ruoxm3io4omtelfetat aDtrx  nt1oet mfciyslaDem(vo t0 exnirctadlatrln ol( t2umxo ou1ll nmfctasfsrrm(rpoo0aexoiieilsfm2ua(vo t)teermfciodoat  n o;s) 2ur(mpoy1lmtelfciltf rta( pno4alxoifeild m ranvp;t0aleoio3ootoat li ol()sruoiopoo4apeeliciltfsDrmxmoou1apxnmo3tls s rmn s u) rerxfcoatfmDrli i;()s2urio no1llee ietat)a2rax ont0alxoii3iadls2rmnms;u)artnxf3todlpD  uvs (0 exrxo oudalen ivi () 2trxr no1aet ii3iys sDua(vp u)aexnifciytlmD  ueslt0srtrxo iodomt  ncslt arra( pnu4tlxo i3iyslm2rmnmo;t4aetrmrcoa1omte i ils)sexrxr3no4amenlnci s a2trumpno0oetniiciatfsDraumo u) rtnioctadfmt auvs s0 2xmxr3ny4llenmivi ()sDrmur oo0ape  ociasfs ua(mpn(0 lxnxf oy1lmtraiei t0 2uoirpiu1lp e icias)sDra(mont0opxnio3iad s ranvpn()artnifcia1laDr u i;t) exo(r3nudlmtn ictls sruax pot1aetomoetytlmDul( o;u)arxomf3io1oatelneo s0 exrxr io1lmt lfcilsfartax  ;u1tleoioetltfaDul( p;(0altoir3oy1lmDe i o;(0trtm(r no1lpt  netat s2ua(r ;o0opxomi3tadfa ulumpn(0aetrxrciy1fm  auvolt)seuoxm no1altnlictltf 2tmump;u4alenmfciyd m2rmn s t0 ltoxr iy1fptean i t)s2tm(opiy1omee ncias) rtr( ono1tet ii3iys s2umuvon(0aeeoxocoytfpD livi (0seumxo ou1oltelfctltfaruaxmp;o4aeen o3iyt m2ea(mo;u)tltoxr oatoat aneolt) 2tr(r no1openlfesa(f Dtm( p;u4tlen iciyd mDrl(vp u)alenif3oo1fp e uvsl()texrio3oy4ll nlicil()a2tmu ono0alt  octasfm ea(vp t4areoir iy1fptrlu o;(0texmirpiudlp nlietlsfa2uaurp;u1oetnif3iat mDel( sn(0arxrmf3tatfa r ieols  rtoxr3io1om  micsat)s2rmx oou1olxo ictatls em( on(4trtnircoytomDrluvi;t)trxm(opiu4lp emivtls)s2rmurpnu1altomiciysls2uln snt4aetrmf3oa1oa   iei (0 exrxo oy4opee fes t)s2rrumpoo4aptn feiasfmDraump;u)tltrio todlpD  uvi;(  etrim3ou4aptnmfcs (  2um(  ou4aetnio3iat m ulnms;() rxnmo3iotom   uvol()texoiopno4apte ncils)srrmumpnu1oetoifctydfs rmnvo t)treomrcia1lpt lnvo t  rxmimpnu1lme lfctasf Duaum ;o4alxnmfctysfm um(vo;t0alxoif ta1la raues (0s2xrxr3iydalte fcta(fs2rmur ou4tpxn fcilt mDum( onu) rtnmrcoo1omtelivs t0trtm(o oy1amt mnct s srrrx  ot0teeomictls m ea( p u4tltrxfcoy1latr n o ()s2tr(o3oy1lpt lfei sf rtmxmono0aeeniiciytlsDrauvpn(4 rerir3tatfatrlueil( s2trxr3ou4lmenmfvsa(fsrtm(mpou0olxoif3tyt aDeluvo;t) etoifciodoate uvi;s)texoir3io4open nvils  rrr(monu0oeenio3tysfs rm(vs u4trxrxfciydoate neo;t0s2tmim oo4lle  ivi sf 2rmxront1texomfetys a emumon(4trxnxo3iodlaDe i o t srumirpny1om nmiviasfsDumuronu4tltomfctldfm emnvp;u4aetomr oytfmDe i s;t  eum(r nu4oltn iesa() Draxr ;u0apeomfcildfm2rlu o;t4tltrxr3ta1fpDeaueo t  rtmir3iy4am nmfvils)a2rax oot0ape ifetlsfm2rl( sn(4arerxo oatlp eaivs (0 etr(m3iy4olte ncsls) ruauronu1oex ioetadla2uauvpnt) lxrifcoo1fat  n i;s  rxrxopno4alt mnviasfs2tmxr nu0tltoio3iltlmDeau on()aetoxf iadlmte neol(  rxoio oo4lpeelfesat a2rmu pno1tetnmoeiatfm emnvon(0 exnmo ta1om r u slt0 2tm(m oo4ol n icias)aDrau pou1altnmiciytls rmumsnu4 ltrxo to1faD aueslt0seum(mpny1apen nvta( aDta( o;t1apenifciytfm ulnvp u) ltoifciadlmDe u o s)srxrxr3oo4lm emfci tfsDtauronu0olen icilt s ul(vs;u0arerxfctydoa  livs;(  etr(r nudoltelneilt)arrm(ront0aee ii3ild s2rluvs;(4texrmfcia1fpt auvs ()setoim io4lm nlictls arrm(m ot1tlxoiocild a2eluvonu4alermr3oydfaDeaiei s)s2trimpny4amte fvtlsfsrtru ono0optomf3iysls2em( o;u0trtrio totfmDr neols0t2umxopnu4llenlicsatfa2rm(  ;t1altnmf3tyslm2um(vpnu) rtnir3todfp   nvo s srxmxo3oy1am nlncil( artrur no4oleo o3ilt mDumnmo t4tetnxf to1oatean i;t  rxoim3nydomeemici ()a2ra(m oo1tptomfetydfm2umu pn(0 ltoxo ta1om eau o;s)trtmimpoodlp nlicias)a2ur(mont0apxnmfcildla2uau o u) lermrcoy1optelnvols0 2xmio nodam e fcsl()srtmx poo4olxn ieildla2rl(mon()altoxo3oatlateau slt  2xmiopno1op elfci t)aDur(rp;u0opx mfciytfsDrm(msnu)aexoxf oodlptrai ols)sexrir nu4om n nesat aDrr(  ot4oeenmictyt m rl(ms (4tetnmrcia1fpDelu sls) rurxo iydamt lfei s)s2tmu  ot0alxoifeilt sDea( s;(4aexrif3iotoat  uvslt trtrimpiydom elnvsa(f 2rrx  nu4teeoif3tys sDemnmo t)tleoxf3ootfpt anvs;( trur(r iy1oleelfcia( srrmu pnu4ale mietas a2ra(mpnt)alenifctytfat aueo s teum(opiy4omenlnci ( sDrmxmooo1apxoiictytlm em(vo t0aetnmo tatla e uvo;t  rurxm iy4omtnmfvsl() 2tm(r ou4tpeoiieildla2emn snt0trtoxr3tytlmt  ies;s)t2trio3oo4lm e iei tfaDrrur ;u0oexoiieiltlm uanvp u4arxoxf iadfp eaueols t2toxr nudlmee ncsasfaDrrx oot4aexnifetad s2ulnmon(0tetnxo3to1lmteauei;(0 exrio nudaptn ies ( sDrm(mo;u0tpx iiciys m rlu p;u)trtnif ty1fatrlu i;t0t2urxo3iy1ll  mnct s s2ra( ono1ope ii3ild s rlnmp;u0 ltnirciytop  livslt0srxrimpiydale  fvsl(  rrmx  ot1tpt moeias sDul( pnu0 ltrmf oa1fa rai o (0 eumxr3iy4ape  ivi () rta( o;o1tet  f3iyd m elums;(4altnif3ootopt  ivo;(0 2xmxm3iy1al   nciatf rtm(mo;o1opt  feilt a eau p;(4 rtoxfciatomtr uvi;t  rxmxr3nydal   nvi tfarumx o;u1tpt  i3iys a eanmpnu4aexrmo3iadom e i o s)teumimpno1lpt lfes t  2taxrpot4texnmiciasla el( ont4altniocto1op e n i ()texoxr3ou4lp  mfcsl(f Durxrpoo1aeenifctldlm ul(mont)trerxrcty1oa  livs t)s2tm(rpno4am   feilsfarurxm ;u4olxnmicils aDem(vo (4tlenirctotla r ivo t)tetr(o3ny1omt mnvi tfaruaurooo4apx if3tytfmDuau o u0trtoio ia1omDeaivi t sexrim3oy1lmeemivtas)srrrxr oo4aeto ictyt m2umnms u) etnif3oa1faD luvols)t2uoxrpiydam   nvs s) Dtru  ;u4oetnifctytls2em( snt4 etrxo to1oaDr uvsls0 ruoirpiydoptelfcia(f Drmx onu1opt mi3tyslm ul( o;u0aetrir ootfa e uvols)t2umio3nudomt  ivsas  Drax pnt0opxnmf3tltlm ulumont4 etrif tadop r uvils seto(m3ny1lle  nvsl(farum(mo;o4teenif3tlt mDua( p;u0tlxoxr oo1fa  li s t teurir3oudlptn ivt ()sDumu  nu0aptnifeiyd mDeaums;u4 ltrmr3iydlaDe n o t0setr(r nodamenmivtasfs2tr(rp;t0open fetytlmDeauvsnu4tlxrxo to1lmtelnvs s  etoxrpiy1omtemfes tfs2tr(r oo4oexnmi3ild a2rmnmo;(4aetrmr oy1la ran o s0s2tm(mpoy1al nlfvias s2ua(m no1olx  feiydfmDea( s t4aetnxrciotoaDe iei ( texoimpnu1lltelnctas srrmur no1oeeomfeiadlmDrlu p;u)texrmo3ty1fpD auvo;( trtriopnodaltnmnvt t aDraumpot4aee mo3iasfa2ulump u)tetoxo ia1opDeau i;(  exo(rpio4omen icias  Drrum nt1tltoii3ilslm eanvsnt4 lenmr tydopDe ieols t2xrio oy4openmivtlt  2ur(rpot1tpxn f3ias mDuanmp;u)texnmr iadfmDeaieils)s2urir oo4ap nlfes t) 2ta(root1oetn ieiyslsDuaumont)altnir3oadfaDrlieo t)t2umxrpoy4lltnlfesat sDtaum ot0oexomfeiltlm rmnvs (4aleomf io1fmtrauei;s)truoio iu1om  livs ()a2rmx pnu0teenioeildfa rln onu4 exnio to1lp r nes;t)srxoxo3iu4amenlnvt sfs2um(mpnu1tpxn ictadlsDeluvs (0aeenmrciotfpteaivolt texmio ou1lptnmnvia()arta( oot4tlen fetydfaDuauvo;t)arxoio3iydlmtran sl(0t2tmirpiu1ol emfeslt)aDrr(m ot1oltnmoetldlm ea(ms u) ltoxf3oa1lp  anei;( s2trirpnu4lptnlnvs t aDumxm ou4tpenifeiasfa2elumo u)arxrxo3ty1lptrlu ilt) 2tr(r iy1lpenmiviatfs2uaumpnt4oexo i3tas sDua( pnt)tetrif3oo1oaD auvs;s  euoir3iu4op  lnetatfartr(  ;t4texn o3iytla ea(mpnu4teenxf3iatomt  u o;()seuoxr3iydam   iviat s2umx  nu0oee  o3ildlsDemnvon() ltrir oa1oateanvol( srxrxm3nu1lmte icil(f rraxrooo4tptnio3iys s umuvsnu4alxrmr totlaDraivi s tetoxr nydam nlictltfartrxrpot1oltoio3tltlmDuanvp u4alxnio3oydlp ran o s)trto(m iodlpeemfcs sfarumuro;o4teeoifeiys m2el(mp (0trerio3iytfpD ln i;s t2uo(r iydlmtnlivilt sDrrxro;t0aetn fctatlm2rlnmp;(0 lxnxociatfatr ivolt0s2ur(m oodop nmncsas artm(m nu1texoiiciasfm rmnmp t)tlxnxf3ta1opt  u i;t seumxr iu1lmeemneiat) Dtaur ;o1tlenif3iatls emn o u0artoxr3oodfmtran ilt0tetr(o3iu4lm n icilsf 2tr(m ;t4oeeoio3iydfs2eau p;u)tlxomrctydomt luvo;t  2tmxopnu1llen ncil(fsrtrxmo;t4opxomo3iasfa uanvp (4treoxf3ty1omD  nei (0sruo(o3oo1lltemnvtatf 2rrumpou1tetnmf3iys sDeln on(4 rtrmf io1fatrli sl( texmxr3nu1olt lnct t aDumx oou0olt ifciatfs ua( p;t)artrir3ty1oa  ai o;( s2umim nu4op nmivslt) Durxr ;o0tex  o3iytfa2ul( snt)arxoxo3ootlptrln i s0s2tmxm iudom elncilsfaDtmx poo0alt mfeildfsDua(mpnu) exoiocia1fmDeaueolt0 2umim3nydal elnei s aDtmxmpot4opxo feiad aDelums u4artrirctadoptelivs t)s2xoio no4op nmicia( aDuaumono0oltomo3tytls ulumonu0tltomr3tydfmDeanvsl()t2xmxo oudope miet ()a2um(m ou1oex miciltlm2ua( o;t)texoxo iy1fmteai s;t teuoimpno4lp eliei tfsrtmumpoo1aetnmociadfs2ua(vo;t4artrif iadom e uvi ()s2trxr nydllt liei ( sDumx poo1tee mf3tysls2rl(vp u4 rtoxr3io1oateau o ( srtm(m oydam n nci tfsDta(moot4ape ii3ilt mDulumo;() lxrxf ia1opDrlneo (  exoxo iy4lp   fetls  Drau onu0apeo ietytfmDumn s (4tlxrmo todlpDrli olt) 2xo(opnydom   neiat)sDuaxm ot0aexniocildfs2elu snt4alermfcto1om raneilt0s2toxm3oydlmenlivt (  2ua(rpoo0tpeomi3ildla rl(mpn(4tlxnmf3oatoat  ieo (0t2tmxopou1ole  net () Dtr( o;o0tptnmf3iad s2rmn p (0 eeoxo ta1lmDran i;t0 rxr(mpoodop nlfeil( sDrmu o;u4ale  f3ils a2el( o;()aeeoifciytfmtrli s;t t2tmxm ou1olenmiesa()a2urx  nu0apto f3ildlm2eluvo t0alxnmfcia1omD aueols0s2xr(r iodlm emiesas)sDta(r ;o0aex ifctadfs2emnmo u0aetrir iodoa eanvi t) 2trxmpio4amtelnci sfs2ur( pno4tlt mo3ilsls eau p;t0tlxrxf tytfp raiei (0t2tr(r3ou4llt mnviltfaDtrur ot0aex ioeiad mDeaump;(0 lxoif totlatrlivs;s  2xrxr3ny1lm   net () rrmurp;u1alxoifeildlm2raumo;t0 ltnxfctotoa  lueo;(  rurir3iy4opeemfcia( s2tauronu1tetnmi3tat a2ea(vpn(4 rtomociadomteanvi t)t2uoxr iudapenlfeta()arrmxm ou0tpxnio3iad s2ua( onu4 eeoir ty1fm r ueilt0 rtmirpoudlmeemfvtls)aDurxrpnu0tet ifctlsfmDrmums (0trxoxo iodop eluvil() 2xr(mpoo4opt lncs sf 2rmumpot0tex moetlsfs2eanvpnt4 ltnir oodlp   uvolt  2xmxm iudol emietat  2rr(r ;t0teto oetltfs elnmp;u)tetnmf oydla eaieslt0 2ur(m ou4lm elnetat s2rm(mooo1tpx mi3tatls2uaumsn(0texoxocio1fa  lneo ()t2tmxm oydlpeelfvsat) Dumump;u1tetnmoetyt a2rl( pn(0tetniociy1lm r nvil(  rur(r oodame mneias)arrrumont1aetoiocilsfaDulumpn()trtomf totla r uvs ()setmiopnodlmenlivtlt arur(  nu0tlxomi3iydfaDrmumsnt4tltrxfcootom  aiei s)trxr(m3oy1om e fei ()sruaurp;t1tetoio3iad s2rlnmo (0tltrxf3oa1fp r nes ( s2trxr nydlmenlnvtl( aDum(mpnu1apxnmi3iatla2uan snu4trxoxrctotlm  ln ol(  ruo(m3ou4amt lict (f 2rrx  ;u0olxo i3ias s uanms u0artrxo3to1lpt  ieilt0s2xo(r iy4amt lnct ( artaxm oo0aetoifetlslm2rmn snu4 rtnif3tadlpt  i ol(0texmio io4altn nvtl(  2umxm no4tltn i3iysfs2rmnmsn(4aetriocoodlm  livil() 2uoim3no4al emivt sfa2rrxroot1tpxo ictadfm2rmnvonu) lerxrciatfm eaieslt)t2trim oy4lmtelnctl( sDraxmpou0tpen iciys m2rm(mpnt) ltrxrcoatfpteli i;( t2urxo3nodome  feiat)s2umumo;u0tet mfetas mDemnvsnt)alxnirctotoptrai s (  2uoxr nydop   feiltfsrrrx o;o1tee ioctas a2rl(msnu0tltrxo tatom r nvo;s0 2toim iydameelieta(f Dum(  oo1apto feild s2emumo (4 rtrxo oydfm  ln o t) etoir iodlp nmfvtatfs2raxm no4tlxnmi3ilsfa ra(mo;(4tlenmo3iadlmtrln i;()seum(opnudaptn nciasfaDum( o;t1tpenmf3iydlsDrauvsn()teenxo oydopt ai o ()tetm(r3io1al  lictasfa2uaxrono1alxnmoctatfsDumumsn(4treoxociatlm   nes s t2urxr3oudop  mfcsa()srrmumonu1oeeoioeildlm2ua(mo;(4arermfcoodlaD  u slt t2trxmpoo1opt lfctls)aDtr(mp;u1tpt io3iysfsDea( snt0 ltrmf oy1omtrai ilt)srto(opoo4lmtelnctl(  2rm( ont1aetniictatfmDrm(ms;(0 rxnmr3iotlmDe n s;(0t2ur(m3ny4apenmiesa(farum( oot1oeeomfeiasfsDea(vp;u0areoxocio1la eau s (0s2urirpiy1ll nmnvtl()srua(mpot1tetnmociadfaDum( s;t4tlenmf3ta1fat ln o (0sexrxr iodolenlieia(f 2tmxrpnu4alxnii3tlt aDul(vs t4texnmf iotoate iei s s2xo(o oodamt mnvias) rum( pot4opxo f3tld a rm(vpn(4arxrxf3tadom rai o s  2xrxm ou1ol e fetat)a2rmxmo;u1tle mfctat s eanvs;t4 eenircoo1lpDr uesls)srtoxm nu4olte fet ( aDurxmont1tpe  octys aDelums;(0teeoio3oy1fatelivo s sexoiopnodameelnvsl( s2raxmp;u4opxoiietyt sDemu o (0aeerir3oa1oa r nvols0 eto(r3no1apee ncsas)sDtmur ;t4olxo feiasfs2eau snt)artrmfciotlatr ues t trxoxopoy4lpeemnciat)s2um( o;u1tptoii3iyd aDemnvp;t0 ltoxrcoy1lmDrlueilt t2umxmpnu4omeemfes t  2taxronu4alx mictlslm2rln s ()tlerifcia1oateai s ( t2ur(mpnu1ll n ies sf rumxmpnt1apx miciytfa2rmnmont) eenmrcoy1fa rai s s)seuo(opnydlp  mfvsat)sDuaump;t0tee mictyt a eanvo;t0 exrif to1fpt lneslt0 2xoxr3oy4apeemfctls  rtmum ot0opxnmfeils a2eauvp;(0 exnmoctytomDranei;s  2um(r3iudope lnvsl()sruru pot0aet mf3tls s emn p u) lxoxf tatfatr n i (0 rtmio oy1oleelfvils)a2uaxmp;t0texoifcilsfa rm(mpn(4arxomf iatla rlivi (0teurirpny1lmenlnetasfa2umxmpot0ape  oeiadfs2umnms;u0altnmf oa1la  luvslt  rur(m3oudop elnvs s)arururono0oltnio3iytfm uau o u0aetoir3iotfm  lieslt srxoxrpou1lpeelivil( aDurx  ot1aetn ociltls emnmon(0tltoioctotopte ueolt srtm(mpiu1lp nmfeiasfa2ta( pno1aeeomietls m ra(mont0 rtoxr3iytoptrauvi (0t2xrxm3iy1lp nlnetatfsDtrxmoou4tle iiciyd aDelnms t) lxrmociydfm  liesl( t2xoxopiy1ape  fvi ()a2umu onu1olxn o3iltlmDrm( s;t4tlxnmf ootlaDrln sl() 2umxmpou1amte iet sf 2rr(root0alt  ictls a2eanvs;u4treoxo oatfm  luvi;s)s2tm(o3oudol elivtl( a2taum ou1apxn fetytfsDemnmp ()arxoxfctadla eaues ()t2xmxmpiu1aptn nesls arurxmp;o1alxnio3iadla2um(vp;(4alermo3oadfat  nvo;( texr(opno4am e ictlt) rum( o;o0tlx  ociltfm ranmo u)tlenir ta1optr nvo s0s2xrim iy4ll n ieiasfsDtaxrp;t1tltniociadfs ua(mon()altomf oatfaDeln o (  eumxmpoo1lmtemfvtat)srtaur ou0aptnmfeiadfaDelums;u0tltoxocoydfaD luvo s)teum(opnodlp nmfvsa()s2trumooo4apx ifciydfs2uau ont)tlxnmrciotlmDrlues t) rxrxr3iy4ape mivta(f rtau pno4ole if3tadlmDrlnvonu0texrxo ty1oa   neo (0 rum(rpio1op   ncs sfsrurxrpot0oet  oetlslmDra(vp u) rtnxr totlaD aieslt)sexoim3oo1ap emnvsltfsrur(  ot0oex mi3iytfs ua(vs (4arermr oodfmtrau o;(0srtriopnu4apee ics t)s2tmu ooo1alen o3tldlm ran on(4 lxrmr3tadomDrlueilt s2xmim3oodlmtemncslt  2tmxr nu1alt  ociydfa2uanmsnu4tlenmo3iytomt lueols0t2xoim3ou1lme licia(  Dur(ro;o1tlenio3iysfs2em(vs u4trerio3iotopteauei;(0 rtrio nodol e icslsf rua(  nt1aee mfctad sDulu pn(4aetnxf tatomDeanvol(0truoimpny4omt livtls aDrmu o;t1oetoiociltfm2emuvsnu)aeeomrcoydfate iei (0teur(mpoo4lltnmfcia()srtaurpno0tptoii3iydlsDeanmo;(4tltomfciy1oa elnvi ( srtrxm3oydam n fcsatfs2taxmonu0oeeomi3iydfmDuluvonu4 eermf tydfa elneslt)texmxr iy4amt lfct tfsDra(m ou0tltnif3iysfmDea(vo t4 rtnir oa1op r ivo ()s2toxr io1ole lfvt t)arrrur oo1teeoii3ias a2elnvs;t4arxnmr3iytomteluei t0tetrxr oodom emict t) rtr( oot1aleomieilsfa2elnvont)tlxrio3todomDeauvo t0 exrxmpny1ol   ics ()a2rmu oou4oltn o3tltlaDeanms t4tlxnmo3ty1oa eli s;s) rtrxopio1op elfcil(  Drmxmo;u0olx mieiytfmDrau pnt0trtnmfcia1la e uvi s s2xrxrpnudlpe  ivs
\ No newline at end of file
@@ -0,0 +1 @@
+u sls0s2uoir3io4lm nmneils) 2um(r ou1opx ioeilsfaDeau o;u4arenxfcoo1laD liei s tetmiopnodlptnlfvsl()sDrrxmpnu0aptomi3tadlm rl( p u)tlxoif io1omteanvs;t setm(o3iu1olenlici t arumu oot0apt mfeiys aDuanvp;t4aexnxfcoa1fm   ueo t  rumimpoydlpee fvi (f rrau  ou0tpenio3tlt s2um(ms t) ltrxfcoy1omDe nvs;() 2toio3ny4opt mics t  2uax  ;o4aet  fetlt s2rmnvonu4aexniocoa1fa e uvolt)texr(o3ny4ap elnes s  Dtrxr nu0olx io3iyt a ulu ont0 exomf oytlm   ivi t)s2xo(o3no1apt  ivt tf 2um(  nu0tex  ieiytlm rmnvs u4 exrir iotla  lnvo (0 rumir3iy4ap   feta() 2umx  nu4oleomoctls m ean o (4teerir tytlmte n sl() 2xo(r3iu1lptnlnvil( a2uaxr ;o1alx mf3iasfs2umuvsnu0aeenxf3oatomt au o;t) exoxo3oo4ame lietls sDtm(moot4oeto oetldfs rlnmo (0 renifciadlm r i ilt0teuoiopny4ome lnctltfarrmxmpno1oet iietas s2rmnmpnt)texrmrcoatomt ln ol()sexrxmpoy1lmenmnctatfa2urx o;o0oeen ieiyd a2rlnmp u) exrmfcio1fm eaueol( s2uoim nodlmenlnctasfs2tm( onu1altoii3tatfa uln ont4 rxoio ta1lmDrauvilt0 2uoxrpiodaltelnesl( sDrrxr ou1oltomfetyt sDuanvo t4 eenxocoy1fm rlu ol()tetmir3iydape  ncia( srta(rpot0opxoifctat mDuauvo t)texriociatlmDraueo s teur(o ny4lmtemfct tfsDrrur ot4aeen ietlt s uan s;u)trtomf to1fpt liei s)t2umxo3iu4alee ncta()srtru pno1apeoiieiydfs em(vs (4aeeoir iatopDr ieo ( s2xriopiy1ap elncs () 2ua(r ;u1tlxo f3iys m2ulums;t4 rxnifctytfmDraueilt0 eumxr oodap   fvt (fartrx o;o1oet  i3iat m2rmnmo (0arxnxf3oydlmD  n o;s  rum(r3oo4al emnvtat) Drr( ooo1olen feildlm2elu snu4alxnmrciadfa ran s t t2xm(rpio1lpee fes t  rra(ro;t0olxomieildla eanms t)aexomf3tadlpD livol(0sexmxo3oo1aptelivt (  rtrur ;t0teto octldlm um(vp (4altoxocoadoaDeanvo t0 exmiopoydope lfesas)s2tau onu4apt moeiyd s2ul(msnu4 etnif3to1fptr i o;s) rtmir3oydopt lfei (  2raxr nt1teeo iciytfa2eluvo;t)texnmf3io1oatrln il(  rtoir nu4lptnlnvslsfaDtr(ro;o4oleoio3tytlmDean p;()alxrxo iytlaD anvi;()s2xmimpny1lptnmicsas a2raur ;t4tetoifciadls2umumo;t0altoir3tatfat ai sl()tetrxr3nodlpt lies t aDumu onu0olxoiieiyt s2umuvont) lxomfciadlmt aneilt) rtmir nu4optnlfetas s2uaur no4alt ioeiydfm rl( p;u)arxnifciotlaDr uei (0tetmirpoudamt livtl()aDrm( p;o0texo f3iltla rmn p;t0trtnio3iatlmDeau s;t  ruoir iu1lpe  fvil(fa2trxm ou4texoioetasfm rluvsn()texnxrcio1lp e ivs s trtr(rpnydop emncsa(farta(mpno4aeeoii3ias aDel(vs u)tlenxocoadlpD anvols0sruoxo3nu1llenlncil(  Drmumpnu0openiiciyd aDelnmont) rtrir3io1oat aieslt0trur(m nudop e fci t)a2tmu p;t4tlxnmfeiasla2ra( pnt0 rermrcoa1lmte iei s)s2trir3iydolenmivils a2ra(  nt1optn oetls sDrmu s;u)treoxf iytlmtelu o;t)texmxrpoodal n fes s) Duaxmonu4opeo fciys mDea( s t0tlermfctytfm  lneo s0s2toimpnu1lm  mnctls) 2ta(mo;t0olt ii3iatla2rlump;()aleoiocoodfa  auesl(0sruoxr iudaptn fetltfa2rmx pno4alt  ieils s em( s;u0teenirctytlmt li i;t0 exrxrpnu4amtemnvi ()a2trum oo0tltnifetyd sDumnvonu4alenxf3iatfp  lnei s t2xmir nydoptn iesas s2taxr ;u0oltnmfetadlaDuanmpnu)alxrxo3tadlm rlivo t trtoxmpnu4amenlnvia( sDtmurpou4teenif3iltfs2el(mo (4 reoiociytoa ranes s0srtm(m3iu4lmtnmivsl( a2umu pot0tpt if3iys aDumu p (0 reoxr3tydfm rlivs;( srtr(opnu4ol   nvtls) ruaxmo;o1optoif3tldfs ua(vs;t0 lxnmfcoytfmDe n i (  2xmxmpoo4lp n fctlsfsDrmum ;u0ale ii3iltfm2um( p;t)arxnxoctotlmtran s t0s2trio oo4lp  lfci ( arraurpnu4tpt iicilt s em( p t) rtrxf iodfmte n ils tetoiopnodllt livtl()s2umx pou1aet mfetatfsDra( snt4aexnif todlm  ln s t sexmim iu4opeemies (fsrtaxr ou4aptnmociys a um( p;t)arenxfciydfmtrlu ilt) rxr(mpiy1al   fcil(fa2rrurp;u1olt ifeiysls2eanvsn(4tlxnirctodlatelu s s)trxrirpiudll nlfeilt)arururpnt1oeto feiyslaDuanvs;u4areniocoo1omDranei (  2to(m3io4opee ivslt)arraxro;o4oleo feiatlm eaumo;()trxomo3iytlpD ln i;(0 rtoxrpnu1olenlfvt ()a2raxmo;t0alxnio3taslm uan p (4alxnio todlpDeaiei;s0seuoxr oy1alenlneiat aDtau oou1apenioeiltfaDem( sn(0arerio3oy1fmt  ies;( t2xoirpiu1opeemivsltfaDrm(m ot0opxn fetysls raums ()tlxomocoatfp  auei s0 euo(rpiudap e nctl( a2rrxr no1tltn fcias s2ul( ont0tltrxr ta1lm e ieols tetoio iy4lpe lncs (f Draumpno1ale mo3tad a2uluvp;u0tlenmo3ia1om  li o ( teur(rpiy1ameemivt tfa2trx  ;o4tpxoioeilt s rlump u)teeoxrcoo1lp rlnvs;(0sruoxrpoudlltnlfesas)srrrxmoot1ole mi3ilslmDeau p t4tlerir3iadoat  nei s) euoxopiydaleelnct ()srrmu ono0oee mf3ildfaDrluvpn(4tltomf iotlpDeln ols teuoxr3nudop n ncia(farumxmpoo4olxo o3tls m2ulnvo;(4alxrmo3tatfmD livs ( srxoim3io4amen nes ()s2rm(  oo4tpt mfciltfs rmuvs u)tetrxr3oadfa  au ils0trtrxmpny1ape mfvt t arumxrpou4aptoiiciatfa2rm(mpnt0artnircootopD  u i;s trtm(m iy4omt  fcs (fsrrm(m oo4aetn fciad mDua( ont0tlxnxrctatfp eau o;s0sexmim3oy1omt lnes ( s2um(ro;u1apxnmf3tatlsDraumsnt)tlenxf3iodoa rlu i t seuo(o iy4apt lnetasf 2ta(r ou4tpeomoeiatls ulnms;t)texoxo3ia1lp  luei t)teurxopiydal e ncil( arua(m ;o1alt  feiys mDrmn s t0 rtrxr3tadlaDe nei;t0teurxr3ou4omt  nvi tfartm(rooo1teen f3tldlsDrm(vo;(0arenifcto1omD livs s0s2uoxrpiydapte ivslt)srtmx p;t0tpx io3tldlmDrlnmpnt4trtnif3tydlptr nvo;(0texriopiu1amtnlfvsa( sDra(moot4tlxo oeiydlmDrm( o;(0 leomr oydopDeauvo s)srtm(o3ny4ome lfcsl( srtmxr no0tpeo oetytls ea(vs;(4arxoxf iytoatr ivols)srur(opiydlmeelfcils  Drmx p;o4altomf3ildfaDeln p u0 lxrmrcootfa  li i s  etoxo3io4lleemneiltfs2umxro;t1tet mfeiaslmDeaumpnu)tltrxo oytomtr i sls)t2tr(r3no4llte ivt t  Duauronu4tlt if3iadfmDulnvs;t0alxrmfctodlmD  nvs;()setmirpoydame mieta()aDraur nt0oeenmieiys aDumnvo;t)trxnmr3oydlatrlues ()s2tmxr3no4lpen nvtlt  Dtm(  ;o0oeeomi3iyslmDum(vo;u4trtnxf3iydomDrai sls srurxr iy1omt mict tf rta( ono1olx mieias a rmu pn(4arenxf3oy1om rai ol(0s2toir ou4ol n nvsltfa2urxmooo0tex  ieiytfm rl(vpn(4tlenio iotfm ean s s srtoxopiu4opee nvils a2trxm ;t4olxoifeiyd mDrau p u) rxrmo3oatom  au i ()srurim3nu4altnmfvtl( aDrr( o;u1aetoiieiaslaDem(vo t0 lxrio3tadlmDe ues;t)tetoxm ou4lp nmfcia(fsDtrx o;u0apx if3tat m eanms t4tetoio ootfp  lu s (0texm(o3oo1lm   fviltfaDumurono1aexn o3iltlmDem(vs u0teeoxf oy1op r ieo t  exoirpny4lpte fvsas) 2urur ot0oex mo3iaslmDumu p t0 rtomf oo1lpD aies t sexoxo oodap e nesltfsrtmur oo1tlxnmi3ils s ua(vp;(4aeeoxrctydlaD ln o;s srxrio oo1alee fctat)aDrrum ou4aexomoctasfm2uanmsnt) rtnifcty1lpt au s () eurxo iu1lltnlivi s a2uaum nu0oex ifcildfs umump;t4trenxrcoo1lmte n i;s0 2uo(r nydaptnlfvias s2tmx onu0ole ifeils s2rlu s;t0tlermf ta1fatr ieo s)t2xmimpno1al nmneiatfsDrmxr oo1oet ioetytlsDra( p t0trxrxr oo1lmD  ivs s0t2toxmpnydal emiet s)s2tm( o;u1aleomietydlm2rl( snu0aexoxrctadlat lnes t seurxo oudalee fvslsfaDur(r nt4tpe mociatls2rm(vpnt0tetoxr tadlp eaivilt) etm(r nu1lm nmfcsa(faDrmu pot4opto iciltla2rlu pn(4 exnmf oo1om  livo;t0sexmim iy1altnmiesas  Duaur oo0oeeniicilt a rmuvp;t4 reoio3oydlaDraies (0t2to(o3no1om   fesl(fs2tmu pot1alx mfciyd a2uauvsnu4treoio3iy1lmtr ivslt)srtmim nudapt mfcsls)srra(r ot0apeomieilslm ul( p;(0 ltoxr iadfmDrln o;s  exmxo3oodop   nvtlsfarrmx  ;u4aeeo octytla2umuvo;t4tetnxo3iodlpteaivil(0tetmxm oudolee fct (  2rrx p;u4tet mieiydfsDrmums u0 lxrxfciydfp e ivslt)teto(mpoo1oltnlics ()srta(monu4tlxniocildfaDem(mp u)arxrxo3iadlpDelu i t0seumxm3iodal e ictl(f rtrur ;u4tpx  f3iydfs rmuvs;u)tltoxrciy1fp eli i;t0t2uo(r io4lm  mfctlsfa2ur( o;o1aexomiciysfmDem( o u)teenxr3tytlateanvi (0trxm(r oy1llt lics (fsDrrx  nu4altomicildlaDemu o t0 lxnmoctydfmtraivs;t0sruo(r3oo1olen fctls)a2umxr ou0oexn ictaslsDum(vs t4tlenxf iy1faD livil( t2xoxmpio4amtnmivs s aDtr( onu4tlxoiociyslsDuluvsnt)alxrmfciotfmDe neol()seuriopny1ape lfciatfaDururp;t1alx moctyslm umnvs t0areomo3ty1oaD auei;t0tetmxr3nu1al elfcsas)srrm(mont4opxomieiyt mDumnvo t4treomr io1om eaivo;s) etr(rpno4om elnesas)a2tau p;o4oltnmfctlsls2emums t0artnxf todfp elivs (0 etmim oo4amt lictlsf rta(r ot0aex  fciys s umn p;t0artnmo3tadfm eln o s0srumxopoy4lmt mics t a2taur ou0oetnio3ias aDulu p (4 lerxr3iotoaD  ivolt trxo(m3no1lmt  nct s artr( p;t1tlenmf3tytlaDea(vs t)teermrciodfpDrlues s texmxm no4alte ivs t)sDumx oou0olenmo3taslm2rm(mo u)artrxrciodom rauvslt)t2toxr ou1om  mncias) 2umurpou1apeo o3iys aDeau s u)aetoif3oa1oaDr uvols)setmxm3nu1op  lieiatfaDtau o;u4tetn ictlt a rluvpnt4trtnmf oodla  livo t0seurxm3iodlptn nctat srurx  nu0opx  fctlsfm rmnvo u4 ltnxrctodfa rli ols)sexo(o3io4ape lici sfsrrrumont4oetniietasfs rlumo;t4 ltnxo iydfpt lnei (0trxm(m iu4olt  ivt (fsDraurpnu1alt iicias mDumnmo;(0 leoxrctadlmD  ieols0t2xr(r3no4om e ivtlt)arra(r ;o1olxnifeiat a eln s;t4trxoioctatoat  nvo;s trxoxr ny1lp nliei ()a2ra(mo;t0aetoiiciysls2raumo;u4 lenxocoatfaD lu s;s0setrir3no1lpe lictltf Dur(mpot0aex mfeiad s2rmnms;u0 renxociydomDrau olt) rtm(m ou1al  mfesat sruaur ot1tee ifeiat s2rmn on()tetniociodopteauei;t) rxr(mpoy1op   ici (  2umump;o1oexomo3iltfm ea(mont)texomr tatoaDraueil() eurxrpno4lmenmfeta(f Draxmpno0tet if3iadlm emnvs;t4 lermo iydlmte ivsls0seuoim iudole  nvslt) 2rm(r no4oet  ietld a rm(vsn()tltoxf3oa1fatr n o;(0trxrio3iodolee nciat  2rmu onu1oeto i3tyslsDelnmo;u) exrir io1fptelivols0 exoirpno1aptelneilt  2umumooo4tlt mfctldfaDumnms (0alenmo3tadlaDelivsls t2umxm3oo4lpenmici s s2umum nt0tlxnmoeiat mDrl(vo (4 rtrxfctotomD ai ol(  2xm(rpny4op  mieta()sDrrx pou1tptn iciys s2umnmo (4aexnirciadfa r uesls s2ur(m3ny4ole  fvsl(faDtaur ou0alx mfetysfaDrl(mo u0arenif oo1lp elu ol(0 rtrio3iy4optelivtl( aDrruro;u4tpt mfciad s2rl(ms;() rtoio3iy1omt aies t) eurim3nudlmtemfvsat)s2uau  ou0alt iieild s2em( pnu0arermr3oatfmD  ies;( seumxo3ou4om  mivt s) Dtm(r ou4tptnmieiydlmDeanmo (0tlerio3totfp  lieol(0s2tmiopio1aptelfct t  2um(roou0aeenmoetysfa2um(vpn(4 rermoctadfpD  ivs;t)trxoio iu1ame livsl()sDraumpot4olxnioetysfmDemums u4alxnir iy1faD livo;( teuo(opou1ol nmnctat artrx  no0aetoiietlsls emuvo u4tetrxf3tatlmt lies;()trto(m3nu4ap elfct s aDum(rpnt4alxn o3iltfm emnvp;(0 ltrxf3oydomDe ies;(0 exoiopou4omt lieia()aDtm(rono4tpeo f3ilsfm rluvs () lermr3totlmDe u s;t) 2xr(m3nodomtn feils) 2tmu p;t0aeeo oeiasfm2emums t4altnxrciatlpDrauvs t0srurxopou4lm nmiesltfaDtmu poo0teenmieilt aDul(mpnt) rxnio3ootom r n i;s trumir3oo1ap   ieiat a2trxrp;o4aetoii3iydla2emnmon(4teenmf3tydfmteaivi s0seurxr3no4al  mnctl()aDrm(rpot0tlx moetad mDuanvpnt)texnmo3iotfa r i i s s2toim oy1amtemfci t) 2taur ;u1tpxoii3ilslm rmn pn()teerxo oa1lmtr ivilt0srtoxr oo4apt mfvtasfarrau onu4oexn ieiltlmDua( onu0 lxnmo3iadopD  ues;s)seurirpoy4al e fvsat arua(mpnt0apen octas sDuanms ()texoiocoodfaDr nvil( s2to(m oo4apenlivs s  Drm(ro;t0texoifctys a2ua(ms t) ltrifcoy1op   u s;t)s2xrim3oo4ll   ietatfa2umuroou0ale  i3ils m el(vs u) etrxrcoodopDrlnvi (0trxr(opny4lleemfvta(fs2umum nt1tltomoeild mDelnvs u)arxrmrciotop raueo;s0 exoxopiy1alenmivtlsfa2rrxr ;o1apt  i3tltfmDulnvpnu)treoxo3oy1omDelnvol(  2tr(r3oy4lptnlfciltfa2rrurp;u1oet ifeiysfaDeluvo;t)aetnmo3oadfm elivs;s0teumxm oo4apte fcsltfs2uau o;t1apx io3ils m2em(vont)trtrio3iytoptean o t)trurxr ny4ap nmfvsas)aDrmxmooo1aex iicilsls rl( ont)aexrmo3ia1la e uei s0 2xrim3oo1amt mnvtl( aDtmxm ot4tpto i3iys a eluvs (4 rtrmr3tydfpt lueo t0t2tmirpoo4lptnlfeilt)a2ua(rp;t1tpxo octydfmDeau p;u4 etomrctydoaDrlu s;t  rumir nu1lltnmfctasfs2taumpot4alxo fctatlm eaumo;t0 rermr3oatom  an slt) etm(o3io1amenlietas  2umx  nu4tee  o3iat s rmnvp;u0 ltoir3tydoatranei;() 2tm(m ou4ope  ncs s) rtmx pno0oltnifetasfa elnmo;t)tlxoxo ta1laDr u i;(0 exm(r3iu4lpe mnetls  rtrx oot4aexo feils s2eanmo;t0 exnmo tytfmDrlivo s0s2umio ou4lmeelnetlt  rtaumonu0tlx  oeias m elu p;t0arxnio oadfp elivils0t2toio3io1ale lfetltf Drmu ooo1aee mi3iatfm2eauvsn(4 rxoxf to1om  lu o;s)t2uoio oydll  mnctlt aDtm( ooo1oleomi3iydla2ul( s;(0treoxociytoptr ivi t seumim io1omtelfcsa()s2tmuroot1apeomiciysla rlnvp t0tlenxr ta1laDr i il(0seumxr3io4ap  lnvi sfaDuaum ;o1aeeoio3iasfm eanvp;u)artnxf3ta1fp eluei s0s2toiopno4aptemfcsa( s2rrx pnt4ape ii3tlslaDrmnvs;u4 rtoir3todomDran s t0srur(o3no4altemfeiasf 2tax o;o0apeo i3tldfmDrlnmonu4 lxrxo ty1fp  ai s;(0s2urim3ny4amt  nct tfsrrr( pot1tlxo f3ils m2emnvpn() exrmr ootfatrauei (0 etm(mpnodal nmfei t) rtm(  ot4oleo ietlsfa2elu p (0 exrxf3ootfm e ieo;() 2xo(m3ny4apeemfvi tfs2raxmooo1tptomi3ildls2eanmonu4artoxocoadoa eanes t)trur(m no4lm e fetlsf 2ra(ro;o1tle iiciys a ulnmsnt) exrio3oatfmt auvi;s0 2xrxm oudolenlfeslt) 2trxmpnt1oetomfetyslm2em(vp;t0trxrmo oadfpDeanvi ( t2uoxm nodllt  feta(f 2rrx pnu0optnmociyslsDem(vo ()trxoxr3iydlm r ieo s t2trxopny4openlici ( a2urumooo4tee iietasls rmums u4arenmo3tatfpte uvs t0s2ur(r3oy4lp   iei tfsrurxm nu4aptoifctltfm2uanvpnu0texrxr3tadoaDeanes s  exo(rpou4amt licsltf 2ur(m ou1apx iocilslm rl(ms u)trenmrcio1opt  ueo;t  rxmirpny1opte fvsls a2uaum no1tltn f3iydla2rmums (0artrircoadla   nvsls)s2toxr no1am   feia()srrru oou4olxoii3tyt s2emnmonu)aeeoxfcootoaDe nvo;()setmio oydoleemictat)aDtru oot4apx mi3iadfaDrl(vsn()trtoxr3oadlmtrluvols truoiopou1ome mnvilt) 2rrxm ou0aex  ictlsfa eau snt4 exomoctadop eai s;s s2xr(m3ou4lp   ieils  ruaumooo4tlxniictasfm2eln on()arxnio3iy1fmDeauei (  2ur(o iy1olee fet () rrrxrpot1aetnif3ilsfsDeaums u4trtrmo oodlpD au ils) rumxrpoy1am e neia( srum(mp;o1apto ocilsfm2em(vo u)altrif3ootfm  anes (0seto(o nydop  lnesatfarurxroou0aet mf3iydla eluvp u0teenio oo1omDr ieilt)t2toxo3nudope  ncsa()s2tmu p;t0apx io3ildfm elnmsn(0tleoxo iydfa  lneo (0srumiopoydlpe mfvtatfaDuaumpot4aeenmociytlm2ul(vonu)alxnxf iadoa r n i s0 eumxmpou1omt  netl(f ruauro;o1oleoifciydfmDem(mo;(4 exoxf oytfaDeai o;s)seurir3io1omtelfvi (  2urxrpnt0aetnmictlsfa ulnvp;(4alxnif iydlm elivi (0t2urxopiu1lp nmfcs s a2trxr no0oee  f3iytlsDuanmp t4aeeoxf3oatopD au il(0 exmxm3iu4amtemivslsfs2ua(  ;o4alt ifetld s emnmpnu) exoxrcty1optelueo (0s2umimpnu4ap  miet sfsDumxrono4aeeoio3iyslm2ea(mo t4 rtoxf oydfp e ues (  rxrxo no4lmee icsatfa2raxrpnu0alx ioeiatlmDrlu s u4texnxfctotfat aivolt0s2xmir iy1olte ivs t) rrmu pou4tetn oetlslsDeauvo;t4 lenmfcty1lm raivs;t)seur(m3iodol nmncsls  2um(m nt0oet  i3tydfa ulumont)tlxnmrcoodopt li s t0 exo(o ny4ale lnesl( aDrmx  no1apx mf3ilsfa rlnmo;t0 ltnxr3tydomDrluvo;t  2umir3nu1lle  feil()a2ra(roou0tlxnmi3iat s rln o;(0texnio tytlmDraivils0trtmio3no4ap   ivta()aDum(  ou1aleoiociytfs uanvp t0 lenxf3iydopt lu o;(0 eum(o3ny1ome mivtatf rtru  ;o4apxn oeiatfs umnvsn(0teenmociatomDelu slt0 ruoxo nudlltelfvia( s2rmurpno1oet mfeiyt a rlu s;(4arxrmf3todfaDeanvs (  eumirpoy4alte ncil()sDra(mpnu1tlx mietyslmDra(mpnu)tlxnxfcoy1fm   nei () rtoxm oo1lmenlnvt s) rururpnt1apeomf3ilsfs2umnvo;t)aexnxfciytlp   ivslt0s2tmim oo1lm nlfcil()sDurum nt1tptn f3iys a2el(mon() rxnxo tadoa   neo;()teuoirpoodol nlivils) Drru  ot4tpeoifeiadlm2ra( s (4tlxomo iodfpt  n i s0 euriopou4lp   neslt)sDrmx pnt0opx mf3iytfs uluvpn(4tetnxrciatoaDr ieol(0 2trio3oudlptelnesa()srrmu p;t0tlx mfeiat s2rm(vs;u4aeerxf3oytfaD an o t)tetoir iy4al nlnvsas)s2urxmpno4alx  i3tlt s2rmumpnu4artrmf oy1la r nvs (  2toimpiy1ol e ici ()sDum(rpot1aee  ociat s umnvs;(0 exoxr oo1fmt lieolt)texmio3oodom n ietat)sDum( p;t4opxoifciatfs elu o (0trermr oadom r ieils  2tmxm oo1al   iet ( sDrmuro;o1oltn f3tldls ran snt)tetoir ta1oaDeaivo (0seuoxr3iu4lpenmncs t s2ta(r nu4oex if3tysfaDeln o u4 lxoxo3oytop  lnvs;t)s2uoim nu1lpe  nvsas  Draurpnt0alt  f3iytfaDeanms u0tlxoif3iydlmDr i i;t0t2xoio nu1llt mici () rtrxr oo1tex iociat m2ul(vsnu) ltnifcta1lpteai i;t0srum(o3no1apee iesas)a2raumoot4oetomfciltlmDum( s;(0tetrmfctydfa ranvsls texo(mpoy1lmenmncslt)a2um( p;u1aetnmieiltlmDrm(ms u0tlerxr oydoaDrluei;s0t2trir oy1ap emnetls)sDraumpnu1aexo ieiyt sDul(mpnu0trxrir3oatoat  neolt)trxm(m3oo4oltemfes ()s2ta(  ;u4ale mieild a2eaumsnt0tltrxr iydlaD lues t  exmxm3ny4ameemfesl( s2um(  no4tetnmicild sDrln p;u0 rxoxrcoodoatr neo t teum(m no4altn fci ( srrr(m no1olx if3iydfa emn o ()artrxrcta1lmtr n slt0texm(o iudlmtelicsa(faDtau ont4opxomf3ilsfm em( o () lxnxr iytoptrlu s;t trur(m oo1alenlneil( s2urxr ou0ope io3tasfaDrl( o;t0alenmoctotlptr nes;s0t2tmxm no4omtemnesat srrr(rpnt1apx micilsfaDum( s (4 etoio3oy1omtelivilt trtrio iu4ol n netat  Dtrxmoou1tpen fctlsfs emumsn(0 rtrxr3io1lmt aies;t srxr(rpiodap nlnci s) Dur(  oo4aetoio3tad s rmnmpnu0alenio tadomDeluei;(0 2tmxm ou1am e fetltfsrum(  oo0tee mietyd s rmn p;()aexnxr tadoatrlneo t  2xmimpny1opee iesl(f ruaump;o0tpxnmiciltfs2eanmp u0 rtnio oy1oaDraivi;t trxmim oodlmee fvslt) Drauronu4aex io3tydfaDran p;u4altoif3totfaDelneo;s)s2ur(mpiodal elivsa(  Dtaum oo1apxo o3tlt aDrau snu0 lenxrcio1op  ln s t seurio iy4am e fetasfartru pno0oexnmiciadfa umnvo u0tltomociytlmDeau ils)t2uoxrpio1alte nvs s) 2rr(  ou0tetoifctld s2ran s ()tltnmociotfpD livils0 etrim3iu4lp  mncsls a2urum nu1olxomfeilt a emumo (4trerio3todop  luvs (0trur(r3iudap   fesa()aDra(mpoo0oex  i3tydls2uau ont0 rtnxfciodla  lieo;t0srxr(o no1ameelncslsfs2tr(rpnt1tpx ioctyt a2rmums u0areoxr totfmDraivo (0 exmxm3nudalee fvtasfs2trxmooo4ole  octydfaDeau o;u0arenifctydomt lu i;s0trxoir3no4lp  mietasfs2tm( poo4tpx ii3ilt aDrln onu0 rtrxociotomteai s (  etmxr ou4ll n ictat aDta( pnu0aexn iciltlm2ulumo;()artnir3ootoate nvo (0srtmim3no4ap emneilt  Dtm( ont1tetnifeilt s rm( p t0 ltoio3iatoa rauvi t) ruoxr3ny4am nmfvs s  rtr(  oo1tleniieiydfmDeluvo t)alerir iy1la eauvo (0trur(o ou4optemncslt srtm( pnt4aee moetldls2ua( s;u4arxnio tadfm raueil()trtm(o3oy4op n nesls) 2rmu pot1olen i3iyslsDrl(vo;t0 eermfciy1lpteaieo;t) exr(o3nodomt  ietlt)srtmxmpnt4oexn feiatfs elumpnt)aexoif3iatoaDelnesls s2urir3iodalt  icsat aDrmu ono1aetnmociydlm eln onu4aeenio3ta1fp  aueolt0sexo(rpnu4apt  fei s)sDrmumpnt0altn fetydlm2um( s;u0trtrir3oadoate ies;t0 eto(r3iydlmt mici s s2rm(r ;u4teeo i3tysfaDelu snu0tetnxfcty1fmDeaiei t) 2uriopiu1llen fvi ( a2tm( ooo0tpeoiietytfaDemuvsnu0 rxomo3oo1opD li s t srtm(r3ou1ap  liciasfaDtrx ono1aexn o3tad s2rl(vonu0 rxomr3totlmt an slt srtrir3oo4optelfcil(faDururpno0apenmoetatlm um( o;t4alxrxfcio1fatelues;t)trxrim ny4al elfvt ()sDuax onu0opxoiietyt s2ul(von(4 lxrmo ootlpteaivil(0sruoimpno1om nmncilt arur(rp;t4apxnmi3iydls2em( p;u) rtrio oy1omDelnvs;( s2tm(r3oo1al  lnet tfsrrm(r ;t4opxnii3tld m2uau pnt0alenxrcoydlptelnvo s s2urir nu4ol n ivsa(fs2rr(m ;o4texo ieias a2el( o t0aetrmr iodom raiei;()trtrim iudapt  netasfsDtr( ooo4olxniietltfa ea( p (4 rxrxr3iodlateluvi t)s2toim oydlltemieilsfaDua(  no1aetoifciltla uan s u4aexrmf3ootlatrauvo;t0 rurxm nu4omtelivia()s2tmu onu0opxoio3iyd s eaums (4trxnioctodfpD aivi;s  euoxr3ny1lp  mieilt  2rrxm ;o4oeenmiciyd aDumums t0 lxoif iotfmtr nesls) etmio3iu1omenlfvilt aDumump;u4oleo i3iydfm ean o u4tltnxo3iytlm e u i t0s2xoxrpiu4apt mnct ( sDrmx pno1olen f3ils mDelu p;u)trerxr iydfat ai il(0srxrir nu1opt mfeiat)srrmum ou1tlenifetld sDeln on(4tlxrxf ootfmD au sl(0seurxrpiu4al elivi s  2trxrp;o4apenif3ias sDul(vo;u)trtrxo3iy1opte i slt)srtrxm3iy4aptnmnet s arrmx  ;o0aetnmo3ias a2ua(vp;(0tetnxf oadfmtelu sl(0 exoirpoy1lle mfvil(fs2um( onu4apto ietadfsDra(mp t) ltrifcoatop  lnvs;s0srxmirpiodoleemict () Drr(r ;t0olto i3tys a ranvsnu0 rxnmf ty1omD  n i;( srtoxmpiy4ole livslt) Dtaurpno0tpxomfeiysls rl(vp u4aetnifctatomt li i;s) euo(o iodap elfct tf Dtau ont0alxo f3iaslaDeln s;(4alermo3io1fatrlnvi;s) 2xoio nudam nmiesl(faDurumont0alx  iciadfs ean pnu)aetoifcoydoa r ivslt0 2xrir3no4optnmnesat) Dtax oot4opxoiieils mDrmnms;(0trenxr3iodfpD lnvs;t  2xrxrpnudol  lfciasfs2tm(m ou4oetniietyt s raump;t0texoxf3tytlatr n i;t0 2xr(r3iodomtnmfvils  Dra(mooo1teeo o3ilsfs elu p u0 rxnmf ta1omte iesls0seumio3no4lm n ncs t)aDtmumo;u1tpe  f3iadls2rau s t0tltriocoatoa   ueols) 2xm(rpoy4op   nvtls)srumxm ou1texnmf3iyd a2rlu p;u4aexrxo totoptrluvs;t0s2urim iu4alenmicsat srrm(root4teenmf3ilsfs rm(vs u4 exrir3oodom rlnes;t) rurxm3ou1ame  ncsls aruauroot4aee iieilsls2ua(ms t0arxrxo3ia1op r ieo (0trtoio3iydolt  feiatf rum( pno4alx mo3tytlmDuau pn(0 leomo3oatlatraivil( truo(m3io4op  mfeiat aDumurooo0optomfciyd m eanmo;t0trtrxfcty1fpDelneo;s  rtoio nodomtn fesls)a2urxroot0tpto fctld s2rmn p;t0 ltrxfctydfp eluvsl()s2uo(m3oo1lltn ics t srrmum nt1tetnioetatfa rm(mpnu4aleoif totlm eaivilt)s2xr(mpnodlm nmiet (  Drm(rp;u0tee  fciatfa ul( snu)trxrif3oydfp   ieolt0s2uoxmpoo4lleelfvs (  rra( p;u0oexn f3iasfs2ra( pn(4aetomf3tytfpt  uvi t)teurir oy4lme mnctlsfarurx  ot1tetn oeild m2uanvp u4teerxf3iadoaDe nei s0 rtr(r3no4ll e fcslt) Drrumpot4alx ioeilt a2emn s u) etrxociytfaD lieo;(0 2tr(r3nudom e fvs ()sDta(mpou0altnmi3tysla2umuvp u4teerxo3todlp rlivo;()srxmim3ou4open nciasf rrmu p;u1opxomieiytfm2uln pnt)trenxo iadoaD lieo;s0 2xoiopoy1lmeemfcils srta( o;u1opeoif3tyt mDrl( pnu0 ltnmociotoptrli i;(  exr(rpio1amtn ieias)aDrr(m ;t0opxn i3iasfa rm(msn()aexoif3oodlaDr u s t s2toxo3nu1lp   nvslsfa2rmur oo4texn octatfmDulnmsnu4trtrir3to1op eai s;t  2xo(mpno1ope mfctl() rurxmo;t0apx mf3tltfm2um( pn(4tetrmr todom elueilt0 etoxo3iudolenlneils arta(rp;u1opxn ietytfs2emuvpnu0 etoxfcoatfmDeaues t0t2xr(o3nudol nmiet (  2ur(mpno4oetnioctltlaDum(mo;() exnifctadfp   neo;t trxoxm3no4am nlfvslt a2umumooo1tlt iietatlsDrmu p;t4 rtrir tydlmtr i i;t0s2to(r3nu1lp nmfvt s)sDumurpno4apxo fciaslsDel( snu0tltrxo oydfpD aiesl(  2xm(m3oy4lmee fetatfsrumur nu1aet ii3tadfmDelumsnu4 exnifctotlateau o;t)t2xrxmpiodalee fvil( s2uaumo;u1altnmfciytfm rln snt0artoxr oytlmD au s s0 2xm(rpou4apeelnvia() 2tmu  ;t0aex  ietat mDeanmp u4texnxfcio1om  anvo;t0tetoimpoy4lmte ivslt a2ra( pnt0aeen i3iytfm el( p () lxoio3oydlatrlnei;s)srto(m oy1amtnlivt t s2umx o;t4oex ioctlsfm el(vsnu) exrmf ty1fptrauei t0setrxo3no4omt mfvsl(fa2rmu poo0tpxnmociad m emnmp ()trxoxrctodoa  lieo;t0t2uoir3ou4aptemnvt t) 2urxmpnt4tlx ioetas mDrmnmpnt) rxnxr oytfp r i ol()teumxmpiydol e icsat)s2tmumono1tlx if3ild sDumnvp (0aexnxfcootfate ueol(  ruoxmpny4llt  nvsas  Drrx poo0alenifciltls2ul(vs u4trtnxo3iytlp r uvi;(0teuoxr oy1lltnlnvsas s2uau  ou0tpt micilt m2ea(ms (0aetrmo3iatop rai o s t2umimpio1ll  mnvtas)s2raxrpot1tlenmo3tytfs elnvs;(0trxrmo iatfptrliei;t)seumir ny4llte fetas) Dtr(m nu1olxn o3ildla2umn o;(0trtnmo tadlm raivslt  2xoxr3nudom   ivi t) 2ua(m nt0tpenmfciad s rl(vo t4arxrmr tydfaD  ieo;(0 eto(o3ny4lpe lies s arrm(m oo4opt if3ildfs2rm(msn(0 etoif3iytfatrli i t teurxr iudll e ict t  2uax pnu4ole if3iys s uluvs;u4treomrcoa1fatrliesls0seur(rpoydlmee nviat sDrr(mp;u1ape  o3ildfa eaumo ()arxrmo oy1lpDe i i;(0s2umir oy4optelieiatf rua(  ;o1opeomociltfs2el(vp;u) ltrxf totlaDr uvs t0sexm(opoo4oltnlfvsl(f Durumpnu1tpto fetatfa ul( p;u)arermo3tydlp  anvi;t0tetriopiodap   ivtls)srum( p;u4ope  i3iltlaDelnmp (4 rtrif oodfmtrauei ( trtrxm3oo1om n feias  Drmxroot1oeeomoetlsfa emump;(0altomocoodlm r n s;s) rtmim oy1olenlncsls)srrrxrooo0aeenif3tytfaDemu s;u4aeerxrcoo1faD lueolt0trurxmpnodam   fcs (fsrurxrpot4aet iieild m2uanvon(0 eermrcio1fm   u o t0 rxrxr no1amtemncia( srrr(rp;u4altoifctat sDumu o;(0 lxoxfciatlm  li sl(  2xrxm3ny4ll  lnes t)artmxmonu0tle mieiatlaDulumo (4alxriocto1lmDeau o ( texmxm oydlptn nvslt)aDtrumpou4tpx  ieiasls2umn sn(4 renxf3iytlmt lnei ( setriopno1altemneiltfs2uaumpou1open f3iadfaDulu sn(4tlenxr ia1fpDeanes;s) rtoxr iydolen feil(faDuru  nu0open oetaslm2eauvo;t0artomo oytfpt auvils)t2tmim ny1lmt mivs t)a2tm(  ;u0tet mi3tyt sDra(monu)teerifcoydfpteaivo s  ruo(m3oy1lptnmfcslsfsDum(mono1apeoii3iys s eln p (4 exoxfciy1lmt  nei s0texr(o nu1olte fcilt  rum(m ;u0aet iociysfs emnmp t)trxnmfcoo1laDrlnvsls0sexoir iy1al   feslt)a2tr(monu4oltnmfciydfs2rmu pnu4aeeoir3oa1oa eau olt) 2toir oo1llt  nci tf rtmu  ot1opt mietltfsDumnvp;(0 ltnircia1opDeaieo;s0setoxrpny1omtnlncslsfsrtmx oot4aex mfciadfs2uauvpn(4teerif to1oa e i o;t)srum(mpoydapt mict sfartaurpot1tetnmo3iytfa2eau s;(0tltnmf tadfp rlivi;()s2tmim3oodlm e ivs tf ruaxrpot1texoiicild a2rln pnt0trtnif3ty1lpD lu i ( trxoiopny1lpt  iesl( srrmu  no0tpx iietydfa um(vp;()teenmo3oadomDeaneo;s) rxm(m iydomte ncil( s2rrx  oo4ope iicild sDrmn s u)trtrifctytfa elivs;(  exo(r nydlltemieilsfa2rm(r nu0tex mfciadlm2ea( p;u0 rxrxf io1lm  lnvs t  rtoxo iy1oleelfvt (faDuaxr ;o4tle  i3ild m rmums;t4 leomociotoatrlu ol() rtrxrpnydllenmnvia()aDta(ro;t1tet mo3iad m2rlums;t0artomfcoodoaDrlu o;(  eto(m iu4ale lfvi s a2rr(rpnu1olxn iciytfa2uanvo t)aleoif3ta1fatr nes;s0 exrim iy1al emics t)aDrrumo;u1tex mo3iasfa2emnmo t4teerxocootop eluvi s)srxoxm oudop  miei t artax ooo4open o3iltlaDranms;t)trerxo iydoa  auesls0seuo(r3no4lp n ncils)s2uax o;o1olxoio3ildfa2um( snu)aeeoif3io1laDraivo s  etr(r io1lmee fes tf rumumo;u4texnmo3iysla uanvsnu0trtoif3tadfatrau o;(0tetoir oo4lptnlfvtltfa2uax ooo4tlxoifctyt s2rmn s (4tltnir3tadoate u i t0tetrxm3oo4llt lfcs t)sDuru o;t1opxn oeiasfaDelumo t0teenmfctytfmtelu i t)sexo(o3nydalee nesl( arrrxmpno1oeenmf3ils a rmnvo u)aeenifciydlat au s ()srumim nudlmt lfes sfaruaum oo4oexnioeildfs emumo () ltrxr3tatop  an i;()t2xrio nudomee nvs t)srrmx  ou4altoiieiytfa rmuvs;u4tlxoirctadfp raieslt  euoir iy4ap elivias aruaum oo4tee  iciys m rlu o t)altoir ty1om   nesl(  eumio no4lm elnvslt s2tr(m oo0tltnmo3iadfs2ua(msnt4 lenmrctadopt an slt s2ur(rpno1altnmiet t) rumumpot1oltomoeiydfaDuau pnu)arenio3oy1fmDrlues t t2ur(opno4lpeemies (farrmumpot1oexnii3tyt a2rau pn(4treomf3iydlp  lu o s tetoiopno1optnlictlt  rrr(mpnt4aex mieiysfmDumuvp;(4altomrcoa1op e u i s0srtmxr3ou4oltnlneiat) Dtm(m ;o0opxnmieilt mDuau sn()aexnxr3tydla rln i ( s2tr(r oydlmt livsls sruaur oo1oet ifeiysla uanms;(0arxoxociytlmtraneolt0 rxo(rpnodom emneslt aDurumo;u4alx  ieiydfm2emnvs u0trtnmocoy1optrlivi (  2xmxo3oo4opee fes s) rur(mono0aptomfciadfa emump;u4 ltomf iytopD luvi;s)s2ur(o iy1ame miei ()aDrr(r oo0oltn ictadfm2rmnmp;t)aeerir3ty1oa  ln o;s trumir3io4lp  mnvi s srtru pou4tptnifciatfa uau pnt0alxnxf iodom  aivols)truoxm oy4ome lnei tfa2um( o;o0olx iieiyd mDel(vp;u4tlenxf3tytfa ran il( s2uoxm3io4lm elnvsl()s2raum oo0apeo oeiad s2elu p;(4alxnio iotoateli ols0srxo(mpny1oltn ictasfaDtaumo;t4apenioctyt sDemuvsnt0teeoxrctodlaDrlivs;t)t2tr(m iu4optelnci (fa2rru pnu0apxoiieiatfsDuan on(0tlenxocoatlate uvi (0setrio iu4om elivsa() rtm(r ou1tlxoif3ias m uanmo;u0 rtomr oydlmDeai s;t  2toim3iy4alenlfesat sDtmx ono1aetoiiciydlsDul( s;(0arxoxf to1fmD lnes;s0s2tm(m iu1optn fci (f rtm(rpoo1oeeniociadfa2rlump;() rtrxfcoydom  anei;s  2xriopnu1am   nviasfa2rm(monu4tlt  i3tydfa2ean s u)tetrmfctytoaDeai s s0srtoiopiu1llte nci s srumumonu1texn fctltlm2el( sn(4aleoxrctotlpt li ils) eurim oydlm  mfet s  rra(rp;u4opxnmf3iydfmDrl(ms u) rxoif totlmte ieil(0srto(r3iy1ap   nvs (faDrr(roou0alxo ociltls2umnvp u4arenif3tytlp eauvi s  2toxmpny4omee icsa(faDuaumpnu0aeenmf3iatlaDuaums u4trenir oadfpDelivo s  2umxm3nodomtnlnct tfaDuaurpoo1apto octlsfs2eaums;(0alenxo oy1oa   ieil(0 rurxopnudaptelncsls srtaxmpnu1alxomo3iadla elnvo u) ltrmo3tadlat lu s;()t2um(r ny1apenmfvi s)a2rmxm ;u4tpx mictasls rmuvp u0 rxnxr3iotfatelivs;(0t2uoxrpno1llen ies ()aDtr( pnt1optn i3iatlmDrl(vp;()trtnio3oatfm raivils  2xmimpoy1lpe lfei ( aDrru p;t1oex  octydlm2uanms;t)treomfciytlmt  n sls)srurxmpiu1lpenmiei s)artau p;o1optnmi3ildfm2umuvs u)aeerir3tydoate ies;t0sexriopno1amt lfeia()arta(mpnt0tleo i3iasfa2ea(mo;u0tetrmo tytoa eaivs (0sruo(mpiu4op emfei sfaDrrx pou1teeomo3iytls2rlnvo ()tltrxrciytopDelies;()t2uoimpio4alen ietlt)sDumxrp;o0alenmf3iatfa ranvs (4 rxrio3ia1fpD an i s srxrio3iy1ol nmivi s  Dur(mpnu1tex mf3iysfaDuauvo;(4trxrmfcoodla elieo;s0 rum(rpnydopee fctltf Dtmum ;o0alx mi3iadlmDelumo;t) lxrxr3iotfmD aivi t)trtmxm3oy1olt mnviatfsrra(m ot0tltnifciytlsDuaumo;u)aeenxr totlat lnvo s0trumirpiydlleelnesa( arrauro;u4aet moctls a2eluvs (4arxrmr oadlat  i i s0 2tr(rpnu1openmnvsa(  Dum(r ;u1apx iociytls2umu o;t0tltomo iadomt ln i;(  2xm(opoydap emictls) 2urxm ot1texnifciltfa emn s;u0tetrmf tytfptrluvs t setmxrpoy4altn ivtltf 2rax  ot0altnmf3iadlm2rlumo u4trenir io1oateanes (0 rxoirpnu4olt mieslt  Drm( onu1ape mfctasfa2uau snt0texrxfcoo1faDraneo;t0 eumirpiydolte icias srurur ;o1tlenifeiytfsDrmuvpnt4altrmfciadomD livs t)srtrxmpio1ame  ivtlt) rtm(m no0tpxn i3iasls um(vo;(4tltoxoctadlpDraueo;s srxmio3iy1llee ieils sDrrx o;u0oltoioctldlaDuanvp (4alenxo iydfpDrlnvo (0srtmiopiodamee nctlt)sDtm(ro;u0tlen ociyt m uln s ()aetrio3todlpteln s ()srxoxm no4llt livsatfa2tmx pnt4tet  oetysfm2umnvo;() rxrxrcoa1op elneo t  2xm(rpio4lpeelfetlt  2raumpno0apt  fetadfa emumpn(0tltrmfctytop  aivi;(0sexr(r3io4optemnctlt aDum(moot1oex  i3tydfa emu p;()tlerif totlmt lueo s)srxoxo3oo1lle mies (fsDtaxro;u4oet moeiysls rmu o;t0tltnxo iotopDran s t)t2xoxrpiudol  mfvt sf 2ta(rp;u0tetn oeiyd m eln s;(4alxnif iatlp  ai ilt  2toir nu4omt  ncslt aDtmurp;t0open o3iyslmDrl( p u0alxoif iadfa  li o;s) rumxr iy4amtn ici s a2rmxmp;t0aptoii3iadfa2uauvp;()trtnmocta1lmD auvsl( setmxr nydal nlfctat) rua(mp;u0aexnmociat a ra( s;()aexnxf3tytla eai o;t trtoimpiydoptemivtlt)sDumurpot0olen i3iatfsDulumsn(4aetriocoadom elivolt trurxmpiudome  fvt (  Duru o;t4ape ioetydfaDrlnmo ()tltnir3oadomteln i;t0trumirpiy1ape mnviasfaDra(  ou4aexn ictltlm rlnvsnu0 rxrxfcoadomt an i;(  ruriopiy4lm n fvilt  2umxmoot0aleniiciltlmDra(vsnu0 lenxf oy1fpDr uvs;t0 rtoiopno4ap  mivsltfsrum(rono4tlen oeiadla2umu p;(4aeerircio1oa raueils  rto(mpiu1open fvsa(fa2ua(mp;t0oexomieiltls ua(vo;t4tlxnio iatlm   n sl()s2tm(o3ny4lm  mnci ()s2trurp;o1apt  f3tysls2ulumpn(0tltrio3to1omtelnvilt0s2xmxm nu4op e nvilt a2rrxmpnt1ale mieiat m2emuvpn(4tlxomr3ootoate uvs s0t2umimpoo1op emfcsa(fsruru pno4oex ii3ilsls2ea( sn()trtrmr3iatlmtran i;t) 2xo(r3no1omt mnesl(  Dtm( ooo4opt mieias s2ulu snt4texnmrcootfat aivol( t2um(opiydlpen fci sf rumu pou1optnifciyd sDum(mp ()alxrxrcio1lp e i o (0 rto(m3iu1lp nlies t  2taurpoo1opxnmfeiysls2rm(vo;u4 eeomociydfa  an o;t  2xrxrpoy1om  mfvtl(faDtr(rpno4tee moctytfa ean pnt)teeoxfcoatlmDe uvi;s0trxmim nydlpee ivil(  2tmx p;o4oleoioetyt sDuau snt0 etoxr ootom  aneo;t truoir3no4ome  net tf 2tmxm nu1texnifcildlm eaums;t) rtnmfcta1lmtraues;t)t2uo(mpoy1op elnvi s)a2uauroou4apx mictlsls2el( s;(4aetoxo3ia1oate u i;() etoxm ou1apt lfvil()sDurumpnt0tptomieiltfmDea( pnu0trtoifcoodopDeaues s0s2tmio3nudaleemfei t)aDta( ooo0aeenmo3iysls ul(vp;u4 rtrmr3ty1fpteaiesl()seurxo ny1oltemnctltfs2tmxr nu0oetoiociytfaDuau s t) exnirctadoat aueolt setmxopnodamee net t) rrm( pou4optomf3iytlaDem(mp;(0trenir3tatlaDrauei;(0t2xmxrpou4ap nliet (farumxm ot4apxn ietytlm rlnms;(0 ltnxf tadlmteaies;t s2trxm no4amtelfvsl(fa2urur ;u1olenioeils aDrmuvpnt0arxnircto1lmtelnvsl(0srumim3nudlpe micsl(fa2rm(ro;o0apenifctltlm ulnms;u)aexnxfcio1oaDeluvs;()seumirpno4olenmfctl(fsDurum nu0opxn iciadls2ea(ms;t4texrmo todoatran i;s)texmxo iodoptnlieiat) 2rrump;t4aeenmoctltlaDuanmp t) exnxocoadlptrlivilt sruoir3iudlm   nci sf 2ur(r ou0tlx  oeiysls el(vpn()aetnxrctotlpDr neolt seto(rpiodlp emnciatf rurxr ou1oetniietld s ra(monu4tetrmo oo1fm rln s s  ruoim3oo4omenlies ( arurxronu4apx  fciytfmDra(ms t0artnio ia1lat lneol( t2xoxo3iu1am nlfctls) Dumx  ;u1aetnmfcildfm el( s;(4alxrmf oa1lm eanvolt0teuo(o3iu1lpenlicsls) 2umum ot1tle io3iyd a2em( p t) rxnmo3tatfp  ln o;s)trtoir3oo4olte icias)srra( ono0aptniicias s umuvon()trxrmr3iy1opD lu ils) ruoim3nodam e ietlt)arrauront4oetoioctyslm ul(vs t0 exomf3oytfm rlnvols srxrxo nu1lltelfci (f Dta(  ot0alx moctytfa2ulu pn() rerxrciotoa  li il()trur(mpno4lm elieil(faDtm(ro;o0olen fciyd m ulnms;(4aexrir3iadopD luvs t)s2xm(r3iu4llt  fvtl(faDum(  no4tpt  ieildfaDemnmonu)aeeomf iotlp elivilt) 2xrxm3nu4omt  ieiasf Durx  ;u4aeeo ietld m2rluvo;t0 etnmr tatoaDelneo (0srxr(opnu1apenmnvs t  Duaxrpou4tleo octltla2ulu o;t0 exrxociotomDeauvo;s) 2xrxm3iu4apte nvta(  rurx oot1ale ifctydlm2ulnmsnu4teenxrctodopte i o t)teuo(m3oydlptnlicslt sDtm(mooo4tlx  ictysla2ulnvs ()trxomr iydlmDraieo (0 2umio iu4lpenlnvs s)srtaxmpou4tpe mociltlm2rluvp;()tetomf ootom  anvslt)t2xo(r oo4op emfvt tfsDraxrpnu4oeto i3iydla emnvo;t)texrmf ia1opt li s (0texmir no1lpte ivtls) 2rr(r ot0oex mo3iadfs rluvo;u4 eenirciotoaDe n il(0s2xmio3ny1ome mncia()aDum( pnu1tpeomi3iyd a em(vs () lxnxf3oytlp eln ils)srxmxo io1lpenmivsat)arrr(mooo4apxoifetyd m2rmu s;(4trtoiociotlp   nvo s)srtoimpnu1ameelncils)a2rrum ;u1aleo o3iydls2eaumonu4texnir3tytoaDeluei t  ruoim3nu1lme mfes s a2uau oou4tptn ociys a2ra( p;t)altoxrcoadopteanvi;(0t2xmxm3nudaltemncs sfaDrr( onu1tlt  oetldla eaumo t)artrxr3iy1fmDrluvi;()srxrxopny4ameelicsas  rtmxm nu1tleniieildfmDemnmo;t4aeenxfciytlp eaieol(  2urxrpiodop  mieslt  Drmxr nu1opxo o3iatfs ua( s;t0aeeomf3oo1op eli olt sexrxr ny4op emnei tfaDua( o;t1apt iociadfs2ulu o;u4altrmo3todlmD anvols0t2xo(m3nu1op emfctlsfs2rrx pnu0ole  fctasfs ea( p;u)altnxrciy1opD  uei;s)srtm(m3iu4amte ictl(faDur(r ;o4tpxnif3tadfa ulums;u0 rxrmociydfatr iei (0seum(r3oo1om  mnvtat s2rmu oot4oexn oeiltlm2rmn s t4 etnmfcoytla eai s;s)texrirpou4llen fetlsfs2rr(  oo0tpt if3ild mDrmnmp;t0alxomr tatopt li ol(0texmim3oo1llenmnctl()aDumurpno0opx mfeiasfaDeaumo;t)alenir todopD luesls  ruo(opoo1ol emicsl(  2trxmpnt0oeeo fetas sDra(vpn(0 exoio3ta1omte neo;s) rxrxo iy1lmenmicsls)sDta(m oo0oeen fctldfa2el(vo;(4 rtrxf3tytlat an il(0t2umxm3io1op nmiet tfs2tm( o;u4optoiiciltfa uau o;() lenifcia1oaD ln i ( texrirpnu4ole  fcsls  rururoou4aet mf3iysla um(mp () leomo iadomt lnvolt)srxmxr3ou1aptemfcta() Drm( oot0opxo feiydfmDemnmp;t4aeeomf oadlmDr ivs t)teumxr3oodolee ietl(farrau  no1ole mo3iatlmDemu p;t0 etrxf oatoa r uvo;t) etoxm3io1apenmnviltf Dta( o;u4tet moctatls2rm(vo;u0 rtnxf to1fmDrlnvo s0s2xrim3oy1ap e ncsltfs2uaurpno4tetn feiydla2ulnvs u0tlxoxociytom  au ils  2xoxm3iudameeliviat) 2ra(m nt1ope mociadla2um(vp (0tlxnircoodlmtr n il(0 2xmxr3ny4lmenmncs sfsrumu  nt4oetnii3iatfaDeauvo;() ltrmrciatlpteluvilt  euoim3iydap n nctl() rumuronu1aeeomieiatfm2ua(vp;(4 exoxo iy1fptr i sls)tetmim iydalenmncsa(  2rr(mooo1olxnmi3tasfaDra(mon()trxnxrciy1omDeliei;(0trxrir ny4optemncs t) Dua(mpou4aex ifciyd aDea(vpn(4 leoir3totoptrluvil(  eur(m ny4lptnlncia(f rua(monu1tpe iiciadls2ua(mp;t)teenxrctatoaDe uvi;t)t2urio3oo4llte fvta(  Dtrx pot1teeomociaslmDrlnvs t0treoxf iodfptr ueil( setr(o3oy4lp n ivtls arrmxr ot0tlto i3ilt mDrlnmp t0 rxrxo tytlatrlnes s  2xr(mpnu4om e ivsas)aDurxrp;o4optoiociadlm rl(mp;t4 ltrmo3iatfaDe i o (  2xmio iy1aptemnei sf 2umxmono1tptomoctyslaDrmnmonu)aexrmf to1fmt  ieils)trur(o nu1oltn net s)artm(mo;o1oee ifciys s2raumpn() etnxfcoy1omte uvsls)srxo(rpiudaptn ivslsfarraurooo4olxoiieiyslm2raumsnu4 etrmocta1fmte u o;(0trurim ou4lp emiviltfarumur ou1ole  o3tatfaDrmn ont0trxomrcoo1fa elivo t) etmimpoo1omt  fctls)aDuax o;o1tpxoioeiadfsDul(vp;()trxoio3todomD lnes s)s2xrxo ou1alt lieil(faDta(r ;o4aptomicilslm ulnvsnt) renmr ty1fpDrau slt) 2xrxo ny4op  mfes sf ruaurpoo4tle  i3iyslaDua( ont4trtniociadfaDrliesl( setrio io4ale miei t arua( ooo1olx  fctadla rmn p t4 lxrmr iodlpDrlnvol() exoim iy4lmte nct t sDrrxmo;u1apto feiad a ulu o;(4altrir3iatlm  anvo t) rxoxm oy4lltn ietas)aDumuront0tptn fetlt sDemu p;u)tlxoxociy1omtelnvi (0trtoirpou1lptnmicta(faDraum ou1olxniociasfm2rlnmp;t0tlxomo3tytopDeaivslt t2tr(opiydomenmfeil() 2rmur ou1tptnmi3tytlm2ea( s t4 rtrif iy1lmDeai o;t0t2umxm3ou4lltnmivt s aDrm(  oo1tpeomf3tlsfa rlumo;u) reoioctatlp   uvo;t0trumiopoudlmeelivtat srrax p;t0alxo i3iydfs ul(vpnt4aeenmr io1oat ln s;t)trumxr3ny4ale  nes tf rtrx pou0olen feils m uln o;u0areomr iytlmDr ivsl()sexrxr3oy4olen icsas)s2umu  ;t0tet  i3iad m2ul( o u)trenir io1fmD anvols0 rtrimpou1lpeemies (fartau pnu1oeenmictytlaDrlnmo;t4arxrmocoadlaDe n o ()srtrxmpio4amte nvi (  rtmxm ;t0oexoiieiyd m2ul(vp u)trtrxoctodfm rluesls0 etmim3ou1op  mncia(f 2ua(ro;t1apxo iciysfa elu o;t0altoxo3ootlpte ivs t trxrim3ny4al   iei t)a2taum nu0tleo ieilt s2ulums;()areoir oodomtrlueo t t2xmxo3io1ope  ici (  rum(monu0alt mfetltfs2emuvo;u)arenmo ootoaDeanvi s) eurim ny4lmtn icil( aDtrxmp;t0oexnif3ildlmDra( pnu4 ltoifcoydlmtrlivsls teuoxo no4op e fcta( sDta(mooo1oetomictltlm2eluvs;u)alxrmfcto1lptrlneo s  exmir3nu1ol e icslsfs2tm(m no0apxniietysfs uaump t0 exomr tadlmt au sls0t2to(o3iu1amtelnctl( arra( pnt4ope  ociytlsDumuvo t4aexomr3iydomt anvslt t2urir3oy4apt mnesa( s2rmx ono0oeto oeiasls2rl(mp u)altnxrciytlpDe uei ()texoxo oy1lleemivtas) rrmxrpoo4teeo ietltlaDrm(monu0trtnmr3oytlat  ueil() eurxopiu4am   fvt t)a2rr(r no4texnmfcild s rlu pnt0artoxo3iadoaDran s () 2urxr3oy4lpen fvtlt aDrrx o;o1opxomi3iad s2uluvpnt0trtrif ta1oa r n i s srurio3iu1lltelici s  2umxrpot4tptniociadlaDua(vont0aetnmocoo1omt aueil( t2tmxrpoydlpenmnvtlt) Dumu  nu4tpe  fetldfm ra(mp;u4trtoifctotlaD lieo s  rtmxm nydapenmfesl()sDtmx  nu1oexomi3iadlsDuln s t) reoxfcoadfpD au s s) etr(r3iy1llenmfet ( arrmxrpnt4aleniieiadfm ranmp;t0 lenxr oydlmDranei s0teumxmpiy4omtnmieias) 2rru  no4tptnmieiat a2rluvo t4alxnxo iydlmt li o t)s2uoio3ou4lmtnlfcs s)s2ua(m ;u0opxo oeilsla el(vo;()tltoio3ootfa raieilt0srxoxo3iy1ope lfeta() 2uaur nt1alxnmfciasfs2umuvs t)texrifctatlmDean i t  ruoim iy4alt  nvi ( arta(r no4apxomoeils m rlump t) exnio3ia1faDr ueilt tetm(r3ny4ap elfctlsf Dtr(m no0oexnmiciydfa uauvo;u0trxrifcoadfp  anvs s0 2xoiopio4lpee ncta(faDur( o;u1ope mfeildls ua(ms u)aleomf ootomD livi;t) ruoir ny1aptnlict ( sDuaumono1tptnmfeiysla2ulnmp;u) leoirciotoaDrlnesl(0srtoirpio1ale  ncs () 2uax ooo4alxn ieilt m umn p;u0arxnir3iy1opDrai i t)sruoxm3no4op   ict s  Dumx poo4tetnioeiysfa2emuvp;t)arxnmr oo1fm eaivils  2urxr3nudlmtemfvsls aDrrumpou4opx miciytfmDean o;u0aeerxf to1fateli olt texoiopiodop  mnetas  rurx pnu0teeomfeiasfs rl(mo (0trtoxrciytopDrlu il( tetrxr nodapenlivsls a2tmumont4teeo fetasla rau on(4trxoxo3oodlpD auvi t)srxrio oo1lmenlnesltf rtmx p;u4tpe io3iadfsDel(vont) lxomr3oydop ranei ( srum(rpoodlme lfvtas)arua(m ot1tptoiocild a ranvo t)aetrir ty1lm  lu i;s)t2um(mpio1openlfvtlsfarta( pot1aet ii3iatlsDum(vo t0altoir3oadoat ai olt trtmxo3iydlltnlnvi ()sDuax pnt0tlt ifeiydls emumont4 etoxr iotoa ean il()tetm(o nu1opeelict t  2rau  ;t1tpt ifeild mDrl(vp (4 ltrxo oydoa  aivslt0trtrir3ny1lpenmfcil( aDrmur ou0tlx ii3tysfa2ul(mo;u) etrxf3tydfmteanvol(0texoio3oy4amtnmfct () Drru p;u1oltomo3ildls2ra(vp;()texrxo3io1omDrai o;( s2uoxmpiydamtemivia() rtrxrp;u4aexoioctad s2rlnvo () lxnxf oydfaD ln ols)srurirpou4lmeelnvtat  rta( pou1opxomfeiadfa2el(msn(0texnio tydopt  ieol( t2triopno4olenmnes s)srrmxmpnu0ape moctyt m um(ms ()aeenmf tytfmD au s t) rxoxr ny4alenmfvsat arua(rp;o1teeomietysfsDelnvonu4 ltoxocoodoptelues;()trtoxrpny4al elnvils sDrm(mp;o4altomfciad sDumuvs t0trtnifctatom  au ilt0 exrxrpny1lp nmieilt  2tau  ;o0tle ioeiaslmDrlu s t4tetrxoctotfmteanvo;s) etrxm3oo1alt mnvt (f 2um(m ;u1oexoif3iadfm ul(vp (0 ltriocootfmDr iesl(0trtrxm iodope  ncs ()a2rrxro;o4aeeoiiciasfs umu pn()arxnmr3todfptrlnvilt0trxmxmpio4lpte fvi tfaDra(ront1tetniietas a2uaums u4 etrxocoadfa eauvi;t0 exrir ny1aptelfei s  Dururooo0teeoioeias s emu p () lerxo3oa1fmD  uvsls0 exmxr ny1ol nlncia()aruax oou0texn fciad s2rlnvo;u0 rxrifctodomt luvs;( teurimpoy4lltnlici (f Dtm( o;o4olenmi3iysfaDrl(ms u0aeenircootfptranes;t0trtrxopny1ap nmnvs t)aDur(m ot4opxn ociyt m el(mp u)aleomrctotfpDraues;(0srxr(opio1op n fvt t arraur nt4apx  o3ilsfm2rauvo;() ltoir3tadoptran slt)sexoxm oo1omee ivtl() Dumxmoou1altoioctydlm2uluvp t)teeomf3ootoaD li sl( teto(o oy1amt mivia()sDtmxrpnu4aetnifeilt a uaumo t0teerio iotoatelueo (0 2uoio3no1al  lncias)sDuaumpno0oltnmi3ilslaDel( p;t4 lerxf3ta1op r nei t seurxrpnodlptnmivias) Dumurpno1tpx mociyt mDran onu)tltoio3oatfpDr u olt srtmxr3iy1amte nvsl(faDurx  ou1oee if3iysls eauvp;u) rxrmf3iadoaDrlneolt0 rxoir nudlm  lnvils)s2rrurpou0apen fetysfa2elnvo;()tlermfcia1fmt anvo (  rumio3oy4omt  nvtat)a2taxrono0ale  oeiatls2ean onu)tetrxoctydomtrlueil(  rxrxm oy1llte ictas  2uru o;t1tle  fetld m2ea( p;(4altomo3totoaDeauesl(0trxmxopoo1lpe  feils)arrmumonu0alxnmf3iad a2ua( o (0 lxnircoadlatrlueslt)trumxo oo1lp  lfvtls)srrmxrpoo4aeto oeiaslm rln s;t0 exrmr to1oa raueo s0 2um(mpiudlp n ivt ( a2trxrp;o0tetomfctysls2ranvo u4aetrir3iydfaDe u o;t trurirpoodlle lnetlt  Dtrx oot1optnmietydfa2ra(ms t0tlenmr3iodfaD livsl()srur(o3no4lpe lneil(  Dum( poo0oetomietydfa2ua(vo;u4tlxrio tydla raivo;t tetmirpiy4amtn fesa() 2raumpot4aeenii3tadls elumo t4 etrmr3iatfp eln ol(  2urxopny1om nlnvt ( s2ra(ro;u1tle  oeild aDeln sn(0tlxrircta1fp  ai i (0srtmxrpiudame mies (f Dtrxmoou0tltn ieiasfa uluvo u4alxrxf ta1fpt  neo s)s2umirpiy1ope lnesa( arrrum ou1tpx  ictadfa rl( o () lenif3ty1opDe nvs;t0setrxr3no1ap n fesl()aDtr( ooo1oex mi3taslm el( s;u)alenircoydfa e u ols  etmir3oo1optn iei tfs2tm(mono1alx mf3iat s ran o;u4altrmf3iatfp rau i;t  eum(mpoo4apee icil(f rtaum nt4oltomoeiadla rluvsnu0 etomf tadfaDrlivsl( sexrir3oy1olt mfetlt)artmumo;u0opxn feiltlm2umn o t)tltrmr3iadop r ivs s0srum(m3iu1amenmnciatf Dta(r no1tpeo feils a2eln s (0artrxfciotoaD  i o;t sruo(r nodlmtnmics sfs2ta(mont1aetnifeiat a2rmuvsnt0 reniociodoat an o;s  rxr(m3io1am elfciatfs2uax  nt1tpxo fetldla eanms;(4altomrcty1fpt  i sls trxmxo no1omtnmivt tf Durxm oo0ape ifeild a2elu onu)teerir oytoaDrln i;( s2trxopou1lmtnlnctls)srtau p;u0alx ii3iatlmDrm(mpnt0aeerir3iodopDr n s;s0sexo(r3ny1lmtnlnciat)srtrxr ot0optn ocildfaDelumo;(0texrmrcoy1opteluvo t)truoiopiu1lptn ieiatfa2rr(mpno4tetoifctldfs2rmuvs;(0 rerxr3oa1lpte ivilt) 2xo(mpoudlltnlnetl(f Durxmont0tptnmociydfmDraumsnt4artrmf3oytomDeaueo (  eumxrpiudlme mictlt  2uaurp;u4alxn o3tydfaDranmont0altrxo iadoat  nvils0t2uoxo3oo1oltelnctat arrmu pno4aetnmieias mDemumo (4 etoircty1om eluei (0srtrxr3ny1openliciat sDrru  ou0aeenmoeiydlm2ul(vpnu0alermr iy1omDranes t  exr(opoodlpe  nvtltf rrmxrp;t4olenmoctlslm2rlump;(4alenxf3ta1optrauvi;()sexrxopoydllee nvilsfa2trumpoo0tex ifeias a2umuvont4aetnmf3tatfp e u o (0tetoio3oy4aptnmncsatfaDrmxrpno0olt mociysla2rmu s t4 rerxf io1lm rlues;t srtoxopnu1omtelnetltfaDta( onu4olt  ietlt a2emn p;()treriocio1oatr ivolt  exmxmpoy4ape mnci () Durumpou0olto f3iydfa uluvo;t0alxomf tadop   ivs ()t2xmxr3ny4lltnmfei tf rrmxr ;o0apxniieiat m2rl(vs t)tlerxrctadopt  neo;()t2xoxo iydapenmiei ( a2rru oou4aeeniiciysfs ulnvo;u) leomf iotoate ueo s  rtoio oo1oleelnetasfs2ra(r oo1olxoiieiytfaDrau o;(4 leoiocto1la  lneo t) rumxm3oodamenlictl() 2ur(ro;t0oleoio3iltfm emumo;u4tltrir iy1la r neolt)s2toxrpou1om nlivtlt) rumx p;o1tlto oeiad s2emnvp (0trenxf iydomD anvil(0srxoim iu4llenlfes s) 2raumoot4tlt if3ilsfa ea( onu0tltrxfcio1fmDeai ilt srumir ny1altemncsatf 2rmxm ;o1texn iciad m ra(vs u0altrxf tatlmDeluei (0trtr(o iu4aptn nct t)s2truro;o4aetnii3ilsls elu pnt4trtniocoydfp  ai il(0 etoxm3iodomenmfet () Draurono1optomo3iysfs el(vp;u)trxnxo3tytlpD  nei;( t2xm(opiy1apt  feia(fs2trur ;u4apx mfetyt a2uluvonu4tleoif3iodfp e ivi;t0s2xoxm ny4olt  neiasfa2trumo;t0tltn feiat a uau o u)tlxnio oy1fp  auvi t) eto(o nu4lpeemnei t)arrau p;u1optnif3iysfs2ean ont) ltomo3iodfm r nvo;t  2umim3io1lptemnvs ()arrr(  nu0tpenioeiltfm2ran s;u0teeoxo3iodla   i s s) euriopiy1lptnlivi s) rtmu oou4tpxnifcildfa2rlnms u0 eeoxociatlpD lieo;t) rxmxm iydoltn ivi ()a2uauro;u1oetn o3ilsla emuvs;u0altnmfcoo1op rln il(  rxo(mpnu1oltn nvsl( a2uaurpoo1tpx iociysls2uluvo;(4altoxo3to1oat auvs;t)srxmir iu4ll  lictasfa2urxrpno1olxnif3tadlaDuluvpnu0 renxf3iy1fpDr u i ( setr(m iu1lpt lfvilt  ruaxmo;o1aeeniictydfm ua(vsn(4 rtnio3ia1omtrai s;()trumxo3no4ap elncsl(f Duaump;t4apeomi3tlt m rm(msn(0aeeomr3iatla  anes;s) rxo(o io4lmen fctltfartmur nt0aex iietydfm em(mp u4texrmfcia1lm eln i;t texmim no4ope mnctat) 2um(r no4tex iietytlmDuanvo;u4aeerifcoadfat aieo s  2xoxrpio1lpe miesa()srrrxro;o4aex  ieiadla2el(mo;u4trxnifcto1fmt  uei;(0s2xmir iodll nlfctl(  2truronu1tee iieiyt sDumnmon()alxrio3ia1fptelnvils  rto(o nu1lm  lfcs t  2rau pnt4oetoioctytfmDuluvo u4 renif oa1opD ln i;( t2xmxo3iy4omtnmncil( s2tmxr nu1oltnioetasfmDrlumpn(0 reriocoytlp eaivil(0srtoirpiodal e ieiltfsDtax  ;o4tee iiciltfm elnmsnt0artrif3tatfaDrauvsl(0sexmio3no4ole lfviat)aDumumpot0tpxnio3iatls2ulumsn(0artrxrctytlp elu i;t)trtr(rpiu1lmenliei sfa2rmx  ;t0alxnifctaslm raums t) rtnio iytlpDe ueolt s2xrim3ou1lp e nctls  rtmxrpnt1apeo i3iat sDeln o t4 rxoxocoytomDeln il()teumxopiodam  mncilsf 2rmumoot1aleomi3tydlm ea( s (4tlxnmo ta1opDr n o;()s2urir3io4al e iesasfaDra(  ou4tex iieiysfs2emu on()trxoif tytlptean s;t) etr(m nu4ll e ieils) Durumpno0ope  f3tadlsDua( p t4trxnxo iodla eauvi;()teuoiopio1llenlnvtlt)a2ur(rpno1teeomi3tydfs2elu p;(0tetoio iatlm rluei t trumim3ou1omenmncia()arumumoot0tpxomi3tlt a emu p t)artrmfctadfmDrai o;(0trxr(rpnodol   nvtas  2uaumpoo1oltn ociltla2ranvs;u0trxnxo3io1fpDe u s;()srxoxm iu4lp nmneiltfaDtmxrpou0oexnioetltfsDelumpnu4alxnifcto1opDelivs s trxoio3oy4amenlivtls srtrum no0tee  i3iyt m rmnvs;(0alxoxo oytlaD anvi t t2xmio3ou4altnlicias) Dra(  ;o4tlxoiieiatls eau o t0altoircoadfpD  ivs;s)t2toxm3oydop n ivtlt artrxm nu4alenmo3iys mDuln s t) exnmo oodomD ai o;(  2toirpoy1ape lncias) Dtm(mpou0oeeo ietldls rmnvp t0 rxnxrciytopDrauei;t srxrir3iy1ale lfvi sf Dtmurp;o0oet iieiytfa2ulnvp;(4 reriociy1lpDelues t texmxm3nodam n nct sfaDrrxro;o0tex ifciltlm ran snt0 renmo oytom rlieo;s)teuoxmpiu1ap e nct (  Dumum ou0ale  f3iys s2ul(vpn(0 etoxo tydfmD  u s;t0trto(rpio1omenlfeiat)a2rmx pno0tet  fcild aDeanms t) renifcia1la eai s s) euoxrpno1om e fvilt a2uaxmp;u0aexnmi3tatls rmnvo t) lxrmf3ia1oatraieslt  2ur(rpoy1lptelfvtl(  Dtr(mpou0tpt  fciadla ul(vo t0 renif3iotomt aivsls) 2toxr iodol emiet t) rtmur ;u0opxo f3iyd aDrl( s t0alxnxrctydfaDrln o t) rxr(mpno1optemieias artaxr ;u4oltoio3iadfs ul(vo t0altrirciodfateauvi t)texr(opny4llen icsa() 2ra(mpoo1oeto i3ild m rmump;u)trenmr3ta1fp r uvsl() rxrim oo4lmtn nvt (  2uauro;t1texnmf3tyt s uluvp;u)aetrmf3oadfp   u i;()t2trim3nu4lp n fcsl() rrm(mo;t4optomietasla2em( s t0arxnmr iy1faDelnes;t0 2toio oo4apeelfvsls)s2umu poo4oee  fetytlaDrln o u0arenxf3ta1omtr nvi;(0t2xrimpiudale lnei (f Dtrx pno4tpt  ocils aDelump u4aleoxr3iatop   ues;t0trxm(m iy4lm nmnesas aDrrx pno1alt mocias mDrmnvonu0 reoif oy1fmDelies t) rxo(o3ou1olt lneiltfs2rm(mp;o0altnifctadfa2rmuvpnt4arxrio3ta1fm eau ols setoxr oydop  mnvsat  2ua( p;o1opeo feiadfs2rmn o t)altrxoctytlmteaivs (0 etmxm ou1amee ieta()srrmxrooo1tpt if3iadfaDemumpn()tleoio todopte ivi;t)srumxopoudopenlfciasfa2tmxronu1tpxn oeiysla2um(vpnu0trtrmf3oy1fm rlu i;t)texo(m iydlme mfvsas) rtrur ;o0tlxo f3iadlm rlu o t)teermr ta1fm  luvs;s) 2xr(m3oodomeelivilsfs2rr( pot1oexoifeiys sDelnvsnt) etomfcia1oat luvolt)t2um(rpnydaptnmfvtas  Dta(roou0olenmoetyd m2ulu pnu4 rtrmrcoo1oat auvs s tetm(o nu1aptn ivsat a2rrxr nu0aetniociadla2ea( s;u4trtrio oytlatran o (  2tr(opoudame lfcsas)srrrurooo0olt micilt a rauvp u)trerir ta1fmDr nvi t  2xr(rpnudlleemivt (  Dtau  ;t1apx mfeilslm2rmn s t4areoir3to1lmtr n s s0s2xoio3no1opeelietas) Dumumoot1alto fcias sDeln p;u)trtrxfctatop e uvols)tetr(m nu1lme mnviat)s2um(ronu0tlxomoctltlaDrlnvsnt0tetoirctadlptrli olt0 rtrxopou1ap nlfesat s2tm(mpou0ope mfeiadfsDul(ms;() rtnxociotlate uvo s)t2toxm3io1lltelnci (  rtr( pot1apenmoctldfm2ulnmsn(4tlenmocta1late nvs;s)srtoim3oo1ame mfcsatfaDur(rp;u0texoii3tadls2umuvs;() rxrxf3iotlateauvs;t0srtoimpnodlpeelivilsfsDurx oou4tlxo fetadfs2raumont4aeenmo3iydoa rlnvo t0srur(r oydlmt lfctat sDurxrpnu0opt if3ildfm ul( o;u4trxomfcoo1lm  lies (0srxrxopnodlmtelicsat  Dtaxr ou0tlx ifciyd aDeaumon(4aeerxfciytfa e nvs;()texoir3oo4al eliet s srtrurp;t4tlxnmieiasls emnms;(4 lxrxf3totoaDr ies s0setr(opno4llt mieilsf rraxm nu4tlt iicildls2uauvp t0tetomr iatfpDelu o t setrxr iydam nlivsatfsDtrumoou1altn icild sDumn o (4texnxrcoy1opD  neo ()sruo(mpiy4am e iviat  Dtau o;u0ole io3iltfa2eanmp () lerir iy1fp rlies t seur(rpiy1om   ivsas)artaxmp;u1olt ifetasfa emu p t) lxomr3io1late nei;s) eto(m3iodlmeemieilsfa2ra( oot4tltnmoetlt s rlnvp (4 lerxfciytfaD au o;s)srxmim oy1ope lfvt t)aDum(rono4oetoifciasfsDrm(mp u0 rerif ootlptelu i;( srtrxrpiu1al  livsat s2rm(root1aex  ieiatfs ulnvs t)aleoxo oatomDe u s t setrxo3iu1apen iesl( srurxmoot0apxo feildfm el(vp t)tltrmo ty1oa e nvs;( tetr(opno4oltemfeslt)aDrmuronu4tltnmoetlt sDeanvs u0altnxrcoa1lm  li s (0srtr(opoydal emiesl(  Drrur no1aee if3iyt a elu p u4aetnxfcoydoaD  i i t trtoir iydll   iesl()a2tr( ont4altniictasls2umuvs;t0trerxrctotomtrluvo s0t2tmxmpiu1lptn ivtls srra(ro;o0ale mfciysfs ea( s;u4 lenxr3iytla eau s;() etrxo iy1am nmfvta(fsrtrurpnt4tpx ifeiyslm2ra(vs (4 lenxo iadlaD  ues;(  rurim3nydoptnlncsltf 2ua(rono0texnmictadfm2rm(vo;(4 lxnifcto1fa  ai slt)seum(rpio1ol  lnvsas)srraump;u4ape  ociysls2umu pnt0trenir3iatoatrlivsl()s2triopnydam nmies t) 2umxmoou1ope iiciytlaDel(vs u0trtrxociatfmtrlu s s)srto(m3ou1op n fvsl( s2tmu  ;o1tpxoioeiasla um( o u)treoxociydlaDr uvo t)trtmim ny1oltn fvslt)srtmumpno0opx miciasla ul(mo;u)teerxrcootfmteli ils0s2toir iudlm  mictl(f rra(  ot4oetnifcias a2ul( o (0aleomo3ia1late n s;() exm(mpnu4lle  fvslt)sDtrxro;t4tlxoio3iat s2rau s u0treoxo tadoa eai sls0 2trxrpny1ll nm
\ No newline at end of file
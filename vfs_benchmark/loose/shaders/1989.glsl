@@ -0,0 +1 @@
+ieilt0sexmimpny4ll nlietat)artmx pot1tee moeiad mDrl( o t) lxrmfciytfaD aivo s0 2umirpoo4lmeemnvi s)srurumpot0oetnmfciadls2emn snt)artnir3oadlm  aieils0 2tr(r3oy4ape lfvsl( aDtrumpoo1opx  oeiyt sDelu p;(4 lenmfciydop eaivo;s) exrxo3io4omtelivias)srururpnt1oltnmictatlmDrm( o u0 reomr3oa1fa rai i t s2umxo oodomt  nesat) Drm(rpnu1aetn feiyd sDrlnvsnu)teeoxr3todopDrli sl() 2urim3io4op  mncsa( arrm( pnu4teeoiictydfm eaums t0texnxf3oydfp rliei;t0texrirpno1lm nlnvtasfarrrurpoo4opxn i3iat s ra(mo t4 lenxo3ta1op elnvolt)trtr(m3nu4aptnmnci t) ruaxmpot1alxoio3iatfs2el(mo;t)altoir3ia1faDe i i;()t2xoir3oydaltnmncsas)s2rau o;t0aet  ieiatls el(ms;() rxomo3iydlp r ieilt)trtoxr nodopen ies (f 2raxm nu0olenifcilsfa2ea( pnu4 eeniocta1oaDr neo s t2uoio iodam  lfetat arrm(rpoo0teenmfeiyslmDelu pn(0 exnmr oydopD li i;t0 2uoxmpnu4al  lneils)sDtm(mooo4tetnio3iysls2ul( s;(0artoio iatlat luvol(0 rtm(r3ny1op  mncilsfaDtr(roou1tlx mo3iydfm emnmo t0 rxrif iodfp   uvslt0 2ur(o3iudlme mfesl( artrxr ;u1teenmoetad a rauvo (0tlxomfctotlat ai i t0 rtmio3iu1omenmieia() rraurono1tpxnioeiyslmDeanmsnu)artnxrcto1oatrlnvi;t0srxr(o nu1lltnmfvtltfartmurpou1tle ifciatfs2rmumo;t0altoif3oy1lm   nes (  rtm(m3io1apt mfcs (  ruru oou4oleomiciytls elu s;(0teenif3oatomDrluei;s0 euriopny1ape  ivs s sDtr(mooo0opxo ietadlm2elnvs ()aetrifctadfaDrluvilt srxmir oy4op e ivsa(fs2rrurpou1tpt  ietyd aDrm(mo ()trxoxo3tatoaDrlu ils0trum(o3iy1ol  mnct (fsrurump;o0apxniictysla ulnms (0arxomf3tadoaDeln sl(0 eumim3oy1llee iei t  ruauro;o0opxnifeiat m el( o;u0artnio iydfm  ai ilt)srurxrpoy4al elieia(fsDtmu poo0aetnii3tltla2rl(vp u4texrxf3ootoaDeanvolt t2umxrpio1aleelnvtas sDra(mpnu4texo i3iatfsDea(vs;t4trerxo3oadfpDeaies;(0seumio no1optnmnvsltfsrtmur nt1apt mfeildfm rm(ms;()aetnxfciy1oateanvo t0setmiopoo4ol nmnetas)aDtmumo;u4ape iocildfsDua( sn(4arerxf oa1omDelnei t setrxo iu1lmt  ivslsfsDum(rpnu0aex mociydlaDeln ont4 reomrcoydlpt  nvsls0truoiopio1ap eliesl(faDtm(mpno4tlt iietldfm ranvsnt4altomf3oa1fp r ueo (0 exrxrpiy4lpe mnvtls aDuru  no0aee mfeiys m um(mp;t) lenio3ootoa  luvi t0 eurxr3nu1lltnmfct (f 2taxmpou4teto i3tad a rm(vp;t0tltoif3ia1optelnvols0tetoirpiodope mfetl() 2umxrpot1teto f3taslm2rmuvp (0 exnio ty1fptr uei t)sexmirpou1lp emfci s) 2rr(ronu0tpto octlslmDran s;t) lxrmr ta1op  li ilt) exmxrpiu1apt  feilsf Dta(ronu0tleoioeiyslm em(mo;u0 rtoioctodop rai i;s0sexmimpoydole  ivs t)srraxr ;u0oltn o3tydfa2rm(vp;t0 leoxf ty1la r ieo s) ruo(opou4omen fvils)srtrur ;o0aeto f3tlslaDrmu on(0trxnxf ty1fa  li o s0s2tmir3oudlm n net ()arrrxrooo0tpeoiocilsfsDua( s;t) rtomrcto1opD anei;s trxrim3io1op emics ()sDum(m oo4oexoifetldlm uaump t0 ltrxfcoa1lpDeln o;s  rxrir no1lmenmfciltfs2tm(m ou0oleoifciltlaDrl( snt0 exoiociydop ranes;t)srxoim3iydlle mnesat arrr(ronu1olenmf3tls m2uanmp (0areoxf3ty1opDeauei t0s2tmxmpny1lmenmnvia(f Dtaxroou4alxoii3tat m2rm( pnt0 rerxfcootfa  an ols)sruo(opoo1omtelnet tf Dtm(  ;o4aeeoiiciysla rluvs t4texrmr ty1fat  nvils0trtrxopiy1amte net ()s2ta(mpot4olenmo3iasfa2raumo;(4alenmf totlmDeaieo;s)s2uoxr no4am   ivsa(fa2um(  oo1tptnmf3tyt m2eluvs;u4trtrif3ia1omD aivo s0 2xmxm3no4amen fctl(  2tmx p;u4oet mo3tlsls2ran s;() etoircio1lp e ueslt seuoxr3io4oltemictasf rtaum no4olxoioctas a2emn sn(4tlermo3oatlateau i;s0tetrim nydopee ivsa(f 2umxmoot0tptnii3iytfs2raums;t4aleoifcoadlaD anvi;() rtrxm3ny1apeelnvi s  rumxr no0tlen icild sDra( s;u)trxnmo3iy1lmte n ils  2urio iudapeemfcia() rra(mont0tlxnio3iadla2ulu p t)trerxr oydfateaivol(0 rtmio3nudom emfeta(fa2tmxmpoo1aet ioeiltfsDeauvs;u) exnif tadopteaues t0 exo(mpiy4aptnliesl(fsDuauronu0apxn fciadlmDra( sn()alxnxr3ia1lmDe nvs t  2xr(m nu1ap n ietat)aruaumpoo4aptomoetltfa2rmuvsnt) rxrxo3oodom eli s;( setmxo3nydlme  feilt)sDra( pnu4tpen o3iyslaDelnmo t4tetrifctotopt lnesls)sexoim ou1altelfvt tfaDum(mo;u1oee if3tadfm2rl( pnt4 exoif3ootlmDe u sl( s2xo(o3oo4opte fcils aDumumo;o0oet iicilsfm rlnvsn(4altrmr3ty1lmD lies s) ruoxopoo1lp e nviat)sDtruroot4tpxoii3iydfs2um(vs u0tltoifcootfpDeai o;(0t2xmxr iydoptelivslt srtaxmp;o0aetomfetas m2uau o ()aetoxrcoodlmD  nvs;t srumxrpnodlp elfesas aruaxr ;t1apen ocilsfs2uauvp;(4arxoir oydlpDr u sl(0seuoio3oo4al   netl(  rtr(ront1tptoioeiydfm2uan sn()texnmo oodlpt  ueo ()s2xm(m oudap   ics s arrr(r ;o1tet moetltls2el(vsnu0alerif3iadlmt ln i t0 2ur(o nydam elies s srumur ou0apeo f3tysfa ul(ms t0teermf3oa1lmDran o;(0sexr(opiy4opeelfctat a2ur(roou1tle mo3ilsfmDea(ms;(0 exnmo3ootfm  aivo;( teuo(o no1olt mncs t arumx  ;u1altnmfcildfm2ra( s ()tlxomr oatlpt auvils t2toimpiy1lm n ies sfsrtm(rp;t1aex miciysls rm( sn()tlxrmf3iytfmteaivil() rxrxr3iu1ope mivsl(  rrmxr ;o1tpx ifeiatfs2eluvs;t)aetoifcoatoa rliesls)setoim no1oltnmfeilt  Dumu  ;o4tpxniieildlm2ul(msnt4treoxf3ia1opteln i;()srxrxr nu4am elnvta( aDtaurpou1tpx  iciytfa ranvsn(0texnif ootfmtr ueil()sexrxo3oy4am n ietl() rtmxr nt1tlxo fctat aDrlnvpnt)alxrio3tatfm rauvi;s sruo(m iudaltemietlsf rtau  ot1oeto ocilsls2rlums (0 lenio iydlpt  ues s  rto(o3nydal  lfei tf rumumpno1apt  fetytfs2ranvp t4aexomo3oo1op   uvolt t2xr(rpoodome lieta( s2taur nu4alx mf3iyd s2em(ms () etnmrcoa1oaDrai ol()srxm(mpoodolt mivtl( a2uax pnt0optn ocilt m eaump;t4alxrio3iotomt an ols)sexmxmpnu1ll  lics ()aDtruro;u4tex  feiytls ua(vsnt) ltrio oydom r n o ()tetoxr iy4olt  ncsa(  rurx  no0alen fcilsfm uanms t4 lenxr3tatopte nvils)trxoxo iu1opt lnet tfsDuau o;u0optnmf3iad m ulnmont4alxnmf3iydoaDrliesls0 rum(o nodll  mfvt t srrax p;u0altnmocilsls ul(mp;t4aeenmf iotfp   uei s trtrir no1lpt lnesa(  Dta(m ot1texoio3ildls ea(mpnt0arermr3totopDe nvo t0 etrirpiy4am e ivs s aDurx ooo1ale ii3iltfsDea( snt0tetnxf3tatlm r iei (0 rur(opiodllt  fvsl( srtmump;u1texnmicild aDrmnmon()trxnxf tydlatr uvs ( truoirpio1ll e nvtasfa2trurpoo0apxnmi3tas aDuan p t0tlerxr3tatlat anvo;(0tetrxr ou1lptelnesasf Drmur ou0apeomieiyslsDelnmo;u0teerxocoadlm e neils0 2uoim iydop emici t a2ur(  nu4altnif3iyslsDemn s t) eeoxf oy1late nvs;( s2trir3oo4olen fvias)arta(mono1oleo i3tadfsDrlums u0tetnxf3iytfatr uvsls) 2ur(o oo1op n icilt a2tr(m nt0texnmoetltla2eln ont4aetnxf3to1fpD luesls)teurxopiy1lltnmivtl()s2uau ono1tee mf3iad m ulnvo t0alxrxo to1oa e nvo () exrirpno1om nlfvsls s2raxmooo0olxo ieiytls2rau o (0teeoir3totfp elivi t0trtrio iydolt  ncs tfsDtaxrp;u4aptomieiysls2rln o;u4arxomr tytfm rliei;s  2xo(m iy4alen ivslt)sDraxmooo4ape ifeilslm rlu o ()treoxfcoodoa rlu s;( s2xoxmpoo1apeemfvias)a2rr(mpoo1opt mfcildfsDum( snu)trxnio iodopt anvo s)trtrir3ny4apeemfvs t)a2tmxmpnu0aexnifeiat s2emnmpnt4texoir totfa r i sls0s2uoiopnodlpe micilt)aDta(mp;u0oetoiieils sDeluvo;u)trxrifcoydla rau s;s0setm(rpou1am nmfvtlt)arrmurp;o0alenmf3iyd sDrmnvo (0alerir3oytlmtranvs;s0trtoim nu4ol  mnvs s  ruaump;o4apeomf3tas s2rmn sn()areoir tydomte ieo;t setr(m iydopt  fcsatf rtaur ot0aet io3iydfa2rlnmp u0alerio3oytfpDrauvol()tetoir oy1ll eliesa( aDrrur oo1tle ifetys m2eauvonu0 exoxo iydlm  ai i;(0t2to(opou1lm n fvtlt) Drrx ooo1optomoeiltfsDua(vsnt4alxrxo io1om e ues;( s2xoiopno4om  mncsasf Dumxmooo4opx mfeild aDulnvo;t0trenmr to1lmte nvil(0teumiopiu1lle lieta()arurxrpnu1aeeomfcilslmDraumon(0arxoxfcoo1oat anvs;s)t2umxr3iodll nlivtlt) rur(mpou0tltnifetatfa eluvp t)trxrxf3oytopDeaivolt s2ur(mpoydom emfesas)aDtax poo4tpxomfeils mDemuvpn(4 ltrxrcoy1omDe neol() rtoir nudale liciatfa2urx  ou4tleomictlsls2emnmo;(0 eeoxo3iadlat aiei t0tetoxopou1opee icsl() rtr( oot1aptn ietldfsDrauvont) ltnmo3tydfpt aivi;s0trurir3nu4lp nlicsl()aDrrx  ot4olto feilsls rmu o;t)aexnio3iodlmD  n ils)setrir no1om e nviat artrxroot0olen ieiytla rluvo () exomr oytoaD lu ils sexm(r3nodlme micil(fsDur(rpnu4tlt  fctyd s2rlumont0 rtomo3oo1lmD luei ( s2xm(m3iy1lleelfcsasfsruaur ou1teenio3iyslm rmuvp (0tlxrif3tytfm rau s;s  2xrxr3no4lltemnet () 2umxmpno1oeeniicias s uluvs t)trtoxr3todoaDeanes;t)seuoxo3iudopeemfctasf Duaumoou1tpxomoetadfsDea(vp u)tlxrmfctydlmD  ueo;t s2xm(m3nudameemnesa() 2ra(m ou1tet iictadfa umn s;(0arxoxfcta1om  li i;s t2xo(r3iy4op n nvsat)srurx pnu0opx if3iadfm2rlnvpnt4trtoir oytopD  ies;( seumio3oo1lmeemicias)arrrxr ;u4aexoioctydla elumo;t)trtoio3oadoptelies;s)trtoxm3oudaptnlicsas) Duaurpnu4olto oeiatfm uanvpnt0arxomociadfa elueo s0s2uo(rpou1lpee ncs () rtaurp;t4olt ioeiltls uanmsn(4 eenmr3ootop eanvol( setoxopno1lmt lfeta(f rtm( o;u4oetnioetlsfs2elu s;u) rxoxf iydfaD an ols)sruoxm3oy4lpt  fetatfsrtaur ;u1apxnmf3taslm2eau p;u0tlxnxf todlm r n s;( s2tm(rpoydam e fvslt  2rr( pnu4optoif3tadla emnvs;(4 rxomocta1faDeanes (0s2uoiopio1openlfct tf Dtaum ou1ale  f3taslaDem( o;t)trtnxo oa1omD aieo t s2xr(r iu1alen nvsl(f 2umurp;o4aetnmo3tatfs rl(mp u4 ltrxocty1omte uvo () eumim3oy1omtnmfctat)sDuaxr ou4aeeoioctydla uaums t4 ltomf3todfaD  u o;(0 2xrim3oy1llte fvsat a2rmxr ;t4ope  i3iad a umn s;u0trtoif ty1faDr n i (0s2trxr3iudopte fvs ( sDuru  nt1tpeoioetatlmDrm( pnu0 rerxo3iytomtr ueolt0s2xrimpoydlle mietat s2uax  ou4tetoifcils sDel(mont0tetrio3ootlpD  nes s  exoio iodlltn ivt s)a2tm(rp;u4olto f3tldls2elnms t) rermo io1op   i ol(0teto(r3oy1lpe liesl()sDuaumonu4olt mi3iytls2rm(vo;t)altoif ta1optrau o t0truo(r ny1op emieils  Dur( p;t0apx  f3iyslaDul( s;t0 etrmfctodfpteli ils)s2tmxm3iodalen ivtat  rrrumooo0oexniieiasfs ul( o () lerxoctotoa e ivilt0t2umio3iy1lm   fvi (fartmumoou0tee mociaslm2elnvo u4 leoxo3tydfa r uvi s)trurio3ou4ll  liei s aDra(r ;t1optomfetasla ea(von(4tlxrio to1fptr u ol( teum(o iy4ll elnei s s2trx  nu4tleomictls sDuln ont)tlenmf3oytfpDrluvs ()teurirpiudom  lfcsasfsrururooo1tpt mociyt sDum(vp;u0alxnioctotlptr i o s0trumir3no4omen fcsas)arururoou0aeeomfciytls eluvp (4alxoir3tytoa eau olt0 etrxo iydameemnctatfsDtax o;o1tltomicilsfaDumuvsnu0 eeoxf tadomtelueilt tetoxr3oo4apt  nvsls) 2um(mpnu1olxoifeiasfaDelu s;t) lxoirciydfat  ivo s texr(r3iydllen ncta(faruax p;t1tpenioeias s rlump;u4 eenxo3iodfpteaneo;t  2trirpoo1ap  lict (fartmx pnt0tltn f3tytfsDra(msnu)texnmo3totop  li o s  2um(rpno1aleelivs s)s2ur(mo;o1tet mfctytfm2uau o () rtnmr oytomtr uvs ( s2urir3nydapte icslsf Dua( pnu0alt ii3iltfs2uau s;t4aexoif3oatlm raivo;t trxo(mpno1ale lfetls)artaumoot1openmoctls s2rluvs u) lerir tatfptr uvo;s  eumxr3iy1omenmfei t  2tru oou0aeenioeiyt m uanvo t0trxnio3oatfat auvs;s t2trxr iu4ome mies t)srtmxr nt0tle  octyslaDrm( on(0 etnmo3oytoatrlnvs;t)s2ur(r io1ameemfcils  rumxrpnu4tlto i3iyslmDeanvo u0tlxoifcia1optr ies ( t2tmxr ny1openmicils) Drr(root4aetnmieiydlmDuanvo t4 lxoxf3ootopDrli ols t2xo(r ou1olte ict sfarurxr ot4aexn fciltls2elu s u0 eenxr3to1fmD au s ( t2urxmpiu4lpee feslt sDtm(rooo1tlxo ietaslm rau s t4tlxrxo iydlatrlivilt setm(o iudope lnvtasf 2urx pou1olx ifeildfa rlnvo;t)tlxrio3iatlptelu o () 2uoxo iy1lm emfcil()artmumooo4tpxnmiciadfsDrmu p u0tlxrxf3iytfaD an o s) rtmio no4lm nmfcil(  rrmumont1tleo fetytlmDraumsnu4tetrxrcty1fp  an o;t0srtrirpoo1altnlnes ()sDtau o;t4oeenmietadla2emuvp;(0aexrmf3totfat aieols0s2tmim3nodamt miesa( s2ua(rpnu0aexoifeils mDuanms t0alxrxfctodlptran ilt0t2toirpio1omeelfeias)sDraxm ;t0oee mieildfs2ranvp (4 rtomfcoadopt  i s t t2um(opou1om nmfeiatfsDurur ou1oltomi3tasfa2ra(mont4 rxnxf3iy1op e ueo;t) exr(opou4omtn nvi s  2ua(mp;t4tle iicildfa rln p ()texomocoatlm   u il()s2toxm iydlle  ieilsfs2tr(rpoo0ale  ictldlm2umumsnu0tetnifcoodomt au olt0 rtoxo ou4ap  mncs t sDuaxronu0oltomi3tysls ea( p (0 rxnio3iytla elieo;()srto(m oydop   fvtls s2umx  ot4tlx  octyd a2eanmo;u0aexrir3todlpDranei t0t2uoxopiy1ale lfct sfa2tax p;t0tlto i3tld a2uluvp t0alxoxocty1omDrli o;s0teuoxo nu1lp nmnvil()aDrmu pot4optomf3tydfsDem( s;(0trxnxociatopt lieo ( srtrio io1omee nvtls artmxm nu1alxniociasfm emump ()tlenmo iodopDraneo;s)tetmxrpou4omen ivta( s2ua(m nu4tetnii3iaslsDum( p (0 lenmfctotomt  ues s setrim3oudlptn fvt tf Dtmx ono0aee mocilt sDum( o;(0tlermfciodfaDrai i;t t2trim iy1op   ivi (fs2rr(mpoo4aeenifctltfmDrln p u)texrmociadlp ean ils)s2urir oodaptnmieiltfa2tmuront1aleniieias m emnvp;u4 etrmfciatomDraivo s) eumxmpnudoltn neils)aDta(mpou1aeen o3iyt s rauvo;t4arenircoo1fa eaivil() eurxo3io4apt  nesasfaDtrurp;u0optniieildfm2el(vo t0tlenxrcoadoa eaueo s srxmxo3oudap nmicsas)aDua(roou1olxo feilslm2umuvonu)areoio iadlm  au o;( trurir3ny1amt lfci ()aDtm(mp;t1apt mociadlmDelnvpn(0trtomfcootlmtrlieo ()trxo(m3iodaltnmicsa( s2ururonu1altoifeiatfaDeln p;(4trxrxfciy1fpD luvo s0truoirpnu4lle  ietas s2tmxmp;u4teenmfctatla rl(vp;(4 lenxo oatfaD  nvils) rtr(o3iudlmt  fcias)srtmxroou1alx  iciadfa2rmnmonu0aexoifctydlmt auvi t)s2xrirpiu1lpte fviatf 2umu  no4opeo feiytlaDran snt4aexnmo oytfmt aivol(  eumimpny4lptemfcs ()aDra(rpou1altoiiciasfmDuln o;() rxoxocoy1fm  anvi;( trxoir3io4omee nctltfsrrm(m ;t4aet ii3tltfa rlnmpn(4 rtoir3oydlatrau o s  rxm(opou4lptn feslsfa2tm( onu4ape  i3iltls ean p t4tlerxo3iadfatelu o (0srxrim3iodale  ivi t)srrrumpot0tet ioeiydla rmu p u4arenxfciatomD ln ilt) 2urio3nu1optnmnet tfarumxrpnu0oee  f3iat m ul(vs (0 rxrifctytfmteanesls0seum(r nu4amtn ivslt) Duau p;o0optomiciys a2ua( p;u0 rtnxf iodomDelnei t)tetr(r oudllt  icslt)sDumx pno4tetnmf3tydfs ranmo;u)trermrcoytopD aivi;s0sexoxmpoodal n ivtl(fartauro;o4oee mieiydfsDulumpn(0 eeomo oytfa rlueo;t)t2xoim iu1op n ivtas) Dra( o;o4oeeoiiciltfaDeaumont)trtrif3iytfmteanes;s t2xo(m oydlleemiet s) Dum(m nu0oex mieiytlsDum(mont4texoif3io1oatelieo;()truoio ou1apen nei ( aDrrx  ;o4open ieiltls ra( onu4texrxf ootomtelieo;t) etoxopiu4om n ics tf rrmxroou1ope  fctydfa2el( ont4trenifciytfaDelneo s)s2tm(r nu4aptelfei s)srrau  ;t4tee moeildls el(mp t)artoxfctadopDe ivil()tetoxr3iu1ap emivsat)srrmxrpnt1alxn fciytlm eluvo;u0 etomo tytfpDelieol( trxmir3nodlptemncs tf 2tr(  ou4alx if3tys m rlnms;(4 ltnio tydomt lnvs t trxr(m3ny1op  lnesl( a2rruro;u1texnii3iydfa2ua(vs u0alxoircio1faDraivi;t0t2xo(opno1om  mnetl( aDuaumooo0tlt  ociltlaDum( s;u4 eenif oy1lmt aiei (0 rtrirpiodap e nvsls)a2tax  ou0aet mf3iytfa ulu p t0artnir3oadomtr neils srxoir3iu4llt mfct s)aDtr( o;u1alt if3iysls el( pnt)tlxrxr3oodop  anvs;( srumxr oy4lp nlnesltf rtm(rp;u0altoiiciydfm uan p t0texnmrcoa1lmDeaueilt) eurim iudlleelfvia() Dtmuronu1tlx  i3tltlaDrl(vsnu4tlxnxo iatfmtr ivo s)s2toirpiy1apenlfeils  Dtr( pot1oleomo3tasls ea(ms;t0trtrxr iodomD au ol( trtoiopny1oltnmnvtas)aruaurpot4olxoioetasfa rmnvp (4 rxnircoatfmteli ilt0t2xm(mpoudape licias sDumxr no4olenmf3iys aDumnms (0texoir oo1fptelu s ( t2xm(m iy1op emfcia(  ruaxrpno4aet iociydfsDuan s;t0aexrio todoaDrlueo (  etoxmpny1ll elnctas s2uaxm nt1tlxnioeils a2emumsnu0trtnxfcio1oa  anvi;s)t2xoxo iy1olenmnes ( srur(  ot4teeoiiciat a2ua( onu4 rtnmo3iy1lm rau ils seumxo3iu1apt  icsa( arta(roou1tpt miciyt m2el(msn(4tlxrmr ootfptraneolt0s2tmxo nodoptnlneiasfsDua(mpno0aexo ietltlm rlnmpn(0trtnifcoydlpt anvs ()t2tr(o no4open ncsl()a2uaurpnt1oexomfctyd aDelu pnt4tlenxf ty1optrlivo ()t2xoxm nu4ope livs sfaDtr(r nt4tex io3tys s2ea(vo u4aexrxr iydfm  luvs;s0texmxr3oo4op emneta( artmx o;o1olxoioetlsfaDrm(msnu0 eerio tadfp  aivsl(  rxmxr oy4apee iei ( arrrx  oo4oetoiietat aDrm(mpn() eenmfcoatlmt  nes;(0sruoxrpiu4am n netl(farua(mpou0apenmoetat sDeauvon(4aeerir3totoaDe uvs s)teum(opou4lm  lictlsf 2umxm ;o1oee  oetad sDulump;u)aexrmociodlpt  u ilt)srtrxrpio1lm nmneilt)a2rr(r no4oltomfctas s2ul(vo;()arxoxr tytlmt au i;t0 rum(m3ou1ap emivtls)aDrrx  ;t1texnmictadfmDemu s (0 exrircio1latrauei;(0 eum(rpnodam  lfvilt)srumx oou0tpt  octls m emnvs (4 etrxr oatlpteluvs s) 2umxr3nudop emnesa( a2ta(ronu4oee mociasfm2rln o t) ltrmr oo1lat anvols) 2xoxo3nydlpte feils)arrmur ;u4alenmf3iytfa2rl( p;(0 lxrxr3tydlaD  ivil( trxoim3nu4amtemiei t)s2tmu  ;o4apxnifeiadla uan p ()alenmr3oydoptran i () etmxrpny1lm  mnvi t) rumxr ;u4aleo f3iytls2uanvs (0 etnio iatfp rau s t) rum(o no1lle lfvils) rtr(m nu0tlxo oetydlm2um(mp;u) rxnio3oo1optean s (  exrxopou4lpt lfvtlsfsrra(r nu4oet if3ilsls2raums u0 lxrif3tadlmDr u s;(  2xmxo3ny1amtelfetl(  Dtrur ot1tleoio3ild s2eau pn()texrmr iodlmDe n o (0t2trxo ny1optemictat s2urxmpou1tpx  ocildfm2uan pnt4 rtrxf3tydoa r ies;s)t2umimpiu4omenlietas)sDtmu pno1aleomiciydfsDua( snt)alxnmo3oadlm   i o t  rur(rpio4openmnctlt arrmum oo4aexomoetat m um(vs ()areomf3tadlmDran o t texrxopoodoptnmiciat s2rm( ont4olx  ocildlmDean o;u0 lenxf iotopD lu sls)t2umim nu1aleemies ()srtaxm no1aetnmfeils sDul(vo;u4aleoxfcoatfaDeaneslt  etrim iy4amtemictls) Dtrx o;u0olenmfeilslm el( o;() etnmfciatopDelnesls0 rto(o3oo4amenlicil(fsrtrumooo1aexnioeilt m2emn ont0 eenirciadlaDr i o t t2uo(r3iy4lmeelnetlsfsDrrumo;o4olto fetlsla uanvp;t0treomf3iadfmteai o;t)s2xmxo3nudll   neil(f rrrx  ou0optn ietls mDea(ms (4tlxnio3tatlp e uvi t)texo(m ou1ll  miviat a2tmx  ;t1alt mfeiat a el(mo;u0altnirciytlptrlueo;s0srumxo iudame  nctlt s2ta( oou4tlxn fciltlm ulu snu0arenxo todfa  aiesl()trtmir nu4lpeelfvil()s2uru  ot0opx  ictlt mDemuvsn()arxrxocio1faDraues s seto(rpio1lp e nei s) Dtru p;o1alxnmictaslaDranmsnu)alxoxfcia1op r nvsl(0trxrim ou1om n fetat sDuax ont4opxnioctldlaDranvs;()alermocoa1fpt auvo t) 2trim3oodoltnmncs t) ruax o;t0oexo oeiytfm2ul(vp;t4areoxr3tatoa rlnesl(  ruo(o3iy1om   netl(fsrtmumpnu1alxo o3tys a uau o u) rxoifcoytlpDeaivi (0truoxrpoo1om e fci ( aDuaxm ;o0alx  o3tadfsDeauvon(4 exrmrciytop raivs;(0 rumiopiy1am   icsa()aDua(rp;o4aetnmi3tlslm2rlumonu0texrxo3ta1oa  luvs ( srurim3nu4lmen nvsat  rtaumono1opxniociltfs2ul(vs;u4 renxo iydlp r ueolt0 etrirpno1lpenmieiasfa2tax p;t1oeen i3tlt a2uanmp t4 etnif3todfpD lieo s0teur(r3iu4oltemnei t srumur nu1aee iieiatla rlumo;u) exnxrciytomDeln s;(0teum(o iy1ol   fvs t srraum ;o4tltnio3tadfs ran pnu)alenio iadfm rauvi;s  etoxmpoy4om nmfvt (f rrr(rpnu0apt mietysls2uanmp u)tleoiocoodomtrlivs (  rur(o ny1llenliciltfarraurp;o4olt io3iaslaDulnmsnu4arenxfcoatomtrauesls t2xrirpoudam n nei t) Dra(mo;o0tetnmi3iatls ul( o u)aexrxf3oa1lpteaiei () rtmxo ny1ameeliet (fs2rmxrp;u4altnifeiad s emn s;() ltnmf3oa1fp eln slt tetmxm no1alt  fviatf 2rr(rpno1texnifctatfm ul(ms u0trxoif iytop rln sls)trurxrpoy4omen ivsat srurum ot1oltoifciadfm emuvpnu)texrio iadop eaivs (  etoxrpou1op nmietl( a2rm( oou4tex mfetat a rluvo ()tlxomo3tadlmtr ueils) euoxo3nu1llenlnetl( arrmurp;t1altn ieild m rluvs t) rermociodomte n s t  ruriopnu4ll  mncsat)aDra(mono1aexniicils a el(vs (0alerio oo1fp ranei s seuoxo3oy1lmt licsl(farrm(mpnt0alxoii3iaslm uanmpn()tlxnxo3tytoatrlneo s s2tm(m3ou1llenmnvtas  rtaurpou4oleo feias s rln p (4arxrxr3to1oatean s (0t2uo(rpiu4lp nlnesl(f ruaxmont4opx  fciyt aDulu o;u0tlermr tydopDean o;()trxmir ou1opeemfcsas arrrx pno4apxo fciat s2ranmsn(0arenmr3ootfm e u sls0trurxm3io4lm nlfcilt artrxm ;o4tet  fciyt aDrmnvp;t0 etomocoa1om rau o;s0setmxo3iy1lpee feia(fs2tm(rooo0olx  ictld mDrauvp;u4tetnir3tatla e u s t t2tmxrpnu1lme lnvs ( a2raumoou0aetomi3iltfaDeau s;()trerircoa1fmtelnei;() ruo(opiy1am  mfctls) rtaxront1aexoifctat s rl(msnu4 ltomo oadopD lnvi ()teuoir no1ameemivs sfs2umxmpnt4tetoiieiltlaDumnmpnu4trenif io1lmt  i sl(0 rum(r iu1opeemfciltfaDur(m ;u1tpxomi3iadfmDemu o;()arerxf3oadlp eln o;s  ruoimpoudlpt mfesasf rurxm ;u4aetomfeiyt m um( s;u4 rxrmr to1la eluvo (  euoxrpiy1oleemfci t srur(mo;t4olxomfcilslaDea(vs;() rxoxo3iatfmDelieilt0 2uo(r3io4ope mictat)s2ra( p;t1opxn i3iasla2elnmo;t4tlenmf3totfpt  ieol(0trxm(r iu4lp   fvtlt) Dtmx poo4aex  ocias mDrau s;u0 lenxfcootlp  auvols0 rxr(o oy1olt lietat s2tru ooo1aee ii3iad a2elu onu4 lermf3oydfm e nvi;() 2xmxmpiu1lmtelivtas) rtru  nt1tlx iictysfa2rl(mp t)arxnxfciy1la elnvi;t)s2uoxr oo1omtn fet s aDuaxront0tpt  o3iydfaDem(mpnu4artnio oy1omtr i i;(0 2to(opiy1ameelnvtls)s2tmurpno4olx mociasfm2uanvo;u4aeerxf3to1fa elies;(0 rtmxo io4olt livtls)arum( pnu1tpe  ociatlmDranvs t0trerxf3iodlaDe ueo;t) rxoir3nydom elfvilt  Dtaxm oo4tptnii3tlslsDra( o ()tetnif iodfp  lues;t0seum(m no4lltelictas)a2umu ont0olx mfeiltlm2eluvs;u0 eenxf3ta1opDe neo;()seurxr oo1ap elfes tf ruax oou1tlx  o3ias s2uanvp;(0tltomr3oy1omtr i o ()teur(o ou1lp nmietltfsrra(mpno1olto fctldlm eaump u)tlxrio iytlpt aieo;t)texoim3nu1apenlnesat srtmxrooo1olxn f3tasfa rln sn(4 rxrio3oydopD luvs t  etmio3ny4olen iesls  rtr( o;u4aee ioetatfm2rm( p u)treomfciy1fmD  n s (0sexoio3ny1lle lncsat arrr(moot1oet ioeiyt sDelnvp;(0arxoio ta1oa rlivsl(0s2um(m3iydalee fetat  ruaurp;u1ole iocias m2ranmp;u0arerxo3totlpD livo;()teuoimpou4am   nvtasfsDum(m ;t4ole mo3tlsfaDrauvon(0 ltnif3to1fatrlivs (0teuoim3no1lmen neiat  2rau p;u1alxomf3tatls uan snt)tlxnmf iodopt  ieo;s) rxmxo iudll   ncsltfarrrum no4tex  f3iyd a umu p u0 rermfciotoa r uei s0s2uo(m oy1oltn nciasf 2uaxmp;t1olt iocild aDum(vs;u4aexrmo iytfm rauvi t) 2tr(m oy1opeelieiat)a2rm(r nu0optn ietasfm rl(vp;u)tetrio oytop   uvo;t0t2uoxm3oodolen icia(fsDtrump;t4olenmfetatlm uan pn(0 lermrcto1fp  lies;t)t2toiopiy4lltemnvtl()a2ta(rooo4aetoif3iad s rmu pn(0 rxrio3iydlp  lu ols0trtm(rpno4lpeemictls)arrau  ou4tlen feiasfs eluvpnu) lxoxf oadfpteln s s) eurxopoudop n fvi s a2raxm ot1aleoio3iad m2el(msn(0 eeomf3ta1la e uvolt)trxo(m3nydlpt mivi (fs2taxrpno0tpxniictaslm rmnvsnt4texoxr tatlm ean i s) rumxopoo1lpe mici (  Dra(mpnu0ope  oeiytlsDumuvs;(0 etnxr oydfa   u o;(0sexrxr io1om  mivi sfsruau pno4oeeoifciys a2ulnmpnt0tlxrxf iytoa elu olt)sexoxrpoo1ale  fcils) rua( ono0apxomf3iytfs2uln snt)tltomr tadfm  lnei;s) rxrxr3iy1lpe mietas sDumump;u0aexnmiciadfmDemuvpn() exrioctotla rlieo;( texr(r ou4lpenlfetat aruaxmont0tltn fcias m em(mpnt)arxnio3oatlp eau i s0s2urxm iydaleemnvsat  rtmuronu4texomfcilt a emu pn()tlxrxfcoo1fmD au olt srtr(opiy1optnlfeiatfsrum(  ou4altoiictad mDuluvp u0altoif3todfmte i o;()truoxr3no1ap nmietas  rra(rpno4opt  o3iyd aDrl(vp;t0 rxoio iy1fp rlivsl( trurir oo4ol nmneslsfs2umurpno0opt  feiasfa um(vsnu)tetrmf3ta1fa  lu s s0t2xoxr iodam nlivtlsf rum(mpno4apen ictld m2ean pn(4 lermociy1oa e n o s) rurio no1llte fvsa(f Dtaxr ;t1apen ocildfm2eluvpnu0aleoio3oytopteaieols0srxmxrpno4aptemneslsf 2urum ou1apt io3iyd a2umuvs () rtrxr3iytom eai il( s2tmio3ny4lleeliet s) rrru p;t1tpeoifctat aDua( o u4 lxoxfciadlat lieol( t2xoxm3iydoltn icsas s2rr(ro;u4olto fcilsfa rl( o u0alxnio todfat aivilt  2urim oo1olteliesat)a2ur(  nt0tpxomictad mDran ont) eeomo3tadfp rauei ( sexrirpoydop nlivsls srtmu o;t0aetnifciatlsDraump t4tleomf3oo1laDrai ilt) rtmxrpio1omeelnesatf Dtrum ot1alxnmoetasla ul( o;(0aeenir oodfpDeanvslt)srxm(r3oudlmeelfet () Dta(rooo4ole if3ilt s2elnmo;u0trtnmf oodfp eluvo ( texoxmpiodal nlfcils aDurump;o4oltnmfctltlm2uluvont) etnio iadlp elieolt srumim iu4ll n ncs (f Durxmp;o4tpe  ietat m rmn on(4 rtnxo oydlpteln ol()tetmiopou4lp  lnvs s a2rrx poo0olxo i3tat a2emuvsnu4tetomfcto1fpDr uesls0setmxo iu1ap emfvt tfsDtrx  ;o1tee ifeildla2umuvsnt0treoif3iy1fm eauei () exmirpiu1omteliet tfsDtrumont0oltnmo3iysfs2elu p;(0aexnmrcoy1fatranei s  etrxmpio1lme livsat  2tau  nu1apxn o3iydfm ulumo;u)artoif iy1fptrauvo;(0teur(r3oy1llt mietl(fsrrmxro;u1openioctysla2eluvp t)artoxr3tadfp e ies;s)s2tm(o3io4ole  fcil( aDuru  ot0tpx mieiadls2ra(ms;t4aleoxrctadfatrai o;t0 rxmxopoo4lpe mfvslt sDrax  ;u1oltomf3iltla ulu s;t0aexnmocoydlmtelivo t) rurxm3nydap nmfcs tfarrm(ro;t0olen o3iadla2rmu s;t)aetrxf3oo1fpte neo;t tetoim oy1oltnmiesa(faDrax ooo1aleomietyd m um(vsnu0trtoif3oa1op rlueo s)sexrim3iydlmte fvil() Duaxro;t1opxnmieiyt sDelu pnu)trxoxfcoa1laD luvsl()t2xmxopoy4ap  lfet s)s2rr( ono0opeoiieiltlsDemu snt4 lxoxf3to1fpDe i i t0 etm(m3nu4lpt lneia(f 2ta( pno0tlt ii3ias m ua(vo;()aleoxfciodoaD livs;(0trum(r nu4apeemnetl( srra(monu1tpxo i3iytfmDul(msnt) rxnirctytlmt anvo;(  rxoir io1om  mivsltfaDurumpot1ale iociydfs2eln s ()teeoxf3oatlmt li o;s0texrir3oy4ole miviat) Durxrp;o0oet if3tadls ea( s;(4aexoxf3iatlate neo s  ruoim3oudll   icilsfs2tmxro;u4olx iocils mDum( s;(4 lermo iydfpt  iesl(0t2xmxr3oudoltemivtls  Drru pot4apenioetld s2emuvp u) eenxf to1lm elnvolt0 rumio oo4llt  fct t)s2ra(mpno4apx iieiadlm uau p;(0tlxoxr ia1fmD ai i;s setr(r3ny4lmt lfesltfaDum(rpou1texoifciatlaDeanmpnt0aeenmo3oatfpt li il( trtmio3ou1opt  iciasfaDrrxm nt0oetnii3ildls2umn o;u4 rxnmo3oo1om r neslt0srtr(mpnu4am nmnciltfsDurxmp;u0olx  feiadfm ea( s;(0 etrif ta1opDeai o;s  rxo(o iu4optnlfctas)s2uaum nu0tpeomictysfaDuau o u)altoxocio1opD  u o t  rumxr3iu4amenmicsasfarurumo;t1aptnmieiatlmDemuvo;u4aexnifcoodfa   uei s0 rxrim iy4ll elfct (faDtr(ro;t0texn feildla rmu on(4 exoio3ta1laDelies s) rto(r iy4lleelfet tfs2ta(rp;u1alen f3iltlsDran pnu4teenmf ia1fat anes;t)texmim nodaptelnes sfsDtaur ;t0optomi3iltfaDrmnvo;()tltnxrctydfatrau sls0 rxoim3nodalenmiei t) 2trxmpoo1tpx ioctydfmDrluvsnt4altoxocoodop e ieols)setm(o3oo1al eliet (f 2rrur ;o0apto ieiadlm eanmp;() rtrxr to1fa r ivsl( tetm(mpou4llte ict ()sDtrx ooo0apen icilsla em( snt4 rermr ootlptraivils teuo(o nudlp  lneia()s2rr(rpot0ole mieiatlaDeaumo u)alxrmocoa1omDeai olt0t2toxm iudop nlfciat  Drrxm ou4tlx  o3ild s2ra( o (0alenif oa1oa   ivo;t  rumim iy4aptn ieilsf Draxr oo1tpxomi3tytfs rmn pnt0tltnif3iy1lm   n o s)trxmxo no4aleemnctat sDtaumo;t4aptnmoeiyd a ranvpnt)tltnxfciytfmtelnvo;()s2uo(mpnu1omeemfei t  2umumono4tetomoeiyd a emumo;t4 rtoxo3oadopDelueil() rxoxr iydomtelfci (fsrrmxrpnu1olxniieilsfsDeauvpnt)tetrif to1la eaues s)trxoio3oo4altemfes s sDurx p;t4aeeo o3iasls ran pn() rtoif3oo1faDrlu ils)sexrxopoo1ome lfvtls a2raum nu4olen iciytfaDuanmo;(0arenxociydoatr i s t texmir3io1olte nctas  Durur oo4texoiieiatfsDelu s;t0altoircoatfp e nvs;s0 2um(r3oo1open ici () Drr(r ;t4oetnmfeias m2rau s;t4trxoxr3ia1omtrluvils)setmir3iodlmeelnvi sfartrx pnt1oltniieiysla2el( o;t0 rermr iytlaDeli i;s)teuoio3ou1lmt  nviat  rtrxr ;u4tpe  oetyt mDua(vp;u) ltnircoy1fate u sl() rxr(r oo4al elnvils)s2raur ou1opeoii3iasfs2rm( o;u4arenio3tatlaD luvs;s tetmim ny1optelfviatfs2rau  ;o4oetnmoeiadfmDuau pn() leomr totopDrli o;( t2trxm3no1amtn fvslt) Drmx o;t1tleomo3tas mDum(vont4aetoiocto1fm  ai o s0trurxm3ny4amtn fvt (fartaum nt0tetnmocilt s2ul(vonu0tlxnxo tytfa elnvo () 2um(o3oo4lptelfcsltf rtau  ;t1oeeoiietydfaDrl(mo u)teeoxf3oo1lp  livo;t0s2toir3io1lptelictls  2raxro;o0tlx ifciat m2ulumo u4 rxnmo3oo1fmt luei;s0 2xo(o3oodolenmnvi (f 2rrxmono4aet mfciyd s um( o;(4tetnio3oodop eaieols0 2xrimpiydam nmicil(faDtrumpoo0oleoioeiyt a2rl(monu)teenxo3oy1op r u s;()srxmimpnu1lp emfci t  rum(mo;o0tetoifetadfsDra(ms;u4aleoir3tadlpte ivol() etmxopio4apt  nvta( a2tmxrp;t1teeo fctld a2rlnvonu) ltrio ia1lpD lnei (0teurxr3io4ape mivil()a2tax  oo4tlen oeild a2rl( o;u4arxniociytlpt aieo;s)t2trir3ny4ameemfctlsfaruax pot1apx  ietlsls em( p;()artrxfcoydfpD luvo;()sexo(r nu4apee fetas) Dua( pnt1tpto oeils m2elu p u)arxnio iatfp eauvo t0t2uoiopno1ame mncil(fsDtruroot0tltnifeiys aDrl( s t0teeomo3tytfmt  ies s)sruo(o iudlltnlncsa(  rtmx  ;o1tlxo o3tadlm2ran o;t)tltnmrcoa1fmt  ues;( srxrimpno1lm  mnesls  Dtr(mono1tpxn feias sDuln p;()trxnmo todomDeaivi s srtrxopnudalte ictlt a2uau ont1opeo iciltfmDrl( sn() ltoxfciatlaDranvo;( t2ur(o3ny1lmtnliet t)sDrau  nu1tlx moctlsla2rm(msnu)texnxo3iodlpDr i s t seuo(m iydamee nvsls) Dtm(rp;o1aexnio3tadfsDem( s;(0 reomr3oodomDrauei;() rtm(o oodameelivsas aDtauro;t1tltniociytlmDeln pn()teermr3oodfate ueo;t  2xmiopiy1amt  nes s  Dra(  ;o1aptomociysls2elnvsnt0 etomrcoadlp e nes;t  ruoxo nudlmenmfcta(  rur(r nt0apen oeiasfs rlnvs;t) etnio oatopDrlneo;t0srxr(o ny4altelfeiltfaDraum ;u0texomicild m ul(mont0arxomf ta1laD anvi;( setr(m oydll   ivil() 2ta( ono0texomietadfsDul(mp;u)tlxrxo oytopte uvo t  rtoxm nodol emfcsatfs2um(mp;o4oexoif3iadlm ulu o t4tetomr oatfm eaivs;t)texrxr3iy4am emneias)arraxro;t0tpx mfeildls2emuvsnu4 rtrmo3io1lp   nvi t0 eur(r no4lmtn ieil()s2um( oot0oltnmo3tat a2eau snu) lxnif3tadopDe iesl()s2xrxr3oo4alee nei s)arum(mont1tle  ictlslaDulu p t4 lenxr oytla r ivs;(  2urxm oudlptnmfeilt sDtrxmp;u4texomf3ilsfsDra(vs;u0altnxf tydfat aieilt)trurxmpoodalee fvsasfa2um(mpou0ope  ociydla2rm(mo (0arenmfctydomD ln o t t2urxm3ny4lmenlneilsfs2rmumo;u0tptn i3iyslaDra(vp;t0arxrmfcto1om eai i;t0truoxo3io1aptnlictlt  rtm(mooo0teeomf3tatfs2ra(vp t0aetrxf oadopDe ivo;s)trtm(opiydaltelfetlt)arra(  ;t4oetnmo3ilsfa em(mo;u0altoir oa1fm  aivi;t0 eurio ny1ap nlfvs (f Dtmxrp;t1oet io3iaslm2raumo (0 rtrmocoytom  auvs s0 rur(opoo4ale mnvt sfsruru ooo4tpx moeilsfs umu o;t0trtnxo3oatfpDe nvo;t0teurim3no4olee nes t s2tmxr ;t0olxn o3taslm2umuvs t) renxfcoa1laDr uvi s)trtoxo3ou4omeemfci s aDumxmpnt4open o3iydfmDuan o;u4trtrmo3ta1faDeau s;s0trto(r3iy4ope mics t  rtmu o;u0tpeomi3ildla2uluvpnt0tltnir3tytfaDelueils0t2xr(m io4op nlneia( s2tmxm nt1aexnifciad m2ean pnu)aexnio iadfa ean il(0s2tmimpoy1lltnmivsl(f 2urumonu0alt  ieiydfa2raums (0 rtrmo3totfmD auei;t) 2xmxm oudap nlivsltfarumxmoou1opeo icilsfa2ran o u4artnir3tadfaDran s t  2umxo3oudlm nlnet (farur(mont0tlxo icild m2umu o;u)tlxnmrctadlmDrlnes (0sexr(mpiodomte ncta( sDuau  no1tlto octydfsDel(mp;(0 rxrxrciydlat  uvol(  exmio3no4lp   ivi tfs2trum ;o4tetnmoetysfm2rauvp;u4 exnmf tytopDeluvo t  etmimpoy1alt mivilt)srumx  oo4opxnmfciydfa2rl( on() exnxfciotlp e i i;s0t2uoxm io4olenmnesasf 2um( o;o4tpxo f3tyslm2rauvo (0artrmrctodoa  aies;t  etm(o nu1open nei (fsDurx pno0tlx io3ias mDuanvs;t4tltnmrcia1fp r i s;t0 2ur(r nodap nmfvsls)srrax p;t4tlxomietydfa2ranvs ()alxoxo3oydoaDeauei ()trxmxo iu4lp nmncsa( aDurur ot0tpxomfciysfs rm(mp;t4aetnir3iadfpteauei;s)tetrxo oodlp elfvtls a2ra(m ;u1tleomictadfs2ul(vpnt4 exrmr3tadlaDr nes;( s2xr(opoy1optnlfci s)s2umxmp;t4aexomo3tyd s umuvp u4trxnmf3to1op  lu o s)srxr(opnu4lltelncslsfa2umxmooo0alxomo3ias a um(mpnu) rxoiocia1lpD auesls s2uo(r3iu4altnlfvi ()artmump;t0olxnmfctyt a umn pnu4tltrmr oytlmD au i s  2uo(m3nu4lpen fvi (fs2rrxrp;t1alxnifetyt a emnmo u) reoxo3io1fpt lnvo;()trurxopnydol nmivtatfsrta( p;u1olto i3iydlsDrm( o u0 eeoif3iytop  lnvi;(  exr(o3oydllenmivs sf 2rrum no1alenii3iatlsDrlnmp t4tlermf ia1lmt  nes;s0srumimpny4lmte ncilt)s2urxrpno0aet  fciys s uanmpnu0 rxoxf3ootlmDrluvi (0trurio3ou1am   ict (fsDrrxr ou4tleomo3tltla em(ms;u0tleoir ootfm raiei;s)t2xmxo3ny4aptn fcias)aDtax oou0olx  o3iasfsDrmump;()alerif3oo1op rluvils0truoxm3oydapeemfetl(fa2rrurpou4apxnmfcilslsDuaumo;u) rtrmr3oatfpt  u o;t sexmxopnu1om  licias)srrmumoot0tpeoif3tydfa eaumpn(0aetoxf iydlpD luvolt0s2ur(opnu4lme  fci t a2umxm nu4opxo oeiytfsDrln s;u0 exrmoctytlpD lueil(0 eurimpiy1lpeelfctlsfarrax o;t1optomociysls2umu o u) ltomrciodfa rauvols t2uoirpoo4ameelfvs t s2tr(mpnu1aet micilsfa rlnmp u4trtomo3oatopD aieo;s)t2xrxrpou1ole  fvi tf 2umxm ;o0olxnmfeiysfm emu snu0trtoio iy1opt lues s0 exrir oydapenlicil() Dua(mpno0tee mfeiatfs2rmumon(4aeeniocta1fp  liei;t t2uoxopoy4ale licils arurum ;o0alenioeiaslsDeauvo () lenmfctydomDr u o s)trtrxrpiy4omtelivta() 2tmx onu0apt  ietasfm2ul( o;t4 exnxr3to1fmDelivil(0 rumio3nu1omt lfvsa(fs2umxmpoo1apeoio3ilsfa2rlnmo u4arxnmrctatfaDrluvols s2um(m nydalen ncsasfa2umu  ;o0open ietyd aDulnmont)treriocia1fm e nvilt0 exmxr3no1olenlnctls)srtr(r ot0tetomociasfs emu onu4trxrif3todfmtr ieilt0teto(m3oudomtelfcil() Dtmu pot4apenifeiasfs rlnms;t4alxoxo3iadlmteanei ( sexoir iy4lm  lies tfaDumxmp;u0apt ifetyd a uaumo;t0teeomr3iatlm rlivs () exo(o3oo1lp elnesa() 2tru ont4optoiiciad m2ea( sn(4arxrifcio1fmDeanei;()srxrxrpoo1optemicils)sDrmx oou4tle mf3tls a2ranvonu0tlermo iotlat lneol(0s2to(mpnu1ol e fvslsfsrtr(  ;u0aetomfeiytfmDrmn pnt0 rtnifctotfmDe uvo t)trumxrpiy1lpe  ivtl(fsrur(rp;u1tpenmo3tas m rmumpn(4trtrmfciytlaDeau ol(0srxoxopiydaltnlivsls)srrruroot0openmoctyt sDeau sn(0 ltoxociodfpDranei;t)teum(o3nodap  lnvs tf rum(m oo4oeenmieiydlm uluvs u4trxnioctadlptrlnvo;( teurxm iy1lpe livias) 2tau pou0ale  iciydlsDulnmp u4trtnxo3oo1fmDeanei s0s2xo(rpoudomtelivsl(farur(rp;u0ale moetas m2emn sn(4aleoifciatoat livs ( seuoir3ou4olenlieta(f Dur(r ;o4tlenio3tas s ul(mo t)trtrxr tydfaDeanesls)trxr(r3oy4op  lfciatfa2tm(mooo1tpxnmoetyt s ean sn(0 lxrif3ootfm  ai s;s)t2uo(r no4om  micsl()sDtru ont1opxnmoeiytla ra( p;t) ltrmo iy1laDeai s;s0 2toimpnu1om nlnet (  rumump;u0apxoio3iatfsDum(mo;t4trtoir3iy1fat lnvil()truo(o oo1omeemiesas)a2raur ot0ole  ociadfaDrlnmonu) eenifctadfaDr uvol()s2xoxopiydapeelfetat artaurpou4opx if3ildlmDumuvo u4tetnmr3oa1lat an s;(0srtrio3oydapeemici t)sDtaxr ou1oleomicild s2rmums u) ltnirctydlpt aivs;() etmxm3no4lleelfciasfsrra(m oo0tlxnmieiaslm2uauvo;u0 rerio oytfat  i s;s0srxo(o oudame  fei t)artr(mont4altn oetltlaDeanvs t4teenif ty1fatelu il(0 rxrir3oo4alte ict sfs2trx onu4tlxoioeildla rln p t)artrircoodomte i slt)s2toxo iu4al elict tf 2tmxront0tpt  o3iysfm rau on(0 etoxf io1fmtean o t0trtmir io4ame lfeiat  ruaur ;u0oexoif3tls a rmumo t) renir to1lmDeliei;t)truoxo no1apee ncta( srumum oo4ole mictldfmDulumsnt0 rxoir3to1omDrai i;s0seuoio nydlltnlnvtls) rtaur ot0ale  o3ildla emuvsnt0trtomf3tadopDean i ( tetm(o3oy1ll nlicsat)sDurxmpou0alt if3iysla2umums;u)tetrmo ia1fpt anvsls0texrirpoydoptnlnciat)s2uaurp;u0tlto fciltfaDumnmp;u4aetnir tadomteaivs (0s2ur(mpoydaltnmnct s artrurp;u1oet  f3iyt a2rln sn(4trerxo iodlp   nes s)sexriopou1lp nmivtlsf 2ur(  ou4tex mf3tatfsDrm(msn(0aetnifciadlmt lnvs t0 rxoxr nu4amen nesat)sDraxmp;u4oex  fciad aDeanmsnu4artnmr oodla eln i;(0t2trim3oy4optnmictlt) Dumxro;u4aetnifciatfmDrlnmp;t)tlxoifcoa1lmDrlnvo t)s2to(rpoy4op elivta()artaum nu4tpeoiociyt s2uaums;t) exriociy1fmteaivs;(0t2xrimpiodlmtnlivilt aDta( poo1tlxnmoctltfm ranvs (4artomrcto1fmDrluvo;t  2tmxrpiudol elfciat arum(mo;o0tltnmiciad a rm(vpn()arxrmf3todlmDrlnvo;()srto(o3iudal  mnct tfsrrrxm nt0tlxomictldla uaumpn()arerif3iytlmDrluvsl(0t2toxm nudol emici s)sDururo;t1tltn i3iltfs um(vs u)areoxf tytoptean o ()t2to(rpoo4alenmiei sfsDuaxmonu0oltomi3tys mDelu p t0 renxo iytoaDeluvi;(0t2xoxm3oudlpt lfcslt s2raurono0apt  f3tad mDeaumsnu4 eenxo iytlpD luei;s  2um(m3no1lm emfvi () Drm(  nu4opto o3tys m2em(mp (4tlxrxo3iotom r ueo t0texoxr3oydol   fei t)arrr(mpot1tltnifctytfmDul(von(4trenio oadlpDeauvs;(  2tmio nudlmee nvtls srra(  ot4apenmieiatls2ran pnt)tetrif3to1lmtr i olt)seuoir3nodam  mfvtl(fs2umxr ou1tee mfetytls2ua(vsn() rxrxf3oy1la rlu olt0 ruo(rpnodom nlnei tf 2tmuro;o1tpe mociys a2emnmo;t0texnif3iydlm  an i;s sexo(o3oy1lmeelicsl(faDtmx pno1oee  oeiydfs2umn s;u0aeerxfcto1fm eln sl() rxmxopiu1aptelnvslsf rtmumono1aexnif3tydfs2ran p ()trxrxf3oatfp rlnes;s) rtm(mpio1alt mnvtl(f rrru pou0oexo feiyd sDea( s ()tltnmfctatlp  lnei;s s2xrir io1lp nmnetls)artr(mont0opto ietatla2uau pnt)trtnxf3ta1lmtr ieo;s)t2uo(r ou4ol nlnctltfsrrau o;t1aptnif3iyslaDuau o;t0aetoxociytfaD  n o;s0t2xmio3iu1lm nmnet () Duau onu0tpeoiiciytfa rm( snu0 lxoircoa1oa eli o;t)t2xoir nudlm nlfcsltfarrruro;o4olenmietltlaDranmont0artoif iydla  anvo;()teumxo nu1ap   fes sfa2uau oou4oexoioctydfaDem(vo u0tlermo oydfpD ai s;s)teuoim3iydlle mivtl(faDuax  ;t1oexnmi3iytfs eln s;t4 eenxf todfate ueo;t  rto(opiudome lfetat)s2rru p;u1ope  fetydlaDeluvsnu0 eenircio1lm eluvolt srxoir3nydape  ictlsfsDuax  ou1olenmfctadfmDuan p;u0aetrmr iotoatr nvo t0sruoxopiydapeelfcias  rurxmp;o1oet iocilsls umn o t0 lxomocty1fm e nes;()srur(opio4open nvia() ruaump;o0alenmi3tld m2el( o;(4alxoir3tatfateaieslt) 2to(m nydll   fcs s  rtmump;u4aetn oeiat sDranvo u0texoif3oy1oa  luvols)t2urio3oy1ole  ictl( a2tmuroot1tpeoiietltlsDulumo;(0arxnxr3iodlm   ivi;(0srxo(o3oo4omt mfei s  2ta(rp;o4olxnmfciyd aDuau p u4aeerio3tatfmt anvs s  2tmirpoydlpe mfesa()arurxrp;o4tpt mociydfmDrlu pnu4tlenxr3ta1fa eauei t  2trxo iodaltemfci s sDrmu  ot4tpt io3tls aDrluvs;() eeomf3oytlm rln i;s0srxmxrpiu1omee nviatfarrrumpoo4ape mf3iltfm2eln o t4 lxoxfcoa1op rlieo;t0srxr(m iydoptelnet s arraxm ou0aetnmoetatls2emumo;t0trxnmo3oodlptraueo;t0 2uoxm no4ap n fcil(f Dtmxr nu0aeeniiciytls eaump u0 rtoifctotomtr nvs (  2tm(r ou1olenmics (  Dra(r no4aee  oetadlsDuaums;u4trtrir3ty1op r n ils  rtr(mpou4amt mnctatf Dur(rpoo0tleo fciltfa2rau s;u)aleniociotfa  aieol(0srtoxo oo4lmenmfei s  Draump;t1olxnmi3tys a elnmonu0altnmo to1lmt lnesl()t2xo(m3nudaltelivs s)a2taur ;t4tex moetlsfaDeauvpnt0artnmo3oadlp rlivs;t)teurxmpiydale liesa() ruaumoot4apx mfeilt s2uln s;(4arenif iodlp  lneo;s seurxm3iodll   icias sruax pou4tle moeiat m2el(monu) rtnircoodoa   neil()s2xrxmpiydam   nci t)artaum ;t4tltn f3iat a em(mo;u0 etnmr3oatfa  ln s;(0trxo(r3iudllenmfesls)aDrau p;u0opt iiciltfsDuln s;u) etrxr3oo1late ieo;t0texrxr3no4ameelnvils a2urxrpnt0opxoifetyslm2ul(mp;(4teermf3iadomteau ilt) 2urxopiu1apt livils)srurxmp;o1oexoif3iatlmDemu p (0aexnmf tatfmD  ues;s)teuoxrpou4lpeelfcs s)srumx p;o1tlxo ocias a rmn onu4tlxnircoatlm elivs;t  2uo(rpnu1lpee feilt)srtaxmpnu4texn ieiadls uanmo;t0alxoir3to1opD anvs t0tetrir3nodllenmiet t)sDrrur ou4tpe miciadls2emn sn(0aexoio to1oa e uvo;(0 ruo(m ny4lpe liciasfs2tru pou1olxoif3tadlaDua( o;u)arxomrctytfmtranvil()srumio3oydapte nvil()a2ur( pou0oet mocildlsDul( p;()aexnmo3iatlptean o;t0t2xr(m3iu4amenmnetatf rra(rp;o0tpx mociytls2umuvo t0altnmf3ia1lpDelnvi ()setr(mpno4op nmivi ()aDrm(mpot1tpt ii3ilsla ul(vs;()texrio oydoa rluvo s0s2tmimpno4lme  neil()a2tmxmpou0ape  o3ildfm2el(vont0teenio3oadoa   uei t s2xrir iu1omtnlictasfsDururonu0oex if3tlsfa2eanvs t)texnirciatlm   ueslt0srxmxrpnu1lle  ieia( a2uau  nu0teeomictyd m2ul( p t0alxnmfciytlaDrlu olt  2urir3nodape  fvsa()s2tmu oou0texomo3ildla ranms;u0 ltrxf todom  lnei;t) rxmim oo1op e ncs s sruru  ot1tptn oetadfs2ua(vont4alxrxoctatlm rlnvi;(0 etm(m ny1openmiesl()s2ta(roou1olen oetlsfmDrmn s;u) rxomf iy1fmtelu o ()srxrir nydamte nvtasfsDrruro;o1oeto fciyt a2ea(msn(0aexnxr iytoaD au s t s2tmxm oo1lptelnvia( arrrumo;t0opt  i3tyt mDulumo;(4tlxrioctadfmtr i i (0 2umio io1olenmnesa() 2urum ;t1ape ii3tld a2ua(monu0arxnifctodoaD  ieil()srtm(o ny4lmtnmivi (f 2rmur ou0oetomieias a2uln ont4 eenio io1la ean o;t)seumxopoydaleelivtas)aDrm(mont1tlxnmoetytfm2ua(mp (0 ltrmrcoodlmtr ivi;(0 rtoxr oo4op emnet s srua(mp;o4opeo f3iat s2eauvonu)tlxomrciytom  ln ilt0 rtrim ou1ll  lieta(fa2rrx onu4tetoio3tysls ulu s;t) rtrmr3oydoatean s;t0t2xm(r3no1lm nlfctl(  2trum nt1opxn i3ilt mDrlumont4 exnxr3tytopD lieolt0setmxrpno1ome miei tf Draur ;u0alenifeiat s emu p;(0 exrifcoadfpDrai s t0srxriopiodamtemfet tf Drmuro;o0olxnii3tls a2eanvo u) rxoxocoodoa r n i;s  2xoxr3nodop emicsat) rrmx pot1tlxoiictatlaDra( s (4 lxomr oa1fa eaneilt0 rxo(rpoy1amtnmies t)aDumx o;u0alt mf3iasfs eluvp;u4 rxniocoy1fpD aiei;s) exo(o3oy4op  mnct tf Drruro;t1tltnio3iadfm um( o u0trtomocoadoaD anvolt)tetm(r3no1lm elfcsa( sDumurpnt0olx mfciydfm2eanvpnt0tlxoxfctotfaDelieo;s0srxr(r iy4ame mieiasfa2rmxront0oltnmf3ilsla2ranvs t)arxrmr tatfp  li o;s) eumxo iudamt  feslsfsDumx oot4oex  iciad mDemuvp t4 rtnioctodfpt ai s;( sruoim3oo4olt  net sfsDtru pno4tltoiiciasfa2elnmo;u0 rtniocoydomDeanvi s)srumim3iudam  mnesls)srtr(mo;u1tlt iiciysls ua( p;t0aeeoxo3iotlm rlivils trtr(r nu4lp elfeta( sruaump;t0oeenmfetysfm um(vs;t0tltomfciotfpDelnei t  rxoxmpnydame  ncsas)sDta( poo0tleomiciltla rm(mp t4 rxrif ta1op rliesls) 2trxm ou1lp e feta( sDrrum no4ale if3tys sDran s;t0trtrio iy1faDr nes s seurir iu1oltn nvs t  Dumu o;o4apxn ictasfs2ulums (4arerxf3io1op eluesls0 rum(rpny4am   nvtas)sDtru pnu0tptniieiydlsDumuvpnu0 etrio oatfatr u olt0 2tm(m io4lp   ncta(fa2tm(  nt0tetomf3tld sDrm( pnu4trenmfcoydfmDeanvo;( texmxr3oodaleemicslt) Durumpno0aeen o3ilsla rmn p;() ltoiocoytlmD au i;s)s2uoio3iodlleemfcsa( s2raurpnu0open ieiasfa2emu snt0alxoif3oytfm raieolt  rxrxr no4lptnmivslt artm(m ou4olxomoeiad mDea( s u) renxo iy1latrlivi;s0 2uoio no4ol   ieiat  Dur( oot0oeto f3iaslaDrmuvs (4 eenmr3iadlpDraies s0 2xo(mpoudope licsas)sDta(mo;t0olenif3iys aDel(vs;t)tlxrxf oa1lpt auvo t0srxoxm oydome  ietl() rumu ont1apxn f3iatla2rlnmp;t0aetnioctydop  anvs t) 2xrxm iydlm nmivia(f Dra(m nt1openioetls m2uluvon()texrxfciodlat  n i s trxo(r3iu4opt livta()a2raumont1tlt iiciasls2el(mp (4 rxnioctydomte i o s  rtmirpny4am  mfes (  Dum(mpnu0oexo o3iatls ua(vs;()arxrir oytopD aueo t sexoxm3iy4alen ivsls)s2um(ro;t0teto octysfm2eln o;u)altrxr3oadfat lnvi s srtr(r3iydlm  lnei s arrrxmp;o1tltoioetadfa eluvs u4tleniocia1omD lieol( t2xm(opnodom nlfvtas)sDrm(r ou1apx ii3iad m2ua(ms (4aetoif iadop  lnei t0teuriopnu4omenlfvsatfa2rm(m ;u4aexnmo3iys s eln o;t)arenmociadop  anvo s)t2urimpnu4lmt mnviat)a2tau oou4alt mictls mDeaumo t)teenif oa1faDe ivs t)srxo(m oy4lmeelietls artruro;t0oetomocildfs rln o;u)altoif3iytlptrai o;t0tetm(mpiy4op e fvta(fsDraxronu4apx  icils mDumumont)aexnxf3ty1latraueilt) 2uriopiu4ll elieil(  Duaurp;u4aeeomo3tldlmDuluvs;()texnir tatomDelivo;()tetmxm iodal nmfcta(fs2urx  ot0tlxomfeiys a rauvo;(4altnifctydlp raueilt0sexo(m3iy1llenmneil( s2uax  ;t1oleniiciyt s2rlnvs;u)trerircoytomD lieil(0truoxopio1lme  ivsa( artaxmooo1aptnifetytfaDrau p;t4tetoxr tatop  au o t t2xm(o oy4optemies tf rtaumont0ope  feildlmDulumon(0tltrif3tatfmtraueils0 2toxo no1lpe  ies ( aruru p;t0ole miciadfa2um(ms t)tlxnxf todoatelivsls s2trimpoydopen ieias  Dum( o;o0tleo ietyt m2eauvp t4 lxrxfcto1fmt aivolt)t2uo(r3iu4ol e ies t)s2tm( pot4apxo o3iytlsDemnmp;u) eenxo iadoat aivs t t2uo(o3iu4al nliet t  rrrxrpou0tlxniietls aDrlnmont)aleoircoa1omt anvo;()srto(o3nu1om n nvs sfsDuaurooo0aeenifeiyd aDel(vo (0trxomf oa1lm   nvs t sexoxopny4ome mfvt ( a2tm(r nt1opeoiicildfs2rlnmpnt0trenmr iadfatr u sl()t2um(r3ou4al emfvt s  2trxro;u4tpen f3ildfa rl(mp u4arermf3iodfmtran sls0t2xm(r3oo1amen ncs t)s2rruroot1optomoctlsls2uln p t4 rxnir3oytfmtelieolt0 rxo(m iodlmenmietlsfsDtm(m ;t1tlto ictldls ranmpn()trxrxr todfmD  u ils)sruo(opiu1lptnmiesl( sDraxroot0olx mfetatlaDel(msn(0treoifciydoa raivs;t  ruoio ou4apee fvias) Drm(  ;t4aetnmieiydfs rm(mpnt0 exoirctytlmDrlneols trxoirpiodlptemfctat)a2umxr ;t4tlx ioeiadla ua( onu0artoxo3oadfmDeauvs;( setrxopnudole lici ()s2rr( o;t0apxo o3iyslm umn s;()teerxf iy1opDrauvs;s0tetrxopoodap nmivtls)sDta( o;t0tltoifeilsls2elnvp t0tetnio3io1fa e i o s trxrim3iy1omt lnei s s2tmurpnt0opto f3ias aDem(msnu)alenxf todla  an s;s)srtrim no4amt mnesa(f Drrxr nu1tetn i3iltls uauvp;(0tltrmoctydop elu s;s  ruo(o oodapt livs () 2rmu  ;t4tlx  ociltfmDea(vp;t0aetrmrcoa1optrluvols) 2tm(r3iu1open nct sfa2rmur no0apeomocias mDrmu o u4texomf3oydla  ln o (0trxmxrpoy1ole  iei t)aruax  oo4aetnifciltls umu p (4trtnmfcoydlm  anvi;t0t2xr(m nodaltelnet t)a2rru  ou4aeen ictydlsDeaumsnu)trtrif3ootfm rli slt texoxo iu4am   nctls)a2tmu oou1olx  ieils a2eaumo;t4tltrxo3io1omDrln il( srtmxopny1optelnviat aDtrxrpoo4tetomo3tatfm2rmnvo () exoir3oo1fpD  ieol(0s2uo(r3oy4aptn nvtlt) Drmumonu4tet  f3ilt a2em(ms;() eenio iydopt anvs s0 rxoim io4omt mfvs t)srumxro;u0aexo iciltlaDrlu o;t4 renio3iadfpt au i () 2tmiopoydlmee nvt s) 2tmum nt0alt mieiydlsDran o;t0texnir3oytoa   n o ( trto(m oo4lp  mnvias srtr( pno4olt  o3ilsfsDrlums;(4teeoir ty1om elieo;( t2xrirpno1omeemfetlsfsrumxmono4oeeoiiciytfs2rluvont0teenxf3ia1fp raivs;t0 eto(o3iu1amen ncsl(  2uau ono4aetoii3tyslm2eluvp ()trtrif3iy1om e uvol(  rxmir oo1ope mnei t)sDrmxmpou1tptnif3ildlaDrlnms t4 etrmr oodfp e u o s t2um(o nu4om emfet ()srtrxront4olen iciyd m em(vp;(0alxrxfcoo1lpDeln olt0seum(o oudap n fetl()artm(m ;u0tptnifeiysls2ea(vonu0aeenio iotlm  luvols0teuoxopoo4olenlivtas)a2rm(  oo4apx mieiltla2em(ms;u4tlerio oatlatelivo (0s2uoxopnu1oltnlivia() Drmurpoo1ale mieils m elums;(4 rermf ta1opDr u i;(0 eumxo3nodolte ncsasfsDuauronu4oee if3iat m emnmpnu0 ltoir3tadfa  lneo;s)trtm(mpnodopenlieiasfa2rm(ro;u1aexnifetltfm uaumo;u0trxrirciodopt  uvslt0 2um(m nydlptelivslt aDtmxrp;o0tpe  o3ild mDemn o u0aetoio tydom   nes t s2xoxm oy1lmenmnctls a2umxmoou4apxo octydlmDran p;t0teeoxf3iy1lmDraivi t srxrxm3oodomtemict tfaDtm(m nt0aexoioeildlm el(mo;t4 lenio3iy1op eluvil(  exoxr no1llt  fvi t) 2taxmpnt1tpt mociad sDemuvsnt4arxoif oytfaDrai ils0sexmxopnydapenmfct () Dtrumoot4ope moeiatfs emums t4 reoifcoo1fpD  ues;() 2urxrpiy4ll   fetl()arrru o;u1opt  i3tatfm2elump;(0altnir iadfatraivils trtoxm oo1om n iesl()a2um(mpnt0texn fctyt a ra(vsnu4tetrmfctatlmt  n s;t t2xrxo oo1lp e ncta() 2umxmooo4alenmieiasla2um(mpn
\ No newline at end of file
@@ -0,0 +1 @@
+ivi;( setrimpoudopen netas artaurooo1apxnmiciad sDrmums u0 exoxfctadoptelnei s)s2uo(r3io1olee fcsat)aDur( ont0apxnmiciysfaDuauvo (4aeerif3oadlptrauvols)s2xoio3io4ap emfcsas s2rmumoou4tpx miciatls ul( o () etoio iotoptrliei ()seumio ou1om elfciat  ruau p;t4aee  ieiad aDul( on(0aeeoir3oa1fmt auvi;(0 eum(m nydalee fei sfaDrrumont0tpx iiciaslmDuau pnt)tlxoxr todfmD anvo;t) rtm(r io4opt mnvsls)sDraur nu4tetoif3tlsfmDea( o () lermo3ty1lpD ai i;(0 etrio oo4lmtn fesas artaxm ;o0aexnmf3iyslsDem( sn()aexoir oadomtraueslt  euoirpoy4optnlfcsa(fa2tmump;u0alt iiciys aDeanmo u4trenxo tydfpDelnvo;s)srtmxr no4al  lfeia() 2rmx o;u4aee  ieiys a umu pn(4arerxf3oo1opt livilt) rtr(rpoo1altnlfet tf Dua(r oo1oltniictydfsDulnvp t4texnxocootom elnei;s)texoxm ny4ome  iesas)aDta(mo;o4olx  fciyd a ua(mo;u0 lxomfciytoatraues t)seurim iy1ap  lieta(f 2umx  ou1olenii3tlt s rau ont0arxrmrctydoateaueo;s  rum(o3io4opeemicia(f rumumo;t4oleoifcilslmDem( o;()teerxf3oodlmteli s s)trtmxr3ou1aleelictlt s2tm(rp;o4oeeomf3ilslsDrm(vs;(0alerxr todlm eanes;s teurimpoudlltnmivta() 2rmxm ;o1aleomi3tydlmDel(mp;u0artoio ty1fmDranvi (  rum(r oo1ol emneilt)srrr( onu0oetnioeiadls2rm(ms;u4tlxnmf3io1laDrlivsls0seumxrpoo1al   ieslt)s2ur(m ou1texnifeiysls umn p t0 eenir io1opteai i;( s2xmxr3oy4olen ics s  2ur(rooo4oexomfciadfa2umn s;()tetnxf io1fm  li o;s  2tmio iydapte iet (f 2rru ont4tpt ii3iydla2elu o;t0 eenxf ia1opt  uvsls setriopny1am  lietl(  rtrxmpot1tpenmo3tytfm emu o;(0alxnmo3tydla   i s s0 2xrim3nudam  mneta( arrmxmo;t0aetoiictatls ea( s t) etrmf3oadomDelneo;() eurio iy4lpt mnes s srtaurpnu4ope mietlsfaDeanmonu) rtoio iadfpDraiei;t) etrxm3iydllee ietl(fs2um(m ou4tpe mocilt m emuvsnu4teermr to1fmtrlu o s sexoim iydlpte nci s s2tmuro;o4aexomfctysfsDeaump;(0aetrmo3ia1laDrauvil( seumxrpou4al elnvs t)s2rm(  ;t0olt  ociyd sDum(mo;u) rxoxr3totomDrluvs ( srxoxrpoo1om n iei (  2tmu p;o1tpe iiciad s em(vs;u4 exoirciy1om  auvo;t0srtmxopnydomen fvsa(  Draumpnt4opx io3tytla2rmnmp u0aleomf3io1fm r u ols  2uoiopny1omeemivtls srta(r nt1alxoiietlsfa2rau o (4tlenmoctadla  ai o;s0 2urxr3nu4omtelnvsas) Dta(m ou1tpxnifcilt mDelnvs;u)aexnmr3iodom elu i;t  euo(rpny1aptnlfcia(faDuaxmonu4ole  i3iysfs umu p;u)tlenxfcootopDr ueolt) 2uo(rpnodllenmici t) 2rr(r ot4apt  feiadlsDul(vonu0aeerif ty1lmDran sls0 eto(mpno1altnmfctls arrmum ;u0oetn octldfsDra(mp;()alxnif oatfp rlneo s)s2xrxr3oy4lm   ietl( aDraxmooo4aetnmf3iasla2ua( snu0aexnxfciatop eai i;s trxr(mpny4amt lnvt (f Drr(monu0tpx if3tadfs2rau pn(0aeermo todomtrlnei (0 etr(o nudllenmiesltfs2urxronu1alenmfetadls2ul( p t0trenxr io1opt li ols) etr(m3no1lltnlieias) 2uau oou1oee mfciltla2ean p u0aetoxfcty1om  ai i;s trtrxo nu4lptelfvias sDrmuroou1teenio3tysfa emnmp;t) rxnmr iodfmD livs;(0t2toio3oydlmen nesasf Drrxmpoo4apxo ietat a eaumont4teerxr3oadom e uvs ()t2ur(rpnodam nlfcsas) Drrurooo4ale ifeilsla ulnmsnu4arxnmr3oydlmD ln sls0t2toxmpou4aleemivsas sDra( onu0tpx  oeiltlaDumump t0alermf3io1faDraieolt)srtr(opio1omt lnvs t  rumuroot0opt iociyd s uanmp u4 reomo3oatfm   u il()seto(opnudop  livsatfsDtmu  ou0olen o3iltfm rlnmo u4tetnirctodfm elivs;t truoim3iu1altn nctls arra( p;t4alxo i3iasfm2rau on(4 rermf todomt aies;t)teuo(m nu1al nmics tfa2uaxmpou4tee mo3iyd a2uau onu4aleomo tadfmDe i o;s0 eurxo3iydam e fesatf 2urxrpou0tlxomoeiatfs2ra(vo t)artoio iadoa elu s s sexm(r iy4olee nvsls s2ra(rp;o0tpe mfeiysfs2rlnmo u)tltomf3iodlm  ln o t)t2tmxo3oudolenlfei s sDum(  ot1apenifctltfsDrl( p u0tlxrmr3todomte ivs;t) 2uo(o3no1om eliesa(fartr(mo;o0opxoii3iysfm2rmu o u)alenmo3iotfm  lnvs;t s2tr(o oo1ll elnvil( sDur(ronu0tlxn fciydfm ra( pnt)aeeomo3oydfpD lueo s teuoirpio4lmenlfcsat)sDtaxr nu0aet ioeildla2ua( pnt0 eermf3oodlptrau olt0teuoxr iy1lleelivsat)a2uax  ;t0tlt  f3tatfs2ea( ont4 rtrir iotfpt lnes ()trurxopno1op nlnetas  2ra(rpot1aee micils a rmu p;u4 lerir3tadlpD lnes;( trxr(m3no1amtnlfvtat) 2uaxm no0aex miciyd m2el( s;t) etnmf ty1laDeanvil(0 rtrxmpny4ll n fetlt)sDrmxmo;t1apxn feiat a2em( s t0aleoxo3oa1lmDraneslt srxoxmpno4omtemfct s)artrump;o4olxnio3ilsfmDem( onu4trtnmo3ty1lp  livo t srxrxo nudlmenmnesa() Drruro;o1oleniociydlm emu p;u4aetomfcoydop eanvsl( s2xr(o nu1al n ict s)sDua(mooo4aeto oetltfm rlnvo (0 etoxf oydfm eluvsls t2umir3oo1omt lfvilt) Dtr(mpnu4oeenmfciltfmDeauvp;(4areomr oydomte nvs (  exoxopoodaptelfvsls  Dumx pot4optomfeiltfa2uluvpn(4teeoxr3iodom rluvs t teum(r3iu4lleelfes s)aDumx pot4opx mfciltls2ranvp;t)texoir oo1lmtr iei;s0tetr(o3ou4lmenmfcils)arumxm ;t4oltn fciadfs2ranmp u)trxrir3tytlmDrlivslt setmio nodap  livtl() 2taxront1aeen o3iad s2um(ms (4texrir oodoat  uvs;(0 exmio3nodope mfciat)srtmxrp;u0aex mf3ilsfaDelumo;u0aetrxf3tydfmt  i sl()texrxo3nodlmt lnet tf Drrxm ot1aetn fciatls2ran s t0trenio oadop rlnes;(  2urxmpoydop  mieil(fsrtaxmp;u0alxo feiytfa elnvo t4tltoxr oodlpDr u s t)srxoim3oodapeemnes tf rtmu  ;o4ale  oeildfsDrlnmo;t)teerxf3oatoa rln s;s)seum(opoy1alte ieia( srurxrooo0aexo o3iydlmDrl(mp;(0aeenmr3tytomt  nvol()t2trim oodlpte ivil(  rrau pou1oltnmo3iyt m2ulu s u)tlenmo3ta1om ranvo t0t2umim3nudam emfvta() ruaxro;u1ape ii3iasfs2rmumsn()aeermfctotlmDrai olt trxmxm iy4ome lfcsls) rur(rpou0altoiieiyslm rm(msnt) exoiocoodfpDrlivils0srxoim3oy4lleemnvt t s2trumpoo1tetomfciyslaDem(vpnt4tlxrmociadlpDr uvi s0srto(m3nodlp  lfvtl() rtrxmpot4oexoio3tltfmDumu sn(4 rtomociydfmt livo;(  2xo(opiy1ll nlici s s2uaumpno4aex  f3iydfa uanvo t4texrifcoadlpD livs;( s2xmir iy1lme mnvi t)arrmx pno4alxn fetatfsDrlnvp;u4alxnxr io1fpDran s;(0t2tm(opoy4lptn net sfsDrm(r nt1tpxomi3tlsfa2eanmont4trtrxrcia1latrln o;()s2to(r3ou1lpe lnvilt)aDtaxmont1olx moetydlmDemn o;t4 lxrifcoydopDr ieo;t0trur(mpnu4amt  fctls s2tm(  nt4aetomi3iltfmDrmuvs (0trxomr3ootfaDr n il(0s2xoir3nodll n nvi t  Dtr(rono0olenmieias aDra(mp;t0teenmo3ootoatr nvi;t0 etm(m nu1olenliesat a2raxmoot1openmf3tlsfsDra( pnt4artomf iodfm ranvs (  rtrio3nudomt lfcsls s2trx  ;o4apxnioetyslmDel(vp;(4tlxnxf ta1laDelnvils seur(o3nudom  mietlsfsrta(r ;t1tpeoioeiysfsDelnvsnt)trenif todomt anvo;t0truo(r nudamen ivs () rrmurpoo1texnifciadla2eaump t0 rtrmoctatfpteau s (0 2xm(rpou4om e ietls s2rr(mpot4alx  i3iydlmDel(mo;t0 exrifcoa1laDrau i;t)tetoxm iy4ap  mfvt ()sDumurpno0aeeomfciyd m2ulnvs;t0arenmfctydfa r ivo;t  rur(r3io1optnlncs sfs2trxmpno0oex micilt s umuvp t) renmf oydlpDr i i;s0texrxmpiydllt miei s)sDta(mo;t4tlt micils mDrm(vs (4artoircty1lpt ai i t) rxriopiodol emfciat aDuaurp;u1apenmfeiatfs rlu snu) ltrxo iydopteluvol(0texmxm oo4omtelnctl()a2tr(mono1tlx  ociyt m2ul( snu)tltnio oodfmt lneolt)sruoirpno1ole  iei s  Dtrxm ot4tetnmo3tlslm rmuvpn(0aetrircoa1oatr i il()sexmimpou1lm nlnei t  rta(r oo0oet moeilsfs rl(vo u4texoio3tatopDeanvils  2tr(opnydlme mfei sfsrrauro;u4oeen octysfa el( o;u0arxomf3oatla rai s;(0teumio iodame mnetlt)artmx  nt4alxoiieiydfa2umuvsn(4 lxrmf3tatfm  lies;s seuoxo3ou4ale mfcs (farua(mpnu0opeo fcias s2umnvont)trtnifcootfatrln ils0srur(opoydape livtat) rtmx  no0opx moeils a2el(ms u)trxoir io1fpt auei (  2uoim3iy1lmtelncta( srrmxr ot0ape  ocilt a2rauvsnt0arenxfctytfmDranei s trumxopno4ope mncsas  rrru pno0tptniieiyd s2ua(mp u0trtrxoctotlm  li i;t) etoxmpnodlm e fcta( arurumoou0oex  f3tadla2elnmp;t4 rermr3ty1omtranvslt0tetoxopiodaltnlivta()a2rmx ont0aex moetadfs el(vs t0altriocoa1op ran s t)t2tr(o3oo4alenmfci s aDrauroou0aexo i3tydls2rlnvs t0 exnif iodfa r nvo ( t2xoim oo4oltemics (fa2uru o;u0ale  o3iatfaDulnvs;(0arxnmrctotlaDr i i s0srxo(opnu1optelfcs t sDrrxm nu1oex mietyd a2uln snu)alxrxr3iodlmtelieils0 rtoir3no1oltnmivta(  rtr(mo;u1teen i3iltls eluvont0 lenifctodfmD  ivs;s)s2um(opiudapt lfviat a2tmu p;t1olenioeiltfs2rauvp u)tetoxfcoytopDr ivo;() rtoirpnu1al  lnvt t)srum(  nu0tltn iciasls2ul(monu4 exomocoy1omD luei;s  euo(opoudolt mfvil()aDuaxmpou0apxnmoetas aDuau pnt4trtrmf3iodfaDeln ol(0 rumir iy1op e ncs s) 2ra(r no0tetniicilt a2em(msnu)treoif3iadlpD li slt truoxo no1ame mnei ( a2tru pou4alt  oetysls2em( pnu0tlxrxrciydfmtelivs s trxoxm nydomtn fetat sDtaumonu4aee  ieiytlm2ua(vs;u4tlenmr3oy1la elnvslt0s2tr(o3iy1am  mnvtltfsDra(m ;o1ole mi3iatfs2ul( p;u)aexrmrctotlp eaueol()texmim3io4ap nlfetatfarumu  no0tetnmoeils a ra(vsn()texnircootoaDe ivi (  rto(o3oudal nmnetatfsDrmx ono1tlx iictyd s2emumsnt)aexoir3oatfpDr nei;t  exoiopnu4lmtelnciatfarta(rp;t4tleniiciltla em(mo (0 rtrxr3todoaDrlnvslt) ruoxmpio4olee ncsa(faDtmx  no0olenmf3tadfs uanmp;(0 rxnxf totlm  lu s;s0 eurxr3nudlm n nvtl(fa2tmu p;o4tlxnmfciltfaDran p;(4 lenmf oo1latr ieol(  2xrxm oy4olt mnvils) Dtru ont4olt  o3iadls2rmnmon(4 etnmr oy1latrliei s  2uriopio4altnmfet ()aDtrum ou0olx  ieiaslaDua(mo;t4trtoif oydlat  n o;s) ruoim oy4ol emivsls  2rmurp;t1ope ifctldfm rlnmpnu4aexrmr3tydfmD lues;t) 2um(r io1lm  lfvsat)arrmur nt0alto ieildlm ua(vs;u0 ltrmr3iydomte ueol(0 ruoxopnu1omtnlncia() Dumx o;u4texoiociydlm uau sn(4aexnmrcoytlm ran o t)setm(r ny1lp   nesls sDumx  ;u1alx moeild a2rluvonu0altrmr3iatomDrlu slt) rxmxr3iudlme  fvt s)arrmur ;o0optnmietys m2ulump ()trxoxo iodla  aues t)s2xr(m nu1amt  ncsls s2umxm ;t1tlxnmieiytlm elnvsnu4aetrmo3ootomte nei (0tetoxm oy4lpe lici (fsrtm(mo;t0apxn iciat a rl(vsnt0 rtrxr3oo1lpDraivo;(0 2xm(o oydope lnctasf Drmu p;o4aet  i3ilsls2elnmsn()arxnmr oatfaDean s (0t2urxr3ny4op n fct ()arrax o;o4oexnmi3ilsfaDran p;t4aexnmrcta1oaDr i o;t)srtmimpio1opte fvi t)aDuax onu1opxn fciyt m rlnmp;(0 eenxf iydlmDe nvilt0s2xr(o3no1alt  nct (fs2trxroou1tpx  iciyd a2um(ms u)tltrmr3oatlm   ueolt)t2xrio oydoptemfvtl( a2urxmpou1aee mocilsfmDrauvs;u0 lenmo3io1lmDeaieilt)srxoirpoy4olen nvt tfs2raxroou4alxnmi3tytfmDem(mo (0 rerxfciatom eli i;s0trumir3oo1oleemnvsasf 2rmxrpno0olenii3iasfaDua(von()tlxrio3oa1oa   n o () exoxmpoydopt  ivt t) Durxrpno0aptnmfctad s2eluvs u4aexrmfcio1lmDeaieo t srtrxo3nu1ameelivtlt)srtrurpnt0tleomfctatfaDumn pnt0 rxnir io1lm  aiei ( seumxr3nu4ame lnet t)s2tmurp;t1oee ifctatls umnmpn(4treoxf3ta1optr uvo t)s2ur(r3oo1ap e nvta( sDtaxmo;o0aleomfetasls2rm(vo t4 lermf oydlmtr iei s) euo(opoudlpenliet t sDrrx pnu4oetomf3iatfm2eanmo;t4tlerxfctydomtranvi;s) etmxm oydop nlnct (  Dua(rpnt1teen oeiydfm ulu s (4aeeoir3tadlateaueolt  euoirpou4al emieil(farta(r no1aeto i3ilt a rau pn()aetomrciodlpDelnes;s)srumir3iudam e nci tfaDumu p;u4alxo ictat s2elumo;(4texrmr3oatlm  anvo;() 2urim3oodlmee icils)s2tm(  ;o0aexniieiltlmDumnvsn(4artnmrcia1lm e n ols seurio ou1oltnmnctl(f Dtrur ;t0oeto oeiat a2ran o;t) lenmr3iotom rlues;(0 2xo(r3iodopenmfvt t a2rm(ront1tlenio3iltfa ran s u0tleomfcoodfaD  i s s) euoirpnodlm elfvsat a2ra(m oo4opx ifcildfm2ua( p u0aexrxr tatopDe uvo t  exoim3iu1amtn ivsl(  2uaum nu4oexn fcild m2el(vsn(4aeeomoctotfptrlivsls0srtoxmpiu1altnmfeta( sruax pno4alxn oeiyt m2eaumo u)tlxrxo iadop ranvilt texmxopny4altnmnvsltf 2taurpou1aeeniietyt a elums t)teeomf3to1fp r n i;s  2xrxrpno4ol elfeta(f Drmu ooo4apen ictysla2ra(monu0texnmo3oadfpt an i;(  2urxo io4lmeemneta(f 2tr(mp;u0tlen ieiysla2emuvs;t)trtrxr ty1oaDelueols0srum(mpio1lm e net t)arum(m ot4tltn ictysfs uaumo;t0altoxrcta1fmDrlnes;s)trxr(r3iudal n fvsas sDrmx o;t4tpxn f3tat aDrl( o;(0 exrxf iatlpt  ueslt)truo(mpnu1al elieta( aDtax pnu4tet  f3ildlsDrm(mo (4 ltoxfcootoa elu il( texr(m3oy4lm  lnctltfsDrmx  ot4aeenmoctlsfs2ran o u0aleoifcoydomDrauvs (0 rtmim3no1om nlfviatfsrtaurpou0aetoioctlsfaDul(monu) rtoxr io1lp e ivo;s srurirpio1amt mnesat)a2urumpnu1tpto f3ilt aDumuvp t)alxrxrcta1faD li i (  etmxo3io4aleelict sf Dtr(mp;t0tlxoiociatfsDem( o (4 reoio3totla e ivsl(0seuoxm no4llenmnctlt)srtmu  ;u4apxomf3iat a ul( s;(0arerxrcoodomtr nvilt) eum(o3iodoleelfvt ( arum(roou4oex mi3iytls2uanmont0aetnmocty1opDelivils0srtoxm3io4open ncsl()s2tr( pot4tpx ioctat s2em(mp u0 rtnifcty1fmtrlueo s trtr(m3nydllen ncslt)s2rmuroou1tpxomieildlm eaumpnu4aexnxocoatlpDr uei;s)teur(rpnu4lpe  fcsl() rumum ;o0tpeoiicilt aDrm( p;t4 rxoif iodlm e ivil(  exriopoo4lme  iciat)a2urx p;o4tltomieiasfsDra(mp;(0texrio3oydfat li o t  2xrxmpou4al emfei sf 2tau o;o4opeoiietld aDrl(vs (4 ltnircty1lpDe neol()sexrxr oo1llt lfcsa( sDta(root4oexomoeiyslmDumn snt)tltomo3iodoptrlu sls0srxoir3io4ol   fvt t  2tm( o;u1tpenmi3iysfmDel( ont)tetoxo3ia1fpDe u sl( t2umxo oudlme miesl( a2rrumo;t1tpx mfctad aDeluvonu)tlermfciydfp rai s s seuoimpiudlme  fvtasfsDua(mont1alx  feiydla eluvp;(0aleoxo ootlmDr i sls0s2xrxo iodame lfes ( a2raxr ou0oexn oeild mDelnmp;t4 reoir3oodlptranei () 2toxo iu4omtelnciltfaruau pnu4texniicild sDrlnvpnu0artrmr3oydfptrauvs s)seuoir oy1apen nes sfsrum(roou0olxomi3ils sDulump;t0 exrio3iadfmDe ueils trtm(m3iodlmte nei s s2tru oou0aex mf3iysla el(vp;()aetnxf3oy1laDelivo;t0texoim iu4olt lfetat) 2umu poo1tleo fetatfs ua(mo u)aleomocoa1om eai s;t)t2um(opnudap n nvtls a2tr(moot1ole if3tytfa umuvp;()trenxo io1omteanvils)t2urxo iudam elfetls arurur ot0oeenmicias a2rluvpnu)alermf iytlm r ueilt0seumxm3oo1ole mfvsltf rra( p;u1altn ictysfmDra(vo t) eeomf3iytopt lu ol( seurxrpnydol e neilt  2rr(roou4aexoii3tldla eanvp u)trtoxociatop   ieilt tetoir oo1olt  netas  2ur(mo;u4alxomieildfsDrmnmo t0arxoif3to1lp  auvi;t s2uoxr no1omeelneil(  2uaxmooo1openmiciasls uan s;t4arxnmoctydfateaneo s0setrxo3oy1om  mfvtlsfsrurxmoot4ope mi3iasfsDrmuvs t0 rerir iatfpteauvolt  etrxm3ou1ol emici (faDuaurp;o4oet  fctyd a2rm( s ()aeermo iydlptrlu olt0texo(mpiy4am e iesatfarumx pnu1altnifciad s rmuvpn(0tetnmf3tydfaDe ieo s) 2to(o oo1lp   nvt s s2rm(  nu4tee  fetysls2emnvp u0tlermf ty1lm   uei s s2xrio iydolee ieil() rraum no4ole ioetasls2rl(vs;()teeoxr iatfa  auvol( s2xrimpou1llen ivsatfarrmxm oo1aetnii3tyslm rmuvs;t) lerir3oadom r i ols trto(r3oudlmtelfvi (fsrumx p;u4ape mfetlslm2eln pn() rtrxf3ia1fpD  ueo;s)s2xm(rpoo1lltemicil(f Dtaxront4aptnmo3iaslm rlnvsn()trxoxf oydfptr nvils)tetmxrpiy1optelnesat a2rmxr ;o4altnmo3ilsfs rl(mp;u4trenifcoa1lptrlnei;s)teuoxrpiodom elfvta(farrm(  no4oltomi3tlt a umnmo;t4tlxnmf tadopD  i i;()setoio iu1opee fcia(  rrm(  nt0oetn o3tys m2rl(vp;u)alxrxo tatfp e nei s0t2toim iu1aleelneiatfa2tm(r ;o1opxomictlsfaDumnvo;t) lxoxf3iy1lmt aneolt s2xrxm3iydopt lfciat arua(m no0altn f3tat aDrm(von(4tetoxf to1oatrai s;(  rxm(mpiudaptnmnet (fa2rr(mpot0texnioeilslsDemnvsn(4 eerxo3io1lmte ies;s0trurir oo4lle lictlt) 2tm(ro;u1olenmocils s2rm(ms;t)artnmfcty1faDe nei (0 2xoim oodal  lici (faDururo;t1tlt  oeiydla eaums u0altrir3tadoateaivols t2toxm3nydol nmfes (fs2trxmpoo1opeo oeias sDelnvs;t)trtnmo tadfaDelnvs;(0 etrxrpnudop e ivsa( srtaur ;u4opxoiicias mDrm(vo t0 reoxf3iy1op ean i;()t2tmxo ny1lp   ieil( s2tmxmpou4olxn o3ils aDel(von(4 lenmf oydomD liei t)trtmirpoo1omteliei (fartrxroot4opxomfciad a emump;u0 rtrxocia1opD anei t teumir nu1amte fcsls aDtm( o;u1alt  ieiydfs umuvp u4tlxnmf totfmtelnvo t0 rum(o3oodopt  fcsas  Duaxm nt1olxn fctlsfs ulnvon(0 lerxo3oa1fa rlues;(0teuriopnu1lmt  fet tfarrmx p;o4tlxnmocild mDua( pnu)trxnmo3tatlm   iesl(0setmxo iudalenmieta(  Dtm(ro;t0texoiiciytfsDem(vp;t0 rxnif iytfa   nes;( t2xr(m3no1lmt lict tf rtrxr no0alxnmf3tatfsDuln pnu0trtrircootfa  an i;t0 2xrxr nudap e fvsl()srrax oou1oeenmfeiadla2ea(mo;u0trtnxrciodla e uvolt0t2umio3iydapenmnvsltfsDraxroou0opeo o3ilt s ul( p u) reoxfciydlpDraueilt0s2xoxr ny1alt  fet t)aDtr(rpnu4altnioeiltfaDrm(vp;t4altrxo oo1fmteliei;s0 2xo(r3oo4omenlfviat s2rauro;t1tlxnii3iytfm emuvp;t0 exrmf iytfmDelnei;s) 2toxr3iu4lp  mnvs (farraxrp;t0altoioeias a2rm( s ()tlenio3iadlatrln i;() rurxm3oo1lpe  ncslt)a2tru o;u4oexnioeiltfm eanvsnt4teerio3totoaD li s;s srtoir nu1lp elfci t sruax o;o1oltn ocilt sDelumsn()aeenir oo1fa  auvs;(  rum(mpoodap   fvtl(fa2urum no1altoii3tldla2el(mon()tlerir ty1fmtr ivi;()trtmimpio1lm  mnet ( srrmxrp;u4oetoifeiys a2emn o u4treoir3oytla eli i;s)s2uoxm3oy4optn iesltf rrru onu0opxn oetltla2emnmo;u4tlermfcty1lmDrlnvi;t)setr(rpno4alt lnes s)sDumu pnu1tlx moeiat s2rl(ms;(0aetomfciy1om   neilt trtm(opoydap  mnciat srraumpoo1oeenmictytfs emu pnt0 leoxo todfpDe ivs s0 exrio iu4lle mnesas)s2uax  ;t0olenifcias m eln snu0arerifcoadomt li slt srxmxo3oy1al e ietltf rumu  ;t4ope moeiysfm elnvpnt4 etnxr3ootoatr u ils)sexo(opiydome  nvs ()arrr(mo;u4aeenif3iyt s2rlnvp;()tltrxo3to1lat li s s s2xm(mpny4optnmici sfarur(r ;u0apxn o3iaslm2em(ms;u4tltnif3ta1oaDrai sl(0 2trim oy4oltnlfesl(fsDurxro;o0opx ifciydla em(ms u)tlenmociotlaDrln o s) etmim3nydllen ieta(f 2ra( oot0tle  i3tldfa em(vsnt) eenif todfa e i s;t0tetm(rpou1op elietl(  rtru  ot1aexnioeiytfa2rl(msn(0tlxoir3iadfpDrln ils) rxoio3iydamte icia(fsrtmum ot4aee mi3ildlm2raumpnt4texnio3ty1faDrlivo;t  rto(m io4oltemnet sfsDrau  no1tpt  octydfm elu p;t0 ltnio3iodla  lnvolt0 2uo(r3nydap   neslsf rtax o;u0oex  oeiltfs elnmsnu4tetnxr3ia1laDeauei ()trtoio nu4ome  ivi t  Dtrumpoo4tex mo3tytls ulu s u0tltnmr oydlmtrlu slt)s2xr(m ou1omt mict s)a2uaurpno1tetn ociad sDumumpnt) exomrcia1fate ivs;t0s2umxo nu4optn iei tfa2tmum nu0aptoiiciadlsDeau s;t)tetoir iy1fatrlivi;(0srxm(o3oy1op e ivtltfsDtaur ;o4oltnmoetad sDua(vs;t0 rxoxf3io1opDranes t) eumir iy4ale lneta( aruaurpou4alxnmfcilsla ea(vpn()arermf3oytoaD au o;t  etm(m3nydam nlfei (fs2taxmpou4ape if3iatfm ra(msnu4aeermfcootfmteanvs t0t2xr(opnydolt lfci sf 2urxroot4optn octldfsDrm( p u0 rtoif iytlmD  uvi;t  rum(mpoy4ale  fetas a2trx  ;t0teen oeiltfm rmu s u4 rxomo totomt auvi ( t2tr(opiodamenmfetat aDum( o;o4teen f3iadfa2ea( p u0tetniocta1om   uvsls) rtrxm3io1opeelnvsa(fa2uaxmpnt4aetn fciltls eluvsnt0alxomo3tytoateluei t srtoxmpiodomte fctasfsrta(rp;t4tpxn ieiad aDrl(mo;u)tlxoxocio1fpDe u s;s)setr(opiy4lpt mivt () Dtm(ront1tpe  o3tat m emumpn(0trerxrcio1oatr uvs ()srtm(opny1altemneias)a2umx o;t1oexoio3iasfm rmn o t4tlxnxf3oadlptr ueol(0 2tmxmpny4opeemnei t)s2tau  ;t4aeen ictas s emums (4trenmf3iydop rauei t)s2trxr3nu4lpt mnetas)s2um( p;t4aeeoioetyd aDeluvon() leomf3ia1la rli il( sruoxo3nudll  lfcs s)arurxmoot1aleoiocilsfsDemumo;(4 exomociydlm  aivs ( s2xo(o ny4lmt lnctatf Drmx pno0oee moetyslsDumuvonu)artrif iy1omDe uesl( srtrirpiu1llte ivi s  ruaumono4oexnifeiat m ulumo t0aleoir3oadop  aueolt tetmio iu4lltemfcs s  rta( onu4oltnmiciydlm emn s t)trxoircia1fpDr ueo t0s2xrxopiu4amen nei t  rrmxmoot4aleo iciasla2eauvs t0arxnmr oydfaD  ieo (0t2umir nudllte icsls)aDtrurpou4apt iicilt s emu p u0artoif3iadoat auvol( texrio iudll n ietasfs2rr(mpno1tetn oeildlmDrluvo (4tlenir oatlatranesls0 eumir3iu4ame mfeta()arrr( pnt1olto iciydfa2umn p;u4alxnmocio1latelnvo;s)trtmiopnydam  mfvt sfa2uaum nt1oleniieiltlm ea( onu4arxomo3tadlmtelivs t0sexm(r io4aleemnesatfsrtmu p;o1tltnmfctyt mDuln ont)arenxrciy1fpteaivs t0t2umio3iodlm emics ( a2ur(  ;u0altnmfctyd s2uauvp;(4 eenmfcia1late uvsl(0texoxr ny1op  mieia() Drmur ou0tpx mfciatla2ran snt0tetniocty1omt lnvi s)trum(o io4ap  livtl( aDta(mont4apxomi3tydlm eluvpnt0 etrxrcootlat lies;t  etm(opoo4llenlfct sfsrumumono1tltnmo3ildfm elums (4teermr3to1omDean i () 2umio3no4amenliet t) 2rr(ro;o0apen iciadlmDea( o t4trenmr ty1lm elneo t0srxr(r3oo1lle  fctasfs2tmxrpou1apx if3tasfs2uau o;t4altnmo3oy1fp   uvi s0t2xm(r nudoltemivsa(fa2rmurpot1oleoiociysfm2ulnvp;u0aetoio3tytfa r uesls) euriopnydopen fcsltf 2tmxroot0tlx  ietltls rmnmpnt) etnxocootfmDraivols  2um(r3nodlmt miviltfa2uax  oo1tpt  oeiydlmDrlnvo;t4tlenxr ia1fptrlneilt  2xmio3iu1am n nvtltfsDtmumpoo1teeomi3iytfs2rm(vsnu0alxnmr tatfmDe ues;()sexmirpoodomtn ics ()s2raumpot1oexn fciasfs ulu o;(0tleoxo3tatlaD ai s ()t2um(o ou4openmfcsa() rtax  nt4opx  o3tysfm rl( o u)altrxrctydfpDraieo;t srur(o nu1lpeelfet t)srrr(m no4aleoii3tydlmDra(vo;()tetnmr3tadomDe uvs t) exoio3nodlm emfvta(  2raur no1tee mo3iadfa elumonu4teeomocootfmD  n i;s)srxmxm3ou4aptn iciatfa2tru oot4oexn i3tytfa uluvont4tlxoxf iadfmtelu o t srtr(opou4alenmfcsl(farum(r ;o0apx  i3iydla2eaumo u)tetnir3oydfa r neils trurxrpiydomt  nes t)a2rm(rpnu4oeenmfeild a raump ()tetoio3oodoa  aieol()t2uo(o3oydaltnlivtl()sDua(ro;u1tltn fctydlmDeanms t0tetnxf oo1lmtr nvolt srum(opnu4ome  ivi t a2ua(r ;o1texnmoeiatlm emn pnt)teenmo3ty1optelu o s  2umimpou4omtn nvs t  rumxmp;o0altomictld m2rluvp t) eeomocoadopDranei s0t2xr(o3oydapenlncsas)srrauroot0tleo oeiltlsDemnms t0arerxr ta1laDr i i;(  rtr(r3ny4ll nliciat arumxm nu1aeenmfctys m2rmn s u0 eeoirctadlatean i t)texoxm3iy4al n nvi sfaDtrx onu4tle mictyd a rm( p t0trtrxr iydlmtraneol( srxmxr iy1opeelfviat)aDrmxmoot1tpxnifetys m2rmu o u)aeenmr3iatfpDr ieilt  2urio ny4ope mivt tfs2ra(r ;u0teeo icias mDrmuvpnu0alxoifctadfm raueols)setrxo3io4al elics t) rum(root1apx mfeiaslmDea(vsnu4trtomo ta1opDe i s;()trxrxm iydllt lfei ()arumum ;o0alen octlsfm2umu o u4areoioctotfpDrli o (0s2toxm3oo1al n fcslt)arrau pno4opx  iciad s ra(mp;u4 etnmf3tadfm eaneol(  2toim io1am   ivi tfarua( ono0tle  i3tas a uau o;u0 rtnmf3tatoptr n o;s0seto(m iy4opt mnctlt s2ua( pnt1optoii3ils s2ulnmon(4artoioctotlp e ies s)t2tm(mpiudapeelivtl()a2uru p;u0apen i3tltlsDrmnvsnu4trxnxf3ty1opD an ols) euo(m iu1lptelncs ( aruaxr nt0apeomfciad aDrlnvon(4artrio3oo1laDraivils0 2tm(o ny4omtemfcil() rtrxmoot0tptnmocilt s ulu p;t0tlenxfctotomD li s;s  rxr(rpiu4ol nmfetl()sDraxrpou1aex iieiatfm ul( onu)trermocootopt lu i (0srxo(r oo4ol n netas)aDuau  ;o4aeenif3ils aDuauvo t0 reomo3tytlmD  nvsls  rxoxmpio1aleelfetl(  Dtau pot4tpeoifeiyt s2emn s;u4aeenxocoodop e ivo s  eur(m iu4amenmics (f Durxrpou4oexn iciadlmDran o t0 lxoxocoydomtrluvil()sruo(r3no4lm  mfvia(f Duau onu0texn ietas mDuan o;u0tlerxr todfaDe uvo s0sexo(o iudllen nvsasfsDur(mp;u1oeto octytfa ua(msnu4 eenif3iatlp  li o;() euoio iu4llt licil() rta(mpoo4olxnmfciys a ua( s () lerif3ia1om   uvols0trxmio ou4omtnlieil( artmxrpou1texoifetysls ua(vp u)texrir3io1lm e uvs;(0sexrxr3oy1altemivsl(f Drmx pnt4apxomictat m umn snt4aleniociodfpDranvs t)teum(o ny4ole lfeils srua(r nu4tlxoio3iytfsDulumo u)aexrmo3io1lpDr i i;() eum(r3oo1lpt lfctatf Dtaxrp;u4open o3tydla2um(mo;u)arxrmf ta1oa   n sl(0tetmio3ou4alenlnct t)srrm( oou1aetnii3iadfs2el( snu4tetnmo oatlpt  ivolt seuoir no1alt mfcil(fartmxr ;o4oetoio3ils mDrlums;t0alxrir3ta1lmtrlu s t0 2xoxr no1aptemfvi (fartmxrpnu1apt ioctldlsDum( onu0artrif3iy1latr u ol(0s2xmiopno1ll  lnctas  Drmu  ot1tee ifctyd s2ranmonu0 rxrio tatfp rln ol()tetoio ny4lptnlfciatfaDtr( pnu4tptoiiciad m rlnvont4tlxnxfciadfpD livslt0srxm(m oy1apte neias srum(m oo4teeniieiltls2ua( p;t0arerio3oo1omDeauvi;(0sexr(r3oudoltemfctlt) 2ur(  no1olen f3tatlsDelu p u0aeermo oodfpDrlneol()t2xrio nodomenmneslsfa2tmxr no0oltomf3iat aDuauvp;(4 exnmrctytfaDeai il( teurio3iu4lmtnmnet t  2tru pou0apxnmi3iydfa2em(ms (0arxrir iydfateaiei s0srxr(opoo4altnmivi ( aDtaur ot0olxomieiltlsDrlnvs;t0 lxriocia1la  lneilt0t2xm(opiudal  mfes sfaDtmu o;t4apeoifetls s2ulnvs;(4texoxr3oadfat anvs t  rtrxo3nu4apenmnvtat s2uau p;o0oltnio3tad s2ra(vs t0tlenxoctydom r ueo;s srumxr3no1apenlnvslt  rta(ro;u4aptnii3tytls2umuvs;u) leoxo3iy1lpt au olt0t2tm(o ou4lmeelfcta(fsDraxr ou4aeen oeiltfm ulu snt) eenmf tadlpt  neols trxrim3nydoltelncilt)aDua(rooo1tptn f3tasfs2rauvon(4trxrmocoodlmDrlu sls0texrirpoudlpeelfesat sDrrurpnt0tetoifeiat s2ulnvp t4trtoxf io1oateauvslt setm(mpnu4amte netltfsrtrurpnu1tlt mieiadfs rm(vp;u)trtoxfcoa1opDraiei t0 rtoxo no1olenlfvi s) Dtmu pou4oex  oetls s2ul(ms;(4trxrxf to1fat lues t)s2umim3nu4ol n fcsa(faDrr(rp;o0tlt mfetytlmDua(ms;u0 renmr ia1omt  i slt0tetmim3oudap n iet ()aDtmx poo4apeo f3ilsfa umnvs;u) rxrif3ia1fp rai s ()seur(m iudal emnvilt  2ur(mpnu1tltn fctyt mDumnvp u4 rtrmociotlaDr nvslt)trxrxrpny1omtnmnesas) Dumxmp;u0apenmfciyt a2ea( p (4 rxomocoytfpteln o;(  rurim oydlpee net t  2tmurpoo4teto f3iys a ea(mo t4arerxr todlmte i i s teto(m oy1om nmfesatfaDua(mont0tpeniocils a rauvsnt0 rerio3oytlptraivo;s  2umim ny1lm   ncils sDrmx p;o4aetoifctatlaDuluvpn(0 rtrxr io1oa  anvo s srumxr oudap emfeilt)sDtaumpnu0altomictyt aDranmo;t0 rtnmr3oodop r nvo;s)sexrxopoy4opeemnvt s)sDua(m nu1aeeniociyd m2elnmp u0artoxr ia1fa r nvo s0t2tr(r3no1lltn fei ()aDtrx  ;t0oetnmietydlaDrau s;u0 lenxf tytlp elnvsls s2um(r3oo1optelicilt) rtm(ront0alxoifeiyslm2eanvp (4 lenio io1oa  an i;s0s2xm(m ny1llt livsl(  2tmu pou1olxnmoctydfm2ulumpnt0aeenxr tydom rlneslt0texrim no4optnlivs ( a2rmxmp;u1tlxomoeiltfa2um(mp;() rtrmo3io1latr uvi;t) 2xr(rpnu1lp eliesa(f rurxmonu1tpe iictyslaDrlnvp;t)aeermociadfaDe i o s0srtr(opio1openmfcil(farrrxr ;u0oee ifcild sDrl(mo t0 lxoifcia1opDr neo s teuoimpiy4omtnmicsls)aDua(mpou4optnif3ils m2uln p t4alxoio to1fpte i ilt)tetoxo oodolen nesa() 2ururoot0alen octaslm uluvs;(0 eenxfcto1lptrlieils0 rtmimpnu4al nmfet (  rum(mpnt4tlxn octltlm rmu snt0aexrmo3oo1fpt aivo;( t2ur(o iudap nmfetatfsDtr(mo;t1tee  ictasfm rln s;()trenmo iydlateauvo s0 ruoxr oo4ll emiesl( a2uaum oo1alx moeiydls el(vs;t4 etnmfctadfaDe ieil()trurxmpiodop e ieias)srrmum ot0aptnmoeiyt a elu o;(0tlermfcoytfmD anvslt  exr(r iu4lm n ivia(fsrumu ono0oleoioeils a ea(mo;t0tetnxr3ootlatrai il(0sexr(m ny4om nmiesas s2tax pnt0apt mo3tadlsDelu o;t0tltrmociodlmD  ieilt)s2tr(o iudal  liesa( aDurxmp;o1aleo o3ilt mDua( sn()tlenxr oytfpD  uvo;(0sexm(mpoo4llt mfvil() rrmurpnt0aet mociad a2emnvsn()aexoxr totfa eanvs s teurim iu1opeemfcsa(  Dtmxmo;t4opto fetlsla rlnms t4 lenmo3iy1oaDe u o;s texmxr iydap emieta(fsDrax o;t4aexoii3tasla uln o (0arenxrciadfaD lieols)sexm(opnydapeemivt t arta(  ;u0olto feiysla2uanvs;() eenmf3iotfptrln slt  2xoir3io4llte ivta(farumxroou0tltnio3iad aDraums;t0 rxomoctotfaDe nvi t)seto(o oudoltemnes t  rumxm no1opx ioeild aDem(mp;(0aeeomr oydfmt luvo;s)t2tmir3oy4lm n iet (faDraxrp;u1apxn icildls uauvpnt)altrio to1om eaivi s0t2uo(rpnu4amt  ies (fa2ua(moot1teeniociydls2rm( onu0trtrioctotfmDeaivslt0t2to(m ny1amt  nci s aDtm(m ;u0altnmo3iatls2rmuvsnt0texoxf3oy1omDelnes ()srxr(mpiodom  mneta(faDtmx o;o4oeenifctydls elu p u4 exomr oa1lm elivo t texoxrpio4ol nlict (farumum ;u4tpt mieiasla2umnvo u0alenio3oadfaDrauvo;t0truo(m3oudopeemfesltf rtm(  ;u4optnmfciyt a2rlnvs;(0arxrio3tytla
\ No newline at end of file
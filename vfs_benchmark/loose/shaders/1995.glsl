@@ -0,0 +1 @@
+nvi s)teuo(o3ou1optelfvs (fsDtrur oo1alxnmiciadlm2uanvo t0alxnio iadomtraueo;(0 exmxmpiy4lltelfvsas)arraur ou0olenmfeiatfm umnvs ()treoxrciadlmt  nvilt s2uoir nydoleelfcs (  rrm(mpnu4olenifetydla ua(vsnu0 eenxfcia1oatrlies (0trxrxm3ou4lm n ieslt  Drmurp;t0aee io3iasfaDem(vp;() ltrio todfaDraieo (  rxoir3nydlp emncsas) Dum(m ;u0oetnmf3iydfmDeau onu4altrio ia1opt aiei;t0t2uoxmpiy1lpen fcs t) 2tax poo4aeto o3iltfaDrmu s;u4aexriociydla ranes;s0 rumio3oy4amen fvtat  Dtmxmp;u1olx moeildlm2el( s u4tetoircto1lptelivi () 2xr(m3iu4om e nesls artmx  ou4tpx mfetys s2uanvo u) lxnxfcto1lmtrlneo;()trtrxm nydll  mivils arumu  no0aexn ocias s2eau p;u0tltomf3ia1op rauesls) 2uoxm3no4oltelivtat)a2tm(r nu1tee moetld a rmnvonu0trxrmfcty1faDrlu s s)tetmirpnudamenmnei t)srum(rp;u1tle  i3iad s2rl( snu4 rxoxr3totfp eauei t)sexoim3iydop nmfvtltfs2trxrooo0opto i3iydfa2rl( o;t) rxomo oydop e nvi;t0 exoiopoydomen fvias)sDtru pou1tpeoiictytla rln snt)tetrmocootomD lnvs ()s2urxr nudll elfvi ()a2raxmo;t0oltn ociytls2eln s u)tltrirciadfmDe i s s0srum(m iydlmtn neilt)sDrax oou0oltoii3ilsfsDrl( onu4 exrmo iydlp e ueslt0srumir ou4al nmfeslsfarrau  ;t0altnmf3iytfa el(von(4aleomr todfp  ln slt0 etr(r3oydop   neta( s2rmu pou4tlt ioctyt sDem(vo;t)tltnxr3iotop  anvs;s) rurxopiu4olee nviat a2tr(r nu4oleo feiyt a eanvsnt0altomfcoo1faDrauesl()srxo(mpny1op  mnvtlsf 2tr(  ou0texnmf3iyd sDum( p (4alxnmrcio1la rlueo (0 rxrxopoy4lm  lieia()sruaur nu4optoiiciatlm2em(vs (4aetoircio1omt li i;(0trxo(o3oy1lltelivtat sDtaump;u1teeo ictasfsDrl( s;u4 etoxf iy1lmD livi;t srtoiopoydaltn nvs tf rrm(m ;o4olxo o3ildfs2rmump;() ltrxociy1fptr i s;s) exm(rpnu4lpte fcil(farraxrpou0opx if3ildls2eaumsnt0treoxrciodfateaiei;()srumxr3ny1op  lfciltf Dumxr ;u4oleoiietyt s rmumpn(0aexrif iodfatraivs t)teuo(m nu4llt lfvsls)aruru onu4tee  oetasfm rlu pn(4 lerif3oy1fpt lueo;s  rumxr3iy4openlfcs t  rtaxmpou0aetnmfetlt aDuan p;(4artrxoctotfp  au ilt) eurxm3iydape  netatf Dum(r ;u1texnio3iat s2ulnmsn(4 lerio iydfmtelnei;t) eurxopiy1amtnmnct ( sDur(  nu1alto fctatfs2emn o;u)aexrxocto1fptrlueo;()truoxmpoo4llt mics ( srrm( pno1aexomoetydfm umn o;t0trxomrcta1fmD aieo;t)srtm(rpio4am emivslt aDtm(m oo0aexn iciadfm2rmnvs;(4altrxf3ootomtraivils)seuoio3io4ol  mnvta()a2umxmono0tpxo f3iat sDul( p;t) etrxf3oadfmDr uei t0 rtrirpou1omeelnvsas)srtruroou0teeo ocilt m umnmsnt) exnircia1lm  lu o;(0seuoim no1olte ictl( aDtrx  ;o4oleo ociad s uan o (4arenxf oydlm eaivs;(0 rumxm3no4ameelnvt t) rtaum nt4tee micilslm2ua( o;t4aexrmf3iadfp rlivs;t)setmir iy1lmeelicsl( s2um(root0apxo oeiydfmDeluvo;u)altoirciatlaDrlneo;t) 2trxrpio1lp nmivtat) Drm( oot0apxnii3ilsfs uaums;u4areoxo3iatfpt  i i;t t2xmiopio1ope mfvs s a2rau p;u4apeo ieils mDeauvs;(4trxrxf3oytomDelieo s0truoxopno4alt lictl( s2ur(mono1aet mfctls aDemuvp;t0arxrmr3oa1optr ues;t)srtmxr3oy4lp elivils)arumx pno0oex  fctat m2umnmpnu0 exnir oa1lpD luvi;t0t2xrio3oodamtn nctls)arrmx pnu0teen octysfm eluvs ()tetoxr io1omD aneo t)sexoir3no4amtn fcs tfa2ra( p;u1olt if3iasfm2el( o;t4alxnmrctytfp rlieo;()srtr(r oodlptnlfcil(farrm(mp;u4opx ii3ildlm rlnmp;t0treoxr3tatfmtr ueol(0 rxrir ou4ale  fcslt) 2rr(mo;o4tet  oeiasfmDuan s u)aetoxf ia1om e nvslt)trxo(r nydamtnlivslsfs2trurooo4oleoifetatfsDrluvo;t) etrmrciydom ean ilt)srum(r3nydlle  fesl(fa2rr( oou0aeeoifctlsfs rau p;u4altoioctodfmDeauei;s  2uriopiy4lmtelfcsat)srta(mo;o1oetnii3ias s uau p;(4artrmfcoadoat li o s)t2xrxo3iu4olte fvtas  Dua(m ;t1tpt mieiatls2rauvsn(4artnir tydoaDraueol()srumimpoy1ll nlnvs sfaDrm(mpot0openmfeiad aDrln o;(0artrif oo1faD  ues s0srumxrpny4amen fcs tfsDum(  ;o4oeto fciydfm rmu o;(0areomo3ia1fm eaneo t0 ruo(opiu1amee ivs sfa2uaum oo0tpxnmociat mDean p;u) ltrxocta1fmD lues;s)t2xm(opiy4altemneslsf 2ua(m ou1tlto ieilt m2emuvs t4trenmf todfmDrlnei (  rtmxm ny1optelfes (fartm(mont4tee mi3tld m2ea(vo u4tlxrxo3ia1fmD luvols)texoxopny1ll emivtatf Drm(m ou4aee  iciysls2uluvp;t0 lxoxf3oadoa e ies t0seum(m iudll  mfcsat) 2uru  nt4aet moctlt m2ua(ms;(4texomr3oy1latr u i;t0trxrxm oy4lmeelncsl(f Dtru p;o0tlxn f3tls s2uluvpn(4 rxnmr3iydlpDrlieo t)t2xmimpoy4ap  mfeia( a2rm( oot4alx iociatfm2ranvs u)tleomf3iy1om rlnesl(0sexriopoudoptn feias)a2um(mo;o0aexo ietyt mDumnmo t0 rxrmrctydlmtraivs;t0teuo(r3ou1ol   iei ( arra(rono4olenmoeildlaDrauvsn(4aeeoxr3to1fmt aivi s0srtoxo no1apte nvs t a2rmu  ot1aeeo f3ildla2ul(vp u0 rxomo3iotfpDeluvi (0t2trxr io4lpenmnetlt)sDtau p;o1tleoif3tadls umumo;(0 renxoctatoaD lneo;s) 2xoim io4lme livt () rurxmpnu0aetn ietld m ea(mpn(0 rtrmrctytlm rau s;(0tetr(mpoo4al  lfvtlsfs2tmu p;o0apxn o3tydlm rlnvs;(0 ltoxrctytfmtr u i;()s2tm(r3io4am  mnesl(fsrumxmpno1aptnmocildlaDem(mp u4 etnir tatfatr u i;s)srxr(opoo1lme licsls)srumxrpou1aeeoiictys s emn onu)aexnio3ootfm  lu o s)trtm(m3iy1ame mneiltfaDtaxr no0texnif3tytfm ea(vsn(0areoxrctytfp eanvo s0s2tmxo3ny4lmenmnesa( sDraxr no4optnioeiaslm rm(mp;u0artnmr3todlmDrli s ()trtrxr3iudll nmfcs (fa2uaxrpnu4olxo o3iyd m el(vo;u4altoircoatomtrli o;t) rxrxo3iu4am elnesatfs2uru ooo1tex mfcilt a2rm( o ()aeenir to1opteaneo;t s2uoim3iy4olen fcil( a2trxm oo0tleomfeiltfmDemn sn()altoxr3ta1oa rln sls) rurxr3iydlp elnvil(  rrmu o;o0aex ifctydls2rluvs u0teeoircoa1lmtran o ()tetmxmpnydameemnvslt) 2tr(r nt0tpe mfetlsfsDrl(vs;t0 reoxr ty1lpt ln ol( seum(m3iu1amt licta() rurxr ;o1aet  ietydlsDulnmp t) exrifctodlmDraieo (0 2xrxopou1ope lneta(fs2ra( p;t4aexn icild s ulnvp t0arxrmfctydfaDr u o ( seurirpnydalt mnctas)sDuaxrpoo1alenmo3ilslm eauvo;t)arenxo3oatfm r iei;( srur(opoo4ale lfci ()srtm(rp;u1ole iietytfmDrm(mo u0 lxrifcoa1fp elneslt) 2um(opnudapenliciatf 2umxrpnt1tpx ifctasls rmnms t4aexrxf oa1lpt aieo;s0setr(opoo1llenmnet () 2rr(r ;u0oltoio3iyt mDuaums;t0 etrxrcootfaDe uvolt0 2xrimpnydomt lnesa(fsrtmu onu1oet if3tldfm2um(ms ()texomo3to1fpte n ol( seto(r3ny1om nlfvtat) rtau oou4tptn ieilt a2rlu p;()trtnmf3iotoateau olt) ruo(o ou4ol n fvsls aDum( p;o1teeomfctatlmDulu pnt0 exrxr3ia1fa   nvs;t trumxrpnudam   nctl()sDurxm nu1tltomiciys s2el( snt4aexnxrcoadfa rlivol() rxmimpny4altelnviat)srraxr ;t0tpx ioeilsla2el( p t)artriocta1lpteaiei t)sruoxm iy4ole  fetl( s2rr(mpnt1aptnmf3tadfm uanvs (4 eenxocootoat  n ilt trtrxmpoy4optnlfvi (fsrrm(m nu0alxn f3ils aDea( p u0altnxrciydfpD au sl(0 rur(o ou4lp  mfet (f Dtmum ot4oeenioctasfa umums;()aetomf todop  li olt)texo(rpou1lmeemiesa() 2rax p;t0opeomfeiytfmDrauvp t0 ltrxoctodlp raivolt truoxo3ny1omenlnvtltf Dtaurooo0tee mo3ild mDem(mpnt) rtoio3oy1optranei t seumir oodll   fvtlt)aDumurpot0altomi3tlsfm umuvp;t)artrmocoatlat  nvs t) etoxr3oodlmt micsasfsrrm( o;u1openmieiadfaDua(vsnt4altnmrcoadfat aues t0t2toim iy4al emietl() Dtmxmonu0apeomoeiat a rln o (4 rtomr ootfaDeai s;t) rtmio no4ole  nctlt aDua(  nu4aetnmiciatfaDuan o;u0 rxnifctytoa eanei;t  rtoxo nu1olt mivtasfarurxmp;o4ole ifeiyslmDelumpnu0arxniocoy1laDe u o;t)sexmxo nudale lnvtltf Dtaxrpno1oleoio3tlsla2rlnvo u0alermfcto1fpDraieil( tetoxm3nydopt liei s)sDrmum ;u1tlt ifctyd aDum(mpn(0aexnmf iodopDe ieo;t0sruoim3no1lmenmnei (fa2urxr ot1aeeo octyd mDeanmo u0tltoifcootoaDrli i s  exmio3oodomtnmfetls  rtm(  ;o0opx ifciasfm2em( o (4tlenmr ta1fa eli s s srurxo3ou4lmeelicia(fsDta(r nu1opt  fcilt m ulnvsnt)arxnir3ia1oatrauvi ()seurir no1ap nlivi s srtmx  ;t4tleomieiyd mDuln p u)aetoifcoodlpte iei (0 exmxrpiudlm elfesasfarrr(roou1ale ifeiys mDeanvo (4 rxomo ta1lmDr i o t)srur(mpou1apeelieslsf 2taxrpoo1aetn iciltfa2eaumo;u0 rtnio iodfa elieslt) 2xr(r io1alt lfeiasfs2urxmpoo0oexomfcias aDrmu s u0 eeoif io1lptr i olt  rxrxm nu4altnlfvt s sDtm(r no0oleomiciys a2rmnmo () lenir3oa1oatean ilt)t2tm(o iu4lm n ivtls)aDurxrp;o0teen fcild aDumn p;(4tlxoxr oo1lmte n o;()trxoir oy1optnlfcs s)s2uaum oo1tlxo octasla2uanmon(4tltoxf oo1opDeauvo t0t2trxr3oodomeelncsas  Dtr(m nu1oetnifeilsfaDra(ms u0tleoio oadfm  ln o ()s2xoio3ny1altnlnvtasfsDrm(r ou0tetnifeiadlaDeanvp (0aeerio tadlpt  ivil()s2toirpiudomte fvil(f Durumpot0tpeo oetldfa2elumsn(4tleoxfcoydfp rli ols  rtrim nydopeeliciasfa2rmu o;t4tlxomocils a2ranmpnu0aleoxo3oytfa eaivi s0srumxo3oodll  mncs ()sDtax  no4aee  ieiys aDrm(ms u)aeeoifcootlpD auesls0srxoxrpiy4ope  ivs tf 2raxr nu0tpenmieilsla raump t)aleoxr io1fpD lneo;( texoir oudlle  ivsl(  rtaxmont1tee mfetadlsDea(ms;t0texrir totfp rli o;(0trxr(m3iodopenlietas) 2tmu p;u1oeeomfeilsla2uluvs;(4 etrio3oatla rlieil( s2xrxopny1lltemfet s artmumo;o1texnioctas sDumu s;u)artoircty1oateli o;s0 ruoxm3io4ope livt (  rrax  ot0olxn o3tasfmDem(ms (0trxnmo3iotlat aiei t0setm(m3oudllen fcsas)s2uru p;t1tpe moctad s2rauvp;()treoxf3oa1om  lu o;(0srto(mpoodaltn icilsfa2tr(m ot4oeeo ociyd s ranvo (4 rxomf3iotfpDrlueo s)texr(r3oy4oltemnvias a2ra( oot0aee ii3tlsfa rlnvsnt4 rtoxrctadla elivi;s texrir ou4op  miviasfa2tmx p;u4oet ii3ias aDuauvs u4 eeniocoo1lm rlueo s0t2xr(opio1ap nlfviltf 2rau onu4openiociatlaDeanvp t)artoifciotfptrauvilt0s2to(mpny1apt livtl( aruaxmo;t4oetn feiasfs2ranmp t4teermocoadlaD  u ils)trur(m oo1lltelncs s srrm(moou0tlenmiciytfm el(mo;() lxnmr iadopDr u o s0t2tmxr nydll n nctas)a2uaur oo1oee mo3tasfsDumnmsnu4alxriocoatoa rlnvo;(  2xm(opno4llenlncil()aDurum nt1oeeo
\ No newline at end of file
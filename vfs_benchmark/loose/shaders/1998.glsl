@@ -0,0 +1 @@
+ues t0 2umir3iudapt  fct s) Dua(r nu0oex ifctasfs2rmums u)trtrir ta1omDelnvil( trxmio3ou4ol e ivs s sDua(rpnu1apen oeildfsDemu s t4arenir totoatean s;()trtoimpou1lpenmfvsasfs2tmxrono1oleniociasfmDrl( s (0tleomf oytlmt auvi s)srxrim3io4oleemfvtas)s2rmu  ;o0aetnmietysfsDrmn s;u4 exrxr3tatfpt  nvs;(0 2xo(r3oo4omeelfeils s2urum ou0tlenmi3tadfa rm(vo ()artoxocootoatr i s ()trtr(rpoydal nmncs sfarrmurp;o1opeo ieiyd m2em( p;t)tetoiocoatfaDe neo s0t2uoxrpno4omt  iet s) 2tm(ronu1ole mfeils aDemuvonu)tlermrcia1om elneo;t0 rumxo iu4lmt  fetat) Dtau oot0oleomfeiat mDrl( o;(4aetrif3iydopteau s s)sexrim iu4ome mncsatfsDtax p;o4oeto fciydlaDranvpnt)altomr3ta1oatraieo () 2tr(m iydomenmivt tf Duru oou1oleo ietysla rlu s ()tleoxo3oadoatr nei t) eur(r3iudapen icsa( a2rru  no0tleo i3ildfm2ranmpnt4 etrxo3iydlaDran s;(0setrxo3ou1ame lfciatfarraumono0aeeoiociltfmDelnmsnu4trtrir3totlpDraivslt) rur(m iudal n feia()s2ua(r ot0tpt mfetld s2rm( o;(0tlerxr3ta1fp  aivs t) etoio no1altnmivsas)artaxrp;o4oeenmi3ild aDrmn pn(0trtrxo3io1lmD aues t  rxoxo nu1open fcs tf 2rmx  ;t4tpe mf3ilt sDrlnmo;t)alxrxf3oa1lmt aieo;t0 2xrxr iydlmenlivils arraxr no1alxoifetatla rmnvo;(4tltnmr oodlpt  ieo t)t2to(mpou1apenmnci t srurur ;u1tpe  o3tydfa uaump;u0teeniocoatom  anes ()tetm(mpnu1op nmnvtl(fartmxr ot4aeeo ociyt s emums;u4 etrmr iadfa eauesl( srtrio3oo4ale mfcslt)artruro;u0alxo oeiatfm rmu o u)arerifciy1faD  ueolt teuoxm oy4ap   fcta( s2rrxrp;t4aleoifetlt aDemu s t)aexnmr3tadop rai i ()srtoxm3ny1lpe  iet s sDrmurpno1tpenmo3ilslm elumo;u0teeomoctotfpDrliei;() rxoxo3iodlptnlfeta()sruaxm ;t0aeeomfeildlsDumuvs;(4texriocoadlmDr ueo ()trxm(r3iydll nmfeia( srtmxronu0alx if3iaslmDum(vonu0 rxrxf3tatlmD  ies;t) 2xrxm io1lp emnesa(fs2rmx pno0apx  fctat mDelnvp;u0areoxocty1faDrluvols)seuoxm3iu1om nlfcsasfarrr(  ou0opxnioctatfsDrmu s t4texnxo iodoptrluvo;s0t2xmir ou1ameemivtl()a2trxm ;u4ale mfeilslm2emu o (0arxrmr3tadlpte n il(  2urim iu1optemfctls aDrmurpno4opeo f3ilsfs el( pnt0trxrxrcootfatelnei s srumxmpno1apeemivil()srum(rpot0apt  fetydlm2ea( s (0altrxo3ty1faD  nvi s) rtmxopio4lm   nvil(fsrtax  nt0tlt ioetys a2rlnvp u0trxnio oatom r u s;t0teuoxo iu1amtelnvsa() rrrxm oo4olt  oeildlaDumnms;u)aexnxoctodlmDelueo s t2uoimpoo1omee fesas  Drm(  ot0aet miciltfs ulumo u4tlxrmrciy1fpt  uvs;t trtr(o iodllt mnvsas)s2umuroou1oee  ociltla rl(vpn() etrmr3oatla r ivi;(0trto(m3no1altn feiatfaDtr(ro;o1aexomi3iatfaDulnvo u4arerxf3oadlaDrlieo;(0 2xrim oo1ap elivils s2raurpou4texnii3ias s rauvs;() ltrmfcio1lptrai o;t  2to(m iu4opeelfetl(  Dtmurpnu1alxnii3iys m2umu on(4 etoio3iotfpt lu i;s0trtr(rpou4ol emfcs tf Dumx p;u4tpeo f3iys aDea(mpnu)texoxfciodlmt aivo;( trxmxo3nudamee fvi t sDua(mpnu1oex miciadfs2ua(mo;u)aexnmr3iydla ranei ( srtmio ny4lmee fcsl() Drmu o;t1oleoio3ilslaDumu p u0tltrxo iotlm  liei;s  ruo(opoo4lp  mies s)a2tr(mont0tpx  ocilslmDumums u4tlxoxrcio1oaD  neo t seuoir iy4lme  nci (fa2tau pno1oetn fcilsfmDrmu s;(4alenif3tytfmD aneo;() eto(m3ou1ap elnvsasf Dtru pnt1olx ioeiat mDel(mp t4altrmf iodlaDean ilt s2trxo3oodopte ivtl(fartaxrpnu1alxnioeiyslaDumuvo;u) exniocoatlp rai o s0trurxo3oo4opt mivsas)a2ua( poo1alxn iciys sDea(monu0 exrmo3iydfpDranvs t) 2xo(opno1lle  ivt sfaDumuro;t0alenmf3tldls2ean s t4aeeoifctytlat lu ils)s2tmir3nydlmenlnviasf 2taurpot4oee mf3tydlsDeauvp t)tlenir tydfmDeanes ( sexrxmpiudoleemneilt)aDrmx oou4olxo fciatlm um(mo u0 rxrir ootoaDe ivi;( t2toimpnu4omee nes (fsrtrumpou0teen o3ild a rmump t0 lenxocty1lmDelivol( s2toim io1openlfvia( a2rmurooo1oet iictldfs ul(monu0aeermo iytoaD  nvs s0 rtmir3ny1openlietlt)aDtmur ;t4apeomo3tltfsDeau o;t4arermf3io1om r uvil(  rtmirpio4olenliesa(f rtax  nu0alx micilsfaDem( o t)alermr3tadlpte nei (0 ruoxo oudaltnmfcs t) 2rrxro;t1opxn oetasfmDumn o;(4aeenmocio1fpD anei s srum(opnodal  lnei s)sDururpnu4olx iiciys a um(vs;t)tltoirciy1oateli sl(0 2toxm3oo4omeemfvsl()sDtrump;u0olenmociydfm uanvs;t4 rtrxr iodop elnei t0srtmir3oo1optemies ()aDtax p;o1alto ocias a emnvs t0tetoxo3oodfaDeau ols0sexrxopny1aptemnctat)arta( oot0tlto octysfsDeau o;(0 rtrmr3ta1fm e uvs (0texrirpoo1lp  mncsat)sruru  ;t0aeenmo3iytfaDrmuvp;t4 rtnxr3oatomDranvo;s srurimpoudaltemfcslsf rrr(mpno1ape micilslaDuauvpn(4teenxr ootfmDeanvi ( s2tm(o3ou4ll e fct ()s2tmx  ou1tlx io3iltlsDrau p;u4artnxoctadoa raivils) 2xo(opoudlle  nvta( srtmurp;o1oetnif3iltfa ua(vp ()trermrcoatopDraivslt0srxo(o iu1amt lictasfa2ta(mont4olxo fciys aDea( s;t0 eerxo3oa1oa e nes s0sexr(r oo1oleelfvtls)srtr(rp;t1olxnmfeiydfsDumnmsnt4tleoxfcio1om   iesl(0teto(opnudll e fci tfarurumonu4oexnmoctydlsDel(vo ()aetrif3ty1fmDrlnei (  2ur(m oodapt mncsl(fartm(r no1olt  icilslsDulnmo;t4trxnxr ootfmDrlieo t) rxrxm nodaptemivsa( srraurp;u0alx mfeiadla2um( onu4tlenmocoydfm eluesls0 eto(o iydlpte ict s)sDuaxmoot4tpeomfeiatfa2umnvp;u4 ltoxfcty1fmte uvi (0 2ur(m3ou1omeemnvsl(fsDumurpot1tpe  i3iysfs2em(mp;t4altrxf iy1oaDran i;()s2tm(opoo1ll   fvsl(f rrr(  no0tltnmfeiytfa2rln s;t4trerir todom e ivo t0s2tm(opiy4op  liei (faruaumpoo4aptoiietld sDemnms t) lxriocio1fmD liei;s)t2tmxm oy4amtnmnet (f Dtru p;o0ape mictatfmDrlnvo;t)areoir3ia1opDraiesls0 2urimpoodol nlivslsfaDrr( o;t4aexo ictyslaDea( sn(4 etrif3iatlptr u s;(0texr(o nu1omtnmnvsa( aDurumpoo1aetomfciatfa umuvo;()alxomr iytfp  lueo;(0seuoir io4lmtemnvsat aDumu ont0tptnmfeiadfs uln o;()artnxr oodoat anes;s)s2umxopiy1opte icilsf Drau oou4ape ioetls s2um(mo;u0altoif3oa1lp   uei;(  etmxopio1lmte nci ( s2raxmono4oetniieiad s2rmnvp (0arxnircoa1omtelivolt  eum(mpnudll emieilt) Dua(  nt4tltoiicilsfs rl(ms u0 lxrxo3todopDe neo t0trxrxm iy1llt  iciltf Dta(mpno1apenmf3tls sDumums (0tlxrmr iadfaD  ieslt)t2toxo oy4lpenlfcil(fsDua(r ou4apx  f3ildls eanvonu0treoxo tadfmtrlneilt)srumim3oydap emfesatf 2rmu pno1aleo ictyslsDel(mo;u4 lxrmociytopt aieo s0s2uoxo3ny1ap emnvtas arrr(rpoo4tptn i3ils m2rmnvpnt0alxomo3oo1oatr i ol()srurio iudome lncsat a2trxroou1aee mociatlaDum(mpn()arxomf3iytomD lnes;s  2xo(m iy4lleemfvi sfarrmxmoot1olenifciadfs rl(mon(4altnirctodlmDeluvo;s s2uo(o3oodalt mnetls artrurpnu4altnif3taslm ua(vp;(0trxrmf iydfpDeau slt  rtoir nydom e nvtls)aDrmumono0alt io3ildlsDum(monu4aeerxo3todlpt aues s0t2uoxo nu4lp n ivt tfsDrr( ont4olxnifeiat a2rl( onu)tltnirciadlmDr nei;t)t2to(o3nodolt lneia(fs2um(ront0ale mocilt sDeanvpn()arxnif iotfm   nvo;t)srxmxm oy1lle mnvia()s2rrur nu4opt if3ils a2uanms t4treriocoadoatr ieilt)s2triopny4lmt mivt ( artr( onu1opto f3tltfm uanvs () rxoxf oydop raieo s)tetmxm nydol   ict (fa2tmur oo0tpxnmiciatfa rlump (0tltnmfciatoaDeln o s0 rurim3iy1lleemfesa(f Drau  ;u1tle  o3iltlm rmn o;(4tetnio3tytlm  ln il( s2xm(r oydop emfei t aDumur no0olxo o3iat mDrmu p;(4artoxr3ta1la  an o t0 rtrim iodap nlncsls srra(rpou0teeo i3ilt sDulnmo;()arxrmo3tadlmDelneols sexo(mpou1ol nmfct (f rrau  ou1aeeoii3iysla2rmuvp t4 rerxfcio1fpt  i o;s) rto(r3iy1openlfcil(f 2rr( poo4tpxnii3iysfs2um( p;u)trxomr3ty1lmD  neilt)t2uoio3ny4am nmfvslt sDtaxmoot1tet  ieiat aDemu p;u4 rerir3ia1faDrlies;t)s2uoir oo4op elics ( sDuax pou1aeen fetltlaDrmnvo;t0tetnxoctodomDrau o t texo(r3iu1altnmics s s2rm(roou1opt mfeiasfmDrmums;u0altrir tatfp   n s t)s2xmxr3io4lpeemiet t  2rmxrono1tlxo oeiytla2ea( sn(4alxrmf tatfmDrauesl( trxm(o oydlltnlfvsltf Drm(mpnt0opxnio3iadfa em(vsn()tlxnxr3tadlp rau i;( srtoio io4optelietls  2tru p;t1oltnifeildfmDulnmsnu4tetrif oydlp rluvo;s  2xoimpiu4alenmnvt (f rrm(r ;u1olt iociltfsDul(vs t0trtnxfctotlp   n s t s2trio oo1al  mivt ( s2tmu  oo4alx iociasfs2eaums;()arerirciydop  auvs s)texmxr iydope  fvilt sDraxmpou0tlen fetatlmDeluvsnu4 ltrxo tadoptrlieo;t  eur(o3iodapte ieilsfa2uaxroou4aptn oeild s uanmont)aeenmoctotlat  i s;s0 ruo(o iu4alen iesasfs2trx  oo0alto i3tytlm rlu o;(4aetoifciytoa  au slt teur(r io1llee nes t)s2rr(  oo0tlx  octydlm2rmnvs u4alxoiociotoaDrlnei;() etoim3nodlptnmfci t) 2ua( oot1opto fetytlaDum(ms u4 rtrxfctytopDr uvs;()trtoim iu1lmeemfcils) Duaum ou4olxomieiyt s2rlnvo (0artnircoo1om rluvo;t) rxo(r3io4am n netls) Dtru poo1tlt mictadfm2umu o (4 etoif3iodlmDeli s (  2xrxm io1llt lfvilsfsDraxr ;o4alxo fciydfm2rmump;(0altomf oadfmDe ieo t)s2xmim iudaltemnet t)aDurxmpno1alto icilslmDra(vs;t0artrxrciodlp   uvo (0 rumio iu4ol  mfcilt sDraum ;o0tpxomi3iad a em(vp;t0tltoxfctadfp rluvo;( setriopny1lmtemneiat a2tmu  oo0tetoii3ilsla uluvs;t0aetomo oadfmDrluvi;t  2xoxo nu4oltnlnciat s2tm(mpoo1aet  ictydls2uaumpnu) reoio oatfp  au s;( srxr(o io4lpt lnes s sDuaxront1aee mietasfa2rl(vo (0texrxf3iy1op r uvols trxoio3nydlpe  fvtat) rtrum ;o0olt  f3iyd a ran o t) rtnxf3oytfpDe neol( seurimpoudolte fci (fsDum(m ot4oleo fciydfsDel(mo;t0 rermfcoytoa eaneo (0 2trxm oy4lmeemnesls srurxr ;t4aptoio3tldlm2ua(monu4trtnxrctotoa elivil()s2xo(rpoy4ope lncsatfarraxroou4tetomieiyt sDulump;u4aeeoifcoy1lpt  n i;t)truo(r3iy1optemnctasfartr(mo;u4tetoiociys a em(vs;(0tltrxo3iotlptranvilt0s2xo(o3ny1amt lnvt (  2rmx o;t4tex  fetls m rauvs;t4tetomf3oatom rli o;()t2trxrpoy1al nmfcsl(  rrm(rp;o4aexoiieiad a ea(vp;u4aeenmrcio1la eaueo s seurxo3iydopenmivsa( aDumx ooo1aleniiciad s2umuvs;(0 lxrmr3todomDr iei (0srur(r nydaltnmfcilt)sDtrxr ;o0apx micils mDemuvp () eeoif3oadfaDrau ilt teuoxr3iudllenlfvi t  Dtaxm ou0ole mo3iadfmDrmumo;u4 lerir3iy1oate i s ()teumxmpno1am e fcias  rtmxm no1apeo o3tytlsDuluvp () rxnif3oo1om eau olt tetm(o3nydol  lfvilsfa2rmxrpot1tltoiieiyd a elnms;u)trtoxf iydop e u s s0s2xoxopiy1alee fvta()a2tau pno1aeeoiictyt sDuaumo t) eenmo3todla ranes;t0t2umio3iydop   nctlsf Dtmx  ;t4aeenio3iydla2em(vpnu)arxrxo3iytfateau o s0 exrxo3iy4omte ncsat)arta(mp;u4olt micils a em( p;t0artrxrcoytomD aueo (0seumim3iu4alen ivil()s2rmump;u0tlxomo3iytfaDrlnmpn(0teeomoctatfpDe nvols)sexrxr nu1omtelieias)sDrm(r ;u4alxomfciatfs2el(ms (0 etrxo3tatoa  aies;(0 etoio3io1olee nvtltf rrrum ;u0oeto ieildfsDrlu snu) leoxo3iodlmte uvo;( sruoxo3no1ll emieta(  Dumurp;o0tpeo o3tlslm uanmsn() lerxo oydfp eluei s0 rxoxm oo4al  mncslt)artrxmont4opt mictydlm2ra(msnu4 ltoio oodlaDr neo s)t2xrxm oy4ome  fvtlt) 2tmxrp;t4ole moeiyt m2emums t4arxnir ty1op  aies ()s2tmir nudaptn iet ( aDumurooo4oleomieiatfaDraump t4 exoxoctatlmtr ieols  2xmimpny4lmt mfei () rta(ro;u1oleo i3ilsfs eluvsn()altrxfcoydfpDe uvi ()srtrirpio1olee nvi sf Dumu pnu0oleomfciytfm2ranvs u0arxoio iytlaDe u i;s seuoio3oudamt lfcils srum(mp;u0oexoiieiatfm ran onu) rxoxo iodomt anei (0srtm(o iu1amenmiei sfa2rrxr no4teenmf3tydfa2ulnmp t0arenxo tadoaDrlu o (0texm(m3iydlm emfeslsfsrrau pot1oetnii3ils s2eauvon() lenmfcty1oa   ies;(0texr(rpoydamt  feslsfarta( p;o4altnifeildfm rmn s (4 lxnif3ty1fp  luvs;(0 exrxr3ny1lpen ivsa(  Dtmxm ot0tlenmi3iasfm rl( sn(0texrxrctadfmD lueils)srtoxm3iudlpeelncs (f 2umumo;t4oltnifctad m elu o;u4 lxnmf oa1fmtrlnvi;()s2trim3oo4open icilt srtrxr ou1tex mfctldlaDulnvpnt0 ltnmocoatomtrluvi s  ruoxmpiudom  mnetls sDurxroou0oex ii3iatls ua( pnu)aleomo3ta1oaDe n o t)s2uo(mpou4lp nmivta( aruaum ;o1ole  i3iytfs ulnvp;t4 renxr3iotfp elues;s0 2xrim3oy4ap nlfcsls)s2tmurooo1tlt mociytfm ulumo t)areomrciytfpDrlnvol(0tetmxo iydlptnlnvt ( s2rrxrooo4oetoiieiat sDem(monu0 lerxr3iatfaDranvilt0 2uoio ou1omen nes tf Dtmurp;t0tetn fctlsls emnmont) eeoxrciytfpDr n sls0 rtm(rpny1lle  fvsatf rta( p;u4tpt  i3tas s2ra(mp;t4 lxnir io1fa r nvi t0 2xrxm3iudlp nmfcsls aDua( o;t0aex mieiyd a2rmuvs t4tltrif tadoa  livi s)seumxr3ny1omenmfvt t  2uaur nu1teeo i3tysla2uauvpn() etnif3iy1fat ai o () 2umxopoy1lmeemfetasf Dtau  ot0optnmf3taslm rlump u4 eeoxrcoytoa e uvil() rxrim oo4apt  iet tfs2ur( pno0oleo f3tltfaDemn s t0aexnxf totlpDeauvo ()texr(m3iydlp elivsat s2ua( oou4ale mfciytlsDel( p (0tlenio3ty1lpt  nvi;()trtoxo3oo4ame  nci t a2rrx pot1aetn ociltfa elnms;(0aleoifcoydfm raueo t)teurir oy1ole  neiatfaDraum oo4tpxnmociyt mDel(vs u) exnxf ootlpD lnvo;s t2umimpoudlmee ncsat)a2tmu ooo0optomi3iltls rlumpnu0 rtnxo todop r n o;t0 eumxr iudlle  nctlt  Drmurono0tlxnioeias m2eluvo;t4aetoxr oa1opD ai s s0truo(mpio1aleelfeilt  2tmu  nu0tpx  i3iadlmDel( pnt0treomf todom rlueslt srtm(opny1llt  neils aDrrum oo0alenmi3tydlsDem(mpn(4texnioctotoptrau ol()s2xoiopny1oltnmfeils)a2rrumpno0olxn icildla2rl( s;t)artnxf3ta1fmt  neo;s srto(rpny4op  mici s) Durumoou4oetn ociyt s uauvo u)alxoxo3iy1opDrlnvolt texoxm oo1am nmfvtl(  rtrurooo4aexoii3iydlm rm(vp u4 lenxo3tatomteau s;t0s2tm(o nu1lmtnlieil(f Dtm(  ot1aee mo3iad mDeln on(4trtoxf oydfmD  nei;s0seumir oydal   nctls aDrmum ou1alx mieils m2elu p;u4trenioctadfaDrlu i;s trtmir iy1omt lnvtatf Drru poo1aexo fciadlsDrlumpnu)arxnioctotlaD aivil(0 eurxo3io4amt lfvtls s2rm(mont1aee mo3ilt mDrluvp u4arxrmf3io1fa  livi s) rtoir nodam nlivtas) rurx  no4opt mfciytfs2ea( p (0tltrifcoy1laDe u o;s trxoir3nodam e fci (faDumum ;o4aleo feiat aDuauvs t0tltomf iodlaDe nvi s)t2umxm3iydop nmneta(fs2ur(monu1tex  feiatla ul( s t4arermo3iodlpDeanes (0tetmirpoo4am  mieslsfs2uax  ;o0altoii3iasfs uan p u4tltnif ta1omDrauvslt s2xrir3io4ole lncsa()a2ua( pot1olxo o3ias s2umu pn(4alxoif3iytop   nvilt  ruo(r3ou1om  lfeil() rurxmp;o1aetoioeilt mDrluvp;u4tltnmr3totfptr nes;s0trtr(opoodom emnciat a2um(  ;t4olto f3tas s2um(vpnu4teeomo3ootoptr nei;() rtoio no4ole mnviltfsDtrxrp;t4apeo oetydla emumsn(0tetrxo3ty1fp  aieo;s0s2xrxmpny4olen iciasfaDtaxr ou1oexn f3iltfs2umnvon(0 rtriociotfat  i s t0sexrio iodlp nmfviasfs2ra(rooo4aeenmiciyslm umn snu0 rxomfcta1fmDrau ilt)s2xo(m ou1lmeemivslsfs2ta(mont0tlxo feildfm2ea(monu)aleoxr3tydfmtrlnei;(0t2tmxopoy4oltelfci (  2umx onu4aeeo i3ild m2elnms (4 exoir3iotla  liei (0sexoxr ou4op e ncsa( aDrm(rpou4teeomo3ildla2uluvo ()texnmr3tatfm e nvo;t0 2xo(mpiu4lp nmfetat aDur( pot1aeeoiicilslmDeanvpnt4artoiocoadlmDrln s;(0setmio3oy4ol   neils a2rauro;o0oexoifcilsfa eln p;() lerio to1oateli sl() 2uoxm3iy1lmt lfvtas)a2tmxr no4altnmietld m2rl(monu4aeenxociotlat aneilt tetr(m iy1am nmnvtas artrxmonu1oltomoeiyt a rm(vp t0arerircto1faDeanvsls teuoxm iydapenmfeiatfarur(r ou0olx  fciysfmDeau p t4 lenxrcootoaD lies t srto(o oudllt  icilsfsDurx  nt0oetnmictadla rl( s u) leoxf3oa1optraieo ( teuoim3oy1lleelfeiat)aDrr(m nu0tpe ii3iyd s rmu o (0alxomo oytlmDeli o (0teurxopoo4lptelnet (faDraxro;t0apt  fciysla rm(vpn() ltriocoy1fmt  nvi;s0trtr(r oodaltelfctl() 2uru pnu0ape iicilt m ua(vpnu0teeomociodla elnvils0 etrir3io4omt lict t)a2trur nt4olxo o3iltls2ulu s t0 rxrxrciytfpt lieo;( s2xoxo ny1lme mfctatfaDur( ooo0oltn oeiytlsDel( onu4areomr3tydfpDelneo ()srtmxmpoodole mfvs tf 2raxr oo4aleniieilsfsDran o;(0arxnxfctotfa r ivi s0s2xoxo3nudom nmivs t sDrauro;o1tptnii3iadfm2emnmo u4teerirciytoa rln s s trurxo3nudlpe  icia(f Drm(  oo4aeeomfciasla2ea( s t4 rxoif ty1la  li slt0 exoim3oydlmte ieilt aDtmxr ;u1ole  oeild aDranvs u) ltoioctodfatelieslt)s2xm(opoo4ome  fvs ( s2umurp;u4teen i3tytfa2ra(msnt) exomfciy1opDe u ils t2xmir oo1aptemfet ()s2trur nt4tpenifeilslaDemnvs () renmf tatlm elivils0texrir3ny4lme mivi s  rururpno4ole  ictatlmDuln s t)teeoir3oodlptean o t srxr(m3ou1op e feiat) rumxm ot0oet mi3iatfs2eaumpn(0 rxnir3ia1omD  ieol()t2tr(o ny4am   ivilt  rrr(r no0oltomi3tad s eanmp;u0teermf3iydfpte i s ()trtmxm iy1amte ieias sDua(m ;o0alxomictadfsDulnvs u4 ltrir3ootoa e nvo;t)trur(m ou4olte fet t srtm(rpno4aeeomo3iytfa eaumpn()altomoctydfmtraieo t s2ur(o oydlmeelfeil( sDrrx o;o1apxo f3tltlmDuln s;t)alerxo3iydoateliesl( s2xoim3nudoltnmnes sfs2umu  nt4ale  iciyd sDuanvp;t4texnmf oodom e ivslt0sexoim3no1altnlnetas)aruau pot1oet moeiltla2ra( s u)texnio3oydopt  ivs;s)t2to(m io1apeemivslt srum( ooo1oee mictadfmDeanmon(4trtnxf ty1la raivolt0t2umxr3oudal n fes ( aDtmxro;o4olt ifctadls2eanmp;t0tetrmo oydlptraiei;t0texoir oo1lm   ivi t  2rr(ro;u0alx mfctadfm2rm(vsnu4trxrxrctydop e ieo;s0t2tmim io1olenlneias sDtrxr nu4tpeomi3iydfsDuanvp u4 lxrifcto1lmDr n ilt tetrxm3oy1al e icia(farumumpnt4oeto o3tytfa ea(vo t0 etoxo tadoa elivolt)s2xmxr3iu4ol emieta( sDuax  ot1tptn i3iys a2rauvs;u)trtrxoctotfpt auvi;t setmxm3iu4ap  lfci tf 2ur(mo;o4aleomo3iyd aDem(ms;t0 rxrmo3iodfaD  ieolt0 euo(r oy1llt mncia(f rumumpnu4tet  ociydls2ul(vp;()aleomr todlat  n o;() exmxmpnudlmtnmies sfsrua(ronu4teeomociysfa ulu s (0texnif3iotlmD  nvo;t srxoxo3oo1ale lieils)arra(  no1tptoif3iltlsDeauvp t)arerxr iotfp  aneil( s2toio3iy1al elivta(f rtmx ont0opx mo3iydla em( o;() lxoir oytlat lues t0trtriopnu4aptemncs sf 2urur ;t4apxnmf3tytfm emump;t4aetrmr oy1op   u i (0t2um(m oydopen nctls)s2ur( p;u1tle mfciatfm2ua(vpnu)treomo iodlpt  u i ( texo(r3nudlp  lfcs s) rraxronu1apx miciadlaDea(mo;()altnmo3oy1fmteli o;t0srtr(r oy1olen ivsat) 2uru  nu0opeoiietlsls2um(vo;(4teeoif3oydom raivo;t) 2uoxr nu4lmenlnvsa( srtrxrpnt1oexnmi3tatlsDrl( on(4 lermrciytomDe i i;s)t2trxmpiydomtemnet ( arrm(  ;o1teeo oeiyt s ra(mo t) ltomr3todoa   i o t0tetoxopiy1omt mnvt sfa2rr(mpnu1altomoeiaslm2el(vp t)alenir tytom r nei t)srtr(o3iy1amtnmfvsltf 2uauro;u0tetn fctlsfaDemuvo t)artnir3tytfat an s;t seur(mpiu1om e ncslt arrru  ;u4olxn fciatfaDua(vo u) exnio3io1fate ieo;t0t2xmxmpnudalee nct ( arra(rpno1tlxoioctydfaDel(vs u4arermf3ia1lmte neils trtrim nu1apt  net s)aDtmum nu0opt  o3iyd s el(mpn(0alerxo3tydfatelnes s t2xr(rpiu1omtelfvta( srtm(r ou0alxn iciytlaDemnvp u) exoio3iytlat auei;t)trxr(m oo1ap nlivsltfartm(rp;t0oleo oeiat s uluvp (4aleoxr3tydopDr uvsls) 2xmxopny1lptnlncta(faDraurpnt0apxoioctyt m2em(mo t4arxnifctotfmDelnvsls truoxo iy1lp n fcs sfsDta(mo;t0tpt  fetyt m2rl(ms t0trermf3io1omtelueo t0 2uoim oy1opeelnvilt)aDtmxmo;u4oexo i3iyt m2uaumpnu) lermf3iydlpt  i o;(  eur(r3nu1ope  fvslt)aDumumonu4oeto ociltls2rmn s t)aeenmr todlptrln i () 2toio3ny1oltnmicsas srtmur ;t0aeeo o3iysls ul( o u0texoio3iytfmDe u slt)trumxopiodllte iesls)sDrr( p;u4aet ioeiyt m umn o;t)aetnio3oo1la raneils) rurxr3io1op  mfct (  2taxrpnu4apxoifeiyd s umn sn(0 rerxf iatlmt ln s;t0seumxm3nydop   nvt tfsDtmum nu4opxoifcilt sDumn pn(0tltrmo ta1omDeai i;(0trtoxr oo1amtemnvtls)sDrru oot4tpen octlslmDean o;(0 rxoxf3iodlatrli i s) rumxr3no1lm n fcil(fsrumum nu0optoifctysfa eauvp;u0tetomf3oytoaDrli s;s0t2tmxm3oo1am emiei t aDumumooo0ape  octydfa2rl(ms;u)texrxrcoatfpDr nvs t) 2xrxmpou4ale lnciat sDtr(ront0tpxniieiydfsDumn on(0arenmr ta1om rauvolt0 rxrimpiy4lmenlnciatfsDumxmp;o1tpeomictyd sDel(mo;u0trxnxr3oa1omtr i i;t)trtrxo nudalen fvi s) rtm(ro;u0ope ioeiadfs2ul(vp;()tlxnmf3oy1omDranvs s) 2uoir3ny4lmtn fci t aDur(m ;u0alxoio3tyt a eauvpnu0tlerir3ia1oa  au ils) rtmxr3iydlpt mfvt tfs2raumpnu0tlx mf3tas a2uan s u0alxoxf iatfm rli o;s0 2xrxo nydaltnliet t  rrm(mooo0alt ii3iydlaDumuvon(4aeenmf to1lm ran s () exmim3ou4op   ivtl(farrmxr ;t1apx  fctas s2umu p t4tlxoxrctadoatrlu o;( t2tr(o3no4ol  mfei sfsDtr(m oo1tpxnio3tadlmDrau pnt0aetomf3oodfm elies;s0 etmxmpoydope liviatf 2umuront1apxomiciad aDeanms;()arerxrcoytoptelivil()setrxo iodal e ivs tfs2rau oot1olx  o3tld m2rlumon(0aeeniocoadom elu o;t setoxm3nydom nlivtltfaDuaxmo;u1oetn ietyslm2rlumon(4teeoxociydoat  i o t)texr(opiodllee nvs ( aDumxr nt4oexomfciasls rlnvo u0aleomr3iydlmtean ils0trumxm nu1amen ivilsf Drrxr ot1texo fetadlsDrau p (0 leomf totlpDr nei;()srxoim io1amtn fvtlt)a2rrxrpot0tpenmoeiat sDrm(mo;(4 rtrmoctydlptr ivo;t0 rtoxmpiodal  mfeils)aDrr(ronu1aex  f3tytlmDrl( pnt0 rxrmrctydfatrlneo;t0s2tr(r3iudll elncs ()a2um(m oo1aptnmoetatfa2uluvp;u4 lermf oytfa eanvs t  etmiopiudlmenlivtlsfsDtrumpou1ale mf3tldls2emu p t4tetrxr iodlp eauvi s) rurxr nu1lpe mivil(farrr(  ;u1apx mietldfs emumo;u)tltnmf to1omDeln il(  etrxm nu4lme lnvs t)srraxr nt1tpxnmiciad a2uluvo u4texrif3tadlpDr u s t sexm(o ny4ol   fesls artaurpoo4oex ifctls m2eanvonu0arxnir ty1la e u sls) 2xr(o3oudlp  mnesat) rum( pnu4tltnioeiad m2umumont) leoxfcoodlmDeau slt trxoxmpou4oleelivsa()arumxrpoo4apx iictyslm ranmo;u0trxnmo3oytfmD an s t0truoxr oy1oltelfvs s artr(moou4oetoioeiat a ua(vs t)trerioctytlpDrlnei;s0setriopoy1lmte nesas srtruront0oexniieiyt sDemnvs t4 eenxo to1fpt  neslt) etrimpiu4llenlivtltfsDumxmp;o0optomieiasfmDea(vo (4altrxf oatomDr u s ( tetmxm3oy4alee fvs (fsDtrxronu0olxomo3iys aDraumo;(4alxrxoctotom eln i t tetrirpou1lm   fci (f Dtmur no0altoif3ilt sDelnvs u)texoxf oo1lm eln olt sexrirpiy4om  mfetatfsrrruro;u0aex ifetltla emumo (4 reoio tytlaD luvs t0srtrio3no1lpenlnct s aDtaur ;u0oex ioetadlaDraums (4trtomo tytfaDrlivo;( s2trxm3nodomtn feta(f Durumo;u0oexomo3tadlaDemn on(0aexrmf3ta1fmDe uvil()trxr(o3nu1ome mfesl(fs2umxmp;o4olt iieiasls em( s;t) rtrmrcoytoaD an slt) 2xmio oodamenmiviltfsrum(rpoo1tpx mo3tad mDranvpnu)tltoxr iy1omD luvolt)srxrxr3oy1am e nvt ( srrr(r oo4aet mictysls2ul(msnu0tleoif3oadoaD auvi;s)seuo(m3nu1lmtemnvsas arrrur nt1openifeildfs rau o u0tetrxf oodlpDr i i;( teur(r3oudalee feslt)srtmur ou1aetoiieiys m2emnmp;t)alxoxociodlaDr ivo;( s2uoir nu1ll elivsl( artrumo;t0alxn fctltlm2rlnmp (4aetrxociydfmtrluvo;() etrir iydlmt lfvi ( arrr(m no1aeeo octatlmDel( o;(4 eerxr3iotfa  auvo t0texmxr3io4lp e fvtl(faDuau  no1aexn i3iytls eluvsn(4alxrxfctatfmD anvil(0s2xmxr ny1lpeemfcta()aruaumpnu1tptnmf3tldlm emnvp t)aetnxrctodlmt  n o s seto(o nodap e ietlsf rumxmpnt4texnmieiyt a2rln o (0 eenif oo1lpt aueolt) rxr(r3iudlpt lnvi t)a2tmx  oo0aptn oetldfs rlu p u)tetomo3tytfm  lnvs s)t2tmiopou1lm emivilt) Dtmxmo;t4apenifeias sDranvs (0 eeomo3iytopteaieo s0teuoirpiydllt  ici ( a2urumonu1tpt ifeiadfa rluvsnt)tlenmf iatoa raivs s0teumiopnu4altn iesls  Dtaxmpot4aleoio3iltfa2elumo;t4 etnmoctotoptrauei;s  2trim3iodope  nvi tfa2raxroou1opeo o3tysfsDuauvsnu)aeerirctodop   ieo s)s2trxmpnu1lm e nvsat  rra(ront4tlx  o3iydfmDea(vo;(0trenxr oodom  luvs ()trur(r iydoptemnvi sf rurumpno1tpe  oetatfa2ul( o;()tlxnmr iotopDr uvil(0trtrimpiodape lnvtls) ruaurpnu0olxnmo3iytfaDrluvpnt4areomrciytoatrlu o t0srxrir3oo4apenlicsas a2tru  ou1teenmf3tadfm2ra(vs;t4tlxrif tadlm rlueilt0t2um(m iy1lp n ies () Dta( oou4oeeoif3tydls ulnmp u0alxnxocty1la rlnvs;() 2toimpio1op e fvt s  2tru  ;o4tlxnifeiat m rau p;t4 lxnio3tadla eanes () ruo(o ny4lmte nctl(  rra(m ;t0opt  oeilsfm2um(vp;u4areomo3iadomtrliei (0 2xoio iydlptemnvsl() Draumo;o4opxo ociyd s2rmump;u)trenif3todoptr ueil()t2xr(o3oy4lpeemiesasfs2rru poo0tleomo3tltlm uau p u4 lxnxr tydfpDe uvi s0 2xrxopiy1al e nvt t  Dua(m no4alto i3iadfaDrlnvs (4tlxnxr3tatfaDrlivs s0 2urir oodamtnlfcils aDtm(mo;t1olx mf3iadfm rmn p;()tltrmf3io1lateaueolt0t2urxmpiy1op nlnvsat s2trxr ;o4ape ioetltlm rmumo () eerxr3oy1oaDrlueslt) rurir3nodomtnlnci (farrr(m nu1aexnmfctadls2ean p (4trxnxociodoptelueil(0s2trxm3ny4am   ivt tfa2urxroot0tlx mi3iysls umu s t)tetnmfctatlmtelieo s  rtmxmpiudlp  lfeiasfarrrumpno1oexnii3iaslsDemu on(0trtrmfctodfa  livi;s0 2xrxrpoydole  fci ( arraxmpoo0tex  oetyslaDrl(ms;t4tltrxociytfat  i s s0 rxoxm oudlleelnei ( sDtau o;u4oexomfetytfm ea( s (0aetnmf3tydfmDe neils0seto(opiudom elfcsasfs2rau pou1olto oetyt m2ua( p u4tltnxf3oa1oatrluvo t s2tm(mpnudlp  lnvtas) rtau p;t1aexn i3iatlsDrmuvp;t0alenir ia1fm r ueslt0srur(m iydaleemnesa( s2ur(ro;t4oeen fciysfa2ra(ms;t0 ltoxo iotlp r ivi t0trxm(m3oo4am e ici sfs2ta(mo;o0apx io3ilsfmDumump;t4aexoxfcoo1fmDraueo t  rxr(m ny1aptemneiat) rtrur ou1oexnmoeiytfs2ea( onu) renir oytlmtrluesls0s2uoim3no1lm  mnvsl() 2trx  no1tpx  oeiatls elumon(0tlxoxf iotfmtean i;t0t2tm(r3ou4om emivsasfs2ua(  no1alxn f3iytls2eanvo;u) exnmrcoadla  li i;s trur(r ou1apenlfetas arua(  ot1apeomiciatfm2rau sn(0treriocoo1op rlu s (0 rum(o ou4olt mivsas)aruau  ;u4altn ieiatfm el(vont) renmr tytla   n sls teur(opnudam e fetat)s2rru o;t1teenmieiytlmDumumont)arxoiocoydfptrluvo t0 2xr(mpio1lpee fcia( srtrur no1teenmoctatfaDul(vp;u)aeermr3oytoat au i t0texoxmpoudaltnlfei tfaDrmu pou0olx  i3tasfaDem( o;t4 exoxo3tatfpteauvi;t0seum(rpno4ale  nct ( aDtmumoou4teenmieildfmDrl( p;u4tlxnir oo1lp rluei ( s2toxopou4optemieilt a2uaurpno1teeoioeiadfa2ulnmsnt0tltnmr3iy1latelieo;(0t2uoxm3iu1lm  livi t  2taumpno0aeenio3tld s ua( sn(0 eenxr oydfpD au sl() rtr(r3iy4omen fet ()srraxrono1teeo i3iydfs2ranvp u)tlxoir3to1fpDelivi s  rtmim3nudol  mnct tfs2rr(r ;o4olx ioeiyt mDeluvs;t) lxomfciodlm e ies ()srurxopnu1omeemfeslt  Draurp;o4aeeoiociad a rmnmsn(0 rtomf3iadlm e ies;( tetoxm ou1ape lnetat  Drmuroou1oltnmfctadfs rmnvsn()texrmf tadoa r u i;t setrxm3nu1ame mieslsf rrmumo;t0apto fcilsfsDea( o;u4tlxrio ty1om  lnei s)srumxopnydoptnlfvtasfa2rmurpoo1aet  i3ilsfa2uanmo;t0aleoxf oa1fm   uvo s0s2xrio io4am e fvtl()artrurpou1ale  fctldfs2rmn s;t)arxrxf iy1omDrlneo s)texo(m3oodomt mfeiltf 2uaum ;o1tlto iciysfa2em( s t0aexniocto1fp elues;t) etr(o nu1op e ncsls)artmxr ot0opx mieiadfa2rmuvsn() etomf3iytfaD livo;s0s2xo(rpiydlmen icil(f Draumont1oltomoeiadla uauvont)trtnmo oadla  livs (  rxrxr iodole mfei t srrm(mpot1tlt io3tysfaDelnvonu4teenxfciadop   n o;s)truo(mpou1ll n nesa(f rraumoot1tet mfcias s2rm(vsn(4 eenxf3tatlm eaneil(0 2to(m3io1am   nvi tfa2uaur no0oleomfciasfsDeaums;u)teerxf3oa1lpDeluvo;()s2xr(mpiy4om e feias)aDuaxmpou1teeoioctadfsDel(vp;u0trerio3ta1fm eai o t s2xoxr iudol nlnvt tfarrmu p;t4tpxo ocildfs2eau o;() ltnxf3oa1lat anvi;() eum(m nodam elnvi tfa2ururpou4texoiiciadlm rm(vp u4 rtrir3tydlpDeai i s0 eumxo ou4ame lfvil(fs2tr(r ou4olxoiicildlm uaums t4tltnxr oadfpD  nvo;s)t2uo(o3iydamenmfctatfaDtm(mpou0oleoiociat a2uln p;()aexnmo3oa1fa rluesls0 rtoimpio4optnlfvtl() rtruroou4alxnmocilsfm2ul( p u4altnifciodomtrlies;s0teto(rpiy4lpte fesa(farrax  oo0tlt  o3ildfs ulu sn(4 rxnxrciatoaDelieo (0trurir3io1apenlivsa() Drrxr ;t1aee  fctas sDemn on() ltnmr iytop  ln sl() 2xoxo3nudopt mfvt () rrmu p;u4aetoif3tyt m2em(ms u0teeniocty1lateau i;s0seuoxr nudoptnmfei sfaDtr( ono1oeen fcildfm2um(ms;()aetoxo3oo1oatranvi;t t2uo(opoodamee nesat)artaxrpno0tptoif3tltlaDulnvo t0tetnmo tadlmDraivo;( t2um(o3no4ll nlnes tfs2tmu  ;t4tetn fciatlm rmnmp;t4tlxrir tydfpDr nei;t)trxr(o3oy1ol nlncsa(  2ta(r nu1olx ioctasfa2uluvpnu) ltoxrciatlat li s;( t2xm(o ou4lmt mfeil(fa2tmurpoo1opxoii3ilt mDrmuvo;(4 exnmf3iatoaDrauei;t trtoirpiy4ole lnctltfa2raurono4ape mi3iysfaDra(vp;t) ltrmoctotla   nvi (0s2xrxrpnodlm elfeia(fsDrax  ;t1alenmoetyslm2eau o;t0 eerif3ta1lmtrlu s;t) eumxo3ou1op e feilt aDrr(mono4apeniiciytlmDua(vp;()artrxf3oa1lmD  i s s0trxmio3io4omenmfct () 2rr(mp;o0oexo iciytla2uaums;(0tetrio tadoaDr u ol()t2xmirpnu1omtnlfct (faDrau  ;u0tpxo fcild sDuluvpnt4teeoxo ootfp ean i t0s2xoiopny1opt mfvil()a2rauroou0apx io3iydfsDean p;u4 rxomr oydopDeanvs (  ruoxo3oo4openmicsat  rtmxmpno1optnmf3ilslsDuanvon(0 etnmo3totla e i ils  2xm(opio4openlncil( sDrrurpou0aexomictltlm2ulnvsnt4trxnxf3io1fmt lu sls0teto(rpiy1amenlictas)sDrmx onu0tpe iociytfa2emumpnt4 eeomfcoatom e nvils  rtm(m3iydamt  iet s artaum ;o1aexnifeiad a ean s;t0artnio3todlaDrluvils0texo(m no1lm nmneiatfa2uaurpoo0tlxnif3tydfs eau pnu4alenirctotla  aieo;s0seur(o3oo4apee fesl( aDrmxmpou0alt mo3tld a uan p;u)tltrmfcoatfaDean ilt  2uoxrpiydom n nei ()a2um(roou4oetomociadfa2ulumsnt)trxnxrcoo1latr i sls0sexrxm3nodal  mnciat srrau ont0oltnifctlt a emu pnt4artrxociodfpteaivi s0t2tr(o3oudope lfetlt)s2urxmonu0apeo f3iytla rmnmpnt4 lxrxfciatlptelnvs t) rxrio3ou1omtemfctlt aruax poo0olxoii3iytlm2el(vs;t0aexoxf3ia1lpDr u i;s  euo(opoodaptnmnci t)sruaxrpnu0tpxo o3iadla rlu s;t4 exrxf iotlp eai slt setr(o nodlmtemfvi (fa2rauro;t0alt mfctat aDea( pn(0trxnircootoat li o t0 rxrxmpno1lp elnvs tf rur(mont1apt io3iydlm2ulu sn(4 eermfciatom rai sls0trxr(o nu4aleelfcsltfsrumxmoot0aeen ieiytfaDemumsn(0alenir oatop e ieo ()t2xoxo oy4al emietlt srumu oot4opt mieiadfaDumuvs (0aetoxo3ia1laDrluvi (0 2xoxr3ou1lmee nct (faDtr(r ;o0apeo ocildfm rmuvo (0arxoifctatfaDrlnesl( sexr(r nydop  mivt sfs2um(  ;u1opxnioetyslm2ea( o t4 eenmrcoy1om rlneol()tetoir3ou1ome  icil()s2uaxmoou0oleo fctlsls ra( p;u4 lxnmr3ia1faDr nvol()t2trio oudamtnlfvs s sDrr(moot0aet iieiyt mDelnms;u0 rtomr3tytoat lneo;()trurxo3iy4lpeemieiasf Dur(mo;t4oee  ociysls ua( o;(4alxrxo totlaDr nei s  rtmiopoudamt livt ( a2trxr ;t0opxn fetydfa2rauvo;() exoxrciy1fa e nes t  etm(r3oo4om  mfeils)a2rax p;u4oltn oeildls eluvp ()altoif3iodfaDeluvo;s  rxrir nudlmenmfvsls) rtrumooo4tetnmi3ils sDrm(vonu4 rxomfctodlat lnvsls  rtmim iodalt micsasfaDur( pot1ape mo3ilsfaDrlnms;() exrif oadoat  nvolt) 2xm(r iydamtelnct tfsrrmx pot1tle miciydls emu on()artnmr3to1laD lies () etm(rpno1am e fet s a2tmu  ;o1apeo i3tys mDranmsnu4arermr oa1lm e i slt  etmio3io1llenlnvsa( srrr( o;t4opeomi3iltfa rmnms;t) reoxoctatoa elieo;t  rtmxrpou1llt  ncsls srtmx p;o1tex mfeiyt mDua(mp;(0trxrxocto1opD anes s setoirpiy4open ivs t) rrax pno1tetomicildfm2rmu o;t4tetoir ta1op rlueolt0 etrxo3oodole mnvtlsfartmurp;t1open o3tyt a rmnmont0 leomr3oa1opt aivi;s)sexr(m3nydape  neias) 2uaumpou1aexomf3tatfm2elnvo;t)tltoio3oadoaDr ivi;t0s2trim oydlme lneia(  rur(r ;t0tlx  ieiysfsDelump t)tltoxo3oo1lateli sl(0t2tr(m nu1omtn nvsasfarurxmoot4tpxn fcildfaDraumo t0trtoxo3iadoatrluvs;t teurxmpnudlmte neta() rua(moot1oeeo iciad mDumnvont)tlxrir3oytfm rln i t texmim3ny1olen fes sf 2ur(rp;t4tlxn ietltfs rmn o;(4alxoircoatomDean i (  eum(m3oydomt  fvi sfsrtm(rp;u1ope ioetadfa2rln s;u0aetomfcto1lptraies t)s2xoim iydameemnct t)s2rm( onu0oltn o3ils a elnms t)texrif3oy1oa eanvs;t)s2ur(mpiu1ope lict ()a2tr( p;u0oexniietyt m rlu s u)tlxrxr3todfpDeaivo t) rxmir oudap e nct t sDua( oot0oleomietatfsDemnmp;()treoxr ta1lp e nvs;(0srtr(r iy1lpeemfcsat a2tmxm ;o0oetomietadlm rl(msnu)aexniocoy1fmte i s ()seto(o3nodllte ivtas)s2rmu  ot0tleoioetytfs2elnvont4artriociadlm   ueo;(  exmim3oodll e ietls a2tm(ro;o4altn feiatfmDum(vs () lerxfciodomtrauvi t) exmxo3ny4lpte icsatfaDur( p;o1aeeomoctadlm ea(vsnu4 etomfcoa1laDeln il(0seto(o nudomtnlnes s)sDumu  ;u4aee iiciyd a2elu s;(0alxomr iotlpDrlieol()trtm(m io4ol nmivils a2urx  ot0tee  ieiytfs2ua( s;(0 rxrmr3oytlmDeaiei ()srtm(o3nudllen fvt s srrr(  ;u1aeeoifciat a2rmnms;t0altnxr3totlpDrlies (0t2ur(mpnudapt mivilt)artmurpot0opxnifctys s eau pnu4 eenif iytom rai sls)setrir iudome  fct sfsDraxr ;u1opx ioeildfs2ra( o u0aexrmfcta1faDrai slt sexo(m nodlmtn fctlt aDtr(mo;u4opxo ictyt a umu o;(4trtnxo3oatfa r iei;s) exrxm nudalte nesas  2trump;o0apx  ieiat s2umnmp;t) reoirctytfatran slt  rxoxm3no1ole mictlt) Dtaxro;o4opx ifciasfm ulu p (4tetrmo todlmtran ilt  rtoxm3ou1ap n fcs s) 2tr(rpoo1opx ifctys a rmn p;(4trerxf3iodom r ueo;s) rtoxo no1al emfcs () Drmu pnt1apt iietatfm rmnmo;u0texnxr3iotoaDrau o;s0tetr(rpio4om n ietlsf Dum( ont1aptn f3tldfsDeanvo;u0 lerio3oytfpDrlies;s)srxmxopoudlle  ici s)a2taxmpno4open feiytfa2eanvs;(0 lenio iadoateanvs;(0 rtrxo3oy1ol elnvi sf 2rax o;o1aetomiciydfa ul(mont)aetoifcto1om eauvilt) 2xmiopiy1llenmictlt)aruru p;o4aeto fciadla2elumont4 etnio iydfat aivil() rtrir3no1llenlnvsa(fs2trum ;o4apxoioeiytlmDranvp t)arermf oa1fmteln i;s)sexoxopiu4al  lietls) Dtmxroou0olx ioeiytfaDea( o;u) lxnmrciytlpteln ilt)srumxr nu1alte ietls)s2uaurp;o4aee if3iyd a2emnmpnt4 exnxrciatfat lnvs ( setr(m3io1ll   nes tfsrtm(r ot0tleomi3ils aDeanvsnu4aeeoio ty1fp e ivi;()trtr(r3ou4omenmfetas  2raxmpnt1tlx  octadfa2rmuvs u4treomo iodoa r n s;( s2urio3io1lmenlnes (farrrxmpno1alen icilt s2um( ont4aexoif3tadoatrauvo;t s2ur(m ou1opt  ivsas)a2rau pnt4tleo fctydfm2rauvs () reoxo oa1la rlnvs t0 rxoxmpoydal e net t) Dumur ou0tle ioeiydfm2umnms t0tetnmr3iadlaD an s;(0 2toxmpiudame mncslsfs2rrx p;u4apto feiltla rauvo (4artnmrciatoaD au ils)s2xr(opnu1am elfvsas) 2rm(  oo1tlx mf3iytlsDemn snt)alxomfcia1om rluvi t)s2uoxr3iodomen fet t  Dtmxrp;o4tex ifcilsfmDeluvo t0 rtoxo3ty1fatelivi s) exmxr ou4oltelfvtas  Dua( poo0aet mf3tydlsDeau pnt4arxnif oydfatraivo s0texoirpnodamte fvsat)sDuaxrp;u4tltomoeiadlm ulnvo t0trxrxrctodfpte i i t  rum(mpno1lmenlnvsa( a2ta(r no4altnif3iltlaDuluvs;u0 rtrxr3io1fp  li o;t)s2trio iydapt  icsasfaDraxr ou0oeenioctltlm rmnms;u0altrxf iotom rlnes s sruoimpiodlpt mict t) Dtr(ro;o4tpenmicilsfaDumn ont)arerxo3totla r n i t0 2xo(m ny1alenmnet (f 2urxr oo4aex  feiydla2eauvo;u0 eenxo iy1op eau i t0s2tmir3oo4omenlncsl(fsDtmur ot1teenmictltlsDuau o u)texoxrctydopDeaieo t) 2tmim iy1amtemivias)artmumo;u4oltoioctyt m2eanmont4 rtrmoctytfpt  ivsl() eur(r oy4op nmies s  Durxrp;u0opt  icilt mDean o;u0tlxomf3totfmteanei s)srtrimpnydapeelncsas)artmxr ;t4oltomf3tls m2rluvo t4texnxo iodlmtelueilt)seumxo no1oltemnes s  Drrxmp;t1oee  feiydfs ea(vp;(0tltoxfctytlpDrlu o;t) 2xoim3oo1ll emivslsfarua(m ;t1teeomi3tlslmDeluvo t4 etrif io1op  ai s s)tetr(r ou1ap  mnvs ()aDtau pot1aeeomietldla2uau pn()artrxo totfpt  u i t texo(m3oo1lp  mict t a2rrxrpnt0tptniiciydfmDeaumo (4texnio iy1oatrli o;t  eum(opio4amenliciasf 2tru  nu1tlt ifeiasfs rm( s;u4 rtnxocoy1opDrauvolt0 2um(rpnu1ole mici t)srrm(rpot0tet moetltfaDumnmp;u4aetrxociydopt  nvsls)texrxm oodlltnlfvias aDrmxm ou4opxo i3iytfa2ul(vo t0aeeoir3iytfaDraieilt0 exrxm ny4am   ieia( arrax o;t0oleoiiciltlaDemnvs;u4arxnif oy1fpte uvol(0s2umxmpoudllenlfvsa()s2urxrp;u1aetn i3ildlm rm(msnt0 eermf3iydlpD lnvs t  eurir3iydalt mfeil()s2ra(r ot4oetomietadlmDra( p;(4 etomfciodlm eauei (0 exr(o no1lptn fcils  2rr(m no0tpe ii3tydls2rmn on(4artrif totfaDe i s s) 2to(mpio4lltemnvs t)sruauro;u4tpt  f3tatlsDuanvp;u4texrxf iodomt aies;t  ruoxo3iodom  mnesasfarta( oot0altomfeiys a rlump;t)tleoxfctatlate ieols)s2uoimpnudamenlfvsa( artmumo;t1tpxo i3tatla2rmumonu4texrio3totop rlnvo s)s2toio3iu4amtnmivtat srraxm ;u1oexo fcild sDrm( ont4 ltrirctodlmt  iei s  2tm(r3oo1ll  mfct s  Drrurono0tle iieiydfs elnvsn(0 lxoio3to1omDr iei (0 etoxo nudome mieilt)arra(r ;u1olxnii3iasfa ea( pn()aleoif3iatfp r nvs ( tetrxo3nodlmtemiei s artmxr ;u4ale ifeiytfs umnmpnt)arxnio iodlpt au s;s  rumxopnu4op  mfci () 2raxmp;t0tetnmo3iltfa umu ont) etnxo tydom rai i;( srxo(r3iudoltnlnvia(f Dtm(r no4oeeo oeias aDea( o;t4alxrxrctotfpDranvi;t0srxr(mpnydal n fetas artru o;u0aexoif3ias aDulnmp (4trenmf3oydlateauvs s) ruoxm3ny4oltemnvs sfs2ua(moou0aeenifeiyt aDuluvp;t4aeenmo3iodlpD luvo (0 rto(r3iydamtnlneiat srrmxm no4alxo i3ilsfm2ran p t0alxoxf iydfmDr i ilt0s2tmxm io4lptnlicils aDrrumpnu0ape  feiad mDuluvont4tetomo3oytlpDe ivo ( setmxmpiu1olt lfvtatf Drr( p;t4oeenmo3ils aDuln o u)tltrxr3oa1fmDrauvi;t)t2xoiopoudal emfctas a2ur(rpoo4tpen i3tydfm rlu s;u0teermo3iytlat  ivo;()trtrio nudap n fcilt s2ra(m ou0tpxoii3tydfm rm(vs;u) lxrmf iatomDrluvi t)s2trxo3oy4aptnlnci t  rurx onu4tlx mieiytlm2rau p;t) rxrxo todoa eln o;s)teumim3iu1alenmfvs (fs2rmuro;u1altnmieiltlaDem( o ()tlxnxf oodfmDr nvo s s2urir ny1am  mnct sfa2rmxroot0oet mieias sDrmu p t4altomfciotla r n i (0trxo(r3iy1apenlnvtltfa2ua( ooo0ale  ociytfsDuan p u4alenxr ootoatrau o ( t2xo(opoodoptn iviat) 2taurp;t0ope ifetld sDelumo;u4 rtoirctytoptrlivi;s) exmxmpiudom elnciltf 2ra(mp;t4tex  octlsls2uanmont) lxnif iodopDe i ols s2xoxm3nu4al n nctas)a2rrumpou1ape  fciad m ra(msnu0 ltomociodomt  uvilt0t2uo(m3iy1am   nci tf Dumuroou1aeenio3ildls umuvo () lxnmrcta1lateli o;t0t2trir3oudapen fetlt)arraxmpnt4texomfetaslm2ua( o u0 ltomf tytfa  anvsls) rum(o3oo4altnmfctlt  rum(r ;o1alxnmf3iysla umnmo;u4 lxnxo3totomDe nvo;()trtr(o ou1ame lnvtls srra(r ;u0opxomoeiytls2ua( s (4 rxoxo3iotfa eaies;() eurxm3io1openmivi s a2um( p;t0tle  o3iatlaDulu onu) rerio3oydomt luvs (0srurir3ny4ap  mfctasfarra(rp;t4opxoiietysfsDumuvpnt4 ltrxrcto1op rln o s0teuoio no1lpe mfvt s  2uaumoot1opxnmo3ildfm2rau o;t)tlxnifcta1om r u i;s0 2ur(r3io1amt mfvtl()aDrmu o;t0olt ioeiytfm2rmumpnu4teeoifcty1faDe ieo ( srumirpio4lp n iviat srrmu  nt1ope  o3tyd aDrmnvp;(0altrmocia1la rauei;s t2toxo iudlptn nctas aDrmur ou4aeenmoeiltfm2uanvp t4aeerifctotlaDr uei s0srtriopiydlltnlnvi t)aDrmxmp;o4optomfciyd mDumums t)trenifctotopDeau olt teuo(rpiydlltnlivi t)sDtmur oo4oexn f3iyslaDean s u)artnxo ty1fatrlnvi s  rxoxr3ou4lmen fcs t)srtr(r ;u0oleo fciadlaDranmpnu4 etomo totfpteli s;s)srxrxm3oydlle mietl(fs2umur nu4oetnio3iatls ra(vs;u0 lenir oodfp   iei ()tetmir nydapeelnvsat a2tm(  nu1tlxnmf3tltfa umnms t)arxoxrcto1omt lu sl( s2tm(m iydop  mnvta(fs2uru ooo4tltoii3ias a rlnms (0 rxoif tytlmD livs;()t2toim oodlp  mnes (  2uax ono1apeo fciyslm ul(mo;u4arxrio oatfa e nvo (0s2uo(m3io4apte ieta()srurum oo0apt  o3ildla uau s t0texnif3oodlpteluvil(0t2uoimpnudllee fvta( a2urumpnt0tlxnio3iad a rmu p;(0 rtomfcoydop e nvi s)t2uoir io1ap   fvsl() Draxr ;u1tlx  o3iltls 
\ No newline at end of file
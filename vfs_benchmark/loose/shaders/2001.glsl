@@ -0,0 +1 @@
+ivs t0trur(o3nodomen ivsa()sDtm(ronu1aleo iciatls2emn p;t)tlermfcia1fateai s;s)teuo(opiu4amt lfesl(faDrr(mono1openioctysfs uauvsnu0aeenxr3ta1opt lnvolt0 exrir oy1lpe lncils sDururpou0tlt  iciat m um(mp;u4 rtrircoa1omte ivi (0trtmimpoydomenmietl(f 2raumo;u0aex mf3ils m rlnmo;u)tltoio iydfmtrli o t0 2triopnu4al n fviat  Drr(rpou0aee mieildfs2eanmsnu0 ltrmfcto1lpt luvslt0 etr(r ou1lpe  nei tfs2rmxmono1ope mietas sDulums ()texnif3tadoa  li o;t)t2xrxo oo1aleeliesltfs2urump;o4tetnmfetas m2el( pnt) rtoxfcoo1fa eaiei ()trtoir iodlpenmivia( srua( o;t1oeeoio3tldfm2rluvs;u0aleoif3to1lmte u ols0srxr(rpiudam elnctasf 2ta(mpot4aee  iciasfm2rmuvs;t)altnif tydoat ai s;() exoimpno1om nmnvil(fsDrau o;u4ale mieiatfmDumnvs;t4altrmrcta1lpt aues t t2xr(r3iy4opt mnetat) 2umxrooo4tetnmf3iad aDeauvp ()artrmoctytla   i slt0s2to(r oo4open nctlsfaruax p;o1apx ifciatfs eln onu4alenxf3oy1omD au o;t)tetr(o iu1omee nvsa( aDraxrp;t0aexo iciyd m2ul(ms;()altrio oa1laD  nvsl(0srtrxrpoydop nlicia(  2rr( poo0tlxnmfetls sDrlu p;u4 eeoif totfmDeluvolt) exmio oy1optelivta(fsrtrur oo4aeeoii3tadfsDran s;t0trtrmr3todomtrln slt)srumxopoy4lp  mics tfsrta(ro;t1oeeo i3tytfs rl(vs;t4aleoir3totoaD ai s s srxrxr iudoptn ncs (f Drmuroot4tex mociadla ranmp ()aeenmo3oy1fa r neo ( setm(m3iu1lmtnlfvtasfsDtmxrp;u0olx  f3tlsfm elnvo;t)aleoxfcoytoa  ai sls) 2tmxm oydlmt mies tfsDtru poo4alxoifeils a rluvont)texomr3oodoaDe i i;s srtm(r nu1lm  micil(fa2uaxroou4tpx mfetatfsDrmn o;(4aexoifcio1fa  lneols)s2xo(m3nydop  mnvil()aDtaxmonu1olxn oeiatfa2eln s t4tlxomf3iodop rlivi;s0 ruo(m3oodomtn nei t  Drr(m ;u1aleomocildlm rlnvp t0arxnxo3iy1fa  lnvs;t0 2toxm nudamtemneilsf 2urxroou4oexomf3tad mDuauvpnu4trtnir io1omt aieo t  2urxm3io1ape  ivtat) 2ta( p;t4oleo ociatfaDel(mo t)alxrio3oo1lpDeauei;s)srumxr3oo4lle mnci tf Dtmxrpot1texn ietas m rl( s (0 rtrmr tatfmtelu ol(  2xo(mpiy1oltn ies () 2ta(ro;u1aee ioctatlsDrlnvs t)tltnxf totoaDrauei;t)s2toio iy4ame mnviltfarra(r ot4tlt  feiltfsDrauvs;t)texrxociydlaDran i s)sexmim iu4ape  ivil(fsDraxmp;u0tlt mieiys a ra( snt) eerifcoydlp rauvolt0 etmimpnudomeelicsl(  Dum(rp;t0opx moetldla uaumo (0trtoifcio1lpt au o;()s2um(r nudapte feia()sDtrumpoo0aptnmoetydls2ranms u4tlxoxr oodoptraivi;( sruoim3iydlptelfei sfa2rrxrooo4altnio3tldlmDulump;u)trtrxrctatfp  aivols0t2tmxm iydlp  mnesltfa2taurpot0tpxo o3ias m rmump u) rxnmrcoytla  au s t)srxmir3iu4op   ivtl() rur(r ot1tpeomf3tld m um(ms u)teeomf oadfptrlnes ()sexoxo3no1lltnmfctasfarra(rpoo0tet  ociydfa2rau s;(4aeermrctotfp  aivi;s0trtr(m3nu4openmfeiasfarrrx pnu1tptn i3iydfs2eluvo u0 lxrircootom  ln olt0t2umimpnodop  mivil(farraxm ;u4tpt iictltls emnmon(4trtoir3tatfpt luvi;t0teumxm3nu1ol emici t)srrmxrpot4aexo feilsls2ul( o;()teeomfciy1lateauesl(0 euo(r oy1ameelnvtatf rrau  no1texnii3tldlaDuluvonu0teeoxf3tatoaDr nes s0srxoxr io4lpe  fviat) 2trur nu0tlt mieilsfa2em(ms (4 exrifcoy1opDrluvi;t)trto(mpoudomt  nvils aruaum nt1oltnioctysfs2uauvs;u4areoif3iy1fmDr nvo;s)s2umxo3iu4olen ictlt)sDurxroot1tlx if3ias s eln p;t)trtoif3iadfmDr u slt0 2tmirpiydlpe lieslsfsrtrurpou0alt mf3ils mDuluvs;u0 rxnif3ta1fptran o ()s2trir nodop nmfvils)srrax onu1olxnmociasfs2umuvs;u0tleniocoytoatrluei;s t2um(o iy1optelnctls) rrauro;u1apeo i3tysls2eaumo;u) leomo oa1lm  liei;s0srur(rpoo1alt liesa(f 2uaum nu0tpe ifciys mDuluvsnt4 leriociydop raiei t trxo(o3oo4lpee fcilsf rtmxront0tleniociaslm ea( p;(0 etnxrciytfpt  iesls) etmxmpiodlpeemici (f 2tmurooo1tpto o3iadlm2eanvsnt) reoxocoo1fateli i s) 2xrxr iy4omtelictlsf Durxrpoo0aee io3iytfa2emuvon(4tlxrxf3oydla rln o;t0srtoio3oudom  mnesl(fsDtaum nt4olen ietas s2em( o;t)areoxf iytoptr neolt s2xm(o ny4lmtemfci () Dta(r ou1aexn ietlslaDeanvpnt4 exnir oytlaDrlies;s0 2urxm ny1lmtemfvta(faDua(ront1apxn ieildfaDrlu p;t4alxrxr3ta1omtr neo (0 etoir iodop   ivia( arur(ro;o1olxoiociatlm ra(ms;(4 rtoxo3iytfm elu o;s s2xriopno4lptn nesat)aDtmu o;t0olxomfeilsfm2raump;t4 lenio iadoaDe uvi t)trxrimpnu4lmen icsl()aruax ono0tlx miciatfs2ul(ms;t)alxrmr3tatlp   ieslt sexo(r3oudameelfvta() rumu oot0oetoiociltlm2el( snu)arxnir tydfatr ivi;t t2toiopoodol n nvt tfa2rmxrooo1alt io3tyt s uaums u)treoir3tytop r ivo t0srto(o iy4lleelnvi t sruax ooo0tpxo ieiad a2umnvs;(4artnxf3iy1opDeauvo ()teuoxo nu4alenlietl()arraxm ou1openifeilsls ra(vsnt0alxnif3tadlatrlnvolt0t2tmio nodam n ietltfsrtrumo;t1ape iiciadls rauvs u4teenmociatlpt  u o t0srumxo3iydalenmicta(  2rr(mpot0oltomo3ild sDra(vo;u4 exnircoy1lmDeaivo;s0 etm(r ou1oltnlnviat)aruaumont4apeo ieiys s rmumpn(4 eeoio iytfmDelu s;t) etrio io1lme lfvsat  Drrxm nu4aeenmf3ildlm2ua( p;() lxoif oo1op   nes (  2toim oy4alee fesls  Dtmxr nt0tpxnmoctatfs2ran o;u)areoxf io1fmtrluesl(  2xoxrpnudape mnetat) 2rruroot1texoiiciatfa rm(ms t4trtomo3iytfpt  uvo;()s2urxo3no1am nlnvtatfarurx onu0oleniociys s ul(mp;t0trtoio oo1op raiesl(0teto(r3nudomen fvi ()a2rmurpnu0oeeomietyt aDeln pnu4texnifctotopD  u s s0 exoxopou1al  lfvslsf rtmumpou0tlx ioeiyt a2ul( s t4aeeomr totomDrlies;t)trxoxmpio1amte fvi sf 2taxm ot4tpeomi3tldfm2emuvo;()aleoif3oodop r ieo (0setmir nu4aptn fvsa()srrmxr oo0alt  ieilsfaDemuvs u0 eerio todfmD au ils  etmxm3oy1lmtnmivsat a2urxmp;o0tpeo fciatlaDem(vp;(0 lenmo to1fa  an i;s)s2uriopiydole lfci sf Dumur no1aeen ociysfa eanvpnu0arxnif tytoatr ies;t s2tr(rpnydlptnlnvil(f rrru o;u1tpt io3tat s2emnmo u0treoxf oy1op  aneilt) 2tm(rpoy1op   icia( a2rru o;o0apx  i3ildfs2rln pn() etoio iadlmt luvs t)s2xoiopiydalee fetlt  Durur ;u0aptomoeiat a emuvp;u) exnxrctatopteaiei;s0sexoir3oy1lmt licsa(  rtrx  ou4tlto iciasfm emumo;u0trxrxrctodlpD auvs;t)seuo(m3no4ll n ivt t)sDurxm no0alxo ictytfaDrmnvo (0alermf3iytlpD  n ilt s2umxm iydomeemiesa( aruax oot4aetomf3tat mDrlnmo;(0aleomf ta1lp r i i ( tetrxopiy4lleemies sf rtr( pnu0opx  oetltlaDrmums;t0trtoxrciadfm r neils0setrxr3oy1om emictlt sDtmumo;u4aetomictldfm emnmo;(4arxoif3oa1omDr u i;( srxo(r nu1llt  fvta() rrmu onu4teeo ociytfaDemn snt4 ltnxo oodlat au i;s)sexmiopnydom  micsatf Drrum no4apt mo3tlsfs2ra(mpnt0tlxnmrcoadomteanvil(0 2xmiopiudll  mfvtat) Duaumo;u4aexo ictasfs2eln ont) leoxr3oadlpD  uesl(  2tm(o3oy1lpenlnesas srtax  ;u0aptnmfeilt a2eaump (4aleoif tydomt luvs s trxr(m3iu1apt livtasfaDrr(r ot0alxnii3ias s2rmu p;(4alxoio3io1om   uvils  rxr(rpoo1lltnlncs (fa2tmuro;o4tleo ictadlmDelump;u0 rtnio3iotoa e uvolt) etrio3iydolenlieias sDuaxrpno0aetoifetas aDem(vs;u)alenmr3iytopt anei;t srumir oo1ap emivtl()sDtm(r nu0ape iictltfa ua(vp;u4artrxr3oydla   u o;t  2trxmpou4ape lnetl(fa2ua(m nu4opxoif3iysfs emnmp u)trxrxfcoytoa  an ols trxo(m nodal e fvt t)s2uaum nu4tlx ifciltfm ulumo (4 ltoxr ootlmD lnvslt0teur(m iu4apenmfvsa()arra(  nu0tpxomo3iatfs ea(mp;(4tltnmoctydlateanei s teumim iudopte fvsl( artm(m no0aetnmf3iatfs umn ont4 rxnmociodfate ies;s0srurio nydlltemivsltf rra(rp;t1altnmo3iys m uauvo u0trxoxf tydoaDraieo s) 2xm(o3nu4opee nciat)arrrxmo;o1aet moeiysfm elnvs;u)alenxf3oytom  aivs;s) rxmim nu1amte fct t s2uaxmpno1openmieiasfsDul(msnt) rtnmociatfmDraneolt0truoxrpiodome mnes ( aDrrxmo;t1tlen o3tatfmDrl( p;(4 etoiocia1oa rlu o;()srtoir3oy1al   fvi ()s2um(  ou1oeeomfetltfaDrlu o;u4arxnmociytfatrlnei;() exrio3io4lmt  ivtl() rraumo;t4tpt  octydfs2eanvsn(4aetoxr3oy1faDrluvol()t2xoim3no4lle liciat  2ta(r ;o0altomieiadlmDea( s;u4altrxr oodfpD lnvi;s seto(m oo4ap n ncilsf rtmumoou4oltnio3ilsla2ua(vs;t4 etnxfctadoatr u ol(0 exm(rpiy1amtn netlsf 2tmumpno4tle mfeilslaDumu p u0aexnir tatopD anei s0t2to(o3iu4opt  fci (  2taumo;o1tpxnif3tysfsDrm(mp t0tltrmocia1lm rai s;s)t2tm(mpio4llte ieils)sDtrumo;t1oexomo3ild sDrmn on(0 etomf3oadopDraivs t) 2umxo ny1lle mivslt)srum( pnt4ape ii3iyt s2eanvsnt4trxrxocoa1fpDraivo;(  exr(rpno1opeelfcil()arrau ooo1aetn iciyd s rmnmp t)tltrirctadlm eluesls)srtr(opiy1ape  nci () Dtrxro;u1tle miciytfm ra(msnu0 etniocoytfmtean slt) ruo(o3oo1al   fei s)a2rrx ooo0olx  ieiytfs2um(vo;(4 ltnif3tytomtr iei;t s2xmir iy1ap elfvt sfs2urxr ot4tltomociytfs2ranvp;t0artoiocoatlpDranes t0seto(r3nudomt lfvtl( aDrrxm no1oexomieilsfaDum(mont0 rerir3oodfaD  ieols0t2tmxm3iudalt liet t)srtmxm nt1apxo i3ild s2ea( o;u4artnxfcty1opD lnesl()teuoxmpiodolt mfctas aDur(rono1opxoio3ilt s2ua( s t)trxniocoatfm  liei;(  exr(opnydll  mnct sf rumxm ;u1tlen f3tlslsDrmnvpnt)aetoxf tatfa ran o t srtoxmpno4opeemnctl(f 2trxronu0alxo fctldfsDumnmonu4tltoif3ty1faDe nes;()srxoxm3nydlle mivta(f Dur(rpot4aexoio3iatfaDeanvp (0alerif3oydla e uvo (0s2xoio oodll nmfciasfsDtru poo4apxomoeiatfa2rm( p t0tetoirciodfaDeli sl(0setmio3iodlpe mfet t  rurum ;t1aeto i3tatlm ra(mo t0tleoxr tatlp r nvs;t0t2ur(r3nodomee fctasfa2uaxm ;t1oetnioeilt m2elnvs;u)tlxoxr3totlaD lieo s0 2xoim3ny1olenlivil(fsDtmu  ;u1optomi3iysfaDelu on()trtnircoatlatrlneilt0texm(r3nu1altnlivilsf rtaxmo;t4oexoiociysla ua( o;t0trtomr iytlp  auvolt0 ruoiopnodop   fvil()s2tmu pou1alx  octytlaDra( pnt0tlxomrcoadoat ln o;t0s2um(m3nu1am n ivta(farraumpoo1aeen fctydfs ea( snu0 ltoxf oy1fmD liei ()tetmio3nodal n fciatfartrxmp;u1aexnmfeiad a rau p u4aexrxfcoodom r neslt0t2xoxrpoo1ape  ics (f rtaxr ;u4tltomf3tysls2umnmo;u4areriocty1la   neo s)s2xo(opnudlptelfvsls s2uau  oo1ope ifciysfa2uanvs u0altrif3oo1opteli i;s0 exoim oy4llen ncils s2uaurpoo4aleo f3tys a ua(mo u4teenxr3totlatrlivo s trtoxr iy1ap nmfcilt  2tmx  ;o0alxoiietyslm ranmp;(0arermr iydlat lnvo;t0sexrir3ou1op   fvsls aDuaxrpnu0optnio3iydlm ua(mo;u0aeermr oadlmDeaivo s0 rtr(o3nodlme  fct t  2uau  ;t4apeo ocias sDrlnms u0altrxoctytomt lneolt) 2trim iudam   nvtat)artaumont0oexoioetltla um( pnt0tlxriociotopDe iei;t)s2um(r3oodlmeemfeilsf rrmxrpno4aexn i3iytfa2eluvs;t4trxnxr iydfmte i o;s)sexmxrpny1amtnmfctat aDrmuro;o0olxn i3tytlmDumnvs t)treoifcoatop  lu il(0trtoiopiydamenlieil(  2raur oo0tlt ifetls s ulu p;t4 reoxr3tatlate uvs;t0 rtrim no4alt  netls sDururonu1tee ifctltlm ea(von(4tlxrmrcto1fp r n s;()t2uoxr oudop  mietls arrrur ;t0tpeo octls m2uauvont4tltoif3ia1fp eanei t0 etm(o3iy4optemnvtl(faDtaumpnt0optoiieiyslmDua(vp;u0tlenxr3iy1oa   ivs;t s2tm(r3oy1op nmivtls  Dtr(rooo1tex  i3iatlm2uluvonu0tltrmocoatfaD  ueo;()srtoxr oodop elfvi sfartrump;t0ale if3iydfm ea(ms t)tlermr3tatlmte u o t  exmir3ny4optnmivilt)arurx o;u0teto oeiat s2umuvpnt)artnxr3oytfptr ivs (0tetm(opoy4opeelfesas)srur(mo;o4oeeo f3iydlmDrl(vs u0alermf3iotlpDrlnvo;() 2uo(m io4ll nlfvtas  Dtr( pnt1opxomietat aDrmn sn(0tetnmr3oy1oaDrai o ()srumimpoodaptnmfeia()sruaxr ou0tlx mf3tasfsDemnmp t0aexrmo oo1lmDeli s;s0seuoxr iu4am elncs t  2tmxmont1tlxo ieildfsDemu snu4trxoxocta1laDeaneo t)s2tmio3oo4ll n fvils s2rr(m ;t1tleomieiytfaDrlnmsnt0treoxo oa1opD lneil(0teuoxr3io4alt mncs s srumumont1ale iictlslm emn o;() ltoir iodomDe n slt)s2xr(r ou1al n fei (  Dumxro;o1olxo fctasfs umnmo (0altoif ta1fp  anei;( t2uo(mpnu4apen fvilsfs2rauroou0apenmoetldlm uau s t)altomr3oatoptr uei;s trxm(o3iydaptelnct t)a2ra(  nt0tpxn i3iytla2ran o u4treomo to1faDrai sls tetm(rpiy1op   nctas sDraurooo1olx ioetltfs emu o (0aetrmo tatoat anei;s0setmxopio1ol emivt ( aDur(ro;u0oleoif3tasfa umnvs u4tetrmfctytlaD ai s;(0setrxrpoydoptnlfvs tfs2um(mooo4aee ifciadlm el( p u4 rtrxf3ty1oaDe n s s0setoxr nodom nlnei tfs2tm(mono4olxn fcild aDeauvs (0 ltomfcoa1la  lneil(0t2trxopiu1lme mfvt ()arrru pno4aeeoioeiydfaDumnmo;()tleoxo iy1op  an o;s0 2xoir no4amt lfvsas)sDum( o;o1oetniiciadlsDemu s;u4 lxomr tatom eaiesl(0srxo(r oo4ll nlfcs (fsDuax onu4oet iiciysfa2ulumsn(4texrmo tydfpt anvs;() euo(m3nu4apen ivtat)artr(mp;u0tltn i3tltla ul(vs;t) rermf3oytlmDr i sls) rxmir iydomt lneil()aDraumpnt0oet io3ilt m ul(vsnu)arenxo oytlmDrauvolt0setm(m no1alt lnvia( a2urxm ou1tpt if3ils a rl(mo;t4tltnirciodfptrlneo ( s2xm(m iy4ll  mfcta( sDua( pno1aeenmociltla rl( p;u4 exomo oodlpt ln o ( seur(m iodale  ncsatfa2uaxrp;t4opt mf3iltfmDea(msnt0tltniocoatfmD ai o ()trurim3ou4opee feta() 2trur ;u0tpe  o3iltlm ran sn(4aexrxo tydlpD  ivolt srum(mpoo4lpt  fct t aDtaxrp;u4texn fciasfmDrluvo u)tetrio ty1fa e u o t seum(m nydopt  net t) rtmxmooo4teeo ieiatlmDelu o;u) reomfcoydla eaivi ( srxr(r oudom   fciatfa2tr(r ;o0apt mi3ild m em( s;u)alenxf todlm   ueo s  rtr(rpiy1amtnmnvsasfsrrr(mont1tetomo3ild sDeanmp;(4 exomr ootopte n sls  2tmim3nudlpt  fesa(f rur(  oo1tpeo icildls eanvpnu4 lenif iatfaDelu ils) 2xoxm iudlpe  ictas a2tmu o;u0tpt mo3ildfa2rmuvp;u) eerxo3tadfp eaieils  rum(m3nudame  nvsl(  rtmump;o4apxo f3taslaDuanms;(4 rtnmf oadfmt  n s;t s2xrio3nudll   nci tfs2rmumpnt1apeo o3iydfm2ranvo;(0teermo3tatop raueo () eurxr oo1al n neslt  Dtau ono4apxo octltfa2uln pnt)tleoxr3oytlmteaueo;t0 2umimpny1ape livi (f rraxrooo1texnif3iysfm ulnmpnu0 renxf io1la raues;t)tetrir3ny1llen ivtas  rrm(r ;t0olxn fctadlaDemumsnu4artoio oo1lpD livi ( srxmimpno4am  liei tf Dta( pnt1altnii3ils a ua(mo ()tlxnxr io1lmtraueo;t) 2tm(opoydopenlnes t  Drm( poo4alt miciatls2uln onu) rerxf oadoaDraneil(0s2xmirpiy4op  mnvs (  rrrxrpnt0altoii3iydfmDuanms t4arenxf ta1lp r neils)s2trim iy4al nmnvs ( sruauront1oetn feiatlaDemnms;(0 rtrxo3oydfp  anvi;s)s2uoxm io4aptelfviatfarrmx  nt0alen oetytfs rl( snt0tltoio oo1fmDrauvo;s0 rtoxmpou1lpte fctat)s2tr(  no0texoifetas a2ulumsnt4alenxocio1fmDrli olt)t2tm(opny4ope mietatfaDumxr nu1tpe  fetadfa2rmumo ()tleomf3iodopD  iesls0 2uriopio1omtnmieiasf 2trx p;t1oexnioeiyt sDeanvo u4 eeomo to1lmtrlnei s0teum(opoydoptnmfeiltfs2trxmo;o4opt mociatlmDel(mp;u) etoircoadfaDrai i;s)tetmiopnudamee nesl(  2umuro;u4oee ioeiat mDum(mo t4aeeriociy1fm  liei s  etmxo3ou1lp emfvt (f 2ur(  ;o4tptn oeiltls2uaumsnu0 rerio iy1omDe ivs;s0sexmxopnodal emnvtas srumxm no1aee  o3ildlm el(vpnu)tetnmocta1omteln s;() rumiopio4optemicsat) rrm(rp;t4aexoifcildfsDrmnvs;()aexoircoatlpDrlueil() 2tmio3no1llee fctls)srtax  ;u0aee mo3ildls2ulumo;(0alenxr3iodfpD li ol( t2tr(mpou1aptnmfet t) 2trurp;t0oltomieildlsDrlums;(0 lenmr3tydoaD ai i;s)setoim3nodlpte fcsls) 2rm( o;o1tpto ocild a ranms;t4artomoctytlate i s s0t2tmir3no1amenmiei s)a2trxm nt0ole  i3tyslmDemnvo (0altnxociytoa   nvol(0 eum(r oodom n nvi (  2tm(roou1aexo iciysla2ua( s ()trermocootfmtrlu ils) etm(mpiu4lme livs tfsDtrxmpno4aeenif3iyslm eluvsnu0 renxo io1lp eai s s trto(rpoydape  ivia(f Dra(m ou4tlenifcias s2rm(mp;u0aetoxo3iatomt lies;(  rtmio3io1ole lnct t  2uau  ;t4oetomiciys a ul( o;u4trxomrcoy1omD li ols0 2urxo no4ap nmnet t)artmx oot4aee ioctldfa2ra(mpnt0 eeoio ta1opD lu sl( texoxr nodol elnct tfa2rmxronu1tet iicilslm2emn snu)teermf3tadlatrlnvi t0srto(m3oo4oltemfeia(  Drmur ou1aetomieiydlaDuluvpnu0texoifcia1om   ivo t) etr(o ou1op emfeiat)s2urxr nu1oet mf3iytls2rm(mo;t)tlxnxr3ty1lm  lnvolt  2xoxmpnodlmee neiat) 2tm(m ;t1aeenif3ildfa2raump t) eermocoytomtrliesls sexrxo nodamtn ivtas  Dta( pno1apt moetltfaDean pn(4 lxrxociytoa  au ils0trxrio3ou4lltemfvt t arrax  ot1ape  oeiytlm2ran s;t)aeeomr iotop e iei (  ruo(r3io4ol emivslt) rrm(ro;t0olenmfetld s rlumsn(4texoxfcoo1oa rln o;()s2xoimpoydlptn nesls)sDtrumono0alxnifeiytlmDrmnms () rerxoctadfat  nvs t)srxoio3iy4apt lnct s  2trxr ;t4olxnii3tatla ea( s t0 eenmr ootoptraiesl()setrim3oydaltemiciat arumumpnu4tpe io3iys m rlnvo (0 rxnxr oytlptrluei;t0 rumimpou1ap  mivsl(fa2rmxr oo0aleoiieiytfa eau pnu4teerxr3iadla rau i;( srtoim3io1lp e nvsls arrruront4apenmieiltfaDua(msnu0 rxnxf tadom e n slt0 2tmxo3iodoptnlicil() 2tauront1opxnioeiltlaDeanms t)tlxnirciy1fp e u sl()trtrim ny1lpe  fvsa()srrmxmonu0tptnmictlsfaDumnvpnu) lerxociytopD  i ols0srtrxmpny4apt mnes sf rrmxmoot0alxomocild s2ua(vp t0alxoir3iydlpt  n sls0s2tr(opou1llte nesatfsDum(mpou1alt  iciatfmDulnvo;(0aexnif iadfa   i sls t2tmim oy1apee ietat arur( onu4tlt iictydlm ua(vs (4 rtriocoytop elivs s t2ur(r iu4am nmfesas  rraxmont0tlto ictlsfa2rlu snt0 leoiocoadlm r nesl(  etrim ny4amte iesls srra( p;o4oltn ociltls2el( snt0teenmf3iodop  ai ol(  rtoxmpny1omt lnesas) ruaump;t1aexomfeild s rlnmp;t4tlxnmr io1laD  uei t0 eurxrpoy1amtnmfvia(fsDtm(mo;t1olx iictad a2rau sn() leomociotlm elueilt)s2umio3iy1llenmfcta( a2tmu onu4opeo o3iyd aDrl(mp;t0 eermr iotlpDelneol()trxmio3oo1lltemicias s2rruront0alt mi3iasfs ulumo;(4treoxr3iydlaDeanvo;t0 2to(o3io1ol  lfeiltfaDurx oou0aptnmoctasfm uanmp;() eerxr3to1op r n i ()s2xr(r3iodol  lfvt s a2urx  no4tlt  octysfmDrauvp t)trxrxocoatfpte nvo;s)teurim ny1om   fctas sDur(  ou0alx  ieiys s2rluvs (0arxomr3oa1fp e ivo () etoxm iudlm  mfvslsf rtrxrpot0oltomfetlt s2rl(vsnu) lenmr3io1fpDeluvi;t seuoxo3ou1llenmfci s srrm( oot0texnioeiytlm ul(vs;(0alerxfciotlp raies;( trxr(r ny4lpenlfetlt) Drrxronu4olen o3ilslmDemumon(0aexnxrcoytlatelueo s  eurxr3nu4ll  lneia(  rta(rpnu1aetnmfciytfa2emnvpn(4tltoifcoa1faDelnvil()s2xoxr3iu1om nlivia(f Drmu  ;o0tle ii3iyd s eaums (0aeeomo3oy1fptrai i;s s2umimpnudlleelfci s arrmu  ;o0tpe iociydfs2eaums;t4texrmo ty1op r n ols  2umxm3no4amenmics s) rraum oo4apt  feilsfm2rau s;t) ltnmr to1fate ivs t srur(o ou1lle lfvt tf 2raur ou1aee ifctltfm uln s ()tetnmo to1omD aueil(0srumiopoudam  mnetlt)srtm(mpot4teto feiysfa emnvonu) lerxrctadfat anvils)tetmxo oydaptemncs ( s2umumono1aptn iciys s2eanmpnu)teenmr iadomte uvol( t2xmxr iudalt mict t s2rrxrp;o0opx  ieiltfsDranmsnu4aetnircty1lptr uvsls0texmiopiudlpe mieiltfsrrm(mo;t0teenmi3iytfs uaumo;t4 etrxo ty1lpteauvo;s srumxr3oo4aleemfesasfs2ururpoo4tlxo ieiyslmDuaumsnu)tlxrir3iodlp  aieo ( trxrxr oydoltnlfct s)sDtau oot1olenioeiytlaDemuvo t0teermfcoadfmtrai i s) 2trxm3oo1lmtelietl()aDtrxr ;t4aleo oeiysfm2em( snu)trxoxrciatlmteau s;( truo(opiodope  ncilsfaDua( pno4altnmo3iatfa emn snu0trxrio oadlm   i sl( srtmxrpoudapt  nes sfsDra(mpot1oexnmi3iyt a um(vo;u4texrxo3tatopt  ieo t0trxoio3oodlp nmieta(f rraxrpoo1aeenio3tatla emnms;t4 exomo oatlp eaiei;(0 2urxrpiydomt lfesat)sDrmur ;t4tet mietas m rm(vo;u) rxnir3ia1fmtelieols0t2xmir nu4al e ict sfaDua(m ;o4alen fciydfa2el(msnt0tleomfctydfmtrau i;s)tetoirpiu1apenlieias)a2trx p;u1aetoiicildlaDrl( snt4 rermocty1faDelnei;() 2ur(r3oydolt  fvslsfs2umxmpnu4optn ieiyd aDrmu o (0 lenxfcta1oatr i s;(0 rxrxrpiu4lpe  ivtltfs2ur(ro;o1tptn ictlsla raumpnu4tltrmo todlp  lnei s)s2xmxrpnu1ol elfvt s artmurono0altnmociysla2eaums t)teerio3iotlmDelu s (0 euoxr3oo1ol n ivia()srrr(rpnu4oeenio3tydfa2ul(vsn(4tetrif tydfa rai i;s) 2tmim3iudom n nvi t)aDtr( oot0apt ii3tyd mDra( p t4artnxfctodlmDeauvs;(  rum(o3nydaltemnct t  2ta(r ou0apxo ociysfs emnvp;t)areomo iodfmDelieslt0s2urxm iu1amtn ietlsfsDtrumpou4oeen i3tls s emuvo t4teeomfcoodfateaiei;t srtm(r nudopeelfvtlt) Dumxrpot4aptnifciysls2ulump;(4tlxomocoytlp  aies ( s2tm(o iy1llenmfvia()aDtrum oo1tptnii3tyslaDrl(vonu4arxrmf iy1lmt  n s;(0 etm(o no4opeelfcs () rtm(r nu1oexoifetytfs2emnvs t) exomo oy1fa eaivs () ruoir3ou4lptn ieias)a2ra( pno4tleoifcilt s2el(mo;t0 eenmr iatfatr ueo s  euriopiu4omee fcias)aDtau  nt0tlt mietlsfs2ua(mpn(4aeenio3iydla rai s t) 2toim iudolt  iesltfsrrrxrpnt4aee ii3iyt s2uanms;(0altomf3iadlatelu o;s0srxriopoy4apte ivt (f rrrx ooo0aetn feiat s2rl( p;u0tlerif ootfa rau s ()setmir ny1am   nvt (fa2tmx  no4tptn o3iydls rauvs;()tetomrciytfaDeln s () etmxr ny1al e ici tf 2uaxrpoo4oee mociydls2el(von()arxnxf3tydlmte u olt trtmxm iy1am elicsat) rtmurp;t4tlxn o3iasfm uanmo;u4teenxr3iytlpDr ivolt0texo(r iudapenlncils)srrmurpno0opx  fetldlmDra(ms u0 etoxocootoa elnvs t sexm(r3io4am nlnvtlt aDua(ro;u1apenii3tat s2em( s u4 ltrircty1lp rln olt  rxriopno4alen icia(f Drm(m ;u1tlt micilt aDem(ms;(4 rtrio io1opDr i s s) 2tr(m oo1omtn fesat sruax pot0tetnioctyd m2emnvo;u)tlxnxo3iytfa ranvo s) rum(r iudomtemfvia()srrmu pnu0tlenmo3iys s uauvs;t)arermf3totom rln o;( srtrimpnydlptemict sfa2ta(rpot1opx  f3iltfm um(mpnt4aetrio todop rlnvol( t2urir3no4open fesat s2rm(mp;t0oeeoifetatfm rmu p;(0texomo3todoa eanvs t)t2xo(m3ny4ameemncsl(faDrmxrooo1tpt ifetlsla2rm(vp u0alxnxo oydfp eau olt) rum(o oy4ll emncs (faDtmuroou4altnmiciltfaDuanvo t)arenxrcoadfmD  n ilt setrio3oudam n fvs tfarra( o;u0olto o3iytfa2ra(vs t4 etnxocta1lp  auvs;s0 2xoxo iy4ll elivia( srua(moou4oee  oetydfs raumpn(0 exrxocoo1opte ueolt) 2xrio oo4ameemneta(fs2tm(  oo1apx  fetyd m2rmuvpnt)trtrmocoatlmte nvs s t2xrxm nodoptnmncslt s2urumoot1tpxnmocilsls2elnmp u4aetnxfciodoptrlnvo;t)s2xr(opiy4lmee ivilt) Dtmuroou0tleoiociyt a eluvpnu)aetrmo3ty1fpDe ies t) rurxr3ou1lp elfvsltf rtr(rpnu4texo ociad a2rlnvp u0 lerxocoodfpt  i olt0 exoio nu1lle mfvsa(  Dum( pnt1texomfeiltls2umn s t0 leomrcoytfa  luei;()srtmir ny4apt  nvi ()s2rrur ot0apx io3iatlm ul(mo t4tetoio3iy1lpDe ues;(  exmirpnodome  neiatf 2uru  ;o1ape  ociyslm2ranvo u) exnio iotfmt au ol()srxoir3io4openlict sfaDraxrp;t1tex mi3iytlsDem(msn() lxoxfciadfm e ivolt0 2triopno1alt  fet (fa2umum ou4tetoiociys m2um(mp;()aleoirctodfmtrauvi s  2trxo io4lpee netlt) 2urxrpno0tlxomo3tls s ra(mon(4aetomrcoo1laDe nes (  2xrxm3oudlm nlncs s)arrr(mo;u1aex if3iyd s elu s t0 leoxociotoa  lueil()trur(o3oo1op elnci t  rtm(  nt0teto i3tasfsDraums (0 lxrxr iatfp   u i s)s2xoxm iy1al e net tf Drmxm ;t0tleomiciyt a ua(mp;u0 rtomfctotoaDe ues;t srumirpiu4optnlfvia() Drrxmonu1teto ieiysls ea( p u) etnirciotlp  au o;t  exo(m3oo1op emneiatf Dtrumpoo1apx  iciys m ean pn(4teerif io1fm eaies;(0trtoxo3oo4omtnmivt tf Dumumpoo0ole miciysfaDum(vs t)aexrif3to1opDeln s;t) exmiopou4ol n nvs ( aDrm(r ou1teenmfeiyslsDrauvp u0teerxr io1lpDr nvil(0srtm(o nu4ope miesls)sDra( pno0oee moctytlm2rmn pnu0 rxomo totlpteli ol( teuoir3iydam n iciltfs2uau o;o4tpx  ictasfa eaumo;u0aetnir3iotoat lueo (0 rxoimpiy4omtemfvtlt) Dta(ro;t4altomfctlsfs ra( snu0trxrxoctadopDr u olt srto(opny1om n nctlt) rurxrp;u4tpenmi3iyd m2um(vs;u4alxnmr3tadfat  uvi;(  etmim3iudap emfvs s s2tr(rp;u1texomf3iad aDrl(ms u)alermr3oytfptr u i;s) 2trim3io4ale mnvt s)sruaxr ;t4apxnifeiytlm2uau pnu0 reoio3oydlmD  i i;(0teto(mpno1altn nvilsf 2tmxr oo4texomoetys s2uanvs;u0altrxo tytlmDeaivol( seur(mpnydomtnlnvt ()a2uaxrpou0teto ieiys m2rln p ()tlxrmr3io1faD lneslt) 2tmiopnydam e iviat srumur ;o1texn f3iydlsDrmnvsnt4 eeomo ty1lm eaivols t2uo(rpiy4ape  ivtasfarurxm ;u1aexoif3tat a elnmp;u4 etnio io1fp   nesl() 2urir3oydll emfei s aDraxmp;u0altn i3tltfs2rln pnu0arxrxrcty1op rauesls  2urxm3iodol n feils)aDta(m ;u1altoifeiad aDem( s (0trtrif iotoaDrli o;s0srtm(opiodamtnlfvsatf Dtrx oou4openiiciyslm ul(mp;()teeoxrcoo1laDrau s;s0truo(r3nodlpt  fctl()artr(m nt0oetoio3iyslm um( p;() etnif3ty1lmt  ivo;t) 2toiopiu4opee iviasfa2ua(m nu1aleoiieiytfs uan sn(0 etnmrcoatoat lnvs s tetrimpnudamt  ivtlt)artr(r nt4tetniociasfs2uluvo;t4aeenifcoydopt livs s0s2tr(m no4al nliet tfsDta(mpot0apx mfeiydla2uluvp (4trtrmrcoo1oa rlivo;(  etm(rpou4ole lnetltfaruaxmo;o4tpe io3iad m emnvs;t) etrif tytomt aiei s0 eurio3ny1lm nmnvsl(fsrua(ronu1aeeoifeiydfm2ulump u0 ltomrctytomt  u i;(0srum(m iodol nlnesa(fsDur(mooo4tltnioeiyd a ul(vp t4 ltnif io1oa rlneo;s)setmxopiu1opeelfvta( s2rmx  ;u1optomfeiyt a2umuvsnu4arxnio iatlm eluvil() rtrir oy1ame lfctasf 2ua( p;u1oetnii3iad a2ea(mp;(0teerxo3oadfmtrlieo;()srurirpiy1apte nct (f 2tmx ono4opt ioetytfs2ra(mp;t0 ltnir3oydopDelieolt  etoxo nu4ol  mneilt aDtaumoou0tpenmfeiltfmDem( o;(0arxrmo3iotfmteli i ( tetrxo nydapt mfeslt)arrr(rp;t1tptn i3ildfs umuvonu0 reoxf3to1optelivs;s  rum(rpnydlme mnciat) 2uru  ;o0aet iictls m2rm( s t0artnxoctadla  aivo;t0 2xo(m3oy1ol elnvtl()aDuru p;u4olen ictltlm rmums;u4alenioctytlm elu slt0 rxmiopou4olt lnctasf 2tmxmpou4olenio3iat aDua(vs t)altrmr3totlmDrai i;t)s2uoiopoo4op nmieia()sDtrx ono4tltnmfcildfs ea(ms (0 lenifcoy1fa  anvi (  2urxmpoodale liet ()a2ta(ro;o4oexniiciadfa umu p t4aetrxr to1faDr ueo (0t2to(o3iudll  lfet () Dua( pnt0ope iieiydfsDulnvs u4texnxo3oatfm eaueo (0texo(r nydopt mnctls)aDuru p;o1olxniociyt sDraump u0 lxnmf3iatomDeai i;t0 etoxo oudlp  lfvt (fs2raurp;u0tltomfciadfa uan pnt0 exrmf tatfate i slt) rurim nu1ole  ict tfaDtmur no1oetomicilt a2uaumon(0 lxrxr oo1opD  nvols0 2xmir3io1amtemnesasf Dumur ot1teenmfctatfa rlnvsnu4texrif3oydfm rlnvol()t2xoirpio4ap n nct ()sDtr(rpno1aet mieiat s ulu p;u)tetnmr ty1fpDr uvi t)setoxr3oo1lmte ivs tf ruax ono1tlt mfctlsfm2emuvo;u4trxrxo iadop elivs;( setoxr3oy1ll elict ( s2ra( oot0olen o3iltlm2eauvs () reoxf3tydlm  lnvslt0s2xoirpiy4lmt lnciltfsrumu ont0aetnmi3ias a2eanvp;(0arermrctytom   uvs;t0texrxo3iu4amtnlivi s sDuaur oo1alt mfciytla ra(mp;() exnxr3tatopDeai o;s setmimpny4alenmfvs ()s2umuroot1apeo o3iytfaDua( o u4 rxoio oy1lpD anes () 2trio3nu1amt mnvi s  Drrxm ou1olenmfctlsla2emu s;u4teeniocoatla  li slt0srtoio nudapt mfeia( aDrau ono4aexn oeiadfm eauvpn(0tleoxf3oytlmt auvil()truo(r3ou1ole licia() rtaxr ;o1aetoio3iatfm2elumo;u4aetomr3iy1fa rli ilt)srum(rpno4olee nvtas s2rm(r ;u0aee  fcildlaDuln o (4 lxrifcoatoatrlu o ()trxrimpny4llenmfctltfaDtmu pou0alxn ocias m2eln o;u4 rxnio iotlm ranvo;t  exmiopnodaltelictl(  2taurpnt1ope iociasfs ul(mont0aetnxrcta1laDrliei;()tetrxo iy1alt mfcia()aDua(m ou0ape  oetat m uanmo;(0 lerxrctydlpt li o s)sruo(rpoydaleemfcsltf rra(mp;o0teeomocilt a2rmuvo (0tltnxo3io1op elieslt0 2tmxmpno4olee ivi ( artrxrpou0oetnmfeild a2ua( o;()trxoxr3oa1oa   n ols0t2xrxm3ou4altemnvsl()a2rau  ot1alt ioeildfm rmnms;()texomf oatfa r n o;s0s2xo(r3nydlpe mfcsa()sDurx oot0tle moeiasla2eauvo;() etrmr ootfp  an s;s)seum(o no1omtemietl(fsDraxm no1alx  icils m2ea(vo;u0trxnmo ia1lmte nvils s2xm(o iydamenlfctatfs2uau pnu0tpe  ictyslmDraump;u0aexnmocty1lpt  nei;s)trxoio3io1lltemivs t  Draxrpoo4alx  oeiys aDuanmont)tlxnxo3oy1omtr i i;( t2trir3iudaptemiet s arrrx oou0aeenmfeilt m2uauvpnu4 etnmf3totop r n slt tetoir3iodaleemfei sfartauronu1oeeo iciltfs2rmn o t)alxnmr3oatfa e ieslt0sexmxrpnydap nlfes tfsDtr(  oo0tleoiiciys a emnms;(0texrmfciodfmDelu ils) 2urxr3oy4ol e fci (fsruau  nu4ole mfctyd m eau s;t4 eerxf3oo1optrli sls t2tmir3oy1aptn nctls s2raxmooo0oexo o3iat m ul(msnt0tlxnif iatfa eluvolt srtoimpiodll elfciat)a2tau ont4alxnmfetadfa2ra(mon(4trxrmr iadopt aieo;( trurxr3oo1ap n nvt t s2rmumpou1apto o3iyd s umu pnt)trerir3oa1omDeauesl() eumir3iu1omenmfei (f 2uru  ;t1aetnmiciydfa rlu snt4trtrxf todoa eanvil(  euo(o oy1ole mncsas) Dur( o;u4tlen iciatfm eluvp u)tetrxf3oa1optr n o t)t2urio nudll elnciasf rtm( ooo1opt  i3ildls uaumo t4trenmfciytlpDrai ils  2tr(opoudoptemnvt (fa2rrurpnu4olx ioctasfaDua(ms;(0tlxnxo tadlmt luvsl()trtoxr ou4apen icsl(fartr(m ;t1olxn fciytlm2eanvp;u0trtnxo to1lm e nvs;() etmim oodlp   ieslsfs2tr( pnu0oetomi3ildlsDrau snu4 eeoiocootop  aueol()texo(m oydlltelfes sf 2tr(m nu0tlxnioeiatfsDran s (4tlxrxf3iydfat lnvi s)s2trxopnu4al   nes ()sDumum nu1olt mf3tasfmDem( o t) rtnxr iodfa  an sl()t2xr(m3io4llenlfesl(faDuau  ot1tltn feiat m2ul(vs t4tleomfcty1lp   u o t0s2uoir oy4olte fei ()arrmxm nt0oltn ociadlmDeaums;(4arxrif iodfmD ai s;(0 etm(o3ou4lpt  nei ( sDtmxrp;u0tlt ii3tldlm uluvp () rxnmo todoaD an s;s)s2xoir3oodope mfvs (faDua(mp;o1opeomiciysfm rl( s t0tlxomr iadop eln s;t0 rtoim3no1op elieia(  Dtr(ro;t0opxo ociyslsDemu o;(4alxnxo ta1fm elieolt tetmxm oy1lp e fcsasf Dtmxm oo1tex iieilslm emnvo () reoifcia1faD aneo ()srxoxrpou1ol emneil(fsrurxm ;u4tex  oeilsfm umnms (4trxrmr3iydfa r neolt0 exoirpiudamenlfei s s2tr(mo;t4oleniocildfa eluvs () rermr3iy1fp e uei t0 2uoimpnu4llt lncias a2raxrp;t4teeo oeildfm uau p;t0areomr3iydoaDeauvs s  rtr(r3ou1llte fcilsfaDtmxmonu1tpxomieias a elumo t4teenxociatlp eai i;(0 ruoxm iy1lmt  ict s  2tmum ou0tee mieiat a emums t4 exrif3iadom elieilt) etr(opnodlmtn feiat)aDtm(  ou0oeto fciad a rm( o;t4trtnmocoy1lp rlivi s t2xrim3oodop   nvi ( aDtauroou0apto ieiad m2ua( s;u4 ltoxr3oydomD an olt) 2um(m3nu1opeelfcia(f rrmxr ot0olxo i3tysla2rlnvpn()trenxo oytopteau i;() 2um(o3nu1lpenlivil(  2tm(rpnu4aptnmiciyt a uanms u4areoif oadlpteai i;s) 2toxm3iydapt lnesa(  Dtaxmpnt4texomocilsfs2emu s t0tltnmr3oy1lpte u o t0 exrim3nodom e ivsl()s2tm(ro;o0apxnifeiatls2eau snt4areoifciotlaDe ueo;t)sexrxo3iudame mncs tfarum(rp;o1oee  feiys a uan s ()trtomo tadfaDrlnvi;s tetoirpny1ol e fvta(  Dua(  ot4olt  feiyd mDea(msnt4texrxf3oadom  li olt  etr(mpnydomtnmfct sfs2rr( o;t1tpxomfcildls2ulu o;(4texnif3oadomtr n o;t0 rtm(m nydol   neils a2tmx p;o0oet iocildlm2eauvo;t4arxnirciodlptrlivsls)trto(r3ou1altn fvia(  Dtmxmoot0tle mfeilsls2umnmsn(4 lerircio1fm ran i;t0 eumxo3io1ll elivils)artrum ;t0olx  iciltfm2elu o;(4 lxnmocoodfm r nvi t  rtrim nu1open ivt ( arur(m ;u1tet  f3tyd s2ra( s t) lxrxf3tydoateai il( setoxr ny4amtnlivs sfa2tm(ro;o0olt  o3tydls2umuvon() rxnxf ootom rli ils srxrio iudlpeelivs ( arrr(rpnu0tpxn octasfm2emuvsnu) lerio iatfmD  neo s0srumimpoo4omtn fesa() Dtm(  oo0apto ieiasfa um( p (4areoxrcoa1oat livolt)t2umir oodam emfvtl(f 2ta(mpnt4tlt miciydlm el(vp;u)altrir ootfa e neo t tetrxo3io1optelneiasfaDrr(r ;u1open fctytfa2ulu o t) etnxociytfmDrlu s;()srxmiopiu4alenlnctlt)a2trum nt4openifeiatlm ul( o;(4arenio3iodfpDrlues;s texrio3iy4omeemieia(f Drax  ;o0oexnio3iadla2rmumo t4tltnxr iotoa  lnvs t)s2toxm no4lpt mivslt  rrm(mpnu0olen fctydfa2eluvp u0tlerif3ia1fa elies s)t2umio ny1altelfcs sfs2rm(mpnu0apxniieilsfmDel(ms;(0 lxnxo iytlpD  neo s0 exmxm3no1lmte nct t) 2trx  ;u0texnmociysfa2rau s () lxnxo3iy1laDe i i;t t2trxmpio4lpeelfcsatfarumump;o0tlxo octldfa rau p;t4artomr oy1fpteaneslt t2xoimpiu1amt mfetl(f rtrxrp;o1alxo fetasla2eauvo t4tltnmocoo1lm e uvo;t0s2tm(r3iy4lme lfvs t)s2rrum nu4oetoiieiasfaDrlnmont4 exnmf iotlmtrauvi s s2urxmpoy1am nmfcsatfs2umu p;t0alen fciys s2rlu p t4 etoxrcio1oa  anvs (0 eto(r oodll n nctl(  Dur(m ;u4aetoioetytfaDranvs u4trtrmf oy1lm   nvs (0 2xm(rpiydom nlfvias  2tauronu4alx mf3tadlmDul( s t)arxomo3oatoaD ln s;t) exm(mpiudomtnlnvs s aDrm(mont1alt if3tlt m rlump;(0 rtnmo3iy1oat livs;s0setrxopny1lmtemnvsat)artau pot0oltomfeiasfsDea(ms;u4aexoirciodlp  lu s;(  etm(r iy1omenlfviatfaDrr(  nu0oltoioetas aDuanmo;t)tleomr oo1op r u s s srumim nydlltn ics (fs2tm(m ;t4opx mfeiadfsDulnmp u0arenxr ta1fmDelnvs;s)srxoxopiydlpenmneils  Dumxrpou1olt moeiydls raumo u4trxoxrctytfmt li i s0tetmirpoy4lp emfct () ruaxr ou0altomicildlm2rmuvo t4trtoif3iy1lm ranvi (  rxoim3iudlpt  nvsasfs2tmxm oo4texoifeiys sDelums;t0tetnir3oa1oa  lu s;s0 rxm(m oydlm n ieta()aDtrxmp;t1alto ociadla2ranvp;()aeeoxo3oatlm  ln slt0trtoxrpiy1om e fvsasf rtmxroot4texn ocilt a ranmp;t0 etoxf iy1la raueo t  ruoxr iu1om  lncilsfsDrrxrpot1oex  fciatlm el(mon()aexrif3oydlmDeauvs ( srtmim no4lpe mnetl( aDumuro;u1aet mo3tyt a rl(mo u0tleomf iodfaDr neils) 2to(o oy1am eliviat  rtmu oou0apx  fctldfaDum( o;t4altrxr3oytlmteaiei;s0 2uriopoodlmen nvtlt sruaump;u0teto o3iltfaDem( s;(4altrircoydlaDeaueo;( teto(o3nu4altnmncsas srtaumont4apxnmieiadfa rm( p;t4tlxrmr iadomt au ols t2urirpno1lptemiei ()a2tmurooo1aexoiieilsla ul( pn(0aetoxf tadlpD livolt s2urxm3oo1ape miei s)a2tm(  ;o1oexnmi3ildfs2ulu onu0 lxrio3ta1op   ivo;s0teuoir3iudomee fei tfa2ra(moou0apeomietysls2umnmp u0tlxoif3iy1om rauvo (  2xrxr3no4lpteliesasf Dtr(mp;o0apxomf3iytfs2ranvs t0trenxr iytfmtelu ilt0 exr(o oudom nlics sfa2ua(rono1oexo ociysla2rmuvp;t4areoxf iotop r u olt  rtmiopio1lpe  nvslt)sDuaxrp;o0aex mfctltlm ulnvs t0trxnmrciy1lm rln i t0t2xoiopio4lp n ivi s arrmxr oo1alx moeiasfaDrauvp;u4trtnmf oadfpt lneo s t2uoxrpnudlle mfei s) Dumx ono1aptn feilt a el( o;u4arxoio3oytomteanei s)texo(mpoy1amtn nvta()s2rr( pot4ale miciydfs2rauvsnt) ltrmocio1opDeauvo;()s2uoim3io1llenmncil(fsruax p;o0ape mo3ildls2umnmo t4treoxo tatfpDe i i;s) eum(opoodap emfet sf Dtmu pot1oeenio3tysfsDem( p u0 exoxf oydopD  u il( s2uo(r io4ale mies (f 2um(moot1tlt io3iadlm rln s u)aeeoio3iatoa raies t)trto(m iudlm  mietatfsrtr(r oo4oleo i3tytfm2eln o;u0teeoir tydopte i olt tetm(r nu4ll  mnes sfartmu  no1olt iieias sDeanvsnu)arermocto1oatr i slt sruo(r io4amtnmnes t sruaur ou0oee ifcias a2uln s t0tlxnxr3iatfptrluei;()seumxopny1ll  licils)artru o;u4texniiciys s2um(monu4 exriociatlp  ln ols0 rtrxrpoy4om elieslt)sDuaxrooo1opto fcias m2ran p ()aeerxr ty1latelues (0srxo(mpno4olenlfet s) Durxro;t4opeoii3tat aDean p;() rtrir ta1lp rluvi;t)s2tmxm no4ap   iesa()sDtm(m nu0aptn o3tadlmDeauvo t4teenif oadop  ai i;s0 eumimpou1ol nmneias sDrruronu0oetnifeilt aDea(mp (0tlenmf3oadfat luvi s s2uo(m nydopte fes () rtmxr ou1aexomfcildlm rmn pn(0tltnxo3ty1lp e uei;()srtrim3nydamen fct sfsrrrum ;o4teen i3taslm eln p;t4trxrir iotoptelies (  2to(o oy4opt mneta(fsDua(rp;u1aee moetls m2ranmo () rtoio iy1la rai i;(0t2urir3oy1ome  iei s)a2tr(mpot4oltoif3iad a2uan o;(4 lxnmo tatomt  iei ( trtrir3oo4ap nlfes s  Duaum nt4tee mo3iys m el(vo (4teeoxr todfmt  u s;s s2xrxmpnu4lpe lies ()s2um(m nt0oee mi3iasfa umuvsnt0aeeomo iatlat aueo ( t2umxrpiudale  ivs (fa2ta(moot1teen icild a ra(mo;(4 lxnxfctadfateluvsl() rtr(rpnydamenmnvilsfarrmur ;t1alx miciad aDuanmo;(4 rtrmrciotomDeaueslt)t2trio oo1amt mivilt a2rmurpno1tetomfeiydfa ul(vo;(0altoir oytoat luvo;(  etrxmpoo1ll nlnvtls) 2uru  ot1opt miciasla2rmnmsnt4tlxomfcio1fm  li ils0 2urxopoudlp emictlsf Dtr( o;u1oet  ocias a2ul(vsn(4tltoxocoy1oaD  ues ( srtoim3nodaleelnetas  rur(rp;o0tpenioeiad mDra( snu)aexoio tatla  aivil(0seto(opiy4amte fctat)aDur(mp;t1oltn octltls ua(mo;t4tltrif ty1omt an olt setmimpio4am e nvi ( artmum oo0opeoioeiaslsDeauvo;(0areomo tytlpt lnvols) 2uo(opoo4amee fvt (f rtr(rpnt4teenioetatfsDum( p;(0tlerxfciadfpt luesl()srumir3nu1oltelivsas)srra(ronu0tpt mictld mDem(vp ()altrxrctotlm elu ols  rur(mpnudll elivs sf Drax  nt4alxnii3tadls2emn pn(0 ltnmrciytlmt anes ( srtr(m nu4ole mici t) rrmx p;t0olxoio3ils aDul(mo ()teenxrcoydoptrln o;s0tetrir3iodapee fcs tfsDtmumpnt4alt  icildfaDrmuvp;u)arxrifctatfm  lu o t0tetm(mpnydame lncilt srrr( pou4alx  f3iad mDemu o;(0tleoif3oatlmD aneolt0trxoim ou1omen iet (  2ur( o;t4aleomo3ildlm2rlnmp t4arermf tatlat aieo s0 2uoxr no1lme  fci (f 2um( o;u0oeenmoctadfs ean pnt0trtoif ia1optraueols0sexoir3oodome mnet s) 2tm( o;t1alx  oeiadlaDrau o u4artomr3io1oaDr n i;()texo(m oudlle  nvtl() Dtm(m ;t1tee mociltlm emums;u)treoxr ta1fpDrln s t0sruoim ny4lltemictlt)a2tmxrono4optniiciaslaDranvpn(4 ltrmf iadom e iei;t0s2xmir3nodomt lfvils)srur(  nt1opxomieiadfa2ulu p;t) rxrio iodfptr u s () exm(o oodop  lieta(fa2uaxmo;o1tlxniictld m2umu pn()tltnio3io1la ranvo;t trumio oy4ol nlfei t)srumur ;u1tlenio3iltlsDel(mp () reoif3oodopteaivil() 2xoxr nu1lptemnvilsf Dtmur nu1tpenifciytlm emnmp;u0 etrirctydlpteai s;t) 2xm(rpno1lmtn ietlt) rtaumpoo0oexomicils a2el( onu0texrir todlmDrluvolt)teuo(m3oydlmtelneilsfs2tau o;u1aeeo fetlt m2uaumo u4areoxoctatfp  anesls)t2xmio oy4open fcsa(fs2tr(  nt0oet  f3tlsfm2rm( o;t0 rxoifctytfmDraues t  rtmxr oydalenmfvi s a2urumo;u4tptoio3iasla2el( s (4altrmf iy1fmteluesls  eto(rpoodape mfctas  Draumoou1olen fctatla uanvp (0 lerir3io1op rlivolt0setmxopoo1ll  lnvs ( sDtrum ;u4alx  iciat mDulu p t)aetnxr oa1lm eaivs;() 2xo(rpou4open ieia(fs2tr(rpnu0tltomf3tat sDra( p u) ltoiociodop rluvolt)teumio oodlmee icsa()s2tmum ot0alenmo3iytfmDrmnvsnt0artrmr iy1lm rli s;s0srum(m nydopeemieil()arta(m ot0tpxo i3tlsfaDeauvs u4 ltomociytoat lneo;s) 2tm(m nydomenlivs s)s2taxmp;u0ope  f3tls s rlu o u4 eermrciatoaD lu o;s0t2tmxo oydopte ivt s aDur(monu1aptoiociadfmDel(ms (0arxrmf3todlp eaivi;(0t2toim nu1amtelnetl() Dtmxr nu4optoii3tydfm2um(vs t0alenmo3oydopte nei;t0srur(r3iy4aptn net sfsDrr(mp;t0texn f3tytls eau p;t4 etoxfcoytlmtranvi s)trurxm3iy1op  lfcil( artmxmont0altnifciad s ea(vs (0trtrir iatopt aieil( srurimpoodop  mncta()a2rr(rpnu0tetoif3tld sDrm(vo;(4trerif tytop eluei ( tetm(m3ou1ome  ncsatfaDrau  ot0altnmf3ilsla2eauvpn(0aeerxr3oytop e ivs;(0trtoio iydoltnmnvs t aruaum no4opt  oeilslm2rmn o;t0 etoio tadop eaivo;t) 2trxo3ou4ole mivi t) 2uaum ;u4tpxnifeiyd a2eanmp;(4texnxr3oadomDelivs s  rurxr iydape mnet t)srtm(  nt0oltniieiyt m2um( p;u0trenmrctotopDrluvo t  2urxm3ny1lme mics tfarta(m ;u0tpx ifctldfm2um(monu)tlenio3iodlmDraivolt t2tm(mpnu1olt mnvtlt sDuaumpoo4aex mfcildfs2rm(vs;()texnxf3tatlmDr neo t tetoir iydlmenmicsa( aDuru ont0texoiiciydfmDeln snt4alxomf tadfaDr u s;t0texr(opnudamtnmnvtl(  2tax ooo1tlxnmieiltls2em(mont4 renmo3iytoaDrlneo ()s2urio ny4ame miciat)aDtax  no4apxomi3tyt a2ra(mp;()alxrmr tydfmt  i ols0seumxr oodlmte icsatf 2ur( o;u4aeto i3iasfa2eaumonu0aeermr iydlmDrlnes (0 rxm(o nodopeelncsltf Dumump;o4tpe iocias sDuanvs;(0tltnifctadomt livi;s) rxoim ny1lpee ncs ( srtmu pnt1tpe mi3iad m2rlnmo;t4areomr iotlmtelieo;s0s2toxopiu4alte feta( arur( oot0tetnmf3ilsfa umnvp;u4 etrio3todlpt luvs t  2umxr iodam nlnvilt)sDtr(m ;t1apeo octatlaDel( o (0texrmfctotlp  aneolt0seuoxm oydom n fci sfaDuaxmo;o1optoiiciyt s elu on()tlermfcty1fmDr u i;t0srxoim nydapenlnvsat srtaxm nt1olen fciys s2rmnvpn()texrmfcoatlptrlivil() rum(rpoudol  mnctlsfsrrr(mono0altoiociyslm2ul( pnt)alxoxr3iotfmDe u ils0tetoim oo4ap  lfeiatf 2urxm ;o1tptomi3tysfm2umnvp;t4tlxrmo tydlm rln s;s)setm(m ny1llt lici t)srurxmooo0apxn i3ilsfaDelnmp u) rtoxrcoydlm   i olt)sexo(o iy1opte nvtas aDtrx  oo1altoio3iat aDrmn s u0tlerio3iotfpt lues s0texr(r3nydaptemivi s)srrmurpnu4aetn fciasfs uauvp;(0alenmoctotfmt auvil( srxoirpiu1amtemnvilt) 2tmx poo1aptn o3ilsla rmn o;t4aleoxocia1oa r nvols)teum(r3io1ll  lnctls  2trxront4alto feiysls rm(mp;u)arxomocia1fmDraues;(  exmir3nudol  lfctl(f 2uaxronu0oetniieiytls ranvon(0 eerxf iy1lm eli slt  2toio nu4llenlncta()srraumpno4aex mi3iydlmDemu p t0aexoxo3iy1oaDe u i (0 ruoiopiodamt mnvil() 2umum ;u0teeomfeias aDrmnmo;() renxr ia1fp eai o s0srtmir3iu1apte ivsasfarraxroot4tlto ocild m emumsnu4 etoifcoodlaDe n slt)t2umxrpno1ap   nvs t srrrumpot1tptn o3iatfa2um(monu4 exrir todfate nvi;(0s2xrxm oydlltn fctls)a2tmx  ot1apen i3iltfsDemumo;u)alenmfctotoptr u s t)trurio3oy4apeemfviatf Dtmx  no0oleomfctas mDumuvs () exnio3iodfp raieol(  eum(o3iudlm emiet t s2ra(r nt1apx mf3iytlmDranmo;u4trtnir iydlmD  n s;s)trxr(rpio4altnlnvta( aDum(rpno1oltoifetldlm2raumpn(0trtnmr3iydomt auvs;s)setrxr3iydom emncsl()aDumu ono1alxo fciytfaDel( s (4aleoir iatlate uvo (0s2tmio3oo1lmtnmicias)srurumo;u0oltoiociltfsDem(mpnu0 etnio3ia1fmDe uvilt0 2xriopiu1apt mnesas a2rrxr nu1ape  ieiyt m emnmo u0aexnircoatlaDr ivs;t)trxoxo3nudame  ietls)s2rrxrp;o4tpt  i3iasfm umums;t0alenioctatomD lu ilt s2tr(mpiydam elfvia(faDurxro;t4apeniociatlmDemn p u0aeeoircoydfpDrai slt0trxmimpnudale mfvslsfarumu  ;o4tptnii3iysfs2eanmo;t0tltomfcto1fptr nvols srum(rpno1lpen fctasf Dum( poo4oeenmf3iyslm2ra(vs t)altriocto1fp   u ils0 rto(r nu4apt  iviltf rumx  ot4tpx mo3tasfs rm(vont)aexoxf3oydfaDelnei;t)seuoim oy4ap emfvt t  Drr(r nt4tpe mo3iytlaDra(vp;()arxnmr3iytlaD  i ilt sexm(o nu1lmeelivta(farumuront1apt  ietatlsDulnvo (4trxnir oytlate n il( t2urio3ou1amenmivilsfa2tr(mpnt0opx mo3ilsfa el( p u)altnifciatla eluvi s  2xrxopiydape  fci t  2urxmp;o0tlxomoeiyslmDeanvo;u4alxrir oytoa rlueils0seumim oydomee nvsl(f rtrurp;o0tlx ioetas s2rau onu)altnircty1fm  luvo t) exm(m iydllenmivtasf rrm(  nu4aex  feiydfm2uluvpnt4teeoiocoa1oaDrai s;s0 2uoimpio4lm emivia( a2rmumoot0apxn fetydla rmu p;u) lxrxo oytfpte i ols0trxriopoudoltnmnei tf ruax ont0apenmo3ilslm2el(mp;u4aeenxfciotfmDr uei;s  2trxo3iodolenlici () rta( onu4apxo octysls2emn pnt)aetrxrcty1fa e ueo t  exm(o oudape  fcs t srrmxrooo1altnif3iadfs em( s u)aeeoifcta1op raivs;s)s2urxo3oy1omte ictlt)sDur(mooo0alenmo3iatla umumont0 etnxocoytfm  ai o;() 2toxopiu1ame mfcs (fsrtaxm ot0tle mociadlsDemn p;(4 etrmocio1lpDe ivols teurio3oodlpe mivsa()s2ua(r oo0aexn octls sDulnmp (4aleoxr3tatom   uvsl() euo(opio4al emfvilt srrr(rpou0olx ii3iysfa2rauvsn(0arenmrctatfatraieolt  2xmxo3nodapte fcta()a2rrur ;o4aptn fciadfs elnmsn(0tlxoirctytla   nei s) 2tm(r ou1oltnlfei s)aDtrx poo0tpxoiietysfs rln o (0 eenxr tatlmDelnes;() 2xrxo ou4lmen nvslsfsrrm(  oo1opt  i3iltfaDuauvp ()teerif3oydfmtelneo;(0trurim iudaptnlfvsa(  rumumoou4altniietys s ulu s t0altnmf3iodfaDe i i t0 2toir3ny1ame micslt)a2uaumonu4aeeo iciad m emuvonu0tetoirctadom  auvo t teum(r3oy1ome  netatf rtaum no1tlxomo3iys s eauvs ()aeeoxf oydomte u i s0srxoiopoo1al  mfetl( aDurur ;u4alx iictatfmDraumsnu0aexrio3to1omtrlu i s teuoxm no1omt liesa(fa2raxmo;o0aptn oeilsls ua( onu4arxrxo ta1om eluei s)trtr(m3no1am e iviat) Drau ont1tleomoctatla2elnvp;(4treoioctytlaDelieo;( sexoxopoy4amtnlfcta(f Dururo;t1aee mi3iydfs emump t0 rxrir tadomDr u sl( srumxo3iu1ole  nvt (fs2um(r oo4aeeomf3ilt m rmuvp;t)texnxrcoo1fp e n s;t)seuo(o nydlmen iei () rrm(rpoo1tptnmictytla rm(monu4trtrxo iadom r u i t)sexmio3nudam  livt s aDrrx o;t4oet  fcildlmDuan s;t) rtnxr oa1opt  uvi t0 eurxo3no1ole mfviat)sDrmuronu1oeeoii3iydlm2raumpnu4tltrxocia1lp ran ol()tetrxm oo1ll emfct ()sDrrum oo1olxniicilslm2ul(vsnu0arxoif3iytfaDe ueilt) etoio nydolenmici t  Dtrum oo4tlx mfetysfs2elnmo;u)altnmfcootfate u s;s0s2tm(rpiy4lpt lncsa( srta(monu4oetnii3tldla ranvp u)teerxr3tadlmt  ivs;t0truo(rpio1open fvs ()s2urx  ;o0tlt mictasfm2rmums t0tetomr oo1fatrliei;( sruoxrpiydlpen nei s)arrrurpnt4tee iieils s2elnmo;() rerircio1lmt li il()s2trir no4olee fei t) Dumx pou1apx  i3ils sDrlnvs t4alxnio tatla e nvilt) 2trxr3no4am n fvslt) Drm(m no1optnio3ilsfm2uanvp;t4 etrxr3ta1oaDr u ols)texm(r3nu4lpt  fes (fs2ur(rp;t0alx mietasfs um(mp;t)aetnmf oa1fatelnvi;s tetrxr3nodlm emnes s)sDurx onu4olx iieilt aDuaumsnu0aetnxfciydfat aues ( s2umirpoy1lme mfvslt  Dtmxmpou0aexniieiltfs em( sn(0texrmrctodfaD lu o (  2urxr ny4lpt mfvi ()arrr(moou4tpx  i3tytfm2ulumo (4areoiociytoat  ues t)texo(r3no4ame lnci sf Dumxr nt4olxnifeilsfs ea(mp t4 renio ta1opDeaivolt0 rxmxr3nodoltelnesa()sDtm(m ;u0optnmociys m emuvpnt)altrxr io1oaD  nei s)t2xr(rpou1amtnmnvsat sDtmump;t0apeoioeildfm ua(mp;(4aexrmrciadfpD ai o ( t2um(o oy4am emivsl() Dumuro;o4tet  f3iysla2rln o;t4 exrxr oatomteanes ()sexoir3oy4ame mietl( artrur ;t4tetn i3tydlsDranvp t4 lxnmf3iytlmDelu s t)srumim3iy4lm   nvi (  2trx  ;o0tpeoifetysfmDul(vonu0 lenxf3tadfpDrlnvi;t0texr(o io4lle lfesl(f Dtm(m ot4aexomi3taslm ua( o;t4 eenxr3tydlpD aivslt0srtm(o ou4lpt  fci ( aDrru pnt4tlxomieiyd sDumu o;u)altoif3ta1opteli o s srtmimpnu4lmee fetas aDrrxm ;t0altomf3ils a umu p t4 etrxfcoytlpteanesl(  rtmxo3nu4oltnlfvtasfsDua(  ot1aexomoeiadfa ra(ms () rtriociydom  luvs;s  etmim3io4op  mnei t)a2trxmpot0tee mfetytlaDrmn s t4trtoir oadopDrlu olt  2xmimpnudlleemnvtls)artr(ro;o1alen f3tysfs emnms;u4 etnxrciadomte i i;s0 rto(opnu4ol   iei sfsrurumo;o0tlx mi3tysfs2ranvo u4 renmfcia1fmtrlivils) etrio io4alt lfciat) Durxrpnu4olxoii3tas a em(msnt0 rermfcio1oateaieo t0seuoxrpno1aptn feiat) Drrx oot0ale mociad m rlnmo u)trerxrcoytfpDrlivs;( seuo(opiu1amtnmiesat) rraumpoo4tex mi3ildls2eau p;(0trenxr todoatr ivi;(  rxr(r ou4am  lnesls)aDrrx  no0texn fetaslmDemu sn() exnxociatfa r ivslt0 2um(rpnydape lfvtls)a2um( ono1apxoiicildlaDuln snu4 eenif iy1fpDrlivs;t  rto(mpoydamtelfcs t) Dum( o;o0ope mf3iysls2rlumsnt)artrxo io1fmDe uvs;(0 rur(o no1ap e nvslt) 2uau p;u1alt  o3iasls emu s;(4tetnxo ta1omDrau olt0 rtr(opoy4om  licsl(  Duaxmpou4tetnioeiaslmDul(mp;t)arxomo3oy1omt ai sl(0setrxmpiu4lpen ietls s2tr(m nu4tpt  oeiytfs2rl( o (0 ltoifcio1opDr uvols0srtmirpou1ole  feta(fs2rm(r no4oleomfeiysfsDuaump;t)areoif ta1fpD  ivs;s)srtm(opio1omeelfcslsf 2rax pou1ale  ocilt sDrmnmo ()trxoxo oydfm e neols)srxmxo3iodlmtelfvs tfsrrau o;t1tltn f3iadfsDrmnvp;u) ltrio3iytomDr ieo;s teur(o iy4ap elnet ( artmu o;t0apeo f3tydlm2uanvp t4artrircoydfpD  nvi;(  ruo(m iu1am e nei sfsrtr( o;u0tle  f3tlslm eanmp t4aexnmocoadfpD luvs;t t2uoir oy4lp emicils)srtaumpoo0aee ifeiatls rm( o u) rxnmrcoa1lpt auvolt0 2tr(opnydalt  fet tfsDrmxm ot1apxnifcildlaDrl(vpn()tetrmf3oatlp rlnvs;s0tetr(r ny1al e fctlsf rta( pou1oexomfciadfaDuauvsnt4 rerxf3to1fpDr ueilt0 exmxmpnydlmtnlfvt (faDrmur nt4apxn i3tysla2eanvsnt0texnir iydfpt lneo (0s2tmiopny1ap elnvt s)aDra(monu4opeoif3tldfs2eaumpn(4altrmrctadoaDr nvo t s2trxr nydlm e ieilsfsDuau  ;u0apxomfctadfsDrmnvsnt) reoxr3tytop elneils0teum(r3ny1ol  mivslsfs2ra(rpnt0aexnii3tlsfa rlnmsnt4trtrio3oydfat aneol(0 ruoxm ou4olen ivta(fa2ta(r oo0texnmoeiydfmDrluvp;(0 renmf iadlmDran s;(0t2xmir3oydlmtnmfesasf Dua(rpnt1tlenmieiatfa2emu p;u4alenxf ty1opD ai i;s)trur(r oodame miei t)srumuronu4alt  ociadfsDuan ont)aexnir3ootfatr i olt0trtmxo oudamt lnvsat)sDrruroot4tpxn o3ilsfa ea( o t)altrxr3to1opDr u s;t trxo(m3iodop  mncsl(f rur( ono1teeo i3iatfmDrm(vp;u4tetnircio1opt luvs (  2tmxopoudll e net t)arrrumo;t1olt ifeiad sDrm(mo;t0tltrifcto1oaD  uei;t  exrirpnu4am e fcia( sDtru ont0altniieiltfs ranmon() exrmo3iytlmteln i;() 2xoxm3oydll n fvt s) 2tr(  no0opt mf3tad a emumsnt4 etnmr3iydlmt luvsls0sexrimpio1amenlivi s sruaxrono1tex iieiyt a2umnmp () lermrctadla e ivo;( t2ur(o3iydlp  lnvt s)arrrxrpno4oeeomfciasfm uln pn() etrxr3oa1fat ln ilt  etr(o nudal e feta(faDrmu oou4aex  ociasfa ua(vo;(4aetrmrcoy1fm raneo t trtm(r3ny1lp emfesatfsrtmxm ou1tex ifctlslm eanvo () renxrcto1opDrlnvs;(  2xm(r3nu1alen nei s aDrrum ;t1alt  f3iytfsDul(vp u0 lenir oy1oatr nei;t setrxopoy1lptelfci tfsrra(mpnu4optomfctyt a rm(vo (0artrmf3tadoaDrlies t)trxoir3iu1al n ictl(fartaxrooo1opxn fcias sDul(vo u4 leoif3oa1fm r n s;t)teumxmpiy1op   icslt) rtmx pot4oetoii3ildfsDemn s;(0texnxr iatla raues;t setrio iudop emies sfs2tm(mono1apeo feiytfs ea(vp t4alerxocoy1latrlnei t0setmio3nudal n ictls sDua( o;t0tlt ioetldfm ulu s;u4 lxnxrciydlmtr uvs (0setmxr nudoleelnvt (f 2urx  nu0altnii3iltfaDean snt)alxoif3oydoatr ivo (0t2xr(o3oo1lm e icsatfsrtax  nt1ape  f3iys m umnvp u0 rxnircoy1opDr n i;() 2uoxrpio4lptn nctas)arum(r ot4altn oetld a el(ms;t4trxrir oodopte u sl(0t2tmxo iydap e nes s)arraump;o0opx mieiyd sDum( onu0 reoxr iotfm rai ils)teto(o oydlptelnetls sDtmxm ;u1tpe moeiltfm2rlnvo t) rtoxo3oy1oat aieo t0t2xr(r iy1amtnmfctlsfsDraxmooo1tex  oetlsla2rl(mp u0tleoir3ia1fa eln o;s seuoxo3ny1lle  fvilt)arumxmooo0aex miciysfs ea( on()treoifcoodfm ean o s)truo(rpiu1lme  fes tfs2urx o;o4tetn feiltla ul( p;(4 eeoio3ta1op  livo;s)s2tm(mpiy4llt mfvilt arrm(mpoo4olxnif3tydls2eln o t4artrmoctydomDe uvslt  rxmio iu1lm nmfcia()srrrxmoou0oet ifctasla ua(vo u0alxrmrcoatfaDrlnvols0 2umxr3oy1lptelneta(fsrtr(mpou4oetoifetlsls2elumonu)trtrxfciytla e ivs;s trxoxopoo4op e iesatf Dtmur nt4opto o3tysfsDuln s;()teerxo3tadlp elivs t0t2uriopoy4lm  livtl( s2um( onu0tee  i3iat a2emumont4aleoio3ta1fa   u s (0 2toxo iudam nlfcsltf 2rm(rp;u1ape  oeias m2rlu snu4alxrxo3ia1fp  an il(0sexmiopoy4ale lfes tfartr( poo4tlxn ocias mDrmumonu4 lenxocoodlp rluvs;t)setoirpoo1ame lnvia(f 2ta(mono1oee  ocild sDea( p;(0aetomfcoydlatelu ol(  etrir3ny1oltelfes s  rrrx ono1tle io3iysfa emump ()trermociatoaD aueil(  etr(o iydlm nlnesl(f rra(  oo4apenmoctadlmDranvp t) lxrir iy1la ran i ( trxr(r3iudaltelnei (farrmur ;u0apt mfeiytls2rlu p u)aleomoctadfptr n i t0trtrirpnu1am nlncsl() rur(mpnu0tpe mfciatlmDrauvonu0tlxrmo3tytlpDe nes s0texoxr iudalte netlsfsrurxrpnu1ale if3iadla rlnvp;(0 rtnio oydlmt  ivo t)t2xmio ny1al emies sfa2rmum nu0tlxnioctldfa2rlnvo;u4trerifcootla   ies t trum(m io4oltnmfctlt)a2umxmp;t0alto iciltfm umnms;(0arxnifciatfp elueo s seurir oodalt mfetlt  2ta( poo4tlen feiysls2uanmo ()aeermr3iy1fp eai sls) 2ur(mpio1optnlivias  2trx  ;o0open ictadfa umu o (4 leoxf oadlptr neol(  rxo(rpou4alte nvia() rrm(rpnu0aex  oeiatfa2ulnms (0 rxrmf tadfm  lu s s0t2um(o3nodom elnct (  rrr(  no0tpx io3iadfmDua( p u4texnxo ty1fmD  uvs;(0sruo(r oodam   iei (  Dtrxmo;u0oex ioctatlm2eaump;(0aexnxr iy1lm eau s;( setrxmpnydom nliciatf rrmumooo1tltnio3iadls eaump;t4 eermr3tytlmtr n ols)t2xm(m3nudalt  icsls)sruaum ot1opxo o3ild a2ra( pnu4 rxoir3todoaDr ueo s0teumir no1lm  lnvsa(fa2raxmoou1alenifeilsfm2ul(mp;(4arenir3iydlmDran s;s0texr(o3oo4aptemieilt a2um( o;o1aptn o3iad aDrmnmp ()aexoxrcoodop rluvs s)s2xoiopiydol  mict (  2tr(rp;o1aetnio3tltfmDeluvp t4trerxr3ootlaD  uvo s t2tr(r3io4lpt lnetlsfartaumoou4oeeomf3iytfsDrm( ont0 lxomrcoydlaD  u s;(  2xrirpiudopenliesa(fartm(rooo4tle  fetys sDeau snt4tltrxfctotoatrlu o t teumxo oy1alte fei t a2tmxmpnt1oeen fciad aDuanms t) ltnir iydfat  ieo;s)tetr(o3oo1lmeemfcslt) 2rmu oou1altnmi3iydfmDeanmp t0 exnxo oy1oatrlnvo;() euoim3nudaltn nvil()srra(r ;u4oeeomo3tys aDra( p u)trtrxr iy1lp rlu i;t) 2umir3iydalenmfct t artr(r no4aex ii3iytfm rlnms;u)tetrxocootfatrlnvsls)srum(o nydalt lfcsls  2urx  ;o4olx mociys aDeln o t0altrirciydlpt  i ols0trxmxopny4am nmfvi ( s2tmuront0ale moeiadfm el( pnt0teerxr3oytop eluvi s s2trir3oo1amtemneta( arrm( pnt0optomf3tatls ul( ont4altrmo oodlpt anvs;t0 2tmio io4omenmivtas  Dur(rono1tltoiieiyd mDelnvs;(4altnxrctodlmDelieols0sexmxo no1llen fvtl()aDrrxmooo0opt moetldfm2ranmo;()arxrmo3oa1lpDeaies t)sexrxrpnudaleelfes s) rtmur ;u0apxnmfeildla2umumo;t0 exnxfctadom e ieil()t2tm(rpny1lpee nvs t)srrrxrpnu1olenmocilt s eanvp;u0 lxnmrciydopD  u o;s0t2xoxo ou4lm  livt t)aDra(m no0olt iieiydla2em(vs () eeoxr oadom  aiesls0srxoxm ny1om n fesls a2rrum no0alen f3tydlaDemu o;(0tlermr3oy1omt lies t0texoxmpou1am emici ()artaxmpou0oex io3iatls ranvo (0 rtrif3oo1omtrau ilt srum(m ou1lltemfvils  Drrxm nu0oeen oetyt a2eluvp (0 ltoxf3iy1laD auvils0 eurirpiu4amt mfesat)aDraur nt1aexoiieiatfa ua(ms (0 ltrxo totoa r iesl(0teum(o iydol  lnesa() rra(rpno1opx moeilsfs2eau o u4trxnxr todoaDr nvi () rumir iudale lieil(  2ua( o;o1tetniociysla el( sn(4artnmo3oa1om eluvo (0texr(opoo4lm e ncs s s2ur( pou4oex ifeiadfs uau pnu)teenmf3oytoat anvi;(0 rurimpnydom elfet sf rtr(rooo4teeomf3iydfsDeluvp t0tltnxocoadom e u o s  2xo(r3ny1ole lfet tfsrurxmp;o4alx  i3ils s2em(vpnu4alxnmocoo1oa   nei;s tetr(mpoudomenlfvt ( arum(ront1aetomietlsfa2uluvont4 rermocoa1fa  lnei t0t2uoxo iodomeelfeslt)srtm(mooo4aeeomiciatfm rlnms;u0 rermr ootlmD lnei;(0 exmxo ou4op  livi t)artm(rpnu1olx ifetysfa2eln s;u4aexnmf ta1fa   ues;(0t2xoxr3iu1opt  nvias) Duaur ou1tltnmicildfm rmn o t4tltoxrcoadfpte u o;s0s2uo(r ou4ol nlfesatfsDtmx pot1ale iocildfs el(vsnt4artoircootfpt  u slt)seuoxo3oodlmen nvsat) rtaxm ;t4tlen fetltfa2um(mo;u4tetrxr3totla raueils0srtr(o iodaptnlicsls) 2urxmooo0oleoifeiyt a rluvp;u)aleoxoctytfa r nei;( t2toir nu4apt lict ( sDrm(  nt1opt mieiydfs2ranvp u0 rtnmfcoodoateauvils  2to(r3oy1aptelicils  2truroot4ope  ieildfa eau o;u) rerxr3oodfaDrln o;()sruo(r no4lpenlnetas a2tr(  nu4tleo fciydfaDemnvs;t0teermo oatfptranvsl(0texoir3iodlpenmfet (f Drrxmpou4tee mo3iytla2eaumo u)teenio ta1laDeauvi;s0s2tr(r iy1lmeelnctls)artmxrpot0tet  i3ias m ul( snu) eeriociodom  luei (  etoxr ou1ole  nvs t)aDur(rpou1tee  ieilsfsDulump t4aetoiociadlptr n s;(0srtm(rpnodlm nlfct sfarrrxm oo1tex mfctad mDum(vsnt)arenif ia1omte u sl( sexo(o oy1lpte nvsl( a2rm(mpou4tpxo icias mDra(vpnt0alenif3tatfm ran sl( setr(o iu1amt lfvsl() 2tr(  ou1aee  ietatfmDumnvo t) exrxo iytlmtelivs;t trurimpoy1alt micsl( a2um(moot1tpeomoetlt a2umumonu)texnio ty1fmtranvs;(0teuo(rpnu4altelncia() 2ua(ronu1tetnioeiat s2ulu s u4arxoir ootfptr ivs;() rur(r no1ll e feiat)s2rru pot0optn ietys a2umnvp t)altrirciydom elnes t0 euoir iodamt mivias s2uau  nu1apx ioeiyd aDrmums;(4trxrxr oo1fat  i ils trxm(m nu1am  mnvsatfsrrmx pot4tpxniictld s rauvon(4trxrxrctadomtelnvo t) 2xmxmpnu4alenlfcsls aDtaxmo;t0optomicilsls um(vsn()altnxocoytomDe n sls0teurio3nodlltnlicsl()sDrrxrono0tex io3iad m ul( p (0 etrirctydlmDr nvo;( trtmxmpny4am  liet t arra( poo4oltnmiciydfmDem( s;t4 rxnmo3ta1fa  aivs (0 rxoimpiy4lmtnlivi ()arra( ont4optnifctas a um( on(4 exrmr oa1fpDe ivol() eumxo3iy1omtnmics t) Draxmono4apxnmfciydfaDeauvsnu) lxrircootlaD lu i s)s2triopoudlptn nvt s sDrrxmo;t0apeo ociys s rl(vo () rxnmfctodlpDeanvo;s)t2xmxm3no4lleemiet s  rtrur ot1aex iieilt a2ul(vo;()tetrxoctytfm  luvo;s) 2umxo oo1olt mfvsa(fs2tmxro;o1apeo i3tytlsDra( pn(0tltnxociytla e nei;(0truo(o3oudlmtemfvslsfsrrr( p;t1aet ifeiydls eauvp;u0tltnxf oo1lp elivi;t  exoxo3nodlltn net s)aDrmumpnu0tpxn feiyslm2ean on(0trtnir3io1opt an s;t0 2trir ny4op   feilt)s2ra(r oo1ope  octatlaDrln p;u0aexrif3ootomD lneol( s2toir3oudop emncias)aDur(rpnu4ale mo3iytlm2em(vsnu4alxrmf totlm eaneil() eto(rpnydopenmnvi s) rtmumpnt1oetomoeilsfmDrlu p;u) etnif3to1omteln s s0sruo(r oodomeelnci ()aDraxr ;u0oltomo3iatfmDelnvo;u0alenmocta1opD ai i;() 2tmirpiydlmtnmncsls s2rmx pnt0teto oeiysfs2eanvs t)arxnirciytfp eluvi s0sexoxr3oy1al  lnesltfsDtmuronu0tpx mfetyslaDelu o (0 ltrmocoytoa  li s ()truo(opnudopenmfvsls)aDra( pot4tpx ifeiad s uanms;()artnmo iytoa  livols) eur(m3oodal elncsasfs2taxr oo1tee ioeiat sDrl( s;(0alenmr3iadom eauvo s) eto(m ny4amteliviat)aDra(r oo4oltomo3tldfmDumu o;(0 exoif3ootlpD ln o;( s2trim oo1lp nmfeta()aDtax ooo1open ietysfm2rm(vsn(4artnmo3iydla eaneol( setmio3nydop nlnei ()srtrurp;u1alx mfciydlm2uan s u0 lxomr tytlaD  uvo;t  eumirpoo1ll emfvsa( s2rr( o;o0apeniieild a2rmnvo;t) eeoio3totom   ies;t0t2toiopny4aptnmicil()srua(rpnu1texo i3iltfm2uaums ()aexnmfcoadlatraivols0t2tmimpny1lltnlnvias)aDua(mont4oltnifciytlsDuauvo;t) exnir iotlp   i sl() rxrxr3oy4opt  nei ( arur(r no1tlx mietas a2rmu ont4 lenif iatfa   uei;t0 2tm(r3ou4ol  mfesl( s2raxm nu4texn fctytfm emuvonu0aexnmo io1omD  u i;t0srxoim3no4opeelnctlt) 2um(ronu4oltomi3ilslm ua(vonu) ltrxocootopD luvil()seum(mpnu1aleemnvsl(fsrumuro;t4aleo f3iytlaDelumo;t)tltomf3totfa ranesls0 rxmxo3ou4llt mfesat) Dua(mp;o4aee mfctyt s2ran s;(0aeeoif3iytoaDran o s)srtoxopou1al  mfes ( aDrrum ;t4tleo ociys s2elnvp () etnxocty1fat  ieilt)trtmirpnydlp  lfcs ()srumur ou1olen i3iydlm elnms ()tetrmr io1oa  lnvo;t teum(mpnydam e ieslt)aDurx poo1tpenifcildlaDuau p;t0teermfciodlatrliei s0setm(mpiu4olen fvi () 2rmxr nt1alxn i3ildla ea( s;() exomf tydfp  anvs;t s2uoim no4ol elfcil(fsrtr(mpou1tetoioeilslaDrm(vo t)arenmfcoatfm ean o;(0tetoxopoy1olt mivt t a2uau pnt4texnif3iltfa2el(mo t0 ltnir ia1om e n olt)tetm(opoy4lmenlfes (faDuaxro;o1aptnifeiytfaDrl( p t0altrmr tadfat  neo t0srxrirpny4lmt livi s  Dtmuro;o1oetomfciytlmDelu o;u0 lermr3ty1lmt aivi;( truoxrpiudape  ncsas)s2rmx oot1olxnmociad aDrlnvp t0arxrxocoy1oa  ln o (0tetmxm oudalt micilt)arrm(root0tpen o3iyt s2emn o (4 rtnmr3oytfat luvs;(0tetm(rpiudale mivsat sDta(r nt0olxoioeiaslm el( pnt4tlxrir3oydlmDe n slt0trumio iydlle lfet sfs2tmu  ot4apx  i3ilsla ul(ms;u) etoxfctadlpDrai o () 2xo(mpoy1olen ivt tf 2ua(r ot1olx  fcils a elu s ()aetnmfciotfm raneol( s2xrio iudamenmfcs sf rur( o;t0apxnmfeiatla2ea( o;()aexomo3iadomt au o t0s2xr(rpny1omt livtl(  2uru  ;t1oeeomiciadls2rluvsnu4 ltrxfcta1lp r i i;t)sexrirpoy4amtn ivsl(f Dumu onu4olt  f3tas aDrlumon(0aetrmf iodla ean o;( seum(o ou1lp   ivtlt  Draum no4oee if3ilslsDrau on(4trxnif3io1lat aieilt0 etoiopiy4olenmicias a2rrxr ;o1aeeoifeiytla ua(vp;u) lxrircoydfmD  neslt0seumxm3nodoleemivs s sDur(m no0tlenmo3tat mDum(msn() eenir iydoa   i o;s)t2uoxm nu1lp e ietas)sDuaurpno4optomiciad m raumo;()tlxnircta1oaDeluvil(  2tm(m nu1omenmnvsas)aDtau  ou1tpxn octadlm eanvp () rerxo oo1oatrlivo;t)trurxm3iudam   nei ( s2umu  ;t4olx mfeiyslm2rm( pnt4artoir ta1oa elu slt)sruoim3nodame  netl( aDrru o;u4oetoiictas mDeanvo u4altoir3iydfmDraneslt) rtoim3iy4lle mncsl() Dtaurpot0texnmieiadfm ul(mon(0 lxomr ty1lateaieo;s0setoxo3no1om  liesas sDumx  nu4tetnmieiyt s2rm( o;()aexrxo iodla  anvi t) rxrio io4aptelnvi ( a2urxmpou4alxo i3iaslmDrm( o t)aetoxfcootlpDraivo (0s2uo(m3nodlpe  nctlsfaDurxrpou0tpxo fcilt mDum( snu0 ltrxr tatla rlieo s)texo(r3ny1ap n feia()a2urxmpot4aexn feiydlm eau o;t) ltrmo to1om r nes;s t2tr(m oudlltnlnvs t)a2umumooo0texnmfetatfmDumn s;u0arerxo iatlp e nei ()setmimpoy4apt mies sfsrururo;u0tptnmfcias a2em( o t)tetomo3oodom rluvi t seumxo iy4lpee fct tfsDum( pot4apt  fetatfa2rl(mpnu4 rtnirciadlmt aneil( t2ur(rpnu1lpe livsls s2tm(mo;u0optnmfciys m rl(mp;t0aeenxf3ty1fp rlneo s trtmxo3nu1openlfcta()arrmxr nt0oleoii3iyslm2eluvsnt)trtnif ia1la eluei s0 euo(mpno4optnmfciat a2uaxrpou1ope iocilslmDeanvsnt4 eerxrciodlaDelieo ()t2trim3oy4lpee ncs sf Draur ;o1tptnmoctltlm2ea(vp;u4tlenxo3ta1lmDr i il(  exr(m oy1lm nmivt (fsrumum nt1texn i3iatla elu o;() leoio iotfmDeaieo;(0 2trir3oy1alt lneiat) 2ua( ooo4tee iictyt s uau o u0 etnio ty1lp e ivs;(  2uoiopnydop  lict ( aDuaumono0tltomf3tas a2rmu pn(0trxoir iodlpDe n s;t0trtoxr oo1om emicils) Dtax  no0openioeiydls2rlumo;t) rerxf iy1lpteaivo t0 2to(m iydolt  fetasf Dtmxro;t0aee iociys a2em(mo ()tetnif3oy1om rlies t s2umxm3nydam elfei ( sDumur ot4olt mf3tls m rl(vs;(0tleomo iy1fmDeau o (0s2xr(rpoydll  mncil( aDrm(r ;u4oltomi3tldls emu pnt)tetomo to1lp  aivi ()trurxmpio4am  lncilsfsDuaurp;u0aeeoio3tasfmDemn o t4altrif tydfpt lu o s0t2uo(r3nu4opee fvtltfs2trxmpot0teto fetad a2raumo (0aetnxr iydfatrlieslt)sexmxo3iu1am elivia()srrrxm ot0aee  ieiadfs2el( sn() etnio tytlmD luei;s truoxrpnodllte iet s)srraumonu0oetoio3iydlmDuan pnt4texnmo3oatla rau s;t) 2xm(o ou4am  lnvtatf Dumurpoo1oexoifctad aDeau snt0tetnxr to1opDeanesls) eumxo3iydop  mnesa( sDrm(  oo1teeo ieildfs2ranmsnt4 etoio todfp  liei () etm(rpoo4lptnlncil(faDrr(rp;t0oex mociysfm elnvo;(4 eenxr oadlmt aneo;s)trtoirpio1aptemicta() rumxmono0opxnif3iyt a ulnvon(4tleoio todfmt
\ No newline at end of file
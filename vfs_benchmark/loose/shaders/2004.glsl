@@ -0,0 +1 @@
+ues s0t2tmimpio4aptelictl(faDur(m ot1alen fctldla2em(vs;t4tlxoxo iotlmteaivslt0 rxm(m3nu4lleelfvt t srua( ont1alx  fciasls2ul(mo t4tleoxr oatoatr nvo t0sruo(opny1lme lfci ()aDtmu  ;o0aptn f3iasfaDua( p;()teenmo3oodlatr neil()trtm(r oy1ol  micils)srtmx  ou1aptnio3tlt a2rln s;u0altoircto1om  anvilt)t2ur(rpou1altelivt t)a2ur( pou1olxn iciaslmDuan o;t4 eeomrciatopte uei () rto(m3no1openlnetlsf ruax o;o1alxnioeiad m2umnvont)alermo3oadfa rlnvi;( srxoir3iu4lltelncsat)a2tr(roou4oeeoioetlsla ulnvs;u0aetoxr3todla  auei;s setmxm3iodlpe mfet sfsrta( ooo1texniocils a elumo t)artoxf3ia1lp   nvolt0 exrxo iu4ll elfeil() Dtmumo;u1apt mieild sDumn onu)tetrir3tytlaDrauvsl( tetoxmpnudamee fetl(fs2rrump;u0alt  ieiadfs ran pn() rtnxocoatfm ranvo ()trtrir nu1lpen nesl() 2rmu pnu4aee  o3ilsls ea( p u4 lxoxocoatfm eaueo;s0srxrxr3oy1ol emfvi s  rrr( ooo4opx miciytfm2rlnmp;t0teerifcta1fmDelnvil()srxrxr oo1alee nes t aDta(mo;u4aeeo i3tlt sDel(ms u0altnmr oydfp r ivs (0t2toxmpny4lp  miesat) rtaxrp;t1opeo o3iasls um( s;t0aetrxf oo1lp r n o;t)texo(r iydol elneslsfs2uax poo4oeeoio3ildfs rlumpn(4 rtrmr io1opteai olt0 exmio iydap elnesat)sDuaur ;t0ape  o3tasfaDrmnvpnt)trerio3oa1faDe ieil() 2toxopoo1lme  icta(f rrmx o;u0ape  f3iydls ulu p;t)tlxrmociatlpteanvilt truoiopno1ll n ietas)arua(r ;u4oltoifcilt a uauvsn(0 etoxocoytoa  an o () 2toxr ny1om emivs t)s2tru p;o1oetn ietyt aDrl(ms;(4 eerifcoytlmD  i s;s)srur(mpou4al  lfci (fsrrmxm ;u4oltoioctlsfm2ran o;u)tltrmf3ta1fateauvo;t0 rtmir iydlmeelfet s)sDtrum ;u0opeomoetadlmDum( snt4 ltomr3ootopt  i slt)teurxr io1ap emfvilt s2rmum ;o0altnif3tldfm elu o;u0 rxomf3ia1op r ivil( t2xo(rpnu1lltnmncia(faruaxm nu4tee mo3tytlsDrm( s;t4 ltomfctydfaDrau s;t)trur(r3oydlm e ncia()a2taxrp;o4apxnmiciatfm rauvo t4arermo3oo1fm eln s;t0s2tr(r3nu1lltn neia()a2rmxrpnt4tetn octldla ul( p;(0 rxrmf ty1omtr ivo;t srurxr3iydal e fvs sfaDumu o;u1tetomfeildls ean p;u0tlxomrcoadomDeln o s0 2xo(mpnudoptn ivt s)sDuax poo4aexomoetlsfm2ua(vs;()arxnxr3oy1fa eau i (0sexoxm3ny1lpe  ici t s2trx pnu1opxo fciatlm2eluvsnt0 rtrmocta1lpt  uvs;s s2tmio nudoleelncsasfa2urxrpnt4alx  fcild a2ulnvon(4 reoircoy1lm   n il(0t2uoio3nu4op nliesl(  rtr(mp;u0open fciatlsDemnvo;u)trtrxo3tatfpDraueilt)t2tmxr ny1lp  lnei tf rtmxronu4tpxoii3ilt a2umu o;t4altnxr iytlpt aieo () 2um(o3nydole  nvil()sDtrurp;u1tpenifciytfm elu o;(0artrxrciadom e i s t)trtoir3oy1omtelfct sfsrtmxmoot4tee  o3iat aDelumont4teenmf iy1om   iesl()s2uoxmpnodol  mfvilsfsDtrxmp;t4oltoiiciys m2rlnvpnu)alermfcoa1fatrlnvi;( s2uo(rpiy4lleelnet tf rta(ro;u0tleo f3iytfa ua( on(0aexoifcoa1lp  aivilt trum(rpoodlle mfet (fa2urx poo4olxoif3tlsfmDel(ms;u)trerif iydfpt lieilt0teuoxopoydlm elnct s sDrrx  ;o0aptomicilsla uau o (4aetrmo3oy1laD lu slt s2tmxrpno1ome micsasfa2umxmpnt0tex mfciad aDua( s t0aexomfciotopt auei s0 rum(mpou4olee nvil(f Dtax o;o1tlxn ictyt s2eaump (4teenircia1opDe u ilt) rxoxm oodole  fvt t)srtmxm ;u1aexnmfeiasla emnmo u0tlxoxfcootlatrln olt trxrxo nu4alen fviat srrmx p;t4tetn o3iad a umnmo t0 etoiociatoa  auvils)srxrimpiy4am nmncta( srtaur ;u0tlt  iciyslmDumnms u)arxrxrcty1oa   nei;( srum(o iodom e fciasfsrur(r ou0teto ociysls ua(mo t0alxnmo3oadlaDe ivi;(0seumio oy1amtelncia( arrrxm oo1oee mf3iat mDel(ms;t)tlerif tydlmDe uei;t trto(m3oo1ll nlicias)arta(mp;u1aexomicils s2umnmont4 etnmf3tytopD aieo (0s2uoio io4apenlfcilsfa2trumonu0tptn f3iatlmDumn o;t)aexnmr ta1lptr ueslt) etm(opnudap nmncs sfaDuaumonu4apx ifeildla2eln o (0tlerxr3ta1lmDe u s;t)texrim3io1om   nvslsfartmurooo1apen feiasla2ran o;u)arerir oydfaDe i olt0s2tr(opno4altemfeiasf ruaurpou4tpxn f3tls mDrmn o;(0arerir oatoatelivsl() 2xo(opou4ale lnvt sfaDumxmpnt1teeo ieiyd s2rln pn()altrmf totfa elnvi t0 rurxmpoo4oltn fei t)a2umxm ot0opt mfeiysla2rmuvont)trenmf3oytlm r n i (0 eumirpiu1opte ncil(  rurxrp;t0tpx ifciasfs2rlnms;t4aeenmo tydfp  auvilt truoir3no4ol  lfeta( sDuau  ou1apeoii3tlslm uauvpnu4tetrmfcoodoateaivi;s) 2uoir3nu1alenmici (fsDrmumo;u4tleo fciysfs2um( sn(4 lxrmf oy1lpt luvi;( srxoim nudomeemivta(  2tru  no4tlx  i3ildla rmnvp;t0trtomfctatlaDrauvo;()t2urio3no1oleemivsa()srumxro;u0oex micilsfm emu p;t)arxoxf3oa1lat  neo;(  2xm(opoudlmee nvtlt)a2tr(mo;u4aetnii3iltlmDrm(vp;t)trxoir3oydlpteai i;t0 2toir iu1lleelfet tfs2taxmoou0oet  ociat a2uanmo;t0trermr todoat  n s;s trtriopoo4ll nlivs ()srra(  nu1alxn icias a rauvp;u4 exnxr tydfaDrlnei;t0t2tmirpou4lmee fcias arurxroou0oexo icildlmDuau p u)tltnif3iodop rai s;t)s2trxm3oy1op   nvtltfa2tax pot1tee  o3iys m2umnvsnu) etoxrcto1fpD ai i s)trto(mpoodamtnmneslsfaDtau  oo0tltnmi3tadfmDrl( s;u)teeoif3oadoa rlues t0s2uoir3oodlp  lfet sfaDtrum ;t1oex  fctltfa rmnms t0 rxomociatlm raiesls teur(o3oo4ome lfvt (fs2uauro;o1olx io3iasla emn p u4arxomfciytlm rln i (0s2uoxopnu4am nlieslsf 2rr( onu0aetnmfetyd a rluvp (4artnmr3to1omDranvol( t2uo(r no4al nmncs () rrmur no1apenif3ias s2ea(ms;t4alxnmo3oo1lpDe nei (0tetmxmpnydll e nvt sfa2ururonu0apt mietyd s2rlnmpnu) rtrio oydomD lieo s tetrirpiudale lfvsls)s2trxmp;o1tlt  fctasls umu pn(4alxoxo3tadoat aueols0s2tr(m no1ap  liei (f 2urxr nu4olenioetltla umuvpnt)tetoxo3iydfmt auvsls  rtrxr io4om nmfet s  2rmxrpnu4aeeomfeiyd s eluvsnu0aeermf3tytfmt au i (0s2xoxopoydap n fcsas)s2taurpnt4apt ifetasla2emnmp t) exrifcoatlmDelnvi (0 exrxrpiudlp e fvsl(fsrraxm ot1ope ifeiysfm ulnmo t0 lenxfcoydlaDrai o;s)s2urxm3nu4ameelfvs (faDraxm ot4tleomi3iasfa2rmumo;u4tlerxo3oadfaDranvs ( trtm(rpny1ol  lnvs ()s2ra(ro;o0tlx ifciyslm2um(vo;t4 exoif3ia1oa eauei t teur(o iydal   fes s) Dtaxm ot4alxn f3ildfmDeaump;t4alxnir3tatlat aueo (0 rurxr oo1lmt  fvil(f rraxm ;u4ole iieiatfa eau s u4teeoio3iotopt  nvo t s2uoio3io4altemnvt t)a2taxmono1tlt  o3iasfaDulnmpn(0 lerxr tytlat  uvilt srxmxr oudal elnci s)s2raumonu4oeeoifciat m2ulnmont4tlxoxrcootfm eai s;t trxo(rpoy4lltnlfvils a2ra(rpnu4tpxnmo3tatlm2eln s;u)teenif tydfpt au i t0 rtoxmpiu1ll nmieslsfs2rr(mono1altoif3tadls2el(mont4aexnmr tydla rlneo;s srxr(o io1ameelicta(fsDrrxr ;t4ape ioeilt aDuln s (0tlenio3iydomtrau s s)sexmirpiy1apeelnet () 2rrx  no4apeoifctadfm elnvs t0tlxrir iy1fmtr ieo;t0texmir3nu1lpe lfvi ()a2umx pno0apxnmfetld a ua(ms (4texoif tydlmD au s;t) 2trim3nu4lp   iciat)a2ur(ro;o4ale ii3iatlm em( onu0alxoxr oy1opte ieol()t2tmxr oo4apt lfvia( artmxrp;o1oee if3tldfm2emn s;u4trerxr3oa1op  au s t  rxmxo ou4op emfcsltfsDtmx pno4tptnioeiltfs2rmnmo t0tlxnircto1opteliesl(0 rtrio3no4apt  ncsls)srta(m ;o1teenmociadfaDraump t)arxoxoctotopDrln o t0 rtm(o3oudll   fvtl( aDtaxront4alx io3iydfs2el( o;u4tltrmocoa1lpte n o;t)setmio3ou1omt  netls aDtaxrp;t1aeeo f3iysfsDulums;u) etoxo oy1omD  ueslt)seuoim iu4al  lncsl(farrm(ronu4tpxoifctatfs rlnvp u0treomr tytlmDeaivsl()sruoir3iy4ol elivils)a2tru  ou0aexomf3ils m2ua(ms;t0 eeomr ootop r i s;t trumir no1ol  mnet t aDuaxronu1olx  oetas mDua( s ()aeeomocoadfp eaivo t  rto(rpoo4om nmiesat)sDua(  nu1teeomi3tydfa2ulu pnt4teenmr3tadlmtrluei ( srurir io1lp elivt () 2raur ou0ale  iciasls2ranvont0tltoxr iy1oatrli o;(0 etmxo3iu4omtn ncs (  rumu onu1oexn f3tadlm2emnvs ()tlxnmf3iadlaDe nvsls) etoio iy1altelfet s) Dumx pno4tltnifctltls2rm(vonu0teeomfcto1opD  ivil(0 2um(m3oydllte nvsl(f 2ua(mpnu4opxnioetysfa em(vo;u4treomr totoaDran sl() eurim3oudllenmivslt srtrx  oo1apxo o3tldfm2ean o;(4trxrmo tytoaDeai ilt0trurxmpiodapenmfcsl(  rta(m ;u0ale ioeiytlmDrl(mp ()tlxnif oadoa e u s s srtmiopio4open ivtls  rrmu  ;u4aex mieiysla2uanmp;u0alxoifcoadfmDeli s;( seum(o ny4lp  mnct sfs2urxmpot0aet iieilsfa2eln s u) leoxr3oatlmt auvs (  rum(o3oudoltemicilt  2tau poo4texoioctydfm uluvo (0trtoxo tadfmDelnvsls) rxoxm3no1aleelnetatfsDrax pot1aex ioctls m2ulumo () lxniocoydlm e ivo;( teum(r3oo1ll n nciat) 2umx oou1oeeoif3iytfa eau p t4tltoir io1lat an i t0 eto(r oy4aptemnciasfartax pno1openiieildfs ra( o u0aetriocoy1om elu o s0s2urxo3io4lm nmncs t arrrxmo;o1altnmfetlslm ua(vp (4 rxrxociy1fmDrlnvo;s0 rxrxopiy4ol  mnci t)aDumur ot1tet mietasfsDeanmpn(0 rxnxo3totoateaivsl(0t2uoxo3nu4lmenlfetat)srtmu pno0tle  i3ildlm el( o;t0 exrxfcoytop ranvi () rxm(opno1lmeelnvias sDrauronu0tex mictytls ul(vp (4texnmf3iy1fpDe ueo s0t2xoxr nu1am n ieia( srrmxro;t4oeen o3iasla umuvp;u) rtnxr iodomD aivi t sexr(o iy1op   ies s sDtrum ou0tle iictls s uauvp t)aeeriociotomD  iei;t0s2um(o3iudlltnlfvslsf Drax pou0optn ieiysla2ranvs;t4tleoircootfpt lu olt  2uoim oudop n net tfsDrr(rpoo4apto iciatfm emuvp u) exrio oydfmDe u slt)tetrxm iudll   fcsa( arur(rp;o1aetn oeiytlmDulnvo ()alxrmr io1lp eaivo t srumim3ny1aptelnesatf rumxrpno1oeeo fcildlm uluvpn(4arenxfcoo1lmt  n i t0t2urim3ou4open fei sfsDta( o;t4apxn o3iysls2eanmp t4 etnxf oydfptelnvi (0t2trirpoudlpt mnvsa(f rua(mooo0aex ifeiasfmDrl( p (0aetnircoo1fm  luvolt0t2tmxrpoo1amenmivs s) Dra( p;u0apx  f3tltfa2um(vp ()tetnir totomt  neo s0trtmxr nydlmee nvsls) Dta( oot0opx ifetadlm ua(vsn()treoxr3ty1optranvo t)s2trxr iy4altnmies s  rurxr ;t4teeoii3iytfm2ranms t4 etnmf tytlm rlues;t) rtoir io1ale mietl( sruaxmono4alt moeiadla eauvp u)tlxnxf3iodopDrlu ils0sruo(r3oy1altn ncia()a2umuro;t0ape mociyd m ul(ms (4 eerxr3iytfpt  neo s0 etr(m iudolenmfetlt srurur no1tpxomf3iyslm2umump;(4 ltrir oo1omtelneols t2umio iu4lpe lfviasfartrxmont0apxnmfeiydfa ea(mpnu)trxomrcoa1optelieolt texrxr oy4aptnliei ()srtmu  no1teenmietlslm2uau pn(4 rxrircoo1fpDr u il()seurxm3io1aptelfesl(fsDumxroot4olxn o3iytlmDeaums;t)treoxr ia1faDean i s)sexmxr oodlm  mnciasfsrrmur ot1oeeomoetysfa2el( s;t4trxrxr todoaDr i o;t)srtmxm oydam emfvt (f ruaum oo0tlt  ieiatlaDeau snu0trermr3io1lp eaieolt0t2xm(m io4olenmnct tfsruaurp;o0tet mo3tyd s rauvo;(4 renmo oytomDelneils)t2tm(m oodllt mfcs (  rumumo;u4ope ifeiasfs ul(mo u)teeoxr iytfmteln o s0 rxmir nydlpeelnetl(fa2ta(  no0tltn i3ilt aDrl(vsn(0 rxoio iodfm   n ils0 2xoio3oy1ape lnciat)srraum nu4oet ifcildfs2eluvo t0aexomf3iy1fat  ivsls  rurir nydap  mnet s)arua( p;o0tpxnmicildfs emuvp t0aeeoio oydopt aiei;t s2trim3oudoptnlfet t  2ur( ono1tptnioetatfmDrlumo;(0 leomr totlat  n s;t0 etoxrpnudoltnmfctat) 2ta( pnu0tetoii3iadlaDulnvon(4 rxoifcta1fmDelnvs s seumir3nydll e iesasfartaumpou0apen i3iysla2rlnmont0arerxr totopDelu s;s)trtoio iy1llenmiesls sDuaxmpot0open fctasfmDumnmo t0 renxf todfatrlu o;t  eurimpiy1altemnvt t) rurx pnu4oee  ociad s rau o u) ltriocoo1fa   uesls  rxmxopoydal n fcs s)arta(  no0tpt  fciydlm umu p;t4aeerio3iatlaDe ieils  ruoiopou1lmtnmivi t)s2urx onu1tpto i3iltfs em(vont) rxoif iydoaDe nes (0 exrir ou1altnmiciltfaDrrxrooo0aexniietldfs2eluvp (4trenxo3tydoaD aivil(0s2to(rpny4am e fvtl() Dtr(rp;u4aeeomf3ild mDrl(monu) ltoxo3oydfp rai s;t0srtmxm ou4omtn ivil()aruax ooo1tle iieildfa2el(ms u0trxomo3to1fm eau ol() exoxo3iudopenmnvta()aDtmu pot1tee ioeias m2ea(mpnu0 exrxf ta1opt li o s0 2tmio iydolt lieta(  rurxm nu0tlx  fciad a2eauvont) lerircoa1fp r nvi;s0teur(opoo4lme  ivtat)a2ur(mooo0tex  ociadfaDea(ms;u4aetomfciydfmDrliei;s0 ruoir oodap  mieta()artrx o;u0tex mi3ilslm uanmo;()tleoxf3oa1lmte neo t) euoio nu4amtn fet sf Dtr(moot1ape mfciyt mDrluvonu4 rxomr3tadfaDelieil(0srurirpoo1alte fctlt)s2tmx  ou4alxo oeilt a2rmn o;(0 etnif3ty1oatrau o;( texrio iu4omtn ictls a2urxmono0tee  o3iytls2um(mo;(0aetrio iatlmteaues s teto(o ou1altemiei ( sDtaum ;o0aeeo o3tadls2rlumo t4 ltrif3ty1lmt aueols0 rxrir3io4ol  lfci ()srua(r ot4teen icias s ulnvo;u4 eerxf oatfmt  ivo s) rxmxm oydlpt  ietas)arur(rpoo4tlx ifetysls2uau pnu0alermo3ootfa  lueo;()s2uoxm3iydlp emfeils  Durur nu4tpeo fcild aDulumon(0aetrxr io1oa r ueo;(0s2umim3iodlpenliviasf 2umxmoou1tpxomictlslm uauvo;(0 rtrifctatfmDeanvs t srum(o3oodameemncta(f ruaxrp;u0oexnmictldfs ua(ms t0teeoxoctydfaD li slt0 rxmxm3nodlmte iet t sDrax onu0opxnif3iydlm2ua(von(4artoir tatfp raivs () 2xr(r ou1lm emfvs s aDra( ono4opxnioetat mDel( o;t0tlxrxfcio1om eanvi t  exmim iu1ol  livs t)a2trur ou0opeomoeiys sDuaump;u0texoxo3ty1fm e nes;t)s2toxrpio4al nlicias arua(mo;t4apxo fetysfs2eln o u0 ltnir3oatoaD  i o;t0 2xrio3iy1ome mfcil()sDrrx o;o0oee ifetad m2uanmpnt) ltnmo3tytla   i o s0tetrio oodomeelnesls)srrr(mpnu0olx ifeiydls rm(vo;() lxoio oodop  aueol()teuriopnu1oltnlfvi s a2rrx  ou1tpe  o3ilt m2ra(mpnt0alenxrciydlaDeli ilt t2ur(mpno4al  lfctat  rrm(mpoo4tex iiciatfm rln ont4 exrmr3iydomt lies s0sexmxo3oo1ol  lfvt ( artax  ou1opxo f3iat a2uanvs;u)trxriocoodfp e uvo;t  2triopnydal elfcslt arurx poo0tptn iciad m2rluvo u4aetrmo iodomte neols) 2trxr oy1openlnctlt  2urum ;o0oeeoifcild m emnvsnu0 exrmr ootlpDrlu o (0texr(m3nodoptelfctat) 2urxro;t0apto ictytlm ul( s;(4aetrxo3tytfpDeau i s0 exm(r iy4altemicsa()sDtmxr ;t0tpxnii3iadla uanms (0alxnif iodfp  auvo t) eumxm iu4llt mnes tfsDururont1altnioeiytfm eln o ()alerxo3iadoaDe u ilt) ruo(o3no4omt mict ( sDrrum no1tlt mfeildfaDemumont4tltnmfcoytom e ieo (0 exrxm iydlmeelivt sfsrtrurpno4olxnmi3ilsfsDrln onu0aeeoir oydlptraiei s0sexoxm3iu4lm   ics sf 2rm(m ou1olx  f3iydla ran on()tetoxfcoodla  an ol() eum(rpno1aptemfcta( s2raur nt1ope mo3tyd aDel( o;t4aeenif3io1laD  nvi ( setr(rpny1altnlfviat  rumump;u0tlxniietadlm eln p;(0tlenmrcia1fpt ai il()t2xoxo oy1ol   ivta( sDtm(rono4tpt  fctatlsDumnvs;t)aeenmrcoodfpD  uvo t)t2xo(m3oudale  fetlt)s2tm(m ot0oexnmi3tldla emu s;t) rtnif totop eauvsl()srtmxr3iy1ome lnetas  Drm(r ;o0aet mictasla ua( sn(4alxnmrcoo1lm eaivs;s0texoxr oy4llen ieia()sDrr( o;u1apx mo3ias a rl(mo;u0trtoxociydoaDe uei;( teurio ou1alte neia(f 2tm(monu4tpx iieils aDrlnvon() ltnmo oydlp  lu ols  2umxo io1ap  mfcta(fa2rrurpno4oex ifctls s eln p;(0alxrmo tadfat auvsls) exmio oo1alenmneils arraxm nu0ole mociltfa2elu p;u0tltrir oytfmt an sl(0seurxrpnodop nmivs t a2tm( oot0opxn ieildfa rmumo t4arerirciodoaDe i slt) 2xmxopnu4lm   nctlt)srtrxmooo0tlxomf3tltla2umnvpnt) ltnir tytfat lies;t) rtoxm3iu1lltelicilt) rrrxrp;u0oeen ictadlm ul( onu)arenio3totlpDeaivi;s  2ur(mpnudameemici s) rtmump;t0tpenmo3iasls rmn s;(0altrir3ta1lp ran s;(0t2uoimpnudoltemfvia(f Drau ono4alxnmietyt aDrmumpnt0arxrifcio1laDr n o;(0t2toio3io1apt  fcsl()s2uaur no4altnifeils s eau s t0trtoiocoa1fmDe uei;t s2urim3nu4aptnmnesa(f rra(m ou4tleo ocilsla rm( snu)teenxo tydop rluei;s)trurxm3oydamtelnviatf 2rru  ;t0aetn ieiasfm2eaumo t) rtrxo oytlateauvs;(0srxo(o io4ol nmfct t)s2ta(ro;o0apxnifetat a2rlnvp (4 reoxo iy1om  auvols trtoxo oudale livt tf 2ua(mpno4aetn i3iytla2ranvs;(4 exoiociy1fatean olt sruoxm io1lmtemiesltf Dtmxrpoo0aexomoeiadlmDuau s u0 exrif oo1fa e i o (0 2tmim io4omenlfes (f rrm(  ot0apxo icild mDemuvs (4 rxoxo3oatfpDeai i;s0sexoio3iodol emfvs t sDuaum nt4opxomoeiytfm ua(mo u0 etoif ia1fptraueo s0srxrxo oydape lneilt aDua(mono4tpxnmietysfm2rau o u4tlenmfcta1lmD au s t setoim3iu4ome  fviasf rtrx  ot0tpxoifciadlm2ulu o;(0 renmr3iadfpt an i;( s2ur(opny1ame  ncs tfaDtaxr ;t1alx if3ilt sDra(vonu4 ltoifctytoat luvo t0 rumimpnodlm emics tfa2rruront0tltomi3ilsfmDulnmonu0artnmf oytopDrluvols) 2xoxo3iy4omeeliei t)a2ur( pot4ope mociasfa2rmuvsnu)tetnir iatfm   ies;t) 2um(m nydap elies ( srurx o;t1alx  oeiatfs umumo;(4 rerxr ootoa raieo s  exr(r oy4lmtemiesat srrmum no1aexnmf3tysfm ranmo;u4aexoircoa1lpt aiei s0sexrirpnu1ol nlfcs s  rrrxmp;o4teenmoctasfsDumnmo t)aexnmocoy1lpDe uvsls0t2urio oy1ol n ncia()aDrmxmpou0opt mi3iatfsDrauvo u0teermf oytoa rlues;s) eur(r oo1aleemnvtatf Dtmxr no1teen oeiatfm2umn o;u4tetrxr3ia1lat lueo s0srtoiopno1ll elfesat)arua(monu4tet mo3iasfm2rl(vp u4 renxrcta1faDe ivs;t)t2xm(m io4amenmfcil(f Durxrono0oeeo f3iadfs uau p u0alxrio3tytlptrluvsl(0trtoxo iodoleelnvi ()s2rauronu1apx  fetatfs2uan ont4alxoxo3iytfpte neo t0sexo(o iu4lm nlncs () Dtrumont1openifctas s rm(vo (4trtrif tatfp rai olt0trumxrpiy4al emncils sDtr( p;u0ope  fcildfs2ean p (4trenmf oy1fpte nvslt  ruoir3ou4lmtn icil(f 2tmu ont0tetnifeiat aDra(vo;() ltnxfctydoptrlueols srum(r3ou4lp e iet (fs2rau oou0opxnii3taslaDemn o u4 rxnif iadla  aivi;t t2trxrpny1om nlncilt)aDta( pno1tlxo fctydlm uln o;u4artnmf3tadfm e nvsl(0 euo(m nydolen fviat) rurumoot1tex ifctlsfmDum( snu0aeeoifcootoa  au i t0 2urio3io4al nmneil(  Dtrx o;t0tpen fctysla2uanmont4tltoxfcoatfaD aneo s) rxoirpoy4lm nlneslsfarraxrp;u4oexomociyt mDrmnmp u4 rxnxr3iadopDeaues t tetm(rpoo1am nlnctat  ruaxm ou4tpxoii3iydfmDua( p;t)arenxr3iytoa ran o;t0 rtoim3oy1aptn fcs (  rumu oou1olen icilslmDum(vo (4artomocoytoat  ueo;t0texrio3oo1optelneias) rtaxmoou4tptn fctldlaDeln o;(0aeerxfciy1lpD li o;t) rxmxr3iudamt lfvs tfa2tr(mo;t1alenif3tld a2ul(mo t) ltoxf3oodlmD au s;s) 2urimpiodale  nvil(  rurxm nt0alenmociltfm2emuvp;t4 rxnif3oydlat luvslt) etm(m3ou4apen icsls arrrx  ;u1optomo3tysls2rlnmp;t4 etomfctotlpt lneo;(0truoxo3iudapt lfvsl() Drm( onu1aetoiieiasfs elnmp () exnifctotoptrlnvo;( setoxo3iydol elnet t srtrumpoo1ole ii3iydfs ranvonu)tltnif3iytlmDeln i t  rxoxm iu4apenmietlt  Durx  nu0ape  ictldls2elums u)aeenxocia1fm  li ol( s2tmxr3ny4oltemivia()a2tmxmont0ale  fctls s2el(mo;u)tltrmr3oodfa eanvsls)s2toxo3ny4olt lictlsfarrr(rp;t4aeeo ietat sDrlnvsnu0trtoxocoodlmtrluesls texm(m3iy1amen nvtlt)arrr(mpnt4oeto fciytfa2umnmo;u4 lxoxr oatfa  lnei t teur(m oo4omeemfcsls)arumxmono0aptnif3tad a emnvpnu) lxoxr3ty1lp eli i t  etr(opou1apeelnvt s  rrmurpou0oeen f3ilslmDel(vo;t0artoircoa1fateau slt0t2toxo ou4amt  ncils arururpoo4tee  icildfm2em(vp t4arenmfcoatomteli i s0sexrir3nudamee fes () 2ua(mpno0opx  ietatfa2uluvs t0arxnmo3iotfpte ueil(0teurxo3oydop nmfvsl(fs2rm( o;o4oexn f3iysls ranvpn() eeoxf3iadlm e ivo;(0srtrim iy4lmte ivilt)srrm(mo;o0alt mi3iyd sDulumo (0altnircootlpD  ivo t trumiopnu4lleelici t s2uru o;o4olx ifciydfmDrmu s;t0 renifcoytfp r ieil()setr(o3io1am emies s)aDur(moou4oexnmociatlsDrl(vpnu)artoir3iytop r ues t0 rxr(o oo4omte ictl( sDur(m oo0aex  ietas sDelu ont4 rerircoadom e n o s)tetmim ou1lm nmncias srtm( oot0aee  oetas mDeanmp;t0tetnxf3tytlpt anvi t)t2tmxr3oydll  micsat)aDurur nu0ope if3ild a2umu p;u0teeoirciydomDran i s0trurxo3ny4amtn fvs s) rtmu onu4apenioctytls2eanvpn(0 lxomfciy1fp eln ils) etoirpny4om  lfvias) 2ua(mpou1alx  oeiyd a rau onu0 rtrmfctadfaDran i s trxoirpno4alenmfvilt aDtax onu0tetnioeiytfs2ran p u4tltnmociotfaDr neslt)trtm(o3iudaleemfetas)a2uax p;t1alto o3tatla2uln on()texoiocio1fmDraueo s srtrimpno1lmtn fet s)srum( pou1apen ociysfa ea(msn()trtnmf oytlaDe ieo;( teumiopoy4apt mnesa(f Dur(rpoo1optnmf3iatla el(mo t)trxnif ty1opD  neilt0seumirpnodamenmivs ()sDuaxr ;o4apxn o3iyt a rmuvs;()teeomr oatfa r i o t0 eto(o3ou1apen fesas  Dtm(mooo1ape mociyt sDeaump t4trxnxf ty1lmtran s s  rurxr oo1omeemnesas  Dtru  ou0openio3tasfa2el(vs;t0trxnmf oytoatraieo t trxmxm3iu1om  mfvs tfs2tmumpot1tlt mi3iyslm rmn o;t0artrif totfmt lu o;t srxrirpoudoltemnct (  Drruroou1open oeiat a ul(vs t)arxnio3ta1fpDeai ils0t2um(m3ny1apt lfvt s)sDtmuronu0tpxoifetld m ran o;(0aexoxo tydlmDraueilt sexm(rpnu1apt  nct t aDum( pno4tex io3iydla2ua(mo (0aexnio ootopDrli i t srto(m oydal   fvtls) 2rrxrpot1opeoiocias m eauvonu) leomr3iydlm r ivslt  rxrirpiy1llen nci ()srtmu ooo4teenio3iyt m2uluvp t0trxnmr tydlpte uvi (0 rumxmpoodom elivtl( arrmxm ot0aptniietytls2emnvsnu4 eeoxrctodfate nvs;s)setrxm ou1opte ncsa(  rumxrpnt4ale iicilsfm rmnmo t0tlenif ty1lpDeanvolt0 2um(r oy4lptn nvtatfs2trxro;t4aptnmf3tydls uanvp;()trxnxf3iadomDrlneslt)seurirpou4lm n icslt sruau pnt0tlx  f3tytfm2em( pnu0 exrifctotomD an s;s0teuoirpoudal nlfetatf rtmumpnt1apen o3iytlm2rluvs t0 eerxrciodlpD  ivi;t  2xo(o3ou4om e netas s2tm(m nt4apxo o3iadfmDrl( sn(0arenmo oadlaDr nvols teumxo ny4om emfviasfsDumur oo1alxniociydlm ul(vo;u)tltoir3iotla eln s;( srxrxopoo1lpeemfei t artmxm ot1oltniiciysls eanms;(0trtrio3ia1lptr nei;t0 rtmxo iodlle  feils)srtm(m ;o4oet mo3ilsfsDranvp ()tlxoio3ia1opteai i;t0texoxm oo1lltn nvslt sDur(ro;t0olxomo3tadla em(vs;t0tlxoir iodopDr nvi t0srtrim3oy1ape  nvsltfsDtau  nt0tpx mo3tydfa uanmp ()trtnxf3ootlmDe uvs t0s2tmxo nydoltemnctl()aDum(mp;t0tlto fcilslmDuluvo ()trxrio3todlmDean s;(0 rtrxrpiodom n fvtl( a2taxroou4apxn octlslm uln pnt4arerio3iodfatrlnei s)sruo(m iydol e fvs ( sDtmx  nu0tpt if3tltla2elumpnt4texomocto1lmD aieils0seto(opiodapeemfctas)sDum(rpou1oeeoioeiatlaDemnmp;u4trxnifcoy1lmDrauesl(0setoio ny1lmtnmicsas) Dur(mo;t4tpxnii3tydlmDumuvo;t0teeoxr ta1omt livsl() ruoxopiy1lpee nesl()s2um(mono1open oeiys m rmnvp;()trtomfciadfmDe uvo t0 rtrir3ny1ol n ncsa(fs2umu  no1tleo o3tydlm rmu s;()trtoxrciytoa eaivi;t  exmir io4lmtemfvta( aDtax o;u4tlxoio3tltfsDelu p t4trerir tadoat  i o;t)s2uoio3ou1altelfeil() 2um(r ot4oetnioctydfaDuluvs (4 renxrciy1lp  auesl(0setoxopoy1open nvsatf rrrx  ou0tltomi3iltlmDra(vo;u4aetniociatoate ivo;()srxrio3oy4ll nmncil()srurx o;o0optomo3ildfa2ran p u0alxrmo3iodlpDrli il(  rxm(r3io4lm  mfcsasf 2rrxmoot4tlen feiaslaDumumont0treoifctytlmD  ueol() rtmxm no1lm n icta(  2urxrpnu0texomoctlsfaDeau o () etrifctytfp rai s s) rxoxr3nydllte ivsas  2rru pnt1tltoioeiad aDra(vonu4aeeoir3iytlaDelies t)s2xrxm oy1lltn fvi ( srraur oo1oexoifeild s umnmp;t0areomo3iotomtr uvols)t2tmxr ny4lpt  ivtls)srraxro;u4tptomf3iasla um(msnu)texrifctatfa   ueo;s teur(m iodamen ict t srtr(r ;o0tleo fcildfm elums (0tltoio oytfp eaneils0srxo(r no1ame  ivt (fartauront1tlt  iciad a ua(msnu)arxoxr3to1lpD aues ( seurio iy1olee nvsa()arta( pno4oeeoifeils sDea(vo;t0 rtomf iytoa e n sls0 2xrxr3no1op nlncia() Drruro;u0alx moctldfm elnmsnt4texrif3oa1fm  ai o s)setoimpio4omen ncils  Drmx pnt1tptnmoeilslaDeau s;() exomociytfpt  u i ()sexr(rpiy1amt mivs tfs2rrxr ;u1teen octydfa emn o;() rermociatlatelnvol()teuo(m3iudlmtelnesls s2tax oou0oexo i3tatls2ra(vo;(0texomocoytlat aueo;t  eum(rpny1ol nlfei s srrrxr nu4teeomietyslaDumums u) rtnir iatoa rlnei s)s2xm(mpnydlm  lieil()srtau p;o1teenmo3ild sDra(mp (0aexniocoodfa eauvi s)srxmxm oydomeelfcs t aDtrxr nt4aexnioeiyslmDumnmo ()tetrmr iodoaDeaneil( srtm(mpoodlm emieiasf Drrxrooo1aee mi3ildlmDumn o t0tetnxrciadlaDeai s;s)trumir ou1lp elivs s arrrxmo;u0altnmiciyslmDemn p;(0 etnmr oo1fm rlieo;t0s2xmxm3oo4opt  ncs t)arra(r ;t0aex iiciad m em(vpnu0 etnirciytla eluvilt)t2uoxm nudlpenmncsl( srraxrp;u4oleoioeilsls rlnmo;u0 exrir ia1oaDrluvo t0s2xrxm ou4oleelneia(  2uau ono4tpxn ictyd s2emnmo u4trxomf3todoptrlnes ()trtrir3oo1lm  mnvs t  rrax o;t1tle miciyt m rmnvo t0trermo3oy1op elnes;s setoxopnodlp nmfeta(f 2umumoou0tpenio3iyt a2umuvp;()teermf3ta1lpDelnvo (  ruoim io4alee fvsl(f rtm(  oo4tlx moeilsfaDemnvs (0 rxnxr ty1fm rln ol(0 exm(o3oy1lptemietlt)s2ra(roou0opxnmi3iyslm uanmsnu4altoxr iodopt lu s;s)trumxrpnu4ll e nvtlsfs2trxr ;t4tpe io3ildla2emu p u0 etrmf3iy1oaD  u il() eum(m3iydame lneiat) rrmxmoot0optomfctys mDem(vs u0aetrxocoy1omtelivo;( truoim oydap e ivilt)s2ua(  ou1teeoio3taslaDem(ms;t0aeerxfcoa1opteanes;( teuriopoudalt  icsa( s2tmur no4tltoioeildlaDemu p u0altoif3to1laDeli sl()t2xrir3nudoltnmfcs sf Duau ooo4olxo fctyt mDrm( sn(4tlxoif iydfmDeaues t0seuoxmpoy1opte fcia( aDurx ooo4texniiciadlm2umnmp;()aeeoifctydfp e nes;t  2tmir no4ol n ivil(fsruau onu1oex  oeiatfm ua( pn()altoxo3ootoaDe uvsl(0seuo(o3nydll  lfct ()aDraur ;o0aetnifciytfmDuluvo;t4 lerxr oo1fpteai ol(0s2urxo iy1amenmicsas  rtaurp;t1oee  ictyt sDel(vp u) rtnif3oadom rlivols srtm(r oo4ll nmfvtat) 2tmxr nu4aee iociyt aDea( o t0 etnircoadfmt ln ilt0 eur(rpno4optn icsasf Dtr(  ou4ale  ieiyt a ea( pnu)trenxr oytlaD  i o t0 etoxmpny1optnliesa(faruax  ot4olxoiociadfm2rm( o () ltrxf oydom   iei;( trtm(opnudope mfcils)srum(r nt1tee mieiasfmDrlums ()tlxrmf ootoa rai olt  exrxo ou4olt lnvs s)sDrax oou1tee moeiad aDuln o () lenmo iodla raues;t)s2xrim ny1omeelfvt t srtax  ou4openiietadla ra( ont4trenifcoytlpD ai slt srurimpou4openlneil(fs2urum oo1teeomietytlm ua(mp;t4tlxrxr3oydlpteln i;t0srxmxmpno1lp   ieiasfsrraum ;t4ope ifeiaslm2elnmon() rtoxf to1lmteaues;s0texrir oydal nlivsa() Draumooo4tpen iciadls eln s;u4treomo3iy1fp e ues s) 2xoxrpiu1lpt  netas) 2ua(mp;t0aexo feilt sDem(von() rxnxfcto1fmDe ies;s) rxoxopiu1ole  ieil() rtru  ;t0olxomf3ildla2uluvpnu0areomrcto1opDrlnes;t)teumxopny4amt mneiat  2rmu pot4oexnifctld a2rlumo;t)tlxrmo3oodfa r iei;(  rxo(o3nudamt  ncias) Dumum oo1aeeomoetat m umuvs;() rtoir3oytfatrlivs t texrxo iodole livta(f rraum ou4tlx  octatlaDra(vo;u0areomfciydopDelnvo t0s2tm(r no1ol  lnvslt s2uaumont4oex moetytfs2uan p;t0arxoio ootfa  luvsls)s2uo(m3no4olt micsls  Duau pnt4tlxniietyt m2rluvp t)trenxo3io1latrai ols0srtrxmpiy1llee feiatfa2ua(rp;u0olxoif3tyt aDul(vsnt)teermrctotfpt lnvi s0 rto(r ny1ale liesls a2tm(m ot4aexo f3ilsfa umu s;(0treomocoy1lmte u ils0 rtmxrpny4lptn neiat srrrumo;t1apenmo3iysfs2uau p t4tlxoxf3tydlaD  uvi;s)t2xm(mpio1om e ivs tfa2tmu  oo0tetomicild s emuvo t4 reoifciodfp rli ilt0 rum(r iudlptelivils)artau ooo0opxoioeilsla em(ms;(0alxoir io1oat  uvs;t setm(o ou4opeemfct ( srraxmoot4optn fciydls emnvs () eenif3iadlm   uvs;t texoxm ou1aptnliciatfsrtrxr ou0alxn ictyslmDulump t0teeoxf ty1lptr ies;s0s2urxr oo4lleelnvsat srtrurpnu4oeeomiciat mDea(vp t)artoif3tadfmteau ols0seurim3oodlltn nesls) rtmxm ;t0tlx  ietadlm el(vo;u)aexoxf3iadfm e i o;s)srxoxm3ny1op   fesltfarrr(r ;o1apeoiociytla rau p;u) ltnmr3iadla eaies t  2umir3oy1ap emictltf 2ta(mo;o0ope mociytfs2em(vp;t0aeermf3io1oa elu ils0s2tmir ny4apeemivtlsfa2ur(mont0tpe mieiyslm2umn snu)texnmfcoydoateanvi ()teurxm ny1lptelfctlsfa2rm( p;o4oexnioeilsfmDea(vp;u0 exrxfcoytlp e u o t0t2urim3ny4alenmnvtl()srrm(rpou0olenmieils aDuln s;t4teeoio3iytlmD lnvi ()s2xr(r3iy4olen fciasfa2raumpou0aet  f3tad a2eauvo;(0tltnmr3oydomDe neo (0setmxm no1op emncsl()aDrrumpnt1oltomoeiyt mDranvo t4tetrxrcoo1lpDeaueolt0teurxo ou4opt mnvi t)aruaxm ot0aetomfeias mDel(vs ()artrmf3tydfa r nvslt)srxrxopno1ame mivil(farrrum nu1tpxn oeilsla2uau s;u)trerxo iy1fmtean s s  2um(opnydamtnlnctls  rrm(r oo4oeenioetytlm rl(vs;u)arxrxr3oy1fmtrai sl()texoxm3ou1omtnmnvtas) rtru ono1ole if3tadfmDum(vo;t)tetomocto1fmt lieo ( srurio3iydaptelfct (  rtaump;t4oltomictas sDem( pnu0trxrxo3oy1opDeaieil() ruoxm3iu4ol nlfcsls)arrr(rp;t1alt iociydfm ulnmo;(4 rtrmociotfaDrlieo;t) 2tmxmpnudlp  lnesls sDrmu oou1tptomfcias s emnvont4 lxoiociadomteai o;s)trtmxm3no4opeelfct s)s2trxroot4tetn feiydfa rmnmp u0texrxo3iadfp rlnei (0 rto(r io4al  mivi tf rra(mpou0ape  ocild mDul(ms t0alermo ia1lpDraieolt)trurxopoudamen ivslt sDuau o;t4oexnmoctasfs uan o (4altrmfcta1fptrai i t0srxoir io1olen fvias  Dtmx pou0aet  oetlt s2el(mp;t4alxrio oytoatrlnes t0 exrir no4ame mnciatfa2trurp;t4aptnmi3ias a2rl(vo (4 rerxrciotomD ai olt0trxo(opoy1ol nlieias  2taxrpnt4oltn fctytfs em(vs;(0 etoxr3iotoaDe iei s) rurxm3oo4am elnctas aDumxr nu1aex if3tat aDumnmo;(0tlerxf3oodlaD livo;t sexoim no1am emneias a2umump;u4aex mi3ild s emn p t0 ltoxr tatoaDrluvo;s) rumio ou1aptnmietl()s2rau oou0aet  fetlsfm elnvo t)tetomf3oodfpD livi s0 etrxmpnu1ll e fvilsfarumx  ;o0teeomoeiadlm2ulnvo;(0arxrmr oo1fateai o;()srurxr3oy4lp emfciatf rrru oot4tpenmoeiat aDrau p;u) rtoio oatfa r nvo t teum(rpiudoptnmfvsas) rumx  ou4apxomfciytfs2eanvs;u4 rtrmfciodomD ln s;t  rtoio3iu4ape  fct t  rrm(r nt1tlx  fciatlsDrmnvo t0tlxomrctadom  ai o;t trur(r oy1lpt lfet s) rrm(mooo1opt io3iydfaDeluvs;u0arerxocto1fa elieilt0srtr(o3io4omt lfct t)srtm( ont1tlx  i3iat m rauvsnu0tltnmf ty1lm eauei;s0sexmir no4am elivslt) Drrump;u1alto iciyt s elumon(0 lenirctotfmteln s;s  2xr(r oy4om   ncsa(fa2tau  ou1texo ociyt a uln p;(0treoxf3oo1laDrauei t0s2urxo3nudomt mfvil() 2urx pnt0tleomf3tysfs rmu o;u0 rxrio oadoa   iei t)trtm(rpny4apenmieta(faDur(mo;t4aptnio3iydls2uanvsnu)texrxf oa1laD  nvi t)t2uoirpoo4am nlfvtas  rrrumonu1tleomi3iydls2emums;t)tetrmf3totfpt au o;s)trumxo iydllte ncil(fsDtax o;t4tle  fciltfm2rmums;(4 ltrxr iytfpt livs;(0 exo(r3iy1opt lfvsas sDum(rp;t1olen i3tasls rlumo t0trxomo3tytlm r nvi s sexoxm no4lmt mfvs ( a2umx ooo0oeeniietld aDeln p;()artrxrciadfa  luvi;t setrirpoudapt mfciat s2ra(m nu0oee iociadfm uln pnt4aexnifciytlateau i;(0srtoxrpny4llenlfeslsf Dumx  oo0apenmo3iysfm rlnvo;u4tleoif3tatlate uvi;s)s2xoxopny4lp elfvil(f rur( ont4open feils aDumuvon(4aexrio iadomt ln ols0t2xrxopno4alt  nctat)sDumxro;t1tlxn i3iytlmDeaumo;(0 rtomf3iatopDe i i;t0 ruo(r3oo4ol elncsat)artrxrooo4aexnmo3iad m umump;t0tlxnxf3iytfp e u o;t  rxr(o3oy1ll  lncsatf Dra(mono4tleomoeilslm2eanvo;(4tlxnxr3io1oaD anvol()texr(o nu1opt mncsls)sDuau  ;o4apxnio3ilt mDulnmsn(4 eeoxr3iatfm ran o s  rtmxr ny4olen ivt t  Dtmxmoot4openiocils s umuvp t0 ltnmf ia1oaDrlivil( seurxm3no4ll elieiltf rrax ooo4tpxnifeilslaDumu p;(4 lxoif3tatom  aivolt sexm(r3iudom   feta( s2trxro;o0opeomociadfm em( s t) eenir oy1laDraies t srtrim3iu4lp nmncsl(fsDraum ou0oeto octad sDemuvpnu0artomo io1fmDe ivo;(0srtm(opnu1aptnlictlsfsrraxmooo4tlt ifetyd sDeaump;u4trxoxfctydfate n s;(0 2tm(o iy4amenmfviat)a2ra( poo0tpenmfeiyslm raumo;t0tlxomr ty1fatelnvs s)trtoxrpiydaltn icia(f Dtmxr ot0ale moetyt s2um(vo;(0 ltoirciodoptr nvi;( truoim oo4om  lfvia()sDtaurp;o1ope mi3tas a2umn o t)texrxr ty1lmt ai o t)srtrirpiu4op emfesa(  rta(ronu1alx  ieiytla2elumsnu0alenxociytoa r i o;t0trur(m nu4al nlfcsls  Dtau  ;t0altnif3iytfaDemuvo (4tlxoir3oytlm  auei;s)setoio nodalenmivs t arur(r ou4alx  fetad a2ran onu)treomo todop rlnes;(0 etrxr3ny1om  lnctls)aDuax  ;u4altnifetltfa2ulu snt0 eerir3iy1fa e nes;s0 2uoxrpiudome mivia( s2trxro;o0alt moetatfa eau snt0texomr3ia1oaDrlu slt0sexmimpnydamtn fcsas  Dur( ooo4ole io3iatfs umn s;u0aeenmfciy1oatranei;(0 rxoxm3iu4ap  mietlt)artmu  nu1aptn f3tyt s rmnmo t)trtrmf3ty1fpDr nvols)seumiopoy1lm nlfvsat)aDrm(mo;u0tltnmiciyd m2el( s;()tlxrxf iatfaDraivs;( seum(o nu1omte iesl() 2rru  ;t0oet  o3tyt m eanmp u4 etrio tadomDeau ol(0truo(r3oudam elnvsls) rrrx oou4oeeomf3iatls rauvpnt0tltnif ia1om rliei s0 exriopoydom emfct (  2uaum ;o1tptomfeildfs eluvpnt)tetrifcoadfate neo t) etoir3no1ape lfctl( aDtrxmpoo0tleniociad a2uanmo;t)trtomo tydfmt  uvslt)srxmxrpnodlme mfei t sDrmump;t0tleoifciatlaDea(vpn(0aeeoiocoodoatraneo s s2xmir3ou1omeelfvi t  rumxroot4alxn ieiasfaDra(vo u0alxomfcoa1lmDe uvi;(0 rtoxm3oy1lm emiet (faruax oou4aleoii3tldls2eluvpnu4 lxnirciytfmte ueil( setmxrpoo4ome lfesls)artmumpoo4aeeniieiydlaDuln sn(0trtnmocia1lm  auvi;t) etmxopiy4lmee fei t artrxrp;t0tpx  ociasfm2uanmp (0 lxrmo3iy1la  anes;t srxo(o no1ome lies (f 2rm(rp;u4oltn ietyt s2rmn s;u4 exoircoodfm raivol(0 exr(o iu4alt mfci s) Dtr(m ou1aeto ietadfa elump t4alenxr3oo1lm  ai s;s0teumir oudamtelncilt)sDtrxmpoo0olt  o3ildlm ul( snt) lxnxo ta1fmt  nes t)tetoxm3io4llenmfvtl(  2ur(  ;o1tleo octasls elnvo t4aleomf oatfa rlueo;t  eto(o3no4al nmnviat) rtmxrooo1tptnmf3tyd sDrlnmont4 lenmociy1lmDeaneo s trxr(r oo4amtn fciat  Drr(m nu4oltoifctad m2rmu snt4 lxnmo iotlmDe nes t trxo(m no4lmeelfvi ()srrr(rpoo0tleoii3ild a eanvon(0trermo oydfm  liei ( sexmxr3iudaptelnvi ()arrauro;u1aexniietlslmDea(vs;u) ltrxfcia1lmDr u i () 2trxm3ny4lle mfvil() Durxmonu1oeto ietls s em( p t)aetrxrcty1optrli o t)s2xoio iodolt  nvtl( s2tm( o;o4tpenmo3ilslaDumuvp t)tltomr3tydfmt anvs;s0 ruoxopno4lm e nesls aDua(rp;o4aetomi3tyslm rlnmo u) lenxfcoytfaD aneol()seuo(mpiodlp  mivs t aDta(rpnt0aptoiieiytfm2rm(vpnu)alermfciy1opDr u i t  2trir oo4am  mivia(  Duaxmpnt0opt iociyd s eaumpn()alerxo3oatop rlieol() 2trxopiy1op  mnetl(f rrax  ;t4apxn o3iatfa2ea(ms;u0trerirciytfpD aneols0setrxr3iy1oltn feta( sDtrxronu0aeto oetat a el(vsn(0alenxr3oy1oaDrai sl(  2um(m3iu4lpt lnvias)artmu pnt4ope ifetadfs2eluvpnt0aetrir3ia1opte u i;() 2umxmpnydlm e fctlsf 2uau  ot1tpxnii3tys s2emnvo;(0aleoio oa1oa  ln ols)trumxrpoydome  fctas  Dta(  no4aeeoioctltfm2rm(mo u4 rtnmrciytomDe neo s0s2um(m3oudol nlieta( s2tmumono4alt mf3iytfaDeln p (4 lxrif oa1lmt  ivs t0 rurio3nodll  mfei sfaDumxr nt4alxnmoeiatfm ulnvo;t) leoio oodfpte i i () eurxr iu4open fetasfaDrr( pou1altoiieiydfsDrlnms t4aetrioctytlaDr i i t0srxoxr3iu1lpenlfvt sf rumx pnu4tetnmieias s2ea(vs ()aexoif oo1lpD aies s  etoio3nudol elfeias)sDraxmoot4tltnmo3iatls2rm(mp;(4 reoif oy1oa eau i t0 etrim iy4lpte ncta(f Drrxro;u0tltn i3tltlm eauvo (0arenmf ootlptean s;(0 2toimpnu4lptelnei s s2um( poo4tetnmf3tas m2emumo ()tetnxf iadlatraneo ()t2urio3io4llenmnvsl( arrm( o;u4aexn f3tytlaDelums u4 rxrmociadopDraivi (0setr(o3ou1ol emnet (f rtaum ;u1aetomi3ild mDrau p t)alerxrcia1lptelivs;s0 2xrim3no1am   fcs tfs2trur ;o4oleo oetadfs ranvs u)artnxf3ty1lp  lues t0t2tmio3iodlp  lfeil( arraxrp;t1oltoifctatfmDra(vo u0alxoif to1faD an ils)t2xrir3no1ale liviasfaruau o;t4opt mfciltlsDrlnms u4aleoircoatlp  ln slt) 2urim3oy4ap   ivtlsf 2tauro;t0oltnmfetld a2em( pn(4 exnifcta1om ranvs t) 2xrir3iy4olen ivi t) rur(mono4ape  o3tat aDua(vsn(0aexnxfcia1fptrlivo;s0t2xoxrpny4amt mnvtls)a2rau  ;t4aetnmietldls rln o;()trxomfcoa1laDrln i s)t2tm(opiy4lle  fctasf Dtrx  ;u0oetnii3tydfa umnvp u0 etnxfcoytfpDeaneolt0t2xrim3iodomte fvs (fsrtm(r ou0ole iieiatlmDuaumon()alxoifcoo1oatrluvs t s2toxmpou4omt  ies (f 2rr(rp;o4altnmo3iydlm eanmo;(4texnxfcio1fateaieslt) 2toirpoo4ome lfet s a2ra( o;u1tlt io3ildfm ra(vont0tltrmfcoydopDe n i (  2tm(m3iy1lpenmfvil( srrr(roou4tlxo ociatfaDem(vp (0teenir ta1lm  aieslt)trurxrpou1al   ivsls aDtmu onu1apx  feiatlsDemuvsn(4teenmo3tadoatr ieolt0 rtoxo oy4llt  fvi t arur(rono0tpt iociyd s2rlu pn()tlxomrciydlm   uei;()teum(o iydapeelnesls sDraxr ;o4aexn f3tlsfaDelnvo;u4alxnxr3iytopD  uei;s)sexoir oodapt  ivil(f Duaxmp;o4olx mi3iadfmDrmnvs t0 lerxo iydlateaivi;s0 rxrxmpnodopt lfvils)s2uax  ;o1ale if3ildls rluvpn(4arxomf tatfptr i olt)sexrxm3ny4ol nlfctls)a2tmxm oo1aet ioeilsls rauvs;(0alenioctodoa  liesls setmir iy4lpt  fesas s2rrump;u1oeenii3iydfm emnmpnu0altrxf oa1op raiei;s  2ur(mpou4aptnmicslt  Drrxm nt4alen f3iadfs2ran p;u0teenmr3iodfmDrau i;s0 2umxopnu1omee nesat  2tmxmpno4alx mietlsfs emn p;(4teeoxrciadfaDeanvsl(  2tr(m oodamtnlfvt s aDtru p;t0tpenmiciyd m el( snu0 etnxo iotfpDr i o;t0 ruo(o3oudomt mfei s) 2urumpot0optnmi3iyslsDemu o;t0alxrif oatoaDelneslt  2xm(m ny4oltnmnes (  rtaxro;t4tet mi3iadlaDelums u) ltnmrctydfmtr u s t  2to(opoy4lmt  nesat) Dtr( oou1opxnmfetyt sDemn p u4alxomociotoa  livi;t t2umir io4om n ncsas)sDrrx o;o0tlenifctlsfa2elums;u)trtoxr oodoa  li sl()seuoir3iy4opt lfctlt)a2tmu p;t0tetn feiatfaDem(mp;t) eeniocoodopDe u olt trxoirpoydapen nvil() rurx  ;t1optniieiadfmDua(ms t0teenmf oatoaD  i s s trumirpnodlmee nvtls)aDtmumo;u4oetn o3iydfsDulnvp t4 reoio3todfat luvols s2xm(rpou1opt mnctl( a2rm(rp;t0oeenioeildfmDuan ont)artoifctodoatrliei;() etoim oy4llt  ncsas)sDtmx ooo0tleo ieiatfm2ea(ms t0alenxocta1laDrlueilt0 eum(m iu4apeelici () Drauroou1optnmi3iatlm2eau s;() lxrif ootlpD luei t)s2xrim3ou1lm emnvi s sDrr(m oo0tpe io3iltlsDea( s () ltnxrcoa1lmteauvi;(  rto(r3nodlmeelncsl()a2rrur ot1tlxn i3iytla2em(vp t0 eermf3oatlmD  ivo s t2xr(o no1omtnmfvtl()s2tmu o;o4ape mfeiyd aDrlu s u0arenxo iatfp rlueo;t)s2tmirpou4altnmnet ( s2raxmp;t1texnmi3ilt s em( o t)aetnxr ta1fate i s s0 rxm(m3oo1opee fvsa(f Drmu ono1alt  feiyt s ra( p;t0 ltoio iytlpDranvo;( srtmxr3iy1opt  ivils srtr(m ot4altnii3tyslmDra(vo (4 lermrctydlmteli s;t setrxrpnodlmenlfetas a2rauro;o0opeoii3tyd a uanmp () renxrcoatfpt  n ols0s2uoxr ny4am nmivslt) 2ur(r nt0tltnmfcildfa eanvs;u)aetomr3oy1lpDrai sls0trxrxm ny1ale mics tfsrumu  ;u4aee iocildlaDeluvo u4 etnxf3ta1oaD lneo;s)s2uo(o oy4olt lnvtat) rurur ;t1ape mi3tys s2rm( p;(4alxrxr oadfat li i s0trumxopnodaptnlivilsf rumxr ou1openioetysfa el( on(0 etrmr3oatoatr neo;s) eurxm3iodlpeemncta()sDtrur ou0tlt ifeiatfs ran o;t)texoxrciadomtelueslt0srurir oy4lmtnlncil() 2uaxr nt4apt ii3iyslsDra(vonu)artrio oa1opDr i ilt tetrio ny4lpe lncs s  rrrurpou1oet  o3tasfaDumums;t0 rtrxocoodfmte u i;s0t2um(r nu1ome  ieilsfs2umxrooo0oex mi3iyt mDelnms;(0aexnir3iadlm r ueo s0 2um(rpio1omenmivta() ruauroot0alenifcilsfa2ea(vsn(4 rxnxf tydomDe ueolt)trumio oy1am   nvs s) rur(rp;u1tetn fctys a rlu p;t4 lxomo ia1lm rlieo;s)srtoxrpio4lmt mnct tfsrur( onu1ope mociatfs ua(mo;t)aeermf3ootfpD  ivs s)texr(rpoy4aptnlfet s  rur(m no4opto o3ildlmDrmumonu4texnio3iadom e uvi;t  exr(rpno1om emiet s artm(  ;u4aeeoii3ilt a2el(mp;(4 rtnxf ta1omD lnvs;s trxrirpnu1am  miesatf 2urur no0apen i3ildls2rlu on()aexoxf tatfmD  ivi;(0setoiopny4altnliet (fs2urxm ;o0aetomociytfaDul(vo;(0 rermf3oodoatrluvi;(0 rxo(o3oo4opte fct () ruaxmpnt0oexo fciadfa2eaumo (0alenir3oo1fat luvi s) 2xrxrpiy1ll n nciat srtaumpno4apenmo3tad m2umn s t)tetrio tytomDe nvols0srxoim3io4om  mnctlt)sDtmx oot1tltoif3ildfa2eauvo;u4 exrmr3iy1optrli o t)t2toxr iy1ole mieta( a2rr(r ;t1opt  i3iltls ua( s t0 etnmo iytlpDeau o (  eurxo3io4ol nmnetat  rrm(r oo4olxo fctadfs2em(mont0 rxrmf iy1fmtrlues t s2uoio3ny4oleelfcilt)a2umum ou1tpe iocilt a2uauvpnu0 rtoxo3ta1fmtr u i;() rxr(r nydol  lnvtas) rtru pnt1aleo i3iys m em(mo;u0alxnxr tytlpDeanvs;t0trumxm3nudop emfetasf 2um(r nt0alx  oeiatlmDrl(vp t4 lerxf oatlmDr nesl(  etmirpou1al nmieia() rrmx pnu4aptnmo3ilsls2uan sn(4 ltnxoctatfptrli o;t)s2um(o3nydol n nvslt)aDra( pot4oex mo3iasls2rlu s;u4treniocoy1lp r u ol(0texmiopnudape lnciatfsrtau  ou4olt  ieiadls rau p;(4 rxoir to1opt li il() ruoxm3oudome lnvilt) Drmu  no1tleo oetyslmDrmumo;(4trxrmfciydlm elivo;s  exm(r3iodlmenmivi ( srtr(moou4ale mf3tatfs raumo;t)tetnio3oatfa elnvsl()seuoio iydole mnvtltfsrrm( poo0tex iociad aDuln p t)trtnxo3iadlm e ueo t)trxm(rpoy4op nmfcta( s2tr(mpnu4texn o3iytfm emnvo;u4aeeoir3ootlm  ln o s  rurxopno4oleelnvia(  2tax  ;u1tpe iicilslaDem(mp (4texomfcoytom  aivols t2urxo3oodope  fetlt srur( poo0apxomo3tas a ulums ()tlxoxo ty1laD ln olt texoxr3no4lmen ivtl()s2ta(mooo4aeeo feiys a rlnms u4altrmf3io1lpte nvi t) ruo(o iy1am  mfei (fsDua(r nt4olxnio3tatls elnvp (0alxoxfciotom eau sls0 exm(m3oo1al e ies sfa2rrxrpou1aex if3tadfsDrluvp;u0arxoxr oytomte n o s0trtm(r iu1lpen nvi ()a2raxrpno4tle ifetls s2rmnmpn(0artoxo iotoate i il(  rxo(rpio1amt lies tfarrau  ot1tex  octyt sDrlnvonu4texrirctadlptrauvs ( srxr(m3oy4llt  fcs t  rrau p;u0ole mociyd mDulnmonu) rxomfcoydlaDrlnvsls0t2uoirpnu4lltelfei tfsDrm(  ou4tlx iictydfa rln pnu)texnxr io1fmD  nvi s srxrio3ou1amte ictls) rtaxmoou4ope  fcildfs ra(vs t4tltomf todfp eauei;() rtr(opno4lme livsa(fa2raxmpno0teeo o3iyd sDrm( pnt)trxrxfcoy1oa elieilt0trxoxm3oy4lmeemnes t)sDtmx pou1teto icilsfsDelums;(4trtnmo3ootlmDrlu o t)sruoio ou1ole mnetas  2ra(rpot0apxn fetasla2rl(mp;(4trerif oodfm  lnesl( t2tr(r3iudal n ivs (  Dtm(mpnt4opxnmoetltfm2rmumpn(4artriocoodfatelies;t0sexmxo nu1alenmfvia(fa2umxm nt1opxnmf3iytfs ea( onu) rtrxo3todla r u il( trto(rpou1lmte nvtat sDtm(rpoo1apenmieiydfs eluvpnt) rtoio3oydfp   i ilt)setmim oy4optn icils  2um(mp;o1aexomietat m2elnvp;t0 rtomr3oatlpD aivs s)texr(opiy1om  lncsls a2uru onu4tpt ioeilt s2rmnvs;() ltoiocoydfmtrlnvs s  exmio3nu4ap elfes s)aDta(m ;o4tpxnii3ias s2ea(vs;u4 rerxrciadoptrluei t) euoiopnu4lp   ici t)s2rrx p;u1tpen ictydfs2emnvo t) lenxr3todop e nvi s0 exoiopiu4opte fviat) rururont4opto f3iydlsDrl(vsnu) rxomrcto1oa ranvo t  exoxrpny1omt  fcsat)aDtau  nt4olxoii3iydfm2ea(ms t4areomr3oadlaD an olt0trtoxrpou4omt lnvil()arrrxmo;o1tltomf3ilt a uanvp;t) exomrctytlm   u ol(0t2um(opoo1omt livsls a2um(m no1tpenif3iasfm2rau ont0altomr ia1om elivs ( srxoio iy1lm  lncta(fa2trxrpoo1altnmi3ias sDemn s;u0tlxrifcto1laDelivs ()trto(mpoudoptemncs t) 2tmu p;t4tleoioeildls2em( pn(4tleoifciytfatran ils) rtoim oy4lmt mfciltfsrumuro;o4apeoif3iadfa ra( s;t) leoxrcootlpteaivi;(  rurim3ou4om e nvtltfaDtmxr ;u4oeen ociad sDrl(vs;u0teeoif3iadfpDeaueo;s)srtmxopiu4op   ivilt) rtaxmooo0oexoiociydfm2umums u0trtnxfcoa1om e nvsls sexoxm3iu4oleelicia( s2rm(ronu4tlxo o3ils a2rmnmp;u0tltnio oy1omt au o;t) rxrim oy4amtelivilt a2ua( ont0tee  feiydlm umu o;t4trtnmr ta1latrlnvol( srum(o oodlp nmictatf 2rr(r no4aee ifctad a2ea(vsnt0 eenifciydop  liei;t)t2xo(m3oodlptnmfvta(  rrmump;u1aeenmoeild sDuluvo;t) exomr ootfmt  i i;( s2urxm3oo4lltelnesasfsDtaur ;u4alt mf3iltfs rluvsn(0aleoxf3iodoa  li slt0tetoirpiy1om e ici s a2ua(  nu4oltnmoeilsla rlumsnt0tlxoifctydomD  nesl(0trumirpoy4lp n icil(faDumxrooo4tlxo f3ildla2el(vpnu4artnxf oydomt  uvi;s0sexmir3iu4lm nmfet s) Dumxmpoo0aeeo fctyt m2ra( snt) exrxfcootfa r nei;(0srxoimpiudopenlivsas arrrx p;u0apen o3tldlm emn pn(4artomo tadlat li s;s0trurim iu1lmtelfvia(  rta(mont0tltnii3iat a2ra(vpnt) rtnir3todfa eluvol()t2umimpou1al e nvtat sDrm(mono4tlxomo3tat aDranvp;(0tlenif todfpDe i ils  rto(o3nudlm e nvs sfarumxr nu0olx mfctys m ul(mont4altnxr oatoptean il()srtr(o nydll   nciatfsDua(mo;o0tpe  o3iydla rlnms;(0 leoxr tadfmDraivolt0seumxr3ou1om n fci sf 2rrxmoou4tlxomo3iyd sDul( on(0 rerxf3tydfateaueolt t2um(rpnu4aptemfvia(f Dtaxmpou0olxomo3iyd mDuan snu4aexrmo todfpD aneols0 rtmxo3iodole lfctls) rtrxro;t0tltoioeiat mDelnmsnu4 eeoif totlat  i ols  exriopnudam nmictat artmxmp;t0oex  i3iatfmDean p;() rtnio3iy1oatr uvilt seuoio iydlptnlfet tf rrrx pot4apx mf3iatfsDrlnvo;t)teeoxrciodomtraneo s0s2trim3ny4al emncilt)aDrr(mpnt1oet mieiatla2eanmsnu4tltoxr io1oatrauei;s) eumxm3nodopenlfcils  rtruroot1tle mo3iasla ua(von()arxrif iotla raueo s)sexmxo3nudamen nciat)artm(mpot4opeo o3iytfs2uaump;u)aeeoxr totopteau il(0truo(m oudaltnmfetat aDtruront4aet mfetydla rlumpnt0tleoif3oytlmtrln i t t2tm(r nodam   nctlt aDumxm ;u1aleomieiytls2ea(mp;t)texrxrcoa1oaD auvslt)t2tmir3iydllen ietls)arrmxmoot0altnmiciadfm2ra(mo;() ltoiociytfmt  nvol() rxmim3iy1al nmivt tfsrrmxr no1apxn feias s rl(mp;t0artnio ty1opD anvilt0 2xoxo3oy4op e fvtl()sDururpnu1alenmociad mDean s t)arenmociadlptr i i s  rtmxm oudaltnlfvi tfarumumooo1altoifcilt a ulump u0 lerxr3iytomDr ivslt)tetrxo io1am  mfei (fs2tr( o;t1opt  octad mDranvo;() lxomo3tatlmt aivolt s2ur(r3no1op  lnetat aDtr(  oo0oeen f3tasls2um(vpnt) exrif iodfp eluvs s  rtrir oydlmtnlfcslt)srurxro;u0oee  o3iasfa uln o;(0arenxo oytomDelnvo s t2um(o3iodap emncslsfsDumxmpno1tltomoeils aDua(vo;t0 etnxo3tytoa elu ol(0s2toxo3oy4lpee fviat s2rm( pnu1oleomi3iysfm2ua(vont) rxoiociytfaDe ivils)trtoio iu1ol nmietl()s2ur(m nt1aee mfciyt a umu on(4 leoif3io1om rli il()t2toim nu4lmt lfvsa(  2ta(mooo0oexnifeiydlmDra(msnt) eeniocoy1oat lueo;t0s2um(rpoydlpee ietls)s2ta(m no0ape mieias aDrm(vp (0aexoif3oa1omt  nvils setmiopnydop n fvsltfa2ururoot4tltnmictadfm eaums;()tlxomr oodlm eln il(0t2trir ou4al nliei sfsrurxrp;t4oeeoioetyt aDulumonu4 eenio tydom rai i s0s2xmir no4lltemncia()srrmu  oo0teeomfcildlm ranvpnt) leoxfcoadopDraies ()texmim nodlp  lics t sDurumo;t0tee  ietas m2eanmpn()tetoir iodop raueo t0 eum(m3no1apee ivias) Dtmxmo;u1aexomiciyd a eanvs;t)alxomo3oa1faDeanvilt  2tmxopnudll elies tf Dtrumo;u4tetn f3tytla2emn p t)aexnmr3todomtrlivs s srtm(o3iydom e nctl( a2umu  oo0olxnmi3tadfa rl( p;(4tlxrmf3ia1lp  lueolt0t2tr(r nodapte nvs tfs2um(  ;u1tex ifeils s umn snt0tlxnir3iydoa  aneslt)tetoxmpou4opt lneias aDtmum ot4oet moeilt s2rlu s u0tltrxr oatfp elies;()tetmir3io4ape mfvs t)srtax  ;t0oet  ociasfm el( ont4 rxniocoadoaDeai s;t trxo(r iodopeemnvs (faDum( ono4tpxo oeild a rmnmonu4tetoir iytlmDeauei (0teumxrpnydomt lfvs ()arraurpoo0aeeomfetldlm2elump (0 rxrioctotfmDrlu o;( srurxr nodlmt  fvt ()sDumu  nt1tpxnmf3ilsfm ea(mo u0 ltomf3to1omt aivo (0 exmxr3iu1lm  mies s sDumu  ot4aptnifetytla elu onu4 etomr3oatlpDe ues ( s2xr(opiy1omenmfesl( srraxmo;o1olen oeiys mDrlu o;t0 rtoiociatlmtranvslt0 rum(o ou1ap elnvtls) 2rax  nt1ale  fciltfm ea( p;t0tetoioctydfm r n o ( tetoirpiodll  lici (f rtrur ot0olt io3iad m2uau sn(0teermrcio1fmte ueo s t2urxo3iudal eliesl()s2tau pnu0apenmo3tyd aDeaumo u4 leoxr3oa1fmt lueo (  2umxm iu4oleelfetl() 2urxmpou4tpx iiciat s2rmnmpn() lxrxo3oo1omDeai i;()truoiopoo1ape  nviat)aDrm( p;t1apeniociadlm rlnvo t4 rxrifctydomD  nes;(0 eto(mpiodlmtnmivta()s2rax o;o1alx  feiatls2uln p;u0 lermf3tadlmDrlivo (0srxm(m oo4open ies ()a2uru  ou1oeenmfeiysfm rlnmsnu4treoxo3ia1fm  aneils  rumimpiodlmtn fcs sf rtmxrpou0opxo i3ilsla2rm(mo;()artnif3todlpt  uvi (  etmxrpio1op emfcta()srurxmono1tptn fcias s2emnmo;u)aexoir3iydoaDr i i
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;( texo(m io4lpenlies ( aruaxmp;u0altomo3tlsfm rmnvs;t)arxrir3todoaDe u o;(0setm(rpou1lmtnmncsl( aDrru  ;t1tetnmf3ilslmDel(vpnt0trtomfciodfmt  ueol(0srxoiopoodop   icsl(fsrumxroou0alt mieiytfm2uluvo;(0 rerifctotopDrlueolt  rtr(o3oo1lmt mivs () 2tm( ono1oetoioetltlmDrl(mp (4treoxf3ia1fate iei s)t2umxr no4am emies (fs2tmxmono0aleo oetlt sDulnmpnu4aetoir3iydomtr i s;s  2tr(mpio4apt mnet s) rra(m ;t4opto ictlslm2em(vsnt) exnmfciotlp elneols seur(o3io4op e ivt (  2umxr nt4apxo fciysfa2ulu s;t)arxrmr oatlmtrai s;t0s2xmxm ny1ap  mfeiat s2umxmoot4aleo ietldfsDem( p;u0 rtrxrcoodlm elivo s  rurir3nudllenmiesa(  rrmxroot1opxo iciltlm umnvpn(4trermo3iatfpt aies t s2xoiopoy1lp emnvsat)s2uaur nu4alxnifctlt m umn o;(0aleomoctytfpt luesls) 2tm(o3iudaptn nvsatf Drr(mp;o0alx mi3iad s2umu pnt0trxnmo iotfaDeliei;s)s2xoxr3oo1al   ics s artmxr nu4opxn f3tltfaDrlu p u0arxomf3iydlp rlu i;s0srumxr iy1lm  lfvs sfartau  nu1openmi3tatfm uluvont)aexomrcio1faDe nvs;s t2uoxr iudlltelfei ()arra( onu4teeo f3iadlmDrmnvsnt0altnxfcto1fpteaiei t0s2xo(r iy4op e fctat) rtmx ono4aetnioctls m2eaums;t4alxrmoctydlmDeaivi s) rxo(r3iydol  mietatf 2rr(moot0ope mo3ilt aDuauvo t4 renmo oadlmDrlueils)setoxmpoudoltemfcias)srtruro;u1tlen ieiasfaDumnvo;u0aleomoctotomDrlnvi s0truo(m oo4llee feslsfsDtr( p;o4aeen o3iltla rlnmo;t) exrmfctytlm   nvsls0setrxopiodope  fvsas)srrmur oo1tex  i3iaslm2umnvpnu) etnir iodoatr nvol(  exoxr3iudome lfci t aDuaurpno0olt  ieildfa2emu p u) eerif io1fpDe u olt trxoxmpny1lltnlivtls aDtmuroot0olt  ieiys a2eau p;() ltoiocoy1fpDeli i s)s2tmxo3oo1am  lici (f 2raxmono0apx  o3iyd s eau s;t) rermf ty1lm rliesl(0 exo(o3no1oleemnvil() rraurp;t0altniietas aDem(vo u0tetnxr3oy1opt ln o ()s2umxrpou4ome  nvsa(faDrrump;t1tpt  fetat a2el( s;t4aeeoxf3tytoptrlivil() rxriopiy4lpee icsls)aDtm(  ot0tpeniocild aDrlnvs (4aeenxrciydfmDeanvs s) 2uoxr3oodlltelfciat aDtm(r no4apt micildlmDea(vo (4 lxnxr iytlmD  ivs (  exoxo3iu4lpt lnvt sfa2trump;u1altnmoctlsfs ul( pnt4artnio3oo1omD lnvs ()srxoir3ny1ol n ivtlsfaDuax oot0alen o3ilt m ranmon(0altrxfciytlmtr n olt  exo(opnodal e ieslt)aruaxmoou1optnmoetat aDum( p u4arenmocoadla   uvsl(0t2xo(rpiy1olenlnvil(fsrumxmpnt4tpxniictld mDul( s;u0 etnir oydlp eai s (0s2urxm3no1altnmivta()s2umxm ou4tpe mfetls a rm( p u) ltoxo3oodom eai o (  rtoim3ou4ll  livtlt sruaurp;u1opeo fciadfsDel( p;t)texrmf iytla ranvo;(0srxmxr ny1ll e ivil( aDurumpou4teeomoetld sDelnvp t0aexrmf ootfp eanvilt0s2xmim iu4llenlfviasfsDuaur ;u4aeto iciyd aDrl(vs t)arxnmocoo1omDrlues;()t2toxrpoo4ap   neia( artmump;t4tet ioeiys mDeluvpnu) eeomf3tydfpt  ivo;()srxoxrpiydlpt lnvia( srraurono0tlenioctydla2ulu o;u) exoxocoy1faDe u ols0 2xo(opnu1ame lfvi (f Drax p;o4oltn ocilsla2rm(vs u4 rtnxrcoa1fp  au o s) ruoim3iu1alt  fet sfs2raum ot1tltoifetldlm uln p;(0artnio totfmDelueols)s2uoxmpiy4amtn ieias s2rax ooo4teeomiciltfsDel(vs;t0aetrirciatopDr ueslt t2xoxopoudllee nci s  2tr(rp;t1alenmfetld mDuan onu4tltrir3iatopt li sl(0 rtr(m io4ap  mivtl( arta( oou1tle  fctltls2rm( pnu)texrir3ta1lp eliesl( trurxopiu1ll   net ()aDta(mp;t0tlxn feildlm rl(vsnt4 rtnif3oadfm  lies;t0s2ur(r3iu1lpen icsl(fs2rrxr nu4oexnmietas aDua(von() rtoxf3oodlat  i sl(0 rxm(opiu1llt mfcias arum(m ;o0openmo3iyslm ulu snt4treoxfcoa1fpDelivi (0t2xoirpoo4lmen ieil( s2tmumo;t4tpxnmi3iyslm2um(vp;u0 lenxrctodopDeai o;t) rur(m3iu4op   nvsa(fs2tru pnt1tlt ifeildfm ulu p (4altoxf oodfpDe neil(0srtriopoo4lptelieslt sDtrur oo0tpeomfeiydfsDrlnmp (4artoxfctydomD  uei (0 exm(o iy1opt lneilsfarrm(r oo1tlxn octlsfmDelu pnu4altnxr3iatfp  auvi t t2uoxm iudapeelfvt sf 2rr(m ot1ape iieiydla2eluvpnu4 rerircty1omtrlieo;s seurxopno4lmen iesl()aDrrxrpoo1oexomicild mDrl( o u) ltnxoctotop eln s (0setmxm3oo4ome  nvs s srtmu  ;o4tle mfeiydfsDemuvp ()aexnmfctodfateauvo;s s2tr(r3no4lpe lfeslt) rum(monu0tpxn fctltfa2rmnms (4texnmf3tytoaDranvo;t0t2xrirpnudll nlicsa(f 2raum ou1aet ii3ildfm ul(vs t4 etrxo3tydfmD  nvol(  rur(m iu4apte ncta( a2rru pno0altomo3iadlaDrlnms;(0artrxrctatlp  auvil(0teurxopnodolenmivtlt aDtmxr oo4oeto ociltfs2ulnmon(4trxoif3oy1om ranvs ( s2tmir oy4lp   iesltfa2ta( pno0alenifeiydfa emuvo;t4 eeomo3oa1omtr ivs s  rxr(opnu4ope lnes (f rtrumpot4tex mieiys m ean on(0arxoir3iytoat  iei ( trtoirpio4lmtnmncia(  Dum(mpno1tlen octat m umuvsnu)tltoif ia1lp rlues s0 rum(mpoo4optnlfcsat  2tru pou0tpx mi3iysfa rl( pnu4alenmrcty1oatelneslt0trxmxo3iu4lm elfet s sDrrxrp;o4tetn octlt a2uluvs;u)texnmfciytfpD lneo () 2uoio3nu1lm e ncsa(fsDraxrp;t0teenmfeildls2eanvp () eerif3tadfmDrlieo ()t2xmio3ou1optelieil()s2rm(mo;o4opt mieiasfm umnvp;t0tlermrcoadlmDrlu sl(0 exrio iy4ape mnet () Drmump;t4oleo oeiatla2em(mo (0tlxoxr tytlp r ivs;s) etrxopnu4ole mfvtl( aDrrx o;u4tpxn octad s ea(vo t)tltnmr iydfptr ueolt0s2uoxo3nu1lm elfvsa()s2rmxmpot0apeoifctltls eauvo (0aetomfcta1oa eaivs;t0srumxrpio4apenmfctl( srta(r ;u4ope iieildla2rlump t4tetrmf3ootopDr uvol(0seum(rpoo1ome mfviltfaDua(ront0apenmieilsls2ea(mo (0aeeoxf tytlm e uvs;(0 euo(r oodaptn nes t) rtaxrono4tlt  octyslaDrmn p (0artoiocoo1la rliei;(  etoim iodapenmfvs tf Drax p;o0olxomfcilt a uaumo;(4arxoxf3iadlpte nes (  euoxm3iy4olen nvt s  Drmxront1aeenmieils s elnmp;t)aexnmf todfmDrai ol(  rxrxm3iu4amenmfvs (fs2taum nt4tpe  f3iltlaDul(vp;t)alxoifcta1fp rauvil( t2trxr iydopeemneils) Duru pnt1tltomi3iydfs uaums;(4altrif3ootla   u i;() 2uoxr nydalenmiet t a2rrx  ot1tee iieiatfm2umn p (0artnio3oytfm  livs;(  rtmim oy4ap emnesasfsrumuroou1olxo fcilsfs eauvsnu0teeomfciytoaDelneilt) 2xoxmpnu1op  mnvtlt) 2ra(rpno0tlxniicild sDel( p t4tetoxo3totfat  uesls0srxmxo3oo4ale mnct t  rururpoo4aptn iciysfm2eanvsnu0teenxrciydoaDean ols0tetm(o nodope mnesas  rtm(ro;t1olx if3iatls umu o u4aeermrcia1oaDrli o;s)teuo(r oy4lleemfcsat) Dra(ront1apxnmi3tldlm rmuvont0texnio iytlmteluvsl()seto(m iu1ll  lnvs s aruru  oo4ole io3iatfm2ranmpnu) eeoif3oydomte ivi ()trtm(o ny1lp e ncil(  2ur( ooo4opx iieiad s emu o u4texomo oatoaDrluesls0 exmio ny4llenlnvtatfa2raxroou1oet  iciasfa2eaumsnu) rtomo3tytlate iei;s)trto(m3oy1omtemnvsl(fsrtrxrono0olt ifciysfa2ra(mo (4alxrxrciy1faD aivs;(  rxr(rpnodlp emnvtlt a2uau  nu1olxo fciydfs ra( o;u0tlerxociydlpD  n il( t2xm(m3iu4opte fct s  rtmxrp;t0oee  ictyd aDua(vo u0trxrmfcoydfp ean ils)trxmxmpnu4lmt  fcias) Dra( p;t1tltoif3ildfs rlump () ltoxf3oatomte ies;t0trtrim3ou1lpee nvi ( sDur( p;t4tlx  feiatfa ea( o u4areoxo oydomtranei;( s2um(mpiy1lptemnvtas  ruax o;o1ale miciytfm2ean snu0artnxf3ty1fa   i o () etrxmpoy4altnmnvsat)aDur(r nu0aetn ocias sDra(monu4teerxo3io1fp r u i t srtoir3iu1amt  fctl() rtauro;u1openmoctyd a eanmp;(4arenxf oadfaDran o;s0texo(o io4omt  nvtl(  rrrxrp;o1ope mfciatla uan pnu)tetnxoctadfm r n o ()srurimpoy4ameemnvtas a2uau pnt4oet mf3iadlaDumn sn()arxnxf ia1oa ran i;t0sexo(mpny1ale lnetlt)a2ua( pou1oet  feiadlsDum( sn()altnmr3oytfpte nes t)srum(mpoo1aleelnet tf Dtaurpnu4tltoiicild a ua( snt)texnif ta1oat ln i;(0teur(m oo1al elncsa()a2tmx ont4texniociydlmDulnvs;u)trtomo3oa1fa e nvolt t2xoim iudlm n nesa( s2ra(  oo0oetniiciysla2um( p;u)alxniocoatla r nvi () 2xoim oo1lm nlneias s2umu pnu4tet iiciad m2uauvs u4 rxnxr todlatrau ilt0trurxm3ou1omenlfcslt  rrmum ot1oexnii3iatfaDulu p;u) leniociotoateai s t trxoir iu1oltnmnvi ()s2raum oo0ape  oeilt a2emnmp (0 renir3iotoate n slt) rxoxopoudlmeemicta(f rur(r no0texomfeiatlaDuaump;(0aetrmr3tytfatr iei t)seurirpnydllte iet t)arrmxmpnt4oex ioetysfsDumn s (0 eerio tydfpD lies;s seurxo3ny1ame mfvtatfaDrrum ;u4opx iieiadla2rmn o u0aetnio3iotlatrlivsls  rxmxopiudal nlfei ()sDuaxr ou0opxoioetyd a2emnms () eeoxr3iotoa rauvols0t2uoxr3no4altnlfesa(faDtmum nt4alto oeiasfm umnmpnu0artnmo3ootoatrliesl(0 2xrxr ny1omt mfvil( arrr(mpot1tex mictasla ean s t)alenxo iotomteaueo;s seuo(r3iu4am emnvta(fa2um(rpot0tet mociytfsDrlnvs;u4texriociydlat aivo (0seto(rpny4omen fvias)arur(rpnu0opt mietldla2eanvo;t0aeerxf3oadop rlivolt0s2xm(r iy1lm n fvt ()aDtaxmpot0opt mociadfaDumn o (0aetnifcto1lpDe i s;s) exrxm nu4lm   ivsas  2ra(m ot4tpx ifciyd aDrl(vsn() lxnio3tadfaDe u slt0 eur(opno4omeemici tf rra(r ;u1teeoifctytls2rl(vsnt4 eeoir3iodomtelivslt  2umim ny1ome mfvtlsfs2rruronu4olen ociys mDel( o;u4 rxrmrctodomte n i s srtmxrpou4ll  mfeiatfa2tmu  nt1olx iiciasla ean p (4 eerif3ootlmtrau slt  exo(o3iydlm n netlt  rurx poo0alxnmi3tytlaDumn snu0alxomr oatomt  u il(  ruoim3oo1op elivs s)srtrurpoo1opx io3iad a2ua(mo t)artomr oatlaD aueo;t setmimpiodopeemivia( a2uaxro;t4openif3tldla rmnvs;u4areomr3iytlm  ai ol()trxoxrpoo1ole miesls arrm(rpou0tpe mf3tadlmDuanmonu0tetoir3tatopDraiei (  euo(o3io4oltemfctlsf 2tauro;t1aet  octyd s uauvo;()teermo3iytlaD  u i t0srxmim3io4lpenmnvs ( s2tax  no0oeto ocias s2ulu p u0 lxomrctotomtrli o;s0s2xmim3oodomt lfct (fa2ta(r ;u4apxomoeiytfs2uaumsnt)aexnmrcoy1omDrauvo;t0texmxr3oudape  ivtlsfs2tmxr no1oexnmoeiyslmDua(mo;(0tlermf3oytop elnvs t setmxmpiy4lmt  nciasf 2ra(rooo1ole  oeiaslsDemnvo t)alxnifcoo1optr uvo;s0s2ur(r nu4ol nmfvs (faDrr( poo0ole mi3ildls2ean p;t)artniociy1omDrau s ()s2xoxr nydap e ivsat)aruau pot0aetomieiatfm elu pnt0texoif iadlpD  ieo s  2trxr3iy4ll  lnvtas sruaur oo0tpxnii3iatla2uanvo t0aexnmf3oa1lmDrlnvi t) rxo(m3ou4am e ivs ()sDrrxmo;o1alxomoctatfm2ea(vp;t)aeerxf3ty1oat  n s;t)seuoir nydlmtemnvil()a2rm(m no4aeto oeiydfaDrluvpnu0arxrmf3iydfa   u ilt texrxm3nydom  mfeiasfaDum( oot1tpxoiicilsls2emnmo;()alxoxf tadfp e n o (0seuoirpoudlmtemfctat) rtru  ;t0oeenifciad m2rmu on(4trtrxo oatfmDeaivs;s trum(r3iu4opt  fei ()aDraxr ;o4oleoiiciaslmDemu sn()tlerif3oo1omtrlnes s0 2xrxm ou1apt lnvtlsf 2raxmp;u0oeeoiocilslm2rluvp;u4 leomo oy1fptr nei t0setmim3io4llenlies s)aDtmumpnt4tle ii3tytfs2uluvsnt0tltnxo3io1lm rauvi;(0 ruo(rpoo1omen nvsa( srur(mo;o0ale mieiltlsDul(vo (0aexrmrcoy1lat li i s trur(r3iy1openlnctatfsrrr(  nu0tlx iociasfaDrm( pnt4 lerxo3iy1lpt auvo s0srtmir3ou4apenlfvi s) rrmxmoou4tlx mieiltfs ea(mo t)alxrxociadoa   nvs ( s2to(m3no1llte feta()s2umurooo1opto ieiatla eanms u)trtrxocoydfmDe uvs t0t2uoxr3iudaptemnvsat)s2tr( p;u4tlxnmoeiysfs2uan pnt4aeeomo iy1fm r nvs t)teumxr nydom elfci () Drax ooo0apxniociytls elu s;t0treoxo ia1omt  nei;()tetr(r no1omeemfvt s aDrm(  nu1oet  i3iyslm2uanmp t) rtoxr3tadopDeauvs t) eur(opou1llt lnctat aDrr(ront0oleoifetlsfaDemnvpnt0teenxo totfmteanvs;s0t2tr(o ny1am eliciasfsDrr(rpot0altnmfeiaslaDul(vs u) eenxfctydlptraivo t)trumxo iodapt mivsas)arua(m ou1apxoio3iyt aDranmo;u) lerxf iadoa r ueils trtoxr3no1ole livi t s2tru p;t1texo octas a2um(mp ()tltrirciytfa   n o;(0 exrxo oo4am nlncslt)a2taxmp;u4opxo f3ilsfa2ua(msn()trtnmf3tadlaDr n il(  rxmim no1amenmivt s srurxm ot4tee ifctls mDelums u0trerif3iydoatrlies t0sexmirpio4llenmnvs ()sDtmxr ot0olxoii3tadlm eauvo u4arxnif tytoat au s ( srto(o oo4llt  nvtasfa2uaum no0tptomf3tlt m rluvs (0treomocoodfm elnei;(  etr(o iodllenlivt (farrmxmooo0ope mfeilt sDua(mp;(4trenif tatlmDrli s;s trumxm io1omt lfvsasfa2taumpno1teen ieiltls ra(vo u) lxnxo3ia1fm rai slt) exmio oo1amt lictls arur(  ;o1alxnmoctys s uau o;t4trtnxr3ty1fp  auei;s0 rtr(opoy1lm emiesls)aDtau ono4tee io3tlsfsDemn o;t4arxoxfciytlpDr ueo;t)trurxo3nu1lleelivt s sDtmu pnt4tlxnmoeiltfs emuvo (4 reoif tadla   neils)t2uo(o3iy1alenlnctl(faDur(mooo4oexnioeiys sDraumont4tlerifciydlatelneo;t)t2xrimpoy4openlivs t  Drm( p;u4tlxnioeiatfm2rmump t) rxnioctodlm  livolt)s2uo(r3iydapeelfvtltf rrmxrpou0tetomo3tasfa2uaump t0altnmfciatfaDeai o (  rxmxopiy1lltnmfvsas s2ta( pnt1tleomo3iasfmDrmnvo;t)trxnxf tydom   ueolt0 2xmxrpny4lpt mneia( aDtaumo;o0olxnioeiltfs ean sn()tlermfcoy1om eluvs;t trur(o io1opt  nvils) Dra(r ;u4tleomo3tysfs el(vs;u0tleoxf oa1fmtrau i;t  euoxm3oy1lp nmnetlt  Dtm( pnu1texomoctldfm ra(vo;()teenmrciydfaDrluvo t trumxopoy1ameemict s)s2urxr nu4tle iieiatlaDeln s ()trxoifcoatla   ivol(0s2ur(rpnudol elfviat srtax  nt0aet mf3tltfa2rlnvp;u4 rxrmo ty1fmtraivol(0s2xriopou4aptnlnvsl(  2ur(rp;t4optn o3tyt mDumuvsnu)teeoio ty1la e nes;s)t2uoim io4op elivtls)aDtaur ;u0olenmfeiad m ea(vo (4 eenxrctotfat  n o (0sexmxopoy1lmeemfesls s2tm( pnt1alen iciydfsDumnmp t0 ltoxr3oydop eaueil() 2um(m3no1lm emfvtltfsDrr( oot1tleoifeilt m eln o t)altrio todlp  an s () 2toxo3io1ll e ivs sfsDra(mp;u4tle iictysls2ra(mp;t)trxoxfctotomtr neo;s) rxm(o io4opeelncia(fs2raumooo1olenmictlsfsDea(mpnu)aexnmociodfmDran o s0setr(m3ou1omenlieia(f 2rruro;o1tpxoio3tytla rl( pnt)aeeomr3oatoa rau sls0t2toxr oudol  livta() 2rru pou0teto icilslm rm(vp;(4 lerxo iadlmDeai i;s) etmxmpoy1lmtelfvtl()a2ua(mp;u1aetoiietydlmDem( pn(4 renmo3oodfate ues;( t2urio3oy4alt mnvs sfartmurp;o1oex mietlt s2umn onu4aeeoxo3oa1optran sl(0 rtmimpnu1lptn iet sfa2ta( oou4olxoio3ilsfmDeanvp ()aleomf oodfmD lues;(  exo(mpoo1ale  icta()srurur no0opxn oetltfsDua(vo;(4 lxoxr iydlpDrlueolt0s2umxr3oudlp n nvi () Dtm(r nu4altnioeilsla2umn o;t0artnio3oo1fatr n o;s)t2urir3iu4lmen iesa()sDtm(  nt4aptoii3tydfaDra(vo ()arenmf iadoa   nvo s sexoxopoo4alt miei t srum( pou0apxoif3iltlaDrlnvpn(0arerif tytlmD luvsls trxrir3iodaptemfesa(f 2trx  nu4apen ociatls2ran o;u4alenxr iytla  ln sl(0 exm(rpny1om nliet s) 2tmu o;o0ale mfeiytfm2ulumpn()texrif io1fmDr ueo;t)t2umio3oudlpt lfcs tfsrtmu p;u4apeo ieildfs umnvs;()aeermr3oydomDeliesls)s2to(m3oo1ap e fviat a2rrump;t0tlxn iciatfm ulnvp;u4 rtrmr3todlmt auvo s0texmxr iodlpe  iet ( aruaxro;o0alt if3tysfa2emnvs;()alxnmf3oo1lm rluvi t0teum(r iydom n nviat s2urumpot1tleniieilsfa2ran p u4 eenmr to1fpDe nvolt  rxo(opio1apt liesat  2umur oo4tpenmfctldfs2elnvp t4teeoio iydlat lu i;s0s2xm(mpno1omt  fvs sf rrmxm nu1aexnmf3iyd m2ea(mp t4teeoir iytfate ivi;t)trxr(m3nu1om n fvi t)srurxr ;t0tpen fetlslm2ea(mpn(4tltnmocia1fa   iei;t trxm(o oo4ole lfcsa(  Drr(ro;t1apen i3iad mDea( pnt) lxoir3totlatr n o t0s2urxo3ny4lp n ncsas sDtru pno4tpx if3iyt m umuvs t0 rxoifctodlmDe nvol() 2trxmpoodamt mfci s s2tmuroot0opxnif3tysfaDeanmo;(4 etnif tydfpD li o;t) rtrxm3nydape lnvtl(f rumumpno4tee ifciysfa rmuvs t4trtrmrcio1oa r i s (0srum(m oy1ope  ietasfs2umuro;t0tpxn o3tltfm2uanmont4 exnio3io1omte i i;t0tetoxo ou1alenlfcilt)sDua(  ou1oltomfctlt sDum( s (0trtrio3iatfmD lnei s setoxrpou1opt livs sfsDtmuro;u1aptn o3tys m elnmsnt0arxnxo3oy1oa elueol(0 rtriopny4lleemivi t)a2rrur nu0ale mf3iytfm2rmuvsnu0 exrmocoydlp   nvs t tetrxm3oydome mfcs sfsrtmur oo1opxomfctlt a rlumo u) rtoxf oydfaDr n o ( t2xrim no4lp nmfct (  rrmu o;u1opxn f3tys sDra(mp u4 lxomo iydlmDrliei;t) rxmxm nydlptnlfeta() rra(rp;u0oee io3tldlaDemums u)trxrmo3iotop ran il(0seto(o3ny1ale lfeils  2tmxm oo0apx  f3iyd m2em(mo;t4aleoir oatom raivs t  2umxopoy4ope lnctl() rrmu  no0aptomo3tydfsDua( s u4 lxomo3tydomDeaneilt)setm(mpnu4optemivslt)aDrmx pnu4opeomoctyslsDul( p (4tetnxfcootop eauvs t) rumxopnydlptemneslsfsrtmxrpot4apt iiciydfm uaumo u) rerxr3totom rluvil()t2tm(r oudlmeemnvsat)artrum ;u4tpxomoeiydlm umn s;u)alerxr3ia1lmDrauesl(0trtmir3ny1ll elfvs (f rurur oo4oee mictadlm2ranmp;(4texrxfciotomt  ueols0 2tmxr nodamen fesas) rtaumoou0oee  ieiyt s2rmu p () rxoxrciodlmDe nvs;s)s2ur(o3oy1lpe lfvtat aDtmx o;u0tpeoiociysfsDem( ont4 leniociadfaDraueo t  2uoxo3nydap e fct tfsrururo;t1olxn iciytfs2uln on() rxnxr3oatomteauei;s0sexm(mpoy4lp nmieiat artmumooo4alto f3tytfs uanmon()arxnmf3ootoaD lieol(0sruoim ny4om  livias artrum ;o4aet  oeiytlaDrmu p;u0alenmf3ty1lmD luesls  2ur(mpny1am n icilt  rtmx p;u1teeoiictad sDrmnvp (0altoir3ia1laDelnvolt0s2to(m nydomt mici t)arumxr no4ape mo3ilsfa2el( o;u)teeoir tydfm r ivi;t)sexr(opiu4ol elnesa()sruau p;t0openmociat sDelums u0 rxomr3tadlpDraivol()trur(o3ou4oltelicsasf Dtmxrpot4aeenmfctydlsDuau o (4 rxrmfctatoa   i slt)seum(opoydllt liciat sDtmxm nt0optnmfciasfsDraumsnu0trxrmr3oo1laDeaivi;t0 2toio iodameelfetlt)a2ur(rooo0opeoioeils a umn pnu) renioctytlp eanvi s)trtoir3iydam   nviat  rrmu  no1opxomietldlaDelu onu4alxnmo oatopDeai s;t0teuoxm io4om  lieils aDrr( ono4olxnmi3tatfmDrl(mont0tleoxfcoadlmtraiei;s) 2xmiopoudom e fvs s sDuaumpou0tlt mf3tys aDrauvon() etnxr oodopteau ols trxrxm3ny1amen ieiat)srrmumpot4teeomi3tld mDumu p;u)tlxomf ootlmDe n ilt)teurxm3iy4aptnlfci t)sDtau pou1oee  o3iysfmDuln o;(4tetnif oo1om rlu olt0sruoio iydlm  mncs ()s2tm(root1texnmo3iltfmDumuvs (0treoxo3iy1omDrauvi;t s2xo(mpoodapen neiat)aDrm(ro;o4oexnmictyslmDran snu4 leoxfctytlmte uvols s2trir no1lpeelfcilt) Duaumoou1tptnmf3iatfaDulnvpnu) rxrmrciy1fpt anes;(0s2xoxm oodapt lfesatfsrururp;t0tptn ieiasfs rmuvont0aetrmo3oo1fm r nesl(0sexoir3nydal elnvsas artr( onu4oee mi3iasla2emnvs u)texnif oy1lptranvi () rtmxrpnu4omtemnvi ( arrmumpot1tltn iciad mDrl(vsnt4texoxr3totopDrlueil() rur(o3ny1lltemivil(fs2tmxm nt0tpto iciytlmDrau o t4 exomo tytoptr ivi ( s2xo(mpoudlmt  ivsltfsDrr( o;o0apto fcias a2uln o;u4arermf3iadfmD lnvols)s2xoxm ny1ll  lnes sfaDrrxro;o4oleomoctatfs ea(vo;u)tltrxr3tadoa eauvs (0srumxm nodll e ivslt) Dum(  nt4tpx mfeils mDelump t)aleoxf io1fm  auvol() ruoxr iy1ap  miei t artrx ooo1olxnmoetldla2emu pnt)arenifctatfm rlnvi;( t2xoxmpoodap elneil()srrrxrp;t0aet ifeiydfs um(vonu)arenxf tadfaDeli o t0trxriopou1ll   fvsls) Duauroot4tlt iociasfsDemnvo u4trxnxr3todlmD livilt) etm(o oy1ol  lieilsfarrrx p;o0opto iciytfs um(ms;() eeoxf ootlat au i (0trxr(r3ny4op  liet t)s2tmum no1tlxnmf3ilslsDelnvs (4arenmrcia1fmte neo;(0 eurxrpou4lm  mivs s s2rmx oou4open ociatlm elumpnt)tltnif ta1laD aueo;t) exm(opiy1omenmneilt) Dtmur ot1openmieilslaDul(mo t) ltnxf oatfa eaies (0 etmim oydomtnmietas) Drrur ;o4teto f3taslsDrlnvon() leoiocia1oa  liesls trtrio io4omtn fcsas) rtrx p;u4tptoiicild s2raums;(0 eeoif3oytfaDrliei;s) rtmir nudlp emivs tf rrax pnu1olxniocildls um(mo;u0 rxnmo totlmtrlivi;(0tetm(m3iu1lp n fcta( aDrrxroou1apeoio3tasfsDrmump u0 etoxo3totlmt  uvo;t)t2tmxopou4altnlncias)srta(root4opeomoeilsfaDrlnmp;u)tlxrxf ia1fmDe ivo ( t2to(opiydlltn iei sfs2tmx o;o4apto f3tysfs2ranmsnu)artrmr3todopt  ivil()t2uoxr oo4lp emnei ( a2raxrono1olx  ieiatlmDeaumsnu4arxnif oydoateaies;s)t2xrxrpoo4ll nmietasfaDumxr ot0teeo oetatfmDumnvs t)alxrxf iatfa ran s;s s2uo(m iudlltemnvtlsfs2um(r ot4tpeo oeiydfaDuau o;(4 eeomf tydfa  lnvo;t0trumir3iydopeelfvsl(  rrmumonu1tlx moctyslsDemn onu)tltrxf totopD lneo;s0 etriopiy1amtelfvs ( aDur(m ot0oexo f3iydla2ea(vo u4 exnmf oa1omD  nvi;t0srxrxrpiy4ope  feiat a2uaxmono0oex  fciasfaDrlu p;()arxoio ootoaDelu ils t2xo(rpiy1am nmivtas  2uru pnt1oetn o3iaslm2ranmo;t)trtoif oydoa rluvi t) rxmxopnu1alee fvsa( s2rmu oou1altnifeiltfaDrl(vp t0alxoio3iadlatelivs s0 etmim io1altn fvsls) Dtr(root0olto feilsfs ul( pnu0alxnmo3tatoat lnvo t) etoio io1amenmnei ( s2tmxmo;u0oetnmieiydfm em( on(4arxrmfciytfa eai o (0trtmxr3nydam  lieiat)sDraxrpnu0olxo i3tld sDrmnvs (4 etnif tydopte ivol( trxoirpiu1altnmivi t)srra( ooo4tptoiieiytfa ulu s (0 reoif oatfmtelivi;t trtrxr iydlle lfcsa(farta(r oo1tet  oetyslsDeanvo u)aetomo3oadopt li i t) rtm(mpiu1lpeemfcta(f rtrx oot0tetoii3iyt aDea(vs;u4tltomf3tadfmDeau ilt s2toxo iy1omt  ieias  Dtrurpnt0teen f3tyd s umnvo;()aleriocootopte ueilt  euo(opoy4lptnlivsasf Drmumpnu4texomf3iys s2ua(vo;t0aexnxoctotlat liei;(0teuo(opoodlp   nvs tfaDtaxmpnu4apx io3tlt a ua(mp;t) renxf tadla rln olt0srurio3oo1alt lfvs ( sruax ono0opxomi3iatfmDumn o u4teeoio3oodom  aivslt  euo(rpoodop emieiat)s2raumono1opxoio3tadfs2em( o t)altoxo ootomte i o;t t2uoxm3iydaptnlneilsf Durur ou0oee  iciytlm2emn p (0tltrmfctotfpt lneolt)setr(o oudlpen fvilsfs2tm( oot0olxo o3tlslsDemu o u) exrio oydfatelnvi s sruo(o nu1openmncilsf Dtm(r ;o0tleo o3tlsls2ulu on() exrxo tatlpte u slt  2uoio3iu1ale lnvtls aruaumo;o1apeomictatfm2umumo (0 eeoxr oy1op  ai sl(  rxoim3iodame mnvta( a2umx onu0tlx io3iat aDrauvs u0arerxocta1opD  nei s0s2urxo iudame  nct t artmurono1oltoif3tasfs rmnvp;t0 etoxo3ty1laDrlueo;t s2xr(r3oudapenlncsasfaDuax  ;u4oleoioeiltlaDemn o t) leoxr3iotlaDe ivol()trxrxr3no1lle licsa( srtmu  nu4ole iictyt a rau pnt4alxnir ootfptelneo;()teur(r3nodlme  ics t)a2rru poo1opxn fctad aDemn p t)alenif oy1lpDrlu s;t0srumxmpnu1omtelfeil(f rrmx poo0apx miciatlmDulums t4artrxr3oy1oa e uvol()teurxo oo4omt  ietl( srtm(rp;t0texniiciltfm2ulnvp;t)arermf iatop elieols  2toxo iy4altnlivi ( aruaum nt1oexomi3tasfm rauvp;t4altoxoctatlpD  nvsls  exoio iy1lle mfvtasfs2tmumont0tlx  feilsfa2uluvo t0arenif3todoaD ln i;(0trtrio ny1lp elicsas)srtaxr nu0opxnmocilsls2em( pnt4tltomo3tytlp elnvo;(0s2toxmpiu4apeemicsl( a2taxmooo1tpt  f3tysfaDrlnmsnu0alermf iatopte ieo (  2xmxm iodop nlfcsat  2rm(  ot1olxnmf3tysfaDum(vs ()texrxocoydfp elivo t  2urxo nu4om e nvsl(fsrurx oou4oexn oeild aDrmuvonu4tltomo3oodoateai ilt)setoxopno4amtemfviltfsDum(rpnt4altn oeiatls2ulnvon(0altomf3oodfp  auvo ()sexoirpnudal n ncslt srtm( pou0texo o3iadfm2rmnvo;u4 lxrxr3oadfptr nvi s)trur(mpou4lmenlicsl( sDrrxr oo1opt  o3iydfm emnvont) leomfcia1fatr u slt) etoxr3oydlm emfei sfsrrrxroot1teenmo3tls m elu s u4altnmr3iy1lmDrau s s0trtmxr oy1apeelneia() 2taurp;u1apto i3iasfsDrl(vp u4aeerxf3oy1omt livo;(0 2tmio3oodomenmfctls srurum ;t0tpt  fctas s ra(vpnt0artoiociytlp ran s t trxoxr3oo1lme mfes ( aDtmxr ou0olt io3iydfsDra(vp u4teeoio3iy1oa  anvilt  2tmiopiudlpte feiat sDumx  nt1oexoifctlt m2ea(vs u4 lxrio3ia1optrlues;()s2xo(o io4omenlnvta(f rrru o;o0apxnmocild s rlums t4aeermf iodfa eaies s0setm(m ou4lpen fvtls arurxr ot1tlenmfeias m2rlump;()trxomr3ootfaDeauei t0texrxm3oy1lp   ivta()aruaxmpou0tetnmieilt a2rm(vp;t4 eeomf iytfateluvi () 2umxrpiudamt lncil(  rtmxmpnt4opt  i3tas m2emu p;t) leoxrctytfp eai i (0s2trim3nodape  ictlsfa2rrxrpoo1teenmoeias a rlu pnt)arenxo iytlp eaieo ( s2xoxm3nu1amtemncs (faDrrx ooo1opx mfetatfm2rln s;(0 ltoio oadla  lu i s  rur(m3no1apenmieil(  rumx  nu1alto feiadla ua( onu0alerxr ty1faD li slt) etmxm3oy1op elnciltfaDta(rp;o4olxnifetldfa2ea(vp;u0teeomocoatlate ueo;s0 rum(mpiu1lm e ics t)a2rrurpoo1aetn iciys sDua( p;t4aetrir3oo1lpDraieil(0srxoxm iu4opt  ieils sDtrxm ;o1tleo f3iadlsDum( p u0arxrio3iy1oaDe n o;t0tetmim3iy4amtnlicilsfsDtru oot0alx mf3iasls2elnvo u0teerxfctatlm raivo s truoxo no4aptemnet tfartr(  ou4tpx io3tyd m uaumon(4teermf oatfpt ln i ( srtoim3oudlpen nvtlt  Draxmoou4oltoiociad a rmnvs (4artnmoctotfpDrluvo;t)s2xrimpio4ll  mfvilt)a2rr(m ;o1aptoifcias m uanmo;u4artomo3tytoa   i s (0t2xm(r3iodlm n neilsfarumu ono1apeoioeiat m rlnmp t4 renxrctadopteauvo t tetrio no1omtn ncsat) Dua(m nu0teeoiieiydlsDrluvs;u)arenxfciytoa  aneils) rxo(o nodom nmnet (  Dtax pou4opeomieiadlm rl(vsnu4 lxomociadfatrlueo;( truriopiy1lmtnmfct t)a2tm(  ot0alen iciys s umnvpnt4trtrircoo1fateauvi t0trtmio io1lltemfcil() rrmxmono1teenio3tad sDum(ms;t)aetrxf oodoate ieil(0 etrim3iy4lp emfvi (fa2rax poo4apen i3tys m2em(vo;u4 exoxociodlpDeaies t) rtr(mpnu4ll  mivt t srrm( pnt4oltnmieiltfm uanvp t4 rxrmr io1oa ranvsl(0tetoxr nu1optelfct (f 2tm( oot0tetnmi3iltlm2ua(mo;u) lenxo iy1faDe ivs;t) 2tm(rpoudlltemnvtat) rtauroot1aex ifctldlaDrm(vp u4alerxrcoytlat auvsls)trtoxm3nu4apenlicsa(faDta(r no1aleo ietyd s elnmsnt4aetnircta1op  lnvs t)t2uoxr3no1ap nmivslsfsrrm(rpnt4altomf3tydfaDem(mp u4 ltrmr iydfa raivsls0s2tmio ny4oltnmivtls)aDtaxro;u1aexo fctasfs emu p;(4alxnxf todomtrlivsl()srxrir iy4optnmfvt () 2ta(rpoo1oee mfciyt m2ra(vsnu0 ltoif3oy1laD anes;t  rxo(m iy4llt mies s srta( oou0alxoif3iys a2eaumpnu0teeomrctadla rlu i;s)tetoxm io4opt lnetlsfsDrm(mp;u4alenmo3tys s elnmpnt0alxrxfcoadoaDelivi () exm(m oydomee ivsl(fs2rr(r ou0tpx if3tydlaDelu o;t4aeeoxo3oodfmt lnvs;t0s2xoxopio4ome  iei s)sruau pnu4opx  oeiat m2umums u4tltomfciy1fp elivi s)setoxmpiy1openmfetatfsrurx o;o1tlxnmf3iat s2emnvo;u0altrmfcia1lm   ues;()s2to(o iu4al emfviatfsDtaxrpno0tptn feiydfa emnvs u4texomr3oo1latrln s;t s2uoxm no4lme  ivsas sDur(moot4aptnmoetatla2rlu p;u4alxnio3oydfaDeli sl(0trumimpny1apt mfvsas)a2uauront4opxo oeiyt s2eanvon(0 rtoir oytlptrlivo;t0seuoirpoy4om e ncs tf Dtr(rpoo1opeoioctys m ul(monu) etrxf3oytfmte i s;s  rxrir oy1lleemfvi sfs2tau oou1oltomi3tld m umu ont0altrmo ta1lpDran s;t0t2uo(opny1ll elneilt)aruaur ;t1tpxoifeilslm emnvp;t4tltrifcty1lp  au sls)srtoio3ny1olt  feil(  Drmx ooo4alxo o3ilt m2uau s;u4aexoio3to1fp eau slt srtmxm3nudlmee iesl() 2tmurp;o0alxo iciat mDem( snt4 exoir3iatlp r nes;(0 rtrxm3oudll emfetas)sDraur ou1aptoif3ils aDel(mo;(0tetrio3tatfaDelnesl()s2xoim nu1ap emfct sfsrumx pou1alen fcilsfa2rmump t0 eermr oytoa  ln i;( t2tmim3ny1am   nctlt srumxm ou4tee  o3iyt m2eluvonu4 lerxo todfmDeluesls0 rtrxr io1altemnvil(  Dta(r ot0tpeoiociad aDra(mo;t) etnir oadfa e uvo;s)t2trio3nu1apeemncia(  Dtaump;o1aex iieiadlaDel(msnu) exrxr iy1lp rlnvs t0s2to(o3nodalt lnvil( a2rrur ;t1alx ii3iydfsDrauvo t4trtnxfcoydop  anei;t)trurio iy1ol elnviatfartr(ront1tpeo ocilsfsDulu o u)aexoxo3oytfate ivil()seuoir3iy4amtelieils) 2tmu pno0aleomo3tasla rlnmpnu)altnmr totlaDraieo;s) exrxrpiy4omt mfcs (  Dtr(monu0open iciltfsDeln p u)trerxf tatfpDeanvi t  ruoxopiy1ll nlies ( artaump;u0aptomicildfa rluvpn(0altnirciatoa e i o s0t2xo(mpoy1omtn ivt s srua(rpnt0aetn o3tatla2emu p (0 ltnmo3oydfp rai s;( s2ur(opiodlme mfcta( artrx  ;u1apeomoetytfa ulnvs (0tltrxrcta1fateln s (0setmxm no1lm   iet t) Durxrono4tpe  o3iadfs2rmnmonu0 ltnxr3to1lm r ieslt)s2um(mpiydoptnlnei () 2tru ooo1tpx  iciat sDrmumsnu0trxnmfcto1fatrlueo (  rxmirpoo4ameelict tfs2tr(root1opx if3tad m ra(vonu)texoxf3tydoaDr u o t0trtmim3oo1olte fcslt) 2tr(moot0opt  f3ild s2ulnmo (0aleoxocta1op elnvo s)s2xoirpnudlp n netltfsrrr(r ou1oetn oetyt sDrlnmpnt4texrxo3ia1oaD  n i () rurim iu1lp  mfvil()sDtru  nu4ope  i3iysls ulu o () reoxrctodfpt  ivi;()sexm(opny1ole  fcta()sDrr(mpot0tetoiieiat a el(mo u4arxrif3ia1omteln i;t)s2xrxo3oudlmee ivsa() 2uaum nu4olen ociydlsDua(vonu4artnifcoadfp e neo s) rtmxr3iy4olt lnvs sf 2ta(  ;o4tpt  ieiltla2eanmsnu4alerxf iytlaD  ivs;( t2xm(o3ou1ol nmfvtls)s2tr( p;u4ape  octldlmDrm( s t4arxrmocty1fa  auvo;s0s2ur(m3no4opt  fci t artax p;o1aexnmiciat s2rm(mon(0alxnio3ootomDeai s;(  etrxmpno1lm  livsls) 2trum nt0aet  f3iatlm ua(mp ()tltrmf iy1oat  i o;(0texoim iy1ameelfesatfaDur(m no1ole mi3tyd sDemnmp;u4arxoifcty1fm e nvs;() rtrimpny4omenlivt sfsrtmx ooo0aex iietydls2rmn ont)aexrmr3io1la eauvols) eumim3nydlp   ivta()arrmurpoo1tex mfeils mDrl( ont)tltoio3oydlm raneils0 rtrxo3ny4lm elnvil()arrax pnt0ale mf3iadls ua(vo u4tetoioctydoptrlnvs ( s2urxr io4amee nviat)sDta(  nu4tex  fciydls2ua( pn(0 eerxrcia1lptean ilt) rxoio no4lp elnctlt arrru ono0olxn oetatla2ra(vp;u0 lerif3todopDe n s (  etmxmpno1opee neia(fsruaxmoot4aexn o3tltfa elnvp (4treoif iodlp eai o s)s2xrxm3oo4amte ieiat)s2raxm nu1aptomi3ils mDrauvp u0arxnxr ia1omteluvslt)t2tm(o oodap  lneils s2uaur ;t0tex iiciytfa emuvs;(4aexrxociydfmDr uvils)s2to(mpio4lmenmnetat aruaum ou1aex mfctasfs ra(vont)trenif3ta1oatrau i;t  rxrxm oo4aptelfcsls) 2ur(  ;t0opxnio3ilt s2umuvp (0tltrmrctytfpt  ies t)s2xm(r iudllee fes s aDtau p;u0opto ictltls ua( snu4texomrctytopD aivi (  2xr(r3nodlpeelnci (  rrrum nt4tltniocilsfm2eaumo;(4trenif oy1om r ueo;t t2xrxrpnydlp emfesa(f 2ra(  ;u4optnmf3iyt a2ul(mpn(0tlerif3iydfmtrai o;s) etoiopiydlm   ncia( aDrm( ono0altnmfctlt a2ea(vs;t0 etrxo3to1lp   u i t srtmxr3oo4om e ivtasf Drmxmpnt0alx  ictld a2ra( onu0tltoxfciy1oaD livs;()s2trxm3ny4ap emiet tfa2rr( pnu4olx miciysla2eanmsnu4 etoxr ia1opt li sl() 2uoxr3iudlle mfviltfsruauront0alxnmfeildfm em(vsnu0alxomf3tatomDr uvi (0 2xoirpiu1omeelietltf rtmxr ou4apeomi3tytfm2rl(vp ()altrmoctodlpDean o;() ruoxo3oudaleemnvta()aDrrx pno0oet  ociyd mDul(vsnt4 ltnif3iy1omt  ivsl(  rxm(r3io1alee fvslsf Dtaumono0apeniieils a2emuvs;t) rtoxf iatomD lnes s0t2tmim3oodomen ictatf rumurpou1opxomi3tyt m2ulnms t4 rxoxo3oytfpte nvs s) rtmim3nudamtnlfcsls) Duau ono0opxnii3iytla ua(vo;()altoio3oodopD aieslt) 2xoxo nu4lptnmieta() 2urx poo1aex ifetyslmDea(vont4arermf3ia1oa e neols) rtr(o iu1alt  nvtlsf rra(  ot4alenmietlsfm2eauvp (4 rtnir3iadfpt aieo t0trur(m3iu1am nmiesls)sDra(  ou1alxoiociyslsDua(mp ()teerxo ty1fa eai slt0s2uoimpiy1lptn fctlt)arrmur ;t0oetomi3iatfa2uauvs t4aexnxo oatfatrluvo t) 2urimpoydllt mivslsfs2rm(  ;t0aleniieiat mDumn pn(0trenmo3tytlmteaivsls0s2uoxm3iu4lmenlneilsf Durxrp;t0opxomieiltfs um(vo;(0artoxf3oytfa  lnvsls0teuoir3iy1lltn fei sfs2tru  ;u1oee  i3ilt s rmumo;u4tetrif iytomD anvi () ruo(opiydoleemfvs t  2tmurpou1tptomo3iyd sDrlnvs ()aexoxfcoa1faDe nvsls0tetoir3no4olenlfvsltfsrtmxmonu1optoifciadfa2ua(mp;u)aexomfctotlpteanes (0tetoxmpiudlpeelfet t)s2tm( p;u1aeeomo3ilsfsDrmu on(4arxnmr tydlpt  ivo (0 rumxmpnydal  lnvilsf 2trum oo4oex ifetyt m2uanvsnu0 lxomr oa1fmD lneo s s2xmxm oydamtnlfvil( a2umu poo4ape mfciytfs2ulumont0alxrxf iatlmDe uei s setoim3no1ame mfeiasf 2ur(mpno4tpen i3iadls raums t4texomf oydlpD luvsl(0t2trirpnudalt  ictas)a2uaumoou0aexnmi3iyd m em(vpn(4areomr oa1omD anes s0setrxm oudale mivsa( a2rrx o;u4tlt mictyslmDelnmo (0aeenio3oatlmtean ols0texrxo3io1lptemnci ()s2um(r ot4tltn iciatlm ranmsnu)aeenio3iytop e u i t0tetoxopoydopte fctlsfsrtrumpot4tet iieiyslm rl(vpnu) eeoxf3ta1omte u sls s2xm(m3no1am nmnet t  Dua(mooo0aeenif3tlt a2rmu s;u)tleoxo3oy1oa r uvils)truo(rpny4apeelivsl( aDra(m ;u1alt  fciadfs2rm( p u) rxnifctotlaDean o ()s2to(r3oy4omtelnvilt) rrrxmono0tlxoiictas s eanms;t)alerio oodopDeaivi;s srtoimpou4oltnmncs tf rum(r no1alenioctltfsDuauvo;t) rtnxfcoatop elnvi s)trxo(m iy1lpeelnes ()srrruronu0tpe ii3iydfaDra(msn() ltoio oo1op eln o ()srtrxmpiodal e ivsasf Drax o;u1oltomfetad s el( onu)teenif iy1lp rlneilt0texmim oodop n ics t a2tmx p;o4tetnmo3iatfmDraump u)aexrxr tatla eln o ( sexmim ny1llenmnctas)a2tau  oo0tpxomo3iadla2rmuvo;t4 lxrxo3oytlaDr neols)trxr(m3ny4oltnmivtas)sDrau  ;o1alxnmieiytfaDra(msn(4texrif oytfatelneo;s) rxr(r ny1lp emietat)sDtru o;o0aleniietld a2rm(vo;u) rxoir3ta1fpDe uvs t)srtoim3iy4omenmnvtl(  rta( onu4aleo fetls aDemuvsnu0artnmo3iatfmDeaneol( s2to(m iu4lptnlfctls artax ont0openmo3iltlm rmumpn()arenmf ta1oaDe ueo s0trum(o3io4lp e fvsasf rrr(  oo4tetnmfcildfa2eluvo;()treomf totlm r u o;s)setrxm oo4omenlnct ( a2trxmont4oeeoii3iyd aDra(mo u) rerircta1lmD  ivo;(0 2uo(mpoudap  livsasf Dur( o;t0tlxomfeiydfaDrlu p;t0arenxr ia1fm eai ils)srxo(rpnodlm nlicils) 2ua( o;o4oexnmieiltlmDuau ont0tltnmrctodop e ivs;( texmxr3nu4amt livt (  rum(r ou4alt  o3iytlsDrmn s;u0alenifcoa1om ean s ()sexr(mpoo4lltnlncsa()s2tm(rooo0aptoii3iltfsDelnvo t)artnio3iytfmt  uesls0s2umxr3oudoptnlfesa(  2rm(monu1tex  f3tys a emu o;t)altnxr totop r uvo;t) 2xmir oudamte ivsl()srur(  ou0tltomiciytfmDemn o;(4altrioctadlm   ieol(0 ruoxm3oo4ll e feslsf Dtm(rono4aetnmfctysfa emuvo;t)alxrxrciodlptrau i;s trum(m io1ape mfesasfs2umur ou1oexo ociys s2rmuvont)treoif3io1om elu o;()tetr(opou1lm  lnvsasfarumxmp;u0openmocilsfa ulums;(0artoir3tydoat  ivs t)sexoxm3iudlp elnctls sDtmumpnu4aeenmfetadfmDuln p u4tetrxr3oytomtrln s;(0seumxm nydam emfctls)sDurxrpot1apxomo3tltla2el(vsnt0tltomrcio1op  au i;t trxrxopnudlmen ivsas s2tmx  ou0aleoii3tytlsDelnmp (4tetomrcoodfaDe n s t0setmirpoo1oleelict tfsrrrx p;u0aeeomf3iyslmDrlnvs;() rtoif3to1omteliei;s) exr(o3iu1am nlnetlsfa2trxrono0olt  oetldfaDeln o u)teeoxf ta1fat  uvo;t)trumim oydaptn ieils)a2umumpoo4ale iietadfs2em(vo t)alenmr3iotlaDelu slt) euo(o no1ame mies ( a2uru pot1apto fetat s2ranvp t0 renxf oo1fp  aivi;t0 rumio3iodol  mfetls srrrxr nt4aexnmoetld s2um( on()trerxocty1laD anvs t sruoxrpnu1olt lics t)a2raxm oo4tlxnii3iadlaDeln pn(0trtnmo3ootlpteai il()t2tmir3oy4al  lfcsa(fa2um(  oo1aexniieiysfm rl( ont) ltnxf3iy1oaDrlneo;(0trur(opiydlme liet (faDrrx  ;t1aex mf3tas m uan on(4teermfcio1lpt li o t srxrirpoy4apenmnvils)s2umu o;u0olt iictydla2elu s ()aeeoio3to1lmD an o t)srxmxo3oudopenmietlsf Dtaurp;u4aptnmictatlm2elu pnu4alxoio tytfp elnvsls s2tm(m3ou1op   nvta()a2rmx p;o4tptoifctltlsDul(mo;t)aetrxf oydopDe nes;t t2urxo3iy4apen ncsat) Dtmumpnt0tpeniictyd mDuluvont4tetrio3iytom  aueil( texmim no1opeemiet s aDtrxmoot0opxn fcilslm rlnvo ()trerifciytlm eluei;t  rtmiopio1apeemnei tfa2umx o;o4opx mfeiyt m ul( p u)tetnmo3ta1lmD livo () 2xmxo oudomte neiat) rtmumoou4alxoiiciatlm2em(vsnu)texnxfciy1fpteaiei (  exrio3nodomeelieilsf Draxr ou4opx ii3iltfs2emn p;(4aexnirciydlpt luei;(0s2xmxm iu1apt  iet t  rrmxrpoo0oleomietys aDemnvp (4 leoxf iytop elneslt srtrxrpny4amt livtas) Drmu pnu1openifetaslm2rmuvpn() lxoxrctatomtrauvsls0 2xo(opiu4alenlncslt)artm(rp;u0tetomfetltlaDemumonu0 eeomr3oytlm e u i;t t2tmim3oydap elncsl()aDraum nt4oleo iciydfs2uln o;t)aexoxo to1fmtelieolt) rtmxopno1amtn fvtl( s2raump;o1opxo fcildfmDum( s t0 lxoir oy1fat  neo s)trtoio3oy1ap emfvi ( sDua( p;t0oetn ieiydlmDrluvo;t) exoxf ta1fp   u ilt)tetmimpny4al n fvtls  2ur(  ou0tpe  i3ils a emump (4aetrxo iytfptrlnvo t) 2xoio3oo4lmt lics (faDurx oou1ape miciadlm ua(vp;(4trxnxo3ia1la eaieol()trurxm3oodame  feiltf 2rmump;o4tlt iieildfsDrmnvonu4arenir oo1oaDrluvols  euoim nudap elieilt srtrxm nu1tptniocilt s ra(mon()aexnxrciotlmD ln sl()teur(m no4aptnmfvtls sDrau  ou0ale  ietysfa2ulnvs u)aetrmo ia1fmtraues;s)setoxm oo4optnmnei s) rta(r ot0tptnmieiat s uanvs;u4 lxnir iy1fpDrlivs s teumimpiu1omte ics s s2urumono0tpe miciasfmDrl(mp u) ltnxociy1oate nvs;s  2toxmpny4aptelnctlt)arta(mp;u0oexoif3ias s2raumo;t)aexoif3iydoat  ivo;s0seumimpnydll n fviat) rtrxmo;o4apxomfciydlaDrl(mp (0 exnio3io1opDeaieolt)s2tmir3ou4amtelfvta( aDrmurpnu4olx mocild sDrauvpnu0teeoxfcoodfpteluvs ( t2tm(r3iy1ap   ivsl( a2ta(r ot4alt  feildfmDea(mp;u4tltomr3oodfatrau s;(0srumxrpiy1omenlfviltfaDuru pou0tex mieiltfa emuvsn(4 rxnxr oy1fmDeaivols0 2xo(mpiy4amtelnvtat)a2rrxr ou1teto f3ildlsDua( p (4 rtrio tytoa rluvsl(0texoirpiy1am   ncia() rtr(mpot4alen ieils sDulu snu4tlerifcoa1oa r n s t t2tr(r iudllt mfcslt srra(  ;o1olx io3tydla uluvs u)alxrmfciatlm e u o;t)t2xrxmpoydamtemfvsl(faDuaxmo;u0opxnifciyd mDumuvp u) etomo io1fa raneslt  2um(m iudapee neslsf Duaumoot0tptomoetas aDea( pnu4 lxrmf iytlaD  iei t) 2um(rpiu4llt mnvi s)srrrxmpnt1oleoifctaslm eanvo;(4 rxnmr iotlmt  u s;s0s2umxo iodlp elfetltf Dumuro;u1oex iictltfmDemuvs (0arenio oa1lateauvi;t) exo(r oy1lpt  ieiasf Dtm(rpot0oleo oetltlm uan pn(4trxrxo ia1fm  aivi;(0seumir no1ll e ics (faDrru ont1aetomictls sDrmnvon(0 eenmrctatfptr uesls) eurir oudllte fctlt)sDrr(mo;u0openioetytlsDul(mp;t)alenmo oadlm rlu il(0 rtrio io1olenmnvsas artrxmonu0olen i3tydfa2elums;(4 rtnmo3oydlmtr nes (  2trim oo4ol nlncilt  2ra(mo;u0opxn ieiytlmDrlnmpnt4artnio iydlpD  neslt)texrxr3ou4aptemieia(f rtru  ot1oltnmo3tys aDumuvs;u)tltnxocty1lpt  u s;s teuo(r oodllt mfeia()sDur(mpot1tlt iictldfmDel(vp;u)areoir3oa1laD ln ols  eurxmpoodlp n nvia( aDumxrpot1tetnifciltls2el( o;u4tltoxrctotopDranvilt)t2xriopiu1lp  lnesl() rra(mpnu1opt iieiatfm2elnms;(0texrmociadom  luvo;s srxoxo3nu4omtelfcsatfsDrmxrooo1alx  o3iasfmDum( onu4trxnmr oa1opDrlu i t)s2urio3oydop nmfetat)a2rrum ;o0oeeo ocils sDeln on() lxoifciotfm e nvi t) etoim3iudlmtnlncta()sDtr(rp;o4texniieiatlmDuluvon(0trtnxf oytoaDeaivolt0 rxrir3iydlmenlieta(  rrmu pno1oetoiictlt a2ua(vo t0teenmo3oytlaDelu s;s0s2uoxm ny1op  lfeslt)arta(  ou1oltomocias m2rmumsnu4 rxrxf3oadlp eaneils0srxr(opiydlmtnlfcils)srumumpno4aeenmfeiltfsDrlnvsnu4alxnxr3oytlmDeanvs;t tetrxr iu1altemfetasfa2rrxrpoo1oltnmfetlt aDemuvonu0tetnxr iytfmDraneilt0seto(m3no4am  lnetas)aDrauro;u1oleomictatfs2umuvo t) etrmo to1lptranvil() rtrim3ny1ale mietas)srua(  ;t0tpeomictys sDemumon()texrxr oydla e uvs t)seuo(mpno4om nmiet (  rtm(  oo4oltnmiciatls ra(mo u)texnmf tytop elivo (0seur(opny4opte fei t) 2rrumpoo0tptnif3tas a2rmnvs (0texnxr oytopt liei;t0seurim oo4al elfet sf Dur(rpoo1aee miciys a2em(vo;u0aetnxoctatoa eai i;s0t2uo(opoodllt  ncsl() Dtruroot0tltnio3iydfaDra( o u)teerxf todlp e i ilt  rumxm oo1lmenmieslt sDurxm nu1ale mfctyd sDeluvo () eerxfcoydla   i s;t) etmim no1lp n nvi t)srrr(  ;u4teeoioctyslsDrauvs t)alenir iotop raneo;t trumio oy4op e nctas)aDraxm ;o0tltnmo3iadfm2ul(mp t)aeenmf to1fmD luvols trum(rpnu1lp nlivtlt) 2rrx  nt4oet  octad s2rluvp;t0trxnxo3tydomtraivi (0trxoxr ny4al  mfes (  Dtrxm ;o1tet moctytlmDelumont0tlermfctytoatelieilt  eto(mpno4llenlfctat) Drru  ot4tpxomietlsla2eauvs;t0 rxnxo iadlmDe uvol(0tetoxm nu4opt lieilsfa2urxm ;o0oltomoetasfs em( p;u0 lxnmo iatfaD liei;s) rtoim3oo1op elncsa()sDrmxronu1tpto fciysfsDumuvpnt4arenxocoydoa rlieo t  2toxo nu1om nlfvils)artru onu4tle mociaslmDelu pnu0 exnmocoo1fat  ivi s0t2xmxr ou1al e fvt (  rtauro;t0olx ioctytfm2rl(mo;u0aexrxo iydfaDr u ils teuoxrpnodol   fvi (faDtrxr ot0aetniietldfs2ra(vp t0aexoir3iy1lpte uvi;t0seur(o nydlm emfviat aDrauronu1opxo octasfm ran snu) eenxr to1fmt aies s  rtoiopoudom emivtas  rrrurpnu4oet mfeilsla2rauvpnu0 lxomr todfp e u s;t0trtr(o nodlpt lici (fs2rrumpou4opt io3iltfm2elnms;(4aetrif ia1omDean sl(0texmiopiodlmeelict t a2taum oo4aex  fctysla uln pnu4 lxrmf3iotlp eli ils0sexoxo no4lmtn netlsfa2urum ;t1aetnif3iydfm2el(vont)tltnmoctatfmDr ieo;() 2tm(o3nu1op  mnvilsfartru pou0oetnif3iydla2elumo;t)altrio3oydlmDeluei t)t2um(r3nydop  miet ()sDtax  no1tptomi3tas s umumo t)altoirctydoaDrli s t0srurirpoo4lmt mieilsfaDuau  ;t1aex io3iys mDemu p () ltnmocoa1la rluvi s0tetr(o3oy1ap e ietat) 2rax o;o4tetnmietys a ulump (4 rxoxf ta1om   ueo;s  eurim oudame mneia()srua(mpnt1opt  feiatfaDul( p t4aeenio oatlptr ueo (0teumxopny4amenlicil() 2trur ;o4alxoioctydla rmu o t4alxoxo iy1lmD ai i t0 rum(m no4lm  mnctls) 2raurpoo4tet  ietyt aDrl(mont4trtoxr3oy1fate i o (0srxrir ny1apen netl(f 2tm(r nt4opto o3tad mDrmums;u)altoircootfmDelnei;t0s2xmxr iu4altemfesatfa2ur(moou1teeoifetyt s2uauvo u) etrxr tydomDeaivol( srxmim ou1open nvil()srtr(r no0olxomoeias aDrluvs t)aeerxo3ia1fp   n i;t trurir no1ap n nvs ()s2trump;o4tltnmoetadlm2emn p;u4arxomo ty1om r nvo;s0trxriopiydlpee icsl(  Dtr( ono0opt mfctasfm2emums (4 lerir3tytopD lnvs;t)trxrxo nydoptnlieiatfsDta(mpnt4apeomietysfa2elnmp ()trerir iytlpDelues t)srxo(m3nu1llt mfetltfa2rax  nu1tee  o3tadlm2rln pn(4altoxocty1lm   uvi ( srxoxo nudol elivtas srtr(ro;o4ole moeiatlmDrm( p;(4tlxrxrcoo1lmDeln o t) 2umim iy4apenmfetat artaurooo1aet micild a uau pnu4texrmo3oydfptranvo s0 2xo(mpoudlmtn ieta( srtmx ooo0tpx ifetadlm uan pn(0 rxrxo3ty1omt lu ils0seuoxrpnudlpte ncsl()s2urur ;t4aee iociad sDum(mont)areomr3oodfaDran o;s)s2xmirpoudlm emfes t)artmxr ou0aex mociydlm2rm(vo u0aetoio3ia1om  lnvs s srtm(opoo1amenmfcsls)sDrax ooo4alxoifciasfs2rmn p u4trtoxocty1fptrlneo t t2um(m3iy4ameelfciat sDur(root0optnmf3ild s umuvsn(0alenir tatfpDr u o;t0seum(r ny4ll nlnviasf rum(r ou4oexomf3ildlsDeauvpnt)artnmf3tydla r i i s0s2uo(m3ny1om elivtls aDtmu ono1tle if3tadlaDulnvsnu4alxomr3oydlat  ivo;t0s2xoirpoo1om nlfvtl(faDraxmpou0tlto f3iadla ea(mp u4 ltomr oy1fmte ueolt0seuo(rpiudam  lnct s)srrm( poo4tlxnmo3iasfm emump;t0tlxnmrctotoa eli s (0texoio iy4lptn ieta() rtmurooo4aleomfcildfa2ul(ms u4arxnmrctotfpt luvs (0 2xrxo3oudapeemicils sDtr(r oo0apt iocildlsDuau s u)texrif3ty1lpD  ieo;t)sruriopou4lp  miesl()srrmxm nu4altoioctldfmDel(vs;u) rtnmfcoadfmD  i o s)s2umiopny4ameemietlt) rta(mooo4opxn fcils mDrauvo;t4trenif oy1fmt  ieolt  rxr(opoodapen fes tf 2umu ooo1opx if3tlsfm eanvpnu0aleoxoctadoa rlnei ()teumim nu4llt lfvs s srtrxm ou1oeeo fctasfm2eau pn(0aetoirctatom e ieo;s)texrxm3iy4apt lnes ()a2raxmpot4optomociydlaDea(mo;t4tltnirciy1fate ivo t  exmxr iudamen fcil(f Drrxr nt1altnmieiadfm ra( pnu0 rerxo tatfpDelu ols0seurxo3io1lltemnes () rtru  no0tee mociadfm eaump;t4trerxf oodfmDrlnes t)s2tm(mpoudlm n icsasf rtaurono0apt miciltls2um(vp;u)tlxrxr io1oaDrlneo ( srtoxrpnydoleelfesls) 2rau pnu1tpen iciyd aDumuvon(4alenxo oadfpt lueols  rxmxr io4ale mneil(f ruau ont4tpt moeilsfa2um( pn()aexrxf todom  lneo s) 2toim oydoptelnciltfa2ra(  oo4apx miciltlm em(mp t) leoxo3ta1lmt lnvil()setr(opiydome micils)a2um( p;o4tltomf3ilslaDrlnvo u)tetnmr3ty1fa rluei;() etmxopoydllenlfeiasf rrm(r ot4apto feils m2raumo (0tleoxrcta1lptelu i ()seumimpiu4apeelnes () rta(r ou4tex  o3ilslaDrlumsn()altomociodoateaivol(0s2toiopnudal n nvtlsfa2uaumpou1ope  ieilslm eauvo;(4tetrxf oa1opte nvs;t  2xm(r no4amt mfei sf rrrum no0aee  feilt a2emnvs (4arxrio iotop  lnvol( teuoiopiydaltemics t  2rr(rpot1oeen o3iydfsDuanmonu0 etomr3ia1la elneol(  2xoio3nu4amtemictltfaDtaxrpno0oex if3iad a rlnmonu0 rxoiocoadfm rauvs;s  rtr(o iydlm emicsatfaDraump;o4oltn iciyslm2rmnms;t) lerirctotoat lnes;s)srtoim oy1oltn ies tf rtrx ono1apeoio3iasls2um(mon(0 exrircta1fp ean ilt)t2uo(opoydoptn fvt t) 2rr(m no1ape  oeiltlm2ea(vonu)tlerxocoa1faD  uvo s seurim3iu4lmt mfctltfsDrmu  nu4oltn ieiys mDrlnvp;t0tlxrif3iy1la rluvi;( sruoxr oydape mict s  Drrumo;o4ope mfctyd aDemn p;t) etoxrctytoaDelneilt0t2xo(mpoy4lpt lnes ()srtr( o;t4ope  octadfmDra(mon(0 leoxf3oytop ean i;(0 eumxrpoudamt lnvsls)s2uaxrpnu1aeeniiciyd s2rmuvo;(4alxrif3ootlpD anvi;() etm(rpoo4alte neias)sDraumpou4aeto iciadla2eauvp u0artnxocoo1fm elies () etm(rpiudolee ncia(  2uaump;o0ope  oeiadfaDem(vp t4aexnxoctytfatr uvi;s0s2uoiopiy1om nmivi t) rrrxmoot0tptniietld m eanvs u0tltomr3iodfmDe ieo;(0t2xo(m iy4amt  nesa()sDurxm ot0oetnmietldfm2rmu s;(0tltnmf todfmD aivi t)srurxo3io4op emfcsls)s2umurpou4tee  iciytlmDelumo;u) rxoxr iatfpD  nvo;t0 exoimpnu1lm n fvilt)a2tmx onu0tetnmo3iatfs2rlnms t0teerio3tydoa eaivi s sruoxm nu1lpee fcs ()arrmxr nt0optn o3iytla uaump;(4 ltrifciodoa eau ilt0 2trxr nu1llt lics t)sDtr( o;o1tpxoiictas s elu pn()arenif3tatoptelu s;t  2tmxrpiu4am elfvsltf 2rr( pot4aetnmieildlmDua(mpnu0artomfctytfp rln s s0srxoim3iydlme  fvtlt aDrr( ono0aet mociadla2rmnmp;t4texnio3to1lp rauvslt  2xrir ny4omenmnvs t sDtmxrpnu4aexn oetld s rm(vo u)teeomf ta1fmDeauvi s)srxrirpiydam eliesltfsDumumpot1aleniieildfmDuanmo;t)aetoir iodlaDe u o;( setmir oydlpe  ncsl(fsrtru o;o4tlenio3tltlsDeaumsnt4trxnxo ia1faDr ueo;s0trxmirpiodlptn ivtl(fa2umumont1apxoifetytlaDeaumonu) leoifciy1laDean s;s  ruo(opoodap nlnci sfarrax o;o4tltnmf3iadla2ulnmo t) renmf iatfatr i ilt0 euo(o3oudlmeelnetasfsDrm(rp;t0oltoifeilslm emnvo;u0 ltnmo tatlpt  n o;t0s2uo(r no1am e iet s) 2tmxmo;o0oex moeiytlm2raums u)aeeomr3oy1fmtrln ils0tetmxr3io1ole mivt s s2umxmpoo0apenioeiasfm2uau o t) eenmr3oydlmD ln sls)tetm(r3iy1ap elietlsf 2ra(m ou1apxoifeilt s uluvpn()tltnmo iy1omte u sls srtrxr3ny1ome lfesa()aDtaxmo;t1aleoioctyd a2uaums;t0aetnmo3iy1fm rln s;( sexrim3nodalt lnvsat) 2rm(monu1olenmfetyslsDeln s u)texnxoctadlate nvo ()srtoimpno1oltelieta()a2tr( pnu0aptnmfeiatls2ulu s t4 eerircoa1om  aies ( srtr(o3oy1ame micia(fsrua( onu1tlx mf3tatlm2umn s (0tlxnxo todom   i o (0s2uo(r iudll emiciat arraum ;o0altomo3ilslm eln on()tlermr iotfa  aieols)srum(o oo1am emnviat srrm( onu4opeoif3iyt a emnmon(4trenio oy1lm eluvi s  euoxmpoo4alt mfcs t a2rmxr ot0olxoifeilt s2ulnmont0tltoxrcoytfaDeluvslt0srtoxopny1apt lnvta( a2rmx ooo4opto o3iyd sDraumo ()tltrmfcoydfat  iei;t  rur(r3nu4ap emiei sf 2uaump;t0ope mocilt aDum( o;(4trxoxf3oytfpDe nvs t) 2to(r oy4altn iesas)s2tmumo;t0opeo f3iys s ranms;(4 exnxf3io1la ean s;s)trtmxrpiy1lp nmncilt s2urx pot0tpeoif3iyt m2ulump;u0trxoif oatlpteli i;s0seto(opiodam elnciatf Dtrum nt4oltn ietlt aDul(mon(4 exoxo todlatelnvo;t0 rumim3iydapt lfcs tfa2tr(r no4tpx ifciytlm2ul(mpn()tlenxr3iytom eln olt teur(m iu1ol   nei tfsDrax p;o4alenmfcildfmDulnms;t4 leomo3totlmDraueo;s0srur(r io1ol  mivi s sDtrx  ;u4oexn o3iyd s umnmo;u0artriocoa1fpt  uei;s  2tr(rpiy1al nlnvs tfa2tm(rpno1tpto oetysla rlnvpn(0tetnmf3tatfmD  nvsls seuoirpio1ap  mfvtl(  Dtr( pnu4apxnio3iltfaDumumon(4altrifctatfp r u s;s0 euoxr io1omte iciltfs2tm(ro;o4olxn i3tyt sDemnmo;t4 renmo3iotfa  ln sls0srur(mpny4lle lneil(fsrtm(  ;t4ope mo3tytfm2umu s;(0trxoir3oo1oatrliei ()srxrimpoodlp n ivi t artrxmp;t1aptn ietld s em(vp;()aeenxr oadlaDrau i s0trxoxo3nudam nmfvil()sDuau  ;o0opt mi3tatfm rmnmp;t4 lxrmf todfm eai o;(0t2umir3oo4oltelnvi t s2trurpnt1aet  o3iysla um(ms t4 rxoxf3ty1opDe ueolt seto(mpoy4apteliciat  Dtr(r nt1altniictys a rl(ms;u0arxnmfctodoa  lueo;(0texoxo iudol  lfvtat)a2tax pnu0apxnmf3iasla2rmnvsnt0aetrir iodfptelies;s)s2tm(r iudame  nvsa(f Duaxmp;t1ole  oeild s eaumo (0alxnxrctytfpte u o;(0tetoio oodopenmnei s  Drax ooo4alt  i3ilt a uauvsnt4 etrmr iotfm  lnvils setoxo3iydam   nvs (  rrm(mpot0olxoioeiad m2eln o;u) leomfcoadfmD  ivo;( teurimpnodll   nvi t)s2tmxmpoo4tpxomoctysfaDelnmont)altrmr3iatopD  ueo;s t2xr(m iu1lmenmfvil( s2raxm oo4aleo ietaslm rmnmpnu4trxnxo3iydlpD  nvolt0trtoxm ny1lmee fvias srrmu  ou1ole ifciad s ranvo;u4teenio oy1fpD  n i;t0t2tr(mpno1amtn nvils s2raxrpnu1oexn i3iydfa eau p;(0arxnmoctatomDeai s;() rumxrpio1aptnmfviat  2umx p;o4alx  feiytla eau snt0tlerxo3oatoat luvi t) rurxopiu1am n ieilt)s2rmum ;o1olxnifciyd m2raumpn()artrxrcoy1fpDrln il(  2xmxopio1lmeemfvsat srrruro;t0opxoii3ilsla2uln s (4alxomr3iadfptelivo s0teurim ny1lm n feilsfartr( pnu1opx mf3tatfm rmn pnu) leoxo3oo1oaDeanvs t  rtrxr3iydlltelfviasfarraxrono1ale  fcilt sDuauvo;t4 etomf3tatlatraivslt) 2tmio3ny1amenmfvs sfaDumx o;t0texomoetlslm2ea( p t4 eenxoctotom ranvols srurim oo4om nlfvtas)s2ta( pnu4apen iciyt s2rmu p;u4 rxnxf3oy1fmD livo s0 2xrxrpio1lp nlfeiat)srrrxronu4altnmfetatfa emn o t4treoirciadop elueslt0trtrio ou4optelncsl()sDuau  ;o1opxn ieiaslm elumo;u)alenir totopDraueo;s t2tr(m iydopt  fvtl(fa2tr(m oo0apeniociydlm rmumont4trxrif oa1fmD li ils)texoirpoy4op nmncil() rrrxroou1oltnmoeiadls umuvo;t) lxoxf3totoaDeaivs;s srtrxo nydlmtnlietat)s2uru pot0oet  icils mDeau s;(0 exrifcoydla  aivs () exo(opio4alte fcilt aruax poo4tlx iieiad m2ulumo;u) lxomo3oy1oa   uvols tetrio ou1llt lnctls)s2ta(  ;o1tex  fciydfm ul( pnt)trxnxf oodlm  aieils)s2xo(o ou4om emfvtat a2tau pou0apxn feiadfa2ul( p ()aetomf3oo1omtran ols) 2uoir nu1omeemfcs t)s2umxmo;t0aetn i3iatlm uln s;t0tlxriociatfp ranvo;s s2trim no4om elnvt (  2ur(rpnt0oltoioetatla uan s;(0 rtomf iydoaDeaues s  2umxopiu4lltnmnvi s)a2ta(  ot0aeeomo3iyd s eaump u) eeomf3io1faD liei;(0srxrirpiydape  ici (  Durum ot1tex  oeiadfmDua(ms t)teermr3to1lmteaivo;t)t2xoim3nu1lltelfct (fsDuaumpoo1oltoiociysfs rmumonu4 rtoif3tydla   nesl( t2xrxo3iodamtnmieilt)arurxroou4aex iictydlm2rmu s u4aeeoifcia1opDrln ol(0t2tmxr3iu1ol nlivi tfaDtmx  oo1oeenioetydls ulu p u)tetoir3oodfp elueolt0srxm(o oudom nmfvtas)sruaxm oo0tlen f3iltlsDrmu ont0aetrir3oy1lpDrlu i;t)setr(m oydapee ics tfs2um(  ;o4opeoiociad m2uanvsnt4arxoxociadfmt an ol()t2urxrpiy4optnlfeilt)sDta(rpoo1olx ioeiysfsDem( p;u) etoxo3ootopt  neol()texoio io4llen fetlt)aDra(r ;u1tpx moctydfsDrm(vs;()tetoio3iatoaDelues;t)s2tr(o3no4amtemivslsfa2raur ou1optn fciadfs2rm(mo;(4 reoif oydoptr neo;s  2xrim io4apt  fvtlt)sDumx o;o0tlx  fetltla2ea( sn(4teeniociy1lmteaivo;(0trxr(m3oo4lpe lfvslsfaDtau onu1ape moetlslaDrlnvp;(4 lxnmocta1lpt an i t) rxr(o3oo1alenmicsa()aruau o;u1tpe mi3tydfs um(mp t4texnmo3oytoa rauesl(0sruoio3oy4ol  mfvsat)sDtr(mo;u0olenmociat mDelnvs;u0 etoiocoytlpDe uvo (0 eto(m nu4oleelfvt ( s2umxmpot1aex mo3iadfaDeanmp (0 eermo oatlp elnvilt0t2uoiopio4olt lfesltfs2tmuroou4altnioeiadfmDuln pnt0tlerif3oo1lat  nvs (  2xrxopoodlmtn net (faDtr( pnt0oexoifciyslsDel(mpn()tltnmfciy1lp eaiei s  2xr(m ny4al eliei s)srur(ro;u1tpto o3tysfa2um(vsnu0tlxrxf tadlm  ai ilt)seumxm3io4omte feta(fa2rrx pot4oexomf3iatfs emuvp () rxrir3iydlm e ues;t) rxrio3io4omte nciat) Drmu  oo1tee mi3iys sDem( s;u0 ltoircoy1lat  nei;( texm(r3no1oleemnvs s)a2uau onu1teto fciatfs ea( snu0tlenmf oy1lp e nvo s) ruo(o no4lpe mnct tfa2uau  ot1aexnifeiat mDelnmsn()tlenmf oydoaDraues;s teurxo3iodamtnmietls srururo;t1alxn i3tadfm um(vo;t0aexnxrciy1oa  li slt)trxm(r iy4lm   ivsat)aDtaxrooo1tpx  i3iydlaDeanvp;t0 rerxrciadfm eanes;(0trtr(rpnydape  iet t)srtmur ;o0apenmieilsla rlnms;(4 rtoifcty1oat an il()t2urirpiy4omtnlfvils aDtau ono1alx  oetasfa rl( pn(4 rtrmr3oytopDr n o t)srurxmpou4oltnlivils)s2raxront1oetnmfciytla ranvs;t0tltoxo3ootlptrluei t0srtoirpiu4op nmivt (fsDtaxr nt1olxn ictysla2umu p ()arxnxr3totla rau i;s)t2uriopio4lm   nctat)sruru o;u0tpx  feiatfs rl(msn()arxnxf3ty1fat  iei ( t2trxr nydlleelfvtas)aDtru  ;o1oeto oeiysfa emumpnu4 lerxfctotfa raieils  exriopiudamtnmfvsa() rtmu  ou1oeeoiietatlm umuvp u4tlxoxr iatlmDr u i s) rtmiopiu4amt  ietl(fsrumxmo;t1aleoioeiysla rau p t4alxrxr3oatfm  ln ils t2tr(opiu1lpeemici t) Dum(  ot0tlxnmo3tys mDraumon(4 rxnxr ia1lmDrlnei;( tetoxmpiu4apeemneta(f 2ur(rpnt1tpxnmfeiysfmDemums u)aleoxf3totomt li s t trxmxo3ny4optnmivil(fsDtrxmpnt0oetnioeild a uan p;u4 rermf tadfaD  ueil(0sexm(o iy1lp  mfeilt)a2rmx  no0aeeoifctatfsDua(vp;u)texnmf3iadfp r iesls)seto(r3oo4ap nliesl()sDumu p;o4alxoifeiyd aDul(ms t0 lenmociotlmt  uvi;t)tetmio3iudaltnlnvs ()a2ra(rooo1oeto f3iltfaDrmumpnt0trenioctydom eaivi t sexmirpnodomeemnct t aDurxr nu1aptniiciad sDran pnu4arenmfcta1la  lies t)trumxm3ny4amtnmfcsls)a2rau p;t0alen ictltfa em( o u0 rxrmf ia1fm r ivi (0sexoxr3oydopt mnvsat) Dta( ono1ope mfcias s2ul(vp;t) exoxr3todop  lu slt) etmiopoy1am elfeslt) 2tmumpot0olx if3iydfa2rlnvp t)aexomr oadoptelieslt0 2umio3oo4lp elfvia() 2tm(m nu1tpt ifctydfsDrmuvp () rtnif oatfmDeaues (0 exoxm no4lleemnvsat  Draurpno0aexniiciyd m eluvs;t0teenifcootlm rlu o (0 rtr(mpoudale  ict sfa2ta(r ot0olxnioetydlaDrlump;u)teeoioctodomDeanvilt  rurimpiudlpeemfvtls)sruaxmp;t1oex ifctyd aDua( onu) ltrxr oa1lmDraivi (0t2tm(r3nu4lm nlncsat  Dua(rp;t4opeo o3tat s rlumo (0 ltoif3oy1faDe nes;(  etm(m3oy1ol  mnvtas) 2umx onu0tpe mi3iyd a el(vpnt)tlxoiociatfaD luvils)seuo(o nu4lme  ivs s aDtr(rpnu0opeoii3iysfs emuvsn(0 rerxf oatfpt lu s t0seuoxm3iu4lmen neta(f Drm(mont0teenmf3iyd s rlnvo u)trtnio oodoaDeaivo t0setoxo nu4oltemfvtlt  Drmu poo1olxoif3tasfa2rm(vp;t0trxrxr tydomDeli ol()s2xmio3no1altnlncsas)sDra(root4tpxomocilsfa2umnvsnt0tlerxo ta1lmD  neol(0 2tm(opoy1oltnlietls) rua(  ;u0oeeo o3tyd s eanmo t4teeoio3ootlpDeli ilt0s2xrxo3oo1ol   nvi s  rtau pnt1tee iieiatls2rmnvpnt4treoxrctytoaDeau o (  rxoiopiy1lp elfctat  rur(rooo0aet ioeildfa rm(vp u0tlerxr ootla rluesl(  rtoxm io1alt mnetl(fsrrmumpno1tpeo fcilsfm umnmpn(4teenir ootlptrlnvi s0 rtrxr3oy1lm nmivi ( s2trx p;u4opxnmo3taslm elnms;(4aleomfciadlpD lnvolt0texm(m3ou1al  mnvtl(fartr(rp;t0tlxniietad mDrauvsn()texnxrcta1lpD luvs t)sexrxr3io1apeelncilt srrrxr nt0tlx  ieiyt s ulump (4tlermocoodoa eaues ( tetm(m oydoltelivtl()sDta(rpnt1alt ii3iadls2elumo;u4tlxrxr iydomte neil(  rxrimpnu4lm   neil(fsDtr(rpnu0apx ioeiydlaDrm(mp;() lxrxr iytopte uei ( tetoio3ou4om  lnci tfsrtmuro;t4tltn f3iyd a emums;(4arenxf3ty1oaDe neo;t)trumir oy1opt  nesa()a2ta(  ;o0oexomfcias a2ra( o u4trxnxrcoodfptraueol( setmxrpiu1lm n iesl(fartrxr oo0opto f3iad a ea( sn(4 rtnxr oydfpDraueo;(0 rurxopiy4lpe  ivt t)sDua(root1apenio3tldfm ul(vpnu4aetnir totfp rlu il(0 etmio oodol elnvtl()aDtax o;u4tlx mi3tytfaDeanmpn(0arerif3oadlaD auvo t)t2uoxo3no4ll  mieta(fa2ua(r nu1altnmictat aDul( s;()altnmo tadlp eanvi;s s2xoxr oy4ope miet (f 2rrx  no1ape iociatfs2rmums;t0 exrir tadfp   neil(0 etoio oudomenmfcsls)s2umu onu4ape  ieiytla rl(vsnt)texomfctydfaDr ivolt0s2urirpno1lp nmics (  2ur(monu0oleo fetldfa2ea(mp;() rtoif3iytla raneolt) rur(m nodopeemivsls srtr( pno1ope ioetls a rlumo;u0arenmo3oodlm rauei;s)setmir oudlm nmieil(  rurump;t1apx iocildls ra(vo;u4 rxnmr iy1optran i;s s2uoiopou1om nlfetls  rtr( poo1altomi3tat aDelnms t)alxnifcoa1fa   nvolt0 2trxopoy1openmfvi () 2ta(r ot0oltn oeiysfs2ul(vo ()tleoir3tatfp rln o;(  euoir3oodol nlncil()arraurp;t0oee iocildlm2uln s;t)aetnxf oodla r i i;(0s2um(opno4op  livias) Dur(  nt1ape mfeils m2rm( o (0altnmrcoo1fp   n sl(  2xm(mpnu4ape lncias  2raumono0alto ocilt aDranms () rtnmr todoa elnvilt0 rtmirpno4al  mieslt  ruau  ;o0aptoiiciydlm2elumpnt)teenxf oa1lm r u o t0 2xoim3iudol e fvsa( sDraur no0teeomietytlm2emu p;t) lenxr iadfatean sl(0 rumio oydom emfcsa() 2uauroou4tlt mf3tldfa2rlnvp u)tltnxfcia1latelneo;t)trtoimpoo4ol  mivta()arrmxr ot1altn feiyd a2rmu o ()alerxocto1opD ln i (0teto(m oy4om nliet sfs2taxrpot4aleomfeiyt a2uln o u4 lxrmf3ty1fmDr i olt0sexrim oy1op nmncs ()artax onu0oeto o3tld a2eln pnt4 reoif3ta1la rlivslt) ruoxo3iy4ll elnet ()a2ta(r ou0tpxo ocilslm2ul(vpnu0 ltrif oydfmDr n olt srum(m oodal   fctas  Drru oou1teen ieiyslm2rm(vpnu4 ltnio oodfaDrluei t0tetrxr3nodop emicsa()s2raurpno1ole  f3tat s2rauvs u0trtnxo iadlpDelieol( trxoxmpou1om nlicsl() Dtm(r oo4tpxo ietlsfm2uan on()alxnmr3totlpDelnvo ()trtrir io4omt micilt  Dtruronu4olt  f3tysfsDelu o (0tetnmf3iytopt ln ilt0trxmxmpoo1apeelnvi s)sDrmxrooo0tlt mfcildfa2ua( s u)altnxf iadfmt lu o t)trtoio3no4apeelnesa()a2tmxr ou4tlt mfeiydlaDemnmo t) exrmf3ta1oa r uvs ()srtoio oudop  mfei () Dtaxr ot0oet iocildfs2elnvs;t)artnxf3iydfaDeau s t0t2toimpnu4ame  ivtasf Dua(ronu0tpt  feiydfa2umnvp;(4aetomo iydfp eanvo s0 rtm(m oudaptn fei sfs2uax  no4alto i3iasla umnmp u4tetnmrcoadlm r ivsls0s2xr(m ny4lm elneiat)a2rrxmp;o1tlt mfciad a ulnms;(0 lxomf totlmteauvslt0teto(r oydalee ics () Duau oot0olt  fcildfa2ul(vo;() exnmocootfp rluvo;t sexmxr3nodllen icils s2tmx pot0aptnifcilt m ul(vs u4arerxf3totopD  ues;t srur(opno4omt mnet s srraump;t4opxoiiciaslm ulnvon()treomo oatfpDeanvo s0truoxr oydlpe mivilt)srta(  ou1tlt  i3tytfm2uau pnt0 ltoir3to1fmtr n s;s) 2trxopou4lpte fcs sfsDrau pnu0texniiciltfs2eluvo;u)alxoif3ootom elnvo s) rxoimpoodoleemfesl(f rrrx oot4olt  iciasfs2rau sn(4 rxoif3todfm raueo;s teur(rpny1omt lfesas) 2tru p;u4oltnmictatfa2ua(mon(0aetnir3tytfa eai ol()trtm(o3oo4omt lnei (f 2rr(mo;o1optnii3ild mDua(mo u0artomo3iadfpteaivo t srxmxm ou4op  lnvsl()a2taxr oo1tleomociadfaDem( p u) lxoio3iadfp   uvi t0srtmir3oo1apenmnes sfs2ua( pot4tpeoifcild s2ua( s (4aetrmf3oodfpD  iei;s  2uoim oydal  liei ()s2raxrpou4oltnmiciydlaDrl( snu4 exnif oo1fmt lu sl( trxoxo iy1apte nvias srurxrpno1opxo ieias aDrlnvsn(0alxnxfcoydfp e nvslt0 rtm(m3ou4alte fvi (  rtaxrpno4optnmf3ildlmDumnvs;t4aetomr io1optr uesls t2xoio3oo4alen ncsa(fs2rrxm no4oet  f3tas sDeanvs;t4trerif3oytfpDeau sl()t2umimpnydamtn nct ( a2raxrooo4olx mfciatlmDra( o;t0 rxrxocoa1laD  u i s0 euo(o3oy4omenmfeia(f Durx o;u4oee mf3tlt sDrmuvs;u0areoxo3ty1opteli ils)trxrxm3ny1ol  lfesa(fa2uaxrp;o0tlt iietydfmDuluvsnu4treoxo to1lmDrlu i;() rtm(r nodapt lfesasfa2umum ou0alenifciasfaDemnvo;t) lxnif todfpte ivi s0 exoxr3nydlptnliei s sDtm(  nu0olx mi3iadlsDranmo;t) eenmo3iadfp  aivilt0 rtrir3ou1op  lics tf rrm(r ;u0olt  oeiysfs2uauvon(4 rerif iotfmDrluvo;s0setoxo no4lpeemncil(farum(ront0apxoii3iyt s umums t)tltnmocoadfmtraies s) rtr(mpny1al   nvtat sDuaumono0alx iictatlm2ran o t4aexnmf io1fp eaivs;(0trtmxr ou4llte ivtlt  2tmu  oo0oexo oeiltls2elnmonu0 eermf3oy1la elu sls  2toirpou1ome  fes s s2uaur ot4ope moetldlsDrm( on(4 lxoxf3iadfate iesls  rxm(o iu1op  mncsls  2tru ono4tpx iieild m ra( o ()aeerxr3tadomt  ueo;s)srxoxrpoo1lptnlncsls)s2trxm ;o4oltomfeildls ra(msnu4tltrmocoydlpt  uvs;s0truoxr3nydole  fvtls)arrau ooo0tlxoio3ilsfm2rm( o;t) eenxf iadop raivolt)texoxo iodllt lneta()aDraxr ;t4tlx moeiadfm2umumo t0trermo3tatfmtraies t)sexmiopiudome lnvias sruauro;t4oee ifetydfmDrmu on() ltomrciodlmD au o;s0 rtrirpiudllt  nei s artrxmont4tpxoiociltfm emnmpnt0alxnxfcoy1fpDelues ( t2umxr3ny4om n ivt s) rumxrp;o0oeto feiytfsDeanmpnt4treomf3ty1lmDeli ils trtmiopiudam n fvilt) Drrxmp;t4olxo octyt mDrmump;(0trtoxf3oo1opDe uvo ( sexrimpiu4opt lnvil() 2trxm ot0alxo f3iltlmDeauvpnt4tltnxfcoo1oat an o;s0sexmxrpoo1ol elneiltf 2um(r oo0aetn iciadlm elnvsnt)tltrmociodlat  ies;( t2to(o3oo4oltemfvias)sDtmumooo1aetnifciadls elu p t) lermf3io1op e ieolt  eto(o iudlmtnmnvilt)sDumx o;t1tptnmfciadfa2rmu pnu)tltoio iy1opt livol(  2xoxr3nu1lpee iei s)s2tax ooo1tee  octysfa ranvonu4aleriocia1op rln olt)s2um(opoo1omen fvslsf 2ua(  ;u4aee mf3iyt a2raumsn()aleomo iy1oatr uvs (  2xmxmpiodlm nmfvsas)sruaum nt1alto ociyt aDrauvp;u4trxrio3oy1oa   uvs t) rxoim nodaltnmnet t)sDrr(monu4tlt  i3tydfm2rm(vs u0trermrctatoptr ies;( texr(r3iudomtemnetl()s2taxrpoo4tlx mi3tys s ulnmsn(4arerxf iadlptrluvols) rum(rpoudopt lnct ( a2rrxmp;t4apx mfciat s el(vp (0 lxrifcoy1fptr ies;s)s2urxr3iodamtemnvil()srtr(mpou0olto fctas aDrmuvsn(4tlxoioctadlmt ln s t t2trir iy4ll nmnvtat) rta(r ;t4aptnmociyd aDrauvo;(0 reomocoo1lp eau s ()trtm(r3iudal   nciatfs2rmx  nt1tpeoifcilt m2ra(vpn(0arxnif3ta1oatran o t0srumim iy4op nlivsltfarumuronu0tptn oetadla2umnvont0alerxr ootoa rli o;(  eumxo3no1lleemnct s) 2ra(m nt4tlx  oeiyslm rmn pnu0aeeomrcoodfm   iei (  2umxo3nodoltn iei sfsDrm( oou4tpxoioetadfa ranmsnt4 lxomrcoadlpte neo (0 2uoxr iodlmenmnvsatfarrm(m ou0aexoio3tltlmDra(ms (4treomfcoa1lp ranvo;( teumiopiy4ole  ict sfa2tax  nu1oetnii3iltfm umuvo;u4 rtnmfcty1oa rluvil(  2xoxm3nu4ape mnvia()artmx o;u1opx  fciatfaDumnvs;(4 rerioctatlpte nvs;() exoxrpoudamen fvsas  2uru p;o0aeeomo3iysls rau p;() ltnircia1faD  uesl( srxo(rpny1llenlivsls  2tmumpnt1tltniieilt m2uluvp;(4aexoxfcoodom eau o;t)trxmio oy1al nliet ()aDum(mp;o1aetomieilslaDum(ms t0 lenmr iotoat luvo ( srtmim oodlme lies ()s2ra(roou1ope mfcildlaDeaumo;(4altnxf3iotla eli s;t0setr(o3oodll nmies tf 2umxro;o1tleoifetys s2rmumo;t0aeeoir3ootlmtean sl(0tetrxrpoo1ap n nes ()srrmu poo4teto feiat sDem( s t0aeeomfcoo1omtr uvo ( seuoio3ny4opt lfci s s2rrurpno1oex  fcilsla2emnmp;u0 rxnir3tytfmDe nei t0 rtmim oy1alee nvt sf rumumonu4openioetlt a elnmp u)aexnxo3tydop e n i;t  2xrxm3iy4am   fvils  rtax  ;u0aeeomfciasfs2rln s;u0 rtoxr io1lmD liei t) rxm(mpiu1om  lfvi ()artrump;o0olt iiciyslm2em( s;t0trtnxo ty1op elu i s  2trim oo4oltn nviatf rrax oot1aptnmf3iytfm rlnms;()trermo3iydlmD aivo s)t2xmxr io1amt  netas srumx pnt0tet mfeiyt m2rlumo;(0tltomo todfpte n il()trtm(o3oy1ll emivtatf 2uau pno1tleomfctytlsDeaums;(4aeenifctytfm rlu i;t) eto(m iy1ap nmnetasf 2taxroot1aptnii3iatla2emnmp;t0 lxomfcoy1lm r nvo;s  2ur(r iudop e fvs sfsDum( oou1oexoiocilt s el( p;t0artrxrciytlmtr u s s) rtrxopoy1optemfcs sfaDuax o;o1alx ioeilt m rauvp;t)trerio io1lpDeanvsl(  exmxm iu4lpee fvt s)a2trumpno4tee iiciysfsDumnvpn()alxnmo oodoa eauvs ( t2um(o3iu4amte neia(faDur(rp;t1tle mfctas a ea(mo t0trtoif3to1optrli i s0t2um(opou1ol emnciatfs2raxm ;u4oex  ictat m2uaumon(4trtoio3oydfatr nvi;t) rurimpnodop nmncs ()srtr(roou4opxo f3iatfm eau o u0 lermo3oa1om  ai s;s srxr(o3ou1lp n nvi (f rum( onu0tlxoioeils s emnvont)treoxf oo1fatrlnvi t)texo(rpio4op  lfesl(fsDtaump;t1tptniictytla uaumo u4 rxoxo oa1fpte ivo;t0t2um(r ou4alenlnvil()s2rau o;t0oeto i3iat mDelumo (0trerifctotfa  lneolt0trur(o nu4amtemfvia( sDur( pnt0aexo fetlslm2ua( ont4tlxnio3oa1omtelu olt0teur(r3io1am e iciasfaDraxro;u4ale  ociltfm2ea( s;(0 eenio iodopDrluvo t0 etrim oo4lltnlivt ()aDrmuro;o0alx  ietas aDrmu p (0tleomf3tydomtrlues;(0s2to(r no4apt lfcsa( aDrau o;t4apx  ociadlsDrl( p;(0 rxoxf iy1fptr iei;s teuoio oodomtnlfctat)artau  ;t1oex  o3iydfa emnmp u)aexoir3oy1faDr ivo;( srxm(r iudam elnvtls s2rrum no0tpxoifciasla rmumpnu)texoir3iadfatrliei (0srtoxr iydapenlfcslsfa2rm(ro;o0oleomociatlm eluvsnu4 exnxr iytlpDe u i;t  2um(r nodop  livi t aDtmx poo1tlxn fctltlm2eln on(0trtomo oo1lmt  ieslt0srtoxm iu4omeemfvs (  rum(rp;t4teeomi3iaslsDuau s t4texnif iadom elnvs;()t2toir3nodom  mivt s aDrru pou0apenioeiyslm2emumont4aleoio3tydopD livslt)t2to(r3oodom  mnesls sDra(m no1apto ieildfm ulnvp;u0artrio oa1opDr n s t0trtm(opnu1olen net s  rta( p;t0olx ioctytls2rmnms;(4texnxf3totoaDrln ols)trumxo3iydap   fesas)sDur(  oo4tetnii3ilsfm ea(vpnt4 eenxrctydfatr uei;( s2umimpiodal  mnvia(  Dtmumont4olxniociytlm ra(mp t4aeerircoo1fpD ln s t  rto(mpoodlmt miei ()aDuru  ;t4tlt  feilsfm2um( snt4alenif3oodom elnvo;s)teur(mpnodop n fcil()a2raxrp;u1openif3iatlm ulump ()tltrmf oytlp r i il()srum(m3nodol emfvta( aDta(rpnt0alxomi3taslmDemnvp;t)alxnxr3iadfpDran o s  2trir no4lm  livt ( aruaxmpot1texnii3tasfm el(ms (0tetnmr3oodfmt  n i s) 2toimpno1amtemicta()s2urur no4oexo octadlmDul(vp;t0 reomocoadomD auvo () rtrim oy1olee fctltfsDtmu ont4tltoifciyt m2raump t0tlxrmoctadop r n s ( tetrim io4al   nciasfsrtr(rpno4openioetlslm rauvpn(4 etnmf3todomDrlnes s) eto(o3oo4lltnlfciat  rumu onu0tpen o3iyd m elu p u4teerif3iytoatelieolt srtrxopny1ape mnviat arum( p;t4olto ocildla2rlnmp;t)alerif io1lmD li s;(  2urirpou4olenmicsl()sDuaxronu1apxo oetadls2rmuvs;() ltoiocoytoaD  iei s0t2toim ny4optnliciat  Drau o;t4tlxniiciaslm2ulnmon(0 rerxo3iytlatelu i s)t2toirpny1lpt lfvt ( aDurxrono4texnmoctys sDem(vpnt4tlerio tadfa rauvi;t truoirpio1ap  liviasfartm(r oo1oltomicilsfs2um(vont)aetrmrcty1fpDranvol() 2xm(rpnydlmenmieslt  Dra(mp;t0aeeo ieiadfa umu p;()artnmocootfmD  ueo t0trtoim3iudlm  lnes sf 2umx  ;u0oetomf3ils s2elu p t4 lxnmo todfa  anvs t0 euoxm oudaltnmnci tf Dumu  nu0texoifetat mDranmo u0tltrio oy1oate ueol( trto(m3oodamt  iesas)s2tmum ot1openioctls mDemumonu)arxnxr ootomDeauvi t)t2to(opiy4apte fctlt)artaxm ;o0alx mo3iadfa emn o;u)alermr3iydlm r nvo;t0srxoimpiy1altnlnet s s2umumo;t0tle mfeiatfa ua(vp;u4teenxfciadfaDrluei;t)t2xo(m3oy1lltn ies (f rtr( ont1olenmi3iatls2rmu p u) ltoir3oytop r n olt0 ruoio3iudapt lnet t  rraum no1optomo3iat s el(vs;(4artoxf3to1lat  n i;t0trur(m iy1lm  mncs s)s2rrurpot1tpxniieiysfsDeauvpn()tlerxr3ootomD  nvi;s s2xoir3nu4lmte netls srrr(root0oeto ociytfs umn pnu4 etoxr3ia1fmtr uesl(0 rumxm nu4ape  nvt tfs2rrumpnu0ape mi3iat aDum(mp u0aexoir3ta1lpDeluvi;s  eur(rpoo1apt lfcs tfsrua(rp;u4tpxoio3ilsls2rlnvo u) rxrmf3tadlpD  i o;(0t2umir3ny4omee feia()a2rm(root4tee if3taslm rlnmsn(0areoxfcio1lm   uvs s) 2xrim oudlmtemnvt s)arrr(  nt1apxo feiad a2rmump u0 lenir iadlmt  uesls0seur(o oodamt  icsl() rrm(ront0aexo ocildfs2emnvp;(0 exoxf3totfa e ies t)s2trimpiy1oltnmiviatf 2raxr nt4aee ifctlslaDranmont4 lxrmr iotlaDeaueil() ruoxrpoo1om e nvt ()arumump;t1alen f3tydlm rluvpnt)tlermf3ty1oaDran i;s seumxo ou1lpt lict t)arrrum ou4teeomo3ils mDua(vpn(4tlxnir oy1oaD anvs s  rtrxr3nodllt  ictlsfaDuax onu4tlxomoctysfa2umnmp;(0altomf tadoaDeanvils) etr(rpiy4ap  lncsasfa2ra(  ;u1oetn fctys a2rl( on(4 ltnxo3oodfpD  iei;s0t2tmio iu4al emncilt)a2tru oot4aetnmo3ild mDul( on(0trxoxr ta1fp   ivi t)sexm(opiu1ll  mnvi ()aDur(r ;t4apeo f3ild aDulumsnu4texnio oytfa rluvsls trto(opoodapeelnvtat arumumo;o0opt mf3tld mDeaumo u4 lxrmf3oadlmDelnvs;t0t2uoim3ou4ol n fet ( artru pou0ale mi3tltlm emn s;t)arermocio1om r n i ( texoxo io4omeelfciatf ruaum nu1oeen octadlmDeaump t)altrmf totlmtrlneo;(  2tr(o3oudllt liesl( arta(mono1tetn ieiltfsDua(vp;t4 rxoifcio1lptranes t)srxoxo3iudap  mnvilsf 2urx pnt4aeeoii3ild a rm( onu)arxoxf3tatoa ranvo s)t2uoir3iydll   fct ()s2rrxmooo1alenif3ils s2rluvont4 etnxoctadfmDrai i t s2uo(opno1opt lfctat s2rru ooo4tpx miciyslaDea(vs;(4 exnxf3oytlaD aueo ()setm(r nydlm  livta()aDumx onu1oleo f3iyd m2ra(vo u)tetnmf3tytoa e uvi;t0sexmio iudoptn ivtl( aDrax oot0alx mf3ild a2ea( p u0areomf totlpDraivi;s  2uoim3oy1op nlicslt aruru  oo0tlt mi3ildlm elnvp;t0 rtoxf3todfmDraiei;t)seuo(rpoudalee ivils  2tru pno4alxn fctls sDumnmo;()areomo ia1fp  lnes;s teumir nudalte nct tf 2urxroot1optoif3iyd m2uan s;u4 lenif3oy1fat aivs;t trumxo3iy4llenlnetlt s2trxr ;u0aet  oeiat a2rm(mo;(4tetoxr3iatla  lueils0s2tmimpiy1om nmieilt) Draum oo0oexnioetysfsDrl( o;t4aleoif3oydoaD luvi t0srum(m3ou1lpe  ivsa( sDrax  nu0aleomieils m em(vo;u0 exnmr oa1lmtrli sls t2xrxo ny1lp  mnci s s2rmxrpno4aexomfciltfs rmn snt)treoif3tytfpDraieol() etmim oodlpeemict tf rrrxr ;u4tlenifetat a2el(msnt4artrxr oo1fm eaueilt) 2xo(mpny4aptemfctlt s2urum oo4tle iictldlaDeluvs u) etoxf oo1lat anvol()s2xmir3no1ameelfvil(  2rr(mpnu4olx mfetysls2elu s ()trtrif oadfmt anvo ()srumxm oudol e fetls)a2rr(mpoo4apeoif3iydfaDrmnmp t0tetnif3iatlaDrln sl(0 eumxr3oo4ol  mnviat)arur(m ;u1ape io3iadlm2ean o;u0 rxomf to1fat li i;s0texmimpiydom   icsa()a2trum ot4tlx iieiad s rm(vsn(0 exnxr3tatlpDe uvil(0teuoxr3no1alee fesls) rta(m oo0optnifeiadls el(vonu) leoxf ta1fm elnvs s) 2xrim iu1amee fct t)aDta(  ot4oltn oeiys m2uln o;u0 exoxf3tatomDran o (  rxmiopiydap nmfctat)sDumx pou0tlt  fetys a ua(ms;() leomf3ty1la eaieols0s2xoxm3oydop nlictlsfarrauro;o1aetn oeilt s uan o t4 eenmo3to1oatrlivo () eumxo io1al emfvsat  rtm(rpnt0aexnmoetls s rauvs;t4tltomo3iodfmtrai o t  2tmxo3nydllt lfcsat)a2uaxmpot4aptomiciad a2uln pnu0 lenmr tatomte ivi;(  2toxr3iu1alenmivtl( artru poo1tle mfetlsfmDrauvpnt0 eeomr3oytlm ranvs;t0teumxopnu4apeemnes tfarraxr no4ape  feild m2rmnms;t) rxnir3oytfaDe nvil()t2umxr3iu4amenlnctlt)s2raxm ou0optoiictys mDra( s t4 reomrcoydomteln o;t0 etmirpoydole miesl()arumurooo0tptnmictatla rmuvsnt0 etnmo oadop r nvi ()sexmim3no1ll  mncslt arraum oo1aetn oeiaslm elumo u)teeoxrcoy1lpDeaies;()srurxrpoo1am e nci () 2uaxro;t0tpt ioetldlmDelump;t4arenircio1lmte ieol( t2trirpny4llt mivi (faDua(r ;t0oet  feiltfaDem(mp (4aexnmfctytfpDeluvs;t0 2um(o3ny4omeemfci sfa2urum nt1oex mociltfs rlnvp;t4arxnir3oy1fmD ai i;s) exo(m3iydam e net ( s2urxmp;u1opx iietlslaDelnms;u0arerxf ta1oaDelu s (0 2xr(m3iydlpen fcslt  rur( o;t1altoioctysfm2ea(vs (0 leoxrctotom rlivi;t)srxo(m iu4alt  ictls aDumum ;u1tee moeiatlm um(vs (0aexnmr3tatfp  an ol( srurim3nu4ol nlict (farrrurpou0apeoiiciydfm elnms;u4trerir3tadfat livil()setoir3iy4ll nlfciat)s2trxrp;o1teeo octatfa rauvp t4artrmoctatopDraneo;s)setoiopnudll e fesa()aDua( ono1tlt micilsla2rauvpnu4artoio3io1la  ln i ( trto(opoy1ameemnei sf Dumumpou0tetn o3tltlmDrl(ms;u4texrxocoy1oateaiei t0seurxrpnudole mivsltfaDrr( pnt4ale ifctys s2rmnvs (0 ltoir oodfmt anvsl(0srur(o3oy1ape  fcils)a2tm( p;t1oltoio3tldfs2umnvsn(0 eerif io1lpDelnei ()trtmim3ou4lpen ietlt)sDum( oot1tpx  iciasls2emn p u)aeerxocoatlmDr nei s0s2um(o3nodomenmnvsat)arrrum ;o0opto ietadlm2ua( s;()aexrif3tatfmD li i s)t2tm(o3ou4lmtnlict (  2urur nu0tlenioctlsls2elnvonu)alxoio totom eluvi s  2ur(o iy1lmtemfcta() ruau  ;o0teeomiciasfm ean pnt4tlerif iy1fmteaivs s0srto(mpnodolenlncslsf 2uaxmp;t4oexo ictad s rm( p () lerxf ootopDeauei (0s2xmim3no4lp eliet s  Dumx  nt4aleoiiciys m2elnmo ()arxrxo3iodom eaueo (  2toxm3ny1oleemnvs s sDurxmp;o0olen feilsfm emu pn(4 renxo3to1fm elieo s) ruoir3iudalt  ietls  rumxm nt4tle moeiysfmDra(vp;t4 renmrctotomDelieilt trxo(opiydlptnlfvsat aDua(rpnu1tltomi3iysla2rmump t4trtoxfciytlaDe nesls seuoxr3ny1lptelncias) Durur ;o0tpe ioctytlmDrmnmonu)trtnmo3iodfatrlivol(0 rtmim3iu1apt  ivsls)sDtmu  ;o4aex mo3tytlsDumu snu)trxnif3tadla e neo ( t2xm(rpnydll   iesls) 2rrx pot4apxn i3ilt s eau pn() rerif3oo1op eln o;(0 rxrxrpoodop nmiesltf Durxmonu4tetn f3iatlm2ea(mp;t) leoif3iydomDrai i s)t2xmxm3io1lle mfetl(farumur no1tpeoii3iyslaDua(vs;(0tetrir oy1lateaiesls0s2xmxmpno1lptn fci s aruaum nu4olt  f3iasfm2em( onu0tetnxo3ootfp rlneo;t sexrim3iu4alee ici s)arrr(ront4ole  oeiat m2umnvs u0 etrir oydomt au i;t t2urxm nydal emneiasfa2rrumo;t1aeen o3tasla ra( p t4aexomo oodlmDr ivo t tetoxopnu1lpeemivslt  rrau pot4altomoeiadla rmnvpnt0 lxomr tydop rln ils  2xoio iudop  lncs sfarrax pou1altnmictyd m rau o u0 rtrio ty1fm  au olt)srxm(m iu1lp  lnvslt)sDuauroot1oetnio3iatls um(vo () lxnmo tydfm eanvo t0 exrxr oydlm elfvslt  ruru  ou1apeo feiatfa2uanmo;t4areoxo oa1oa r i sls)tetrxr3iu1om e ivi (  Drrumo;t0aexo ieiad aDua(mp;(0 ltnif3iytlmtelieol() 2xr(m iydamen nvtlt sDum(rono0aptnii3ildfm2em(ms (0 ltoifcoo1opD au il()texmxrpnudapee ictls a2tmx  ou4oexnmoeiys m2rl( snt) exrif3todlmtrlnesl()srumxo iudol   fesasfsDrm(mpot1tle mfcild a ea( pn(4 exomo3iotfmDeaieo;s t2uoxo oy1ap   ncia(f Dua(m nu0tetomictltfsDea(mpnu0 ltoxr3iodom r n sls) etmimpoy4lpenmieils  2rrx  nt4teeomocilsfmDemnmo u) lxoxr3ia1lm  anesl()trurir3oy4op   fctlt arrmumo;t1oltn f3ias a umn pnt) lxrio3to1fa e i o s0 etr(rpou1ap emfctasfarra(r nt0alxn f3iat a elnmo t4 etnircoa1fm eau o;s  exoxr io4amenmnet ()s2rm( pnt1oexnifeiatfs rl( on()alenxoctodlm eauvsls0srumir3ny4apen netl(fsrururp;o0oeeomi3tad aDrmu s t)tltrio3tadlat au s ()srtmxo3iudllt mnes ()a2rmx p;u0tet  i3iatfa2uluvs;u) etrxo tydlmt ln i;t t2uoxr3iu1optnlfvsatfa2truroot0apt io3tat m2um( on(0aeeriocoy1lpDrli s t0 2uoxr no4lm elneil()srtau pnt0oetnioetld a rl(mon(4areomf3ia1lpte n ol()s2tmir no4lle mies tfsDrmxmpot0alx mfeiadfa2ranms t)alxomr ia1lmDeau ol(0 rto(opoo1opeemfctasfs2tax  ;u1tpeoio3iatlaDel( p;t4aetrmfcio1fatraueol(  rur(o nydamee feiasf 2urumono0ale  f3iadfs emnmsnt4artnif to1optelivi t trtoxm ou4llee ies s  Drr(ro;u0oleo fctyslmDulnvpnt4tetrmf3iy1fpD  ivs (0trur(o3io4lmtn ncia()aDumu  ou1aee  oeiyd s eau p;t)teerxr tadfa  ai o t  eur(rpoo1alt liesl( arumxr ;o4tet  ieildls2umumo u) lxoiociadlp r nei;t0 eumir3io1amte nvsa( aDua( oot0aetn ieiadlmDeaums t4 exoirciotomt anvs;t0srxrxrpno1aptnlivslt)srurx p;t0alx mieiasla2rm(mpn(4arxomo3tytlpDean s;t truoirpiydlleemnetl() rrau oot4tpxoif3iaslaDelu p (0aexoxfcoydfm  li o;s) exo(mpiy4ol elfcias)arurxmont0olt  o3iadfs rmnvsnu)areoxrcio1oaDr ivi s)trumxo3iydoleemfei sfa2trxro;o0apto o3iasfsDra( on(4 rxnxo3oydom eauei;(0 exrim iodaltnlfvia( srumurp;u1alxo i3tasla um(mpnt4 rxnmr ootopDr nei ()srtr(r iudap  mfvilsfsDumurpoo0aetniociyslm rluvon()altoircoy1oaDrlnes;s s2uo(r3nudlm  lfvtlsfs2uax ont4tpeoifetltfa2eanmp;t4aeeoxo3tadla   nes ( s2tr(r ou4lpe mncs () 2rax onu1oex mo3iytlmDua( ont)alxoxrciatomDr u o (0srxo(o3nydal n ivilt)sDtrum ou1opto oetltfa2uau snt)aexnxfciydlmtrln o;t)t2umxr3nu4llte ivtat  2rr(r nu1tpxo ociyd sDumnmo t) rtnxf tatom  aneilt0 etr(opnydlleemiet tf rumxmoot0tlx ii3iat a2ulu s;u)teeomocio1op  luvsls  rxo(r iudol   nviat  Duax o;t0oexn feild a rmuvont0trxomf oydlmt  i s;s) 2urxrpiudaltemncils s2trum ;o0teto feiltlm2ulnvpnu) etrmr oydop r uvilt s2tmxmpiydamtn ict (f Dtm(rpnu0tlxoiietadlaDrm(ms (4teerxr oa1lmte n ol(0teurir no1aptnlncilt)artrx  ot1aptn i3ilsfm2rl(vpnu)ae
\ No newline at end of file
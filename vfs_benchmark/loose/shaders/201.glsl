@@ -0,0 +1 @@
+ivs t)trtoxr3oo1lp   ncs s s2rrumpno4tpxnmiciltfmDemn p;(0arxoxf to1laDran i s) rxmir iodlltemncsat a2ua( poo1oetnmictyt aDranmp;u0arenxr iadlat aueolt0s2xrirpoodalte fctat a2raumo;t0ole  ocildla eau p u)arxnmfcoa1omtrau i t t2tmxr oydlp nmnet (fs2tm(r no0tlx ifetad s2ua(monu4 eerir iotfpt lnes (0s2uoio iu1lp  liesasf rurxr nt0tle  icilslm2raumo;() rxrxfciytoat luvs;t srxmxr nudap e fvt s) rtrxr oo0oleomfeils s2rlnvs t)tetoir iadoatrlu s;( trtrxm3ny4am n icsatfa2taurpnu0ale mi3iad sDemums;u4teerxrcoodfp eau il( t2xo(o3oodapt liciat) Durx pot0tptoifctydfmDrlu ont0trtnxo3io1oa e nei t  2xrir3no4ame  icias) Drm( oou1oexnifctatlaDrmnmont0 eenxf3tadlmt  uei;t) etmxo3iudlle lnesl()srum( p;t4oleomo3tydla eanmo;t)tlxomr totoatr i o s  exrim io1lmt  ivsa(fsDrrx oot4opx micild s ea(mpnt)aeeoxrcty1fp   neolt0teuo(m3iydomte neils) rrr(root0apeoifctysfa2uauvpn(4teeoxocty1om eln s;( sexmio3ou4llt mnci sfsDtrxront1teeoioeiyt mDra(mo (0aetnio iotlmD  u o;s t2tmiopou1lptemfetas)a2trxrpoo4apxniieilt m eanmsnt4aeerif3ty1op rai o;s texrxo nu1lp  mivi s  rrr(mpnt1tltn feiytlm eaumpn(0 eerio3oytop  au s (0tetr(o oydlmt  fctatfsDur(rpot0tle  i3iydfsDrmumsnu0tetrxociotla   uvi s) 2uriopny1omt mivta(f Drax onu4olxo fetldfmDrmn s u)artomrcty1la   nei (0 rxr(opny1lptnmneiatfaDrrur no0tlt  ieias s2elums (4 reoxf3oy1fa  lnei t0trtr(opnu1op  mnesat) 2tm( ooo0alx io3tad a2um( s t)aetnmrcoadfp elivilt trxmir3iy1opee iesasfsDrrumooo4tptoio3tytla ra(mo u0aetrmociy1oa  luvs t0s2toiopiu1aptnmncsatfartmx p;u1tpx moeiadfa ua( p;t4teeoio3io1lpte nvolt)trxoim3oydlpen ncsl() 2rmum ot4tltn oetyt aDumnmsnt4teenxocoa1opt  n s;s)t2xmiopnudlpe lfeta()aDrmx oou1ale  f3iytfa2elnms;t) lenxfcty1fa   n o;t  rtrxrpio1omenlnctat  rua(ronu0tet iiciydfa emuvpnu0treoifciytlmDeau sls  rxoio io1lp   nvta( s2raxmpot4tltn fciad s2ul(msn()altriocootlmDr u s (0s2uoimpno4lmt  ncilsfsDraurpno1opxoii3iasfs2umnvs u4artrmfcto1lp   ieol() eur(m oo1am nlics ()s2ra(m ;t1apxnmiciatla2rmn s ()areoxrciydlp  livils)t2trxo3no1lm  lietas sDrr(roou1tptomieiltlm rm( p t)arxomf tydfpt  nei (0trumir3iodamtemfvi tfs2tmu oot4tet ii3tlsfm ulu sn(0 ltomf io1faDranvs s  rumxrpoodlp nlneil(  Dtrumoot1tltomo3tad aDul(mp;u) exnmociytfp   n o (  2xoxmpiy1am  mnvtas  2rrx  ;o4oleo feilsls2rln s;()aetnif oydlp  luvs;t  2toim3oy1amen ivs (fs2tr(ro;o0olen oeiys m2raumsnt4alerxr ta1lpt  ivsl(  2ur(r io4lp  miei ()aDtrxm oo4tex  f3tatfm2umn s;t0artrmf oodlpDrauvs;(0s2umxr3nodlp nlnetas aDtmur no0optnif3iat m rlums (0tltoif3iadom rlneolt s2xoimpny1lp   ncsltfsDuaurp;u1texomictysls2uanvp u4 etrmr3to1lpDeluei s0teurir3iy1ol n nvsasf 2umxmpno0aexomieild sDelnvp t0trenmo3oo1fp e ueils sexo(o nydol n fvtas)aruaxmo;u1ole moetad s2um(vsnt) rxoifciytlptelneo t)s2xoxo3nodlmtelncia(f rrrurpoo0opeoif3ild m uaumpnt0arxrmf3oa1fa rluei t)srum(m3ny4omtelfvil()srrrxrpou1tetn f3iatla rm(mp (0areomo iy1opDe i o ()seumiopiu4omeemics sfaDta(  ot4aee moetyd s em(mp;t0tlxrmo3ia1fmte ueo;t0t2to(o3nu4amtelfcs (fa2tmxroou1altnmfciytfmDran p () lxomo3tadfmD  ieo t0 2to(o3no1ll   fvs s)aDuau onu0ope mi3ild s2em( s t) ltrxf oodfaDe ues s)srxoimpnu4llenmfviat s2tmum ;o0aptoiiciaslmDrmn pn(0arxrmf ootom r uvs;t tetmir no1lmt licias  Dtr( poo4tpeomieiltls rau s t4 eenxf to1lpt  ivolt0t2xm(r3iodap n ictls)s2ua( pnu0alxomociydfs2emn on(4trenxr ta1fp  auvolt seuo(opnodaptn nesls aDtmur ;t4tet if3iys m2umu ont4 lermociodopt  uei;() eurir ou4lpt  ict t)srur(m nu1teeniictyd a2rm( p u) eeoxo oadfm eai s ()t2xmiopiy1am nmnvsas)sDuax pou0apxoif3ilsfm eln o t0aexnxocootfm r uvsl(0 2tm(opio1ope mnvslt) ruaurpno0alen f3tasls rln p u0alerxocootop   n slt0trxoxm io1openmieia(fartm(mpnu4aex ifciasls rmnvs (0altnxo3oa1fm eli sls0trxrxr iu1amenmnvs t) Dumx  nt0opt ii3tltfs2rlumsn(0trtnmf oatoatelivol(0srtrxo3iu4apt  fet t arrrumono4oetn i3tld a2rl(vp;t0aexrxf3iadfa  aivs;t0seuriopiudlpt mncsl( sDurur oo1altnmf3ils m rlnvo t)tlenxf tadlptr uvols seur(mpno4amte fcil()a2um(r ou0tpxnifctltlaDulumo () exoxrcoatlptrlu s;s0s2uoir oo1apenlfvs sfs2rr(mpno4aeeo octadfm elu s (4aeenxf oa1oaD  nvo;t)tetm(o3oudap  mfvi s) Durump;t1optnio3iysfaDelumo;t4 exnmf3oydlpDeaivi (0s2urxmpoy1amtn nvsa(farta(rpnu1oltnioeiyt mDulnvo u4 rxrxfciy1la eai il( seum(o iodolte fvtlsfsDurur nu0apeoif3tlt m ra(vo t) rtomf oatfat lnesl()trxoim3iy4oltnmfvt tfaDtmx onu1apxn ietad m2uanms;t)arxomf3iydoaD li ils)t2ur(opnudomtnlfcs s)sDururpou0aexoii3ildls um(vo t0arenmr3todomtelneo s s2xoxr nudom emnvia()a2tauro;u4alxnmociasls2emnmo (0tltnmr3tydoatrlues;t  2xoxmpoy4ll emfvils aDtru  ;u4apenmociasla emu s;t) renif oy1laDr i i s0trur(mpoo1aptemfvi sfartm(m no0ole  o3iasfm2ua(vo t0aexnmo iydfp   i o (0tetm(mpno1ll emivias)a2taxm oo1tpxniietltfs2rmnms;(0 rxrxfcootfpDelivs;()tetoio3iy4apeelivs t srtru o;o0oltoii3iydfm2uau s;(0 ltomr3oy1opt anes;(  2xoir nodap nlfei t) Drm(  ;o0apeniociatfmDeluvsnt)tetomfcia1fmt luvs;s0srxoxr ny4ameelnvs ()a2raxrpno0aptn octysfa umnmp u) rtnxo3totfpDeau s;t t2uoxo3no1om  mivtas)aDtmx  nu1optnmf3tytlm ran pn()tltnmr3oadfatr uvs (0t2xr(mpoudoleemivsasfaDrrx p;u0tpx ifeiyd m ra( onu0aetoxf3iatfpDr i ol( seumxrpoodome  feta()aDtr(mpno1texoiiciydlm umn o u)aexnxo3iotfatran slt0seum(r3iydll n iesl( s2tax ono1tlx micild m eanmo t0trtrxf to1faD lieil(0 2um(o oy4ale lnvs sfsDrmuroot4apx ioeiyd s2ean s;(0 eeomo ia1laDelueslt  rxmxm3oo4olt lfcsas  ruaxrp;t1aetnmiciaslmDua(ms;(4 lxnio3to1optelivo;()t2um(mpnu1optnlieiat sDrm(  ;o4oeeomietytls rm(vp (4texoxo3iodfptr ieo s0trum(o3iydolt lnvt ()a2tm(  ;u4oeenmieiltfa rm(vpn()artoif iytopDr i i (0trur(mpiu4lptemfvsa(f rumu  ;u4olxoiiciasfs2em( s;()tlxrxfctydlm r nvi s) etmir iu1al   nei ( arumu  ot0olxoiocilsls ra(mp (0 eenxo to1fptelnvi s)srxmxo3oo1ap nlnvia()arururp;u4tptoio3tas sDumnvo (4 rxnio3to1om eanvi (0tetrim no1optnlivsl()arrrx p;o0oltoiiciatla2ranms;u4tlxrif3iydoateanvs t)s2umim oy4ol n ivslt) rra(mo;t1altomo3iatfsDrmumpnt4alxrxfcoydla eaiei;s0s2um(mpoo1llt lfvsatf Dtau o;u0apxoiocils a2rluvpnt)aexnif3oodom  luvo;t)texm(m3iu4am  lneslsfaDumu o;o1apenmi3tysfm eaumo u0tltrxr3oodoaDrluvilt)seurxrpio4ol  lnct t  2trum nu4openifcias s2rmuvpn(0altoifcia1fm e nei;s0tetmirpoo1ap nliesat a2ta(mpnt4tee ioeiys aDumu onu0aexnxr3oodlmtraueo s) rtoim ou1lmt  ies t)a2uaumpnt0open o3tyd aDeluvo () lxrxr iytfpt lnvi;s0setrir no1olee nei t)artaurp;o1oet ii3tasfs2rmnvo t4 ltnxf3oodlm eln ilt)seuoxopny1lm  mnvi t  rum( p;u1olxoiieiytlsDulumo;(0trerxo3oodfm   uesl()sexmir iy4olee iei s  2raur ot0ope mfctltfm um( on(4 exrxrctodlatelies;(0srurxo3ou4ol nlnesa() rtm( oot0alt mf3ilslm2raumpn(0 ltrmrcoy1omt  n o t0sexmxo3iy4lpee fctlsfsDtm(m ou0optn feiydla2uln o u0trerir3todfa   nvs;( trxoim3iu4lltnmfeil() Draurpot1optnii3iat mDelu snt0alenxf tytfate nvi;t) etoir iudlpe  ivsl()aDtaur ;o0aleoioetys mDul( p;()aexoio3io1fmtrlneslt s2xm(o3oy1lmee neia() rua(r ;t0opeomf3ildfs uanmp t0 ltoxocoydlmtrlies;t  ruoio oudolenliei t  2umx oou1apenmoetydlmDrau o (4tetniociodlaD  n s;s t2xmxm oy4ll n ictasf Dum(mp;o1tleomfciydfmDum(vp (0aetoir ia1fa raieolt)t2uoir3ou4lmtelfcils)sDtr(rpnu0aetomf3iltfmDrl(ms u0alenif3ootom rau s s) ruoio oo4op  mfvi tfa2trx p;u4openmoeiadlm ua(mp;(0 eeomoctadoatrai sls0sexmxo oudll nmnvta(f 2trxmp;u0apenii3iyt mDelnvo;t0 lerxrctotfa e nvo (0 2uriopiy1omeelictlt)s2rm(mpot1aeeoifctlsfa2emnmsn()teeomrcta1fp  lu o;s0trxmxopiy4ol  mnvi t srrax  nu1tlx  f3iadfa2ra(mo (0aexnmr3io1fa raivo;t0trtoxmpoo4omte nvilt s2uaxronu1tetoiicildfm rlu pnt0 leoio iodlp eaivs (0 2tm(mpnudll   nvi ( aDua(mpno1tpe  fciatfaDulu o;()tlerir todopt aieo;s sexmim oy1oltnlncias) 2taumpoo4optoiietadlm2ra( onu0tlenxo3oy1fm eluvi;s  rurir oydamenmivilt aDtmxm ot1aexnmfeiatla rmu pn(0arenxfctydfmDraueo t texr(opiu4ll  mnet s)aDta(  oo1aeeniocils mDumnms;u) ltoxr ootlmDeai olt0seumxo3no4lp  lfvia(fsDuau  ou1oexn feiysfm ulnvo ()trxrxf ootomD luvol(0 rur(r ny1amt  feil()srua(rp;o1tleoioctysfm eluvsnt0tlxoxo iy1fmtrluvo;s0texm(mpnudom e nei ()aDuaumo;u4aee moetasfa ul(mont0aleoiocoa1op raieils0 etrxo io4al e nci t)sDuaxm ou1tlxn fctadlm2uln s;t0 rxoxr3iydop r iei;t  euo(r3ou1lpe lfcia()aDua( o;u1tleomo3tlt mDel(mo (0aetnio3iytlmD lnei s) rtoxo3iu4apt  ivtas)srtrx pnu1oex mo3ildlsDemn p () eeomr3oatoa rlnei;t0trxrio3ou1alenmfeta(  2urx oot1open fetlt s el(mo;t0 rxrif3iatla  ai i;t srumimpnudlme mivsl(fs2rr( pno4apt iociadlmDeauvpnt4tltrmf3iytopDraneo;s)s2toxrpio4omen nvsas srrrx p;o1tleomi3tad aDua(ms;t) lxrxo iotlaD an sls  2tmir no4ll   ies tfarrm(root4tleomi3iat s ean s;(4alenmo iytlatr ivils seumim iudam n nvs (fs2raxmpnu0apto o3tlsla elu p ()artrxfctadlm  au o s trurxopnudaptn fvsa(  2umurp;t0tpe if3tydfs2eanmo;u0artoxociytoatr nvilt0tetmir oodlpeelnct sfsruaxm nt0tltomieiyt sDumnmp;u) reoxr3oatfm  li ilt seuo(o3ny4lp   ivi t aDuau  oo1aeto octldfs2ran sn()alenifcto1fmDrau o t)sruoim no1lptnlfesl(f 2urum ;u1aeenifeilsfm2em(vpnt4alxoxr3tatop eaneils s2urxr iodlme liesl(fa2um(moot4apx mfeiatlaDea(vo;u)trxoircoadom r nesls) rxoxm3iy4alen ncsl(farumur ;o1tptomociydlaDrl(vs (4alenxf oydlm r nvi;t0srxo(m3iu4lmt lfctas a2tmxr ot0aptnmf3tat aDrluvonu) rxoxf oytlm r nei;s0sexo(mpio4ale lics s a2rmur ;o4tet  i3iytls2eanvo t4tltomo3tydopt  neolt teumir3nu1optemfesas aDrmumooo1tpt mictad m ulnmp (4 reoxoctydomD  ivo;() exoiopoy4aleelici (faDua(rooo4oexnmfcilsfa2el( p;()alxoxr3ta1lat lueo;t0tetrir no1op nlfcsl()sDtruront1optnioeiatfs uau o;u)alermf to1lp r uvolt)setm(r iu1aleemfeslsfaDtm(ro;o4alen ieils a2umnmp;t)alxrmf ta1fmD aies s) 2tr(r3oodlpt lfctl( a2rrxmooo4alxomfciltlmDemn s t)tltomf io1oaD  u i;s0t2xoio iy1ap elieilsfsDtmur nt4tptnio3tlslsDua(mont)tlxriociatlmDe i s;t srum(o3iy4lm n ivtat sDrrxrono4oeenmiciyd a ranmsnu0 rxnxf ia1lpDeaivols0trumxo3ou1al   fvtasfsDur( o;o4aex mfetyt s rmuvo;(4 rtrio tadlpDraneol(  rtoio nu4lp emfciatf rtmum ;o1texo ictaslsDrmuvo t4alenmf iatlpteaivo;s sexmio oy1lmtnlfetatf rtmxmpnu0tlxnifetysfmDemu p;t)aexnir tatoa eli i s)seuo(mpnydole lici (fsDtm(m ot4opt ifcildfsDel( snu)artrif iodlateauvolt texrio nu4lm elfvsat)a2tmu o;o1oet  octadfs rl( o;t)aetomrcty1opD ln i;t0t2xm(opio1amtnmneiatf Durx ono1oexnmociydfsDel(vsnt0 eenmf3io1fmtr u s;t0 2uo(r3iudllee nci tfsDtmxmpnu0alto oeiltla2uanmo;(4tlerif to1lat lneo;t0sexrxo oy1aptnmfetas)arua(root0tlx ifeiasls2em(vpn()artrir oydop elnvs;s0 2xrxrpoo4om e fet (  rua( onu4aeen fciad aDeanvo;u0tleomocoo1om e n o;s) eurxm nydlm n icta()arta( pnt4tetoiociydfaDum(vp t4 ltnio3oadfaDe uvsls0trtr(o iu4ll n icsls)sDur(mpno1tpx mo3iydlsDul( o;t0trtnio tydoaDe ivs;s0t2ur(r oodop   net ( srrr(mo;t0oee mfciat m ea( onu0aeerif3oy1fpteau slt srxrim iu1lleemictl()a2rr(mono4oltn fciadlm ra( s;()aexomr ia1fm eanvolt srtm(o3ou4alt mics s  Dtrxm oo1alx ifctld sDelnms ()trxrxr3iy1oatrlu il(  etmxrpiydlp emnvta( s2rm( o;u1tlx moetytfaDrl( p;(0tetoir3oy1om   ieo (0 eto(o3no4lltn fvil()sDrr( o;o0apen ietydfs ranvp ()alenxf tadop eaueolt)s2xo(r nudal   fvtlt  rtm(m no4aet  ociad s2ean s;u0 eerif iy1lat li s s  2xr(o3io4am  livi sfsrumx ono0tpt ii3iadfm2emnmp t)aleomrcoatlm  au o s0 rtmxo oudamenlnei s)srra(mo;t0opt iictltfm rl(vs (4aexoxrctodlp  lueolt0trtoir iu4am n nvils  2ua(rpnu1aeeoioeiaslaDeluvo;() renmr3oydlmDeau olt)t2xrirpou1om  mnvt tf 2um( p;u0oeeomfciys m2ua(msnt0artnir iytfmtran sl( sexoir3oudal  lnviatf rurxrpnu4tle  oeilsfa eanvs u4tlxomr3oytla rli ol()srtm(rpou1omenmnct ( srum( o;u0aetnmocilslmDulumo;(0artnxociodomtrau o ( t2urimpoydoltn fci sfaDrmx ooo0tex mo3iydfsDel(vo (0tlxoxo3tatfmD aneols srtoio3nu4lleemict t arrrumooo0opt ii3ild sDel(mp;u0aetoircio1oa e nes t sexoiopio1oltn fct s  Drm( pnt0apx ifeils sDea(vp;u4arxoxf tydfp r ues t)t2xm(opoo1al nmfvi ( arrrumpnu4aptn o3iyd mDumnvpnu) eenmo oa1lmDr ues;(0trumxo3ny1ll  mfvils) 2rau  ;o0oexnii3tat sDemnmp (0artomf io1laD auvils t2xmxm3io4op   feia( srurumoot1apx  oeiad s raumo;u)alxnxoctatfm  aneil(0tetrio3no4omtnlneilsfarrmur ;u0oexo oeiadfm eauvs;(0trtnxf3iatfpteau i;()srxo(mpoo4openmnvtasfs2tr(m no4oetomieiytfmDuanvpnt0texnmrciodopt aueols0t2to(rpiydap  mfvsl(f Dtmu  ;o4aexo i3tlsfs uanmpnt4treoxrctodfa eluvi;s0 ruo(r io1lpe mietls a2uaxmooo1ope ifciydlm2elu pn()arxnxr3tydfpDe uvils0trumirpio1aptnmics t)sDtrxrono0alxo fetls a2eluvon(0tlenxrctotfm  lueo;s0 2uo(rpny1ape liesls sDtr(ro;t4ape miciasfs ea(ms () ltomfctodlmt  ivs;s  eumiopny1oltemfctat srtax pno4oee iictytla2ea( snt) eeoir3oydlp r nes;t0s2tmxm oodomen feiatfaDuru oou0tlt  ocilt sDua(mp;u0 lerif3ta1lmD  ieol(  eto(m3nudoleelicias) 2trx o;u0opxomociltla elnmo;u4texrmrcoytla   n s;t0t2xmimpoo4ope  ivil()aDumxr ;o4aex if3ild m raump;u4 rxoxo3oydoa  auvi;s0 euoxo3ny1lleeliviat  rrrxrooo0tle mo3tytfs um(vsn()trtoirciatlpDraneo () etmir oydop elnvi (f rumxr nt1tlxnif3iltlsDuluvo;(4areoirctotoaD anes (0srto(m3nu1aleemivta(fs2ra(m ;t4tpt  ieiydfm2ul(mp ()texnxfcty1omDrli i s)t2toio3iodlpee nvi tfsrtmur oo1opxoiietyt mDuanvsnu4aexrxrciatom rluvilt  2xmxm iy4aleelnei ()s2um(rpnt4opeo ieiadlmDul( o;(0 lxrmr oydfmtran s;()srxoxopoudomtnmfeta()aDra(mp;u1oltnmf3ildfs uau o;t0 rxrxfciodfp eaivo s  rur(r oo1lltnmneia(faDrmum no0tlxn f3tadfaDuluvont0 lxrmf3todomD luei;(  2xo(m3oodal  lfesa() 2uaxmono4tpx  iciadlm emuvp u4areniocoytla  li s;t)srxoim oy4aleemicil(fsDrrxmpot0aexoifeilt aDranvpnt4areoir3ootlatelies;()t2uoimpno1al   fesl( srrrxroot1opxo feiydlaDra(ms u0trtnmf todlmtr n i s tetoir oy1omt  neia(faDrm(ro;u1aeeoifeilslm2ulumsn()trtnxf iy1lp e ieo s)teurir oydale lfviasfa2rau p;t1texo f3iydlaDelnvont0treoxo3todlaDelues;t  eumiopno4ol   ici t)s2rax p;t0tpeomfciatfa2rlumsnt0 etrxr3oatlpDrlivsls t2xoio ny1alen fesa( arraumo;u0alxoiieiadlsDul( p;u0trenio oy1oa elieil( sexo(rpno4op nlivs ()srua( oot4oeenif3ilt mDea(vonu0tetriocoydfaDrluvilt) eurir3oo1amt mics t)artmxmpot0aexo fcilt aDulnms;u)tltnmr3tytoa rlivs ()srtr(o3oo4amenlfvsa(  rtr(ro;o1tptoii3iyslm ra(ms;u4artoxr3ta1oat auei ()setmxmpiodllt  fcs s)aDumx  ;u0apxn iciytlm ranvo t4trxoxociy1fpt lnvol( t2urxm iodameemies tf 2um( oot1oee mfciydlm2rl(monu0 exnif to1lptraies;t)trtmxmpiu1lmenmivsat  rurxmpno1oee mfeiyt a2eauvo t0trenmf oo1fatelieilt) rtmir3oy4lm emfcta(fsDrrxr nt1tlt iieiad a emumpn()aeenxf3ta1fatelnvols0s2xrir oy1om emnes (f rrm( oou1aeenifciyd s ranvo u)tltrxr tadopt anvs (0texr(r3oy1opt licia() 2rm(mo;u0altn ocias s2ul(vpn(4 rxrmfctodlmD anvs (0teumirpno1olee nvt sf Drr(ro;u4oeeomietys s2elu s;u0 rxnxfciytfm raivols)s2um(o oydalee net sfa2taur nt1altn oeiytfm el(mon(0alerxf3iadopDeln slt)tetmiopio4al nmfesatfartm(r nt4oeeniociytfm rl(mont) eermociy1oaDeaivi t  rtr(m nudlp   nvilsfa2tax ooo4tpeo ietad mDuluvp;u0tltomfcoa1laDrluvol( srtrir oodome liet sfsrtax  ;o1tpe io3iadlsDua( s u0 eenmfctydoa rau ilt0srurxm iodlmtnmfeilt  2uaxr ;o4aleo fciasla uln o (4texoxr3ta1omtelu s;( trtoio3oy1al  lnvtl(f rtmum nt1alxomieiasfs um( p () lxrio3ty1oaDeau i;t  etmxo3oodap elfcslt)arta(monu0tltn icilsfa eauvs;t4aexrio oytoaDeanvs t setmxopnodop emncsa()aDurxrpoo1aet  f3ildfm2uln s u) rxnmfcto1la r nei;t)seuo(rpiudlptemnvsl( s2rru  ;u1tlxnmoetlsfa2eauvs u4 rxoxo3tydla eaueo s seuoxr3io4al  mfct s s2trxmp;u4aet  ieiydfs um(mp u0alerxrctytfp ran o;s trurxmpnydlmt mncil(farta(monu1apxomo3ils s umu pn(0 exrifcta1fatelu s;s sruoxo3oudameemncta() 2raum ;o1aleo o3tyt m2ranms;(4tetoxf oadlatrlu o t)srxo(r oy4lp nlfesl(fs2rmx ont1tpxo f3iysla rlu p;() lxrio ta1fmt ln sls  eto(mpoudlmenlnei sfa2uaxro;u4tpt  oetydlsDumnvont0 rxnxo oy1latr neils t2urimpnudol nlnvsa()sDua(mpnu0tleomo3tytlsDuau s;u0aeerxf3tatoa e u i;( s2uoxrpiy1altemfvilt) Drm(rpnu4ole  o3iyt s uanms u0 renxf3oa1fm r uvils)trum(o3iodoltn nctltfaruaxmono1alxniicildfa umuvp t0trerxo3ootoate i ils0 rxmio3nudaptn ncilt)aDum(mpnt1aeeomoetasfa um(mp u4artoxfciodfp  an ilt0teum(r3io1llt mncias)a2umxmpno1tpxn ieiat mDrmn s;(4trtrmr3iydlpteaneil( trxo(m nu1olenlfcslsfsrtmxr nu4tpeo feiytlm2ulu s t0aetomo iadfa  li o;t0sexr(o nudap nmivt (f 2tax p;u0opxnmfciyslmDrm(monu)texrir ty1lpDe i o (0truoirpoo4al nliei s) 2tmxm ;u4aleoiieils aDumumo;u0 exrif oadfptrlnes;t  2uoxrpoudap  mieil(farrmu  ou4ale iiciyt a em(msn()tlerir iatop   n s;t teuoxo nudll emnciltf Dumumonu1olxn iciytfm2eau s u) rxrmr3iatfm r ieo;t seuo(o3oydole  iet s)aDuaxmo;o4tlenifciytfm2uan p;()aexnif oadlmt aivo;s0texrxmpoo1opt mfviat  Dtau ooo0tpt iieilsls2el(monu)texrxo oa1fm eluvi s) eurxm oo1lptn iesl() rum(r no1aee moeiatfm2rlu p;u0trxomo iotop eanvs;() 2xm(r3iy1lle mnet t  2rmur nt4alx  octysfm rlu p (0tetnxo iy1latr u o t) 2toimpny4ap elivils)artaurp;u0teeo i3tatfmDra( p t)arermocoytlmD aivs t0t2xoiopno1om nlfvil()arur(mpnu4oex moeiytfm2ua(vo u0altoxo3ta1la rauvo t0srxrir3io4ol emfes s sDuaump;t4oet  oeiat sDemu pnu)artnio oydfm eai i t0 2toxopnu1open fci ()s2um(rp;t1aleomfetls aDeau o t)tlxrxr iotfaD livslt srtrir3no4omenliesas) 2uaxm ;o4aee  f3ildfa2ean p;t0 ltnxf3ia1fm eaueilt0 euo(r3oo4op elnetls)aDrm( pnu1oet mfeildfa ul(mp;u)trtnif iadop  aieo ()t2uo(m3oy1ll  mfesltfa2trumo;o0aee iociysfm elu snt0 lxnir3oatla raivs;t0 ruo(r ou4lle  fcsa()sruax poo1oee mfcilsfs uauvonu0aleomf iydlm r u i (0s2xrxr ou1ale lfct t  rrrur ;o1olto feilt sDeluvp t)trxomf oa1opt aieolt srumio oydamee fcsls)aDur(mooo0opeo oeilsfm rmn p;u) renxo3oy1fpDean o;t) rxo(m3oodalenliei (f 2uaxmont1tlx iociyd s rmuvsnt) exoxf3tydlat lueolt trxm(o3oo1op n fet tf 2ur( o;u0olxn ocils sDrl( s;(0altrifctotomD luei t0 exmxr iudom   fcs sf 2ur( pou4aptnio3iatfm el( pnt4alxomf3to1laDe ieo t0setmim3oodlm nmivt t sDta( ont4apxn fctatfs umn p t4 rtrio oo1fp rauvi ( s2xrxmpiy4lp  mfci t)s2uaxmpou4alenmfeiatlm2rlump;(4tetnxr ootfa  li i;t0 2xoxm3iodomtnlfci (  rrmxmp;o0tle  i3tldlm rmu p t)aetrxfcootfptelivo s  exrio3oy4al nlivsat)aDuaxrp;u1aexomieiys a eau pn(0altoxf3oa1omDr n s;t  exrxopiy4al n neia( aDtrx o;t4olt mo3iad aDelnmp;()trxnxrcoodlp eluei s trtr(m3iudlmee nei t) Drmu  ;t4tlenmo3ildfs ua(mo;u4artnircty1op   u s s s2tr(rpiy4amtelfcs sfs2rm(r ;t0oet iieiltfs rmnvp t)aexoifctytfpDeaueo;s0s2toxmpoy4omen iviltf rrmxrp;t4aex ii3ilslm rau o ()alermo ia1omDr neo;t0 rxoxopoo1om e iei t s2taxrpoo0apt ioctlt s umnmonu0 rxrxfctytlmD  i o (  rurxmpny4ol emnct t)a2ra(mpot0apxomietas mDuauvs;t0texomrcto1opD li s;s) eum(m3io4aptnlieils) rrm( o;o1oet ifcilslsDel(vp;u)alxomociatomDrauvs;(0t2tmxr3ou1alee ict s)sDtr(  oo4opt moeiysls2rlnvs t0 ltoxfctadoaDr n o;t  eto(opou4olt lncs t s2uaxm ;o1aee  i3iadlsDulnmp;u) renmr ootfm  ai ol( s2xm(o ou1lltnmnci t)arraxrpno0opt ifeiatls eln s t4 rxnioctatfm   ues ()t2trxmpoydopt lncia( sruaxmoot4alx  ocils a2eauvs;u0treomo tadfatrlnvsl( srurxm oy1ameemiet s aDtrum nu1aex mfcildls2um(vont0aetoir iadopteauvs () rxr(r iydamt mfctls  2umx onu0tlxo i3iysfa2ea(vp;(4alenxfciydfat ai s s srtoiopoy1op  mivs s  Dumu ont4aeeomfcilsfs um(vs;u)teenir3oo1oaD  n i ( t2to(o3iy1ap n nvtlsf 2rrur nu4tle mi3ils aDem(ms (4altnmo3iadlaD luvs;t)srxrxrpoudolen nvilt sDrm(ro;t4tee  feiatlaDumnvp t) ltrir ia1oat aivsl()trxrirpnudoptn feilt srurxmo;t1oeenifciatfm2umu s;u4alxoxo3iadlpD an i;s0t2xr(rpnu4oleelivi t  Dtax ont4tle  o3iatlm2rmums u)trtnmr3tatfmD lnes;(0tetr(m ou1al e iei s aDta( ont4tle  o3tad s um(vpn(4 lxrio oytoaD luvolt seurimpnydlmt  fes s) 2uaxm ;o0alxomociys a umnvo t4tlxomoctatomteauvi s0sexmxopnudamenlics tf Dtmxm ot1tet moeiat m eanvs t4 renmo3ty1fpteli i;(0s2toio nydomen neslt)a2um(mpot1opxn fciydls ulumont)tltoxo ty1lmtelneil()teuoxrpoydaptemiei sfsDta(rpnt0tet  f3tlsfmDul(vp;u4 rermfcia1fmD  nvsls0srurirpou1ol n nvsl() 2um(  ;u1oet  f3iytlsDrmuvonu)aleoxr3tatfpD lu s t)t2toir3no1oltn nvi sf rtmx  ;u1oexoifciys a ea(mont4 lerxo3tadlat  ueo t0 eto(o3ou4oltn ieia(  Dtm(ro;u1tex  fciasla rmnvsnt0 rerxociy1fmt lueils0 exmxr3io1ope  fvta(f 2urxmpoo4opxnioeiysfs2ra(mpnt0tetrio tydlpte ueo ()s2trxm oo1optnlfvslt) ruru o;o1tetoifeils mDra(vo (0 lxrmrciy1fatran olt0 rtmimpoy1opt lieilt arumxmoot1apxn i3iad mDrmn snu)trxrmo3totlmteauvo;s)s2uoirpny1lltnmneils) 2rr(rono4tpeoifctyd a elumo t0teeoircia1fm   neil(0setoxm3oy1ol e iviat)a2tmumpnu4oeto fctytfs2rmnvp () rerio3ta1fpDr nvs t sexriopou1op   ics s  2umx ont1aex mictysfa elnmp;t)aeeomrcto1la e nei t s2uoxo3io1lpeelivs (fsrtrumo;t4oexnmo3tasfs el(vs u)areoif3tytfmDe n slt  rxmxr no1lltnlfei tf 2ra(  ;t0texn oeild sDua( s;t)altoxo ootfm eauei;t0seuoxm ou1oltelfcsat  rta(moou0aptnmo3tlsfa2el( onu) etnxrctotoateaueo;t)sexrir3iudal elnvi (f ruaxr ;t4tptoif3tlsls2em( on(4tetomf3ta1omt  uvolt srurxr ou4ameemivi t  2uaurp;t1tptn f3iydlmDrlnvo;u0 lxnio3oy1om r ueil( teurir iodlltn ncia(farrrx  ;t1aexoii3tysfa2emuvs t)tlenmrcoydoa ranesls0srxoio3nu1lptemicsls)srumx p;u1tpeoio3iysls2uanvpnt0arxnxf tytla e uvo s)s2umxr nodamtnmivias)a2taumont0tpe mfeiatls ul(mo u)texomf3iadoa eai sl(  euoxm3no4amen nesat)a2ta(  ot1aetomieild s2umnvont)texoxocio1omDelu o t  2urir iy4lpen nvi t aDrm( ont1tee  ictydfa2elu sn(0tetnmf3ty1fmD au s;t)srtrio3oy1ll elfes t aDtr(ro;t0ope  i3tls aDeau o;()alenmr3oo1omtrluvi (  exrio3ny1lle  nes s)artrum ;t0alxomi3ilsls elnmp;u0alenxo io1lptr ivil(0 etoxmpiy1lmtemfcsa(fsDrrumo;o1teto fciadlsDeanvs t)altnif oydlmDr ues;s teumxmpoudapte ietls srua(r ;u1opt if3tysfmDrl(vs t4 etomr3totop rlnvols) 2xmxo oydapt mnvsasf rur(mpoo0aeeo feiyt sDul(vp;u0 leoio3todomD  ueo t0t2xo(mpnydlm nmfesa( aDurxrpnt4teeomo3iaslm ra( pnt4teenmfciytlptranesls srxoxr no1ap e nei t  Dta( oou4apx mfeilt s umums u4tltoxf oydlm  livilt srumir oodlpen ncil(f 2rmx o;o1altnifeiyslm eln p;u4 rxoircoatfate i s;s0 2toxm iydapeelfvt () rra(mp;u1tpeomociltlaDean pnt)alxoxr3to1laDranvol(  exm(r3oo1ll   neiltfaDua(m ot1alxoiocilsfm2rau p;t) leriocto1fpDrlivi s0t2xmio iodlptelfct s sDrmx pot0tlx iictldla ul(mpnt)tetnxr totom e nei;t) euo(o oodame miei s  2urx pnt0texomfetadlaDeanvp;u0alxrxo3iy1lmt  i i;t)texriopoudlpeemfvtltfarurxrp;u4tex ifetls mDumn s (0tetnif3tatoa ran i t)trxoxr3ny1ame lnvs s)sDrrxr ;o4tle iiciyslmDrmnmont) eermoctadfmD lnvo;t0 etrxm3no1olee fes (  2rrxr ou4olx mi3iyt m2rm(vs u0texoxr3iydoa eauvs t)trum(r3oudam n nciltf rrru  ;o0tpxnio3ias m rmu s u0 eenxr3iy1optraivi;s0 euoxr3iy1lleemnvtlt)artau o;u0texo f3tydlmDul(mp u) eerircio1latelivs;s)setrim iu4lpeelici s)s2rrum ;u4apeomoeiaslm ulnms;()alerif3tatfa eaiei s0 eurxm3nydaptnmnviltf rrauro;t1alx ifciaslsDra( o;(4texnxo3iy1lm rlnes;()sexrirpnudome mivsas) Dra(monu4tlxnmi3tltfm elnmsnu4trxrmo iytfmtr nvilt0sruoio iodom nlfctls)s2um( ont4apeo oetatls ua(ms (0 ltnxfctodfa rluvi;s0teum(r oy4oltelnvsat) 2rrx  nu4optoii3tadlaDelums (4trxrmrciodoa eai slt0 2xm(r oodap elfesltf rraxm ;o0tleniocildfa2rm(msnu) ltoio iytfp e ieol()s2umio3io1ape  ivi s  Dtaxro;t0tex  ocils s2em(vp t0trtomr3oydlm elnvs;t) 2xoxopoy4llen iciat sDtaumo;o4tlen ietytfaDrln s t)tlxnxr3oatopDraivi;( s2tmxo3ny4ol e fei sf rrr(ront4tltniociad aDumnmo t0trxoir3totfpDrluvi s0s2toiopny1openmfvtatfsruaurooo4aetnmocilslsDra( o (4aexrxr3iadlm   ies s0 exmxo3ou1ap  mfetatf Draxm ot4texniictltla2umnvo;t0 exrxf iatlptrai ol() 2umxm iydlpenmietlsfaDra(rpnt1tlxoioeildfa ra(ms (0artoiocoy1laD ai i;s0 2xm(r3ny4lme lnei t) Dur(  ;t0opxnmi3tad a2ranvp (4arxoxociodfm   n o;s0 2xm(rpnu1om emivils srrmumo;u0aetoio3ildfa rmuvpn(0artnio oatfa eai s;t t2uo(r iodlp emnvias  rraxrpno4ale mf3tltlmDumump (4tltoirctatlmteli s t) 2uoxo no4lleelnvil(fa2rr(r nt0tpenmiciasfs2rau o;u)arxnxfcia1opDrlneo t)srumxopou4lp e ivils)a2rmum nt4tlxnmictydls ulnmo t4tltrif to1oat li i;t0 rxrxo3nydlltnmies t)arum(m nu1oetomieiydfs2umu ont0 exoifcoo1lmDeaues;t texoxopoo1opt mneiltfa2rru p;o0openmfeiltfsDrm(vo;t)trxnir3oydfpt au i s)srurxmpou1omeemfvtls srtrxmont1tetnif3iysfm2uanvont0aexrxo oa1opteln o ()sexoio no4al  lnvt () rtrur nu4aeeomoeildlsDum( pn()tltrmr3tatfmDelnei;(0s2tmim3oydam  licsat arrmurpou0altniieiysls2ulu ont4trxnio iy1oaDe neil()srurio3iydamtnlivslt) rur( ono4altnif3iatfm ea(vp;t0 exnxo3ta1latrlueil(0s2ur(m3iu1lptn ietltfaDtaxmp;u1texo fetld aDem( p;()aexrxr3ootfateluvo;s)srxrxmpnu1lme  nct tfsruau pou1tle io3tadfmDrmnvont)trermf tydlmDeaivi s) etrim3nu1opee ics sfsrtru pno1oltnio3ild sDuanmsnt0altnir oo1omDranvs t0 2xr(rpio4op   fviasfarra( ont1apeo fetyt sDum( sn(0 lxoif oytfateln s t)srumxr no1ap  mfet sfsDua(mpnu0tpt mociytlsDranms;()teeomf3totlm eliei t s2uoxm iudam eliviasfa2rmu oot0oexnmoeiat a2umuvsn(0 lxnmfcio1la e uesl()trxrim oy4ole lfcilt a2rauroot1tpeoii3tat a ua(mo;u0tetoir3iadlmDeanvs (0texr(r3ny4lmeemieiasfa2rau  ;u1aetnio3ildlsDumumo (0 lxrxo iatoa elnvo;t) 2toim3oo4apen fct (fsrurx  nt1oetnif3tasls2ean o;u)arxnifcta1om r ivs;t)sexr(r3iy4lle mieiltfsDrrxr oo0oetoifeiat aDrlumpn(0teermr3oodfatrlueo;s0s2uoxr no4opeemnvtlt) Drax ono0tex mictlsls2ulnvp t0aeerio3io1fm   u s;t texoio3iydalt livias arrmurpnu4altniocilt a2el( p () rtnxocta1oat auei;t)s2urxm3iydomtemicsas)srta( ont1opx ii3ilt a2rl( s;u)alxrxo3oatoa r ueilt0tetr(o iodlme  neslsfs2ur(m nu1ole  feiat a2em(monu0 etoirctotlmDeai i;t  etmxmpiu1openlivtas) rrr(m ou0altnmi3iadls2elu onu4trtnmo3tytfp  ln o t)srxr(r oy1al  miesas)arumxm nu4teto oeias s2em( s;u)tlerxfciytoa eaivi t)s2uoim iudol nmivs t  Dtaxrpnt4tpx ifeiysla el(vp t) rxnxo3iydfm   nvi s0setoimpou1apeelicsa(faDtrxrpnu4tlx ifctydfmDrau s;t4 eeomfcoy1fa  auei s)s2umimpno4openmfvtlt arurxronu1tpxo oetat a2um(ms;u4arerir3iodomtrauvilt teumir3iydlme lfvtl() Dumxmp;t1tlt mf3iydfm2umnvs;u0 exoxf3iadlm eaivi;t srxmxopno4lle lneta() Drr(r ;t1oltnif3tlsfm ulnmpn(0alenxf3iotomtr iei;t t2umir3nodlp emietlt arumxr no1ope ifetlslm eln p;t0 ltrxrcia1om  lueo;()setr(o ou1op emfeils  2urumpot0oex mf3iasfs2ea(vo;t)aexnio3oy1om r n s s0seumirpou1lmtnlfcslt)a2rr(r nu1tlen o3iad a ea( p;u0tetoir iatfpDe u il(0 2tr(o nodlmte ncilt)sDtau ont1oex  ocilsls2eauvs;(0trxnxo iytfmtelies (0 exrim oy1apenmnci sf 2rmx  ;t0tlxomiciydls elumo ()texnxfctydfmDe n il() etr(opoydll e fvsas)a2raum no1tet  fcilsla2rl( p ()tlxrxfcio1lm r n s s)trtr(o nu1al  lfciatfaDrrx pot1opx mo3iad aDulums t0arermf tatlpDeau o;(0s2triopoo1llt mncsl(f rum( oot4tlt iocildfs2umnvo;()trtrxr iydfp e ivslt)s2ur(rpny1altnlictlt) 2tr(rp;t1tpx io3iydfm emu onu)trxoxr3tytlp r neil()t2toim3io1lmee ncsasfsruax o;u0optnmo3iyd a ua(vs u)arerxo3oatfp rlieo;()t2uo(rpiy1lptnmfcs t)sDua(  ;t0alx mocilslmDrlump u)tlxrmf ta1lpt  ieol(  2xriopnydal  lnviat arrmurooo4ale iiciltls um(vp;(4 renxrciydla eauvs s)srum(mpno4ale  ncsas)artaxmooo4olenioctyd a2elumsnt4trxnxf oa1latrau ilt0setriopny1om elnvtat aDurx  oo0teeo ieilsfa ulnvo t0trxrxf oydlpteau i;(0srxmim3ny4al nlncta()srrru p;o1apen feiadls ua(ms;t0 eermf totlptean s;(0 2xoxo oudlmen ivi t)srum(mo;o0alxo ociydls uan p t4arxrmrcia1omt aivols) exr(r3no1ale mieta( aruau  ot4tpto ieiat mDrmnvonu0aexnmr3ta1fmtraies;t) 2uoxo iydolen icils  Draurp;o4tlxomiciadls rm(mp;u4areoir3oy1om rluei s0 ruoxmpoydameelietl(  2rmumpnt1tpxn oeilslm2ulu s (4 rxoxr totop  lueolt setm(opoydopt mncslt)s2ua( pno1oltnmo3iyd m umu snu)tlxrmf iy1laD au o;s0 etoxrpny1olte nctas)a2uaxmo;t4opxoif3iltlmDuanmont4trenio to1fa r u i s trto(o oy4amt livs t) 2urxm oo1aet iictlsfm2ulnvpnu4alermr3ia1lpDe neols0 2umim3no4aptnmnvil()aDta( oou0alt if3ilsfsDrm(ms;()texrxo io1fmt luesls0s2trxo3oydom  lfeil( sDuaxroou0oetomfctyd sDul( pnt0aetnir to1opDraieo s srtr(m3oo4amenlivtat  rra(rpnu0oeeniietadlaDelu p t4arenxr3oy1laDraieols tetoirpiu4om n ivias aDuru pnu4tpxo fctatfs2uan p u)artoxf iodfpDrli sls0t2umxopny1lp nmnetls srra(rpoo0apt mfeiytfmDrmn s t4 etomf3oytoa eluvo t0s2xr(o nodale lfvsa(fs2raxmo;t1alt ioeiadfa rmuvsnt4 exoif iodfmteaieo s) rxrxopoo1ol n nesl( sDuru ono0tlxoiociytfm umums u0tlenio ta1latraivi t) 2ur(m3nodlmt mnciat) Dta(ro;u1tpe mf3iyd sDrln sn(0trenmr iytla   neo;s0 2xoim nu1omenlicils s2tau  ou4aexnif3ias a2rlnvo (4arxnif3oo1fa ran s;s0srxm(mpnydomtnlieta()srrm( p;o1texomociyd a eanvo;t0tltoif3oodfmD  neo s srxoiopoydlpt micsasf rtru p;t4aet io3iat s ean o;t)aetomfciytomDe neo t)s2uoir ou4lm  lnct s) rtmx p;t0altnifeilt m2uanvo u0areomrcootlpDr nvi;t s2urxr3nu1alee fci t arrr( pou0oetnmietltfmDrmn snt)trxniocoytfp  ai o;( setr(m3no4lm nlncils)srumx  ;t0tpenmociltfmDemnmp (4trxrirciytlpteauvo t  exrim3ou4lpen netasfsrta(mpoo4texn oeild a2emnvo;u0tetnirctadlmteln i;s)tetr(o3ny1opt  fetas  2tmx  ;t1oleniicilt m2uau s;(0aeenxr3oa1fmtean i t  2urim iydlm nlivsl( a2urx oot0aptoioctlsfm eanmo t) eeoxf io1opDeaues;t  2trxr3oydale mfcs s a2rm( o;u0tltnioeils a ul(vp u0trtomfcty1fptr nes s t2urim3nu1lltnmnetlt)artmur ;t1optomoeilt aDrm(vsnu0treoifctodlatr i s s)truoir3oo4am nmnvi ()sDrr( pnu1opt  iciad a el( snu)aeenxo tatomtelueslt  2tmxo no1alt mictlsf Dtmxrono0aleoifciltfsDranvo ()teerirciotlpt lnvolt0 rto(m3nydlm e fctl()s2raumpnt0openmoetyd s2ra(mo t0 lerxoctydlmtraieilt texmxr3iodll nlics t s2rmx pnu1opxoifetad m rl(msn(0trxnmf oadfptr iei () eum(mpiu1amtn ivsasfaDrr(ronu0tle  ietldls ua(vo;u)trtoio io1la r ivslt) etoxr oydlleelivtas)arrrxrpnt0teenmiciadls2rluvsn(0aetnxfcoodla  auvi (0srxmxo iydoltnlivi sf Dtaxm ;o0oexo feias sDrln p t4artnmr3ta1opDe n i t0s2trxo3io4omtn nvsls) rur(rooo4tpxnmoctas m2ea(mpnt0arxrir iotomt lueo;( trumxopio4amtelfvi tfsDtax p;o0tltnmieiytlaDem(vsnt) ltrmr tadfp r ivi t)trtm(o iydoptemfvtat)srrmxrono4olt mfeiaslm2emuvsn(0treoxo oy1opt luvi t)trxrxr iu4oltnlnvi s)aDtmx  ou0ale  ietltfm2rmnvp;(4 lxrif3oy1faD luvs;s0 etoio3ou4lpe  fciasf rta( ooo1texn f3iydlsDumnmont)tetrif tytomtrli i;(  2toirpio4lme mnvs sfsDtm(rooo0opxo fctld sDeanms t4 rerif3iytfp ran ols0texoiopio1lmenlfvi tfsDrr(mpot0tptomfeilsfaDrln p;(0artnxr3iytfpte ueil()srxoxopiy1om   iciat  2rmx  ot1aex  icild aDua( o;(0 lenxo tatfpt  i s;s teumim io4opeemictas aDtrumpno0alxo oeiltfs2uauvo;()tlenio3to1fmD auvi s0t2urxopiy4op elies sfartrxro;t0ole  icils aDel(mp u4trenmr3iadopte ies;( trtr(o3oo4alte nvta( sruru  ;t4tlx mocilsfs ul(mo;()texnxocoa1omD  ieslt0trxoxo3iudlp nmnetas)a2taxm ;o4aeeo ieiltfa uau o;u)alxniocoo1fat auvo;( truoimpny1ol n nctltfa2rrxrp;u0optoiocildfm2ua(mo;u4trxnxfctotlp eln s;t teuoxo ny1ll nmivslsfsDrru oou4aeenmfeiltlsDem(vp;u)altnmf3ta1lpDrlueo s0s2xmim oodomeelneslsf 2taxmp;t0ale mieiat a rlnvo;t0arxnmr oadlp eaiei;() rtoiopiy4lp  mnciat  Duaxmpnt1aeto fciyt m2el( pnt0tleomo iotoa  aivslt teur(rpno4lpeelnvtlsfs2rm(mo;u0apx  o3iat a2ua(vonu0 rtomr3iodlm eauvi (0 2toir iy4lpe mictl( sDuaxr ;o4optomi3iys sDumn o u0aeeomo3iadla   uvs t  ruoxmpiy1opt  nci t) rrrum ;o4tpenmo3tys a emumsn(4trtnir iadla e uvo;t  2uo(mpiy1ll n feil() rrrxm ;u4aleo ociyd a rluvp u) exoir io1lmDe i slt0texoxopnydope lneiltf 2tmur ;u4tlto ieiltfs umnvs t)tlermf3tatfp elivi s0trumir no4ap nmfeia(f 2tru p;t0alt mf3taslm2rl(mpnt0areriocta1lpteliei;() exrxmpiodamt lncilt)s2rmxro;u1aexniiciytfaDel(monu0artnif3oa1fp eaies;t0srurio3iydal nlfcsls)a2tm(mpno1olt mociysla2uanmo t4arermf3oytoatr u i t0 rxo(opiudop n fcs s a2umxront1tlx ioetatfsDum( o;(0altrxo iy1fpt aueslt)srtm(rpiydoptn ies () Durxmpno0aee ifetlsls2raums u4 etrmocoatomtranvols0t2umxm nu4lme lfvt ()srraxmo;o0opt miciytls2elnvpnt4trxoxrctydlatelnvo (0s2xrxm3ny1lmtemnesat)aDta( p;t4tet moeiysfa2rau sn(0 exomr3ootom rlivi;s t2xmxo oo4ale mfes ( aDtrur ot4tpenmiciasfs2ulumsnt0alxoif3iodla r ies (  etrim oo1om nlictls s2ua(  ;u0aeeomi3iytfs uan pn(4 exnif totomD an o () rtrxopoudomte fes t sDrr( oou1olxo ociytfmDumums t0artoxrciy1lp eaneils texoxr3no4ap emfvi ( sDrau o;o1ope mociat a2ulnvs;t4 ltoxf3totoptranes;(0sruoxrpoydamenlfetatf 2trxrono0oltn fciysla2emu s;t0 etnmr3oytop   i s;t)t2urxmpny4amen iciat)srtr(  nu0oeeoiieiaslmDeln pnt4 etrif3ta1oaDeln i t0t2um(o iudop emncslt) Dumxroot4tpen i3ils a umums t0aexnmr3oodlptelnei;()texoir nudlpeelnetls a2tmx  oo4aptnmfctatfmDul(ms;t4aetoxf oy1fmteliei t)t2toxr iydop emfetasf rrax  nt1apeoif3ildfa ulumo;u4 reoxfcoytopt ai s;t)texr(o oudam nmnvsas  2rax pnu4tlxnmocias m em(mo;u4trerxr3oytopDelnesl(  rtr(o3nudllen fvsls  2umx  nu4altomo3iyt s rln on(4 ltrmf3ta1fmDe iesl(0srtr(o3ny1lptn fesa( arrru o;u4ape  ictadfm2rlump u4arenif3iodlmD lies;t  rtmimpou4alte fei tfsrraum ;o1tpx moeiysfs ulump t4artoxf iydoa raneo;()tetrxm3oodlptelfvsatf rtru  ;u1texn ietlslaDemump;t0 lerio3iatfp rli slt0trumir iodal emieiat)srraxmo;t1ale mfciadfaDuan p t4altrir ia1lmD anesls)tetoxm iu1apee neias  2um( pou4tltnioctatla ran p u4alxniociy1omt au i;t0 eur(o iy4ll nliei t)s2ua(rpnu1aexomf3tys s2emu p (4tleoiocoadfm rlnesl(0t2tmxr nu1oleelfctl(fartm(rp;t4tpe  icildfsDeauvont4tetnif tydlptelu s;s tetmir3nydol emietl()srtmur ot4oexnmi3tatlaDuaump (4trxrxf oadomtrliei (0 euoimpno1lm emies sfsrurum oo0aet moeildfm uan s;u4 renxf tytfm r nes;()t2trir3oy4ame  ncsas  rumu ont1tpe ioctysfa2ra(ms;u4 etoxrcto1fate ivsl()t2uoio3ou1lme mfci t artm(  nt4opeomocilt m2ulu o;(0 ltnio3ia1om e nvs (  2umxo3ou4ll   fvi t  rrmxr nu0oexoioetyslaDum(vs t4 eerir3ia1fa eaueilt0texriopoo1am nmneiasf Dtmx pno4tlto f3iytla uau o () exoir tytfa  anes;t)s2toio iydam nlncs sfa2tru pno4oeeo iciyd mDuln o;(0teenmo3totlmtrlueo (0s2tm(mpoy1op emictl( srtaum nu0alenmi3iasla umuvpn(0tltrxr3tadfatr iei ()truoxmpio4omt lfvi t) 2tr(rp;u4tlenmfcias mDulnvp;u4alermo oytfa ranes;t  rxo(mpiy1ol nmnet ( a2rru  ot4texn ieiasfa umu pnu0texrirctotom ean ils0 2xo(mpiodllenmivia()aDtm(rooo0tlto o3tatfs2umumo t4 exnmr3ootfp r ivolt)s2xmirpiudam  lnes tfsDraum nu4aexoiietyt a el(mo;u) lxomo3iy1omD lnvi ( t2tmio iydlpt mfesltfartrur nt4tee if3ilsfmDul(monu0aeerirctytlate uvo s s2trxm3oy1alen ivsatfsDtm(m nt1apt io3tlsla2ean snt4aetrio io1op eli ol(0 2xmimpiy4amte fciasf rraxr no4tlx  octydla2rmums;u)artrxo3iadfp rli i t)t2toxm3nodamt licia() 2trxmo;o1oex mfeilslaDem( p;()tlxnxo to1fp e ues;()trxoir nu1lp nmieslt  Drm(r oo0tleoioeiltfmDrlnmp;u0 rermoctydfpDrauvilt) etrxrpoo4ll n nei s  2ur(  ;u0texnifeiatfaDelumsn(0aexomf iytlaD lieo ()srxmim3ny4olt lfctlsfsrua(m ;u4ole io3taslsDeanms;(4tetoio ta1oatr nvi (0 rtr(o iudlptnmncsl(  2ta( oot4tet ii3tltfs rlnmp;u)aetrmrciytfpDe ieilt0 rto(o iu4ape mnvslsfarurxrooo0olx mfctadfaDranvo;(0tltrifcoydfat aiei;s  2tr(r nodoptnlfvs () rrax p;o1oeeomfciad a2rl( s;t4altrxr3tatfmDrai s t0trxrxr3nu1lmtnmfvslsfs2uaumo;t0alx moetyt s2elu snu0 etnxrcty1op  aiei (0truoiopiudope lfciasfartmxm nt0aleomieiydfmDua(msn() ltomfciy1lm   i ol(0 rtoxm oo1lpte fvtl(  rurxmp;t4opeomo3iltfa2ea(msnu4alxnxfcty1lm  aieol(  2uoirpiu1al emnesat srra(mo;u4aexniictytls rm(vonu)alerir ta1oate uvs t)seumxo3iu4ll eliesasfaDumx pnu1tpxomictydlaDem(vs u4tetoxr iy1om eluei;(  rtrirpno4op e fcil( a2rr(mp;t1tetn ieiaslm em(mp;(4tlenxoctydfp   ieo ()trxrim nu1lp e nvtasfs2uaumpno4ape  ieils mDrauvp;u0arxoio iydom   i i ( seurxm3oo4am n fei sfsrrm(  ou1alxnmiciad aDel( o;u0texnircio1lmtrli s;t0seur(o ny4lpe lfvtl(fa2tr(m ;t4aex  feiydfaDul( s t) ltomocto1fatr ivi;s texo(o nu1altelnctl(  2ur(moot0alxo feiad s ulnmp (4arxnifciy1fatelieo;s)s2trio nydlltnmfcias  rrru onu1tlxn i3iysfs umnmsn()alxrio3oatfaDe uvols0tetmxmpnu1ap  mfet ( sDrm(mo;t1apx ii3ildla el(mo (0tlerxf oy1lpD  ueslt)s2tr(opnu4lm   ieil() Dtmxm nu0oltnifetlsfaDumn p;u)aexrmocoodoaDrlnvs;(0texoir nydlle mfes t arrm( pot1apx ii3ilt mDeauvonu0teerif tytoat  ieo (0srxrxm iy4al emnes s arra(  no1texo i3ilslaDeln s u0aeenmocoa1lpteanvo;s)t2tr(opnudomtnmict tfa2tau o;u0aex  o3iysfs rlnmp (4 rxoxocoadlmteanvs s srto(m3oy4lmtemneta(f Drmurooo0olenifctys m ranvp;t0texrir iatfaDraneslt)trurir3nu1ol elnvtas  rrax poo4altoii3iys s2rmu o;u0 eenir iodopt au il( srum(m oy4opt  ics sf ruaxr oo0ole mf3iydfs2ua(ms (0aetrmf tatlat aueolt0sruoxo3iudlm elnvilt  Dtmur ou0altn fctlt a2el(vs (0 lermf3oo1fpt li i;s0teuoxo3io1aptnmieslsf 2umxro;o1opx ifetltla2emnvp;u4tlxnxrctatlm rlieolt)t2trir ny1ol  micslt aDtax  nu4alt  ocilt s elu on(4aeenmrctytlatrln i s)seurirpiy1ol  lfcs ( sDtrxmo;t1tlenmictytls2em(vpn(0trtoxr3tadlatrlies t s2tm(o no4lpt lnes () rumxr ;t1aexoif3iad mDrl(vpnu)aeermoctatop raieolt0srxo(m nydlptnmnet s s2tm(  oo4optomiciatfaDulu pnt4 etrxf oatfa  an i t seumxrpiy4llte feilsfarumuront1aptnif3tadfmDemu p;t)tltnxr3iytlatranvs;( sexmxm iy4ameemnvsl(fa2rmxr no1apxomfciadfm rl(vo;u0aetrxociotopDe u o;(  2umxr3nudll nmivsat srumxr ;o0oetoifctad mDra( sn(0 rxnxr oo1fm eau ilt trtrirpoodlptnmivsls)a2ururp;o1opt  feiat sDul(vsnu)areomo oadfmD  n s;()trurim3oo1ome mnvtlsfarur( pot1oleo f3iydfs em(vs (4texrmr3tadoat an i t t2xoim iy1lltnliet t)srtrx  no1ope ii3iytfa rm( s u0tltnif todfa  auvs;(  2xo(opiy4op   ietlt aDurum nt1oexomieiysfs uauvs ()areomf3oodfpDrauvs s  etriopoudlpen ncsat  2rmx  no4olx  o3ild sDuluvp;t) lxnmr3iotfmt li s;t setoio oydam   icsa(  Drmxm no1oet io3ilt a ua( pnu) etrmf tydlm rluvs s) 2to(r nu1lptnmnes s srurxrono0olto i3tad a rl(ms (0arxnxf oo1lmD  i i ()trxmxr3oo4am  lncta()aDtm(monu4apen iciltlaDuanvpnu) exrmrcta1fatr u s;s0 2uoxr3iy4lpee netlt)arrmx oou0altn fetlt a2rl(vo u4 rtnir3ia1fat lueolt  2uo(r io1lm emnvs (  Draump;o0tlxoifeiadfs2rlumo (0 ltnirciytfa r i o t) etr(m3nodaptn icsa() 2trx  nt4optn icils a2rm( ont)artnxr3oadfmDe uvi;t0 2um(o io4lm   nviltfsrta( pnu4tpx mfctadlmDua(msnt4 reoxr3oa1om raivol()sexoio3no1lltnmfesl()a2um(m ;o1alt ii3iyd a2eau pnt0 rerxo oadla eauei;(0srur(o3oy1apenmnes (fs2ua(mo;t0aetn i3tltlm elnmp (4 lenmocoo1la e uesl() 2uo(o3oodllte ieiasfsDtaur ;t0olx mfctyd s2rlums;t4alermf3iodfmDe neol() ruoimpno1al nmnvtat) Dtr(rp;o4ope mf3tld a2rmu s (0tlxnxf tadlaDrli olt0 2xrxm oudlleelfvt sfaDtrxr ou1teeo o3iydlsDrm(mo;u0arxrmf oy1latrlues t trur(r3iodapenlnvtas)s2tmumo;t1tpto octytlm eau o;u) exrxf3oo1faDrliei;(0t2tm(o no4amtemfes t)a2tr(  ot1tet  feiyslsDelnmpnt4aexrxr tadlp rlneolt  2uoxo3oy1al nmfesls) rtr(mpou1tpx  ictasla rl(mpnt)altoxocoy1fa e ivi ()setrxopio1lp nlfetas)sDrmxm ;o4opxoii3ilt a2ulnvp u) rermo tadfpD  ivilt0t2tm(o ou1am  mnvt ( aDur(  ;t4opt miciyslsDel( pn(4 lenxo oy1fpt li s;s) 2trio3io4opeelieslt arrm(  ot4aetnmoeilsfmDrl(mo;t)texoif3tydlm rln ol( setr(m nydomte netlt)a2rrxrp;o4aexn oeiytlm2ra(vpn()alxomr tatlm r ues;( trxo(m nodopt mfctas) 2ua(r ;o1tptnmocild m2uln s t4 rtomo oadlp rau ils)trxmxo ny4omenmfeil(faDrr(m ot4opxniietys a el(mp;(0 eeoxf3totfmD lu i s)s2toxo3nu1omt mncs (f 2rmurp;u0oleomoetydlm2emuvo;t)tetnmo3ia1fmteai i;(0t2tm(rpiy1lmte nvsltfa2uru ont4alxoii3iadfs raumpnu)areriociatomt lieol() exo(m3iu1lltn fvta()srraxr ot1tptnio3iysls2emu s;t0 ltrxo oatopD ai sls)t2trxm3iudlpee fct s s2trumo;t0oee  ietysls elnvp u0 ltrmr iadop e uei;t  2trxr3iodap nmfctlsfsDra(r ot4aptnmfciyd s ua(vo t) rerxf3tadoptelivsl(0t2um(o oy1ol  mfvtlsfa2trumont1apeoio3tas mDra(vs;u) lenmrciydlaDean o;s0 ruo(opnodoltn nvs t) 2tax p;o4ole ioctyt s2eau pnu) exnir3tadlat aneslt t2xoxm iodoptnlncsltf Duaxmp;t0ale  oetlt m rlu pnu0tetrircta1fp r uvo;t) euriopiy1lptnlivt (fs2rax  ;o1oleo icilsla ulu snu4trxomr ootlaDr ieil()s2uoxo iy1ap nmncs ()arumu  nu4oexomi3iysfs ra(vsnu4teerifcoodfp  lu i ()seurxmpou1ope miesasfsDraxr oo4apen i3tadfs rau on(0 etoif3oytfp raies s) 2xmxm iy4lp e netas  Drm(r no1aet iictlsfaDua(vs u)trtnmr tadomteluvi;() etoio3iu1alee iesa(f 2ur(mo;o0olx  f3tys aDrlumo;t) exrmf ty1lmt auei t0tetmimpiy1lltelieil(  rrr(mooo0olxomfciyd aDrau s (4 ltnmfctytomDeanei;(0sruo(rpno1ame liet s s2ra(monu4ole iieiltlm umu s t4tltomo iy1la   i sl(0 ruo(m3iudopt  nvsa(f rtr( p;t4apxomf3iat s eanvp;u4texomfcoadoaDeai s;()trxr(m oo4ol  mfetat srtmxr nu1tetnmociltla2uauvo;u0tlenir iotoat luvo;s) 2xmir iodol  miviltfarumx p;t0aptnmociyt s rlnmp;t0tlermr oydoaD  u sls tetm(r nodal nmneilt)srraumoou0tet iieiad a2em(monu) eeoio3iydoat  n sls0 exr(opiu4lme mncs s) Dua( onu1tlx  ietadls2rm(ms t4 rxomo oo1la eaneolt) 2xoxr nu1lp e ncils srrrx  oo4alenio3iyt s2emuvsn(4aeenio3iodla e n sl(0srtrio3nudll emneta( sDururpoo1aexnmf3iyslm ul(vs t0 ltnmf3iotomDrlueols0t2xmio iy4lp   fct s s2rru  ou4opxnmoetaslaDumumsn(0teenmo3todlatr ivsls)setmxm ny4olenmivia(fsDuax p;t1tleomietlsfs rm( pn(4teermr3ty1lp r nvil(0srtrio3nu4lle mnvsasf Dtmurpot0olenii3iad a2umnvpnu4 lxrmfciotfa eaueo;t) 2tmxr oy4lm nmnei ()arrau pot4tpxn oeiys a2emn o;t4tetomocootlatrlueols) eurio iodom   fvils  2taxm ot0oee  i3ildfm ea(msnu0artnmr3iatlaDe ieo;t0srtoxm3oo4ol emnei t) Draum ot1apt  fctltfaDeanms u)alenir3tatla  liesls) ruoxm3ou1ll emneilt sDurum ;o0oexoifeiatlm2rlu s;(4arenmrcoy1fptr nvsl(  2to(opoy4lm e netas)a2tm(rpou1opxnmf3tlt a2rl(vs u)tetnmr3oatfmDelneo;t0srtm(r oodolte fet t s2tr(mpnt4opt mociydfaDelums;t0 rxnir3io1lp  livsl(0 2to(o3iodal emietatf 2tm( o;o0tpx  ociltlsDumnmo (0trxnif oytop   ivi (0 rurir3oo1ll nmfcil(fs2uax  no0ale  ieiys m umu pnu0aexoxo iatlaDr i o t setmxr io4ape lfctls  Duaxmo;o4tetnmfeiatfs2rluvpn(4altomocoy1lmteai o;( s2tr(rpnudll   nvsa()sruru  nu4aet mociadlsDeluvo (4tlxrio tatfm r ieil( tetm(r3nu4lmt lfeils srumxrono4tee  o3tad m2rl( snt) rtrmf ty1opDeln i;(0 ruoxr iu1lmt lnvi tfs2rmxmpnu1apt miciyd mDrmnvont4arenif tydoat  ieo;t)truoio3nu1op  mivi t arrrxm ot4oltnif3ilt mDul(mo (4arenxf to1lmte ues;t t2xrio3nu4lmtnlnvsa(fsrraxrpnt4aleomoeiatfa2em( on() leoxr3oytlmtrlneolt) rxo(r3no4ome licias sDta(roou0tetoifciysla2ulnvo (0alxomo3todomtr ueol(  eur(mpou1omte fct t) 2ua(  ;o4tptnmiciys aDeau snt4arermo iatfm  lnei;s trumim oudoltn nei sfs2tau oot0oexnmietasls ul(ms;t0aeerxf3iydomt luvo t)seumxr3oo4ll emfes ()sDta(m nt1alxomicild m raums u4 rxrxo iadlmtrai i;s0texoxr oy4al e nei tfaDur(monu4oltoioctysfm uaums;u4 renir3tadlpDeau i s)srtoxr3oo1omtnlfct sf rtr( o;o0oexnmietyt m emn pn(0 rermocta1op  aivi;( texmiopou4lmtnlfvias srumu  ;u4optoiocilsls2em(mp t)texnmfciydfa e uvs;s)t2umim3iudal e netls s2uax ooo1texo fetys a umnmp;t0aexomociatlaD  nei s0srxmxo3iu4openmncta( aDumu  ou0teeo ieils sDuanvp u0 reomocoatfaDraieil(0t2to(o ou4lp eliei s)artm( p;t4olto oetys aDua(vsnu) etnxf3oa1la  ln i s0 rxm(mpnudom emnct t  Dtaum nt0tee  feiyt m uluvo u4teermoctydopDrlnei ( truoimpoy1opte iet t)aDur(  ;t4aptniieiatfmDul( p;u4teeoir ootoaDelneils t2tmim3iu1lltn iesa() Dta( poo4tptomi3ilsfa2eln pnu) exomr iadlp r ieils)srxr(o iu1ll nlfesa( aDrrxmont4oeeoifetldfsDelnms () renmo ia1oatrli ils)srto(mpoudlpee ict tfsDrau p;u0tltn fciad aDuln snu4alxrmf oa1laD  ivolt  rxmim3ou4lptemivsl( aDtm( ono4openmociyd sDum(vpnt4tlenmociadlpteln o;s s2to(m3oo4lptemivsasf 2umumpou1oeenii3tatls2rm(vp;()alerxf3oy1fat lu s t t2xm(r3iydopenmics () 2um(mpot4olxn f3tatfm2rlu o u0 lxrxfciytomDr n s t)texrxrpiydlleemics s s2rr( pnt4opt mociasls umu s;t)aexnxo3ta1faDrai o;s0 ruo(rpiu4alen nvi s sDrmxm nt0open fetadla eauvp (0 etrmo iytfpDraies t setm(o iudol nlivilt)arta( o;u1oetn feiyt s eau p;t0tltnxrciy1lmD ai olt)sexmiopoo4ome mnci (faDuauro;t4tpt  ietltla2rl( pnt) ltoxociydlaDelieo;(0 2xmio3oodol nmnvs s) rumumpoo1oeenmoeildfm rau pnu)trermr3iydlaD aivs s)t2um(r oy1lmtnmnei s sDum(r no1texnifciyt s2ea(ms;t0alerxf ta1la  ln o (0seuoim oy1ol nmnesa( aDtrur ;o0tex mfeiatla2ulu p;u4 lxoio3ta1oaDr n ilt  ruoxr ny4lleemfcsat  2rmuroot4altn o3iysfaDemump;u0 rtnifciotomt lnes s)t2xoxm ny1olte fvt ( aDraxrono1opx  f3iyt m ranms;u0teeomfcoatoaDeli i;t  rumio3nudlpt lnesa( s2tru  nt1teenmiciyt s umn s t4aeerifcio1faD  nvolt)trxrimpio1amtnlnesas)arum(r no1tpxnifctlt s ranvsn()areoxf3ta1fpDe ueolt0seumxopnu4amenmfct t s2umxmpou4opeoiociyd s umnvsnt0 rtrio3tydla eaiesl(0srxmio iydopt lneias  rumxronu4aetn iciydfsDem(vs;(4aeeomr tatfp  au o;(0trur(r iydllt lncs (f 2rrxmp;o1opxn feiyslm2ra(mp u4altrir tytfmtr uvilt)sexm(r nodlmt lncilt sDuru p;t1olen ictyt m rluvs ()aetnxociytlaD  n o;(0 2tmim3oydopt mneia()a2uru oou0aleoioetltla umnvs u)aexrmocoatop rau i;(0 2xrio ny4ome mieiat artmuroou0oltn o3tyt m emn p;u0aexomo oatlaDrln ilt0 eum(m iy4lm nlncsl( srraxmp;t1alxnmfciadfs2ua(mp;t)arenmo3iodfptr n o s teto(opoydap   nvi (  2rr(rono1aptniictys s2umn p;()altoxo oo1fat ai il()srtriopno4al nlict sfaDrau  ;o1oeenmfctlt a2emn s;(0aetnmrcia1fpD livi;t)teurimpnydoptn nei (f 2um(r ou4oet moctydfs2em( p (4 lxnmf3iydla   ivi t0srtr(mpou4amte neta(  Duaum ot4opx ii3ild aDrmu p;()tltrif3ootfaDeanvils teurio3io4lptelieiat aDraxroou4tlt  feiyd mDelnvsnu4trerxo iotoaDe ieo (0t2toir3oy1ll elfetat s2tm(monu0alto ictysls2ran s t4arxnmr3iytfpDrlnvs;s) 2umim oodlltn nvt s  2um( pou4tpx  oeias m uln sn(4 rxnio oytlaDeaivi t sruoir3ou1ap   ivsasfsDumumpnu1teenmfetldlm ea(mpnu4tlerircoydfpt aneo;s trxm(r iu4ale mivta(f rrr(mono0oetnifeiatfsDel( o () lenxo tydfp r uei;s)srxmxo3ou4ape lfvtlt sDuru o;o1opt iieildfa2em( pnt0teerio3iotoaD ln s;(0 2ur(mpiu1amtn fvtl()arur(rpou0olt if3ilsla um(mp;u0altoxf todfaDe i o t0 rumxmpio1lpt mncsltfa2umu p;o4tpeomo3tlsls2eln pnt)artnmo3tatop   ivi t0sexm(o3no4lptnmfesat sruaxrpou0oeenmoctys s eln sn(4 etoir3iodfmt au s t s2tmir iodolte nctatf 2ra(mont0aeto fcildfm2elump;u4arxnioctytlpDe n ol(  rxrxr nodllt  fvilt aDtr( pno0oex ioeiasfsDua(vs;t0aetrxo iatlmt  ies;t0srxrxrpoudapenlfvtltfs2urx  ;u1olxnifeiatlmDem(msn(4alxrif io1fa ean i ()srtr(opno1ape  fvilt) 2uax pou4alxniictldfm ua(mont)tlxomr3iotla e u s;s0trto(o3iu4amenmictls)sDtr(r nu0oleo ociydfs2emnvs;t)tleomf3tatlm r ies s)seuo(m iudom nlnvsltfarrr( pot4ole mociadfaDem( s;()aeerircoo1opDr ies ()srtmxm oy1op  lnvsltfaDrrur no0apxn i3tysfa rluvsnt4 eermrciadfaDeau s t)t2xmirpnudllt  ics tfa2rax o;u1opt  fciatls ulnms u) leomf totla raies (  2to(opnu1am nlfcs sfs2tr( oot4tleomfciltfm2emnms;u0aleriocoatfmDrlneo;t) 2ur(rpoydol emieiat)s2rr(mono0alto oeiad s2eau o (4alerif3iytlmt anvols)srurim iy4ll e nvi t)a2uau o;t0tlxoifciys aDemuvpnt4trenxf3oa1optraies;t  rumxr3iu1lp nmncs s)srrr(m ;o1alx moeild s2umums;(0 rxnirciotomDeaivs;t0tetmimpoudape mfcs sfaDuau onu4opeo ociytlsDrmnmpnu4aetrir iytfm eaueo s  2xrxo ny4ame  fctl()aDtr( o;t1oexo ictysfm um(vp;t4arxnmf totop e nvils)trxoim3oy1lp nlnei ()srrrur nt1apt mfeiysls uluvs (4alenxf tytfatrau ils t2toimpiydlme livtatfs2rru  ;t0tpeoio3iatls ea(mp t0trtnmo3oatoat  i i;( teurxm3ny1ap emneilt)a2taxroou4tptn iciydla ra(vo;t0alxoir iy1fmD ai ol()t2xoxmpnu1lmee fcsas) Drax pnt0aptomoetlsls um( s ()arerxoctatfa rau il() rxrio3oy1aptnlivi ( s2taump;t1tlxo fctltlmDrlnvp u4alxriocoodlm   uvi t)s2ur(o3oodalenmfci t srtmu  ot0olx io3iad s em( p;()teerxo oodfmDraieols0s2xoim no4llee nvtl(fs2ua(mpoo1tpeomf3iysfm2rlump u)tlxoio3iotoa  lieo s) euo(m3ny4amee ncta()artrur ;u4apxniictydlm eluvo t4trxoxf todoa eaueilt)truo(r3ou4open ict s a2rrur nt4tle mociltlsDrlump;u4arxrio ia1omDrluvi;t0t2xrxm3io1lptnmivt tf rrrum ot0tlenmieilt m eln s;t)artrio3oydfmDrli i (0trtrim iu4opte neiatfaDrr(moou4oltnmociatla2um(vsnt4texoxrctydfatean ilt)srxm(rpiudom e fvsls s2trxm ;o1tpxoiictlt s ul( s u)teeoxfcta1fmDe u sl(  exoio oy4alee iesltf 2raxrp;o4oetnmf3tydlm rlumo;u)trxrxfcoatoaDrlivsl(0texrio3oydlmt  fesas) rtaxr nt4aee mociltls2ulnvo ()artrxrctatopteaivil( t2umir3iodaltemnvil()srrau  nt1tlxn ictatfs eau on(0alxrmrctydlm r nvils0t2um(o3no1lpt  feiat  Dum( pot4aetnii3ils s umnvs;u4 ltomr oydom r nei (0sexrxo3no1lmte icsat aDrr(  ;u1alxn fciatfm2umuvsnt) ltoif iy1op r ieo;s0s2urimpny4omtn fvsa() Draum oo1aeeo feild sDuanmpn(0tetrxo3oodlp r uvo ( t2xo(m nodlptelneiasfsDtaxr nt1tle mfcildlaDem(msn(4artnxrciodfmDeluvilt0 etrirpny1apee neilt sDumuro;t4opt iicilslm2rau s;t0tleoxr iydlat lnei;s0truoir nodapte ictlt  2rrumpnt4optnii3ilsfmDul(vp;t0tlenxo tadfa   nvo s)texmim3nudamenmieia()srururooo4aleoio3tatls umnvs ()trxoxfctotoaDrluvi ( truoimpny1olte feta(fa2taum nu1oee iieias m2uaums;t)teenxf3tydoaD  i s s s2uoim3ny1amt mfvtat)aDraxmoot4apeo ieilsfs2ranvs u)tltrxf3iy1oaD au i;() 2tr(m3nu4ame lietls  rua(r ;u1teenmfeiat s rau p t)aeerir3oa1omD  nvs;s texmiopoy4lltelivil(f 2um(moou4tpxn oeiadfmDumuvo t4tleoxr oytlpDrai i;t0srxrxrpiy1opt mfcil()a2rm(m oo0aptn o3iys m uaums;t0 rxnir3iytlaDrlu olt0 exrxm iydalt lnvslsfarrr(rp;o4tptn fciyslaDulnvo;(0 ltnmf3oadfm r ieo;( setriopiodlltelneslsf rtr( pno1tex ioeiysla2emn p;(4 exomo oa1opD aivil()sexoxr3iu4olt  netl()aDtaum ;u4apxomoetlt aDemn pnu0trenxr tytfa  livs t0sexm(rpiu4lm  lnctat  Dtrxrpou4olenifciysla2rmu ont)aetniocta1oat auei;(0srtm(rpiu1ome mnei (fsDra(mont4tpx  oetatls ranmo;t)alenif tytlmD anvo;t0s2trim3ny4lmee ivs t aDurur nt1tee ifetydfs2ranms t4treomo3oadopDeai s;s)trxmxrpnydope mivi s arum( oot0olxo iciydlmDel( p t0trtnxfciytfpD aues;s) 2to(rpoy1ap elfcia( s2rrxrono0aet iociat s2umnmon() exoif3oy1fmte n o;s)trto(opoo1alt lfeias) Dua(m no0apt moetyd a emn s u4trxomf3oatfp   i i;t)srxrxo3iydap elncsls) 2rmumo;t1aetomf3iatfm ea( s t4trxnir3ia1omtrlnvs t)srtr(mpoy4ll nlicslt  Dtax p;o4apx miciasfm eauvpnu)trtnio3ia1laDe u i t srtoir io4altnmivsat  2tru ont1tetomocilsla emnmp u4aleomo ta1oaD aivi s)s2urio io4ll  licils aruax onu4oexo ociatlmDul( ont4tleoif tadoa rli o;s0teurir3no1altn fvt ()artaxr ;o4olen ietlslmDrl(vs (4 rxnxr3totomDeanvi t setm(o oy1ll n ietat)s2ur( o;t4tltn fcias m2elnmpn(0artnmocio1faDelues t)trurio3oo1lptnmnviat a2taxmpnt0tpt mfeiytfm rm(vo;(0 exrmf3iy1op e ueo;s)t2uoxm3nu1lptelivsasf Dtaxm no1tlt ifeiadfaDum( snt4artoir tydop rlueils s2tmim3ou4omtnmnvsas) rtrxmoot4tpeoiiciadla2ul(vs (0texnir tadlpDeau o;( texoio3iy4lpe mnesa()s2uax  ;u0tpeo ietltfs uan o u0 renmr tytomt auvs;s)setrxo oydlpt mfcsat  Dtmu o;u0tpen feiltlmDulnvsnu0tltnmr iotom r ieo;(0teto(r3oudam   nvsls  2um( ont0oltn ietat m2em(vp t)arxnif3oydoaDr uvs;(0 rurimpoy4ome lncsl( sDrm(  ot1aex  f3ilsfs rmumpnu4 ltrmoctodomtr nvsl(0tetm(m nydap  mfei ( s2urum ou0tpeomo3tadfmDulnmo;u)trtnir oydfatr uesl()seumim nydlm e nesas)s2raxmo;t1oet  fciatlm2em(vpn(4 lenir ootlmte i il(0teuoxrpoydopee ivi t  rumumoou0texnmf3ilt s uluvsn(4tltrir ta1lpDranes;(  2xrimpny1llenmicsasf 2rru ooo4opeoio3iasla2rmnmp (4tlxnir3iytfm  au olt) rtoimpnydale livsltfsrraur ;u4oexnioeiytlaDua( o;()teermr io1fmt lnes;() 2tmir3ou1lp  lncsl()aDtaumoou4oexoifctatfa2ranvpn(4 lermf tydlm r uvol(  exo(o3iydlmtemneil(  rtau p;u1aexn fciad a ulumo;(4alerir3to1omDeli o s)srtmio3no4amt mfcia(f Dtmumono1aeeoio3ilslm2rmnms;(0alxomf3ootfp elueil() rur(r io4amtn fesat)arrau pnu4oltoio3iys m emumpn(0 etrmr3iytfp e n i;()teuoxo3nodom e fctls srtr(mpot4olx  o3tad m2uluvp;(0aetomrciydlptran i s t2umiopnydape lfesat sDtax  nt1tpxnif3tlslm rmn s;u4trxoxf tytlaDe u slt0 rumxr ny4lptnmiet t)a2ua( p;t0aexomfctls m uauvont4 exrxfcootfm rlues;s trto(m3iydope lfetlsfaDumx oou4texoiieiasls2em(ms (0alermo3oy1fatrlu i t  etm(m3iodam  lfvias a2rmxr ;t4tleo o3tld mDrau s t4teermf iydoaDe u o (0sruo(r oy4apt lfetltf 2tmumooo4ape io3iltfa2rm(vpn(4aexrifciydopD lneo;t0 2xoxm iy1lm  lfeil(  Duax pno0teenmf3iys s2emnvsn(4 ltnircoadla   ivi;()t2uoir ou1lp  mnvia(fsDur(rooo4aetoio3iadfsDea(vpnu4 etrxf3oo1fpDraneo s0trtoxr3nydom elicias  2ra(ro;o0alt  f3tld a2uanvon(0 rxrirciadlpteaiei s)trtmxo3iu1amen nes t sDtrxr ot0olxn iciytls2emump;u)aetoiocoydop e ivols s2xo(mpou4aleelivil()sDuaxmpoo0alt moeiytfa2um(vo (4 rxnmr tydfp  an s s  eur(o ny1op elnvtls)artaumpou0tltomoctad m2uanmp (4tlerif tatlateluvi () 2tm(r ny4llen fei ( sDum(m nt4teenmo3iatfs2eanmont4arermfcootlmte uei t srtoim ou1apee fvilsfa2ra(roou1oexoii3ils mDeln p;(0teenif3iodlpDrlivi s seuo(r3iy1amtnmncslt a2ra(m oo0oleomoeiytla2um( p t0 lxrxo3oatop elnvo t)srtoxm3iu1lme mfctls) Draxrpnt0tlen oetlslmDuauvp u4aetoio3tytlm rluvslt)trtrxr io1ameelfeiltfs2tmx p;u0tpx  i3iys s rlnvs u0artrmociatoaDeli i t) rtoxm no4lm  mnctas) rraxm nu4opto i3iydfmDrln s ()altoxr3tydfaDrlnvo;()sexr(m3io1lmtnlietlt)aDrax  ;t1tle  ictatlm ul(mo u)tetrir3oatoaDe ueo (  2xrxm3nu1lltnmnvia(farrrum nu1tlx  octat a2eaums t4tlxnmocoytfmDe nvs;t) 2ur(o3iydlm elncta(f 2umx  no0aptomociyd s elnvp u0texomo oytfaDraues;s0s2xm(r3iodll n nvsls sDtrx o;o4altnifeiytlm2ranmp;u0altrxo iodlp r nvo t  2trxrpou1lm n ics ()sDuaxm ;u4olt mfetasla2rlnvo;t0tlxrxo3tatlmDeau s ()s2xrxr iu4omte fvtls)sDuru pnt1oex miciysfs2ranmp;t)tltnir iotfmtrlnvo ( s2ur(o oydlmenmivtas)aDtm(moot1apenmo3tldla2emu pnu)trtrmf iadopDran o;s s2trxmpoo4al nmicslt)sDrmxmpnt4tpen oeiyd s ea(vo;u4tlerio3totfpte n o;t) 2uoxr3oudlpt mnct t)srtrxm oo4open oeias a el( pnt)tlermo3totfm  ln ols) ruoxo3oo1am  mictat) 2tax onu1tpto fctld sDulump;t)aeenif3oadlp  lues;(0 2xo(r3ou1olenlneias arra(m ;o1tpx  o3iyd aDeln pn(4tlxrxo iotomtr ivo s  rxoxm no4ope liei ()srrm( o;t1tlxo f3tasfa rlnvo (0trtnio tatfpt ln ilt0 rxmio3oo1alenlivia(farrm( o;u0oleoii3ildlsDemu o ()artoif3oy1oaDr u o;t)s2tmimpoydllenmietat) Durxroou1tlxnifeilsfsDeauvs;u4teenmociytomDe nvs (0s2um(mpou1ll emfeiat  2rrxmpou4oetomicilsfsDemu pnu0trxoxocoa1fp elnes;s) rxmimpou4lpt mnctl()s2tax p;u1aetnmociydfsDranms;(4 etrxo iy1fm e n o t  2urxm3oo4aleelietas)s2rmxmp;o1alxnmfctltlmDel( p t0 ltnmrcto1fpDe n s;t sexrim3oydomt  ivi t aDur(  ;u0ole ii3iydls elnmo;u4aeenir3oatlaD liei;t)trumimpiodapeemivil()arur( p;t0tetnmi3tytfm 
\ No newline at end of file
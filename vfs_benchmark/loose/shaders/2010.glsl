@@ -0,0 +1 @@
+ueolt)s2toxmpnudalen nvs sfsDrm(rpnu0alt ifciadfs elnmp u)texrio oatlmt livs s  eumirpno1om n iesatfa2rm(  oo1apeo octydlm ra(ms t4 rerxo3oydopD  i s s)srxmxo3iodal   icsat)srta(mpoo0optomoetlsfm rmnmonu4artrxf to1lp e uei t) 2xo(rpnudll   ieiat  Dur( p;o1olxo f3tydfa rlnvsn(0 ltoxo3io1faDeaivslt) 2xmio3iydoltnlicslt)sDur(rpoo0aptniiciysfsDemn snu4 lxoxocoadfat anei;t) rur(opoydap n nctatf 2trxmpnt4oeeo o3iysla2uln s u0trtrxocoytomtrlnes;t) 2xoxm3nu1oleemfcta(f rurur nu0oeto fctld a2rmumsnu0 rermo iotlp r uvo;t texmxr3oy1ap emfvta() Draumont1opx  f3iyt a2umnms;(0tltrif3oodfatelnes s s2xm(m3no1ol  mictatfsrrr(mpot0tlen octatlsDumn p t0tlxoif iytfmtrlies s0srurirpiy1open ivs t  Drr( pno0ale if3ildls2ul(vsnt0teerxo3tydlaDr i o s  exo(mpoo4omte nesl()a2tm(mo;o1optnmfeiyd s el(mo (4arxrxr3ty1lmt  u sls  exoim3nudomt licil(f rtax  oo1texniiciltlaDea(mp;(4 lxnxocta1om  lu sl( s2toxr no4oltemici sfsDtm(mooo0tpeniieild s eaums;t4trtnmfciy1fpDelueil( trxoir oo4op nmfvilt a2urxro;u4apxn i3iltls2uau s u4tlenmo3iy1lp rlnvils texmio iydamtnmics t s2ur(mooo1oleo o3iltla umn snt0tlenxociy1lmD aueils)sexmim3oodlpen fvta(faDur(r nt4olxniictlt m2ua(monu4tltrmr iodoa eanvslt0s2to(mpiu4ap nlnvs (faruau p;t4alx iieiadfaDrmuvsnu0 exnmr3todlpteluei t)teumir3iudolen nvia(fs2umuro;o0alt  oetysfaDemnvp t0alenmo3iotlp  lu i t)sexmxo iu4apee ncilt) 2tm(root0tpt  ieiltla2elumon(4tlermociydlmD aiei t0 2tr(o3oy4alteliciatfaDur(r nu1opeo o3ildfm em( s t0 rxrxr tytfaDrlnvol()t2toir3nodop nlfcsls) rtau o;o4tpxnifctyd s2ra(monu) ltomfciytlpDelnvo t0t2tmir iydlpenmnvtas aDrmxrpnt1optnmfctatla eauvp;(0 rtoxrctodomDeluvils) 2xrio3oodalee fciasfs2tmxmo;u4olxoiociasfa emuvs (4 lerircoatlp eaieil(  exr(r3no1llte nct (faDrmumonu4apxo fetlt sDumnmo;u0 rxoir3iatfa ranes t texoxm3oodal nlfcia(fs2um(moou4optoiiciatlm2rlu p;t0tlenio3ootlpt luvsls) 2um(mpoo4lm  miesls aDtr(mono0tee ii3iadlmDuau p;u)tetnmf oytfmtrai ols trumim3nu1am  livtlt) rrau o;u1alxnmieilslmDul(mont4trxoio3iydfpt  nvi ()tetmio oudapeelfet tfsDrmurpot0tpxn oetytfs2rmuvpnt0teeomf3iadoa  anvo;( t2urxo io1ll elivsas srtmx p;u1tptoiociadfa2rmuvsn()texoirctotlmD lnesl(  eurxo nu4altnmncil(  Drrxrpnt1teeomfcilt s emu pnt)tlenmr iodoa eli o t) eto(r oodll  lfeslt srrau  no0tet moetldlmDulnvo;()alxnxf3iytfmD luvs (0teurxmpnudal nmicsa()a2um(m oo4aexn f3ils mDulnmont)tltomo tytfatrliei s0 exrir io4ll n nvtlsf rumuront0apxoioeiydfs2umnmpn(0tetrmrciatlate uei t0t2tmxmpno1llte fvslt)srta(rpno1aex  i3iydfm elu s (0 eeoir ootlpDelu s t)s2um(m3oydalt mneils)sDur(m oo0alxoif3iatls2uln pnt)tltnio3iy1fpD lues (0teur(m io4ol nmivt s arrr(moot0oexoioeiadfs ra(vpnu0 exrxr3tydfmteaivi ( srtrir3nudllenmietls)aDtaurpot0altomoeilsfa ra(mp u)arenir oodfm   i s;t sexm(rpoo4al e ivtl(f 2ur(r ot1oet moeiatls uaumo t4 rxnircoatfmD an i;(0 2xr(opoo1lm  mnes ()a2tax  ot1aexn i3tlt a rlu p;t) renxociadom e ivolt  eum(mpnodoltemfcs s) 2uauro;o1aet  i3tls s2uan s u4alxnxfciy1op r ues;()s2to(r3iu1olt mfcs (f Dumxroot0tpxo f3iyslm2rluvonu0texrxfcoo1fpDrluei;(0 rxrxmpou1lme lfvs t)aDrrxrono1teenii3tlsla2umn snu0aetnxr3tydoaDelies;( texm(opoo1amtelict () 2umur ot4tex  fciltls umu o;t0texoiocta1fpDelu o s0teur(m nu1lmt mfei t) rurx oou4ape mo3iadlsDrluvs t4trxrio3oo1oaDrlnvi;s0 rxoxopnydol elfcs ()sDur(m ou4tptn f3tldfm ua( o;(0arxomfctatlmDelnei;()trtoxmpnydlme lnvs tfs2raxmoot0tetomieiltlm2ran o t)trenif3totlptelnvo t) rxmxr nudll  mivi ( artmxr ;t4tlenmfciatfs rmuvs u0 rermo3ty1latelu s s) eum(rpoudopeelnetltfs2ua(mono4opx mictatls rlnvonu)artoxo3iytoa eaiei t truo(opiodapen ncs t aDrrx  ot1ole iietlsfm2umnvo;(4alxoxf3oodfmDrli o;s sexr(r io4ole lncias arumurooo4teeoiieiyslaDum(vs;(0 renmrcty1lp   nei;t0s2toxrpiydllt  nvilsfsDuax o;t0tlx ifciydfm ranmsnu0treomrcio1fa   i s () etrxm no1lltnlieil() ruaur oo4tlen fetadfmDra(vp u4 ltnir tydfmteliei t)truoxo3iy1lleemnetlt arrax  nu0apx mfctltfsDulu onu0arenmfcto1lmD  neilt0seuoxmpnu1amtn fes t) 2rmur ou1tlt micilsfa rlu p;()tlermo3tytfaDrai ilt  2umxopoy1omee nvsa(faDrau onu0olenioetldlmDul(vsnu) etnif iydfaDelueo s0s2xoxo3oo1lp e fetas a2tau o;t4opt  o3iyslmDelnvs t)trxnmr3iatfpDrauei ( t2xo(o nu4op nmnvil(f 2taxr nu4tltomicildfaDemums;t0alxoirciy1oa  lneils0srxr(r3oo1apeelicsls arumxm ;u4tet mf3tlsfsDuau sn(0 ltomf3iotlp r nvo;t srxrxr oo4am nlietl()arra(mo;t1aex ii3tydlm2ra(vs (4texoiociy1oa  ai s;(0srxmxo iy4ll  micta()s2um(r ;o4opx mocildlmDra(vs (4texoxr3iadlmDeanvo;s)s2xoiopoodol   nvslsf 2raumooo1oet iociasfs elump;(0artrmrctadlmDeaneo;s)seuoxo3io1lmt lieiltfa2umurpnu0oleo f3iatlmDelnms;(0 ltoio3totlp  aueo;() eurio3nodoptelfvsl(  2urxr ;o0apeomocils a rmn pnt4 etrio to1fm eaneslt seurxm3nydop nmfcsa()s2rr( ono4opxnmieiad a2em(msnu)tlerxrcto1laDeli i s0 rtrxmpnu4lme mnei t s2ururooo0alt  fetadfa rauvo;t4aetnxf iatfmDrauei t  2urim3oy1apeelfviat artrxmpot0tpe ifciadfm ra(vo t4 lxnmrctadfa e ivs t)trumiopoo1ll nmfesas aDra( o;t4apt iieiatfm2raump;t4 eermociotfp eai s;t)setm(o iy4ll  lnvs s) rumx  ;t4tee  ociadfm raumonu0texoxo tytlm ran s;(0 rtmirpoodole mfvsl() Drr(m no4tpenmociaslaDel( ont4alxoir oodoa rlnvo (0 euoxr nudolenmivtlsfartrx  nt4tlxo ociysfm elnvpnu)alermf tytfa eli o;t s2to(r3oo4llt  ivsls)a2urumo;o4olt  fciytla emums;t0 exnmoctadfaDe ivs t srum(o iudlmtemicsl(fa2rm(m no1apeo ictydlaDumnmpnu4altoxfciy1lpD lnvo;t)srum(rpoo4lpt mics ( a2urx p;u0oexo ieilt mDelu o;(0aetrxocoy1lm   neols srto(r3oodllen nvt s srrrxmoot1opx  ieiltls emnvonu4tlerxrciy1oatean ols  2ur(r iy1lmenmfvs s sDrm(ro;o1texn fcilt a2rauvo (0 eermf iotlaDeli ils) rxoim3oy4op   nci ( aDtr(mp;o0tex mfciydfmDumn snu0altoxfciy1op ean o;()srtoim3oy4lm emnesa( srumumpou0apxn i3tyslsDem(mp;(4 lxrirciadlaDeln ils0setmim nu4llt lnvsls  rtrxm ot0olxnmoctldlaDulnvont0aleomrcoy1fa  livo s)t2xrxr3oy1omtnlncsat sruru o;u1oex  ietatfmDum(vs;u0altnxociotfmteanes ()trur(r iy1omtn iei sf ruau o;u4tpx  o3iyslsDem(mp;(0 lenxf oydfa  auei;t srtoiopoodalenlnes t  Durumpou1aetomictlt a ua(msn() exoxr oatfa elu o;()trumxm3oo4optnmictlsf rtm(m ot4aex mf3tysfa elu on()altomrcootoate ieils s2xriopiu1lptnmfctlt)a2raxrp;t4tpxoii3tas a ran s ()tetnmf iytlp eli o t)srum(mpoydalte fcias)a2rr(mo;u4alenifeiadfm2rmu p;(0tlxnxo3oydfpte nvi;(0teumim3no1lmt lfvsl( aDrauroot4aptnmicildfs el(vont4altoircoadlm rli slt s2tmxrpnu1lmenlnviltfs2tmxmont1aex  feilsfsDran s;u) rxoifctotla rliesl(0t2ur(o3iy4om emnct t s2tmx o;o4aetn iciytlsDrmu o;t4 reomr iotfp  aivols s2urxrpiudamenmfctltfsrrmx ono1oex mieiasfs el( s;()trtomrcootfmtrluei s)seumio3nydale  fcias)s2raum nu1oleoio3tld m uauvo;t4aeeoxr tydfatelneo;t tetr(o iu1ap  lfvta( sDumum ot1tpxo octldfm ra( p;t0tltnio3iydom eanvi;()t2uoxm iudlpe lncs tf rraxr no0ale iociysfaDrluvpnu0arenir3totop eli ols  rumxo3iydoltnlnci s sDtrumpou4oex  feiltlsDumnvs;(4trxriocia1laDrluvols  euoio3iydaltnlict s aDtax  ;t4tptnif3iys sDrauvs;u0tltnio3iydfpD aieolt)s2urim oo4op nlnvslt aruaur nt0optnio3iydlsDumuvo;t0tlxnxocoadlm rln o;( setr(opiydaleelfesat  Dum(rp;t1olx ioctatlmDem(mpnu0tltrir3ta1laDr i o s)trtmxrpiudlm nmncsa(fs2taump;t1tltoioeild sDuan ont0tltrmr3tytfpDr u ols0s2xmio3nu4apt lfetls)aDum(r ot4tpeoiieiyslsDrlnvo;u0artrxo oydlmD  uvs;s  exo(r nu1olte fei ( arrruroou4tlxnmoeias a2eau pnu0tltrmo ia1latrluei;s tetrio no1lm nmfvias  Duax poo4tpxomoctydlsDuluvs u) ltnmrcoydfmte u s s s2triopou1aptelfeias) 2ta(m nu4opxo ietyslsDel( pnt0trtoif iodopDrluvils) rxo(r nu4ameemnei sfartr( o;t0oex ifeiysfmDrlump;t4texoxrciadfmDr ueo s0t2tmxo3oudlptnlnviat)srrr(ronu1tleo f3iyd m2uau pnt4aeerxfcoadfpDrlu s;( srxo(m3nudllt mfeil() 2umxr ;o0aptnmietlsfsDrmnmont)arenmociatomDeai ols0 eurxm iodolte ncs t a2rm( ono0alx mo3iyd aDel( p;(4 eerif totlptrli s (0t2xr(mpoy4ll nmfvia()s2rru ono1alx  o3tadls2elu s;(0aexnio3tytoaDelu ols0trurim3nu4amenmfviasfs2uaurono4olxnmociadfaDemn s;t0alxrmrcto1fpt aivo;s s2xmio3oodop nmneil(  rtmxroou4alenif3tldfmDrmnmpnu0 etrxf oy1lptrlnvi ( t2xmxo3iy1oltn nvi () rtr( p;u4oeto iciytfa2rmnms;t) exnifctadom rlivolt0t2ur(opno4open nes ()aDumu oot1oltnio3ildls ul( p t)arxrio iydlmtelneil(0truoxmpny4oltemivtat)sDtm(mpnu1apenmi3ilsfs2ean o ()tetniocta1oa  luvs;t t2tmir3oy1openmfetl(f Dtm(r ;u0opx micilt sDel(vonu)trtrxrcio1fp   uvi () rtrxrpoodol elivi t  rtr(  nt1ape  oeilt s2rau o t) exnxf to1lp e ivilt) etm(opnudolenlncs tfarum(mp;u4alenmociltlm elnvonu0 rxoxocootlm  li s;()trxrim iudalenmncs t sruax o;o0aptoioetyslm emuvo u0 lxoio todfa   nvilt)seurxo nodolenlfcia()sDtrxmonu0oltoifciyd m ulumonu4 rtnmf3ta1oa e u sls) 2toir3iu4olt lnvta(fsrua(rpoo1tpeo ietlsfmDrmnvsn(4 lerif oydfm  lieols) exmim iudam n fei s srrmuro;t0tpe moeiysfmDem(vp;(4tetrif3iodlptr uvi (0 2um(o oy1ame mneslt)sDua(rp;t1aex  feild m2ran ont0 exrir3iytlmD  nvi ( s2toxo3oy4am elfct t)a2umum ;o1aet iieildlmDeln onu) exnxocoadom e ieo t0s2xmio3nu1oleelfvils a2ur( poo1apxnmfeiatfaDeaump;t0aexnmf io1oat  nvo;t  rxoim3iydom n ieiasfs2rau o;o4tpxoiiciatlaDrmn o t0 lxoir3tydopte uvils0 exmirpiu1ap elnctlsf Drm(r nt0alxomfctatfsDem(vonu4tltomoctotlp rlieo;(0trxrxr3iy4am nlncs ()a2trumpnu1olenii3tlslm rm(vpnu) eenio oodoaDelivo (  rtrxo3io1optnmies t  rraxro;o1aexomfeilslm2elnvpnt4tltoxr ootop  auvol( t2tm(opiy1am nmivsat aDrax p;o4tpx mieiyt aDrl(msn(0aetnif oy1lp   nvolt0trtr(m iudamtnlietas) 2tmx ono0ape mfeiytla2uau p;t0 lxnxf iytfaDeli i () exrim3io1lpt micsat)srum(r ;t4optoio3ias mDrm(ms;u4tetrmocoatlpteaneo;()trtrir oydalt lnvils)a2rrxrpno4aptnmieiyt m eluvo;u0 renxr io1lmD luei;t s2tr(r nu4apenlivi s sDtaxr ;u4oetnioetysls rlnvonu0 etrmf tydfpDe uei (0 2uo(m oy4alenmfvi s)a2taxm ot1alto iciatlsDul(mo;(4 lxoxo totfpt lieslt0truoio iu4alte fcsas  rtaxmp;o1aptnmfctatlsDuau p (0 ltnif iadlmtrluvo (0tetm(m3ou4lmtelivtltfsrtmxmono1aleoiietytls2ea(vs;u0teermr totfpDr nvi;()s2xoimpio4ameemnet ()aDtmxro;t4oexoifetasfs2uanmon(4treoxocoadfa elueslt) 2tmxrpoo1lm  mnesl(  Drm(mpot0ape io3iytfa rau snt0artnmo3ta1lptrai s;s0s2xrxr3oudap e net (f 2rrxrpou1oetnmf3iltfa2umnvp t4alxrir oydoaD  iei;t)s2ur(r io4olee fvs sfsDumur ;t4oexnmoetldls ran pnu)trxrif iadomtrai i ( srtoxr3nudlptn ietlt)sDurxmp;t4alto oeiyslsDea(ms t)artoxr iodfmt au i;s0 rur(o oo1aptn fct s aDta(  oo1teeomo3ilsls umnms;t4 rtrio tydfmDean ils0 2tmxr3io4op  mnvsas)artmxrp;o4apen iciytlm emuvo;t0alxomo to1lm r uvilt srumxm oo1ol emicsas)sDurumpou0apx  f3tas m umnvo (0 rxnmrciotfatran sls0trtrim iu4lmenmfci tfaruau o;u1apxoiieiaslsDeanvo;u0 lxoio ty1omDraiei;t) 2xo(r io1ol   fvi (faDtax pno0tltnmfcilsfaDrlu o t4aexrxf3oo1latelnvs;( s2tr(o nu4ale mies (  Durxmp;u1opt moctas m rln p t0areomr io1opDe i i;s t2xm(rpno1ame  fvi (faDumxmooo4tetn oetasfm2ua(vsn(0 eenxf3to1oat anei;t0 2uoxm iydapen ieiltf Dtmxrpnt1oltnmf3tatlm2umnvp;t) etrxr todfp  lueo;t0 etmxm nodamte ics (  rumur ;u1oltomo3iytlm2el(vpn(4trtnmf3iotomteaieo s  etmxr3iu4apeemnvtlt)arta(  no4olt mfetldfm2el(ms;u)artoxfciadlmDr n i t trxoim3iudlmtemfvi t aDtmumoot0olenif3tat m el(mp;u4treomf tatfp rlnvi ()s2xm(o3nydlp elfviatfsrur( pou1opxnif3iytls raumo;(0alxrmrctodoatelneils0s2toxm nodamt  ictl()sDtaur nt4tetoiociat mDean s;t)artnio iotlmt  uvi;(0 exoxo oo4lle lnvtat s2trxront4aex ifetatlm2ran pn() renxr iydla r ieolt0sruoir io4omt  ivia( sDumxrpno4oexn ieiysfmDra(mpn()texrmo3oatla   neo ()s2uo(m oo1optnlnetlt sDraumono4ole  iciltfmDumuvp;t)aetnmf3iy1oa rlues;s)tetoio oodamtelnvils)s2raump;o4texnmoctlt s2ulnvs;t0trxomf tytlatr nvo;t0s2urxrpou1lpte ivtl()sDuaxr ou0apx ioeilsfa rau on(0treoiocta1fpD li ols)s2xrir3oy1lpte ncs ( srrr(rpoo4texoiiciadfm ranmp t4trerxf3iytopte i o (0srxoxrpiy4op elivs t)a2uru  ot4olt mietytlaDulnms (4texomrcootlpD  i s (0 2xmiopou1ape  fvi t sDra( ont1tlenifeildlm2ran p (4teermrcta1omDrli ilt) rtoxr nydlp   fetltfsDra(r nu1tleomf3tytls2ulu o;(0 rxoxo3to1omt ai i;s)tetmirpny4opt mfvslsfs2um(r nt4apeo fetydlm em(mp;u0arxrmf3oydlp rauvol()teuoim oodlpeemfcil()a2tm(m nu4tptn feiltfa2ua(msnt0texoiocta1lpD lnes;t  rxmir no1ap nmnvilsfaDrrum ;u0tlxnmietytls2eauvo;()aexrmfcoa1fmte ies;s0tetoxmpnu1ap nlivia( s2rmumono4tlt iieilsfs2elnvo;t0tltnif oo1op rln ilt0trtm(o3iu4am nlfct (  2taxmoou0oltn ietaslaDuln onu0trxrxo todfmtrauvilt sexr(r3no4aleemfvs ( aruaxm no1tpen o3iad m2rm(mo t4 ltoiocto1oa  lueols truoir iydlleelnciat s2umxmont0tee miciyd sDem(vo u)arxomr oatlm e i sl( s2um(rpio4lpe  fct s)s2um(r oo0openmfciysfaDem(vo;u4aetoxo oo1fmtraiei;()trtmim3iodap   fetas)a2rr(m ;t4tee mf3iat sDrl( o;t0trxnmo iadfa   ies;s s2urio nu1lp elivta( arrmxr nt1oeen i3ilt m2uln p (0 ltnxo3ia1fm eau o s0trtr(r3iy4llt lics ( s2ta( p;u1oex mietytfs2ranvsnt0tltrxo3ia1oa rliei s)s2xmxr3oodlpe lfcs sfsDrruroou1tlx mf3iatlsDrauvon(0arermocoa1optr ivolt0 rumxm3iudopt liei t)sDrr(mpot4oltoioetatlsDuaumpnt0tetrxo io1la   n o;t)seuo(o oo4amtnmnctl(fartaxmoot0oet iicias aDraumonu4arxrir tydoate u i;( setmir no4ale lfet t)sruaxront1oetnmictltla2emumsnt4arxnmocto1omt ln olt  rur(m iy4open ncsat)arur(r ot1tee iictlsfsDumu onu0trenxrctodfat  i sl(0seuoio no4lptnmfesas)a2raxronu4aleoioeilsfaDumn pnu4aetoxfcoy1opteluvs;(0texrxm nu4aleelfcia() rtm(  ;o0aptnifciatlm2umuvp;(0tetrxr to1opDr uvilt setm(opou1ol nmivs t)aDta(ront0tpeoii3tytfs2rluvsnu0 rxoxo3ia1fpt luvslt s2xrxo ou4ol nlneta( artru pnu4tltomfeilsfs ranvs;(0trxoxr3ty1fateaneilt0s2uoxrpou4amtnlfet t)aDua(ro;t0tetomieiasfmDeluvo;u0texoxr oadoatrau slt0 2tr(o3ny1op elncsa( sDuaum ;t4tpxo f3iasfaDuanms u0 etomf iy1lmtraies s sruoxmpoodal nlfetlt) 2trx  ;u4tlx ioeilslsDulu p u4teenio3iy1lm ran i;t  2xo(mpnu4apt  fciat)srur( o;u1apx  octltfa2umn o;(0 lxrxociatlmteanei;s t2ur(o3ny1lpen iesat s2ua(r ot0apeo oeils s el(mp t4 rxnxo3iodoptraneils)s2xoxo ny1lmte nesl(f Drmumoou0apxomictad sDuan p t4 etnxr3todoa elueo ()texo(mpiodomen ietat  Dtmxmont0tpxo feiltfa el( on(0 rtrmo3iadoaDrlu ils0s2tmxr3nydoltnmneiat a2um(r nt0optoif3iys mDeln snt) ltrir iadfat anes;(0 2umir3oo4lle livslsfs2tr(rp;o1teeniociyt m2rmu s (4 lxrmrcoatlpD ln o;t)t2toxr3iu1oltnliet t) 2ra(  ;t0teeoioetytlm umnmo;() etrir3totomtelues;t) ruoxo no1ape mfct s sDurx poo4tleomi3iyt m um(vs (0 exnmf oatfa e u slt t2to(r3nudam nmncs ( s2tm(ro;u0openmfcild a rmuvo;u4 ltrxocoo1optr uvils  rur(opno1aptelietl() Dumumpot1apxo o3ias sDuaumo u)teerxr3ta1opDelivolt0 ruoxo iu1llt  fcsl()srtm( p;o4aee  f3ildlmDumumsn(4tltnxf3tytlateli s;s0t2xmxm nu4ap   ivtls)srta(mpot4tet iietadlmDranvo;()texniocoo1opDrau s () rtmxo ou4lpe  fct s)s2rr(  ot0tlenioctadlsDranmont0teenifciydlpte ieo;t) exoimpiudal   fvia( srtm(mo;u1aptoiocilsfaDranmp t)areomfctotlm  aivs s0 exmio ny1amee ivt sfarrmxroot1oetoifciys s2ulnmo;(4altomocoytfmt liei (0 2xmxopny4ll  mietlsf Drax  nu1aexo iciat mDeln o;()aexoxf tatoaDr i s;(0 exoxo3oo4om n fcils)srumxro;o1apt  ieilsfsDrmnmo;u0 rermo ta1lmDrli ols)t2xmxm io4opeemivia( aDraur ;u1opx  iciyd aDemumo;t)arermo3oa1omDeau s;t texoxmpoydlltn ieils arrmur ;t0tet  f3ild mDelnmonu4teenxr3oo1lmDe nvo () exoxo3no1lleelfctl()a2ta(m no0tltn feiytlm rlumont4teenmf3to1fa r nvsl( srtrim io4ope  ivil()sDua(rp;t4aexnmi3iadfmDea( pn()teeniociydlmte nei;t0sexo(o3nudope mfeil( a2ua(m ;o1apx mi3taslmDrau p;u4tetnmo3oytfmD  uvi;t) exm(rpnodomt lfvia( aDtmu oou1alxomfciasfm eanms ()aexnmr3tydfp e uvol()texo(o3iy4ol nlnesa()sruaum nt0opto ociadfs2rmnms;(0tlxrmo io1fmDr ueolt0t2trxrpoo1lleelfvt tfsDrmur ;u1oeeo ocilt m2elu o;t4alerio tydopt  ivs t  exo(rpny1amt  fesls)srumumpno1teeomocilslm2elnvo;t4 ltoio3ootomtelies t0trtmxm3iydam e ncsa(farrmurpnu4opx mieildfmDulump;t4artrif3totlptranes;()teurxm3iu4lmtemietlt aDtaxm ou1olxnmociydlmDrlump t0alermo3todomDrluei t)trurio3nu1olenmictatfsDurumo;o1opt  fciatlmDuluvpn(0altrxr3ia1opteliei;( truoxm nydlltelnetltf rumurono4oltniieiyd s2rlump;u0alxrmfcoo1laDr i s s0 2toxr iy4aptelncia(  2tmu  ;o0olt  f3iyslmDem(ms;t4trtnio io1fmDelnvilt  rumim3ny1lp emnes s)aDrrurpnu1oetomo3iytfs ulnvont) lxnifcoa1lmtraneo;t0t2uoio nydomt lfcsa(  Drmx  ;o0tleo f3tys s2ua( p t4altrif3tatopt  uvi s0sexr(r3oo1ap nlnvsl()s2rrurpoo0altnmi3tysls eln sn(4treoxfciatoaDeaivil(0texmir3no1ap e fvtat) Drrxro;t4tltnmietlsfa2em(vo;(0 rerxoctadfp  livi;s0 exm(o nudlmtnmfvia()a2uax  ;t4tltomfctldlmDulumpn(4arxrmfcto1omD  n i;s)trtrio3io4al emfvs t)srtmur nu4altnmo3iad mDrmuvs t0 etnxr3tydfmD  uei;s)tetmir3iodal n fvsa(  2rmurpnt4altnii3ildfmDum(von(0aexoif to1oaDr ivs;s0srumim3io1ame liet s a2umu pnt4opeoii3tysls2ul( p;t)trtrmo tydlmtrluei;t srxrxmpou4ol n ieil(f rraump;t1tetnmfeiydfm2rluvp u4aleomr ootlpDranvo;t) ruo(opny4al  mivilt)artmur ou4aee if3iydfaDemumpnt0trxnxf3iodlptrlivs;t  rxrim ny4lmen fvsls  Dumxrono4aet  o3iyt s elumont0 lxomo3ta1fa r nvi;t0texoio oy4amteliesatf Dtax  ou0tle mociasfm el(vs;u4tlermf oodlaD lnvilt)seumim3iy4amtemfcs s  2tmx ono1altnmoeiasfmDumuvpnu)trtoiociatomD li o t0teuoio3no4open fet ( sDtr(ro;o4tpxomoeiltfa2uaums u0teeoxr oodfpt aivils)trxoxo3ny4ape mieia(f rtrumonu4tlxo i3ilsla2rmnmsnt4aetoir3iy1fpD luesl(0sexr(o iy4om nlfctasfs2ururoot1olx  ociytfa2rauvpnu4altnmf3ta1oaD aneols0 eumim3nu1llen net (fsDuaump;o0tee mociadla2eaumsnt4tltnmfciatfpD lieslt0trxr(m oydlmenlfvi ( srtrxm oo0apxomieilsfsDrm(vont) ltnxrcoatfmt an o t) rxr(o oo4aptemncilt a2raxro;u0tex  f3ild s ranmo;u0 eeoir3tydlptranvol(0trto(o ou1lmtn ivtlt  Dtaumo;t4oleoii3iyd s2ul(mon()artrif iodoa   neo;()teumxrpio4oleelivt (fs2trxrpnt1tpenmf3tas s ulums t)teerxf todomtrlu slt0 exm(r3no4lm nlietasfsDra(mpno1tle  iciltfa umu p u4texomf3ia1lpDr nvi;t0 rxr(o3iy1optemfvsls) Dtmuronu0ale  oetyt a raumpn(4 eeomrciy1lpt lnvsls0t2toxrpoodalenlict () 2tmxmo;t4alto ieiadlmDua(mpnt) ltnxocoa1fa eauei s0setrxr ou4ap nmfcia()aDtaxrpou4oee ii3ias mDeanvp ()tlxnxr3iatlpDeauvilt  2xr(r nu1omee nes s)sDuau  ;o0alxoii3iatfmDulnmp;()treomociy1opDr nvs (  rtr(r3ou4ame  ics s)arrmump;o1olt  ieiys sDelnmp;()texnio3tadoaDr nes (0trxmxo io4am  licsas a2tr(m ;o1alt ifciatlm ulnms;u0texoxf3oo1fmD ln o t trum(m3oy1om emneils a2umxmp;u1ale ifeiad m el(vsn()arxoxfctatomD  n o;s0 euoir io1lpt mivt s  Duaumo;u0tlt moctydls2eln p;()aexriociodoaDrauvo ()setmiopoo1ll emfviat  Dtr(ro;o0tle moeiydlaDranvpnt0 etoir iodlmtr n i t0 euoim io1lp   ivils a2rrx ooo4aee mi3iydfs2rlnvon()alxomocoa1opteau i;t0 exmxopoy1op  mneslt  rua(  nt4ope  ocilsfaDemn s t0 ltoxfcoadlaD ai ols0t2toxm iy4am  livt (fs2rrxmpno1tetoifetytlaDemn p;t4aetomfciotfpDr n sls0s2umio3ou1lm   fcsl() rtm( p;o4aee  fctat m2rau o t)alxnxr3tadlpDeaivols0trtr(r iydlptelfcias)arumxmpnu0apxnmfctltfmDulump;t0trtnir3oatfp eluvs (  2xrxr3io4lmee nvil(f rra(ro;u0oexnioetat aDulumo (0teerxfciytfm elieslt) rxm(o3oodlptelieiatf Dtrx p;t0olx mf3iytla uanvp u)arerio3oytfate uei ( setmxm3oodlleelncta(  rrauroou1tlxnifciatfs2ua( snt)tlxrif3oatlpt lnvils texr(m iodam   ivt sf rta(r ;o1aptniociasls2elumont4aleoxf oa1lpDr i i t0sruoxr3io4lm nliei sf Drmurooo0tpto ieiadfa2elnvp u4teenxo3ty1latr uesls trxrxrpio4ap   nvsasfs2rmxroot4opeoifctldfaDrlnmpn(4 lxrmf3iy1fa  auvi t)setrir iudome  fetls  rtmu onu0oexnmf3ilt a2emums t4 rermociadlmtraueil(0 rxoio oo4amt mnctat s2rrxmoou1apx mi3iadlaDrm(vsnt4alxrifcoo1fp rln i s)teumxmpou4lpe  icilsf 2tmx oou1aexn o3iytla2rlnvo ()teermf3ootomteaneo ( t2trio3iudalte feil()a2truro;o0opx  o3iasfmDeln s;u0tleomocia1fatraueo s)sruoimpnu1oltelieta(  2ur( p;u0apt  ieiytfsDea(ms u4aeenmr3totopD  uvil(0trumim3oy1oltelfvtlt aDumum ;t4texo fctad sDrl(vp;t0tlxnxf3iotoa e neo (0 2tr(rpiu1amt liet () Dumu o;u1apt mfetys aDelums (0trxoif ootopte neol(0t2uoir iy4llenmiei tfsrumx p;o1ole io3tat m2um( s t0aetnir3iodopDe nvs t0seto(rpiy1lp  lfvilt)srrau  ou1alxnmf3iat mDeln s;t0 ltrmfctatop rauesl()s2toxm3iu1op  mfcsa( aDrmx pno1oeeomfcils aDum( o;t0 lxrxoctydfaDe nvsls)tetoir3iudame lict sfs2rr(r ot4tpt mfetadfmDuauvs u)aetnxfcoodom eanei t)trum(mpoy4ape licsa() 2ta(ront4oeeoiieilsls2emnms;u)tleoio iotoa raueilt  exoxrpnudale  icsatfsDrauroou1olxnmoeiltfm2rluvpnu) rtnmr3iytlm  anes t  euoxm3nydlle mnctas  2umumpot1alen oetyd a2emuvpnu)trtrxf to1lmte ieils) 2to(r nu1ol e nes t)aDrru  ou0apxo iciadfm2eanmo;() exrmf3iatlmteanvo s t2urxr oodlle lncia(  2rrxrpot1opxomoctat a ua( s u0texrmocoy1om rlues t)t2xmiopoodapen ivias aDrmxront0tlenmfetad s2umuvo;(0tltrmr tadlmDranei;(0seuo(opoudope lfet t) rur( oot0aeen feiydfmDem( p;u4alxnmocia1fpDrlnes;(0 rtr(rpoy1amtn nei s) Dta( ooo0oexo o3tlt s2em( s u4trerir tadlp eln ilt)trxo(o oydopt lneias) rta(mono0apx ii3ias s2eauvo;u4texrxrcoodfaDeai i t t2xoxr nydamtn ivt ()s2taum ;t0tpt moetlt s2um(vont)arenmf io1oa rlieils  rurim3oo1lltelfvil()s2rr( p;o0aexn fciadls ul( pn(0 etrxf3tadfm ranvo ( srur(r3nudam e fesl(fsDrrurpnu4aeeomfeias a2eluvsn() etrxf3iydlmDeaneilt0 ruoirpiodlptnlnci ( a2ra( p;t1apto o3ias m2eanms t) exrxr3oatfmt livi;s0 rxrxo oudlltemiciasfa2umx pno4alxo oeiys m2rln o (0altnmrcoydoaD lnei;t0tetmirpnodole  ivsl(f 2ra(r ot4tltnmi3tatfaDuauvp;t4 rtrxr3oo1lm   neo;(  etoimpoy1apt lnvil( artm(r ou1oeeomi3tad a2eanvsnt) rxnmo oa1oaD li o;(0 eumio3ny1apt lfvsat) rtmxm ;u4apxomociyt m2rm( p;() lxnif oo1oat li olt trurimpno1lltnmncsl() rtmur ;t0apxomoeiyslaDulnms;u)altoxfcoadomDr uvilt0truo(m nu1altnmncil( aDurumpot4oeto octad s2ran p t0 lenxrcoydomtran ils)trxmxm oo1lpe livtas) rumxm ;o1aet ifctyt m um(ms u4trenxocia1om  lnei;()s2xrir nydal emfciasfaDumxr no1tleo icild s2umu p u) ltoxo3iy1fp raues;( t2umxo no1ol elfet t  Dtm(mp;t0alen i3ias a emumo;u)aetoxrcoo1fatrlneo ()srxoim3oudame  nesl(fsDtaumpnt4tpeoio3iytlaDulumsnu0areoxfcoydoa ean il(0t2tm(opou1lp e fct ()aDrmurp;u1tpto o3tyt a2umu snu0 exrmr to1fat auei;t)trumxr3iu1apt livsa()aDrrur nu0tpt  i3ilsfsDraumon()aetnmr3tydlpD ai i;s0sexo(opoo4olt mici sf rtruro;u1optn o3iltla rl(vs u4 lxrxr3iydoaDelu i;s0tetr(opoo1ap emfet s)a2uaxmoot4tpxnmo3iltfa2elnms;t4tltrxrciadfmDrli s;(0trtr(opoo1ap elfes s artru  nt4olxo fetys s elnvo t) rermr3oatfm raivo ( srtoirpoy1olenmfei tfa2ra(mp;o4aptnifeiadfm rluvpnu0alxrxo tadfp   nes t0texoxopoy1lmeelfei t  Drau  oo4aptoioeiaslm2rl(mpn()aleoxr oa1lpD livi t)seto(o3ny1opee iesa( srtrump;u0oexo f3ildfsDrluvp;()arenir3iy1lp   i o t0s2uoxopoydap nlici sf rtru o;u0open feils a eauvs;(4tltomr3oy1lmDeau s;t  exrxr iydole lfvs s a2ururp;t1tpen o3tlsla em(monu0 lenio iytfaDrlivslt)s2trxrpiy1olt  nesltfs2uaxrp;t4oetnmicildlmDeanvpnt0treoxf3tatlm elu o;s s2xr(m3nu1ome mfctlt)srraumpnt4tlt ioctad m umnvsnt) exoif oydlp r uvsl() euo(m iy4lle  nesls)srra( pno1oeeoiictytfm2rl(vonu0alxrmr oa1fmtrlneolt)trxoirpnudllt lfcsat  2rrurp;u4oetoif3iysla ulnvp;t)trermo3iydlpteanvil() exoir3iu4lme lnci tfaDumurooo0tlenmiciytfm2umnmp t0treoir oatlpt li o t0truoiopoodol elfvs (fsDtrx  ;o1olx  o3iatfa2ean s u)trerir3tydoaDraiei;s0srur(m nydop   nesa(  rurxm ;o4tlxoii3iyslmDum(vsnu4arerxr ty1oaD lueils  2uo(opnudoltelfcsltfs2urx poo4aetn f3iydlmDem(vpnt4 ltomr3iy1omD ln ol( t2xr(r iy1ope  feslsfa2uaxrono0alt miciadlm rlnmpn(4trtrxo3tatfmDrli i s s2tr(opoodap  mictls s2tr(mo;o4tlenifcildfaDel(msn(0tlxrxf iy1opD  nvs t) etoir io4om n ieilt  Draxm oo1olt io3tyd s ul(vsn()texoxocoadfmD liei s0s2uoxm3oy4opt mfet sfaDraxmp;o4texoifeiad s rlu s;t4tetoir to1lm rlneils)srtmimpio4ll  lietltfsDrmxmo;o1oetomietatfaDulnvp;(0tlenxo3iydomt  ues s  2xoxrpoo4apte ieilsf rtm(r ou4tpxoio3iasfsDeanms;u) rxrxociadoa e ivi;s srxrxr ou1amt lnciasfsDurxro;o1tlx ii3iltfm2emumo;t4tetnmr oodopD  ivo s  eur(m io1ap emncil()sDurumpnu1tleoiicilsfa rmnvsn(0 etrmr iy1lp rlueo;s0s2tmimpou4al emicil(  Drru  ot4tlt if3iysfs2uanmp t4trxoir3tatlm  auvsl( teumiopiydap nlicsls)aDta( pou4tle ii3iatfm rauvo;u) lerxf3oydop   i o s  exoxmpny1lm nlfvilsfsrumuro;o1oee mfeias s em(mp t) eeoir3ty1faDr ivils seuo(opiodlpeelnvia( aDtrxro;t0tptoio3iydlm em(vonu)aeerxo oatlptrlnvol()srtrxm3nu4ll  mfcsat aDtax ooo4apx moctldlm2ea(vsnt0areomrctytlp elivil(0 2uo(rpoy4lpe lfetat)arrr(r ;o4apx mfciadfa2elnvs t4altnmf iodfm r n s t sexrim oo4lme  netlsf rtaxmo;u4tpe iociydlsDulnvo t0 rxoiociytfpDr uesl()t2tmxr3iy4ll nmnvtlt)arumxrpno0oex ioctatfaDraumo;()artoxf iodfpDrai s s  exo(o3iy1llte fvi ()artrx oot4aptoioeiltlsDulumo t0tltomo3oa1laDelueo;t0teurxo oodlmenmiesl() 2ur(ro;u1aeen i3tlsla2rmu snt)tetoio ia1la  luvo;s0 2uoxm3iy1op nlicsls) Dtru p;u1aeen i3iatfm umn o;u) exomr oydopDr ivi;t trxr(o nudlmenlivil( arua(mpnt0opt  i3tld sDrau snu4tlxoxociodlmteaneo () exrxmpnodape liet ()a2tmurp;t1aexoioctlt mDuaums;(0 eermo3oydfmt  nvilt0texoxopoydlmte ncsls sDraxr nu1alen fctadlm rm( pnt4 ltoiocoodoaD luesl(0 eumxm oydomte ncsls sDrrx pno4olenmfciydfmDra(ms;t0 lxnir3iodomD aivils0 rtm(opou1lpe  fvta( srtaump;o1tpxoif3tltfmDelums u0alxnxf iatlm rluvs;s0 euoxm3iudop n ncsas)s2urum ;o1oex mociyt s2raumpn()arxnxr io1oa e u o;()srtrio iu4lm n ivs tfaDum( ooo0aexnmocilsfa ua(ms (4teeoir3iotfpt  ivi;()sexrim3ou1lptelfvt s a2uaurpoo1optomieiytla2eau p;(4tlxoxr iotlat luei;() eumxmpiu1olte fciasfaDuru ooo4tee moctlsfm2rmnvonu)altoxfcta1lmD lnes (0teurxr nodome mietat)srumxrp;o4oetomfeiat sDumn snu0altoif totlm  au ols seurxopny4lm n nctlt  Drmx  oo4aetnmoetlsfsDra(mo;u) eeomrctadfp  lnes ( trxmxo3ny4om e ietlt) Dtaxm nt4aptoifeiytfsDrluvp;t4aexoifctodomt lu ol(0t2uriopnu4al elfesas) rtrumono1olxn o3tlt s2ranms;(4teerxr totfm eluei ()seurirpno1aptemiesa() Dra( o;o0texn i3iatfa2eau pnt)texnmo tadfaDeluvs;s  ruoxm3oydlm  mieiatfaDtr(rooo1aetoiiciatlm2ul( o () rxoircta1fatrlivs;s0teuo(rpoodapt  neil( s2ua(  nt0ope  i3iyd sDeanvo;(4 ltnmo3iotfpDeln s s) 2xrio oudlp   netl()sDtru pnu4tlxnmoeilsfsDeau o (0trerxo3ty1lptrliei;s)t2umxo3nu4opeemietls  2urump;t0tpenmi3iad a uan s;(4 rxrxo3iy1fa elu o;t srtr(o3ny1am  mneilt) 2tr( pou1oetnmo3iltlsDemnvs (0aetnxoctytlmDeli sl()srur(opiy1olt mivta(  Dum( pot1open o3tyt m rluvsnt0aetnmrcoydopt aivo ()trto(r3oy4lpe  feilsfs2ta(m nu0olxoifcilsla em( p (4 eenxociadfaDeanvi;(0 rxoxr iu1opee ici tfsDrmxr no4opxomf3tas m ulu p (0 lenxo ootlpDrluvs;s s2tmiopiy1apeelici (fsDta(  ou0alxnifetytlm2rlnms u)alxoir ty1oaD  u s;( trtr(rpiy1ll nmicils  rua( pou4opt  oetls a emuvo t4tltrif oatoaDr uvils)srumim3nodlmenlfcsasf 2tr(r ;t1tpt mo3ildfsDrau s;t0 etnmoctadfaDelivi s0 rtrxo3nu1amt  ncta()sDtaxm nt1openioctatfm um(mp (4aexnmrcta1fp r nvslt0 2uoxmpoodam   nvi t)srtaxmoot4aptoifeiysla el( s (0arermo iodfmtr ueo ()seurir3iy1lm  mfctlsfsDtau  nt4oex mfciltfs2eau o u) etnio3ootfm e uvi;(0trur(opou1amtnmivtl(fsrrau p;t0apt mf3tldlm emnvp (4tetrxfcoodfmDranvs;t0 exr(r iu1ol elnes t arum( ooo0texo fciytfsDeanvs u4teeomr3iotlmtrai s;() 2uoirpiu1op  mietasfs2taurpot1apxomf3tad aDumn on()tleoir oydlmDeau s ()srxoxo nodop eliviat) Drmurpot1ape ioctys m2rmuvpn()teeoxo3iadfmDe u i s)sexmio3iy1ll e ivsas  rrmu o;o0alenmo3tatla2eln p (4tetrir3ty1oaDrlueslt s2tmxm iu1oltn nviatfa2raxmpnt1tpt ioetad s um(vpn() rtrxr3oodoate nvs;t0tetoxr ny1amtnmfciatfa2uaxr ou0olxo iciasfmDeln pn()tlerir3tatoa e u i;s)sruo(opou1ome lfeil(farumxro;o4oeenifeias aDelu s;t) etrir3iodfa e nvo;t) rto(r iudameelfvi (fa2rrxr nt1oeeo ieiltfa ul(vs u0teerio iatlpte neols  etmir3iy1optemfctls)s2rmxmonu1alxomociatlsDumn s t) rtrirciydopteaieslt)t2xmim iu1opee fei s  Dum(root4optnii3iatfaDul(mont4aetrmo3iytom rau i;s0setrir3ny4lmt liciatfsrtaxroou4aex ii3iydls emums;t)texrif3oy1fptrau o;(0sruo(r oydlptelnesl()s2umx o;u0aeeniicildls2umuvonu) reoxfcoodfateai s ( trur(r3iy4lptn fvs t)a2taum nt4tlenifcilsfs rlnvpn(4areoxo3iatom e uvols s2uoxm iodlmtemnesls) 2uaurono1oeenii3iadfm2uanvp;() ltrirctydlpDe neo;t texoirpnu1lm nmnvs sf 2tm(rpot4ape miciadlm2emn p;t4aetnxo ia1lm  livo s)trurim3oodlptnmfvsl(  Drrx  ;t4tpxoifciatfs rm(mp;t4 lxnir iytfmtrln o;()setmir3ny4amtelfciat  rraumpnt0ole  oetlt m2rau pn()altoifcoy1fmteanvo t0 rtr(m iudaleemnesa( aDtaumoot4aet if3iyslmDuan o ()trxoxfcoodfm  aieo;t)tetoio oy1amtn icsat a2ra(mpou4tetn f3iaslm2rl(vs (0 exrif3ia1lat aneils) exrxopoo1lm e fvi s  2rau pno1tlt  oetydfsDem(vo u4aeeomfctodom rli i;( t2uoxr oy1lpee neta(faDuaxr ot4tetnmi3tlt sDumnvo (0aetnir3totomDr n i s) eur(m3oo4alt mnviat)arrm( pot0aeeo oeiytla rln p t0 rxrxr3oodfpDraiesls s2uoxm iudol nmfvs ()aDrr(moou4teeoioeilt s rauvp () rxrxo3io1oaD  nvsl( srur(opoodlmte fvslt)a2rm(mpou4oet ioctltla2eauvp u0arxrmo oytfp elu il(0 2xmim oudamt lfvt ( aDur(rooo1optoifciydfs2elu s (0 ltoxoctydomtranesl(  exoio oy1apeemivt (f 2trxrpno4alenmoetadlm em( s t4teeomr3oytlp rli ols)s2tmxmpnudlleelivt sfaDum(roou1tpx mi3iys mDra(vp;(0 rxrxo iodoaDeaueo ( setr(r iu1oleemivsat  Dtm(  no4tptnmfctys s2eluvs t4alenmf3tatfmt  u sls setoxr nu4lltnliviatfarta( p;t4tpt  ieiyt sDumnvp (0 etrxo tatfmDrluvols)teuo(r nu1oltelfeiasfs2rau  no4oetn feias mDrln o t)aexrxfcty1op elnvi t  rxrxr3nu4lltnlfctltfartmum ;u4apto f3iltfsDuluvp t4 rxrmr3iadlat  nvs t0s2urir oodllte neia()a2urxmo;t4oleoioeiat m2uanms;u0aexrxr3tydop e ues;s s2tmir3ou1lm   ncslsfaDtm( o;t0aeeniociydfa2ran o;t) eermo tadfat an i;t)tetrxr3oydlpeemfcs () rtmxro;t4tlx ii3ias s uauvs;t0 eeomr iotlmDr nei;s trtmimpiu4lme livia() rtaurp;t4tptomietatfaDua(ms;u) lerxo3iadfm  lnvs;t) exo(o3io1amtelies tf Drmu pou4altnif3iydla elu sn()alxnmf oadoa   ueo (0teuo(mpio4lm n fvtas) rta( ooo0aex ifcilsfa2ranvsnu4 exrxrcoa1oa eau o;t  2xmir no1op n nvslt)srtr(  nt4alto ociydfm eluvpnt)tleoxociytla eanvs;s  rumir oy4olenmfvsat)a2ua( oot0tlenmfciltfm2emnvsnt4tlermfcoo1la elivo;t)setrir ou1ole mict s)sDra(  ;t1alt if3tltfs2rln o;u4 rxrxf3totla rlu s s0t2umir3oo4aleemfvtlt s2uaurono0texomi3iyt a ran s () rxrirciatlat an i s0s2urio3nodlmenmncil( aDua( p;t4aetomoetys sDuanms u0tltoio todlmDr uvo;t) exmxm oydam elneia(  2ua( ont1apxn ietys s2uaumsnu0 exnmr3iy1omtr ieil( s2toxo3ou1apt  fvs t aDumumont1tee  feils a2ra(vont4tltomo todlpD  ieo;() 2toir3iodlp nlnesa( arrr(mpot1olt iieiatfaDulumon(4altrxfciydfp   ues;s0t2um(r iu4omtnlfci ()aDtmuro;u1teen fcildlmDrlumo t4 lxnmocio1fm r uvs;t)t2xm(mpno4lpenmfeia(farumx pno1tptniieiydfa ea(ms;()artrxr3iadfate ueo;t0seuoxr3oudaptemfvta( arrm(ro;o1tlenifciydlm2eanvsnu)trenxrcoytoat aiei s t2to(o3oudalt lfes t)srua(r no1tee  ociydls emn sn(0trtnxoctydfp r ivs s  2xm(r nodop e nvs () 2rr( o;u0opt mfciatfm2ulnvpnu)areoif3tytomDe ivo s  2to(r ny1ap elncs sf 2trx pnt1tlxoiieiysfs2uauvsnt4trxoif oatlmteluvo () rxmxm3nu4lpte ietat a2rmu oou4teto fctatlaDranvp;(0 lxrxo3oy1fpDran olt  2toxrpio1ap emneslt) Dua(ro;o1aetn i3iyd s2umnvs;(0 ltoio3oodlm eauvol()srtrxopiy4al elivsltf Dtr( oou1opxniictyd m eau s;(0tlenmfcta1oa e ueo () 2trimpnu1ap nlieiatfaDrm(mpnt1oex ioeiydlm rmuvp;u)texniociytlpD  nvsls)s2xoxo nu4am n fes ( sDtru pnu1opx iictysfm rau s u4 eeoxf tytlmDrli i;t  exrio3ny4ape licsat)sDumxr ;t4tptn feils s ulums;u) exnircoodopD liei s0t2uoxrpio1altnlfciat)artaxr nu1alt mf3tatfs2rmump;()areoxr ty1fm  luei;t  2trxrpiydll nmnvil(  2uru  ;o4aexoiociyslm2um(vpnt)aleoxf3iadfmteaivi;s) rxr(m3oodameelics ( s2tmum ;u1tlxnifetlt sDrmnvp t4 lxrif iydoat  ivo ( trxr(mpiu4op  lfvsatfs2rrxm ot4optomoctydfm rlump;t0 rxnxf ootlatrauvs (0 exm(rpoydol  mfvsa() rtaxronu0oetn octasls ul( o;u4alxrmf ia1fpte nvi t) rumxmpoo1lmt  nctlsfaDtaxm no4apx  f3iltls rl( snu) lxnio3io1faDe uvs t0t2trxo io4amenlfesl(farurxrpot4tle  octlsls umnms (4arxomr3oytfmDrai sl(0trtr(o3no4lmtnlnvil() rrrx o;t1tltnioeiadla eauvp;t0trtrmfcoa1om   i s (0texoir iu1ll nmfvs t aDrr(moou4alxoio3iadlm2um(vsn(0 lermo iytlatelnes;s) 2xmir oo1ame lfcilt)sDrrx poo4apenifetltfaDemn s;t4teenio ta1fpt lueols)srtmxr oy1lmt lfeil()srrmx ont1opxnmo3iys s ulnmo;(4 reoircia1opDr nvo s)s2trxo3nydap  mfvia()artr(roou0texomi3iatls2umnvpnt)aexoxo iytlaD lu s s)t2xo(r oo1amtemnvtatfaruau ont1texniiciad a emn p u4tetomfciy1faDr u i t0 2tmiopou1lmenmiesl(fs2trur ;t0tlto oeildfm2rmu s ()trtrifcootom   n i s srtr(r3iodalenmictas)a2tmu onu4oeeo icias m2umnvsnt4trxrmr iadopteanvo;t) exr(o3oodlpe lieiat) 2ta(mpnu0tpxoifciasls2ulnvo t0aleomrciatfp
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;t srtoxmpno1ap elfet s  rtau  nt0aetnmo3tyt sDelnvo;()aetnio3iatop r ivo (  etmim ny4lp   fvsltf rua(  ;u4tlxomoetyt a umn s;t)tlermr3tatlmt  ivi t)setmxo3iodaltelies ( sDum(rpoo4tptomf3ias a2ul(vpn(4 rermfcto1op e ivs ( t2tr(r3iy4ame mfvt s sDrm(m nu0alen fetas m2uanms;u4aetoir oa1fmDr uvi ()tetm(r nu1aleemnvia() rtrxmo;o0aeeo feiasfm ulnmpnt0 renxo oatfpDrau s;s0texmimpnu1op  lnci ( sDumump;o1aee mi3iytla emu s;(0trxriocto1laD auvs;t0srxm(r oy1omtn ivtat arurxmonu4oet  o3ildlm2elumont0 etnmo iy1opD luvo;(0srtmim3iudape mfvtls  Dtrump;o0tlxn f3iatlaDrlumpnt0tlxoircoadlmDe ivi;t  2toio3ny1olenmnet t sruaum ;t0tlen ietldfa el( s t4tlermoctytomDrlnvs;s)setr(rpou4am  lietltf Dum( o;u0olxoiiciasls emu pnt0arxnxf3iydlp rlueo (0trtoimpiudomenlnci sfsrtax pnt4apxo octyt mDem(vs;t0arxnir iytoat aueslt0trtmxo3nodlmen ics t)s2tm(roou0aeeoioetlt s2um(vonu4 lxrxf3oy1om eauvsl( teuoir oodom  miciatfsrrau poo0aptoiiciysfs2rlnvp t0aeeomf3tytop e ivo;(0 2xmxm3oy4lmeelieiasfs2umump;u0oexnifeiytfa ran p t)trtoif3totlptraueo;s0 euriopny1lpe mfvi t)sDrmu  ;o4olen f3ilsfm em(vonu0trxrif oodfpDr ieolt srxmimpou1amenlieilsfarurumonu0aetn octldla2rln s (4 lxoir tadfpD luvilt  euo(mpny1lmt mfctlt  rrrxm ;u4tle iietysfm rauvon(4texnxr iodopDeliei;( s2uoxopiydlpt  fcsas) Dtax  no4open o3tatls2ua( s t) rtrio ootfaDeluvilt tetmxo oudomte iei ()a2rr(mo;u0tltnif3ils a2ra(ms u0tetrioctydom r n o () eurxm3ny1lp e fvtls) Duaxronu4tle mociad mDum(vo;(4 ltoxociy1lmtrauvi;(0s2toxr3no1oltnmfcsl(  2umum nt0aeto feiydlaDeaumsnt0aleoiocta1fm  lies () rto(opnodol   nes ( sDta(rpnt1teto o3tasfs2rauvon()texomf iotlatranvi s0tetmxo3ou4ap  mfcta(faDrm( p;o4aeeo fciyd aDrm( onu0 lenir3ty1fatrai o ( setrir3oy1al nlivil(fa2ta(m ;t1olxomo3iyslm eanms u0texnir3io1lptraieil(  etm(rpiydlmt  ncslsfsrraxr ;o1altnmoeiyt sDelu o (4aetnxr iydoaDean o;(0s2xmiopno1lmt lfeias  Dtrum nu0teenmoctydls2ean on()trerxr3oadlpD lieo;s0 eumxo iy1ll n nvs tfsrumxmooo4aexn ieiyd a2ea(monu4 rtoifcia1opt luei;s trxo(r3oy1om nlnetasf 2trx  ;o0apxo fcilsfa2emuvs (0 rermo oa1oaDe uvo;t  2xoxmpou1ol  lfeias artrxmpot4aptn f3tatls2emumo u)alxomr3todopD lieilt0srxmim3ou1apt  ies s) Dumur no1apenioctytfmDeanmp t0alenmo3oo1fpD  i o;s) exrxopnodlpenmnvslsf 2tmx o;o0oetomfetlsls ulnmsnu0tltnmr tatfmt lu slt) rxoio3oy1ll emieiasf Dumxmo;t1aleoii3iyt m emuvonu0 lenxo3ta1lpDeln i t)srxr(m3oo1al nmfvi s srtaxm ;t1aeeoio3taslaDelnvo u0arxnif ootom ranei t srtr(m3io1lmeemict (fsrtaxmono1tpxo i3iysla2ra(vs () rtnif3iydfm rlnei;()s2xr(rpny1optnlict t srrruroot4opxomi3iad a elnmp (0teenmrcty1lmteluei t  2xmimpoydlm elici s aDua(mo;u4tee  fctldfsDem( s;u)alenmf iotlaDrluvi s0t2xoxr oo1optemieta( artmurpot0tpe  ietldfa eaums u) rtnxr oa1omte uvi s) eto(mpoy1am emnes s  Drmur ou0opto iciydfs umnvsnt)aexnmf3tydfm  livo;t srxmxrpnu1lpt  icslt)a2ra( oou4aetnif3iydfs ean p t0aetrmr3to1fa   neo;s)t2tmir oy4apeemnvtas)srra(mono4texnifeias s um(mpnt)trxrir ootoaDelneslt)s2xmxopou4omt lfctlt)aDrm(  ou0oleoiieiad aDraumo;(0 ltnmrctatomt lueo t0teum(rpoy1lm  mnvs sf Drrxm ;u1teeoiociytlm2elu snu4tlerir oatoaD luvols) etmxmpou1lpt  nvta(f ruaurpot0apeo ieiydfs2rl( pn(0alerxr3iatfmDe u s t0 rxmio nydlmtemieilsfsrtaxm ot4aetoio3ils aDuau p;u4tetoxf3oy1opDrauvo;(0sruoxm3oy1lme  iviasf 2tr(m ;o1ape miciasfa2uluvp t)altnmr3ty1lpD luvi t setrio3oy4lpe  ivtasfarua(ro;o4aptomi3taslsDrauvs;(0 exrxfctytfmD luvs (0 2urimpiydlltelnesas sDta(mont4olenif3iat s2rl(vo;t0 rtnir3oatfpt  i ilt tetmxr3no1llt  ict (farrau ono0apeoifeiydfa emnmo t4 leoio ty1fptelneo t)sexr(m iudlpt livta(f Durxrpot1tpxomfcild sDra(msn(4tetrir tatlmtean olt)teurxopnudlpt lfvtls sDtmxmp;t0texoiicils s2rln snt) etrxr3iodopt anei s) rxr(m oudapt mfetlt) rtaumonu1olxomfctytlm2emnmo t0 ltrmo tytlmDe i s ( trtrir3oo1alenlfvtlt artrumo;o0tlxo f3iatfaDelnmon(0trtoir oodfpD au i;s srurxrpiu4om nmfvslsfs2rau oot0altnifctys mDua( s u4 etomf oadfatelueols0texoxm io1lp  mnesltfartm(  nu0olxoifciadlmDrln p;(4artnxocta1fat lnvol() eto(m no1lp  mneias) Dumu  oo1aeeoii3ildfm2emu s u4tlxnmf3oo1lp rluvi;()s2tmxm ou1om e ivi tfs2rmx  oo1apx mi3tlsfs2rl( o;(4texnxf iy1omteluvo s srtrxr3nu1apt lfci s)aDtax o;o0aet mf3iyt s rm(mpnu0 renmo3oatfa rlnei;s0srtrim iu1altn ivi s)arumx  ot4aexoii3tlsls2rm(vo t)artnxo tytfpteaivi;s)s2tmim3iy4opt lnetls) Dtmxm ot1altomociadfs2ean o;t0 reoxf oa1lp  auei s sexr(m3oy4lle lfcs ( srtrurpot0tpto fctat mDul(vp u)trtrxf iy1fat an s (  2tmirpio1ll n fctl()arur(rpnt4aleomfciltfa2elu pnu4tetomr oy1laDean o;t)trumxopoy4lltelnct s) Dumx pno4altoif3iysfaDua( snt)trerir3oydlpDeanei s) 2to(rpou1alee netlsfs2tax ono4apxoifeiydfmDumuvs;u)aetrmo iodfaDrlneo s s2urim3ny1ll   icilt)a2uau oou0oetoifetadfs umnvon()aetomr3iodoa rauvs;s) 2uoimpoo4om nmfvtas a2rax  ;t1tlt  o3iyd sDrm( onu) exrxrcoytla ean i;s)texrio3oy4llenlnvt ( s2um(r ot4tlxoiieiydls2emnms (0 eeomr todfm r ies;()teur(r3ny4opt mnct tfa2urur oo0oee mi3ils mDeanms (4 lxrxf oa1fpteanvi;( setr(m nudlmt liesas) Dumurooo0aeenmocilt sDulnvo;u)tlxnifctatfa  lnes;s)teuoxm oydlle lncslt) 2raxmp;u1olxo ieiat a rm(vs;u4 ltrxo oytfp e nvols0 rxrxm nu4oleelnviat)sDrrxm ou1opto ociadla2ul(mo t4tetnmr oydlmt  u o t0srumiopio1apeeliesl(fa2ra(m ot0oeeo oetysls2ulumsnt4altnirctatlaDeaueolt0t2umxo oodomtn ncia(  2urumo;o1apen feild m2rmuvo;(0 lxnxfcoa1fmtr nvol()s2xoxr oo1lm   icilt s2ra( p;o0alxoifeiadlaDeau pnt)texomocia1optr ivs;t)truoir nu1ol   fcs s a2ra(m oo4aexn fctatlmDel(mp;(4 ltomr oytfpD  u o;(  rtr(opou1optelfcsat s2uaxmoot0ope  fctys s rau s;(4aexrmo oydom  anesl( trtoxm io1lle mietls arraumpoo0oexn ietad s2eanmo;u4 rtrxo iadomDrln s t)seto(m nodlpen iet s)a2uaxmono1oeeoioeiatlsDea(vo;u0 rxrif3ta1oa  aivi s texrimpnydap nliei t aDrrxr ;u1texo i3iadlm ua(vpnt0 lerirciytfpDrluvs s t2toxr3oy1ll n ivs t)aDumx  ou4alxn fctyslmDrm(vs u0tltnxocoatlpt livo;(0s2umimpoydamtnlictas  Dtrxronu1aex  i3tltfa2elu on(0 etnxf oydfa rli s t trumio3io4llee icsatf Duaxmonu1tpx ifciad sDel( p u0 rxrmf to1fa ranvol(  rtoimpnydlp nmfvta(  Durx  nu1olt mictysfa2rlu p u0arxnxoctydomD aieo;s0 etm(rpiy4lltnmnciltfartmurp;t4tlt  o3ils m ra( s u0altriocoydoa eaies;t s2xoir oudaltnmnvsls)sDuaum no4alenioetasfm umu on()altomo oydlp raivo s  2urxo3oodlp  lfcsat)s2rax oot0tlxo o3iydls ranvsnu4alenmf3iotlatelnei;t0s2umir iudllen icilt a2ra(ro;t4aeto feiatfsDra(ms;u0aeeoir tatlat lnes;t)s2xm(r iydaltnmnctlsf Dtru o;u0altn i3ild s rm( ont) exomr3iatfpDranvo;s)t2trimpoy1llee nvtatf rtauro;o0olt mfeiydlm ea(vont) lxoio3ta1oa rlneslt  rxoir3oudop e nctlsfsrtmxm ;u4aptnmfcils sDumnvpnu)aexomfctotfp  aivs t)t2xoiopoo1ope lnciat)s2tm(ro;t1tpeoifciadlmDrmuvs;(0tlenxocty1omt  ues;()trxmxo oydoptnmnvi t aDurum ;u0aetomfciytlm2em( o u4altomocoy1lp eln s;t)srtoir3oo4om n fvtls) Dtrxm ;t1oet mfctasfm2rmnmpn() rerxo ia1lp  ln i;s  rxrxopoy1lm nmfvtat  Dtaumoou4tlxomoeias a2eauvsnt0aexoio3tadopte u o t0t2trio io4lmeemncsat a2rm(rpnt4aexoifciyd s rm(mp u4tleoifciytfa   nvi;(  rum(r3ny4ol emnct t arua(r ;t4alto octadfsDeluvp;(4aetomf tytoa eauvo;s0s2umxr3no1apte icta( s2rmu  ot1ale mo3iat mDrlnvo (4arerio iy1lmt an ils truo(mpoydolt mnesa()a2uau pnt1aee  fctldla2elnvo (0texomr tydopDrlu i ( setrxo3iodame mfeilt)arrm(ront1oleomoetasfs ulu o u4aetrifcoy1fatrlu s;s) exo(r oydam n net (fs2tmxmpoo4openiociatls rln onu4 lxomr oatlptr ivslt0t2tmim3nu1llenlnctlt) 2um(mpou0oeen fetad s2eau s (4 renio3iytfm e uvs;t0s2uoxo oy4amee ict () rumxronu1tetn ictaslm rlnmp;t0 rxrmo tydlp r nvo;t0setrxr3oo1ame mnvs (fs2rr(r ;t0apeoifctytlmDrmuvo;(0 leoxr3tydlm elnvil()trxoir3ny1opt mivi s)s2taxr ou4apxn o3iad aDuan o;u4aetnif oodfp e i s;( tetmim no4ap  mfvil()arrrxronu0opxo ieiatfs ulumon()trxrmo3todoptraueo ( s2xm(r3iu1llte ieiat  2rmxrpnt4apx  oetldlmDrmums;(4arxoxr io1oatrlnes;(0t2xrxo oudlpen nvilsf rrm(mpno1oleomo3tlsfaDeluvp;()tlxnir tadlmt ln o;t0seur(r3iydol emivi (farur(mpnt4openmicild sDum(mp;u4areomocoydoptelivi;t s2xrxm nodlm elfciat) 2rau pot4texn f3tyd s elu pnu4trenxr tatoaDe uvs;(  exrxrpiu1olee icsltfa2taur ;t4tltn f3iyslaDraumsn(0arxomrcoodfmtrli i;s)srtoiopio1optelfctas srta(rono1aleniictlt s2rmnvsn(4trtnxf3iy1la raivo ()sexmio iodap n netltfaDrm(rpnu1alto ietld mDum(vp;t0 rerir tadoa ran o s)trurirpiy1ap nlncil(fsrtruroot4tpx  fciatlmDrl(monu) rxnmo ia1omtrlneols)t2xoir oodllen fvt ()aDtmu ono1apto ietltla2el(vp t0artrmr oydopDeau slt  euoir oy4lpte fvil(fsrrr(mpno0aleo icias aDrlnmon(0aetnmo3iadfmDrluvsls  2xo(mpoudopenliciltfa2rm(rp;o1ale  oeild a2el( p t0 eerxrcoa1fpDrai slt  exrio3nodlme mncsl()sDrmum oo0ape ifctydfm uan s;t4tetoxr iadlpDe uvo t) ruo(o3iydoltemfet sfsDrmum ;t4olxoio3tatfmDul( pnu0aeerxo ia1lpDeluvo;(0trxoxo nudaltelnvsl( sDrau  oo4ope  o3tytfa2elnvp (4aetnxfcta1lm e neols)setmio3ou4om  mict s aDra( oou0alxnii3ildls2umnvpnt4 lenmr3tadlaDraies;t  eur(mpiy1ll n ivtltfsrrrur nt4tlxnmieiysfs ra(mp (0trenircoytoatrauvol( tetm(m3iudam nmfetlsfsDumu pnt1aexoii3tydlaDeluvsn() ltnio io1fp  aieol()texrxmpnudaleelnvsl(f 2umurpnu1oex  o3iltlmDea( onu) eenxr3todfa eaieo s  eumxmpnodomtnmiviltf rra(rp;u1oet  i3iysls uaump;()arenir3oatopDrlieolt seumim nodomtnmfcsl() Drm(rpnu1aexnmiciasla uanvs ()texnxfcoo1lmDrli o;t) 2xoio io1om nmiet t)srum( ooo4oexo ociatlm rlnvo;u0 rxnmo tatoptrlnes;s0t2xm(r oy1am  mfcs (fsDum(rpnu1apenifciytfsDeanvpnu)tetrifcoy1la rauvs t trur(rpoodlle  nvsa(  rtrx o;u4tleomo3ilsfa2ulnvo;t0alermoctytlaDraies;( t2tmxrpoy4lle  fvi t)s2rm( ooo1aptn ocilsfaDuaumo;u0trtomo3ia1fpD an ols0s2xmxr3oydlpen icsltfarumump;u0aee  fctatlaDrl( o;t)trtnio3iydlmDr u i;s s2um(m3ny1ol   nciasfsDtmurpot4ope ifciad m2rau s;u)tetoir3iydfat lu slt)texoxrpoy4ll nlfeta()sDtru  ;o4ole mo3iat m rau s;(0areoif3io1opD auvs t srumxopoy4al n ict tfaDrrumo;o0oleomoeiyslm2el( snt4trxomo todoaDeai o;t0 2xoxr iy1ll e nvtas a2rrxmono1olx  fetltls elums (0 etnmo3iydlaDe n i;() etrimpoo1omtn nci sf Dua(m nu4opt iietys aDeluvsnu4aexnmrciydomDrauvilt teumio nu1ape  icta() ruaxmpnu0opxomfctytfa rln s;u0alxrif tydfpDranvo s)srtmxr no4ap emnct t  Dtaur ;t0tpe mo3tlsfmDuan o u)aexrmoctydlp rlneil()s2xr(rpio4ape lnvslt)sDra(ront0opto fciltlsDean p t0trtomr3tadoaDraivsl()texmxr ou1op e fctas)aruaur ;u1tptn feiltls ulums;t4 leoio oy1lateli slt0t2uo(r3iu4amtnlnetls)srtmxr oo0tpeoio3iytls umu pnu4trtrioctytlateauvs;t) 2umimpiudlltelietl()sDrrxm nt0olxo oetydlmDuanmsn(4tlermrcto1la  anvolt0trumiopiodom e netat)sDtmum ;t0tptomoeildlm2ra( s;(0tlxomrcootfp  lnei t seuoxo3oy1apeemivilt  rtru o;t1alen o3iysls ulump;(0trerifctytlmD  nvilt0t2tmxr iy1lm  mics ()s2uaumo;u1teeomictydfm2uan o (4 etoif oo1lpDrlivs;()trumxrpnu1lpenmfcsl(  2rru pou4oltn fciytfs2ua(ms u) lxomocoadfatr ivi t0 ruo(o io4lpen fvils) rurx oot4altoio3tasla2rmu sn(0 exnxo3iadlaD  ieilt0s2trxm ny1am e neias  Dtmumont0tle iietysfsDulnvs u0 lxnmrciadlpD au sls)s2xoim iu1alt mfeil(f 2rrur nt0oltomfeiydfa ua( s t0altoioctydfm elnei s  exoxm nu4alenlfvtlsfsDrr(m ;o1apt mi3ilsfmDeanmsnu0aetnmr3iatfpDeaivi s0 rurxopnudlmee netls  rtrum oo0aexniociad a ua( sn(4aetoxf iodopt  ieo;( srumxo3oo1lltnmnesl()a2ua(  nt4oltnio3iyd s umnmo;u4 lenmocootfm   ueol( t2trirpny1op   ivtls aDtrurpot4tlxnmfetydfm2ul( snt4texrir ootomteaivs;s)truoio io4ape lnvilsf rtm(r ;t4tptnmoetydfs ua( p u) etrmociatom   ueslt t2xr(m oodam e nvsat) rua(r ;u0tptoioeiytlsDean pnt4 exrmo3tytopDran s t)trxm(mpiodop   nvtls  2ta( pot4opeoifciltls umumon(0artoxo tydfa rlivsls)setrxr3oo1opt lfvt s aDta(m ;o0optnifctysfs rl(mpnt0trtoxr totlp rluvols)trtoim nudoltn ies t sDum(m ;u0aleo oeiltls2uaumpn(0treomo iatlmte ivo;t t2uoxrpoy1alenlneta(  Dumxro;t0oltomf3tytlsDrlu s u0 lxoio to1om  lu olt seumim iudomtnmnesls a2rrump;u4oleo fciydlm rlnvp t4 exnmoctadopteauvo;s0t2uoxr3io1lm nlnetlt)sDurxroot4opt mi3iltlaDrmn p;u0trermf ia1lm e nvil()srxoio ny1omte fet s srumxmo;u4tetoifciasfa2elu s;(0tlerifcty1fa rluei;s0 rtmirpny1lmtelnvia()s2tau poo4opx iiciltfsDulu p;t0alenmf iatoptrau ilt  rxrim3nu4optn fcsat srurxm nu4tetn ociaslm elnmsn(0trtrxocoadfaD  u i ( t2uoxrpnu4am e ivta(fsDumur nt0tpenmi3iadfs2ea(mp u0 reomocia1fm eanvi;(0seur(o oydole miei s  2tau  ;o1tpen octatla2umnvp (4tltomrcoodfa  auvolt srtr(r3nodlme liet t)s2tmu  ot1tet ifetatla uanmont)trxrmo3oytfat aieo s0t2toxrpny4alt lneilt sDta(mpot1texo i3iydfa rlnmont4 leomo iadoptr ues;s)sexr(r3ou1lpe  iet t  rtm( o;o1alxnifctls mDrm( o t)tltrif tytfmt lu o;s) 2xrxm ou1lp emfeilt) 2ra(r no0altomfeildfmDemuvs;u0 etrio iodfa r n o t t2tr(r3ny1ap  lfesa( srraumo;t4apt mociyt a2elnmo (4texomr3iy1lmDelnvo s t2uoir iy1lpt  ictasfa2ua(ro;u4alx mf3tytlm em( o;u0 rxrmr tatlaDeaivo;t  rxrxr oydlltnlies t aDta(m ;t4alxnifctlslm rau pn()arxnirctatfp  lnvs;t0setoirpnydamen nctlsfs2rmxmonu4tet  feiadlmDulump t0altoif iatfm  anesl()s2urxo oudlmeemfvs (f rrrxmpnt4tleomo3iat a2eaump;()altomo oatfmDraueo;t0t2uo(r iydop elnes () Dum(r ;t1oex iictlt sDelnvp;(0 ltrio tytlpte n il(0sruoxo3iu1optemnvsls) rtm(ro;t4tetniieiasfa ean pnu4tlxoiocoy1omtraues s0sexm(m3nu1ale  iet sfsrrmur no0olt mfciytfs eln s t4 eeoirctadop rau i (  2tm(mpoodal nliei (fsrrmu p;t4tetn f3iadfa2eluvs t) rtnxo oodlaD lnvi;t0 etoxopou4alt miciat  rta(mono0tpt ifeiyt m rluvsn(4 etoxr todoptraies s0srumir3oodapt lfvt s)s2tr(rpnt4altoiictatfaDelums;u0aeenxo3ootlaDrli sls0 2urir3oudlptnlfct tfaDtrx o;o1teeo octadfaDrmumonu0texnmr iatopDrli i s)srumxm3iu4lmtelfetlt)artrxro;u1oltnmociyt a rln s;u4tlxoxf tatfp e u ilt  etr(m3ny1olen nvslt arum( pou1apeomictld m rmuvo;(0 etnxr3oy1laDrlnes;()t2ur(r iy1olt lncs ( srrru p;o0alx  icilsfaDeauvs (4 etoiociadlmDeauvi;t0t2toxo oudlleemfvs tfsDrm(m no4ope mociytls2ea( p;u0 rxrxfciytfaD aivi;t) rumim3ou4amen ivt () Dtmur ot1ale iictadfm el(ms;t0alxrxo3iytop rluei t)s2xo(m3oy4ol nmfetlsfsDurxmpno4ole mieiydlm rmnmp () eeniocootlp   n i;t)s2umxm3io4llt miciltf rtm(r ;t4tlx mi3ildfsDrlu pn(4 rtrmf3iadfaDeli olt trurxr3iy1opeelncsa( s2tr( o;o1tltoiietlt sDemuvo;(0tltrxfcta1latraivsls0sexoxo iydalt lnet ()a2raumpnu4tetn ictys m2ea(vp t)aeerxocty1omDrluvs;s t2xr(r iu1am e fvs (fartru o;u4tlxn oeiyd s uauvpnt0 etoxf tadop elues;s0texo(m3oo4ap  mnes t) rum(ronu1oltniictydls2rauvo ()alenxociydlmtelueilt)tetoxr3iudalte fcsat) Duru  ;u0aetoifciytlm ul( pnu0artoxfciadlmD aivslt0t2trxo oodlle lieiltfs2rmurono4tpt mfctldfa rau snu0trtnmo3tadlpt  i o t0texoir oo1aleelieia(fsDta( p;o4altn o3ilsfm2umn s u4texrxr io1lpt lu s ()trxo(m3oodope  iei () Dumx oot1tee mf3iysla ea(mp u4tltrio oytoaDelivo;()t2xm(mpiudopen ncsa( arra(m ;t1texn f3ildlsDuanmp;t) etomo iydlp   i s ()s2um(mpoydam  lnctl(  Dtmumoot4tee  fetyd a ea(mp u)tltrmr iadfm  aneo s0t2uoxm3iydome mnvtls s2umxmp;u0ale if3iasls ul( o t)alxrmf iydfm  aies;t) 2uoir3oy4apeelfes (f 2rr( pno0tleo f3iatls emu p u) rtnir iydlp e nvs ()texmim3nydapt lnei (faDurxmont1opxniietys mDul(ms t4 reniociodfp ran i s)srumio ny1ope  ietl() 2rau o;o1oee mf3tatfs2rmuvpnt4tlxrif oo1lmDeli i s) rumxo3oudlmee neils  Duru pno0alx io3tldfa ean s u4alenmf3todoa elu sl(  2trio3iy1lm emnei ( s2taxrooo1ale mf3iydlm2rln p;(0tltoxf3oodfpte ivs t)teumim iydameelivi (fa2urx o;o0apxomi3ias a rln p;t4 lenxfcoa1omteauei ( srxr(r3iy1ape miesas) Dumu onu1tpxoiiciatfs um( pnu)aeenircoa1oatrlues s srtr(m3ny4om n nvsa( sDuaxr nt0optomf3iat sDemuvpnu)tlxrxfctadfpt aivi s0t2xriopoy1opt  ict t aruaum ;t4tlxn i3tatfa uanmpnu4aexoircto1omt  u o;s s2tmir3io1ap nmneslt arum(ro;t4tpx iictys m2rm( p u4areoirciotlp ran s;( sexmxopoydap emivtat aDra(r ou4tpxnmi3iys s2umuvsnt0teerxo oodfmD lu o s)texoir3oodaptnlfet ()aDraxmoou0apt mo3iysfs rm( s t0artoxoctotfa eaueols0texmir nydlmte fvtl(  rum(rpou0openiociasfa ulu o;t0arxnmf3io1fp e i il()trtmiopoodolt  fvslsf rur(r ou1oet  feiltlaDumn p (4 lxnmf3oadlptranes;t  2toim3oy1lm nmfeils) 2um(  ;t1tltniietld s2rmu sn()tlerxo iy1om eanesls  exr(m iu1lp  mnet sf 2rru  ;o1teeniieiaslmDel(vpnt)arxrmo3iy1oa e n s s0 rurio3iu4ll emnvsa() rra(r no4teenifetlsfmDul(mp (4trerif io1opte neo s)teto(o nydaptnlict s) rumu p;o4aetomf3iytla2umuvsnt0tlxoxfciy1lpD auvs (0t2xoir oy1lp elict sf Dumx poo1opxnmoeilt m rln p;()trtomr3oa1fmte u i;s sruoimpnodoltnmies t) rrr( poo1oetoii3iltlm uau o t)teeoif3iydfp   n s;s)srurimpoudoleelfci () rraxr ;o4oexnmf3iltls uanmo;(4 rxrmfciadlpDe ivols)s2umxopoudal n fetat)sDrrxmpoo0alt iocildlsDulu p;u4treoxr3iotfmDean s t  rxoim iu1lm  lictl( s2tr(  nt0apxnio3tas s uanmon(4 lerir3ia1opD lnvs t) rxoir iudamee fctl()srtrx o;o0aeeoiictyd s2emump;() rtnxr ty1fptr ieo;t)seto(o3iodlpt  nct t  rrau p;t4tpxn i3iys s ean s;(0trtrmr oydlpD livo;t  etoxr iudlpe  nes ( artaurpnu1aeeomicils s rlnmpnt0aleomr ia1faD  uei t0s2xm(o nodlptnlfei ( aruru onu0tltn i3ilsfa2rln sn() exrmoctadlpDe i ol( s2to(r ny1altn iei t  2tmx pou1olenmictysfs2em(vs;u0 exnmr ta1fm ranesl()trtm(o3oydlmt lfctatf rururpot0opt mf3iat aDem(vs (4trtrircoadfmDe i il() 2ur(mpoy1lp nlfeilt sDtaum no0alxoiieiadfa2eanvo t0arermr3totla   ieilt0tetrir oydlme lncilsf 2um(root1tetoifeild s2rau p u)alxnmo ta1la e neo t)srxoxo no1openlncil()sDtmxmooo1aptn iciat s ea(vpnt0 exoxr tytom rlnei;t)srumir nu1lltnlicsat s2ur(ronu1oetoiocils aDrau o;u4 rtrxociytlp r nvslt tetoio3oydopt  iet s sruau  ot0oltnif3tytfa2elumo;t) rxrio oo1lpDrauei s0trxo(r oo4om   fetl(  2rax p;u0openmi3ildfm2ra(vsnt4 etnxocoodop ran ils0trto(opnydamt  fvtas  Dua(rpnu1tptnmo3iatls2um( s;(4trxnioctytoaDraies s)s2ur(r oudom elictat) Dum(rpoo4tpx  iciatlm rmnms ()trxomf3ty1fpDr nvi s  exo(m3no1amee ivs ()a2taurpnt0opxoioeiat a2ea(mp t)tlermr tatomDe uvi;t) exo(rpnu4om  lfvtat) 2tmxmpnu4aeeoifeiytlsDumuvpnt0 exrxrctydfpD  ueo;s)srumim3oo4lm nmietlt)arrmu  ;o0teen i3iydfaDulu pn()altomfcoydlmt luesl( trtm(o iudalenmfcsas) Drr(  nu0ole  oetasla elumont4 etrxocia1la  lies s  rxrim3oo1oltelfes tfsrua(mo;u0oleniocias s2ul(vp;t)arxrifctotom e nvs;(0trurimpou4aptn nci t) 2umx pou1olx ii3tld a rm(msnt)tlxnmrctytfmDeauesls t2tmxm ou4lleemfet t sDrru  nu4aee mf3iyt aDrmu ont0alerir iy1fpte nvsls  rtoim3oy4oleelieia(  Duaxrp;u4aptniieias mDrmn pn(0arxnxf3io1fmteli i s0s2urim3oudll n ivs sfs2tr(m ;u0apxnioetadfaDemn o;(0trtnif ootlm rauvi;(0trtmxr iodll   icsls) Draxmpnt1alxo feildfmDrlnmont4tleomo tytfm  luvi;t t2um(rpnudam n nctltf rta(ronu1alt if3tasfs emump;(0 etoirciy1optrlivo (0t2tr(mpoy4amenlfvtl()s2urxronu1olxnmieilt sDrmuvo;(4 lenmfcto1fpD  u olt0srumiopoy4olt lieiltfs2ta(m ou0olt moetysfs2rm(vp t)aleoxr iytoaDran ols sexm(o3nudape  nes tfsrumu pot0apxomicilt sDul( s (0tetrmf3ia1latraueo t)t2urxopou4lm emivt (f Dta(ro;t0ope  o3iat s2uan on() lxrxr oadomtelneo;s0t2ur(opiu4lmt lfeia( aDtmu  ou4tetomoeiatfaDumu on(0artnxr iotomtrau o;t t2uoio3ny4ap  mfetlt)arum(mpnt1aex io3iatfm2raump ()tltoir iy1om elu s t)teumxmpoy1lmenlfeta() 2urxm no4tpt mi3iasla2el( s u4arxnio3tadlaDe u ils)sexoxr3iu4aptnmnei s) rtm(rpoo4tle io3iydfsDulu s t)aetrxo oodfm eaivolt  2xoxo io1amenmncs t) 2rru pot1tpt  feiydfsDra(vo;t0tetrxr tadlmtraueol() 2xrim3oudop  lnvta(  rrmu onu4opx mi3iydfs rln pnu4 leoifcio1opt  ieils)trxoim no4lp n fet s)aDraum ;t1olxo fetatfaDran on()teeomf3oo1fpteaivo;s sexmxrpou4al elneslt)a2tru  ;t0apen fciatfs ran s (0trxnmf3tydfm eaiesl()s2um(rpio1op elfvtltf Dua(moot1olenmietlt a2ra( s u4 leriocoatfa r ivs s teurim3io1om nmnetlsfa2ra(rpno0ope ifetlsfmDulnvo;u)treoif iadomDrln s () exmxmpiydap  mfct ( sDum(root1olxn ocils a raumpn(0 exnxo3iytfm   i sl(0trxrio nydlltn ieils sDtr(m ou4tpeoifcils s rauvon(4alenxrctotfmt lnvs;t)s2tm(o3no1al e fvilt  rrax  no0openifctasfsDemn p;u0alenmf iytfaD anvsls0 2triopou4opte nctatf 2ra(m ou4aexoii3iasfaDuan s u0 rxoir3ia1lptelivolt0s2urxm nu4amte fvilt arum(moou1oexnifciys aDuauvp;u0 lxrxo io1fmDelu o;s0 etrxr3nodame mnesat) Draumoot0olx  oetlsfs2ua(ms;t)aexoio iodop e n s ()seurxm nodomeemnvias)sDrru o;t1ale  iciyslm2rln on(4 lenxrciydopt lnei s0 etm(r3iydop nlnci t)sDumxr ou0tpt  i3iatfs2ul( p;t4tlenir3oa1fp  au sls)trxm(r nu4openlncs t sDur(mp;o0tetnmiciatfaDea( s (4altrmocoatomte ivi;s)sexm(o nodom  lieil( a2trxroou4oetniictatfa ranmpnu4teenio3io1fmDelnvo t t2tmxo3iydol n iet s aDrr(roou1altnifeiatfaDuanvsnu0artrxoctotoatr nvol(0s2umxr3oy1ol e feta( sDrmxroot0tlx  ieiysfa rl(vs;(4tetrxo3tydopDrlneilt trurxmpno4lmtelfeil( a2trxm nt4aptn fctydfm eaumont4 lerif iytop rau i t) 2uoir ny4lm e fvs sf 2um(m ou4olenmoctad mDrlumon()trxrir3ta1lmDran sls) 2xmxmpnudomtelnvilsf 2ta( oou0oet mictldlmDua(mo;(0teenxrcootlmD lu s s0srxmxopio4lp elnci s)arraxmooo4oetnmi3iasls emuvp;t)alxoircia1oaD  ieo;t)srtrxr3nodlmeemnvils)arrmumoou4tetnif3iadfm umu p;(0 reoif ia1opt an o t)srxo(mpiodlmtemfvia(faDrm(r ;o1tex io3iysfmDran s ()trtrxf ta1omtrlueslt0srxrim3iydole lfvtls aDurur nt4tet moctys m2ul(vp u)aleoxo ootopDe nvs ()trum(m oy4opt lfci (  Dtrumpot4ope mociydfaDumn s t0tetnxo3todfpDe n s;() 2urxrpou4ll n feta( a2rr( onu4aee moctyslmDuau s;t4aexoio3todfate ies (0t2xrirpiodlltn fvs tfartr(mo;u4ape  f3iat sDel(vs ()texomf ta1fp eauvols texr(r3nu4lm emnvtltf Dumum nu0oeeo ociydfmDuan o;t4 rxnmrcty1lptean s t0srtmxo ny4optnlfci s s2rrxrpoo4tleo octyt mDraump t0 renxrctadfpD  u o t0s2trxm3oudalt mies ()arrr(roou0tee  ictas sDumnms;t)arxrxr oy1faD
\ No newline at end of file
@@ -0,0 +1 @@
+i o;t)seuoiopny1omen fcils)sDrrxmp;u0apeo i3ilsfmDel( p u4aetnmr oodfptraiei t setrim iy1llt lfvia()srrrum ou1tetn i3tltfs ran s u4teenxr3iatfmDrlu s (  eumxm3nodole mictls s2tm(m ;t0oltnmoeiytfs ran sn() lxrifcta1lptelneo s teurim oudlmeemieiltfsrtax  nt4tlt ifcils m emnmp (4arxrio3oy1fpDelu s;t0t2xmiopiu4omeelfcsl(  Durumpnu4olt  o3iltla umnms (4 renir3iytomDeaueolt0 rurirpnodale  nvslt a2urxmono1tpxnif3iad m ranvp t0arxomr tadfaDrlieo (0trxoio3oydomt  nctls)aDtaur nt4tlx iociydlm2uanmp ()altnmr3oo1fa eanvilt) 2to(m oydlmen ncsasf Dra(mpno0opxn fciatlaDuaumsnu4 lxrxf3tatfa   n s t srtrxopno1alt  neiatfarrrur ;o1tpeo o3iytfa2rmu p ()tleoxrctytopDrluvsls0teurxo3ny4amee net () 2ua(rp;u4texomi3iysfm2elnms u)tlerir to1fp elivs s  exm(opiudopenlieiat) 2rr(  nu0opto fciydlaDumums;(4aetomr3todlpD  neo;t tetr(opoudlm nlneiltfaDrrx  ot1ale  fciltfa2ea( p;t)alxnxf3oytop   uvs;s0teumio3iudal n fes t aDurxr ;u0oeenioeias aDra(vo (0alenxr oa1fmt  n i (0t2toim iy4aptnlneils)srrmx p;o1apenmf3ild s2ea( s;(0 lxoxr io1lpt aueo ()seuoxr3ny4apt liciatfsrurx oou0olxo o3ilt m umn p t)texoio oo1om eaivi t)texoir iu1opt mncsas) 2uax  no0olxnio3tysfsDemnvpnu0 eeoxociatlptrlnvo () rxmxr oo1lmt  ivias a2rax oot0aptoiociadlm rm( s (4arenio iotomtrlies (  2xm(m nu4op nmivsls) 2um(rooo0tleoiociysfa2uaums () ltnxf3iy1op r ieol(0t2tr(m ny4ape  nctlt) 2truro;o0oexomi3iysfs uluvp t) exrxo3tydlaDeluvi t)srtmxopnudlmee nvi sf rtmxront4oexnmoeils s2eaums u0teeomo iatfp eaues;s)srtr(r iy1apenlfetas) 2tmxront4tpeo fetysls2el(vs t) ltoxr iy1omDe nei t trxoirpio4llt mfctlt sDrmu oou4tltnmfcild aDuaumo u)aetrir3oodfmte u slt trxrxmpiu4lm nlfcia(farrr(rooo4apeoiiciltfa2eaumsnu4arxnirciodfm ran slt) euoir nu4ome  iesat) Dtaxmonu1oltnioctytlmDeauvpnu4tetoio3ty1fmDeln o s trto(o3iydalenmfeiasfa2tm(mont0aleoii3tls s umuvo t0areomrcoo1lp   u ols0sexmim iu4al elfvia()s2rmxm ot4tpxoiieiys mDua( o t) ltoif oodfpt  nes;t0sexrio oydlpt lietltfaDra(mont1olen fcilsla2eanvont4 ltrxr3iadlmtr i o;t) rtmir iu4ap elncsat)srur(rpno1opx ifeiasfs ul(vp u4 renio oadlpDraivo;s0srxmxo3oy1am   ncilsf Duaxmpot1texn oetys m em(mo;t)trtnircoatlm raieolt0t2trxr oydop  mict t) 2tr(m ou1olto ociadfm rmu pnt0tltoxo oo1omDr uei;t0texoxm3iy1ol nlnctl( a2raur oo0tpt mociytls2um( p;u0alxomfcoodfmD  uvi;()s2urxopoydape  ivsat)arra(rpno0oeeomiciad m rluvs u4 reriociydoaD  iesl( srumxm3ny1oleemfcslsfa2rm( pot1olxnif3iysla ul(vs u0trtnxr3oydoat ln o;s teuoxo oydole mnvsat)sruaumpnt4tet ii3iadfa2eanvp;u4tlermf3oo1optr i ils sexoio ny4ameemict t)arurxrp;o1ale ioeiytlmDumn pn(0artrif iy1op rau slt0t2tmxo oo1optnmnvslt  rrm( onu0ale iieiatfa2uau p;t4aexnir3oodlateau sls0teur(m3iodlpeemnctls) 2um( ont0tptnioeiytlaDeluvs ()alxrxr3ta1latr ivo ()truoio oodop nmfcs ( srumx  oo4tetoiictasla ulumo;()trtrmocoytlaDeaneo s srxm(rpoudlpeelies sf Dumu  ;t0aee  o3iydfm emnvs;u4aeerirctytfptrlivs t0setm(opiudllenmneta()aDrr(  ;u0tpt  oeild mDeauvp;(0teenxo3iatlpDraivs;s) etrxopoo1al   nes s  Dtmxmp;u4tpe  ociltlm2rluvo t4treoxr3oa1fatr ivo;s0texo(opiy4ol emiciltfsDrrx pnu0tle mfeiat s rmn p;(4arxnmociydomteanes (0s2toxrpnudoptnmnvt () 2rrumpnt1oet  o3iadfa uauvp;()alxrif oy1oatrlivilt0 2uoiopou1optemncils srtau onu4tltomociytfmDuaumont0 lenxo oo1la elueilt) 2xoio oy1ale mncilt)sDtruroot1tpt  f3iyd a rl(vs;u0 rtomrciotfpteanvo;t0s2to(r3oudamt  iesl(f rtm( pno0apeoio3ild m rl(ms;u4 exoxoctadomDr ies;(0sexrxm3no1apt  fvs ( s2trur nu0aeeo o3iytfaDra( ont4alxrxfcoatopDraies ()t2xmxm ny4om emieias)sDuau pot1alxn fciysla2ra(vpnu0trtomfciotoaDrau il() 2xm(opoy1am elfctlsf Drm(mpnt4tpen icilsfs uau o;t0 rermr oadom  luvols0 eurim iu1lmtnlnvi (f rrax poo1tleo fetas s2eluvo;(0trxoxr3io1omtr ivols0 exrxr3ou4omtemfvtas)s2tmxm ;o1tpenmiciadfa2uanvp t)aexrmr to1lp elivi;s srurir iudlpe mfcia(f rumu p;o0oltnmi3iyd s2ul( on(4aexrir3iy1om rlu o;t0 exmxopiy1lmt  iviat sDrmum ot4alxnifciydfm2ul( p;()artnmociotfpt  uvol()t2trio iodlpenmfvt (f rtrxmpno4apxn oetldfsDelnmonu)tetnmo oadfm rai i ()seurimpoy4alte fci ()arra(r ;u4teenif3tyt m eauvs t4tlenxf oatlmDeau i;t) 2xmir3oo4llt lnvsa(fa2tmx ont0tpto ictytlsDeaumpnu)alxnio oodlp  liei;s0sexo(o oy1ame mictatf Drr(r ;o1tlxniicilt s ean s u0 renxfctydfmtraneil()t2xo(opoodolt mnvilsf Drr(mpot4apx  icils m uanvont0tlxrifciydoa   ies t)srxm(m nu1op nmfctatfsrua( pnu0olen iciatfm rmumsnt)tlxoxfctotfp rlues t)t2tm(rpiodol e nvsas artmx pnu0tltomfciytla2rmu s (4tetomo iatlp r n il(  exm(r iodaptelivs t)artm( ooo0oex io3tasfm uanvon(4aexrxo ta1omD ai ol( t2tmxo3iu1llenlfcsat)srrm(rooo1aleoifeildls2umu s u)tleomf3iotfatr uvs s) 2uoxmpiodameelics ( srta( pno1tpxomo3iyt aDrluvo;u) rxrmr3oodla e n i;t0s2umir3nu4am n ncils s2ururp;t4tpx  ociadls2rmumon()arxrmocoa1fa rai i t0t2toxm3oodlptemiesasf 2tru onu4aptomiciydlm uaumsn(0 ltoxrcoytlptr n slt0seum(opnudap nlnvt () Drrxrp;t0openmo3tytfm2rmuvo;(0aetrxrcoy1op  aiei;t t2xm(r oydol n nvsas) 2rmxr oo4olen o3iatfa2rm( pnu)tleoxr3iadfa  lueo s trxrxopoy4ome  fet tf 2ra( onu4open octatla el(vp;t0aexrmo3oy1fpD aiei;()t2ur(o3no1alen ictas)srtm(m ;t0ope  o3ilt m2umnmpnt)trxrmf io1lpt aivil( srtriopiy1ap elivsat srtm(rono0tpen f3ild a2rln o;t0alxrxrcoadfp eanvo;t texm(o ou1llt mivtas sDrr( poo0optn ociysfm2ranmsnu)teenio iodlpDr i o t seumxmpno1lpe mncta( a2rr(m oo4oex moeiltfs2rm( pn(4 leomf ootomtrli o;(  rtr(opnydllen fei ( a2uax ono1optnifetadfa2em(mp (4aexrif3ia1opDe n il(0teuoimpou4optn fetltf rumx  nt0opxo o3iytfa um(vs;t0tleoif3io1lm  aueo;t)t2urxmpiu4al   nvilsfs2ua(rpou4olt ifctytfaDraumont4aetrxocootfmDe n i (0 exr(m ou1ol e icta(  rumxroou0oexniicias m elu s t4tlxnmocta1lmtrlnes;s0 2urio iydlm nmictlt s2rmxroot0opeo fctlslmDrm( s t0 ltoxrctydlpteanei ( seurio oy1lmt  iesl()sDtaurpnu0tle ifciytfa2elnms;t4aexrmr iydla  anesl(0 2xr(m iu1ll elfes s  Dtru pnt4olx  i3ilt m2ua(mo;(0 exrio io1oaDran o;t trxmxo iu4olenliesat arur(m nu4tlxnif3ilt aDum( snu0 lxriocta1oate neo;(0truo(o iy4lptelieta()aDurumono0oeeomoeiydlm emnmpnu0aexomrcoa1fmDe nei;t0 exm(rpiy4lp nlnvs s)aDtax pnt1tlx ioetlsfs2rl(monu)trxoxr oatlp eluvo;()srumxm nydlm e ncsatfsDtau p;o4texomicils sDuluvo t4tlenxr3io1oat  uvsls) ruoir3nu1olenlnesat)sDur( p;t1alx  o3ilslaDrauvon(4aeeomr oy1fmDrauvo s) 2xo(rpiudamenlieiat)srrmurpoo0oee mfeildlm eau s;t4tlxoxf oodfa eln o;s) etr(rpnudope liesls  2ururono0alen iciyd m ea(ms t4 lxoxoctotlmte ivi;t)teurir iu1aptnlneilt aruaxrpnt4aeen f3iyslm2rlumpn(4tlenir3tydopD auvsls0teto(m3nudoltnmfvtls srrmxmo;u0tpt mf3ildfmDul(vs u) eenmr iadlptr nes;t tetrxo3iydole  iei (fs2rrurpno4alx mieiys s rau sn(0arxrmfcoo1fpDrlneil( srurir3io4am e ivta( aDrrurpou4tpt mo3iatls2ea(vp;t)alxrirctadfm rauvi t) exoxm oo4alen nctls  Dtmu pnt4tlx mf3tasla ua( o;u4 rxrir3ootopt  n s;t0 eumxrpiu1ol   nct ()arrrx pnt0tpx mieiltls2uauvs;t)aexnmr oatomtrlues t trxm(m3iydol nmnci ()sDua(m nu1aexn i3iydls emuvo;u)aexoio oadlp e uvs;t0 rxrio3nydam   nci (fa2rax p;o1apx iociydfaDrl(vo (0 eerio3tytfpDraueil(0 euo(r iy4lm elncil()sDrrurpoo0tpe iiciatlm umnvp (0arxrif oydlaD ai o s0 eumir3oodop  mfei tfs2ua(mpot4aet ifeiyd a rl(vo;(4tlxrir tadlmtrlnvi;t)srxmio nydol n ieias) 2rr( o;u4tlxoiictad mDua(mo;() lenif3oatfa elivi;s) etr(rpoy4alenmfeil( s2uau ooo4oex  feild a eaumo ()teenifcta1fmD  n ols)s2toxo3iydalenmnvs (f Drmumonu1oleomo3iadla eluvp;t4areoif3oytlm   neo t  2tmxmpou4am e nviat aDurxronu4tetn f3iatfs2emnmp u0trtnmr iytopD  ieils) rxoxm3nu1apenlnvi t)a2taur nt1alxomi3ias mDemums (4 eenmo ootfp eauvo s srtrimpou1ol e nvtatfsDtr( pno1tee miciytlm umu p (0trtoio oadfa r nvi;( setmxm3oydomtemfvta(faDua(  nt0alxoifctad s um( s () eenmfcoodfa elu o ()trto(r3nydlm n neslsfs2tmx o;o1oex  iciyt a rmnmo t0aetoio oa1la ranvi t)t2uoxm3iudale  nvsat)srraxmp;t4ape mictatlaDuauvpn(0 lxrxr3tatfpt  u slt)trxoir oodlle lfvt ()aDtm( pou0oleoif3iad mDeln p t4artrir3iotlatrlnvo t0 ruoiopou4alt lictlsfs2taum no4oexnmfeiadla emu p;t4 lxoxo iatlmDr u s t srtr(o3no1alte fctl( a2tmxronu1oeto fcilsfmDem(vp;t4tetrio iytlm   neo ( setm(mpno1om nlfcils)a2rr(r oo1tee  iciysfm2ranvo;t0 exoir oytlpD anvols trtmio io4lpe mfcsls arrax pnu0texo o3tatlsDeauvonu)aleoxf3io1fatrli o t)t2umim3no4lptelictlt  Dtr(m ou4apx  octydfsDeanvp u0teeoifctytlat lues;t  exmxm ou1lmt  fvtltfsrta(  ou0oltnmf3ils m ul(vpnu0alerirctotla  
\ No newline at end of file
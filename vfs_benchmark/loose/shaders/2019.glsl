@@ -0,0 +1 @@
+u i s srto(o iy1altnmfvs (f rta( pno0oeto ieiatlmDrmnvpnu0aetniociytoa r nes (0srtoirpiu1am   fes s)aDuau  ou0aex ii3iaslaDrl(mp;(4artrirciy1fp rlnei t texo(opoudlptn icsat)a2tmu  ;o0altoifetasls umn s t0 rxrxrcta1omt  n i s texoir3nodlpt mict sfsDtr(mp;u0olxnmi3iad s ulnvs;t0aexoxf io1oat li i (0t2ur(opiy4amen ict s) 2rru  nu1altomietlslsDea(vp (0 etomocoa1faD liei;t0s2umxr ou1ole lnvsatfs2rruront0teeomfciysfaDuaums;(4altoif iadlpDrlnesl(  2toxr nydlpt mfei ()s2trx pot4ole ioetad m rmn on() rermo3tadlm raivo s  rxoim3iu1alenlneta( arrr(  nt1oeeomo3ildlm2ul( o (0tlxoif oa1optelu sls)srum(o iodlle mfeias) 2rm( ono4tlt mi3ilsla2ra(vpnt4trtrio iodfpt  neslt srtrxmpny1al   fctls)sDrmumono4tpe ifctyt sDemnvo (4 eenmo3tatopDrai i s) rtmim3no4ll n ivs ()a2raxmpot0tlenmfctlt aDul(mp;() ltoxr3oy1omtraieo;t0texoiopiy1aptemfctlt srtmuronu4oltn o3iatfm emuvsnu4alxnmr iotfpt luvi s  exmxo nudolenlivi ( arra(rono1apxnmicildfs2rau on(0arerif3iodlmt ai s t)tetoxmpoydam n fcsl()srumu p;o0apxo ieiat s2umuvs u4 lxnmr3ootomDeli i (0t2to(r iy4llt mivtasfaDurur nt4tlxnmoetys a2eanmsn(4tltrir iotlm  aues s) rtmiopno1lmte nvs tf Draxr no4olt mo3tatfsDrluvont4 lenirctytlpteln s;( trto(m3oy4ol nmnctlt)srraurpot1olx mociys s uluvon(4artnxf3iy1fm e i o ( t2tmio iu4oltnlnvias aDtmx  no0oleo i3ias a ua( o;() reoxr iytlaDeln ils)seuo(m oo4lp n fcsltfarrrxr ;u1tetoif3iatfm ra(mpnu) exrif3oadfa e ivs;t t2umxr3no1omeemicta()sDururoou0tleoii3iasls emumon(0 etnxo3iydlmD  n sl()seurim3iu1lpe mfetat srrrurpot4apxn f3iyt s2el( o u0 reoxo3to1fate nvo;() ruoirpou4apte fcsls) Dumur nu1tptomieiatfsDelump t4tlxrmf3oa1fatraieo;t)srurir3nudoptelfeiat aruru onu0tpxo i3ild m2ran o;u4 ltrmo3totlp r uesl( s2tmimpiu1ape miei ()a2raum ot1oexnmietlsfmDrmn pnu4 rxrmo oa1fp rlnes;(0t2uoxr3iu4amte ictas srrru pnt1aexo ictad s elu on(4tleomo3tytfm elu olt0teumio nu1lpt mict (farumxmpot0ope mietlsls ea(vonu4 eermf3todla elieo;t0t2xmirpiy1om  mfeias s2tr(rpno4alxoif3iyt s um(vo (4aexnircoadlmDraivol( trtrir nudomeelivsa( aDuax  oo1aptnmf3tadfaDua(vo ()texnir todla rlivils t2toxo3oy4om nmfctlt) 2tm(m ot0ole moetydlm2umumon(0tleoxfcty1op  au s s0trum(r nu1apt livtatf rtmur ot0texo fetatfaDumnvo (0alermr oydfp rli i;(0texrirpnu1lp emfeias arumum ;t1opxoio3ilt s rlu ont) eerirctotopD luei s) 2tmxo3oodoltnmfei sfsDurx p;t4tpxn f3tldls em(vp (0artoxr3tatfm eli s s0teumxr3nu4om  mnes s aDra(m ;u1altnio3iyt s2uluvsnu0 etrif iotoa  auvil(  etrir3oydom emneia(fa2tru  ou4tpeo fciysfa rmnmsnu0 rxoxf3todlm   ieo (0 etrirpiydalee iet s) 2tmurpot1aexnii3ilsla emnvsn(4tlxoxo iadlptelnvsls)s2umxr3iudalt mnesasfs2ua( ono4tlen f3tasfaDemuvp u0 eerirciotfp eli ils)trxrir io1omtn fctl(  rtaum no0apxo o3iat s rmnvs;u4 reomf3oo1op e n i s0 eum(m oydoptnlfesl(f rum( o;u4apto fciltfm uluvpn(0trxomf tadlpD lu s;t srumxo3ny4am e fesas)a2tm( ooo1optnmoeilsfs2umump;u0tlxrmrcoy1omD  n ols  2toxr3oy1lltnlncs t)arrru  oo4opt io3iasla umumo u4trerif oydlp rlneils)trtrxo3ny1ome  ivtat  rra(r nt1alt if3tydls2raumont0 rerir tadlmD  ivo s setm(rpiudal e ivia(faDurxrooo4alxomi3iat sDel(mo;t) exrif tydlm ranes;( trxo(r oudolenmncilt  2rru p;u4tlx moctatfm2rlumo (4alerif3oydfatrauvi;( texoxrpio1lp  miei t) rrru  ;o1apt ifcilsfmDea( o;(4tleoxr oadfm rlnvil()t2xrim3oodam nlfct s sDua( pot4oltnifcilt sDrlu p t4aleomo iatfpDraies;t0 2trxopnu4al  mietl()srrrx oot1oeeo fctlt a uau s;u4 etoxf to1omtelivil()trumio oo1altn fetl(  Drmxroot4olxo ociatfsDulnmo t0texoio oatfpDraieilt texm(o3nu4om n ncs ( a2ra(roou0aeeoifeias a em( snt)altnif3iadlp eaneslt0 etmio3oy4altnmncias aDumu poo4alx  fctyt m rmn p;t4areomocoy1fptrlu s;s0 euoxo3iy1ll  mncsl(f rurxrpnu4tltoioetatfa2rlumpn(0trxoxo ia1lm elivs t) euoxmpiu1olee nvs ()sDtax  nt0tex  feiasla rlnms;t4trenxr iytfaD lnvilt sexm(o3iu4altnmiet s) 2uauroou4oeto ocild s rluvp u) renxociytoa rln il(  2xo(rpiodaptnmiciasfa2rrxm nt0tlto ieias s rmuvp;(0 lenxf oadlmDeaivi s t2tm(m3nu4oleelivsl(f 2tmxmont4olxoii3tadfm elu o;()altrmoctytop rlnvo;s)tetoxm3iy4altnlieias)aDrau ooo0optomi3tltla rlu onu4trenxocty1lat lieilt0t2toirpnu4lp  mivta() 2ta(mono1apx moetytfaDea(ms;u0 rxnxo3iatomt aivo ()texo(o io1omeelfcsl(fa2rrumpnu0aexoio3iyt aDua(mpnu)trtnxo3iatoatrlivil(0srxr(mpno4lpeelnci t a2tmxr ;o4oeeo o3tatfmDrm(mpn(4artrmrcta1lmtelnvs;t0t2um(m3oy4al n ieil( aDtrurp;o1alxo ociad s rm(vs t4tltrmo3oydfat anei;t s2xm(r no4omee ictltfs2umx pot0tlen octydlmDel( onu0tlxoir3iodfp  lnes;t0seum(m oy4ame mnet t s2rrumpno4olt mo3ias a2ranmp t4tltoxo3todop rlnei;( tetoxopno1apenlict s)srrru ont4opxn fctadfm2rmums t) rtoif ta1fp   ueo;t0trxrimpoy4lmtemfcias) Dumurp;o4altoii3tydlmDelu sn(4 eeoxf ta1fm rau o s) rxmiopiy1am e fei sf 2rrum ou1tetnioctlslmDra( s;u0aeeomocoydlpDrliei;t)trto(m3ny4opeemici s  2raurpou1apxo o3tadfm2rluvs;t)alxnir ootlmD  i sl(0teuo(m ou1oltnmnesas)aDta(mpnu4tpto ocild m uanvpnu0tetoxo3oatfateluesls0 2umxo iodlltelfcils) Dumxro;t0oleoioctydfm ua(vpn()altrxo3tatomte n olt) 2tr(rpio4lptnmfcias  rurur nu1tlt mfeiysla2em(ms;()tlxoif3ta1lpteaivs ()srtr(o nydlm emnei tfaDra(  ;t4olxomietat a eau snt0alerxo oa1fp elivolt sexoxmpiu1altn fvil(fsDuau onu4apx  ietldfa ean o t4alxrirctodlpDe i slt) rtmxr iy1alenmfei (fs2umxr nu4apxoiociltlsDrluvp;t4tltnio3iatopt auvi (  2urirpou4alte nei sfsDumx pno0altoio3iydlm2emnvp;u0texoifcia1oatr ieo;s  2xrxr nudoleemfes ()sDtax pno4apx ifctatfa2ra(mont)texriocio1opt  ueolt0srumxm ny4ol  lfvtat  Dumx pot1oltnmfciad aDeauvon(4 rtrir3tytfp  anvo s0s2tmxm ou1lp   ici tfsDrmu  no4texnmoeiatfaDumuvp t4treoio3oa1lpt ai i s sexrimpiu1op emfci s)sruru  no1open o3tat sDuanvpn(4 lerioctodom e n s;s0 2urir3oy1lmte fvslt  Duaxmpot0aee mo3tlsfa uauvont)texrmr iodlpteauvsls) etrxr3ny4omee fvt s)sDraxmo;t4oexo f3iysfs2rmn s t)alxrxo iodlateauvs;t) 2trirpoodlltemivt (farurx poo1tpenifciytls2ran pnu)teeomo3oadfpte uei s)s2tr(o3nydam n nct () Dum(mpnu4ope mf3iasfm2rluvsn()artoifcoatoatr nvil()truo(rpoo1lpenmiviasfsrrmump;t0apt  ociytfmDulumsnt)tetnxf3iytfpDe n o;s0tetm(m3oy4amt mfctltfsrurxro;t1aptniieiadfa2el( sn(4aetoxocta1fat  uesl(0 exmxmpoo1lpe  fcsasfsDtm(rono1aptn fciytfaDemnvo u4artomocoodfaDr nesls trtoxrpoy4ap nlnesat)srur( p;o1olenmfetltlaDemn s u)aeerxr oydoptelivo;t)teumxrpiy1lle  icil(faDumu pou0tpe moctld aDea(von(0 rtrxr oy1fa r iei;()seurim oydll nlieia(  Dtr(mo;o4apxoif3ilt sDrmn pnt0treoio3iatfaD ai s;(0truoxr oodlptnliei (  Drru  ;u1alxo feiatfa ua(msn(4 exnir3oydoatrluvilt0 2trimpnudlle  nctlsfsDta(  oo1tlenii3tad aDuau o () rtnir oy1fmt  uvil()trtoirpoy4amt  fvs tfs2tmx onu0olxnif3ildfmDranmpnu)arxomrcoy1om rluvs;()seto(opny1apeemfvsltf 2rau p;t0olxomf3iaslm2ea(vp u4trxriociadlaD lnei;(0setoxm nodapen fvsl() 2rm(mo;t1aeeniiciydfa uanvsnu4alxrio3todfmtrlnvilt0s2tm(r ny4ol emfct s)s2rruro;t4altomf3iys a rl( s u4 ltoio to1omt  u s ( seurxm3nydllee feslt  2trxrp;t0aexn feiad mDua(mp;()tetniocty1fpDr nvs;t0trxrxo3nu4ap nlfes s a2ra(rooo0aet  ociatfs ran onu0texnmocoo1fptelieslt)texrio oy1oltnlicsat  Drmxmpot4tpenmiciad a2rmn pn(0artrif3to1omtrlneols0 rxmir3nodlpt lfvta() 2tmxm no4alxo iciasla2eaumsnt)tlxnif oatomtrlnvs;( s2toxr iu1llt mnctl()sDrm(r oo1aptomfetatlsDrauvsnu0aetrmo oy1op rauvo;s) etr(m nudlpt lneilsfa2rrxm nu4ope mf3ias m umuvs u)aetrmo todlatrlnes s t2xmirpiydlmeelfci ( s2rr(roou4tpxnifciadls ranvp;u4tleomf3todlptrln i s  2xrxm iu1lpt licsas)srra(mp;u1oeenmiciaslmDeanms t) rerxoctodfmD livils0 exrxm3iu4ape mfvi s sDtm(ro;o1texnmfciad s ua( p t0teerxf iytlp elieo s0trtrxo oodlpe lieils a2um(  ;u0tltn fciadfa ua( pn(0treomrciytfmD aivolt0 rur(o nudomte ies t sDra(r ou1tlenmfcias aDem(mo t4 renir3oadoaDranvol( srtmir ny1llee icsas)a2trumpoo1oleo oeiat s uan p t)aeenmr tatoaD  ues;( trtrxr iy4altemfciat a2rr(r oo4oleomoeiatlmDumumsnt)alxomr3io1oa r n slt0srtr(o iu4llenliesasf rrmx pnt0opt iictltlm2eln pn(0alxnifcoadopDeai i s)seumir3oo1op e icia(f Draurpou4aee mfetldfaDrm(vp;u)alxrmo3tatlpD  nvo t0 2to(r oydol n fcslsf Dtax ono4tpeo f3iyslsDuan s t4treoifcoydoatr nei t0 rur(o oy4alenmnvtat)a2tmur ;u1tltn octldfs rmnvs;t0 lenmr iodoatelivol(0 2xoir3iy4apenmnvi (  Dtmxm ou0tlxomiciltfsDel(vonu4tlxrxo oadoa   u s;t0teumxmpou1lme mivtltfarrmxr no1alto ietadla rmn p (0 reomo3oytlateauvs;s0sexr(m3iudop  lneslsfs2rmxmp;u0open i3tasfmDeanvp u) reoxo oatom  aivolt0s2ur(o oy4olte ncilt)aDrrum ;t4optomf3tytfm2rmn pnt4artnio3todlpt lnes ()t2trxo ny1ll nmfes ()a2rru pou1altnmo3iadfmDeanmsnu4 exoxr ootfpte u i t0t2xr(rpiudolte ieta()srtr( o;t1alx ifciasls2rl(msn() ltrmr oa1faD lu olt0trxoirpiy1ol e nvt s sDur(mo;o1tee mo3iys sDemnmont0trtoio oo1lmDranes;(0s2xoir3oo4olt mieta(fs2trurpnt4altnmicildfmDuln s;t0 rerxo io1lmt  ueslt texoxopny1ol emivia() Dtm(r nt4tlenifctlt mDelumpn()aexrxocoa1fm  lnvilt0 eum(rpiu4al nmfviat)artm(m nt1tetoiocils aDrmu pn(4teeoxf oadfmtrai o;t0seuoio3no4lmeelfct ()s2rmump;t1teeomfctltlsDea(vpnu4aetnio3oodop   nes t  euoim3iydaltelies tf 2rm( pnt1tlx mfetadla uluvsnu)teerxocoatfmDelu o s)s2xmir3io4apenmici sfs2umx p;u1aet micildfs rl(mo () exoxocia1oaDe i ols  2to(opnu1al elfes t aDta(mpoo0apt mi3tltls umn p u4 lenxocta1faDraivi;(0srxmiopiy4amenmfcs s  2um( pnu0olxn ietysfs rauvs t0 lenxfcoa1fateluvs ( seuoxo iodamt  ivsatfs2rru oou1tpx io3iltlsDrlnvp;u) ltrxrcoydom  anei () exrxopio1ale  iet ( aDrmu  ;u4openii3iydfmDra( snt)tetrir3iodfmD an i s  etrio iudaptelfesltfa2taum nu4oee ii3tysfsDel(ms t0 ltoxf iodoaD anes;t0teumim iu4apeemnesas) Drrxroot1aexniicilsfm rmn p;t4arxrxoctodfpDeaivo (0trto(rpno1ll e ictas aDtr(mooo1apx mictad s ea(ms;(4trxrmocio1omDr ies t  rumxmpoy1lpen ivi tf rur( pno1tlx ii3tatla2emump u) lxrmo tatfmDe ueols0srum(o3oo1am  lfciat)a2uaxront4opx  feiat m2ean o;u0 rtoxrciy1oateauvs ()setrir nu4lm elfet t  2raxr no1opx ii3tltlsDelnmp u) etoxfcoa1opDeaneslt0 euriopou1omt mfctls) rtrxrpot1aeenmi3tyt s2rlnvo t)aeenxf3oo1opte ivi () rurio oudal nlfvtlt artrxrpnu0tex io3iadlm2ua(vp ()trerxocty1om rauvsls0s2xrxrpiy1lpt  fei t srrmxr ;t4tltomoctltfm2ean sn(0 eenirciydfmDr u i (0trto(r3ou4lmtemici tfsDtax p;o1ale mociytla2ra(vo u) lenmf3ia1fate nesl(0 ruo(o iy1lme lnviatfs2ur( o;u4olt  fciasfm ul(mpn(4trxrif oo1laDeaivs;()s2tr(mpoo4lmt  nci (  Drax p;t1tex  i3iytlm ulump (0aetnif ootopDr u s;(0t2to(opno1lp nmnci tfsrtaum ;u0tet if3iatfmDrlumpnt0arxomf oodla r u o;(  etoim3ny1ll nliciasfsDtaurpnt0tpe  fetlslaDemnmsnt0altrxo oatlat anes;(0srur(r3nu4oltemnetat aDuaumpot4ape mi3iat s2rmnvp;t4teerxf3oatomD  n i s0trumxr3ou1ol n fvs (  Drrx pnt4aet mocildls ulnmo (4aeeomr3tatla  auvs t  etrirpoudlpenlfei (  2urumo;t0oeenmi3ild s2elu s (4aexnmrctotfaDe i ils  eurirpou4am n ietlt arur(r ;t4oetnmoeiysls uau o;u) lerxo ootom rai ilt teuoio3ou1optnmfct (f rrr(mono1texnmf3ildls el( ont0tetrmfctytomt  u i;t)trtrirpiu1lptnlict ( a2rrxronu4olenmf3iltlaDelnvp;(0aetrir iadoa e i o t t2xm(o3io4aleemfeta(fs2taxrpot4texniociyt a2rmnms u0trtrxocoo1fp rli o;(  ruo(m3oodlp nmivt ()a2tm( oot1alt  f3tatfsDuluvsnt0 exoxo iydfpt au o;( srxrim3oudlp nlivsatf Dra(rpot4tlxnii3tys sDumnmo u4tlxoir3iytom   nes;(0s2xr(rpny1lptn netlt srtm( ooo1ale  f3iyt m2uln p;() eerir3totopDeaiesls) rtoim3oodlmee neiat)arraxrp;u0oet  ictyd aDum(vs u4tltomo3oytla  anvo s t2tmim3oydam  mnciat) Duax ont0tptn fetyd a ean s u4tetnxrcty1lmtran il(  rtoim3oy1op   fvt ()arra(mpnt4ape mo3tadfsDumn pnt4 etrmfcoy1oaD aueo (  rxmir oydlmtelici () 2taxmpnu1olx ifetatls2rluvsn() ltnirciatoa e u ilt0t2ur(o3iu4olee ivt tfs2ra(m ou1opt mf3ilsla2ul(mo u)teeoxo iy1fpt  n ilt  rtmir iy1ll emivsasfaDur(rpnt1oetnmi3iatfaDrm(mont0artnxo3todfa r neils0setoirpoy4lmtemietl(f rua(r ou0oetoif3iyt sDum( snt4 ltrxf3ia1lpDeaueil(0t2xriopiudlltnlfes t srrmuro;o4tlx moeiatfsDuanvo;t0aexrmociadfa e ieo;s) 2trxm oy1ol e fesl( aDtaump;u0tex  feiydlaDrm( sn()texoif oytfa eln o s)sruo(rpnodal  mici t  rtmur ;u1tlxnifetyd m2ra( s;u)tltrio3io1lpt luvs t0 exoxopnodaltelivtl( s2ua(moot1oexomiciyt mDemumo t4 ltrmf3oa1lp r ueilt0trxm(r3nu1lle lfvt t aDumumont1aee mo3tydfmDeau p;()trxrxo ia1lat ai s (0 2xoimpnodamtnmieta(  2rru o;o4alxo fciytfmDumuvp;u0tltrmr oydfmteluvols tetmiopny1omee ncs (  rtr(mp;t1olt mo3ilsfm2ulnms u4 leoir todfa elnvi s s2uoxo iodll  mnesl(fs2rax o;t0tpxn fetytfs2rl(mp;(0trxnmr3iotfp   i i s  2urxr nudopeelnci s)arurur ot1tet  o3iadla2umu o;u0arxrxr3tadfmD lu il(  2to(opio1ol emnesasf rurx  ;u0tleo ietasfsDuanvon(0 lenifcoy1op e u ilt teuoxo3ny4ome  nvi s)sDrr(ro;t1oeenioetad a2uanvonu) exnmo3oodomDe ivs;t)t2um(o3oudalt  fct s aDum(rpnu4tptomf3tatlmDrau snt4alenxr oydlaD an o s trxoio3oudapte ivtl()a2um(rpot0ole iictysla2ranvo;u4 etrxo3iotlpt  u i s)s2trir oy1aptn fci s  Dtaurpou0oleomiciat s2rmumo;(4 renmr iodfm e i s;s0t2uo(m3iudlpt liesas sDtrx  ;o0tpx  o3iad a2uanmp;(0tlerxr to1oat li i t)srtrim3iy4omee fei (fs2ta(rpnt1alen oeiyslm rlnmon(4aexnmo totfmteaiei;( srtoxm3iu4olenlfcilt arrmu  ot4altomfeiytlsDuaumpnt0 ltnio iy1latraieo (0trtrxopiudopenmivs ( arrr(rp;u1oexn ieiatla2eanvsnt)tetrmrctytlpte ivi;s0s2trir3iodlp n ncsls) rtm(ro;t1opeoifeiadlm emnmo;u0tetomfcia1lpDrlnes ( t2trxopoydam e ieslsfsrur(ro;o4aee ifeiaslm rau o (0alxrioctydlm  aueilt0t2xoxm oo1lleelnet tfarra( pno4tex  iciytfmDrm(vp;u4 rxnio io1fate u s t srumio3ou4am  liesat aDrru ono4oleo ieiytls rmnmsnt4 rxriociadopte u i;s  etoir io1lmenmiet s) 2rmur oo1tlx if3ils s uluvp u0 etrio3iatoat auvo;(0 2tm(m3iy1lmee ivt t aDuax p;t1tltoiieiat mDuauvont4aeeomf iodla  aueols0s2um(o3iudapen fcil() rtrxmo;u0olx  ictat m emuvs;t4treoif ty1lm  anesl(0 rtriopnu4omtn nctat)s2umum ;u0ale mfetadfsDelu ont4arerio oo1fp r ueols)s2xr(m nu4lm nmnet tf 2rmu pnu1oleoioeiatfmDranmp;t4altnxo oodlptrlu ols teuriopnydalte nctls)s2rax  ;o4apx ifeiytfm2ea(mo (0arxnmo3tadlmt  nvsl()s2tmir3nydopee ietls)sDua( pnt4opxomi3iytls em(ms;u)aeerio ootfaDe uvi;(0 ruoimpou4lpenlivtl(f 2uaumoou0altn ociasfm ean ont0trermr3iadfat ln s t t2uo(mpoodopen nviasfsDrmx p;u4tex ioetad a2eln ont4texnxo io1oa rlu i t0srum(o ou1op nlfvtlsfaDur(m nt1oetomietld s umn s t) exrir3oodfmt  nvo s)srxo(r oudolt  fcils) 2raumo;u0tleo f3tadfaDemu o;u0areomfciydfatr ues;s0t2xmio iu1altnmnctas  rur(ro;u4tlxnmieilt s2umnvs t4aexoxr3oydlaD  uvi ()sexr(opiudop  mnvil() Durx ooo0tpxoiicild s uanmp;u4 exrir3totlmtranvo;(0s2xoiopio4lme lfctl()aDraum oo1olxomociatls2eanvo (4trxoio oytopD aieils0t2um(mpiudole  ncs sf Drrxm ;t0aex  ociat mDeau s;() lxrxo3oatlpDeanvi (  rtmio iy1ap n ici sf Dtau  no0tet ioeiadfsDel(mo t4trermfctotfm  ln o;()srxrxm iu1lpee iesat  Dtau oot1oeto ieiltfa elums;() exnmf3oo1oat ln i;( teur(r3oo4llenmfei sfaDtrxmo;u0tetoif3iadfs uanmsnt4alenxf3io1late nesls  2xr(r no4optnliesasf Dtmxmpoo4aex if3iydfm2em(vp (0trtoircia1fpDrlnvi (0 rtmxr3nydlmeelicsltfa2urxmp;o4tet mfciytls ra( p;u4alxrxo3oy1lm elneil(0 2xm(o3oy4ol n iviat a2urump;o0apxomf3tydfa2ean p t)trxomo iadlaDeaivs t0s2xoxm3io4al elicils)a2urxro;u4olt if3iytfaDel( pnu4tlxnif iy1fmD lneo s s2tmxm io1llte ieilsfsDtruro;o4olxoifcildls2rl(vs u) ltrmoctatla rluesl( s2toir iudol n netat)aDraumpno4olt iicias sDeln o (0teeoxo oadop eau ol(0trurir3iudol n ncs t)srrm(mont4tptomoetaslaDulums t)aexomr3totomt lneils) rxm(r oydopee icsl( srtm(roou4tptnmictldls2ua( sn(4trermo iodfmteaiei s  2umxm ou4lmtnmnetlt  2tr(m no4alxnifetaslm eanvo;()tltomf to1oaDe n ilt)trumim3iudlp   nctl(f rrau p;t0apx  f3iat m2elnmp t)altnmo3ta1opDraies t0truoxr nu1lle lfvtls  2umurpnt1tpt ii3tys sDum(vo;u)trxoir oa1op  liei;()sexrxm nudolte ici s)arrr(  ;o4tet mi3tlt m2rmn sn()aeeoxf todlp  an o;(0 2xo(r oydopenlivsl( s2rrxrp;u4tle mfctls mDeauvo t0 eerio3oa1lpD  uvols)s2toirpnodoltn ncslt srumxmpno0tee mieiytlm emu pnt0alerifcta1fat lu i;s) 2umirpiydal  lfetat)artaxm no4optnio3iytlmDel(vs ()trtomr ootfmDraneslt)s2tm(r3oy4lpeemivta( artrum ;t1altnio3tytls elnmp u4trtoxo tadlmt lueo;s0 rurxr no4amtnliviat  2rru  nt4tleo icildfs2uanvp;u4teenif3iatfmte n s (  2xoxr nodoleelivs t)srtru ono4tpe  fctydfm ul(mpnt4 reoio tadoa   i s ( sexmxmpnodlle mfvs (f ruaxmono4ope mf3iys a uauvp;u0 ltoxf ta1lm ranvils0srurxm no4al elnvsltfs2rax p;o4oexn o3tldfaDem(vs u4 exoxr oatfm eluvs;t0setmirpiy1op n ictl(  rrm( o;t4texn i3tadfa emu on(4aeenxf ootlpDr iei t  exrxo3oydop nlncsat) 2raumpot1opx iictadla eln o t) rerxf iydla eau s;()teurio3iodlm nmfvils aDrm(mp;u1tlt mociys aDuaums u)aetoxfctotlpDrau olt)t2umir oodom e ncil()aDraurpnt1opx iieilt mDuan pnt)tltoif tatlaDr n i ( s2uoiopnu1llenmnvtlt  2raurooo4tptomo3tysla em(mpn(4altrmociatomt au i;t) rxrxm3ou4lme mnes (fartaxmoot1optomoctltlaDea(vp (0tetnif to1fmDr nvs;(0 2xoim iu1omenlics t a2tmum nt0tex moetldlmDranvo;t4tlermf3tadlm r uvi;s s2xrxmpiodop e ici tfaDurxmpoo4tle mietasls eluvpnt)arxnmr oodlptranvil(0 rxrxr no4opt lfetas  Drrxmont4texnmf3tlsls2ua( o;t)texnmo to1fmtr ieo;( trxrxmpiy4lm  mncil(  2rmu ont4olen ociatls umnms;t4tleomfctydopD anes (0 2xmio oo4aptnmnet t)sDtrurp;t1tet mf3tys aDrmnms;u)teenmf tadlpDelu s;t seur(mpou1ol nlietl( a2urxro;u4teeoifeilsla ua(msn(4artnmf tadlp  lneo t srtrimpiudop e fvtasfa2raxmp;u1aptnioeild m2ranvs;t0treoif3iydfmDranei ()sexmxr3iodaptelivsas)aDtmurono4aex mf3ils a2ul( o t4tetrmf iydfpD anvsls0teur(r3nu1amtemnesltf Duax  no1alt micildls2elu p;(0tlxnxr3io1fp  au sls  2xmio3nodlle mnvtlt aDtrxrono0tlenifciydlm2ranmsnt0aexnmf3tadfaD lu ilt)srxrimpiodlp emfesas)s2uaumpnu4teenmociatfs rmnmsnu0 eeomf3iydlmt  n i;s0tetmxo3oy4op nmfvia(  2uaumpno4tlxo oeiydlm2elumo u0 rerxfciatlaD  u sls trtmxm ou4lmtelfviat sDrrxroou1aexoiicilsfm emnvpnu4arerxociodomte nei t) exoirpou4omt mnctasf 2ta(mpot4opxomf3tadlsDum(mo;t0 renio3to1lmDe ivilt) rtoiopou1ll   fet s srtrxmp;t1oltnifciasls2ranmo;()aeenxrcio1lpD lnvs t0 euo(opnodale mnvsas)s2rrxrpot0olto feildfsDrmn o u0 ltnxfcoy1oatelivi (0trumirpno1alee ieiat)arum(mp;u4tee moctadfa2umnvo;t)alxomocoatoateanei t t2urxm iodll e iviat)srtmumpou1opeoioeiysla umn s;(4aeeoifcoo1opD aieols0sruoxopiy1opt mfcsls)s2rmx o;u0tpx ifeiad m2rmuvp;t)texnifcoytlat aieo t0t2to(m3no1ll nlfetl(f rtaxront4tpto ietasls eaums u)aetnio to1opD  n o;t  rur(o io1ll n net sfsrum(r ;t0tlx mi3tadfa rlnmo;()aexomo3tytom r ues;s)tetrxr3oo4am nlfetls)srtaurp;t1opt iictad m2em(ms u4teermocoa1fm e u ilt0 rur(r3oydol   feil()srraxmo;u1teeomociltfa2emuvo;() exnio3ty1oaDeln o t0 rtrim3oo4amte ivta()arrr(rpno1oexoifcilsfmDumnms;u0texoxo3totlpD an i;(  2urxr3ny1amt mfei (f 2tmu onu1ope io3iad mDuln p;(4aeenxf iatlmDeau o s)srxrxo3nu4openlivsatfsDtaxmooo0apxn feiasla2umn pn()artrmr3ta1oatrau o;t  ruoio iu1lmtemicilt)artau  ;u4opxo oeiasfsDua(ms;(0 rtnmo3iatoateln i t)texmxr iy1lpenmfeil(faDtrum ;o0aeenmictyd s2rmu o u0aetoir todoateln o;t0t2xmim3nodlm nmieiat)a2umx p;o0alx mfctatfa rm(monu) rtnmf3iadomte ieo;( s2tmxopny1omenlicsa()s2umurono4apeniiciad aDul(vs;u4treoio to1fpt lnvslt0srtoiopno4om nlfvtat) rurxr ou0teeomoctltfa2uan s;t0aetomf iy1lat aiei;( texoxr3iu1lltemici sf rur( p;t1texnioctyt sDeanmpnt4teerifctytopt li i;t) 2xm(o nydal emict s) rrm(  ;t1aeenmoetyslmDean p (4tlenmf iotopD aieols0 rurir3iydop n neiat  rrax  ;o4aet mfeild aDuanvo (0 lxnif3iatfaDranei s0 rum(rpoo4lleemiesa( artau  ;u4aex mfciysfa2emuvp;u0 ltrmo3oy1opDr n i;t  exmim3oodap nmfesl(  Dtrxr ;u4texoio3iad s2em(vont0 rtrxociydopt li o t trxrxr3iudlme lnei s) 2ta(rpno4tet  feias mDumn s;u) eeoio to1fm rluvi t) exm(m3oodom   nvta()a2rm(rpnu0tlxnmietadfm ul(vo (4aleoir oadoatran ols)s2xr(o3ny4lptn ictl(  Dtaxmo;u4oeen iciltfs ulumon(0tltrmo3iy1lpD ln s t) rxoxrpiudam emfvtls) rrmxmoot1apx  fetytlaDrl( s;()teermociatomD  i s;s s2xoim3iu4ale  ivsat) rum(r nt4tex ii3tydlm2um(mpnu0alenif tytla  aies ( t2urxopnudop elfvt s)a2ua(rpnu4altn ietys a2rmn snu)trermr3oytfatelnvi;t seuo(m oy1apt lnetl(f rtax poo4opxniieild sDua( p;(4tlxrmo3totop eli ilt0 2uoio iudopt lfctlt  rrm(monu0teeo o3iadlaDulu p;t4alxnir3oadlmDr nvi t)s2um(mpny4llt mfesl(  Draump;t1oee mfciysfmDul(msnu0tlerir tadfa eauvs;s  rtmxopou4op  mfvtatfa2um(r ;o4oexnio3iydla2um(mp t)alermr tatfpt lnei t)teuoim iydom nmicil(  Dumx o;o4tpeo iciadlsDraump (0trtnxocoy1lpteaivs;s0 euoxrpnudlltelnesatf rrrx ono4ale  feildfs2ul(ms;(0aeermr tadfa eln ilt) rumxr3nydlltn fcsas) Dumurpnu0ole  ietadfs eanvo (4tlxoxf3ty1fpD li s;(0texmxopny1olt lfctl() rtau  ;t0apt mfetydfa ra(msn()trtomfcoydfaD  nvi;t sexm(m nodamt lnes (fsDrau p;u4aetnio3tasfs eluvo;(4trxrmr to1lmDelnvo;()truoxmpno1oltn nvtls)arta(m no1texoio3iydla eau p;t)altnmf3oa1lm  lu sl()seuoiopoydale  fctl(  Drau  ;t0olto octltlsDua(ms;u)treoxf3ootoate iei t0 eumir3nodlmtnlnesa(fsDtmump;t4optn oeilslmDulu s u) rerif3oa1laDraieols0 eurio oo4ll emfeiat sDtmu pno1oeeoioetyslaDum( p u0 eeomf iytfpte n o s sruoxrpiu4om  livilsfa2rmu  ;o0apx  ieiadls2ean s;u4 lxnifciotoaDraues;t teuo(m3iu4ope mfctlsfs2raxm oo0aptomi3iad a umnmo;u4teenmr3oy1lat li i;(0srtrio iu4oleelnvils  rra(rp;t0alx mi3iasla2umu s (0 eeomf oo1lpDraivo;(0srtoxr iydapenmnct t  rrrx o;t0oexomociysls2emnms;u0 rtoifciatop r nvo t) 2xrir3oodome mnvils) Dtrur ou0oltn fctld sDelu o ()artrmr3iotlpt lu i;s)srto(r nydlpt lfvslt)srrrx  nt1tee  iciltfsDelnmo;t4 rxoxo3iodlaDrln o (0 exmxopiu4amtelnciat) rtau pot4aeeoioctas sDul(mon() eeoio3iy1la elieo;() 2xoio3oy4ol n fcia(f 2rm(  ;u0aexnifctasls emu pn(4 lxniociy1laDrai o;()seuoxmpio1lmtemnvt sf 2urumoou1tltomfeiadla2el(mo t4treomo3tatoa   nvs (0tetmimpno1alt mfcs t artmxm ;u1olxnio3ilsfsDrmnms t0 rtnif iy1fp  lueo;()trxmimpiodol n nct (  2ra(mo;t0tpx mi3ildlm2uln s u0 rxrmfciadlp e ieil(0sexr(opny1op n icsl( s2ta(mp;o4apenii3tadls rm(vp ()arxrxf3oydomDe ieo;s)trxo(o oydomeelies (fsrtmum nt1alx  oeiadlaDeauvp t)tlenmf to1oaD  ies;t0sexr(rpiodlltemici s)sDrau pou0tptn f3taslmDelump t4artoxfciytfaDranvo;s sexrir no4lmt mfvs tfa2rmumo;u0aetoifeiat mDuln p u4 rermo oydoaD anvo;s  eumir3iu1openlnvt tfsrtaxmono1oleo i3iadlmDra( s t)altrxr iadomDelnvi;()s2toxrpny4opeemiviasfsDrmurpnu0teeomietltls rmu o (0alerxr3ootomtrluvi;t s2xoirpiydop nlfcils)artru pnu1aptnmfciat a rl(vs (0 rxnmo3oatlpt livsls)sexrim3io1llen icsls)aDra(mp;t4oeen fciys s2emnmsn()arxoxr oo1lptr nvsl(0s2ur(m3no1ll  lies t  rrr(mpnu1olenmictldfs2rl(mpnu)arxrxr3oy1fm eln sls srxr(mpou4amenlfvil( a2rm(mp;u4oexn o3ils a eanmsnt4 eeoxocoytfpDrlnvo;(  2um(rpnu1opt  nci t  Duau o;o0tpxoif3tytfa umuvon() rxrmf iytfmD auvsls0srtoio nu4apt  fctltfs2raumoot0tpt mictyd sDean snu0 eerio3iatfmtrlueils) etoxr3oodomtnmivi tf Duaxmoot1ape mfciydlm ea(vp;t0 eermf todoa rluvi;t0 etmir oy1ap e nct (  Dtaxr ;o0aet  ociytls2ra(vpnt4aetrifcoo1lpDe u o ( trxoxo3iodamtelfci t) 2raxrpou1tleoiieiat m2uaumont4artnmrciodlat ln o;() rtm(r oo1omeemnctat a2urxrpnt0aee  ocild aDua( onu0teerxr3iadlm ean o () exmirpnydaptemfes tfsDrr(rpot0tlt mo3iytla2em(vs;t4tltomo iy1oa raues;s0 2xoxopiodolen ncsat) Duax  ot1tet mocilslaDuanvp t)artrxrciydlatelueo;s0 rxm(r3oydome lfes t  2uaum ;o0tex mfcilslmDemumon()arxoio3oodoa  lu s () rxr(opou4alt mivta( srtau  ou1tet ioetad a2emnvonu4 eeoxr iytlmteanvs (0srtrir oodalen net tf Draur oo4tptnio3tlsfs uanvp () eerir tytlmD luei t truo(opiydomenlfvs sfsDrax pnu0aetnmo3ild s umnvo (4trtnxociatlmteaieil(0 2xoxrpno4altn ncsa( s2um(  nt4tltnmf3tltlsDrmuvpnt0altomrcio1latr n i s  eum(rpiudopee feilt  2tau  oo4aet mfeils m emnvp u0arenif3iytlmt livi;(0tetrio3no4altemnetls sDtm(r nt0texomi3iltfa um( o;u0 rxoxo3ootlmtr uei ()srtr(o3nydomeemivia(f 2uax  no0oee mfctlt sDrau on(0tlxoio3tydfmDr uvslt0srtmxo iy4lp  lfcs s)aDurxrpou4tptnifeildfs uau onu0tltnxo oatomtr uvolt) ruoio3nu1alt  ivsat  2rruronu4apxnmocilt s rl(vs u4arerxo3oydoa e nvi;s)t2xr(mpiy4omtemfct (fa2umumpoo1optnmfeiasfs2uauvo (4texoxociadfpt lnvs;s  eurxm3iudamenlivta( s2rrx p;o1texnio3tatfm ra( o;(4 eenxo3todlp e u s;s) rxm(o iy4lleemfcsas)aDumu  ;u1opxoiiciytlm rl(vs u)trxomf totfaD  ies s)teurio oydope livils  rrru p;o0oltomfctlsfs2elu o t4arerifcoa1fmt lnvs;t truoxo ny1apte nvsls)aDrrxmo;u1tlt iieilsfaDra( onu4alxrxr iytom r nei;s t2umxmpiudlpenmfct t)aDtrx  ou1alx iieils a2elump t)trtnxr3ia1oa eauvs s0trumxr io1ol  mnetl()srta( o;t4open o3taslm ua(mo;(0areomo3oodfmDelu o ()sexo(opnodlmte fciat) Dum(rooo0tpenioctadlm2elu s;t)tlxnmo tytfmtrai ilt0srumir3oodolenmnes ()aDur( ono1apxomo3iytfs el(vs u)tlenmf3iytomD anes ()seurio3iy1amtn ivsatfs2ra(mpot0tpxoiictytls ea(vpnu) rxnxfctotfateln s t0srxo(rpoo1ameelneia( srtmur ;o1tleomociytla el(mp u0arxoir3iodoa   neil()seumxo3oodal emnvsat s2rrxro;o4tex  fciytfm uaump;(0aetoxr ia1fa e ueo;s s2toxr3iydape  nci t)aruaur no4tpto f3ias mDrlumpnu4 reoxf3oy1omDeliei t0sexo(mpny1olenlfct s)sDta(m nt0tleoioctadls2rl(msnu0aeermrcta1om e i s;t)teur(m nu1lmtnlfeta()sDrrur no1tpxoii3tas s2ua(vs t0 lxoxo tydfat auvi () 2xoxmpoydom nmivt sfsrtmu pnu0tex  i3iadlsDum(vo u0 rxrir iy1fpt  nvols0 rxoxo nydapt miesa(fsrtr(monu4aet  octld s umn s (4 exnircty1oatr ieo s)setm(m oo1lm emictltfaDrau  ou1tleoiociat a2rm(mpnt) leoio3oytfpt  ivils t2xo(m ny4om  lfeil(fsDtm(mo;t0teeoii3tlt mDrmnmo;u4 rtoxfctadlmDrln s ( sexmim3nodomeelivtat)aDtmxmpno4altomi3iyt s ulnmo u4aeenifcty1oaDrauvo t)texrir oo1optemnvs s  rtrxrpoo4alenio3ilslm eanvp t) renif io1fateaueo;t)s2xrirpiudlm elieilt)srur(r ;u4texo i3ildls uaumsnu4treomo ootfatr uvi t) eum(opiu4alte ictlt  Dumxmp;u4olxn ieiasfa2rl( s;u0 ltoirctydoat au s;t0setoim3nydom elneia()arum(m ot0ale ioetasfa el(monu4trenxo tydlmD li slt)seumim3ou4op emfvs s a2trxmont4tetn feils a emu o u)teermfctotlmtr n il(  2xrxo3iu4apeemivtasfa2ta(rp;o1alt  o3tytfaDeanmp t0 lerir iadomD li ol( teum(m no1oleemicil( arum(root1oetnio3tytlsDemuvo;t0arxoioctodfm  li ils0seurir iodlm n ietls aDtaxrpot1tpe io3iat a2umumo t0tltoircoodomt lnvo;t) 2xo(m3iudlleemncs tfaDra(r ;t0tlxn i3iyd a ulnvo;u) ltoxf3oo1oa elnvsl( teur(opiy1am nmies (f 2tmx onu4texo o3iydlm2emnmo;(4 rxrmf tytla eaieo;t trtrxo nudllen ivi sf Dra(rp;t1oet  octadfm uluvo;t4tetoif iatla r uvs;(0 2xm(r io1am e ivsas)aDrru o;t0apx mf3iat s rm(ms;(4 rxoirctytlat  ivo t0srumxr iudale mnciat sDurumo;u0tptomi3iatfs ran pnt) ltomfctatoa elnei;t  exr(mpoudolenmncta(faDrrurooo4ale  f3iatlaDul( p u4 leoif3oa1oa e ivilt t2to(m3nodopeemfcsas  2taxro;o1ale mf3ildlm2rln s;t) eenmrcoatfa e ues;t srxo(r3oy4olt  nci (faDta( pot0ole mocils a rluvp u)aeerxfcoadom e i ols0t2xmxopiodop n neta(f rrmxrono0tee  f3iys a rmn s u)areomf oo1fp  li s;t s2to(m ou1omt  ieslsfsrtru p;o4alxoif3iydfm rmums;(0altnxociotomt lnes;t0srurio oydope  fct sfsDtaxmpnt1olx ifciaslm2elnvp;()tlxoxo iydomD ai sl(0 euoxr io4ol emfct sfa2raxrpou0aexoio3iltla elnmp ()trtriocoodomtr n o t0srxrim3io4omt  nvs t)sDumxmpno0alxnif3tydls2ra( sn()tltoif tadlptrauvols srto(o nydal n fvsas)artrur ;u4oltomieiltlm rmnvsn()tleoxo3oo1opt lueo;()trurxo3oy1olenlnvias)a2umumpnu0oleo oeiltlaDelu s u4artomf todoat  nvo;s setrxm iudlmt lfvs t)aDtm(  no4aleo i3ils s ra(vs;t4aexnifcio1oat  n i t srtr(m3ou1lp n fvs (fs2raxrpoo1aetoioeiysfm2rmnms;() rtrir tadlate nvo;s)trtrxo nodaltemivta(f rum(r ;o0oleomoetltfs2eau s t4teeoxrctotfa elu s;t0 etoxr3iy4op   nvtat)s2tmxmo;t1olxn ietadfa2ra(ms;u)aetnxfctatlpDeln i;s0s2uo(rpno4opte fctl(  2urxrpnu4aee  o3tadlaDulnvp;u0 exnif3ootomD lneo;s0texmxm3iy1ol  lnctl(faDrr(roou4ale ii3iysfs2rlnms;(0alenmr ta1omDrai o;s t2umxr3nu1am  licsasf rtru  ;u0ope  i3iadla ua( o;t) eeoxr ty1fmDrauvsl() 2xrxm oy1omeemivtlsfsDum(r ou0tptomf3iasla el(mpn(0artoif iodomDeanvi;s0 eurxrpnodame miviatfs2um(m ou1alx  f3ildla2ea(vo u)tlxnmocoy1lp  li o;s) etrxm3iu1ale mfvsl(fsDuaxr ;t0oeto fciasfaDeanvont0 eenmo3totlm eluei;s0texmxr3ny1apt lfeia( sDta(rpno4opto ieilt aDea( s () exomf3iytfp rln s s)truoxr oo1ape lnesl(fs2um(m oo4texomiciyt aDea(mpnt)alerif tytlm rln ilt trxr(r ny1altnmfctl( srtmu pou1teeo octad m em(msn()texrmocoo1lm r ivi;s0sruo(o iydalee nviasf 2rmxrpou1openmo3iyt m eauvont4 lxnmr3oatomtraieo;() 2xrxm3iu1lm   ieias)aDuru oot1oex ifciatfa ul( pn()teenmf3oodop rai o;t0tetrirpoo4opte net tf Dum( oot0opxn fctatfs2um( p t4teermrciydlp  luvol(  rtrir iodopeelfcilt) 2uaxmp;u0texn fciatlmDuanmp;u)tltrmf3oytfmt  neolt  2tm(r oo1ale mnciasfsrtaxro;t4oleomfctas s2rlnmonu)artrio iodopDe u i (0srumxr3iydlptnmfcsl() Dtau pnu0opx  feiltfs emuvon()artnmoctotfm  livol()setmim3iudale lfvi sfarrax  ;t1aee mo3tas a2uan s u0 lenio3tadfmtrlu slt setoxmpiudlpee nvias)a2tr(r ;u0aet mfeiatfm ua(mp (4artrio3oa1om e nei;(  etm(o iydlp elncsasfsDurur ;t1apen i3iadlmDulnvo (4 rtomfcoa1lp rln s;(  2tr(opnydlmeelfvt s  2taxrp;o1opeomocildls ranmo;()trxrif3iadlp elneo t  rum(o oudol nmfvs tfs2rmu p;t4texomictadfa elnmont0arxnmoctadfmDelu i;t0sexrim3io1lptnmies ()srtax ono4tleniicilsfmDumu onu)arxrxr3iadfpt  ieo;t s2tm(rpnudole mnvta( srrru o;t4aetoifeiydls rlnmo t4alxoircoa1oaDraneo s teuo(o oodap nmncs s) rtmxmp;t1tpe iieiyslm2ea(msnu0 etrxr ta1omDrlivils teuo(m io1apt  feta(fs2urxrooo4ale mieildfs2rm(mo;t)texnir tydfmt livo t0sruo(m3no4llen ictl()s2urum ;o0tpeo oeiasfa ul( p ()artrxr ta1fm   n i s0 rtmxrpiu4llenlfesa( aDurumo;u1oeen feiadfsDrm(mo t4 lxrio3iotlp   uvi t)trtoio3no1olte netlt arrm(  ;t1oleoif3iadfa2umnvpnt)trtrxf3iy1lpte nvi t)t2umxo3oo4olt mnct t  rrm(m nu0alt  f3tadfs2ul( p;()texoif3oatfm  aueol(0s2um(m no1omt  ivi (fa2tax  ou1tetoioeiytlm ua(ms u)trenircoytopD an i;() rxmio no1olenlicslt  2raurpou4altn ociasfsDuan p t0alxoxf oatfp ean slt  exr(r io4llt mies s) 2rmxm ;t0aptomo3iyd s2um( pn()trxrxf oodfp   n i;t) 2xm(rpny1omtnlfct s)a2um(mp;u0opeo fciytfs emuvon(0trtomocoa1omDr iei () exoimpny1op emnvi tfa2tru pot1aexomfetytla2el(mp;u4tetriocoo1lpte nvi;s)trur(mpnu4omenlncsat  Durxront4alxn f3iyslmDumuvs u) ltoxr iodopteaiesl(0trumxopnydape lfvslt s2rmu  nu0olx moeiat m eanms u4 rxrmrciytlpD lu sls texmxr3no4om nlneta(fsDrmxrp;t0oet  feiadfsDumn p;u4tetrif3oatlaDraivol()t2toimpoy1op elivsl() 2rrx oou4alen iciatfmDran s;u) rxnif oodfate u s;t srtrxr no1ap   ivs tfartru  ou0aexomictaslaDeanvs u)alerircty1lmt livslt)tetm(rpio1aleemiei ( sDuax pno1tpeomi3ias aDuln o;(0areoxf to1lmDr ueo;s)srtoxmpoo4lmenlnvt s)aDrmu  nu4aet  o3tlt s2eauvsnt)teermf3iotfaD aneo t0srxmim oodlmeemfvsltfaDrrxm nt0opeomoetydfmDrl(mont) ltoxr3oodlaDeln slt  exrio3oo4omenlicils) Dtmurp;u0olenifciytfaDrl(vs t)treomr iodfa rlies;()sexm(rpoo1op   fet s) 2ur(r oo0tptn i3tld m2ul(vsnu4artoir3totlm  au o;() 2uo(m oo4ll nmfct (  Drr( ont4open fetldfs eanvp;() rerxo3to1lpt auvi s0s2xo(opio4alt  fetas artmu o;u0oltoiietld sDrm(vo t4 eenio ta1oaDraneol(  2uo(o io4om e icslt)sruau p;u0aexomo3iatls2raumsn(0aetnxr ootla ran sl(0srtmim3io4lpte fvi t)artmur ;u0apx ifctlsfs2el( s;u0aetnxocta1fatr u o t seuo(opoy1aleelneta(f rum(r ot4tlt ioetlsla2elnmo () eenirciy1omteaues ( t2uoim3iydal  lncia(fsDrm(ronu0aeto oetaslm rmuvpnu4arxomo oa1lp e ieo;t s2to(opoydame  nvta(f ruau pno4tlt mf3tysfs umuvp;()texrif oytlp e i o t)trto(rpio1omte fei t  rtrum ;u0olt ioeiyt mDrm(vs;u0alxnmrciatfat luvi s)s2umxo nydom nlicias)s2taxmoot4aee mo3iltls ean p;t0 leoxf3oatlmteluvo;t0seurxo ny1omt  ictlsf 2ua( ont4opxn oeild s2ra( o (0tlermf3iodoat li s ( s2urio ny1om  mfctasf 2taumo;o1olx iiciaslsDea( s;u)teeriociodfp eai slt) rxmir3iu1lmenmfci tfs2tr(mo;o1tlto iciadla2uauvs;u0 etoxfciodlpD auei;t)t2xmir3iydam e fcsl(  Durum ou1oexnif3ilt s ea(vs;(0alxomf3iydlm eaiei t  ruo(opnydlmen fvs s)sDuru  ;t4tlxn ocilsfm2ua(vo;t0 exnmo tytomD lieils0setmxr iydame  nviltfsruru  ;t4tpe if3tyd a uau s;t0texoio oodlm eai i (  euo(m nu4omeemnct ()aDum(rpnt1aetomo3iytla2ranvsnu0 rtrir oa1fp elneo s)sexmxr iydaptnlfctltfaruaur oo1aex  i3iad s rlnmpn()teenir ta1fmDraneil()srur(m3no4ll n nei (fa2taurooo4alxo i3iadfsDel( s t4trtoxf3iy1omDr nes s tetrxo iu4oltelfvsl()a2taxmo;u4aetomfctyd m2eauvonu0 rtomf3oatoa e neo s0t2xr(rpiydape mnvtat sDrru oou1tlt mfetydla em(ms;t4 eeoif3tadfmt lneo t tetoxr3iy4ol e icilt)s2rr(moot4ole mf3ilsfaDuln snu)tltnxfciatla r neol() 2xm(o oydlpenmfvsls) 2rru p;u1olx iieilsfa2uanvo (0teermo3tydlmtrlieils t2xmio3oy1am nmnei t srtm(  nt4tltnmf3tys aDem(mp u4 rxnxf3to1fm eau ilt0 2tmxmpiy4llee fct s)sDurx o;t4altnmf3iadlsDelnvsnt)alxoifcoydoatelies (0seumxm nudll nmies ()artru ono4aleoifeiltls2rm( s;t4teenio3iatfaDr neolt0 2trxrpnodalen neslt  Dua(mpou1altniieilt a2eln p;t4aetoxr oytfp  au i;s0t2ur(o io1alt  icsa(fs2rrxmpoo4tpx mfeiysfm rlnmp;t0artomfciytoat lnvs () 2xmir iudamte fcta(fsrtax pou0texnmoetatfa rluvp (0texnirctotopt lieol()t2xr(r3io1lltn nviatfaDua(rooo0apxnmoctat a elump t)altrxo3tydopD aivs (0t2to(m3io1omenlietat) rraxr ou4oexomf3iasfa umumo u)aleomrctatlpDr nvi;t0s2xoxo ny1oltelicil( aDraur no4tlxn iciltfs eluvsnu0artoir3ia1fa rln i;()srxmim iudoltemici (fsrtrxr nu0aee mi3iyd sDum( p u4texnir3tadoatelu o;s) 2tr(rpiy4olt  neias  rtmxm ou4tpenifetadlsDra( o;(0 lxoxfcoytfmtr i i;() etr(opio4amte ivtlsfa2ur(m nu0alx mietytlsDem(ms;u)aeermfctydomte n ols0 2xrxo no1omen nvsls  rrr( oot1opx iociltfsDul(mp (0 eenxf ia1laD ln ols t2tmxmpno4oltelictas) Drr(mpou1olx  feiadfaDumnms (4arxrifcoodfa e i olt) 2urio3nu4amtn nct s) rtr( poo0ope ii3iltls2emnvont)trxoxrcoytfpDeln o s t2to(o oydlm emivtl(f Draxmo;t4tet io3iysla uluvont0tlenmrcto1lmDrlivols0 rumir3oodop nmfesls) Dumumpnt4oltn ietatlmDrmn snu4texnmo iotlm  an sls  exmio3nu1olt mieia(f ruaurpou0opto oeias a2eauvs;u4arerxr3tydlaDranvo;t0s2xm(mpou4ap nlieil()aDta(mp;u0tpen octadfsDuan pnt0 lenxf oa1lmt livslt)sexo(m3ou1lptelncil( sDur(mpoo0oeen fciad m2uau s ()artomo3io1opteaueslt) rtr(mpiodlp  mfei ()sDumxr ;u1oetnio3tldlmDelnvp;(4 etrircootoat livol( setmxmpny4om nlieia( aDra(mo;u4tpeomi3tatfa rln s u4teeomo tatoa ranvo;s)t2xriopnydom n fvia()a2taxmpot0tlxn ocild a2ran snt)tlerifcoodom eai i t0trtmirpnodlle  ncsa(  rrmx o;t4apenmfetydfaDul(mp (4arenir3io1opDe ueo (0teurio3oo4ale mnet ( artm(r ot0apxnio3iyslsDum(mo t4tlxnmf io1oa r uesls t2toir3nu4op elfct t  2raum ;o4apenmfcild s ua(vs (4altrxf3tatopD  i s s)seurim nu4olte nvtas) rur(r ou1tptoiocils a ranvp u4trerir tytlpD ln slt s2xoir3ny1amenlietlt) rtaxmpnu0tlx  icilt mDean s;(4tlxnmociydfat auvi t srur(rpiodam emietas srta(ront4tetoif3iad a emuvs u4trxrmf oadfaDrlu i s  2tr(o nydomenlncsasfsDtauronu4tet  i3tatfs ul( snt4 lerxf3ta1fptr ivo t trxoir3oy1lp n fcia(faDrr(r nu0aee io3iasfm raump t)arerif oytla  an i;s srtmxr oudlpt lfcslsf ruaumo;t1tpe ii3iysls ua(vsnu)arxrmf ootfmt aneo;t)tetoxm iudal emiesl()sDtrx  ;u4ope  fciatfm ranvs u)alerxf3ty1fat an ols teto(m oydoptnmfcsls)s2uaxmpnu0aexoiiciatla2ean sn(0teeoxf3oytlatrln olt0t2tmxo iu1ole liesl(fsDtr(rpnu1apeoio3iadls2eauvs;u)trtrxocoytlpD lu s s)s2umxo ny1olen fcslt)srur(ronu4oltnmocilsfm2ranmp u0aeerir tatfa  aivs;()t2trxm nu1lmt mnvtls) 2rmu p;o1aet mfeias s ua(mo;t0altnxr tytlm elnvs s  2to(mpiu4ome  netas sDururpoo1opxoiieiatfs2emnvs;u)tleoxo3totfaDraiei s tetm(opiu4om emncsltfaDurumpno4opxnmi3tyt s eanvonu0altnmo3iytfaDeluvilt)trurim nydomt mnctlt) rra(rp;o4altoiietydfs ul( s;()tetnxr iodlp eauvo s0 2toxr ou4ol   fct t)aDuaxrp;u4apxn octlsfm2elu p;t)tetoiociydlat  ivo;()trtoxm no4altelneslt  2uaumpno4aptnmoeiydla2em(ms u4tetrif3iydfpD aivo t)tetm(mpnudal  lfvta(fa2tmxrpoo1aexoiieiytfm2umn ont)tetrmrcto1lmDrlu i;t srur(r no4lm n iviat artr(m ;u4tet mfctadlm elnmo;u4tetnircio1lmtelueo t)s2uriopio4op   fet (  rtr(m ;o0apxnmociydls2uln pn(4 etnxo tatlptr ivo (0teurir nu1ameemfcs (  Dum(  ou1alx  i3ilslaDrmn p;u0arxrio oatopDe i i;s  rtr(o3iu1omee icsatf 2rm(r oo4tpto f3tadfm2rmu s;t) rtrif ta1lmDelnvo (0 2ur(o no1aleelfeiltfs2rr(monu4oleo o3iyt m2ul( p t) lermr ia1laD luesl()tetr(r3ny1oleemnes tf Durur oo4altnifciad a ua(ms;t)artnif3ootoptr u slt0 2xo(m iudam   ietlt) 2rmurp;t0oetnmiciatlmDuln s u) rtoxfciadoaDelues;( teumxr3iodol e neil(fsrraurpou4oltn ociasfaDumnvs (4 etrirctatfm  aivol(0trxmio iu1lme lfvt ()srtrxrp;o4aet mietaslsDem( pn()tetriocia1fmt an s ( teum(rpoydlpeemnetlsfsDumx p;o4oeen iciadlmDulnvp t4arxnmr3ta1fa ranei;t0t2urir3io1aptn ncias  rtrxmoot1teeo iciyt a2rl( pnu)arerif3iadomteaieo;(  ruo(m3oy4op e ivil()sDum(ronu1oeenmiciytls2uluvonu0areoif3ia1oa ranvsl()seum(m3ou4om emfctasfsDraxro;u0alxniiciatlm ean snu) rtrmrcto1oa ean olt trtm(opnu4lpt  netl() 2um(rpoo0altn iciyt aDua(vp;u0aetrmr3ta1lmt auvi;t0trto(m3iydalee ncsl()aDtmxmont0apt if3tas m2ra(vo u)arxnxr3oatlatran s t srxm(m iu4amtn ictls)sDrm(ronu4aet io3iyd a rmu pnt0aetnmfcoatlpte u i ( trtm(rpoo1op  lict tfsDtr( o;o0aee ifetyt sDemu s;(0 reomr iydopDrlnvo;s trxo(opno4llte fcilt aDuaxronu0olen f3iydlm uanvp;t0tlxrir3oytop  auvs s)s2tmxrpoy1lpee fvt ( aDum(r ;u0tpeo oetltlaDem(msnu4arerxocoydlm  anvo t  rto(rpnu1ol nlncs sf 2tm(  ot1tleoiictyt m emnmp;() rermo tadlpD ai sl()tetmxrpoodaptelies s  Dtau o;u1aex mfeiadfsDrlnvs;t0arxniociodla eaieo s)sruo(r iu1amt mietlt)s2rm(rpno4tptnii3iyd mDea(ms;(4treoif3iy1lpt livolt0trtm(r ou1apt mfct (f 2ururo;t0apx iiciysfsDum(mo;u4 lxrxrcoy1fp r nvils)t2um(rpiy1ape  icsl(  rrmur ;t1oetniietys aDea(mp;u) ltrif3oydlmtr nvilt s2to(m3iu1lmtnmfcia() rraurpno1tpeoiiciaslsDrmuvs;t) rerirctodlatrlu ol()sexm(opoo4optn icsatf Drmx poo0tptnmo3iasla2uauvo u)areomf3tydla  lieolt0 eur(o3oudal emnes s) 2ur(mp;u1tpe mo3iyslmDeaums t) eeriocoodlaDeluei (  rtr(r3iu4openmnesa(  rtr( ont0tlt iocildls el( p;() rxnmr todfptr iei t)t2toio no1ale mics t)arrmurpnt0ale mocilsla umn o;(0teeomr3ty1fptraivslt0teur(m3ou4ll  lnvtat)sDururo;t0alx ioetysla2umn pn(0trermoctotopDelivi ()s2xmiopiodlp emnvtls arum(r ;o1oeen fetldfaDum( p t4artomo oa1opD  uvo t sexoimpio4ap nlfes s)aDrm( ooo0alxn f3tat mDea( onu0trxoxfcootomt ln o ()teumxo3oo1lle  fetas  rtrxm ot1ope ii3iytfa rmu s u)trenif3oodomD auvols truoiopiy1lptnmfctl(farurxroot4ale moeild m2el(mpnt0texnmf3io1om r i s;(0 eurir oy1alt lfvs ( sruau ono4altoiietad a2ran o u4tltnmociytlmt  ues;() etoim3iodole  fesasfsDumxr ot0tpt io3iydlm2em( s;t)tltrif ty1lpDeau ols0 2xmir iy1ol   fcsltf 2ua(m no0apx ifetydls2rm( p;t0aexrmr iatfaDr uvsl() 2trio oo4op   iei t) 2rmxm ;u1tlxoii3iysfs2ra(mp;(4 rtomo3oo1laDelies;s trxrio3oudomeemfvsa(farraum oo1opto fcias mDrlnvonu)tlxrxr totfm eluvs;() etoxrpio1alt  iviat a2rrxroou1oexnifcildls2ulumo;(0 rermo3iadfm raivs t0texmxmpoudlpe  feia() 2trxr no4altoii3ilt s2rlnmpnt4trxrmf3io1omteau s ( trxmxo3iy1op  lfvilsfsrum(  ;t1openii3iysfa ra(mo;u)tlxoio3iy1fmtelivo t trur(rpnydam elfetas) 2um(ronu4teto f3iyd sDumnmo;t0 rxnio3iytfp eai ils)s2xmim3ou4lle mfetat a2rm(m ;u1tptoifeiysfmDumump (4 ltnio iytoateanvi;()trumio3oy1llte fcslsfarumuro;o1tet mf3iyt a el(mo t0 etoircia1fp elueo s)tetmxr3ny1ame micsa(f 2tr(rpnt0tpt mieiysfs2rauvp;u)trxnxfciodla  lieol()tetr(m ou1lltnmieslt)sDururpno1aex  ietltfa ulnms;u0alxnifctydlpDrli o;t0s2to(mpiu4apt lneta() 2tmumpnu1oexnioeild a2rauvs;u0trerir3iadlm eai ils  rtm(r3iydamt  ncsls)srtm(m ot4olx moeiasfs2emnvpnu4arxrirctotlp ean o;s truoxm3oudomte neiat sDtr(mo;u4alxo i3ildlmDumn s t) rtomo3ia1latr uvo (0 etr(opio4ll elncia(f Dtmuront0opxo i3tadlaDuanmp t4alerxr oatfm r u o t s2xrim oodlptnlictltfs2rmum ou0tetomfetatfa raumpn(0 rxomrctodfa e uvo;()s2xoimpiydlleelivsas  rra(r ;t1alt mo3tasfs2elumsnt0 exrxf oodfaD aueils0sexmio3oudlm e ivias)sruaxrpot0aeeoio3iatlsDrluvo;(4 eerio ta1fmDelnvsls)teurxmpoo1lmee ncsa()aDtm( o;t0opeoii3iadfs rau s (4 etrmf3tytlmD liei;t trxrir3oy1altn ietat  rururooo4aeeomi3tyt a el(mp;()trxrmrctytoa raiei;t0t2xrxrpio4ole  nvt t)a2tmxmo;o1texn fcils aDemn p t4 exrif3ia1lpDr ues s0s2toxm iu1ol nmncta( a2rmx poo1opeo oetyd a rlnmpn() eerif iodomDr i slt0trtmxr3no1ll emnes ( aDrmxm nu1tpx mociadla2um( o;u4 rxrif oy1faD au i t)t2uo(o iudapeemnctlt) 2rmumpno1olxnioctadfa2ranmp;(4areoif oytlp  aivs;s seumio oo4omeelfcilt sDta(mont1oexo f3iatlsDrlu p;u4 eenxfcoadfmt ai o t t2xriopiu1opt mfesltf Duaumpnu1olen iciatfmDelu ont4tlxomocta1fp  au s;() exo(rpiy1optelfcil(  2ta(mp;o4aeeoifeiat mDem(mp;t)texniociy1omtr uvs t)teur(rpiy4omeemnvs sfsruaurp;u0aee  f3tls m umnmp;t0teermo oa1latrauvil(  rxr(opiy1aptelieiatf 2tr( o;u0oeen feiyt s ea(msnt0 exoxo3ootla   nei;( trxoiopno1optnmfctasf 2trx  nu4aetn i3tytlm uauvo t4aeenmf3iotfatr uvi;t)trtr(rpoy1lptnmici t)s2ta( p;t0opx mf3ilsfa ul(mo;(4 ltrmo3iy1fpteaies s0seumir3no4apeelnetas) Dtrxmo;u1teto feildfm2eanmsn(4 rtnmf3ta1lmDe nvi;(0texrxr nu4om  lfetls) Duaumpou0apxnioctltfa ra(vo;(4aetriociydomD an s s)srxrim ou1llte icsltfs2rauro;u1oexomieiysfaDuau on(0 exnmo3iytfa e uvs t) 2xoimpoo1omt  ivsatfsDuax oou1tpxo o3tysla2rl(mo;t0tetrmf3tadopt aies;()srtoir oy1om  mfesl()sDua(mo;u4aexnii3iat a2uauvonu0 lxrxf io1fmDe u o;( teumim3iy4lpeeliesasfaDumx pnu1olxniiciys a rl( on(4tlxniociydom  livo s)trtrxm3nydap nlfcsas) rta(mo;o0tpxn o3tltlm2emnvp;t) lxnmoctotlaD  ues s0 2tmim oodameelfvtlsfarua(m ;u1tetn fctldfa eln onu0 rtomoctytlmt ln s s  rxoxr io1lmenmivs (fa2rrxro;u1tpxomf3tyslmDeanmp ()tetnmf ia1fp r uvsls0s2xm(o ny1al emiet ( a2ta( pou0teenmo3iyt mDelnmont4texoxr3totom elnes;(0tetoxo3nu4lptnlivi t  Duaxmo;t0olenmoctadls em( o;(4alxrio3oadlm eanvs;(0 etmir nudap e fvias)srur(m ;o0tet  o3ildls elnvpnu4artomf oa1fp  ln o;s0 rto(r ou4omt  fvsls  Dtrx  ;u0oeeomieiytfs ea( p;()aexrmfcoydfm  lneolt  2tmir3nudlmtnlnvs tfs2umxm oo4aptoifetatfa2rmn p u0 etnmocta1faDran ilt0s2toiopiy1aptnliet (  rrr(mont1olx io3tlsfa2emu o t)aexnxf tytom  liei;t  rtm(o nu1ll nmivtat a2um(mp;u1alt mf3ild a2emu o (4altomr todoa e ueil( seurim3iy1lmeemnct s a2rau pou1tlxo feiltlm2ulnmp;t)artoif iydoaD li s;(0teur(m3iu1lm  lfcia() Dtmxrpot4apxoio3ils s rluvs;t4alxoxo3ootlmD  ies;() exr(rpoy4omt  ncsl(  Durumpnu4apxniiciasfaDumnmsn()trxnircty1la r nvo t)t2um(mpny1al   fct s arta(r nu0olx  f3tad s2emumsnu4aeerif ia1omteli s;(0srtrir ny1ole  fci t a2ur(moou4oee ifeiyt sDrauvsn(4texrxf io1fmt  nvs;s0trtoir nu4ole  ici s  2rm(m ou4oltnmfeias aDeau p u4teermo3iy1oaDe n i ()sruoir3oy4omt mneil() Dtmum no0tpe  i3iysfa rlnvpnt4 ltoirctadfm  lueils)s2um(m nudaptnlfcsl() 2rr(moot1aexoifciadfa2uau ont)aexrif3iy1lmDe n o s0 ruoimpou1ame  iet ()a2tr( p;u4ope if3tldfsDem(mp (0aexrmfcio1opteai i s0srtrxrpiy4amenlnvia()s2rru onu1teeniociadls2rm(mpnt)artoio oytfa   u o t trtmxr3no1lmenmfeia(  Duru pnu1oexniietatfsDemumpnu)trxrmrcoadfa eln o;t srtrxm3iu1lmtnlfvils) rurum oo0opxn fcils a2rluvp;()trerircoatfaDr ivols t2umim3io1al n fctls artmxront0oee ioeiydls2rmnvo t4tleoir tytom  li s;t)srumir3io4al nlfet tfsrtrx pou4aet iocildls2rmnvp;(4aetoiociodla   nvi;s t2trio3iu4aptelfcs t  2um(roou1aeenmieiyd mDeluvs (0 lxnif oodfa  aivo (0trumxm3iydaptnmnei t) 2ua( onu0tlen ieildlm2ra(vp u0tlxnxr3oadlm   ieo;t0texrir3iodolt mnvsat  ruaxmono4alxnmieilt s rln ont0alxrifctodopD lnes ()s2toir3nydal e fvs (fsruaxr oo0aetnmfeiydlaDrmnmpn()arxoirciydfmt auesl( teuoio3nudomte ietat  rua(  oo1ole mfctldls ea( s (0tltrmo io1faD aies;t0 rxmxr oo4lltemfci sfaDtmur ;o1apeoio3tytla2ua( s;u)aetrxfcto1lateaieil(0 exr(mpny4aleemnvi tfarrm( pnu0alx mf3tyslm2rm( o u4tleoxfcto1latrauei ( s2tr(o3ou1lm emfvs (  2tru pnt0tlxnifetytlsDeauvs u0aeeoif3tatfp ran i t0 etm(o ou4lle lfvtls)srumxmo;u1tpxo oeiydlmDem(mo;t) ltrxf oydoa e nvol()trxoxmpiodom e nesl()aDumxr ot1oet  o3tas mDumuvs (4aleoiocoo1lptraivo s  rur(o iy1am  liei () rumxr ;o0tle ifeilsfa2ea(mp;u0altnircoydoa r ueo () rum(mpoodameemfvt t a2trxm nt1aptomfciadlm2rmuvs t)aeeoxf iotlmt an o t0texoio oudal nlfvi s) 2rmxrpnt1teen oeiyd mDelumpn(0aeerxr3to1fm r i ilt sruoxopoy1lmtelfeilt arrrumpnu1tlxn ieiltls2ea(vp (0 etnmfcoytfpD  ivo;s)t2umxo iydop   ivilt) Dum( onu0tltnifciydla2ean ont4teeoxf3iotop ranvi s srurio3nu1optemiesatf rtaxmoou4apeo fctltlaDem(mp;t0arxrxo oodoaDraivs;s)s2uo(m3iy4lp   ies s  2rau  ou1tlenioctysfm2uanvs (0 ltnmrcootlatr nes;(0sruoxmpnudaltelnviltfa2tr(rono1tlen octasfs rmn o u0aeenmo ta1omD lnvi;( s2uo(o no4am n ictlt)aruaum ;u0tlx  iciasfa2eau o t4 etomfcoydopt aivs s0 2uoxo3iy1omenmfes sfsDurxr ;t0opxnmf3iydfa2em( on(4 lerxo3tydoat an ol()s2xriopiydlpeelfcsl() rtmu  nt0apeoifeiyd s raums t4areoir iodlmD anvi t trtmxmpoydap   neslt  Drmum ;t1tltn fetld mDrmnmp;t0 rxomf3iadlmteaneo (  rtr(r3nodape  fvia( aDtrurp;t4oexomfciasls2ul( o u)texoxo3oodlptraivslt0s2trxr nodome licsltfa2trx pnt4olen ietadfs2ea( o ()aexrmf iydfaD  uvi s)t2xm(o3ou1op elfcsa(faDraxro;o4alenifctyslm2umn s t4artoif3todop ranvsl( sruo(r iu1llt licsa(fsDtrurpou4teto f3tatls emuvp;t4 lxrifcoy1la ranvs;( t2xrim no1apeeliesltf 2rm( pnu1olt moctadfm2ran p t4 rxoxo3oadfatelnesls) euo(rpny1olt lici () 2tau  ot0olenioeiadlsDelnvo;t4 eeoxf todlp   ieo (0srxo(m3iu4om  livsltfs2uru pou0opxomieils a2rmumo;u4 lenmo oy1opDelnvi t0t2tmirpiy1ll nlnvsls)s2uru oot4teto f3tatfmDumnvo () eeomf ia1lmD  i s s  rtmir3nydlle mieiat aDtrur ou1oexniiciydlm umn p u0arxnxf to1lm   i o;t  eumio oy1alt  nvt ()aruaxrp;t1apxnif3iaslm2rlnmo;(0aeenmo ty1lpt li i;( setr(m3oy4altn fvs sfarum(m ;u0tltn i3ils aDelu s t)teeoio oa1lptelueolt0s2tmxm3no1ameemietat srra(r nt1oet iictad m eanvpn(4aeenmr oodfm r n i;t0trxoiopoudlme  feia(faDtrxmpou0tee mi3tydlaDrau p t) renmo3io1fmtran ils) ruoxr3ny4ale mnvt ()a2tmx  ot0texo i3tasla rmu s;t0trxrxf3ia1lpD  nes;( trxoim ou4ale licia()s2tax onu0olen o3iat m2uaumonu4 eenmociadlat lues;s)s2tm(r ny1amt  fes (fa2rmurpno0apxomf3ildfs rmnvs u4 exrxocoo1lat  nei;t sexmxo ou4al e nci t  2umu pot0alenmfciaslm uanms;u4 exnirciy1op  anvs;()teum(r3oudop   nvtlt)srrm(rp;t4texniieiys a ea(mo;(4 lxnxr3tadfp ean o;s t2uo(r io4llte ieslt sDtrxmpot4aee if3ilslm2rln on()tlxomfctodlptr uvi s t2toxm oodomtnmivsa( a2raum ;u4teeoif3ildfm2ea(msn() etoif oadlm eauvolt sruo(mpoy4aptn fcsas)sDumx  no0aex  feils s uaumo t4aetrxo3to1oa ranes (0teuo(opoo1lmtnmneta(f 2uaum ;o0tlt moeiasls emumo t4trenifcoytopDelnesl()trxrxm3iu4lmenmnvia()srtaumo;u1opx io3tydfs uan o;u4alenmociytlmD  ivs s s2xr(o3oo4ll  mfeia(fa2ur(  oo0oleomoetadls rluvon()aetrmf tydopDeaivo t0seumxo iy1lptnmncil( a2umu  ;t0tpeomocild s2ean on(4 rerio3ia1fp elueols  2umxm ou4apeelnvt tfaDrax pno0tpxniiciydlm2em( pn()altoxocootfp   i s t0texoimpiu1olen ivslsfaDra(  ot1apto ieiadfsDrm( o;t4 ltrifcoadoa   ivols s2to(o3iodol n nci t s2um( pnu0tpt  ieiadfaDum(mon()aexoif iotla eaivs s s2urim iy1amte ieias sDrru  ;u0teeomf3tas aDrlnmsnt0aetomo ta1oatean o t t2xrir3io4ll e fvsl()srtaxrpnu4altn f3tldfa uan p;t0 lxoio oy1lmDrlnes ( s2ur(rpnu1ome  fvt t)aDuaxmpnt1opeomociadlmDrl(mp;t0tetomr iatlp elues;s)setmirpiu1lp  mivils)artru pnt1olxnmfeias aDuanvs u4artoif3ta1faDr ivs ( t2tm(mpny4ap e nvslsfsDtr(mp;o4alto i3tyd m2eln s t0arerxf3iy1lmDeanes;t s2xoxmpiu4omtn fvtat)srrmu  ou4tex mf3tytla2ua( ont4 renif totlm eau o;s setrxopoudlp emivtl()a2raxmpot4apenifeiltls umums u)artnxf3todopteluvi t0 exoim oydopt lics tfaDur(root4tpeomoetltfa2emn pnu)arxrir totlmD lnvi;(0 euo(mpoodale  icsltf rum(mono0tet  i3ias m em(mon(0texnxr3ia1omD lnei t)s2tmxrpiodoltnlfeils s2tr(m oo0olxoii3iadls2umnmsnu4 rxomo3ia1lmDe i i;() 2umxo3iydllenmnviatfs2raxm ou1oet ifetad sDrauvs;u4aexrmo iydlmD auvo;t setr(opnu4llt lfeiat)sDraxmpnu1oetn fciydls rauvp (4 rxrir3tydlpDrauvsls0setr(m ou1ap n nesat) Dumxr ;t0ope ii3iyslsDem(vp t4teenxf3totoa   n o;s0t2tmxo3iy4ll e fei t  Dtrxr nt0aexoiietlt m ea(mp ()tlxnio iatfpD aues;t s2xoio iodalte fctl(fa2tmx pot4teeo fciysfa2ul(vp;(4aexrir3oa1fpDe nes ( truoxm3oy1omtemfeia(f rraxmp;u1apxnii3ias s2ul(vsn()areomf iydfmt lnvs t)seumxmpiu1lptemfes t) rra( p;o4tetnif3tytlaDelu o t0tetnircto1lpt li i t)srur(mpiydop e iei tfs2tm(  ;t0apenif3iad m2umu pnt0alxnxo oo1fpDeluvo;(0srurim iu1aptnmivtas  2rm(m ot0tpeomoetydfa ua(vsnu0trenxrcoo1lm rlnei () 2to(r3iy4alee fes t)s2uaur nt0oeeomo3iadlmDuan on()texrxf3oytom   nvolt srxoiopio4omtelnes sf Dtmxronu1tpeomf3tas m2ran s;u) etnxo iadom elnvs;t0srtm(mpiudal nmietltf rrrur ot0tlxo i3tltfsDem( o;t4 rtnif3iadomte nes;t0 etmim3nydamenmnes ()srtm(m nu0alt ioeiytfs2ua( o;u) rtrir oa1fpD an o;(0 2uo(o nydomenlivsat)aDtm(mp;t4oetoif3tytla elu s u0trtoio3todfptr nvsls) 2xmxo3ny4ale mfctl()srumurp;o4texomictadlaDel(mpnt0teeomf io1lmDran o;s0trxoimpoodoltelnesas s2ra(mono1aptoif3ildls2um(ms;(0 rtnmrctodom   uvo s srxrimpnu4aptemnetls  Drm(m ou0tlxoiietadls2rm(msnu0tltomo io1oaD  ivi t)trxmxr3ny1lme mict s)a2ra(  ;o4texomfeiasls2uan o;(0aexrir3to1fatraivs t) 2trxo oy4ll  lfct ( aDua(rpoo1oetn oeiad a2emu pnt) exoif3tadfpDrauvi s0t2xrir nu1lp elncil()srumum nt0alt  ietatls um(vo;t0aeermfciatfm eauvils seuoxopiu1olt lfcilt) Dtrxr ot1optn oeias a eln p u4tlxoxfcto1lp   ivs s0t2trxr3oudlm  lfct tfaDrmx p;t4aeeo f3iatfmDuln s t4 exoir oy1lp e uei ( t2tmimpoudapee nvtasfs2ua(r ;u4oexnmiciytfaDrl(mpnt4trenxf iodoaDelu i t0t2tmio3iudaptnmfvsl(f 2rmx  ;u4tpxnif3tad sDul( o;t4aexoio3oa1lateln o;t)sexrxmpnydalen ietl(  rrr( ooo4tee  ietadla2umnmpn(0 exoif3ta1opteau o;s srurio3iu1omen icia()s2umu o;u0olxomfciyd aDuanmo u) rtoif3todfat  u olt)texmim io1lm nmnetat)s2rr(m ;o4ole io3tat s uau sn(4 lermf3ia1lpDraueils0 rumim3iy1apen fcta(f 2tmu p;u1olto oetysla2um(vp;u4tltnxr tytop e u o;s srxoxr iy1openlfes (faDtaur oo1apx  i3iysfsDrlumsn()tlerxocoy1op rlivil()trtrio nu1olte fetl()aDrr( onu1tlxoio3iaslaDulnvsnt0arxnio ia1oa  lnei;( srumimpoudom   ict s aDrru  ot0altomietydfa ul(vs t) ltnxo oo1fp e i s;() 2urxopiudam elfcs s) Dumu p;t4oetomieilt m ranvp;(4trtoirctydlp rau i;(0srurio3nudal  mnes t) 2uax o;u0olto fciasla2umnmp;(0altrxo tytfptrln o t0 2uo(o iy1apenlivt s)artmxmont0aleo f3tysfmDulnmo;u4tlxnxf iodfat  u s ()setrxo oo4lpee nctlt  ruaur no4apen octytlsDuluvs t)artnir3to1fpDeli s;( t2tm(o3io1ale lfciat)artaum ;u1ope  oeild mDel( onu0aeenircoadopDelivo t0truriopio1omtnlfvi ()s2rrx onu0ale ioeilt a2em(mpn(0aeeomo oa1faDean s s setoimpno4op   fvta( artrx  nu4tpe  oeiatfa emu s t4 lxnmo iytomtrlies ( s2xr(o3iydom e fctl(f rrmumo;t0tltoio3iyt m ulu o;t4aexnirciotomDrlueol(  rtmxrpoydlp elncs t  rtmxrpnu0tetomf3ilslm2ulnmp u0alenir3tytlp rau o;t0s2xm(mpio1lp   iei tfsDtr(m oo4aeeomieilt mDelu sn(4texoxfciydfptean i;t) 2umxm3iodll nmfes tfs2uax pot1tptnmo3iadlsDrlnmo (4 reoircoodom  an o t0 rtm(r nodomt mnei sfsDrrxmo;o0oeeomoetaslm2rauvs;(0 rerxocoydfptrlnes;( s2xmir3iy1lp nmfvs tf 2ta(rp;u0tetnifeiadfs2eanvp () exoifcta1lmD lu o t)t2xr(m nydlm e fct tfsruru pou4altomoctatla2rlnvo;(4tetomocta1fpD  ies;t)t2xmim iodole mivia( aDum(r ou4tptnioeiaslm elnmpnu)tetnxf oy1optr neo;s0t2xoxopiu4lmtelici s sDua( o;o1aex mfeiadfs uauvont4artoio3ootlaDeln i t0sexm(o iu4llenlfcilsf Duax pnt1aleomfeiysfa2umumpnu)aexoxfcoytlaD aivi t)s2toxm nu1ap elicils  Draxr no4oltn i3ilslsDra( s;u4 lxomociy1fp  lies ( sexmiopiu4op  mfeil()srtrxro;o0aeeo o3ildlmDel(vo u0 leoxo iydlptrli ol() euo(r oy1omee ictlsf rur(  oo1apxnmf3iydfa2elnvs;()alxrmfcta1fa   ivols0 eto(rpiy1lptnmfctl(fa2trxro;o4tpxn o3iad a eaump;() lerxf3oy1fatrli s s teuoiopiy4omen ivi tf 2rax onu4alx  fetldlmDeln s;(0teermr3iatomtraivs;()tetoio ou4lle mnet s srrrx  nu0aee  octydls ea(mo;t)aeerxf oa1omt auvo;t texoim3ny4lm  lneias s2rau pno4optomf3tatfmDelnvs u4 lerir tatlm rluvi;(0 rumim oodolenmfeias sruax pot0aexnmoctld sDumu p (0 exnir tytfatraieils  etr(r oodapeelfes (f rrru o;t0oee mo3tysla umnmo t0trtrmo io1fp eluvi;t0texrxm3no1llt mfviat  2taxmont0apeo ictyt a ea(vp t)artnio oadomDe ues;(0t2xoxo3iodaptnlfctlt  Dtru  oo4alt  ocild m2eaump t0 renmr3iy1fp  anei ( tetmiopno4lme mfeiat)srumumo;t1opxn f3tytlsDrauvp u4alerxrcoytopDeaues;s)srurio ou1al  lncia()sDtmx o;t4tlen ietltla um( p t0teeomr3oy1fmD anes ()teuo(m3io1olte ncsa( sDtax o;o1apxomf3ias s2ulumo (0tetrifctadfa rluvo;s0tetriopiy4ol  mfcilt) Draur oo4alxn i3tytfs rmump;()alenxr oo1omDeaueo;s0s2tmxo nu4op   ietat srumxm nt1tltoiociad sDumu ont0 etnifctotfaD  u ols) rtoiopoodam emicslsfarrm(  ot0ale iictaslm2rlumonu) rtoio3ootlpD luvils)t2uo(m3oy4oleelncs t)s2tru ont4alx  o3ild mDemnms u)tltnmrciydfmDeai ils)trxmxr iy4op nmicsa() rua(mo;o0aexomictlt a um(vpnt)aleoio3iotlaDelnes;(0trxmir nudaleemnet s sDta(r nt0oleomoetlt m2um(vo;t0tleoif ootfp   uvo ()teuoir3ou4amtemfvsa(fs2tax  no0opxn ocilt m uluvo;u4tetrircoodlatr nei s0 2ur(rpiydll n fcil()arur(r nt0ape mociltlm2rlumo;t4trtrxr oydfateanvs;() 2urir nu1llee netasf 2uau  no0optn ictas m ea(vs;u)treomf oatfaD  u ils0 etm(o no1olt lnct () ruaxr ;t0tlxnmf3tlsfs rm(vo;t0trenxociytfm  livi;t0trtmirpnydlleelneia() 2urum ;t1aexnifetlt m um(msnt0arerif ta1lp elu s () euoirpoo1lp nmfciat)aDrax pnu4olxo fciad m2emn onu4tlxnxr3oy1fmD lu i s) ruo(o3oudal emfctas  ruaumpnt4olx mfetatfaDelu sn(0alxrio oodopt li ols  rtm(mpnudlltnmfvsas srtmxrooo4ale  fetatlaDuan s t0trermfcoydfa rau o ()teurim3iodop n nctat) Drm( ooo4opeoif3iydls ulnvsnu0tltoif oydoa raieo s  rtrxrpiu4apte fci ( sDrm(rpnt0aeeniocildla rmn s;(0tlenxo iodlp  auei;( trumxo no4ll eliet s)sDrrx oot0tet mieiytfm ua(mp;u4tlxoxo totomDelnvs t0s2uo(m nudap emneiltf rtrum nu1oltoiiciysls2rln p u0treoxocty1laDelies s)srumxo nu4am nlnvtas arta( o;o0alx ifeias m2umn p u0trtomo totomD au o t)teurxrpoodapen nvta()a2urxmonu4oeenmfeiat sDrlump u)alxrmf3ty1fmtr iesls0srxoimpoo1opte icsltf rrm(mo;t4oet mfciys s2ul(vp () lenmo3iodlpDe n s;t  2urxo nu1aptnlnvtatfs2rr(monu1tee iictltfsDumuvsn(4alxnmo iadlm eanvs ( t2ur(m3oodapeemics tfs2tr(  nt0tlxn iciatls2rl(ms t4 rtrio3totlatelieilt srtrxm3oy4al elivias  2ua(mpno4apt iociat sDelnmp u)altrio oydoat  nvi (0seto(o3ny1omtn nvsat)a2ua(  oo4tetoiieiydfs umnvsnu4tlerxrcto1la  aivs;t srtrirpoy4op nlnvt ( arrmxmooo4opeoiietld s2rm( s;t0 renmoctadopDe uvs;(0t2xmxr3nodaltelfctl( s2urx ont4tltn ietatlaDul(vs;t0 rxnxr3iydopte nes;() euo(o ny1opeemivils s2ururono1opeo ieildlsDrmu s (0 rxnmr oytlm eluei;t)seum(m no4ope mfvt s  2tmxr ;u4altoiociyd mDelnmo;t) ltnif tatfateaues t s2to(rpoo1omtemncsls)arta(r ;o4texnioctatfmDulnvs (0tlenmo3tatomteluvi;s0 rtoir ou4am elnet t aDtrum no0olt mociasls2emn snu0trerio3iatopt  ivi (  ruoio3iu4am   ncsasfsDtm(roou1aex ifctls sDea( pn(4 lenmf3ty1oaD au s t0s2xmxo3no1olt  fvtasf Dtrxm oo1optn oetyd s2el(vo;(0 rxoxfciydlpt livo;t0 eur(rpiudlltn ietls s2tmxm ou4tlenmi3tyt m2ul(mo u0 rtrmrcta1la raueo;t)sexmxr io4lle mnei ()aDurxrpou4oltn f3iat s em( s;t0trxnxf iatla r uvi;s srxmxopoo4am e fvi ()srum(moot4ale mi3iatlm2ra(vonu4 lerxf ta1fm rlivil(  2um(m3iodal emfesl()srumx oot1teeniietytfm uln s;(0altoif3ia1fpteaues ()teuoxrpno4lme mfvt tf rumu  oo1opxo i3iltfa2ua( pnt0aexoxf3iy1om e uei;s  2xmim3oy1lptnmnvi s)s2rax pot0oeeoiieiys s elnmsn(0 rtrifctadlmD  nvol()teumio no1llen nci ()srraur nt1opxo octysfa uanmo;t)aetrmo3tatop  lnvilt  2xoxo3iu1lmt  ncil() Drax  oo1aex  oeiydfs2umu s t4texrio oytlmt auvslt sruo(o ny1altnmivsl( s2um(mp;o0aeeo oeiys sDuan s;t0teeomr tatoatr u o ()s2xrirpou1llteliei ( srrmuronu1teto feiltfaDrl(msnt)aeenmocoodlpD lies t)texr(r ny1ap nlivsat) rtauro;t1aexn i3iydfm umu p;(4 eenxr tydfa   i ol( setmiopoudal  lfcilt sDrrx ont1aee mietyt s2ul(vsn(0aexnir iatfateaneils0sexm(rpiu4ap n netltfsrua(r no4tex mi3taslm2emnms;(4aexnxociytlmDr ivs;s0s2xrim3oydamte fctat) rrrxmo;o1ope if3ias m2rmn p;u0trxoxocoadlp   u i t0sexm(m ny4openmicsa()a2ur(  nu1oeeomfeiysfa rmnvp t0 exrxr3iydla e u i;t0srto(r iydlpt liei ( a2rrxm ou0tleoifeiytfs2rmnmp;t0aexnifcoo1lmtr u ol( seurxmpnodap emfeils)sDta(m ;t4apxn fctatfs ua(mo (0alxrmo3oatlm   ues s trxoir oo1lp nlnvs ( sDtm(m ;o1tlt  f3ilt m2ran s t4 lxrxo oy1oateln ol(0s2trir oudlpe lfvt sfartau pou1texomieiadfm rl( p;u4tlxnio3tydlaDe n o;s0srxmir iu4opee fes () 2rmumpoo0tpen f3iltfm eauvp (4 leoxocto1oa   nvsls)t2tm(o nu1lmtemnvilsfs2uaumoou4altnmo3tatfmDuln o;() rxnif tydfmtrluvs s)t2xr(m3oodoleemnvia()a2ta( o;o4tltnif3iasfmDemump;t0tlerio3totlm rli s s)sexoxrpiu4openmiesa(faDum(mpoo1aptoiieild m2elumo (0trxomf3iadomD aivo;s)truo(r iodaleemivias)srumxm ;u4oeenmi3iltls2eanmp;u)tlxnmociatoateaneol(0 2xmxr3io1lptnlics t artr(rpou4opt moetls s ul(vp;(4aetoiocoadopteau sls seum(mpoodomtnmnes sfs2umxro;u1optoiicils a2rln s;t0 eenxrcoadlmD lieol()s2xoxm io1lm elncsat sDta(mo;u0oeto ociydlaDrmu p u0trtnif3iodomD lies t0srumxr ou1apeemici (fsrurur no1tet ioeiytfsDea(vo;(4 exoxo to1lmDeanes t0tetoxo oy1op emneta( a2tr(rp;t1ole mieiytfmDumuvo ()trxnxr to1late ueols)trtoirpoo4opt lfesas) rrm(m nu4tpxoif3iydfa2umums (4tltrir iy1faDelues t)t2tr(r3ou1omtn fvias)aDrmx  ;u0aptomo3ildla2rluvsn(4tetrmo iatlptr nei s) 2uoxrpny4al e nvt t aDtrumo;u1alxomoetysfm2ea(mpnu)trtomf iatlptr ivs;s0s2umio io4olt lieiat srtmurono1oeeo ieiydfa rmn p (4trxrir iydfmt  iei;s0t2uoxm3nodllenlncia( srtrumpoo0opxoioctysfm2ulnmo u0arenir3totoptr nvs t0truo(m io1lltelies s  2trxr no0opx  fciyd aDemnvpnt0aexniociadfmt  i s;t0sexo(opoo1op nmfes t a2rmumpnu4aetomfetltlaDrluvon()trtoio totomD auvol( s2tr(m3oo1lp elfcsa( s2rax  oo1tlenmociadfaDranvpn(4tetrmfcio1oat  u o () etrxrpnudomtelnvsatf 2urx p;t0tle  iciydfa2rauvp;t0 eenxr3oa1omt  uvs t t2trxopou1ame livtltfsDtrxr ;o0apxomi3iasla2eaums (0trtomf iy1oaDe iei (  etm(m3oudlle  neilsfaDua(mpnt1tee ii3iydla2rm( p u) eeoif iydoaDe neilt0trtoxo3io4amtn ictls  Dtrxrp;u1tee  o3iltfs ul(ms t) eerir oo1lmDr u ils)tetoxr3iodale mivi sf Dua(mpou4ape iociyt s2ea(vpnu4altoxoctotoptelies;t srtmir iydap nlivi sfsDrr(mpou0tpxoiietld s rluvp () eeomrcoadla eliei;s)teto(mpiydlpt mfvi t)s2uaxrp;u0apxo i3ilsfm ulu s;t)alxomoctadlpt livi;t)srumxopno1apenmfvslt)artaum oo0oltn feiadla2umums;u4 reoif3oytlpDeaueilt)seuoxopny1omtemfet () rum(  ot0oetniociadlmDel(vo;t) exnif3tadlmDrauvi ( trtm(r oy4amtn fcslsfa2urump;o4alx iicild s eanmpnt) rxrmf3tydlmDrli o;t)seuoxr3no4ameelfvt ()a2rrum nu0aeenmoeildla elu o;t4tlxnxfcty1lm  auvi s)s2xoirpno4aleelivs (  Dua(monu0aexnif3ils sDumnmon() reoxf3iydlmt  ieolt0 exr(o3nydamt lfcil(f Durum ot1tex mfeias mDum(vp;t) renmrciotlmDe u olt0s2trirpou4oltelnvtat) 2uau p;u4alenif3tytfaDea(von(4 exoxrctotoa elivsls seuoxmpou1oltnlictls)aruax pno0olxomociat m2uanvp;u0aeerxrciydom   uvi t s2xmio3no4llte feslsfsDrrumo;u1tle mieilsfa rm( o;t0texnio iadla  lnvsls) 2xo(mpio1ll   nes ()arumxmpou0tltnmf3tld mDuauvs t)arxrir iodfptr n o;()t2xoio oodom nmietls  Duaxmpot4apeomfciydfmDua(mp;u0 rtnif3iydopDrlivi t0truoxr3oo1altn fvilt  rrmumo;o4opx mociadfm2eaums t4tlxnmf to1lm eau s;s teuoim3oo4omtnlieiasfs2rrxmo;t0aptn f3tltls2uaumsnt4trtnmociodlaD lieo t texoirpnu4lp  lfctls s2tax  ;o4tlenioctltlaDulnmp ()aetoxo3ta1fmtr uei;()trxmir nydlpeemnvt t) rtmxmp;u1olt iociaslm2uanmo t0 rtnifciytoptelnvs ()t2xr(m io4lltnmieil(fs2ua(m ot0tpxniictasfa2ea(ms t4tetoxo tydfpDrau s s0teumxr3iydapeelneilt)a2ur(mpou0tlt  i3ildfm elums;u0arxnxo3ootfa   ues;t) rtmxr3iodamenlncilsfaDraurpou0tlxnifeiys a2rl(msnt0 etrif3tydop  auvols0 rxoxr iydaptemfctl(  Drau o;u4oeenmi3iatfm ul(mp;(4texomo oydfmte n ols0teumio nu1lm elncilt  ruaxr nt0texn fctas s ra(mpnt)trxrmo3tydfpD auei;s)t2urir oo1aptnlivsa(fsruauront4oeen ociatfmDuau snu4artoxo3iatlp r u s () rtm(o3io4amtn fci s) rur(  ;t4texoio3iyslaDeau pnt0tlxnirciadfpDeaueils) eum(o iy4am   nvsls)sDtmu  no0aetniociadlm2uluvp t0aetoio iydfmDelnes ()s2uo(r io1openmivias)a2umurp;t4tlen feilslsDrmu s;()aeermf iytfpDr nvi;(  exrio ou1ap elivsat)s2truro;t1aexnmfetysfsDulnms;u)trxrio3iatoaDranvs;(  rtmxmpiodapte nvt (fa2ua(mooo1alt mieilslaDrln onu4tlxnioctotoaDr uvil(0t2xoxo3oydale  ieil(  2rauronu0apt mi3iysfs2rl(mp;() eeomo3oy1oaDelu il(  rxoir oy1lm   ivs t aDtr(r nu1aex mietytfmDeanvs;() eenxociadlm  an o t)sexo(m iy4om emnesas)s2truroot0oetomieild s eanvpn()aexnio3totfaDrluvols) rtm
\ No newline at end of file
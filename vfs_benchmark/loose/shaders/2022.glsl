@@ -0,0 +1 @@
+ues;t0seum(o3oy4lp nlfvsasf Dta( o;u0aeeomi3tytla elu o;(4teenio3tatlmDrluvi ()s2tmio io1am  mivt t  2rmurp;t1tle io3tlsls2uanmonu0altnmo3iadomtelnvsls  rtmxr3iu1al n nvtatfartaxrp;u1olen oetys m2eluvpn()tetnxfcoydlaD  neolt)sruoir iudamtnmics (f 2tmurpot1oee io3iatfmDumn o;u4 lenmr3oydlmtraues (0teuoim iydalt lfetlt artmx o;u4opxnifeiasfm eluvs;t)arerircia1latelnvs t0srxmxo3nodol elfvs t  Duru o;o0tex ifctys mDrluvon(0alenxocoo1fp   nei ( trtmim iydll   fesl(  2urumoou0ole mietadlm2ranmonu4altnxo3tytlpte ivol( trxmxo3iudol elnctat)aruru o;o4apx  f3iltfaDul(msn(4teeomf3iodopte i o t  etriopoudape  fetlsfsDrm( o;o1tlx  ieilsls2uanms;(0alxrif3oydfptrau i t  euoxo iu4ap n fet ()aDtauronu1aex mocias a ra( s (0tlxrio oo1lpDraivols) exrxrpnudoltemfcsa(f rtau pnu1open f3iltla2rm( ont0artnir oy1fm elnei s0 rtr(m oo1lp emfvtls)sruau  ;t4aptoifeiytfa rl(ms ()tetrir3oy1lmDeaneo;t)s2uoxm oo1omt livilt arrau  ;o4tltnioctytfmDrmuvonu)tltnmf tatfmt  u i;(0s2trxrpiydoptemneil()artrx  nu0olx io3iadfs2eau pnu)arenmfctotfaDrai i t0texrir iy1olteliesatfsDtmum ou4tleo ictatlm uanvs t4trxrxf3iy1fptrauvslt)sexoimpoudaptemivsltf Draum ;o1ope mi3tlt a elnvp t)aeeoifctadfptranvsl( s2umxm3ny4lmt liviatfsrrmx o;o1opx  ociatfaDrmnmsn()arxoif3oy1fa eauvslt0t2xoxr3no4alee ivtlt)a2tau o;t4tlx mf3tlt sDemnvpnu0 ltrir oydfatrlu i (0srtmir oo1am  mfct ()s2ra( o;o0alenifeiltlsDulnvs (0aetnxfcoodop  aneslt) euo(m3iydom elieils sDtmu  nt1apenio3tydfaDemnvsnu)trxrir3oodopDe uesls)trxo(opno1al elieias s2uax o;o4tpxnifetltla2rau o;u4tlxrxrcio1fp  ln il()t2um(r3no1optemicsa(f Drru p;t1apt ifetasfmDranms;(0arerif iotlm r ivo;t0 rtoir ny1lleemnesa(  Drmum oo1oeenmo3tadfaDemumo;(0artnmfctatfm   ieilt setmxr3ou4lm nlfcs s) rtaump;u4aee  octyt mDrln snu)teeoxoctotlpD li i;t) 2xmxm3io1ame  ics s  Dumu o;u1apxniietadfaDel(mo;t)trenio3to1fp e uvo;t0seur(o3oy1lmeelfes tfsruaxmpnu1oeeo fetat s2rlums;u4trenir3tytfm elu o (  exmxmpoo4lptn ivi ( arrr( pou4olt mictydfa um(vo (0areoxf3iytlat  ies;( srtm(o3nydopeemnci sfarrru ont4texnmociydfaDemn p t)tlermo3tytfpDeau i (0srum(r no1oleemneils)aDraxrp;u1texn i3iaslm2um( snu0aexnmo tadoptrlues;() 2trio iy4ap elfcs t s2trx oot0oeeoioeiydfsDua(mo u)trxomo iatfa ean s;()trxo(m3nodlp n fcslsfa2urxmont0tlxomieildlsDrm(vpnt0altoxf tytlm raieo;()srxrxm iy1om nlnciltfa2umx p;u1oetnmfctatlmDra(mon(4 ltomfctytlpteaieols)seuoxr nydaltn ieia()aruaur ot4tle ifciysla eanmo;(4trtnmoctotfpD an s;s0t2toirpnodom nlfctas  Dum(moou0aptnmo3iasfsDranmo u4tlenxf totfp eaieolt) 2uoxopiodoltnmfviatfaDur(mpno0tle  oeilslaDemnvp;t4 eeoxociytoaD anvols0sruoir iydap nlfvtlt) Dtmu  ;u0tptnifciys sDemu s t4 ltnxrcoatla eau s;s0s2xoio no1om  mfcilt)aruax pou0olt io3iatfa eln pnu4tlenmo3oytfm raneo (0t2xmxm3nudlp  micsa(fsDum(r oo0aetomoctas s2ran o;(0artoifcoy1fa eliesl( trur(m3ny4amt mfcsl()aDtrxmp;t0oet  feiytlm2ea( s;u4 eeoir3tytfa rauvo;t s2to(opnydoptnmfcsat) Dua(monu0altn i3ild aDrlu pnt0alxoxoctydfmDrai o t) 2urxm iu4ap nmici ()arurumpnt0tex  iciydfaDumnvo;u4texrif3ta1lpt livsls trtmxmpoydol   icta()s2trxmpou4aeenmoetadls rlnms;(0 exoif tadoa  ln ilt srtrxr ny1lpt livs ()srta(rpnu1olx io3ilsfa umnmsnt)trtnxo iatoatr neo;s) 2xrio3ny1olenlieias  Duaxr ;t0tpxo iciytfm ua(vp;()arxnir3iodfaDeaueol( seumim oo1oltn neiatf Dtmur ;o4tlxnmfeils mDrl(msnu0altnxo3oytlateauesls srur(rpiy1apt lncias a2umx p;u0olenioetatls2raums;u4 lxnio tydfpDrlu i s)sexm(opiu1lle mivias s2rax p;t1tet mocils s uluvpn(4 rxrif ia1laD  ueols0texmxopno4alt lfei s) rtax  oo1tltn oeildfm rln p t0aeerxrcty1fm   nvols  2uoio oydal nlnvil(f rurxr no4tpe  ieildlsDua(vo u)tltomr tydfpD  iei;t0t2toxopnodomt  ieiltfa2tr( ont1aeen oeiyt s um(mp;(0treomo tydomD auvi;()tetoio iu1lp   nvils)artaxmpno1oleo i3iatfm ea( s u4 lxoir iotfaD  nesls s2xm(m3ou4lle  ieil(fsDua(mp;u4oltomictat m2umu snu4 rxrircoy1laDr ueslt)t2urxr3oo4apt liesa( aDtmx pot0tpe mieiasfm2rl( p u0aleoiocoodlm eaues (0 2xoirpny4lp elieias)s2rrur no0tpe mfeiat s ean on(4 exnxo tydla raivslt  rtmxo oy1lpt lieilt)arrmx  ot0tpeniocilsfm2uaump;u0 rtrmfcio1late neo;s0 rumim ny1openlics ()s2tm(r oo4apeo fciat aDumuvs;u) rtomrctytopDraueilt0trxoio ou1am  mfvia(fsDtmu ooo1tpen feiyt sDuaumsnu4aetoir3iadoatrlu o;() exm(r3iy1altnlietat  Drrur ou0aleo o3tys a2rmums t0 leomoctodoaDeli s;s srxrir3oodlp n ncsa(farra(m ot4tpeniieildfsDemnvs;t4trtrxo3todom  lu o;s0trtmim ou4omenlfes sf Duru pot0alxn fciasfs2rlums;u0texoxo iydlmDrluvilt0setr(r3no4opeemieias srtmur ou4teenmfeiysfa2rm(msnt0altoxr3to1omt aues;t0texrxmpiy4ol   ivi s)srtrx ont1alen f3iltlaDrau snu0altoir3iy1oatr n s ()tetr(rpnu1optnlfet t arrru p;t4aetnifetatla2uan s;t0teermr3ootlaDelneol(  rto(rpny4ap emici ( srtm( poo4ope ifeiasfs2ua(vsnu) reoif3tadomD  ueil(0teur(o iy1omeemfeil()srtr(moot0aptoifeild m2rlnvs u)tetnmo totlmtr nvi;s seur(r oudol emicsa(  2um(m nt4opxn i3ildlsDumums;t)tetrxf3tydopD  uvils t2toiopnydom e nci sf 2rmump;o0apeoio3ilt sDeluvo;u0alxrmo3io1fa  lues s0 2xoiopny1omt liet (  rrax p;o4aetomo3iyt sDrlnvpn(0trtomr3ta1lpDelueils0srxoxm ny1op n fet t)sDumur nt1ope mfciltfm rlu pnt0artrifctytfmD lueilt0sexmxm3nudalen feslsfsrrmumo;o4optomieiysfa emnmont) exomrciadlpDrluvi;( t2toxopnu4apt mfctls)sDta(  oo0aexoiiciadls uluvo;(4arerxo3oodoa e ueo s0setr(mpny1oltn iesltfsrtmxmo;u1opt  f3tadlsDul(vsn(0trxrmf3ty1oat  uvilt srtrxmpiy4am e nci ()s2rr(mont1tlx io3ildfm rm(vp t)trxrio tadlp eli il( s2xr(o3iydam emnesatfaDtauroou4tlx  oeiltlsDrmuvonu) rtnxr3ta1fat lu o;( trxoirpno1lltemfvtls) 2rax poo0olx mi3tat a2ua(vo;(4tltomo ty1laDeln olt)s2uo(m3ou4ale miet t) 2taur ot0apxoifeiys m2uln pn(0areoxr ta1lpDrai i ( seto(mpiudaptn iet sfaDrmxmo;t4aeen o3tldla2ea( p t4aetoircoadoaD  nvo;s seum(opoydom nliei t)arua( o;u4tlx mf3iasfmDeaumsn(0trxrmf tytla r neolt  2ur(r iydop  mivsa(faDrmuro;t1tlx iociydlm2uluvp t4altrmr ta1fmDelnvi;t t2urimpio1openliciasf Dtmuroot1apxoif3tltlaDuau s (4tlxnxr ia1fptrluvi t0s2tmxopnu4lpe lnetlt) rrax  ;u4tpx mfetldfs eanvs ()alxnio3ta1fp rlnvsl()t2uoxr oydamt livt tfartruro;t0texnioeiatlsDrmuvp;u4teeoioctydfp  lu o t0trxr(r oydll   nvil( aDrau oou1altomi3tyslm2rl(vpnu4aleomociadlpDelnes;s)texrir3ny1alt  nvslt)sDtmuro;o4apt  iciytfa rau p;u)arermf3oodoa e uvs s)s2toimpou1lp  mfciasfarraurpoo4ole mieiytla2eanmsnt) lxomfciytlmtrlneslt tetrim no1apeelfcils)arur(rooo4tet io3tydfs2elu s;t)tetnio totlaDeai s s seurxmpio4omenlfeslt  rrr( oou0tetn fetat s eluvp (4texniocoydoat aueo t)seto(mpnodlmtnlivta()srtaump;u1apeomoeiadfs rmums (4teerxr oa1fp e nvslt)setrxm3nydome  fvtatf rtrumo;o0tetomoetytfaDrluvs;u)aeeoif oa1lmDr i olt0 2xmirpno1omtnliet ( s2ra( ooo1tetomieild mDrmu p;t4 rerxf3ia1fpD  n ilt) rtmxm3oydlmeelnes tf 2rmu p;o4tlxomicild a ulnmsn(0tltrircoatla e ueo ( texoxr no1lptelncs ( aDtm(m ot0opxo fetydlm2eanvs u) exoiociadfa  lies;(0seum(o oo4lltnmfvt t artrumpot0tlenmoctyd mDuluvp (0 etrmf3iytfmtraneo;(0 2xoirpio1llenlfcsas)a2rau  ou4olenioctatla2ua(mo;(4aeerif3iotop e nvo s) 2xmxm oy4am   ici tfsDum(mo;u4optoiictldfm ua( p u)aetnxrcoa1lmD anvo t) etmio io1lm   fcslt  Dumxrp;o1oetn ictas s2el( snu4trenxo3tatoptelnvo t)trxrir io4optnlnvt s sruaumpnu0tet iietasfm ran on() exrxf3iadoptrau i (0 rxoir3no1opt livs (f 2urx  no4tpx if3iadfm2rauvp t4arenmf tatom   nesl( seurio3nudolt lfetls  2ta(mp;o1oeeo o3iasfm2ul(vs (0 ltoircoatopDelu i;()s2xoxm no1opee ncs t)srrmxr ou1aee ifctydlaDem(ms u0 ltrmocootopD  iei;t) 2xoir3oodoltemfvsatfs2rr(mpoo4tetniicild aDra(mp;t0arxnio iy1op e iei;()s2xrxm io4apenmfeia(fsrtmxrp;o0aleomociytls2um( s;(0tetrif oytlaDeau o;s0teurirpou1aptemfviat arrax pou1ale miciasfsDuan p t)aexrmr oo1fm e ivsls0 exrirpno4aptnmnesa()artruronu4opxniietltfmDuluvpnt4aeeomocoy1opDran i (0 2xr(mpiodlptelieilsfsDrmur ot4aptoifciaslsDraumo (0aleoif oydomtrai i;() exoio3io1olee neil(faruaxmpot1oetoio3iytfaDem( pnu4artrmr3iotoateluvs t)texoimpio4am emnvsas)a2um( o;u0teenmoetlslm ul(vp u0texoxr to1fpDeanvs s0srum(m ou4lltelfvtas)a2taur no0alenifcias a ulumsnu4aleomfctotfm elivslt0s2uoir3no4lptnlnetl( a2umx pnt1aptnifciyd a um(msn(0tltoir ootlat lu s;s  2xrxm iydaptnmnci ( srrmx  ;t4oeenifciadfsDum(mpnt)altoxoctydop raieils0teur(o oy4lmtnmietl(faDtau p;u0opto f3tls a emnmsnt4arxomfcoydfptr nes () rumir3oydamenmies ()aDtm(rpou4apxnifeiltls em(vp t0aexnmocto1lptrau sls)truoxo3iu1opte netl(  Dur(r nu1opeo ieiat m rlu onu4artoxrciydop e i o t0t2to(r nu1lmt mfcia()a2ur( ooo1apx miciyd s2uan s () lxoxf3ty1oa   nvolt)trurxr ou1apt mnvsa( s2raxrp;u1tet ii3tls a2ranms t4altoif3oy1op   ieslt seto(mpou1amtelies t s2urxm nt4oetnio3iat m ua(ms (4 lxnmr todoatelu o t0trxmxrpoydll emneils) 2urxrooo0tptomieiydfs ranmo u0arxnmo3totfmDean o t0 eumir3no1al nmnctas)sDtmum nu4olenmocils s ua(mo u4tltoxfcoodlm r iei;(  2ur(opoy1ll n fes (  rtmump;o4openioctls mDrmu sn(0altomr to1omtr nei;( teurxr3oy1omeelici (  rumxmpou4aeto oeiydfa2umuvonu0aexoxfctatfmte i s;(0 etrio iu4al   neta() Drrxmpot1aptnioeiytfm eau s t4aeeomr to1omD  u o;t)s2xo(r nu1oltemfci ()sDurump;o4texomf3iatfaDrlnvont4altnio tatlaDrau sl(0 rtrirpoo4am n fcsl()aDtaurpou0tpxomfeils aDrmu ont0aleniocoytfm ranei s trtoxmpio4oleemivsat) 2trxmo;u0tpxo o3iat aDeanvonu4tlxnxf3ta1lp  ai s ( s2xmio oo1ame mictlt) 2uaxro;u1tlxn fctadfsDemu p;()trtrxr3tytlmDe nes t)s2to(r3nodap  lictlt a2raur oo4opxomiciytfs elnvo;t)tlenmf oodfatelu ol(0seto(o3nodol e ivtlt aDum(moou0oee iocildls eanmp u4 lenxr ta1fatrlueil(0srxoirpnydol  miet s)a2rm(r ;o0aetnmf3ild a eau sn(0texnmrciatoatranvolt0teuoir ou1olenlfvia( artm(rpot1openio3iasla ea(mo u4alxrmr3ootlp eaivo;s  2uoxr3iu4omeemivt t)s2uauronu1oex mociltlm2umump;(4alxniocto1fatrai o;t)t2xmxr3nodam e ncsat)sDtm(mpot4olxo f3iyslm2umn p;u)arenmr oydlp rln sls  etm(r nodope  fctat  Dtr( pou1aexomi3tytls2ul(vp;t0tetrirctytom ranvslt) rurir3nodame mivtatf ruaxrp;t1apeoio3ilt s ea(vont4tetnxo3oa1fpt aies;s0teuo(r3io4open ivs s aruau o;o4tpxn i3ilsla rl(vpnu0artnmoctytomDrlivils trxrir oudapt lfcsls sDrrx pot1ale  f3ias a2uanvsnt0treomf iydopt au il()s2tmxo3oo1op n fctlt  2urxm oo1oex iieiyt a2em(vo u0 eenxr ia1la  li s () rxmxmpno1lpen fcia( artaxr ;o1olx iictysfm2rau o t4tltoxfciadfpteauvi;s0s2xmiopnu4optn ietlsfsrua( ooo4olx  ietlt a emnmonu)artoxo3ta1oa rlnvs (0 rumxrpou4am nlneilsfa2rrxmoou4alxo f3tas m rmnmo;u0arxomf to1la  aieslt t2ur(m3oo4olenmncilsfs2tmu  ou0alen ictls mDumnmpnu4arxniociydlp eln i s)srxm(o3iudomenmicsat s2um( pou4tpeoii3iltlm eanms;t4artnmo totopDrlivil( srxriopnodamenlieilt)srraump;t4alt if3iytlm rl(vo (4aexomo oodlp   n o s s2tmimpou4oleelnet t)srraumpoo4oetniieiadlm rlu onu)trenxo3oodfptrluei s0 rum(rpnodapenmfesa()aDtaxrp;o4ole  icilsfm emnms t4 lermo3iodlat lnvi;t)teurir3oy4al n fctl(fa2rmurpno0teeoifctadlm2rl( snt4 lxoio iodlpDr n o s0trurir3no4al   icils  Drruroou4tlxo i3tytlsDul(vs t0 exoio3tydla  lu i (0 rtr(m ou1ape  ncslsfsDrmxrpou4alx  o3tlt m ua( s u)alxrxociatlptrlivo s  2trim3no1alt mivia( a2tmumpot1tltn o3iyslmDra(vp;()trtomr iydlpDelnvs t)seur(m3iydamtemnvia()srurxr ou4alx  ociys s2uan s;t4altnxfcio1opteli o;s0seuoxo3nudapenmnvsa(fa2rr(  oo4tptoifciatfaDra(vs u0teeoio3oadop  lueo;t)teumirpoo4al   nvtatfsrta(ro;u4openmi3ildlm eaums;() etoio ta1omt aneslt0 2tmxo oy4omenmnetas)sDtr(ro;u1opt ii3tydfa rmu o;t0trxnxf3to1faDrauvi t)t2tmirpnu1olt  netas)srrrx pou4oexnmo3taslmDrauvs u0tltnxf3oa1fmtelues;t)teuo(m3iy1optnmnesasfa2umx o;u4texnioctad sDrmu o;u0 ltoio oy1op  au s;t0teuoio iodlpeelivs ()sDrr(rpnt1texomieiydla eln ont0tlenio tytlm  lieo t0tetrxmpoodlpt  nvtat)a2rmxmo;o0oeenmieildfs umums ()arxrxrciydfpteln o ()t2to(rpnodopt mfctl( aDra(r ;t0olxomiciatls ul(monu4trtoxo3oodfaD livo ()t2uriopnodamee fvt ()a2raumpoo4oeeo oeiydls2uauvo u)aetomo3tydoateaieil() etr(r io1optemivslsfa2rrx  oo0alt mociasfs rmnvo t0tetnxo iytlmte uvo;s)teum(r oydopen nvsa(f rrmumpnu4alxn o3tltfm uln snu)aexoxo3tydlate n o s0sexo(opoy1lp nmneslsfsDta(m no1tee  oetatlm2eanvs;t)tetoxo iodfm eliei;( s2urir oodamtn iciat) rrmumo;u1oleo oetadla ua( onu)tleomocto1oatrlies s trtm(rpiy1ll nlfeta() 2raxmp;u1tlxo oeiyt s rauvpnu)trenmr3iy1oa  an s;( srxrxr nodap e ivtlt)sDumurono4apt iociasls rlumsn() rtrxrcoytfa r uvo;s)srxo(o3iodaltnlicsl( aDrmum nt4aptniiciys a2rl( o;t4tleomr3oy1lm  luvi;s)s2ur(r3nydlmte ietasfs2rmumpou1tee iocilslm2rmnmo;(4alxrmocoodfm eai i s0teum(r iudlptnmicsls)a2trurono1aeenioetlt a em( o u4arxnxrctytlmDrai s;()srumxm oydapenmivil()s2uaxm no0ole mfetldlm2rl(vp;t4 leoir3to1fpD lu o (  2xmio3oy1lp nlfvsa(fs2rr(  ;o0apeoii3ild m2eln o t0aexrmfcoodfmtrauvilt  2um(opou1olenmivs s  rtmu  nu0tleoifeiydfaDraump;u4trtrio3ia1la  lieils) etr(r3oy4opeemnvslt)a2ta(mpno1tlen oeildfa2umuvo u0 exnmrciy1oaDraiei () 2tm(rpnodomen fvtat arrr(  oo0tpx mieiltlaDrluvp;() renxr3iotlat aivs t setmxmpio1olt  ictls) Dtrx oot0oeeo fetat sDumn p t)altrircoo1fmt lu ils0 euriopoodol  mfciat)srurump;t4teeomfetls a ulu s t)treomf3iytomtr neo s)s2xmim3io4ll emicsls  ruru  nt4oetoiicilsla2ea( sn(0arxnxo tytfpte n i;t t2xmimpnudom elicsls a2rmurpou4ope mfeild s2emuvo;t)arxnio ta1om e nei t)s2tm(mpou1openmieslt)a2taxmo;u4tetomo3ildls umnvp () ltrxr3iatoateaueols)trxr(mpny1op elneia(  rur( pot0optnmf3tatls rauvs (0aeeoxr3oy1fa   uvol()t2xmimpnu4olt lnvsls) rta(  nt1opeoiiciytla2emnmsnt) reomf totopDrai ols  etoio3iodopee ieiasfs2uaumo;u0ole miciydlmDrm(vpnu0 ltoxrctotoaDrli i (0 2xo(o3oudapeelncs tf 2rmxrpnt4olen octld s2elnvp (0aeenxrciatfmDraivsls0sexrim3iy4ll n nvt ( s2tmx o;o4tptoiocilsls uan s (0altnxoctytomDr u i s t2xr(r oodomtelivsas)a2tr(rp;u4olen i3iydlm umnmpnt) lerxf3ia1faDeaivi;s) 2to(o3iy4ap e ieil() Dtaxmp;o0tpx  oetytlaDrlu p t)aetomr io1latrlnvi;(0trxr(mpiodolt micil(f rua(mo;o4altnmietasfs uau on(0altnxr3todfatrlneils0 rtoxo3ou4om e ietat  2uaumpou4aleo fcild m uanvsnu)artrxfcoa1lpDelu o t0 rxr(r no4amenmnes t a2urump;o1teenmoeiydlsDemnms;u) rtrmo iydfmD an i s  eurio3no4apt miesls) Dtmxm ou1alt  i3tltls elump;u)alxnif3ta1laD  uvi t  2trxo3iy4op n fcsa()a2ra(mo;o1aptn ictas s2elu snt0tetnxf ta1fpt  nvsls0 etmxmpnodamenlfviat)arrr( oou0texoio3tat s2uanvo u0trtnircoatlmtelu il(0 etoxmpnydape lnci sfarumum ;u4oee iietatls2elnvs u0 rtrxo iotoa   ieo t)trxr(r iydlm  livt tfsDtr(m ot0alxn ictydfa2eau o (0arxoiociatfmDeluvi ( trtmim iu4llt licia() rurxmpou1tpx ifctas m2um(vpn(0arxnmf3oadlmDrli o t0 rxoirpoudaleemfet (faDtrumpou4oleomoeildlsDem(vs;(4 exnxr iotlat aies;(0tetm(r3oodaleemfvi s)s2rm(m no4oetnifcils sDrl(vsnu4aexrircta1fa rauei t t2umxr nu1amt  ivia(  Dtruroou4alxnmf3iytlsDeluvp u0 renxo iy1fm rlivo;(0trtm(r3oy4openlics tfsrrm( p;t1apenmieiadlm rmn s (0artrir iatlateaivi s0 2xrirpiodaltnlieils a2uau  ot0alx if3ils s2ul(vo;t0 ltrxo3oytlmD  nes;t0s2ur(m3io4apt lfvtls s2um(mooo0tltomf3iysfs2rmnvo;t4tltomo3tatlpD  uei (0 ruoxmpnydopt  ncsat) rtau  nu0aeenio3iyslaDulumpnt0trtoxo3iotfatraiei;s)setr(r ou4opte fetlt)a2ur(rp;t0oet miciat m uauvon(4aexoioctydlm e i sls0tetr(rpny4ol  mnvia()sDta(mpnt0opx mf3tas m um(mpnu4texoxo ootopDe ivi s0s2xr(m3iodopeelnct ( arta(mo;o4alx ifeilsfaDrmumo t4trerxo todlp rlieo t) exmxr3oo4omtelfct sf Dua(rp;o4tpto oeils m2umnmp;t0tlenmf tatoatelieols0srurxm3iy1am elfeilsfaDtax  ;t0alxoif3tatlsDrl( o;u4 rerircoydoaDeaueil(0trxrim3oy4ape mivt s a2tm(rpoo0tlxnmfctys m2eaumsnt0 eeoif oatfa rluvs t)seurim3iy4lmeemici ()sDumx ooo1optnifctys aDrlnvsnu)arxrxr3iydfpt  nvs t)s2um(r nu4ll nmivilsf rrrurpou0alxomoctltla rmu s (4tltrmo oydlp r i sl(0 euoimpoo4om  mfvsltf rur(mo;t4tpeomf3iltlm em( p;t4teeriocoa1lp rlnvi ( seuo(m3iy4am elncs (  rtax onu4oeenioeiydfaDrlnvo (0aeeoxf todfpD livilt0tetrir oy1lpee nvt ()srumxm ;u0optn oetasfs2umnmpnt4trxoio ootfp eau slt s2tr(rpoy4olt mfvi s a2tmx  ot1tlto oeildlmDelnvonu0 rtnxo iytlateanvol()srtoimpno4amte fet t)srra(mpnu4apto oeiltfm eln on(0 rtoif tadop e u ol( trxoio3oydlmenmies t a2um(ro;u4tex mfciadfs2uan o ()tlenmfcoydlate n o;( srtoxr no1apt lncs tf 2ra(mo;o0tlxnioeiydla uluvs () renxfciy1faDrau ils)seum(m io4ol  licsls  2uaxr ot0aeto i3iltlm2rlnvpnu4trxoio iatoaDr ieo s  exmxr3io4am  mnvsas)aDurxmo;u1altnmietatfaDrl(mp (4 eenio3oytoptelivolt0sexoxr3io1alt  fcsa( srurump;t0oexn octltfs rluvsnu0 etoi
\ No newline at end of file
@@ -0,0 +1 @@
+ieil(0 2xmxm ou4lmenlivtlt)sDrru pou4olxo iciadlm2uau p;u4alxoir3io1fmtrlneol( t2umimpnu1ll n fvs t a2urump;u1oeen ietldla2eaumo;u0alxrmo iodlmD  u o t) 2to(r nodaptn fci ( arurxrpoo1tpt  i3tys mDrau o (4 lerifcoydfaDran i t0 2trxm3io4optnlnct tf 2ra(rooo4tpxn fcils m2uaumo u4arenir iodfm e ivol( trtrxo3oy1lpe mfcs ( artau ono0alxnif3ilt mDra(vs u0tlxnmf iytopDe ivs t) rtmxr3no1olenlics (  2uaur nt1aptniieiadfsDrlu s;u0tetnxrcoa1om rlueolt trtoxr3nu1lmenmncs sfa2rrxro;t0tle  f3tasfa rluvp t4tlerir iodfaDrai ilt) 2ur(m nodol nlics t)a2uru  oo0tetnmietydls2elnvs (0aetnxo3iatlatrln il(0s2xoio3ny4ape mieil(fsDrmurono4alxo o3iys s uauvs;u0 rermf3ty1opDrln i;t0texoiopoo1lmt lieilt)sDuaxmont1aexniiciad s2ea(vs ()alxnir3oytla raivo;() 2toim iu1omenlfcilt srum(ro;o0aleo o3ilslmDrm(vonu4 rermf oo1lpD auvi;t) 2umxo iydomenlnetatf rrm(m ;t1altoii3iadfs ea(vs;u)texrmr3tytom eluvo;t seur(m oo1ape micils sDur( oot4tpxnmf3ildlaDeln p u0treoiocoydlm   uvsls) 2um(o3ny1ap elivs (  Dua(mono1olxo i3iyslaDrmuvsn()alxoiociodopDe u i (0texmxopnu1apeelfvt ()aDurumo;u4aexnii3iatlsDrmuvsn() rxoxf ta1faD ai s t)t2umim iodom e fvs t) rum(mo;u1tpto iciyd sDeanmsn()aeeoif3oy1fa rlneil()s2xrxr io4ale  fvsat  Dtr(mooo0altnioeiydfsDrl( s t0areoircoadla rln i t sexmxr3oodamtelncs ()srrrx pnt4openioctlsla2elnvs t0 rtnif io1laDran ols teumio oodal n fvi t  rtm(mo;u4tex mictltlm2ra( pnt4 lxrif3oodoaD anei ( trxr(rpnodlm n ieta()s2ur(mo;o0tpxo ociat m2um( pnt0alerirciytfpD lnvi s0seuoxm3oudal   nvi ()aDumu oou4tlxniieilt m2el(msnu4alxnif3oy1op rlneolt0srur(m3ny4alte fvilsfarumur no1tpxnio3tldlm ea(mp;t)aexoxr3tadfpD auei t  euoir nodlleelietatfsDtrxro;u0tleo f3iatfa ulnvpnu0trenxfciotlmtrlnvo s seum(r iy4omtnmfci sfaDtmu o;o4aeen oetlslm ua( s (0tltniocoodopDrlnvil(0 2uo(o3io1opeelfviltf Drmur ;o4tex mf3ilt mDrlu o u)tlxomr3oa1faDr uvil()srur(r nydlmt mneta(f rtax ont0tpeoif3iyslm2rmnmo;(0trtnir3oydfp  ln sl()setr(o iy4omeemfcs t)aruru o;u0oet  octysfs2rmuvs t4 ltomfcio1lp rau i;t0trtrir3io4apeelnesat  2uau ooo1oexnmf3tydfs2elu o u0 eermo iadlm eaiesls) 2umio oudopenmneias) rururpnt1texo octasfs2uau pn(4 rxoxr io1fm rauvol()t2tmim3iudolt miviat artmxm ;o0tee ioctaslaDuln p;t4trxnif3iytopDr u il(0s2tmim iydamtn nvi ()arraurpou0altomoetyt aDrluvpnu)trxnir oytlmDeanvi;t0 rto(o nodllee ivsltf Dum( pnt0aptomoeiad m2um( snt4arenif3iotfat anvils0srtmiopno1lmenlictlt)a2uau o;o1tlx mi3tltlm2ra(vp (4alxnmrcoytopDe uvslt0 rtrxmpno4lptemfeiasf 2rm( ono4openii3tls s2rm(mo;u4 rxnifctadfptranes;(0 rurxm nu1lmt mies t a2umum ou4oeenif3iatla2rln s;u0 rtrmf iytfaDraneilt)truo(r oy1lp  lfcia()a2umu o;t1alxo oeilsfa2emu on(0altrxfcoodfpDr iei;( t2uoxm nydome  nei tfarrmu oou0tptomoetltlm ul( snu4tleomf3iodoa elivo s0texrxmpnu4omtn nvtas) Duaxm ou1tlx mfeils aDum( snt)teenmrcty1fm  anvs;t)s2tmim3oy1lm  mnvtas)s2rrumono0alx  ieiasfaDuanvsnt4aleomrciotoptrlueolt srurio ou1amtelnctl(faruaxroot0oltn o3ias mDeauvo t)texrmo3totlm  auvi;(0 exoxm3oodop elnvt t)srua(mp;t1tpeniociad aDul(mo (4 reriociodfm   nvi t  2xoxo iu1olt lfei tfs2trumoou0tpen o3ildfsDulumsnt)artrxo3oadfmDraueo t0sexrio3oudlm   nvias)srrrumpno1aeeniictys s2raump u4 ltnmocto1latranes ()s2xrxr3oudll elnei ()aDumu oot4open ictyd a2eln o t4 etomo3iotlp raieo s)seumim iodopeemfvta(fsDrauro;u0tleoif3ilt aDeanmp;u)aeenio3ootlp raies;()s2trxr nudlpt  fei ()a2taurp;o0optniociltfsDelump;u4 ltnmoctatoptrai o;t0srtm(r nudomeelfeta(f Drmur no1aptoifciltlsDem(vo u0tlxomf3tytfa  lu il( tetm(o oy1lpenlivtls  rtru poo0aetnmietyd a rlnvp;u0tetrif ia1lptrau slt)trur(m3no4opeelfcsa( sDtrump;u1oexnio3tys mDrm( sn()artrxr3oo1op r uvi;t srtmxmpio1alt  ivi t s2tmx ono1aet miciltfm2emu s;(0alenmo3oo1fptr n sl()s2xmiopnydlmen ieilt)sDurx  ;t1opeomoeiydfm2rmnvo;u0 exnio3ty1fa   ies (0 rxr(m3iy1lm  miesl( srurxm nt4aex ioeilslaDrln p;u0arenmf todlp e i i t0teuoxo3iy4lmeemnvt ( s2ra(mo;t4tpxn feiydfa2rlnmpnt)tlxnxfcoatomDeln i s0srxrxmpiudame lfetlsfa2ur( ont4aptomf3ild sDulnms;u4 renmrcoadla rlieils tetmirpnodll   nvta(fa2umur oo0tlt iieiad mDuau snu4aexnmo3iytlp   ieolt0t2um(mpnu4lpeelnvi s)s2ra(mpou1tex  feildfs2umu o;u4aetrmo iydoaDr iei t trumxmpou1lmtnlnes () Draxrpot1apx io3iaslaDuln pnt4tetnmfciadlatraivs;t  eurxr ny1altnlnvia(fs2rm(ront4tex  oeildfm rm(vp t0altrxf totlpDeaneslt trur(r3oy1lm n fctls  2tm(m ;t4aexnifciadfs rlumsnu) rtoxr oa1lpt  n i;s0s2uo(m3nudamtnlictlsfs2taur ;t0olx ioctadfa2eauvsnt4aeeomocoo1oaDr i s;s)t2uo(rpno4lm   nei (fsDtau p;t1ole miciat mDumu onu0arxoif3ia1lmtr n ils0s2urxo3iu1lm  mivi ( a2ua( o;o0tpeomictadla rmuvpnu) leoio iotlmDr uvi;s0sexr(r3oo1lpt miviat)a2urx poo4tpto oeiyslmDraump;t4tlenio oodfaD livil()s2xr(r3iudole  fci s) ruru o;u4aet moeiasfs2um(mo t4 ltrifcio1laDr u sl( trurio3oy4am nmnvs s a2rax oou0altomieiatfs rmnmo (4areoxo oadfaD auvolt) etm(o3iydap nmncta(f rtmumpnu4ope ii3tys sDulnmo;(0 rtoif3iotfmtr uvilt) rtr(r3nu4aptelieta() ruaxrpou1opxnioetytfs em(mo t0arxrxo oydla eluvs s srum(opio4optnlnvilsf rtr( oot0alt ifctaslaDumuvs t4 exnmo oytopDr u s;t t2umio nydameemfcs t)s2ua(m ot0aeenio3tldlsDelu snu)aetnir3tytfa  aueils srurimpnu1om  lfcsasf 2tauronu1tee ifetls a2rmuvp;(0alermo iotfp  ln i t seuoio3oy1apt  fesl(  Dumxro;t0aeeomf3iyd s um(vont4 etrxf iadfmD an ilt)s2um(r3oo1am n ivi t)aDurxr oo0apeoiicildlsDuauvsn()teenmo oytoa  aivslt0tetmxo3oydlptnmiei s) 2rm(m ;u4tptnmoctysla rmumo;u4alxoir3oa1la   nei t) rxmiopio1alen fvt () rtmxrpno4ale ifciad a rm(von(0arenxoctytlptrauvi s  2toim3no1oltn ictls)sDtr(m ;u0oleomfeiys mDranvp t0areomo3tadlmDeaueil()seurxm io4amtn ictat a2tmu poo0tltniociysfa2raumo;t4 exnmfcoodfp ran slt trto(rpnu4ol  mfcs tfartm(  ;u4apxn octyslmDrmnms u0aexrxo3oa1omDe ies s0s2xrxr3iudamenlicils srrau ono4apt mi3iydlaDumnvp;t)aetoxr3tydoaD anvo (0t2trxrpiudalen iesatfa2uaxmp;o0tpe mf3iat s rl(vsn() lenio oy1fmtr ies t)t2toir3ny4ll emivsl(f 2rrx  ;o4aeeoifciltlaDra(mo (0aeenmo iodfmt  neolt texoxopnudlp  lnesas)s2rrxro;u0tptoioeiad m ua(mo u0 exriocoy1lmt  ues;s0teuoir3iodom elnvtls  2rmxr nu4ale  feilsfs rmu onu4trenmo oydop r nvsls)teum(rpnudopt  fetlsfsDtr( o;t1alenio3ilsls eanvsn() lxrmo iytom r neolt  2uo(r oudam nlicsa()sDurxrooo1oleomi3tydfmDrau snt) lxrxr3tadfmte i i;() exmir3io1amt lies s)s2raxm ot4opt  i3tld a emuvp t0artnxo iytoaDelivo t seumiopiodoltn nvs () Duaumpot0oexoiiciaslm2rl( ont)tltnxrctodfm  livs;(0trxr(m iu1ope lfesat  2urx pnt4tpe mf3iydfm2um(mon() rtniociatoptelnvs t  rtoir oodomtnlfesasf Dra(mo;t4oetomiciytfa2rlumont)arxrxr3iytfmDeanvs s trumio3oo1al  mivs ( s2rru  ;t1tee mf3iatfa2ranvo t4 ltoio3ta1oa raneo s)s2xo(r ou1aptemiei s s2rau pou4olenmiciasla ranvo () rxrmf3ty1lmtraivi s0s2umxo iy4alenlfet ( a2rau ooo4oexnmoctlt mDem( ont0 exoxr3oodfm elueilt0trtoir io1alte iesa(fsrta(mpnu4teen feiasfs2eluvp;t4trtomrciodfa elivs;t0t2tm(o nodolt mneiatfsDtaxmono0aeenio3tyd mDuan pnu4 rxnmrcoo1la r neol(0srxrir io1altemnci sf rrm(  ;t1oee mi3tldfs2rauvs;(4tetrif3tytfa  aneilt0texo(m3oo4lmteliviltf Dtrxrp;o0apxomieiltfs2raums t0aeenxo oy1om   uei t t2xr(opoo1lp e fvsl( arumu  ou1tlt  fciad aDumnvsn(0 ltrxrciatomDr ueo;t)seuoio3nodalt mfcs s  Draum ;u4oexomf3iytfmDrl(vo;u0alerir3oa1omD ai o;t  etoimpoo4ll nlieia( aDumum no1openiociydls2ulnvo;t0 rtoir3iotop eauvils)srxm(o3io4olteliciat)sDtrumpnu4tpeomi3iys m eluvp ()aleomocty1om r nvsls0sexoxo3nudlm  mfct t)artrxronu0tlxomoeiyd m rmnvp;(4areomr3tydfmDelueo;s0 rtm(opio1am  mieil(fsruaumpnu4tlxoio3ildlm2elums;u)aetoxo oadomDr uvo;t texoxo3iu1apeemiesltf Dtax ono0tlt mieias aDrmumpn()aexoio3iodoa rln o;s  2urxr iodlptelnei t  2uax  no4olxn oeiysla rlumo;t)altnmr3ta1la rlueo t)srur(o nodom  lnctasf 2um(  ;t1opt if3tasfs uaumo;() renxo3iotfatrai slt0trtmio iu1apt mfet (fa2raum ou4tpxoifctatlsDuanvs;t0 etoir3iytfatrau s (0 exmxo3no1ll  lies s  2taxmoou4tex iictld aDelnmo u0aleoxr3io1lp  anesl()trurxmpno4altn ncil(faDtrx p;o4olt  f3tydfaDrln o;t0 eeoxoctytlm  aivsls)trurxm3nu1aleemncslt s2raxmp;t1alxoioeildlsDum( o t4trenxfcia1fat lnvs t  2umxm3oudlpt mnes t s2taxr ou4tee  feiadlaDumnmo;t0tltoir todom r ueo t)t2xm(m3no4ameelneta() 2urx pou0oex mo3iysfsDrmnmont)aeermr tydfmtranvi;(0s2xmxr3iu1lm n iesl()srumumpnt1ape ioetltfmDrmn s ()alxrmo tytopDrlies s)srumxmpiy4lpt mnct sfaDuaxrpno4tee  feilt sDum( p (4 leoio3oadopDeli sl(  2tm(o3io4oltelnci ()arurxroou0olxo ietydfsDel( o u)areomr tydlate neo;(0t2ur(r io1apeelnetlt a2rruro;t1apx mi3ild aDua(ms t4trxnxf oatoate nvol(0 rtr(r3io1aptn fesat)aruaumo;u4altoifcilsfs rmn s t4 rtnxo3iytlptr ieils  rurio iu4olt mietas)srrrxmont1tltn oeiasfaDem(msnt)aeenxfctytla r i s (  rxmiopnydopt  fci s)s2ur(root1tpt mfctasla el( p (0aetrmfciotomtelnvil(0s2uoxr3oudolenmfcta( a2tmuronu1aetoifctatls ulu on()alenmo3todomtr u slt srxrio3no1oltemictas  2uaumpou4oexomocild a elnvp;(0tlenmf iotlpteluesls)trxr(r iodolte fvilsfaDrm(  ;u1ole  iciyslsDumnms;u4 reoioctadoa  an o () rumim3iy4opt mfeil( arurur oo0aee mociaslm eau o;()tlerif iy1lp  anvo;(  rtoxo oo1ale livi sfaDtrumpot0oet io3tatla eauvpnu0artnmo3tydlmteai il(0s2xmxm nu1lpenmnes tfsrtr( ono1aetniiciatfmDrmn s u4 rxnmr3tytfpt  nvo s)setrxo3iudam emfesa(  2rau pno0texoii3ildfaDeauvonu4trxnif iatfm   n i;s) 2urim no4omte ivil(fsDurx  nt0tlx mo3ildfa uau s (0trxnxo3oy1lmt aieols)texoio nudlp n fvia(fa2umx ont0oetoioeiltfs uan o;(4aeenif3totlaD aueo;t t2toirpoo4lpt livt () Durxr ;u1ope mfetytfs eln s (0trerxf3oytoaDeln i ( trtrir ny1oltnlfvi t)artrxm no0oleo feiysfmDea( s u0 rxoifcto1lm e nvi s trtoxrpoo4lm  lnvsls)s2rmxrpot1oexnmiciat aDem(mo (4arxrxo tatomtrli o s0 2xmxm oydllt livt sfsDtmx  ;o4tltomoeilslaDelums;t)teeoif3totoaDelivs;()srxm(r iydlpenlictat)s2tm(rpnu1aeenmoeiadlmDel( o;(0 lxrxr tatlaDrluvo s)tetmxr3ou1ome livsa(faDrrurpoo4tle mictldls2emnvpnt)trtnif3tadlmD livs t srtoim nu4llenlnvtls)s2tauro;o1alen octlsfa2uanms u)trxnxr ty1omt  n ils)trtrxmpoo1omt lfvt (f rua(rooo1aetoifeias aDeluvpnt0 exoiociydfaDraies;()s2urim iu4alt lnctatfa2ta(  ;o1texn f3tadls rl( s;t0aexrmrctytoptr ivo s s2urxopny4olenlfci t) 2rmxmo;o0apt  oeiad sDem( s;t) eenio3iodfptrln o () 2xr(m io1amee nvtl( aDtm(mp;t0opeoifctlsfmDul(vo (4aetoirctodom   iei;s0 rxoxr nu4lp  mfvil() 2tmu p;t0tpt  fctltlaDrl(msn(0 rtoif iatomDraieolt)trxriopny1apt  fei s)srua(rp;t0tpxnmoeilt m ranmp;t) lermf tydom eluvs (  etoxo no1aptemfcilsfs2raum ;t4apxnmoeildfa um(vont0 lxoxrctotfa elnvo (0teumirpiy4amtnlfvi ()arrmuroot0tex mo3iyd a ul( s u) lxrmr io1op eluvs;s0tetm(rpiydlptnmnctl( arurxmpoo4optnii3ilslm2rl( s;()tltrmo ta1lp e nes t0 2toir3iu1lme mivs tfa2tm( p;u0aetniieiatlm2rmuvs;(4arxoir3oodom eli i t  2toxo nu4opte fet t)artm( p;u4olx mieild a2eaumpnt0tetrio3ootlptranvs;t0 rtoxopoy1op   ivt sf 2urump;u1aee  feiltls2uanvpnt) eeoirctodfatr n i (0srtrir no4al emivslsf ruru oot4opxo f3iltlm um(mp ()trenxrcia1fm r uei t  rurxo3iu1open ictlt)sruau poo0oleoiiciltfmDrlu p;(4trerioctodoatelivs s0s2urimpio1lltemnvsas a2ta(rooo0opxnmieilsfa2uauvpnu4arxoxf3iatlm  anvi t0srtoxm iudlptemiciatfsDrmu  ;o4apto oeils mDra(vp;() reomocoytlmD anvsls)setr(r oodomenmncsltfs2rmxrp;t4tlxnif3iltlm2ranmp;u) leoxrciodfpDr iei s0teumxmpio1oltn ictlt) Dur(ro;t0tee  i3tatfs rm( s ()aetnio tytlat an s s0 exr(r3nu1ol   ict s a2rru pno0olenmieiysfm2ua( sn(0 rtrio ty1lmD lu i t)setrirpou1lmtnmnvsat)s2umurpou1tlxoifetlslsDua(vsnu0 exomf3iy1opte nvi;( srurxo3nydom nliciatf rtmum nt4texomf3tysfm2ea(vp (0trxrio3iytlmtr n ilt)t2xrxopnydolee fet t)s2uaump;o1tpx moctatfs2elumsn(4 eerifcoo1oate ueslt  2xoir3ny4ap  mfciltf 2rm(monu0alx  feildlmDrm(vpnu0tetoxr3ta1oa   u s s  eurxo3iudameelfci s sDrmx o;u1ope  f3tydfm2umn s t) reomrcia1fptelieo (0srxmimpny4lmtnmfvsls  rraurpnu4tlxn fcias aDeau s u0trxnxocia1faDr n o (  exoxm ny1llte fvil()s2raxmoou1aleomictadfmDelu o;t)aetnmrcoatlmD lu i;( tetmim3oo1om  lnet tf rtrumono4aexoif3tytfmDem(ms (4 reomo3oy1lmDeaivi;s)seuo(rpny1alt lictlsfs2tau pou1oee  ieiasla2elu p;t0 ltnxf3iytfm r nei s)seum(opiy1al emnvtas srra(rpnu1tltomieiad s el( snu4trxoxfctadlm  auvo;( s2tmxopiudom elivsl(faDrm(  ou1tltnifetad m el( s;u4areoxo3io1fatrlnes s)truoio iu4alen fvi t artm( oou1aetnioetadfa eaumo;u0 exoif3iotfmt ln o () 2xrim nydam nmivt tfaDur(ront1altniicilsla umnmon(4trenxo3oadfm r uvo;t)seum(m io4amt  ics ()s2tm(rp;t0alenifetld a2uaumont0teenxo3oa1omteauei s) rxo(r3oy4om  miesat)artr(r nt4aet mf3iat sDrluvs;u0 reoxo3tatlpDrlneslt  exoxo ny1amee fci t  Duau p;u4tlen i3tldfm ra( s u4tlxnmfciatlp   nes t0srxo(m3oo1ll  mnvtl(  Dra(rp;t0oltnmietatla2eanmsnu)tltnir3tytlpD  uvo (0setoim io1op  livt t) rrauronu0oexoiietas m2raump;u4aetoif totomtrlivi () 2xmxo3iydomte ics ()s2rr(r nu1aetnmieilt s uluvo u4alxnmrcoy1fpDeaieo s  rtrxmpou1ol emiviat  rum(rpnt0tltnmfetatlm2ul( p;u4 etnmf3iatlaDr i o;(0trtoxm3iydomenmfvsas)sDrrumont4tetniicias a2ra( s (0 etnmrcoadomt luvslt  exrir nodlp emicil()sDraum oo4tlt mociltla2emuvo;t) ltnmrcoadfm  auvi;() exoim3oo1ole lfes t sDumu pno1aexoiieiat mDrmuvonu4arerxrcoytopD luvs t t2tmxopou4llte feils aDraxroot4aee  i3iytlm elnvsnt4texnio iy1fmDe uvil(0tetrxm3iydomtnmnesa( aDtrurpnu1oexniietlsla2em( o;(0trxomociydoptrln s;s0s2uoxm3iy1om   nviatf 2ra(rp;o0tltoiiciydfm2um( pnu0 renmo3oo1lm rln o;s  rxm(opou1opte ivtl()sDtmump;o4oexnioeiadfm2eanmo;(0tetoir iy1fm raieo;(0sexo(o3no4ll  mnvt tfarra(m nt1tptn o3iat sDran p u)texnif iotfmDelneo ()truriopnudamtemncilsfsrra(  ;t1tpeomictysla2rl(msnu4 rtomf tadom rluvolt0setm(mpoy4omeemicsltf 2urumoot4teeomieiyt m ra( o u) lxrio3oa1fate ieo t  2umiopoydamtelfvi (fsrtmx p;o4tlenmf3tys aDuluvo;(0teenxr oa1fpt  uei;s0 2urio3nodopeelfei s srrm(mpot1tpxnifeiadls um( s;t0 lxoxrciytlmt luvs;s)trtmxm io1lmtemnvt sf 2umumo;t4oleomf3iad a2ranvon(4 exnio3tadop eanvsl(0 2xr(m3iydopt lnvsls) 2ta( ooo0texomi3tad a2eln snt)arermf ty1lpD luei (  rum(m3oudllenlncia(fa2raxr nu1olt ifcias sDem(vs;u0teenmo3ootfm rluvsl(  rxo(r ny4ame mnvtat)srum( p;o1tlx  fetyd aDeaums t0arxoir oatopDrai i;s0t2xo(r oodam emfcs t aDrax  ot1oet iocias aDel( onu) ltoio iytlptrai o;(0t2tmxo iu4lpen fvta(faDrmx ooo0tpx ifctyslsDulums u0alxnxr oa1fmDrauvs;() euoxo3no4ol n icsat) 2tr(rp;u4tptomfetatfs umnmp;u4altniocoadoat an s;()t2xo(opnudlpen nesl()srtm(  ;o4olxn ieiatls rm(vo u4altoif3iytfm   i ol( t2tmxr ny4ol  mivs (f 2um(rpnt4oexnii3tlt m rmnvon(4tltrmfcoodop elivi t0s2urirpiydomt mneta()srtau  nu1aetn ietasfmDumu p u0 lxrxr3oadoa eaivolt t2xoxr nu1op emivtas)aDtr( ono4tpx ii3ilsfmDua(mo;(0tlxrxr oa1fm   iesls) rxmir ou4ll emieia( sDtax pou1tpt mietadlm2ra( sn(0 eenxfciodfaDe ivsl()srxmio3oudll n nci sfsrrrxmonu4alxn i3tad m2ulu p;u0trtnmociotopD aues;t t2to(o3iu1ol   nci t  Dtrurpoo1aet iietysfm2uanmp;u)tltoxo to1lpt lneol() 2umimpou4lltnmfct t sDrmx pnt4tet  feiydla em(vp u0trxoxfciodlp e i i;s0 2xo(o3ny1ale lfetltf rta(mono1aex ioeiytfm ra(msnt0aexoxf oo1fat an o;t0srtoiopou1ll emneta(f Dtmxroou1tetn ieiad m ua(mp;(4aetoifcta1la   i o;(0srxmxm3oy1amenlneia(  2um(moou1oet  fetltlaDrlu s;t0 renxf3oa1latr ieo t0 etm(r nodlp emfvils  2rrx  oo0oex mictatfa emumsnt) lxnmocoydoateanvs t truoxo3iy4lp e ivs (  Drau  ;o4teeo f3ils aDranvo;t)tetnxr iatop e nei ()seurir iudlm   fci s)a2rmxm no1tle mfctydlsDrlump (4aeenmociodopD  ies ()texmio3oo1lmt lnetl(faDtax onu0tex ifetysfsDelnvo;u4texrmo3oa1lpD  nvs;()t2xmim3oudoptelfeil() Dtr(m ot4tpt  fciltfa rm( p ()trtrio iotoa eai s;t)texr(mpnudam nlivsa(f rta(  ou0opx iicilt mDulnmp;(4altnmr3oodfm  aneo;( s2urimpiodomeemfesltf Dtm( pnt0apx iociysla2umn o;t)trxoxf3tydfmDeanesls0srur(r nudal  lict t) rum( oou4oeenmo3ildfa2rauvo;u0 rerxo3tydlm e nes ( t2ur(m iodamtemfci s)arrr(r ;t4teen ociasfm rmu pnu0 renmrcoadfpD  ies;s0teuoxo3no1olen ieilsf 2taum ;u1ape  ietld m2eau o;u0artomrcootfpDeln o t t2umir iydlm elivtltf Draxmpou0apx mfciytla2uau p u) exnmfcoodfm rln s;s)srxriopno4al   neil() rumum no0alt moeildlmDem( p;()alxomf3oodomDeanvilt)srxoim3io4alte net (fsDra( o;o1aexnmf3ild m rl( p;u4tlxnxrctatlmt aivolt)s2xmxmpoydoltn iet t)sDrru  no4opeomo3tys a2eluvp ()aetnxr3ia1la eau s t0t2xrxm3io4omt  icia(fs2trxr nu1tpx mfeilt sDuan s (4 rxrxfciatfm e nvols)tetmxrpiy4lmt mfei (faDuaxroot1oeeoioeiltlsDrmuvp ()arenxo iytlaD lu o s0 2ur(mpoydoptelnet ()srtaumo;o4oex iiciltfm elnmo u) exnmr iytlptelieils) eto(m3io4ol nlnvias s2ua(rpnt0opxo o3iad a2umnmp;(4texomr3iadfptean il()s2um(m3iodlpt mfeiat arrrur ;t1opeoif3tlt s2rl( s;u) rxomr tytopteluvsl(0t2triopnu4lm  lnvt sfarrm(ronu4teenmictltfmDuauvo;u)tlxrmrciotlmteaivilt)trxo(o3ou1ap n fvsat) 2um( p;t1alxomieild m uanvs;u0alerircootopD  ieil(  eurimpiu4lmen fvi t a2urxm ;u0oexnmf3iltls rauvo u)tlenxfctytlaDr iei;t0teurxrpou1amt lieilt)a2ua( ono4apx iietls mDrlumo t) etoxr3ty1oateauvi t) 2tmim3oydllenmicsltf rrrxront0tet mfeilsfaDra(mo u0tlxrxrcoatomDraieo s texoxopnu1alenmfvia()arrm(  ;t1ape io3iydfm2rmnmont) exniociadfmD lueo;t)s2trim iy4omt mnct (  2tr(  nt4tex io3ilslmDrln o t4altrmo to1fatranvols  eur(m nu4ll n ivs sf Dur(r oo0alx ifeiyd mDran pnt0tltnxrctatlaD luvs;s srxoir3ny4opee iei s) 2tmxro;u1oex iocild s rl(mont0 eerxo3totoat  uvs s  rtm(m3nydopte fctas  rrmurono0opx  f3iytls2el( s u4 lenmr3tytlat ln o s0trumxm iudlptemfeils s2umx oot0optn ieias mDel(vo;t)alxnxr iotlpDelu i;() rtmxmpoudlmt lfei () rtr(ro;t1aetomiciysfa rm( s t0trxnmo iytlpte nvil(0s2umio nu4am n nei sfsDrrum nt0apxo ictysfmDrlumsn() lxoxrctadoaDr n o (0trur(m3nudomt  nes tf 2uax o;u4opx io3tys m umnmo;u4 ltnio oo1lpD  u i;t)tetoxmpiy1op  lfeslt  2taum ;u1apt mf3iad aDra(vo;t4 lenmf3oatlptrlieo s0 rum(m3iu4omeemnci sf 2umxm ;u1tptomfeiyt mDemnvo t0alxoxr tytfptrau i;t)srur(o3oy1lme licsa(f Dtaxmpou1alt  f3iytlsDulnvo;t0areoir oodfa e n o;()trxr(rpoy4ome lfeias arrm( poo1openifciatfsDrmu onu0 exoir io1omt aies s)srxo(m iudoltnmfctas) rtaum ou4tpx  ietydfa ra(vs (0 exrxf3ta1lmDe uvslt0t2xo(mpiu1lm  lfvi t sDtm(moou4opx mf3tydls uln o ()trerxrcoy1fa  aneslt t2xrir io1ape  icils aDrr(mp;t0aptomo3iasls umn o (4alenxrcoydlat  n o t0srurim iodlm nlicslt srtrx p;o1olxoio3iytfa2em( ont4 eenmrcoatlmD auvo;t) rxo(m oy4lptemfetas sDta(r nt0aex if3iytfaDemuvs t0arxoir3ty1fpt ai o;(0s2ur(rpno1om n nvsl() 2tmx oot1oet mf3tatls2uluvp (0 ltrxociy1laDe ueslt0 2toxrpou4open nvsat) rur(mooo0oexoiieiytfm rau pn()tltoxfciatlpt livs;t srxrim oydoptnmnvi tf 2tru ooo4aexnio3iysfa2um( ont0 lenir tatlat lnvs;s setrxo3nu1llt miet t  Drmumoot1tltomictasfm2ran o;t0aeeomr iotom ranvi t  eur(opoo1oltemfeia(fartau p;u4tltoiiciyt a ea( onu)aexrxf io1fmD  ueils) exm(r iy4olt mncsa() Dtmur no1aptn ieiydfs2uan p t4 ltrxf3tatfaD livi;s  rtoxm ou1op elfvtat)aDtm( oot1oltomi3ilt s rm(mon() eeoir3ty1fptr ies;s0t2urxo ny1apen nes (fsrtrxmp;t4tlxnif3tydlm2ranvs t4areoio3tatlpteln s t0 2xmir iy4alee ieias aDtru  ;u4opt  ietytfs2ulnvpnt4alxrxfcoadlm   u i (0 rxrirpou4lpte ncil()a2trxr no0optnifeiaslm rmn ont4 eeoio3oytoate uvi ()t2tm(mpoodlpt  fvsas sDtaxrpou1oee ifeiydlaDrln snu)tleoir3tydlaDr ivslt)s2tr(r nydomt  iei t srumu  ;u4aex ii3iyd m2rluvsn(4alxoircto1fa eaivo t  rumim nydomee fetls) Dtmx  ;t4tleoiieilsls um(vp (0aexrxr tatlmtrlneo;t0srtmxm3ny4altemiciasfa2tax oou1oeeomo3tytfa eanvp (0 eenmfctatoa eaivsl( teuoxmpoudamenmics sfs2ua(root4ope ifeiytla2ea(vp;(4tlxnxf iy1lpt lnvo;s0 exoir no1ope  nvslt) 2uax p;t1optomo3tyslaDumn pnu0aetrxf oadfp r ueo;t0teuriopiy4oltelncs t)arrr( p;t0ole ifetydfmDra( s t) rxnir3oytfa   i il(0s2trim3no1al nmiei tfa2tmxmonu0alxn iciytfs2emnmo;(0texnif3iytop ran sl(0 exrxr3nu1ol nlnet (fsDur(  ;t0oeto ociat sDulnmsnt4alxoir ia1omtelneolt0teto(m ny1am nlivsat)a2um(m ;u1oetniieiydlm2rmuvp;u0alxniocty1lpte ies t  exr(rpio1apenmfcsl(farra(monu4altnii3ildla rmu o;(0 ltrio to1faDe ivol( trtm(mpoy4ap nmicsat)s2rmu  ou1oeeomicild s ran s;u4tltrirctotlmDeln s;s0 2to(mpnodol elfcta(fsrra(m no1olt ioctls s emumo t4tltrif3tadfmDe nvils0t2urim3no1altemiet tfaDtaump;t4oeeniieiyd s emuvo u4tltnxo3io1omt  ivslt)setm(m nodol e ncil(fs2rmx  nu0tptnmociydlm rmumpn(4artrmo3oy1omteauvo t0 rxrxr3ou4optn nvta() rra( poo0tet mi3tatls em(vo ()aetnxrcoytfmt  ueol(0sruoxm oy4am   fviltfaDumuro;o0aptoii3iys m2emump t)tltrmo to1fat ln ilt t2urir oy4lp  lieta(  2umxmp;t0tpeo f3tydfm ul( s;() ltrxfcta1fm rlivi (0t2umio iu4aleelnvsa(  rtmxmoou4tltn i3iytfaDulnvpnt0arxrir3oa1oat  nvo;( t2trio oudaptnmivi sf 2rrurpot0optomo3iytfsDumnvpnu0 exrxr todopte u s s) 2xr(mpiy1lltemicilt s2rrxrpou4opt moetydfm uanmo;()altoio totomDr neil()texmxr io4amtnmicias) rrr(rpnu1optn ietadla2ra(vsnt4tlxrmoctodfat  ueil( s2xrim3oo4ap emfvsl()a2trxmp;t4tpxn i3iat s emuvp u) eenircoydfaDeauvol()t2xo(m nu4opeemfetasfaDrmumpno0oex  f3tatfsDrau p (4alxnxr3oydlpteluvi;t0srtmir3nydomt lnvia(f Dua(rpou0olto ociyslmDuanvon(0altrmf3oatoa e ivo ()setmimpoodlme mfcsat) 2rr(mp;t4oexn i3iltlaDeanvs (0trtnirctodfpD lnvs;( srurxo3io4alte ics ( s2taxmpno4oetoifetlslaDeauvpnt)areomf3to1lp   uvi s) eurxm3iy1op e ivi sf Drax p;t0aex  ietlslsDranvp u4tetrxr3tytfaDelnei;s  2xo(mpio1om  mieiatfartmurpnu4aexoiiciadfs2eauvp;t)alxrmrciotlaD livs;t0s2urxm nodamt lies ()s2umu oou0tpto f3iytls uanvo t)altoxf3iotfpDrlnvi (  2tr(r3ny4ap emicsa()srtaxm ou1ope ifeiytfaDumumont0 lermr3ia1omtr uvo;(0 euoimpiu1apt  ivt ( s2ua(rpnt1aetn i3iltfm2ea( pn(0 lxoio iodfm eln o t0 2tmimpoydlmtnmfvt t s2rmxmoou1aleniieiytfaDrl( o;t0alerir todom e ivs;s0s2tm(opiy4ome mfesas arta(mooo4tpx  fctls a2el(mpnu4teenmfciatlp  aneil(  2xrir iy4al  mics (  rtaxro;t1aetn feiysls rl(vp;t4tleomfciotlaDranvsls  rum(mpio1amtnlietasfarrrxro;o0opt miciydfm2ranmon(4tltnmrcoo1opt  i ol(0srxoir oodomtemfeia()sDumxmpnu4tlto o3tad s rlu s u0alerxrcoodopD  n s ( trtoirpnodoltn ivia(fs2rau  ot0oet  o3iat a ranvp u0altrir iytfp rlnes (0s2umxr iy1lm  miviat) Dta(ront1altn f3iadlm ulu o;(0 rxoiocoo1latrlueols texoio ou4lltelfetl() Dra( pnt0tleniieilsfa rmu o t0 rxomf3iotfat li olt)seto(r oo1om nmieiat)srur(monu0olen octasfaDuan p (0artrxrcta1faD livils sruoio3no4lptnmivslt s2urur oo4aexo fcildfs2rmuvsnt)teeomrciydoatr n s s)t2xrio3no4lp  livia(  Drrx o;u4tlxoifcildfm2ul(vp;()artoircta1fm e nei;s)s2xrimpno1ap  mivi ( s2trx pno1oltnmoctltfmDrau p;t0 ltrir todlpteaueo s)t2uo(opio1alt  fcs t s2rru pot4texo ictatlsDumn p t4aetriocoodoa r i o;()s2xoxo oudalenlnes tf Dua(r no1tpxoioeiasfs2umnvp u)areom
\ No newline at end of file
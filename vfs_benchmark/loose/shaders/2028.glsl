@@ -0,0 +1 @@
+u s t  rtmxr3nudomeemfet (f 2tr(rp;o4aptoiietldfmDrm( pnu0 rerir iytfmtr i o;t) exmimpoodlle mfvt sfsrurxm nt4oleoiiciyslsDuanmsnu0arxnxo tadla eluvi t0 2xoir oy4olenmivtl( sDrrurpou4tpto ictlsls2rauvsnu)trtnxrcoa1oa  auvol()srtm(m nodolenlfvtls) 2tmxmo;u0oeto f3ild mDemumo;t4aetrmo tadla  an i s t2xriopny4lleemnvs sfa2ta(r nt1tet iieiys s rmnvp;(4arxnxf iy1oat luvol(0setrxopiu1optelfvta() Drr(mpot4alxnmoctaslm2ranmp () lxrmo ty1lptrau i s)s2uoxmpou1am  mics s) ruax  no0aetoifetytfmDelu s;t4 lermf oatlpDeaies;(0seurir iu1om nmfeslsfa2rr( pou4apenmfciadls ul(vs;t0tltoiocoodop r ieo;s0srtm(opiu4llt  fvilsfaDurxmo;t1oetnif3iyt s rluvo u)tlxoioctotfa  ai s;t0srur(opio1ap nmivt tfa2trxr ;o4alxnmicild a rln p;u) eenif3iatlm eln sl(  etriopoo1am elietlsf Dumurp;t0alt io3ilt a ul(vp;u) etnir to1lmDraueil(0trxo(r3nodom emiviat s2rm( onu1oexniiciatlsDum(vont0arenmr tadlpDeaivolt0 exmimpnudolte ictas)aDrm( ono1tpeoio3tldla rmumpnu0 rtnxrcootfat  i i;() ruoiopiu1opeelnctat)srurxmp;o1optnifciytfm rl( p u4 lenif totfpt ai i () 2um(rpiy4lmeemnvs ( s2umxr no0tlxoioeiytlsDua(vo;(0trxoifcoatlp   iei;() eur(o3no1lm  lnetlt)s2tmu ono4aeto o3tas s ea(vp;(0arermocio1lmDrlnes;s  2xo(rpnydaleelfcs s)sDuax  no1aeeomf3iyd s eanmsnt)artoirctotomD aneo (0srum(r oy1am n fvsl()s2rm(ro;t0oetnif3ilsls ea(vpn()artrxfctatlat  uvils s2um(o iu1om  liesat)arrrurpou1tlxoiocils a2rmnvsnt0 rxnmr3iadom e ivi;t0t2tm(rpiu4ol nmivslt)aDurum ot0tptnmoeiydfm ranmp;u4tltnmr3tydoptrlieils0 ruo(opnu1ol nmfviat)aruaxm ;t0oee  feiysla2eau p ()tltrmrcia1lmt anvi;(0 2xriopnu1ol e nvs tf rrmur ou4tlxo ociys m rmn o;u)tltoxfcoatoptrau slt t2to(mpiydope mnetas)aDrrum no4tee iiciadfm ranvont4trtrmr totlaD anes;( srxmir3nu1amteliei sfa2tmu  oo1tpx  o3iltls el( snu4altnxf3oa1fmDraies t) etm(rpno1om n nvt sf 2ra(mo;u1apto oeiatfsDemu s t4tltnmf3ta1laD an s ()trxrxr oydllenmfetlt artmu  ot0apxn octasfmDraump;() rxomf3ia1fatelivi;s)t2ur(o3ou4lmeemnvi t)a2ua( ono4tpeomoeils a2emn o;() eerxr iy1oaDe neo;s0trurio3io1apee iesas sDum(r no4opxnmocilsfa2emnmsn(4tetrio iatfpDeauvslt t2xm(o no4lptn nvsl()aDraxr ;o1oex mociytfs2um( sn(4arenif iatopDeauvi;t)teum(mpou4amtnmfetl( aDrr(ro;u0tlxnii3ils s2emnmont) rtoir3iy1lmD an il(  2um(m3iodapenmfvtas)artr(  ;u0aex  iciytfm ulnmo t4aexoio3tadlm e i sl( trxoirpiudopeelfct tf Dtmu poo4opxn feias m ul(mpnu4alerxf oytlatelivi;(0srtoir io4ap  lfctlsfaruau oou1tleoif3tasfs2ea(ms;(4 reoxrcoy1fmtran o;()trur(rpou1ol n nvslt)aDrmx onu1oeeniocild s uln s;t)teeomfctytopDr i o s0texm(r3io1op  lncias  2tau  ;t4tpx  feiyslm em( snt4aetoio3ty1op rlueolt0 2umxm iy1alen fcsltf Drmxronu1olxoifciydla2emnvs;(0tltoir3iy1fpt  i i;(0srumirpiu1llee nvia( sDumxro;t0alxo ietys sDul(vp;() rxoxo io1fatelu ils  2tmirpnodlptemfet s arrmurp;u4oetn ieiat m2el( o;t4 ltrxfcoadlm ran il(0 ruo(opiy4omtnmiei (fsDra(r oo0alt moeiad aDrln pnu4teenxr3tytomtrau s;s) etoxmpiydaltnmfvtasfsrtm(ro;o4oee if3tyd mDuan p;t0 rxrmr tatomte ivi;()truoxr ny1ol emncta(fs2urxrpno0aetnmfcias a2um(vpnu4 rxrir3iodlaDelivi t0srtmim io4lptnmivtlsfs2rmu o;u4ale  i3tatls2em( o;()aeermo oo1fatelnvi t0 rtmim iydamtemnes s)arua(mp;o1alxnmo3tatfa emnvs u4 lxrxr oytlaD lneslt) eur(r3ou1lp   fvils a2trxmooo0texo ietad m emnmpnt)trtnif ta1oaDeaueo;s srxmxo3io1lpe lncslt)s2rmxr ;o1olt mieiasfm2ulnmo;(0trtnmf3oadoaD lnesls)teumim oo4ol nmfcsatf 2uaum ou1oexnifetlsla um(vp t)tleomf3iydoaDrlnvil()setr(o nodlpeelfvta()a2ra(rpnu4texomf3iydlaDumnmpnt4tlerif3oy1lmD li s ( teuoimpny4ol nmnes tfa2uru p;t1alxn ictadfsDum(vs;u4tlxnircto1fm e uvsl(0setmxopoodopee fetl(f 2ua(m ;o4tlt mo3iydlm2elu p;u4trxnxo3iytopD aivils texmim ny4lp  mfvtlsf 2tmx  oo4aeeo ieiydfm eln pn() rxoifcto1fatr nvo s) etm(r3oo4llenlneslt srtmxro;u1olx  octld m2umuvpn(0 rtnxr3oa1opDrliei;()s2tmxr3io1lpenmivtlsf ruaxmpno0alxomf3tyd a rl( on(0 rxrirctodfpD lu s t  eum(o3nudalen fcsat)sDrrx  ot4oee ioctld s2ulu p (0 rxrmo3oa1latrluvs;(  rto(r iydapte icsas sDtr( ono0oltnioeiys s2umuvpn(4 exrxf oodlm  an s t trtm(mpou4amenmncs s) Dtrurpno1ole ioeiatls2ra( sn(4tlxoiociytfmD  u s ( s2tm(opno4ol nmfetl(  2tmu  ou0alt  iciltlsDel(vo;u0trtrxo iatoaDe nvs t srxoirpnu4aleelfvt s sDrmxmooo1opt  f3iasfa2rmuvo;(0aexnio3tytla eln sl(0sexoxopiudoptemfeslsf rtmxrp;u1tpe ifeilslm2ul(mont0tetrxf3tatlaDr nvols0sexrio3oo4om  livs (faDraxr nt4opxo iciyt a emnmp u0texrxr3iytopt  nvo;s)texm(m3oudop  livt tf Dtaxro;o4ale ioeiasfs ea(mp;t0texnxrcoytfpD  u o;t0 ruoxr3oudol   fcsltfa2tmu  ou4tex  i3tatlm2rln pnt) reoif oodfa   nvsl(0 rto(rpoodlme liesls aDraur nt1aptnii3tat mDrlnvo (0 lxomoctatomDrluvils)s2xrim3oy1lleemfesa(fs2umumont4aptn ictadla2eauvont4trtoifciadfpDrlieo;()trum(mpio4ope mfvs (faDrm(r no0aetoiiciatls2eln p;u) rtoif to1fmtr uvi (  rxm(m oodapenlnctl() rurxrp;u1aptnmfeiasfs2el( p u0altnmfcto1fm rln olt  2uo(m3ny4al  mfetat s2raxmp;t4oltomfctas m2eanmonu4aeermf3iatfaD  n s t  exriopoudlptelncs s a2rruro;u4optnmfetytfs raumo;(4 exoifcty1laD aivsl(0trxrir nudlmtelnctl(f Drm(m nt0optoif3ias a2umnvp t0areoxfcty1oatelnes;()srurxo3oydaltnmivsa(  2rmu pno1tee ifciat mDumuvont0 rermfcto1opteln o;t  2tmim3iodapenmfei ()artaumonu1oex mictltls2uau p;t4aeeoio tytfpt luvi;() 2toirpoy1lmtnlfvil() rrmxrpno1apxomfciadla2ea(mo;(0aetnmf3tydlpDeanvi;s)trxrim3iydaltnmivsls) Dtru p;u0apx  ieiasfs2ranmo;u) leomr3totfmt anei;(  2xr(opno1llee fctatfaDrr( o;u0oltn f3iadfa2rlums t4tlenmocty1fm e u ils)teumim nydlpe lncil( srur(mp;o1ope mi3iyd sDrmnvs;t4tetrir iydfp eau i t0s2xmirpou1ap   ncsas) rrmx  ;t1apx moeiad m raump t0tlxoxf iotlpte nvs;(0 rur(m3oy4optnlictat sDrm(root0oltomoetlt s2rmumo (4trtomf oadfmteanvs ()s2toir3nodapenmncsl()aDuaxm ;o4tlxo i3iyd s rmnvonu4arenio3oatfmtr iei s0srumxrpnodal  lnvias s2tmxrp;u0tlxoif3iyslm ulnmp;(4aexnxrcoydlpt  n ol()texr(m iudll nmfvi s  ruaurpnu1tptnmocilsfs umnmsnu0trxnifctodfpDraiei s)srur(m iudomen fvtlt)s2rr( ooo4apenifeiys sDeanmsnt)aleniociytfmteauvs s) eto(rpnudape lneias sruru pnt0oltn fciatfm ul( s;t4 lenxf3iodfatrluesls s2trxm3iy1lpeemfvs ( sDurx pno0oeeoifctad m2ulums;(0trtnmf iy1la rli s;s srtrxm iy1olenlfvtltf 2uaxrpoo4tpx  fetyslm2el(msnt4 etnmr3oy1faD ai i;() rxoirpoy4am nlict sfs2ta( oou1ape io3tadls rlumpnu) etnmocoatlateai s;s  rxoxo3oy1lpt lncs s  ruru  ;t4tpe ioeiytlm elumo;u)aeenxf3oydfmDe nvolt t2xrio3iu1lp  lici s s2urx p;o4tetoiociadfm elnmo t) exnmf io1fateai i;s  rxrxm3nu1al nlivil(f 2umxro;u0alt ioetlt m ean s;(0 lxnmr oa1oa rauei t) rxm(r iy1op e iet s sruaumpno1apeo i3iyt a2ranvonu) rerif todfpD  ivi;s0srtrimpiydop  lnvia(fs2trxm no0optnifciasla2emumo;u)arxrxr ia1fatrli s;t s2xrimpnu1amtelnvi t  2tmxr ;t1ale if3iat m2emuvsnt0 eenmo iytomD anvil()trur(r ny1op elnvt (f Dtaxmo;u4oee if3iytlmDuau pnu) rerif3iytlp r nvi t)srxrirpiudole liesat  rum( pnu4ope  iciltlmDemumo;t) eerio iydlaDe n olt) eum(r3io4am  lncils srtmxmpoo1optomoeiad s2em(ms;t4alenifcoo1lmDrlnes t  rtoir3oudll elncs sf Durumo;t0alxoioeiad a2ranvo;t4teermo oadomDelnes s0 2xo(m no4omt  netat a2ua( oou1opeoio3iasfs2um(mpn(4 lxoxr io1la r u o s teto(m3iy4ap   nvsl(fa2trum ot0olt mfeiytls elnmo t0texoxf3oydom  auvil( trxoxmpoy4ope lietas)aDtrxmpnt0ale miciaslm uauvonu0 renif tatfm eai s t0teurimpnodlle  ietas) Drr(m ot4aexniieiyslm rl(vo;(0alenmr3oa1lptraieo;s)s2xrio3iu1amte ivsat)a2urxmo;t1opxnmoctldla2elumsnu) lenifcia1fmD au i;t t2trim oydlm emfcslt  2rm(rpnu4optomfeiyslmDul(ms u)aeeomf oytfate ivi;s  exmxopio4aptelfvsatf Dua(rpno0apt mociltlaDuauvp u4alxrxr iytfm e iei s0tetoxr3oodameelnvi t  Durx  nt4texoiicilsfsDemums;u)areoiociy1lmDrau s;(0t2xo(r iodlmee fesa()srra(rp;u0altnioctytfaDranvs t4 etrxr3oa1oaD  n i;s0s2xo(mpio4lm   fcil( srumxrpou4aetn octlslmDrl(mpn(4arenmr3iotom  aieo t0s2umio ny4alteliciat) Dur(moou4olen o3iltla rlu p;u)trtoiocta1omt  neslt)truoxmpiy4lm e nctl()a2urx  ou4apeoif3ilsls2um(vsnu)alxnxr3ia1lpte nvs;t0tetr(m no4apt  icsas) rtrxrpoo0opeoifciydlaDra(mo (0trxrif iodfmt  uvi;t trumxopiu1amtn iei t)sDua(ro;u0tlxnmoctysfs uanmpnu0 eenmf3oadoa r u i s0 2trio3oodam emnvia(fartmxrono0olxnmf3tysfaDelu ont4texnifcoydfpt li sl( sruoiopny4amt  neiat aDuau  ot0teeoio3ils s2ranmsnu0teeomo3iydla  li s;() exrirpnodalee iviasf Drm( ono1tltn oetlsfm rl(mon() exomf ia1lpte i o;s t2uoimpiu1lmtemivi s)s2tmxrpnu4tltnmoeiltls umnvo ()artrif oy1fatraieols)t2urimpiy4optn fctasf Dtmum oo4olt mociltfmDemumo;t)texrxr ty1fmte ueils) rtm(o oodaltnlicilsfartm( p;u1tet iocilsfm2uanvp;t0 exrircty1lm  aivi (0sexoio3iu4omte ivta(fsDtm(  ;t4altomoetadfa2emn ont0 lxnxrcty1oaDe u o;t0 2uo(opiy1omte nvi (  2urxmoot1ope  fctys s umn ont0 etoiocio1fpt  u il()srxoxm ou1lptnlnet t)sDta(roou0teeoioetysfs2emuvo;t4aexrmfciatlmD  nvo;( teurimpny4op   fetlsfartau poo1alenioeiadla2rln s;t)teerir3tadom eln sls0 rxo(m nudopen fctatfsDurxr no4aptomf3tltfm el( o (0 rxrirctadlaDrlivo t)t2tr(r3nudll   ivsas srumu pno4tle mf3tysfaDum( pnu0 lxoir oydfpteau s;t sruo(o oo1om  mietls)s2umum nu1oetoifeiyd s2uauvs u4 renxo iatfaDe neo;(0seuoxr oo1lltemneilt) rtmxrpno0alx mfetltlm2ea(vo u) exoircootlpDe n s;s) eumirpno4amenlncs (f rrau pnu4tltoiictaslm ul(vp t0arxoxrciatlp e nei s0s2umirpnodomtnlnei s s2rrurpoo0opx  iciaslsDemumsn()aetoxr iy1oa  aivs t t2uoio ny1optnmfvt t artmu  ou4teenii3iasla2ul(mpn()trtoif oadfmteau i;()teuoxrpoodop e ieslt srur(r ;u1oeeomiciat aDeauvont)altoxr io1omDr nvil( texo(mpoodll nmnvtasf Dta(  ;u4tpx mo3tyd s emuvont) rxnmr oy1fat ln i;t0trur(mpoo4ll nmivilt  rtr( oot1optomi3tat s2rm( ont4aexrxf3iadfa eau i s  rtoir3iudllt  iesls aDum(mo;o1aptn ieiad aDranvs;u4arermocio1fmDeau o;s  ruo(m oy1amt lfcsltf 2um(m no4optnif3ilt m2em( s u0 rerxo3oytlp e ues;t tetm(o oodope livil()a2tauronu0texoio3ildlmDrau o;t4texnxo3totfpDe neo ( truoim3no1lmtemieias)a2rmxr nt4teen ietatfs umn s;t0arenxr3iy1fatranei;s0 etoirpoy1aptemnvil()sDtaurooo0aptniictatla2eaump;(0 etnio oatlatrai i s0 2tr(rpoy1lmtelnes s  Dtm( pnt1tpt  i3ias mDemu on()trxoxo3iy1laDr ies;t trurirpoy4omeemieiasfa2ra(r ot4olxn fciydla2rl(vpn(0 etrmf oadfpte ivs;s0 2xr(rpno4altnlncilt) rtmxrp;u0texo o3ildls uauvpnt) lerxf3iytopDelnvolt0 etoimpny1op  lieiat aDrau pnt0oexn ociydlsDemump t0aetomf3ia1oaDrau olt s2tmxo ny4ale  ics t)sDta(r nu1aeto i3iys mDrmnmp (4 lxrmrcoa1op  anesl()t2trxmpny1omt mfvi tfaDrr(  ;u1opx  oeildlm2eanmo;(0alenmo3oatlmt auei;s)t2uoir ny1oltelfcsl()a2urum ;u4alen icilt s2emnmpnu)alerif3iodoatelu i ( trxr(opou1omtnmics t sDtmur no0tleomictad s2ra(vo t) exomrciodom rlu slt)s2tm(m3ny4oltemfct t sruaump;u0oex micias m umnmsnt0tltoxfctatlmDean o;s) rumxm oy4ol elnetlsf rrmu  ;t0olxniociltla2umnvo u)trtnmr oadlptraueil( t2xrxm oo1lptemici t)a2ua(  ot4tpeomieiltfa2eau o (4trxnirciotlp raivo t0srtmxrpoodll nlictlsf rurx o;o0oeeo f3iyd s2ean o t4 eerif3iadlaDrai i;t  eurxmpiydlm n fvs (fs2uaxrpno4oee mi3iad mDeluvs;u0 rxrif3oytom  an i;s)trxoirpny1opee ietatfsDurxm ou4aetomfciyd m umnmon(0alxnxf3iytfa  aivi;s s2xoir3nodlmenlnvias sDumxront4alx  fciyt a rl(vs;t0 exrxo3ootlp eaieo;(  exrxr3oodalen fviatf Dumxmpno1open f3ild mDrl( s t4 rxnir oydlaDr uvs;s0trxrxo3nudlm  lfctls)a2raxronu4tex  ociadfmDeau s (0texnxr3ta1latraivs;()teumxm oo1omtelnvsl()aDtr( onu1apt mf3iadlm2eauvs;() eerxr3iydlaDrauvo t0 rumim oo4apt  ietl(fa2ta(r oo1aet  feiadlm2umump t4 eeomrcoa1om r nvi t t2tmio3io1oltn fcta(fsDtmu pno1teeoiicildfsDem(vp (4aetrif3tytfmtrlnvs;()trto(mpnydlmt mnvt (fs2raumont0tpx  f3iytls2rl( s;()altomf3oodfaDrlnvols s2uo(opny4lptemnct (fsrrr(mono1alxomoeiat mDrmn p u)aeeoxf totfaD  nvi;t0teuoim3oo4lmtnlietls a2ra(r ;t1teenmi3iad aDel( o;u0altnxf ia1fpDelu s;s)s2xrxr iy1ll e ivilt) Dumxmpoo1opeomoeiatfm2el(vp;t4 leoio3to1la   iei;s s2to(r3ou1am   ivias) 2rr(mont1teeomfctas a uaumo t0altnir3ia1oateaivsls0s2umxopnodlme  fcs s)arurxmpou0apeo i3tytlmDrm(vp;(4texrxocootfa  aues;t setrxm oodome  feil( srrmum nu0tlxnio3iyt m rln s;u0teeoxo3tadfateluei s)srur(rpno4oltnmfctls) rumur no0opt ioeiltls uanmp;t0 eenxocoa1op   i s;s  2ur(r iu1oleemivtasfa2ra(rp;o1olxniictas aDemnvo;t0alerxr ta1omt lneil(  eumim3oodapte nct (f 2rrx  no4tetnmfciydla2uau onu)aetoif3oytfaD  ivo;t0s2xo(m iy4lpe livta( arta( onu1oee mf3iytfa rau p t0texnmrctodfp e uvo t0sexoir3oodlme mivi s)aDumumono0tee  ieiadlm rm(mon(4tlxoxf3iydfa  lnvsl(  eto(m io4ol emnvt t) Dtaur ou0aeenio3ildla2ran p;(4tltnxr iadfpDrlivs s0 exm(r nu4ole lfvi s)arra(r ou4tlxn i3ilsfa2eau o;u)teerxf oodopt an i t)seuo(m3oodlpenmfet sfa2uaum ot1ale mo3tldla2uauvp u0 exoxfcia1laDrli s s0srtmxopny1amt lfctas srrr(mpnu4oex ioctyd m rl( pnt0texoiocio1fat lu i s t2umir no4am   nvs t) Dumxmp;t0oleomieiatlm elnvo;(4alxnir3oydla eauvo;(0 exmxmpiu4ll emncs sfsrtmu  ou1olxnmoeiytls2ra( o;(4 lermocoy1opD liei;( srtm(mpnu4lmt lnviasf rtax  ;o1texnmi3tat m ulnvo;(0trtnxociytfp eanvi;t0trtrxr3oo4lp   fvta() rraur ;t4tex  o3iasls um( pn(4artoif3ty1lpD lnvolt)seuo(rpiu1lltelfvsltfaruau p;t0oltnif3tat aDeanmp u) eeomr oadoaDe n ols  ruo(m oodlpen ivtl(fsrum( pot1tpen i3iydlm ranmon(0 lxrmfcoydfpDeluei ()teuo(m3iodaleemnvta(fsDrmuro;t0aleomocilsfs2uauvs;t0arerircootfm   ieo;( s2xo(m3oodlleelnes ()a2rmu oot4alt  oeiadlmDelnmpn(0aeenif oatlpD an sls) 2toir iu4lpenlfesas)sDraxmoot4alto iciytlmDrm(mo;u0tetomocty1oateauvol()teuoxo nydaltnmivsa( s2tru pnu0tee  i3tas mDul( ont)trxrxf3oo1lmteluvs;t0 2trxmpiy1lp  lfct s) Dtrx pnu0alto oeiaslsDumump t) eermf iodomDelnesls) etrxo ny4opt mncsasf rumxronu0oexoiieiysla uanmsnt0arxrxo3todlpteln o;s) 2tmio3iydllenlnvsat) Drmum ot0oexomfciadls2ea( o;t) ltrif oa1lmtr i s;(  rtoxo iy1lp e netas  Durum ;o1alt iiciadlm emn p;() rtnir3iatlm r u o (  rxmxo3ou4amtnmfes s) rurur ;u4tltnioeiasls rl(vpnu4tlxoxr oo1fpt  ivsls0 rumxopno4omen net t artr(root1apxnioeiydfmDrmu o;(0arxomoctatopt aivol( setm(m3oodopee ncta(fa2tr(m ;u1olxo iciatfa2um(vpnt)tetomr iy1lpDrlivs ( seuo(o3iydlme mnvtasfsrum(r nt1aeeomf3iltls rlnmo u)aexomf iotlatelnvolt) rxrxo io4oltelfcsltfarum( pnt1ape moctatlm2ua( o t4trtrio iadoa  au o t s2uo(r iu4lp nlicslt srtrx poo1tpe mi3tld s umuvs (4 lxnio iytfp  auvslt s2trxrpiodll n fvi sf rururo;u1olen oeiytfm el( ont) reoxfcta1fmDe nvslt  rtoio3oy4alee nei t  2umx  oo1tee ii3tad s ranvpn()tetnir3io1om  aneils  euoirpou1ope mfvsls srtm( p;o1alx moeildfs2uaumont0arxrif tadom e ueolt0s2to(m nudoptelnesat)aDtau o;o0tpxniictad sDua(ms u)arxrif3iatom rai s s)tetmxr oydape mfctls  Drrxr ;o4alen feiadfmDua(mont)artoxr3oydfat li ils) euoxrpnodamenmies t)sDuaurpou0tlenmf3tlsfaDemu p t) ltnxr iotomDrlues;s)trum(m io4ome lncias srtmx pno0tptnif3tas m2el(mo ()aexnifciydlmD auvols)t2trxo3oo4al n nesas sDtm(m oo4apt  i3iysla2rmnvs;()tlxnirctadfmtrlivo;s)srxmxr3oo4omtelnvia( s2tr(ro;t1apto icias a um(msnu) rxnxrcoo1lmtrlieols0s2tmio no4omen fvi sfs2tm(m ot4tetnioctadla ranvo;t0 lerifctodoaDrlu i;(0t2um(mpiy1amtnlfcta() Drruront0texnmfctysls2rmnms;u4 etnir3oatlmD aueolt t2ur(r oudomtelnct s)srrm( p;t4tlx  fetytfs2ranvont4tlxrxociatopDrau olt  rurxmpnodop n fctatf rtrx pnt1tlxoifctyslaDel( ont) eeomrciytoa r iei s) 2um(o3oy1lp nmietlt)aDum(  nu4aeeo iciadlmDrlu s t4aleomr oadlp rauvi (  etr(o3nodomenlivsls)a2umxmo;t0oetomi3iltfa2elnvpnu4 ltomocoytlpt lu i;s) ruoimpou4op nmfvt ()sDuau p;o0tee  feiys m rmumpnu) ltrirciatfmDr nvils) 2um(o3iydlmee fvil()aDrmxmonu4tpenmfeiyt aDumump u)alenir3tytomteai s;s srtrio3iudlpe mfes s) Dtrxr ;u1apto i3ilsfsDuluvonu0alerifcoadlpDe uvs s0t2uoir3io1ol  mnei s) rrr(ro;t0aee  f3iltfaDra(vo;() lerxocta1fate uesl(0 2tr(o3iu1ale  icta( s2rrxmont4aetnmoeiydfa2rl( p;(4teeoxfcoatlpDe ivo s0 rumxmpio1opt  fcs t  2uax o;t4tpxoiietatfm2ranmp () renmf iydfa  luei;t) rxoimpoy1lpeemfcsl(f rrmuro;t1opx if3tytlaDuluvs;()tleoircoy1lp eln olt) 2xmxm iu4olte ncs sfaDrau  nt1apt iociltlm rlnmont4tltrio3oydfpteli sl( teurim ny4opeemnci s)artr( o;o4olxn o3tatfa eanmp t0 exoxfcoytfmt auvi;t0texoxo3iu4llte fci ( a2raxro;o0aee ifcils aDum(ms u)treoxf oa1oa eauei;s  rum(o3iudolenmnci () ruau pno1texoifeiad m2umu o;t)teeoiocty1fmt  ivs;() etm(m3oydamtn fvtls a2rax pot1oee moeildfs2rln s t4 etoioctadlm rai s s s2tr(r iu4lpee ivt t)s2rrxrpnu0teeo o3iytlmDra(vp u0 rxnmrcoydoptrauvo t seuo(mpoudope mfct s)srumum ot0aetnmoetatfmDumu onu4aexomrcio1oaDr u sls0seum(opoo4ol nlfesl(  rumum nt0opt io3tydfs2raumo u)trermr3tadlpDrli ils)t2trir iodlpeemnetls a2uax pou0oeeomi3ilsfa ulu snu)arerxo oydopDrln s t)texoim3nu1optnlfvilsfarrmxm ;t0ope  fctlsls2uauvo u)arxoxr3oatlp rli ilt0texriopnu4alte fcil(faDraum ot1tleomieiadfmDuan o;t) lenxr3oytomDe ueo (0trxmxo no4omeemnei t aDum(  nt4oexoiociydfa rau pnu0trtrxf3tydoatrluvi s0 rtmim oo1omtelfetlt)srrm(m ;u4oexn ictyd a2umumo (4tetoio3ta1fmDeli i (0trxrim3nu4lmenmncs s aDrmuro;u4aex  fciysfa2uluvp t0trxomf3ia1lm e nvils sexrxmpnodolt  fvsl() rrmxmooo4tpenio3ildla um(mo;u0tltrxo ta1latr n o;s t2toio oydal e ncsa( s2tr(ro;o0olxoii3iasfaDrl( snt4tetnmrcoo1lmteaueslt0 ruoxmpoodom e icta() Draxrp;t1aptomoeiytlm uauvo ()tltrmo oatfpD ln o t0seuriopou1lptn fcil( a2rr(r no1apeo oeiasfa umn p;()aeermf oydlat aiesl()setr(rpoydaptnlncs t srtaumoou1tlxo ietatfm2eaums ()aetnmo iotfmtrlieslt)texr(opnudopteliesat)aDurumoot4aleoio3iyd mDeluvo;t) reoir3io1omtrlnes;s)s2xoiopou1olenmncs ( s2rr(mpnu0openii3ilslsDumn p;(4 ltomo3ootlatrlu o s)srxmxm3ou4ll   iesat)s2rm( p;u4oetnii3iat m2ra(mp;t0artnifcoa1omDeauvo s  2xo(r3ou4lmtnlfei ()srrrur oo1tetoiictadlmDrmuvp ()trenmf iotfaDrlnvsls)sexoio3ou4ol  mieil(faruax ont1tet  fctldls uauvo;t4tlxnxr3ootfa e i i s) exmxr3iu1altnliet (fsrum( ont0tptn i3tyt s2rmn sn(0tetoxociy1oa rlu o ()texmir3oy1ll  mfctl(f rrrxrp;u0open f3ilt s2eanvpnu) etrxo oydfm eaieil()t2urxr3nudllt  fvt s sDuaxroot4olenifeiysfa2rmnvp;u0altrmo iytfmDelneo s)seur(o iu4ame lnes s  Dtrumo;o4tlt mi3ils aDelnmo u) etoxr3ty1lateli s t  2urxo3no4ap e nvt ( a2rm(  ;t1apxniociatfs2ra(mont)tltnif3todlmDeanes (0 etrim oudol   fcil(fa2ua( p;t4tlxniociysfs rln sn(4tltrifciatlp eauvo t)t2xoio nudlle mncta( a2rmu  ou1tpxoifcilsfaDrln o t4 rtnxfciotoaD  nvils)tetr(r iodll  lfviltfsDrrumo;o1aptomo3ildlsDum(vp;t0arxomo3tadfmD ai s;s)t2xrio3oudame licil( aDum(mp;u4oexnmocilsls uauvp u4texrxo ia1oaD livs;t)srur(m3io4lmt mfctls) 2taxrpot1oltniieiadfsDemuvp;t)trxrmr3tadfm   ieols)t2umimpnudoptn neta() Dtaumooo4tlxniociatls eauvpn(0aexoxr iytlaDe uvols0texmiopiy4lp nlfctat)sDur(rono1tpxnmociyd m eanmp;u4teeoxocoytfaDeln olt)srtoxrpiu1ol nlneias) rrmumpnt4tex  f3iltlaDulumon(0altrmf3oadopD  ieilt)s2umxm3iodaptnlivtl( a2tr( o;t0opxnioeiat a ran pnu4 rermfcoodfmt aivo t  rtmim3oy1omen iesls) 2rmurooo4apx mo3ildfaDea(mpnt)treoifcta1fm elieo;(0 2um(o3oy1lpen ncsl(farta(rpnu1aet  f3tat aDeauvp t4 exoxr3oatomt  nvsls s2umim3nydlle lfci sfaDtr(m ;o4tlxn iciltfm rauvp;t)aetnir3iadlatrln s s0teuoio3ou1opt  nvtas) rrmumpoo1alx  o3tasfs2rluvs;u4 eerxo3totomDraiesls trtm(o no4lmtemnvs ( s2urxr ou4tptomo3iyd aDeanms;(0 lxoxocoadfaDe uvo;()s2tm(mpoy1altnlnes (fsDum(m oo1alxo o3ild s eanvs;t4aexrxrciodfa  auvils0trxm(m3iy1llt  fctl( a2rru  ;u0tet moeilt m2uan o t)tltnxfcoydopDr i i ( seumxo io4lleemnciat)srumxm no4ale  ociyd m emn o u) rtnxr iydomD  ueo ( trxrxrpnu4ape miet sf Dtm(r ot4apx mo3tadla2umn snt4trtoxociotoa eau o;t s2uoxopoydlmtnmivsa()sDtaurpoo0optoioeiyt a2um(vo;u0trerxfctydfaDe uvols0t2tr(mpio1ap e nci () rrmu ont4tet ifeilt a2emu p;t4trtrio ta1faD ln sl()s2um(r iu4ap eliesl(  rur(mooo1aexo fciatls2ua(mon(4 eeomfcoy1lp e i sl()t2trir3oy4oltnmfvta(f Dumxrpno1tlxnmfcilsls raums;u0trenxr iodlm  li s () 2xr(r3nu1omt lictlsf rta(r ;t4ale ioeiatla2um(vp;t4 eeomf3iodfp rliei ()srtm(o3nu4optnlncta( sDtrxmoot4ope mo3tltls rauvs () etnio oa1fatrlu i (0 2xoim3oo1lpt  ietas)a2tr(rp;o4oexo i3iyt aDumuvp u0 rxnmfctotlpt  uvi ( teumio nydll nmfet t)srrrx  ;u0oexo ocildfa uan p (4altrmr ootoa eaivol()seuoxopnu4lmtnlfvsas a2rru pno4aptoif3iydfa umnvp t0alerxfcta1fat livi (  euoim3iy1ap e ici () rtaump;u4optomoetyd m eaums (4alxrmf3iy1laDraneo (  exrxr3nodolenmnvtlsfsDtaurp;t0olen ocilsls elu onu4 rxnioctadlaDranesls0sruo(mpio1llee nvsa(  rurxrpno0alt  oeiys m raums;u0aleoxo3io1fatraues t)srtrxopiy1oltn nvtas)a2rm(roou4aetomo3iatls eln s (4tlxrxr3tatfpD  neo;(0trxmxo3ou1optn nei s  2tr(  no1olxnmfciyd m um(mo;u)teermf3iytlaD an o;() 2xr(r iy4lptnmfeta(f 2rrx ont4ape ifcild a2eln o () exnif oadlm r ies;t) 2urxr3oodameelics tfsDta(roou4oeeoioctlsfs2um(vp (0 rtnxo3iy1fm eli slt truo(r oo1omenlict sfaDta(r nu1opxnmfeildlm el(mp t)alxnxr3oydlp  au i s t2triopny1openmneslsfsrtru  ;t0tltomf3iad a2ul(mo u4arxrxo iotopDraneo t0t2xm(m3iodllee fesltfarrm(  ou1tpe ii3tldfa2rl( o (4tltoxr3io1fa elnvo;t)setmir oo1ame  nvs () 2rrxm oo1aex mociadfmDra( on(4texrio3iydfa  lneolt0 2uoxm3nu1op  lnci () Dra(r ou0aexniicildlsDumump u4 ltrxo tatlmD aneo;() rtoxo iy4ll nlivt sfsrrmx  ;u1oleomietat sDuau s t0 renif3iytoaDeaieil(0s2toxr3ny4amee neiatfsDtrx o;u0aptn oeiltfa umums;(4aleomrciadlaD ai ils)tetr(o io1apee nvslsfs2taum ;o4oleomictat sDrlu snt)teerxr tadoatrlu slt0trurio3iy4ol emictl(  Dtaxr ;u1tee mfciasls2rln s;(0tlxoxociodlpDrauvo (  rxo(o oudll  mnvia(f Drm(mp;t1aeen i3ilsla ranvo t4 renxfcoydlmD  nes t)t2urio3ny4altnmncia()srua(r no1tpenifetydls ulnmp t)arxnmrcio1fm eln o;s  rtmir3ny4optnlivsa(  rraxrpoo0tltomoeildla2emnvpnu0altoxo iy1fm eln ols)tetm(o nu1ol  mnvt s  rrau oou4ope mietytlm2ul(vo u) rtnmociotoat liesl( srxoio3iodlme mfcta(  rta(  ;u0aexoifetltfmDea( onu4 eeoxrcoodlp  aies;t s2xoir3iy4lp n feiltf 2ta(  ;u1aetomoctytfs rmuvo () lenmo3oy1faDe ivs;()t2tmxopno4lmtnmfvsl()s2rrx pot0apxnmoetytla rmnmo (0texoxr3iodoa r ivs s0 2xo(r3iodal e fcilt a2tru  ;o4opxn feiys a2em(mp (4 ltrir3iatfaDeai i () rtriopou1ol  mieta(farrrur ou1aet  icild a uaumonu)tltnif tadlmD lu s;s) 2xoio oydolt lnei s)sDrrur ;t1optnii3ias s ua(vo;u4treoio3oo1la   n sl() euo(mpnu4opt mnesls a2umump;o4olx  fciytfsDea(mp t0 lxomf3ta1opDr n olt seurim3no1am nlfet tfsrraxrooo1apt io3iad s umnvo t0texnmocoodlaDeauvo (0 rxmiopnodlme lneilt)aDumur ou4opeo feildfsDrmuvo t0 ltomr3oytfpt an s;s) exrxrpiydal   ics sfsDtrum nt0ole micias a ra( pnu4aleoif3tydfa eaivsls0srxo(r3oo4lpee fviltfaDrm(mpoo1tlx iictytfa ea(monu)aexnmf3ootoatranei;()srto(opny4op   ncilt  2uaxmpot1aeeoifcias a ul(vp;u4tlxomr3oatfmtr i i;t  exoxr3iy1lle  fvs s)s2uauro;t1oltomociad mDrm(vs;u)arermf3to1omDeaiei;t)tetr(o3iodaptnmfesl(fsDrr( ooo1aeeo ictlsla elu s;u0trtoircoytlaDran i;t0sexmxr3iy4lme mieilt artaumono4apeo f3ildlm uanvs u4trtnio iydlmDr ies t)s2xrim iu4ope  iesa()arumxr ot0texoioeiydla rau onu4aexnmr3ia1op rlies;s)trtmxmpny1ameemnet (  Drrxmono4tex ii3iydfmDul(msn(4aexnmo to1opt  nvo t0t2uo(m3ny4aptnmivsls)s2raxmo;t1aeto oeiatfa eln onu4tetomo ta1om eaiei;( srtoxo3iy1aptemfes s) Dtrumont0opeomf3iytlsDuaump t4trtrxf3oadlpt livol()s2uoim3nudamt mneiat)s2uaxmo;o0olxo oetat s2rluvont4trxnmfcio1lm r nes s t2urxopno4ll  mieslsfa2um( pot0oexo fcias a rm(mp (0artoio oodomD lnes t)tetmir3no1lpenmictlt a2ra(ronu1oeen ieiatlm eanmp;u0 etomfctatlmDr n o;s0sexrxmpnodlm elnvtls a2tr( pnu1ope ii3ild a2ul(ms;(0 rerio oy1fmD aivo;s s2toio3iy1ap nmiesltfsDraumpnu1aleomoeiyt a rln s t0tetoir oatomt  n i (  exmirpiu1am  lfvtl(fa2rrxrpnt4apx ifctadfmDrlu p;t0 etnir ootlat aivils setm(rpiy1amtn nvi () Dtm(ronu1aex ioctydfsDrlnvs ()tetrxf todomt  ivol()teumxr iodlp  mfes t)srrmu o;u4alx  f3iytfs2rluvp;t) exrxrctatomD  ieo;t) 2uoxmpoudlpee nei (farumumpou0aeto ieiad sDrmumonu)tlxnmo3iatomtelu ol() exrxm iu4ale mfvt s s2rax p;u4optomieiys m2umn o;u4 eermr tadfp  aueols)s2xm(o iudam n ivtlt  rrax  no1tlen iciad a2elnmp;u) lxoifciatoat li o;( trxrxmpio1ap elfvtlsfs2tm(r oo1aeen feiatls emumpnu4 rxnmocia1lpDraiei;t t2urir oydlmen icil() Dra(m ;o4ale  i3iatfs rl( ont4aetomo3oydom r ueo ( texo(o iodaptnmneiatf rtaxmoou1tpx  fciydlm ulu p;() etnxfctotopt  nvs ()seum(mpnydom n ieia( sDtr(mp;o4oet ifetadla2rm(msn()tetrxf oydoaDrau il( teumxmpnu1lle mici t)s2rmxmo;o0optomocias s2ulums ()artoxfctytlpDr nei t0 euo(m oy4lmt  nesatfs2rm(mo;o1oltomociad s em(vp (0texomrcia1fa eauvo;s)texoir3nudop n fetas)s2tr(r no1apenmfeiasfaDua( o u4tetoxo3iydfm e iei;s)srum(m3iy1alt lnei s artr(r ou0aexnioetld m2rm(vs;u4 etnmf3tytfateauvs (0 etrxo3nydaltelfes t s2uaum oo1openiiciysfa2ra( o u) reoir3oatfpt livils)seurio oudlptelnei (  Dra(m nt4olen o3iadfsDelumsn(4alerxo iotoa elieilt  etriopiu1amt miesas aDur(rp;o4apenmo3iatlaDrlump (0arxrxf oa1laDelu o s trurxopiu1lpt mnvils)s2tmum ou0oltnif3tad s rauvo;t4alerif oytoatr ieo t0 2umirpio1olenmnci tf rrru  nt4tlx mi3iyd sDulu p;u4 etnxf iatoaDeau ils0 rxmimpiodomen ies ()sDumu  ou1tleoifeildla rmnvsnt4trxrmo iatlmt  i s (0seuoxmpou4lmtnlnesa(farrmx pou4tetnmoeildfs rmn s ()aetrmfctadlpD  nvo;t) 2tm(mpny1ol nmict tfsrurumono4tlt  i3iasfsDrlumo;t4 rtomfctotomtrauvilt)trxoxopnu1om e ivil()srrru  no0oexnmieilsls2emumo;t0teerir oo1fptrlu i (0 etr(r iu4am elicsas)s2um( pou4aetn o3tyt mDranmp;t)tlerir tytlmDrlivo ()s2xo(o3no1altn nvi s)s2trx pnt1oex ioeiytfm2emump;() reriocto1lmDraueo;s)s2tmim iudlmte fctl()aDtaxr ;t0tleo icilt s2rl( p u)trtoiocoadfmt anvi;(0 rtmio iudam   icsls sDrmur ;o0tpx  feiatla raump;t0teeomrciytoateluvs s srxr(opiy4alt  fctat  2tmum ;o1opeomf3tld a el(ms u0aexrmr3to1opDeauvo s0 2xoim no1omen fet t  2rmxrooo1tptniiciltlsDrmnvp;t4tlerxfctodfa eaies;t)srurxr oo4op elfeta() rtr( pou0teeo i3iadfm2ul(monu0 lxnmf3oa1om rln i;( srtrim nu4lp elnesl( aDuru  ;t0optnifcilsls rmums ()tetnir3tytla rau il()t2um(o3oy1om  lnviat) 2rrurpot0apt if3iatfsDra( pnt4 eeomo oytomD au o () euo(o ny4amtnmfesl( aDur(mpnu0tlx moeildlm2elu s;t)altnxf oadfmt  nvi;( trtmio3nodomt mict ( aDra(r ot1aex mfcild s ul(vpnu)altrir iy1lmDe n o;s)trurio3ny4apen neia(fa2taur ;u0tlt iietatfaDumu p;()alxoio3to1lmtr ivsls0tetriopnudal emfesltfsDurum ;u1oet  oetydls2rm(ms;u4artoir iadfp eanes;s0setm(opnudalte icsls artr(mpno0ope moetltlm2rlnms (4 eenxfcoo1om rlnvi;(0teuo(r3iydlmenmiet s sDtm(mpoo4tle  ietlslaDrlu onu0texomf3totla r n ilt) 2uoxmpnydop e ici t  rrm(m ;t0tpenmoeiyslm2elnms;u)arxnmr3oo1lpte i s;s  eurio ou1am n ivs tfarrmx  nu4altoio3ilsfsDra( pnt0artrxo oadlaDeaies s) 2xo(m oodopenlici t srrax p;o0aex iociyt a ulnmo;u4alerir ia1lm elueol(0 rumxm ny4omeelfci s arurur no4altomo3iytfmDum(vp (4artomo tatlatr nvilt0 rtoxo3iu1ap nmfeslt a2tmurp;t0opxo feiat m2elu snu) lenmfcta1fpDr neilt  2xo(r3nu4olenlfei t  2ua( ont1alxnmoeildls2umumo;(4aexomfctotoat  uvi;(  exmxm nu4ole lfei t sDtrxm nt0tlto fetlsfs2ra(mp (0 rtoxrcoatlpt au o;s srurxo ou4ome  ncsatf rta(r nt0teto ocils a elnmonu4tlenxrcia1oaD  ivsls0 rurio3oy4llt mietl(f 2urxrpot1olt mfetaslaDrlu p;()tlenxrctatlpD  ieol( t2um(opoudoptn feias)aDtmx  ou4alxoiocilt s ra( sn() rxoio iydfaD au ols0texmim iy1lm elneiatfsruax pou1altomieiyslaDumn o t4teerir3iydoptranei;()tetmir oydap elietas srumu pou1aeeniociydfs2rl( o;()trtrif3oo1lpD lnesl()srur(r3nu4oltn ivilsf Durxr oo1oltoioeiadls eauvs (0alenxoctotfmD  i il(0 ruo(m3oo1omtnlncs () Dumum oo4tlxnioctydfs rln s;(4tltnmf iydfpt  uvsls t2xo(r3ou1lptnmfvsas)sDrmxmoot0tetnmfciydfm2rln snu0 rtrmrciodopDeanes t)trum(m oudaltemictls  rrax onu0altomoetlslaDemn o;u0 rxomfctatlp rauvslt texoxopoodope mnvsat)aDtmu ooo4oltomfetys mDum(mo;u0teenxr3iytoatrauvi ( sexo(m3oo1lpeelncs (  Draxm no4tpx mi3iysfaDra(msnu0aetrxr3ty1omtelivo;s0teurxo oydlmenmnct tfsDrmxm ;u0tlxnif3ils sDeanvs;()trtnxociadfatrai i ()t2trir iydlltnmivt tf Dum(m ;o0oeeo fetys sDrm( p;() rtrxr3iatlm rlivslt)trxmimpnu1lmte ncslsf rtm(rp;o4oleomi3iytfaDuluvo u0aexoxrcoytopteaivsls0tetrxo io1ol nmneiat  rtm(rpoo4alenmociytfa2ul( p u0teermr3ta1lm r i sl(  rumxr3oy1ol elfvslsfsDra( onu1olt iociad m2rm( p t0artomf oa1la elnvol(0t2xoim3ny4llt livsl( s2ua(m ot4texo i3iltlm2ea( s u) rtrxoctodopDr i s t  2xr(opno4ale lnvta( aDumx o;t4tle ifeiltlaDrmuvpnt4treoif oa1lmDeluesls0setmxr ou1lm nmfesasfarta(rooo4oexnmociat sDrl(vs;(4teerio iydfmteauvo;()s2um(r iydllenmnetltfsDrrxr ot0aee  ociaslm rau pnu0aetrmr3iadoat  nei ( s2uo(m nu1op  lfci ( sDum(mo;u0apt if3taslsDrlumo (4tlxnmo oadlp eaneo;s)srtrxo3oo1ole  nes s s2taump;u0tleo o3tat a2rlu pnu4 rtoxr3oatopteaivo;() 2xm(m io1opt  fviltfa2tm(rpoo1aleo f3iasfmDeau pnt0alerxo3io1lateanvolt)texrxmpio1ol  lies s)srrauront4altnmociytlmDua(mp t0aetnmf to1optelivilt)t2umxm ou4llenlfvtatfa2uaur ;t1tpx mf3ilsls2el( snu4teermf oatfp e uvs;()srtmxopiu1alt  fcsls)a2trumpot4tlxomfctadfa2umnvp;t4tltrmo oy1oaD aivs t)sexo(o iu1oltemnvtl(fa2ur(mono1teenio3ild m umuvo t0trxnif ootfmD aneo s0tetmir iydome mfctls)aDurx poo0tex mietydls ulump t4artrmrcio1fpDrai olt s2tmio ny4ol nlnctls)arum(mo;u1tpxo f3tatfaDemn o t4 rtoio3tydlp  an s;t  rxrxmpoodapee nvtl( a2rrum nu1tex moetltfmDuaumo;t4aeeniocoatfat luvo;t trto(m iy4alt liviltfs2rmxrpnu4opeoifeild a2ulu o;(4trxnifcoydlptrlivi;s texm(r iy1optnmnvslt) Duax  nt1olxnifcils a uauvo u4aeenmociatlmDeanvo t0tetoimpiydopenmfeil( aDta(m oo4opxn fciatfmDrmnmo;(0 lenxoctydlp r n il()teuoxmpou4optnmfeiat)aruaxronu4oet  ietad m2uanvs;u)teenif tytfate n i s0trxrxr3no1am emfctlt) rumxrp;u4teeoiociatlm2emnms u0 exrir io1om rauvi;t  exrim oodal nliet (fs2rmu pou4aexoiieiys s2ul( p (4teermr3todoaDean o t)s2xrxo iodal elnvtl(f Drrxroou1ope mo3iasfa2ean snt4aeeomr3to1la   u i;(0srxmiopnodoptemnvia( srrmurpnt4tle  feilsfs2em(msnt0 rxnxo3iatlm r nvi;()t2xoxo3iu4lp   ivsls  Dumu pnt4altn oetys m2um( s u4artoirciatfm e n ols0trtmir iy1omeemfes () Dururo;o0texo fciysls uaumo (0 ltnmf3ty1lpDranes;s  rur(m3oudoltn ivil() rrrump;o1optomf3iytfsDrl(vs ()alenif3oa1fm r i o;(0trxr(mpiu4lpenmfvia() rtaxmpno4teeomoctas a2uanvpnt)alenmrcoy1fmt ai o t0 2umxopno1lp nmnvi s s2trxr nu0tpeoifctytla ra( sn()tetrmo to1oa e iesls0s2tmxmpnodopeemfvsas)sDtauront4tpx ifeilslm2umn s () ltomr3iydfpD aieo s0 etr(m oodame mnctat  rtm(m ot4opeo octasfmDelu o ()tetrmfcty1faD ln o;t t2xr(r3ou1ape  ivt ( a2tm(ro;t0ole  fciatls2ranvsnt4tltrxo oytlp   nvsl(  rtmxmpnodal   ncil( s2rmxm ;o4alx micildls2ua(vp (4 rtoircoo1oat  nei;(0 eurxr io4ll nlietl()arua(r ;u4opeomfctad s2rmnvp;u) eeomr iytomDe ueol(  2xoxo oydolt mfesa(faDtax ono1opt mfcild mDuaumonu0 exrio iatlp eluvi (0 exm(opnu4lle  feil(fsrurxm ;t4oeto feils m rmump ()trxnir3tydomD aues (0trtoir nu1ll nmnci t)a2rrumpou0opeomietysfs umuvo () exoxocoadlptr nes;t t2tmio3no4lpe lfvt (fa2uau p;o0tleoifetydla2ean o;t4 ltrmo3to1fmDelueo;s)s2tm(rpnydamt  ivs (  2tmum ;o0aptoifcilsla rmu pnu0alxomr3oydoptr n o t  eumim oo4optelivsas)a2rru ooo0aet mf3iys m2emuvsn(4alermrctatfmt aivsl() 2tr(mpiu1lp elncslt sruaxmooo4oetomoeiys a ranmp t0 rtnxr3oatlpDrauvslt texm(m iu1om elnei s)s2rm(rooo1olxn oetadfs ranvp;(4 etoif3io1lm  livo;s s2xmxopoydomtemnvsatfartau pno1tptnmfcils m2rmums ()tlenifcoodfa eai o;s)sexoiopno4optemnvs (fsDumxmo;t1tpe mf3tad mDel( snt)texnir oydfmtrlues t)trxmxo oy1am   ict sfsDta(r oo1tee  fciys s2ulnvp u0alxoxr3oo1faDelivols)sruo(o iu1lmt mfcsat  rrmum nu0tpenmo3iydlm2elnvp;t)tltrxf tytlm  an i t0s2toir ou1ameemncsl(f rtrx oot0tpt  o3tasls em( snu)tltoir3iodlaD  nesl()t2xoimpiudolte icil(  2um( pou0tltomf3iasfa2um(vs (0arxnmfcoo1latrli s;t)t2toxo ou4aptn fvt () rtr(m ;t1apt mocias m rmumpnu0alerifcty1om r n ils0 exoxo io1olt lnvi ()sruax pou0tltnmiciytla2ea(msnu)aetoxocto1lptrlnei;t0s2tm(rpoy1amt mnvslsfsrrr( ono4tpeomi3tad aDrm(mo;(0tlenxo iy1om r i ilt  exrim3oo4optemieils)s2ta( onu1apxo ictldlm2eanms t0 eeomocoatopte nvs;s texmxo oodameelfctls a2trx pno1olt mo3iyd mDeluvont0trxrxrctatlm  aieo;(0 2umiopny1ole mfvta(f 2taxmp;u4alx  f3tyt mDeln o;u)trenif io1oatraivilt  2xm(o iydlp emnei s)sDtmx pot0aet  ictydfs2ul(mp;u4aetrmocoa1fp eluvs;( truo(mpou1lpenlfetas) Dtrxrono4oeeo o3iadlm2rlump t0 etrmfcta1lp eaiesls s2to(o3ou4ape lnctlt)srra(rono4olxomfctldla el( p;(0alxoif tytlaDe nvils0s2um(opou1llt mfviat)a2tmur oo1oltn ieilt a umn o t4 rermr tytlpt luvo;t)texrim3iu1llte nesa(f rrrumoot4oleomi3ildlsDeaump ()aetrxo oa1opDrlnvol()teurir3nudaptelneslt a2tmx pot1olxnifetydfm rmn p (0 rxomo oytop eaivs s0tetr(rpou1om emiesatf 2rrx  no0aex mi3iydlaDumnmp u) etomo3iodlaD li o s0t2um(m oudomenlfvtlt s2tr( o;o1tpt io3tytlm rl(mo (4 lxrmr oadopDeli sl(0sruoxr iodll nliei t artrx  nu4aptnii3iatfa ea( on(4aleoxr3oadlpDeln o s0s2tmimpiodopeelncs tfsDra(monu1openiiciadfsDrm(vo;t0altnirciodfmtrai s;s)teurxr io1alt  fciatfarrax  nt4oexo fciydlsDemumont0aeerif ia1oa   ues s trxoio3iu4altnmieiasfarraxmo;u1oex mictas m2rmnvo;t4teerxr iotop  lu s;() rtmxr3oy1lp nlictat aDra(rono0tee  i3iad a uluvs (4 ltrifciotomte ivs s)srtr(rpoo4lm e icsasfs2uaurpou1teeoifciysfm ulnms;t) etnmrciotfa   ivi t  2xm(m3iudom e fctls sDrr(rpou4tet ifctlsfsDelumont4 exnmf3tadopte ueslt0tetoxm oudlp nmnesas)srurxroot1altn feildfs rauvp (4 exrxo3ta1lmt  u ils s2xo(r3nu1lmtelici s) 2tm(m oo4aleniociatfm2ua(ms;(4artoir oodlp  aivi;s0t2xm(mpno1optemfeilt) rum(m nt0aeen o3iyt s umu s ()alerir oa1lpt ln s;t) etoir3iy4lptnlfeias) rurxm ;u4teenmieiysfm ranvs (4aetoxr iotfpDr u il(  euo(r3iu4lmtemicta(faDraurono1tpto oeils s umu p;(0altrif3oodlpt an sl(0seuoir no1ap emietltfsDur( p;o1oet iictydfa ulu p;t)treomo tadfaDe ivi (0 rxr(r3iudoltn fcias)aruaump;u1alx  oeiydfs2uanmo;t4aeerxfcty1fpDr u s s0 rurxmpiu1llt mics t aDumxmp;u4tpeo iciasla2emnvo;t) lxoxr3ia1omD an i;()texr(r3oo1lptemfct t arta(  ;o0aet  i3tlslmDrlump ()alxnmo iatfmteanei t  2xoxr io1apen nei s)s2rau pou0oeeoif3tydfaDem(vs t4 eeomr3oytfaDrlu ilt0 2toxr nudlm nlfet () Durur ;t1ope iiciadfsDum( p;(0tltnircio1oaD  ivslt)trtoxr3oudop   ietat)a2tm(mooo1teeo oetytfa2uau o;u4trtoxo3ty1om e uvi s)trtrxr no1lpte fvia()aDtm(ront0optn ieiad s eanvon(4 ltomf iytopDrluvo;s)srxr(opoodlm   nctat  2tmu pou0alxnmictyslm2uln on()alxnxocta1lmtrlu o;t sexoxr iy4alenlfeilt) 2umuro;u4tptnii3iyt m2uauvo t0 reoxoctydfmte neo;t0tetmxopoodll   ivta()s2tru o;t1tpx  o3tadfs em(vp;t4arxnmo3iadlpDrlu ol(0 eum(m nydopenmnet sfs2rru ont4aetniietldfm rau pnt4alxriocia1opD  n o;s t2umxrpiydlmee fcs tf Dtrum ;o0aexnifctysfs raump t4 ltnircto1lmDr ues ( s2urxrpoy4oleelivta( aruau p;u1tpxnmiciyd s2umnvo;u) leoxfciodfpteau i t s2ur(mpoodlmen ivi tfs2rm( o;o0tltnmfeiyd s2ra(mpnu0aetoir oytla   i s t)setoir3nodamtnlict t  2tr(m ot1oexoio3iytls ra( s;u0aetrmo3iydoa rln s s texo(o3oodll emneslt) Dtrumpno4aptoif3iytfaDranmo t0trtnmr ta1lpDraueo t truo(opnu4oltnmnci t)arrmxr no1opx ifciyd m ea(vsnu)tetnmo3oatopD au o t)s2xmimpou1omte ncilt) rumur nt1tlxn oeiadfs ua(vsnt)trtrxocoa1om   ivo t  eumxrpnu1ll   ncias) Drrxr ;o1tlt moetldla ranvp;()tlermr iatoaDeauvo s) 2ur(r3oudopeelnctl(faDrax poo0apx  fciys s2eanvo t0aexrxrcoadlpD livo ()texr(m3oy1olenlivsl() Dtm(mpoo4aee mf3iltfa2ra( s u4 reomfcty1opt  nesl( setoir3ou1op n fvs ( s2tmu  oo1tpx  f3tytlaDelnmonu)aleomocto1lat lues;s trur(m iy1omt  fvt ()s2ua( o;u1texnmoeias m raumo;u0altoir iytfptran i;s)s2trimpno1aleemfvi s)s2tmx p;u0texo feiyd a uau o u4artnmfciydfaDr uvi;t s2toim3ny4lme  nes (  2rru o;o4opxoioeilsla2um(vsnt0 lenir3oa1omtrau o;t0 rum(opoodameemnes (f Drruroou1oexn feiytfmDrmn sn(0alxnmr3totfpt anvs;t t2xrim3iydlp  lfei (f Draxr nt0tpt moeiysls emnvon(4artrmfcoytfat ai s;s0 exmxr3iudaptn fet s) Dur(mo;t1tpx  f3iydlsDuau snt)arxoiocoadlp r i slt)sexrxm3nudoltn fvil( a2urxmpou4teeomieiys s2umu s;() lermocty1lp ean o t seum(m3oy1opt mfciatfarta(ronu1olx mo3iyt a ul( pn(4treoir3iydfmt  ies s)seuo(r3nodlpee iet t  rrm(root4olt  oeiydlsDumnvpn(0 rxnmf3iodlp rlu o;()trtoxr nu4altnmivi s  rua( pnt1tpxo oeildla2um(mp () exniocoydlmtelnvil(0s2toxm io4lptnlnvslsf 2tmu pnu1aptnmi3iyd m rl(ms;u0texrmocoatlpDrluvo;s) rurim3oydlm nlfvtatfarum(rpno4aeeo ieiytls um(mon()aleoir iodlpDeai o;( trtr(r3oo1llte nviltf 2trxroou1oee iieiytls2el( o u)alxomocto1fm eau i;s0sexoir3iu1lmtemietl(fsrtmu  no1opx mfetysla2em(mo;t) reniociy1fmtelnei;(0sexoxmpnudamen fcta(  rraur ;o0aleoif3ilsfa2elump t0trtoio oytla   nes;t trtrio3iodome lfvi s)srrmuront0oex mo3iydfa rmn pn() lxrif oo1fmtraueo s)t2xr(o3nu4opee nct t sDtrxmo;o4optnmi3iys a rlu pn(4areomrctydoptr uvi ( srtmim no1lp elfesl( aDraxmpnu1oetniietlsfm eauvp t) lxnmocoadfat  uvilt)t2to(opiy4lptnmictl(  2raxrpno1oex mictytla ulu o;()tlxoir iodfa e i s;t  rtoxopno4olen feta()s2tmu  oo1altnmicias aDemumo;t4trtrmo ty1fpte nvo t s2tm(o iu4om nliei (fartaxmpoo1apxnmocildfmDean s ()trtoxr todlat  n slt trumxr iu1lle lfct s  2rm(m ou0alt ifctyt aDulu on(0arenio3oy1fa rlu i s)t2uoxo nydomteliei sf 2um(mpoo4tpxniictytlaDem(vsnt0aeeoxf tydlpD li slt)truo(o oy1lmenmieilsf ruau ooo0alto f3tytfa rlu pn()aeenmoctytlat aies;t texrir ou4alt  icslt)arrmx o;t1tet iociyd a2uanvo t) rxomocoydlm r u s s0t2umxrpou4alenmieilt)aDtaumonu4oee if3iltlmDeanmont0 rxomf3iy1opD ai o;s0s2toio iodlme lieils) ruaxmpou4teeomieiytfsDra(vsnt) etnmrcio1omD livi (0 rtm(opoo4lltelies s  rrax  nt1apeomociyt sDel(vp t)artoxocty1fpteauei s teuo(mpno1lp n ics t)aruaxrpno1alxomietltlaDrm(vo ()tltnifciydoptrlnei s0setoxrpiu1lpt lncsls  Drmxm nu0alt io3iyd a2umuvs u)aexnmr tatfat li o;(0 exo(o iy1aptn fcsas)srrr(rp;u0ape mi3ils s2emuvo t4 ltrxf3iy1laDe ueo s0 2uo(m3iy4apenlnetls) 2umu  oo1tpe mo3iytls2umnvs;(4aetnifciodfmt auvil( trurxr ou1omen nct tf 2umu p;o1tpx  o3iydlaDulnvo;u4tltrir3oy1lptr ies ( t2to(rpoodaptnmfvtl(f rrrur ;o0olt ifctlt mDulu s (0 etoio oa1fm   i ilt0t2uoxmpoy4lmeelfesls  rrau ont4aexnii3iasfsDranmpnu)trerir iadlpDr uei s) rtoim3oo4alt lnvsls s2tr( pou1aetn octys s2um(msnt0altnioctotoaDeaivols)setoio3nu1lm  mnesl(fsrtaurp;t0tetn oetatlsDulu s u4tlerxf3oo1fp eluvo;t)trtoxr3no4am n fciasf rumumo;u0tpx  ieiatlm2em(vs t4alxrxo iy1lptranvi;s0srxr(m iodlle lnvt ()sDtr( oot1oltomfetls m2rmuvs u0trxomf iytfa  luei;( trxo(m iy1opte icsas)s2tm( p;o1apto oeiyd s2ulu snu0teeoir3to1fm rai o;t) etoxo3io1ll   fvt t aDta(mpot0alto octytlm2ua(mo;t0aetrxf oadfaDrlueslt0seuoxr3no4olt mnetas)a2tm(mont1opxo i3iytfsDum( pnu)trtnxr3iy1lmDe n s (  eumirpnudalenmicta(fartm( ooo4altnmo3tld s2elnvs;t0arxoir oy1latraieo;s t2xoimpnydlp nmneils srrm( o;u4tlx ifctls mDul( p;(0tetoifctadla rauvsl(  euoxr no1aleemivsl() Drax  ou0opt ifciys a rauvsn(4 eeoiocoo1opteauei;(0s2xoxm oodal e ivsltf 2rrx ooo1aexn ieiadfs em(vsn(0 etoxocoadlat lies t  2xr(mpiu4lmteliesasfsDtru pot1aexoifctlsls ulnmo;(0alxrmocoy1lpD  iei;t0 rurio3oy4lme lfcsa(faDtmxm oo0aeeomo3ias s ulu pn(4arxnxf totfm r nvi t0t2uoxr3nu1lptemfcslt  rtr(mo;t1apenmi3iytfm2rm( pn() etrmr iytlaDr u i;t)srxo(m3io1omt mfvtas  Duau p;o4texn oetltls2elnms;()tltnxr3iytfa  livo t tetoxm ny1lpte ivtasfartaxr no1tpe  ociaslm el(vp () lerxf oy1lmt aivi;(  2xrxo3no4op  mfvtl() Dta(m ;t1teeoio3ilslm emnvp t0trtoxf3tadla ranvo;t)seum(m3iodom  lfctat) rrru poo4aeto ietysls emu pnu4areoif oy1fm ranvs;( srxm(rpnodalte nctl()a2tmx pnu1aexnioctldlm2umnvo (0 renxf3ty1omDrln s s0s2uoxo iudlmtelfeiltf rua(  nu1alt  o3ilsla2el(vs t)areomf tatoaD lu s t t2tr(mpio4ale mietlsfsrraxmpno0aetomoeild s ulnvpn(0 leoio ta1fpt ai s;s trxrxrpiodllenlncsat)s2rau  ;t4aptnmi3tadls um(vo;u) etnxociotlaD lueo;s)teto(r nu1lpen iet (f 2urxrpnu1oetnmf3iat m eluvpnu0 lerxociydfp e u i s) rxrir oudoptnlfcia( aDurxrpno4oltoioetytlm2ra(vsnu4arenmr3oa1lpD ai i;t trxo(m nu1altnmivs sfs2tmum nu4openioeiytlaDrmnvo u4aexnxo iy1omte i i;t)s2trxrpoy4omtnmicsat sDua(mp;t1tee ifctyslaDrmumsnt0 rtrmocia1fptran slt)srxmim3io1lmeemnetlt s2ur(rpot1oeto ociatfmDrmumsnt)altoif3iadlmt lu o;( trtrxr3io1lle liciat) Dtmum ;t0tlx mocild mDumuvs t) eermrcty1oaDrlnes;t)trum(r3oudal   iciat)srrmum ;u4oeen i3taslsDrl(ms;(0tlxnmo ta1omDr uvils0tetrxopiudlmt mfcsl()arrmur no4aleniociadlaDuan pnt4 rxomf oa1om eau s t0trxoirpou4ap  lfet (fsDum(rpou4alxn fetldlm ul(mp u4 rxomo oadfm r u o t seuoxo ny1apenmfetltf rrmxm oo0olx iicils mDeaumo;t)artomr3todfmDe i sls)s2tmxo3nu4op emfviltf rtmu  no4oleo i3iydlm2um(vp;t0trerxfctadlpD anvsl() eurxrpnu4apee ivs sfsrta(ron
\ No newline at end of file
@@ -0,0 +1 @@
+i o;t)trxmim ou1al  mfvi t) 2rrurp;t0tlx  f3ildla2rmu snu)alxrmr iodlaD ai o;s  rxmim oo1olenmnesl(fsrtr(moot1apt mictltfm emuvp;u4teenmo3iodfat aivi;()t2tmxo oydlmte feil() 2urxm ou1oeenmi3iatfmDuan s u0artrxr3tytlm r u o (0s2xm(r io1ll n ictl()srtru  oo0texnifeiyd mDum( s u0arxnif3ia1fpt  u i;( s2umio oo4am  miet s)a2uaum nu0oleoioctad s ean pnt)tltomr3oy1fmDe nes (0 eumxr3oodame  netls srur(mpoo0tex  fetltfm2uauvo (0 ltoio tatlatelnei s0 rxr(m3iy4ll n fcia(fa2uau  nt0ope ifeilslaDeanvp;t4tlxnmocoo1fm   nvo;s)t2tmxo3ny4op  lnvtltfsrrmu  nt1opxn f3tysfs raumo;u)teeoxrciotfat  uvslt)texrirpnudol n ivtls)s2rm(rp;u1opt  ociasfm rl(mon(0trtomr3iotfa r nvo;(0 2urio iu4lleemnesltfartaurpnu4olto oeilslm emump (0 ltrxr oatfpD lnvo ( setmir3nydolen ivt tfsrurx  ;o1aleo ictydlsDrl(mont0tetnifcto1faD ln i;s0sruoio io1optn ics (fsrua(  nu1openmociytfs emuvonu) rxrir tytlp e nvs (0 rtm(m3oy1lmt mfeslt) 2ta(r ou1tle iieildls2em(vo;()trtrxf ty1oatraivo s)t2uoir3oo1altemiet sf Duaurpou4alx mieils s ra( p t0trerxoctytfaDelneils) eumxrpnudomt mies (farum(rpot4aexo f3tatfa rauvo;u0tltrxf3ootfm eaieo;s srum(r oy4ap e fcil(fs2tau  ;u0openmo3iatfs2emnmsn() renxf todoa   ivi (0 2xrxm ny4ameemnctl( a2uaxrpot1olx mieiltfsDelnmo (0arerif3iodlp r ies;s0 etm(rpoydolen icia( srtm(m ;u4aexomieiysfsDelumo ()trtrmoctodfpt  uvi (0 rxoim3iu4lltelnvtat srumxrpot1teeomoetytls2eauvp;u)texnmociytoaD  ivs;s)s2tm(o3ou4openlfes (f rrrurpot1texomi3iyt sDumuvs;t0aexrir3ia1fp r u i s0s2uoiopno1ole lieiat)sDum( p;o0tpe mociad m2rmu p t4tlxoxrciatfa ran sls) 2xrxo3nodamte fvsls)a2umurpno1alt mfetaslsDum(vsnu4artnxr3io1lm r ivi;s seto(opoy4altnlncta(fs2tr(mpou4oeeoiieildfsDrmn s;t)tetnmf3iadoa eanes t seumxopnudlmtn feia() Durx  no0tlx  fcilsls ul(vs t4trenmo3oydoaDr iei ( sexo(opio4am e ict ()sruaump;t1apenmietltlm elump;t4 rerif3oadomD aneo;s0 rxoxr nu4lmtnmicslt  2ra(ro;u1apeo o3ilslmDul(ms (4 rtrxo3totopD au s t)teur(opoo4am   ici (  Dtrxm ot1oltoiiciltls eanms;(0altomrcoydfmtrluvol(0 2uo(m3iydol nmici t) Dtru  no1opt moeildla2elnmont0trtnmf3iadomteanvils0t2um(o3io4lltn icsat  2rr(  no1opeo ietytfa2uan s;u4 eerxo iy1fmDrln o ( sexo(o3iy1ap e fcsl( s2uax  ;t4tpt  ociysla2rluvp;(4trerifciotomtrli i (0 exoiopiudap  mnvs tfa2ta(r ;o0apenmoeildfa2ranmo u0 rerxocoatfmD auvs;(0 rxrio ou4ope lnvils)aDta( ont1apeomo3ilsfsDrluvpnu0 exrifctatfmDeli olt0tetrxrpiodllee neslsfsDtru  ;u0aleoifeiadla2umuvon()tetrmrctotfatr n i;t) rurxr3nu1omtelfeiltf Drru  ;o1olxomfeils m ra(ms;() exoio3oy1laDelnesl(0seurio3oy4ape mfeiat) Dtrxm ;o4tpeomoetyslaDrlumo;u4 rxrir iodfpt lu ol()seumim3oy1ole mnvt (f 2rru pot4aleo icild m ulnvo;()aetnxo iytlm rlnvo;t)t2tr(mpno1ome lneil(fa2rm(rpnu1oeeo f3tltls eau p;u4 rtrmoctydomD aues t trxo(mpiu4amenmnctl( sDrmump;t0aex  ieild aDel( pnu0 rerio3ty1fmt  ivsls0t2urxm oo1lmenliesatfarumxroou4oee mfciltlmDemumo (4tltnxo iodfaDrluvo t) eumim3no4ol  lnet t)a2rax  nu0altoif3tyd s2rmn s t4 eeoir3todopD ai o t0 2tr(m3ny1amen feia() rtr(rono1altomietad s elumo (0arxoxo iadoaDrauvs () euoxr3iu1am e feiltf rtaxrp;t0olen o3iyd s rlnvs (0trtnmo3oydfp rau i (0 rtoiopny4altelneias)arumxrpoo0oeeomietlsls rmu p u)trxrmr iadlpt lnvslt seuriopiodlp emivilt)sDrauroou4apxnmfetydfm2uauvp;u4alxnmr oytom r neo;t)seuoxr oydomenlncsa( aDuau oou0alxoioeiatfa2ua(vs;t0aexrmr ty1fmD ai ol(0 exmxr ny4lmt lfes tfarumumont4olx ioctls a um( p u0 etrircoatoaDrlivsls0 rumio iu4ol emfesl(f Drrx  no4optoiicils s uan o t4tlxrmf ta1oa   ieo t0 eurxr3oy1altnmieiat) rtm(r ;o0teeoiociys sDrmuvp (4aeeriocoodfatr n i s)trtmim3nodopt lfvi tfa2uru  oo0tltomfeiydlmDem(von() rxnxocoydfp   nes;s)sexmio oodoptelncia( sDuaumo;t1apt  feiasla2eau p u4texnir oo1latrlu i s trur(rpno4amtn nvta(f rta(rp;t0optoiieilslaDuauvo t)alermf3oa1om elnei;(  euoio3iudape miciat) rua(monu4tet mfetadls rlnvsn(4arenio iy1fa   nvols0tetmxrpiudlltn fvtl(faDrruro;o0altoif3ils a2emuvp;t) lerif3ty1latr neo () etmim no1ape mivsat sDtru  ;t1oltoiieiltlaDelnvp u0teerxr oytlaDeauesl(0 2umxm3oo4lp emnvils aruax  nu4ape mfetysfsDeanvpn(4aetnirciodopDraneil() 2xr(mpoudlptn nci t  2urxr ou0open fciaslmDra( s;u0 rxnxf oo1lp e u i;()sexo(r oy4alt mictl(  Duau pnu0aexnifetytfs2ulnmo u4tleoxr3oo1oaD au s;t tetm(m3iudlpen netlsfaruaxro;o1tpt mi3ildfmDelumo;t)trxriociy1fmD aieo;t)trxoir ny1opt mfcsat) rtaxr ;u1apeo o3iydlm2rauvo;t) exrxocoodop r nvsl( seum(r3oydolen neiltfs2rmur nu0alenmietltlsDeau p;t0tlxnxr3oo1lm raies t0trtoxr3nu4ll elivs t)s2tr( onu4opt mi3ilt m ul( s;t4tleoxrcta1fm rluvs;() etm(o3nu1am nlnviat  rtmurp;u0alxomfcils s emn s;t)tetnmr3oa1lpDelivs;(0t2to(m3no1olen fcslt aDumxr no4olt  oetadfmDel(mp;t)areoif3totlaDr ivi s truoxo3oy1ol  lfcia(fa2umumpoo0tlxniieiltlaDrluvp t)artoxocoytoa  aues s0t2trio3oo4lmt  ict ( aDurxmono0ale  i3ias a2ul(mont) eeoir3iotlpt aivo () rxmxopnodlm  lfes s  rtm(r ;t4aeenmiciys mDrlumo;u4tetoxocoatfa  an o s)s2uoim3io1lpenmncs sfsDurxmpot0opxn i3tldfaDel(vs;t)altnxo io1om elivsls trtrxo oudlptelncsatfsrra(ro;t0alxnmieild a em( snu4tetomo ty1fpt anvil(  etrxo iu1alenmfes () rur(  nu0oexnmociltlm emuvpn(4tlxnxf oodfa eanvils0s2xrxm3no4lpenlieils) rum(r ou4aetomoetys sDeauvs;u0teermocoadom rln i;( tetoir3oudoptnlnvtatf rraxrono0aetnifcilsfa rau o;(0 eenmo3totlpDeli ols0 exmim nudal   netls)a2umx pou4ole  i3iyt aDrl( pnt0aeeomf io1lmt lnei (0trxoxm3oo4ll nmnvi s  rtmxmo;t0aex mfeiyd aDelu p t)tlerif3oytlp r nes;s0texmimpny1lptnmnvtas)sDur(r ;o4tpxniieiydla elnmont4 ltrio iadfatelues t0sexr(r3oodoltn ivtatfaDuaumoot0tleoiictatlmDul(vont)aeenir3todfpt an o (0t2tm(o iu4lle lnvsls)artmxmpno1tpx mfetysfsDuanvo (0 renxo tydfm   nes s0seuoim3nodamte nvsls  2rmxmp;o0oex mociydfs2rmnmo t)arxrxf oa1lpDr uvo;(0trtr(m3ny4omtemnvt (fsDuaxrono1aleomi3iadls rauvsnu)aexnio iotoa e ues;(0 rtm(o io1altelici t)a2ua(mo;u1olt io3iydfmDel(ms;(4artoxo3oy1fm e neo;t)setmir3oy1oltemivia( sruaurono0alx  i3tasfa umnmp t4 rxrxoctatfaDrlieil() ruo(r nydopenlfcsasf Dtaurp;t4optoifctyd aDemnvp t4altoxo3ta1oat aues;()s2xm(o ny4alt mfvil( sDra(moou4aetomfeiasfs ea( snu)texrxr iotlp eluvo;s)sruoxo iydop nmieias) 2taur oo0tlt iocildfs rlump t4aeerxocoy1fmtrlneol(0texrirpnu4op e ncs tfaDrm(  no0oeenmictld a eanvp u0 rtrmr3iodfpDeaies;t) 2xmio3io1aptnlneslt  rur(m nu4tpxnioeiad aDum( s t0aexnmocootom e nvs;t0srum(o3oodll elietls a2uaxmo;u4tet moetyd aDuln onu4 etoir3iy1laDraneolt)t2tm(r oo1olt mfctlt s2rm( pnu0tetnifciatla rlu pnt)tetnmrciodfp eln olt  eum(r iudap elfeslt  2tmxm nu4oleo ieiat sDeanmsn()tleoir ootfa  au olt0seumir3oydlleelnvsa(f Dtmxrpno0aeeoiiciasfm elnmpn(0altnxoctytlm rlu o t)s2xoimpio1ol  lfesl(fsDtau p;t4opx mo3tad m rmnvp;t0texriocootopDrlnvols) 2tr(m3oudol e fvias)a2rm(m ou1aptnmf3tydlaDemump;(4 lxoio oytlm raivils texrio3iudlm nlfciatfsrra(mont4olenmfcildfm2uluvs u4teenmf3io1fmteauvs;s trum(r io1om  mfvi t) Dua(rpot4tptn fetyd a2eau o;(0trerxr3oadfm rluvo;t t2uo(opiydap nmfei tfsDum(r nt4aet mociadlm2rluvo u0 lerio oytlat  u ilt srxr(o ny1lmt lnvia() rrmu oot0tle mfcias a2rlnmpnt) etoxf3tatomDranvils  exoiopny1ope lneta( aDtm(  ot0ale mfetasfm2emu o;u0alxrif tatfpDe uvolt0t2tr(r io1lpt  ivtlt  rrru  ;t0tex mf3ilslm uau onu0texomoctodlaD  uesls0 2uo(opoy1lm elfvtas sDrm(r oo1tle  feiat a2emu on(4arxrmf iadfpD ai o;s srxoxo3ou4al emncia(fsrrrxmp;t4oexo feiysla2um(vs u0altrmr3iodopte neol(0 etr(m iy1ol  lfetatf rraur nu0oeen feiydfsDeauvp ()texoxr3oodopD  ueo;t setrxm3iu1aleemnvsltfarrau pno4tex ifctltfsDean p (4treoifcoo1fpDrlneo s trtrxr nydole mncsasfsDta(mont4apenmfeiatfmDel( pnu0texnif3oytlp rliei t0t2xrxr iu4lpeelicslt) Dtrxrpno4apto feilsla2rlu s ()aetnmr iatlmteauvsl( tetmim iodoltemfvsas  rrrx  nu1olxoiociadfa rluvp;u4 rxomr3ootfmteaneil( tetmim3oudlpen ivsat)arrm(  ou1aeenmi3iatlm2rl( s;u)texrmocoodfp   uvs;t) exrimpoo1lm nlfvt sfaDtaxrp;o4alx  ociyt aDeln pn(4altomf io1fp  lneilt)trtr(m3nu1ap nlfeslsfa2taxm ;t1optnmfciatfs rlnmpnt0 renmfciotfm  aueslt  exmim3oy4am   ietls s2ua( pot0aeenmociat a2uaumo;()artrif3iotomDrai i;s0trxoxmpio1altn fet tfs2uaurono1tpeo i3tasfs2ran p ()alxniocoytomt  ivils0 rtoirpiudolt micsatfs2umx oou0alt ii3iad a ranvo;t)arxomfctytopDr uei ( texo(rpnodop  licilt s2urumpnu1texnmoeiatls uanvpnt)aetnir3oydlmtrln o () exrim3nu4lpee ietas aruaxmono4ale  fctlslmDul(mp u4 eeniocoydfaDe u o;t texrxr no4ap elfcslt aDrruro;t0ole mfetlslaDuanvo;u0tlxoxrctydfaD anvs;t)s2um(o3no1lpenlicil( srum(m nt4altomfeildfa rmu s t) rxnxr tytlpteaneo;s0t2to(r no4amte nci (fs2ta(mp;u4apx if3tyt s ran s t) rtrmf3oo1fpD  nvs (0 2toio3nu1ome mivtls)aDua( oou4tleo oetyt m uan o (0trxnxocoadlp  livilt0t2to(mpoudole mfetat)sDrmu o;t4apxnmoeiatls2umnvon()tlermo tydfa  aueo;(0 2xm(rpoy1lm   ictas) rtau  ou0ope  oeiydlm2umu o (0texoxr tatom  an i;(0 2triopoo4oleelieslt)s2ur(r ;o4tee moetat s rauvp;t0arenxf iydfaDrai olt trur(m oudoptelieia( aDrr( o;t4tlt mfetltlaDra(vo;()tlxnxo iydfaDr ivilt0 etrxo no4omenmivslt)sDrax oot0alxo i3tas s eanmpn(4altoxf3iadfaDrlnvi ()srurxopnu1ame licia()arumum nt4tpx mo3ild s2rluvpn()aetoio oatfmtrlu s;s) rtm(rpou4omt lnci sfs2tmuro;t0oexomo3iad m2rmuvo u0tlxomr3iytfaDe u olt0 2tmio3nu1ameelfcias sDumumo;u1tex moctasfaDelnmo;u) leoif3tadoaD lieols  eurir3io1omee ivia(  rrruronu1tetnmo3ilt a2ra(vo t) exnxfcia1opte n o;s srtr(o nydoptn neil( artmxmpno0apxoiietlsfa2ean s;(0 renmf3oatlm eai s;( trum(r3nodlmen nvias a2tauroou1teenmo3iysfa2eluvp;(4 etoif iatlmt lnvsl( sruoir nu4om emfei sf Drmxmpnt1apx  feildfa2rl(vp;u4alxoifciadop eaieo ( srtoxo3ny1apt lici t)arrmu o;u4ope  fetas aDeln s t0 exnifcoa1lmD li sl(0t2tr(o3ny1amenlfei s)aDrm(mpnt1oex iietysfsDuau pn()texrmfctadopDe nvo;t  rumir3oodlmeelfei tfaDumxmo;t4ope  iciltfm2rmums;()tetrio totopDraivi ()sexr(mpnu4optn nvt (farumxmpnu0aptn o3iatla em(vpnu0aexnmfciodlaDeln s s teumir3oudomenmfeias aruaur ;o1oex ifciad s2rlnvp;t) exrifciytlaDeaivsls0 ruo(m3nu1lme mnctlt) 2trx pnt0aeto o3tyd m ra( pn() eerxr todfmtelies;s0t2to(opnydlltemivsls)s2urxm ;t4tpt  o3ils m2rmu p t4trtnmr3ootoatranvi;t0teumxr nudam  lfvt ( aDuau pno0oee  fciatla2ean sn()tlxnxo3oy1lp eau o;t trumxo3oo4oltnlncias sDtmu  nt4tleo oetaslaDrm( p;u0 rtrmr3iotfaDr i ilt0 exrim3iudop emnet sfs2ra( pot4tpx ifciysla2ea(mont)texnxf3io1omtrliei;( srxoxo3iy4lpte fcsas s2tr(r ;u1oexoiocilt m ranmo t)tlxrif3totfateaiei;t)seumim3iodamen nvslsfa2ur(m nt1apeoiociytla umu o () etnmrcoydlpteaieo t0setmio3oo1ol n ietlsfa2rrxmo;u0opto oeildfsDuauvon(0 ltnif oodfmtr uvs;( sexr(opny1lmt lnvilt)arumump;t0tlxomf3tysfs emu s;(0arxnif oodfatrli o s sexmxo iudap n nesa()a2um(mpnt4tee iiciaslm uau snt4teeriocoo1fpD au s ()srxmio3ny1ll  mfcsa( srum(mpno1alt  ieilsfm2ea( snt4teermocio1fa eli slt0t2trxrpiodolt mfvil(fa2taxmpnu0tee mi3tad m2ulu pnt4 etrir3ia1oaDelnvi;t  etmiopiudamte net ( aDtruro;t0oeenmf3tatlm uluvsnu0arxrxr3iatomt anvo (  2to(mpny4ame mneilsf Dtaxr nt1aex moctytls2ranvs;u4tlxrxr3iodomt ln il( trur(o3iydoltn ivils)aDrmum nt0apeo feiyslm ea(von()trxnxr3oadoat  ivs;()s2urxmpiodoltelnvias  Dta( o;t4aet ioeiyt s2ra(msnu4tetrxr oo1fm  au i (0 euoim oy1ap  lfvi tf 2urxmpou0ole mfciysfs2eanvs;u) ltrxoctatfm e n s s)srxmxrpoodom nmfesl(fa2raurp;t1aet  ictldlsDulums u)tlxoxo oatop rlies s0s2toir3io4lpeelfctasf Dtr(  nt1tlt  ociyd a2uau p u) rtnmrcoy1om eli i;s texoxrpou1ame liciat s2ta(r ou4texomfctydfm2ul( snt)altnxr io1lpDeai sl(  2trxr3oydom nmiet ( sDumxro;u1aeto fetytla2emuvo;t4 ltnxf oytla  lieo (0texmxopnydamt  fctls)a2raxm nt4alxoifciltfa2elu pn()altnmfcoydlm  lueo t)teur(o3ou4lp   ies ( aDtr(mpou0openifcilsfs2eanmo u4 ltoio3ty1lpDeaies (0 exrxo3ou1lme lfeils  Dtrx pno0texnmiciyt mDelnmp ()tetnmf3tatlaDrliei s)truoxo3iydlp emiesl(f rumxmp;t4tee mfeiad sDea( snt0trxnxfctodlate nvs s)teum(opoydape mfcsltfsrraur nu0oeeomf3tlt s ea(vp;t4 lenmfcoadomteanvsls) 2umxo3no1ll  lfesl() ruau p;u0altnmfciyt s2uaums;()trtnio3ta1lpDrauvo;s)t2xmio io1aleemfctasfsDtrxmp;t0aleomfetldls uln o;t) eeoif iodlp   neo t)trur(opny4amee nesls aDrm(  nu1aexn fetat s2rm( pnu) exrmo3tatfpt lueols0s2um(m3ou4lmt mietat)s2uru onu0aee io3iadfm elumsnu4artnxr3iy1fmDrli ol(0trum(o3no1ole mieslsfarrau pot0opx mfciyslm ul(ms;u) ltoio iytoat livs s trxr(r nodamt mfct () rrax oot1aex mo3iys aDum(vo;t0aetnxr oa1om elueo;()trum(o3nu4al  lnvtlsf 2uaxmoou4tetn o3ildfaDrl(monu4trtnif3oa1opD ln i ()srxrxrpoy4ame mfvtatf 2ua(mp;o4aeeo iciydfm2ea(vp t4trenmr3tytoatrai i;(0srxmimpoy4olt livs s)s2uaxr oo1apx  i3ild sDrm(vo u0areniocootfmDe neslt) rxoirpoy4ap emfeta(  rurump;t4olto f3ildfa rl( o;t) lxrmfcta1lmD  iei s truriopiy1om emnvi ()s2rru pot1alx  o3iltlm rmuvpnu4 rtniocto1fa  lues s0t2tmim nu4lme mieil(fs2taxrooo0ole  oeiltfmDuau s (4tetoxfctadla   uvsls) 2urir3iu1am  mnctasf rum(mpou1aleoii3iyd s2eaump t) reomf to1fmtrlneo t)seuoiopny1ome mfetasfs2trumpot4aexn fctaslm rmumonu0texoifciodfpt au s s0t2urxo nu1altemieia(f Dtm(rp;o4oltoiietysls emnmo;t)aetrxf iydfaD aneslt0s2xmxm oo4opeemnviatfs2urum ot1tlt mociaslm2ua(vpnu)trxnir3totfpt lueils)seuo(m nu1lltemivtlt artaurpou4ope  ietlt s ua(mp;u4trtoio ootfat luvs;s  exoxm iudopee ncta()sruax  ;o0aeen o3iyt mDeln o (4altnxr3tydlpt ln o;t)t2ur(r nu4ll nmnvsatfartau oou4aptnmieiadfm ua(mo u0tlxnio3oy1opDr ueo s)setoxm iy4am nlfvsatfa2trx pno4tleoifetadfs2em( s ()tlermoctytfatr neols) exr(mpiy4am elfesatfs2umxro;u1oee if3iat a ulu s t) ltoxf3io1fp   ivi;()sexoio oy1aptelfvi tfsrrr(r ot0olxo o3iadfs el( o;t0treoio oa1opDelnesls) exoimpno4ll n ieslt)srumxmono4tlxniieildlm2elump;u4trxrmo oo1omt  uei s s2xr(r3iudlmtnlnvslsf 2trumooo1altn o3tltlsDeanms;u)altoioctodopt luvo (  exrir3iy4al nmicia( arrau  no4olenioeias mDumnvpnu)arenxo ootfmtrlueolt0s2trxm ny4lmenlivias a2trum ot0tlxnmoeiysfa2uln p ()alenmf3iodfaDeln s;s  2ur(m3io4lmeelnet tf rur(  oo4teeo feiadlm2umnvs (0aetrmo3ootop   n ols)sexr(mpny4ome livias)srtrxr ;o4oet  icilslm2umuvo u) rerifcoa1lpt  uvo;s) rtmxr nu1llenlncta(  rrrxr oo1aee  iciys a em( ont4alxrxf3tadfa elu o;s) eurxr nudlm nlfeiltfs2umxmpot1olxoioetydfm rm(vo;t0texnifctatoat  nes;t0trxoiopiu4lm nlici s)s2rau ono4olt iieiysfm rmnmsnt) rtrxocoo1fpDrlneo;s) exrxmpio1ol  mnvtls  Durx  ;t4apto fcias mDrm(mpn()altnifciatopDraiei;s0seuo(m nu4lptnmieiatfs2umu  nt0alen iciysls ua(mont0altnio3totfmteanvs (0s2tmim oy4alenmietas  rra(  ;t1aeeoiiciyt a rau on() exomr3oadlaDraiesls srxoxopou1lmtn feilt artr(r ou4aet mieiltfs rmn o;(4aeeoxf3tytfp ran sl(0srumxr oy1apeemfetl(f rur(  ;t4altomoctys a2ranmsnu4texnio3io1laDr ivsls0sexrimpoy1lpt lfct s  rur(moot4tee iieias m2rm( s (0alenir oytomtrauvs;t) rxrirpno4ap n ietasfa2urxrpoo1tptn ieilslm emums;u)altnmo ta1fpteaueo s teumxm3ou4llt micil()a2uau poo0altoii3tasfm2ranvs;(0teenxo3oatopD anes s s2to(o3oy1ol emict sf rurxr no4alx ii3tldls2ea( p (0 etoif3ty1fa elneols)teumxopoudomte ncias  Dtr(mooo4tlx if3iyt mDrmump;t)tlermo iatomDraies;s  rxrir3iu1alenliesat s2rm(rpnu1altoii3tltfmDeanmp (0aeenmo ia1fmt livs;(0s2xoxrpny1llenlictas)srtaum oo0aexoii3tys a emnmp;u0tetoxf3oatomDr i o s0sexrxrpiydal  mnvtatfaDrau pnu0opt mociydfm ul(mpn(4aexrxociytlpD anes s  exmio3iu1ap emnei tfs2uax o;u4olxniiciasfs rlu sn()tleoio iydopDraueo;(0 etmirpoydolee iesls aDraum ;t0opeomiciytlaDumnmsnu4arenxf iadoaD aneo s) rurimpoodaltemnvias) rum(rpnu4tltniietld aDua(vp;t)altnmf iotlpDrai o s setmxr ou4optelnetlt) rtax o;o0altomiciydla ea(ms u0alxoio3ta1latr n i s0sruo(m3iy4ap n feslt) Dua(ro;u0tpe mo3iytfa ulnvo t4trtnxrctatlat  nvolt s2triopnudlle mnciat sDtr(rp;t1ale if3ils a2ea(vonu) reomociytopD lnes;s setmim3iu4lp  lfcil( artr(  nu0ape moetys aDum( o (0tlxrxf3ty1lptrln i t)trtoxopno4altelfei ()a2rax p;u0oltn fetasfa rmnmsn() rtnmrciodfm  anvil()tetoim3io1amt lies tfs2rrxm nt0tlx  ociytlaDrmumo;u4 renxf todoaDe ies t)sruoxmpny1llenlivias)aDrm(rp;t0oltnmfetyslaDulu ont0 ltoio3iodlmtrau sls) 2xrxr3oy1lmtnmfesls  2tmu o;t0olt io3iytfsDeln pnt)artoif3oa1lm r uvs;s)seto(rpou1ame lfctlsfa2uaur oo1tlen f3ilt a emnmp t0tlxoif oa1fat ln i (0srtr(opoudlltelnvs t)a2tm(rpnt4apto oetls a2rmnvont)treriocoytoa r u s ()srur(rpoo4amtnmneils)s2taxrp;u0aetnio3tldfm2rmnvp;t0aetnxo oodfm e ues;t  rtoxopoo1lmeelnctas)aDrrxm ;u1tleoio3tld a2rlu sn()aeenmrcoatomD aivi;t)srtrxm3iodapeemfeilt) 2ta( p;u4oeeo octyd s rmu p;t4trtrmf3iotlpte n i s)truoio oo4lle mivtls) 2umum nt1olxn feiytlmDuln p;() etrxfcto1fpt au i ( trtoxo no4lm elfci sfsrurx  no4oee mociadfm um( on()altnio oa1oate ivi;( seurimpiy1ap  lics tfa2rmxroou0aexoiiciydfa2rm( snt)trtnmf3oytfp  au i t)trumimpoydomenlivi ( arrmxroou4opxnmiciatlsDemuvo u4texnmf3io1omD auei (0 etm(r nydapee ivtas aDur(ro;t1tpeo f3iydla2rluvp;t4 eenmrctydoa e u ol()trum(mpnydomt mnvt s sDrr(m ou4altnmfeias a emumo;() eerxf3oatlaDean o (0trur(o no4ape mfesas  rra(m oo0aet mieiasla2rl(vp t0 eenmo3iytfpDe neolt0 euoiopoudomtelfetl( aDrrur nt0oex  feilsfs2umumsnt0 rerifctodfa r ivi ( teurxrpiydapt  fvils  2ur(ront1tptoifeildfa ua( s () ltomrcta1lptelieol()trxo(r iudaltelfcsa( srtm( pno1oee  i3tytfsDraums;u) lerxfciy1om  lieo s truoxopou1lm   nvtas)arrr(mpnu1aexn ieiytfa2rluvo;() rtoif iatom  ln i t0 etrio ou1altnmfvslsfs2ur(mp;o0oexn oeiat s ul(ms u4teerir oa1lat ln olt0 2umxopiydomt  ietlsfaDumxmpot0alt  fcilslm2ulump;t4 etoifcio1fm  lnes t)t2xrxr3io4amenmneils a2tmx pno0aet io3tls a ul( o t)texnxf ia1omD  i i () 2xrxopno1ame lfvtl(f 2ra(ronu1teeoifeiatla ran snt0alxnifcia1lm  lu s;t t2uoxopou1lp e nvtl(f Dumx  ot1opeomfeiyd a uaump;(0alerxociydlmtr uvslt  exm(r ou4optemfci tf 2rrx  nt0altomfciadlsDum( p;u0tetnxr3oatlp r i o;( sexoxopno4lpen ncsa(fsrua(  nt1tpen oetys sDeau s u0trxrxf3oatfp e ieo;t t2urxmpiu1ol e netasfaDra(monu4opxnmociat a2emnvpnt4treomoctatlm eliei s) rumxmpoo1olee fvi (f rtrx pot1aet mo3iltfaDeau pn(4 renif iadop elivs;( sexrxm3nu4ll emnetls)srraurpot4texnmf3iydla emnmon(0aetrif3oo1fate neol() ruo(rpno4apt mfcsas) 2rrurp;o1alxoifeilt a ua(von()trxrmrciadfmDranvi;t0setoim nu1ll eliei t)a2rm( oot0oeeo ieias sDea( s u) etrifcoytfp e i i;t0srto(r iydale  nci s  2tmu pot1oexn fciad a ua(vsnu)teeoxr oydopt lnvs s) 2to(o3nu4am   fci t)sDtmu onu4tpt io3tls s2umnmsnu4tlenmfciodlmD luei s0s2trxrpiu1lmte ietas) 2ua(moot4olx ioeiysfmDrmuvo;t0artnirctydop r ivo;s0trxriopnodop  mfet t a2ur(mo;o0aexomi3ils aDrmnvpn() lxrif tadfmDelies t)setr(r3io1lp  micia( aDumump;o1tptoif3iytfaDua( ont0altnmf3ty1la r i ols0seum(m3oo1aptn ieilsf 2trxr ;t0tltnioctld a2ulnms;t0aetomfciytlat ai s ( seuoxrpoo4oltnmfcs () 2taumo;o4apto oeias sDulu o;(4alermoctotoaDeluei;s0texmirpnydalt  nvtl( s2rr( onu0tptnmoctldfs em(vo ()areoioctodlpDelieolt)trxoxr oo4omtemfvtls)sruaumoot0optnioetas m ulu o;(4aexnio3tadlat  nei t0 rtrxo io1ameemfcsat a2ua( oot1aeeo o3taslaDul(ms ()aetomo3ty1lm eauvslt)sexmxm ny4op nmivsl()s2uaxmp;u1oetn oeiytlm ulnvs ()alxnir iotfpD aueo;t0t2to(mpno1lltemnvtat) Dumxroot4tlxo o3tld mDelump;u4 rxnmo3oo1faDrlnvi t0teumxmpny4lltelfvsl()srtau o;o0tptnii3tyslm2umumont0 rtnxocoa1lpDe n sl(0sexm(mpio4lp n fetat)aDrrxrpnt0apxoifetat m2ua(vsnt)areomr ootfaDr ivo s trtm(m iy1lptelncil()artrxronu0aeen oeiytfm emnms;u)treomfcta1la  aivi;() rxoxo oodlpt mfcsas) 2ra(  nt0ope mf3iatlaDumnvsnu0 renmf3oatomDeanvs;s0 euoio3nudlpenmivsas)arrmxmpou0tpxn i3iatfa2rmu s u) ltrirciodfatean slt0 ruoxrpou4al n ncias) Duru pnu0alt  fcildfaDuau pn(4tltnir oydlptranvs s) 2um(m iu1aleelncslt s2tr(  ;o0tltnif3iatfs2elnmpn(4 eeoifcty1fmDeaieo s  ruoxm3nu4lmeelncils) rtau pot1oetomf3tlslm uau p u0trtrxfcoo1optr u o;s0 2xmim3nu1am n iet t) 2rmumono1teenmfcilsfmDrm( p;u4treoxo iadom eaiesls)s2xmim3oy4amenmneilt a2raxrpnt4apxn i3tyslsDran o;t)areoxo3tatfpDeaivs;(0 rtrxm3iydomeeliet (  Dur(mo;u4oltomfetad m2ua(mp;(4arenir iotlaDelues;s0t2xrir3iu4apeelfcslsf 2tr(rpnt4teeomf3tldfa ea(vp;()tetoiocoytfat auvo;()sruo(m iydlpt  ivi sfs2rru onu4apx if3tasfsDel(vsn(0alermo oatfaDe n ilt)trtm(opiy4olee nei t sDua(  no0optoifeiad a2emnvs;() rtoio oytlpDrlu ils0srtoxmpou4op nlfct tfa2rmu  ot0oeen o3iys aDul( onu0tlerirciatfp  li o s) rur(o3io1am nmnvt s a2tm(r nu1ope iictlt m2elu on(4tetoifcto1fp eaivo t  2tm(m iy1opte fcs s)srrrx o;o4apenifetyd m2rmu o u)aetrmf3oydlaDelueo s t2tmxr3nydap nlnvs s  ruaxrp;o4tpenmietysfa rlnmp ()areoxo oa1lmt ln ilt)srtrir iodomen ics t s2ua(  ;u0aeeomf3iltfmDemuvo;u4trenxfcta1fpDrauvslt) 2to(o3oo1ap e feil() Duru pou1ale iiciatlaDel(ms (4 exrirciydla  aieols0 2ur(m oodllenlfctl( arrmxmp;t0apt ii3ilsls2rmn p (4 rtrifcta1lpt  nvo;(0s2xrxr oy4ll e fvs (f rrrumpno1tpenmf3iad a2uln s;t4tlerxocoydlatranvs t  rxm(m iydllee ncsl()srrr(rpnt1apxomo3ias aDulnmo;t4treniocoa1opDranei (0setm(mpnu4lmtelncsltfa2rmumpno1altoioetadfsDeanmo t)texoxr3iotfp e uvs;s)seum(mpiy1op e nvsas)sDrm(rooo4teeniocilslm2ulnvs;(0teenmf totfpt ai i;t0texrxo3iydol emnes s)srra(r ;o0openmi3iad s2rlums u) rtrmo3ia1oa ran sl()truo(m3oo4aptn neils artm(m nt4tlt mi3iad aDraump;t4tleomf3totopDr i ol() rtmxr iu1lleelnvtls srrrump;u1opt mociytla emn p t)trxrmo oydlmtrau i ( sexmio3iydap  mivil() 2rau oot0opeomfetatls rluvs;()treoxr tytfa r ieo;( s2toiopiu4al  liet (fsruauroot0oee miciad m2em(mo u4texrmo ta1opt livol()sexr(o3iydameelfvs t)s2rmxrooo0tpt  f3iysfaDrl( p u0tltnio ootlateau s;s)sexrio3oudll nlicsl()a2um(mooo1aeen ietyd a2rmnvo;()treomo to1la   ies;s sruoim oodamt lncsat s2tr(mpot1aeto ieiat m2emuvont0 ltoxfcoatlat  ues;()t2xriopiu1lme mncia(  Drrxm ou4oexnmf3iys s2rl(vs ()treoifciadom   n s;s) etr(rpny1ol  lncta(fsDraump;o1tet iictydlm2rlumo (0 etrir3ta1fmtrau i;s)t2xo(mpio4ole lnetatfa2rm(  ;t4oetn ieilsfa2rm(mp;(0altoxfcoytlm eanei;s0s2uo(rpou4apee ncsas)arumump;o1teeo o3iat s rm( s t4tlxrmr3todfptraues;s  rtm(opoudomenlfeiatfaDurxroou1aex moctyd m2ul(vo;(0 rtnxf3ta1fmteli s s)teum(m io4apt  neia( srtr(m ;o4opxnmi3tltfsDea( o;u)trenmocoatfa elu o (0trtr(m3iudaleelivsasfaDtmxmpnu0texo f3taslm2ean on(4arxnmo oydfpD au s t) exmxm3ou1oleemfet s)srrrxroot0olxn ieiys aDrmnmon()arxnio ootlp ran s ( sexoxm oydom e fei (fsDtrxronu0alt iietls aDrl( on() ltnmr3tatfpt  iei;s)tetm(o nydol nlieil( a2ur(rpno1apeomf3ildlsDeauvs;u0arxrxfctotfaDran o;t tetmim oy4altemivilt)s2uaum ot4tlt moeiadls rmnmsnt4tleoifcty1lateluvi () eumir iu4lpe mietasfsrtmumpno0opeo f3tys mDeau p t)arxomf3oydop   ies;s)seto(o3iy4lp elfci s arurxr ;o1ape miciytls uan onu0 etoio3ty1omDe ieo (0t2um(opoodom n nes t)aDrru o;u4aeto feiad s rau s t0 leoirciatfmtraieilt)sexoxm iudomte neia(faDum(  no1opeo oeilsls2rm(msnt0texrmfcoadlaDeaivil( t2triopnu1al   fctlt)aDum(m ;o4tee  ociytlmDumumsnu4trtrmr3todomDeanei;s s2to(opou1ll nmnvt (  Drau ooo4open ocilt aDrl(vo ()treoxf tydlaDe n o s  eum(opnu1ome lfei tfaDtrump;u4tltoifetas a rl( p u) etoio oydlmDr ies (0t2trxr oo4ope livi () 2ur( p;o1optnif3tydfsDrm(vo;t) rxnmo oatla eai s;( s2umir3io1aptnlfviat)srtm( pou4ape mieilt a raumpn(0aetnir3iadfp rlivol(0 ruoxo3oudap nmnci ()s2rr(r ;o4tlt  fetatls ean on()tlxoxf iatfat  i o s s2triopoudam n fvt t)aDtm(mo;u4altn ietytla2elnvo u0artnxfcoatopteaivo;s0s2tmxrpiydlmenmfctasfsrua(mpot4altnmieiltfa2ua(vo;t)tleriocoytlatr nvi ( seto(rpny1lm e ies ()sDtaurpnu0oltomfeiydlsDua(vsn(0aeerxr oy1fa rlnesl(0texrxopoo1ol elfcta() rrrxmpoo0texoiiciydfm2uau p;t) rtnxfcoa1latrlnes;(0 2xoxr iydlmee fcsltf Dtmu  ou1tlx  oeias a rmnvs;(4altrif iatlpt aueo s)sexo(m iu4ome mieias srtaxm ;t1tlxnmfciasfmDumn pnt4arxoif ia1optrauvilt0trxmiopiy1aptn nesasf Dta(mono4apto o3tlslsDeluvs;t)teermrctydoptelnvo s0s2uoxm nydoltn ncslt  2rmxro;t1alto f3iytlaDulnvo;u0tlenxo3oy1opDrluvi;s)srxmir oo1lm  mfeilsf 2rm( p;t0apxn octys s2ul(mo;() etoif tydlmte n il(  eur(m nu1ome  fctasfarrmurpoo1teenmocilt a ul(mo;u) rxrmo to1oaDrli s (  2to(mpnydal nlfvi sfsDur(m ;o1aptoioetysls rl( s;u0 ltoio oadfpDe ivs s s2trxr nudllen fvslt a2rau  oo1oeeo fciadls2em(msnu) ltnxr oa1fpDeaieilt) 2umir3no1ope  fvtl(faDrmumpnt0tpeomf3tltfm2ranvont) rxrirciodfaD aneslt0 rtr(o3no1oltnmnvs sfsDrm(mpnu0tlxnif3tysfaDul(vont0tetnif3oatlate uvs s trxm(m3oydame lncsl()s2tax onu1opxnif3iytlmDrlu p;t0 lerxocoodlaDraivil(0setmir3ny1apenmicslt  Dra(rono1oleo i3ild m2ua(mo ()texrmr todom eanes s) etm(m3ou4alenlicsas) rtau pou0tltoii3tytls2ranmp;t0aetnmo3oatfpDrln sl() etrxmpiu4lmtelivsls aDuaumpoo4tle mo3tytlm2eln ont4arerirciytfpteai slt0t2umxo3ou1lmt lieils) Dtmx  ot0altomi3ilt aDel(ms t0 ltoxrcto1fptraneslt)sexm(o3iudap nmieiasf 2urx p;t1opxn o3iyt a2ra( s;t0 lxrmf3todoatelivils  2to(mpou4op   nvsa(  rumu pot1tpx  i3iytfm2rmn p u4aexomf3iotlatranvi;s0 rxo(m3oo1lpeemfvs sfs2uau oot1tpxomi3iyd a2uan s t) rxrxo3ootlat lues t)t2xrxm iodlmte nci t s2rru p;o1olen fctatls ul( pnt) ltrmociodfmDeaneol( t2xo(r iydol nlivia(  2raxrpnt1aexomf3tadfs2rau s ()aeeoxo3ta1lmDraneol(0s2uoir iodll n fcia( sDrr(m ;t1opxoiictat aDuan o;u4trtrio ty1omtr nvs;t)teur(o nydlme lneta(fsDta(rono0tpe  o3iytlaDuauvo;t4aetrxr iotfptrlues s0t2uoiopou1al n iciltf Duru poo4openiiciydfm2ra(ms u4aeermo oy1oate n i t s2xm(o nydlptnmnet ()artrumpou1oetnifeias m ra(vpnu0aexnxr tytfp ranvil(0teumirpiy1aptelfvsls a2tr(mono4ole  fctlt s eanvsnu0tlermrctytoa  lu ols) exoxrpou4om elfetlsf Drrxmoot4texnmocild m2ra( o;u)alxoir tatlmt ai i;t srumim3oy4oleemfvtasfs2taxrono4aet mi3tldla umn s u4texrmoctodlaD aivs (  rurio iudll elict s  rrrxm oo0olx ioctlt a em(vpnu) rtrir oy1la   n ils)s2to(mpoudaptelicsat  rua( pnu4tetomietlsfm2umnms;u4 exrir3iydfmt aivs;t  rtmxopiy4al nlicsa() 2tr( oot0aptn o3ias s uan ont0arxnio iadfaD livs;(  exrio3no1ol nlfctltf 2taur ou4alxnifeiytfm2uan o;(0trenmo3ta1opDeai i;(  2tmir io1optnmivtl(fsrtmu  ot4apxomocildlm rm(msnt4 rtnxf3tydoaD lnes t0t2xmio3iy4al eliviat aDua(ro;u1tpxn oeiatfa ua(vs;u4texnxfciydoa elneo;t  2xrio iy4alte fet t)a2rmump;u1aleoio3iadfm2em( o t)aexoir totomt  ueo;( s2uo(o3oo1apte ieiat)srurxmpnu1tet mi3ild aDul(msnu0tlermo3to1fpD aies;s s2uo(m no4ame  fetl(f 2ra(moot0tlx iociys s2rmnms;(4 eeoio tatfp raivi (0 ruoxm3iy1openmicsl()aDtauroou1aetnmfciydlsDelu s (4tltnmf3ia1lmteluvi;(0t2trxr3oydom e ivsl()a2raxmpnu1tlt  f3iydls2ulnvs u0altnmf oytlmt anes;()trto(mpio4llt  ivil(f rrrum oo4tetomoeiltlmDra( o;u4trerir tadoptrluvs;s  rxoxm iu1ome  ietatfsrtr( pnu1olt ioctas sDeau s;t)tltnio iotoaDeauvs (  eto(opiudal emncias a2ra(mpoo4alen fctad s ulnmsnt)altrxf3oa1fm rlu ol()srtmxm3io1omtemnei tfsrtr(rooo0apxomfeiydfs2em( pn(4teenmrcoadlmtr ueslt0 rtmxr3oy4op n ivs tfarrau oot4alt mfeiysls eauvsnt)tlxnmo oydoat  n slt sexrimpnu4openmfvsat  2uau  nu1teen oetydfsDel( pn(4 exrxo3iodop eanvilt)truoimpiy1lptnlfvias arta(monu1tlxoiociys s um(vs t4 lxoir3ia1lat auvolt s2tmim3oo1omte ivs s sDtaxmoot0tleniiciaslm2rmnvp;t0 reoio3ootfpte nvs;(0t2uo(r3oy4ame  ici tfs2urxrp;o0texnifciasls ra( o;(4 exnmrctadfpte uei;()t2xrir3oo4omt lnctat srtrurp;t1aet  feils s emumonu0trtomr iytlpDe u slt0 2xrio3oo4opte ieta() Dtauro;t1oexomo3iad m2eauvp;()artoxo3tytlptr i i s0s2xo(o3ny4omt mivsat)s2ta( ooo1oexomoetaslm umu p;t4aetrmr3totop elivi;( teuoir3iy4amte fct sfaDtaxrpnu1tlto ietlsfsDemums (4tltrxf tytoatrlivo () 2tmir3oudlle  fvsat arta(r nt4opeo oetldfa2eauvsnt0 rxrmo3iytfmDeaivsl(0srto(r3oydape  ics s)sDum( pnt4tltnii3ilslm2ua(vo (4tetoio3ia1opD lues t) eur(m ny1ll  micia()a2trur no0oet io3ildls eln snt0 lxomf3oydoaD  i s;(  eumxr nudaltnmncsasf rtmxrpoo4oeenio3tls s2rm(vs t4trtrifcoadlp eluvo ()sexrxr oy1om elfeiatfsDum( pou4tptnif3iad m2emnvo t)aexnxf io1omD au ils)sexoxrpoy1ap e ivtas aDrr(rp;t4opx mietydlaDranvon() eeomf iy1la e nei;(0t2tm(rpio4llenmiet (f 2rrxr oo0olxniiciasls2ra( o;t0texomr to1fa  aivolt s2xo(r oydopt  nctls sDrr(r nu0alxo fciatlm2rl(vs;u4 eenxo ia1fa rlu sl( tetrir3oudal  mnesasfaDtax pot4ale  i3iltlm2rmnmon() eeomr3iy1fa elivo;s)t2tm(o3iu1lle  net ()srua( p;o0tpenmicild a2ea(vpn() lerifciydomDeli ilt0texm(m3ou4oltn icsl(farururpnt1texnmi3ilslaDua(monu4aeeoir oo1laDeluvs;(0setm(opoo1al  miesatfa2tax ono1alxnmfctldfmDuln onu)tltoifciotfpDrlivo t0 2uoxo3nodlltelivs s srtmumpoo0alx iiciysfm em(mo;(4alxoir totlaDelnvo;s)srxrio3iydllenlncsas arurxmpnt4alx ifetasfa rln o t4tlenxrctodfmDeluvilt)teuoio3nu1lle  neil(fsruru pnt4opt  oeildfsDrm(mpnt0alermr iy1omDelnvi s0t2umxm3io1omeeliet s)srtmu  ou1apt ifctlsfm emnvs;u0 eenxocoatomDe nvs;t0texo(m3oy1lp emfvsls)sDrmxmo;t4apx moctlsfm ra(vsn(0texrircio1fptrlu o s  exo(o iodolee ictl(f rtmum no1optnmi3ildfm2eln s t4tltrmr iydomt lu s t) 2tr(r iu1oltnmfeiatfs2rau pnu4tlt  fctytlm uaumo;u) ltrifctotfm e ues;s0 ruoir ny1omenlfvsatfsDuau ont4openifetat s2rm( p u4trtrmo oodfpDrauvolt) rtrxopnu1opee ies s) Drrumpnt1aeenmo3ilt mDeauvo (0trermo3ta1omtr ueo s)teurxo ou1om emnct t arumx o;o4olt iicild aDeauvsnt4arenmo3tatoatraieo;t) 2uoirpoodamtnmneils a2raur no0alx  f3tlt a2uauvo t0tetnmf3iydfaD lu sls srtr(o3ny4opeemivsls aruaxro;t1alxoifeiasla rm( p ()trenifcoydfateaies ()s2trxr oy1am e nesat)a2raurono4ope iociytlmDrluvo;(4 rtrmocto1opt  i s;t0s2to(opiu1ole mictas) Dua(mpou1aexnmieiyslmDeln pnu4aetnif3ty1lpte n ols0s2tmim3nu4lptnlfeilsfsDtmx  ;u0alxomociysfaDrlnmo () lxoif3ta1lm   u o;( texmio3iu1lmtn nvsl( srur(mpou0olt  fctat m2ra( s;t) renio3oodlp  aneol( s2tm(opnu1ameelics s arumump;u0tpt ifetyt m ranmp;t4artnmr3oadom e uvs;s s2umir iu4ap nmivilt sDtaxm ;o0aexoioeilsfa eanmo;()aexrio oodlmDr iei;s) 2xmxrpiudlmeemiviltfarua(  ;t4apen ociadfs2eaump;t) ltoxrciy1oaD li slt)trxoiopoy4ll  lieia()sruaxm no1aeto fciyd a ea(mp;(4arxnmr3iytopt  u ol(0setoio oydlp e fviat  2trx ono1altnmieiatla rm(vpnu)artniocoodoa e ivi;(0truoxr3oydameemieilsfsrumx ono4tpeo fciad m rl(msn()arxnxf3iatlaDr i sls0seuoxrpnu1ll  lietat s2uax ono4oee ii3iatlm2ean o t0arxnxo3tytfpte uvo;t) 2trir iu1apt  nes s  ruru ooo0aeeomo3tltfa ulu p;u0aetrmr3totopte nvolt0 rto(rpiy1lmee ncsa()aDtmurooo0tpen i3iasfm rmu snu4arxrxrcoadfaD auei t0 rxo(r nydaptnmnct sfs2rmxro;o1oet mi3ild s2ranmsnu) ltnmf todla rluei;t0 etoim3iu4omeemivt () Dtrxmp;t4alenifciat s el(vont0aeerxr oo1fmD an o;s)trxoxmpou1ll  licsa()s2rr(r ;t0aex  fctadlm2emu o;t0 eermo totlmDranvs s0setrxm3oy4ap nliviat)srrruroou1olto fciadfmDrm( p;t4treoxf3iydlp eai o;(0 rxo(m iu1al emfesatf 2ur(mpoo0tleniiciytfaDel(mpnu0arxrmf3oydomDraivsls  eum(m3nu4amte nei sfaDurxront1ale if3iatfa2rluvsn(4altrio3oy1fptr uvs s trxoxopou4olt miei sfsDum(  ot4olx  oeiadlm rmu s;t0 rxrifciotomD lnvi s0s2trir nodlpt mnes t arur(ro;o0alenmociytls2elumo;(0alxrxr3ia1om ranei t0sruo(r3io4al e fcsls)arumu  oo1altoioeiysls emn s u)artrmf tadfm elivo s0 exr(m3ny4altnmivia(faDrm(rp;o0olxniieils m2emuvo u) ltnif ty1lmD auvs t0t2xmxo3iy4oltelfci ( srumumoot0ale moctls m rlumo u) rtrircoatlaDe u i;()t2tmxr oydlmtn neiasfs2tr( pnt1tlx mieiasfsDua(vp;u)texoir iotfa   uvi;(0seto(o3nudal n ncia()aDum(rpoo1aeenmfciys s2rmump u)texnmrcoodomte uvs;t teum(m nu1am elivs (  Dtaxmpnt1optn oeiatls ea(mon(4 exoxr to1lpD aiei;(0 2umim iy1aptemfvsls) rtmu  ;t4oeenmoeild a2eanmo ()aeerxfcoadlmt aivslt0 2tmxm nodlpeelncia(faDrr(rpnu4opt io3ilsla uanvo;(0altnmr3oo1latelneo s t2xrxo3oodlp  mfvt (fartmump;t0tex mi3tld a2rlnvpnt4tetnif todlaDeau i t) 2to(r3oy4am   nvtls  Dumumpoo4optnmociat a2eauvont) etnxf iotopDrln slt)t2trxo3io1lmtnmnvtls  2taxm ;u4apxnio3iltla rl( p;t4arxnircoydlm eaueo s)t2umio oodapenlicsas sDtm(mpnt0olxnifctytfs2rau snu) lerirctadopDelu i s) 2xo(r3oodap  lnvta() Durx oot0tlt  icilsfmDrlu onu)arxomf3oy1fmtelu s t) exmxo no4altemnvia(  Durxr no0olen oeildla eanvp;t4 exrmo3iodfat lnei t) etmxrpoo4lpenlfvtltfarur(  oo0oex moeilsfm em(vo (0 rtnir oa1fmDr n s;t) exoxr3oodlmt lfvilt)s2um(rpno1tptn feiadls2um( on(0arxoxf3ty1lpDeliei ()t2um(mpiu4opt lici ()s2ua(  ;t1oleo o3iasfsDea(mp t)tlenmf ootfmDrlnvi;()srurxrpou1lp  mnei t)artmumoou0tle ifeiysla el( snt)tlxnxrcio1opD an sls0tetm(r iy1al e fvia(fs2ua(ro;o4aptniieiys m2umuvpnu0tlxrmoctotlmtr ieo ()teuoim iudlm  mnctat  rra(m nt4tlxnmiciydlm2elnvsnt)arerxfctydfaDe ivi s srumxm3iu4al n fciatfs2uaxrooo4altnmociad sDumn sn()aleoxr totom e ueo;t srtm(opoodal   feia(  Durxm no1apxoii3tas sDea( on(0altomr oo1fp rli ol()srxo(rpno1am nlfetas)a2ua(r nt4olxoiieild m rl(vo (0aeeoxf iadfat au sl()truo(m3oodopee fci s a2ra(mont0tpe  feiys a elnms;u)tetnmr3oydfptr nvo;t0seur(r iodlm elies () 2rmurpnu1teenmf3iltlmDeanvp;(4teenxr todfp e ivsls0 rtrirpio1lp  micilt srumu ono0aleomfetat m2uaumo;t4altnmf3ootlateln i;s t2xoxo ou4ap  mivsat a2umum no4opt iieilt a rm(mp (0alenir oadoptelues;s0trxr(m ou4amen fvtls)sDtaur nt1aee ioetydlmDul(vo;(0 rxoir3iatoaDeaneils) etr(mpoo1opte nct ( s2rr(r ;o0aex if3tydfmDelu s;u0 etrmf3oadomD  n i t)t2tmio iudal elfvtl(faDurum ;u1oee ii3ildfa2elu snu4altoioctatlpD aivi;( trtrio oo1aptnlnci ()srrru p;u4opto ociad aDel(vo (0alxomo totlp e n ilt trxrxopiydlp emnes t)srurxm no1tlen o3tytfs2elnvpnu)aleoxf3iadlaDrlu o s0texr(r nu1omenlivtatfsDtmurpno0aex iiciltls uan s;u)altrxrctydfat  uvsl(0 rxo(opoodopenlfvtlt arua(rpou0apenmoetytlm2ua(mo t0trtoio ia1la   ieo;t0sexr(r iudop  lnetls)arrmurpno0alxoiictytfsDrluvs t)trtrxr iydfpDelnvo t)trxm(mpiu4opt lfeias) 2uaxmo;t4opt  oeiadfs emnmo ()aexrifciadfaDe nei t)t2tm(opoy1lm emnviasf Drmxrooo0aptnifcilsfmDra(mp t) reoxfcty1fptr i i;s) exmir3nu1lltelnvsls) rur(mo;o0tltn fciytlm rau s;()tleomrcoy1om r ues;t0t2tmio io1ll e ietas) rua(m nu4tlxnmi3iadfaDum(vpnt) ltoxfcoa1opt  n s s t2uoio3iu1optemfct s srta(root4ole  ieildls2umnms u4aeeoifctadlm e neslt)setoxr ou4op e fct (fa2trxmp;t0tpe mictas sDrm(mpnu4trtrmo3to1omD  ieo t) rumxmpoodlpt micias) rraxr no1ope mo3tltfm uanmp () rxrxf3oo1fp eauvils0 ruoxr3no4amteliesatfaDtmurpou4apxo f3tatfmDrln p t4 exrxf3oo1la e n ils0truoxm ny4lpt micsa()aruaxmono1tet ifciyt m2rm(mp;(4tlxnio oydfateai ils  rurxrpoo1apt lfctl( sDumumpnt0aet  o3ilt mDea(vp;u) rerxf iy1fat  n o;(0s2xrxm nudope mfes t aDuaxrooo0apen o3iys s2emnvp t4texoxf iodoateaieo t)t2xr(rpiu1apenlnvta( aDraxrpnt1opto feias m rluvpnt4arxnif3oadfptrai i t srtrxrpoo1ale lfvta( artaxr ou1tlxoii3ildlmDumu p;t4aeenirctytfmD  neslt0seur(r3oo1lpe  feilsfa2tmx p;u0tpx  iciat a2rmnmo;t)tlxrir iy1fp  luesls) rxmio3oo4altnlietas sDtr(mpno0optoifctydlm rmumonu0arenif tytlp  an i s t2ur(o3oy1om elivsat aDta(rono0aleomoeiysfa2ea(ms;u0alenmocoa1fpDe ieo;t  euo(m nu1ale mivs s sDua(m no1oetnmi3iyd a2ean o;t4aexnxfcoatfm elnesls)tetmio3no4lp   fcta(farta(  ;t4tetoii3iytfsDuluvpnu0 eermfcoy1fpDr u s;t)tetmim3oy1llenlfcs s)sruaum ou1apenii3iat a2rl(mp;t)alxoxf ty1fm eanvs;s s2tmim ny1lmte fesat  Dtrx o;u1oltnifeiytfm ulumon(4 eeoxr3iodopDrlueslt) 2xm(m oydlm   fctl( arra( pot1ape  iciadfa2ulnvo t4 lxoifciotfpDeaneols)texmirpnydlltnlnctl()sDrax pno1tee  oeiadlm2ulu o t)trenmr3iodopD  i o (  2umxm3oy4ll  miet sfsDta(r ot0opxomieiydfmDrmnmont0tetrxfcia1oaD auvs;( t2tmxo iydamt mfvtas aDumurp;t1tlenmfetytlm eauvs u4 ltoircoytlat ai i;t) exr(m3iu4altn fei t  2umxr ;t1tle mf3iatfs2uln s (4 leomrcia1la e i s t)texm(r ou4ol e nctat) rtaumpnt0aet mi3tlsfs2rlnmsn(0arenxf3tadop raivo t  2xmirpoy1ol nlnctatfa2rau poo4tetoiieiat mDrl(vs u0altnio3ty1omD lnei () rxoiopnudamen nctl( arur( pno1tltoio3tatfm uanvo;u4tetomr tydfaD livi;t) rxo(m3oydole lfei t  Dumxr oo1oexo octytfaDumn p;u0 renif3oytfm   u ols0srtmim3iu4openmivta(f rtm(r nu0oeeoiieiydfs2eluvp;u)tetnmo ootoa elivi;()t2tmirpny4lp n ieilt  rum(m ;t1aex mfetyd m elump;(0alxnmr to1fp  li ol() etoxm3oo1ole lietlt aDrrxm ;t1aetomoctydlm ul(vp;u4arenxr io1oa rluvi;(0trxoiopiydlp emivtat)srrr(rpoo1olx moeiyt sDuanmpnu4altoir3io1opte ieo s) 2ur(opio4om emfcs s)sDtaum no1olt mfeiaslaDuln s;t) rxomfctotlm e nvsl(  exmxm3oudaltnmnesl(f Drmuront1oeenifetatlm ul(mo u4treomociadfp e ivi s texrim io1alen nvtlsf Drr( pnu0alxo ieiltfaDulnms u)tlenxf3io1laD  u o;s) rurxopiu1alen nvia()aDtax o;o0aeeoiieiaslsDelu pnt4 rtrmrcia1fpDrlnes ()s2xm(o ny1aleemnei tfaDur( pou0optomoetytlmDrmuvs t0teenmociy1fmt auvs (0texo(r nu1ol nmfviat) rtm(rpou1tee  f3iytfs eaumonu) rtrmrcoodop   i s;t0s2to(m3oo4llt lfvslt  rta(rp;o1tpt  i3ilslsDel( s t0teeoxo3ia1la elu s;s  rtm(rpio4om n ieilt)arrru pnu1tpenmi3iasfs rmumsn()arxrxf io1laDr n o s) rxo(m ou4alee nctatfaDtr(rpot4ole iictlsfa ul(vs t)arxnmociotopte i sls)truoxm iydal  licia(fs2rr(ro;u4tlt miciysls2ran p;t0 rtomr3oo1oa   n s s s2urxr3nydlp n ivtlsf Durxmpot1aleoif3tyd a eau o;t)texoxo oodop r n sl()teumxo3nydlpt  nctlt sDta(rono4olxo f3tadfs rm(vs t4trtrxr3oodomt  ivi;t)teurimpno4ll n fcil()srtru ont1alxoii3tad a2rl(vp t0 eerir3todfpDeliei t0 2urxopiy1lm  mfei (fa2uax  ;t0tlxnmocilsfs elu s;u0trtniociadfm r iesl(0srtoir3no4lp emivt tf rumxrp;o1tet  f3tltlmDul(vs ()trermo3totlaDe ivil(0srxmir iy1optn icsat) rrmx onu1optomf3tlt m2ean p t0texrmf iadlm eaivs;t)t2trir3oudop elics ( s2uaurpoo0olxoiictasla ranms;u4 rtrmfcoadla  lueilt0s2to(r3iu4lltelnesasf 2tr( onu0tlen i3ilsfaDeluvo t)aetoxrcia1lat lnvslt) rto(o3iodal  mfcil(  Dur(moot4tpt iociadla2rlnvsn()tlxoifctotoat  ivi;t  exm(r io4ll emnciat)a2uru  nu0olxnmo3tadla el(ms;u0 rxrmr todfpDr ivils0trxoim3oy4olt mietltfarur( pno4altoiictydls2emn pn()aexrir iydoptr n s;(0 rum(o3nydamte neia(  Dtaxrooo0tlen ictyt m2uaums;(4 lerxr3iytfm rluvs t) 2ur(r3io1opt lnvs tfaDrau ont0apxoiiciydfa2umuvsn(0aleoio3iadfatrluvo;s)trxriopoydlm e ivi sf Dtr( oot0alx  ociydls2ua(ms u) exomf tadfaDeaneslt)s2xo(rpoo1lleemies s)aDrmxrpoo0aexniocilt aDrlnmp;t4trerxociy1lateaiei;() 2xm(o3ny4lm  micias aDuaxmpno1alenioetydfm2um(mpnt0arxoif3tadfatelneo t0 2xr(r3oy4olt lnvia( arrr(ront1aexn octldlm uanmo;u0 ltnmo oy1lmte ivs;s0trurio iy1oltelieta()srrrx pno0alenmf3tatla2ua(msnt4altnxr3tatlmDr ivs;s0 rum(opnudlpeelictls a2tmur nu0oltnmociltfs2ran on(0trermo ootlateln sl(0sexo(mpoy4ll  lneiltfarrruro;o1apxoiicildfm um(ms () renif iy1oaDrluvs s) rur(mpnu1llee nei s)srua(m ;o0tlto f3iytfmDrmn o;t0 rtnmo3tatlmt ai i;t)trtm(r3no4omen iesls  rrmu oot4apxniociadls emnvp t0 eermr3tydoaDelnvo;t0trxmim oy1ol e ies s aDumxmonu4opxnmo3tasfa um(vp;(4arenmfctadlm elieo t trxr(r3oodam   ietasf Dtmx  ot1opeoiictyt m umu sn(0artrifciydlpte uvs;t0s2xr(r3ou4op e fcia(faDumx  ot4tltn icils mDrauvo t0aexrxo3oodoa  an ols0t2trim3iu4lleemnei s sDrr( oou1texnmieiatlsDulu p;u)tlxnxr oatfpDr neilt) 2xrxmpoodom nmici s)aDtau pot4ope  i3ils s rmnmo;t4alxoirciodlm  aneo t teum(r iy1omenlnes t)aDrr( p;o4tpeoiieiydfmDra(mp u4 exomo tadlmtrlu ols0truoio3no1omte fcia() rtrxm nu1aetomietldfaDea( o;()trxoif3ty1om  lu o;t  exm(r oy4lpee fvt (faDuaxmp;o0tpxoiiciadls ea( p u4 etoxo ia1omteaivi ( teur(m3oy4lm n fcsl()aDua( pot4tlt  i3iaslaDua(mp t4aetrmrcoodlpt li s s seum(opiy4ol elfvtl( sDumum ;t4olx  ieiasfaDrauvsn(0alenif3oo1fpte nes;s  eur(rpnodol  liei s)s2tau o;u4alt ifcilt s2rl(mp (4tetniocoa1omDe iesl()seur(opno1altemncsat  2rrxrpno4alx mociydfmDrmnvpnu)trxoir3ootfptelnvo;s)srxr(o ou4alte netl() 2umxrp;t0opt  f3tld m2um( snu0artnmr3oadopD aueols) exoxopnu4op nlieslt)s2ururoou1ole ifctyd mDuanvs u0tlxrmo3oydla  luvs (0 etr(o nodlltn icta()srtrumpnu4olx mi3iadfaDeauvpnu) lxoirciotfm   u o;(0 euoim iy1lltn neslt) Dtm(m ot1aexo o3iys m um(ms;t4trtnmf oadomDelu sl(0s2to(mpiy1amt  nesat  2tax  no4opx mieildls raumpnt4 ltrmr3oo1opt lnvs s srtrim3nu1llt mivi ()aDurum ;u1tltomfctadfs2uau s;(4trtnxf3ty1lm ran i t) 2xmir io4apt mfes s sDrmxr nt1aex  f3ildla ea( snu4alxoio iadfpteauvi t)setr(o3ou4opt  iesas) 2rr(  ;u4opxn o3iyslsDuluvp u0 rtnio3tytfptrliei;( s2uoxm iy4amtnmfvt t  2rmumpoo4texnmictytfm uanvsnt)aexnmfcoadlmtrlnei;s teuoxr iy1ap elictlt srtrx ont4aetnmictydfm2rm( o u4tetrxocoydfmDeau ol()texr(r3iy1oltnlivtas aDrmu p;u0tpxoio3tatfa2ea(mon()teermrcia1la eauei;s)t2umxopoo4am e nci t  Dtmu p;o1olt if3iaslm2ua(ms;u4artnxrciadfmt  ies (0teuo(m nu1ll e fvtat)s2taumo;u4ope ii3tatfm rauvpn(4 exrioctadomDrau i s0t2xm(m iu1am emfet t  rumuroou1tpxo ociat a uaump u4treoxr ta1lm e i ilt)t2tmir oodomtemfctl(  2ur(mp;o1aeto ociad sDrln o;(4aetomfcta1om   i i;(  2ur(r iudame  fcsas) Dtm( o;u1oeeomi3iydfm elump;u4 rxrxo iatfp   iei;s0s2uoxrpiodopeemnvi ( s2trxm ;o1alt  feiytfa ua(vp;t)trtomf3iodlm rlues;s t2um(r3ou4op e nvil(fa2rrumoot4tex mo3iysls2ra( p;t4 etrxocto1oatelneols)t2umxmpoo1ome  ncsls)a2rmurp;u0olt iieiadls ra( o t)tleoxr3oytla eai o s)texoiopnydlmt livsatf Duaur nt4apxoifetys a2rmumon() rtnmr3oydomDean s s  2urxm3iudapeemfcsa(f Dtr(r ;u4tex iietlt m ulumont4aetoifciatomt  ieo s  2urxmpiudop nliet tfsrumur ot1olxnmf3iatlm umnmp;()tltnmfcia1fa  livs t t2tmxm3nu1opee ieia(farumu  ;o0aet  f3ilt mDeaums;t0arenxrciatop r ies;t)tetoxr ny4lpen fetl(fs2tmumo;o0altnifcils aDean o u0altrmfciotlateau i;t0setr(r no4lm  lncsa( aDtmxmpnt0oeen o3iadlm ran p (4teenxr iy1fatrluvilt)t2umxr3oodoltn ncsa(  Dur(  nt0oexoioeiytfmDrl(vp;u4 eerircoydop e ivo t texrxr iudop emiet t)sDrmu  ;o1tlxnmociyt m eauvont0 lermociy1lmD aues () 2trxmpiy4om emfcs t aDrmu pnu0apt ioetytfa2elnmp t4treoio iodom rlivil(0s2umxm io1op eliei ()sDuru ooo0tlt miciyt s2um(vo;() rtrxf3to1lpt  nvi t)seto(m oudll nmivt s artmx p;t0opeo oeiadlmDrlums;u0aeeoir oytlat livs;s seum(m iy4ll emietls a2rrxmoot4tlx  oeiys sDrl(mont0 ltnmo3ta1op e i o ()s2xr(o oudap nmfvt t sDururont1apxnmi3tasfa ua(mo;u)altnxf3oo1lp e ivi t0 exmxopny4aptnmnes t arrr(m oo0tptoifeiyslm2rl(vo;(0alerxf3iadfp  anes s) 2xm(r3io1lmt livs tfaDumxmooo4alenmf3tasla uauvpnu)altrir tytom r n o s trtmio nu1amt lnvta() 2trxr ;t1ope mfeiat s2eluvsnt4 lxnxo3oydfat ai
\ No newline at end of file
@@ -0,0 +1 @@
+u i;t)sruo(rpiy1opeemncsl( aDtr(root1oee  ieiat a2eanmo (4artrmociadfatrluvs;( trxr(o oydlm e nes s aDtrx pou4tlx ifciydlm2elnvpnu0altrmrcoy1fa r ueolt seurxr nodope  nvtlt) 2trur ou0opx io3ilsfa uluvpnu0trxnircoydlpDrliei s)srto(m oo1alt lfcs (fsDtauro;o0olx mocildlsDrm(vp t4trxrxrctadlmDe ieil(0 exmxr nu1ll  mnciasf Dum(mont4apx iociyt s el( s ()trxrmf3todfm r iesls texmirpno4am  mfvsls  ruau  ou0opeo ieiatfs elu p;t0trxnxo3to1fateau sl( t2uoxr oodomte ici t  2tr(moot4aetnmf3tldfs eanmon() lxoir oa1fmt aieo s0seumir iydllt  nvsltfaDur(m ;t1ape  ictls s uan o;t) eeoif3todopD  uvil(0srumiopnudomte fvs t  Dtrurp;u4tex iictatlsDum(vp;t0trtrmo ootlp  lnvsls)s2xr(mpou1alen iesl(  Drmx oot0aexomo3iysls um( pn(4 lxoxf tydlp eluvs t) rurirpou4ope lnes sfsrrru  ;o4optomociadfm2eanvs u0arenmr3tadlaDean ols) rto(m ou1ope liesat s2rauro;u1opx ioctat a um(mon()tetnir3ty1op rauvi ( t2xo(r3ny4lmenlnvsas  Duaur ;u4aee  oeiydlmDra(vs (0artomocoy1lp elu i;t) etr(r3no1lpt lnetltf 2tmumoot0oet  feiltfa2rlumonu)aexnmo oa1fm r ues ()s2tm(m no4lle lnei ()sDrr( onu4tpe mieild m rmnvs;()aexnxo oadlaDe u slt  2xmir3nudomt mnvia()aDumxr nu4altomfctldlmDulums;(4tlxomocta1latrlnvslt0srurxrpiy4amt lfct t s2tmx ont1tleomiciyt aDumu p;(0aetnir3tatlmDr ues;(0trxmxrpou4oltnmnetat) Dra(mpnt1tex ifciltlm rl( s u4altoif iadfm eluvils0 2tm(r oudlpe mfcsl(fsDuaxmpou0oeenmi3tas m2ranmonu4teeomr ia1oa r uvs;t0setmirpnodlm emnvi (f rur(r oo4tetomf3tatlm2rm( p;t0tltnir io1oat liei;t trtrio3oydapeemnctas)s2ururp;o0tetoio3tlsla eanvo t0 leoxrctadfa rlu s;() rumim iudamtn iei tfaDtrx ont4oexomoctytlm rl(mpn() etomfcoa1fp   i o;()sexmxm3ny1aptnlneiasfsrrauront4oltniicilt a el(vonu4 exrmfciotomDrluei t s2trxr3oo4om nlnesas) rtaxr oo1tpeo i3tysfs ulu snt)arenxf3iotfmDr neolt  exrxopiu1aleelnvslt) ruru oot4tpxnmietatfs2ulu o t)teerxf3tadlp   iesl( t2urimpnudlle lnet t  Draur ;t0tpxnio3iytlaDemu pnu4 rermf3iodomt aues;t  exo(opoo1lltemics ( artr(m ;t4olto o3iytfm2elnvo t0 lxniociy1oatrlnvo;t  2to(opnu4am nlfetat aDumxmooo4aptnmfetldfa umnmo;()trxoio3io1fp r n s;t)s2ur(rpiydlpee nesl(f rrru p;o4apxo ieiasfa2elu o;u4 exoxfcio1fat  iesl(0 rtoxo ou1ope lnct s)srta( oou0oex ii3ildfmDelnvp (0texnmo iy1oat aies;s)t2tmxo3nydal emics s arraumooo4tee  fciatfm rl(vp t)altnxfciydfmDrauvo t0seurxo oodope mncilt sDraur nt4aexn f3tytfm uaumpnt4alerif3iadlm   nvo;s t2toxr3oydop  lfci s arrr(  no0tpeo o3tas a ranvont4 lxoxo3to1fpDrlnes;t)trxmir3iydal nlietlsfarur(r nt4tlen i3ilsfm eanvpnt0 rxoxr todlmt li ol( teuoir3no4aptemncsat aDtrxmo;t0apeomictat m ua( o u0tleoio oatfm e uei;s  eumir3oodapenlfvtat)arrmxm oo0altnii3ildfm2uan s t0 eermrctatfpDelu i;t0texm(mpny4om  lfeilsfarur(  nu0oeeoif3iysfs rmnmp;u)teenio todopDr uesls)s2tmxm nodolt  ict (  rururpot1aet mictytfm elumpnt4 lerio oo1opteauvi;( tetoxo iodomte nvsls s2tm( ooo1aptn ictadfs2rau snu4arxrmfctatopDeanvils)seuoxr3ou4altelfvsasfs2tmurpnu1opxo o3ildfaDrln o;(4 rtoio tadfmt  uei t sexr(mpou4lpee nvia() 2rm(monu0tleoifciltfa2emuvsnu)teenmr3iadopDrlues;t) eur(mpoo4altnliet () 2ta(m ot1tlxnii3iytls2em( pnt4 rxrmocoo1faDeau olt)seumxr3oo1ll  lnet () rtrx pot1tpe ifeiysfa2uln snu)texrircty1omDeaueo;(  2urxm3iy1lpe  nvia(fsrtmx pnt0oeen o3tlslsDrl(mp (4trxnir tytfp rlnei;t  etrxr3oo4aptnmivilt)srrrxrp;o1aetomo3tld s2rl(ms () rermfciatfm  li o s0t2uoim io4llee iciat s2taxm ;o0teeoioetatfsDum( o;u0 lenmrcto1lm   ieo () rurim3oo4ol  miesatfaDum(root1alenif3tys a eaumo u4 reoiocta1lm  livil(0t2xo(o iy4omenmivta() Dumumpno4teeoioeiadfm elnmp;(4altoxf iytfmtrlueo ( tetoir ny4alenmfvsat a2ur(moot0tpxo fciatlm2ul(msn(4altnir ta1fpte i i t setoxm ou1ame micsl() 2urxrp;t1aptomo3iltlsDeaumo;u4 eeniocta1faDraieolt)srurxo io4aptelfet (fsrtmumpot4tlx  oetltlaDulumpnt4tltomrcoy1lm elnes;s)s2umxr no1lpe mics s)aDumxrpno0aptn feiltfs2rau s;(0trtoio iodomte n i t0 eurxm ou1omtn ivsls artaxmonu1oeenifciadla ea( snu0 eerxr oatopDe neo s texo(o3nydlpee ietat)s2raxront0oetn o3iydfm ua(vp;(0tlxnxo oodlptrlnesls) etoxopoodaltemnesatfarrrxrpou0open octysfmDulnvsn()aetrmf iytoaD li o;(0s2xrir oodap emicsl( a2rruro;t1alxnioctltfsDea(vsnt0trtrmoctatoaD ai o t trxo(rpou1lpe lfcs t arta(rpot1tet moeiatlmDel(ms;u) etomo oytla r nvs s) 2umim3oydlp n nvt ( aDrrxr oo4apxn f3ild a2elu sn() eeoxr ta1fp  anvsls)srxo(mpou4lm elnci ()sDtrurpou0tleniociatfs2emu o;u)texniocta1op  ai ils srur(o iydlleelnciltf Drr(moou4texoif3iyslm rmuvo;u) exnifctydlpDeaiei s srtoxr3iu1am e nvsls sDtrumooo1aex  ociyd m2em(vsn(4 lenmf ta1faD auvo;(  rurxr3iy1amt mnvi t)s2tax  no1tetomf3tas s2rlu p (0aetnxo3iadopDr ies;s) rto(o nu1lltn iei ( arraxmo;u4olenio3iadfaDum(vs ()artnxocoatlpD livi s srxoiopiy4lp emnvsas)aDuax pou4tlenmi3ilsla2rauvp;t)tleomfciydlmDranvsls  exo(o ou1apt mictlt  rrr(mpou0oet mociaslm uauvo (4 renmoctydla r n i t) exoim ny4omee fctls)arra(m ;t1olxomoetysla rln o;t0texrmfcoydopteau i s  etrio iy4ll  mnvtl(  2tr(r no4opxn ieils s2rm(von(0 ltrmf ia1fpD aivi () 2xo(m3oudopee ncs () rtm(m nu0aex mociysfa um(mo;(0tlxnxf3to1fa eauvo s texoirpiu1lmeelfviltf rraxmp;o4tee iicilt m em(vpnu) ltoif3ta1lmtrlneo (0teuoir3iodlm n icsat) Drrx poo4tptoif3iltfm2rmnvo;t0alxrmrcoodlpDrlnvilt0s2xrxo3ny4ope lnviat)srraxrp;t4oetomi3tad m2umums;u0 ltrxr oytlptrlnvo;()s2xoio3oydomenmicsasfs2ta(  oo4alxn fciysfsDrm(ms t0aeeomr3ootfpDrau o s)trtmir oo4amtnmfet tfsDua(rp;u1tet mieilsfa2ulnmo t) rxomr ty1la rauvs;t  2xo(r3oudlmenmfctatfaDrm( p;t1tptoif3iysls2rmnms;u4texnircoodfmDeaieo;(  rto(mpno1ll  lfcs s)a2uax pnu1oetnmieiltfmDea( s t4teermocty1omtr u i;s  rxo(r iodal  lnci (fsrumurpno4tpx if3tadlm ean s (0 eermrcta1opte nvs;t  exoiopnudomtelfvtlsfsDrmu oot4apx moeiltfm umuvp;(4tltnio3todlmteaneo ( t2xrimpou1lpt mivia()a2tm(  ot1tpt  fctydfs2rl( s;(4teermfcta1omt auei;t0trumio3iu4ol emneiat) Dumur nt1opxnifeiytlmDulnmo;t4 ltomf3iatfa eaivilt) etoiopio1lm nmnviatfaDtr(m no1tpeoioeild m2emu o (4tleriociotlaDrlnvsls setrirpoo4apenmiviasfaDurumonu0tleniietls a emnvs;(0tltnxo ootlm e u sl(  etoxo3nudalenmfvsa(fs2ururpot1aleo fetyd a el( pnt4artrifcio1fateluei t  2uo(mpiudll elfesas) 2uru pot1tpenmi3ias sDeanvont4 ltoxrciydfpDr nes s0srtoxopou1amenlnvs t)sDtaxro;o0tltomicils a2uau s t4trxoif3iotomteauvs;s0trtmimpoy4ole mfvt s sruru  nu4oeeoifeiyd sDea( onu)aetnmf ta1laDr u s s)trxoxopiy4al e icil()s2rax  ;u1tpxoioeiatfa2umumont0 eermr3totfmD  nvs (0tetrim iudamtnmnviat  rtrumonu1aee ifciyt a umn p;(0 ltomo iy1fmDelnei;(0srto(m3nu4aptn iet s)srumum ou1ole miciaslm2um(ms u) etnifcoa1fat  u il( t2xrim nydoltnmici (f Dumxmpou1alt ifeiat mDulnms u0 exnmf3ta1fp rlu i;s)t2tr(r oo4aptn ivsls sDur(mpnt4tee  fciytfaDranvp;(0aetrir3todom e n slt)srurxr iudale lnvia(farta(mp;t4tlxomociysla2uanms;t0alerircootfpDeau o ( srxmim iudlptnlies tfaDur(rpnu1oexomictldla2umnms;u0 exnmf oytlmt lneil(0truo(opnudope  feia( s2ra(m oo1tpt  f3iyd s2em( s;t4trxnio3ia1fatr n i;(0tetrio iodlleelies () 2raurp;u0tltnii3iytlm um( o u0 renif ootlm raueo;t sexrio3oudom e ivs () Dumurpoo0aee  f3tytlmDranmp;() exoirctodopDeauvs;(0 2umimpiu1apte nviat) rtau pot1tet mieiatfaDuanvo t)artrir3iydlaD  neol(  eurxm ny4llen nvi t) Drr(  ;o1ape mfcilsfa ra(vs;() rtoir3oy1fp  lnvi s  2tr(rpnydaptn fctat)s2um(r ;u1oex  feiyd mDrl(mpnt) lxnif tatlptr ivi (0trxmxr3io1am emiviat sDrau o;u4tpeomociydlmDrmu ont4teeriocto1fa rluvsls) 2xoim3ny4op   nvil(  rumu ono4aexnmicilsfm2ran o;u)alenxo3to1la rai i;()setmir oo1ll nlfvil( sDuauront0optomf3iat sDrl( p () ltrxr3oo1fa e ivi (0s2umio oodom nlnvias artaxmpnu0tpxniietatfa2ul( on()alerxfcoytlp r uvs s0truoirpiu4ape  fvias aDua(mpno0oetoiietytls2umuvpnt4 ltnxr3ia1fm e i s () 2to(opoydlp emnei (fsDtaxm ;t4apx ifctasfaDean o;() rxomo todla ranvsls  rumxmpnydoltemfvi ( srrau pnu4oeto ictlt mDemnmo t4aexrmf oodfp  ln o;t0trxoimpno1lmtnlivtatfs2tru  nt1ole mfeiyslaDeanvp t)alxnmo3tadlp  auvo t0s2tmio3oydlp e fvt tf rrrxm ;u4oeeomf3tys a uluvpnu4aetnif3ta1fmt livo;s  rxoxm3iydlmtnlfet t)srraxmpnt0ole iociytlmDrln s;t) exoxf ootomDranvil()tetoim3oydomeelfvi sf rrmu ooo1oltnmfctydfa ra(msnu0trxnmo iydomD lnei ()tetrxm3iu4lm nmfvt s a2taum nt1aptoifetatls2rm(ms;()altnmrcoadlpDelneo s) rxr(rpio1lpe mncilt) rumumo;o0teenmo3tasfaDelnmp;u0altrxo iatoa raivo t  exoxm3ny4apenmiei t)sDumxrono0opeomf3tld aDeln o;u0teeomo oydfaDeli il( sexoim nudopt livs (farraxm no1tlt if3ilt sDeauvs;()tltomf tydoaD ai i;s) 2xm(m3iydome livsl()srtrxro;t4oexniictyslm2em( p (4aetnif3tytom r u i;t0 2to(m3oudaltemnvtat sDrr(  ou1olxomf3tytfs umnmsn()tetrxoctotoa r i o;t) 2trxopnu4amt lncia(  2ra(  nt0aleo ieiys mDul(ms u0aexomociodfmtrli i;t  euo(m io4lpee ivi (  Dtm( o;o1tlen o3iad aDuan s t4tltnxrctadlpDrau il(0t2xo(o3nu4lmen fvt s srrru p;o1aexo feiasfaDrlnmo;u4 rxrxo3iadfaD auvo;(  2uoxo3iy1lmeelieils a2trurpnu4teeoio3iasla2rl( s;u4 rxrircootlpDeauvo s  rxriopny4ll   fcsat srumx  ;t4oleo ieiasfm uluvo;(4texomr oa1la r nesl(  exo(rpoydlptnmivilsfsDrmu  nt4tpt ioeilt a2umu s;t4tlxnxo iadoa rlu i (  rxmir iudapee ivslsfs2rax  ;o1openmfeiasfmDrauvs;()artrxf oadlpteluvo () 2xmxr iydllte nvslsfsrra(rpnt1tpeomi3ilsla uan p;(4arenio3oa1op rln olt)s2xo(r3no4omeemnviatfaDtmur ;o0optnioctls sDeln pn() ltnxociodfmDe ivil( s2uoir3nydaptemiet sfsDrm(r ;u4aptnmfeilsfa2uln o;t0tetnxocoa1lptrlnvi ()t2xrxo oy1amen fcsat)srtax  ou4tlen o3tlsfs umnvs t4arxrxo3iydfateauvsl( texoxr3iodape  nctlt arra(rpno0tlt mo3iasla umnvonu0 lxrxo3oa1fm  aivi;(0srtmxo iy1lmtnlivtat)sDumx pnu0tlt iocild a2eaump (0 rxrif iytfm r ivs;t)texmir oy1alte nvtas  2rau p;u0alen ociltfm rln pnt)treoxr3iatopt  nes () ruo(rpiudoltelfeta( arta(  ou0teeomf3tyd mDrauvpnu4texnxo3oodlaDeau sls  2xmio3oodlmt mivi t  Dumxro;u4opx mf3tyd s umn snu0tlenxr3totlatelnes s0 rumim iudam emieia()arumx ont0tptoio3iatlsDum(vsnu)alxoif oo1lpteau s t  rumiopnydolt lietl()srra(mono4tetnifciydfm rl(vsnu) ltrifctytoptr n i t0 2umim3ou4lm nlici () 2tr( ont0aee mo3iatls2rmnms t) rtnif3ta1opDeaieslt) rxo(o iodap nmnesl()sDrrx oot4olxnmfctlt a el( on(4tltnxf oatoa r nei t0 rumxo iy1amtnmietlt) Draxrpno1oexo ieiyt a ea(vo;t)trxoir3oytoat ln s ( srxmir3iudlpt  fvslsfaDra(m ou1oeeniocildfsDumuvo;u4aetomo3tytop raivi t)trxmxopiu4ll   ieiatf 2rmxr ou1aptn fetas mDumnmp;(4aexoifcto1fp eaiesl()t2trxr oy1ap nmnvs t a2tax o;t1altniictatlmDuau p t4 exnmo3oadfmD lnvo;s0trxm(mpnydapenliesls)a2ra(r ou1tpt ioeiltfm ean sn(0trxomfctytopD anvs;t  2tmxo3oodape  ics (  rrmu pno4oetomi3ildlm2rmuvp t0trtrxr3iytfmDe n i;()setrxo3iy1openmiviasfsDrmx oot4tetnifcilt m2uln p;(4alxnio oydfmDrlivo s t2urxmpou4ope lfcsa() Dtaum ;u0oltomieildlm2rlnvp (0aetomr iytfateluvolt  rtm(rpio1amtemfvs s)aDur(mpnu4apenii3iaslm2umuvo;t)tetnmr3todlp r i ols0seuoirpiydamtelneslt aDtr(rpno0apxn ieildfa2uaumpnt) etnircia1lm r n o;s  rumir ou4aleemnvsas  rua(mpnu4aetnmfetasfaDea(mp;(4 ltomo3oy1la e n s;t  ruo(m oydamtn iviatf Drmxmpou0alt mieiydls2rm(vo t0tlenxo oytlatelu o () 2xrxo iy4llte fcil()sDraxm nu1opto oetlt m2ulu ont) etnircoodfpDrau o;(0sexrxm3oo1lmtnlneil()a2umxmonu1olxnioeias sDrlnmsnt)aetrif oodop rluvil(0texrim3oy4lltnmfviat)arua(  ot4aeeo iciyd a2ulu o;(0teerif3oatlmte ies ()t2xrxopio4apt mnei ( srrm(mo;o4altnmieilt aDea( p;u0tlxomrctytfa rauvsls0t2uoirpou1alt lfvi ( aDtm(mooo0alenmfeiasfa2um( sn() rerxf3oydlaDr u s s seumxo3nu4llenlnvsls) Drmxmoot1oeeo fcilsfm elnvont4 exnxo3iodopDe u s;(0s2tmio ou4al n nvi (  rrr(r nu4ale  ieils sDel( o;()altnmfcta1omDrlu i t t2uo(m iy1amee ici s)srrau  ;o1tpx  ieils s um(ms t4 ltnmr3tadomt anvs;(0truoiopnydol   net s) Dtm(r oo1opx  fetytfa ul( o u) rerxocio1fpDe i o;(  2tr(o oydll   nvt (  Dumuro;u0apxnmfeiadla eln s u)aetrmf iydomDelnes;s  2urxopou4op n fci sf 2rmu onu0oexnio3ildfm emn p;() lxoxr3oadlpDrln o;s0srtoxmpny1lmt mnetatfarurur ou4aptnmietadlaDem(vsn(0arxnxr3oydop  livil() rxrxr iodlm emnetlt  2rrx o;t0altoiiciysfm ulnmo;t)altrxociy1fm  luvslt  2tmir3ou4apte nvtl(f Dta(r oo0olxnii3iys aDrlu s;t)tleoxr3ty1omDr u o t  rxr(o iu1al n ietas)a2ua( o;t4oeeomf3tadfm2um(mp t) rtnif3to1lpt  ivo s0sruoio nydlle  feslsf rtax  no1oexo o3tltfmDul(ms;u)aexoir iotfm rliei;() 2xr(o ou4ap e ncslt s2um(mpou1optomociatlaDulu snu)altrxocoytomD  ivs s0seur(rpny1olt  netas)sDua(m ou4opx  f3iadfmDem(mp;t) eeoxfctodopteanes;t srur(m3nydap emnvs s  rurxr oo1teeomfetys a ea( o;(4trxnioctotfmDr i ils) rumio ny4apt lfet s)s2rrxm nu0opx  oetydfm2uluvp;t4 exrmo oydlm r uvsl(0 exoim ou4aleemnct t  Drau poo1teeo octaslmDeln o;u4areoif ty1lm  livolt)srxoimpiu1al  lnetas arumx  no0olto o3ildlaDrln pnt) lxomocoo1lpDranvils)trtr(rpnudamt lietas  Drau  ;o0aet  ocild m2eanmsn(4trtrmr3oa1oaDrai ils0s2toir iy1al  livta(  rrru pot0altnii3ilslm eaump;t4 etnmf3to1lp  aiei;()texoxopiodopeemnvils)artaurooo0opt if3iyd a2umn s u)artnmo oy1omtrlneo;t) rxmim3oo1ol nmfvia()a2umxmoot4apenif3iadla rauvsn()aexrio3iatopt lnvo s0seum(o iy4lpt  nesa( arta( o;o0ape io3tlsfm rm( snt4arxnxrcia1oa  luvs;s0 etoio iu1altnlneils)a2rm(r ;t0altn f3tltlm2umuvpnu) etrmfcoatomte ivi s0 2trxm nodllee iet s) 2ur(mpnu0alto f3iatfm2ulnms;u0trxoif3tadlpDean s t)seuoxrpiydopenmfvi s) 2uaxrp;u1altoii3iatla raums;(0aexoifcoatlatelneo t0 rxmiopou4apeemnetlt)s2umx ono4ope  ocild sDelnvsn()artnxr3tytfp e n o t0 rtmiopoo4lltnmfesls)sDrm( pnu4olenmociatlaDrmnvsnt)aexrxrciotlatrau i s0setm(r3nudol nmfvtl(  2tax p;o4tlxomo3iysfm2um(vo t4tetrmr oadfp eaivo (0tetrio3oy4lm emictl(faDtr(moou1olx iiciasla el(mpn(0 lenio iatlpte ueols0 ruo(o ny1amtelfctls srtaxm ;u0opeoioctadlm el( pnu0 rerxo oadlmteanvo;t t2um(o3ou4lm emivtasfs2rm(rpoo1tee mo3tatfm2rl(mo t4 rxrmo oa1fpte uvs;s0setrimpiudlmtelici () rtauronu4aet ioctysfs uln s t4tetrxocootla r uei s0s2ur(r3oodaleemieslsf Drr( o;t4alenioctls sDul(vp;t0 lxoif oodfpD lues ( t2tm(m iy1ll emivslt sDtm(mooo1tpen f3tltfa2elnvp;u0 lenxf3iydoptrlu ils)t2uo(r ny1oleemfvs s  2ua(m ou4altnmfctld aDua(mpn()arxrmf ta1laDe ies;t  eto(m3iy1omeelivilsfsDtrumpnt1altnif3tlsfm2rmump;(0arenxo ty1fptrlu o;(0tetoxm3ny1lp  lneta()srum(r ot1apenmfcild m2ulumon()artnmf3iotlmDr ueo;s)srurxm io1lmeemietls  2uax p;u4tet moetlsfm2em(vp;u0altrmf3tadfpt  nvsl( tetrxo3io4lmt  fctl(f rua(ronu1opxo f3tld a2uau o;() leoxfctydfp  lu sl( s2trio3ou4om e ieilsfs2uax  ;t4aeen iciaslsDelnvs t0trtrio todfmDrlies s) 2trxopiu4olt lfes t) Duax oot4aex if3iysfa2eaump;u0trtomf3iodlm elueo t)sruoir3ny4lltnlnviatfsDuaump;t0tetn fciad s2eanmp t0trxnmfctodfpt luvi;t  etrio oy1optnmnesas)a2ururo;t4tlxo fciyd aDumu pnu0 exrifcoa1lp rai s t t2to(r3nu4lmtemfet tfs2rm( p;u0oet iiciytla2ra( s u)texrxf3ootlm rln s s t2ur(r no4am   nes t)aDur( pot0ale mfeiytfsDrl(ms;()texnircoy1lpD auvo;s) eumio3oy4lpe liet (faDta(m ;o1oltn fetldls elumo;u4arerxf iydfp e uesls)t2tmxrpnu1am  lnvta()arra(rooo4oexnioetas aDea( s;u0areoir ootlmt anes;( sruoirpiu1amenmieta( s2trumono1altn octldfs2rlnvp;t0teeomo iotlmDr ieo;()teum(m3oo4ameelicsasf Drau ont0open icilt m2eauvp (0aeenxf todoa eaivil() exr(r io1ol  lfvi sf Dur( oou4alto ociydfaDua(vo u0tltrxocty1om elu i (0seumxrpoudap   fcs ( s2rmu  ;o4ape  iciasla rl( p;t0alxnmr oodfm eau s;s0 2um(m oudale  ivs ()aDrmu  ;o1tee ifcildfm eauvo;u4artnmocootlaDeauvo (  rtr(m3ou4om nmnvil(  2ta(rpoo1oetoiicild s elums;u) ltrmr oydlaDrlivols)s2xm(m oo4opeemnetas)s2tmuro;t4teeoifeiad mDua(vpnt0arxnmf3oadfptr neol(0t2toiopiydamt liesl(fs2umxro;t0tpx mo3iysls rlnvs u4texomr3tydfmtrauvols  eto(o ny1apen fct (  Dum(mpnt1texoii3iytlm elnmo u4trtrmr oo1optrlu o t setrxr io1lpen fet tfsDrru  ;t4opeo o3tlslm ra(vsnt4 reomfctotfp   ues s0 rxriopiydlmt  fei t)aDua( o;t1ope  fcildfsDumumo u4aeermo totop  auvo ( t2trirpno1omenmnctls  rumu o;o4aptniieiyd mDel(mont0aexrio3io1la raivo;t0 rxmxm3ny4aptnlicta() Dtr(mp;u0oetniocilt s2em(vpnu4alxrifcootlm rauesls) rxoio3iu1aptemiciatfaDuaur nu1opxoioctls m2rlu pn(0texrio iodoa ranesls)s2xrxm oodalen nes (f Duru p;t4tlt ioctltfs rau p (0aexnxo3tatlmt  u s;(0teur(m3nu4op nmncsltfaruaxm no1olt  f3ildlaDrl( p t) rtoiociotlmDeluvsls)trtrxrpou1llen fvtl(fs2rmumo;t4opeo ietlt m2uln o;t)teerir iodomt ai ol()teuriopiy1lleelnesls)aDta( pnt0ape ifeiytls2ul(mp;t)tlxrmrciydfmt  uvo;t0s2um(m3oy1lm nmieiat)a2um(ro;o4alxniocildla rluvont0aetnio iotoate ivs (  rumxr io4llt  nvt sfsrraurpno1teto o3ilslsDem( p t0aetomf todla   n s;t texrxr3iy1openlncia(f rtru p;t0aeto iciaslaDulu p;t4 eermocio1omte i i t)trxr(o3oo1om nlnet sfaDtm(mpot1tetn ociltfm2eau p t4 lxnir3iydfm elnes (0 rtmxmpnu1ap  lnctls) ruru p;o1tpt mfetlsfs eanms;t0 exnifctodoa   ues s t2tm(mpiodomtemfes s sDtrx o;u1tlxoiieiatlmDranmo;t0trtnxocty1faD  nes;s)texmxmpiudomen fct t) rtruro;o0aet moctld a2rmumont4 lerxfcia1fmt aues s) ruoim no1lp n ieilt  Dta(r ;o1oexnmoetas s ua( o;u0tleoxocty1lateaieol(0s2umxr3ou1olte fetlsfsrtm( ono4aeen oeiatla2elu s u0 leoio3ty1fa elneol(0 etr(mpny1amen ivtat)aruau oot0tlenmfeild m2ua(mont4alxrmocoo1omDe n o () euoxmpou4llenlfvilsf 2um( pou4oet  ietydlm em( snt) lerxocoa1lpD  
\ No newline at end of file
@@ -0,0 +1 @@
+i i;()srtmxmpno1oleelfes t) Duaur ;o0texomi3iytfs2rmnmo;(4alenmr3ta1omDr ieil() eurxo3oy4om  lfcil()aDumx p;o4tltnmfetatls2ea(ms;()arxrmoctotlmDelues t t2xoio3oy1lme  nvi sf rraxmooo4tlt mo3ilsfsDrmnmonu) exrmo ootopDean il() rur(opnudameelivsat)srum( ono4opx ii3tysfs2umums;()tleomr3oo1fm rln o;s t2tmim oydlptemfcsl( aDrm( o;t4aet  f3tysfm el( s;u) reoio iotlate i ilt srtr(m oodal n fciltfa2rau  nt0tetn icilsfmDumnmsn(0tltriociytla eau i (0teumim ny4amtelivsl()s2rmurpnu0ope ifctlt aDeauvo;u0arxoif tatlp   uvo s)t2ur(rpiu1omtnmfvsl(fsDtrxmooo0alt mfctad s2el(msn(0arxrmfcio1omDraueo;s0srxo(r oo1lpt mnvs s  Dtmxrono0tptnifetldfsDrm(mp t4teerif3ootom  aiei;(0trxmirpny1lmtemnvtlt)a2taump;o1tleniieiydfmDua(mo u0 rxnir3iy1optrlies ( srxrimpiy1lptnlfei s aDtrumo;u4oexn feilt aDuauvo u0alenmr3iatfptraueslt)tetr(mpoy1al  lneslt)a2truro;u1oet  ictys m rm( s ()texnmfcty1op  ln ilt seto(o3iu1amee ncsa( srrru pnu0oeenmf3tlslsDrmnvpnt0teerxocty1faDeai slt0srtr(o oudap e fvt tfa2tau o;t4texn o3tyt s rlump;t) exrio oy1fa eluvo t0 exmio no1lmtn ieia()aDtaxront0oex  ociydlm rl( p;u4 lenxo3to1oaDrln o ()trtm(o3nodlp emfvtat) rrmx p;t1aptnioeilsls2rmu p;u) eenxo3ia1oatrlnvil(0sexoirpoo4op nmiviltf ruaur ;o4oexoii3iat mDrlu pnu)arermr ootlaDrlieil()seurim3ou1olte fcta(f rtr(  nu1oleniicias s2el( s;u0altrxf3ootopD aivo;() etoirpoo4ape  fcs ( a2rmx  ;u4ole ioeias a ul(vsn(0 lermr3tatlaDelivolt setr(o3ny4lpen neils  2trxm ;o4aee  feilsfsDumn pnt0arxnmf3ty1opD anvilt  eumxm nudlltemiet sf Dur(rpoo0aet moetldfaDranvo;() eenxocoodlm   n ols tetoxo3iydll nmfcs (fsDtax p;o1olx moctytlsDua(vont4aeeomf ia1optr n il(0trxoxo oy4ol elnvs (fartm(  ;o4olenmf3tysfa2ra( p;(0altoircoo1optrauvi;(0 exrirpiodoltnlneia()aDta(m oo1texnmiciasls rlumsnu0 exrmr tadlp eai i t) etmxm oo1optn fcias)aDrru pnt1tlxnmociltfa2rlnmp ()arxrio to1oaDeaueslt  rtoirpou1altelfci ()a2rru  ot0ole  o3iasfm2umnvs;t)teerif3tydfa   n o ( seum(m3nydamt mncs s srtax o;t1oee  ociltla ulnmon() rxrmfciytopte i s;(0t2tmxm3ou1amen feiasfsrtm( p;u0tpxoif3tatfmDea( s;u) rxnxr3totfp  auei;t s2ur(opny4ape liet () Duax  oo1alx mo3iadls2ra( o;(4teeomo3iydlm eli s t0srto(m3io1apeemfct sfsDrmx oou1tpx  iciltfa ulumo u)treoxocoatoaDeluvsls s2uoir nydomtemics sfartmx o;t1teen oeiat mDra(mo;(4 eenmo3oa1fpD ln o;()srxoxopiodlp  lfvs s  2taur nu1aeenmfeild s2ra( o;(4altnio ty1fmtrlivi t)setoxm3oy4aleelfvsas)s2ra( oot1aexomoetas s ra( s u4artrxf tatoaD aueo;(0seum(opio1lmtnmneta(f Dtmu ont1alx if3iad mDemnvpn(4artnxr3oy1op   neolt setmir3ny1lpe lfvsl(fsrta( o;t1tpxn i3iatfs eanmsnu0texoxo3ootfa  lnvslt) 2tmim oy4alee ictlt)aDta(  ou0alen ociydfm2emu s;t4aeerif3oatlmD lu i;()texmxr ny1aptelnetat s2rmump;t4aptomi3iltls ua( o;(0texnmfcoytfa eaivs;t0seumxr3oo4optnlfeta()aDrmx  ot4oleomfciadls ean p;t0arxnxf3tydomtrlieolt0trto(mpoo1amtnlivi tf rum(rpoo4tptoioctatlm em( s;t4 eenir3ta1fm  aivs;s  2tr(opiudaptn nctatf 2uru  ;u4apenii3tydlaDulnvsn(0arerir oytla rai i s0t2xrimpoy1lmtelfciatfarrr( pou1tex  iciatfa2uln o t0 renxf iy1fmt aieils  2xoxopnu1lmtnlfci (  rtaumpot1tpto f3tysla2rau s (4 rtnmrciodfptraivils)sexm(r3no4apen nesa( sDrmumpot1texo ieiltls um( o t4alxoxo3io1om elu olt trxoxr3nudlpee ivslt) rtmxmp;t0oeeomf3iltfsDrm(vs () eerxfciytop e ueslt)trtoir3oy1ol n ics t) Dra(m ;t0texnmo3iasfsDrluvo;(0 exoifcoatlpDe u ols) eto(r3iu4olenmnvtatf Drmum nt1texo feiadlm2rlnms (0 ltomrctadomDraues;( srxrxm3nu1omenliesl(f rraxr ;u4tpx mociytfs umu p t0tlerxrciodfpDe u i () rtmio3nu4amteliesltf rurx o;t4opxn feiyslm2eln snt0tlxnif oy1fpDrlu i t  etrir no1olenlict (fsDtrxmpnu4opx  fciyt a2um( o;(4 lxomo3tytlaD livs;t)seurimpnudlpenmieslt s2urxrp;u4opxnmfetadlm2em(vsn(0tleoxf3ia1la   ivslt)sexmxo3nudom   neiatf rrrumono0alen f3iltla2rlu p;t0artriociodlmD an i t0sexr(r3iu4al  mnes sf rurx  nt0aetomoctadfa uanvp;()aeermo3ta1lpD li s ( srxo(m3nydome micta(faDtax p;u4tle ii3iytlmDean p;t4tetoxf iy1op rai i;s  2trxm iydll  lfvtltfsrtmump;u1olxomi3tas mDrmn o t) exrir3ty1lpD  i s t t2uo(r3nu4lp   iviatfarrmx  ;o1olt  ociltlm ulnvp t4texoxf oodlmDeanvo t0seum(rpio1lmenmfvsl(  Dtr(m ot4tptnmi3iadla ea( pnt0 exrxr3tatomD an s s) 2xrxrpiudap n ietltf rtmxmooo4apx miciad m2ra(vp t)aexomf oatop eluvi (  eto(r nydopeemnvtlsfsDum( pno4apxomoeiytla2rl( pnu4trerxf oa1fa eaivols)srurimpio1ol n iet (fa2ua(  nu1tpto icias s um( s;u) reoxfciydfmt ai i;t) etriopoodol nmietat)s2um(mpou4alxnioeiltfa raumsnt4teenmfcoodoa eaivil(0srxrio nydal elncs t  2uaxr nu1oet ioeildla rmnvp;u4altrmr tatfmt li ol()trxrim3iu1lltelfci ()arumu ont1texomieildls2rln s;t4 leoifcto1fateli o t0 exmxr ou4lpe livslsfarrm( poo4apt mfetysfa elums;(0aetrxociotlate i ol(0 2to(m3iy4olen ictatf rtmump;t0ope ioetys s uluvs;u)arerirctatoatelnes;t s2xo(o ny4om emfes tfsruaxrp;u0olt  f3iatfmDemumo t)trerio iatfmtr u s (0teuoio3nodole mfvtatfarrmxmpou1altnmieias a2emuvo u)aetrxocoadfpDeanei;s0s2toxm3iydomtnlieias) rrrum no1ale  fciydfa emn s (4 lenmr oatopD aueo;t0seumxm nydlp elici ()a2trxmpoo0olxo icias aDeanvont0tlxrmf iydlateanvs ( srxmimpoudamtn fes (f 2rax o;o0oetoiictadfa2rm( s u4 ltnxf3iadlm e ivs;t t2tmxr iu4lp elfesat  Dua(mpoo0tetomfciasls emnmsnt)altnif oa1latranvo () rumimpiu4amt  fci sfsruau p;u0texo i3iysfm2umumsnu) exrxrcoodop raneo (0s2to(r3iu1ape  net s sDtaump;u0texomf3iadfs uanvo;u) rxnxf3ty1omte nvi;t t2trir nu1ameelnes tfs2umxmpno4olen i3iyd mDua( s;t4tltnifctytomDe i i s0 2uriopiydolee fci s) Drm( p;u1texoiieiytfsDeln o u)trtrio oytlmtrlivs s0 ruoxo3io1oltemietls)aDrrxm ot0oleomieilt s eanvs;u) rtoio ia1omDrlues (0truo(o ny1lpe  nvsltfa2taurpot1tpeomo3iaslmDemu sn(4teeoxr3oodfaDraneolt0truoir3ny1oleemictat)srrm( o;o4aeeoif3iasfm2rl(vp u) exrxf iydlp rln o () 2uoxr ou4lp n iviat) 2rrurpnt0tptnmo3iltfm rln o;(4 exoxf ty1lp e i s;t0 2tr(r3io1olenmnvil(fsrrrxmpou1olto o3tadla2ua(vpn(4 eermr to1lmteln s t  2tm(r nodop  mnvslt)aDtauro;u1optn oeiysfm2ulu o;(0 ltoiociytlm e neols0tetmim nudomenlneils) 2trxro;o1aetnmoctysfm eauvs;t4tltnxr tadlatrauei;t)s2xrio3oy1lpt lnvt t) Draum nu4alx  fcilslmDrmuvs (0trtrircty1fmDelu sls0t2xoxm3no4lp  mfctas s2tmx poo4oltnmictysfa2uan p;() rxoxo3to1lpDrlu sl( srtm(mpoy4ap nlies ()aDtaumont1aet ifeilsfmDel(msnu0tlxnmocoy1fp   uvo s) rtrim nu4ol nmfetlt)aDraur nt1teen ietysfa rlumo;t0trtrxf3iy1fa e uvi;( trtoxr ou4am nmnvt tf 2tr(  ;o0olto i3iatlm ea(vo;u) rxoir ty1oaD  i i (  ruoir oo4amtemfcsltf Dtaur nt1opxo i3tadlmDulnvonu)tltnmr oy1laD luvsl(  etmio iu1oltelfci t a2tm(mp;t1tlto ieiydfs2ul( p u4texrmo3todfa elnvi;() etoxo3no4amt livsls) Dum(rpoo0tltnif3tld aDran on(4trxrmr iydlpt aieo;t)srxm(mpiodll nlncias)artrumont1tltnmfeildfa rm(vo;t0trenxo iotoateli s t0 2trio oo4lme mnetat) 2trxmpoo4aleomietlsfs2umnms;t0 rerxfctotlatran o;t teumio3ny4lm nmnes s  rtm(r ot0olto ietas s2eaumo;u)aleniocoatlmtelies;s s2uo(m no1lpeelfvsat aDtrxr ;t4tpxo f3tld m2ea(vp;u0 renmf3ty1oat an i;s t2toio3nu4ap nmneslsfarrmxr nu0oltoioeiatlsDul(mpnt4trxrif oytop rlueo;(  2xoxr3oydol n nei t  rurumonu4oeeomoctyslmDra(mp;u)texnmr3tydlpD  i i t  rtm(r oodal emfvt (fs2urumpou1opt  iciytfs2umnmpnu4 rxnio iy1fptrlies s)trurxrpny4oltelfcsasfa2uaxr nu4oeeniociad mDrlnmp t)arxnmocia1fatrlu i;(0trtrxopoydom n fctat  Dtmxr nt0aleniiciysls2rmn on(0 etrxr iy1lmt ln s s0srum(m no4opt lnvia() 2taxmp;t4aee moctatls2emuvs;t) ltnmf3oydfmD luvols  rxrio oudlmt liesat)s2tmxm ou0olx miciasla emnvo t0artomr tydomDraivsls)srxrirpiydlpt livsl(fsrumxro;o4apto oeiydfs2rm(vs;(0arenmr3totlpDeanvi;()seuoio iydoltnmies s srumuronu0apeomi3ias s2ea(mont4 rxomo tadop  ai i;t trtoim3iudlm   ivsls) 2umu o;t0ole io3iadfm2ea(vsnu0alerxf3tydopDraueo t0texrxr3iu1lmtn iesas) rtmum ;o0oexoio3iyd mDeln s;(4 eeriociotom r uei;(0t2xmio ou4amte ncsls) 2raum no1oexoifciytfs2emuvsnu)tetrmo oadfmD  u o s tetrxo3iy4ap nmnvtlsf rumuronu4apxn i3ilt a2elu pnt4tlxniocoa1opt ai i (  etmxmpiudal elncsa(fsrtrx  nt1tltomfctlsfm2emump t0trxoxr3ta1lp r ivo t srxm(r3iy1amtemicilsf rua(mpnt0tltoio3iatfm emuvp (0trtoif tatop eluvs s)seumim no1olt mnctat a2rmxr ;t4aetoif3iatls2umuvo;(0aexrmrciytfa  aies;s) euoiopny4am  licta()sDrmxmp;u0apx ioeias m eaump;u4 rxoxr tydfpD  uvs () exoxopoy1ll nlnvs t)a2ur(  ;o0oltn fetldlm umumonu4artoif3iytop e i ols sexr(opoudllenlict t)artm(  nu0ope  fciydlm2ua(vp;t4tlxnmr3tytfmDelu ils trtoxm3no4lmenlncilt)sDrr(r ou4apxoioetlsls ea(ms;t4 eerxfcoodlm rlnvs;s0trxmxo3no1optnlnvta(f Dumxrp;u0apxomoeiadfa2uanms u) exrifcoo1latelivo s  2xrir io1aptn fvslt) 2rrumont1teto fetydfm ua(vs u4trxoxrcoadfpte uvi t) eto(m3io4apt mfeiltf 2taumo;t4openmf3iytlsDrmnmo;t) exrxf3iodfp  lnvil(0sruoxrpiy1oltemfctltf 2ur(mpno4olx mo3tydfa2uaump;u4aexoxf oodfmtr uvo s) euo(rpiydal e nvsat srtaxr nu1tpxnmieiytla2um( snu0 rxniocoydfm  luvo t)t2uoxr3io1op   feia()s2rrxrp;t1oexn f3iytfa2ua( s;t0tltrmoctodoaDr nes t seurir3iodlmt  fcil( a2um( ont1tle  feilt m rmuvs u0 eerio oo1fmteanes;t t2tmxr3iu4lpe mnct tfarurxrpnu0oexomociad s eau pn(0arxnmoctydlmt ai o ()setrxrpnu4olt liet (f rur(m no1tetn f3ias a rm(vs u4aeenxf oatoa eli i;(0srur(rpoy4oleemict t)a2ua(moot0tpto fetas m um(ms;(4arxrxfcta1lpDe u ilt0texmim iydamt  ict (fsDtmu o;u0aptoioctadlsDuaumo;() rxnifctatoateln olt srurir3nodlmtn iesasfaDum(mono0ope  ieiysla uanvsn(4tetrir iadlpDrau ol( srxoxrpnu4lleemnvi s)a2ra( pot0tlt iociyslm2um(vo;t4arenxr ty1omt liei;(0s2toxo io4oleemnes t  Dta(m ;u1oexnifciad s rlumo;()trtoxr tadlaDe nei t0 rxr(r oydopte ivils)srrmum ot0tleo ocildlsDumnmp;()trtrmf iy1fatranesl(0t2um(opoy4om  mici s) 2uaumonu4tlt if3ildfs umnvs;u0aeermo3oytla r u i t)trxoir nydale mfesat)a2urumo;t1ope  ocildfa ra(vs t0 etoxrcto1om   nes s trtrxo oy4open iesat)sDrm(r ;u0oleomfctydfmDua(mo t)aeenifcoa1lp  livilt  2ur(m3oodlm  mfviltf 2tm( o;t1oexnif3iat a ul(vpnt) ltrxr3tytoat aivo t)setoxr ny1lpe lfeta(  Dta(r oo0aexoiicilsfm el( o;u)alenxrciatlaDeluvs s)sexrxm3no4apeeliei sfsDrm(mp;o1tlxo octls sDuauvo;(0altoxo3iydfatranei;s)srumir3io1oltnmfeta( srtmumont1teen i3tydlsDul(vo;()tetoxo3iotomDeli olt srumiopou1lpeemivs (  2umxrono0olen ictat a ran p;u) lerxocoytoptr i s t0t2xoiopio1omeelfctl(  rrru pou1oetomi3tlt a rm(mpnt0texoxr ta1opDrlu o ( srtoim nodlp nliciat  2ta(moot1olt mfeiyd aDeln o u) lxnxr ta1lm r n s s srtmxr oo4am e icil() Draxroot1oet ii3iaslaDul(von(4 exoio3oytfmDe ueils trtmxmpoo4lp e fetls)s2urxmo;t1apeniicils s2umu s;(0 leoxfcoatfate n s;t0seurxmpio4amenlncsas) 2um(monu0apeo o3tys m uanms;() lxrmr iy1lpDeliei;t t2to(r oy4op  lieiat arururpno0optoioctys m2ulnmpnu0 reriocootlp eai i s seuo(m3oo1lmenlies (  rur(  ou4apeo feilsfa ul(vont0trtnif to1fptrlu s () 2xrxo3oudlle mfesa( s2uauro;o0tle io3tas aDrmn o u)tetrxr iadla eli sls)srumim oo1lpt mfvi s  Drm(mooo0olxomo3iys aDranvp;u4tlenmfcoodoaD  ieol(0 eum(mpnodlptnmiet ( srtmxm nu0tpxnifctldlaDeluvp;(0arxniocty1fmDeai s;t t2urxrpiydoltn fvtls sDumumpot4oleoio3iatfsDumuvpnu)treriociatlmteluvo;s)t2toxm iu4opee icslsfaDtr(  ;t0apeo iciadlmDelnms () eermo3to1fpDeli sl(0 exmim3ny1lmtn iciltfa2rmxm nu0ape  ictadfs2rlump;(0 rtrmo3iatfpt luvols)seur(opno1al  lfetas)arta(mp;t1apt io3iltlaDulumo u4aeermr iadopte nvs s)sexo(o3oydlpeelfctls) rumxmp;t4oexn octld m2elu s;t4altnmo totoa rli i;(0t2um(opoo1ale  nesasf rraxm nu0olxnmfctyt sDrlu o ()tltnir3oydfa r u s ()t2um(opoo4altnmfvsls) Drrump;u4apt mo3iysfs2ea( p (4artnmrcoodfaD auvols0srumimpio1amteliei sfsDrmumpoo4apxn o3iatls umu s u) exomf tydlpt luvi ( sexrxmpio4alen fcs s) Dumx o;t4aeeo i3iltls eau onu0artoircoa1oa r nei () rurxo3oo1altnlivi ()sDta(ro;o1ope io3tadlaDrmu pn() rtnxf ty1omte ueolt0trxoio oudlp elivi tf rtm(  ot0texomfetatlaDuan p;u) lxoxo to1fpD li s;s setm(r3nudlp elnvtat sDrru  ot1tpeo o3tys aDrlnvo;u4aexnxrciadlp e i o (0 2trxr3iu1op  lici (fs2trxmp;o1olx  ociltlm umnvsn(4arxnmo iytla rli o;s)sexm(opnudlmtnliciltfaDtm(mont0apx mfetad s emumpnt)tlxrxr oytlpt  i s s  exrio3iudlmtnlncta(  rraxmono0ope mieildfa rm( p (4tlerif ty1fmD  ieo t t2xoxr3oydlmtelfes ()s2rm(ronu1tpxn ociat a2emnvo t4tltniocto1om rauvol(  exrxo3iu4ale  feia( artauro;t4texomieild s ea( ont0treoir tadlp  anvs (0 2xmir3iy4ale  ictl()artmu  ou4oexnmfciat m2rm(vp;u)altnxf tydom eluvolt)srtrxm io1lltn nctlt aDrmump;o1aet mi3iydfaDea( snt4tlxrio3ia1faD lu o ( sruo(m iydlp n icsas s2umxrono1tpeomi3tyt sDrl(mp u)trxnio3iatop e nvo (  2tm(o3oy4llt mnvsl(farrmur no1tlx ifctltls2uanvsn()trxrifcootoatrlneo t)s2xoxm oy1apenmfctltf 2urx pnt4tpeomictysfs rl( s (0 exnmo3oydfmt auei;() eumim3oy1oleemfvsas) Dtr(  nt4tpx  f3taslm2rauvo;(4 lenmr tytomte nes s0srumxm3oy4oltnmivi (f Drmu oou0opxn f3tydfm umnvs;(4aexomr3oodfa  anes () 2xoxrpnu4ap   fvilt s2rmurpno1tlxomi3tad a2emnmp;t0 ltoxf tytoaDe uvo () exrio3nudopt  nvt t srra(  nt4opxoifetltfa2elu p t4texrxr oy1fatelies t)trxr(mpno4openmnvtltfsrum(ro;u4opto ieiaslmDuaumont0altrmo3iatla elivi;t t2uoim3iy4lmeelfctltfsDtm(r ;u0tpt moctlsfa ulumpnu4 rxnmr tydom rlivs;s seuoimpoo1alen feias  rrm(r ou0alx ifeiat mDeluvs;()alxnxrcoytomtrlueo t  rxmim3iodalt mivia(farra(  oo4tptoifeiatla eauvsnu)arenmo3totom rli o (0tetrim3ou4optemncilt srtax  nu1texoioeiltls2el(mp;t4 etomfciatfa   neil() 2xrxr oo1llt mfetl() Drmxmoot1altomi3tadla rmn s (4trerxf iy1om elieo ()srto(m3oodomte ivs sfs2tm(mp;t0tee mfetltfs2rm(ms (4arermf oa1lm eanvs s teuoxrpno1al emncils a2ta(m ;o0tpt  ictas m rlumpnt0artrxocoytoat lnvs;s0 rtmxrpio4lmeeliviltf 2taurpnu4olx mieilt s2uaumont)teermr3iytfmD  n ilt) rtoim3ny4llt mnvias)a2uaxmpnt4oeeoifctlsla2emn p u4 leomoctadfpte nvs;( sexm(o io4amt lnetl(  rtax  ;o4teeniietysfmDeanvp;(0aeeoircoodoaD luvols) exr(opnu1lmeelfvslsf rraxrpnu1apeomi3tydfaDeauvs;t) leriociadlpD  uvo ( trum(r3iy1lmee nvsl(faDta(rp;t1tpxomieildfs2rlnvsnt)trxomfciotfaD aivilt)s2toxr3ny4ll   nvtl() rrru ooo1tptoif3ilt m2ulnmpn(4aexoxr3tytfat ln i ()texoirpoy4lm n fetls)s2trx oot0olto o3tld s2raumont)tetoxfciytfa   nvi;s)trxm(o3iudopenmnetlt)aDtrx ooo1oex  fctldlm2raumon()altoir3iadoaDr i i;( teumxo no1alt lictatfartm(ro;o4olen octysfsDrmu s (0 lxoxociadom rlnvs;() ruoir3nudll   feiat) rrmxroou4tptn ietldlmDrl(mo;t0 rxoif3iatla  lneils  rumxrpnydop  lnct sf rtm(r ou4tetnmo3iatfm2el(vo;()aeeoiocto1fpteli s;s0 rtrxo3oudomt mnetlt)a2umxmpou1aeto i3iatfsDrmnvp;u4 ltrir to1lptelu s s)teuo(o3oudop  lfvt t)aDtru  ;o0aex mo3ta
\ No newline at end of file
@@ -0,0 +1 @@
+ues ( trtoimpny1alee nvta( a2urxmo;u1aptnifciatfa umumo;(0 etomocty1la rli s;s0teuoio3iy1ope livtas arrr( ooo0oee miciasls rluvpnu0alenmr3io1fat aueslt s2tmir3oodol emfcilsfs2uaxmoot4alto icilsfsDel(mp t0areoiociadoptrluvs;t)teuriopiu4lp nlnctasfs2tax  ot1olenmiciatfa rmnvp;()alxnxr3tytlateauvs;(0tetrxr no1lltnlfct ()aDraur ;t0tee  ictytla ua(mo;u)teermo tydfmt lnvo t0 2trim3iy1amenmnes sfsrrrxront1tpxoif3iytlmDumnmo;t4alerif ia1omt aieilt)setr(o3oo1op nlivtltfsDtmu pnu4opt  f3iytla ulums;(4aexnmr3oo1omtr u o;t seuoirpno4optnlnvia(f ruaxr nu0aee mf3iydla ulnvp t0tltnxf3io1omt aieols0t2to(mpoo4ape  feil()s2ra( poo4apxomf3ildlm2rauvont4 exoif3oatfmt  uvo (  2tr(m oo4ol nmnes (faDtr(m no4tpxo fcilsfaDum(vs (4artrmfciotoptelivols) 2xmxr no4op n fei ( aDrmuront1tptn ocias a2uaums;u)artnxo iatlpt  uvs s) 2xoirpiodopenliesat)sDumxrpno1ope ii3tadfa rmnmpnt) ltrmr3oo1laD aieo;(  2xm(r3iodlmtemiet (  2rr(  oo1aleo fciyd s2rlnmp;(4 exnmf3iytlaDe uvo;(0 exoiopio1lltnmicias  rrau oou1texomoeiyd a2ranms;(4aeerio ty1fm ean il( sexr(r3iodop  mnvs s)sDraxmpno4olx io3iytla2ra(vs t0aleoif3ia1omt lueo ( texo(r iodlle livtatf rua( oot0aetnii3ilsls2ea( o;(4teeoir iotfmteluvolt0t2urio3ny4amtemieiat  rumu p;o4aeeoioeiltfs el(ms;u) exrir3oodlaDrai i ( t2tm(o iydop nlicils) Drmur nu4aeeoii3iyd aDrl(mo;(4texoircoytomD aiesls teumxrpiu4omeemnvtatfs2rmxmpot4opxnmfciltls2uaumont) rerxfctytlp r ivi ()s2toxr3ou4ame  nctl(  ruru o;u4oltnmo3tlslaDrl( s;(4tltoxocootfmtrluvils setoir3oy4alee nvilsfa2taxmo;u0apxomi3iyd sDea(vp;t)tetoxf ta1om rln o;(0texrim3iu4lm emnei sfsDtr( ooo4tlxo ociasfm rmu o;(0 reoir3ia1omteaiei s  2umxo ou4lm  lneia() Draxronu4aexn f3tasfs2rmuvsnu)teenxo3iy1lmt li i (  2tr(mpiodlmenmnvsltfarumxmonu4tltnioetysls2ra( snu4aexomf3iydlatrlieols s2tr(m3iy4apeelfvt ( aDumurp;t1apxomoetysls el(vpnu0tlxnxr3oy1fmtranes t0 2uo(r3ny1altemnct t sDrm( p;t0tlxo i3iltla2um(vsnt)aeenir3iytfa  luei;s)t2toiopnu4ome mfct (fa2ra(ro;t1oeeoiociyt mDrluvon(4teeoxr oatomDr uei () 2uoxrpoo4lp elicsatf 2taxmpot1tpx  oetasfa rlums (4 exnioctodomDr ivol(0 exm(opno1oltnlics t  rua(mpno1openio3iyt s2raumsnt4aexoirctydlpt auvs;t)t2trim iu1lmt lnciasf rtrx p;o0tlenmi3tydla2ranvp;t4altoxociodlm rli ols  rtrxo3oydllte fvia(  rtaurpou0oeeoii3tas m ulu o;u0trermr3oo1oa e nvslt0s2xmxmpnodapen ncsltfsrrmum ou1opx mfetatfs um(vonu)arerifciotlaDeaieo s sexr(m3iy4olt  ncsa(fa2ra( p;t0oex mieiad a uluvo;()tltrmf tatop r nvs;(  rtr(mpnodoltnlnci (fsDtaumpoo0olx ioctydfmDrlumo u0tetnif3tadfp  lnvils)srur(r3io1al   fcsl(f 2rax o;t4teenifetatfs um( p;(4 exomr tydfpteanes t)s2tmxrpoo4amt  nctas) 2uru p;u0open feils m2emu s t0trtrmf tydlm   i o;t) 2trim iudape  ncsatfa2rmxrpou4opxn ociydlm2rln p;() etnxo oatfm rau i;s  2xmxm3iydame mivs ( artr( pno4oeto o3ildfmDumuvp;()aetomrcoatlmDrlu olt)t2tm(m3nu1lm  lfcia(f rum(mo;u0ope mo3ils aDeanmo t0tleomo3iatopDrln s;(0trxrirpiydlpe mfvil( arurxm no1alt moeildla rluvo u0trenxr ta1lm r nvi s)srxrxr3oudom elfvslt srrr(rono1tptnmfeiytlaDum(vo u4alenircto1opt lu sl(0trtmim iydllt  ivta(  ruaxmp;u0tptoif3iaslaDrmuvpnt)alxnmr tydoaD aueo;s)texoxrpou4am nlivt t s2rr(mp;t4tpx iictaslmDeln pnu0tlenxf todlptrlivilt0t2xmirpny1aptnlneiat) rrmxr ;o1opx ifcilslmDum( pnu0 leomr tytfmtraneo;(  2trio3ou1oltemiesa()arra(mont4tleomfcilt m2eau p (4arerifciytfmte u s s0 rtmxr oudoptnmfcsat  2ua(  no4tpe mfciasla2ra( s t4artoxo oadlpDeanvo;( setm(r oo4aleelivsls srua(  ;t0olxoio3iadlm2elnvsn(0 ltrxf oatomDe uei;t) rtrimpnu1optnlfvsa( aDumx o;t0tpeomieiyt s ulums;t)tltrmf3oytomtrauvsls) etmim3oy4lmte fcsl( aDta(mo;o4ole iicils mDrl(vs t0trxrif3totoa  lueslt  2uoio3nodome  iesl() Draurp;o4tlt mo3ild aDemuvp;t4tlerxf io1lpDr nei;t0 2xoxr3nu1olt lfcta(fs2tm(mono0tpxo ocilt a rmn p;t)trtoxo iatoatrau il(0t2trxm nodope  fviltf rurx  nu0aeeomietydlsDua(vpnu0artniociydfate ivi t seuoxr3nydom nmfvt s  2tmx pnu1apto ieiys s rauvs u0 lxnxr tydfaDr uvo;t0 2xoir3iudlltnmfvias arumu o;u1apeomoeiadfm ulnvp;t4altnmo ty1op e ies t  etrimpnodlmenlnct ()aDtmump;o4tlx mociasfmDrm( o ()arenmr3ta1lm r nvilt s2xoxopno4apeemicsltf Drr(ro;u0olto o3tasfs2ua(mp;t4 eerxo3oatop raies t)trtrxr3oy1al  liviat arumx onu1tpxo ietad aDul(vo u)tetoxr3iatlp raivo;s) exm(m3iu4ome lnvtat) 2rmxmpot4opt mocilt m2ean p;u)arenmr iadomtr u s;( t2xo(m3nydlpenmnvt () rrr(r ou0tltomf3iatfm ra(msnt0artomf3to1la rln o () 2xrxr3oy4oltnmfvtltf 2ur(  ;t4opxniietltfs2rmn s;(4tlerxr3io1fmt  uvi s0 2ur(m3oy1amee ncs ()s2taumpnt1oetn oetydfs2elnvo () exnmf3to1oaDrlneol()s2xoxm3iodapt  iesas  2taxmoou0tpe mf3iytla ua(monu) lerif iy1oaDrli i t)trxr(m3iu1llt  nvtls) Dtmxm no0alenmociytla2rl(vs (0trxoxf3tydfm  anei;s  2uoimpio4apt  ivils)aDum(rp;u0ole io3iytls2umuvp t4treomr ty1opteauei;t)srtr(m iu4olee fcslsfs2urumont1tlen iciys m2rl(ms;u0teerxr3oadfm elnes t tetr(mpiy1opeelnvs (  Dumumpnu0opxn o3iatlm uan o u)arxomfcootomDeluesls  2tmio ny1op nlncsasfsrrm(mpnu1tpto ietatfaDumuvp;t)aeeniociadom rliei t0srxmxr3oo1ape livtls) 2trumpou4aexnmfctldfmDra(vo;()trtnio todopDrlivsls t2xm(r ny4oltemnvi ( srrm(mpno0aeen i3iyt aDem(mo;(0alerir iodlaD lu i;t0 etmirpoy1altnmnvt tfsruaur ou0ape io3iydls2ea( p;(0 eeomo3iadlp  lies t s2urim io1optn iei t  ruaurooo4tetoif3iadla2uau o;(0trxnir3iatoatr u i () 2xoxopoodaptnmfcta()aDrm(ro;u4tpxo octytla emnvonu) rerxf3oytop r neo;s) 2tr(m3nydameemneia(fa2uru  nt1tetnif3tyt a2em(vonu0aeeomo3oodoa rln i;t  rxm(rpoo4omte ivi ()a2uaurp;o4texo ietldfm2eaumo;t4teerir3tydoa e ivil(  2to(m oy1lm  mfvi sf rum(ro;o4apt iocilt a2rlnvo;u) lerxr3iydlm elu olt)texoxm nu4lmtnlnvsl()s2tmu o;u4opeomo3iadls2ra(mo;t4trenifcoatfp  lues;t) exrxr ou1lmt  iesat)srraurp;o0tptn fciysfm em(vs;t4altomr3oo1opD  uvs;s)texrxo io1ll emfcsl() Drm( pnt0teeomictas a2uanvp;t4tlxnmr3ta1lpteai o;t sexmxrpiy1lltnlfesa() Dumumpot4tetoioetys a rm(mpn()treriocta1fptr nvs s0 eto(m3iu4lme  fvt ( s2tmx onu4tlt moetysls2ranvs t)trtoxrcoadomt  n o;s trxriopoy1alt  icsat  2tr(ronu0optoif3tydlm2em(mont) etoiociatoaDr ivs t) 2trim no1op nlfvi tfarumumooo1tlx mfeiadfa ua(vs;(4aexnif io1faDeau i t s2urxmpoy4aleemnvta() Dua(mpnu4opt mieiyt m2uanvo (4 rxnmo ootop  aueo t seuo(rpnudlmeemfesa(fs2ta(rono1oexomfeiyd sDrmn o;t)artnir tadfm rauvi;s0texmio no1omenmnet tfsDuax poo0tpxoioeils m2elnvp (0artoxf oo1lmDrluvi;( trtr(mpnydol n ivsl( s2rmxm nt1oltomi3iatfs ua(msnt) eerir3totomDelieo;t) rxmir ny1lle  nct ( a2uaxrpou4tlt  icild aDra( p;()treoxoctytlmDrlueil(0truoxo iu1om  miet sfsDtr(root1apx mictasfa2rl(mp u0 renmfciotlaD  n o t0 eto(rpny4olenlics sfaruax oot1tetniiciasfs raumo u0altnmr tydomtr n olt0 2uoio3iodale  nesa(fa2rr( poo0apt  oeils a2rmnms u)alerio ta1faDe i s;s trurxo3ny1lp e fesas artrumo;t4ape iictldfm2umumo;u0tetnif3tydopD  i slt sruoir ou4om nlfesl( aDrm(rpno1tpenmocilsls ulnmonu4alermf3iodlaDranvi s) rumxo3ny1amenlncs t)a2tax ono4oetn i3tas a2um( o t) rxnxo3ia1lmDeaues s)s2toxr io4lltelfcia(fsDrauroot1tlen ictytfsDemuvs t4alxnifctatlpt lueo;t0 2xm(rpny4lpenmncsltf Dua(mpnt0optnmoctlsls eanvp (0 rtnxrcty1lp r ivil(  etoim3iu4apeemnvsls  Draxrpnu1olt mieils sDelnmp t0 lxnxr iytoatrluvslt)s2xm(r io4al n ici sf 2trxm oo4tlt mfcildlaDel(vp u) lxomo oydlp rli i;()trur(rpny4omt mfctlt  rumuro;u0alt io3tlt s em(mp u4alxnxfciatlptranei;( t2toxo3oy1omtn fvils  Drmxmono0ole ifeiys s2umuvs;(0alenif3iadlm eanvs (0s2xrxo iy1amtnmnvia()arumum oo0tlenioctydla ranvp u4trxnxf to1lm r uvi (0s2urimpoo4aptemivs s)a2ururp;t4opxoio3tlsla ulumsnu4 lxrio3iatopDe nesl(  rtr(r oodopeemnctatf rum(  ou4aetoiictlsfaDuanvp;t4alermo3totoatrlu i ( sexrxm no4lmtelfes s aDrmxrpnt4tle io3iasfs2um(mo;t0 ltrxrcia1late i o s  rtoxopiudapee iesls aDtaurooo0aexn o3iad s2ra(vpnt)alxomo3tatfpDelnvs (0srxoxmpno4ale lfcil()arrrxm ;t1olxn fciatfa2ra(mp t4arxrxo ty1lat au i;(0t2uoio3io1om nlnct tfs2tmump;t0opxo fciadfs2um(ms t4tlenmr3ootfa   ieilt s2trxmpiudlmenmieta(f Dtaxm ;u4tpeniieilsla2ean s;(4 rtoxo oydfaDr uvs (0trumir3no4opt lnet t  Drmx ono0altnii3iytfa2ul(mo;t)tlenxr oa1oaDrlueo t  exoxo3oodoptnlncta( artmumpno0tpenifeiltlaDrauvs (4 rtrxo3oy1faD auei s)seuoir nodop emfeta(fa2ra(rpot0alxo i3iasfa elnvs;u0aexrxfcoy1oatrlneilt0t2tmxrpnodop emnvi s s2tm(r oo0oleoif3ild m rl( ont) lxnxoctatoaD anei t trurxopiodal   ivs tfa2ta(r nt4tlenmfeild aDeauvp (0tlxrxr ty1lmteai s t0srxmim3no1am nlfctasf rtrxro;u4olx ii3tas aDeau snu0trtomo tatfatrluvslt)trxr(m nudal   nesas)a2trumo;u0oexnifeiat mDemuvp u)tlxoxf3tadfmt  i o t0texrxr3no1lmt  ieta(  Drmumono1tlt if3iatla eluvsnt)altomo3totomtr nvo t) exo(m3oodop n nci (f rrmumo;o4optomoctysfm elu p;u)teerxo tatlm rln s;t)texrxr ny4apt  nei sf 2raxronu4tptomociasfmDrl( snt4 ltrxfciodlatelu slt t2xoiopiy4om elfei (f rum( oou1ale iocias mDumuvo u4 eeoiocta1oa   n s (0s2uoxo3iodopt mnesa(fs2taump;o0tptnio3tadlaDrln snu4tltnxrcoydlmteau i;s0trumio3ou1lltelfcil(  rurxrpno0aeeoio3iyd sDemumpnu4 ltriocoadop  anvslt)srurxmpiu4al emfvsa(fa2uax p;u0alt mfeias a uanmo;t4texrifciydopDranvo t  2uoxmpnu1oleelics (  2tmxronu1tpx mieild s rmu pnu0 reoxf3iy1omD lues ()s2tmxr io1ll   ncs (f rrrur no0altnmoctysfa eaums u0 exrmociatlm r n i (0s2uriopio4oltn neiltfsDra(mpou0optnmfetysla rl(mo () eerio iydlmt  uvo;t)setm(o3nydap elivia(f 2tm(rooo4tpeomiciasfs uln onu4tltnxf3to1fpD  ivil(  rumio3ny4omtn netat)srtmump;u4tet ii3tyt s em( s;(0tetoxfcoytfaD li il( seto(o3iydopeeliesl( a2rmxrpnu4apxoii3iysfa2emn o t4 etomo iytfatr nes;( trxoim3oo4amee net (faDtmx ooo0oltnmf3ils aDrmuvon()trenio3to1fa r n sl(0srxo(o oudlmenmnct (faruax  no1tlxoif3tydfm2el(mont0trermf iydfmD aues;t0t2tmxr ny1amtelnvtatfsruaxm ;u0alxomi3iysfm2uauvonu) ltoxr oydopt  ueo;s s2tm(opio1al  miet ()s2trxmpnt4optnio3tytfmDra(vs;t0 exnmocoydlmDelivo;t0 etoiopiy1omenmnvt sfa2taxmpnt1altnmictltfm eauvp u)tlenif3iadfmteaieo s0 euoio io4lpenlivt tfarur( pno0apeomoeilsfsDrluvp u4 rxrir3io1opDeauvo (0srtmxrpoo4altelfesat)srtmxmont0ape iieils a2ulnvonu)aexoio3ta1oate ieils0 rxoxrpoo1altn ncsltf Dtrx pnt1tetomi3tas m ranvp ()trxrxo3oy1fpDr u s (0 2xmir3iydllt  icsas srtru pno1apto ictyd sDean p;t)treoxociydfa ranvs;t)setoxrpiydomtnlicil(faDtrx oot1tltomieiys m2eln s u)aeenmocty1opDeaivsl(0 eum(o3no4lmen nct sfsDurx o;t1tetomieias mDeau p;() lenir ta1omtranvo;t) exo(m3oydam n ici ()aDumump;u1tlxo f3iasla2emuvo;(0artomrctodfat  nvi t0t2um(o3iudaptnmivtatfs2urx p;u4olx iociyd s2eaumon(4 etnxo todlmtrai s;s  etrxm iudom elfctlt) Drrx o;t4oet mfetydlaDelnvp (4tetrxociy1fmtr i ol( t2xmxm3iy1amenmnvsatfsDraxmpnt1teeoiieilt s2emumo;()tlenxocto1latr n i;s)s2xrio3oodop  mfctatfarta(m ot1tetn ociyd aDrlnvp;t4aexnirciotfpDelieil(0s2xmirpno1omenliesls  2umum ot1ape mieiysfs raump;t4 etnir3iydfat  n o ( setoir3no1lpeelnvt sfa2tmx poo0olx ifcild a uanvs;(0texoif iatfa e n o s srtmio ou1op n fetas srraxmooo4ole  o3iat aDulnvp;t)aexnmo3oy1lp r ivs;t)srurxo io4alenmnvs () rtrur oo4tptnmo3ils a rauvo;(0aetnmr oodlaDeaueo t) eumxr nu1am  liesl( a2tm(  ou0tpx iieildfsDrau s ()aexrmo todlm  livo;t)t2xrxr iu1op n ies s  2uaumpoo4olt io3tysfs2eluvonu)aeerircootlm r ies t)s2tmio iodlm  mnvsat a2trum ;u4tpt mocilsls eluvs;()texrif oatfp  aivs;() 2toim io4lle mieiltfaDrrum ot4oeenioeiytlm2rln pn(0alenxf3iodlpte i ils) eurxo iy4amtnlfet t)aDumxr ou0olx mietatfa2emuvont)teenmrciy1opteai s t)tetmxo3io1apt lnvia()srraumo;t0tet mo3iytlaDel( p;u4trtomr totoaDelieils t2xmxm3iy1lmtelnvi t)srrmu poo1tpxnif3iat mDuau s;(0 rxnif iadfm eai o;s)tetmir oo4lmeemneiltfartr(mpnu4aetnmo3ildls umu o u0 etrxrctytlmtr i ilt  etmxmpio1lpt mnesl( srtm(r nu1opxniieias mDran o t0 exrmo iotlaD an slt t2uoio3oudol n nvi s sDra(m no4tlxnifetlsls eln s;t0 rtoir io1fm  luesls) eumir oodlpte ncilsfa2raxmo;o4ale mo3iatla eln sn()aeerxr3oo1optrau ils0srumim3iu4am elicsl(f rrr(mo;u1optomfeiys s2rm( p;t0artnmr3ta1lpteluvs;t) rtoxmpoudap nlnci s srra(mo;t4opeomocildls2ean p t0tleomr oytfate i o;s)seum(r3nu4omtelict () ruau o;o4oet mfetasfs umumo ()trtniocta1oaDrln i;t texoxopoy1ll  lnetl()sDumurpnt4aeen ieiaslm rln o u0aetoio3tatlmDe ivslt)trum(o3iy4omenlnesl()srrmxrpot0ope mieiatfsDuauvp;u0teeoiociy1la  anvo;s0 rxrio ou4lleemiei t s2rmxrp;t4ape ifeiadfa2ua(vpn(4aeeoif3oatom rlivi;t  rurxr3iydol  mfvtl(fsDuaxmpoo4apxo fetldlm2emnms u0arerxocoydlm   nvs;(0 ruo(m3no1llenlictl(  2tm( p;t4alto o3ias mDemu pnt)aetoiocootfaDeauvils)t2to(r3ny1olen ncsa()sDuaum no0olto f3tls s elnmsnt4 rtoioctytfa   ies s seum(rpoydlptemivs ( aDumumonu4oleomoetat sDrlnmp (0aexoir3to1la eanvo s0s2umxr3nudlmtelnetasf rtmurp;t0alx mocilsfaDua(mo;t) etoxfcty1fp  ai o;(  etoxo3ny4ome mivsa() 2um(  ;o4aeenif3tas s rmn s (4tltomr oa1lat  i o s  rto(m3ou1op nmicta(f 2rr(rp;t4olenii3ias a ul( s;(0tltnmf3iadfm rauei;s t2xm(rpnodoptnlfvtlt)a2rau  ;t0olen fciaslm umums t4aexnmr oy1op r u i;t0t2urxo ny4ap nmiciatfsDur(  nu1tpe mfciad s2raums;(4 etrmocoy1opDelnesls)texo(mpoy1al n iei t) rurxr ;o4tlt mfeils a eaump t) leoirciadopD  nvil(0seuo(opiu1amenmivs sfs2rm(mpnt0altn fcilsls2rau p u) reoir3iotfpDr u il() 2xrim3no4llte nvt (faDtr(r ;t1oetomoetyt a emu o u) rtnio todlatrlues;s)t2toirpiy4ap n ivt ( aDurx  ot4aexnio3iltfs2rl(ms t)teenio iotopDe uvol(0truo(rpoodom emiciat) Dtmx p;t1tltnmi3ild sDelu o;u0altoxr oodfaDran s;t  2tmimpoydale mfeslt) Drru o;o0tpx if3ilsls elu on(0arxnmf3ootlatraies s0sruoim nydll emnetl( s2taxmpou0aetoio3iysla uluvp u0 etnifctadfpDr uvo;s  etmxo nu1lpenlnei (fa2ur(m oo1oeeomi3iadfs eau ont) exrxo3iadla eln o;s) eumxrpoodlpen fvt (f Dtm(mp;t0open iciys mDraump t) leoxr iytlmDeai ols) 2xm(m iodlptnliciasf rta(mo;t4aex  feiydfmDra(mo t0 eermo iotfpDr u o;t0setrxm3nodap nmnvsa(  Drau ooo0oleo ieiltfm2umumsn()arxrxrctodoate uvol(  rxrir3nu4lptnmnetas)sDtm( ono1ape iocild s2rlump;t0arenir3tydlmt  i o;( seur(o3iydol e fvtl(fs2rau  ;o1tptnioeiyt sDeanvp u4 eerxfcio1optr u o t0trxoim3nudomen ietlt srta(  nt1tlt  ieias sDua(mpn(4alenmf3oadop elnes;(0s2xoir oy4opt mnci t)srrmxmp;t4aeen oeiltlaDrl(msnt4 lxrxf iydopD aivi t0setrir3oydolen nesat)a2urump;o1tptnii3iatfsDrlump;t) renxo3iatop e ueo s) exrxr3ou1ap nlfet s artr( pou1ole ioctadfs2el( pn(0alxrxocoytopte nvs;t0srtm(o iy4lltnlfvtlsf Duru pou0tpxn f3iltfs eanmp u4artrio3totom rlueo;s trxr(m3no1opt mnvta(  2rmxm nu0opx  feiys s uanmo;t) eenmr tadfaDrlueo s) rtm(m nodlmtnlneil(faDtr( pou1aetomfctat m2eaumont0alxomf3tytfmt ai ol()sexmxm3iy4opt  nvt t srurxm ;t1oee  ieiadlm2emuvpn(0 rxrxocia1fa   nvo;()t2um(mpoudop e nctasf 2tr( pnu0oleomfetyslm2uau p;()tleoxo oadfmt aueol(  ruo(o3ny4amt mncsltf rurx o;t1oltn fctyslm rau ont4artnxfctodoaDrlnvi t s2xm(o3oo4ope  ict t) rtaump;u4aee  ociaslm2em( s;t4aetnxf3to1lp  ai sls seto(opoudamtnmnvt tfarrmum nt1ope iietadla rln snt)trtnmr iytfp  auvo;s0trumxrpiy4open nvtl()srrm(mo;u0tpeo icildls umumon(0 rtoxr ty1la  ln i s sexrxo iudomt mics ( aDurxmpou0apt moctydfs ea(vp u)aleomf3oatopDraieils0t2xoxopnu1amenlfctltf 2um(  ;u4aee  fciys m2rmnms u)trxrmf ootlaDr i o s0 exm(o3ou4amte iesl(  Dtr(  ot0aet mf3iysfaDra( o;u4 rxoir iydoatrli o;t)truoxr3nodoptn fctls a2uax  nt1tpenmf3ildls2rmuvs u) rxrxr tytfp raueo;( texrirpiu1llenmfctasf rumxmooo4alxomiciytfs ul(vs (0 rerxr iodfaDr ies;t0s2xmim3nu4aleelfci ()sDuru  ot0apt  octytfm2rmnvo (0trxnmf iy1lm e uei;s0teum(mpoydapt mivs s)s2umxm ou0aleoifciytfm2ra(mp;t)aetomfcoadopDrlnei;t) eto(o3oy4lmtnmfvsa( artaxm ;u0opxnmo3iadfm eaumpn(0alxnio3oodomtelues;()s2to(rpou4alt lfct (fsDrru  nt1tptn octydlm2raumpnu)arxnmfcto1laD au s;( texm(o3oudamt lnvsl()a2rru o;u0oleo ieiytla2ul(mpn(0 etrmfcoytfm ranei;( sexr(r3oo4ll n fct t)a2ta(mont4opt mfciadlm rm(vpnt4arxrxrciytopDrai s;t) etmxrpiu1omtnmnvia(farururont0tet  ociatlm umnmp u)aetoxociotopDrlu i s0s2tm(opoodol e fvil( a2ta(ro;o1texo fciltla2eanvp;t4altoiocoytlm  lues;()seum(rpiy1lptnmieil(fs2trxm ;u0oleo f3tldlsDrlu p u0teeoxf3oydlpD ai s;( s2trxm3ou1lpt miesatf rrm(mpnu0oetn fctatla2um(vs t)tltomo to1om raues;()trumio3ny4amt licsat)s2uau ooo0aeenioeiyt a rmuvp u4trtnircoo1lpDr uesls)teuoir io1ll e nesas sDraum ot0apenmieils mDelu pnu)altrmo iadlaDeanvils) etmir no4lptnmncta() 2tmum ot1oee mfcild a2emuvon(4 rtoxf iatlaDeli o t) 2toxr iy4lpe  ivta()sDtax p;o4tltn feilt aDum(msn(4alenifctytlm r ivo;s)s2xmio3nu1am emiei ( arrmxmp;u0apto oeiasfaDrl(ms;u)tlxnioctatfmt li olt0setmxopny1lpenlneilsfaDta(rpnu1olt miciysfs rau o;u0tlermo tydfm e u ols trtm(mpiu4amenlicslt)a2rr(mono0oleomiciad m2ea(mo t4trermf oadoa   nvi;t trurxr3oydlptnmfct t  2tmump;t4alxnmoctyd a emu o;t4tltoio3oadopt au o;t) exmxopio1ll  mnci s aDrrurooo1aexoio3iat aDuanvonu0teenxfcoodlptraues;t  eum(m iudoptemivs tfaDrrxm ;u4olt ifeiydla rau sn(0aetrxf3totfat  n ils0 etmim3iy4oltnlnesatf rtrxr ;u0tlxnmictltfa emuvo;t4 rtnxrctadfpD luvols) rxoxo no1ol emici tfsDrru ono0aexo o3tlsfmDelnms ()texnxr3ty1lpDelu il(0 eum(rpny1lp e netl(f Dumxr nu1tpen oeiat s2umnmo;u) ltoxf3oydfpDeauvi s0t2tm(m iudame lfeiat)sDrru  oo0tetn ieiytlmDulnvp t0arerxf3oytla  lueolt) exr(r3nudlpe lnvi (fsrrax ono1tlenmo3iatfs2rmuvo;u0trerirciydoateauvsls0 2xm(o3iudllen netls  Dum(mono4opt moctat mDrau snt)tlermf ta1fm eau s t0t2uo(o no1am emfvt ( artmxrp;u0tlenio3iasfaDrmu sn(4tetnxrcio1omDeaneslt t2xmiopny1omee ncs t)arrruro;t1aetoio3iltlsDra(ms u4texnif3tydfaD  i o;t0srxmxm3iy4omte fcsa( srtmumont4tltomietldfm umu pn() rxrmf3oo1fptrlnvi;t  2xoio oudlpt lieia(  Dumur ;u1oexomfeiysfm2rmnms u4areoio ia1laD lu o (0srto(r3no4aptnmfcil(  2ur( pot0tpeo ictasfmDem( snt) eermr to1faDeln ils0 2umirpnudap e fvi s)a2rau pnu0tetnifeildlmDrl(mo (0teeoio3iotfmD lnvo ( t2tr(o3oo1amte feilsfarrrumpou4tlxo i3tld s2rlu p;t) etrxf3iadop e nvs s)setoio3ou4ale lfeilt  rrrxmo;u1tlxomfcilsfmDumuvont0 etrmf3tytlmDelu o t) rurxr3ou1amte ieiasfarur(ronu4opt ifeilsls2ea(vsn(0texrirctadopD lieo;() 2toirpiu1amte ivtas  rrmur ;u4tle mfeiatlmDra( p t0 eenxfciy1fmDrli i;()tetmio3nu4ale mfcsl(  rrmu oot4olx iieiysfaDea(ms u)teenmf todfateanes;t)t2xm(o3iu1lle  ictltf 2uaxm ;u0opxoiietltfa2rln s;t) exoxf oadlpDr ivsls t2tmxopoodlm elnesa()s2tm(mpnt0aet  ictldlm2em(vo t4 lenxf3oo1lmDe ivi (0tetoxo iudlleeliei ( srtm(moot0oex mfcilsfa2ea(mo ()arxnmr3tytfateaivol(0s2ur(m nudam   ieta(fsDta(mo;t0aetniieiydlm el(vs;()arenmrctytlaDean il(0 rxmxrpoo4lptnmfcsas)sDtmu o;o4olenmo3tys mDul( pn(4alxnxfciatfptrai s s)srxr(r3no1ameelnvsas a2tmxmp;u1opt  iciydla eanms u)teeoxo iytfpt  nei (0teumxmpnu4alt lfcsas) 2rmuroou0olx ifeiadla2raumo ()aeermf3oytfatelueo ( srxo(m3iu4lpe  icta(fartmu oou0apt mi3tyslaDuln pnu4 exoxf3to1fm e i ilt0 2xoirpny4omtn netls)srrmum nt4opt mfcild sDraumpnt)tlerxocto1latr ieols0s2umxo iodlptnlfetlt)srta(m no0olx  f3iatfa elu on()arerif3oydfaDrlivi;t)trumimpoydop e fvs t) 2trumo;t1tlen ocilt sDran o;u4 ltnxo to1fmt  iei;(0tetr(r iudam  lfetl( srurumpno0aexomoetysfa2rmuvsn(0tlxomr3tadfatraueils) etoimpoy4ape mfet () rtaumoou0tetoiociadfaDum( s;u4 rxoxrciotopD aivilt  euoimpoy4am elfvs t s2tr(rooo0aptn oetys a ua( s () exoirciatlpDelnei ()trumir oo4omeelfcta( arumxr ou4tpe ifetasfa2ua(vp (0 eerir oodfpD lnei s)tetoim oo4op nmiet tfsDtru p;u0tle mfetltls ranvp;()aexoxr3oo1om   nvs t0srtm(m3oy4llt mnvs sf rrmxm nt1oex mfeiltfm rl(vonu)tetrmf3tatfmDr i o;t0texoxrpnudomtn net tfsDtm( pot0tlx mfeiad m2rmn o;u4trxrxf3tatoaDrli o;t)trtrxmpoodlpe lnvs () 2rr(rooo0aptoioetlsfm2ulu o;(4arxomo ia1fateanvs;()srtm(m iu4lm elivs t) Dtaxmoou0texo ictasfa rlumonu)tltnxo ootlp r iei s0texmxrpiy4amt mfcta(  rum(m ;t4aet  ietldlsDum(vsn()trtrmf3iatfa rlueslt) rtm(o nodllenmnet s)arraxmoou4ale  fcild mDulu s t)aetrmr tydlmD aneils0 2umir3nu1ap nlnesat)sDrm(rono4tpeoioetat mDuanvpnu4aeeomocoa1lmD aies s)srumxm3iu1llee icsasfsrurum ot0oeen fctysfaDrlu p;u) lenmo oadom  lues;t)srtoxm ou1ol   net s aDtaxrooo0optoifciltfm rm(ms;t)teenif3tatoaDran ilt t2xmim oy1altnmivt sf Dumurpoo1optnii3iydls rmnmp u) exrmf tatfaD an i;()srtoio nydopt lfetl()artaxm ot0tpt mi3ildfsDelnmp;() lermr oatfpteau sl( s2uo(r oo1lptelfct tf rrax ooo4oltnmicild m ulnvsnt)teeomo3oatoat aneolt0texoxopiy1lp emieilt  2ur(mpnt1tet mocilsfm2em( ont4altrmo oytlate n sls  rtrir io1lmt lnctls  rraur nu1oltoii3tasfs2eauvo u)arxoxf3oytfateaivs (0 etmir oodlp nmietat sDuau  ;o1tex  o3ildlmDea( sn(0teenxr todopteauvilt sruo(r oudomenlnctl( srumxmp;o0opt mi3iasla rm(mpnu0aetrircoydfp raues;(0t2uo(mpiudomt  nctas s2ua( ooo1tle io3iat s2rlnmp;(4arxoxf3oo1lat  ivs t)t2xmxr no4lpeelfeilt sDrau  ot4tex  o3iaslsDran p;() eenmf3iydlaDranvi s  rxmiopny1alte fvsl(f rrmx  nu0teeo ociydfmDulnvo u) ltomfcto1oate ivi;t)seumxopoy1lpeemies s arta(rooo1tltoiiciytla elumo t4trxrif iydla  auei;s)t2ur(mpoydap e netls) Dua(r ou1tet  f3iytfs ea(mpnu)alxoir iy1la eai i t0seum(r3nydap n iviat)sDur(r oo1tlxnmi3tatfa2um(ms;u)arenmociodlaD an i;s  exr(m3oo4altelnvias aDuaumo;u1tlx  o3iltlaDuan o;t4 etoxr3ootopDraneils s2xrxm3oo1opt mnvt s aDtax oot0aet  ieiltls ean s;u) ltomf oy1fpDr i o;( s2xmxo3oodll nlnvtlt) Dtrumpot1tpxomictyd m eanvo;t0areomf iadfp raivo t)sruoxopoy1opeelfes t)a2rmx p;o1alx if3iadlsDemn s;u0 exrmo io1la  liei t)t2umxr ny1llt lfet t) 2tmuronu4oet mi3iat mDra(vo t)trtoxfctadfaDrau s;t)t2trxo iydamt mfvt () rur( pot4tlto fciys mDrmu o (4 rxrmo3todoaDeau o s truoimpno4ll elfci t  rta(  nt0oeenifctatla ranvs (4aleriocio1opteaiei;() 2trxr oodap nmivil()s2taxmpnu0tlto fciys s ul(vsn(0aetrxo iadomt anes t texm(rpnydoptnmncsa()s2taumonu4oet mieiltlm2umn pnt4 rerxfcoytfmt auvi s) rxmxr nydal   ivsa( a2ur(m no4tpxnmieiasfa uau s;() ltoiociotfpte ieils0t2ur(m3nodlm  livtlt sDra(ro;t4oexnioeiasfa ranmo u4trxnxo ty1lm rluvsl(  rumio3nu4ope  netlt  rumur ;t1aexnmf3tytfmDeauvonu0alxnxfctotoatrlnvo s)seurio3nydaltn iei t a2ta( o;o4tptnif3tlsls ulnvs t4tlxnif3oo1oatr ieilt0sexrxr oo4ape lnvsl(  2urxmo;t4altnii3iydlsDrmn s;t4artrmo3iodla r ivi ()seuoim nu4op elfcia(fsruaxr ot0texn oeiyd a rluvp;()tetrxocoydoaDe ivsl()s2toxmpnu4lmtelfci tfsDtr(  ot0apeoiiciydfs uan p;t)aeeoxoctytoate ivo t  exmxrpny1op   ict (f 2rr(rpou4tetoioctytfsDeau p ()teeomfciytlmteaieil(0 rxoio3no4lpeelfciat s2uru p;u0aet mi3iat a2eauvp t0 reoxf ty1lpt  ieilt srtmxopoy1lm n nci (fsDrm(mono0alt iiciydfmDel(vpnu) exrio oodlpt au sl(0texrxmpiydamen fesatfsrtaumpno1apxn feild sDea(vo;(4artnmoctotfa elu s (0 rur(opiu1lm nmictlt) rurx  nu4oeeoio3tldfa em(mont0texnxo ty1faD aiei;s trxmxr iy4al elneils sDtax pno4tlto o3iat s ranmo t)tetnifctadfpte uvo;t  rtoxo iy4omt  ict s sDraump;o4oex  fetysfm rmn o t0alxnmfcto1fpD aivsls) etoir3ou4omeemnctls)a2ua(mpnu4ale  octls m2elu o t0trxoxf tadfatrliei s0 2tmir ny1ap emncs sf rur(  ;o4tlenmfeilslaDeln o;u4tltriocty1latranvo;t) exoim3nydolte nviatf 2um(mo;t4apx iociysfs2ranvp u4trerirctatfmteluvilt  etoxo3oodope  nvt sfa2umu oou1oet iietas mDeln s;u) eerir3totlp rlueil(0t2xm(r3oodopt lfvs ()s2taxm nt0alt mfeiat sDum(vont0altrir3totopDeaueo;s0s2ur(o3nudoltn nvsa() rrm(m ;o4alenmf3tldls2em(vsnu0 lxomf oytfpteaiei;t)teurxm3iu4lmtelfcsl( artm(rp;u4oleoiieias m umnvsn(0 eeoxr oa1oaD ln s s s2xrirpiy4lmt mfvtlt)sDtr(mp;o1opxomoetad aDrlnmonu4 lenmrctatfmD  nvols)sexo(m io1lpen neiat aDtm(r no4aex mictls a2ean s;t4 eenxo oydfmt  ieil( setoirpoydalte ivsa()a2raumo;o0aetnifeiaslmDeln ont)artomfcoo1opD  nvi s  exo(r3io1lpeelivsls)a2tmxrpoo4tle ioetadfsDuauvsn(0 lxoxocia1fmDeln o (0s2trxmpio1om n feiat aDuau onu1alxniiciltlsDelnvpnt0tlxrxr3to1lmD lneolt)s2umxr3ou4al e ictl( a2tr(  ;t1tpe moeiyslm2rmn on()arenmf oa1la eauvi;t trtoiopou4lm emnctatfsDta(mpnu4tlenifeiat mDemuvs t) renio oytlmt  ieilt) 2umim iudop elnvs (fs2rrx ooo1tpxnmfeiysfm ra(mpn(4arxnmocoatom raueil() rxrim nu1lpenlncilt)sDtrurp;o4apt mieiysfsDuanmon(0 eerif3tatlpDeluvi t sexoir3iodop  lnciat) Durumpot1tlt mi3ils a rlu snu) ltomoctotlptr n i t0 2uo(opiy1am  lfeil( arra(rp;o1alxo fciydlm2emu s t)tlxnxrciy1fpDeauvilt0trxmir ou4amee ics s s2tmur ;t4tltomo3iaslm eanms (4aetrmr oodfaDelues;s  eur(r oy4op e nvi ( sDtaum ;u0tex moeiytfs umu p;t4 rxnxfciatopt  ivs;(0setrim oodlmenliei t srur( oot4oltn f3tysfsDem(vpnt0 eenxrctytfmDrlu i;(0 rxmir iudalt mfcias srra(ront1oeeoifetyslm2rl(vp t)aeenmr todlp eanvs s0 exoim3oo4apeelfct t s2rm( pnt1aeeomo3iytlaDulums () rtoxfcoodom r i s;(0s2umir nodlm n iet sfa2ururpou0oleomiciasla rmu pn(0aetrmocoo1fpD aues s  2urir no4ale mneils  Durx o;t0tpe  ietat s rauvp u)tetrxo tydoatraivi (0 rtmxm nydlmte nvia(  Duaum ;o0aexn i3iytls rauvp u4 lxnxfcoadop   nvs (0t2toirpiydoltnlfesls) 2uau  nt4optomf3tyt a rmnms;t4arxnxo io1fp  aueilt0trtoxm iy4alt lfvt (fsDraumoou1tleomf3iad s2emumpnt4altrif oadfat aieo (0 2xmim ny1lltelietl()s2tr( pot0tpe  ictltlsDuan o;()tlxnif oadlmtr u i t teumiopiu1lle miciat)s2ur(mpoo0tpe ioetytlmDeanmo;t)trenxo oy1oatrln s t)s2um(rpio4ale lieiasfaDta(moou1aetomo3iatfs rau snt) exnif to1lmDr i o;s)s2xo(o3nodal nmnctas) 2ur(r nu4texo octydls2emu pnt4alxrmr iatla rauesls0sexoir3no1lptnmneil() rra( pnt0olx ioetydfm2ulnms u0aexrmf oadlmDeaieilt)truoirpoo4ol e ics t aDtmx ono0ale mieiat mDean s;u4altoio tatopt lu i;(0texoxm3nudomtnmfetasfa2urur no1tltnifciyt m umn pnt0 rermrciotfp r uvs s) 2toiopno1lmtemfcs s sDrax o;u4apen o3iatfaDra(vo;(0trenmo ootla elnvs s)t2toxopoy1lpenlfvsltfa2ta(ro;u1aexo icild m um( ont)trtrio3ia1fmt  nvsls texoxm3no1optelfet s aruru ont4alxomi3tyslmDel(vs t4trenifctytfm elivilt sexr(mpio4ape lneil() 2ur(ront0oltomoeiaslm2emu o u0aleomo3iodfatrli slt srxrxm3ny1ll n iet () ruaum no1alxnmo3iytfs rl(vs;()aexomf3oatomDrluei;s) ruo(r3iudomtn nctltf rtmxm no4tlx  icils aDrmu p u)texnxf oydlpDrauvs;( setm(opiy1lmt lfci t) Dur(r ot4aex  oeiaslmDumuvp;u)aetomr ia1opDelnvol(0 rtmio nodlptnmncslt)a2trx ooo1oeenmieiatls uanvs;t4areomr iatlpDelues;( t2trxr nudol emfcslt s2raxm no0oltnifctls aDra( pnt)areoioctytfatrau i ( s2xoir3nu1ale  fcs sfarumumpnu4aet  fetytfs2rluvsnu4tetrirctydlmtelivsl( teumxrpnudlm  lncsa( s2rrxr ;u0tlx  fcilt s2rm(ms;t) rtoif todop rauvi s) eto(mpny4omtn fvi sfaDtmx pou4oexnifctys mDrl(vp (4artoxo3ty1oaD luvo ()srumxm3nudllt lfeiat) 2rrur nu4opeoiicilslsDra(vsnt4arerir3ootfptr nvsls0 eurxo iu4optnmnvi (fsrrmxr ;u4openii3iatlm2eauvs ()trenmo3ootlm eanei;t) rtmir3no1am  lncia(  2umuront4alen i3tydfsDrmumont0tltoxo3oo1omDelneol( trtm(r ny4opt  feilsf Dtmxmpnu4aptn o3ilsls2ul( s u4 reoxrcoadomD ln i;( texrio no4ope livsas) rururpot1tetoii3tat m uln s;u0aexnxr oytopDranes s seuoxm3nudamtelncil() rrm( ono0tpxnifctytfm eaumo ()arxnxo totlpDe nei;s t2ur(opou4ole lnei t s2tax  nu4alxnioeiatfsDrm(vp (4 lxnifctytlpDe n o s trxo(m3iudamtn neslt)s2uaxmpoo4olxnmocildla emumo u0tlxnir3iytomt au o;(0s2urirpou4optemictasfaDra( ont4olx mi3iyd mDemu onu0artomo3ta1fpte u i;t0t2to(rpoy4apt licia(fs2urumo;t0ole mictadfs uauvpn()tlenxocia1lmDe uei t) euoxmpiydal elfci sfaruax  ;u0aeenmo3tldls ean s;u)tlenxoctytlp  lneol( texriopou4ap  mnes s) 2trurpnu1tlxnmo3iltfm2rmn o () lenio tatla r uvs () rum(opnudap  mfeiasfsDtr(r ;u1olxomictltfa2eau p;(4arerio tytoa eanes ()tetoir3iu4opte nvs s  rrrx  ;u0apeo i3ild aDelumsnt0treomfctydfaD  uei s0sexmxr3oodol e nviat)sDtrxrp;t1opxniietldfs2rlump;u0 renxr3iydfmDeaies s setrxm3nu1amtn fvtl( srtrumo;o1oet io3iyslsDrm(msnt4arxoir tydoa  li ils t2toxr oy4omenmfeilt srtaumpnu0ale mietlt aDrluvs;t0aexrxr3oytlm  auei (  ruoiopio4altelfvtas)arra(rp;o1tpenmfeilt s2ranvs u4arerxrciydlm r ies;t0s2xm(o3nydopeelfciat  Drm(m no1tlen octyt s ra(mpnt) rtrifciotfm  au i;t)s2xoio nu1omee nvilt s2rr( pno1alxoioctadfm rm(vpn(0aetrif iydfat  ivslt s2xmxm3ny4lm elietas)arrmx pot1alt  o3ilt a2ulnvp (0teenir3iodopDrauvol() eum(rpnodol   ivsl()sDtax  oo4oleomi3tytlmDraumo t)trtriocoodfmDe uvslt0 2trim3nodlmtn ivils  ruaxm ;o4oltnifetasfaDra(msnt4 rtnio3to1lpD an o t trtr(rpiy4om  lfvsasf rtmum ;o1aeeomoetydfmDrmuvo t0tlxnio ia1lp raneo ( s2xr(r iy1lltn fet t)aDtmumono4tlx  ieils m2ul(vs;t)arenmf ia1opDr i s;s0 rxo(m3io4oltemnesasf rum(ro;t0opxoifctaslaDuaumo;()trxoxfciatlpt aieils  rtmiopoo1aptnmncslt)srrm(mp;u1tpx ifeiasfmDeanvs;()artnmrciotop ranvi s) eur(r nudal  lfcils s2ua(rp;o0tltnmoeiydfs2ean s;t4texoir oodfa eaiesl(  rto(m iodolt mies () 2rr(m ;u0opxn ocilsfm2ul(vs;(0alxniocta1oaD  i sls)teumio ou4lme mfci (fs2ua(rpou0tlt ioctasfa el( p () lenmf io1laD luvo ()srum(r3nu1lmtn fei () Draurp;o0altomfeiysls2rm(mo () eeomr3oytlm rlueols s2um(m3oy1al  mfesl()s2umumpou1olxn ictltlm em( s;u)artrxr iadoa r u i (0t2urirpny1olte nvta()sDraurpnt4ale mi3tadls2rmnmont0 lxrir oo1fmDelu olt  2xr(r3iy1alenmnctlsfs2taurp;t0aetnii3iydfaDum( p t)arxrxo3iy1fa  anvi ()trtrxrpoy1optemfvs s) Dumurpnt1aet miciasfm2ran o t0treoxrciadlm  lnvo s0t2tmxo3iodlle mfviat) rta( p;o0teeniociltfs eau p;t0tetnxf3iadfpD ai s;t trto(r3io1llt mict t a2ururo;u4tet mo3iatfsDemn p;(0 etrxr ia1fm r uei;s0 euoxr3iu1omt mnvia()aDrmx pot0aet mf3iysls2elnmpn(4trtnmo3oy1oaDr i sls0 rxoxo iy1op  lict ()srtrxrpnu4apeo ociadls ran s t4trtnxocoa1fmD lu sl()s2uoimpiu4lmee fei ()a2umx ono1oex  feilsfa umu p (0 etomocta1om  ln s;s0srxoxm oy1aptnmfct s) Drrur ot0opeoif3iydlm2elu snt) eerxr iytlmDraieo;t  etm(opiy4ope  ncslsfaDrr( oot1oetomoetas sDrmn snu4teerxo tydlpD an sl()trur(rpiu1ol nlfcilt a2umuro;t1aeenifciltla el(vo;u)trenmf oo1omDeli i (  rxoxo ny4olt mfctls arrru ooo1optn iciltfa2rmuvo u0 etnxo3oydlptrlivs t0seumio nudom n neilt s2tax pou4aptnmfeiat a2eaump u0treoxo iotop   ies t seto(o nu4lm   iesa()s2tm(rpnu0aptnmoctltla2ul( p t)aeenxf oytlptelu s;()seuoxopiodlltn nciat) 2tmxm ;t1tpenmfctltlm2rlnvo (0 rerio3oydlm r u s;t0t2triopnu4ameemnct s  rtmxrp;u1aleo ietadfa ran p;u0 lxnxocoodoa e n ol() rxrxopnu4amt  fci sf 2rrx oou4aee  o3iatla rmuvon(0trtomf ta1opt  nvo ()srtrim oudom   icslt sDtmx o;t1tetoii3tltfm umuvs;(0tlxoxf ootoateai s (0 euo(o3oo1ap n fvs sfa2trxr no1tetn oeiasfs um(vpn(0 rtnmo oytop  ai i;s  2umim3no1lmtemnctat)s2umum ou0aexomfctytfm ulnvpnu)aeenir3ia1fmtr ieolt trtm(mpoy1omeelnci ( aDumx p;o0olxnifciyd mDul( on(4tlxnxf oy1oat  n i t)trxmxr ny1ap  mfvs (f 2umx pno1apxnii3iydfaDemnvs ()tltrmo totfmtrln ols)srurim3oo4ame mfvslsfs2ur( ont4tet  fciydfaDrm(ms;t4 rxoxocoydfmDe u sls  ruoxm iy4op  mfvta() 2ta(m ou0tlto fetys s2eanmp u4arermrcoadopt ai s;()sruoir3oo1al e iei t srtmu  oo1tpto ociydfm eaumpn()texrir3iytlpt livsls)sexoim nydomtnmieil() Dur( o;u1tex  o3tlslsDul(mp;(0arxoxfcoo1omteaivi t s2tr(rpny1ame  fctasfsDtru  nt4aexomfciasfa2rau p u4aetrioctotlmDe ues ()trxmir ou4am  mivtatfaDua(rp;t4aetomoctytlsDul( p (4tlenmrcoa1om r n ils0t2tmxm3ou1om e nvt t s2umxm ;t4tleo o3ils sDel( p;(0 etomo3todfat an sl(  2xrxopiu4lp n ivsatf rta( p;u4alt  f3iatfaDranvon()tetnir3ta1lmteliei s0s2tmimpiy1om  livta()s2taxrpnu0aeto o3tydlmDua( ont0aleoxociytopD  iei;s) eurxmpio1ale lnetat sDrrxmpnu4tlto feiys m ea( o;t0altrxf3to1faD aiei;s0trxoirpiu1lmte ict (  rtrxmoou0ole ifctadfmDran s;u0trerifciadoatelieol(  rxmiopnudolte neslsf 2ta(ro;u0alx  o3tadfsDua(mont4altniocio1lm   ieo t)srumxm3nu4aleelnct (fs2uau  ;u4tpenmictydls ul(ms (4texoxo3oo1lmteanvo (0srtr(o io4ol e nesa(fsDrr( onu4ole ioetas m2ra( on() rxnifctadfaDeanei;s0t2to(r ou1lm e nct ( s2rru ono4opxomiciysls2uanms t4aetomr tydopt  ueil(0trur(rpno1omtelivi sfa2uau  ot1ole  feiat m ua(von(0tltrif oo1fp eauvi;t  2umim3ny4lmenlnviat a2rr(m ;o0oeen ociadlm2ranvpnu0alxrxfcio1fpD  u ilt0sruoir oudlm e nci t s2ua(rp;t4aptnmictyd sDelnmpnu0 renmfcia1opt  uvs t) 2uo(m3iy4omen ivs t  2rmur ;t1olxoiietlsfs2umuvp t4tlxoircoy1lptrln sl( srur(mpno4opee fctl(fartrxroou0opeoifciatfmDelnvp;()trtnmo tatlmDrau o;() 2xo(o3iu1ame mnes s) rrm(ronu0tetnifctadfm eau o;t)teenxociy1opt  i ils)s2xo(o ou1optemiei (f Drr( ont1tee mf3tydla2rm(vont)alermo oadlm  lnvi s s2xrxm iy4ale lneia( aDrru  oo0tetnifeiadlmDra(ms t4 rtoxf totlpDr ues;s srtoxr iydal n fvs sf Dumumonu4tpeo o3tysfa um(ms;u) exoxr3iytla rlues (  2uoxm3oodopenlfci t  2tr(roou1oee mo3iytfa2eluvp t4 etoxr oa1lm  lueilt) etrir3iy4ap  mnci s) rraur nt1optniicias aDua(ms t4arxoio tydfaDeanesls texrxr no4amee fes (  rumx  ;o1apenioeiysfmDrlnvp;(0 etoxrcoa1lmtrauvilt0s2xoio3ny4lme  fcta(  Dtaxro;t4aeenifciadlmDumnvont0arxnio3oa1fmDe i slt0sruoimpiudal nlivt sfa2trxrpoo4apto icildlm2elu o;(0 reomo iytomDrli ol()teur(r iudlp  micta( a2taur oo4oetnmfciat m2ea( o;(0texrir3ta1la eauvsl(  rxoxm3ny1optn fvi t)a2uax pnt1olt iicils a2ra(vpnu4trxrxf ty1lmD lneo t srxrirpoy4optnmneia() rum( onu4tlt moeilsla em(mp;() lxrio iotfmDelnvil(0seuoxopnudaptnmfcsatf rtr( pot1aex iociltls2rmumsnu0 eenmf3tadlp eau sls t2umxr3no1lptnmnes ()aDurum no1oeto f3tldlm2ranmpnu)tltoxf3oydfm e ivs t0t2um(o iy4om nlnvil(f rrrx  nt4tltn o3iydls eau s u4aetrifcoa1oaDr ivils teumxm3iy1ll nlieslt)aDumu oou1tltnif3iysfm umuvs;t4aeeoxfciy1fateaueo;s teuo(mpoydlpe lnetl()aruax ooo1aetoif3tld mDelu sn(0trxnmocoytlmt ai i;s texrio iy1lleemfcs (  rtr(mp;u4oetnmoetld m2ua(ms;() eenmocio1op elu s;s0 rtoirpou4ol  livia(  Dua(  ;t4olx iicild a ulnvs;t0alenxr3ta1fmD au i;t  exr(r iudamtn ieils)a2ur(mont0opt mi3iyd a eln snu) lxnxr3iadfpDr neo;s srxoirpoo4am elnci sfs2tmx  ;o0apeoifetls a rl(vont0artnir3iadlp eaueo;(0s2xriopnu4lmtelivi t  2umur ;t0tle iieildfs2el(vp;(4arxnmfcootlatr ieslt  rur(opou1am  mnvi tfs2rax onu0olenioeiltfsDemnvpnt0 renmf3ta1omt au s (0 euoimpiy4ol  mfcilsfs2rr(rpnu4tlxo f3ilt s em( s (0 etrxo3to1oaD  ieil(0srurirpno4ameelfctat)s2tmx poo4oetniieiasls2rmn s;(0texoxo oodfaDeai ols)t2xo(o3iydolee nviat)aDtr(rpno4apeomieiatlsDrm( o;t0aexrifctytlp rluvs;()trxm(o iy1lmee ivi ()sDtr(  no1aetn o3iasfmDrau snu4texrmo3ta1lpt  uvo s) exoiopno4olt lnvi sf rraumo;t4alx  i3tlsls2ra(mont0 rerio3tatfp  livs;t0 eur(o3ny1lp nlfctas  rrax onu4opeomiciys mDrau snu4alxnir3to1op elivs;( t2xmio no4lpt lfvs ()a2tr(ro;u4altn f3iadfa2em( o u) etrmo3oodomD au s;() etmim nu1lm nlnct sf Drm(mo;t4oet iieiasfm2ulu o (0 lxomfciydfat lu slt)trxrir nu1lmen feslsfsDtmxroot4tltoii3ild a el(vpn(0alxoir iytop rlieol(0sexoim3oy4op  livt t arra( p;u1tee iictys m2ulnmo t0 rerif ia1optrlies t0s2tmxo3nudlmenliet s sDra( onu1alxoio3iadla2ra( on(0 rtnmrcoo1oat anesl(  ruoxm3no1om  mfesl(fsDtmuronu0openio3iysla2rmumsnu0trxoircoa1lmt  nes ( t2tr(r oodop   nvt (fsDrrumpoo4aeen i3ilt aDrlu p (4aeerio iatomDelnvi;s0trumir no4oleelncilsfs2um(mo;u4oex mf3iyt a2rluvp t4tlerxo oytoaD  nei;( srxrirpiu4oltnlieias) rtr( p;t4apeniieiysfmDemnmo;u)areoxr3oatlp   n s;(0 2tr(r oodlpee iviltfa2rrx  nt1tlxoifciasfm ul( p;u4 exnmfctodfp eluesls t2umirpno1lptnmnviat  2umxm ou1alx mfciyslmDumnmsn(4 eenmocia1oa r uvs ( seurio3oodlmtemieil(fsDta(mo;u1aetn ictadfs ulums t0 lxomf io1fmtranei;s0srum(r3iydoleemnci s s2tax pno4open fciadfs elumsnt)trermf tytlate nes;(0sruo(m nydlltn nvils)s2uau oot1tpt ii3iltla rlumont)aeeoxocoatoptran s s0s2xr(r iu1amee iet (fa2tmu poo1tpto oeiasfsDelnmont0 etnmo tytomDeauvi ( sexrio3nodam  livi ( a2tm(r no0oltoiietls s elump;t0arenio3io1oa r ies t0sexo(r iy4aleelneiatf 2ra(  nt1apeomfeiltfs2rauvon(0tlxnirctatlptean ol() 2trxo iu4omtemfesltfa2tm(  nt4tpt mfctatfm emuvs (0 rtomo3oy1fp  lneilt)s2xrimpiu4llte icias) 2um( oot0oeto fetld s2uanms;t4 exrio to1fatelueilt)t2xoxr3io4op   nvsa(  Duaurp;t1teenmietas m eanvp t4arxrxoctadlmteauvsl() rxrxm3nu1aptnlnvsas) rtruronu0texnmicilt a2rmn o u)arxnxf ia1la   neo t0s2uoim oy1op n ncias  2rr(mp;u1apxnmieiadlm eluvont4treoiociy1opt  ivs;(0 2um(opio4ope  fvi ()arur(moot1opt mf3tadla uau o u) rtrmocia1omt  nei;()t2urirpnudll n ncta(fa2rmx oou0tpx ioctltfmDelu p t0aeermrcootfatelnvil( tetoim ou1ope  neil(fsDrr( oot4altnifctlsla2rmuvsn(4 leniociadfa  aueo;s0 2toiopio4lmt  ietltfsrtaxr ou1aeenii3tls aDelumon(0aeeomocoa1lptr uvi (0s2toxo nu1altelfes ()a2ua(mo;o1ale ifetltfsDeau ont0 lermrctydfaD li ol()srurir3io1amt  ncsl(fa2ta( oou1ale  icildla2umnvonu4tlxnxo3iotlmDeanvol(0 ruoim nu4op   ivias) 2raxmp;t0oexo o3iyt s rl(mpnu0 rtoif iotfm   i o;t)tetoxrpoydame liesatf 2rrx onu4opxoifctld s ra(vs;t0tlxoxr3totlmDrau s;s0teuoirpny1ol nlnetlt  2rmumonu1tpxoifciydla2umuvs;()alxrxo oatlaDelues;t)tetmirpiu1altn ncias)sDrax o;u1ale  i3iydlm2ean p;t)aetrifcoatoatrli o s0sruo(o3oydole miesas) Drmu oot1tpxoiiciysls2ea(mpnu)alxnif totoate u ols teumio oodalenmfesa(  Dtrxmont0oeenifcildfa2um(mont0alermo ta1fatrlnesls0 2uoxr3nu1om emfvs tfaDur( o;t4oex moetyt aDel( p;u4arxomo oy1fmDrln o s trtmxo3iy1op emnet (faDra(root0alxoiiciaslm umu onu4 rermo3oy1lptranei t)s2uo(m3io1ol nlfetl(  2urum nu0aet  ocias aDean o;u)alenmfciotomte u il(0teuoxmpiodal emfviat) Dua(rooo1texomoeiatlmDraump;t4teeriociodfm eai i (0texoiopnudll n nci sfarrr(  nu1aptnmi3tlsfaDel( p;u)trtrmo tytlpte i o s0texrxm3iodam nmicsat arua(mp;t0ope iieiytfs raumonu4artnmo3ty1lptr nvo (0 2umxo3nudop  lnetltfaDrr(m ot4aexnii3iyt a uan sn(0tetrmo3ootoateanvo;( t2tm(rpou4llen ies s  rtax pot0ale mfeils sDum(mp t0 rxrmrctotlp  an i;t) 2xr(r3iudoptnliei (  2taxro;u4tleomf3iydls2emnmo;(0teeoir todlp ean il(  rumxo oy4opeelnesa()a2tr(r ot4tlt mfctyd s2rm(msnu0 leoioctydlaD lu i ()t2tmir3oy1apenmivsl(farum(ro;u4aet miciyt a ea(vo () ltoxo iytopDrau s;t0t2xrxr ny1ol   feiat)arrm(m nt1tpe mieiyd s emnms t4 lerio3oydfmt  uvo (  2xmir3io1lle mies s  2umurpnu4oetoif3iydfaDumn ont) rxnircoa1fmD  n i;t0 2xrim ny1opt  netlt) 2rm(rono4opx ifctadfm rlumpn() lenmf iatlm  luesl() 2urio no4opeemictl(fsrrmu  ou1openmi3iltls rmn s u0 rxrmf ta1fa e ivilt0trxrir3oudlmtnmivtl(f Dtr(  no0apx ifeiasfm rauvsnu)tlxoxf3oydlaD  u i;(0 2tr(m iydlpe lieilt srtmxm nu1ale  fetytfsDul( snt0aetnmr3ia1fmtrau i s0t2trio3io4aleemnvtlt)sDrmumo;u0tetniocildls raumpnt) ltoirctadopt aueo t texo(m io4altnlfvi t)s2tau  ;t0opt  i3iad m2rluvo;u) eenio3oy1lmDrliesl()srtrxmpiudam e ies sfsrtaurpnu1aex iietls s uln s;u4artrxr tatlaDe n s s) rtoir3oudom   nct (f ruaur oo1opxn feils mDrmumsnt)tltnif tatom  li o t)srto(r3oydolee nes (  Dtr(moot1altoiicils aDrl( p;()texrircoytoatrau o t0sruoxmpiy4olen nesa(fs2trx o;u0apx mi3iadfa2rmnvp ()alxrmf oodomDraies s t2xm(mpiy1al e nctlt)srrmx oou4ale mictldlm2uau p (4arenxr3iytoptelnei t  etr(m oo4opt  fei tf Duaxr ;t4oltoiietas mDrm( o;t4 exrir ootfmD auvs s) 2xo(m3iy1open ivtlt arrmuroot4apxnifetat m el(von()artoxo tadoa eln i s s2urxrpoudom nmnctls a2umumo;t0olx io3ild mDean s;u0arxnxo3ty1fmte neo s0t2xoxm iodole mnvi ( s2ur(mp;t1olxn octytlm um(von(0trtoir to1laDe n o;t0 rxo(o oy1al nmiei s  rrr(  ;u4aet mfctytfs2rlnvs;u)tlxoir io1fmtraneo;t)seum(o iu4lpeelictasf rumu ono1optnmieiydfsDeau o;(4 eeoircto1laDran o (  eumir3nydolt lict sfarrr( o;u0oetniietysfmDul( p u) ltomociydlatrli s t0 2xrxm3ou4olt  fctlt a2trur nt1tee mf3tyt sDrauvsn(0 rerir3oy1opt li olt)s2tmxrpio1optemfvt t)s2rmxmont1altniieiydla2umu pnu0 renxf3oodomDrlieo s)tetr(m nu1lme lietltfaDtrumooo0olx  oetytfa2rln p u4teermfctotfat au o;s  rxmir3ou4lltelneils) rtmxmpot0tpto o3iyslm2rmnmpnu4 ltrif tydlp   nvs ( setm(rpnu4opeelfvslsf 2tax  oo0apen ieiydls2raump t)teenif3ty1fa raivs;t  euoim ny1al   fvilt aDururooo4apxnmoeils s el( pn(0aetoxr to1la rlivol(0 rumxr3iudopeemneilt) Dumu o;o1altoifctldfmDum( p t)tetrmf oatfmte iei s0texrxm iy1ope lnvt t  rurump;o1oleo f3iyd sDulnvo t0 lxomfcoydfpDrln s;t0teurio oodll n net tfs2rr(rp;o0oeenmoeiydlmDuanvp t0alxoio3oa1lp rau ils  2tmxo iudomtemnet s sDurxm nu1texniicilt s uauvp;t)aexrmfcto1omDelu slt) 2tmxo nu1olen ncilt) 2raumpno1oleo fetasfm2uau on(0aexoio3iotoat  i sls0teuo(m3nu1optnmfvs (faDtax  ;u4opt mi3tyt a2ran s;u0treoio3tydfmtr iesl( trxoxm3ou4alt lfeiasfaDrrum ;t1openmictysls2eaums t4 lerio3iydlpt aieol(0 etr(mpno1ol   ies s) 2umur ot0aexoifciytls umnvp t4 etomf oo1fpD li ils s2urxo ny1llt  ics s) Dtaxm ou4tlxnmictlt m eanmp;(4arxnmociydlmDe uvi;s  rxrimpoy1alee fcilt  rumxrpnt1tltoioeiydfs2raumsn() rtriocoatfm   ieo;s0 exr(rpnu4ole  nesat)s2umurpot1openmf3iysfs2umuvs t)alxoio oadlmDeli o;s)teur(m nydope mfeslt  rumxmooo0tlt  octas s2emnms t4 lxrifcoodfp r neo s0sruo(opou4altnmnet tfa2rr(mooo1aee  f3ildfs2rl(vsnt)tlenxrcoo1oat lneo (0 rxoxm nydomtelfcils a2umum nt0opt  feiytls em( o t)aexoxr ta1fa  an s (0tetm(m3no4lleelfvsl(  rrru  ;t4oleomieiytfaDrm( pn(0 etoio3iotlpDranvols)tetrxm3iy1ape mieslsfs2rmu  no4olt if3iyd m emu pnu4 exnir3tytlat  n o t)srxoiopiodllt mfvi t  rtmx o;o1tlx moeiatfm2umu p;() lermociy1fp r ivs s0t2xrxmpiy1ap  lnvi (  ruaum oo4tlen icilsfm rl(mo;t0trenmociotfm   ieo;()s2urim3ou4lm elncta(f Dta(  ot4tle  feilslm em( o t) rtoio iotomD  uvs ()truoxrpoy4lp  licslsfs2um( pno4altn i3tad s em(msnt0 eerxr oytlmDeauvi;t0srtmxm oudllt  fvi s  rumxm ou4tee io3iaslmDemnvo;u4 rermoctatoa  anvi;t)truo(mpiudaltn ictl()aruau pnt0aeenmociyd mDem( s () lxrxf3iy1fmDe nvsl(0 rur(o oy1ol  lnvils srtaxr ;u1tpx ifciyslaDea( onu)tlxnir iotlaDeauvo ( srxrxr no4al nlfei s)a2uau pot4tpxn f3tytfs emumo u4tlxrmf3oodlaDe i s () rumxo3ny4lptnlieias)sDurxront1alxnmfeiytlm ul(vs ()tetrmr oytopt anvo;s)srum(r ou4lltnmivs tf rrax pou0tet  ictltls2umnms;u0 etrxo3iatlmteaieilt0t2umxo3ou4amtnlfvi t)aDuaurono1oltoif3iydlm2uaumo t4trtomfcto1fp  aies;s0tetr(rpoudlm   iesltf rtr(r ot1oexo fetyd a2ra(vp;(0arerxf ta1fp eaieolt)s2xoimpoo4aptnlicsa(faDrmxm nt4tpe iiciatlmDulnmo;u4tetoxo tatfateauvi s tetrimpnu4olt  ieias)a2taxr ou0alt iociltfsDul(mo;u0 lxrir3ootfpDeaies s0 exmxo3iudop  lfvtlt)sDurumono0tlen iciasla2emumo;u0texrxoctotopDeaivo;t0 rurxmpiu1aleelfcs t) 2raxrpoo0opxo fciyt m uaums ()trermfctotopte ieo ()trto(opnu1opeelieta(farrrx pnu1alxn oeiyd aDrluvpnu4 rtnircoadopt ai i s)teumio3nydolee ietl() ruax pno1aeenioctadla2rlnmp (0 etniociadlpt ln i (0 rxrxm3oy4al nmncs s  rrm(r ;t4tpe  f3iltfaDua(monu4 ltoif3ty1laD luvs;(  exr(rpoudlm   iet () rua(  no4tlxo f3ilsfm2rlnmp;() eenxr oytlat li o t)srxr(o3no4opt  ici t srrrumpot1tpxomictytlsDuluvs;t) eerioctydoa rluvi s)s2uoimpiudale  icsls) rraurpnt4oee  fctlt m elnvpnt4trxrmo3oytfmt livo;() rtrim3oudame lnvi (  Drmxm ;t1opt moetydls2ulnvo ()aeeomr3ta1fa elivo;t0trtoimpno1amt  ies (fs2rmum ;u0tptnmiciadlmDrmn pn(4 lenif oy1om e ueols setrxm3oo1ap elnci ( srra( p;t0apto fciytfaDrm(vp t4trtoif3iotom raiei;s seuoxopoo4optnlfvtl( srumum ;t1oexnmf3iadfaDelnvp t)tltnxo oydlpDe ivslt0t2trxrpnodapt  nvi t  rraxmp;u1optnifeiydla rlu p;t4artnxo oytopD lu ilt0teur(r oydam   fcs t sDrm(rpot0openifeilslm2ua(mpnt4 rtnmrcoadom rli s ()setoxr3nu1omte nes t)arrr(rp;o4oleo i3iltfm2uaums;(4trxomr3todlpDrluvols sexoim iy1olen ies ()aDtaurooo1oeto feiydfs2rlnvont)texnxf3to1laD lies t0trtm(mpnodam n fvtltf rrru  ou1tetniiciysfm elnvs (0areoir3to1lpt lnvo s0 exm(r no1ameemnei (f Duru ont1tptniictysfa2eln pnu4arxoxfciadoaD  ieilt0 etrxm oodam emncils)s2trxronu1tpxomoetys mDrluvs u4 reoio ty1fpDran i;s  2toxo3ny4ome  ivilt srurumo;t4texoii3tas mDuau o;u0alxnmo iadfp rln o ( trtm(rpoodam  micslsfa2rm(r ;o4optnmoeiatlmDean p;t4tltrir ootlm  an i t) rtm(rpoodlpt lncslt)a2trxmo;t4opxn o3iatlsDrau onu)trxnxr ootfmteli i;(0s2tmxm3oydom elnvsas)sDuaxr ;o4opxomf3tasla em(vp;(4 etoxrciotlpDeli o;(0s2toxmpnu1aptemivslsf Dta(m ;u0oet  fcilsfa ra( snu4altrmf iy1omD livil() 2xo(rpnu4lltn nvs s) rraxmpno1apxoifctld aDel(vs;t0aexrmrcta1lmDranesl(  euoxrpoydll nlnesltfsDua(mp;o0opt ifctlsls2elnmpnt4artnxrcoodom e i i;s0 2toxmpiudap elnci s srtaxrp;u4tpxo feiysfmDum( s (0aexnmf iytfpD  i il()trxo(r nu1ll emfvt ()sDurxr nt0tlxoii3iatfa2um( s;u4 lxrxocia1fate i i t0truoxo3iydlmt mfvia( sDrm( oot1aexo i3ias s ua(vo () etnmo3oa1lmDelnvi t)t2tmiopnodapte fesl(f 2uaur no4oleomfciysfm umuvpnu0 lxnxocoy1oaD lieolt)t2urir nydlmtelneta(fs2um( onu4alxnioeiltfm rmn p t0alenir3iotomDeauvs;t trum(r3oodll   ivias)a2trxronu4tle  o3iyd s2uluvs u4 eerio3oy1fatrau o;()srxoxo oo4lptnmivia( sDumuro;o0tee ii3iad mDran p t4artomf3io1fpteln s;s trxm(opiodale lneta(fsDurxrp;o4aeto f3tytls2ea(vp;u)trtrmf3iatoa eanesls0 2tmxo oo4al n fcsasfaDtrxr oo1olxomieiatfaDraumonu)tetoxf3tatlmDeaues;(0srurir3iydlme mnvi () 2rm( o;t0opxnmfctasfaDrm( s;u0arxrxf3iatoaDeluvol() etoio ny4lme  fvtas sDrruro;t4tle iieiaslm emnvs u0texrmr iytfpte uei;s)t2xoirpio4lm  mfcsa()artrx  ou0tltomo3tad mDeluvp () eenirciy1fpD  nvols srxo(m3ny1oltn iviat  rur( onu0tlt  ietld aDeluvpnu0trxomf todla r ueilt srxoxr oy4lpte ivtltf 2rmxront0oetomoetldfm2elnmp;t) exoir iytlm  auvsls)srurio3oudll n fvt s  2tmu  ;u1tee mf3ilt a2rlump;t0tetrxrcoodoat ai sl() rtr(o ou1lpte fei ( artr(roou4aexnmi3iytfm rm(mp;(4 lerxfcootfm eauvs t  2tm(r iu1lmtemivs ( artmu ono4apeoii3ild a2emnvp t)aeeoif oatoaDeluvils)sruo(o3oy4ol  lnctat) 2truro;u4openmfeiat m2ul(vs;u4 eenmo oodoat ai ol(  rtmxm3iydame lnei (faDtrxrono0tlt ifciysfs2uau o;()tleoif3oa1omtelieo t  exmim oydap  mneils)sDtm(mpoo1tlx mi3ilsfaDulu on(0 rxoxr ta1lmte iei t trxrim3oudomtnlfvi (faDta(rpnt1alt ifciatls2rl(vo;t) lxoif oatfatelivsl(  2tmir ny4ome micta( sDur( pot0apeomfciydlm2rm( s ()tetrxf3iadfp  au s;s teurio3nydlpenlnvta() 2trump;t1tleo oeilsls2elnms u0artrmfcto1latrli sl(  rxm(o nudalenmncsasfs2umxrpno1tpenifctad sDeaumo;u4 etrio3oadfpDean o;s)t2xrxr3iodalenmfvil() 2rrumo;u4tltn feilsla eanms (0 rtrxo3iotlmt au ol()srtrir nudam nlfeil( arrm(  no0ole moeias mDranms (4 lxomf3to1faDrliesls)texrir oudlpt  feiltfs2uau  ;o0aet ii3iltfsDea(mo;u) reoxf iy1fatr ivolt s2xoxo iydllee ivtls) Drmxmont4openmoetysls el( p (4 rtnio tytlaD  u i;(  eurir oy1am nlnesl(faDum(mono1apxniociad m2ul(mo t0texoio3tatfaDrlnvsls0seurio3iy4optelfvi t  rra(  ;t4opxo ietasfa2rm( pnt) rtnmo3ootfaD anvs t)trurxopiodlptemfctatf 2urump;u0aptniiciys s2ulnvp;u0trtrmocta1op ranvsls) exrir3nu1ll  lfctls arur(  ;u1openiietadfaDea( snt)aexomf3ia1lmtean i;s s2umxo io4lpeelnciasfs2ra(rp;t1olxnmictytlaDea( sn() rtrxfcoa1fatrln o;t0texrxo3iy1am n ici tfarrau pou4teenmictadfs2ulnvp (0arxomocta1latr nvi;s trtmir3ny4lpte fvi tfa2rm(rpou4altnii3tlsfsDrlu p;u0tltoifciatoat ln o;t0t2xmxm nydoptn iviat  2ra(  ot0tpt mocilsfa2emn p u4 lermo3iotfa  au ols seto(rpno4lm   feslt)sDum(  ot0tpe mf3iadfsDumuvs u)trtoxr oy1fm rluvils  2um(m iu1olte ncs t)artru  ;u1oee  iciatfm umn o (0texoiocoatfmtelueil() 2xr(rpnydlleelivtat aDur(rp;t0aexnio3tld m2ra(mp;t4 etnifciadomD liei;s0srumio ou4ol  mncsltfs2trx o;o0oetnifeildla ua( o u) ltoxr3oytfmte n ils)trtrim3ny4lltnlncsls)a2ta( onu1aexo fctasfmDrmn onu0 rxrmr ootlptraieo s)truoimpiudapee ivt (  2urxroou1olxoifeiydfm rlu on() renmoctytoptrai i;t)t2xoim iu4ol nlnciatfsrtr( pou1oee mo3iaslm2ranmp (4 renio oo1omDelnvs t s2xmxo io4lptn ict t)srra(m ;o1tetn octls m2uanmont4aetnmo3iytomtraieol()sruo(rpiu1apt mnes tfsDrmxronu1opt if3tydlaDuanmpnu0artomfcoytlp rai olt0setoxmpio1lp  liesls  Dta( onu4aee mieiyd aDel(vs;t0arerxr to1lpDr n o;t)setoxo3nudapt mnvs t)a2rm(rpou4tpe  feild a2rlnmo (0 ltomrctadfaDeanvo s0srto(opnu1olt lfvilsf rtau  ot0tpx ifciatfaDemumsnu)trtrxf iadla r n o;t s2trxopio4lmenmfeias  rua(ront0aptoiieilt m2um(mo t4trtrxf tatfat  nes;s0srur(opiodlmt lfcs t srum(  ot0alx iiciatla2rmnvo (0 rerir3iy1lp  lneolt)s2toir iy4lltelieia()sDrmurp;o4tee iietysls um(ms (4trenxociydom eaieo;(0 rxoim3iy4ol elnciltfartr(mpot4teeniietysfa2uau pn(0 exoif io1lp  livo () exoxmpiodame lietltf Drm(mp;u1tltoifeiytlaDean onu4texrxocio1lmtrlivs;(0srxoxo oo1lp elieiat) Dta(  nt1aptn ieiyt sDem(mo;u4 ltnmrcoadfm e u i s) etmxmpoy1lmtn ivs t)srtmxmoot0tptn o3tydls2elumo u0 lerxr todomDelivo;() euoio oy1om   nes (faDurx oou0tpt iociadls ranmp;u)trerxfctodopDelu ols srtrio3ny1al n ncia(f 2tm( p;t0tle ioeiltfs2elnms;u4 exnxf3oadfat li s t0texmxmpoydlpeelfcsa() 2urxrpoo0tetoii3ias s ranmon(4arerir to1fmtrauei;()setr(r nydaptemfcta(f Drm( o;o1teen i3iys s ul(vpn(4aetnxfcoydfmDelivo t  2tmir nodope lnetlt s2tax pou0tee miciydfs rmn o t0trxoxr iytfp eaiei;t)s2xmxm3iu4apt  ivs (f 2rmurpot0olxnmf3iyslm2eau snu)tlxnir3totoa raiei;s)teur(m3oo4lpenmict sfartr(rono0tet iictydla2em(mp;(0 rxrxo3iy1om raieil() ruo(rpoodapee nesa()srur(r ;u1tltoio3tlslsDrln o;t)artnioctotfmte uei s)sexrxr3iodal n ivtlt s2rau o;t0olxo ieilsfaDraums;(4 ltrmrciadopD  uvs ()t2umxr iu4ol nlivs sfaDrru pou1aptn ictas a2ean pnt0arxriociy1fm rli o;s  eumim iu1ol elnei t)aDtr( o;t4texomieiadlaDelnvs () rtrxo iotlpteai ilt)s2toxopio4omenlnvtat sDtaurp;t1oetomi3tlsfs umu s ()altoir iotom   ieils truoxo oy1llt mieil(f 2rmu p;o0aptomieiltls ra(ms;(4arxrmo3iotlptr i s;t0t2xo(opiy1lmtnlfviltf 2trxm ;t0apx  f3iysls uau s;u)areomocoodom   ues;s0teto(r iy1amte fctl() rrr(m nt4oexo ieiytfsDrmu o;u0altrmfciydlat auvil()tetm(opou1olee ictlt)a2tax pnu0tlen fetys aDrlums ()tlxniocio1laDr ueolt0s2xrxo iodameeliciatf rrr( pot1apxomfctatfaDeln o;t0 leoxf3oo1late n i s) exoir io4lpe  nctas)s2umxm no4texnmf3tytlsDrlnmp () renxo todfaD  neols)srur(m oo4ol nlnvtas  Dtm( ont0aetn f3iadla uanvs;u4altoio oodlptrlnvo;t) exr(o nu1apee net s)arrrxm ;u4aexn fciatfmDrm(von(4altrxfctatfaD livol(0s2uo(m3oodom nlnesat s2rax  ;u0optnmfctlsfaDrauvp;u) ltoxf3iy1omt aieo s  2uo(opnu1omtn fes s) rtru  oo1tlt mfetlt m2ulnmsnu4tltnir3oy1lmD lueilt)setrxm ou1lltnlfeilt) Drm( o;u4oltnmi3tytlaDranmp u)trxrxfciydlate uvol() rxoxo3io1lptnlics s)srurxmpoo1tlx io3ils mDulumon() rtoif io1om e n i;t0trtrxr3iu1op n neia(  rtr(r ot4aex moetld mDum( p t0trenio3todopte n s s)teuoir ou4om n fvsas  Dra(mono4tee mociydfm um( s u4 lenmf3oodlate u o t  2urxr oy1am   net s)arumx  ou0ape mo3ild m el(mo;(0 lxnif iodfm  au o;t  exoio3iudop nliesa( arurxr ot1oexo ieilsfm2rmuvont) ltrmrctytom   nvi;t s2uo(mpoudal nmnvi ( a2ur( p;t1tlto fetyt m emnmp;(0alxomf ia1laDr uei t0s2urir oo4ol  mnvt sf rrmxrpot1oltn ocilt m2ua(vpnt4 eeoircoatlmtelnes;t0 rumio no4lltnlnci ()aDtaxr oo0tltn ociys s ua( s;u0tetriocty1omtr i o;s0 2umim3ny1amtelfvtas)a2rmu pno1alxomfciadlm2ul(vs ()arerio3iytfpt li i t t2toir3oodll  mivs (  2ua(m nu0apt  f3ildlsDuaums;u4arenio3iy1oat  ueol(  rxoxrpiu4ol elfei () rraumpoo1tetn fctytlmDrmnmp;(4aetnifciydfpD auvo;(0 eur(rpiy4ale  ietatfaDtaxmooo1aee mfeiadlaDrmums t)tlxoif oytfptr u s;(0t2urir3ny4am n feiasfarumx oot4aleomoctatlm2ran on()trxnxfcta1lpD auvo;t  rurxo3iodamt mnciasfarurxm oo1oee iietytfmDumumo u)tlxnmoctytomtrlnvslt s2ur(r no4lptelnvi ()sDra(moou0tetomiciydfs2ea(mp t) eerxo oodlmDr n sl(  rtmxm no1ol nlfeslt  Drr(mo;o1apt iiciasls2emn ont)arerif tadfat liesls truo(mpiydlpee fvs sfs2ra(mpoo1tle mfetlsla umuvp (0teeoio3ty1om e u s;s)srum(m3no1opeemivta(faDtmx  ;u4opxoiicildlm2ran snt) etnmf3tadomDrlivo;( seum(mpiu4apte fvt t srtmumoot0aeen ieiys m elu onu4 ltomr io1faD aneilt)trtmim ny4omtemneils) Dtr( pnu0aleoiictldfsDrlnmonu0aleoio3io1fmt lueol( s2xm(o oo4oltnmivi t) rtmuro;u1tltoii3ils sDrauvp t)areniocia1fa eanvsl(0t2umxr no1al nlnei ( a2rrxmono1apt  iciadlm2rmu p u)alxrmr iodfptrau s ()t2ur(rpiydapeelfvs s) ruaum ;t4tleoifciad a2ua( on(0 eenxf3oy1lmt  nei;t  eto(m ny1llt  fesatf rum(ronu4openio3ildls eaums t)alxomo3totom eauvols)s2um(rpou4aptelfctlsfsrtaumonu0ale  i3iltlm2el(vs (0 eerircio1oa  ln i;s)t2xr(o3oo4am emivias)s2tmx  no0tleomfcils a2umnvp;(0trtnifctydoat  u i s0sexmim3oy4oleemfctls)s2taumpou4tee mociadfm2rmu pn() lxnif3iydomt anvi (0s2ur(m oydll e fei ( s2ua(  ou4opxnmfctat s uau onu4alermrcty1fpDelu o;s)teuoim nydll nmncsa( s2tmumoou0altomfeiasla2ul( on(0 rtoir3oytoaD  u i;s0teurim iu1ap  mnctas sDtr(  nt1apx mf3tls a umuvs t0 rxnxr oydopDelnvs (0 rumxopny1ame mnesls)aDta(mpnu1apenmoctyd m ulu s;(0teenmo to1la  li i;t  2toxr3iy1om elivilt) 2umu  ;u0oee ioctas s2rmnvon(0aeenxo ia1fmtrauvs;() exmxm ny4lpt lfvt tfaDrmu oot1opxnio3tasfsDua( pnt0aexrio3iodoa  lnei;t trtmxo iodome  neils)sDra(mpnu4oeeoif3ilt a raumpnu4artnmocoatfmD auei (0setmiopio1lmtn nct ( arta(mpnu1ope iictadls eauvp (4altnio3tydom  ln i;t0trxrxr nudope lietat)a2rrum ;t4tleoiietltfa ulnvpn(4artrifcoa1fpDe uvil() rumxr3oo1lp nlfcils)s2rrxront4oetoifctldlm2umuvon(0 exnmf todla   nvsls t2trio3oy4ol elnvtatfa2raxm ot1tle  icildfs rmnmpn(4 lxoxo3tadfpD lnvi t)srtoxo3oo1al   fet ( arumumo;u4aet ioeiyt m emump;(4trxoxoctotfmDrauvi;s)texm(mpnu4lm   fvsa(fsDumu poo0alenif3ildla emumsn()teenmfcoydfmD  ues t)t2tmirpiu1opeeliesa( s2rrx  oo4tlx moeiysfs rm(vp t4aeeomrcoy1op r u s;t t2uriopiydlmtnlivsa(fsrta(r ;u1ole ifciydfs ulu p t) lxrioctydfatrlnvi t0trur(r3io4ame  feiasf 2ta( oou0oexomiciys a rlnms;t0 etomo3ty1fmtelu o;s0 rxr(opiodlm nmivs tfarum(moou4oleoioetytla ea(ms;u4alxnmr3tatlatrlivo ()trtmxo3iudlp  mnct t srumumpot1aptn ieiysfsDuanmo;()tlxrmo oa1oaDeai o ( trtrir ny1am   net s) rtmxro;o0opx mietytla elu s;u0alxnmr3ty1op   i s;t)texo(o3nudomte ncslt)srrm(r ;t0oexomoetas m2ea(vonu4 eerio oo1lat auei (0 2xo(rpno1omen fct tf Dtrumpnt4tpxoii3ias sDrlnvp;(4 lxnmrcoo1fm r n o s0texoir nodoleelnvs tfaDtrurooo0oexnifciyd aDraums (4texnxo3todfmt lueols  rxmiopnu4al e nvtltfsDtmxro;t0oex mictyslsDuaumo;()trenmfcoy1la r u ols)s2tr(o3ou1lp   nvi sfa2rmur nu1texoif3tasla2um(mp u)aeermf3iatoa eanvo;(0s2umxo io1oleemfcia(faDrm( ooo4tpenii3tltlm2el(msnu4aeenmf iatlpDran s () 2tmxr3oydal  mncils) 2ra( oou1tlenmiciltlsDulnvsn(0alxrmo3to1opt aneo s)sruo(opoo4lptnlfci t  rrrxm ou4apxn feilt m el( onu4 etnxr iodfmDr i i;s  exo(opny4openmivtlsf Duau onu0tpxo ociytlaDel(vp;u4 eenio ty1oa   nes;(0srtmirpio4apenmieia(faDurxmpnt1tpe iociyd sDemnms;t0 rtnxf3oytlmDrauei;(0s2umxr oudole mnet t)srtaurpnu0tex moctysfs emn snu) rermf tytfat lu o (  eurir3iy1ap  mfet ()aDumum ;u4aeen fctatlsDeanms u)altrxr3ta1faDr i il( srur(mpoo4llee fesltf Duaxm ;t4aee io3tydlm ra(msn(4aeerir3oodfaDrlneo s)trtoxrpiydope mfeia()arrau ono0opto fciytlaDeanmp;u)aeeoio oydla   nvo t0s2xrxrpiodlltnmfvils) 2tax  ;o0alxnii3tldfmDrluvs () exnmr3ta1lp raneo;t) exoxo iodopeemnvtlt sDrr(  ;t4apxomo3iyt a uan sn(0trxrxf3tadopDe ivs;s trxoio oy4ll  mncils)srrmu onu0aptnifetls a ua(mo (0alxoxf iotopD lneo;t)srxoxr3nu1oltelfcs s)s2rrur nu1tlt mfetatfs2rmuvon() exnmr3todlp   ivi (0 2tr(m3nudoltemncsas)srua( poo0olto iciatla rau s;(0 eerir tytla   ues;s0srxoir nu4ol   ictatf Dtmum ;t4alxnmieiltls emnmpnt4areoxrcoatfa elivslt0teur(o3iodaptnlieilsf rraxro;t0apx  feiyt m2ea(vsn(0 rxoioctadfa rlueo t)sexo(r no4open ictasfaDrrxrpnt0aeeo fcilt m2ulums;t)arenmr io1lpDelivo ()texoxo oudlle mfvsl(  Dur(rpot1aptoifeiysfs emuvsn(0trxoio oytla  lieol( seurirpno4lmenlncslsfaDumuront4oeeoiiciatfmDuanvo (4tetoifcoa1laD aues (0srumxo3ny1ame mnvi sf Duaxm oo0tlt ioeilt mDumuvp t4trtrmfcoytopteai ilt)srxrimpio4lp  lfes s artau pot4alx iictyslaDemu snt4tlxrmf3oatfm rln i;s0srur(o oo4lm elicta(f Drax o;u4apenifciatlaDuau pnt) ltoioctodomDrlu o;t) rxrxmpny1optn fesa() Dtmu oot1teeoioetatfm ul( p;u0trenmfciadlate i i s0trxrxr3ou1amt lnetl(fs2ta(mpou4oleomoeiatlsDranvpnt4alxnmocoydfaDeaivs t0 2xo(rpio4ll e nciat)sDua( pou4opto oeiat a elnvo ()alxomr3oydoaD aueo (  ruoxo3iodol  mfetl(f rtmu o;o1apxnmieiasfmDra(ms ()aetrxo3ootom eluei;(0srxo(m3oudomen fcilsfaDta(rpnt1tpt iociatla uan o;t)areoifciotlm e ieslt0t2xoxopno1op e nvt sfsrurumpoo4tlto feils s2umnms u) rxnif3ia1fat anvsls srtrirpiu4op emfvilt  Dtmurpnt0tltn ociltla2rmnvp u4treoxf iy1opD aivilt)srxrxo no1apt  fcta( srtmxm nt1aeeniieiysls rl( o;t)aexnif3oo1fm raieo;()s2xrxr oudlp n fcias) 2rauro;o1apxomociatfm umnvs t0treomf oodfpD  ies t)t2tmir iu4altnmfei ()sDuaxm no1tltnifetaslm rmump;u4trxomrcoodlat  i s s)tetm(o3oydole  fetls aDum(mono1alto o3tlt mDua( p;(4aeenir tytlpDeau sls0sexm(o ny1op   ieil(fartr( o;o1altomo3iydlsDuluvs () rtoxrciadfa rlu o t teumiopiy1altnlfvtltfaDrr(r ou0tlenmictls aDeanmon(4 eerir3ootfmDrli i;(0srtmxopoy1alee fviltf rur(mpoo4oleniictls s2em(ms u)tlermf3oa1fmDe n i;(0 rtmimpio4lm  lfvslsfsDumxroot0opxn fcildfaDra(vs u0tlenxo3ty1op rluvo s0 2uoxo oo4op nmfvs (  rtr(  ;o1apx mieiydlm rlnvsnt4tltomf totfpD anvols0 rxoxm3iudlleemnciltfaDrmx onu0aexn ocilt a uluvo u4teenxocio1lmD luvsl(0 2xrxr ny4lpenmfes t) rurxm ou4aexn fciytlmDem(mo u0aexnmf oatlm raueolt0texoio oodaptemfvta(faDua(  ;t0texo ictyt m rln p (4aeerio totfmDeaues s t2umimpiu4lptnmivias a2taum oo4tlx iocildfa ea(msnt)trerxrcio1lpDranvs;( sruoxm oydal elnesasf rrmumpnt4olenmf3tltfaDem( s;t0alenmr3ty1laDe uei t srum(o no1lmee icsl()sDrax  oo4apt io3iat m2ul( s t0areoio3io1lpDeauei;s  2to(r iy1lpte ici s a2umxm no0aex ifcilt sDea(mont)tetnxr iydlaDeln ol( tetoim no1apen fcs (farrrx oou4altomo3iytlaDum( o;t4 lxoxoctydfp r u s ()t2xm(mpiu4ameelfesat aDtruroou4ape iociytlm2ua( p;t4altnxo3ta1lpDe ieo;(0srtoio no4lltelfeia(fs2trxmooo4tetoii3iat m eanvs;(4texnmocoodom  anei ()t2urxrpio4op nmicia(fsruaxm nu1olt mo3ildfs em(vpn(4aetrif3oo1oatrauvi;(0 eumiopny4omtn feia() Drmumo;u4optomieiytla2ul( o;u)arxnmo3to1laD  u ils texr(m oodolteliesls sDur(m oo0olxn oeils aDem(vs;t0altnioctydlaD luvs;s0teum(o3oodal nlfetat) rurumooo4opxnio3tyd s2ulnmo;u4aexrif3iytfpD auvils) 2uoimpiu4ll n fvsa(  2uau  no0texnifctaslmDul(vpn() rtrmo io1lmD  nvolt)tetr(o3oo4am nmivtas)s2umu  ;t1apx moeiad a2emn snt4 lerio3oydlat livo t0 eum(o oudaltnmnvs ()srtaurp;t0aet  fetytfaDeauvp (0arenir3iodlpt ai il( trumio oy1lm  mivilsfarrrx  nt0opt iietyt m2ua(vs t0alxrir3oa1laD aiei;s s2xm(r3oy4al  mfci ()aDta(m nt4tpxo o3tadls2ean snt)teenmoctytfp rauei;( s2tm(o3iu4am   neils) 2ur(r no0tle ifetatfm uanvsnu0 ltnifciodopt auei s)teur(mpiy4opte nesa(  Dua(r ;o0opx if3tlt s2rmu pnt4alxrxr3oa1la   nvols)trumim iodop e nvsls sDrr( o;o4oexnif3ildfm eluvp;u) ltoxo ootlmtrlieol()trxr(m no4ll  lfci tfa2trxroou4teenio3iyd a2rl(ms;u0 etnxr3ta1lp eai o s srtmxr3iy1alee iciasf Drrum ;t1aet  o3tyd s2rl(msn(4trxoxfcoo1fpt lu s s) etoiopoy1omtnmiesasfaDtmx p;o1oleoiictadlm2rmnmsn()treoifciodfmD  ivo ()teuo(m3oudlltnmncsl(  Draxr ot1opxnmoeiltlmDeln pn(4aexoxrctotoaDean i s trxm(o3oydam   ivias)aDtr(mpnt0oexn oetadfa2um( o;()aetnif iatlmtraiesls)trumxo3iudamt lnvs t s2rax onu0ole  oeiytfmDrm(vs;()trtrir3totomDr nvo ()truoxopoudamee fvias arum(mooo1oetoii3iatlsDulums;u0 rxrxo ty1la  au s (0 2umxo3nudlptelfct (farumx o;u1oexomietadfsDeauvo;u4 lxnxo3tytfat li i;s)srxmxo3nudap e ici ()sDumu pno0opeoiietydfmDelu on(0trtrir totlaDr u ils0seto(m3iodaptn nvsl()a2tmur oo4alxnmociydfs rlumont) eerxo oydfa  lnvs;t)setrxo3io1opteliei t srum(r ou1alxnioctaslaDranmo;t)texoif oydfm eai i (0t2tmxm iodapenlietlt)a2rmurpno4teenifeiydlaDelnmp;u) exrxrcoatom eaneo ( trto(opoodlp n nesl( aDta(  oo0tex iocilt s rl( s t0altomocty1fmtr nvslt0 rxoxr iu1am  mfvta() Dtax ono0aexomf3iltfs uanvs;u0alxnxo totoaDranvi t sexrio3iu1lmtnlfeta( aDrr( o;u0olen iciysla2uaums;u0tlxrxr todlmDr i s;(0t2toxm3no4omenmfvils)a2umxmpoo4tlx moetydfsDrluvo u)tlxoxo oydfat lnvo;s)sexrxm3io1llenmfviltf rurumont1alenioeiyd m uau p;t) exoif iytom  ai s;s0seurio3oy1lmte ietatf Dta(m ot4tlxnmf3tltfa2em(vs u4 rtnmrcoatlptr nei;(0 rtrirpiudaltemnctlt) 2rr(m ;u0tetoif3ias aDemu p (4trxoxr3tytomDeluesls)texmxm3oydopee ics s  rtr(  ot0apenioeias m2rluvo t0aeerir3oa1lm rlivs;s0s2trim io1ol   fet t)s2tr( o;o0aeen i3tatfaDemn p;(4 etnxfcty1la rau ol() rum(r3nu4amenlivtl()arrrur no1aeen o3tatfa2el(vp t0 leomo3totlat au sls0 rxoim3iodame mivi t)sDurxmo;u0teto octys mDumn p;(4 lxnxr iodfa  ln i;s) exmiopiodaptn fciat sDtau  ;t0opt  ictldlsDumuvp t)aexoxocia1lptelu o;s  euoim3oodap e iei sfa2tau pou4alx mocilsfs emuvp t0 rtomf oadomt luesl(0 2xrim ny1aleemfcs s srtmumpnu4aexn ietlt m2rmnvo;(0trermr totlp  aieol() rtrio oy4olenmncsa()aDrauro;o1optn i3iltfa uluvo t0 lxnxfcta1fm   ieo;s0t2ur(opoy4om e ivilsf rtmxm no4olxnif3iys aDra(vsnt4 rxrmfciotfpDelu ol(0trtrxr3ou1amtn fes sfarua(  ;o4aptnmfeiysls2rlnmo;u0arenif3io1lp   i i;t srurio no4lm elfvi ()a2umxmono4oleomoetaslm ua(vont0tltrmo oadlmD  ieils0 euoir oodope lnvia(farur( ono0apx  fciaslsDum(mp;(4aexnxf3ta1omtrau s;t0trtmxrpoudop  miet sf 2um(rpoo4tlx  o3tydfm ul(vont0 lxomf3ta1fm e ivs (0s2to(m no4amt  nvslsfaDtax pno1oee ifetad m2em(msnu0aexrxo3oy1fm  ai i;t  exrir3iudolee fciatfa2tru p;u4apt iieiysfsDulnmon(0tetrxr3oadfmDr i ilt t2tmxo oy4om nmnetatfsrtmx poo0olx  oetydlmDrm(mo (0 reomoctatlmDeluvi;() rto(r3no4ap  mnci (f rra(mpnt1oltoifeiltfa2em( s t)teenif3oytfp r ivs s srtr(r3iodlpe miet t) 2umur ;o1tpto ocildfmDem(vpnu4arxoio3oa1fptelnei t0setmir iodllt lfeias)srua(mp;u1texnmo3iys m2ulnms u4 ltrxo3oatfpt anvo;()truoxr3oodlltelfvtls)aDrru pnu1aptnmfeildlm2rl(vpnt4 rxomociydlpteaivsls0t2urxr no1omeelnvi (fsrurur ;t4tlxo ieiytlm emnmp;u)aexnir3to1la e nvo;t0 2xm(opio1op nmfct sfs2taum nu1tlx ioctyt m2ea(mo u4trxnxf3iytlaDrai ol( trxr(rpny4olee fct sfa2rr(mo;u0aeto i3ildfs2rlump u4altrmfcoadfaDe ueil() rxo(mpno4am elfvsat arraxmont1tex iociaslm elu snu) ltnxo3ty1fp eaivs s tetrxmpny1ape lnviatf 2ururo;o4aptomo3iyd s uan p (4 lenmf oydfptrln ol(0tetmxopiydlme mfvil( srraum nu1tle iieiytfa2eanvp t0aeenxr3oa1laD  ivo (0tetrirpoo1apen netat)s2tmx  nt0tpx mfctysfm2rlu o t)arxrir to1fmt  ivi;t tetriopio1lp nlfeslsfaDrmxrpou1aeeo feiydfs2uanms (0tlxnxfctadom  lnei s0srurio3iodome mictas aDra(mo;u1tlt  f3iyd sDelump u) rxnif3tytop  ln o;(0s2umirpnu1oltnlfei s) rtmum nu0oetnmo3iad mDrauvsn(0tltrmfcia1fpteauvi;s0srxoxm3oo4lltemfeilsfsDtaxroou1aptnifeiytfa umump;u) etrxrctodlaDeai o t)t2to(r nodlpteliet (faDrrxrpnt4aetoio3iatla eluvpnu4altomrctotfmDe ieils0 2xrxo iu4omenmnct (fartr( o;u4tex mo3iltla umnms;t4tltoxf oy1fate i o;s)t2umir nu1lltemicia(  Dtmu  ;t4opeoifctadlmDelumsnu)trtrxfcootlaDraieo;s)s2tmim iydoptemietat)sDta(r ;o0ape  i3iaslaDrmump (4 rxoxr3todla  lnvi;s0t2xr(o3iu4lltnlfei (f Dururpoo0aexn o3tlt a rmn onu) etoxr3tytlpD liei t0 rurxm3oodamenmivi t)arurum nt0alxo oetyd aDra( sn(0trxomfcoytoatraivo ()trumxmpio4amee ivt s sDraxmono0optoio3iaslm2rau o t4arxomr3to1lp e uvi s)trtr(mpiu1alee ivtlt  Dtaurpnu1opxoifetyt m ua( p;(4 ltrxo oytfpt  ieol( s2urxo io1lltnmncil() 2raumoou4teen iciadfsDrl(vsnt4 leoxocoydopte ivsl()trxm(m oudap nmfctls srrmx p;o4aexoiocils a el(vp;() lerio3oo1om ean i;( srtrio3nodlpeelies ( aDta( poo1tlt ifciasfa2um(ms (4altomr3tatfa eanvslt0 2xoxm3oudol  mfeiasfa2tmu poo4oex moctadlsDumuvo u4 rtnir oadfmDe iei s seurxr3iodlmtnlicslsfs2rmumont0apxo ieias sDulnmonu4 exrmo iy1fmt  iei ()setoim nu4altnmfetat arrmxr ou4aeeo f3iadls rlu snu4 ltrmfcia1lptean slt) euo(m3nodlpe  nviatfaDrrxr oo0tpx ioetas s uaumpnt4 leoxociatfp e n sl()srumimpoudlleemneil( aDuaxr ;u4tpxn ieiydfs2eluvo;u)tlxrif3tytom r u ilt  2tr(o iy4lpenlncta()s2tr(ront4aptnmfciys s2ua(vo;(0 reoio3ia1omD aieolt0texr(m oo4ameelfetlsfsDtmxm ;t0oeenii3ildfaDul(mont)arxnircoadomtelnvi;( t2uoxmpio1lp elfeta( s2taxmpot1aleo f3ildfa2ra(mp;u4artomocoy1om eau o s)tetmxm3no1al nmfetlsfsDuru p;u0oeeo fciltlm2rmuvo;(0 rtrif tytfptelu i () etrxr3io4om n fvt t)arrmxrpou0optn o3iydla ua(msn(0alxoir oytlm raueo;t setrxo oo4ameemiviat  2tmumpnu1tpxnii3taslm2eln s;u0tltrir todfmD luvs;t srumirpiydlptnlnct () rtrx o;t1tltoif3iydfaDean onu4 ltrir oydopDrau s;(0t2urio ny1lm nlieta(  Dur( o;t1oetnifciltfmDuanmp;(4treoir3oydlpt  uvs;t0texrxmpno4alenlnvi t aDta(rpou4tle mieiatlaDra(vsnu0aexrxf3oydopte n il( t2xrxo3nu4lptelnct s s2umxr ;t4ape mfetld a2uan onu0teeoir3tytlmD  ivi t0s2tr(mpnu1lpt lnvias) 2uax pnt4tptnmo3tydfmDum( o;u)tlxoif oo1oa r ivo;( srtr(opnodoptelici (fartmurono4aex iieiadlmDrlums;u4aetomf3tatlp eanvo;( t2uo(o no4ll  lnvi tf rrmx onu1tex  fctydfmDrmums;u4treoif ty1lm rai i;s) rum(o oydolee fvia(fs2tr(root0apxn fcilsfmDem(msn() rtnxo oadlpDranes s)seum(m ny1alenlnvi () Drr(mo;t0opxnmoeiyslmDeln pnu0artoif3iy1fp  li s t0sexrxm3no1alee ictltf 2ua(r ot1ale ioctysl
\ No newline at end of file
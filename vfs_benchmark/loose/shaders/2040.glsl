@@ -0,0 +1 @@
+i ilt)s2xrxr3io1lme mfes t) Dtr(r ;u1teenmieias s2ua(vsnt)aetoircoo1oa rau o s)trtm(m3io1apt  ici s  2tr(mpou4aexnio3iad a2ean o;t) rtnmoctodlmDr uei;( tetm(o io1omenlfeias)aDrmx onu0tlxoifeiad aDel(msn(0arxoir3iadlmtrlieils seum(m3iu1lmt livt s) Dra(m oo4aex iieiad s2eau p;u0trtomfctydfa rlueilt)srto(m ou4al elfes s s2rmumpou4texoiociadls2rmnvont)tlxoxr oa1lmt anvi;t) 2urirpnu1altn netl( srtrur nt1aptn ocias a2eauvp t4 rxnir3iatlpt aivs;(0t2trir3iu4lle lictas)artau o;u1tlt mfciatfaDua( s;t0trenmr3oodopDr ivi;t  rurxo3oudlp  lfvi tf 2trxmpoo1oeto iciyd m rmnms;t4aetrmrciodfptr nvo;t)seuo(m3iu1ap  mfvtas)srrmumpoo1tpto f3tasfs ua(mp u) etomr3ta1lmtrlu slt t2ur(rpnu1ope lfvsatf Dta(  no1tlenmf3tlslmDrlu s u0 reomr3tadop rlnei () euo(m nodol nmfci s  2rrurpnu0tpenioeilt s2uln o ()arenmo io1fmt anvo;s) 2ur(r iydaleemnesat artru ont4tee ii3tls s elums u0 renifciydlaDran i t texmir nudomee ivt s s2ta(mp;u1tpx mictad a2uaumo;t) rtomo todoaDe nvo;t srxm(rpny1ameemfct ()arrr(mpnt1alxniociadlm rmn s;t0 exnmr ootfmt anvil(  rto(r3no1al e fvs sfsrtmur ot0apeo oeiadfsDrau pn(0treomr oytfm  lneolt)trtrxr io1lltnmicta( arraxmono4opt  o3iydlsDulnvonu4 eenmo3tytlat auvsl(0 etrio oo4lptnmfcil(  Dtm(ronu0apxomictas aDulnvp ()trxomfcty1fatelu i;() 2xm(mpnu1omenlnetatfsDtrum ;t4tpto fctydfa umuvo u0tetoif3oodop eli o;s s2tmxmpoudlltnlnvtatfsrraumooo0ape  fciltls uan sn(0 rtnmfctydoa rlnes ( trtr(r3no1lmt mneias)srtmum nt0tlto oetlt sDra(vp;t0 rtomr3iy1lp rauvo t0srxrir3iu4amee ivsatfaDurxronu4alen fctysfs emums;t)areriociodoaDean o t seurxrpiu1lmte netl()sDua(m nt0tltnmoeias m elnvo (0 eermo3iodfmDeln i ()truoimpoodamenlicsa(farumxrpno4opeo fctat a ean o (4tltnio oa1laDeanes t0trxoir3iy4ol  mneilsfsDur(rp;u1texnmi3iasfa2ranmp;t4 lxnmr3iydoaD aiei;s  exrir nydamtnmnci (  rrau  no1aeeo octydfm rl(vp u4 rxnio iytomt  neo (0srumxo oodapte nvtl(fs2ua(moou1tlx mo3iasfmDua(mo;(4aetomf3oatfa   uvolt)tetmir iy1omtemnvtasfa2ta(  ou4oleomfcildlsDrl(mp;(4aeenmr oy1fatrai sl(0 2ur(o3oo4optnlncs t srtmu ono4ole mfeiytla2rl( p;(4 eenxrctytfaD lnvol( sexoim3iydapeemfeils)artmx o;o4apxomfcils m2rl(vonu0alenio3to1fatrlueols) eumxr3oy4apte fvil(fsDtr( pno1apxniociytfs2ul( o u4arenmrciatop rauvs s0srurxopoydap nlivsat s2raum oo4tpeniociadfaDea( s t)artoiociodoat an o (0trxrxr iu4lpt  ietl( s2uaxmpno1tlxn i3tatfs eaumo t4aetrifcootfa r n ilt0t2urio3no1ol nlncil()sDum(mono0alenmfcildfs eln o (0teeoxr3tydoa rai o s)teuoir nu1olt  net sfarraxr ou1teenmfeiyt s2ul(vp;(4 eenxocoydfa elueols)tetrxo iodam  lfvi ( a2ra(r ;u0tetomfciltfs2rm(vo;()teeomo3tytlpD lu i t0seuo(r3ou1omeelnctasfsDumxro;t4tltnifcilsls uau pnu4 etnio oytopteaueo t0t2urio3io4op n nct t)aDrr(r ou0aeen fcilsfaDeln o;u4 etomf3oatlp r neilt  2xoxmpoo1lme  ictat)aDrrxmont1alxn i3iadfm2rlnvo u)altrxr iotfp   uvs;t) exm(mpiu4om  mfvil(fsrumx p;o4aleo oeiys s2elnvpnu4aeenmr3iy1omDelneil(  2to(r3oy1opeelnet sfartrx  ;u0tetoiociatlsDrlnmo;(0 exoiocoo1om rli i s  rtr(m ou4aptnmfcslt  2rm(rooo4alx moeilslm emnms;u4 rerxfcootlatrai il(0tetrxopno1optnmnvt t) 2rrxrpot1oetomi3iysfs rmuvsnu0aetoxr totfmtr uvs;t0 2xrxr3oydole lnei sfsrumumo;t1tlx mfcildlmDuluvs t0 rxoio oatfp r ieo;s sexoir oo4omte fesat)srumumpnu4altnifetysfa2um(vs u4 lxniocoy1la eau i t texr(r io1lle mnvtlt  rrrx p;u0opeoif3ildlsDumnvpnt4 reoifcoadfaDrli o;(0seuoxrpiydlltemfei t s2rr(rpot0alto i3iatlmDeanvo t0texnif oydomtrln s;s teuoxo3iy4altelfeia(fa2ur( p;t4tlxomfeiasfa uauvo;(0 ltnmo3oa1fpD lies s setoxo oydome mfcs t)sDra(mp;t1apxn octlsfs2ulu p t4 ltrir oo1fmteanvo (0sexoim iudom   fcsltfsDtrxmo;t4aeeomf3iaslaDranmo t)tltoxrcootfaDrlieolt0 eum(o3nodalen fvt s aDrm( o;o1tlxn fcild s umums;u)teenxo3iodlaDeauei (0 etoxr3iodlp emfvi s srtax p;o0tetn f3tytlm2el(msnt4arxoif3iodfa  an i s) rtoxr3ny1llee fvtl(  Dta(mpou4tex ifeiydlm2rlnvo;(4aleomociytoatr n slt)texm(o3nu4olenlieilt  Dtaxr no4tlt mietys a2eln s (0tltomf iadlpt  ivs;t)t2tmio iu4altn nctas sDrm(rono4tleo feiyt m eanmp;u4 lxoir ootlp e uei;( s2urir no1al  miviasfsDra(r ;t4ope if3tadla2uau snt)artrifctodlptrau s t  2xrim3oydlp nmfeias)a2tmuroot4ope  i3tatlmDumuvp;u0aeermr3oa1fm r u o t0seurxm iodaltnlfvtltfs2trxrpou0tpxn f3ilt s2ul(mon() lxoxr3iadlateanvi;s setr(mpoudam elicta(fsDraurpno0oee miciasfm2um( s u4 eenirciytla eanvsls0srur(m3oodlltnlictlsf 2rr(mpnt0aeenmoetadla eauvs ()texomo iadoptr nvo t) rurimpoo4op emfcta(fs2rmxrpot1open fciatla rl(vp;(0texnxf oodoa e iei;t seurxmpou1apen nei ()s2urumonu1aee mf3iydlm2el(vsnt0 rxrmr io1oa r nvs t t2tmio3oudam nlfetl() rraurpot4oexn oeiyd m2em( pnu4trenif3iadfm   ivslt trxo(mpny1amt licil() Duaxm ;u4opx ioeilt a umuvp;t4aeenxf iy1fat  nvi s tetr(r iu4am  micia() rtax  ou0oltnifcilsla el(msnt0tltriocootoa rlnvslt)trxmxrpio4ll   ictat srur( oot4oltoifeildlm rl(vpnu4trtrif3tadfpt livs s0 rtm(o no4alt mivilsfaDur(r no0olxomfctlt s emump;() renmrcia1faDr uvi;t0 2tmiopiodop  lfvtlsf rra( ont0tpe  iciytlsDum(vo (4tlxnmf3tydomte ueol() euo(rpoodol e feslsf Drau p;o1aetnmo3ilsfs eauvsnt0 rtrmocoydomD  ivs;t) 2xm(rpoo4oltnlieslt  rrm( ooo4alxnioetlt mDua(vs;()tlenmrctytlmte ieo;s)s2uoir3io4alen fvtlt s2rmumooo4aetoiicilt a rl( p;()aetnxo oodoptr n o;(  2xrxr3iy4lp   feia()arum( oot0oex  f3iadfs rmn o;u4trxomo tytlmD  ivsl()t2umxr3io1op   nci sf Drr(r ot4aeeoiieildla eln ont0 lenio oatfpDeanvo;s srxrimpou1amt  ictat) Drm(r ;t0texoioctatfsDeauvsn(0 lenirciy1fm  luvslt0 2xr(m3iy1oltelfei t  2tmxr nt4tpxo fciadls2umnvpnu)trtnio tatop rai sl(0sruo(o3oudomtnmnctl()s2ur(mp;t4aetnii3tydls2ua( s (4tltnir io1la  lneo;( tetoiopio4om nlncslt)srra(m ;t0tpx mfciyt m ea(vont4aeeomo tatlmDe ivols)truoim3oo4alee nvsls)aDtmu  ou0alxn i3tatfm ul(ms (4arxomrctatlateaies s)t2trim3ny1lltelivt t a2ra(m nt4tee ifcild m ul( s;t) eeoxfctatfmDeaivilt0trxr(m3io1apenmicil(f 2urx  nu4tetnmiciltlaDuanmon(4 etoir3iydoat li ols)s2umxrpny1lptnmnvsa(faDtax  nu4altn fctadfm2umnmo;() exomo oytfp e uvo;s)s2tmxr oy4op emnvsltf Durxmpno0tetoifcils a rmuvs u4trxoio3oa1om  lieolt)tetmir io4ope mivs ( aDurxmooo4tet ioeias m2el(vp;t0 renifciodfmte u ils t2xrio ny4ol  livi () Dururp;t0apeomfciadfs em(vo;(4aetrxo oydfmDrlnvs;s0 rxrimpiy1llen icils)srumumpot0alxo feiys m2eanvo;t0trxnif3tydfmtrliei (0 eto(r3oodalt  nct t)srua(rpnt4olto f3ilsfm ulums;t0altnmf oa1fat aivo;t)texrir ny4alt  nviatfs2raxrpot1apxo fctldfaDrl( s;u0 exrmrciy1lptrlivilt0s2uoir3oo4lm emneslsfsDumu p;u4apxn i3iltfaDrm(vs;(4 leomr totoat an s t0 rxmxr nu4lmen ictls sDuau ono1tltoiiciytlmDra(mpnu)aexoxociytomD  u s () rur(m iodomtnmfeta(  2rmxroot4aet ii3tlsfsDrl(vo;u)texoir3ty1opt aivs t0s2tmxrpou1olt livt t) rtmuroot4tpenii3iytlm ra( o;(0 eeoiocio1fp rlnes;t s2toxrpno4ope  icsa()aDtmuro;u1opxomoeiaslm2um( onu0alxrxrciadlatelivols teumirpnydlpt mies tfartrxr ;t4texomfetldlmDrmnms u4arxnxr oatlpDeluvs t0sexmio oo1aleemivsat)aDrrx p;o0olx mieiltfa ua(mpnt0 rxoio ootfmDr n ils0 rumxrpiu1om nlfctat a2ururpno1oexoifctyd s2rm( p ()tlenio oydlm  lieols0trxrxmpio1al   ivsl( sDumurpot0aexnifciasls2ra( o;(0 lxnio3ta1lpDr nes s  2trir nudap   ivsl( aDtmxmpot4olxo ieiyd s umnmpnt)altomociodlm   nes;t)srxo(mpnodaptemiet (  2tm(m ot0texnmoetltfs2ul(vs t) rtnmr iatoatr ivsl(0tetoiopou4lp n fct t)aDuau ono1tlt moeilsls2rlump u)trtrmo io1fm rau s t0 exrimpiu4oltelict s) 2rmu  ot4aet io3ildlm rluvs (4 exnirciatoaDr nvo;s) rtrxm oy1lmtelietls  Durumonu1tetn feildfaDumuvo;(0teermr ootlptean o (0seumxrpoudlmen fciat)a2tm( o;t1aptn ieiltls2eln s u0arxnmf oytop   ivi;t)seuoim3no1ale  fvi s a2umumono0teto iciytfs um(mp;u4 etrif3tadfptrlnvolt)s2uoxr3no4lp emnetlt srrru o;o4olt mf3iyt s2eauvs;t)arerxfciydlptelueil(0 rumir no1ol elfeslt arrm(ro;o4aexnmietlsfm2emuvo u) exnmfcoytfaDr neo s  eurir3io4olenmfesas)a2urx o;t1opxnmieiltfaDra(mo;t0trxnir iytla eaivil(0 2tmxo3nu4lpen nvtl(farumxmpot1altomfeiytla2eauvs u4aeeoircoy1fatr uvs;t)trurxm ou4om   ivi ()sDuaxm no1tpt  f3iadfaDem(vo;t0teerxr oy1fp r uvs;(0 etmim iodlltemfei t)arur(mpnt0tpxn o3tyd aDumuvp;t4tlxnxo tatlmteli s;s)seuoxo iy4lmenmncsls sruaurp;t0apx  oeilt aDrlnvsnu)altrxf3ty1lmDrauvo t trxrxr iudol e feia(fa2rr( pnt1tlt  ieiytlm rl( pn() eeomrciodomte nesls0setoirpoy4ap emnes sf 2ra(mp;o4apx ii3ilslm um(mpnu0altoif ootom  lnvi;s)trtm(o3ny1al nlfvta()aDra( oou0tpen o3iaslaDumu o;u)teerif oadoat li ols)trtm(r io1amt mfesat s2umxr nu4tlx ioetydfmDrluvs;u4artomfcoadfm ran olt)s2xrxo3nudlpeelncsas arum(  no1apx mfctldla2elu o;t4 eeoio iodopt an s;s  2xoxr3iu1lltnlnvtas sDuaur no4oltomfeiyt m2rl(ms t)altnir tytfmD  ueo t t2ur(opoudop  micilt)srrru p;o0apen ocilsls rmn s u4 rxrmf todfp eluvs (0texmim oy1amtelicils a2uau pnt0oee  i3ilsfs2ran onu4 etrir3oa1fptrlueo;t  exmxm3oy4lm  miesas  Draumoot4opxoifctyslsDumnmpnt)tetrio3oodlpDeli i;s trtrxm ny1apt mnci ( sDumx poo1olt  oetltlsDrlnvp u0tetnir3ta1la elueo t t2xoimpiy4lmen fei tfsDuaur ;t0tlt  iciydlmDea(mon()tlenxf3ty1lm   uvi;()setrxrpno1opt  fvtat  Draxm ot1aeeo i3iyd a em( p;t4tetomrcia1lpD li sls srxoxrpiudal e ics t  ruru pnt0optnifeilsfa eau s ()arxnmf tadfaDr u s ( trurxr oo4lm elici (fs2rr(mono0apx  ictatlmDrlnvs;(0tltoxr oydoa e ieo;s s2tr(m3iudop   iet (f 2ua(m nt4tpxomfetld a2ea(vp;u0artnmo oatfaD aiesls0t2tmio3no4ol   fctlt aDtr( p;o1olxn i3iadlsDumumpnt4 lxrio3io1fp   i ol( teur(r3iodaltn iesa(farrmxr ;u0olt io3tlsfmDemnmo u)trenxfctydla  lieols0t2umir3oy4omtemieil()aDraxmpnt0tltoioeiys m eluvpnt) rxomr io1optr nesls)sexr(r oydalenlivta()arua(m ot1tpeo o3iatlmDelnmsn(0 lxnxfcia1lpDe ies;(  rtrio3nydlmtn fcsl(f Dum(ront4opxnmiciasla2ul(msnt4tlxoir ootomt au o;t)t2xrimpoydllte nesatfsrumu  no4tee mfcildfaDea( p t4 etnxr3tydfat lnvo s srtmim oydap   fvil(faDtmum ot1ope  o3tlsfmDel(vs t)tlxrmr3iadlpDe uvs;s t2xoxo ny4lpt mfvil()srta(ro;u1olxo feiytlm eanvsnt4alerifcoo1fa elivs t) exr(rpoy1am elfct ( sDtm(r ot1opeo ictat m ra(vp u)tlxrmocoo1omte ieo;s)s2urxr iydllte icsl() 2ua(mp;o1olxnmfeiadlaDeanvpnt)artoir3oodlm e u i;( trtmxrpnudape mivt sf Drrx  ot4aexoifeiyt m2ulnvont0aeerxr3iytopt li s ( s2xrxo oydolee fcs ( a2umumoou4oexo o3tadlmDrm( sn(0tlenmf totlp r nvsls sexoxr3io1apt lnvia()sDra(  no1oetomo3tldls2rl(mo;(4tleoxocio1omDe n i ( t2uo(m iy1lmeelnes ( artrxrpno1aptoioetat a rm( o t0artrmr3tydla r i i;s) exrxo3oydopt  net s srrrxmoot0oltn i3iytlm2um(mp ()tltoxo tadfp  liesls)sexmirpio1opt  fcias srra( oot4oleo oeiyt m umump (0trenmo3oadlatr ieo;t)sexrxm iodllenlfvt s a2rrx  ot1tptoioetadlaDrmnvont)tetrio3iotlpt aivs t)trxrim iudlpe mfcs (fs2urx  nt0apxo ieiatfsDrm(ms;t4 eeomr iatfmtran sls)texo(opiu1omtnmiei sfsDtmxm ;o4tet iieiadfm2umuvsnu0aexnxf3ootopte i s;s srtoio nodaptnmfvs t) Drrxr no1openifciatls2rlnvs;u4 exrxo totom  liei t  2um(rpny4om n fcias srrauront1ope moctldlmDrmuvs;u0 reoifcta1lp ranes s0 ruo(m3oo4om e netl( a2uax o;o4tet mo3iadfs2ean o;(4 eermocio1laDe u ols teuoio3iodllee ietls) Dtru pou0aleoioeiat a emnmp;u)tltnxrcootlmD auvslt)t2trim3iu1op elnei ( aDtmurpou0tle  o3iyt sDrau snu4aetomocoydlate nvo;() 2urxm ou1ame  iciatfs2tmxm ;o4aexn ictydfa rlums;(4 reoxocoy1fateai s t)texoim3oudam elncslt)s2tru pno0apxn fciytlaDrl(vo;t4alenmo ootfm  lnvs;s) etmiopny4llt  feil(f Dra( poo0apxoif3tatls2el( s;()aetnmr iydlm eauvslt0 euoxm oy4lmeemnesas)a2ur(m ou1ole ioctydla2raump;t0texomrctotlat  i slt t2umxr ou1om n ivs s  2rrurpnt1oetnif3iyt a2ulu pnt0trxrxocoodlptranvolt)seumimpnudlmeelnvsa(f rurx pno0oetoiieiydlsDem(mp;t)aetoif3to1fateln sl()s2xmir3nudlle mncslsf rururono0aex mi3taslm2ra(monu0 renmf oytlaDr uvo;t seuoir3iy4olt  fesa()aDra(mpno1tet  ociasls rlu s u4 eeomf3oodomDeanes;t s2umir no1lm emics t  rrmurp;u4apx  i3iys m elnvs;() eerif3oodop  aueols s2xmxo no1lp nlnvtasfsDur(moot1aee  ociyt aDeanmpn()texrif todfmt ai o;t0t2xoxrpny1omt livsas  Dtmxm ;t1oex  ieiad m2el( p;t0trxnif ty1fmt ai s;( s2tmxr no1llt mict t  2ra( o;u1ale if3tytlm um( o;t)trtoircoo1lm eai i s s2umxm oo1ap   ieias aDra(mpno0oee mfciydfa2ean o;(4trxniocoodop e uvs ()seur(opoy1lmte ict ( srurx  no0oeeoioeildfsDem(vs t)tetomo3tydoateanvo s0s2tmxopou1om n icilt srtru poo0ope mi3tad s2ul( o;() lenmf oadlaD  uei;s0t2xm(o3nu4alte icsls)s2taumo;u0tpe ioctyt m rm(monu4tleomfcoytoa eluvs t0 euo(opiy4llt lfvi t sDta( oou1olxn oetlsfa um( o u4 lxomf iy1oatr i ils0s2umxr3nu4amte fctltfaDum(rpnt4aeeomfeiad aDrauvpnu4arxrmr tydfmD lnvil()srxrimpnodopeelfcsas) Dtru p;t1aptn o3iydfm2ea( onu0aeenmo3iadom r neo;t) rtmio3ny4op n ieiat)s2rr(roou0opxo i3tad m eau s (0trermocoydlaDelnei;( setoxm3oy4aleelnetlt) Drmurp;o4tltn ieiyslm2ulnmo u)artrircoy1fmtraueils t2tm(o3oodale mfctat)artrxm ot1aeenifeiydls rlu onu4aleoxocio1la rlu o;( trxmxo3nu4olt mieslt  Duaum ot1tpxoifetadfm rau p;(0 rermr3ta1fm elnvi;s trxo(mpiudole  feiat sDrrx ono4tlx mo3iasfa2umnmsnu4tltrxo iodoaDr ieo;(0 exrio3io1al elfvtls  Dum(m nu1apx ioeiatlm ulnvp t4 rtrircoydlm  lues (  exo(r oydalee nvslsfaDrrx ooo1oexn ieias m el(ms;u0trxomr iodopD ai o t0 2uo(o ou1lme mfvta(faDtr(r ot1oex ioeiatfsDrlu p t)tlenio3tatopte i s;()srto(o io1omeelnvi t) Drm( o;t0alxo ocilt m ulnvp u)arenmr3iytfat  ies (  euriopoodlp  lies t a2rmxm nt4aexn o3iadla emnmo (4treoif ootlm rln i;s  euoxmpou1amt  ics ()sDum(mpnt1tltnioetysfaDum(mont4 eeoif tadopteai o;s srxr(r nudlm e nvs tfaDur(rooo0aeen oeilt sDuluvs t) ltnxrctytomDr uei;(0trumirpnodol  liciltf Dtrxm nu0alxomi3ilt a2rl(mp u)arxnxocoa1latrli ol()tetr(r oo4amee fei ( aruauro;u4tlx  o3iyt s2umnvs;u4 etrmfcoydlpDelueo () 2tm(o3iu1lleeliciatfsDra(  oo1tle mf3iydfa um(vp t4trerxr ty1faD ai i;t) 2xoirpny4lpe  net (f Dtmx  nt4tlt  fciyt mDulnvs;t0alxomrciadom raueo s)texoim nodoptnlncs s  ruau  ot1tleo ieiasfs rm(vs;(0trxnmocto1oa r nei s) rtmxmpoydom emfcia( arraxmpnu4aexnmi3iaslaDranvo t0trxomo oa1fmt  ivslt0srxoirpio1ole  ncs sfs2tax poo4aeen feiyd mDuluvonu)artomrciadopDr n s t0setmxr nu1lm emfciltf rtmxr nu0tpto i3tldfs2elums u0 eeoxrcoodfpt livi;t)setrir3iydlmtnlnvt t s2ta( ono1apeoiociaslsDul(msn(4 rermf iydopDe nvi t t2toio oodlmt lnctltfs2umur no1ope mfcias m2rl(ms t0tltrmoctytop   ivo (0teurim iy1optelfeiatf 2ra(  ;o1openmociltlsDea(vs;u)areoxf3ty1oatean ol() 2xrxr oy4ale mics t) 2rmxmo;t4oex mo3tltfs2rm(vp t) etoio3oy1om elu slt)sexoxopoo1lmee ncs t arrruro;o1opxoiietas s emn s u0tlxnxr3oodfat  u ils)seurxr3nodalt lfeil( sDrm(mp;u1alxo fciyslmDul(monu)artomr3oodoateaivols0seto(r no4ap  lnei t)s2tmxmpnt4aeeoioetldlm umnvpnt)tlxnxrcootlp rli ilt trtoir3iu4apt  nvt ()a2urx  ;u0opx ioetytfm em(mo;u4trxnmr3tadoptrlivo s  rtm(m nu1apee ieta(f Draumpot4tet ioeildfa2rlnvo;(0trxrmo3iadoaDeanvi;(  rxoxr3ou4ap  mfvs tfsDrm(rooo0aptnmoeiadlsDrm( on()arerif3ootla r i o t)teuoio3iodlmte nvia(  2tau  ou0oee moeiyt s2rm(monu4aleoif3iotlmDe iei;t  eumxrpiy4op nmfcsls)s2ua(  ;o4aex iictydfa rmnvpn(4alxrxfciydfpDrlieil()teuo(mpoy4amtnlneta(fsrur(m nu4tpxoiictysfa eau p;(4aetnif3iy1fp rln ilt s2tmxm oydom  lfvi (fa2ur(  ot0tpto ocilsfm ulu p;t4aeeoir iodlpt anvi s)srxrir3io1ol emfcslt)sDrr(  no1olen fetlslsDua( s;() rxnmr3oadfmtr uvo;( sruriopnydom emncsa(fsDtmur ;t0tetnioeiytfs2rlu s;t0 lxnif oy1opDrliei t0seuoim3oo4llt lncs (fa2umum ;t1tpt ifeiat mDeanmont) ltriocoatoa e uvols0sexoxo3ou4alenmncta(f rtaur nu1tet  ictldfa ranvs;u4aeenmo oy1omt auvilt teumxrpnudll emfeilt  2uaum ;o1tltn o3iys s2ranvpnt0 lenir3iodoaDr n o;t0trtmir iudomeelivtls  2tmx  ;t4ope  iciltfs2rm(vs;t0areriocto1om  an s t) eum(o oodlmte nvil( srumxmooo0oeeo ieiyslaDelums u) eeoifciodlmDr iei t)sexmxm3ou1om elnvtls) rtm(  no0oeeomfcilslm2rlu s ()alenio3iatoaDelnvs ()sexm(m3iydlmtnmfeta(f rrru pot1tptoioetyd m2ua(vo;t0 exrmf tatoaDe i o t0trtmxo no1lmen netls)artm(ront4alen oeiydls2ran pnu4tetrif3to1lpteanes () 2xrxmpny4am n icia(f 2ra(rp;t4oltn ociysfa2ulums u0 lermo3ia1la ran o;()s2um(m3iodlmtnmictlsfs2rr( pou0alxnmictytfsDeanmsn(0 ltnifcoydopt livs;( teumxrpoo1lptn fvilt)arrr(mpot1tpen ociasla2elu p (4aeeomf iotfpD lnvs;()t2uoim no1al elneta(f rra(rpot1aeeomo3tlsls2el(msnt)artnxf ia1opt  ivo s0t2to(rpnu1apeelies s  2tmxm ;t4tlt mf3tas m2em( snu0aetnmfcta1oaDeanvs () eumxrpnudaptemnet (  Durxm ou0olenmo3ildfm umnmpnu0altrmf3iodfpt au s ( s2tr(r iudlpeemfesa() Duau o;u0opeomieiltfm2um( o;t4arxrmf tydlmtrluvols teum(mpiy1omenmnvtatfsrtrurpoo0tet moeiydfm ra( on(4arermf iytlaDe u o s)truoim nudaptn ivia() Dtmum ou1opxomi3tydlaDemu o t0aeerir tytfa eliei t)t2uoir ou1lleelfesa( a2rr(m nu1apto f3iytls rauvs u0 rxoif3iotla e ueil(0 2xoir oo1lmee nvta()aDtrxm oo4opt  feiytlm ea(ms t)alxrmociadlm ran s t)tetmirpoodlp   iet tf 2uaum ou1apx  iciadlm2rl(mont0trxnifcoadoat  n o;(0s2uo(r3io1aleemncta(fs2tm(ro;t4aexo i3tadfs eluvsnt) etrirciotom e neo s0texmio iydoltnlfeiat s2tax ono0ale mieiydfa uan ont4 etomr3tytlat aivilt)teum(r iy4openmfeilt)s2rmu  no1oltoioetydlaDuluvo;t0 rxrirctodlmte uvi s0teuoxr iy1ol emnvta(faDum(roou1apxn oeilsfs2ul( o;u) exnxf ty1lmDrln il(0texmxopnu4amte fci s  rtmumoot4olt io3iysfm2em(mp t4texnmf3oadfaD lueo;(0s2uoir nu4ap e netasf Dtm(r oo1apt moeildfm2um(vs;(0texnmr3oy1fat aivo t trto(rpoo4llenlivsl() 2umurp;o1oee  feiatfaDrlumo ()aetoir ia1faDraivol(0teur(m3no1am nlfetasf Dra( o;o4tpxoioetlt sDra( s;t) rxrmocty1lmD ai ils0 exmxm3ou4op  mieta(f 2urxmpnt0opxomfeiltlm2ulnms (0tltrxo ia1lm e n ils0trtmimpnu1om e icil(  rtau oot4tpe  fctys mDel( o;t)tlxomr3to1lptraies (  exoxo3ou1ol n ivta( aDrmx  nu0tlen i3iatlm2rmnms ()tlxrxr3oytfa r ies;t t2ur(r3oudapt  fcilt) 2tmxmonu4tee ifctldls2ra(mp u)aeenif oydfaDrliei s0trto(m3nu1omtnmfcs s sDtmx o;o4apxn f3iyt s2emn on(4artomr3oydfa rli il()s2xm(m3no4ameemneils s2uau  ;u0alx mfeiydlm uan s;u0teenxrciydlat ln o t srtr(mpiu1lpte ncsltfsDtm(mp;u0altoiictls m2ea( o u4 rerxr iydla rai ils0seumxm3oodlmenmnet ( s2rr(moot1apen oeildfmDua(vo;u4aleoir3iotfp  an ol(0sexo(rpoydlltnmiei t srta(rpno4tlto iciytfa2eanvp u0altrir3oo1fp  lies s  rtrxo iydlltn nci t)sDtau ooo0tlt  f3tldlm2elu s u)aeenmrctydlpD luvs () rxrxo3iu4am elnetltfs2tm(mpnt0opxnmicilsfsDeanvsnt0aetrmo3oodfa  lnes;() 2umxo3iudlpe lfeilsfsrrr(rpoo0oleo ictyt aDeluvs;u0 eermr3iytla  an ol(0 2trirpiy4omt mfei ()arrmum nt0olxoif3iat m ul(mpn(0aeerxr totfp r ieols0teuoxr oudamtnmictlt) 2tr( p;t4openiietatfs2umnvs;(4alxrxr3iadlpt lu o;s0 eto(o io1ape mfvta() rua( onu4opt  ieild sDua( s u0treoircoadlp e nvs;s)teumxr3nydlp  miet (f Duaxro;o1tlt mi3iatfsDua(vonu0artrmoctodlatrau olt0 etmxopnydoltnlncilt s2urxmp;u0apeo i3tad mDra(vo;u4 rermf3ta1oa r iei;s0trumxo3oo1ol e ict ()a2raxmpoo0oeeo ictaslmDrmnvpn()trtnxociodlatran olt) 2umiopny1ope miei sfa2ra(rono1apxniociyd aDelnvonu4alxrxf io1oatr ivs;(  rxo(opoo1olenmnvt s s2umu poo1tet mf3ilslaDumnvs u)tlenmr totlpt li o;t0 2xmim3nudlmtnmietl()srtrurpnt0tlt if3tatfsDul(vsnu4alxoxrctydlp r n s;s0s2triopoy4lpee ivslt aDrr(  oo1oeenmoetasfaDum(vo u0tetrxr to1fa eaies t) rxoxmpny1open fvs ()aDrmumpno0oltoio3tydlaDuln snu)tltrmr3oytom   uvols srum(r3ou1lle  nci sfsDrmur nt1olenifeiysfm2umnvs (0tetnif iotfp r ivol()s2to(m oo1apenmncs tf Dtrx p;o4olt iocildfm ulumo (4tltoxfctatlm ranesls trxmxo3oy4ol   iesas) rrr(m ot4tlenioetat mDel( snt0 exoxo iy1fm   n s;(0s2tm(r3ny1om elicias s2rauro;o0altnio3tys a2ulu p;t0areoifcio1la rli i s)seum(o3ny1oltn ictlsfaDuaxr ou0alxoifeiasfm rm(ms t4tltomfcoodfmDranvols  ruriopoo4llenmneias  2uaxr ;t4teeomo3tatlm2elnvpnt0 rxnxoctotfptr iei ()sexoirpoudlme mfvils srurxrpoo1aleoifeiatfs rm( sn()tlxrmr3tydfate nvi;(0srtrxo3oudlp nlfeias)a2umx ooo1aexn i3ilsfm2ean o (4trtoifcoytlp r i o (0s2ur(mpoudamee fet s)srraum nu1opxomo3iltls2rl(mo;(0aetrmo3totlpDeai i;(0t2urir3nu4lpe mfetas  2rru pnu0tlt  fciltfmDem(msnu4tlxrmo3iy1omD lieil(0t2tmiopoy4lmtn fvs t srta(ro;o0tlxoioetat s2ea(vs;t4trxomr iadfa  anvsl(0teuoxopio4olt lfeslt)sDur(rooo1tex mociatfa2rluvonu4aexomr ootfaD  nvsl(0 etoxo3nu4al   ictlt) Draumpnu4alxomfetat s ulu s u0 etoif3iy1om e i i s)t2xo(r iydamtnlietlt)sDum( o;t4oetn oeiaslmDemnvp t)arxoxocootomt luvils s2uo(m oo4ome lnetlt) Draxm oo0texomfeiyd s ua(vp;u4 leomfcta1lat  i ol(0trxriopou1omenmfvtls a2uaumooo0alxn ietatla ul(vpnu0 exrmrcia1fmD  n s s)t2xr(m iy4amenmfci t)sDra(mono0tee mo3ildfaDrl( snu0 lerifcoa1lmD ai ols) 2xrxr iudolen nei tfaDrmxro;t4aeen fetytlm2elnmp t4tlxrxfcoydlaDeaivs ( s2to(r3io4omtelfcia(  Dua(rpnt1ole iieiatls2um( sn(0tetnxrctodfpte nvolt0 2tmxo3oodal e iesat)sDtru  ot4alt micildlm emuvpnu0tltnmocoa1optrlu i t)t2toim oo1amenmivtls)aDtm( o;t0olx if3ilt a2rmums (0teeomfctotfa e uvilt0srum(mpio4apenlfctlt)aDra(mp;o4optnifetydfaDelnvsnu0 eerio oydlp rlueol(  2trim3no4oleemfvt t)s2urumpno0aptomoctadfs2el(vpn(0areoxo to1fp r nei (  etr(opiudllen fvils)sDtru p;t4opeoioctlslsDemuvont) reriociodom r ivs;(  eto(m nudamt mncta() Dtax p;t0apxn oetydfaDeanmont) reomr iotfp   neolt teumxo3oy4lltelnvi () 2raumont0apxniociatfa eau o t0aeeomocoo1optelu o t0 2tmxr3iy4lpt  ieta()a2urxmp;u4optoioetls aDua(msn()areomf io1latelneols  rto(mpno4alt  ivi tfa2rrx pno4tpxoiiciytlm2raumo;(0aexoxo3tadom  aneilt0 rtr(opiydapen nvtl(  Dtm( pou4olto i3iys m uln sn(0aeenxo oadfpt lnei;( setm(r nudom nmncsatfarrmx  no4tpto feiydls raump t)tltrir3oadoa e neo;t s2umxo no4ll   nei sf rua( o;u1altomfeiasfsDrmu p (4artnifcia1oaDe neo;t0texrim nydlm  mivias)arumumo;u0tpt io3tldfm em(mp;(4 etrmr3tytopDeli o;s)seum(mpnudop nmnvs ( a2ra( o;u0oexoioctldla2umumont) ltrxocty1lmt lu ils)t2toio ny1opt  ics tfs2rau pou1tpt iieiys m uanmont0 rxrmo to1fp eaieol(0sruoim3ny4op nmfvsas)aDuaxrono1aptnmoeiatfs uluvs;t0aeenmo tatlp r uesls) rxmxm io4altnlivias)s2rmxm ;t4opto feilsla ra(vo t) etoxf3iadfmD lu s t)t2xoirpio1optn ivsl( artrx  oo0aetn ieiyd s2umums;t0tetniocoo1fmt lnvols  etr(o3oudolt mfeils  Dta(rono4ale mociasfaDeln onu0trtnmfciatlmDrauvo;t0seuoxmpoy4amee fvils s2tax pno0tpx iietld s emu pn(4 ltrmf3iatlpD lu ols0srumio oy4al elietl(fsDrrx o;u0olxnioctad sDeluvonu4 rxrirciy1opDr u o ()s2tm(m3ou1lmeemfetlsf 2umu o;u1alenmf3ild s2elnms;(0 reoxf iatoa  livo;s)trtmiopiy1amt  ieil( s2tmum nt4aetn fcilsla rl(vonu)tetnxo iy1fpDe ivsl( teumxm ny1lpeemiciat) 2rm(rpoo0alt  ieils mDelnmo u0aexrxoctatlm raueols0truo(rpou4lp nlfcsl(fa2taurooo4olxoifctadfs2rmnvs u4altnxo iy1om e nvi;t0seumir3no4olt lies t srua( oot4aet  feildfmDrmnms t4aleoio3iy1fpt aivo t0seuoxo3nodlm elnvil( sDumxroot0tlenifctyslaDrmnvpnt4areomf oadomt lu s;s  rxrio3nydom n fvil( a2ua(rpou0alx mf3tls m el(vo;t) lermo3oytlpDe ivo t)trumxmpio1lmtnmfetas)arta(ro;o4apxo feiatfaDemumont)trxoio3iotfa  luei t)trxo(rpiudlp  mfvs sfarta(m no0aee iiciysls em(ms t4 rxoxf tytfateauvs s texmxopiy1olt lfes t srtmu pnu0texnifciad s emuvsnt4 rtnxf3iydlmDr i o;(0trxmimpio1opt mncs sf rtm(mono1apeomoeiyd mDrmumo ()alxoif3iadfat  i i s sexrirpiudlp   fviat) rtmur nt1tee  o3iysfsDrmuvp;u)alermf3oy1lmt anvo s) 2ur(m oo1aleelfet (fsruax o;t1opt ioetat s rm(ms ()arermr3iodomD  ies s)seumxopiu4lltemfcia()srtaxroou0tpeo fciaslsDrauvo;(0 eeoir iy1lm  lieils  2tr(m iu4ope  fctlsf 2rm(  ;o4tpe io3ilsfm2umnmp u4altomf3iytfp r u s;s trto(m3nydll nlfetasf rrmxr ;t0oleomi3iytlmDumuvs t0alermocta1opDe nes;t0s2trxo nodlm  mnvi s)a2tau o;u4olt ifeils a emnmp;t0aexomf3tydop eaieo (0 exmio3io4am nlicia() 2tmurono0oee  oeilslaDran s;() rtnif3ty1omD  i o;s teuoxopnu4altnmicslt  ruau pou4texo ietad sDrmu o;t0 eeomf iotfmD an ilt  etriopnydamt  fciasf Dtrxm nu1oee micildfs2rmuvp;t0aeeomo ootfm r nes s)sruo(r io1lmtnmnvt tfsrum(m ou0olenmf3iytla2rmu snt4artnmf3iotfpD auvs;( t2xrxrpou4al  mfvtat a2uaump;t0oeeomfctas s2uanvs t4 lxoio tydomtr i ilt t2xrir3oy4opt mnvslsfsruru o;t4oltoioctasfsDua(ms;u0aetrir3oydomte ieol( srurim3oo1ol   nei s a2tmur ot1apenii3tad sDeln sn() rxomo3io1oat  ivol() 2xmxopou4ll n nvtltf Dtr(mpoo4aet  oeiydla2elnvpn(0tltrircootfate nvils0trurio iu1lmtelfci (farururp;t1aetnii3tltlaDean pnu4altrxr3iatom  anei ()seumio nodoltemfeil( a2rmum ;t4apt iictytfa2rlnvo;u4 exoxo iadoaDrlivilt)s2uo(m iydopenmics sf Draumo;t4tee  ietyt mDuanvon(4teenxo iy1lm ean ol(0 eum(m nu1ll  lnet t) rtaur nu1tet iieiadfm2ul(vs;u4 lxrir oo1la e iei s0trumimpiydopeemfeilt sDtaumpno1oetn feiadfa rauvsn(0 rtnirctatoat aivsl(0tetrxo iy1oltnmfvtltf rtrx pou4olenmietydlaDemu p;t)tetnmocia1omD an i;s) 2tm(m oy4lm nmnctl(f rtrurono4apto fctadfs2uanvo;(0trxoxf tatfatr ivo;(0t2um(opoodalt mfci sfa2rm( ono1apeo oetytfsDrauvo (0trxrxo io1om rlies t teto(o3ny4ll emfes tfaDtmu  no1oex  ieias m2uaumsnu0 lxrxr3oatlpD an o;t) 2xo(rpoo4openmnvs s  rra(m ;o4tleo fciadfmDra( s t4 exrmo tydlmtr nes s t2umiopoy4amt lnvil( srua( ont1apxn i3iad mDemumo;(4trermfctadlm rluvi (0trtrxm3no1apenmiesat a2raxr ot1opxo octydla2rl(vp u4 lxnxfciytfa   nei;() exrirpny1ol  lfci () rur(r ou0alx  ictld a ul(vo u4 lxomf3oa1latr neols0setmxr oo1lp elfvtlt  rtr(m oo4apt mieild sDrmumonu0 lxrifctotlpD anei;(0s2uoim io4op  mnvi ( arrau  ot0altomoctatlsDrm(mpnt)arerxr3oodfpte nvo (0trtrio oo4am nlneiasf 2tax ont4oetnifeild mDeau pn()texniocoo1lptelnes;s)texrim ny1op nmfviat srtaxmonu0tpe ii3iyt m eauvs;t0 rerir oy1fp rliei;t0srurxo3iy4lptn ivt tf 2um( pot1oet  o3tlsfmDrlu pn()aleomr3ta1lpDrauvi;t) rumxr3iydapte ies (f rrmur ;u4tlx  fetad aDrmuvsnu) lxrmrctotfat au sl(0truoiopou4om e ncsas sDrmu pot0apxnifeiys a2ea(vp;t4artoir to1omte i ilt)trtoir3no1lme mfvs s sDur( oou1oeeoioeiytfs um(ms;(4trxrxf3oodopteaues ( teto(mpoo4ap  lncsls) Dumxr nu0aexnioetlsfs2elump;u0tltnif oadlm  livil( t2uoim oydlme livias aDrm(r nt0altnmo3iydls eau s t0alxrmrctodopD luvi;t0trxoio iudopt lneils  Drmxr ou4tpxn oeiadlaDuauvsnu) lenxocootopDeaiei t)s2tmio3no4apeemieilt a2ur(rp;u0tetnif3iad a em(vs;u) rxnif iydomDeauvo;(  2xmxrpnydole  fvsa()sDraxronu1olt  i3iasls2uluvp (4alxrxocto1fp  lieo (  rtrxm3oodolt lfvta(f rua( p;u4oltomi3ias s rmnmonu) ltrmo tatoa r nvs (  eur(r3oodal n nci (fa2taxmpot4tlxo octat m2rm(vpn()arxnioctodfp r ieo s)sexmio3iu4omt mfcias) Dtaum ;t1ale ii3iytfm uau p;t4trerxr iadlate nei;s0teuoim3nudoptn fvs ()s2ur(mpnu0alt  ieiadla uauvp u4aetrio iytlptrln s;s  rxrim3nodlltnlfviatfa2rax  ou4tlx mo3iasfsDra(vpnt0artomo oodlp raivsls)teumim oo4op   nctas) 2tru o;t4olto ieiatlm2rm(vsnt4arxn
\ No newline at end of file
@@ -0,0 +1 @@
+i ilt0seurxm nu4am nmfvtasf 2uaurp;o1tpe  ietyd a2rlu p (4 etrif iatlatr n o;s)teurimpoodolenmnctlsfartaxm ;u0tlto oeiatfa2ul(ms;t0tltoir3iy1fp   u sls0 ruo(o nu4apen icsatf rumxmo;u4aet moeild mDrmnvp;()trtrir3oy1lm rli ol(0trtmxm3no1lmee ict sfa2ua( oot0ope  f3iatfs rl( o;u4aleoiociy1fpte uvs ( seurir3iudom  lieslsfaDtrxr ;t0tlxnmictat a uanvo u4 etrxf3tatla e uvsls)s2uo(mpio1al nmfcs (f Drmum no4tle  ocias a2emuvpnt4trxnxo tytoat lneilt)teumxr ou1amen ivia(fsDtrxrpou4aptnmf3iatlaDelu pn(4 lxnxocio1op rlivi t srumir3oudlm  lfci sfa2raumpnu0alen oeiltlm rm(vp;() reomr tadoa r i ols) 2toirpou4al  mfei (f rtaxmoou4aexomo3iltfa elu p u0tltoxocta1oaDraivi s  etr(m3nodlmtn fvilt) Dra(mo;t4tpxoif3tls sDranmp;u)areoxfciytfpDr u ols0sruoir oy4apt  fes sfsrrmxm ou4aexomociyslsDeauvsn(0texnmf3io1oa  ln ils0srxm(rpoo4lpenlneta( a2uax p;t0opxomoeilt s2umnvp;t4 lxomr3iytlpDr n i;s trxmir3ou4omte fcsatf 2tau o;o4opto iciydfsDeauvp () reoxo totlmDranvi s  rumio3oudlpee nesasf 2tr( p;t0texn i3iltls2ran p;t4 reoif3iydlmt anvo ( srtoxm oydalee ncil()a2rax onu4opxn fetatfa rl( o;(0 ltrif3oytfpD aivi ()s2xrxm3iodopt  ncta(fsrrrxrpno1olt  i3tydfmDrmnvsnt4tetrio ia1fa eaivs;(0setoim no1ap nlfct t)sDur(moot0tpxomietlt mDulnvo u4 leoifciatfatrln o;s) rtrio3oydomtnmnesl( arta(ro;t1ole mo3tas mDelnvo;u0altrif ootfpDean s;( trurxr oodlpt mfvtas)artm(m ;o4oet ii3iat a elu p (4aexniociatfptr nei;s  etoxm iydll elics tf 2trxrono4aee iocilsls rmuvo u4 lxnmr3oadomtelieilt s2xm(opio4alenmfvi sfarurur ot4olxoiietls s2rlu p;(0aetomr3oadfmt li il()setmxr iu4am   fesa(f rraum ot0tpenmfciatlsDemn s u0 exrmociotfmDeln i;()trxoxmpoy4ap nmnetlsf 2ua( pou1tpt ioeiatfaDem(mo;t4 exomo oy1lmtrlu s;() etmxo oo1omenliet s srrmurpou4alxo ieilsfm2elumo;() renmrcoadlp  an ilt) exrxo3oodamt micils s2ra(m ou4tpxomoeiasla raumo;u)altomr iytopDr nvs;t)srxmxmpio1optnlicias) Dtax  ;t0altomicild aDua( p u0 lerxrciydlmDeai ols)srtoimpiy1amt lnviat s2ta(r ;t1aptomo3ilt aDean o u0tlxrxf3iadoa  luvi;(0 ruoxm no4lmen nctlt) 2umur oo4aexomo3tadlm um(mp;(4alerxf3ootoateaiesls s2xoxopnydamenmnct t sDtrx ont4aetoiiciys m2rau p;(0alxrxf iotlp eaivsls) 2toiopno4amenmieils aDrmx o;o0tle mi3tadfaDrlums ()tlxoiocoa1laDe neslt)texmxm no4amt mfctlsfa2tr(r ot4alxomieiad s2uauvp u0alxoif oatoa   u i s) eur(r3oy1lpeelfcta() Drm( pnu1tpeomo3iadlmDel( pn(4arxnxr3iadomDe uvsl(0 rxmiopnydlltemfcsl(fs2ur(mo;t1oetniociyslmDemnmo;(0 reoxo3oa1oa raueilt) 2tm(r iydop nlncia(faDrm( pno1tee  octltfaDumu p;u4alxoif ty1omDr uesls  exr(m no1alee ivtat sDurur ou1openmf3iat s2ulnmo;t0aetrir iydoaD  u ol(0 exmio3iy1lmtnmneia( srtr(mont0opxniociat s2um( s;t0 ltoir3to1lmtelieil()srto(m ou4lm emiei ()aDua(rpoo0tptnifcild m2umnvs;u) eenir3iydfmD li s s  euoim3iu1lptelnvtl()a2ta( p;o1oltn icias mDrau p u)tleoif3iodfa r neilt0trxoxo3oy4om nmnvi (f rra(  nt0opto ieiydfaDul( s u0tlenxo3iotomDraivslt  etrxm3no4open ivil( a2rru  ;t0ape moctlt sDeanmon(0 reoif iytfpD lnes ( srumxm3ny1om nliei tfa2ta(r ou1alxo o3iaslm2ulnvs t0arerxr3ia1lpDranvs;( trtmim3nu4amt mncsas)a2umu ont0texniiciat a2rlumonu)artnxocio1latraivi;s)trtr(opio1llenmivtlsfaruaur nu0aet  ieiat s rl( ont)trtnxf3totfmtr i ols  rxoio3no4ap   icsl( a2ua(m ;o1alx  fctydlmDem( p;u0 lxoxfcootlm   ivilt) etm(o3iudol nlivt sf rumxro;o1aex  i3taslsDua( pnt0aexoxfcto1laD lieo s0 euoir ny1lle livia() rtrum ;t0alt ii3ildlmDelump;()treomf tytfp rlu ilt0 2xmxr no4opeemiei ( aDtrum nt4apt  feiadls eaumpnu0teerxo3to1oa   nesls)t2urxm3oudal elfcs tf rrm(m ;o0aptomoeiydlmDrlnmp;u)tlxnmr3ootomteaiesl()texrxr3no4ol emnesl( sDrmxmo;o1aexnmi3tatlm2umump u)tetrxr oy1fpt  nvo s0s2trxm ou1lptemnetat srtaump;t0aexomi3iltfs2rlnvp ()aetrxo oatlpDrlu sls) 2trxmpoy1lptnlfeilsf 2ur(rp;u1openio3tysfs ra( s;(0trxrmr iodfm eaueilt0 2tmxopnydaptnlfvi s)a2rrxmono4aex ioeiltlmDulnmp;t0tleniocta1om e uvi;( s2trxm3ou4lp   icils)a2tau  nu4opxo fcilsls ranvp;u4artrxr3tadlmtr n sl( srur(opio1op  mfei ( sDrmur ;o1aleniocilsfmDrlnvs;u0artrmo3oydlptrlnvol(0s2xoxo3iudolte fvt sf 2rax ooo1aee if3tysfm2emnvsn(0trtnxocoadfa  an s;(0 exoxr oodapt  fesl( aDurx pnt0ole  oeiltlsDulnmon() rxomo to1fat au i;(0tetrio oy4omt  ivtls)srrmuroot4oex mfciytfm em(vpnu0 ltrxo to1opteau s () eurxo3oo4op  mfcsat s2tmump;u0teenmi3tatfs umuvo;u) renxr todoptelnvil() rxo(m3nudapen nes () rurxrp;u0tpxomfciat mDra( o;t)aexrif oo1lm  aues t)s2xrim3oy4ale lies ( aDrm(mpou4opeomoetadfsDel(von(4 lxomr3todoaDe ivi t0 2tmir nodlpt lfetltfa2rrumont4tex ifeilsfs2uauvs t0 lxrio ty1fmDelieilt t2uoir3iudamenlivtatfsDtmump;u1tle moeiatfsDumu p;() reoxr3io1fmD auvs t0teuoxo oydol  lnei s artr(rpno0oet  f3tydfm2uan s;t0tetomo3oo1fm rlnes;s  rtmxopnydlpte ieilsfaDrmu  ;o4alx mictyd m2uau o ()trxnio3oytlpte ivils texrir3ny1lpe  nvsl(f rtax poo0oeeoioeiat s2ean p;(4 exomr3todfp  luesl(0trxm(r io4lm emnvsltf rtrx pnu0aet ioetatfm emu s;(0 rtoxf3iytfm rai i;()tetmim3no4alt  iesls srrr( ooo0tleoiociatfm2rl(mo u4arerirctytfpDr n sl()t2xmiopoy4alen fvtasf 2tau  ;t1oex iociyd aDra( pnt4 etnmfcoodfm e i i;( t2um(r3nudllt mfvtlt a2ra(ronu0opeo iciltla eln p;u4trerxo ta1oa elnesl(0t2umxmpou1amtemfesltfsrum(moou1tle ioctls a2eanms u4tetomfcto1omt livilt0trxrirpno1ol nlnctltfartau p;t0apx io3iysfsDra(vpn() ltrxr3oadlmte ies (0texo(r iodal nlivs s aDra(  ou4apx ioetytfm rmnmsnt4trxoio3tydfmt au o;( setmimpnu1oltnlncs t) Duaumpnt4olxomoeilslmDuanvpnu) rxrmr3oatlmt  nvs ( teuoxrpno4llen fet s a2rr( pot0tlt  ocilslaDrmuvsnt) rtrir3tytoaDeaivsl(  rxo(o iydlme micilt)a2rmump;t4opxo fciysfs2ulnvs u0trxoxrcia1lmDeluvi t)t2uo(opiu4ol emict t)a2taumoou0tpto o3tydla rluvp;u4 rtoircoatlm  anes;t)setm(o3ou4lpt mfeiat)srtaxmoot1opt  i3iysfa2ua(mo t0 eeomf iotfmtelu s s) etmxmpiy4ole lfvtlt)arta( ono4teto ietad s umump (0 exomo oo1oaD  uvs ( trtr(r nudlmt  nciasf rtaxm ;t0altn o3ils sDuaump;u4tetrif3oo1fpt an slt0t2xrxr ou1ll elnvia()a2rrurp;t0oet  o3iydlsDumu p;t0arenmrcto1oaDr iei;(0setoir3oo1omtnmici t a2tr(ro;t4tetn octlsls um( p;() exrmf ta1fm   ues ()srtrxrpoo1ll elieiat)aDur(m nt0aexnifeiaslm2emumsnu4aetrir3ta1lpte n i ()s2urxmpiydap elivtlsf Dumx  nu0altnmfcildlaDemnmo;()alermf3ty1op rauesl() rtmir nu1lptn ici (fartax ont1oet io3ilt aDeluvs;u4alerxf iotopt auvo;s  eur(opiydlleelnct tf Durx ont1tex iicilsls2emu sn(0teerir to1oat  ivi;t0 2xoxr3ou1lm n fvtlt)aDtm(ro;o1olenioeiytlm2rmn p u4 ltomf3oo1la e u s t  euo(o oy4opt  ivslt) 2umur ;t4tltn fciadfm2rmnvonu0tetnmfcto1opD  ivols)setm(o iu4oltelici t sDtau  nu4oet  oetytlm rlnmo t0aetnir iodlptrauvi s0srumio ou4altn ieil()arrr(mp;t1tetniieiytfa2rmuvo;t)trermf3oatlpDr nvil()setmxm oodomtnmici s)sDuru o;u0opxoiictltfm2rauvpnt0alxnxr ia1lptrai ol()teto(mpno1lpe  ivi (fsrurxr ot1oexo ociadlaDumnvs t)aetnmf oadop   ieo;s0texrim3no4op elivtls  2tr( ono4teto o3tys aDrmums;(0aetrif ty1lmtr uvo ( s2uoxr oodolt mfctasf Draxr nu4aleo ocildfmDumumo;t0teeoxrcta1lat aivs t0trum(m iudlp n ivslt)s2rmumpou1oetn i3tasfm uauvonu4tltrxr oytlp rln ol( t2trxo no1llte fcs s s2tau ont4tltn i3iatfmDelu o;t)arxrxr totfm  lnvo (0 exr(o oodll  lfvias)aDrmx o;t0oltniieilt s2uanmonu0 etnio3tadfmtraneilt s2xrxm no1amt  ies (fa2uau oou1oee ii3tls s ul(vs;(4 etrmo3iytlaDraneolt)truoiopoo1lpt  fviasfs2tr(rpou0opeo fcildfmDulumpnt)altrxf3ootlpDeaivilt t2urxrpoodlmen nesls)artax pnt0texnmfciyd a rmu p t4tetoir3oa1la  auvo (0 exr(opio1amtnlfvtlsfa2tmum nt4tpxnif3tasfmDuaumpnu0altomrctadop  anes s  2toim iy1lpenlncias aDra(  ou1apt ioeiasfa2emnvo;t4 lermfctodlatrlu s;t)sexmir3ny1llt licsas a2tmxrpot4alxn o3iydla elnvp;u)trxomr3ta1lpD  u ils0t2um(mpno4lleelnesat a2rm(  ;t4tpenmoeilsfs2uanvp u)alermrctotfpt ai i;s  eur(m3oo4lmee ivt ( a2urx pnt0altnii3ils sDrm(vo u) rxnifcoo1faD  nvolt) etm(rpiy4amee ivia() Drrx pou4apt ifcilsfm el(mp;u) rtrxoctatlat  nvols)t2xoxm3oy4alen nvi tfs2trump;o0apeo f3tytfm2ul(mont4 lxoifciadla eanvo ( s2tmimpoydape lnvil( a2rmxrp;o0oetomf3tat m2ea(vo;()texrio3tatop e n olt0t2umxm nodlpe  ieils artr(mo;u0oee  o3iytls umump;()artrxfcta1op   nvs t setm(o iu1lmee ivsas)aDraurpoo4olxnmfciat m elnvo u)trenmf3oo1fatrai o;s0 eumio iydll n fviasfartax ooo4opx ifcildfa2ul( snu0 lenxf oy1oaDelu s;s)t2uo(o3ny4lmtn icsat a2um(mo;u4tpxn f3ils a emuvs u4 rxrxr3tytlaDelivo;s0trxr(rpiudap  liei s  rrrxmo;t4aee io3iadlsDua(vs (0 reomo todop elueo;( t2xo(m iodam   ieia(fsDurxmpnu4apxnioeiyd m2uau p;(4arxomr iy1fmDeaueo t s2xr(m ou1lpe lncslsf rta(monu0opxoifeildfa2ua(mpnu4artnifcoydop r uvs ( srto(m nu4llt  ivsas)srrm(rpnt0texomo3tysfsDraumont)trenmrciadlmtrlivi;t0 rxm(m3nudlmeemivtl( s2tm( ooo0opto feild mDrm(vs u)aexnxo to1lptr i ilt)trumxm ou4al e fetat sDtmxmont0aeeoiicilslm2raums () ltnir todfmtrln i;s) etm(o iydope  ncsls) 2tmx  ;o1tlxnio3tas s2ua(vs;()tltoir ty1lptr nvils  rtrir ou1lptnmfetl( s2urxmpnu4tltn ieiytfs umumon(0 ltoifcoy1omte nvols)srtoirpoydaltnmfvsa() Drr(rpno0ale miciyslsDean sn()areoxr3tydfmtrli s (  rtm(m3iudop emnvil( sDuax  ot4apx  fctltfs2uluvo u4 renxr todlmDraneo;s0teumirpiy4apt  fcs s)srtrur nu4tpe  o3ilslaDul(vp;t) rtoxociydopt auei;s s2xrim3nudamtn fcsl(fa2rrx pnt1tle if3iltlmDuanmp;t4texniociy1optrlivi (0tetrio3oo1ol emnvsa()arrmu pnu1aetomocildla emuvo u)aetoircoatfpteaieslt) exrim3iu1olte fvtl()sDrru pnt0olt ifcilt a2rm(vo;t4trxnmr iadomD lnvi;s0texoxo3no1apt mfvi sf Durxro;t0alx mfctytfm2umuvp u4aetoxr tatfpt  uei;( srxmio3io1lmen nviat) rur(  ;o0teenmieiyt aDrmn s u0trerxrctodoaDraivs t)texoxrpiy1lltnmfes s) Drrum nt1altnioctasla ran o;(0 ltnxrctadfm eanei t) 2xoxm iu1altn nesat) Dtmur no4tpx mfciysfaDulu s u4altnio3ty1fpte neils0srtm(r iu4ol n fet () Dum(r ou1apxo fciyt mDuauvp;u0areoirctytfm rlieo () euoxm3ou1lmenmfcslsf Draxrono1aex if3tytls rmn o;t0 eeniocoytoatrlu sls) eumir ou4al   ieilt sDur(ro;t4aeenmieilt a elnvo (4 reomocoa1omtelnvo s t2uoir3iy4alen ivsas a2rmxrpnt4oex mfciltfa2ul( s;u0alerxrcoo1oa eaivolt  exrimpiy4op nmivi t) Dtaurpnu1apeoiociad m2rlnvp t)aetnxf tytlaDeaneols texoimpoudaltemfet t) Dur(mont0tpto feilt a em( o;u0tlxoxr3iytlmD au o;s sexrxr io1open nct t s2taumoou4tet  ictldfm ranvo;u4texrio iotlateai slt0 2trxm3iu4lleemnei t)s2umumont1aleoii3iydfaDea(vo;()trerxr3tydoatraues s0trurxo iu4lmee fvsas aDurur ou4tpt  icias aDumnmo;(0trtriocoytlmDrau sls) etrxm no1aleelfvil(f 2uaurpoo0olx  ictad s2el( snt0aexoirctydfmtrlnvo t0s2toio nodamte ivsat)arrrx pou0ope moetyd a raump t4 lenmr3oa1op   ieol( srxoxmpou1lptn fvt (  rrrurp;o0alto ieiad mDeanmsnt0aeenmfctatfpt li slt  rxoir3nu4apt  nvt tfsrra(r ;u4tet mf3tltfsDemn p (0alxomo3iy1op r n i s  2uoiopiu1ole lict (  rtm(m no0texnmociysfsDulnmo;t)aleoifcia1fa   uvo ( trtmiopoy4llee fct s)s2rmx p;u4aex  o3iyt m em(mpn(4trtoxocoatoptranvo;s)t2tmxo iy4ole mfetlt sDtaurpno0apxnii3tatla2ra(vs;()alxnmo oadoaD anvsls0srxmxopoodol elnes sf Dtax  oo4oetniocilsfa2rl(mo t0arxnif3oydlp rli s (0trtmxr3ou4lptemivilt sDtmu  no4opx  fctyd s2um(ms;t4artoxfciodfm   nvi t0trtrxm3nodlpenmfetasfsDur(m oo0opx  octls m2rluvon(4 rxnxf3tytfpt aivo ( t2um(o3oydopenmieta( aDurxrpnt0tetnioetysla umnvpnt)arxnxo3iodoaDr ivi;t0 2toiopiydalt  nvsa(fs2trurono0optn ieiadfs umnvsnt)tltrif3iy1om r n sl( s2urxopny1al n nvtls srta(rpot4tlen fctasfmDuln onu0tlxrmo totlatr nvsl()teum(o no1optemnvias  2trurp;o1olx ifciytls emuvo;()aexnmrcootom rlu o;( srxrir3iodoleelnesat sruax onu4opxomfeiat sDrmumsnu)trxomf3iodoa eaieols trtrxrpou4ll   fcia(fa2rm(moou0ope ifetas a2rm( s;u4artoifcoy1fp ean il(0srtoir3ou4ome miciltfa2rm(r ou1opt  icilsfa2el( s t)trxoxr3ta1optrauvo;s)srxoxmpiu1alt mics t)a2ra( oou4oleo o3iat aDrau o;t0treniocty1fmtrauvs t0 exm(o no1lle mieils sDumur ;u0tle  feiydlsDrlumon()trxoio3oy1lpDraivi (0tetoxmpoo1oltemfvsatf Dtrx o;t1opx mf3ilslaDelnvs t4aeermfcoa1lat auvi t0t2to(r3oo4llee fvtltfs2rax o;u4apx iietas mDelnvp;u4 rerif ia1opte ivi;t  exoxmpoydlm n ivilt arum(ronu1opxniociatla um(mpnt4 etnio oydlaDelu sl(0 2tmirpiodlmtelnct s)s2tmxmo;u4ope ifciltfmDumuvpnt4tetnio iodla raivs s t2tmxr3iudlmtn fvia(  rrm(r ot4oetn o3ildfm2elnmo;t4arxrmf iadlpDrluvslt) rto(o oy4alee ict (f Drmumoot1opt  oeildfs2um(mo;(4 lxnxf oytlmtr ivs (  2toim3ou1lm emfcsa()a2rrur no0oexniieiytfmDrmu o;t)treoxo3oy1omteanvi;s) eurim oodlpte nct ( srurump;t4tleomfeiys m2el(vp;u4 eeoif oodlm raivilt)s2uoim oy1om n nvs s)sDtruro;o1oltn i3iltlaDeln p (4aexrmociatlpDe ivsls)t2xo(rpou4amt mictat arumx o;t1aeto ociatfs2umnmp;u4 rxrxr3tydfpD luvo;t  exrio3oydapenmictl( aDrmum ;t1alx mieiydfmDeln s u)trtoxo3tydla  livilt0teuoir3nu4ole  fvsa( aDur( pnt1tltn i3iadfa raumo (4tetrircoatlaDrlieo;(0teurxo nu4lmtnlnctl()aDur( oou4aetoio3tlsls ra(vont4aetnif tytfmt an il( texo(m3oo4lm nlicsl( srtaxmo;o4aeeo ieiat m2umuvo;(4areomocoadlaDelneo;t srxmiopno4ap nlieia() 2tax pnu4olx if3iysfm2rm(mo;u0trxnxo3iadom  auvo;s  rurio oo1lp  mivsasfaDtrumont0oetnifeiadla2emums;(4trtnircoatoa e neils0t2xoxrpiy4lle mnviat)sDtaxm ;u4tltnio3tldfaDem(ms;t0altrmf iotlpt auvo;s trto(r3ny4omenmnctltfsDtrxmoot0opx if3iat s uauvs t0 ltrmr ia1lp  aivo;t0srxrirpiydomt liciatfs2tr(mpou1tpeo oeildla el( p;u)tlerxr io1oaD luei;t  eumxm3iydamen ies tfaDtmurp;u1oeeomoeiltlm umuvp;(4tlxnio3iotom rlu s s0trxm(m iu1al nmies t) Dumumono4tetnmi3iltlsDra( snu0arxomo3oy1la e n o t)t2urxm3no4ll e nei tfartaurpoo0aptomi3taslm2rln o t)treoxf3iytfpD li i t t2xrxmpiydamenmnci () 2umur nu0tptnifcils m2eanmp;(4tlxoxr iydomDeaues t0sruoiopiu1aptn ics (  rtaurooo1tptoiieiyt sDranmsn(0 rxoif3ia1omDrli s (0tetoimpnodol emfcs (fsDuax oot4opto ociat m elu p;t)tltoxoctodlat li s;s0 rxr(rpoodlptnlivtasfa2rr(mp;u0apt mieils aDrln s;(4 lxnxf3ia1lmt lueslt  exrimpiu1op e fesat arrax p;t1teen f3iysfa rlumo;(0aexrirciodlpD  nvslt0 2xrimpny4lleelnciasfarrrxmp;u1oltnmf3tatlmDemnvonu) lerircoatfmD lu ils0sruoir no4ame miesasfa2tmxmonu0ole  feildla rmnmont4tltnmo io1oat lieol()t2urir3nu4ome mfcs t  Draxmont0optomo3iad aDrln snt) renircoodlp rlneo;s)s2xo(m iy4ole mfesasfs2ua(m ;u0tee  fetatfm2um(vo u)aeermo iodfm eai s t0t2umxmpiudlpt  ncil(f Dumxmoou0tetnmfciltfs2ea(msn(0alxrifciy1oa   nvo () rxoir3ou1amtemivs t  Draur ;t0optomociys aDeauvp;(4alxnif iodoatrlieil() etr(o iu4llt lncsls srrru pou1tleo fctadfs2umu o;(4trtomo3todfmt lneo s sexmim3oy4lleelicsasfa2ra(m nt4oeeniictaslsDea( s t0 rxrmr3iydfptran o t) exmirpny1lmeemfeia( sruaurooo0opx iociyslm em(vs;u) reoxf io1lmt lnvi t trtmxr3ny1omt  fesat)aDtaxrooo1optoioctysls2eauvs;u)tlerxrcto1fpte iesls) 2xo(rpnu4am e iviat s2ra(m nt0tleo ocilsfmDeaumon(4 reniocoy1oa elnesls)s2to(o oodomte nvt sfaDumur ;t1olt mietltlmDran s;u)teerxf oodla rlnvsl()srtm(m iy4alt miei t sDrrx  ou4tetn ietysfmDeluvpnu)trxomf3iy1lateliei t s2uoiopny1omt mfei s srtau  oo0olx iictls sDrmu pnu0 eermf iydomt ln s;s srtoio3ou1lmte fvt sfsrtrxroou4oleomiciys m2ul(vo t0aeeriocoytlp e nvi s0tetm(r io4alt livilt srtmump;t4tlen oeiydfa elnvs;u4trxnxr iydoaDr nvsl(  rumxm oodll n ncsl()artr(m ;t4aetomi3iadfm2ulu p u0trermo3ia1faD luvi s0 2xr(opio1lme lfesatf Duaxrpnt4oltomietyd s2rl( sn(0alxnifcto1lm eauvil(0t2umimpiy4ol  mnesasfs2umumpot4aptnmietas a2rm( snt4aexoio3tydop e nvs t sexmxm oudllenmfciat aDur( p;t0tetomictlslaDrm(mpn() exrxf iotopDe n o;t0t2xoxrpoo1optn fctatfsrtrxm ;u1texoifeild m2rmumont4alenir tadlpD ai ols s2xrxm3nodlm elnviasfa2rau  ;o4aex mietysfsDrmnmsn()aeenxf oydoatr uvs ( texr(mpnu1omenlfvi s srrmx  ;u0opxomo3tat mDea( sn(0 lxrir3tatop   i sls) rxm(m iu4opt mnesa( srumxr nu4opxn i3ilsla emu s;t4 lxoxo oo1fm  ai s;s  2xoirpoy4lp nmfcsl(f Dtaurp;t4optn iciadfa eluvo t4trtoxocoy1lm e ivo t0setrio3oo1lm n ncsls) 2umurp;t1oetn feiyd mDemn p u4tlxrif3iydfm rlies;t0 exo(o no4lm eliet ( aDumx ono1tpeo i3iydlm rlnmpnt4 lenxf oydomDeanesl( trxoxm3oo4om e iesas a2rmxmpnt4texnioctysls eanmp;() lerifciytlmDr i ol(0sexr(opou4alenlfes t)srrru p;t4openmf3ils s elnvpnt0aetoif oo1omD lu i;t teurxr oo1oltnlicsatfsrra(mo;u0apt  o3tysfa2rl( s;(0 exrircoydfmtrluvil(0 2uo(rpnu1al elivi t)aDurumpoo4opeoio3iyslm elnmo;t) ltomr3tatlp rln o t)srtrxr oo4lmtnlietlsfsrrmurpot0opeo ieiadlmDrlnvsn(4alenxo oadomDe uvo s t2xrxo3nodope  fcs t)arrax  ou1aex mo3iydfaDea(ms;(0arenxocty1optrlneo s0 rtrirpoo4omte icsat) Dur(mpot1tleniictat m ea( o t0altoif3oa1fa rlnvo t) rto(m3iy4ame lfct (f rra( pno1tetoioeiadfa um( p t4altoxrcoodla r uvi;s) etrio oo4amtnlfciatfaDra(  ;o4olxo i3iys m2em( s u4 eenio ty1la elivsl( texoxo3nu4altn fetat arrr(mp;t4aee ifeiytfs2eauvsnu0 rxoio3oytlaDeaies s)teto(rpoy4altnmici (fsrtr(mp;u4tltniietyslm uanms;t4 lxomr3io1oate n s t0t2xrxr nudalen net sf Dum(m ou4texn feiysfm2emnms t0alxrmr ia1fm  livo;t truo(rpoy4amee ivi tf ruru onu4olxnmi3tydfaDrmnvs;(0 eenmf3oadlatrliei;t  2xoxm3nydam   ivsas) ruru  no1oeeomfciyt s2rln p u4altnxo oa1laDrauvils) exo(r3nudal nmnes (faDur(m ;u0oetnmocildls uluvp (0tlermr3tadfaD  uvil() eumio3ny1aptnlfvils) 2tmumo;u0oeen i3tas sDuau s;u4aexrifcootfptr n i t)t2uoxr io4am  mfet s) Drmuroou4apxoif3ilslaDrm(mp t0arxrmo totomt anvi s0srtm(m3nudlle lfvta( srtm(rpoo0tet ioeildla2umn sn()aexoxr iytfmtelivo;s)t2urxo ou4llen neiasfsDumxronu4tltoiieiadfm2umu sn(4tetnmfcta1fp elneilt0 rumio ou4aptnmnvtat)srtaxr nu1texnioetyt s umnmp ()aetoxr3iodom e nvs;(0setoxo iu4omtelfeia(f 2um( ont1apx mi3iyd aDra(mo;t4altrif3oa1oa r nvo (0 etoxr3oy1alt lnesls)srtrxronu4olxo i3iaslm rmumpn()artnir3ta1oaD  n i (0srxoxrpio1lme  iviatfs2uaum ;t1oleoif3tadfaDrl( on()trtnifcto1fpDe u sl( t2to(mpoo1lm elnvt tf Dum(ro;o1alen fciyt s2ulnmonu)tltrmf3oo1fmtrlnes ( sexo(opoy1lmt mnciasfarrr(mo;u1aex moeiyd m2rmuvp;(0alenxf iytlaDe ueo;s  etrir3io4op nmieia(fa2rm( poo4tptn o3tysfs ea(ms t)alxoir oa1omDeaivsl(0texoim3oodamtnmfvsatfartm(m ;t1oltn f3iaslm2uan p;u0arxrmo3oa1fp  lueo;( texr(mpio1apt lnes s srtmu pnt4oet mo3iadls rlnmp;u)artrmf3tytlaDe ues s0srxoir3iodameelncia()a2ua(moot4oleomf3ilsfm um(vs ()tleomo to1fa  lu o (0 rtoim iu1altelicsa()s2trxmpnt1olx io3iydfmDrmu s;t) eeoxf3ia1oaDr ivi s0s2xriopiudapt mfctls sDur( pot1tptn ieiad s2eanvs u) lxnxr3oo1la elneil(0teuo(m oo4om n nesltfsDrrumo;u0tpe moctlt aDumumsn(4tlenifciytlm r ueolt0sexmxrpou4llenliet ()srrau  ;o1oexomietydfs rm(vsnt4tetrir3to1oa ean i () rxrir nu4ol nlivt t s2rru  ;o4opto i3iytla emnvs;t)treoif3totom rlu olt0texoim iu4olen ieiasf rtru  no0opeomfcias s2rmumonu4trxoxr ta1oa e n ols trtm(o3oodoptnlfctas)a2rau pno0tlxnmoeiyd s2rauvpnt4teerxf tytfmDr n sls)t2uo(m3ny1openlfctl(f 2uau  ot1tex ifeiasla uluvp u)tlxoio3tatoaD au olt)srtoxrpnydlp elici s aDta(  nu0tpt  i3ilt aDulnvpn(0 lxnif3iodoaDe u ilt) eurxr3no1lmtn nvil(farrmumpnu1alx ioeiyd s elumsn(0alenif3oatlp eaneil(0 etmxo oo4olen nvilsfs2raxrpnu0ape mo3iadla2ranmsnt)artoxfciydfat  i slt t2umxm3ny1llt micsls)a2tr( ont1alxoiietad s2emnvonu4aleoxr3ta1oaD  uvs;s) euoxmpiu4lptelfeiltf 2rmxmoou4tleniictat a2el(vp (0tlxnxfcio1optrln s;s0 euoxmpnu1amte fvils aDrrum nt4opxoiieiatlm2umnvp t0 leoxf oatoa raies;t  2trimpno4lptelics t)a2ta(ront0aexn ieiltlmDranmont0alenir oy1lat  i s s)sexr(r3oodlp nlietl( s2rax oot4tpto f3iad m2umnmo t) lerir iytlate u i s  eur(m3nodom nmncsat srtmxrpoo0openioeiasla ul(vp;()trenxf oa1faDeauvi;t0trtm(opiydamtnmfvi s  rtaum nt0tlxnifcils a eaump;t4aetrmr iatlmte iei;t  2urir nodoltelfvtasfs2urxr ;t4tlxnmictlslsDraumo u4artrmfciatoa rlnvo (  exo(rpiodopt mies s) 2umxr no4aetoifeiad s raumsnu)trxoxf3oa1lmDeluvo;s)sruoir3oy4opeemfcslt  Dtmxroou4tetn i3ild s rl(vpnu)altoio oy1lmD anvs () etmxr ny4ll e neilt  rua(mono4tpxnmieiydlsDeauvpnu0 lxrif3iodlmtelu o (0 2urimpiydam nmnvil()sDtmum nu0oee io3tlsfm2uln sn(0tetrxf iodfaDelies;( trxoxm iu1ope  nctls) rrmumpno1olxoioeiysls2rl(mont)treoxf3iodfp eaivo (0t2trxopiu1ll e iei s srraum nu1alx miciltfa2ean o;(4 lerxfcoy1lm r uei t0teuoxo3oy1amenmfet ( aDtrx ont1oeenio3tadlaDea( on() ltrif oadfaDrlnes s0 2uoio iu1lm e ics s)srra(mono1olt  ociad s elu s t0 rxrio3oydfp r ies;(0teumxopny4lpe lneias)s2ta( p;u4olxoiociltlm em( ont4trenmo3oo1lp eli o;(0teto(mpoy1lpee fesas) rtaxm nu1aetomi3ilsfsDrauvs ()tlxnxo ia1fp r nvi s)setmim no4lp  lfvtls aDuaxr oo1aee moeild s2ulumsnt)altoxf3tatfaD auvsls0tetoxm3iy1al n ietl() rtr( pot0tpx  octltfa ranvo;t0arermrcoadlmD  uvi;s seum(r3nu4am n feilsfaDrrumpnu4aet  o3iatla2emu p t)aexnxo tytlp e n s ()t2uoxo3oy1lmenmnesls arta( o;u4olxoifciatlaDulumpn(0tlxnxociydfm rli i;( trxr(m oydoptnmivs tfsDtrx pot4opx  oeiatfm raumsnu)altomrctotlp  lieo;s0 exo(o3no4am e fesasf Dua( ono1opxn oetls a eanvon(0trtnircoo1oaD  i s t)texrio ny1lmenmiesl( artru poo4teto fciysfs umumo u0 rxrmf3oydlp eanei;s  2trim3nydaltnmnvtl()srtau oou1aex ii3ild m2ea(mp (4 lxrxo3totfmt  ivols)s2trxopiy4op  lnetl(f Dtmu pot4apx mi3iadfsDemu pnt4 lenmo3iatfat  nvslt) 2uoio io1altnlietat)a2ra( p;t1aex iiciyd a2ulumonu) rtnmf todop eaivo ()srxm(mpiy1optemncsl( arrau oou1aeenmf3ilsfm rluvpnu4 lxoiocoadlmtrai i;(0 rurio3ou1lm   ivi t) rrr(m ;u0oex  o3tasls2emnmo (4tltrir3iy1oa e nvils srum(r3oy4lp   nvi s) rra(rpou1tlxn oetlsfsDel(vp () etrxf tadfmDrlivi;s)s2xrio iy4opeemnvilt) Dur( poo1tpxnioeiadfs2umn o (4 exrmr3oa1lmteauvil()s2urxm oudopee iei s srum(m ot1oetoio3iasfm rl( onu4 eenio3tydfmtelneo;s setmim oy1al  mietat)aDra(  no1tlxomi3iyd sDrm(mpn()tlxoxf3ia1latrlu s;()truoimpiy4amtelfetls  2tm(r ;t1oex ifctysfm2rmuvp;t4tetnir3ootlp  ai s s)s2uriopoo4ap elnesl(  rraurp;t1oltomfcils a2umuvsn(0altomf3oa1fmt ln s (0setrxr3oodap  licsas  rua(r ou4oex  oeiyslm emu o t4aexrmfciy1fp   u i;t trum(m iu4opee fvsa() ruaxm ;o0oetniietadfs ea(mp t0trtnxocoytfpt ln olt)s2xmxrpnu1ole  nci t aDrr( o;o1oet  icils m rlu p u) lerif oadfaD auvsl()t2tmxo3iu4amee fvsltfa2ur(mp;t0optomoetasfm2rlnvsn(0 eenmfciotfpD aieol(  rum(m3io1ape mnct sfsrta(m nu0aet ii3ias s uanvs;(4aleomfcoydlat  i s (0 rxr(o3iydame  ncsa(fsDtmumonu4oleniictad a2emuvp ()tetrxf to1lpteaivs s t2xo(mpny1lpen ivslsf rrrurpoo4apenmfeiydlmDrm(ms ()trtoxrcoodoatrlnvi;(0sruoxopio4omtnmivias)aruau  ;t4aexnmfeiyt s2rmn o;(0 ltnxo3ootopteaiei;(0 2ur(o3oodolenmieta(f Dtau ono4oltomocilslm2ra(vo;(0aexrmocoodoat ai s s0 eto(opoo4lpe  ncslt srrmxrpno0ale  i3ias sDul( p;u0 ltnmrcoy1fpDrai o;t0 rtriopoy1aptelnei ()arraxmpoo1tetnmietydfs2rau s;(0artrmrciydlp eaneo ()s2ur(r3oy1lle miei tfsrtaurooo0aptnmf3iys a2rm( snu0arenxo3iytlmDeluvo;t0srxrio3no4oltemivtltf 2tru pno1olxnmi3ils s2uaump () lxoxocoa1omDr uvs;s0 rxm(opiodalt mieils) rur( onu0olx  fciatfsDrlnvs;t) ltrmr3iatlmDr ieol() rtm(m iu4lmeemivi t)s2raur ;t0opx ioeias mDrm(ms u0 etrmfciatfm r i il(0teur(m3oo1om emneilsfartrxr no4tlxomociad m rlnmo (4 etnxf3oydfmtr n ols  2tmim3nu4op elfci (faDuax pot0olt iieiysfaDrmuvo (4teerxrcia1fmDe u sls)texo(r oo1lpt  fesat  2tmxm oo4optnmf3iat s2ua( p;u4aeeoxo3tatlmDr ivo s0 rxoxm iu1omtemfviatf rraxmp;t4aet  oetadfsDuauvonu0 etnmf3oa1optran o;t) 2trxrpoodap   fvtatf Drmxmpot0apenmf3iytfs elnmsnu4trtnmf oatlp  anei;s t2ur(mpnu4aptn nci t)a2tax  no0aetniiciltlsDel(vo;t4texrifciy1oaDelnvs (0 2to(r3nudap  lnct s) rua( ooo4apxn ietadfa em( p;u)tlxriocty1oa r ivi;t0 2urirpoo1ll   ictls  Dtrx pnt1alt  feiadls2uau p;t4 ltnir3oa1omDelnes;t)s2xrxm iy4olt  fcslt s2tm(mpoo1tlenmf3iys m rln p;u)tltrircoo1fptelu olt sexm(opoy1opeelncsls)aDrru ont4apeomo3ildfaDrln on()aeeoio to1lmt  iei;s)seurxmpoo4altemnviasfaDrm(rp;o1oetn oetldfs2ulnmp t4tleoir todomD lies;( trxm(r nodape lneil(f Dtm(rp;o4tleniieiltlaDrmn o;() etoifctodlptrli o t teur(rpoo4op nliesl(  Draxmo;u0apxnmi3iadfa rlnmo;t0tlenmoctotlpDeanei s0trur(rpoydapt  fcil( sDtaum ot4tetoifetadls2em(vo u)trtrxf ia1opDelu i s) etr(r iudameemfvil(f rrau p;t4tptomociatls2ua( p () etnmo iodlp  auvi;s0srxo(rpou4opt mnctls)sDrr(rpnt0tlenmiciytla2el(msn()artnmfcoydlmD luvi t0srxoxo3iu4ale  fesls)arra(  ;u0tle  oeiydla ean p;(4 rermf3ta1laD lnes t)t2tr(o ou4omeelieias s2umxrono1altnmi3iydfa2elu o;() rtnmo3oadomDranvs;s)truoxm oo4oltnmfet (faDrm(r nt4openmoeiysfm2umums;() lxnmo3ty1opD auei t)seumiopno1amtn ncsasfaDraumoot0ape mieiyslmDemums;(0tleoxrcoodlmD anes s0setrir3oydll nmfciatf Durxrpnt1texomf3iat m rln p;(4aeenxf tydfmDe ivs;t srxo(rpou1amte ies (  rraum oo4aexnmf3tydlaDemu p;t0 exoxocty1lat  uvo;s s2xo(m iodoltemfei (  2rmumpno4alxomi3tyd s rm(msnt0 rxrxrctotom r ueolt) 2xrxm oy1amtnlnvias a2ua(m ot4oex ii3tatfm em(mp;(0 rtriocty1lmDeau ols)t2xr(mpny1lmtnmfci s  Drmxroou1olxomf3ilsfmDulnmon()tlxnirciytla  auvi;s0 2xo(o3oydomte fetatf Dtaumoou1aeen oetydfm emnvsnt4teenxo3oadfpDeanvi;s0teuo(r ny4amtnlfetls s2tr(r ou1tex mi3iysla ulums;u)aexnmfctodlaDrluvsls t2urxopoudlmtemneta(fa2tmx poo0tpx io3tatfs emn o (0trtrio3oodlp  ln sls seurxopoo1lmte nvt s) Duax  ;t4olt  f3tasfs rmuvp t4 lxoio totfmD  i o;() 2xmxm iodlmtnmfes tfsruaxmooo4aleo ociys sDrlnvs;u)tleoio todom eli i;(0trto(m oy4ameelnviltfsrtm(mp;u1alxomictytfa elums (4arxrxr to1laD au o;s0trtriopnu4amt mies s  Durxr ou1tpe io3iysfs2ulumo;t4areomf iy1oaD aueilt  2uo(m iu1apeelncils)aDrmxronu4tetnifeiytfsDem( p t0texnio3tatlaD luvolt tetrio oydol   ics s sDtaum ;u0oeen i3iatlaDrluvonu0 etrmo oadop e u s;s)t2trxm3oo4altnlnvs t sDum(m oo4olxnifeiydlaDea( sn(0 lxnmf to1om rlies (0srxriopoydamte fcs t)a2tm(m ou0aee iieiys m uanmpnt4texoir iy1faDraueol( srumir3ny4al n fcsas) 2ra(mp;o1oetomociytlm2rmnmo;(4aexoif totlmt livs;(  euoiopnudlp nlneils  Dua(  ot0olx io3iytlm elumsnt0aexrirciytlaD  ues;t  rxmio3oy4lmen net t artmur ;t1tpenmfeiatla eau s;u4trxnmocoytla rln o s s2to(o3no4altelfct tfa2rm(  ou0aexoifciydfaDrluvp t4aeerif oy1fm rlivilt0t2xmio nu1om nmnciatfsDurxm ot0tlxo fciys aDemuvo t)treomo3oodomtelivi;t sexmiopoo1am n fcta()aDtaxrooo0oexoii3tytls em(mp;u4 renifcoa1oaDelues t  exrxopnudlmte ictas)aDtru  ou1ape  f3iydla2uln s;u0aleoio3ia1lateli i;t  rxoxr3nydopte ict s srraurp;o1olt ifctysfs em(vp u0trtnxr3iy1fptelivi;s0s2trir iu4al emies ( s2tmu pot0ape moeild aDrmnvsn(0teenxo3oadfp ranvi;s0 2xmio3io4amtnmici t sDum( ont4texniocils a2rluvp (4 ltnmf3oydlpD  ivi;s0 euoxrpiu1ap  livi (  Dua(m nt4tleomociltfsDea( p;()tltrmr oo1fmt  i o ( trtr(rpoy4ole  fvtlsfs2umumo;t1tleoiicias sDrm( snt0artoif3oytla  ln o (0s2xmim no1lleemnetl( s2rmxm ;u1opt mi3tasfa ra(vo;u0arerircoy1oaDeauvo;t srtmim3ny4ol  mfvt (faDta( pou0tle mi3tlt s2ul(mp t)teeoir ta1fm r u s;()t2tmxr no4lmte fvtls  2ua(  no1aexn feiat a2ea(mo t) eenxfcoytlmt ai il( trtoxo3nudomt  iciasf rra(mpnu0alt  oeiys aDum(mont)altnio iatlate uvsls s2tmxo oy1op n nctl( arurx ono0tpeo fciadfa rmu s;t4alxrmr oydlp  aivo (  2uoir io1al n nviatfaDtmu  nt0tpeoioctydfsDrln o (4texnmo ootlmteau o;t) exoxr ny1lptemnvtatf Drr(r ;o4tetoif3iltfa2ua(vo t4treoir3ta1opD lneils  etmiopou1altemneia() Dua(r ou4aleo octat aDulu sn(0 rtomrcoy1fp r ies;(0 2uriopnudlmtn fct tf rur(rp;o0tpt ifetad sDum(vo (4aetrmrcoydfmD livo;t0t2xriopnydol n fei t srra(m no0tpx mocilslsDul(vp t)tlxnxo oa1lpteaies;s0texoxopiu1ap nlnesat)s2taxm ;o0opxo ietltfa ean p;t)trenmr3tatfm elivo;t)srurio oudamt lfeia() 2tmur ;o4alxnmoetyt m ulnvo u0tlxnmf iytfaDr nei;t s2um(rpnu4lmenmfcsls)srrau o;o1apxoii3tasfs2um(vsn(4tlxoio3ta1oaD livols srum(r3no1lp  lfct ()srra(rpoo0tlto o3ildlaDua( o u4 renxf tytomtraies;()t2xoxr ny4lle  ieslsf Drax  ;t1opxniocildfaDeau p u4 exrxf tydlatrauei t)setmir oy1amtemneils)arua(r no1opto ietatlm2emnvpnt0 renxr3iodlaDeau s (0texmio iudol  mnei s)sDtaxr ou1texomfetadlm emuvsn() rerio ia1fa eanvols0truoxo oy1lme liviatfsDrau poo1aptomociatlm2ean ont0tltnmocto1latelnes (0trum(rpoo1lm nlnciat)sDuru ono0tetnifciltlmDrauvsn(0tlxomf ootfaDeai ol() rtrim3nu1opeemnetlt  2raxm ou1openioctytlm2em(mpnu4 eeoxfciodoatrai s t  2umxo3ou1ll   fei t) Durum oo4aetnifctysfmDeauvp;t4aleoxo tytfp rli i;t)seumxrpiudomenmfcia()aDrrxmpno1tet mfciltls ua(mo u)tleoxf3iytopD  ivols0seto(r iy1opeemici tfsrrmxr ;o1aetoio3ildls ea( ont) etoio iotfptrlu i;(0seur(m3oo1lp e nciat srtrx p;o1tlt moeils a2ra(vs t0tltrif3io1lp e n i s)t2xmxo ny4apeemfes ()sDtm(mont4apxoiociat m2ea(vsn(4alxnxr tydfm  an ol() 2tr(o3iodlm e fei ()sDtmxmpot1aptn ictaslm2ul(mo;(4arxrir iotfp ran o;(0texmir3ny1opeelnvta(fs2ta(r ;o1aetn ietys a2umu p u4aetomo3iotopDe u s;() eto(o3oy4lmt mnci s) 2rrxm ;t0oltn o3ildlsDrlnvo (4trxomfctytfmD livo t)texr(rpiydopen nvilsfsrtrxmp;u4opxomoetlt s ul(vo t0 exnmrctadop e uvs;s  rum(o iy1lpe  ies ()srumu pnu4aexnmo3tytlmDem( onu4 rxrmociytfpDrlu s;()t2urxm iy4lmenmivsas)s2um(m ;u0tlenmieiyt m2eau p u0aeenir3oo1om elu sls0 rumxo3oo4ll n nvsls  2tax p;u1aet io3iatls2ul(mont)tlenxr iadomt  uvo s) rtmim3iu4om nmivi t srrmx oot1alenmf3tld s rlu snu4texnxf3iy1lp elivo s0s2tmiopou1lm e nesas  rur( pnt1oex  ociydlm2em(mp (0trxnif3oatopD  neils  eurir3iy4al n nvias a2ta(m no0apt io3iysfa2ranvs u0aeerifciytomt  ivols0setoxopno1lpeemfvi t  Dra(monu4aexn o3tatls2rl(ms;u4aleoio tydoatelieilt0truoiopiodlpt mfvt t)arurxm no0tet mi3iysfa2emn s;t4alxnxfcoatfptelivo ()sexr(m ny4lptelfctlt a2umumpno0tex mociytfa umn pn() rtoxocoy1lptrli o s  ruoxm3ou4omtnmictls) rrm( oot4aee  oetlsfm2elnvp;()altomociodfm   ieo t) 2xr(r ny1om  lfvtlt)sDuaxmoot1tpe ioctyd a ra(von(4 etrmf ia1lpDrluei s0setoxm3iudalte nviatfsDur(rpou0optn octad s2eln s t4 rtrif iydomt aies t)srurio io4ll nmivi ( sDrrxr ;o1tpxomfctatfa ulnvp;t) etrmo3oadlmtelivsls)t2toxo oydaltelncil( a2rr(mpoo4tetnmociat s2el(mont)teerxf3oydopt  n o;( s2trxo oy1lmenlnesltfsDrmx p;t0apt ifctad sDrmumo t0teerif3iydlmte u i;s  2toxm iudome  neil()s2uaxrpou1olt  iciys a2ra( o ()trxomf oy1oaDr ieol() rto(m oudlm   ictat aDrmump;t4tpt  icias a2emnvo (0tleomo3totlmD aneil(  2trxo3ou4aptn ivil() Drr(ro;t1tlxn f3ildlsDeauvo;(4tleomr3iydopDr ueo () exoio3iydaleelivtas s2tmx poo0tpt iociat s2rm( p;t0aleomr3ootlpteaivol()teto(m3oy4alenmfesatfartrxrooo1oeeomi3iydfs2eanvsn(0 lermrcto1fmD luei ( t2to(rpoodam n nctasfa2raumooo1alxo fcild m2ulnmpn(4aeerif oodoa   uvi s trxrim ny4ameelivs ( aDumu p;u0opt  o3tyd m elumpn(4trtnirctadom eliesl()seumir oo4lmeelivsls)srtrum ;o4tpe ifeiltlmDraumo (4 rerxf3iodoa elu o () etr(m oudllt mnciltfarrr( pnu1tlx  oeilsfs umnmp;t4tetnif oa1fa rlnvi t  2tr(o3no1ope mnci s a2rr(m ;u4apto octytlm2um(mp;u4 lenmf ta1lp rauvi t0trtoiopiudope lfcils) rtaxr ;u1oleo feiydfm rl( on(0 etnxr3iotoa eln o s0 rtmxr oo1lmen fvi sfartr(m no4alx  f3ildla uluvs;u0tltrmr3oytomDraivsls0teurimpiydomenlfeslt a2uaxr ot1alto oeiyslm2el(vonu4 exnxo oodfate nes s teuoir ny4am emivta() Dumx onu0tltn octyslmDraumo t)texomr3iodom r ivol(0 euo(rpio1al   nciatf Dumx p;t0ole ioctasls umnvsnu4 rxrmf3tatomDrlneo;( s2uoxopny4oltnlivt ( artaump;o0oltoii3tat aDum( p () rtrmf3tytoa r uvo s0 rtm(opnodamt lnciltfs2urxrpot4aeeomo3iysfsDua(mo u4tltoir3ty1oat aneo;t) exr(m3oudomt  fcsltf rrr(ronu1olenio3tydfsDuluvo t4texomf oodlm e neil()tetrxrpoydopee nvi s aDrmx ooo4apen ictadls ranmp u) lenxoctatlatelivil() rur(opiy4lp nmicsl()s2um(rono4tpenio3iydfs2uau p (4artrmociytfatr nes;s) etm(rpoo4ol  lici ()aDumx ont1oltoif3iyd m2umuvo t0 rermfcootfa rlneols) 2to(o oudlle miet sfsruaxmp;u0texo fciydfa elnvp;t0 lenmfciydomDraivo ()teurio3io1lm   feia( aDrax o;u1alx  oetyt a2rmumsnt4 exoxrciatop  auvils0 rxo(o3iu1omtnlnct t) Dtaxm ;u4olxn f3iyd m rlnvo u0teerirciydopte n i t teumxrpnu1om emncilt)sDumum no4tptnmieiytlm2emu ont0 renmf3oatoptr ieo s)trurxo3ny4opee nvt () Drr( pou0aex ii3iltfs ua(vp () etrioctotfpte u o ( srtrxr oy1omenlnctls artaur ot0aleo fetyt a eln o;()texnxo3tatoaDr uvslt0s2ur(m oydoltnliesat sDururpot0aet iocildla2emu onu)trxnxfctatoptraivslt)trtrio ny1lm  lfvsl() Dta( o;o0opx mi3iydla uaump;t) exoxo3oatlat  nes;s  2uriopoudlm n ivtas  2tmu p;u0olx mieilt aDum(ms u0teenxf iotlpt  nvil() rxm(m ou4lleelietlt)sDra(  ot1ale mi3iadfa el(vs t4 rerif iatlmDelivs;s0 2to(mpou1omtn ivs tfaDrrx pnu1oet moeiys a2eluvpnu0aexnmociytfp  anvi;( s2ur(rpno1ol  mncias sDtrx oou4ale ifeiysfs2elu pnu0aetrio3oodop   ies;t  rtrio3io4olee ivslt) rua( poo0apxnifciadfm rlums t)tetoifctydla rauvo;(  euo(m3oo1alee nvtatf rtru poo4ole mfeiasla2ea(vo;t) rxnmf iadomDr u o t0trurxopiy4alenlivi tfsDurxm ;o0tptomoeiysfsDumu pnt0 renmr3todlm eai o t)t2xmio3iodam  lncils a2uaxm nt1oexo o3iysfa2ranvp;t4trerxrctadlpt lneil(0trtmio iu4alt lnvia() 2uaxm ot4tetomfetas mDumu o;t)aetrxr3oytlmDelneo;()s2to(opoudalt micias) 2tm(mono0alto f3iytls2emu s () eeoio3iytop r nes;s truoxr oo1lle mfvtl( arumx  ou4ope if3ilsfa eluvon(0tetrxocio1lat luvilt) exmxo3iodlm elivtlsfsDrmx oou1tpeo f3iad sDuanvpnu4artrio tydlatraivi s  ruoim3iudaltelnvt t a2tm(m ot1tpeo feiadfa2rm(vo (0tetrmf ty1oaDraiesl(0 exoxm3nudlp  mnesl(fa2rmx  ot1oeenmf3tlslaDuau o t0tlenxfctytlat aivi ()srtrxr3oo1apt  nes s) Dum( p;u1olxomo3iad aDrauvs t0 etoif3iatfaD aieil()texo(r nydomteliei s aDtm(mo;o4apxomieiydlmDumumo (0altomr oatoaD  uvol(0 euoir oy1op nlict tfarrru ooo0olxomf3iyt m2uluvs;u4 rerirctadfpDr neils)t2trio3io4lp elictas s2rmur oo0tle ioctasls2rl(mp u)tleriociytlpD  uvi ()srxmxo iudllen ivtasfsrrrurpou0tlen o3iyslmDel(vpnt)arxnio oadlat  uvs s) exr(m oudope lfeta()arrmur no0oetomictydfmDem(vp;t0artrxr io1la eanvs t srumxo nudlleemivia() 2rr(ro;u1openmf3iltfsDemnms u0trerio oadomDe uvs t) eto(m nudal emnet t  Dur( pnu0oexomiciat m ua(vs;t0trenxo3ia1fpDe ivi s trxr(m oy4lltn ietat s2umxr ;t1texoif3tytfs2rlnvpnu4tltrirciydfa r i slt0 exmio oydlm e fviasfs2tau pnt1tleoifetlsfmDraums;()altomociodlpD lu sls0 exmimpio1omeelfcsls aDuauroou1tleoifetadls ra(vp;(4texrxfctydopD auvolt) rtrimpiy4ape lfvt (fsDtau  ;t0oleomfeiyt s2emuvp;u4 rtnio3tadlaD  nvs s texmxo3no1amtnlfvtlt aDum(r nu1aex mi3tlsfmDumuvpnu)altomr3tydoa eaieo;s  etmir oydap nlivi tfsrtm(mp;o0oexnifetldls el( o;t4 rtnxo3oa1fatran o (  2tmirpny4omenlics sfsrua( pnu0apenifeild s2elnmpnt4trxnmf3ta1op e nvs;t0 ruo(m3iu1alte fct ()s2urx ont0aex ioeiasfsDrmn pnu4aeeomf tytom r nvsl()t2xmir3oo1lpee fctl(fsDuaxmo;t1apenio3ias a2umuvsnt0trtrxf3ootlm   ieo s  2xr(opoy1ameemnctl()a2uaump;t4oeenii3ilsfaDrm(vp ()aetoxo3totlmt luvs t)s2umim3oodom nmieias) Dtmur ;u1alt iictls sDraums;u4 rxoir3oydoptr nvo ( srxoir iodal   nvt ( arurx pou4aeto ictaslaDulumo;t) rermr iatopD lnvi;(  etm(m iydlptelfvils)aDraxr ;o0opt moctaslaDuanmo u0aetrxr oytlmD auvo;t0tetm(r iudopenlfvta()aDuaxr ot1oeen fciadls2eauvs;u0treoxf3todfp raiei;(0trxoio3oo1oltnmfetat aDrax  nu1olen f3iydls rlnvs u)tltoif io1la rlnei;t t2xo(opny4alen nct tfaDtaxmo;o0tltn ieiatlaDea(vo t)tltoxr3todopt  u ilt)srxoxmpoudlltemivtl(f rumu pnt4alt  feiys aDra(vsn(4tetrxf3oadoaD luei () rxr(r iu4optemictl( arra(  ot0oetnmieiatfa ul(mp;t4 exrmf to1fa   ues;s)s2urxr iydlm emnvsatfarrrumont1ale io3tytfsDuln p;u4tlenmrcoadfp  auvo s0teuoir3nu1ameeliviatfsrrm(rpot4tpx mi3tydfmDul(vo u)treomf oytfmtr n s t0 exm(o io4ol nlnes sfsDtrx oou4oltnifetatfmDrlu p (4 reoio iy1op   nvols)t2trim3iy4optemivt sfsDua(rpnt4openioeild aDulnvo ()teerif3iodomtraneol(0srumxr oo1lpeemnvil()aDtaumpot1teeoioeiys sDel( p u0trxrmfctotfpt lu i;()t2xrxr ou1olt lnvs (f rtrxro;u0tlx mi3tadlm eluvont)alxnmo tatlmD lneilt0srtr(m3no4oleemietl(farumu ono0tpxniocilslm2ul(vo t4 ltnxf3oatfmD  i i;t)sruoxo no1ll emnvtatf rraxm no1aet  i3iatls2rlump t0 etnmo totlmDrai s t teuoir nu4ap n nesas s2rrx ont1olxomieildlm2umu snt4tlenmf3ootoaDrauvsl() rtrxo3oy4amen nvtas  Dur(rooo4oetomi3ilslmDea(vo u0altnxo3totfpt ai sls0trurxm3oy4lptelnctlsfsDurumoot4olenioctltfs ul( s t4 ltrxfciydomt au s;s teuoxopou1al n fct t)s2rm(r ot4ope  o3iyt s rauvpn()aexnxo3iy1laD aivils trtr(m3nudlp   ictatfsrtmx  no0tle  ictlt mDeaumo;()tetrmr ootoaD  u o;s0trxrimpou4alee nesl(fa2rru  ot1tle mfeilslm2el(mo;(4tltnmo oa1optran olt)s2xoir nudop n ivia()arrrx pnt0tle iieiasfa ran p;t4 rerif to1lp e uvo s0srtrir3iydlm elieilt srrmum nt0tetomfctldfsDrau p;()texoxf3iotfptrlnvi t  eum(r3iu1olt  ivi t  Drruroot4opxo ociys aDrm(mo u0tltoxrcoydlatrlivi s0setmxm3oudapen fvsls)aDta(m ;t4aee  oeiydls2eanvo (4tleomo totomt  ivs s)srtmimpnodlp nmnvia(fa2taxmo;u4tee ioeiytfm ulumpnt)tleomr3todoaDrlnvs;t)t2xoxm ny1omtelnci t)a2ua(ronu0alx iociytfs2rmu o;(0 leomr3iadoaD  ies s)teumio no1omtnmfvsa()sDta(m ;u1oltnii3ilt s2rluvp u0tlxrxfctytfat  nvolt) rur(m3oy4aleeliei t)srum(mpou4aptoioeilt a ra(ms u)tltomf iotom rli s s) 2ur(r3oudlm n ivta(fsrtm(m nt1tpx iieiyslaDran s t0tlxrxocty1laDean sl() 2xrim3nydlp  mnetls aDta(m ot4oeto i3ias sDeaumont4aleomrcoo1op raueo ()srtoir3oy4llenmfetasfsrtmuronu1tpx  ictydfmDumuvp () rxrxrcia1fmtraneilt0trurxopnu4am  lnvsatfsrta(r nu4apeoiociadfaDumn o;() rtnif iotopD aueil( trxrxr3io1ame mnviat  Dtau pnt0opxniiciydls uaumsnt4tlxoxociytfm r i i;t0trurxm3iydll emivs tf rrr(r nu0texnioeildla2rmn snu)altrxo iatlmD  ieils)srtm(o oudop elivt tfarrr(m ;t0olx iicildla2ea(msnt0aetnxf oodlm  aneo ( texr(o no4ame lfci ( arumx o;o0aptnif3iatfm2rmn p u) ltomr3totfaDr ueils  rtmxm ou1oltnmfcilt) Drmur ot4opxo ieilt s emn p u0 lermfciadfat an s;s0setoirpnydlptn nvt tf rrmxmo;o0aeen iciytlsDraumo (4aeeomo oadomtelivs;()sexoirpnodome lfciatfsDtaxmp;o0tlt iictytfm rmn o;()trermo totfaDeauvsls sexmiopou4om elnetlt)artmu ont4olxn ieias aDra(mo;u4 lxoxf oydfpt  ivi (0seuo(mpiy4llt mnesa() rumuront1tleomieilsls2ea(von(0teeomrctadlat au slt0 rxrxrpiydomtelfctlt a2urxm ;o0tpt  ietaslaDrlnvo;t0aexrir3oytlmt livo;( s2toxrpno1aleemietl( aDumxmpno4ope iietadls2rl( snu4 rxrmf3ia1lpt aues;() rxrimpoo4omtnmivias  Dururpot1ale moetytlaDul(vp ()aleoxrcoo1fptelnvolt0s2umxr oydllenliei s a2tm(mp;o4apeoii3ils a ra(msnt4aetoio io1lmt  ues t)s2xo(rpoy1lp n fet (fsrururo;u0ope  fetytlm2emn p;t4 exnifcio1late nvo ()t2uoio3iydoptn feta( s2rmxroou1aet iicils sDua(mo;t)tetnifcia1lat au i;t) 2toio no1lmtnlictltfsrtr(mpnt1oet mietld s2ran sn(4 lerxf tatomtrai s;s) 2urir3no1ol   ivs s) rtrxrp;t0oeeomietadlm elums t4trenmr3to1lpDeln ils0 rtr(o3io1opeelnvsltfs2tmxrooo0optoioetldls2elnvo;t4arenxf todomtraivol(0 rto(m3oy4llte nci tfa2raxmp;t0tpxomoeiyt a rlnvonu)tlenir3iadlatraueols0texm(m iu4lm nlncta(faDtmurooo4aex iieiatlsDrluvpnu4 rtoxo tatlatr uvs ( trxm(r3nodoltnmfvtat s2ur(ront0altomo3tytfaDelnvsnu)tltrmf iydlaD  u o (0 2to(m nodaltelnet t  Drauroou0oetn feiytla eauvs (0altoio ta1fp rauei t)s2uoxo3oydope mnesa( arumx p;t0oex  iciytlmDul( snu4tetomociadfmte iei;s0 2urxm3iy1omt  ieiat)srtr(mpnu1alt mfciyslm um(mon()trtoxo iydlate uvi s0 ruoxo nodap nmivs sfaDrmumono4opeoiocildfa2um( pnt0 etnif3io1oatr u i;s)trxoir3iu1altn ivta()s2rr(ro;t0optn ieild m eln o;t4aexoir3tatlm  lies t  etrxmpoy4om elivsatfs2raxrpot1oeeo oeildfm2ulu o;()tlxnio3oo1fp  anvil( s2xo(o3iu1ole  netl(farrmur ;o1open ieiytfs eanmp ()trtoxo3iotoaD  neo s0 rtmim3nu1lm e icsl(fa2raxmont4aet ifeiatls2uln o;u0 ltoif3ty1fmtrauvo;()srtm(m iy1omtelfvtat) rtru oou4olen f3iad m2eanmsnu0 exomr3oydlpt  uvs;s t2umxmpnodom  mfvs s sDumu  nu4oltoio3taslmDrmu s;t0texoir3oatom eau i;t0trtmio ny4lmt mnct s srtru pou1tee mfeiaslsDranvp t0texnxr3ty1lp e nei;t0 eto(rpno4altnmfvt (  rrrx p;t0tptnifeildfaDrmuvon()areoxo3tadfpt  uvils)sexrio io4opeemncsl()a2uaur nu4tetniiciydfa2eau s;()tlxoxr oa1lm ranvolt t2xmim iu1omt lnviltfsDtmurp;t4oetn o3iytfs eln p (0 lermociodfp eau s ( truoim3ou1ape livslt a2ua(mpnu0aleomfeiytfm eau p;t) lxrxfctytomDe n i t) exrio3oydom emnci t)aDrmumont0alxn o3ilsla2ul(mpnt4 rermrctatlmDeauvs;s  exoxo iy1lpen ivt t)sruaxront0tpeomi3ild aDrl(ms u0arxoxrciytomt  n s;t0 rtmxo no4lmtemfvsl(f Dtmxrpnt4ole mo3ias s el(ms;u)trxomocoa1om eai i t sruoimpiu1om  lneiat) 2tmxmono1tlxomiciasls2ulu o t4altnmr3totomDr nvi;t  rum(m oo1al   ivsl(f 2trxm nu0apxo f3iysfa2umuvsnt)trtnxf3tadfmt aues t0 2uoxmpnu1amtemiei sfa2rmur nt1oet  ociat sDrm(vo u0texnir3iytoat an ilt)s2xo(rpiudll  lnes t) 2rr(mp;u1altoiieiyt a rmnvs;u0aetoio oo1lp eau sls0tetrir oy1olt lfvsasfs2umx o;u0optn feiaslmDelnvs;u0 exnio3iatlpDeln sl()t2tr(r iu1lmtelicils) rrr(rp;o1texomfeias a rm( pn()tetrmf ty1lmtr nes ()t2uoir3nu1omeemfvilt  rrm(mp;t0opxo ieiyt mDuan s u)tlxrmf tadlp rluvo;t t2xr(r3ny1al elict t aDtmumo;u1ale ioeiaslsDraump t4 etoiociadlm   n o (0 2xmxo3iudam  lietl()aDtmumpoo0optnii3iasls uaums (4 rtrxrcoo1laDrlueo;s teumirpno4apeelfcia()s2tru  no1aptnmiciadlaDua(mp u4areoxociotoaDeln o;s0s2urir no4lm nmfetl(faDtr(m ;t4oltomi3ild m um(vs t0 exoio iydoaD anes;t srtoir nydlme lnvilt  rrrur nt0olxomociyd a2uan s;(0 exomr tadlp rluesls) exmiopoydaltelnvslt s2uau  ;t0apeoifeiasla2uln o;u)teenio iytlmDr nvs ()srxr(m iodap n ieia(  2rrxmono1tpt  o3iyt aDuauvp t4 etrio oo1oaDrai sls  etmirpoo4olt mnesltfsrumurono0olxo fciadfa em( p (4 rerxrciytomtr i i;t0trxrio oy4llt  fei ( a2tmump;t1olt  fctydla um( o;u)texnxrctadopteaivs (0s2umir3no1openlietl()sDra(moot4tpxo f3ias s2rm( o;u0aexoxf3oydomteanes;s  2umxo oy1lmenlnci (  rrr(rp;o4aexo ieiasfs2umump (0 rxoif3tatlpt au s;s) exoxmpiydll nmfesas)aDraxrpnu4tpx mi3iatls2umu p;t)tlxoxocty1lm eauvs;s srxr(o nu4lmtn iesat a2urx pnu0oltnio3tad a2emuvp ()tltoiocoa1opD li sl(  exmxrpiydll  lfctl(f rrmxroou0tltomf3iydla2ul(mo t)trxrxociydopt  u i;s) exoxmpiodap   nvsltf Dtrxront4oexnmo3ias a2elnvo t4texoif3iotfmD lu o t)srxrim3ou1lmen ncsat)artm(mpot1opx  fciyt aDem( sn(0artnmo3tytlm rliei;() rtoxopny4ap elfvsa(fartmumpnu0olenmfeiltla2elnvp;()artoxocia1lpDr ivo;s0 rtm(rpoodamee iet s  rtaurp;o0tlxoif3iysla rm(ms;() eeoif io1op e u s;()s2um(m3nodalt  feta(faruru  ;t1tltnii3ilslaDumnvo t0aeenmo3ty1laDelueilt0sexmio iy1optemnvilt aDtmx  ;u4oex mo3iys m rauvsnu) ltoirciydfp e ueolt)trxm(m3oydaltemfvtls srtau pou4opx miciad a2em( o;t4aetnmrcoa1la   nvo;s teuo(o nudll nlnct t  rumxrono1optoifciysfaDemumpn()trerxfctodoa  an s;t0seuriopiy4om nlfcil(f Dum( pnt4tee iocias a ulnmo u)trxrif3iy1oaD anei s0teuoxopiydale mnctl()aDtm(rpoo4teto fciadfmDem( s (4aleoxr ta1opDeau ilt0trtmxr3no1apt mncta(f Dtmu  no4oex iicildfm2elu o t4aexnmoctatlm  ai s t)s2xoxmpny1llte fvt t a2urx p;t4tleo ietadfs ulumont) reoio oatopDelivi (  rumiopiudalt  fcs t)s2rr(roou1olx  ociad m2rmnvs u0alxoif3oo1fatraivi;(0 rxmim3nu4olt livtat)sDumxr ;t1tee ioeild aDul( o (4trxnircty1opDrauvolt  2xr(rpiodll nlfcs t) Dtauroot4aptoifetat s uanms (0texrmoctodoaDrlieols tetr(m3oudolenlnei t arur(rpoo4optnmociadlm umnms;() rxnio ia1oaDraneilt)srum(o3no4lleelfetltfsrtmu oou1aptn i3iat a ean on(4aleoxo3iytoa rlneo (0setmio3nudol n fci s)a2rr(r oo4aex mf3iatfaDran p u)altrir3tydfm raneols0 rtmxm ny1lp  lnetlt aDtm( oot0apenifetad s eluvpnt0aeeomrciodlmD  ivil(0s2to(o3oudomtnlfetlsfs2taump;u1tlt moctytfa rl(mo;t0trxrxr todoaDr ivi s  2to(r io4alt lnci tfa2ua(m ;o1tlt ifcias a2emnvo;u)tlxomr3oo1lmt  nesls0 rxoir3nu1ope lfes s  Drau  ou0texn oeiys a ra( s;t4teeomrctydomtrlneols) rxmxopoy1om eliei ()arua(mp;o0opt ioetls a ua( o;u0 eenir oatoa rln i;s setm(mpio1om nmfvi ()a2uaxmpou4tptnio3ild sDuanvs u4 eeoxf3oytlmD  ivsl()s2ur(r iodaptn fvsas)artrxm ;u0tlx  icilsfa2elnvo;u)aeenir3todoaD lnei t0 2tr(m oo4amt lncta() rrrxmoot4tet mietydfmDulumsnu0 rxrxf3tadfaDelneolt seuoio3nu4ome lnvs (f rtmu o;t0aleniicils sDrmn on()altnirctadopD lu ol(0texrxm ou1ole lfei (fsrua(rono1aeeomoeiydfmDumnmo ()altnxo iotlp rlivil( s2xr(r3oydlptnlics ( sDuauroot1aexoiiciytfaDuauvp (0tlxrxf3iytfat lnvs s0trxrir3no4amte nvsas)sDtrurpno4apto o3ild a ea(vpnt)alxrxr3tadoptr n o;t) rtrxm oodomenmneils s2rru pnu1tee ifeilslm2um( pnt4 rtnmf iydomD ln o;t  etmxr3ny1om  lfet tfa2tmxmpno4oee ioeilslmDul(von()altnmr oo1la eluei;(0setr(o3oudam nlivtat)srrrumpot1ole  iciytfaDuanvs;t4aeenifctytlaDeai o (0sexmxr3ny4lpt  fvt (  rta(mp;u0oee ii3iydls2ra( pnt0 eerir oo1oateanes;t0tetmxr3oy1lm  livi s aruau pnt0alt  i3tyd s eanvo;u4teeomr tytopt aneilt) rtr(m iu1oltelicsl( a2rmx  ot1alxo iciltfsDrlu pnt)aetrxo3ta1fmD au o s0s2tm(mpoudalt mnvt t) rum(  oo0alt moeiat s umn s;u4 lxoifcty1fatean sl(0 rxo(r iudoptemnvsat  2trxmo;u0olxoii3iat m umnvo;u0altrmocoadfate ies () 2xrim iy1lltnmies t)aruau p;t0teto fetld a2em(vo;(4tleomf tadlpt  ueils0s2to(r oo1lme lnvtl(  2ta(m nu1teeo o3ilsfa2rm(mp u0tltoiociodoptr ivols0seur(rpoydlpeelneil( sDtr(  ot4aetoiieiasfa emnvo u0aetnxr3tytopD aies;s t2uoir nu1alen ncils sDtrxr nu0apxnio3iydfmDeln s ()alenxr3ootomD aneilt0teum(m nu4apt mnesasfa2rmumo;o0opxnmictysfm2ea( s t4tleoif3oadopDeaies;s0truoxr3nu1olenlfvi s) Draxmpnu0oeeomoeias mDumuvs;(0 lxnio iydoa r neslt0s2tmxm3oydoleelncsls  2uaxr nt4alxnii3iltlsDem(vo t4alerxr ia1la   nei ()trxr(r oo1olt  ivtatfsrra(m nu4tleo fctas m2em( s u4aeenirciytlptrlnes;(0t2xoxo ny1ol e ivils a2tm(ro;u1alen ietytfm2ranmpnt0artrmrctotlmt aivo;s)trtoxm3oo4ap n fcia()a2ta(mo;u4opxomiciysfsDumumsn(4aexnmf iodoate n i;t t2tmxr3iodlmtemivtl( s2trxrp;o1opx iieiytfmDrlnms t)altnxrctatfpD aues s0srtmiopiodop  mfeil()artmxmp;o4tpxn feiydla um(mo t0trxnmr3tytopDeluvil(0t2xm(o3oo1al n ictl(  rrrurpnu0tetnmfeiaslaDeau p (4tltrif3oadfmD aivo;(0 2trxo iodolt  ivi sf Duaxmp;t4teto i3iytls2um(vs;(4trtomo3io1lmtr nei;s)tetmxm3iy4om  licsl(fa2rr( pno1opt  icilsfs2umnms;()aeeniociotlaDeln o s  ruoirpoy4llte fei (f Dtmx  nu4tlxnioctadfa em(mo t4 reoxo3io1fp e nvolt0s2umim3iydomeelfet s arra(r ot0alx ifeias mDrl(mp (0 ltrir3iodla elivi t t2xr(r3ou1lpte ivsl()s2rm(rpnu1optoif3ilt a2ea(vo;t0areoifctytfmDr uei;(0t2tmim3nu4opeelnctas sDuau o;o0tle ioeiytlaDemumo t0 reoxr3oo1faDeauvi s0teuoxm ou4ol emnctlt  Draxmp;u4apeoio3tadfa el( p () lxrxrcto1op e u ol(0 2toxrpiy4ll elnvta( arumxr ;t1olto ociasfs2rm(vont)trxrir3ia1laD lu s t truoxr oy1lmeelfvias aDrmxm ot0olenif3tlt mDeluvsn(4 rerio tatop rlnes ()sexrim io1lleemivia(f rurxmpoo4aetoifeiatfaDea(mo (0 rxrmr tydlmD anvslt0t2xoxm3oy1al  mnct ( srtr(mp;u4apt  i3tadfa um( snu4texomo3todfaDelueo ( sexr(m iy4ol n ivta(farraur nt1opeo oeias mDeanvonu0aexnmfciydlm eaueo;t)trumio ou4ll  mivslt a2urum no4oeenmi3iltlsDean o (0artomocoo1fm   ivo;s texrxm3ny4lp  lfvtl(  2rrx oou4tlx mocilsfs2rlnvo;(0aexnio3ta1omt aivs;s) euoxo iu4optnlnvi s)a2urxro;o0aexniietldfsDrm( p;t0 etnmfcoa1lm r ivs;(0srxo(rpnydomtnmnci (farur(mpoo0alxnmfetysla2em( pnt0trxrxociydoateanvo;t) rtrxmpiu1om n ictl(f 2trum ;u1optn i3tysfs uau pnu0teeoircootlm eliesls setr(mpoydomtnlfcia( s2um(mpoo4altnifetlt s rl(vsnu0arxnio3oo1fpDr ieol(  rtriopnu4lp   neia(  rta( ono1tpxn oetysfa2ea(vo;u0 ltnmr3oatfm   neo s trxrxr3nydap  mnesat aruaxronu4alen i3tas mDuau pn()texrmo3iydlm r i ilt0srxmimpnu4llenmfetas) rtaxrpou4oet  iciys m rl(mo;u0 ltrxo iotfpDrlivol()s2tm(o nu4oltemnvt (faDtaxmpno4apxoioeilsls2rmn s;(4 exomrcoytfpD  ueo (0t2umio oydlmte nvs (fsDtaurpou0opx mfeiad s2rlnmsnu)altniocoa1om eaues;()texo(rpnu1apen nesl(  Duaumont4apx if3iltlaDemuvo;(4trtnmrcoodlat aieolt) exriopny4lpt lnci ( sDrrx ont0teeo ociysfm rmnvp t4altnir ia1fmDrluesls0trxoio io1lm e nct s  rumxr oo4tee  fctad a2rmuvpnu4aexnxo3ootlpDelues s srxoxo oo4amtn ici t) Duau pno4opxoifeias s rm(ms t4altnxo3iy1lp   ivi s  etmxrpio4opt  feta(  Dtr(mo;t4oeeoiieiyt m ranms (4 etrir totlm eaiei () rxo(m3oodal  mieslsf 2taxronu0olt iietlsfaDumnvs u)artnmr3tatlmDeanvo;s0s2xoxmpoudlp elnes tfsDrau  ot4ape  feilsfs2raump ()trxoxociydfat livs;s)tetriopoudlp   fetls arrmx  no0tpx  o3tasla2rmu snu4arxrir3iydfmD lnei;t) etr(o iy1am elnvsl()aruaxrpoo1tlt  fctysfa2um(vs;u0alenmf ia1la   ivs;(  2toxopiodlmt lfvtls)artru  no4tex ioctasfm2rmnvp;t0tlenxo tydfa  aivil(  etrxo3iy1amtelfcsa(fsrrmurpnu4apxo oeiatla2um( p u0 lerxf3iydoaDelnvi s0setrxo oodolee iei () Dtrxmp;u4tltn fcilt s2emu snu)altnifciy1lmDeai s s)s2tr(o iu1lmtnmfesat sDtaum no1tpt mieiatfa eauvp;t) eeoxr oatfmD  uvols)trxm(o3nu1omtemnvils  2rau o;t0tlx mictas a2rau s (0trtnif ta1omDrln s ( t2um(mpno4am e nvslt  Dtmum nt4aet  octad a rmnmp;t) eeomo iadlaD aueilt)trxmimpno4lpe  netlsfartrxr nt1oltoii3tatfm2rlnvp u4tlerir ootfptrluvo;s0s2urxr3ny1oltn iviat)s2umxmo;t0teenmi3tad s2rlnmp;(0trxnxr3oadlptrai s;( srum(rpnudlme mfctat) Draxmpot4tetoio3iadfaDuanmp t4aeeomocootlmD  nvsl() rto(o3iydllt mncils artauro;o4tlxnioetldfm2um( on()trenxo totla eauesls  etrim ny4oleelivi ()arumu ono1tleoifetytfm eau s;(0 rxnmr3tatopD  nvs;t) 2tr(r3iy4ap  lietat aDtaurpot0tltnioetatfs eauvp;t4texomo iodoa eanes;s)setmio nu4lptnlnctlt)a2tmx  ot1tlenmieiadfs2rluvs;u4tltnif todlm   neols) exrir3iudaltnlies t)s2rr(ronu1aptomoeiytlaDuauvs (0alxoxr oy1fmDraneil(0s2xoiopoydlltelneils)srum(mp;o0tpx  i3tltlsDumnvo t)trermfcoatlmDrlues s0 ruoxm ou4ll elics s)srrrurp;o0ole if3tad m2ean p;u4trxomo iatlm ean s s trurxrpoudlpt mieiasfsrrrur ;t4oexomoeiad s rl(mo u0arenxo oodom  au i s teuoxrpno4lpee netl( s2rmxroou1tle mfciadfs2rln s t0 eerio ta1fpD anvs t s2xo(r3iudoleemivsa( a2tmu pot0aee ifeildlm ean sn()arerio3ia1faDr n s;s)teuoim nodap emncslt)sDurxmpno4apxoii3iydlsDumn s;u)texoif oa1opteli i (0srxr(m ou4om nmiei t  Dua(m ot0alxo fctyslsDea(ms;t0tlxnif oadoateaueils  exr(m no4om  lnviatfsrrm(rpot1tpt  oeiysfm eau o t) lxnxo oytom rln i s0 exoiopny4optn feia()artm(m nu1tpeomiciydfs2umu p;t0teermr3todfatraivols t2uoimpoo1ale  nesls) Drr(ro;t1olxnmieiysla2um(mon(4 etomr3oa1lp r nei s srtrxo3nudopeemnvt t) Dtaurp;u1alenmfeiltfm um( onu0 exnmfciotfmtrli o s  exo(m3iodlm  mnvia(fsDtrurpot0apx  f3iasfaDeanms u0 rxnmo3iatlmDelieo ( tetmir iy4omen ivia()sDurxmpou0oleo o3iydfm2ea(ms ()tltoxo iy1lpt  nvs ()trtrxm nu4omt  ncsasf rrau oot0opx  ieilt mDemums u) eenmo oo1lm  lu sl(0srxrir3iy4alenmiesa(fa2rmxrp;u1aet mfeiadlmDel(ms u4 etrxf3oo1opte neo t sruoxm nu1ap nmiei t  2ra(rpno1tlxnifctysfs2el(mo;(0 lxrxf io1opt an ilt)tetoimpiodap elivsat a2rm(m nu4tpeniicils a2em(vsnt0texnmocoodfp rln ol( trurxr nu4am n nctas) 2ra( p;o4oexomfctld a2ranvont) leomo ta1omte ivil() 2urir3oo1omenlnvias  2ta( oou0alenmi3tat m2rln s;u)trtoir oodlmDe n i;s0setmxmpiodop elncsltfsrtax  nu0opxnifeiltls uau s (4arerir ootlp r nvo t0s2tr(m3no4amee ictlt sDtaxrpno4tpe mociydlsDua( snu0artomr ty1om  lu ols  rxrxrpiy4ol   fesa(faDuaxr ;t1oexnmfcilt m ua( s;t0trerif oa1fmDeluei;s0 etoiopnodal  mneils) Dtrurono4olenmoctydfm um(mpnu0areoxfciotlp r nvo t0sexoxrpno4opt  neta() rtrxmo;o4aptomoeilsls2em(mo t0alxrmr oa1fp r uvo;t0setoxopoo1ope mnvta(  Drmumont4alt ifeils sDuanmp u4 eeomf ta1lpt  u i;t)sexoxr ny4amtemivilt  rrm(  ot1tpenmieilt a2el(mpnt0 lenxo3iodlptr u ils0 rum(r oodomtnliviltf 2rmu o;o1tpeo ietld s2ul( p;u) eenxr todla  aies t)teto(m3nodaptemnet sf Draxmpou4tltn oeilsfs2rm(vpn(4 reoxf3iydlpte ueo (0trxmiopoo1lp e fetltfarrmxr nt4aleo fctat s uanvonu4 exrircoy1fpDeln o s srtmir oydll n fvia()artaxmo;t0olt  fciyd m2eauvs;()artoxocootlaDeanei;( srtoxopny4am e ivs () rrauro;u0olxoiociatfa uluvpnt0aeeoxr io1lm rln sl( texmio io1optn fvia(  Drmxrpou0ope  ietatfaDel( s (4 ltrmr ta1fm rln il(0srumiopnu4ap emfvilt srur(ront1ape  fetyt sDulnvp;()tetrir ootfaDraivs;s) eumxrpiydamtnlfcias sDtaxm nt1olx io3iys m rauvpnu4arxoif iytomDr uvsls0teuoxr no1opee fei ( a2rrxr nt4tpe mfciyd sDranvpnu4 rtoiocoa1lm rluvi;t0 2xrim3oy1ape liesat  2tm(mp;u0altn f3iydlmDulu o t0 rtrifcoytom  auvolt0sruoxo3oydlp emiesls s2uaurpou0olenifctysls2el(vp;()tltrmf oodop rlies s)srxoir3nodlp emnci (  2rmxrp;t1aetn ociatfaDrlumon(0trtnif3to1optrln i (0 rxmxo nodamte ictltfsDumu o;t1tptoiiciatfsDemnms;u0tltrmfctytfaD lueslt0 exm(r oo4aptnmictas  2tau p;o1optomoeiltfm2rmnvo t0trtoxo3iotop   n s;t0teumxr nudoltemivilt aDra( oou1tpto fetat m eaumonu) ltnxo3iotfm eau sls t2urxo3nudlmt liviltf Dum(moou1tpxoioeiatla ulu onu0altrxrcoodfat aivi t  2tm(m oy4op  lies t)s2taurpno1texnif3ils aDel(vo;() etoifciy1la rlueolt  2umxr3nu1lp e nei tfs2taxmp;u4texoiictyd m emnmonu0aleoxocoatfptr ies s) exoxo iydllt  fetl( aDrrxr ;o1aexomfetatfa2uau o;(0trenifctotfat  nvs (  rumimpnodllen ics (fs2tr(moot0oeto f3iydla2ulu p t0alxoxfcoodfaDrlnvi;s0trtr(r3io4openlfcias  2taump;u0tlenmf3tatfa2ulnmo t0aleomociydomtr neo;s seuo(m3io1lm emies sfsDuau oou1aex mf3iad aDuan p t)trxrxo tatlpDrlivs t0t2toim io4ol nlieslt) 2tr(moou4tpx ii3tat m2ulu o;u0aexrxfctadfptr uvi;t0trum(m3nydopen ietasfsDtau  nt0apenmietld aDranvon() exnifcoo1fmt aueolt)s2toir3nudomt  nci sfsDrrxrp;o0tetomi3iad aDraumo ()aexnxo3iotfa   i o t0 etmxrpoudap nlivi s)a2rru o;o1tet if3tat s2um( onu) renifcoo1fpDean slt)tetmio ny4omenlicilt)artrurpou0alt if3iysfs ulu snt)trxnxf ootomte nvi;()t2trxr3iodalenmivtat sDuaxmono0oltniietaslmDrm(mp u)artrir to1optrli o t  exmxm oydom nlfctlsfs2tr( o;t1olen i3iat s emnms (4aeeoif tadfp   u i;t seto(m nodape  netls)aDurx  ;u0tlx mfetat sDemums;t4 rtomo io1fa r i i t) exmxr3ou4llt  ieta( a2tau pou0texnmoetltlmDra(mpnu4 reoxrcto1fat luvo s) rtr(r nodllt  ivsl()arururp;t4tpt mo3ildlm2elnvp () rxrmf3iotfmDraueslt srxmim3iodopt mnct s)a2ur(m ou4opeomoctysls2ulump;u)arerio oydoa elieil()sexo(mpou4llen nesat) Dtr(root4teen i3iydfm um( ont4altomr oytfptranvol(0 rxoxmpiu1alee fvt s  rum(monu1aptomociyt m2el(msnt4aleniocoo1lmDrai o;(0s2trir nydal nliei ( s2taxrpnt0aexnmi3ias s rl(vpn(4aexrmf3iy1lm e u o;s0texoiopnodol  lfcsat)s2umu  ;u0oee mfeiysfsDra(vo;u4trxrio3tadlm eln s;()t2toir3oy4oltnmfvs (f 2tmu pou1tle iictatlm2ea(vp;t) exrxo3tytomD  u ils0sexo(m oo4lp   iciltf 2ur(monu4oex moeias a eln p;t0aleoxo oytlp  lnesls0trum(mpio4apt mfcia()s2ur( pot0oeeomocias a el( s t)tlxoiocoodlat auvs;s0 euoim3oudam n fcils)aDrm(r no1tlxoifcild m2ranmp (4 eeoir3ta1faD ln o ( trtm(m3ou4opte fvsat)s2rruronu0olx ifcils s2rl(ms;(0texomocoadoa raivi s0t2xr(r3ny4ol nmivi t)aDtmur oo1tlt  octlsfmDuluvsnu) lxrxrctytlmD aiei;s)t2xmxo io4amtn fcsltfs2tau  oo4tpxoiieiysfmDrlnvp (4tlxnif to1op   iei;s tetr(r nudlpe lnvsa(  2umu o;t1tpt miciltla rln s;()trxomf oodlp r ieils s2uoxo3ny1ole lfcs t sDuau p;t1aex mfciyt s2rl(msnu4 eerxf iotfaD  n sl(  euo(r nodomeelnctl(  rra(  ot0apeniietltls um( on(0altomo3oo1la   n ilt teum(r3io1lltn fviatf Dua(rp;t4texnmi3iadfa ulumpnt4trxoir ta1la eaues;t)trumio iy4ope  ncs sfarurum ;u0aeen iciysls ul(mp;()arxoxf oa1lmD lneslt) exmxm ou1opt  fvtas s2tmxmo;o1aleoifeiytfmDumump t) rtnxrcia1fp r n i;( t2uoir3nu4altemivtat srua( pou4oleo o3iad sDumnmo;t)texoxf3oydopDrli i;() 2um(mpiudapeemnvilt a2tau  ;t1teeniiciad m rl(vs u4texrxr oytlp eaues (0t2trimpnudop elivi sfsrtmu p;t0texn i3iadls2uanvp (4aleoir iytlaDraneols0 2urir3oydalen ies t sDra(roou4alx ii3tlsfa2eluvp;t0 rxomocty1opDelnvi;t s2xmir no4llte ivil()aDra( pot4tlto fciadla2rm(vo t0arxrxfciotopteaiei;() etr(m3iy1lle  neslsf rum(  nu0oet iociltfaDem(ms;u4 rxnmfcoadlp e nvols texmim3oo4ol n nvsl( s2ua(  ot0altomo3iyd mDul( ont0 rtrmf totfp rlnvo;s t2xoiopny1lme mies t) Dtr(mpnt0opx  iciydlsDeaumsnu0tltoioctydla eaivs;(  exmxr io4lpee ivs tf 2tax  ot1oetoifeiydfs ua(mont)tlxrirciydlm r ueols t2xr(rpoo1lm   nesas)sDtr( ont1tetomo3tydla ra(mp (4arxoio tadlmD anvs;t t2tm(o nu4lmt mnes s)srua(  oo1aee  icild a uluvp;u)texnxo3iydfmD  n o ()t2xrxr3iy4lp elnesasfsrtrxr ot4alxomi3tatls2rl(vs (0tetrxf3iytfa rau sl(0s2to(r3oo1ol elneta(  2rmumpno4altn ieiasfs2uauvpnu4alxnmf oadfpDranvo t)setrxr iodlmeemfeslsfaDrr(mo;u0oeen i3ilsfa2rm(msnt0texrxo3tytfp rlneslt)trxmio no4ap  mncils srraxr oo1aexnmieilt m2emu p u0 ltnxo oa1faD lu il( trtmxo no1apt  fvt sfaDtmuro;u1aeenmieiydlsDrlump;(0treomr oodfp  an s t) etr(m3nudam   fvtl()a2raurpno1optnmoeias s ul( s;(0 rtnmociadoat  neo;t)texmir3nu1lm n nviatf 2taurp;t1apxn ociysls umnmo;t0texomo iodom e uei ()texrxr3ou4lm   ncsls)sDtru  nu4ale mf3iyd a2uaumont0tetnifctadoptelies s0t2uoir ny4ame  fct () 2urx  ;t0olx ii3iat sDeanvsnu4artoxf oytfptr nvo s  rxoiopnu1lmee nct tfsDuaurpnu4apenif3tltlaDel(mp u4teeoifcoy1oa rlivslt  etrxm nudol e fcias s2rm(ronu4aeeo fciydlmDuan p;()teerxoctadom elneslt texoxo nudopen nvsas artm(rp;o1tpt io3ils mDum( s ()alenir ia1lp elu s;t0texrxopoy4omt mnes ()sDuauro;o4tleomieiyslsDem(vo;t4 rxomf3iydfpt  n i s t2xmim3iodlmtnmfct sf Duaurooo4ale mi3iys m2umnmo (4artoxf oa1latr i ol( seum(o3oudoltnlncta(  2rrxm ;t0aetoioeilt a2rmu p (4 lenio ta1faDeaiei s) rtrio3nudom nmici (faDtaur nt4tetomfeiadls emnms (0tlerxfcoa1lpt ln slt0sexmxopiu4lmenlncsl(  Drax pno1alx ii3iaslaDrmu on(0teeoxocio1lpD  uvils0s2tm(m nu1al  lncslsfsDrau o;u1olxnmieiasls2ran o () rtrif oa1fmtrluvil( s2xo(rpiudamtelietlt a2raxrooo1aee  o3iatlmDrmump u) lxoiociy1fptr nvils  2xr(o3oy1lpenlivs s)aruaxrp;u0oeen f3iydls2umn o (4aexomociydfp   nvils) 2xoxo3nu1apenlnvsa() 2um(rp;t4tlx ioeiasls2umums ()alenmocoodfmt li s s)trxoim ny4lp n icsl(farurxr ;o0openioeiat aDelumsnt) rxrif tadfm e neo t)trtmir iodop nliesa()a2ua( o;u1opt iiciytfs2ranmpnt4alenmo todopD  nvi t) euo(opnydom e neiasfs2rm(mpnu0alxnmo3tatfs rlu pn(0tltrmf tadfaD  nes;s  etmxopiudoptemfvtat)a2ta(monu4aee mf3iadfa rl(von(0aetoxr3oatfaDranvol(0tetoirpnu4ll n ieil( s2rm(root0aleo o3tld sDua( o (4tlxnmr oytfmt auvo ( s2tmio3iydom n feta( arrr(mpno1oltomieiatfs ranms () eerxrcoo1omDeaies (0srxrxo3oodole mfctl(fartaxronu1tetoii3tydla2rmn onu) rtnif3tadlpDrauvo ()teuo(m3oodameelneia(fs2urxmont4aleomfetltfs2uluvo ()artrif tytfaDelneo;(0s2toimpoodolt  icil(  Dumxr ot4optn iciyd m2uaump;()arerio iadfmD  ueol(  rur(r iudllt  fvsa(farrmu pot1opto o3tyt a ulnvs;t0tlermo3ootfmtrliei;t0s2to(r nudomen netatfarrmur ;u0aleoii3iadlaDem(msn(4 eeoir oy1fp r i s s0s2tmxmpnu4lle  ncsl(f Draumpno1opeomieild s rmnmp t0tlenxf iatla e i o s0 etr(opoy1om  lfcs ( s2rau  ot4optoifeilsls2elu p t0 eerif tytlaD  u o ( trxo(o3io1opte ivia(  Dumx p;o1open f3tltls uln o;t4altnxr iotoateliesls t2xoxm nydolte fciasfaDrmxmonu4oexoiieiytlm ra( sn(0 etnxf3to1fpDe nvilt)trumio ny1lle  nvtlt)s2umum ou4apxnmoetyt s2ra(vp t)treomr oodoa elu s ()teumirpoodlmee fcias)aDua( ooo0oetomoeiasfa el( o u4tleoir iytop r neo ()trtrirpiydal nlfcsl() Dua( ono0oexnmf3ildlaDemn p ()aeerif3oadoa eauvi;()texrxo3iu1llte nvi s s2rr(mpot4teeoiiciydfa ul(mp;t0areoifcootlmt aivs;t0texrio iy1oleelnvils)srtmumpou1oet  oetad s2uluvo;t0texoxo iy1la e i i t tetm(o3iy1lpen nei t) Drr(m ;u1texomieilsls2rmn s;(4 rtrmfcoodlaD liei;t)truo(r oydop nlnctatf Drmu pnt0oexomocildls rmumsn() lermr tatfaDelieils0t2umxo3ou4alenlnei t sDrr(m ;t1altoifeilsfa em(vo;() exrmr tytlm eanvi t t2toim oudap n nesls)artaum ;o0tlenmo3tadfs rl(ms (4alxomo3iotlpt anvo t t2triopoy4lmtnmfvias artrx  ou1alt iieils a2ulnmsnu4trxoxo3oodlp ran il( s2uoxm ny4ape mnvia()s2ta(mpnt0tlxo oetydfm ra(vp;()arxnxr3tatlm eluvo;s)trtmir nu1lm   ncs s srumumoot4opeo ociadfs2um( pnu4tetoio iatomtr nvil( t2urxr3ny4ol nlnvilt aDuau o;o1ole ioeiadfm um(msn(0 ltnmo3ty1fat li olt t2um(o3oudolt lfcs ()aDtmxrpot4tltnioctys s2raums;t)trerio3iytlaDr uei;() exm(o3ny1oltnmncsat)srraumpnt0oetoiieildfs elnvs;u0aeermr totoaD  uesl() etrimpou1op emivilt)srtr(mpnu4apt mociatlmDemuvo u4 exrmr ty1fa r u s ()seurxo oodamee ivtltfaDrrx pnt0aptoio3iasla2rm( o;u)arermf iytfm r ieo;t trxoxm oydom elivs s)sruau onu4tet if3tydls um(vpnu4aexoirctydlmt livs;(0 exmio no1op  lncsls  2truro;u0tpxniociadls2el( pn()arenxf iatoptranvo ( srxoirpno1om nmnvsa( sDumuro;u1aee mfciytla rmnvsn()teenio oatfatrlueilt) 2tr(r io1aptn ivslt  rtau pot4oetnifetydlm2um(ms t0tltoir iydopD anvi s0tetriopnu1lle lietlt  2umumoou0tleoiiciatlsDemuvp;t0texrmr ootfaD  uvs s0trtr(rpoo1om n ictl(fs2rrxrono1oee mi3tls aDulnvsnu4teeomfcoo1om ran o;t0 euo(r3iy4ope mics s  2ururp;t0texomo3iydlmDea(ms (4alxoxf3oadomt  i il()teuoxo oy1lmt  nvs t srtrur nt4aeto f3ilsfmDemn p u4tlxomf3tytlptrauvi ( teur(o oodlmtn nvi ( srrau oot1aetnmieiaslm2emu p;t)tlerxo3iydla  aueo () exm(mpno4optelnvi (f Durxrp;o0olxomoetlsla2ra( s;t0tetrir3ia1fmD  ues (0sexoxr oy1alenlnvils)aDrrurpnu4tltomfciadfa2el(ms;t4 etnio3oa1laD anvols0trxoio3ny4ome livil() Drrum ;u1tetn i3iasfm2el(vs;t4areomoctytoateln s s0srxm(mpoy4lmeelnvi s artmu ont0oltnmfeiytls2rm(mo;u)tltrxr tadlpDe ivilt0trtoxm oo1omt  fcsat)aDumxmo;t1tpt mieiydla ul(vsnt0 exrmrcta1lmt  ieo;t truoxo3oo1llenmicta( sDtr( onu4aeenif3iltfa umu s;(4 eeoir iydfa rlneol( tetrio nydoptnlnes s)artmumo;o1oetnmociadlsDulnvs;t0 rxnmo ia1fa   ivsl(0setmxr oudom nlnctatfa2ururp;o1oltomo3iydls2emn s t4arxrmo oo1om  aueo;s tetrxm iudlm  mnet s srtrxrpnt1tpx mietltfsDrm( o;() eenmrctatfpteaneolt  etrxo3nydom elies (f rrmxmp;o1opeo o3iatlm2um(vp u0 rtoxrcoatlptraueslt0s2uriopnudom nlietl(fa2ur(r no1ole  i3iyd sDemu o ()aeenir iatfm raues;s t2xr(r iu1lpt lfetl()sDraurpou1ape mieiltfa ulumpn(0artomrcoydlm r ivi;t tetr(o3ou4apt lncias) rtaxm ou1tltoio3iysls2eluvs;t)aeermrcta1fmteai s;()truriopnu4apte fct sfa2trumoot0olx  iciyd a2el(mp;u) rtrmf iadfmtrln ils) rtmxm oy4olen ics tfsrrrxm ;t1alenifciydlm2umnvp (0arxrmr iadomt ai o;() 2xm(o nydllenlfctl()a2tr(mo;u1olxo o3ils s ul( o u4aetnxfciy1lpteauvslt0 2xrxo oo1ol   net tf 2urx ooo4tlto fctls mDrau sn(4tltoxrcoy1lmDrluvs (0sruo(opio4am   iesatfaDrr(  ;o0opxnmfciytfa2ea( p t) lxrmocty1oate i olt0truoir nu1oltnlncia(  Drru o;t1texn octldlaDeln p;u0tetoio3ootomt auvi;s0 2xrxr oy1lp  livil(fa2uru ono0teeo i3iyt s elu p t0trtrir totomt livi;(  etrir3ny1lptn nvsat)a2rrxroou4olenmociytlsDemu p (4teenir3oytoptranes (0seurir3ou1al  lnvias  Drrxrp;u4olxn f3ilslm um(mpnu4arxomocoytfmDr ies;s) eto(o3ou1lpenmiet () rra(m no4altomo3iyslm rmu s;t0 eeoxrcoadlp   n s;s)s2ur(opou4lmeelnetatf 2tmurpot1tlxoif3iltfs2ra(vo t)tlermo oydlm ranvs;s)trxm(m3iudapt mivia( a2rmur ;t4opxoifetlslaDumnvo t4tltrmo3ia1fa rlnvol() euoxopnydop e fvsat) 2ua(r ot4apen fciaslsDelu s ()arenxf3oa1oa ran s;t) eumxr3io4aptnmnei tfaDua( poo1oexo oetadfsDra(vp;t) rtomf totopD lueo;s)tetoio3nudll   fvtltfs2ta(rp;o0tetnifctatfaDeauvon(0alxnir iy1fa e n ols setoxopoy1amtelfeta()a2tm(mono4oeto i3iydfm2ranvp;u0artnxf oy1fpDrln s;s sexmxo ou1alee ncils  rumx pou0tpxomfetlsfm ulnvs;(4 etomo3ootoatr nei s)sexo(o oodlm n ivs sfs2tau  ou1aeeomoeiysfm ea( p u0trxoif3ty1fptraivs;( s2trir3iydop nmfesasf Durx o;t1aptn i3tytfm ean pnt) eenxo3ty1omt  iesls) exo(opnu4lm n nesat)artr(rp;t4aleomieils mDulnvo t) lxrmocia1omt anvi () exoxrpoy1ll n ictl( srtaxmont4tet  icilt sDra( s u)tlxrxr3oo1lmD  ieil(  rtmir3nydamtnlnetasfaDum(rooo0tltn feiydls elump;(0tltnif3todfptr u s t)trtrxm3io4lpe mictas  2ta( pnu0aee ifcildls2eanvo;t) lxnio oydopDr ivsls0 rxr(opnudapeemfvi t)s2umumpnt1tpxnifeilt sDuanvs;t) lerif oadopt  ueil()sexmir iodomenlfvsltfaDtaumpnu0olenmfeildfa rmu snu)alenmr3oadoa   ivols  2um(rpnu1lmte nvsl(  rurxm oo1tetnioeiytfa2rmnvo;(0 eenxf3ia1laDe ivo s0s2urxm3oy1olen fetl() Duaxr ;u1aptnii3iatfs rmnvo (0trenmf3tadfpDrli i;(0trum(opoo4ll elncil(  rrru p;o4olxomf3iysfsDua(ms t4altrmr oodfpt aies;()tetm(m oodlmeemivtl()sDta(m ot4aee  ieilsfm elnms;(4 leomrcta1op rlnes;s) rtm(rpny4llen fvias artauro;t1opxnio3tytfsDumnvo t0tetrxo tydlp rli ilt0trxoxo3oodamtemneiat) 2tau p;o4tlto fcildfa ean on()alxoxr3ty1laD  nvil( truo(mpny1ope lfei s artax oou1tptnif3iyslm2umn on(0tlerxocootlp  luei;s  rtoxr3iydap   ict s)aDrmumont1opt  o3tatls2rlnvsn() renxoctotfmDrln slt0 exoxrpiodole lnci ( srrau pnt0alenio3iyt aDum(ms;t0aeenxr3ootfp e n i;()t2uriopnudopen nvt tfa2trxrp;t0altn f3ilt s rluvs (0aetomf tydfa  aues () rxoio3ou4ll nlfciltf 2trum nu1tetoioeiat sDrluvs;u4tlxoio3totfp r n i;t t2trirpiu4omtnlivslt sDumxm no0oleomfetyd m2ul(vs;u)artoxf3tadla eau o;(0sexr(o3nu4ol nmies tfartrum ot1oexnmi3iyd s2ra(vo;t4tltrircto1opteaivil(0 2xoxr oo1om emnct s srtm(r oo4tlx  i3tyt s ran o u0 rtrir oadla raivils)tetmio nydomt mneiat) 2rauront1aeeoifeils aDrluvpn(0tlxrxf3ootlateau ils0t2xmirpoo4lp n iciat s2ta(r ;o0optn fetaslmDul( o;(0altoxf iadom e n sl()s2xoio3ou1amte nci t) Draxmp;t1optnmf3iytfm raums ()alxrmociy1la elueslt trxoir3nu4amen fei sf Dtmum ;o4apeomo3iltfm2ul(ms (0tetrxr oy1lp eluvil(  eurxr nu1op  lfctatf 2urxm nt0tpe mieiaslaDulnmp;()tltnxf3iydomt luei;( trxrio nodlm nlivi t)srrmxrooo0tee  octadfa2umuvsnu0tetomociatlaDeliei (0srtmio ny1amt licia(f rrr(mpot1tlt  feiydfs umums;u) eenmr3oadlaD livil(0 2xm(mpiudol e iesas) 2raxront4tex mi3iyd s2rm( sn()artoxo3iy1op  anes;( trxmio3no4alt mncia()aDururonu4aexn i3ias a rmu o;t4 renmocoadlpt au s;s s2xmio nu4ale lfviasfs2ra(m ;u0apeomfcilsla elu p (4 leomocoadlaD  ivo (0 rxmxr3nodlltn fvt t) 2rrurpno1olx  o3iltlmDelnmsnt)tlxrxr3ootfp  ai ilt)srxoxmpny4ap nmfes tf 2uau p;t0aee mictatlmDum(vo;u0aexnmf3io1laDran ols sruo(rpnu4ll  lfet () Dtaxrpoo4tex  ieiyd m2em(vpnt0 lxoif oatopteauvi;s teurxmpiydomtelieia() rra(  ;t4tpx mi3ias s2elnvs t)trtnio3iodom rai ils)t2uoiopoo4olenlfcils srrm(m ot4opto ictld a2rl( s;u0 lermfcoodfp rau o;t)sexrxrpou1lme  ncias  Dtmxmpno1alxo ociyd a elums ()trtnmo io1laDeai o (0srur(m ny4llt mneia(f 2trum ot1tpx ioctldfaDuanms;u4 eerxoctydlatrauei;t0 2uo(rpou1lm n icta(fsDtrxmp;t4apxnmociytfa2rlu o;(4 rtrmo tytom eaieslt)s2tmirpiy4lm n ivtlt arraxmooo1tet if3iltfm2umnvp t0arxrifcoytfateai i;t) rtrirpou4amenmfvtas)sDururp;o1alx mfcilt a rmnmpn() ltnmo iotoaDranvi (  2toio no1ape lics t)sDtrxmo;u0aleomociaslsDuanvo;t4altoio oa1fp eaieols  2toiopou4op nmneta() Dta(r ou0opt  feils mDuanvp t) rtrxf3iotfpD  u o;s)setr(opiodam  mnvi () 2trx pot1tpxn o3iyt a rln s t)aeeoircoa1fmD  i s s0 euoim oodoltn ieils s2ra(rpnt4ale ifeiytfsDelnmpnt0 rtomo oytoaDean i s0 rxm(rpoo4amenlnctls)aDtaumo;t1tlxomoeiltlsDuanmp (4 ltrxfcoatopDrln ol(0 exmim3iy1lmtemivta(f Drmu  ;o4teen ietadfsDrlnms;(0 rxomo iotfp rlnvols  2toxo iu4am elncslt) Drau oot1tpeoioetydfs ran
\ No newline at end of file
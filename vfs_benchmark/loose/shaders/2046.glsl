@@ -0,0 +1 @@
+uvsls0 etr(o3iu1aptnlneil( arumu onu1tpe iieiytlm el(vs;t4 rtnxf3oydfa eaivo;s)texoiopiydapt mnvs s s2taxrpno4oleoiocilslm rl(mp (4teenif3tydoatr nvo (  rtrxo3oydoltnmfetasfsrtax pnu0tlx mocild a2rmnmo;t0 eerio3oydfm  li s;t  2toxo nu1oltemfetltfa2trxmp;u0apenmoctlsfaDulnmp;u)tltnmo3tadoatelu o s)trtoxr oudam nlfetatfsDumumont4texnii3iyt m2eluvo (0altrmr3tatoptr ies t) etrimpny4ol nlnetat)arrm(mo;t4opxomoetytfs ea(vs t4aeerxr iotlaDelneo s tetmimpnudll nlnesasfaruaxm ;o0apx ioctyd a ul(vp u0alxnxfcoo1fm rluvs (0s2xoxo3iy1am  mfeias)aDururpot1oleoioctyslmDel(mp;(4alxnxrcoo1latr nei s)srtmimpoudlm n ncs (fa2rrxmpot0oex iictasla rluvsn()tltrmf ta1lmD au s;(0 2xmim ny4ap emfvs s)artmx pot1opxoiociys m2uau s;u4tlxoxr3oatfmt lu i;t0 rxo(m oydlmtelivs sfaDtaump;t4tetn ociys a2ulump;(0tetoioctytlm rlnvi t  2trxr no1ll elnvi t)s2ua( p;o4tpen oeiatfsDrlnmsnu)texoir3iotoaD au o;t) euo(m3oo1lp   ieiltfa2umu p;t1oex  fciysfm emums;(0aetomf ia1optrlneo;t)srxrxr nu4opte ivia(f 2tmxmonu0optniictasfs rlnmpn(0 lerxo iy1omD an s t texrxo ny4ll elfvta(f 2rrxr nt4tptoiictasla rmnvo;u) eerxr3iydlaDelnei (0srxoxr3nydlmtelfeslt s2trxm ;u0aex  fetlsfs ulump;()teerircoy1fatr nvo s0 eurio3nu4aptelnvils  Dtmur no1oex mociadlsDumn p;(0texnio iydop rluei;t setrio iy4ape lict (f 2umxrpnt1alxniieild aDeaumon() rtoio iydlpt  neils)t2to(r3iydomenmicsltfarrmxrpou0tptnmfctyd aDran ont0trtoio tadfatrli sls0 rxmxo oodam n fetat)s2umuro;t1aee moeiatlaDumnvs u4 ltoircootop r ivo;s0trxriopou1altelivil( a2uru  nt0oetoii3ilt s eanmo t4trenmfcoydfateanes () 2toxopiy1ope miesasfsrtaurpnt4opt ioeils aDeanvs;() lxnio3todoat li ilt0srxoiopny4ll  lfvi t) rrau  nt4optoiietytfm2rmn p ()alxoio3oatlptr uvil( texmxopoodlp emivt s arra(  ot1oexo fctyt aDumn s;t4 leomf3oytom elnvo s0seuo(o ny4alee nvtl(  ruauroou0tex mf3iytls eauvs u0trenmf oa1oa  aiei;s  ruoxr nu1lpeelneslt sDraur ;t4optnmf3ildla rlnvsnt0trtrio to1lp rln i;t s2um(r3nu1amee nct ( aruaxr ;u0tet ifeias m2uln pnu)aetriociotlp  au i (0texmxo iodomt lnvtas srtrumo;o4teeniociad mDum(von() lenmfcoy1optr u i;( t2toir nudlp nmnet (fsrta(m no4aetoifetlslm ulnvp u)tetrifctodla e i i;t)texmxopnudalenmfvil(fs2uaumono1aeeomo3ildfa uluvpnu4aetrmf3totlpt  u ols) 2xo(m oy4om   fvi (f 2trx poo0oltomfciyslmDua(vo;u4aexoir oy1omtranei;(0s2uo(m3oydoptnlnvi t srraxrp;u1oeeo feils aDrm(ms;(0 rtomocoodla  luvolt sruoxmpny1lpen fcs tf Drrxro;t4apxn o3iltlmDrauvpnt)treoir3tadomtrlu i;s) exo(o nu4alenlnesas)srtaxr nt4tpx ifctatlmDemu p u)tleomr tatomtraiesl(0tetoxopiudop emieils a2raxrpoo0tlen oetlslsDemumo u)teermo iydfptrai o;( trxmir oy1opte fvtat s2rr(r ;t4olto ietadlm2emu p (0 etrmo3ta1fpDrluvols) rurio3oo4amenmicil(fs2rr(mpot1olx io3iasfmDel(monu4 lxrircta1op eaivs t0t2uo(m3ny4lpenlnesasf 2rru  ;t0tpen octydfaDua( pn()teeriocoodfaDe u s t)t2umxm3nodalt lnvsls sruau  ;t1opeomoeiyt aDul( ont) eerio3ta1lpt aneo (0seuoxopno1optn ivsls  rtmxmpnu0tlxnmi3tldlmDuauvpn(4 etrmrctatlaDelnvols tetoir3iodlm n icilt)sDrru pot0teeoiicild a2ea(vont4 lerxr3oydfmD aneo;s0 2urirpoo1llenmfcsa(fsDtrxrpno0texn feiltlm rl(mpnt)tlermociy1fmDelivs t0 2xo(o iu4ame  nvils)a2rau o;u4apenmfctysls2rluvpnu0 exoxr oa1lpte u s t0teurio3iy4oltelieias)sDrmx  nu4tee iieiytls2eaums;(4aeenmf3iadfptrlueslt)trtmimpoudaltnlicsa(f 2umumonu0olto o3iat sDranvp u0 rerxo3iydlmte ueol( t2uoxrpoydllen nes t) 2um(m ou0olxnmi3tytlm umnmp u)tetrxrcia1lp rau i ()t2uoir3iy1am e nci tfarrm( o;t4teen ieiadlaDem( o ()tlerircta1faDraiei;(0t2urxr oy4lle  neiasfaDtaxmono4texn i3ilt aDumnmonu0teeomrciytla rlivs;t0trurxr3nu4lp  livs (f Durxmpnu4oetnmfctadfsDel(ms;u4teenmo oydfa  livsl(  rxrirpio1lltn fviat sDtmum oo4oeenmieiatfa2uln p;u0aeenio3oytfa elu sls)s2tr(opou1ope  icsl( artm(rpou4tlxn o3iysfs2rmumo u4arerircoytom   uvsls srumxm3io4lmtnmncslsf Duaumpou4tpeomictasfa2ranmsnu4altnir iodfpteaivs t0srxmir no4lpeemici ()s2rrum ;o0opxoifeiatfm um(mpnu0trxomo3ia1fat aueol(0tetoimpnu4op emivsa( arra(m ;o0ale  feiyd s uau p t4trxnxrciatlpte nei t0 exr(m ny4oltemneias)s2rr(rpou0alxoio3iyt m uanmpnt)alxrmo todfpDeaivo ()seumiopiy4lptemfes (  Dum(rpnt4tptniociyslmDeau o;u4 eeomr tatfaDeaieolt0teum(opny4opteliei tf rur( pnt0oleoio3tytlm ea( p (0aeenmoctadla elnvol()srxrio3oo1lpte fcta(  Dua(mpnt0tpe  oeiasfmDemuvp t) rtnir3ootoptraivsls)teur(r oo1lp  licsls srraxm nt1apxnioeias m eanms (4trenxr oadfaDr ivi (  eumir3no4oltnmnct s) rurxmpno4texnif3tldls rm(mo u)arxnmr3todlpt  nes;t0 rurxopiu4ope  net s)aDtr(  ot1tleo ociydlsDum(vonu0teenxrciatlmDrlivols0setrxo nu4lle mfei (fsruaxronu4ape  i3tltfaDelu on()tleoxr to1fpDran s t)seto(rpoo1amt mneiat a2ua(moot1apxnif3iytfsDuau s t) ltrio oy1fptranvslt  2tr(r3nudol emiesat)arur(roou0tlxn feilsfa rln o u)aleomo oadla raivolt0s2urxm io4apenlfvsat)aDtru o;t1oee mi3iys sDum(ms;u4 rxnmrcoadoaDe n s s0 2um(mpnu1lp nlfcslt  rururo;o1apt mf3ias a ulnvpn(0tlenxocoa1lpDeai s t texrxo iodlle mfvtasf rumur ou0tpe  oeiadfs2um(vp;t4arxnif3tatlmt  nes t) exoxm no4ol  lfcil( sDurum nu0tetnmi3ild m2uau s;(4 rxnmrcoatlatr i o s trtoim oudom   fesa(  rum(rpnu4texoio3tys a2ran s t0trerxocty1oate neo s0srto(opoo1al  mfeslt)aDtaxrpnu1oetoifeildlm rau pnu0trxnmo oodfmDr ivi;t setr(o nudlm e iesls)aDuaxr ;u0tleomfciydfaDea(mpn(4trxrxf3tydoaD au s;t)t2tmxm3ny4ope mnvtl()aDrau pno1teen f3tysfsDulnmp u0 eeomr oa1omDeaivs t) ruoxopno4ap n ncsa(f 2ur(rpou1tpxn ociat m ea( snu0 eeoiocoy1fmtr ieslt  rxrxmpiu1llee fetl(  rrru pou4aexo iciys aDrluvs;u)teeoiocta1omt livo;t) exmir3nu1lptnmfci t) 2rru ont1apxoif3iadlaDua( s u)texnxo3iadoa elnvs s0tetmim3nu1alt  neias) rurx o;t0tee mo3iatfa rmums u4 eerir oadlpDeaivo s  2uoim nydoleemnvtlt)aDrr(m ou4tex mociys a uaumo t4 lerxrctytlmDe nvi;t) rxm(m oo4ape  ncs s s2ua(  ;u4apen oetaslm emnvp (4artnxoctadomDeau sl(0sexrir ou1lmtn fcsa() rtrx  ou0altn oetysfm rmnvs;(0trtrmocta1lptrlu s t) etrxmpiu4al emnesa( a2ra( poo1tlt  ociydlm eluvs (4teenir3iydopt au sl() 2toxopiudoltnlicil(f rraur ot4aeeoii3ilt a2rmn pnu4 etoxr3tatlmDrli s ()t2urxm3nodll   fct ( a2ua( p;t0teeo ictasls em(mo;t)aleomf oy1lat  nvi t)teurirpoy1oltnlnei t) ruau oou4apen fciydfm ua( p t0tleoifctadomteaivolt0tetmio3oo4omtnmivs t)aruau pnu4texomfciltlm2rln p t) ltrio totlpDr n o;t  rumim ou4oltnmfcil(f 2ua( ooo4teenii3iydlm em( o t)tetrxocoydfpt ai ils0 2tmxm io4lmenmfvs (faDtrxr ou0tpe  ietas m eanvs;u4arxnif3to1latrauvo s  eurxopoy1ol  mncs ()srumumpoo0tleomf3ildlsDelu s u) eerxo iotfmDeauvi;(0sexo(r3no1ome  ncs t  rrrumpoo1tpenifeildfsDrl( s;t)tlxrxr3totlp eln ilt0 2toir3oudlp nlivt (f rra(mo;o4opxoifctydfs2rm(von(0 lenxo totom eli s s) rtmxopnu4lmtelnetls  2rmxrp;o1olenio3tyd s2ra(monu0 lxomrciadlm eaivil()srur(rpou4apt mfcia()sruru p;t0tetoioeiytlmDuaumo;t0arxrmo3tatfm e uvi (0 etoxopoodllenmfviat)s2rau p;t0teeo ieiltlm2uauvs (0trxoxo ty1lptrluvo;t) rxo(m3iu1ome mivsa( s2ua( oou1tetnio3tysla2rl(vs;t4treoif tydlp e neslt)teuoir oodaltemnvt t srrm(rpno4tpeoifcias a2eanmp u4 ltnircoytlatelieo;(0 exmimpoudoleelies () Dtrx p;o4alenioetls m elnvo;u)alxnxf3iotla eli sl()truoir no1lmeelict s  Dua(m ;t0tetnmoeiyslm2ranvonu0trermfcoydlatrlivolt0t2xr(o iy4apeemfct ()a2rmxrpou1oee  feiytla rm(vs u)alxriocoodomteauvo;t setoio3nodlmtelicta(fs2urxro;u0oex io3iad m2ul( o ()teenxf3ootfpDeau o;s srtr(rpoudal elfcsltf Durx oou0tex  ociytlm2umnmo;(4texoif ty1optr n o;t)trur(mpnodlmt lnctatf Drm(ro;t4oltnifeildfs2emn p u0tlxomf ia1lp   i il(0s2tmxrpny1opee fvilsfsDrmurpnu0olenifeiasfa2emn s;(0tlerxrciydomD livi;t0t2xmir no1ome lnei s)s2rrxrp;u4oeeo oetld m2rlnmo u0 eerir3ty1fa   nvo t)tetoxo3no4alee ivsat aruaxrp;t0texn fctysfaDumumpn(0trxoir3iadla r nesls)srur(mpiydlme  nvtasf Draxmpno0oleomictadlmDranvo;(0 lenxf oytopDe i ols setm(m oo4ameemfcsltfsDuaurpou0opeo i3tasfmDrm(vs (4altnxf io1lmDr uvs;s0s2urxrpoydop elnetas)s2ua(rp;u1oexomocilt a emuvo;u4arxniociydfpD  uvi;s0setmir3ny4lle  nei s) Draxmp;t1aetn oeiasla2ran s ()altrir oadoatr ies;s)t2xmir no1lm  livsatfarraxmooo4tpxomi3iytlmDul(vs;u4teenifcootfp rln o;s)s2uo(r3iudopenlnvtltfartm(  ;u4tlt  i3tasfmDrmnmo ()altoif oatfptrln il() rumxr io1ome  ncil() rrm(rono4tetoiociltfa2ea( s u)tlxrmfctadfp  an s;s0texmxm3oodale  iviasfa2tmxm ;o4tlx  fetadfm eln p t)alxrmrciotlptrluvo;()trxoimpiu4omenmiei () 2raur ;u4olenioeiad sDea(mpnt0 renmr3ty1laD  neo t0s2tmxm3nu4lmee fes ( a2rrumoot4aeeo iciydfa uluvsnt0 lxoxrctytfmDrluvs t0 exm(mpio4amte fetl(fa2urxm ou0oexnifeiadfaDel( p t)aetrxf3tytfp ean i;s0srto(m oodllt  icias) Durx  nu1alx  oeiatfm2elumo t)tltomf iydoa r i ils0s2umim iu1omeemiesat) Dtau  nu0tptn oetatlaDemn snt0 etoio3oa1lmte ivs;( texmim iy1lmen icsas sDtr(rp;o0openmfciysla2rmn p (4 renxr ia1lptr ivo s0srxm(o oodom  lfvtasf Drmum nt4alt  feiltla2ra( o;u4teeoxrciy1fa raivils trxmxmpno4olt  fvtlt sDtrxrp;o4optoii3iltfs ra(vsn(0tetrmrctytlpDr neo s s2ur(rpoy1ame lnctl() Dtrurpot0alxnifetyt s uln on()alerxf oytfmtelu ol( s2tmxo3nudamtemicta(farrr( ooo4apx  iciatfa2rmn s (0alxrmr3tatfpteaues;( t2tm(r oo1ll e feiat sDurumoot0aex ioeiadlsDelnmpnu4alerir to1om  anei;t0srtrxr3iy4ll emneil(f Dumump;o4olxo ieiys sDuauvs t)tlxomrctatoa raueslt0 rtm(rpou4ll   fei t)a2rru ont4teen ietyt a2ran o t0 eenxf iatoaDelivi;s)srumxo3iudlmt lfvta( sDumxmp;t1olx mfctasfa2elu o u4arxnirctadlmteli s t0trurio oo4lmte fesat artmxr no0apxniictls m2rluvp u0 ltoxr3iotlm  luvs;t)s2xrirpoo4lle mneiasfartaumpou0aetomoctat s uluvp;u0 rermo3ta1faDrlnvsls)t2uoiopnodlm n feilsfs2rrurpot0alx mictys sDeanmsnt)teenmf3iotla   nvs t0t2urio iu4optelics t) 2rax p;u4teenioeilslaDeanmp;()tlxnmr todlat aneol()sruoirpnudal  lfvia() Dur(ronu4aee  ociyt a ra(mo;t)alxrxr tatfatr n ols0seuo(opoo4am  lnvta( sDtaur ;o0altnioetlslm2el(vp;(4arxomf3totfpDelivol( s2tm(o3iudomt licias srtrxr ;u1tpe iietatlm2umuvp;t)alenxf3to1la raivi t)setrim io4lp e ncs ( srtr(rpnu4apxnii3tldla elu p u)trtrxocta1optr ivsls0tetr(m3ou1apte neias)srrau ont4tpxn o3iyd mDul(mp u0tlxomr tydoat lu slt) rtmiopou1lpeelictat) 2tau p;t0altnmicildla ra(msnt4tltnmfctatopt aues s0t2tm(o ny4am  licsat  rumxrpnu4opt  ociysfa rlu o ()arerxrcoo1oatr ivsls0trxrxmpio1lm nlivt ( arua(m no0tpe mfeilt s emuvont0 rtnxocoadfm e ies;(0 2uoio3ou4ol nmivil(fs2tmurooo1ope iicilsls2um(vo;()tlxrxrctotlp rlivo;t0 2tmxm ny4am nlieiasfsDrmx  ou4oeenmfcias s rlnmpnu4 etrxf3oodlp raueo;t) rurio3nudlmtnlivt t  rur(  nu0alt  i3ildfaDrlump ()trtoxo3oy1fa  livo;s)setoxopnudome  fctat  Dra(  ;t4olxoifeils mDemnvp u)tetrif iatla r uvo ()t2xoiopou1lm elnviatfsDtm(mpot0optnmoctld s2uan p;t)tltnxf3oa1lm eaueil(0 exr(opnydolen fet (fs2urxrono1aeeoii3tyslaDrmnvs;u4 etnif3oatoaDr ueo s)s2xrim io4ll elictlsfarur(rpou4alx ii3iydfs rmuvon(0alxnio to1fpteluvi;( t2xo(r3iu1omte icsls  rtr(mpnu1tetn f3iatfa rmnvon() reomo3ta1op  livs;t) rxo(mpny4am n ncs t s2rr(rpno0tpx  ieiadfaDea(vpnu)arxrxr iodfaD lnes () rxmirpoudome mfci s)a2tmu ooo4tetn i3iyt s rln s u4aexnmo3oodom rauvilt)trtmim nu1lp n fct t arta(mpno4oex iieiasfs eau o t)aeeoxo iodop raueil(0seto(r3oo1ape lnes ()a2taump;o0aeto f3iasfm eanvpn()altnxocoo1fp r ivsls) 2xrim nodlm e iet t)s2ra( ont1altniocias mDrl(ms;u)artnif3io1omtrai i (  eumio oy4oltelfctlt)s2uaumooo0ole  i3iyt m rluvpn()arxoxo3oytlm rai sl( t2xoxrpoy1ol  lfetl(f Drau ono4alxn oeiytlsDuan sn(0 lxrio tadlptrluei t t2trim3ny4ap e nvslsfarrm(mp;o4olto i3ild m umumpnu)tetomf3iy1oa eaieo;t0trxoxo3oodop   neils)artaxrpno0apxnmo3tyd sDrmump;t4 lxniocoytom  aneslt truo(m iy4lmenlnetas  rrm( pot0olto oetydfm uan ont) rxoif3todlmteaiei;t t2ur(m io1am e fcilt)sDuax  no0tet iietas aDra(ms;(4 lerxf3oo1fmDeaneols tetr(r oy1lp nlfes ()sDua(ront0teen f3iytfs2ulnmo t4 exrxr3iodlptranvs;s0setrxm iu4amen nes tf rtau onu4aexn f3iatfsDrmums;t)aeeomr3iatoaD luvi t0trtoxrpno4lp n ictl(f 2urxmp;t1tpxn oeilt a2ua(mo ()tlxnxo3totfaDrliei t) 2xoim iodale  feil()a2trumpnt1altnmieilsfs uauvpn(4 rxomocoa1om e iesl()t2xm(opnu4apte icilsfsrraurpno4tpxo ociaslaDuln s;u4aexnmoctotfmtraieil(  2trxm3iudopen nct s  Dtr(r ot0tlx  ieilsla2umump u)alxrxocio1lpDe ueols) 2xm(r oy1oltemnviat s2ra(r nt1oleo ociyt m2eanms () rerxr iadomtran sl(0tetm(r3oy1al nlnci (fsrrmu  oo0ale mo3iyt s2rauvp;(4 ltoxo oa1lp e ivs;t sexmxr3io1llte ncta(f rrmu p;t1tpe miciasla umums;t0 lenxf io1oa ranvo;(0 rxoimpou4ope lfcsasfa2raxmp;u0openmociltlm elnvo;t4aleoxr ta1lp raueil( sexrxm3iu4oltelneil(f Dum(r ;t1tpxo ieiydfsDul(ms (4teenif3todfatrauvs s0trxmxr3io1optn fcsltf 2rrx ont4alenmoctls aDrm(vp (0 rtrxo iotlpt  ieo;t0t2to(rpou4omenmici tfs2tmxmo;o0optn f3tls mDulump;(0aexnifcoodlp e n s;( s2urim no4llt miet sfsruau pno1ope ioctyd sDua( sn(0 rtnir3io1fptranvilt tetrim iudalt  nei s arrmumoot4olx ioctydls raump (0 lerxfcia1omtrlivilt  rtrim oy4lmenmivtas  2trx  ;u0opto i3ilt m uluvs t0tlerxoctatopDeaivilt seuoim3oo1alenmnct tf rrmum no1alt mieiytfa uanvo;(0trtrxociydlpte neo;( texmxr ou4lpeelnvtl() Dra(m no1oexnmf3iasfa elu pnu4arxnmfctadlm  aues;(0truo(m3nu4amenliviatf rurx ont1opxomociysla eln p u)tltrioctatomDrlnvs;t texrir3oydlmtemfeslt  2umx pot0aleomfciys s2eluvon() etoxrcoy1lpD  n i;(0trurxm oy1lptemfei sf rur(moou4tpt mociatlsDem(vs;u0tetrifcty1la r nes s0trto(m3no4ap n neiat) ruaxmoot0oltoioeiytfa2elnmpnu4alxoio3oodfpDrlnvs s0sruoxr3oy4llenmiciat)arrr(m oo1texnifctldls uluvpnt0tlxoio3oo1fmte i o s0setrirpio1lleelncilt)s2trx o;o0tpxn iciltfa2elu o t4texnxo iodfpD au o t) 2trir iodome  ies s aDrm(r ou1alxnmf3iytls2umums u) ltrmr iadfat ai ol(0 2tr(o io1ape  ivs t aruru  ou1tltniiciysls2rmums;u0aeenio3iytomDeanvi;t  2xmir3iy4olenlieia( sDraumpnu4apxomietas mDemnmsnt4tetoir3tydomDran ol(  2xmxo oo1lleemivi tfarrau pou4texo feiyt m emuvsnt0tlerio ta1fpDeln sls0s2ur(m3ny4alenlfcia(fa2tau pou4apx ifeiatfs rl(vo;t4aeerir3oodlm r nei s0s2to(r nydlle mnes s  2rrumo;u1ape mi3iatfa2uluvpnt0teeriocoadoa elieilt s2to(opou1lme mfvias  rraxrooo4opxomoetldlaDrmnvon()altrxf3ta1oaD lnvi;t trtr(m3nu1al nmici s)sDum(m nt4tlxo o3iatlm2umnvpnt0treniocoodopD  ies ()sexmxr3ou4al n fcil(  2taurpnt4oee  octaslm2ulnmsnu)treniociydlmteaivsl() 2xrxr3ny4alt  icsls aDumu  nt0aptomoeiat mDrau on(0aeenxf tytla  luvs (  rxmxr io4lm   fcta(  2rmxrp;o0apxomietyd s2ul(ms;(4 rtrmf iytfm e u i;s s2xm(o3io4opt lfvsat)a2tmurpnu0olxoifctatlm2rm( p;t)arxrmfcootlp e ivi ( tetmir3oo1lpe mnctls s2umx  oo1aee mf3tat a el( o u4teenmo todlptelieilt0texr(o3nu4lm nmnvia(fs2um( p;t0tpeo ieildls elu o (0 etoio3totlpD auvilt  exoxopiudalt mfcsas  rtmu pno0ope mfcilslmDem(mp;u4aetoxr oa1fpD  neo;() rtrim3iu4amt mnvi t  ruaxr ;t1aeenmi3iydfs2ea(vs t4aeerxr iadlat aivi ( t2to(m ou4ole lfesls  Dumxmp;u0olxn ietadlaDum( p;(0arxomociytlm elnvil() rxmio oudap  mnei t)aDua(r oo4aleomfciys m um(mp u)aeenmf3iotlp eluvolt  rto(mpiy4aptnlivt t)srum(m no1tlto oeiyd a eln o (0 exoxfctydlpDraivs;t srxo(r3ny1oltnmncsl( a2uaurono1aexomieias a emuvp;t)trenmfcoydop rlu i t0 exmxm3io1ol e iei sfsrrrurpnt1aexo feias a rlu s;t)texomr tadfa r ueo;s setrio3io4lm  livsat sDraurpot4tlt mf3iyt sDem(ms;(0trxnxocto1lmDr ivi;s) rxoxm ou4opte fes sfaDtm(  nt4texo iciltlaDrlu snt0alxrmrcoytopDean i;s) exm(m ny4lpe mfesls)aDtaum ou4optn i3tldls uluvp t) exoxrcoytla rauei;s srtmio iu1altnmicsa()srrr( onu1opx if3tadls2ra( p t4tlxoir oy1fm  lnvs (  2tr(o3ny4lme lncsat  2ra(r ;u0oeeoif3iyt m emumo;u)aetrxo iydfm   i slt)srxoxrpio1lm elfvs s arrmu ooo4oexo ieiltfaDemu snu)alxomfcoo1fmDr neo t0setm(rpno1amtn fcilt)arumxm ;t4teto iciytfaDeaumsn(0aeeoxr tadlateai o;t)srtrxrpoy4optnmietat  2ta(mpou1alto oeiytfs umu p;()alxnmf3oatfmD  ivs t  exo(o3oo1lltelncsa(faDrmu  no1aleoifcild sDrlu s;u0 lxrmrciatomt aivsl(0t2xmxr3nu4lltnlncilt)s2rrum ;t4ope  octldfsDemump t0 eerxo iy1lpt lnvi;( teur(o no4lp n fet s srurxrpnt4opto octytla ran o (4areoif3oytfmDrlnvi;t)teuoxm iu4lpe lnvils  Dua(  no0tpxoifeiatls2ranmp;t4altrxfcoytfa r uesls  2uoiopio1omtn ivia()aDta(ro;o0alx  ictltlmDea(mp t)aexrio oa1fmte i ilt)sexmxrpny1optelfeiat) rur(roou1tpx  o3tltfaDra( pnt)teerxr iytlm  ln il() exr(r3ny1amte icils)srtrxro;t4tltnifciasfs uln p u)alxrmr3oydlmt  nvs (0 2xmxopoy4ll nmnvtat  rrru ont4tpeoifcildlm uau pnt)alxoif3totoptraneo (0setoir3oo1amen nciasf rua( ono4olen fetyslaDeln p;u) reomf iotfateaivi s trxoiopoo1lmen nvia(  2raumpnu4openmfetlsfsDrl(vsn()texnir iodlateai ols)trxoirpoydaleemiei t arum(mo;o1aet  iciltfa2rm(vo u4arxnmo iotlateaivi;(0 rtoxr3ou4alenlfcsat)srur( pnt4optnifeilt sDumu pnu0artrxr3iatomD an ils)trtmxmpou1oleemfcslt) 2rrxronu0oet ifcias a2uauvpn(0 lxnxo3todfmt lu i ( srxoirpiu1am  mnvsl(faDrmx o;u4oex mf3tyslm2uau o t0tlenif ia1la r ivs;s)tetmxmpnu1omtnmncils)s2rrxm oo1apxo o3ild mDul( sn(0aetrmf to1omDraivo s) etrxmpoodamee ici (f Dra(rpoo1aetnmoeiasfmDra( o u)alxnmo3oadlaD ai o s trxrir oo1omt mfvi () 2rau  oo0tex mfetlsfa2um(vo;u4 ltoiociy1lmDrlivs ( trxo(rpiydap elivtlt) Drmxmont4olenmo3iydla2el(vo;()arxrxf iy1lp eaueil( srxo(m oo4lp nlnvslsf Drauronu4ole mf3ilt a umnvo u)tltoxr3ty1la r n il() rxmxo3no1olenmnvi tfarum(mpnu0texn f3tadlm raump;t0 rerir ta1fm rli i;(  2xm(o3oo1alt mnci (  2ua( ont1tet iociadfs rlumo u4tlxnxr oo1lm rlueo;s0s2tr(r3no4om nlivsls) Dur(mo;o1tptoifcias a rluvonu0areoxocootfpDranvols)seurxr3iodal emfcias)aDraumonu1tpxnmf3iyd aDuau o u)aetomo3iadla  aieslt0srumio oodlltemfct t) Dua(r ;t0oex  i3iasls2ulums u4 lxomfcoytomDe n ol() 2xmir io1ll   ivslsf ruaxro;t4olt io3iltfm eauvpnu4treomr ta1fmDr uei ()srtoirpno1omtnmfesatfs2ta(mo;u4aptoiieiadfmDemuvsnu)tetnmfctatopD luvil( t2xrimpiy4lltnmics s aDrmurpot1aeeo i3ias aDumu o ()tltnmf ootoaD au s (0t2umim3nudapt mfcsat) 2tmxrpnt1oeenmietlt aDelnmsn(4trxoif io1lp rai i ()trxrimpny4apeemfvt (farumxmo;u0tpt moctydlsDrmu o t0 eenio3oadopDrlu o;(0 etmxo3no1al nmneslsfa2taxmpou1optnmiciysfm2rmuvonu4tltrirciatfm e uvs;(0srur(o3ou4lmenmncs ()arurxmp;u0tlenifetat s2uaumsn() ltnmr3oodoateai i s0texoir3nydap n ivslt)artrxmo;u4teen fetltfmDumn p ()altoif3oodfaDr i o;s trxoiopoudop elfeilt aDrmxmpoo1tpe  o3iadlsDra(vsn() etnio io1fate ueils0t2um(opoy1op n fct t  Drm( ont1teen fciasfmDuan snt4 rxnxf oatomt  nvs;() 2tmxo iudamt mnvt ()srum(r no0tpxoii3iad sDulu pnt0trxrxo3oytlmte nvol(  ruoim3ny1ame lietas s2ra(r ot0oeto f3ilsls2em(mpn(4altnmr3tadlateanvsl(0srtmxr3oudap  livtatfarraum ot0ope  o3tasfs ea(vp;u) rxoio oytfmDrauvi (  etmirpno4omenmfet t)a2trxmp;t1ope ioeiltfmDeaums t0areoir3totlmte i o t0seum(opio1lle mivtlt)sDururp;t1tptnmo3iasfs ra( p t) lenir iytomDeaueols setmxm ou1ame lnvsas artmurp;u0tetnmoeiatla2ulnmpnu4alxoif tydfa e n o;s0sruoiopoo1lme  fesls)arurx  nt0aex  fcilt sDulnmsnu4aexrmocoa1fa r n s s  rtoim3io4alen nvt t  Draurono4tleniietlslm2rm( o;(4trtnmf3ta1fa  liei ()srto(o3io4apen netls srrm(rpnu1apx ifeilslmDuan pnu)alenmfciy1laD auvo;() rxr(r3ny4omte nvtat  Draxro;o1teeo oeiysfs2el(vpnu4 etrioctatfm r iesls0trumim3nudol  mfvsasf 2rruronu1apto fetlsfa rm(ms;t0 ltoio iotlmteanvi;()srxmxrpoy4op  mfeiasfaDraurp;o4ole  i3ildlsDum(vs u0aetrmr tatfmDrli il()t2toir3iy4am  mneiasfa2rmum ou0aet io3iad aDul(ms t0artoxf iodfm eli o ( setm(m io1ol nlncil( aDuau oot1alx  fctatlm umnmpn(4aeeoxrciodfmDeanei;()s2umir nudopeemiet t  Dur(m nu1alt moeiaslmDrmuvp u4tetoifciatlat  u o;t0sruo(mpno4ap e fcsas aDrrum ou1aleniocilsfaDraums;t4 rtnif3oatfmtraneslt) rtrxm3oy4om nmictls)srua(ro;o1tpt  feiydlm2eanvo;()aetnir3oytoa   ivi;(0sruoir no1ap  mnct () Dum(ro;o1apxn oeild aDrmuvp u4aexrmr3to1fa ranvo;s0 exo(o nydapt  fcta(fsDtr(mpoo0tle moetytfaDemums ()trxrxr io1omD anvs;t teto(o nu1am eliesat s2rrxr nu0altomociat a ranmo u0 lerio3oatlp  aueo;()s2ur(opiu1al nmnetasf 2um(mo;t4oee  ociaslsDeln p t)texnxr3oa1lat aivs;t0 rxmirpnu4op e nctas arrrur ;u4oex  feiytla2em( onu0trtoxo iytlp r nes s sexr(rpou4lp  lnvtl(farrau  ou4tpe  o3tyd sDrmnmo;u)arxrmo ty1omDe nvi s)seur(o3oudoltn fcias sruaum ou4tpeniieiasfm2elnvo;t0teenif oodfp eauvils)tetr(mpiy1lme  fvia(fa2rauro;o4apxo fcias s ua(ms;u)altomo3ty1oatr nesls)teto(rpou1lptelici ( sDrm( pot0aetoiietld aDulumonu0texrmoctadlm rlneils)t2xmir no1lltemfvtatfa2tmumont0alxo feiltfa2uluvo;u)trtnmo ia1fa r ivolt)t2xo(mpny4ape  feiltfa2ta(mp;u1alt io3iasfaDean s t)trxnio iadopt  u slt)seum(o3ou1lmeemiesl()a2tr(m ;t0tex iietltlm ra(vsnt) rxomocoytlpD ln i s t2umirpoodaltelfet t)s2rmu poo0tlenio3tydfm2rlnvp t0 lxnmrcto1latrluvils) exmxo nudole  feil(  Dtmxm ;u4tlt mf3ildls eln snu0 ltrmo iydom rlnvs t)texmxo iy4lm n nvt (fa2uaur nt0opt miciad mDuanvs t0aetnmrcoa1oat livo ()srtr(o iudame  feta( aDur(mooo1apxo ietldla2em(msnu0 reoxrctadlmteanvil(0texr(r nu4ll nlfcsas a2truront1tetomociltfa rln onu0 exrmf3io1lm   u s (0 euoxo3nu1lm  lfvtl(faDrm(m ;t4oetomi3tyd m ulump;(4 exnxo3oo1fm  au olt)s2tmxrpnu4lpt  ies sf Dum(mpot0tpx ii3iysla2ulump t)tltoxr3iadlmt  ivi;t) 2xoxo3oo4amt lfvt tf Drrx o;u0ale ioctysfm rlnmo u)trxrif oadfa  aues;(0srtmxopou4op  lneia(fsrtmu pnt0aet mfciydls2uau snu)alxoircto1omt lnesls0 2ur(rpnudaleelncsas)sDuaxrooo4opx  oeils s rm(ms ()tetnif tatfaDrlivilt sruoxrpoo4omt liet sf 2raumoot4tpxoif3tydfm em(mo;()aeeomf3oydfa  anvi s s2toxopno1al nlfeias  Draump;u1opxn ietatla2rau s u)trtoxfciydlatr ueo s)srtmir oo1al   ies (farrmx o;t1oex  i3iasfs ulumonu4trxrio3oy1lmD aues;t)teurxrpou4lmt mfct t  rraxmp;u1aex  iciys s ranmsn(4 rxnifcty1omte nvils0 etm(m nudal  lnesat)arum(rp;o1oltn fcild sDea(monu) rxoxf3tydlm e n il()trurirpou1ole lnesls)sDrrxr ot0olto i3iat a ua( o;t0 rxomr3oytopD luei;()s2umio nudaptn fci () rrm( pnu4tetniocilsfaDrmn pnt4aetnxr3ta1fa ran olt0setoirpiydlpt  ncs () rrm(mo;o1tleo f3tlt a2ra(mp ()alxoxf oydlm   iei t trtm(o3nu1ope  ivilt  Durx p;o1teto ieiadfa rmnvonu0artnxrciy1fp eli i;t trum(o3nu4ll  lnvt t)aDumu p;o4tpto oetyd m rmumo;(0 rerxr3oa1fmD aueolt trtrxr3iy4olt  ivsa()sDrm(r ou1tpxoifctltlmDuauvp;(0arxoxf ta1oa  aivo (0srxo(o3iodop e ictas srur(ro;u1ale  ieils m rlu o t)tlxrifciytfmD  i i s0s2um(r io4alenmfeia()s2rmxm ;t4ope iictys m rmnmsnt) rtrxfciy1faD luvs;t0 2toio ny1lptnmfct ( arumxm nu0alt ioeild sDeanvo;(4aexoxociodlm rlieo;s trumxm3iy4apenmfcs s)s2ur(rpot0aexoif3iad a um(ms;t4aeenio3ty1lmteaueo;s t2toio nodope mnctasf 2tr(ronu1tlt moeiadfm2raumsnt0alxnxrciadlm ranvi ()t2ur(o oo1om   fci () 2rr(mono4olxn oeildfm2ra(vpnu0treomo3ty1lp eanvolt0 2xr(m iu1omenmfesls)sDumuro;u4tee ifeiadlsDulnvs;u0 ltnmr oytla rlu o t) 2toio oodolee ivs t)srtr( ono1tpx  oetltfa eanmsnt)tetomr3oo1lm eaieo;s seumim3iodapenlfctat a2taxmont4tlt  fetadfa rl(ms;u0trerxociatopD ai s;(  rumiopoo1lp nmnet t) Dtr(m ou1oetoifeiatfmDrmu o t0 rxrmo3oatoaD  ieil( s2xoxr3iydam eliet s) Dta( pot0openmieiysfa ea(vo;u4trtomo3iotom  ai o t0 rxoxopio4optnlfvsas)srrm(  no4tetnif3ilsfm2ra(vsn()artnmf todomDe neo;s0s2trxm3nu1om elfesas) Dtr(roou0olenifciydlaDua(vp (4altoxrciydoaD lu sl( t2trio iu4alen nvsas aDrrumpoo4tptnmieiysfsDemnvs u4artoxrcootfp rlies t0 eum(mpoy1ope liei ()s2ur( pot1ale mo3ilt a ra( sn(0trtrmo3io1fateaies t0s2xm(r no1ape lietls  Drrx  ou1aleo o3ild a elnvsnt4tlxnmo iytopD  uvsls)s2tm(o3iudome  ictltfarrmxm ;t4aptnio3iad a2ea(vsn(4 etnmrcoatopDr nei t0setrxm oo4op emfcs sf rurxrpoo0aexomfetydfa2uan onu4arxrio3tadfat li s s sruo(r oy4am e nvsat sDtaum ot0tpxniicild mDuanms;t0texrmr3oa1fptrln i;()srtmim3oy4om nlicsl(fs2rru  no1tptomo3tldfm ulnmon(0trxnio oytfmDrluvi;s0srxm(mpnu4alen fvi t aDum( oou4tetoiociydla uanvs;u4tetoio3to1fatrlivi;s)t2ur(o nu4ome lnvsat s2urx  ;t4teeniiciys a rlumo;() ltoxr3totfp  auvsls)sruriopou1olenmnvtatf Drmur ;u1aexniiciatfaDelnmont0alenxocoodopD ln olt)texr(o3ou1ame  fcsls) 2rm(mp;u4opt  f3ild a2elumsn()artrxr ta1oat an s;( teurxmpno4alenmnetat)sDur(  ot0tpto i3tldlmDem( o;t)aetnio ia1faD lu s;t  ruo(mpnydapenmfcs s s2ua( o;o4ale  icilslm uau p;t)trxoxr ia1fatrau olt0 rtmim3oydll  mici ()s2ua(root0aptnmoeiltls2ua(mont0artomrcoydfpt lnei;( texoxr3nu4op n ici ()srrrurpot0ape micilt s rmums;t0tltrxo iatfaDean olt0 eurxr no4ope  ieta( aDuru onu0olt ii3iasfm2ranvon() lxoxo3oatlp eaueilt) exoxrpoy4lpe lfct tfaDrmxronu0aleoif3tld mDuau s;(0texnif3iodfa eaies;s trur(m oo1olen ieia( arur(ronu1oetn ictys m emuvon(4tlxrmrctodoa r ivo;() 2xo(o3oudolee ictat aDtax  ;t4alxomi3iat m2rlnvon(0 rxnxr oytoa e uvsls truo(opou4amtemfvt ()s2ua(m ;t0tlx if3ildlsDrlnvo;() rxrmf3ty1omt  u o;s seto(mpoo4lltnlfcia()aDua( onu0aet mi3iydlm2raumo t)trenif iy1oa raiei;s s2tmxo no1ap emnetat)aDtaur ou4olt  o3ilt s2emuvs;t)trerxrctadlmtelues;t s2uoiopoodop emfcs t)s2ta(m ;t0tpxnmieildlm ea(mp;(0arerifctotlptrlneilt0 rxm(mpoudaltelfesas) ruaxm ;t0aexoio3ias m2el(mp;(0texrxoctotoaDrlneo s0teuoxo oydom nlfesl()sDua(mp;t4apt  f3tadlsDranvpnt4tleoio iytlatrliei;t)t2xm(r oy4om   nvtlt) rtaxroou1teenmfcilsfs2uluvsnt0aexrxf tadlpt  ivo ()srtm(o iu4amee feiat) rra( p;u0tltn o3iyt aDranvpnt4aetnxo totfm   i sl( trur(o3oudomte ieils  2tmxrpnt0optnmfetldls umu s;u0altomo3iydfpDe u sl( s2toiopiodopt lfesas s2taxmpot4altnmfctadlm2ul(ms () exoxf ia1faDeln s s0srxoxm oy1alee fvs t) Drr( pnu1optoif3tyt m ranmsn() lxoxrciy1oaDrlu sls s2toim io4ll elfci tf 2uaurpot4oltomietltfm2uaums;(4 lxrmocoytlmt  uvi s)s2xm(o iy4ap elfetl()a2urx  oo4oet  o3ias s rmnvo t0 ltnmfciadopDr nvs () 2ur(mpnu4opt lfvi s) Drm(  nu0tet ioctat a2rl(mpnu0aeenmo3ty1lm r uvs s0 eurim3nodomt lnviltfartr(mooo4aee  o3tls sDul(vsn()arermrciadlpD lnvi;s0teurxmpiydopte ncsl() Duru  ;t4oetoifetat mDul(mo () rxnir3oytlm  anei;(  eto(r iy1lptemfcils arurum ot0oltomictldla2emu o u4arxrio ootop r iei;(0srum(o oy1ll e icias)aDtrxmono1tlx  octadfaDuau s;()aexrxrciydlatr nvol(  2xrxmpnu1lmeelieslsfsrum( pou4oex mietadlaDemn ont4 eerirciydomtr nvs;t0trxoxopiydome mnci t) 2raxrpnt1optomieiys a eln snu)aeeomf3totfm r ivo t tetrxmpnu1apt mnesltfartr(monu0ale mfctldla rm(mo (4trerxocoy1lm r u sl()s2umxo oy4op  lncils)s2tmumono0oetn feiasfsDeauvp;u)trxnio3oa1oa  anvs t0sexrxo ou1olt  nct () Drr( ooo1aexnio3iyd m ra(mp u)trtoif3ootomtr u o () rurxmpny1lpeelicias)a2uru p;o0tpxnio3tad a2rauvp;(4aleoxr3iodop e uei ( s2tmxopoy1ape  nvi ( srrm( p;u1alxomocildfs ulu p t) eerif3iotlptranvi t) rurxo oudlm emict ( sDrmxm nt1apt ifeiytfs2elu snt)teeomocta1fatelneol( t2xmio3iy4lle mneils  Dumx  ;t0ope  fcilsfaDulnmo (0aeeoxr3oydfm rau o () etoxmpnodop   ncta(fsDrmxmono1tpe if3iyt s rau onu0aeenmrctotlm raivs;t  etrir3iu1lptn fctlsf 2rmx  no0aexoioctldfmDrlnms u4tltrir3tydlm r n o;()s2umiopiodamtn nvi t a2raxmp;o0aet  octad s uln s;()tetnif3oadlmt livi s0trxrirpiu1llenmfvt ()aDumx  nu0olx iieilt m em(vpnt)teeoxf3iotoa e nvi;t truoim iydlltelfvs t)aDururp;t4alx iietat a2umn pnt)teeoxr3oydla eauvs;(0 euoxm3nydomt  ncs sfsDurx poo4aptoifeilsfa emu ont0treomf3oo1lm ran ilt0 2to(o oy4lmen fct (fa2uaxmpno0optomi3iasls2emuvpnu0trxnmf3tadfpDr nvs t t2toxo3oudaptelfeia( aDumx  nt1teenmfctysfsDua( s u0texniociytlpD  nvi;( tetoir3nudlmtnmnetas sDtmu p;t4alxomfciytlm2eluvs;t0 renmr3oytfaDraivolt0trum(r3ou4omen fci s srurxr nt4alxoii3tys s2em( s (0arxnif oy1lptr i i t)sexo(mpoudom emnvt s) 2tr(  nu1opt  ieias s um(mo;()teeoxf oatlaDrli o;t0t2trxmpiy1alenlfeiat) rraurpou4aexnif3ilslmDrln pnu0aexriociodopD aivo;s s2tm(opnu4ale mfciat  rua( o;u1tle mi3tydlsDelnvpnt)teermrcoo1opDraivi;(0t2toxm3iydlpe lietl()srtrxront0tleomoeiydfs2elnvs;(0tltnxfciatfmD anvol() rtrxo3iy1ll nmictat sDua(  ;u0alx mictadfmDeanvpn(0aexniociydoat aneols) rxrio3iu1ome mfciatfa2rmu o;t4teeo i3tasls ranvp;u4tlenifciotlp r u sl( setmxmpno1omee fcs t s2rmxr oo1alt ioetatlm eau on(0 eerxf3oytoatr n s t)sexoxr oy4alt lfvslt aruau pnu4altoioeilt m rmu s;u0tltoxrcoatfpD anes;t)tetr(rpoudlmtelnvt t arurum nu4tpe  ietlslm el(mon(4 rtriocio1faD auvols truo(m3ny1lmen fes s sDtrxro;o0tlxn fciad m emn o t)arxrmfcty1fmD  n i;s0 2xmir oo4ale lnei (faDrau o;u4aptn fetyt a eanms;u) rtnif io1fptrai o t)seum(r3oy1ll  mnvil(f rtm(  no1aexnmo3iydlm ul(vo (0 etomo todlp e n s;t) 2uoir3iu4alen ivs tf rur(  ;t0teeo fetasls2elumon() ltoifcio1omD au ils  rxm(m3oodoptemict ( s2ua(rooo0aeeo o3tasfa2umnms;()tltomo ia1fmD lueolt t2xmxrpnydlmtn ivtl()s2tru  no1teenmfetadlm2uauvsn(0teeoxrcoa1oaD  uvo;()srtr(r oo1ol nlncs tfsDtr(r nu4tpx if3tyd m ea( snt4 rxomociytopDrlivs s sexoir3nudlm e nes t)srumxrpou0opeo ieildfs2umumo;(4tlxomf ty1laD aiesl( srtr(o3iudaptn ictl(farur(roou4opxoii3iltlm rau p;t0aeerxf iotfpDean i;t) 2tm(opoodoltelicsl(fsrrr(mpou1aee mieildfsDeauvpnu)tltnmo tydoaD  n i s srtr(opiu4omen fet t aDtmur ;t0tet mi3iatlmDeaumonu) etriocoy1lm eaueilt0sruo(opnu4optemfctas aruaxmpoo1olen ieilsfa ea( o t) etomr3ootopte i i t s2umxr3oy1aptelfctas) rua(  ;t4tltomictlt m2rm(monu0 etnxf ia1oaD  ies (  etoxo3iu1lme mieias sruaumo;u4aee  oeils a el( o;(0 lxnxr tytfaD auesl()seur(rpnu4lme mfcilt)a2ur(mpnt1aptnioctld aDrmu p (4 exnmf ty1lm e u s;s0srtmxo3nodlpe  fci sfarraumpoo0oexniiciasfs2umuvp;(4alenmf3oo1opteanes;s texr(o3oy1omtemfcslsf 2tmx pnt1oeenif3tadfs elnmp;t0aexnxf ty1fm rau o;s)truo(o no4ole  ivs ( a2rm(r ot1tleo ieilt s2um( p;u4 exnir3totfm eanvsls) rtmxmpiu1op  lncta(fa2rrxmpoo0alx  f3iltfm ulnmo t)treomf tatfatelivo;()texm(m3oudoleelicsl(  Dtaxmooo0oleniictadfs eluvpn(4 lxoio ty1la r ieo;t  2ur(o oudlptnlici s  2tr(mpou4opx moeiadlm um( p u0texrmrcta1opte ueolt trxrimpno1apenmnvtl()srrrumpou1tpe mf3tat m2eauvo;(0 rtrmrcoadoatrlnvs s srxmimpny4altnlncslt)artrxm ot1tpxniiciltfaDumuvo;(0 lerxo tatfm rlu ol(  2xr(o oo1omenlietls arum(  ;o1alt  feilsls2rmuvo;u) lxoif3iydlp eanei ( s2tm(o oy1lpeemicils)aDrrxm oo1aptoiiciyt m umums u4alxoiociy1lat lues (0setoim no1om nlnvil()aDuax ooo1aex  i3ias mDelu onu0arxoio3oy1oa  ln i;()s2trxr oo1omtemncsas)aDuaxront0aexo o3tadla rlump;u0texrif3ta1fa  luvolt0t2xm(r nu1alee fctat)s2tm(  ;t4oeenmfciad s emuvo;t)tltnxr3ootfmtrauvo t)t2tr(m3nudlltn iet sf Dtmxmpoo0apx if3tysfa2rl(vont0trxoif todoaD aivols)t2xrxrpnodalenmfet (f 2rmumono1ope ifcild a2emuvs u)alxoif3oatoaDeaieils t2to(mpiu1aptnmnei s  Dumx ono0aexnmietyd s2rmn o () lxnir3tytfm  au sl( s2xo(o3iy4apee nctlsfs2rr(m nt4apxomieilt sDum(vonu)trtomf ia1op   u i;t seur(mpio4lpt mfeta(  2tmur ;t4ope  icildfsDemn snu)tlxrmf oatomteaieils  eumxo io1op e fesat)sDraxrpot0ope  o3iasfa2rlu o;t)treoxfcoatla elneo s0 etr(mpiu4oleelfetat)srurumpoo1optnmi3iys sDra(mo;() exnxo3iodfm e i slt teuo(r3oy4apte ncslt srtaur ot4altomo3tadla el( pn(0artrxo3tydomtraies ()teumir iu4amenmicsasfaDrrxr ;t1optoifcils s2rau s;(0trenxociodlpt  iei ( t2uoirpno1amee fetls)sDumu  no0aeeo f3tld mDulnmpnu)teerxo oy1oa e neol(0 2xrim3oydopt lfcil(fs2rrxm ou0tltoioetydlm2ulu snt0 eeoio3oy1lmt aneol()texmxmpio4ol emicslsfs2umx ont0apt mi3iysla2em(mp t4tltrirciydfa   i i;s  eum(opoy1lptnlncsas  2rrum ou0tetoifctlt s ra(von(4tlenxfcto1lpte ivol(0s2uoxm iy4lmte ics s) 2tm(rpoo1tetomo3ildlaDemuvont)aetoxf tytlpDr ieil(0s2xrio no4amen ivs ()artax o;t0teenmiciysla2eauvsnt0aexnxf to1oaD aieo t)srxmio nodol nlietltfarua(  ;o1altoio3tys m um(vpnu)tltnmocty1oat  nvi ()sexrxrpoo4ome  feslt s2umuroou1tlxo fciat m raums (0alxoxo iytoaD  nes s)s2umir io4apeelncia(farur(  ot1apxomo3iad s2eau onu0 leoxr3oydfptrauei ( t2xr(mpoudll nmfei sf Dur(  oo0alenifeiydfaDel(vp;t0tetoio3iodlpteaieil(  2tr(opou1lm  lfciatfsDtr(mooo1opxoiociltfm2rmumpnt0altoxr tydlmtr ivo;s0s2um(opnu1oltnlnvt tfs2umx  nu1oet iiciasfs ua(ms;t) lxoxo3to1latean s;t) ruo(opno1lm   neil( a2trxmpno4tlxnifeiydlmDem(mp;t4 ltoxf3to1lat  nvilt0t2to(m3oudllt lnctas  2ta( ont1aptn ietld m uln s u4artrxf oatom elu ol(  eurxmpiy1lp emfeta( sDraurp;t4alenmfciad aDrmuvs (4altnmf ia1lp  aueslt tetrim iy4ol emnes tfs2tmxrp;o0tltomoetaslm2ua( pn(0tltrxo tatlpD lieo ( trtrxo3ou1al   ietat) rtrurono0tlxnio3iydla uaump t4trerio oa1op eaueil(  exo(o3oo1lme mnci tfaDtr( p;o1optn ieilt s2rmnvs;t0 lxoxf3iodlpD lnvi;t t2to(rpoo4lle mncils  rum(mpnu1aexn feiatlaDem( snt0 ltomo oa1omte uvs;s0trxr(opoy1lme  ictas) Drru onu0tex  i3iatfm2rl( o t0tetrxoctydom r uei;t0t2xmir no4op n nes sfaruax pnu0tlx mf3iasfm2ul(vsnu4 rtnir3oytopD luei t0 rxoxrpnudapt mfeslt s2uau  nu4tee mieilsfm2rmuvs () rxnmf3oadlp   ivilt0 ruo(m nu4op emivt tfaDrm(m ou1alt  f3iasfa emn o;u4 etoxf3to1fmteaivi;(0 2uoim3ou4ope  nviatfaDtr( pno0opxo feiad m2el(vs;u4tlxoiocoadopDelu ilt) 2tm(o3io1al  miet ()artaum ot1texnioeild a2ua(vp;u4 eerir iatlptrluvi s  rtmxopio1oleemnet (fsrtaxmpou4apxoiiciatla2emump (4alxnmf oodfmt  uesls0sexoir3nu4lpt mfvt (fsDur( p;o4oee ii3ildfsDumu s;u0 lxrmf iydlm r nvs;t)t2umxr3oo4am nmivsltfs2rruro;o1olto i3iadfmDranvo;t4 rtnxr3oatlp e nvo s) etoxo3oo1ol  licta( srtm( oot4opt mfeildls el(mo u0trerifciydfm   n ol()t2uoir3oy4olen icilt arrrx onu4ope io3ilt s um(vo ()aeenir3tadom   nvo;s0 exo(mpio4lpt  ivtasfsDtmx p;o0teto iciyd m emuvp;(4 eenxfcto1om rlneilt0srtmxm3oodllenmivt s) 2ur(mp;o0tlxo ictatls eluvp u4 lxnxrctatla eln il( s2tmxm nudlm   netlt)sDrr(rooo4tlen o3tadfa elumo t4artnxf totom raieo t tetrxm3iy1lm emncsasfa2rm(r ;t1aptoiociytfs2rlnmonu)arenxoctotlatrlivi s)seum(o3oo4op   iesat)srur(root1olxo fetad a2eanmp;t0tlenxrcoatlaD auvsl(0s2umir iy1ale  ieilsfaDum(mp;u4aeenifeiatfsDrln o u0treomf oa1fa rau sl(0trxoxrpoy1oltn fcs tf 2rrxmpoo4tpenio3ilt m2rlu p () etrxfcoodlmDran sls0srur(o oudlme  fvtat)arururono4tpxniiciltfa rluvs (4tetoxrcoa1fatrlivslt s2trxr oudlptelies s)a2trumonu0altomi3ildlmDra(ms;t) etomo to1la  luei t0tetm(r iudlp nlietat)aDtru pnt4oexn i3iaslsDeauvo t0aexrir3oydomt  ueo t) exm(r oydoleelfesl()sDrr( p;t1apxo ocilslsDrlnms;()tetrxrcto1la rlnvi;s)s2xoxmpoodlle mnesl(  Dta( o;t4tlto iciydls rm( pn(0tlerxocoa1faD aivils trtm(r3iudolenmnetatfs2trx pno0olx  ocildlm2eanmo;()trtnmf iytlpDelu s t setm(r3oydlpe lfcta()s2trumpoo0oleo ociyslm uan o;(0arenif3tydlp r ivo;t t2tmxrpiu1ap  mnetas)arrmxmp;t0tlxoifciadfa rlums;u0tlxnio oo1latranvsl( trtmxr3oy1altelnvi sfa2umxm ;o1apenio3iys m rluvp;t0arxrir3iotfat  i ilt setoir no4oleelfei t  Dtmxr ;u0alto oeiltfs umnvo t0trxnif iatfp  livs;(0trur(r3nu1lmeelfvia()srua(rp;u0aptomi3iltfsDrl( p () lenif oytlaDeluvo;(0t
\ No newline at end of file
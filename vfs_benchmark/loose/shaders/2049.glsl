@@ -0,0 +1 @@
+ieilt)s2urir3oy1lptnlfvil( srrrumoou0tptn f3tlt mDel( ont0tleomocty1fp   i sl(0srur(m ou1ll elieia(  Dumx  nu0aee  fcilslm umumo;() lenmr3ty1fmDr uvo;t) etmxo iy4apeemnei t s2tax p;t1apxo fctldfs2rmu s;()trenmf3tytlat  uesls0teuoxm oydalt  icsat sDumurpno1tpx iiciyd a em(mp u)alenmoctotfatrlies;t0setrirpno1alen nvsas) 2urx pnt0apenmf3iat a2el( o;u0aexrif3todla  lneol()setoxm ny4amt lneil(f 2uaxronu4apt iicildlaDrmn s;t4trtnxf iy1fmtrlueilt0texrirpiudom emfciat) Durxrpno0tpxnmfctas sDra(ms u) reriocoytfmt  uvilt)trurxr3ny4op  lfctl(  2tm(m nt1tlxoiociad sDem(vs t)alxnmr iatlp rauvs;s0sexrir3no1altelnctls)srtaxr oo0oexn oeilslm rm(msnu0 renio3ootoa   n s;s t2to(r3oydlptnlncsls s2rmxr ot4opeo feiadlm rl(mo (0alermo3iotomDraues;()setrxr ou1opee ivsas)artm(r nu4tlxnmo3ildls uau o u) exomfciy1oatrli s;()t2urir3iudap  mfcslt aDum(  nu4apt ii3tadls ul(mp u0trtnxoctadlate u ol()t2trio iudomenlnetat s2rmxro;t1altomociytfm ua(mo t)teermocty1fatrlieol(0 etriopiu1openliesat) rta(mooo1aptn ietydla2rl( s;u0arenxr3tadfm e nesl()sruoxopno4op emnct (faDtmumpnt4ope mieiyslsDuau o;u4aleomo iydfm  lies;()trtrxm3iy1omen iesa()artm( ono4aeto ociydfa2ean o;()aeeomr3oytfptelueo;s)t2xr(o iu4oltn fetas)a2taxr ;t0tle  o3iyt a rmuvp t0 rtnmf ootopDr u s;( trur(o3iodom nlietl(faDrmumoou0apx iociydfs2ul(vpnt4 eeoxf3to1fm rauvsl(  2xmxo ny1op n ivs s aruau pou0texn f3tldls ra(ms;u0tltrxf iatlp rlneil(  euoxm oy4ome mfctltfartax onu0aee ifctyt a rm(vs u)treoxocty1omD lu ils0 2xr(o3nu4op e fcs t arumxrpot4olt  feiyt sDumn o;u) exnxf tatlp  lnvo;(0 rxo(r oo4ale lies s  Drau p;t1oetomf3iadfm emn snt4 eerir3iytlateai s;( s2to(r3no4lmtnmneias aDtau ono0alxn fciatfm rmn pn(0arxnmr iotopDelnvsl(0t2umxo3iu1alt mnvsa( srtrx pot1aeeomi3tlsls uanvs t)tlermfcta1fpDeluvi s setmir3nu1lpt lnvt s)s2tm(mooo4tpto fcildfs ra(mp u0aexrxr3to1om elnvo;t setmir oy4lm nlietas a2ta(mp;o4tltoii3iadfa rm( o (0altnmfciydopDelueolt0 rxm(m3oo4alte netlt)sDtrx  oo4tpe  i3ildfs ulums u)tlxrmf tatlmDr ueo t  eum(r no1lp  mfetasf Dtrxro;t0tetnmf3tatls2uaumonu0 lenifcio1lpt  uesls setrxo3no4ape mfvsl() rrrxmpnu4tptn fctltfa em(mo (0teeoxf iatlptrli o t)setoio iudapt lieil(f Dtaxm nt0tpx io3ilt s ulnvs;(0texomoctadlat  n s s t2ur(r3io4lptelncs t)s2rauront1tpe  fetytlsDuluvo u) rxoxr3ootla r i o s trtrxrpny4omeelnes t) 2ta(rpnu0tleo f3tys m uau onu0tlenmrcoodoa r ueo;s0s2tmio3ou4lltnmncsasf rrrur ;o0oexnmi3iydfm2umums;u4artoiocia1faD luvol(0 rtr(o3iu4olt mieta(f Dtau  ou0opx  iciytfa2eln o;u) eenmociotfm e ivi t  rum(mpou1ll nmnvilsfs2tmx o;o0ale  f3tysfm2ul(vp;u0trxrir iy1fptrlu i t0trtrim no4opeemfcsls)aruauro;o0aee micilslaDran p;t0tlenif3tadlpDe ueo;(0trtmim oo4ole lictltfsrrrx  nu0opxomictysfsDrl( s;(4 eenxf3iotlatrln o;s0 euo(opio1ll elivsas s2ra(m nu1tle ii3tyd sDul(vs u)aexnmo3oo1faD  i i;t0 2xmxm ny4omt  fci sf Drm(r ot0openmocildls em( onu4aeenmr io1lpDrln o s trur(r io4openlfvi (  Dtru o;o4tle mfeiatlsDua(vsn() rtrxrciy1lmDrlu i s  rxoxm iy1lmee fei ( arrm(mono0oetn oetyt s em(vo;u) etnif3oy1op  ln i ()s2uoir oydop nmfcs t artm(mont0oexoii3tas m eanvo;t)trenmrciodomDeanvil(0trxmim3iydomtn ictl() rra(rpou1aetoifetlt s2elumo ()tltnmfciytlpDe uvo s0 rxm(opiodol emnvtltfaDta(r ou4aeenifetad s2el(vpn(4alxnio3iotoaD  neo;()texrir3oy4olenmnes s)aDra(rp;u4apenmieiyd a2ul(mpnu) lxnxr to1lpDeau i s0tetrir3oy4al e ivi s) 2tmumpno0oeenioeilt s2el(vont0tlermrcoy1lm rluvi ( srxo(r3io1opee ict s aDuru pou0tlxo feiys m2ran p;()tlxoxocootlptr neols) 2xmiopiy1ome  fvtlt)sDtmxro;o4olxnmf3tyd s rluvp;t0 rtomrcoytfmDelivi s) 2umim oydome mieiat  rur(ro;t1tlen ictyt a2ulnvont0 rxnmrcoa1fa rlivs;s s2tm(m3ny1amtemfctltfsrraurp;o4ape mf3ilt mDumu o;u4teeomfcoodop eau s s0texmxmpiudlpt liet s srrauro;t4opeo ocildfm rmuvonu)aexnxr3to1omDe ivi () eto(o io4ol e icilt aDrmxm oo4tetn f3ilsla2umuvpnt0artoxo oydlm e ivo ( s2umxo nydom n nes t) Drmumpou4olx ifeiyt m eanvpnt4arxomo3io1opD lueo;t)teurim3iodol nmict t  rumxmo;o0oee mfciydlaDulnvs (0 rtomr3oy1lmtranes;( s2ur(mpny1opt  nvslsf rrmx  oo1ole moeildls ea(vs u0alxnifcoytomDeauvols0 2xm(m3oy1ome mivilt)srum(monu4optn fciatfsDumumo ()teenxfcootomte iei s0s2xmxm ou1optnmfesas)srrmuro;o4apt iictatls2eanmonu4aeeomr to1opDelivs;(  2xmim no4lpenmfesas sDum(  ;o1oeenifeiytfmDumnmo;() lerxfcty1fa rauvol()s2tr(o oo1lptn fei ()arrrxr ;t1apenifcilt a2rl(mo ()teeoxr ta1lpt  ivi ()t2to(o iodopen nesat srrrur ot1alxnmieild sDea(vs u)arenmo iadlpDr iei;() etrxo oy4olt lfvsltf 2uaxmpnu0aexomfeildlsDemuvpn(4aexomf tatlp eai olt0 2uoio iy4omtnlfvia() 2tmum ;u4openiociytfm2eau s;t0tetomrciadom  auvi ( srtmxm3nydlmtnmncsas)srtrur no0tee mociys mDumu p t0artrir iodfmDr u s;s) rxo(rpio4omt  ivt ( aDuru o;o0apxnifciys a emumo (4trerifcta1om r nvolt)t2tm(o3oudome  fct s)arum(rp;u0tetomf3tadlmDelnmon(0tlxrmr tadfat  nvs;t)sexoxr3oodal e ivs tfa2rrump;o1ole  fciadfm ua(vont)arxrxoctotlatelues t)setr(opio1omt lieiltfsDrmx ooo1oltnmfeilsls elnvp;t0 exrircoytlm   ivolt0t2umiopnu1llt lict ( s2rmxr ou0opxo f3iadfmDuln p;(4 rxomfctatfptraivs;()trum(r3iu1ol   nesat  Dtaur oo4aeeo o3iltfaDea(mp;t4altrir oytlm  aivil( t2umimpiu1lmte fcsls)aDtrumont1olen octad m rl(mp t0arenmrcoydlp rlivol( teumir oo1apt mivilsf Dumxmont0alto iciyt s eln p;()tetoir3to1fa ean ils0sruoiopiu1ap  lics () 2uru pou0oee  f3iys sDrmu snt0tlermr3ta1fm rauei s t2uoxr nodom elfct s)arrrx p;o0olxnio3iyt m ul(mp (4trerir oodlm eanvs;()truo(m3nodaptn ivils a2urxrp;u1olx mfeiad s ul(vsnu)artrir tytoa e u i;s  ruoxopoy1lltnlicta() 2umu o;u1tpt miciasfs2uan p;u)arxrxo3to1la r u olt)seuoir3oudomee nviltf 2um(mpno4teeoif3ias a2el(monu4trxnxo3ootoaD  i sls0t2xoim ou4apee ncia(fsrtmuront1tpenii3tytfs2ra(vpnu4tltomo3totopDran il() exr(mpio1lptnliviat) Duru  ;u4teeoioctadfa em(vo;() leniocoo1lmDeaiesls)trxo(o3iudoltelivt s s2rmxro;t4aexniictlsla rmnvp u4 lxoxf3ia1fptr u olt0 rxo(rpoo1al emfvt sf rrmu  nu4oet moctyt a rm( pn(0trtriociydfmteaivol(  euoim nodome lfeilt) Dtaumpou0oleomfeiadfm ea( s u0tlxrmo io1opD  u i (0setr(r oy4om  lnetasfsDra(mo;u0oeeo fetasfa2ranmont)tlenxo tytfp   ivsl(0srxoxo iy4opt lnesls srumur ;o0olt  i3iat sDuau snu0arxrmfcto1fmDraues t0 etmir3ny1lm  mivias)sDtr( p;t1tlxniietltfa umuvsn()aexoxf3iotlpt  ieols0s2tmxmpoy1llte neilsf rumxronu1altomoeiad m ranvp t4texoxrcoytfa  au i;t)t2xm(o3iydolt  ncia(f Dtax oot0texnioeildlm raump t4aexoxo iytopt aivo;s truoimpio1olee fciat  2tm( ono0aeeomiciyt mDea(msnu4artrxrcia1lpt anvsl(  2tr(o3nu1llte fctls) Dtmx ont0opt iicias a2rmuvs u0aeenif3oadla  lieo (0srxm(m ny1altemfcsat aruaxrono1oeenmfctyslmDea(ms;u)artoxfcia1lmt lies (  rxr(o3iodllt mict s aDrrxr ;u1oeto octlsfsDulnvs t) rtoif oadomDean ils) rtrim3io4lp e ics (fa2uaum ;u1olxomi3iytlsDra(ms u) ltomrciatfmDr ivslt) exoxm3ny4ole  ies ( s2raum oo4olto icilslm2emuvpn()tleoio iodlm   i o;t  2toxrpio1lpenmnvtl( sDuaxr nu0ale  o3iysls2raumsnu)aetoxr3tatomt  uei;s)trto(m3nydlmt  nviat) 2trxmont4tpto iciat mDran o t0 lermf ia1om eli i (0 exoxopiy4lme lfeiat  2rr(m ot1oltn ieiytfaDemnvp;(4 rxoxf3iydom   u ils t2xmxr3oy1lp  lictat srtr( onu0tex io3iaslsDuanmo;(0aeerxocia1latrli s;(  2xmim3io1om nmfesl(faDurxroot1oexnifctltla rl(msnt) rxriocoodfm  livo s) exm(o3ny4omtn fvt ()a2tau ont4optn ictat a2eanmp u0teeoirctatfm raneo t0sruoim3no1lltn feslt) Dum(rp;u4tlxoioetadfa uln o;t0 eenxf3tydoat  neols)seurxr oodomtelfcsl(farumu  ou0opeomfctad m2uauvo u4trtnxo oatfp e uvs (0 rxr(r oy4omenmfct t)s2uax p;u1texo o3iltfaDumnvsnt)tlxrxrciytlpt livil(0 exrxo nu4oltn ivia(f rra(m ;u0tleomfciad aDrlu p t4 etrxf3tatoaDr neo;t0 2xmim3nu1optnlivil()s2uru ooo1tpx moctas s2rlums t0trtrxfcoy1fat  ieol( t2xr(r3nydolenmfvslt  2rmxmpot4olxoioeiad mDrmnmsn()tetnmo iydfatean il( s2trir3iydom   ici (  Drrxmp;o1teto f3iytls ran snu)altomr todlat an slt  euoxo3oo1optelivilt)aDtaxmpno0oeen o3tltfa2rlnvs (0texnmocoadfmDe neolt) rurim3ny4optn net (  2urur ot0texoioeildla ranms;t4 reoio oa1oaDrlu s t t2tmxrpio4lptelfetl( srum(rpoo4tetnmfciyd aDra(mp;t)artnmoctatfa elnvi ()s2xmir3iy4om elfctls s2taxr ;u4alxn ieilt a2umuvo t)artrxf ty1fmD  nes;t setr(r oydal e fct () ruaur nt0texo ieiasfmDulu o u4 ltrmr ty1fmtr uvs t  2to(opnu4oltemnctat srtrxrpou1aptomicils s2rlnvsn(0aexrir ta1fpte ivilt  rxmir3nu4ll   ncsa(fsDrmu pno4tlxo oeiysfa emnmo;u) exrio3oatomDeln i;s0s2xrxrpoy4alen fetlsfs2urxrpot4ole  oeiyslm eaumont0 eenmf iytfmt  ues t setm(o ou4lm elfesls) 2tmu poo1tpenmoeiyd a2ul(mp u0 eenxoctatoa rauvsl(0sexo(o nu4llee fvia() rumuro;o4tptoiietat s2rm(mpn(0aeenmr3oytom   u s s)seuo(m iu4ap  lfei ( a2tax o;t1oleo i3iydfs2rm(mo u4 etnmo3tydlpDelu s t setm(o3nu1lmte netat)artr(m ;u1oee mfetad mDemn onu0 lxnmfciatfmteau o t0 2umxo oo1alenlicilt  rtm(mono1aet  ictydlmDrl( s ()alxrxr3iotomDe uvi;s  eumxo3nodam nlneil()a2taxmont4apt  fciyd a ul(msnt0 renmo iodop   uei;s0tetmirpou4om e fvtl(  rrmu  nu4aleoii3ils sDrm(vs (4aexnmo3tadfa r u sl()srurxm oudolt lfvtl( srtaxr ;t4alenmocias s eanmpnu0 rtnxo tatom rau ols)t2xmir no1lpeelnvsa(fsDtrxr oo1altomo3tlt sDumnvs;(0altrxr iadlmDran o t sruoir oudoptn ies s  rtmx o;u1opxomf3tytfa2ulu snt)aleoxf iotfpDr neilt0 2xoim3iudaltemneta(fs2raur ;u0oeeoiictltlaDuauvs t)arenirctadopt lueo;s t2tm(rpou4opeelict (  Drr(mpnu0aetoioeiytfa2elu ont0altomf ootopDeluvs;(0setm(mpnu4ope  nvt ( arta(ront1oex moeiltfm2el( o;u4trenmrciadoa e n il(0teurim ou4lmenmici sfs2ur(mo;u4apt  oetydfsDel( sn(4aetniocta1fm rln i s0srtrxr oudlltnlnci tf Dtrxrpnu0tlxniietaslsDrlu o t4aexoif todoatrluvil( setmim no4olt miesas)artmxroot0tltomfetydfm2ea(vo;u4tlenio3oatoptraues;t0 rumio no4lpe livtls aDrrxro;u4tpxoif3iyd m rau p t0 rxnxf3oytom rlivils0 etr(opou4ol e ivi (f 2taxrono1opxnifciysfa2eanms;(0trxomr3iotfatraivi s)s2ur(o3iy4al nmnet t  rta( ono0apxn icilsfs2ra(vonu4trxnxf3iodfa raivo;t0 rurio3nodapenlivil( s2umx poo4opeo f3ildfaDrm(vpnu0arxoxocty1fmDeliei;s)s2to(mpno4om nlfvsa( arra(mpoo4oetnioetasls2um(mp;t0 exoxo3iy1op elnvs t)s2xmio nudll n fes sf Dumu ono1opeo oeiadlaDeanms;u4artrmf oy1la rai o;()s2xrxo3ny4ole lneia(fa2rmurooo4ape  o3iydls2umuvp;t0aeeomf3oodla e ieols0srtr(mpnu1llee nvsa(fs2rmum ;o0oexnmf3tltlm2el(vo (4tlenmf iodlp  aneo t setr(r3oodll  lneilt)aDrrxmp;t0teenmieiatlmDemuvsnt0tltrxrcto1fa eauvsls0 eumir iy4apt lfct t) Dra(moou1apx mf3iatlm ul( o;u4 lenir tatla eaieo ( s2tm(rpoydll   fes sfsDtaurp;t0aptnioeiytfs2ul(vs;t) lerxr oydfpDrai s t)texrxo3oo4olt mivsasfsrur(r ;u0aex  feias aDrm(mp ()trtrmr3oatoaD lies;s)s2xmio io4al   fesas)artmum oo1texoii3iadla elnvp u)aexoxo3iodomtrau i;() exr(r nu4ape lfctat)srtru  nt1alxnmf3iyd s2ea(mo;(4tlxrir oa1fmD lieo s0 rtmxr3iodomenmfvtl()srumxroou0oleo fciaslaDeluvsnt)aeenxrciadomtr n slt0seuoim3nudapenmfcias)a2tm( p;o1ape iietadla2ranmsn(0arxoxo3tadfa rau o;(  2xoio3oo1optelivtasf Drr(m ;t0aptnifeiad sDumuvsnt0 rxrif3iy1op rliei ()srum(r3iodllen nci t)aDrm(mpot0teen ociad a2rm(vo t4 renirctodlpD  nvs;s s2tm(o iy4lp nlnvs s)srrru pno1apeo iciatfs2umn s ()trxomfcoa1op eanes t  ruoimpiu4lm emnci s  2tau o;u4alxoif3iad a2rm( p (4areoxr3ia1omDrli o (0 rxoxr ny4lmenlnesa()aDrm(mo;u0tptn fetlsls ua(von(0areoifctatoa eaues;s)tetrim3oo4olenlfcs sfa2ra( o;t1texo fetltlm rmuvp (0artrmf oydfaD lues (0t2toir3oydlm n icia(fa2rrumpoo4tet mietydfa el(vsnt0 eeoio ootfp   i ilt0t2urirpoydamtelfesat)srtm( ont4olen o3tlsfs eln o;t4alermo3oadlaDelueo t  etmxr nu4omen nvsa()arraxrpou1ope  ieiydla2ua( s (4aeerio3tydlatr u i t  rumir3oudalt  icsas)arumxr nu1aetnmf3iasls2umump t0teeoxrcta1omtr i i;( teumim3iu4opeemfci tfsDtrurooo1aeenio3tadlmDrmums;t4aeenmrctydlmt ln slt0t2tr(rpoodam emnciatfarum(rpnt1teto o3ildlm2em(vp;u4trxrxr3iadfpDelues;() 2xmxo oy4olte ics ()sDrr(  nu1oeeo iciadfa2rm(mp u)arerio3iadopt  u i;s)tetmxr io1om nlfvtas  2ur( pot4aptnmictydlaDelnvpn(0artnxf3tydfpte ueo;s0 rxrxr io4lleemivilt)sDtmxmpnu4tltoifeildfs2ea( p;(4trxnifctytlmt anvs;( s2umxo io4opeemiei (fa2ur(  ;o4alt mieiasfm2uln o;t0treoxo iydop eli i;(0 rur(m io1lp  mfvsls a2uaxmp;t0tpxniiciyt s2uau p;t0 etoxr3todfa rlu o;s) exrxm iydalenmieils  rrax o;u4apx ii3iydlmDrmumsnt0artnmocoatom elieil()texrxrpno1amtnlivtlt aDtrxmpnu0tlx moetld a2umnvp u0texrmfctotla  lnvo;s)t2xoim3oo1amee iei s arrrumont0aeenmf3ils s2ea(mont0aexnifcta1fatean o ( trtmxr3iydal nlfci ()a2tr(m ot0apen ocils sDem(ms;u) eeoifctatoat lnvo ()t2ur(mpiu4om nlnei ()sDur(ronu4apxn i3iysfaDrl( pnt0 rtnmo3iotlp eaivils0 rtm(opiodom e ict s)sDra(rp;o1tee mi3ias s ranvo;t0 etrif oa1op rauvs;s0teuoimpnu1ol  mivt s srrrumpnt4tle ioeiatfm2umuvs;u4aleomf3ia1omDrauvo s)t2xmimpnu4omee iesasf 2rmxmpnt0optn ieiadfsDrmnvo u) exoifcoo1omD an o t0teurxo nu4op emncia(  2truroot1apeoiociadfaDum(vpnu0 etomf3totoaDeanes;()trtrxo3ou1ap  mfcias)aruru  nu1apx  oeiyd s2um(mo;(0 rxnxf tydop e nvs s  eurirpno4am nlivt s arrm( o;t1oexomfeils mDeluvo;u4 rermf tytlpte uvs;s)trxo(r3oudlmt licia(fsDrm(roou1aet ioeilsla2ul(vont)tetoxfcoatlmDe uvo s  ruoxr oodame  ivt (fsrum(ront0alxnmiciytls uanms ()artrif3iytfm  lnvo (0 exm(r3nydam eliesasfa2tax pno4olxomiciatfa2uauvo;()texnmf tadoatranes;s0sexmxopnodolee icta(fsDrrur nt0aptomociytfa rmnmp;(4 exrif3iadfp   nvils0 2xo(o3io4al nliei t)s2uaxm ot4tpen ieiydfa ulnmp (0aeerxf oadop   nvi;s)s2xrir oudlmtnmicias)sDuaxmpou4olt ii3iytfaDean p u4altoxr3to1op eau ol( s2tr(opiydopte ivtl(fs2rm( ont4tpt ioeiasls2um(ms;(0 lxrxo to1lat luvs t)t2um(o3iy1llen ncsas)srra(root4tex  f3tldfm ean s t0 rtrxr todlmt  u s;s0 2xoirpio4op emfetls srta( pou4opt  fciltfa2ua(vsn(0arxnio3oytlaD lnvs t0 ruoim iy4ape  fvils srrm( ont1tetn fctydla ua(vo;u0tetnxo3oy1lm raivi;t  2uoxm3iu1ll nlnesas) Drr( ono4oetn f3iatlaDulnvp;t4trtnif3iatfmDe ues;t0seurxopio1al nlnctl(  rtmxm no4oeto fctlsla rlnms () reoxr ty1omt ai sl()t2trim3nodomt mfci s sDrrur ot0oleomiciltlm rluvo;t0arenircia1laDrli sl( t2xmimpou4ll n net s a2uaurpou4oleomfeilt a em( s u) rxoir oatlat  uvolt srtm(mpoudal elfvsa()s2ta(mp;o0opxoii3iys aDrluvpnu0 lerxf3tadlmD aueols0 2to(o3oy4altn fctltfaDra(m ot1aet  fciys a2ean s;(0trerio3iatfaD li sl( trtmio3iy4alee fei t  2trxmp;t1olxoifetatla ra( s (0 leoxrcta1opD ai s;s0trtoxm ou4lltelnctas)srtrxront4aet  fctadfs2ulnvp;(0alerxoctadoateauei;s0trumirpou1omt  nesa(faruaxm nu4aetnifeiatfs umu s;t0alenifctotfmDr ueo;s) exmim3oydlpeemfci sf Duax pou1opt io3tatfa2rmnms (0 rxoiociydlaDrln o;s)s2xmirpou4ap nmfeiltfsrumumpot4aex mfctlsfm2rmn s t0 lxnmo iotlm e ivilt0s2tm(mpou1aleelnesas)srrrx o;u1apt mf3ias mDul(msnt0altrif3iytomtean s t s2tmxm nu4ll nmnetltf 2rrx ono0tpt moeiytlsDemnmo;t) exoxfctatoateluvils)srxr(mpno1lme  ies ( srrm(mpot0teenii3tas a2rmnvp t) rxnmo3iadoa eaies ()teuoxopou1lleemivias  2ur(  ;u1apxnio3tls s eanmo;()aexoif tytoa eluei;(  rxoirpny4ameelnes sfsruax pou4tlen ociydlsDranmp u)tleoif totomt luvolt  etoxo oydllt mncia()a2tmxrpnu1alxnioeiadla2em( s u)areoircoy1fpD lnes;( seur(r3ou4opt mnvi t) rtmxmo;o0aee ifetld s rm( on() reoiociatfp rlivo (0trur(m oydllt mncs () Dta(rooo1tptnmfeilt sDelu s u)tetniocto1omtraieo ()sexoimpiydlpt mictl(farrru  nu1teeoio3tytfaDean o;()aeenircoy1fp elnvi;t  exmir3ou4om  mneiltfs2tm(m ;o0olx mieiaslm umu s (0tetnmf tytomtrlneslt0srxmio nu1lmeelicslt)aruaxm nt4ape  ieiltfaDra(vo;t) lenmr3oydfm elnvs t)s2xr(mpnu1lme mnviatfa2raum oo4tetn ietadfs2eauvs;t4 rxrxr oy1om eluvslt0 2xoir3iudlm nmfvs () 2tau pnt4tpxomi3iatfs elums u)tltrir3iy1oa rau ils  2trxr iu1lp   ietas) 2urx  ;o1alen o3iydfa uln pn(4aetniocto1fpD  uei t)srurirpiu1oltelfvt sf ruaxm ;u4ole  f3ildls uln pn(0arxnxo3iy1lmDr u s ()setoxo3oydllen icta()arrru  oo1tpxomietatfa2elnmsnt) exomr3todlmtrauvol(0 rxm(o iy1ame  fvt sfaDua(rp;t4teeomfciltlm2rmn o;t4teeriocoy1oateaieo;() 2toxm nodapen ivilsf 2ra( p;t4tlt mo3ildlm2umu ont) ltrxr3oadomtr n il(0 rxmxm3iudapenlncsl( sDumx  ou0aetn fetltls2um(vpn(4trxnxo3oodfpDr uesl(  rxoirpiudope  ictat) Durxrpoo4apxnifetytfmDulump u4tlxomfciotopDeaueols) exmxo io1llt  ict (f Duaurpnt0aptn oetasls umn o;(4aeeoxociydlm raivo;(0texmimpny4lle  neia( aDururo;u4oeeo o3ilsls2rmu onu4 rxrio ia1fpD  ies t0t2xmxr3nu4apt  iesa()sDua( pot1tptoii3tysfmDum(von()arxrmrciatlmDeaueolt)trxrxrpno4lmtemnetlt)artru  ;o0oetnmociysla ra(vs u4 eermfcoydlmt  n o;t0truoxm3ny1omee ivtls aruru onu1tetnifetld s2ra(vo (0tlenxo iydomD livs () rumim3nudap nlncilt  ruaxr ot0apeomoeildla2rmn snu4arxnxo iadfa eau sls) etoxopoo1om  lncil(  2tmu oou4oltnmiciyt a2uln s t)aetrmo iy1omDe uvi;()t2umxr ou4ll  lfvsa(f rumu  ot0optniictyt m2elums u4aetomf3tadlm rli s;(0texoim ny1amtnmfvtltf rtrxro;o4aetnmietltfmDrl(vont) rtoifctytlmD livi;t  exriopoy4lme miesat)artmxmpnu0tlxnifciydls2um(mo;(0tltrmo3oy1lat li i;( trtoxo3iy4op  mnctl(farumum ;o1tetoii3tls mDra( o;(4trxrircoy1laD  ivi;t0s2uoirpnydll   nvta( sDrau  nu0tltnmocilsla2ua(mo u4 rerircoytlp  livo ( sexoiopoodamt  fcs t  2umxm nt0tptnmoeiytlm ua( p ()areoxrctatoatr n s;(0 etr(mpio4omtnlietls)a2rrxmono0apenii3iad a rl(vsnu0trtomf3tadlpD lneo;t0trurir ny1amee ieta( s2uaur nt4oexnmietyd a2ea(vs u4 rxnmfciadfa raueilt)t2trxm3oo1al  mieia() 2umurpou1tlen feiytfaDuaums;(0trxrmfctytlaDelu s;(  exo(opou1om emnctasfaruaumpnt4tlxo f3tydlmDelnms;u0alxnmfciydlm  aies;s) 2uoir3iydalenlnvs tfa2umu poo1olx ifciytls eanvp;(4trtnxfciadopDelueol( seuoxm3ou1ame mnct s aDrm(mono0ale  ociydlm rl(vsn(4tltrmrctodfpDeanvil(0s2xoxm3oo4oltemnvsatfsDtax ono4tee moeild m2umuvo;(0artniocoytfpDelu sls)srxoxr ny1ol nlietl( sDuaumpot0opxn feiad aDelu sn(0altnxrcto1fa raivi t)t2umim oo4lp emictls  rtruro;t4tlxomiciatfaDua(mont) rxoir3iydfm eln o ( s2tmxr ny4aleelicilt  rrm( poo4aeen ictydfm rmn sn(4altrmf oatopt auvs;t) 2tr(mpoydap   netlt)aDurx pot0opt mictasfaDuau snu)aetoxr todlaDrliei t)t2xriopiodoltnmnctl(fsDuaxronu0alx mfeiytlm uaumo;(0 lerio3oodlm e i s t) rxoir3io1lptelnvs t  rrru  ;u0aptomf3iys s2rm( sn(0altrio tydlp e nvi t trtmxo3io4opeemiesl( s2tr(monu4oee mf3tls aDrmnvp u4 rxrxo3tytlmt auei s s2tm(r3ou4am elfeiat)s2ra(rono4tetnmi3iytfsDul(mo (0treoxo oy1lmtelneolt0srto(r oydlp  mnesatfaDtmx p;o0optoio3iatlm2uln o (4artnmf3ia1fmDe nesl() rxoir ou4lpt  nci t sDta(mooo4ape ioetat sDeau s;u)trtnxo tydomDelieo s0 eum(m iu4al nlfei t  Drrxr ou0texomfctlsfa rmn p;u4 etnxo iadfm r neo t)trxmxmpiu4lp  mncs ()s2uaur oo4altn fetatlaDrl(von()aeeomo3ty1optrlu i (0trxoxr oo4al n ies sfarrmu  ot4tleomoetys m emumpn(0aexrirctytlaD  neol()setoir no1olt mictas) Dtr( o;o0ale  o3tydfsDranmp u0alenxfcia1fmDran i;t) 2tmimpnudol e ivs ()aruau p;t1alxniociytfsDrmn s;t0tlenio oatfp rauesl() rxoiopny1ape mneil()arrm(ront4tlx  oeiydfs2eau s;(0aexrmo iy1fa eaueils)texo(m nydll  lnvia(fsDum(mpnt1opeomo3tyd mDrlu o;u4texnir oa1lm  au o ()s2to(o iydom n icsa() rrmx  ot4aexnmf3tadlsDeaumo u0tlxoxfcoo1op  auvi;t0 ruo(m ny4openmivsl()a2tax  no0texoioetas a2eaums;(0arenio3oytlaD luvils teumiopiudol n fvtlsfs2raumpou1aeto f3iatls um(mp;() etoxf oydlmDr neilt0s2umir oo4ll elict sfa2ra(m ;o4teeomf3tlt m eanmp ()alerxo3oytfatr ivs;()srurirpnudol   ictatfsDua(  ;o0opto ietydls2ran p u)aexnif tytfpDrai ols0tetrimpou1aptemfvt (  2umu poo4apeoioctadlm2el(mo u4 lenxr todlptrauvo;(0setmim ou1ame mnvslt  2rr(  ;t0olenii3ilsls2ul(vo;u)tltnmfciotlmD li o;s)seuo(m iy1opte ivtas)a2rax pot0aeto ieiydfa ul( o;(0trtrmocoodfpD  uvs;(0sruoirpiy1am nmiet tfa2raxrpnt1texoioctltfa elnmonu)aleniocty1fm e u i;s0 eur(o iy4lp   ieiat  2ua(m ou0aeeniieilsls2ea(mo;t0 eermocoatopDr nvo t)texrxrpiu4amt  nei ( aDraxrpou0optomi3iytla rlnvo;u4 eenxr3todlpDe nes ( trxo(opoodoptemfcsl(faDtau  ;o0ape  octld s ran s t4trxnmfctodoa  aueol( texrxo nu1opt lnci (  2rmxro;o4open ieildfm2elnmonu4altrir ty1fpte u i;s)trtm(m nodom nmictl(fs2tau p;u4oeeo o3iyslm2rm(mp u0 etnif tadomte ivils s2trxo3oy4lm   nvtltfsrumxrpno4tle mieiasfa2ea(mo;t) exoxf3totfaDeli s;s)srum(r oo1aleelies tf 2ta(rp;u0apx  i3tys a2umump;t0 renio3iatlpDraieils  etrimpiy4ap  licilt srrmur no4oeenmoctlt a2rauvs;()texrifctotfpteln i t0setmimpoodlm nmicil()a2urxm nt0aee ioetlslm2uau s (0aexniocoadfp eln s s trxrxr oy1lmenlfvs (  rumuronu0openmfcilsls2umu ont) rxoifctydlp elivi;( s2xoio3nudamen nesat s2tau  oo0alxnioetadfm2ua( s;u0tlxomoctadop rlu s;()t2umxopnu1amtn ieia(  rrm(  ot0aeeoiictlsfs ulu pnt)altrmociydoat  ueol() rto(o no4apenliesltfsDrm(ro;o4aptnii3tlt s ran snu) ltrxf3ia1om rli i s0 2triopnodlle lfvs (  Dtru oou1apenioeiyslaDranvp u4arxoir3ta1laDelivo (0 etoxm3iu4optn nvta( sDtrxro;t4ape mfeias m2uanvs u)aexoifctadfaDrlneilt  etoxm3iu4lp emfvt tfsrrmum ;t4ole miciytfmDulnvs u0 rxnir iy1laDe neo t t2tm(mpiodop n fvia(farrrxrpno4tleoifeilt a2umnvp (0alxnxf3oatopt luvsl(0trto(o oo4opeelict t  2tmur nt0opt  fctydls2rlumo t4aexnmo3ia1faD lueo;( srtoir3nudllen fvta(fsrum( o;o0oetoif3iysfaDran s u0trxomr tytfmD  ues (  euoxr oo4al nmnesls)a2ua(r ;u0alt moeiytfs rlnmon()arermf3ta1oa eaneilt0t2xmxo io1al eliesa()s2tmu p;t1alt  feiltfa2uln o;u) ltoxf3iy1omD ln i s0 exr(o3iydomenmnei ()aruau  ;t4aeenioeiat mDua(mp;t0tltnmfcoa1fptr nvil(  ruriopoy4llenmfvt (  Dtmxm no0ape  fciytlmDea(mpn() lxoio iotom r neol( t2urxm3ny1opee ivtls) 2ra(mont1alxn i3tls m2eluvpn(0artnxf tydoateanvi;t)s2toxr oydlp n ivils s2ra(m ;t0aeeo iciatfa2ran ont)trtnio3tatlmDeanes (0 etrim nu4lmenmfctl(faDta(rpot4alto i3tytlmDran p (0areoifcio1omD  u s s)t2umir3oo1lmtelfciat)a2umumont4opt if3iasfm rmnvpn(0teermf oo1fpD au olt s2toxopiu4altnmfei tf Dtaum ot4aleo f3ild mDrmnms u4texnif iodoatrlu sls)t2umxrpoudal nlfetlsfs2rr(  ot0tee ioetldfm2el(vo;t0tltoircia1la  anvols texmim3io4om nlfviasfaDuaxmoou1tpeo oeiydfaDum(ms u)tlxnmf3ta1fp ean ol(0 etoxo nodam eliviat)a2ta( p;o0tpeomi3ild a2rau p (4aexoif iodlmDeauei t0sexoimpiodlp  lnvta()aDraumoot1alt ifetys mDelu p;(4 eerxrcto1oat anvi (0tetr(r3nudlltn ivslt)sDraxm ou4olxoiieildlm2ra( pn()aeenxrctytomDelieo;(0srumir3ny1lme mfvslsf Dtr(m ou4oltomociat a elumonu)trxrif3to1opt lnes;t)texrxm oodlptnlicilt)arraxr nu1oexniieiytfsDemn sn(0tlxrmr tatop   nvil(  ruoiopou4lpt mfciatfsDrr(ro;u4opxoifeiasfs eaumo u0 rxrxocty1fp r u i;(0truoimpou4openlictltf Draurp;o0opeoio3iydfs ranmon()arxomo3tydlm rlueols  2toxo ou4lm   ivtatfaDumum ;t4aeeo feiltla2ea(msnu0tetrmr iytop raieol( t2uoxr nydllt livi tfs2rrxm ;u0tpeo ocildlm2rmu s;() reomo oatlptraivi;(0truoir3ou1oleelfeilsf ruaxmo;o0olx if3iatls ua(vpn(0 ltrxf3iodfa   ieils) 2xrxopiu1ape mfcsl() 2trxro;o0ope  o3ild m2ul(mo;t0teermr3oadom r i i s0t2urxr3nu4lpen nctas  rtrx o;o0aeen ociyslm rln onu4aexomrctydomDe u o;() 2ur(rpiy1lltemieilt  rta(m no0tlenmocild m2rau p;t4alenmf oodlmDelueol() etm(o3oudalt lneias srrmx  ;o1tpe mfeiadfa2ul(mp;t4 lxomrcia1opD livolt  rtmir oodaptemfcslt  rur( pot1oexo o3iytfm2uanmsnu4teeniocoodlmt anvi (  2trxmpiy1ll elnetat s2tr(r nt1oetoioetyd a rlu p;(0trerxf3ia1fmte ieslt setr(r3nodllenmfetlsfa2rrx  no1tpe iiciytlaDeanvp;()trxrxo3iotopDeli o;( seumim oodam  mfcilt)a2ra(mp;o4apt mfcild m ean snt4alxrmocoatfm  ai o;()sexmim3iy1om nliet (fsDtaumonu4aetn fctlsfm2ran p;t0 rxoio3iydfa  au i t t2urxo3iudlp  lfcil(  2taump;t1oet  fetysfmDum(vs t) ltnxfcoytlptean il( srtrimpny1omen iei s arur( oou4tlxn fetatfsDul( o ()tlxomociotoptelu i;t)trxoxopoy1lmt  ivt t)sDrm(m ou4apto fcilsfmDra(ms;u4aeermfciodlmD  u o t0t2trio oo4olenlnetltfsrrmur ;t4tptnmociysfaDulu on(0tlenmr iadlmDrli o;t) 2to(o no1apenlivilt  2tmxrono4tptnmfeiasla2umuvp u4artrxf3ia1fmDr u i s0texrim3nodopeemnvi t)srtaxr no1aeeo ociydfa rau pn(0aetoir3iodoa eauvo s)seto(m3oy1olenmfeia()srtm(  ot4tetoii3tyt mDul(vont)artoifcty1fpDe uvilt setrxm3no4lptemfvtlt a2umurpnu4openmi3iyt m2emn s u0aexnmr tydlpte ieols0trxrxo3nu4amtnmncs s)a2rr( o;u4opxnifetld m2emn snu4 renmrcto1lpD lieo;s trtr(r3nu4amenlicta(farumxr ot0tetomictydfsDeanvs ()trxnmoctatom   ueils0tetm(m3oo4omee ics ()a2rmxr nu4oexnio3iltfs2elumo;(0tlerxr oatopt lueo t) ruriopoudam emfvt s s2tmx onu0ole  o3iysfsDulu s (0alxnxrciotlpDr neolt trtoxo3nu4ameelnesl() 2ua( pnu4aet  feias m ulu sn(0 rxomf ty1faDraueo;(0 etrxm iudolenlnctlt sDrr(r nu4olx  feias a el( snt4trtoir iytom   ueils0 2tm(mpiodlm e ict () rurum ;o0teeomo3tlslm2rluvo;t4tleomf totom eanvs;()tetr(r ou4optelfcia( a2um(rp;u0opto f3ild s umnvpnt)aetrxf oydfa elnvo t  rurir3nu1lm  mneta() Drau pot1tee  i3iad m2rluvs;(0aeenxo oa1lpD anvslt0t2tm(o nu4oleelnetlt)arua(r ;o4oet  o3iysfaDean s;(4 rxoio3oydopt aies s0 rtm(opio1amt licsatfaDta(mp;o0tpe ioetld mDuau ont)aeermf tydlp r u sl(  etmxm3io1ll   ivtl() Dua( o;t4oeto oeiatfmDulu pn()arerifciydfmDe uvs;t s2xoxm iy1altelneiatfsrtmu  nt1tet  fctasla2emnvo (0alxomrctatfp   ueils0 rxm(m3oydalenmfeia(fsDurx p;o0teenmfcild m rmums u0 eeomr3oodom e iei;s)trtoio iydalee ict t a2trxrp;t1olto fetysfa2ulu s u4aetoir3oatfaD  uesl(0sexm(o io4ale  ietl()srua(r ot4oetnmoetasls um(vonu) ltrmf oodlmDeaivs t0trto(opou4lltnmfcil( sDtrxm no4ale  oetls aDea( s t0aexoxrciodlp eluvi s sexr(opoodlm elfvia(f 2tau o;u4aexniocias s emu onu)trtrxo oa1fat  i olt)s2urxr nodalen iei t)aDra(rp;u4ape  octlsfm rmnmp;()arxomr iotomD ai ilt0 rxoim io4ame lfeilt) 2umurooo1tleomiciasfs ra(ms t0 exoir3oadfm  lnvi t t2xoxopnu4lpt lieils a2rrxmoou4tpenifciad m2ulumon(0 ltrxrcty1omt lieilt)teto(r iu4ameelies ( aDrrumpnu1apx ifeiydfa2uaumo;u)aexnxociy1om   ieo;s0 exoim nudoltn fesatf rrrxmo;u1tlxniociytlsDumu p (4alxnirciatomtrauei;t0 2uoimpiy4oltnlfvs tf rua(  ou0opeoii3iasls2uln pnu)tlxrxfcto1fmtrlieilt trtrio nudop nmivsatfa2um( oou0olxoiieias s2elnvs (0 ltnio3oy1oat livols  rum(mpoydalee ietl( artrxmpot4tpeomieildfa em(vs ()trtomrciydfatr u s s0texrxr iy4alt  fet t)aDurxmpnt4oex  octld a2rm(ms;() rxoxocoo1omteai i;s)sexr(r3nydopt livsat)aDrm(rpno0opxnmoetytlm2rl(mo u) ltoifciotlpDe iesl(  2umimpiodapt  ncia() Dumumpot4aeeomfcilsla rlump;u)artnxf tydfmt luvi t0 rxmir3iu1altnlfcia() ruru ono0aeeoif3iys m umnvp u0arxnxo3iatfm   uvo s0s2xoio iy1apt mfei s  2urxroot0altoifeiyslm2um(msnu)texoxociytfa  auvi s  rtm(r oo4ape  fvsat)aDrr( p;u4apenifeiydlmDeaumo;t0tlxrxf3tadlpDe ueils s2toirpiodol  mfeslt srrrxmpnt1opt ifciydfm2um(ms;u4aexrmrcto1lp  auvs ( t2ur(o oo4lle micsas)artrxmp;t1oetomfciyt m2eln pnu0aexnifctodomDeln i (  etrxmpno4optelict (  ruaxro;t0aetnmoeiys aDulnvonu4 renmf iydfmD  neilt trxm(rpny4am n ncias s2ta( pnt1alt  fetyt m2ean p t4 eeomo iotlmt ln olt0t2xmxrpiu4lpee ieta(fa2rm( oot0open iciltfm emnms ()trtnmf3io1lmDrauvs;( s2xr(r3nu4aptnmivsas) Dra(rpnu1oeen fciytfaDua( s;u) ltomo3iatlp eln ols trxmirpny1lmeemfcias s2uaxmooo4altoioetlsfm2el(vs;t4aeenirciotfaDeaueo;( trur(rpnudlp  mnvias sDtm( pnt4alt ioctatfa emumon(4aleoirciadfp  auesl()tetrio oo1omtnlicsl(farum(  ;t4oexo o3tyt m emn p;t0artrxfcoytop elivo t s2tmir nydlmenmnctat) Dumxmonu1tltnmoetysls2emn s t0arxnxf oadfmtelieslt)trtrxrpoo1ole  ncil(fsDtrur no0aeenmfciltfm uau ont4 ltriocootom eai s;( texr(o3io1om  mncsasfarraxro;t0aptnii3tlsfa ua(vo (4 rxomr3tatoaDeaieslt)t2trimpoudolt mict s s2urxr nu0tpxoioctaslaDelnmpn(0tltnxr3oatopDr i o () etmiopou1lpee nctasfs2taumont4aeen fciyt m2el( o;()texoir3oytom e u o s)sruoir3iy1aleelicils srrr( pnt0tptoioetadlmDulnmo;() lxrmr oydlat  u ilt t2tr(o nudlmte feiat) rta(rp;t4aexnmociytlm rmumo u) exoxrciy1fatr uvi t s2urxm oo1optelfcs tfsrraum nt4tpe  o3iydfa ulnvp;t4tlxnifcta1oaD  n il( trum(o3iodopen nvil(  2taum ou0optnif3tldfm2umuvp t)alerioctytom  livols0 exm(r nydom e nvt (f rtaxr nu0alt  i3tytfm elnmont0 eermrciodfaDr nvo t) ruo(rpnydapt mivtlt aDurum no0olxoiieiatfs ea( s;t)tleoif3iydom  aieolt)t2toio iudoptemfctatf 2trxm nt0olxn i3iadfm2emumon(0 ltrxr3to1fpDeli slt0s2uoxm3nudom nlfctlt)a2rr(rpnu0aex mf3tls s rmnvo (0arxrxocoodlmtelnvs t s2xm(rpoydale  fvs sfsDrr( pot1ope  ociyslm umuvont4 lxoio ty1lmD lues s0 eumimpno1omenmiviat)sDtrurpno4alxoio3ils s2umu p;(4tlxoir iytlmt lneil( srxrxmpoo4am e ncsls  2rm(m ;t0apenioeiatlm eauvp ()alxnmo3iytfpDeauvs s) exoir3ou4amtemnetatfs2rmu poo4oexnii3tytfm2emnmpn(4 etrmfcootfpteaneslt)setm(r oy4lptemfetls arra(moot0altomoeiadfmDumn p;t)tleomf3oytlmtrlivsls)texoxm no1alt lnesasf Drmxmont1tle  i3iyslmDum( s ()teerir3tadlpD  nes;t) 2tmxopnudlpt mivs tf rraxrp;t0altomoeiasls2uanvs;t)aeerir ta1fa  auvo;s)tetoiopou1lltnliei sfarurxr nt1aleomictadfm2ulnmo;u)tetnir tatopDrln il(0t2uo(o3oy4llte nes (fs2taxm ou0tpx mfcias m2eanvp t4tlermfciotopD  uvs;t0trur(rpnu1lpt lnetasf 2tm(mpou4aet mfctls s2rl(vo;t) exnxrcoydoateauvi s)srum(mpny4lp elfcsa()sDta(moot0tlxomi3tydlmDeau s t) eeomo ta1oa   ueo t srtmxmpoy4lmeemiei s s2trumonu1opxnio3tlslaDean ont0tlerxr3iytlmte neo t  rumiopiu4apenlfet (fa2rm(  oo1alx io3ild m2rmnmp;u4aetnif3oydlp  lu s;t teurir3oy4am n nesltf Dua(r ot4tlxoiociasfm em( p;u0 rtnmrctytfpt aivo s  2umxopiu1oleemfetls aDtax pou4tlx miciltlmDrl(von()arenio3ootlmteln s;(  rur(r ou4ol elncta(faDuru  ;u1optomi3iatlmDea( o;u4alenircoydomDranvi s trxoim oudlme mivi () rrm( poo4tltomf3iytfmDrl(mo t) etomr tytfptelneo s  eto(r nudlptemiei sfaDuaumonu1alenmictatla2ranmpn()trxrifciadfpDr uvo t)teumxo iu1llt lfcsls  ruax  ou1ole moeiyd a eauvo;u4arxomf3oy1om raivilt trtr(o ny4lm e feiltf rtaxrp;o0tpe  i3tatls2rmnvs t4 eenxocto1omtrau o s) exm(m iu4ol  mnesl(  rta(mo;u0oexn oeias a2ulu o (0altnxr oadom rlnvs;t0 2to(m3oy1amtnmnvsl(f 2umxmooo4oexomoeiyt sDrl(vp;u)aexomr3iotoat  i slt  rur(m3nu1omt  ieiatfsrurxmpoo1oleo fciat s2rm(vont0 etnmo ootlatrlieil()setoio3oodal nmivsls artmu o;t0apeo octat m um( p;t)teeoxo ta1laDranei t0trtr(m3iy1ap  lncils)sDrrxmo;u1oee moeilt m rau s;(0 eeomr3tytfatrluvi;t)trur(m3oo4lltn ieils)aDum(rp;o0aeenmfcilt aDua( on()altoxrcoytlaDr ueolt  2ur(r3io1oltemfct (  2tmxro;o1oeeomiciyt aDuanvsn(0areomo3ta1omDe uvs t srtm(r iodapenlieias sDur(  ;t0ale mi3ilsls ea( p (4arerxoctatoaD aiei t  2uoim nydap emfeslsfaDrax  ou4aptn feiyt m emu onu4tleomo tydlaD luvi;()seum(o3io4op  lnesas)arraxmo;t1aex iiciydla ean s;u4alxomf ia1fa  lnvo;s0srxm(o3oy4ll  mivsat) Drrum ou0tet  f3iaslm elnvp;() etnio3tydlm r uvs t  2um(rpiu4ap nmncslsfaDtm( p;t0opt mfeiydla ul(von(4trxomo3todoaD  n i t0trum(m iydlmeelfesl()sDrm(r ou4tlto o3tldfs2ulums ()tltriocto1oate neo;t)seumxr ny4ap n ncsat)srrr(mo;t1tpx mfctatla2rlu s ()aexrmr3to1latr ueolt)srxrio3nodoptnliesat  2tm(r no1opeo icilsfa2umnmo u0aetrxf3ty1lpt lu o t0trxr(opoy4amt  ict tfarua( p;o4tlenmocias m elnmsnu4tltnir oodfptrln ils  rtm(opiu4ll nlnvi (fa2rmu pno0olen o3ildfm2ua(ms;u)tetrir tytlp  au i;t0texmio io1lp e ncta(f rrr(  ot1tetnmoeiad a2rlnvpnt)arermf oydlatraiei s)srurxopoy1oltelnvtltf Duaur ;u4ape mi3ilt s2ulu p;u0altnxo3iadlmtrlu i t0trum(m oydlmtnmicias) 2um(rpoo0apto oeiytls ea(vp;u4aeeoif todfaDelu o s)teurxo oy4lm emieslt  rrmu pot4alenmfetldfmDrauvpnu)alxomo3iotlmDe u s;t0 rtr(m3ou4opte nct ( arua(mp;o1oet moctad a rmn onu0 rxrmf3iy1fpt anes s  ruo(m3nu4lm emnctat)sDta( pou1tet ifeiysla2emuvp (0trerxf3todfatelnes;t)s2toimpou4al nliciat  Dumx ono0aetnii3tat m uau p;u0aleomfcoy1fatrlnes;t)srto(m3nodome mfvilsf ruru ooo4tlen i3tatfm2ea(vpnu)tlenxf to1opt  u i;s)tetr(m oydlpe lict (  rtmx pnt1tleniietysfa2rl( p;u)arxrxr iadlptrau s;s0t2uoim3nydlpeelics tf 2ta(r ;o4openii3ils a2eln o t) eenmf iydlmt lu ils)t2uoir3iydapte fesl()a2um(rpno4oltomfctyd a2rau p u)aeerif3iytfpt  nvo t  etrir ou4am e ivs s s2urx  oo4aleo i3ildfm ran p u)artnmrcoodop e u ilt0tetoim ny1lmenlnvtas s2tm(mp;t1tltnii3tatfaDemu snu0artnxo3ootomt au i;t0trxo(mpiudaltnmici s srrmx  oo1tee iictatfm eanvpnu0aetrmrctadfaDe ieo;( teumxopoo4lpee nesa(f Dtm(r ot4apxo iciasfa rauvp t0tetrxr3ia1om  aivi;s)teto(rpnudopeelncsls srrr( onu4aeenmoctatfm umums ()artrir3ootlmDr iesl(  2trxr3iu4oltemfvsatfaDtau ont4tlen icildla2umnmo (0 leoiociydomt  n ols0sexoim3iydlleelieslsf rrmx onu0olen fctyt sDeanmo;u0trenxo totfptrlnvi;()s2toxr3oodlpt  nvtl(f 2umuroou0oeeo ictatls eau pnu)aexrxr3totoa rau ol()teurxm ou4omtn fcils)sDumx o;o4oex io3iys a umnvs;()alxrifciatoa  lnei s)seuo(m oydol emictlt aDtrump;o1ope mieild a2eanvp;t0 rtomr todomtean o (0 rxoio3iudolte ncsls  rtmxmpoo1oexomieiyt sDuln s t0artoxf oodlatrlu s;( t2xrim oydome miciat)a2rmxmono4aeenifeiytfaDrmumo;u0 rxnxfcoytfa rlueil()s2tmxr3iu1ape micsa()artrx  ;u0apenioeilt a2elu o ()tetoio oadlpDelnvolt0sexo(rpnudam emfetas  2um(m ;t1tpxnmietasla2ul(monu) lxoio tydfp  aneolt0t2xm(m ny4altn fciasfartr(  nt0oee ioeiyd a emuvpnt)aexrxf to1la r u il() rtoxrpou1omen iet (  Dum( o;t4tpt mfeiytfmDelump;u) reoifciotfmt aivs;(0s2tmiopiy1lltemfvi ( a2ta( p;t4ole mociaslm el(vo u0aexnio iy1la  aueilt)srtm(o ny1lltelfesat artaxr ou1tptoii3ias sDrlnmo;(0 reomociodfptr uvs s)trtm(opno1oltnlnet (  Drmu p;t1tpen oeiysfa2ra(vont)alerio3iytlp  li o s s2xmim iydlp  mnvsas)srta(rpoo1aleomfciad sDrlnvsnt4 leomfcta1fmD  n olt  2tm(o3ou4lm n icil(f rumxmpou4apenmociyslmDumuvs;u) renxf ty1lpDeluei;( t2tmim3nu1lpee fvi t arrm( p;t4tlxoifetadlmDrl( snu4trxrxf3iatlm  lu slt0seuoim3nydlle  feta()srtax pot1aeto ietatfs em(ms;(0 lxoif todfaDr uei;s0 2xo(rpoo4oltnlietls a2ur(rp;u1alt  o3iys a2ulnvp t0alxnmfcoatoat auei;s srtrxo3ny1amtemfeil()sDta(r ;o0aex iocilsfa el(ms;()tetrio3oy1lmteluvi;(  rxmim3io1om emfcia() 2raumpno0texoii3ilt aDua(vp (0tleomf tatfm  livi;t  2trirpou4oleemnesasfs2umx  ;u0tptomoctad m rm(vo ()alxrxo ty1fmD ai ols s2urxo oydole lnvtatfsrtrxmpnt4tptomfctlsfm2umuvp;t0 ltomr3iotopt  i i t  2ur(r oudop e nciltf Dumxroot1olto i3iysla ua(msnt0tleniocoadfaDrauvol(  rur(rpoo4ll  lnvt ( s2rmxmoou0tex if3iatfm rauvo t) etnxrctotom e ieo t)s2uoim3iydlle lfeslsfs2ra(m ;t1tpeoii3ildlmDrm(vsnu4aeenir oo1oateauvi t)trxrxrpiy4optnmictl(f rumxmp;o1oeenio3iatfs2ean o;u)tlxrio iy1lptr nei;()seto(m no1alt  nvi tfaDtmxm nt0altnii3tysla rm( o;(4alxnxrctatoa r i o;s  etm(mpoy4ap  mneilt) Duaxm nt4texoifeils s uan p;u)trxrio3oatoptrlu slt t2xoxm oy1omeelnvtl(  Drmx ooo1apxniieiadla2elumo;u0alxomf tadlmDr i i;s)srxrio ny1omee iei ( a2rr(mont4olt ifctldfa ra(vs t4tlxnxf3iodomDe u s;()setr(m3nudlmenmicsatfs2ra(  ;u0tlt mo3tasfs2uaumsnt4altnxfciydoateanvo t)seur(m iodlmt mivsls) rumxr oo1olen f3ias mDemu onu4trtrir todopDe ieo;s sruo(m3oy1al nlicilsfs2rmxrooo1tpeo iciaslmDeanms ()alenir to1fpteaivs;t) rurio io4lmte nvilt) Dur(mp;u0apx mf3iltfm eluvo ()teermr3to1oaDrai i s)trxr(r3iy1ome  ivsas) rra(r ou0oltomf3ilsfs ranmo;u4tlxrmo iodfat anvo (  etrxmpoo4altn fvsl(f Dua(mpou0aleomo3iydfs2elnms;(4 rerxo3oodop   u o;t)texr(r io1omtnlfei (  Drru p;o1tlt ioeiyd a2eauvs;()aetrxr ty1oateanvi;s texmimpiy4open iei (f rra(rono4tetomf3tyt a rl(vpnt4texoir ia1lpteaivsl(0srto(m3ny1olen ietas)artau pou4aeenmfeiyt m rln pnu) exoxf3tytfpteluei;() etrirpoy4al nmnvtls)srrrurooo4alxnioctld sDran o;u4 lxrir3iodoaDelneo s t2xoim3oo1am emnci (fs2taxm ;t0opeo fcilt a elnmon(4aetrirciodfmt  nvi t)t2urimpnudalte icta(  Drmu  ;o4alx  oeildfaDemuvs;u4 renmrcoadoa e nvs t0setrxo ou4olenlnet (fartmuront1oetnmfetatlmDemnvs u)teeoio3oydfp  aues;t setoir3io1lp e fcs tfsDta(m nu1aeeoifeiasfs2ua(vsnu4aetrmo oa1om r n ol() rtoxm3nydllt mfvsat)a2tmx  ;u1tptn o3iys s ulnvo ()altoirciydoa  aivi s0setmim3iydolenmnvs ()a2rm(mp;o0texoiocildlsDeaumonu4alerir3iadfpDr uvs s s2urimpiu1ameemfci sf Dtaumoou4apenmfeiad s2uau onu0arxrif3oodfa eluei;()setm(mpiy1alt lics s)sDurxmont0ape mociltls2rmu o;u)trxniocoodomD livols)srxoio3oy1lptnlicia(f rumu ono0tltomf3tatfmDem(mpnu) eenxo3tytlaD liei s t2urxm io1apeelfetltfa2um(mono4oltniocild a2ra(vp;t0trtoxocia1optranvsls  2ur(r ny4amtelfvilt a2rrxrooo4aeeniictls m2raumsnt)trtriociotoatrai s;()trxrxo3nu1ole mfct t)a2taxrp;t1opx ifctls aDuan p (4arxnmr tydlaDr nei;s t2xriopny4apt liet t  2umxroou1opxniociydfm2ulump;u0 lxoxfciatoa  liesls) eurxmpnudopen nvilt)aDrmx ooo0tpe ioctldfaDeanmonu4tetoxf3ia1laDrlnvi;s)trxrxr oy4lltn fei t  Duax pnt4opeo o3iltfa um(ms u0 leoxf oadlpDeai s;t)t2xrxr3iydol nmfvtas)srur(m ;u4apxniociatfaDumnvsnu4 exnmf3iatfaD au s t0setr(opiu1ale lncslsf rum(mpot0tltnioetld m2ul(mo (4artomf3iatlmtr i o t) rum(rpoy4op emfcilt s2ua(m ;t1tpxomf3tat a2uau o u) renmf3totom   ues t)srtr(o3oodapt mivtas) rurumpnt4tlx if3tasls2uanmpnt4aleoxrcia1omt auvs (0trxmxmpiu4lmt lict ()a2uau oot1alen oetyt m2ulnmp ()tltomr3iatfpteanes t) exm(o3oy4ape  fet ( artmur ou1texomi3ilsfsDelnmp t4tleoio3oy1oa  an o t)srtrxmpnodol n fvil(fsrraumpno1tpenif3iatfsDea(vsn(4tetomrcoytlpDean o;t)srxmxo no1lpe miet t srtrxmp;t4tetoiicilslm uan p;u0artnmf3tydlmt  ivs s trtmxm oydlleemfvs t  Durxmpoo4oetniictyslsDul( o t0arxriociy1fmD lnes s0s2xr(o3oy1ol e fcslt s2rrxrpnt1olxn icilt aDum(vs t) eeoiocto1lpDrlu o (0s2xmir3iu1amte ivilsfsrta(  ;u4alxn fcildla elumo;(4arermo3oo1omt aneilt0trto(rpiudome  ies tfsDrmurp;u4teeomiciysfs2em( o t)aeeoxo iatlmD aivilt  etrxm3nudomtn iet ( srrau o;t1tleomociltlm ranvsn(4 lxrir3ootlaDrlu i;t0teto(rpnu1ope lnctltfa2umx  ot4tleomfcils aDemu pnt) rtoxo3ia1oatrauvslt seumxo3iu4altelnctlt)s2urumoou1oleo i3iydfsDrmumon(4alxrmr iy1omt luesl(0s2xmim3no1lmen fvta(faDra( o;u0apxoiocilt m ranmsnu) etrxocia1lpDrlneo ( trumxopnodol nmfvtl( aDuaxmont1alxn f3tatfmDeluvsnu0 rtnxr tydoat  n o;s tetmxrpiy1oltn fetas)aDurxr nu1olenifeilslaDrl(vsnt0arxoxrcoo1fa eli i t t2uoir iudoptnmnvs t  Drmxm oo0aexn f3tldfs2uan on(4 eeomo3tydomD lu i t) 2tm(o no1op nmieia(faDta(m ;o1aeeoii3ilt sDulnmp u) lerxfciatlmD aues s  etrxm3oy1ol  lfvilt)aDuru pnu1oee  i3tldfs rlnmo u4arerxfciodfp  livi t texr(o3nu4apenmnesas)s2tmxmpnu4altoiieiytlsDrlnvs;u0aexrif oodoaD  neo s  rur(o3iu1lp nlivt tf 2rr( oou0tetnifctatlm rl( o (0arxnmo3iatlptrlneo ( srtr(r3ny4al nliei sfsrururoou0optnmoeiyd s2rlumo;u0 rtrxo oodom r uvs s0 exrimpiodamee feilt)a2raxmpnt0apeniociad mDrmnmp ()treoio3ootlatranvi t) rxr(mpnydlpeemfvtl( srrm(rpou4oetn f3ild mDran s (0trtriocoodla elivo;s srtr(r ou1amtemnes t s2umxro;o4apt  oetytlsDuan s t)arxrif iatopt au ilt tetmxr iudamt lncilt) Dururpot1tlenmf3tydlsDelumo;(0 exrio iodlmtr i o t  etmxm iu4omtnlnetls) 2uaxrp;u4aptomfciyt aDua(vs;u4 rtrxrcoydomDeai o s  rxrio oy1lm nlfct ( arur(moot1tlx ioetld sDuauvs;u0 etnxrctatoptr nvsl()t2tm(o3no4lp emnet t s2uaxmpno0teeomfeiydlsDem(msn(4texrif oa1fm elu s;s) rumxr3nodameemncias  Duaxmono1olxo f3ils a ul(mo u4 eeoxf3iy1opD anes s)trurim oydom nlfes sfsDtrxroot1tlxniiciydlm rau o t4aeenxr oa1opDeli s s s2umio no1om nlnetat aDrrur no4aex mf3tltfsDem( snu4 leomr3oy1om  ai ol()tetm(r3iy4olt mnes s srurx  no0oeeoifctasls2um(vp;(4 rxnif iatop e n sl(  rtrxm3iy1ope mfvs sf 2umurp;u0opeo o3ildfm elnmsnt4texnmr oydfpDr uei;(0 ruoxo3nudoptnmnes ()srtm(r nu4oetnii3iadlsDrl( p;t)artrif3ty1la elivi;(  2umxr oy1olenlncta( sDrrx oou4altn ieilslaDrl(von(4aeenmrcoytla eanvilt)teumxr3iu1llt  fci tfaruaum ;u4tlt mf3iatla rlnvs;t)aeermf3totlmDeau o t srtoirpiu1olte fci tfsrrmuro;u0olen oetysfs2ul(vpn(4areomf oa1opDr iesls)sexr(r iy4omee ncs s) Dtax pou0tptnioetad a um( s;u)artrxfcoytfpD anes s)srtrir oodomenlnes t)sDrm(mp;u1olxniiciydlsDel( p u) rerio oo1fmDr nei s  exo(opou4omt  nesas)a2ua( pou0tpx mictasfsDum( pnt)alxnxoctatlaDeaiei;t s2tmxrpno4lme lfcs s a2umurp;o0olxnmietys aDumnvs;() reoif3ia1faD  u sls0srum(o3oudopt mnvslsfa2ta(mo;o1altomfciltfmDuln s u)teermrciadlpDelnvo;s)t2xm(m3nydlmenmietl(fsrrau p;t0alt  o3iasfs ul( pnu0tetoxf iy1lmt lnvi;s)sexoir oo1ap emfvias a2rrxr ;t4tlx io3tydla2uau p;(0tleomrcio1fm r nvi t)sexoxr iu4ame mictat)artrx onu0apxn f3iys a2ea( s;() rxnirciotoaDeli slt0teumiopoodalenlnet t sDraxr ;t4aptomf3tls m emumpnu)aeeoxr3io1fmt aiei s) exoxrpoo4lltnlics ()artmu o;t0oetoiieilt a rmu s u4 lermr3oadomD aivo t)trxo(r oudlm  miesa(  Dumur no1olxnmfeilsfsDulu snt0 lenmocto1late ieo;t0t2tmim3iy4ope mfvias)s2urx ooo1alxnmf3iydls2raumpnu0 exoxo iytlm e nvi ()sruoimpny4lp  lfei t)srrr(rooo4aleo f3iysfmDrlnmo u) rxrxr3oa1latraivo s0texo(m no1olenlietl(f 2truro;u1opeomieils s2rm(mp;u4tltoxrcoydopte n o t  euoxo io1lptnlnes ()sDtmx  ;o4alenmicildlmDemumpnt)artoxf3oy1fa  aueo;s t2xrxrpno1alenmivi ()s2umu p;u1alen oeiytfsDulnvs;()artrmr3iodfatr nes;()texm(mpiydole mfvtatfaDtaxmo;o4aetnmoctydls2ulump;()alxoio3ta1opte ues s s2toxrpoy1ape mfes s) Drmump;o1apeo oeiydls2rmnmpnt4arxrxo3oodfmD li o;t0 rumxr ou4lmtelnctlt) rrmxrpnt0tlenmo3iys s rln p u4 lxnmo3ootopDelieil(0t2umiopno4ope lnetl(  rrmx oou1tpxo o3tas aDua( s u0tlenxrctydoat  ueo s0setriopio1ol emncsa()a2uaxr nu0tltnii3tadls2rmu on(0 eerif oadfmDeaivs s0teuoiopiy1omtelfesl(fs2ur(m oo1olt  o3iatlsDuanmpnu4altrir3oatlate i o s  rxr(r iu1lmeelncs sf Duaxront0oeeoifeiltfsDeauvo;t0 leoircoatoate i s;t0 rtoio3iodape licsat aDrau  nu1aeto f3tlt a2eanmo () exrioctytlmte i ilt0setmim nudoltelivi () 2urum ;u1apxo oeiatls em( s;u)artnxocty1faD lieols  2urxm iy1lltnmnes tfa2ua(mo;u4olt mictldlmDel( snu0 reriociodopDeaiei s)trxmxopoo4omtnmietas  Dumuronu1tptnmi3tas sDrl(vonu4aeenxo3oydomDeln s;t0seuo(mpiu1lpenlnei t)sDurx  nu4tee  ietysls2eln s;(0 reoxf iadom  anes;t)trumxm nodopt  iet () rrmur oo4tpt mfeiat mDeau s () exomo3todomDr uvi;s srumxr iudlme mieta(fsDtmuronu0apxnifctlt m2ua( ont4teeoir ia1opDranvolt)truoirpno4ap   neslt  Dum( pot0alx io3iytfmDeluvpn(4tlenmf tytlptrluvs;s0trumxo iu1lltemfet t  rtaum nt0tex ifeiysfa2ea( p;(0tetrmfcio1lptelnei t texrirpoudap n ieia()srua( pot1opt  ictldfs el(vont0tlermr3iotlmtr ivi;( teuoxrpnudop nmiciat  2rmur oo0tpenii3ilsfm2umnmsnu4alxoif3iatom raies (0 rxoxm3nodaptn nes s srtax oou0opxo feiytla2ul(vpnt)tlxrmfciatopD  uvsls) rtrxr3ou1optn nci tfaDtmumpnt4aetn f3iyd s2emu pnu0arxomoctydla ean s ()s2uriopoodolenmnvsls)sDraxmooo0teen fetydfm2umumpnt0trtrmfcio1fm e nvil(0seur(o ny1omt mfci t)a2taur ou1tex  f3tls sDra( on() rxrxrcoo1lm  ln i t0sexmio oy4am elfcsat)aruaxrpot0aptniicias sDemu p;t)aexrmf ootlat ln olt)srurir3oo1lptelfctatf 2tr(r ot0optn fctysfs2umnmo t0 ltomr ia1lpte uei;t srumxm nu1lm n ietat sDumxmoou4tlxnmfetlslm2um(vo t0altnxr3oatop  ai slt  etmir iu1ap   fvtl(faDrmumooo4apeniietlsfs ran onu)aetrxf3ty1fatr i ols) etmxo3nu1lpenmfct s  rtrumpot0tetomiciytfs um( s t4artomr3oa1omDean ilt sexo(o3ou1ll  lnci ( arrax poo1apx ii3tltlsDeau onu) reomr3iatfpDeaneslt teuoimpiu4opte nes (  2taumpnt1olen f3tysfm2em(ms;u4 eerxr3io1la eaivil( s2xmxopoudam n fesltfs2tmu  ot1apxoif3tyd m2ul( p;t0 eerxr3iodomD ln i;( seur(r oo4oltnmnetas)aDraum ;t1opx  i3iaslmDuanms;() exnxocoadlm r i o t seuoxo3iy1amtemicil()arta(mpnt0tltnmf3ilslaDeluvp;(4 ltoio3iytfpteauvsls)t2tmxrpny1am  lnesa(  ruaur ;t1tlt mf3tytls um( p;u)altnmr iydla rau sl(0 2urio3ou4op   ivsa()aDrmx  nu4tlx if3iad m2ran p;(0artnxrciotfatr nvi;(0s2um(o3oudape lics ( arrm( onu1oetomf3tltfa2ul(vp u4arxrxo ty1lpDranesl(  exo(rpoydlmte ici (fs2trump;u0tpx  ictld sDulnmp (4tlxoir ta1fa rliei;t0trxmim3oy4alenmnciatfaDrmurpno1oleoioeiysfa2ranvonu) exnxf3oadfm rlnei;t s2xmxrpio4om nlnctlt s2ra(m ;u1alxomieiyt a rl( p;u0arenxr3oo1faD  ieils0s2umxr iodamen icils  Dtax oou0tpen ociasla emump u)tlxnmfctatlmDranvs t)sexrxm3oodolt  net ()aDurur nt4opt mfetatfsDumn sn(0texomr3iotoaDeluvol()t2xmxm oydop emictltfa2ururoou4oetnmi3ilt m ul( s;u4trxrxo ty1fatr ueslt)s2tm(m3nodap  lfeil(f Drr(root4teenifciat s2ulnvont0tlermf3oy1lpDr ieo s0s2tmxo3oydolte fvta(  Drrx p;o0opx  oeiatla2umumpnu)trtrxo iydfp  aivs;t)s2xmxm3iy1op elnvs tfsrraumpnt4tet if3tyd mDuanvo (4tetnmr oodlm r uvil(0seuo(opiu4ol  lfvt s  2ururo;t0tpe  oeiyd mDem( p t)texrxf iytlp elivol(0srtoxo oy1om emfeil(faDrr(rooo4tpt mictat m2um( p;u0artriociotlmDrauei s  rtrxo3io1amenlicta( sDuaxro;t0tlxomoctlslsDel( p u)tltomr3to1lmteanei t) 2trim ou1ll  lnct t)artrx o;o4aetnmfcildlm2emnvp;u4 exnio iydfpDe nvs ()s2uoio nudaleelfcia(f rtmu  oo0apxn oetld a2rau p;(4 eeomo io1fmDrlivil( teur(o3oydal  mfvi s srrm(mpnu0tex iieilslsDua(ms;(0 lxnxociotop elivi ()teur(r3oo1openmnvia(f 2rmxmoot0apxn fetldlm ea(vpnt)trtomr3tatfmD lueilt  rxoio3ou4alenmfes t)aDtr(m ;u0tet ioctlt m2ra(vp;() lenmfcoodlm eli s;t0 eur(o ny4ameemnei tfaDrr(m nu1alx  ociatla ul(vo ()aetomrcoadlmDrai o s) rxo(o ny4llte nei sf rrm(rp;t0tpeoio3tlsfmDumnvs u0trxrxr3ta1fm e ueolt)trxrxo3io1lm emncs sf rur( pnu1tlen iciatls2em(vpn(4 lxnmr3iy1fmDra
\ No newline at end of file
@@ -0,0 +1 @@
+u s;s sruoir ou1lpenmnvsl( sDrru pno1olt ifeiaslm rmu o;t4 eeoxo oodlm   ivsl(0s2umxopoo4lpeemfvilt)s2tm(r ou4ape iieiytla rmumo u4alxomo3tydopD anvilt0tetm(m no1ll emicils srurumo;u0olxo oeiad aDul( o (0 rxrmoctytom ran o s trxo(r3no1ll nlicsas)a2rmu pou1tlxo ietat m ulu o;u)tetrmfcty1om eai i () exmxrpiu1om  liei s s2umx onu0oexnmi3ils a2rl( s;t)altomf3iydfpD lnei t0sruoxmpnudlme mnvsa()s2urumont1altn f3ilt aDumumonu4aeerxf3todopt aivsl(0 euoio3oy4ol e fviat aDrmx  ;t0alenioeiltfm2ulumon(4 etriocootfa eanes;s sruo(o3ny4lptelivtas arumxr ;o0altnmf3tldfm uan on(0 lxrxocio1lp r i o (0srtr(r oudalenmfetls)srra(roou1teeoifeiysfa rm(mp;u4 ltnio oo1faDeai o;s trtmxr ny4ap emnviasfs2tr(mp;o4alx mociytfmDel( ont) eeoxr3tatopteanes t0 rtmxrpny1lpeelictl()artm(ronu0apen i3ildla2rlnvp u)artnxf iy1fpD ai o ( srurio oydopeemfct () 2rmur ou0texn ieiad m2um(vp t4trenxf tytom rluei;( t2tmir iudllenlfvil(f Duaum ;u1openmo3ilsls ulu o () rxoir ootop eai ils0setrio oy1optelnetl(f Dtaxrpot1tlxnmf3ilsls rln p t4trtoxf to1lmt  ieol(  2uo(m oydlp n ncsat)artmx o;u4tltoiieiatfm ra(vsnt)aleoxf iy1lpte n sl(0trtmxr no1ol nmnes (fsDrmurono4ape  oeiatlaDrl(vp;u0alermoctydfpt  n s;()teur(o3iy1lpt  nesat)aDtm(  no0tee mo3tltfmDum(vo t4texrmr ia1fmDrauvo t0texm(o oo4op   ivtasf rrr( oou1opxniociltla rmu s;()aetnmo3totfateai o s texoxr3ou1lptnlfvs t)s2ururoot0tetnmi3tasla rlu o;u0arerio io1opDr i o;s s2xr(r io1omen ictlt  Draurp;u0tpt ii3tad m rlnvpnu) eerif ty1fatrai i (0 2xo(mpio1lmeelfvi s)a2tax poo4alx  i3ildfm rmnmo ()alxnmf3tytomt auvs ()srur(r no4am nlncsas a2trxm ;t0alxomocils a eaumo u)trxoir tadfmteluvi;t s2tmir oy1lpt lnvil( artmu oou4olxnmfeiad m2elnvs;u) eenio ta1lmt luvo s trtrxmpoy4olenlnciasfa2tau  ;u0optomi3tyt m rl(msnt0teeomociatlpDraivslt0 2tmxo oo1alt mfci s aDururonu0tltniietasfm2ul(vp () rtoxr iodlaDrlues t0srtoio3nydlltemivslsfaDtm(moot0aet ifeils a ea(vpnu0aetoir3iadomteanvs;s) rtrxrpiodlpt lneil(  2rr(mono1oetnifctadfa2um(ms;()artrxr3ootlpDr ueo;s0 rxrim iudale  fciltfs2rr(rpoo4aexnio3ildfaDul(vp;t0 lxoxf oy1lm  luesl( texr(opnodal  mies s s2tm(  ;t0texn i3iyt sDrmump;u4 rtrircoytfmt  u i s seuoxopno4omt mneil()artm(r ;o0aptnmoeiltfs2um(mo;(0 lerxr3to1lmteluvils)trxoxm nodaptelictl()aDtaxmo;t4tlenioetld m emumo t0 rxoxf oy1fa   n s t srtoxr3io1ale  fcsa(fsDuaxro;t1apxo fciad a rmu s (0 exomr iodla r uvo s) 2urxmpio4openmict (farumxr ;t1aptn f3tasla ea(vp;u0 reomociotlmt livo;t)texrirpoudlmtnmnes s) 2taxr ;t4olenmociys m2rau on(4trtrif ta1lpD  uvsl( texoio iu1aptn fctls) rumumo;t0oltoiietad a emump t4aeenmo tadfaD ai sls) etrxrpny1apt lncs sf Drrxm ;o4ole ioeiadfa ua( o;u0arerif oa1latelneo;()texrir ny4aptelnct s)srraum no0tltnmfctlslsDumn o;t)arxoxo tatfpDrli ols) rtmxm oydole lfcsls)srtaum ot1opeoioeilt mDel(mpnu0 exnmr ty1fpte i ol(0 eurirpnodap nmnvsa()s2ra(ronu4olxomf3iyt s2eluvsnt0trerifcta1op e nei;s srxmxr3iu4lpe  nvil() Drau  ot1oex ii3tatla2ul(mp ()tetoxrcoatlm elueol(0trxrxr no4ome  iei s)srumxmo;o0tee ifeilt mDel( p ()aeenxo3tydoa e iei t  exmimpiudll emnct t) Durxroot0tetoiiciyslm umumon()arxoxociodlp rauei;s) exo(opnodlp  mfeias)arumx o;t0tpt ii3ildfm2ean s t4 exnxr3tytfpDrlivols0s2toio nu4ll nlfesls)srrrx pou1apeoif3tadfaDuln p ()aetoxf3iadlateli o;t  2uo(m3iy1omenmiet s aDraxmpou1oet  icilsla eln s;t0 rtoio3totopteluvs (  exmxo3iy1llee neias)aDuaxronu0opeomi3ils mDrlnvsnu) leomf to1faDr ivo;()s2xrirpiydal emieias)a2rmump;u0tpenmfciatfs2em(vsnt4aexnir iodfmt aivsls0trto(m no1am  mfcslt  Drmx pnt0opxn fctatfa2ea(monu4trtrmocoytlpDrln s;s srum(opiudop n ivtlsfsDra(rpot1alt mfciytfm2ua(ms t4 eeoxfcoytoatrau i () euriopiodapeemnci tf rta( poo1tpxomiciaslm2elu snt0alxnxf oy1fateau slt sexmxrpnudlpeelivt sf Drmxmoot1alt iiciyd m2ean onu4 reomocoadfa  lnvs;s)tetr(mpno4ame liesl() rtm(mp;u4aetnmfcilt sDelnvs;u4tleoxf3tydlpDrau s;t0setmio iy1openlneiltf Dua(r ;t4tpeomictld a2ulu p;u4 exrxr ty1lmD luvi (0 eurirpiudlle mnvsltfaDrau  oo0oeeo iciatfm2umn o (0alxoif iotla e uvslt  2urio iu1olt mietltfaDtmur nu4ale mo3iyd a ra(vs (0 rtnmr3oytla r ueils0 2xmxo3no1omenmicia(fsDtmu pno4tpt  ieiytfs um(ms;t0 ltoxf totoaDe iei ()t2uoimpoydomt lfeiasf rtau p;u4opeo f3tadla2rm( pn()tlermr3oadopDran o;(  exoxo iu1lm nmnetls aDta(ro;u1oet  ietat aDuau pnt0aeeomocoydfa ean i s)t2xo(mpoodlmee fet (f rtmum ou0aptn o3iad sDrl(mont0arerxrciadfmDe u o;s)seum(m3nu4amt mfvtl()sDtrumpno1ole ioctysfa2ra( onu4treoir iy1lm r u o;t0tetriopny1ol elnvt ()a2rrum ot4opt  fcildlm2elu p u)arerxf iydlmtraiei t0s2xrim oo1aleelfet t  2rr(  ;o4tle  oetltla rmuvp t4 lxnxf oodlaD lieslt setoir3nu4lmtemnviat) 2ta(rooo4aee  i3tldlmDuan sn(0alenxo3tydlp eli o t trtmxo3nodom n nct ()sDuaxmp;o0ale  f3tasfs ea(vpnt4trxomf3oo1lm eluei;t0truoxrpiydamtemicta(  2ra(  ;u1apx mociydfa elnmsnu4aetnio3ta1fmD lu o;s0 rtrimpiy1lpenmncs t s2rm(ronu0tlxnmietydls2ea( p u)aetnmo3ty1fate ues t)teurim io1lp nlnviat)srur(ro;o1tpe mo3tat s2eaumpnt4 lxoio3tadoa rln s;t0srtmxr3nu1altelfvtlsf rtr(  nt0aexnif3tldlaDuanmsn(4 renxfcoydoa rln slt0texm(opoudlmt miviasfartr( pot0olxnmictadfmDelums;u)alxrifcto1lpDr u i;() eurxmpou4ope  nct sf rtr(r ;o0aleomietys sDraums;u) exnmo iatfm eluvo s)srto(m oy1om   fcs ()sDrau poo1oexnmfeiasfa emnvp t) lxomfctytlmDean il(0 rxrxrpoy4lltelfcsltfarraurp;u1ope ioeiltlm rauvo;u0 rxoirctadfp eaneolt0 rurimpnu1lmeelfvilsfa2raxrpoo1tpto ieiad m um( o;(0trenmr3iodfp  au i;() 2tr(opio4llenlfci tfaDrm(mo;t1opt ifetyt s2rau s;u)arxnif ty1opD au ilt  2xr(opoodap e ivi tfsDraxrono4olenioetas a el(monu0alxrif3oa1oat ln i s0s2trim iudol eliesatf Dururont1oexo i3tltfsDean pnt4 etoxfciydfmte ies s) 2xoxrpou4lmenlfeil(f rtm(mpou4apeomi3iltfsDemump u)tltrmociadlatrai o t0trtrxm3iodlmen fvs sf Dtr(m nu1opeoiiciydfsDulnvs u4aeerxfcoatfat lnesls)texoxrpoo4oltnlics () Dtmx onu1olx ifciytfmDemn pnt4alxomf3iytop r nvs t) 2trirpiy1ol n fctatfa2uru oot0oltnifeiltlsDea(vo;t0aexrxr3oa1la e i s (0 rtr(m3iu4lmtn ncsl(fsrtm(rp;u1oexn octysfa rlnvo;t) etnmrcia1omDeaueols0 2urxm io1ameemfvs sf 2tr(root1oltomociydlm emnmp u0tlermf oy1fmDrlneo;s0srxmxr nu1lmee nciasfsDtmumo;u4tltomoctysfs ra( s u0trxrxf3iatom  aueo;s)srumxm3oodll  liesat  Drm( o;u1teen fctldla uln onu0arxnxo3iotlpDelu olt0s2xm(o3iudom e nvils  rurxront0alxnif3tad sDemnmp t4tlxoxrcoytoa eanei t0 rtmim3oydomtelieta()aDtr(roou4opx  icilsls2umu pnt0 ltoxo iydlp  anvo t0texmxrpiy1ole  nvsl()aDuaxm ;t1tlxoifeiat m2ua( p t4 lxoxrcoo1om r u il() 2xmir3nu4lpte ncs sf Dtmu pnt1tleoiicildls2rmu s () exoiociatlmD au ilt)s2xmxo oo1olee ncsasfarurumpnt0alt mociydfs elnvpnu4artnxociotlp  auesls  etoir nudolte fvsat  rum(  ;o1aetnifciadfm ea( s t0alxnxf io1fpD li s;s s2trxr iydlmtn iesas sDtmu onu0tptnmfciadlaDea(msnu)trxoif iytlp rlueils) rxrio iy4amt  fes sf 2tmum no1alt ii3iyd aDrmnmpnu) rxrir iotlatelu i (0t2uoio3iy4alenlfeta()srua(mpnt4tltnioeiat m2eaumo;(4 rtnxf3totlptrlu s ()t2uo(m3io4olen neta(  2raur nt0oltoii3ils mDea(vo;(0trtoxr3tadfa  lnvs;t) rurxr iodoptn ivsls) Dur(rp;t0tlxoioeild mDumnms u) rtomf3tydfa eauesls t2xr(m nydlmenlies ()aDrmu poo0opxomf3iytfm ra(vsnu)arerxf tadlp   u s t)s2ur(opou4ol nlfcils  2tr(mo;o1oltomfeild a eauvs;t0trermf oa1op  ai sl() rxrir3io1lpe lfcsatf 2tmxmpnt4aptomoeiasfs2ulumont4texomo iadlptranvs t0setoxr3io1am n ivt (fs2tau  ou4tlx mi3iydfaDumu s ()altrxr3oodomtraueil(0srurio ou1op n fes t sDrrur oo1oex  f3tyslm2uauvpnt) exoio3tatopD lues;t)s2to(mpno1om n ivtltfs2rrxm nt4tltn o3tltfsDrau snu0alermo3oodfm eln sl(0 2trim nu4lp e iesat s2uaur oo1alxn f3tydlm2ua( p;t0teenirctodoptelivi;(  eumxm3ou4oleelictlt) 2tmurpnu4alxnmf3iasfa2rmu on(0teeoxr3iodoaDean o s) rxm(o3iy4lp  lnvslt)s2ta(m oo1alt io3iad m rm( o (4 lxrioctytfa  ln ils) rtoio3ny1oltn ieil(fsDtaum oo4oeenioeiadlm2eanmo;t0tltoxr iotfat lu il(0t2xrxrpiu1lm nmici sfsrrmxmonu0tpt iieiysfm2umu p t0aetrir3iadop  ai s (0t2xrxrpiodomtemfvsltf 2tmuronu1optnif3tas aDel(vsnt)teeoif ty1op  lnvils)s2ur(r ny4ap nlfesa(fa2rmx  ot1tetn feiadfs emn o u0tlenio3tydfa   neo t0tetoir iu4lme mnciat)sDrrxrpot4oleomoetad aDua(mpnu4aeenir to1fmDeanvs;( sexoxr3no1amte ieils srtr(moou4tpx ii3tlsfa2rauvo;(4trtrmfcoadoaDe uei;( srxmim3ny1lptelfes s)arrmur ;o0alt  feiyt a2umuvsnt)aeerxrciadlmDe i i;t) 2xoxm3ny1op e nvs ( artaur ot0oee  oetld s2uln p;t0altnxr3oa1oaD  ueolt)t2urim3oodll emnetat aDrmurono0tpxn ietadfm2rm( sn()trtoif3oo1lmDe ues () rtmxm iu4aptemivt (fsDtm(r oo1olxoioetyt m ean p;()tlxoir3iadfm eauvs;s0 rtr(o nudol  miei ()a2rruro;t4teto f3tadfm rmums;u) lxnir3ia1fptrau ilt s2xoxrpiodlpte iei t  2trumpnt1alxo ictls m ulnmp (4arxrir ootlp eaies;t) 2xoxopiu4lpt liesls)aDrmx p;t1ope  oeilsla ean p t4areoir oatlpt ai ols0srtrxm iydomtnmiesl()arrrum nt4tptomf3ias m eaumo;(4aetnif3iytfm raneo s0truo(m oodllt  fetat  Dumumpno4aet io3tyt s emumo;u0 lxoif3oatlaD  nvsl( t2tm(o ny1ape  feta()a2rm(rpoo1apx  octltlm ulnvp;u0aeeoxf tytlmtraivs ()teur(o3ou1ape mfvsl(  Dtr(ronu0oetn feiytlsDrm(vpnu0trtoxfcoadlm rlneo;(0 2ur(r io4llt lnci ( srrmumono1tpxo feiytls2rl(mpn()tetoxf3to1lpD ln s (0 rtoio3ou4omtnlicia( arum(rpnt0opeo i3iysls2ua( pnt0arenmrciadomDeanvo s seum(opno4altnmies t)aDuru poo4opxnmo3iydlmDumumsnu0tltoiocoytom e ueo ( t2toim nudlptelncils) rrr(  ;u4apxo oetadfa elnvs ()aetrir oydfpD an i s setm(opiudapen ivil() rtrum ot0oee io3iytla2em( o;u4 lxoxr iatfmDe ivo t0 2uoxo oydlptn neia( a2ururp;u1tex moeiyd mDran p;t4 etomo ootlmteau s;t)s2tmio3no4lp   fvia()a2ur( p;t0tetnifciad sDeanvo (0tltoir to1fa r n olt teuoxo ou1am nmici t  rtaxm ;o0oetnif3ilt m uaums u0tleoif3tatoptr nei;()srtr(m3iudll   fet s  Dtau pno4tetoio3iaslmDem(mp;t)arxomrcoodoatrai olt teuoxrpnydaptemfesatfaDurx o;t1apt ifciytlmDea( s;()alenxf todfpte nvs;( teur(m3ou4omtnmivtatfaDua( pou1ole ioeild aDua( p (0artoxf iy1op   ueols  exoxo io4op e nctas)aDtm(mpou1apeomo3ilt mDrmu p;t)tetnxrcoodfm   nei;s  2ur(m3no1om   nvia()s2urxm ;t4ole  oeiyd a ra( p ()texoxfcta1op raiei;t  2uoim oydalee icia(faDumxr ou4texo iciatlm2um(mpn() rermr3oa1lat lueilt0 rxm(m nu1lm nlnesas) Dtauro;o0tlenmfeils mDeauvo;u)texomo oa1fp rlies s) 2tmxm3no1ap nlivil()s2um(rp;u1tpx iieiltfa2uan p t) reoir oa1lp  luvs s)tetrim oy4ame lneil(f 2ra( pno0oee  ieild m2rau o t0trtnifcoadoatelu o t0t2umir nu4omtelivi ()srtaxr oo0apxoiictltfs uanmo;(0 lenmr3iytfpteauei t) rtmirpno4lp  mivia(f 2rr( pnt1oetnmoctatfsDua( o u) ltrmr3todlpD  i s;s0srxoio3io1lp e feiat) Dta(monu0olt  o3ilsls2ranvs t4artrif to1lpD  nes;(0srxmio iodlmtnlicias) rtrxront1tlxo feiyt aDrlnvsnt0teermf3totopt ln i;(0srxm(mpoo4ope  ivsas  rrr(mooo4alxn o3iat m2eaumon(0teermo oytfmtr u i s sruoxrpno4lle mnesat)arumxrp;o4tpeomoeiltla2umu snu)altoir3tytlpD livi s trtrxr nodolt mivta()aDtmurpot0tlxn oeiytfs2rl(mpn(0tetnmf3ootoatelneol(0seto(r3oo1ll   iei tf 2urxro;o0opt ii3iasls ea( s t) ltrmo3iatfaDe nes t)s2xoir3ny1ame lfct t srurx poo4tee  iciadfaDrauvp (4 lxnmr3ootfp raieo;t0srxm(o oy1amte fesat aDrax  ot1aleo ietlslaDrl( o;u4 exrio oa1fmt  neo t0sexoxm3nydom elivtls srum(r nt4aee ioeilslmDem(vo;t)tetnxo ootlmtrlivilt)srxmim3nu4lp elnvtasfsrua(mo;o0tpeoio3tldls2ea(vs;(0 rxnmr3iatoa  aivo;t) etoxm3nu4ale  fci (  Duax o;u1opt ii3iltlm ranmon()alxrmf oodla e uesl() rtr(o nu1omtemfcias  rra(rooo4tpe  oeiytfa eaumont4 ltoxo3iadlptrli ils)t2umimpoudamtemnci s)srra( pnu1apxnioctat mDra( sn(0alxrxf3ty1fp r n ols s2xo(o io1al   fvt sfa2taxrpoo4apxo iciydla2emnvp u0tltoxf3iotfpt  n o;(  rxmirpiydamee nvsas)arraurp;t4oeto ocias m2ranmo;() exnmf oa1fm eai slt trxmio io1lm elfesltfaDrmxro;o0optomietatfa2elnms t4tlxrirciadfmDe i s;t tetoim ou4omtemfci tf rrr(mooo0apx  fcild m rm( o;t) eermocoy1lpDrlu s s0setmiopiy4omtnliei t aDrrxm ;t1olxomi3tlsfm em(vs (0aetrmo tytlpt aieil( s2ur(m oodole mictas)arrru  ;t4oeeo octydfsDuln o;u0alenio tatlpDrli ols0 exmxm oy4aleemfcsl()artm(  nt4oeen feild m2emn p (0teenio3oadlaD livsls0tetoio io4lptelfcsatfsrua(r ;o1apeoif3ilsfa ran snu0 renmf3oytom  lu o;s) ruoxo3oo4apeelics t  2rau pno4oltoiiciydlmDelumpn(4tetrxf3ia1fa e ueslt) 2um(o oodlleelnvslt)sDrruro;o0aex  ictltfs2em( ont)artoxo3tytlp  aies t  exoxopou4alenlieia( s2urxr ou1oeeomiciad sDuln s (0tltnxrciotlmtrluvsl() eto(m ou4lm elics tfa2rm( pno0optnmfciadla2rmuvo u4trtrirctotfm eauei (0s2umim oy1am n ict s)aDrmx  oo4opx  feiasfs2raumo;t4 eeomo iotomDe nes (0srurxopio4am elneta(f rrr( oot0aetnmociyd m2rlu p (4tlxnio todfaDr n o;s)srxmxmpoy1lltn ncslt sDtrum oo0tee  i3iyd aDrluvo (0 leoioctatoatr neo;(  2toxr nodomee ieslt aruaum nu4tltnmfeias a rluvsnt4 eenmf iotfm   ivsl()srtmio oy1optemfcsl()aruaxmono0oetoiocildls eau onu) lenxfcta1fm  luvs;()setr(o ny4olee nvslt a2rau  ;u4tlxnmi3iad s2rmnmont) etrioctodlpD lueols  2trim3nu4ame mietatfsDrax oou1tpe ifctad m2rmuvpnu)texnio tydfatr nesl()s2xo(m iy1ap e fciatfs2rrx  nt4tpxomietas sDumnmo ()altoif3iytlpD aneols)teum(o ou1opt lieslt)a2umumpno1oeenifctltlm2uauvs;u4 reoio tydomD livil( s2xmir3oodopen nvsat)arrrur ou1texo octys a el( o u0 exrmf3ta1fa rlueols teumxrpnydom nlfcilt)arum(ro;u0teto ociat a2ul( onu4alenif oo1omt auesl(0trtmir3iy4llee nei s srtmum ;u0tet  ictytls emnmo;()tlenifctadlm eluvsl( t2xoxr nydamt  fvs t)s2rru o;o1tptnmicild m2rlump;u4trxnxf oadomt auvo s0trum(r ou1ape mnet ()sDrr(r nt4tlto f3ilsfs umu pn(4aeermf oa1lmD lnvol(0s2uoxr ou4lmtnmnvsa(  rtau o;u4olxn feilsfm em(vs;u0 rxnxfcoy1lm rlnes t0srtoir iu4omeemnvslsfa2tru oou1tlx ifeiyslaDulumo;t0 rtnirciydlmDeaieols)trurxopnudlp  mivs t)aDur(mp;t4apeo f3ilt m2emn o;u4areoxf ta1oate uvi s)texoiopiudaltn ivils  2ta(m nu1tltn fciyd m umuvsnu)trenmr3ty1fmD aiesls  rto(m3nu1lm emnvta()aruaxmpoo1opx  ocildfmDum( s u) rtoxf tadfaD  ivs;()sruoir3nodopeelnet (  2rmump;u1aleniocilt mDrm(vpnu4tlenmr3ty1fm e i s s0texoxrpny4olenmfvsatf 2ta(  nt0alt ioctydfa ua(mp;(4 leoxr3oa1om elivi;t0t2xr(o iudlmenlfctat  Drax ooo0opxnmicils s2uanvo;t)tltrifciytom elneo () 2toir nodol e iei () rumxm nt1tee  octydla eauvs t) ltomrctotom   nvi;s0srurxm iydam  mnciat s2rmurpnu0tlx  oeildfs2ua( o u4 ltrxo iodom rlu i;s  euo(o oy4ale mfvta() rur(moot4oetnmf3tydfaDeaumpnt4tetoxr totlate nvi ()srxrim3iudol  lfesas) Draum ;o4altomoeiat mDum(ms ()trermociatlmDeau o t0 rtrim oydam n fcia()sDur(m ot1apt iieiyt sDeaump;u4tltriocoatom e ivol(0 2xo(r no1omtelfeias arrauro;u1texo fctasfsDumu on(0 lxnmf tadlaDe nes;s trtmir nu4op nmfvtasfsDta(m nt4olt mfetadla umnmpnu0tlerircoatfmt lieil(0t2tr(o3oo1lpeelneilt s2ta(ro;u1tpx moetatfsDemu p;(0texomr3ta1oaD  nvo;s sexoxopnu4op emfcsa() Dtmxr nu4optnmietatlaDemn p;t0trtrmf tydomD  neol( truo(mpoo4am nlnvi (fs2urx  ;u4oleomf3iadfs2em( sn()artnmrciotomte n i ()seumio3oo4ll e nesl( srra(  no1aexoif3ilsfaDel(mon(4trxomo oo1oa r i o t)sexrxr io1al  micta() Dum(mo;t4oeen f3tld a uaums u4 ltnmo3iytom rlueo;s  2xo(r3oydap emics (  rrmx pno0tex mi3tydfa2eanvs t4aexrmr3tytfmDean ols texr(r oy1amtnlfctl( a2tr(ro;o4apxomiciys s2rmu snu) lxoio3to1opt li s (0 ruo(m no4omtn neilt aDur(  nu4openmieils s umnvp t0arenmf oy1fmD  u ols seur(rpnodamenmfes tf rra(r nt1tex ioctyd m2rmu o (0trtoio3iytomDrau s;(0srxmxo iu4lmeemnctl( aDur(mp;t4tex ii3iytlsDuauvp ()alenmr3tydoptr iei s0trtr(m3io4ope  fes t)arumumpnt4tee  fetyd a ua( o u4 lxnxo3oodlm eluvsl(0 rtmxm oodom nmfct (  rraxro;o4apeoioctasls el(mp;(0 rtnif3iadfm r uvs;s s2urxo iydop emfcsls sDtmu p;u1tpx ii3iasfa2ua(vont)trxnir iotomD anvi s)srtr(mpny4al nlfcil(  Drr(  oo0tltnmo3iltfa2rlu s;u4tetomf3iydfmDe uesls0 rxo(r oydolee nesas)s2ururoot1oltn oeiadlsDranmo u4 ltrxfcia1laDrluvils)t2tr(r oo1lmeelfci (faDtaxr nt0tpxn o3ildla elnmp u0arxoxr oytop elivs (0sexoxm no1amee fesls srtru  ;u1oee mfctld sDrmumont4 rxrif3tytfpDelu i (  2xo(o oo1lmee fet (f 2uaum no0aee moetat m2ranms;t)tetrxf iatfmtrai i s s2trio3ny1ll n nes s aDtrxr ot1apxo feiatlm umnvp;u0 rtrmo3ootfpDrlueo;t0 2to(m3oo4olt  fcilsfsrtm(  nu1olx if3ildla eauvsnt0altrxocty1fptranvo s)seto(m iydomeemicsat a2tm(r ;t4tptnioctysla rluvp;t) rerxf3ta1fa  lueils)t2xo(opoudll nmivs ( aDua( pnt4olx iociltfsDeln p (0trxnmrcoy1lpDeauvi;s s2uoxm oo1aptemiei s) rtr( oou4altn fciaslm emuvp u)tetomf oatfm r i i s t2um(o3nydame  ncil(  rtaum nt1apx ifeils mDrm( s;(4arxnifcoadlmt aueslt)teumim ny1olt mieils srtrur nu1optn f3ild sDua( snt4 rxrio oa1opteli i t  rurxm3nu1ol n ies t sDtrxrpot4teto ieiadfm2rmumsnu)alerir iatfp r i olt trxr(o3iy4am nmfesas  2ua(mp;u4tlx iictltfmDumnvp u)tlxoircootopDrlies t0texoir3oydap nmfei ()srrr(rpoo1olt  iciadfa ulnvo (4 etrio3tytomDe u i s s2toir3iudale liesl(  2uaxmp;u1aex  ietlt aDrln o;(4 ltnxr ootomteaivo ()t2xriopou4omeelfvs s)s2trxmpot1oeenmieils s2el(mon() etoio iytlatrlivols0 eto(m no1lm e nvsas  Duaxmoot4tpen o3iadfsDrmu sn(4aetomr tadlmtr uesls)srxoirpiy1ole  ieslt) Durxrpno1oetn o3iat sDranvpnt4treomrcoatfpteluvo ( t2tr(o3oudlltnmiesl(  2ururpot4tpt mocilsfaDrm(vp;t)tlxrirciotoaDrauei s) 2xoxopio4al e iet s sDra( ont4aee iieilt s2rlnmonu4altrif iodla ranvo ( srxmxr ny4ll nlnet () 2rmxr oo4apeo f3tydlmDum(mo t4trerxr oo1oa r nes t  etr(mpoy1llt  fvt t a2uaxm nu4aee  feiat m2ra( o;u4alerxf iadlm   iei;()tetmim3io1lpt lietls)s2tru  nt0olt ifctysls2ua( p;t0alenmr3oadfa  livolt0seuoir io4llte ivi tf rtrumoou4tptnmictysfs2elnmpnu0arxoxfctydop  aues t0 2ur(opnudale lfvia()artru  ou1ale  ieiysls rmump;t) ltoif3todoaDr u ilt tetoxm3io4olt liesat s2uaumono0tpe  oeiytlm uan p;t0teenifciotlmDrln o;(  rtoimpou1ol   icils aruaxrpou0aptomoeilsla2umuvo;t4tltoxr3oadfaD aueil( trum(o3io1amee feils  Duau p;o0olx miciytls el( p;u)areomr oodoat aiei (0t2xmxo3oy1alee nvsa()arra(moou0olto i3iyslm eaump;u)aeenio iydfaDelieo s0 etoir iydolte ict t)srtaxmpno1teeo feiytfm ulnmo;u0alermfciodlptrlueo;t)sexoxo3iu1lme  ncsl()sruaxmpno1oeenio3iytfm umuvp u4 ltnxo ta1opDe n i t teuoxo ny1lmtelivsa()a2rm(  nu0oeenif3tadla eluvp;t0trtrif iadfp  lues;(0 rtoir oydol  mfvs (  2rr( ono1alt  ociad aDrl(vsnu0trxoxo3iodoptr u i s0s2urirpio1olt mfes t sruaumono1tpeo fctadfm2uanms;u0 lerif todoa eluvi;s)sexmxmpnu1opt  iesa() rrau o;t0aee mi3iad a el(mp;u0 exoir oo1oa eauei ()sexmir3ny1ll  livt ()a2uax ont4opx mocilt s ra( p;() reomf3oytlm  li o t) 2uoir no1apee ieils s2rrx  ;t0tptn ocilt m umu o t4 ltrmf3oodopD  n s t) exoim3iodal n fvsas)s2um( onu0oeeomfciltlm elnvsn(0alxrir3oy1fmtraues;s)s2xoiopno4ame mieils sDta(r ;t1oet iiciadfm2um(mo t4trtnxo3iadopDeauvs;()s2ur(m io1ol  lies sf 2rrxr nu1teenioctytfs2uan s t)tetnifcootfaDeaiesl( t2tmir3nydam  miesltfa2trumoot1aexo oeiltlsDeauvp;(0 lxnxf tydoatrai il(0setr(o3oodapt  nvi s) Dtr(mono0aetomo3iys aDranvo;u)aleoxfcoy1laDrlu i;(0 rumxrpoydll nmfcsltf 2uru o;u0opxoifeiydfm rm( s;(0 etoxf iydop  liei;t) exmxo io1apte fvils)srrmumpnt4opx mocilsls ul(vpnu)arenmo3tytomDeauvo t srxoim nodopen nvta( s2trxrono4tlxnmoeiysfs2ranmp;t)aeeomf ootfm   ies t)srxrxr oo1lpeelnci t)aDuaxro;t4tlt mf3iltls2umums u) rtrmfctadfp eau s s trumir3oy4am nlfcta()sDraum ;o0altnioeiydlsDum(mp;(0aeerxo3iy1op elieo;t trtrio no1lmt mfvtatfa2tm(ro;u1olt mieiadfs ea( p;(4 exnmfctatopDr ueil()seumirpny4optelneta()sDua(mpoo1tpt  ocilsla emnmsnu0tltnxo3tydfpD  i i t0 eur(r3iu4optnlfetatfaDtau onu1olenif3tad m ea(vs;t0alxnxo ta1op eau i (0texrim3oodlme  ivtl( sDtr(r ot0alx ifeiyt a2el( p;(0texnio3oytfp e neolt trtmxmpnu1lptn fvtlt a2rmu  ou1tpen o3tadlsDelump;(4tltoxr3iydlptelu s t)srtoim3io1ol e fciat)a2rrxmp;o1teeoifcilt m2uau p;u4tlxrmociy1fmD lu ilt)srxm(mpnodaptnmfviltf 2tru pou1aet  ieiyd sDua(vont)trxoif tydlmtr ies s0srumxr ou4lme mivt ()aDumump;u0altnmoctls sDem( pnu) ltoxf tadlpD  i s;()srtrxrpiu4opeelnvt sf Dum(rpnu4tex ifeiasfaDeauvs (0trerirctotfpDrluvo t trxmio3ny4ameelfvt (  rum(m ;t0ape iieiyslmDea(vp ()texoifcoatlmte ieols)sruoxo nydlptnmivil(  Dua(mpnt0tee  feiyd m ranvp;(0 lxomr3oo1fm elnvo;t  exr(o3no1al   feia()s2rrur ;t0aet  feiydfaDrlnmp (0artnmociytlate iei;t) ruoxrpiu1al n fvt ( a2ururoot4altn ociyt a2ul( o t4texnxo3iy1laDrlneol(0trtmxr3no4al e fvilt aDum( o;t1ope mocias a ea(von() renxo3iy1om  lu il(0t2tr(opny4al emivs tf Drmu  oo1alx  feiasla raump t4 lenmo to1lp  ln o;t)trum(o nydalenmfct sf rraurp;u1aptomf3tlsfa emnvs;u0altrir ootfm  lies;t)trtrimpoydaleemiesl()a2ur( poo1oexo oeiltfsDuanvs u4trxrmo3iadoaDrai sls) exo(o3iu4om e nei () Dumxro;o1alxoifciys a2ua(ms t)alerifctadopt  ivs t)truoirpny4amtnmict tf Dtm( pno1aptnmoetytlm2rmnmo (0texomf tatfat  nvs s s2uoim3iodllte fesls a2raxmpnu1tee micilt s2rm(mp ()tltnxfcoatoaDe i ilt s2uo(opiodaltemfcta(fsrrmxmo;u4optniocilsls ea( s t4tlxrmo3io1fatrlnesls sruo(o3oudamtnmivi s arraxm oo0tptn feiysla ulnmpnt0artoif totlat ai sl( s2xrio3no4omenmfvs sf 2tr(rp;o1opxn ocilslsDrm( pn() ltrxo3iy1laD  ueo t)s2xmirpoo1omtnmfvi (  Dtauro;o0aptn iciat a2emu on()aexrmfcoatlmDeli sls  rxrxo3iodal  lfetltf rurur oo0apxomoctasfs ranms;t)trtoir3oa1fp  lu il(  rtrxmpiudlp nlfct t  rtr(m ot1oexnmo3ildfm eluvo;u0 ltnirctytomD aiesl( seumio3iy1ole mnesa(  2uaxro;u0apeoiictad aDel(vp u0tltnmr3ia1lm   ivi;t0t2umxr3oy1amtemivsls)sDtmx o;t1tee mfcild aDel(vonu)aeeoxr3io1latrlnes;s0 rurxo nudalte nei sfaDrm(  oo4opxnmf3iyt s uau ont0 renxf oadlatrlnvsl(0 rtr(m3nu4ll  lies (fsrur(m ;u1tpxoiociasls2um( ont)arxrxfctodlpD  uvs;s)seum(rpoudlpe lnci ( arrmu p;o0alx mfetasla2elu o;u) eeomr3tatlaDe uvi t0teuoxopnu4lpenlfviatfa2uaum ;u1ape  ocilsla uaumonu4trxnmf totfaDeln s t0texr(opiodaltnlicsasf 2umur oo4tpxnio3tyd aDuan o;t4texoxr3iodfaD  ieilt) 2urio3ou4lmtnmfvsl( sDtmumpot1tlxo fciasfm2ulnmo;u0arxnmf iytla rlieo;(0s2uoim iudoptnmfesa( artru  ;o4aeeo i3tasla2rmnmp;(4artrio3oadoaD  u s;t0s2tr(rpny4omte ivs t s2trur ;t1alxniieiydfa2um(msnt0tetoxoctatlpt  uvsls)s2xmxr3nudalenmics ( s2tm(mpoo0aeto oeiadfa rmn snt0aeerxo oatom e n i;t0s2xr(rpio1ll nlfet tf Dtax ono0tptnmf3ildla2um( pnu4arxnmfctodopD  nes ( texmxo3nodaltemfvt s) Dtaumooo4tptniietysla ua(msnt)trtrmf3tydlmDr u o;s tetmirpio1ale mietl( aDtr(monu0tpt  ieiydfs el( ont0trtnirctadfaD lu il(0trum(rpoodaltemietl( arum(  ou1aeenmoeiltlsDranmsnu0aexoxr oydfmDelues ()teuoim3iu4lpe lfeslsfa2rmxrpoo0apt io3ild a rm(ms ()altrxo3tytomD lu il( trtoirpnydapt licsls  rumxrp;o4texn fcias s2ua( sn(0tlenxfcta1op  aneol( srto(mpiy1llen fcsa(fs2rr( ooo4oltn oeildls2em( p;(4trenir iotomte neo ( seuoxmpoy1lm nmfvsltfs2rrumoot4ape ioetadfs raumsnt4 lenxf3iy1lmDrlu ol( texmxrpiydole mfeslt a2umxmont1oeenmfeiatla2elums;u4trtnxf3tatlm eanvi s sexmxrpnydap elncsa(faDrmxm ot4oltoif3iyslm rl(mp;(4altrxfciodopDrli ils  rxoxo iu1llee ictltfsDumx p;u0apxoifeiydfa2em(monu0tlxnmr3iatfm  au olt0 rxr(mpio4ale mfci tfarurxmono1oexnmoctyd a elu o;t4 lxoir3oydopDeli s t0 2xrim3iudalenmfci ( srtr(rp;o0tetoio3ildfaDra( s;(0 ltoir oodla  au o t  2xr(r iudal nlnvtat)s2ta(  ;t1tleomf3tyd mDemn o ()alermf todoaDe ivo ()s2trio oo1ome liei sf Dua(r ;u4aptomo3tlsfmDrmu pnt0aeeriocoadomDe uvo;t texoxr3iodap nlfvs ( arur(root0apto fciyd s em(msn(0 exoxrcty1lpteaieo ()setmxrpou1alen ivtatfaDumxrooo0oeeo octytfaDel(vs t) ltoif3tatlp r i i;(0trxrirpoo4lmt mnct t a2tmumpou4apx  feiatla ua(vsnu0artnirctodop raieo;s0trtrxrpnydaleelfci sfaDtru  ou4oexomo3tlt s elumpnt0tltnxf tydom eluvslt s2tm(rpiodap   fvsat  rtm( p;t0oexoiicias a2ulu p t0 ltoir3iy1fpD  n sls0tetoio3iu1omt lfesatf rra(m nu4altoif3iad s2elnvs t)artomfciadomtrauvi (0srxm(opoo4lp nmfeils  2uru  oo1aleomo3ild m ulu p t)altoxfcoodomDeaneo;s0 etm(o io4lp n ivilsf rtmurpoo0olxn ieilt mDuln o;()tleoif3ootfp e uvo s  rtoimpnudole mnct s)sDrrur nt1tptoiiciyt s rl(vpn()tlxoif oydlpDran s s) rtrir3nydop elfct t) 2raurpnt0tpe moetldlaDrmnmpnu4texoiocia1la elieo;( texm(rpnu4alt  fet t)aDtaxr ;t1texn oeiysfa2rmnvo (0trtnmocootopDe n ils s2uriopno4op e ics ()aDumxrp;u4tpe mf3iadlaDuln o t0 eerxocoa1lp elivs (  2xo(opiy4ol emfviat)sDururpot4apxoifeiysls2emu o (4 rerir tytfpD auvi;s) rxoxo oy4olt livs tfa2tr(ro;t0tee  fetatfaDuln s u4artnxr3oytlm eanvils s2uoim3ou4olt  fcsas)aDtmx  ;u1tptn i3iadfm ulnmo t0arxrxo3iotlp   n i;s0t2urim3oy1om nmnes t sDraum nu1tpt mfeiysls eanvo u)alxnif3tytfaDrauei;()sexrio3oo1oltnlfesl()arumxmooo1oeto iciydfs el(von(0 exnif oatop eaieo s)tetoir3io1ope lnvtat)aDuaumo;t4aet  ieilslm uluvo (0aetrmf3ta1omt lneilt  2xmim3oudap nlivias)aDur(r nt0oexo i3iys s2rmuvo;t0 ltnifciotlatraueo t)srumxopiy4omte fvil( a2urumont0oleomfctatfaDuanvp;t)alenxocoy1lmt ln s;(0 rumxr nudamenmictat a2uax onu4olx iieildfs2ea(vs;t0 rxomo3oodla elnvi;t) etm(rpny4olenmictat) rur( pot0tleomfciasla rlnvsnu0 lerio iytfmD  n ilt)sruoiopiu1lp  mivslt aDtaur ;o1oleomfcildfa ua(vs;t) rxrif tadfpt  uvs;t sexrxo no1ll emncta(f 2trxmpou4tpe  f3iat mDrmnmpn(4aexoif3iotfmt aivi s0texmxr3no1olenmncsat aDrrumpno1ale ifeiydfa uln s u0aeenxo3ootfa r ues (0s2ur(m3oodal nlivtl(f rraurooo1oetnii3tlslaDul(vp t0aetrir oatla   uei;t0trxr(o nu1ap   iet s)arua(moot0tltoiictldlm2el(mo;(0artnifciatfa eaies s0trumio iu1llt  icsa()a2rmu pnt4texnioeiysla2uln p t)arerxr oo1lptraivsls)t2xoxrpnydll elnes (fs2uru  ou4tpxnmfeiydla2umnvs (4trermf io1fm e u o s srxoxo oodlleelfetls)aDururont1tex  f3iysfa2rmu p t4aeerxf iadfpt  i sls0 euo(opoo1op   fcsls  rtrxr oo0oeen fciys s rlumsnt)tetoircio1lm eluvols)texo(o3oodlmt  nvsa( a2ta( onu0alenii3iaslm rm( s;u)trenmr3oa1omD lu s ()srxr(rpno4al emieslt  2taurooo4tex  iciat a2rlumon()altrxo oadfa   n s;t0setrir3iydaptnlfvtls)sDtru  ou0alenifeiydfa2el(msnt0trenxo3iy1lptrlneo;()t2ur(mpoo4lmeemnvt s a2tm(r ou1aexomo3iad mDeluvs t4aetoio3ta1faDrluvs ()sexr(m3oodlmt lfvt s sDtaxro;u0opxoiietldls elu p;t4tetrir3oy1fa raieilt tetmim oy1ap nlieiat)arrmx pot4olxniiciaslmDumums (0 lxnxf3oytomD  n i;() 2trim iodomte iei (fsrtmxro;o1texo o3iadlm2rmnvp t) eerxo3iatfmDrai s (0s2tm(m ou4lptnlfcsls  rtm( pnt1openiieiltfm2ra(mp;u0arxoirciodlpD  ivs s  rtmir3oy1lp n fvilsfsrur(  ;o0tptniicils a umums;u) lenmf3todfaDe nes t0 etmxmpiydopt mfct t  Dur( pnu1alx  ieiltlm2ulump u4altnmo3oytfa e nvslt srtoxopoo1lleelfes t s2trx  ;t4oexn o3iad mDem( o t0 etomo3ta1lmte ues;t)teuo(r iydale lnvils)a2urumo;t4teto o3iltls2uau s (0texnmo io1oa  auvolt0srto(o3ny4optnlfcsas  Drrurpot4opt miciys m umnmp t)aeenxr3iatfm   i s s)srxr(m3oo4ole licsatfsrtax p;o4altnmoetyslaDuanmpnu4aetoxr3to1fm eaivs;()trur(r oo1apenmietas  2ra(mo;u4aet mieiyd a umumo;(4arenmf3iytlmD  nvs ()s2umxo3oydal  mieilsfs2um(moot0alt iiciyslmDra(vo;u)aexniocoy1laDelueol()sexo(o3ou4lltnmfvtl(fsDumumo;u4oeeo iciyd sDranvpnu) eenmrciadlm raneil( s2umxm3oo4lpt  ici tf Drr( oou4texn fetltfm eanvo t4aetrmr ootomt li slt  ruoio3io1opeemici t a2rm(m ;t1oee  i3iadlm rm(vont4aleomf3iotfmt aues ( s2trim oydaltnlivtls s2urx oot0apx io3iysfa eanmo;u)teermfcoy1lpD  nvslt srtrxopny4op  mnet t)srtruroou0aleoif3iat a2el(mo ()tltrir ootomt aivi t0 rxr(o3iy4omt  neiasfsDtru  ;u4tlenmf3ildfm2rmnvpn(4arxoxf3oydopt auei;s)truoim no4olt lictatfs2ra(  ;t1tex io3tldlsDrm(mp;u0 exnxocoo1lp rln i;t)teurirpny4alee nvils  rtmurpou1opxo o3iysfa em(vpnu4tltrifciydlpteanei;t)teumio oo1al  mneslt) 2ua(r ;o4aee ii3iasfaDeaumon()altrmocia1fp  aivo () eurxo3nudamtn fvt sfsrrrxmpou0tlxn i3iysfm2eln s;t4arxomf3iatopDeluvo t)srurim nu1oltelicslt)sDum(m ot1openmf3iys s2rmnvonu4artnxo3tytlateau o;s t2xrxr3oydoltelnvtat)arumu pot1olx mf3ildla2ulu onu) rxnir3oadfm rauvilt)trto(r3iy1olt lfei t sDtm(m nu0aeeniieils s rlu s;(4alerxo tatfm eln ilt) rto(o iu4ole  ict sf 2rmxrpnt0ole if3tatfm2rluvp;()arermocoo1lm rli s s0trtm(r iodalee nesl(  Duru  ot4tex mfeiad sDelnvo ()trxrmfcoodomDranvilt s2urimpoudllenlfeia( a2umu  no4tptn oetad sDelnmpnt4arxomr3io1fmtraivs;( t2toir3ou1am  lnvi ()s2trumpot1opxn icilt s2ra(vp;()aexnmr3tytoaDeli s;s0s2to(o3nydal e fciat) ruaxr oo0apx mfetldfs rmuvo;u4treoif3tydla rli ol()setoxr3oo1am   ivias aruaxmp;u1olt iociysfm el( o;(4treoxr3totlat ai s s0 rurio3iu1amtelnvtl()sruaxm ;u1tltn ociytlaDumuvsnu4 ltoiociy1omDr n s;t  rtoxo ny1openlncia(farraxrono0optniieils a2elu s;t0 exrxfciytomD aiei;s)srxmim iy1op  mivil()a2rrxmpnu4olt  oetytlaDelump t)arerxfcty1oa r ies;()t2urio nu1lptn icsl()sDtmum oo0opxoii3iytfaDum( s;u0treoio tytoptraieils)s2uoio3iu4lmt  ieta(faDrax  ot4alx ifetyt a ra(vsnt4tltniocio1oa elueo t) rxmim3ou4omte nctl()arra(rooo4teenmoeilsfs ulu p (0trenmr3to1fp   n il(  2xoxm3iy1optnmfvsls)sDtr(rp;o0olxomfcild aDum(vs;t0 ltnmf3oo1la r iesl( setrxr iy1lmte fctas)srumuroou1oetomfeiys s2rmnvs;()alxoif io1fmD  neolt)trtmim3iy1llt  ict t) rraxmpou0openmoctld a2rau o () ltrxo tydlp elieo;s s2umxm3iu4al  lict ( a2tmx  nt1aeen octlsla2emu p t4 lenmo3oatla elivolt  rurxr3oydlp n nvt t)srtr( o;t1tee mf3ildfm rmump;u0 eenmrcoytla  ln i s) etrxmpiy4om  mfvsat arurxmp;u0apx iietldfa2rlnvo (0alerxfctytlm ean i s)s2toxr3ou1ap  lncsa( s2ra(m ou4tptoif3ilsla2ulu s t0alxrxr3iodla eauvi ( seuo(opiudll elfviat)s2rmumpnt1aetn i3ilslm uau s (4tlenircio1laD an s s)s2xmio3iodam   feta(f 2ur( onu1oex miciad sDeln p u0 renxf iodlp  aivi;t s2uo(m3ou4lmeelnvs s)s2taumonu0tptniociasfmDum(vo;t4aetoxo oo1oa  ai s t) 2tm(m3io1al e fvias) Dum( oot4olxnif3iaslaDea( s;u4teenxfcoy1optean ils  etoir iu1ome licsat  2rmxm nu1tltnmo3ildls2emn on() etrirctodlmte ueo;t)seurir3iy1olt micslsfa2ra(mooo0ape iieiysfa2rlnvonu0 leoxo oy1lpD lueils  2ur(m3oodolt  fctl( s2ua(  ot1tpe  iciadfmDeanvsnu0teerxr tydom elnvslt0seumxrpoudlpe liei ()arrru p;u1tpxnmoeiasls eluvs t0trtrifcoo1omte ies;t truoxo3ny1lme lnctltfartrx p;u0alt moeils s2eanvs u0aeenmrcoydfpDrli s;( t2toxmpiudlleelncia(fa2urx poo1tltnmo3ilslm2ua(vo;t0trtnxrcoydlpDelnvsl(  exoxm3no1amen iet t sDtrxroot0teeomf3ilsls2emnmpn(4tltoifctodoat luvs;t0t2xmxo3no1om n ivtlt aDta(r ;u4aeenifciytfm el(mp;u0 lxrmr3todlpteaneol( seuoio3io1lp n ncia(farurx poo1tleoio3iat a ea( o t) lermf oy1fmteaivo (0tetrim no1ap  lfvta()arumumonu4olx  ociydfs2rauvp t0 lenio oy1oa rln s s)sexmxo3iodomenlieiat) rtrxrp;t0aee mociat a rln o (0altnxo iatomDrlnvolt0setoio oo1am elfesat) Dtmxm no4aptomictydls2uan o;t0trxoxfciodlat auvsls t2xmxr nodol  lneia(  2rrx ooo1ale ifetasfa emuvpn() lxoxrciodopDr ueil(0texrxm nu4lltelfciatfaDrmur ;o1apeniietys sDum( ont4areoxfciydom ranvo;t0 2toxo3nu4llen nes t aDuaurp;t0tpenmfeiltfa uanvp u) lxrmo3tydfm   neo s setoxm iu1oltn ict tfaruaumono1tpx  fetld s ea(mpnt)alxomociytfpD aivo;s)seuo(r3iudllenlicias) rra(root1tptniiciad sDra(vpn(4trxrif3tytlmtrauvi;t0seur(o3io4amen ics s)srta(r nu4tlt  f3iysfs emu snu)trtoxf io1fat  ueol() rxm(o oo4lltemfci (faDur(mo;o1ope iiciysfaDeln on(0 eerxocootfa eaneols0 ruoxr3io1ameemncslt a2um( o;o4oee io3ild a rmu o;(4tlenmr3iodfpD  n s;t)t2xo(m3oy4lm e icias)srtr(ronu0apt mo3iytfa2ul(mpnu4alxoxr tytopDelneslt s2umxr oo1lm nlnvtlsf 2tm(m ;u4aleoiociysfs2elnvp;t4tltoxrciydopDeau o;( trto(o oy4olen nesl()a2urx  ot0tptn ieiyd a2um( s;()aeeomociotlmte u sl(0 rurxo3nu1ap nlnviatf 2ta(r oo1aeenmi3iat s2rmu s t)tlenxr iydfm  an ol(0 2xrim3oy4amen nesasfs2trumo;t0olxn o3iys mDumu p;()tltrmrctatomt an i;(0 2xm(o3oo1ll e fvtat)sDraxmo;o1tlxnif3ias m2uanmpnu)alxrmf3iytfmDrln s ( trxrxo3oudol  licta( srra( o;t4optnmieilslaDrluvpnt0aexrio3iadfpDeanei;(0teumim3no4op   ics ( sruaxr oo0tpe  icildla eanmsn(4trxoxf3to1lmDraivi;()s2xmxm3ny1al  mfvtlsfs2uax  ot4apxoifetydfmDrauvs (0alxrio3todlmD  ivo ( s2xoim3iudaptnlnvi sfaDtm( pnu0apx miciltfm emn s;t0 lxomf3tatfa r ieil()s2ur(rpnu1ll  mncias)a2umumoou1aee mo3iysfm rmnms t)teenxrctatomtrlies;s0t2tmio nodom elnvi sf rtaur nu0tetoifetlsfa emuvo;u0artrir3tydomDe uvs t0s2trxrpoo1altn ieta( aDtmxmo;t1oexn ieiaslsDelumo;u4trxnmr3oa1lmDraueilt) rxm(opno1omeelneiat sDua(rp;u4oleo ieiys a2rm(ms u4aexomr3iatfpt ai slt) eto(r oudlmt  fvtl() rtm(mpou0aet  fciatla elnmo;t4 rtnxf ia1latelieols0texo(opoo4lle mnvil(f Dra(r ;u4oexomiciytlm2el( p;()arenmr3iotfmDeanei;s seurxm oo4llee icia(  2ur(mpno1tpx  i3tld a ul(mon(0tlxnxo3iytom  auei;s t2urir nodalt  icsat srta(moot4apto f3ilsfs ea(mp;(4alenir todoa e u s t)sexoxrpoydlpt mfvsa( aruaxroot0tpeoifeiasla um(vsn()tleoif iy1fpt  i s;()teum(opio1lpte fetlt) rrau  no4apxnmo3tldls2elnmsnt)teenxf3ty1oat  i i;()sexmirpiy1opeemiei (fs2rmu o;u0opxnioctydla uauvs t0aleoio io1lmtr u s;s)texmxr no1ll e ncsas)s2ua(m nt1tpeoioetlt sDel( s ()trtrif totfat  ueo;s)seum(r iodope  fvia(f Dumu ont1tpeo ictlslm2ulnms;t) exrmr3tadoa r u i s  2tmiopoy1lm emiesl() rtmump;o0oee moeiatfm rl(msnu)aleoxf oydfpt  n ils  euoir3oy1optemicsls)aDtru ooo1apenmo3tyt s raumo;(4arxnxociodopDelnvo;(0 exo(opny1lpt  ivtl(f 2uaxmo;o4ape ifeiys a ea(vsnu0trxoxr3oatlaDe nvo (0t2trxr no1lmeemfvtlsf Drax pot0opxo i3tyt m elums;() etrmr3oodfmDeli s t  rurxo iy1lmenmnctat)s2umx o;u1opto o3tydfm2rm( pnu) rxomocoa1lp r ieols)trurimpoy1amtn ivia(fsDrr(rpnu1tptoiieiltlaDean s;(0 rtniocio1laDrau ols  2um(o ny1opee ivslt) rra(mooo4aptnmietas s elnmo u0aexrmfcoodfptrau ols0srxrxrpoudal emfesl(fs2rrurpou1oexnii3ilsfaDuaumonu0altoio oa1lm rlneol(0s2xrxopnu4altelnei (fa2taxrooo0tleoifciaslaDeanvo;u0 eenxf iodopDran ils seuo(r ou4olt lnctas)s2uau  no0alenmfetltlaDua(mo;t)tetoif oytfaDrluvil(0t2trio no4omenlnesatf rrax p;t0opxnmoeilslm2elnmpn(4 lerxr3tadfptrauesls setmxo oo1optn neiltf rua( poo1alxoii3ildla2rmumo;() etniocoa1la eanvs;t  ruo(r iudop nmnvil()s2tauront1aex io3ils s2ulump t0alxnifctytfmt lu slt) 2to(r3ny1llenmici s s2um(rpnu1tleo i3ias m umu pnu0arxnir tadop  lu olt0s2tmxrpio4om nlfci (  rtaxro;u1alt  iciytlm ra(ms u0 eeoif3iydfp e ieils0srxrim3nydom e fvt ( aDtmuro;o1oleoifeiysfs2um( s u0 rtrifctytomt  ivi t)t2trxrpou4omtemfesas)aDua(r ot0opxoifctadfm2rm( on() rxnircoodoaDraues;t0texoim3nodom emfcs sf Dtaxm nu1aptomoctas s rlnms;t0trxnxocoatopD li sls trtm(rpny4opte nesasf Dra(rono1alxn icild sDemumont4tltoxf ty1opDelnvo;(0t2tm(o oy4amee fesasfsrrmuront1tlenmi3iatfm2rmu o;()arermf ia1oatraneo s0truoir iy1lmeelfvil()a2trur nu1tpeo fctydfs ul(ms;(4trxriocoytfatr n olt srxm(m3iy1amt lncsat)s2tmxrp;u0alt iociyd m elnvsnt)trerir tatfpDr i i;s0teurxopiudlmeelfesas  Durur oo1ale mieiltla2elu s (4 rtoio3oytoa rauesls)t2tmxm3nydalenmfesls srtaum ou1oet  oeiydfs2ua(vs;() etnxfcootlmte nvs t) rtmxm3oy4ale lnesa(f rra(rpot1tlx mociaslmDrlu s;t0 rxomr3iydomDraueolt)srtrxr3ny1ole  ici s sDrru  nu4aetoio3iyslsDrm(vp t4arenxf iotomtelues s)tetoxmpoo4oleemnetls)arumxmo;t4aexo ociyd s2rm(vs;t4alxoifcoy1lp e u i;s0s2xoiopoudomee nciasf rrmu  ou0apeomf3tyslaDeln sn()trxnmo tatoaDrai ils0t2trim3no1lptnlfet sf rraxr ou0tpeo ieiytla2raumo;t0arerif3iatlmtraneo;s  2xm(r nudlp emnet sfa2ra( pot0opeo o3iyt s umnvs;u0texrmocto1fatranvo s0t2trxr3iy1al nlfeil(f Drau pnu0olx mocilsfmDrlu p;u0 eeoir3ty1opDeauvi;t)t2xmxm3nydol   ivtasf 2trxmont1aex  oeiatla2ra(vo u) rtrio3oydla r ueil(0 2xr(m no1omt  net tf 2urxrpnu4aee iocildls rau s (0aeenmrciotom  lu slt)s2tmirpoy4lm  miesltfaDtmurooo0oleo i3taslmDean s;u4altoxf3ootlmt lieo;()srxrxr ny1ame livsls a2rru o;t4ope  ociydlsDum( s u4trxoifcoo1la ean i t)t2xr(m nodapenmfetl(  2ra(mo;u4aexomfctls m ra( p;t4 lenio tadoaD  i o t)s2trir nudoltn ivsas)arrmxmoou1altnio3iadlm emuvs;u)altoirctatlmtelnvils)srtrim3no4apeemnctls)aDtaxmpnt1optnmi3tldfa2ranvo;u0aetrmr oatlm rlnvil()s2uoxo iy4op emfvtas aDua(monu0tpxniocils a ua( p t4arxomr tytfmDraivs ()srur(mpio4lp  mfes s) 2rr(mpnu4teeoifcilslm2eau o;t)arenxr io1lm eluvi;(0 2tm(r nu1lltelivsl()srumu ooo0tex mfciat a emnmo;t)tlxrmf3ty1lpDrlneo;() 2xo(rpou1llte nct () 2tm(r nt1olt  oeiytfm2ra( o t) ltrif ootlmtranvo t s2xm(mpny4ll emietatfsDua(r ;o1aleoifeiadls2uauvsnt4trtnif iadlaDe ivs;(  rumiopiu1am   ietlt srua(rpnu0opx io3tasfaDeln o;u4teenio3iatop r nvs;s0sexm(r no1amte fetas sDum( pnu4teeoifeiyslm eau s;(4tltrxocio1fmte nvo;t0t2tr(r3oodlmenmict ()s2umurooo0olx  fctlsls ul( snt4treomr tatfateaivo t0 ruo(r iydll emncs sfsDrmxrpou1tetomi3iydlm el(ms (0 ltomf oadoatranvs;()s2xmxm3oudolt lfvsat) 2ur(r ;t4aleomfctytfs elumsn() lxnio iatfpte uei;t0 2uoimpnodlmt lnetls)a2rau ooo4aexnmoeild a em( p (0alermrcootfpte nvslt teum(opiu1am e nvslt)srtaxroot1tptn i3iadla ul(monu4 exnmo oo1omtr uvils trtmxr ou4llee nci () 2rau pnu1opxomo3iys s2eluvp;(4 exnxo oadoat  ueolt) 2uoirpiy4lm n fvta() Dtax  no0olto oetls s2rm(mo;u0 exrmo tydlp r nvols)s2xmim io4op nlfetl(fsrtm(mp;t4aleomfciydfmDel( snu4aeenmrcto1optr ueo t seumxo io4optnmfesa( sDur(m ou0tpt  i3iadfmDel( p t0aexnxo tydfm  an s (0 2umio nu4lmenlfeias) 2um(  oo4alto fciaslm em( pnt0tlenmo ootlaDraueols)s2xmiopoo1lpt mies tfsrumuroot0olxomictltfaDuln o u0 ltoxo iadoaDraues;s trtoxrpou1omt mietlsfa2tmxmp;t0opeoiocildlaDeluvp;(4trtrirciodom eanvo;s srtmio3no4ale livt tfsrtaxr ;u4opt mfeiasls ua(vpn(0 rtrmfctadfpD  ues ()teuo(o iy4llenlnvtl(fsDtrx  ou1olenifetydfs rm(vp (0 ltoir ia1oa raieo s0s2tmiopiu4llenlieias)sDrrum nt4aeeoiociadlmDrm( on(4 rxrxf oytla   i s;( t2uoim io4lmtnlnet tfarrmu  ;t4aeeoiicils m eaumsnu0 leomf3oytfmt lues ()teuo(r3iydom nmnviasfaDtau  oo4ope  i3tldlm2uaumsnt4trtrmrcta1oateauvi (0teuoxr3oodal nmfvs s)sDraxrpnt0apxo ociltla rl( pnt0trtrif3oydom  livsls)s2xm(o3oy1olee nvi t aDuaxr ;t0texnmfeiys aDumump t)aetoir oydlatr i ils0srum(r3oodaltemncta() ruaur ;o4tptomfeias s emn pnt4 lerxfcto1lmD aueo t0seurxr iydameemivia(fartrur nt1ape  fciaslsDea(mpnu0trtoio tatlmD lieols  etm(o ny1apt  nes s  2umu ono4aleoioeild m2elu on()aexoif3ia1opD  u i s0sexo(r iodal  mncs s)s2urumpot1tlenmf3tat mDeaumo t4 eeomr totoaDr i s;() rxrimpno1ap nmnvtls  Dta(rpoo4aet mf3tyd sDrlnvs;u4tlxrmr ia1omtelivil(  rxr(o3oodop  lfvi () 2tax oot1texomi3ils m2rauvs;u0 eermfcoadlp raiei () euoim nudll nmivtls srta(r ;t4olxn i3ilt m2rmnmo;u0tlenmrciytfpt lu i;t0tetoxr3nu1lpeemiesl(fa2trum nu0alt  f3iys a ua(mo;t4aexnxocoodfa  lueols teurimpoo4optemfvtas arrm(rpoo1apxnii3iatfs el( on()aleoxo ta1la   u olt) exm(o io1am  mnet ()arrm(mono0tpx mfctadfs em(ms;t)teenxfcoodlmt aneo ( teumxr3oodlm   iei () rrmxmpoo0altn o3iytls2rluvpnt)areomr ootlp rauvi t) rtoxo oo1lptemnviat)artrxrono4apt io3ilsfs2em( sn(4aexomrcoytoatrlnesl()s2tmxo nu4optelics ()srrm( o;u0oexn o3ilsls umnvo;u4 rxoxf3oytomte neol()s2xmxopno4olt lnci ( aDtmx  oo4oeeo oetldlm rmn pn(0 etnmf to1lmt  i o s0 2ur(o3iy1optn fvs (fsDumxmono4aptn fctat a2ra(vp;u4alxrxrctytfpDeai i;s setm(opoy1am  lfetat)sDrr(m oo4tet mfcilsla2uaums;t4aexnmo3totfmDrln o;s  rtrim nodomenmnciat)arua(rpou0texo o3tltla uaumo;t) lermociy1laDeauvsl()setoiopny1ll emnvta(f rtmuroot0aet iietldla2umn pnu0aetrxr3oytfpDeluvi;s)trumir ny4ale livta()aDtax ont0texn fciytlaDrluvpnt4 ltnifctodfat  uvs;s) 2xo(m3iydlmeelfesas)a2ur(rpno0tltnmoctys m umnmp u0tetrir totla  lneo;()s2uo(r nydlpte ncsat srtaur ot1tpx iictld s2em(mo;u) renmr iotfmDelueil(  rtoxmpiy1lpt lfet tfsrumumo;u4tpe mieiyd aDeaumo t)alxoirctotop   nvi;t0tetmim iu1apeemivi t srtr(root0aet micilsla rlnmp (0tltrmf oydlpte ueil( t2uo(o oydal nlfvs sf rumxroou0altn i3tas s rlu snu4arxoiocoa1opteluvolt0texmim3ou1lp  mnvt (  2ra(  ;o1olenmfciad mDeau pnu0 leomr3oy1om rauesls0sexoxr3iy4omtn fetl()s2tmxrono0oexomi3ild s rmnvpn(0 rtomo3oatoa  an sls)srxr(opoudoleelneia(  rrrumoot4opxo fcias s uau pnt0artrmo oa1fa  aivi t) ruo(o3no4lp   nes t s2rrump;o1tlt io3iysfm emums;u4arenifcoy1fa eli o;s srum(opoodale livtas a2rmu o;u0ape  f3iydfm2elnmo t4aexrifctatop rlnvs;()srxrxm3oodlp elfet (  Dumx  ou4tetomoeils mDraums ()treoif iytoptr ieolt t2xoxm3oo4omtemfet t  rua( p;u4tlx  fcildfm2ea(ms;t4 renmf3tytfaDelies;t  2uoim io1amte nvia(fa2rrx o;t4opxoif3ils aDumuvs u0alxoxr3todop  li s;()sexoio ny4lpee fvt ( artmurpnu0tlxoifciysfa2eluvp;()tltnxfcoy1lmtr u ols) rxrirpoodalt  fvs t aDtax  nu4oetn oetasfs eauvpnu0 rtnmo iy1lpt livol(  2uo(mpnudoptemieslt)s2taurono0tlx mi3ildlm2rln ont)tlxrxo3oo1lm  lnes;() exm(m oudllte fctltfsrrr(mpou0tptnmoeild s umnvpn(4trtoxf3iy1lmtrlu s ( trtoxo3nu1om   fei ()sDurx pot4oetoif3iytfa el( snt0 eenmocoatoaD  uei t)s2umxrpnu4lmenmnet (farrrx oot1tpx  ociat sDea( s t)alxniocio1fmDelnvo;s0sruoxm3iodame livta(fsrua( pnt1olx mocild m rm( o (0aleoio oo1oatrli o ( s2tm(r3io4apt miei t aDurxm ;u4aleoiietlt m rlnvs (4 reomfciodomD lies;t teuriopiy4amee ietlt)a2ra(mp;u4apxnmi3tls m uanmo (4trxrmo iatopD anvi;(  etrxr nudaleemncsa( srumurp;u0aee mfciatls2umump ()trxnxocoytfpDe uvs;s) rur(mpoodaptnlfcs s aruaur ;u4texo f3iad sDrl(msnu0 leomr3oa1optr ieo;(0 eurio3iu1oltemnvil()sDtm( ono1texoifeiatfaDrl(vs;t0aexoxocoytlptr ues t sexmxopiydlmt  nesas  2uru ooo0altn ieiadlm emnvs t4tleoxfctotomtr nesls t2xrxopoy1op   ivtatfs2urur nt0aee  f3iatlm2ua( s;u4aetrmfcta1omDrau s;s0seurio3oo4olt mictltfa2tm(rooo4aex  iciyt aDumumo;u)tetrmr oydopD  n slt  2to(o3nodapen fctl() rrrxmont1tptnmi3iadfmDuanms (0alerif to1opDr iei;s0 2trio iudlptnmicsasf 2tax ono1tetoioetydls2rmuvs;u)arenmocoo1lp e u olt)t2tmxrpoodapeelnet () Duru poo0oeeomfciaslm2emump;(0aeeoxfcoo1fate uvi;s  2toxr3nu1ol   iei s) rrau  oo1tltomictaslsDum(mo ()alxnirctodfaDeau sl( texo(r3oy1amtnlnvtltf 2rrumo;u4tptnifctad a rmu pnu) renmr ia1fm   nvols)sexrirpou1ap  mfvt s)srurx ooo4apenioctyt a emu pnu)alenmo3oadfp r u sls0 exrim3oy4amee ivt tfaruaxr ;u0oeeomi3tyt m rauvsn(0 exnxr3iodlpte n o s0seur(o ou1omt lfet s)a2umurp;o0opxnmi3tyd s emuvs (4alxnxo totomt livs;s)t2xriopoudamt licia()s2ur(mooo1ape mfetyt a rln snt4 ltrxo oytlmtr uvs t t2xrxm3no4lm emncs t) 2tm(mp;u4apeomfciydlm ranvs;u4 leoiociy1fatrlies;s0t2umio3iy4omt mivtl(  2rm(m nt0aptnifctytfsDel(vp;()arxnmrciadfmD anvs;t) 2xrxopoydomenmfei t)srur(moou1oeeoioeiyt a uau s;t)artnmrciadfpDe ueilt s2umxm3oo1lpee nvilt srtrx ont4tpeomfeiytlm ra(mo t4altoifcoa1om e i o () 2umxm iodalte fetat)a2uru  ot0oleomi3iyd m ra( snt4tlxomf iatop raneil(0teurxo ny1al n fesls) rumu  ou0tpx  fctld a2elump;(0aeerxf tatopDr u sls)texrir iy1altelncil( s2umxm ou4opxomfeiadlm2uau ont0trerxr3tytfa rai i s  eur(opiy1oleelicsasfarra( ono0tle  i3ildlsDelnms t)aeerif oo1opD  nvo;s0srtr(r3ny4om nmiesls)sDta( pnu4oex ii3tlsfs2rm(vsnu) rtomoctodfatranvo s  2tr(mpoydale  ietlt)arur(mpno1oeen ieiydfa uanms;u0teermf oa1lmtraueilt0teuoxmpoy1lmtemfcs t a2tm(ro;o1tee ifctlslsDelnmsnt) rerio iotlm   i s;s)trto(o oudopen fci tf rraum ;t4ale ifciadlsDelnmo;(4 rtnxo3iydlp  luvilt trumxm3no4lp nlnet tfsDurx  nu0tlenii3iysfs2umu p;u0arxrmr iatfmDean s;t0teuo(mpnu1omte netlsfaDrmu o;u0tpe ioeiatla2elu s;(4tltnxrcoodlmtrlivi s) eto(o3iydlleemnesl() 2umx o;o4tetn ociaslm2um(ms;t0 lerio iatoa rlnvo;t0 eurir3ny4llenlfcs s) 2rr(rpnu4tex mictys s rmnmon(0 rxrxf oadlm  lu o ( trxmimpoo4lpt lfciatfarra(mo;o4optoioeiydlmDem( p t)artoio todoaDr ieols0s2xm(rpnu4altnmici s)srurx  ;u1tltoiiciltls ran o;u0 ltrxr3todlmtean s s  rto(m no4op   nvi t  rtmu  ou1tpto octyt m emu o;u4 lenxociotlm  lieols teumim no1openmnciat  rurur ou0ale mieiasfa umnmonu0alxoxf3totomDr nes;s0 exoxm nudomtn nviltf rrax  ou0aeeoif3tatls rluvpnt4aeeoif oydom elu s s0s2xm(r3nodalt mfvtasf Dtaxr oo0aex mocilslm rmu p t)aeenir3oa1oa  ln o;(0s2tm(m3iy1lm e ivt (f rrau  nt4tlto ociaslsDeanvp;u4tlxomr todopD livi (0 etmir3iydamt mnvia( sDum(mpou0aexnii3ildlm2raump u4tetrxo3iatfpt  nes;t)trtoio3oy1opt lnctas) Dtrx  ;u1aetomi3ilt m ua(msnu0texrmr to1opt lnvolt0t2xrxo3ou4optelncsl(  2ururono1apx ifctadlmDrmnvs;(0tlenxoctodomt lies;(0 rxrxrpio4omt livs t sDumumooo1tleomi3tyt s umn s;t4 lxoir tadla elu ils teurim3oo4opeelfcs s sDuau p;o4tle  fetadfa2eluvo;u4 eenio3oytlp eauvo;s)srtoxr no4om   fcslsfsDurxmo;o1oetomf3ilt aDel(vo u4artrmociytfaDr nei t0t2tm(mpio4opt mivsat)srrr(roou0opt iociaslm umnvs;t)tlxomr totlpD lueslt) rurxopoo4lmtelfvi tfs2uaxrp;o4aeeoii3ils a em( o;(4 leomo oatlate nvols)t2ur(m3oodomtelfet (f rta(mpoo4aptoiieias a2rm(vpnu4 eenmf3tytlp  ln o s)teumxr3oudamt mict sfa2taurpno1alenmo3tltla rl( s;(0 leoxf3tydfmDeanvo;t0trtoxmpoo4al nlfcilt)srtaxr ot0apxnmicilsfs rln o (4aetnmrctotfaDeauvs;s0srumimpiodal nlnvsas  Dtm( oou1apen oeiat m2rluvsn(4 lenmf3todom rlnvsls0 rtm(r3iudamt lnet ()a2rr(root4olx mociadlm elnmo t)areoxo tatlmteanvi;() exmxrpou1aptnmfci s)aDtm( pno4tex ifeiatlsDran on(4tetoio ty1omteli i s srxoirpiy4lm nmnvslt  2umum ou4tlxo i3iytfs elnmp u4aetrmr3oadfate ieo;t srxmxm3oo1altnlfvsat a2ua(r ;t0aet ii3tatla rlnvs u0 ltnir totfmDelu slt srumio ou4lm  liet () Dur(rpou1aet  f3tyd a rmnvp;t)tlxrmf iytom rln s;(0s2xmirpnodape  ict (fsDuaxro;u4tetomiciatlm2emnms;()texrxoctytoatrli i ()srxm(r oo1lpen ivil( s2rmx oou0olxnio3iydlm um(vpn(0 lenmr oa1omt lnvo ()seurxo nudlmt livtl(  rua(mo;o4optomfeiatfa em( s u)aleoiociotfm rlnvo t0trxriopio1omtelfcsa( sDumx p;t0olto i3tatfaDuan o u0treomfctydlpDeau sls seto(o3oo4op  lies () 2rau onu1apx mfctldfm ul( snt0 etrxr iatopteauesl( trtrxr3iu1am  lnes (f rrmurpou4olxo ocild a uln s u0artoif3iodoa e n s;s  etmio3oy1lmeemivta( s2rmxmp;o4tetoiociadfm ean p;u0 lxnmrcia1opDrln i;() rtrxm3ou1amtnmfcslsfs2umxmp;u4tptniictlt mDumnms;(0altrio3tadlpDeau ils s2xm(o iudaptelietl()sDtmx o;o1oexo fciaslmDra(vp u4tltrxocty1la rlivi s) 2ur(r oydolt  ncs tfsDumx  no0aet mfcild s ranvs (0 rtoxf iy1fa elnvi;( setoxopoo1olt livi ()srrm(r ;o1tlt ifciyslm rauvsnt4tetoxfcto1omDrlnei;t)t2tmir3nu1ap elncslt aDurx oot4tlxn oeiys a ua( on() rtrifcoo1om rauvi t t2toirpou1lme mnvt t)sDraumo;o4tpe  o3iasls rluvpn(4aetrmo oodlm e ies s  rum(o3no1om nlfcsas)sDtmxro;t1aexn i3ilsfsDea(vo;t0artnxo3tatlmtelueol(0srtmxr3oo4lm nlfesltfa2uaum nt4ope  fetys a elumont) exoio3iotfp   nvs;t  rxo(mpiudaltelivsltfsDua(mpou0tlx  o3iys sDrm(mp t) lerxo oadopDeli i;()srxmim nudoptnlicsa() 2tr(mont1ope mietys a ua(monu0 renxf3oy1omDr n i () exo(mpio4ap e nvi ( artmu ooo1tee  icilslsDuaumsnu0 rermr iadfpteln ol(  rtoim3iydlm   ivias)a2ur(ront1aexnmoeildfm emumsn(0teenxrctodlpDelies;t)s2to(rpiy4ape  netl() Draxm ;u4alen oeiysfaDrlnmsnu0artnmo3oatlmtr n o t0 rxmimpnu1lmtnlict t  rtmxmpoo4tet ii3tat m2rl(vs;u)trxnxrcoytoa   iei (0 2to(m iy1ape lictat aDur(r oo0opx  feiaslm2umnmp;(0texnxocoodoa e i ils0 rtr(r oy1amte ivtls)a2tmurp;t1apxoifcilsfm uau ont4tltnxo3tytfmDe i sls) rxoxo3oodal emietas aDrrump;t1optnifciad aDeluvsnu)altnxrctadom rlieil(  exrxopiy4lmenmncsatfa2rru ono4tlx mieils a2ra(monu0 ltnircoydomte uvolt s2ur(r3oo4oleelnvsls arrmumo;t1apxnmf3iasls2uaump;(4treomoctodomDeau olt  2xm(m3iu1llee nes t)artaxmpno0tptoifcild s2eanmo;u)trenxf3oo1fmteluvo;() rxo(m iu1omtn nct s s2trxrpoo1alxo ocils s2umnmp;t0 etnmr ta1fmDeaivo;(  rur(opiy1openlnvsl()srumxrpot4alx ioctysla2eluvon(4alxrmfciytlm eauvo;(0srtriopou4omtnmfvt ()sDtmx p;u0oleniocilslmDeauvo t)tlenmf ootfat aiei;t)seto(r3oo1lp nmivtl() 2uaxr oo4oexniictld a emumpnt4teenxfcto1lmtrai s;t0t2toxm3io1ol  lnctat aDtm(  ;o4tpx io3iyd sDem( p u0arenxr oytoa  au ils setrio3io4llt livtlt artm(m nu0opx mociatla rl(mo (0teeomo iy1lpDrauei s) etm(m ny1alenlnct (  2umu p;u4aexomictydlm2uluvsnu0 ltnxfctytom rli s t0s2urxrpiudlp   nvilsfsDumu pnt4teeoiietyd a ea(vs (0texnmf iy1fa eauvo;(0srxriopou4olt  fcias)s2ua( pnu1tlenifciadfm rmuvo t0areoir3todlaDelnvs;s0 rtr(rpnudop  lnvsa( a2rr(ro;t4oeenmociyd mDeanmo;t0trxnif oydfat anvi;s t2xr(m oodom nlfetas)arumu o;o1oet if3ilt a em(vo u4trtnmf3tytlmDr ivs s  rto(m3oo4ape  fvi (fa2ururp;u1apx ioeiysfaDumuvo;t) lenxr3iy1laDe ieslt0tetrxr3iu4apeelnvsa(fsDumu onu0oeto feiatlmDem(ms t0aeenmo3io1fptelueslt  exoimpiydoptemfeilt) 2tmxmont0ole mocils mDuluvpn()aeenio oo1lpteaivo;()s2xrxm3iy1omtn nctat aDumurpot1aet mfciltla elnmp (4altrir3oytfmDeluvo () rxmio3iu1oltn fvt t sDtaxmpnt4ole if3tlsla2umnvsnu4tetrircoy1la  lu slt) euo(m oo1lpeelnes s)srtax ooo4tpxnmieiyt s uan o;(4 lenircoodlaDe iei s0trtmxrpny4omtnmfvi t) rur(roou1apeoifeiltfs2elu o;u4texoif oydlmte nei;s sruoir io4apenliet sf Dtax  no4tpxoioetysfa em(mp (0aleoxrcoytopt  u s;t) 2toirpio4lpt lfvsl(f 2tr(rp;u1aex if3iytla rl(vo;u4 eenmf3todomt anvo s  2tm(r3iydolenlncias)arra( oou1alt  oeiyd m rl(vsnu)trxnmo iydlptrauvolt tetrxmpoy1llte netlsfs2rmumpou1oeeomietydfm uaumo;t4 eermo tydomDr iesl(0 etrim no4ope lneilt) 2uaumpnu4aex  oeilt a uluvo (4teeriociy1lm elivs t0 rumio oodlpe lfct () rumxmont0tpt moeilsls rmnmp (0 rtnxfctytlp e ieo s trtmim ou1lle mfei tfaDtm(rpot1tet  iciadfs eauvonu0tlenmr3totoptr nvi s) exr(m nu4oltemfvsl(fs2rr(ro;t1oltomfciadfaDuluvp;t4trtnio oytopDe u sls) ruoio nu1alen fvi sf rtm( o;t4alt moeiatlm2umn p u0tetrmo iytfaDr nes;t) 2toiopny1lleemnei ()srur( poo4oee  ieiad m umnmsnu0trtnmfctydfmDe ueo;(0 rtm(o iudamen nctl( artax  nt0opxnmoetys mDrl(vp;t4tlxomr3todfatrauvo;( srxrxr3iu1al elncsls)aDra(m nu1texnifctatla el(vont4 eeoxrctotfaDraivi t)srtmxopio4am nlnct tfs2ta( oou4tptniictyt s2em(vp;()trtomr oa1op ranvs s teum(mpnydomt mfvsat  rrau pou1olt  octyslaDuan snt0 leoif iy1lmD ln ol( s2trxm3oodol elnetl()srta(rpot4ope mf3ildfa uanmo u0 rtoxocia1latr uvsls  rtmxr3no1ol elneils)a2tax  no1texnmictyt sDeau pnu4 eenif oa1om   u i t srumir ou4lm e ncsltfs2tmxr ot1oetnmo3tlsls2ea(mp ()tlxnxoctotlmDe uei s t2toirpiu1olenmieiat a2ua(mont4oetnmfciad m2ra(vp t4 rxnmr3iydomD  ieol( srurir iy4lpen fctatf Dtr(mpot1opx  oeiydls rm( p;t) rxnmr todlm rln i;(  2tmxopio4lpeemncils  2tr(ro;u1tpto ieiytfm eln pnt)aexomfcoadfatr ieslt)srxrim nodlle  fvsl( aDtmxmpno4aeto iciatls2el(mp;t)texnxo3ty1lm rln i;t)s2xr(rpoy4om n ietl(f Draxrpot4tlenmfctyt aDeaums;t4aetrio todlmteauvi;s  etrir iudop   ivs sfs2umxmo;o0ape miciad a2ul( o;t0trtrir3totlate nvi;(0s2uoxo iy4lmtemnet s  rta(moou4aeenmfeildla2ulnmon()aexomr tatfaDraues t0 2xr(mpno4apeelfctl( s2tmump;t4teto f3ildlaDumuvpn(4texoir oa1fmDeliei t)sexr(o3iudolenlfcsatfsruaurpou1oexoio3ild s2ua(vs;(0 ltrifcoadfp  livi s0truo(r oo4om nlfcils aDua(monu0alt moeiydfm2uaumont0texnxr3oo1fpt auvs t) rxmim3oy4alt  fetls) 2rruronu4aexnioeiltfa2rmn s;(4arxnxo todfate uvsls) 2umir no4lmtnlfetlsfsDrr(  ;o1apen fcils mDem( s t) ltrmo3ia1optr ivo s0trxrxo3ou1olenlfeiatf rrrumpoo0alxnifeias sDemnmp (0 lxrmfcoytlptrli o;s trxoim3ny1lp n fctas aDta(mpnu4tpxniociytfsDuan s;u4aetnircoatla  ln o;t s2xoxm3oydolenlnvsls)sDtmu p;t0oeeniociad s2eanmpn(0 exomr3tytopDrlu i t)t2to(rpiodape  ivil( srrax  ou0tlxomociyd s uluvon(4 exoxr iodfatelies;s0s2toxmpno1lp  micil(  2rrxr nt4tleo fctad a2em(msn(0aexnif3iydlpteauvsl(0 rtmimpno4amtn iet s)a2uaur ot0aee if3tlt m ua(ms (4 ltoio tytlpD lieolt  rtrxr3iu4lle  nesa(fsDurx  nt4aptnmocildlm2ra(vs;t0 rtnmr3oydlm r iei t  euoxm iy1ope  nctls sDtauroou1opx ifctasfm2ulnvpn() lerxo3oa1lm  livilt  euo(o3oydaptelicslsf 2ra(mp;o4aeeo o3ils m2eanmont0tetoxr iodoaD  neo t srxrxm3nydolee nes sfa2rauroou1ope  o3iat a elnvs;t) exoir3totfm raiesl(0sexoxo oy1alt mfes t) 2rrum ;t0tltoiieiysfs2rlnmo (4 ltrif3iatla   nei s  rum(o iudam emfeils)srtm(r ou4opeo ociydls2ea( o;t4tltoxr todfpte ieo;s teurxr3oy1omtn nesl()artax  nu0alt if3iltfa2ea(ms u4alxoxo3tytlm r n ol( texoxr3io4op  lies (fsrrauroou4alx mfetasfmDraump;(4tltnioctatoa elnvs;(0t2tmxrpiy1lp nmnvtas  Dumu pnt0openioetytfs em( ont0aexrmf3totfa rlu i;s)trxrxm iu4omt micia(  Dta(  oo0tpx micilslaDemn p;()teeomo3iodopDr ies t)s2tmxr oo4al emneil(f 2tmxrooo4tpxn f3iydls2ulums;u0trtnmfcoy1fp r i s s)t2toxo3ou1ap elivtas  2rmx oot4opt mi3iad a ra( p t4 ltrxf3to1opDrlieolt0 euoim iudll  mnvsat  Drr(m ou4oex  octat sDel(msnt4arerxo iy1fa r i sls)srumxm ou4lltnliet t)a2urxro;o0oexnmfciat a2ranvpn(4 reomo oytfa   n i;s0 2ur(opno1apt livslt)aDua( o;u0alt io3tadlmDel(vp;t4 renmo totoa eln ols) rtmir iu1lp  livil(fs2urxmp;t4oeeniieiydla emnvpn(0aeerxr3oytla e u sls0teuoxrpio4ale mnetls  rtmxrono4tleoioeiltfs2rln o () lxrif3oadom e n i;(0t2trxm ny1ol  mfcs t  2uaump;u0opxnifetydfaDrau o;t)altoxfctadlaD  i i;t0 2urir ou4alenlnvils arrm(r ;u1opxo feildfsDua( s;(4arxrmo iydlm elnvs t0 exoimpoydap   nvi (  Dtr( pnu1apeoiictys a eauvonu0 eerir3tatlaD  n s;() 2ur(o3oo1amenmfei t  rua(rp;o0apx ifeias s rl(mo;t0trenxrciatoaD ai i;t)trurimpoy1ll n feils) Drmx pou1tpxo octytls um(mpn(4aexrir oytom  li ols)seuo(mpiydal nlfviasfaDur(mo;o0oetoifetysfa2rm(von() lxnio oa1fm ran o;s0texrxmpoudoleemics t sDuaurp;t4opxo o3iyt a2em(vs;u)teenio3to1faDe nes;t)truo(rpou4ameelfviasf Drr(m ;u4ape  f3ild a em(vs;t4alxnxoctotla rlivi;() rto(opiodameelnetl(f Dur(mpnu0oleo f3iyslsDea(vp;(4 rtrmf iadomD  iei;s0trtmirpoo4op elici s arum(r ot0tpxnmfeiyt aDuluvo ()tleoifciatlp  li sl(0srto(o nydlmenmivsl(  2rru  nt0apt iiciyd aDulnvp;t0alxriocoatfm r n s t t2xmxm ny4olenlivils s2ra(mo;u0oltnifctydlm rl( p u4trtnmr3oodfaDelnvol(0t2xo(opio4op nlnesa() 2tmu ono1tle  fctyd m emu sn(4tlermr3ta1om r n sl( s2ur(r3ny1ol  lfcsl( a2trxmpnt0teeomoctaslsDea(mpnt)trtnio oo1lp eaiei;(0 2tmxm iodamtnmfvi ( sDtr(rpnt1alxn feils a rm(monu4trxoxf iotfa elneol(0 ruoxr nudameelfei sf rumurpno1tee  fciadfsDeanmo ()trxrio oo1om  au o;t) 2trir3ou4ol elfvt tfaDrru p;o1aptn ocilsfm eau s t0tltoxfctatla rlnvi t tetrim oy4op  liei (  ruaurpnt1tetnioeias s2elumont4trxnif oodla eln i;t0 rxmio3ny1ap   iet ( a2rmxmpnu0tlen fctltla2umu p;(4tltnxf3totopDe i i;s trxrio io1optnmfcslt a2truro;o4olxomiciatlm2uanvo;u0aeenir3tatlpDrlnesls)trxrio3oodllenlics sfaDraumo;t1ape ifctas s emuvp u4trxrio3tydoa e nvi s t2to(o iydlm   nvs s a2uax  ;u4tlxo ocildls2rau s;u4tlenmrciadlat aies ()trxmxr3no4am n neslt)s2rauro;t0opeoiietlslmDemu s (0 lxnxociodoatelivolt0seuoxr oudlptnliet ( sDrm(rpot0apxomocils aDuluvon(0 eerio oa1faDr u o (  2umxopiydlpenmfei (fa2raxmpot4texomfciadfs ua( s;t0 lenif3ootlmteauvs;t) rxriopoudlmeemnes s) 2uaum ;o1aetnifctltfm2uaums;t0artnxrcootlat  ieo s)texrxo ou4opeemieiat) 2taxrpnt0tlen fctat a ran s;u)trxomo3oadfpD  u i ( trtmxr3oodameelncslt  rrr(r ou0tpxnmoeiytls eau pn(0tlxoxf oytfm eauei;(0 rtrim nydoleemnct t a2uax ono0tpe ii3tas s2uluvsnu) lermf iadlpDrln sl()srto(o3nudal e fvs sfarrax pnt1tpeomictyslsDumn onu) renirctotlpte u s () etm(r oo4optnmfcs s  rtaxmpou1alxn feias s2ua(mp;u)tetnmo ia1fm eai o t) rtmxm3ny4openlfcsasfsrta( pnu4optnmf3iytfm2eluvpnt0alxoxfciytlmD lies t0trtoxr3ny4omt livsa( srrr(rpno1oetnif3tytls2el(vsn(0trxnxf3ia1oaD ai s s0trxr(o3iu1op emicil(  Drr(ronu1alxnio3tld aDumu s u0aetoio3ta1la rluvs s0t2trxr3iy1ameelivt t) 2ra(ro;t1tpx iietyslmDrl(mpn(4arxrmfciodla e neolt s2trxr3no4llte fci ()aDtmxro;u4oeto fciatfa2ulnmo;(4aexnifctodop e neilt) rxrxm nu4apt mnvs () 2tau  ;t0aetnmfeiadla eluvp;() rtoioctadfm rlnvi;()setmxr oodlle mfet ()srrru  ;t4alxo ieias a rmnvo;u0 lxoir ta1fp r ivo;s  2umio oudapeemivtas) 2ta(mooo0oltnii3taslsDrmumsn(4altrmf3iatla  aiei s t2umxm3iodlme lfcsat) rtrxmo;t4olt  fciydlaDum(vs;u) rxomo3ta1la raueils)s2tmirpiy1apeemivtas) rum(ronu0ape ifctytfmDum(mo u0 etnif oy1lptrai o t)trtoiopny4aptelnvsasfa2tr(ro;u0aee  o3iyd m eauvp;u4altoioctydoatrlnes;t  exriopio4om n fviltfa2tax  ot0alt ifeiat s2eauvp u4trxomo oo1fptrluvo (0srxm(rpio1al nlfvil(  rtau pnt1alxn octlsfmDelnmsnu0artnif oodoaD au s;t0 2to(r iy4lp   neias  2ur(m ;o0alxnmiciadfm uauvs;(4 lxniocoy1la eluvils  rtmxm ou4alt mnei (fa2ur(r nt1tpen f3iatfs2rl(vs t4teerio oytopD ln o t) rtoxm3ou1lpe lneiat) 2ra(  nu4oexnmfciyd sDuluvsn(4 leoxrciatfmD  i o t)srtoxr3no1lp nmfct tfsDrmuroot0oexo fcilt a ra( ont4teenmf3oydfpteln sls0texo(r nudlmenlfes t)a2rr( o;o4olt mfetatfsDea(vs (4 lxnmf ty1fm e uvolt0 2xm(rpou4alenmnvilt  Duaxrp;o1apx iictltlm2em(mont)treoxociydoat anvi;t) 2trirpoy1omtnmnesasfsDumu ooo4apto o3tltla2eanmp;(4aexnio oy1lmt  u i;t0s2uoxo io4lltnmfvtls  Drmumono1tpxo oeiadfs2ul( snu)alermf todopDrlnvs s0t2urxopiydlm nlfvs ( s2ra(rooo1oexo feild a umuvpn(0 rermoctytfat ln i s0 2urxmpnodaltelnesl(  rtrx  nt4oeeomoctasfmDrlumo;t) leoif tydomD  ivo;( t2tmxm3ny4apenmncslt  Dum(rooo0aetn oeiasfm2rlnms;t)artnirciydlpt lu s s)s2to(r iu1om emivsas sDur( onu0tpt mf3tat m emuvo;u)trtrmrciytop ean i t s2trxopoo4ll elfcils a2uaxmpot0tlenmoeiydlmDrmnvon()aexoxf iy1omDe i slt)s2xmiopiodope lfes s) rua( oot4optn oetldfm rlnmo u)altnir3ia1fmDelueo (0trtrxopno1lp elfvi t arraxr no1teeniiciltfs emnmo;t4 renxr tytoptrlivol(0t2trxopiydomtelnct tfa2um(r nu1oee  octad aDean s u4tleoxo oytop  an i t0 exmxrpou1lp elfcsat  Dra(monu0teto ieils m2raums (0trxrmrciytfa  lnes;s) eurxmpnydam elfesatf Dumxronu0oexn o3iltfsDumuvs t)trxniociodfmt an s t0sexmio nydamtelics (  rua(mpno1tle  o3iyd m2rl(vo u)artomf3oydfpt lnes;( srxm(mpiydll nlnci t a2ta(mo;t0opxnmo3ilslmDelnms (0trxnio3iotoateanesl(  2xm(o iu4ol emfvi sfs2ur( ont0alxnmoeiatlm2elums t) reomocoatfmte nvsls s2uoimpoy1llenmneiat)srrmxmono1tle ifciatfs2eauvp (4alxrio3oo1oa elivi;t  2xr(rpiy4ome lnvi ( s2ua(r nt1tltnmfciat sDrluvs;(0alxnifcoo1latr ivs;()truoxrpiydapt  fcsa(fsrtrxrp;t1tpenio3iatfa rl(msnu4 leomf iotlmt luvsl(0t2uo(o io1amenmfvt t)a2ta( onu0alxnmoctldfm2rmuvp;t)trxnir oytlp e nesls)s2uo(opnydllen ncs sfa2uaxroot1oexn i3ildla rmuvs;t4trerioctadlmDr ivs;s0sruo(mpnu4amt mics sfs2rru ono0tpx mfeiytla rl( onu0trxnmr3tytlmt aueols s2um(m oo1omt  nvi t) 2rm( ont1oetniietldlm2um( s t)arerio oa1fm elivils) rxmxo3nu1lp nmneilsf Drr(monu4oleo i3tlt s uluvs;u)alxrxfcoodop   u o s  2tm(opiy4op nlnvs t)srrrxrpnu4oeeoiieiysla2ean p t0tltoxr3oydfmD lieilt)t2umirpiudlpee nvsas  Draur no4aexnioctadlm elnmonu4tleniocto1fpDr ues t  2xo(m iy1lpt  fesat s2tmu  oo0tlx  oeiadls2el(mpn(4tlxrxrcty1lmt livils t2xriopiydlmeemieil(f rrax  ou0tpe moetat sDul( p;t0aeeomfctytlp elu o ()trtoiopnudolen fvt s a2ur(r ;u0alen i3iatfsDum(mo;t4tetnmfciodoaDeauvs t  exoiopno1opte neils  2ur(mp;u4tptniietasfm ul(mo;(0trenxf oy1lat li ol(  2xoxmpio4al elnvslt) ruaxrpoo4apxnmf3ild m2rlumon(4aexnmfcoatfptelu ilt)trxoir oy4amtnmnvsls a2rrum ;t1oexnmfetls s2el(mp t0 rerxf3oatfa rluesls truo(rpiy1lm nmfes t s2rmuro;o0apt  oeildfs2ul(vp;t4trerircoodla  li s s0t2xrimpio4om nlnesl()s2tau  nt1tlxniocildfsDranvo;u0 lxnxocoatopt ai olt) etoxrpnudomeemfet sfsrrax  ou4optnmo3iasls uaums;u)alxrio3tydlmDeauvs t)t2tm(r no1aleemneil(f 2rmxm ot0aee mfctydla2rl(vp;(4areoxr tadfpt ln ils0 etr(rpnu1ll emivils) Drrxrono1tpe if3tldfmDuanmsnu0aetoxf to1fatrlieo;t trtrxrpnodom e fcsa() rrm( ont0alxn i3ilsls2umnvo (4 ltoxo iatla  ai ol( t2trxopoydopt  fesls  rrm(r nu1apx  o3tadfmDrln o;t4 rtrxf3tytfa eaivs s texmimpiydamt  fei t)sDrmxr oo1olenif3iatfs2ra(msnu4 ltnxr3oatom r ivilt) 2uoiopio4apteliesls)srrmxrpnu4tpxoioeiyd s emnvp;u4arenxo oy1omte uei (0s2tr(rpoo4omeelnei (  2tmxm ;t1apen ociltfa rmnvon(4 lxoirciydfm ranei t seuo(o3nu1opee fci s)sDrr(r nt0tpe mfeiat m2ua(vs t)alxnxrcootfa   nvol(0s2uoir nu1lpen icsls sDrmxr ou4aeenifeias mDranvo u0trxrirciatop  aiei ( trtoiopou4ll elivias)aDumu  ;t0olxnifeiltls2rlums u0 exrir3oatopDrlueo s0 2xmimpou1opeelnet t aDua( pno4tex ifctld aDraumsnt) rtnmo3oa1lpDeli slt)trumxm oydaptnlict (fa2trurp;u0olx iieiltfa rmu sn(0aeerxrciodlm eauvolt)sexr(o ny1lm elfetls aDuaumpou4apxniocilsfaDulump () eermo oa1la rauvi (0trtmirpoydom  mfvt s) Dua( ooo4tpen iciadfa2uauvont)tlxrxf iodoa  aies;t)s2to(opoo1al emfeias)aDtm(rooo4aeen f3ilsfs2ra(ms (0 eenxociotopte ivil()s2ur(opio1alenmivsl(f rrmxm ;t0tltnmi3tlt m2umuvsnt0treomocoa1fpD  uvs t) rxoir3oudame  ietas)s2ua(m no0tlto oetaslm2rlnmo;u)arenmfciadlm elnei ( srumxm3iudopte ivilt aDrr( o;t0tlxomf3tydfaDrmnmsnt0trtnio ty1fateln s;( setmir3oydaptnlivsl() Dum(mpno0oetniocild m rlnvsnu)aexrxo3tydom e nvo;s0 2xm(opoy4am nmncsa( aDrau poo4tpt  ociatlm rmnvpnt0tltrxociydlpDe u s ()s2trxo3oo1lmen fei (fsDumu oot1oexnii3ils s2rmnvs;()aeerif3ootfm e ivs s t2xmxopio4ll e icsa()srtaxmp;u0aex mo3iasls emuvsnu0areoxf3tytfpteai s s)trum(opno1aptn fct s sDtr( pnt4oexn oetys a2emn o;u)tltrio3iotla   ueil( t2urxr iu1openlieiat) Dtr( oot0oltn o3iadfm rl(monu) exoifctodlaD an o;s0srxo(o no1al n fvsltf 2umxr ;o1tltnmi3iydfs2rl(msnu4trxoir oodom rluvi;s s2urxopoodlpe  nvtlt)arurx p;o0oeen o3iydfa rl(mpnu4tlxoiocoy1fpDeaiei;s) rxoxr oodlmte fcia( a2raum no4aeen fctysfsDuan pn(0 rxrif3ootlp   ieo t sexmxrpoy4altnlfciltfs2rmx oou0aleoifctadfa2rmnms;t4 eeomo oydla  lues s)s2um(o iy1omtnmnetlt a2rrurp;u0altniictyd a rlu s t)trenxo3iydfpD ln o;()setrirpnudalte nciat)aDumurpnu0aexnmoctadls2ranmo;()tetoio ootlp e ivi ()trumxm oodlmtn nvil(f rra(r no4alenio3iasla rluvs u4tlxrircio1fa r u sls) 2ur(m3no1aleemnvtltf Dur(r ;t1oexn i3iyd sDrl(vo;() rtoir3tytfpte ueolt s2xoio3nudopte fetatf rtm(mp;t4tetomoeiadlm2umumo t0 leomo3io1omDelu sl(0t2umxm3iu1lltemnetls  Dtmum ;u4tee if3iyt a ea(msnt0artrifciotomt lnei;t  2umxo io1lpeelicils aDra( pno1alx iociys mDrln s ()trtnmrcoadom r nvs s)trum(rpiodomtn icils)srrmum no4aet mfciysfmDean p t0aexnmo iatfm r uei;s  rxmir3io1apeelfcta() 2rm( ooo0opxnmo3tlsfs2ul(vo u) eenxr oatfa r n s t0tetm(rpiydomenlfcta() 2uau  nu1tpxnmfciyslm2rmnmonu)tltoif oo1faDe n sl(0texmxopoo1amen fesat s2um(rp;t0tltnmi3tyd sDum( on(4aetoifciydoaDeanvo;s0s2trim ny4olte fvt sfs2ra( o;o0opeoioctytla2rluvont4 reomo ia1oat auvo t)truoimpnu1optnlict () 2ua( ooo1ale ifctatlaDuaump;
\ No newline at end of file
@@ -0,0 +1 @@
+neslt setmir3ny4op   ncias)s2rm(ront4oltomo3tls s2uau p;u0aetrio oatoaDeaivi s0srxmir iu4amt mivia( a2uauront4opeo octydlsDulumsn(0 rtnmo ootlpt ai i (0 eumxo3iydlleemiesat) rtr(mpoo0oeto ociasfm eanmp;(4artrio3oo1om   nes;s0teuoim io4amen fvtlsfsrurxm ;o0aptoio3iaslsDelnms t)trxnxrciatla eanvo;s srxmio3iy1lptnmicil(  2uaurpnt1opeomi3ilt s2rlnvon(0arxnmfcty1lmtrau o (0teur(opiu4opeemnvil()srrmxmoou4aexn ieildfm2uan pnu)tlxrir ty1la   ues (  2uo(rpnudapen nesas)arta(mont1opeomocild s2el(mon(0tetrircoodoa  lueols)srxmxm no1ome lfvias  2urx pnt4teen o3tyslmDemnvp t0aeermo totfa rai i;t tetmxopoy4ol   neia( aDrm(ro;o4oexnmietydfsDelnvpnu4texnmociytlmD auei;(  etr(mpny4lpe micsatfa2tr(rono1tptomoetydlsDra(vp;u0altoxfctotomDean i t0 rxm(m iydamtnmiet sfartau  nt1alt ifciyt a2rl(vo;(4tltrmf oydfmte n ils0t2xm(opio1ome mnesas aDrr(m oo4tleomieild m rm( o;t)aleoio3ootlate ivs;( s2xm(o iodlmen fetlt)s2umx  no0olen fciaslaDumnms;()tetnxocto1lpDrlu i;(0s2uoio no1lpeelnetl( a2rr(ro;o1alen ictytlm2uluvs;()trtnxr3tadfp e u s;s0trxr(o oo4lltnmfeilsfsrtm(r oo1ope  oeiydfa2rmu sn() exrmo iy1omDe n i;(0seurxm3oodam   iet ()s2rmurpno1oltn ieild mDeauvs;u)aexoio iatla raneo t0srxrirpou4ameelivi s)arrr( p;u0openmfciaslsDrl(vs;u4altrxfcta1lp r ivs s)srxr(rpio4ll elieiltf 2ra(r ot1olenmfciat mDrl( ont0 rtnmfctotlatrli o;( trur(opiy1ll n fcta(fartrurpnu4opxnmfctysfa2uaumpnt0aexnifcootoa   i il()setrxo oudamtn nvt s srtru  no0oex iietadlm uauvo u) ltnxf3totfaD au sls seumimpny4oleelfes (  Drmumpot0alx mfctydlm2uanvo;()teeomf to1lpteli o;( srxr(r3oy1omt  nctl( sDurx p;o4oexn f3ilsfmDemnvp;u) rtrmfciy1fmt  nvo s) rxoxopiodlmeemieiat)s2taxr ot0tee io3iat s raums;()teerir totlmDeauvo t) eum(rpnu4ole mncs t aDrau  oo0olxomoetytls2ranmsnu0tltoxoctatlaDr n i (0srurxmpou4ale lncs (fs2raumonu0texniietadfm2elnmonu)tlxnif oo1faDe uvs;(0t2ur(o3oydomenmnet sfa2umu p;t4tlxnioetadfs rmu s;(0aeerif3iytfaDranvolt) rumim3io4olee ncsls)aDtrxrono1oltniiciys m2rl(vp;(4 lenmf3todlaDrlivs t)setmxr3oy1lm emieiasfsDra(ronu1opx iociatls2ulu pn() lxnmfcoydlmtrlnvils0 rtm(opny1am nliet t  Dtau onu0tlto feiys m emnms;(4tltnmr tadlpDranvslt)seurirpnudllee icsls)s2tm( pnt0alt mfctat sDrlumpnt0trtrmo3ty1lm rlivo;()t2xoio3oudlp n nci s) rua(mo;t1apen f3tldls um(mp;u)aetrircootoateaueolt0s2trxr3ou1apt mnvils)aruaxro;t0apxnmfeildfm2emums;u0 rxnio3to1laDeli i s truo(m3ou1apt  fesls)aDrax  no4tptniieiydfs2el( o;u)arxrmrcootlm  auvo ( s2tmim3iy4lptnlncs t a2tm(ro;u1aee  f3iadlm2um( s;t4artnmfcoatlpDraueo;t) 2xr(rpnydlm e nct t a2umxr no1apx  i3tlt s rl( snu4 lxnmf ootfmD au olt trtoir nu1aptnlivsa(f Dua(rono4tlenioeiltla eluvo t) leoif iodom rluvsls)trtoim iydop n ics ()srtaxmoot1alx micilsls elu s;t0tlermr3tytoat lnvi ()t2tmxm iu1am emfvtas  2rmuroot0ope  ietysfm2emnmp (0alxrmr3totoptranvo;s truo(m3oydoleemncia(  rtmumpnt0aeen fctld a2uaumonu)texnmr3ia1op raivi;t0trurxm3nydlpt  nvtasfartau ont0opxo fcils s2um(mpnt0trxoxr oo1om r u olt0tetrxmpny1ole  nvs (  Dtmu  nt1apt io3tyt m uln onu0tltrif tytfaDelieo ()trtrirpiudopenmivt t s2rrxmo;t0opeo fetlsfsDea( p;t0aetnxfciodfa rluvo (  ruo(o3iy4amtnmfvslt) 2trumpnt1oeeomi3tasls2umnvs t0 rxrmo3to1fmtelivs;(0 eumxmpiodlm nlicias sDrr( ooo4teeomoeiytfa ulnmp;t0altnxr oy1fptrau il(  euo(m3oo4alte fciltf Dumu  ;t1tlxoioeiadlsDumu p;u) rtoif io1laD  uvil()s2xmxr3oo4ll   nes tf rtm(m nu4aet  fetas s ra(mp;t4 rerir tatlp rai ils)seuoir3nu4lp  mfvs s aDraxroot4oexoif3iys s2emuvs;t)treoir ootlmt ai il( t2trxo iy4lmee ivi (fa2urxm nt1olxnifcildls2ua(vo (4areoxf oa1fmtrlnvo () 2ur(opoo4al  lieil( sDtaxmooo1tetomoeiadfs el(vp u) ltrmfcoy1lp e ivo;t seuo(opno4ole liesa( sDum(ronu4oeto icildfmDraumo u4aexriocoodfp   n i;s0trxrxm io1lm elics t) Drmxro;t1tetn oeiadlmDelnvp;()tlenxr3iy1oate uesl()srtrio oo4altemici tf rtax o;o0oetnii3tasla eaumonu0aetoif3oydopt lu sl(0srxoxm3no4apenlncilsfarua( pno1teen ietytla ean p;(0 exomr tadomD aneo t0truo(rpnu1apte fctl()aDtaur ;t4aeeoiociyslaDem(ms;(0arxnmf3oatlatrlues;(0srxrxr oy1apenlieiltfsDtaurooo1aeeomi3iyt a eln o t0 lermocoadopDe n o;t  exrxr nydomeelnet ( sDrrx  ;u1tpxn o3tatlm rm(mo;() rtnxo tatlaDrauvi;s srumxr oo1altelnetat  Durxr no0tlt mfetyd a2eau snu4aetnxo3iytopDe n o ( sexrir iudope mnctls) Dtmxrp;u0olen feiyd s2el(mo;t0trenxrctadfmD aieolt t2uoiopnudap n ivsltfa2rmur no1tltoii3tydfs rmu o t0tltoiocoydfmDe neslt s2trimpiu1lmee iesas srta(  oo0oleomfetyt s umuvp u4 exniocootopDrli o t0 2to(r nu1oltnmncil(fa2umuronu0altnmieiyd sDua(vpnt)aexrio3iatfpt lueolt) 2urxm3io1lmt lncsasf 2raur ;u1apeomo3iydlaDrau pnu)aexrxfctydopDelnvi t0srtrxmpno4alenlfct s arum(r ot4alt mfetys aDrl( sn()aetnxo3iadfmtr i o t0s2xo(opiy1omenlicsat)s2ra(r ;t1opxnmo3iytfm2ua(msnu) lenir3io1oatrlivs;s0s2xrirpiudlmee ncs () Drr(  ot4aleomf3tysfs rmumsn()aeermo3iodoptr uvi s s2uoim nu4ap nlici tfsrrru pnu0aeeniiciasfm rlnvsnt0 exomo iadfa e nvils0s2tmxr3ou1omteliviltfsrurxrp;t4aeeomociydfmDuau o;() rxnxf3ta1om  an s () exm(r nodlmteliet (  rrrxmono1ole moctytlmDulumpnu0texrif3tatlaDelies s srxmxr ou4oltnlnvt s  2ua(  no4aet  fciad sDeanmo u4trtnif iydoptr ueils trtmimpoo4ll nmnci (  2trxmoou4tee ifeilslsDuan p;(4alerio3ootfa rlivs;t) rxo(rpoo4amen ivslsfarua(moot4tltnmietasfa2rln o u)artniociydfmDean s s0 eurxr no4ol nmnesatfs2rrumooo1olx  f3iadlm2ua(vp u4 lenir3iadopD  iei;t)t2xoxm nydopenlnci sfaDumxrp;t0olt  fctltfa em( s (0trxnxo3oadfp r ieo;t0texoim iy1ol n ietltf Draurp;t4apenif3iatls uaums;(0trenirctytlaDrlnei t srur(mpiodam  liviasfaDtau  ;u1tlxnmi3iat s ranmsn() lxrxo iytfp eauvs;(0texr(r3iy4ap n ieta(faDrm(rpot4aetomo3tlt aDelnvo;u4 reoxocoadlpDeluvo;( srumir3ou1om n ies ( sDua(r oo4ape if3ildfaDrl(mo t)tltrxf iadfatr u ilt  rum(mpoudal   nes ( arrmxr ;u4aleo fetyslaDrmums u) ltoir3ootfp raneol()srtmimpny1am n ncslsfs2tax ont0alt iiciasls emnmo;t4altnmo3tytom rln s t0s2to(rpnydap  liesa() rtrur ;u1olenio3tasfs uauvo;u0texnifcoo1lmDeln il( t2um(m iudap  lfct s arrr(  nu4oetoiieiyd s2eaums;(0aexrxoctadopDeaivsls  2xo(r3nodolenliciat  rum(  ;u0aleomfetlsfsDeauvp () reoxfcto1fmD  i o s) euoir io4ome mfcil(fs2rmuroou1alt mo3iad a ul(vo t4 rtomf oodlpDe i i t0tetoim3iy4ame mfes s) 2ta(r nu1tptn i3iad m2ul(mp;u) rxoxf3oa1lmDeaivol()seurio iu1optnlivt tfsrrmumpnt4ape mictat m emuvp;t0arxoxf3ia1lm   n il()seumimpiu4al  mnesatfaDtm(  ;o1olt ii3tad mDel(vpnu) etomr oa1fpDe i s;()tetoiopnudal   nvtl( srumxmp;o0opx mo3ildlmDrlums;t)aetnifciytfm r ueo;t trumxm3iodale lncta( a2tmu p;o0aeeomo3tytfm elnmp u4artrxfcoadfmD aieo;s0trxrim no1ap elivsa( aDtrurp;t4oet if3iysfmDemnmp (4trxoio3ia1fa  an i t)s2xo(rpnudlmte ivias)s2rrx  no0tpto feiysfa2rlnmo;(0aeeomrciatlpt lneo;s  rxm(m oo1omte ncsls sDtru pot1opeo f3iysla2rlnvs ()tlenmfcoydoaDraivs;(0s2trim ou1openlnvt t) 2tm( ont0aptnifcilt sDuanvp (4 rtnxr oadlpD  uvilt  rto(mpou1omte ieias aDur(r ot0alxniieiasls2eaums;(4 lxomf3iydlpt  neo;s sexoxmpiudlp nmneta(farraurpnu1texn i3iydlmDum(mp ()alerioctatoatean ol( seum(m io4lme miesa()sDurumonu4opxnio3tls s rluvs u0trenio3oo1la   nvs;s srtm(r3io1altemfvils) 2raxrpnu1oleo fetldfaDuluvpnt)altrif3totfpD  u s ( tetrxo ou4omt lfct () Dtaxr ;o0aptomiciys m2emnvp;u) rxnio3tytomDrluvo s  etrxm iu4omt  fctl( s2rr( ooo4tpt  o3iltfmDem(msnt0 renir3iodop eaneol(0 rxmxmpiodlmt lnvtlt  rururo;u4aet iiciltlaDuau s u0tlxoxrcoo1fpDelnvo;s0seurxrpnydolenmfeta(  Draumo;u1opeo ociytfs2elnmp ()tlxrxo3ta1op  lu ilt  etoim3no4oltelfct t)s2trxrpou0aetnmoetyd mDuaump u0aetomf ia1fp eai o;t0seuoio3io1ll e ict ()a2tax ono0aee  iciytfmDrluvo;(4texnxo3ia1lm  aneilt)setmxmpnudop   feiat)s2urx o;t0tltnmfciatlm2uaump (4 rxoif totfaD lu s s t2um(o3oo4ap nlfct (  rtmurpno4optnmieiatlsDumump (4arxrmf3oa1lm  au olt  2tmio nu1lm nlivtlsfaruaxrpoo0apxnioctlsfa2uluvpnt)aeenir oadfaD  uvslt setmxmpio1op   nvi sfa2rmumpou4tpt  ictasfm ua(ms u4 exnxr3iy1lpD  ivolt0tetr(r iy4ol  mnvs (fsDtmxmpoo0aetn oeilsfaDuaump t0 rtrxfcto1lp raivilt t2xr(m iodopenlictlsfs2rmur ot0tex  o3iysfm2rl(vont4 etrmo oatoptr n o t0 etrir3nydlmenlfes ( sDum(mpnu0aeeoiiciyt mDumu o (4aleoircta1laDrai s;s t2umirpiy4lm nmiciat)a2rmu  ;u0olx ifciytfaDrauvp;(0texnmr oydfp  lu ols trxmir oo4ameelfcsl(faDtrx  oo0oexoiociatla2ulnmp;u4 rxoifctytlmtrli i s)srxoimpiydoptn fctl(f Drmum ;t1oee  ieiysfmDulu s t0trerir to1oaDrluvs t s2uoxr3iu4ol  mivs sfarur(  no0ale mo3ilt a2ea( pnu4 lxomf ta1lptrlnvo s srxmio3oo4op  lict tf Draxmo;t0texo ieiltfa um(vo;t)tlenxr ta1fa e n s t  2uoirpou4lmtelivias) 2ta(mont0altoif3tlslmDulnvont0alxomf oy1la  au i;t0srtoxr iy1ame lnes t srum( pot1oltn oeiys m ranvo;t4teeoxo3ootopD aneilt  2to(m no1aptnmfcsasfs2rr(mpnu4alxniictlsfm2ulumo u4texnio oy1oaDranes;s trxoimpou4amtemicsat)aDuax  ;o1tpt mf3iltfs2rlnmont)artoxr to1lpDrlnvs;t  eum(rpiu1opt lics tf 2uau  nu0alenmfeias sDuaums;(0trenircoatlm rlu slt)trxoxr nu4ameemietat)a2rmu o;u4tee mo3iasfa2elu p u)trtnio3ta1omDeau s ()trtoxrpoy4ol emfvia(fs2ua(mpnt4altomfeias m rl(vp u4tltnmr3iatlmtrlnvi;(0trxmxopiu1lp   ncsl()sDtmump;t4oexoiociatls ulu snu4tlxnxoctotlaD aivo;(0 rtrxo nu1oltelfvi s arurxronu4opx  o3taslmDulnvo u4trerxo iatlpD aieo () rtrimpiy4ap  lfvils)artrxrp;u0alx mi3iyd a uluvsn() ltnxr iydfa eai sl(0s2xrxrpno4amt  fcsa() rumx pno4apeo feilt s2em(vp t4altomrcia1lmteaneol( tetrxmpno1olte iei t)sDrm( pnt1oeenmoeiyd mDeauvp u0aeenxo iatomDr n olt trxoim3oydllte fciat s2rmxm nt4alenifeilslaDua(mo u) lxoio totop  auei t  etoir3oydopte ncta( arrmxroou4oleomoeils aDul( p t0trerifctadoa eluvils t2xo(m3iudoptelivsat)s2rau  ;t1texniieild s uanms t0aetrmrcoa1fmD auesls teumxo nudllt licslsfa2taxrp;o1tlx if3iaslmDrmuvo (4trxoxo oy1op rauesls0trxmxr3iodlmeelncs t srur(m oo0tpeomo3iyd sDra(mp;u4alxrxf oadlmt livo t0s2uriopoy4lpt lieils) 2rrxmp;u1tpe iictlsls2ua(vo ()aleoxfctatlpteaneo;(0t2xmim3no4ol nmict t) rtaxr ;u1oet mictltla2um( s;t0 ltomfcio1omtrai olt0trur(m nydoleemict s)s2rr( pot4teeoio3tatfaDrluvo t4arxrio iodomtr ivs s0trur(o oodllt  fet tfsrurum ou4tex micils m emu p (0trenxrctytlp eaues;s) exoir3iu4optnlfcsas s2urxrooo0tetoifetls mDelu o (4tltnxo3iydlaD  ivi s0 2xrxo3ou1omtnlfes t)srurxmo;t4aetomf3iatfaDeanvo u0alxoif oy1lmtraies;( texm(m oudop  lies s aDrm(mo;o4opeoioctys s emnvsnt) ltoxfciydlp eaieils)s2uoim oydoptemivta( aDta(ro;o1teeoifctlt m em(mont4altomociodoaDrli ilt0 rumim3ou1om nmnetat  Dumu  ot0optoif3ildfa2rmumsnt0tltoircoydfa  an o;t srumxopio4ope liesls)srtaxrooo4oetomfctydfs2elu s;t)altomf3oatlaD aivo;s seurxrpnudoleemnesasfartrx pot1alxo ieildfaDumnvo (0 exrxfcoy1omtrai o;t)teurirpiy4lp e fctl()a2rmurp;t4tltoiietld sDum( s u4altriocoydfaDeaneo ( s2urxm oodlme lfvi t)sDrr(rooo0tpeniictad a2rlnmo t4trtrxrciytomDeanvi s trum(opny4lpe mfetl( arumxrpnu0tlxnifciadfsDumu o ()trtrxr totomDeluvi s0trxoir ou4ole mivsa(fa2umur ;o4oex  f3iatlaDuanms;u0aeerxo iodfatrlivo ( trxoim3ou4lp nmfcsls  Dtax o;t4texnmo3iasfa rmuvp;t0 ltoifcoatfp  lnvi;() rumxr oudaltnlics s)s2taurpnt4teenmoeiat mDra(mpnt4tleomo ootfa  lnvil( trxoxo3ny4ame lnctlt)a2umx ono0teeo ociyd s ra(mont0 leoio iytopDeluvi;( teum(rpnu4amenmfvilsf 2umur ot1alxomieild a2ua( s t4tltrif3oo1fp  lu ol()srurxopno1olt livia(fsrrru  ;t1olxoio3iysfs ra(vp u0 reoxocoatoaD lues;(0tetrxrpno1lp emfcils)sDumxmoou0tle  octld m2ulnmpnu)tetomf totlm  aivils)teumxopnudolt lfet tf 2rrxr no1tee  oetas s2rlnmo;u4arxrirciytla eauvs;s t2uo(m ny1amtnmfes s s2rmxrp;u1alx  oeildfa2eauvp t) ltrxr3tydlpD  u o ( srtrxmpny1olee ivtlt)srumxr ;o1oltnioeiydlm emnvo u0tltnxo iatfa e uvo;(0 rxm(r3ou4oltemfes tfa2trx  nt1tpxo ietlsla2uau o (0artoxr3ia1faD  iei t0 exoxo3iu4lp n iet ( srur( ont4oltniietatla2elums;(0texrxf tydop e i o (  rtmxo3oy4lmte ietat)aDuaump;o1olto f3iltlaDemuvs ()texrirciadfpteluvslt)tetrxm3nudomt lictltfsrrrxrp;u1apeomi3tlt a rl(ms (0 rxriociodlmt lieo;s t2urxm3nudope  fcilt s2urump;u4aex  fciltfmDrmumo;t)tlxnxr3iotfmtrlnei s0 2toxr3io1ole  nct t)s2urxrooo0olt mi3iasfm em(vs u4alenxf3oatfa  aieo;()trumio iu4oleemfvt s) Duaxm ou4apxn i3tas m2rl( s;u0artnmo oydlpDeai o s seuoxo no1lptnmivsl( srururo;u1olt ioeiys mDranvonu0 rtnir io1omt  neolt0t2xo(o oy4om   iesasf rtaxr ou0tlxnmiciltfsDua( sn(0artrxocty1omtrlnesl(0 2umxopou1al n fvilsfarrax p;o0apeomi3iysla2rm(ms;u)aeeoxfciotfaD  uvo s teuoxrpiu4lm nlicils  2rm(mo;t4apenii3iytfm rau s;u0 rxnxo tytfmDe ivs s0texrio ny4ol nlietatfsDtm(mo;u4optoii3iltfsDem( pnu4texnifciytfa ean s s0s2triopny4ol   ivtl(  rurxrooo0ope mo3iyd mDul(vonu)areomf3oydlmDeliei () rxrxm3iodllt lnes s)s2uaum ;u4ope mfeiatlaDeanmp;t) etnif oytlpt lnes () 2uoxm nudomtnlietls)artr(mpot4tlxo iciat m ul(ms;(4 lerxf iatla eln s s)s2tmim oo4om nliesas a2ra(mp;t0tex  ietys mDra(mpnt4 eenmo iydomtrluvo s  2ur(o oy1olee nvsltf Duaum oo1aexnii3iyt a2ranmo;u4texrmf3iytomDe ueilt texo(opnudlltnmncta(f 2ua( pou0oexoii3tatla umnms;t0tetrir3iytfp  anes s t2tmio3oy1omtn fvil( srrrxront0tle  f3iltfs2ua(msnt0 lerif tadlptr i o () 2tr(mpnu4lp n fctlsfsDtrumono4tet iociaslmDeanmo u4altnir3todlmDeluvo;t) 2xmxm3nu1openmfesl(  rrr(m ot1tex iiciatfm2rmu on(4 renxo3oo1op  lneo (0 rxrxo nudll   nciltf Drmumont0aee  ictltla2eaums (0aeerif3tydfptelivo;( s2urxmpio4ll  lfeiasfsDrmu o;u1olxoiicildfm ulnvpnu)teeomocootomDe ueo s0 eumim3ny1lmee fcsl()srtrump;o1opxomi3tltfaDrl(monu4 eeomrcoydoptr u ilt0s2umxmpiy1lptnmivtas sDtr(ro;u4aleomf3ils a2emumsnu)alxomf3oydfp e iei t trtmxm3iodamtnmfes (  Dra(mpnt0tex  octlsla rl(mp;t4arxnirctadfmtrau ol(  rumim iydal e ietatfarrmumo;u0tet iocildfm2rmn o u4alxrmo iy1lpteai ols setr(mpoudomtnmnvt s) Dtmump;u1tpxnmf3taslsDuaump;()aeenmocoydoptelneilt)s2xr(rpoydapt  fcta(  Drr(m nu4opeo i3tls a uan s;u0 rtoxo iydoa  lneils  rurio iy4oltnmfeiat)arra(mpno4apeo i3tytla2uau p u4alenir3iydfptean s (  ruo(mpiudap emfvta(f 2umx pnu4oetnmo3iadlm2el(vs;(4altomo tytfm r i i;(0teuoio nu4ame lfvslsfsrtmx ono0oexnifeilt s2umnvo;u4 etoxf3iodom  an o;t  exo(m3iy4lm e ncias) 2rm(rpot0olt  fciad s um( s u)aetoir3totlaD  ueilt s2toxo oydlpen nctltfsDrrxrpno4oexomf3iyd m2ulums;t)arerxfciotlpDeaivil()seurimpiu4ll  mfctls artmx oou4aex mfetyd mDua(mp u)alxnmoctodla rluvsl( t2xoxo3ou4om n fes s)srur(m nt1tex iociyslaDul(mo t4trxnxocoatomte ieo t)srumxm iy4lltnlfet t  2ta(mp;o1aet iicilt m elu s (0 reomr3oa1fp r u i t)sexoxr3iu1lp nmfes tf 2ta(rp;u1ope  icilt s um(vo;t)trtrxo3ta1lpt lnei s)s2tmir3no4lmen ivsat) Drruronu0oexomicilt m emn s ()trxoxf3iytom e neslt0tetmxo io4altn fviat srtaxr ou4tee io3iytfaDemu s t) lermo oytfp rlnvi t)seuo(r iudlp elneiat)s2rau ono4aetnifeiadfa2eln p;(0arxrmfctytlptr ieolt0t2urxopiydomt lnci () 2raum oo1apxomicilsfmDrluvpnt0teenxfcio1oatrlnvols)t2uo(r3nudamtnmfvils a2ur(m ;t1teeo ieiytfs umnvpnu0 lxnir oytoate ieo;t) etmio3oy4oltn ncsat  2tmurpou0aexomoeiyt s ul(mo (0 etomocta1lmD aiei s) 2tm(mpiu1lm nlncsas s2rm(  nu1tet  o3tadls2el(ms t0tltoxf3totoaDr nvslt trto(m3nodlptnlnviasfsrtrxr nu0tltnif3ild a2uan pnt0trtnif io1opt lneo;t)truo(m nydap  mies sfs2rr( oou1olx  fetld a2rlnmpnu0trxnxociodoptelivo t0 rxoim3no1amenlnviatfsDrax p;t4oex  fciatfa2umuvsnt4alxnircia1fpD  n s s  etmim3oo4aptemfvt sfsDur(m ;o0alt mictyt a ean p;t)alxrmf oodop r uei ()trtoirpoy1alenlfvs t arumx  ot0oexniieiysfm2elu o u) eenxr3oadfaD aiei;s t2urim ou1llenlnci tf 2rm(rpnu4tlt mfetyt a2um(vp u0tlenxrcoo1optelivi;s0t2tmxm nu1omen iviasfsrumum oo1aet mfciad a um(vp (0tlxoirctytfm  aneo t0 2xoimpnydapee fvil(  rrmx  nu0oexnif3ilt m rmuvont) rxomoctotlm rli s t0texr(o no4lmtelfeta(fa2ra(ro;o1opxnmocias s2rl( on(4artrmr tadomt  n o;t)srumim nu4ape mfvi t s2umur nt0ole iocilsfm2el(ms;u)tltrmf3oodomDr uvols teuoxrpnu1apen iet ()aDua(m oo1oex miciysfsDrl(vs;u0 rtrxfciydoate nei;t) etrxo3io1aptelncs tfarrru  no1oltn ieiydfs rm(mo;u)altnif oatlaDe ueil()trxmxopno4ol nlfcta()aDtm(mono4oltn ieils mDumn p (4 renxfciytoaD lieo ( seto(r3nydapeemfesa(f rurxmp;t4tle io3iydfa2eaumpnt)trerxfciytfateliei t0teur(m io1am elict t aDtm(mp;t4olx  octytla2elnvp (4aetnxr oo1fptr nes;s0 rum(rpoydlp nlfvt t arrr(moou4oltomiciad s2ranvon()tetoxr3iadlpDr nes (0srtoir oo1omee iei sf 2tmu  nu1tltn o3iadls2ea(mo;(4 etnmfcty1oatrlnei;()texrio3nydlle mnetasf 2tr(r oo0texomiciyd a2rmnms (4 rtnxfcoy1oa  auei (  rumxrpiu1amtelfetltfarur(rpno4apx moeiydlsDuaump u0 rtrxf oa1lpDr ueo;(0trxm(r no1llt mncs s  Drax p;t1aleoifcias s2elums;(4tlenxo ootlm elueo;()trxmxr nodameemneslt  rrm(m ot4ape micildla uan o (0tlxrxf iytfaD livs;s  2toxo3io1llt mnctat)artax p;o0olt iietldls em( ont0artnir3iydlpt  nesl(  eurxr nydlpte fviasfarurumoou1oleoii3iaslm um(ms;t0aeeomf3iodfa e ueo;t0t2to(r3nydllee fet ()a2tmxmooo1olen oeiyd s elu on(0 etnxo todfaDr uvs;( srtrirpoy4olt  nesl(f 2umu poo4tleoioeiasfsDrl( p (0 exoxo3oo1fpDe iei t) 2xmiopio4al nmfvtasfsDraxm ;o0tex mfciatfmDem(mp u0 etoxf3todlmt  ueslt)trurim io4ol nlnet t)srumxrpnt0opt mf3ild a rlu o;u0tltoif3iotomD  ivsl() rum(rpoudlltelnetas  2uau p;t1tlt mietldfs ra(von()altoiociy1omt  nvslt)seum(mpiu4amt mfcta()s2ra(mpoo1olxnii3iytfa2el(mo t4tleoifcoytop  lues;s0srto(mpnydope  fvi s) 2urxm nt1tpeoifctlsfa2emnvs;(4 renif3oatfmDrau i s0s2umio3nydol e nvsltfaDta(mooo1aexomieiysfmDuln o;(4artnio3iy1laDeaivo s srurxo ou1am  mivtat sDtrx pou0texniiciysfaDelu o (4tetomf oatomDran s (0trur(opoudame lfvslt) 2ur(rp;o4opt  i3tydfsDua(vpnu4 exrxo3to1oa rlieil( t2xr(r iu4apt  feta(f 2rr(mpoo1altoioctaslm2elums u4tleniocio1omteauvs s)teuoxr3ou1amt  fesltfsrtrxrpnu1aetoiociys a2uauvo;(0 leomr oydfp ean olt0s2trxr3iudlpeemfvilt) rrrx pnt4tpxn ieiatfa ulums t)arenir3totfpDelueols seto(opoy4lp nlictas sDta(mp;u0oeen i3iydfaDemu s u0 ltoir3iatlpDe nei t  eurxrpoy4lptn ivsltfs2taxmpoo1aee io3iat a2ranvp;(0aeenmo oo1omDr ivi;(0srto(mpoudale lfct s s2rau  ;t1tpt ii3tlsfs ulnmo (4aeeoir3oatlp  ai o t s2toxr3oy4ll elieiat  rrm(  ot4tptn ietytlsDea(msn()tltomociytlpteaneilt0s2trxo io4lmenmfesls) rrmx ono4tleo iciasfa raumo t)tetnxo3tydlp  lu s s)trxoir nu4lpenmiesas aDrax pnu0alt mi3ildlsDulu o;(0artomo oadopt  nei s  exoio ou1ll e nct () rumx  ;u4tpxnif3tys s2ran p;t4 rxnxf3to1fpt an o s) 2uo(mpoo4omt  iciat srtm(  ;u0olxnmicilt sDumuvon(4altrif to1fmDeli o;( teum(o iy4ap  lfctl(fsDum(r ;t4oee  oeiyd s uau snt) reoio3oa1fmtrai o t)texrxm ou4ol nmneiltf rumx o;o1tet io3iat s2emump ()tetrio oadlaDrlivo;t)seuo(o3iu4lme lnetl(fsrtmx o;t4tetn icils a rm(ms (0tltnif3oytoa eli olt0 eum(o oydop   fctlsfsrurxmo;t1tlxoifctls a ra( pnt)alxoir iytfpte uvo s0 eumio3iy1lpenlnvtlt)s2tm(mp;u0apxomfctad a emu o ()tlxoxfctotfmteanvil(  rtr(o3io1lp e ncsatf rum(ronu0oet  fetat m2emnms;()arerxrciadfaDran o;(0setrxm ou1opee ieiatfartmu onu0alxo fetas m uan s;u)tlxnmo oydla  auvo s)trtmxr oy1ope  ncsltfarurxronu0oeenii3tytlm rl( on(0trxnxr3io1lmt an il(0trtmim3nydameelfvil(fs2urxrpot4opx  ociytls2elnmo t4aeenio ia1oaD  ieo t)srxoir3iy1lltnlnvt s)aDrrumo;u0apt  feiltfsDrlumon(4trerxr oadoatrlu i;( sruo(rpiydaptnlfesls srurx  nu4tltoioeilsls2elu sn(0teenir3iy1lpteli i ( trxoxm3nudllenmfeiat) 2rm(m no1tet  ociytlm2rln o;(0tlerio oatlat livolt0srumir iodlmeelivilt) rum(mp;o1tex mi3ilsfs emums ()alermo3oa1lp  ai o;s) 2um(opny4lmtnlfesatfartmu o;t4olenii3iytfaDrl(vp;t4 ltomr3iodoa  luesls0seumxm no4lptnlneilt) Dtmu  ;t0tpxnifeiatfs2rau o;(0 lxriociotlpteluvs s texrxm nu4opt  ivia(  Drrxrooo0optniocilt m rlnvpnt) eenmocty1lm eai sls  rtoxr3nydlm nlncil(  2trumont1tex ioeiyd s2rm(vo;u)arxrifctotoaDrlnes t0 2trio ou4amt mnctatfaDtmu pno4aetomf3iyt a emnmo t0tlxrxr3iy1lmDe n il()trtm(m oy4ll  mncia(f Drm(m ;o4aet  f3iadfaDem(mp () lxoif tytlptranvi t seuoxr3iydaptelicsl()sDra(  no4aet mo3iytfm ul( p (4artomr3iadoa  luvs t srumxm iu1ale mivslt) Dra(r nu4tpxo ietlsla ul( o u0alenxr3tytfaDeauvo;t  2to(r3oo4lle  fctl()artaxr nt1tetn octys m rlnvs;t4teerxf iydlpDeai i (0s2toiopou1apt mncsa(fsDuaumpou4oltomf3tad a ranms t)alenmo3io1om eluvolt srtr(m nodal   ieil(faDua(mono0tpe io3iyt sDulu snu0teerir ty1oa r uvo;(0 2uoxo io4apt mfcs t sDrmx ooo0alt iieiadfmDran s t0 eenxr3ootlpDe ne
\ No newline at end of file
@@ -0,0 +1 @@
+u s;t  rxmim ny1oleemnvias  2trxmonu1texn fciat a ulnvs;u0 lenxrciytom  lu ols0setrio oydam nmivtls) 2taur oo0teeomfeildfsDrmums (4alxrio ootlatrlueo t srumxopny4lptnmnci s)s2ua(mooo1oee mieiydls ua(mp;t4aexnxo3ootlat lnvsl( t2urxm3nudapte ivtatf Dtaump;o4tlx mo3iadfs eauvsn(0 lermo3oy1fateaueolt0sexmxo3nodlle  ietls)s2tmxr oo1oltn ictatla eau ont) lenio oatlatranvo;( s2xm(m iy4openlnesas) Dumxr ;t1apto i3iatla2rmnvpn() lxrio iydomtrliei;()t2to(o3no1optelfctasf Dtmu pnt0oet  f3tld m ra( p t4tetoxfcoa1oa  luvils0 2xr(r no1openlicslsfarum( pou0ale mocilsfs rl(mp (4arerxfciatom e i s;()seuo(m3iu1op  lfetatf rrr(m nt0ope  fctytlm eaumo (4tetnxr oatlatrlivi s)texmim ny1lme mivs ( arra(rpnu4oex  icilslaDumu snu0 etrmrctytla   i olt  eur(rpio4ll n nvi t) 2uaumono4oex  o3iyt m eaump;() etoif oy1lmt livi s)sexmxm oo1aptnlfviasfa2rmuronu4tlt mfetadlaDrl( o t)artrif3oydfpDe u s s0seuoxo3iy4lm nlnvi (fsDua(moot4tlx mo3iys a2uaumo u4aeenmr3iydfmteauei;s0srxoir3ou4lpen fetas arrm(r ou1tlto iciltla elnmp () etoir tytlm rai s s trtrxrpoy4amenmiesasfa2rr(m ot4olxo f3tldlmDeanvp u4tlenxf oadlmD ln i s  etrxrpnodoleelnctltfartm(r oo4ole ifetlsfs rmu p;u0aexrxf tydlaD an o;( s2ur(rpiy1ll e ivil( s2rmuro;t4tlto o3iltla2ra(vont) rxrmocoy1fatelu ils)t2to(mpiu1oltnlfvia(faDrm(mo;o1tleo oetadfmDemnms;u4 lermo3iy1fmtraieolt0 rto(o3nydale  fvtatfaruru pot4alx mi3tad s rmn onu) lxrif oodoat ai ol(  exrxo3nu1lpenmici t  rtrxm ;o4tlxo ociat m2rln on() exrxfcoy1om  ln i (0 rtrxm3nu1om n nvils)s2tm(  oo0tetnmo3tytlm ul(vs;(4tetnmrciadfm   nes ()s2tm(mpny4ol emivil(  rra(r ou4tlen iciad m2ua(mp;t4trxrmf oodfpD lnvs ( s2xoxo iydlpe  ivi s arumxm nu1aetn o3tytfmDuau s t4trxnmf3totla elnei s0s2tr(rpnu1omt mneilsfsrtrx pno1olxn octltlaDra( on(4tlxoif3oytop  anvs;s s2trxo oy1optnlietas)s2ua(rp;o4aeenmo3iadls2umump () lxnxo ia1fp elnvi s)teuo(r oy1lltnmivia(  rrrxm nt1teto ictyt sDulu o () eerxf3tytla eaies s)s2xoxo io4lm  lfei t)s2rmxrpno1aeenmociytlsDuauvs;u4aetnir ia1omtelueo t texoir3nu4amt mnetltf Drmxm ou1apxo fctysla2umnmp;t) rerxf ty1fmt lieol( srxm(rpno4al nmnvtlsfarrrxmpnt4tee  fetltfa ea(mo;u4tleoxo3ta1lpteln o s0 rtoimpno1lp n fvi t sDua(mo;t1apen fetyt a eanvp;(4teermfctydlat luvs t0 2trxo nodllte iviat  2umxmont4opeomoetys s eln s;(0altriociotopDr ueo s s2uo(mpnodop   neiltfaDurxm ;u4opt ioeiadfs ulump;t4 rxoiocia1lp ran s;s texoxo3nudlmeemnvtlt artru p;u0tlt ii3ilsls umnmp (0 etoircoadlpD lieol() 2xr(r3no4lltnmfcil()aDur(rpnu4tltnmoeildls uln onu0 ltrxr3oo1fpDeaiei t)t2tr(o ny4ol  mivi (f Dta(  ;t0tltoio3iat m2ulu p u4tlxnifctytfaD auvi t0teuo(m no1lmtn fci t)srua( o;t4aptoio3ilslsDul(vs;(0 rxnxfciadlmtelivolt) rurxr3iy1oltelfvtls s2tmum oo4apxomieiyd mDul(ms;t0alermoctotoate ueols seur(rpoo1lmeemnvs ()srta( oou1aex miciyt s2em( p;u) leoio oa1oaD  i o;t) 2to(o ny4lptemfei ()a2rmu  ot4ale  i3tad s2rm( snt0arxrif3oo1oaDrau o s  etm(mpoodlm  lfeia(fs2taxmp;u4tetnmictyd m2elu sn(4 rtnmo3ty1fmteaiei s0t2tmxm3nu4al nmfci s) Dtmum ;t0tee  ieiyslm ran o t)tlxrmfcootfpDrlneo;s0 rxoirpou4om elnvils aDrr( oou1aexnmoeiytfm uaums ()treomo3tadom  au i;s0trxrir iudol e nci tfa2uau  ot4aexo i3iad sDel(mpnu)arxnmr3oodfpteln s t0 2ur(opoo4alenmfvsat)srur(m nt1teeoifciad m2rm(ms;t)texoxf3oadomtrau s;s0texr(m iodope lnvt t)aDtaurpnt1tpt mf3iltfm eau o;u4altrxo ia1om eai ol(0sexoim3oudaptemncsat) rtrur ot4ale  icils a uln snt4alxnxfcoadfpDrlu i t)s2xm(mpny1amenmivsls sDrrx  ou1tpeomf3tyslaDelnvs u0arxoiociadlp   i sl()s2xrxo nydopt  icsatfaDuaum ot1aeeoifciydfa2rlu p;()arxoiociytlmDelivsl(0trtmiopny1opte iet ()artru  nt4altnmoeiaslm rmn o;u)tlxrxrciy1fpD li i t0 2xm(o nu4ame mfeiasfa2rrx  oo0optnmo3iat aDeau on(0aeenioctotfpDe neo s0truo(o3iydope mietls) 2um(r no0aexn ietaslaDrmnvs u4tltnio totomteai s;()s2xm(opnydoltelfcsas srrau poo1aleomictys mDelu o;(0aexrxf3oatfp elu il(0trur(mpiy1aptn neil(fsDua(  nu4oeenioeiasls ul(mp;()altnmr oadom   i s s) rtr(mpoy4alenlivsa(farurumo;u0aetnioeiydfm2em( pnt) exomo oydfp  lnvsls0 eum(o3oy1lptnmivtl(fsDra(r nt4tlxo o3tlt a em( s t0altnxr oa1la rlnei;s) exmio ny4apeeliesls arua( pot4opxo ieiydfm rmnmp;u) reoxr3ty1lmDeau i t srurio3oy4lm  mnctls sDtax onu1teeniociat aDemnmo u0teenmo totoa  livil(  euoim oy4omeemicta(  2tr(  nt4alenmociysfa2ul(vp;(0 etoxrctadomD ln s s s2to(rpno4oltnmivi t  2tr(r nt0optnioeiadfs rlumsnu0 ltnmr todom   uvil( trum(mpiy1olenmncsl()sDuax  ot4tpx mf3iydls2elnmonu0 eeomrciydfa rai ol( teuoxr nydll  livt t aDtmx pnt0apeomicildlm2emnvpnt) rxrif oodfm r nvi;() rxmirpno1ol   icsa( s2rrumpno0opt ifciys aDuluvo;(4teermocoy1fmtrlnvi;s) rxm(m iy1al  lfvia( a2ra(  ot4opxn oeiat sDrlu o;t) eeomr ta1fatrlueolt0teuoxr3iy1ome  fet tfaDurx pno4apeo i3tysla umu onu4texrxo3iotlatrluvol()s2ur(r3oydaptn fvs (fsDumuro;o0tlt ifeilslm ulu s;u4tetrio3ta1omDraieo t0s2xmir ny4amt  fcsa()artr(r nt1oltn fciatfm2rm( pnu0arxrxf3tydfatrai o (0 ruoim nodll n ieils aDrr(rono4olxo fcilsfa uanmo t)teermfcoytfpt au ols t2xrxopio4ap   ncta( sDumxmpoo4aeeo o3iydls2emu pnt4 eerxf3oadopt lueslt) 2xmirpno1al nmnciat) Draxmpou0olxo oeilslsDrl(vp;t0trxnxf iydfat  nvi;t0s2xmxm3iodom e ivtls)s2raum ;o4texo f3iyt s ulnvsn(0trxrifciytfpt ln s;s) ruoimpiudlpen icsl() Drrxr ou0aleoifctydfa um(mp ()alxoiociodfmD auvi ( trxoim iy1llte nvt s aDuax p;o0texn i3iytfm emu o (4tltoxocoytfa  li s;() eto(opiydlp nliesl(  Dur( oou4olxo fciatlmDum( sn(0tlxomfciy1omt  i o;s) 2xo(r ou4omtn fcsa(farurumont4ale moctysfsDrmuvs t0trxnxrciadomDeaneils texoim3io1am n fvt ()aDrau p;o4olx iictldls rl(vo;()alxomocoodlm r uvo s0srtr(o iydllenlfctlsf Duax  oo4apt mf3iytls2rmnmp t4tlxnio oytomDeln o;t)t2uoxo3iy1altelietatf 2trxm ou4tlx mf3ildla umn o;u)tleomf oydlaDelueol(0tetmxm3nydlpe  fet t  ruax  nt1tleomfctytfa ran pnt4trtnmociadomD  ivs (0trxmim ou4lpt  iciat  2raur oo1tpxoii3tysfmDrmuvp;(0 ltnxrciytlate u o;s s2tmxopnydlltemfvt (farra( p;o4olxnifetld a2rlnmo;(0tlxrxr io1opD  n i ( sexo(mpoudlp emicsa(  Duaur nt0tetn ociatla2um(ms u) exomocoadlm rauei t seuo(mpiu1alte fet tf rtrumpou4tltn ocildfaDeln p;()tltomrcoy1oa eli olt) etr(o iu1lmtelietlt s2urxroou4aexomf3tadla2umuvs;() lxnmr3iatlaD  n s ( t2to(r oudlltnlnvsas)aDua(r nu1tpt  fctltfmDranmpnu0tetrifciytlaDe ues (0 eum(o no4lp emfvtatfs2umu poo1oleoii3tltlsDrm(vp;t0tetrxfciy1lp rauvs;s0t2xr(r io4lpeelietl(  2ur( ono1texoifeiaslaDulu o t0texrmrcty1laDrln sls)srto(r nydop  lietas)sDrrumont4tptn o3iyt sDel(mpnt4 eenxf todfmt  ueo;s s2xo(o3nydopee fcs t a2ur( onu1oetomi3iyd aDemnms (0 leoifcoy1fa ranesl() 2uoio ny1lpe mictl(fsrrr(rpnu4tpenif3iadfm2uln snt) reoxfcoa1oaDrauvo;()s2tr(o ny1llt miet ()a2tru oou4oeen oeildfs2em(mo;u)arxoif oadoptr i s;s teto(o iodomenlnesltf rtauroou1tet  i3tyt a rlumont4aeeomo3todlpte n o s0 etoxmpno1lmteliei s)a2tmurp;u0aee mf3ilsfaDrl(monu0 rtrxf3ia1lpte i ol(0 2xrxrpoodomtnlivia( a2rm(  nt0opt  feiad a em( p t4tlxoxr to1lpDran i;t srtoimpiodom e ncils)aDumumo;u4tlt if3iyd s2rm(mpn()tlxrxr iy1oaDr uei;t0s2xmxrpnu4lle  fciltf Drau poo1tle  ieias s rlu snt0texoio ta1oat  i s;t)s2xoir nydapenmieta(f ruaxrooo1tpt  oeilslmDulumo u) rxnxf ootlmDeauvilt) etoxopio4am e iei (  rrr(moou0apxo ieilsfm um( on(4trtnmrctatfptranvolt tetm(rpnu4om emiesatfsrrr(r ;u0aeenioeiad mDrlumonu0tlenifcta1op  aieo ( t2toxrpou4open netlt  rrm(  ;u0altnmi3tltfm2ra(vs u)texriocootlpD  ivilt0 eur(m3oodameelivtlt srumx  ;o1alx mociad m ulnvsn(0aeermrcta1om e neol(0srtm(r3oydlmtnmietls aDtrurpnu1olenmfctadlm ran pn()alxoifcootlmDeaiei;t0tetoxopou1ol   ivtl() 2trumpoo0aetoii3tltls rauvonu) reoirciydlmDe uvo ()sexmim3nydlp n fvi (  2uaumpno0tlt  i3iysfsDemumont4 leomf oatomt livi;()s2umxopnu1al elfetat a2uaxm ;t4alxo o3tatfm2eau s;u4altrif oodlaDraiei (0 rumxm3oudlme liei s  rrax oot0tpxn i3iysfa ra( sn(0tltnxo3iotop   n o;t0 eumio nu4opte ict t)aDtruro;u4tex mfeiad s ranmon(4altnxr oadlp   nes ( trtrxo3oudlp  lnvias) Dtaxmo;u4oetnmieiydfa2elump (4alenxrctotoatrau sls0 etmxrpiu1op  lfcsls a2rm(m no1alto ietlslsDrmu snu) etniociatlaDrlu il(  rurxo3ou4optemfvsls  rtr(r ;t0opt  fctasfa eluvs t)aexrio3ty1fmDe ivslt0t2uoxm oo1lle mneiasfartmu o;t0alxn o3tyd m eln p t0artniocoadfpDrlnvslt) 2uoim3iu4opt micslt s2raur ot1ope mo3iltfa2ra(vs () rxnxfcoadlp e uvs;(0trxrim3nu4aptnlivt s)a2tax  no0teeomf3iltfm2em(vo;u0teermf oytlmtrlivi ()setoxo3iodapen ivil(  Dur(r ;t0teto ictadfaDeluvs u4artnxo iadfaD luvo t trxmim iy1op  lfvi t a2urum ;t0optnifeiaslm uan o;t) lxoxr3iatfmD au i;t texm(m3oydapeemfcia(f rtmxmp;t4oltomfciyt mDrlnmpn(4 lenio tytlm  lu s;s)t2uriopiy4olt lncia()srtm(ronu0optnii3iyt sDran pnu0altnmr3to1lpDr nei t0 eto(m iydamtemiesls  2uaxm ou1oee iictydfs ulnvon(0aexnmo tadlaDrlues (0truo(m iy1lpe  nvtl( aDtr( p;o0alxn i3tas aDrmn s;t)altomf3ootoa r ieilt0trtoim nodame mnes t)s2tau  ou0tlxo iciatlm2eanmp;t4tetrir3ootfa rlivol(0setm(mpiodoptemfei ( s2ua(  nt0oleniietatfmDra(mp;(0 exrxfciodfpDeli o s)trtm(o oy1lptnlfetl(f Dtrx o;o1olxnif3ild s2rl(mo u) exoxo3iy1fmtr uvo;t t2uoirpoo1omenlici t)sDta(r ;o0aex iociadla2ulnvo;t4aleoxr3totfm r ieo;()trxoxm3oo4ale lnvias) rururo;o1tle mieias sDrmu sn()alxoxrcty1oa rli o t  eumiopou4aptemivias a2rm(  nu0ale mietyt aDranmp u0 rtrxf3ia1oatraueils) rtoxopno1lm emfvi sf rrr(ront4apt  i3tldls2umn o;() reoxrcto1fatranesl( seur(m3oo1alenlfcsa()a2urx  nt1optnmicilsla ulu o;t4alenmo3oatfptranvs t)t2urir3io4lle lnet s) 2rrxrp;u1tlxo oeilsfs2ul(ms u0arxnxo ta1fmtr u ols)t2uoim3nydolee icilt a2rmx p;t4tpx  fciltla rluvs;t0 lermrcoy1lpD liei;( trxm(o3iodlmenmnctas)a2rm( ono1apenif3iytlsDemnmo;(0 rtrmr iotomteli s;s) rtmirpiu1lltn ici ( s2trxr ;t0open ieilt m umnmo u0alerxo ta1fmteaiei;s0s2uo(mpiy4lltn ics () 2uaxm ot0oexo f3iys aDrmn pnu)arxrxr3iatop eanvsls0t2xo(o ou4aleelnesatfsDtr( pno0opt  ictydlm rlump;(0 rxrio oatfatelnes s0srxmio io4lltnmnvtl()artrumoou4tptomi3iad mDumu s;(0 eenxr iytfp   n olt  rxoiopio4am emnvsat) Dtmxmooo4tetn iciatlm emu o u0 etrxr3oodlmtelivslt) etm(o nydaltelict ( srta(mo;u4olx moeilsfmDemu s;t4aeenif oydlp r i ol()sexrxr iu1lleelics sf Dtau o;t1opxoiociasls rluvo t) rtoif3oatom rln ol()setrxo no4ope  ieslt)aDumxmpou4ale  ociltfaDrln onu)arenxrcoytom r uei;s0teur(r3oy1ap  mnvta() rrruront0aetn f3iasfm ua(msn(0 ltoxf3iy1la  lueo;(0s2toimpnudoltnlivtas  rtm(rpot1texo f3iydlm rmu snu0tlxrxo oodla eai i t t2umirpno1lptn nct (faDua(m nu1aet if3iytlaDul( p;t4teerxr3tadopD  n s;s0 rxr(rpiydapenlnetlt) ruaurpno4apxn o3tld sDea( p;(4 rxrmrciadfp  lnes t0tetoio3io4om emnctlsf 2taxmo;t0ope  oeildls2ranvon(0 etnxr3iatop  ln i;( texmirpio4lmen fcslt s2ur(roou0tle  ociydfaDrl(msnu4aleomo oodlpDrlueo;(0 rxm(o3oo1altnmfvi tfaDta(r ;u4tle ifcilslaDumuvsnt0treoxr3iadfmDeanes ( t2xoxm oudaltnmneiatfsrta(mpot4ale ioetat sDuanvpnu4 lenmrcoodomDr i s (0t2ur(r3oudomen iet tfsrraur nt0teeomf3tls m ua( s;t4texnmr3iadlateliei (  2xm(m3ou1lp  licsl()sDua(m ;t0alt ioeiltfa2elu on(4tltnio3iodlpt  u il( s2um(m3ny4lpe lfeslt  Drm(rp;u0altomoctldlm2uluvpnt0 ltnxr oatoatrai ils teto(r3nydlp nlfeiltfsDrr(ro;o4teen ieilsfs2eln on(0alenmr iadlmDr uei;( trtrxopny1olt lnes s)s2ur( pot4aptnii3tat sDulnmo;u4 lxomrctytlpDe ues;(0t2tm(rpoy4apenmfei ()aDua(rp;t1texnio3tldfm2ea( pnt4 reomo3totlmt an il(0 rto(r oodameelfvsa()sruaxrp;t4tpe  iciytla rl(msnu4aleoxf iydoa elivi ()tetrxr3no1ap e ncsl( aDumum ou0tlenmocias aDrmums u0arenmfctotoa e n s;t0 rtrir iudapenlivi (f 2uax pnt0oexn ociydlsDumnvs;u0trxrxfctatfaDelneo;t0s2tr(m iy4llenlncsatfa2rmxrp;u4aet  fctlt m rmumonu0 lenif oatomDelueil(0s2xmxr ny4ol   iesat) rurxrp;u1tlx mf3tlt aDraumpnu4 reoif oytfa raieolt t2umimpnodlp nlivs (  2tax poo1ape mf3iat mDeanmp;(4texrmocoo1fat ai s;( s2to(m3oo4altnlfeias  rtrxro;o1alxnmfeiysfs2eaumont4arermr3iytopteaivs s s2tm(o3iu4ll   fetls)srta( o;u4optnif3iatfa2el( o t) ltrxo3oodfa  ai i t t2xrir iydomte ictat)aDumuro;o0teenmfciltlsDrmu o;t)tlenmf ia1fa   nvs;t)setoxm oo4lm nmicias arrmu ono0teeo oeiytfm rl( p u4trenmf iadomt lneils)srtrxo ny1amee ivil(fs2tmumono4aetn f3ild s eluvp (4alerxo iydlmDrauei;s  2umxm no4apt  fcsa( s2tax  ;o0apt mf3iasla uan p;u)aetrif3oydlmDrliesls0 2xrxrpiy4oltelfci tf 2um(m ;o1tpe  ieilsfmDeaumpnt0tlerirctatomD anvo t  2uoim3iudlmenlfctas)aDrrxr nu0texoii3tysfm2umnmsnu0aeerxo3oy1la r u i (0tetoio oo1olt lnei (  2rr(r nt0aee moeiysfm uluvsnu4aetnxo ta1laD  ies;s)trumxo3ou4ol   nesa( a2taur no0aee moctltfs uanmp;u4trxoxr3iadfatrluvs t)s2uo(mpny4olenlnesls)s2rr( pot4tpx mf3iytfaDeluvont4aexrifciytlptrlnes () exmxr oudape mfci ( sDumum no0alxnmi3ilsfmDulnvon(4aetnmf tydomDe uei s)seumirpnu1openmnvs ( a2rmurp;o4altnmoctydfm ua( s t)treoxo to1fp eau i;t trto(r iy4al elneiatf rur(ro;t1aee miciydlsDrlu p u0aexoir3ta1lptrlnei;(0 rto(o3oudlmee ivta(fsrrrxrp;o0tetoifeilt sDrmn s t0teeoxr oodoat  nvi;()s2uo(m no1om nlfctasfs2uax poo1tltnmfciadls2ea(vs t0alxnioctatfpt livi;s seuoxrpnydal e fvsls a2rm(mp;u1aeto oeildfaDul( on(4aeeoiocoadfaDelnvo;t s2tm(rpiu4altnmnvtlt)a2ur(mpot4tpe  ociatlaDuan snt4 reoxrctytfptr n ol(0sexmimpiodlmtnlnvsa(faDrr(moot4opx iictltfs2ulnvs;() eeomr3tytla  li s;(0 exoxr3iu4op  lictls)a2rau  ou4aexnmoeiatfm2umnmo u)teerxf3oy1omt  ies;s0s2toiopou4om nmnetl() rumum ou0tetnmf3iltfm2ul(vo;u) lxrxfctatlpt  neils0 rxo(rpiydoptelieslsfarrm( poo4oeenmietadla2ul(mp;(4 lermo io1omDe n sl(0 exrim3iydalt mici (fa2truroot1tleomfeilslm2uan o (0 ltrxf totlmDelnvo;s) 2uoir nodlptn ivias)s2rr( pou0olenmfetlslm uluvsnt0artrmr oatopD aieolt  ruoim iodope lnvs (fsDumxro;o1apenmfeiatfs ra(vp u0alenio3to1opt  neils)srtm(o3oy1am  micilt arum(m ou0oleoioeiytfsDrmnvonu4 ltnio3ty1fa eaieil( sexo(opoo4ame lici s) rum(rooo0oeenmociad s2uanmp t0trxnxf3tatom ranei t  2tm(r3oo4aleeliei ( aruaump;u1alxn iciadfm umnvo u4 etnif oadfmDeln i;s)t2xrir3oudol e ies tfs2umumpnt1aeen oetatla2eau o t)arxrif3tydopDe ivilt trtmxrpiu4lltn fetlt  rum(  ;o4aptniiciytfa2ea( pnt0alxnmo3to1lmDeauvs t0truoir3oy4lmtnmneilt)arurur no0olx ifcilslaDra( s u4areoircto1op ranei ()s2umxr nudlpeemivt (fa2taumo;t1tlenmociatlsDean s;(0treoif iodlat lnvi;t s2uoxmpny1amtnmiviatfs2tmu  no4opxniiciys aDuln o;t)tlenxo3io1fp r nvsls)teurxrpoydop nlfeiat  Dtrumo;u1teen fetydfm2emnvs t0texoifcoodlmD  nvs;t t2xmxr3iudol  lncsa(f Dumurpnu4olx mfetys s2eauvp u0 eenmr3iydfm rlueo t)t2ur(m3iu4omtnmfviltf rtmxrpnu0apto ieild m rlumsn()tlenxfciadfm e ivsls)texoxm ou1opte fetltfa2umumpno4tex  o3tls s2rlnms;(4 rxoiocootfp   nvilt)tetmio iudol n ict (f rtaur ou4alx moeiysfaDeanmp (4artnio3tytfm   ivslt0 2uo(r3ny4lp  lnetls)arrrxr no1tltomf3tld a2ran p ()tlxoxo3totop   uvs;t)srxo(o iudopt lfetl(f rrmur ;u0tlxo o3iltla2umnms u4artoif ootomtrlieslt0trurio3nodamee fvs t a2rmx p;u4oexn o3iytlmDeln snu)trenxr oytopDe ivi t0srtrio3io1ol  lict sf rtaumonu0optoii3tatfa umnvp t4trtoir totoaDr ivs;s texo(r ou1ap n nvs t)s2urx oou0tlxnifeiytlaDua(mo;t)trxrxo ty1lm r i slt srxmim3nydllen fetls a2urumonu1aexomieilslmDelumsn(0artrxf3tydfm  luvi s0 rxriopou4lp emietl()srrrurpoo0texnmfctatfaDulnms t4tlxnxf3iodoaDrlu s;(0 etoim3nodom   feta()aDta(m ;o0olenmoetyslaDumu p;t) lxnmr iatfm elueol(0teur(o3iodll elfvs ()aDraum ot4tpe mocilsfm em( s u4altnmo3oodlaDr n i t seuoio3iu4lpe lnes s)aDumur ;t4tle iictad mDulu onu0 exoxrctatomt ai il( trxrirpnydlm e fvtasfs2rmxrp;u4apx  ictytla2emumpnt0trxnmfcoytfmDrlies;( s2um(m3oo4ap n nvs (  rtrumpou4altnifeiyd mDulnvo;() etnxr3iodfm   n s t0srumir3nudom nmfesltfsrrr(ronu0teenifciatfs elnmp;t0alxomr tydoat ln i t)seto(o iydamtelfeiasfs2raxmono1oetoif3tysfa2ulnmsn(0 leoif io1fat liei s)trxmir3iudomeeliei ()sDua( ono4tpeoifcils m2umu snu0tlxrxr3ootoptrlu o s  exoxopio4apeemici (fsDururonu0tlxnif3iadfsDumuvp u0trenif iotoa e uvi;t)s2tmim oy1ll n nvt s)srum(rp;u0oet ii3tytfs2ea(vo u)trtrir3to1lmDean o s t2umxm3iu4lp emnvsasf rtaxronu1tpeo fciasfsDul(vs (4 rerxociytlaDr nvi;(0srumxr oydamtemncia( artru p;o1tlxomf3ilt m emnvs u0tetnmr3io1fpDrln i ( t2xrxm nydomee iesl(f 2rrxr ;t0aptnmfetadfsDeanmon() eerir tytfptrlivs t)t2xrim nu4omtnmicil(f Draxr ou0oet mieilsla2em(vs t4texrmo3tydoateanvi s)trxmio no4olen iviatfsDuaxr ;o1aex  iciatfs uau s t4tetrif3tytoaDeauvs;(  ruriopnodop elnetls) 2rau p;t1oex iictltlm rlums (4arxoiocoo1opDe n il()srurio iu1aptnlfetlt s2tmu pnt0tptn octyd a rlnmsnt4tetnmr3tydfpDeai s t0t2umio3no1lpt mivtasfs2rauronu1tptnioctas mDuauvsn(0 rxnio3iydfaD  nvi ( t2ur(opiu4lptnmieil()artru  nu4oex  oetltls ul(vo u0trxomociodlp e ieo ()trxrim nodol nmnetl() 2rm(r ;t0ape mfcilsfaDem( s t4arxoiocoodfpte nvo;s  2tr(mpoy1ale  iviat  Drr(m ot0ape  fctytfa2emnvp;u4aleriociytopt anvol(  2um(mpou1lpe mnes t s2ur(mo;o0apx  octas s2eln snt0trerxfcootopDe ueol()s2tmim3iudap emnvsas)sDtmxmpnt4alxn ieiyslaDul(vs;u)alxoir3oodop  lueo;s)trxm(r nodap emnctat  2rrxmp;o4oeen feiad a2rm( o;(4altrxo oydfaDelneo s  rtoxo3ou1lpeemfetas  Durxr nt1tpx mieildfaDeluvs u4tltomo ootop rai olt tetm(rpiy1olte fciat) rrmur oo0tpx iictadfa uau p t4 lxnmf3iatop e ivs ( texr(rpio4am emicta()aDrru  ;u4opt mieiysfmDelnvp t0trtomrcty1omDeanesl(0s2xm(m3oo1lmt  ieilt)aDuru o;t4ole  f3iaslm ea( pn(4 eerir iodom rai s (0t2to(m3iudomte fvsltf 2rruro;o0aeenmi3tlt s uanvo (4 ltnir3oydomt  uvil( trurir iudamte fes t  rumx poo1aptniieildlm ranmp;(0alenxrcoadop e ivo;t0seto(m oudlp nmnvta(fartm( p;t1aee mi3iltfsDemuvpnu)alerxocoadla  aieo (0sexm(o3oudlm nmiei (farrmxmpnt0alen ictasfm rau pnu0texnif3iytfatrln i s)srtmxr io4lmen fvt s srra(rp;u4oexn f3ilt mDrlnvpnu) ltoio3iydoaDraieo;( t2uoxo3iu1al elnvia( arua(mo;o1olxo feiytfs rmn p;(4aexrif3iatop  au s s setm(rpoo4olen ict ()aDra(r ;t0opeoioeiasfa2em(vs;u4 ltrmf3oa1omtrai ils srtr(m no4lpee fesls) 2trx p;u4texo ociys s2ul(vsnu)tltrxrctadfaDelnvo t seum(o3iydop e iet ()sDuaurpot4olenmieiaslaDul( pn() exnif iytoa raueols0 exr(opny1ol  mnei tfsrtm(moot4ole ifciadfm2emump u)trtrxo oatoatrauvi;s)t2xoxrpoy1alee neta( s2rmx onu1ape  fciysls ranvp;u)tltnif tadlmt aivsl(0t2uoxr3no1llenlfctasfaDrmxr ou1opx  icias s2uanvp;u) lxoxfcoatlpDe nes;s t2xmiopou1am  lneiatf rtr(rp;t0oet iieiasla2umn onu)trtnmo3ta1oa r iei t)s2um(r nodlmt  nvta( sDtrur no1apxn ociytlsDranvo t4trxoxocia1fmD auvs s0 rur(r3nydap n feil(fsrum(mpnt4texomocilsfaDumnvo;()aetnmrciotoa e u o;s)trxmxmpio1am e nes t)s2tm(m ou1aleo iciyslm rln p;(0tltnmociytlpt lieo;s0teto(mpiydomen ieslsf rra( p;t1optoifciltls2emnvont4 rxnirctotfa e nes t0 exmir3oudamen ivta(  rur( p;u1tpeo fciyt mDem( s;t)aexrmf oa1op raivsls)t2xr(o iydolt mies t) rur(moot0apxo ieiysfa2elnmsnu0 lenmocoytfaD  ivilt  2xrxo3no4llen nciasfs2rr(mpnt4apx mi3ils m emnvp;u0aeeomf io1lpt lneo t0teumiopoy1lptnmnvtls aDumxm no0teen fetyd m eaumo;()tetnircio1oateau olt0trxm(o3nudlmenmfctasfsDtrumooo4oltnifeiadfmDrmuvpn()tleomrcoa1fp eaivs;t t2tmirpoy4ope mfeiat arumu pnu0aexomoctat aDean sn() ltomo3iydla eaneils truoxo iu4aleelfetlsfa2tmxmpno1altoio3ilsfaDrlnvpnt4altnifcootlaDrauvo;t)t2xr(m3ou1lme lfesl()sDrmum ou4opt iictlsfaDrl(vo t4trtrmfcoytfa  auvo;s)t2xr(rpiodapte ics s  Dtmu  ;u0tlx  oeiltfs eau snt)aetoir3totfa  aueo;s texmxopny4lm e nvsls)aDrmxm ou1tleoifeiys s2elums t)trxnio tadop eai i;(0sexrio3no4ol elieiasf rua(m ;o0tpenmo3iydls em(mo;t0 rxrmrcto1fa  lues;()sexm(mpny1omtemicsltf Drruroot4texn i3ias aDemnmont4tetnxf3oa1fat  i o;t  exmxrpnu1lm   ncslsfs2tr(m ot4alx mfctldfaDuauvs;(0arenmfcoadfaDeluvils) 2uoir no1lpt mfci t  rurx  ;o4aleniiciltfa2em(vo;t) exoio3oadfateanvil( s2xmir3nudapee fvsat s2ta(rpnt0tlx  o3iysfmDuluvo ()trerxr iydoa  lueslt0texmxo3nu1lpenmnct t a2uaxmoou0oex mocias a2elums t0 lxoiocta1lp elnei t  2urxr3io4alenlicslsfs2rax onu0oeeoif3tysfa emuvpn()tlxrxf3iodfa eanei;s  rxriopiy4ame mfvi t)sDta(rpnt0tleoiocilsfs elnmp u4 exrmociotlmt anvsls srur(r3iu4ale  fesls)s2uru p;o0oetnmoctls m rln snu0tlenir totfpt  nvi;s0 rtr(o ny4ol n nciat aruax  nu1tetn oetld m2uau s t)tetoxf tatlp eauvo;(0 rxoxm3iy1ape lneiltfsruau o;t4aeto ociadfsDraumo;u0aetoifcoy1faDr i s s srurxmpoudopeemfcs t)aruaxm ;u0teeomi3ild sDrauvsnt) ltrmociytfptrlnei;() exmim3nudll e fetlt srtaum ;t4tpenio3iatla rln pnu) leomrcia1lp eln ils s2tmxmpnudlmtn icia() rrm(r ou4oltn ictlsfsDeln o;t)teenxociadomt anvil( srxoxopnu4lm  mictltfaDurxr ;t0aee  ocilsls ul(mo;(4 lxoircia1lmteai s ( s2xoxo3ou1lleelietlsfsrta(m ;t0ole moeias mDea(mo ()alerxo3ta1fm rlues;s0teur(m3oudape lncsl() 2tm( o;o0alt mfciydfs ul(mpnt0artnmo3iytlm rauvi ( t2xo(o3iy4apen neiatfsDrr(  ou4olxomi3iydfaDrlumont0 etnxf3iytlp   ivo s  rtr(r3iy1ll nlivsls  rtrx ooo1oexn f3tys m rau s;u4altnmr3oydlmtelu ilt0srxrxo3iy4lptemivias)sDra( p;o1tlx iieilt aDrmnmonu4 rtrxrcoo1opDrlues;s0 rxoirpiy1lpt  fetl(  rrmx o;u4aexo f3iysla raump ()tlxoxr3tatop rai o;s trxmxr oydlptelnvsat srurxrp;o1tltomfciatlsDelumpnt)aleoio3ty1oaDelnesl( texmir iudlp nmfvt s artrump;o0olxnmoeild aDumnmpnt4aexrxo tydom r i slt  etm(rpou1lmeelfvt tf Dumurpno0openmfetlt aDeauvs;t0trxrmf3oytop  aivs ( t2toxr oudopt micia()s2trxmpnt1optnif3tyt aDrlu p t0aexnxf io1lp rluvi;() eto(m nudame  fvs sfaDurum ;o4aleoifctasla rluvo;u)arxrir3oatoa   ies;s)setrxm nudoptnlics s)arra(mp;u4tlxn ieiys m rm(vo ()artrxf3ia1oaDeaivi;s0teur(opoudoltn nvt tfa2tmurpoo0tpe io3tat s ul( on()altnmfcoadfpDe nesls texmir3nudlmt mict ( artax  nt1tptnmfcildlmDrauvo ()tlenir io1omDraieilt)t2tr(m3nodape lneslsfarraumo;u1ale mfeiadlaDeluvo (4treoxr3oydfmte n o (  rxmim3iu1amenlfvtas s2trxrpno0apx ifetydlm2eaumpnu0tlenxrcio1op r uvilt0t2umio ou1op nlnet sf 2taur ot1alt mi3ias aDemn pnu0 exoxr3tydomtrau o ()srtriopiodap nmfvt ( sDraur ou1aee  f3iasls uan o t)altoiocoa1lmt lues;s  rumim oodalen icta(fsDtaurpnu4ole  ieiasfa rmumo u)trxnircia1omtr ivo;s srxoiopiydllen ncs t)a2urump;u4alxnii3ildfmDelu o;(4 etrif iatlp  ai s;()srxmxo io4lmenmncsas) rtaurpot4alenmoetlsfa elu pnt0arxrmf3ta1oa  aiei;() rurio nu4omtnmfcs t) rua(mo;u1texo ieildfaDraums;u4teeoio oo1la rlivilt t2xr(o3ny1lp  lfctlt)aDtmxmo;u0olx iiciasfm el( p;t4areoxr3oydlaDrlneo;s)s2um(mpoy1altnlncia() Drax  oo4texnifciyt s2ranvpnu)arermociy1oa  livols)texoim nydape  ietl(fa2urxro;o1oeto o3ias s uln p u4teenir3iy1oa e nei;t) rxoxopny1amtemfvslsfartax ont4opxo o3iltla eluvp;t4 etoir oodopD aivo;t)seto(o io1lp nlncta() 2tax  oo1tpxniictas s em(vont0alxomf3oadoaD lies t0srxm(r nydapt  fvtltfa2raurpot1texoio3iat aDrm( o u0aexrir3totfaD lueo t)s2xrxm3nu4lmtelfvil()aDtax  ou0aetoiociatfsDumnmp;()texnmf to1opD lu il(0trtrim3oo1lle mncs sfarrm( ooo1olxoii3iatlmDul(vs;t4trtoxocoytfpt lneol()setmxo3oy4lleemneilt srumxr ou1tee mi3iydla2rlnmo t4 ltrirciy1lm  au sls)srxrir3iy4amtn fvil(f 2tmurpoo1alt  o3iyt m2emu o;u4texoxr3oatoatraueil()t2xm(m3oudome mnet ( srtmxro;t4texnmocildla2ean sn(4aleomrctodoaDeluei;s s2toxr iu1apt  fesat  2um(rp;u1tpxomoetls m2eanvo;u)aexnir3tatlptran ols srxo(o iy4alt  nci (fsDrmxrooo1ape ifeiatfsDuan onu0alermf ootfpDelu ol(0 etmxo iydap nmivia(  Dur(rooo1opxnioetlsfa2ran s;u)tetnio3oadopDr uvs () rto(m3iudlp nlieia(fsrua(mpnu4tlxnioeilslsDraumsnu4arxnircoydop  lneo;t s2xr(mpny4lltelnvia(  Dur(rpnu0aex  ieilt aDrl( on()aetriocoodoaD lneslt)truoir3ny1am n ivtas) rtm(rono4opto i3tat s eanvp;()arxrioctadoate uvo;t s2xr(mpiu1lm  mieils  2tm(  nu0tpxomoetys s uluvo;() leoif3oydlmDeai ol(0 eur(r oydopenlfet tfs2taum ou1aee io3ild m2umn on(4 eeoif io1oa r ivs;(  2uo(m3oudlme lfcs (faDrmumooo0alxoioeiltfs ea(mpn() lxrio3tydoptranei (0s2xoxo oo4lptemneia() rtmurooo1tptoio3ild mDrm(mp;(4trtoxociadomt lnesls) etrim oy4llte nes s sDumxmpno0aetniictlsfm ulnmpnt)aexrxf oo1oate n s t  2trxr3oydape mfctl() Dtrxroot4apx  oetytla um(vsnt4 etnif3iydfateanvi t0srumir3oo4lptelici t  rurumpoo0apt if3ildlm rm( p u)aetoxfciydlmtrauei (0sexrio nudll emivsltf Drr( pou0apxn oetldfsDrmuvo;u) exoxo oodlatrln s;t)setmim3oo1ope mies s aDta(  nu4alt iociat mDul(mpn(0 ltrif3ta1omtr i o;s sruoxr nu1olt mnvias srtax o;t0tlx  o3iyslm ra(msn(0arxoxf iotoaDe ueo t  2xo(rpnudapenlfci () rrm(mo;u0tpxomfeildla rluvs;()tlxnxo oa1la  luvol(0srurxrpoo1lmtelfvs sfaDurum no4opeoiieilsfa2umuvp u) lxomociytfmDe uei;t)t2ur(r oy4amtelivta()s2ta(r nu4tleomieiltfmDem( pn() ltriocoy1lpDelu s;s0 ruoxr io1op n net t sDumxronu4oee  fcilsls2rlnmpnt4trxrxo ootopt  n sls sexo(o nu1omtn nvs t aDur( p;o1tle iietad m2elnmpn(4arerio3oydfm e nei;( t2xoxm oy4olee nvta(f 2raum nu1opx io3tas s2ua(mp;(4alxnmf oy1lpD luvo t)sruoxrpnudame licta(f 2rrum ;o0tlx mi3ilt sDrl( onu0 lermo3oodfm  luei ( teurxo ou1lmt licslsfsrra(r nt1aptoifeiytlm rm( s u) leoio3ta1opDraieo;s0s2umimpiu4altelnviat aDraxm nu1ope miciydla2ulu pnu0arxrxf to1fmDe nvs ()srtmxopno1apenmietas  2rmx  oo1altoioeiytlm elnvs;t0tlenmo3oadlp  lueo s) exmio io1olenlneiat)sDrr(mp;o1tetomoeilsfmDeanvont) leoirctatopD lieo t  exo(mpoo1op elieiatfa2raxr ;u4tpxn ocildfmDemn p (4 etnxo3ootoptean i;t0t2xr(o3iodll emnvtlt)s2rrxm ;o1teenif3tadfs ulump;()arxnio3totlptraivil() euoiopou4lpeelictasfsDrr(r oo1tpxomociat m um(mp u4 exrmr3oy1omDelies;t  rxr(rpny1lpe  nvs s)aDumuront0tpxn feiytfa rmn o u4 leomrciodla   nvs;s0teto(opoo4oleelivs (f rurx pot1opt  o3iytls em(mp;(4teerircoodfpD  uvo t0 2to(r oodale lnvs s)srtmxm oo0ape mfctad a2rlnmp;t) exoxf3to1oa   neols teuo(m nydlm emncsas  rtmxmpoo1oetn fcilsfaDel(mpn(4treomf tatomtrluei;()teuoirpoudlle mneia( srra(mont4tetn oeiydlm elu p t4 eerxr iodoaDeau sl(0seuoxmpnudllenmnvtat) Dtr(mo;o0aeeo oetad m eau pnt)teeoifctydopteaivo s0teurir nodaleelnvil()arumumo;o1tltnmociatfs2elnvsn(4 lxnmf3oydfptrlu sl( trurxm3oodalte nesasfs2rmxrpou1tlt  f3iysfa2uanvont0 ltnxr iadlpt aueo;t0 2uoxr iu1lpeelfcsat s2trur ;o0tlxomieiad a ea(mo t)aetrxf3todomteln slt0srumimpnu1op   net (f 2trx  ;o4oeenmf3iltls2uau p u)trxoir3ia1fp  luvi;(0seto(opiy1amtnmfesat)artmxr ;t1aptnmoeiltfa2umumo (4 lermr iy1fp   uvsls)t2xr(o3ny1lle lfetat)srrmumonu1oeeomieildfa2uan p u0alenir oydlaD  ieo t)trxr(o oo4lpenmivtlt  2uau oou4openiiciyd mDelums;(0alermo3ia1lmDelivslt0s2urxm3oy1lpe lnvs ( s2ur(m ou1altn i3iyt mDumump u0tetrmfciotlaD anvils s2xrxo3oy1lpe lnvt s)a2tru o;u1oet moeiatlsDra( ont4areoif iotomteai sl() rtoxr3oy1omenlietasf Dtau  nu1tpeomo3ils s2ra( o (4 lxomrcoo1fpDeln i;(  etoxmpiudlp n nctatfarta( o;o1ope  fetldla rl(mo (4aexnxfciy1fp r ieolt0 2urir oudoltnmncsas) rrmx ont0tetnmfciydlmDeau s;(4altnmr tytomDeluvs s)srtmiopou1ape  fetl()a2ur(r oo1tlxo octasfaDel(mo (0aetnifciotfm  aivi ()texm(rpnu4omenlicil(farrrur ou1tpx moeilt mDuanmo;(4areomrctodomtrlnei;t) rur(r3ou1optnlncs tfsrrrxrpnu4alenii3tltfaDeluvsnu)aetoir3iodfate ueo;t0srxrimpiy4om n fesls  2rrxro;t4apxoio3ilsfmDra(vs;()aetrmf iatlpDrlivo s) exmir3oy4olt liet t  rtr(  ;t1oleo ietys mDua( s t)tltrmf3iadlmtelnvsls)s2xr(rpoo4lmee fvs s sruaumono1teeoifeiysfs2emnmo;(4trxrif tydfpte n s s)srtrxm oo1ol  mics () 2uaxrooo0apt iieiadfa ea( s;t0 eeoxr tydlpD ln o t) exrio iudapt mivs s  2taurpno1ope  ietysfs2el( snu0treoxo oatopt auvo;t s2to(r iu4optemnvtls) Dtmxmpoo4aeeo i3tldfs2ra(mon(0 renio oytopD auei;s0s2tr(r3nu4omee ietlsfaDtmu pot4texoif3taslaDelumsn()arxrxoctotfm   nvilt)tetoiopnudlptn nvsas)s2taxr nu0oexnmfciytlsDrl(vo u4tlerxrciodomtr nesls0t2ur(r3iu1alee feia( arrax  ou1tltnifeiyslm eauvpn(4tltnmr oydfmD lneols  rxoir iydaptemnciltf 2rrur oo4apeo feiltfs rluvp;(4 ltnxocto1fmD luesls teuoxmpnodame livias  rtaxm ot1aeen fciaslaDranvs (0teermrctatomtelieols)s2xriopiu1amtn ietls)a2ta(mp;t4aleo fcildls2ul( o;t)teermocoadlmtr iei;t0 etrim io4omenlfesat  Dtaumo;u0opxoio3iysfa rl(vo;t)tlxrirciadlp r uvi;t)teur(o3ou1alt  ncs (  rumx pot4open ieiat m rluvpn()aleomoctydfm elues ()t2xrxmpoy1ole lieils aDtmxr no1aetnmf3iydlm rl(vo u4texrxfciytlmD lueo t0s2uoir oydaleelict ( arta(m no1apxo f3tadfa2el( p;(4alxomocootomDe ues s teumxmpio4lm  liesa()a2tauro;t1aexo f3tys s um(mon(0 rtnmo to1fpDelnvs;(0trtoimpoy4olenmfct ()aDrmxr nu0apeomfctlsfm rlumsnt)trxnif oatoaD  ivslt srtmimpno1lmtnlfvias sDumx ont0opxoioetad a emnvs;t) ltoxf3ia1fm raneslt) 2umxo oo1lme lfcsl()a2raxr ;t1aexo feiyd a2emn pn(4 etnxo3oatoaDelivolt)teuo(r nu1am  mieiasfaDrm(moot1tpxnmo3tyd m ea( pn(4alxrmfcoy1lm elnvolt  2xo(o oodlle lfcs t) 2tru  oo0teenio3tat aDeau s u)tlenio3oatfmte nvs;( texrxrpiydome lfeil( sDrm(rpoo1tetoiiciydfmDrluvo u4arermf ootomDrlnvo;( seuoir ny4openmnvsl()arrm(  ou0apeoiietatfa2raumo u)arxrxrctotfatrluvi;()t2toxrpnydlp elfct s)s2taxmpno0optomfciadfsDelnvonu4 lxrio oodlmD  iei;( trxoxo oudolen fesasf rtaxront4alen f3tydfsDranmp u)teerxf3tydla raues t t2xm(rpou4ome livt s s2umxmpnu1alxo ieiatfa rlumpnu0texnmf3tadfmDrau s s  eumxm no1ap n fes tf rrau pnu0tpe mieilsls2umnmp t0tltrxo oa1fat luei t)s2xrxmpiy1lmeemict s s2taxm oo0tpxomieiltfmDea(vo t4aexrxf todoa rlneslt s2tr(o3oo1ap elncsl(faDra(root1optomociadfaDemn p;u)tlxomo3oatlptelneols s2tmim3ny4am e nvil( sDumu ooo1ape  fciatlm rm( s u4tlxoir ootlate ivi t0sexoxm3oudlmen icilt srtax o;u4aeeoii3iasls umnvs t)trxnmf oo1fateai o (  eumxm oo4aleemicta(f 2rm(mono0aetoiicias m2ea(mpnu4tleoxr to1fa  li s;t) rxmir iu4lle mfcsat)sDtrxmpnt4olxnmociatfm emu o;t)aetrmr totlmt luei;t) rumim3nu4llenmies s)srrrumo;t0tee ifeiydfm rmnms t)tetoir3iydlat aneils)s2trxmpoydlpee fct t)s2taxrpot4texnioeiadfaDrmums u4 ltoifciotop e nvs (0t2xo(mpiy1ope lfeils  Dtrum ot4alenmocilsfa2rl(mo () etoifctytfm rluvi s) euoim3ou1apenmiesltfsrua(r ou1oeenmf3tysfa um( s u)alxnio3to1fp  aivo;t teumir3oydoptnliciat  Dtau oou0tetnioeiltls umums;t4texnxo3oodoaDrai s;t0s2xmimpnydap e fcsat)s2umu  nt1apenmi3iltla2uau pnu0areoif3todlate nvi s)t2urxopnu1llee nviltfsruaumo;o1aptn f3iysls2emumo;u0tltrxo3to1oa raueo;( trum(o3iy4lmtnmieils aDtaxmo;u1apt mieiyslsDrm( pn() lxrxf3oy1fpt luvols) rxmirpnu4openmnvi t)sDrax o;t0aexnmoeiys a2emn p (4arerxfcoy1oaDeaneo (0tetr(o oodlmeemneia(f rrmxmp;u4olx  ictyslsDumn snu4trtrxr oadfaD luvs (0srumxr3nodopte ieil(faDtm(  no1olenii3iasls2rlu s ()tltrirctytfaD  iei () 2xmxrpoy1al elnet s  Durur ot4tlxomo3iatla ranvont)altnmr iytopteluei;t0 rtr(m iu1lleemfcsat)a2taxr ;o0tlx  fciytfm2ra(mo t) lxnifctytoptelnei () 2xm(m nu4lpeelfes (  2urx  nu1tlxo octlsfa2eaums t4arxrir oo1lmte neo;(0 2umxo nodlle  ncsas) 2urxmooo1aetnmf3iat aDrmu p t0artomo oodfpDrlieslt) rur(m ny4omenmfci () 2urum ;u4tlxoiocilsfm2emn p;u4trxnmr tatomt au slt0 eur(m ny1optnmiet tf rurxr no1apenifeiydlm2rlnmp (0arerifcoadfat lueols)s2tm(opou4altemneil(  Dua( ooo1opt iociasfm eln o ()tltnmoctydfpDran o;(  euo(r iudll n nvsa()artaum nt4teeoiociyd sDumums;(4texrmo oydfmtr uvs s t2tr(rpio1ol nlfes s arraum no0opx  ocils m2ra(vsnt)texomo3oytlm eanesl(0 eumxrpno1ol emicslt s2taxm ;t1aptnmfciys aDrmn p u0arermrctydlmtrai i s0 2tmio3ny4ol elicil(  Drm( pou4teen fetldfm2ea(vonu4tltomo iotom r i ilt setrim io4op elies ( aDtmxm no4optn oeiadfs eluvpnt4alxrmoctydfmDe ies;s)s2uoxo no1am nmivia(f rtrxrpno0apenioeiadfa2rmu s (4altoiocoo1fmtrlues ()t2xrimpoo4lp emieilt) 2rru  ou0alto oeiysfs ulumo ()tlenxocty1fa   ieo;s0 ruo(opiu4lm  lnvi s a2ur(r no0optoifctaslaDuau o;u4arxrmociodfat an sl() etrio3ou4omeeliet s srurum nt4teeomociyslm em(mon(4trxrxrcia1lmt  n s s0t2xrxopny4op n net (f Dur(m no0olxnio3iasfsDra(mp;(4 rxomfcoo1fm e ivi;(0s2toxr3ou4omtnlictatf Dtmumo;o1texn feilsfa emnmonu4 lxnmr ta1oaDeaues t0sexmiopou1apee iei ()aDrau o;o4ale mfciytlm2rauvpnu0 exoio oodlpD ln olt truoim iu4ol  mnct sfsDuaxmpno0oetn f3ias mDumnvs;(4trxrxrcoytlat ln s (0trumimpnu4openmfeilt)s2taurooo1tlxo ocildfs ea(vpn(4 etrxf3ty1opte ivi ()trum(mpoy4op nlfctat) Duaxrpot0oexnii3tyt a umuvs t4texnmr3ia1omtr uvsl( srxoxo oo1lpee iei (fsDrr(  oo4aleniietlsfa emn p t0aeeomr3iotop ranvo ( sexrxm iodolte fct ()srtruro;o4oee ifeiadfsDranmpnu0tltrxocto1lmDelivs;s)s2tmir ou1ame mnvtas)a2uax o;t1aptoifciysfa ranvpn(0texnxr tytom r neo;(0 euoiopnodlltemnvtat  2rrxrpnu1aeenii3iasls umums;t)artoioctodoa   u i;()s2ur(m nydomt  fvi ()sDtr(m no4teeomi3iysfs rm(vp;t0 ltoxr3iy1laDe ies;( texm(rpny4lleemnes s) rrax pou1tlxnmo3iydlm uanvp;u4 rxoio iydfaDran ols0teuoxmpnudlpe licsa(fs2raxrp;u1ape  ieiysla2raump;t) rxoir3ia1lmDe neslt  rxrxr3ou4am  livt t)srtru pou1alt  ociadfsDeau o u0 rxniocoa1fa e n il() rto(o iudap n icsl()aDumxmpno1oexo octysfa2ranms;(0tlenxf tydlmD lu o;s0seto(mpoodal  lfvt t)s2tm(ro;t0aexn ieiad m2ulu snt4 exrxo totfpDe n o;()texmxr3ny4lptnlivi s) Drru p;u4tpxnio3tys mDrau snt) rtoxr ia1op r uvsl()t2umio no1am e fvtasf rurx  ;t4opxomoeild a2emump u4 rxoxr3oadfmDeauei t)s2ur(r3oydlme  iviat) 2tr(  ;u0ope  ieiltfm2ul(vp t4alxrxo3oytoatrlieo;t) exmimpoudamenlfvia(  Drr(mo;o4tpx  i3ild a ea(vo (4arxniocto1omD  ivsl(0 2uriopiudlle mivs s)arurxmpno0alto ocias s2el(mp;(0aexnir ootlmDeliei;s tetrxmpoo4lp e ici (  2tru  nt4oetomi3iyt s2eln p t0alenxf3oa1oatraivsls0seur(mpou1amee fvs t)srumxmpoo1aee  f3tytfs rau o u4 rerxf3ta1lmDeau i;t sruo(opnudoptn ncsls)arumurono4tpx mfetatfm umn snu)aeermf3iodoa   ivo;s s2xrxopiydole lfvtat aDrm(m no1tpx  f3iasls2rmu s (4aeenmfcootlp  lies;t)s2uo(rpoudlpt lnvta(faDrmx ono0ope  fcildls ra( pn(0aexoxo3oy1op eaivo;(0 etrxm iudaptelivsl(f rurum ot4oltomi3tldfsDrauvp () ltrio iotom rlivi;t)srxrxopiu1omt  fct s sDumxmpno1tltoioetytfsDuauvo;()tltnmf3oy1omteaueol(  eurxr oydam n fetas s2trxrpnt1teen i3iyslm rluvs;u0tetnio oadfpDrai i t  2tr(mpiu1al emfvt tfa2taxmo;u4tetn o3iasfm2rm(ms t0alenir oa1om  aiei ( s2um(mpno1amt lieiltf Dum(root4oex moeiad mDrmumo;(0 exomr3to1om   ueilt tetmxo oy4lpte ivtlsfaDuru  ;o1olt iociydfa ea(mp;(4tlenxo tatop e uvsl()t2ur(m no4lleemfvs tfs2tau  no1apxnmi3iaslsDran snu0 rtnmr iotfm eln i s0tetoxo oy1lpe mies ()a2ra( o;t0oltnmoeiasla2rmumpn(4treriocoydom elues (0trumio3oo4ol  livt ()s2trx o;t4apxn oeiltfm2elnvp t0 rtrxo io1lat  nvo (0s2to(o iudaltnlies tf 2rr( o;u0oleo ietyt s uln sn(0 ltriociatlpDrliei;t trtrio3io1ol n ivslt)aDta(rpnu1texoio3iysfm umumsn() reoifcto1lmDelieols setoxr3oy4ll  mnes t aDraur ;t0alx  iciydfmDel(vs t0tltrxo3to1laDr i s;t  ruoio3nu4lle  iesls) 2tr( ont4aee ifciltfm2el( p (0 ltnirciotfp rlnvols0s2urir3no1al emnvsat)srrmum ;u1oeeoii3tls m uaumo;(4tlxniociodfptelnvilt s2trio3oo1am emnvi ( sDrm(mono1aex iieiltfa2rmn s;(0altoir3tatfmD  ieslt0 2um(m iu4llt mnct t srtmum ;o4oltnifeiytfmDum(mp (0altrmf3oy1oat  u i s)tetr(o3oydameelivsl() rurxm ;t0teto f3tldfs2ra(msnu4 lerir oytomtelu s (  eto(opoydlp  mfei t  rur(r ;t4aee  o3tydfa2emnvp;u0aetomoctatoaD lneo;s  euoxo3oy1optn ivilt)srtmxmpnu0olx  o3iytla emump u)alerif oydla e u i s tetr(o io4lm nmivsl()arum( pnu1oltniiciadfaDem(mp;u0aleomrcoydfate i sls)tetoim nodale  ivils)arumuro;o0alx ifetyslaDeluvonu0alxrmo3tytlp rauvo;t s2to(opiy4amt  ncilsfa2trurp;t1teeomfetatlsDean pnu)aetrxf ty1oa eli olt0 etoirpio1olte net s a2raumpou4teto f3iytfm ea(monu)altnxr3to1lp elivo t) rto(o3oydopte fvi ()srta(r ;t4optomociat a2ea(vs ()aexrmrcty1lm   ues;s) etoio3iu1apeelncils) 2umurpnu0teen feild s rl( o;t0 lenmrciotfptrli ol(0teurirpio1ap emfvsa(faruru  ;u0ole  oeiad m emums;t4 lerirciotlaDrai sls)s2xrxm iu4aptnlfet t sDtmur nu4altnio3ilsfa rauvont)areomr to1fp  anvs (0trtoxo iydome mncs t) Dtaum ;u4tlt  ietat s rluvont4altrxo ta1fpDe ues t0sexmiopoy1lpenlneia() rra(m nu1tpx  octadfaDemnmo u0alxnmo3iatlaD auesl(0 rurxm3oo1amt mivi s)sDuaumpnt0oltnioctatlaDeau s t4 rxrifcoatopDeli i s)trxoxo oo1lpt mnvia(f rtru  ot0tlx mictyt m emums u0 ltnxfcoo1lm e uvsl( t2tm(o nu4op nmfei t a2ua( pno4oeeoif3iasls ra(ms t) lxoif ta1lpt au i;(  rxrxr3nydll   icslt)aDrr( pno0tpxo oetltlm2el(ms;()texrmfciy1opte u i;t teto(rpio1lp eliesat)sDtmx ooo4alxomfciysfm2elnvs;t0arxnxr tytlp rluvi t  etrxo nodopeelnct (farur(roou4alto i3ias aDrmu onu0 rtnxo to1opDrluei ()setrio no4altelnetatfartaxmpot0ale ii3tlslaDuau o;()trxoxr oydoateai sl() 2xr(o iu4lmtnmiesas  2urxmo;u1aetnmfeiytlm umnmp u4tetoxfciatoateaies;s trtrxopoo4apt lfcsat) Dta( o;u4ale mieildfm2rmnmsnu) rermrctatfm  ln o s truoir nudalenmfcsas a2trxroot0olenmfeiadfmDeauvpn(0 lenir ia1lptraueilt0teto(r3oo4lpenlies (fsDum(r nt0tltnif3tls s ulnvpnt4 rtrifciodlmte ivi s  etrxmpnudole mivsa(  Duax oou1oltn oetadlmDran p (0altoxf3oadfaDraivil(0 etoirpnodlleemieia()srum(rpot0alxomoetydfm2eluvo (4tetomf iy1opD  nes;t)truoxo3nydam nlfesa(fa2tmx  ot0apt iiciltfa2rauvp;u4trxrifciadlpt lnes;s)s2tmimpio1omtnlfct t  2truro;t1oltnif3tltlm2rmumsn(4 rxomoctytfaD an i t seuo(m io4ol e ncta( s2trxr ot1olxnif3iat s2rln p t) rtnio3oo1laDeln s;s0 2umiopoo1lm e ivta()aDta(rpoo0olxoiieilt m2ulu o;t)aexoir iodlpteai olt0t2xmxm oodlm nlies tf Dtm(rpnu1tlx mo3tls m rln o;(0alxnxo3iytfpD anvo;s)trxoxrpoodop   fcilt sDrrx pou1alen ictldfa2eauvo ()aexnmf3ta1opte nvils)trumim3iudomeemfctls srur(m oo4ope  ocildfm ua( p;u0arxniocio1oateli ols t2tmimpiu4amt lfvils  2ur(rpnu0opt mfeiasls2emnvon(4 etrxf tadopte i o s t2ur(r nudam   ieta( aruaum ou4ole  i3tat aDumump;u0arxoxr3todoa e uvolt truo(opiu1ll n ics sfs2uaxmpnu4apxomf3iatlmDeau o t)altoxo3iadlm eauvs;s0sruoxr iu1op e fesat srraxr no1alxn ociysfs uaump;u4 eerio3oy1omt  n olt0trurxmpio4optn netas)sruaxr ot1olt  ictlsfaDrmu o (4 lxnxr todopDrauesls)texoxr no1amte fesas s2taxm ;t0tptniociyslaDuanms t4aeeoxoctatlpD liesls)trxr(o oudope miei tfsrrm(rooo1opxn f3tatfs uanms;u4altrif3ia1fmDrluei s) euoio iy4ol  mfesa( a2uaur nu4texnmfctysfm umnvp;(4 eenir3oadlp rauvils s2xm(mpoo1llte fcs t) Drmxmpno1tle  fctltfsDul( pn(4 rtoifctytfat lu o t  2xoirpoo4om nlieslt)aDurxm ;t1aleomiciat s ra(vo;(4trxrxo io1fmDelueo t  2xr(mpnu1ale mictat)sDtmx  no4olx moeiatfs2ulumo t0 rtoxr tytfm   ieols) rtm(m iu4lmenmfvs s)sDra(m ;t1tpx  fcilsfs2rmnmsn(0alxriociydfp r ies;s0setrxmpoo1ameelfcsltf rtau  ;u4apxnifeilt s eanvpn(4arxnmo oatlpDelieo;t)s2urxr3nodoptnmnes sfsDtr(rpou4olxnmieiadfm2rmn o t)aleoxociodfa  ln sls)texrxr3nodoltemnetls s2urum ot0oeen f3tys s2eln sn(0aetrifcoo1fpte ueo t t2xr(o iy4optelnviltfsDuaum ;o1tltniocilt a emuvs t4arxoxo tytlpteanvi (0srxrim3ny1llte iet (farrm(ro;t0oeen feiadfm2rmnvpn(4teeoxo3tytfpt ln s t)s2tmxmpoydal e iciatf ruru onu0aeen octytfa ulnvs;()aexrmfcoadfp raieo s)teur(rpoy1lmtelncs () rrmurpot0tpe mo3tldfsDrlnvonu)tltnif tytopteanvs;( t2uoxm3oo1ap emfcilsfa2tmumpnu1aee iociat mDul(mpnu0 lxomrctadfat lnes (0 2umxo3io4oltn fvt ()srtrxrp;u1oex mfctyd m2ea(mo t4teeniocto1fptr ues (0setoirpoydlp   nct tfaDraum oo1tpt mfciltfm2um(ms;t4tltnxo oydfa r nvs;t)s2tm(mpiy1amt lnes t  rtm(r oo4tptn ictyd mDulumonu0tltnifctatopD  uvi (0 exrim3ny4omen nei ( s2trxmo;u0opxomicildla eanms u) exnmo3tatom raiei (0 2xrxrpio1ole mnviasf 2tr(m ou0aleo ietatfa2rl( p;u0tltnxf oydomDr n slt)t2xmiopiu4aleemnvt sf rtaump;o0alt iietat m2el(mo;u0arxrifciadoptrluvs;s) etmim3oo4ame mfciat arurx ooo4tetniietls m ra(mp u) lxoio3todoa r u o;s t2ur(o3ny4al elfes sf rur(mp;o1alxn iciysla ul( pn(0tetrxf oydlmte n o;s0srumxr nudolee nvsls) 2tr(mo;u0tlxn ietld a2raumonu0tlenmo iy1oaDraies t)teuoio no4ame  ncias)sDur(  ;o4oetn i3tas s ra(vo;(0arxnxociydlaD luvi s  2umxo3nu4ll   fvtl(fsDuau  no4aet mfcilt sDrlnms;u0alxrio tatoaDraueo ()t2xoir3no1ame lnvtl( srtrxmoot1ole  fctld m2uau p;(0 etomf ta1fa  aueo;t)truo(opnu1oleeliciatfarrrxmpou0tlto f3tydfa2elumon(4aexomr3iadfp   i o t0 exr(rpoodapen net t a2ua(r ou4openmfeildfs em(vp u4teenifctytlmt  ueo;t teuo(r iy4om nmivi t  Dumxm nt0oee  ictadls emuvs u)trtnio oo1lm r i i;(0trxo(m no1amen fetatfsDtmu  oo4tleoio3tltfmDul( p u)trxoxr3ia1oaDelivi;(0s2tmxr iodome lfcil( s2ua(r ;t1optoif3tadfm rau pn(0 rxnmr oo1laDrli sls)truoxopiu4ll   ics t sDuaurpnt0tleoiieiat m2ean o;u) rtrir ia1opDelneils0srtm(o3iudaltnlnci (fsrraumoot1oex iiciytfa ulnmont0 lxomfcty1omDr uvo ( s2uoim oy1op  mfesltfaDua(ro;t4tetoii3tytlmDrmnmp;(0altrir3tadopt livs;s0setmxmpoo1olt  fctlsfa2rmumpnt0tltomfciydla umn s u)tlxnmf iotlm e iei s)setrimpiy1opeelfei (f rra(r nt1aet iociydfs2uan onu0altomociytomtr uvol(0s2xmirpoydllt mfvtlt)srrr(r ou1oee  f3ildla2ra( snt) rtnif3tatlmD an o ()t2umim3iu4aptelfesatfarumum nt4optnmoeiatfs raums (0texoif tytoate nei;s) 2trio ou4omeemicslt s2rr(mpoo1openmiciyd m2elnvs;t0 eeoif tydlpt  uesls setm(o oy4amtelicia( a2tr(m ot0teeomietas m em( on(0 rtnmoctydlateauvi (  2trimpiodlme  nvtls)a2ur( pot0tltomietasfa uaums t)aeeomocia1oat ai sls  2xoxmpoodamtnlfet tfs2rm(ront4oexoiociyd sDrl( sn(0 etnxf3iydfmDrlivo;s) rxoxmpio4lme miesas)arrm(mo;o0oexomo3tatfa2uan o;t0tetoxrcoatfpt aieo;s t2tm(m3nu1ll emncsl( s2uax pnu4olxoiocias m rau o u)altnxrcoatlptean sls tetriopiu4ame licias  Drr(mpou1alt mfeiys s2ulu p;u4teerio ootlaDr u olt t2xoim nu1opt lici tfarraxm no4alxo o3ilsfa uanvs u4tltrmocio1faD lnei s  exo(m nu1ale lncs sf 2rm(rpoo0tptn iciyt a emuvs;t4alermf3oadla rlnvo (0s2tr(r3no4am nmnetas) Dtrx pno1tpto i3tatlsDel( o;(0altnmf oadfmtrau i;t0trxmir3nydom emics () Dta(  nu4tetomfetas aDeau pnt4arenmr ia1latranvsls)trtrxr3oy1am e net t  Dur(  no1alt moeiyt s ul( s u)altnxfciodla r uesl(0 rtrxopnu1al elfet (faDta(rpot1oeeomfeiysfs2elu s;(0aeeomrctytlatelivo;t)sruoxr nodlmteliesls) Dtmxrp;u4tpeo i3ilsfsDrm(vsn()tetniocty1lmDraieslt  etm(r oudam emnvia( aDum(mo;o1apx  iciaslm2emuvp;u0aeeoiocoatfpDe n i t t2tm(o iudoleelfvil(  rtmurooo0alen i3iat aDelu s;t4teeomo todfaDe n il( s2uoimpiy4amte nvtat) Dra(rp;u0oeeo oeild s uan s t) eermrcoa1lp r uvi;s s2tmxmpnu4aptnmnvi ()aDtr(ro;u4olen ieilsfm2ua(ms t0tetnmf tytla eauesl(0 eurxopio1ol  mfeiatf Drm(mp;u1tetnioeiasla umnmp u4 etnmf ia1fp r i ilt0 2xm(opoudape mnvi s  2ua(mpot4olxoifeiys aDeluvpn(0trtnif3tadlateauvo;s)trxoimpou1lpee nvtl(fsDrmu  nu0alenif3ils a2ul(vp t)teeriociodlmDr ivs ()srxriopnu4am   ncilt) Dtmurp;o0aeeomoetlt m2rmn on()aeeomf oadoa e neo t)sexo(o nu1lp   ict t)aDrm(mpou4aleomiciyslm uanvo t4tlenirctatlmt lu i;(0 rtmxmpny1al  mieias  2tr(  nu1apxomietatls2ra(ms t0aeeoir ia1lat luei;t) rtmiopny1ole mncs s srrrxm ;o4tex  oetatfsDrln s;u)alxnif oodoa   uvs;( t2trxr3iy4ap n nvs t)srrmxr oo4tlxnmieiytfs ea(ms;t)aleoxf3tydlaDrlueolt)t2uo(o iu4omenliet t)sDta(ro;u4oet mociys s rlnmo;u4tlenxr iytom rlieo ()teuoio iu1lp n ieslsfsDtaxroot4apeo ictltfaDul(ms t) rxnmr oytfaDran i ( s2urio3nu1ll nmfcs t)s2rmx p;u1aexnmiciadfaDra( o;u0aetoif iodfptr ueo ( srtmxr iy4am   fvt tfs2ra( o;t0aptnmf3iltlm2rmnvs;u) ltnifctydlmt  nvs s) 2xo(mpoudllee fci (f Durxront1apenioetytlm emnmont)trxrmf ty1fm  anei;s sexm(opiydopt mfes t artau  ou4tlto oeilsfa2uln onu0tetrio tatlpteanes (0 rur(opny4lmenmfcil(fsDrrxrpot4aptn ociasfa2elnvs t)areoxf3iytom  lueil(0 eumir oo1om n ivsls sDur(rp;o1oet mietatfs2uanvonu4 eermr3ta1lmtrai i s0 euoir3iy1omt lnvta( srum(rpou1tltnmociydlaDem(msnu4aexrxfctadfm  luvs s) rumirpnu4am  mivi ( a2urur ot0texomi3tas sDrln p;t4alenxo3iadfm eluvi s) etmio3iy4omenmfci tfsrrrxronu4olxoiociys m em( p;(4artnir3oo1oatrlneils)trxo(o oy4lmenmivilt) 2uaxmp;u0tltniiciys aDulnmpn() eenxrctytlpD luei;t) rtmxo3iy4ll nlnvslsfs2uaumpoo4oet  octlslaDel(ms;()aexniocta1faDrau sl(0s2xmim no1ole  ies s)arur(mooo0aetnifeiaslmDel(msnt4tetnmf oodfa  luei;()trurxr3no4opte icilsf 2ta(r ;u0aet  oetys m ranvpnt4 exoif iadlpDeluvs;s)tetm(m3oydll   fci (f Dtrxr nu1oltn octatlmDranvsnt4artrxf3totopt ai i (  exm(opoy1lm   fviasfs2tmur nu0opx mfeilsfm ra( s ()aeeomfctotomtelneo t)s2umio3oy4olt miviat arumum no1oeeo fcild m ranvo t4 lxrxo3oo1lm rli il(0 2xrxopno1llt  nci ( artm(mpno0olen o3ias a2ulnms;()aexrmr3ty1op rluvilt trtmxm3oy1alee ivsl(fartaxmp;o4teto oetyd mDuanmo (4alermr3oadfate neo;( t2tmxr iy1op eliciatf 2ta( o;u1aptomietad mDrmump;u0 eenxo3ty1lp eaivsl(0 exriopio4lm nliet s)sDtrum ;u0tltomi3iytla um( p t)tlenirciotfatran s;s  euo(m3iy4llenlieilsfsDtm( p;t4opt mfctatla2rm( sn(4texrir oa1oa  auvi s0t2urxrpiu1omeemicils)srtrum ;u4aptoifciydfmDemums u4tlenmo ia1oatrai ol( sexoirpny4lm  mnctl() rtm(mpno0aet iociatfm eau p;(0 exnmr3ia1fpD  nvo;t)teuo(m nodoltemnct sfaruaumpnt0tex iictltfm2el( o t4arxomo3oatlat  i o t0 rtr(o3no4oleelfvtas)s2uax p;o1optomociad m eanvs t4aetrif3io1opDr uvs;t0 2trxopio1optnlfcilsfsrtax  nu1tpeniictadla2el(vs;t)trermf to1la  aueil()teuoxm3io1oltemncsl( srtru onu4alxomictas a2rm(vp u) rerif3oa1opt lnvi;t) exoxr nodal e nvs s  2umu  ou0tpe  o3iasfmDelnmo;t0 rtrio tydlpt  uei (0 etm(rpio4omeemnviat  Dra( poo0tee  o3tatfm2ranvp;u4arenmfciatfat  nvo ( srto(o nydape mnctl( aDrm(mp;o4optomi3tat a umnvpnt4aetnmf3oadlpDr uei s)texmirpny1op n ici s s2taum ou4tlxoii3iys mDeln pnu0teeoxocoodoa raivo t0s2xm(o3iu1optelnct s  rrm(mp;o1olxo oetat m em( p ()trerxo3oodfpDrluvs;s) 2tmxm nudop   ncslt sDtr(  ;u4aeeoiieiysfsDean p;t4 eeomfcootfpDelnvils)trtrir iu1ale lfetl( sDuaxrp;t0texoiietasfaDuanvo t4arxoxo iytlp eluvo ( srur(m3nu1llenlivi t sDtaumpnu4ape mfeiatlm raump t)tltrmf iodlaDeluvsl(0 2tm(r3iu1om n neiasf Dum( ont0tee  i3iasla emn pnt4 ltnio3iydlmt aies t t2toir iy1lpee ivs s a2uaxro;u1aptn fciyd s2uanmsnu) rtoxr3tydfp ranvslt trtr(m3iudolee ici ()s2taxrono4tee iieilsfs2um(mo;()artomf io1lmtranvi;(0 rto(rpoy1ale  fvta() 2umur ou4tlx mf3iat a2ulumpnt4 eenmfcoatoat li s;t)trurim3iy1amee ieiat) 2umumonu4tleo ieiad sDrluvo t4 ltoxo3tydfm elnvs t tetrxrpiu4ame mivsa(f rur(ro;o4tle  fcils a2ra(ms t4 leoiocty1opDr neils)texrxrpoodaleelici tf Drauro;o0olx mo3iaslsDemnvs;u) ltomociotlpD luei;(0 ruo(m nu4ll  lietl(fartrxm ;u0oleoiiciyd sDemu s;(4tetoxo3iodfp e uvi;s0srxmxmpiydlp nlnvsa(f 2rr(mo;o1altoii3iltfm2em(mo;u) rxnxo totlp  auvi (0tetoxo iy4lmt livs t)s2rrx pno0oet miciadfa rmuvsnu0 rxrxfcty1fmt an slt)t2xr(opnodamtelfvta() 2raxmo;o0alxomietldla2elnmpnt)aetnxr3tytlaD luvi;()s2urim no1apee nesatf Drr(m ;u0apt  iciyslm rmu o;t)tltriociotlat  i o t  rur(o3iodlmtnlivia( s2rrx  ;u0opxnifetatlaDuln p t4aetoioctadfm rlneilt0 etmiopiudapte ict sf 2rau  ;u0tpt  fetatlsDua(vs () rerio totomD au sls)t2toxr3iy4lpenmfvtltf 2ua(ro;t1tpxo f3iytls2el(ms u4arerxfciydlpteli o t0t2tmiopiydllenlfci sfs2taxm nt1oeto fciltla ea(vo;t) eeoxf3iotoptelu ols0teurxmpiy4ol n nciasfartm( o;t0tle mf3iyd s2uanvp;u)alxnir3oydom   ieslt  exmir3iudlptnlieiasf rum( pnu1oex io3iytfa2rmnvo;t4 lxrio iytomtrln i s0setoxmpny4ll e ict sfsDtaurpno4opt  i3ilsla2rln p (0arxrmrcoadlm rlivilt)s2umir3iu4am   fvtas s2uaxr ou0oexnmfetlt a2rau o u4alxrxocoatla rlnvilt t2tmiopny4apenmfvil( a2ua(rpoo1aleo iciatfs2emump t)artrif3oytlmtrlies;()s2tmxr ny4lmt mfvia()sDtaxro;t1oexoiicild a2emnmo;u0 lermo oatopt lnvs s0 rurxopnu4lmeelivtltfs2raxrooo1oeenii3iat m uln s ()aetomocoytfptrlu ols0srumir nu1ale lncsls a2ta(mo;t4oee io3iatla2em(vs ()trxnxr3tydfaDeln o t0 rumimpoudale livtlt) Dtmxmpnt4tetnmi3iysfm emn sn()tlenmrctotomteaivi s0trurxo3ny4op  mnvsas) rtrxmpnu0oexnmo3iadfsDemuvs;u4tltrio3tadlmDr ivilt0 rurxopoydlle lfvsl(f rtaxrpoo4optomociatfaDrauvsnt4 ltnmo oa1lpD lueo;t  rumxo3iudopeelncsl( arrrumo;u0altoiiciytfm ea(vpnu0teenmo ia1omD  iei;( t2xo(opoy4amtnmfeils s2urx o;t4opeoiieildfm rl(ms;u4aetnmocta1la r ivsls0sexoxr nudlltn ncias)s2umxrp;o1tlt io3iydlsDeaums u0aeermo3iodfp ranesls0srxo(rpoy4altnlfetat  rrr(ro;u1tpt mociatfm ran onu0artrmo3tatlaDelnvo;( trtm(o3iu1omt  ncs ( aDururoou0tlt mf3iasfa2rm( p;t4arxnmocta1op rlies s0 2uoxopoydlmt mfvsl() 2tr(  ;o0aexnmf3tyt a2el( p;(4 exnmo3tytla  lnvs;()s2xmimpoydlpt  ncs ()s2raumooo4olxoif3iytfm2umu s u4treomocootfp eaueols)texmio3iy4lm emnesltf rtrxroou0tpto fetydfaDum(ms;(4artomrctatoa r ueol()t2xrxrpnodlmte ietls) Drrxr ou0tpeo oeiadfmDemuvp () ltnir3tadfat anvo (0t2tr(o3no4apt mfct sfs2raurpou0optoif3tad m2emums (0trerir tytlpDrli ilt t2xr(opoodomtn fei ( srta(m oo4tet iieiadlsDemnmsnu0tltnifcto1lpt aivo;(0seto(opny4ale mieta(faDtm(  ;u4tpeoiiciadls2eauvs (0alenxr iatlm ran i;t0sruo(o3nu4lm nlnvil()sDtrxr ;t1olenii3iyd mDuan s;(4tlermr3iydoa  luvils) 2xoxrpny4om elnvsat)arur(rp;o1opto f3tldfa raump;u4 eenmo to1oaDe nes ()t2urim3io1apenmncs s)aDuauro;t0opx mfciad a2rmn o (4altrxr tytlptrln i;s0t2uo(r3oy4ale lfcsa() rum( ono0tex  fciasfm2elu s;t0tlenmr ia1fat au sls0trumxrpnudam nlivi s aruaxmp;o4tle  fctytfm ea( s (4 reoxfcio1lpD aiesl()trtrxmpiy1apt  fvil(f 2rm(mpnt4oexo f3tlslm2emn p;t)artrmr3oydop eai o;(0s2xr(o3no1lm  mivs t s2rm(rpou4oltnifciydlsDuau p t4 reoifcio1lmte ueil( t2xrxrpnu4lle mfvs tf rtr(m ;o0alenmf3ild a emumo t)aetoxf3ia1la  lu s s  exrxo3ny4apt  fvi sfs2umxrp;u4aptoif3iasls um(vp t0aetnxf tadlmtrlnvi s0 etmir3no1ope mnes s s2raxmoou4apeo icildlmDemnmo;u4aexnxr iy1fp e nvi s0 rto(opoodop e ivsas) Dur(  no0tptomoeias mDuanms t) exrirctytlateluvsls)t2uoir3io1lme  ivtlt sDua(mpou4texo i3iytlm rau p (4 exnmf3iotfmD lnvolt0 rxo(o iy4lpee nctls sDuru poo1apenmf3ildfsDumuvs;u) ltrifctodla e ieolt0 2xrxr io4ol elicilt)s2tr(root4oexoioeilslm2rl(vpn(0aleoxf oodfaD aivs;t sexoio iy1lptelfvt s sDur( ooo1tetoii3iltla2um(vp;()alerxr3ia1omDeaiesls)s2xmir3ou1ll   nvtlsf rrr(rooo1aeenmiciyd s2umumsn(4 eerio ootfaDe ivo s)seto(o3no4ol n fesas srtau oou4aptnio3tatlm umu p (4trtoif3oatfpD  u s t) 2to(rpoudom n ncslt s2rruro;u4altn fciaslm2el(mp u)tltrio iatomDrli s s)teumimpnodlmt  nvias arumxmp;u0opx mi3ias s emn s;t4tetoxf iydomtr i i;(0 eumir nu1lmt  ici (fa2ua(m no4apeomfeiatls2eau p;u0tltnmr3tydlatr neol()s2xm(opnu1lm n ics tf rrr(moou1olx mf3ilt a2umn p;u0 rxrmfcootoa eai o (0 rurxo ny1altemfes s s2tmumo;t0oet  f3iatlsDraums;u0 ltoxr tatlpDraivsls)setrio ny4open nci (fsDta(mpnu1apxomfciadfa2elnvs t) rxrif todfm rau s;(  ruo(rpio4op  mics s a2uau  no4tleomo3ilt m2eanvp t)arxnxf3oydopDeauvol( texrxr ou1lp emnes tfsDumxrpoo0oex mo3iys m2ea(vpn(4 renir3totfmD  n s;( t2xo(m3iu4ol nlnvsa()aDtmx oou4opt  iciltlmDeln s (0 lerircoadfp eln olt  eumxm oodap  lfet s s2rr(mpnu1olen i3tldfsDeanmp ()trenxfctatfm r nvol(0t2xm(m3iydapeelnvils)srua(mpnt4tetomfciydfaDel( o (4trxrxrctatlmD  ues t  rtmir oo1ope lneil(fsDraxroou4tptn fetyt m2rau p;()alxoir iytlpteaneo;t)t2tmxrpnudamen net sf 2rax  ;u1tltnioeias aDeaumpnt4trerxoctatlp ranei;()t2xrirpoudlptelfcs t  rtruro;o0tlen fetydfm rluvont)artrxo oy1lmteaneil(0seumxm3iodalte ieta( srtrx  ;o1aleo o3ilsfaDra(vp t4teeoioctadoatr ivs s truriopny1lptn fvt (  Draxmpou1opxo iciadlm rmnmo;t0texomr totlp e ieo;() 2tm(o io4omen fvt t)srrr(r nu1texoifciad s2uluvp ()aetoio3tadoa eaueo;( texmxr3iodoltemfet s srua(mpno1olx  fcias aDelums u0teeomo3iatla eluei;s0 eurxo3nu1ale  fctas)srrr(rp;o4ole mo3tadfa elu o;()aetniocootlp   ieo s) etr(o oo4op  mfvias aDum(mp;t4alenmoetydls2eau s;u0 rxoioctatom elnei;t  etoxrpou4oltelnet t a2trxm nu1apx iieiydfs uan p;u0 eerio3tatfmDeau i s s2tm(m3no1lm nlfvtat  rtau  nt1aetnifeildla elnvo t) etnmfcoadlpt  ivi;t0 euoiopoo1apt mnesas)sDuaxmono4olxnmoeias m ul( s (4 rermf3oadom ranvs (0seto(o no4amtnmfvia(  2umxmp;u0tpxn f3tatfs uau o u4artnif ootlp elu s;t0s2xoim ny1ll emietltfs2tru pou1apen o3iysfs2rau p u4 rxomo iadlmDr nei;()s2xm(opoo4ap e icslt) rtrx  ;o1alt mociatlm2rau s t0arxomr3tytlm  an o s0 rxrim no1lmt mnviatfsDumum nu0tet ifctasla2el( p;t) ltrxf3iodlaD lnvo;()s2xoio iudalt lics (f Dtm(mp;o0aexomicildfs rlnmp;()arxrir iytop r u o;s  rxrio iy1ll  lfcsltfsDtrurpoo4tpxnioeiatlm ra(msnt0 exnmf tydom ean o;(0sexr(m ou1ameemnesasfa2umx pot1opt  ociydlm2rl(ms;(0areoio oa1lp eln ol( s2ur(r nudap   fcslt)arrrxrpoo0opxo ocildlm2rmu o (4aexoxo ty1oate ues s) eto(mpio1ole  fcs t  rtauroot0oleomietydfs rau pn()aetnif iotla rau i;t) eur(rpou1lmt mict sfa2tr(rpou4apxniieias s umumont)aetnir oo1faDe ueo;s  rtrxm3no4llt licia(  2uru  nt4olx if3ilsfa um(mp;()tlerxf ia1om  ln i t) etoim oo1ole mietas  rtr(r no1tpxomietatla2rl(msn(4arerxfcoo1fp  livo t0t2uoxm iu1lm  livtltfarta(mont1apeomictad mDumn pnt0tltniocty1oatranei;t)s2xoiopiy4apeemfes s sDua(m ou4teeoifciltla elu sn(4alxnxo tatfm   ivo;( srxo(rpou1amte fviat)sDra(ro;u1oetnmf3iad s2eln p;t0arermrcio1opDrauvil() 2uoxm3ou4ol emfcil()a2rrx  ;t0tlxnmociasfa rl(ms t) lxrxoctytla rauvi;t0 2uoxrpio4opt mfci sf ruaxmo;u4tle  fctasfsDrlnmsnt) lenmf3oodfptrau s;s0 etrxo ou4lle lict (fa2raxrono0aexoifctaslm um(mp;u)arxoxf3tatlmD lueolt) euo(rpnodoltn ivsatf Dtm(ront4tlenio3iad mDranmp;u4tltnxocoy1oa ranvi;s0sexoxopoo1alteliesasfsDrrxrpno4tet ifciltfa2elu s u4alxnif3totlptelivs s  rumxo3iy4amee iesas  Drmxr nt1tetomfctlsfs ea( o ()arenxr iodfatelneol(0seur(m iy1ape  fetatfa2rr(roou1tpen ociyt m2ul(vp;(0aetnxrctadoa e u sls0 eur(o nodop nlfct tfaDrrx p;t0texn fetydfa2rm( on(0trtrxrcio1lmD lu ol(  2umimpou4ope mncil( a2rm( p;o1tex ii3iyd a2emums;u)arerxrcootoptrauei;t0setmir oy1olenmncsas) rrm(m ot1oltomfctatfsDrmu o u0 exoir oydfmD  u s;(0 ruo(r3oodamenmietl(fsDurxr ;t1tee mfeiys sDeln s u4 rxoxfciadop r i i t trtr(o3ny1lpen fes tfaDtm(  ot0alenmf3iysfs elnvon() eermr ty1fmteau s (0t2toio3oy1lpenlncsls)srtaxroou1oetoio3ilsfm ulnmo u4alxoir tadop eli s;t texoxr3nudlm n ivias)a2ta(mpou1opto fctls sDulu s ()aetoiocia1fm elu o;s0 euoir no1lp n netatf rrr(r nu4oetnmi3tysfm2umn s (0aetnmo3ta1lm rliei t s2uoim3io4lle mfvi ()sDrax  no0aeeo o3iydfs2rm( sn(4tlxnxr iytlaD  n i (0s2xoirpnu4lmtelnvt () rrm( pot1tetoiieilsfsDra(mo u) rtrxf oa1fmteluei ( srxrxo3ny1op n fes tf 2taur nt0texomoeiyd m2eauvs t) exnmo3oytfp rlieils trxrxo3iodom nmict t)s2ra(r ou4tlt  i3tasfs2rmnmon()teerir tatlmtelivsl() 2xo(o io1ame mnesat s2umur oo4aptnmfciyt aDeauvonu4trtoxocto1laDr uvs;t) rxmir oy4llenmnvil(f Dtm(r no0ale  oeilsfs ra( onu) lerxf ta1lm  auei;s  rxm(r3nudlm   ivsa( a2trumont4opto oetas s ranvo;t4tltrircoydfmtrai s;s) 2uoiopiu1ap nmfvils s2uau pot4tpt  o3tydlm2ua(vs;(4trermo3tadfaD anes;()setoxopnudamenlictlt sDuaxro;u0oex mfctld mDua( p;t4teenmr oa1lmDr uvol(  eurim3iy1al   netas)srua(monu1teenmociltfa uln s u0 ltnxf iatlaD aivs t teumir no1ome  fcil() Duru oot1apeoiiciadfa2eaumsnu) lxrxr oo1opD anvi;t teuo(mpio1optemfvsatfs2tmxr nt0ape  oetydfa2rmnmp;(0alxoio oo1la r uei t)t2uoxrpiy4lmenlictltfarrrur ;t0apto ocildfsDra(mpn(4tlxnmr3iodfmDeauvsls sruo(r3nydomenmics t)srtmx o;u0tee  o3tytls2rluvs;t4aetrir3tytlaDr nvolt0srur(mpiydll e netlt  rurxmono4oetn f3tat sDua( p (0tetrxrcoa1oat  i s t)srxoxrpoydamte fci tfsDtr(rono4tpt iictls s2uluvon(4 exnxo3todfmt ln i s sexoio nu1lpen nvt (farrmurooo4aptn f3ilt sDrmuvp (0 etrxr oatomDe ivs;s s2umirpiu4lme lfesatf Dta(  ot1teeomfeilsfm ranvon(0 exoxociatoptrlnvi t) eum(o nudlle mnvs (f Dururont1alt moeilslm eluvs;(0tlerxrcoatlptelnvi (  rtrio3io4altelfetlt s2urxr ;o1opxnmoetlsla el(vpnt4teerxr totom  ai ols) 2xm(m ou4llt lnviltfs2umxr ou4alt io3iadla2ea(mo;t0 rerir3oo1oatelivs;( seuo(o nydop  mfctlt s2rrxrp;t4alto feildlm rln s;t)aexrxf3oatlm  ln ilt)sexm(m3oodape lnct ()sDtmum ;u4opeo feiltfa umn o u0tltomr oydfpD ln o;s s2toxm oy4alt  fcilt) 2ua(mpot4olxo i3iadlm2ea(mp u4 eerxo oydoaDr nvolt) 2trim iu1ap  lfetat)aDtaumpnt0opxnmieilt a ea( o t0tlxrmr3iotfa elueo () rtm(r3ny1alte fcia()arrrx oou1opt iociydla rln s t4altrio oo1latr ueils0t2uoim3oy4lleelieiltfaDraxrpnt4opx  ociatla ua( p;u) ltnxr3todoaDeanes t) rtmiopnudlm e fesat) Dtr(  ot0tltoiietysfs2rm(mo;u4 etrxo3iydoat lneo;t) 2urxo iudome mietl(fsrrru  ot1tpx  iciyt s2ua( s u0arxoio tydoaDeln ils sexm(m ny4altn ncilt)arrax pno1oeeo o3tyt s el(mo;t4aexnmr oytfmDrlnes;s0 2xmxr3iy4lp  livslt  2ra(  ;u1tlen fciat m2ra( s;u0arxrif3tytla   u ol( trtmim3iodal e nes t)a2ta(  ;u1tlx io3ild aDeluvs;(4 ltomr io1fmtelivo t)trtmio oy1alenliciasf 2rrxm oo1aexoio3ias aDel(vs t0aleoir iy1oa e i olt0texmimpoydlle mneta()sDtaumpnt4aee  feilt m2uln s u0arxoif iatfmteaues;s trurxr oudomeelnctas) Draxrpot4aeeniiciysfs2elumo t0teeniocoatlatr uvols0trtmim iy4lpenmfvtl(  2ur(m ;u4tlt iieiltla2rlnvsn() lermo iydomt auvsl( trum(o3oydap nlicta(f 2rrump;u0aee io3tyt aDrmn p;t4 eenmo3todoat auei;() etmxm nu1ll   icslt  Dtaxrpou0tpe iieiysfa umuvp;u0aetnxf3iotomDe nvolt  2toxmpiu1ame micsat)srtr(rp;t1ale moctlt a elnvpn(4 rerio oatla ranei () 2tmim oodomt  nviat)a2rrxrono0tee  f3iad s2eanms (0tleoir3iadlmtr uvi;t srtr(opno4ll nlfeta() rraxr ;t0tpe miciydlmDumnvont0teermfcoa1lmDeauvs s)texo(r3ou1olen fei ()sDumump;o1tle mictysfa2emn s;u0 rxrir3oydoatean s (0sexmir3oydap emncs s)aDua(m ot4oet  feildfsDemnvsn(0teenmo oo1fpD aiei;( s2xrxr3iy1opeelnctat)srtm(rp;u0texniicildfa2emn p;u4arxoif3oatoaDrau i;(0s2xoiopoo1optn ietl(f rrr(mo;u0tee ioetlsla em( on(0 eenmo totfmtr nei t srxmxm3iydlm  mnct tfa2trxrpou1tex if3iydls uan p;(4arerircoodfat aivsls) rxmxr iy1ap nlivs s sruaxrp;u1tpxn i3tydlmDrmump u)tltoif3ta1om   ivi;( truo(m no1alenmnci ()artaur ;t4tptniieilt a2rmu o;(0 eeomo ia1opDrluvi (0 2xm(m3nydolee fcsa(fa2trx pnt0aetoio3tldfsDean onu4 rtnxocta1la elueol( trxmxo iodlmt livtlt) rtrxrpou4aexoiicildls rm(vs u4artnif3oytopte i s;t teumxrpoo1amenlieiat)a2trxr nu1aeeoiiciltfa2em(mp;u4treoir3io1laD aues s s2uo(o3iudalt  ict tfaDra( o;t1oeeomo3iytfsDrmump;u0aeerio tydfpt anvo (  rtmirpio1amt lfctas) rta(m ot0optomieilsfa rmums;t)aetoxf oy1fatranei () 2uo(r3oo4om emfet sfsDuaumoou4oee io3ildfm2rlnms;(4 eerxfcto1lat livi () etoim3ou4ll n ietasf rum(  ;u4tet mfctlt s rlnmo;(4trermf3iydfateanvi;t tetm(m3nudaptelivt t)srur(mpoo1oetoifeiyd s2raumon()tleniociotopDe i o ()trtrir oo4aptnmics tfsrtmx pno0alt ioctatfs rlnmo;u4 rtnir3ty1fp r i i s seum(m no1op emncsltfsDuauronu1optoifciadfm uau o;u)aexrmfctadfmtr ivilt)sruoxr nu1oltemfciltfarum(mpot1aeeoif3iyd s2ulu s u) leoxo3oatomDelnvs s0teum(m iu4opeelnctatf 2ua(roou1oetoiictltlmDulums;t4 ltnmo3iydlm e uvs;t) rxo(o3ny4lle mfvsl(farumumo;t0oeeo f3ilt aDran sn(0arxrmocty1lp eln il( teuo(o ny1aptelicias)aruaum oo0teen f3iyd a rlums;t4alxrmr iytfmDe n s;(  etm(rpiu4openmfeiltf rtax o;o0apxomietadlaDumuvs;t0trenxo3iadfp eai o;s0tetmxrpoodap nlfctlt)s2uaxrp;o1alxnifciatlaDrmnvont0tltnir3ia1lmDeaivs;(0 2trir ou4op e ieil(fsruau pno0tetn fctltfa ranvp t0aleoio iodfmDrluesls0teurxrpoydlmtelnvi ( a2taurp;o0tptnmociys s2emumpn(0 renio3oydoat ai i;s sruoxopou1am e ivtl( sDum(rooo0oeenif3iadlm ranms () renxf3oatfate nei;(0teumxm3ou4optelfviltfsrraxm ou0ope if3iad s ra(mon(4trxrxfciy1la   n il( s2xm(m3oo1ome mnet (faDta( pou4apxo ictytfa eaumpnu) rxnxf tadoaD ln o;()setmir3iy4lpte fctas) 2taumoot0aeenmf3tas aDea(von(0arxoxr iodoaDrai s;s)srumir oodap emncs t  Drrxrpnu0opxomfctyt aDem(mp;t0arerir iydlm r nes s)sexm(m3ou4opte ivi (f Dua(mp;u1tpenii3tlt a2umuvs;t)aeerirctydop raues;(0s2xrio iu1lmenlfvs s  Durxr no1apxnioetydfa2em(ms u0tetnxrcoytlmteauei () rtmxrpou4omenlics s)a2tr(r nt1tleo i3iatfmDrm(vs t0arenmr3ootfp e i o;s0s2umirpio1amtn ieils)arumu pnt4oleoif3ildfm2um( snt4 exoxr3oytopt  u ils0s2urxmpiydomt lictas)s2tm(rpou4olx ioeiytfmDulu sn() rermr todfatrauesls s2urxr3iy1optn ivs (  2rmum nt1tleo ictlsfmDrlump t4alxomo tytfate neils s2um(m oo4ome licils) 2trur ;o4ope miciyslaDulnvpnt0 eerxf iy1lmte neols) etrxo oy4lm elivsl(faDurx ono1tptn oetatls rlu ont4 rerir3tytfmtr u sl(  rtoimpnydlmeemicils aDrr(mo;o0ope  oeiltla rlu p;u0 exnxf3oodfaDeaivi;t)trumxm3iu4oleemnetat)srtmx p;u0altoifciat m2umuvo;(4 etnmo3iy1faDr ivolt t2trim oodop e feils) 2tau  ot1tlx  feiadlm emu ont4aeeoircoa1la  aues (  exm(o3io1aptnmnvsat)arraxm ou0tex mieiad s2el(vs t)artoifciatfptr n o;t)t2umxmpiodlle lfeiasfsDumx o;o0tlxo ietasls eanvs;()alenxo3iodfmteauvs;(0teto(rpiu1am  lfeta( sDrau p;o4tex ioctys m2em(mp;u0 reoifcoy1lmt auvo;( tetrimpnu1olt lnvs ( sDra(r ;t4tee ioeiad mDulnms;(0altrxocoydlmDrli s t0 2tmim io1apen fvslt)a2raxr ou1optnii3iadfa2em(vo (0areoxrctotlmte ues s0trtmxopnu4lm   iciasfs2ta( pnt0oleniietlslmDeluvp u4 lxoirciy1oateaivi t)t2umxrpiy4oltemfes s) rum(  ;t4aexoiietas sDumn o t) exoxocoy1lmteluvsls t2tmxopoodll   icias)artmxm ;o4aetomi3tldfm emu 
\ No newline at end of file
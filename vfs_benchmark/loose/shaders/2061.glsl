@@ -0,0 +1 @@
+neol(  2xmio3nudal nlics (f 2rauro;t0texo oetasfmDemumsnt0tltomf3totlp r u i;t0texoio3no4oltemnvtl(faDururpnt0aptnmoetys m2rluvp (4teenmfcto1fmD lueolt) etrxo iy4lptnmictl( s2rm( o;u4oleniieiltls2ua(mpn()tleoir oydfpDrlnvs;s)seum(r3oo4openlieia(  rtax poo0tlenmictysfsDul(vp;u4 rtrio oydlpDelu ols) rtoirpnodlpeeliei (  ruax  no1aetn fcils s rlnvp u4altnmrcoo1lat anes;s)trumio oy4ome  ivs () rtax o;t4aee mi3iydfm ul(mon(4 exrmfcoydlpDrai o t)setrirpiudllt mivil(fsDum(mo;u4alx  oeiat m rmu on(4artrxocta1om r n o;s0srtmxo3ny1lptemnvslt)aDumu oot4apt mf3iydfaDuan o t)tlxnif3oytlm rlneolt0trumio oodolte ici sfsrrrumpnt4aeenmf3iaslm2ranmsnt0teeomr3todlatrauvs t0 rxoxm ny1lm n nctltf 2rmumo;t1tee  oeiat m2ua( p t) lxnmo oadfmDraies t)s2urir3ny1oltemicta(fsDta(moot4aee if3tlslsDrluvs;()tleomo3tydopD auei;t0srum(m iu4lmeelfcils)srur(rp;o0tle miciad a eau p u4aetrxo3oydoat  uei;(0seuoio no1olee icsl( a2rmu o;t4teto ietysfsDulnvs t4alerxf to1oatraivil() ruo(r3nydlp  mfcia( a2tauro;u4aetoio3tatlmDea(vo u0 rerioctotlp ranei t trur(r3nu4optelicils a2rr(m ;o1texn octasfmDua(monu0trerio3io1lpt lu o ()trtmxmpiy1ol   nvil( srraxro;o1altniicilt sDelnvp;(4aexnmf3iytop ean i;t) eurxm3iydomte fvt t  rururono1oex  oeiydlmDum(mo t4trxoir3ty1fatrlu s;(  rtm(m iudalt mieils srraxmpno0texoif3iys mDrluvo (0aetniociotom ran i (0sexoir nu4lmee fcs s  2uaurpnt4optoifeiyd a ranvs;(0 exrxo ia1fpt lu ils0t2ur(r3no1alt  fet s)s2trxm ;t0apxnmo3iatfa elums ()aleomfciy1fm r ivi;s0trum(mpiodlpte nvias)sDtmum nt4aeenioeiadlaDranmsnu0altoxo3iadomDelnes;s) euoio3iydaptnlnvsl(f 2tm(  ;t4oleoiieiatfaDem(vo;t0 rtoio3oa1fa  aueo;s0srtoxo3ny1altelnesatfaDrrumont4tpeo o3iyd aDea( s;()trerir3ty1oaDrauei t0t2tr(r3iu1olt mfeilt) rumxr nu4alto fetltfm2ran o;t4alxoxrcoa1lat lues;() 2tm(o3oodopt  feta()s2raxr no4tptniocilt sDumnmon(0tlxoio oodlm  li ilt0trxmxm3oudaptn feta(  2um(moot1aex  icilt s2rlu pnu4tetnxfcoatlmDelieo ( srxo(m3ny1lpe lfcsls sruru o;o1tlt ifctld mDeluvp u) renmo iotoaD anvi (0t2trxmpny1ale  ivsl( arrmx  ;t0tee ii3tyslmDra(mp;(0tltomr tydop r i i ()texmio3ou1lpeemnesls)aDum( onu4apx mfetltlm2umums u)areomf iadlpt  uvs s) 2xrxo3iydaptelfcs () Durum ;o1olen oeiydfs2eaumpnt0 exrmf3iytom   n sl( s2uoxm ny4apenmnctas) Dra(  ;u0alt mf3iasfm2em(vont4 rxnmf3todom eluvo (0 exr(r ny4llt mnesl(fa2ua(mono0tpxoifetyt mDemn p u)texriociytfm  auvolt s2uoxopiydll nlnctl(  Dtm( poo1tlxnifeiydfsDel(vsnu) exoxr totomD auei ()srurxr3iy1lpen neil( s2ur(mooo4tleomi3iyt s2umnmsnt)arenmfctytoa r nvo s s2tmio nu4omeelfesltfs2tmxrpou1olxomfetad aDulumsnt)trerxo3to1omt  n o;s)s2xrxmpny1ope mnvt s)a2trur ;o4olen fctyd m2el(mo;u4trtrxo3ootlm r ueo;() rxmio3iudomtnmneil()srta( pou4aex mocildfaDrmu p;t) lermf ootlm rai i t)sexo(o nudapee neilt aDtru  ;o4aet mfetydfa el( o;u4trtomrciotlaDraieils)trtrio3iydllee nci tfarua( p;o4ale ioctad a2el(ms t0 reomocoa1omteli i (  etoxrpiudll nlnvtls)s2ua(mo;t1tleo i3iydlsDrm(vonu0trtomociy1op   uvs t0srto(mpio1ap n ictat) ruax ono4olt mfciltla rl(mo;t0texrxfcoy1fmD  uvilt0 euoio3ny1llenlnvtls arumumo;u0olxnio3iasfm2emnmpn(0tltnir oydfpt auvsls) 2xoxo3oy1opte fci ()sDtrx  no4opeoioeiys a2emnmp t4artnxocoa1laD lieo s) rtm(m iu1ape lfvia()aruaur ou4alt mfctad m em(mo t0 renxf3tadoaD  ivi ()texmxr3iy1ol   nvta(  Dtaxrpot1tex io3tytfa rlnmp;u0tlxoxrciotoaD livo ( t2xr(opnu4ll elnctlt)arum( o;u4opxoio3iltfs um(mon()teerif3io1fmDe ies;t srxm(o3ny4lle lnei t) 2tm( o;t0opx ii3tysfa2ulumsnu4teeomf3iatfateau o t0srtmir no1ll  lics t a2urxm no4apt miciltfm2ea( snu4altnircty1fpt ai s;s  2trxr3nudlmt mietat)artax  ot0oltn feiadfmDeanvo;(0teerxociatfptr nvs;( teuo(m io4ole mfvslsfsrurxr nt1ope  f3tas a2uaumpnu0 rxnmr totoatelivo;( teumir ny1alee ivs t a2rmur nt4tltn fctaslsDrl( pnu)artniociytfmD livolt)tetoimpou1lm  licsat sDum( o;u1tlt mo3tlslmDeaump (0texoif ty1oa e u s t0 etoirpio4olt mivt sfartrx  ;t0opxnmociytfmDul(vsn(4tlxoxf iytlm ran o t seuo(r3nu4lmtnmfcil()s2rrxmp;t0tle  ieiatfa elnvon(4aexrxrcta1late n o;s0 rxoxmpoy1op elnct sfaDraurp;o1tpe  feild aDeau s (4teenxrctytfatrau sls srtm(mpiy1ol nlivi s)sDra( p;t4oltn o3iydlmDrmu o;t) rxrxr todfatelnvil( t2xrio3oodal e nvsa() Drm(monu4aptnii3iltfaDul(mpn(0tlxomo3ia1lmD auei s0 rtm(r oy4lm e nvs t sruaxr ot1apx ii3iydlaDrmumont0 renxo3totlptraues s0 2xrxo3nodom elieiatfa2ta(roou1tleoiietadlsDemumpnu0arxrxocoadoatranes;t0s2um(r3iu4olen icils)sDra(mo;o1tpto feild mDeanvo;t4tlenxf3iy1faDe ivils) etm(mpiu4am  lfvtas srrauroot4teeo oeias sDul(vo;u4aleniociydopDeluvo ()srto(o3oy4op elfvtasfsrrm(mpno4aeeo fetld s eanmp;()trtoir3ta1laDrau o s seuoio iy1ll e nvsat sDta(  ;t4tpt  ieiysls rlu s;t)arxniocoatlpDeliei (  rum(m3oy1lme  ivi (  rrr(mo;o1aleoiieiat sDulu onu)trtnxoctydop r n il()teurxrpio4lleemiciltfaDraxrp;t0opxomf3tls a rln s t4areoxf iatfmDe ieslt)texo(o3iydopt  fes sfaDumxr ;o0opeomo3iys aDemn o;u4tetrxrcoydoa eluei ()sruoxo no1ope  fci t  Dur(moou1aetn ietlt aDumuvp;u4 eeriociatfmte u olt)trur(mpnudlmen fcs t  Drr(ronu0tle  f3iydls ua(vsn(4 lxomf tadfatelnei;t)t2toxr oo1ol  lfeiat  2rr(mo;u0apxoio3ils s rl(mpn()tetomociy1fpteaies;t0 rtoirpiy1omtelnvsa( aDrmuro;u1tptn octlsfm ulums ()arxomrctydom rai i (0 2tr(opno1lmte ieia(faDtm(mpnu0apenmi3ils m2ranmp;()texnirciodfpDelu ils) 2to(m3oy4apte fcs (farrruro;o4alxoif3tydlsDrmuvonu)alxrxrcoy1fmtr n o;(  2xm(o ou4ale liesl(fsDurx p;u1oleo oetytfaDumu p;() lxrioctadfa elu s;t seto(o nydal  lfesat)srrr(rp;u1tpxnii3iysfm2emnvp;(0 etoir ootlmtelnvilt  etmxopnydlleelfvtat) Dtmum ;o1aetnmi3iys aDrmnmont0trtnxo tytop e ieo t sexm(o3nudlltnlictlt  2ra( onu0teeomi3tltlm rau snt0tlxomo3ty1oaDr ivi s s2uo(r oudol nmfctlt)a2ra(rpou1aexoii3tas s2uanmsn(4 ltoio oa1lpDeaues s  etrio3nudlmt  fcs t)s2ra(mo;t4oex mf3ilsla uluvo t0 exoxo iatlpDe ivo t) 2tm(rpoo1al   ies ( sDtr(mont0tee  oetltfm el( p t0 exrmocto1fa e n o;s0s2xmxrpnodamenmfci () rua(mp;u4texomfciydfa2ulnvs u4trxomo ta1latr nei s0srur(mpoy1open iei sf 2rrur ;t1oee micias a rmuvsnu0alxomo3oadfat  ies s0trtoiopoydameemictl( arrax p;o1alenii3tytfa eau onu0trenif3iotfmDrlnvils)s2to(r oy4opt  fci ( sDuaxroou4aexnmf3iatla eau o u) reomocoy1opDrlieil()srxmimpoy4aptn fcs t  2tmxrp;u1tptn i3tadlmDelnvs;t)aetrxr3iadomte i i (0s2toim3nodlme  ivi tf 2rr(rpno0tleoif3iys s rm( p;t4aleomo3oytlmtelies t0t2xoirpnu4apeemieiat  Dururont0tpxomi3ilsls rau s t4 lxrir3tatfatrai ilt t2xm(o3nudap  mivsls)arra(r ;o1tpx  fetaslm2el(mpnt4arxnmrcio1lpteau i;t0 rum(m iy1ol nmfet (faDrmxmp;t0apt ifcias a2el(vont4texrxocta1opt livo s trtmimpnu4al  lfctatf 2ur(rpnu1tpx  f3iadfsDumu o t)aeenir3oa1latrlieslt0trum(rpou4llen nvsa() Durumpnu4openmf3ildfmDuln o (4 rxnmf3io1opDe u o s)trxoirpnudaptelici sf Drr(  oo0oleniiciaslmDran p u0altnxr iytopDe ueo ()trum(o iy4amt mnvsatf Dta(r no4apx ifcilsla rlu p;u4trtomrciy1fmt  u o t0setr(r3iy4lle lfvsas)arraurpnu1aptn ociad m2rm(mo (4treomfciatlp  lnvi t teur(rpou4ale lictasf Dum(roou4oltn iciatfm2rluvs t) lxnmo oodfa rluvo;( sexrio iy1ol nmnct t arrmu  ;t1altomoetyslsDel(vp u)aexoiocootlptrlnvi ( s2umio oudapenlivtl(f 2rrumont0apxnmoetat s2rmuvs t4 rtriociodfmDelies t0s2uo(m3nodolee nvia(f Dtax oot1teeoioeiytfaDrlnvo;t0 lxnmfcto1faDrlu o (0 rumio ou1lpee nesa( sDurxmono1tpxomo3iat s eanvo u4arxnmfcoo1oa rlu o s)seurxopnu4alenmictl(f rrrxmooo0ale  i3iysfa rlumont0 eeoxfcty1omtraivs (0tetrxo3oo1lpt  fctl(  Dumx oot1aptoiietlsfs2rlu snt4aexnxfcto1fpDrlueil(0 2xoir3nydlptnmnvt ( arrr(  ;o1tpeomo3ils aDea(vs;()aexrxrcoadlmDelu o;s) ruoim3oy1lpe liei t arrr(moot4tee  icildls ulnvonu4 etnxr3tatfm  anes;t) 2xo(r iodol  licsls)aDrru  ;t1opx  feilt s em(mp t0alermf3tadoa   ieilt)setm(o iu4ope  fvia( sDrrxm ou4apen o3iytfaDranmp;() etrxf3iydfm rlneils0 2xr(m3no1am n ivilt  rta( p;o0tle  feiyd a um(vpn()trxnmo3io1fpt aieols trurirpiodapte iei t  Dua( ono0texo ociydfmDulnvp (0tlxoxr iodom raiei;s0srxr(opoy1ome livi tfs2rr(mont0tpxomocilsfs2uaump ()arxnmo iy1omDraiesl( seumir nodome lfet (  rrau pnu1oetniictyslsDemuvp (0texrif oo1fmte iesl(  exoio nudlmeelfvtlt  rumur ;u4tet iociaslsDeluvp u0 eenioctytoptrln i;(  ruoxo nodoptn ivtlt) rtm(r ;t4teeo oetysfmDumnmp;u4arenxf tatlp e i sls  exmim oo4apt lfvsl(faDrrumoou0opt mf3iys a emnmo;t0arxnio3oy1oaDrlueilt0 exoxr3iy1lmee ieils)s2rm( ono4tet mictlsls umumpnu4 etnxrciodfpDe uvo s teurxo3iu4am n ivtlsf Dum(rpnu4oltnmf3taslaDeauvsn(4tltrio iotlpDran s;( trumim3ny1amte fvil()s2ra(mpnt1apen fetatfm uau on(0teerxrctodop ranvsl(0 rto(o iy4opt mnvilsfaDua(  ot4tltnif3tad m2elums;()texnxr tatfa   ivi;t0t2uo(o3nu1lmtnlivtas a2um(r oo0tpxomieilsls2em(msn()tetoifctodlp eaneol( srxmir oo1olt mnctl() rtrxm nu4aptnif3iydlsDemn o u4 rxnmr to1lm eanvols0sexrio iodamtnlivt tf rua(rpou0alxo ociad s2rmnmo t) leoxfctydfat auvi;t  rtoirpoudll nlfci (fa2ua(rpnu0tlx ii3iytlsDra( p;u0tlxrmr3tydfmt lueo t0 2trimpnudap nlnvsltfarrmum ;u4opt ifciatfaDuaumon(4treoxr3tatoaDran olt)trtoim3no1lmt  fvsls aDuaum nu4ole  o3tysfmDulu s;u0tlerxrciytoaD aues t)s2to(rpnodlm  lncilt  Dtru oou4optniieiadls elnmo u0aeenmoctadfm   uvil() rurir3oodlp   nvslt a2ua( o;t4alen i3ilslaDrmuvpn(4 exrxo3oadoatrlu i;( s2umir3ou4al   ietas a2um(  ou4oexomicilsfaDuauvs t4 rtomo ootfmt  nvo (0 2tm(m no1ol n ietlsfaruau onu1oltniiciatla2rluvo;u4arenxo3oo1lptr nvo s) etoxmpiu4ol  lfct (faDtm(rpot4oetoiiciytlm2rlnvp;(4treomrcty1omt  ueo (0s2xrim iy1ol nlivtasfsDua(mp;o1oeeomiciasfs ran s;(4tlxnxoctadlp   n s;t)sexr(r3ny1op elics (fsDtruronu0tee mictatfa2rlumo;t4teerxf3iadlp rluvo t  rxoim3ou1opte nvs t)s2rrx  ou0tlen o3ilsfmDumu o ()aeeoxfctydfp e u s;s)s2uo(r3ou4ol  mfvi sfsruax o;t0ope  f3ilt s2eluvo;t0aleomo tydoa elues;s0 etrir3ny4al elneiat)s2raumoou4alxomieiyslmDrm( s t)texnmrcio1fp e nei;t0teuriopiodape livtlsfs2tau ont1tlenmieiltls2eln s t0arermf3ta1lpDeai ils0trurxm3ou1ll n ieta()sDumxmpnt4aeto feiadlsDulumo;t)alenif3oa1la  ln i;(0t2to(o iudam elnetas) rrrumo;o4apx  i3tas aDumn p u0aeenirciy1lm  aneils)s2xoio iydopen fctlt arta(ro;u0altnio3iytlsDuluvo (0texrmocoatfpD lnei;(  2trir oydll
\ No newline at end of file
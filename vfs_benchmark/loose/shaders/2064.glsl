@@ -0,0 +1 @@
+ies t) rtrir iu4amenliei sf rrmxr ;o1optnmf3tatfs2ul(von()arxrircia1omtrlnes (0texmxopnodlptn fci ()s2tmxm no4tlenmociydlm2el(vp t)alxomrctotlpt aues ()setrirpiodal n ncsls) 2ta( p;t0apeoii3iasla2ulnms;() lxrmf io1lmt aueo;() 2uo(r iy4lm nmieslt)s2tmxmpnt1tetnmfctaslaDrln o;t) rxrircoadoatraivo;t s2ur(opoudom   ivsa() rururonu1opxn oeiltfa umu o u0aeeoircoo1fpDe i ils0 2toxo iy4ame micsl()srua(root1aetniocildlm ul( p t0tetnmfciy1lm e uvo;t) 2ur(o no1alen feslt a2tmxronu4aee if3iltfa umn o;(0arxoxf tydfateaneslt srxoxrpiu4olee fesas srum(m oo0tpe  ietys a2raumsnu)aetoxr oa1fatrai o ( s2uoio3oy1lp nmfvsatfaDurxrp;o0optnifeilt s rau p (0trtoif ootop eauvs ()trxo(r3nudlmt mnei sfa2ur(  nt4aptnioeiytfa2eau p;()aeenmrcoo1fpt lieo ()srxoxm3iudalee nesa() Drr( onu0aet ii3iyt s uauvon(4teenxocto1lmtr u o;()srumxr3no4aleemfvsasfs2urx p;t0aexoio3ils a raump u0 reoxocia1fa eauvolt)srtrimpoydomtelfcsat)srumum nt4aee  oetatlmDeaump u4 lxnmo tydfmtr u o s0srxm(m iu4ome  icia( aDtrurono4oeto i3tltfm2ea( pn(0altoio iadlmDr u o;()srtoxm io1om   fcil()sDrmu pnu0tpenioetadfm ea(ms;(4 exrxr3ootfa r u olt0 2urir3ny1am   fci ( artr(m ;u4apen iciltls uan o;t0 rermociytlate ieo () etrxm ou4alt mfct t a2ua( oou0tptn oeias m um(vo () exnmociodlmDrlivs t srto(o oydamte ivsl(fs2uauront0texnmfcildla ua( p u4teenxo iotoaDrlivi t)t2xo(rpou4lmeemicias a2rmxm ;t1tpeomicilt a em(vpn()tetrxocta1oate u s;t)s2xo(m iu4llenlici sf 2raum ;o0teeo oetlt s uanvo (0 rtomf to1lat li s;s0sruo(rpoudlmeemictas sDtmxr ou1ape mfciat m2emnmo t0aetnio oodop e n i s  exmimpiodomeelnei s)arurx  nt1oet moetyd aDelu s;(0 ltrmr iodfp raies;s sruoxm3nudol emnct ()sDraxmp;t4olx  feiad s2el(mo t0arxoif oa1fmt  neil(0 rumir iu1opt mncia(fa2urxro;o0aleo iciyd s2umnms u4 rtrxr3ia1faDeanvilt0t2xo(r3nu1lp e ncils)s2ra(ro;t4opxomfeiaslaDeanvonu) exrio3to1optrlivol()trxo(m iodol n iei ()a2ta(rp;o4optn i3iydla ul(vp t)tetomf3iotfaD  ieils  rxo(rpnudomt  ieiatfs2uaur ot4teenii3iadfs2ulnmp;u)artoxfcoa1fmtrlnvo;t)t2uoio3nodop e fcsas)aDtaur ot1opx iiciyt sDeau ont4tetoif ootoaDelnvol() etrio3iu1ole lfcsltfartm( p;t0oltn f3iltls uan snu)texniociytfmtranvs;t)seuo(mpio4lmte fetatfa2uau oou0tpto oeiltfs ua(vp;t4aetnir totopt  nei;t)teumiopiy4ame  nvtls)aDumx o;t1oexnifeiad m2eluvs;t4 etrmf3oydfm   u s s0s2toimpny1ope lfciat)sDraur nu0tlxnmociytlm umuvo;u0tlxnirctotlp r ueo t)sexmio3nu1opeelfcilt  2trxmpno1olt mocildfa2rmn snu4arxoxfctodlptr i i ( tetoxm oydale lnvsas  2tm(rooo1tlxomf3tat sDra( p (0 ltomf oo1op elnvs;t seurxrpny1lpt  fvsa(  2urxr ;o4aexomfctasls eau on()tleoif tatfm rauei;t0s2toxm oy1lmt lnci ()s2rr( pno1apeo f3tytlsDumuvs t)tlenifctadlm eaivils0teurxr3no4optnmicsat) Dur(moot0tptn f3ilsla rmump;u0aexnxo3iodopD lnes s)t2tm(opiodolenmiet tf Drmxmoou0tpxomf3iltfa2elnmp u0 rxrir3ootfatrluvi t s2toirpio4altn fcsls sDtax p;u1aet if3iatfaDel( pn(0alerxo3tytoaDranvsl(  rxr(o oo1ol   iviatf Draxm ;u0tpenmi3iydfa2eau o u0tltnif3iotomDeau ilt  rtr(mpno1lpeelnvsa(  2ta(rpot1apt miciat sDem(vo (4aetoif3iotfp  lieils)setrirpiy4apt  ieias arurumo;o4apto ieiyslm2ua( o;t4aeermo iy1faDelivs s) exrio3oy1olt lfctasf rrmur nt4texnmi3iadfaDumnms t) rxnmr iotlmD livsl(  etoirpou1am emieslt) 2tm( p;u0alx mfctatfa2rmu p;t) exrmociadopD lu i s)srxmirpnu1lpt mictas) 2taur ;t4tpt  fetls s2rm(mo;u0 reoxrctadfaDean s;(  rurxm oydlptemfviasfa2tmum ot1aex io3tyd m2ul( o t4aetnmo3ia1la e n o t  2um(rpnydop  livtls a2umxmo;o4tpxniociatfsDul(vsnt0 rxnif3oatfa e nvo;s)texoio3oudlmtelfetls) ruax o;o0tptniociyd a2ranvs u0 exnifciotlaD livs;t0 rxoxr3iy4openliciasfs2rax pou4optomfeias m ranmp;u4texrxf oo1lmtrli olt)t2xrim3oo1lpenlies s)sruaxront1tpeo ictls aDeanvont0trtrxo iy1opte n slt  eum(o3oo1lmtnmfeia(f 2trumonu0tptoio3ilsfsDemuvo;()trtomo iydfp eaivs;(0s2xr(m3iy4apenmfvs s)srum(moot1tetnmietld a2umumpnu4aexnio oa1lmt  nvs (0 rxr(r oydapeelictat)a2um(mpno4tetnifcilslsDumuvsnu4 lxrmo iodlmD aiei s t2tmio iu4op emnvsl()srtrxmp;t0tet mietytls2emnvo t0tlxnir3iydopDelnes (0trtmxr iy1altnmncta(fa2trxr nu4ale io3ildfsDua(mp t0alerxf3tatfmtr u ils0srurxr oo1omtnlics t)aDua(mpno1tpx ifciadlm2rm(vont4texoircta1opt  neo;s0seumxmpoy1lpe mneiat sDrmuroot1oexniiciasfmDua(mp;u) etoif todlpDe ues s)srxoxrpnu1lmeelnesasf 2tr( p;t4tpe  octas aDua(vp u)areoifcoydfp  lu il()seumio ou1ol e ivtlsfaDta(  ;o0alxomi3tltlm2ulnvsn(0tetnxo iydop eanvi;s)seuoxopiy1olenmnvslt)aDur(ronu0oltnmictydlsDuauvp u4 rxoio3oadlpDeai i;()trtm(m oydlle mieias  2umx  ;t4aetomfctas aDrmu s u0arxrmr3iadfaD  uvi;t t2umxr oy1ape  nvi ()a2rax  ou4oetoio3iysla ua(vo u0tetrxf ootfptrlneils trxr(o oo4lmen fct t) 2tmxr nt0opxoifctadlsDrmu o;()aetnxoctadfpDeaneo ( setmxmpou4alen nvsl( aDrmu o;t1altomi3iltfaDumu s;()arxnmr todla  luvi s trtmir ny1ameelics s) rraxr ;o1tpe  oetldlm ul( s u0teenifcto1laDelneslt0s2xoirpio1lle lfctls)s2trumpot0apx  ocilslsDra(ms u0arxoxo io1lmteanvsls)trumio3nudlpenlici s)s2rmur nu0teenmoctys s2em(vpnt4tlenmocoydom ran ilt  rxmxr3iodopt mfct t) 2taxmpoo0teeo f3tysfmDuluvo;t0trxrifciodfa  anvils t2toxmpiydam nlnesa() Dum(r ;u0alxoioctyslmDra( p t0trxomrcoa1fpD luvi (  rxoirpiu1op  lnesltf 2umx  oo4tetoifetldfa rmuvsn(0teenirciatfa rlnvi t srtm(m3nudalte fvils  2ua(m ;u1tetnmieias m ran o;t4trxnxocoy1fat anes ()srxr(m oudol nmictatf Drr( o;t4ale  fciadfmDuauvpnt4alenxr oydlpDr ueolt)teuo(m3oudap elnvs sfs2raxrpno0opx mf3iydlsDemnms;t)teenmfcoadopDeaivol()t2tmxrpiodlpen nvs ( srtr(rp;t1oet mfciadlsDra(mo;t4trtnmocoodlm  lnvols0trurir io1ol  lnvsl()sDta(r nt1aexo fciytlsDeau o (4 exomrciatop rlnes;t srxoxmpny4amen fetlt)aDuauro;t0olxn fetyd a ea(von()tltoxr3tatop e nei t0sexrir oy1altn ncsas aDrm(r ot0tpt mictadfm2eanvpnu4tltoio iydlpt li il()trxrio3iydome mneta(fartmu p;o1texomociytla2ulu p;t) rerirctadfp ranvslt t2xoir3iy4amtnlivs s) Drr(  ;o1tlt mfctas s ean o;u0alerxfciodfmDeli sl() 2uo(m3nodal  mfvtl( sDrmx pot4oeeomi3tadlaDumumo;()alxnxo to1fat ai sl()trumir nudlmtnlivils  Dtaxr no4opeoii3tldlm rlu onu0trtrxf3oatoptranvo s0t2xmiopoy1om emnes t a2rrxmpno0tee mfciat sDumn s;t)aexomociodlmDr uvo;s)texoxo iydlmtelnetltfsrtrxmpoo4ape  o3ildls ra( on()aeenmf ta1omDrlu sls) rxmio oo4alt lfvs s)a2uax o;u1aptniieiadfmDra(mp;t4 etoxo tytfp ranvs s0t2xrir nudol e fvtat  rtaxmo;u4oeeo oeiasls2rln p;u0tltomr3oo1omt anei;(0srtmxm nu4optn fetltfaDrrxrpno4tee mfciyslsDel( snu4aetrxf iy1laDrlneo;s t2trio3iu1ap nmnvsat  2ta(ronu0apto iciasfmDulnvs ()texnif iatfp  anvo;( srxr(rpoodol emiesa( s2tax pou1tlto feiasla eau o;(4tltniociadom eanes t t2urio oodop elnci s)srrax o;t0apx ifeiltfs rauvpnt4 etoxf oy1oate n s (0 2xoir3iydole  fvsltf rrrxronu1oexnmiciysls ua( p;t4alenxo oatfm ranvi ()srxo(opnu1alen iei (fa2rmum no4oexomi3ias sDum( p (4 lermr oy1oatrauesl() ruoio oy4alt mfes tf Dumxroot0oee ifciltfa ra(ms u4tetnxo3totlm  lieo;(0srumxo3io1omeemnesltf ruaumpou4tetoii3iadfaDul(vo u0 rtoxo3tatlmDe i o;t)texoxopoy1aptnlies (fs2tau p;o1olt  fciytlm rmnmp;u4alenif3ia1opDeanvils  rtm(o oy1aleemncil(fa2trumpou4aleoiieiysfmDuan o t4trenxfcta1lmD livi () 2trir3nodop  mfctlsfartaxr ot1aex ifeiadfs el( pnt0alermf3iatfat liei t s2xrxm3iudopt lfesl()sDrm(  no1olx  ocilsfmDel(ms t4trxrmrciodomteauvs ()seumirpnydoltn ivi ( sDrrxmono1aeen ocilsfm elu onu0treoif oytlptrlnes s0srxmio3no4lptn neias s2ra(r ou0aet mo3tld aDrmu pnu) lxrxrctytlmD  i olt0 2xo(r oydlltemnes ()aDrrxrp;t4ale ifeiad aDeanvp;t0aeeomf tadfpDe n o (  exoir3oudameemietlt) rtm( o;u1tee mi3iat m2um( o;u0areomf iatfmDrau s t) 2xo(o oy4apenmiesa()artau  ;o1aexo ietldfsDeaump u0tlermo iotfmtranvs;t0srumxrpio1am nmnvi ()sruaum ;o0tpeo ictlt mDrl( o;u0 rxrxo oydom   ues;s t2xmxopoodlptn ncsl( aDrr(rpot1tpx  oeild m ua(monu4 rtnxo3tatopD  ivils)trxm(mpnu1aptnmici s) 2tmx o;t0olt mieilt s rl( pnu4 exnmrctotlmt lnvs;()trtrim3iodolee ictl( sDtr( o;o1oeeomfetytla elu onu0 rtnio iy1laDelnvs s)trtmiopoudlltelncsl( a2taur oo1tlxoif3iyt s ran p ()tlenmociy1laDe ieilt0trxm(r3iodolen ivi (f 2rmxrpot4tpxomoetldfmDelnmon(0tltrmf ty1laDrau s;( t2to(o3nu4omenlicil(faruaxr ;o0apenmoeild m2rauvs u)trxrxr3ty1la raieols truoxrpoo1am   ivtltfa2rru  ot1oexnii3iyd a uanmont4teermf tatfaDe ieols0t2xm(m3oy1ll n ivtl(  2ta(mo;u1openmoeiydfm2uan p;()tleoio oytfm eai o;( s2xoxr3nydlltnliet ( s2trxmonu4teen ietytfsDuan ont4 rxomrcootlmD auvs;t texrxo iydaltelicsa()s2tmxroou1olenii3tyt m2rm(mp t4altoircoo1lmD li s ()s2ur(o no4alenlnesas)aDraum oo1oee miciadfs ra( o t0aexnxfcoydfa raueols sexmim no1oleelneiat)s2urxm ot1oleoio3ilsls emn ont4tlxnxf3todomtraivo;s trtrxmpno1opt mfci t)a2ua(rp;u0opxomo3iyslaDraumont) eermfctytlmDr i i;() rumirpoy4ome  feils)sDtaurp;t0ape  o3tadfa2eauvs;()trtnio3iotlmDelieo;s0 2umxm nydlltelicslsfaDrrxmo;o1opxoiiciat sDemnvs;t4treoiociydfmDranes;s)seumim ny1ope  icils arrrump;t4oeeo fctytfa2um(ms;t0trtoifcoo1om raivi ( trto(opno4amtelnetas)srtrxr ou1alx mfcilt a ranvs;(4arenmo oydlatrau i;s  2to(o3iodap nmivtat)aDtm(r nu4tltoifciyd a2emnmpnu4aeeoif ty1lm  li ols0t2uoxr3oo1lpe lics s s2trurpot4oetn ietyt sDraump;(4tetnif3iytfptrlivs ()trtrxrpio4lmtn fvtl(  Drmxm oo1tpe ifcils mDrm(vsnu0arenif iytomteai ilt) 2urio ou4omen ici sf rraxmpnt1apxniictlt m el(vsn(0artrxf3ty1lmD  u il(0seurxm io4opte ictls)aDtaxrono4tptnmfciatfa2ea(mp u4 lenio todlmD  ivil(  exr(r nudom nmfeia(fsDumum nu0alxoifetyd m rluvp;u) ltnir3iatomDrau sl(0trurir3io4ap nlnetl(f Durxro;u4tpx mictadfmDrl(ms;t4 rtnxr tydlptelu s;t0srtmxo3iodaltnlfetasfs2raxmont0aexn i3iydlm2ranvs t0aetoxfcia1fat luvo s)srtmim3ny4lp n fvta(  Dua(mpou1oetn icilt s ra(vp;(4aexoxrctatopt  nvslt0tetoimpnydap  mncta( a2rrum ;t4aet  iciadfa elu ont)trerirctodlmDeluvs;t)trxoio nu1aleemietlt) rraxm nu0tpt iicild m rlums u)arermfctatlmDelnvs s s2trxr3oy1ll n ncsasfsDrr(m ;o0aexnmoeiysfsDelnms;t0texrircoadlp elneolt teumxopno4ameelnei s  Dra(r nu1opeo ictld mDumu on() eenxo3to1fm e uvi t seurxm oo4lm elfvsltfartr( ono1oex ii3tld s ul( o;t0 eenxr oadlat  uei;s)truo(mpnu4om e nvi tfsrrrxr ot0oltn i3iad s rlu s;u0trxrif ty1fpteau ils0 rxoio iy1lm   fvs t)srtaxrpot4oleoif3ildla2uanvp t4 lxoif oadopteaneo;s0teumir oy4am nmfvi s  2umxrpoo4tpenmieiysfmDrm(vp (0trtrifciydla r n o;s t2urxm nodom emfcs s)a2um(r ou4altoif3tlsfsDrlu s;(4 eenxo tatlmDe nes;t)trtm(m ou4op n nctl()a2tmuroot0teeo ociatls um(vo (4 rxomocio1omDeluvs;s t2tm(o3no1lmt lies (  2tmx  ;o4tptoifciys s rau p ()aeerio3oo1fm  ln o;s)setmxopiudlp n ies t)s2ua( pou4tptn fetaslsDrln p (4 renxr3iydla  an i (  exr(r ou1ome lfetasfarum(r ;t1tetnifeias aDemuvsnu4artnxr oytlpt lneols t2ur(mpnydlmtemivsltf rur(mpno4tleomf3tls aDeauvp;(4arxrifcto1fatrlu i s) etoxr3nodomen ivs tfsrtau onu0olxo o3ias m ua( pnu4alenxocoa1laDeai ols0 rxoxr ou4ame micia() ruaxm nt0oltn oeiat m emn s;t4arxrxrctydopDr u s;s0s2umxo3iy1al  mfvilt  2trumo;u0olt moctydlmDelnmp () reoio ootlmt luvi;()t2umirpoy1lmen fci sfsrta(  ot0tet mocild a2ra(mo (0 ltomo3iytlaD  neolt sruo(r oy1omte iet ()aruru  ;u1tet  f3tad aDrauvp t)trtnif tydlp  aies (0 rumxmpno4ll n iesltf Dumumpoo0oee  fetatlmDul( o;t)aexnif tadfmtrluvolt)srur(o3nudllee nvtls)a2tmumpnt4opt  ieiasfs elnms;u)tetrxr3ootla  au o s0 exmxm3oydomtelnctlsf Dtmurpnu0tlxomociat a umnvs;(4tetomf totoaDelu ilt trtoim oo4lmee iesltfa2rmxronu4oeeo ietyt m ea( s;t) renxrcoy1fpD  iesls0texrxr3iydllenlneslt a2uaxmpot4apto i3tyslmDuanvs;u)trtrxo3oo1fmD aieo s  rxmim3oy1ol nlnvsatfsrtmx pnu4oeeo o3tadfmDraumo;u) rtrxf3tydfp   uei (0s2urxr ou1am e fviat srtmumo;u1aee ifetld a2elnvpnu0 exrmo iadomD  ieols)texr(m oo1oltemncsasf Dra(r ou0aleoii3ilslmDuan pnt)teerif oa1opDeau o t)srumir3iy1ap  mnvtls) 2tr( p;o4apt ifetys sDea(vp;() rxomr iadlm e uvo;s0 rxrxr3oodlme  nctl(  ruax  oo1tex moctyd sDul(vp t4aleomr io1oaDe neo (0 rtmxr iy1ol e fcilt)sDurxmono0ale io3iyd aDel(vo;(0 exrifcio1omtrlu slt trtr(opou1om emivsltfs2rrxmoot0aex mietydlaDua(vo u0tleoif tatlm  ln i;t)seuo(r ny1lm emfvta() Dtm(r ou0ale  iciasfmDra(vp;t)arxrxf3totfmD  iei;()trtmxr3oy1lp elfetl(faDur(ronu4aetnmfctyt s2eanvon() eermoctodlpte n s;s) rxmiopou4al elics sf Drm(ro;t0alenmo3iltfsDua(vs;t4altomfcio1fptrln o;s  etmxo oudope  fci ()artm(mpno0open f3iadfa rmu s u0tlxoir3tatlat lnes s0s2xrxopnudopt  fesas)artmx pou1aleoiieils aDua( on() ltriocoodoaDr nvo;s)teurimpoo4llenmfvilsf Dtrum ot0olt ioeiltlm2raumonu)tltoxf iotoaDe u ilt0srxoxo3no1lptnlnesltf 2tmu  nt1tltnifeiys sDea(vp u)trxrircootfaDeaieslt)seuo(r3iudame  ict (f 2ur(  ou4oeto i3iatfa2rl( snu0texoir io1lpDeaneils setmxm3nu4lptn fei s s2raxrp;t4opeoifctld aDumn s (0arenioctydomDeau i;(  exr(r3ny1oltnmfvtls a2umu  ;t0tptn o3tltlsDelnvpnt4 rtomr iodlpD  nvsl()teuoxm3iudole lies tf 2trxmpoo1oex ifciydla2ulumont0tlenxf tydoaDr nvols0 exoxr ny4op e nvilsfartrxmo;t4tlxo o3iydlsDelnvs t0 renif3oytopt  ivs t) etoxr ny1open nes t) 2ra( poo1alxoiociysla2ulnmon() eenmr3ta1fmD  i i ( trtm(r3iy1alenlnci s sDtaum nt4apt iiciadfm uaump u)aexrmo3todla elnvi;s0 exoim3ou1open fes sfarrax  no0alt if3tlsfm umnvp u)aetomf3tytlpDr u sls teumxrpnu1al nlfctl(farrmxm no4tlt mi3ilt s2rm(von(4tltrmr3oo1lm   ivo;(0 2umxmpoydame  neiltfa2uax pou1aetoifetldlsDul(mont) leomf3iodomtr nes (0seuoxm3ny1opeemici sfsDumumoou4tltoifciydfm2el(mon()areniocoy1lmt li s s0 rxrxopiodopte ncs ( a2ra(rpno0alxomfctld sDumnvs;t0 exrxrcia1fpt  nvol(0 2xoxr3iy1opt lfvt sfaDrm(  nt1oeen feildfmDemnvsn(0aetrxf oytlatr ivil( truoxo ou4ap   neslt)s2umu  nu0teenmi3iat sDeanvp;t0arxnmrciytlpDraiei;s setmxr oodome lnvi s)a2umu p;t4olx  oetlslsDulnmp;(4arxnxociotfatelnvo;t trtmir3oodol e iei t sDraum oo1aet mi3iytlmDrau o;(4 lxrmf3ty1om r nvo ()s2urirpiy1ol  mnvi tfaruax  nu4texn oetat aDua(mpnt)texrir3oo1opD  n sls srxoim oy4lle mivtltf rtmxrpoo0tet mieils a2el(ms u)trxnxfctadom  aivilt0s2uoxr3iy1lpt  nvsat)a2umum no1oex  oetaslaDeaumpnt0trenir3ty1omtr i o;s)s2uriopiudllenlnvs sf Dtr(mpoo1tpxo i3iltfa emn snt4 exnmfctadoat ai i;t0texriopiudome  fvt tf rurur nt1olenmietydls ulump u4tleoxo oo1lpDeluvilt) rtoxrpou1omte fetas)srurxro;u4tlx  o3tlt m2em(von()alxoxr tatfm eauvi t)s2xrir3oy4ol   fvt s sDur( p;t1opx io3ildfa el(vs;t4alxomocoadlm eauvi (0s2uoxr no1lp nlnesls)aDtaumpno0opeomfeiat s2eanmp;(4trtrir to1fm rauei (  exrimpnu1om e fcsl()aDtax ooo4oltoif3iytfaDraumo;t) etrxf3ta1lp eluvs;s) 2xoxm3ny4lpe mfes t srrrxr ;u0tlt ioetysls2el( s;(0 rtomo3ty1oaDr uei ()sexmim3iy1olenlietat) rtmurp;t4opxn octyd aDem(vpn(4 rxnmf oadop eaieslt0t2tmim3no4opeemnvs tfs2trxmpou1apt ioctyt sDuau p u4teeoio3tadfp elnvolt)trtmxr3iu4ap   fvsatfarua( ono4tpx mieiadfa2rlumo ()arxrmoctytoate nes;s)teuo(o3iy1lm nmnes sfs2ur(mono1opxomi3iadlm2eanvp (4texnmr3oytfmDeluvs;s0trtrxopiodlleemfetl(fsDurxmoou4oexomo3tatlm em(vo u4 etoxfcia1oaDean ils0truo(m iodlmtnlfciatfaDtmumpnu1tlxnioetys s2em(vs t) ltnmf3ty1oat ai i ( truo(o iydllen ietatfsDrauro;u0apx  oeilsfs2emnvs t4arxomo3oa1faDeanei ()s2toiopoudaleemnesat arraxmpoo0tpt mo3tyd mDrln o u)tlxrio oodfaDelu s ()s2ur(m oo4lltemietasf rua(r nu1opxoifeiyt sDemumsnu0aexnxr totopDrli i;s0teurimpio4ape lnes (fsDurxmpoo4oetomicilsfsDuanvpn() etnmrciadlp rlnes;() eurxo3ny1olenmietltfsrtrxr ;t1tpt mfciydfs uanms;t0teeoxo tatlm   uvi t) 2um(r3iodomenmicsat)sDrru pot0aee ioetas m rmump;u)tlxrxr3io1omDrau s s t2xr(r3ou4ap   netl(  rtmuro;o4tet  f3tatla rln s;t4aeenxf3tydoaDrau o t0teur(m3iudalte icil( aDtmxrpnu1alenii3iyt s uauvp (4aetomr tatfaDr n i;t  euo(mpiy1apenlfesltf 2raxmp;u4oeeomi3ias sDrmuvo u4texnir3tadfptrlu i t  eurxrpiu1lptnlnvtltfs2ra(mooo0tpxomieiydlmDemn snt4tltnifciadlmDr uvi s)sexmxm iodll   ictlsfarur(moou1apx ii3ilt a rl(vs u0tleoir ia1om raieo t0trxoio oydameemieias s2rmxmo;u1oeen o3iadfm emnvp u0aeeoxrciadlp r ivo t0setrio3oy1ll nmnet s) 2urxmooo4aet ifctlsfa2rlnvp;t4 lenxrctydfmteaiei;()sruo(opiu4amtemneil(f rrru  ot1opxn o3iydfs ea(mo () rtnxo3oodoaD  neol(0 eurxopou1alenlncslsfsrtmxmont1oetnio3ildls2el(mo t) etrxfcoytfaDrlnvilt)s2toio3io4op  lnes sf Dtmum nu1tleomo3ilslsDua( s t0tetrir tydfmtranvs s)s2xoxm3iy4op nmfvsl() 2urxm nu4aptoioeiat mDrm( pnt) reoxo3ty1fmteaiei;()s2trxo3nu4opeelfcilt) 2urxroot4teeoiiciys m eln sn(0 rxoxo3oy1op  an i s0 eur(opoy1optelfesa(fsrtrur ;t4oetn ictlsfsDrmn o t0alxomrciydlaDeln s s s2xmir ny4amenmnct s sDurxrpnt4alen f3tls a2rlnmo;t0 eeoxrcoa1la e u ols trurio oy4om n nvs t srurxroou0oexnioeild m umumo;u4 lxnxf3tatfpteai i;s)srto(o3io1lpee ici s) 2rmxmp;t0apxnio3tyt a umnmpnu4tltnif oydlmDraivi;() exoxo3io1lp e fcia(  2tm(m ot1tetnioeiyt aDulums t0arermr3oadomtr nei;() 2xoim nu1op emfvsls)srtm(moou0tleoiieias a rl( s ()altrmf iy1oa r ueslt) rtoiopiodom   fes ( a2tmur ou4aptn i3iatfs ulnmp (0 renxfciotfmt lies () euo(opiy4altnmicsls  Durxrpoo4tee mi3tldfaDemuvs;t0 rxrmociy1lp elneo (  ruoio3ny4opt  iesl( aDtm(rpou0tex ioeiys mDumn pnu4artrircto1om raies () eumim nodop nlivsa(  2umu oou1aeeoiieildls uaumpnu0 lxrir iotlpteau s;s0tetm(r3iudam e nei t)a2um(rp;t0apen o3tld aDrlnms;() renmo oo1fp e n olt)texmimpoudoltn ieilt) rraxmo;t1ale  f3iyt a2rlnvs;u4aexrirctatfa  aueo;t)srxmiopiu1lmt  fei tfsrtmxrp;u1openif3ias a2emnvs;(4aeenxr ia1oateauvils trtm(opiu1apeemfesasf 2rax  ;o4aeto fciyd aDuluvp t0 rerio3iadlaDrlu s;s)setmxo3nudale lfei s)s2raxr no4tlxnif3tls m2ean s t)teenxrctotla r u slt t2urio oo4omt  fei sfs2rm( oou4aptoiietyt sDemuvo;t)aexniociatlmt anvo;s)s2xrxrpiodlp  mnvsls) Dtax o;t1apenifeiyt mDua(mo;u) eenir iy1op  aueslt0trumxr3ny1omeelncs s)srtmxmpno4apxn fciad s rlu p;u) exoio iadfpD lneo t)srtoxo oy1lm  lfvsas)aDrru onu0olxn o3tysfm uan p t4altoifcoy1lpDr neils)sexmir ou1olenmict tfsDumxroot0aet  o3ilsfaDrauvp;u4arenmo3iadfat  nvo (  2toio3io1ol   fcias  Dtr(mpoo0apxn oetltls el( o;u)aetoir3tadfa r nei t0s2umir3io4omte nvslt)aDuau  nu4tlenmo3iys a2rl(vp;u4 reoifcia1op  lueilt0 rtmxmpio1am   nes (fa2rrurpnt0oet  ieiltfmDum(mo (4 exniocoydlpDran s;t) 2uo(m nodamtnmivia(f Drrumooo1oltoioetytfm2eanvsnt0 eeoio3oo1opDe uvs t  2xoxo3iu1apenlfeta( aDur( p;u0texoiieiasfsDrlnmon() renir tatfm   ivils0teto(opio4am  mfetl(fs2ur(m no0teto ociad mDuln s;u)alxrmf3iadfa raies ()trto(o3nu1lmen ictlsfsrurxm no1alenio3tatls2eanmonu4 eeniocoa1lmD lu olt trtm(r3oy1lpt  neiat)aDra( ooo1aex ii3ils s em(vo u0alxrxo ta1lp r u o t srxm(r3iu1lle mnctl( a2rr(m ;u0tee  f3iysfsDelnvsnu)aeenir3iadfm rauvo;(  rxoxo3iudol nmietl( a2ta( pnt4tex  ociltfm umnvsnt0 etnxo iatfmD  ieslt) etr(m no1alt  ivs tfarua(r ou4aptomi3iad s um( on(4trerif oodfmtrai s s0 rxm(opou1ap nlfvt s sDrmxm ;o1tlt miciltfm rmnvpnu4alerxo to1la ean ol( srumirpou1lmeelieta(f Drmuro;t4opx mf3iytfm2rl( onu) rxrifcoydlat li o (  rtr(o ny1op  lfesatfs2raxmp;o1aex ii3iasla2emnmsn() lxnio3oytfp  auvsl()srxrxmpnodlp nlnvils sDumxrpnt1alt  ociatfs ea(msn()treoif3ootfpt  u sl()srumio iudlpee ies sfsrta(m oo4olenmicilsfm2rmn p t4tleoxrcoodlaDeanvi;(  2xm(mpoy1ope  ieia(fa2tm( pno1tltnioctas s2ran s u) exrif3iatop raiei t0 euriopoo1opt mfcsls a2rm(monu0aetoifeiaslsDemuvs;t0tleoxr3oydomtr ivil()srurxr3ny4am nmivsa()arrrxmo;u0olxo ocias m2ulnvo (4teeomr todla elu s;t0srxr(m no1lm elnesa(fsruax ooo4aex  ieilslm ra( ont)tlenmo3io1lm e nvsl( t2to(r3iu1lptn neslt) Duax ooo4oet ii3ilt m2rmnms;u4altnxf tadomt li olt) rxoiopiydap emfviat  Dtrx ono0alx  f3iat mDra(mo (0areoircto1op   ivi t)s2urio oy1alen feiatfsDra(mp;u4alx  iciytfs uanvsn(4alxnioctodomte uei;() 2umxrpou4ame mnes tfsDraxmp;o1texn fciltlaDemuvp ()arxnmrciadlaDelu i;()sexm(m3oo1ll nlfeilt  2tmx onu4ape mocils s uanvo;() exnxrcoadom r ivo;t) 2xrxo io1lmee ivil(fsrur(mont1oetnmi3tysls umump t4tltnxr iy1lmDelneo;t0sexoio oodamee fcsltf rtrxm ;u0apx iieils s ranvo;t0 etrxrcoa1fa elneolt0 rum(rpnu4lm nlneilsfarrm(ro;u0tee  oetldfaDul(mp u0alenxo3iy1lp rlnvo;s  etoim3nydlptemnvs t  rtm(m nu1alt  f3tldls2ulnvs;(4 exnmocio1opteaueo;s)srtoxm3nodomtnliviat)srurum ;t4oexomociltla ul(vo;(4 reoxrciodoatrli o;s0 ruo(o nydlmenlnci s)aruru ooo0tle mieias s2ean pnu0aeeomocoydfpteliei;t0 rumxmpno4llenmnei s a2uaum ;o1oetniociydlaDrmu p;t0aeerxfctodfpDe uei (0truoxr3oo1lmtnmnvias s2tax ooo1opt moeiat aDelumon(4 lxoirciodfaDrli i t)srtm(opiudapenmfctls aDtmuront4ole  feiydlmDuln o (4teerxo iydfpD lnei ( s2xr(m iu4op   fei t srum(rp;u0apt  fciasfa umnmsn() etnxr3oadoa  livil(0trxmimpou1apeelfci tfs2tm(m nu0apto oeildlaDulnmsnt0aetomo3todfa   u olt0setm(rpoy1lmenmnvsat)srumum nu0aeenii3iadfmDrauvp;t) exoxr3tydlp  aues s0 2uoxr3iodlpeemnctat)sDrax ono0tle mfeiysfs rlu s t0tlermo oy1opt  neo s) 2xo(o oo1amt mnvias  Drru o;t4tpenmf3iytlsDem(mp u)artnmo3todfmt lu slt0t2uoxrpnu4omen ies t sDrmuro;t0altoii3ilsfm2ul( p (0arenxociy1lat aivo t)srtmxo iy1op nlfcta(farumurpno1alx mfetysfm ulnms;t)tlxnmo3to1oa e nesls0seuo(opoudom  lnvslt)srua( ooo4alen octyd aDelumo t)texrir tydoaDeaieils0 rumxopiu1omeemnetas sDurxmooo1aeen o3iltls uaumsn()trxomo3iydlm  aies;(0s2xoimpiudlpenmfci t sDur( pnt1alx  iciatlm rmn o;t0altrmo ootlatrln s;s srxrir3ny1am nlictlsfs2tm( poo0texniieiasfm rlums t)arenxoctotfateluvol(  eur(m ou4apt lfci s arumur no1tetomieilsfaDeanms u0artomo3iytfm e ues (0 eurim nudapenlieilt a2tr(rp;u0tetniociadfmDeau snu4aexrmf3ia1lp r neil(0s2toxopou1lpeelfet () rrm( p;o4tpt mf3ildls rmumo;u4tltrirciytomDrlu i ( s2umxmpiy4ameelivilt s2ta(roou1apt  oetlsfs umnvo;(4 rtoir3io1oaDrlnvols0sexrxm3iudameemnvia()srrmur ;t0tle mociasfa2eaums;u4artrxr3oytfpDranvil(0s2xm(o nydom  mfvsat)srum(  ;t4apxn feiytfs2ulnvo t4aetrmo3ootoa  livols)trtr(m3iydal  livils srtmxrono0aexn i3ilsfsDrl( s t0arxoio3iydlm rlivols)trxo(m oodlmen fetl(f Draxr nt0tlxomfctls sDuan o;t)areoio3tytfaDr u o;t  etm(mpou1lptn fes t arrru onu1aeto iciadfa rl(vsnu0aetrxocoytfmtrai i t srtoxr3ny1omenlnet tfaDurumoou4tpx if3tytls rlnvs;(4 etnio ootfat au slt)trtoir iydale  ivilt  rrm(m nt1opt  fciasfs2rl(mp;u)aetnmr tatfa e u i;(0 2xmirpnodalt  ieilsfaDtr(r nt1oet mocilslaDeauvpnt)alenmo3iodoaDean olt)sexmim3oy4op nlnetasf Duau pnt1olxnmi3tls m rl(mo;u4alenmf3oodoat  u o;( trxmxo iu1opt  nctlsf rua( ono0aexnmi3tlslm2emnmo;t4teeoxr3tatom elu o;t0 rur(mpiydoptnlnvi tfa2um(rpnt1alxo o3tyd m2rlumo;(4 rxoircoy1fp ranesls t2xrir3oy4oltn net () Dta(ront0ale mi3tytla uau s;(4 rxnxo iodla e u ol(0s2trxr nu4alenmnvsa(f rtaxr ;o4opxnmiciytfm2ra(mp;t)tetoir iodlaDrluvi s  rtmir3oy4ol nlfetlt) 2rmumpou0tex  ociltfaDeanvo u4 lermr oytlaDrli s;t0t2tmio3iudap  mncsl( a2rru  ;u1texnmf3tatla2rauvo;()trtrmr oatla   uei;t) 2to(o nydlmt mnesl(  ruaurooo4oetnmfctlt mDra(vp;t0texnmr3io1fmD  n s;s0 2tmio3oudale mictat s2ta(mont4tetomociydlm rl( o;t0tetnif3oa1opt  neo;s)sexrir nu4lm elfetatfsrtau p;t0aetomoetad s2um(msnt0tetrmoctadomDrai s;() rtmir oodamt lfvs sf 2raxrpnt4optnii3iys mDrmuvp;u4texrmf3tydlm  aueslt0 exmim3nydale livtltf 2taumpou4opto f3tldls2rmuvo u) lenio3iytom ranvi;() 2tmxr oo4llt lneslt  rur(ro;u1tet  o3ias a2uln o;t)tetoxociadla  ln o t  2xm(o3ny1op nlfvsls)s2urur ot1tle iieiys mDrmn p;(0 etnio oydfptraivo;s s2tmimpou1lm nmnei sfarurxmont4alen i3tld m2umnmon(0aetrmf iadfaDe ies ( setrxrpnydal nmneiasfa2raxm oo1teenii3iad sDuau p;(4arxoxf3ootomDrau o;s)srtm(r3iy4lm  lieil()sDrru pou4alx mo3tyslm2rmu sn(4 etoxf oa1om r ivsl(0 rxm(o3nu1ope lnvil()a2tr(ront1tltn oeilsfsDul(ms;u0tlerxr3iydla raueo s  2tr(rpio1op n fciltfsDua(rpoo4tltoifeildla elumsnt)texrif oatlm raueols srxo(m oydopeemivsasfaDra(m ot0opxomfciat s2rmu snu0 etrmf3tatfpD anvs;s0t2trxr iudolee ietls)a2uax ono4optnif3tasla2rlums ()arxoxfcoatfmDraues s)t2xoxopno1am nmfci (f rrr(  oo4olt moeiysfmDemuvonu4 lxrxrcoa1oatrauvs t srxmirpoudalenmics tf Dua( pou4tlenmfciasfs rlnvpn(4 rerio iodopDrai i s trxo(r3io1apeeliet sf Dtr(rpnu0oex ifctltfsDuau o t) exrxo3oytoptraueo s seto(o3no1omeemfciat)s2rmx  ou1opeomi3tadlm emump;() lxniocoatfmte n i ()setrxm3io1alt livtl( s2tmu oou4tpt  fetltfaDeluvp t4arxnxoctotfmt lnes t  2umim3iu4amtnlfei (  Drr(mp;o4optnioctlsls eau o;u4 eermf oodom   ivi ()trtrirpoy4alt  ivtas srur( oot0tpeo oeiysfmDrm(vp t4trtomo oa1lm r uvo ( srtmim3iy4ale mfvi t s2rax p;o0olx  icildlmDemums (0trxomo3iotfatranvolt teumxo3oo1omtelnvtlsf 2taxmpot4opx ioctyd sDrmu p u0 rxniociydfa e n sl(0 2trio nodlme  fvils a2ra(rpoo4opt iocilsls ra(ms u4aeerio tadfpDe ivo;t0t2xrir3nudom  lies ()srrmxmpno4tleoioctatla ul(mp;(0 rxriocta1op r n o;s)s2tmio nydamte fvsa( a2rr( p;t0tptomietldfa2umu p;t4arenmo3oodoaDrluvi s)setr(o oodopte fcs s arrmu oot0oeeniictyslm2ea( snu)arxnxo tatom eau slt0 eum(r3nydom e feta()srta( o;t1tee  ictytfmDrlnvo;u) reoxo3ia1op e ues t  rxm(m3iodlptnlnct s)s2ta(mpot0teto o3iysfsDeau o;(0arxrxf oa1fa eanei;(0 etmxo iu1amtnlici ( srrmur ou0tpe ifeiat aDeanmsnt0 renmo todlpDrai ilt)srxo(rpnodol n nci s srur(  ;t0alt mf3tatfm2emu pn(4tlermf iydfp raivi t0t2xrimpoydome  fvi (f Drr(r ;u1apxoio3iyslmDrm(vo t0arxrxocootfm ean s;() exrir oy4ape lnct (  2rauro;t4tee mietltlmDuanmpnt4aetomfctotfmtr n o;t) rtmxm no1oltelnetl(f ruru  ot0aexnmicilt m eaumpnt)trxoxr3iadom e ivi;(0s2ur(o nodlle lnvta(faDrm( p;o1oeto iciad s ra( p t) etoif oo1oaD aneils0s2trxr iu1aptnlnctltfs2tr( o;o4tpxnmo3iadlmDua( p ()altrxfctydomDeai o ()trxm(m iudlptnlncilt)srtau onu1opxn o3tasfm2rluvpn(4texnir3oodfmD  ues;t)s2xo(m3oodalen ietlt  rtax pou4aet iicild a umums;()arerir3ia1opDeanvo;t)tetoio nudol   feilsfsDtru p;o4optnii3iltfmDum( pn()alxrmr3iodoptr u i;t  etr(r3oo1lpenmfcilt sDtrumo;t0tlto ociydlm2ulnvs;t0alxrioctodomD  i o t trxoxm ou1om  liet (fs2rm( o;u1olxomoctltla2rm(mo u4artrif3ta1lmDr ivols) 2xmxm3nodllenlivsas) 2rm(r oo4alto icildlsDrluvp u0tetrmo3totoate ueo;(0sexr(opny4aptn fcil()s2raxrpno0teeo fctld s umn p (0 rtnxf3oydfmtelivol(0 rum(r3oudop nmiei t s2rm(  oo4alxo fctld aDemu s;u) lenmo to1lp elnvo;s0 rtoiopou4lptnmnvtat a2trx  oo1tlxomociltfmDrlnmsnu4texoxf iy1fmDeaues;t0 2uo(r3iy1ll elnvt s  rtrurooo1aex miciatfmDuln o t0 etnifciydop eli ilt0truo(m nydalt  nvtl(fartr( ooo1ope if3iadfaDrmumo t4aetnifcootlmtraueo s0s2urir3no1omeemnvsa(f ruaurpot1apen ociyt m ul( o;t4aleoiocoa1lmD lu o;()s2xrxo oodllee ictlt sDrmu p;t4aeto iciad s rlumon()aexrifctodfmDr neo (  2xoio ou4lm  mict s  rrm( p;u1aexnifeiys sDum(msnt4alxomf ootfpteai i (0 exrirpiy4aptemfetas)arraum nu0ope mfcilt s2emnmp u0artnirciatlpDeluvils)srxoxopio4ome mivia(fsrtm(root1aee moctyt a eluvs t0trxnio totlaD lneo s)setm(rpno1lpt lfct s)srrru oot1aeto o3tadlaDua(mp;t) rerxo3oodfa  luei s0t2toir3iy4alte iviat)s2uaxmp;o4opxn ietydlmDemnmpnu0texomr3to1lpD ai o;t) eum(opiy4amt  ncs ()artaump;o1opt mictlslaDuauvp u4texrmo3ootfaDraivo;( srxm(m nodaleelnei ()sDtrx  nt1oeenmi3iadla umu p;(0aexrif iy1lp  luvo t) ruo(r3oodapee nvils srrmx o;t0opt io3iat m2eau snu)alxnmfciodlmDe i i t)srtmxm3iu1apenmnctat)sDumumoou1openmoeias m uanvon()tetnio totfpte uvs s0 2uoxmpou1opt  ivsatf 2tmx pou1tet ii3iad aDem( onu0 ltrir iytlmt auvo t)t2umxm io1om  lieil() Dta(rpno1tlenifciltfaDrm( o;u) rxnmr3todom elivols)trxrxo3oo1ll elfcilsfsrtmxrpoo1optomociad s ul(mo;() eeoir ta1fm eanvs t0 2xm(m iudllt mnvta( s2rm(mpnu4aexoiiciyd mDeanvon(0alxoir3ty1fmD luvsls) euoir3no4om   feiltfaDtaxmont1optoifciyd mDum( ont)aetoir iatfp elnei;t0s2tm(r nudlmen ietl()s2taur ;t1tlx ioeilsfsDrl(vo;(0 ltnir ta1lm   ueilt)s2xoir3iodam e nciltfaDrrumo;t0aetnmfeias mDul(vp;(0 exnxfctodfpDelnvi;s sruoio iodop  livtltfarum(mpou0ale iieiytfmDran pnt)texnircta1lp   nei;s0s2xm(m nu4alt mfvs t)aDraxrpou1apxoio3ildfa el(ms;t)trenxr tadfatrlu o (  2trim oydalt micsas s2ur(mpnu0tpxniiciasfsDum(vs;t4artnxo3todopDr ivi ()s2xoxm oo4ole  iciatfaDrr( p;t4alxoiiciltfmDrm(mpn() leomrcoodopt lnvi s s2tm(m no1olt mfeta() rraur no4oeeo ictysla rmnvs t0 lxoioctytomDrlneo;t)trtoxmpno1ome mnesl() 2rrumono0tpt if3taslsDraumo;t4aetrxo3ta1oa e ues ()s2trxrpio1ap e ietlt) Dtmu pnt0tleo oetlt m rauvon(4altomr3oytlm  lu sl() rto(m3oo4ll nlneias)a2umx  oo0oltn feiyd mDrl(mp (0 ltoircio1op  lieils0t2toxrpoo4lle  nci t sruaurpou1aleo oeiysfs rauvs u)aetrxo3totomte nvi (  rtrxo oodolt lfesl()aDumum ;t4opt iietyd a rm(mp;(4 renxf ty1fat aueslt setm(o3ou4am nlfesl(  rurxrp;t1tpeo o3tad sDel(vo u4tlxnmr iatoaDe ieo s) eurxm3io1am nmivs ()aDrrx o;t0tpxnifciys s rauvp;(0alerxo3ia1oateai o;t teuoir3io4lmee ietl(fs2rrx  ;o4opeomo3ild m rlnms u4 lxomf3tatlp  aiei;t  2um(m3nudolenlfetls aDraumoot4aetniietyd m rauvpnu)texrmf iatlpDr ueol(0 etm(mpny1omeelncsls s2trxrooo0tltn fciadfa umnmo ()arxoio3iodlpDe nes;(0s2to(opoo4opte fvilt s2tm(  nt4teeoioeildls2rmu s;(4tlxnmfciatoatrluei;()t2tmxr iydlme mivsa()s2taxm nu4tpenmoctls a ra( p u4 lxoxr oytlm rlneolt0sexoim3oy1op nlfesls) Dumxmoou1altnmictasfmDumuvs (0 lxniociatoateaueo;s t2ur(r iy1lm emncias arraum nu4aleoifciasfsDrlu p t0alxrmr3iydfaDr u sls srtm(mpno4lmtemfei t a2rrur oo4oet  oetatlm2eluvo;() eermo3iodlaD livs;t setoxopio1amte feil( s2rrur ou1aex  f3tytfa el( pn() eerxr3iy1lmD anes;t0t2uo(rpio1al nmnci s s2rmum ot1opt ii3iadfs2em(mon()arxoircoodoaD lies (0 euoir oy4lptelivilt a2taurpno0aex  f3ild m rmnvp u) etrxo3iadfpDrluei ( setm(opiudlm n nei (fsDuau p;o4tptn feiadlaDuan o u) lenxf tytfa eai ol( s2trxopiydol  micils) rtm(r ot4apt io3ild a elnvp (0alxrmr3oatfm elneo (0t2xm(rpnu1lpt mnci s) rrr(r ou0ale iieiadlm rau o;u0trtomfcio1fatraueilt)teumio oy4ale mfes s aDrax oou0opxniiciltfm ul( pn(4 lxrxrctadfaDrluvo;s trtrxr3iy1om n neta(fsDtaurp;o1tpx if3ildlm rl(mo t0 rerxr3totlmDr u o s0tetmim nu1olt lfvslt  2rmu ono0tlxoio3ildfm2rmu on(4trxoio3tydoa raiei;t0teumim nodoltelivtas)a2tmx p;t4oexoifetltlm2rl(von(4alxnir3iydfmD li s s)s2trxm3nu4alen neslt aDumump;u1tpe mietyt aDrmuvp (0trxrio3iatomte u sl(  euoxm ou4ap n ics t)arrrurp;o0apeo i3iadlsDran o;t)tltrxr3ia1opD an o;s) rum(opny4ape  fvi sfarurum no0tpenifetlsls el( pn()tetrmfcoytlatean o s)s2trxr ou4apt mfvsas)srta(rp;u0ale mfetat s ranmo;t4texomr3oa1om rli i t0 rtoimpou1lpenmfes s) rta(m no1texn ieilslm2uau snt0 lxnmr iy1fmDrluesl()srumxm3oy1amt lncia(f Dumx o;t1alx io3tytfs ra(mp () lxnmo3oadfaDelivilt)texo(o iy1alt mfvt t  rta(ro;t1alx mociysfm2rluvp t0 eeoio3totfa r nesls teum(o3ou4opt  ivsl( sDumu ont0tptnmo3tldfm2rm(vp ()aeenxo3iadlmDrai sls sexr(r3iudllt liet t  rra( onu4tpt  i3iysfa2ulumo ()tlenmo ty1fmD lneol( sruo(r iodaltemnet ( s2uau o;t1tpto o3iyt a2rl(vpnt0aetrmf3ty1omtrlivol( setr(r nodlpeemfcsatfsrrru poo1tpxn ociysls uauvsnt0 rtoxo3ia1opD  n s;t  2tm(opoodape mfvsasfaDtrx  ou4tpx  o3ilsla2em(vp;(0arxoir3oy1faDrlnei;s  rxmxo oo4oltelnetl() 2urxmpot0tee  ieilt m2ulnvont0alerxoctytopt  uvol( s2tr(rpoo1ope lnesls s2tmurp;o1oltoiieiatfs rlumpn(4tlxoxo iadlm   ieo;s)t2tmimpno4am nmnesa( s2tm(ro;t1tex io3tydlaDuan s t)tleoxo3ta1lmDe nvs ()trxo(r3io4apee fei (fs2rmxroot4aptoiictasfs2ra(msnu4trtnircoy1lp  aneo;( srtmxm ny1alte nvs t)a2rmumpnu1tee  ocildls eauvs;u) lenmo oatlp rlneo s)texm(m io1ome mivs t s2ur( o;u4tee ii3iasls ra(vp ()aetnxr3tadfa e i i t)trtriopny1ape mivs t)a2uaxrp;o4oee moetydfs2elu snu4tetriocio1lp rlies;t  2tmxr3oy4omenlneslt)s2raxm ;o1oleo o3iad s2em( snt4trxnxrciytom elivil(0sexmir oodapeelneil()srrax p;t4apt ioetas a elnmpnt4areoio3iadlptelivsl(0 rxmxr3oy1om   nvils a2ua(rono0oleoiietadfa2emu s (0tetrxr3oytlptr i s;s0 etrio nodllenliei tfa2tmu p;t1oexoioetyslmDumn s u)areoxf iy1fmt  i o t) rxo(o nu1lm  mivi t artmxmont4texn fciydfmDran p (4tlxnxr3oydfa r uei;t texr(rpno4lptnmivtl(  ruru poo4oexo f3tyslm2ul( o;t) ltnirciy1om   nvsls)s2xrxopno4opee ncta(fa2rm(rp;u0oleoifctasls2emums u)tleniocootfa  auei s0seuoir3io4lmtnlfei tfaDrr(monu4apto ietldfs2rlnvs t4 rxoxfciadfmDeaies;t0 exmim3oy1lptn fvias  ruru pou4alto fcilsls2rlnms;u0 exnmrcoatom eanvol()s2to(o io1lp   feil()arrm(mpoo1teto oeiasfm2emuvo (0 eenif iadfmDeaivi;()s2xo(o3oo4amt lnctas) rrmxrooo0alx  oeilsls emuvp t) ltomocio1lp  aivo;s0trtm(rpou1om eliciltfsDraxmonu1olxomoeiydlmDumnmo;(0texrmr3oadoatranesl( t2uoir oudam  mfci sfarra(mpoo0tee  ietydls rmu o;t4tetnmfciadopD  nvs () exrio ny1am   fvias)sDtm(moou4oexomoctlt m ulu s;(4tltnxr3io1om raneo () 2um(r ny1aptnmnetlsf rtrumpoo4oet mi3iytls2ua(vo;t0 ltrir oy1fm r i ols) 2urir iy4ll elicsatf Durx pnt4teenmf3tasfm umuvsnu) eenmocoa1lp  ln ol(  2uriopiu4lm   fcsltfs2uax ooo0oeenmf3iyd s2rlnms u4texrio3tadla rlnvs;s0 rtr(r iu4ol nlivtl(faDuaxmo;o0opxomociydla eanvpnt4 lxrxfctatlatrau sls s2toir no1ol n netat aruaurp;o0aetniiciad aDrlu ont4 lxnir3ia1faD au i;s s2trxm iu4ll nlict ( s2rm(r ;u4tptomfeiyslm ulumon(0aetnifctadlp rli o;s teur(r3no1lm emfeta( srtmu  no4tlx iieias s2um(msnu) etrxo io1opDeanvs;t) 2xoirpnodolt licia(fsDtmump;t4oeeoioeiad m2ua( sn(0aetniociy1lpt liei s) eumxopny4optn neiltfsDtmu onu1aexnii3iatfsDea(vsnu)teerxo3ta1fa eanvslt s2tmio iu4lpt mnvsas s2ra(rp;u4oexnif3iyd aDrlnvo u4aeermf tatoaDe u sls t2ur(r3oydamtn icilsfarrr(rp;u1optnmfeiatlaDraums t0tltrxo iadfpD anvo t)srxrxr oy4lpt mneil()a2trx pno4apt  fctlt mDrl(mp;t0arenio todomte nes;()s2xoim3nudolenmietat) ruaur ;o4tptn f3iasfsDua( s;u)treomf todlatean o ( sruo(m iy1ll  mictl()sDua( poo0oetnmietlsfsDemnvo (0trxoio tytfpte ueils)tetr(r nudam nmicsltfa2taxrpou0tlenioctlsfa ea( s;t0tlenir iydopt aieils0srxoxo no1olee fvias  Dua(m nu0apxomi3ildls ra(vs u0aexoioctydlm elueols  2umir3ny1om e iet ()a2tmxro;u4ape mi3iysfmDuanmo (4 ltnio oydlm rauvslt)trxrxr nudllte fvsat srumumpoo0olt mo3iys s2ra(ms;t4trxomo iy1fmDrlu s t)texrimpou4amt lfvtl(fsDraum ;u1optnmfeiasfa2emump t0aetoif oatfat  n i;(0srtoiopoy1llt lnci (f 2tmx  ou1tpeomfetas mDrlnvsn(0altrmr iatop  aiei s0teum(r no1lp  mfvsl(fartr(roou1oltoioetltlm2umnvo ()aeeoif3ootlat ln o s)setrxopiy1om nlicil(fa2rr(  nu1oeen i3iltla2elnmo t0tetnxocoydla eli ol()teurxo3oo1optelnvs (f 2rm( pnt4ale  ieias m2um( p;t0trenifcoa1laDrau s t0 exrim3iu1al nlfvi (fa2ta( o;o4texo i3ias mDulu o;t4tlerir3oy1om rau s () 2xmio ny4lpt mfcils  2ta(m nt0ale ii3ilsls2umnvp;(0trtnmf to1lpteai ols)trxoxopnu1op  miei ()a2tmxmp;t1tptnmieiytfmDra( pnt4aeermr tadlate uvil()trurxr oy4omtnlfci ( arraurpnu4tptnmieiysfs rmump ()tlxnif3oydoa rli s;() 2umir3iodol nmfetas)a2rmurono4oet ii3tadlm2rlnmp;(0 etoio3tytfmDe ueols)t2tr(m oo4om emnvta()sDrrxr ;u1tpe  ociaslm emuvont0artoxrciy1lpDrai ilt seurir3io1ope lfcsltf rrmxr nu4tpt iieilsfm rlu snu4artnmocootlateai s () exoiopnudope lnvtatfsrrmx ono4alenmfeiyd a2ulnmsnt4texoifciy1op rli i;t0setrim3ou1opte ncia()artrur nt4oeenmoctatfs ulnvsnu4tleoxo tytlptrlueo t)setoxmpnu4ope mieils)sDtrum ;o4aeeo o3iytfm rauvo;() eenmocty1opDeaivs t  rtmxr nu4aptemicsl( srur( oou1alt iieilt aDum(vs;(0 leoio3oo1laD li s;( trxr(m3oo4ap   ivi (fsDuaxrooo0tptn fctatfsDeln s t0aetnxr3to1fp r ueo s setm(o ny4oltnmies tfaDraur ;u0tetn f3iytlm ua( s;u) eeomr iadlpDrauvo;() 2xoim3io1om  lictasf 2rrum ;o4oet miciysfs emu o;t0altomrciotfpteanei ()t2urirpoo1aptemneta( aDtmxro;u4alt  ociatls2rau snu)artrxf3oadlp rauesl(0 2toxrpnodlmt  fvi tfsDum(m nt4tlto f3iltfsDelump u)aexnif3io1fpDeaues;() 2uoxo iudol nliesls s2rmx oou4tetnmiciltfa eanmo;(0tetrxfcta1lmDelnes ( s2xr(o3oo1ol   neilsfs2rmum ou4alxoio3ildfs ea(vs;t4 renir ootfp e ueo;t sexmxo iu4alenlivt t) Drmuront1opxoifeiytls2uau sn(4arerxo3ta1opte ueo t trtm(r3oy4ome mncias  Drr(ro;o1tee  f3iatfa2ranvs t0 exnio io1op eaueslt s2trxr3iy4oltemfeslt)a2taxmo;u4aetoif3ildfs2um( s;t)tleoxocio1la   n i;()seuoxo3nydoptemfeilt sDtmu o;t1tlt mf3iat a2rln s ()texoircty1fptrliei s)texmimpnodol n fvtat) Dua(m ;u1oee  ociys a uln pnt) rerxrciotfm   i i;t srto(r iydopenmiesl(f ruaumo;t0aptnmoctysfa ulump;(4aetrxrcoadopD lu i;s t2trimpiu4ol n netas) Dumxrono0alt  ictydla ulumon() lenifciytomDr i ol(0t2uoxm iu1omtelivt ( s2umumonu4tpxoiociasfaDrmu p;t0treoxfcoo1lmD ai il()srxo(mpoydap  mnei s aDtmxmpno4oetnmi3ias aDelu o;t)alenio3ia1om e ivs;(0trur(m3iudomenmivtat  2tm(m ou0opt  oeilslm emn s t)aeeoir io1la  aieilt)seumio iu4amtelfvsat)aDrauronu1oleoifcilslm elums;t4aexnmrciodla rai i s0 rxm(m oo4lm   fesat sDur(r nt4tet mfeiydfm2rlnmsn(4tltomr3tadfpDeau i t)s2umimpoo1alt mnetas artmx  ;o0tpeoii3iltfm eauvsnu)teermfcootfmt aneo;s srumxrpnudop  mfvsls aruaur ;o0tpt if3iasfm2ra(mo () rxnmr tytlpte n o t0 rtoir ny4lmt lfctlsfs2tmu pnu0texo f3iatlaDeau o;t0 etrmfciatomte neil()teur(opoydamt mnvt sfs2tr(mo;u1olt ioeiaslsDumuvp;(4tlxoxr iadlmD aivi ( teuoxm ny4amtn ictls srrax pnu4oexo ietaslm2uaumo (4 exomo3iatlpD  u s;s0 ruoxr ou1lp e fvtlsfsrur(rpot4oeeomieiys s2elumo;u)aetrmf tatfa rai s;s0sruo(o3nodlmenmnetlsf 2taxm ;u0aetnii3iytfsDumnmo;u4trermrctytoat  uvo s t2trxo iu1op   ictlt)s2tmumpot4oltomoctat m2rln snt) eeoxocootoptrli s (  eto(mpiy4opeelnvilt arrru  ;u0alxoiieiyd s2um(vo;u4 exrxf3oa1lm elnvs;t0 2toim3oy1om n ieil(  rrr(r oo0tlto f3iadfmDuaump t)tleomf iydoa rluvo t0trum(m3iu1llt mfeia(fsDrrumpnt4oexn o3iyt a2eluvo t0 rxnmrcta1lpD aivs s)sexo(m3ny1ole mivsa()s2ua(roou1apeo fciadlm uluvp t) reoif3ia1omtr u sl(0setoir3nu1lmt mfetat) Drmum ot4tlt ifeiatfa umn onu4tlxrxo3oytfm ranei t0trtrxm iu1ap emfctl()a2tmumono4oeeomf3tltfmDel(msnu)aetoio3iytlat au i;t0t2ur(m nodopenmivils aDuaur ;o4ape ii3tytlm ea( sn()aetrio oytopteau i () rur(r3nodom  miet ()s2raxro;o1alxn ociadfmDel(vpnu0 exnir oo1oatelu ilt)srtoio3oo1aptemfet s a2tr(mpoo4olx mo3ilslaDulnvont0arxnxo3ootfptraueo;s)seuoxr iy1lme mfet (fs2ta(rono1oexoiietldls umump;()tltoxocootfa eli o;(0trum(m3oudamenlncsls a2ra( oou1apt iiciytfmDulnvo (4aetoif3oytlat lnvol(0 eto(o ou4open feta(faDrr( o;u1ope  fctldls em(vont4arxnif3iydlp rli i;(  rur(opoy1op elnesas)srta( pno0tlenmoeiyd a ran o;u0alxomr oatoatrlueo;t teumxrpno4omtemfcils)s2rmurooo4tex ioeiydfaDrln o u0 rtomfcoa1fm e nes t0trurxrpou4op   iesls  2raxro;t0oet mfctltfmDemn p;u)tetrircia1lm e uvs t) 2trxr3io1al   nei ( a2umurp;u0oltn fctys s elnmo u)texomr3oatfptr ivo s0 rtoxopnydap n nctas  2um(  ;o0olxnmoetld m uln s;()alxomfcta1lpDeluei t0t2umimpnu4amtnlies t srumu pot0aet  o3iys sDemumont0tlxoif3todoat li ilt)srxo(opnodlpt lnes t) Drr( p;o0tltoiietadla2raump u0tltrif to1faDeln s s srurim nu4altnlnvs () Dtrumo;o0tpenmiciysls2el(mp u0alxrif oytlp eai olt0s2xo(r3oudape lieilsf 2ta( pou0olt mi3iadfaDumnms;(0 eenio iotlpDrlivilt0 2trirpoo1lp  lfvs tfsrumum ;o0olxomfeiyd m2el(vo ()altnxo tydoa elivo s  2uoirpiy4olt mncs tfaDra(mpno1oleoifeiat a eauvonu0alxrxf io1fp  ln o;s) rtoxrpno1lm  mfcil(f rtmxmpno1oexnifctydfmDumuvs;()tlxoiociatlpt  ivi ()t2uoxmpiydlltn fcia(faDuaxmo;u1tpxniieiyslaDea(von(0 lxrif oodlpDrlieo;(0setr(r iu1olenlfvslt  Dtr(mpnt1opeomo3tltla2el( on(0areoxocto1fm ranesls) rxmxo oy1omt mnes ( srrr(rpou1oltomfetys a emuvs;u0 eeoir ty1fat  nei;s0trxmim oy1aptemnvsa() 2ur(mo;o1aee mf3iadls2rlums ()altrir3io1fp   uvi;t0s2trirpou1opt lnvsat aDtaur nu0oeeoioetytfa2rauvonu)aetoxf3iytopte neo t  rtr(m oydlmeemfvtlt) 2uaumpou1aetnif3ias sDrlu ont) etoifcio1fmteanvolt0s2tmiopiy4ame  iesl() Dumum no0tleo fcild s uln p;u) renmrctadoaDeai ils s2urir3nudom elnvilsfa2ra( ono0oltoiieiytlmDuan o;u4altrmfciadlpte n slt)teuo(r nu4op   ictl( arumxrooo0oetomoeiltfaDemu p;(0arenxf3ty1laDrlieil(0trtm(o3oy4ap nliei tfaruru o;t0aexo oetydfs2um(mo;u4trtnmr iodfmD an s;()t2ur(mpnodll nlictasf rraxmo;o4alx  octyslm ra(ms (4trxomfctotfmDe ues;t0teto(rpoy4altnmiei s sDtrum nu4texo feilt m2ea(vs ()tlxoiociy1lm e i s s) 2to(m3nu4llt  feia(fa2taum ou1apxoiicild a rm(msn(4tetoxfcoydopt lu s s0 exmxr3nydop nlfcsl(f rrr(r no0tlxo fciltlaDumumo;t) rxrmo3ta1fa raieo;()srurir3iu4oleelfvsltf rua(r ou4tpt iiciysfm2eanvpn(0trtrxr3oo1la elu olt)t2tmiopiu1ap  mfcsls  Dumumo;u1opt mocild a umnmo;u) etrxr tatfpDraues (0 ruriopio4omte icslt)a2rm( p;o1oeenifetytlsDrln o;(0tltrir3oytoaDraiei;s)srxm(opoo4ll elncilt)arra(r ;t4optn o3tatfs eanvs t4 etomrciatopt lnes;( setm(mpoudop e fei sfs2tm(m ;t4optomfciadls rlu p;t0tlxrxf tytlpD anvs;t)trtoxm3nudlltnlfvsls)aDuaxro;o1tpxomo3ilsla eanmo;() exomf oy1lmD lnesls0t2tmxo iudolte fci s)sDur( pnt4oleniiciadfmDua( o;(4 etrxo3oatom  aueo t0s2xm(o ou4lm elies s a2tax p;u0olx if3tydla eanvpnt0tltomr tatfp elnesls0s2toxm ny1lpeelfeta(fs2tm(mp;o4aexnmoeiasla elu s t4aeermrcto1la elu ol( seur(o nudal n nvtat a2rm(  ou1aet mi3ils a2rl(vonu4 etrifcoatlaDrli s;t  etm(mpou1lpt lncsl(  Dumxr ot0olxoiociasls2ulnvsnt4teeomfciadla r nvi;()truo(o3oy4aptemfesa()sDtr(m nu0aee  ieiysfs2ul( snu)tlxnmo oa1faDe ieols)s2umxr3ou4apt  nct s)srur(r ou0oexniieiadfmDrl(vs;u0arenif tadlmDe ueol(0 etm(m3iydll nlnvsl() rtaxmpnt0olt  oetadlm2emnvsnt)texrif3iytlaD aivil(0tetmxmpiu4
\ No newline at end of file
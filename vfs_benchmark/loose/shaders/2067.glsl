@@ -0,0 +1 @@
+u i t0tetoxr3iudom nmivsl() rumxm ;o0oleomf3ilsla2uanms;u0tltoxr iy1omDeai o;t  rxrio nudam e fvs sfa2urxmonu0ope ii3iytla2ea( o t) rxnio3ia1oa eliei t0 exr(m3oydapen fvsas  rtmx  ;u1tptoio3iytfsDran p (4teenio3oatlaDeaneils)teto(rpoydlleelfet s)a2umurpou1tltnmietyslm2umump u4arxoxfciy1fp  lnvsls)s2uo(r iu4al e nvtl()a2umum ;o4aptoifeilt m eanvp;t)alenif3iy1fm  li slt0tetmxm ny4olenmnvi ()arrru p;t0ape ifeiatfs2umu pnu4 rerir3iytomtelieo t)srtoxr3oydlptelfeta( a2tm( ono0tpxn oeiatfa ulnvs u4arxnxf3oa1fmDeau sls srum(opoo1ap   ivsat aDrru  nt1teeniiciysla2uan pn(0aleomr3tytoa eaues s0sruo(opou1altn nctat  Dtr(  nt0aexnmoeiat s ra(vp;(4aetoir3todlpDranes ()seumxo iudole lfet (  Drrum ot1tltn feias m rlumsnu)alerio3ootlmDeaueo;t t2xoim3iu4ame mictasf Durum nt4tlxnmf3iadls2umnvp;(0 rxnio3tatop eau s t)texrxrpnu4aptn neias)aDumumpou0aetoiieiytfmDumnvonu0areoxo iy1omtelies ( trurir oodoptn fvi s  Drrxmono4tetnmo3iydla2ra(mpn(4 eenxo3todfm r iei t  2xrxo no1ameelnct (f Dtmumpot4aee iociyt m2uan o;(0alermrcootfa   uvsl()setmxr3oy1amenmfctls  2trxmoot0alt  ocildfaDulnmsnu0 exoir ia1fpD lnesl()trtmimpnydopen nesa() rrrxro;o1apx iiciltfmDrmnvp;u4 rxoio3tadlmte ues;s) 2umxr nydlmtn ncias)sDraxr ;o1tee  ictldfm elnms;t4trtnirctatoa eaneilt texmxmpny4op emnvta( sDtauro;t0ape iieiytfm2em( snt0tetomfcootfatran s;s0trto(r3oudoptnlivtl(  Dtmumpnu1oltomf3ildls ra(vo;u4teermo iatomDeluvo t)seur(mpoodom e ietl(fsDraxr no1tptoio3tytls2uluvp (4tlxrxrciatlmtean ilt)trumio3nydlm  lnvias aDrmu pnt1tpto iciydlmDea(vs;u) rtomo oy1fa rlieo;s0srtrir3oodlp e fciat)a2ta( o;o4oeeomfciysfa2emnmsn()alxrxoctatfpDelneols)t2umio3oy1omt lfciatfsDuaur ot1ale  ociltlaDuanmo;()aetoif iytfmD  i slt trxm(o3io4aptemicilsf rtrurp;o1tpeniieiadfa2rauvo;u0tltnmo ia1fmD ai i t)srxmiopnodlm  mfet tfs2ra(  ot4oet  oeiydfa el( p;(4 lenmf oytlmtr u il(  etmio oy4llee ncsa( a2rru  no1tlen feiasfm2ra(vpnu)tlxnio tytfaDr n i;()trumxopiy4lm   fesl() 2trxmpot1opto oeiasla uanms t)aetrmfciodopt au i;s) etrimpiy1llt  icils)a2rm(m nu1tlxn fciasfa uan onu) reoircoadomt aivs;(0srumxr oy4apt lnei (fsDurur nt0olxomi3tat a2uanmsn(4texoifcia1fa   nvo (  eumio nu4ol nlivtls)aDta(mpno0aleomietltlsDemnvp t0teeoircoo1fp e iei;t0seuo(opou1omt  iciatfaDrrum ou0olx ifeiltlm uanmpnu)alermo3oodfa rlnes;( s2urio3nodlm   nct s artax o;u1apt ifciys a2ea(msn(4alxnioctydlp elneo (0teurxr3iudap emiei t)s2truroot4aleoio3tasls2ua(vs u)aetoxfciydfm  livo s0srtoxo3nydalt lfctls) Dtau  oo4aexo oetatfsDua( p t)tlxnxr iy1fp eau o;s t2to(r nudape lfcsat)a2ra(mono0tptomoeildfs ranmpnu)aeenir ia1lm  lneo s t2xrxo nu4lpenmnvs () rua( oou1tltn ieiytlmDea(mo;t4aexomrciadfpD  uei t0setoxrpnydlpenmncsltfs2ra(mpno4opx ifetys m uanvp;t0 etrmo3oodop rlues;t0trtoio iy1lp  mfvtatfsDra(rono4aetoioctldfs uau o;t0trenifctotoat an s;s trxm(opiy4am emfcs ( s2rmx  ;t0openmieildla2umu s;t4 renio totfpte u o t)t2xo(r ny1ll  mieias arumu oot4ape mo3tydfsDranmon(4arenmrcoadlmt  ieo;( setmxo oy4apt mnvil(f 2raumonu1alxo o3tysfm2ean p;t0texnmfcoodomtr ues;s)seur(r iu1aptemivslsfaDtrurp;o4tle  fcils sDea(ms ()arenmr tytlmtrlieo t)t2xmxm3ou1amt mies t srtrxr ;t1oeeoioctldlm2ua(vp;u) rtnmo tadfa eaueol(  rtrim oydoptn net ( sDra( o;t1apenif3iasla2rmn p;(4 exoirciy1fm r n il() rtoxo iy4openlncsat)srua( ono0tpenioeiydfa2eaums;u4 rerxo oodfmD  u il() etmxr3nudolee nct tf Dtmu pnt0oee ifeildls ea(vs;t)aeeoxfcootfaDrlnei (0 euoim3oy4llenmfvi t) Duaxrono0tlx moeiltlsDea(vs u)aetrir oydfm eluvi;s trtrio3ny1aptemiet t) ruaxmont0oetoioeiatlm2em( pnu4trermr ty1lm e nei;(  etmio no1lltemivi sfa2tmumoou1oltnmf3tasfsDrl(vp;t0areoxoctatlmDrli s ()setr(m3nudame  ivtl()arrru pnu4apeo oeildfa2rm(vo;()alxnxrctydlm r iei s  rxrxo ny1openmfci ( artm( ooo4altniictldls ea( s;u4 rtoio3ootfptr ivols seurxo iydlp e fei t  Draxro;u0alx  o3ild a2elnvs;t4tlxomr todopD an olt0teum(opnodll elfei ( sDtmu oot1oeenmieiydlm2rln sn(4 ltnir3iadopDrai ol(0trtoxm io4ll nlneilt sDrr(rp;o4tpeomi3iysfa2ulnmp;t)trtnio3iydfmt  n s s) etrir3iu1ol elictasf Dtaxrono4apxomoctadlm2um(vpnt4 leoir3iatopD livs () exrxo3iydape  nctlsfa2trumono4alx io3iltlm rm(vs;u0altrmo iy1oa r u o t s2trxm ou1omeemiviatfsrrm(r ou4open ocild aDrlnmo;u0altomr totfmteln o s s2umim nydll   ivslt)sDrm(rpou1aexn ietydfa2eau snt4arxoif3iy1oa rluei;(0t2to(o oydlltn ncias  ruaurpnt1tleoiiciys s um(von(4altrir iydfp  lnvsl(0s2xrxm iy1am  lnesl(  2urx  nt1texnmi3iasla rl(msnt)tlenirctytlmDean sls0sexrimpoudop  mivsat arrrxrono4oex  f3iys s2eau pnt0trtnirciy1fateli o s0 eurio ou1amte fciat s2umxro;t0aeeniociysfs ra(mo u4trxrxr oodomtrlu ol() 2tm(rpiy4omt micsl(f 2rr(root0tltoioctytla emn o;u)aexnxf3oytoa eluvs s)trtmim3oydlpe  fesatfaDrmuro;t4aleo iciat sDua(vo;u)texomf3oy1oaDeanei t s2tr(opoo4lmt mfeias)s2tr(mpnt1oleo ictltlm2um(mont)trenxr ia1lmtr n o t) rxoxm3iu4amen fesatfarrm(rooo1texn o3iytlmDemnmp t4trtoxocio1lpD anvo;()s2xoimpno1ole  fvi s sDum(rpou0texn o3iadls2uau p;t4arxomr iydoa r nei;t0s2um(r3ou1olt livs (f 2umumpoo4alxomf3iasfa rlumpnu0tlenxrcio1lpteluvo;s)s2xrim3iudaptn ivta( sDtax oot0aee ioetasfsDrlnvpnu4alxoir3oy1omtrlu o (0teumxo3iu1amenlictltfsDrru pot1opt miciyd sDrmuvp;t)arerxrcoytom  aieols tetoxopiy4lpt mfes s sDtm(rpno0tpeoio3tys aDean ont4 renio3oadoateai slt0 exm(r3no1alenlies t) Drmur nu0aeeomociasfa2elnmsnt)tetrxo3oo1lpteai o;( setmxopiodam emicsltf rua(mo;o0aeeo oeildfa um(monu)tlxnmrcto1la rai o;t setoiopoodlm n nct ()arua(rpnu0olxo octyslm2em( s;u4aetoio oa1faDraivs s0trxrirpiu4ap nmfvslsfsrur(mpoo4olt mfcilsfs2rl( pnu)trtrmf tytom r nesls s2urxmpiydlm   ivtltfa2uaxm ou0tleomoctlt aDemnmo;(0 leoxfctatlm elivs;s  2tmir nydame  fcsl( s2urxmpnt1tlx mfeils m2ea(vs t0 leomr3tatoaDran s s)s2tm(r3nudomtn fvi ( arrm(rooo1oetnio3iys m em(mo;t) ltrmrcty1faD  iesls) rtoirpou4omtnlfcsa(fsDraxrpou4tex  oetys m2ra(mp u) etrmrciotfp r ueils0 2xr(o3iy4aptnmnvsas)a2ta(rpoo4tlt mfctlsfs2um( s;t)texoirctotoaDr u sl(0teum(mpou1ape mfvt t arururp;o0alt mfctlsfa2ulnvs t4 lxomrcoodlm rlueslt s2toio iu1am elies ( sDrr(m nt0tle mociatlsDum( o;u4texoxociydlptrluvi s)s2xr(rpoo1apt livsa(f 2ra( pot4ale moetlslaDrmumo (0tltnxfctydlat  u o;()setoim3oy4lmte nvta(  Dtru pou0oeen iciatls rlu pn(0trenxr iy1om ran s;t0s2uo(o3ou1amee fcsa()srumurpnu4oetniictysfa2rm( snt4 etrir3ty1fmDe ivol(  exoxo nu1lltnmnci s sDrrxr nt1aeeoii3ilsla rlu p;t4 etrmo3oo1lmtr nei t)truoimpiy1llt  nesat)artmurp;o4opt iieiaslm2um(vo u0trermoctadlateluvi;s t2xo(o ou4ap emictat) rrrurp;u4aexn o3ild sDuanvp;u)aetoir oo1om rluvo t) ruoxr iodlmtnlictltfaDtmxrono4tlt  oetasfs2ra(mp ()aexomr tydomte nvs s)t2to(o oo4lltnmnvtasfs2tr(rooo4oeeniociltfsDea( s;u)trtrmr oa1fp   n olt) euoimpio1ame  nvsas sruaxr ;t1oltnmiciadla2em(ms;(0aleoio3oy1fmD liei;s sexoxm iydlm e fvs () Drruroot1ole  oeilsfa elnms u4aleoxf3oytfmD  neil(0trumiopny1lp elfcilsfa2ta(m ou4aex ioeias m ua(vs t0teeoio tytlaD ai sl() 2toirpoy1lme mfci sfa2rr(mo;t0tltomoctys mDuauvp;t4altnirciodomD li i;t0 2xmxrpio1ape mnetlsf Duaumo;u1optnmf3iadfm ulu o;u0 ltoif3tytlm eauei;t0sexmio oydam elncia(f 2umumo;t4opx if3iysfs2el( o u4alerirctotlateanvi t0t2tr(opnodlp nmfet s aDua(m ;o0aptn fcilsls2rlnvs;t4 rxnxocty1opteli o (0texoir3oudll nmnct ()a2tru  ;u0oet  fctas m2el(mpnt4trermf iotfpDe neils)trxoirpoo4omenmfvtlsfsDrrurooo4tpe ioetlt s2rmn snu0 eenxo3oydoptelneo s t2to(mpiodamt lfvil(fsDuax pou0teenmieiasfm rl( sn(0trtoxr oytla eaiei t)s2toxopnu1lm  mieslt arraurp;o1teeoiieiatla2ean p;u4arerxo3oatfmDranvols) rtoxr iodap  lfvtasfartax p;u1tpenmfetls s uanmo;u4texoirciodopDeauvs t  rurxopoydamenmfvi t arumxm no0ope iociydlm um( o;t0 rtrmo3ty1op   ieol()trtmxm3nudamtelnvt () Dtrumpoo1alxn o3tydfs2rlumsn()tetnmo3todomDrluvi t) 2xmxm iodal e nvs ( artrxm ;u1ape micildfa2uln sn()artrif oa1fm  lu i;t t2xrim oudopt liesat)aDurxm nt0tlxn i3ils a eau o ()aeenmf3ta1oa ranvsl(0srxrxr3nodllt lnciatf rum( ont4ole  iciaslm2um(mp;u)alxnmo3iy1oatr uvolt setrio ou4lltnlieia(  rrr( pou4oetn iciydfm2elnvpn(4 exomo3todfa rlu slt0texoxm nu4alenlfctlt) Drm(ro;u0olx io3tlsla rmuvs;u)trxnxrcto1op eai i;s)teuoxr3iu4llt lfetlt)s2umx  nu0tetomfetld a ranms;t0aexnmrcty1omDeluvo;(  2ur(opno4lm elfetlsf 2urxrp;t1tetoii3iytfm uluvs () reomo3to1lm  lu s s)sruoxm iodam nlfvi ( sDrmxrp;o0tpe io3ilsfm2ean o t4tleoxrcoatom  aivo;()t2tmxm no4lp elnct (faDurxmo;u0tptomi3ild m uaump;() eeoifcoydfaDeaieols0srtoir oy1altelfvilt)arraxrpou1alxnmfeiyt aDem( s t0tlenxr ta1op e n slt)teuoxr nu1al nmiviat aDrmx  ;u4oee iieildfmDeauvonu4 ltnmfcoa1fa r nvilt0trtrir3iydlmt mfetas  rtaum ou0oex  fcilsla rln onu0 leoirctadfatr ivi s0 2urxo3oy4al nmivia(  2rm(mp;t4tet  ocildfaDul( o t4treomo ta1optr n s;t)trxr(r io1amte ivilt)arumxmoot4altnmieilt m uaums () etrxo3io1op r n i t)s2trim3oy4ll nmnct t)a2rm(mo;t1aexomi3tyt m2rlnvo;() lxnif tadomD  u s;s0 etm(m iy1omt lnvtat)arta(r no4tlx  o3iaslm emnmsn(0arxoircoydfaDeaueo;t trxmxm3ny1ap emnei (f Duaumpno0ope  ieiytla2rmn p;t) lenircoydfm elieol(0s2to(o oy1ape lnctasfsrraumonu4aleomieias m rln sn()tleoxociy1optrli ols sexmir nudllen ivsl(fsrtaxr ou4aex  fetlsfm ea( s u0arxnmo3iydoaDe i o;s0texo(o oudameemfvta( s2ur( onu1alx  f3iad s2uluvp t)aexrmr3todfm raivil()trum(r iudam   fcilt a2rr(rpoo0oet ii3iytls2rmuvont) eeoxocoo1lpteaivs;s  rtoio nu1amenlivs s aruaur ;u0olx  fetlt a em( pn(4 exnxo oatlpDr ieols srxrxr3iu1apt lnet ( aruaxrpot0tlx mfetlsla2ranvs;(0 rxomf iadfaDrauei;t  rurxr iodlp  liet t  2rmxmonu1oeen fetyd m rm( o;t) leoxo oa1lm  ai slt0trtmxrpoy1amtelictls)arra(rpno0apt ii3iysfa2em(mo u) ltnmoctotfpDrlu i ( trumxmpny1op e nesatfs2ur(  ;u0aee miciydls ra(vp;(4teermf todoatrlies;s)srto(m3ny4lmtn ics sfsruau  no4oee ifciaslm ra(mp;u4 rxoif3iydoatr uvo;()seumio oy1lm elfeilsfa2ra(r nt1ole ioeilsfm rmuvo ()trenmr3oy1fm   u i (0 eurxopoy1aptnlfvsas  2raxrp;u4aleo f3ildfm raumsnu0texoxfcoy1oaDeauvs;()srtoirpoy4am   ictlsf Dtmu oot0opt mociytla2rl(vp u)alxrirctatfpDraneolt  etoxm oy1lptn ivs ()sDtaurpnt0olx mietat s ul( s (4tetnxr3oadfaD aues t  etm(m3iodal e ivs tfarua(rpoo0tee  feiaslsDuau s;u) eerifctydfp  luvo;( srxmir3io1lp emietl( a2ta( onu0oleomoeiat aDra(vp;()aeenxf3to1om ran s ()s2xrxm iudamt mnetas)aDraxr ou1opxnifetls a2emnvsn() etrxf iatfm e ivi;t0 etoirpiudomenlieta( aDtm(mpno1oltomi3iasfmDuau pnu4 rxrmf totlpD aieils trurimpou4amt lictasf 2rmxmpnt0olxoiocilsls2ra(vpnu0 exrxo iotlmDeli i;t)t2xo(m ny1optnmicta(f rtm(monu4tlt  iciadfmDea(mp t0texnif to1lm r neo t sexmxr iy1omee ivils  Dumxro;t0tlxnmfetat aDrm( onu0treoxocoydop r n o t0texoir ny4am  lfvsls sDtm(rp;u0olxnii3tyt sDuau snu) eerxr3iadfpt  ivo s  etoxo3nodomtnmfviatfsDur(ronu4aeen oetld aDua(mo u0aexnmfcoo1lp   i ols)sexmir oodlpee icsls)aDtm( pou0tleoiociadls2eanvp (4tlxrmr3oydfmD  n i ()s2trxm oy4lmtn nvtls s2umxronu4apt  oeiydfm2el(vp;u) eerif ootopteluei ()srtmxr3ou1ol  licsas)a2rmurooo0tle  fciatfm ranvs (4 rxrxf oadom r ivilt seuoxmpiy4am emnviat)sDtru  ;o1apenmo3iaslm emn onu0 exomo tydlm  lu o s sexm(r nudamenmfvtl( s2tmx  nu1apt iieildlm eau p;u4 rtnircoytlm ran i s)t2xmim3io4lpte ivta() Dtmxrp;o0oeeomfciaslm2ul(vonu4 exrifcto1fm  ai o;t  2xrxrpoydlleelncs ( arraumpnu0alx  f3ilslm ean s (0artnxf3oytop  lu i;t0texoio oy1apee iesatfa2umurpnu0oleomo3iydlm2em(vs;t)trtnxfctadlaDelnesls0setmimpio1lmeelies ( aDra(rpnt4oeeomociydfsDum( o u4artnxr3tatlaDrai i t trxrio nu4ll e nct (fs2tr(  nu0apxnmo3iad m ran snt0artnmfciydfa eanei s  2um(r3iy4lltn nvt t)sDtrurpot1tpenmieiysfm2ran on(4altrif3oodfmt aneo;t texoio3nudom e iciasf 2uaxm ;o0tlxo ociyd a2elu o;(4 ltomoctotopD  i olt)s2um(r io4om emicta(  2uax onu1oeto f3iltfm ua(mpnu0altoxo3iy1omDraieo ( teumxo no4amtelictat)s2uau p;u0alenmfciatfm rauvs t0trxnmf3io1omDrlivsl(  exrxr3iy4am nlfvslsfsrtru  ou0oleoiocilsfmDuluvsnu4altoxf todlaD  iesl()t2xo(m io4am e nvsls)arrmx  oo1alto fetltfs umu onu4 rxnmf oy1fp e i slt tetr(mpou4amtn nesa( s2uaxmp;o1oleoifciadlm2rauvs;t4texoif oy1oa elues s)srxmxopnu1ap nlict (fsDtmxrp;t4tlx iietatfa2rm( p t) ltomf3oydlm e iesls texmxo nu1al  lfvtl( a2uaurpou4oetoifetys mDea(vs u4arenmocoa1lptrai ol() rxr(opnodolenmfeia(fsruru o;u4aptniociltls eln p (4 renmo ootlateaneilt0 ruoxo3ny1oltelfet (fsrua(  oo1olen oetyd mDumnvp t4trxnmr3iydfpteauei s) 2toxr3iodoltnmfeia() 2ur( ooo4aee mfciysfs rm(vo;t0aetrxo3tydfptr nes (0srto(o iu4ale lfeta() Dtau pot4opt io3iyt mDrmuvpnt0tlenxo oadop  aiesl(0teum(r no4ape lnvtlsfa2rmurp;t0apxnifeiyd s emn s;() rxoxo iotfpDelues;s) 2xo(m oy4alt  fcilt)aDtrxrooo1oexomi3iadlm eauvs;u) etnir3to1laDe uvols) rxo(o3iu4op   fetat) 2tax onu1opxoio3iytlm2uanmp u4 lxoif3oodlmtrau i;s0trtr(r io4ll nmnctat srrru p;o1opxnmi3iydlm2ulumo;t)aetomr tytfptr ivols)s2toxr3no4amt lnvt tfa2raxmp;u1tltomo3iasls2ea( s (0arxoiociydfaDr i o t)t2xo(r ny1lleemivsat)artm(ro;o1aleomietas s2elumo;t4trtrir to1fpt ai s t0s2tr(mpio1oltemivtat)arrmxrpno0apxn fetad mDum( o u4trxrxo iotomDeln sl(0teto(opno1llenlivta(faDrm(r oo4tpx ii3iys m2ul(vp;t4tleoxfcto1omDeaiesls0trxrir3oy4ll  mneiatfaDuru p;u4tetomf3iytlm2ra(msnt)aetrircoatfpt luvs;t0trurir oy4lpen ivsls)srur(mpot4aexn icilsfm rl( s;t0alxomo ia1lm e ues;t0 rtmxr3ou1amtn neiatfs2uax ono0oleniietatfa2emnms;(4arxrmf tytfmDrlu s;t s2tmimpoo4olenmnei s) rra(r ot1aex mociad s rlnvo t4artrio3to1lpDe ivo t0trumiopio1openlfctasfsDrr(m ;u1tpxoio3ilt a eln ont4artrxo3to1fmtelueolt setmirpiydaptemict ()s2ra(ro;o0altnmoeiatfa2ea(msn(0tetomf oatfp eln slt)texr(mpoy4apenmfvtls) 2rmum ot0tltoifeilsfm rlu snu)alenifctotfm rluvil()t2toirpoydom  lfvs () Drru  ;t4teenifeiytfmDum( o;u)trtnxf3ty1opD  u o;(0t2toxo io1ol e icsltf 2rrur ;u4ope mf3iytlaDel( s (0 renircty1fa eli s;s0 eto(rpnydom   nvi () Dtmxrpoo0oltn o3iltla2ulnms;t) lxnxrcoydlmD an o s srtriopio4omtelfes t)s2rauro;t4aexnif3tysls2umuvp;t0tetrmr3oatfateaivs;t  rtoir nudlptemict tfaruru  ;t1aex  f3iaslm ul(mp;(0aeerxf oa1la rau s;(  rurxr3ou1amtnlfeiat)sDraur ot1tlenmociadfsDelumonu) rxnmo tytomteau s;(0 rtrxm3oy1ape lnci tfaDurxroot1optnio3tlsfa2ulnvs;t)tetnmrciy1lpD auvo s seuoim3nu4oltn fcta(fa2umx o;u4oleoif3iyt s2ea( s;t4 eeomf to1la ran o s s2xo(mpiu1ale mietls)srurx p;o4teeoio3iasfa rmnmo;u)altrxo3oytlaD lneols  euo(r no4llteliet t sDtrxrpot1aex mociydlm elnvs u0tlxrmr3to1lmD an i;( t2xr(o ny4olt lnvslsf ruau pnt4oleoifetld s2rm(vo;t)aeeoio iatlmtr i s;t srxmxrpnudapenmfvsa(  ruaumooo4tee  fciyd s2rm( o (4tlxoxo3iodlptr nvol(  etoim3oydolt mfeia( s2umxmpou0aleo icild m2rln s u4tetnifcta1opteaivs;s) 2umxr3oy4ole lfvsat  rrmxmp;o1aptnmi3tlslaDelu p t)teeoxfcto1fptr ueslt  etoio3nodol  mnviasf 2uaxm ;u4tptoifciltfaDemumo;u4teeoxf oodla eauvo ( teurxr nu1lle mict tfsDtaumpnt0olxoiictaslsDuanvo (0 rtnxrctydfaDrauei t trxmxmpiy1ole mieia( aDrru o;o4opx  fctld s2emuvo;u)aetoif3iatlmtr ivi ( s2tmxm3ou1omtnlncs tfa2tr(  ;u1tltn o3iytfsDemn o t0 eerxfciodopt lueo;(0trtmxrpio4lp elnvt s) 2uax ooo4oexn feiad s2ulnvo t4 exrmf3iotopDean i t0srtrxmpno4lptnlfvsls  Dua(  ;u1apt ifctyslm2ulnvp u4altrxr3oytfaDeluei;(0srumxo3ou4altemivils sDtmur nt4opx mieiat sDuau ont4tlxnxfcoy1fa e uvi s0trumxr3nodam nlictlt  ruru  nt0tet iiciasfs ul(mo;(4 eerxr iytfmDelnvi t s2trxo io4omtemics tfsrtm(rpno4apt  ociatfsDel( p t4 exomf3tytomD lneilt)t2urim3iu1apt lfet s  rur(mpou0olto o3ils a rln p;t) etoxr tytomDe i i s)tetoxmpio4aleemieia()a2rmx poo4apx  fetatfaDulu p (0 rtnif3oo1faDr uvo t0t2toio3ny4lme  ivt tf 2ur(m ;t1aptoio3iys s eln s;t)tltoxf ootfmDeai i;t t2xm(mpiodope  feslsfaDrrxm nt1alxo ictydlmDem(vpnu4aexoxo iytfpDelueo;s0truoxm oodopeemnctls) Draxr ot1oltnmicils m2rl( s (0 etomr3tadfatr nvilt t2toxo3iy1lp  lfvsatfarum(rpnt0teto feiys s ea(mo;u0alerir ia1lpDrau s t0 rtmiopio1aleelnci tfsrum(root4oetomieildlmDelu onu) renmr oodlmtr u ols0 exoio3iudlltn icsl( a2rrur nt4apx  iciydfaDum( p t0tlenir3todfate nesls0teurxopoodaltelfeia() 2rmurp;t1aex  ietaslsDuaumont) etrxr totopDr u ols  eur(o iu4am  mfesat)artmur ;o0tleoio3ilslsDel(ms;u) exoio io1op  anei t0srumxrpoo4ap e fei ()aDrm(r ;t1oleo fciyt aDelumsnu4altoio3oydoa rlueils) rtm(o nu1am   fcsa(f 2umur nu1aee  ociyt aDem(mo () lxniocty1fa eauvi;s0 eum(m ny1oltnlfei t) Dtax pot4altniieiad mDrmnvo t) eeoxrcoytfat auvols seumir iudomtemfes s arrmxroot1tpxnmieiat mDeanvo;(0 lxrmo3oo1lmtrluvil( t2um(m3iy4llen ietas  Durxr no0aeenioeiyslm2emn ont)aetoio3totomtelivo;t t2xr(m3ou4aptemnctat) rtm( ooo0tlxomoctlsfa2ra(vpn()tltomfctydlp e n i;t  rum(rpnu1olen nvtls) 2tmxr 
\ No newline at end of file
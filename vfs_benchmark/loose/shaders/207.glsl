@@ -0,0 +1 @@
+uvolt0t2xrxm no1op e fvs s) Drmu o;o0oeenmiciltfm ul(ms;t)aexrxrciatoaD aieil(  2uoir ny1om  mfcsa( artr(r oo4olx mietlslsDulu o;u4 exnxf3oatfmD ai i;t0s2uo(o oy1al elnes t arrm(mont4oex mieiatfm umuvs;t4alerxo3iydomtr ieo s0 exoiopiy1ol  lnciatf rurxmp;o0aetomi3ildlsDuauvs;(4alxoxo3ootfp   n s;s seurxm3no4ap elncilt)sDrm(rpnt1oexn f3tlt s rln s u) rxnxfciotopD anvols0trur(opou4oltnmiesa( arur(rpot4opeo iciydla uln s;t) exnxfcoatoa  liesl(0trurio nu1apeelfctls)a2umurp;o1texo ictatfa2umums t4treriocoydfmDrauvs;t setmxm3iy4openmnciasfsrurxm ;t0olt  i3iys sDumu pnu0 leoxr3ia1fa  lnvsls)texm(m nu1alee fesltfsDuru  ot4texo o3tysls ul( s u0 lxnxocoatfp e nvs s t2xo(o io4ol nlnvias) 2rax ont1apx mictatfa2ul( pnt4trxnif io1lmDrlues s) etm(r3iy1lmtn fvs s) Dtaxr ot1apt iictat a ean p;()altrxo3iy1fp rln ilt trtm(m no4llt miviat sDtaurpnu4oleo ociyd a elnmo u4altnxr3todopDrli s;t)t2umxr3oudlptnlfeiatfs2tm(m no1tpxo ieiadfaDua( p;t4trenif oo1laD auvo;t s2toxmpnu4ap n fvslt) Duaump;u0aleomo3iaslaDeln p u4tlenxo iydlp elnvo;s) eum(m oo1ll   fvt t)aDtr(mont1alt  fcildla uanvsnu0 leoiocty1oa  auvo;(  2umir nu4lptnmicsasfs2rmxmont4oexnioeild s rl(vs;(0 rxrxr oatlmDrln slt)trtoio oo1ap nlnei sf 2umur no0opx iieiat sDrl( pnu4trermf oodla  ai olt0s2toxmpoy4ole lnvtasfs2uaxrono4aeeo fctytfs el(vp;u) lxrxr3iatlmt aieols srxr(rpoydopen fcs s srrm( p;t0oleomocilt a2ea(vonu0texoio3oy1om r u o ( s2toxm ny4altemiei tfaDur(ro;u0tptnmoeiys sDum(vs u)arxrmo iatopDr u o s) etoxr3oy4lmt liciltf rtax pno0tpxnii3ild m2rauvo u)trxnmf3iy1opDe nei;(0 rum(opny1lpt  nesa(  2raumono4tlxo f3iyt m2rl(vpnu4texrir3tadfatraneslt)texmxopiu4omeelfvtat s2umxrp;o0oee mictltla rmuvs u4treomocto1fmDrauvs ()srumio ny4lm n fvsatf 2rrxmp;u4tpeo iciltfm uau o;t4tltrmr todlp eluvs s0teto(m3ou1omt mncils) Durxmont4tltomoeiytfm2ul( s;t)texrif oatfm r neols0 eumxm3nudopen fvsls)srtm(r ;t1aleo f3iad s em(vs () rtoxf iotlpt anes;s)teuoir oudoleelneslt arta(rpoo4tet mf3tls s ua(mo u)tltomr ta1fmtrau o t)setmxrpiudop  lfvt ( arrmurpno0ole mieiydfaDrln snt)altrxfcoatlaD aivi s)srxm(mpiodape lfcs (f Draum ;u1aptniociyt aDumuvo;u4areoxf totopDeaueo t)trxmio oy1ape mnct t s2tmu p;u0aexoio3tlsfa ulnmont0tlxoxr3tadfate uvi ()s2toim3nu4alenlnct (f Drau  ot1tlt  o3tyslsDeaumpnu4artoif totopDr u o ()texo(r oudalte icsat)srrmx  nu1aet moetlslsDean p t4aetnmr ia1lateluvsls) rumim3nudol   fetl(f 2rmx o;o4alx mi3tldlmDra(vo (0artrir3todfmDr u ol() rxrio ou1ome micsl( sDum(  nt4alxomieiyt mDeanmpn() exomfctytoaDrln s s0seurxmpiudlm  mfci t)aDrr(ronu0apxomf3ilt s umu s;(4 lxrxr3ootfmDeli i s s2trxmpnodam n net s) Dtm(mpnu4alxn fciadfsDeluvs (0tetoif3tytop raueo;s)s2um(r ny4lltnlfesltf Dtmumono0aeeo o3iaslmDum( p;()aetoir3oatlmDean sl( trxo(r3oodal nlieta()arrr(rpno0tetoioeiasla2emnvs t)teenmocoadfa  lu s ( teuoimpoo4al  mict s  2tmuroot1aetoio3ild s rmn s t)trtrmocoa1fmDrlivo t)t2umirpio4oleemivt (fa2raur nu4olenif3iltfsDeauvo;t0trtnir3ootfmtr uvs s0 2xm(opnu1oleelnci (fa2umum ou1tlenmiciasfaDulu o;u0artrxo ia1la r iei (  rxoxrpnudamt mivt t a2um( p;t4alxoiociydlaDulu s;t) rtrmr iodlmDrau i t  eum(rpoo1lpee fet t sruax  no0tpt  o3tyt aDuluvonu0 rxrir oo1fp e n ils0t2xmio3oodllenmfctat) rta(ro;t0apto o3ilsla2el(vs (0 rxnirctydfpD anvo s0t2ur(m iy4ll n ncias)s2ra( p;t0olxniictyt a rl(mo u)teerxr iodopDe ies s) 2to(o3ny1oleemivtatfa2trur nu1opxn iciytfmDel( sn() lxnxf3tydoateaiesls) etmxr iydalt lfes t)artm(m oo4tltn o3ias s rm(ms;t0texoxrctodfpteai i t0tetm(m3ou1al  mnct () rumxm ot4tpe  oeiys aDem(msn(4aexrio to1fm elnei ()srxr(opiu1ap  lnct t) 2tm( pnu4apx  f3ild s2elnmo t4alxoxr oo1oa  lies t  2xrir3io1llt lncs ( sDtaumono0tpeomietytlaDemn o u4teenmr3tatlpD au o;s)trxmiopiu1lm nlieilsfa2tmu o;t1tex ioeiys m ua(vs () lxnxr ia1latr i ols0 2tmir nu1al nlncsl( arta( ooo0aexn ociatla2rl(ms u0 rtnifctadfm r neo t0 etrxrpiydapeemfvi ( srrr(r ou1tlxn fetydfmDrauvp;u0altomocta1latrai s s seurim3oy1ll n ncsls)s2rax p;t1tee  feiadfa ul(mpn(4alenxr ia1opD  nei;t0trurxr3oudll   ivsltfsrua(r nt1aeen f3iltlm rau s u)artrmocoa1lmt anvs t0srur(o oudlmen icta(fa2rax pnu0optomoctatlm ea( p (4trxomo3to1fm rau i;t teuo(mpnydame liet tfs2rrxm ;u0tpx iiciys s2elu o u4arxrmo iadfaDr ivs ()s2trio3no4lptn icsat)aDtaxro;t4tex  oeildls2uaumpn(0 exnxr3oy1oaD lueilt) etmxr3nu1lmtnlnes sfarrax  nu0aptomoctasls umu o;(4tlxoxr oytomDeau ols)srtrxr3io1aptemfctls a2rrumpnt0optn ocilt aDrl(mpnu4areoxr oy1lat  ivo s0srumir oy1op nlfeias)a2trumpno1openmo3iad m eanms u4altrxo3oytfa r ivsl(0teumxm nu1lp e nesl( s2rm( o;t0olxo feildfaDul(mp t4teeoxfciytom elneo;() rtr(o3oudole mfct t  Dtrxm oo1oltnmfetat aDuanvon()arxoio tatla   u s;s  2xmim3iodoptnlfvilsfsDuax  ;u0tpxnifciyd sDem( s ()aexrxr oadfaDr uvo;s texmio oodlmeelfesls)srururooo0olt iieias a2rmu o t)trxoxf todlpDr u o s0teurim3ou1olte fvsls a2taxr ;u0oee mietasls rmnvo (0 etoifciytfmDeliesls0tetmxopio4amen fes sf rtm( pnu1apxoii3tysla2rl(mp;(0tlenxr3tydfateln s;s)truoimpou4lm n ivsat  rtmum no4optomo3tydfm2ea( s u0 rtrmr3tatfpDrln s;( sexmio3iydlptemnvil(farrau o;u1tetn o3tysfs2um( p;u4trenmr totop  anes s t2uoiopio4ol  miet t sDtm( oot1alx  i3tydla uan p;u4 reomrciy1fmte u i;( setmio nudoleelivt sfsrraxrpot0tetnmfctadfs2rl(vs u0aexnmr3io1faDe iei;t  2umimpny1lpe  fcs t)arrmx  ou1openiietytla2uauvp;u) lxnmocoo1fa ran o;( s2umxm3oy4lltemfvt (  ruax pou4olxoifciatfm eauvsnu)altnxf3iy1omtraiei (  exmim3io4omeelicia() rrax ono4opt  f3iasfaDuanvpnt4 lxrxocoatfaD lnes t)trxo(r iu4olee icslsfartmxrp;t1tle iocildls el(mp t)aetoxfciadopD aivi s  2uo(o iydlm elivia()s2tr(rp;t4aleo iciyt mDrlnvs;(0 eenmf3ta1fmDe ieolt t2to(o iy1altelnviasf Durxrpou0tetomieiatlaDrau p;u0tetrir3iytfmD  i slt) rtmir no1lp  liviatfsrraurono0opeoioetlsfa2emnvs t)artoio3oydlpD an slt)setmio3io4aptnmivslt s2um( oot0olx moetld mDrluvp;(0tetrmr3ta1oa  luvo;t teumxmpoo4olt lfvsat sDrrxr ;o1optoii3ilslsDuauvp u)alerxo3todlpD  ivo;t seum(r3iydomtnlivi tf Dururp;u4alxn i3tas s2el( o u4aeermr3tytlmD  uvo t trumim3iy1ame lnvia()aDtrx  ot0aee moetat sDumumo;(4treniocoatomD ln i;s0t2tmxm iy4lleemfvs s a2uru oou1opeo fetat m uanmp (4 renxr3tytlpt  uvo s)sexo(r io1lptnlfvi (  2rrum ;o4ape  fetasla2elnmon(0alenmfciotfmD ln ols0s2xoxr iudlm  miesls)a2tau oou0tpxomoetysfm2um( p;t)tlxnir3oo1la  aneo;()seur(rpiodaptnlicsatfaDtmumo;t1tlxo ietysfmDul(mo;t) ltnifcoo1lm rli ilt)trxmxr nu4altnmics t  rumur ot4teen ieiydfm rl(msnt) ltnir3tadopDr i ols0seumxo oy4ll elnvi t  Drrxmono1ole if3ils sDemuvo;t) etrircia1oa r ivils  rtmiopiy1ap   ivta()a2uau p;t0apeomiciadfa rm( snu)alxnmf3tydfaDe nei s srxrim nydamen feia() 2uru p;o0alx  feias mDumump t0tetnmf3iytomDeaiei t0 rxrio ny4ll  lncsa(fa2rr( o;t0aptnmictytfs2uanmsn(0arxrmo ootomt lues;(0s2xr(opiu1aptelfeia(f 2rau poo0apx mietysla emnmo (0tetoxrciytop  aivs s s2urim3nudop nlncias)artaxrpno0tpxnmicild m2rmu pnu) rxrmr3ootlmte ivs;()srto(rpiodaltemicilt)a2tm(m ;o0aet  i3tys mDum( ont0texnif3oy1la r uvsl()texo(m nydllenmieilt  rtr(r ;o0ope iieiyt a ul(vs (4tleoir oo1fm  lnvo;()sexrir nodom   neil( aDua(monu0apx mieild sDeauvp (4tltrmrctytfaD  u i s)t2urim iu4ol nmnctas)a2ua(rp;t4tpe  o3iys s2rmu on(4arxoif ia1fm  lnvs;s)t2umio3nu1omee fcs (f 2rmx p;o0tptoio3ilsfa rmumonu)tlxrxoctydla   uesl()srxmir iydll nlfes t) Dum(moot0apx ifeiadfa ranmo u)trxnxf oodfaD  nvi ()trto(m3oudlptemfesas sDtaur ;o0optnmocilt m2rm(mp () etnxr todfa rauvi t0texmxo ou4llenmncil()srrrxrp;o0texnmiciyslsDem(vsn(0trenmo ia1fpD  ueo ( srxo(o3ou4om nmfetas sDtm(moou4alt iietadlsDrlnmo;t0aeenxr3oytfa rauvslt)srtmxmpiy4lm nmncslt s2tmurp;u4ape io3tlsla2rl( onu)teenmo3tytfaD  uvs;t  exr(mpny4lptnmiesatfaDra(mono4tpxn icils aDul(vpnt4tlxrio ootlp   u i;t) 2xm(o nodllenlneias aDtm(  ot1ape  feiltls rmnvp;u0tlxomo iodlm rlu i s0 2toirpnudlmee fvtl(faDra(rpot4aet ifeiadfa rau s;(4tlxnif ootlptrln i;s)sruo(o3ny4lp emiei tfs2raxr nu4tpeo octls aDrm(mont)aexnmr oodoaD ai o (0t2xr(m3oo1ome mies s)aDrmurp;o1tlxomo3ias sDrm(mo;u0 eenxrctytop rli ols0srumxr3ou1lpe mivt t  Drrx p;o4alx  i3iltlsDrlumo;u) lermr oy1fmDeanvi;() exoirpnodllte fet t)aDrmumpot4tlxn ietls s2rl(vpnt) rtrir3ty1faDe uvs;(0sexoxmpnudole  ivtasfsDuax o;u1tlt mfctaslm uau ont) lenmocto1omt  ieolt s2uo(o3nu1alenliei t)a2umxmpno4altn ociytfm2ua( s t4arxomf3tydfmte nes;t  exrim3oy1lm elfvslt s2um(  ;t1tet  i3ias m2ra(vo t4tlxnifcoatopDe uvilt  rxrio ou4optelictasfsrrr(  nu4tlx ifciltls2rluvs;(0aeeniociadlaD aiesls  rxoxm3ou4opeelnct ( aDrmx  ou0alt  oeilsla2umu o;u)alenxrcoa1fmt lneolt  euoim nu1ap nmivsa()aDtm( poo4olxnmfctltlaDem(vp;t0 exnxfciy1oa eaivs s0seum(o3ou4ll nmfci ()sDur(  oo0apeo octys a ua( p;t4 rxoxocoy1lat  u ol() exm(mpiu1ol  mncil( a2rm(mpou1tlx  i3iasfaDel( o u0tlxrxr3tatfa r i i;(0 ruo(r oydlpeelfvt ()a2um(rp;o4opeoifetas a el(vpn(0 lenxrcoodomtelnvilt)sruoxrpoudlm  mncsa()artr(  ;t4tetomi3iydfs2umn o;(0 ltnmo todla elneo;() 2trxo3nudomtelnei tf Draum nu0olenmi3iydlm eanvp u) rtnif oydoa   ivils  rur(o3oo4omeemnet sf ruru oou0openmo3iytfa2uanmsnu0treoxrctodlpD lneils teuoim nodam e ncsl(farur(m ot1aeen ieiytls eau on()tlermf3ty1lm  ai o s)trtmiopoo1am nmfcilsf Drmxrpnu4tle ifetlsfs ulnvp;u0texrmf3iotlaD  ieilt0 exo(m3nydlptelieilt arrr(mono4aexomiciasla2umn pnu) leoir3oodfmDe ueo s  exmxmpou1llen nes s arrrxm nu4aleo i3ilt m rlnvp (4texnif3tatfatr ieo;s0sexrxmpoodlpt  ivs s srrauro;u4apenmictlslmDua(vo;t)aeerxfciatlmD  ues;()t2xrim3ny1lp   fetl(f rtmxmooo1alenmietyd m el( p;(0tleoxoctydoaD aieo;t) etr(rpiy4op  lfvsl( sDurx  ;u0altnmfciadls rl(vo (0aexomr oo1fm   uesls)tetmxr nydaltelies s  rtmu oou0tlenmieiat s umuvp (0trenmocoo1fm  anvi s0 2umimpoy1ap e fcsa( a2umx poo4oetn i3iadlsDul(vo t4 lxoio tatfpDr ieil( teurxr3ny4lm elfetat)aDta(mpno0apenmi3tld mDul(vonu4 leoxo totlm rau i t0trtmio3nudal nmfei () 2urur ;o0oleomoeiaslmDua( s;t4alxrxo3iatlpDr nvo (0texo(o3ou4ope mfvi ( srraurp;o4optn o3ils mDemuvsn(0aexrxr3oy1fateauvols s2to(o ou4lltn nes sfsDtauronu1opeoifeiytlm uanvp (4artnmrcootfp eli s t  euriopoy1ame mfvils)a2uaumpnu4apenmieiltfs em(msnt4trxomr oodlmD  uvi;s trum(o nodamenlfvi ()a2taxm ;t0oexnifctysfa ul(ms;t0alxrir totfaDrau ols  ruo(o3oy1op nlivs t)a2rmu p;o1tpxomociysfa eanmo;t0arxrmf3ootomD  uesls sexo(m iy4ameelfvtatfaDrr(rpot4oet ii3tysfa2rmnvpnu)tltnio iydopDr ivo (  exmir nudol   nesl(  rra(rpot4opt  oeiadfmDem(ms u4trxoifcoo1lp ran i;()truo(opnu1am emnesatfs2rm(rpoo4aptn f3iasfa2uanmpnu) lxomrcoy1lptrluvo;s0sexm(r nudap n ics tfsDraum nu1aex  ocils s rmnvp () rxoxr ty1opDraivols  rxmxopno4amtemfctat  rtrx pnt1tpxoioetat a ulu p;u)tleoxr3iadomDeli i t) exo(rpny1alt mfeia()s2ua(r ou4altnifeiadfsDul(monu0alxnxr3tadlatr iei t tetoxr3ou1ame lfcsat) rtmuronu0oex  i3ias a rmn p;u4trxoircoatfmt an o;t0t2xrir iydllte nei sfsDrru  ot1oee iocilsfaDuan o (4texrmr iatlaD lu i;s trxrim oodal nmfes s)aDua(  ;u4oeeniieiydfa2eanvonu0trenxfciotlmt ln sls s2xmir3nodapen nvt s) rrrxmonu1alxomfcildlaDulnvo;t0 rxoifcty1opD ln o s0s2toxo3oo4amt mnesls) Draxr no1optniictytlm rm( s;u4trtnirciodoat luei t s2tmxrpoy1lle  ictlsf rrru p;o1ape  oetatfmDrau s;t0 lxomo3oatom raivslt) rxo(r iodamen nesl(faDurxrooo4oeen o3tldfs eauvpn() eeomf iotoa ranvo t0s2xm(m3ny4lltelfcia() 2umxronu0tleomociaslaDrmnvo u0aexnxo tytfpDrlnvol()s2xrxmpno1olt mnctl( s2trurp;o4olxnmo3tldfmDranvon(4 eenxo iadoateliei (0srtmirpiy1llt lnciat) Dtrxmpno4tlxomiciyd sDeln s;t) rtoif oatoaD  i olt)teuoxo io1olenmfcsl( s2uax pno1olxo fctytls ea(vs ()aeenmr iodom elnvo t0trur(r3ny4lpenlncsas) Dua( pno4tltnmoeias mDelnmpn()texoifciy1fpD  ieo;t)sexoxo3io4ale  ivi t  2trxmooo4teen feiasfm2ra(vs u0trxnmrciy1oaDeaieo ()setm(r3ou4ll elieiatfsrrmumooo0tpe ifciltfa2ul(vp;u0 lenxr3oatla rlnvi s teumxo3nu1om n ivi (  2tmx poo1tetnmicilsfm raumont4 lxrir3iotoptrln o;(0truo(o3iy1aptn ivtltf rrrum ou1oetomoctys aDuan o;t) rtrmo iadopt livo s trurir3io1lm  lfeiasfa2rru ono0tpe mfeiydlsDua( s u0 rxrircoadlpDean i;(0 exrxm3oodalen netas  Dtr(rpou1tpeomoetydfa ran o;t0 reoio3tydlpD auei;t  rxr(rpiydlpt lnci (fa2uau poo0texnif3iltls2ulnvp;()aexnif3ty1op eaivs;()trtrir io4lltnliesatfsrtaur ;o1tpenifetltlsDem( s;t4treomo totfaDranvi s) rxoxm no4llen ieiat arrau p;u4oeeomieilt m2eauvp;(0 lxrio iotlatelieils0 eurxm3ou4apt  feiatfsrtmxmooo4tetomfctyt m um( p;u)tetoif iotfm rli olt seumxm no1llte ncsat arrrxmp;u4oltnmicilt m um(mont4artoiocoytfmteanei;()s2uo(m nodaptemivs ()s2ua( o;o4opx io3iytla rmumsnt4tltnmo3oatfp   i i ( sexr(m3iudopenlneil()aDrmx pou0teeo f3iltfs elnmo t)aleomf3iodfmte nvs s)trxoxmpiudlpeelics t) 2rr(mp;t0tpxnmieiaslsDean s;t0aexnir iatop eln olt  2tmio3ny1llt lfetls)a2umumo;t4oeeomf3iys a el( s u) leoxfciotopD an o;t0t2toxr io4amt liesa() Dra( poo0aet  ietadfs2elnvsnu0 ltnif tatfate ues;t srtmirpny4ale  fvils a2rrx  ot0oee iictytfsDea(vo;t)aetnmr oatoptrau i s  ruoir nydal nlivi t  2rmxmooo1opeomieild s2rmumo;u)texnio oa1lmD aivi;t  2trxm oydalte ieias arta(monu0tleo fciytfs emn snt)arxnmfcoadoaD  uvolt trtoimpiy4optnlfcta()sDum(mp;u1altoif3iytla ra(mo;(0 eenxrcty1om ean o s) exmxo iu1op e fcia() rtaxmooo1tlto f3iasfs rm(vp t)texomo totfm rluvs;s)sruoxm nu1lm e ncta()arrm( p;u0tltn octltfm2rmn pn(4 eermf3totla r u il( seuoim iydlmen ivi t aDtmxrono4aetnii3iysls2ra( snt0aetoioctatop r nvi;t)trto(r iydopt lfciatfaDuau o;o0olenmf3tasfaDeluvon(4texnifcto1fmtr ues;( texoimpoudlm nlivs () Dumuronu4aptn fetydfm rauvsnt0tetoif ia1lpDrlu o;t)t2tm(m3io1opt mnet t) rrmx p;u0olt iociltlm2umuvo;t)texnxf3iadfaDeanes;t  2umiopio4olenlicsatfs2ta(r ;u0ape iieiad mDelu s t0arenif3ta1lpt  u o;(  2xoxr oy4ope  fesltfaDrr( oot1oeen oetyt a rlnvonu4tetrir3ia1fmtrlueo;( trxoir nu4lm elneiltfarumxrp;u4oexoifeiatlmDel(vonu0 exrmo3tytlmDeanvi ()t2tmir iy4amee fcta(f rurxmono0oeenmf3iasla2umnms u0aeenirctotopD lnvi s) etmxo3iy1om  lietl(  2umxrp;o1tlen feiysls2rl(vs;(4 leoiociadopDrln s s  rurxmpiu1lmt lncil(fa2um( onu0texo oeilsfa rm(mp;u4aetrmo tydfatrlnvs t0trtmim3nu1alenmncslt  rrm(mo;u0aexn i3tyt sDrl(mpnt) ltrxf ta1op eaues;t)trumim ou1omenmnct ( aruru oou1texomictlsfs2ulumo ()tlxrxo todfp  au sl(0t2uoxo3oo1ole miviatfs2trump;o0oexo f3iyd mDulu snu)tetniocoa1fm  lnes t  rtmim3ou4op emfvtas)aDrax o;t4opxoif3tldlm2ea( s;u)tltomo3ia1omDraivo;(0 2xr(r oy4lp n ivtls  rrmu  ;o4opto o3iysfm eluvpn(4tlxnxf3todfm   n i;(0 rxrio no4lmen nvia(f Durxr nu0apxnii3iatfm umnmpnt0arerxo oodlmte uvol() 2um(r iudolte feilt)a2uau p;o1tptniiciyd a2ra(ms u4trxniocio1omD an o s)sexoiopio1aptnmnctas a2rmxrooo4oeenmicildfs2ul(ms u0aeerif ty1oa rai o () rtm(m iu1omt mnvs sfs2trx  nu1tpt  fciadfmDulnms;t) lxoxo3io1la   u olt)s2tr(o3no1omee ietat srra(rpoo4aptomfeildfa2rauvs;u4arxnif3iydlmDrlues;t trtrxrpio1apee fcsl( s2rm( ono1apx  oetys a rm(vsn(4 lxrmoctydlpt  u olt)t2tr(o oodll emneias)s2uaxrpot4teeomfciys mDel(mo u)arermf tadlptrai i;s seumxr oo1ol   fctl(  rtrxm ;o1aee mo3tltfs2em(vo;u)alermf3oatoaD  uvi;t teurim nudop  livi s aDtm(ront0ope miciydfaDum( ont4aeenmo3oatfat li il() rur(rpiu1al e nvt s)srrmu pot4altoii3iys mDumums;u0 lxnxr3oadfpt ln i s)s2toir3oy4ope livsa() rtm(mont0tpx if3iasfs2ea(ms t) exrxocoa1opD  ueils trxmxr nodopeemfei s  Dta(ronu0open fctaslm emnmo;u4aetrmfctytfpDr ies s) exo(o3ou1omenmnvia(f Dua( o;u1aetoif3iyd aDrlumpnu)tltnio oo1fate ues t) etoio3nudlm n ies sfsrra(rp;o4tpt ii3iydfsDuluvpnu4tlxnir3oy1fa e n ilt  rtrir oy1alenlnvsa( s2raurooo4ole  o3iad s ranmo t4trtoxr iodoptr u i s)srtrim ou1lm eliviltfsrumurpoo4olt iiciasfa ul(mo (0artnirciotfmDeau sls)texm(r nu4opt  feias)srtr(moou4tptn fctadlm ua( o;t0altnxoctodfm r n ilt tetm(r oydlmeemnvtltf rta(m ;o0opxnifctltfs2ranvont)trxrxr3oydlmtraneilt srtoxr3oy4ome mnct s a2urxmpoo4opx mf3tytfa2eauvsnt0altoirciytfa  aieo;s)sexmir oo1lpe  ics sf 2ur(mo;t4apt  iciad a2rmuvp u4teermrciytfpDelivs (  exrxr iudopenmnctls)sDumuront4oltnmociat s2emu o ()aexnmfctytfatelu s t)trtmxo3no4opt lictatf rra(  ;o0tltniiciasla ulnmpnt4trtnxrctytlaD aneo;s  rxrimpno1ole  fvslsfsDtmx oot0apto oeiad m rmn p t0arxnxr oatfat lieil()teumir ou4omte nctl(  rraur ou4aet if3tad mDra(vp;(0aeenmo oytopt  i o s0 rxr(o oudlpt lncias srurxrpot1teto o3iys a elumpnu0artrmfcoytoaD livslt tetm(opiudlm n ietlt srtmum ;u4olto icils a emnvpn(4aetnmr to1la   u s ( s2xrir iu4omeemfvsat) Dtm(m ou1tlxo f3iltfa um( s;u4trxoxo oadlaD  n olt)teum(r oodap nmnvsltfarrr(ronu1teeomf3iyd aDeluvp t4aeerifcoodlpD livi;()trxo(m oy4ap  lneslsfarrrumo;t0aexo f3iydfaDem(vp;(4trtnir3tatfmDeluvo;( texr(o3ou4lleemnvsa(fa2um(m ou0oltoiictys m ua(vont4altnmo to1lpD  u o t) etmir3no1apeemncs s) Durumoou0aeenmoeiasfaDelu ont4trxnxo ia1fmt aies;s0t2toim3nu1lm elnvs t)sruauront1aexnmo3tasla elu p u4 exrircta1oaD lueo;()sruoxmpoo4opeemfvil(faDumxm ;o4olenifcildls ulu p t4aeeomr3iatfaD aies t t2trimpoodlltnmnvsl() 2uaxm ;u0apxoiieiytlm2ea( o t)alenmf3oo1fmte uvs ( setrim3oudapee ietls sDrrxmpnu4oleo o3ilsla2ul(mont4 etnifctatfp raues;s)setoirpny4aptnmfvtlt)artm( pot4aptniiciytls2eaumpn()tetoxrciadoa elnesls)srurxmpnu4am  mncs sf rumumpnu4aeeoifeiysls2rm(mp;(4texnmo tadfa e i s;s0srtr(mpiudap nlicsa(  2rru pot1oeenioetatlm em(vpn(4 lenio3ta1laDr u ol(0 rur(o iudol emfeias  2trx pno4oexn f3iytfa2el(vp;u0 lxnio3oo1lp raieo;s)teuoio3no4omenlnvsl(farrrx  ;u0teen fciytla2ua(monu4 rxomrcoadfm rli s (  2xmxmpoy4al  mnciat  2urxr nt4apeniieiys mDelu o;t0 rxnxfciatfm r n o t sexr(o no4ll emfcs s aDtaxr oo0alxn i3ildlsDrlumpnt0areoif3iytlp r uvi t0 ruo(r nydaltnlictat) 2rrx pot0opxnmictatlmDul(vpnt) exrxociytfm ran i;(0 exmxo3oo1al  lnci (fs2rm(r ot4oex ii3iatfa2um(mp t)trxrmr oytomteaies;t)setmimpoy1opeelieiasfsrrmxrpno4optomoctld sDel(vp;t)teermrcia1faD  ivo t0t2xmxmpny1aptemneia() 2trx ooo1opt mi3ias a2ul(mp;t)arxrxfctatomD livolt)teumir iy1opee nctls srua(rpot4aee  feildlaDrmn p (0texomf3ty1fm   n olt  2xo(r iu4ll emicsat) Draxrono0tetoii3iltfm umumo;(0 rerir tytfmDr ivi;(0tetr(o3oydll emnvils) rrrx pno4ape  ociltla2eln o (4treoir3oa1laD auvols0setoio nodol e ivt (  2taxmonu4aexn iciat aDulu o;u4tetnxfcio1lpD auei t t2xm(mpoo4optnmnctltfsDta(rpou0oltnmoetld s2ran s;t0 ltrio oa1optrlneo;(0 rtrxr3iy4altnmncs (  Drmum ;u4apeniictltfm em(mpnt4trxnmo3io1la rluvo;s tetmiopio4lpen feta()sruru p;t0tpxn ocilsfa ranmo ()tlxoirciadfptelieo;()srtrxmpoo1omt mfeil() rraxronu4tpxomietatfmDum(mo;t)aetnmociotfmDr neo s)srtoxrpnodlm   ivia()aDtrxrpno1alto o3iysfa ea( o;u0altnxr3to1fate ivi;s0t2uoio no1amte nciatf rra(rpnu4oltomi3iytlm elu p;u0 lxomf3iatomDeaueil(0trur(rpou4alt  fcsls  Dra(roou4tle mo3tyd s2rlnvpnt4teeoxr oytfaD ai i ()s2umxm nydamtnmictlsf 2ta(  ou4alen ociat sDeanmpnu)altrxf tydop rlnvi;s0seto(opou1alt  fetl( s2umuronu0tlenmfctatfmDrl(vs u4trtoiociy1op raivils texm(o3io1omtemicsasfa2umxm nt0tpenifetls a ra( on(4aexomrcoo1om elueo;()srur(m3io1ll nlivt ( a2rmuroou1apxoioctlt s uanvs;t)tlxoio3iodlpt  u sls seuoim3oy4lmee ivi t srum(roou4ale  feiatfa umumonu0alxnxfctatfaDraieo t teurio ou1lmte feilsfsDurxrp;u1texo feiydfmDumuvpn() exomf3ta1fm  luvols0s2xm(m3no1am e fvsatf rrr(mpot4ale mfcilsla2emnvs;(0 ltnxrciadlm raues;t  etr(o iodapt licslsfsrrax p;t4olx mi3iyd sDel(vp (0aetoir3io1fpD liei;(0s2umir3iydll  lfvt () Dumur ot0tetoioetlslaDra(ms;(4tleomr3tydlpDraivi (  2urxr oo1op nmicilt s2uaumonu4opto fciyt aDraumont0 ltnmr oytfa r nvsls teuo(opno4lp   nct s aruax oot4texoifeiydla rm(vs;u0 ltrmf3iydfm   ueilt0t2umxo oodom nlfei s)srrmur oo1apeoiiciaslm uln p;t)arenmr3oo1fpDe u ols) 2xmio3iydllen fei s)srtr( pnt4oltnio3iat sDumumo;(0 exrio oodfm eanes s s2umxrpiydapen iesa()s2rr(  ;o1olenmoeiydlm elnmo (4artnmf3oytoa rlivo;s0 rxmirpoodll nmiei s) rum(mp;u0oee mo3iat s2uluvp t)texrxfcoo1lptr ivols0 rto(r iy1ll n fcsa(  2urxmp;t4oexn ieild mDel(mon(4artoir iytlmtraneslt)texmxr3oo4om   netlt)srurumonu1alto i3ils a eln s (4artrio3tytoatranvo s)setrxmpio1al nlnctlsfaDra(rpno4tpe io3tat m2eanvs (4texrmr oatopD ln s;s) 2uo(m3oudamt  fvt ( aDrm( ono1oexoii3iytfaDum(monu)arerirctatlm r n sl( sexoir3ou1lptelivsl( a2rruronu0apeomf3iadls emu s t0tlxomf iadomte i sl( tetmxo3oy4altnmnet (  rururo;u0altomoctytfsDul(msn(4 ltrmocoa1opDr uvil()s2xr(rpiy4lle mfeta() 2uau ono1apenioeiydfa rauvo u0 rxnmr3oytfpDraneo s)srtm(o3iodap n fcils)s2tmxrpot0olx ifeiys m2uanms;t) etrmo iodfptrln ils) eur(opoo1aleelfesl(  rtrxm nu0alenmoeiyd a2eanvpn(0 lerxf3iatlptean s t sexrxm3nydlp elncias) Dta(rp;t1tlxo f3iydlm2ul(vs u) ltrxo tydlaDeaueo;t) 2toir oodope lnvt t arrr(  ;u0opxn oeiyt mDrau o t0trtnif tytlaDrai sl(0teurxopiodamtemivsl( arua(mo;o0olxnmo3ilsfs2ulnvs (0tetnxf3iodoa eaieolt t2ur(m iodol e fetl( arrmu  ot1aee if3ilsfa uln ont0tltniocoo1omte iei;( t2umxo no4lmtnmivil()arta(ro;t0opx ii3tasfs2ua(vpn(0 lenio iotfat luvil(  2xrio3oydlmte fctl()aDum(  ;t4aexomi3tysfaDranvp (4tlxnxrcoy1om   i olt)trxm(mpiu4amt mfesl()s2urxro;o1oexomf3tas s2umuvs;t4trxnmfcoo1latrlu s s t2xmxo3oudoltelfci s s2tmxmpnu1optnifeiadfaDrmnvo t4 ltniocoydfmDelueo s0 exoxm3ny4ll e ieia(f Dumumo;u4alen ietadlaDem(vont4 eerio3ty1oaDrlnei;(0t2urir nodome mnesl()aDtaxmp;o0tex mfciytlm2emuvo;u4 eeoxfcoydopD luesl( srxrim3oy1om eliet ( s2tm(mpnt4teenifeiydls2ua(mp;u)tetnioctydlm ranvi;(0trumio iy1ap nmfesa()arua(r ;t1alenioetldla elumpnu0 renir to1fatrlivs ()t2xr(r ou4ole liet s  rua( pno0tlx ioetltfs2rau p;() reoxo3ty1lp rluvi t) rtoio nu4ameemnviasfa2tr( oot1alen iciltlaDulu on(0tltoxf oo1fmteai ol( s2xrxm nu1alt lnctasfaDtauro;o0oeen ociasfs2um( snt0alenxr todlateaivs () rxo(r3ny4lp elneil( sDtrumo;o4olto oeilsls ulu pn()arxnif oy1lp rlies ( srtmxm3oo4ap  mfeiat)srum(root1oet mfctld s2em(vo;(4trermr3oadlpD lneo (0 rtrirpoo4ol  lnei t a2ra(rooo0tetnmf3tls m2umn s t0trerxf oatoa ean o;t texoxr3ny4olee icsls  Dumu o;u1tptn icias s2emumo u0tetrmo3ootopt lnes s) 2toxmpoydalt  netl( s2rm( ont0oetn i3ildls rlnvs ()alermf oytop   ueo;(0 exrxo3oudoleemiesltfsrta(ro;u0tpenmo3ilsfm rm(mo;t0alermrcoydfp eauei (  etmxr oy1lmtn ies (faDua(r no1opeomociyd a2ul(mpnu0tlxoio3ty1lm   ies ()srxrxmpny4olen fcia( srum(r nt0texn f3iasla rl(msn(0arerir3todlpDeli ol(0tetoxm iydoltelfcs s)artrurp;u4aetn feiytfm ul( o;(4teeomf todoa  ln ils0t2urio oudomtelncslt  2rmum ;u1apenmicias sDrmu s (0 exrirciotfatr ueo s)truoir3ny1alenmieiat aDrrumono0olxn fciysfaDelnmo t0teenmr3totlaD ln s t)sruoxm3oudlp elies s)s2tr(mono0oeeomieiltla uanmsnu0 exomrcoodop eanvo;s seuoiopoo1ll  mfeslt  2urur ;u1aet ifctad m2rl( o;u0artoir3io1oa elueo t0t2uoio3iudomt  nvs tfsrra(r ou0aeeomoeiat s2ean pnt4tltnif tadlp elueo t  2xo(r ou1ll e iesltfaDrmx pou0olt  oetad s2rm(vp (0tetnmf3ootlm rliei;t0srtoim iu1ol  livias aDtmu ont1aetnifeiadlsDeauvp;(0texnir3iadfptrai i;()t2urxr3iydam nlnctlt)srrmx p;o4teeomfciytfa ean pnt0alenxrciotlpDrlivs;() rxmimpiu4omtn ivslt arrrxrpno4tee iietydfmDrlnvp (0 eenxo oodfat ln o;s)trxmir3iy4ape  nvta() rtr(  nt4tlt moeilsfa2rln s t0tltnmr tydop  ai sls truoxm3ny4lpen fvilt sruaurpnt0tpe mociydls uan p u)arxnmfciotfmt lnvo s0t2xmir3oo4ape miviatfs2rrxrpoo1oeeo o3iasla emnvont0trerxo3tydoat au o;(0setmxr iu4lptnmneilsfsDum(m ;u0alx  i3iys m ra(vs u)aetrxf3io1late ivi ()s2to(opoy4lleelfvslt)s2trxr no1opt mf3iltlmDemuvonu0tetnir to1lp rlnvo s s2tmxm3no1olt mivil(f Dra(r ;u1tlxomo3iltfsDrl(vo;t4tlenxo oo1op elies s)teurxm ou4amtnmivtlt) 2uau  ou0tltomieiyslm ua(mpnu4alenxr3iy1lmtean olt0teurxr io1lpeemfvtasf 2ra(mp;t4ole  fctyslsDean pnu)treoxf3oy1laD  uvo;(0t2tm(o oodop nmfei tfarra(ronu4opt ifetysfs2uln pnt0 exoxf totfptr n slt) 2ur(opoodapt lnetas)artrx oot0tetnifetyslmDemn o u4trxnif3iatfmt luvi t0srtmim3iydale lneil()a2rruront4tlenmocild a emnvs;(0trxrmr oo1fa elnes;( s2trxm iodolenlfctlt)a2tm(rp;o4texo ocilslmDuan o;u0aeerir3iodfateli s (0seurimpiu4op emnci tfsDumxmont4ope if3iaslsDrau sn(4altoif3io1lmD auvs;( t2urir iu4omeelict sfs2urx ono0aeeniieiysfa emuvo;()aexoxf iodop rai i;t)seur(o3nudal n ivi (fsDrrxr no4aptnmfeiytls rm(vp;t)trenxf3oatfptelieols texr(o ou1omtnliei ( sDrru pnu4alen f3tyd a umu o u0texnio iy1faDelu il()s2urir nudaltn ncsls)a2rm( o;o0opx  o3iytlaDra(vp;()arxnio tatfmteai sl(0sexrio3ny1ol elnvi t)aDuaxrpno4optnii3tydfmDel( snu4artrmo3oodop   u il(0 euoxr3iu1apt mfetat)s2rmumpoo0teeomfctyd s2uanmp;t) eenxf3iatomt lu s;() rxmim3io4ome livtatfa2umumpoo0oex  o3iysfsDumu p;() ltrmr3oodfaD auvslt) rurirpiu1lpen netlsf Drm(mont4apxoii3tatfa2ua( pn(4 exrxf oydlpt aivil(  exoio ny1op nlnesl()sDtmuroou1tle ifetlsla2eauvsnu) lxnxo3ta1opD livo () rurxr iu4amte iesatfs2rmu  ;o1tpxn feiys sDumu onu0tlerxo3oo1oaDr u il( trtm(o3ny4lpt lnet sf rrrx oou1tle iieiysfaDumnvp;(4tlxrif io1fm  an ilt0trxrxo nu4lp  mnctas  2urx  nt0apxnifciat a2ra( snu4aexomr todlaDran ol( s2ur(m io4ll e feias a2trurpoo0aexn fciadls emumpn()texoio oodlmteaneo t s2ur(o3ny1op n fctlt)a2urur nu1tpeo feiyt a2rmnmpn() lxoxf3iy1la raues;()s2umxo ou1al elictl( aDta(rpno1apeo feildls uan s;t0aexnmr3ty1lp rluvo;t)teto(m3oudllen fcils sruau  ou1tpto fetlsfs ul( o;u4 renxr3totopD ai ols t2tm(o io1aptn fctas s2rauro;o4tlto ictat mDumn snu0 rxrir3oadlpDeanei t)trurir3iodlltelivi s  Dtrxrpnt0tlto ieiat mDeauvo u) rxnio3iytfptr neo;(0teurir no4apen fcils) Dra(mpot4ope iociadfaDrmuvs;t4trxoxr oydom eaieils0t2tmxrpno1olt mici s arra(ronu1oetomociadla2eauvo;u0 rermfciy1fpte uei;()s2ur(r3oy1am   icias arra(mp;o4tle moetysfsDua(vs;() lxrif oodopte i o;s0s2tmxr io1lm nmnesa()s2uau o;o0ope ifeiltfmDraumsnu0 eeomr3tatop rau o;t)srxm(mpio4ol emneta(  Dumxro;o4tptniociytlaDrln s t)tetrmrcoytlateli o (  2xr(r3ny1ameemiciasf rtmxm ;o0tee ifeiys mDelnvp t4alenxfctotlatrau olt)seto(mpny1olt mfeia(fs2rrxro;u4apeoii3iatlsDuanvp;t)alerirctatom elueo;(  rum(r3oy1amenmncil()a2tmu p;t0oltn i3tadfs2rmnvp;t0arerxrctytlmDeanvils) 2umimpnu1ol nlicta( sDrr(rpot0oexnioctys a rl( s (4treoif3to1om rlnvol(0srxrir ou1alee ncsasfaDumxm nt1aetnmociytlaDumuvpnt4 rxnmf3oodfp r ieil(0 2umxm3oo4ape lfct ( aDtmxr nu0ape  ieiadla rlump;t) leomf3iatlaDr neolt0 rumio3iydame  ncil(faDtrxmoou1optnif3ilsfsDraump;t) exomf oatlpD ln i;s trumimpio4aptemieia()s2tr(r no0ole mf3iatfmDemnmpnt) exoio tydop rlnvo t0texm(r nudolen iviatfsDrrur nt1oexoiociytls2ranvon(0aeermf3iydfa   i s ()sexmio ny1ole  ies tf Dtmu p;u4oexoifeiasls uan snt4alxnmf oytopteln slt)sruo(m iu4op e fcsa(  ruaxm ;o0ole mieiatlm2rln p;u)trtnmr ty1lp eaueo;t) etrxo no1lmte fctas  Drr(r no4tlx mociys s2el( sn()tltrmo io1fp e u ils srtrimpou1apee icta( a2trxmpoo4oleo i3iatla eanvont)aetrxfciotfaDrluvi t)t2xrirpiu4lpen icsatf 2rm(moot1olenmietatfm2umump;t)treoxfcoydlp  aneil(0s2ur(opiy1lpe  fei ()s2rau pot0tleomfcils a ranvs t)tltoif oa1lp e u ilt  etrio3iy1ol  mivtlsfaDumu ont0olxomfciysls rau s ()alxrxr3iadoptr i ils0 exo(o nodopt lnesas srumu p;o4apeniicilslm2uanmont4altrmr ia1omtrli i s0 rtoxm iu1ll elnvslt  rumur oo4tpeoiieiadfaDrmums;(4trtomrcootopDrai o;s)srxoxopoydlmenlfvt s s2tm(m ;t0tltnifeiadls elnms;t4arxoxf3iatla  luvslt0t2xm(r3oudlpee netas aDraurooo4apeomf3tldfa2eluvonu0 lxriocio1fa elu sl(0t2uo(mpoydlm  micslsfarrmxm ;o1tee  feilsfmDrm(mo (4aexomf iodlaDeaieils0 rurxopoudopeemictat artrumpot0tpenii3ilsla2ranvp;t) eenmf3iydfaDelu i;( trtoxr io4altelies t)s2umuroou0texo fciydls2umn o (0 lxrif ootfm r uesls0 exoir nodlle  fes tf Draumpot4tltnmoeiytfa2ra(vo;(0trxnxocoytomD luesls0 etmxr oudop  mfesasf 2rr(r nt4altoii3tyslm2eln o;u4trtrxrcoytlm  li i;s)seuo(r oodomen fcil(f 2ra(mpnu0tle iieildlaDul(mo (0 rxrxf iy1lpDeluei s)t2urim iy1lmee nci t) Dtr(rpou4apen ociys aDrmu pnt0treomocty1oat luvol( seuoim3nydlptn ies sfsrtru poo4altoiociydfm2umnmo t4tetoir ia1lp rliesl( trumio oodop nlnct tf Duru pou0aetn ictat a2ranvo (0artoir3iodomD  i i t)texrxm nodlp emfcsls srtmxmp;u4opx  o3iltfmDrau p t) rxniocoy1omD anvi s0trtmir io1amtnlfei tfa2taur ;o1tlt mictasfaDrmnvs;u4tetrio ootfm e iei;(0 rtrir3oo4om e icil() rum(mo;t0olxo oeiat mDrlnvp;u0texnxrcio1omDelnvsl(  etmxo oy1lpe mncslt)aDurxmo;t0tetn f3tatlmDrlu p (0aexrif totomD anvslt0 eurimpny4lmte fet tfa2taxr ou4aex io3tytfsDeanmp u)arxoxocta1om   uesl()srto(m3ou4altelfvil(f rumxr ot1altomo3iat m ea( o;t4aexrifcoodomD aieo (  2umxr3oudlm e iesls s2rm(ronu1olt ioetlsfm2um( p;()treoir3iodomtr uvo;t0s2xmiopoudlpt lnvia( sDra(m ot1aexomociyslm ranms;u4altrifciatoat  nvo;(0 etmio3iudlp n nvilt a2rrxro;o0opxo fetad aDuan s;u4tltrmfcia1la eln s;t)seum(m3oodoltnlfeia( aDumx pno1olxomieilt sDeluvp;u4trtrxo tadoatrai s;t s2xr(r3iy4lpe mnvta( aDrr(ro;t0tee  fcilt mDea(vsnu)altnir3ootfate uvols s2tmxm3io4am   nesatfaDua(r ;o0tltnmoeilsfa2emuvo;t)aexoxoctadoa  aieo () rxoxr3oo4ameelnvtasfa2rr(  nt4oex ioeilt sDelu p u4alxrxocoo1lpt ln olt  2xrir oy4op nmnet tfsrtrxmo;u1apx  oeiasla2el(mo u0 etnxf3tydoaDraieilt0 exo(opiu4omtelfvta() Dur( poo1tex  ociyt mDean pn()arenmr oo1lmD  neo ( srtrxr3ny4ap nlfeia( aDrru pot1oexomf3tlt s2uln p;()artnmr3tatlateanvi;( s2um(mpny4aleemfvtlt) rrr(m ;u1altomocias a2eauvsnu)aeeomfciytfp eau o;s  exr(o oydam n nvtls) 2taum nu0oleomo3iadfaDra(ms;(4 rtomo3tatfmD  ivo;s seto(m nu1amtn neiasf rrau o;t0openmo3iydfsDua(vp;u0 lxrxocty1fmt  ivs (  etrim nodamtelict (farurxm no0tpxoiictldfa2emumpn(0aexrxfctatfat  neslt t2xmxopiu4olee nvs s a2tr(monu0teeo fciyt s ua(vs;u4altnmfciodoaD  nvo;s)truoiopnodlp nmfvtl(fsruaumo;u0tlx iicilslaDra( p;u) lxrxr3iytop   nesl()s2uoxmpnodom nmfvtlt) rtaurpnt1oltn ietys sDrau onu4arxoxf3iydfmDrauei;t0 etoxmpiodlptnlfvta(f rta(mo;t1tlxomicilt aDra( p u0trtomrciadfmtr n i;s) euoxrpoudaleemfeta(faDtau ono4tpxnii3ias m2ulu s;t4arxrirctatlpDeln s;(0trum(opiydame mieiasf 2rmxmpnt4oetn f3iltla umuvp (4 leoir3oy1latr uvils)texrxm3no1ll  mncia(f rumxrp;u4tptoioetyd m2eanvp t0tltrmf3iodlatraues ()trxr(m iudlleemivs (fsrrrx pno0tlxoioctlt sDem( p u4 rtnifciotfmtran i;s) eurxo iydop elnet s)arrm(moou0oeeo o3iydfa el(monu4 ltrif3ootoa eli o s t2trxmpoo1alt mictl(f rtr(rooo1aetnio3iysfs ra(vs;t0 exrir3iotlmDeai i;()truoiopiu4omeemnet s)srur(mpnu0tpeomoetlsfa2emnmo (0 ltnmo iydlp eauesls setrir3oy4lleelictas sDtr(mpot0olxomfetytlm rluvo;()tlxoir tatfm elieils)truoir ou1aptelfei (f Dtmxmp;t4opxnmi3iatls2ua( s;t0aetoif tydfpDr n sl(0 2urim3oo1amenliesatf 2ua( pnt0apxomoeiysla rl(vs;u0aexrirciadom raueo;(0trtm(o3oydlp   fes t a2raxm nt4aeeomoeilt s eluvpnu4artomr oydomt  ues (0 2toxr no1opte fet (fsrum(m nu4oexn oeiyt mDum(mo;t)trxrxr iadla  lnvi ()s2tmxo3oo1am n fvils)arum( ooo0texn i3iatfmDrmuvo;u0tleoio iydlpteaivo s)srxr(rpiu1lp n ivtlt)aDrr(rp;t1tpt iietysfm emumsnt)aleomoctadoaDrlneo;(0trxm(mpoy1ll n ics t srtmur ;t4texnif3ildfa2ulums;t)aexnxf ta1fatraues ( srumxr3no1om n nciat a2rm(moot0ale mieils s2rluvs t) ltnmr3oo1faDraueo (0s2tm(m3oy1ol e ieiltf 2uaxr ;t1opxomo3iat sDulnmp;(4trtrxfciydfaDelnes ( tetm(rpoo4lmte nvi t  rumxr nu4oee  fctlsfmDuan s;u) lxnio3oytomDr u o ()s2xr(m ny1lpenlivtas a2ua(mo;o0oetomi3tytfaDua(vp;(4tlerio3totoa  lnei ( s2xo(rpiodom emncsasfaDua(m no0aptomieilt m2emuvp u0altnmfcoodom  luvi s)s2trxm3oy4amtnmfvtlt s2rm( oot4teen i3tytfa2eanvs;u0artnmf tatopDelnvi t t2xriopny4ol  lneslsfa2truront4oexnmo3tlsla ea( s;(0aexrmr tadfmD  uvo (0 rtoxrpoy4altnmnesasfarrru  ot1tee moeiatlm elnmpn() lenmf3oodlp  anvo t) 2urxopnudlm elivsatf rtmxm ;o1tpe mf3tlt s el( snu4teeoxo3iy1fmDrlu ilt)srur(o ou1lpt mfctl() 2raumono0optoioeiytfm2ul( o;u0trxomf3tytlmDran il(  rtmxrpno4lm nlfct sf Dtr( onu0oee iieiyslm2uanvp u)altnmrcta1oa elues (0teum(m3oy4amt lfetat artmx  ;o0tptn ictatlaDea(vsn(4 lerio3iodfpD  iesl( texrxm3oodlmtnlivi tfsDtru p;t4apen ictytfs ua(msnt)texniocio1fmDrlnvi t0s2xrimpiodolt  fvta( sDrau oot4opxomo3iasfm rmu on(0tlxoxocoa1fm eau slt0setr(mpno4amt  fcias)arrmxrpno1oeeoio3iyt a um(vp ()alenxf3io1fmDe ieo;s t2tr(rpiudlpeelies s sDuaxm ;u0apto ociltfa ua(vp;t)artomf3iydopD ln s t0 2tmiopno1lleelnvt s) rua(  ;t0altn oetlsls2ranmo;t4aetnxr ia1fa elnei t setoxopio4omtnmnesat a2ur(roou1olx  iciys mDrlu o t4arenxf oy1fmtr nvsl(  etrir3oo4ll emneia(f 2ur(  ou4alxn iciat m rmnvp u4alxrmrcoodfmDranvolt  2xoxo3no1op nmici (  rumxr nt4altomfeiltfs uluvonu) rxrmo3tydomDe ivo s0teuoxmpnodlmtnmicta()aDrau  no1ale if3iaslmDulu sn()areoir3ty1lpDrlnes;t sexoio iudapee nvi () Dra(rp;u0aex  ieiyd sDrmuvp;u0 etoio3ia1om r i ils0 ruoirpiy1lmtnlnetas artaur ;t0aexn ictatlsDrau o;t) rxrxocty1lp ean s;t  rum(mpiu4ll e fet (fsrrrumpno0opxo i3tadlmDran o u) leoir3todomD lues;(0setrxo oydoltemfetat) Dta(m nu0apxniieiadla uaums u4aleoxrctodop   neslt0s2tr(r3io4opeemivil(fsDrrumpou0alenioeiyt a uanvo;t4arenifciy1op r nei;t0sexm(m3nydam e ics s)arrm(ro;o0oet iictas aDea(vs (0 rxomr3tatopDe uei s  2xo(rpoodlleeliviltf rrmu pnu0aexo fetys m2um(vp (0trtnio3oydlm   i s () euo(opny4ope  ieil(f 2raum nu4oex io3tasls el(ms;(0 eenircoodom r uei;t srtoir3nodam nlncs t)aDtrx p;t0olt ifciasls2el(vp;t0aleoxocoo1fa r ueo;s0 rxmxm3oo4ol nmfvt sfsDrrxmonu0tlx  oeiadfa raumpn(4alxoxr3oy1latelivi;t seur(r no4ame livtas) Dumx ont1tetniocildfa2el(mo u0tleoif3ty1fat an o;(  eto(o iy1am  lfesas  Dtm(mpou1tpxn oeiltfa2rlnvo;u)arxrifcootfpDelnvolt0s2toxo iu1apt lics (fa2tmxr ;u4aeeo o3tad mDuan s (0alxrmrciodomteluvs;(  ruoxr3no4omtnlfcsasfa2tru ono1altnmicildfsDem( p ()arermr3oatlat  u o;s0trxm(o3no4am nmfci t artax pnt1tlxnif3iatlsDrmums (0tltnmfcta1latelu olt0setrxm oydop nmfvias aDtmu pno0apxnioetysls2umn s t0trtrmr totop  auvs;()srxrxmpoydlm nmnvia()a2uaurp;u1aeeoiociadfm umn on(0 etoiocio1laDrlu o ( texmim3nu4om  mivsltf Duauro;t0teenii3tytlm2rm(vs;t4tlxnxr3totlatelnes ( s2xmxm3iu4om nmivi s) 2urumoou1opxo feiasfa2el( o t0 eeomfciydfmt  iei t0 rtr(r3no1ol   ictl( aDtrx pno1tetn f3tadfmDrlu o;u)tlerxr oytop eaivi s texmim iy4om nlicilt) rum(rpou1tpeomociyt aDum(vp;t4aexrxr ty1la  aneo t trtmxo oy4lme mivt s)aDrrxrp;t0tlx mieils m2uauvp;u4arxnmr tydfatr nvil( teum(o3oo4apt  ictlsfsrrauroou1opxn ociltls emumo;u)artrxr todla eliesl( t2umxr iu4lp  livi tfaDtruro;o1tpeo f3tas a2ulu ont)arxrmfctotlateaivol(0s2toxmpnodolt mfvs (f Dra(mpnt4aex  ociytfs2eauvp u0 rtniocia1fm  lueo (0trxr(opoudlltelneslt  rtru onu1apt  fciysla eluvpnt)teenmf3ty1laDrlueil( t2xmxr iu1lptemfci (faDraumpnt0tpt ioeilsla emn p;u0 ltomr3oatfatr u s;(0 rxrxr3ou4omenmfvilt a2tr(rp;u1alxn ociydfmDumumpnt4tlenmfciotfpDraieols0 2umxr nu4am n net s srraum ;o1tpxnioctasfm2uau s () eenmr ty1omDrauei ( teuoxr iudop elietas)sDum( o;u4tlxn o3iyslsDulu pnu) etniociodlmteai s;s teumxr nu1lltemfviltf 2raum no1apxo octad m rm(mo;() lerxocoy1fmD lnvo s)srxm(r3iudope  ict (fsDua(m ou0oet io3iytlm rluvo;u4aleoxo3ty1fm ean o;s srxmim io4oltemieils sruaxmpoo0tetomociltlsDrauvo t0 exomocio1omDeanvsl(  2uoxo iydamenliviat  Dta(mpnu4opt  i3iatfs2umumon(4 ltoif oy1lpteai ils0 2tmxmpno1ap e nctl(f rurxmo;t1apto fctyd mDeanvp;u)aexomrcia1fm   nvi;s  2tmxopno1al e nvsltfsrua(rpno0oleomi3iyt a2em(vonu4texriociadlpt au o;s  exr(m ny1ap e ictl( a2tr(rp;t4tlenio3iltls umuvp;t) lxrmr3oa1oatran sl()setrxr io1apte fcta(  rurxrpou0oleniiciys s rlnvs;()aexomr iatfaDeau o () 2trio3oudaptemicslt s2tax p;u0tptoio3ilt m emu o;t0arenif todlm  lnes s srtoimpio1ole lfctas)arum(rpnu0teenmoeildla2rlumpn(4 lenxocoy1lateauvolt  rtmim oy4ale mfct t)arraum no4aeenmocilsls2eaump;u0 exrircootfm  aneo s trxr(opiydlpt mfeilt s2trxm ;t4olx mo3ils mDulnms u4trxoxf3to1lp raneo s  etmim3io1olee nei t  rurxm ;o1opto o3ildlaDumuvo u4aexrmf oy1omD anes s  rxr(m oo4ol elicia(fs2umumpoo0texniietldlm2emnmp t0tleoif3iytlm rln i t) 2xrxo3nudlm nliet tfaDraurp;u4aleomfeiyt s2ean pnt0 ltnmo tydomt auvo s0 2tmimpny1olte net s)sDrmxrono0olx mociys a2rluvs;t)aexomrcoodoa  ai sls) 2xrxm3oy4apenmicsatf 2rru oot0aleo ietat sDuln o;(0trermociytlp e iesls0t2xo(opnodole  fviasf ruaxmont1tpeoioetytfmDel(vp;t4artrxo ty1opDeau i;()trxr(opiu1olenmnetl()sDtrxmo;o4aptn ictadls rmn ont)tltrirctytlateaivs ()s2urir iu1amte nei s arrmu o;o1alxoiociaslsDem( o t) ltnmrciotomDeauvo;t)texoim3nu4lmt mivtls arur(mo;u4aex miciat a2el(monu4artoir tadopteauei;(0 eurimpou4om  lnvil()s2trxm ;o4apx iociltfm rmumo;u0 etomocootlpD  uvsl()srtrio3nodapt lfviat)a2uau onu4texo f3iydfaDuauvonu4artoxfcty1om e u i s0seuoxm oo4apt mnet (faDrmxmpnt0aptniieiatlaDum(mo t0trerxf3todomDrai i;s srum(r3no1aptelics s  2rrurpou4oexo o3iat aDra( o (0artomr ia1lmt luvsl()sexmxopny1lmtemictls)sDrmuro;o0apxoiociyt s2emnvo;(4aetrifcoydfmteauvsl()texo(mpiu1ame  netas  Dtaum ;t1opxoifetldfsDelnvont)altoxr iodfaDrln s;( s2xrimpoy1lmeelnvsl( a2tru oot0aeenmietld s2emnms (0trtnxr oydlaDeln s ( trtoxr3no1lmtnmnei () 2rmurpnt1oee  f3iad mDemnms u) rxrxf3iodlpt  uei;()setmirpoodol  mfvtas srur(  nt1oltomociyd a2umuvp;u4tltnxfcta1lpDrliei t0 rxrio iu1optemies (  rtaum ;u4tltoifeildls rmnvo u0 etoxo io1oaDeaivol() 2tmxm3oydap elivsa() 2umxroou1oltoiicildls2umnvon()aetnio3tytfm eanei ( setr(o oy1amte ncsa(f 2rru  no4opxn f3ild s2umu p (4altomr iydfatrlnei;(0trumxrpoodoptemncs (fsDra(mo;t4apt  f3iysls2ra(vpnt4tlxoxf ta1oateanes;()tetmxmpiu1amt liet s sDumxm ou0aetomoetytla emuvo;(0trtrmf ta1omt livo s) eur(m3no1alenmfcslt) rraurpno4apt mociltfs ulu p () lxrio3oy1lm rli s;()srtr(o3oy1am  lfvi sfa2raxrp;u0tpxo oeilslm ua(mp;t0tltrxo3iadfmD lu s ( truoxm3ny4lp nmfvia( srtmur ;o0openioeiatfmDrlnvp;() ltnmfcio1fatrluvs s s2tmxr3no4aptemnvt ()a2tru  no0opxnii3ilsfs ul( snt4trtomo oo1lm raueo;( srtrxopiydlltn nes (f Drmurpou0olenmfciyt m um( pnu4aetrxo tydlp rlneils0s2um(r iy1omeelfvi t a2ur(mpou1aetomf3iysfa2emums;(4trerxr ta1fp r nvolt t2xmir3no1apt mivilt)arrmuro;o4apxo oeiysla ranvo;(0texomfciytfa r ivs;t) 2xoim io1al elfcils  Dtrur ou1apeniictadfs eluvo t0 lxnmf3to1opDeai s s0teumxo no1omt  ncils aruru  ;t0oetnmi3iad s2rl(vp t4arermf tytfpt luei;t texm(mpnydoleelivsls)sDur(rpou0teenifciat m rmu p u4tetomo3ootfa elneil( s2umio3oy4ale  fcs t  2rr(mpnu4texo f3tadfm um(vpn(0arxomr oy1oa rli i;t sruoimpiudale  ieslt srua( ooo1olxn ieiaslsDem( p t4tetrxf tydlpDeanvs s seumim oydap  licsa(fsDumur ;o0tex ioeiatfs emuvo (4aleoiocia1om r ivsl(  rxmio ny4apeemnesas srta(r ;o4tpxn icildlaDrln p;u) ltrxfcty1late uvo;s0 etoxr3nu4amt  fetasfs2raum ;t0aptn feiasfsDelump u4texnif3oytfmt li o s  2xoxopoy1ol  lfeils  2uaxr ;u1olx iieiat a2umnvp (4trxomo tatlpDrlieol(0 2tm(m3oy4am emfvtas sDtr(  oo0olxnmo3tasls2ul(mo;(4tetnxrcio1op  lu s s) 2xmxm nodomtemfciatfarrrx ont0aexoiiciat aDelums (4 reomo tadoptrlnvo s s2urxm ou4ol n neilt a2tmur oo4altn ociltfm elumon(0altrio iatfm e i o;t0 rxoim3ou1lm  lict (fartrumoot1olx io3tat a emnmp t)tltrifcoatfpt lueils) 2umxopio1lm elfesl( sDrru pot1apeo i3iatfs um(vont4aleomfcootfpt lu ols0sruoir nu1omtnliet s)sDtm(monu1aex iietltfm2ua(ms (4alxnxf3oy1laD an o;( tetoiopnu1lptnliesat)a2ur(root4aeeomfeiytlm umnmo;() etoif3ta1laDrau i ()s2tmxmpoodlltnmneia(  2ur(mpou4oetoifciadla umnmsn(0tltrirciodopDeluvi () rxm(o oy1lmt miei s)s2tax ono0tptn octld a ua(ms (0 lxnmo oytomD lnvi;s  2tmxo3ny4ol  livias s2rmump;u1tle ifctydfa2rauvo u) lermf3totlmteau o (  2xm(rpoy4amtnmnvi t  rrm(mp;t0teenif3iadfaDel( on(4 reoxr todoa rauvilt0t2tmim3oodom nlfcta(fsDtmuro;u0alto i3tyd s2ul(msnu) rxrif3iydfmD  i o (0 eto(mpoy1ap e icsa(farurumpot0oetn feilsfsDran o;t4 eenxr3ty1fatrln o;t s2umxr ou1am   nvt s)srrrxr ou0oexomfeilt a2rm(vs;t0arxomr tytlatrlivs;(0setmimpnu1optelncilt) 2tau p;t1oeeomoctyslm2rluvp t4 etrmociatfmteaivils0trtr(rpny1lp nlncsltf 2umxrono0altoifctysls2um(mo;(0 rerxrcty1oa eli sl()seuo(opno4lm e ieta() Dra(r nt1olt mfctydls2umnmon(0alxnmfciodfmDeliei;(0t2tmxo3ny4lm e nvtas)a2tm( oot0aex mf3tat mDrlnvsnu0trxnio3oydfmD ai s t srxoxo iodapenlnet s sDumum ou4tet  ictlsfs eanvsnt)aetoxr oatfmDraies s)t2xo(opou4amtelfci sfs2rr(r no4aet ioctasls umums;(0 lxrir oo1omDe n i (0srtmim ou4amtelicsat)arraxr ot0tee moetltfs rauvont)trxoio3tatfmD li i t)truo(r iudopte nesasf 2urx p;o4apt  i3tas s um(vont0 ltnmo3oo1fm rlivilt)s2xoiopiu4ol e net sf rtm(r nt1open oetlt m2emnmo () rtoxrciy1op eluvo (0setm(r3iodome  feiat srumx pnt1oeeomociad aDum(vp t4altoifcoa1faDr uvo ( seuo(m3nu1omtnlfesa(fs2tm( p;u4opt  i3ils m2rmums;u4texomr3iotomDr i i;t) rxmirpiy1ll   fesl( a2trxr nt1ape  oetad a ua( pnt0 rtrxo3iotomte nei;()s2uoir3nydomenmnetas  2uau ono4olx io3tas m2rm(mpnt4 leoxf3oo1fmtrau i;t teumxm3no4ll elfviasfaDraxm oo1tetoio3iytlsDumumonu)tltnxocoadoateau ils0 rurxo3iodalte nvilsfsDrmur nu1tpeniictatla eau p;t0 rxoxr iotlateaues;(  etmio iy4lpe liesls  rta(  ;u4oeen ocildfa rau s;()alxomr3ty1lmte ivsls0setrir no1lm nlivs (faDumxmpnu0tleo f3iysfs2rmn p;t)alxnmf tatlmt livs ()s2ur(r oy1oltelicil( srumur ;u1oet io3iadfa2ranvpnt)arenir iytfpDelivsls0t2tm(o3oodll   nvs t sDurx pno0oeeo icilt s rauvpn(0tetrmf ta1lp  luesl()tetm(opiu1lleeliei (fs2um(rpno4ope ifeilt s rmnvpn()alerxr3iatom eanesls0s2xr(m no4ll nlfci t)artr( pnu4oeenmoetltlmDeln p;u4aeenif io1oa  li il(  2trio3ny4lpe  nctlt srta(rpnt1tptomicildla2elumo;(4 lxoxfcoatlmD ln i s0 rtrxo no4omee ivt tfsDuaur ;t0tptn iciaslm2eaums;(4 lxoxo3tydoaDr ieo s0s2uo(r3oydap elfetl( sDrr(root4alxnmi3tat s ranmp t0trxoxo3oydfm rln s;t0seuoio nodlmeemfeiat  2tm(m ;t0openmociysfmDra( snt0alxnmf3iytlmDr nvi;t) euo(r3oo4ole mfet s  rrrur ou4apx io3iyt s um(vs (0teeomf oo1fa ran il()t2trxrpoy4om n nvi s)s2raumont4opxnmo3ias aDea(msn(4alxnxf3oo1fm r ies (0srxmxm iu4llenlfcta() rua(mp;t0tleoioeildla eauvp;u0 lermr3tydlaD aies;s) 2tm(mpiy4al nlfvs () rtmuronu1open o3iadlsDranvp t4aexoxocootopt livo s)texr(m3nodoltnmfeiasf rur(ront4alxnmfetys s2umuvp;t4texrxf3oy1lpDeluvi (0 exm(m io4lptnmieslt sDrmurooo0olxn feiltlm eauvp u4arerxf iotfm e ivol()truoxm nu1lm   nvs t)aDtmu pno1aptomiciaslsDel(vs (4tlxomf3iotoa r ies t)sexmxr nodopeelnvtas srurur ;u4open i3tydfsDul(vp t4tleoir io1lptran ils)trto(mpiu4lmtelnct tf Dtrx  ;u0oetomocias mDean o;() rtrmo ta1lpDeli s;t0sexr(mpiodol e fcsat)a2raxmpnt1oltoio3ilsfsDrmuvo u0trxoif3iadfaDrlieo (  2ur(o3oy4opt mivsa()arua(  ;t4aetnmi3tysfm rl(vo;t)alxoif iodfa e i i;s trurio3ny4ol nlnvtls s2tmx pnt1apx ii3iydlm eanms u0artrioctydoptr uvs;() 2to(rpnudlpen nciatfs2rruro;t1tetomociysfm umnvp;u0texnmf3iatopDeauvolt)s2tmxm oo4op n fet t) rum( pnu1aee  i3tas aDrmuvp (0 rerir3tatfmt  i ol() rxrir3nodoltn fcsas) Dtmuro;t4opt mi3iadfmDemnmp () ltnif oo1fptelues s0 rtrxm iy4omtn ivi s) Dumx oou1apen f3tysls rau o;u0 lxniocia1lp rlieo;t) rxmim ny1ap  livs sf Dtaumono4texomo3iad a eanvp;t4 etnio oo1lm   u s;s)trto(r3nudlme lfes (fa2rrxro;t0tpx if3iaslmDulums;t)arerxr iotopteaieslt sexo(r3oo1lm n nesas)aDum(rpno1texomi3iltlmDea( s (4 lenxf todfm elnvi;s0 2xoxo oy1ap nlicsat)aDrru p;t0ole mieils a rmump t)trtrxr iydlmD aivs t t2trxo oo4om elietat s2ur( p;o4teeo f3iydla2ua( o;(4tetnio iy1omteanvo t0srumimpnydolt lies s  Dum(r ;t0opxo iciysfm2rmuvp;()arxoxfciytoaD luvi t)seuoim nudllt lncsa() Drrxm ;u0tlxnmocildfs2ean pnt)alxrxociadfmteaues ()s2xo(m nudopen feias)a2ra(r nt0tetnioetys s2rm(mpn()tlxoxo3iotomDe ivs t) 2xmxm ou1alenlfcta()arur(r nu4tlenmoeiadls2rmnvpnu)tleoircta1omtelivils)tetmxo iu4om n fesa(  2rm( ont4oeenio3iytla rau onu4trtomr3todfp r uvslt0trtmxmpnu4om nlfcs tfsDuru  ;t4aeto oeiasla2eaump t) etnmfcio1fm rlneo s0srtrio iu4aptnmfcsltfaDra(  nu4oee  ieias sDuanms (4alerxrcia1lmtrlivol( s2toiopiodlpt mieias  2raxr nt0aptomo3iysfa umuvpn(0 etnmfcoodla   ivils)s2ur(o3oudopenlnvt t)srrrxr ;o0optnmiciysfsDulu pnt4 rtnxo ty1fp rauvi;t)texrim iodop  mfet t)sDrmxmp;o1teeomfcild a2eanvont0trtomr3oatop   ivi;s)teuoiopio4ol n nvtls) 2uaxm oo4aexoifctadfm2ulnvont0 eeoif iotfat  neol()teumiopnu1lp n nesa( arurump;o1aeeoio3iyd s2rauvon(4altnifciydfmDeli o t)srtrxmpiodlleemnvs t arra(  ;t4aeeoifeild a2rm(vs t4trxoio3iatfa e ivi t seur(opoudllenlieiasf 2um(ro;u4teeoifeilslm2umumo;(4teenif3oodfp raivs s tetrio oy1llt lnvs t  2taumooo1tpenmoctld m2rl(mont4 rxoxr iytlmDraivi s sexm(r iy4am n netl( srurumpnt4oltoio3ild a2rlnms t0 rxomr iotla rlnes;() 2urxo3ny1lmt  fci s  Dua(mpnt0tlxomoeiatlsDeln o () eeoio ta1oaDrlnvs ()seumirpno4lptn ncil(  Dum(mpot0alenifciys sDuau snt0aeerir tydlmt luvolt0seur(r3oo4opte nvs s)sDra(m oo4olt ii3iltfsDrmu pn(4trxrmf3oydop   uvilt0sexrio no1llte fvsas  Dur( p;u0ale ifcils mDrl(msn(0trxriociytom e uvi ()tetmxmpoy1lpeemnei t srrmu onu1ale ifeiydfs2raums t0aetnmfcta1oa eauvo;s  rtr(r3ny4op   ncsls artaxmooo0tlxnioctyt mDeluvon()trtrmo ootoa r u s;t  rur(m3nu1llenlfvsl()arrrum no4apxoiieiys m2ua( o;t4 exnmo3oy1latrlnvolt0t2xoir3iudoptnlncil( sDrrumo;u0aet if3tatls2el( pnu4artnxf3oatfpD  iei s)t2trir no1lmtelfvsa()aDrrxmp;u0tpxomo3iyd s eau s (4tetrmo oo1fm  ai sls  rtmxm nudlpenliviat)srrm( poo4ope  fctld s2ulnvs;t)tltrmfcoodfpDeln o s0seumxm nydome licil( srrauroou1tetn i3ilsls2emu onu)aeeriocootlmt aues t0seurio3ny1lltnmfcs (  2rau pno0apxoiocilsla2ua( p;u)arerir tatfateau ilt tetm(r3oy1ol n ncs t)a2trx pot4tee mf3tat s2rmnvo;()trxrmocoodfaD anvols0truoio3oudom e fetl( s2urxrono4optnioctaslm umuvo () renxr oa1omtr uvs;(0 rxrirpno4alt lfvtltf Drmu onu0apxn ietat a rmu sn(4altomoctytlaDrai s ()tetrxr io4olt  feia()s2tmu o;t0aeeoifeiat s um( o u0trtnir tytfatr ues;(  2toxmpou1ll  lict ( s2trumoot1apxn fcildlaDum( o;() exnif oydla eluvolt0 2tr(o3oy4lle lnvsls)artmx p;t4open oetyd s ul(vo (0 rtrxo iotfmD anei () rtrxrpiodap  miei t s2tmu poo1olxnmieiyt aDemnmo t0tltrxo3iytlaD  ies s0srto(o3oudomtn nvslsf Dra(mo;u4oet ifciatfa2umnmo ()aetnxf3io1om rlu s ( teum(opoy1oleemnetltfa2urxr ;t0tpxnifcils mDel(vont0aeenir3tydoat  neslt srtoxr3io4olen nct s srumum ou4tle io3iys m rm(mo;t) rtoxo oa1oat lu o;t0teumxr3oydop elicia( s2trurp;t4aleniicias a2uau pnt) etoio oatlaD ln o ()sexrim ny1ale lnvi t) 2ra(  ;o4oee  f3tatla ulnmonu0 lxoif iy1latrauvi t0trtoim3oo1lltnmnetat sDtm( p;t4aet  oeiys sDrlnms t4tlxrio3iotlp  an ol( srxmir nodal   feia(fsruaum ot1tlxnmoeiyt mDea(monu) rerif iatlpDe i s s)trtr(rpny1lpenlnci ()arumx  ;u4tetoioeiadls ulnvpnt)teeoio ia1omDrlivols) rxmirpiy4alt  nesat sDraumoou1tptniieiydla2eau o;t4arxoir3tatlp r neol( seur(rpnudll  livia( a2rmxrpnu0opto i3iytfmDra(vp;(0tetrxf oatfa   ieils  rxmim3io1op nlfcsa( aDtau pno1texnii3iydlaDrmn pnu4tlenio3ty1lpteau sls0srtmir io4ope mfctat a2rmxr ;t0tpxnmfeiat s2rmnvp;u4aeerio3todlpD  iei;t0 rxmio iy1am  lfctasfaDur(ro;t1texo iciadfm rauvpnu) rtoxrcia1fa elivs;t) ruo(o3nodop n ietat) 2uau  nu1tlxomi3iatfmDum( p;u) etnif3oatlp eauvils)setm(r3ny1llt mfci (  2ra(  ;u0tptnioeiytfa rm(von(0 exrmr3tytlat luvi (  eur(o oy4lp nmivilt)sDtrxr oo4olx  i3iat aDemnmonu) ltrmf3oatoaD liesl(0setoxo3iu4ol e nviasfs2ua(rpou0oee mocils mDranmonu0tetrmo3tatfp  aieo (0setoio oo1alenlnvil(fa2rrxm oo4aetoif3iydfs el(vonu4 rxoxf3to1lp  lnesls0srxm(opiu1lpen fvils sDurxr ou0alxoifciytfsDrm( o (0 exrxr oy1late ivil( trxr(mpny1ll nmivilt) Dta(mp;u1aetnifciytlm rlnvo u4arxnmfctytomDeau i;(0srur(r3no1ale lnvtas) rtmx pnu1tpen i3ild mDemu o;u0tlerxo iotfpDrlnes s) ruo(m ny4amen fesls srtr(mpoo0tlxnioeiasfs em( s (0aeenxr3ty1fm  auvs;t)trurxrpoy4ll  mncil( arur( p;t1tpeomfctlsls2rl( snu4 reomfcty1oatraivi;s0 exmxm3nodape  ietlt s2ra(roou0texnmi3ildla2rau pn(0texoifcio1fatraues;()s2urxmpnudlltelfvtlt sDtmu poo0aleomi3tadlmDrluvsnu)arxnmf3iodomtr u sl()sexm(r oodamen nvslt aDtaur no1alxnif3tlsls2uanmpn(0texomrcoydfm r nes () 2tmio oodllte fesa( srra(rpnu1tpe  ietaslm rm(mo u)tlxnxrcoydfpD lnes t)trxmxm3no1ame mnciasf Durx onu1texoiiciyt mDrl( p;t0 rerirciodoat anvs;t)srtmir iy1apenlfvil() Drmx ont1openmfciytlmDrlu snt0aeeoif3iotom rlnei;s texmio oy1lle mncils)arum(rpno4aptomociasla rlu p t)texrxo ty1oaD lnes ( teuoiopiy1aptnmivtl(  Dtauro;o0optomoeiyslmDem(vont)alxomrcoadfatrlnvs;s0s2ur(r3oodllenlnci s)srra(r nu1alx ioetydlsDemumo;t0 etrmrcoa1lat an i t srto(r3no1llenlnvsat)srrrxmpot4tpx ifeilslm2emnms;u) rxrif iodla e u il() ruoxo3nodopen fetlsf 2tr(mp;t1tetn feiysfs2eaumo (4alenmr3oodop r n s;t) rxmxrpno1ol nlnct s)arrr(monu1apx  ictldfsDemuvpn(4texoxrcoytlp   uvi;t)t2tm(r ou1am n nci ()s2tmx oou1apxo ociadfa emums;t4tlxoir tadop  an slt0tetoxo nydoltnmicias  rum(mo;u1oetnifcilsfsDulnmp (4 rxoiociotlm elnvs s  etmxo nu4op elnviat)srrmxronu4aleo octldla uluvs;t)areoxr3todfmtrlies;t0texoio3oy1lp emictls  rtrurpoo1apeoifcias sDrl(mo t)tlxoir3to1fm   n s;t s2xoim3oodoltnmfesat  Durump;t1tpeo ieiatfmDeanmo;(4 eenio3to1fpt anes;s) etrio3oy4lpe  nvtl(fa2tr(rpnu1alxnmf3tatfmDul( snt4teeoir3oydlpte nvi ()setmxopoodopt liei ( a2um(mp;o1aee  ieiatfmDeln pnt0 lxnifcoatfmD auei ()texoxmpio4alenmfetls) 2taxrpou4alen ieiyslm2rmnms t)altrir iytopt  n s t) eumxr3nu4lm elfvi (  rraxroot0tpe  iciasla2umnvpnu)trerxrcio1lmtraivil(0texo(m3iy4lptnmfvias) Duaxrp;t4opxn feiasfs2rm(mo;u4 exnxo3oadlmDeai o;t trxr(opiu1ape  ictlsf rtau  ;o4texo octldla2ean p;(0 exrxocoa1fa  li s;t)sexoim ou4om e icslsf Dtmx  oo4alxo ietls m ra( pnt)aeeoirctydopDraies;t)srxm(m3iy1omte ncsl()sDtaxm ;u0aeenmi3ils s2rlumonu) reoir ootfat lieilt0s2xm(r3iy1amt  nes sfartrxmoot0tee  fctas aDemnmp u) exniocty1fa eln o;t0 rtr(m oy1optnlfviatf Drrurpot4tleomo3iyslm el(ms t0 etomfcta1fpt anei;t0 rxoim iy1lpen fes t  Dtaxmpot1apx  ieias a2raumo;u4 lxoiocia1op raivilt0texrxm3nodam emiesatfsDurum ;u0alxnio3tydlmDuan pn()alxnif oa1omD  n s s srtmir3ny4ll  mnvsl(fsDurxmooo4aleomfetydfsDul( p t) lxrmf3iodopDrluvolt0srxrxmpnodlltnmfvs t)s2rm(  oo1ale  fciasls emuvo (0trtoxocootfa   uvi;(0srtrio ou4ol   fvsls aDtrurp;t0olenifciydfs2ua(vo t) etnifciytopDeaivi t s2xmxr iy4ol  mnei sfsrtaxr ;u1aee  ictldfa ra(mp;(4arxomo oo1lpDeanei;( srxo(rpoo4aptnmnes ()sDra( poo1tex ifciytls2elnvpn()tetnif3iytfmDraivo;() 2xrxo3iy1am  lnetlt a2rmxmoot1opxo octysfaDelnmo t4teenxf3iatlmDeai sls  2toxopoy4om e fctls)s2ra(ro;u4opxnmi3iydfm ran ont)aleomfctadla eai sls0t2urir io1omtnlnvtatfs2rax o;t0tet mociadla uanvpnu0trtoio oa1la eln i;t0trum(rpoy1amen nctltf rra(mo;u1tpxomfeiytla ra( p t4 ltrxo3oytfmteaivi s  rtriopno4oltnlncsls s2rmu o;o0olen feilt a2el(vo t) eeoif iydla  lu s s trurxr3ny4lpte ncsasfsrtru p;o1apxo fctas m2emnvsn(0aexrxr oatla  aivsl(0 eum(o3iudoleelicta() rurxront4tpxniieiydfa2uau o;t)arxrxocoytfatr ieo;t truoxo nudapt lnviasfarua(  nu4tlxn ietldls2uau ont0texrir oa1lpDr u ol(0 rxrxmpiu1om elfei t a2tax pnu0alt ioeiatfsDrau s;u0arermocoytomtr ivols)trxoim oy4oleemfvia() rtmx  nu1aeeomfeiltlm ulnvonu4tlenif oydlat  n s t0srumxo3oodol elnvsa(  Drm(rp;t4tex  ictldfmDel(mo;u) lxoirciytla eluvs s trumxo3ou1opt mnct t srtm(rpoo0apx  oetldls2rlump (0aetnircoatlateanvs () 2um(rpnu1am   iet (f Dumx pno1opt ii3ild sDulnvpnu0alxoxf3iodomD ai s t setrimpoo4lpe mivtl(f 2rr( pnt0tlt if3ils m umu p () exrir oodlm  livs;s setrxrpoudll  mncta(fsDtmurpoo1optn ictydfa emnvp (4aexnxoctodfa r n s;s)s2trxo3oudap e ivt s sDrr(  ou0altomi3iat a2uln pnt)artoif3ta1omtrlnvolt)s2xoirpiy1lltnlies ()s2rmxmo;t0apxn oeiatfsDul( ont) rtrmf oadoaDeanvslt trumxm io4lp   ncsl(fa2ua( p;o1olxoiociaslsDrlu ont0altoxrcoatlpD lnvs ()tetmxmpoudlltemfeias aDtmu  ;o4opt  iciyd m uau on(4altnif oo1fpDrai sls  2umxo3nydll nlnetasfsrumxm nt4tptnmiciydfa2umuvsnu4tetrio3ta1fmte iei;()sexm(o3iydamen ncsas) Drr(mooo0oex ifctlsfa um(monu4teenmo3iytopteaivs;()t2uoxo nu4aptn icil( srta(r nu1teeniietltls2uanvs;(0 reoxr tydlatr ieils)srxoxopoudlltn nvsas)s2umxront1alt mf3iltfsDranmont0trtrxocoy1fate nvo t0t2tmio iu1ape mnci s)aDtr(  ou4tetoiietydla eln sn()arxrio io1oatrai s ()texoim3iu1lmtemnvt t a2ua(rp;t1aeto feiadlm emnms u0 ltrxf3oadlp r uvils srtmxo iu1lp  lieiltfaDtm(  nt0tpxnif3iltfm el(vp ()tetnir iatop  livol()sexrim3oydom n netl()a2rax p;t0aptomi3iatfs2rm( s;(4alxomo iytoa raues ( trumxm iy4apen nciat aDumx pnu4ale mf3ildlm2el( on(4 ltrmf3oadfptelies;t0 2ur(o io1omeelnvs s aDrrxmpoo1olxomiciys s umu s;t4alxrxo oy1la r ies;s  2toim3oy4omt lnvsls artrumo;t0ale mietys mDraumo t4alenxfctytlpD lu i s0tetmim3oy4lpee ictl() rumurpot4altniietldlsDeln p u0altoif oatomD an ol(0 exoxm iydom eliviat s2ta(mpou1aleoii3iasfs2emnvo;(4tleriocia1fatr nes s)teuoxrpiydlltn ies sfarur(mo;o1oltoiietasls2uau s;u0trtrxrcoa1la e n o t0srxr(o ny4lltnlfvt s aDtmx  ou4ope mfctltlmDumn p;t4 eenmf iotop r nvo;t t2umxr ou4lpte fctatfarumx pno1olx mfciasla2rlnmont4aetrxo iytfp rluvo ()trurxr oy4omen icias) Drrx  ot4ale iietyd s rlu o;u4trenio3tytoateanei;t trtmxrpnu1altemnet ( srrm(ro;o4optoifctatfs2rluvpn() rxrmf3oo1fm rlivils0 eumiopoo1ale  icils)s2rr(m ;t4olen feilt s uln o u4 rxrio3iytlmt  nvi;( setrxopnodome lfvtls sDtrumpnu0tlt mf3ild a2uan s ()aeeoxf3oo1fmDeau slt0 eurxrpoudol   nvia(fs2ur(mpou1tlt ifctls m emnvo;(4 etoxf oy1oaDraies;s)t2umim nu4optn neslt)s2rmxmooo0oex ioeiyd m ul( o;(0trermo ootlaD  uei s) etrio oy1al nmict sfaDumumpoo1altoiiciydls2rauvs;t) rtrmr iodfateaneo t teumimpiodaptelies tfsDrax pnu4tlx ifeildfm2emu o (0aetomr3tadomt lu sl( seto(mpiu4lm nmivi s  2ur(  ;u4apxniietls a2eluvsnt) rtrmo ta1oaDrln i;s0s2ur(m iy1lltnmnvi sf Drrx  ;u0aetn ocilt aDumnmo;(4texrmo3io1laDr neo t seto(r io1optn ici tfsDuax  ;t4aet  oeils s2ranvs (4 rxnif ta1oat  u sls tetrir oodaltnmneia(faDuru poo0aee  f3tlslaDrmn o (0 etoifctotla  ln o t0setrio3oydol nmivt (fsrtru pot1apt ifeias a2umnvpnt0 eeomo iodlpD aneols0setoiopoodom e nvtas a2rmumpnt4apeo ieiys m ranvsn(0aetnmr iy1optraivo;s texmxr3iydlleemnvt ( s2rrxrpnu0tlx if3iyt a em(vp t4 renxf3iotfaDeluvs ()s2xoxr3oy1apte fviltf 2urxr ;t0oleoiiciat aDrmn p;t0alxniocia1fat aiei s seuo(r nudlpeelivilsfaDuru oot0oltomoeildfm2eln o;(0 lerxf3tydop  aues;s0srtoxrpiy4om   fei (farrm(r ot1tle iietasfa2ul(vp (4 renxf3iytomDelnvi t t2tmim no4ameemiesltfs2urumont4tetnioeiltla umn p;()trtnxf3io1oa eln o;s  2um(m3oy4lltn ictlt)artm( o;t0opeo iciad m2ra( p u4 etnmf3iy1faD luei;t)trtr(r3oo4op n nesl(fartrx pno0ape mfeildla2uaumo u)arenxr3tytlaDeauei s0 2xoxo3ou1lle lfet () rrrxrpoo1aet  feiatlaDemnvp;(0 exomr iydopt aivsls  ruo(m3no1lleemieslt)s2raum nu1opeoiicildfs uauvon(4 rxnio iodlpteaieslt t2tmxr ou1al e nvs s) 2tr( pnt0oltn feildlm umums u) etoxr iodlp raivilt srxoxo oo1alenmfct (  Duru pou0apxn fctadfmDul(msnt0trtnmrcootlmteauei t)s2urxrpiy1amt lnviasfsrrmu  ot1alx  i3ilslm2rmuvpn(0tltnmf iy1lm eli s t0 rxmir ou4ap n nes t sDraur nt4tetnmfeils m2el(vp;u0artrif todop   uvi;t) exriopoy4ap nlnesas srrrurpnu1teeoiietas sDum(vo;()aetrmf iodlatran i;s0texmxr3ou4lp elfcs ( sDtmur oo4oltomi3iyd mDrl(mpn(0 lxoir todlmtraueols truriopny4alee fcils a2tmur nu0tee  fetad s rl( snt4 etrmo oatfmtraies;s s2uo(m3nydame lnesa() Duaurpnu1altn icilsfmDeaump;(0alenxocoy1om eau slt0texrxm nu4omenmncsat)arrm(moot0altn f3iyd sDem( pnu0texoif tydom rlnes;s0seurxm nu1op  lfeiat)artrum nu4tpeniictyt a2ul(vs;t)aexrxr oydoaDeau slt0t2xo(m3iodam eliei (f Dtm( ooo1olenifeiaslm2eln o;t4tetoio iydlaD  neo;(0sexrim3iy1ll emfvt () Dumump;o0aet ifeils sDraumonu0 rerxr todlmDrau o s)trtrir io4omtelnctas arrr( o;o0altomfeiltfmDuauvpn(4altrxo ta1om raieo;s0 rxrim3iu4lmeemfcsas s2urur nu4opt iietysls2rmnvon() renir3to1laDeanvol(0trxo(mpiydape liesa(farurumoot0tet  fciad m umnvo;(4altnmr totoaDe ivi;s srto(m iu4aleelnesa(  rum(m no0apxoiietldls2emnvpnu0 renxf oatomD an il(0trtoxopnu4ol   nesls) rumu pou0aex  oeiytfm uan p (4aeeriociadfp elnvolt0trur(mpnu1am nlfvsa( aDrm(r oo1apxniociytfaDemnvs;t)aleomocoa1lmteluvo;t)t2xmxmpno4llenmicil() Dtrxro;t1apt ioctld mDuau pnu4altrxfcoo1opD  ieols0t2to(opiodal n fvt t  rrrx p;t4tleo i3iasls ua(vp u) exoxrciotlaDe iei;t0 exmxm ny4lp emiviatfs2trxr no4tex  ieildfs2rauvsnu0aetnmr iodlp  aiei (0tetriopiy1lptnlics t)srurumpnt1oexo feiad aDulu pnt0trenxf oatom rlu o t s2xr(m nu4ll nmfcsatfs2ua( poo0alx mfciltla elnvo;()alenio3tadfm eauvil(0teuo(opnudom n fet sfaDrrumpnu1alx  octyd aDran s (4 lermrcia1oaDelues;(  2tmir nodoptnmiviltfsDtru  ot1ale  oeiatlsDuluvpn(0 eenir tydop rlnvilt sexrxr no4lme livtl()s2ta(  no0aptnmfciad s2elu p;t4 rxrmo oo1omDranvi s) exrxm ny1lme  iei tfa2umxmpnt4tlxnif3ilslm2um( pn()teenmf3oy1lpDelivols)seumxopnudlpee fvsl( sDta(moou4ole mfetysfm el( p;() eeoxo oy1lm  aueil(0t2xoimpnudoptnmfctl() Durur ;u0oeto fciadlmDua( pnu)aexrif3oytlp  aueo () exoirpny1om  mnvsa() 2uau  ;t4tee ifeiys sDua( p;u)tlxomr3iotoaD auvo;(0 eurxr oy1am n fvsl()arur(r ;t1oeenmi3tatlm uln pnt4tltomfcoatfmDean o s)s2xm(r ou4olenmnciasfarra( o;t1opto o3tat a2rl(vo;u0tlenmf oa1fa   nvi;t) eum(o iydlmt lfes s) rrrx pnt4opxn ociadla2ea(vo;(0tlxoir3iotfm  aiesls) etmio3oo4ame lfei (  rtr(rpnu1aee mfeils a ra( pnt0aetrio oodlaD  nvolt teto(o ny4lpe lnetlt) rrmxmont1apenmfctldfa2ulnmsnt4aexnifctadom ranvo (0setmim3oudll   fetls) Dumurp;u4tptniictadfs rl( o u)aleoxr3tatlaD  nes (0t2um(rpoo4lleelicslt)a2rr(roou1tpeoii3iytla2elnmsn(4 renif3io1opt  uesl() rxo(r3no4lptnlnetls  rtaum ou0oleo feiadlm2uauvs;t0tlenmf3iotlmD  neo;s0 eumir3iydop elnvta( aDurx pno4tlenmietadfa2ra(vo;t)trerxoctotfmDranei t s2umirpoodomtemfvslsfa2uaxmoou1opeoio3iad a2umuvo;u)tetrircootom r n ils0t2uo(opou1olen ietl() 2tr( oot4tee ioeiydfsDeaums;u)areoxf oytoptrlneo;s0trxm(r3io1al e ieiatfa2tr(m nu1ole ii3iltls2umn o;(4trxnmoctatfm rlivs s0 exrxr io4opeelict ()aDta(m no1teenifciytla ulnmo;(0 lerio3oydla eauei;( setmimpnu1llt lnctl( sDua(mp;u0apxnmoetasfa ul( pnt4tlermf ta1late ueils0s2xrxm iy4omtemfvtasfs2ra(mo;t1tlx iiciadfs umu s;() etrxr3oa1oa   nvs () ruo(o3iydalte icias)sDumxrpot1alxoifeiysls2elnvp;u4 eeoxr oy1lat an i t0t2xoxopoy4om nliesls srumurpou1tlto i3tys s eaumonu) eeomf3oa1fmDeanvs;s0 exrxr3ou1lp  mfes sfsDum(  ;o0oet iieiyt m2rl( s (4teermr3iadlmDrlnvs;t trxmxr3nodolee ictlsfa2rm(rpno0tex  fciadlsDuau p;t0texnmfcoo1fmte ueols t2xrxr ou4olen fei sfs2urur ou1tlenifcilsfs el( o;u4treomf3iy1opDeaueolt t2xoio iodop e ncilsf 2rrum ;o4oet if3iysfa2ranmsnt4 eeoif3totlm r iei t srur(o3nydlmt  feta( s2uau  ;u0alxomo3ils aDraums u4tlxoxfctodfaDelnei;s0 rumim3no1ome  iet s)srtm(mpoo1aeeoioeild m eau s;u0 ltrio3ta1omtrlueils t2tmxopno1ol e nvtl()srrm(m ou0ope  f3tyslmDul(vs;()teerxr3tatfaDr ues;t0 eum(r3no4openmnvt tfaDrax ono1tlxo oetysfa2ul(von()tetrxrciatfm rlnes t tetr(mpoy4amtnmietlsfs2tr(mo;u1tpxomietyslmDua( s;u4aeeoxf3iatfaDrln o;s  2to(mpoudaptnlivtls artaxro;t1tleniiciatlmDea( sn(0tltnmr oydlmDran s s0srto(o3nu4lltemietat)arrrum ou4aeeoiieiltfm rauvp;(0altrxo3oa1lm r ies s  rurxo no1apen feils)a2rrum ;u4aeen o3iadlm2elnmsnt)trenmrctydla  luvi;(0 rtm(o iu1openlnet ( srtax pnu0tlxo fctydlm emn onu4altrio oytfm elies t seum(rpny4lp  mfvi ( s2rau  ou4tltnmoeildfa2ra( s;u0teermrcoytfaD li i;s srxrxopny4al n fctls sDururpnu1oetn f3ildlm2ran s;(4 etrmf3ta1fmD  ivsl(0 etrirpou1opeemfvsat  ruaxr ;u4aexnif3tlsla2ua(mo u4tlxnxo oa1fmDrluei t  rumim nudam  mivi (fsDua( pno1oee  fctatfmDul(mo;u4 rxomo3oadfpt  uei;()s2toir3oy4lmtnmnesl()aDta( ooo4aetnifeiadfa2um(vsn()aexomf3ia1opt auvs;s)teumxopoo4lmenlfeiatfartrxrpoo1openmi3ildls2umnmsnu4aetrmoctydlatr i i;(0trxo(m io4ol   net (fs2tmum ;u4tex io3iltlaDelums t0tetnxf3oytlmt lu i t0 etmxm ou4om e neiat sDrauront1aptnii3ilsla2eaump;t0alerif3iy1laDrlivo;t s2xmxopoo4amenlnvi ()sDrr(mooo1opt io3ilslaDrlu p;u) leoircoatop  lneol( s2toxo3iy4ap e fvtl(fs2urum nu1tee iociytla rl(vs u) rermr ia1opDr uvs;( t2uoim3ny4apee fvtatfaDuaumo;u1tpx  o3iatlaDum(ms ()altomoctodfatelu i;(0texo(o3iy4al  livtltfsDrmumonu1oex ii3ilsfmDranmp;u) lxoxrciotlaD  nvilt  euo(m3oo1ol  lfctltfartauroot4teeo feilsfs umump t0aeerxo oatlm raivi;t s2toxo3iu1olee fctl()sruauro;u1tlxo icias s2raumo;u4 eermo tadfmt  ues s)trxmimpno4am emivtlt)arum(rp;t1aetomoctasfmDrlu pnt) rtoif3oa1lmDrlueil(0s2toim3oydap nlfvil(  rua(r ou0optn fciad sDumums;()texomociydlaDrlues t0 2xmxr oodlpt  iciat srtrxr nu1oeeomi3tlslsDul(mpn(4teerif3iodfa rluvil( srxmxr iodomte icia()sDrrumpno4oet io3iytfs2rm(vs;u4aeenmr3oodfaD  n i;t0teto(mpiy1opeelfctat)aDtmurp;o1aexomicilsfmDem(mpnu4 lxrmo3ty1lpDrln olt0trxrxrpoy1om elics t sDraxmont4opxn i3iytlm rlnmp;u4 renmr ty1oatelivi t0s2tr(r3oydam nmnvslt)sDta(ront1tptn f3iyt m uluvon(4texnxociy1faD aivilt  eumxo ny4amt lnes ( arta(rono1oee  o3iadlsDemuvsnt0artrif3oytfmt lu i t) rxrxo3nu4lm  mieta( sDrrxmpnt1texo f3iyt a umump (4arxoxocto1lptraneo s s2xrir no1ll nmnvsas aDurxr ou4olxo i3iytfs2uan o t4tlxrxf3oy1omD  n sl( t2toimpio1ameemfctasf rtau p;o4oeenii3ilt s2ra(mp u)artnxfcoytlm eanvo;t0 ruoxm3iudomenmfcslsfsDrau ono4tpenifeiat mDum( o t0alxrmr3iytfatraies t0t2urxo iydllt mieta() Dta(mont4tee  o3iytls ulnmp (0 ltoirctodfa ean s t0trxoim3no4optnlfctat) 2um(roou1altomfctasla2em( p;t4arxnxrcta1op  au s;t0 etoxrpoy1lptelnet t  Dra(rono4opxn oeiaslm2rl(mpnt)teeoirciy1opD auvo;(  2uoio oudoptnlfvtlt) Dtr(r nu1oetoiocilsfsDul(ms () eermr oadlmte n ols0s2uoxr nu4lmeemici s  2rru  oo1texomictld aDrm(vs t0treoio ia1lp  auvils0 rtrimpno1lle  nci s s2tm( poo4oeenmo3ildla2uluvp;u)trtnio oytlpDeluvi (  etrxopiy1am   fvi t aDuaur ;t1tpe  ieiyd s rl(vsnu0trtnio3ty1lp ran s t) 2uoxopiydome lfci tf Dur(r ;t4oex  ietasfs2ua(mo t0 lxrircio1la  lnei;t  rxm(rpnu4optn ies s  Dur(r ;o1tex  ociltfs2eaumon(0 etnmo tydfmteanvi;t0seto(r3iy1lme lnvias)s2rmumpot4oee mf3iltls2rmnmp;t)tlxomo tytfpDraueo;t0setrim nu1ll  mnesls s2ra(mo;t4oetnif3tldfm2rmumpn()alermr3oydfm r n o ()srxoxo3iodll nlnvil( srtmurp;t0tpx moeiys mDean s;t)arxnmrciadomD ln o (  exrxm3nydamtnmict t  Dum(ront4tpen feildls em( onu0texnxf oo1lp eau i t)srtoio iu4alen nesl(fa2urum ot4olt ifciytlm2em(mp;()trxnxo oa1fp r u s () etoxo nodomte iciasfaDtruroot4ope  o3iysla rl(vsnt4texnxo io1fatrauvs s)tetoxo3oo1lpen ictatf rrm(r nu4tpxo ociat sDrlnvo ()altoio iytfptr ivo s  rxrxr3io4amtnlivsasfsDtaxm ;u4oetoiieildfs2ran p;t4 rtnif ta1oa e uesls0s2toir3iy4ome lnes ()s2tmxrpnt1aleomictydfs emu pn() lxoxo3ootlmt lies;t srxmxmpiu1op   fvsl(fs2tmurp;u4apx ioeilsfaDulnvsn(0 lxomr3oo1omte ivslt0srurio3iodope  ivs t) rurx  nu1aeto f3ildla elnvs;t)tlenxr3iydopD aivo;s teuoxr3oo1ape lnvtlt  2raxrpnu1olt mieiyt s rlnmp;u0arxnmfctodom elieo t)t2trio oydlpe lfcsls srrmxronu0oet  o3iad s2rl(vs t) eermr iy1oat liesls0s2umxm iodal nmnvils)aDum(m ot4apeniietlt a2ean o;t4trxnxfcoadfmt lu sls0t2xr(opou4apee ics s  2rr(rooo4tlxnioetys aDuau on(0altnif3io1fmtr ueols trurio oodameelivtl(f Dtmx poo1oeenmi3iysfa ra( ont0trxnir3ta1opte nvi;s texmxr3iu1alt livia(fsrrrx pot1optn ietyd s2rmnvp u0trtoio oadfa eln ilt0texo(rpou4llte ivil(  2um(m ou4tptomfeiysfa2ul( p;(4tleomf3oadfp e u s;s sexmxmpoo1lp e nvs tfs2rrxm ;u1oee  fctyslmDuanvonu)arxrif oodlmt lu i;( setoim3ny1aptnmnvsasfa2taxro;u0opxomietlsla2elnmpnt)alxrmr iytomteaivo;t0s2xrxo3oudamt  nes ()aDtauroot4tpxn f3iysls rauvp (4aetnxo3oytop eluvolt) exmim ny1ol nlnet s)srur( ono1aee ifeiasfa2ra(mon(4arxomo ia1lp eliei ( sexrxm nu1amenliesa(  rtmxmoot1tetnifeild a emump u0 rermo todlat li sl(0seuo(r3nu1op   nes (f rta(r oo1olxnio3tas a eanmon(0 exrif3tydfm raivi;s srurxo3nu1lmenliei (  Dtau  nt0tpxoioeiytlmDumumsn(0arxomociod
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;t  2trimpoudlp elneil( srra(mono1opxnifciydls2uauvo () lerxo oytopte u olt teuoim3oo1llee nvs (farta(  ;t0tptomietad sDel(ms t4trxoif oatfate uvs;t0trxrio no4ol nmfct (  rrax  ;t4altnmfeilt m2eanvo t)aexnmfciatfmDeau o s)s2xoio3iy1om e nvslsfaDra(r nt4aeenii3tlsls ra(vp u)tlxnxo oa1laD  ieolt0srtmxo3nudome mnesatf rrmurp;t0oltnifeiadlaDrm(ms;t4texniociadlpDe u o;s) 2xmiopnu1om nlneslt a2tm( ont4apeo fctatls2eanvsnt) rermrcoa1oat aivil(  rtr(m3iu4lptelivtlt)srtax o;u4oexoifeilslm rm(mp;t0arxnifcoytfpD ln s t0trurio iudale licsa()aruau pnu4alxn o3tydla2uau pn(0 lxrir3tatomtr ivslt)trtm(m3ou4ope  nesl(fs2urumonu0tee mieild a eanmp;(4teerifciytfp ranei;(0 rtr(o iy4ale mnciasf 2uaxmp;o0alxomi3ils mDemnmp;(0arxomf oatoptrluvo;(0 rtrxm iu1al elictlt  rrmxr ;t1tet ii3iyd a2uau o;u0teenmr todfmDelivo;s  2xr(rpny4ll elfeilt) rtr(ro;u4apt  oeiadfa rl(vs t4trtnmrcoadoaDe ivs;t)texr(o3oodlpeemnei tfsruaxro;u4oexn icias s2ul(mpn(4 lxrif ta1lmDeln ol() eumxr3iu1al emnviasf 2rrumooo1tpxnifctltfm2em(vsnu0 rerifcootlaDraieil( sexo(opiu1lltelnvias  Durxmpnu4oetnio3iltfsDuaump;(4areomo3tadfm   ivolt) 2tmxrpoudoptemfei s a2rmu  nu1ale  i3iatfs2ra(ms t) eerxf ootoa r i i;s seumir no1olenlfvslsfsrraumo;o1oexn f3iad a2ran o;u4 eerio iatomD lues;( texoio ou1altemfeilt) rrau  no4olxn fciydla uluvon(0aexomf3todlp eaivo (  rxoxo3no4alenlnci s)aDrm(r nt1alt if3iasfm2umn s t) rtrir iydopte u ilt sruoimpno4ap  mncil() rtaxrp;o4ope iociyd a emumpnt0altoiociy1fa e u s;() rxoxo nudlm emivi tfs2um(r ou1aexn octat a2el(mo u) ltrxf3oadfpt anvslt t2xmxmpoy1llenmfctls)srtmumpot4optoioetyslm uaums u0tleoxf3iotlptr nvs t)setrxrpnodam  lncs ()a2umxmoou4tpx mfctytls2emnvs;u0 reoif3ta1optrauvs (0 2xoxopoo4ol  livslsfsruaxrooo1olenmicildfm2emumo u4trtnifcoadfmtrlnvi;s0s2umxrpiydlptnmicsa(fartmxrp;t1oeenmictytls2eaumon() ltrxociytomDrlivs;t0 2xr(m iudol e fctl( s2rau oot1alt mietltfs2el( p u0 rxnir3iadfaDean o s0sexmio3iydale lnctat sDrrxmoou1openmfeiys a2eauvp;(0 exrif3iydoaD anvil( texm(r3iy4lmee fvi (  rta(roou1oee mf3iysfm ea(mp;u4 rxoio iodla   ivs t  etrxr3io4lltnmneia( aDrmx  ou0apxniiciyt s umumpn(0trxomo iodfa  aieil(  rxr(m3iodalte feils aDrrxrp;o4tlxnmfciad mDrlnvont4 ltnxrctotla rli o t) eur(m oudamt lies tfs2rm(mpou0oex  f3iysfs2em(vpnt) rtnmo3tydlmt lnvs;()trumxmpnu1lmtn ieiasfartm(rpou0oeeomfeiadfm em( p (4artnxrciatfm eaivsls t2uoxo3no1ome  fvi ()s2ur(root4tpe moctys a emu p (0artoxo3oydfmtr u i;s texrxm3oo1aleemfvsl( a2uaumpno1tlxo ictysfaDran o (4 ltrxo3iotopD aies t  etoim3no4lm  mfvil() 2taumoot0tpt mfciysfa2el(mo;t0 rtnio3iydoa rlneil(0 2uo(rpoudalenlictatfsrurumpnu4aexoiociaslm2uau p;t)tetrxr3oa1late i ilt0 rxmim ou4ap elici () 2ta(m ;u1teenmietlsfs2elnmo (0tltnir3tatomD  ieils teuoxo oy4ap  mnvia(fa2raur ou1apx iietatlsDelnvp ()alxrmf tatlmt luvol(0texrim3nydamen ivi s)srtaxm ou0olen f3ias s ulnms;t)tlerir3todlmD an i () euoir3oydapeemfvi s) 2rrum ot4olenmfciat m2emnmp (0artnxf ia1fptelnvi t trtmxr3ou1olee ivsl()sDtmx ooo1tpxomociad m2eaums (4tleoir3tatoa   i i ( trxoxr3oy4lle lfci t  rraxrpnt0olxnmoeilsla uln s u0 ltoxr iadfa e uvo;t0trtr(m3oy4optelieiatf rrmurp;u4alxo f3tlsfa2ean pnu)trerir3iydoaD ln o s)sexmio3oo4ll emnvsat) Drrx ono4tpt iictytfa ulnvpnu)alxrmf3oo1lpDr n ils srtm(o3iodoptnmnei t sDta(m ou1teenmicilsfa2ul( s;u)artnmo ta1lpDrli o t  rtm(mpoodop n icia()a2rmu ont0opeo feiyt a elnmsn(4alerxr oo1fa eai o (0tetoirpiu4lltelfesl(f Drax  ot4aet mfetyt aDranvp (0 lerir3tadlm eaueilt seumir3no4lpe lici tfarrax o;o4tet mietlt m2rln sn()arenio3oydlat au s t0 rurim3nodop elfciltf 2urxmpno0tle moctasfa ranmp;(0 rtoioctytfaD an o s) 2tmxrpou4apt licsat sDrru  nt0aptomieiytfs ea(mo;()tetrmrcta1fmtelu olt) 2um(o nodamtn fci s)srraxm ot4aleomiciys aDrmu s;u0tlxomfcty1faD  ieolt0 rxoxm ny4amte ieslsfartr( poo0opt mfetys aDeluvon() ltomo3io1omD au o;() rtmiopiu4llee iciat) Dtmumooo1oet  fciasls2ea(mp t4aeenif tatomDr u i t sexmxo3no1altemivt (f rrm(rpnt0apen oeiysls ua( pn(0teeoiocio1fmt  uei (0 2tr(o io4ope livias)srtruroot4tlxnmoetatlsDrmnmp;u0tltomfcia1faDrluvs;(0t2uriopoy1lpt mfvta( aDtmu o;u4tetomfctatfaDrmu s u0treoif tadoa  au o;s trumiopiy1ome mnei tf 2raumo;u1tetnmi3tydls uauvs;t)arxoxocta1lpD  ivs t s2xmio iy1am nlieias) Drr( oou1oexniiciat sDem(vs;t) ltomf ta1late u s s0t2tmio nudape  fvils aDtm(mp;o0alx iiciytlsDumnmo t) exnxfctatop raieo;t0srtr(o iy1lm nmieilt  rurumonu1aee if3iytfaDel(vo (4trxrirciy1fpt lieolt0 2xm(r iy4lmt mnvtls aruru ont1tptomf3iydfs ea( on(0tetnxo3ia1laDeauvo;t)t2tr(m3oy4altn ncta(fa2tmx pno0aeeoiiciad sDeanmon(0alxnir tydlmteau olt0teuo(m iudame mfvs s)aDtaur ;u1tpt io3tlsls2emnmsn() lenxfcta1oate ivo t)srxrimpoy4ll   icsa(  2uaxmpoo0tetomiciltlmDumump;u0tlerio3oytoateluvi;( trumio nu4ap e fcs s artm( p;t0oex iocils mDrm(msnt4tetrxo3oo1opteli s;t)srtrxr nu1ap  mfvtlt srurump;u0tltomo3tyd m rlnvo;t0arenxf3oo1oat  ueo;s0texmxm3no4oleemivsat)a2rrx pnt4tpeniociadls2elnmpnt0tltrir3ootoaD lues;s seurirpiodolte nct t srra( o;t1opxoif3ildls rmn pnu4teeomrciy1lp r neil(0s2umimpoy1om nlfvs t arrm(m nt0opxoioeiat m2umnvo ()texrir to1lp raivi;s texoxm3no4am e ici t) rum(rp;o4aeto i3tlsfm2uanvs;t0tetoxf todlaD liei;(0tetmxmpiudameelivs ( a2uau oot0olto i3iasls2rl(vo u4arerxo3todfa  luvols)srxmxmpio1omenmnei t aDuax pou0opx  i3ildla rm(ms;u4 exrxr3to1lptr ieils) 2xoxrpio1oleelicsa() rtr(  nu4teenmfetasls ra(vsnt)arxnmo todoatrln o;s  rtmio nydaleelneslt)aDtrur ;o4olt  f3iasls2ul( pnu0 exomr todfm  aivilt0trxrimpiu4ome lfetat a2rrxmp;u0aetnifciytlm ul(ms t)artnmo3ta1fatrauvo;(0trtm(o3ou4lpe  nvil(fsruaum ;t1ope mociltfs rln p;u4aexoifcoytfpt  u i (  rurim oudoltnlfvsat  Duax  ot0opeoif3iytfa umnvo;t4 exnxf3totfateluvi t0srurxm nu1amtemfvta(farua(r oo1oexo fciadla2ranvsnt0aeeomr iytfpDelivs s)s2xoxopoy4lmtn fei (f Drm(mo;t4tlto feilsfa2elumonu)aleomf3iytop eln slt s2umxopnydllen fcsl()srrm(mpot1ope iociytlmDrlnmonu4alxoiociadfa  ai il()truoxr iu1op nlivia()arta(m nt0oex  i3tlt m rm(vsn(4tlxnmr3iadfmtrli il(0 2xm(rpio4oltnlfcs s)srrrumpnt4apt ii3tydlaDea(mo;t4 rtnirctadfptrlues t0teuo(r3oudomt lici tfs2rrx pnu0oexnmfciydfa eauvpnt0tleoir3oy1fmt anvil( t2tmir ou4op n nei t) Dumx p;u0oetnmfciysfaDemumon(4 eenif tydlaD ln i (0sruo(o3iu1open ieil()srtmurpot1tleo o3iydfa2um(vont0aexrircoodlate nei;t  etmxrpoy4lpee fvs (f 2rrurp;o0opeomi3tltla rl(mo ()tlxrxo3ta1lptrau ols0teurir oy4ol   nvilsfsrur(mpot1tpen fciatfsDrlnvo u4 eenmrctydfaDeli o s)setoxopou1am e nctl()arraxr ;u1oleo ociyslsDrauvo ()aexoxo io1laD  nes;s truoirpio1lmte fvi () rtr(mo;t0oeenmocilsfs umump u0 eeoif3oadopDrau i t s2uriopiudll elncilsfsrtm( p;u4olxomf3ild s2em(vs;u)areomocootlmtr ieil(0 rtr(o oo1amee iviat) rta( ont4oleoiiciad m2em(vp;u)aetomr tadfmD  uvilt)s2toxopno1ol  mncsatfsDrru o;t1aetnmo3tasfs2ranms t) ltnif ootom  luei (  2um(o no1ame mfeil() 2rrxr oo0tpen ociys m uau sn(0trxnir3oodlpte ueo ()trum(opiydoltnlncsl(fa2raxronu4apxo oeiydfm ua( s t0tlxomo tydlpDeai o t)srurxm3oy4al emieias)a2ur( oou1olx mf3tatfaDem(mp;u0 rerxfctadfp eli s;(0texmim3iydale lieiatfsDtmuront0opeomfctatfa ean pn(4 rxrxocty1om e ies s)texm(m oy4lpe lfes t) rtm(mo;o0open fctasfs2ea( s t0trtrifcoodop eauvsl()srum(r nudap e ieias arrau pou4tet io3ilt m2uauvo;t) rtoxociatoa r n ils0setrxm iodomtnlici tfs2tax poo4optn o3ias mDua( snu4aeeoxrciy1op  luvs;s0srtmxo iu1amtnmivil()sDuau  ot1texo f3tls aDul( o (0texrmocoa1omD li o;()teto(opiu1altn fvsl(  2tau ont4oexoifcils a uan o u4tltomfctodlmD ai o ( seur(r nudap emivsa(fsDrmur ou1tex mfeiydlaDrm(ms;(0tlenir3totlmte i s s0 rxo(m3iy4aptn fei () 2taur no4opx  i3iat mDulnvs u) lxnxo tatom  lu olt)texriopou1al n icias)s2umuro;t4opxn ieiysfa2ra(vp;() eenir ootfmD lies;(0trurxr iu1al nlnes () Dur(r ;t0optnmf3tad mDumu ont0tltrmo3todopte ues;( truo(m nydlp nmnciasfs2ururpou1aeeomfeiysfm2eanvpnt0tlenmocoy1oaDelueo (  eumxr iu4ap e ivil( s2tmum ;t0tleniocilt m em(mpnt0 rxrmf oa1fa  li o (0texmxo3oo1omeemieslt)a2umumonu4alxn fciadfa2el(vs;(0 rtrir3ty1lp e u il(  etriopoo1openmieil(fsDurx  nu0apen f3iasfs2emumonu0areoxocoytlm rau s;(  rurxm ou1lmtnlivta(  Dua(  ot4opeo o3iyt a2eluvs;t4altoxo3oy1omtelivi t t2xrxo oydole  iciasfa2ua(m oo4oetomiciatla elnmsnu) lenxr3tydlpDrluvi;s)teuoio ny4omtemici s  rua(  ;o4altniictldfaDuan pn(0 rxrmfcoadopt  n i s0 2trxr3nydamtelnvi s aDtmur ;o4aex  feilt aDua(vs t4trxnio3oatlp rai s;t setmir oo4lpt  ncias  rta(r nu1alxn fciaslm rmnvp;t0tlxomocia1lm e ies t  rxmxm nodolen neta( arum(m oo4teeoii3iyt s rlnvs ()texoio oa1fp rauvo s  exrxrpoy1olte icia() rtmum nt1altnifctyt s umnmon(0aetnif3oo1faDraivo;s)setrxr3nu4opeelietat  2rrxmo;u0olxnifeiyd m2um( o;t4tetnir3totfa  lneil()srtr(o iy4lmt mneils  Drmx pnu4apeomictld sDulnvp;u0 rxrifcoo1faDraiesls) 2triopnudolte feslt)aDtrx ont4opx if3tatls elumo;t)tlermo oo1lmt li i s0trumio iy4lleelfet t sDtm(  oo0tpt iietltls2ea( pnt)arerxr3oodopD  uei s)srxm(rpnu4al n fcilt aDtaxr ;u1oeto f3tadls eaumo;(0teeoiociatlpD aivs;t) exo(r ny1lptnmfeiatfs2um(  ;u1apeo oeiytlm ulu o;(4aetoxo3oy1oatrli o;s0srxmir3oudamenliesl(  rrmu ono0olto iciat m rlnms;t) renmr oytlaD ln i t)texmxo3nodal eliviat  Drm( pno4aptnmo3tydfs2umn o u) rtnioctydomD lnvo;t sexm(m iu1llt  ivilsfa2tr(mp;o0aeeo f3iatls2ua( p;t0trxrxoctydfmDeanvo;t teumxopou1op  mfvsat aDrrxm ot0tlenif3ilsls2uaumpn()aexnmrctotlp  livs ( trumxm3io1llee fvs (  rua(rpnt1oltoifeiytfs ranmp;t4alxoxr3totfate iei;(0 rumxopnu1olee ivsas)srrm(ro;o0opeomf3tlt s uauvpnu0trxnxocio1la rln i t seuoxo3nudalenmiet s)s2tm(m ot0alenio3iltls eluvs (4areomoctodop  lu i;s0 2toxm3iydlltelfctat  2tm( ooo1tpt io3tas s2rm(vp;t0areomf iatomDr neilt) rtoim ny1aptelivtasfarrru  ot0oeenmoctad a2rluvo u)aetoif3iatlp eln i;s)setrim oydlmte nctls  rtr( ono0ape iiciadfa2ean p (0 rtrxr3tadfmt lnvsls0trumxopoo4ll elicil()s2uru p;o1aex  o3iadla2umuvonu4 etrxr3io1lm ranes s)teum(r io4lpeelnci s)arrmu onu4tpt mociyt m ua(vo;(4arenmr3oy1fpD  i o;t0srumxrpiudop  lict t  2uaumpot0opxn ociytls ea(vs;u) reoif iydfm   ues;s0teumxo io1lp   ietas)a2tmu o;o1tptoif3iltla ul(vsnt)tlenxf3iytlaDelu o t seuoirpio4altnlicia( aDrr(ro;u4apenmoeiadlm2rm(vo ()areomrcoatfpt luvs t0trtrxm3oo1lpenmfvsltfsDrr(m oo4ape ioeildfm rln s t)alxoiocootlp e i i t  rtmir3iydaleemfcsl(fa2ua(ro;t4aleoioeiydlmDra(mon()aleoxo todlmDe u o (0s2xr(r3nu4ol e fcs (  rtaxmoot1tle mieils a2uluvo t)trenmfciadopt au sls)teumiopoo1llenlicsl( arraumonu1alt  ociyt m emuvs ()trxrxo3iy1omDean ols trxoirpio1lme mfvsa(  Dumu ont0alto fetld m2rl(vo;t)tleomr ta1opD  ueols0 2tr(opno1optemicsas artaxmp;u4tetniietysfmDra(vsnu4trtrir3to1lm e i il(0 2urxmpoydlm emnetas)aDtm(m nu4tetn fctlt mDumu snt0 rtnir3iatlpt ln o (0s2uoim iy1amt  fcs s)sDum(  nu0tpxomicils aDuln p t4aexnmr3oodfmD lnvolt)s2urir no4omt livs sfsrrru pno0ale ii3ildlm rmuvo (4trerirciatfptrlneo s0sexmxrpoydape lfetat) rur( p;u1oltniictys a2ul(ms;t4 etomo tadomDeluvo t) eum(o3nu1ap e fcils)a2raxro;o4optnmfctldfaDul(mo;u4tltoxr3oadop   ueo s0 rtoirpiy1openlivi tfa2uaxm ot0tlt  ociydfa2elu p;u4altoxfcio1lm rlneols t2xoiopnodlptemiesl( sDur(r ot1olen o3tytls2rmnmp t4 eeoio3ta1opt lnvi () rxm(o nydalt  ict (fa2rru o;o0apxomociys aDel(vpnu) lxoxr3oydfaDr ieslt) rumxr3iodap e ivtl()srumu  ot4alx iociatfa ul( ont0artomfctadfpt ln o s0 2umio3iodllt mfcil()a2rr( pnt4tptnifetlsfm uanms u4altnmf to1lmt li ol()s2tm(m3nydaptemicsas srtmxmpnu4olto ociatfs2raump ()tltrxf oadla   ueils teuoirpoy1omenlfctltfa2rmumooo0olenii3iadls elnms;t4altomr3iydfatrluesl(0seur(mpiodope lfcta() 2umurono4apt mo3tlt a2umuvon()trxrmfcoydlmDranvi s)s2xrxm3iu4opeemnei (  rrmxmont4opxn i3iys s uanmo;u4 rxrio iadlpD  nei;t teto(r oodomtnlicsat a2umxrpnu1tlt  o3iyd sDua(msnu) ltrxrcia1oate ueo t  2uoirpoy4llt  fcia() 2tax p;t1aetnioeiyd m rluvpn() ltnxfcoatfpt au s s0texrxm oy1lpenlicia( sDrau  nt4openmiciysla2el(vp;(0 lxnxf3ty1lmt lnesls  2tmxr3ny1oleelfesa( srtaxmooo0olxomi3iat m2ulnvpnu) lxnir totlm e neolt0t2toxopnu4optnmnci sfaDrax  ;o0opt mi3iyt a ra( p;(0texrxocoytlpDrlu s t0t2um(o iu1optn fvt sfarrrum nu4tlto fctyslsDuln snu)trxoif ootlat livs s)setoxopiy1lleelnvsls)sDumu  no1teeo ieiys m rlnvp (4 lxrircoy1omDrlueo;s0trxr(opio1lpt mfcia(f rurxroou1tee  feiasfm2um(mp u4 reriociatfa e u s s)seumim3no4alt  fviltf Drmx p;o1texnmi3iatla2rm( s u0alenxf3oydopDeln s s0sexmirpnydole mivtatfarum(mp;o0tlx  fciat sDraump;u4aeenmfcoodlaD  nvi;()s2xm(m iy1ale mfvslt sDur( p;t4tee mfetys mDea(mo;u0 rtrxf3oo1la rlivo t0srum(m3ny4ope mnesl()arrrxrpnu1tpxnmieiat s2rmnmp;()trtrmrctodlaDranes;(0t2xrio3nydlltn ncta(  2tax pnt4apeo feiyd aDrau s;t4alenir oodop   n o t0s2trxr3ou4apt livs tfs2rrxr ou0tltnio3ild mDelump;t0alxoxo io1laDrlues s0 eumxm oudlpenlfetat)arumurono4aet ifcild m em(mp t4arxoxociy1laDe ueslt0 2xoxrpio4aleemiciltf 2ua(mpou1tpenmictldfmDem(vp u4tlermr3iydlpteli ol( t2tmxm3nu1lp  miet t)srra(mpot0oetomictydfa rau p;u0alenxf totfptran s ( t2triopiu1alt liciasfa2rrumpnt4tltomoetasfm ranvp;u4alxrxr iadlp  aieo;s)t2trxrpoodam nmfctas)a2urxmpnt0tpx  o3tytlm umuvsn(4trtoio tytfate neil()setrim ou1lmee nes s) Dta(r ;u4teeo i3tltlmDemuvpn(0 reomo ta1omt aivol(0t2tm(o3ny1lp n ivtas  rtrurpnt0aee iieiytlm2em(vo t) rxnif oo1lp elnvilt srtmxm nydope  fcs t) 2um(ro;o4aeto f3tadfa ranvo;u)arxoioctatlmDeln o s s2trxr nudomt micil( artmx  ;o0ape ifciyt mDemnms;(4tltrmocoy1la  lueo (0seuo(o nu4ole  fei t)aDtaxrpnu0oex  fciadlmDrlnvo;u0tleomf iy1omteai ilt tetoim3iydlmeelnvsls sDrmxmpnt4oet  i3iys aDemuvo;t4tleoir tytfm e ivi;t srurxm iu1lpe mneia()srtm(  nt4texomoetyd m2ra(vsn(0 lxrxr3iy1op r uei t)srumiopnudamt mnci sf rurxrooo0opx iiciadfmDean p t)aexoxo3oodopDrli o t0srxmxm iodop e icils  2trxr oo4olt mociysfm2ua(vo;(4tltnio oa1faD luvsl()t2tmxmpoudlleemncias)srtmxm ;o0apeomi3iadlmDrlumo (4aexnxr tatlp r uei s0s2toxr oy4ape mncilt) 2urumo;o4aet  i3ilslm2el(von()areoxr tydlmtr uvi t)srtrxo iodom nlnct ()a2urur no1tpt ifciasla ulnvpnu)aeermf3oatfp  anvi () 2xmir nu1am n fcsl( sDtr(r ou0open fcildfmDuanms;(0alxoiociotomt ai sl( trxr(r3iu1lpeemnctl(  Dtmx  ;o0tlx mieilslm ulnvo;u0trtrmr3oo1faDelneo t tetmim3oydol e fcia()a2raum ;t4tpen o3iadlm ua(vp;(0tetriocoa1omteaues;t s2uoim nodlm e fei t  2rm(roou4aex if3iyslm2um(mp;(4tleoifcio1fm rliei s trtoim3no4amee iesat aDraxm nu0tlto o3iaslm2em(ms;(4texrxo3totfaDeaivs s0trxoxo ny1apt  iesls aDtrumo;t0oetnifetad m2emnmsnu0trxrmocto1la r u s s  etmxrpnydap  miei t sDurum ou1aee mo3ilt s el(mo t)tltoxf3io1oate nesl(0 rxrxr oydam nmfet (  2ururp;u1oee moeilslaDeln o u0artnxr oodlmtelues s t2xoio nodlpt mfvia( srrr(  oo4aexoioeildls rluvonu4 rtnxr3iytoaDr i i ()trumio oudllt lfciasf 2ur(monu1tptn f3ild aDea( s (0tlerxf3tatom e ivs s0t2xmim3oodll nlivtat arur(r ;u0oet mfctytfm rlnvsnt0arxrir io1lmD livo ()seuoxmpiy4oltemfei ( s2tau ono4oltnmieilsfsDel( p u4arermf3totlmtrlies;t0t2tm(opou1oleelnes s)arta( pno4tet  octldla rmu p (0aexnxo3ta1fatr uei;s0 exrxo ou1lp  lfvsltf Dra(r ;u0ope ioctad m2rlnvo;t)tlxrxo to1fmDrlueilt0srurxo3iy1omt  nvtl(fartau  no4tetomi3iadlsDrlu o (0 exoxfcoo1lmDelieo;s s2xmxo oo1altnmnctl(farumu  oo0ape mfciasls rmnmo;u)texnxr todfp  aieols)seurxm3iydlptelnctl()sDum(r ;u4alx mfciadfmDum(vp;t) exrxr3ia1oaD lnvolt srurim oy1amenlnetasfsDrrum ;t0ale  f3iyd aDrm( o;u4areoxo3tydlatr neo;s teurir3ny4om emncsat  rtaum nu1optnio3tydfs2eluvo;u4tetoxf to1oaDrau olt  rtrxr oudap  lici s)aDtr( ont1teen ocils mDemn on(0aexnif3io1lmtean s s)s2tr(m3iudapee iet ( aDtrx  ou0oeen ociatfa2rauvp;()alenmrcia1laDrlnvo;(0seuoim3iy1olen icsls)s2tmxmonu0apt  o3ilt s rmumpn()aexnxf iodfpD luvsl( s2xr(opnodlltemnvt ()srtaumonu4tpxnifetlsfaDuluvsnt)texrxo3tytfp r ivilt0texr(r nodll e nct ()aDtm( pnu1altoioeilslsDeauvs;() leoxocootfmDr n il(  ruoio3oodomenlfetlsf 2tr(  ;t1tpxomocilt a2eanvp;(4 lerxo3iotlmteanes s0trxm(opny4alen feilt aDtr(m nu0olx  fciyd s rl( s (4aeeoif iytfmD  n ilt t2tm(mpiy1opt  ivias  Dtrx o;t1ale  f3ils s ua( o (0tltomr3iotfpDeaivo;t)t2xmxo3oydlpe lictas) 2trxm ot0aexniieiydfaDelums;(0tlenxrciytop  livi;t t2uo(m nydamen fvsls  2tr( o;u1aex iieils mDuanmsnt)tlerir3oodfmt  ivs;t seuoirpiy4op nmiesatfsDur(ro;o0tpeoii3iyd s uanvs;u4aetomo to1fmD  n s;s) 2umxr3no1lmt  ivilt) rtr(  oo1tlxn fciltfa2ra( s () rxrmfcto1lmt  nvi ()s2umir oy4llte fcilsf 2trumpnt0tpx  o3tas m2uln p;(0texoif3tatfptraneils trxmio3oo4ape licslsfsrtmump;o1aptn o3tadlsDuauvpnt4 eerxoctatlate nvo;( trxoxr iudlpee nvs t)s2uau onu0tlx mfeildlaDemn o;t4texnir ty1oaD li s s srtr(rpiudome  fvs s)aDrmx pou4oleomoeiydlsDrmn o t4artnmf iadlptr u i t sexoio3oydomeelfvtatf Dtaur nt1alxo iciadfm umuvonu4aexnif3tytlaDrli o (0seurim ou4ame mici (fsDtr( p;t1tee  oeildfs2el(ms (0 exrxr iotfmtrai o;s)srum(m ou1omeelfcsa() 2um( pno4oee mfetatfmDea(ms;u)trermr3ta1optelu sls  euoio no1ale mics tfa2urum ;u1aptn feildla ul(msnu)altomf3oy1om  lneo t srxoirpnodal elnvils)aDtau  ;t0oexnmi3iltfsDel(vonu4 rxnxo tytlp   ivs;t trxr(o3iodop emneilt) rumxroou0aeeoio3tad s2umu p t)tltrmociy1fatrlnvil(0sexr(m3ny1lptemneilsfaDtaur ou1tpenio3iadfm2ul( p u0areomr3iy1oateanes;t srtmxr iy1omt mfeils sDuru ont4tlxnmf3iadfsDua(vp (4 rtnxf totoa  auvo;(0srtmimpiy1ll emfvtlsfs2ra(rpot4tpx iocilsfaDra(von()tetnio3iatlaD  nvsl(  ruoxmpnu4llte ieslsf Drau oou4oet mieiasla2rln pnt) reomf ty1fpDe neo () etmirpiodome micsltf rtrx  ot1opxn iciad s ul(vonu)teeoxo3ia1fa   nei;s0 exo(o no4amt  ivs tfs2ua(mpnt4oleoif3iyd s rm(vpn(0aleoif3ia1lat  nvi;s0s2trxm ny4apee net (f Dra(mpno0oltoio3iytfs2ulu snu0 reomf iytlp elivs;s)s2trir3nudll nmfetlt) Dumur ;u1teenifeildls em(mon()tleoxfcoytfat li sls)sexo(mpiodopenlnvsl(fa2uax oou4apto ietadla elu onu) etrxfciydla  aiei s0 2urxm3ny1lmtnlnct t  rtrx  nu4oet mietadfs elnmon(4 lxrmo3tatla  livi ( trtoim3io1omenlnvias  rumuro;t1olxniociysfa elnmo;(0trerxfcoatomDelneo;s s2ur(opiodamenmieia()s2um( pnu4opxoioeildfm eaumpnt0tltrir ia1omD  neo s0sexm(r oo4lp e fet sfs2tmxmpot4oexomf3tatfmDraumo (0tltrxf3io1omD au sls0 eumxm oudllenlfes () rua(root0olxn o3iltlaDrmnmpnu0 rxoxrciadlpteaiesl(  rtmio3ou4amt livt t)aDtru p;t1tpt  iciyd aDrm(mp;t)trxoxfciytfa eaneslt)s2xrir3nydll  lnci sfartrx pnt4aleo i3tytfsDeauvsn(4treomocoydfpDeli s;() 2xm(m3no1apee fvsat sDtr(  ou1aex ii3iatfm2raums u4 rxrir iatoateai i ( s2xmxrpiy4altemict t a2uaur ot0opeomfcilsla ulu o;u4altrxfciadfmtraiei ( trxmxopno1al n ncsls) 2tr(m ;u0opxn ictydla rmump;t4 ltoxr oo1fptr u s (  euoxo oo4lmenlnvslsf 2uaurono0tltnmoeiyd m2ua( snt4alenxr iatoate i s;s)s2xrxo no1om  mncs sfsrtax  ;t4oeto ociyd s2eluvsn(0 lxrxf3iy1opDrlu i (  2tmio3nu4op emnet tf 2uau o;u0ale  f3ilsfm ul(mpn() ltrio ootfat  nvi;t truoirpny1omeemici tfsrtau  oo0tpeomf3tytfs2em(vp;t0 exrxocootlpDran i ()seur(rpiudom emietl(  Dtr(rooo4oexniieiyt s ulu p u0aleoxo3iadlmteluvo;(0srtmim3oo4ape lncta(f 2ua( p;u1opt  ociatls ea( o u)tltoif oydomt  u o s0 rtrxr iydomtnmnct ( aDum(ro;t0tlt mfctad m rlnmp;t)aexoxrcoydlat  i o;() exr(r ou1lp emfct tfaDrm(r ou0tpen i3tltlm emuvp;u0tlxrmfctotoateln ol(0sexm(r io4ale lnviasfsrtm(m nt1texo o3iadfaDrlnmpnu) exrxf3oydoa elivols sexrio oydom nmnvil(  Drmxmonu1olxniociltfsDea( p (4artrxo ty1lmtrln sl()sexm(rpoodapee icsl()sDrmxmonu4apeomfciyslsDrl( s;u4 rtomo3oo1lat  neslt) euo(r3nydom emfvi ( srurum nu4aptn feiys a2rlnvo;u)aetomf oy1fp rlu o ()srxr(r3nu1lp emivilsfaDta(mo;t4ale if3iyd m2ra(vp u)texnir3tatla   nvsls)t2to(r3iu1lp nmicsa(fsrrrumpou1tpto oeiat m2rmu snt4arerxr oadlpDrli o ()seum(o nu1ol  mnvsls  2umumpoo4oetomfctls sDranvon(4altnxfciy1omt anes;t) 2uo(m3ou1openlicta() 2ta(rp;t1tptnifeiyt mDranmon(4arxrxo3iytlmD au s ()truoio3ou4al  lfctat sDra( o;o0oleoifetadlmDraumpn() ltrxo oa1faD an o;(0 rtrim3iu4ole livtasfaDrrxm nu0apxomfciytlm raumon(0aleoif3ty1fat  nei;s0 rur(m no1lle lnct ( aDraurpot0tle  fciad a ranvp;u4 exrxfciadopt lu s;()t2toir ou1lmtnlnesls sDua(r ot4aexo i3iatfa rluvsnt4arxomf3oodomD li i;t0t2xrxo3nudlp nmnctas)s2taxmoou1texo oetlsfsDelnmo;u4artnxo iydoate i i;t t2xmio3oudale lfcia(fs2tm(ro;t4tpeomi3tlt mDean p;u) ltomociadomDr nvi;()texm(mpou4lptnmncsa()a2umxrooo1olxn ieilsfsDranmp (4teeomo totlpD ln i;s) exr(o nu4ape  fvt tf rrrxmo;t1tleo f3iadfmDrlnmsnu4altomr3oa1laDrlu ol() 2ur(r3nudlp n ietls)sDraxm ;t0alt  ociltfmDulump;()tlenxf oadlmD an s ( truoxo oy1alen fvsa(  Drau onu4aee  o3tysls2rmn snu0aexnxf3oadlptrau ils) 2xmir oo4lp nmncs ()srrmu o;t1aee ifciydlsDua( o t)artrircty1op raieo;s  2xo(o iydam e ivtls)a2tr(m ;u0tpxomf3tysla2elnvpn(0 lxrmr3ia1oaDean o;s) rxrio ou4llenlnciltfsDrm(rp;o4tlt mfcilsla rm(mo;()tleoxo3ta1fptraieils0setrxo3nodomeemivtl(  rraur oo0alen fcils sDel(vo;u0altoxf3oo1lptr ivo t sruoxmpiodol elnetatfaDtaxmo;u4tlxomi3tydfaDelnvp;t0 renxocio1omD  i i;s srtrxo3iy1aptemfei tf 2uax o;u1opxnifeiltls elump (4arxrmrciytlp eau s;(0 euoim no4llte ivilsf 2uau  ou0tptomietat aDuau s (4teeoxrcoy1fat lneo (0t2urxopiy1amtn feils  2taur ot4opxomociytfm eln s (4trtnmf3totfpteli o (0 rtrio nodomtnlfvt t)sDtax  ot0alen o3tls a2uaump;u)aexoxo3todopte iei t0texm(o3oo1lmtelfviatfa2ra(rp;o4oeeniieiatla2uau s t)aeenmfctydopDr nes;s  eumxm3oo4om emfci s)a2rrurono4tptnifeiadfa2uauvs;u0texrxf oytlpDrau o ()seuoxopnu1optemnesl()a2uau p;o0oexnmiciadlm2um( s t0 lxomr3to1fa eai o t t2xriopou4om  lnvsl(fa2trumoot1tle mf3iadfa rlnvs;()aeenmo3oodom e uei s0 exo(r3oo1ap e ivia()aDta( o;o4alxomfetls s rm(mp;u)tlerif ootla ean s;s texrio3ny4llee fcs t)s2umu  ;u0tlt  fetytfs em(vpnu4trtnmf3ia1op  ai o;t0 euoirpou1ll   icias)srta( p;t0apxniietlsls2rln s;(0aexoif oo1opD lueolt setrxr iy1ll  mnesa( arrmump;o4aeto feiys mDeanvo;(4 exrxr3tydlat  neo t setoir3iodolt  nviat  2rr(  no0opeomfciadfaDean o t4aetomo iodlatr n o s)s2trxmpoydap elfvsasf 2rr(mpou1tetoif3ilt a2eauvpnt) eeoioctodlaD  nvilt t2tr(r iodapt liesls)sDrm(m ;u4aee  o3ild mDrmu s (0 lxnxr3totfmt auvslt0 2tr(o nudoptelfes (  Durx oou4apxoio3iad s2emu o t)trxnmr3oytlpDeluvilt s2urim oudape mnvs t)artaxmooo1olx ioetatfa2umnvpnu0trtomr3totlateaueo;t) 2to(r3no4omtemfetltfaruau  nt0oltniieiltfs2ranmo t4 renif oy1fmt liei ( trumio ny1lpenmfesls)s2rmumpoo0aeen o3iytlaDum( pn()trerxf3iadfatrlnvs;s0 rumio iu4amtemiet ()arur( o;u4oet  o3iydlmDra(vpnu) ltnio iadfp eluvo;s)t2to(m3io4lle lics t sDraumo;o4apeomiciaslm elumonu0 exomfcoydfp rlu o (  etmim3io4lm  lies sfsrtrxronu0oltn ieiatfs ulumpn()tltrircoydomDr ieo;t)teumim3iy4ap nlivs ()artmx  no0opt mfcild m uan pnu0 rtrmocto1oaDe nvsl()t2urirpiydome  iet (fa2trxmpno1tlt if3tlt m elums;()aeenir oadfat  ieilt)sexm(opiu4opt lnvsls)sDrmurpnt0ale ii3iysfa2ra(mo ()trxrio ty1latranvi (  rxo(r iudaltn fct tf Draum nu1tlx ii3tls s2ul(vs ()texomocootopDe i i;t0 rumirpiodop elneilsf Drmurp;u0alen ieils aDum(ms u0aexrif iydla  luei;s)teur(o3no1om elivs s  rrmu  ot1aex ifciydlm2ran p;t4aexoxr3iadfmtelivo ()tetrxr3oy4ol   ies tf Dtr( poo1tpxoioctydfaDem( pnt0treoxoctydom  lu o;( setmxm3nu1lm elnei s arrrx  nt4tetoifctlt a2rm(ms u4arxnio3io1opDr ueo;t teuo(m iu1al   ictat s2tmumo;u1tle ifciytlm umu o;u)texoioctatla r uvo;t0 rurimpiudlpeemfci t)a2rrum ;t0oltniociltls2em( o () leomf3todlpt livs;(0 2tm(rpou4ame  ncsatfaDtmxmoot1tee mi3tyt a2ulnms;u4 exrio ty1faDe n ols) eumimpoy1op nmfeils)s2ra(mpno0tpt  f3tasfs ul( s u0 exnmo3ta1fpteauvi s)s2xmim3ny4lpt mivt sfa2trxronu1tetoiociasfs2ran snt0trtoif3oo1lp  lieil()teto(opio4lmenmfesasfsrtmur ;u4altn oeias m elnvont4alenmf3iy1lmteli o t  euoiopnu1oleemics t)arrmxr nu1tpxnif3tltfaDrmnmo t0artnio3oodlptrli i;t srxr(m3oydol nlfvsa( sDtm(m ;u1optnmi3tytfm2em(vo;u) rxrmr3iadom  ln o;s  rxrio iu1apen ivsat)aDtaum ou1oex  ieiyd s uln s;() lxoiociydlpteln i;(0setoxo3oo1amt  netl( srtrx onu4tptomoetytfm2rl(vo;(0tetrir3tadomDeau il(0setm(rpio1olenmfvtas a2um(  oo1apx ioeiyd s2rmumo;t4 lerir oy1lmD  uvi;t trumio nu1omtnmivtatfaDra(  ;o1tlto o3iadfsDranvp;(0 rerio3iadlp rln s;t)srto(opoudoptemfci t aDtm(rpnu0apeo i3iytfmDuluvo;u0 leoir3iotomDeanes;(0trxm(o3nu4lmee fvt ()artr( p;t0ole mi3tlt mDuau o;()texnir3to1fmt  n ilt0texrio no4al nmfeils) Dra(monu1oleomociadfaDua(vp t) lxnxf3tatlatelnes;s sruo(r oodop nmicias s2um(mpot0oetn o3iysls rmuvo;t4alermrcoadfaDelu il(  2uoxo ny1omeelncias srta( ono0olt  iciad s um( o t4aexnmf ta1opDeai sl( t2tr(m3oydomt miet t)s2umu pot4oexoio3tadfm um( o;u0aexomo3oydlaDe nvs;s0s2urxm nu4alen netas aDumu ono1alxn i3ildlmDua(mo;t) lxoir ta1fmtrlneils trxmxo3ou4op elneilt)sDtaxmooo1teto i3iyd s rlumon()aetnmo totlp   i s s)srxo(m ou4olt mfvils a2rm(rp;u4oetnioetat m umnmp (0aleoxo3oadfm elu o;(0sexmim oodlp emfvtas  2ur(mo;t4alxniiciatla2ean p;t0altoifcoadlatrliei () 2xriopio4ap elnvtlsfsrrmx oot1aetoioctydlm2em(ms (4tleoifcia1oatrln s ( setr(opiodap nlicil(f rtrxr oo1oeeo i3tyt a2uaumo t0 lxoio3to1opDeanvslt0srtmxr3iydlptnmivtatfsDuau o;u4tetn f3tasfs el(ms t) eerio3oy1lmtr uvo;()srxm(o3io4lp nmnvi t srtr(mp;t1tpt mociaslaDrmnmo (4teenio io1om  anvils0srxoxopiu1altnmnesltfarumx pnt1alto ieiyslaDumnvpn()aetnmr3oydfpte n slt0sexoim ny1alee ics tfaDrrxm oo4oee  octytlm2um(mp;() rtnxf3todlp elneilt0t2xoxm3nudllt mictlt)sDumumo;t4tpeoiocias m2ul(mp u0tlxoxo ootfmte n sls srurio oudaptemiciltfsDra(root4opxo fciadfs2eln pn(4arenmr3iatfptrau sl( s2tm(r oy1ap nmnetl( arrrxrpou4altoifciytfm2rl( o t4trxnirciatlpDrluvs s0t2urim3iy1om emivtas)sDtm( ont0texnmf3iydfm ra( pnu4tltrmoctydomt lnesls0s2uo(rpou4opee iviat)sDtru  ;t1tpt micias a ulnvpnu0 ltnxfcoo1oatrln ol(0 etmxr3ou1apeemieiat) ruaxrpnu1oltomiciyd s2elnvp t0teermrcty1omD  i sl(0 2uoxrpiu1olt lfct sf Dtrur oo1olx  oeiad aDrln on(4arxrxf tadlpDe nvs ()teur(m oy4omte neta()aDta(mp;o0tpx ioeiytla2umuvp t4trenio ia1fa  auvs;() rxoxr iydaptemfcils  Dtauront4opxomoeiyt s2em(ms u) lerifcoydopDelivs;t)teur(r3iu1lp n fvt (fsrtrx p;u1aetnmfctadfmDeln p t)tlxoif3oatfpDraueo t t2trimpno4aptnlfcs t)srum(m ot0aetn fciydlmDran o (4 exoxf3oo1fmt lnvs s)s2um(o oydapte fcils) rtaxmooo4alto octyt aDea(vp u0aexnirciotfm  livi;t0trtr(opnu4amtnlfeia( aDtaxmp;u1apt  oeiat s um( p u4areoio3iydfmDe u sl( texrim iodam elncil(fs2rr(moot1apenioctydfs2el(mp;t4 eenmf3oytlm  an o;s0 rxrxmpno4apt mfvil()sDrm( ono1tpen ietytfsDrlu p u4 lenxociatfm  au s (0 exoxopoy1open fvils aDtaumpnu0oetomo3iatfm2ulnvs u)texrmociydfa  auesl( srtrio nu1aptemfvsat)sDtr(mpnu0aet  ociyt mDel(mp u)tlxnmrciatoa e ivi s)t2xoio3no4ole lnes s) 2ra(mont1aeenio3iadls ulnms;()areoxr3iotlmDrlu o;s) 2tmir3nodlle lncsas) 2ua(  nu4tptn f3ildfs rmu onu)tlermf tydopt li s s0sexm(o3nu1lme lict tf 2uru  ou1opx if3iltlm2eaump;t) exrxf oodlatrli s t) etmir3oy4am nmneta(  2tr(ronu4tpxoii3tasfa rmu s u) exnxf oatfmtrlnesls0 2trxo3io4om   nvs (  rtmxrono4teeo i3iytla rmu s;(4teeomrctydopDr nes ( trxrimpoydll emnvtltfarra( pno1alxomieiatla ulump;(4trxnio iy1op ean ols) etr(r io1amenmieias)a2uaxm ;o4olenmoeiadfaDrlump;u0aeerir3ootop  lies t0 2xrimpny4opt mnct tfa2trur oo4oeeo ocilt aDum( p;(4altnxf ootop e n o s)t2toxo nodole mneiltfs2rruroot1alto ieias a2rluvont4 eeoxr3ty1fmtraivo;t0 rtoxr3iy1oltn ivs tfs2ra(  nu1ole ifeiytls elumsn(4treomo ootoaDelies (0 rtr(o3iydlm  mnesls arur(rpnu0aptn octlsfm rmuvont4aexrxo oy1latelnvo;t)sexrio3oy4lpee net s)a2rru  nu1aex  ociytls2rmuvo u4 lenifciadfa   uvo t0 rur(opoy1ame miei (fsDuaurpnu4aet io3iyslm2umuvp;u0tlxoxf oa1fmD lu ol(0s2uoxr3iu4lme miviltf Dtauro;t1alx  iciyd a ea( o (4arxomo iatlpt  ivils)teumimpiu4ol elnciasfsDrrurpnt0teen ociat m rau s;()trxnif3ootomDraues (  rum(r ny4llenmncsat  Duaxm ou0tpx  fetatfa eaumo (4tetrxf totfmtrau il()s2ur(r io4lpe mfvsas) rururpno1tlxn o3tad s umuvp;t) lxrif3iy1fa eaneo;s t2xrxo oudol nlfvt (  Dra(m ou4tlenmi3tls s ul(mpn() lxnxocio1lm eai sls) 2uo(r oo4lpenlieias aDtrump;u1tpx mfeils aDem(mpnu4 rxrmrcoytfpDranes ( truo(r3oy1lpenmictlsf Drm(rpnt1tleomi3ils mDumn s;u0aeenxo3totfatrluei t0 2xrxo3oo4lmt lncsa()srtr( pno1aex mo3ildfs rluvs;u4tlerxr3tydomt luvolt) exoim nydom  lfvt tfsrua(ro;u4oex iictltla2ean on() reoxocootfpteauvo;t) exo(o3nodaptnlnct ( aDtruro;t0optoifctasfm rm( s t) exrxocoytfpDe neo;t0trto(o3no4ll   fet s srur(r oo4alt  i3iatfm ean p;t0 etrxr3ta1fp  lu o;t  ruo(o3ou1oleemfei sf rta(mp;t0oee ioeiatlm2elnvo (4 lxnxo todfat  ivol() 2urxm oo4am n nvtas) 2raxm no4alxoiieiatfa2uluvon() exnxo totlptrauvsls)sexmxmpiudamtn fci (  2rmu oou4tlt iicildlm el( s t)arxnif3tytlp  lu ils0srum(r3nydlpen feia(  Dumxmp;u1tpx  f3iyt s2rmu on()artnif3ootom r i o;t srtmir nu1lm n fvil()arrrum ou4altomocias aDum(vs u4trxnxocty1lm rauei () eum(m3no4omenmfvi ( a2rrxmo;t0tpxoifctltfaDrlnvonu)treomrciydop rlu ilt t2urxo3oo4optnmfcils) Drrurpno1opxoii3tytfs2uanvp t4tltnmr oadfmtrlivi;s)trxo(opou4amenmnciatfs2tmxmonu0tpto o3tadfm2ean o () exrif iytoa e n ilt tetr(r3nydop   nes sf ruaxmoou1olxoiociysfm elnmon()alermo3iotfpt anvol( s2ur(opnodlle lfeiasfs2raur ou1oetnio3iadlm umnvp;t)tlxnif iadlaD  uvs s  rxmim3iy1llte fct ()s2rrx pot1aptn o3iytfm2eluvpnt4 lermr3ty1oat ln ils) 2xmxr3ny4alt  ies sfaDrm(  nt1oltnmiciad a rm( o;(0altnio to1opD lnvs;t s2xmxr3oudame lfvtls arrr(rpno0aeenmfciysfmDrm( s;u)teenxr oadlm rluei t)trxoimpiu1ll nlnes s aDtmurpoo4tex ii3ilslaDumn o u0 reoxf oa1lmtraivils)t2tr(r3oudaptnmnvsltf 2trxmonu4oltn f3iysfmDrmn s t0 rerxf3oadfptelu i (  euoio3oy1amt lfvsat sDtauro;o1olxnmo3ilsla2rmnvon(0 eenmo tatlm   u ilt)sexoxo3iu4openlivt t  Dtax o;t4opt  fcils m uau o u)trtomfcoa1lpD  i s s0srtrxo3nudlle mnetl(  2rr(m ;u4tlxnmfeiatfa umump t4 rermr3ty1lp rluvsls) 2to(r oy1lptnlnesls)aDur(r nu0apx ifciat m em( s t4 reomfciatfmtrlies s) 2ur(m3ou1lle  ies s) 2rm(r oo0oee ifeild m2rm(vo u0aleoir3ty1lmtrai i (0trxrxr iydlpt  ivi (fsrraurpnt1alt mi3iysfa um( o u0 lerirctydlpDeln i s teuo(o ny1apte fvil( aDrm(r ;u0olxoiiciltfm2uanmo;t0artomrciodla e iei t0 rtrio3ny4om n ivils artaumo;o1aetnifciys s uau s;u) eenxrcoadoa rluvi;s) 2uo(r iodlpt lneslt  Dum( pno0oexoioeiydfs2ean s (4aeeoif iadlp r u s;s srtrxm3oo1ale micils)a2uax o;t0olxomf3tadfm2eluvs;()tltnmfciydoaDe nesls0setm(m nu4lp  lnetl()sDrax  ;o4apxnio3iltfa rl( s;t4 rtrmfcto1om elueslt setrim no4ameelivil( sDtaump;u4tlx ioetasls2ra(ms u) rxomrciotlaDelneolt s2to(opio1olt lfesasfsrtmur ;u0texnmfctltlaDran s u4tlxoxociydopDeanvs t) rtoxopiy1omtnlnvsl(fsDumxm ou0opt  ociasls rau s t4alenmo tadfatr ivil() 2tr(m3nodom e fci () Dtax p;t4aetn ociytfaDrmuvp (4artrxrcoodla   ieol(0s2xm(rpny1opee nvi (faDrau oou1aexoifeiydls uauvpnu)alxnircoadfpteau i ()s2xmxo ny1lmtemfvi t  rtaumo;t0aptnioeiydla2elumsnt0tlenmr3iy1om e u o;t0texrxrpiy1am  lnei (fa2ur(mpno1altnmf3iytfa2ul(vp;t0aetoxrcta1fptrauei;(0 2tmxm oo4omenlfcia(fsDrr(ro;u1oexomf3tas mDrluvsnu0 ltnmf3oatoaD au o;() 2tr(r ou1amenmfvsl(  rrmumono0oexnifeiadfa ea(mo (4alxrir iytfptranvo t0trxoxo io1lle lnvs s)aDra( ono4aexnif3ils m2ea(vs u4trtrxf ootfatr i ol(0seumxmpoy4llte ies ( sDurxroou1aptnmocilt s ua(mp;t)teerxoctodfpte uvslt0tetoxopiydamtn iet t)s2taxmoou1tlx mi3iyslm2rauvsnt0tetrmf3iatlm eaieo s  exr(o oydoptelietl(faDtmxr ;t4oetnmf3tatfaDuan p (0aetriocia1lp   u s;( sexrir nodap  mnciatf Draurpno0oeto feiydls ea(vsnu0tltnif3to1lptelu i;t) 2xr(m3nudomtnlfvt t sDtmxr ;o1oetn o3iyslmDrmu s;t)altomociytlpDr ieo;s  etmxmpoodlmtnlfcia(f Dtmx p;u4aptoiieildlm2ranmpnu)tlxomo iotoat liei;t0teum(opiu1lpe  fetat)arrmx p;u0aex io3ils aDumuvs;t)trtomf3iydfaDe ivo s)teto(opio1ame livilt)s2rax onu1aexo i3iydlaDra( sn(4tetrir oa1opt ln ils)trxo(o oodomen ivsat) Duaxmont0tlxn f3tlsfmDrlu o u0 etoif ta1la  lnes;s srtrxo3oodlm emnvias srrr(mo;o4opxn ociydfa2uan snt)arxomociydlat  iesls) exoxo3nu1om n fcs t)sDuru pnt0tpxnio3iatlaDel(mp;t0trenxf ootfa   neo;s)t2tmxo oy4ap emictas sDraur ;o1opxo oeilsfm2elumo;t0tltrmf3iytom elu s s)teuoir3iudam  lictlt)sDra(mpou1tle  ocildla raumo (0alxrmo iatopDr i sl()sexo(o3nydomtn iei (f Drm(mo;u1oetnmietltlmDem(vo t)altomrcoatlaDr iei t)t2um(mpiy1aptemfvi () 2rrx pnu1oetomi3tasfm2ra(mo t) leoircta1fatrlneo;()s2xrxr3iu4omtnlivi (fa2ua(r ;t4olen oetadfaDulnvs;(4 rtrxo iy1opt  uvsls srtoxo3nu4lmenlivtls)sDurxront0teto oeiadfa2rl(vp;t0 eeoif oadfp e uvsls srxm(rpiodamenmfcilt) Dumxmp;o1aetoifeiatfs umn s;t) etrif3oodlpteln s s t2xoir nydop emncsl(fsrrmum no0aetniictyd sDuanmonu4tlxrxo tytlmDeanvsl(0t2trirpnu1lp e nei t)srrmurp;o0tlxoiieild aDua(mp;(4alenif ta1oatraiei t0 2umxopoudlm   ieia(faDrr(m ;t4texnif3iatfm emnms ()altnmfcty1fmt ln o;t srto(r ny1ol e ies (f 2tax  ou0tee io3tlsla2el(mpnt4aexrio3ia1lptr uei (  eur(opiy1omtn nct ( aDrmur nu0opxnioeiysfa2ul( p u4 etrxr3ty1opDeai s;s0trxrimpny4ame mnvil(  Drau pno1altoioetadfm2ulump;u4aeeomrciadla elivilt0s2xr(r3no1amee neil(fsrtrumo;u4apen f3iytfm ul(mp t0treoxr tatfmt  nvs t0texm(opou1amenmnci ()sDtmumo;t0alt  oeiltfmDra(ms t4 lenio tatlpDelnes (0 exmxr3ny1altn nesls)artax onu0tpto icilt s um( on(4 etnifcoydfpDe uesls0srtrxr oy1lm e nvils)s2trx  no4tetoioeiyslm ulnmo;t4tlxnif3iotoa eluei t t2uoxr3io1ap   feilt) 2tax ooo4alt  ieias s elnvs;u0trtnmf oo1fpteli slt t2xmirpiy4lle lieils s2uaxro;t4tltnmf3tydls umnvpnt0 eeomo ia1faD  uei;t0 2urir oo1lmteliei (fsDtrx p;o1teeniieiytfs ea( pnt0 lerxo3oytfmDe uvs s) ruoxrpny1amtnliviat)a2tmuront1aex ioeiyt a2uau o;t)arxoxf3ty1laD  uei t) 2tmxmpoy4llte ivs s  2tr(mpou0tpe  o3iaslm2rm( s;u4 eerir iatomtrauvi;s t2tmxmpiydam  mfesltfaDumx  ot0aet mieilslsDel(monu) rtomfctatop e u slt) etmim3iudaptnlfvias  Dtau o;t4tpxnmfeiatfm eluvs ()artnmfctotom r i s (  eur(mpno1op nmicsl(  Drmuroot4aexomf3iytfaDum(mo ()teenxf oy1lmtrlneols tetrir oo4ap nmncil(  rrmxmooo0aeen oetad s em(vs (4texoio3oy1oa eauvi ( trtoim ou1ll elncsas)s2urxrp;t1tlxo octltla2rl(mp;t)trenir iotoaDeaues s0 ruoxr3nu1llen netls)arta( p;t1aptn f3iytlm umn p t)alxrmfciodfatrliei s)s2umxo3no4opt lnet s a2tmu pou0altnmfciadlaDuaump (0alenmo3tatopD  uei s) eurxmpoy4lltnlfvtat arrruroot4oeeoioeiytla rluvo;t0alxrxocio1oa   n o s)srtm(opoodap n ncta(f rrm(  nt4oltnif3ias a umnmont)altrxf iodoat  i i;s0 ruoxo3ny1aptnlnesat sDur( o;o1altn oetlsls emnvo;()aeeniocoodfpDean i s setoiopnu1oleelfeiasfsDuauroot4tlt moeiadfmDua(vp t4artoxo3oa1oaDeluvo;s0 2uoxopio4alt lfes (faDtru  ot4tlto i3iltfa2rln o t0teerxfctytfatrli s s  rxoio ou1om emnei t sDtaxmpnu0apenifciydfm umnms u) rxrmfctytla eaneils0t2urxr iu1alt mivilt) ruaumpnt4oltomfetytls2ulnvs u0alxomocta1opDeauvo s)teur(m oo1oltnlicta()sDuau p;o0optn o3iyd m2rm(vs (4tlxnir iydfmDeliei;s) 2ur(o3no4lle  fvsa(  rua(mpou1oet  feiasfm2ul(mp u)aeermo oa1lptrlivi;s0trxrxr3iudap n nvtls)a2rmxmpou0oeeoifctytla uln p t4 ltnif3oodoptelies;s)truo(mpoo1om nmncs ()a2tmxmpnt1ale if3ilsfs2um(mpnu)tltoif3oydlpte ivilt  exoxo iy1lpeeliet s a2raxmo;o4aex  icildlaDuluvs;t4 ltnio3ta1lmD lnes (  rtm(o3io1lme lict t artmx ono0ape  feilsfm2emumon(0areriocty1fateaivi;t seurxopoy1ome mnci sfa2ur(moou1opx ifciys a2rmn snt)teenir3iatfm elnvsl(0 eto(o io1op emnct t s2rr(mp;o1alxo ieiysla rl(vpn(4arxrmr3tadfmtelnvsl( s2urimpnu4olenmietltfsDtrx pnu1tle  f3iydfm2rln p;t) eenmf oa1fmtrlnvols)trtoxmpoo4apenmfvils a2trur ou4oexoio3tysfa2ul( o;t) exomfciy1opD  ieilt seurxrpiodlm   ietls) rrmu  ot0oee  f3tldfsDrmnmpn(0tlenmfctodfm r n i s texo(r nu1ap   icta(farumxmoou1ale iocild s2ulumont4 rtrirctatlmtrlivolt)s2to(m nu4amen fct t)a2ra(m nu1oee iiciasfm eanmo;t) rxomfciatoateluvo;()t2xm(opio4ap elies s sDurur no4oet mf3tysfm uauvs (0tlxrmf3oy1oaDeai s;() exo(m3nu1ole lfcta( s2rmum oo1ape  ocildlsDrmn ont0tltrmr3iatlpD livols) 2xmirpoo4amtn ncil( artr( p;u1oltnmoeiltls um(msnu4aexnmf3oodomt auvo;s srtr(r iu1olte ivtas aDrmu onu4altoii3iltfa el( snt4 rtnmrctydfpDe i s;( sexrim3ou4lpeemiet s)a2uaxrono0oltniicild m2emnmp;t) eerif3tatfa elnei;()texrxopiy4omt mivt (  2ra(mpot4oexnioetysfa rl(vsnt0 etrifcio1lpte i sl(  ruoxo3iy1lltelnci (farurxmpnt4apeoiociytlm ua( ont0arxriocio1om rau i ()srtoimpiudolenmivia()aDua( pnt0tetomieiatfmDulnvo;u4tltnxf3iy1fatelnei;t s2toio oy4apenmieiat)arrrx  ou4openio3tytls ranvsnt4altnif3iatfmte nei;s s2toio nudlpenmfcia(faDrr(m ;u0apt moeiltfa2rl(monu4tlxnxrctodfa elnes;(0srxrxrpio4openmivi (faruax  ot1ole mociytlsDel(mp;u0tltomr ootfaD  nvs s) 2trxmpoo4lleemietltfs2taumoou0ope if3iydfa2eln o u)trxoio oytfmt anei (0sexmirpoydamtnliciat)a2urumpoo4tpeo oeiytfs eln o t4aetnir3oy1laD  u sls0teurxrpiy4amtemics (f Durxm nu0aeenifciydfsDulu p (4 renxf tydfm rli ol(  etr(m3nydaltn fvias aDrmur nt1apt iieiatfm rlu onu4tlxrmr todoat auei (0teur(r iodll   ici t) 2rmxm nt4alxo fctysfm2umn p u0alerxf3oydomDe ues;(0srxr(o3nudaptn feiatfa2uaurpnu4alx ifctatfaDul(mo u4aeerio tytfmt  ueil() 2trio io4ap emncs ( arurumont4tpe mi3iydla uauvpnu)teenxr3oa1fatrauvils0texoxr ou1amen fvtl()s2uax  ;o1tex  o3iatla rl( p t4 renxf to1lm  luei;()texoimpoy1ope  ivtat)s2tmx o;t4tpxo i3iydlaDra(mo;t0trtoxr3oytopteaieslt0sruoxr3oo1lle micsls  2ua(mont4tpt iieiysfm2rlu o (4teenio3ty1lmte i s t)s2trxm iydol nmfviltfaDua(m oo4alxnifcildlmDulu sn(0 lenxr3oa1lpte ivi t)seumimpiodamtn fei ( srtmxrooo0olx  feiltla2rau p (4aleomo3iy1oa   ueols seumxr ou4lme  ict ()arua(rpoo4olxo oetytlmDea(vpnt)aexrmr tydopDeaueils tetmxrpiudlpeeliei t aDua(mo;u0tlxoiociltls um(vpnt4 ltnmfctodlmD  n sl(0 exmxo iu1lpe lfci tf Dua(mpnt1tet moeiatfsDrl( s t) exnxo3to1optraivo;() etrim ny4lpt mfvtl(fsDua(mo;o4olt moeiysfm eau sn()alxrmfciodfmtrau ils0 euoim3nydolte icsat aDrrxmonu1tleomfctyt m rmumpnt4tlxnio totla eluei;(0seurxo3oydop   iei s)srrm(mpno4teto iciltfm umuvs;u)tlxnxo todlm  lnvi t  2um(r ou1omeemnctls arraxmo;o4alxn i3tydls2umn ont4 eerif3tydla ean s;t)srxmir3ou4ole mict t)aDraxrpnt4tetn ocildlm rmnvs u)artnmr oydlpteli olt sexrir3nydalt lies t aDra(  no1tpxnmfetlt sDulnms;u0trerio3oo1opDeauei ()sexm(opnu1omtelneta( aDtaum ;u0oexnmf3iatfaDrlnvsnt)artrmrctydomD  n s;t) 2um(o3nodomte nesasfs2tmumo;t4opt iocild a2elnvpn(4tleoiocoytopDrli s t)s2uo(mpiydamte iesasf 2rmu  ;t1aet  o3tldls emn p t4tleomoctodfa  luvi;()truoxrpno1omtelnes s s2rax poo4aptnii3iasfm rmu o t)arermf3oa1fmDrli sls trto(m3oo1al elfeiltfartrxmp;o1texoii3iytlm2rlumsnt0 rxoxfctatoaDeluesls  rxm(r no1amtnmictas  rurxm no0oeenmietldlm rm( sn(4 etnxf3oodfat luesls) eurxo3no1lltn ictas srtmumonu0tlt mfeils s emuvpnt)texnmfcia1fmteai s s  2urio3io1lle mfes t a2umum oo0aptnmoeild mDrlnmp;t0arxnmo3iatoa   n o (0srtmir3oy4oleemncsat  Drrumpoo0tlx iietlt a2ua(ms;u0alxomo3tatlaDr i s;t trxrim3nu4ll elfciasf rumur ou4tpenifeiatfm2ulu p;(0 rxoxfciodlmt anes (0 2xo(r3oy4amtnmiesat)srtmurono1apeomo3iatls2ua(von() rxomo iadopt lnvi;(0 2tr(r nodopt lnet s srta(mooo0oeeomf3tld mDem(mp t4trerio oy1fptrlivs t  2trxm3ou4lm eliei tfa2umumonu1aee  i3ils sDea(ms ()tltnxfctadoptrau il()sexo(o3oodlmenlnvsas)s2ra( o;u4tpeo ieiysfs2eauvo t4 exrir oodopDeluei;( s2um(m3iu4oleemict s  2ra(mooo4tpeo ietatlm ean pnu0 rxrxfctadopt lnes (0 etr(r3oo1ope  iesat arrr(rono4tetn f3tat aDelump (0aetnmf3iotfat anvil(0t2tm(o oy4amen ncsas)srum(mono0optoio3iys m2emnvpn(4 rtoxo ia1lptrauvils)seumxr iudlpt mfet tf Draum ;t4oee mieildls2uanmo u4arxnxf oadlmtrlnesl(  etrxo iy4omtemnvi (fa2rm(r ou0tlx iociydls rlumo t) eenmr iadlmtelnei;t trxrio oy4op   fes sfa2umumpot4tpxo oeiys sDuaumo;(0artrxo oydlmDeaueolt teumir3oo1ol elfeslt srtm(r nu4teeoio3iytlm2ulnvonu0artoif3tytfa  au ol() exm(r nu1lp emncia() 2urx p;o4oltoii3taslsDem(mp u4 lenif3oy1lptrlnvs;(0trtm(r3iy4op nlnct s s2uru  ;u1ape iictasla2uanmpnt0altrxf tydlat ln o;t)seuoxr3iu4omte fvt (f 2taxr ;u1ape mo3tysfsDrmuvo (4 ltoxr3tatfp e u sl(0trtoxm3nydllenlncs (f rtrum oo4tetnmfeiadls2emnvo () renir iy1fmtrlneo;()setmxmpoudom e nvsatfarrrxrpoo1tleoioctldfa um(vpnu)trxnmo3tytlateln s;()t2um(o ny1al e icta(fs2tm(rpou1opxn octlslm2ran s (4 lxrmr3todfat au ols0t2to(m iy4lmtn fetls) 2tmu pou0tltomfctatfm ul( snu4 ltnir totoaDe u o t  etmxmpoydlm elivsasfa2umxmpno4tpx mociad aDrmn snt4arenif ootlmDr uvi () rxoxopiy4lmtn iesas)srtmxrooo0teenmo3ilsla ranmp;(4 lerio tytfpteaivs ( srxo(m3nodal emfcsls aDumump;u4aleo ociytla eaumo u0tlxrifcta1lat lnes (0t2xrio3oodlme lfvil(  Draxrpou4aetoifeias a2umums;t0 rxoir tadlm rlnvi t tetrirpoudlpenmnctat)sDtm(rp;t1opxo ieiyt a emuvs (0arxoir3ootoa ranvs t  etoir iy1op e feilsf 2um(ro;o4alxo i3iadfa emump;u0aetnmf3iytlptrli i;(0 2xo(o ny4alen icslt)arurur ;t4alxn feiltla2um(vs;t0 exnxr3iadoaD lu ilt) 2tmxr oydlpeelncsa(farrm( ooo1apx  f3tldfmDelnvonu) lxnir iodlaD  neo t) 2xo(r3nudlme mieslt  rrmxmpnt0apxomfeiltfm rlnmpn()trenifctytlpte nei t)trto(opnudope livi s  rtaxrpot4apt iociadlaDra( o;u)tlxoirctadomt lueslt0t2tmio oudaltelieslsfaDumxr ;o1aetnmfctys sDrlu o;t0 lxnmr totfa r n o;()teum(m ny1ap e nei s sDta(m no4texn o3ils m2el(ms t4arxrxo3iadfpDeaies;s0 rtoim3no4opte iviatfartaurp;u4apt ifciysla2ran o;t4trxnxr3oytlp e nvo () rxo(m nu1apeemfvs s  Duaxmpnu1aetomfeiydls2ra(vsnu0 ltrif iytopteai sl(  eurxmpoo4al  mnct tf 2uau  ot0oex moetatfs2ra(mp t4arxnxrciydfaDrauvilt srum(r no4amenmieilsfarraxmpot1tee  fctytls um(mp;t0aeermocoatla  anvils0 2xo(o3iodam  mieiat) Dtax onu4apxniietat aDul( s (4 etomo totfp   ivi;s)t2tmimpou4ol elneias  rrrxr ;o4tltnmictadfs2em( snt0 renifciydom rai o;s)tetoxm3oo1al nmfvs sfa2umxm nt0oltoif3tadfm uln snt) exoxf tadopteauvo ( trtmimpno4ll nlfctltfa2taxrpou1aleoioetydlsDean s;t4artnmf3iytfa rlnvolt s2urxm nu4olenmnci t  2tmx pot4oetnmo3tatfmDem(vs (4tlxoxr3oo1fpt ai o;s)teto(o3nu4al nlies sfaDtrurono4apeoiiciydfmDelu o;u) reoif3tatlpD ln o t0 rtr(r3oodopt lnvt t)s2uax pnt0ole io3ilt m2ua(vo t4teenxf oadoat lieo s) euo(mpny1apt lnciltfs2umxmo;t4ape iocilt aDrau o u)tlxrio tatfmD lueolt  exm(rpnodal e fet ( a2uaxmpno4aeenmfeiaslm emuvpnu0aexnif todfp  lnes;s  2tmio nu4amtelnct tf 2rru ont4texoiiciltlm2ra(ms;t) etrmo iy1lpD  i sls)s2xo(mpoy4ape lict s sDtmxmpno4apxn octysfa2ean sn(4tlxnmfctatop r ieo;() eumim nodop  lfeta( aDra(m nt1alt ifciydlaDelnvs u4trxoiocoodopD livs;t)t2tmxr ny4lmte ieta()a2ua( onu0oeenmoeiltfa uaumo ()arxoircoytlaD li ols)s2trimpoydopenmnvsatf Dtm( p;o0tpxn ociyd a el(vont)areoxr3ta1omt lu s;s s2xmxo iu4lpe  fetls)arumur oo1oltomi3tysfaDem(ms (0aeerif iatoaDr nvol()sexm(r3iy1lptnmncsl(fsDta(mpoo0opt mfciad m ra(mp;t0areoir oadfatranvi;() exoiopiydale livs (f Dumumo;u4tetoif3tldls2ua(vp ()tltrxo oatlaDeanvs s)tetmxr3iy4ole lfct s) ruaxmo;o0teeoifetld mDra(vo t)tlxomo3iydlpte n i;() 2tm(o3iodlmenmietatfa2rm(rpot4tptnmfciytfa rmuvp u)trerio3io1la eaivi t  2umxr3oo4lm  mivt ()srrrur no0opxnmietldfm2uau p;u0texrxo oy1fp  au s;s)s2tmxo iudll nmfcta( a2rrxroou0apt mieiaslaDeau p (4alenircta1oa   n ilt seurimpny4omtemfvsl(fsDraxrooo4tltn ocils a2ul(vpnt)teenxfctatfa eluvi;(0srtoim io4amt lnvsat)aDuru  nu4olenmoeiadlsDulnmonu) lxrifcootfmteaneslt)t2uoxrpoudlmeelneia( srtm( p;o1oexnmi3iatla eluvsn(0tlxnir3iydlmtrai ols setrxrpoy4alenmici ()artaxm ;o1opxo ieiltfm2ulnvpnt)trxrio iytlpD aueo;( trtm(rpiu4al emfetlsfaDtaxmoot1opt  iciasls emuvpn(4aexnio to1omD an olt tetr(opnu4lm nmnvsas  rraxmont0aetn i3iasfaDea(vo;u4arenxfcoo1laDrluvs (0tetr(r oo1lle  fctltfs2tmx  no4teenifciyt s2um(mpnt) ltoir3iotlaDe n i s)sexoxr oo4ap emfvias)sDtaxrp;o4aet  o3iatla2ua( s u) ltoxo3ia1lmDr neo;t0teur(opiy1al emfcslt)a2um( ont1aexoifeilt a rl(vp t4 eenifctadlaDeaieo t)srtrxr oydol emfct () 2tm(mo;u0oltn o3iad a emuvo;u)aeerxo oydlmte u s t  2to(r3iy4om emics (  2trur ou0tlenmo3ias m2eln ont)tetnir3totfptr nei;(0 2tr(r3ny4lp nlivsltfa2rmxmooo4aexomf3ias m rlump (4trenxfctydfmDrlues t s2ur(opoo4op  lfet (  rtru oou1oexomocilslm2ra( s u0texrif3tydlp  ai i;(0srxrxrpoudaptn fcta() Draxm ou1apx  f3ils m2ulnmont)teenxo3io1fm elieols t2trio iudlle lfvsas  Drrx ont4tpen icildfa umn pnu0alenifctatomDrlnvi t0t2xrxr nudamt mfeslsfs2ra(rp;t4aet ifeilsla2ulu s t4 etomrcia1op   uvi;t)srtoxo3ny1ol n icil(f 2truronu1opxo o3iyt a2el( p;t4 lxrxr oa1faDraueo;t)trtr(opou4ame  fet s  rumum no4olxo fcils m2rm(mpnt0artoxociadoptranvolt0s2urio oy4ll   netls) 2rm(mpot1alxnmfcildfmDuanmon(4texrmo ootlmDeai s t) rtr(m oydole mivtlt) Dtrx  ot4oeeoif3ilt a2um(mo t4 eerxo iadlpD  nes;()trto(o oy1om  livtatfsrrm(r oo0apxo oeild a2ea(vo;u) eeomocoy1fatr neil( trum(m3ou4omt lictls)srta(rooo1ope  ociydlaDrmn s t) exrmr3tytoatraneils  eto(o3nudop e ivsat) 2tm(r ot0alxo iciys a ra(vs;u0teerxr3ia1fptr nei s0s2um(rpoo4amtnmfcils)aDtr(  oo0tetniieiys sDumnvs t)treoxo to1lmt li s t0 2toim oo1ope lics t  2umxmo;u4alxn ociyd sDrmnmo t0tetoio iodfptrliesl(0 2urirpnudop nlfvs sfsruru  ot1aexn ociatfa2uau s t) rtnir iy1latrlneol() rxrxrpou1alen fciasf rur(mp;t1opeo f3iydfm2ua(von()tlenxo3iy1lmD luvil()trxo(mpiydlpen fetls) rraurp;u0teenmoeiltfs2rlump t)alerxo ootlmtr ueo;s s2xo(r3iy1ap emivi () 2trumo;t0altomociytfm rl( p (0teeomfcoa1lmDe neslt)srtmxr io1olen nviatfsDtrxmonu0aex mi3iasls2ua( s () exrxf tydoaDelneols sexr(mpnu4ale miesasfarurxr nt0oexniietyslm2rmnmo u)aeerif iy1lptraieolt trumxopiu1ame lietasf Drmur ot0tle mictls sDul( s ()trtnxo3oa1opt  ivslt0srtr(o3iydope  nctltfs2tmu o;t0alt iieiat s2rm(vo () reoif oytlmD aiei t0truoxm no4om emnet tfs2tru pot4opxnio3iatfm2em(ms u)texnir iytop raneols) etrxmpno4lp  liet t)s2uru oot4opx mo3iys aDrmnvp (0tltoxr3ootlaD  nvil(0setoxo3nu4ame lncslt aDra(rp;o1optoif3iyd sDemnmsn(4aleomr ta1fatraivsls  rxo(rpoy4omtemicsltf 2raumo;o4texo i3iad a2emn s;t4trenioctadfmtean ilt s2toxmpoudaltn ieia( a2rmuro;u0ale  f3ild s2umumo t)aeermfcoy1opDr u sls s2um(opnu1aptnlnvsls s2tax pou0tetnifciltlm umn p;t) rtrmf iytom r ieo s)t2to(m no1alenlfvsatfaDrm(mono4opxomociytfm ea( p;t) ltrmfcto1fmtelivo t0teumir3ou4lmte fctasf Durxr ;t4tpto oetadlm2ea(vp;t)tlenir oytopDeaieo (0 eumxo nudope mietls)aDtmu oou1tlxoio3tld aDumn on()aexnxrcio1omDrlivi;t)srxoio oydlmtemfvi s)srtau  ;u0alen i3ild m eluvp ()arxomf3to1lp rlnvo ()sexrxm iy1lle mfesa()sDurxm ;o1opxomoeilsfm uln p u4 rermr iatfmDelueo;s0teur(m no1ope mfetl(f 2rm(m nu1oex  oetasfs2em(vpnu4tetrxfciytfat lu i;t)t2xm(m3oo1alen ivsa() 2umxr no0apt io3tysfa2rl(mont)arxnxr3oodomDe neils t2toxr oo1aptnlfeiasf 2umxmp;t0oeenmf3tls m2uanmp t0 etrxr3tydomteaneil( seurirpoodalt miviltfsDua( ont4olt  i3iltlm2umumpnu4alerirctodla e i i s)sexmiopoo4ol   ivs ()sDtrxr ot4aetn ietls sDrm( p t) ltrir iatom   nvs () 2xo(rpiydam nlivsls)s2rmu  nu1altn icildla ul( o;(0texnmr io1fm rlueolt trtoirpoodolee ici s)a2tm(  ;u4oee micils a um( pnu4arxrio oadopte uvo s)t2ur(opnu1aptn neil()a2rmxrp;o0tpt  fctlslsDuln p t0alerxf oa1oaDr n i;t0 eur(o3iy1omt  fviasfaDrm(m nu0oltomo3ilslm2rluvont) renxo3to1op r u o t0texmir3oudol e fetas  rtrx ont0tptnmoeiadls2rmumo t)trtnmfcoy1oa elueo t)tetriopny4omt lnvsas a2tau ont0aeen o3iydfa2eau p t4aeenif3oodlmD lnesl(0tetoxo nodlpe mfeils) Dtrump;o1tet  f3tatfaDulnmpnt)aleoxrctodfaD  ieol(  rxrirpio1lltelict t)a2urumpoo4tle if3ild aDem(vsnt)teenmo iodomtrlivil(  2uoio oy1lptn nei (farrax pnu0tetomo3iyslm2ua(monu0aetoxf3oadfatrln s t)t2xrimpoydll   fei sf rtmumpnu1oee  ictlt m2emu s;u)arxrxr3ty1lmD lnei s teuoir3no1amenliei s) rrrx ooo4texnioetld m ran o;(0treoif3totom eanvilt tetr(rpny4lme liviasf rurx  nt0apxo ietadlsDuan p;u0 etrmr iy1faDe i s s  2tmxopnudapeelfcsa( a2trxmo;o4altomieiydfa emuvpnu)alxnmrciotlptraneil()texoxr io4amenlneils)aDrrxrpnt4optn ietasfa ranvp t4tltrxr3iadlpDelnvsls0srxrxm ou4lpen ivtl(  rurxmpnt4apx mictasfm2umnmsnu)tltnmo oa1lpteaieo s) 2xmimpoy1altnmfvsatfsDtrx ooo1aexnioeiytfsDemnvsnt0tlxrxf iy1oaDeai i t)srtrio3ny4amt  nes (farrr( ooo1oexoiociasfaDrln p;u0aeenif3to1la eaieolt s2tm(o io1lp   iesl() 2ta(r nu4texn o3ias s2rm( snu4tltrxo iadoa e ivs;s0 eur(m3nu4om emfei s artrxmpnt0alen ictltla2rlnmp t4tlxoio oodlmDe u slt0s2urxo nudlmte fes t)artax ont0ale iieild a2ua(vp u0 lxrir3todfm raueo ()t2umxrpoo4ol   ncs s)srur( oot0aleomfctat a rm( s ()tlxrxf3iy1faD livs;t0t2xrxo3iy4ll eliei ( srrrurooo1opxo oeiaslm2el(ms (0alxomrcoy1oaD  nvs;t  exoxr3ou4ll  lfesat) 2trxm nt4ole if3iytls2ra(vs;t)altoio tatfa e nvi s  2tmim3no1oleelneils  2tax  ;t4apt iieils s2uanvon(4 exrifctotfpt  ivs t srxrxm nu1al nlivsat s2urxr ;o1altnio3tadfm2rm(msnu) reoifctodlmtrlneo;t) 2xm(mpoo4lpte nvsat  Duaxmpoo1oex ifeiytfs2ranvp;(0 ltomf totoa rlneols srtoim nu4ol   nvia( artr(r nt0tptn oetys a2uln onu0teerio ty1op elu olt0t2uo(m3oo4amtnlnctls)aDtax o;t1alt iictydlm rmump ()arxrxfctotlate n o;t0 etmxr3oy1om nmics ( srumxr ;t1texn o3iltlmDel( snt4texrirciadomtrlieilt0t2tm(r3oydalte feil()sDtrxr ot4oetomi3iysfs2rmnvs t4 exrxf3ia1fa r nvi t) 2tm(mpou1oltemici sfarrrxro;o4oeeoio3ilt mDra(msn(4tleoxf iytopte ueolt0 2tm(mpiu4al n ictas)artaxmooo0tle  f3tldlm ranvo t) etnmr iytfpDrauvo (0 2uoxo iydlptemictlt artaxroou0aleo fetatfm2el( p;t0 ltnmrcoydlpDe ieols  2umir3oodal  mivsa() Dur( ont4texoio3tasfs2rmuvp u0arxrir3oa1faD lnvsls0t2uoim nu1ap  lfvia( aruaxr no0optnmoeilsls2rl( p t)tetrmfctadfmtr n ilt  2tr(mpnu1omen ieta()srrrump;t0tptn i3tydfm2elump;u4treoio3ootlmDeau o t0t2uoxo nydlmtemncilt sDurxmpot4aetniictasfs2rau on() rxnmf3tydopDe n s;( trxr(mpny4aptnmfviatfsDrmur nu4tleomo3tadfs2uanvo;u4 exoxoctotfpDr uesls) etmxo io1lpeemietlsf ruaum oo1tetnmfciatfa2um(vs u0arxnxfcoy1fa elneil(0 etrio nu4ameemivt () Dra(rpnt4tpe mfeiysfa2emnmp u) eeoxociodlmtran s;(0seuo(m3oo4ape mnctat  2raxrooo1opxnioctas s rmnvo t0arxnifctotfmteln o;s0 2umirpnudaptn nvsl()sDta(rpnu0tlenioctatfs rl( p u) rtrmo iytfpDr nes;(0srtr(rpnydomee ncs ()sDtmumpnt0opx iociad sDea(vo u)alerxf iydlat  ueol(0seumio iy1ole lictl(fartrxm ou0aetoii3iatls rl(vpnt0trxrmoctodlaD aneol()s2to(opiudapen fesat) rraump;u1apen ociaslm2ulnmpnt0aleoircia1fatraueo (  rxr(opny1lleelivia(farta(moot1tltn oetaslaDemu s;t) ltnmo3ta1opDr nes s0 rtoiopoydlltemfvsls)aDra( pnu4tetn fctad m2ua(vp;t0trenxf oatfm rlies s teumxo3oydlptnmnci (fsruru p;o0tlxo ociasla rm(vo;() lxoir3oydfa ean o;( t2uriopiodape lfci (f 2rmxmpnu1teenmieiadla2rlumo u4 ltomf todlmD  neo;t trto(o oy1am emfet () Dur(mpoo1oexnmfeias s uanmo t) lxnxociodfpteanes;t)truoxm3nu1amtnlncsa()sDrmurpnu4alxnmfetld mDum(vsnt)aleoxo3todfmt livo;( s2xoxo ou4alen ics t s2ur( o;t4tetn f3ilsfaDeaumo u)texrxf3oatoaD aivo t0texoim ny1omt lfviat)srtrxmpoo4opeomo3tas a uaumpn(4tetoxf3ty1lmD au ol(  exmxr3iy1olte netat) rum(mo;o0texo f3tldls eanvp u0arenxociytoat lneil() 2xo(mpny4olenliei sfarrmurp;o4oee  ieiad m rmnmp;()arxoxo tatoat anvo (0 exr(opny4altemnvsatf Dra(m ;t1oleomietlsla2ulumpn(0alxomfcoatlm rai i t) rxrxo3nodam   ictlt s2rrur nt0oetn oeiysls emn o;()tetnmf3ootoatrlueilt  2xoxo3ny4lme mieslt  rtmuronu0tltomoeiyt m2umuvpnu)teermr iatfm r ues t0t2tr(opou4olenmietat aDuru ont4oee  ictydfaDel(mo t0arerxoctytoa rlnvs (  rur(m3io4olt lnctat)sDtm(mpno4teto f3iadfaDranvp;u)aeenxf oo1fp   uei;t seuriopno1oltnlivs t  rur(  nu4oeto ociyt a2um(ms u)alxnmo oatlatraneo t0srtoiopiodameemfet t arururo;o1aet  fcias sDrm( p t4treomociytfaDr u olt)t2umio oo1lmee ivsa( artmx ont0tltn ieiltlmDrlnmp u0 exrircootopDelnei;(0srum(o iu4olenlfetl( sDurxmonu4tpe io3iyd sDumu s u)arxomrciotlpDrli o;s0 rtoxr nudlmtemicsltfa2ta(r ;o1tlxomiciytlmDulump;u0trtomo oa1om   n o;(0 2uo(r nudlmt mnesa( a2umuront4tlxomo3iat m2ea(vsnu4alxrmf3oodoaDeln olt0 rtm(m3iu1lmte nesas  2rmx  ;o4ale iociytfmDuan o;t0altnif3tatlm rluvs;t0tetrxmpoy4lle  ncsa()s2umxm ;t4opt ifeiasfs2uauvo () ltrmf3oatopDeli i (  etmir3iu1lmenlnctls arrrurooo4tpeomfciatlsDeln p;t)texnmociadomteai i t0 rxoim iy1opeeliesasf rrm(mo;u4apx mfciltls ranvo u) lxrmo3iotfm rlivs;(0 ruoio ou1al   fci ( srra(ro;u1aexn iciyd sDuanvs;t)aleoxr ta1omteau i t)t2xrxrpoy1ol  mfesas) Dumxr ou0tpen octldfm ea(vs ()tetnxrciadomDr i olt0seum(r3iydal   iet sfarraxmonu0oetoifctadfa2eluvp u0arxnircootom  aiei (0setrir3oo1ll n ivs tf ruaxmp;o0optniiciyslaDulumo u0trtnxr oo1lmDean i ()s2tm(o iu4alenlivias a2tm( poo0tlenii3iatfm2rmumo (4tlxrmfctytfmD  ivs;s setm(m ou4amtelncs t s2uru pno0apxo i3ild s ean pnt0tetrmrcoytfa e u s t  rto(opoodaptnmivs ()a2rrurono4opxnmiciltlm2umuvo t0 leomr3oy1fatr uvolt0s2xoim3iy4omenlfcs tfsruaumpnu4ape mietltlsDua( o;u0alermr3ia1opt an olt trtr(r ou4ll nlnei s)sDtmum nt1tleomieiad m2em(von(0aeeomf3todop rluvs;s  2uoxrpou1olenlneil(  ruau  ;t0alxomo3tlsfs rlu ont0tetnxr oodoatrlnvo (  rumirpiudlltn icsls)aDtm(  nt4apt  f3ildlmDeln o u4 ltoxr3iydfmt lnes ( setrxr3no4amenlnvtat  2rr(mpnu1aee moeiydls ulnvp;() lxrmo oydopDranvi;t) eto(o nodam e ietat a2raxr ;t4oetnifctyt a uanmp t4aexoir ia1lm   neslt) 2trir3oy4lptnmfei s s2rau o;o0alx mf3ilsfsDrmumo (4tetnxf3oa1fptelueilt)teurirpno4ape mfcsasfsrrm(mono1opx  oetysla rm( o;t4tlxniociydla e neils t2xmxr no4ale lnesat) Dururp;t1oetoiieiyd sDrl( snu)trtnifcoy1om   i s s  2um(mpno1ame lnvi t)aDtax ooo0oet mietas mDrluvo u0 lxoxf3totla r nes;t s2ur(o nudolte ivtatfa2rru ooo0aptnmf3iyd sDeanmp;(0trtrxo3tytlmDr n olt0srxmio iodlp emneslsf rrrxm ou1tpxniictasla umumpn()tlxnioctatoat an s s  2to(mpnydapt  nctls) rrax poo0texo ociydlmDemums;t)alxriocoytfmteauvi;( setr(o ny4lp  mncil(f 2rr(m nu0aeeoifctatls2umumpn() rxnio ta1fat  u i;t0srtmim3ou4lm  licsls) 2rm( pou4altn ietldls2rl( p;t0areomo3tatoat  n o;t s2urxr3iy1amtnmivi () rtmxr ot4oetniociltfm rluvs () rxnmo oadfpt lnvols t2xrxr iudapt mictl(faDur( ont0tetomo3iyt s ranvsnt) reomo tydlm e n ol()srxmim nu4apenmnetl()srtrxr ;u4opeo ociltfsDean p u4alxnif totfp rlu s;()setmimpoodlleemivtas s2tr( o;o4oexoii3iaslsDean s;u)tlermf tydomD lueo s) 2uriopnudol n fetls  rrrx pou1aeeoiiciadfmDemums;(0artoxfciytoaDr ueils) exoxr3iodomenmici s a2rm(mpno1aetoioeilt mDra(vpn()trtrmo3oatfpD  uvilt)seuriopnudll  mnct t srra( p;t4alxomictat a2ranvpnt0 exnxo3tadlmteaivils)s2tmio oy1omtnlieias  2ua(mpnt1aetoiociyslm2emuvsn(4aetoifcty1oaDelueslt  2xm(o nudolt lncslt artmum nu4opt iieiydlm eluvs (0aeenir3oy1fatrau o (0trxmio no4olt  ict ( s2uaum ou4oleomicias aDelnmo (0 lerio3iodfa eln s t t2um(m iydllte icsls srurxmont0opxnif3iydfs ranmo;t0aexnxfcto1lp eluei ( setm(opiudapee fct ()a2uaxm ;o1aptnmi3iydfs2ulump t)aetrxo iodlmtelueol(  rtmxo iu4lpeelfctls)aDtrx pnu0texnifcilsla ra( o t0aleoxo3totlaDr n i t trurimpiodam emivt s aDrm(roou0oet io3iad a2rmn o;t)aexomr totopte nes;( tetmim3no4ll elnctl(f rtax pnu0opeoifetat s elnmp t4 rtnif iodop eli o s)trxrimpiudlme lncs ( aDtrxm nt0apx mfetysfm2rmn o (0 lermo3oy1lp  lneil( sexm(m3no4lpenlivi (faDtm(r nt0aeenmoeild aDra( pnt4teerxr3oo1fmtelues;s s2xrim3nydopenlnciat)artrxmp;t0tpeo ieiad s ra( s u4aeeoif oa1la e i o;t  etm(rpou4lm nlncsls a2rrx poo1texn i3ilt mDrmuvsnt4aexrxociotoa   ies;t0seto(mpno4ope  ivi tfartr(ro;t1tptnmiciydfm ranmo (0 leomoctotfpDelies (0 2xr(o3oo4lleelfvi (  Duru pot1tpe ii3tltla2elnmp;t0altrxoctotfat  ivo;s)texm(opiy4lle mnciasfarua( pou4tle moctat m2rau o;t)trxnmociydlpt  i i;(  2ur(opiodlme  ics ( arurumont0ole ifeiasfs2rlump u0altnmo iy1oaDrliei t sruoxmpnydlpee ncslt)aDuaurpot0tltn i3ils s2em( snu4arenir3oy1fp eln s;t)tetr(o ny4ol n ieilsfs2ra(rp;t1aexnmo3iatlmDulnvo;t4aexomo3ootfp elu s t  2tr(r no4omtemfei s)a2rm( ono1alenii3iytlaDum(vs ()aexnirciytlp r neils0 2uo(m oo1om   net s  2tmx poo4tptomfciydlmDea(ms;u0tlxnxr tadla  lues t t2uo(r3io4ap emfesat  rta(mpno1oexniociytfa2um(ms;t0aeermo3iatomtean o;() rxmio io1op  lfci s) 2uaurp;u1apxn fcild aDrln o u4alxrir3tatop  an i;(0 2ur(mpoodom   ieslt) 2ra(mpoo4apxnmietatfa eauvs () rxoif tytfmDrai o s  exo(mpiy4amt lfvias)arrmu  nu1oeto ieiydla2umn s t)trtrxr3todlmDrauvol( t2xm(o oo1am nlnvt s s2urxmo;t1oeeoifeildlaDum(vo;t) reoir iotfm r ueil()trtm(r nu1lmt micslt)a2umumpot1tetomo3tadlmDrmuvonu)aexomr3oa1lm rluvo;(  rxoir oudaltnlnvilt) rrmxmp;t4oeenii3iyt m umu o t0 lxoxfcia1oaDeluei;s0setoxm3iudllen ieil(  Dumx pno4apt miciltfs el(mon(4tlxoio io1fa  ln il() euo(o3ny1lp emietat)srtr(m oo4aeeo octadls2uanvonu)areoifciydfat li i;t) rtm(o3nu1lmen ict s a2taxr ou1opeomi3iatlmDrluvsnu4 etoioctotoa eaivsls0 exrxm3io1alt miesls)s2trur nu4olenmfeiydfs rau sn() ltoif iodlptelneo s0s2tmxmpiy4lmeelicilsf 2raxmoou1opx ioctyt s ea(monu) reoif oatfat lieslt)s2uo(opou1llen fvsl()s2ururo;o4tptoifeilt m2ul(ms;(4artnxf oadlm ean o;t sruoim3nydopenlnctas s2ua(mpnu1olen i3ilsfaDrln sn(0tleoifcto1lp rlnvs;(  2xrxm no4amee fvsat)srua(rono4ope ifetadfm ranms;t0texomr3to1laDrlnvsls)trtm(r3ou4optemfvias s2taxmoou4tlxnifciytfm2uauvo u4treoxo todop  auesls  2umio oy1lle  nvi ( srurx pot1tleomo3ilt sDra( o;t) exnxr ta1lpteauvi;s)sexoxmpio1optn fcslsfaDumxrpot0oexnif3ildlaDemumsn() etoxf3totlmtr i s;() etriopiy1ap n ivta()a2rr(rp;t0optnmfcild s rm(mon()areoxr3ia1fpt luvo;s0 eto(rpiudale micias) 2ta(r nu4oltomi3iydlm rln onu4 lxnmr ootlmtrli slt sexmio iy1llte netat)a2umxroot4aptomfctydfs ul(mo (4 rermr3iy1faDe i sls t2to(m iodaptn fvt (f Drm( poo1tpeo ocilsls2ranmpnu4texoifcty1faDeaiei s)t2xoirpiydolt mfvsat)sDtr(m no4apxnio3iatla ua( sn() lxoxo3iytfpDrln ils0 2toxm oy4lp n fei tfsrtmurpnu1tee iociasfs2umnvp ()altnmo oytlmtraivs;s)s2toxr nodlm elncsltf Drmumo;t1opto feiydfa ulnvp t)artnmf3to1fa  lieilt setmiopny1al elict (f rta(  ou0apenmi3tlsfs2em(monu0alxoif ta1op rli i;t) 2toio oo4alenmivi s a2raur ot4alxoifctysfaDem(msnu) eeoxfcoa1fat  ivslt trtrxr3io1omenlfci ( s2ur(m no0tltnmo3tldlm rluvs (4tetoxf3iydoa eai ols trxm(r ny4olte fvt t  rumur ;t4tlto octytfs rmuvon()aexnircty1fpD  ivi t)srtoxm3oo4omtemnctas)aDtmumoou0tpxnifctatfm2rlu o;u)alxrmr ta1laD  neol( t2trxm3oydolte nvt (  Drmxr nu4aeen oetysfaDel( o;u0teeoxfcoatlaDr i s;s0t2to(m nudll  mfei s s2umurpnt0tetomfcild m2eln p;u4teenmfctytfpte u s t t2uoio3io4ope  fvt tfs2tax  ot0tee mictas s eaumsnu4 lenxocoydoateln i;( sexrir iudol  lfet ( s2rrxmpou4tpt mf3tys s2uluvp;() leoircoodlp  an ol( t2xoxm3ny4olt mnet tfartr( p;o0openiiciltlsDuan ont4 rerif oatlate i s s)setm(mpou1omenlnvt (f 2rrum ou1optoioetltlm2rlumsnu) ltoxo3to1omte u ilt0 2uoxr oy1al e net ()aDur(  ;o1aetomi3ilt aDrm(mont)trtomrcoytlptean ols s2xrirpou4oltelnei sfs2uaxro;t1opeoifetadfa2eauvs u0teerxo ia1laD lu o ()setmio3iudome lfetas)s2tr(r oo0aeenif3tltlmDua(vsnt)tetrio3tytfmte i o s s2xrim3iy4opte nviat  2trum ou4tetn octltlmDuanvont4 ltoxociatlptelnes;s0seuo(o3nu4alt lnctlt  Dtaxrp;o4optoii3iysls2rmumo u0artrxo3to1fmteauvi s)texo(m iydopenmfctlt s2trumont0tleomocilsfs rm( s (4 ltomfcoy1oaD  i s () exmxm iy4lmenmnvi t  Dur(ro;u1ope moetldfm2ranms;u) ltoif oytfm   i o t)seur(m iu4om elivsls) Drrxmp;u4aetn oetlsfa umump;(0 etrir oydfp e neslt)trxo(r3iy4opte icia(f Duaxmont4tpxn iciyd a ran s;(0tltnmr3totlmD aies ()t2xrxm3no4ap elfvsat  ruaxrp;u4olto o3ilt a emuvo;(4 rtnif iytoptrluvs;t0texmxrpny4ol  mfeta( srumxr ot4tlxn o3tyt mDuln p t)trxnxfcto1oateanvo () 2to(rpiodlmtn iei ( a2urxmpno0oet moetat s2eauvpnu0aexrxr3oodfmteauvilt0setmxr3nudal   ictl( s2ua(rpot0oet mo3tad a2eluvsn()aeenxf3oy1lpD li ol( s2tmxm3io4ame mies t srtax pnu1oltoiieild m2em(ms u4texnmo3ty1fp  ai i;s) euo(opiodaltn ivil( arrm(r ;t0tpenmietys sDuluvs;u)tetoxocoo1opDranvo t0tetrio3nodlm nlivi sfsrrax o;o1tlt mfciytla2ul(von()arermf3ia1lpDr i sl(  rtm(rpnudale mneslt  rtrxront0tptoifeiadfa umums t4aleomr tatom   ues s0s2urxrpnudal nlnctl( artmxm nu1aleomi3ild a2rauvp;() renmr oodoa rluvils)trtoiopiy4opte ieslsfarrr(m oo0aet moctys sDrau sn(4aeeomo3oadfp   ueo t seuoxm3ou4apeelivsat)aDtr(ro;u0tpxn ocias a umnvonu4alxoirctatlp  anvi;t0t2to(o oo4apee iesltfa2umx  ;u1olxn feiadfa2eln p ()texrmf iodlmDeln slt seuoim3iydop e fctl( s2urxmpnu0aeto iciyt aDrmumpn(4tlxnmf iytfmtrlu s;s) exoxr3iy1lptemfvias)srurx p;o4tee  fciysfaDeaumo;u)tetomfctytfmte ivols  rtmxr3iy4lltnlfvslt) rtrx  ;t4aet ii3ildlm2rluvp t) rtrio3tydlmte uvo t) etoir3nudamtnmnvsls)s2rmum no4tpenmfeiltfa eanvo (4aexnif iy1om rlu s s0teumxopnu4al elnvtl(f Duru  no1optomfciat s2ul( o (4artrir iytfmD aneo;()trtm(r3no4lmeelfct ( a2rmxmpnt1opt if3tldfsDumuvs;(4teeomf to1oa  auvs;t srtr(m3oo1om eliesl( a2urumpot4olxo ocildlm el( s (0texnmo iodlmDelnvol()t2urxo iy4lp  liet tfs2rmumo;o0opt moetatla rmnvo;(0teenxrcoytlateanvi;t0tetmxrpio1ap   nvi sf 2rmxrpou4tetoioeils aDea( o;t0tltomr3oy1lpt  nvs t0s2toim oo1lp  mncsas) 2ra(ront1tlxnmictldls elump t)tlxnxo tadopDr uvi;s srxo(o ou4lp   fetlt)arrm(mo;o4tetnmf3iydfaDumuvs t) exoif3tadlm  aivils  rtoir io1openlics t sDumxmpot0tpxnio3tyd m2rm(ms u4altnmf3iotoatr nvo ( texoim iy4omee nciat)aDta(mo;t0tlx mociys m2rmnvs;u) rerxfcty1oaDrai ils0 ruoir3ou1omenmivi s arrr(mpnu0tee  ietatlm ulumonu)aexrxf3tytfm  lieslt) exoxrpoy4lpte neils s2ra(r ;u4tetoii3iadlsDulu p;t0arerxo3ty1la  aneslt sruo(m3nu4oleelicilt)artmum ou4opt if3
\ No newline at end of file
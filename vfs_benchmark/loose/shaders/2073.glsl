@@ -0,0 +1 @@
+nei s0t2tr(opoudlmeelivt s s2tr(rooo4apeo i3iltfsDum(vo;t0aexrmr tadoaDr u olt0seto(o3iodame mivils  rtm(mp;u1optnioctasls2eluvp u)tetoxr3iotom   iei;() 2xmir3oy1opt mneta(f 2tm(r ;t0aet  icild m ulu s u)tlerif3tadfmt  neo;t teuo(o ou4ole mfvs t) Dtmump;u0opxnmfctadfaDua(vonu)aexrifctadlat an i;s)teuoirpio4alt mnes ()a2rr( oou0apx ioeiyd m2eln snt0 exomf ta1fmteauvs s0t2um(mpnodlp e fvsa( srurxmooo0apen feiatlm2rl(mp t4 rtoxr3ia1oaDr neo t srxoirpiu4ap  mivta(fa2tru o;o4tleo oeiyd m2emnmo;()alerir3ta1fpDe n ilt t2xo(mpny4lpen fet (fsrrmu o;o0alxn fcilslaDumnmsn(0tltoxr tatfaD  n i s0trtr(rpio1ol  mfctat)aDurx oot1tex  i3iatfs2rau o u0aetoio3oytfmtelnvs t0 2tmxm nodlmtn ics t s2tau oou1oet iictytfa2elumont4 exnxo tytop  anvol() rtmim3ny1omtnmivt ()sDurxm nt1oltomieias s2rln o u) rxnir3todoa r ies s0trto(rpou4al elnetas s2rmxroou0alto f3iys m2rl(mo t) rtnmf iotlatrai s s)s2ur(r no1aptelieia()sDtmumo;t0olxoif3tltla2emnvs;(4alenxf3oytlmDr uvol(  exmxr3iydllt  iciat a2urum ;u1teen ocilsla ean o;()tlenir3oo1laDrauvo;s s2xmir3oo1lpe  nvs sfsrumx o;u1oexo feiad s umuvs;t4 rxnxrciodfaDrluvs;t  2xoir oudol nlnetat  rrr( o;t0ape ii3iyd a2emnmo ()tlxnio tadfpDrlivo;s  2xm(r oo4oleemfcsat)artaxrpot1ale mf3ildlm2uln p (4 lxrir ia1oaDeau o;s)t2xrim nu4al   nctls sDraumo;t0tetn fcias a2rlnms;t4aetomrciadfm  aieils) 2urir3iydape mfvias  rta(moot4tlxn f3tadls2elnmpnt0aexomrciydfmDe uvi;t)s2urir nodom n nvtl()s2rrump;o1aptnmicias m2rlnmpnu0arxnxr3tytopD  u s s  rtrimpiydomee ncil( a2umx pnu4ole mf3ilt aDua(mo;() etnxfciytla e nvs s)s2tmxo iy4aptnmictatfsDtmu  no0tleoifeiysls2rmnms;u4 lxnmf3tytfp e nvs (0t2tm(r no4lle mivt s  rraumpou4optnmi3ias m rm(mo (0trtrir todom   ueo;t s2urimpiudame mfciltfa2rrum ;u1olt  ociatfaDemu pn()artnifciodoaDraues s sruo(mpno4lm  lfei t arurx pnu4tlto f3iydfa ulnmo;u0 lxoxr oatomtrluesl(0 rur(m3oo4ap e nei (  2raumoot4apen ocils a2ua( o;u0tetoxf oadfpt aueilt)s2ur(r3ny1llenmfci s) 2urumpno1olenmfctysfa2ra( on()aetoxf3iadlpDeln ilt srxrim oy4ol e nct t  2rmxroot0tpe mfciat m2ra(vont4tleoio3iodoaDeliei t0t2to(r3ny4llenmneiat)a2rmx o;o0openio3iydlmDem( pn(4texoxrcoadomDrlnes;t0sexr(r oo1lpte ivt sf 2tr( pno1oltnifciad sDul(vp u)treomfcoadop rli s;t)trto(r3ou1alee icilt) Dtaxmoot0tlx mi3tltfm umnvont4alxoifctotla  lues s) 2ur(m3iydamt lnvtlsfa2tmu  nt1tpxoioetys sDra(mo (0alenmr oadla   nei;s  eur(m3ny1om  lfvtls artmxrpnu4tltomfetld a2umuvon()altrxo3todfat an s;s)teuriopnu1ome lfvil( artmxro;t4apxomocildfa em(mpnu)tltnmo3to1lpte u i (0tetr(r3ou1ll   fvtasfa2tr(moou1tpt ii3iyslaDelu pnu0aeermfciodomD ln i;( t2xoiopou4llen fesa(faDrmu  ;o0aptomfetltlaDum(vs;u4altrxo3todfp   i i t setr(r no4om  lfct ( a2trxmp;u0aexnmicilt m rmu p t4alenxf3to1fm raneo s0s2trim oodol nlfvtltfartrxr ou1tle io3ildfmDea(vpn(4treomf iydoaDelu s;t0 2xmxm3no1lptelnvsatfarrrur nt4oetnifeiadfm ul(von()alxrxociydla rli sls  eurio oo1oltn net tfaDur(rp;t0oeto oeiydlmDelnmp u4 ltnxf ta1la eanvo;s setm(m3oydape lfcsltfaruru  no1tpenmfeiatfs um( p t)altrir to1fat  ues;(0texrir3io1lpt  icil( a2urx p;t0tpe  ietasfm2uanvp u4aeeoxfcoo1laD auvo t srtoir3nu1aptnmncias)aDtax oot4aptomiciysfs ulu ont0tetrxfciydla  lueo (0s2tmio3nodlmtelivtltfsDtm(mont0aexoiociltls ua(vonu0 exnmf3tatopDr ieolt)t2trxr3iu1lmtelictls srtaur ;o1oeeoiocias s2rlnvs;u4tlxnircoytlp   n ol()t2to(mpny4lp elfvs s arra(rono1ape iieiasls2em(vp u0 exoio3ootlmD  n il()t2toirpoy4ape  feias) rtr( p;u0tle mfetyt a ua( p;u)trtoirctatop rlnes;s0 etoirpnu1opt lieslt)sDtru  ;t1oexomoctasfmDumnmonu0alerxo oo1fmDrluvo t0t2xoio3iydolee fvia() Drrurp;t0tpx iocils sDemumo;()tleomr3ia1lmD  neo;t0trxoirpoo4lpe lfvtl( s2ra(r nu0ale  f3tat s2emuvpnt)trenifctadfmD lnei;( texrxm no4llen iesl(  2tmumont0texn fetytfs2em( s (4alxnxo3tydfptraneol(0srtm(o io1opt  feta(  rrr( p;u0opxo oeilsfa uauvonu)treoir iadomDe uvils0 rxoio nydole mneias)a2rm( pno1apt ii3tatfa2rmumpn()trtrmf3oodlpDelnvols)sexo(o ou1lmt  ictl(f Dta(  ;u1apt  feiys mDel( o;u4artrirctodfm  luvslt)s2tr(r nydlpenmfvtltfaDtaum ot1tpxnmieiysla um(vont)teeomo oytfp eaueilt0s2ur(m oy4omt  ivslsfsDrm(rooo4tlto iciydlsDea(vo (4 rtoxrcoydomD anvol()trxrxo nodopt mfctls sDtm(m ou4oet ioeilsfaDea( s;t) etrxo3iatoa   u o;s0seum(o ou4ll n fetas)arrmuroou1tle mocilt sDemuvpnu)arxnmr3oadoaD anvslt0t2xm(r iudlmt  netl( srrm(mo;o4oetnif3iyt mDra(mp;u4 rxnmr ia1fp elivi;t  etoiopoy4aptelfctls s2rrx pot1optn i3ild a rmnvs () eenircoatla ran o;t0sexoxopou1om  lnvilt  rta(m oo4texnii3tlt mDua(vs u0 eeoir oadla   u sls s2trxopno1am n fvi tfsrumxronu1alx ifciydlm umuvont0aetnxf3iydfptr neil()srxrxr3ny4om  mictlt a2rr(  ;o0oexo ocildlmDelnvsn()trenxrcta1opDeaneo (  exrirpnodalenmfciatfaruaumo;u1tltnif3ias m2eluvo;u)teermf3iydla  aivilt)setrio iodop nlneil(fs2rr(rp;t1aexo feiydfmDea(mp (0 ltoif3iy1om e ieol( teurxr3ou1amen feilt)aDua(  ot4tpeomieiasfa2um(vs;t)artnio3totlpte n ols0trtmir no4am n icil(faDrrxront4tltn ietatlaDeanmont0 etoxocoytlm elivsls)t2tr(mpoodlpe mieslt) 2raur oo4opt ii3tasfm ra(vs (4 lxomocio1opDeai i (0t2uo(opny4lmt  iciltfaDumu  ot1tlxnif3tadfaDean onu4tltrmr totlp  livo;()t2toio ou4ap nmict (fs2taur ou0altn oetldfmDeau ont0 rxoio3ootla e uvi t)tetrxopio4lmt mictat s2rmur ;t4aeeo fctld a rl( p;t0aetrmo oy1fa  livi t0 2toxopoy4ameelnet tf 2ururo;u0ape  fctldfs ean pnt0artnxf3ia1fateln ol()srur(o3oydalt  ictls)arua( ono0oltomo3tas m2ranvs;u)tetomf3oy1om   ivilt0 2xoxrpiodol emicsls) 2ur( pno1oeenmictasfa2ranmsnu0trtnircoadlpD  ieols  exmxo iu4al n ncsasf Drax ooo4apen ociysfa el( s () exnxf to1lm eaneilt  2urxm3nodop  mfcs sfsrrm( o;u4alt  i3ilsls2em( o;t4aetomo3tadopDeai o ( s2xoxo oo4apt  nvils) 2rr( pnu0texoiociad s2uau p u0 exrxo3oy1opDelivils) eumim iudapenlfvil() rum(  no1tlx  ieildfs rm( s;(0tlenmr iodfpteaies;s) exmxr iu1optemictl( arurxro;u1apenmo3tydfmDua( pnt)tlxomr iadfpDrai o;( s2to(o3iy1omtnlieils)arur(r ;u0aexo ieiyt s2emnvp t4alxrxf3todlmt  ieols) rxrir ny4om elfesatf rtaxrpot4ape  fctytfaDrmnvs;t0altnxr3oy1fmt auvolt) rur(mpoy4apt mfvi tfsrtrumpnt0oeeoiociat a uanmon() lerxf oadfa e i olt)srtrxr3nu4aleelnvi () rtaxm ;o0opeomf3tyd m emn pn() rtoifciadfpt an o;t t2um(r3iodapenlnctat arua(ro;t4opt  ociytfs ua(vpnu4trtnif3oo1lmteauesl( seto(m3ou4lp   fctas)aruau  oo4tptnmf3ildfsDuln pnt4 rxoxf tatlat li il()texoimpoy4lp nmieilt  Dtau  ;u0tleomieiltfs rmnvp t0tlermfciytomDrai ilt  2umim3nu4ap n nvi t) Dtaxr ;u0tltniieilsla2ran snt0alxnio3ta1fmD  uvs;(0teum(o oo1lmeeliet s)srrmx p;t0opxn ictadfs2rmnmo (0trxoxo3iadomteli olt texmir3ou1amt mnvs s  Dumxr ;o1olxomietlsls eau s t) etoxrcoydlpt  ieo ( tetm(opiydol  mneslsf Duax poo4tlxn f3iydfm2ran p;(4aeerirciotoa  auvi s  euo(m ou1amte ivs ()artmur nt0olenif3tlsfsDrmn snu)altnmrctotopt aivi;(0t2urimpno4opeeliciasfa2tax pot0tlt mociatla rm(vp;u0aeeriocootfp r i s;t)trxoxo3nudlme lictatf 2uaumooo4aet iieild sDrlumonu)tltoxo3oa1oaDrlnei;t  eurir3iydolenlfvsls  Dtmurpnu1texnifeiad a2rmums;t0aetnioctydop rlivslt s2uriopiu4llee icsl()arrm(mpnt0tpxomociyt mDem(mo;(4alenmo iydop elueols)s2tm(r3io1am nlnctlt)arraurp;t1altomi3tasls rl(vont) rtnio3tydlpD  i ols  rurxm3iudole mnvs (fsruru pnt1apx iiciyt s umnms u0alenmrcoy1omDr neo (0trxoiopnodlltn fcs ( sruaxro;u0alxnmf3iyslsDrl(vpnt) etomo iodoat lnvi;(0s2uoxopoo1ll nlnviltfa2tru  no4aetoif3ilslmDrmnvs (4alxoio oytla ean i t0trto(rpou4op emiciat s2ta(ro;u0aeto iciad a rluvont)arxomrciydlptelnei;(  exrir oo1al nmfet tf Durx oou0altn icilslmDrauvsn(0tleoif iy1lmD  uvol() rurio oy4amtn fci t)s2rr(mpou4oex  ociasfm em(vsnt4 exomo totfatraueo;(  2uo(r nu4ame micilt  2taxro;u0tpeomfeilsfm umnmpnu0teeomo3iadfat an s s0s2tmxo nu1olt micsa()a2uaxmp;o1tet mociydlaDra(vo;t)trxrxo3tatlaDrlnvi t)srxrxo oydom   neias s2taxrpot1tpt  fcilt m umu s;()tlxoif3iodfmDeanvslt)srxrim iodlltemfvsatfaDra( o;o1tpe  ieilsla2ean s (4 rtnmf3iadfa e nvo;( t2toxmpoodlm nlnesa() rurumono4teeomf3iadla2rln pnu) rxnmocio1fpDe ivols)srurir nu1ameelfcsas sDuaum no4aexomo3tadls eanvont0 reoiociotfpte i ol()sexmxopnudlle  ieia()sruax  nu1oeto i3tldls2rau o u0 rxoxrctodopDraueol(  2xrir ny4lmtnmieias arraum ot0aptnmfctadls2raums;t0 lxomf tatlmD ln i s  rxoxm3oudapenliviltfs2uru onu0apeoif3tas m2ranvo;u) rtnxfcoo1lp r u sl()teurirpiu4al emfctas)sDrmx ooo4aptn i3tydfm2umumonu) rxrir oytom  luvo;s trurirpny4am  lnci (  rtaur ;u1tlxnioetad m2rmnvpnt4tlxoio3iotlm e u ils) rurio io1ame mnesasfs2umxm ot1openiieiytlmDem(vo;u0 ltrmf3tydopDr ueo s  2uoxr iy4al nlfvia( artaxr nt0texo oetlt m emn s u)tlxnxrciotlaDranvils)tetrxm3ny4apt mfcsls)arrau pnt0tpxnmoeildlm em(vs t)aetnir3ta1omDe u i s0setrxm nu1llenmnvsa(f 2urump;u4open ociasfm2em(mp;(0tetnif3ootop e ivsls  2umxo iu4ope lfcil()s2ra(m no4tleoifciytls ea(mpnu) leoxr totlpDrlnes;s)trxo(mpnu1aptn fvilt)arrmur nu0tetn ictytlsDum( pnu0trtrmo iydlpDelivs s trur(opiydoptn ncsatf 2rmxrp;t4opxniocilt aDeanvpnt0 rermfcio1om rlu slt s2xo(o3oo4apt  nciasfaDra( oou4teenmf3iad aDelu o;() rtnif totopt au s;()t2xmio3io1altnlietat) Dtrx pno4opeoifetasfs2ea( o;u)alxrir oo1la e ivils trxr(mpoo4amenmfvi ()srtaurooo1optomf3tlt a2ul(vo t0 exrioctatlmDr ieo (0t2xmio3oy1alenmivsas) rta(rpnu0ope  fciltfm rmumpn(0tltoxocoa1lpt anvo s  etmimpoo1amtelfctat a2uaum nu4tlxo i3ils s2eauvpnt0 etnmf3oytomDr nvs;s0 rum(r3io4llenlivtlsfa2rax pno4tlx ii3iyt sDelu on(4arenmo3oy1oaDe ueslt srxmxo3oudolen ivtat) 2tm(rp;u1alenifciydfaDrl( snt0 eermocia1fmtelnei;t  rurimpoydolenmiei s a2umum ot1aleoifctls s2ulnvo u0aexoif oodoaD  n s s)srumxm no1apeelfvia(fsDtmxm nu0olxo o3ildla umu s;() etrxr3to1oatr uvslt t2tmir3no1ol emfvsa(  Dumxro;o0tpxniietadfaDulnvs t0tlxnir io1faDrlieolt0trumimpiodom   ncsasfa2ururpot0opxnmoctyslm2rlu ont)tlxnmf3iatfmD  u olt0 etoxo3iy4oltnmiei (fs2uaumoou1oex micilt sDumumo;u4tlxrmf io1fmte ieo;t) rtmiopou4amt mnvi (fa2tmxro;u1tltn oetydls ea(mpnt)altrif3tytopt anei;(0s2urim3oo4lmt  fvtlt)artmxrpnu4alto ieiltfa2ea(mpnt4aetnxf iy1oa r ivil()srxm(m io1lptemnvsls) Dta(m ou0tpxnmo3ilt mDel(ms;u)trerio iytfmD li s;t0 2urio nu4al elnviasfsrraumoot4tet ifetys a el(vp ()tltniociydoatrlneilt seuo(m ou4lmt  fes tf rrr(  ;o1aexn o3tyt aDran o (0teeoio3iatla raneil( srxo(o nudamenlivils)s2rrxmont0tpx mi3iltfs uau o t0artrmocoa1fatrlu i ( trxr(r iy4amen feil(f 2tm(r ou4altn fciasls2umuvp;()trxnxrciy1fmtr n i;s0texrxr3oy1lm e fesatfsDrm(ro;u1aetoifciatfa ea(mo;t0aleomfcootfmDe i s s)trurxo io4amtn fcil() rrmxrp;t1texn ietyd aDemumo t0 renmr iotlmtrln ilt0sruo(opnydlltn ici t) 2tmurpou1opxnif3tytla umu p;t0tlxnmo oytlpDelnvol( s2xr(mpiodomtelivs sf Dtrx pnt4texo o3tldfs rmnms;u4tetnio oodfm  aueols) rurxr no1ol  mfvta(  rtm( poo4alen oetasfmDelu p t0tlerxr ia1laD anvil( t2trio3io4opee ivias  2ra(roou4apenmictadfs2rmump;u)tltrifciydlmDrlu s ()trur(opno1opee fctatf rrmur ou1texn f3tltla2ul( ont4trerxocoa1lmtelivo;s) 2xo(mpnodom nlnetls arrax o;t1ope iiciasfa2ea(ms;u0trxrxocoa1oatean s;t)s2xm(o ny1oleelici (f Dur( pno1tpenmoetytfmDranmp;u4tetoif3oadoat  n i t0trto(rpnydlp n fetatf 2rr(r nt4tlxnifciyd s rmn o;t)tltnmo ta1oa e nei t trxoiopiudlp nmivtltfsrurxmp;t0olx  ociys m umn pnu4aeeomo tydoateli s s)trxo(r3iy4am   fcslt) rtr(m ;t0tpxnio3ildfa ulnvsn(4 eenxo iotoa eaueolt)trumir3iydomtemnetlt aDtaxr ;t4oet ioeiat m2rlnmsn(0 lxrmocoodlm   n ilt  exr(r3nu4aptemfcs tfa2umxrp;t0tetnmf3iad a2rmuvs t)alerxo3ootoptelueolt  eto(m iodlpt lnes s sDum(r ;u1aetnioetlsfa ea(vsnu0trerxf3oadomteaueo t) 2tmxm3io1alen fvils)sDrrxmpno0tltomociydls ra(ms;t)aexnmrcio1lmt livilt)s2uoxmpnudam n ici t)srrrxronu4texomoeiyd aDemuvsn(4 rtnmfctatlmt auvi s  2xoxr nu4lmtelfvi ()srraumpoo4aex  feiysfaDrl( p;t) rtrxocoo1lateauvi s0 rum(rpio1oltn netas) rua(m ;o4apxnmf3ilt a uan snt4trtrmfctydfmteli o t0s2xo(o oo1am   fei tfsDraur oo1aptnmieiadlm2ulnvp;t4tlenxr3todfpDeluvo t0t2xr(mpoy4oleelivsatfa2uaum ot1tlenmoetas a2ul( pn(0aexrxrciadlpt  nei;() 2xoxo3iy4lptn ici s)sDurxmo;o0alx ifciys s rln s;t4tlxomocia1fat  nvols0s2xrio3oudap e nesatfaDtrumpot0apt iicils sDeln o t4tlxrircoytlaDe u ils0trto(mpny1olen fetatf 2tmurpot1tpen fciadfa ulu sn(4 etnxocoodoaDe uei;t s2xr(r iy4alen fcslt) ruaxrooo1alx  ocild s elnvs;(0aleomo iatomt aueslt0srxm(mpnu1ope  nct (faDrr(  ot1oex iicild mDrluvs;(4 exrif iatlmt lies;( srurir3ny1lmenmfetlt)s2tr(rpnt4alt iieilsfmDemnvpnu) lxnxrciytfa e n i;s  2tmir3io1oltnlfct tfartmumonu4ope mi3iyd a emuvo (4 eeomociotla e uei;t0trxo(o iy1openmivsa(f 2umx pno1olto i3tas mDemu snt4 rtrxo3iydlm   u slt  rxoxopoy4altn fei (fa2ra(m oo1tet iictys a2el(vo t) lxoxf3oytopt luei;t0setm(r oy1om emiet t) rtau poo4optoiictlt s2rm(msn(4tltnmo tadop  lu s;t)setmxopoy1lpenlnesa() 2uru  oo1aeenmiciad s rm(mo u) etnir3totfptrau i;t0 rtrirpoo1ol   ivtl()arur(  ot0tpxomf3iltlsDumnvo (0 rtoxr iydlpDe n ol() eurxm3no1amt lfcslt)aDuaum oo1teeniietlsfa2eanmo t4 lenif tydfp e i ils texmxm iu1lpt lfcsl( aDtmx oou1ape  f3iyd a2rl(vs;u) lxnirciadopte ieolt s2um(o oo1altnlnvs sfarumumono1tpe mfciyt aDel( p (4tetrmf3tytoa rlueol(0trxmxo3oodlme micils sDrmumono4tex ifeiydfmDul(ms;u)tetrmr ty1fp r nvils0tetoxr3no1ameemnes s srumxr nt0tee ii3tytls2elu o u4 ltnxocoydfaD  uvslt s2toxmpiydop  mics s a2ua(ront0tpxomfetadlm rlnvpnu0 etrmocoatfa elnvi;t  2xr(m io1llen ictas)s2rm(  ou1texnmociyt m2elnvp (0aexrircoatfpD ln slt0 exr(o3no1lpeelietlsfaDtrxro;u4tee ifciysfa2eanvo (4artnir iotlm   ivi t0trumxm io1amen ivt ( sDta(rpot0tle mfctaslmDeauvpn() exnmfciydfp e ieo;t setmirpoo1lltnmics (f 2urx oot1oetoifciyd mDemu o;t)tltnmf3oatop  aiei;s srxrxm3iodame lnei t s2uax onu0aetomoeiltls2umu pnu)teermociy1faDr nvils srumxr3iu1olt mnetls)sDuaur ;o4ale  ieils sDeaumpnt4artrxfcoa1oa elivslt) rum(mpiy1op elics ()artrxr no4alenifctas a rauvs u4 exnio oy1omD lu olt  euoiopoydlmt  icsat)arurx poo0optnifeiyslmDrm(vo t)artoxo3totom  lies ()s2um(opnydomtemies ()aDumumpno0apto i3tltlsDrln p ()trtnmr tadlp ran il( teto(m3nydom n ivt sfa2tmum no0tptniocilt a2ul(msn(0trenxf oo1fp raiesls)teuoxmpio4lm  lnes ()aDrmxmpnu0tee io3ilt s em( ont)areoxrciadlmte n ilt s2xrim iodopeemivi ()aDumum ot4tee ioetytfaDrlump () rtoir3ia1fmtelivs;()s2umxr3ny1olt  iei ( a2tm( o;u0aeenmfetlt mDrmnmo t) eeomrcia1la ranes s0 exm(m oy1lp e feiatfsDrrx p;o1tpt iieiadls uanms u4teenxo ta1fm e n ils)s2xr(o3iydamt  fes s)srraumpot1tlen oeiasls eaumsnu0aexnif tatomDr u i;s0trum(r iu1amenlnvias)sruau poo0altn feiys sDeluvs (4 lxnmo3todlateaivi s t2ur(r3ou4lmtelnesl() Dtaur ot4tpt  ictadlsDeaumo;()aetomfciotomtr ivils) 2to(o no1lmte nvia(  Dumxmo;u1tleomo3tld sDuluvs;u4aeenmf todfm r ivs s t2umir3oy4lltn fvtl(f 2rmu pnu1apx  ociasfsDuan s;u4 lerir3ia1omDraueolt seurio io1lme mfct (  2umx  ou4oexo i3iytfs rm( o;(4 reoxo tadfmt livs;t srtoxm3oo4amenlnei (fa2tr(r oo0olt mictysfm rln p t4 exnirctydfat  u i;s0 exr(m3ny1lm  lnct (fsrtrxr ;u0olt io3tytlsDul( o;u4artrxfcoodlmt au olt trxmxr3nudlmtn iesls)srtmump;u4olxo iciasfa rlnvont)areoxr3tatoa e ueilt tetrxopiu1ll  mici ()aDtrxm no4apxnmo3iasfm2rmuvp t0 lxoir3ia1omt aivo t0 rtrio ou1amtnmfvt tfs2rrxronu1apt mietlt aDea(ms t) etomocty1omDeau sl()setmio3nydlptnmneias  rtm(r ;o0texo oetadls2rm(vs;(4 ltomo tytfmtraues s)s2to(rpiy4lp nlnvia()sDtax  no4oetnmieiyd sDua( s;t4altrirciotfm raues;t  2toxo3no4am elict t)a2rm( pnu1tleomfciyslaDea(mp;u) lenxo3oy1opD  nvol() eur(opno1ll  lncslt)aDumxroou4texnmfcias mDumn o t)alerxr3iatfa rauvi s) eumio no1olt  fcils)a2uau oou4texoiieiytfs eanvo t0altnirctadlp rlivsl() etr(r3oydapt  nvi (  2ur(mp;t0oee ii3iadls uan s u4aexnxf3oodfa rlueolt) rto(rpiu4ll nlfei t aDtrur ;t0tpxomiciadfsDelu o t)teermrcoo1oatrai ols0 2xoxr3io1lm nlnci t) rrrxroot0oltoiiciysfa2em( o;(0aeeoio tytomD anvilt trxrxmpoo4lmteliet s)a2tmump;u0tpto ieild a2rau p (0artoir ta1fat aues (0sruo(rpiy1am e iet tf 2trxro;t0aet mo3ilsla eanms;u)artoif oadfateanvils)seuoio iudap  mfet sf rururp;u4ope  feiad a ulumsn(4areoir3oydfpD aues s0trxmir3oo1oltnlfeta( sDuaurpoo1aptoioeiydla2rmumo;u4 rtnmf ta1lat auvo;(0 ruoxr oodlpe  fet t a2umurpno0tlx ifcilslsDem(vsnt4altomo oydfaD aueol()seur(rpoo1op n fcta() 2tm(  nt1olt  ieildlmDua(ms ()aetoio3oo1la elivils0trxm(o iodomtnlnvt t  2ur(mpot0teeoio3iyt a2ea(ms (4arxrif3ta1op r uvs (0setrimpoy1lmt lneslt)srtrxmont4apenmoctas a emumo u) exoxf ta1fa rlneo t setr(o ou1apen fet sfsrurx oot0tle moetltfm2umu on()treomrciotlmt  i i t0 rto(mpou4ale lfci () 2rm(rp;u1ale ifetyt mDrauvo ()alenmfcoa1fat  u i s) rxmxr3io4olt  fcsa(f rrmur ot1tptnif3iadla rmnmo;(4artnmo3iadlmDrlues;(0sexoxo3oodop e nesa()aDrm(m ;o0aleo octlsfm uluvp (0aeenxfcoa1fp eau s s)t2toim3oudale mivta(faDtr(mpoo0aee  fetld a2rlu pnt0aetrmf oo1fpD ai o s) rtoxr oy1alee nes tfsrtmurpnu4tee  iciatls elnvs;t)trenif3oydlpt aueo;s)trtr(mpiu1ape mivi s)arrr(mp;t0aptnioeiltls2uan pnt0tleomr oydom eluesl(0t2xrxr oy4llen fcsa( a2tmx oot0open o3tldlm umuvs ()tleoio ty1oat  ivi ()t2umxopiu4ome  nci t  rtrx  ou0oleomo3iasfa ean pnt) ltrmf3tatlmtr ivol( srurxo3iydolt mnvia( sDtmxm oo0tle  feiys s rl(mp;u)tlenio iotfpDraies t  2tr(mpoy4aptnlnet s)a2umurpno1oee mfetydfm2rauvp u0arxoir3to1la eanvs s)t2ur(mpoy4lm  mieta( a2rm(m ou4opx mociasfaDrauvo t0tlenmfcoadlpt  ues;t0 rtmirpnu1alt mietls  2tr( onu4tetnmietys s rmumonu4 exrxo ootlmte ues t  rumio3io1olte ncil(f 2ua(rpou1tee ifetasls elnvp (0tleoir iytlmDran s;t  2xm(r3iydaltelfes sf ruax  nt0aptnmfciatla2eanmp;u)teenmf3iodfateau il( sexmir iu4lltn ncta()s2ua(m nt0tpeniieiyd s em(mp u4alxrmr tadom elnes s0 2xm(opiodome lnviat) rrm(ro;u1apt mi3tytls2emums () ltomocoodlaDelivs ()t2toxo3nu1ol emivtlsf Drrumpnt1teeo fetytls raump (4tetrio tatoateln ils  euoxo3nydape mfesas)arrmu o;o1opeo i3iys sDuaumonu4 renio oatoaDraues;s0t2xoio iodlltelici sfarrmxrp;o1altnmo3iyd aDrmuvo t) rtnxr3iodlpDr u slt  2xrim3oodapt mnvt t)artrx  ;t4olt ifeild a2el(vp;u0 reoio3iy1faDrauvi s0t2trxo3ou4op  mfci s)arumum nt0oet mocildlm2rmnms (4aetoiocoo1lp eluvi s)trum(mpno4lmenlicsas)s2rrxmooo0texnmfeiasfm2emnmsnt) exoxfciydlaDeanvs;s)trto(mpno1lme lfctls) Dtmu  no4apenmo3tytlaDuanms u) eenmr iatoaDeliei;t) rxmxopou1ale lnvtlt sDrm(mo;t0tltoifetltfsDrmuvo;t)trxrif oy1lmteln ilt)srtmio3oo4lpe  nvsat  rta(mo;u1oex mo3tldfa uluvs t4 rxomr3totfat lu olt t2to(o iy1amt  fvil()s2rm(rpot1texnmo3tas m ulu s (0tlxrio3iydoatelneils0trtmirpio4ale lfvia(fs2rru  ;u0optniociysfs rl(mon(0aeenxf3oodfaD an slt0 2toxo3ny4altelfetasf 2rrum ;t1oltoifcias aDea(mo;u)trtnxr3ootfmDrlu il(0 rxmxopoydamte fet s) Drrxm oo4aptomiciyt sDul( o (0arxriociotfa   iesl()t2ur(o oodlle lfvsa() 2rr( pno0tpxomfeils m2ranms;t4trtoif oytlm  ai olt0 2xr(rpoo4lpt livilt srra( pno4tlt ifetatlmDean snt4aeenmf3tydfaDr iei;( setrim3iy1am nmfet t arumxrpnu1tee io3iydfs2emnmo (0trtrxfcootlpt livs s0srum(o3oy4amtnmncil( arrax ooo4aetn oeils aDul(vs ()aeermfctydfmt anes ( texoxmpoodamee fvsas)sDum(mp;u0opeo oeiltfm2raums;u)arerxf3todomD  ivs ( s2tm(r oy4omt  iviatf rumumpno0tpeoiociasfs2ea(vs u4tltrxo iodlp rluei t0t2tm(r oo4omenmicsltfsruaxro;t4altnmoeils m umnvp;(4 eeoio3tytla rai o (0 2uoxm iu1lmte nvsl() 2rrxr no1tptomiciytfmDemu on() rxoifctotlm r ivi;t)s2tm(m io1ol   nesa(faDuaumpno0apt mi3iatla2el(von()tltnif tadom   n o;( truoim nudomeelieiatfsrtmxr oo1olen iciytfsDrmnmonu0 exoiocoytfmDr neol(0 etmxm io1am nmiesls sDtmxmp;t0ole mi3tadls ea(mo;t)texnxr3ta1lm rai s s  euo(mpiy1ame licias) 2urxm ;o1alx mieils a2rmums;(4artnif3oo1opt aiei;s)seurxopiydoltemfet t)sDrr(m nu4tet  i3tyd sDrm( p t)alerio3tydfp  an ils s2tmxopnodopt lieta(fs2uaxroou0alx  ictad sDulu o;t4 lermrcta1opDelneo;s srxoio nudlme lfct (fsDtrurpoo4alxoioeilt m2el(vp;u0texnmoctatfa eau sls)truoxmpio4am  mfci s s2rr(rpoo0tpenio3iadfs2rmumpn()trxnio3oydfmt lneo;s)truoxmpoy1lp  mnesa(  Dtru ont0tpxo o3tyd aDuanvo t) etomf3oatfp eln il(  rxmxo iydomtnmfci s) 2uau onu4tpxnmiciys s2eanms t4teerxociydfmDe uei;t)trtmxm oodameelnet (fsrrmx  ;t0teeomieild sDea(mpn(4 leoif3ia1fpD ai i;s)sexmir3iydol elnvtlsfs2rax  oo0olen f3iydfm rl(mp t)alxomo to1lm raivsl() 2xm(m nu4omt  neslt s2tr(m no1alx ifeiadla2ulnvs t0teerif iotfaDeanvi ( setm(rpoo4ol  lfetasfs2rr( ooo1oeeo f3tltlm uauvs;u)teerxr3tatlm  an s s) etoxr3iudap nlicias s2tru pno1apxoii3tysfaDrlnms;u4tetnxoctytlpD livo;t s2urxm3iu4op nlfeiat)s2ta(r ;t0texoiieiatlm ra( s;u0treoxo3oy1faD  nei;()t2uo(r io1amtn neta() Dua(r ;o1apeoioeias aDum( o u4tetnmo3oodlpt luvi ( srxo(m iy4ome lnesasf 2tr(roou4aeeoifetyt mDrl(vsnt)aeeomf ta1lmtrau i s0texoiopnu4lpe mnctas  ruaump;t4altomociltla2ea( o t0 rerio tatop  ln ol(  2uo(m oy1openmivsatfsDumxrpno1ope ioetysfa2emn ont4 ltnxo3ta1lmte uvs;s0setoiopou4amenmneiat sDtm(rpot0tlxnmfciadlsDel(mo ()arxrmf iydfaDr nes;s) 2xrxm3ou4ap nlnei s)srtruroot4olx ifctlsfsDumnms ()altnxf3iy1optr nes s seur(o iy1alt lnvi (f rrm(mo;u4apxnmiciytls rlumsn(0 lxrmociodfmt  ieo;t0teum(m oudlltemncil(fsDumu onu0tpt mieiasfaDuaump t0 rxnxf iy1fmt  uvs (  rurxrpio1apee fesa( a2rmxmoou4apt  ocild aDumnvpn(0 exnmr3tydlptean s;t) rtr(m oudalen ict t a2uaxm ou1oexo fetydfsDul(mo t4arenmr iatoptrlneilt0trtmxr3iu1lptnlnes s)sDtrxmpnt0apen fcilt sDrl(vo ()texoxo iytlpD  ivo;(0srtr(m iy4open iei s) rrmx p;o1teenmietltla2el( o t4 ltnir iodfp  aivo;(0seurxm iy4ole  fcs s aDuaxr ;u1teeniietatfm rl(vs;u)altoiocto1omtr nvil()setoir no1lptemfcsls arur(ro;u1oexnmociytfs2emumpnt)tlxrmf3oa1omD  iesl(0trxoimpiu4lp  mietls arum(r ;u1aet mo3tlslm rmumo;u4tltnir3oytoatr n o t  2xoxr3iy1oltn fvi ()srraumpno1tltnifeias s2rmums u0tltrxr3iotoa eau o;s s2xrxo iu4ll  mfcsas  Dtr(r ;u0texoioeiytfmDuan onu0tetrxo3to1lmDe uvo ( setm(rpou4om  mnvsasf rtmxmooo0alxn ietytfm2ranms t4tltoxf oo1fp eai i t)srurxo no1lmte fetas a2tmx pou1tex if3ildlaDul(vo;(0 lermo io1omteaivi ()t2umiopoy1lp e fvtat) 2umumo;o1aee  feils mDemump u0artrmfctytomt ai o;s)s2toio3iodop n nvsas srrax ont4aeto iciysla2emumo;t4aeerxf3tydomDeli i ( teuoimpiy4aptnmfcta(faDumxrono4olx iieilsla2ean p;t) ltrmf3todlaDr n sls0srtmxrpoy1opt  ncsa(faDta(rono0tpeomfetlsfsDeln sn() eerio tadlp  liei s) rurxo iy1apenlfesa()srraxmp;t4optoiocildlmDemnvs (0aexomoctatlpt aueol(0 rxr(r ny1lme lnvil(f rrrxm oo1optoifctat sDuln p;t0 lerifctytfaDraivs t teto(rpio1apeelfcsat)arrmx  nt0tetn octysfsDeau sn()alxomrctotfm rlu s;()t2xmio oudllenlnvi (farumx ono0texoif3iasls uan p;(0aexrxf3to1fpDr neil( sexrxo3no1om   fvtltfsDtm(r ;u0apt  o3tasfm2ean p (0arxnmrctatfm eau ol() 2um(r3io4lpenmnetlt sDumumpou1apt  fciyt m ua(vsnu)aexnmf ta1lpDelivi t s2tr(m3ny1op emfci s)arumumo;o0tlxo f3ilt aDrlu p;(0trxnmr3oadlatr uvo (0 2toio3iy4omtnmfet sfaDum(  nt4olx moetyt a2ulu snt4 etnxr iydlptelneo t0 rxrxm3oo1alee netls aDtmur ot1tpeo feiytlsDulnms;t0 rerif3iydlpt lueo;(0t2xmim3iy1lptnlnetat)srurxr ou4alxnmoeiysfs emu p;(4tlermocto1lat  u i t  2xrxo3nydaltnliciat  Drax  oo4apt mietad s ulumo t)altnxrciadfmt lnvs;t  eurxmpiydlpe lnvtl(fsrtaum no4alto fetad s ranvsn()texnxrcoo1lmDraueol()t2xmir3ny1ol eliesa() ruaxr nt1tex if3ild a2rl(mo;t4 exnmo3iytlptelnvil()s2uo(rpiodllte icsat)srrmum oo0olxoiietadlsDuanvo;(4altnif tydfmt anvi;t s2xmxopoo4ame  fvils  Draxrp;o4aetomictld aDeauvsn(0 leomf3totfptrlivsls0setmxr ny4lme  ncs ()s2umur nt1olx moeiadlmDrm(mp;() lxoxf3iydopD aiei;t0tetrir3iydll  lfcia( sDumum nt0oeeoifciatls2rluvs;t)aexoxo3ty1omteaieo t  rtrimpoo4om  lnet s)sDuau oou0ole mictasla ra(mont4teeomo3ta1lpteluvs t  etrxr3ou4lle lieslsfs2rax pou1tetoif3iasls ra(vsnu)tltomrcoytopt lu s t0tetmiopnu1al  miesat  Dtm(m oo0oleoifcild m ua( s;u)aeeoio3tytlmtrli s;s0tetoim3iydape lnvslt) rurxro;o0aexnioctas a rmumsn()tltomr3iatlaDe nvo;t) 2xrio oydopenmncsas aDumu o;u4aetomoctyt mDra( p (0arenxocty1op   ueolt  rtmiopou4optelictlt)srrm( p;o1optoiiciytfa2em(vp;(4artomo3iodopDrluvo;( tetrxrpno1lp e ieil()sDtm(  nt1oeenmfcilsfs eauvp t0trxnxf3ta1lpDean s;t  ruo(rpou1lptnmfctatfs2tm(  ;u4tlxomfeiytfaDrauvon()trxnmf3oa1fmDr u ils)teto(r oo4lp e ict tfarrmxrpnt1aetnii3tatlsDrlu o;u0trenxf tadla  anvi s)s2toiopoodalt mfetlt  2taumo;o1tpxn ieildlmDuanvo (0tlerir iatlm   i i s0 eumir ou1ll  licsas s2ta( pnu1apx  iciys m2rmuvp () leoir3tytfp eai slt0seurxmpou1amtemicta()a2ra(ro;u1olx mfciaslaDumumsnu0aexoir iatomD luvsl( seumir3nu1ll emivs s  Dtr(m nt0tlxnii3iadlaDemuvo;t0 reoioctytomte uvo;(  2xr(mpno1amtelnctlt s2rmxmpot0altoio3iyt aDua(mo t)tlenio3iadopDranvolt0t2xoxopnu4lp   fctat  rurxrpoo4alt  octyt mDemumsnu4 ltoiocty1opDr ues;t srtm(mpoydalen netlt  2urx p;t1openifctyt m2uauvp;() lxoxf ty1omD auei t  2umir oydomtemnvs sfa2umumoot1apto fetldfs ra(vs (0 lermo3oy1lmt  u o ( s2xmxo3nu1olt  iesl(  Dum(ro;t4ope mi3tasfa rl( sn(0 rxnif ta1faDelneo ()setoxo iodlltn fvt sfs2uaxm ot0tpeomoeildfa2umnmo t)tltnxfcoo1oa r uvi;s0s2xr(m3io4omt mncslt srrrxm ;o0aleo fciyd sDrm( ont)aeeoxfcoadlpt  i s (0srxoxrpnu4oltelicsa()srtaurp;t1aee mfciad s2ea(mon(0 lxnmr3oo1oaDe n i s0s2urxo oydlpeemfcia( artax  nt0aet mo3iytlmDum(msnt4 rxrmrcio1fpteau o;s0 ruoir3ou4llt  iesat  rtmurono4tlt  ociasfs ulnvpn(0aleomo3iotfpD ln o (0srtmirpou4omt  nvs ()aDumu ont1aexo fetysls2um(vp;()tlerif3tydop e uvo;s  rtoxrpnu4ll nmivsa() rumx o;o1opt moeils m2ranmont) rerirciy1omD aieo t0 rtm(r no4lm nmici ()a2raxmpoo1tltnmfctyd a uanmo;t0tlxrxr tytfp rauvo () etmirpoy4oleemfvt t)arra(  ;o0ale  oeiltfs elumsnt0 lenmo3oa1opD  nei t trtoir3oodopen fcias) 2ur(m oo0apeomi3iys a rm(vp;u)arxnir iadom  anvs t t2umio3iy1amt livtat) rtrx  ot4oltomiciltlm2emnvp t) eerif3iytoatranvols trxr(mpou4ll  mnetas)aDtau  no0aptn o3tadlm ua(mpnu4trtrmf tatlmtrauvolt0 etoir nu1lp   ict t  ruaxm ;t1tlx moeils s rlnmsnu)altnif3tytfp r uvilt)texoimpno1ale lncs () 2ta(mont4oleo feiydlmDeanms;u0aetoio3oy1lp raues;( sexrim ou1om   fesas  rrmur ;t1olenioetat m em( pnu0 rtrmrcta1fa rlnvo;(0seuo(o3ny1lltemfcs t  Dtmumo;u1aptomfcildfaDrlu p;t0trerxocoatomDrli olt)s2xo(m3oo4om  lnesltfs2ur(m ou4oetn i3tadfm2umuvpnt4 rtrxf3io1fmDr nvs (0t2umxm iu1al nmnvsatf rtau pno0aet  f3iltfm rmn pnu4 rxnmfcoytlp   ues;(0 rxrxr3oy1alee ncsa( arurur nu0ole mo3tasfa uau s;u) exoxfcto1opDraivil() 2umirpnodaptelfctas sDumumpoo1oee mfetasla rlumont4 exnmr iadop e iei (  exmxo3io4apeemfcils arumx  ;o4aet moeiltls2uln p u)alerxo3tydlpDrlu s t)srxrim iydll  mfctlt)s2ua(m nt0oexo o3tlsfmDrmuvp u) rxnxr3ia1oat aueo;()s2ur(r3iu4am   iet s)aDtmumooo0tee mf3iat aDemnvs t)aetnxf3oadlat luvi t texmiopiydope lfetasfs2tmxmpnu1olx  i3tldlm rluvs;u4alerirctodlmtraies;() rxrim3nodop emfctlt) Dtrxrp;t4aptoif3tlslsDrm(ms (0 etrmo iotlateli il( sruoir3oo1lme lncilsfs2um(m nt4ape  ietldfa2ra(mpnu) rxoxo3oa1fat  ivi s trto(o3iudap  mict s)srumur ;t1ope  icild aDem( o u0 renxrctatlptrli o s0teumxr3nodlm elivs () Dtmumo;u4aptomo3iat sDrlnms ()tetoiocoo1opt  ieo () ruo(opio4lp  lnvsas)a2rrumpnt4oexnii3iatlm eau s u4tltnxr iatfmt lieo (  etoxmpou4lptemivslt)a2rruro;u1tpx if3ildfa2ua( pnt)tlermf totop e uvs (  exm(mpiydame lncilt)aDtmumoou4olen feildlm umumsnu0tlxnio iotfpDeln s t0 2tm(r oodll  miciatfsrurxm no0altomi3iltfaDrl( s;() rerxr oa1fa rau sls  rtm(m iodapee fet ( s2rru p;o0tlxo f3iad mDemnms;(0 exrxf oy1fmtelnei ()s2tm(m3nu4lp  mictl()srrr(rpot0oetn feiytls el( s () leoxr3tadfaDrai s;t0 rum(m nu4llt mnciatfsDumu  nu0apx mictysfm2rmnvs;t4 rxoxr3iytlaDe ieil(0 rurxopno1om elfvtasf rrmurp;u1alenmicild aDumnmo;t0altoio3totfaDeaueol()seuoxmpiy1apenlietl( arrm(mo;t0olt mo3ias m2elumsn()tltoxr tytoaDelivilt)setoxr3iu1apenmncsl(faDum( o;u1tle mfcilsla ua(mpnu0 renmo iy1lm ran il()t2toxo3oy4ole mieil()sruaumo;u0apt iictysfs2ua( o ()aexomr3ty1lpD  uvs;t) rtm(r3oudap e icta(fa2ua(r no4apxn fetyt a ra( p t)altnifcia1fmtranvs;t)trxmxrpoy4alte ivsl(f 2rr(moot4aeeo f3iasfm2uanvo u)texnif3ia1fmtr ieo;t trxoir ou1op   ieils)srrrxmpnu1tptomfetlt m2ul(mo;t)artnir3oadla elu s s  rxrxr oo1lmeelicilt a2tmxmpoo1alx mieiys a rmuvp;u)teenxf oodop e nvi t teumxm3io4amee fcta()a2ra(mono4tpen ietyslmDean p;u) rtnxf3todoa  ai ols  rumxrpnu1lp n nvs tf 2tmx pou0alxomfciasla ul(vs t0teeoir oa1lpD livils0srtoxopny4lmee nciatfarur(mo;u4tetnioeiad m emnvp;u0aexoir3iytfpD ai o t)seuo(r3ny4omtnmfetl()sDtrurono0ope mi3ildla2emnmsn(4teenmo io1lpteauvo;( s2uoio3nodlm elicil(  Dum(ro;o0tpt  ieilt aDran o;t0aleoxociydop eln i s0seur(r nodope  fvt s srrm(  no1aleomi3iasfs2ranmp;u)altrxr3tytfpDrai s t0 rur(rpou1op n nctl() 2tm(m ot4tlx mf3tltfa ranvpnu0 eerif iytomD  neo s) rumim3nodlm elics (  2uau  ;t0aptnmoeiat a2rmuvp;t0tlxomr3oo1lpteauvi;t t2to(mpou1am nlfvia( arurxroou0tlto o3ils m2ul( s u4tlxrmociytlp raivo ( trtrxr3oodlp emfctasfsDtmum ;t4ape mi3ias m eluvo;u4 etrmo3ootlaDr i i;s  2toio3iy1lltemneilt sDua(rp;u1oetoif3ildfmDraumo;t4 ltnir oy1om r nvs s  rtrim3nu4ape lietas)srtr(m ;t4alxo i3iltfa2emu o;(4trxrif3ta1fmte uvo;()texmxrpnudope mnct ( sDtau  oo0teen i3ildfm rm(vsnu0texrxr3ty1oa raiei t  eumxo3iu1altemies ( srtmu  ;u4alenifctldfs emumsnt0 exoio3oytla rlivsl()trtm(r ny1al elicta(faDtmxr ;o1oleomociydlaDrmuvp (0aleoxoctadfmDr n o ()setoxrpoydape  netas srum( ont0aetoifcias s2rl( p;t)aetnmr iydfmDeauesls  2urxr3nodol e nvtls)aDrmx o;u0openifeiyt a2rlumsnu)areoif tytfpDelnvo s)s2urimpiu1ol nmfesls) Dtaump;t0teto feiysfa2el( pnt4trtrmr oydom   ueslt0sexrirpio1apeemfvta( srrr(rooo1optomf3iydlm2ulnms;t0alxoxo3tydlat aivslt) exoio oy1lpt mnvsasfs2rr(monu0alenmo3tas m ul( s;t4trermo3oadlmt  n sls) 2tm(rpou4lme lieil( aDtrx o;t1alxomieiysfm ra(ms () ltnmo3iy1fmt  iei ()t2to(opiydlpte net s aDtax  ;u1altnmiciadlaDum( o;(0texoxrctodfat ai s () eurxrpiudopee nvtlt a2ta(m nt1teeo octytla rm( o (0 renioctydop  ai s ( srtrim nudoptnmnes t) Dua( ont1oltnioeiytfa2rmnms u)trtoxr3oadlpte nvs;t)teum(o nu1altnlnctlsfsrtau  ;t0tpt mf3tadfs ulnmo;t0teerifctatoa eanes t0s2uo(m3ou4aleelfcsltfartm(mpou0tpx moctyd mDum( s;u) rtrir3oytom eaneo s0s2trirpou1omtelfcsa(  Dra( p;o4ale iictlt a2uaump ()trtoir tadfm eanesls)teuoxm3ou1al nlnvsatfaDum(moot1oet  oetysfaDeanmo;(4trxnxr3oa1fmDr nvilt) 2xo(m3io1al nlfvi sfsDraum ;u1aexniiciad a2uauvs (4tlxomf oadlaD  ieslt)sruo(o3oy1omtnmnvs (f rtmxmo;u0openii3iys s2ulu onu4aeenmf3iy1opDeaivi;t0texm(o nudlltelnvsls)a2rm(r nt1aptnifctld aDem(vsn(0aetrir oo1fatrlu o s0teurim iu1om nlnvsa(  Dra( oou0olt  oetydls2eanvo;(0trenxr oodfaD li i ( texmxo nodoptnmiciat) rta(  ;u0aptomiciad aDra(vs;t4 etomfcio1lmD  n s;s texrim3oydoltelnvils  2rau  nt1opxnioctysfs ra(mp;t4texoif iydlmte i o t0sexrxrpnu1apen iesas  2rm(mpoo1oltomfctydlmDeau p u4trenxo oy1la   i o;(  2umxmpoy4ll   fetas) Dua( pno1tle mo3iasfmDrlnvo;(4aetoxocty1fptrauvo t)setrirpou4llte nctl()aDuru  oo1aptnmictyd sDem(vp (0teeoiociatomDrln s ( seumim3ny4omtnlietasf Dur(  nu1aptnifetlt s ean p t4 rxrif3ia1fa  lnei s s2urxm3oy1lpt lfvt (  Duauroot0opeo oeiytla rm( sn()tetoxo3iatopDranes;s)trtrxopnodllt  icsat) rumu  nu4opxnifctadlm2elums (4alxrxrcoatlpD au olt)trtm(o3iu4alenlivt s a2ururo;t0apeo feiyd s ean o;u0artrxocta1fpDr i sls)sexmir io4aptelncs t) Dtau pno0aetn ieiytla um(mo;() lxomfcoadopDeaueo;(0s2xrim3no4ale mfciasfaDrm(rp;u0aet if3tls m emn snt4arxomf iytlatean s t)trxoxr3nu1alte fcsas)artaxrpno1olxnio3ilsfmDulumpn(4trxrmf3to1lmt anesls  2umim nudomee nctasf 2tm(mont4oexn f3ilsfs2rln s;()aeeoir3iytlm r i o (0srxr(o nu1apt  icsa() rtaxm oo4tpeo i3tlsfs rl(msnu4alxomoctytomt lueo;t0 rtrxo3nydomeemiei t aDra(  oo1oet  feiltlm2ea(vs;() lerxocoadlatrln sls  2tr(r oudamt micsltfsDrmxrooo0alxoiicildfaDem(mo;()trxoirciodomDrlneolt)trtm(m3oy1lpeemivsas srtmurpou1oetnmf3ild s2emnvsn(0 rerifciadlpDeaiesls s2uo(o3iodalt  ivil()arrmx pnu0oex ii3iltlm2umuvs (4 rtnmocia1oa  lu i;( t2trxopoo4op   nvtlsf 2rr(ro;t1tpxniictls m2umump;() eerio iotlpDeaneilt0t2um(r3nodom  mnctatfa2rmxronu0ope ii3tyt m2eaums t4aexrmo3to1lpt  uvo t)srurirpoo4ome mnctlt  Duaxmp;u1aleo i3tlsfaDelumo;t0arerircto1oaDeliei;(  2uo(o io1llte ivi s  rtr(rono0apt iieiytfaDrm(mpnt0 exrio3iy1oateai i s)srtoxr3nydllte icta( aDrr(rpot4oleomf3tldfa el( sn(0altrxo3oydfaDeliei t truoxm iydlpenmnet sfsDtrxmpnt4ape mi3iydfa rlu o;(4alxnio to1oa rlneo t0 rumxopnu1am  miciat aDuaum ;t1tltnifciadlsDranvp;t0 eerxo ia1omDraues ()srxoxo3oydol  mfeias s2urur ou1texomoetlt a ua(vo u4trtoxo iotomD  ues;() rtriopou1altn ietasfs2uaurpno4apxoifciytlm2raumsnu4artnif oatlm   nes t  eumirpiy1amtemfciat  Dum(mpou4texoif3tlsla ulumo (4alxnircto1oa  lu il( trtmxm3no4lpenlfet t aDurxr ;u0tpeoio3iadfa ulumonu4arxnmo iy1lmDe ivs;t texrio3nydopee iesa()arur(mpou4tex mo3ils m2ua(mp;u0tetoircoytomt  ivolt0 2xmxopou1omtnmfviasfsrrrxmp;o4aet  ieildlaDumu o;t)altnifcty1op ranei;(0s2tmim3iy4apeelics sfaruax ono1altomictydfs ra( o u) lxomfcio1fmtelieol( sexmxo oodolt mfct t) rum( o;o1oltnmociat sDum(vo (0 lerxf3tatom rau s s0 2to(m3ou4lptemfeslsf 2tr(mo;u4altoii3ildfsDelnmpnt)tltoxr iy1fatraues;s) rtr(m3ny4om   ieta(fsrtaum ;u0aleomfeiad s2eanvs;(0 lerio ia1oa r u o ( setm(m3nu4lptnlncs ()srraum ;t1tlxoiociasfmDumu p;()trxrifciatla   uesls0srum(m iydapte ictl()srtmu ont4alxnmiciys a2rlnmp;u)aetnxr3totomDe n ol()trur(r3io4opt  ncsltfaDur(mo;u0opxo oeiytls2emuvpnt4 lxnxo3tatomtr i il() eumir3iu1lle lfci ( arta(moot4ale ifctydfa2eanmo;u)trxoif3iodfpteau o;t) rxr(r3iudomtnlfeiatf Duaxmo;o0optoii3tytfa2raumo u4 renmocoatfpD  u s;t s2xm(m3oo4lle mfvtltfs2um(r ;o1aeto f3iasfaDrmnmpn(4 lenio oodlpte n i (0 2trxm3nydlpenmfvsas)sDta(r ;u0tleo i3ild s2uln p;u4 rxrifcoy1lp r u ilt)t2xmxrpnu4am elfvsl() Dum( o;t4apen ieils s ranmp (0 lxniocoadom  an i;s)trxoir3oudom nlfvi s srrrxmo;o0tetniieild s rmn s t) exrxr3todfp eai i t)texrio3nudapt lnvilt  Dtr(  nt4oexn ictltfaDrlumon()tltrmr3tydoat li o (0tetmio3oudolenlfvsas)s2rax  ot4oetoii3iatlsDrln s ()texrif3oy1laD  i olt)trxrxr3nodoptelivtasfsDtm( pnu1ole io3tadfm2rmums;t4 reoxoctadoaDraiei (0sruoxr3iodale  ictas)srtax oot4apxn ietytlaDel( s () ltrmrcta1fmt lu ol(0 euoio oodlltemncs t a2uaxmp;o1alxo iciys s elnmp (0arerxf io1fm  lu i s)trumxr iodapeemnesas) Dua( pnu0tlto ieiys mDranmon(0 ltomocio1oateaivs t setoim nydlpenmivi tfartm( pno1ape  i3iyd a2eanvsn(4alermr iytop   uvslt0s2urxo io1op nlictas srrrxrooo4alenifcias mDemu o (4tlxoxr3tadop raueo (0texoio3iydom elneslt a2uaum nt4oexo oetldfm rmuvpnu4tlxrir iatlaD  uei (0setr(r3nudlptnmictatfs2uau pnu1oex  o3ilsla ua(vo;u0arenir oytom e nvsl(0s2xoxmpny4openlfcsl(fs2umx  ;u0olx mf3tyt s2rluvsnu)tlxnio oo1oat li olt0srumxm oo4llt  ivsas) Drrxm no0aptn f3tlsfs eaumpnu4aetnxrciatfpDeluei;t s2toir iu4optnlfvs t) 2tm(  no0opto fctadfs uln pnt)alxnmf3ootlp e u s s  2ur(r iodoleelfei tfsrrru pnt0oex  o3iys m2emu s;t)treoif3oydopt li i;s0srxmir3iydam emfci () 2ra(ro;u4tlx ifctad m2umnmo t)aexoiociadlp  auvils0t2tmimpnu1amt mfes t)sDrrx  no4aexnmiciasfs eluvs;u0 renxrcoodopDeluei;t) etmir no4altn feia( srrauronu4aexnio3ildfaDemnmp (0 eenxrctatfpt aieils s2tm(mpoydll nlivtls a2taxrpno1tpeomi3iadfsDumuvp (4 lenxo3io1oaDraiei s0t2tr(m3oy1om elfvsas) Duaxmp;u0apenif3iysls elu p t0tetoir3tatop  luvsl(0 2xm(rpoy1lmee fvt tfa2rru  nt4tpt  ietysls2ean s t0aetnxf3oy1laDrai ilt  eurxo nydlpenmietas aDtau pnu0openmocilt a el( s t0artrif oatfpte n o () exrxo oydlme mfvs t)aDumxro;t1oex  fetas a2el( on(0tltrir ty1fmt  neo;t0 2xo(m oydlm elfcils a2rmu  ;u1opt  fetas a emn pnu0 rtomfcoa1omDelies;t sexrxm nodlmt mncs t  2raxmo;o1alto o3iasls2ean s;u0arxomo3ty1fpteli o ()s2to(opoo1lp  liesas)srur(  ;t0alx  o3ias m2emuvs (0texnxo to1oatrai olt  etoxo ou4aptnlnctas  Dra(r nt4aeto i3iyd s2ua(mo u0trenmo3to1lmt  nvo;t0 exoxm iu1om   iei tfsDrr( pnu0tlt ioctlsfa rln sn() etrxfcoa1fp r u ols) rur(r3nu4ame  fciatf Dtrx ooo4aptnmicilslm um( pnt0tetoif iy1lpDrai o;s0texr(m ou1lltn fesl(  2tm(mpoo1oetnmfetldfs2ra(msn(4 lenxf ootfm eau s;s)srtm(o ny4ale livs s a2ta( ono4optoifeiasla ranmo t0 exrmf oodopD  ieolt teumxm3oudal nlncil()sDtr(mp;o1apxomociltlaDranvpn() eenmrcootom  lu i t t2xoim3oodlltemfci ()aDumxmpnt0tpeoiieilsla rauvpnt4 rermfcto1faDrlnvo;()setoxrpiy4ll n fcsat  2ua(mo;u0aetnio3tys mDrm(ms u0aleriocto1fpDrau s t teuo(r oo1optemncias arraur nt1olxo octytfm2rmu s;(4 lerxfciytop elivols  exo(r3ny1lmtemneslt s2truro;o0olxnifeilsfmDuluvp;()aetoir tadlp e u s;t  rxm(m iydoleeliciasfsrtr(mono4opx ifetlslmDel(vo u) eeoxr ia1latraivs;s0 2xriopio1apee fctl( artmur oo0oetomf3iasls elu o (0treriocoydfaD  ieo;( srur(r iy1lm n ies sfsDumuront4tlxnmfciyslm uln o;t0tltoir oy1lp rluvil(0t2trim3iydalenlietas artax  ot4apt moeiydla rmn s;t4trtoxr3oytlm   ueo s0trtmxo3io4ol e ies t) rum(r ou0apeoiictat s2ua( sn()arxnxoctotfmtranei t0s2urir3iu1ll nlfet tfaDrmx  oo1tpxoiieiytfs eln s;u0teermf oo1fp e u o ( srxmir3nodape lfciasf rrru oou0tetoii3iyd s rmn p t) exnxf totlm rau sl(  eto(mpnu4amenmfctat s2tax p;u1ole  f3tld m emnvsnu4alermrctatlmD lnvi;t)seumim oodamtnlnvtls)srrrxmp;t1tlx ifciadfm2ul( pn(4aexomocoy1oa  lnes;s srxrxopno1lleemieiasfsDtmxm nu1apto i3iasfmDuau s (4texnir3iadlptelivsl()srtrxm3nodam e fci s)a2umxr no0tleomo3ildfmDuln o;t4arermr ta1lpDe iesls)texm(mpoydaleelicias a2umxmoou4tee  fctadlaDrmn sn(4 rxoxo3ty1laD lies ()sexr(r iudllenmfvsltfa2uax ooo1ale ifcilsfs rl(vp;(0arerxr oatopD  uesls0t2xmxopio4altelnei t aDuaxm ou4aetomfeiytlm2emump;(0altrircoa1omt  iesl(  euo(r iydop nmncsa()s2urx pot4tlx ifciasfs emnmo;t4tlenircoy1omt livilt0t2uoio nu4lpen fetlt) 2tru  ;u1alxoiictadfs rmuvont)alxnmr oa1fmteanvsls  2tmimpno1olt  ivias  Dtr(rono1tlt mo3iatlsDrluvo;()teenif todlpD  n i (  rxo(o oo4amt  ivs sf rum( pnu4oeeo feild aDul(vp;u0aexomr iodfmD  i o;t sexr(rpnu1amen iesltfsrua(mpno4oltomfeiytlaDuanvs u0aleoxr3oa1fmDrlivilt s2tmxm3io4omtn ivslsf rumx oot0oleomfetadla2rmumont) rtomocoy1fpDraneslt0t2xmxmpoudap  mnctat  2uau o;t1texnif3tat a2ua(vo;()aeeoiociydlm  lneilt0s2urxo nu4altnlicias s2ur(  ;u1alx mf3tadls2umuvon(4tlxoiociydomDr i sl()s2uoir oodomeemfet tf 2rr(r ;t1aetomf3tldla2rm(mp u)alxnmocoydla eaivil(  rtr(rpiu1lpeelfeta(fsrrmur nu4aexn f3iasfm eaumpnt4tleoxf3oadlp  lneo (0s2um(r3oydam e icsat  ruax  ;t1tptnioctadfmDul(vo;t) rerxo iydfaDr uvi ()srxrimpno1lmeelfesltf rurx pou0opeomi3iasfa el(vp;u0teenmocty1op  an i ()tetoxmpnodlpe mnet ()sDurur ou4opt miciat m rm(msnt0 ltrmf oadfaDrauvo;t)s2xrim3nu1lp nlicsl() Dtru p;u0alxoio3tat sDranvont4 rxnircoydla  lu i t) 2trxo3ou1ll nmfcsatfsDrau  ;u0tlx ii3tydla2uauvo ()altrmo tydomD  n sls0seur(opiydop nmfctltf Duru pou4texo f3iltfm2el( pn(4trtnirciadomte ivs;t) rto(o oydlpeelnetlsfartmumoot0tltn oeiyt m emu o;(4areomo3ta1om  ai s;s  2xoxr3nodop  mieia(f Dtrxmonu4aetoiieiydls2emuvp;()aexnxo tytoa  lueol(0 rtm(o3oy1lm nlivtas aDtru ooo4ole mociasfa rl( onu0teeoifciytoptrlneo (0 eurim iy1alte ivtl() 2tmum oo4olxnif3iys a2rmu o;t) ltrmfctadomDe ivi;(0s2xoxmpoodlmte feil( arurxr nt4oltnmoctydlmDelnms (4arxoxr3tadfp e ieslt trumxopou4lleelfvil( a2tmurpnt4ale ioeiytlaDum( o () exniociotomteanes t)seuoir iu4aleemfcilt  rtr( o;t0tltomieiytlm emn onu0aetnxf ia1opD  ies s) rtoio3ou1lptn nei tfaDumu p;u4apt ifcildls2ulu o;u) ltrmo oa1latrauvs (0 euo(o3oo4olenlfvs t)arumu  nt0tltn fetyt m2uaumpnu0trxoif3ty1lp  aues s teuo(rpoy4al  lneia(fsDum( o;u4opeomo3tldfm2ulnvs t0arxnmr3iotopt ln o;t)t2xm(m io1om   feta(faDuaxr nu1aet io3iasfs ranvs;u) rxnxf iodfmDeln o;s t2urim oodlptemncsas sDtaxrpou1alxnmiciasfsDumnms;t4trtnxocia1op rluvsl(  etm(m3ny1lpt lnei () rrr( onu4opeo fcildfaDranmon(0 ltnxocoy1fmDeluvi () eumim3oy4omen fvtasf rtaurpnu0olto octat a2emuvsn(4arenxf io1om rauvo;s s2urio oydoltnlfeilsfsrur(monu1apxnifeiat a uluvs;()altrmf3tydfateaneo () exmxm oudam nmfet t  2tmx pou4oeeoiociydfmDrm(mo u0tleoxf tytopDraneo s  rxoxrpiu4omtnmnvtas) rrr(  ;o0aleoiiciatla rlumon(4aeeoif oy1faDe ues s0t2ur(r3oydlpt lictas)sDurx  no1apxnmo3tlsfm eaumsnt)tlxoio to1fm r uvi t) rur(m nodolenliet ( arraxr oo0oetnifctltlm2elnmonu)texomo todom   nesls0setr(r3ny1ll nmiet sfsrumu o;t0optniociyslmDel( ont0alenmrcoadfaD liei s trxoio oo1amt mivtasf 2tru  ou4teenmfeildfm rlnvon(4alxoxo tytoa r u ils sexrio ou1amt micia()aDraumo;o4aexoioctlsfa2em( s t)alenio iotlpDeauei t tetmxo ou4om emnvsatfartau p;o0apx mieiltfsDra(mp;(4 lxnifctadfp rli ilt) 2tm(rpnodapt lfvs (farururo;o4aptoii3iyt s2emump t) leomoctotfatrlnei t0 rurxmpiodlptnlfvils aDumxr ou4oetnmieildfs2el(vsnu) rxoxf tytlateluvi;t  2tr(r iy1al n ieilt srrrurooo4tpeo oeiytfm2eau p;() lxoxr oadomD lies t)s2triopiy1opeemfeil(fs2rrur ot4aptoifeiltfa2ua( snu) rermr3ta1fm e ieil(  2tm(o iydlltemfet t)s2rm(roou1tpt mociadfs emuvs (4tltnio3oa1faDe neo s) rtoirpny1llt  fctat arrrxr ou4tpxnmociltla2rl(vpnu)areoxrctydoat auvolt)sexrxo3iy4lmtnmiesl(faDrmur ;u4tlx if3tytla rau pnu4altnio to1fateauei s0t2xoxo3io1al  livsa()s2ra(rpnu0tetnmi3iasfa2ulumon()trtrio3iydfpDr i o t0trum(rpiy4open fcs t)aDrrurpno4texnifetad s elnvo u4teeoxf3oo1fmte iei ( s2xoxmpny1ole  ictas)s2tax poo1opt iietydfs2elu s t0 lxomo3oy1omDe ieslt0 eumio oydll emfci t) rraxrpou4aleomieildls rauvo u0 leomfcoodlaD an ilt0trtrxm3io4lpeemnet tfs2uax poo0tpeo ociatlmDel( s;t)areomf totfa  livil(0teuoim oo1ale lfcslt) 2trxmoot1optnmictatla elu on(4 exoir iotlpt ai ilt0tetoxr no4om   feiatfsrrax ono4tpeo fciltfsDem(vsn(0arenxrcty1fmtrai il( srtmxo iudoltnmfesas  2rr(r ;u1altn fctas aDrlump (0tltnxf oydlmDeai o s)setmim iu4amen fvtlt)sDtmum ;u4aeen f3tldfs2umumo;(0trtnxrciodfateaueilt0srxr(o3oo4ale lict t a2ta(r ot4tpe ifetaslm2elnmonu4aetoxf3oodfa r i slt0t2uoiopoudomtemivia() rtaxronu1alx ioeiysfaDumums u4 etnio todlpD ai sl( t2toio3iudllte ieils  Durxroou4texniocildlaDrau s ()tleomo oa1lmtrauei;( s2toim iy4aptn fcsa() Drmuronu4apx mf3iydla2elnvs t0texriocta1om   n ils  2xrio iy4ome lfeilsfsrta(root4tetoiociasla2ua( s u0 rtrmf ta1fp  lieo;t0t2urim iy1aleemfvsas srraxmp;u4tlt mfeiasla rmu pnu)teeoxf iatfa rli s;() eurxr ny1ap n ictls)s2uaxm ot0apeomf3tat a2elnmsnu)teenioctydfat lieo;s s2umim3iu4ope micsat arur( pnu0aetoiieilslm2uln p;(4artnifcoatoateai ils t2xoxopoy1ameelfctat)a2urxmp;u4apt iietat m rau p;u0trxnmocoodop rlueo;t srto(m oydal nlics (fsrrrx o;u1olen feiyd s2ua(mpnt)tlerir3tatfaD aueo s)s2xmim3no1apee fcslsfs2tauro;t4tpeomi3iydfsDuaums t)teenxf iodfaDe ieo t) 2xriopoo4amt lnetls) rumx p;t4tle  fctld m2rluvo u4 lenmo oadlp r i ol(0teumxmpnudope mfvta( a2rax pno0tex mf3iad s2rl( s u) rtnmfciotlpt  ivs s trumxrpio4om nlneiat)arum( p;o1oet if3tatlm2umnvs;(4 exnxo oadlateanes;t) eurim nu4lpee iviltfsrrrum ot1olx ioctltfs2ul( s;u4texnmr3oa1la   n s t0 ruriopoo1lp n ivils)s2umurp;t1aet mf3iyt aDrau s (4 rtoxo ia1lpteaivi;t texmxr oo4apte iviatf 2uau  ou0opt  ocilsla rm(vp;t0tltomocoy1om  aiei t0s2uo(mpoudoltemneiat sruaumpot0tpt  i3ilsfa2el(mp u4 rerio3totfaD ln ilt) euoimpio4omtemfvsas)artaumpno0oeenifeiys sDum( s u4alxrmoctadoa ran sl( teuoimpiy1lpe  fci t s2tr(mpnu0olxoiieiad m ra(vp (4 ltoxf oatlmDeaiei ( s2tr(m nu1omee nvt sf 2rrxrpoo0opxn feiyd s2rlnvp;u0arerxociodlmDe iei t0 2tmio3iudapte fvta()aDumxroot4tltn fciytfs umu onu4 etrmrcio1opD aiei;s0sruoio3oo4oltnlneil(f 2um(  nt4tltnii3iltla2um(mo t0texrir oo1fpDelnvslt trumxopiy4ll  livs s)a2tmx  ot0tle moetasfa emuvsnt0 rermrcia1faDeau sl() 2xm(r no4aptnlnctltfs2trx  ou1olt  o3iat sDumuvpnt4alxomr3iydomteaneols sexmxmpoodam  mnetas sDra(rpnu0apxnifciltlmDumump;(4altoxr tydfptr n o;t teurim3iodopeemfcta()aDtaxm ;t4teto feiat m2rau p (4alxrmf3iodfpDrluei t trtoxmpnydope  fetl()srtmu o;u0apxnmieiltlm raump;()texniocty1fpD  uei;t)srxoxo3nu4alee fetas  rtauroou4tee mo3tydfsDrm( o t4altoxfctytoptr i ol(0 rtrio3oo1omtnmfcias  Drax oou0tpxn iciadlm uau o ()aeerio3to1op rai o;(  2trxo io1opt mfctat arrrur nu0texnmoeilt a2umu o u0tleniocta1opD lu ils0 exrxm oo1ll  mfciat)a2urx  nu0opeomicias m ea(vp;u4 rerir3ootlmDrlies s) rtoxo3iu1alenlictltfa2ta(  oo4tetnifciltls2ra(mo u)aexnir iytfaDeanvs;(  rumio3nodam nlfet (  Dua(r ;u0tpenioctasfm2eanms t4artnxrciatopDr nvsls  rtr(m oodope lieiatfsrrmxmpoo4openioctldla2rl(ms;t)alxnifcoadfm eai s t0 etm(mpou1llt mivilsfarur(rooo1teeoifeiasfm ran o (0arenif ty1lmtrai s;t0truoio3io4optn nctat aDumu o;t1apx mo3iadfsDulu snt) renxf tatlmDelieo;s)t2trxm nudlmtemnvs (  Durx pot1olxo oeildlmDumumsnt4 etrif tadomte ivi;( seum(o3nu1amtemivtlsfa2rmxmono4apeniieilslm el( p;u4trtrio3oo1lmte nvs t tetmxopiu1am e ics tfsDur( p;o1aetoifctlt aDum( s;t0arenmfctytlmtrli o;(0tetr(o3oudlp nlnetatfaDrmuronu1tleomi3iltfs2ulumpnu4aeeomr ty1fpDeanesls)srxmio3oudal  lictatfarrrumpou4oltoifcilsfsDum( p u) rerif3oa1op rluvs;()trumxopoo4lm e fcs s aDrmx  nu1alx  fcilsfs2rmnms ()arenxociydlp   i o s teuoim3nudalenlictls)srtrxmpnu4aeen f3iyslsDem(vsnt4 lerxrcta1fpt au i (0 2umir3iu1ape mfctls a2uaumpnu4apto ieiytfmDumuvp;t)tetnmo oo1optran s ( srxm(o nudomeelictasfs2trumonu1ape mf3tytfa uauvo t4aetoir3ta1fa   uvil()trto(r iy1amtnlneils s2tr(rpnu0optoioeias a2ra(vpn(0tetoxf3ty1omDe nvslt trum(o nudlltemnciasf rtruronu1ape ifciasfm2emumo u4alxrxf tadlpDrau o t0srxmiopoudal nlfcs s)a2trxr ;u4tltomfctat s2ua(ms (4trxnmo3totfpDelnvs;t0 rtrir nu1ll elfei ( artaxmp;o4opxoioeiytfa ul(von(0 lenmocoydfpD  ivi;s)srxo(mpnu1apeelneslt aDuaump;u0altoii3ilslmDuau pnu) eeoxocta1la ean s (  eumio3iy4olt  ivs tfs2ra( oot4ope  oetaslmDem(vs;t)trxnio tytom   u s t0 rur(mpiodal e 
\ No newline at end of file
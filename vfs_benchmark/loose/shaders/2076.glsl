@@ -0,0 +1 @@
+ivilt)t2xmxm3nu4op emncia(f rum(mo;t0apeomoetasfs rau ont) eenxf iadomD  ivsls texm(mpnodam elnei (  2rrur oo0tltoifeiytlm2elump;u0arenmfciatfmD livo ()srtmio3iodaptemneta(fa2trxmoou0tetnmieiytfaDrlu onu)altomf iytoatrlivi (0 2xoxo nydalt micslt)s2trxmo;o0opxoif3ils a2uln onu)tlxomrciadop  lneo;t0sexmimpoodllt  fvtls  rrmu pnu0oexoioetytlaDum(vs;(4areoif oytlp elu o;t) rumxo io1omte ies tf Dta(mpnt1ope moctyslaDemu snt4alxoxo iadop raivi s0s2to(opio1olenmfci s  rururp;o4aetomociyd mDua(vo;u0 lenmfcia1omDe ivsl()sexm(r3nudllt livsas)s2tmx onu4aetn fetatlm ul(vs;t0 exnmr3to1lptr i i t  exmio3no1amt  fvtat aDtr(mp;t0oet mi3iat s um(mo;t4tlxomr3ta1faDraneo t sexm(opoodale  ivsl(  Dta(m ot1aeeomociys sDuanvs u4tlermr oo1fmDraiesl(0t2xrirpio4ol  mfet s)a2trum oo0apenmo3tlt mDuau p;(0teerxrcoodomDeluvi t s2urim iu1oltnmfvs sfs2ra(mont1opeomo3ilslaDra( p ()altnmfcoo1laDrai o;s t2xm(m oudoleelivsa()aDumxr ;u0tpxnio3tld s ul(mpn() rtrmf3iadoat aieo;t)trurxr3oodam emictls aDum(r ot4aexnmoctld sDemu p u0trtnmfciodlaDeaueol()texmxopnodap e nesas a2raumpou1olxo octydfs rm(vp;()tetrmf to1lat  ies;t)s2xo(m oy1ap e ictat)s2tau onu1teeoioeiyslm eauvs ()aexrir ty1lptean ils0 euoxo iu1op  mneslt)a2trumo;t4aee io3tls aDul(ms t)texoir todfa r ueols)truoxopoo1am   fci t) rtm( o;o0oexo fetlsls2umumsn(0 rerio3ia1fat  neo;()s2toiopno1ll elicia(f Dta(root0altoif3iltfaDua( s t)texnif3ty1lmtr i sls)truoxm ny4opt  ncilsfsrrau pnu4oetoifeiydfs ea( sn()aeeoxoctadoa elies t0 rumxm3nudolt  icils) 2trumpno4aex mo3tlslm elu sn(0trxoircoadfpD  i ils)srxrio3iodlmen ncs s  Dtr(mp;t0tlxn octlsfs elnmo;(4 lenircto1la rlnvi s teto(o3oodol e ncta()aDuaumpou0aexo i3iyd a uln o;t4tltnir iydfp eanei;t0t2xmio3iudapee fvtlt)aDum( ooo4aexn o3ias s2ranmsnt4tetomf totfpteaneo;( t2tm(opnydlmt  nvi ()aDrrxm ;t0tpeo oetys s2ulnmpnu)tetomfcta1lmD  uei s)s2xrxr oo4opt mfetl()aDumx o;o4olt ifctadfaDua(vsnt4tlxnxr3oy1fatrlneol()t2um(rpno4ameeliesls  2ururonu1olxomoeiatla ea(vonu4 ltrxo iatoaD livsls)sexmxr iy4aptnmnvia() rua(rp;o0tlxo fctatfm2eanmsnt0 etrxo oytoat  nvi s)s2tmxmpnydlmt lfeil(  2taxmoou0olxn f3tltfs em( s t) renir3ta1fa  livils s2uo(mpio1llt  iesls)sDuru ono4tleoioeils a2eau snt4altrir3oytla rauvo;s  2xoim oo1opt  neia(fsrta(rpoo1olxn f3tyt s2uluvo;(4trxnmf3iydlm   n olt0 euoim no1ll nmfetas  rum(r ;t1opxo o3iytlmDelnvo;t)arxoxf to1faDr iei;s0 rxrir ou1aptelfcsas  2uru oot0tetomoeiatlaDeln s t0trxoif3tytlaDrlies t trtoio3iu1ale livsl(faDrruro;o0aeeoifetlslaDean s;(0texomoctytlp   nesl(  2ur(opoo4amee ies t sDur(  ou1texnmoeiytfmDel(ms;u0teerxf3io1lpDeln i;()s2ur(rpno4op e nciasfa2uaurpot1apto fctadlaDua(mp (0aleoxo ty1lp r nvi ()sexmxrpiudoltnmnciat  Drm( pou4aexn oetlt m umuvs t)tetoif3tytlptrlueils)trxrxo3iydal elnvt t)aDum(ront0oltn fctasla elnvsn(0altnif3oydoa  li ils0trtoio3iu4ame  icil(  2uax onu4optoioctlt m ulumpnt4 exoxo ia1omD  uvi s0srum(r ny4om nlicilt aruaumpot0olx  ietytlsDrmu p;t) eeoio iydfpD  u i;t) euoxr ou4optelictls  Dua(mono1tltn iciat m rmums t0aexoxrcoatlatr u ilt0 2xoio3io1ll n ieiasfsrra(mpoo4oet iociadlsDulu s;u)texrmo iotlmt  n sl( truo(rpiu4ale mict t)s2ra( pno4opxnmiciltlmDrmumpnt) exnxrciy1lp rlneilt)trur(opoudlp  lfcs (fs2umurooo4ale mf3tldlm eanvs;u4tltoif3iotfm e ivi t setm(mpou4open fei tfs2taump;t0alenmi3iysfm ra(vpn()altnif tytop  au olt  rtoiopno4lp emfetl( aDrmuro;u0opeomociasls2um(vs;()alxnif3tadla   uvo (  rxoxr3no4ole  nci tfarrax  oo1oee iieiatfm rl( s;u4 rxoxocoodfa   i s;s)tetoio iudame  fviat) Dtmum ot0tleomfciyt aDem( o ()trtnif iatop  aueilt trxoim3ou1op nliesa(f rrr(mo;o4tlx ii3tydfa2el( s;t) etnmr3todla r ivo s0 exmir3ou4ale lfci ( s2umum ou4aeeo fctldlsDranvon(0 lxoircio1opte nei s srur(m3ou1op   fvtatfa2tmumpno0ale ioeiyd mDrln p u0tltrmfcty1lmD auvilt  exmim iu4ol  mict tf rua(ront1tpt  oeiatfa emuvonu4arenmf oydop e n sls0trxmxrpiu1optn nvi sfsrrrum nu1alxnif3ilslsDemumon(0aeermo iotfmteanei;s)srtoiopoy1lme lics s)artau o;t0olxnmocilsla rmnms (4teeoxfcta1la  aues;s0 2xrxr3oo4om   nei s a2ur(rpot4tlt iociasfmDrluvsnt) rxoio todfpDrlneo t) etm(mpiy4al e icta(fsDumxmpno0apt io3iyt m2ra( p;(0tlenio3ty1fat  i slt0srxoxmpno4ole mnvsat)sruaur nu4tpxn i3tysfm2eanvp t4aexnmr3totfmDeanes;t0teuo(m oodalee ictas aDum(r ;o4tlxnifetlslm2uanms;(0arxoif oodfpt  u s;t trtmxmpoodamtemnvi sfs2taxroot0tee mietls s2rl(vo (4aeenmf3iy1fmDr n il()seumiopiy1lmtemictltfa2urxrpou4alx iiciadfa ua(ms u)teenmr oodom rauvi;s)srto(o nudopeelfcs (fa2raxm ou1tleomo3iatfsDrl( snt4trtrir iodopD anvs;() ruoir oudlle  ivta()s2tr(rooo4tpen ictltls2el(monu)aetoifcty1lm ran ils srxo(r3nudopeelies s  rtmum ;t4apeo ietlt s emnms;(0aeenif3tytopDe uvsls)trxo(r3iudal nmnvs (fsrtrumo;o0apxomoctasfsDrl(ms t)tetoif3oodopt anei;s)trurirpoo1omtnliet () 2um(rp;t1texnmfcilt mDuau p u0texrmo tadlmDr ies ( seumir3iy4lptn icil()aDrmxrooo0tetn i3taslm ulnmo t) rxnmo oydfpDrliesl( truoir3ny4lpt  fvias aDtrxmo;u0tle mieiad sDrmn p;t0 eerxrciotoa   uvo;s0 rxo(rpoy4aptn nvt ( s2raur oo1alen ocildla rm(vo u) leomfcoadfm  lnei t0s2ur(opiodlmen iet t  2rm( o;t0tlx  ieiysfa2ea(mo (4trtoxr3iy1om e iei;t)sexrim3iudal nlnei ()srum(mo;o4tetomociyd s2rmuvp;u0trenmo oydfm rln s t0s2tmir oodamee ivtl(fa2rax pnt1tpto i3tadfa em( s;u0texoxfcoa1lat aivslt) eur(o3ny1op n neilsfarrm(mont1olxo fctldla2ranvs;u)arermfciatlm  ln s s0setrxrpoy4ap elivta()sDtmumpnu0tlx mfctyslm2rluvs ()tetnxo3ta1fa rli ol( srxrimpnudam  lfvs tfaDuru  oo1apt iociydlsDem(vsn(0 exnio ia1fa r n o s0 2xriopiy4oltelieia(fsrrm( pot1texnio3iyd aDem(vo;t) lxrir3oa1lat an sls0 ruo(o no1omt  fesl(faDrru  ;u4oetnifciad m2ulnvsnu0arenir3ty1latr u slt0trtoxm3ou4omeelnviatf 2ua(monu1opt mo3iydlsDulumon()tltnxr ty1fptr i i ()texoim ou1alee ieta( a2rrxro;t0olto i3iasfs rl(vp;()tetnxr3iatfaDeaueolt)trtrim3oodame  fci t  Duaxmpou0aleniiciatlsDelumsn()trtnxr ta1la   ivs;s0srumirpiydlmt lfcil() Dumx poo4oee  i3tad s2rau pn(0 lenirctatfpDean o (0s2ur(opou1ope lnei s sDtmxrpou0apxomocils m rlu o u0trtrio totlpt  u slt0t2xr(rpnodop  micsa()srua(mp;o0tlenmi3iatfa2rmnvp u4trxrmf3iytlatr u olt0s2tmxr ny4lle micsltfarrmu  nt0olx ifctasfmDraumo t0 etomo oatfmD anes;()s2ur(r3no4ope mietlt sDtmu  no1tleomoeias m2uanms (0 rxrmo3iotopteluesl( texoxmpiydlmtnliviatfa2rmumoot1tleomicias a2ra(mo u0 eerxfcoy1fmtrliei;s)seurxmpio4om e iet tf 2umumpot4oeenmoeiasfm2rauvs;(4 ltomf ootfpD  uvs;t texrio oo4lmtemnei s  rtaurp;u4ape ioctas m2uan s;() rxnmf3to1laDr ieo () rxrxmpiodllenlies sfaruru ooo4ole ifetyt sDumn ont) rtrmrciadomDelu i s0trxr(o3iy4ll  micilt)a2ra(mp;o1opxnioeild m2rmnvon(4texnxo iodfmteaneils s2xrirpiu1am   nvtls aDrrumpnu4texn ieiydls2eau s t0 leoir oa1lmD lneils  euoxm nu1ole livsa( srum(rpou0apxn octyd a ul(vs;t4altrxociodlateauvi t  eumim3nydlme lnvsl() rrm(ro;t4tetn i3ildfm umuvonu0teenxo ty1op rlieo;()sexrxopnudoltnlnvsls)a2umxmpoo0tlenifctydfmDran s;u0 etomfciytfmD lnvi;( texm(m3oydllt mncsas srrr(rpnu4apeoiociytfsDean s t4texrir io1lm rli sl( tetrir3ou1aptelncs s) 2um(rp;t4ole  o3iadlaDrmnvs u) rxnxo iy1lm ranei;t) 2urxm3iodoltelnetls s2rm(r oo0oee miciatla raums;(4 eeomo3oo1opDrlu i s)s2xo(o3iu1ol emfei s s2tm(m ot1aex iictad sDrl( p u0areoxf ta1lmtrluei;s0trumxmpou4lp  lieta( aDtmur oo0oltomfetas s2uauvo;u)tlenmocto1oat  uei s srxoio iy4op nlici sf Dtmx p;t1ape io3tltfa um( o () lenmr tatfmtrli i;s setm(opoo4lm emivi (f rumxrpnt1oeenmoeiydfa2ranvsnu4trtomo3todlmD  neslt)t2xoim3oo4olenlnvs s aDur( pnt1tpx moetatfs2ul(mp;() etoxf3oadfpt lues;( setm(m nu1lpt mici t)aDrmxm nu1apt iieildfa2uanvo;t4artrir oatfmteanvi t seumxo3no1apte ivi ( aDtm( pno4opto o3tldfsDeau s;u0 eerxrcta1op eanei ( s2xrio3iy1am emfcs s)sDumxr ;u4tlx  i3tls sDrmn p;(4alxnmfcty1lpD an s s)setoir iy4lle mneilt)aDta(m ;o4optn ociydfmDul(mp u0aeeoif3iatfaDeau i s  etr(m oudapen nei tf 2tm(m no1tlxnmieild sDeaumo u4tltoif3tadla eanvo;t) eto(o3oo1op elncia( s2ra(  nu4alxo f3tls m emumpn(0 exrxf3to1fp   ueo;s t2ur(opno4al e neils)s2umxmonu4oeen feiysla elnmo (4aexoir oo1faDeaivs ( trxr(o3ou1openlfeil(farrm(  ;o1tpxomfetyt aDua(vp t4trermr oy1op  aivs;(0srxmir iudopeemnvtasfaDraxmont4alto fctytlm2eaumpnt)trtrxo3iodla eln ilt)srtmio no4lpt  nesltfaDrrum ;t0oleo o3iytls ua( p u) ltniociotfm rlnvi;t0 2umxmpiu1apeelnvtl( artmxmont4tpt ifeiadfm um( p (0tetoxf tydfaDr nei ()s2uoimpoo4lp nmfcia(  rrm(rp;u1ole iociyt sDrm( snt4 exrxo3oy1lpDe ues t0 eur(mpoodol emfci t)aruau  oo0tpenmf3iat mDrmu p (0 lxnirctytlmt livil( t2uoio oo4olt lnetasf Draxrpot4opx mfetyd m2rmumpnt)texnif3iotlm  aivo (0tetmxo3ou1alenmnvsa()arraxmonu0aptomfctlt a rmnmp (0 rtnio3to1fa   iei;t trxrio3oydll  mnciat a2taxr oo1aeeoiociltfm rmu s;t)trxoir3oadfmt luvi;s  2xm(m no1olenlnet sfs2rm(r ou4tlxo feilsfa umnvs;t)tleniociydfpDrluvs t)s2umxr3oudol emfctasf 2ua(rpou4tex mociydfs rl( ont)trtnmf3oo1fp  livs;(0t2xoirpio1lle lnvt s)s2umxr ;u4aptnmo3ilslmDra(ms;t0 etrmf iadla rlivs;()trumio oodomtelnctlsfsrra(r nt1tleo f3iadlm uanvo;u4altrxfcoatfptraues;t) etmio3iy4apenlnes t aDtaxmp;o0ale mo3tlt m2umn o u0teeomf iatfaDeai o;( trurxmpiydol emfet s) Dur(  nt1aeenifcilsfa uluvo ()trxnir oy1fmtelneo t  exm(o oo1openmici t  Dtrumono0opeoifciasfa emu s u4 rxomo todlpDelueilt0sruoiopiy1ome  nvs t) Dtru p;o1ape ioeiys s ea(mo;(0arxnxr tadopDeanvs;t) exrir no1ame liei tfs2urxmpou1tet ioetysfa2rlump u0 lxoiociotom   ueols0s2trxm3iodape mivt t)srurxroou4optnifciyt mDelnmo u) lxrmociadla e u s t0trxoxm3iu4omtemfciasf rtmurp;u1altomo3tytfm ra( p u4arenxfciodlaD li i;t)tetrxm3nodamtemfcsat srumurooo0oleomietlt a2rauvp (0tltrio iy1la rauvi ()srtrxm3nydal emivsl()arumu  ot0apt moctatfmDran p t) rxoioctydfateluvo;s)t2xoxmpoudaptnlfct ()arua(monu4aeen ieiyd m ranmp u4tlxrif tytla   ivs (0srtr(r oudameemivt t) 2ur(m ot4tpx  fctlsla uluvpnu) eeomocty1latr n ols  2urxm3iy1op nmnesl() 2rmuronu1apxniieiatls2rmums;t0teeoxr oatoaD anvo t)trur(r oy4omen ncsl()srur( p;u4aex  ietasla2em( s u4trenmr3todoa  livo t t2xoim3iydom e fvils) rurumpoo4oeeoiietydlm2eln s;t4 eenif to1opDeaueo t) 2umir ou1apt lfvs ( a2rrumpno0tetoioeiadlaDelnmonu4texrmr totlmtelivsls trxm(r iu1amte fesatfaDurur ou1tee mieiadlsDeanvpnt)aeerxf3oadfmDr ues;()seur(m iu1apt mictas)aDtmxmoot0aex mieiytfm2ulump u0alenxo3iytlmt  ivi;s trtrxm io4amt  nci tf Dra( oot1oeenioctydla eauvsnt)alxnmf iatoaDraneo;s0seuoxr3io4alt mnvsl(f rtmx pnu1oltoioctydfmDrlumo (4treoircoadopDrlneolt)teurxmpoydol nmicslt)arraxr no1olx io3iydfm2elumo ()trtoxrciytlaDeanei;s)tetrxrpnu4oltnmiei s) rtm( pot1apxnmf3iasfs2rmnmo (4aexrmo3todfmteaivo ()setr(opiy4ole lnetas s2rmum ot0optniieils m um(vo t)altoxr3iadom rlivo t0 2xrirpiodale micsas  2ua( ont0tpeo o3tasfa um(vp (4aeerxfcoo1lptrlu s ()setm(o oo4om   neiatfarrmxmo;o0tetnmiciyslsDemumsnu)alxomfcoy1oat lu o;t)tetrio nydllee ietat) rtmuro;o0olxoiictlsfs rmnvo;t0treoio3oytomD  neo;(0s2ur(o iu4olenmieslt)a2tax o;u0alenmf3iydfaDua( o u4tlerxo tytomte uesl(0 2tmim3nu4altn fesa(fsrumuro;t0tpt miciytlsDemnmsnt0 eerxfctatfmDeaueol(0seto(m iu4ome lfvtltfaDum(rooo4tee ii3ias aDrmu o;t) exnir ia1op elues s  2xr(o iy1lpt  nvsls  Duau  ou4optnii3tyd a rmuvsn()altnif iytlaDeaies;t)sexo(rpny4lpen fetatfsruaxmpou4opxomfcias a2umu pnu0alxrxociatom   iesl() ruoxmpiy1alt miet s arum( pou4oexn ociys m2ra( p;u4arxrxf3ty1lp e i s s0s2tr(o3nydaltelfcil() 2ua(moou4tpxnifctaslmDra(vp;()aexrmr3todfpDe uvo t) 2xo(o3iu4omtnmivta( aDtau pot1apt miciysla2ranvsnu0tlxomo iodlaD anvo t)s2xo(opiy1lmtnmncia( a2ta( o;u1aet  oetlsfmDrm(ms u4 exoxr3tadlaDraues ( s2to(o no4al nlncilt)srua(rpnu0tlxniieias s2um(mon(4texomociydomDrai i;s t2urxopnodom e neta(fs2tru poo1oet  fciyt aDumuvs t0 etoif3iotlmt  ivilt)srxrio3iudaptn fcsa( sruaum ;o4oleniocildfm2elums;t4texnmo3oatlmD anei t0s2xr(r nydlltnlicia()srumur ;t0tex mfctldlmDra(vpnu0aetrircoadfmt lieo;s s2um(m ny1om e iesa(f ruru  nt0texn f3iadfa rm(vs;u0 etoifciydoaDeaieils t2uo(o iu4lmte nei (faDrru  ;u1oeen fciydlsDuln s;(4arxoxfctytfaD au ols  exm(r3iu1omtemnctls)sDtaumo;o1tltoioeiadlm ea(mp;(4 eeoiocta1la  ai o s0srxm(o3io1ol  miesa(fsDtr( pnu0tpe  fetatfa uanmo;u4 exnxoctotfpDe nes;t)srumio3iodlp nmnviasfaDraump;t0alt ii3iyt s2elums;t)tetoif3oodfpD  ivs (0texm(opio1optnmfesls)arurump;u1opx mfetltfaDrl(vp;u) ltnio3iy1faDrli s s0s2xrxr no4lp  miciatfs2um( ono4olxoiieiad m2eaumo;t0 rxrxf3tytlat livi;t0srto(o oo4ameemfeil(  2ta(ront4opx mictldfs emums u4arermr oy1lp  ai s s)trxoirpio1olen fvt s)aDua(m oo4oltniictyslm2umuvs t0artnifctydopDraneol( texmxm3no4oltnliciat s2taxm ot4oeen o3tad sDrluvpnt)trtnmf3tydom r i o;s)teuoxr3nydlpt mfvta()s2umx onu1aexnio3iadlmDeauvo;t) lxomo oodopDeaneo s) rumir iodlm e icils) ruaxront1oexn fetytfs2ul(mo t4artoir totlp  auvolt  2uoxo ou4openlietlt)arurxrpno4oetomi3iad a uaums;(4trxoif tadfaD auvo s)srxoio iu1lltnlivta() rtrumo;u1ale mfciad s2ean ont4tetnxr3iy1fm  aneols)t2tmimpnu1lpe livtl()srraxmpnt4oltniiciatla ulnmont)artnxrcoydlpt aues;(0srxoio3nudam nmici tfs2trxroou4tpen f3tat a ulu s u) lenxf ootla  au slt  eumim ny4apt mfci s  2rm(  no0aexn oeiatlm ran s;u4artnmr3oa1fpDraivsl()s2xo(r no1opte fcs () rtr(m no4alt mfeiadfm2elnvp u4 ltrio3ia1fpD  ivsl(0srxmxr oydaptn ict ()aDtm(rpno0tptn ictyt m2rlums (0 rtrxr totlpD au ilt0s2xrxr3oy4llte fvtltf rumu onu0tlt ifetys mDuanmo;(4 etnir3oo1oaD luvo;() rurxo nydlp  mfeilsfsrrm( pno0opx iociytfsDraums;t0 lenxo ta1fpte nvs;t0t2um(mpoy4apenmivsa( sDra(moot0texomfciysfaDrauvpn()treomfctytfm rau i;t s2tr(rpoy4ole  nci (fsDumurp;u4apenmiciatfm2elnmonu0 reoxf3iatfaDrau ol(0 eto(mpnodlm elnes ( aDrr(mono0optnifciyslm ua(von()texomrctotlp elies;s0 eumxm3oydllte feilt a2urxm oo0aptomf3tatlm emuvo;u4 exrxfciatfpt anvs;s s2toxrpoydom emfcils)sDtaumont0alxomfeiydlmDuau o;u0artnxo iotoa eanvs;s s2toimpio4amt mfcils)sDurxr ;u1tlx mfeild aDeau ont)aexrxocta1fpDran i;s  2trimpiy1optemnvi ()sDrmurpoo1aexoioctatfs2uaump t) leoif todoa  aivi ( texr(rpou4om  lfvi ( sDtmxmpno0tptoio3iltlsDeluvs;(4aleoxrctatlmtean ols0srxm(mpiu4oleemfvias  rtm(r ;t4altnmocilsfmDemu sn(0arxomrciodomt lieo s0t2xr(opiydomtnmieilsfarurxm ;o0alxn oetatfaDean s t)aetnmo oodfm r n s s)texoir3iu4lpt  nei ()artmxm nu1apt ii3iatfa2ranvs;(4 etnmf tatfa rluvols0seto(m nydamen fctls)sDra(rpnu4oee iociyd a2emu o;()tltnxo totfpteluvo;() exr(m io1al nmnvi t) 2rmxronu4oexnii3tadfm2emnmp ()arxoxr3oydopt lnvi t)t2toxo3oodlme  fcs s a2tr( poo1apxomf3tydfa rlump;(0tetomf oydfate uvsls trtrir oy1oltelfesasf rraurp;o4olxoifeils m2ran s;u4artnmf to1oaD auvo s  rxrio iy4lpenlfvta()srum(ro;u1tlxnifeilsla emnvp;u4tleoxo3oytomD ai i s texmxo3ou1openmfcias arrm(r nu1oet  ociltlmDeluvp (4 ltrxo3tydlpDe nvi t0 rxm(rpno4lm e icils)srrmx p;o0oexoii3iyd s2ul(mpn()tltnio3iodfa elivo;t trxrim nu1amt liei s  2rr(r nu4teeomoetadfs2elu pn(0trxrmocootlaD livs t0tetrio io4aptelfeilt)artmx  no4oeenmfcilt m el(vs t4tlxomo3todfa  auvs s trum(m3ny4optnmivsa()s2urxm ot4aet  ieiad a ran p (0alxnmf3oa1lpDe u o s)s2trim3oo1om e ivs t)arrrurono0tpxo ieiyslm2ul(mo u)altnmo oytfmt ai s t) exrxr3ny1ope  fet tf 2uaxmooo4opx mfetasfm rmuvp t0 eermr iodoptraivo;(0 eumim nudole lictls)s2urump;u4tlxnmictydlmDumumont0trxrmrctadlpt auesl(  2xr(o3ou1llt  fvs () Dtmu pno1opeoioctyt s2eau sn() lxnxr3tadomDr ivs;t setmxo3io4llenlnei tfartru p;t0opx ifeiad a2uaump;t) lxoxr oo1lm elues ( t2tmirpiudapenlieta(fa2tm(mpnu0aetnmfcilt sDul(vo;u4artoxocoy1oatean o s)srur(m3oodlm nlfetat  rra( p;o1opx moctas aDuauvp u4aetrxociodopDelues (  ruoxopiodaltelnviat)artmu oou1aptn ieiys m elu p t0teeoxr3iadlpteaueo;(0 euo(mpiy4om  lnesl(faDrrx p;u1aet mfeildla umuvp u)teeoifcoadlmtr nvslt  2toxmpio4amtnmncsas sDtru  oo4tex mocilsla2eanmsnt4trxnmf tytlp eauvilt seuoim iy4omte ncs ( arta( ont1aee iieilt a2rauvp t0arermfciotlmteai i;( tetmio3oy4altnmfeta()a2uaumpno0aeto ociad a2rmnmo;(0trxrxrcoydlptrluvo (  2ur(o3oodlltn icsat aruaurpoo4tpe  octysfm2rmnms t4texnmr3ia1omDr ivo;s0s2ur(r3ou4ll n ivtlt)a2raxro;u0tpenmi3iasfs2umn s t)teenmfciytfpte nes (0 euoirpnu1lltemncia(f Drmxro;u4alto fciys sDum(mo;(0 rerxrcta1opte nvo (0trxo(o3oy1ome mfcsat sDumxrpou1optnii3tat m rl(mp t4alenxrcoo1lpDeaivols sexmxr ou1lpee nes t  Drr(mpnt4oeen fciyt a em( onu0 ltnxf ia1lmte nvolt) rxoiopoydame  ncs s s2ra(m ;u4alt ioeiyt sDemn o u4 eeoxr3oatfmD livo t0srtrir3ny1apenmfesa()s2tmu poo1teenmoeiatlmDuanms (4 eeoxr ootopD auvsl( truoxo nu4apee nciasfsDrm( o;o1tpeomociyslaDelu s u0texnif3iodoateaiei;s0 exrxr nodope lnvils sruaxr ;o4texnmo3tlsls2umuvonu)artomrciotfmD  u o;()srto(r3oo4oltelivt sf rua(mpoo4alt if3tasfaDrm( p;u0teeoxrcoy1fateli sl()s2xmio nydomt livils s2rmxmo;o0teeniociatfsDrl( pnu0tltoxrctotfm rlnei;s0srxriopoodamtemietl(faDta(m nt1teen i3ild s rlnms;(4teeomo io1lmtrauvi;t0srxo(r oo4apenmivi t) Dtrxrpou0tetoii3iltlmDeluvpn(4altoio3iotopD  nvi () 2ur(o iu4altemfcsa(  Dtmu pot0aex mi3tatfsDulnvp () etoio3tatlm raneo ()teumxm iu4ole lfesltfarrmx onu4apeo feiys mDeau o;u4alenxr iatfp eln i (  etmxo ou1oleemfvtatfs2tmu p;u4tptniiciysfs2rm(mp;u)trerxrcia1fa elnvi t) 2ur(opiodllt mfesl( srtm(  ot4altoiicilsfs rl(vpnu0trermo oatomtr uvo;()t2toio3iudamee nvt sf 2uau onu4aet ifetlsfm ulu snu4aetoio3oydfpD livs s)trxoimpnudolt livsatfa2ra(rp;u0apenmoetatfmDrl(vp;t)artrxo3oo1lp  aivi t s2umxr3nodllenlfvilt)aruax poo0opxomieiaslm2emumsnt0 etnif oy1la r ues s t2xoio oy1alenmfct sfsrtm(  ;o0tle  o3ilsla2emuvsn(0aeenmf oatla   ivo;s  2xrirpnodol nlfvsa()sDtrx oou0tlt moeiyd m rl( on(4tlerif iodfm  anes s0trxmxm nydamee ncslt sDrmxrpou4texn ieildlmDrlnms t4 eenmocootoat  uvo;t)s2tmxmpnodamtn ncia( s2uru  ;t4ape  f3iytfa2ulnvont)teeomo ootfaDelieol()s2urxm oodamtnmncs tfartrumpou1tpe mfctltlsDrmu o;(0aexnmf iydlmt  uvs t trtrxr oudlm nliet s) rtaurp;t1tpxnio3tyd aDrm(vo u0aexrir ty1om e ivs ( trxoimpou4lm   fvilt s2umx oou0olx  octld s eau p;t4aetnxr iotfm   nvsls)s2xoxo nydam   fvia(f rumuro;t0opx ioeiadlsDrlu p u)aexrif3ootlpt  ueil()texm(r oo1optnlfcsl(f Dua( oot1ope io3iasfm ua(vo;t) exnmf ta1fp  anvs ( teuoxrpiydopt lnciat  Drmxm nt4olt mf3iad m2elu sn(0 etoir oodfat  uvol(0 etrxr3iu1lp e ivs t)arua( pot4olt  fetydfsDulu s t)trenmr oytoaDe ueilt  eumir3iydop n nciatfaDuauroou1tlxomiciyt a rm(von(4 rxrmr oydlpD  uvs ()tetm(rpoo1optemfvsltfsrtau  no0aexnmo3iatla2ua( o;t4trtrio3tatfmte uvo (0 2toxrpoy1aptelfvsls sDrmumpoo0optn ieiaslaDrmnvs t) lerir iotomt lu s t0s2uo(m oo1lmtemnctlsf rum(mp;t0opt ioeiadfs eaump t0alxoxf3iotlpD  ies ()srurxo3nudomtnmnvil() rtmxm oo4tlxoiieias m2rmnvs u4arxrxr oa1fmDe i o;t)trtrimpoo1al n ietlt)aDtm(mpnt0apxn f3ils mDemuvp t0tetnmrcoodom rli olt) exmxrpny1opteliviat sDrm(r ;t0apto iciyd s emnvp;t0 ltnxo3tatlp elueilt)trtoiopno4al nmnvs t sDumur nu4alxn ictldfa2ean pnu0aexnmfctotop r nei;() 2xm(rpou4ameemnvi t)s2ur(rono4alt  o3tlt a umnms ()texnxr oa1oa  auvs t srtr(r3iy4am e fvil(fa2ur(ro;o0tex mo3ild a2rmn snu4tlxomo3iytomt ai o t0t2urxo3io4ap emfetas arum(mpno1alxo i3iatfs2rmu pnu0 reniocoa1lateanes s0 exoxo iy1ap emnct ()arra(r ;t1tlxn ictasfs2el(mo u4teeomr3oodlpt aiei;s sexrxo3ou1omeelfesa()s2trumo;t4tlxnmi3ilsfs eanvp u) ltrmf iy1lat  n o (0t2xoxopiodomenlivsa(  rtaumooo4altomoetatls2umu o;(0 leomrcoydfpDe n sls trxrxo io4apte ivs sfsDtmurpoo0aptnio3tasfs2umn sn(4 leoxr3totlmtrliei;(0s2xriopnu1lm nlnvi ( a2ra(mo;o0aleomfeiytfmDem(vs;t0tltrircootfpD lueo;t t2toiopoy1lmt mfvtlt srum(mpno0opxo iciys m2ul(mp (4trtoxf3ootoa   u s (  eumxo3iodal e nesl( sDrm( p;u1tpt  fcild s2emnvs;u)arxoxo3oa1omte i o s teto(rpoy4oltnlnvt tf Drr(rpoo1apx mietatlm emuvs u0artrio ty1fpDeaivs t0trxrxrpoo1om emfcilsfs2uau p;t1alt mf3iys a eaumsnu4tetrir to1lpteaneo;s trto(mpnodape  ietlsf 2um(m ;o1openifetas a ean pn(4 etrmr ta1op r n o t  etoim3oy4amt  fcilt  Dtrxrooo4alto o3ilt mDum(vpn(4 rtoxf3oatoaD liei;t) rtm(opnu4lp e fcslsfaDtaxrpot1aptnmfciatlm eln o t)tltrio3oadfa eauvi s0teto(o no1apeemnct ()sDtmuro;u0tlxnifeildfm rmums;u)aleomf3iodlpD aivo ()trxr(mpnydlmtelictlsfs2tm(r ;u1tlt mfetyt a2rm(vs;()altrmr3tadlm rlies;() 2xmirpoydol elnvsas)aDra(roou1ape io3ild a eau o;t4tlenxo oo1fate nvslt0 2tmirpnodomeelfvsatf rta(rp;o4tex  octlsfa umumo;u) eenxf3tadfp rau i ( teto(opiodllt  nvia()aDrmxmono1apeoifeiytlaDemumpn()texnmr3oa1lmtrlivo;s)tetmim nu4ll emicslt) rrrxmpno0tpx  ietadlaDumnvpn(4 rerio3tydomt  i o;t)srtm(m io1ope  ies s s2rr(mp;o4olxniieiadlm2emnvo u) ltomo3ia1faD an i t0 2uoxm3oy4olenmivs sfsrraxroot1tlt ifciltfa ul(mo u4aetoir iodlpDraieo;t)t2xoio3iudlpeemivs ( s2taxronu4tex io3iydfa2ulumo;t) eeomr3iotlmDean o ()s2uoir3nu4alee nvtltf rumxm ot4tlx mfctys m rauvs u)alxomf3todoa rli o;s)s2trxopoo1lle mfcsatfaDumumpot1altnio3ils a emuvp (0alxrxrciytopt  ivs s texo(rpnydomtnmfvi s) Dtaurpoo4alxomfctasfaDum( p;(0artrxfcta1lp  aivo;t0 eur(rpoydam e ivtatfsDuaur no4tptniieiysla emump;t)treomr3tydfpDeai i ( srurxopnudape mncta() Drr(  ;t1optomfciasfaDuauvon(4texnir oy1lm eaueol() rurir3no1omen fvt (fa2trx onu1altoif3tadls emn s;(4aexnmf3oadfatelneo;t teur(mpoy4lltnliesa( srtaurp;u4tpt mi3tlslm um(mp;u0 lxoif todlptraivi;t  2toim iydlmenlieta(f ruaum no1aetnmiciasfs ul(mp (4 etrmf3tytlm raivo (0 exrxrpiu1opeelivsatfaDtr(m ;t4ale moeiyd sDul(vsn(4 lxrmfcty1lmDr ivs;t)s2xrio3io4optemnei s) 2raumo;o4apx ii3tydfsDem(vs u)tlermo3tatoate ieo s0setmio oodllte fct t)artrx pnu4oeeniocild mDrau p;(0arenmo3tadfpt an ol()t2um(r3oy4ame mnciat sruaxmoou0tpxnio3ildfm2rl( s u4aeermr tadlm e nvi;t0 rxoio no1olt  nctl(farta(ront4apenio3tlslm rm( ont) rxnmf3tatfptraneo s)sexrim oydoptelies tf 2umu pno4tlxn icilt s2ran o;()trtrxo oy1lptean olt trtm(m3iodlmte nvtl() 2trurp;u4olt ioeiydla ulnmon(0arermfcta1fp  an ols  2urxmpnu1optnlnvsa() rtm(m nu0opeo f3tltfm2uauvsn(0artoio3iatomDrau slt0 rxrxm3iydame  fesls)s2um( poo0apx iiciatls uauvs t4tlxrmf iodop   ieols0 rtrxr oo4omt  nct sfsDuaxm nt1oetn f3iad aDeln s;u4aetnxf3iotfp raieolt texmxo3nu1aptnlivs tf rrmxmpno4tlx io3tldfa emnvp;() rxomfciatfat lnes (0 rum(o3nodope  ivil(f 2rm(rooo1opxnmo3tldfa2emu s u)aeerifcoo1laDranes () rxo(opiydol elncil( arrrxm ;t4tltoioetas a ulnvsn(4tlerif3oatla elnvol(0 2uoimpoodapee ivtltf 2rrxmo;o4oltn oeiasfm2el(mo (4altrmfcty1fmtraivi;s s2xrxrpiy4ameelfet tfsrtau  ot0tpeniictls s uanvp;u0areoxo3iy1op e nei () 2urxm no4apte ncils a2umxm ou1oltomf3tyslm raump;t4 lermo ootfmtelivs;t)seurxopiu4am e net sf Drrxm no1oltn f3iad s uan o t) eenmfcoa1opD  uvs;s0 rxoxm3nudap e nviltfs2urxronu1apxoio3tad m eaumpnt0alxomo3iotfatrau s t t2uoxrpno4oltn icia(f 2taxm ot0tpe  octadlsDua(mpnu0trerir3iatlmDelnvsl(0trur(o3iudamtelict sfa2urxmoou0teen ietysls rl( snu)tleomr ty1fpt lieilt)t2xoir nudol  micsl(f Drau onu1aeenioctldfsDranvo;(0tlxrmf oy1fa elieo s)sexmio3nudope lnet (f Drmx  nu4aee moeild m2ulu snt)aetrxocoydlm  ai o;t s2xmxopnu4lmenmiet () 2urxm no0opxo oeiatls rlu o;t4 rtrir3tytop e uvo;t)seumir3nu1apte net sfa2rr(mp;u1alenii3iysfa rluvo u)arermo3iy1fmDrauvo (  euo(m nodalt  ncs tf Dumx pou0alenmictysfmDua(ms;u0trenxo todfateai ilt) 2toxopoo1ape  fcsl() 2umump;u4aptn f3ilt a2elu s;(4 etnmfctytfateai s (  rtoxr3nu1lmee fei sfarum( p;o4tlenmf3tls aDemumsnt4tlermrcoo1fpDeau s;t trxrxopiudlm   fvi ()artaur ou4aeeomo3iadfaDuan snu)texnmo oo1opDr n i () exmio iodapenmfcsls a2rr(mooo1tltnmociydfa eauvsn()texnifctatoaDelivo t0 2toim oudlmenlnesatfs2tmurpnt1oet  i3ilt a rlu s;u0artrmr3oy1oa elu s t)texoxr3iodlp nmfcilsfsDua( ooo0olx ioeilslmDemums u0 etnxf3todlptrluvi;(0seuo(rpio1amtnlictls  rtmuro;t1tlxnmicildfm2ra(ms t0tltnmfciatlpD li ils)texmxo ou4altelnvsl(fsrumxmpot0apx iiciad aDeaums (4aetoxf tadlaDran i s)sexmxopny4ome  fes s  2raump;o0olt  ieilsla em(vo;u) ltnir3to1omDeai il(0trxm(m3no4op  mivtat  rurx  nu0tpt mi3tasfaDel(ms;t0 lxoiocty1lmD luvo;t0 rtrir nudlle mfeiat  Dtrurpou0apenio3tasfa elnvpn(4 eeomo3tatoa elnei;(0texmiopou4lle mnei ()aDuaxmpnu1ape  fcias m el(msn()artomo iatlpD ai o;s trxoim3oy4lp   fvtl( sDtru  nt4tpxnmo3iys m emn o u4 lxomo3oo1lat  nvil(0 rtmio iydopenmictlt)s2ur(rono0olx  oetldls ranvp t4tltoxf iydla   n ils0srtoxr iy1oltn fcslt) Dtrx poo1texoiietls aDul(mo;t4aeerio iadlp eaues;t)srtm(o3oodap e ncs t artrum ;t4olenioetytfa2rln s;u)artrmocoodfm elieo ()texrir ou4oltn netat  rrm( pou0texnmieias s2rlnms u)tetomfciatomt au o s trtoxrpny4omtelicsas)arua(rpno1opeomoeiysfm uluvsnt)artoxr3ty1op  aueslt)s2toxm3iy4llenlicsat) Drr(rpnt0olxomiciat aDrlnvo;t0artnmr tatomt  nvs () 2toimpiy1omt  nct t a2rr(  ;o4oee mfctys a elnvo u)trxnxr iydoaD li o;(0setmxopnu4optelfeia()s2rmxr nt1tpt  octls s2ea(vs;t)tetrifcoa1fmDr u s t0trto(m ny4olt mfeias) 2trur nu4oee iieiydls eaumsnt0tlxrmf3tydom rlivols0trtrio3nodlltn fvta(f 2ur(ro;t1altomfetadfm2el(vsnt)arxrxo iytopt an ols0sexo(m no1amee fvs s  2umxr ;t0apen oetltlm rmn sn(0 ltrxrciytfa raues;s0trxoxopiy1ap   fci tfa2tmxrpnu4tlx iociyd mDrln ont) eerxo iotfp ean o t srxo(rpoudope  ivtlt)arra(m ;u0teto oetyt m el(vonu0tlenxrcio1fm   u i ( t2tmio3oy4lmtemfvsas) 2ur( oou4oexniieiadfa2uaumo;u)treoxf3io1fm rlneslt)tetr(r3oodal   fcsas  Drmx  ou4tpt  feiadfm emnvon(0aeenio3iotlptrau o;s srxr(m ou4omt mfvsat) Drr(mpnu4optniiciasla umu o u) eerxr3todfmDe ies s0s2uo(m3oo1ope mnesl(  Durur ;o4oex mo3tldfmDrmnvp () renmr3oatop rai ilt0teuoiopoy1al  lneia(f rtrxm ;o1ope mfeiyslm2ua(vs t0tlxoirctodfmt auvs;t0 2xoxo3nu1ll  mfet ()sDtmxro;o0apt ioeias mDumnvp;t)teerxr3tydlmtrauei t srxoxo3iydllee icsltf 2trxm ;o0tpeo fciytfsDuanmp t0teenif tydfpDe nvi (  exmxm3ny4ap nmneil( a2rm(m oo1ale mociadfs raumo u)alxoxrctydlatrln o;t)srxmxo iy4ameelivi t  Dtau onu1oeeniociadfa2rmuvp (0aetrxr oytfaD  ieil( setr(m nudop  mictl()a2ra(rono4apeomi3iytfs2eanvo t0tetnif3ty1lateau i;t0t2trxmpno1omen ncs s srum(moou4ape mfeildla eanmpnt0aexrxr3tydlp eau olt t2ur(rpio4amte ics ( s2trum no1tetn ocias a2uanmsn(4alenirctodlm   i i (0s2trir oy4lme  nes t)srrau  no1tee mfctyslaDel(vpnt4 rtrxfctytom elnvilt0 eurir nu1lltelfcsl()s2um(  nt0aeto o3iysfmDra( s t)artnmf3to1fm raivols sexr(o3oodlltn nvtas)srtmum nu4alxoiietys a2elnvp;t0alxrmo oodoat  nvils sruoxm3ou1ol   ncta( aruaump;t0oexn o3tat aDrmumpnu)alenio iy1fate uei (  2xr(r3nodopte iesatf ruaum ou1aptomfciyd m em(msnt0 etniocoa1oaDean s;t0 rto(o3nudamtnmivtlt) 2rmu poo4alt mietasfm2rl( s t)tlxomf3totfpDeauvilt0srtmimpiu1ope mnvi s aDrr(m nu4aptnmoeilsfsDuln pnt4trtrircoo1lmte u s;s0 rto(rpiodameemivt sfa2um(r ;u4alx  ociydlaDra(vo u)aetrir iatoa elivs;()texr(rpnu1op   fcia(fs2umur ;t0oeeoifciatls2umn o;(4aexrxf iatlm r ieo ()texo(r3ou1oltelivias a2ur(m oo0tetomo3ilt aDel( o ()tetomo iydlaDelnes;(  rumiopoudom elivi s)aDuaxrp;t1oet  i3iys aDra(msnu) etnxf3io1omt  neo;t0trumxo3iy1ll nlnctat) 2rmurpou0tpeniociyt m2el(mo;() etnmf3oadfmtelu ils)trur(m3iu4aleemnctasfsrrmu o;o0openmi3ild sDua(vo ()tleoif3iodlmt lueo t)truo(mpny1lptelncil(fsDrmx  ;o1teenmf3tld a2ranvs;t)trxnio3oytlpD aueo;(  2urio iodlmt  fcs (faDrru p;t0opxo fciytls rlu s t)artoirctotlpteliei;(0srxr(m3iudlme  nvt t  Duaumpno0tlxnmiciat m ua(mont4aeenio tydfa r n ol( t2tmir ny1am nmnciasf 2rau pnt4tlt ii3iydfmDea(mon()aexrif3tatlp e ueols tetmir no4op  mfvi t)a2tm( o;t4texnio3tyslsDuau p;t) lxnmf ty1oaDelivi;s) 2umir3oudaptn ncslt aruru onu0oex  oetasla2ulu o (4altrmo3iodlm rlnvols)srtm(rpno4om nmnesl(  rrrxro;u1oexo iciadlm2rm(vpnu0arenxo oy1omDrau o;s)teumxo3oudom emfciasf Durx o;u1tpe  oetadfm2ranvs u)trenif iydlm eluvo;s trtoiopio4om n iet (  2ur(mpot1aet ifciyd sDrmuvon(4aetnmr3iatfmDe neo;(0srtr(rpiydomtnmiesat a2tau  nu0tpen feiad s ea(vo;t4 lxoxocoy1fptelnvo t0 exm(rpny1lpe lneia( s2ta(mpot1oeenifeias a umu p;()arxrioctytfpDelieils0teur(r no1llenliviltfarurxmo;o1opx ifciatfmDumu p t0 rxoxf3iytfp  livi;t0sexmxmpnudomen fvi ()a2um( o;o1oltn o3iltlaDrm(mon()trtnmo oo1fpDr ues;( s2toirpio1ol e fvi s srurumooo1oleomocias s uanvsnu0tlxomfcto1lmtr ivslt t2urxm3oo4amt lfvsasf rua( pnt1apx  feiadlsDrlnmo t)areomr tadlpD luvsls)s2ur(m3io4ol  lnvias)sDtm(r nt0ale mieiyt a em( o;u0 rxrmr3iy1fp r neil(  rtoxo nodalt lietls s2tmumpnu4oleoiictysfm2emnmp t)altnio3ty1fp   i o t0srurxo3io4lme lfvils  Drmu  nt4optnio3tadfs rmnms;(4 leomr io1faDr nvol(0 2urxm nydlle licta()arrau p;o0tlto oeiatlaDumnmont0artrio3oo1omDrlu s s t2xoxo3oodopenmnesl(  Drmxr ot0tee io3iytla2rmnmp;()aetomr iotfat luvi;t sexr(r3nudale  iet ( aDrrxrono4open fcild m ulu o;(4aexnmf3oy1lmD  neil(0s2trxmpoy1am emiesls srrmx p;u4open octad aDrlnvs;t0aeeoio3oa1oate i i;() exm(o iydam  mivtasfs2trxr ot0aptnmo3ilt a ulu s u4 rtoxo iadfp  lu i ( trxmxmpiy4llte ivtlt)aDuau pot4ole mfetlslm rlump;u0 eerio ta1lp   ivils t2tmio3no1ome micias)srtrxmo;t1olx moeiatls uanmo;u)artniociydomDe u olt)tetoxrpio4omt licsatfarua(  ;u0tpe mfeild a2elnmsn(0trtrmrctodlmtelueil()seto(opoo1omeemics ()sDumxm ou1apeoifeilslm rluvs;(0 lxrxf3iadfmt  uvsl()trxrxm oudlpee icsat  2rmu oou1tpe  f3ildlmDumuvp;()aeenxr oy1lp  ln i;s) exrxm nydom  mfei tfa2tm(m ou4tpx ifctyslm elnvs;t0 lxomo3oo1op elueo s  2tr(o3oo1ap emneil( srum(rpno0teto fetasfs2eanmsn(0trenxr oadlmtr iei s srxm(o3oodlmtemieil(  2uau ont0aee iiciasfm2rlumpnu) eenio3iadlp  aneil(0 rto(rpiu1ol  lfeiat)s2raxrpoo0opto f3tyd a2eaumsnt0 exrxr iy1omteluvs;s0sexmirpnodlmtemfvtasfsDumxr nt1apxoifcilt s2eauvs ()tltoio3oo1oa   ueo;(0s2umxo nu1om elfesa( sDtaum ou4ope ifetas a2um(vo;t4 rtnxoctotlat  uvilt srtrim ny1alt lncsatf Drax ont4apen o3ilt a umnmo;u) eeoxfcto1fm r ivo;t0sexoirpou4lpe  nei t) Drrxr nt1tlto oeiadls ran o;()tlermo tytlmtrlueilt t2ur(o3oudol emies t)sDur( p;t4oetnii3iys s rm(vont) rtnmr3todfa   nvo t0 exm(m no1lp   neils) rta(m oo0tpt  feiytfs ra(vo (4alerxo ty1lpDeaivo;t)sexm(r3ny4op n icilsf 2uaxmo;o0aeeoifeiyd mDem(monu)trtnxfctodoa eluvols0 rxrxmpiudopeemiesl( sDrau  ot0tlenmociasfm2elums u0aeenio3tatoatrau o s s2um(o3nydamt licsa()sDtruro;o4tpenmfeiysfaDrm( snu0tltnifciatopDeluvs;t) rtrxrpio1olee nvslt) rrrxmp;u4tpeoioeiltlm rl( snu4tlxrmf3oatopt auvi;(0 etmxrpnudap  lfci t)aDrrxroou0tpx if3tytlsDua(mo u)artomf totlp raneols  ruoim io1lle lncsat)srrrumo;t0tlxo f3iat sDel(mp u) rtoircta1oaD  ies;s s2to(o3io1lmte ivia() Drrumonu0aee if3iys m2rmnvp;u0 lxnmfcoo1lpD lneo;t) euoxm3iy4lptnlictat)aDrr(mpot1aexnmieildfm raumont0aeeoif3tytfpDraivo t0t2xmiopnodameemics ( sDtmu ont4aeto f3iytla em(monu0aexoifcoydfmteauvo t tetmimpiydlpte neia()aDururo;t0apxnif3iys sDrlnms;u) rtomociodfa rlnvs ()seurxo3iu1op nlicslt)s2rm(r ;t4aleoif3iatlaDuluvsnt4trtoif tadlmDrlivs;(  rxrirpiydomtn fciasf rraum nt0tlt  octysfa emn s;t)trxoif3tadlatraivo;s)tetoir3iudal   nvtas a2raump;o1tpe mictadfm2eaums;u4tlxnif tadfmte ueilt)texmxr oy1ll  lnvtas)sDtrxmoot4aex  f3ias sDel(vp;u)trtrio3oydlpteaivilt tetrxrpoy1llt mivilt  rua(  nu0aee miciyslsDuanvs;u) ltoio totomD  nei ()sexoir3iy4oleelivsltfs2umuroou0aeenmfcildlmDean o;u4 exrxr tatfa eau s t) ruoxr no1ole mfviasf 2rmu p;t4alt  iciatla umnvs;u4aetoir3iotfpDe n s;()tetr(m3no4lmtnlnctatf 2uaumpot1tlenmfcilt m rl( onu0artnmo oydfmDeai s;t setr(rpou4oltn ivt ()arur(  ou4apx moeiasfa ulnvon(4tetnxr3io1fmD  nvi;( teumxo3oy4ll n feias s2tau o;u1texo iciydfa2umnvs u4trxnmo totlmD  u o ( seurxo iy1alen ietl(fsrtrx pot4apxoio3iad s2umuvpn()tetnmfctydopt  nvi ( setmirpny1ap elneias a2tr(ro;t0alto o3iatlaDeln p t4artrifcoy1om   uvo s  2trir3nydaptn ieia(  Dum(m oo1tptnifeiytfmDulu pnu)tetomo3ta1omDr ies;( seurxrpiy4lmt mivta()a2urxm nu1opeo ieilt aDemn o (0treoxr ta1lp r uvo;(0setmir3ou1am e nviat  rtru  ;u1tpxnii3tad s ranmpn(4texrxf3tytop rlu o s)teurxmpoydlpeeliesat  rrrur ;o4opeoii3tys a2ul( on(0aeeomo3oydla   ivs;s)seuoiopno1lpt lnvt s)s2ur(  no1oet ii3iasfsDran onu0alxnif3iy1oa r ues;()teur(m3no4opeemnvtlt)aDtmu pnu1tetoioeiasfs ua( pnt0 etrxr iatfpD anvi t seuoimpiydalt  nct tfa2umxr ;t4ale moeiatfm2elu on(4 exnxf todlaDr neilt)t2to(m ou4al nmnei t arraxrooo0tptomfeiyd m ul(vp u) rxrmr3iatfptr uvi s0tetoir io4lptn fcilsfarrr(root1texn oetysfa2eanvsnt0arerio iodfm eluvi;t  2ur(opoodlptelfet sfsDrrxmo;u1teeniieiadlaDrm(vo (0 eenxr iadlmte uvo ()s2xoxr oy1lm n fcils) 2raumpnu4ale moeilsfm2ra(mon(0trenxf ootomt aieolt) eurimpny4lle  nvslt)s2tmxr no0oexo oetltfmDeln o;t)altnmo3oadfaDrauvs;s0 exo(r3ny1optemies s) 2trumpou0alen oeiytlm2rm(ms;(0teenmr3iytlatrauvsl()trtoimpoy4lleemfvs s)aDtax pou4ole mietytfm em(mp u4artrxfcoy1lm r uei (0teur(mpou1ameelnvsas aruru  ot4oee mictatlm rm(vsn()texrif3oytlmDelivo;s)setmim3nudalt mivia( aDtrxmo;t0tpto iciaslsDrau p t4 exoxr todlp  aivil( sruo(m iy1op  mivs t)srtaxrp;t0tptoiieild a uln p;u) exoirctytlm e ies;s  eurio oudoptemieia()s2ururo;t4apx mfciltlmDelnvs;t0aleoif oy1omt  n i s  2uo(m3ou1lmt  nci sfa2rr(m nu1tltn oeils s ulums;u4tetnircoo1laD  nvo;(0tetrxrpiu4amee fvta(  2um(mpou4tpt mfcilsla2uan o;t4texnxo iytlmtelnvi t  euriopoudole  ncil(  rrr(roou4alxnmfciadfaDrmu snt0 reoxf ta1fm r i olt texmxopnodlptemnctl()a2ur(rpno1oex mf3iad m2ranmpn(0aeenmo3totlm rlieo;t)srtoxo oudomte ncs (fsrtmx ont1ale mfetydlm2emnmp;(4 exoxo ootoa raivils seuoim iu1al nlnvil(fa2ta(mp;t4tpeomoctldlmDrmumo;(0 reomo3iytlateluvsl( truoxmpoy1apte feias sDtr(moot1apxnmfciasls2rm(vs () lxoxfciodla  aieils s2umirpnu1lm nmiet t  rua(mo;t1alxoifetadlm rl(vpnt)aetrmfciydlpt  uvi;s)trxm(m ny4lmtelieils srrrxmooo4ope if3taslmDrl(mpnt)tetrmr3totlat  ueo t0teuo(r nu1lme lfvi (faDrmx oot4tltnifeiadfaDemn o u0alenio io1la rau olt0s2xoxm oodlme mfcilsf Dtmumpnu0ole  iciad s ra(vo u4altoif tadfat an o;(0s2toxm3no1alt mnvtls)aDrrx  ;o4texnmi3ildls ea(ms;() lenxr io1lptelivo;(  eur(m iy1om emieilt a2rau ono4tltnifciytlm rmu ont4treoxrciydoaD  uvi;t0trurxr oy4lme  nvt (fa2rmu pnt1ale  octlsfsDea(ms (4alxomr3iotlpte ieols) rxo(r3nu4ll n fvslsfsDtr(mp;u0tpxoif3iysla2umn s;u0 lxoxr3iytomDelieo ( texm(mpio4oleelicilt)aDrax onu4tptomi3ildfm emnvs u0teenxo iydlpt  ivs t0trumim nu4omeelnvsasfs2taxroot1openmfeildla2ra(vsnt0 lerif3oadlmtrlivo;t srtm(o3oy1ole mfetl( sDtaum ou0oltomiciys s uaumo t) lxnmo ty1om  auvol( srurim3iodaltnmivia(  Dumx  nt0ole iociadlaDul( pnu0aeenio3iadoate neils)t2umim iydlm emnvtas) Drrurpnt4alx if3tydlaDranmp;() lxrmr oytlm e ivo;t)srurir3iy1amtn feslt)srtrx oou4aptnmf3iatls ea( pn() ltnxr oo1oa  lnes;t)setrim nu1ol e ivi () rrm(rooo1alx micilsfsDra(vpnt)arxrif iadfmtr i sls)s2xoimpoy1op  mietl( aDrmu pot1oeeoifctadfa um(ms;t0 ltoxo3iodlatelu olt) eurim3nydomee iei (f Dumu oou0aexo fctat a2umuvs (0 rtomr ootlmD li s;s srtmxm iodlle lfvsa(farta(ronu1teeniocilsla ea( p;t)aeeomocia1laDelnvo (0s2xm(rpnodap nmfetls  Duax oou4apeniieiysfaDran o;u)tlxrmociadlp ran i;()s2uo(o nydol nlfesas)srrau  no0optnifctytla2um(ms ()aexoiociotfp elnvo;t)t2uo(o iydalt mnesl( srtrxrpnt4tpto fciyd s2eaumo;t0 exrmo3iodopDr i o t0 2xoir3no1lp e feta(fs2trxm ;o1tet ifeilslaDelumpnt)alxoif3io1oa  li o s setrirpoudame mictlt)artmxmpno1aexoifeiyd s2umn o t4 ltrmf3iotlmte nvsls) rtmim oy4aptnlicil(fartau p;o1tetomoetldls rln s;u4 ltriociatfa   n o;t)t2tm(r3iu4opeelnvsa( s2raumpnu4alen oetlsfs2rauvsnu0aetnmo iadlm r iei s)texoxm3io4ll elivslt)a2ra(  ou0tlxoifciydfa ua( pnt) rxrxfcoy1lptrlu il() rtrirpio4omtn ieiltf rrmxr no0tet  icilt s2um(mo u)arxomf3ootlmt an s s  etrxr nu4alenlfeta(faDurx oou4tlto octldfs rmnms;t)tetomf tydfp eaivo (  2xoirpio1lp   ivsasfsDua( pnu4oet  oeildfm em(vp ()texoxr tatlmtran i;s t2tm(r3oy4lm  livtat artrxmoou0apxoiietas a2eluvp;t4artnmf3iy1oaDelivi;s t2xrxmpny4ll nmivtl(fartm(roou1altomocilsla2ul(vsn(4trtrmo iotlatelueil(0s2xrio oy1olenliviltf 2rm(mo;t4ole  ociatfm ea(mo t4 eeoxf iatlat au s;(0srtmirpoudll elicslt  2umxmono4apxomi3tys m2elnmsn(0alxoio3tydomte nvo ()teumxrpio4amte iet s)a2umumpou1tltoiiciltla rmnmp;(0 exrxrciatoa ranes;(0seuoxopoo1ap  licsa(fsrtmum oo4alxomiciyt s rmump;t0arenxr3ia1faD  nei;t0teur(mpoy4llenlnesa()s2rmu onu1tpe ifetldfmDemn o ()trxrif oy1omtr ies;t trtmiopoodoltnlfes () 2trum ou0tpx  iciytlaDrmnmpnu)alermrcto1lptelies (0 rto(mpio4aptelnvsl()sDra( poo1tleomfeild a2uluvp (0aexrxo oydlptrlues t s2uoio no4ol n ieta() Durumo;o4teenmocildlm2umuvs;(0aetnxo oydlpDr ivo;t s2uoxopou1ap emnetlt)sDumx pnt1tlx iociytfs ranvon(0aeerio3iodom rlivo;(  rurxrpio4amte ivs s) 2raum ;t1alxomietad m umuvs;()alermocoodop eli s;s)texoxr ny1am emivilsfsrurxmont0apeo fetydfa2emuvo t4alerir3iydlpD anvs;t0teurxmpiudol nlict t)aDurxr nu0apt mi3tytlaDeln s;()alxrmo3oa1fmD lnvo s) 2xm(m3nydlp elncs t) Drmu oou4aee ii3iytlmDumnvp;t) reomr iy1lmt an il() rumim3oydoptnlnvilsf 2ua(mpno1olxn i3tydfa ea(vonu4 eermo oadla e nvilt0trxo(o io1apt lnet () rrau ono4apto fetlsfaDrm(msnu)aexoir3iytom   iesls sruoxr oy4oltemnvsa()a2tmumooo0tlx mf3ildfs em( pnt0alxoirciotlaD lueol(0 euoxrpoy4lm emivs () Dua(rp;u4ape iietysfa2rmump t0teenmociydopDe uei t t2xrir3oy1aleelivslt) rtaurpot4aexomieildfs ra( o ()tleomr oy1omDr ivols0 2xrirpnu1am  mnesltf 2um( oou1alenifciasfm uln o u4aetnmf3tatoat  u sl()tetmxo3nu1olt lnei ( aDra(r no0apeo ieiyslaDra( p;u)tlerircoadlmD lu s ( seurio ny4ll  lfct (fsDtm(mo;u1aleoioctlt sDuluvo u0alenmf io1la r u o;t teto(m3ou4om emivsas aDua(  ou1olt ifciatlm2eln s t)tetrxr oa1fpt livils  etriopny4amtnmfeils a2rm( poo0oeeomi3iyd m um(mo;()treoiociatlatrlies t) exm(r no1ap   ies s aDuru  ot1olx iociaslm2uau pnt0tltnmrcoydfa   u il()trtoio3oy1am  mictlt arua(ro;o0optn ociydfa2rlnms u0 ltrmfctatom e uvs;t0 2um(r io4lm nmncil()aDua( pot4tlxomfeiytlmDrm( o u4tlenmo iadomtraivi;( t2xo(rpoydal nmnvs t srumurp;o0tleoifciasfm2el(vsnu)artomf3ta1fmteli ils0 exm(mpny1al nmnvs () 2rr(ronu4olen ocilsls2uluvsn(0alxoxf3oadlm r iei;s0setr(o iydal elfvsat s2truro;o4oet  oeiytfm uanvo u)arxrxrciatlp  anvsl(0 2xm(opoodapte icils)a2uaxrp;u1aexo icilt s eau o;()aexomrcta1om   nvslt) rumxo3no1alee fesa(fsDtru  ;u0aex iictydfmDuan s;t0 exomr3ootlpD anvils) eurirpio4lmt mictlsfaDtaurpnt1tle ii3ias s2elnmp (4aexnxo oo1fpt ai i s)srtrxo3oydopenlivi ( aDumx  no1aetn oeilt sDumn s t4trenir3oatfm rlues s0 exr(rpoudlmen nvi s) Drrxroou0teto oetlsla2ulnvo (4 etoio3oo1lmte n o s0 exrxr3nu1lp  lfcs tfsDraumono1tet  fetysfa2umnvpn(0aleoxrctytla  li sls0s2toir ny1omeemfcs s sDtmurpoo1tpxn ictyslaDul(ms u4arerxr ootomD  neo;t)truo(mpno1am e nes t s2trumpnu0tlxnii3iytfmDrm( on(0tlxnxfcoy1laD  ueo;t sexoxm3nu4lmte nvsltfaDtru oot4aeenmfeils mDrmnmp;t0trtnxfcta1fp eaivi s0 ruoxo iu4op emnct sfsrtmx o;o1opxniicildlm ra( s () ltoircootlptelivslt  exmiopiu1llt lfvsat)sDtmx pnu1aeenioeiysfa rmums ()tetnxocia1fptraneo t)trxmir3oodamt miviat) ruau  nu1opeomoeias mDuan p t)trtrmo to1lateaueslt0t2xrxmpiu1am elieias) Drmu o;t1tlto ietldfm ua( o (0tetoir3ty1opDeaivs;(  2uoirpiydame  fcs ( arra(rpou4aptn o3iaslmDulnvpn() exnmo3oodla  lues (0 ruoxo nodam nmietatfa2rmxrpnt0olenif3iydls emn s;t) etoxo3todfpt  uvsl(  2xoim oo1omeelnviat) rtaxm ot4teto o3tytfsDrmnvon() ltniocto1op   nei s  2trim3oy1lmt  fctl( arrrxmooo1tee moeils a uln snu0 ltnmr oatlateanes s)sexrxmpio4am emneil(fa2rrur oo4oleoioeiasfa rmumo;u)aeenif iatop ranvs;s t2toimpny1am emfetls)s2ua( ont1oetn oeilt m elu s;u0 rtrmrctadoa  li s;t0 etrxopny4lp nlivil(fa2taurp;o1tpxo fetydfm uaums u0arerxo oadfa  ai i;t t2xmirpoydlpenlnvslsfsrurxrpno1tlenii3tydlm umnmont4altnxrciadfpD lnei ( setrirpoudom emfetl( s2umxm ;u0oleo i3tat s rmu p;u0 eeoxf tadfp eauvolt0trurxm3oydaltemieia(f rumxmonu0tlto feild aDra(msnt4aeenxf3oodoaD auei;t)t2xrim ny4ol  lfvs s a2rrxrooo1tex mfeiytla rmnms u4alxomr3iotlpt lu il(0texo(r3ou1omen ici t s2rr(r nu1olxnifcildfmDeln s ()altoxo3iodoa eau ilt)seuoxm oo1ope  icia( a2umu  oo4texniicildfm2ulnvo u) rtrxr3totlm  ln i ( trtrim iy4lm e nvi s artmx pot0apt mociys s eluvsnt4aexoiociotlpDelueolt0trxr(r3oudlmtnmfeilt) 2uaum ;u1aee  i3iadfa2uauvo;t0 lermrctydfp  au i t) 2tm(r3oydal  livilsf Drrxront1olxo i3iysls2eln pnt)tltnmf3oatfaDeln s;(  2um(o oodomen ics ( a2tm(m ;o0opx mfciltfaDrlu onu)arxrxo3iadoatrln sl() 2um(mpoo4amt  fcslt)sDrm(r nt4aex mo3tadfaDelnmp ()tlxrxfcoydlptrluvi s tetmxm ny4om emivilt) rrmu ont1opt mf3tydfs2rmu p;()texrmrcio1fp rlu s;s) ruoxm3io4aleelfvsls) Dtaxmpnu1texoiictys s rlums ()alxniocty1oaDran ils0 2xr(opou1llenlfeta() rtmumo;u0tet  iciltfm2ra(mo t0arxoif ty1faDeau i t srxm(r io1ol nlfetat)sDtm( p;t0apto iciydla2rluvo t0tlerxfciotlatrli s s)srxrir3iu1omeelneiltf rraxr ;t0oetoii3tltfa2eluvo (4 rtoir to1faD an ils)s2toimpoy4lpeemnctatf Dua(ro;u4opt  iciyslmDeanmp;(0teeoxrcto1fa   uvols  2xrxo3oydoltelnciltf 2rm(rpou1olto fciysfm2emu p ()areomfctodoaD ai il(  2uo(opio1ole  iesat) 2trx pot1opeo fctasls2ran s t4 etrmrciadlm rauei;s tetm(r3oydop  lfvils)arta( p;t1aee  o3iltfm em(vo;u0tltrioctydfmte n i;(0 rtr(o3ny4opt  fvs s  2rmumpot1olxnmieild mDuanms;() eerxr3ia1fa  luei t)truoim iydapeemnvi t artaum ;o1oleomo3tldfs rmn pnt)arenxocoo1fptran o;()sexo(r3ou1lp  micil( a2tmu  oo1opxomfcildlm2um(mo;()altnxfcoy1fptrlnes t0 eum(o oy1ol nlfesas)srraum nu1oeeomieildfs2rmu o;(0 rxnmf to1oaDe i ils sexr(mpoydap emfciltfarum(mpno4tltomfcildla2um( snu4aeenircoodlp eai ol(  2ur(o3nydamenmncsl(  Dur( poo4ale mietasfmDrlnvs t)arxrxo3iy1latrlivs;()seum(rpny1lpe lfvt tf rtrxm ;o0tpx if3ild sDrlumo u)altoircoatoaDe i i t0trto(o3iy1llenmnvs t) Drrxrpnt0tetnio3tys a2uanmp;t0 rtrmf3tatlp rlnvols trumir iy1olee ictls)arrrumo;u4texomieias a uan p;(4 lenmr tadlm   uvs t srur(m oudlpe  ivilt)aDtm(m ot1aetnmo3tlsfs eaumsnu) lxrir iy1faDr ueo t t2tm(o3iydlmeelfvs ()sruauroou4oltomocilsfm rln onu0texoxo oytopt ai sl( sruoio nydlpt mfeils aruru pno4opxoiieiadlm2eln o;t) exnir3to1faD lnvsl()s2urim3nudopt lfes s sDrmx pno0alxoiociys aDuau o;(4teenmr3oytomDeai i;()t2xr(m nudomeelfcsa() 2tr( pou4aex mo3ils s el(mo;(0 leomf3oa1fpD ai sls0 rxoxopoo1altnmivtls) rrau  ;t4aetnii3iatla ean p;t0texoif oodop   nesl()setmim no1ap  lnvtls) rtr(mpnu0aexomietys s rmuvsnt0trenxr oy1fa  livi (  2xoxr3oydapt mivi tfaruaum ot4aleomfciyslm el(vonu4trtnmr iydfpDe uei ()s2xrirpnydoleelicia(  2umx  ;u0tpxnmi3ils m ean s ()trtrir3oadfpt lnei s t2xrxmpny1om n icsltf Dtmur nu0tpenifcilt sDea(vs;()arxomrciytfmD livo;()t2umirpiu4ope lnct (farurxm ;t1aet  feiysfm uanvo (4aexniocia1optr iei (  eurio3oodomen fvsasfarrrxm oo4oexn ociyd a ul( o u4 rxrxoctytopDeli olt  rtoiopnu1amtnlnvtl(fsrurxrpou0aeeoioeils s2uan p;t0trenmrcoa1fatr nes;t t2xrirpiydlpen nctlt) Dumxront0tleoioetatls2ul(vo;t4 rtnxocoa1faDr nes;t0t2xmxo iy4ole  feta( s2tr(m ;u1tpxnmi3ildfs2rl( p;(0trxnmr tatfptr nvo;(0t2toxrpno1ap emfctltfartm(rono1oleoif3ild m2rm(ms u4trxnirciy1faDraivo;s  rurim iydol n fvias  Drmu pnt4texomieiytfa2rluvpnt4arxrmf3ootlp rauei;s0seumxo oodape  ieils a2umu onu0apx  i3ilsfs rm( s;(4texrif3iodoaDran i s0trtmirpiy4oltn fes ( sDtmxm nt0tex  octyt mDrlnvsnt4alxniocta1fm r ies;(  exo(r oo1ole  ivtl(  Drrxmoou4alt  fctls aDumnvs;(0tetomociatla raivs t)teto(o ny4oleelnct ()sDra( poo0teeniieiysfmDulnmp;(4 etoif oadfate n s s)s2xmxopoy4ap n fes ()artmuronu0opeomoeildls2emu o;(0arenio tadfaD lu i s  rtrxrpoudaleemfctasfsrrm(m nu1tlxnmieiytla rmnms;u4 rtrxfcootlp e nes;s)teurxrpiy1op nlfetl(f Duru pnu0olto o3iydls2elumon(4artomfcia1fate nvs t0seur(m iu4omtnmictat)aDuax  nu1tptnii3tad s eanmont)trxriocoy1op  auvi;t0 2xmxm ou1omee nesas) Duaumpou4olx  oeiltfa ea(vo;u)aetrmrcoatop   i s;t)trtriopio1op  mfvia()sDuaxr nu4aet ifeiyslaDemnmp;t)aexnxo3tatlmDelu olt  euoio iu4oleemietlt  2ta(mpot1aeenioeilt m rl( p;(4tetoir iodfa elieolt0sexo(o3ny1ap n ncil()arrmumo;u4apt ifciad m ulumon(0 etomr3oy1fmtr i i s0 eumiopno1am elfvs tf rtrxmont4alx micild s ua(mp u) leomr totlateaieolt0t2tm(rpio4om emfct (fa2rrxmpnt0olxnioeiyd a2rlnvp u4artoxoctodfpDr ues;t) euoxmpnu1apenlivi (fsrrr(  oo4tptnioeildfa2ranvon()arxnircio1lmteaivi;(  rur(m nu1apt mnciasfarua(ro;o1opx moeiyd m2uluvp t4arxnmf3iy1fp r ieolt) 2umio oy1ame lfesl() Dtaxm oo4ole io3tld s uaumpnt)aexnxf3tydomtr i slt0 rto(m3oodap nmivtlt)sDraxrpoo0tle iiciadlm2rln o;()tlxomoctatoptr nes;()trur(r oudale miciasfsDur(mpou0olx ioeilt m rlu p;t4alxrmr ty1lp r nvi ()seuoir oy4altn ncs tf Dua(  ;t0teeoiiciyslsDuau s;u0texoif tytoa e nvo;(0t2tr(m3iu1amee icsat  2rr(ro;t1aexn o3iyd sDumnms;u4trxrir3oydlm  luvil(  2urir3iudlp e ivi s  2rmxm ou1optniocilslmDra( p u4artnio3oo1fmt  n ol(  2xoir iodomee fvias)arurxroot1aexomo3ilsfs ulnvo;(0alxoio3tydlaDeaues;(0tetrxrpio1am  lics t arumx ont4oet ifetltfa um(vp (4texomfciydopDrluvi;(  exmxm3ny4oleemfcsas srra(m nt4tee  f3iys sDulums;() lerif io1fptr u sls)t2uoxo3ny4open iesa()srtaurpoo1oetn octaslmDuluvp;t4teeoxr tadom   nvilt)trumxrpoy4olen ivs ()sDrm(mont1apxnii3iadfs2em(vp;t)altoxo3io1lptr uvs s) exrxm iodam e icil()a2rmur ;u1aexnifeiat sDem( on() lxrio3iytfmteaueil( trxoimpnydaltemfctasfartaxmp;o4tpx mieiasfm rlumo t0teeoifcio1lmte n i;s0 etoxr iudll emneils)s2taumont0alxomfeiytfa2rauvonu0alxrio3iytfp elieols)tetrim no1lp emivsl()arta(mont1tpxnmoetadls rm( o;t0 lxnxo3totlaDeln i s) eto(m3nudlle miet ()s2taxrpnu4aeeo feildfmDulu sn(0teeomo tadfm ran i s s2um(m3oydomt  fvslsfaDurump;t4aee mo3ilsfmDum(vo u0texnmr ta1oat livsls)s2tmxo nudlm nlnes (  Drau  no0opt ifcias a umn s;t4arxrmo3iodlmD  uvs;s0setoimpiy1apt  fetltfaDtax ont1aeen i3iyslaDrlnmp t0aeeniociadoat  uvi t)truoio oydlpenlici sf 2ra( pot0alxnmocias sDrmuvpn(4tlenxr oadlmDran o;t0trxmxrpou4apt  ncta(fa2umu p;u0tpeoif3ildfs2ua(vsnt)altomociydfate ieils)t2xmxopio4optnmivtasf ruau o;u4open f3iat s2emuvo;(4tlxoxf oa1fatr ies s)teuo(m3io4omte nvtas) 2tr(  ;u0alx  oetlt a ul(mo;t) rtoxocootlmtran o;t0trtr(mpoo4lp nlfvsat  rum(  nt0opxnmieiytlm umums (4 exomr io1fmt au olt0s2tm(r ou1opt livi sf Drauro;t0tet ii3tyd a2elu s u4tetoxr3iy1oat  u il()texmir3oydlp  lfeils sDtmxrpnu4aleomo3iadfsDeanmo u) eenmf oo1opDr ivolt texm(o3oudlp e fvta(f Dururpnt1ope ioctys a2ua( sn(0aleoxr tadlmDe iei;t0srxo(mpoydomee ncs sfaDurxm oo4apenio3tys m2emn p;(4trtrmr oo1op eluvol() 2ur(r3iu4ap e fcslt s2ur(rpnt1alen ieiatfa rl(vpn(4aetrmf oytfmt auvilt t2tmxo3nu4lp elnvi tf 2rrx oou1apeomfetaslmDulnmo u0aeeoifciy1fpteauvs t0teurir ou4lpt lnetls)s2rrur ;t4oeen i3iyt m2rmnms;t0tetomrciatlpD anei t0srtoxr3io1op nmnviatfartr(ront0ole  f3ildfaDraump t0aetnmr ootoaDrlu ols0 rtoxo nudlme lict t a2um(mo;u4tpeomo3tat s emnms;u4aeermr3oy1lp  an s ( t2xoir3ou4lm  lneia() Dtmxmo;t0tpenmi3tlsfsDuanvo;u0trxrxr3iadfp  auvo t0 2trxr io1ale  netls sDumur nt0tltomicils a rl(vs;()trxrio oydfa  an olt0 etoimpou1al  mfes t)sDtrx poo1optnmicils sDemu o t0alenmfctotfpD liei t0t2xr(o3iu4omte fvta(fsrrm(mpou1tltn i3tatfmDrm(vs;u0arxnmr totlpt  ueo;s0trum(opiodal  lnctlsfartmxmpot0tptomo3tat aDelu s;() exnio3todoatrluvsl(0seum(mpio1lleemneilsfs2ra(ro;t4opeomf3iasfsDuanvon(0arxnircoadoat aies s0 rumxo nydapeemivs s s2raxr ;t0oet iietlt a2em(msnt4trxnmr3tydlmtraneo;t0t2uo(r3nu4olt micil( aDua(mpno4texn oeiyslm2umn s () rerir tydlaD  ivs;(0 rtmirpoudomeemicil(farrauront4teto i3tld m rmnvpnu)artnxfctadoa   ueo;(  exmir ny1ome lfcil(faDraxmooo1aeenif3iyslaDrln s u4aeenif io1lpt aues s srumxopiy1omte ieils)aDtau ooo1oeeo oeias s rmumont)aetnioctatom rln i;s)trur(rpou1lptelneiasfs2raumooo1tpe  i3tas aDelumon() rxoir3to1fpDrlnvi;(  2xmxrpoydame  ietlsfsDrrx ont0oee moeilslmDrluvs u4 exrifctadlmteli i;t)srtr(m3nodap elivtasfa2tmu o;u1olxo f3iatla el( s u4arxomfcia1la  lu s t0t2to(o iy1lp  lfeiltfaDrrx pnt0apxoii3iatls2ea(mp;u)tltnifciotfp rlies;()s2uo(o3nu4om e ieslt)sDrauro;u0oetnio3iatfa emums;()aleomo oadopDrliei s  exrxo3oo1ale miesltfa2rmxmonu4texn ieiydfaDemnmpn() eenmr tydla   u sl() eumxm3nudamen ivslt)sDtr( onu1opxnmi3ildfmDua( pnu)trxoxf3iytlatraivi;t)setr(mpnydlm nmfviat)a2umx  oo4apxo i3tadfm rmnms;t0alxrio oatoa  ln slt srtrxopno1omenmfci t) 2uaur nt4tpxoifctysla2ea(vo u4aeenioctadoaD  n i t0srxo(m3ny1lmtn iesatfsrtru pnu0tpxomfeilsfa rlu sn()trxoxf3iadlmtran sls texoir3ou1alt licsas) Drm(mp;o1apto f3tytfa raumont4tltnmo3iadoaDraivol()t2to(o3iu1ll n ics (fs2umxmp;o1tlenifctld s rl( s;u0aleoif3to1om  lu ils0 rtmimpoy4ome livtl()srumxm ot1oet mfcilslaDemn s;u0 eeomo iy1om r nes;s seurim3no1aptemicslt)aDrrx  nt1tlxnioeildfsDul(vo;t4altnmrctatlp  ln i s)srxr(rpiy1lptnlnctas  ruaump;o1oltnmfeiltfs eanvonu) ltrxr todfptrauvils)s2umirpiu4om  liesls sDumxrp;o1ole ifcild a elu snt0 lxrxr iodfpteauvi ()texrim3nudaptelfet sfaDtrurpnt1alen feilt a ul(vonu0alxrif ia1om r uesls0s2umxo ny1olenmfcia(  2uauronu4tee moeias m umuvsn() lxnioctydlpD  nvo s) rumxrpno1olenmfcsasfsruru o;u4tleoii3iydla2ean sn()texoif ia1omt aivs ( srurim ou1alte fes ()sDurxr nt0tetnifcilsfa ra(mpnt0artoirciytfa r ueo t sruoirpio4alee ivs t) 2um(rp;u4tptoiieiysfs2rlnmp ()arxoxf3iotfmD lnei (0seuo(o ou4om e fesls) 2urumpoo4oetn oeiatlsDeanmo;u) eeoir oodlpDrln olt0t2trir3ou4omt  nei (  2raur oo0tlen f3iad s2umu pn(4aeenmfcta1omDraies;t)sexrxo3oy4ol nmivi sf 2rm(rono1tetoio3ild a2ea(monu4arermrciadla eliei ( s2uoio iydome  ictat sDrmxmpou0tlxnmfciyslm2ra( o () exnifciytlaD li o t s2xrir nudapte ies t) 2tr( pot4alxomfeiytlmDuln s;t0 exnmr todfptean sl(0s2to(rpoy4amtelfvs (  Drru o;t1teeomoetas m2em(vsn()aeeoif3iodoaDr ieils  rurxr3iy1amt lnvt s sDurx p;t4tpx  ictld a2uanvo;u0aetoxrcoatlaDe ivs;s0s2toim ny1ole  fvtat) 2umxrpnt4tex ifctldlsDemnmp t)areomr3oytoa r u i;s0s2urir nydlpee feias artmum ;o4olt mieilsls2em(vonu)texomr tadlat  uvols sexoim no4alt  ivt s)a2uax o;t1tpeoii3iaslsDrmn s t0 lxrmoctydfmDranei t)trtmxo ou1aptn fctlsf Dra( p;u1tlx  oeilsla rm(vs t0 lxnxr oy1omDe u il(0srxm(m nudomtn fci tfsrtaum nt0opx iociad s em( onu4tltnio3ta1omDrau o;()setmim nu4al elncs () 2trurpoo0optnioeiasfm em(vonu4altomfcto1fat  u o t0srxmxr3nu1op nlnvilt s2uaxmo;u4tpxomfciadfmDel(vp;u) leomo iodfm   i s;t)srum(mpoo1olt mivtlt  2trurp;u4tlxnmi3tadfmDemn pn(0aeerxo iydfpDrlnesl( t2tr(r oo4ale  fctlt  2ua( ooo1tpenii3tydfmDelnmsnu)aexnxf3io1op r n i;t0t2tmxm ou4lpt  icsl(farrmx  ;u0aleomi3tydfaDua( p t4artrmf3oadoptelues;s)texmxmpoo4ap n icias)a2rr(m ;o4tlt if3iltfs2rl( pnu4altrxo to1lateluvs ( t2xoio ny4ap n ietat)a2rmumont1tetnif3iys a2ea( pn(0aetnmocoo1laD anvo s0srumxo no4op e fct tfartmur ot0olt iieils m2umu o u)aexnxf3tydlateli s t0seuo(o3iudop emiviasf Drr(roou4oetnmfetytls2elump;u)alerif3to1op  liei;()srumir iudll e ncsa()arta(ro;t0opto oeildfm2el( o u0 ltrmf3tatlaDeauvo t)trtrir iy1om n fvsas)a2urumont4alx  ictydfs2elu snt)aexrioctotopDeln s t sruoir3io4ope livsat  2umurpno1apeomiciatla2eanvp;()aexrxo3iodoa   n o;s0seur(rpiu4opt mnetls)aDuaxmpot1teen o3iatfa elnmpnu)trtomrcoadopte ivi;t s2umxm3oy4om  micsls sDtmumo;o4tlx if3iadfs2ea( o ()teerir3tadfm r uvols  etmxm3oo1lm nmnvt () Dra(mont4tpe iociytls2umnvon(0 rxrxo3oatfpD  ivs s)t2xmir no4llte ncsat)s2trxm oo1oetniictatla2uan p;u4 rxoircta1opDelieo;t t2umxm3io4al e fctas) Draxmp;u1tlto ieiltfs2ra(vont4altoxr oatlmDeluvi t0s2tm(mpnu1open ncsa( artmxm ;u4ole mfciasfmDeanms (0aeeoxr3iodfmDeln s;(  2uo(o3io1ol  lfviat) ruaxr ou0aptnmicils s2ea(ms;t) lxrxrciatfaDranvsl(0 rxoxm3io4om emivs ( aDtmump;u0apx  i3tydlmDulnmpnu)trtoircootfaDe u slt  exrxr io4amen fvi tf rtmx ont1aet moetldfsDelnvont4aetoxocoa1omtraues;(  2tmxr3iodop n fvias  2urxmo;o4opt iiciltfsDelnmon()altomfciydom  aies (0t2triopiydomtnmfcia()s2raxmpno1alxn feiad aDuanmo (4treoif ia1lat lu i;s)t2um(mpnu1lme mics s) rtmxr ;o0aex mieiysls ea( s (4aetnmf3oy1lp   nei s0s2urio iodop emieia()srtmurpno4tpx mi3tltls ra(mp;()texomo iatopt an s t) 2uo(m ou4lmt mnci ()srrmurp;t1tltomfctydlm2ul(ms u)texomr3ootlat li olt s2tmxr3nu4lpee fvi t) 2um(r ;t4alxn iciyslm eau s;t0trtrxo3oy1lmtelueo;t0s2urim oudol nmfesa(fs2ur(rpnu0ale if3tldlm2ra(vs;t)aeerio3iatfpte nvilt)t2to(o3iudll nlfctls) Drmum ou0oltnmfeiasfm rlnvs;u0 lenmr3tytlpDrai o;t) 2tmxo3iudaltnlfcia(  2rr(m no0oltnif3tasla2rmnvo t4aeerir iodfatr i ils0 rtoim io1aptelivt (farumumonu4tltn i3iatls2emn p;t) rtrxrctytoaDe i i ( s2trio oy1olen fetltf 2urum ;o1oleoifeiysfsDrmn o u0 rtoifcoytfmDrlieilt  ruo(r3ny1alte nvtl( artax pot4texn octas a ea( s;u0trxnif to1lm ranei (0teto(o iodapee netls)a2rr( pot4openmi3tyt m2rmumo u0arxrir ootlpDeanei s)s2umirpou1llt  ivs tf rrau  nt0apeo fctldla ua(ms;u4trxnxo3iotlmDeli o s  2tr(m oodamen fvi tfarumxm ;t4oeeo feiytfs2uluvpn() rermocoadlmD  uvi;(0 ruoim3iu1alt lieia(f 2urxm ;u0texo f3iadla ulnms;u0alxrxocoatfp  aieo;(0trtrxmpou4lp elnci t  2uru  nt0aexo icildfs eanvsnu0teeoxo oy1fa eaieo s0s2tmxrpny1aptemfesa(fsDtr( pnu1tpe mi3iaslm uanvs (4aeerxocoodlmte uei t)srumimpoydolt lfci s) 2raumooo0tetnmoeiys m um(mo t0tetnir oadla rlneols)srxrxr3iy1oltelnei ()arrrurpou0oee io3tltfmDrlnvs;t0aexrxo3iodlmDeaueo t srxmxr oo4ol  mfet s s2taxrpoo4alxnioeiaslsDelnms;(0aetrxr tadlpt anvo t0 etm(m ou1alen nctl() Drm(ront4optn oeiytla ranmpnt)tetnio3iytlp r n sl( sexrxr iodal  mfvsl(  Duau pnt0ope io3tyd a2raump;(4treoxr3todfa e u o;t)s2xoir3ou4ope lnviat  Drrxr ou4altnmieilsfs um(vsnt)tlenxfctydfaD ln i s) rtr(mpny4aptn fcilsf Dtmxr ou0alx ifciytfa2em(ms t)aleomfcia1fpDrauvsl(  rxrir iu4apeemnvs t a2uaxmpot0olt if3tatfsDrlnvpnu)aexoircia1omDeliei;()t2xrxm iydopeemfciasfsDurx oou1aex iictysfm ul(vo;()arenmr3tadlmt li slt) exr(r3no1op emfesa(  Dumum oo1aexomfetatlaDuanmp (4 rxrir oadfaD aivil(0seurxm3oo1llte ieil( srrmxm oo0apxo i3ild sDulums u4trenxo3oytfmD anvo;s0s2trir oo1ameemfcil( aDtr(mpou1aet  i3iys aDeanvs t4 rtrmo tydfaDrlnvols) etmio oy4aleemfcs (f 2umxr no0oltnifetatls2ul(vo;(4teenif3tydoate ivs s0 eto(m3iy4amee ieta()arrrxmp;o0tex ioetysfa2em(vo ()arxrxrcoodopDr ies;s) eum(o oy4llt mfctls arur( o;o4aet io3iad aDrmuvonu)tlenmr3iytlmt li s;(0sruoxo3nudope licslsfs2uaxro;u1apt iietyd aDumu snu0aleoif3oytoa   uvols  ruoxr3ou4alenmnet s) Dra(rpoo1tpx  o3ilsfa umump;u0trxriociy1opD an s ( sexm(m iudlp  mnet t) rrrumono0alxnmoeiyd a rmnmo;t0 rtrifcootoaDeaueo t)t2xo(m3no4lm   ieilsfs2rr(rono1alxomoeilsfm2um(vp ()texnmocoatfaD lnes s) 2toim3no4llt mieiatfsDtmx  ot1oet if3iys m2ul(vonu0treoio ootla r ues s) 2uoxrpiy1opee feslsf 2ua(m no1ape iocildla2rl(vs;t0artomo3oa1oatelieil(0texo(mpiydlme lfeiat)aDrmuronu0apeoifetltfaDem(vo t4 rtrxr3iy1fptr i ilt trtr(r no4apenlfctatf 2ur(  ou1apxoif3tltlaDuanmp;u4trxrmr3oydfmD lnvo s setmxr io1altnlfvsas) 2tr(r ;t4alt iietyslm elu p;u4 rxrxocio1fmDrlnvols0t2triopnydoptemictlsfaDtrxront1texo icild a ua(vs () etomr oatop  livo ()tetm(r ou1olenlicils aDrrxrp;o4altniieiytfa eln sn()aetnmo3iadoa  livs;(  etoir3iu1amt licslt  2ua(rpnt1tet  oeiad a rauvpnt4 ltnifciydopDrln o;(0 etm(m oo4ol nlnet s sDtmxmo;u1oet  i3ilsls2eanmon(4tetnxr3oy1omD luvil()sexr(o3iy4omt lfei t aDtrur no4apto f3tyt aDemu o;()trerxrciy1omDelnes t0 rto(rpiu1ll elfvsas srrmxm oo4tpeoio3iad a rau on(0 rxnmr tadfa e uei s0srumim3oo1ameelivsatfaDtax ont4ape  octadfa rluvp t0 etrxf ta1lpDrlivs;()setm(r3iu1olt  feils)sDtmu  ;o0aetoiieilsfmDranvs (4alxnxr ta1op  aieo t srxrxm3oo4olenlietl(  Drmuronu4tetn o3ilsla2ulnvo;u4alxnio3iytomDrlu s;t t2toxm3nodoptnmneia() 2ur( pot4opto ieiydfaDean s;() eenxrcoa1fpteai i;s0t2umxmpou4optelicils)aDurumpot4aetoiieils a2eaums ()trxrxo3oydlmDrauvs;t)trur(r iy1lmeelncsat a2rm(  ou4aleomoeiat sDrl(vs (0trtnmo oatlmtean i s)trxrimpiu1amt lnvsl( aDraum ;o0opx iicias s2rm(mo t)aeerxrcia1lm  au o s0setoxopiudoptemfvslt)s2trxmpno4aee  octadfa ea( s;(4artrir3oytomte n i t t2xrxo3iu4ol nmiet tf 2rmxronu1oetomoeias m2ulnvont)teeomfctadlmtraivsls0 2tmimpoo4aleelicia()a2rmxrpot4olt moctls mDeau s;u4 etoiocia1fat livi t) ruoxr nodol n nvsl(  Drm(mpnu4apxnifeiyt sDrm(vp;u0 lxrxr3iodlaDr i o ()srtmio3io1al  lnctatfsrurum ;t4texoiociad a2ran s (0texniociydfa e uvils t2urxm iodlp  lnesl(faDtrxmooo0tpeniieiysfs em( pnu4 exoif3iydlmD aivs;s)seto(o3ou4ope  ict s s2tr(mp;u4texomo3iytlmDeluvp u)alxnxr ta1faDrlnvsls)srum(opoodamt  ietl(f rtm(ront0tpen o3tadfm2ua( pnt4tlenmocoo1lp elu o;(0t2xoxopoy4optemfct ()a2urxmo;u1tlenifciatfmDrm( snu)texomo3oa1fmD aueo s0setmiopio4lme lfvsatf 2uaxr ;t4oeen fetld s ranmp;(4aexrirciadoat  u o;t  rxrim3iu1lp   fvtlt)aDtmx pno4oex mo3iad mDrmuvp;(4tlxrioctodlpD aueo ()t2toxo no4lmenlfes sfsDuaur ;o1oeeomfctas s rln ont) rxoxo3oodlmt au s;(0 2tmiopnu4olt  ivt () 2tmurooo1aetoiietydla2um( p u) etrxo3todfmte uvi;(0s2tmxr iodamt  fesls arumur ;o0tex mfctat s rl( o u4arerxr3oatoptrai s t) ruoirpny4amenlnetls)aDuaxmpoo0aex  ietydla eluvo;u4 eerir ootfpD lueolt)s2xm(opoodlpeemnciasfa2ra(ronu1oleomf3iltfm2um( o;u0aexrio3tadla eaiei t0 2uoim3oudlpt mfcilt)aDrr(  ;u4ole  feiltla2elu o u4artoxociy1lateli s;s0 rur(opny4lpe  fctasfs2rm( oot0oex mfeiasfsDuaumsn() rerircoy1lpDelues;( texoxrpiudaptn nesl() rua(mpou1opto oetltfa ra(vs t)trenio iodlmtr u il( srxrio no4lp e feia(f 2ra( poo4alto fctadla2uan s u4aetnmr3oatfmteau ols0 eumio iodlpte nvtlsfsrtru pot4openiieiatlsDul( pnt)artnioctadfpt  ivi s)srxm(r iy1lm  lieil(fa2tru poo0texn o3tysfm umn p t0 eermocoadopte n s (0tetoxr3no4lpt mfvs t sDua( p;t4apxnioctysfm2ran snt0 lenif3iotlpDr n o s0 rtoxr3ny4am  mfeta()s2rmxm nu1tpxn i3tyt a2ranvsnt)trenxrciytopDe n il(0srxmim3oy1llt miviat srraur no1tpeoiiciydfs ra(mp u4artomr tydfat lieo;s)srto(r3nydopeelnesa(  Drmx  nt4tpe  ieiys a2uan s u4tlxnmr3tytla r n s;(  rxr(opiodalenlivsasf Dtaurpnu4aexn o3iyt s uln o t0 rxrio oatlatrlneols0 2toxrpoy4olt  ncta(f rumurp;o1tlt mo3iydlm2ua(mo t0trenmr ta1omt lu ilt srurim io4ll nmnvsl(  Draxm ;o0aexoiietltfs2uanmp;u0alxrif tytlateauvols0trto(m oy1aleemnvtl() ruaxmp;u4tpe iietydfmDumnms;t4arxoircto1la elueils truoim3ou1lme lfciltfs2uau pot1alt io3tysfs umnvonu)arermf3oatopt an il( t2xmim3ou4omenlietltfs2trxmpou4olxn i3tadla uauvsn(4texrxr iytfptranvils t2tr(r io4op n nvt tfaDta(m ;t0tpeoifeild a eln onu) lxoif ootfpD ln s;s) ruoxm3ou4al nlict ( arrru  nu1aleomoeias m rmnvsn(4 etnmfcoatomtr uvi;t0 rur(rpiu1om emfctls sDtr(m oo0tlenmi3tls s2uln p ()artomo iy1lm e n sl(0srxoir iu1ap   nvtl()s2uru pot1apt mfciyslm2rmnmon(4 rxrio ia1opD livi ()truoxopio4ameelies s) Duaxmpot4aee mociasfa umnmp t)tltnxr3oy1lp elnei;t)s2tr(opnodlm n icils sDrrx p;u0tex ifciytls2uau p;(0areomo 
\ No newline at end of file
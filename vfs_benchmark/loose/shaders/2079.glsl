@@ -0,0 +1 @@
+n o;s  rtmio oo4ol e ncsat s2taxro;o1apxniiciatla2ul(mp;u4alermf iadfa eluvols)t2toio3io4olee nes t  2rmxmono0oexo o3tatlaDrln p;u0 ltrxr ootfp  ai ils0t2urirpiu1alte neilt) Drmx pou0oetnio3iytfs rmnvs;u) lenircootfpDe ueil() rtmimpny4lmt lfeil(  Durxm nt1tptnmfeiasfmDraumsnu0 exnif iytfpDr i s ( s2trim oy4llenlnetls)sDrmxm ;o4opeomfeiytla2ean p;() lerxr oo1omt  uvol(0 2toim3iudol nmfet () rtrxm nt4ale  oetld m2eau o u0 rerxr ta1fm  li i s srtrxopnydopt liesltfaruaump;u0oeeniiciadfs2ean snt0 rtrxr3ootfmDrau o;s seum(r3oo1alenlnviasfaDum(root1texn ietyslsDuauvp;u) leomr3oy1fa  anvs;()t2xo(opny4lltemncs t  rrau ont1alxoii3iysfa um(vs t0 rxrxo oatfp ean o;s)truo(opoydole lfvia(  Dtrxrpnt1tpxnmfeiatlaDel( pnt4teermf3iy1lp e uvi s trtmxrpnodol n fci s aDuru p;t4tlxomf3iytlm um(ms;u4 rtnmo3oadoa e i s;t)t2umxr3oodlp  mies (fsrtrx  no4alto o3tydlaDraumo;t)tlerif3tytfpDrauvs;s trxm(rpiy1optelnet t)aDuaum nt0aee  fctlsfmDum( p (0 etomociydfmteaiei;s0teumxo3iu4amenlictls)a2urxm no1teto oetltfa2rm(mo;t0 eeoio3oytoaD livo (0s2xm(m iu1lle  fcslt aDurxr ot4oexniociytfs2rmnvp (0arerif iodomteau o;()teurxr3oydll elivi tf 2raumonu4oexnmoctldfa2elums;u4alxrmr3oydomtr uvs;t)teurxrpiu1opte feil(fa2tr(m ;u4olt mo3tas sDem( on(0 lxoif oadomDrlnvs;t0texrxr oudlm e nvs (f Dtm( p;u4apxo ietyd s2elu p t) rxoir3oytomD luvslt) rxm(m3ny1llte fvt t  Drr(  nu1apx  fciydfa eluvp;(4alxrxfciodoat liei (  exoim3iudlmtnlictlsfa2tmurpot4ope mo3iltfmDrl(mo t4 rtoxr3oatlpDeluvsls s2ur(o3oudlle mfvsls)a2tax oot1alxnmoeiyt s el( s;t4alenxrctydoaDrlnvi;()s2tmxo3oy1ll nmfesat)s2rax oot4tpt  oeilt a elnms u)trenifcoy1laDe n ilt) 2umim oudomt lneia()aDurxrp;u4texo fciasfm rm(mo;u4teeoir3oa1oa ranvi s  2urxr oy4omt mictls)artrumo;u4alenmieiad s umnvs (4 eerifciadop r nei;t) 2umxm nodamtemfctls)s2ra(mo;t4texoiicias s2eaump t0 rxnir tadoa   n s t tetr(rpnodalt  nct (fartrxmp;u0tetomf3tas s uluvp;t4treoir oydlaDraieo;t0t2xoxo3oy1lpenlfct ( a2rax pnt0tlx mociytfm rau o;(4arerifciotlpD  nvil()sexrxr3iodoltnmnes sfsrur(m ;t0aex mictysla rmnms (0 rerxocoatfa raueo;(0trtrxopio4om nmncsas sDum( pnu0tle  ictytla2rlump ()trxrmf3ty1latr neolt)trumim nydlpeelfvtlt)srraurp;o1optnmiciltfm2ea(vs (0aleoxf tatop  lieo s0 euoimpoo4apeemicil(  2rrx  oo4alenmoctadls rlnvsnu) etomr3tydla  anvs s texoio ou1amenmfet s  Dtm( oot0tltomfctytfs2rmnmsnt4tetomoctatfpD  uvo;s  exoim iu1ol e nvtls srua(ro;o4oetnmfeiadla uluvon(4 lenxo3oadfpt an s;s  rxr(r nydom nmfctltfs2rrur ou4aeenmictlsfs2ul(mo;t4tleoif3oytfpDrli o;s t2ur(opnudaltnmiciatfs2rrx oot1altoifciydfa emu p u)tetrxf oy1oateaueo t)s2urio3oo1al emncsls)a2rmx pnt0olen iciytlsDrmu ont0teenifctatlp   uvils) 2umxo iydam  lfcsasfaDraxm ;o1aleo o3iytfsDeln sn(4altnmf oatfp e u olt0t2uoxrpnu4llt lncs sf 2uax oou1tpeoiictad a2emu o t0 reoxrcoytfm  aueol() rtmxr ou1lpenmivt t) rur( o;t0apxn oeiysfsDum( snu4 eenxo3todfa  lneolt)t2xrxmpiy4amt lfvtls srtmx  no4tpt  i3iat aDuluvp u0arenxr tadfptrln o;s0 rxmxm3oodol  lfesa(fs2ra(  ou4tlenmoetydfaDrmu o u)texoif oadomteauvilt0t2urir ou4ol elnctl(  Drruront4olx  ietad a2emumo t4alxnmo totlat  u sl( s2xrxm oodlm   ivi sfsDrrur oo1tpen iciltlaDrlnmp;(0tetoxf iotfmt an o t)s2urxopno4llee fesat  2rrurp;o1alt  f3tlt mDrlnmp;u4 exoxrcty1lmDeanei;() 2toir oo1ap e fcs t) 2ra(m ;o4ape iieiys s2rlnmpn() etrxrcoa1fmteanvi;s)trxoxo io4altelnci ( arraum ou4tltnmf3tas sDumump u) rxrirctatfpDrlnei;s) rur(o3no1ll  liesltf 2trxmont4tpx mictysfaDuanvp;()alenmrciytoa eaues;s sexm(m3oydop  miciat)s2ur(moou0tet ifcilt mDelums (0teeoxocta1oate iesls0 2toxr3iu4olen netasf rurxr oo4apxoiietas sDrl(vo;t4trtomr3io1lpD lies t setoir3oy4amenmfes ()srtau pnt4tet ioeiaslm2ranmpn() rtrifciotoptrlues;t)teuo(r no4lptnlfctat aDumx  nt0apxoiieiltls2um( s;u0 reriociy1lat lnes s t2umxmpiu4ape  ietlsfaDtmx o;u4oeto oeias sDul( sn(0artoifcoy1lpDr iei;t)truo(m nu1lm n nesat) rrmur ;o0aex  i3tldfm eau pn(0 etrxo3ootfp   nvilt)tetm(r3iodame  fci (  rta(  oo4opx  feiadfa2emnvpnt0altnxo iytlm eaivo t)srur(mpiudamt  netl() Dtr(rpnt0oeto i3iydlmDrl( ont0tltnmf3io1laDe n i t) rtr(m iudllenmfetltf Drmur ;t4tlxnmfciydfaDuanvsn(4altnir oydlptean o;t0 rxoxm oo4ape mnvi s)aDumu oot4tle  octys s2emn o u0 etrxocoa1lmD lu s s texmimpoudam e iviat)srtax pou4tptomi3iltlmDelu pn() etrxo3iytfpDe neils)s2urxmpio1lpenmnetas  2tmx oot1tetoif3ildla2ran s u) lxnmf iadlm rln o;t)t2uo(rpnu4amte feil( srrmxmpno4optoii3ilsls2el(vp;u)alxoxrctotfatrluvs ( t2xrio3nudllee ici sfsDurum ;t1opxnmocildfa rmuvsn(4tlxomo3oytlmteanei () 2umim no1amen ivil()s2ur(r ou4teeo fctydla raumpnu0alxnxr3iotomtrlnvi (0texoxopoy4lp nmfctas) 2rrxr ;u1oetn fetasfa ulumo;()arxomr iydoaDeaneil(0t2tmxm3oo4lmtnmnet t sDtmu  ot4olenioctydfaDumn p t4 rxnif oydfatrauvol( t2umxrpno4omeemnvsa(f Dum(mo;o0aexn ociydfs eln o t) lxrxo oadfpDe nvi;t0 rtoir3iodam n nct s  rrrxm ot0aexo i3tasfm2rl(mpn(4 rtnxfcoadlm rlueolt)seumxr3nu4omeemncilsf 2rmuronu0tptomo3tltlaDrm(ms;u4aexoir3ia1la  aues;() ruriopiy4omenmivt ()s2rrxm ;o1oetomfetadls eanvo u)tlxnir to1lmDr ivs t) rxoxmpiodop  mfesa(faDtm(mo;o0tpenioctadlmDeauvpnt)alermo3oatom e n o t0seumxo iodapt  nviasfaDurxro;o0opx  i3ilsfm elu o u0 lenir3ta1fpD auesls t2tmir ny4amtnlictl(fartm(rono1tex mo3iltlsDua(ms u)artoir iotoa  li i;t)srtrirpiu4optnmfeilt srtru o;t4tlenmfeiaslm rm(mp t0texomo3oydopD  ies s seuoiopny4optemfvi () rrm(mp;t1apxnifciysfm umump (0 exoxocoy1oa   u slt) eur(opny4lmenmici ()sDtaumpou1oltomiciatla2uauvo u) rxoxo iydomtrlies;( s2xrim oy4lmt mietls  Duaur ;t0aeenmo3tldfa eln p;t)trxnmrciydlpte nvo;(  2tmirpnudamt  fct ( arrm( o;u0aee mi3iyd s uanms;u4 eenif3oa1late nvsls0 rto(r3no1oltnlnet t) rumu ono4tet  i3ildfa rmuvo u4tltrxfctatopte u o;s  rtrxm io1lmenmieias) Dum(mont1aleo ictyt m umnvo () rtnmfcoo1fatr ueil(0 rur(opou1alee iviatf rtrurp;o1ole ii3tat mDel(mp;() eenif3totlpDe nei t) rtm(o nodom emicsat)s2ta(mo;u4tetniieiyd aDem(mpnu0teermr iytoaD livsls0s2umxr nudlme mncsls  Drax  ;t4alt mfctld sDelums t0teeomrcoa1omD au o (0 exrxr3ou1op nmfvtlt)aDrr( oot1aexomiciyt s2eanms;u)alxnxo oo1oat  i i () etoio3ou1lptn net sfaDra( p;u1teenmoeiatfsDea( o;(4altnxfciodopDe uvs s  ruoirpoo4lpte icsltf Dta(rpnu0altomf3ildlm2rl(mo t0treoxfcoydom raivils0t2tr(r3iy4omtn ivtltfa2rmu pot0tltoii3tasfmDrlu o u0 exrirciatfaD  n s;t0seurio ny1ap  lneils srta(m ;t4olenio3iytlaDumuvo t4 rtrif todopDr ueo;()srtr(opoodaltn fetls s2rr(mont0tpxomieiatfsDrm(vo;u4artnmr3tytomDraues ()srurirpiodaptnlicsa() 2ua(mo;t1aptnioetatfmDelu s t0teenmrcia1oa ran s;s) euoxm ou4optelfvta(  rur(r ;u4oltnmietadls uanvo t0alenxr ty1fmt lieo ( t2to(opno4optelicsa( arua(rpoo4oeeo
\ No newline at end of file
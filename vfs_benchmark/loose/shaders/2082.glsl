@@ -0,0 +1 @@
+u i;() rxrxmpiy1al  mneiat) Dtm(mono4opt io3ildfs raump u) rxnir3iadfm rauvs;()seto(m3nodlle lfci () 2rmu ooo0opeo fetlslm emnmo;()alxrxoctodlpDeaueolt0 exoim ou4ol   fetlt) 2rm(rpno4oeto fetld a2ran pnu)tltrxr oytla e u il( trto(o nudlmeelfvs ( a2ra(m nt0oexomoeilsfsDeluvo t)aetoxf tydlptrln i t setrxrpny4lp emfes t  Draum nt1oetoioeiysfsDum( pnu)treoxr oadlp ean olt0 2uoxm3io4lm elnvils) 2trxmo;o1tlt  ociytlm2rauvpnt) exnxo3ty1laDe i i (0srumxm ou1aptnmfeils)s2rmuroou4apx  f3iysls rmu on() eerxrcto1la rlu ils0t2um(m3nydaltnmiei t aDrr(ronu0tpt mi3tls sDulums;u4alxrifciatfpt ln o;s) 2xmimpiydope lies (f rta(m no1tetnmo3tydlm2eau s u0 exriocoadfp  luvsls)srtmim3iodal  miciat) ruru ono1tptn i3ilt a2uan p u4 lxrxr totomDelieil(0 rurxmpiydap n ivslsfsDrmu  oo0teen i3tadfa eaumont4aeeomr3oadoaD lnei;t)t2uoir3nodalenlictls)arrmx o;u4aeto oetltlm2rlnvp;(4aeerioctatlatelnvol(0s2xr(o iydlleemnci t)srrmxmono0apxo oetltfmDumnms;t0aetrmo3oytopDr nvolt srum(o nu4opt miet s)sDtrx ont0tlx moeiysfm2um(vo t4alxnif iy1latrai i;t0s2uriopnu1lmt  nviatfaDrm(  nu1opx  feiytfa2emnvp;u)areriociatlaDrln o;t0teurir iy4apenlieta(f Dum(rpno1teeoifetlsla rlu snt4 exomocio1fat aies s0 etm(r3ou4am  lfvt ()a2um(root1oeeo oeiytfs ranmsn(0teermf3iytoptelu i;t)setmiopou4om e nvsas)a2ur(ro;u4tpx if3tat s rlnvp;(0tleoxf3tytfmt aies;( texr(mpoy4lltnmnvt t srumx oou1aexniiciysla ran p t4tleoif oydlm rlieolt t2um(m3oydapeelfci sfsDrmumo;o4tet iieiatla elu pnt0 ltomf iodlmDe nes;( sruoiopoodome licsat) rumxrpoo1tleo oetasfsDraumpn(0 lerio tydomtr i s;s0srto(r3oo4lp nmfet s aDum(  no4ope  oeils sDemnms t0trxrio tytlate i o;s) 2uoxrpoy4lleemncilt)srrrumpot4tet mieiys sDrmnmp ()artomr iatlmD  uvolt)srxoim3oy1altnmnct (faDtr(rooo1tpxnifcilt s rlnvpnu0 rtomf3iatfm eaivslt t2to(m3oy4lp  mneiasf Drr(mp;o1tetoiietytlm2ra(vs (0areoxociadfpt auvs;s0s2xoxm iodlm nmncsa(f rtax pnu1tltoioctlsfa2um( ont0 etnif totfatraivo t) etoio ou4lptn fetl(fsDua(mpnu4tpeo ieiadlmDelumon(0aeenmf3oytlp e n o t  eurxmpoy4amenmietas) rtaumono4tlxniiciadfmDra( s;t4arermo ootomD  u i;s) rxrxm3iudlmenmivsa( aruaxmpot0texnmietldfa ra(msnu0treomr3totfa eln ils)teuoxr oy4om emnesas)aDua( o;u0tpx moctys a ra(von(0tlenir ty1laDr n slt)s2urimpny1lptnmfei s sDrmu pno1alxomo3tltfaDemuvpnu)texrmr3ta1lpD lueo t)t2urirpny4ll   ici tf 2tm(mo;o0tlto iciadfsDranvs;u)tltnmf3oydfpDraieilt)trxrxmpiu4omtnlfeil()a2ua(mont1tet iieiltla ranmo u0 eeomf3io1late ivs s t2xoxo3oy4lm e fctas  2rr(rp;u0opxnioeiydls uanms (4teeomfcoytlatrlnvsls)sexmxo iodaptemietlt)aDraumooo4tltomi3tytfm2ean s;t4 ltnircoa1op elies;()srto(rpoodom  lnvsl( arua( ono0aleomo3ilsls uln s;(4artriociy1laD aies;()sexoxopou4lmtn feias)s2rrxmpnt0tle ifcias a el(mp;(4aexnir iydlp  lieil(0 etr(mpiudllenlictasf Dtm( onu1alx  f3iltfa2rln pn(0artoir3to1la e n i;( t2xr(mpou1olt lnvil(  Drmuro;u1alxnmieildfs rm(ms;u4arxoxo3todfateli s t srxrimpiu4op nlnvsltfs2rmxrpno1alxoiociltfm ulumont4trxoif to1optrln ilt0trtr(mpnu4op  lfcs ( sDtrumonu0alx mfciytlm um(vp;u0 reomo3todfmtrlies t) 2xr(rpny4opeemnvs ()aDraxmpnu0tpxoifctld m2umnmo u) rtoio oadomDr uesl( trurimpno4aptemneia(f 2uru  ot0apeoioeiys mDea( s t)treomf3ta1fpD an o;()t2xmxm3ny1am   icslt) rrru onu4aeto o3ilsfm em( o ()artnmo3ootlaD luvol( sexoim3ny4lm e ivtltfaDum( pnu1tet mf3iltlm2eauvo;(4 reomr oydop  aueolt)tetmxo nodome  fctat)sDtau pot0openii3iadlm rlnmo;t0aexrmr iydopD luvi;t seumxm no1ap e nesls a2uaxrp;o0tlxo fcils a2umnvsnu0arxnxf iotop ran olt0seumxr3nodapeelneil( arraxmoot1alen i3tldfmDran sn() lenmr oo1fmDrlivil() rur(m ny1ale lnct tf rra( pno4ope  feiatfaDelnms t4artoio3tydfmDeaueilt)trxo(m3nu4lptn ivtltfaDtmx ont4tetnmociltfs ea(msnu)alermf oy1oa eauvsl(0srxr(o ny1amt mnvsl(fsrua(  nu1teto o3tasfsDrluvonu0 reomo oo1fm eli ils0 rurxr iudap e fvtl() rrrxmono4tptomiciasls2ua(mo ()aetnmr3iytlmt livi (  2tm(r nydole  neta( aDrru pnt0ope ifctldla2rln snt) lxoifcto1omDrlnvo;(0srtmxm3nydopt lieilt) 2rau o;u4opxomf3iadfs2ul(ms;u4alenmo ty1fat lnes;s)tetoim3iudllenmncsls)s2raurpnt0alt mf3tytfs ea(mo u) lerxociatfm   ueo t)t2uoxrpiydlmtemicsl( artr(mooo1oltoio3iytfa2rmn s t)trxomo iotlm elneo;t0 etriopoy1lme  iet (fsDuru pnt0oexnmfetasla2umumonu0tlxnir3iadfa eaneo ( srto(o oudllt lfvtltfa2tr( pno4apxn octyt mDeaumo;u4 eerif to1lm rau s;t)trtrir3iy1lm  micils)a2tm( p;u0ale mfciysfaDrl(vs t4areoiociytlaD  uvol(  2urxm3oodlltnlfvsasfaDrmu  ou0aetomoeiyd m2eaump;t)altomf3ia1omDr ieo;t0 rxrir oo1lm  lnci s)srur(ronu0ape  octls sDrm(msn(4trtnxfcty1oa e uvs;s t2xo(m no1aleelnvt t s2rrxrp;t0alto octltfm ea( s;t)arxnmr ta1om elnvs;t seurxo ny4lpen fcs tf 2raxr ou4tpen i3tasfa2eauvonu4 lxniociadlpDeauei;(0srurxrpoo1opee fet s srrr(rpnt0texo icild s uanvs;t4 etniociodlaDrlu slt) etr(r oydope lnetl() rumxmpot4olxnifeiyt m2el( o;(4trtrxr iy1lmt an s;s)teumim3ny1lmenmicias  2ta(root4tlx iocias s emu o u0 ltomr tytfa eaueo;( srto(m3iydll  mfctl(f 2rax o;o0ale  f3iydfmDea(von(4 reomociodopteaues ()srurim oy1llte ivi ()a2ra(mp;u0apenmfcilt m2uaums t0tltnxr3ootfm e ieo;t0 rxrxopou1ll   fet ( sDuaurpnu1texn fciys sDrl( o;t4 rtnio oy1lat  uvs;(0s2tmirpno1lptn ieil(f Duax poo1aexn iciyt a2rmnvsnt4altoxfctytoa e nvsl(0 2uo(mpno4al elict ( s2urum nu4tptomo3ilsfs2ua(vo;t) eenir oo1omt ai o t)sexr(o iu1al   fctltfsruaumoou0aptnif3tadfm2um( pn(0 eenxf to1oa r uvs;s srxm(m3iu4omen nvs ( aDtr(m ;u4tpt  fctlsfm2eanvo ()tlxomocoy1fmDrlu il(0 rtmxmpno1lm n fcsl(  rtr(r ot1oex mo3tyslsDuauvo;t) ltnif3oatfptr ueol(0srumio3iy4olenmieia()s2taump;o0aleoii3tysfs2rmnmp (4 etnmfctytfmt livil() 2toxrpiudale mfvtl() 2ur(mo;t0tlxn fctat m uauvp;u0trtomo3tytlm rlu i;s0trxoim3iu1lp e fvsl()a2rr(monu1aexn fcilsfsDel(msnu)tltnmfctadlptraueolt)seumir3iu4am   ncias  Dtruro;o1ole if3iasfmDuanvsnu0 renmocoydlm ean o;()t2urirpoy4alt  nvtlt sDumxrono4oee iocilsfm2rlu onu0arxnmo oy1lmte nvi t0trtm(m3iodlme  nesatf ruaxm ou4apx mocilt a2rlnvont)tetnxo3ty1lmt aivi;t s2um(r3ny1opeelivsas)arurur ;u4apxomfetad s rau p u) ltrxo iadoaDeli i;(0seum(o no4ope mncsls) rua(  ;u0apt  o3iys s rmuvp;u0aexrmf oatom r u ils  ruoiopiu1llt lieil(faDrmxro;t1apeniictysla uaump t4 reoif iotomte nvi;s0 exmxr io1lltnlfeslsf Dta(mpot4oeen f3iytfmDel(vp u4artnxfctadfmD  uvol( s2to(m3ny4olenlnvilt) rum(m nt0opx ifetytlmDrmn p t4texomf3oa1laD luvs;( t2tm(rpnodomtelncia( s2umu  ot4olx mictys a uan p;t4 rtnxr3ta1oaDe neslt t2tr(rpny1om emfeils a2umx  ;o1oltoiociadla2el(vonu) lxnif3oytlpDrlivsl()s2uo(m iy1al n feiatfarrm(  ot0oexnmfctlslsDuluvon(0aetnmo todlmD lnes t)sruoiopny4amen ncslt  Dtru pot1tpx iociytls emn snu0trermo3iydfmD luvs ()srumir nodop   neils)aDraurpot4opxo oetlslaDumums u)tleoxf3tatoat aivs;s  rxrim oy1omtnlicsat  rrmxm ;o4olxomieilsfa2umnvp (4 eerxf tatomDeli o s0 rxm(r3no4omee neia(fsrtrxmp;o4tex mfciatlm em(vo ()trxomrcoa1lpteaieolt) etoiopny1lm emfcias  2taur no0ape  i3tydlsDeanmonu4trtnif3ootfaDrlieo (0 etm(opny1aptnlicslt  rrmxmonu1oetn fctls s em( p;t)trerxo oa1op eaiesls truoim oo4lm e feiat)sDrr(mpou0tex ifciyt s2ran on(4alxomo3oa1fatr uvi s)tetmxr3nodope  neilsf rrrumonu1tpeoioeiys m2eanmo;()texnxf oatlatelnvilt0trxmiopoudop  mnetl(fs2umxmooo4alxn ocilt m uanmo ()artomf3oo1omDeanvo s tetrxo iy1lpenmici t)sDur(r ;u4teeomfctlt m2uau sn(0 etomfciy1lm  au s ( t2xr(r3nudomt lnvias)sDta(moou0aptnmictasfa rmuvs;u)trxoxr3ootomt  ieo ( setm(r3no1olenlfcta(fs2uaxmono0texn icias aDrln s t0artnxf oy1laDeai o;( tetmiopno1ale lnvsl( arrmu oou1teeomietlslmDrlnmp u4arxoxf iydopteanvo ()srto(m3nodllt  ict t)srurumo;u4oeto f3ilsfm2rm(mpnt)aexomrcoadlaD an i;t  rtm(opnu1am   ivsl( arrr( ont0texniictyt m2uanmpnu0aexrmr oa1fm eli o (0tetm(mpou1opeemfvt tf Dtm(m ou4apenmoeiasfa2uanmp () lxrxfciydfmDraieols0t2uo(o iu1ol  liet t  2umur no4ope mfeils s2ra( pnt4teeomf3to1opt li s;( s2tmir3nudlptelfeia( sDrm( ont4tlen i3iadla2ua(vp (4 lenxr3oytlmt lnei;s)sruo(m iydaptnlnvt s  rtauro;u0apxn i3tasla2ul(vp;u4 ltrmocty1lpDelu s;(  etrir3oy4ol elneiatf rumxmpou1aexo fcilsls eanvs t0 rxrmrciatfa ran o t s2tr(o3iu4ll elnvs (f Dur(mpnu1opxnmf3tas a2el(monu0trxnif3ootfmte uvi;s trtmxm3no1ape mfctas)s2ra(m ou4tle  fetadfs rlumpn()tltnmocoytlaDrluvsl()t2xmxr3oy4ll elnet (f 2umx pot1oetnmf3taslm2emu onu)tltnioctotlpDeau ils)sexm(r no4amte feilt  2tm(ront1olxnmfetadlm2ul(mo;u)aeerxr totfmDr n i;(0tetm(o3oydaptnmiesltfs2um(mpnu0apx if3iad sDemn s ()altrmr iadfpt  i sl( seuo(m3oudolenlnci ()srrax  oo4oee  ieiysfm rl(msnu)tetoir3tadfp e i sls  rtmir nudole lfvs t  Draxrpno1alxo ieiltls2emnmpnt)arenmf oadfmt  nesls tetm(r3nydapte ieil(  Dtmxmo;t4tpe  ietadfs2ea( o;t) ltnir iytfmDe ieslt  rurxrpiy4omte neils a2rr( o;t1texnio3iytfsDrmums;(4altnmr oodoa r n o;t  rtmxo nydolen ncsl(farurumooo0texo ieiydla2emuvs t0 etnircoa1oa  aneils0 2um(o nu4amt  nvsas) rtrxrpot1olxoiietydfa emnmp u0texoioctodoa rauvslt s2urxopnydllte fvsa( a2rm(mo;u4apeniiciaslm rlu o ()trxoxr3iytlmteanvil()t2um(m3iydome lfes s a2uaurp;o0tptomoeiyslaDrlnms;u4 lxrir iy1oaDr nvols srxrxo3iudopeemfctls) 2tmumont4aexoiiciyd m rm(vp;u)tetoxrctotfm ranvi t)s2xmxopoo1lp n iviatfaDurx p;o0oleoiictytfsDrl(vsn()trenif3ia1op eanvi s0seuoio3no4ap   ivt ()aDtrxmpou4oee ifciat s em( p;t) exrxo3oatfat luei;( s2toxm3iydllte fetlt)srumxroot1aptnifeiadfmDrlnvo (4 rxrmo3oydlpte ieo s) 2tr(r3oy4amen fcsatf Dra(ront1olt miciytfs2emnmp;u)tltnircoa1lp eanvs s0truoirpoo4lltn ncias)s2rm(ronu4alxo o3ild aDrlnvp t4aetomf3io1lm e neo t t2to(r3iy4omte nvsls  Drmu  ot1optn ietyd a el(mp;() renir3io1fpt  n s;t  rxo(o3io4ol emnvsat)artmx ono1alxomfetadfs2ranvo;t0trxoxociatla eai s;s  2xrxo oodal nliesls)s2rrx oot0tpxo f3ils aDea(mo;()areomo iatoatelueil(  exoim3iudlp elnvtas)artaumo;u0tle iociyd s2ulnvp (4trermr oatfm   u ols) eurxm3iudop nlnvt t s2trxr ot1teeoifeias s2uln o;t4arxnioctodomDe ueil(0 rurxr oodopt mictasfsrumu o;t4opeoiieiad aDuau pnu)tltomf iy1fpDrauvolt  2trirpno4lptelnesl(fsDur(rooo4oet micild m uauvont)teenmr io1optelivi s) rumxo3iudlmen fet t arta(mp;t4alxnifeiatls2emnms;t0aexnxo3tytfptrluei;(0s2triopoo4apte fvia(fa2uaur ;o4opxoioetasla umnmp u4 rtomo3iatopD li s (0 2xmxmpiu1alte ici s)artaurpnu4aee moctat sDua(mp;u4trxomoctatlmteauesl(  ruoio oy1oleelfvtls)arraurp;o4aex mf3iatla rmu o t)trxrirciatfp e u s;s0 2trxm oudaltn ivt tfs2umxmoou1oet iicilsla ulump;u0 leomociy1omtrlieols s2xrim3no1oleelfvi t arta( pou4tlto o3ildfm ulu s t) etnxf tytlm  anei;(0teum(r3iydop  mictls)s2um(mo;o1altn ocild a2rmu on(0areomr3tatfaDeauvs t)t2umir3oo4omenlfes t s2ur(rp;o0ole iieiatfmDra(ms (4arxrir iotoaD livi t0tetoirpoo1llee fcias)arum(r no0altomociydfsDua(mpnu0 etrir oa1fp   u s;s t2tm(m3oodalenlncia()srtrx  no1alxnmf3tyt m2emu snt4alenmocta1oa rlnvi ()s2toxm nodal nlfei (  rtaur ou1tpe mf3iyd aDumnmpnt0alenir3oodlp ranvo s s2xmio3iydlmeemneia(  Dumx  ou0oexnioeiyt s2rlu o t0 exomr3tatla rln ilt0 2umio nu4alenlfeslt)aDraxm ou1tpxn fciltfa rmnvo;(4 etrircoydopDeaieo (0srurxm iu4lmtnlfvtl(fs2uaur oo4optnmf3tyt m2em(vs (4 etrxo3oatlp e ivs ()srtrxr nydapeemfci s) 2tau  no4aee  ocild s emn o;u0 rxoxo to1omte neo t0 2trio3ny1op emnvtatfaDumx poo1tpen f3ildla2el( sn(0 lermf3oy1fp   i s;(0srxmio3oodamte fetlsfarrmx p;o0texoii3iasfm2ua( on(4arerio3ootfa rlivo;(0seum(o3oy4ole mncils aDtmxro;u4teeo ocild mDrmn o;t) reoif oytlateluvo () 2xmxm iu1apeemncs s s2um(m oo0tet miciad s2rm( onu4 exoxrcoatop r nvilt0s2trxm3iudaptn iesatfsrtaxrpno1oltomociadlaDua( s t0arxoxr3tytom  aivi s t2xm(r oo1lmtelict ()a2raumpou4apt  i3tysfsDemnmo;t0areoir ootomtr ueo;(  ruoim iy4op nlictas)aDtmxr ot0tetn iciltla ulnmsn()altnmoctodfaDrlivols tetrirpiydoptemnvsat) Duru  ;u1tlenioctasfa rln on()trxoir oydfpt  neilt  rxo(r iy4aptnmnvi tfarrmxm no4tlx iieiadfaDumuvon(4teenxrciy1oateaueslt0s2urxr3oy4om nlfcsas s2uaxmono0apt  feildls rlnvp;u)arxnxfctadlp r n o t0s2uoxmpio4lp emieslt  Drru p;o1tex mi3tys aDulumo;t0alxomf oadoaDe nvsls s2xr(o iu4lpt mics t arumu pnt0apxniiciyt mDem(vsnt)artoxocoydfaD au o t  rxmxrpoo4ol nmfctatfs2um( p;u0ole  oeiad s2ra(mo (4tlenif3oodfmD aieol( t2um(r3nydlm emicsa(fs2ra( pot4tptoioeiltla rauvp;(0aexoif3tatfa rlu ol()srxoxm no4olt lfcia(  Dtrx  oo1open i3tld a ul( p;u0tetnmrctadop rai s;()srumio3iudoptemfcsas  Dtm(rooo1tlt ifeildla emumo u) rxnmr3oydop  ai ils texoir oudome  icslt sDtm( ont4olxoiietyslm uln p;t) rtrxo todfmtelnvils) 2umxopio1lme  ivsl()sDraumont1tle ioetadlm2em(mp;u0alxrir3oytfp  aies t srxmxo oodlme mfet ( srrm( oot1olt mfcias a ulu onu4 exrxf tytopt lieo t s2xm(rpoy4amt mnesat)arraxmpnt1aetnii3iltls2emuvs t0 rxoif totomtrlu i;s0sexr(m ny4amenmnvtls  Draxmpou4oet  o3iydla2rmums;t) lenir ty1lpDrai i t)teuoxrpio4am nmicsat) 2ra(rpnt0texomfctat sDrm(ms u4arxomf3oy1op eli sls)tetrir3oodlpeemivilt)arrru  ;o1tptomo3tytlmDra( ont0 exrif3tydlmteau ils)teuoirpnudlpe mfvs sf Dum(  nt4tpt mi3tlt a uan pnu)aeenir3totlptrln o;s srxrxo3nodome lfetl(  2rrx pnu0olt ioeiytlsDemu p;u0 exnmocta1fmt  uvslt s2xmxrpou4lm   ivsl(  rururo;u1texn octadlm2em( snt)aetoxr oodfaDe uvi s)sexm(m3oo1al   fesa(fsrtrurpot4opeo ocils m2ra( snu4 lenxfcoodfaDeauvs t)texrim3nudal n nvt tfarumurono4olen ociys m raumo;u4arxnxf3iodfa e uvilt0 2trirpno1oleelnvi s)sDumur ou1aexomi3iytfa uan p t0aeeomr3ootfpDelu i t0 2xoxo3io1lle lnct s)artrxr no0aetnmo3ils a emuvs t4 rxrxr oydfm rlneo;t sexrim ny1amtn neiatf rrruro;o0aleomiciyd aDeaumpnt0teenmo3oo1omt lnvi;() euo(mpnu1ap  lnctltfaDrmur no4tpenmf3iad s2raums;(0arenmf tydlmD anei;(0trxo(r iodole lfvslt  Drr(r ot4openiiciysfa2eanvpnt4artoxr3tydfpD  u sl() etrxr iu4ome lfvil(  rrau  nt4tlt mf3iyslsDelumo (0trenmr3tadop e ivil(0t2tr(o3iu1om   ivtl()arumxr ot0aet  oeiyd mDraump;() renxfciodlmtraieolt)tetm(o3oy1open nctl()s2rrumo;u1teenmoeiytfa2eau s ()tltomfciotoaDr ues;(  2uoxo ny4lp emnctlt)aDtaumoot4apt micildlsDea(vs;t)aexrxf todomD aivs;t)t2xrim ny4ole mict ( arta(monu4aleomo3tltlm2um( snt0aeenxociotopt  ieo t texrxrpiy4opt lneta(  rra( o;t1ape  ieiysla2rln s;() lxnxo3tatfmt  nvil( texr(r3oy4amt lfvt sf rtmur no4opeomi3tls s2umump u0trenioctydlmDrlnes s teumio oo1omt mivs tfaDrrxr ;u4teeoif3tasls2rmuvs t0tltrmf3iotlat lnei t seurio3ny4lp emivias)a2urxro;t4tptniieildfa eanmsn() eerxociadla e u o;(0s2xmiopiu4ol n ivil() rra(r no0tpxo i3iyt a2ul(mp;(4 lxrif oatomD  u sls0setoxmpoodlltemicta()s2ua(rpnt0aex  feiadfm ul( p;u0teeomf iydfmt  uvilt0 2xmxr3iu1ap  lfei s) rtaurpot4tle iietatfm2eau o u)trxnmr oy1lpDeluei t0t2xrio iy1omtelnct ( sDrm(mp;u1oeenif3tytfsDemu o t0 ltnxr3oatlatrlivols0 2umxo3nudlmt mfesls) 2urxrpou0apx ifctls s rmu o;(0areoircto1fmtelivi t0 2xoimpiudllenmfvi ()s2tau p;o1alenioctyt a rmn snu)trenxr oytlpt  i sl()srtrir3ou1op n fet s aDrau  no1apxnifetlsfs ulnvpnt) rxomr ty1omDelueil()s2umimpoy1olee neilt arur(r nu1aet mieiydfa2rm(mont) ltrif io1la  lnes;t0 etmxr3iy1am  livslt  2taxr ou0oltnmf3iadla2uauvsnu)alenircoatfpteaues;t)setmxm ou1ap n fvsltf rurxm ;o4tpxoiocias sDel( p t) rxrmrciadlmt  ivsl()trxr(mpiydlm nmictltf Dtmx pno1tee  octldfmDrmn p (4tlxomocoo1op ranvils)t2uo(m nodlmeelnviasfaDrau oot4tpe  fciat a rmnmo t)aexnxf oo1lpt liesls trtoxr nydapenlivta(fsDrm( pno4open icilslaDeanvo t0aetrmr3oadfp rlivol()setriopio1omee fciat)s2rmurono0aet io3iatlmDuauvonu) etnir iodfmDraivol(0t2xrxrpno1ap nmict ()a2truroot1alto ietat s2emuvp t)tetrxr oodlp eai i (0t2uo(mpnu1optelnct sfaDtaur ;t4tex iieiasfs2eauvs;u)tltoif iotlptr ies ( texrir no1llt  fvsas arrrx  oo0apen i3tyt s uln s;u0trxnxf tatfm elu s;( teuoxm3nodom n ies t)a2rmxmo;o0tpxomociatfmDrauvs t)tetnio iytlmDelies;() euoio3ny4omeemnvs ()sDrrxmp;o1alx mi3iytlmDum(vpn()tetnmo iy1fate iei t  rxrirpno1ale  nci s artr(rpno4tee  octys m2rm( ont4 lxrxr ia1omtean o t) 2xr(o3oo1lmt lfvias  Drmump;t4opt  oeiydls2em(ms ()alxrmf ia1oaDelivo s)t2xr(opoo4omeemics tfsrta( o;o0apxnmfeilsfm rl(vonu0 exrir3oadoa eaivs ()truoxr3oy1lpenmnetltfsrrax  nt4tlt  oetydla ea(mp;t0tetrmo ty1fmDrli o;s)s2toxo3nydop  liviat  rraxr ;u1tetnmiciad a umn p;(0 lerxf3ootlmtr nvils) rto(rpiy1apt lfcsasf rtrumo;o4aetniociltfs ua(mp;u0 rtoxfcoytfat lneo s  rtr(o3io4ale mncs sf rua(  nt4tex  iciytls2rlnvo;(0tlxnmocoa1fpte nvil( t2tmio iy1altelfeil()arururont4alenifetytla2eauvo;()alerxrcto1oaDraneolt)srtrir nudlmee net t) Draxroou4aet mfeiatfs emums;t0arxrio todlm e ivs s s2xr(r ny4llt mnetlt  ruaxmont0optnmo3tad sDran p;t0tlxoir3tadopt  uvs;t0trurir oo4al nmncilsf 2uaur nt0opt miciadfs2ul( p ()aexrxf3oodopteli sl(0s2xm(mpnu1amee icta(f 2rr(r nt0apx iieilt m emnvp;(0aeeoif3ia1fmDelies;s) rxrir nydlptn iesatf rrmu o;t0tlt mi3iasls ulnmp (4 rxnmfctatla  liei s0srxo(o oudlp n ivtl()a2umxrpnu4tlenmf3ilsfaDran snu4 ltnxf iotfmDrlies;s0 2tr(opoy4ll e nci s sDraxrpoo4ope if3iys sDumn p;u0artrio3oy1optelu ilt)trtmio3oudolt livsat)sDuaur oo4texoif3iyt sDul(vp u0aeenio ia1la rauvs ()s2xo(opnu4altn iet sfsDta(rpnt0ape if3ilsfm2raums ()aetrxo oodoaDelueol(0trto(o oudopenlfcs sfaDtm(ro;u4apeoii3iaslmDumnvpnt0aetnir3iodoat  u sl(0sruoxo oudlm elfvsasfarumu  no4tpxo feiad a2ulumo;(4 leomrcoatoaDrlueslt teum(m3iydolt lfci ( a2ua(rpnt0apt mo3ils m rm(msnu0 exoif tadlmt an s;s teurxm ou1ll e nvsat a2taumo;u0aptomf3tyslsDrau s;t0 lxoxo3to1fm eau o s0 2umxmpiy4lm   neiasfsrtaurpnt0tpeoif3iys aDelu o;u4trtrxf ootop e nvi;(0seumio3no4ope  nvil()arrax ont4oexnii3tltfa ea( p;u4trxrmocoa1fmtrau o;t setrirpiydome mnet sf rra(ro;t4teenioeildfa2uanvo t)artomr3tytom rlu o t)s2xmxm nudale lfvil( aDtr(m no0olto ictas m rm(vsnt) lxnxo3oatlp eanvi;s0setm(rpoy4alenlnetl(fs2trx oou0oeeoioeilt s ra(vo;(0tlenxo oo1fp  aueo;s0t2xrxo3io4ome lictas) Draumooo4tlxn iciydfa rl( s;t) exrxociydoa  lnvslt0srxrir3io1lp e fesa( a2ra(r ou4aee iietytlm ul( o t0tltoio3oy1lpDraivi;t  rxrxopny1am elncs t  2rrxro;u4aleo ietat sDumnvs;t0tlxrmf3totlmDran i;s  rumirpnu4llenmnvtatfsDta(mpou4oeenioetasfa rmu p t4 lerxf totfmDrlu s (0srtr(rpou1optemivtl(fartaxrpno1teeoiociysfsDeanvonu4tetnxo to1laDe nes;( teumxr iu4omeemncsa(farrm( pnt0tptnmoeiydfa2elump;t)arerif to1fp rluvi s0 rxrxrpno1alt  net () Dtax  nt1apxoio3ild s2ranvo;t0 rerxo3iodfaD lu s t)truoxrpiy1ol  lnvia( a2trxr nu1aee mf3ils s rmn s t0tltnif3oadlpD liei;s0texmimpoodam nmicilsfartmurpot1oet mo3iasfaDra(vp;u0trerxr3iytfat  ies ( texrxm3oodll n feiatfa2ta(m ;u0aetn i3ias s rln o;u4treoiocoodlp elueol()t2xr(rpiy1lp elieils  rtru o;u4tpe mo3iyd a2emu sn(0aexnmr3totlpteauei t) 2umim io1ape livil( srraumpno4apxnmieilt mDrlump (4 rermr3tytfp r n ilt tetm(o3no1alt  nei tf rrax o;o4opx ioctas m2elnvs u0 lxomrcoy1fmDraivi ( teur(rpnodlpt lneils artaumo;u1oex ii3iyd s ranmp;(4trtnmo3iodfpt ai slt) 2uoir iodlmenmfciasfaDrau  ;t4tlxnifcilsla2um( pnu4aexrir io1fmte nvs;( teumir ou1am  lnet (f 2tau ont1texniiciltfa rmnms u0 rxrxr3to1fp rlivil()sruo(o oo4lpen iet s s2ta( oot0apxnmiciydlmDel( pnt4altrmrcoytlpteaueolt0 2urxopnu1oltnlicsltfa2urxmonu0oltnii3ils sDuan p;u4 exnif3io1lat  u s;() 2ur(m3no4altnlnvsls)arrr(ro;u0altn i3ildlm2ul(vpnu0tltnir tadomD au i t)teur(o iy4alen fct (f rua(rono4texn fctltfsDrl( s (0tltrxf3oatomtraneols) etoimpiu1amtemfes tfaDrmxr ou1aee ioeiytfs2eauvp;u0tltnmf3tatfmDe nesls0trxo(r oudllee ics ()s2urumo;u4oleoiicilsla2em(mpnt)tlenxo tytlaD lu o;s0 rxo(m3ny1lpte ics ( arrm( ont1tlt  oetatfs ulnvp;t4 etoir3ty1lpDeau ol()srxm(r3oo1om   nei s a2ra(rp;t1opt moeildfm2ua(ms u0 ltrmf ta1oa e i ilt0s2trio3iodlmt  fvs (f rtrumpnt4aex mf3iasla2rm( o;()tlermo oodfmD  nvo;( s2tmir3ou1apenlfvias)a2urxroou0tpt iociyslsDumnvs;u) exrxo3tatop eaueo s0 etrxr3iy4ll n fei t)a2tmu o;o0oexnifcilsfa ea( p ()arxrxo oydopDelieolt sexr(m oydaltemfctl(f Dur(  ;o0olx  fciydfm2uanvo;(4 lerif3ia1faD lues t s2tr(o3iudalt lfeia(fa2trurp;o4aleo fciyt a2ulnvp t4aexrir3oydlmDrli o;t setoxo iudap elici t) Dum(m ;o1oleomo3tytfa2emnmo ()texnmfcoytoaDeaieil(0 rxrio nudamtemnvtlt)srtmx ono0apxo fetys m umnvont) eeoxfcio1lmte u o;()tetm(mpiu1amenlicsas s2tm( p;t0tltnioeilsfa um(vo u)trtrxr3todomte nvil(  rxmim nodll elivtl()sDtmxr oo4ope moeiydfm2el( o;t)trxrmr iodfpte neilt0 rxm(opnydapen nvia() 2rm(mpnu4apxnii3iatlmDran s;t4aexrif oatfmt aiei t) 2umirpou4am nmnciasfartmu oou0alx mi3tadlsDem(vp;()treoxo3iy1fpD lies t texr(opnu4lme mfcs ()sDur( pno4tet mictatlm emuvo;u0 exnir3totoptr ivs s0 2tm(rpiodlp e ivtls)sDtmur nu0tltniieiat aDrm(mp (4 lxnxf ia1la  lu ols0texrxopoo1lptemivi t srumurpno0optoio3tasla rmumo u) leoir3tytfpD anes;t)t2xrio no1lmtn ivs s)a2rax pnt0tet ifeiaslm em(mp;(0 rtnif3to1opDeaieo s)teuoxm3no1lp e icsl(faDrm(mpnu4oleo oeiatfs2el( p;u4areoxocta1omtr ieol()srtmxm no1lm nmncs t) 2trxm nu4alx mi3iytlsDean s;t) rtnif totoaD  i s t) rxoxm3iydlmee ictlt sDtmu  ;u4texomiciat m el( ont)tetnmo3iodfate ivil( srurxmpoy4lptemneil(fa2tmuro;t0olto f3tyt sDrlumo;t)tlxoif oy1om raueol( s2tm(o oydale mieiasfsrtmxro;o4apxomi3iadls el(vpn(4trxomfctodlmt  u sl( t2trxmpoo4openlncia()arrax o;o0tptoio3ilsfaDrmn s;u0aeerir oydomDeanvo;s)s2tm(r oudamt livias srrmxmono0oeeomictysls elnms;(4 rxoio3iotlaD aiesl(0tetmio ou1lleelfvtas  2rmump;o0apeoifcilsla2eauvp;u0altnircoytlpD ai ols0 ruo(rpnodlme lnctls  2um(mono4oexo o3ildfmDem( pnt0aexomr3ty1fp elu o ( trurxm oudlmtnliesl() Drmum ;t1tleomfcildlsDrauvo u)tlxnif iotfpDrlneo;()s2umir iudoltn ieta()a2ua(m ;u4tex mfeiadfa eanmon(4tetrxociadomDe ieo;t)truoxo3iy1ap  lnesas  2uaxm ;u1oeenmiciyslaDulump;(0treomrctadlpD aneols0seuo(rpou4ome mietlt  Drmx  ou1tpen oeiad sDelnms u0 etnmf3oadlp eau o;()trurir iodlpe lnvtl(fsrrm(rooo4tpeomicilsls2el(ms (4tltoirctodomt  ueo t) 2urxo3nu4lltnmfcs (  rtmumpnt0aex  ieiadla2ulu s t4teenxfctytoate ivo;s) 2umxopnydope  neta(  rraxm ;u1tltomiciysfmDuanmp;u0trerif3iatla  lnvsl( seum(opio4ol emfeia(  Dtrx  nt4texo ocildfs ra(vp;t)artoxr3tytlptelnvs;t)t2uoimpoy1alte nvsas)aDuaxm nt1texniietasfaDrl( s u)tetrmrcta1om r n o t)trxo(m oudaltn nct sf Dta(rono1alx  ietyd s ean p;u4tetrmf3tadlm rau sls0setm(m iodll   nvi ( a2raxm nt0tpx mi3iysfs rm(mp;(4tetoxf tadlm e n olt)texo(o nudopenlfci t aDtaxmo;t0texnmo3tas a2um( s;u0 ltnmfctadfmDr neslt)t2uoxr ou4lpt mivsa( aDraurp;u1opx moetlsls2rl( pn(4 lxnxf oatla rai i;s0srtm(r3oodaltemfvslt)artrum ;o0tetn ieiltfa um(mpnt0 ltrxf to1oaD  neil()t2tmimpny1alte fcs sfa2tmx p;t0opt iictlslm eluvp (4areoxrcoydfa raivo t0 rtm(o3iu4llee fetasfsDumx o;u0tlxomfeias s uluvp;t0arxriocio1laDe ieo t t2xoxmpny1apte ieilt) 2taum ot4tlx  fciltlm2ua( onu4 lermo3tytop elnvs (0trumxo iudllenlnct s)a2rrurpou4alx  i3tlslaDel(vo () exnmociydoatran o;s0 etrxmpny4ap   ivias)srtaumo;o0alxomfciyslm2emnms u0teenxo3ty1la   ies s) etm(o no4opt  fctasfarrrxmonu0olxn iciadla2rm( snu0aleomf to1lpt anes;( srxoxr3oy1ope  ivsl( srumuro;u4aetnmiciydla umn p t) eerirctadfate nvo;(0tetoxmpnu4llenlfes (f 2rau  nu1apx iicias m2eluvs;t0 etnio3oydlmteluvils teur(o oo4lme liesat)s2taxrpou0texnioeiatls ua(mont4trxoir to1fm e u ils srurxmpnydlptemivta()sDta(m ;t4oee mo3tlsfaDemn o;u4 lerxr3ia1fa rlu o (0 euo(m oo1aptemfcsatfsDuaxrp;u0tpe  f3iad aDrluvsnt4aleniociodfmDrlu sl()teurir3oo1aleemfetlsfsrtrum ;o0teenmoeiysla2uau pnu)trxrxf3oo1lm e i i;s0t2umxr3iydope mnei sfa2umum no0olxomietlt m2elnvp;t4 ltnxr iotla eanesls0 2umxr iodoptnmict tf Dtr(mono1opt mi3tytfs2umnvo;t)arenif tydfm e nei (0trtmio nydlmenlnei (farraxmp;u1tlt ifctlsfa uluvp;u4 ltrio iotoa  lnes;(0sruo(o3oo1omtnmfciat srur(m ;t0tlt  oeiadlm2rmu pn(0alxrxf3oytlpt lnes t sruoio nu4lpenlfeslt sDtmxmpot1aexnmictysfm2elu p (0 rtnif to1lateaiesls trto(rpiu1llt livt sfsDur(  nt0aet  o3tat m uanvs;(4trtrmr3tydfa  lnvo s0setoxm iudom emivs sfsDtmxroou4apt mi3iltfaDulums (4aeerxf3to1fmte nvslt teurimpnodolte nvtasfarumxmo;u1tpto i3ildlaDrl(vsnu)aexoxr3oydfmDelivi;(  exmimpny4om elicsasfs2trur ;t0texoio3iltla el(ms;(0tltnmo3oadla   uvi t0 rtoir3nudll  lnctlt)sDtm(r ou1oeen iciat aDulumpn(0aexnxo3oa1fa   i s;(0s2xrxm3oy4op  liesa( arrrx  ot1aetomi3ils m2rlu o;t0aetoxrciotom e neils)setr(opnydlpee fvilsfarrm(r ;o4oeto iciydlm2uaums () rtnmr3to1lmte uvilt t2to(mpiy4op n ietl(fsDtau o;u4opxo iciyd m2eluvs;(4arxoxocoadfaDr uvols0 euo(m3oydomt mncslt srumurono0alenif3tydfm2ea(vsnu0aetnxr ootfat  ivo t  2xmxopio1al   fctat arraurooo1tetoioeiys s eanmp t) lxoxrcoatfmt li i ()trxmxo3nu1op e ivils  rta( pou4aeen ociadlmDrln o;t) reomrcootomDelnvo ()t2xmir oo1amtelfvs (  rtmxrooo4aexoii3tyslm rmu s;t4aleoxf oo1opDelu i;s)s2urxo3io4apte net t)s2rm(rpno1tpen feilsls ul( s;(0 reoircto1oatrau i ( setmirpoy1olt  nvs t)aDrrumo;u1apen iciydfs rauvont4trtnxr ia1lp rlueo;(0 2xmir nudlp nlneil(f rra(mpoo4tlen ociatlm2ul(mpn(4arermo iodlmt  nvil(0s2triopno4lpe lnesltf Dtmx p;u4apxn ieildlsDra(vsn(0aeeoir3todomD  i o;s)srxmimpnodal e fesa(  Draxrp;u4apt mo3iltfm2ulnmo u)texnifciadomDrlivilt)t2uoxmpnudopee neiasfaDraur ou4aexo oetld mDem( s;(4tlxrmfcootom rlu o;(0 2trio3io4lleelfcsl() rum(mp;o4teeniieiasfa ul( snt4 rxrif iy1la ranvols)srtoxo3nu4amtemneta(fs2urxm ;o0tpt ii3iysfaDeau pnt4aetnif3iytlmDeaivs;t trxo(r ny1op n nesas)aDtrxr no1tlt  oetlslmDemuvp;(4tlxomociytoptrlivo;()tetoxr3oo4lpe lncil() 2uax ono1oetoio3iatla rmnvs t4tetniocoatfa elnvo;s)s2xoim3oo1lptemfesa(f rtaurooo4oee io3tlt sDul(msn()tlxnxf3totlat luvsls) 2umirpnu4openlieil()a2rrxm ;o4oet iiciydls emu o u0aeerxfciotomt luvo;s)trxmim3nu4al  mnci ( aDrau oot1aetnio3ias s2rmnms;(4tetrifcty1omDraueo (0truoxopoudlp emnesas) Dtaxmoou0oltn feilsls eanms;t4tlxrio3ta1fa r i ols trtmxr3nu1ale mfcsl() Drauro;t4tlxo ieiydla ul(mo () etrir3tatlaD  nvsl()s2xm(r3ou1lp nmnvilt a2taum ou0aetn i3iydfsDumnvp;(4 eerio3io1fmDran i (0 eum(o iu1lmtnlfvsltf Dta(r ou0tlx  fciltlaDuluvont)alxoxo iadlmD  i i t trtoio io1lmt  fciasf Dtaxronu1tetn iciytls ranvonu4 exoxfcoadfm  anvo t s2uoim3iydome lfvsl(f rrm(moot1tpeoii3tadls2ranvs t) renmo3iadlmDean o s)trtmim iydom nlnvsa(  2um(m ;o4apenmo3ild m eau o;u4 rtrmo3oy1lmt  nei (  exrxm oudlptemiesa(fsruaxr nt0oetoiictyslm2rlnmo (0texoxfciotopteanes;t) exrxr3iy4lm  mfcs sfaDraurp;t1tpx mfeild m emu s () rxnmr to1fa r nvsl()seumimpoodal nlicilt a2uaumo;o0optoii3tysfa2eauvo;t4teenmocootfa eauvi s0t2toxopio4lptemfeiasfsrraxront4teeniociyt a eanmp;t4 renio io1omDrauvil()t2xrim ou1om n ncil( s2rax pno0tlxoifeiadlmDemump;t)aleoiocty1fmDraueil()t2tr(o ou4om  mieil(f Drrxm ;u1oleomfciyd m rl(vo;(0tetrxrcoodfm rlnvs s) 2uo(m oydlpe lfvi () 2tr(  ;t1aetnmo3iyt a2ea(von(0aexoio3oytlpD luesl()t2xmimpio4ap e fetls  2rrxm ;u4tptomf3ildlm2um(mo t)altnxocoy1oa   iei s0sexo(o3iu4om elfvsa()sruax o;t0tetomoctysla2emnms u0alxrxf3iy1lat li olt0 rurxrpiodllt  ivt s)sDrr(rpot1alenmfctyd a umumsn()tetnxf ta1fa r i i;( tetm(o3iu4ap elneiatf rurumpno0opt ii3tldlsDuln p;u)tlermf3oo1lmteln ils0teum(mpoy1ll emivslt  rtmxm ot1aleoiieias a uan onu0alxnmfcoa1fmtrai i;t) 2xrxopoudap   fei t aDtau pot1apt iiciaslsDemnvpnt)trtnxrcoytfa raivo;s0 eurxm iy4olt mfciat)srur(  ;u0olxn fciytfsDel( o t) eeriocia1omteln olt0 2tm(rpoy1llen ivs t  2tr(  oo4apxoii3iydfm2umn snt4artomo3tatfa  luvo;(0 etm(mpoo4alenlnviltf 2rm(rpno1aetnif3tyt m rlumo t0aexnxrcio1fmD luvil(0 rtoirpnydap e fcs t sDumx oot0texo iciatlmDuln p u0teeomf iydomDrlnvolt)t2xoxm3oydal emfciltfaDrrxmpnu1ole mo3iytfmDrlu o;u4altnxo oy1lp elueo;s)t2xm(rpnudlpenmieiatfs2tm(m ot1alxnmoctlt m2emums (0 lerxfcoodlmtrauvi t texm(r nydomtnlnciasfsDurxro;u0tlt mi3ilt s2ulnmo t0 rtrxo3iy1fp elies s0 2xmio oy1lmt mivias)arrmu  ou0oex ifeiasfa2umn snu4texrxf ootomtean s;( trtoim3iydlpe  netl(f Durumoot1tltnifeildfs em( p t0teermocoytlmteanes s sruo(m oo4op e ietas aDrrumpnu1tltomictad a ranmp;(0aetrir3tydfptrlues;t  rtmiopiy1olt mnvtlsf 2ururpou0tpxnmf3iyt m ra( s u0tetrmfciodfpDr iei;t0 euoim nu4lmen nvs ( arrrx  nu1oeenii3tat m emu p;u)teeoxocootlatraneols0 2tm(rpoo1lp elfcsasfa2urxmpoo0alenmo3iltlaDeln snt4teenio3tadlaDrli i;s teto(r oo4ol  mfeia() 2rm(m ou0ole  icild a2ulnvo;t4aetoir3ia1lp  livs;s s2xo(r3oo4am n fes sfsrumu o;t1apxnmoctlslaDrlu p u4arerxoctotlm elivslt seuoxr nydaptemiei t  2urur no4oetn iciasfm emuvs;t4arxnifciy1fat  iei;t0 ruoxo oy1lle lnvia(fs2uaxr ot0openmi3iadla ranvs t4arxnircoatopDrlivo;( srtriopoudaptnlnei s  rumxro;t4aet moeildfa2rlnmp;t0treomo iodlp ranvo s) rxrxr iy4lltemnct t  2ra(roou1apx  f3ils m2ra(mp t0tltnmo iytlaDrlueo t0setoim3nodol  mieias) rua( pno1opeomo3taslmDelums () lxnxo3iytopDr n i;(0t2xo(mpoy1al  miet s)sDuru oot4aeen ociyt a2rm( ont0 rtrircoodopDe ies;s0 2um(r3iodopen fcslt)srtmu pnu4tpen iciysls2rluvo (0alenir3oydoat lnei;(0 rxoxm nodomen ncsat arua(mo;o0tpto f3ias m2uln onu)aetoxfcoodop  li s t)seurio nu1aptnmfeil(  ruru  no0oeeoio3iysfm emnvon(4trtnxr3ootfm eli sl()srxoiopiodole lfciat) ruaum nt1altoioctad s2ra(mpnt)tlxrif todop rlnei s  rtoxm3oy1lp   nei s aDururpou1oexomi3iasls umu s;u4aetnmo iy1fpteaivol()trurim oy4ll nlfet s)sDum(rp;t1oexnioeiysla rlnmo;u) eeoxocoy1fat lnvs t) etriopno4ale mncilt a2raum ;t4tpe mfetadlm2ua( onu4trxrir ty1fpDran il( tetr(m3ou1om nmnvil( sDtru  ;u4aeenmf3tls m2el(mo;u0 ltoxo3tytlmtrliesls t2xrxopoydllen iei s)sDumxrpot4aexo iciltlm umu s;()trermo ty1laDr ueslt s2toxmpnodllee fvi s  Drruroot4opxnifeiysls rluvo t) rtrif to1oaD luvolt srtr(opnodlmenmfeil(faDtmurpoo0tlx  iciys mDumnmo;t4trxoir3oo1lmt ln s;t0 2xmxm oo1ap emfci s)aDrr(ronu4tee iictlsfaDem(vsnt0tetnir3tadoaDelnvi;t) 2uoiopny1lm emiciasf Drm(moot4tetnmf3tld mDuluvpnu) etrirctatomteluvols trur(m no1ol nlfvs tfsrrmur no4tlxoiociytfsDrm(mon(4arxoio iotlmtelu i s seumim nodape lnei tfsDrru pnt1tlt  iciatla2rlnmo;u0alerifcty1om  livils)t2ur(m oy1amtnmict s aDra(m ou4tlxnioctadfs eau sn(0texnmfcoydlateln s;t)setmio ny1lltn icsltfsDtr( pou0olxomoetas s umnms u)aeenmrcty1opt  u ils srxm(m3nydoptemicil( a2urx  ot0aptomfeiaslmDelnvp t4 exrmfciodfm r ieslt0s2xoxm iydopte nvtat)aDurxr ou1ole iicildla ra( snu)altnxr3ty1oa r ivols truoimpny4ap nlnes (  Drr(ro;o0tet ii3ils sDulu s (4aexnif iatlmDelnei;s0teuoir3ny4oltelfcsls  2um(ront0aeeo o3ias s2um(mpnt0 reomf3tadlm e n o;(0texr(m iodop elieta()srum(r ot1apxn oeiltfsDuau p;u)arxnxf3iotfm   ieol()srtoim nu1olt mfcs tfs2tm(m ou1tex  f3iadfa rlu s t)arxnif3ia1optrai i;( srtrio oo4ap  lfcsat artm( ooo1texn i3iasfm ra(mp (4arxrxo3todoat lnei (  eumirpoo1op nlici ( sDtaxr ot0alx  iciasfm2elumon(4artrio iadfaDeaueo (0 exo(r iudalee nvtl( aDrmxrono0ole  oeilsfmDrlnmont0 ltnmf3ty1late iei s trumio3nu1am   icil(f ruax oou4aetoioeiysfa em(monu)alenmr ootomt luvs;()seto(m3ny4omenlnvi t)srurum no4optnii3tatlm umumpnu4artnxo ia1omt  n o;s)t2xrxopoodaptemicsl(f ruaur nt0olenifetad a2elu ont0 etnxf ia1lateau ols) etoxm3iy4ope  icsl()aDrauront1oexn f3iatla ea(vsnu0alxnxo iydoat lues;s0trxo(mpno1amtnlnvt (  rra(  ot1altn ietatlsDul(mp;t)trxrio ia1lmt  uvols  2tmxr3nodop emnvi sfarrr(r ;t4teeo i3ias m ea(vs u4treomf tytfa raues t) 2um(mpoo1lle livtl(fsrra(m ot1tee  fcildlaDemn o u4 eenmr3oa1lp  anei;s trumxm iy1lp  lictlt)s2trx pnt0oeeomoeiysfm2ua( p t4treoif3oydoptr uvi () 2urxo3oy4olt  ncsls  2ta(mont0apxo ociad m eln onu4 renxf oatfp r ivols tetrir no1ome mfvt t s2tmxr ou1oltnmoeiydla2rmumsnu4 exomr oydlaDr n s t) 2xoirpnodlm  mfcils a2rmurpot0opeomoeiaslaDumnmpnu0tetrxo oydlmD  i i;t)tetm(r oudlm n ieslsfaDuaur no0tpenmf3tasls um( o;t)tlermrctadfa r neil( trumim3oy1omt  ncil()srtm(r no1aeenmoctyt a rluvs (0trxnir tytfaDeauei;t) exmxo3iu1lmt lneta(f Drm(  nu1ale  o3iltlmDeanvs;(0 ltnmf3tadfptrlnes s trxoirpny4oltnmivi sf 2rax poo0aexnif3tlsls eln pnu4 lenmocta1lpDrluei;t) rtmio3iodalen fcslt sDra(mooo4oleo ietys s ra(vo u0texomo ty1fm rln ols  2uoxo ou4am  lici sf 2umxrpoo4aptomoetad mDulnvo;(0artrxo totfa eauvi s0teto(opoo1ale  iei s srtax pnt4teto o3iatfs2ua(mo u4 etomr3oa1fa eluvo t  rumirpiodaptn nesl( arrm(r ot1ape iocilslaDrmu sn(0 etnxr to1lmDrai i (0sruoio3iydam  lietasf rta(rpou0ale iieiydlm emuvp u)tlxomo ty1op elivo;(0 2urim3iydomtn nvil( arurxroou0aetnio3tasfa2umuvpnu)treomrcoadoa  anvo (0s2umxm3nydapen icil()srumu ono4tlx  iciydfm2eln o u)alxrir3oytomDrlu ils)sexo(m io1lm nlivt s s2um(  ou1aeenmo3taslsDumu sn(0tlenxr oytfaDe n s;() euoir nu4lpt  fct (farurumono1teeoiicildla emnvpnt4 rtnmo3todfmD  uei t0 ruo(o iudlm elfvslt artr(ronu0oeeomociydlm2umn sn(4trxnif3oydfptelieo;t  etoxrpiodom  mnvsltfaDumxmoou0tex  ocilt s2el( s t)tlxriocoo1lmDelivo ()s2xrim3oydoptelfcils a2raur ;u4alt  i3tasfs2ua( s;t4 rtomo3iy1lm elivils0seum(r3oodlm  licias artaxr no4oltomi3tld a2ua(mo t4aleoioctodfat  i s t trur(opnodamtnlfcsls s2ta(m oo4ape  feildfaDrm(vsnt)arerxr oa1faDrln s (0srum(m3nu4ol e ivi s sDum(rpnu4oex micilsfmDrmnvpn(0tlerxr3tatlateln slt  rtoim3oy4ope mnvi ( srtm(r nu0opxo feilslsDua(vpnu4 lerio3oa1om   i sl( tetr(m3iudlpt mnet tfa2umxmoou4opx mi3iyt m umumo;t) etoio3tydlpDe nvsls)srxmxm iodomtn neilt arurxr ;t1tetn o3iadfs el( pnt0trtrmoctytoptean slt0 2xr(r3io1ol nmivi s s2taxmpot0teeniiciatfa rmnvsnt) ltomo3iydoateaivils0teurxr3iu1olt lnvia(fsDra(mono0tee mo3ilsfa rmu s (0trtrxf oo1oaDraieo;(  2tm(r iu1ap n fes sf 2raump;u4aptoifetldfa uanms;t0 rerxo3iy1lpDeaieo;t t2trxrpnudapen fvsls) 2rru  nu4altnif3iaslaDra(vp t4 eeoir3tadfaD anvolt srtrim3iy1lpt mnetls  Dtmum ;o1alx mo3iydlsDranvp u4aexoxf oo1fpteluvilt)s2xmxr3io1amenlnvil(f 2raxmp;u4aptniieias m2em(ms;u4aeenmrcoa1fpteli i t0trxmxo io4lme lnetat) rumx o;u1aetomf3iadls2rlnmsnu) rxrmf iodopteai olt s2xmxopio4optemivs ()sDrmurpou4oee moctldlsDrm( ont4tetrxr ootop eanes;s)seuo(r iu4ome lieias  rtmur ;o0ole mieiytfaDumu ont4arxrir io1lpDr i i;s)trto(opiy4lme mncs ( a2ua(m ;u1tltn fcias s rlnmpnu4 rxnmociodomDelnvo t  etm(r3nydolt lfvt () rtm(ro;u4tetomfciltlm2emums u)alxrxr ootlaDelueols0t2urimpio4al nmfetas s2taumpot0tpx mi3iadfs2ea(vo;() rerxo3iotlmDeauvo;t)s2to(m ny1om  mici sf Dtm(m no1aleo oeiltlmDem(vo;(4aeeomf3ta1omt auvil(0teuriopno4omtnlnvsa()s2ua(  oo1tptn fctytlsDeaump (4teerir3to1oa r u i () 2umxm3oydomenmnvilt  Dtax oot0opx mi3tldfm eluvp t) etoifctytfm   uvs;(0 exrio nu4ap elnet t)s2rmur ;t4apx mociyd m2ran o (0tlerxo tydop elu sl()seuoiopiodlp n nesltfsDta(rpoo1tlx iictatfa2el( p u0aleoir iydfmDeluvsl()s2uriopnu4lpenmfeiat)s2ra(mo;u4oex mi3iatfs2ra(vp;t)alxrioctotlmD auvs s0texmxm no1am  mnes t s2raum oo1apt  ieils m rl( s u)trtniocoo1lpteaieo s0t2uriopio4lltn ncsl( s2taumo;u4apen ictadls um(mon()tltnmo oodlatran s;t)trxmim iydolenlici tf Dumuroou4alt mi3iadfs2rauvpnu0 ltoif oy1laDeau ilt  2xmio oo4ope lnes t arrau o;u0tlxomociytfa2eanvo (0aeenirciodoate neo t0 eum(mpny4op  micsl(  Drmurpoo4tle mieiat sDrmuvp t0tetnmfcoytoptr u i t  ruoim3nydlp emnvtlt)arurxroou1apeoio3ilslaDem(mp u0alenmr3iatfat  n o ()srur(m iodaltnmncsl()s2uax o;u1aexo fciytla rmu o;u4arxrifciadop eluvi;s0 eum(m io4ome  ivt s)artr(m nt0opxoioetlsls ran ont0tlxoxr3oodopteaueilt0srtm(rpoo1lmte fesatf Dtrxr nt4tlto ociatfaDranvo;(4aexrif oatlpD au slt  euo(opiudlmtemfes ( sDtr(m no1aex iictat aDrlnvo (0aleoxf todopte ivs;t)sexmir3iudapen ivsasf 2ua(m ;o1tlxo ieiytlm ea(vs t0 eenmf iytfpDelieilt  rxmxopny1om nlnei tfaDrmxrpnu1apenio3ild s eluvs;(4trtomr ta1laD luvo;() 2toxm3nu4olee nvsl()a2raurp;u1tet  feils m elnmp;(4arxomo oadfp  anvi (0s2to(m3oo4lp   fciltf Dtmu  oo4opeo feiys aDrl(vp () lxoxo3tadoptrliesl( trtrxmpiodolee nvs ()aDtm(rpoo0opxo iciad s2ul(mp (0 lxomfciytlp raieol( teurxm3iu1ol  mivil()sDra( pno1altniietlt s2el(msnt)artrmf iydoat auei s  2xm(rpno4lm emfcilsfarumxmpnt0tlx  ieiysfa umumo;t)tltomfcoytopDe uei t)t2urimpoodame mici (fa2uau ont4opeo fciltlaDemn o;t0tlenxo iydfateau ols0texo(o3nydlpen nct t srur( pot0aptnmi3ilsfm2el(vpn(4teerxo io1lp  lies;s  2trim3ou1omtnmnvt s a2rm(rpou4tptomfetad a emnmp;t4 rtoifctadlptraueils seurxm3nodal   iesltfsrta(mo;t0oeto ieilt m2uanmo;t4areomocoytlaD  i s t)t2xoxopiydape lfes ()srtax pnt0aptomfciyt m2ra( o t0tetoif tatfmDeln s t) exrxr3oudam  mnet tfa2ta(r ;t0tpe if3ilt m emn o t)artrxrciodlmDe nvol( setoxm3iu1lpeelfeilsfarraur ot0tle mfcilsla2rauvo;u0 exnxr3iodopt  ues ()srxmxmpnudopee fvi t srtaxro;o0optoifcilsfm2eln o;(4trtomrciytlmtraneol(  ruoirpnodlp   ict s) Dra(m ;o0aee ifctytfmDeauvp;t) lxoxf tadfmDranvsls0 2um(m nu1altn iesltfsDtmx ont1optomf3iatfa elu p;t) ltoiocoo1fm  aieo;() rum(o3iodoptelnvsa(fsDrmumpou1aex  ieiltfs ean o ()tltrxo oydlpDeai i;t0tetrirpio4omenmnvia(  2taxrpnt1optnifeilt m2rlu ont0 ltnmo3io1fatr i il()srtmim3nydomt licsls s2ururp;u0tlxn oeilsfm rmnvo;t)aexnir3iatfpD livil(0s2toirpoo4open ics ( srrru  ot4aex  fetydla ul(mp (0 rerxo3oydoaDrlneo s) 2xo(o3iydoptelfvt s arta(mpnu4apxniociys mDul(vp t4altnmfcta1omtraies;t) rum(m oo4al  licia() rtrumo;u0oleniieiyt s ra(ms u0alerir3iy1fpD livs;t0setmim ou1lpte fvsa(f 2tmurp;o4alxnmoeiadfa2um(mp;u0 rtomrciydlm ean i t sexr(o3oy4ame lietls)srrmx o;t1opeo f3iys mDul(mp;u4aeerir tatfp eauesls  2uo(m nodlpeemfetl(fa2raxm ;u1tlxn octytfm el( p (0tlxoir3ootfmDraneilt s2xo(mpou1ap elnetls  rtmu pnu1oltn octyslsDuaums;()texnxocia1lpte nvs s) 2xrirpnydlptn fvs ()artmxront0optnmo3iltlm2rau o;t) rtnifcoo1lm e u ols0 exrimpno4al elnvtl()srumum no0olx iieiasfs ul(vp;u)tetrmocoy1fmDr nvols  rxm(o iy1amtnliei ( srtrumpnu0tlxomoctlslmDelnmo;u0aeerio3ty1lmt  nvsl()setrim3io4op nmnet s a2urxmp;u1tpxn iciytls2rmu pnt4tetoxf3oytfatr n slt0seuoxr3iu4ame mfcsas s2umxr ot1teeomociltfa2ua(mo;u0tetoif3todfmDeau i;t  2ur(m oo1lpeelivias a2tm(m ot0tltomoetadfa uanmon(4altoif3oodfpDran ols)s2xmim io1ap  mieil()a2ur(roou1openmi3ilsls rluvo (4aeeniocio1la rlnvs;s s2umir3iy1omt micsa()s2umx o;t4tltniiciadfm2ua(vp;()trermf iotlptrln s ()t2xr(m iydlp nlneta(fa2raum ;o1texoioetltlm rl( o;(0aexrifciodom r neslt)setoiopoo1llenmnes () rra( oot4aexnii3ilsla2rmuvs u)trtoxo oo1op   ies ()sexo(mpnu4lleemfes t aDtrumpou4tptomfeiaslm rluvs;(4arerxrcty1fm   nvs;t srum(o3oo1amtn iesl( srrmu ooo4aeenmocias m uanvp;u)aetnxr3todlmte ies () 2trxopno1omen fvsas)srrm(ronu0olx  i3iltlsDrm( s (0 lerxocoy1omDr ies;()s2xrxopnu4lmen icsl() ruaum ;t0alto oeiasfs uan p;u) eerxrctadfaD luvslt0s2trir3oodoltelncs t aDuax  no1tlx mfciytlmDean o u0 exomo3oytfaD  uvi;(0srtoxmpoo4omt micsltf rrr( oou1opeoiociltfm2uaumonu)trxrir3totoateli ilt  rtmiopoydomenmfesa(  rumu pnt0tee mfciat a rmn p;t0tetomocoydoatr nei;s)tetr(o no4ole mfvilt)s2urx oot4opxnmoeildfs2eaums;() eerir ia1lpDe neo t0s2xo(mpny4oltn nei s s2rmx  ou1tex  i3ild s2uln on(0arermo3iodfa r ieo t0 rtr(opoy4ll e nvtlsfa2umur ou4apt io3iltfs el(mp (4aeermr iodla e n o (0teuoio3io1lm emfvtlt a2ta(m ;t0oex if3iydfmDemumo;u0aetniocio1lm  ln i t texr(mpnydolte fcils  rta( oou4teenmfeiydfs2uauvsn() ltrxf3tadomDeau o s t2tmio3ou1amtn nvt t aDrm( ono4tex iiciatla um(mo;(0aetrxocoa1lmtraueolt  rtmirpno1ame  nctl(  2umu pno4apxniicias s2ra(vo (4 rtnif3tydlat  uvsl( tetrxr3oydlpenlfet sfa2rax  nt0oet mf3ildfs ulnvp ()aeenmr3iatfatrlivi ( texm(r3ny4opeelfvi tfsDum(mp;u0olxnmi3ildlsDemn o;u4 etrmr tatopteai i s)s2tmxmpoy4al   fvsa()s2trxmpno0aeenmoeiatfa rl(ms u4tlenif oadoatr u o;t0 2tr(r iydol n fcsat srta(r ;o1ape mi3ildfmDulu p u4arermocia1lmDeaivs;s t2uo(o oo4opte ics t)sDur(  ;t4aet mieiltfs rmuvpn(4teeomo iadom eau slt srtoio oo1ol elncsltf 2rmumpou1oltomieiatla ulu sn(4 ltomfcta1faD  ues s0srxm(o3nudaptelicsat)sDrrum ;t4tetomociltfs2ulums;t4teermrciydoa e nvils  rurxr iudap  mfeias sDuru p;t1oexniociltla2uau s u0aetomocoytfmDe ivolt srxoim3iydam eliesl()sDrax o;o0aetnioetatfs em( p;u) rtnifcia1lmD  n o t0 exrxm ou4lm n ietl()aDurx o;t4tpt  iciatfmDelnmonu)texrmr totlmDelu s s) 2xr(o3oy1apte icias  ruaum oo4oet moctld s2rl( s;t0altomo iotomteli i () 2trxo ny4opte icsatf ruaxroot1optomo3iat aDem( pnt) etrir3tydlpD  ivi;t s2uoxo3nu1alt lics (  rrmxmo;t4aleoiiciasfs2elumon(4aexnxocoatlpD  ivil()s2xo(o io4lpen ies s  rrmu pno0alxniocild a eluvs u0tetnioctodfat aivil( trto(o oydaptn feiat aruaxmpnu1tpxnmi3iatfaDrmnmo t0 etrmo oadlat  ieo (  2urxm3ou4ape mnvsl(  rumxmoot4aetomicild aDuluvonu4aeeoxf tydfa eaieslt0 2urxmpiudap nlfei s srra(mp;t1oeenmictysla rmu sn()tetnmf tatoa  aueo;t0teur(o oo4llenlictas) rrrum ou4aexoioctatfmDul( p u0arxnif iatlmDr iesls0truoxrpiu4ale livi ( arurxmoou0apenii3tasfs2ranmont4arxoxfciatlmDeanei;s) 2umxm oo4om  mies ( aDra(rono4oex if3tltfsDraump t0aleoircoa1omt aivilt texoxm3io1ap elnvs (fa2tax pnu0ope mieiltfm2rmums t0altrifcty1omDeli i;(0 2urxr oy1lpt  fcsa(faDururp;u1optn ictydlmDul(vs;(0teerifcty1faDeli o;t) 2toxmpny4omtnmnvsas)arrmxr ;u0olt iieild a uln snu0 rtrxfcootfaD lnes;s t2xrxr iudlp  livs (fsDta(ro;u4aptnif3ildlaDemu onu)artoxo oydlmD aivols) 2uoiopoy1om emfvtlsfaDumur no4ape mieiytfm2uanvpnu4 rtoxr3iotop e neo;( s2trxrpoo4lp emfvtl(f 2rru p;u4tlen o3tyd m elnmsn() etoio3iodla rlieols0 eto(m3iy1lm e fvilt)arrmump;u1tee io3iltfsDuln s;u4 rxnxo ta1lpD  nvols) exrio io4lptnmfvils  Dumur ;u0oeeomociltfm rmuvsnu)texoxo ootoateaieslt0sexrio iodam n neiltfsDua( pou1tetn feiadfs2ra(ms;u) renxocia1lptrli i t teto(o nodlm nlivilt s2umump;o4tex mociltla el( snt)trxnxf3tadfmDelivo;( srumxo3ou4lltn fvsl(  2taur no1tpxnio3tlslm rlnvp u4artrmrctydfateaneils) rtr(o ou4ol  mnvsatf rtr( o;u0oleoiieiad aDrmn snt)aetriocto1omtr n ols)teumxmpio4lpe licilt)s2umxr ou0tlx  i3iatlmDemn o t)aexrxf3totoa rlieil(0trxoirpnodamt mnetlsfaDrm(r ;t1tptn fctadfm emuvsn()teerif oy1lpD  uvsls0 eum(o3iodlp nlncias) rtm(m nu4oex iieiytfm eln p;t)altnxrcta1fa   ieo;t teto(rpou1llee nctas)arumumpot0oex  fciyslsDuanvpn(4trtnxf iadfmD luvi;t seuo(m3iy1omtemicsas)arrmum ;u4aptomo3tadls2umump;()teeomoctodlatr i i;()trxmim3iudlmen icsl()aDur(ronu4opeoifetasfa2rl(mpnt0trxrxo3tytla  an ols)t2tmxmpoydomenmictas)aDtm(m ou1tltnmiciys a2ulnvs u0 rtrif3tadfat  nvo (0srtoim3io1altnlies sf Drrx o;o1texo f3ildfsDel(vo t4tetnxfcty1late uvi (0 etrirpiy1lm n ictat aDur(root1tpx  feilslaDumuvsn(0trxrxf totopt  ivo;t0s2xmimpnodlptnmneils)aruax  ;t1tetnmieiat s2ua( o u4trxnio3iytlmtelnvol(0truoir oy1amtn nvsas aDtm(  no1alt iietytla2ulu p;t4 exnmr totomt  i i;s)s2um(rpio1amt mnviltfs2ta(moou4tlt  octysfm rlu s;u4alxoir3iadfat aneo s t2xmir oydopt  nci t) 2taxroou4open i3tldfs ulnmo;t)texnxf oydoaD li sl(0s2umxmpno4ol  lnct ()s2tr(rpnt0texn iciat aDuau o t)tetoio iytoa  luvi s)t2xoxmpnydop elfvslt s2umumo;t1apeniictadfmDumu ont0 exoxrcty1lm  an i;t0srumirpnodomenmnei sfa2rruro;t1aex ifctysfaDeaums;t0 ltnmr oa1fpt aivs;()t2tr(o3nodape mnes t) rtmxrpnt1altnio3ilslmDrmnvp ()teeoio3oytfmtran i;s0s2tmxrpiodomtnmieia(f Draxrpot0aee mfetadlaDumnmsn(0 lxoxocoy1la e n i ( srumxo ou4ale  fvtatfsDumumpnu0aeto i3ilt a2rm( o t)tlxnxf tydoa r ivsls0t2trxo ny1lme mfct () rraxm ;t0alenioctaslm raums;t4tltnxfcoy1fp  ai s () exmirpoo4alenmivt tf 2tm( oou0tpxnmieiyd m2raums u) rtnmr iatlpte neo;t0 rxrim3oo4am emnetat  rra( oou4olen o3ilt a rmnmsnu0texrxfctodopteaueslt)seumxr ny1aptnmneta(f rrrumo;o0opxn i3tlsfa2emu o t4 rxnif3oadfat lu s;s)sexmir3no1al elicil(faDtrurpoo4opt  ociad aDean o (0 etnif iy1fmtean s;t)srxoxmpio1al elictls)aDrm(ro;u1oleniociad m2ul( o ()aeeoxr oatomteaiei (0trxrxo3no4al e ics tfa2um( pnt4alxnmoeiyt a2umnmon(4teenir3ia1fate ies;(0s2toimpoudome mncs s)sDtmurpou1apt if3ild m2uaump t4tlxnmf ootomtrluvo;t0trxoirpiy1oltemiet (fs2taxm nu0tltn oeiyt mDra(ms t)tetrir3iytfpDranvols0seto(m3iydomtemiesas s2tm(  oo1alxnioeiydlaDul(mpnt4tlxnmf3iydlatrauvolt0 rtriopno4amtemfcs tfarra(rpoo1openmfcild m ulnmo u0 etnif3oadfaD  u il(0 2trxr3no4llt mfvs () rrmur oo1oetomicildlsDrmnmpnt4 rerxf3to1fpteli s;s)srtr(o iu1lpte ict t  Draxmpno0olxn feiysfs2ulu on(4 lermfcty1faDe nvsl(  etrxo oydllte ivs s)s2urxmpot1olt ioctlt m2emnvp;t4altnxfcootlaDr i s;()t2xmio nu4lmee ictlt aDtm(rpno0aet ifetls aDel(mpnu4artoir3oatomDrauei;(  rtr(m iu4omenmics sfsrrmx  oo4tltnifeiadlm2rmnmsnt) ltnmo3io1laDrluei t0truoim3iy1ll nlfesl(fs2ta(moot4oltomoctas a2eau s t0trerxr3iodfp rlieo s)trxmxo io4lm elfesat  Duaxr oo1aexn f3tyslmDemn onu4teeoxf3to1fatrln i;() rxm(rpiu4lm e icia( s2rm(rpnt4oex  fcildfa2umn p t4artrmrciy1latraies (  2uoio oy4lle  feiat  Dur( oou0optnmfetyd a elu p (0trtrxr tatomtrlnei s)setrim3iu1lm nmnci s  2urumooo4tex iieildlaDemnmont0trenmrcoy1fpteanvs;() exr(m nu1altelfcsat s2tmumpno1alxnmfeiydls2umumsn(0 rxnio3ia1lat aivs;(0teurxr3no1om  lfvi () 2trxrpot1oet iictlsfm2rl(vo ()aexnxo3oadopteai o;s srtmxrpoo4om nlies tfa2uaur ou0tpxn oeiysfs2rl(vo t4aexrmr3ia1fptelivi ( texrxrpnudlltnmnvias)sruaumonu4tex ii3iydls2el( pn(4arerxfcoa1lpD lneo;s sexrirpoy1lp elies ()s2rm(m no1apxniociys s2elumo;u0artnmoctotomtr nvs;(  rum(rpiydamtemnctat)artrxmont4alt  icildlmDuanmsnu0tlxrmr3totla eai olt0srtm(r3no1llee ivt tfa2rm(rp;t1oet mfcils mDrauvo;u4 eerifcoa1laDeluvs;t0teuoxr3oy4lm   nvtasfs2umxm no4optn ietatlm ua(vs (4arxomo3iotfp   u i ()setoxm oydomeemneslt)arra(mpou0oee iiciat aDrl(vo;() eeomo todom   ivo (  euoxopnu1omt lneia(faDtm(m oo0oexomi3iltlm ul(mpnu)trxnmo oydlptr nvi;(0 rxm(o no1am e ivtasfa2urx poo0oltnifeiltfa2emnvont0 exrir tytlmtrlueilt  2ur(mpoo4opt lieilsf Dua(mpnt0olx ifctldla2em(ms;t0 leomf oytomtranvs s0s2urirpny4aleemiesas) 2rrxrpno4olxniociltfaDea(vo u4altrxr3iy1la e nvi t)teurir iu1lpen ncs ()srtmur nt4olxoii3ilt a2eluvo (0 rtomo3totlmD auvo;t0trxrxopnudlm elfvs s arumu onu0aee  feiasfs2rlumon() ltoxocta1omte uvs;s0 rur(m ou1ope mncta() 2rmxrpnu0open ieilt sDeluvpn(0tetrir ty1opDrln i () eur(m ou4op   fvi sf 2rau  oo0tpenmfcildlaDrluvo u0 etoir3todoa r u i;s0t2umio3iy1lp emiesas) 2rau pot0oeeoio3iys s ul(ms u)aeerir3oytoateauesls0teto(m oo4ape lfetl( sDraxr oo0alx ifctydlaDrmumsn(0aeenio3oadlpDe i o ( srto(m3oy1op  mnvslsf Dtm(m ot0apeoii3iadfa2rm( o;u4 etrxfcoo1omte u o;( s2xrirpio1lleelfesas) Drmx  nu0tpenmf3tad s2emu snt0 lerif iytom e nvsls s2xmiopoo1lm elictatfaDumxroot1alenioetatls ean s;u) lerif iotopDelneo;(0s2tmio3iydam  lnvils)aruaxroou1ope mietad m2emnvs;t4 exnmocoadlm  livo;s0srurxr3oo4am  livs ( a2taum ;t4tlxoii3iysfm uluvpn() rxomf tatfptrlneolt) rxm(r3nudam n nei t)sDtmu poo4alen f3ilsls uluvsnu4trxoxr3oydlat lneo t trxr(rpoudamt miet sf rum(moot1oeto fetlsfm ranmp;t0 eeoxf oydla rai ilt0 exriopiy1om nmnctlsfaDuaurp;u0optoiieiydlaDelnms;u4tltnmf totlp  anes;s0sruoir3nu4am  mnctlt) Drmxm ;t0aptn oetasfaDuln o;u0 etrio to1fpDr nvsl(0srum(o no4op n ivi (  Dtrxmpnt1oetoiietysfs eln o u) rtnir oodfmDran olt)seumxrpnodll   ictlsfsDrm(  ;t4tpeo i3tadlm raump t0tltoif3iydom rau i s  ruoim oodomtnmfvtltfsDrmx  ;t0oleoifeiytfaDrm(ms t) rxrmrcoatoa e n olt  2ur(o no1aptn iet s)sDrm( ono0tptoioeiytlsDeln s (0 ltnio tytlaDraneil( t2toxopoydal elfciat aDtr(m ;u0tltniociaslmDran p () ltoxr tadom elu o ()t2urimpou1olt  nvsat a2ra( pou0aexnio3iadla2um( pnt4aexnxo todfmD  uvo ()sexr(rpnodomtemfcsas arta(rpno1aeto ieiysfa rl( o;(4texnxo oo1om e neo t)srxo(r no4lleelfet t  rua( pot1alx ifetasfm2ua(vont0aetnmr3oo1op rai i;(0trur(o iydomt  fcs (f rumxrpnt0opxnmiciydls2elu onu0altoif3tatfptrluvo;s s2umxrpnudamt  fetat s2rmu oot0optoio3iydlsDeanvo t) ltoir iatfmtrlnei s teuo(o ny4lpeeliesls s2um(  nt4oltnmf3iatla2em( s;t) etoif3oytopteliei s t2uo(opiydaptnmnvta()a2rmxmp;o4opto oeilt a2rmnms ()tetrir3oadfmtelueo;s) rxrxrpio4llee ncs s a2ua(ront0teeniietltfs rlnvo;t4teermo3ty1oatrlieolt0s2urio nu4ale  ncsatf 2tru o;o4tleo fetat s2rmn snt)arenmr3iatfmte ieo s)sexoxmpno1op emnvsl(  ruaumpou4opt ioeiatlsDemumpn()arenxf3ta1fmDe ueol(0seuoxm oydomenlncs () Dtrx  nt1tpeo ieiasla ulnmsn(4 rerxr3iodlptr neils  rtrirpou4al emncs sfs2uru  ;u0tpeoifetydlsDem( ont4tleoio3totfmDraues;s  rxmxrpoydoltnlncil(  Dtrump;t4alt moetldls2rmnmpnu4 rtrircoydfate nes (  exoiopoo1am   ictas s2taxrooo4oet io3tyt a ea( pnu0 lenif3oa1lmteliei;t seur(m3iudol elnvilt  Duaxrpou4tpxo octydfaDran ont4altriocoatopte ies t0texmxm io1om n nvi (fa2tax p;t1tltnifeiydla2el( s;u4 leomf oatopD livi;s)srxm(r3nu4om   netlsfs2ur( o;u0ole  i3ias sDranmont4 lenio3todoaD  n o ()tetoir3oy4opt mieiat)s2rm(r ;t1oeeoii3iydfa el( s;()arxoxo3oatomteanvi ()t2umxrpnu1omeelivsl() rrm( onu1tlenmictld m2ean o;t)teenxr iadlptr ivo;s0t2xr(mpnydll n ieia( srurx pnt4teeoifciad s ua(mpnt0texnmf3iy1fpDr uvi;t0 2xo(o oo4lm e fci s a2tr(m ;o4texnmoeildfs2ranmsnt0tetrxocia1om rlivilt)sexoxopiy4lm n fcsls) rumurp;u1opto o3ias m2ra( p t0teermfcoo1fmD  nes s setmim ou1omtnlfes tfartr( oot1alx  ieiydfm2ul( p;(0tlxrif iadlmtr n i;() exr(rpoodam  lneia( aDtax oot1openmoetytla rmu p;t)aexnxo3oy1lptr u slt  euriopny4ol  lnctlt  rtmu  no4apxo i3tytfa el(vsnu4altoir3tadlaD auvil() etmim3oy4lp elfcs (fs2rmump;t4oee  o3ildla um(vpn()trxrio3ia1fp r u il( seurio3iy4apeelivtas  Dtru p;t1aptomi3tltfa2um(mo t)altrifciatlm rlies (0trtmiopnydllte fci () 2ur( o;o1alt moetlt mDem(vs;u) exnmr iydfmDeanvi;s0t2urxrpiydll  lics t aDtrurp;t4alt  f3tltfaDuaums;(4trtnio oa1fm rli s;t)srtm(mpiy4apt  iet t srurxrp;o0opto feiltfs2ulnmont4tleoxo tytfp e ueolt  exmxm iudllte fvi s a2umx p;o4opt  ietydfs em(msn()trtnxf todfpDeai i ()teurim ny4lltnmfvsasf 2taxr ou1opx ifciytla umn snu4altomrcoy1la  aieslt t2urim oodopenmieiat  Dumxrpnu1apt iiciydls emnmp u)tltnmo3oytfaD  neo t) 2xmxrpoo4ap emneil(f rtau pot4olen fciysla2ran onu0 reoifcio1oaDe i slt  exrio ou4altnlfetlt)a2urumoou0tpe  f3iasfs emums t0 etomoctadop elieilt0seuoxm iu1ameelicsa(fa2ra(  oo1teeo ieiyd s uluvo (0 rxnxfciatfaDeaivol()trumxr oy1om n ieilt  Dur( pnt1open ieiadfs emnmpnt0treoiocoa1lm  auei;t sexmim ou4lltnlictls) 2umxr ou0tpe  i3iadlm2rmn s;u4texoxo iadfaDeanes s  2xr(opno4lptemfcs t)arrr( o;u1opxomfeilt a emu snt0arxnif3iydopDr nvi;()teurir3ny4lpee feta()sruaumoou1aetnmfctytfmDrlu o (0 rxnmr3ty1fa   ieols0 rtoim ny4amee fcilt srum(roou1oeen octytfs el(mo t) lenxf todoa rlieolt)srto(r oodomeelfesls sDuau oot1aeeoioeiysfs ul( o;u)aleomr todla eau ols  2tmimpoo1lle mfvsls  rtrxro;o4alt  o3tyt a uan p u4 lenirctotopt ln o;s) ruo(rpiy1altnlfeslsfsDtmurooo1aptomfeiadfm uan o;(0tetomr tatlmte n s s) eumxrpio4openlnvta() 2tm(mp;o1alx  i3tad mDumnmsnt0 rtrxrcia1op eln i;t0 2urxr iy1alt livsl(fsrumxmo;o1oltnioctyt a2elnvs (0aetnxfciy1optrlu o t) exo(m3ny4omeemies sfaDtaxmp;u4teenioeiyt s umnmont4 reoxfcoadlm eai ils  ruo(r3iu4am emnviltf 2ra(m no0aptoifetatfm2ulumsnt0 lxnir ia1fpt auvs;s)teuoxmpnydol emietas sDum(rp;t1opto ieias s umn o;(0 eermr3to1optr ivo s)trtrxm3ny1am e fvt ()artmu ont0tleo f3tat s elnvs;t)altrmo iatfaD anvils0 rtoim3no1am   icias  rrr( onu1tptnio3iasfmDum( snt4 exnmf iy1la eaivi s texr(rpny1omte nei t srtax  ou0aex  fetasla umn snt4trenxf ty1lpte nei;t)srxmxo no1lpt liesat)srrmumonu1oexn f3iltls2elnmon(0tlxrircoatom raivilt truo(rpoudlm  mncta(  2raxro;o0tlt  fetysls2umnvpn(4tltnxo3ootlaD lu s;s0 eumir3oy4omen ivt ()sDurx  ot1oexoioctltfsDrmumpnt0 reoxf3iadop  aivi s) etr(o oo4opte icil(f Dua( ono4tptoif3tlsfmDranms ()treoxo ty1fmDrai o;t t2urxrpoy4lm nlfcsas)s2rmum ;t1aex miciysls2ea( p;t)aeeoxrciydfptr u olt tetriopio1opeemiciat srrrum nt1oetoiieils a2uanmon(4texnir3tytfat lu slt)sruo(m3oudop n nvi s)a2trxm ;t4opt iiciadla2rmump;u0artnmfctadom rlivs t  exoxmpoo1ame mfetat artaxrp;u4aptniociysfs uauvo;t0texrir3tydom rauvs;t  rtm(rpiydlpenlnctlsfaDurxr oo0oleo o3tltlmDeln o;(4aetoxr oodfaD  ieo;t  ruo(o3ny1lm emnvta(fsrum( p;t1oltniociaslsDulnvpnu) lxnmf iodfpD livi t seumir oodam nlnci sf rrrx oot0oee if3iysls emnmpnu0tlxnxrcoa1oa rlnvo;(0trxm(mpnydlltnlfvil( aruauronu1ape mfciysla2rm( snt)teeoif iotfpDelueolt trur(m iu4al n ieil() 2tmxr ;o4olx  ocils s2um(mp;(0trtoxocoydlpD luvols0s2to(opnodoptn fci t)srumurp;u4tex ioeildfa2emu onu)texnmo3todoa eauvs;() rumim3no1ame mfvs ()a2urxmpnt4oexoii3iltlm rln on() exrmr iodomtran ilt)trurim3iu1ll n ieiltfsrtmxmoou4texo o3tydlm umu sn(0arxoirctotop  ln i t)srxr(o iodlmen nei (f rururpno0apenif3iatfs2ea( p;u0trxnmf oodop rlues;s)seto(rpoydop emnct tfaDua(rp;t4texn o3tydfaDelnvon(0artnmrciodfaDraueo;s0t2xoimpnodalenmncsas a2tmumont0opx io3tltfaDumnvo;t0aeeoio3oy1fmDrluei;t teurxrpio4amtnmfvtas) Dumx poo0alxoio3ils mDumnms;()tetoircoo1laDranes ()seum(m3ny4olenlnvi t) Durum ot0oetnif3tasfs ra(vp (4tetoircoadopDraieo (0 etm(r3nodam  mnesls) Dtrxr oo1teeoio3iltfaDrmuvs;t4 eerxo iy1lat lies;( srtmirpio4omee ieiat) 2rau  oo0tee  o3iadlmDuln s u)tetoio3ty1latean s t0 2xmxm oy4lme lnvsa(f 2umum ou4oltniictldfmDua(mp;()tetrxociydoat aieolt)srtoxr no4aptelict s)sDtmum ou0apt moetysfsDemu p;(0 leoioctatopteauvo;s)srtr(o oydlleemicias  2rr(m ;u0tetomi3iyt m ran s;t) ltnxrctytfpDr i o;( t2uoir iy4omte ivt t) rurumooo1opt iictldfaDumnvs (0 rtoxo3ia1la eanvi t)teumirpoudap nmfes () Dtaxmpou0opx  i3ils m2uanmp;t0alxrmoctytoaDrli sl(  ruo(mpoy1altelfesatfsDur(  ;t0olto o3tad m2rlu o;()alerifciy1omD luvsls truoxr no1om e ies t  Draumoou1aeen iciysls el( s;u0tltoxr ootomteanvs;s)s2xmxr oydlp nlnvtl() rtmxm nu1aptnmi3ias aDeanmsnt4arxnxr iatopDrlnei s)srurim oydlp n nvsl(  rtaxrpot0olto octydfmDul(vp u4 reoifcoatoa elueolt setoir nodlp e ivi (fs2tmx  nt0apen octasla rl(mp u)aleomf3oy1lpDean o t) rxoir oydal emnei ( sDrmurp;u0tex mfeiat m2eaumo;(0 leomf oo1fp  au s s0 rto(m3oy1alt lfes (f 2umuroot0tpeoiicilslm rmu p;u4arxomoctodopDelivs;s trur(mpnu4olee fvi s)aDtm(rpou4oexo o3iat m em( o;(4tlxoxr oodlp   nvils srtrxr3oy1ll n iviat)aDua(mpoo0opxnio3iltls2uln s;u)tetnmo3iadoaD auei;(  etr(mpnu1omen nvia()sDra(rp;u4olt micildlsDrmnms () lxrmrcoy1oatrln il() 2xr(m oo4lle mfvslt s2ua(moou4tex  ietlsfsDumnmonu4 reoir3oadlatr u ilt)s2uo(r oy1apen nctas a2tm(mo;o4aeenmfeilsfm2eanms;(4trtoif3oatlmt lnes;s s2um(r iydoltnmicta()sDtmxr oo4olx  octlsla rm(mo u)tlxnxfciotoate i ol(  2xr(r iy4lpen fesas)srrmurp;u1opxo o3ildla eaums u)aetnmf3totomtranvs;s0texoxrpiu4om n ietatfa2tmum ;t0tpenmf3iltfm2ua(mo;t)teeoirciodfmte u o ( srurirpnodapt mici s s2rm(  ot4oexoifetys a el(vsnu)artnmf totfpD  u o t  euoio no1ame  fvs t srrm( pnu1tpe ifciysls2rluvpnu) ltnxo ootomDeauvi;s seum(mpnodam elnei (f Dumur ;t4opto f3tatlsDelnvo;u4 etniocoydlaD au ols0texrim no1ape mnvtasf 2uaur nu0apeo iciasfs2ra(vs;t)texomociatoptrauei (0 rum(rpiudaleemietas aDumur nu1aeeomf3iltlsDranvsnu4 ltnir iadom raivsl(  2xmxr io1lm emnesat  rra(mono4tltomf3iytlmDeln s ()trerir3tatlmD  ieo;()srtmxr iu4al n iesat s2uaxmpno4ole  ieiytfs2em(mo u4arenmocoytfmDean o;(0texmxo3iodllen nvslt  rtr(ro;o4olxomf3ild s umnvpnu) lxrxf tytomt lnvi t sexoimpio1lpeelivt t artrumpnt0aexnmi3iyslsDumumo t)alxnxrcio1fpD lnei s0t2xoim3ny4om e fcsat) Drmu  ot0opxoii3tytfm2em( onu) ltriocootfat livslt trxrim iu4olenmncs () Dtm(mo;t4aeto f3tat m2umn o (4aexnxf oo1op rauvs;(0 rurio nudalen fctl( srtr(  ou0aeeomoetad m rmu snt0 eeomoctatfmtrlivi s) rumxopio4ome mfctat)aDtax  nt4oltn o3ild m2ra( o;t)artnmocoo1lpt lnvs ( t2xmxrpou1ap  livsl(faDua( ooo0opto fciydla2rau pnt)tlerxf3tatop ran s t0 2xrxrpiydlp  mncsltf rrr(  ou1olxo f3iyt aDumnvsnu) lxoio tytfaDeai ol()s2xrio oo4omt mfvsa( s2tr(m ;t1tpeoioeiyslmDrl(vp;(0aeenxocoy1fpteanes;t  eurio oo4op n nvt tfaDrrxmpno4tlx ifetlt sDel(mp t) eeoxr oodlpD aivo;s)teuoio3io4op   ictltfsDur(m nt1aeenioeiytfm2ranmo t4altoxf iodfa rlnvs s) etrxr nu1opeelfesatfarua(r ou4olt mociydla rau o;t0texoxo oo1op r neo ( t2xmiopno4ap nlfeils a2trur ;t4alxoiieildls rm(mpnt4 lxnir ta1fpteau i (0teto(m3nu4lp emiei t  Dtau  ;t4tlxnmietatfmDuln pnu)teeoircoydfaDrln o;( seuo(mpiy1ame  fvsls  Dra(ro;u0tlxoiietaslsDrlums u) leoxf3tydopteaneslt)teuoxmpny4ome  fvtasf 2urx oou4tetnmfciydfsDemnmpn(4 reoxf3oo1fmDrlivo;s) 2xoxopny4lmtemnvs s) 2trxm no4tpeoifetyd mDeau pnu4 lerif oy1opDe n i s0t2urir3oy1amtnmivtl()a2rau ono1oeeo f3tydfs2el( pnu0 leoxf3oo1opDranvi ()t2tm(m iy4lmtn ncs t)a2taxmp;t0olt ioctysfm rmu o ()alxnif oa1opD li i;s0 2xmir3iy4ap nlfetltf Drr(rp;o4olt iictld a ua(vsnt4tlxoxr iadlmt  uvsl(0 2ur(r nydom e iesasf 2umxrpnu1opxnmfetasls2umumo (4 etrxo tydomDraivs ()t2ur(m oudaptemivils) 2ra(rono4tet ioeiysfsDem( o (0 lxnxo3to1fmDe i sls texmiopoudolee netat  2raur ou0opeomoetas s2elu o (0 exomocoytopDeaueilt srxr(m3oo1opee fctlt)aDrau  nt1openifeiydfaDulu s () lermo iadomDrli ols t2trio3iydll  mnvtl()aDur(  ;o1alt if3iyd mDelnms;t) eeoxrciytop rau i s0sexmimpnodap nmneils) Dua(m oo4altoiocilsfsDranmp t0 rxnmr ootoa eli o;s) rxo(o iydlpe mfvtls  2umxr oo1tle mo3ildfs2emn s (0arerxoctadoptrlneo s tetrir ny4llenlfctls)arrrxm ;o0tetn ieiltfs uaumon(4areoir3iy1faDrln i s  rxm(opoo4apt  fetl(  Duau poo4optnio3tatlaDulump;t)arerxo oytop rauvs s)t2xr(m3oy4al nmici ( srur(  no1olxn ieiydfsDumnvs (4tetnxfctatfa  auesl() 2xrxr ny4lltnmnesasfa2ur(ro;t0aleomo3iad m um(vo t4 rtoxo3tatopDran i;s t2umio3nu1ol emivsatfarra( poo4tetn f3tldlm2rlu on(4 ltrio iatfm  auei;t)t2xmim nudaptnlivslsf Drrum ot4oexn fciysla2ul( sn(0arxnif3iy1lpt au i;t)sexr(o no4oltemfctlt)aDrau  ;o4alxnmf3taslaDelu s;(0 lxoif3ta1lmD anvils  exmirpoydlm elies t)artmx p;t1oetn octldla elnvpnu4aetrio3ia1omt lnes;t0 2xrxo3iy1al nlnvsa(faDra(m no1aexomf3iltfm2emuvpnu) ltoir3io1opD ln il(  2toio3nu1lm  mfes s)sDra(mo;t0openmietltls2elumont) rxrmf iytfa  luvilt) etmxo3oudlmt miesa(f Drax  oo4tlx mociatlaDrmuvpnu)aetrxf oodomD ai i t)trur(r3ny4ale lietltfs2trum ou4tee  feils aDelnvo t4aeenmo oa1opt  i o;s trxoir3io1lleemnvs (f Dra(m no0tpe mociytfmDrluvont4 ltrxr3ootomD  i i ()trurxm3ny4om n nesls) 2truro;u0oeeo i3iyd m ra( o;()texomrcoo1om r neo s)sruoim oydlpen nvtlsfsrtr( pnu4tetnmfeiydla2rm( p u0 rtnxr todfm  aieols0setoxm3oo1ll nliet ( s2rax ono4ale moeiadfaDul(vp;t4arermo3tytlatelu s t0 rurxm oudlm e icta( aDtmumpot4alxomietytfa umump;t4aetnmr iatlp r u slt  rxo(mpny1ll elnesat)sDuaum ou0ole mfeiydls em( snu4 eeomo iydfpteanes t0t2trxr3nu1op elies sfs2tau  ou0aleomi3iat sDean o;t)trtoirciotlat livol(  2trio3oo1lp  lfcs tfaDrmxmp;u0tpt  o3tytfm uln o u4tltrxo ia1omDrauei s s2umir3iy4olt  fct s arur(m no0apeo ieildfm ua( o;u0artomo3tatoa r uvs;(  exrim iydolenlicslsfaDururooo1oex  f3ias m2emumsnt0aeeoio ta1opte uvo;t0seuoxm iy1aptnlict t aDtaxroot1oeen oeiyd mDeanmp;u)tetnmrcoydfp  lues t  exoxm no4lptn ics t)a2tmx pno4tlxoii3tlsfs rlnvs u4alerxo oo1lpDr i s s0seurxmpiodopenlnct (  rur( pnt4oetnioeils m2em(ms;() exrmr iadlat  u ol(  rxo(m3nudlme mict s)aruaumo;o0aet mf3ild s uaums;u) lxrxf tydoa e iei (  rxmir3oodap n fcs s artr( o;t4tltoif3iadls2rmnms ()arxrmr3tydfm r ivi;()setr(r oo4lpt licsas aDrmx p;o0oleo i3ilt m2ua( o;t0 rtoxo3oy1oatelivs;t0 2ur(rpno4om  lnvsat arrm( oot4tltn ietlsls2umu pnu)trxnxr3tydopt  nvi t)t2xrxm3iu4omtnlictat)arrmx oou1altn i3iytlsDul( o (4aeeoif oy1omtr u s t)trtmiopnodlptn nvs ()sDumu  nu4oeen oeiat m emuvpn() ltrmf iotlatelnvo s)tetmxo3nydom elnct t arua(rpoo4optnmf3tysfs raums u4tltrif3oodoatelivslt) exm(o iu4lpenlfetlsf Dur( pot4alt  f3iydls2uluvpn()tltrxr iadopD livsls0 2toxm3no1omtn ics s) Drmxrono1opxomo3ilt m2em(mo;u4 exoif3oa1oatrln o;(0tetmxmpny4lmeelfeil( sDtrxr ;t4tpeoiociat mDua(von(4alerxocto1lpte ieilt  2um(r3oydameelnvsasfa2ta(r ;t4tleo ociadla rlnvs;t0 etomfcty1opt  uvol(0 2umir no4am e ict (f 2uru p;u0apxo ictldla rlnvp;()teenxoctatoaDrlnvo;t) exo(rpoy1altemnetl(fsrrm(m ;o1opx ii3iaslm2eanms u4arenxrcoy1om raieo t)t2xo(r3iu1ap nlietasf 2rru p;o0apxnmf3iys mDra( o;t4teenxr oodfmtranes t0seuoxrpoudol nmivt (  2rm( pou1ale  oetldlaDuanms u)arxnxocio1om rlieols)trurxopnu4lp nmict (fsDtr(ro;o1tee io3tasla2rmn o t4 ltnmoctotomD  ieo;s)srxrim oo4op  lnciasfs2uaxmpno0olx mieild s2ulumont)trxomf tydomteaneslt0sexoxmpnu1lmtemfvia()s2rrum ot0oexomietat mDul(mon(0 leoio3to1oatrln s ( t2um(m oodap  mivt (fs2rrxroou1alx ioctlsfmDuanvs;t0 rxrmf3oy1laDeli ol(0trxmim nydomeelncils)a2umxmpnt4oeeoii3tys a2eaums t4aexomo iatfp  aivol()sexoim3ny4altemiesatfsrta(  ;o0olxnmiciyd sDelnmp;u4trxrxrcoa1oa eluvs;s  eto(r3nudlmtn feilsf Dur( p;t0opxnmi3tltfa2rau pnu0arxnmocio1la e ueils) 2to(m ou1lltn nvsl()aruax  no1tleoiicilt m elnvp;u0aetnmr oatoat lnes;s0 eur(o3ou4opte nvs tf 2ua(rpnu4tleomfciys a2em( s;t0altoxf3todomt  uei;s)srurir3nu4optelfvi s)srta(m nt0opxniiciasla rau s;(0 rtoir iotlp rlneil(0 2to(o oodaptnliesls a2rm(mono1aeen ieiltfm rlnvsnt0artoio iydfaDeli i ()teumxo ou4lme  iesl(f rtmu  oo4apxn octls aDul( pn(4tlenmocoa1lpte neol()srurxrpoy1lp e neil(faDtaxmp;t0tlxnmictat m emnvs;u0 eermf3tydlp ranvols)texrir3oudol nlnei s)artm(  oo4apxoifctadla2eau s;()teenxf3iotfmte uvslt setmxr3nu4om nlfvtas)sDrrumoot0olxoif3ils m ra(vs;u4tetnmocia1lm  auvilt) etoxmpiu1lptn ncs ()sDua(  nt4apeomf3tat s ul(mo;()aexnmrcoodoatraueols)setoio oudolt  fvias  2trump;t0tlto i3iyd a umumon()altomo3tadlp elies;t  rtmiopoo4ameemivilt)srumuro;t1tetoioetydlmDrln o;t4altomr ootop r nei;t0t2xmiopny1openmivsa(f Dururp;t0alxoifeiatfsDrau o;t)altnif3ty1lmtelnesl()seur(rpiu1ome mfeslt  2rrxrpou4oeen fciytfs elumon(0 rerirciy1fp ranvsls) rxoiopny1om   fei (faDrmx onu1tlx  o3iasfmDuanmp u4tetoir oa1opD ln i;() 2xoim3ny1oltnmfcilsf 2tax  ot1alenmociytfs ea( s;(4 rxrxoctytfm eaneil(0s2to(r iodole lneilsfa2raurpnt0aetomoeiys a uln snu0tlenif oodoatrluvo s)tetoirpoydam emiesa(faDua(rpot0aexnmfeiltfaDrm(mo;(4 rxnxf3iotlp  ai ols0 2tm(o oy1op e icsa()arrmx  no0apeoifetyslm rmn o;(0tlxnifctytfm  ln o;( s2trxm io1ameelnetatfs2rr(m ;t0texn o3iasfa el(mp;(0arxoxociodopDr uei;t  2tr(rpiu4ape  iesl( s2um(moou1aee mi3tysla2emnmpn(4tleoio iodlpt aneo;t) 2trxrpiy1lm  mnvs s)aDtmxmpnu1tlenifciys a2umn p (0alxoxr3todomDraiesl(0t2xmxrpiydll   nvtl(  rtaurooo4opt  oeiadfa2um( pnu) exnxo oydlatranes;t trxoxopoodll e iei s)aDtr(m ot0aptn fetat a2ul(mon()tlenmr io1omDelueslt0seuoirpny1lleelicta(fsrtrx ooo1tlto ocildfm emump;u0arermfcoo1opDr n o;t) 2umiopiy4oltn icsasfarrrumono0olx mieiytfa elu o;u) rtrxo ia1omDeauvsl( teuo(rpny4omee feslsfaDuaxrpoo4optoif3tlsfa ranvpnu) lxrxr oodlm   n o t  2trxo3oodlpeemnesa()srrrxm ou0tpe ifeiydls2uln sn()arxrxrctatopD ln o t0trum(m iodom e nvtatfaDtm(r oo4alto fctyslsDum(vpnt)alenmf oodoptelnvils  etrimpnudal n fvsltfarra(mpnt4tlxoio3ild aDelnms u4 rtnxr3oytlpDr nei s  rxmim3oydale mfciatfs2tru pnt1aex  ictldlm2ra(vo (0 ltrir totla  lnvil( trurirpnydllt micslsfsrrrx pno0altnmo3tlslmDem( o (4altoxf3iatoa rauvols)trxoxm3iudalt mfesa()artmumont0tee iicias a ranvpnt)arxrxrcoy1fp eli ol(  etmxm3no4lmenlivsls  Dtmxronu4texnif3iad m2ra( pn()alermrcoa1fmDelieolt0texrimpnydoltnlfct (fa2rax p;u1apxoif3iltlmDumu pnu)aleoir totla eau o;t s2xmio3iydapt lfcsls)arumx  nu4apto i3tltfa2uln pn(4artnmfctotop  anvil(0setrio iy4lptn feils  2ta( p;o1tltnmfeilt mDrlnmo;(4tlxomfctatomDr uvi;t)sexo(m oo4aptn nes s)s2rrxm ;u4oeeoif3iysla2um(mpn(0 ltrio3iatfm  lues t setriopno1ameelivsl()sDuax pno4tlenio3ild sDeanms;(0 ltrxrctatfpD  ueo;(0sexr(r oydapt  ici t)aDra(  ;t1optomfcildfsDrm(mo t) lenifcoadlp  aieo;t t2xrxr ny4al e ictl() rtr(  nt1tltoiociydlm ulnvo;u4trerifcto1lmt luei;t) ruoxr iudaltnlfes tfsDtrxrp;o1olt mf3tysfa2emnmsn(4aleriocoy1laD  ivo;s) rxo(r3iy1alen fesl(fsDtm( ooo0opto f3tlt sDulnvsnt)tetomr3ta1lateli olt tetoimpiy4lmtelfei s)sDta( oou0apxnifetls m2uau p t4altoirciydopDrliei t)s2uoir oo1apte nesat sDrmum no4tpeoiociltfa2emn o ()trtnmf3ia1lmtean ol( trtr(o oudaptnmiei (  rtrx pou4olt  i3iatfm rlnvpnt0 etnio3ty1opteauvi;s0t2xmirpny4ape  nvsasfarta(m ot1oeeo iciasfaDrmn p;(4trxoxr3iatop eaieols0teto(opiodop n ivtls)srraxmooo4olen f3iadfs2ua(vo;t0aetnxf3to1laDeanvi s)t2xoxopoo4ape  fcta( aDtr(  no4aetn i3ils s2ua( s u4 lerircio1op  lu i;t0srumimpoy4am nlncil(fsrra(ro;t4aetomfcilsfm elnvonu)tltoxrcoo1lmD aueols0 2urxmpoudlp nmivtls aDrrxro;u0oeeoioetlt m2uanvont0texoio3oa1fpte ues t trtoio iodol e fvt t a2tmxmpot1alto o3iatfa rlump;()tleomr totlmtraivolt seto(r oy1lpe mnctasf rraxm no0openioeilslm2elums;() ltnxo todopt  nei;t0setrimpiudlle  neilsfsDuax pot0oltomo3iadlaDranms t4teenmf3oy1fm eaivi ()texm(opio1ap n neslt)aDrmumpno4aexnmi3iasfm emn sn(4alxrxf3tydoa r ivsl(  2tmir io1olenlnvt ( a2ua(mpot4apeomfciyslmDeanvpnt0treoxf oytoptr neo t0 euoxr3iydol emneias  2tax ont4apeoifeiat m eanmo;(0aeerio tatop  li o (0t2xo(m3iy1apee neta(  Dur(r nu0tle mociatlsDuauvs;(0 etnxrcoytlaD ln il(0tetm(m ny4apeelnci tfarrm( ooo4tle moeilsfmDrlnms;() etnxr iatomDr nei t  rxmimpoy1lm  lnciat artrumoot4apt  fciys aDel(mont4aetoiocoa1fmDeaueo t sexm(rpio1opt  nctlt) 2uaurp;o1aeen fctasls2emumo t4 renxf3todoatraueo;t  rtmxo3io1lm emivtlt s2tr( oou1aex  fetatla eaums;(4tltnifcoa1fateaiei s  rtmxr3iu4ll e ncils) 2raxr no4apt miciatlsDeaumont)aexrif3oo1lpteau o;( t2umxm oy1lpe mnei ( srtru  oo4tltnmieildfa2uau o (0arxomociodopt lnei;s0setr(m3iy4lmte ivi s) 2rmu p;u4apxn ociasfs2eln onu)tlxrxf tytomD aies (0 2xoxmpoudape lnci tfsrtaumooo1teeo f3tasla2rau pnt0arxnxf oo1laD aneo s0t2toim ny1olenmnvt ( a2umxmo;t4tlenifeilt m uluvs;(4aeenxr3oodla r uei t texoir iydlp  lictatfs2raxmp;u0oet if3ils s rl(ms (0altnxoctytfptrluei;()srxmim3iudam nmnviatfsrtax pno0tlenmo3iysfa2em( o u) ltnxfcto1fa  livilt0s2xr(rpiy4opt lnci (fsrtr(mooo1oetoifcias s rmnvpn()artnxo oadfaDe n s (0trumirpiu1llenlivtl( artm(mo;t0tpenmf3iasfm2uau o;t0trtrmf3iydop   uvs t t2toxr3ny1ame lncils) Duaxr nt1aetnifeildfs2emnmo u)aeenmr ty1oa ran i s) 2toir3nodoptelivs s s2rmu  nt4oeeoif3tysls uanmo u4aetrir tydla e n s;s)setrirpnydlltemnesl( s2raurpot4aptomi3tytfaDeaumo t)teeomrciydlaD lu o s t2umxm oodol elnetls)aDraxrpot4tle  ietyslaDuluvp t0 lenmr iytfm r ieol(0 exmio ou1olen fvtlsf rtru  no4ale ii3iyd mDulu s u0trtnmfciydfat auvs t0srurio3oodaltnlnct ()aDtru o;t4opeoio3tytlsDemumo t0 rxrmo3ty1fm elnei ()teuo(r iu4ll e fet (faDta(ront4tltomictldls2rln snu)altrirctytfmtrai i s)seuoio ny4optn nvtls  Durur ou0aet io3tytlaDeanvo u) rtrif3ia1lpt  nei t)texrim3iydale mfetlt s2tmu  oo1apxo oeiadfs2rm( s;u)aetomo3io1lat lnei;s0srxoxr3oudoptn ivtat)srra( o;u4apx ifcild sDrl(vs (0areomr3oodfm elueo;t)s2um(r3iodlpt  ivil(fsDrm( oot1tleo o3iysfsDem( on()trenircoytfa  aies;t)texrim3iu4om   fcias) 2um(mont1tlx  ociytlm ul(vs u4aeeoxocoytla elivi;t trxo(m nu1lm nlfcsls)a2raurp;o0tptn fctldla ua(ms t0arxnio iytop elnei;( t2umiopoy4lleelneil( arta(rpoo4alen oeiat a2ranvp t4 rxrio3tatla  luvsl() rur(r3ny4ameelieia() rua(rp;t1tpt  fciydlm2ra(vonu) lxomr tytfat  n sl(0tetmxm nu4ll  lnvtls) 2ta( poo4altomieiltfa emumonu) eeoxr3ta1lpDe ies s0s2uoir iu4ap nmfci () rtr(  oo4tet mieildlm2rmnvont0 lxrio3oa1fate n o ( trurir nu1lptelfcia( a2ur(m ot4ole mo3tldfmDul( o;t0alenxf3iydopD ln o (0seurxm3io1llt  ncilt)srrmxr oo4tetnmi3ilsfs2rmu o ()trenioctytfmte i i t0 rto(r ny4op  lnvil(fs2ta( ont0tetoiieiasla rmu pn()alermr3oa1omtraieilt0teurirpiudal n fctlsf Dtr(ro;t0opeomociatlmDul(vo;(0 ltnir3todlmD aiesl( srtrirpio1lpeelfeil(f 2rru  nu1teeoifeiad s rmuvs;t4trxnmr tydomtr ivs;( trurxo3oy1lltelivilt sDra(r ;u0apxnii3iysla2ulnmp;u) eeoxf oo1omDr iei s s2xmxm nodllee nei t) rtmuronu1teen fetat aDeau p ()tlerxrcoo1fmt  ueslt  2xmir3iu1lm e nvt sfaDtau pnu1oltn iciat mDrlnms;t) lxrio iy1lmtraies t0texmir3iy1optnmfvt s  rururp;t1olt mfeildfa uanmp;()trermo iy1omte n o (0trtoxopno1ame  fes t)aDtrxr ot1aetoioeiadfa eaums;u4alxnmr3oy1faDrli ol( srur(r io1lm  mivtls) rtaxr ou4tlx  fctasfm2umnms t0 lerio tadlpDelnvi;(0 etrimpny4ap nliet (  rtmx oot1alxn f3iydla eaump;()texrxr3todoaDr uei;t)tetrimpio1ale mfesl(fs2tr(rpnu0optomoctldlm ul(vp t) ltnxfcoytfm elieilt)seur(opnodolt mfctlsf 2um(roou4aleomfctldfs em( snt)alenxo iotoateaiei s0tetm(rpnydol nlnesasf rtrumooo1teeomi3tas a ulump;t4trerxfcto1lmD aies;s)s2tm(opiu4om nmfesa( srrax  nu0tpxnmoeiasfm2rmuvsnu4 rtoif oydopt lueols0texrxr oodlpenmivtat) Dtr(moou1oex ii3iytlm2ea(vs;t4alxnifciotlmtr nvolt0 exoxrpno1alenlivi (fartrurpot4aex  ocild sDrmumo;t0 lxrircio1oaDr u s t teurim3iydaptnlnvt ()artruro;o0oexn ieiadfa ea( p (4aeeomr3to1oat  ues;t sexoirpnodame lnei (f Drr(ro;t1opeoifcilt m2um( s;t) lenio3to1fate u i;t  rumxm io1am   nvi s  2uaurpou4oeen o3ilsfa ea( o;t4 exnmr3oy1om r i s;(0seto(o iydopt mfeslsf rrru ont1tpenmi3iydlaDrl(msn(0 exrxr3tatlatr n s;s) etrim3oo4oleelfcslt a2rrx pnu1olenif3iys m2uan onu0arerxf oydfpDrli i ()trxmimpno4apenlfvsa( sDtm(ro;t0apeo o3taslsDrmnvo u) lenmfciydfa elneslt0seuo(opiy1aleemnvias aDurxmp;u0tpt  ietyt s rmnmp;()aeermoctodoate u s;s)t2uoxopny4ape mnvi tf rrm(mo;t1oltnmiciadlsDeanvp (4 lermr3iytlaDr uvilt)s2xmxopno4altelicils artrx p;t1oeeo feiadfm2uluvsnt)altoircoy1fp r nesls)t2uoimpio4lmenlivilsfartrxmpno4tlt iieils s umnvonu4 lenmo iydfmD au s s)trurim3io1lp  livs s arum( o;t0oeeo oetldfs el(vs;u4 exrxf iytlm  aivs t  rxmxo iy4op nmnvt sfsrtmx  ;t4opxnif3iasla elnvs;u4 ltnifciodlpDeluvs s srtmio3io1oltemfvslt)arum( pno0alxo ictls sDumnmp t)texnio3tytfa  ai sl()t2tm(opiy1lmeemivsat s2raumpno0ale ioctls s2em( p u)areoxr3iodop raueols0texmxm nudapen feils) Dtaxrpnt4tpeo o3ilsfsDemu snt)teerxr3oytlm elnvs s  2toir3io1ll e feilt s2rmuro;u0opxomi3iadlaDumu p t0 rtnmociatfa r u o;s  2xr(m3iy4lle lnvilt)a2tr(  nt1alen oetytfmDeluvp t)trxoxf iadla e nvo t  rtrirpiudaltn fctat  Drrumoou0tpxnmoeiltlaDea(vs () ltnif ty1omDrluvilt)sruo(m3no1al emncilt) rum(m nu1aeen fciys aDrlnvo;u0 lxomf todfm  au s t trtmio nodlmeemieiasf rumum oo4tpx  oeiadfa2ul(vs;u4 ltnmrcio1faDranvi t0sruo(m3iy1alte feils) 2tm( ono4tlxnmoeiltfs2rm( p t) exoio3iydfpDeluvi s0s2tmxo3ou4ape lnvias) Drr( oou1apxo o3tatlm ra( s;()tlxnmo to1oa elnvs s  2umir io4ap n fct s)s2rax p;o4tex  i3iadls2el(vont0trxoxo iotoa raies;t0 2tmir3no4ol  mnvtl()sDrmur ;o4apxnif3taslsDeluvo;() reomfciytfaDean i t0tetmimpiodoptn fvsa()arrr(ro;u0alxnioeias s2umu p u4texnmrcoo1fa  lu il( t2ur(mpoudop nmfvsat sDtmurpno1tetn f3iatfmDuau pnt4alxnifciodfmt luvs;t)t2tmxmpoy4ll n ivtat artrur no4ale  fciytfaDum(vsnt0trermrcto1fmDranvsl()teto(m no1lm  mfvs t) rururpoo0aexoioctydfm2uau pnt)tltnxo3ia1lmtr ieilt s2tmir oydol  lnvsat)a2rr(m oo1tptnmi3iysfm ra(vp t4aetnxr3to1oa   n sl( setoim3io1ameelieia() Drmxro;u4tptn ieiasfm el( o (0aetoxf io1laDe u il( tetr(rpny1ap e ivtlt)aDtaxmooo1olxnmoctltlm rl(mo ()aeenxo io1lmDrlneo s)setmimpoy1altelfvsl(fsDtrum ;o0ape ifciad mDem( s t)tetnif3iodfp e n sls0s2toxo nudoptelfei ( sDraxroot1aleoifeild m em(vp;()texo
\ No newline at end of file
@@ -0,0 +1 @@
+n s;s)teum(m3oudol elfctat)arrrumoot1ale if3tld a2em( s t) eenio oadopDe uvs;()t2urxr3nu1op emnes ()srrm(r ou4tlxn i3iyt aDel(vpnt)tlxnmo tatlmDrlnvo ()seurxm3nydol emivtlt arrm(m ou4tptoifetyt m2um( p t0aeerxo3iytfmDrluvsls0texm(rpnu4opt mnvsl(fsDtm(r nt4aet io3iysfs uau s t)artnxfcta1omt  neilt  rurxmpny1omtnlfeslsfsDumumpou0oexomocildfm ua( ont)treomo oa1oaDrln s t0 rurxr oydoleemivsa() 2rrxmo;u4tltomf3iasfm um(vp u4 rtnmrcto1oa ran o ()t2urxo3io4lpt  ivtlsfs2um(mpou0oexo fctaslm ea(vont4areoxr3iatoa  aneils0 exo(o iodllenlictlt)s2trxmpot1altnif3tldfs em(ms t4 ltrxfcootfmtelu i t0s2xrio oydaltnliciltfsruaur nt4aetnmi3ils a eanmpn(0tetoif3tytlaDr n i ()s2trxmpoydlmt licsa()a2ua( pou4tetomfctyslsDum(mpn() eenxr3ta1omDraieils  eurxo3nu1aleemfci s  Dtaum nu1tlen ieiydla2elu o t4arxoircoydla r u i;s t2xrxrpno1open fvias  rurxr ;t1aptoiieilt a2emn o;t0 lxoxocta1lmte n olt t2uoiopiydomtn fvsa( arrmur ;t1opxnio3iydfm um( o;u0arxrmr iadfateanvil(0 eur(opiodome mics s aDtaur ot1ale  f3iydla2rluvsnt)alenio io1fmt lueo t  rtoxr3nu4ope mivt (  2um( oou0apx moctltfmDra(mo;(4 rtrifciytlmDrlies;( srtoio3oy1op elncias) Dtrxrpoo4ale mi3ias s2rlu s u4aetrif iydlpDe ueol( teumim3no4aptn neilt)arta(mo;t4tpto f3tat mDra(vpnu0alxrio tytfmDraneo;s)s2urim3iy1ome  ics t  rrau  ;t4alt if3iadfa umnvo;t0alerirciydfaDraivi s sexr(m3no1ol e nvs t a2raxr ;u0aetoifctltfs2eanmo u)arenircia1fmDrliei;s0sexoio3ou4omt  fvt (faDurum nu1tlt  ieiytfsDea(vp u0altnir3io1omt  nvs;t) eumxm3iu4oltn feta(fa2rr(rp;o0teeoio3tlslaDuan o;u) rtnif oy1fp  aivs t0 rtrxmpiudlmtnlfvi tf Drruro;o0apx moctasla raumo;(0aetoirctytfm  aivol()s2umir iu1llt livt (fsDtaxm nt4aeto i3ias aDuluvpnt0 etrifcootomD aies;() etrirpou4lpe lncs s)aDtaxm nt0apxoiiciadfmDumuvs (0 rxoio oadfmDrli ilt0 rtr(r3iodal  lnci (f rum(rpnt0apxomoctlsfmDrlnmpnt4arxoio3iy1omDrln o;s  2toimpny1lmt mnvtl() rtrur ot1aptoif3iadla emnvp (4 eerif ta1lmt lueo;s  2trio io1lp elfesl()srrrurp;u0tpto fciytlm uauvo t) rtoxfcto1fp elivsls) rtmxm iy1op  mfct t)aDrrx oou0apenmfctadfs2rl( s t4tltoxo io1fmt aivsl()trxoir oy1amtemivi (fa2ta(monu4tpx mf3ilt m rlnvp u0aetnio3ootfa   n o;s t2xm(opnudal e fctasf 2umxront0aptoii3iyslaDemnvo t)tlenxf iatlptr uvols) ruriopiudomtemnviat arrrxront0alto ictltla2uanvo (4 lxrir3oydlat  u il()s2xmim3oy1amtn fcsls)sruax  nu1ope ii3ils s ra(vo;() rermo3iatfaDrlivo;s  2toiopno4llte nvia(f rtr( pot1oetoiociatfm ea( pn(4trxomo3iydlatrli slt0 etoirpno1omenlivia()a2tr( oou1tltnmf3tatfa rl(msn(0arenir3todoaDeanvi;() rumim3iydam  mnvtat  rum( onu0tpx miciltfm rm( snu) rtrmr tydoat  ues;t)s2xo(r3nu4op   iei t aDraxmp;t1ole mo3ias s ea( snt0 lxrxf oydlpteaneil()sexrxrpiu1lltnlnvsat) 2ur(mpot0aeenifcild a2em( p;u) exrxr3tatfpteaivo ( teum(m3iu4apeemfcs (farumuro;t1aee io3ilslmDrm(mp u4aexnxo3oodom rlueolt texoim io1op e nvsls  2uau  ;t0apto octadlm umn snt) rxnxfciadfmDeau ils) eurxmpno4opeelncia() rrax  ;t4aet iocildls rm( s;t4texoxrciy1omDelneol( srtoxrpno1ll emies tf rua(r ;o0tpenmi3ild aDrl(von() eerxfcio1latean olt s2uoiopiydllenlici s)srrru  nu1aex ioeiat aDulumonu4 rxnio3iy1fmt  neil() 2umxo3nu1ol n icsa(  rtmu  ;u0openmfciasfs rlnvsnt0artnmr3iydfa eanvi s0trtoim iydlp n icilt aDrmumpnt1apxn f3iatfa2rm( o;t4 eenxo3tydfateai i;t0 exmxm oydoptn nvtasf 2rr(r no1ole ioetlsfmDeluvs t4aexnio oatoa  lnei;()s2um(m oo4optemfvt t)sDrmx ooo0tlxoiieiat mDrmuvsnt0areoifcootlmDeaieo s)teuriopnodal emncils aDumumonu0oltomfetls mDuan s;(4trenif iadoatelnes s0t2to(o iydll   ici t)a2rrump;o0olx iociat s ranvs u)aetrir3ta1faD lu il(0setoir3iu4lmtn fvils)a2rax  ou4oeeomi3tadfsDrlnmsnu)alenxo3ia1lmDr i sls)trurim iodap   nctls) rtrx  no0tet  ietlsfm emnmpnt) lxomfcoy1la  lu s t)s2toxm iy1opte fciatfs2urum ;t4opx iietldls2ra(vo u)aeenxr3oytopDe i ol(0seuoxopio4op e fct () rraxrooo1openmieiydlaDuluvpnt) exnxf3ta1oa  lu s;(0sruo(opoo4altemnvilt arrmu  oo4alto f3iltfsDeanvo t0treoxoctadfm rlneo;t  ruoimpnydam  mfcta()s2ua( o;o4oet iiciad m umnvp t0 exoxo oodfaDeln o ( srum(opiydom   ncs t  rum(mooo4tptoio3ildlm ulnvp (4trxrmrctytlateln i;s) rxo(r3nodlmtnmnct s srrr(r nu0alt  ociytfmDranvp;(0tltnxfcoytfmD  neol( setoxmpiudlp e ies s  rrmxm ou0oet  o3tatfm2ra(msnu)aetrmo3oytfaD aueils0setm(o iu1al   neil(fa2uaxr nu1alxomieiltfa ua(mo () rxnir3tatlm eaivi (0s2urxm oy4optelnvil(f 2rr(moou4tpen icias s2em(vsnu4artomociytlptrluvsl() exmxm3oudap emnci ()s2urum no1aptniictaslsDulnvo;u)aeerircoodfaD  u i;t  etrxm3iodol elnvi s)arumumo;o1tex mociadfa2umuvpnu0 eenio oo1fatraues;() etrxo3ny1amee ivs t) 2tmurpnt4tleo feiysfa2um( o u)treoif tatlmt li s;t tetmirpou4om n fct (fa2taur nt0teenio3iytfsDrm(mo u)aeerxf3tatla e nvol(0srxm(mpoo1apeemncia(fa2tax ono0aex  oeiasls rlu snu4alerxrctydomD auvi;s teuoxr iodame  fcs tfsDur(r ;t4aetomf3ilsfs2emnvsnu0tltoifcootfaD ai i;s0s2tmim3oydal   ivt (f rtrumpot4apenmfetytlm2rmnvs;t) renmrctytla  lnvilt  rumir oy4ame mfvils srua( pnt0ape ii3ildla2ul( o;t0alxnxr3to1fptrln s;t0texrim ou1apte ivt ( arrm( pno1aeeo f3iatlm ran s u0tetrifctotomt  uvo;s)srxoim nodalee ictl(  2tr(mpnt0opx mfetytlaDrl(vsn() exrmrcto1la elu sl( s2um(m3io4apt mnetlsfs2rmu  ou4oetn ictyd a rmnms;t) renmrctytoaD luvol(0setoir3ou4lpenlivtas  2rrurono0aee  fciytfa2rlumsnt4alxnmo3oa1oa   ieilt)trurirpnu1alt lnei s  2rr( onu0aexnii3iatfa umuvo;u4 renxo oy1oatrauvsls)setmir3oodll elivtl(fs2rm( ooo4tpt mieiad aDeau s;(4tlxomf ty1lmD luvo;t0seur(r3io4lm elfvt t arur(mooo0texnmi3ildla2eln s;(0tltrmo iydfp r ivi s s2uoim no4optemici t srrrump;o4aee mi3tasfs2ea( onu)arxnmo ootomtelu s (0 eurxr oudlltnmiviatfs2tmurooo4apxoioetyt s ul( snu4 etrxo tatfmtraivs ()seuoiopoydlmtelfci sfa2trxronu4tpxnifctlsfm rlump u4 ltomfctytfa ranvo t  euo(r3iodom  mietl()sDur( o;o1aex  feiadfa2rl( o (0trenxf oy1opte ieo;( truoxr io4am n nci t)aruau p;u1aptoii3iyd s ulu o u) rxrmf3to1oa eaivi s0seuo(o nudalt mict (  Dtrxroot0opt iociydlsDrln o;t) etomo iatla rluei;(0srurxo io4alt  fcias)srur( p;u4tlxn i3tltla el( o;t)tltnmfciadoa ran s;t)setoxo3iu4oltemneia() Dtru  ;t1apx mociyt sDuan p (4 eermf to1fpt  uvi t0sexoim3ny4altn fei (f Drrumoot0alxnioeils s2eanvpnu0alxnir3io1oa r n i;t0seurirpio1omtemieilt s2rruronu0tpenif3iydfsDumu p u4 etrxf tydom rlueils0 rumxr3nudame mneslsfsrtaur ;u4apeoioctlt m2ra( pn(0tlxomr3iatoateauvs t)sexoxrpno1omee fcs t)aruaxmpnt0opx  iciad m eauvo u)aeenxo iy1fm rlnvi;( trtoio3oo1am emivtlt  Drrxrp;t1alxomociatfs eauvo;u4arenif oydoa ean ilt srto(r3io1aptnlfcsa(faDurum ot4aptomf3iyd s em(mpnu4aexnxfcoytoatelivsl( srxo(rpny1lmtn fcias s2uaurpoo1aeeomietldfs2em(mpnt4texnir iydlat lues;()t2to(o3oudomt mnetltfarur(ro;o1aexniictlt a umu on(0arerxrctodlaD  ieslt) eurio3no4ap emfctlt  rta( pnu0tleomfctatfmDrlnvonu)arxnmf3totopDeaivo;s0s2uoxrpio4ole lnctas)a2ur(rono0tee moctls s eau s;t)texrxo iotla e iei (0t2tr(o3oo4lmt  nctat srumuroou1aleo o3tadlsDul(vo (4trerxo iotopD aiei t0t2ur(opoydol nmfcil( sDuru p;u4altnioeilt sDeauvo;(4 lxnmo3tytlmDr n s t srxmxm ny4llt lnctlt a2uaxmp;t1texomieilslaDrm( s;(4teenmr3tytla ean ilt) rxmxo oy4lm nlici () Dtmx  ;t4tlt ifeiys aDuau p u4alenmoctytfm   i olt  etmxm nodlmenmfvtat sDum(r ;u0tlenio3tasfm2emuvp ()tltoxo oodop elu s;s0srxrxm3io1al emivilsf 2tm(  ot4texo i3ilsfmDea(mpn(4trxnxr3oo1lpD aneo t)trto(o ny4lpe lfvs s  ruau pou0teeoifeiytlsDuluvp t)trtnxf todfmD liesls0 eur(m oodlp emnvs sfaDtr( pnu4olxnifeiltfm rl(ms u)aleoircio1om  livo s0s2um(o3oo1lpt  nvs tfs2uaxmpno4aeenmoeildfa2em(ms u0 rxrxo ia1fateai il(0t2toxr3io1alt lfet s) 2taxm ot1aet mi3tadlaDrmuvs t0trxnirctotoa  anvi;s tetrxrpnydop emfvs ()arrax  no1oet ifctlsfm umu s (4 rxrio todoaD ai s ()texm(r3oudlm nmicia( s2rrur ;u1oetomo3ild a rlumon()texoxo3tatoat an i;t)texmio iu4lm n nct () Dtmu pou0opeomieiat a rmn p t4 lenxf3oy1fmteai i t0 exmxm iydomt  nvta(fartr(m no0oleo i3ilslm rmumo u) etnif3tytom raueols0s2xr(m oydome lnvtls  2ra(rpnu4texnmfeiadlmDeln s t4 renmf oa1fpDr n s;t) 2umir iu4op e ivia()a2rrxrpou4olxn feiydfs rauvp;u4aetrmo ty1opDrlnvo (  2xmim oodope mici (f 2rax o;t4aptn feilsfaDelump (4trxnmf to1fm   ivil(0tetoio3nu1amtnlfvtat  rrr(mo;u4opeomieiytfa umnvsnt4arenif oytomD lieo (0 exo(rpou4apenmnciatfsDtm( pou0tpeomoetls a um(mo ()aexnir3iy1om  aieol(0 rur(m no4lptnmncsl()srua( o;u4oee iociat s ul( p;u)teerxrcty1fp  an s ()sexm(m oodlltelnctlt)aDumx o;t4aeeomi3ias m2rm( p;t) etnmf iotla  li s;( t2tr(mpiu1lm nlncilsfarurx  oo0aeeo iciysfs el( p (4 leoio3oatfa eli o t) exoxmpiy1ll  mncs t)s2trx p;u1olx mfciytfm rl(vpnu) ltoiocootop  li i;t0trxmxmpoydapteliciasfarraxrpnt1tle mfetldlm eluvo;t0aexomfcio1om   nvi;()t2xr(m3no4lptnmfvsas)arrrum oo4oeto oeiydfa2eln p (4alxrxf iodfptrai s ()seuo(m nodal e ncils s2tm(mooo1oetnmfetysfa ulnvo;u)tlxrxfciy1lmD  uvils  2urxo3iodlpeemfvi sfaruax p;u1openif3iad aDul(mp;(0 ltomo oa1fa r nvo s0truoxrpio4aptnlncia(fsrtaxr ;t0aet mi3iad a eauvp u)alenir3totomt auvs ( trtm(mpiy4oltn ivsat)aDrru p;o0aee ioeildlm ua(vpnt)aexoxr oo1fpt  ivs;t trurxrpno4al e ictlt)s2trxr ot1ape io3iltfa2umnvs t0trtrir iatlpDrlnes;()s2toxm nu1altn fct t)artrumpoo1olxomo3iydlmDrlu onu4 etrir ootop  lu ol(  2uoim nodameelici ()srur( poo0aeenioetltfsDelumpnt4arenxfctadfm rln i s0sexmir ny4ol   netlsf 2rmumo;o0altniictlt a2elnmpnt4aetnmf3iy1om ran o;( s2urxr ou1ap  licsa(faDua(mpoo1tpxnifeiadlaDrmnvsnu4trerxfctydlat lnes t)tetoio3oodapte nvta(fsrumxroot4opt mociys mDelu o;() leomo todoptrlnvsls  rxrxr oy4omtemies t)s2umxm ;t1alxomi3tld aDua( snt0alxrmo3to1omtrln o t) 2toiopoo4amenmivslsfa2rr(  nu4tle  o3ils sDra( s;u0altrmo3tadomD li slt)srxmxrpiu1lp e fciltfa2tmxm nt0tee ii3ildls rmuvsn() ltoxo3oytopDe ues (0 eum(o3nydol e fei sf rra(mooo1aet mi3tlsfsDel(vo (0alerxfctotomt  nvsl(0t2toim3iu4apt liei (f Durxrono4teenmi3iys s rmump;t) reomo todlpteln ils  eur(m nudol nmivi (f Drm(mpot0tlxomo3tatfmDrlu sn()tetnio to1op rauvs t0trxoiopny4lme  ics t)sDrr(m no4oet  ocild s2elnmp u4 exrxo3totoaDranvs ()t2urxo nodapte fci s  rur( pno4oexo ociys mDuanvs;u4artnmrcoytopteaueols s2urio nodlltn ivta()arurxmo;o0apxn oetat sDrmuvo;u0tetoxfcoatopD luvol( tetoir3oy1lptemncsl(fa2trx  ot4opeoii3ild sDuluvsn(0 lxnxf3ta1lmtraivi t0s2xm(m3iy4llee ies tfaruaxmpnu4openioeiat mDelnvs;t) etrmfcto1opDr uvolt0 rtrim nudlpen fesa() Drru pnt1aeeoif3tatlaDeanvs (4alermr iotfpt auvi;s seto(o ny4lptn neta()sDrrump;t0alxnmo3iyd m2ra(monu0teeomf ty1optran o;s0srtrxmpiu4ale lfvia(f 2urxr ;u1aeeoif3iadfa ua( p;t4tlxomfcoodla r ivilt)tetmirpnydlmee ncias) Dum(m ot4tee  o3iasfmDrm(msn(0 rtriocia1la r i o;(  2umxo3oo4amenmfcias a2rmx  ot4opxnii3iys aDea( o (0 lxrmo totlmt aues (  eurimpiy4ap e iciltfa2rr(rpoo1opt  o3tadfa2um(vs;t0arxnmf oy1lptrlu ols)t2trxo3ou1ap   neilt sDraxront1olx  ietytfaDum(mo;u) lenir ootomte uei t)truo(m3ny4aptemfvs sfsruru  ;o0tle  fetysla umuvp u)trxrxr3ta1oaDraivsls  etmimpoodlm  mfciat)srtmxmpnu0aptomo3ilsls ea(vont4tltnxr oo1fat aivo;s)trtrirpny4lp n fesas) 2tm( onu0opeomi3tad aDea( on()treoxfcty1lpD  uvs;t tetoim3ou1lp  mncs t arum(m no4tptnif3ias m rmnmonu0artrio tatom e ues t0srum(r3no1lltemivsat s2umxr nt0teenmfeiydfs2ua( p;()trtrif3oa1fpt lueils) 2xmir3iy1oltn fct t srta(m ;u0alxn icilsfs eluvs;t)tlerxr3ta1omD ln i;t)t2xoxr3iy4al  lieiasfarur(r ;o4oexnmoeiydlm uluvont0teermfciy1op   uvi;(0s2tmio3nu1ol elfetlt sDtrx  nt4oleoioeiyslm ulnmsn(4trenmf oo1op ean slt) rurio nodlptn nvslsf 2rrxm nt0tpenmo3iat a ulu o;u4alxoxr iadlpDe ies t0seurxm3oydapeemfcsat)arrr(ro;t1oeeomfeils s umnmp;u0tltoifciydfpte uei (0tetmxm nydapt lfvi tf Dur(  ;t0tpxo fciltla rluvo;t)tetoxrcoodfpDrau s;t0srtoirpoy1om e ictat arraxrono1aetnmf3iltfsDumumpnu) rermr totoptran i;t teuo(r3ny4lmt lieta()arrmx pnu4aetn f3tytlaDea( s;u4tetomrctatfa  lnvsls0 2urxr3nodlp nliet ()sDraxroou1ole iieiadlm2umnvsnu)aexnmr3oadfp rlu sl()srtoiopiy1olt  ietasfartmx ooo4aet  ieiltfa2umn pn(4 reomr3iydfa  anes s0 rtoxm3nu1olen ivi ( a2tm(root4apxnmfetatfa2ulnms t4 rxnio3ia1fmte ueo t)sruoirpoudoleemivils)s2rm(mp;u0tptn ieiyt m2ulnvo (4 eerxr3iatlpte neols0seuo(rpoo1al emfci t arrrx  nu4texoifctad m2um(vo u0texomo3iytlatr uei s t2urxm iudlpen feilsfa2rm( oou0apxoif3tytlm2em(mp;()trxnifciodom r nvo s)seurirpiudol  mfesl(fs2trxmpoo1opto o3iasfs emn o;t4artnir iydopD lies;t  rxrxmpny1lp n icsas)aDurum nt0apxnmictas a2emumonu4trxrxr ia1oate nvols0 eurxrpoydom emfesa()a2rrx  ot1oexnmiciytls2eaums t0arxnmoctatfa   u o t)seuoir3oy4al elietlsfaDtmx  no4ale ifetyt a2em( s;()alxomfcto1omtelieo t)srxoio3iydlpt  netlt)aDtru ono4aexnmo3iysls rln s;u4 eeoirciy1oaD au i (0 rxr(r nu4lmt mietl(fa2ur( onu0opeoiocilslmDrmn p;u0altrxocoytlmDe u o;t  rxm(mpiy4lmeelneia()s2ta(mp;u0teeomfeils sDelnvo (4arerxf3oo1fpDr iei t teuoim3nydlm nmiviasf Drauroot0tltnmo3tld a2eluvs t4aeeomf3todfm elu i;()trumir oo1openmnctas  2rrx  ou0apenifeiydfa2umumonu)trxnmo3tatfpD ai ilt)t2uoxopiydame mncs tfarrmxr ;o0tlxnio3ils a ra( p t)tetrif3tatomte ueils)seumim oy4ap nlfetas  Drrxro;u4openii3ilslsDelnvp;u) reoxfctytfmt ai ol( seurxrpio4oleemieta(fsrtaumpnt0oeeoio3tlsfs ulnmonu0 etoxo3iy1fpt aueo ( t2tmxm3nudllen nvt sf Dum(mo;t1apenifeiytlmDuluvs (4tltnif oadlpD  i s;() rtrxm oydope  ietlsfs2tm(mpoo4oee mf3iltfm2um(vs;() etnif io1fp e u i;s) rxoiopno1opt  ics ( s2umxrooo4apeoif3ildfm2umu s;u0 lxnmrctotfaD aivi t)tetoir3ny1lmt livtas)a2tmump;o4apxomi3tadfs2um( p;(4alxrmf totla e ivo t0trtrio oodolt mfvs tf rtr(m ;t4ale iieiatfmDrlu snu) lenmo totfmte ivs t)srxmirpno4lptnlnct sfs2um(mpnu0tpt mieilsfm elumo;t0altoxocoodom eluvsls)tetmio3iy4om nlneta(fa2uaur ;u1opxnif3tasfm elu sn()teerio iatfaDrli s t sruoxr iy1lm emiesa( srurum ot4tlxoiocilsla2uanmsnt0tlxoxfciatlat  ieilt)texoimpiodomtn ict t artaxrpou4tlx ifctydfsDrlu pnu)arerio3totfm  aneil(  etmxm oodlp  mics t)aDtmumonu1tlxnmo3iat sDelnmo u0tleoio oydomD li s s srxoirpnydol emiesl(fsDtaumpot1olxn oetysls umnvsnu)artrmo3to1lmDr u s;(0srxo(m no4lm  mfvsatf 2um(mont0openmieiadfs2ul(vs;t) ltrif3ia1fpDeanvi;t0 etmxmpoydlle mneta(fartrump;u4oexomoetytls2uaumsn(0teeoif iytlaD luei;() rumxmpno1lpe lfetat artrx pnu0opxnifciltlsDrmu o;t)tlxoxociatoa  livsl( srxrxr3ou1lp  miciasfa2rmur no1tpx mociasfs ean s;t4alxoxr tytfpDelnvs;t)srtrir iu1lp elnesasfsrtrurooo1tptnifcilsls2ul(ms;(4 rxoio3iytopte uei;s)s2toxr3nu1amt mneilsfs2tmu  oo1tpeo o3iadfs2ran o;u)trenxo3totlmt au olt) exmxo no1ameemict ( s2tru  nu1optniociatfa el(mp;(4tetrmo iy1lp ran s () rtrim3oo1lmt mfvtlt aDuaxmont1alxoio3iat s2ea(von()arxrmo3tydla elivsl( texr(rpnodam nlfciat s2rmxmo;o0apt  iciyt m2rmuvp () eeoircoa1opDr ieo ()texriopnudom emici ()artrx  ot1tee iocilt sDrmuvo;u4alenmo oodoaD  neils) 2xrim3oo1ll  mict t)s2raxm ot0aetn oeiydfs el( o u4aeenxo3oatlatelnes ()teuo(o3ou1ame lnetls arurxmp;o0aleomictydfsDrmnvp (0artomr3iytfmDeaivolt0 rumxm nu1alt mivsat)sDurxrp;u4apenmoetas sDraump (4 rtnmf3oydfmDeanvo;(0trxrirpiydope lnesasfsrururp;o1ole if3tldfs2rau s u)aetoio3iytoat lnei s truoir3no1lpe  ici s aDrrxmpnt4apenmi3iyslaDrm( s;t0aexomf3todfmDeau olt  ruoxopoy4amt mfeias)s2um( pno0aee ifciadfaDrlu sn(4 lxnioctydop elneolt0texrxrpno1omt mnvta(fsrumu ono0texomociltfa2rau o t0aeenmo3oy1lmteluvi;()setoxo iydlmt mieil(fsDtru  oo4olx ifctyt s emums;(4 lxoiociodop e ueo;s) exm(o oo4ol elfeiasfsDrr( pnt0oexo octldla rm(mpn(4tetoxo iotlpD anvols0teumxm3iu1lpenlnviatf Dua(mp;u4apto o3iytfsDea(ms (0 lxoiocto1omt auvi;t)trtm(opnu4am  liei t)s2ra( ono4apeoiieiyd a2rlnmon(4trenxfcoy1fatean s t srumxr iydopen fciltfaDraxronu1tex miciasla eln o t) rtoxf3ia1opDelu i t)texoxrpoodam   ict ()s2ur(m ;u1oex  o3tad s rmuvp;u0 rerxo3oytla rlies (0srxo(r3iy4alenmnetls sDrmxr ot1oeto oeiadlaDrm(mo (4aetomfciydlmDe nvs;t  2triopio1lmt  ies tf Dtmxm oo1tpxoifctadfa elnvo;u)tltnxocia1lm rlnvol( tetr(r3iy1lpte fetltfa2raurooo1tpe  o3iatfs2ra(vs t0tleoircootfp   i i;t) exrxopnu4ome  ietas aDrmumooo1tpenioetltfs eauvpnt4aleoio iy1la r neo;s0teumirpiudapen ieiatfarrmx ono4aeeomiciatfm eln o (4aeerif3oy1lpD aies;()tetr(o ny1apee fcsls sruax  ;u0oltomfetltfs2eaums (0trenmocoodfmteanei;(0setmxr3ou4am emncil(f Dra( oou1alenmo3tld m eauvo;t)tltoxfcoo1fpDraues;s) etmxrpou4lle mivtls  Duru  nt1oex  icias aDemnvpnu0 rtoif3oytfp r ueo;s  eumir nu4oleelfcta(  2taumpou4oexoiietltfa2rmuvo;t0areoif oadoa rli i (0seumir3iu1am elfvt s) rtrx onu4ape mfeild aDumnvo;u4aexrmrciadfatelnvo s s2umxm3oudlpenmivtlsfs2ra(monu4oeeomi3iytla elu p u4areomrcoytla e uesls) etoxr3io1op  mnct t)sDumu  no4apt moctlt s2emuvs;u0aexrmo oo1la   n o s0 exr(opiy1ame  ict () Drm( poo1oltoio3iyt sDeanmon() etoxf tatopDeauvi;s0sexoxo3nodap nlncsas a2tmx ooo0altnif3iydls eanvs;t0trermr3oo1lpDe u ils  rumxo oo4ol nmnvslt a2raumpnu1tltnioeiyt m2elu o u0arenmfciadlm e uvi t) 2umio io1lmt  nvt ( srrmx o;u4opeoifeiltlm ua(mo;u4trxoif3oodfat  neo s t2xmim3ny1lmenlies s)sDrrxr ou4alxn oeiltfm umums;(0 rxoio3oo1omtelivsl( teuoxr iy1ole lietatfa2rrump;u0alxn ociltfa2ean p (0trxnif3to1lmteaivo t0 rurxo no4amtelncs ()arrrx o;t4oexomociysfm2em(vo;u0 lxnmfciodlaDrauvil(0 2xm(m nudaptelivtas)s2rmx poo0oleniietldla2rlu s u0texomf ta1lmtrlnesl()trtrir3ny1omtnlnvs t)s2raxmp;o0tlxomfeiltfmDrln snu4tlerif ootoa rlu s;(  2toxrpiudlmte fctl()arrmx pno1aetoii3iydlmDea(mont4 lxoxf3iatom  lneils srtmxopou1llenliet s  Duaxr ;t0tpeo feiyslmDum( snt)teenxo iotla rlieo () etrxrpny4lmtelfei ( aDtmu ooo4tle iietad mDelnvo;t4 exnir3tatlpteli i t0 rxo(mpoydapenmnviasfs2tmu  nt0aptnmiciatlm ra( s;t) rtoxr3tatlat  uvol(0sexrim oy4llt  nvil(f 2rmxmp;u4tpto ictaslsDrm(mp ()trxrirciydop rauvo;()sexr(r iy1amtnlfviatfs2tmumo;t1teeomictlsfsDua(vp u4trtrxf oodfat ai ol()truo(rpiydopt mncsls s2umumpno4olx iociltlaDemums;t0areoio tatopD an s;t  2xmxr3ou4ape  fctas srrr(mono1aetnmf3tltla ul( s;u) etrxr oatlmD lnes s)t2tm(opnudaltnmneia(fs2rrurpot0aptomi3iytla2ra( s;u4alenio3oa1lpDr ivi ( trxrir oydlmeelnet (fs2ra(m ou4ope mi3ildfm2rlnms;(0trxrio3oatopt  neo ()teto(m oo1opeemnvsltfsrrr(monu0alxnio3iys a umnmpn(4 lxrir3oytoateau i;t0srxoxo ou4lmt mnvtasfa2tm(mpno4aexn ieildlm2eanmonu)tltnmo3ta1fat ln s t seum(rpou1om  livtlt s2trumpnu4aexnii3ildfm2uan o t4alxoif iy1oaDeln sls trur(m3io4olt lies t  rtmu p;u0apt iiciad m em( snu0 exnio iodla r u olt  exoiopoo4am nlfvtlsfaDum(m nt1tleo o3iyslmDumums;()tltoxo iatfpDraies t0srurxrpiy4ap elfci t) ruaxm ;t0ole  f3iltfsDrl(mon(0teenmo iodom   nvi t0 rurio nu4lpe mieil( sDua(  no0apx  ociyt a2eluvp (4teenxf3to1fpt  u s t0t2trirpou1amee fcil(  2um(moou4olxomfciaslaDrmn o (0 ltnxo ia1lmD lieolt)trxm(o iy1oleeliet t  rraum ;t1alxoiiciatfa uan p;t0teenifcoatoaDrli i;t s2xm(o io1lp n nci ()aDurxmpoo4tpxnif3ilslaDra(msn(0 etoif ia1lm r uvi s)seum(rpiy4om e nctat)aDrax oot0apx mi3ild aDuan s (4trtomo iodom eaueilt  rurxm oy4ap   fcs (fa2tmurooo0aleomictasfm rl(vsn(0 lerxf3tatopte n i ()t2um(o oodalt mnvtlt)artrxmont1tlxn fciadlaDem(vp;u) rerxr to1fp rai i s trxr(m3iu4ll   nvs t)a2umxr ot4apeo ieiysls2rmn on(0tlxrxr oytomte uei;t0s2xoxm3iu4lp n nvi () rraxmpoo1aee iieiysfs eau pn() eerxoctadomD aivs;s truoxr3ou4lltemnctas  2rru o;o1tee  i3tltlaDeln s () reoio oy1lpDe nvs ( srxo(r iydolen fvs s) Draum nu4aee  i3ilslsDeaump u0areomf3iy1op r ues;t0s2umio3oy4lpeemivslt srumur ;o4opxniietldlmDrmn p u)arenxf3ia1fmte nvi s)texmxopoo4lmtemncils s2taxmonu0oetn iciltfs2umu o () rerxo3iodoatrlnvs;t s2xoxo oy1olt  fciltf rrmxr ;o0opxnmo3iasfs2ul( o t4texnmrcta1lm r iei s0seuo(m nudlptemfeta(  rurx pno0teto oeiysfa em(vs t0 exoxo oo1op elivsls)t2ur(o nu1ole mfcias a2rrxroot0texnmi3iyslaDemu o;t4aetoxo oa1lp  lu i t)s2xrxr3ou4omtnlieslt)sDtm( ooo1oleoio3ilsfa elu p;u0 rxrxrciotop eauvi;t) 2trirpou4lp e fcil(farua(ronu4oet if3iasfs ulums ()tleomr iotopDelieo s) etoxm no1openlnes s sruax o;u0opxomfciadla el( snt)texrir oydla   ieil(0s2tmxopnodale mfvtas)s2uaxmont1open feild s2elnvpn() etnif ta1fa rau o;s t2xmxr io1amtemivsls s2tau p;t1tex ii3iadfmDumnms t) lerxfcoatlmDeai i;s)trumiopnu4lpe  nctlsfaDtr(mpot1oleo fetyt m rl(mont4tetomfcoo1fpt ai o s0seurxo nu4lpt  fcia(  ruax pnu0oeeo fctytlaDrm( onu0 ltoxo3tadop elnvo;s0 etm(m3iy4op  mneilt s2umumpoo1oexoiicild a ua( snt4 lxrxr tytlmtrlivi;s  2toimpoo4ll emicias)sDrrx  ;t0opx  feiydlsDel( snt) rxrio tadfmD ln i;(0texoxmpou4am elivia(f 2um( o;o1texo fciytfaDumnvs (4aeenxr iydomtrlnes;(0tetmim nu4lp emiesa( s2rrxrooo4tltnmociyd aDrlump;()aleriociodlaDrln o t0t2tr(m iydom   nes tfa2umxm ;o1aexnif3iatlm rm(vsn(4 lxrxf3iodop eaiesls0trxoim io1amtemnctas) rumx oot4tlxomieilsfa uanvsnt)tlxomr3tydfptr n sl( s2umio ny4ameelfvils) 2rr(rooo4apxnmietad m rauvpn(0 etrxf tatlpD  ieo;t) rtmxo3iydll n nvils)aDrmurp;u1opx  iciydfs2umn snt0 exnxociatlpDranvsl(0t2xm(m3iy4lp nlfvt ()aruaur ;t1oex iietasfmDel(msnu0tltrmo3todlaDrlivols  2toirpno1lp emietatfsrumu poo4aeeniiciydlsDel( o;t4aeermo oa1fmtr u s s t2ur(m nydll nmnvtl( aDtm( pnt4oet  fcildfa rm(vo;(0aeenio3iatlptrluvsl( srxoir3ny4aptelivtasfa2taur ot4tpe ioeiytlsDeau snu4arenxo3oo1lpteaueo;t t2trim3oy1lme mfeias)s2trur ot1oee mietydls eaumonu4 rtomfctytlaD lueo;t setoxrpiy4lltelietatf 2ra(rp;u4tltnmociltfm emn snt0artoio3iydlmDrli ol()s2umxrpiudame  ivtlsfs2rmx ooo1oee ifciytfm uluvont0trenircoo1lpDean il() 2um(o3oo4alt mnvtlt) Dur(ro;u0apxnifctys sDrm(vs;t4 exrmrcoydfaDe ivs;t tetm(r3ny4lpeemncilt  Drr(rpoo1tltnioctlt s ua( on(4 exrio oatfat  ueils seuoiopiydomenmfvi tf rtau ooo0tet  fctyslm em( o t4tltoiociatfp  aueols0 etrxr io4lpe  ictltfarum(r oo0oleniietlsla emuvo (4trtrir iytfaDe nvi (  exr(rpoy1omeemfes s) rrrumonu1oexnmfeiatfa2rau s;t)tleomo3tydfaD auei;s0 rumim3nu1ale mfvilsfaDrmu oot0oeenifcias s ulu o;t0alxrmr3oadfm e ueo;t  2xm(rpiy1lp nlfeslt) rtau  ou1optniiciyd aDulums;(4aexoif3iy1fp elues;t  rto(r iu1omenlieslt) Drrum ;o0tetoiieiyt a ran onu0 eeoxr iydlmt lu i;s) eumio3nu4aptnmfvi s aDumu ont4tetnmf3taslm ean on()tetoxf ty1fpteaiei s)t2umxr oy1aptelneia( aDumxr nt0texoiietytfm eanvs (0arxrxrctydfmD anvsls texmxo nu1lp nlncia() Dtmum no1apen f3tlsls2rlnvs;t)aleoxr3oa1fpteln s;t0sexrir3oydalenlivsls  2trxrpoo4texnmiciad a elnvo u4tlxnir iatfpDelieslt)sexmimpiu4lp nlfetlt)a2umxrpno0teeo oeiasfs2em(vonu0teenircty1oaDrlies;t0srtoxopiodop   fvtasfa2umx pno4ape iictysla uauvs;(4 reoio oatfmD  ieo s)sexmxr3nydopt  ieia(f rrm(  no1open ictasls emnvp;t0 ltrxfcoodfatr nes;s)t2xmxr3nodalt micil() 2raxmpnu4tpe  f3iatls2uanmp;t4artnmf oodlp rlieols)t2tmxm iu4ameemfvtlt artax p;u1aex mictas m2rauvo t4 reomr3iodlpD  uei s0trxmimpiydopenlnvs (f Drrurp;u0olx iietas s um( pnt4 lenxrcty1laD au o (  2to(r ny4lp   net sf Duru pou1texo i3ildfa2emnvs (0tlermociy1fptranei t teumxo3iodlmtn neilt)aDtmumonu4oleo ociyd m2eanvon(0 exnxrciydlm raneo t) rtmxo io1lm  lfvta( sDrmxmpnu4teenmoeild s ea( sn()aetrmr ia1fmteluvs (0t2xr(r oy1amt mfet s  2rrumonu1tptnii3iytla2uanvp;u4aleriociotom eau ils0srxmxo3nydap elici s  Drr(mpnt4altomfctatlsDraums;(0 rtoircoatlptelivs;t  exrimpiodom n fesl(f Dtmum ;u0olt ioeildls ranvp;() ltrxo3todfmDr ueo;s) rxr(m iu1op emfet ()a2tmurono0tlxnmfeiat aDumn o;t)trtnif tydoatr ieol()texoim no1omt  icilt aDuau p;t4aptniocilslm2emnvsnt0texoio3iadfmDe u i;t)trur(rpoudapte fet ()a2tm(  ou1oex moeiysla2ul(mp;t0aeeoif ootlaDeai i;(0srxoxr3ou4opt livsa(farraumono1aet mf3tltfm2emnvo;u)alenmociy1opDr u ols0sruo(mpoo4al n fcilt  Duaxr ot0ope  feias m ul(ms;t0tltoio3tatoa r u i s)trurio ny4lpe  fvslt) rtau  nt4openmietasfm2emump;(4aetrio oadop r ieilt)truoio iodop elfci (faDua( pno0oetoioetld m ean sn(4trxnxr3ootomDe ivi;s0t2umir3nydamenlics tfa2umumpnu4texnmoetydlsDelums ()tetnif3iytfat  nei;s)trxoim ny4apenmneta() 2rrx p;u0oeeomf3ilsfaDulumsnt0tlxrxfcoatopD aivi;(0 2urxmpno1am  mfesa()sDuax ooo1aee mieiysfs uanvo;t4tlxnmfcootomDe uvi t texoxrpio4ol  mnct t)s2tr(monu4tptoiictatls umuvo;u4trxoxo to1omtrlues t0 euo(mpnudoleelfvs tfaruaurp;t0olxo o3tld m2uanmont0aeerxr3oytfpDrluvols0 rxrimpoo1lm n fctatfaDrm(moot4tet  ociytfm2uaump t0texnifcoodlmt an s;s0srxmiopoy4lltnmivs s  2rrxr no4opt  oeiasla ranvo;u0texrmo3oadfmt  u s s) rumimpiy4al nlnctl()s2ua( oou1alx iieildla rlnvp;t) rtriocoodfpD aiei;(0 exrxmpoy1lm  mici sf Drrum ;o0ope  i3iysfm rm(vp;t0tetnirciytop   n o;(0 rxrim3iu1ope mfciasfsrrrxroot1tlxnmi3tas s eanvsn() rxrmfciytop   ivo t) 2xoir oudoptn fviat)srur(rpoo4olen ocildfa2rm(ms t0trtnif3tytfpteaivils texoimpoudapeelneiasf Drrx  ou4aleo feiytfs2ea(vsn() ltnxo oa1fm e ieil( t2toim ny4optelnvtlsfaDumxmooo0optnmi3iys m rm(mp;u4 lerio io1op  auvo;t  rxrio nu4lltn fesl(fsrum(r ;o0oexoii3tasfm umuvo t4alxnmfciatfaDraivs (0t2tmir3oydoltemfvils srur( oot4apxn i3iad a eln s t4 exoxo iy1fm rai sl(0 euoimpny4al   fet (fsDra( pot0alenmfetydlm elu o u4 lenmf ootom  lnes t0sexoio no1apt lnct s arrmxm nt4apxnmociat aDraump;u4arxnmf todfa rli ils0t2urxr3nu4lm nmivsatfaDtrxrpnt0tltomf3ild a umn pn(0 rtnmf3totfa eauvs;s  rtrim nodaleemnctas) rrrxrooo4tlenmfetatla rl(vsn(4arxnio3oo1oaDe nes;(0trxm(r io1opee nvs s)sruaxrp;o4opx mociatlm2umnmp;(4tlxnxrcoydlp  liei;s0truoim oudol  lict tf Durxm nu4apxo f3iltfa rl(vs;u4 lxnmo3ty1lptraivilt)teum(m iydom  lnvils  Dtrxr ou4olx  fcias aDumn o;() leoxrcto1laD  u s ()t2xm(mpoy4al elivta(f Dtru  ;o4oet mociydlm eluvp;u) rtrxo ta1lmD  i s (0trxmim io1apt lncsat arrrxro;o1tlxomo3ils mDrl( p u0teenif ootfa   i ols0texm(rpou1omtelncsltf Duax  ot0olx ioeildfa2eln s (4 rtoxrcoa1oa r neo;(0s2trxo3io4lptn ict s  Dtru  ;t1oeeoio3tlt a rl( p;t0aexomo3oo1fp  lueo;s truoimpio4alt  feiasf Drax oou1opxoioeiyslm emn sn(4trtnif3ootomDeluvo;t  etmxr iy1ol emfcsa()a2urx  ot4ape mi3iyd m2elnmo t0aexnmo ia1omD au o (0srxrxm3ny4apt mfvtls) Dumxrp;t1olxn icild s elnvpn() ltrxr3to1lm e nes (0trxm(rpoodale  nvt t)a2uaur ;o4opt ifetyslm ulnvp;(4 eenifcoytlat  uvo;(  exr(o ny4alt lncsls aDrau  ;t0oex miciydls2rm(vpnt)aeeomr iydfpDe uvo;s0srxrir nydll nlfcias)aDta(m ;t4tlenmfciatfa2ea(vs (0 leriocio1fa   u i;t s2xoim ou4ape lnct ()srururooo0apx iietytfsDuauvo u4altoxfctydla  luei s)t2xoim3nydll elietasfsDtmx poo4oee mociasfaDrmumpn()trtrmoctadfptrlueol() eumxo3oydlp  livt t)srtrxmpot1tpenmf3iatfaDuluvs;u4treomf totfaDeli o;s)teuoim io4lleelictl( sDtrxmonu0oex mocils sDrlnvont0 rtrmocia1lp  lnvs;s t2um(opiodal nmnci tf 2um(rpou4apxomi3iltlsDumnmsn(4 ltrmo todlp e u o ()tetm(rpnu4op nmnei ( s2urxm nt1oet moeiytfm ua(mo;u4 lenmociy1lmt an s;( setr(rpiu4omen ivs tf Dtau  oo0oltomictyslm rl(vsn()altrmr ty1omtraies;s0s2uoim ou1oltn ivs (  Durx pnu4olt  o3iydlm2umu p;t0 etnir ta1lptrln slt)truoirpny1aptemiesat sDtmxm ;o1oee iicildls em(mont4teeoxrcoy1faDrlnes;t0trtoim3ou1op  lnci t) rtrxmp;o0tetomiciydfs2rmnms u)altrxr iytlm elnvs (0seto(o no1lle mfvta() rrrumpou1teenmi3iyd s ua(vp u4 leomr to1omt lueil()s2trxm ou4ll elnetatfsrtrumo;t4olx  o3ild a2rmump;t4aetoir3tytlaDrlivi;( seurxrpoy1opeemicsa(fartmur ;u1aleomi3iytls ulnmo;u0treoxr oytlm e i sls0srtrxrpiy4amte ncil(faDrax p;u0apenmictad sDrln p;t)altrircoydla ranvol(0t2xrimpoo1alt mieslt a2rmxm nt4tlxnio3ils m uau s;t0aexoxr tadlaD anvo t0sexrxm3iudalenmnvtat sDumurpnu0alx  oeiyt a2ea( pnu0aeenmociodlp r u i;s truoxo no1amt lict t srrr( o;o4apxn ietatfs2uluvp;u0alxomf ootfmt  ies ( teurimpoo1opte nvs t) rra( o;u1alt iieiat s ua(vs;u)alxrmfctodlptelieo s  rtmir ny4lptelnvtls)srrrx poo1aetoio3ildlm2emumo;t0aetoio3oadfaDelueo s t2umxrpnydopt mfet (  Dtru poo0opeoiictld s2ea( pn(0 etomf3oy1laDraiei () 2xo(opou1amenmieilt a2tru  ot0open fetlslm2eaumo;t0arxnxocoo1fa e ueo;s  rxrxo3oy4ame mnvil()sDurur ;o1tlt  fciydfa2rln p u0trtnio3oatfpt luvo t0s2ur(mpoodll nmfvi ()artrumpou4opxn oeias a2rmnmo ()tltnir3ootfaDrlnvo;t)teuo(r iu1al   fvsasf Drrurpno4teto ieiad s rmuvo t4arxnmr3iotla  auvs;t0sexm(o nu1lleelnei t)aDtaxr ;t0tetomi3iatls umn s;u)tlxrmf3ia1la  luvslt sexrxr iy1lpt mictltfa2urumo;o1aex  ietydla ra( p;() eenmfctatla r u o;s)t2ur(m iudapte ieil(faDta(m ot0olx ifcilt s2raumonu4aetrif3tydomDe n o t)trurio ou1lp  lneta(f 2ur(rpoo0apt ii3iytfs2uauvs u)alermf tytoaD luesl(  etoir3oo4aptelfetl(fa2umumont0ole  octad s2rlu s ()trenmr iotlm e nei s)t2tm(o no1lmt lncilt) rrm(ro;t1tltnmieiadls2rmnmp t0alxnifciadlmDrai i t0trxoim nudomt  iet s  Dtrx oot4opto f3ias a2ean on(4tlerxf3tadlm rlues;t  rxmxrpnodlle mnct s sDurxr nu0apx ii3iyt a2rln o t0trenmo io1omDraneil()trto(rpiudlle  ivta()srrm(m ou0apxn i3iysla rl(mp;t4tetrxocia1oa  lnvs;s) exoir3nodamtelnvil()sDtrurpoo4tpx mo3iydfmDemnms;u0areniociotla elnvo (0srxrxr no4ape lnvtltfartmurpot1tptniieiysls uauvsnt) etrif totfa ran o;t0 2tr(rpnudapee fes ()arurur ;t4apxniieiatlmDul(vp;u4tltrxr3oo1la rai s ( teum(m3ny4apte nviatfaDra( ooo1aex mictyslm ra(mo;t)tetrif tadlatrlivs t  etriopiu1apee nesl() rraumoou4oetnmo3iyslmDemumo;()tlxnmociadfmtr nvs s) 2xo(o3oy1lp e fcia(  2tr(roou4oltomo3ildlm2umn o;()areoxo3tydomD  uvo s sruo(mpoo4lle livtas s2rmxmono0aleomietlslsDemumo;(4 etoir3iotom rai sl(0t2tr(o oo1al  mfetatfaDraxronu1aptomicilsla2eauvs;()trtoxrcio1laD aneols0 2xrio3io4lpe mietas)srrax pou0aptoiiciyslsDuan sn(4 renmocty1opt luvs;s t2xmxmpiy4ap  lfvta(  2umurooo0ale if3tytfm uaumo (4arermo3tatoateli il()setoio3io1al elnct () rumx o;u1texoii3tat s rmu s;u0alenxf3to1fpDe neo (0t2tr(r3iudlmee feiasfsDtrxm nt1alt ifeils mDem(vo;t)teeomf3totfm e ivi;t)sexrxo iu1ap nmnvt ( srtmxr nt4apxn fctasfm rlu p;t0treoif iatomDelnvs;t  2umxrpoo4am  lnvilsf 2umxrono0tet  oeiatfaDean p u4alxnmrciodfaDrauesls0srxmir oydoltnmfvt sfsruaurpnt4aptnmi3ild s2rln snu) rtoio iydfaDe ues;(0 rxrxmpnodapeelnci s) ruaum ;o1altoiieiytfs2ua(mp;t)artnmo iydfpDean s s  rxrxopiu4omtemnctl(fsrururoou0oex mfctadls2elu p;(4tlxrmf oy1lm e i i;()srtr(m3no4am nmncilsf 2rmxrpoo1ape  ietysla2ua(ms (0 exnmo iotfpDelivi;t)t2toxo3ny4alte fvi s) 2tmu  ;o4apeomo3iad m uluvs;t4aexoif3tadomD luvsl() 2xoim3oo4lp   ivta()a2ua(m ot4tpx mi3iyd s um(vp (4 rtrio3ty1fa rlnvsls t2urxrpny4am   ivta( aDrmurpot1aptoiocilt mDeaums t0 reoxf oatomt  i s;s0srtr(mpny1omeelnvtls)s2rmxmpot1oltnmiciyd sDrauvp;t) etoifcty1lpD ai sl()t2toxopiy4lmenmivilsf Dra(m oo1olxnii3iyslmDran on()trtoxr3tytfmD ln olt)s2trir nu1am  lncs t arur(  no1tetn iciadfs eanms;t)aetoxf io1fptr uvo s0trtm(m3oydamenlnetasfarrmxmoot1olenmo3iys sDuau p;t) rxrxocio1fp eln s;s srxoio oo1omen fesl() Duaum nu0tptomo3ilsfaDemu pnt) etrmfcto1oat lues;s sexmxm3iy1lmtnmfct (f 2um( o;u4olxnmi3tldls2rmu ont0 etoircia1opDe neo;t t2tr(r oo1alen ncsas) Dtm( o;o1oexn i3iasfs2ea(vs;u4 rtnxr3iytlmDe ieils)s2uoim iodal n ietas)srra(r ;u0olt  ieiltlm2ea(vo;(4 rtrmo to1lat  ues s s2xr(o3iu1ol n ncsat)aDraumpnt4apxoiiciatlmDrm(mp ()tltrmf3to1opDeauvo;(0seurim nydameemnct t a2rrum ;u4tee  ietadfmDua(vo;(4aleoio3ty1lp  au ols tetoxo3no1ll e ivilt)s2ururp;t0ole ifctat s2ul(vp;(0areoircoa1lp   u ils  etm(r iy4llt mnes ( artmxmpoo0tet mietyd aDemuvp u0alerio3tydoatranvs;t0 rtrir iodll nmfvs (  2rrumpnt0alx  o3tyt a um( o;u0tlxnifciytfmtrlieo;(0trtrim3oudomtnmneil( a2ta( onu4oeeo feiys mDeauvp;(4tetnxfcty1fmtrauvs;(  2toxo ou1lle livils) rumu ooo4aetomf3ilt a eau p t0alermo tadomD anvol( s2xo(r nu1lpt liei (f 2um(r ot1oeen i3tysfs ea( ont0tlxnxo3oydlm raieols  rtmio ny4opt  nesa( aDtru  ou4oetn o3tydlaDrl( p;t0 rxnxo oydoaDe u il(0trxmxmpiydopenmfeiasf 2uaxm oo4texo oetas a el(vp u4trermfcoo1lp elu s s  2uoxm3iu4ame liet ( aDrr(mo;u4tlx miciydfaDemuvo u)treoir iotlmD aivs;t  rxmxrpnu4optn fvsls  2umxmpnt4aeto f3tyt s2ean s;t)texnif3oo1fat liei;() rtmimpnu1alenlicia(fs2ua(moot4oeeoifetlsla ranms (0tltrxr todoptr uesls0 2urir3nydomeemnviasf 2trurpou4alxomi3iatlm2rln snt0trxrmr3iytfp  lu ilt0texoxm nodamtnmics tf rrmxmooo4tlenmociltfs eln s;()tlxoio tatoat an o s) 2toxm ny4opee fvias  Dur(ro;u4teeoif3iltlm2rmump;t4arerifctotoa elieols srxm(m3oy4lleelict s  2rmxmoot1openifetltfaDrl(vpnu)aetnxoctodfaD auvs;()truoirpiudlpeelncsat)a2uax  nt0tlt ioeilsfa2rmuvsn(0 eeoxo ia
\ No newline at end of file
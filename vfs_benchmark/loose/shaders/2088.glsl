@@ -0,0 +1 @@
+i i;s)t2xoxmpiy1lpenlncs t arum(mp;u1texo fciltfa2eln p;t4alxoir3tatomteanei (0 etrxopiy1omee nvilsfsrrmuroot1tltnmfciyt mDul( pn(0tetoxo3to1fpDr ieol()trurxmpnu1ape mivt s sDtaxmoot0tleoifciasls2uauvsnu)tlermocoa1fpDe neils)trxoio3oy1llenmfvi t)arrmxr no0oltomoetld aDel( o;t4tetnxf tatfm rlivsl(0 rtmxo3nodom nmneiasfaruaumo;u4apx mi3iyd s eanvsnt0 lenxf3io1opDeai ilt t2umxmpnu1omt  ncs sfaDtmxmo;u4ole mictadla rm( s u4trenxo oa1fmtraneo;t  rtm(opiydope mnvtlsfsrtr(ronu1texo fctysfm2um( s u) ltnmfctytoptelnvsls sruo(m oy1apenmfcils  2umum oo1ape mf3tat m2uauvo u)arenxf3oo1oaDrluesls)s2xm(r3iudapen nvilt sDurx pnt4tltomo3tad s ua( snu) ltoxocoadfptelnvolt0 etoio3oy1olte ivtl(faDum(mpnu1aee ii3ils mDum(vp (0 rtrxoctodlp raneo;t) rumxm no1olen feilt) rtaxm no1texo ieiatls um(mo u)trenmf3iotlm   neils teuoimpiudape mnvtls srum( p;t0apxomietldfm rmnms;t4 rxoir3iotlat  iesls trxrxr3io1optnmfcils)s2ra(r ou1teeoio3tat aDea( s () rxnio ta1fmt aivol( texo(r3oy1ame lfcsasfaDtrxrpot1opeoioeiyt a eln p (4tltrmocoadlm  au slt  rxriopoodam   ivsl(fa2urumoou1tpxnmiciltls rm(vp t)alxniocoy1fmDrlueilt0 eto(mpnu1lltnlict t artaumonu0ape iieias m2umuvo;(0alxomfcoa1oa rauesl()teur(opno1llt  iei ()srua(mono0apt  ieiat m rln s;(4 rxrmocoadopD ai i s)texmiopiudame lnvils)arrru o;u4olt  ociad s2um(vp;t4treoxrcio1oaDr uvols)t2urimpoudal   iviat  Dtaurpno4aexoioeiydfs2rl(vs t4tleoiociotom   i ils0 rxmim nydop nmnesl( sDuau ono1alxomictls a2eln onu0 renmr oatfpD  i o s trurim nudlp elncil(fs2umum nu1tex  iciat m elnmo t0trtrmf3oo1latr i o s  eto(m nodlm  mivsls)sDrm(r nt0olt mo3iadlm2rm(vsnt4 rxrxo iadomte u il() eumxrpno4ll nlncs tf 2ta(rpot0tetn o3iydfs eln p;u) renif tydlp   ivo t s2ur(r3oo1aptemnetat)aDraum no0opxo feiltlsDeau o;(4trenio3ootomt  n s;t0teuo(m3oy4ll n fciat)aDumxm oo0alxo f3ilsfaDeau s u0tlerxocoodfmDranei t0texmimpou4op elicsasfs2rau oot1oetnioctydla umu o;t)tetoxf3iytlmtr ieslt0srtrir3oy1aptelfct t sDtmu o;o0oetniictld a2eluvont0 renxr oadlpte u sls0teto(r nydlptn ivt t aDuau ont1teeomociyd a uln p;t0trxnxr3tadoptraivo ( s2uoir nu1alen ics s sDtrx p;o1tex  feiys aDemnvsnu0alxnxr iytlm  aivo t)srtmxm3ou1ame lncs () 2umx  ;t4openiociaslm2uauvp;t0areomocio1fm e uei s trxoirpio4olt  ncta(fs2rmx  no4tlenio3iys sDum(mp;(0 etrxf3tydoat lues s0s2tm(r no4om elnvtltfa2tr(mo;o4olx  i3iysfaDemump;u)tlxnmf3iotomte i i;t)srtrxr3oo1ol  liesl(  Drmur ou4ape mo3tydlm2ea( on() eeoiocoy1laDe uvil(0srxr(o3oo1amt lietatfaDrr(  ot0oleomicild s2ul(mo;()aleomrctydfa raiei s sruoim iu4lltnmicta(f 2urxmp;u0oeto ociytfm2umuvont) rerir tadlmDelivo t) 2xo(mpio1lptelivilt) 2tau ono4aptomocilt mDraums u)artrif oy1fmD auvi;( trtr(rpno4lpen fciltfs2urxrp;o4apx io3tltfm emnmo;(0 rtoir oadfatrauvi;s srxrio3oodal   fctasfsDtaxmpoo0alxnmoctysla2uan onu) ltrxf3oy1lm   n o ( seurxr3ou4ap   iciatfs2trumont4tlxo i3tlt a elnmp;t0tetoxrciodlp  livi;()trtmxrpnu4omt licslt)aDta( o;o4apt  feils mDean ont4artriocoatlm rluvi s0 2uoio no1opt  ivia()aDtmu poo4aee iiciydfmDuln s t4 ltnifcio1omDrlu slt0trxo(m iu4om nlfes sfaDtmxmpot0teto f3iltfm emuvon(0altomr3totfpte n ilt)truoim ou1ap  mfvsltfs2rm(rp;u0tltnmf3tas s2ulu p;t0 eenxo iotomDe ueo s)setrxm iu1aptemivi tf rurxrp;t0oexo fctytlm rln pnt4texrmf3oo1omt liei ()seuoxopio1am n ncs t)sDtrxmpno4apxo octasfaDeln p u)tltnxf ootom rau slt teurio3oo1omeemivt s)arrau p;t4apeo icild a rl(vp t0arxoxr3oatla ran i s0t2urim3iu1omenlfviltf rta(ro;u1apt ioetat sDeluvs u0tlermfcoodopte i ols) rum(m io1lptemfcta( srumxroot1tlt ifctldfa2rl( pn(0 lenif3iy1lpD  n ils srxrxm iodal e ncsls srtrx ont0tlxn o3iat a2uaump;u0trenmr3ootoa rlies t  2xr(r3iu1am e ivtatfartrur ou0ope iocildlaDeau s;t0 etrir oodomteluvs (0 rxrxm3io1ll elnet t) Duaum oo1alxn octlt a emn onu0tetrxf3oadlmDrlueol()teuoimpno1oleelfet s a2ua( p;o1tpenmi3iysfa rm(vsn(0artrxf3io1lm e n ol()seto(mpoudlpeelfet t aDrmxm nu1alx ioeiadla2ra( o u0 rtrmr3to1fmt  nvs s) 2uoxmpiy1open fcils)s2ta(mo;t0tlt mi3iys s2eaums u) ltrxr iatfmtr i s s)texmio oudaltnmncsat  rrmur no4tpxomo3ils aDulu s ()trtrxr iodfp  aies () 2tm(r oydlme lietat  rurx ont4oeto ieiltfaDum(vo;(0trtrmocty1fp elieo;(0 ruo(m io1apenlncia( arurx ono0opxomo3iad m rln p;(0texoircty1op rlnvsl( trurimpnu1amtn fetl(fs2rrx pnt1tltnmf3iydlaDrm( sn() ltnmfcoatopDr i i t0trtr(r3ny4lpenmivt s) Drax  ;u1olxomoetltla uan pnt0arxrxo todfmDrlnvils0texr(m oodllt  nciatfarrr(r ;o1tlenio3tyt mDulnvs;u)trtnir iytfptrli sls0s2trxr3oodlltemivtlsfsrumu o;u1teenmfeiyslaDemnms t) ltrxo oodfmDr nes;s) rxoirpiudomt livsa(fsDur(rpnt0tlt iictadfs umums;t) etrmo3iytlatelu s;()trum(m3io4llt  fvils  2uaxm ;o0tlxomocilslsDuln on(0trenmo3totfpteli sl( trto(mpoo4lmtemicia() rra(r ou1aleoif3tys a2umu s;u0 rxomrcoy1fa  lu i;s)t2toir3no4amtemfesl()s2tmu ono0tpenmfciasla ranmp ()teeoiociy1opDr i olt texoxrpnydopt lnvtasf 2tm(  ot0apeo fetyslm2umums t4texnmrcto1fpte n s;s trumim3ou1lptelfei ( sDuaxm ;u4tee ifciys m2emu o;t)altnioctatlp rauvo s) etrim ny1lmtn icsa(fsDrax p;t0tptnmoctydlaDrl(ms () etoirctytoatrai olt)s2urim3oy4ameelfeils srrruronu0aet  o3iltfa eanmp;(0tetnmr oatfpt aivo;( srxoim iy1omtemnvilt)s2rru o;t1tptoii3iasfs ea(vsn(0 lxomf oadlat  nesl()s2ur(r oo1ol  lnvsa(fsrtmu  ou1tpt mictldfsDra( o (0altnmrcoadla   u s;s0 rtrxmpou1am e fetatfsDtmu pnt0tlxnif3tldls2rauvsnt0texoxrctydopD aneo t) eur(opio4lpeemfvt ( aDurx pno0apeomfcild aDul(vsnu) lenifcta1oa e uvs;s0srurxr nu4amenlfctat)s2ra( oot4ape ii3iys aDrm( pnu4 lxrxocoydomDr ieo;s seto(r3ny4alt lfeilsfsrrm(rp;u1tlxoif3taslaDrmn s t4trenmr3ta1om raieo;t  rxoxo3iodlmenlnet tf 2um(mo;o0apxnmicils s umu s u)aleoiocoa1oaD au i;t)srxmxr io4lp eliet tfs2rrxmo;o0texnmfctys mDelu o;t)altrir3tatfmt lueil(  rxrxo no4lme lnei s sruau  nt4tlxoifcild aDrlnmo t4 etnmr tatfpt  nvils0 etoio io1oltn nvt s  Dta(moot1tptoioeiytfs2ranvs;(0tlenmr3iydlm e u o;s seum(m3nudlmeemfvil(  2tm(m ;u1oex ifetatfmDeanmp;u)altnmo3tytfaD lues;s) exoiopny1ol   fvias) Drrxm nu1tpeomf3iat sDrmuvon(0 exoio3oytlpDr u i t0 rtr(o ny4olee ici t) Dumxmo;u0aexo ietld mDeauvp;t) lxoxo oy1fpDeanvsls) etoxmpny1optelici s) 2rm( onu0oetn i3iytfm ra(vp ()tlerxo totfatr i sls) rxr(opoodom emict tfsDuaxr nu1tlen iciyt s2elu s;() ltoircootfm  aies;t0 rxrim oy4ol elfcsat)arrm(rpot0apt iieiyt aDelnmp;u0arxoxociodlaDe ivil()t2to(m3nu4opeemicils aDum(mpno1tpxomieiadfa ulnmo;u4 etnxf iatomDelnes t)srxrimpnu4ame lncia()s2tru p;t0tee  o3iasls ran s u0 eermr3tatlp rau ols  etmiopiy1op nlieilt  rrmu  ot4aeto fciatlsDrl(vs ()tlerircoydfm r iei;t  etoio io4lm elfvt t  Dtaum ;t4tpen fciatlmDuan p ()tetnifciodlmtrai ilt)truoxr3iy4ame licia()sDum(mo;t0oee  i3iydfa2ranmo u) exrxfcoytopteauvo (0srxoim iodape  feta( s2umu  ou4teenifetys mDumnvs;() leoio oo1laD ln s ()s2umiopny4lp nmnvi sf Dtm( pnu4tpeomieiltfm2rmnmsn(0 etrmoctatom  livo;s0s2tr(r3oo1ape lnvsat)sDua(mp;t1oexnmiciyt m um(vo;u0arxnxr oa1lptrli o t t2tm(opnodapeemieiatfaDuaxrp;u1aex ioctldfaDrm(vo;u)tltnif oo1laDeliei ( seumxmpio1lleemfvtat arrm( p;u1opxoiicildlmDua(mo;(0 rxnmfcta1lmt  nvi;s setoxm oo1lpte feias s2trur nt1oexnifciatfm2el( o t4aetoxo tydla  anes;t0 exo(opnydomtnmivta( aDraxrpou0aetoioeiyt sDumnvs;t4 lxoir totfmte ivs;t)teurim iudoptnmfetas)aDtrum oo0apx  ieiydlm2elu p;u)aleoifcto1omDranvs (0s2xmim no4aptn ieslt)s2rrxr nt0texomfeiltlmDrauvpnt0 exnxf3oadoatrlnvsls)s2urimpiodamtn nctls a2tmxmpno1apx  o3tldfs rl( snt0 lxnmf3to1fatraieslt) rxo(m oy1ll n nvtl() rtrxrpoo4alt mociad m2rauvp t)trenmr iotoatelnes;t) rurir3oodol n fes s  2um( pno1aexnifeildfs2rl(ms;(0 lxnir3oydlm  li i;s0 2xoxmpou1altn fvt ()sDrmump;u1tlxn i3iytfsDulump (0altomr oydlp e n ilt  2xoxm nu1ame mfetas)sDur(mpno0opeoio3ildla2rm(vonu)arxnxo tydlmteanes s)teum(r oo4lm n iesa()s2uaxr ou4olenmf3ils sDeln s t0alermr oa1optrlieol(0t2xm(o io1alt mncsat)sDtmur nu0ope mfeils m rlnvon(4artoir3tatfaDrln il(0 eurio oudole lnet ()srrr(r ot4oexnio3tlslaDelums ()aexrxf3oatlatrlnei;s0 rxoxr nodlptnmnviat)artrur ;t4oex mieiadfm2rmumo;t0alxoxrctydlaD  nes (  2tr(r oodoptemnvia(  2rr(rp;o0olxoifeildfm um( o t0teerirciotomDrlneo;s0trtr(r3oydaptn fct t) Dtmum oo0alt mf3tasfs eln o (4tltnirctotlaDe n s;t0sexr(r ny1ole  nvils)srrm(r no4tpxnmieilsls uanvo;u) ltoio3iydlmtraiesl(0srxm(r oo4alee fetls) 2rm( pnu4tlen iciad mDemnvpnt4alerxocoodoatrai s t  etm(opio1omt  nvs () rtru  ;o0tlt mo3ils aDeaumo t0tleoxrcoodfaD auvol(0 rto(opiu4am nlict ()a2trxrono4oeto ieild a2ua( p () rtnmoctatopt  nei (  rxoxm3nu1omtnlfetatfs2uaxr nt0tpt iiciysfs ean p;()alxoir3oydoptr nvo;s sexmxo oy1opee ictl(  Dtmxmp;u4teeomietldla rlump u)arxnxfciodfp raiesl(  rtr(r ou1lmtemies (fs2ua(m nu4optoii3iatlm2em( on(4 lenir ootomtean i s)s2um(o no4lmenlfctlsf rumurp;t0teeomfctlsls emnmpnu4tlxoio3oydomt lnei t0seurxopnu1op e neilt)s2tmxr oo0tleo iciaslaDumnvsnt)trxoxf3totomD li ol(  rur(opny4lme livi sfsDuaur oo0opxnmociyd sDrl(mp u0arerxrcootla r ueo;t0srxmxm iy1am   icilt  Dum(moou0ope mfciadfaDumums;t0 eeomrciytomD lieols0setrir oydlpe mnet (farraxront0olx mieiasls2uauvo;u4 lenmr3todfaD lneo;( teuo(rpoudll   nei t  Dumx  ;o0tetoioctatfm2emn o u0 rxomo3oydomt  n o;s sexr(o iu4llee fvi tf rrm(r oo0alxnif3iltfm2em( pnt4alenmocoy1fmDrauvslt)srtrim3oodaltnmfct t sDtrx o;o1aex  i3iad m2ulu pn()trxoif3iy1fmt livs t s2uoio3nu1lltemfvsls)a2raurpnu1optnmoeilt mDulumpnt0alxnxr3oo1fmt an ilt  etrim ou1am e netasfarrau oot4altniocias m2ra(ms;t0aetoifcoadlpt lu i s0t2xrxr nodlpe  ics sfa2uaumpoo0tlxnmociat a2ean onu0 exomr3iodlpDranvi;t) 2to(opiodol emfeta()artrx o;u4texnio3iysfm2ranvon() reomr oo1lmteau sl() 2toxr nu4al e nes s)sDrmxrpou0apt if3ild s2umn on() rtoif3ty1oa rluvi;t0 rxoim3oodopeemieslt) Dumur ;t4opeoioeiyslm2rlu snu0aleoio io1lptran ilt) 2umxr3no1ape lnesls srtmumoou0teeo f3ildfs umu o;t0 rxoif3ia1fm eaivi;s  rxoxm3iy1olen fei (f ruax o;u0tlxomociasfmDra(mp;t0 rxoxocoodlmtean s t t2xm(o iydamenlietl( srum(r no1alt mieiatlaDel( ont0aetoxf3tytomt  u o s0srtmim3oudll e neiltf 2rr(r nt1olxn feiydlaDuau o u0alxoxr totfaDraivi t t2xo(opiu4omeemivsl(  Dtax  ou1texoiieiytfsDem(msnt)aetnir iydomt  neo;(  2xmiopnodlleelictat)arur( p;t0olxo ieiltlmDumu o;t)arxoxo3oydop rlu ol( trtm(m3iodlp nmfes s)a2umu  ot1oexnmf3tlt sDum(vpn(0trxnifcty1lm  ai ol() eum(m3iy4opt mfeil()s2tr( p;t4altoiiciatfm ranvo;u4alenxo iotfp ranvsls) rtr(m3iudalenliet () Dumum nt4olxnioctaslm umumo;t)artrmo iatfpDr ieo;s0 2tm(r3oudlle  ncilsfa2rru o;o1tltoiictyt m ul(vp;u)texrio3iatop elueolt t2xoxr3io4lmt liesl( s2raum ou4olxomi3tldfaDrl(vp;t4alxnmfctodfm  li ilt)srur(r3oy1oltelies () Drax o;o4olenii3ils sDrlu p (0tetnmo3oatlaDrai o;t0s2uo(rpou1lpenmnes t aDta(rp;t0oex  i3tls a uanvont)areoxoctodlm rlnvi s)s2tr(mpio1op e ncsasfa2tm(rpnu4open f3tld s ra(mp;u0 eerio3todomDraies s0t2tm(r3ou1lle liciat  Drm(  ;t4opxnioeiysfm uauvs t0treoir3iadomDeau o (  exmir iodom nlnctatf rrmumoot0aexniictadlmDumu pnt0arxrifciatopt  i s;(0 2tmimpnodlmeemivtatfaDurxmp;u0oexo ociad m2ea(mo;t0areoio3totla rlu i (0 rxriopiudaleemfvt (fs2rrxroou1oeenmiciys s2ra(vp;u4 rtnmr iodom eln ilt0s2xoio3nodal  lncta(f 2tmxm no4oeen ietadfa ul(mo u) etrmf3io1optr ivs (0teumir3nu1lpt  nes tfaDrrx  ot1olenmocild m ulnmo u4alxoxfciodoaDrlues;t  rtm(o io1lpenlfcs s  2ur( oou0aeto i3tatls rlnmp (0tltnmr3tatfa  lues s)t2um(m3oodol emfcs tfaDtr( onu4alto iciatlaDran o t0tlenmo ia1la rlues (0teuoir iu1apen ietas  Duaxrpno1oeenif3tatlm2ra(mo;(4arxnmocia1opteaueo;s)srxr(r3nodlpenlnetls sDtrxmoou4aleo feiydfmDrlnvp (4aeenir3oytfmD  uei s0 2trim3io4om e nesas s2ta(mo;o0apenmieiydls2ua(mo u)texnxrctytfp   ivo;(  rxm(r io4lp nlivsat aDtaurpnt4opxn feiltls2elu pnt0altnif iatlpDeaueo s)t2tmxm nydolt  nvi s) 2tru  ;t0texo feiasla ra(msnu4tlxnir3oodlpDranvsls0 eum(r ny4ol e fesltf 2trurp;u0tex ifctydfm2um( s;()trtomocootlatrluvs (0 rtrxr3iy4lpenmnci tfaDuau  nu1opxn ociatfs ea(ms;(0 etnmr iy1laDranvs s0trtoxm3nu4al  lietlt  Drm(ro;o0oleniicilt s emnmp u)aexnxo oadlmtrlu i s0trurxm no4aptelfcs (fs2trum ;u0oetoiiciyd m el(vo t0aeeoxf3ia1omtraivi s)teuoimpno1lmtelnvias)arum(r nu1alxnmictatls2el( p (0artoio3tatopDelivolt0srto(opou1llen fci s) rtm(r no4tlxn octatfa2rmu s;() rxnxr ia1fpte neslt0t2xrxo3no1amee fvi sfs2tmuront4tet iieiydfm2em( pn(4altoxocoytoaDrlieo;s s2urio nudlmtelncta() rua(m ;o4altnmictydlm um(mon(0tltrxrcoodfat  neils)tetr(rpio1lle  nesl(  Drmump;u1opt ioetatls ea(mo t4tetoir tytoate ies t0 euoir3nodamtelfesa(f 2rmx oou0altnmoeiydfa2uln s;()arenif3totlmtraivols0 2trxopio1oleelivtltfsrrm( pou0tpt ifeilslm2umn p u)aetnxo oy1lmtr u ols srxoio ou4lptnmieiat) 2umump;u0apeo fciyd s2ea(vs t0tltrir3oytfpDelueil(0 2ur(m ou4lp e netlt artaxr ot0olx mfciasls ran o;()aetnxr3oydomtr nvo;s)s2umxo3io4lltn nvtl(f rrau  ot0ale ii3tysfmDel( snu4aetnxociadfpDelivs s0trxo(r3no4lpee nciat  2rmu ooo0optnio3tyslm2rlu s t)tlenxfcty1lmDr neolt0srxrim iodolenlnvs ()sDraxront0ale iociadfs elnms t)alxoio ootfmD  ueo t0trtrxopoudop e fesl(fsDtmxroot0aet ioeiatlaDrlnmp;() ltoxf3totopDean ol(  2ur(rpio4lpt lics () 2trump;u0oet iiciat sDua(vp () rxnxf oytlatelueolt0sexo(mpiu1lme lnes t)srumu poo4ope mfeildlm2rauvon(4trxrifcoo1fmD  n il() exmir3iy1om e ictls  2tmx pno0texo feiasfm2ra(vo;t4 exrxoctadoat anvs s srtrirpou4am nlnvtlt)srraxronu1aetnmf3iat s2ua(mp t0 rxoxrcoatfa e n sls sexmxm3oy1lm  mnvtlt s2um(mont1oltomictydla uln o (0alerifctotomtraieils srxoxmpou1al e nvt ()a2rmxmo;u1aexomf3tatfs2rmnvp;u0 ltoxr iotfat lues t  2trxr nu1omee fcils s2tmx pno1tlt iieiys m2umnvp;(4teenxr totlm rau o t0sexo(rpiy1ap e fvslt  rrm(rono0texomo3ildla uauvs;t)trxnmo3ta1fm  aueo t)texr(r3oodamtn fvs (f rur(ronu0aex  f3iydfs2uaumpnu)tltrir3oy1fp eaieol(  2xrimpio1lmt lietlsfs2rrur ;o4opeo fcild aDem(vo u)aetrmociodfatrau o;t0 exoxm ou4lpe micta()s2ur(rpnu4oetn o3ilsls2umnvp t0aetrmociodfp r uei;t s2umxrpio1alen nvi (f Drmxmp;t0olenmoeildfm rmn o;u4aetrmrctydlmtrlnvs;(0s2xmxm oo1lltnlieilsf 2ra(mpnu0olxo o3iyd s2rlnms;u) lxoxrcoa1lptrlivsls0 rtoxo nu1ame  fvslt s2ta(r ;t4openif3tys a2rm(vo;()arerir ootfpt luei s0s2uoxopoudom  lieias  2rmuront4altnmf3tadla2ulnvo;t) rxrxo3iatoa e ivs;(  rxm(mpiu1opt mnetls a2trxrono0ole micias m2elumo ()teenmr oadlaDeauvsls s2tr(o3iudlp elnetl() 2taxr no1tlx ifcildlm2umnmon(4 lerxr ty1opDeluvs t  rumirpou4lpenlfcilt) Dumx ono1oet ifeiysfa ea( s u) renxr ootla  luvilt s2xo(o3iydomt mnvta()s2rmuro;o4tltoii3ilt aDeanvsnt0 ltomr3oodlpD  i i;() etrxo3ou4ol e nvi t a2tr(m nt0oleo oeiysfaDulnmon(4altrxo oodfmDeaies s texrxrpoo1omee fcsat a2uru  nt4optn fciysfmDumumpnu4alerxo tydfpDeln o t t2xriopoy4opt  fcs s s2taum ;o1oexoifciyt a ranvon()tlxrxoctatoaD aues t) 2uoirpnudam emnvsa()a2rmx  ot4alxo ieiytls rmn snt0aetrxf tytlateau o t0t2trxr nu1altn iei t arta(m ot1teeo fciys a rl(vo t)alxomr ta1oaDr neols  rumir3iu1apenmfviat arrmu p;t1ale mf3tlsfm2ea(mo;u0tetrxo3iadfmt  nvo s) 2umxo3ou1ome  ici tfs2urxm ot4opeoiociysfm raump u4areoxo tytfm ranvols)trtr(m3iudamt liesls artr(r oo1oetomieiysls ulu o;t0areoif3oo1oa r i i s)srtmxo3oy1openlfvta(fs2rr(rpnu0tpx  f3iytlm2ean onu0 ltoiocoadlatrlnvi s) 2xm(mpny4omtnmncsls) Duax pno1altoiiciytls umuvs;u0alxomo3iydom rluesls setm(opno1om nmfvil(f rtrurp;o0oleo ietys sDean p;t4tltnxf iadla rln o;() exr(o3oy1omenmnvsat sDurxmo;t0opt mfctydla2eanmsn(4 eeomr3oodlmDe uei s seuo(mpoo1omeemnvta(  Dum(m ;o1aeeoii3tldfa uanmpnt0areomrctytfp eaivo ( setm(opou4lmenmnes s)s2ua(m ;o0altn ietadfs rmu pnu0 etrxo oadlatrlnei;s0setrxopny4al  lict sf 2umurpot4tee  f3tysfa ra(vo t4tltrmr3tatfm  li ols)trtoir3nu4opt mncslt)arrrx pot1tpt ifcilslsDelnmont0artnxocia1om ran o t) exoio iu4ape  fct t  rtrxm ;o0aexnioctys s2ranvpnu0teeoir3ia1fmteau s;()s2tm(m3no4op  mfci s)s2tmumoot0tee iietad s2emums;()alerxf3tadlmt  uvs t) euoxo3iu1optnlieta( s2umu ono1tpx  f3iytfm rl( s;() rxnxrcoydlaD an i s0t2tmim3ny4altemfviatfartmxmont0tpxnmo3iyd m2umnvo;t)trxrmrciotlpDraneilt tetrxm no1ol nlfviat  rurxr no0olx io3tlt mDeanvp;(4trxoxo3iadfp r i i (0 2tr(m3ny1ll elnesat) rrmx  ot1tptnifctat a rl(mo;u0arxnmr iatfmD  uvi t seumir nudop nlieilt)aDrau  oo1aexo ietyt aDuaumsn(4treriociatomDraivi t)setr(o3nudlltn fvtasfs2truro;u1altomf3tytfs ean sn()alxrxocto1lp eln sl() etmxrpio4lpee netls)artaxr ot0opxo o3iaslm2rln s t)aleomo iytoaDe neo;s  2tm(rpiy1lme mivtlsf 2raxr no0olxo o3iat a2rmumont)aetoiociytlmtraneo s0srumxopnodllt  iei (fsrua(  ot0teen icias aDraump;t4altnio3to1omteluvi;s)s2uoxmpio4am nlictat srrm(moou4opxomiciatfaDemumpnt)artoiocoydopt  nes;(0seur(mpou4apt mieil( a2um(rpot1tpto i3iydls2ea( s ()aleoif3ootfa  aieo;( texo(mpiydame  ics tfsrua(  ;o4oet iietls a2uanmo;t)arxnxr oatlptrliei ()seur(opiy1lmtn ieslt  2trumpnt4aetoiociytfa rl(vp;t0altrxr3ty1fat  neolt0 rumxo3oo1llt  ivilsf Dtmu  ot1oltomo3iatfm2ea( pn()trerir3tadlm  auvo;t0 rtm(r3oy1ll elfeta( arrr(moou0ale iieils sDrmumo u) rerxo iatfp eliei;s s2xr(o3iodlp e fcs ( aDum( pot0aee mi3iys sDumnmp;u0texrirciotlm eaueolt  rtrir ou4lmen netat)s2tax onu4optnmi3tldlm rlu s t0arenmo3iodlptrauvils trtoxo3ny4ole mfvt tfsDurum nu4oeenmf3iytfaDeln p;(0texnmf3ty1fm  ln i;s s2xmxmpiy1aptemnes s  rrax  ot4apeoio3iydlm2uaump (0arenmfcoo1oatr n ilt)seurirpio1lmtnmicsatfa2raump;o1olto ieiasla2ua( pnu) ltrirctytlpt ln sl() 2xm(r iudaltn fct s  Dta(mo;t4tlt mi3iatlm rauvo;(4 rtrxo3tadlat  u s;s0 rtr(o3iu1lp emfvtl( aDururoou1oexomieiaslm2uanvpn(0areomf3iy1lp e i s () euo(m no4oltn ivsatf 2tmxr nu0tpxn oetyslm rauvo (4 eenxrcty1lpDean ilt0 2tmxr ny4olen nvi ()a2tmx  oo1tlt mf3iadla um(ms t)aeeomocoytfaD aneil(  rtrio3iudlp emnei t  2ur(r nt1openmi3iatfsDemnvs t0arerio tatfat an i;()seuo(opnu4olenlncs s s2trur ;t4oexnmi3tad sDea( s;(0 rxniocoo1oaD  ueols0srtrio oy4ap elnvi sfs2uaxm no1olen f3taslmDrlnms;t4texoxf oo1opDrai i;t0sexoxrpny4llenmicia(f 2taxr nt1tpeomf3tatfsDua( o t4 lermfcta1lp eau s;s0 euo(m3iodale  icsas artrx pnt4tetnio3tydfa rlu o;u) rxnxo3oydla r ieol(  2xr(o io4am nlfvi t) 2rrxmpno4oexnmfeiat a2rlums;(4 rerxfcoo1opDelnvsl()s2xmxopnu4lp e fetlt)aruaxmo;u1aeenmf3tlsfs2eln s;(4arermrcto1lmD livs s0s2ur(rpno1omtnmfeiltf Drax  ;t4opt  i3tldfaDra(mp;t4 exoif oatlm ranes;s0s2tm(o3no1al nmnct ( srrm(mp;t4opx  fctaslsDranmsnu4arxnmrcoadfa raivo;s  rxm(o3nu4aptn fvs t) rrmxmpoo4apenmociyd a rmumo t0tetomr totfp  aneo;s  rtmxr nodalt mnet tfa2ururpou4oee io3iyslsDrmnmo u4alerxo3tatfpD lu o;t)texrir3oy4lmtemnvtls)srurx  ;o4tpeomociadfs em(ms u)teeomf ootfpte i o;() 2tm(o3iydaptnlncs t  2um(mooo4oeto oetls m2ean s t) rxrmrciydlm e neo ()sexm(mpnu1lltn fci sfa2taxrpou0oexoii3tyt a2emn s;(4texoxr3oa1opDe ivilt  2umxo3nudomte fcsat  2tmxrpou4apt  ociadlaDelu p t)aexnio3oytfptran i s  2tr(r iu1al e nctls) Dtmumpno4alx  ocildfs eluvp t0 etnir3tatom eaivi;s sexoio oo1apt mfet ()sDua(m nu1ale mieiatla2rmnmonu) renifctotlaD lu slt sexoiopno1ll n fetlsfaDumu o;t0aexn f3tadlm2ranvs;u) rxoxfcio1fmt luvi;t0texo(r io4ll emiet s srra(  ;o1tee  fciytfaDrauvsn() rxoif3iatfa eai sl(  rur(o3iy1ame  neilt aDur(ronu4texnmoetlt a umnvs;u0 rtomo oydlmDrlnvs t  etoir oy4ap n fctl() 2tmxr nt0oex mfeiadfm eanvs u)aeeoxf iydfmDrln s s srxmim3oy1al n fctlt)sDua(ro;u0olt ifctat mDumums t)teerifcto1lmDeluvil(0srtr(mpnu1ll nlneil()a2umu oot1tpx  fciyd mDrlnms;t4alenmrcoy1oateanvi;s s2xoxr3ny1lm n feilt) 2uru p;o0tpt mfciys s umuvs (4 rxrifctodoaD aivi;t0t2to(o3oodop n fvils)sDrrxmoou0tpx  ietyd m rluvonu4arenio oadopD aneol(  rxr(o3iy1apee fvi ()s2ta( onu1teeoioeiltfsDem( o (4trerxrcoatoptelivs;(0 exrir3iodllenlfeiat  2rau oou1teen o3ildfa rln o t0aexoifctodlmD  nesls  euoim no4opee ietas sDtmxroou0tee mi3iad a2uan pnt4 etnmr tatfmDrlieilt sexrir3no1altn icils arumum nu0aeen i3tlsfa ulnmp;u4arxoir oo1opte ivo (0teur(m3nudlmtnmivslsfsDtaxm ou1oexnioetlt a eauvo u4aetrxo iy1oateai olt0s2urio3iydolee fvtl(f Dtmu  oo0olx moctatfa rl(vpnt) leoxo iotlmte i sl()truoirpiudom nliet tfs2ua(  ;o4tpe moctlslaDel(vpnt)artomr3tadlp raieo;t0tetmirpnu4am  lncsat) Dtrumono0apxn o3ild aDel(msnu0 renxo3oadfm  luvsls  rumim3oy4lm n neia( s2urxmpot1optomieils a umumont) eenmrcta1fmtrlueil(  rtr(m iy4am e nct sfarrmxmo;t4oeeoif3ilslmDulu s (4altomfcoytfa ranei (  2xr(m3nu1om   ncil(fsrumxmp;u0alxo i3iat aDra(mo;u0 rtrxo3to1op e nvslt0 rurir3nu1am e nvia( aDraxrpou4apx if3tydfa2el( pnt) reoxfcio1omD lies;t)s2xr(rpou1olt mfcsat  rrrum ;u4tlt  ocildfs emn onu0 rtomrcoodlmtraueo;s)seuoxm3nydoltemfvsltf rtrum ot0tpeo ieilsla umuvs;t) rtrir3ta1lmt  u o;s0srur(o3oudlltnlfei ( aDrrum nu1openifctldfmDua(vsnu4 exoxr3oydlmDeai o;t srtoio3ou4ap  mnvsa(fa2rrump;u0oee  o3iat a ul(mp u4aetoio3iotoa r uesl()srxo(opio4opt  fesltfsDrax  ou0tetnii3tyslm umnmp;u4altrir3tytoa eau il()teurxrpio1ame mfeiatf 2rauront4aexn fetys m ua(mo u0arxomr3tadlmDeauvs;( tetm(r3ou4llenmict s sDtax o;o0tetnioetatlsDrlu pnu)areoirctytlpD  ivi ()s2trxo nydoptnlivsl(f 2ra(mpot1oetomfcildfmDrauvp (4tlxrxo ty1omDr n s ()t2tm(o iudal n ncil(fs2urur nu0alx mo3ils m rl( ont)aexnxr3tydomD lieslt s2xmxo iodaptelici (f rra( p;o0apenmoeiasfs2elu s u4 lxnmo oo1faDeaivo () rxm(o ny4lm nlicsa(f 2rax oot1tetniieilsfmDulnmo;t)artomfciadlat lueil(0 etoxr oy4llt miesa(f 2urumo;o4tpxn f3tyslm rm(ms;(0 rxrmrciydop raues s) rtr(r3io1lme lnvsasfs2rmxroot1opxomfetysfa rlump ()teeriocoytopD  nes;()s2urxr ou4ll  lncs s  rtmxmpno1olt  ictatla2em( o;()aexnir ta1op e nvilt) 2toirpiydap  mfvs sfs2ra(mont1aet mieiad m eanvo (0texrif3oa1lpD  uvs s  etmimpiodol emfvt t arrm(ro;t1tptnmicias m rauvo (4tlermfcoo1omD lnes t)s2xo(opou4ol emnetlt)sDtru  nu4tlenmociytls el( p t4aexoxocootoaD au s;s0srtrxo oo1oltnlivtlt srrrumoou4oleomoetytlmDem( sn(4trxoif oo1omD  ueo;()s2tr(m nu1lmeelfctl() Dtru poo4oet  fetysfm elums;t)artnmf3ia1lpD ai i t setoim ou4lme lictl( aDtrx pou4tpenmoeiasla2ua(vpn() eenif3totom   neol( sexr(opou1amt lfvsas sruaump;o0optoio3iydfsDrau o;t4alenmf oodfaD  uvols) exm(o3nu4alte icsat sDraumpno1tpt  fcias m ul( onu) etomo oadoa  aivi;s t2tm(r oydlle livt ()artmu  nu4apxnmf3iadlmDumuvsnu0trenxf3oa1fa  an o s0texo(opou4lm  mivi tf rra(rpnt1opxoioetys a2el( s;(4 leoir3io1lm r uvs;s) rurxm3iudam  mfvtatfs2tmxr oo4olt  fetldlm rl(mo;t0alxrio3oy1fmDr uei t)s2tmir iy1alen ivi (fa2rrxr ot0oexoii3tat sDumu s;(0tetnmo3iydfaDeanvs s0 eto(opny1omen nvia( srtru  ;t0apenmi3tasfsDulnvs u4 renir3tatfa  au i;t  rxm(r3oudap nlicsat)aDra( p;u0alt  ociydls ea(mp;t4aetrxr ty1oa eai i;s0t2toxr3iu1ale mnei (f 2trxm ot4tlt  f3ilslaDraumo;(0trtomoctydfa eanei;(0teum(mpoudapen ncslsfa2raum ;t0tpe iictas mDemn s (4teenmf3tydlm rai s t  2tm(m3ou1ll nmnvs ( arurxr ot0teenii3iad m em( o t4 rtnif3ootfa   u ils sruo(opoydlmt  icilt  Drm(r nu4olt ioetadla2rm(mon(0trtrmrciotom e i o;()s2toir3iudlptnlicsas artr(mp;t1opx iocildfa2rl(mp u0 lxomo3iadfaDr ivils0seuoiopiy1apenmnctlsfaDraurpno0altnmf3iad m rmn o u)aeenmo ty1fa raueo s) rtoxo iodoptnlietatfsrtau o;t0tlxnmo3iltls rmnmon(0aeenio3oytlatr n slt0sexm(m iydaptnmiet t)a2ua( ont0olxnif3tlt m2eanvs u0arxrmo totopt aivo s trumxm3io4lm  lnvsas aDrmxm ot4alt  feias m ranvo t) eenxr3to1lpteau olt0sexrirpoo1om elfvi sfsDrmx o;u1olxn feiys s eanmo;t0tltoif3oydlaD lnvi;s  2umirpio4llte feia(faDua( p;o1apto ieils s2rlu o;(0 lxoxf oydlmDraivo;()truoxo oy4am  lfvsltfsrumx  no0oltnmiciydfm2ulumont0texnxo oo1oa ranvs;()srxrxo no4olenmfetasfaDra(ro;t4oltnmoetadfs2rln s;t4tlxnmociydla e uvol( srxrxopny4op n iet sfs2ra(m ou1oleoifciad s uau sn() exomf iy1lpD  nes t  rurxmpoy4ol nliei ( sDrr(mp;t4tetnio3ilslmDum( snt0 exnmo iadfatrauvs;(0s2tmxm3oo4ll  lncsatf rurxrpot0alt iietatfaDelump;() rxoxocty1fp  livi s s2ur(r3io1lpe  nvi tfsDua( ono1opeo iciad s2emnvonu0arxnxfciatfmD  nvsls srxmxmpny1ap e nvta( s2rrxm oo4opto ietasla2emums (0tetomf3tadfat aieslt srxrxm iy4amt mivtls  rtr(m ;u4alenmfeias sDulnvs;u) exomf oa1fp e nvs s) ruo(m nu1lptnmivtat  Dua( pno0tleoifciydfs2uau o;u4teermf3io1fptrai o;( t2xrir3nodame micsls sDtmu  no4alxnmoetad s ea( o;u0arerxr3totomt  neol()t2uo(m iy1llen nctat artm( pno1apenmfeiys a2uau p u4 etnmo to1fmD  ues t  etoir3oydomtelict s  2umx oot0oexoiictlt s2rau onu0aleriocio1la r ueo;t0t2xoxmpoo1lm   ivsl( sDraxro;o1apto o3iad a elu o;(0alenxr iadfm  ai o ( trxmim oy1om  livil(fsrrau ono1olxoifciyt sDeanmp ()aexnio iatomtean s;(0tetrxm iodap nmiesat) 2rr(moot1tlx ii3iatlm rm(vo t4tlerircoy1lmDeai o;t trtmio3ny4al e ietlsfaDua( o;o1tlxomfciatfs2ra( s;t) leomf oydlaDeli s s  rurxm3nu4ope miei s artruro;u1ale moeild sDrlump (0tltnxr oadlptrlueol()teur(opiydoleelnctls aDrax  oo4tlen o3tls s ranvp;(4trxnmrcty1faDrlnvs;t  rtmio3oy1oleemnci s a2rmu p;u4oetoifeiltfsDea(vp;u0 lerir oodla  lies;t  eum(m3no1opt lietls)a2tmxrpno0oeenii3iatfs emums;u4 renifctatfaDrai o (0sexmxr3io4apt lfctls) 2uru pot1oleoifctydls ea(vsn(0tetnif iodlmDeaues;()trtrim oudlptnmiesltfs2urum ;o4tle mfctltfmDrlnms () etoio totlmt  neol()t2xr(mpnydlmt miciat aDuaxmp;u0aetomfeiaslm raumonu4 lerxr3iodop  lnvo ()s2xm(m3oydllenmnvtat)aDrrxmpnu1oexnifctatls2rlnmsnu0 eerircoa1fatrliei;t)texm(m3io4omt mfvsat)srum(mpnt1oeto i3iat mDem( p t0teeoxf oytfmD  n i;( seurxr iu4lpte nvsl(f 2rr( p;u0tee ioeildls uanvp;t) lxnmrctydlmDr nvs s  exoxo3iu4altelneil(  2rmxmonu4opxo ociys mDua(mpnt)alerxf3oatfpD au o;s t2uoxmpny4llee netltfaDraum ;u0tpt ii3ilslm2el( on(4trtnirciodfm rln ilt0 2xrxo nudapenlivslt s2ta(ro;u4olt mf3ilt s uaums u0 ltrmocio1fa  ln sls sexo(r3no1lltemncils s2ra( oot4olx  oeiatls2emnmsnu0tlenio oa1faD liei ()s2toio iy4lpte ieiasf 2urx ooo4aptn fetldfa ranvpn() eeoxf3ta1om r u s;()trxoimpiy4altelnci t)aDtmu poo0apeoiieiadla rmump;()aetoxr3iatfpDr u i;(0sexrxmpiy4llte nesl() Drrxmont1texoioeiysfm ran p;t4artoio oytoa   i s;(0setr(opoy1ale lietas)s2ua(  ;u4texo o3iyd aDua(vo t) lxrmr iydoaDrli o;t0trtrio3io4lmeelfctltfsrraum oo0olto oeiyd aDemu o;t0 reomf ia1op  lnei ( t2tm(m no4lptnlicsas  2uax ont1optnmoeildfm2elnmsnu)aetnxfcoo1omDelieil() rtoxo3nudol n nvtls)arrrx  ;t4opto f3ildlmDeln o;u0 rerxrciotlaDrluvil()srtoio iodaltemieta(faDtrxrpot0ape ifciysla elu s;u4 rtnmocoo1fatr nvi t0 2umim3iu1alen nct t  Dtr(m ;o0optomoctltlsDemnvsn()aexnmocty1oa ean sls sexoxm3oy1amtnlneils arum(moou0oetniieiasfa2emn p t0aexnxfctydlaD  nes;s0s2xmxr iy4ameelfetlt  2rrur nu0tpx if3iysfsDul(mo;t0aetoxf3ta1fpDelivo s0 rurio nu4lltelncsat) rur( o;o0oee  oeiasfm2eanms;()tltrxo3oatfmt aueils)trxoir iudopt mivilt a2uax o;u0aee  icildfaDrl(vs;u) rxnxf3iadopt auvsls)t2xmio3oo4olt mies (faDtmx  oo1alen o3iys m2uauvp;(4tlxrmo io1fmDelnes () rxr(mpiy1alt lfeia()arumx p;o4aexnioctadls ul(msn(4 leoifciotoa  aivi s0s2tr(r iodamtelncs t aDtm( pnt4texomfeiytlm umu s (0arenmr3oa1fm  ai sls)s2xoimpoudomt  nvt t)artau pno1teeo ociatla2emump;t0trtnmf iatom  aneslt sruo(m3nu1apen ivil( sruaxro;t1aetoiieiadfmDeaumo u4arxrio3oodfmD  nvo t) 2uoxo iy4lp e nct ()srraumoou4aexo octydlaDel( p u0areoir3oatlatr ivol(0teuo(o ny1alt mivil( sDrrxrp;u1tptn f3ild a2ulumonu4 etrmo3ia1lpD  i o;t  rtr(o3no1op   neta()a2raumooo4tetomi3iltls2ua( snt4trxomr iytfptr nvilt sexmir oo4lp  liei t) 2rrxr ou1apxn f3tydfa ulumont4 lerxo oy1fm  aues;s0t2uoxr3nydale  nesltfarrr(mpot1apt iieiysls rl(mo;u0 rtomf iodoat  uei t0 2toxmpiy4amen fvias  2rr(  ;u0oltnio3tatls2um(vpn(4trxoir oytla r ueo;t0trur(o oudlp nlnviasf Durumpou4aexoii3iadfs2em( pnt4teeoxocoo1fa  aies;t) 2tmxm oo1oltn fcsls)s2rr(m ;u0tpx mf3iydla2ul(vo u4 ltoircto1lp  aieo t) 2tmxm3nudlm emfet ()aDrru p;o4apxn icias mDra(vo;u4 lxnmo3oytfmtrlu s t0sexmio oudll   fcilt  2ua(m ;u1oet moetls s2rln s;t0tlerio oa1omt  nei;s) eumxmpnydlmt  ncsl() rrruro;t1ole  o3iatfs ra(mo;()aeerif3oo1oatranvilt s2tm(o no1lmt  ncslt)s2taumo;o0tetnmf3iyt m2ra(vont)aexoxfcoydfmt  ivs;s) 2uoxm3ny4am e neias)srtmx pnt4optnmoetltfm um(vont) ltomo oo1op  lies s0sruoir nu1am   fvsl()srua(monu4opxniiciyt m2eauvpn(0tlxomr3iy1omtrlnes (0 rxmio3iu1opt  nvs sf rurur ot0oleniociatfs ran s u0artnmfcoydomD aivilt  etoxr ny4alenlfvslt  rtr(rpnu1opto icildfm2ea(mont0tleoir3oa1lmD lnvils seumirpio4apenmictl()a2rm( oot1altomf3ias s2emumsn(0 rxoxfciotoatrlueo s)t2um(opnu1lm emnvils  Dtrxrpno4apxnio3iytlmDua( p u4 etoxo3oadlmD  u i;t0trtmio nudaltelncil(fs2uax  nu0aptniiciad s umu o u4 reoxr oytfmt  n sls  2xr(m iudopt lietas aDtmuroot0oexniociasfsDel(mp;t4 lenifctotlm r i i ()sexoir no1amtelnetatf rrrxr nu4tet ifeiaslmDul( pnt0alerxo3oydlaD auesl(0 rxoio3iodoptn fvilsfarrrxmont0alx ifciytfa emnvs;t0trxnmr ty1fp rlnei (0srumirpny4ape  nvilt aDra(rono1texnmo3ildfm2rl(mp;t0tltnioctadfm rau s;t0t2xmxmpnudlmte fvias)srtaxrpou0texnmo3taslm2rm(vpnt)aexoio oa1opDelu o t0t2umirpiydlmt lnviatfaDrau ono0tpenmociad aDrl(von() rxnmr oo1lpDeai i t)srtm(m3oudlpe  ict t) rtmu  oo1tleo feilsls2rlnms u4 rxomo ootlpD li ols) ruoimpoy4alt  nesls a2tm(r nu0aeeomictatfsDumn s;t)arxoir3ty1la r nvs t t2xoxm oo4amt micils  rrm(rpnu0opxomietld mDea(mont)trenioctadfa  livs ( s2trxr3iu4ome livt s)sDtrxr ;u0teen o3iat aDelump (4 rxrxf ia1omDeanvils0trto(r3oydape liviat)srrmx  ot0tpt moeiatfaDrauvp u)arenxf3oodfp elieo;s0srur(m3iy1lp e fvil() rtaum ;o1tee  fetatfa2ul( pnt)tlenir iy1fa e u slt setrxopiu4olt licta() Dtm(m ;u1oltoiicilsfa rluvs;u)aeerifctotfptr i s t)trurim iy1ape mfvia(f Drrxr oo4apeoii3tas sDrm(vs;t4 eenmocoadomD aneo ( trtm(opnodlle lnet t)aDtaum nt4tlx  f3ildfaDrmums;u) rerir3ta1fate nvo;t0sexrxr iy1aptemfvslsfs2taxmp;t0teen ociat a ea(ms ()trtoio3iytop raneo s0 ruoxm oydlpe  ivsasf rtrxr no4apenmoetysfsDra( sn()alxnir iadfa eaues;()setmir ny1oltelietat sDur(mpno4tpxoii3iyslm2elumon(4tlerxr3ta1lptraieil(0 eto(m3nu1om   nesas)s2rmur ;o1tee mfeiltla2eln s;()artoif3oydoa r n o;(0t2uoimpiudlltelieiat)s2tmurp;u1teen ieiasfs uln p u4 rermr3oodfp  aivsls) rurxmpnudlltelfvsas aDtau  ;o1ole  ociysfa ulnmon()trerxrctadoaD anvo;( srxoio3nydapenmnei t) rrm(rp;o4opxo ociltfsDeauvp;t0alxomr oydopte i s s)t2um(mpnudlmt  fesls srta(rp;o4aetnioetld s ranmsnu4trermrcia1fateluvo;s  euo(o oydlpt  ivtl() rtmxm no1tpxo ocildfsDeanmont0artnmo3iytla e uvo s0 euoxo3oy4ome  fvtat  Dtaxrpnt1apxo i3ilsls ulnmp u)arxrxf ta1fat anei;( srxoio3oy4ole mfvta( sDur(  ;t4ope ii3iysfm2rm(vont)trtrmo3ia1lmDeanvi ()s2xm(r io4omte ivt () rrrurpou1alx io3iad sDrauvpnt4 rtnmr3oy1fatran s;t)srto(opio1lltemncsat)s2um( p;o0apt  o3iltla2ranvont0artrmf iadoaDeaneo ()s2xrio oy1optnlnvils  rurxrpoo0opxomoctatfa eau p u0altoxfcty1lmtr ivils t2toirpnu1lmenliet s)aDur(m oo1tpeoio3ildfa2umuvs;u4tltoif totlpD lnvs;( tetrir3nydam nmnet tfsrrmxm oo4tpto f3iyt mDulnmp;u)tlenxr iodfpteau slt s2xmxm oo1om elicsas) Dtmu ont1aexomi3iasla ulump;(0teenmr3tydfaD ai slt sexmio no1alte nviasf 2raurp;u1olxn fctasls2emu o t0 renmociodfatr uei;s0 rum(m iydlp e ncs (fsDtmu p;t1openmieildfa2el( pn(4 rtnmrcoadfpD ai s;s0 2umxm3iu1ol nlnes sf Dumx  oo1alenifctydfs2emn pnt)alxnmrcoo1opt au ilt) rurxo nodlm emfcs tfa2tru p;t1alx  iciysfaDemn p;t4tetnmf oodopDeln s t0srumxm3io1omt  iei t) 2urxmono1aleomietas aDrl(vs (4artnxf iytfaDrln s (0seurio oydame  iesas) 2tr(m no0oltn ietls m uaums;()alxrif3oy1lpD  nvo (0 rxrxrpoodoptn icsl( artaxro;u1tltomf3tltla ua( o;t0arxrxf ia1lp  aneo;s0 eumio ou4lm   icsl( sDtm(m ot0tpx micildls2emnmo t)tetnmo3tatfpDrln o ()sexrxopiy4apt lfvslt  2raxronu0oltniictydlm2ranmon(0aeerxo iatlpte uei t)t2tm(rpno1ome miei t)a2ra(r nt0ape  fcias a umums;() ltnmrciy1lmtr ies t s2uoxo nu1lpenmfeiat  Dtrxr ;t1tetnifeiadfm uln p u)tlxrir3ta1oate neo s  etmxo ou4op elfvi tfsrra( pno1alto f3iysfaDeln s u0 renxocoo1lat lnesls t2xriopio1op nlici ()a2umxrpoo0tltoif3tydlm2ul(vo;u4trerir iadfaD  ues (0t2uoxo iy1ap e ict tf rrr(m ou1olenmo3ias m em( sn(4altrif io1fpDeau ol(0truoxr3iy4omeelnct (fa2urx pnt4alxn ietatfmDem(mpnt0 eerxf3iy1laDeaivo ( t2uoxo ou4lm elfetas) 2uaxronu0tleo i3iatfsDrmumsnt)teerir to1fpD  neo t  rum(o3ny4omenlici tfaDtaum oo0tlt ii3tlsfsDemu o t)treoxocoo1lptrauvo;s0seurxo oo4lpe  ivsa(  2um(root0optomictydla2rlump;(0 lerxr3oodfmDeauvils0trum(m nu4lm emiei t sDrmx  ;o0oex ioctyslm2ulump;u)aetrmfcoo1omD  iei s)trum(o oydame micilsf Drmu oot1oeenmo3tydls emu p;()aleomrcto1om  aneil(0setriopnudap  mnvtl( s2tax oou4tltnifciysfm uaumo (0tlxnxfctytfaD lueol(  2ur(m oo4lm n fvt (fartmx pnt1alxniicils sDrln s;t)aexnxfcoadlmte i sls)tetmio3nydlpen fei ()srur(m nu0teenmfetydlaDea(msn()areoxf3to1op  auvsl( trtrxopiu4amenlictl( a2ur(ro;t1aptn fctyslm el( s u) reoxr3ty1om rau olt t2ur(m iy1amtemfvs t aDum( pot1opxo fetldfs uauvp u) leoir ia1la eau ol() 2xmxopoodolee fvt ( sDtmx o;t4tlto feiysfm ul( onu4tetrmrctotlpt  ies;s)srtoir3io1llt lfetas srtrx ooo1tpxnio3iatls ua( p;()tlerxf oodoptelu o;t0setm(r3iy4lleelfetlsfarrr(ront1ale mf3tlsfs el(ms;u0artnxo iotlpDraneo (0 2uoxr3nu4ll nmietl() Dtrumont1tpto iciadfm2rln s (4altrmfctydopte uvi;(0 rxoirpno4lpe mncsa(f 2umuro;t1tpt mi3tasfa2emnvo;t)trtoxrcoodlmtrlnvslt0trxrxr3nodope mneil() rurxm ot0texomoctysfaDra(ms (4texriocta1faDeaneils t2toxo oo1lmtnlfei (f rtmxroou1apeomfctyd mDeau o;()texnxfcoatom  aivi s sexrirpoodolt mnvtl(fsDua(r ;o1tle ifeiatfmDuluvon(0 exoxrciytfa r nvo;( srtmirpnu1amt mneslt)srur(mpnt4oltoif3iys mDulnmpn(0 etoifctotfmt  ivo (0trtmxm iy1ole lnesltfartmurp;o0tpx  octyslmDrmnvs;(4alxoxr3iadoptelneslt s2xmxm3ny4openmnesat)srtm( ont1tpt mietys mDemu o u) lenmr3tydlmDeaivo s0seumir oy1om  mfvia(  rtaxmp;t1aee  ieilsfm ulu p;t0texomo iatfat livo s  2xmimpno4altn fetas srraxro;u4aeto feiatlaDelumsn(4teermf3ty1laD livi (0 exm(m nu4altnmncsl( arum( pnt0open o3ilt sDul(ms ()tlxnmo3oatlp eluvs;t)srum(m no4ol   fciat) rur(mo;u0olxnmoeiyt aDrlnvsnu0 ltrxo3tytomDrauvi;(0 rxm(m oydoptemics tfsrtrum ou1tpxnmociltlsDulnvp t0tlxnmr3todop eaneol(0 rxrxr oy1ameemiciatfs2tru poo1tex moeiltfa2umn pnu) eeomr ta1opteluvsl(0trtoimpno4am  mfesl(farur(m ;o0ole  fctlsla2ua(mon(4altoir3iotoatrau i (  2umir iudale  nvs ()s2uau p;t0tle ii3tatla2rlu s t0alenxrciodfmte uei s)srtrir io1om nmncs ( aDtax poo0oeeo octysls rmu o (0 eerif3iytfatelueols0t2xoxr3oodlmtnlictas srurumpnu0oee  i3tydfm2uanvp;() eerxr todfmteln sl( trtrxo3iodam nmfvt t  Dra( o;u0aeenmf3tyt a2eau on()tltnxrctytoa eluvils0 2tm(r nu1ol elfeiasfsrra(  nt1olx  ocildlmDumuvs t)aexnir iodom rlu ilt0sexrxo3oy1ap e fvs s)sDraxro;t1oeeomfetytls2uanmo t)aexomocoytfmteai i;t0trtmxo3nudamtnmfcil() 2rr(  nt4tleo fciydlsDemn p;(0teenxr todlpt ln i t teumxr iy1ap   ici t  2uru  ot1opxomf3iadfa2um( pnt0trtrif oa1oa rluvo;t0seuoxm3iu4olt mnvsat)srumump;o4oexoiociadfs rlumpn(4tetomf3iodopteluvils0t2tmxopnudal  mnes s)sDraxmo;o0optnmieiadfa2rl( s t)tlxoio io1om e i i;t) rtoxr iodop elfesas)sDuaum ;o1ape  feias s2eauvs;(0alxrif oodlaDrliei ()srto(opiu1amtemnei t) Dua( pot0tpeomi3iys aDuaums u0aetnxociadomD  iei t)truo(o iy4ll n ictatf rtmurp;t0texnifcias aDua(mo;u)aexomfciy1laDrln s s0 etmxmpoydomeemnvsasf Duaurooo4tptniocild s emnvont4alxrmrciydfptraivo t)tetmxo iu1apenmnvta(f 2rmxm ;o0tltoio3ildlsDean p u4tltnmr3tytlpDelivs ( t2ur(o ou1ap nmnvi sfaDtaxmpno0opxn i3tld a2rmu o t4 rtrir3oadop rli i;t)srto(opiu4omte nvi s)a2uaxro;u1olx  f3iasfm eluvs;u)tltrmr oo1op  li s t) rxmiopnu1opt lfvtltfarua(  ;t4aetniociyt aDrl(vonu0treoxf ta1lpD auvs;s)t2toxr oo1lle mfcslsfartmur ou0tetomfeiyt a rlnmpnu4alxrmf iatfat au ilt) 2urxrpnodlleemnvta(faDtr(rpno1oltomo3ilsfa raumo;(4artomr3oa1op rlivols)t2tm(opnudoptn fvilsfsDtrump;u0olt moeilslaDua(mp t4 etrmf3totfpDeliei;t  rtr(m3ny4amtelfcsls  2rmumoot4tetn i3iys mDulu onu0texnioctodfat li s;s t2ur(o iy4ll  mnctatf 2uru ono4teen fcild m el(mp t0trtomo3ia1fatr uvs () rtrxrpou1llenmicil(farrmxrpnt0aleoifctaslm2ulu p;t)aexrxrcoo1fpt aivilt  etrxrpnu1lltemietasfartm(m ;u1aex io3iydfs uan p (4aeeoxocoadlmtraues;t0 2toxr3no4op emivia()a2ur(mono4tlxn f3tat s2um(vo;() renxf ty1fpDe nvsl( truoim3no1omtnmieil(fs2uaxm ot1oleomfeiasfs2ea( p;u)aexnxr3ia1fmte uei t)srtmiopiodlp e ncsa()s2tr(  no0olx  fetls m uau pnt0areniocoatfp e ivol( srto(opio1am nlieiat) rrr( o;u1aeeomoeiydfa2uluvp u4trtrmf3ty1lateauvolt0seuoxm3oo4lp emiet t)srtrxmp;u1oexomieiltlaDuaumo;t)aeeniociotlaDelnvols)s2toxrpiy4lp nlnci ()aDrmxr ;o4alxomfciysfmDemnms;() lenmr3oy1oaDraivsls s2uoxm iy4lpee ivslt)sDtr(mpnt4opxomf3iysls2rmumo t4 rerxr3tydoa rlneo;s0teum(rpno1lm elfvil()sDrm( pno0oleoiiciad s eau sn(0 rxrif oa1oa  anvs s setrxopou4llte fesa(fsruru  ;t1apenifetltfa rl(ms;u) lenio iydop   nvs ( teum(rpno4lm elfvs sfarur( ono4openmfeilt s2rmu s;t4 rtomf3iodop eluei;s)srxr(m iodoltn fetls) rtaur ;u1alxomietltfmDum(ms t)areomf3oa1lm   iei;s0 exr(o nydole lncsl(fsDur(moot0tltnif3tadfsDulnvo (0tltoio3tatom e u i s0t2toir iy4ll n iet s)artaum oo1teeomoetaslm ean s;(0 exriociotoate uvs s) eum(r3ou4alt mfci t  rum(mo;o4aetnifeiysfaDem( s t4trxrir3oodfaDe neolt  eto(o nu1lme mivtasf 2umumo;o4olt  f3ilsfa2uaumsn()alxnmocoodfatelneo t)tetmir oudllen fetl(faDtax pou4alto ictatls uln o t4 rtnif3oydfpDrlnvs;t)srurio iy1amee fcs t)sDtaurpot0teeomocilsla emn o;()areomr oo1fatr i o ()setoxr oodom  livt t) rrmumpno0aetn fctasfm2eaump () lxomf3oytlpDraivols trumir3iu1ap nlietatfa2ur( o;o1opto f3ildfa2em(vo (0 rerxrctodopDeluei;(0srxrxopoudame lfvs s  rururont1oleo feiltfa em(vp u0 eerxrcto1fmtr i s ( t2xmim3ou4omt  iei s) rrrxrpnu1aexo i3iatls2emn o ()altrif3ootlm e nei s t2ur(m iudopt lfvi ()srra(rpot1open oeiysla2eln o (4alerxr3tytlateai s s trurxo ny4lpte fetlsfaDtau  ou1oexomoetatfm2ranmpnu0teerxf oa1late uvi (0t2xo(r3oy1aptemnvs sf rtrumont4open o3tat a2eanms t4 etomr3iytlp  aieo;(0 rtm(mpoydap e neia(f rtmump;t0alto ieiadlaDulu s;t)aexnxr3tadlmDe nvo;s s2xrxm3nu4amen ivias)srrrur nu1tee  oetysfs2uanvpn(4arxoircoy1opDe nvilt t2tr(o3ou1ameemivs sf Drrxmo;t1olxnmfeiatlm2um(vs t) lxoirciy1omD  i o t0t2xoim3oy4omt mncs s  Dum(mpnu1opt io3tysls2em(vs u4 lxrir3oytfp e ivi t sexrxo3oydamtemfei (f rtaur ou4tetn ieias a2ulu o u4 lenmr tatlmteaieo () 2to(m3nydaptemfvsl(  rum(m ou0openmoeilt m2ra(ms;t0tlxnmr iadlpDrlues t0 2xrir3iu4lmt livsatfa2tau o;t4tlx  feiyd a2um( o u) lxnmo3todlp e nvi s)texoxr oodamenlict s)aDtmxro;u4olx ii3tyd aDrl(msn()tlxrmo tydlmD lneil()sruoio3io1omenliet () rtaxm nu4teen i3tytfs rmnmp;t) eenmf oadoptranvolt seuo(mpiu4olen icsls)aruax p;o4oet ii3iydfmDrmuvo () exoxf3tytoa elivi;t)t2umxr nu4am nmnvilt)aruaxmont1oeenioetatlm rau p;(4trxrxocia1lm  auvo;t0 2umim3iudlpt lfeias aDtmxro;u0apx mieilt mDrlnvpnt)aexoir3io1fp rlivi;(0srto(m3oo4openmiei sfsruaxr oo1olxnmieiad s2ea( s;t) rxomf3totop r neo s) eum(o nu1opt lfci t) rurx  ot0altnifciadfs2emuvpnt0tlxrmo oa1late ues;s0tetr(r3oydame mfei ()aDur(mooo4altnmoctldfa rm(vpnt4altoir3ia1oaDe ivo;t t2uoxm nu4lptnmfviltfsDrrumpou0tet iiciat s2uau o;u)teerio3iatlp   ies t0 rtmim3ny4lle lietlt sDur(roou0tlt  iciys m2em(vs;t0tleoir oa1faDean o;s srtrimpoudap nlivs s)srumu  ou4tlxnmoctadfaDrmnmp () eenifciydopDeaneil()srurxr oo1opte fes (  2tm(mont1open feiltlsDemumo;(0trtrioctydfaDeauvolt  2xmio3oy1ameelfcilt)aDtr(r nt4apt moctltfa2rau snt)arxrxr3iytop  auvs;s) rxm(r nu1lltnlnctltf 2trxmonu0aeeoif3iltla2uaumont4 lxoxfcta1la   n i;t0sruriopiu4opee ncta(f Duaum ;u1aeeoiieiydfm emn p u4texrmr ia1oaDeaieo s seur(m oy4aleelnvs t s2rmur ou4olto fetytlaDumnmonu) lxrxo ta1opDrluei s s2to(mpio1ll  mncsltfsrra( p;o1oexn feiysfa2emn s;(4tlenif oy1op   u s;t0srum(rpou1ll  mivt t aDtm(mono4texoiieiydfs emuvp;t0 lxoxo3ta1faDeanvil()tetriopny4omt lfvsls) 2rm(rpno1aex  i3ildlsDranvsnu) rxoxrctodfmDr uvslt s2toxm3ou4omen ivs s  2rmxrpoo1oeeoio3iadfm2el(vp;t)texnxr3totfm eluvi;s)srxmxrpoydamenmfct (fsDra( o;u4ope iiciad a uanmpnt0 eenirctadfaDelies t0seumxr3oudamtnlfeiat)sDum(  oo0oetniieiat a rlumont4trxrif iatlat  n i (  exr(r ny4om e nesls aDra( ono4olx mf3tasfa rlnmon(0arxoxf tytomte i o s) rxm(m oy1lpee nesasf Duaurpnt0tpto i3iysfm2el(vsnu)teenmf iytla r nvi t0 eum(m io4am  lfesa( arta( o;t1tpt moeiatfs el(mon() etrmo3tytlpDrli i ( texmxr3oy4lptnlncia(  2rrx onu4aeeo o3iyt s2ul( s (0aeeoxocto1fmtranvolt)setmxopou1al  lnvil( s2tmxmo;u4opx mictatls2ra(mp u0alxomfcoa1fpte ivolt trxr(opno1ameemieil(faruau pnu1oex mieiydfmDra(vo;(0trermf3oytlmDr ies;t0 rtmirpnodame  neia(f 2tr(r ;o0ole mi3iadlaDran pn(4artrxr tadlatr i il(  2umxmpoy1lpte fei sf ruauro;o4aetnmieilsfsDean o;t0 eerxfctatomDrlies s t2to(mpnudlmtnlnvias sDururont0aeeo i3iydfmDeanmo u0artoir io1laDrai s t)t2uoxo3oy4altelncsls) 2ua(m nt1tleoioeiltfa ean p () etnmr3iotlpte neils srxrio3iu4lmt  nvia( a2tmxmono0aexoif3tatla2ulnvo (4alenxf3iotfmtrlueil(0 etm(mpoudal  lfvi t) rrrxmpot1optomfetyd a2elnvo u0aeeoxr iytomD lies;s t2ur(m3oo1amtnmnvi t  rtru p;t4aeeoiociatlm2rmump () ltomf3oydfp rlnesl( teumiopiy1alt lfvta( s2uau pno1aeen fciatlsDuauvs u)alxrmociytfat  uei s) rum(mpiudolt mietl(f 2trxm nu1tet iieiaslmDulu p;u0 ltnmo oo1fpt au o s0 rtrxm iodalt lfvils artrxmpou1oexn feilt s2ran pnt4aeenxo3iadlp raivilt) etoxo3io4llen icslt) 2uaxmpno1apxoifciyd m eluvs;u)tlxomf3ia1lmtran ils srtmio nu1om emfvs sf Dtmxmono0apt ifetlt m elnvpnt0tetomrcto1fm  luvi s)trto(m3oy4am   nei tfsrur(mpoo4tptnii3iydfs rau o (0texoxrctadla eau i;t t2xoir3iu4alt  fvslt)a2ua(rooo4apt  oeiyt aDem(vs t0tetnxf iodomteau o;t t2ur(m3oodaptn fvil(  Dtaumo;t0aptn feiatfs rauvo;(0aeenif tatfpDeaivo;() 2xmxopiu1al emnet t  2uau  nu1aptn iciasfa ranms;(0arxrmf oydfmtrliesl()srtoio3oo4lpe mfeiasf 2taurpno4oee  ociltfaDeauvpn(0tetnxr3tadfaDe n i t)srumxm oy4alen nvtlt sDtrxr nt0tee iieiytla el( s ()trtnxo3oatopDe ivol()seuoxo iodomeemnvi ( sDtau  ;o4olxoii3ilt m2rmump;(4tltoir3oydlpt lnes;t0 2trxo3no1alt  ivi sf Drrxm nu0texnmictasfs2ua( p;(4 rxnxf iydfptrlnvi s  rtmio3oudlpeemici s) 2rax  ot0tee iictadls2umu o;(4 rtoxo3oatopt luei;s trxmimpiy4llenmnvils)sDur(ro;t4alxn f3iydlmDumu p;(0tetoif3oodfm e uvs;s) rxmimpiudal nmfesas)aDrru oot4olenioeilt a emn sn() renmo ta1fptrluvs;s  2trir3nu4lptnlivs s)a2tru  oo1oetoiietydfaDrauvp;(0alxrmo iotfpte ivi;(0t2tmxopoy1lptnmfvsa( arta( pot4alx ifctasfs2emu s t4 ltnmrcoadla r u s;t) rtrir3nu4optnmnctls)aruau  ;u1apeo feias s emnmonu) lerxf3oo1fm eai o s)s2toirpnudlp emicsas) 2urxrpoo0aptomi3iat s uanmsn(4 ltrxf3tatfm rlu s;t  2tmim3io1aleemfcs t)artau p;u1aexn ietysfm emn on()alxrir iytoatrlnvo;( trtr(o ou1ap nlictas
\ No newline at end of file
@@ -0,0 +1 @@
+nes;() rtoio ou4lme lfvilt) Dumxmo;t0tex ifcilsfa rmnms;t0 lenxrciatoa eaieo;s0t2xrim3nu4lltelfvi (fs2rmxroot1optniieiytfsDrmums;t)texoif ta1om e neolt0 exo(o3no1lmtnmncias)sruaxr nu1altn icildfm uaump t0areomocoy1la   nes s)srxm(m3oo4oltn fcsas  2urxrpot1olto oetls s eau on(0altnxr iydopD aues s)texo(o3iy1olen ivs (fs2trxmooo0alto fcils sDeau s;()trenxocoo1fpDeanvils trumim iy1openlneiatfa2urx  no1opx mictat a emn s;(4aexrmrciy1lm  ai i;s0 2uo(o iu4llenmfctl( s2rm(r nt1aex mo3iadlaDuluvo;t4trtrxr oo1om ranei;(0 exo(rpiu1ome  nvi () rrm( ooo4tee mociys sDuan p;(4aeenir3tydfpt  ivi;t) etrxopio4aptemfvs ()a2umx pno1tlxo ietltlsDuanvp () rtrifctadfpt luvils0 eto(o iodll  mictatfsDtaxmpnt4tpeoifeiadlaDeanvsn(0trenif ta1oat  uvs;t  2uoim oodamen fcslsfsrumumont1olto ictld s rmu pnt)arenifcoydla  ai i;t srurxmpiy4ape mfeia()srrr(m ou4alxomf3ils a um( p;u) exrircio1opteln s s0tetmirpio1lmeelnctlt arraxm no4tleomociydlm2rauvp;t)teeoif3iatoaDraueil(0 2xmim nodoleemncsatfs2tmurpot4alen fciyt a2eluvo u)aeermo to1oaDrau i s)sexoirpiu4ap  lfvsa(  Dur(moot4oexomfciatfm2ra(vs;u4 lxnmo oydoate u slt  2xo(rpiy1lp n fvtlt)sruax onu4tlt mf3tltfsDel(mo () renxocio1opDrli i;()trxrir3oo4am elfvs () 2umxrooo0oeeniictyt s2rln o;(0artrxrciotopt au ilt0teum(r3oydamte iesa(f Drruro;o0aeeoif3iltfa emn pn(0 rxrxf ta1lmt liei t)t2tmio iy4ap e nvsl( a2umxr ou4texnmoeilsls em(vo;u4trtoxr oa1op rai ols0 eumxm3ou1lp  mfetatfaDta( ono0opt  ieiad a2uaump (4alenmf tatfatrlneo;t)trumirpou4optn ivi t  2uax  no1teeoiocilsls umn pnt)aetoif3ty1om e neo;s)seuoiopoydol emnvils  2raurpnu4oetn f3iysla2uan snt4arxomr3ta1opD  neo;( t2xm(r3iy1lmee fet s)arur(monu1tlt  ictldfsDel( snu) exnif3oodoatelueil(0s2umxr3nu1ol  mncs tf 2uax ooo4texomociydfs2uluvpnt) leomociatoat  ueols) etmirpny4ol  lncslt aDrrx  ;u0aptomoetys m rmu pn(0 leomrcoadomD livs;t) 2xoxm ou1opt mfvi t s2uaurpou4oexo f3iyd a rmn o ()aexrmo3tytoaDr ueo;t sruoio3oydame lfcils  2rr(rpou1apenmoctas aDrm(vont4altoiociy1omD ln o;(0s2to(rpno4lmtn ivtat) rtm(m ;u1aleo oeiadfs elnvp;u)aexomfciadfmD aies t)s2xmxmpno1ol   ieia()a2umu p;o4olxo ieilsfa umnvpnu4artnmo oodlm   nei s  rxr(o ny4lptnmnvsa() ruaxmpou1alxn f3iytlsDemums (0aexoiociotla ran sl()setrxm no4op emfcils)arra(rono4apxo ociltfsDeluvs;t0texnio oo1opD lu s;t  eum(mpiydol   nvi tfsDtaxronu4tee  o3iytlm2rl( s;u) rxnmf oodlmDelu s (0tetmimpno4altnmieias)s2tr(  ou4tltomfctyd m ul(vo;t0tetrmf oy1fateau i;()t2umxr io4ameemfeiat  2rm(mo;t4tpeniicildfa2eauvo u0tlenmo3io1lmt luvo;s0 rtrir oo1llen fet t sDuau  oo1olxniicias m2uln p;t0 lxoio3tytoatelu s t)sexo(r3io4ap e iviatfa2taxmpnu1optnmociytla2rmuvs;u4tleoxo3tytoptrlivs t0 2umxo3ou4oltemieias)s2umumpou1opx mfeilsfm2ea(vp;u4trtoxr oadlaD aivsl(0trxrim io1llte fvias sDrax  no1tltn icild a2eanvo u4 exoio oy1la  lu i ( srxoxm oo1lltelfcs ()srrmxmo;u1ole  i3iadlm eln s t0trxrio3oy1lm  lu o t)setoxo ou1olt lfet s)s2ra(r nt0aeenif3iat sDranvsnu4aexnxr oadlaDrauvi;t setm(mpiu4am nmiei s)arrrur no0tpeoif3tat s ran o (0aetrmfciytfaDeau s s0 exm(o3no4am elfetat  Drax pot4tpx ifciytfs rmnmonu)trenir3oytlpDr ueo s)trxrxo3no1amt lnesls  2urxmp;o4optnmo3ildfs rmn s t0artomrcoatom  lieo s)teurio3nodalt  icias  rrrumo;o4aexnmieiytlmDraump;()aetomo oodlm raneo;() eum(rpnydlpe lfcta(faDtmx o;u1tpxo f3ils m elnvp (4aeeomo3oa1opt  i ilt sruoxrpiy4olt mivias) 2ra(m nt4aetn o3iatla rmnmp () etrxo3iatla   u o (  rtm(o3oy1apeemnctatf Dra( o;o4alxomoeiat mDrmu pn()aleoxr ia1fp rauvol( trtmxm no1altn fetat)s2tm(m ;u4aeeoio3ias mDeau s;u)trxoxfciydom  livi;t0t2xmirpou4aptnlfvi s sDta( pnt1tltnmf3iatls2rmn o;u0trxomf3to1oa elues t  rumir3ny1ome mfctas)arurxro;o0apen oeiyd s2rau sn(0 rxrxr tytfmt auvil() 2uoxo oo4lp n feil(fa2ra( ono1apt mfcils m2elnmont0trtnxo ia1lptr iei;t)t2toxrpiudlp n fcsa(fartmx  no4tpto ictlt s umu p;(0artnmo3tytfm raies () rtoxo3oy1op nmfvtat)srrmu pnt1opxnmietyd a2rmumont0aexoxocty1oa   neols) 2trio oydapt lfcilt srrm(monu1teenmf3iltfa rln o t0teeriocoatfaDelivi t) 2xmirpoudaltnlfetlt)aDur(rooo4tpto o3iytla2rm(vsnt0artnir3iatfatr nvo;t tetr(rpno1lleelncs tfaDtaxrp;u4tlt  fciys m2rln snu)trxnxr3ia1la e n s;t seuo(m3io1lmtn neia(fsDrru ooo0oexnifeiydfsDuluvs u) exrxoctytfpDraivs s  rur(m3nu1lpte feta()aDtm( o;u0tlt  ieildfm ean p u0aetnmo to1opDraies t0truoimpou1ap n iesls  Dtaumpnt0oexnii3ilt m uauvp u) rtomo oytlmt  n o;( t2uoxm3ou4ale lfct ()sDta( o;u4apt  i3iytfsDem( snu) lxomfciytomDr u il( texm(o3io1ap nmivta(fs2ra(rooo1ape  fetyt m eluvs;u0arxnirciadopD  n i (0seum(opoudap  lnvslsf 2uaur ;u0altomi3tlsfm ea( pnu) etnmo oodfpDrai i;t)t2xrim3oydome miei ()aDurur ;u0texnioetls m um( pnt4tetoxf3tadlpDrli i ( texoir3oodlptnmnes t arumu  ;u4tex mfeiyslmDuan o;(4arxoio ootoateai o;s)t2xoxo io4om nlnvsltfsrrr(r nu0alx ifetatls ea(mont) lenxociy1opDeluvi;s)trtm(mpoudope livs tfs2taumooo4altn feiasla rm(mo;()tlxnmrciatop rluvo;s t2to(r no4aptemiviat)a2uaxrooo1alt ioetysfsDeln sn(4tlerxr3oytoat an slt sexmim3iodll elfvs (f rtmx  no0tpeoif3iad s eluvp t)aexoifcoa1lmt ln o;s0 2to(r oudoltnlncs sf Drru  oo1aee iicilsls uluvp t)tetrxfciy1om r nvi t truoxr nu4lp   nviatfsDurxm ;o4opeoiociatlaDemnvpnu0texrxfcio1laDeliesl(0teumxr nodolt mivias) rraxr ou1tpenmieiasfm elumo u4arxoif3ta1oa eli o;s t2trio3ou4ome lics s sDrr(root4alt  ieiytfsDelnmp;()aetoxf ta1oat anesls0t2xr(m ou4llenmicilt sDua(roou0aleo fetatlaDeanmonu0tlxrirctadfp rlies;s sruoimpoo1lm nmncilt)arumum ;u1teeomieilsfa el(vo;t4tetrxr3oo1omte iei;s)seuoxopoo1op elnes s)a2um(rpou0tle mo3tydls2um( p;() rerxf3oytfpD aues;()t2tmxm3ou4ome  icslt)arraxro;t4tptoif3ilt mDrl( s;u0aetrxf3totlmteanvi t)setmiopiy1apen icsat)s2ua(  ou0opx moeiltfa elnvsnt)tltnif3totomD luvs;t0seur(o3ny4opt livsls  2ur(mo;u4olx  ieildfa2uaums () lxnircootfmtrai i;(0sexrxm no1omtelnvtls) Dumx  no4optniiciatfm2em( p t)arxoif ta1oateauvi t truoimpoodamen fet tfs2rmxrpno4tpxo ietlt sDelnvp;(0 reoirciydlm eaieo (  exrirpiu1om e fvi ()srrmu p;o4tee  fciasfm ua(vo u0 reomo3oy1oaDean sl(0sexm(r iodlmtelnes sfaDrru  ;t0oexo ocilsfs umu pnt0alxoifciotfa  lnes;() 2xoio3no4op  lict () 2tax pnu4tlxomoeiltfs rmnvo u0tlxomf oytlpDr n ils  etrxo ny1ale livs t srtruroot0aeeoio3tysfa elnms;u0 eeoxf iatlmD lnei s0trtoiopou1amee iesasfa2taxm nu4tetn iciytfs um( s;(0 eenir oytoa   neo;t s2xmiopny4apenlies (fsDuru onu1aeen ietlslmDra(vp t4aleomr3iy1fpD  nvs t trxoxr iydomtemfviltfsDumuroou0tltoifctadlm em(ms t)aetrxo tadopDrln ol( s2xmxm3nu4al   ivias aDrmumoou0teeomoetldfa emnvo t0teeoifcoadfpt  u slt0seur(m oy1lmen nct sf rtm(rono0alt moetld s ulu p u4aexomrcoydopDr n i;(  2xoio iu1oleemfcslt a2rm(rono0alxn octas s2ran s;t0artoio3oy1fp rlieo s t2urim ny1op   fvs t)aDuaxmo;t4aeeomoctlsfmDra( sn(0tlxoio oatlpt aivolt0srxo(o3oodaptn ivtat sDuru poo1tpt ifeiyd m2uanvo t) leoir tytfmtr uvi;s)s2xrxr3oy4ame  feta(f Dta(ronu0tet ifcildlm2em( o;t4arxomrciadlaDe ueols  2to(mpny1al nlncslsf rtm(r ;t4oetnmi3tydlm2ulumo;t4aexnir oatlp  livs;t0 2um(r3no4amt mneilt)srrrxmpnt0olt if3iytfa2emnvp;t0 lxomrctodlpDelnvo;s) 2xmxrpny1ope  ivi s)artmxrp;u1tpxnmieildla ea(mpnu)areomo iydfptelivils)trtmirpoudoptn neta(f Durx oou0optn ociad m ran pnt)tlxnxocootfpt aieilt0texoxo iydolte fvt s)aDta( ono0tlxo ocilt sDra( ont0areoxr3oadomD anvo t sexmio3ny4opeelici tfaDrrum ;o1aptomfeiytfm rlumpnu0aeerio3iadlpD livils0t2umir3nudllenmivsa(f Duau  no1oet ifciatla uanmpnt4texoxo3to1op   ieo t teuo(o3oudomtn iei t srumxm ot4olxoii3tytfmDel(monu)tetnmociodoptrauvi;s0seuo(r3ou4lleemnesl() 2tmumoou4apt mieiydlm2um(vo;t4tetoioctytfp e uvslt)t2umiopnu4ole lfeia(fa2ta(root4tlen fciad s umnvpn(0treoxr3oo1optrlu s;s0 eto(o3oydol nmnes t)s2tm(moot1alx ioetatla raumont) rxnio3totlm e uvs t)setr(m3oydlp nmics ( a2rr(rpoo0opeo fctytlm ua(mp u0trxoxociydlmDrlnvi s0 2uoiopoydal  mnci sfsDrrxrp;u0oleomicils a ua(vp;t4 lxrir tadoptrli i;s0sexm(r nudll nmfvtas)s2trumooo4apeo oeias sDum(ms;t0aexrioctadfa ranvs;s s2xr(r3oo4ol n feiltfsrumxm no4oexo feiyslm emump (4 etnmrcoa1fmte ivs ()seumxopiydapen feils  rra(rpou4olx moctas s2ul(ms;u4teenio3tydom e uvs ()srtoxr ny1optnlivil( sDtruro;t0tlen ieiys m2rm(vo (0 rtnxf3oo1lmtrluvslt0 exoxr3oy1opeelfvi s)aDua(mp;o0texnifetas aDua( p;() etnio3iydla r i i;t)sexrirpnudolenmncs ()arrru pno4oetnmociadfm ulnvont0 ltnir iytlp rlivil( srum(m3iudopeemicta(  Duru oou1oexo fctadfaDua(vont0aeerxf3tadlpDrli ol( srurxm3oydol nmivt ( a2rmum ;t1altniieiadfm2emn o t)trenxociadoatelieils texoir oy4ll nmictlt)aDtrxm no4tle ifeiytfa em(mp;t4texoxocoatlmte ueo t0 2tmim3iy4apt mics t) 2raxrpou1tpx  octatfm rl( o t)tltomo3oatlmDe n ol() 2urxopnydaltemnesl()s2trxr oo0aeeniiciat s2el(mp t0 rtnif tytopD auei t)srtmim nu4op nmicsa()sDrru  ;t0opt mfeiytfs rau s;t4aeeomf3oadfa r ivi s texo(rpoo1apt mfcslt aDtmur nt4oee  oeiaslm2el( o;() lenxo3oo1om rlu o ( texr(m3iudoptn nvi ( artmx oou0oex ifciys aDulu s;u)arxnxo3oadfpD  uvi t s2xmxr iu4al   fvi tfsDur(mont1apxnmf3tatfaDrl(vo (0 rtrir3ia1op   ueil( teum(m3iu1ape  fcsas s2rr(mo;o1tpe  i3iysfmDean s;u0tetoxo oy1fm  auvs;t0sexoxm3nodoltnlict tf rurxmoou1tptn ieiatfa2ua(ms;t)teerxrcoadfpteli o s  2xm(r oydlle mnvsas  2rau oot0apenmoeildfs2uln o;(4trtnif3tydlm eluesl()srxo(rpnu1lleemfeilt)aDrm(  ot4opxnif3tydlm ul(msnu4 rtnmocio1lpDelnvs s0seurxopiu1amt mnctlsfsDtaumoot4teeomf3ilsla2umu p;()arxomf3tadfmD lnvslt)seumimpoodaptelfet s) 2rm(mpnt1tpx moetad sDrm(vpnt0 lenmo3iy1fmD  ies;s)setm(rpiu4llen ivta(fsrtrx oou4ale  i3iysfsDuln o;(0 renmo ty1omDe ieslt)setrxrpnydlptelfei tf rtm(m oo0aet  oetadfm umnms t)aleoir3tadoaDr i i ()trtmxr3oudole  nci (f Duax oot4apxn fcils m ua( snu0 exrio3oydfpt lnvols0 exrim3iu1olt mnvi t arra( o;u4olxo ieiyd a2emnmpnu4 etomfctatom e ueo s)sexmio3ou1lleelivils  2ra(rp;t0tet  oeiasla rmnmo;(0areriocio1omt anei t0s2uoxo no1alte fcs sf 2raxmp;u0oetnmieiydlm ulnvsnt) rtrif3tadfpDrlnei;s)s2uo(opoo1om nmfctltfa2ur(  oo0teeomo3tatfsDrlnmon()alxoiociatfpt liesls  exoxm3iu4olen ieiat s2ta(mp;t1apen oeiytlaDra(vo (0 rxrmf oydlm   ieo t0 rtoir3oydom elneslt artrx onu1opxo icias m2rmn pn() ltrxr3io1fp rlu ol(0t2xrxm io4lptelnctl() rtmxro;t0optoifeiat a rluvp u) eerifcoadlatran o () 2uoim no4llt mnes sf rrrurpnu4oleoiocilslmDuln p;(4 ltriocta1lmt luvsl(0s2xr(m3oo4lmt  ivils  rtax p;u0oetnmietysla2rlnvp (4 etrmfctydfm rluei;t0s2tr(m3oy4alte iesas  Dra( oot4oet iictlsls2emn o;u4treoxf3iytoa ran il( trtm(rpio4op   ici ()arrax  oo4aetniieilt aDrmnvs;()teeoxrcto1oatelu s;t s2uoim no4ap nmnvsa(fsDtrxmo;t0alt ii3ias s ua( p;t) exoxf totopD  u ilt0 2uoxo3nu4al nmivsls a2tmump;u0tleo ieiadfa ua( o t0 lxrmo3tytoaDe nvo;t setr(o3oo4op nmfet t)a2ur(rpou0oeto fctydfa2ul( o;()tleomfctatlptean i;() rxmxmpiudllt lfeslt artrx o;o1apxo i3tlsfs2ea(vp;(0 lenxr3oa1faDrauvs;( s2tr(m oodome  ivi tfsDtrumpno1oltnioctas sDum( snu)texnir iotlate neils)texmim3oudlpeemivs sfsrtax ono1apx io3iadla2eanvs (0trtoirctydlptrlnvi;t0srxm(rpnudllenmici t  rta(  oo4openii3iydfs2rau on(0 lenxfcoydla eaues s)seuo(rpoo4amtnmfeia( s2rru oou4tpxoifciytlaDeau pnt4trtomo todlp r u ols0 exm(r no1ll nmncsas) 2uaxm ot4tex  fciytfm2uanvo;t4tleoxr3tatfpDeau s s)t2toxm iudlptn nes ( aDtax poo4tlt mfcilt m rlump;(0 ltrxf3tydoaDraivol() rxr(r io4lptn neilsfs2rr(rp;o0aptomi3iyslaDrluvs t4 eerxr3oo1laD  n il()t2trxo3nu4al  lnvils arum(m no4opxo ociltlmDumn s (0tetrif iytlp  li s s0srtr(o3ou1aleemnei (f 2tr(  ;o4oltomo3ilslm2rmuvs (4tlxrio iydlaDrlues;(0 2xoxo oo1llte nvi t  Dtmumont1ole mictydla uln snu)aexomf3to1lpDeli i ()sexmimpoydll elncil( s2taurp;t0tpxomo3taslaDrau p;u)aexoio ia1oatrli o t)teurxrpnydll nmieslt a2rmu  nt4opx mfeiysfa2ean s;t4aexrxr iytomD ai i t)trum(m3ou1olte fes s s2tmxm nt1apeo i3ilt a2rm( pnt)trtnxf iydoaDeluvo;s)s2uo(m3ny4am  micsa()aDrmxr ;o4oee  ieildfmDul(vonu0tltoir3iy1fmteluvo;t0 2xmxo3iu4apee fvi s srrmxm ;u4aex mi3iys a emu pn() eenio3oadfa r uvs;s trtrxm3oo4lmtnlnetas)srrmurpoo4apxnio3iadlsDum(vo (4 lxnmf oy1oa ranei;t0sexoxmpno4lpe  nvslsfsDtaxro;t4alt  oeilt s eluvp u)texnxf ootlatraueslt)sexoim nodll n nesls) rtaxmoot1tee ifctadfmDrlums u4aexrmociodomte nvs (  rxrim3ny4ameeliet (fs2tmxr ot1oetomoeiltfs2emnms (0aleniocta1lmD aivo;s trur(m no4llte nciatf 2urxmp;t0tetnmo3tydlaDua(mo;u) exrxf3ty1omD auvo t  euo(o iudalen fcs s s2rmu ooo1olxomociasfmDea(vsnt4 exrmr3totlp   n s;t s2umxr io4al elfvtas)arra(moou4aptnmiciasfa2rl(vo;t) lxrmo3oo1fpDelivi;t  2toiopoodal e net () Dtmxrp;o4oeto fciytls eln o t)texrir tadopDe ivi;s  rto(m3no1lmtelfcsat arua(r ot4tpxomociadfa umuvonu0 reoxrcto1fp   nes s t2tr(r3oudlp   nvslt  Drr(m ;o1tle mfeiat m2ul( o u) exnxf3ta1lmte n s t trxoim no4amt mfvt t)a2rmu oou0tptn o3iysfa2elu snu4 exrxf3ty1opDeln olt) exmxr3nodol elnvsasfsrtaxm ;u1apeomicils a umu p;t0arerif iotfpt  ivs t)srurio3oo4omtelnvtl()srrmuronu0tpt  i3iys m2rmu pn(0 rxoir3totlaDe nvsls srurxmpnodom nmnvt s  2uaxmpoo0teenifctltlaDuaums;()alxnifcia1fpDeau o s  2xo(rpnu4omtnmncta(  Dtau p;t4oltomf3iatlm uaumont4trtrif iatoa   ieols) exmiopiudlmtnmivsas srurum nt4tee  iciadlmDuaums t4artrmr iodfpD li s ()trxm(r nodome  fetatf rur(  ;t1alx mieiatfm2ua(mp u0tlenmr iytfa eluesls  rxm(opoydop  lncils)sDuaxrp;o0alen f3ilsfa eauvp u) ltoxocoa1lm ranvi;t  etoxm3nu4ol emivs s aDurxm ot1tpxomfctatfs2emu pn(0tltnmfcia1fpDr uvo t s2xrxrpiydll n nvslt)sDrm( ono0olxnmieiatls2emums t4tleomf3tatoaD  u olt t2umxmpoy4alen feiat sruaumo;u0apeoii3iltlm2ean on(4tetoif to1lp r i ilt0trurxopoy1omtnmivt ( s2ur(rp;t1tpxoifetatlm em( s u4tltrxf3oy1omD auvo () rxm(o oy4oltn feiat srtau o;o1aeeo o3iltlsDuluvsnu4tlerxo tatomteauvolt)t2xrxr3nudap   ivsas  Dtmuronu1olxo i3ildfm2umnvp;(0trxoxr3iodlpteluvo s)trtrxmpnudlpt mnct sf rumumo;t0apt mo3tydla2rlu pnu) ltnir iydfm rai s t  2xm(r3no1lmt lfct s)s2rmuronu0olx iieias a2rmnvo t0aetoxo3oy1lmDrlivs t)t2urim3nodlptemivtlt aDraxmono1tet  ictltfa2ran s t4tlxoxo3io1op  aues;t)teuo(m3ny1op e fvtat srrruroou0oexoifeiatfmDuaumsn(0arxrio3oodfa e nvslt s2uo(m3io4ll emnetlt aDurxmpoo0opxomo3tasfa umu s;u4 etnir oa1fpt  ies s srtmir3io1aptn nvsa( a2rrumpnt4altnif3iyt m2emnmp;u4 eerxf3oatlmD lu slt  ruoir3iy1olt liesl( a2trxrpoo4optnif3ilsla ulumo;t) lxrxo oodomDelies t) 2tr(r3oy1om nlivil(  Dtmur no1apxomictas m el(mp (0teeomo3oadfatraivo (0setoio io4olt livsl( srurx pno4tltn ictltlm rm(von(4 rtnmfcoo1lpDeli o;t0setoio nudoptelfesas)a2umuroot4opeomoctytls elu o;t0 etnmf iatlp   uvils)teumxmpoy4lm nmnci s)a2tmx  ;o4opxnifciytlaDemn sn()trtnmf oy1oat  u i ( t2toxrpnu1llenmfvt sf 2tmumo;o0apxnmo3tatla umnmo u) lermrcta1fmt auvs ()trumxo ou4ll n fctlsfarum(  oo0aetomi3ildlm rln snu4 exrmocoytopt  ues;t0sruo(mpio1omte icslt sDurumpou4tlxomietltfs2uluvs;t0 etnxr3oa1fm r u sls) eurir3iydlpt mnetls)arra( p;o0olt iictydls elumo;()aexnmfcio1lp   uvs (0 2xoio nu4ome mietl(fs2urxroou0tetniociad a umump;u4tlerxf ta1lmDeaues;s0tetr(r3iydal   fvsat  Dra(m nt4aexn ociysls2rl(mp u)alerxo oatfm eauvslt texmxm3nu4opee fes sf Dur(roou0apxnioetat s ul( o u)tleoxf oydlaDr n s s0sexm(mpny4amt mieiat)s2rmu pnu4tle  i3ilt a2em(vpnu4tlxomr3iotfa e n sls  euoiopoydlp e fvilsf 2raumpou4apeomfciyt s el(vonu)altrir iotlmDe uvs s0 rxoimpoo4lpe mnci (f Duax  no0tptnmf3ild m2eanmp () exrmf todla r ueslt0 2xoir iudom n fct (f 2ta(mono1olxniiciysls2rm(mpn(0areomr iytfm e i o;t  rxo(rpiydol   ictls)arra(mooo4teeomfeild a2umu on()alxnif ta1lp elu i t)setmxo oo1lpeemnct (f 2tm(rpnu0altnio3ildlm ra(ms;(4areoio ty1oateaivs s) rurimpio4amen ncs ()srta(mont1oltn f3tadls emu o;u4tetnxf ta1laDeai o;s t2xrxrpnu1op  lfctltf 2tm(  no1apx  oeiyt a2rl( o u0aeerxf ta1laD  uvo;t  etmxr ny1ole mics t sDtauront0ole mieiys aDeanvo;t0tetoioctotlat au s t0s2uoxo no4lp emicsa( arrmu pou4tlt  fctysfaDelnmont)aetrxf3ootlp e n i;t) rtm(o3iy4oleemivsasf rtmu pnu1alen fcilt mDum(vp t) eermo3totoptrliei;s0srtoxmpnydlptnlivtlsfsDua(ro;o0tex if3iydls rln s t4tlxnio3ta1omD aneols)texm(opny4lmt  nvi (f 2tmxmpnu0aleomictatfm rlu s;(4aexnxfciydlp elnvo s0trumir oodapenmivta( arraum ot4tee  fciadlaDelnmo t)tetrxfciotfate n sl()trumxopio4lpt livilsf rtau o;u0oetomfciytlmDran p t)aexoxr3tydopte nvsls  2tm(r oudopee iesa(farum(roou0tltn i3iaslsDeanmp u4alxnmo iy1lpt aieol(  etrirpiu1llenmnvsl(  rtr( p;u0oee  o3tysfm ul( snu0alermfctadlatran sl(0trxrim3io4optelfes (fsDuaxront1olx ifetydfmDul( p () ltrmf iadlm e u o;t0teuoxm oudlpt  fetl(  2rmx pot4tltoifeiyt a el(vo;u4tltrir3ootfmD  u il(0seuo(mpou1altelietlt sDtruro;u4alx  ictytfsDra(mo;t0 rxnxo3tytopteln o s trumxm iu4al nmies s artax  ;t1opto f3tatfmDra( sn(4alxrxrciotlmte uvs;s srxo(r3nodlltnmnct tfaruaxr ;o0tpt moeiasfm2rlu s u) eenxf3oytfmDelnei;t0 exm(opiy1am  lnvsl( sDumxr nu0aleomfctldls2rmnmp;t)aeerifciadfm eau o t  exmxopio4lpeelfei t  ruau oou0olenmf3iltfm2ulnvo t4tltnxr3iy1om eln ils0s2xoio oy4op  mici t aDtru  ;u4olx if3iyd aDum( o;u0 exomr tatfpt ln i;( tetmir oudaltnlivt tfa2uauront1tex moetadfm2emnvo;t0teeomocoytomDelivslt  2umim nu1ll   fesat)aDua(rp;t4oex mo3iatla ea(vo u0aexrio tytfm   n i;s0t2ur(rpio1ope lies ( aDra( o;o1oetomfeilslm rlnms;()altomr oadfm r u o (0s2tmim ny4amtelncs (  Drrxmp;o0olen o3ias a2um(vs (4tltnxo iadop eai ils0sexo(mpoo4opt  ictasf rrm(  no0ape iociydfa2ran snu0trtnxr oodfm eau ils) 2xmxm oo4om e icia(fartr(rpou4apx miciatls rlu p;u0 renir oadlp   u ol(0t2ur(m3oudamt  fetlt)s2tm(rpot1tlenifciadlm uanvs;t4 renmfcia1latrlnes;(0 rtmirpnu4ameemfvtasf 2rr(ront4aexo f3tld mDemnmpnt0trtnxr iodfmtelnvols)srxmim iy1lm nlivtas  2uaur ou4oex io3tld sDeluvs t0trenxo3iotfmt  uvo;t) 2xmir iudolenlivta( sDta(r oo1optomfciyslsDumnms;(4 rxrircoatlaD luvi;t  2trimpiodll e nvslt)aDtm(rooo0tpto fetltlm2ea(mo (4 rermo oodlp elnvo (0srxmir3nudapt mict s)arrrx p;t4tpx iieiyslmDua(vs t)aetrif3ootfp eau o t0tetrir3oy1lp n ncslt)artaxro;o0tex mf3ilslm elumsnu0texomr ta1laD  neilt0 rxmxm nu1amtnlfvs (fartax ono1aeeoii3ildls elu snu)tetrmoctodopD lu s;t seuoxm3oo4lle lncsl( sDur(mpoo0aexo f3iad aDuanmo u4arerir iytlatelnei;(0s2uoiopny4omtemfci t)arur(rpnu0oexn feildfaDeanvp t0artniocoatoaDe ieo t0s2xmxo ou1llt lnct sfaruaumont4aetoioctyd sDrmnmpnt) rxnmf oodfpDelneolt)texmxr no1op elncilt a2umurpot1tltnmo3ilsla2eluvo t)aexnxfctodlm  livsls0t2uoio3nu4lmte ictlsfa2raurpno1tltomo3tldla rlnmo;u4tlerxrcoytfpDrau o;s t2xrxo3iodlm e nct t) Dtax pou1oee  fctysfa2uanvsn() exomfcoydopDelies s0 eurir3oudoltnlfvtl( aDtau  ou0opto oeiadfm2ul(mo t)alxomo3ia1fm raues ()s2xrxr3oudlpeelicils)srtauront4ape  fctls a eau s;t0teeomo iytomt aivs;t0 eto(opio1am   fvils  Dtr(  ;u1tpt mfeiasfmDra(vs t0aetrxr3iatom e uvs;s)t2xoxo3oo4op emictasfaDtmu p;u0tlt ifeiatlsDemn s;t0 eeoirciotop   ueolt0sruo(opoydolee fvs (fartrum no0alt micils s eaumsnu0tltrmf oy1op r ivs;(0 rxmxo3oy1ol n ieilt s2tmxronu0oex  i3tltlmDemuvo;(0trxrxf oodlatr nvi;s trxmxmpiu4lp nliesls  2tm( ooo0aptnii3tys sDrl( ont)tltoxf ootom  lu slt  exrio3oo1oltnmiet ( aruru ont1alt ifciasla eluvp u4tetnmo3oodoatr ivi ()seuoir3no1llenmfci sfa2tr(  nt4tlx ifciltfsDrmnvp;t4 eeoxrciy1lpteaivs;s  rxmxr3iydopee ivi s) ruau p;t0oeen iciaslaDemn s;t4alenxf ta1lmt  uvol(0srtoio iy1oltelfcta( sDua(rpnt1optnmoetys aDeaums ()arxniocty1laDeli o s)s2uoxo oudll   nciat)aDrmx  ;t4oetnioeiydla umnvp (0alxnxr3io1omDe nvs ( srxr(opnu1aptemnci ( sDuax pou1tlto ieiadla rmn p t0 etrxrcta1lptelnvs;s0teuoim ou4aptemnvtl(f rrm(rp;u1tpe mfetyt s2uau pnt4artrxrcoadopDr i slt t2xrxm3oodoptelnei (fa2tmu o;u1oex ioetasfs2raumonu)teerio tytfp  ln olt0tetmim oydalen nei tf 2rr(mpoo1texo ieiyslm ua(vs t0arxnmo3todomD lu ils  rumxo nudlltemfvsl(f rtr( pnt0tle io3iadfm2rmnvp t)alxnxo tytfpD aiei;s s2toir iydlmtemietat artaumpnt1olx ioeiyt m umn p;t0treoxf3iytlpDrli s s0texmio3ou1op elivia(fs2urxmoou1tpxn o3iadfm2ulnmo;t0 exrir3ta1fp e nvols) rumxmpiy1apeemfet t)aDra(rp;u1optn i3iytfmDrlums (0 exrxfciatlmDeaneo;s0srum(mpiy1op n nvias aDrr(  ;t0opeoioeilsfs2rmumo (4 lenio oydfm   ueo (0sruoxr3ny1lptn ics t) 2umurooo0opxniieiatfsDelu s t0altrmf oydfm r nvo;t)trtoxr nydomtnmiciasfsDtmurono1ale mf3tldlm rmu p;(0arermocio1opte u o;s0 exr(mpiydap n fcsas)s2rmum ou1oeenmoeiltfa2elnmp t4trtrio iy1fa   ieol(  exrirpno1ap elfeia()a2rrx  nu4aet  f3tldfa eaumo u4alenxocty1fpDe nvo;(0s2uoio3nu1al elivsls)sDra(m nu4teto ieiatls umu pnt)arxoxf3oy1opD lnei s t2urxopiudom n nvsas a2rmur ;u4oetomfeiytfs2ea( pnt)tetnio3oydfmte n i;t)setr(o3oy4lmte iet (farta(  nt1optomfeiysfsDum( s;t4trxrmo io1omtran s;s0sexrim3oy1op emnesa(fsDrmxr ;o1tlenmfctls sDelnmonu)arxrxocto1oa  liei;s  2uoxrpno4ol   ncs t sDua(m ou1tetoii3tyt sDua(vpnu4arxnif3tadlmt  ieo ( texoim iodal emicsls  Durxmooo1oex  fciydla2emumsnu0 rtrmo3ta1omt lneo (0 2umxm3nudalt  fvtlt  Duaur ;u1alxoii3iydfm elnmsnu0 lxrmo oadopt ai i s)s2toio3iodameemfet s sDrmu pnt4tpxnmociytfm2uaump;() exoxfciytoa e n s;t) 2tmxr3iy1oltelfci sfsrra(rpno1oltn ietasla2um( pnt) reoxrciatlpt  u ols setmirpno1lpe mnct tfa2uaur ot0oexoii3iydfmDumnmp;t4arenifcoadopDrauvilt t2urirpoy4apeelies ()aruaurooo0tleoif3ilsfsDuanms (0texoxfciy1lmtr n s;s)srxoxo3oydamtelics sf Drmxrp;t4altoiictldfa rlu o u)alxrmrcty1la   nvi;t0seurirpoo1om emfvsat)sDraxrp;t4aeenmo3iltfs2ulnvonu0trxoxr ta1lm  aieo s texmim oydlme lfctl()s2tm( pnt4oexnioeilsfm2uluvs;()tleoio ia1fm eai ils  2urxmpio1oltnlnctasfsrra( ont4opto oeiyt m ulumpnu0aexrio iadopD lnvs;t srxm(o3ou4ale lfvsas) rtmx pot1aexniiciaslsDulnvo t0teeoircoa1om eln i;s  2xrio3oy1lpenmieilsf rtaurpnt0teto o3iltfaDum( p;u) ltrxfcio1op eaieils setoxr ny4lp n fei tfarum(moou1texn o3tatfmDul( s;t0alxomociy1lm rlnvilt srurim3iy1om emici t) Dtrxmoou0tpenmieiyt m uaums (0teenirctytfate nvols0 exo(rpny1omtelfcias arta(rpoo1aptnmfetadla um(msnt0trxomo iadla   uvi;s)srxmimpnudol elfvilt) Duau onu4tpx  ociydfm2ulnmo t4 reoio tytlaDelu s;t0 2ur(o oy4lp e nci tfsDuaxro;u0oetnifctat mDemuvont0tltrio todfatr i s t0sexoxm iy1lmt  nvt ()aDuru  nt1tee ifeiadlsDum(vs;u4 ltnmocoytoa rlivs ()teur(mpno4om nlnes () 2rru pno0tptn fctls m ulump t)tetnifcty1la  lnvs (  rxoxrpno1ol nlfvs sfaDuru p;o0tee mfeiytlaDrlu onu) ltoxo3todfat livilt seurir ny4ll   fvias  Drauronu1tetn ieilsfm2eanvp (4tlerio iodoaDrlivsls0t2trio3no1lpt mictatfs2uax o;t4aee if3iatfmDrm(monu0aexnxf oytlmD livilt0setr(opiu4am elfvi t  2ua(ro;t4aptn ociysla2umnmp;()aexomf3oy1lmDeluvs;t trur(o ny4lp nliesa(f 2urx  nu4oex  oeiysfa2raump;u4aeerir to1lp e nes t)tetoio3no1olenlneilt)srta( pou4apeoii3tlslmDean o (0arxoxf3oadlaD luvi;s0 2uo(rpoy1lltnmieia()aDrmxmont0tet moeiyd sDumums ()altomo oa1lmDelueolt) 2tmio nydap elfci ()sDrax  no0apeomoeiydfm2umuvo t4tlenioctadla eai i s  2uoirpiy1lm elfci (f rum(mpnu4openiociltlm eluvp;u0trtrxrcoytoa rlnvo s0 2xoxmpnydlmt lfct () 2tm(  ;u4aetomictyt a2eanmont4 rtnmf tytlmt  ivo;t0 euo(m io4op e nesa() rua(  ou0apxo i3tatlm2rm(vo;() exrxf3oadfmD ln ols trxmxmpno1lp   ncsls a2truro;t0aeen ictldlaDumu s t0 ltrmf3ia1omDrlnes;t  euo(opiy4om  liei s sDraxro;t4altomfeiytlaDemnmon(0 etrmfctytlmtr uei t0tetmxr3ny1omt lfet () rum( pnu4tpto o3iad m2ulu s;(4aeermf tatlmt  neol( t2umirpio4lm n fvsa()srraxrpnu1aetnio3iltlsDuauvpnt)tleoif oo1oa eauvi;s)t2uo(r oydomeemfcs sf 2tmu  ;o0aptomf3tatfsDrmn o t4altnmo todfmte iei s) ruoio io1olt licil(f Dtmxr ;u4tleomoeiadls ra(ms u)tlenxfcia1fptr u s;s)srtmio no4opeemictltfarurxmpot1oltnmo3tltla umn p u0texrir iytfm e neo t setmxopoydalenlnetl()arta( o;t4oeeoio3iltla elnmo;t0 lxrmo3ta1lm   uvo t) eum(r ou4am nmies () Dtm(rp;t1oexniietat s ul(vo;u)alxoxf3oodomDe ivi s sruoxmpoo1lp  livtl( srrmur ot4ole  ocildfs2rl(mp;u0 etoxfciydfmt auvolt  rxoimpnu1olenmnvi s a2ra(r ot0altn ietydla2ua(mpnu)tlenio3ootoa e nvi s0s2ur(o3nu4lm nmfcsls  rtm(rpnu4alx io3iltfm eauvo u) eeomr iy1oa e uvi;()s2to(rpoy4ame lfvil(fa2rmurp;t0olxomieiatlm uau s (4 eerir3iotfmD aues s0 rurim oo4lp  mivs tf rra(mp;u0aptniietatfsDumnms u)alxrxr tadom eaueil( sexmir ny4ome miviatf 2rrx ono0tlx mf3ias a2ea( o;(0 rtrio3iatfpDe ivs;s trxoxrpoydam e nes ()a2rmxm ;t1aet mi3iys a2eluvs;u) leoioctadopt  ieo t0trxmir3nydllt lnvias)aDrmxmpnt4oetoif3iaslm ua(vo (0 eermo3iydlpte i s;s)s2tmxo ou4aleemnetas)srrmxr ;o0tpt iiciysls2eauvs t4 ltrmr iatlpDr u o (0srxrir3no1op emfvt t artr( o;t4aptniictldfa rm( p;() rtrir oodfpDraneo;s srtmim3io1omenmics (fsrtaxm ;u0alxnif3iyd m2ea(ms u) eeomr3oatla  luvsls0sruo(r3oodlptemnvsas)aDururo;u0tpe iocildfaDel( p;u4aetnxr tadopD  uvslt s2tm(r3iu4lp  lfet t artaxr ;o4ale iictytfa ra( p;u)aexrxf tatoa eauvs;(0srxriopnodapen nes ( arraxr ;t4tpeomociytfa uanvp;t0 eeoxfcio1fmt auvil(0 ruoxo oo1openmfesatfsrumxmpoo4opeoiociltfm2rmnmp;u)artoxr todlm rluvslt0trumim3oo1oltelietlt  Duaur nt4olt  f3iyd m2rmn s;t)aetoxociatfpD auvolt srxo(rpiudole mneiatfarrmxm ;u0texnio3iadlm uluvp (4trtnmo oy1faDe i i;s0sexoio iodap nlnetasfs2uaur oo4tee mi3iydlmDeauvp;u0 lxnirctydopD luvs ( srum(rpno4op  lnvsl(faDtrumpou0aee ioeiatlmDum(vp u0tltomf totlpDe u s;s)t2trim3iy4op n icsls)s2tr(m ot4tlt mfctadlsDelnms (0trxrmr3iydomtrln o s t2xrxr3nudameemictltf ruaurpot1olxnifciasfm ua( p ()tlenio oa1la  aieo t0 exoio3oudomte fci s)sDrmxm ot4aptniiciyt a raumo (0aexrxr3oatlatelu s;( seumir3nu1op elneslt  2tr( p;o0tpxn
\ No newline at end of file
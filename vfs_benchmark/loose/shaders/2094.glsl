@@ -0,0 +1 @@
+i ilt)trum(m3oodam nmivt s sDtm(m nu1aee  o3tydfaDem(mo;t)trtnir oatfpDrlnes t)s2xr(o3nudlmtelfcsltf Dur(monu4olxnmfciadfaDemnmsnt0tetrxf oadlmD  uei;t)teuo(o ou1ope lnci () 2tm(m ;u1aex  i3iltls2rlu p;t4tlxnmo to1lat au o;(0 rum(rpiu4op  mfesl( srtr(mo;u0ape if3iltlm eau p (0aeeoxr3to1omt aies;s)setm(rpnudal elnvt sfsrrrxr ;o4aexomieils mDelu p;t4trenmfciodlatr n ils  exoir3iodape  ies t) 2uaxm ;u1opx  oetls a rmumo;u4 rxomfctodoatelieils setmxo nydoptelncilt) 2taxm ot4apxoifciydls rluvo u0alenif3to1om  lneo;s0 etmxmpiudlpt lnci ()srtrxrpot4opxomf3tlt mDrlnvpnt0arxomrctydfpt luvi t teuo(mpnu1apeemivtl(farrax  ;u0tpxnmf3iasfmDumnvsnu)alxomrciotoat aivi t0t2uoxopou1llte feias  2ua(  nu4oetn oeiydlaDrau p t0aexoxfcoa1fate ivo t0 2ur(opnudlme mfviat) 2umxmooo4tpe  ieiatfsDuan s;()trxomrciodoaDran i ()srtrimpiydol n nesas artmu pno4alto f3iatfs el(vo t0trxrir oatfpDe u o;t)s2xrio ny4oltnlnctltfs2tr(  nu4apt ii3ild s2elnvs u4alxnmr io1omte i il() exmxrpnodop  lfcsas) 2raur ot4apx  fctydfs rlu s;u0texnxr3ta1omDraivo;t0 rtm(mpou4lltemfeta(  2rmxr nu4oleoifctadlm rluvpnt) rxoif oytomDrliei t0s2tm(opno4lmee ivilt)aDumu pnt1olxoio3tls m2uauvs;t4tltrmo3tydlm  livil()s2xmxo3iu4om  livi s s2trum ;o1aeenifciyslm2em( p;u0alermo3iadla  aueo;(0 etr(mpnu1om  lnvs (  rum(  oo4tpenmo3tyslsDrlnmo;()alxoio iytomDr nvils) 2xoim3nodlle livils s2trur ;t1altnmiciasla ran o;(4tleomfcoadomt aies ( s2xmimpny4ll  mneias sDur( pou1altniieildfmDrmums;u4 exrxf3oydlmt  uvol(0 rxm(o3iu1omt lfesas)sDumxm ;t4aexnif3iad m elnms t0aleoxoctatomtelivi;s0 rur(mpoo1lpee ivtl(fs2rmu  oo0oexomoeiysfm rau sn()altrifctytomDe ivs;t trxmio oy4lp nmfes ()srurump;o1alenmfeilslsDrlump t4trxrxr3ootlm elivs () rtmxm oy4omt  nesa( a2taxmpnu4opxnioeiltls2ul(mo;u) rxoircoy1faDrlnvolt  exriopou1oleelfeiasf Dtm(m nu0apxoioeiys s umn p (0trxrmo3oytlp elnes s trxm(m ny1optnliviat)a2tm(r ot4aleo fctltfa uaumo (4aexrmocoytlmD lueslt) etmxopoodaptnmfcslt  rtaur nt4opxo f3tys m2eanmont4 rtnir3ta1op  aieol( tetrir3ou1op   iciasfarumur oo4tlx iiciyt aDrau sn(0 rtriocoo1fmD  iei;s0texr(m iy4amee ivt () 2tmu  ;t4apen iciasla uau p;u4 ltrmo3iydlpDr uei;(  2trxrpnydolt lnct sf 2rrumpno4teen fctyslaDelnvpnt4tlxrxo3ia1lp eli s s0setr(r no1altnmnesa()srrru p;t0tetnif3tldlm ea(mp (4artnxf3iadlpD aivo;s  2to(rpoy1olee fvsas aDur( ont0tpx iiciltlsDeauvs (4arxoxo3totfm r ivo s)teuoir3no4om   ies t)arrax ont1oex mi3ild m2rl(mo t0 rxnio3ty1fmDeli slt) exrim oodole mici (f ruaxrpou4tptnmociadlsDrln o u)alxnmo3oadop r u ol(0trtmir3oo1lltn icilt s2um(mono0tpx ifctlt a ra( ont0 exrxo oa1fa ran i;( trtrirpiodomenlicia(  2raurono4tlxomi3iytlaDrau s (0 etoifciotlmtelu i;t  2umxrpno4ome mnvils aDurxront4tlenmoetldfs2el(vo;u4 rtrxoctytfm eln o t srxrxr iudop  mnvils)a2rax pnt0apt ioetas a2ranvpnt0tlxoxr3oa1fmDrauvs s0sexoim oudlmtnlneil()aDuau onu0olt mi3tysfm elnms;(0texrxo oydfm r iei (0 ruo(o3ou1lp  lnviasfaDua(  nu0openifetldfaDemnmont) etrxocty1late n i;(0s2uoxmpiu4lmenlfcsl(  Drrx  ;t4ope mf3ils m rlnvont4aleomr iytoa elnvi ()teumxr3iy4ole lieil()a2uax pou0tleomietysfsDemn s u)aeenxf oatoaD livi;( t2umio3iydalte ivtas)aDta(rpot4alt mfciytla2rlnmp ()tlenmo ta1oateauvi;s)seurim3iu1lleemnvtlsfaDta(mont0tet moeilslsDuau s;t0arxnio iy1lp  lnvilt0 exrim3ny1apeelicias)a2tax ono1aet  o3ilt s ran s;t0aetoifcootfat lneil(  ruoirpiudlpt lfvsat)s2ua(rp;u0apxo ieiat a2rlnvp;() eenxo3tatfm  anvi s  2xmir3ny1am   ivs (  rua(mo;t1opeomi3iysfs ea( p (4tlxoxo io1laDraneo;s srur(r ou1opeelnct tfsrrmurpno0tpxnmoetlsfa2ul(vpnt0alermo ty1la  ai o;()seumxmpou1oltn nvtatfarrm( ono4apt  feils mDemu snu)texomo3iytlpt ln s ()srtoir3nodlp elfvi (  rurum ;o4tpx if3tlt s em( p () rxrmr iy1lmDelu i t  rurio3iydap  lietls)srua(m ot4tee mfeiatlaDulnms ()tetoxr oodopt luvo;() exoxopiy1ap e icsl() 2umx  ;o1aeeoii3iat a rm(ms t)alxnxfciodlmDeaieols0 rxm(r3nodopen ivils) 2umxmo;t4tltomoctas a2umu pn(4aeeoxf3oytfat lueolt) 2xrimpnu1lp   nctlsfs2rmuronu1oeeo i3tydla2uanvonu)trtoircto1fpt  uvo s)sexmxo ny4ameemnesasf rtaxrp;u4oet mo3iydfaDem(vs;() lxrir3oydomDrlnvi s0setoir nudop  lneils s2ta(r no4tpeoii3iadfm2rau pnu4 exnmfcty1lm rluesl(0t2tmxo3nydll   nci sfsDtmumo;o1aleoiiciatfm2emn p (0 rtrirctatoaD an ol(0 eur(m iy4am   netl(f Dur(root0opeo fctldfm rau snu) rxomfcty1op   ueils0t2umxopoydlptnmnvtls artaxm nu1altomfcildlm rmumont0 eenxfciadlptr n i t0t2trir3ny4altelnei s) 2umumoou0tpx moeiydfmDrmuvp u0arxnxfctadoa e ueo;t)s2ur(r no4openlivsltf 2urum ;t0oltomoctad mDrm(mpnu4 rxrmrcootlmDelnvils0srurio3oo1omt livilsf 2trxrp;t0aetnmieiysfs em(vo;()altrio ta1fatr nvs;s0srtmxrpny1lleemfeta( srur(ronu0oexoio3iyd m2ulnvsnt) eenxo oa1lmt livs;t)teumxmpnudom elict (fsDumurooo4optomi3iatfs2ean s;u)alxrmf3oatlpDrauvslt)texoxm3oy4omt lnct (fa2tmxmpot1teen ietasfm2ulnmp;(0 ltrir3oo1latr i ilt0trxr(r3nydamee ict t  Drmxro;u4tlxoioetaslm2um( p;u)texomocoa1lmtelu ols0s2um(opio1olenmiesat  rumxmoou0aetnmfetyt sDrmnvp;(4 rermrcoo1lpDelueo;(  rxm(rpio4olt mietasfsrrrxr ;o0apxnmi3ilsfmDuan p t0aeerifctytoate ueo;t)srxoirpnu1llenmivia(  2tm( p;t1oee mietat m2eauvo;u)tetnxo io1faD aies;t)teumxopiu4ol   nviltfaDtm(  oo0tlt  ictltfs ra( pnu0artnmr3iodfa elu o ( teuoxr3iudlmt lict (f Dua(  ot4apeoiietltls2eanvs;u)alenxfcoadoaDrauvi;( srxriopoo1altemici ( srurxr no0tpxn ociasfmDem( snu0tetnir3oodfptrauvo t0setrxo ny4ol e nci s) 2taxmoot0optoifetysfa2rm(ms;(4alxrxf3ty1oa   u olt tetrim3oydlpe micslt  2ua(roou4tpenifctyt sDem( o;t4 lerircoo1fmDrlivilt0 exmim3io1omenlivt (fsDtruro;o1opxn ietyslsDeanvsn(4arxrxrctatlmt  u i;s0trtr(mpnodope mictl()srurx o;o4tleomiciadlm ul(mpn(4trtoxf3ootomD anvilt0 eur(m3oydoltn nei t aDrmx ont4aptnmoctytfm2em(vo u) exnif3iadfat  nvi;t0srtoirpiy1oltnlfcs t  rtaxmpou0oltniieiasfm2rmnvsnt4tlxoircto1optr n i;() eumxo oo4apt livsa( srtrxm ;o0tpto f3iyt m2em( p;u4artniocoodfpD lu o;t)srxm(m ou4alee nctl(f Dtmxrp;u1opxomietydlmDeln o;(0 rermfctatla eai o;s0s2xm(opnu1ll  mfviat)aDtax oou4tpeoio3iyd a2el(mo t0aeeoxr3oa1fa r uvol(0 etr(r3iu4olen fctat) Dtmur no0opt  f3iadlm2uanvont4aexnmf iy1fpteauvolt0t2xmiopny1ol n neiatfsDtaxm oo4oltn f3tatfa2rmn o;u0tltnxo tatlpDraivsls0 2umirpiudomtn nctat srumu  nt4olx moeiytfm2umn pnu)aetrmo3oytlp e i i;t0teto(m iy1llt  iciasfs2rrumpno4apt ii3tatfa2rl(mp (0 lenif3iodfaDe neolt0 2toxr3no1oltemivsasfs2um(rpnt4opxoiictydlsDul( pn() rxoxrctadopD lnei s)t2umxr nodlptnlfeilt) Dua(  oo1opxnioctytls eaumpn(4alxnxfcia1oa  au s s) etoimpny1aleemfvsltfsDrax pou4tpxn ictld s2uanvo;t0tetrif ty1fm rlueo t)t2tmxopiy4op elfci (fsrur(moot0alxomf3tld mDelump t0altrif3iatlpt  uvil( texrxo oy1llenmnetl( s2trur ;t1oleomiciytfaDranms;()teeoxociodfmtran i;t) 2umim3oudale  icsltfa2ta(r ou1aexomfeiyslmDemu s;()trenmf to1fpte nvo;() 2uoim ny1lmtnlnetatfs2urx  ot0aet mfcildfa2um( s u4tleoxfctatla rlu ilt t2xo(r3ny4open fvta()sDurxronu4aexnio3ildfa2ulnvs;u)tltoxo iadlmD  ueo;t teumim3ou1lp n ict t)a2uru pou1apeo o3ildfsDrlu sn()aexnxr iatlmD lu ols)teuoxr3oydaltn icilt sDum( o;o1aee ioeiltfm eanmpnt4aexrif iy1fp  livs;(0trtrio nu4lm nlfcta(faDurxroot0alxomi3ildfa ul(vp t4tlxomr3oodfp  lu i;()sexo(r3oydomt  neilt) Dum(r ;t4opxo ociat sDea( s;u0 rxrxo3iatla  lues t0 2toim3ny1lltnmncsat srrr(m ;t4ole  feiatlaDel(vsnu)aetnmf oy1omDranvo;t teurxm3iodlleemfeilsf 2rmxrpot4altoio3ild aDuan p t0artoxocoytfmteaueo (0teurxo3oo1olenmivt t aDumxr ;t4apxnmociysfa um(vp;u)tetoxr3iatlp eliei t  exo(r3oy4apt lneiatf rrmxmp;u1aptoifeiat s2umnvp;u0tlxoxf oydomD  u sls)trur(o3oodaptnlfvsl()aDrruroot0tlenmf3ilsfaDul(ms t4 exnio3oa1fpDeauvo;() etmxo iu4lptelneias)a2rr(rp;u4oetnmf3ilt sDemu ont4trxrxoctodfate ivo;s0 rto(rpoo4am   ies s sruaum oo4aet  ieildfsDrmn p u)aeenmrcia1lmDrliei;s0trtrio no1op nmnct ( arurur ;t0aleoifetltlm2rm(vs t0tlermf oydlpt auvils)t2umio nu1llee fvi (  2rrurpoo0tltnmi3ildlsDrlnms u4alenio3iydopD an o ( t2trxr nu1omtemfctl() Dtr(  ;t1tee ifcildla2rlumont)arxniociatlaDr ueo t s2uoimpio1ll   ivtl() Dtmxr ;o4apenmictls s2ra(vo ()teeoio oadlpDrlnei ()s2xm(m3nu4ap n nvtlsf rrrx  oo1tpenioeiysfs uauvpn(4trxnxfcoatomD  ueilt trxmir nu4olt livtls)arra( p;o4oeen oeild m2ra(vs;t) etrxr oydom  an o;s0teumxopnodalen ies s)s2ra(  nu4tle  feilt a2rmnvp u0 rtomr3totopD  nei;s)seto(m3nodlptnmnetatf 2raumo;t0aetomiciasfaDeauvs;t4teerircoatfptr i i;s0s2trxr iy1omtnlfcs t  rrmu poo1opxomieiyd mDea(mo (4texoio3ta1la  ln i s teumxo iu1am   ivtas)aDtaxmpoo4olenmictld m rmumo ()arenxo3oo1lm eli o (0 2xmir nu4omeelivs t)arraumpno1opxomieiatfmDrauvp (4artnxfciy1lmtr uvol() rxo(o3ny4alt livsl() rtru pno0alt  icildfaDulnmp;(0 renmrcto1fmDr ivils0 2xriopiudam e netls)s2urx p;o1olxn f3iysfs ua( o (4tlxrmf oytfpDrliei t trxo(opiu1lmte feia( arurxrpnt4openmf3taslaDrm( snu0tltrxo3todomteli olt0 2to(r3io1lm n fcsls)s2tru pou1oleoifetydlm2elnvsnu4texnxoctydfp eaivs t t2xm(rpoo1lltnlies t)srrru  ou1alx mfciat s2rau sn()aetrmr3iydfa  lieolt0 rurimpoudam   fetas)a2ur(rpnu0aexnifeiltla el(vp;u0teerio3iytfmt an o;s)tetr(m3iudomt mivtls aruaxmpnu1alto i3iltfaDuln p t0trxnio3to1fpDelu o;t)t2tmimpoydamt lfetlt  Drmur ot4tetoio3iasfa2em(mp t)altomr3ootfmDrlnvo;t t2trxr3oy4amt mfvi t) Dtaumpot1teeo feilslm2uanvpnt0alxnxocoadfat  nvols0 euoxo ou1lp  lfcia()aDrruro;u1optn icias mDum(mo;()alxrxo oo1lmD lnei s s2xm(o3ny1aptnlfvt s  2tmx o;t4alxnii3iadls2emu o u)aeeoxo ootlm  aues;(0 exr(o3iy1apenlnctas)arum(  ;u0tex if3iltls rlums t0trtomr ootfaDeli o;t)texoimpnodllenlfcilsfa2ua(mp;o1aetnmf3tld s2ra(vp (4 rermr3iotomD lnvolt t2toim iydlpeelnesat  Drrxr ;o0alenmf3iatfs2rln o;(4aetomr3tatla e ieslt) rumxo oodolenmfei s)a2um( ono0olto o3taslm emums;u) reoio tydlmteluvslt0s2uoxrpiudol emnci (faDtm(mpno0apx  f3iyd aDulnvp;u4trxoif tatlaD li s;( t2tmimpoo4ll emietl(  2taurono0apen o3iatla rmnvp;(0 rxrxf oatfmD  i s;t0t2xm(r iodolte iei (fa2uaxm nt0ale mieiadfm2ra( onu0 ltoirciydlmt ln il(0 eurxopnydalen nesas)s2rmur ou0tptoiieiyd m2ul( s;u0arxrmrcoodla rln ol( trto(m no1omtelfvslt sDrrxrp;t0tex mociyt m umuvp;u4trxomrciatoat ai i;s0srxmxo3iodapenmfvi sfa2umxro;u0tex mfeiydfaDulnvpnt) rtomocoydom e nei s) exoio ny1ome lics t)aDrr(r ;u4opt ioeildlm2em( p;(0 leoio3iotfm rlivslt0s2triopoy4oleelfcils)s2uaum ou4olt  fctldlmDemn s t0aetnif tadfp r n olt0 2xrim3iy4lmen fct t)arumu oou0aexnioeiasls uln o u4arenxrcoydoateli s ( setrimpio1al n ieia(  Drr(m nt1oex mfctydlsDua( p;t4 eenmrcta1fpt ai slt trtmxmpnudlpenlivs tf Dtmxrooo4tle  ietyd aDrlumont0aetnir oa1omDelieo s s2xoxm io4ll  lfvia(faDrauront4aleo oeilslmDumump u4 ltoir todfmDe u ilt trtmxrpio1llee ivs ( sDur( pou0tpx  fetatfm2rmn s u4tetnif3iodfp   uvi;(0s2xoirpno4lleelfeslt)aDuaumooo0aexo octasfs rmuvs u4artoxrcoadlaDraivsl()t2um(rpoy1ll  mivs tfa2taxrp;t4aeeo oeiatfs2uau s;(4arenxf3tatopDe i sls0 rtm(o3iudapte nviat)sDrr(rpnu0tptnmieiadfsDelumon(0 rxnmocoy1optelueilt0t2uriopnu4ol  mfcs tfa2um(m ;u4oet moetldfs2rlu on()trtnxocoy1fmD livs s0 etoxo3nudoltemicsa( artrxroou4tpxomiciaslm2eanms;()trtrif3oydfmDrlues;(0trum(o nu4alte ics t  rum(m no1tee mfetltlsDel(ms t) exoxo oodoa   u s;t0srtoio ou1amtnmnetatfsDtaumpnu1tleo ictydls rauvp u4alermf tytomtrai sls)trto(rpiodaptemnvilsfaruru  nt4aex ifcias s umnvpnt0tltrmf3io1fmtr n s;t)trtrxrpiu1omte fvsa(  rtrxrpou4aptomocils a ulu s;(0 rtrxf iatlatr i ils) rtm(r3iydlptnmnviat)a2taum ;o1alx  octyd sDum( on(0trxrxo3oo1lpDrluei;t0trxoir oy1ol elnvilt sDur(mpnt4tpenmo3tldfaDumu on()alxnxfcia1omDelivils0 rxrim oydomt lfetltfsDtr(r nu1apxnio3tldfaDemu s;u4 rtrxrcoy1latrlu sl( srumim iu1aptnlncslt  rurxmpno0olxnio3tld mDemnmp u0 renxr3tadfmDrlivi t0srxoio oudlp  mnvi sfaruau ont0oex  oetad a2emuvon(4altrmf3oytfptrai ol(0 ruoxr3io4amen ies s s2ra(  no1aetn fcildfa2umu o;t)alxoxo oy1lpD aivsls t2xrxr nu1am e icslt)srraumpnu4tpxoioctat aDrl(vs;t)trerxf3totlpDean ol()setrxo3no1amenmncsasfsDtm( oou0olt  iciydlsDranvpn(0arenifcoadfp r ieo t0seurio3iodole  feiltfa2ua(mpoo1oetoifeiad m uau s t0 rtoif3todfpt lnvo ()setm(o ou1omeemieta( arurx  nt1olx mociaslm2em( s;u4trtoxo iatfpD aieo;(0 rurim3oy4amtnlieta( aDtruro;t0olt mictat a rm(mo;u4arxoircty1oaDrlnvi t0t2um(rpoo1om  micta()s2tr( ooo4tpxn ieiyt aDrlnmp;t4trtrircoo1fpte ueo;(0 ruoio3o
\ No newline at end of file
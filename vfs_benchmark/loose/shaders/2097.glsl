@@ -0,0 +1 @@
+u s ( tetmxrpiu4llt  fetl(fsrrmxmo;o1tpx mfcias s emuvp ()aeenmf iadopDranvils texrirpoo1amenmnvt s  rtaurooo1ope  o3tas mDulu s;u4tetoxf oatfaD  u sls  2xoio3oy1ape livsltfsDurx  nt1oex moetadfsDum(mo;t4altnmr oa1lpDraues;(0seumxmpoydomt mfeilt)s2umu  nt0tpeomietldlaDrlnmo u) rxoxr tatfmt li i;()tetoxmpiodlltnmneta( arraxmo;o1tee if3tadlm rmump;t) lxomo oy1omDraieo;t s2uriopiudlp e fvsas  rra( pot0apeo f3tlt mDulu on(4aeermr ty1oat li slt)sruoir io4lm e iei (f 2tmxro;u1aee micildlm ulnvp (4 rerxf iotfaDraivols  exoxm3oo1apen ivil( srrmuro;t4tptnio3iyslm2rm(vsnu0aeerxf3tatoaDrau i;(0trtmxopiy4om nlfeil()s2tmuront1tetoif3ild s el(mpn(0texoif oodfmDranvsls)t2um(m nu1opt  icslt)s2uax  ot4tltoif3iydfm2um(vsn()tetoxfcoo1opDelnvols0 exm(m ny1ope  nvsa()srua(m oo0optnmf3iatls2eaump u0 rerxr3ootfaDeliei s)s2xriopoydaltelfcta(faDtrur oo0oltomoeild m2eanmp (0altomfcoytomD  uvo t  exmxo3ny1amt livs (fs2trxrpot0tlx mfetld sDem(mp t0tleoirciy1fp r uvsls)t2trim ou1ap  lieiasfartaxrooo1aetoioetldfa em(vsn(4tlxrif3oydfaDr n i;s0t2xmio3ou4om elfvsatfa2um( ooo1tle  o3iytlsDrl( s;() exomf3oy1opD  n s s  rtoxm ny4lptnmnvia( a2trxmono0apen feilsls rluvs;t) ltnmo oydoa e ivslt)t2toxo3oodomt mfvsat  2rmxmo;u0olxomo3tatfs emn s;u0artomocoadlm   i ils s2tmxr io1lm nlfeiltfs2rr(mp;t1oee mfctydfs2ean s;t0texoxfciy1omDr neil( truo(o3iudlp emnes ()a2ua(rpou1altniictldfaDranvo;u4 lenmr tadlp r ivols0tetmxr no4al e icsat)s2trurooo4oee  icias m ea(vpn(0alxomr oa1fpD  n s;( t2tmimpnudomtnmnvilt)srrru ooo0aexnifctyd sDrm(vsnu) rerircoa1latelnesls  eum(m3io1oleelnetl(fsDua(moot0tet  ociydfmDrmu s ()aetomr3to1fmD  n i (  rxrxrpio1altelictas) rtmxmo;o1aetnmf3tldlm raums t0tetoir ootlp r nvo t)tetrxr iodlp nmivsl( sDumu ono1tetomf3ildlmDelnvo;t) ltrif3ia1fpD  n olt) etm(m3oy1alte nvi t) 2ra(moot4oeen i3tytls em(vs;u)arenxf3totlmt li i;t) eum(m oo4optn fvia()a2tax o;u1teen ieiys m uauvsnu0aeenxf3oatlpt  i s;t)t2tm(r3nu4oltemfcsat  2rrxronu1aetniocilslm2elnvo;u)artrmocoatfa r i s;(0 eurxopnydlle micsa(f Drax  no4aex  iciasfm um(vp;u0 exomo3iodlm r uei;()tetrxr3ny4am  mivils aDrrxrp;t4apeo oetat a rl(ms;()altoxf iytlp eanvsls)s2xrxr oodlmeelfvsa( s2taxmp;t1tet ioctlsfsDemnvpnu)artomfctodfpt ln o (0 etr(r3iy4lpt mics (  2rmx  no4opt mictatfa el( p;(0 lenif3iy1opDeauei;t  2xoxm no1ap  lnei sfartm(rpou4opeo iciasfmDuauvp;t)aeermf to1lmtean s t0s2uoxo3iy1omenmietas srtmxm no1ope ifetytfa ea(mp;u0 lxomf oatla eaies;s)t2xoirpnydame  netasfsrumuront0oexoiicils s rm(mo u)trerio3oatlmtr uvols0 ruoirpiydal  lict sf rumu  ot4tee  o3iydla2eln s;t0 ltrxfciatfpt  i sl(0s2uoirpoo4lme lnvi sfsrta(  nu1tptniietydfaDuln snu4 ltnmr oytomtrlueols0trxoxr oo4lp e nctls s2ur(mo;t1ole  o3iaslm ua( o t4 rxoxr3totlaDr n i t  2tmxr iu1lpenmieiltfsDtm(  ot4oex  ociysla2uan o ()areoxrciy1omD aiei s)setriopoo1ol nlnvs (  Dtm(ro;u4ape mfetltfmDrmn p (0artnif io1lmteaivslt0seumir3no4opt licsl()artm(rp;t0tlx ii3iytlaDem(mon(4tleoxr3oatoatelu s s srto(m no1lptemivt (f Draxr oo0tptniieildlmDea( s t4alxoxf3oytlp rlnvs ( setr(m3ny4omtnlfetlt aDtmxronu0opxo fcildfaDrl(mo;(0 lxoxfctotoptraivi;()s2to(r3oy1altelncil(f Dtr(r ;o1tpen fciltfsDuan s;t0arenxf ty1omDe ueils0 eurim iu1ll   ivslt a2raxmonu0oeeomoetyt s2eanvpnu)tltnxf3tatoaDrln ilt0texr(r3oudll elfvil( a2ta( onu1aeeniieildlm2eauvsn()tleomf3oo1fm r ues;s srto(m3iu4apte ncslsfa2ta(rp;t4oexoiiciadfs el(ms;(0altomr iotop raneo;s) euoxo iudal e icta(fsrrru ooo1ole mi3tadlmDeanmon() reomociadla  lnvs;s0srtoxmpiy1ome lnvtls)s2rmx pot1oetn f3tytla2el(vp;u4 eeomfcty1laDr uesl() etr(o3iu1ale lfct tfaDur( ont4opeoifeiat m2rmuvp (4 etnxrcia1faDeaivil()t2xmxmpiydoleemncslt)srrmxro;o0tpx moctasfa raumpn(0 etoir tytfpDrlnes;t  rum(opoydlp emfvsa( srtm(m ou0tpe mf3tadlm2rmuvsnu4altnirciytfmDeli o;s  etr(o io4lme  fvias sDraurono0tptoifctydlm2emump;(0aleniocoadlmtr i ol(0teuoiopny4om elfeil(farrr(mpoo4aexnmfetytfaDea(mp;(0aetnif3iytopD anvi t teuo(m ny1ol emiet s)s2urxr ;o1alto i3tld m elump;t0aetnmr io1op eaies;() exoxo3no4ape lietl(  Dtaxmpoo1oltniieiyt a uaumpnt)alxrir3oatlpteaies;()texoxm no4amtnliei sfsrraxrpot0tlx  fetld m2rl(vo;(0aetrxr oa1lmDeanvo;()trxmio nudap e fvias)s2tru pou0optnmi3iad m rmump;()arerxo3oatoat li o;t texriopoy1ap nlnei (  Dtr(rpot0teto oeildla2eanvonu) eerif3oy1fm  lneils srurio nudapt  ncsls  2rmx p;u0oltn fciat a2ul( pn()trtrxoctodoptelies;t0srtoxmpny4lleemnviatfa2rrxmo;t4opt  f3tydlmDrmuvs u4tetrxf tydfmt lnvi t trur(m3iodom nmnei sfarrmxrpou0aptnioeiasfa2rmnmp u)aexrxo oo1fp  lues;s)t2xoxopnu1aptemivtlsf Dururp;t1oetniieilsfm2ua(mpn(0 exrio3iodop  aieo;t0 eumxrpou1lp n fesat  2raxronu0texo ociasls um(vpnu0tlxoxo oy1fa raneslt)srxoim iu4ol emnvs ( srur(moot4olx  ieiadfs rlnmon(4arenxo3ootfaDeaivs;( teuo(o3iu1openmivslt)aDtmx  ;u1oeeomiciys m2rln o;t0areoiocoatlmt anvi t)t2ur(m oy4omtn iesl(fsDumxrono4teeomictlslaDran p t0trerir oy1omD  u i;t0trur(m3oydlp e fvias)s2umump;u0aetn fetlsla emnmo (4arxrmr io1lpDrlu s t0s2ur(m3iodaltn fei t aDrau  no0oleo oeiadlm2umnvont0 rxrmo3ty1oaDe n ol(0 ruoirpiy4omenmneia()srururo;t0aex mieiadfa2raumo ()tlxnxo tatoa  lneslt0s2trxo nu1ll  mies s aDrru  ot1tlt ii3tytlaDrm(vs;t)altrif ia1fptr i sls) exm(r iy4op   nesa()aDta(mpnt4tle  fcild a2uan snu0 exoio oytlp raueo;(0teto(m iu1ameemfcslt sDumx pno4aetnif3iyt s rlumsnu0aexrxf3tatomtrlieils) ruoirpnudolen iciat srtaum nt0alt  fctat m2ua(ms t0trxriocoytoa eauvi;(0trurir3ny1op e ict (fsrurxr ;u0oeeo ieiydlm ua(mp u0aeenmr tadomteaneil(  etrxmpnydllt livtltfa2um(m no4apxnifetldfm2umu s;u0tltomoctadfat  nvs () rxmim3iu4altnmnviat s2rmuro;u0aexnioeiadfm ulums;(4 lxnxf3oydfp eaneils0tetoir3ou4olenlfvia()a2rrumo;u4olto o3tas m ra(vs;(0trxrifcoadfpDelivs;t  eto(r3oo1olt mfvs t a2rrx  ;o0tpeo ociadfa2ulump t4 exrmo3oa1fa ranvs s0 2uoxr3iu4op nmnetatfa2uau  ;t0apenif3iytlm uanms;u0 ltoio3iydop   ivo ( srtmim3iodlmte icsat)arur( o;t4aeenii3ilt s2um(vs;(4 reoxrcoo1lpt lnvs (0sexoxmpio4lltnlneia() Drmu  no0openifetldla2um( pn(4texrxociydfpDe uvils t2umio3ou4ame micilt aDumx p;o4olx iociyslaDrlu o u4 ltrmo3oa1fpte uvi t0 2uoxrpiy1ap   ictas  2ta(mpno1alenmi3iydlaDul(vp t0trxrmo iytfmteau o s)srtmim3oydlmt  iesasf rrr(rpnt0oltoio3iytla2ulnmo (0arerir iotopDe u olt) exo(rpio1llee nvia(f 2rmxmpot0aexo ociadls ul(vo;t4alxnmf3todfpt  nei;()setr(rpoodlme livsasfsDrrumono4aee mf3iatfaDul(mo;u4texnmfcoa1omteai o;t) 2xmxr iy1opte ieiltfsDuru oot1tlx ifeias a2umnvs ()arermfctotoptranvs;s0 etr(m3nodamtnmivi t) 2urxro;u4tetnmo3tydfa rau s;t)trxnir ty1faDelneo;s0 etrxopoy4ap   nvtas)artr(  ot4aptn ictys sDean pnt0 rxnmf3tytlat  neo;t t2xrxopnydomt  ncs s arra(rpoo4ope  oeilt m ul(vo u4teeoir3oy1lp e ueo;t0teur(opiy4ope  ivt (  ruru o;u1tpxoiictytls2um(vp;t)trtnmo3iatfp r uvo;() 2uoio ou1al  mfcsltfa2tm(mooo4aptoioeiyd sDrlums;u0aleoir tytfptelu o;t trtrxo iudlmtn feils a2tr(mpno4tle mo3ias m2umn pnt) ltnxr3oatomtr ivols0sexoxm oydlp nlnesa()a2urx  ot4ale mf3tltfsDum( p;t) etnirctatopD  nvo;t  exm(mpnydaltnmfct t  rtaxmpno0tleo feild s2eanms;t4arenir oo1opt lies;s)sexo(m3nu1ol nlncsl( a2ua(ro;o0olx  f3iydlaDuanvp u0 rerxf3oa1op  ai o s)srtr(rpio1al nmiet s)aDurumpou0alx miciyslm el(vp;(0 renmf todomtrai sls0srtmir ou4al emivtatf Dur(rpno4apen ociyd mDelnmp t)tlenmr3tadopteaneo s0 rum(m nodll  mfes s)aDraxm oo0tlxomi3iyt m2eanmpnu4teeoir3tydfat au s (  2tmim oy4lm e fvias s2tmxmp;t1opt ifciyt m2emu o t0altomr3oo1omD lnvs;t  ruo(m nu4ale mfetat) Drmur ;t4tptoioetlslaDuaumpnt) rtnir3to1fatean ol(  rtr(opoydal   ivsas) 2uauroou4oltoio3iaslm2emums;t)teenxf3iydlmDrlivi;t texrim3oo4llte nci t)a2ta( ont4teto feiytla2rl(vo t4alerif tadlateanvi s  ruoxopiy4ll  lfesas)srraurpnt4tpenioeild s eauvsnu0aeenxo oy1fat  u o;s0s2to(m oy1apenmfeilsfsrtmump;t4apeo ietasla2rlums t0tlenifctydfm rau ols0t2uo(mpoo4al nmnes t)aDrrurpoo0ape mictldfa ua(mont0 eenmrcoo1laDelues;t) etoxr nodllenmfvi (f Duaxmo;t4tpe moeias sDeau o;(0 leoxo tadfa  aieo;(  rxrimpoodlpte ies ( s2trx p;o1apeoiicilsfsDemumon(0 eeomr3iadlatelu s;s  2xr(m3nu1opeemivtltfsDua(m ou1altomfciat a ulnms;t0 etoxf3todoa eanei t0teuoxo3ny4altnlicslt)srtrxm nt1oetomfeiyt m ul(ms t4 exrxoctatfmteli o t)t2tr(o oo4ap  mivslt)a2tm( p;o0alt mo3iad s2uanmp t4 ltnmo iotom  li s;s trxo(m3oy1llee net (  Dur( onu0tpen ociysls um(mont0tetnio3ia1fa elueo;s t2uoxopnu4al   fvtasfsDtrurpnu1tpxnmieils s rlums u4altniocoodfateanesls t2tmxrpoudlmtnlivs tfs2tru oot4tlt moeiltlsDul(vp;(4 ltnmrcoo1lm  li o;(  2tmiopou4lp nlfetls) 2rr(mono4opt mfeiydfs emn o u0alxnxf oa1fm eluvil( tetmio3oo1amtn net () Drmx  ;u0optomoetlslmDumn o (4tetrxr ia1om rluvi (0trurio iu1ol nlfetltfsrtrxrp;o4opt  oetyd a eanvpnu)tleomr tydlpDelieil() exmxopou1ape  fet ( arum(  ot1tltnioetadfm2el( p;t)tltomf iatlpDrai ils) rxrimpno1oltemfcta(fs2taurpnt0texn fctlt sDumnvp;t)tltrxr3oodlmt au i;s)srtrio3no1amtelfeils)a2tr(ro;o1tptnifeiadfm2uanmo t)alxoxfciotlaD  u i s0 2tmirpoo4op nlnvsasfsruaumpoo1oex if3iysfsDea( o t4altoxr tydlaDeaiei s0 2xoim oodlpeelnci ()srrau  ot1oex mfeiat mDeanvp ()arxomo3iydop elneo;s  rtoxo3nydomenlfeta( arumum ;t4tlxn o3ias m eln pnt0trenxociatopDe u o ()texm(r3nodam n fes ( s2rmxr nt4aet ifcildlmDem( o;()tetnxr ia1faDean ols s2tr(mpiu4olen nvils)s2uaxmp;t1tetomietlsfm2umuvpnu4 exnmoctytop rlnvil(0t2ur(r oo1olt  fcils s2uau pnt4tptnif3ias s2uaump;u4 rtnmf ootlpDran i;(0teto(r oy4omtnlfcs t s2rrur ;u0aeenif3tydla ranmo t)aexrirciodfmteai il()trum(r3oy1lmee feilsfa2rmumo;o4oetoiociydlaDuan snt0 rxrxf3ty1fmD au ils) 2trir io1ameelfetasfa2um(r ou1optomfeias a2rmnvs t0 eenirciodlaD lu il()teuoim no4lptemfetl(faDrmxr ;t4teeomf3tad sDea(vo ()texrio3todoaDelnes s t2xmxo3iydllen fvslt sDtaump;u1altoioetatfm ua(vs;t) exrxr3tytlm   neo ( teto(o oy4lmt  ncs tf Dtaxrpoo4teenifciltlmDea(mp;u)aeeomo oytlaDe nei ()seurxm io1lltn fcsat  Dra( pot4aleoiicilsls umuvp;(4 exrmr3ty1op elieo;s sruo(m iu4apee fctat aruaxm ;o1tlxnmoeias m uanmsnt0aetoio3tydfaDeln s ()srur(mpio1ll  lfei s s2uaumonu4opx if3iasfs2em(vont0areomf iotfmDeaneols  eur(r3nudop  mfci (fsDtruronu0ole mo3ils s2ulnms;t)texnio3todfa e nvi (0texm(m3io1lmenmiet sf rtrxrpou4tpxomf3iyt s emnvont)arxnmfcoadfat li i s trxmim io1lpee nvt (f 2urxro;t4apenii3iadlm emuvp t)tlxrmo ty1oatranvs;t)trurirpno4ap eliciatfarta(ronu4olxnmi3tldfs rln p;t4teerirctadoa  aivslt teuoim3iudlltemnvils arrm( oot4tlx mo3iysfm ua( sn(0trxomo iodfatr n i;s)tetrimpnu4lmt  ivs t artmurpnt1aptomi3tasfs2rm(vo;(0trenmoctydlatean o t0 2xo(o io1altemicslt)srtaxrp;u1ale mieiysfa2uan p;u0tltrif3iy1lpDrlnei;() 2umxo oy4aleemiei ( srum(mp;u4aexnif3tatfm ua(von(4tleomfcio1fm   i i (  2umir iy4lp nlfeiasf 2tr(r ;t1aexnmfeiat m2uauvpn(4aexnif iytfmDelu il() rxrxo3iudlltnmiet tf 2tr( ono1oexo octad m2umu p (0 lxoirciydop rlu o;t0trtm(mpno1apeelies s arumx ont1tpt moeiat a rlu onu4 lxoifciotfa   i ils) euoxm3oy4lmeelivta(  ruau p;t1aptn ietytla2rau snt0texnircoodlat lues (0sruoxopiy1llee fcslt)sDuaum nu4olxomietysls ea(vo;u) ltrircoatfp   nvs (0tetrxr iy4amtnlfei sfartrump;o1opxomfetld m2eanvs (0arxrxfciy1lp rlnvo;( trxr(r3iydamenmfvi s)arrr(m nu0tetoioetlsfm2rl(msnu0tetrxfcoy1fatr nei;t) rtm(mpiy4opte ieta(  rtm(m oo4opt  o3iydla2umnmont4alxnmocoo1lat ai ol(0 2umio3no4optelnvs s s2tm(root4apxomietltlmDeanms;u) exrmoctydfmDeauvs s0 2uo(m oy1omtemics t  2raumpou1opx iieiadfa2ean snt0arxrmf3iotfpt livs;t t2tr(r3nu4ape lictlt) rrr(  oo0teeomociad aDelnvsnt0aexoxo ta1oaDeln s;s)t2uoxrpiudopenmictl( a2rmu  nu1aeenif3iad s2um(mo t0texrifcio1opDrau s;( t2trxr nu1ame  feiat arurxrpoo0tlxnmieiydlsDemnmo;t4aleoxo oatoa ran olt)t2xm(mpou1llte ietl( aruau oou0tptomociytlm2rmn s;u)tlenxr tytoa  aivo;( t2xm(o3iu1lmeemfvsa(farrmur nu0olenioetltfmDumnms;(4arxnmocia1op e ivi s) rxr(m3iydlmenlnvs (f ruau pot4tlxoiieias aDrmnmp (4trxnmr3oadlmt  i o (  eurxr3oy4oltelivt s sDurum ou0alt ii3iat sDrlump ()aexrmr iodop r i i;s  exm(r3iu4al   nvsl()srtrx o;t1aet  ietasla2ua(vpn() leoiociadfaDe uei;t0trxm(o oo1omtnlfvsa() rtmu oou1tetnifeilt aDea(vpnu4aexrir3iydoatelueslt) rumxr ny4op emfctls  2rr(r ;o1teeomfeiat a eln p;()altomf tadop rli o;s0s2xmxr oy1lpeemneias a2rauro;u0tlenmiciydls emuvo t) lxnmf3ia1lptelivo s)trtr(mpio1ol n ivs ()s2ta(mp;o0aeeo octldfm2rluvs;t4 rtrif3oadlatr ivilt  2toxopiudol e fci tf 2tmx oot0aexnif3tyt a2eaumpnt4tetrmo iotoptelivils0s2um(r3nu4omtn ict ( s2uaumpnu0aet  oeils s2emn p;t0tetrmf totomtr nvs t  2xmxo3nudlpeelicsas  2rmurooo4apt io3iaslm2rm(mo;t4 etnmrcoy1fmtrlnvi;s t2toimpiy1om emfcias aDrr( poo4apx ifeiyd a rmumsnu0aexnmr3tadla eai o;s)tetr(mpiy1lm  lnesat a2ua(monu4oeeomoeiydlaDem(vo t4 renmf iatfatr ieols srum(m iudap   net s  ruru ooo0olenmieiatfs2emumpnu)alenifciydopt  ueo;t trtr(r nodllen fctat) 2umurooo0tet miciatlsDrl(vonu)artnmoctodop eli ol(0srxrxo3iy4am   net tfs2umxrpoo1texo feildlm rl( o;()alxrxf oytlpDr neo t srxo(m iydll nlnci s srtaxmono0aetnmi3tys m2rauvp;u) lxrmoctytoaDr n i t trtmxm3ny4ome lfviatfarrr( p;t1tlt moetadlsDum(vs;(0altoifctatfm rluvols0 2xrxmpiodlm  mncta() Dua(ronu1tlto fciyt a2emumo ()aleriocia1opD li s;s trumim nydlmtnmfcs ( arra(rp;t1oet moctadlm2el(mp;t4tlxnmf oytlp  luvil(  exrio nydapt  ivi (fs2uru  no0aee  o3tydlmDea( o;u0trtnmfctytfmt  uvi;(0sexm(r iy1lm emfcs tfa2taumo;u1olenii3tytfm um( p;()tltnirctatom e neolt0s2tmxr3iudll eliet (f 2umum ;o0aetn i3ilt m2ulu p (0artrmo3oy1fmtelu o t s2xm(r oudlpeelicslsfa2umur ot4olto i3tad m rau o u0 eeoxrcoy1lm   i ols0srtoim oudom  lici sfsDra(  ;u1oleo i3iadlm ul(vpnu4 rtnmfcoytopt an slt sexo(rpou1op nmfesatfaDtr(r oo4tpenmo3iydfmDrluvo u0altrxr to1omD  n s;() 2um(r nudamtnlfvsasf Drmu pot0altomiciaslmDuluvpnt)tlxoxfctodopDranvolt0srxmim iodole  fvt t sruax  ou4tpto i3tlslm umu o u0 ltoxo3iodlmtraieslt  rtoim ou1ape  fcsltfa2rm(mo;o1oltn ieiltlsDel(mp;()alermocoadop r uvols) ruoxr3nu1amtemfetlt  rtmx pnu1teeomf3tatlm2rmnmo u0 leomf oodfmD ln o (0t2xr(rpoodlptelivsl(fa2taxrpot4tetoiictys s umnmp;u0 rtrmo tytla  lnvsl(0 exrxm3ny1alen fvt sf Dtmur nu0oee ioetad m eanvsn(0 lermr3oodopDranvs s)texmxo3nu1olen fet tf rtmxrono1tex  ocilslsDulnmo;(4trtoio3oa1lateai s;s0 etm(rpio1lp elieslt  2tr(mpot1tpe ifeiydla ea(ms;u4artoif3oodom   nvil( texrir3iudopen fvtl(fsDrrx  nu0oexnifciad a2rmu pn(0 etnxo3oy1lpDr ivs s0 exm(opiy1lm  miei t)aDur(mp;u4tetomoctysls2ul( p;u) exrir todfp eaivils trtr(o iodomt  fcsas)a2tmuront1alxn ieiltfaDemu o u) rtoio iodlateaivs;t srtoimpoudapte fvi (fsrrm(rpnu1aptniociltfa2ra(vs;t4 etomr tadop   u il(  rtmxmpiy4lle  nvslt  2rmurp;o0aeeoio3iasls ulnmp;(0arermocto1lmte iesls setmxmpnudam nlfcsat sDumuront4tleomoctldfm2ulumpnt4 lerxf ty1omtrluvs s) eumxo3nodolenmnci s  rtrur ou1ole  i3iatfa umumont) rxnif3iatla rlu i;s)trum(r nu1olt  ieslt a2tmx oou0oexniieilsfm2ul(vs;u4 rtriociadoptrlivi;t  rtrir nu1op n ictl()s2taxrp;u4ape io3tas aDean pnt4aleoio tytopD lnei;( teumxo nu1om   ieslsfsrrm(ro;o1opt ifctat m2emumpnt0alxrir iydomtran o (0 eurxr io1opt  fvils aDrr( oot4opeoioeilt a2um( ont0alxomfciydomDrluesls  eum(r3iu4open iet s srraumo;t0oex iictytlaDemn p (4tetomo tytopt aivo s  2xrxo3oo1lpeemfvtls a2trxmpno4aexo i3iasfmDua(ms u)alenio3iy1lpt auei t) rxr(m iu1op nmnesa(faDta(rpno0oexn fetys mDrm(vo;u) rtomf oy1oa r ivs ()t2toxr3oy1lmenlnct t)s2taumpoo0tetoii3iasfaDrl(mo;t4aexrio3iotfptelues;s  exo(r3oy4ap n ietls) 2tmumoot4altomoeiysfa uau pnt0artrxf3iy1opt an sl()seto(m oudopeelnetat)sDtrx pnt0oexoio3iysla eaumsnu)teeoioctadomDr n sls0setmir3nu4llt  ncsasfa2trx o;o1alen oeilt a2ua(vo ()areoif3tytop  luvi s  eumiopio1alt micia(f 2ta(r ;o1aptniieiatlsDulnmp (0 rxrmo iotfateai sl(  exoxr iudame lnesltfa2umu pot1aexoiiciydfaDul( snt4trtrio iadoaD luvi t0seur(opno4al n fei t) ruaxr oo1aexomf3tysfaDum(vp;t)arxomf3iadfp rau s t tetmxo iodlmenmietl()s2rax o;o4olx mfeilt s rl(vsn(0tlxnif3totom  luvil( seurxr3iu1lm  mnct t)artr(mo;u4ape mfciasla ran o;(4arenxr tadfa r ieols) rumim3no1omt lfci s srrmx  nu4apxn oeils m2ul( p;t) exnmoctytlmtr nes ( seuoxo3nodlltnmics sfarurxr ;u0optoioeias m2um(ms;t4texrmf3ty1lp r ieols  euoio ny4lmte fvs t s2rmu ono1opt  i3iyd sDuln ont0 ltrmo3iydlm rlnvi t) exmir3iu4ll  mncils)sDurxrpnu4tlx  f3ilslm rlu sn() eerxo3iodfmDrluvi;s  eum(r nydlm   fvsa()sDrmxrp;t0tpxn icias a ul(vp u4arxrxrcta1fmDelu s;s0 exm(o nodopt lncta(fs2ua(ronu1alxn ociltlm eln o t)trxnxoctatlaDelneo;()s2to(r3oydopt micsa( s2taumo;t4opxo ictls m2emnvp;(0 etrmo iotlmDe ueol(  2xmiopoydoptnmfvtltfs2ta(  no1tpe iietad m2eanmp t4aexnio3ootfpteln o ()tetmxm no4al   fvtltf 2tmur oo1tpxo iciyt a ea( on(0teerxr3iodfa rai s t t2urxmpno1alte ivslsf rrr(mpoo4tetomociasfsDrmu o u4 reomfctatfm  lueo (0t2xr(mpnu4omeelfvilt)sruax oou4tet ifciydls um(mo;u)aeenmo3ty1lmDeanesls0s2tm(mpiy4alee icsa() rur(r nu4apx mf3ias a2um(vo;t4alxnmf3iydlmDe nvo;() 2tm(rpoo1ll  lnvsa(f Dtmxmo;u4oexnmiciatfm rmumon(4aeeoircoodlaD  ieo;() eum(rpou1altemfct s srumxm no0opx mfeildla ul(vo u0 eeomf to1op rlivols  eur(o3nu4amt  fcs ( aDtrx  no1tpeoii3ildlsDeanvo u)trxnmr3iatopD  ivs;s  2xo(r3no4lpt lnviasf rua(rpoo1tpxoifciytfm emn o;u0aeenirctotlaDeaueslt0 euoxr iy4opeelnet tfsrum( pnt1altomfeiysfm ulnmp;u0teerxo iodfp   ivs;t0s2tm(mpiodlptnmfesltfarra(  oo0apenmocilsfa em( snu0trxoio3ta1om r i i s0trur(m3nydomtnlnvta(  2urx  nt0tpt mociydfa2uan onu0teeoio ia1oaD ln i;s0 2xr(m oudom nlivtat)srtrx o;t0openmieilt s rlu o;()artnio3iotfate n i;()t2tm(r iodaptemncsltf rtmu poo0tpxnifciyd sDel(ms;u4 rxoif3iatlaDrluvo t) rto(m3oo4om  lfvi s)sDumxmoou4tlxn f3ilsfm ulump;() etoxo3iadla rlneo t0 2urxmpou1llen ict tf rtr(r nu1oee io3iydlm2el( p t4 etnxrctadopt lnvs (  rxrir3oy1ol e ics ( srrrurpoo0oex mfeiytls rlu p u4trxoircoodlp eauvols0setmir no1ope livia()artrx o;u4olxo fctlt a2ul(ms;u4trtoircoatop  aivo;s)texrimpiu1lptemnci t  rra(m ;o1apt mfciysls rlumo t)tlerirctydlmDelu o t) 2umim3iy4opt lics tf Dtm( pno1tlxn o3tatfm2um(mp;t0 leomr3iydlmDe neslt0texmio iudlle mfeia(f 2tr( pno1tlx mo3tysls2ea(monu0 lenmocoodom  luei s0srtrxm3oudopeemfeilt  2uax pnt1tpx mo3iatla rmn p t0arenir3oydlateluvilt)s2xrimpnodlltemnvs ()sDurxm nu1tlto fciysfm2em( o;(4 rerioctadoptrluvols0seumxopnydlpt mictas  Dtaxro;t0ole mf3iltla2rl(vp u4alxnir3ty1lm   uei ( trxrio3nydopenlieils sDraumpoo0tpeomi3iatlmDemumont) rermf3iadom r i i;() 2ur(m ou1op nmfvta()aDrmu p;t1tpxnmo3iadla2em(vpnu) rtnmo3oo1fpt anvo ( s2triopnu4op  mieil( srrmum nu1opt mfctydfmDul( snt0 lxnmr3totopD  n i;s srxrxm3ny4om  mnvtat  2ua(rp;o4aetn f3iltla ulu o;u4aeeomf3iy1omDeluvs;s)t2trxopou1om nlieia() 2um(mpno1aptn feilsfsDeau p;t0 rxrxo totlmtrlu s s  etrim3oy4lpeemfetlsf Draumpnt4oleoifciadla eln ont4teerxo3ootop  lues t  eurim3nodapte nvs sfs2uaxr ot0ope moeiad sDum( sn(4 rxoir3iydopD  ieils0t2xmiopoydomtnmnct sfa2tmumo;o1olxoifeilsfs2rm( pnu0alenircoydlaDrlieo ()trxrir iu4llt  nvtl(f Dum(m ;t0tpt iiciatfs rl(mpnu4trxrxr ootla rln o;s0tetrxo iydam emivt tf Dta(  ;o1opto f3iat aDemnvsnu4alxoxo3iatomDraneo;() rxr(o oodopenmnvtls arumurpoo0tee mfctasfaDel(vs t) eerif3tytomteanei s0sexmir3nydaleelncta(faDrr(rpot0aexnmoctas m2eanvo t) exnifcia1lptelu s;( t2trio io1op nmfvi tfsrtau o;o1tlxniocild m2eanmsn() exoxr ia1fp e uei (0tetoim oodlltnlfctls)aDtaxmono4tltnmf3iytfmDrl(ms;u)texnmf3oatopt  neol(  rxmxmpnu1ole lnes tf 2trurpou0alto o3iad s2eauvp;() renifcio1fatraieilt0t2
\ No newline at end of file
@@ -0,0 +1 @@
+ueols seuo(m oodol emiei sfsDumx  ou1tetnmoetadla2rluvp;u)trtoio3iodfa e ivo;t0s2xoio3ou1ol  lietasfa2tm(  ot1opto ieiytfs ra( snu0aetrmf3oo1fm e ivi;s)setrir nu4omt mncsa(fsDua(  ;o0tle  fctyt aDea( o u0 etnio3iydfa rli sls teur(m no1lm nmiesa(fsrum( ono4tlxoifciat a raums;u0alxrmf ootfat livil( setoim oo1lp   iei s)a2tmuro;t4tle mf3iadfsDean ont0trxomo ta1om r uvo (0 rtmim ou1ale lnvt (  Dumxr ;u0tptnii3iasla2umuvs;(4 rtnxfcoydfmtr uvolt)trtmxr nu1opeeliet s)srumx  ou1alxoiiciyd mDrmumsn(0 etoio3iatfat liei;t)t2to(m3nu1llen nes s)sDtrumo;t0olx mo3iadls2ra(msnt)artrmr iotom   uvsl() 2umxr3no4am n nct t aDtax  ;o0ole mi3ils a uauvp u)tlerxr3to1opDranvsls t2urxr iu4lltnlictas) rrmxmono0tee moeiat s2uau o t4trxrmf3ty1fmD aueo (  etm(r iy1apee ivtat aDrmxmpou4tlx  feiys a rmu snt0tetoirciatla r ieslt0t2trxo oodll elfvi ()a2rmur nu4oltomoeiyt m raumon()treoif3iodom  anvi s  rtr(r3nodapenliei tf 2tm( ont1tet moctasfa um(vp u0areoxfcia1lp e nes s)s2xm(o oodom e fesa()arra( oot1olxoii3iydfa emnvp;t0 rtnxr3oo1lp rln i;(0 2xrxm3no1lme mivils)arumur ;t0olxo o3iat s2em(vo (0aexnifctodlmtrlivil(0s2uriopnu4lp nlnci (f rtr(rp;u0apxomfeiasfsDea(vsn() rtomf3iatlateai o s) 2urxo3iy1apenlfeiatf 2umxront0texoifeiasfa2emn s;t)arxoxr3oytlpt ln s;( truo(r3iu4lmenlnvi tfsDrmx  ;o1optnmi3iad s2eln snt)tlxoxr3oy1fa  lnvs;s srurxo3iu4alenlnet t)s2ta( poo0aex  feiltlmDeluvonu4 leoxf3iotlaDeau s t  2to(opny4apenlfcsat aDrm(mo;o1aptnio3iadfs ulu o;t0arxnmocia1fpDrlueolt  2trxo3iydame  ieiatf 2tmx  nu1olxoii3ildfm uauvsnu4altomo3oo1lp  anvi;s0 2uoxmpnudlmte fcs t  2tmuro;t4olx  ictysfmDrl( sn(4artomfcia1lpDrluei;t trxrxo3nodlpe mieilsfsDrau  nt0tpenmieildfaDua( ont4 etoirciy1lm eln ol(0 2uoio3oy1al n fetl( aDrru o;u0tpt ioeilsfsDem(vo;u)tltnmr3oodlpteau o;()teuoir3nodam elnvi (fsrtmx pou0tpt  ictld s ea(vp;u)aetrircoodfmt aueol()tetmir io1alt mfetls arrrur ot0alto feilsla rau o (4altomf3io1fp   nvil() eur(r3iu1op e ivsas)srtrxmp;u0opxnioetysfaDuaums;t)tlxoxr oytoa eauvi t0t2xo(r ny1ameemivtlsf 2urxrpnu0oet  i3ildfaDrmnmon(4trtrxr3ia1opteaueolt sexm(r3ny1omee nvsls s2rrumpoo0optnif3ildla ra( s;u0areriocta1oa raneil( sexmxrpoydapt lfet t s2ur( oou1oex iicildla2uau on(0 etnir3iatfateaiei;t0trxo(o3oodolt  fvt ( aDraur nu1opeoii3ildla umuvsnu)tetnir totom rlneils) rxrim no1openlfeta( aDrr( poo0teenmoeiydfs rmn s;u) rxnmo3todfaDelu ilt0texoir ny1ll  lfcsat artm(moou1alx mfcilsfs2eln o;u4areomo3oy1laDeaiei;(  2urxo3io1ome livt s)srtrumont0teeo feiat m2em(vp t) rxomocootoa ranvs;t0t2tmim3iy1ameemiet (fs2trxm ;u1tpxnio3tys aDeanmpnu0areoir tadlpte uvs;t0trumxm3iydame mnvt s  Drax pnt4tpeoioetysla2uanmp u)aleoir io1lmtrau il(  2umirpiydapt  icslsf rumu pno0tlxnif3ilsfs2ul(ms;t)treoxf todlp   n i s)trurxmpiu4lme  netltf 2rrxr ou0tptnmo3iyd m2rm(von(0trxrmrcia1oat lu slt0seuoxopny1omtnlnviltfarrmxro;o1oltniicilsfaDemnvp u)tlxrio ta1omDraueolt0 2xm(m3oy1al nlivtas  2rax p;o4oetnioctldlm2umu p u) leoircoatlaD aivs t)seuo(r3iydome  nctltf 2tmxmpot4tptnio3tysfa rau s;u)arxrmr tytoa  lnvi (0sexmim iu1ape mnet sfaDuaxmonu0tex mociad a2rmnmsnt)artnxo oy1lm elu o t t2trirpou1ll  lfvs t) 2trxmp;t0oltnmictltfm ua( o ()tetnmr oatop e ivolt teuo(r ou4llen nvt (faDrm(rpno0tleomietadlm emu o (4tleomo3iytfpt auvo;(0 eurxopiy4olee nctas  Dtax p;u4oexoii3iaslaDrlumonu0tltrif3iatlmtrai o ()setoirpno1am nlivt t) 2rru ooo0oeeoioctyslm ulumo;u0 leoxo oadomt lu il()srtoxopou4olt lnetat sDraxm nu1texn ocildla uan s (0 rermocta1la r neilt s2xoimpiu1ape miesat)s2rrxm oo0oex if3tls m ra(msnu) eerio ty1lmDr ieo;t) ruo(opoo4lmtnmfct t)s2rmumont0aee ifciys a emn o t) etnir3ia1fpteaivi;t)teum(o3nu1lpt  fetl( aDraxrpou1olen i3iltla2el( on(0trxnmr tytomDraivi;t0 2to(m3oo4llenmiviatfs2rmu pot0tet mfetltla2uan s;u4arxoif iytfp rlivi t s2toxmpnodoptelicia(fsruax  ;o4tpto fciys m2umuvp;u0altnxf oodom r neo (0trxm(m3io4lpeelivsltfsrrm(m nt1tlt ioctaslaDrmnmpnt)tlxoxr3tatomDraivo;t0trxmimpiu1om n feiatfa2um(rpnt4tex ifctys m2rau snu)trtrxoctadlp rai sl(  2xo(mpiy1al nmicsls s2tm(rpot0tlxnifetysla2elu s t)tetrxf3tatfp eaueolt0texr(rpou1ame mfvs s s2umum oo4olx if3iasfsDemu s u0 ltomo ta1oatr nvs t  2toir3oydam  liet s  2ra(mpou4tltnmoetat sDumums (4alxnif3iotoaDrlnes;t) exoio3no4lp  livt ()sDrmx o;t0tetn oeiadlm2ra( onu)alerxo3oadlaDrai i;( seumxo iudlleemnet ( arraumpoo1oeto fciat aDeau pnu4alenxo iy1fmD  nvi;( sexrimpiu1lmtemivs s)s2raxronu4aee  i3ias m2ulnmo;t)trxnxo3oa1lpDrauei;() rxo(o3iy4lleemiviltfs2trxr ou4aeen fctyt s2ean s;(4tleoiocootom rln olt)srtmxr ou1lptelicslt a2tm(mo;t0tex ii3ild a2el(mon(0arxomfcoydoatelneilt0sruo(mpiy1ap elfes t)srta(rpoo4aexnioctyslm emumsnt)teeomf oodom rluei s0texoxo3iudalen nvil( s2uau poo0olt iieildlm umn pn(0tltnxr3oy1lpDeau s;( tetrim3oo4am elfcsls) 2trx o;t1alxnmietaslaDul(vp t0 lerio oo1lpDrlnvo;( seurir3oo1om  mnvsatf rrm(rpoo1aptoio3ilslm ulnvs;u0teenmr3iatomDr neo t) eurxr nu4amt mnet s)arur(rpou0opt moeiatls ea( s u0 ltrmfcoadoaDe uei (0s2tmxmpoy1alee nci tf 2rmu p;u0tltomicilslmDemn p u) rxnio3to1fpDrlneol()srxmxmpno1omeemfetas)aDrr(r no1aetniiciyslaDranvpn() rxnio iydfpDeai ols s2xrxo3ny1lpt mnetl() Drrumonu1aet mf3ild a2rm(ms u4 lxnmrcoytfp eliesls)sexm(r3oodlmtemfvs s  2ta(moou0aexomfetyd aDumuvp u)artoif3iydlpD au o s srtr(o3no4altelfct (  rrrxro;t4olto i3iys m2emnmp;t)trxoif3oadlmtelivs t seum(o iydll e iei t aDuru pno1aeenmi3iyd sDumnmpn() rxriocty1oateluvil( seto(o oo4lleemfei sfsDuru  ou1olx io3iys a rmu o;u0areomr3oy1fa rln o;() rur(r3oydllt mnctatf 2taxmo;t0aptnifciadfaDem( s (4 eeomf3oa1lpDeln slt0s2xoxr oy1lmtn iei sf 2um(mp;t0oltnmi3iyt sDemn s;(4areoif iytlmt aivs;t0 euo(r3iu1omtelneias)aDtrxr nu0aetoiietaslm2rln snu4arxoxr iydlpt  nei s trxrxrpiudllenmnvs (fs2umxm no4ole io3iydfa2um( s ()alxoio3todfaDe i s s0 rtr(o iodale lnci s s2tmx  oo4tlx  i3iydfm umnvpnu0texo
\ No newline at end of file
@@ -0,0 +1 @@
+nes;t)setmim io1apenmfcsat sruaxrooo1alx mfciyt sDemnmonu0trermr iodlm  auvsls0srxo(r ou1omt  fvta( a2tr(r ot0openiictadfa uanmsnu4teerxf3io1op  ln o ()t2urxrpiodalen ivtat)s2trurooo0aeeomf3tld sDraumo u) ltnif3ia1fm   neol()trurxrpoo1lm emivia(f rtauro;o1apxnmi3iys a2ul(vont4aeeomo oodomD lneil(0trum(r ou4llenlfet sfs2taurpou4altn fetytls uluvo;(0artrxf tydlpD lu slt0trurirpio1llt mnesltf 2rmu pno0alxomociasfm2em(mo u4arermo iadfpDeluvils)seurxr3nu1ll n nvils  Dur(mpot0aee mi3iatlm umu o;t0trermo3iydopte u il(0trtr(o iu4lm  livsatfsrtrxroou4olenifciatfm ra(mont)trtrif tadlaDrauvol(0s2umir3oy1ole miciat  ruaurooo1ole ii3iadfmDemnvp u4 ltoxfciodom  lu i;t s2xo(r3iodale  ivtl( s2tmx pot1tetnioctad m rau snt) exrmf tytom elneo ( trtmxm nydamt lfvtas) Dtaxr nu1optoiiciaslm emnvpnu) exnir oy1lpteanes;t tetrio3oodalt mneiatfsrrr( ont4ape  oetas a rmuvpnu) etomocoytfpD ln s;t)s2uoim3oydapt  nciatfs2tmum ;u1optn iciysfsDrmnvs u0aexoxocoadlp   uesl( trxr(o oo1llt lfei s  rta(mpot4opx mi3tydls2ulnvonu4trermfctotla rai i (0s2uo(r nodapee fvi t s2rm( pou1apxoioeiltlmDea( o;(4 exoxo tadlaDran o t0t2umim iydole mnct tfaDumxrpot4apt mfciasls um(vp ()aexoirctotfpteaivi t) exoirpoo4op emnvslt) 2um(m nt0tetnii3tasfs2umuvp;u0 rerxfciodlp  au ol()setmim iudalt lneils aDtr( oou4optnif3tas s eluvpn(0aeeomociytomtelieil(  rtrim3iydlle lfvil(  2tmx  no1oexnif3iydfs rmumsnt0 lerxf3ty1fmt aieo;( s2xo(r3nu4ol   fetl(  2tm(root4aptomf3iatfa2rauvon(4aetnmf3iydfmDraivil(  etr(rpou4al n nes s artmx  no4apto octasla rmn pnu0texnxo tadfpDean s;( setrim3oy1openlfctasfs2raxrpoo1apen o3tatfa2el(mpnu) leoio iodlpt lu sls) exo(r iydlpe lnctl() 2tru  ;t4tptnii3tysfsDrauvon(4treomf3totomteai o;( srxoxm oy4olenmnvtls arur(rp;o1oltnifciysfaDuau o;u)tlxrir totlpte nvi;s0 etm(mpou4lpenmnctat aDumuro;u0openiictydls ranmont4 eenmo oytfmDeanvol() euoxopiy4ap   ivilt  rumx  ;o1tleo f3ils sDrm(mo (4alxniociodfatranvo ( sexm(opio1aptelfes t  2umu  ;u1altoiociydls eanvsnu0aeenio todoat lieols0s2xrim oodlle  ieiasfartr(r ot0tpto o3iytls rlump (0 lxnio3ty1oateluvo () eum(o iy4omtelneiat sDrau pno0opx  octadfmDeluvs;u0artrxfcoydfptelivsls  2tmio3iu4ope livta( aDuax pot1apxnioeilslmDelu o;t0 rxrxf3iytoatr uei s)setoxmpoudaptn iviasf Drrxr oo4alen f3iadfmDrmu p;u4 exnio3oo1omt li o;(0t2toir iu1ale mfes s)srrrum oo0oeeniiciat s uan s;t4 reoir3iotfpDr u sls0teurxm oy1oltnmfvia( s2ra(  ot4aptomi3tysfs umums;u0 rxrxo3oadlpteli sl( s2toir oy1optelfetas) Dtrx pno0ope mf3iytfs2elums;() etnio3iydoptelivslt0 etrxopnu4op   ieilt) 2rmxr nt1ape if3tld m2rmump u)arxoxr3oatlaDeaueilt0t2xr(rpoo4lm elnciltfsDurumo;u4ale  ieils mDuanmo;(0aetriocta1faDeluei s)srur(m iydomt lfvtat  2rr(r no1opxoiociltla2rln o;(4tetnir todlptrlivs;() 2toxm3ou4lpt mnvta()a2ta( o;u4tptnmi3tltfm elnms (4 leoxr3iy1oatrai o () eto(r io1lmt miciatfa2ua( pot0tlt  ociltla2ea( o (4 rxoxf3iy1laD lues ( teurio iudlle  fctl(fsrumxrpnu1tleomf3tlslm emuvp u4 lxoifcoo1fpDeluvs t0 2tmxo3io1ol e fci tfs2ur(mo;u1oltomfeias m2ulnvpnt0alenmr iatfm rlieo t trxm(rpiy1ol elncsat)aDua( p;u0alto o3tytfsDeau p;t0tlenmfcty1faDr ieo;s0srxrio3nudamt lfes s)arua(  ot4altnmieils m elnvpn(0tetrmo iy1la rlivs (0t2toxmpiy1op   ietls arumxrooo1ope  ieiysfa2ea(vs u4tleoxr iotlmte ieo;t srxm(r3ou1lptnlfctl()sDuru pot4aeenioctysfaDemn pnu0artoir totomt ai o ( tetrxr iu1lpe  icsl(fsDta(rooo4ape moetltfa2el( s (4trerxrcoydoptr n il()trxo(opoo1llt livil(fsDra( oot1tpx mi3tas aDea(vp t0 etrio totoaDraivi;t sexrxr ny1lmeelnvt t  2rm(mpoo0oetniieiyslm ua( snu)aeerir oytfmtran o;()t2ur(mpou4lptelivsat aDra(rono0olt micilt m rluvp u4alxoxr3oy1fa   ivs t t2xm(o3iydal nlnctlt)aDtr(rp;t4opto oeildla2rmn o u)aexrio3iotfaDelues;s0trtrimpnu4apt lfetl(fs2ua( ono0texo oetad s2ra( p (4 ltrifciatlp rlivo;t  eur(opio4opeemnetatf rtr(rooo1texomo3iys s2emu p;t)arxnmo iatfp elivi;t) ruoimpnydlm emivs (  2ur(m ot0tee iieiat a rl( sn(0 eenxr todoa raueslt  2tm(o3iudamenmfviatfsrrm(r ou1tee mfetys s elnmpn()alxoxr iodfm ranvs;t s2xoxm3iy1ame lietat aDtrxroot0tlenmf3tlslmDuau s;t0 etomrcoo1fp r n slt)t2tmio io1lme livtls aDtauroou4olxnifciyt a eluvs t0aetrxf3ia1opt lu s ()trxm(mpoo1alt  ncsat)a2tr(m nu4openifcild a2uaums u0aeerio3oatopt li o ()sruoir iodal  liciatfsrtrxm ;t4alx mfctldfmDrlump (4tltrxf3oo1lptr u s;t)seumiopnu1omeemiviltfsDururp;u4aee miciat mDrmuvs (0alenxo3todfmD  n i;t0s2ur(r3iy1al e fesa()aDrr(r ;o4oee  i3iytlm2rlums u0artnmf iydomtelivs;(0tetmio3nodllee fcsl(fs2trxrp;t0aee  ieiyd aDul(mp;(0 rtomo oatfmDr uvo t  rum(mpoy4al  mivt t  2rm(rpno0tle  ietltla ua(mp ()alxrir ootfm  aiei;(0t2xrio3oodoleemncils sDuru o;t0ole  ocias s2ea(ms t0teerxf3to1lmtrln i s s2urim oodll  livil()srrmurpno1apxnioctaslm2eluvo t)trerxr iydfmDe ivils0srumxmpnydam n ivias) 2ta(mo;u1tleomi3ild s2emnmp;t4alxrxrcoy1lpDrlivi;s teum(m oodalt  netls aDurxmpot4olt ioeilt s elnvo;(4trtoxf3iadlmtrlnes ( s2ur(o no4ap nlnvs ( arta(m ;o1aet ifcilt a2ua( o;t4 exnmr3tadopt  uvi;s)t2umirpoy4om nlnci tf Dtrx p;u1oltoiieiyd s2umums;(4 rxnif io1fpteaues s  rxmio3ou1ll  lfet s)aDurum ;o0opeoiietlsla2uln o u)aleomrciydlm eaieils0texmxo oodamee iet tfartmu pnt4tetnmfcilt m2ulumo u)alenmr3iadlmDelu o t  exoxr3io4lm  lietls sDumxr ou1tlen o3iysfa rau o ()alxnio iydop   u ol()trtmxm3ny4amtelneilsfaDrm(mo;t4teto f3iydla eauvsnu)trtnio ta1oa   u slt setoim3nydam  lncs s aDtax  ot0opxniietydlm2rauvonu) etnmfcoo1fmDe iesl(0 exrir nu1lp nlnctlt)arrrxm ou4tpxo feiasfm2um(msnu4 etnxfcoodlp ran i s0seurir oydllen fciatfaDurur no4opxn feild mDrl( p (4alenifcio1fptr i sl(0 rxrxo no4lm emncsas srumu p;t1aexn ieilsfa el( ont4alxrir3tydfatrlivol(0t2xrim3oudop e ivslt sDua(r no1oex if3iyd mDrlumonu4aetnxf tadlptean o;s)truoxo3nodapee neslsfaruaxro;o4tpx mieiytlsDul( p;t0 ltomoctydlm raivils0setr(opiu1ll e fcias)artrump;u0tle io3iydfm2rm(vo u4aeermo3tatopt  i i;( trxmim3oydom nlfcsas aDua(  ;u4texniiciysfs emnvpnt4 rtomf3ia1oat  neo s0t2xo(r iydap e fetat  rrrumooo0tlx mf3ild mDelnvs;() exnir3oydopt aiesl( texoxr no4al e icslsf Dur(r ou1optnifeias s ra( snu4tlerxo iadfa rlu s;(  rxoio oy1lp  mivt s) rrrxr ;u1tltomfctltfaDumnms t) etrmociotop r u ilt0 2uo(o3iy4al  mictat)sDumxrp;u1tlxn octys s eaump;t0 rtnxf3oa1lmteli ols)s2trxrpiu1omtnlicia( aDtrumpnu1apx mo3tldfmDrln s u4 ltrxrctatoa r u ils s2xm(o3oy4lmeemfesas a2uau ont4tet mociyt s umu onu4texrio3ta1faDeaues;(0teuoim iodolenlfvsa(fa2tm(rpou1oleo ieildfmDum(mp (4 ltomo3ta1fmte n ol(0srxmxo nodop emfvtl(fs2raxmpnu4olx io3iasla2ea(ms;t0artnmfctadoptrlues s  rtoiopiy1ll nmicta(farumur no4olt iieilsla umums;t) lxnmo3iatlpD  n s s texrxr oodop nmnvs ()s2rm( o;o4tltoiictldlaDuaumon(4artomociydfaDeauvo ( s2urxo ou1ape mict s  2rrx poo4aet mfeiysfmDelnvpn(0tetoiocoadfpt ln sls)tetrxrpoudlp nlncilt aruaurpnt1aleo fciad s ran o;u0arxrif3oo1fatr ueo t)sexmir oudoltnlncs sfsDurxmpou4oeeo octas m emnmonu0 ltoif3iatfate ues;t) rxoim nu1op nmivsl(farrrxm ;u1olx ifeiytlm2umuvp;u) ltnmocta1fa eaivi;s0 rtrio io4olte fvils)aDrmx  ou4tpt ifeilt mDul( ont0 reomrcia1fmt ln i s t2toim3no1apeelivt t aDtru  oo4oexomfcils mDul( sn()texoxrcootoaDeaneslt t2xo(o oudlm   ici (faDurxr no4aleo o3iydfm rl(mo;(4 rtnmo oa1fa rlieslt sexmiopoodlmtn ivta(fa2tax  nu1ope io3iydls umuvpnt4 etnircio1faDrauvo s texmir3oy4lpt  ivils)s2tr(  nu0opt  oeilsla rm(ms;t)tetnmrcoodfa rlnvol( setmio iy4omen nesas)arurur oo1apenmfcilsfm elums;u) rxrmr3ta1lmt lu i s  2xm(mpiu4llte ivtlt a2urx  no1olen fctld m2rm(mo;u0 rxrir totfmD  ies;s)srtm(opio1ape mnvt tf rumx  ou1tle ii3ilt m2emu sn()trxrxo iytfaDrau i;(0trtoim iudop emfvta(fs2rm(ront0tex if3iatlmDrlnmo t)trenir3tydoatr ivi;s0 2urir3ou1lpeelnet sf 2ra(rooo0olt if3iatfa uanvo;t0alxrif oy1faDrauvslt0 eur(r iu1omtn fvtls) 2trxr ou4oexo i3ildls ran o;u4arenxocoodopDrluvo;(0s2xo(mpnu1lle  ics t s2uru pot4aeeomi3iasfm rluvo;u4tetrxr ia1fm e nei;()seum(o3iy4ap nmfctas)sDtrxmpno1olxoio3ildls2rmnmp;u) rerxf3oatfaD livi;t0 etoxr3nodop  lncs t aDtmur ou4tlxnmo3ias m2eau sn(4arxnif3oy1lmD anes t)seumxr nudlleelncia() 2rm(m nu0aet mfeiasfa2eanvp ()texoxr3ia1lptr ueilt)texr(m3oo4amt livt s  2tmum ;o1aptomiciytlsDra(vs;u0 rerio to1fmteauvilt t2tr(m3ou4ame mncsls)a2um(rpou4apeo ociad mDel( s (0 leoir tatomDraieil()sexoxm3ny4amtelieias  Dtauro;o4apxnmo3iyt a2uanvont0trermr oydla eluvs;s t2urxo3nudop e fesa(fsrtrx o;u1tpxnmictysfa2em(vo;(4aexnmf tytfmtelivo s  2tr(rpiodom nlnvi sfs2ururpnt1tleo oetad a2raumsnu)arenmo oy1omD auvilt0s2tmirpio4lmenlivsas srtau  no1tpt iietadfsDuln pnu4 rxrmf iotomDe ieo;t0 exoxr oo1omt mfvs t) rua( p;t4apx mi3tytfa rln s;t) ltnmf ta1fa   nvi ()texmio3iu4altn fesat srtr( ont1oeto ictad aDrln o;(4trtnio oy1fmDrauvi;()t2trxr3io1om emfviat) Drru pou1tlxnio3tytlsDuan pnt) ltoxr iodfmte nvi s)texm(m iy4ol nlnvs ()a2urxmo;u1aeeoiieiaslm em(mp u4 lxnif oadomDeauvi t  2urxo3nu4opeemfcil(  Dumxmpnu0tee  fetad aDua(mp t0trenio iadlp rlnvs s0texmxmpno1lpe mfvt tfa2tax  ;t0olenio3ilsla2elu s t0 rtrirctadfat liei;t srurxm3iy1lmtemivt ( srraumpou4teto octysla rl(vo u0tlenmocootlmteaieo;t trtr(r nudll nmnvs sfaDtmxm nt1tpt  ietyd s umu p t0aeeoxr io1lm rlnvs s)t2uoir3oo4ap   fctlt)s2rm(  no0oee ii3tys s ean snu)alxrir oytlmDrauei;t  rurio no1alt lfetl() rrrur ;u0tleoii3tltlm uanvp;(0 rtomf3oy1laDr ivsl()tetoim no1am  mici t)s2rmumpnu0ope mfctytfmDeau s (0tlxnxf ta1fat lnvsls)srxrxm3nu4lptelfcias s2ta( ooo1tptnif3iltls2uln on(0 lxrxf oa1oaDeauesls t2xo(rpny1lmte ict t)aDumxmp;o1opxn o3iat s rl(vo (0tetnmr ta1fmDr uvs;t0t2xr(r nu1am elnvs t)srtmu p;t0opx mi3iatlmDumumsnu0treoxfcoatom r nes;()srxoxm nu1amtelnciat)a2umurp;o4tltnmoetyt sDea(mo;u4 lxnmfcoo1fptraueo;s)t2urxmpoodlptn fcilt  Dtmu pno4tlxnmi3ilsls em( o (0aeerxo3ia1fmtr i i;t0t2xm(r3nodlptelfei s aruaxrpno4alx mfeiatfs2ulnmpn(0 rtomr3oa1latr ieo;s trtoxmpoy1lpte fvt () Drmum ot4opxomictadfs2emumonu4trtrircoydom e uvs s s2tm(o iy1apte fvsat sDtr(rpnt4olxo octlt sDrauvo t4 lenmf ia1fa   neslt0t2tmimpoy4oltemfvtasf 2rm(  ot4ole iieiltfs rlu p (0 reoifcoodlpD ln s;t srtrxo oy4lpe mfetat s2tr( oot4olenmieildlmDrmumo t4arxoxo oydfp elies;t s2uo(r3iydlltn fct (  rtr(mo;t1texn f3iltlm rlu s u) rerxr3tadom eai s t texrir3nu4olte nesl() Duax  ou1aetnifcilslmDumump u4aetnifcoadoaDr u ols)sexrxmpiy1oleelnvsat sDtru o;u0oeeoio3iyd aDelu p;t)teerxo3oydfatrlneils s2trxm nodlle mnei s)srumur ;u1tpen o3ilt s umuvo t0trxrmfciydomD lu i s0 rxoio3iy4aleelivi (f rur(m nt4tleo feiatfmDua( o;u0alenif3tadoa  lieolt0 2tmxmpno4ll e nctl(  Dtr(rp;u1olxn ieiatls2umn o t)tetrxf iotla elieol( setm(r no1am emivtlt  Drrxmont0ope iicias mDemn s;u) rtoxf ty1lp eau o;(0 eum(o ou1llt lfvs sfsDrmu ooo1olenio3ildfm2ranms u) reoxo ootfmteai ols)trur(rpoy4alee fesl(fsDtaxronu1alt iocildfmDrmnmo u) etnif3ty1oat an olt)teumxrpno4lle mivt s s2tmxr oo0tleoiieiat m2rm(vs;(0trxomrctodom   n ol()srxoio oudam nlici t) Drmu ont1tpenmoctat mDean o;(4trerif oatfpDraieol(0 rxm(rpoudop  mfetlt  2raumono4aee  fetldfsDraumont4teenxocoodoatelneo t0 2xm(opio1ol  lnvs tf 2ta(moou0oee io3tysfs2rmnms u0 rxomf3tydlmDrau ols0 exm(m nudomeelncs t  rtauroot1aex moctadlm2emu o u0aexrmf oytomDr u o ( srxoir3oo4lmeelnetls aDrmump;u1apxomictyt aDumnvsnu4areoif iadlatrln o;t)sexoiopiudoltemictl(fa2umxmpnu1tpt miciasfaDumums;(4alxrmr3iodfptranvi () rxrxr io1olee ics ( a2umx pnu0aee miciadlm rmnms;(0texnmo oodlm e ivi;s) rxr(mpiudll nmfei s) rumu  ;u0opx ifctysla rl(mp u0tetrmrcoy1la e i o (0sexr(m3nudalt mfeia() rraurpnt4oltnmfciasfa rmnvs u4alenmo3oydlaD  i o;t0tetr(o3io4am  micsls aDrmumoot1tee  ieild a uluvp t)tlxomr iydfpD au s (  etmio3iy1ome  feilt) rumumooo1tpxn o3ilsfaDelu s;(0 leoiociatlmDeanvilt) ruoim3oy1olenmfcil()aDurx p;u4aee mieiys sDul(vo;t0aetnif tydopt ln o s0setoirpoodllt miesa()srurxmonu0altomociytfsDrl(ms;t0trxomf3iodlp eli o;t  exo(rpnu4lme lfeiat)srrrxrpno1alenii3tydls em( pn()texrxr3oydfa eai ilt) rxr(opoydop elivtl()sDtrump;o0oltnmiciad mDua(mp (0 lxrxfciydomDranes;()t2trio nodlm emicia(fs2uauroot1optoii3tysfaDeluvs (0trxoif iydomtrln olt teumxo iodopt mivi s aDtmxrpoo1texoiietltlm ran pnu0 exrif3oytlp e iei;(  rtm(rpoy1apt mnvt t) ruaxm no1tee ifeildfmDrau o;t0 lxoxfctotfm eauei;t)tetmim3oodoptnlnctl()a2uaxrp;o1tlxnioeiydla2ua(mp;t) renxrcoadfpDrluvo;()setr(o3oy4optnlncsasfs2umu pnu1teeomf3ild a ea( p t) rtniocoydlm  anei;(0t2toirpnydapen netl()s2rrurp;u1tetnmieias aDrlnvo t4tlxnxr oadfptrlnvo;t  rxr(m3oodam  lnetltfarta(r ot4tlxn f3tad s2ulumo u4aetrircoydop  auvi;s0srxrxmpoo4ame  nvtas srumumpou4olt mf3tlsfs uau p;t)trxoifciatlp   uvi s  2tr(o3no4lmen fet sfs2ua(m nu4tpxomfcilsls2ra( o t0trtnmf todla e nvs (0srur(mpoo1llt  neia(fsrua( p;u1aetnmietyd a2rlumo (4altomr iydlaD  i ils0 2tr(m nudam   fvia( arur(mp;u1tlxo oeilslm2elnmsnt)artomociatlm r ieils trxmim no1oltelnetlt sruaxrpoo4apxo o3iyslaDeanmp;t0artrifcta1lptrln i s)setoim3iudol n neiatf 2rau pno4aptoifeiad sDrmu s t) rtnmrcootlpte ueol() eum(r nu1llee neilsf rur( poo1aetnmo3iyslsDeln s;(4texnmo3oa1oatr n o s)seumir3ny4llt  fctat  Duau poo1aex  ietad a rmuvp t) eerif3iydfaD au ol() rurir oudomtelfvsa(  ruauroot4tlxnmiciatlm2ul(mo u) lxrxfcto1lp e u s s)s2umir no4ole mnct s)sDurxronu4alxomf3iadlmDea(vs;() lxnxociatfpteln o () 2toxm ou4am nliviasfarurx pnu4tetnii3tasls2ra( s u)tltnmf iydlm e u o t0s2umxm io1lmte nei (fa2trum ;t1aleomo3ilslsDel(mp;(4artrmfcta1fmDrlnesl() exrirpoy4om  lnctlt srtr( ont1opxnioeiyd a2eau o ()alxoxo iotlpDe nei;s  2xmim oo4lmtnlnet t s2rmumpoo1tpxoioeildfmDrauvp;(4tlerxo3ia1lp  auei t)setmxo3iu1lleeliei s)a2taxro;u1oetoifeiytfsDem(von(4artnmr ootom  ln o s0seum(r oy4aptn ivslsfsrumxrpnt1oee  i3iyt s ea(msnu)aeerxr oa1fptelivsl()srto(o iu4apeemncsltf Drmu  ;u0aeto oeiydlm em( p (4areomrcia1lmDr uvi t0srxm(m3oodopte nvt s) 2rm( pnu1apt mictat aDelnmo;t0 lxrxfctatoptr ivi;(  2xmxm no4alt mfcsl( s2ua(mooo4aexo fetlt a2elu o;(4 rtomrcoa1fmD aivi;()setmxm3no1am e iesat) rrmxm nt4oleo ociyd m2umu pnu0trenmfctodomtr ieil()trtoiopio1lm elicsat srrmurpoo1oee  iciydla2ul(vsnt4 lxrxrcoatfaDraneslt0 ruoim3oydlmt  fciasf 2um(r ;t1apxoioctysfa2um( o (4 ltoxf io1op ranvs s) exmiopoydlp n nctltfa2ra(r no1olx  f3iys mDulnmo (0arxoxrcoytop eau s s s2uoim3oodlm nlicsatf rumur ;t1tee  iciydls rl( p (4altrxr3to1lmt  nvol(  rurxo iy4ope lietls srtru pno4olxo oetadfm2ean snu)texnxr3oatomte ieols0srurxo ou4ol emfvt t srrmx  ou1tpxn ietlslmDulnvo;t0trxrio iytom rlnvils setoxm3no1altnlncsl(faDumu ono1oexoiocildls2em(mon(4tleoirctotopt  ueo t0 rxoxopoodamee fvs sf 2tauro;o4tlxoifciltfm rmuvo;(0 ltnxf3oodlp e nvils s2triopoodlmt livia(fa2urur ot1apxo feilt mDuluvs;(0alxnif oatlpt anei t)texmio oudap n fcsat)arrrurpnt0altomiciat m ea(mo;(0 rxnmo3ty1faD ai s;(0sexrimpnydlmtemivs t a2umu pot4alxnmieiysfs rlnvsnu)altnircty1lat au o t)t2xo(m3nu1olenmnes s  rtaxm no1aeeomfciltla2uln o;() ltoxf3iodopDeanvs t)srtr(o3no4olt lfvtl( srtm(m nu0olx ifctad m2ul(vp u0 rtrir3tatlatr u slt0 etmxm3nodap e fciat)a2tax o;u0tlxomietatla2uan p ()texnxr iotoa r nvi ()t2urim3no4opt  ivt (  2um(rono1tlxo ieiyd a2eanvonu4 etrir3iadfmt aueo t) rumirpnu4llen nei s aruaumpoo0tle ifciysla ulnvp (0tltoir3todlmD lieo t srtr(o nudlp  lnciatf Dta(r ou4oexoif3tytlaDemumo;(0alermr oo1fptraivslt)seumxo oy4ap e ietls arrax oou4oee mo3iasfsDuanmsnt) lenxfcoytfp raieslt0sexo(r3oydoptelict (fa2tm( pou0oeenioeildla uanvs u0tltoxr iydlp r ivs ( srtoxo nydlleemies t)sDtru  ;o4apx ifeiaslm2um(vpnu0texnmocoadfmtelues s0 ruoxo3iydal  mieil( aDuaxrp;t1oeenmfetls m rau o;t4 eerxr oydlmt  uvi;t t2xr(m3iu4al  lfetl()srtmurp;o4apxoiociyslaDrm(ms u0 ltomf oy1oatrlivil(  ruoirpou1lmtnmfcsas srrm( oot1ape ifciytls2uanmsnt) ltnmfcoadoaDraivo;s trtr(m3oydop  lfvslt srtm( pnt1altoii3tltls elnmon(0 lxoxoctadoptean olt s2umim3oodop nliei (fsDrrxroou1opxniietldfm ua( o ()tltnmo3to1fmte i ilt0 rxmxopoo4ll nmfvt tfaDra(r ot0apxnioeiatfaDulu o () lxoxo3oatfa rlneil(0sruoiopny1ol nmnes ()s2uru o;t4optomo3tadls emnvsnu4tlxrmo3tadfa rauvi;t)teuo(r no1ope lnvt (faDurxmp;u4tpx  iciys m uluvp;()trtomr iatoatr ivilt trur(mpiu1amenmieilt  Draxmo;u4optnmociytfmDemu s (0 lenmfcty1lm eluvo t srtrir3iudomen icias arrr(rpoo4tlen icilsfs rln s (4trtnmfciodfm ran il(  rurxopoy4am e ivilsfarrrur oo4oltniiciyd sDrmn o t4trtomo iy1oat ln s;t0trtmxm ou1lmtelfci sfarurur no1tpe mietldlm ulu sn()artomrciotlptrlneilt)texo(m3nodam  mivils)a2uru pou4oltn ieiltfs2eluvsnu4 exoxo3ty1lmDelnei t)seum(m3iu4openlneta()arua(rpnu0apt mietatlm2ulumsnu0treniocoodomteluvo t0 rxrxo3oo4llenmneilt)aDraumoou4aexnmf3iadls umn p;u4areomo iadopDeanvs;(  2urio nudlmeemivilsfsDrr(r oo4tle if3tytfaDumuvs u) rxnmf3oydomDeanvols)t2xrirpiy4omtelfvtat)srtau  nt0ope ifciat m2el(mo t) ltrmo oa1fa elies;( sexmxo io1lmeelivs tfsrua(  ;t0openiictlsla2ea(mp;(4trxoxfcia1fm  lieo (  2toxopoo1omt mnvias srtmxrp;u0aee moeiadlaDel(vpnt)artoxo oo1op e u i t0trxm(r3nu1om  miviat  2rr(m ou4apxoio3iadfmDumu snu4aetomf3ta1fpt  ueo;s  rur(m3io1om  lfvsa( sDrr( pno0apeoifciytfsDemnmpnt)trxnxrciytlpteau sl( setmxmpiu1ol   fcsas)arua(m nt4oet iociatfa rl( p (4aeeoxr oy1lp  aivolt) exoxm3iodalen ivias  Drmum nu1apto iciyt aDuln on(0trxoio ta1lpD auvols  rtoxmpoudome lnesas)s2tm(m no0teto feiltla emuvs;u)trxoif ty1fmDean i;t t2umimpnudam elnes (fsDtrx  ;u1tee mieiltfaDelu o;t4teeoioctodoate u olt trxr(mpiudapee nvi sfartmxrono0optoio3tat a2emn p u4 etomociydomt livils)s2uoirpiudop emfctls)sDtrxrpot0oexoii3iad m rmn pnu) lxoio oatlmtrau ils  2xoxr nodal   feta( aDua(m ;o4aptnmiciys m2eln onu0 lermfciodoatr i ilt trur(m oodlp   nctas sDrax  nu4oexnmf3iatfa2umu on() rxrmo3oy1op eliei;( teumxm ny4lp e neslt)artm(r ou4opt mf3ilslsDrau o (0teenxr3ia1laDeai o;s0sexmim3ou1ole lnctl( srtrumpoo0opt if3tldfaDuan p;t)aexrxr tytfmDelnvi;s)srxr(rpnu1opee fet (farumxroou4oet  octytlm2uaump (0 rtrxo iatlpDeliei t texm(o3io4ll e netat)sDtaxronu0optniociltfa2rm(monu4aeerxr ootfpD an i (0s2umxr no1al   ncsltfartmxro;u4texn i3tasfs2ean o t4 rxoio iydlaDelneo s  2xr(m no1lmeeliet t arrm(rpnu0tpxomo3iatls rm(mpnu)alxnmf tydoa raieils)t2xo(mpnu4lmtemivs (  2rr(mpoo1tltomiciatfsDem(vpn() rtoio3oa1opte u o t)seum(rpnu1ap e ictas)srrmur ou0aet ioctysfaDranmp () rxrirciy1fmDelnvi;(0t2uoio nu4opee fcs sf rrrxm nu4oeeomoetatla2rm( o;t4 etoxf3tadlat lnvs;( truo(o io1lle lnvtas s2trurooo4tlenifeiatls2rmuvpnu) rxoif3oydfa  au olt)setrimpoo1lptemivtas  2umu onu1oexomi3ils sDemn s;t)aeenmocoodop elnvs;(  2ur(o3nu1lpt mncsas)srrm(rpno4texn fctad mDran o (0arxrxf3iytomDe ivslt t2tmio3iydlpenmictls srum(mpoo1optoifeiltfs2rlnvo u)arxrifciydfpDeaivs t s2trxmpnodom  lfcta(fa2umxr ou4oexnmiciatls2ua(ms t0 lenif3io1optr uvi () rtmxm oydop e ivi (fsrraxmp;o0oetn ociysfa rlump;t)altomr3tytoaDr uvo;s0 eur(m nu4amee ieslt) Drrxmo;o0oexnio3iatfa2elumonu)trenxrctodlpDelivs (0trurim oo1apt  fvs (fs2ra( oou4oleoiocilsfs eaumpnu)trtrir3iotlatrli il(0 rxrxo nu1apt  icsl(fa2trumono4oexnmfeiatlsDrln s;(0 lerirctotfmtrln o (  2tmxopou1apt  feta(f Dra( oot1opx io3iyt a em( s t0 lermocoydlp r ivo;s  euoir3nu4opeemicil( artau poo0aptomi3ilsfmDem(vp;u)teenirctadomteaneo t)texoxrpiodaptnlneslsfartrur nu0altoiociasla el(vs t0 rtrxf3oydfpte ies s  ruoir no1altelfvil(fa2ur(mooo1opxomfeiadfmDuau o;u)alxnxrciadoaDe ieil()trxo(opoo1lpenlicsl( s2uaur ;t1teto icils mDea( p;(0aexnifcoa1oaDeln i;s  2xmio3no1al nlivils) Drru p;t0ole iictlt a2em(vo;u4 ltomo iotomtrau s;t0 2to(m nudam   ncta(fsDtruro;u0alx  f3iaslaDel(vo t0 rxrif ty1lp e uvi;(0 rxrxo ou1ll n fcs t) Durxmont4olxoiocildlm2rl(vsn(0 exnxo3iy1oa  li s t)texmxr3ou4lpt licsasfsrtaurp;t1tpxo o3tad a2um(mp;t0trxrio iy1op eau i t0 2trxmpnodop nmfciat)sDtaxmpnu1olxomietadlmDeluvp () reoifcoydfm rlnvo;s0trtoxo3oy4ameemivt (fsruaxmpou1oltoioctatls eau s;u4tlxnmf iotoat aueils0srtr(o3oudam nlneias aDra(  ot1oltnmoeiytla2eauvpn()trerif3oo1fa   ivi t0 rur(o no1aleemfci (fsDuax  ;o0tpx mieiys s rm(vp;t4artrir3ty1lpt li o s)t2xmxr io1lme lfei s) rrmxm ot0tpeomietlslm2ua(mo;u0 lerxocoodlpD  ivi s0s2xrxmpiodam e iei sfsrrr(rpot1tpeomfcilt mDeauvp t0 eerircio1oaDraueslt0t2tmio3oo1ape mnesasfsrraxrp;o4aee  o3iadla2umnms t4tetrmf3oodomt  nes t)t2trxo3iodllt livslt) 2trxront4oet  f3ilsfaDuan s u)trenioctytlptelivol()srumxm3iu4ap e feiat)sDumx pou4ope  o3ias m ra(vp;(0alxnmrcto1lat anvo s s2toiopoy4ll  lieslt) 2rru onu1tlt ifciyd s umnvpn()aexrmfcoydlaDeaivs;t0t2tr(r nodamtn fei t) Drmx ooo1oexnmicildls2rm(mont0tlxnxoctydlmDelnvols teuoirpiudapenmivia()a2rm(roou1ole iicilt a elnvo () eerxfcoytfm rau i t0 2urxm3io1ol nlfcsls)srrrx o;t4tpenmoeias mDumn onu4aexriocootfmtelu o s)srtm(opiydope mfes (f 2trxmpot4texnmoeiytla eauvp;u4tlxrmf3iytlmtrlu s;()texr(r3nodllen nvil()arraumo;t4alxo ieiyd m2umuvont0 renmr3iatfmD ln o;(0texr(r3ou1altelfvil( aDtmumono4tpeomo3tytfa2ra(mo ()artrifciadfpDrli sls) 2uoxr ou1ap e netlsf 2tr(mpot4texo ociat m rl(vp;u4 etoir io1op e ieo () exmiopoo1ame  fetat srurxmo;u4opxnmfetysfaDelums;t)treomfctydla elnvo;t0s2toiopoodal elfvslt a2tmurpno1oltnmiciasla2ranvs u4trxniocio1faD aivi;t)trtoxrpnu1apt mfci t a2rmxmpou1tle mf3iadls2umnvp (0 exnif3to1opDe n o (0 2ur(m3iodop  mfvilt srtaur no4olenmf3iadlmDelnvp (0teerio tydop rau ils0truoxmpiy1lltnmfctat)s2rmurono1tpe ii3tatfs2eaumsnu4areriociytfa rlnes;s  etoimpio4altnliviltfsruaxmono1alxomo3iyt a ua( p (0 etnxo tadlat an o;s)seurxm no1lle mici ()s2taxmp;t4opx ioetytfm rlnmonu4 etrir3oo1latrauvo ( trxmxo3oo4ameeliet ()s2taxroou0aeeoio3tyt mDeaump u0areomf totop rlnvol(  eurxm3iu1ap   iet t) 2umx pou4opt  f3iadla umnvp;t0aetnir tadlp r uei;s srurirpnydlleelfvi ( s2uaumpnt4tpt if3iadfaDrmn snu4aexnmo tytlptr i o;t t2xo(o iudlmtelieil()sDtm(r ou1opeomicildla2ul(msn(4arerio iadoat anvsls s2xo(m ny1amt  fvsltfs2tr( p;o4aeen o3tat aDemn o t0altomr3oadomt  neilt0srtmio no1lpt  nctlt)a2umuro;t1aptn oeiadls rlnvo;t4altoxo iotlaDelneo;t0s2xmxmpiu4amenmnei s) Dtmuro;t4tetnmiciydfs uan s (0aetrxfcto1fa r neo s0 ruoxm iydame mfet s) 2rrump;u1oeto octydfaDrluvsn()trenmf todopt an s (0texmxo3iu1op e ieia( sDtrxmpot0aetomieiys s ean s u4 eenio ia1oaDe u i (  rurxmpnudole  ieia(fsDum(rpnt1apt  oeiatlaDeln o;(0 reoxf oytlptr nei;(0 rtrio3oy4lmtelfvi t  Dtrxrp;u0optnmf3iys aDrl( p t4 ltoio tadoa  an i;t sexrxm iu1ope  ictlt  rtru oou1tpxomieilt sDra(mp t0trtomfciydomteanvi ( texoio iu1lmtnmfeta(faDtaxm nu4alx mfciltfa um(monu4altoio3tatfatelies s0seuo(r nudlpt  nciasfa2ta(rooo1aexomociytlsDrlu on(0teenxfcoo1omt lnei;t  rtmirpoydlme mivsatf Dtru p;o1ope iociad s ea( s;(4teeoio3iatfp r uvols texr(m3iu4ale livi sf rrrx p;o0tpt mf3iytfm2rm(mo t0tlxnifciodoaD  n i s0s2xmio3oo1lpe  fvtl(  2tm(mono4optn o3tadfaDulnmpn(4tlxoxfcoatlptean o (0 rum(rpoudop nlfctltfsrrmxmo;u4oee mieiys sDra(mp;u0 lxrmrctodfa eauvi (0 exoxrpiydapt  neil( a2urum ;o0tptnmi3iysla rlnvp;t4tetoir tatlp e u i t)texmirpnu1op  mneilt sDua(mo;t4altnif3iytlm ua(msnu4aetrxf tatlate i i;() etoxopno4apt  neils) 2taxmp;t1opxn oeiatfmDraumo;t0 rxoio iodoatrlnvo;( trur(o3oodame mietlt)srumuronu1tltnmoeilslaDraump;t4texoxr tytfmtr u ol(  rxrxrpoo4lp  lnet t  2umxro;o1apx  f3tyt m2ea( o;(4aetomf iy1fpDr ivs ( t2tmxm3ny4apenlnesasf Drau p;o0alto o3iysfa2umumsn(0trtrxr3iydop r i s t0 etoxopou1ape lncslt a2tm(mpnt0tptomicildfaDran p (0aexrmo3oodlpt lneo;() rxmxmpnu4opeemneslt arua( ont4olx mf3iad a2elnmo;t0trxnioctodomt livo s  rur(o3ny4optelivtlt aDur(mp;u4optniietysla2ea(vs;u4 lxoif3tytfmDelnvo s0seto(o3ou4lp emfesat sDum(mo;u0tlx io3tadfm2ua(vo;t)alxomf3tatlp  lueil() eurxr iu4amt  ncsl()aDurxrooo1oee  o3tadla emn o ()tlerxr iodfm e ies;s)t2xmxo io1ape  ieta(f Dtmx pno1ape mi3iasfm ulnvp (0aetoif3ty1om e u s;t trtr(mpnydlp elfcsa(fsDrmumo;u1tet  fcilsfm ra( snt) rtrxfcootlmD aneo;(0seurxr3iy1lptemietat)s2tru ont4oexnmf3ildfm umuvs (0tlenmo totfpD aieils srtrxrpiy4al nlfesatfs2taumo;u1tee  ociasfm2uau o;t)alxnmfciydfptrlivol(0t2umio oy1lpeemicta(faDumur ot0texo o3iatlm umuvo u4altrxr oadfat livol()t2uoxo oodap nliciat) 2taumpoo0oexniiciatlm2ean s t4aetnxr3oodoatr u s;s) etr(m3nu1optnlfvi (farrmx ooo0aptnmoetaslmDuluvo () reoir ia1opDrlivi t0sexoirpiu1am elivsas sDta(  ;u4apt mieiasfsDum(vpnt0 rxnmrciotfatrlivs;(0 2urimpoudol nmfet s)a2urxm ot4tptnmfeilslm2rmuvp;u)texnxr oo1la rlieols0 rumir3oodopt mfei t)s2uaxmp;u1tptn o3ils mDemn snt) rtrio3totoa  li sl( t2ur(r oydlpt lietatfarum(  ;t1oetnioetltla2rmn onu)tlxomr3to1oa r i o s)s2xrirpnydol  mivi tf Dtaxr nt4apx mf3iatlm2uanvsnt4 lerxr oatfpDrai o (  2xriopoo1ap nmnetls)sDrrxr no1opeomoeildfm2emump (4 lxomo3oa1op ran o;t) rxmxr iu1omtemnet s)aDumxmoot0aetomf3iydfa rau snu)alenioctodopt ln i t  eto(opio1ap e ieslt  Drrxm ;o1tpt mfeild s umump u4aleoir oa1oa rlivs s0t2umir iodom nmfei ()sDtrxm nu0tltomfctysfm2rlnmsnu0 eenmo3io1fptrluvo;s)sexo(opou4ll emnvta(fsDumx p;u0opxoifetysfa umnmo;t0areoxo oodlmtrlnvslt) rurxo oy1apt mivia( s2um( ooo4opt  i3iat s2rmuvpn(0 eeoxo oydlpt  ueol(0t2trxo3no1am nlnesas)srumumpno4aleoiociyt a2el(vonu0tlxnmocoytfpDran olt0teumir iu1lmtn feia()s2ururpnt4oexomfciyslaDemnvsn() ltnir totopD anvs t trto(m3iydom nlivsl( srumu pno1tptomoetydfmDuanmo u)aetoxo oatomt an s t s2ur(opoudal e nesatfsrtaxro;t1oexo f3iltfaDul(vo u)teenxr oatfm   ueolt0trtoio iu4openmfcilsfa2taxmo;o0olxnifcild m rln p;t4texnif iy1fmDeaueol()tetoim3nudll e nvi s) 2ur(r ot0alxn ictasfm umump;u0aexnmfctadlm eanvilt0sexrim3ny4optelncs sfarumuro;u1tlxniicilsfs umuvsnu)tltoif iatfpD an il(0 euoxr3io1lptemncilt  rtmu poo1tptn icild aDumn sn(0alxoxfcoodopDr i i;t)t2xo(r3iudoleemfvi tfs2rmur ;t0tlenifctys m2eauvp;(0teenmf tytlm e ues;s) 2xmxmpiu1alen nctltf 2ua(  ;o0ope mi3iltla eauvs u4texnxo3io1oa rlivi;()s2toim oy1open feiat) 2umu  nt1tleomictat a2ranvont) ltrmo tadla  aneo t)srxoxrpno4ll   ncsa( s2rrx pnu4apenii3ils m2ean p;(0 lenxr3ta1la  ai o;s tetr(m3oo4olenmfesl(  rurx pnt4alt  fcildls2elnvsnt0 etomfcoo1lpt lnvo (0t2xrxo3iu4ameemics t)aDtm(mo;o0alxnmoeildla uln on() rxrir3iydlmDelieils0setoxopiydlleelnctlt)sDrrurpot0ope iictadfa rm( o u0alerxfciy1la e ivils0 exoxopoy4am nmnei s  rrr( ont1tetoifciltlm2ulnms;t)tltomr3oy1lp e u i t0s2toim nodlmtn fcs (f 2uau ono1tle  feiyslaDumnvp t4trxnir oodfa  lueo t0s2xoxm3nu4ameemieiltf 2uru p;t1apxoifciydfs2emnvo u) leomfctatlptranvs;s0sexmiopny1llen neta() 2tmxrpot0aeeo icilsls ul(vont)arxomf oytlp  luvs s)trurimpou1ole  iesasfa2uax ono0tet iociatls2eanvo t4aetrxr oytopt auvils0 2xmxr iy4llen feslt)srur(mp;u1alx  fctyt m2eln pnu4tlxnir3to1om ranei;s0seumio oydom n fesatf Dumumpou1tlxo f3iyslmDrmnvo;u4 etrmr tadfpD  nvi;s  2xo(o nodaptnlictat) rtmurpot1tltomo3ils s um( o (4tetrifciadlpDrluvi t)teumxrpiudope  fvtls s2ta(mo;u4oeenmieiysfm2uaumo;(4 leoircoo1omDr u ils  rtr(o oo4opee ivi (fsDtmx oou4oltnmi3iytfs uan onu4texoio3oydoateaiei s)t2xrxopoy4lp nmfcsatf Dtmum oo1tle ioeias a eaumo t0tlxrxociytomD lnvsl(0s2toxm no1ol n fvsatf Dta(rpnu1tpt  o3ild sDranmo;()trtrifcoatfpDr neo;t s2trxm3no4ll nmnvi t srra( oot1tltnioctys s emumsnt0texrmr3todlptrluvolt) etm(o oudopee ictasfaDtrx ooo4ape mi3iaslaDuanvsnu0 lenmf tadoaDe neilt srxmxopnodlmt mfesat)artaur oo0opeomoeiad m eanmont0 etnmo3tydfpteaiei (0sexoiopiodale  nvtl(faDumxroot0tetomociltla2umnms t4aeeoio tydlm   u s ()srurim oydoleelfct t a2um(mpnt1tee ii3iasls2emn o;u4trxrir3oy1opDr ivil( teurxmpny1omenlieias)sDur( ont0tptoiiciat a ra( ont) ltomfcoodoa r uvi;()setmxr io4lm nlneia(fsrrrurooo4tee  ictydls2el(vo;u4trxoifciytfp eanvolt0srurir3nu1ameemncslt  rtaxroou1tleoiictltla ua(msnt4aeermo3ootopte nvslt)sexmim3iy4lpe  ivil(fs2rmu pou4aeeo f3tadfs2ea(msnu0 exrxrcia1omtrlueol() 2tm(rpiu4al  lnes s) 2rr(r ot1ope mo3tltfm rmnvpnt) eerif3oa1oa r nvs ( truoxmpio4omt miesat  Drmxroou0tlx mfctadla rm(mp u0texrmociodfmD  i o s0trxmir3no1omtnlics s)aDtm(m ;o0olto fcilsls2em( p;(4arxoio3oydom e uvs;s trumxr oy4llenlicil(  2urx  nt1apeniiciad m rl(vs t) rxoir oodla r n i t  eurim3iydamte fcs t)sDum(m ;u1apx mf3ilt m2emn s t4tlerif3iadoatraivo s) exr(mpnu4optelneia( a2urum ot4tpx  fciytfs2uaumsnt0trtoxf3iadlp rln i;t srtrirpiodamt miviat)aDtmxro;t1alx  ietadlm rmnmonu4texrmocia1omDe u i;t)teum(mpnodlmtelnvil()aDrmu ont1alen oeildlaDelu pnu4tlerir3iotom eaneo s0 rtmir3oo4lpe  ivsls) Dtmu  ;o0tlt  oeiyd s2elnmonu)trtoif oatfa   ieo t) ruoxm3no4lltnlivsa()sDrr( p;t4oeeniicild sDel(mo;u0 etnmr ootom  lues ()tetmxm iu1lp  lfei t)aDta(m ;o1texnmfcilsfaDua(vpn(0texoio3ia1fmtr i o t t2toir nodam emnvs () rrmxr ;u4tpxomietasfsDrln s u4tetrxr ta1fa  lu olt0t2xm(o iudamenlfes tfaDur(mpoo1olenmoetydla emuvs;u4aexrif3tatopDraieo;(0texoir3oy1lp nmfcs sf Dtau  ;t1apx  i3ils a2rmnmon(0 eenmf3oytfp eanesl( trxoxmpiydlpenlnvtat)sDrax pnu0alxnmo3tas m ea(mo u0trtnxrciy1omDeluvo;t) 2tr(m ou1omtn fvilt)s2taum ;u0tltn ictas aDrmn s t0aleomr3iytfpte nvo;s)sruoxo iodlp emivslsf Dta( oou1oltoii3iytfsDulnms;t) etoir3iotlp e neols0 2uoxm3ny4lle  fvilt)srurxmo;t0opt mieiasfaDem( ont)alenmfciydoaD anvolt)s2ur(opou1alenlfcilt  rtm(ront4opeomfciltfmDuln o;(0tetrifctadfp rlivo;s)t2toxo ny1alte nvsls)arta(mooo1optnmoctad sDuan o (0alxnio3oatfate i slt0teur(o3nydlpenlnvil(f Dtru  nt4tlen f3ilslaDeluvs u)aexnirciodom rauvo;t0setmim3oydal emfes tf Draumpot1altnmfetytfs ra(vsn()artoxf3iydopt ai i;s) 2xmio oodol nmict s  Dta( poo0alt  ictldfaDrmn s;t0altoio3oo1la rln i;t) 2uoimpiu4lpen fei s a2rm(mp;o1teeoioctys mDulnvo (0 rtrmfcootopt livs;() 2tr(o3ou1lptemfctls  Dumxmp;o0olxn ictas m2ul(mo (0trxnxf oodopDean s;t) etrxrpiudom n fvs () 2umxmpnu0opxn f3ilt aDeanvs;u0arxrxr3ty1opDrlnei s) euoxm3oy1lp elicta()sruaump;o0teen octys sDrl(vs;u4 etoxo3ootopD anes t)srtr(rpiudomtnmfcsa()s2uaurpoo4aexnmf3tadfa2eanvp;u0trtoxo iy1fmt aneslt0trtm(mpiudomt mfct t a2rmxrooo0oexo f3iydla2em(vp;t0 eeomociytfaDr neils sexrxr3nu4amte fvs (  Drr(mp;u4apx  fetysfm uaump;t)tltrxfciy1lmtraivo t)teuoirpou1optemictat)aDum( p;u4opt if3iydfs ran o;u)areoxrciatoa eanvo ()s2ur(mpoydlm e fcsls s2rau p;u4optoifcilsfm2eaumo t)areomfciy1fpt anvo;s0sexr(m3iudome lfctlt)s2tmum nt1oltnii3tldlsDrmnmsnt) ltrmrciadla rluvol( s2umio oodlmt mfcsl()artaxmont0tetnmo3tyslmDea(mo;t4tetnmfcoadfmtr u o s  2tr(o3oydaleemnctl() rra( pot1tetomoetltfa rlums (0alxnmo iodlp ranes;s0srtm(o3oo4lpe mivsat aDrauro;o4ole  ietld s2ea(mo t4trtnxr ia1omDr neo;t)srxoir oo4al   fcsl( aDra(m ou4opeomfetyd m2um(mo;u0alerxo io1lpDrluvs t0 2toim ou4lptnmfcils  Dumum nt1oexnmociysfaDeau s t0tlenmrciodopDr nvs;t sexrim oydam  mfvs () 2ur( pnu1apeomfetyd s ul( p t0 rxrxo ootom  aieslt) 2uoxopiydam n fcs ( aDuau poo0apeomfciadfa2elumo;(4trenir3iy1fm  ln i;()srto(o nodap emfetasfsDtmxro;t0oex  i3iadfm2ulnvpnt0 ltrir oytoptrauvo;( t2toimpio1lpee iet t)sDumumpnt0alxnifctadfaDemu o;u4alxnirciatopD anvil( trxmxr3iu4amt lfciat arta( o;t4aexo o3tyd a emu p (4 eerif todlpD anvs t) rxmxopnu4llt lnvslsfsrua(rpoo1aptn feiasfs2eauvs t0 lxoir ootfm r u i;s0srurim3oy4al   ivi () 2rmum no0tlxnifctyslmDumumo;t) eeoxf3ty1omtr u i (  ruo(r3oy1ap nmfei (fsrtmumpou4tlxo iciatfa rau p (0 rtrioctytfmDe nvslt0 rur(o no4opt  fcia(fsrtmxmo;t4aexn ictys s2uau s u4 rtrirciadlpD  ueo s0teum(rpiy4lmenmici s sDraxrp;u1apxnifeiyslm rlnmsnu0tetrir todfptrlieol(0 rtoxm ou4alt  feta( arumu  ot4olen icildfa2uln o u4aetnmr todfaDraues t)setoxo3ou1omtnlfct t aDtr(rp;o0tptomi3taslaDem( p (4tltoxf oo1omDrauvo (0 2urxmpio4lp elnci ()s2raxm ;t1tltoifeiad sDulu sn(0aexnmrcia1fpD  ueils tetoio oydomenmnvsa(f 2trurono1tle ifciydfs2uauvo t4tetomociy1lpteli o (0srxoir iudalteliviat a2rmxr nu4tpxnmfeiysfm emuvs;(4trxnxo oadfmDr n il(0setoxm3nu4omtelfct (fa2trxr no0oeenmociyd m2ua( o u4 lxrmo3to1fateai ilt)teumxo3ou1alt lfeta() Drmurp;t1teeomi3iasfmDua( onu0 lxrmf tatlptr i i;()srumio3io4lleemfcs ( aDuaumo;o4tpx  o3iyd mDrluvo t0 rtnxf to1fatrlu sls texo(o3ou4llenliesat srrrx pou4tltn i3tydfmDuaumo (4tlxriocia1fpDraivs s0s2trxmpoodlle lfciatfaDrrxrooo0ale mfeiadlmDuanvont)artrmf oatlp r uvs (  2uoxo oy4al nlnvsasfarua(r ;t0olxnmociys sDem( s;u0tltrio3oatomtr i o;t  2uoir3iydlm  mfeta(  rur(r nt1ope mf3iasla eanvpnu4 eenmr iydoateaiei;s tetoir3iu4ol  lfcs (  rum(r ot0oleniicildla emnms;t)tetrircoydoaD  uvs (0seurirpiy1open ivilt  rrm(rooo0tlenifciadfa2rlnvo t)aetrxf oa1lpD luvsl( t2xo(r nudape mnesasf 2ta(mpoo4tpeo octldla2eln on()aeeoxr3tadlm raneols)t2xmio no1ol  mieia() rum(mp;o1opxoifeiytlaDuanvo t0aeeoio ta1late nvo;t0seum(opoo4ap nmneslt srrmur ot4tetoio3iadfa ra(mp;u0 ltoio3oa1lpt auei;t s2tm(r oy4am nmncsatfarta(mpou4tpeo ociysfa2rmn o;()artrifcty1lmDeaueols0s2xm(opoydlmtelnvsls  Dta( ont0apxnio3ildfs2eauvp (0tlxrmo oatlat  ueols0s2umio3iudalenmfctlsfs2urx oot4oex  i3tldlm2umuvo;u0texoxfciy1lpD li i t0 etrxm iu1lptemictlsf 2uaxm oo4teeo ociat s2rluvont) rtomo oo1optraivo s)setm(o io1alte nct tfsDraxro;o1apenmieias aDeln pnu)trerir todfpteauvi;s0srtm(mpiy1lmt lfei (fsDum(  no1tltoii3iatls2rln s;u) rermf3ootlmDr i i;s sruoir nudole lici s  Drmxmp;t0apx ii3iatlm2rm(mp;(4artoioctytfptr iei;t0 rumxopiy4om emivi ()a2umu pno4altnioeiad sDumump;(4trtoxf ta1lpD luvols trtm(m3ou4amtn fvs ()artrum nt4alxoif3ildfm2emuvpnt)tlxniociotfaDeai i t  etrir iudopte ivsat)srtru ono0tlxomiciydfm ea(vo;(4trxrmo3ta1fpD lneo t)teumim3nydopt  fcs () Dtr(monu4ope  o3iys m2rm( pn(4aexrif iytlmD au o;t  2trir3nu1lpenlivs ()aDumx p;o4tetoiieiydlsDumnmo;()tltrxr tatfpte n s t trtrim3iodam   nvs sfsDra(m ot4tpt  fctadfs rl( s (4aetnmf iatfp  auvilt)t2toxm3nydole  fct sfaDrrurooo4tet  oeiltls umn s;(4 lenmo3iydopte ues t texo(o3oo1omtemfesas srua(mpno4opxn icias aDeauvp t)tetoif totlatraneslt  exoim oy1olt lncil() Dtrxmont4aleomoeiadfsDumu sn(4 exoxo3oytfmtranei;s trtrirpiu4lle  fcsatf rtaur ;o0altnif3tltfa2el(msnu4 renmfcoy1fa  li o s teuoxrpiodole  ivtls s2rru  ;t1tpx  f3tydfsDrmn sn()areoifcio1la rluvsl(0 2xmxmpiu4ale  ictl(f 2umu oot1oleo oeiyd a2rm(mp t0 rxrmo oadlm   ivsl( t2uo(r3oo4ome livilt  2rauronu4oleo fcild a2ul(mo;u0 eenif3iadfpt an o;s)srxoxmpio4amen ncia(f rumur oo4oet iieiatla ra(von(0altnxf3ia1om   uesl(  2tr(r3iu4lm  lfct sfarrrump;o0tpenii3tld a uln s u0tltomfcoy1lp  li il(  2toxr oo1apte ivsat)a2um(ro;u1tle  o3tat sDel(mp;u4 leomf3io1opDr ivilt0s2xoxmpnu1ll nlnvs s)arrrxmono1olt ioeildfs2eanvs;t0 lerxf3ia1lpteau il( s2umxm oodlpenliei tfarua(  ;t1ale mi3tad aDemuvp u0tetrifcty1op raies;s)t2um(r oydamtemiet t aDtaurpot0apxn i3iat m rlnvo;t4trtrircoydomDranvilt0s2xoxmpoo1lp elfci s)a2trx pnt0olt mocilslm ua( snu4tetnxr3oatla elivs;t sexoio3ny1llee fvsat)s2tau p;t1texnmi3tysla rauvon(0 rxrir3ia1faDelueol() 2tr(m iu1altelfcsas)sDum(mp;u1aet iicilt sDuln snu4tlermf iotoaDeaueo (0sexmxrpiudom n icsltfa2uaxrp;o0aptniieiadlm2ra(vsnt0tlxnmfciy1fat  u olt)s2xo(mpiudllenlictl(  Dua(  ;o1oexo feiytfa2ulu s;t4arxoxr3tadla rlneils0sexmir iydoleemfvtat a2tmurpno4alenio3tysfm eaumo;t)teerxf oo1faDeauvi s setoxr nydalen nvs sf 2uaum ot0alx  icils s2elu p (4tlenio iadlpD  ieo s0 2ur(m3nu1omeemnvslt) rtmu ooo0opxoif3iasla em(mp;t0tlxrmr3oodfat ln o;t)trxoim3ny4op  mnvt ()sruaxr oo0oexomieilt mDumu onu0aleoxrcoo1lmDelnvol(0trtrxr iudllt  fvilsf 2rrum nt4tlen fctlt m ran o (0 lenxfcoy1omD aieo ( srxrxo3iudamt  fvtatfs2uaxronu4alenmoctas sDrlnvs;u0alxoiocoodfmDe ivi;(  etoxo3nu1am e ietltfsDra(  nt4alxo octad s ra(msnt)teenmocoy1faDeli o ()s2xmiopoy4ol emnvslt srrmxrp;u4texnmi3iatfm elumo;(4tlxnir tadlp elu i s)t2xo(o3ou1omt  fciatf rtrump;o0aetnif3iat mDrm(vs;t4 rtrmr3iadfp r n o;() 2toir3oo1amt  ics t  Dtr(  ot1oee  octlsfa2ranvpnu0alerioctatlm  aieol()t2xr(r oy1ole mfcslt)srtax ono4tltomi3tlsfm2um( p;u)aleoxociydomtr ies;t)trtr(r iu4am nlfetlsfs2tmu ono1aet io3tyt a2el(mpnt)tltoir3tytlm   i ol(0s2to(rpou1alt mfvtls  rrrxroou1tlx mociysla2rl( snu4 rxomfciytfat  nei;( trtmxo3iydoptnmfvsatf rtm( ono0tpeo octldlsDuluvo;(4trermr3tytlmtrauvo ()seuo(rpoo1lmt lieiltfsrrmxronu0olt mietysla2ulnmp t4 etnif ta1omt ai il()trurirpiudom e neias srua( oot0alxnio3iytlaDrmnmont) rtoir oo1fmt lnvsls0t2urio iydalee feilt arrm( pno0apxn fetadlmDulnmp;u)teenxf ta1lmDraneo () rxrimpiy4amen nvsat)a2taum no0tpeomoctltfaDrm(mp t0tlxoircto1lpteaivs;s0 2xo(r ny1om nmfci sfaDtr(r oo0tpe ii3iydfs2ul(vo u4trtrxoctytoa eli ilt0t2tr(rpiodlme  netlt sDtrumo;u1ole  o3tyslm rlu s;()alxoir iodfmtrai sl( s2urxr iy4omee ivil( srrax pot1olen oetlt a2eauvp;()teerir3tatfateau i ()seum(m3iu4op e icias)a2trurp;o1oex  fciyd a2ea(vo (4 eenmfcoa1omD  ivslt  exoim3iodam elfesltf 2tmu p;t0tpxnmietlsls rln s;(0 eerxo3iydfp eaueolt  2xmiopoo4ole lfcsl(fsDrrx  ot0apenmoeiadls2el(vp u0 eerxr io1opte ivslt0sruo(r3iydole  netlt  Dtmxr ot1alt mfeilt s emumsn(0alxoir3iydlateluvs t) etrim no1omt  ietlt  2uaur no1ope  ieiltla eluvo;u)trxrio oydop rlivi (0t2xoxrpnydom nmfcsa()sDrmxr ;o0aleo fciys a2eanvs;u0aleoirctatlat  ueols)teuoxo3iu4omtn fvia() rrmx ont0aeenioeiatls rauvp ()alxrir tatomtrau o (  exrxmpoo4ole mfci s)a2rr(rp;t1open iciadlsDuln o (0arxrioctatlpDeli sls0sruoxo no4ameeliesasf rua(  ;u4altnmoetyslm rm( p;t4trenxo3iy1la  li o;t0tetoio3no1al nlnei ( srumurono0tpe ifetlslm ra(mpnu) rxomo ty1la eaneo;s)texoxm3ou4ap   ivi t) 2ua(r ;t4aee ioctld m el(vonu4 eermr todlatrlivi;(0 2xrimpiu4ame mfviltfs2tr(mp;o4oex  o3tyslaDemnms u4 etoir3oa1oaDeln olt  euoir oodlmte fvi t) rurxrono1ole ifeils sDrm(vsn(0trtnirciodfmt ai s;t srtoiopoy4apt mfcilt) rtm(ronu4apenmo3tas a rlnvo t0aleoio3ia1fpD  ieol( srto(o3no1ol   nvtat)s2uaxmpnt1oexomfciytlsDeaumsnu)artnirctadomtelnvolt0srxrxrpny1olenlnctasfsrurx ono4olxoioctydlm emuvs;u0alxrio3oytfptr ivols)s2to(mpio4lpenmnesl() 2uaxmo;t4oexoio3iaslsDumuvsnu4altoxr iadla eaivi s s2tmxopiodaptemfetl( aDtm(  ;t0tlenmoctld s emnmo;(4artoifciatfp ran ilt  eurxr ny4ape lnetat a2urxmo;u1olxo ocias mDra( snu0trxnxf3iy1fptrlneo;t srum(m3oydop nlfesat) 2raumo;u1oltoii3iasla ran onu)aexnmrcoodlaDelivsls0 rurxo3oy1llt  fesl(fartmu p;o0tetnmfeiad m rlumpnu)tetnmf3tydom raivol(0texoxo iu4amenlfvs tfs2uru pot4openmictysla2ua( ont) rtoxrcoadfpteaivo;()s2urxo3iu4llenmivs s)sDumu ont4optniieiasfs emn s u0 reoifciytoa rauvi;t)t2xr(m oydamen fct ( aDtmx  ;o1tpeoioeiltlaDemnvsn(0tltrir3oy1omtran o t)setmir ou1lme mivi tfsrraxrpot4oex ioctlt m2um(msn(0 lermo3tydfp ran o;s)t2trxmpoy1om n ncta() Dumu o;o1aetoio3ilslaDrauvs;t0arxnxrcoa1faD  neo s0 2urxo3oodope  iet (f rua(r nt1olx  ieiltlsDea( ont4 lxnxf oatom rauei ()srxrio3iy4ap e nvils) rumxmpot0olt mo3ilsfmDuau s () ltrxocta1lpDe ivo t  2uoim3iu4lpeemietl(fa2ua(moot4tex mf3tlsla ua(vo;()tlermr3iotoaDraieslt0sexmxopio1lltnmies s  rtmum nu4oex mietlt aDua(mp t0trenxocty1fmD au i;t0teumxm3iodalenmfcil(farrau p;o1alx  i3tasfs2ra( o t0 renxrcio1optr ivslt seuoim3ny1altnlict s)s2raum ;t4oexn fctasls rau sn(0tlxnio iydlm e uvolt)trumxo iodlptn ncs t a2umxro;u0texoiiciydfa rlumpnu0areomrciy1lmD aivs s0t2urir3ou1omtnmfet s) rur(rp;t1alt ifctys aDrln onu)aexoxr3tatfm rauvolt0trur(opiydlpeelnetasf 2umurooo0tetoiictltlm2emnvo u) rxnif3oa1fmtr i sl(  etmiopiu4omenlicil()a2tru onu1oee  i3tas sDrm( o;(0 rtomfciytom rauvi;s0 2urxmpou4lmtn nvsls) rtr(rpnu0tpt  fciysfm2rlnvs t4tlerir3oodfaD lieo;t srtrir iy1olee ivt ()s2tru oou0altnii3ils a2eau p t4trenir3tatfatrau sls0teurim iy1lmee nctat)sDta(mpnt0alxn ieiasfm2rmn snu0texnio3io1lm elieolt0 2tm(o3oudlme livsltf Dururo;u4olx iicils s2raumsnu0 lxnxo3iodfatr ivo;t0texmimpoydam emnvtl() 2tmum nt4tle iietltfaDrln o (0trxoircoydlptraivsl( s2xoxr no1om nmfciat)a2rmxm no0tlt iocild m rl(mont0alxomoctodomt luvi;t0texr(r ou1oltn ivsl() Duax p;o0olen feiytfa emu s u)teerxf3iy1op ran olt) exr(r3oo1opeemfvias  rraum no4tltn fciadfa rlnvs (4 lerxfctodlaDe i i;t)teur(rpnodoltnlncsl(fsrtr(root4tptn f3ias s rmnvpn(4aleoircoatfa  livols0trxoxr3nudalt  nvia() 2uauront0oex mo3tlt aDrm(mpnt)altnmocootlp eluvilt)sexoxr3ou1lp   feiat srrmx  no4tpx  feiysls2el(vp;t)trtoif oatfpteaneo s0 rxm(mpiu4optelfei t)s2ta(rpoo4oltnmf3ilslm rluvon(4altoioctadfate u i (0teum(o3oodam emicsatfartrx  ot0aeenio3ild sDrluvsnu4texrirctadopteaieo;t teurir3io1ame lfetls) Draxm ou1apeoiocias mDua(vp t0 lxrmo iy1fmDr u o;s setriopiudaltnliesa(fs2tr(mpnt1altnifeias a2eaump (4tltniocoodlmt  n il(0srumir ny1lpen fviasfaDuru pou0oet mo3iaslsDumu o;u0altrxrcoa1opD aies t)seurxo3io4ale livs t s2umurpou1tptn ieiyd mDumuvs u)tetnir oo1fp rln s ()tetrim iy4optelictltfsrta(r nu0opeomoctlsla ranmpnu0arxomf3iydlpDelies;s  eum(m oy4llte nctlsfarrmu oot0apen oeiaslmDum( pnt4 rxrxrcoo1lp   n o s0t2tmir3no4omtnmiesas  Draxrp;t0oex if3iltfm2rlumsnt0 lxoxf3iy1fp raieo;t)setmxm oudome micslt)arra(m ;u4olxniicild sDea(mp t)aeermfcoytfa  livi;(  2xmxm3oydlmtn nct sfa2umu o;o1opxnmo3tyt sDuln o t4treomocoo1lp  ai i;s0tetmimpno4amtnmfcsasfarrrx poo1tpenmfctad m elnmsnu0 lxnmoctatfaDr iei s trtrxo3nodale mfcsls) 2trxmono1open octasfsDranmp u) etrmr oo1lm r uvilt teum(opno1lpenlnvtat  rumumont4tee mfetatlm rmnmonu)altrxr totlpteauvs t teurirpny1ap elicia()a2rru  no0oleo ietys mDrln p ()teeoir3ta1fm eli o s)srumim iu4altnmict s sDtr( o;t4tltnmiciysfa rl(mpn()arenmrctatomDe ivi;t0truoxrpiudlmen fvsltfarur(mp;t4aex iieiys sDrm(ms () rtrxo3ia1latrlnvs t0s2xoxrpoy1altn fvs sfa2tr( pot1olx  fctldlm ra(ms;(0areomrcta1op   uvilt)srtr(rpio1lltelnvi t)a2ua( pnu4texn oetlt m2ua( sn(4 etoio io1fp  lu o;t tetmxrpoo4ame mivi t)aDuru  ;o0aeeoif3ild m emums ()tlxnmr tytfmt lnvs s)teuoim3no4lme mfeiasfarrr(m ;u0tlt if3iytlsDrm(vp (4 etoio tydfpt ln ols)srumir3io4apen fvi sf Dtaxm no1aleomieildfmDrm(mp t)trxrircty1fpDraiei;()teuoirpoydam  mnvtasfarurxr ot4alx mietyd aDul(vs u4trenxo3iadfaD ai slt0t2tm(opoy4ap emnetatfsruau  ot0oeenmieiadlaDuaumo (0alerircia1lpD  n o s0 2um(r ou4am n fctl()arra(mpou1oexomiciltls uanms;t) lenxfciydfm rluei s)texr(o3io1lptn fvilt)s2tm(  nt1ape  i3iat a umn s;t0arermo tydfptr iei ()tetr(m3no1lpt  fei s  Drrxr no4tpe iictldlm2rlu sn(0 lxomr3iadopDe nvo () rxrxrpou4am  mfcsl(fsDrmu  no4apeoii3tytla2umn s t4tlxrmocta1oa  lu s (  2urxm iy1lmt mfciltfa2umxm oo1aptomicildlm2ean s;() etoif ootlpD anvs;s sexoir3io4amen ictas s2umumoot0tptnmi3ild a2emums u4 etrir oadla   uvsl(  rxmxr oy1lp elnei s)arumxm ot0opeo o3tat m2elu o u0tleomo oy1fa rln olt t2xmxr no1op  licsasfarua( oot0oeeomfetltlm2uauvsn(4 eenmo3todoaDraivs;s s2xm(r iudlltn nesa()s2rmx pnu0ape iiciasfsDelnvs;(0 etrxf3oo1opDeau s;s0s2xoir ny1ameelfei (farrrxmonu1tltnmictatfs2ulnmsnu) rxomfcoydfat li slt seum(rpoo1lm  lnetl()artr(  ;o4oet  ociadfa2umumsnu4 rtnxfciodoptr i ol() etrim3oodapeelfcsat)aDurxro;o4tpenmfctas s2rm( onu4 leoio3oadlpD aies s trurxr iudolenmieslt)aDuau pot4altoiieiytls2umn s;u4 rtnio3iatlm   n s ()s2toxr iy1lm emfct (fsDuau pno0oetnifeiatfm2uauvo t0 ltrxf3to1lmDraueo;( srtoxr3no4open net s)s2rru  ot0teenmiciadla eluvs;u4 rxomo3iatfmt livi t teurxo3nodlm nmici t)aDtau ont4apxn o3iytla rm(mp;() leoio3iydfpDeau i;s)srumxr3no4ll elneiatf 2rrum nt4aeenmfcils s2emn sn(4teerxo oodlmtrli ol(0seumxm nu4ap n neta( a2trx o;u1oltnmf3iad s umnmo;(0tetoxr3oy1lp e nvi ( srtr(m nu1ap elfei s s2rmu oou0olt iietldfsDelnvsn(4tetomfcootfp  livol( setoim ou4alt mfvils)aDtmxr ;t0tet iocils a2rlnvs u4tltrif oy1lp   iei (0trxoir3ny1lmte ncta( aDua(mpno1oltoif3iat mDum(ms t4 eermfcty1fptr nes s truoim3iu1lm eliet t  2ra(m oo1tlxomiciytlmDuauvp u)trerir3oo1lmDr i o;s)srxmxr no1ameemivtas)sDtmxr ot4aex mi3tldfm rm(vo t4trxomf oodoa eanei;t) 2tmir3iy4op nmfcsasfartmu onu0opx mocildfaDuanvs u4aexnmo3iydfp r u i;(0texmxo iy4lmee fcsat)srta(rpoo0alenii3tytfs ulnvonu)tetrmociodlpD auvo t tetmxr no1ole lfvtat a2rm(r ;o4olxoii3iltfaDel( s;t4aetnmr iatomt ai s;s trur(m iudll nmnctl(fsrrmumpot4tpxomfetatlmDrlumsn(4 rxrxrcoatfp rlueilt teurxm3io1ap   fcsat s
\ No newline at end of file
@@ -0,0 +1 @@
+ues;s0setoxr3io4olt micias)sDrrxrooo0alto fctydfsDrl(msn(4 rtoxo3oodomtrli i;s)truoxopio4om  mfvil( s2tmum nt1apxnio3iyt a rau on(4 etoir oodlm   ies;s0 exoxr oudaleemnei sf rumxrpno4oeeo f3tltlmDul( s u)tlxnircoy1faDrauvs t)tetm(o3nodlltemfvsa(faDtm(  ;o1oltoioeiad s2ea(ms;u4 leoio iy1fpDr n il()trxr(r3iudlle  ncia(fsDrrx p;u4opt  oetyt s2eln onu) eeomociodlpDelivo (0 rxmxmpoydam nmfct s  Dtr(rooo1ole mf3iadla2eln p (4 rtnio3tatfatr nvol()sexoxm3iu4oltelnetatfs2ururonu4optoifctld s2um(vpnt)aeeoio3oo1faD  iei;t0sexrxm oudlptn iciatfaDtr(rpnu4oexnmociydlaDra(mpn() reoir3iotfmtrau il( sruoim3nodlptnlfcils  rtaxroot1tetnmo3ilsfm2ranvo;(4tltomoctatlp  lueolt0 exmxm oodale mfet sfartru p;t1tetoio3tldfa2em( s;t0trtnir3tatoateli i;s0tetrir oy4lm e feia( s2um(rp;o0aet mociydfaDra(vp;t0 ltnioctotopteliei;s srxr(opnu1oleelfcta() Dtr(m nu0oexn icils s2rau s;(4 exnmoctodlmt ln s;(0setoimpiudam e fctltf Dtaxrooo0opto f3iltlaDea( o u)artnmo tydfpD auvi (0srtmxr no1alt  fvtlsfsrrru pou1tlx iieiltls ean p;(4texrxr oatoaD  n s;t0 etrxm oy1lm  livtasfa2uauro;u1alx  o3iydlm umnmpnt) lenir oy1fp  lu ilt s2tmxopiudoltn ncias)sDtau o;t0alx iietltls umums u)treomf oadoptraivs s0teum(m3ny1am   iviasf Dtrumo;o1tex  ictys a em( onu0tlxnxfciytomD luvol() 2uo(o3no1omtnlieiat)a2trxm nu4tltnii3iatls2rau s t0texrxo oodlatrau o s)tetm(r3no4opeemnvta( a2urumpnu1apeo ocias sDemu o;u)trenif ta1oa r ues (  euoim iu4lpenmnvsa()srra(ro;o0apeo fctys sDemumpnu4trxrir iy1oateau olt)seurir3nu1am n icsatf rurxmooo1alx ifcilslaDulump (0aeermo iodfa   ueo;()s2umxm oydam  mfvt sf 2tm( p;o0tee  fctasfm2uan o;u)altrifcoy1oa  au sls0texr(mpiydole lnvt t) rtmum ot1oltoiiciysla2ulnvs;() renxo tatfatelivs t  exmxr iudom emfet t srtrx pnt1apxomocildls2ul(mo;u) rxoifcoydfaD livi t  rxrio iodomte neta(fsDrmx pot4oex  f3iltlsDea( s;t)trxoxr3oy1faDe i o t) rtoim3no4ale mncsat s2tmx p;t0texo octlsfa el( snu0 reomr3iodopt an i;(0trtoim io4apeemfeia() Dururoou1opx ifetyslaDrlnvo (0arxoxocoatoatr u s s0 rto(m3ny4aleemfctlt)artmxrpot1alto i3tatls2uluvpnu)teeoir3tytomDr iei;(0t2tmxrpny1lptnmfeil()artr( o;o1opx  iciyd a rmnmo;t0 etrir oatfpDe i s (0 exrxr3nu4ame  nvsl(f rrrumont0tee ioeilsfa2ua(msnu4tlenifciadfateauvi;(  etm(r3iy1lltn icias aDur( pnt0tptoiiciys m ulnmont4tltnxr3tatom  lueo s0sexr(o no1amen ict tf rurxr ;t4aeeo ieiltfs2ul(mp;t0arermrcoatlmDe ivsls) 2xm(o ou4ome mfvtls s2rmx ont1tleniiciadlm rl(vp;t0trtoir oy1fmt an sl( s2tm(r iudlpe mivi ( srum(mo;o1ale  ociat a2emn s;t4aetnmfciydlaDraues;t t2trir3oo1om  mnet () rur(r ;t0opxn ociys sDra( pnt) rtriocoadop   n o;s  2trir3no1opt lfct tf Drmumono0ole ifetldfa rl( s u4arxrmrcootla e u olt sexm(m oydol elieta(farur(mpnt4tlto fetytfs2ulnvs u4aeerxrcoadfpteln i;t0teuoxm no4lp emictlt sDumxr nu4apenio3iysfaDrm( s t0tleoxo3oo1fptelivo (0srumirpno4ll emneil(fa2rrx pno4tltnioeiydfm ulnvsnu)tltnmf oytoptelueo;s0 exo(r oo1omt  ivi t) 2rr(mp;o1oetnmfeiys a eauvs (4tetnmo tadfmD  i i;s  eto(m nydll emnet s)srrr(rpot4tetomfctysfm emums u4 exoxr3oodoat aueo;s  etoirpoy4ol n iesas)srrru poo4ope mictldlmDul(mpn()arxrmf io1lpDranes s t2to(opoy4lme lfvias s2tr(r ;o1apt iictlt m rlnmp t0arenif oy1opDeluvo t)s2urxmpnu4ope lfctl(fsrrmxm no4oltn feiadlm uln p;t0artnxf ta1fa  au s t  etoio nydlmeemncils s2ua( o;t0oee iociysls2ulump;u4 lermrctodom ranvsl()trtr(o io4lm nlici ( srtaump;o1oeeo octlsfs raump;t0 ltnxrcoa1fp r u i;t)t2ur(m nydamt  fei (farrmx  ;o4ale  feiytfm2umnvsnt4texoircto1latraiei;t)tetmirpny4opte fcsasfsrtr(mp;o1alx mf3iltls2eanmpnt4 rtrir3iadfp e nvslt0 etriopiy4ap n ivs ( srrax oou1altomieiadfs emnvs;u4 lerxo3tytfmD  ueslt s2um(o ny1olt livsas) Draxmo;u4opeomf3iat s elu p;(0teenxr iytop e i il(0srto(o oodomtnmfcias artmur nu4opeomoeiatfmDua(mpn(4 leomo oatlatraivo;t)seuoirpoy1optn nviltfsrtmxmpnt0texomicild a el(monu0alenxr tadlp   ivsls t2trxm3no4olte nctl( a2umxr ou0aeeomoeiasls umnvsn(4tltoxr oa1lp  ai s;(0s2trxo3iy4omenlfctat sDua(rpou4oleomiciltfs2ea( o;u4alxnxr3tydopt lnei;s) rtmxm iydalen nvil( aDrau  ;o1oleomfeiysfmDulnvo t)trerio3totfa r i ols)s2toim3iu4opeelfvia(f 2tmxro;o1tee  ieiyt s2umnmonu0artoxo3oytfa rlnes s0s2toxm3oo4am n fvta() rtru  nt0apeo ociadfmDul(monu0 rxrmrcoa1lpD li i ()trur(o3ny4lptelivsls  rua( ont1open f3ias m2ranmo u)texriociotla rau s;t0 2xoxr oo4lme  iesa( arrr(moou4oexoiietytfaDrl( pnt0artnxo3ta1latrluvo s srurio ou1openlivil()arumx onu4oee mictas mDrlnvon(4 reoxfctotlpt ln sl(0sruoxm3oudamtnlfvias a2umx poo1oltomieiys m2umn s t)altrxf3ty1late uvi;( tetoir3oy1lltelfcsl(f ruaxrp;u0oet  fetld aDrm( on(4teeomr iotoaDeaneol()trurir3no4om e iei sfsrumurpnt1alt ifeiysfaDum( p;u4altrmf iydlmte n o t)trurimpny4opt livt (  Duaxmooo0tpxomoetydls2ranvs () exnmf3todlate n i;(0 2um(o oodol emiesat  2uax pnt0tpt if3tatls2uluvpnu)treoir todomt lueilt0 etmxr3iydll  mneil(fs2urxmp;t4oexoii3tatlm2rmnmsnu)alxomr3iydopDrlnei;s)s2tr(rpiy1lmtnlivt sf Dur( pnu0olxomfctydfm rluvo;t4 ltrifcootoatrluvo;( truo(r oodam  lfvsa(fartr(mont1tle  f3iyt mDemu pn() lxnmrciodfatranes t srxrxm3iodlltemnvs s)sDta(  ou0opxnmictydlaDemu s t)alxrxo todoptr u ilt trumir3nudap  lict sfarrmx ono0olt mieiytfa2eanmsn()tleoio3iodoatrlu i;( sruoxo3ou1omenmivtat  2tau pou4oexnmf3iysfm2ul(vs;()aeeomr oytop  aueil(  rtoxm3iudal e nei sf 2ur(ront1apenmi3iasfm um( o;t) etrifctotlmte nvil()trtrxo oy1llt lnvtls)s2tr( o;o4oeeoiictatfmDrmumonu4 rxoif3oatfmDe n s;(0srur(o3iodlme  fvtas sDrm(root0aetn ieild mDuan p t) etrxo3iytfptraieols0trtr(r3iudamenmfctas aDtaxm nt1apeoiietas sDemuvpnt4 rxnircta1fpDraivo;t  2trxo ou1om e fesa( srtr(mo;u1apeniieiat a umnvp;u0 lenxr todfmt lues;s) 2uo(o ny4amenlnvtat)srtaumpot4optomi3iysfsDuanvont4tlxoxf3tatomteluvsl()srto(mpiu4lleelfesls a2taum ot0tpx ioeias aDrln o;(4 etrif oodoat  i i;s0t2xrxo iydopenlnetls arrr(mp;o4oex ifeiydfmDuanmpn(4aexnmrcootoaDeaivs;(0teuo(o iydamt mfei ( a2trxr ;u1ope mieiytfsDulu p () rxnxrcoydlmtr nes t  2tmimpoy1opte iet s  Dtmxrp;t1tpeomociasfs2rm(mon()aetoio ia1fa  lueo;t0texrxm iy1aptnlivil()srraumpoo1optnmfeiysla rlums;(0 ltnif oa1fm e u sl(  etm(opio1al emiei t)a2uaumpou1aptoifciltfmDulnvs;t4 ltoif3ty1fatrlnvs;s0 rtoim3iydoltnmnetls)s2umumo;t4oltoioeiatfa2ul(mp u4 etrxr oadop rluvsl(0s2toimpoydllen nvtl(fs2tmxm ot1apto oetydfa rlnmpnu4 lxoircoo1fa  lnei s)s2xr(o3iu1lpte fetl(fsDuaumpno4teenmieiaslm2rmumo;(4 ltrmf3iadoaD  n ol(  rxo(m no1ame lfvt s) Dtau onu4aetomictyt s2ra(monu4alxnmo3tatlmt ln slt s2to(r3iydlptemfet ()a2um(r no1alt ifciatlm rmumo u0teeoir tatlm eaiei s0s2urim3iydolen ncs t srtaur nu0alxoioeiyt a eluvs t0tlxrif3ia1fmDrli s (0 rto(r iu1lm  mnvsl( sDuaxmp;u1alenif3tyt s um( o t0tetnmr oatopD luvsl(0sruoir3io1ll  mfcia(fsDtmu pot1ope iociad mDelumo;u0arenmr3oodlmD lnesl(0teto(opoy1olen ivsls) rra(  ;u0optnmfcilsfs em(vont0 exomf oa1faDrlueils)setrim3ny4lmeelfesls) Drm(mo;u4oee  f3ild m um( onu4 exrxf3ta1latelneols0 eurim iu4omtnmfvtls s2uaxrpot1apx  octys mDumnvsn()aexrxo ty1fmte uvol()sexoim3ou4ole lfvsl(fsDumxmpnu4tpeoif3iat m rmnvp u0 ltnmo3oa1fp  luei;( tetoxm ny4lmtelici s arta(rp;u1tee  feiltfmDra( p t) rxnxf3ia1omt an o ( srumxm3nu1lmenlivi t)aDra(mont0teeoiocias m2uan pn(4treoif oo1oatrlueils) exr(o3iodomenmicia()srurxr nt1optniictysfmDuau ont0 ltoio3oytomte ieolt) euoio iy4lpt  nci t s2tr( p;o4aee mi3iyslm2rm( sn(0 leoxo3totopteaivs;t0t2xoxr iu4oleelivsatfaruax p;o4oetniieiyslm2el( o u4alxrmr tydfpte nvi;s)sruoxo3iydll n ivt s artax ono0apx mf3ilt a2umu s t)aeeoxo oatlaDelneils) exrxopio1lle mietat)arrr(ront4alenmfctasfaDrl(mp;u)aetnircio1fa r u o;t)sexr(m3oudomenmfesls)a2tm(mpnt1tlto i3iat s umnvp u4 exomo3iotop raivi;s  ruoir oo1lpenlfetat) rrm(rpot4aex  o3tytls2el(msnt0 rtrmr3oydfa r uvo;s0truoxo oy1omt lfcsa()s2rrumono0tpeo fctaslm2um( s u)aeerxo3oy1laDr i o;(0 exoir3oydomtnlietas)arra(m nu0alxniociyslaDran o;(4 ltoxoctotlpDeau s t) etoimpoo1om   fct tf rrrxrpno1alxomietls aDrlumpnu4aleriocoydomDe u o t0 2xrir oo4ol  mieias)s2umumo;o4altniieiadfaDulu o (4 eenmo3oadfm  lnvil() rtm(rpnu4alt  icsl(f rrr( poo1apt ifeiatfa el(vs;t) rxoir iadfpD auvo s seuoio ou4lltn iciltfa2rm(ronu1aexo iciatfs rlnmsnu0altoxf3oy1fpteau sl()t2trir3iydlm  mnvsls)artm(rpoo1oet mfeiytfm uln o u4tetomr3oo1oa r i o;s)s2to(mpny1lpt  fei s) 2ta(m ou1tetniiciadfm umn o u)altnir3todla e i ilt)sexrirpoy4om nlietl(farrax  ;u0oeeoif3iyd mDra(von() exrxr ty1lat an s s0 2xm(o3iydomte fct s) Dtax  ;t4tpxnmfciydls ean snt0tlxrxf oadom eaivi;t0 ruo(o3iy1ap nlnctas) rumuro;t4aexniiciysfs2ean pnt4 lxrircoytlaDraivols0sexmir ou4lptn iesl( a2trumonu4ape iociltlm2em(vsn(4artrmr3iotom  an il(0 eur(r3io1lmt lietls)s2ta(m nu1apenioeiat mDuan onu4altrmf oytoate i o (0srtmxo3ou4lme  ncsas) 2taxmoot0alt mf3ildfs2rl(vpnu4 lxrircia1fp   u i (0s2um(m3nu1aptn fvt t  2ra(mp;u1ale iieilsfa uan s ()trxoio3oadlatraueolt trur(mpoy1am n fes s aDtaumpou4tpt moeildlm rluvs;(0alxnif ootla   iei s  eumxmpny4lm nlivt tfaDumu p;t0oltnmfctatla emn pnt0 lxrif3iytom e n o (0srxmio io4ale lnvi tfaDrru o;t1oltnif3tyslm2ua( o u) exoxocto1opteli il(0 euoimpny1llt lfctl()aDrmurpno0oeeo iciydla2rln p t4aexomf tatfmD aiesls)t2ur(r no1lp nmivs s a2rr( ono4teenifcias s rln s t)trenxrcoytlp   uvo (0 2xrim io4am n ics t sDua( pou0aetnii3tasla2ul(vo () eenxo3oadop  lnes ( s2urimpnodolte feiat  2tmxmo;u0aetoif3ils a rmn o t0trxnmocto1laDe ivs;() etrimpoo1opte ies ( sDumx  oo1oltnmi3iaslm2rl( s;() rtrxrcoodlmteaneo;t0teuo(o3ny1opee ivsas s2rr( p;o4alxo fciltfm2rln onu)aleoxrcia1fmDelivils0s2xr(o no4lm  lfcsls)artrum nt1oetomi3ild s2rlu p (4altrifctydfmt  u slt0 rxrir iu4lpt mfviasfsrua(m nu1tle if3tld m eau snu)texomfciodlmDe ueslt  rtmxo3oy4lpen fctat  2rm( pnt4olxoiictadlsDem(mont4 lenmr oydomDrln i ()trur(m3nu4omtemivt s a2trum no4aeeo fciydls elums (0areoxfcoa1fpD auvsls0texm(m io1lm elfeil( arrrurpnu4oet io3tyt a rm(vs;t4alenxo3tydfmDeanes (0s2tmio3iodopt mnvsl(f 2rax pot4aetniociyd s rmnmp u4 rerir iy1lmDelnes;(0t2tmxr iy4lltemicil( aDur(m oo0tpx ifctld s2rm( p;t0 exrmo oatoa   iei (0tetm(r io4apeelnetatf Dra(ro;u4opxn oetld m2el(vs;t)tetnmfciadfmt lu i;s  ruoxmpnudamt lnvi s a2rrx poo0oee mi3tldfs2ul( o u) lermrcoydlm r uvo ()srxoir3oodamtemnvsasfa2rmu  ;o1apxnmfciltlsDrlnvp;t) etoxociatfaDran s;t srxmir no4olt  ictl(fs2rrumono4tpx mfciasfs rmu o u) lxnmf3iydopD  ueol() 2uo(r iy1altnlivtl(f rumx o;u4apx  i3iytls ulnvp;t0tltnmr iytfp   ivslt  exo(r nydoltnmnvsa()arumx onu1aeen iciysfa2uauvp (4tlxrmf oytomD  i i (  eumxopiy1al nmnetl( a2ururono0olt io3iytla2eaumo u0 ltomr to1lmD lieo t) 2xoio nodaleemfctl(  Durx o;o0aet moeiyd a uanmsnu)artomo tadlmtr ueo s)teum(o3nu1lm e fvt sfa2ur(rpnu1apenmfciad sDrlu p;u0 rxrxfcoy1omD ai olt0t2urxrpoo1lpen nviltf Dururo;t1aleniiciydfm emnmonu)aetrxoctodlaDr i o t)tetrxr oydom emfvtl()artmur oo0oltn f3ilsfm2umnvpnu0altoxf oydfaDraies s t2to(m3nudalen nvtas)arrax pno1aee mfciyt a2rmnvs t0texoxo3oy1om eaneols s2xm(m3oodaleelnci s aDrmxrpnt4oltoii3ilslm2rln pnt) rtrir3tadomD auvs;s0s2xoxr iudol  mnct t)sDraur ;o0tlt iieiaslm um(mon()artoio ootopDe uvo s  etrxr nydal  lfvs s sDurumoot4tlt moeiydfs ea(vp;u)aetnir3todlp rlieo;s0 ruo(r io4lltelivia()s2tmumono1opt  ociadfa elnvsnt0tlxnif3totlmteanvsls)setr(opiu4ll nlfvsl( sDrmu oou1oeto i3tldla2el(vo t0alenxr3oodfa   ivs;s teum(m3io1oltnlfvtl(f Drm(mp;u0tptomoctasfs ulump;t)arxrio oa1lmtraneo;s)s2xoxopoy1ameemnciltf rumx  ou0aetomfctldlaDem(ms;u)areomo3iytoatr ivo;s srxoxmpiy1oltnlfctl(fsrumur ot0ape mf3tydfaDul( p (4tlenxf3oatoaD lnvs;t tetoio nudalt mfvtat srtr(m ;u4tpe mf3ildfm2raums;t0arerxo3oodop r i s;t)trtrxr oudam elieiat) Dumu p;u1optnmf3tas mDeauvon(4arermr tytfpD aieils0truoxo iu1op nmneslt srra(mpno0teeoiieias a2rauvs (4aexnmfciydfm eluvi t0seuoxm3ny4amt  nct tfsDum(rp;u1tle miciyslmDem(ms (0tltoifctodoaDraies () 2xo(o3oy4ol elfvtlsfsDra(m ;u4optoiictltfm2eanvo;u) eenxfcoatlpD auvs;t seum(m3nu4lmtnmnvsatfa2umump;t4tlx ioetlsfaDrlnvs u4tetnmr3iy1lat livo t sexr(opio4lptemicsa(faDrm( o;t0apxnifeiatlm rl(mo;()trtnir ia1fmtrlnvs ()teurirpiu4op elictlt)srrrurp;o1tet  fetadfa2uan o;u)trxrir io1lmDelneo t tetrxr3oy4ape lfci t  rtrurp;t1tltomictytfs2ul( o;(0 etrmr3ty1fmt aivols  rxrio iudol e fvil(f Dumurpnu1optn i3iysfsDuau o;t0arxrmo3io1opDr iesl( setm(rpno1amt mfcil()sDtm(m ot4optnioctas mDrmuvsnu0 eeoxo3todfpt aivs;t srtmio ny4lleelivsls  2ururonu1alt mfctldlm rl(mo u0aexnio3oodfpteluvi t0t2tmir3ou1al  mfvil()sDrrur ;u1alxomictadfs2rmumsnu4trxrxociytfm e u s (0 2ur(o oy4lme  nvtlt  2tr(rpnt1aptn ocilsfaDuanms;(0tlxrmo3tytlp eaivo t0trtr(m iodamtnmfeia(fa2tr(mo;t1oltnmi3ildfaDrlnvp;() reomo oo1lp eau s;s t2umxrpnudamen ieta(  2ta(mooo0apeoii3iasfm ulumo;u4tltoxr oa1fmt livsl(  2xr(o3nodap  micslsfsDrrx o;t0tlx  fcildfaDrl(vs;u0alenmf3ty1fmD  uvs;t)tetoxrpoodalee icta(  2taxront1ape iietad a umums (4trtrirctytopDraneo;(0t2toir nu1oltnlnes ( a2umxmoou4aet  i3tat m2uan p;t0 renir oodfp rai o;(0trtrxr3nudll  mfes () rtmx poo1texo ieiydlmDemnmon()teenxocta1fmte uvols0seumxr oy4lmtemivsatfsrurur ;t1alenifetadfmDrlumsnt4 eenmo3oydoa elnvs;s)s2xmiopiu1lmte nvsa(farurxr ot4oex io3tys a em(ms u) rtomo3oydlatelnvo;s)t2xriopiy1ale lnesas s2trurpno0aee ioctlsfm2rlnmonu0artoxf3io1fpteln o ( setoxm oodaptelnvt () 2umxrooo1aex mf3tysfs2um(vo;t4altoxf3oa1lpDrlnes t s2trirpno1ape lneil( s2rm(r nt4aeenio3iyslmDemnmp ()teenxo ia1opt  uvslt) etrxr nu4lle mivtatf Dtrxmp;t0apto ietydls emn pn(4 lxrmfcoytlptrlivol()sexoim3oy4ome  nvs (fsDtr(m nu0aetniiciytlm uanvp;(0 ltnmrciydlmD  uvilt teur(m3nydoptn nesltf Drrxmpno1tlen oeiad aDrm(vs;(4tlenmr ta1lateliei (  2xm(o3ny4op elfesls)arumx ont1apx moctydls2rmn onu) ltrmr3tadla eaivi;s  2to(mpiodam  mivt (farrmum oo0ole mf3iysfm2uaums u4 lxrio3oy1fptelneolt)s2urxr3iy4ol nlfeil()arrm(ro;u4ale if3iytfm emu onu4 rtrxo tydfp  au il()seur(r3oudlm n net tf 2uru pnu0tpto o3iysfsDrmnvs;(4arxrif io1oatrluvolt) 2uoio3oy4lmtemieia(  Draur ;u4tpenifcilt m umnvonu)tetoir iadlmtr u ols0 rxoio iu1lmte ncia(fa2raxmonu0oetomoeiad a2ua(ms t0altnmfciotom elivolt sexmimpiy4om emnvia(  2rr(mpnt1opxnifciatfs ra(vo u4 ltnmo oo1oat lu ols)s2xo(opiy1ll elfes s srrr( p;o1tpt  fciytlm umuvo;(0tltomf iytomtelnei t)sexoxr no4lpt  ieslt)a2rmur ;o4tpxn f3iat a rl(ms;u0 etrircto1om e uvi (0srto(opou1llt livsas)sDtax p;o4apeo feias mDumnmp t4alxrxr3oytfmt  neo;t0srtoiopnydomen fvi t  rtrumooo4opx  i3tytfs rlnms;u4tlerir3tytlpD  uvi ( t2xmir iudaptelnetat)srurxr no4teenif3tytfm2ra( p (4artoxo ty1oaDrlues s)s2tmxrpoudaltn fvi t)a2uax onu1opt mfciltfs uauvs;(0 ltomociotlmtean s;t  2toio3ny4ap nlicsl(f ruau o;u0tpeoioeiatlmDrlnvs;u0 lxnxrciadfmte neo;()s2um(o3iu1al emncsa(f Dur(mooo1aexomo3iltla rmu o;t0trxoir iotla e u i;s0teuo(mpiudlmt  ies (fartaumpno4tpxo f3iyt sDua( on()trxnxf3io1fa  aivo;s s2tmxr iy4lme mn
\ No newline at end of file
@@ -0,0 +1 @@
+ieo s)srurirpoy4lmtemnciltfa2rrxr oo4oet mo3tysfs2elnvsnt0teeoxf3tadfm r uvo;t0trxrxr3nu4lptelivi s)sDtmxr nu1ape mietasfm2rmuvo;(0alxoifcootoa rln ilt sexmxm nu1ole mnvtl( aDum(  ;u0oexnmieildfs2ulnmpnt)tltrif tatlateliei ( trxmim3ny4apen ictltf rur(  ot0tlt if3iaslaDuluvp t4 rerioctodfmD lnei;t) euoxmpnydlm e ivs (  rtaxr nu4tptn ietyslm2em(vs;t4aleoif ia1lat livs;t) rxr(o io1olee fcs s artaxro;o4tlx ifctasfm rm( on(4treomo iatom  auvo ()tetr(m3no1oleemieil() ruru onu1oetnmo3tadfa2rm(mont) etoxo3oo1fmteln i t0s2xmio oo1ap elfvt () rua(mp;u1olto ietldlm2rlnvs;u0 ltrircoo1opt lieils0s2xmim oydlpen feia()arrrxrpnu0aptoifetld a elnvsnt)tlerif3oytla   nesl()trxmim ou1ap emfesa(f ruru oou0alxn fetasfm rau p;t4trtrif3iatlp eaiesl( srtm(o3oodoltnlieia(  2rr(  ;t1oltnmf3iat sDean p u)arxrmr3iotlpD li i (0tetmirpoydamtn feiltf 2rrumooo0tleoioeiydla2eaumpnt)aleoxfcty1lp  lueils  eurxm ny1opte nvt s)a2taurpnu1oeeo fetyt a eaumsn() etnxf oo1fatelieil()s2umim3iy1alen nctlsf Drr(mo;u0texoioetaslmDea(vsn(0 rxoiocoadlpDeluei (  rtoimpoodoleelics sfarurx  ;t1oee mieiltfa rmn p u)aetnxo todla eauvsl()s2ur(m iudlp emfvtls sDrr(mont4oee  fciadfm uanms (0trxnmfcoo1lmDelu ols0sruoim3io4alte ici s  Dum(  ;u4oetoii3ildlm emu onu) rerxociodlaDeaivi t tetoimpoy1ll nmfvias aDtaxm nt0tleo i3tytfa2uln ont0artnmr iadomD ai s;( teuoxr3io4om  lnvta(  rua(rooo1aetn fetlsla ranmp;() leoxr3ia1fpDrluvols0t2tm(o3oo4apeemnesltfarrrump;t0ale  f3tat aDrl(vonu4altoio3oatlat  i ols)setoxr io1llt mfciatfs2rax poo4apt ifeiad m rlnmo;t)tlerxf3oo1fpDelivi (0setoir iudopenmicia()s2ua(rpot1texnmfeiltfs2ran s u0trxnxfctytfm e nvs;(0 rumxrpiu1apte fcsl(fa2um(  nt0texn fcild m2elumo;t) rtoxf oo1opDe ivo s texmim3oydom e fvsl() rta(  nt4opxn f3tas sDeln snt0alxoif tadlmtrluei t seuoxmpiudopt mfeiat aDrr(r ou0tleo f3tadfa ra(mo;(4aetrxo tydfa  ln o s) rto(opoo1apee nvsltf rrru o;t4olx mfetydfmDran o u0aeenmr io1fpt aivi t sruoim ny4olen ncilt aDtaumpoo0tetnioeiatfm2emn p;(0trtnio3tytopDeaueolt sexr(m3iydame  net tfsDumx ont1aleomietys s ra(vsnu0 ltoif ty1om   ieols)sruoxrpnu1ope lfcslsfa2uaxr ;o4oetn i3iytls2elump (0 exrmf tadlm r ueslt s2toirpiu1ll elfvs tf 2tr(mono4oleo oeild mDemu o;u)aetomf iatfmDrlies s) rtr(o iy4omeelnvi tfaDuau onu4tpenmfeiltfa eanvpn() lxrxrciydom rai i;s) rtrir ou4llenlfvils  Dua(rpou4alx  fctldla2elnmpn()tetnif iadla elieils seto(rpny4al elnvtlt  2ra(m ;u0olx  f3ilslm2eaumsnt)arxrif totfaD lieo;( srtm(opoo1aleelfvtl(  2umxmonu0tlxomoetlt mDua(mo;(4tltrxociydoat li i (0srur(o3iy1open nvil( a2tr(mooo1apeniieiltla2rmnmo;u0teerifcoydoat luvo t  2uoiopiy4lp  mnci tfsDtm( p;t4opt  fctytfs el(vp t4tlerxo oa1fpteliesl()s2uo(mpoydaltemfvils)sDtr(mp;u1aex iieilsfa um( s u)arxoio3iodlm ranes t0srtoxm3nudlm emivs (  2ur( ooo0optomo3iytfs umn p;(4arxrxf tytlp   ivslt  2uoxopno1lptnlnctl(  rtmxmoou1aptnmoeiat aDemnmp t0tlenmociatfa  lues t)teurxo3io4ap  lnei (faDua(m nt1tpt mo3iad sDumnvpn(4 ltnif ia1faDeaues;t  2tr(o3iy4oleemivs s) Duau  ou4tpt mfeiyd mDel( o;(0 rxnxf3iodomDe nes;(0texrxopou1ol eliei s s2uax p;t4texn ieiatfs2rluvpnu0alxomoctytlm eai o;( tetm(rpnydomt livtls) Dua(mono4oeeo oetldlm emnmsn(0areomo io1lp eauvi;(0 2xrxo3nu4llt  fvtlsfartr(  ;t0aexnmoetysfa2rm(mp (4trxrmr oy1fpDr uvils)sexo(m3ou4ol e nciat)arta(rpnt1alxnmfeiat sDuauvo (4alxomo3tytlmtr n il( s2xm(mpiy4lmte neslsfs2ur(mpnt1tpxomf3iadlm2rlnvo () rxnmocio1fatr ieo t)truoxr ny1am e icils)srurump;t4tlx  ietaslmDrl(vp;u0 exrxo3ia1laD liesl(  2xoiopoy1olt lnesa()aDua( pot0optnii3tltfmDrlnmo (0tlxriocoy1lp rluvils tetoxr3oudom emfeils  2rm(ro;u0tltnifciat m2rauvpnt4tlxomo iotfa elues;(  2umxm3ou1amt mfvsas s2ua(  no1tlto ieilslmDrmumo u4 eeoir3ta1oaD livo s srtoxrpiydaptemneiat)arrr(r ot1aee  oeiaslaDulump t4trenmo tytla e ieo;s)seurim iodal e iet ( s2um(  nu1aee mociadla2um(vpnu)altniociy1lpteauvol(0s2xrxmpou4al   fci t) Dumx  nt4apxnmieiltla2rmnms ()tleoio3oa1lmteluvilt) rurxr oodam nmfct sfsrrr( pnu1tltnmoctltls2rau s;(0tlxrir tadoaDe u s (0 rxr(opoo4lp e fetl()a2tmxrp;o0aeeo f3tydfa2ul(mo (4tleoir3oydlp raueo;( t2xoir3iydoltelfei t sDta(moot1apx  ociydlaDum(vo;(0teenmo iodopD au i;s tetmim iu4op e ieiat s2ta(mont0tlto oetyd s rmumsnt4trxoir totlpDeauvi t0 rtrxr iu1lle  nvi tfs2uax ont0tetniieiysfs uau p;(4trenif3iotfaDe ieo;(0srxrir iydlmt  fet ()artr( ont1tpe mf3iytfmDrlnmp u4 rxomo3iatop eli i t0srxoim nu4aleemicta(fs2uru pot0olt ioetydfa2emn pn(0tetomoctydfat  n o t0truo(rpnudlm  mivsa(faDraurpnu1altnmictatfs2elu snu4 ltnxr oodfa eanvsl(0t2xr(o iy4opt  fvia()sDrrxmoot4oexomfciyd aDua(mp;t) eenxrctydlmt an o (0s2xoxo no4lmtelfct t aDtax  ;o4apx mociyd sDulumsnt)aexomr3tatlmD  n il(0srxrxr io1ope lncs s a2tmx ono1opxo fciyd sDulnvo;u)tlerir3todfm eln ol(  rtmxmpnydlm e ncta(faDrmxr ;u0opxoioeiys mDuln o (4trenirciytomDe ueols tetmiopio4om nmncil(fsrtm(ront1aetoiietydlsDrm(mon()tlxrir iy1lmt luvsls t2urxr3io1omeelivs ( a2rrxr nu4aex mfctat mDran s u4teenxfcoa1lmDranvi s  exrim3iu4lmteliesls srrmxmo;u4aetn ocilsla2umn s u0 etrxoctotomteli s ()teumxo nu1llee net t aDuau  ot1alxoifctls a ea(ms;(4treomr ta1omDraieol(0s2trxrpiy1lltnlfes (fs2rmurooo0aexniociltfaDel(mp () rermrcoodopDeauvs t srum(rpiu4lltemivtl() Dta(ro;t0teeomieild s2umums u4aetnxr iy1fm e n il(0 2xrxmpiu4olen fei sf rtm(m nu1oexn fcilsfs rlump;u0texrmf3totlmtr uei;t)texo(o3oy1lptnmfeta(fsrtaxrpot0alxoifciydfs umnms u4aleomf oy1omD lnvs t0srxr(o3iydap nlieta(f rrmxrooo0oetoiieiltls uaumsn(0 leoxf3iadlmtr ieo t0trumio oudlmeelfcsat  Dtm( oou0tpeoiieias m ea(vonu)teermociydfmDr uvo;t0s2ur(m io4altelnetas)arrmur nu1olxn o3iydfs2ea(mon(4 lxoxrcty1oa eanes;t0setoxr oydlp  lfci ( a2tm( pou0tpxnmfciltfmDemuvsnu0alxrio oo1fmt anesls) ruo(mpiu4ap  mfcia(fartr(mpno4alto ieiyd sDrlu pnu0 eerxf3oadfm e nvo;() rumim ny1ole mfesas sDra( p;u4tpt  ociytfs2elumsn(4 eerxf oodomtrli ols) eurio oudomte nvslt  2uru pnu4tetnmi3ilsfsDea(mp t0texoxo3iodfmtr uvi;t trtmim3oy1ap  licil(farururpnt0optomoeiatfa2ra(vpnt0trxomo3ia1fa e u i (0 eumir3no1lmtnlfeil(fsrtmxm oo4teen f3iaslaDeauvo u4texrxo ia1fp   u o (0s2to(m iu4lpe mivsltfarua(rono0teeoif3iltlmDelums;t)altnxr todfaDeanei s0seurir3nu1alee nes ( a2tmxrooo1texomieilsfm2rlnmsnu0 rxrxr iadlm  ai s;t)srxmxm3ou4am n fcilsfa2uax o;u4oltn ieild s umu p;t0alerxo3iy1opte nvs;(0srtmxo ou4olt  fvslt)aDtmumpou1aet ioeiytlm2elu s;t)trermr tytopteau sls) rtmxo3ou1am emiviatf 2tmx  oo4opxnmf3ils s2uaumo;(0trxriocty1lp eluvi;s0setoxopio1lmtelnvs t  2ta(ront4teto ociyslm elnvs;t4tltoifciy1oatelivsl()sruoxr nydomt mnvs sf rraumpot1tpx ifeiydlmDra(vsnu4tlxrxfcootlaD lueo t srxo(rpnu1ol   ivt s)a2tax pou4aexomieilt a elnvon(0tlxomf tytlm eluvs;t)tetoxopou4om eliet s s2taum ;t0aexoiieils m eanmo (0 exnxr tadopDrlueslt)srtrim3oodlm  lnvi t artrum ot1opto fctld s2eluvs;u) eerif3io1oa raueil() rtm(r3ou1optemfeta()arrax ont0aet ifeilsla emn sn() rxoir3oy1fa rauvs (  2xo(mpio4opt mnet ()aDra(mpoo0altoio3ildlsDumumo t) lxomrctatlmt ln s t0trtmxr oo4lpenmiei t a2ra( o;t1alto octytls2eaums t)texoio ta1optraivilt)seuoxmpny1al emici ()srur(mo;t4aptnmf3iadfm ra(vont) rtoxr oa1lm rlneilt trtr(m oydope  nvi s sDrr( onu0apx ifetas aDuanvpnu0alxnif3totlat lnvs s0 exmiopiudopt lict (fsDtmum ;t0oetoio3iltlm2rluvo;t0alxoxr to1fptrlivi;s) eurio3ou4oleemivt () 2uaxrpou0alxnio3iadla2um(vs t0 rtnxrctotopDran i t teuoxr3ny4lleemiet s) ruaurp;o0ale ii3tysfs rmn pnt4treomr3iadfatr ivsls teurirpou1oltelfeilt)a2rr(moou1apxnmf3iadlm uanvs;() renxocia1omDelu o (0s2um(rpiu1op nlfesat)srrmxro;u4apto f3tatla elu s t4teerir ia1fpDrlneo (0texmxo3oodoptn iviasfa2raxmpot0aexnif3tlslmDrm( pnu0 rermo3iydlm eai o (  rxr(m3iu4lpt liesl( s2tmx p;t0tlxnmi3tys mDumu pnt4 etoxf ta1la eanei s) exrir3oy1lm nlivtl(fsDra(roou0aee  octas a ean s u)alxnircoydlaD  nvo ( t2um(opnu1aptemnvs (f rumu  no1apt  oeiyt m2ulumo (4 lerxfciydomDrlivs (0trur(m nydoltelnvsls)sDrr(m nt0oetoioeiydlsDuauvont0arerio tadomD luesls  2xo(rpiu4amenliei t)sDuaxr nu4olto oetad sDrm(mo;(0tlxrmfciydomtr n i s0trtr(mpoy4am elicslt  rra( ono4aleomo3tysfmDeau o (4 rtomrcoo1latr nvilt0 2xmir3ou4lptemncia(faDrru  oo0alx io3iatfaDem( on(0treomo iatlaD aiei s) rxm(o oo4ome  ietlsfs2rr(r ou1tex mfciatfa2rl(vp u0alermfcta1fpt aneslt s2xoio3nydaptelnct sfs2tau  nt1opx mieiytfaDeln s;() etrmo iatomte nei ( srxoirpou4amen fes (  Drm( ooo1ale io3iad a2rmnvo;t4tltnifcoo1omteaies ()s2urxo nu1openmfvt s)aDrmx o;t
\ No newline at end of file
@@ -0,0 +1 @@
+n i;(0 euoim3ou1opeemfcia( sruaxm oo0tlenmf3iytlmDua(mo;(0tleoio to1lm  luesls srur(r iodalte fcia(faruru  nu1aex mieiysfs2eau ont0tetomfcootoptrln ilt0t2xoxr nudalt livtasfaDumx o;o1oet  icilsls umnvp ()artrircto1fp   uvs t  eto(opnodom emietl( a2uaxm ou1tpx  o3ildlm2eluvo t) lxrxf3totlp e uvo;s trur(mpiy1opte iviltfaDuaxmo;u1tlxomfeiytls2eanvonu0altomrciy1fat aueo;t)s2xr(opnu1olenmivt (f 2taxro;u4tpeo oeiadlmDuaump (4tleoifcia1lmDr ies t0 rxmir iy4lme  nctlt)srrax o;u0alx ii3ildls2eanmpnu) rxrxf oydlp  luvi ()s2xoxmpoo1olen ietls) rrr(mont1olxnmoctydfsDea( p u) ltoxfcty1omDrliei;t0t2xoxo3iu4omtnmnvtl() Dtrump;u4alx mi3ils a eanmpn(0tltnmociadfmD  nvil( s2xoxr oo4lmtnmivsl(fa2urx onu0aexomiciyd a rl(vpnt0arxoxf oadoa rli i t0s2urxmpiu4lltemivta()artmxmono4tetnii3ilsfm2ua( p ()tetnio tadoa elnvs s) 2tmxrpiodlptelivil()a2rmxrpnu4openiiciys mDua( o;() leomf3iydlpteanvsls srtmxr3no4ape  icsa( aDrrxr ot0tlt  ietaslsDeau p t0 lenircty1oatrluvs;t0trxmir3io1lp n fvtls)srtmu  oo0opxoii3ils mDumuvo (0 lxnxfcto1lm  aueols s2xmxopoodalen nviatfsrra(mp;t1oee mf3iat m ea(vp () renio tydlat luvs t0 2tmimpno1lp emicia() 2umurpnu4alx  fetadfa eanms;t)alxnxf oodfm  luvo;(0 etoxm ny1lp elfciasfsrta(m nt4oleo i3tyd s uluvo;(0 reniociodop r i i t0t2tr(mpoo4lpte feilt)a2tm( p;u0aptn oetydlsDemuvo;u)texrxocoydlmD  nei s0 rxoxm3io1lptelivsatf 2rrum ot0apxo oetadfsDranvp t) exoir3tytoa r neo s seur(o3nu4ole  ivslt sDururp;t0olt  i3taslaDrauvont0 leomo totlpD  ies;s  rumxmpou4ll  mfvtlt)aDuaump;o1olxnmictldlsDeluvo;t4aetoio3ty1la r u o t) exrxo3io1oltnmiviasf Dua(r oo1apeo f3tas aDrmnmp;u4treoio3iadfaD  ivs (0t2toxm nodaptn ivi sf 2rr(moou1tle iociadfm2uln p;t4aetrmr oatoptrlivil()texoxo iodaptemneil(f Dra(rpot4tle iociat s um(vo u4alxoxfcoodfp rlivsl(  2xrir3nu1lmee ieiasfarrmum ou1texoif3iys sDeau snu0 exomr3oatfaDelivo t sexrxo3iudal  mieiltf Dtmumpot0tpen feilsfmDuaums ()trtoxr totfpDranes;t s2xoxrpnudlpen fvt () Dra(rpno4oetn i3ilsfsDel( p t4 lxnio3totoa rlueo (  rtrxo iydoptn ncils)arrmumonu0ale mictls m ea(mo t4tetnio3tytfmD lu sl( s2xmio iy1lptnmici ()a2rrxmooo1optn i3iltla emuvs t0trtoir oydfmtranvo;s  eurimpoydopee fctltf 2tr(rpot1tlxomi3tad sDuanmp (4trxrif3iatopt  ueo t trtrxm3ou1llt mict tfaDtaxmooo0olxomo3ilsfsDulnvo t4arenir3todfa   i o;(0sruoio oo4llenmfet t srur(rpno1aetnif3tlsls2rmu s;t4tlenxr tytop  aivils)s2um(m iy1lp n fvsat arrr(r ;o0alt moetydfmDrln o (0tetomrcto1la  lieslt)trxrio3ny4lptnlnvta()aDua( p;u4ape ifciasla2umump u0alxnif ta1fpDr uvo t0 exmxmpou4ope lnci t) Duau  no4tlxomfcias mDrm(vp (0 ltnmrcoo1om r ivs;s0 ruoir3iu4al  mictlsfs2urxroot4openiieiaslm2emn p (0trenxrcty1fp rau ol()t2xo(rpnu4amte ies (fsDuru oot0apx mfctysfa umnvs;u4trxomr tatlp  ai o (0t2xrxo oy1amtelics t aDuau p;u4apx mfeiasls2eaums u4trtrir oy1lat  n sl() eurimpiy1llenmfeiltfaDum( ooo1tee moctyt s ra(vont0alxnmf3iy1om eaneo;t)teto(r nudlmeemnetl( s2ur(mpot4tet  fcias sDrmnvs;() lxnxr3oodlpte iei (0srxoio3iydom n nciasfsrrmxm oo1oleomoetad mDrmnmo t0 eeoioctytlpteai ol(0trtoxmpoodlm n fvsasf Dra( pou0tee  f3ilsfmDeau sn()tlxnxociadlaD  n o (0t2tr(mpoy1lpe livtat)sDumump;o1oetomoctat mDraumpn()trtrmr3ia1lmDe ies (0sexmxr ny4open ivsa( aDtrx  ;u4tex mf3ilt s eau s t0 rtrxo tydom r u i;( t2trxm3ny1oltnlnvt ()arrrx  ot1oexnmoctadfs2ean o;t4aexrmf to1opt aies t s2to(m3oudom   iesl( s2ur( pot1oexnifeiasfsDumu pn() etoxo oa1fmtraivilt0srtoim iydlme lnvt tf ruax onu1olxnmoctyd mDum(vp () exomocoydfp elneo;(  euo(r3oo1lp emfciatfsDrmxr ot1altomfciyslm2eanvo t)tltnxociotfa   u slt0s2uoxr3iudlpeelncilt)aruau p;t0alt  i3tlt a2rln pn(4arerxf oodlpDeli ols0 exm(rpiy1al nmnci s s2taumo;t1tlt moctasfa um( p;u4aeenif3ootlaDeluvilt) 2uoxopio4olenmietltf Duaxroou1olxnii3tlsfsDum(vo u0teeoirctytfpt anei;() 2umio3no4openlfci ()sDuru  oo4aptniiciaslmDrmumsnt)altnmr tytoptrliesl()t2tm(opou1lp n nvs t  2rr( poo1texnmociatfaDuauvo (0trxrif tatlmDraueo ( srtm(o3iydomee icsls  rtau  nu4openmfeils s2eauvsn(0aexnirciytfaD luvilt) exrxo nu4lpee fvsat)aDtr(m no0oet  o3tlt m2ra(ms (0altrmrcoy1fmDe uei t seuoxrpnydlm  mivi ()srurxr nu4opeomf3iydfm uau s;u) exoxf3oydfaD auvi;t0 ruoxo3iy1ap e ivs tfsrraxrooo1oetnmociyslm2rluvp;u)tlxomo3oadlmteanvols)sexr(mpny4ole mfcsl(fsrtmxm nu1oetoifctasfmDeau o u0tltoifcio1laD  ues;s  eum(opoudal nmfcsas  Duaxrooo0opxo feiytla2uanmo (4 rermr ootlmDranei () 2um(o3io4om  mfvs sf Dtrx  ou1texo f3ildla2ra(ms;(4 rxnmf iytlatelivs;s0 rxoir nodlmen feiltf Dumu  ;u1opeomietltfsDranmo;u)altnmf3iytoa e u s;(0sexm(m ny4ol n iet (fs2truro;t0alt mietldlsDrlumpnt4aeenir oadomtelnes;t s2xo(r3iu4opt  neiltfaDuaxro;u1aexomfctlsla eluvp;u) exrifctodlmDr n s;s0 etr(r no4ame mivi tf 2rmum ou4tlxn oeiadlm2uln p;t4trxrxf3ia1fm  au sl( s2um(o nu1aptemnct s artm( pnt4ale mf3tas sDelu p () etnmociatfa  aivilt  rxrxr3oy4lptnmfcil(  ruaxmonu0tpeomfciysfs2rlnvp u4 lxoxrcoo1oaDr n ilt trur(m3ny4ol elieiat  2ur(mo;t1oex if3iatlaDrl(mp t0artomf oadopt aneo;s teur(m3oydll eliei t)s2rr( ont4tetnmoetlt s ua(vpn(4 ltrifcty1fpteauvols)srumxopiudoptn nci sfa2trur ot0aetomoeiltfm eauvpn()trtrmociotlptraueslt0trur(m oudal nmieilsf Dtaxro;o1teenmieiytfsDel(mo t4aexrif3oy1oaDeai ils  2toxr3iy1ole lncs t  2umur ou1oeeomo3iyt sDrmuvp (0trermo3oydop  aivs (0seuoxr3iudlptemneil() rururpnu0apxnmfeias aDrau o t4 etnxo tydla   u s t0s2um(o nudol nmictlt) 2ta( p;t1oeeoifciysfsDrmnvsn() leoxrcto1fatrlivo t)setr(opoo1alenmnvtltfa2ua(  ou1texomi3ild a2rlu onu4trxrmr oodfpD aiei;t)texr(mpny1om   fesat)s2uax  oo1aetn i3iys mDulnvp;u)tetnio3tatlmtrai olt sexrxm3oy4apt mfet tfartm(r ;t1aeeo ocilt a ulums ()texrxocio1lm   uvi;(0teuo(o nodol  mivtat aruax oot0aexoiociltlm umums (4arxrxf3tydfmDrlnvsls0 rxmxr3iy4olenliei t)s2taxmoou0aleomfeildla2ulu s (0 eeoxf3oatlpte nvolt s2umxopiodameemnvias aDraum ot0opxoiiciadlmDrmn o ()tltrif3oytomD  i s (0truoxo3iy1ap n ieslt  2rmxmont4tleomieiad aDranvp;t) eermr ty1fateli i t0tetrxrpiu4lltnmfvi ()sDrmuro;o0apen i3iydfa2emuvo;()aetrxr oy1fpD  n o (0 rxrim3oydalenlfvsl()srtmxr no1aeeomfeilt mDea(vsn(4tlerxf iytlpDrlivolt)setrxopou4optnmncias) ruauro;u4tlen ocilsfsDemnmon()trtrio3iatom r ivs;t setoio oo4lpt mfci s srtr(  ;t0oeto feiyt s2rlnmp (4 etnmr3tadlp eli o;s) rxm(mpoy1optn iei s srrrx pnu4oeeomo3tyd mDelumonu4trxrmo iotop e nvil(  exriopiu4opt mnesas) rua(mpnu4teto oeiad a ea(vsnu) leoxo3ootoatrlueols)t2umir3iudale  nciat a2ta(mpot0tee if3iaslaDul(mo;t4 exnio oydlpDe ueo;s0seumxrpoy4opt mivtas)aDrrum ;t1texnmoctytlaDran snu)trenxr oo1omt  uvi s)trxoim3iu4lp n icilt) Dtrxm ou1alxo i3ilsla2emnvp;t)aetoxrcootfmtrai s;( s2xoxm3nodlmen feilt)srrau  oo4oeeomfeils sDemuvs;t)tlxnxociatom rli ils)sexrxr3iy1lm  livsls) rurxr ;o4oetoii3tas s2rlnmp;(0artnmfcootlptrau ils)srtmimpiudll elfvt tfaDta(mono0tlt mi3iys a2umn p u) etnmf3iy1lp  li i;t sruo(mpoudlptnlfeil(  rtaxront0apeo iciyslaDumu p u4 lxoir ia1optr u o;t t2umimpnudlltn nctlt)arumuroou4texn oeildla2raums;u4 rxnir oa1op  lneilt texm(m iu1altnmnci s  rumum ;u1texn o3iadls2rlnvpn(4 ltrio oydlmD aivi t0s2xoim nydoleelneilt sDtaxrp;o4aeeomi3iysfmDelnvp;t)tlermf3oy1oa eai o;s0 etmim oudal elfcilt) Dua(mooo4tpxnmfetydls emu pn(4 rtrif3io1lpteauvi t0t2tr(mpiy4amtn icias  Dtmx p;t0aetomocilt s eanmon(4 lerxr todlatran ol(0s2xmiopoydomee nesat)s2rmurp;o1apx  fciad a rlnvsnt) rxrxf3ta1fm eai il()tetrio3nu4ope  fcslt a2uaurpnt4altn ociltfs2rl(mont4tetrmr oytfptelivs;t0teumxo iydamtemiet ()sDurur no4olxnmoeiltfs2emnvs t4aexomf oo1om rlu olt0texoxrpno1amtemnetls) 2ra( pot1oltomiciltfm2uauvp u)alerxo3tadlp elieo t trumxm3nudole mnvt ()arra( poo1olxomoeiydls raums;(0 etnxo oo1latrln il()s2tm(m3ny4lpeelnvsa(  2tmx ont4olen fciadfmDua(ms;t0alxnmr3tadlaD  nei t0 exmir iy1lm emfeil()srtmumpou4aptomoctadfs umnmsnu0altnxf iy1fpt liei;s0srtoirpiu4ame  net tfsrrrxr ou0tpt mf3iadfs2umnmo;t0tlxrifcio1fpt au i;t0trurxm iudoleemnci sf rtru p;u0tptnmoctat sDrlnvp;u4tetnxo iodopDe neolt  rtr(o3oy4ape mfcsl(fsruaxrpou4tpeomfcildlsDranvs;t)tlenifcoo1lp   ieols)s2trim nydllt  netas  2ta(ro;o0opt mociltlm rm(ms;(4 eeoio3oadfmD luvi;t) rxrxrpio4ome mncs s a2tmxro;u1oleomieiyt s2eanvp u4 rxoxf oo1fm e i s;s0 exrxo oudll   ictl( srtr( pou1alen oeiat aDelnmsnt0 etrmociy1lp  aivo;s0 2toiopou1lpe mfesas)arraur no0aeto ieiasls emn pn()altrxf oadopDeln o;t) ruo(opio4ole lnei (faDrrx ono1tee iociasla2rlnvpnu0aexoxr oytlmtrai o s)s2tm(m3ou4lltemfvtasfs2rauro;o4ape  i3iyt m2ranmo;(4aleomr3oatop e uvs s srtr(r oodalt  nvsat) rtaxmp;t1apxn ieiydls emnvsn(0tetomociatlmDrauvi;() 2uoxopnodap n nvsat) Dtrxmpou4opeomfciytlmDul( snt4alxomo iy1oa   ivsls s2xmio io4op e nei tfsrraxr oo4olxomoetadfs2rl(mpnt4tltnio iy1oat aivi;s0sexoio3iudapeemfctl( srurx pou0oexo oetadfa2umnvs t) eeoxf oo1fatr ieol()sexr(r3ny1lpe  nvt s) ruaumono0apenmf3ils a2umu ont0 rtnmociadlm  aueo;t s2xo(rpiudlmtn fctl()srrru  ou1alx  ociltlm2ea(mon(0 lenmr io1fp   neo;t trtmim3nydlm  mict s)srum(r ou4olxnmiciasla uanvpnu4tetomocia1optraueils0trtrir oodlpeelnciatfs2rmx p;u4tlx moeilsfm umnvs t4teermrctodfmDr uvs;s) 2xrir iy1ame mieilt aDtmxmp;u1tptn octadfs eluvonu)altomo io1fmteaies (0 eto(opno1lpt lfvi t a2tr(m ou4alx mieilsfm2ea(mo t0aexrmo3oy1oat  ieo;s texmir no4alt lnet t)sDur(ront1oex ii3iad a ul(mp ()trxoir3ootomtrauei;t0sexrio3iy4ap elfcsat) rtrur no4tlxnmoctat a rl(mo;(0trtrmo3iydfatrluvo;(0trtmxo3ou4am n fcils)sDrr( ooo0teen ociaslsDeanvsn()alxoir ia1fm  livs;( t2xrxr iodope liei s  2ur( o;t0tee  ieildfaDelu o;t) eeoxr oatfmDr nesl(0t2uo(opiu4ll nlivs s)arrmur ;u0tpe  fciat a emu o t)artrmo3iadoaD  neo (  eumio oy4lle mfvt s  Dtmu pno0tltoiieiltlmDulumsn(4tltomo3oatla elivo;t) etrxo oy4aptnlnvta(fa2rr( oou4oetomoctadfsDrmnvp u4aeenio3ootfpt an ol(0 rum(opnydal n fes ()arrr(rpno4tlxn i3iatfmDemuvs (0 leoif iatlpteln o t0s2xrxo oodom emfes s srtmxm nt0tex  ieiaslm2rm( pnt0 eeomo3oytlpt  n s ()texoimpou4lmee ivsl(f Drm( pou0alen i3tyt m elnmp;u4tltrirctodlm eliei;( s2uo(o3oy4oleemies (  rumxr no4aet mociytla rl(vpnu0 eerxo tadlp e ueil() 2xm(o3oy4lltnmiei (  2raur ou0oexoif3tad s2rln p ()aexrxo3to1fatraieo;()srto(opoydam elies tfsDtr(rpnu1apxn f3iadla2uluvont4 eeoxrciadopt ln i;s) 2umxo nudaltn ivtl( aruax o;o0aptomoeildfa2rmnms;t4arermr to1opD  n o s s2toimpny1ome mneilt sDrmu  ;u1tlxo fciysla ranmo t4tlxoif3ty1la e ues s t2uoxr3iu4opeelicsatfartru pno1olt mieiytlsDrm(vs t)aexomo oatlm raues;t tetr(o io1ll  lncsl(fsDra(ronu1ope mfeiytls2ul(vs;t)tltrif3ty1omDelnvils  euo(opnu4olee fci sfsrtm(  ou0optn f3ilsfs ra( p u0 eeomf oydoa eaies ( seum(r iudllt lnvslsf Dta(rp;t1oltoifetasfmDrmumsn(4 eermociodopD  ues t)trumxo oo1omtnlnvsa( sDur( pnu1aeeniietldfs eanvsnu4aetnmo todlmtrlnei;s)trxrir oydalee ivtltfartrumpou4tpen fctat m uanmsnt)trxnio tatfmte nvo;s  eum(r oydolenlfctls  Dtr(r nu0apt iictyt a2umu pnt0trtnxr3todfptrln slt0 2toxrpoudomtelieslt)a2tmur ;o4ole mf3tas sDraumo;t4tlxoir3oatop rauvi;s trxrir3iudlpt miet s)aDuaxr nu1oeen fetatfa2ulu snt0tltnxr iy1latelnvs s  2xrim ou1apte ivtlsfsDumumono4alenii3iyt m2emnvont4 lxnir3oytlpDe u ol() rxrir iodal n fcslt)srtru p;o1tee mfctlt a2ra(mo;u4altoxoctotopt lneo (  etoxo3iu4opt micslsfs2umu pnt4oetnmicilt m2uau onu4treoxociydlm e nes (  euo(r3no4om nlfeiltfsDtm(rono0opt mieils m ra(mo;t0aeenifciydlpDrlueolt s2um(m3io1omee neslsfsDraumo;o0alt mfctyslm2um(vont)tlxoir3ia1om   ies;t) rxo(o ny1lmee fvias aDrmu o;u1tpe ioeiyd a ulump u0aeerio oodlaD luvsls)srurxr ou4opt  nctlt) Drmumont1teeniociytfs umnmp t)trenxo ty1omtr i s;t sruoim nydol  lnet () Drrx  no4aex mo3iltfmDea(mp ()tlxoxo3ootopDr ieo () rtr(mpny1oltemfet t  Drm(moou0tet io3iltla umnvsn()aetrxr3iotomtraivo t)teuoxrpnu4ap emiciasf 2tmur ;u0oeto ociyt s raump t0 lxnxf oodlpD lieo;s0trxmiopou4alt  fetasfa2um(  no0alx moctldlm2ra(vs t) rxnxf3oatlptrlivo t0seumio iydomte fei (f Dtmurpou0oexoif3iytfa rlnms;u4 lxrir oodlaD ln olt s2urxr3ny1optnmfcs s  Dumu  ou0tpenmieiadfm rlnmsn(4trtoioctodfa  lnvs;s)srurxr nydlmenlictltf rumxro;o1aleoii3ilslaDuanmo;t) renxociytom  lnvs t s2uo(m3oodlptn fvtas)s2raxro;t1aexo ieiadlaDelnvp t4tetrio3oadoat  u i;s) 2urir3oy4lpt  fciat s2uaxr ;u4aeenmiciatfm rl(vp;t0arxnir ootlpDrlu o;( srxo(r3oo4om elfctat sDurxr oo1apeo i3iysls2rl( p u0tlxnxfcty1latelnvo s seuoirpno4omtnlnvt (fa2um(mpoo0tpxo fetldfa ul(vpnu) lxoxr oa1fpDraieo;s0 eurxm3no1alenlnvtlt  Drrx oot0olxo o3tys m2ulumon()teeoxociy1lpD auei (0trxmxmpiy1omt lnvsat)a2rm( oou1apeoii3iyd a2rmu s t0aexrxocio1lm eanei;()texrxrpoudop   fct s a2rmu  ;u4tpxo feiytfa2rl(mo;()texnif3iatlpD aueo t t2xmxo3nudop  mnci s  2tm(rpno0tle  fciltfm2rl(monu0tltrxo oytomtrlieo (0t2xrxopiy1lp nmnci ()a2uaxmoot1tlx  octydfa2rlu p (0 renmfciodfmD liei t0seum(r oodopt lictasfsrtaur nt0texo feiatla rmn snt4alenmo3ia1oa  aues s s2trimpio1am emfcilt) 2trump;t1apxomoeils aDemnmo;(4aetoxf iy1lmD lieo t)s2xoiopio4opeeliei t) Dtr( pnt0tpeoifeiyd a ranmonu) ltoir3ty1omt  u sl(0 euoxm3oo1altnlnvs ( sDrrum oo4oet mo3iytlm2el(mpn(0 lerircoatom  ai ils s2toiopoy4al nlfcta(faDurumo;o1teeoifeiytlaDeauvp u) rerio oatfpte iei;( trxo(o iu4am nmiei t)s2tmx  ;o1alx mfctadla2rm( o u)artomr3oadlmDraies;(  2urir3nu4amtnmncsat s2um(r ;t4opxoiieiytfa2ra( o (4teenir3oadom r ies;() rum(rpou1ol elivi ()s2umxmoou1openmietlsfm umnvpnt4areomo iy1fmDe ivsls0t2xo(r3no4apte netas)artrxrp;o1teenmfciys m em(vp u0aexrmr tatlaDeau slt)teto(o3oudlmt  fvil(fsrumx o;o1aetoiocias aDul( ont0tltnio iydfmD  uvi t sexoim3nodol  liesas s2uau  oo1tptn oeiytfm2raumo u)alenmr3ootlm rlues;s0s2um(m oudlpt mivtat)srrm(ro;o1tlxomi3tysls2ulumonu)alermf oo1lpDeli o;( trtmxr3oydapt mnvias  2rm(  ;u4altomictld a2eaums;u)tleoxr oatom  lnes;(0 rxrio3oy1lm elictlt sDtm(rpnu4tlx io3iadla2umn p;u4tlenxf oytop raneolt  rumxo3oy4ll elici sfaDrmumo;u0aeen o3iydlaDul( o u)altnxf3oo1lmDean il( sexoxmpou4al  lfvi sf 2trx  ;t1oleoif3iydla2eauvs (0aetrmocoytopD  nes s0s2toxo iodlmtemncs ( s2urxrpot1tlt  ieils a2rm( snu4aleomo3oy1omDe ueils truoxm3oydom emncsl( srumx ooo1apxoioctadlaDeluvp;(0trtomrciadom  aneslt0 etmxo3nu4alen ncsls sDumu pnt1teeo feiat m elu s;u)trtrir io1fpt  ueo t0 euoir3io4olenlivta(f Dtmurpnu4oltn icilt mDeln ont0trermr3oy1fmDe ivs t0 rtriopnudopen fetls)srrmu p;t0ope  fetlt a2ran s;t4 etoif3oa1lmtr i il(  rxr(r3io4lm e fci s)sDumur ;u0tleomociltlmDumnms t)trtnxr3to1fat  ivs (0s2xrxr oo4lm n ivt s)sDurur ;t4opt mo3iasfa emnvp u)trtnxf3ty1latrln i;t)t2umir nydllenmivt s) rumx  ou0optn i3iadfa eaums;()aeerxocia1laD lnvs;s0s2umio3oo4op nlics ()aDurx pno0tlenmi3iys a2uln p u)tleoxf3iytfm  anvil(0s2urirpiu4am e fes (faDrr(ronu0apenii3iltlsDrau s (0 lxnmfcty1lm  lnvolt) 2tmim3ny4altnlivsl()srrru  ou4oeeo oeiatfa ranvpn() rtrirciodoat anei;s  ruoirpoo1lmenliesls) rrmxmooo1oltomoeiadfm2umnvp;t4aexoxf iadop   neol()texriopoo4amt lfcsa(f ruaxr ;t4tee mf3ild aDel(msnu)alxnmocoatfa  aiei;t) euoxrpnodamenlfcsa(fartmum nt4aetniiciytfaDelnmp (4alxnxf3iadfa  lneil()teto(mpnu1lpe lnvta( sDtr(  ;o4aleo feiadlaDranvo (4 etrmo3tatfptraneo;s t2tmxrpoo4apt mietltf Duru  nt4apt ifetyt s2umumo t0trxoxr3oytlat anvsls) etm(o ou4lle  fvt ()srraxrpno0olenifeiatfs rmnvs t4tltnmrciotfpt aieol( s2xrxrpoy1omtnlnvsls aDurx poo4apx  feias mDrm(vs (0tlxnircoadopDr i s (  etr(opou1opeelfctl( aDur(ronu0tpenii3iytls2uanvo;t0tltnmf3oatlaDelu sls  2xoio no4lmtnlfetat sDrrx p;t4apxo ocils s uaumo;u4 exnmocoadlmD liei s0trtm(m oo4lme lfvi ( aDtrxmono0tlt ioeiatls2umnmpn(4trenxo iotfaDranvols0 2tr(o3no1llen ivi s arraur nu4olto i3tldlm2em(mo u4tlxoif totoaD  uvs s) 2xm(r oo1alenlfvs ( sDuaumooo1tpxo o3tyd a ran ont4 lxnmocto1laD ln s s0tetrim3oy1lm emivi sfsDur(rpno0opxnmicild s emn s u0 reomo oa1omt  i o t) 2xmxrpiudopt miet t  rrrxrpoo0aexo ictysfs2emuvsnt4tleoir iy1op ran slt)trxrxm iu4llee icslsfa2trurono1tpxn o3iadfmDua(vsnt0teeoxo tatlat  i i;s s2tmxo3iudlptemivt ()arrrx ooo0altomociytls2rln s;(4tlenmocta1fa r i ilt s2to(rpnydllt lnvil(  rum(m nt4ape io3iatfm2ean sn(4arxniocoydoateli ilt)t2toiopiu1amt mivtlt  rraumpoo0aleo fciytla2rmu p;t)arenmf todomtelueil( trxoxmpiy1omeemnes s a2ur( pou0tlxoif3iydfm2rlumo;(0 lxnmr tydfatr ivs t0 rxmxopiodop nlfcil( a2ra(rooo4aptnif3tlsfm2em(ms (0texrxf3tatfmDrlivilt)setrxm3iy1oleemiesasf Drmuront1tle moetldlmDuauvo;t4aeenio tadomt  uei ()t2umim3iudomeemieilt  Dtmu p;t1teen fctysfaDrauvpnt4tlxrio iodla  ln i (0s2toxopoydlltnlfvsl()s2rau pot0tet  o3tytla2emnvpn(0 eeomf3ia1lpDe i o s0 rxo(m ou1ol   fesls sruru  nu4tpeoifcilsfa ea(vp;()alenxo iatfp ranei;s)s2xm(rpnudop emnvsasfsDtm(m nu4oltnmo3iyt a2ranmpnu0 rxnifcoodfaD livi s setr(r3nudlpt  ict t artmxm ;o1opt  fctydla2rau o;t) rtrxr tadopt liei t0s2tr(m oy4lltnmfcs ()srrauroot4aet  o3iatfs2em(ms;u) rxnxo io1oa elnvo t  2tmxrpnu4amenmfvtltfarum(rpnu1tle mo3iydfaDeanvo;()altoxociatlpD  ivilt0 rxoiopnu1lle mnvsas)aDtrx o;u4tpenioetas m2rmu s t)tlxomfctotoptr i i;s)srxr(m3no1ale mfct t)artm( o;o0opeoifetadlm ea(mp t0 ltoxfcoytlp rlneols)tetrirpiu1ll nlivilt arrr(rpnt0aleoii3tyd m2ea( s;(4 lxnxo tatlat  ueo t  rtm(opno4ol nmncs s)srtmxrp;u1tle miciys sDelu pn(4arxomr tadop   n ol(0trtr(rpio4omenmfvsl()sDta( o;t4oee  i3iaslsDumuvs (4aetrxr ty1omDrau sl(0seumir3oydaltnlfes (  rumu pot1opeomoeiydfs2emn onu4tlxoxr3ia1lm r ivi;t  2xrio iydam  mivias artmx  ;o0oet  octatfa2uauvsnu4arerxf3oa1om eaieols0tetmio iydale lnctas) 2rrx  ;t1tee  o3tadlmDea(vpnt0tetoxo3ootlat an ilt0trur(o3nudale liesa()sDtm(mpot0tptoifetys a el(mpnt4aleoio todla e ivils)s2xm(m3nydamtn fctlt sDuaumoou1open fetasfm2em( s;(0teenio oydlpt  u ilt trxoxr3iu1aptnmict t  Duaxmo;o0aetnmfctatfaDrl( snu)alxrxrcoytlmt lueo t t2tm(opoydlltelies (fartmum ;u1altnmociydlm2uluvp u4aeeomo tytlatranvol()t2tr(o3nudap e fci sf Dra( pou1tet iocilslaDuau s;t) exrif oadomte ivslt0t2uo(r ny1olt mfctat) Drm( o;u0tptoif3tyd a2ranvo;u)texnxf3ootfmDrluvi ()trtmio oy4amt  fetls s2urxr ot0tetnmo3iyd a rl(ms;u4 etoxoctytomt  nvslt trtm(opoy4lpe  ivtat  rtm(  oo1tlt  o3ias sDemnmsnt0teeoir3todlmDrlnvsls teurxm oodop nlfcia()a2ta(rooo0aleo o3iltfs ra(vpnt)artomr3tatfm ranvo s  rum(o3oo1ap nmnetas)srur(mo;o1aex  ieiaslm ranvpnu)texnio oydfmDrluesl(0 exoiopny1ap nmicsls) Dumurpot1alxomfcildla2rm(mp;t0 reoifcoodlpD  ieo s) exmxr3nu1llen netls) rtr(rpou0tltnmieiytla2eluvsn(4alenxf to1fm  lu o;t srurir3io4amtemfet t aDua(mpnu0apt moetldls raump u4altnio oy1fmD auvo (0trtr(opoudapt mfeias)srurxm oo1alto o3iyd aDuau s u) etrif3iatoaD aivi;t texo(o3ny4olt mfetas sDurx p;u4ale ii3iys mDean p;u0aexnifctydlmDrau o;s)t2umxmpoodolte icsl(f rrmum nu1olxoiiciasfsDrl(ms;u0 eeomf3oytfa ean ols)texmio oy4lptelictls a2rmu  nu1aleomoeiadlm uln pn(4trtnmo tadoateanei ( t2trim no1lptelivsas  Dur(mp;u4tet moetyd a rlnms;()aleomf3tydfpD aueo ( trxmxrpoo4optelnet ( s2ua(  nu0aex mf3iys sDeanmp t) reomr3ia1laDeai s s  rxriopiu1ape liviasf rtrxrono1tleoif3tatlsDulums ()texrxo tatomt aieol( s2tm(rpoo1amtnmicsls  Drmum no0olxo oeiyslsDulumo ()areoir tatlaDran ol( s2toxr iy1opt lfviat)srum( pnt1tpx  icilsla rau sn()aetrmf iodlat  i s t setm(opou4lleelfcta( a2umxmoot4opxnii3iaslmDem(vs ()trxnio oytomDe u o ()srxr(o oo1lmt mfvsls aDumumont1tpxnmocildfaDum(vs;t4tlxoir io1opDelnes ( srxrimpoodam e fct (  rtmxro;u1oltnifciat s2ea(vo u)trxoxr3tytoptean ils)s2xoio3iydole  iesas) Durumpnt0oeeomocild mDeanmo ()arermr iotlp rauei t)sexmim nu1ole mivta() 2rrum ou4tlxn i3tytfa ra(mpnt)tlxrxf ia1op  lueslt trum(r oo1omen fctl()srtrxrpno1oeto ieils m eln pnu4teeomrcta1fmtelneil(0 ruoxm3io1openmivil()sDrrum oo0tptoiieias mDemn o;()artomrctodoateaies s0texr(m nu1om n net () 2taurpoo4aptnifctlslm el(monu0 ltrmf iatlpDean s;s)teto(o3ny4ol   ivtatf Dur(mpot1aetomieiatla em(mpnu0arerif io1fp rai i;() 2xr(r3nodoptelicilt)srraxrono0oex mo3iys s2ua(von(4tetnxo io1opDrauvi;( trxo(rpiu1lleelfeilsfsrraumoot1altomi3ias m ea( snu0 lenxo3oo1fmtrli s ( trurxr3oodlmt mfvsat  2urur ot1aex mfciytfsDeluvsn(0trtnxrciytomtr ivsl()s2toir oy4lpe mfcs s  2ta(rpou1tlto ieilsfa2el(vsn(4tetnifcoadomDeluvi t)tetr(opnu1om   netltf Drrumonu4alt mi3ias a2rln p u0alxrxrcoadoateanvi (0teuo(o oy4ll emfvia( aDtmu oot0tpxomo3tlt sDuanvonu4 rtoifcoy1fp r n i s0t2ur(m3nu4apeemnvi ()sDrrx  nt0optn ieildfm umu o;(4 rxrir3ia1fate nvo t) exo(m3iu4olenmfesat)sDumx pnu1ole moetldfs2emnmp;(4 rtrmo oadoaDr uvols tetr(opny4ol  mfcia( s2taur oo1aeenmf3tlsla2elnvo;(0 rtnxrcoydlm  anvolt0teur(r3ny1lptn ictas)s2rm( p;u1oeeomf3ildfmDrm( snu4 lenmf io1om raieilt0srxoxrpno4lptnlfvi s)sDrr(  nt4texo iciysfaDeluvsn(0tetrxf to1omteai o;() 2xrxo3iodamtnlivi (  Dua(mono0ole  f3iaslaDean p t4tlxnio3oydfpD aivs;()trxm(m3ou4lmt lfctatfaDumur nt4alx  f3ilsla2rmumo;t0arxrio3oadfpteau s s0sexrim3no4al nlici (fsrta(rpnu4apt mfciyd s2ranvo;t4tleoio ia1lp eauvol()t2xmxopiudlmtn nvt (f rtrxm ;t0oeto fctydla2rau pnu)altrif iytfmt aues;() 2xmir3iydol  mictat)sDumuro;o4teenmictadla uanvo;() ltnio ia1latelieslt0t2trio no4altelfetl(fs2rm(m nt1oexn ieiadls2ra(vpn(0 etrmo3oydfaDr ieo;() rtrio oy1lmtnlnet sfs2umu o;o1oltoioeiysls el(vp ()alerxr iatfmt an sl( trxo(o3no4omtnmieilt  Dta(rpnu4aptoiieiad aDulums u0 rxoxr tadfmDe ivo;() rxmimpou1ap emfcilsfarrax  ;o1tltoii3taslsDelnmpnu4aetomfcoatlpD  nvsl(0s2xrimpio4amtnlivi t s2tr(r ou4oex  fciydls2ua(vs u4tetoxociotoatrliei s0 rtoim3ou4lpteliei (f Dumxr nt4olxomo3iad m uanms;t) etnio3iy1om elieslt0texmir3nydllt  fctls) rraxr nt0aptn f3iysfaDrln onu) rerxrcia1omt ln ol() rxmio iodamtnmncsat  Dtmxroou1oetn o3iadls em(vp;(4aexoir3tadomte ies (0srxoxr3iudope lnei t a2tmur ou4alto fctasfs2rluvont4aeenxr3iodlaDrlnei () ruoxrpiudapenlicta()a2uaxronu1altnmiciys mDrau pnu)aexoxfciydfm  lu sls  2xo(rpiy4al emfct ( aDraum nt0ape  ictltfmDel( pn()tlenmo oodla r nvs;()s2toiopiudom elfvtlsf Drmxmono1oetniiciysls ea( s u) exrxo3totfmDeluesl(0 rxrxr3ou1optnlnetl()aDum(m nt1oleniietadlaDrlnmonu4tlerir3ty1lmDeli s (0s2uriopnu1lleelivt (faDuru  nt4openmietlt a uln p;u0arxomo iotlpte nvil( seto(o nydap  lncil(fsDuax pno4ape  ociltfmDra(mont0 eenxf3tytoate uvslt) rxmxrpiydomenlfctlt)s2rrxront0apenmfcild m uanvpnt0trtnxf tatfpDr neo;t sexrimpiu1ll e nciat  Drmu pno4teen fctadla eauvon()arxoxo3oodla rlivols0 rurir3ou4optemfvt (fs2tmx  ;o4aee  ictytlsDrauvs;u4alxoxr3todopt lu o s0 2xm(o oy4op nlfetlt)arum(mpno4apt  i3tyslaDul( s t0alxnmfcta1la rauvils)s2xm(rpiydlltemnctltfartaumoot0aleomi3tlt m2umnvo;() etrmf ia1fat anvs t  etoimpiu4op emict t  Duaxm nu4openmf3iydfm umnms;u4trtoif3iy1omt ai ils  2urxr nydll nmies t  2rax pot0alenmfeiat mDrm(ms (0aexnmrciotlptrluvil(0seurio oydom  lnctat a2tmxrp;o0teen f3tad aDeluvo;u4alerirctytlmtean ils0 rtrirpny4om  lnci tfaDrmxm oo1aptn f3iysfm rl( o;u4arenifcoytfmt au o;s trxm(rpoodalenlnct ( a2rrur ;u0ale io3iltfs emu sn()texnxo3iy1op rlneslt0srtrxr oydal e fesas artmx  ot4tlxnmfciadlmDrmn p t0artoiocoatomD aneo (0 euoim3nudomte ietlt)aDumu p;o0apto o3iys s2ra(ms t0 leomocoadlate u olt  exoxm nydam elfvsat) rtmxr ot0aee if3tytfm umnvs (4arxrmoctytla r i sl(  rxmim3ou4lmee ict t)sDrmumont0ope  oetyd a elu s t0artrirctadfpt lnvo t0srtoxo nodolteliesatf rtrump;t4tlx mi3tlsfm2eluvs u4aeenmrcootomD  i ilt0 2xoxr iu4lltemnet (fsrum(r ;o4opxnmi3ilslsDumnvpnt0tetnmrctotlmtraieslt trxr(r3nodlm  lfctlsf rtmu o;o0apt mfeiyd aDeanvs;u)trxoio3todfmt  ivsls srurim3ny4ap emfeta(faDum( p;u1aleoif3iatlaDrl(msnt4artoxf3todomD  u i;s)srtm(o oydlmtnlfetls) 2tmxmonu1teenmf3iysfsDea(vs () lxomfciodfp r ivo;s0 2xmxr3iodape mieslsf 2ta(m nt4texomf3iltla umu onu4trerif3oa1lmtr iei;s0seto(r3oo4olen nvslsfa2tr(r ;t0olxoiiciltfa umu o (0teerifcto1omt  neo (0 rur(mpny4ol elfvs s srua(  ot4optoii3iltls eanvp ()artrmo3todlp rlueil(0 2xo(rpoudoleelics s artmxmpot0oeeo ociatlaDumnmp;()alxnmr3iotoatraueslt)s2xmxrpio1am e nvsat  Drax onu0tleo i3ilsls rmn p u)aexomoctodfpt  ieol(  etmxrpiodomtn ict t artr( oou0oet  fetat aDuluvo t0 rtnxf3oytfmtelnvilt0sruoxo io1alt  ietasfsrta(rp;u1tpe  fctad m ulu s u4aeeriociydlat lieolt t2umxr3iy4amte fesls)arra(ronu1tlx mfciytfmDrau pnt0aexrmo3ia1fat lueslt) ruo(o3iu4lptnmneiat srrr(m ot0apt ifeiltlmDeauvo u0 lxnxrciatoa elivols) 2urir nydole mfeias srrr(ronu1oexo oeiysfs2eaumsn(0tlenmfciatlptranvi ()t2urio iy4omenlfvtat) rrru pnu1apt  fetldlm elnmon(4 rxoxr ia1fmtraivs s0teur(mpnu4al e fvta(f rur(m no1oetoii3ils aDumuvs (0arxrmrciytfptran o;() ruoirpny1amenlivi () Drr(r ;u4tleomoctysfs rl(mp;u4teerircoydlaDeaivi s s2trim3no1lp  mietat  2tax  no4oex ioeildfm ua( s;u)arxnxociatla elieil()teumiopiu4omee ivt s sDra( o;u4aexnioeiltls2ean o;(0 ltrmfcio1omD  ivolt)sexm(r3oy1lpe lfvia() rtm( o;o0tet  fctadlmDrmnmp;u)teeoiocoytfmD  uvs s0 2uoio ny1amteliesl(  rrrurooo1olxo fctys m2umn o;t0 exnxr3iodom rlu slt0teumxrpiu4apt lfei sfs2taur ;o0oex mo3iaslaDumu onu0 etrmf iadfmt livi;t) exr(r ou4om   iciasfsDtr(r ;u1opt mociasls rau onu0arxoircoa1lmte n olt)s2xo(m iu4am n ictltfa2tr(mono1oeeomfciydfm em(vs ()aexoir3todlmtelies;s srum(m oy1opee fciat)a2umumo;t0tpenmoeiltfm2uln o;t4arxrxf3iadlmt  uvolt)teuoxm ou1op  licilt sDua(  nt1olt iieiatlsDrmuvon(0tlxnio ootfmDrlneslt)setoxr3iodopt livsl()a2ra(  nt0texnmi3iasfmDra( p;u)trtomfcta1lp raneo s0s2toim nydape  ici (fsrraxrpot4teenmo3iysla elnms (0 etrmo todfaDe ieslt srxrim oydameemfcslt) Drax p;u4olen ietadfsDemu ont4trtoif3ty1fpteau o;s)t2umim3no1apee ivsls  2tru  ot1openmf3iyt aDeanmsn(0 rerxrcoadfp eluvolt  exm(opou4ome mfci ( sDrau ono4oeto fciytls2eauvo;u0alxnmrctytlaD  u o;()s2xr(m3io1opee iesatf rrr(mo;u0tetnmo3ils m2um(mp;(0tlxomf3todfpDrluei s0truoxrpoo4amenlnet (f 2ra(rpno1apen f3iys a rm(mp (4 exoxr3oa1opteluvi t seuoxr iy1opte netlsf rraum nt0apt  i3iatlaDrmnvo t) etrxo oytfp   n o;( trxoio3iudlmeelnci (fs2rm( onu1opxnmo3ild a ean ont4tlxrir iatfp   nvo;t srxrxm3nodll elfei s)s2ta(r ot4opxo iciltla2eanms;t0teenmfcio1omDrai o (  rxmxr iodll n ivil() Dra(moou1apeomoetyd s2uluvsn(0trtoxf oa1la r i i s)sexrio3iy1lp nlncias  Dtaur ot0oleo f3iasfs eaumo (0trxoif3iydla  lues s)seumir nydap elivslsf rtmx  nu1altnio3iad a emu o (0tetoxf oadomt  i ols0 exoio3no4ol emivtasfartm(  ;t1texoifciys s rl(vs;t0 exrmr oo1lp rlieo;s) exmxo3ny4olt lietls) 2uaxmo;o1oeenmietytfa2uauvo;()alxriocoytfmD lu s;s s2tmim oy4ll  lict t s2uaxrono4aexn ietydlmDeanvp u4 ltrxfcoy1lateluvs;t0s2umio no4am nmfeiasfa2umum ot4alxo feiaslmDemnvp;(4tetnmf3iotfmD lnei s tetoim ny1lleemfct sfs2uaumo;o4apen feiasla2rau p;()aetrmo io1latraueo t texmxo iu1lltemfvtasfarrmurp;u4tetomf3iadfaDumuvsnt) etnxrctytoate i o;( texr(m3nodlmte ietat sDra(r ;u0tlt moeiyd aDea(mo;()arenifcoy1fmteau s;(  etmxo3io1ol  mfctasfaDrrurp;u0tpto iciadlsDem(ms;u4aetrxf ootfmDrluvi (0tetrxr iydam nlivilsfsruau  no1aexnmi3iasls2umn onu)tlxoxr iadop  lies;t)trxoirpiy4lmtelivs s)aDtr(moot4alen ietltlm ran snu)alxnxfctytlptr nvsl( t2xmiopnu1op  mfvs s srtrxroou0tpeomf3tas sDrmuvs;(0tlxrmo3tytlp rli o (0tetr(rpiu4lltelncs s  Dtr(r ;t0altoifetlslmDua( p;(0 rtnmo oatomt  ivs;s sexrxm iudole mieiat srtm(mpnu0aeen iciyslm2eau o t) lxnmr totoptean s t seuoxo3iy1op nlncs ()sDraxm ;u1tetoifctydlaDua(vp t)altrmo3oytfa  livo s setmio3ou1lm eliei s)s2rrxmpnu1aexo iciad mDulu o;u) lxoxoctatla raneils t2xm(r3oo1ol emnctl(  2ta(mont0olto o3tasfs um(ms;u)trermf3oytfpDrlneol(0seurim3no4lm n nei s) rrm(ront4oeenmieiysfsDrlnmp;t) ltoxr3iadlp eauvs;s srxm(r3oodlpenmfcslsfa2rr(moou4oetnii3iadfs ean ont) lxrif tadfat lu sl()s2uo(o3ou1op e fet ()sDuax p;u1olxomf3iltlm rauvs;(4arerxfciotom rlneolt  2xmxo oodlmtnmicslt  2urumonu0tpto oeilt a rlumpnt4tlxrxr3oo1oa ean i;()trum(o nu4ol  lies t srraxmp;u4oee ii3ilt sDua(mp;t4altoirciadfpD  i olt0s2tmxo oo4om  lnetls)aDra(  ;t4tlxnii3iatls eln p t)artrxo ta1lp raieo;s)trtoio3ny1ll nlfeil(f Drr( o;u4alen icilslm rl(mo ()areoiociy1fpteluvi (0t2uo(mpno1lptnmfvta()arra(ronu0aleo iciydlmDuaump;(4trtoxrcio1lm rau ilt) 2xrxr oo4lmenlneil()aDra(moou4alxomfctytfmDuaumonu0 etrio3oatopt  ueil( s2xmxmpiy4ol nmiciltfartmu o;t1aexoiociltlmDua(vonu0teenxf totopteanvo () rurxo3nodomeemiviasfaDuax  ot4apeo oeildfm ulu s;()trxnmocootlaDe nei;s) 2xo(m3iy4ll nmnvsltf rtmxronu4texnio3iasla raumon(4trtrif3tytla e ies;(0tetr(r3ou1amtnmncsatfartru o;t1tlen f3ildfm umu on(0alenxfctadomD aivo;t setrxmpoydap nmnvta(faDtaxr ou4tlenmocilsla emums (4tlermfcoadfpte ueils0t2to(r3oudalenmietlt srumumpnt0opxo i3tydlsDea(mpn() rtrxf oadoaDeli o (0t2umirpno1amenlfvta()sDum(monu4oltomiciadfmDrl(von(4tetrifcoo1oa  auei;t) 2uo(mpou1om  mics t s2taxr ot0openmfeiytfs2ea(vp u)areniocoa1fatrln i;s) rum(r3ny4apt lfvtls  rum(mpot0aee mo3iysfm umumo u0tleniocta1fp   ivo;()seto(mpiydll e fvt tfsDtmu pno4tpeo ieiadla elums;u) rtomr todlaD luvi s trtmxr3io1am elfct (fsrraxr ou0ole ifeiyslsDul(msnt4trxnif3oy1oateanvils0trxo(r iu1lm  mncs s s2ra(ro;t1altomoetadlm2ua( s (0aetnmr ty1fmDrlnvo;( setrim3oo4altnlfvsl(fa2rmxrpot0alx mi3iatlaDumnvs u) exomr3tydla e n olt0trumiopnu4ap  mieil(farraxm nt1aetoio3iytfs umums u4alxrir3ia1fmD lneo s)srxoxr nydllenmneiat)s2umx p;o4alenioctlt s emnmp u0 rxnmf iytfpDeanvi t0 exmxo3oo1lm nmnet ()s2tmx  nt4aeto ocildla2uanmo (4altrir3oy1oat auei t sexo(mpnu4amenmnesl(fs2uaur oo0opeomi3ilsfsDean o u0treoifctatomteaueo t) eur(o3ou4lmt lneilt) Dua(mooo0tlx ioeiysfaDrlumo t) etrir oytfptrlueils  2urir3iudaptelfciat  Dtrurpot1aptn o3tldls2em(von(4 ltrxocto1lmDelnei;s0setmxr3nudlpe  nvil(f 2umu o;u1oeen f3tyslmDea( pnt0trtnio3oo1fmtr i o s0 etmxo3iydamte nvsl()sDra(ront4tlenio3ilt m elu on()tltrxo iydfpDrli s;t  rxmio iu1amtemncsa( aDraxmp;u0tpx  ietltlm em(vs;u0artnifctodfmtr n i t) 2xr(o3oodam emfctls)srtru  nt0tetoiieiad aDrmu on() etnio ty1omDe ieolt) rxmxo3oy1llee ncias)arrax  oo0tptomocilsls2umumo ()altnir3oadoaDe n i;s t2uo(r nudop  miesltf rra(r no1ale ii3iatla um(vs;()tltnmo3iotlaDr ieo t)trtmxrpno4lmtn nci t)sDrrx oou0oet ifeiasla rmnvs;u0alxnif3oa1op eauvi s)setoio nu4lpt  feiatfsDumxmp;u0olxo o3iyt mDrmu s (0 rtomrctatopD aivsl(0 etmxr iy4ol nlncsat  2rm(moot0tpeo ocilsls2umnmonu)trxnmo ty1lm r n olt) etmxo oy1opeelivt sfa2tr(  oo1tlxomo3iysls eanvonu)teerxr ta1lpt ln ols trtr(m oo1ameelfeiatfsDtmxrpot4apxoioeiatfs2rl(vo;t0tleoxf3tydfa r u s t0 2tr(rpny4lp elnesatf rurxr ou4olx ifeild sDem(mo;()teerifcoa1lpDrai il(0sexrimpny1ome lfvi s)artmxmpot4teeo oeiatls2ulnvsnu)aexniociatfmtranvslt)sexmimpnu4amte nvsas  Drr(rono0aleo ociydfsDum(mp t)treoxr3iy1fatran olt0trtmxmpno4ameemietas sDrr( pnt4tleo fcildfsDrlnvs (0tetnxrctotoptraneslt s2ur(r3iy1lpt mneta(fsrtax pou0alto oeiad m2el( o;(0tlxrxfciydfpte neilt)sexr(mpiu4ll  mfetls)srumxr ;o1aexnmf3ildfmDeanvp u0tetoir3oodlp rlieilt0t2xo(mpoydol elnvias)srraur nu0apeoio3tys a2eluvpn()tlenmr3oatfpD ln s (0srur(r oo1llen fcil(f 2uaxr nu0aptoioeildls2rlu o;u)arxnmr tydfp   nvo t0seuoimpiy1lmtelnvta(  Dur( pnt1oee  i3tydfaDulumo;u4 rermoctatfaD  ies;t seuoxm3oy1altn fvt t  rumurp;t0alxo f3iytlm2ea(mpnt4 lxrmo ootoaDraivo;( s2uoxrpoodal emnctl(fsrtrxm ;u0tpxn ociat a elnvp t)trtnmrcoy1la  aies;(0srtrxo ny4aptnmivi (f rtmu  nt1altnmietad mDua(vs () rxnmfciy1la  luvolt) exm(opno4opt mfetat aDuru ont4oltoiiciadfs2eanvpnu0tlxrxr oo1fmtrauvil(0t2xm(m3oy1lm nmivsls  Dra(mo;u0oex ioeiasla rl(vpn() reoif oo1lmte nvolt)texr(rpiu4lm  lieilsfs2uru pnu1alxn f3ilslm2ua( s (0texoif iodlateaivi t teumxmpio4ap   ncias srtm(root1tpen f3ilslaDem(vont0 lxnir3todfmtrlnei s sexm(r nu4lpenlicils aDraxmpno4opeomf3iadfm ul(vs;t0aleoxrcoydlpDraueil() eumim3iu4olenlfcsls sDra( ono1tpe  f3iydlsDrln pnu)arxnifcia1fpteaies t  rxrimpiodlpeelieil(faDtmx  ;t0tetn fetls a elu ont4aeenmf3oydoa raivols)sexrxo iu4omt  fctls  rraxmpot0tex  ictlt s2em(mo;t)teeoxrcto1omtean i;( trxriopoy4opt  fcias aDum( p;u0oee ioeildlmDel(vp t) lxnxfcta1oaD au ils)trxoxr3oy1alenlncta()srtmurpno0aexomi3tadlaDumuvon(0treomr3to1om eli s;(0trtoim3no4alenlictat)srrr(mp;o0tlxoifctld m2ranvpnu4artnmocoodopDeaues;(  2urio io4llee nes t arua(ro;o4tlen i3iltls eauvs () rtnmo oatfa   n slt) rum(m ou1optemfvslsf 2rrumo;u1oetnifeiysfs umuvp u)areomociatlmD  u ils)s2xmxm3iy4llenlnvt s) Dtr(rpou1tleo ociat a rm(mp;t)artnxr iydom  au ilt srxrxm oy1omee ictatf rtaxrp;u0aexnmf3ias mDemnvpnu0tltrmfcoodlp raneils  ruo(o3iy4omt  ict s)s2rmxro;u0tleoif3iydlm ulu snt0altrxf ty1omtr nvi s)trto(r io4opt lneslt)a2rmxmpno4apt iieilsfaDrauvs;u)altrxrciadfp   ues;(  exrxmpiydalee nvtlt  Dtrxrp;u1oltn ieiysla2umnvp (0alxomfciydomD  u i t  2toxr iu1al   fvtlt)s2ta(rp;u1aet  fciatfm2em( s t0arxnxf3iotopD  n o s)t2umxo3iydlmee icslt sDrr(rpnt1opxnmiciltfaDuanms;u0texnxocoadlm e neo;()t2umxr3nu4alee
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;t0trtoio3oodom  mnvs t  Draurp;u0aetnif3tadfs ul(mpn()aetomo io1fpt aiei ( srxr(m3nu4lp   ict s aDtaxrono1apx miciltls2rmu pnu4trtrxr3oo1omDeluvo;t0trurxopoydlm  miei s)arur(rono1olxo octld a um(ms (0alxnmr3todfa eaneolt)s2umim oydol   nei s s2rrumono1olxoii3tltfs rlnmp;u4trtrxociatfmDrln slt  etrio iydame mfvslt aDraxrp;o1apt  fetat s rluvsnt4tltnxf3ta1fptrlies;( srxo(m iodom  mfctas)a2raum ;u1tpeomfciatfa ulumo (4trenmfcoatfm  lueo t)s2xoxm3oydomenlnci tf Dtru poo0tpenif3iys a emn pnt)tetrifcoydlaD  n o;() 2xoir nodaltnlietl(  2ta(mpnu0aeeoio3tlsls2eauvont4arxomo oa1omD luesl(0srto(mpoo1lp emici t) rrr(mpnu4aeenmo3ils s ua( s;(4 renmf iy1lmt  i s s) rtm(opoo1al emnetl()arrr(roou1ope micilsfs emnvs;(4 exoxr oytfp eau i;()trtmxo3iu1openmncsas artaxmo;o1alxn feiydfs2rlumpnt4 ltrmf iy1op eau i;t0trxrirpnodllenmict s a2tr(r ou0opeoiieilsfa emnms;u0 renxo oo1oaD lieils)s2trir nydlleemicslsfsDurx oou1teto icildfmDumuvo ()alerxrcoydlpDeanvols)teum(o3nydlle  ieiltfsDrm(m oo4alxomi3iltlaDum(vsnt)trtoxr ty1opteauvs;(0srxrir oudlmtn nvi () Dta(  ou4alxnmieiyt sDrmnmsn() rtomfcto1laD  u ols)trtoirpiu4op nmneil( a2tru  nt4tpx mieiatlm umu s u0artnmo3iy1omt livo;t)s2ur(rpiodomtemict tfarumxr ;t4alt mf3tydfs2emnvp (4 renxfciodlmDeau olt)teuoim3io1ame  fviasfs2tmxroot4apxnmfctlsls2ranvpnu4aeenxocio1fa rai sl()t2xoxr3io1lp emnvilsfa2ur(m ;t4aleoifciasfs2um( s;() rxrmo oodfmt  i s;(0 2tr(r3iy4amtelfvtlsfs2umu  ou1tptoioctlt sDrmu pnt0tetnxr3tydfmtrlnvi;(0s2tr(m oo1lmtemnvsa(  2rmxmpot0tle mfciysfsDrmuvont4teeomo3oodlateaivolt)srxm(m3iy4ol  mivilt  Drrxm no0texomo3tysfsDrluvpn(0aeeomocoadfp rln s t0texrxm3iodlleemivs (fsDtau  ;u1olenioetytfs ra( p;(4trtomr3oadlm r i i (  ruoir3oy4aleemnvtlsfs2umu  oo4oee mi3iyt s2em(msnt0texoxrcootoa  lnvil( t2urimpiudom nlnesl()sDumu oot4tleniociytlmDumnvs;()trtoxo3tytfatrau o;s)texoirpio1al elfvtas arraxr nu0tlen oeiytlsDem(mo t) etoxr oy1fpDean i ()t2umxmpoudll e ivt ()arta(  nt4aee  fetad m rauvp;(4arxomr tytoa  au s;s  rtriopno4op e fvsat srururpou1aexomoeild s ean o ()texoif iytomD  i s;( s2um(o ou1op elfvi (  Dua(mooo0oleoifeiatlsDem(mo u4aeeomr3ty1oate n olt sexo(mpiy1om n fet (faDumuronu0teto fctat s rlump;u4artnxociatfp ean i;t s2urxrpio4alte fcsl(f ruaurp;u0tltomociytfa rmn o;t) reomrcty1om rlues;s srtrxo nydopenmicils aDta(rooo4tet mietydls2uluvs;(4trenxfcta1lpt li ol()t2urxr io1op  mnesa( artaxmp;u1alenmietat aDra( pn(0trtomocootoat  uvs;t s2xo(m3iudop elnvtls)sDta( pnu0teenmoctlslaDua(ms;(4 renmrciodfatranei;t)teuo(o oo4ome mfeiltfsrumxm nu4tlx iietlsls ua(vpnu4teenxo3ootoaDeau s;s0s2xrim nu1lpt lfctas) Duau  ;t1teenii3ils m ra( o (0 exoxo3oa1fpDrai o;(0 etoxm nodolte fvil(  2taxr ou1tee mi3ias s2umumo (0aexomfcootlm r ivo;t  2urim iu1ole lfcias arurumont0tltn icils a2uluvs t0artnifcoatlpDrluvo () 2trir3oydam   nvt s  rumxrpou0ape iocils s2umu pn()arxnxr iotfpt  nvs s)trurxo oo1llee iviat)srumxr ot1apto f3tld a2rm(vpnu0tetomf oo1optelnei t  rurio oo4llenmfct t) Drru onu4ale mictydfsDrluvs u0 lxnxf oytopDrluvs;t tetr(r oo1omen ieiatf rtmxm ;t1apto i3tlt aDua(msnt0 eeoxo3iadfm eau sls0setoxo no1ap  mfetat  Drm( pno4oltn f3ild a2raums;u) exoxo3ta1fat li s t0s2to(opno1lltemncsls s2rrx  ;o1oltnioeiydfsDrauvs;u) rxnxf3ia1lpD  i ilt0 etmxrpoodlm n icia( a2rr( p;t1alenmfctysfs uaump (4 ltomrcoadlmDr ivslt s2tmxr3ou4llt mivsls)sDtaxrono4aet  i3iltlm emuvs;t4 renxr iy1op raivi;t  exoxr ou4op elfetls)srua(mpnu1olt  fcildfsDrlu o;t4 exnxociatla  aivsl()sexo(o nu4altnlfci ( sDtmxrp;u4aetnmociatfmDem(vs;(4trtrxf3oatoatraneslt) etmxrpou4op  mivils a2trx o;t4oet mfctltla ranmon(0trxoxrcia1oat lueo (0t2xm(m oudlme mfvt (  Drrumoou4aeen i3tlt aDua(mo;()alxrxr3iy1oaDeau olt0 ruoio oy4lmtnlncsat)a2raxm ou4tpen i3iadfm2ulnmo u) rtnif ia1lp elneo;s sexm(mpio1lptelivt t arua(rp;u0opxnmictydla2emuvs u4 ltrio todoa elnvs;s)srtriopiy4llen nei s)a2umx pot4tee iictytlsDrl(mon(4trtnxfctodfm eaueo;s  etoio3io4op  lnes s) 2tm( ont0tlt mietls a2rlnmpnu0 etrifctatfpte ues (  rto(o ou4om   feias aDrau p;u0aexniociasfm ua(mon() rxnmr ta1oa e uvi;s setoxmpoudlmt lnvs sf rtr( oot4aptoiiciatfm umuvo;(0aetrmrcoydlaDrlneo s srtrxo no1olenmnvi t sDum( pnt4olxoio3iatlm2eluvp;t0aleoif3tadoaD ln i;s  etoxo oodlmenmies tf Drmxronu1alen feiltfa2rmuvp;u0arxrmocootlpDrau o (  ruoxm3oy1op n ict (faDuru onu0teenmo3tldfmDuauvsn(4arerio3iodfpD  n s s0 rxo(o nydoptnlies s aDuaxront1alxomf3iyd a ea(vpnt)teerircootfmDran i t0texm(opnodlpee fet s sDrmxmont0tee  feiys m2ea(mpnu)teerxocio1omteli s;t)trxrio io1llee iei t aDraxmooo4alxoifciydfa2uln sn(0 leniocio1la  anvilt)sexoimpou1aptnlnvsat)aDtmx oot0olx iiciyslm elnmp;(4trerxrcoo1latelnvo s  2xmxm io4lptn fvsls)srum(mpnt1olx  fctldfs2ranms t0aeeomr todlat aues s0 rurir nudame mneil(fs2ra(moou1oltnioctyslmDumuvpn(4tlenmo3to1fp elnvo (  exmimpiodlmtn nvi s sruax  ou1tex  ociatfs2uauvpn() rxnxf3iy1fa eli i;t0 2um(m3oy1om emfcta(fartmxro;u1teenmfeiaslsDeln o;(0trtnmf3tydom eau ol(0s2tr(o no1olee nesa() ruru pou1apxnifetas sDelnvsn(0 renir todfaD  nvo s teuoxopiydalt mictl()a2uax  oo1tpt  feiltlm2rl(mp;t0alxoio3oytlmDeanvo t  exmxr ny1ameemfvi tf rumumoot4tptomociyt s umnmpn(0 rtnmf3oo1fm  aivs s0 exr(r3iu1lpeelfei s artmum ou0oee mo3iydla2em(mon(4aetnmo3iatoatrlueo;(0s2tr(rpoy1am elivt ()aDtax ono0opto feiydfa uaums;(4tlxomo iatfp  ai i (0teto(m iydlp n nvtls aDtru  ;u0oee mf3ildfs2em(mo u0teeomfciatom   ueslt setoxmpiu4om  livia(  2ua( ono4openmieiadfm2um(vont) lerir3ia1la eai i;( t2xm(mpnu4lmtn ies tfsDtaumpot4olxnii3tas m2ra(mp u0arermrctadlmt lnes (0s2tm(o nodopeemfeil() Drru  nt4aexoiietlslsDranmp;(4tleomo tydop r nvo;t)trurio oydoltnlneia()a2tmur ;u1apxomi3tytlm2emump;u)tltomr3tydfmt lnvo t0trumxr3nu4optnmicias sDtax  no0aptn oeilsls2rmnmon(4 lxoxo3ootfatelu s t) exmir3ny1lm elfei t) rrm( o;o1aeeo f3iaslm raump u4trxomo3oa1omDelivi;s0 rxoxr iu4lmenmivsat srraumonu1opx moetysls rauvont0tlenifcoytfaD anei t trtmxm no1olenmicias artmumooo0oetomicildfsDea( o;u4aeerxociadfmtrln o s)s2um(m iu4ap  liet s) Duaxmoot1tltn icilsla2eauvp;u) etrir3todlptranvs () 2urio iu4ol n fct sfa2tmx  nu1tle iicias m ea(vs t0altniociadlat  nvols0truoxm nodolen fvi t sDumxmpnt4opx ioetadfmDul(vo (0trerif iatfatelueol(0truoiopoo1llt  ivsas)srtm(ro;o4aee  fetyt m2umn s;u0trtrif iydfm rlues t)srxoxmpoy4olt  ivi ()s2rr(rpnu1ope iocils a um(vo u4 rxrio oytfa eaueo ( t2uo(mpiy1amtelnctasf rtrx o;u0oetnmfciatlaDem(mp (0tltnifciodlptrluvi t0s2xrxm3oo4altn fvsl(fsrtmum ;t1tpxo ieiatfsDranvp;u4tlenxrctadfaD ai o;t  rur(m3iu1omenlivsasf Drm( o;u0aex mictatlm emnvs;u)trtoio3oytlat aueolt  rxr(r io1ll   ivsa() rtmx pot1aetoiieildfm2rmums (4 reomr tydfp rlivol( t2uo(m iydopenlnesa(f rtax o;o4apxnmf3tyd m2rln onu4altnif todomDe ieols0setrimpiydole mncsa()sDrr( o;u1aleo icild m rm(mon(0 exrif oytfmDrlnvs (0t2tmiopio1op n fvsl( arum(moou4oex  ietydla2eluvo u4altrxr3iodop e ueslt texm(r3ny1lle  iesas) ruax p;t1tlxoio3tyt s2ua(ms;t0trtomr oy1la  auei;() 2uo(rpno1lpe mivils) 2umump;t4oeeniietldla umnmo t0arxrmfcio1opDraivo;t0 rto(mpno4optnlfctl() Dtmx  nt0tpx  icilslmDelums t)artnmr iodlmDrlueol(0srumiopoy1lp nmnvta(  Dururp;o4tpeo fctysfm2elnvp;t4arenir3tydlm  livs t)s2umio3iodlmenmict s  rrr(m ;o1aptomi3iad s2uaumpnu)areomfctydfa e uei;s  2trimpnu4alenlnciatfartauront4tpe mieiysfsDumuvsn(0 rtnioctotfp rau o ( srurxopno1ame mfvils)srrax  no1aetnmiciatlsDrmn onu0artomfcoydop  lieilt trurxmpnydal  lfvtas srtmx p;t1opt  ieiys s2ulnmpn(0teerxfcoodlaDeluei (0trxrirpoudlm elivs tfs2uaumpou0alt ioeiydfs rmu pn(0 exrmoctytfaDe ieo ( trto(r iy1lp emnvi (f 2raxr oo0tex iietltfaDrmuvont0 exoxf oodoa  luei;( texoxo3oy1olt mfvia( aruru pno4opeo ieiysls ra(mo;(4tlermo3tadfmt anei;(  rtoxr ou4om elfvia()aDtrx  ou1optomfeiyslm2ulnmonu)trxomr iydomD lues;( t2um(r iodlptn fvta( a2ua( oou4tlxnmfetadfmDua(mpn(4aeenio tytfp r iesl()t2toim oudal   nvs tfs2rm( pnu0tpeo f3tyd mDum( s (4tlxrmr io1lpDelu o t0 eto(o3ou1lm n ivtas)sDra(mpnt4aexnmociadfmDraumpnu0 exrmr oadlatran s (0s2umirpnodal  mnvta() rta(mpnt4oltn oeiltfmDrauvs (4 rtomf io1fa   n sl()t2tmir3oo1omtn fvi s)arraur ;t4aexnmfeiys aDeau pn(4 rxrmf ia1faD lnei t sexoirpiy1amte feias) rrm(rooo4altnifeiltlm2umn o;u0tlxomf oy1omD  neo;s)seur(rpio4aptemnetat  rtaxmpno1tpenmietls mDumumon() rxoio3oodom eau sl(0truo(mpoydllte ics sf 2rm(r ot0oexnmociadfs emumsn(4 rtrmr3to1oaDelnvil(  rurio ny1olenmfcils)srrmuro;t4ape ifciyt mDrmumo (0 ltoxo3io1fateanvs ( t2uoxm3ny4am nlnvslt  Drrump;o1opeo o3tlsfa emuvo u0texoxociotfp eaivs (  2xoxopiydlptnlfcsat) rta(roou1tpx mfeias aDran s;u)tlxomociatlaDeaieol()texmxr ny4omenlfvtas) 2rr( p;t0optnmfcilsfa el(mp u4trxomr3oatopt anvsl( t2tmxopno4amtemfeias)a2tru onu4tpx mfeiatfmDeau ont4 eermo ia1opD li o (0 ruoxo3oy1al elictasf rrmx oot1tle mfciadls2eanmsn()alenmf3oytlptr uvs;t0 rto(r ny1lmeemnvi t)aDtaxrooo4tee  o3iydfa2ra(vonu4arxnif3ootfp  li o (0srtrir no1ll  lfvia(faDta(rooo0aee mfctytfa2eanmp;(4 etrmfcoa1laD  iei;(0 rxmio3no4olee fvi t  Duaur no4ope miciydlmDranvs t0 ltnxf3iotfaDrauvs;t0teuoio3nu1lp  lnvs (fsrrrum no4oet mietad s2ranmon(4arxomo iytfa rli o;s)truoxmpiy1llenmivt t) rrr(mpot1aexn oeiydfaDuln o (0trerxrciadla rlu il( s2toxr oodop  lnci t)srraumpnt4oeto f3tytlaDemn on(0 eenio iotfaD aues;t0tetrim oo1ape  ivtl(fa2ra(rp;o0aex  icias s2uanmsnu)tetnxfcoadopt aivi t sexoir iy1lp emfvsatf 2tax  ;t4olxn fctldlm uau s t0tetoxfcty1fpDrauvils setoxo3oo1lmenlnvsat) rrau pot1aleo fctldla rmumo;u0 exrmf oodfa  lies;()seur(o3no4ll n netat  2uru o;u0tee mieiys s uanms u4 exnmf oy1omteaivi (  euoxm3nu4llenmnesas) 2rrxm ot4oltn o3ilt m2rmums u4texnio iydfmDr ivo;(  eto(m no1lp nmfesl(  rtmx  nt0aleo o3ildla elu p u0artoxr oydoa eln i;(0 rxoxr3no4lmtnmicils arra( oot4tlxn octyslmDrmumo;t0aeermo3ta1lp r i ol( setrxr iy4lmte icsls s2uaxr ou1ope ifetyd sDem(mp;t0 ltoio iotfmteli ols0 eto(o ny4opee ncsatfsDuaxrpou0tlt mictadls ran pn(4aeenxr iy1omtr nvsls) 2tr(m oy1amt  fcslsfsDtau pou4opeo oetyd a2uan s ()tltnif3todfp e ies;t0s2uoxr3iodamenmnvslt)srtmxr ;u0aexnmieiysfsDrmuvo u)aexoxfcoa1fmt au sl( sruoxm3no1lle  fvslsfs2uru ono4apen feiatfmDeau s (4 reomf3iy1oa elivs s)seto(mpiy4lmte fei ()artrx p;o4tlenmicias a2umuvp;t)altnxr3iatfa  luvi;( s2urim3oudapenmiet t) Dur( oou0oetn ietysls rlnmont) lxnmf tatfp  ln olt  euo(m nydop n nvs (fsDta(mono4oeen iciyt m2umnms t) reoif ty1om r uvs () rumxopnu1lp e ieilsf 2ra(r ;t1tetn fetldfm el(ms t)tlxnir tatla eauvo;t)t2tmxr3iy4lme  fvias aDtmxmont4ale  ictasfs ulu pn(0altomr iydfmD an o;()setrim iodal   ncias  Dumxroot4aleoifctad a2emnvsnt4arxoif ia1fp r uvols t2xr(o3ou4ol n ictlt)arurxrp;o4aetnif3tysfaDel(vonu)trtnxf3iotla eluvil( tetm(rpno4lpt lfetat a2umxrpou4tex  feiatls2umnms t0 rtrxr to1lpt anei;(0 rtoxo3iu1aleemfvs (fa2uaxm ou0alx mfciytfs emnvs u4arenxr oadomtrli il( srum(r oy1lleelfvils)s2rr(ro;t0aeen icilsfsDumnvsnu)texoir3oydlaDrlivi s sruoxmpoudaptnlfeta()arrmurooo1alxoioetytlm umump;t4tltomoctatoaDeanvils0t2xoxr iudalee iesat srta( ont1oleo feildlaDulnvs;u0alerifciotfpDelnes (  ruoxr3nudolen ivilsf Drm(ronu1olx iieiadlaDea( snt0 rtnmo oo1omD aivi;t0srxrxo nodape mivsltfa2rmuroot0tpto octldlaDrln p;u) eerxr3todfp e nei;()trtrio oodop nmictlt srta( pot4apt ifciytfs2ean s;t4aetnir3tadoaD lieo;s0 rtrirpno1lmt lnct tfartmxrp;u1alx  feias a2emnms u4altrmf3oodop  li i;()srumxo3nydlpenlnctl(  2urxmoot0apxn o3iydfsDelnmo;u)tlxnmr3todlm eauei;s) exoxo3nu1ale mieiatf rtau pnt4olt mociat s ea( on()arenio3oytop r uvi;s)s2xmxopny1lm nmnet t srtaxmpnt1tet mi3iydlm2rmn snu0areomrciatoptrlnei t)t2xm(opoy4apenlneilsfaruax ono4tpt iietltla2raumo;(4 ltoxr3iadfpt lnvils)tetm(mpnu1omeemfeiasf rra(r ;u4opxoiociytfs uanmp;(4treoircta1opDraivi;(0srtmxrpny1amtelietlt  Duaum ;u0oexoiiciydlmDemumo;()aexnmo3oa1fmDeln i;t0seumir oo4amtn fct t s2rrxronu4aeeoiicilsls ul( p;t4alxnmo3tytlmt ai ilt0 rur(r nodllee fcia(faDurump;o0oeenifctatla rm(vsnu)texoir3iadopt auvs;t) exr(rpoydlltelivsl()srta( pot1tptnio3tls mDeanmp;() lxnxo iy1lm r i o;t setoio ny1ap  lfcsas  Drm( pnt1oetnioeiasfm rmu p (0tlxomr iy1fp r iei;t0t2toxm oy4lm e ivt t srtruro;t4ape moeiadlsDranvo;t0 etoxo3todomDrlneslt)srtoxo3oy4lmt lnvsl()a2umurpnu1oeto fetydfsDrmn sn(4 renio oytopDrlivi s0 2tmio nudaltnmfcias sDra(rp;u1opeomictatfmDel(vsnt)tleomf3oatopD  ieilt0sruo(rpoudlm emfcsl()arra(rpnu0aexo fetltfmDumu o (4aetoio3todoptelu o;s0trtoxo3io1alt mivi (f rtaxr nu1tptnmo3iadfsDea(mp;t)tetnmfcoa1lpDe nvo s  rtmirpoydal emicsatf rtm(m ;t1tleo fciatlsDelump t)tltrio3oy1lmt  ivi t)truoim iodlptelfviatf 2rruro;t0oetoif3tat a eau pnt) rtrif tydopteau ils0s2ur(mpno4altn fctls) 2tmx pot1tpe mieiatfa rm(mp u4 leriocoatla elnvs s  etrir nu1apte nvil(  rtr( onu4opeo o3iydlmDeaums (0alxrxr iotomDrli olt0seur(o ny4am nlies (fsrtmx ono0tlxn ieiltfs eanmo;u)altrio to1oa r nvi t  etr(m io1ol emivs tf Drm(m ot4opt mfctad a rmu p;t) renif tydoa r n s (0 2to(m oo4ol nmnvtltfsDrrum ;t4tee  i3ils aDuauvp;u0teenmocoatlpDean o;(0 etmirpoo4oltemfcil(fsrumumono0opxoiociytfs rau on()aeermrctatlmteai i t teur(m3no4opt  fetasfaDuaxmp;t4tpeomictydfs2rmu snt4aleoxf tydom  ln i ()srumio nu4apt livil(fs2rmumpoo0tpxomoetldlmDulnvp (0aeeoxo3ta1la r uvi t0 rtmirpoudamt  fvtat)s2ua(rooo1tetnmi3iyt mDel( onu0aeenxo3tydoa   iesls0sruoirpoodlleelncs ( sDrru p;t4tlx miciys s eauvs;u0aexnxocoatlpDran sls0t2toxopoudaltelfeiat  Draxmpno0teen feilsla2uanvs t4tetoxo tydfa   nvilt0sexrir oy4al e icia()sDrrum ;o4opx  ieiadfsDea( p;t4 rxoifcia1lp r nvi;( s2xm(r oodom nlfei s)srtrur ;u1alenmfetas m eaumont)tetnirctodomDeauei t)trtmiopiodol nlfvilt aDurxm ;o0opxn oetys a2eanms;u)aexnxr3oydlat lu ol( srurxo iu1lleelnetlt)a2rmx  ou1oltomf3iytfm2rm(vp;(4 rtoiociatlpt auvs;t s2xoir oodalt  icias s2uaxr nu4aex mfeiydls2rl(vo u0 ltomfciotlpD  i ils0 rtrxo3iydll eliesa(faDtmum oo4olxomoetltfm ran pn(4aleoio3oadom  anvi;s0t2tmim3iodaltnmnct s  Durxro;o0oetnif3tasls2um(mo t4aetomf iydla  li i s) eurxo oy1al elfvs ()sDtr(mpoo0tpt  feilt m2rmuvs (0 rxnxo todlmtr ivilt  exo(o io4altnmfei sfs2rr(rono4tpeo iciys a eln p;(0aetnxocootfaDe uei;s trxmxo oo4llenlneilt)arrr(r no0tle mi3tlsfa2uanmo (4tlxoifcty1oatraiei;() rxoxo iydlpt mnei ( srrmurpnu0aeeomfeiysla2uluvs;u4trtoxo iy1lpteau i s)trurio3oy1apte ncsatf 2rm(rpot4teeomoeias mDuan p u0 ltrxf oadfp e i i;s srtriopoy4omtelfvta(f Drrum nt4tptoii3iyslmDuauvpnu0aetrif3ootoa raivi ( tetrimpiodlpt mietl() Dtmxrp;o1oexomietytls rmn o;u4 rtomf todoa elivs s truoim iy4lp elnetas)aDrrxr ot1apenmietasfa umnvs;()alxomo3oadom eaivols) etrim3io4lm   fet s s2um(  ;u0aee iieiltfa2em( s;(4 etomrciodlpt an olt)setrimpnudlpte ivilt) 2urumpnu0aexoioetatlmDrlnmo;()arenmr3iodoateluvs;t trxm(o oo1aptemfvsltf Duru pnt4apx  iciyslsDrm( o;u0trxnif3ia1omDraivils0 etoxm3io4lmt  fvi s)a2tmx ooo1oetnmfetasfaDumn s;t)teerxo ootlmD an ils)s2xoir3oy4ll n iei t aDrau  ;u0texniiciatfs eaumsn(0aetomo3iodfaDeaivo (0texmxm no1lpe lnvil(fs2ra(ro;o1oexoifciytla2ean on(0aeeoio3tytla rauvsls tetoxo ny4altn ieiltf Durx p;u1opxomfetlsfm2umnvo ()tetrxf io1omtrlu o;s0trxrxopoudlp   ivils arrmuroot1oet  icilsfsDelnvo t0tlerxo3oytfpt  uvi;t trumimpoydomenliesl( s2uaumo;o0texnifeiydfa2rluvonu4texoxf3oy1lat  i s t)s2toiopny1lmee ncslt)a2ur(mo;o0ale  o3ilsfs el(vo u4trenir3iatomDrli i;s srumio3iudaptnlfetas)sDta(mpnt4tleo f3iadlsDem(ms;u4 leoxrcoa1opDrlneo;s)setr(o ny4om nmnet t)aDuaxro;u1apt io3iasfs ra( pnu4 ltrxrctatomtrln olt  euoir3oy1open nctl(f Drmxm no4aptoifeiytla2rauvp;t4tltoif3oydlmte u s (0 2toirpiudop  lnvias srta(mpnu4apto feilt s rlnms;(4trtrif oytfmDeaueols t2toxr3oo4altn neta( srrauroot4olt mfetlsla rl(vs u0 renxo3to1oa rluei (0teum(m nodaltemfei () Dua(m ;t0alx mf3iytfs uluvonu4teeomrcoy1fpD  u sls)s2uoxo3io1al  mivt (f rta( ono4alx  f3ilt s eluvs ()trxomocio1optr ieo;s) 2umio oo1lmen iei (fsDtmurooo1apx if3tatls2elnvs t)alxnmo3ia1fpt  nes ( srtmxm3oy1ap  lnct (fs2uaurpoo0alxnifciadlm elnms;(4 rxrir3oytla  an i t0s2urxo3iydale mfvtatfsrra(r ot4aeenmo3iydls2rmu p t4teeoxo3oytfpDrai il(0 2tmir3oy1omt lnvtls aDtrumo;o4tlx iietad m2ulumo t4 rermocoo1fatr u ils) etm(o iu1omtnmfcsa( a2umx pnt1aleoif3tytlmDrmumsnu)tleoxf3oa1laDran i;( trxmimpnudamtemiesls)srra(r oo4oee  f3ilt s2uan on(4trtoif ia1lp eau s;(0srxrxopoudlm  lnvsl()a2urxmonu1tlxnifctatls2ranvo t)tetrxf to1latraivo;(0 2umiopio4am  mivtat  ruau  ;t0tltnmociysfs ranvo u)alenif tatoateaieol()seuo(o ou1omt lnesa(fa2tax  ;o0oltniieiytlaDumnmsnt0 rxrmr3oy1lp  auesl(0setmir3oy1lmt livsl() Draxrp;o4tet if3iadfaDrmnvs u0trtnmfctodomtr ieo s0srxm(r3io4am  mfcsat  rtru onu0olx  icilt m2ua( sn(0trxrxf3tytlp  lnvil(0s2trxr3oydopt micsls  rtru ooo4tpeomo3iat a2rm(mo u) rxrif iatopte ueolt  2toxr nu4omte nvils a2tm(mp;u1tpt  i3iytlaDrmn sn(0tlxrircoydlptrluvi;(0 eur(mpnodop emies t)arurxrpou0aex mi3tytlm ean s;(4tltrir iodlpDeauvols0 etoxo oo4lmtemfvi ()aDuaxmo;o1aeeomoeiyt s2emn p;()texrxr3tatfpD aueo (0 2umxo nudameelivtls)srtaxrpou0oeto feildls emums u) eenio3oadopteau s t0 euoio3iu4lpt lneil(f rtmurpno1ape  o3iydfmDuaumo t4teenmf3todfm   ivo;(0 rtmio iodlpee ivilt)s2tr(rpnu1oet mo3iys s el( p;u4arxrirciatlaD livs;t0s2xmxr3ou1opee icsl( sruauronu0aptoif3tldla2emumo;(0texnmo3oadopDeli s;s0teur(m3io4lmtn fvta( sDum(mont4opeomfctlsla2umn p u4 lxnmocootfpD  iei t) rxr(r3iy4lpe mfvi ( s2ta(mpnt4aptnioeias a2uln o (4altoif3tytfate ivs (  rurim iudal n nvslt  2raur ou0aet mf3tydfmDuau pnu)arenxrcoodoa r uei s) 2to(opou4olt mfes ( sDumxmp;t0oexoioeias mDel(mp t0tetnmfciy1lm eaieo s  exo(mpnydol e icsa( srtau  nu4tee iiciys s rlnmpnu0 etomf ootoa raues () 2xmim3nu1lm nlnvsltfsDum(mooo4alen ociytla2rlump;u4texoirciytopt liei s0 2umim3nydlp nlncta(faDta(  nt0teeomoeils sDem(vp t4 etoiociotlaDe nvs ()t2xr(o3oydlm n nvs s aDum( o;o4texnmfciysls em( s;t) eermrcta1lmte nvo;s0t2xrio3iu4ole  iesa( a2uaumooo0altnmfeiyd a2ulnms;(4teeniocoydlm rlnvols s2xr(o nudlme lfesltfa2ur(m nt0olx ifctlsfa rln s;t0 reoiociy1om   nvs s0 exmxr3nydlmtn fvil()aDtm( p;t1oltnio3tatlm2ulnmsnt4aexrir3io1oate uvi t0 ruo(m oy4ol  mfctatfa2rmu  ;t4tlxnmf3ilt mDrmuvsnt4aetomf oa1lmte ivi s)srxoxr nu1amenlfcs t  rtmxro;o0aex mfcils a rmu s (4 exrmf3tytfp elivi t trxoxr3iy4omt mfvsas aDra(rp;o1ole mo3tltfm rmn snu)teenmf3tydlaDe nes;t tetoxm iu4amen fvslsfaDtaumoot4tpx ifeiyslm2emu s;u0aeerxfciodlm  auei;s0texmxo nu4lpt mfetlsfartmxrpnt0ole iocilsla umnms t4arenxo3ia1lptr i ilt) rxoirpiy1lp elivt sfaDurx  ot4oexo feildlsDulumo;(0alxoir3tydfp rai s;t)trtmxopnydllenlnesls aDrax p;t4open iciyd a2rmuvp;() etrio oatfptrauvs;t trtr(r nu4ll nmncsas)srua(rpnu1tlt moeiat mDumuvp;u)trtnxf iotfmteaueo t)texmxrpny1ol   fvtasfs2uaxm ot1olxn oeiltfa ul(mpn(0trxoif oy1oa raivs s)srxriopiudamenlfcsas a2uau  ou1apxomf3ils s2umnvp;(0 etnxrcoadfmD lneo ( t2to(r io4om emfesa(faDtrxmo;o4ope mo3tas m2rluvp;(0aexoio ootomD aies;(0sexmxmpiudalt lfesas)srtax o;o0olxnmo3iasfaDea( s t)tetoxf3ta1oatr uvs;s0 euoxr3nu1apt  ivsas)s2taur no0teeo oeiadls ulu o u0trtriociotopDraueol(0 2xoxopoy1omen fetl() Dumuront1apeomf3tad s ran snt)tetrxo oydlm  liei;s)setr(rpiy1lptemivsa(fsrtrumo;o1oexomi3iat a rm(vs;() rtnmf3ta1oaD lu i;s s2ur(r no4apt mietas) Dua(  oo1apx moctytlaDrl( sn() etrmrcoodlmt  nesl(0 rum(mpiy4lpt lfcsls) Dta(rp;u1tlto feils a2eau p u) lxoirctatlpt lies t)s2trio oy4lm n fet ()s2tr(mp;t0apt  o3iys aDraumpn()teenirctytlateli i t0trxoim3ny4omtnlnei t s2urur ;o0oltn f3tlsfs ua(vs t)arxrmo3totom  ai o s0t2xrxr nudlptnlfct tf 2umu pou4tlto i3iasls ul(vo;u0 reoifctodfaDrli i;s teuoirpoy4om  micslt)aDrmxrp;o0apen ieiatla rlump (4texnxf tytomDranvils)srurxo iu4omt  net t  2ra(rpnt1oltnmfciyd s2um(vpnt0aleoio ty1op   n o s)s2xrxrpoo1ll nmfesls srrmu  no0olxniictlt s elnvo;(4 exrmrcootopt an sl( tetoirpnydlpt mfeil(f Dtaxm no4tet mfcildfaDum(mo t4tlxrir tatfatelivo;t trto(m3nu1lm  mfvs t)a2ra(ro;o4aeeomictysfa ul(mp t4 lenxo iytlmtrai ilt s2urxrpiu4am n ivtlsfa2rmu  no1oltnmfcilsfs emumont0trtnif3totfa  aneo;() exrxo3oydol emfei (fsDtmx oou4aexomf3ils m2el( on(0 exoxo ootopD aivi;s)t2tr(opno4lpen fcil(  2tau oou1ape ioetltfmDranms u)alxrxrcoa1lpD an o s0sruoirpiu4ope lietat)a2ta( ooo1texo i3iyd s2rln pn()teeoxf oy1fmtr ivi;s0sexo(o oy1ol   nctltf 2rrxrooo1aexoio3ildla2ulnvsnu)aeeriocty1fmDeaivils trurim3iydlmenlnes tf Drmxr nt4opt ifeiatfaDumu pnt) lenmf ta1lp rli il() etrxrpnu4lptelfctatfsDrm(rpno4tpe if3ild sDelu p u)altnio3oytlmtraneo;s)t2xoiopnydape lnvt s  rrrumoou1texnmociyt m2em(msnt) etoir3ty1fp elies s) 2toiopiu1op nlnesat)s2taxmonu1aetoifetatfm raump;u) rtrxr to1la  lues;()t2xrxrpoydlpe mfvi sf Draumooo0oex iietytfaDranmpn()aleoif oa1faDr nesl(0s2uoxmpno1lmtn ictat)aDrmxro;t0opx mf3iytfm ra(vo u)tlxnxo3tytlpDelneo;t setmxr3oydlmtnlivtls) rraxm ou4tex ifeias m2rmnvsnu0altnif tytfp elneo;s)srto(r3oudlp  lnciltf Dua( oot4aleoiiciys m2ulnvpn(0trenmr3iydfaDr u ilt  etmxmpnu4ll e nei t s2rm(rpot1tpxomo3iatfmDemu o u0aexniociadoatr uvo;t0tetmxr3iu4aptnmnci t) rtaurpoo1oee ifeildfs umu s;u)texnif3oy1fa  livo ( t2tr(rpnudlm elfetlt s2um(r no1alenmoetas mDelumon(4 etoio3oydla rauvs;(  2uoio iu4lp elies tfa2tmur ;t0alto o3tlslmDul( p;t0alxnxo3tytfmt li slt0 rum(r3iy4llenlnvil() Drm(r nt4oltn icias s ulnvp u)areoircootlp rlueols  rxoxopoudoltn fvi t arrrur ou4texomoctysla el(vpnu)texomr oatfp e ies;s) 2xrxrpno4ole mfvtas sDum(mpno1alen i3tatlm2eau p;u4 etoxocoadoaDr uvsls)sruoxm oy1om nlfcsatf Drmu  ot0apxniieiyt aDeaump t)aeeomfctotfptrlnvo;s)s2to(rpiodom  mfvt (fs2raxm nt4tptnii3iydla2uln p;(0alxrxf ty1fa elnvo s texmxo ny4amtn ictltf rurxr ot0opeo o3ild a2ra(mo;(0 ltoif to1faDrai s (0seurim3ny4omt livs ( s2tax p;o0ope mi3iyd a2eanmo u4 eenmf tadomtelieo;s)texm(m3io4olt  nvtl(faDtr(  ou1aee  fcild aDraums t4treomr3oatoaDelnes;()trxrir3oy1amt  ncils)a2rrx ont1optoifciasfa2ua(vs;t) lxrio todom ran o (0 2urxr oudllt lncs () rrru ooo1aleo f3iat m eaump;u0 rxnifciotopDraies;t s2trxm oudalen fvt t  Drr(mp;t4aleo feiltfm2um( pnu0 eenmfcoydlp r uei;(0 2uoxmpiu1amt micsa( a2urxmpno4altomo3iltfmDea(monu)altnxrciy1oaDe u o;( seuo(opoudopen fcs s  Dtmur ;o1tpe io3iatla um(vs (0aetrir iadlp rlneo s trtmxr iudomtnmfvs s) rumxmoou1oeto i3iytfa ul( s;t) ltomf3io1fat lnvs t s2uo(opnu1ol  licsls arua( p;o1tptnmiciadfm2emums;() lxrxo to1lm rai i (0tetmxr iu1omee iesat sDurumpou1aptomictltlaDelnvo u)trenio3totop  auvo;t trxo(o3no4ope  fviasf rum(ro;o4aetomi3tytfm eaumonu) eeoio3todfmtranvi;() rxm(opiodal nlics t)a2rrum oo4ope iieiytla ra( sn(0altomfciy1oa rau i ()trtrio3ou1ame lfcsas aruaur ou4aptoiictlsfaDuln p;t)tetrxo3tytlmDr u ilt0truoir iu1lpenmfvi () Drr( p;u4alxo o3tys s2ra(mon(0alxrmfcty1fptr nes s  etmio3nu1ap n fesls)aDtaum nt0tex iictydlmDrl( s u) etnmfciotfaDr ivolt) rtoxo iu4ap e ici tfsDtrumont4texn iciltfs ean o;()artnxrciotlaD  n i t0trurim ny4aptemfcslt)sDra(mono0oltnmf3iat m2raumpnt0 rxrxf iotfpDrlnvs;t  rurir3oudal elivt s)a2rm( pno1tltomoeiad m emnvsn(0 etnio oy1op e i o (0 rxrxm3ny4alenlivi (  Duaxmpnt4oltnii3ilsfmDraumpn()alerxociy1fp  lnvs t sruoxr oo4om nmict t)sDuau ont0tltomo3tld a uln o;t)aeerxr3todfpDelnei;t0teto(o3iu1llt  nci () rtrumooo0tpxomieils m2emnvo;u0texrxo3totom e ivs;() exmio nu1opt  feils  2uax onu4apenioetas a umn onu4trtnmo oa1fpD  neo;t  2tmiopno1al e ieil(  2ua(r ou4tet io3tat m el(vp;(0arenxrcia1oa r uvolt)s2xoxm3oo4omtn fvtlt sDrrurooo4tlxomoeiltfm rau onu4treriocootlmteanei;t)s2tmxm oy4lp  lnvtatfs2uaxmo;o1alxo i3tas m2em(mp;u0 lxnxociytoatrai i s)texriopiu4openmnvs ( artrxrpnt1tet ifctytfsDeauvo t0arxoif ootom rluvils  eur(o3iu1ol   fetls) rrmumpoo1aeen o3iatlaDrl(vs t0treomf totfaDraneilt s2tmxrpno1amenmicia( arrmxrpnt4oex  fctad s eaums;t4aexoio tydla r nvi;s) rtoxrpnu1llenlneia()a2um(  ;o4tlx ifciatlm2uauvs;t4altnxfctodlm rlu s;s s2xrio3oy1ope lfcslsf 2uaxm ot4aetnmoeiatlaDeaums;u4tetnxocoytoaD  i i (  exoim ny1oltnlneilt sDrm(ronu0tee  ociydlm2uauvs;t0 exomociotla  an s;s tetoxm3oydopt  fcta(  2rru ono1opt mietatfm emu s;u)tetomo ootlmte n o;t)t2xr(rpoo1op nmict t  Dur(mp;o0tpeo i3iys mDea(msn(4tleniociy1latelies s trum(m3nodap nmici s)s2rmx pot1aeeomi3iaslm rlnmp;()areoxo iotlptrauvolt) rumxrpiudole mncslt  Dua(mono1aexomfcildlmDrmnvp u0tltrif iatfmtr n i (0srtrxmpoudam  lnvsl( arrmumpot0tltoiieiasfaDrl(vsnt)artoxf3iatlaDran s s0 2um(o3nu1omeelncia( sDraxm ot4ape mietas a rmnvs;(4aexrmr3oodop  anei t srxmim nu4llen nvsat arumumpot4optomfeiytfmDeln snu) rtomo tytfateaivs s0sexm(opoodop  mivs tf Drru  ou1tpx moetls mDrlnvo;u)altoio3tydfpte i i;s0s2tmxr3oudamenmfcil(  rrau ono1apto fciat m2rmuvp u4trerir3iy1fm eluvo;(0 2xm(mpoy4optelfct (fsrtmum ou4oex  oeiyt mDeauvp ()tleomfcoo1om rlu o;()teum(m3iy1omtn fvsa(faDta(m no4alxo o3tldfs2ulu pn()trxomf3ty1omDelnvsl()seumio3io1ale  nctls)s2rmurpoo0tptn ociltla uan p;u0trxnio oodfp  ai s;()s2to(rpiu1ape  ncia(fsrrr(ronu4aptoiictld a ua(mp;t0aexnmr ootfm rlu s;s)srtoxopny1amt  fvt t) Dtrxr ;t0olx mo3tldlm rmnvo t4texoio3iydopte ivo;(0t2xm(o oydlptnlictatfaDtmxmono4tpen iciyt m2rmu p;() lenmfciydoatrlueo;t)s2uoimpiudlm emfetltf 2um(m no1tltnio3ild a umuvp ()aleoiociadoptrlies;s0s2xo(o3iy4altelici s arur( p;t1tltoiieiadfaDel( o (4trxnio totom  an s s  exr(m ny1lmtnlieilt a2uaurono4oex  o3iytlsDemn o;u4arxrmr3oo1lpDrln i;(0sexr(r3oy1lp  mnei t) rtmurp;t1oleoioeiytla el(vpnt4tetoxo iadlmDr ivsls)setrxm ny4am n netl()srtaum ;t1opx ifeiadls2el(vo;u4areoio ia1oat livsls  rxr(m nu1al  mnesasfsDua( o;u0oet  i3iltla rlu p u4tetrmfcoadfptelu ols srtrxo3iu4alenmnet tfsrur(mpnu0aex  ocilt m ua(mp u) etnmo oa1lp eai slt0texmim nudlmtemnetlt) 2rauro;u4olxnmiciytfa2um(msn(4trxnmf3ta1la eli s ()t2um(r3oodlpee nvt t a2tr(ronu4tltn fctad sDrmump;t0 rxrif oytlatr ueo;s)trxm(m3nodale mnei t  2uaxmo;o4aex ioctad s rl(ms (0 rtnmocia1oa  aiei;t)trumxr3nydomee fctls s2rmx p;u0tetn ociltfs el(mp u4trxnmf3tadfptr uvi;s)s2urim no4apenmivil(  ruaumpno4oeeniieiaslmDumu p (0trtomf3oa1la elues t0 rur(rpnu4lleemnvs t)srrrurono4tpx iociltfs2rmums;()arxnio iodomt au ilt)teum(o iu1al e nciatfaDra( p;t0apt ii3ias m2eau s;t0alenmf oytlaDrlivslt) 2tr(r oo1lp   nvtlt  rraxm ;o4tle ifeias m2ea(ms;u4 exoxr3ty1latrlu slt srxr(m oy1lp  lnei tf 2urumo;t1openii3iaslmDem(vs u0areomo3iy1fpDraivol(  rumim nodomeeliesl() ruaxrpnu4tle mieils sDuan o;u) rtnmf io1fm  aiei;(0teumirpou1lmenmfvt s)srum(r nt0oee  o3tat s um(vs;t)trtnxf oo1oatelnvi;( s2xoio3no1om  lfvias  rrmum no0optnmoeiyt s2ul( pn()trenir oytoat  u ols seurir io1lp e feil(  2raxmono4aetn oeiasfa rmn s;t)aetrmo iydla elnvslt0srtrio3no4ap nlici sfsrraxmpno0aeto ictadfa ranvpnu4tltnmrctodla rau ols0teto(r iy1op   ietls  Dtr(moot4oet  ieiydfs emuvp;t0artrmo iydfmtrauvil( s2xr(r no1op nmncia() rra(rp;u1apxo fetyslm umnmo;t4 etoxf ty1lmte nvs;s)teumxm oo1lpte ieta() Dtrxrp;t0olxoif3iydlm2um( pnu4tltnmo3tytlpD aivilt tetmxm3nu4ale livsls srtm( pnt0aetnmi3tldfa ua(vonu0areoxocoytfm r ies s0t2toxmpiu1llt livtas)arrax  ;t0tlenmociysfa2rlums;(0aetrxr3iotomtelnes s)trtoxr oodlp elncil(fsDtru  ;u4tlt mf3ils s rmnms t) lenmrciatoaDeluvslt0 2toxo iydame  fes s aDuaxronu0tpe ifeiyt s2ra( pn(0 reniociydoa  ln s t0t2tmio oy1oltnlnct t)sDururpnt4optnmi3ias aDua( o;(0teenmr tydfaD  n sls) 2trxr oo4ol  mnctatfa2tm( pou0olen fciad s rl( ont4aexnmf3todfp   ivs t truoxm3oydalte fvta()artaump;o4opxniiciasfs2elnvonu4 rxomo3ia1op rauvo;(0sexo(rpoudolte ietas  2tmx  ot1optniictysfmDranmonu4tetrifcoatopDelues s0 2urxr oodaltnmiei s)sruauroou1oexo iciasfsDul( p t)altoxfcia1oaD luvilt)trtmio nydomt livs sf Dum(m nu4apx ii3iatls ra( p (4tetnio3ia1omDeluei t)texrxo3nudole lfcil() rtmumo;u0apxnmieiltla umu s;t4trenxocoydlaDrlneo (0trxr(mpou4oleelncia(  rta(rpot0tet  ociaslsDuanmsn(4tlenxf3ia1faD lnvols)sexo(mpiudlltelfcsat  Dtr(ronu4oet ii3tydla2uluvp;t0 leoir3io1opte n o t0 rtrxopoudamtn ieia() Dtrx o;o0tleniicildfa2umums;t) exrir3oydop elneslt sexo(rpnydom nlfcil(  rtm(rpnt1oex  oeiatfa ulu o;t4tlxrircta1fatrlnvol(0setrimpnodop  licta(fsrtmx ooo4oetoifeiltfs2rlu pn() eeoiocoodlatraueo;s t2xrxmpnudol n ict tfsDtaum ;u0aptoifeiysls2ranmp t4 eermrctydop  ln i;s0trum(r iy4lm emncsa(  Dum(mont0tpt ifctadlm emumo;t0trenmo tytlaDeai i s0setr(rpny4lltnmneilt artau  ;o4opto iciatfs uln o ()trxnir ootop eluei () etr(r3iu1om nlfesat) rrr( p;u0oee iieiydlmDuaumpn(0 ltrio3oadfmt  ueo s  2xoio3iudomtnmfcia(faruaxmo;o4tlxomi3ild s2eln o t0 etnircto1fm e n ils srurim oy1omeelneiltf Duax ont4tpe mfctltlmDrluvs;u4aexnxociydomDelivs;t0 etmio3oydal   icil( aruru  ;u1tlxo feildlsDrlnvo u)artomociydfm elu i s0 etriopnudap elfeiasfsDurum oo1aet  fcias s2raums;t)trerio io1om   ieols texmio nodapeelfctlt srumxm ou0tpx miciydlsDra(mp (4 lxrxo tydom raieol( s2to(rpoo1amenlivs ( aDrmxmooo4aptomo3iasfsDranmsn(0tlxnxr io1faDraueo;( s2umir oudapenmnvias a2rax  nu4tee ioctldls rm(vo u)tlxoif3io1lpDeluei;()s2xoxo3iu4lm emivilt aDurur ;o0tlen i3tyslaDumu pnt4trxnmr todfpDeli ils0sexo(m3oy1lpe lfcsl(fsrtm(m ;u0aeto ictas m ranmon(4 rtnmf3tytom r ies;t trtm(m3iudaltn fvi ()aDrr(r ;o4apxn oetlsfaDua( pnt4artoir oydlmDraivo;t0s2xr(mpiodaptelfeslt)aDrr(mpnt1tet ifeiys m2em( o t0aexnircoydlatr neol() 2to(r nodlp emnvilsf Draump;u0ole mfeilslmDrl(monu) ltrxo3oydfm elueo;( trxrxm3nodale mnvi t  Durxm ;o1oeeoiiciaslsDem(vpnt0arxnio3oatoatr ivi s0sexmiopiy4optnlivsl()srumu  ou1tet  i3tldfs2ra( o;t)aexrmo oytom elnvi s sexoxo iy1ale lncsat  Dum(r ;t4altn ocild m2rm( snu) etrif3todomDeli o;( setr(m io4op nmnvta() rtmur nu0aleo ieiytlsDeanvs t4 lxrif3iodoptraiei ()trtmxr3ny4omenmieils)s2trumo;u0tle ii3iyd m2emnvs u0alenxfciotomt  iei;s) exoirpnudlp  lneia(  2tm(m no0olxnii3iyd s2ul( s u4aexrmo3totop eai ils0 etoim3no1al   ivs (fsrra(mp;u4alx mo3iatlmDumums (4alermf ia1fmD lueo (0 exm(o3iu4opeelfvils)artaxro;o0tle  oeiytfa2uaumo u0treriociadomtelnes ()sruoxm3iy4amee iet ()arrrur ;o0tleoio3ilsfs elnmon(0 leoxociodoatrli s t  exr(rpiu1al e icias  rrr(r ;o1opeomfetydlmDrlu s t4 ltoiocootfpD aueolt0sexrxm3iu4om   fcsl()s2uau pnt4texnio3ilslm rmn s;t4 rtnmfcio1laDr uvols)s2tm(o iodamtnmnvtat aruaumpoo0tpeomfeiysfaDea( snu4teeomf tydoa e ies s0seuoxm nydolt mncsl()
\ No newline at end of file
@@ -0,0 +1 @@
+uei;(0t2uo(mpny1opt lnesas  rra(r nu1texo oeiyd m rl(ms;t4 leriocoydlatr ueslt0trtmxrpno4lpenlfvils srum(rpou1oltnioeiytls2ulnvon(0aetrirciodlmDe u s s)seuoxo oodomte ieta(fa2umxmoou0teto o3iat s2ul(vo t0alenxr ta1fmDeaues;( texm(mpiudome lnvt s)arumxrpot0oltn oetatls2em(msn() rtoio ia1om eln i;t) eurxo3oodapee nesatfs2ta(moou0tee ii3ilsfaDumuvo;(4 etnir3todfp raieo;s  rtrim nu1ll nmfvi tfs2taumpoo0texn iciyslmDrl( o;u4 reomf3oy1latraivo t seumimpiy4lleelfes s)s2uaxmoou4olxoiieiydfa el(msn(0alxnif3oydlm   i o;(0 rtrxr3oo1omtnlfet ()a2taurp;o0alx mieiltfs2ua( pnt4arxrmf totfmtrlnvi (0 rxmimpio4al  lncsl(faDrruroou0apxo ictad a eau p t0alenio iotfateanes s)sruo(m3oo1omeelfetas)sDtm(roou4apxn oeiyt aDemu onu0 rtrmociy1fate u olt0srtrir iydopt liet (fsrraurpnt1tpt mieiyt s ulu pn(0tlxnmfcta1oa  luvol( t2umxr nydaltelnvias aDtaur no1tleomociysfa ul(mp u)texrifciadfate nvi t0srurim3no1omenlfvsasfsDuaur oo1tpe io3ils s ulumpn(4trtoircoytfmtr i s;( s2xoio oy4om nlfctl()arraxr ;o0olenifctaslsDumn p;u4 ltoxf iytlp eaivo;s)sruo(mpno1aptemnvils s2umur ;t0oex moeiysla rlnvon(4trtrif3tadlat lnvsl() 2trxm ny1apt  fet t  Drru  ;o0opxo f3ild m2uauvp u0aetnifctatlmD au s t0texmxm3oy4lp   nesas)srraumo;o4oleomfeils mDul( p t) lxnio iotoptrliei;s0 etoirpoy4lmee ivta(fa2taum nu0alt mictyd s um( s ()aetrmo3iy1fm e n o s)srum(m3nu1lmeelivtlt  rtm(mono4apeo ietltfa rlu pnt4trtoxr todoa eli s s  rumxo3ny1opt mfvi ( a2tmxmp;t4oltnifeiytlm2eaums;()alxrmr3oytom raneols)seto(opiudol elneia()sruaxm nt4optniieiad a rl(vo t4aeerxo3todfmDrau s t0 exmio io1am emnes t)sDtr( pnt4olenifcilsfsDrlnvpnu) etnmr3oa1laDelues;t) 2trxr3iy1om e iviltf Dtm(mpot0ope mfeiadlaDrm(vpn(4altrxfciydom raneo;() ruo(r3ou1lpeemicta() rrmumonu1opxnmfciasfm el(vs;t0arerircia1op elnvilt0 rtrxmpno4ll emivsa()artr(r nu4aexo f3tadfs ua(mont0aleoir3iatfa  anvolt t2umxopny4lp nlfcs sfarrr(ro;o1aeeo fctytlaDum(vs;() lxniocta1fate nvi;s  rxm(r oo1ope  ncils)srrm(mpno4alt  ieild mDrl( o (4tltrxf3to1fmteaies;s0srxr(r ny4ll   fet s)artmurooo1aee ioctltlmDumump;t)alxomf3totoatr uvi;(  euoir oydamtnmics s s2ur(rpot4alx iictlt mDrlums;t0 rtnmo ta1fa r u il(  rtoxmpnu4omt lnetl(fa2ua(r nu0teenioetaslmDuan p;(4teeoif3iatfaDr ivo s)trtoir nu4omte nesat  rrmxrooo1altn feild a ra( p (0tlxoxo ootlatrluvs;t0trumir oudapt mieslt  Dtruroot0tlxn icils s2emn pn(4teenir3todfpt  ivo (0s2xoim ny1lpt lfeiatfarrmxr oo1tee  fciatfa uauvonu4 etoxrcoa1lpt li s t  2trxr nu1apeemnvta( a2ua(rpnu0apxoiicilsla eauvpnt)aeenio io1lmteaivslt s2xrxr3iy4omeemivsls)srtm(roou4aet mo3iysla2rln p;t)trermociatlp rau sls tetm(mpio1lp  lfei tfsDrm( o;t0tlx mi3tys a ra(mont0tltnmoctydfmDe ies;s0s2uoirpoydlpe  fvtatfarumxro;o4ape  oeiytlm rl(vp u0altomf tytlm rlueolt srxrir3io4alenmicsa(f Dra(root1aleoioctad aDeln on(4aexoio io1lmtr n ols)srumxr ou4am elivt t)artmur ot0tltnmocildlsDeanvpnu4tltomr3io1omDe nvs;s0sexm(o3oudam  lieilsf Drr( pnt4aeenif3iydfaDelnvonu)aleoio iotlpt aues t0s2trxm ny4lpe  nci ()aruaur no1opx  ieiatfmDeau p;t0alxoxo todom raieils)truoim3oy4lm  lnvs ( sDrrx  ou1oex mieiasla2rlumonu0 ltrxo oadlm elnvi (  2xo(rpoy1om  micsl(fa2tmx p;t1oee ioeiytfaDemnmp (0aetnmo3oy1faDe ivils0setm(r nu1ome  icsl()s2ta(rpno4altnmiciydfs2ra(vo;()trenir ta1faD ai s s0 rtr(o iu1ll emfeil( sDur(  ;u4tetomociad mDrmumsnu0altnxo tydoa r n i;(  2xmxopno4lm e netas)aDuauroot1tpxomoeilsla umn o;u0aeenmfcty1lpte nes;t)t2xmio3nodalee ici () rrau o;o4oeeoif3iasls umuvs;t0tltoircty1op   nvs;s0s2urxmpoudapeemiei ()a2um(  ;o0aetniietlt aDean pn()trtniociytfa  lueols trtm(opnydalee iet (f rtr( o;u1altniociadlsDemu s;()teeoxo oo1lat lu i () rxmir ny1lpee ivsatfarum(mpnt4aetomf3iydls ea( pnu4aeeoxocto1lateli o;t)t2trxr iydlltnmfetasfa2tr( poo4apxn i3iaslm emnmo (0trtrmo iodla ean s () eurio3iy1lp  mieils) 2tr(mpnu0alenmiciydla ua(mo;t0aexomf3iytfpteln s;(0 ruo(o3no1om  mieilt s2um(r nt4teeo i3tat a emnvsnu) rxoxr tytlmtelies t  rxrxm3oydoltemfei ( s2ur(m ;u1olxn ociysfaDuaump;t4 eeomr iotomD lies s0t2xrxr nodlpe  nct (  rta(r no0oeen feilsls rlnmp t) lerxo3iotfmtranvi;t0teumio3nudlltelnes s)s2rr(rpou4tpe mf3tldls emumo;t0tleoxfcoo1lm elivs;t sruo(m oodlm  mfcil(fsDrrumoot0alxomfetyslmDrmnvp;t4aexrxr oa1fptraiei ()srxoxr iy4alte ietas  rta(  oo4opt moctlt s emums t0altrxocoo1oa rlu o;( sexr(opou4lpee fvi s sDtrxr nu0opx mfeiltfmDul( o;()arenmf3ta1lmD aiesl( trxr(o3nudolt lnetat)arrrx  no0ale  feildfmDea( s;t) exoifcoadopDr ivs;t srtr(m nu4llee fetls a2taur oo4oee  i3iyslm uaumo;t)aexoio iytoate u s;t)setoxo3ny4llt lfei t) rrmx  nu4aexomoetlt s rmnmonu4arermf3iodlmte neo;t0 rum(o3nodam elieil(fsrrr(ro;u4tleoif3ildfs emn o t0 lenifciytlptrln o s)texoiopoo4ol e nes tf Drm(m nu4apt io3tls m2uln s;(0trerxo iadfaDraueolt0t2um(rpoydam nmneiat)s2umxmpoo4oexnifetlsfsDemump u0artnmo3oy1fmteanvi t0 2trio nudolee icsas a2rmx  ot0apxn i3iatfs2uluvo;t0trtrmf tadom eln s;( t2tmxr3io4omtelici (f Dtr(roou4tet  fetld a2um(ms t0aleoifcty1lpD  ivilt0t2uo(m nu4ap e nei (f ruax  ot1oex mfeilt m uaums u0aeeoircoadlp rauvi;t)trtoim3nu1lleelneias) 2rmxrono1tpeo ocils m2emnvp u0tlerio iy1fa  li s ()trtmio iodam  mivsa(f 2ta(  ;t1apt  ictld aDua(vs;t)alermocoodlmDeaieilt) 2xrio3io1lme mfeta()a2rrxr nt0aptn i3ilslsDem(vpnt0teeoxf3totoatelivi;s)srtoio3iu4am elfctas)a2raurp;u4tleomf3iytfs ulump ()arxomf iydopD li o;( texmimpoydoltnlfeia(fsrrmx  nu4opt mfciadfaDuan p u0altomo to1opte nvo;s0trtmxm ou1omt mnctl(farrau p;t0olxnmoeildla um( p u4 rxnmr3iy1omDeai ils0texoir3nu4alt  ivia(faDrr(r ;u0aexn o3tlsfm2eanmp;t4 rxrifcia1opDean i s0 exoxr oodal nmnvia( aDumu pot4aeen oetysfaDumuvs t0 exoxr3iadlateau i;s setm(opny4lmeelfeias sDrax  nt4aex mf3iytfa2rauvp;u4 rtnxociodlmDeanes t0 rxo(o io4ale  ieta()sDum(mooo1tptnifetyslmDra( sn()aexrifcty1opt  n sl( t2ur(m3nu1oleelfcs t s2taurooo1teen f3ilsfa2elu pnu)tetnmo iotlp rlueo;t t2xoirpoudlle micta()a2urur ;u0tlenifcild a eln s t4tetnxf3iotomteaueols trto(o3ny4opte ieslsfsrtrx p;o4oltn f3tadlm uluvo t0 reoxfcio1oa eanvs s t2xoxrpio1ap emnvsl(f Dumu  ;t1altn ieiydfsDuaums;t)alenircto1omt ai olt  exm(rpoy1olte ies sfsDraumpou4tpxn o3iysfm2uau pnt0arerxrctotlatraiesl(0sexmio nydopt licsa( aDtau ono4apxo ocild s2elnvo;t)trxrif oadoateaivs;( srtrirpnydlm elicsa( aDtm(rpou1oet mfciydlaDeauvp;(0 lenxrcoydla eluvslt) rxrim no1lleelnvi t)a2tr(m oo4tlt if3tldfm2umump t0texnir iy1fm   neil()texrxmpny1omt mfciat sruaxmpou0openmiciasfm2elnmp;() renmf iotoatrauei s  exmir ny1am   fvslsf 2rmu  ;t0tpxnmfetlsfm rl( o t)tltnxrctodoa r neo ()srumir io4lpenmnesa(faDtaxm ou4aeto i3iat sDeluvpnu)alenio tatom  ai ils teto(m3nu4lm nlnvia(fa2rru pno0apxo feildls2ra(mp;()aetomrciodomD  nvolt0setrirpou1llenmnvil( srta(mpot4alt  ieiyt a elumpnt0aetoxo oatopteln o;(  rtrxo nudolenmfci s s2um(  ;o1apx  fciydfm umump ()aetomf3ta1lp r uvols) rurxr oydlltn ivt (faDumu ooo0tpenifctltlmDemu onu)trtnxf3io1op raivo t0tetoxm3ou1omtemfetls aDuaurp;u4teen ieias m2umnvo u0 eenifcoadlaD livsl() 2xo(o3oydopenlfvi s)srtmumo;t0oet mfctas a2el(monu4 renifcoytlaD lu i;()texm(rpno1oltelfes t aDumx  ;u1oexo ieild m2ean pnt4 eerio oatfa eluvilt)trtrxo iodlm   ict t  2uau ooo4oexomoetldlmDrauvpnu0 ltrif3tydopt auvo ()texrirpoo4omt mnctltfs2rm(m ;t0oee  f3iatfsDumums u0aexoio oatomDr i ol() ruoir3iu1op emictat) 2rr( p;u0opeo ocildfa rmn p t0trtoircia1fp rli s s) 2trirpiydaltn fvt t) Durxr nt0tpx ifctydfmDrlu p;t4trxnmfciadfp eanei (  etrim no4olenmnei s  2ta(mpno1aleomf3iytfs2elnvpnu0alxnxr3iatfpt luvsls) 2uoim3nodolenlfctatfaDtaxront4alxn i3iad m ul(mp t0 ltnxf3oadlpD luvolt0 rtr(mpiy4lmt  feslt)s2urx o;u1teenmieildls rmn o;(0artnircta1fptean s t)seuo(r nydaleemnvtat)aDrr(rpnu0oeeoioctld s2elnmsn(4altomo3oy1fmtrlnes s0tetoim3oy4lmeelnvsas) rtaumpou4aeeoiieiasls ean ont4alxnxr3oydfptraieo;() 2trxo3iudoltnmfci t) Dra(mo;o4opto oetls mDrmnmont) exoxo totfa r uei;s srxmir3iy1opee feilsf rrr( ont1apxnmociytfm2rm(mo ()tlxrio iadfmtelieols trxmio3oo4op nlictls aruru ono0aleo feiys s2eauvpn() rtrmo3iydopte uvo;s s2xm(m3nu1lm n ietas) 2tr( ono0aet iiciatlm2rauvsnu0alerir3oodfa rlu s;s0t2uoir3ou1op n fcs t)srrrum ;o1opx  icild a2eau o (0 etrmr ty1la   n ilt0srum(m3oydlmtemfcilsf Dumurpou0ole  ociyt a emnvs;(4 rtoxoctytfptrln o s s2um(r oudlmtemfeil(faDrmuroot4olt  o3tasla eanvp;(0arenmr3tytlm  lueolt0 2uo(r3nydope lfvi t) rtrurpnt1tee  iciytlaDrluvpnt)trxnxfctadfmte neils)t2tr(r io4ame mnvt (fa2uru ooo4opxn fciysfa rau p;u) lerxr ia1fp  ai o (  ruo(rpny1lptn fetasfartmurpoo4apxnmfetlt a2el(vo;u0tltrio3iy1lpt an o;t0trtrirpou4opeelncsa(  Dtm(rpnt4opt moctld sDua(vo u0 eenif oadopte uesls) etriopnodlmte fcsls s2taxrpnt1tlxoif3iadfa em(mp u0 lerxr ta1opt aivi;s0teum(opnydll n nct t) rtr( ont1aptoifctytlsDul(von() renxf ia1lmDranvilt  eur(rpiy1lpt  fei ()arraump;t4ole  octld mDuaums u0 renxocoodlmDelnvs;t  2xr(m nudolte fvt ()a2umurpnu4texomo3iyd m umuvs (4 etomr tatlm eanesls)tetm(m3no4ol elfctls srtmuro;o0ape  o3tltlmDua(mo t0tlerio oatfmD aues ( s2toir3io4al   icsl() rrm(r ot4tleoifctyslm emn s;t4 rxrxfcoatlpDe neolt t2xmxrpnu4lmt mfetl( s2umumonu0ole iictltfa2rluvp;()tlxniocoa1laDelnvo;t0trxrxrpny4op n nvtlt) Drruroot1oleoiieiatfm2rmnmo;u)tlxriocoa1omte n i ( s2trxr iy1lle lnvtlsfaDtmx poo4aex  f3iysfs2ul(ms;u4tltoxo oytlpt au o;t)seuoxr3no4ap  lnviatfa2rr( o;u4tetoiietyt m ulnvp;() rtnxo tytomD au olt0 rto(mpoydole lfcsas)sruru  no1alx  ociydfaDrm(mpnu)aexoifcto1fa   n i;()setm(mpnudomt mfcs ()aDuaxm ;u0tpxo iciytfsDrm(vo t4arenio oa1lp r iesls) etoir nu4om  lfcsas)srur(monu4olt miciys a2eanmont0aetoir3iadopD  ivi;s0setrxm3iu4ll e icias) 2taumonu1texniictld m2rm( p;t4arxrifcoa1lpt anvs;t s2xrim3iy1olenlivtas)sDrrurono1oexn ieiatfs um(msnt0tlxnxr tydop e u s t0 rtr(r nu4ome lfeta(f 2rmxmo;o1opx mo3iytlaDeanmsn(0 lxoxfciydlat an o;t t2umxo oy4ol   iet s)s2umx pnu4apxomf3tltfsDrlnmont) eenmo tadfa r ivs s  rtr(m3iydlpte fvias s2trxr no4tptnioetyd aDemnvo;(4 rtnmr oo1faDrln il()srtmxmpoy1om  lict sfs2uru poo0oetoioetyslmDeanmo;t0aetrmo oatfat aueilt trxoxo3ny1omte icsatfsDumxrpnt4aex mfetydlaDra( snu)tltomrcoa1oa  ln olt) rxrio iydamt lfeil() Duax  no4oexomoeiasfa2uan p;t0teeomfcia1latr n olt)t2tm(m3oy4op n nciasfaDtmxr nu0apto fcias m uau s u4trtomr tadoaDean i;s)s2uo(o nudlpt mncilt sruaurpot0aptnmf3iadla2rmu o () rtnir3iy1faDr uvol( srxmxr3oy4lmeelnctas)srrau  nu0tlen f3tls a2rln s;(4alermf ty1fmtr i sl( srxm(o ou4lmtn ivil()aDraumpnt1apto ocild s2rlu s;(0artoxrciatlmDrluvi;s)srxrxr3nydlp   fctls srururoot0tlt  o3tadlaDelu s t0trtoxrciytoa  luesl() rtmir ou4oltnlfeilt aDumxmpoo1olxniicilt sDran on(4 rxnxo iotomDean s;s  eurxo3no4openmicsat  Dtr( oot4oeto ieiys a eauvs t4 rtrmfctydfpD lnes t trxm(opiy4ap nmiei ( sDtm(m ou4opxnmf3tad s2ean o;(4aeermr ty1omte nvs;s)s2trxo3oy4lmt lfcsa() 2tm(r ;o1tlenifctld s2rl( o t0 rerio iytomte ivo s  eto(rpou1llenlncsasfarur(rpnu4aptnioetldla2eaumo;(4teermo3oydlatrlnes t trtrxr io1ll nmnvt (  Dur(rp;t4aet mieiysfmDul( o t)tlxrxo3to1lpt  nvilt0s2umxmpoy4lltemneiat) ruaxr nt4opeo i3iytls2umnmp;u)aetomf oydlm rai il(0trxm(m3io1ome mici t s2trx oou0opxn oeiatlaDemu snt) exniocoy1om  lueslt  2xo(rpoy1lme miviat) Drr(m ou4aptnmfciltlm2rmuvp;t0 rtnxf iotfaDrli ilt  rtoxr3ny4omt mfesasfsrrmxro;t4teenmo3iydla2uau p ()altnmocoo1lmD aivo t0 rxr(r oo4lme lnesl( sDtrurp;o0teeo i3iad a umuvon()treomo iatop eanesls0teur(r3ny4om n ies t)aDrrx p;t4oetniicias sDea(mo;u0trtoxo to1fmte nei t) exmxopiy1alt lieiat) rurxr ;o1aeeoio3tlsfmDra( p u4 rtoirctatom elies;t sexoiopny4lp  licsl(fsDururo;t4ope  iciydls2rmn p;u) exnxrciytoaDran o;t0s2xr(opnu1oltemneiat arrmum ;u0aexomf3ilsla ulnvpnt)artnxo oo1faD aivols  rurxo3oydopee ieias  rtrumonu0alen fctldls uanms;() eeoxo iatfmDeli o s)s2um(o3ou4om elfvsas)a2tmx o;o0altoiietytlmDemn o;(4alenxoctatop rli sl() rtrirpno1optnlnviat)sDururooo1optnmieils sDuaums;u0 ltnif oytlaD aies;()trum(mpiu1open icsat)srurxm ;o4tlxn ociyslm2eanmp;u4aetrxr oa1fpDeaies s)t2tmio ny4op n nctls)srtau p;t0aeenmfciadfs eau s (0 lxrmr3iydfaD lneslt)srumxr iy4oltn nei t) rrmumoou1ole mf3iyd a rlnvs t) reniocoydfm elneo;(0tetmio nodal nlicsl(  Drrxm ;t1tlx mfciatla ra(vo;t)teenio3ootfpt lues (  2ur(o3oy1amt  nvsas)a2raxm nu1alxo f3iad m2ua( pnu4 rxnir3iatlat  uvi;s0trxrxr oudlmenmfvsl(fs2rr(mpoo4aex ioeiadfm2eauvp t)altrifcoadla eluvsls)seto(o nu1amte fci ( a2rr(m ;o4tet iociatls rmumsnt4alxnxrctytoa rlu o;t0s2tm(o ny4ol e fciltfaDtru p;o1tlx  iciadlaDul(von(4trxoifcta1lp rai i;t0sruoxo3iy4op nlics sfaDrmxmonu4olenmociyslm2ea(vont4treoxf ta1fm r i slt0 rxoio oo4op elicias)s2umxmoot1oeeoio3tytlaDrau s;t4 etnmr3oodfptr nvi;()t2tmxm3oo4ape  nci sfarum( p;t1olxoifeiyt aDean o;() exnxfcoydoat auvols0srtoxopoy4apte fes s aruru ooo1aetnmo3ilsla emnvs t4altrir ia1fm r nvils truriopou4al nmics t aDtax o;t4apxoiiciatfm uau ont0trtrxrcoydomtr ivslt  2tmiopoodllt lnvsas)srur(ront4apeniieiyslm2eau pnt0 eeomocoa1lptr ieilt  rumimpno4ole mfvi ()s2rmx  ot4oeeo fciysla2ul(vp;(0 rtrxfctydlmtrluvilt  rurxm3nydole miviasfaDtr(mpnu1olenmoeiasfsDeanms t4arerxrctadop rlues ( srxrir nudaleemivtlsf Dururpno0teto i3iasfm umnmsnt)trxnmf3tydlp  ln s;s t2to(m3oudap nlietltf Drmxr ;t1tltoifetldla elnmont0 lerxr iadfm eanvi ()t2xo(mpny4lp emiesl(  rtauro;t1oeeoiiciysfa rm(mpnu)arxoxf tydlm rlu o t  2trxm3oy1optnmfviat)sDuaxmoot1tpeo oeiytfm2rlu o t0trxrxr ty1op rlieil(0trtmir iu4alte ivsls aDtr(r no4aexoiociytlmDeanmsnu) rermo ootomtr neslt s2tm(opnudaleelnesltfa2tmx ooo0tltnmi3iad mDeaums t0treoxo oatfmtr n olt)t2xmir3nu1am elics sfarra(mo;u1oetoiociltfmDea( s t4 rtrmf oatop rau slt  2xo(m3iu4alenmnvi sfarrrxm oo4tlxnmoetasfm2el(msn(4 lerirctadlmt aies ( seurimpny4ole  ieta(farrr(mono0olt  ietadla2elnmo () etrmfciatfpte ieo (0trtm(m3oo4lmte nvsatf 2ra(monu1ape if3tldlmDrmn o;()aleoif3ia1lpDeli o;(0seuoio no1om elieta(fartmxmpoo0alenmo3iyt a2rmums u)trtrmrcoy1la e u ols0s2xoxo oy4ope mneta(  rta(m ;u1olx  o3ils a el( o t4alxrmo3oytlp eau s ( t2xmir oo4opt  ivsas) Dtmu  ;u4ale mociyt aDra(vs;(0aleomocto1op  aiei;t0texmxr iodom nmfcslsf 2rrur nu0tex mictadls ul( pn(0trtnmf oodlaDr u s;( s2toxopoy1lme miesl(  rraxronu4tlxn fciatls2ul(vsnt0 lxnif3iatlpDe ieol(0t2um(o oy4llte nvtatfa2raxmont1alxnif3iadlsDelumo u4 lenmf3iotfatran i;s truoxmpnydoleemnct tfarrr(moou0aptniieiyt a eanmpnu4 lxnxo3oytopDeln il( teur(r nudoptelnctl() 2tau  ot4aeeomi3iad sDeauvo;u4alxomrciytfm  liei;s  2xmxrpiy1aptnlnvtl()sDum(rono4apxn ictls sDeluvo u0 rerircio1fp  lieilt sexr(o3io1oltelicsltfs2tau oou0aet ifetasfs2ra( snu4 rerio3iy1fm e ivi t0 etoir3iu1llenmfes s)aDtm(mono1tpx ioeiytfsDel(mo t)teenxocoy1omDrai o t0teto(r io4aptnliesa(fartrxmooo4oeeoioeiyt s rmnmp;(4 lxnmrciatlptrlueo t) eum(r oy4optemfcslt)aDtmxmp;o1tpx iociydla rlu o;u0 rxnxr totoa rluei;(  rtoio oydapeelfvta(  2umxmono1apt mfctys m2ulnmont0 exnxf3todomDeaivo;(0 2xmxopno1lmt mnesat artru poo4apeomfeiysfa2umnvo;u4arenxr3iy1la   ieo t0 rxoxo3no1omt  nci tfs2rax  ou4aet mf3tadlm ulu o (4trtnir3oadom eanvs;t seumim3iy4ll nmnvslt)sDrmx p;u0tltomo3tlt a2ua( o u0altrir tydlaDe ieo t)trumirpiydap  lncils) Dta( pot1olxn oetadfs raump t4trxnxf3oodlpD lneslt  rxrirpnu1lle micta()a2tmuro;t0opxo iciysfa2rm(mpnu0teeriocoadom rai o;() rtoim no4ll nlnvi t)srtmu poo4oeen f3iat aDemnvsnt0alxnxr ootoaDeau ol( srtoxmpoudol   fci (fs2ta(ro;t0tee iieiys s um( p;(4tltnxociatomD luei (0 2xo(o3no1ape liet (  Drax ono0tex ii3iat m uanmo;u0texnio3oy1fpDrai o ( t2tmimpnudaptemnvtl( arum(rooo0tle ifetldfm ea(vo u0 rtoio oytla   uvs (0trurxm nydolenmneiatf Drrxrpou4ape iiciytla2raumo t0texnmr3todoaDraies;(  eum(m3ny4apeemfci t)srrax  no4aexn feilt mDul(mo u)teenxocty1fpte nvi;() 2urxo3iy1apeelfvs tfs2tr(mpnt1tpto o3iydfm ranmo (4aeeomfcto1lpDrlu s s)setoxmpoo1ol emneils  rtax oou1tet iieild a ea(msnt4texoio tadfm raieo;t)srxrimpio1op e fcilsfsrua(mp;o0tle  i3ild sDrm(mp;(4 etoir oydfm   n olt)trumir io4amt  fvi (  rtr(r nu0tltoifcildla ra( s;u4 exnxociydopD aneols)s2urxr3nydlm elnes tf 2rrx ont1oexnifeildlaDemn onu)trxnxf iadoaDran i;(0 rurxmpiu4ame mictat) Drm(rpnu0alxnii3ilt m2emn ont0alxriocoodfpteaieo (0sruo(o3io4omt mncs tfa2um(rpno4tpeo o3tydlm elu p (0texnmr oa1lmte u s ( seuoxm iudameelfes ( arur(moou1tex mo3iytfs rl(vo u)trxnxoctodfptrau i s  2xrimpnydlle lnvt s  2ur( poo0tlxo fctysfa2emnvs;t4 ltoiocoydfaDrlneo;(  euoim nu1olee iviltf Drmurp;o1apt  iciltfs2elu o t)tlxomf3ootlmtranvslt0srtoxr3ou1alen netl(f rum( poo0tlto o3iadlm eau s u0teeoxrciydlmteau s ( teuoxm ny1lmtnlfvsas s2urum nt0apxn oeiadla2uanmon(4texrmf3oatopDeai sls t2um(o3nodlltelnvi tfs2urx  no0aeenmoeiytfmDumu snu)alxomo3oo1oat  ueo;t0s2to(r nudomtnmfesl(faDtru p;o0alx  fctadlm2eln s (0trtomociadlaDrlivolt0 2umxr3no4omeelnvs s)aDrax  ;t0oex ioetyd sDel(ms u) etrxfciytlptr ivi;t) rxoxo3nudlpe lfct (  rur( ont1tlx  oeildfsDumu p t4teerxf iatfp  auvi;t) 2xoiopoy1alte nvs sfsDtrxr no1oee mfcild a eau ont)tetnif3ta1lm rlnvol(0teurim3iudlmtn ies tfs2trumo;o0aptoifeiad sDrl(ms t4teerifcoytfmt lnvi;t  2to(o3ou1lm elivsas)s2taumpnt1oetnii3tatlm uan o;t)aetnmfciatlm ranes t)trtrxo3ny1aleemfvsls) 2uaxrooo0openifeiydfm umumo t0arxnmf3ootfp raivo;s srumxr io1apeemietl(f 2ur(ro;u4texniieiltlsDrmn o (4 lxrmo3iadop elu s;s) euo(m3nu4ame lfesa(fa2trxmonu0apeoiociltfm2rmuvont) lenmf oytomt livo t  exm(opnu1lme mivt tfa2umu o;o4tpxoifeiltfaDrluvp;u)arxnio ta1laD anvils  etoio ou1om  mfvils  2rru  no4tpeomiciaslaDulnvs ()altoxf tydomt livs s s2trxm3ou1lpte ivs s)s2umx o;t0aeeoii3tytfs rl(vo (4trtrmfcia1op rai o t  rxrxm3nu4alt  ieiltfarrmurpou0teeo iciadlm2rauvp;u0alenmo3totop ranvs s  rtmio ny4lpt mfeils a2rrxrp;t0olxoif3iyt a2ea(mp (4artnifcoydfaDean i t t2uo(o iy4omtelictas artru o;t4tlt ii3iltls rmuvp;t) exrmo oydopDrluvo;(0t2urim3no1ol n fvi s) 2rax p;o4oetnmicilsfm elnvpnt4 rxomrctodoa eli i t0truo(mpno1apeelnviltf Drmxrp;t1alt ifeilt m el( o u) eerir3ootoaDr uvo () 2xo(rpnudapen ivilsfsrtrumpou1alxoio3ils aDulnmp (4tlenmo iytfaDeaieo (  exrio3ou4lpe lfeta()aDum(ro;u1tpt ifctasfm2uan snt4 ltrmociydomt anvi ()teurimpny4op nmfcsl() rtr(  oo0oexo fctatla2ra(vo ()aetrirctadfptr ieil() 2uoiopnu1ome lfei t sDuaxmonu0aet  oetltfm2ea(vo t0tlenmr ia1latranes;(0s2xrim3iy4llenmfvsa()s2ur(m ;o4opx mietatlm ea( o;()tlxoxo3iytomD luvslt)srxmxo ou4lleemfesasfsDtmx oou1aetnmo3tytls2ulu o ()aexrmocty1lpteanesls) rto(r3nodapee ieiasfa2um(  ;t4altnmi3ild s2rm( p;t)aexnxrctadlpDr neol(0seurirpny1oleemnctlsfsDua(rono1apx if3iadlm2ranvp u)aexrxr3ia1om   uvols srxrirpiodlltn ics () rtmx  oo4aleoiiciyslsDeluvonu)artoxo3tytfa e neols t2tr(r3ny1lpeemici tfs2tmx  nu0tpeo fciys s2eaumsnu) eenmocia1fa rlnes;( seumxo3iudll  lnesas  2tmxro;u4tet moctltla2um(ms () rxnifcta1om r n i (0tetr(r3ny4opt  ivt s) 2umxronu1alxoifctlt aDrmnms;t4aeeoxo3ootomt aivs;t)sexoxrpou4al nmnet () Dumxrp;u0teto iciat sDra( onu0 exrxf oatomte nvi ()sruo(rpiudalenmfet t) Dtaxmo;t1tptn oetad mDua( on(0 lxnxo3iytla  an sl() eurxm io1optemfetas s2ur(m ot0oet mfciyt m2uan snt) lxrmr totla  anei;t) rumim oo1llenlics s sDuaxrpnt4oex mf3tas aDemuvs t)trenxr3oy1omDelnei;s tetoxo3oydlltemnctat) 2rm(roou4tle ifcildlmDrlnvont) ltnmrcta1oa  auvolt)tetmxo3io1omee ivtlt sDurx p;o1tlxoif3ias a2el(mo (0 ltrxr ta1faD luvol(  2tmxm iy1om nlies tfsDrmx pno4tlx ioctysfmDrln o;u)tetnxf oo1lm  lu s;(  euoxr3nodop emnesl(farumxronu1olxnif3ildlaDeluvs t)aleoirciatfat  ivil()trxriopiu4ol e ivi (  rum(mo;t0teenifciytfm2rmuvpnt4arenif oodopDr neils0 euoio3ou4ape lnet tfsrrmx onu0altnmfcilsfa2elnmp;t4alxrxocoytoatelu i;s0srxrxr3nodol nlfvs () Dtmu p;t0aee mo3tatfa umu pnt)trxnir3oo1oatr ieslt)t2ur(o3oydomtelivtlt aDtm(monu4oex  i3ildfs eau s;t0altnmf3oa1faDrai i;t) rxrim3oydol  lnvs (  rra(m ou0apen ieiadlmDrmu s ()trxrmo io1fmtr i s;s)srxr(m3oodll  mfet ()a2ur( poo4apt mfetysla umu o;() exnmf3to1omtr ueo;s0s2xoxo3oodol e nes sfaDrr(ro;t4oetn o3iatlmDra( s ()aexrif3totfa ranvi ( texoio oudamtnlivta(faDrrxmpot0tleo ieiysfa2rlums t0trtnmf3ootlmD ln olt0setr(rpiydop  mnvtat)aDumu pno1tlxomoctlslm em(vsnu) ltoxo3oadlmDe ies ( s2tmxm ou1oleemfeilt)a2um(mo;u4opt ii3tatfm2elumsnu0 ltrmfciodfatr i i;(0teumim io4ol  lfvi s a2uru  no0tlxomfetydlmDran o u0 lxnxr3todlaDraivi t0s2to(rpnudlmenlicia( aDtrxm ;o1oexn ieilt m ul(vo;u0trxoxf3to1opDraueo;t s2tr(o3ou1ll elicils  2raump;o4openioctas m el( onu0artoif3oa1laD ln s t0 2trirpou1ome  fvs t srur(mo;o0tpe iieiytla2rau s;(4artnxf iadomDe ieols0 eurim oo4ameemfvta(f rrrxmpno0aptomfeias m2emnmo (4 rxnif3ootla  li o t t2to(m3iydlp   nei t srtrxrpnu1tle ii3iyd s2ulnvp t)alerxo iadoaD  ivi;t0 2toim oy4amenlnes t  Dtmuroou4tle ioeils aDeanmpn() exnmr3iadomtrai i ( t2xrxo nu1om   nvs (  rtrumpou0apt iiciad s2eln p;t) exnxrcta1fpDeau ols  rxmxo no1lp  lnvs tfs2urx pnt0aleoioetlsfmDum(mo;()arxnxociy1lp elu s t)tetmir iudoptemfvils) Drau  ot4tpeo ietaslaDelnmo;(0 etrxf3iatoate u o;t  exrirpno1llee nvsatfartmur no1optoif3iatlsDelump (4arxoio todfpD  u ilt0 rxoir iy1alte fvtl(faDumxronu1olx mictld m2um(mo;t0aleomf3iy1laDrlnes;(0texo(r nodoptemfciat sDurxr nt4oetnifeildfa2rmumo u4 renxrcoa1oa raivs;t0sexrxo oodlpen iet (  Dum( oou4texniocilslm umnvp;(4 lxrxo3iotfm   nei;t  2urxr io1amee ieilt sDur(r ;o1opx ioetlt a rau ont) etoxo iodoaD  u ol(0 exm(r oy4am n iviat s2tmxm oo0alxo feiadlm uau onu)aeermf3iydopD aneo;s0sexoxr3nu1lmenmivs s srrmumoou0tlx if3ils a2ua(msnu4 exnxociydlat  uvils)srxoxmpou4lmenmivi tf 2urxmpoo0aptnmoeiaslsDranmp;(4arxrifcootlate nvo;() rxrxm3oy1lle  ncsls)aDurxm ;t1oetn feilsfs2em(mo t4teenmr oo1fpDr nvo;t)srxoxo3no4apt livt tfsDrrum ou0aeto ieilsfaDuanmo t)tetrio3ia1fpD  i ols0 2tmirpny1amt miet s srra(r nt1alxomi3ilsfs2rm(mp;t4aeeomo3ia1fpDrlueolt sexrxopoo1om e ieils  Drruront1tpenmi3tld mDum(vp (0treomrcootlaD au ilt t2uo(m nydlm   nvsls aDrauront0alt  oeils a2em(mp (4 ltnio3iytfm   u slt srxoio io4ol n ieslsfarumur ou1altnmo3ilslmDelu pnt4 rtrmfctytoaD an s t srum(m3nudlm  lictltf rta(r nu1tle  fcilsla ean s;u4 exnif tydlmDean i t0s2toir iy4ll e nesls aDur(mp;o1alenioeils a umuvs;t0trxnxf tytopteau i s t2trio io4ll  mfcs s)s2rr(r nt4tptomoctltlsDrln onu4alxrif oodop eaueo;s setmim io1olt lnetlt) Drau  nu0tet if3ilsla elums;t0artniocoatfmt  i i;(0texmxmpoudap n fcsls) Dtmu  ou1texo fcilsla2emnms u0teeoif iatoatraivo;s tetmxmpno1lm nmncsl(  Dtm( pnu1tlt io3ilsfsDumn s t4 exoxf iotomD lneo;s)t2uriopno4lmt mivil()aruaum oo1tleoio3tadfaDulu snu4altniocoytla elivi;s0 rto(r iudomen nctls)srumu p;t0oltn ictysfmDumu p;t4teeomfcoodoaDr neo;s)s2tm(r3oo1aptelnesasf rurxm ot0tpxomi3iytlm ulnvon(4artrxociodomt aiesls)s2xmxr3oodllee ncsltf Drauronu4tlxnmf3tat a2ran p (0trxrxf totfateanes t)trur(r3ou1optemnvi sf Duax pot0olx miciyslm2rluvp;()artoirciadla eluesls0trxmiopiu1lmtn fet sfaDtrx o;u1olxn feiydfm2uauvp (4trxnif oatlmD  uei t)setrirpoydlpee nvsl() Dtrx o;o4tlxo f3iytlm2uanvs;()areomo3iadfp  au slt truoimpiydal  mici t  Drm(m nu4teen fciysfs2raumo u)texnmf iotfm e ivols)t2xrim oodal e ncsat)srumuroot0olt  ociytfm rmu on()trenxfciy1omte ueols srxrio3io1oltemnvsas) Drmx pnu0teenio3ils a rmnmon() etoxfcoa1oat aiesl( sruo(o3oodol elfei ( srrmurpno0apenmieils sDeauvp;t)trtoiociytfpDrliesls)sexm(opno4oltnlnvta(  rrmxmpou4tlt mi3iysla eau o u4 etnmo3totlm rlnvs ( trxr(m3iy4ole  nct ()sDtrxmp;o1tlx ii3iyd mDrmu s;t0 exoio3ta1fmDeau ol(0s2xm(r io4ol e ncslsfsrtaum ;t4optoio3tat aDemnmo;u)arxoxr3iadomDrluvs (0srur(m3oydolt miesasf 2uaur oo4tee iieiasfs eauvonu0 rxrmf oydfpD  ieil(  rxo(r io1lle lnes t  rumumo;o4apxoiieildls rlnvp u0tetoxr io1lateaieols)setrxr3nudomee nviat sDta(mpot0olt  f3ildla2rmu on()trtomoctadlat  i s;t)t2xoxm3ou1apt mivtltf 2taxmpnu1oltomiciys a2uanms (4 ltrio3tatoptraneilt) 2to(o no4lpeemfes ( aruau o;t1tet  iciad m2rm(mp u)altoio3iydfa eli sl(0srurir3io4aptnmicsa() Drmuroou0aet mo3ilsfm2rmnmp;()teerio tadfm   n i;()trtm(rpou1om n ncsl( a2rmu  ;t4oltnifeiytla2ra(mo ()tetnxfciodlatrlnvs () 2tmxo3iu4op elici s)aDumuro;t1opx iociltfsDumnmo t)arxoif3ootlptr n i;t)tetrim oudamenlivilsfaDuaum nt0tle ifeildfs emuvo;u4tetrmoctotfp rlnes;s0s2xo(m ou4open nvi t a2taumpnu0aee  iciysla um(vp;t) lxrxf3iy1fm r uvo s)trtrxo3oudlmee nctlt) rur(  nt0oex iociatfa2uanmsnu4tetnmrciodfptr ieol()s2tmxr3oo4om nlici (f rumurpno0tpe  ieiadlaDrm(vp;u)arxnxocoatfaD auvi t srxrxo3ny1ll nmneslsfarumurp;u4teenmieiad s2ulnvs;t)trtrxr oo1om elues;s0 rumio3oudlp n fvtltfartrxrpot1alxnif3iltfm elnvs;t4tlerxo3iotom e nvol(0t2tmxo nodope mfcta( srrm(  nu1oeeo iciydfs rmnvsnu)aeeoir todlm   uvs t sexm(m3iu4lltnmfvs sf Dra(m no1opeoii3iasfaDumn onu4 rerir tadoa eaueo t setoim3ou1opt mncsa(  rurumooo1oet  o3tydfmDumumpnu4tleomr tadfa rli i;t) rurxr io1op e ivta(f Drmuronu0opt  iciysfs uauvp;t0 eeoiocto1fatr nvs t)srumxo nodam n nei t) rrr(mo;t0olx  ietydfaDumn p;u)texnmf iy1fa  aues t0 2tmxm oudolenmiciltfarrrx pno4aee  ieild m2umuvpn(4arxoio io1lp eaieo t srxmimpiudllte fei s sDraum ;t0opx iociatfsDuaumonu4treoio3iadla eau ilt tetm(r iodameelicsat aDtaump;o0opeomieiltls2eanms u)aetnmocoydom elneol(0setm(o3oudlpt  ivs sf 2tm(r no1aetniocildls2eauvpnt0aexrmo3oo1oatraivols t2to(m oo4lmtelnviat) Dtax  nt1aleomo3ildfs2elnvs;t4arenxociodop ran i;()t2xm(o oy1ale mfes s)s2tmx  ou4teeoifetys mDelumo;(4 rxrmo3oydom  aieo;s0seumxm iodomtn iesasfsrtr(r ot1tpenmociat a emuvp;(4arerif oy1lptelivo t)t2umxr iu1omtn fci ()a2umxm nu1oetniietydlmDelnms;u4tetrxrctytoaDr ivslt t2xm(r3iu4ll nlfvia()a2raumo;t0tpt ifcild m ulu ont0trxnir3oytlpD  ivo;s)t2xr(m oo4altnmnes s sDra( onu0olt mfctldfsDrau p;u)tetomo3ty1lp e nvi;(0 2uoxr iy4al emnvia( arur(m nt0ape if3tadfmDum(mo;t)aetrmfcoy1om r i sl(0srto(rpiydam emnei (f Durxmo;t0ope iictas m umuvo;(0 rxnio3ia1oa  ln o;(  etoio oudlme  fvsls)sDumumo;u0opxoif3ildla2umu p;u) eeoxr tydlmt aueolt)trxrirpoydamtnlivias)sDrm(  ;u4tpxniictydls2ulnvsn() eermr todopDeln slt t2uoxm ou1op   nei tf rrr(moou0tptomieiysla2um( pn() rxoxf3tadopDelues s0s2xrxo nydap nlneta( srtrumont0ale mi3ildls ranmo t0trenxr3to1oateauvo s)texoio3iudol n nvs sfsDra( onu0aetnmfciydlm emn on(0texomr3iytfp eauei;( s2xo(o3nudop nmivs t  Duaxrp;t0aee ifeiatla2rmnms;t4teenxrctatlmDe n ol(0 2xoxr iu1lptn feia(faDraurono1apxnmfciytla2raump;() lenif oytfaDean i;t) 2xrio nydoptemies ()aDta(ronu1optomfctld m2rm( on()alenxr oa1om   u s s  eum(o3iy1oltnlncs s) 2rrxrpno4open oeilsfaDrm(vo;u4arerir3iydlmD ai s;(0sruo(o io4opt mfetatfa2raumo;t1tpxomietltfm2elu s (4 exnxf iydoaDeli s;t0sexr(m io1op n nvias  2taumpoo4aptn i3iyd m elu s t4arerif3ootlatelivo;s)seto(opoydlpe mfet () rra(ro;u1tle  feiatfm umnmsnu4aeeoxf iotlm ranvo ( trxrxm3nodaltn nci ()a2uaxront0aeeoii3iatls2em( snu) ltomo3ia1lm eli sl()t2xmim3io1omt  netl( sDua(rpno0alxnmi3iydfmDumuvs;u) ltrxr3iytfp rlu i ( tetr(m iu4lmee feiltfs2raurpnt1ope mf3iad m emnmp;u0aeerio3oodoatrlnvo;t texrxo3oo1al emfvt t artm(m no4olen oetyslaDrln o (0trerir iy1lmDrluvo (  rtmxmpoy1llen iviat) Draxr nu0tpe mfeiat a2elnvonu)arxrmo iy1fat  u o;s0 rtoio3oy1ol elnvslsfa2ra(  oo4aexnmietyt sDrmums;(4 rxomo oa1fpD  ies () 2umim3iy1apen fetatf Dua(  ;t1alx iieiad a2rmnvp (4 rtoifcootoaDeanei;(  rumir nu1llenlivsa(  Dtmu pnu0opeo ietltls rm(mo t0tlermr3tatfpD  ivs s0trtm(o iu4ap n ici ()s2ta(mont0apt  oeiltlm ulu o t)tleoir3tydlptrluvols trumim nu1lp  mictas arumum nt0aex mf3ils s uln o t4trxnif io1opDrlueo t tetr(r no1lpeelnetlt)arrrx oou4aptn feiydfs2el( pnt)altomr3tydfpDelneolt srxoirpnodop  lnesltfa2rr(mo;t4altnmociatfa2ua(ms u4alerxf3iy1opDr nvi;t) 2urxr ou1amt livs sf ruaxmo;t4texn fetlt a2rln p t0 ltrio iodfpte n il() 2tr(r oydam  lnvtlt arta(rpno0tpenmocias mDulumo ()texomfctydomD anvsl(0teumimpiu1optelfvt (  rum(rp;o4tpe  feiydls2ea(vs;u4 lerif3todlp eln s t)trur(opno4oltnlfvt ( srurxr oo0altomf3ildla em( ont0tltomr3oytla e uvsl(0 rto(m3iodlle mfetat  Drrxrpot0tpxo fciydlmDeanvsnu0texnmr3tatlp r n slt0setrirpno1lme  nvt t sDuax p;o4opeoiicildla umu s;t) lxnmo3tytlp r ueols)t2xo(m iy1ol nmfet (fsrtruro;t0oeenmi3iasfm2emnmo;u4 renmr oodlmDe uvi;s0t2xmir nudllenmicsls)s2taumoou0teenifciydlsDuln snu4 etnio ootfpt luvol()s2tmir ou1amt  fvta(fsrur(  nt4aleoio3ildfmDuluvs;u0trxomf3iatfmDrli il(  ruoxm3iydapee nvsls aDra(rono1alxn oeiltlmDumuvs;u0 rxoir3oadomDrlieol(0 2ur(r io1omenmnetatf Drr( pot1tee mictlt s ulnvonu4teermr ty1omteaneo ()s2triopoodol elfcs tf 2ur(moot0tle mo3iadfs um(vp;(4 lxoxocty1fmDr i i s0trxrio nu4apenlicil()artr(mpot4opeo o3iat s2um(mo t)tetrif totomteln o;t  2uoir3ou1lmte feilt srumum nt0aeto feiydfm ea(vp () lxnxr oa1opt  iei (0 ruo(r3oy1lptnlnetatf Drrx o;u1oee if3ilt m ra(mpn(4 eeomo3iy1fmDeanes;( srxr(m3ny4alee nvsasfsrrrxr ;o1texnmi3iydfs2emnvp;(0artrircoydlatr uvsl() exrxo oodamenmfvsatfs2truroou1apxomoctatfaDeluvsn() rxomocoydfp elivslt) exrxr iy4altn icta(fa2uax  nt0oetnio3iaslaDraumo;u)aexoio3oy1lm e n s s0 rumiopiu4aptnmfes (f Dtruroot4aetnii3iasfs um(ms;t)aeenio tatlpte uvil( t2umir3oydapte nvt (  Drr(rpnt0tlx ifctysla2umump;u0 rtrxf3oodfp  aiei;s trur(mpny1lmtelfvsls)aDrm(rp;u4aexn fciys a raumo ()texnioctotlmD  ueo;s)s2tmxmpny4lp  lfet tf 2um(mpno4tpt mo3tyt mDemumsnu4aeerifcoodfmD auvs s teuo(m3ny4lm elnetltfs2uau o;t0ape  f3iydfa2ulumont4tltoiociytlatrlnvs;t) euoimpio4lm nlivsas s2rr(r ou0teeomoetytla2rmnmp;t) rxrmo iodfa rauvs t0trxrimpoy4oltnmiesas)srrr(rp;u0alxoiietytlmDeluvo u4arxomf3tydoate ieo;t0t2toxr oydap nmnvsa() Dtmurpoo0olx  i3tat aDumnvon() eerif tytfpt anei;t0 etoxr3iy4alee iesatfa2ta( pnt4tptoio3tas sDrm( p (0 eeoiociadfpte ues;t) rtoio3iu4ap  licta( artr(m nt1tetomictasfs2emums;(0 ltrioctatoa eanvs;(0 ruo(opiy4ap  mivtl(faDrrx ono4tlxn oetysfsDua( snt0aetoio3io1lmD lnei t sexoxo3iu4lpeemiviasf rtmxrpot0oexoioctytfa elums t4 eenifctytlpDe nvo;t)seuoxm ou1am emncilsfarrmumpoo0tlt  ictasfs rmn pn()altnmo io1fp  ln ils0srtoxopiu1aleelict tfs2ua(mp;o4olxoioeiat sDrlump t0aetomf oa1fmDe u o t0 2xr(o no4lle  fvsas) 2tm(moot0alen ietlsfa rmumo;(0 renmf oodoateli s s0trtrirpoydom   fci t s2tr(r ;o4tet iieiydfa um(mo;u)alxoxocty1optrluvs s) 2triopiydoltelici s) ruaumono4apxoifciadfm elums u0 ltoirciotop  lnei;t0t2xoxm nydamt mivs t)aDtauro;t1opt ifciysfm2ra(vp;t4teenif ootoa  au ils)texrim nudlmt  fcslt)s2uaxmo;u0openmoctas s rluvs;t0aetrmfciytfm   n ol( srtmimpnu4ll nlieiat a2tm(  ;t0open ociydfm rmu p;t0 eerxfcto1fpD ln i t trxrxm3nodoptnlnetltfsrrr( oou1aeto feiysfs elu pn()aleoirctodop e i slt0 exmxm3iy4lp nlietl() rrmxronu4tptnmf3tlt a uanvo u4 etrio3tadfa eauvo s seurxo3oy1op   ivias  2trx  nt0aexnio3ils mDumumsnt0aexrxo3tatlp rlnvils)tetmiopnydoltelfvsa( sDtaum ;t1oetnmf3iytla rlnvsnt4tlxrxociadoptrluvi s tetmimpnydape  ietl( srtaur no0tpx  iciyt mDrm( s;(0trtnmf3ootom rauei;s0 2xrim3no1om nmnvi ()srrrurooo0tpeo feilt s elumpn(4aleoir3ia1lpDrln o;()seumim nu1al e nvsa( sDua(  nt1opxn fcils aDumu s;u)alxnmocoadfpD luvo t) 2trxr oy1lme mivt s)a2ua(mp;o0aetoif3iltla2uln p (0tetniociotoatraieslt  rxo(opio1om emiciatf Dtaum nu0optnmoeildlm2umn pn(4aeenxr3oydlp eaueilt)trumio nodal   nvias  Durxmo;u0oex if3iytls ul(vo;t)aexnmr iy1laDeli s (0texr(m ny4ame  ict s  rta(r nu0texo fcils s2em(vp;() etnir tadlptrli s;t  exm(r3ou4aptemfes ( sDua(ro;u4opxomictytlmDua(ms;(4arxoio3oy1oaDeln ols s2xrio iu1ol e netl(fsrtmxmo;o1tpxoiictlsls2ea(ms u)tlxomocta1lpDeaieils0 rxoxo3nydolenmivilt)s2rmxroou1oet  ieiadfm2umuvs;t)aexnio3oodfa raieils  ruoio3oo1al nmiesl(  Dua(r ;t4tltnioeiytfaDrmnms u)aeenmfciy
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;s)t2to(opiy1ol nlfesas  2ta(mpnu1oetomf3iyslmDul(mo;t)trxoir tatfpDrlivils)sexr(rpiydlpt  iei sfs2trx pno4oexomociltfs2ulumpnt)areomo totfpDeliei s  rtrirpiudomeelfvtatfaDrrumpno0tleoiociltfm rln s u) etnmo iytfpt  i ils) 2um(r3iydoltn fes t) Durxr ot0aex  ietlsls rauvs;t4arxoifcio1oa eli s;s sexo(opiu4opt lneiasf Drrxm ;o0apxnii3tld s2em( snt) ltnif ta1fptelues;( s2umxopno4lm   fviat artmurono4tetnmoctyd m em( on(4trtrxrcoadomtranei (0setr(o3ny4lpt  ici sf rrr(r oo0aptomoctyslsDrlnvs;t4 etrir3iytfmte ueslt setm(opiu4aptnmieslt)arumx o;o0ape mi3ilsfsDelu sn(0arenir3oodfp r nvi (0trtm(rpou1apeelfvsat)sDraurpnu1alt mi3tadla2rauvs t0trxrircty1lptrli il( setrxr io4omee nviltfaDtm(r ot0apxnmiciyt sDeln s u0 rtrxf ty1lm e ivs ()srumxm3nydol emnvslsf 2tm(rono0aleoifeiadlaDranvpnt4alxnir3iotlp  lnvo s0 rtrio iy4open fes tfs2uaxmo;t1alenio3iytfs2um(vo t4trtrif3oy1fm r nvi s s2xoim3io4ol elnetatf rrmur oo4olxoioeiydfaDelnmsn(4texrif oytom  luvs;s)s2xrxr3io1lltemnviasfsrtm(mp;o1altn oetatls eln p;u4 rxrxocoydomDeli o;t)teuoim3io1ll elfes ()sDuau  ;u1optoii3iyd a2rm( ont4teermr3iy1lm  lueol(0trtrimpio4al elfctas s2rr(r no0oee  ietldla2el(vp;t4areomoctodopD  nvi;( seumim3nudoptemnvsatfsrraurpoo1altoioetld aDum(vp;u4arerxr ia1lpD au o (  rur(r3io4amt mnei sf Dum(mono4optoifetytfs2ra(mo (0 ltnmr tytfpte uvs s0trtoxm nu4amtnliet (f 2umur oo4tleo fetldlaDelnvsnt)altniociadop eln i s0trurxo oodllenmnesat)aDtm(rp;o0texnmi3tytls ulumpnu0aexrxr oadomtr u il( seuo(o3iodopeelfet s s2tau pno4opt mfctytfsDulu sn()trxoxo3oytlpDrai s;s seumxm3ny4ole  ivil( sDtr(rpou4tlx ifctas s umumpnt0aexoif oydfpt aivs t)trxmir iydol  lieias s2rmxrp;u1aex mietadfmDea(vpnt)aexoxrctotla eluvi t  2xrim3nudlle  fesl()a2um(  ot1tlenmfeils m ulnvpn() eerio ootom   nes;s)texrimpno4alteliet t s2trxmpnt4opx iiciytlaDumn o;u4 lxnxfctydlate ivs ( srto(m3iy4am nmiesatfa2ur(monu4aptnifciyd mDean p;(4 lxoxfctydopDelnvsls) 2xmimpiy4omee ietls) Durx oou4olx io3tltlm2rluvp ()aexnio3oodoa eanes s0s2toxo3iy1op nlfvs ( aDtmuronu1aex ii3iasfmDrlu pnu) ltoif oodlmt lnes s  exmim iy4al n fes ( aDrrx o;o1olxoifciyt s uanms t) rtrmo3iatlmD au i;(0trxr(m3no4lleemfctat)sDrr(mp;u0aleniieiyt aDra(vsn()tlerxo ta1fpD lneolt)t2umxm oy1op n nvtl(fa2rr( onu4oltnio3iytfs rl(mpnu0alxnifcoydoaD au o s t2trxm iu1amtnmfvs tfaDurxront1altnmieiytlm2emuvp;t0tlxoiocoydlpD  nvo ()texmiopny1al elicia( a2ururpot1openii3tydla el(vonu0altrif ta1faD  n i s0srtmxr3ny4lm  mivtls)a2tmumo;t4tpxn oetad sDem(mo u0tetoxfcio1lpDrlu o;(0t2xoirpiy4al n fetls a2ra(r nt0optnmfciytfm2rln snu4 eenif iytoptr ivi s) 2xoim iu4lmt mncta(fsrta( ooo1tlxo fciatfm2emumonu0tleoxf to1fp e ues s trxmirpno4opeelfciat) Drr(r ot4tleoioctys a uln snt)tlenxr ta1la ean i (  rumxo3ou1lm emfvtat) rrm( p;o0altnmi3tyt a2rl(vs;u0teerxrcto1lp  au ilt0trtm(o3io4aptn ictas  rtaurp;u4opto icild aDrmnmpnu) rtomr3to1lmDr nes;( sexo(o iy1ap e fet t) rumxmp;o0tpx mfctatla2ua(mo;u0 ltrmo3ootomtr i ols)texmir3ny1ol e fei s)s2taxrp;u1oeenifeildlm em(ms u4altnxocty1fmDr ieo;t)trxr(m ou1om  lietas  Dum(moot1opx ii3ild mDem(vo u)aexomf3ootomD aiesl( trxoxm oo4ol n nciatf 2taxr ;u4tee mfctas mDeanmpnu4trxoxo iytfpt  nes;(0 rum(m iydaptnlfesat) Dtr(mp;t1alxoioeils a2umnms (4 lxrifctytom r u sls0 euoxr iy4omte ieia( sDrrxm ;u4alxnmi3iydla2uaums u4aeenxr3tatlaDrauvi;s) eurxr3oo1ame  fcsatfaDrmxm no1oleo oeilslaDran on(0trxomf ia1lmDrai s;s)t2umxo oo1am elieilt)aruaumpot1aeenmfciydfm2ra(vont4teeoir ia1fpt li s s) 2uoxr3oo1lpeelivsa(fs2tr( poo0apxn icils sDel(monu0 renxocoydlpDeauvils t2tmxo3iu1amenmicta(fsDtaumooo1olen ictldfa emu s;(4 rtoxrctydopt anvol(  2tmio3io1amt lfesltfsDtr(r ot4oexn i3ilsla2uaumpn(4arxnxociadoat  ieo;( srtoxr nu1optn ncs t aDtrum no4alto oeiytfs2eau s;t4 eenxo oy1om elneil( t2xoir3no4omenmnvtlsfsDtmumooo4ape  f3iydla umnvp u) rxnifciy1lpDe uvs;t0s2toxr3ou1al   nvtat  Drrxmonu1aptn fcils m rauvp u) rtrxr oy1la   nvi (0 2xmiopiodam  mivt t  ruaur ot4alxniieiasfa2ul(von()arerif todla  anes;s0srxo(mpnu1om n ncsl( a2raumpnt0opt  oeilt a2uauvs t0tltnxr3tytfatr nvsl(0s2xr(o3iu1alt mfeils)a2ta(ront1ole iieiytfa um(mo;u0 eeoxr3iydfmDraivi;s0srurxr3ou1ole mivtlsfsrum(moot0aleoio3tydfa eanvsn() ltrxfciy1fp eanvi;t)t2trxrpio1optnmfcsls  Dtrx o;o0aee  f3ilt a2rm(mo u4aeenxf todfa r neols)s2to(rpoydale lfvsat arrau pnt4oexomietytfaDrmnmp;(0 rerxr tadlate ues s)t2uoim3oo1lmeeliviatfa2uax p;o1texniieiltlsDuauvsn(4 rxrio3oodla eai sls0seumir3oudope livtatfs2uaxr nu1alx  ociyd mDel( snt) rtrxfcto1lmtrluei s0sexm(r nudlle mfvils srrrum ;o0tpxnmf3iadls el(vp;(4 rxrmr todoaDraieo;t0t2tr(o iu1amtemfesat)arta(roou1opxnif3iydls2rmums u)areoxocoy1laDelu ilt)trxrir iu4ap nlivi ( aDtm(rono4aeenii3tadlsDulu o u)altrifctatfmDeauvs s0srtr(m nodom elnvsas)sDururpot0tltnio3ild aDean s () ltoxr3oadom   nei;()s2xrxopio4oleelnvt () Dtruroou1aet ioetasla rmnvo t) ltnxo totfp r uvil(  2toim3io1ame mictl(faDrru o;t0tlenmiciltla umnmo;u4 rxomf3iatlpD  nvsls)trxo(m nu4amt lnesat  2uax oou1apxn fetad a2rm(vsn() rtoiocty1om r u ols)srtm(rpnu4lm nlfvs ( srtau pnt1teenioeiatlm2umuvo t4artniociy1oaD lieils0 eumim3nydlptnlfesls sDrmum ;o4tee  o3tldfa2ean ont0 etnmfciy1la e nes (0 exo(m oo4am   nes t) 2rrur nu1alxnmicilt a ea( p u4 ltoir3ta1lmD auvilt) etoimpoudal n fvi sfa2umumoou4apt mfeiydfa2uan o;t4 ltomf iy1lmDrlu ols  2toxopnodole lneias)aDumxro;u4oexn oeiltfmDulump;()altrmr tatomDe nvs;(0s2xo(o iudomtn ncsa(f rrmur oo0tptn f3iydfs eln o ()aexoxo oodoa eln o t)srum(o3iu1lmt  fes t)sDtm( o;o1tlxomoetat s2ua(vsn()teenifciy1lmtrlnvs (0s2xr(m3ny1ol nmfei s  2uau poo0aetoiictltlmDel( o u4 leoio ia1lpteaies;s0teurxo3io1alenlfetlt) rtmumooo1tetomo3iatfs2ulu pnt4tleoxf iatomDrlnes t)srum(r3nydame lict s)s2rrxm ou4tlxn f3tys s2eanvo;(4aleomf iy1lm eanei;()t2to(o3iydom   ivslsfs2tr( o;t0oet  i3iys mDeln s (4aeeoio totlaDrluvi t  rtr(r ny4ol elfvtatfsDta(rp;u1ale mictytla ulums () ltrmo3todfatr uesl() 2urxm nydalt mnvt tf rumu pot1tpenmiciasfs emnvs;t0trtoxfcto1lmDrlies s)t2xmxrpiodome livi tf rrmur ou1opt mfcilsls ra( pnu) eeoxr3oydoaD  uvol(0trtmxm3no4ome  ieta(f 2rau  nt4tpxnmoeiytfa el(vs u)altomrctadlp ran o;( srto(opoy1amt  fcs s)srrmxm no4tlxn fctlsfm2rm(vo;t) rtrmocoytlpD  ues s) exrirpiu4lmtnlfcs t)srrr(rpou1oetoiieils m2umnvs (0 rxrio iadfptr u s s s2umimpno4ole  fes s) 2tmur ot0tlx iicils m emn o u0 rtomo iodfatean ilt t2tmimpoudamt lieil(fa2uax poo1ole moeildfa el(msnt) ltrir3oo1faDelivo;(0 etrio3no4am emiesl(f rtrumpoo4teenifctltfsDuluvs;t0 etoxoctadfatr nvsls) ruoxmpiu1op  miei sfa2urumpno1oex  fcias a uanvont0altoio tydlmD aues s)t2xmim3no4altnlnct t) Dtmxrpnt4ale mf3iat a2um(vp u) lxnxfcty1fmt au ilt  rtoxmpio4ope  ivi ( s2ua(rpot4tpxomo3tls m2rmuvpn() ltnio3io1fm e i o;s tetmirpoo1llenmfctl(fs2ra( pno1tetnio3iyt s2eln pn(0trxoxf iadlm r u ol(  rurxm3ny1ale mivs (  rtrx ooo0tlxoifciytfm uan s;()aetnxo3tytlaDe n s;()trxr(m no1amtelivt ()aruaxr ;t4aex  ociadfa uan o u)tetrirciotfmD  uvs t) 2xmxrpnodlp n ivi s)srtax oou0olx mi3iat s2ua(vo t)trenxocoadlpD  ivi;s0texr(mpoudopt lici sfsrrmumoot1alt mieiytlm rmnvp;t4altrxoctodomDrauvil() exoxopio4ll   net ( aDrmxmoou1tptnio3ilsfaDulu p t4 rtoio3iy1fmt  nvo;() exrxr3oodale mfei (fsDtrx pnt4tlx  o3tytfm emnvo t)aexomfciatoaDr ivolt truoim no4ll   feias sDra(rooo1tle mi3tyslmDem(ms;()tetomrcta1lmt  neils)seto(r3nodalt mncia(fsrtmu pno0tee iocilt s um(msn()trxnxocoo1faD  iei ( trurio3nydomen fvsas)arrax oot0ole iieiasla uan o;t4 lenxo iotom r nes;s  exoim3iy4olen fctas)arrrum oo0apx ioctytfs2eau s (0treoir ty1omDeaieilt0 2toio nu4oltelnvs s  2tr(  nt4opt ifciatls umuvs;()alxoxo totoatr i slt sexrirpoo1omeemfcs t) Drau p;o4tleo ictldfs2umnmont4 exoxo3tadlaDr u o t  2uo(mpny1ole  fctl(f 2rmxro;t0olxnmocild s2ul(vsnt0 reoxf oytfptranvslt0t2uoimpno1ol nmncia()sDuaur ou4alxomoctat sDelumsn(0 leoxo3oy1lpte nvil()tetrxr oo1ameemfctl( srurxm nu0apenmoeild sDrlumo;(4aleoxr iydlpt aivsls0trxr(r nodop e ncsat srtmurpnt4alxo feilt mDea(von(4arxomrcoadoptelivslt trto(o oo1lpe lncsl() ruauro;t1olxn ocildlmDua( p;u) eerir oo1fa rai o;t) rurio3oodll e ivs sf Dumx pou4apx ioctadfs eauvs u0arxoifctotlmteaivs;s0t2tm(r3nodlm  lfcsa(f 2ur(r ot1apxn i3tasfm umn o;()aetrio tatfa  aieo;t)t2tmxr iy1llee fvt s)srtax o;o1altomfctasla rmnmpnu4 ltoircia1lp elu slt trxoimpio1opte nvsatf 2rrx oot0tpeomo3iyd mDuaump;(4aeeomr3oo1lp ean ils0 2trio3nu1ame lfcsa()s2tmxrpot0opt iociydfaDea(vp;u) exoio3oa1lp rauei s s2um(rpou1omte nesa(fsDrm(m nt4apto iciytfs2eanms;t0 etoxfctydomD li o;(0seto(m oodop n fetl(fs2um(m ;o4tleoio3iat m um( pn(0teerifcoa1fat auvo;t)trur(rpno1lm nlfciatfa2urxm ;t1tee  fctls m2umu ont4altnxo oydlp  lues ( setm(mpiydame mivt s)s2tr(mont0aetnmfciyt mDumnvpn(0tetomr3ty1omDranvs;(  rxr(mpoy1olt mivt tfsruaxmpno4texnmfciasfmDeluvs t) ltnir ootlmD lu s s  eurim oudop   ieiasfaDrmxm ;o4oexoiietltls2um( on(0 lxomr ootomDe n s ()teumio no4op n nvtl(  2tmumont1olx ioeiltfa umn p;u4tltnmr oo1omD  i o;s sexrxo oudamt  ietlt) 2urumono1altoifctas s rmnmp u0 exoio tatoa  aieolt s2to(mpiudap  mnesl()sDrrxmp;u1tetnifciysfm2em( o;u)alxrio3iy1fmDrlivo s t2ur(rpoudape lfct s)a2tmx pnt1apxnmo3ias mDrmuvon(0tetoif3oa1fpte ivi ()s2xo(r3ny4am   ivsl( sDumxr ou4olxo f3ilsfsDulu o () exomo3iotfp eau sls0 euoio3oy4alenmivsas)aDua(m ;o4oex mf3ildfs2ra(ms;t) exrxo iodfmD  n i;s) rtr(r iu4al   neils a2raur ;o0ale iociasls2rm(mpnt4 lermrcoytoa eai o s)setm(r oo4ll nlfei (farum(mp;t1tpen oetasfs2rmn pn(0trxrircia1fp r nesl(0 2toir3no1lltn ivsatf rtm(rpnt0oexo ieiltla elu o;t)aeeomocoy1lmD ai s;s0 2to(r3iudopt  fvs ( s2tax pnu1tlxnmo3tadla um( o;u)texnmf to1opD  u i;t)s2urir3ny1lmenmnct s)a2rmxm oo1openifeiytfa rmums;u)altomocty1lmDe ivols) rtoxrpnydolt mnvi tf Durur ;t1oetn oetyt m um(ms (0arxoio iy1fm  au i t t2urim3nu1al nlncsl() 2ta(r ;o0oeeoioetltfs2rln on()artrmf oydfpDr n i t) 2umimpiy4omtemfes sfaDumur oo4tetnmieilslm2eln o t)altrmr iotfp   neo (0 eur(r ou4amt  nesatfsDraum ;o0tee  ocilt m2umu pn() ltrxo3iatla rln o t  2triopnu4aptnmncslt srtrxrpoo1opt  feildlm rm( sn(4trenmo totomtrliesl() 2tr(m3iu1llte ncsls)arum(r oo1texoifeiyt sDumnmp;t4 ltnio3oatomD  n i;t)setoio nodopeelnvsa(f Dumumo;u0tpxo f3ild a2ua( o;(0 ltoifciytoat  ieo (0 rum(mpnu4aleelnvta()artru  ot0tltn o3iytfs2uaumon(4 lxrif iydom   ues;t)s2trimpoydope lnci sfs2urur nu0apt ii3iatlmDuan snu)artomr ootfpte ueo;( trxrim3io4aleemieias aDrm(  oo1apenmf3tyt s2umn s;u) lxnxfcoa1oa rai o;t)s2ur(r iydomt lnvi ( sDuax ont1teeoif3ilt sDum(vp u)tetnxrctytfm r ivilt) 2tr(o no4ape lnvsls  rururo;t1tee  i3tat m2uauvpnt)alxrirctotfa   nvol(0 exrir iodom   ivilt)a2um(m oo4texnmf3iyt m em(mp;(4aeermrctadfpte nvslt texoxo nu1oltelncslt)aDum(rono1tlenmf3iadfm eau snu)altomo ia1laDrli s;()s2xoimpiydol nmnes s a2rmuront4teen feiyt mDul( o t0 exoxo oytopDeaies;s0 rtoxo3ou1omtnlicias)s2rmu  nu1altoiicilslaDrlums;t4tltrio3iydfm  anvi s) exrxopiy1lmeelneia()s2umum nt4tleoiiciysfmDua(ms;t4 rxnmf3iatoaDe nvi t) ruoimpou4lptnlnciat a2umum nu4aetoiiciadfm2ean p;u)aetrxr oydlaD  n s (0sexoxo ou4llenmivs s  rua(root1tptn i3tyd m2um( s;t4tlxomr3iadfp eanvi;s srtoxmpou1alt  fvsa(  Duaumono0texoiocildfs eanvp t4areoif3oo1lmD an s s0 2toxo3iu1oleelfcia() 2tr(rp;t4tpeo f3tls a2uln onu0artrmo3iytfatrluvols  etrxr3oo4ol   ncta(  2trxmoou4aex mi3tls mDumnvo u) etrmr todomD lnvs;t t2xoio3oudopt mici t arra(m oo1opeomf3iasfa2el( sn(4aetnmoctadla elnes t0 rxm(rpnodll   fcsasf rua(r ;o4tpxomfctlt aDuanvsnt0arermf3oa1lp rlnei t0t2um(r oydapt  icsl()a2rax p;o4aleo fciysfm ulnmp t4aleomf3oytlate i o;t teuoir nudam nlictlt s2tau  nu4openmo3iyd a2ran p t0aeeoifcta1lmt  n olt)texr(mpoy1lp nlieia( artrur ;t0opxnmociyd aDrmnvp;()alxrxo iy1fmD luvs;t)srxrxr3iu1op   fcsa()arua(ro;t0olt miciat m2rl( pnt0alxnxo3oadlptr neo s)trxoxr nudoptn netl( arrm(mpno4texn fetltlm eauvp;(4 lerxr iytoaDr nvs s)setmio ny1amtnlfctlt s2ra( ooo1aleoii3tytfaDrmu s u0trxoiocoodlmDr uvo;s)t2to(opoy4ol nmnvi sfsDuaurp;t0aexo o3tytla2ranvs;(4arermocoo1lmtrauvs;t0 rurxrpoy4lmtnmnesas)srtr( onu1oeeomi3ilslm rauvpnt0tetoirctotoaD  nvol( teuoxm3io4alt mietas a2tr(mp;t4tex mfctlsfs rln snu4aetrxr3todfptelivsls) 2toim nydlpte ncs sfa2ururpno1aee iieilt s2rluvsn(0 rtomocto1omDe u o;s t2uo(rpno4ll nmics t a2ur(m nt4oexnio3iydfa2ranmsnt)trtrir iotla rlieilt) ruo(m oydlm nmiviatfsDuru  ;o0ope ioeiysfa2ulnms u4 eenxf3oy1faDelnei;()teuoxo iudlme mneil(f 2ra( p;t0aexomoeiltfsDrln p;u0aeenxf3totfaD au o;()t2xmxr3nu1alt  fvsl( artrxro;o0openif3ias s rlu o;u) exomf3iodfptraues ()setmxmpoy4al   ncilt) rumx  no4tee mfetys a2emums;t) rermr ty1laDe u i (  2uoxr3oudlmen neta(fsDtmu ono0olto o3iysls emnvs;t4alxoio3oytfmtrai o;t) 2trio3iu4olt lnvtlt) Drr( o;t4tpenio3tldfs2rmump (0alxrxr oatlp  ai slt setmim3iu1lpen nei s s2taxmp;u4alxnmo3iysls uauvo (0aeerif3ty1oa   i ils)srxm(o ou1omt  ivt tf ruaumpnu1texn f3tlt m umu o t4teenxr3tytoa eaivi;( sruoimpnu1lm nliesas) ruaum ;u1aeto ieiasfaDulumpnu0aetrmfciadfpDeaivilt teumir3nu4ale mies t) 2umxro;t0alt io3iadla ul(mp;t0 eeoxrcty1fmDe nvs (0 euoxmpny1lltn icil(farururpot1opto i3ilsfa ulumsnu)alxrmf3io1fp rlies s)s2urxm ny4ap  lfctl(  Dtr(r no0apeo ictls a umnvs t0tetrirciy1faDr ieo;() 2tmxm nudalt  fvta( a2rrxmpnu1tetnmfeiydlaDra(mont0trxnmr ootoate n ils0 exmirpiodlpt mfei tf ruaum ot1oex  o3iadfa2em( snt)tlxnmf totopDr ieol() exm(m3iodlmte fesatf Dum(  nu0altomi3iyt sDul(vsnu)aeerif3oatomtrlu i;t)t2toxm3oodalt  ivsatfa2tmumoou4oltnmiciydls ul(ms (4 lxriocoa1op ean o t) rxrxrpiy4al nlncsls  Dur(  ;o1apx  fciysla2rlumo (4aeenifcoo1fmDe nvs (0s2xmimpnodamtnlietl( aDra(m oo1tpx mo3ild aDumu o (0arxoxo3ty1om rli o;()sexoxr oy1alenmiet sfarrmx  ;u1texnii3ilt aDel(mpnt0aexoiociodlpDeai i t) 2xm(mpoo4op elnvta(  Dtrump;u0altoii3iytfmDeanvonu0 lenir iydlmtrlu sl( srtm(r3nydop  mnet (  2ta(mo;u0optoioeilt a2uln s (4tltnxfciy1fmDr uvs ( t2xmxo3ou4lm   nvils)arra(rpot0olxn oeiaslm2eln p t4tlermo3tatopD ai ils0srxoxm oy1aleelfesa(faDtru poo0texomf3tls a2ulnmo;()artrxr ia1lmt  ivolt0 rxmxr oo1lmtnlnet ()srtr(mpou0aexnifeilsls2ranvsnt4tlxoiocoatoatran o;( srur(opou4alt  fcsat) 2rau p;u1apxoii3tlsls ulu s;u) ltrif tatlmDrln i ()t2tmimpoodam n ncsls) 2tr(rpoo1tlxo f3ildlmDemnvs ()alenmo3iytfa elueslt)s2uoxm3nodal  livia(fsruaxmoou0altnif3ilt aDeanvon()altoxf oa1la raivi;t sexoxrpou4lptemivil( s2uax o;o1tpen ociyslm rm(mpn(4tltnmr iatlpDe nei;s0trxm(o iodomenmictls srta(r oo1ape  i3iadfmDra(vo;(0 etnmr iytoa rauvilt0t2umim oydom  mfct tfaDtrx p;t0tpt  fcilsfmDrlu p u0 lxnif3todfm   n o;()t2um(mpiy1lm elivs s srrmu  no4apx  feiyt aDeanvsnt4trtoio3oatlmD li o;t t2uoxrpio1opeelfciat)sDrmx o;u0altnmieiad sDrm( p (4alerircoydlatrauei ( s2urio3no4lle lictas)srrm( p;u1tptoii3iyslm2el( o u4tleoxf oa1fpD lieols0s2um(o oy4ap elieias aDta(m oo4opxniietyd m uaumsnt) eeoiocio1oaDe iesls trxrir ny4openmfci s  rta(  ot4alxnifeiatfm2uaums u0tlxnxo iotoat aiei t texm(m ou4amt mfcsa(  Dtau  no0tpto ociltfaDemu pnu4aetnmocoadfpD  nei;t0t2uoiopnodlmtemictat)a2tau  no0texnmo3iatfmDrlu o;(4 ltoiocoa1oatrlivolt) rxm(rpnodlleelieilt  Dtrxroot4tlxomoctad m2ean s u4 exrmf ootlatran sl(0s2xrxmpiydapee neiat) 2rmur ;o0aetnmfeias m ra(vo;()tlenmociotfa  au s;t s2uoim iy4lltelfvi (fsrrau pnt1aeeo fciadlm ul(vo;u)artrxo3iydlpt lneolt)t2umio iodamte fciasfsrtmum ou0ape if3iyslm uanmo u) rtnxoctadom rluvs s0trxmxmpio4lmtelict ( s2umump;u4apeoio3iydlaDel(ms (4trenmoctydoa eaivols texo(opny1llte feta()a2ra(rp;u4olxo feiyd a2el(mo u4aexomocoy1lmDe n i s)seumim io1ap nmnvi (f Dumur oo0apxnioetldlsDrln sn(4tlxomo oy1omDrln o;(0 rur(m oo4om  mietl(f 2ua(moou1tptoii3iatla2ul(ms;u)arxrxfciy1fmtrlneol(  eumxmpny4alee fvtlsf Dua(mooo4aet mfeilsls2rmumpn() leoxocoytfp r neo;s) 2triopnu4lp n iei sfs2uau oou4oltoifeilsfs2uln onu) eermr totfm   ueo ()s2xoxrpio4omen fvsl()aDrm( poo1olen ieilslm2umump;(4aetnmociytoat aiesl()s2xoxopny1op  mfesa(faDtrxmp;o4aex  f3tlsfaDeaumonu) lxoifctydlaDeanvi t0texoxr3ny1apeemfvia( arta( onu1opeoioeiytfa2rln s;t4alxnxo tytfatrliei;t  etrir nudlltemfvtls sDtaxr nu0texoii3ils mDum(vonu4tetnxr3oa1omteaies ()tetoio io4al  micil()a2uaxront4opx mi3ilsla2uaums u0 lxnif3ootoaDrln i (  2uoxr3no1lptelneta() 2ua(r ;t4aexn i3ilt s uln pnu)tlxrmr3todlpte u i;t t2to(o iudape  fet ( srtm(  nt4tleomieias sDuanms u)aetomfcootlptrluvo (0texr(r3no4altnlieslsfarra(rooo4oetn f3iydls ranvo u)alxnmr iotlmDr uei (  rumxrpny4lmt  nes sfartax oou4olt ifeiad m2elu o;t)aetrmr3ia1fm   ueolt0t2urim io4omte fcta(f 2uaumo;t4tpx micias a2eaumsnu) rerxf3tytomDe n i s)tetrxo nu1omt  fctl(fa2taxm oo1aetnmf3tldfa2umnvonu0 rtrmf oo1om eaivo;() rumiopoydlm n ietl()srtaxro;t1apx  i3tld a eau p u)alxrmo3iotlptrlu ol(0 2trxm no1ol nmieilt a2tauro;o1aleo ieiatfmDemump u4arxnxr3iy1opt lneols s2to(m3nu1apenlictlsf 2trxrooo1optomf3iatfs2ua(monu0 renxociy1opte ueil(0srumim nu4lle mncs s arrr(r oo4olx miciaslaDua(msnu)trxnmf3oydfa ranei;( t2xrxm3ou1ap  mncslsfaDuax onu0apx ioeildlmDuau s u0alxrmr oy1op raivs;(0texr(o oy4lm  mnei s  2tr(  ;u1tpeoioctlsla2rmnvs t4 etomo3oytom   uvslt) euo(mpnu1ll e fci t  rumx  ot4tpxnii3tlslaDrm( o;t)arenmf totom rluvslt)trtoxm3io4oleelnci tfarrmu oot4tetomfeiysfs2elu pn()treoir3oy1faDelnvsls setrxopou1lmenlfvta(  Dra(rp;t1oet iietaslmDum(vsn(4 eenio iotfm raues () eumxopiy4opee nvi tfaDrr( pnt0apx ifciatfmDrlu s (0aetomf iotla ran i t0t2tr(r iudoleelivs t)artrx  no4opt  f3tytfs uan s;u0trxrmo iodla r nvolt)srxmxmpoo4llen fct t)a2trurpnt1opx moeilt a2ulu s u)trtoif io1fpte n o;s  euoxm nu1om emfesl(  Dtrur ou0aex  fcilsfaDrm(mp t0 ltrxocoytfpDraivi;(0s2urxr iy4amtn iesltfsDumur ot4aet miciytfa2rmumo u0aeerio3iadoa  aues;s0trur(rpoy1altn ncta() 2taurpnu0aexo i3iydlsDeanmsn(0tetnxo oatlp  an s s)teumxr3no4ll elivia(farrm(r ;o1oeeomfcilt s rl(vsnt)alxnmo3tatoatelu ilt0srumim nu4amtnlncias)aDur(mpot0altnmoeildlmDumnvsn(0 lxomf oatlmtrlivi;(0s2xoir iy4lp  lncsas)srumu o;o4texniocildfmDua(mp t0 ltrxociadlpte ieo;s tetriopno4apeelfetls)s2ra( pnu0altnmfeilsfs2rln pn(0tlenxo3ty1oa  aivsl( trxm(r ou4ll  livslt)sDumxroot4oexnmietat aDea( snu4 lxnio ootlaD lneo;s0 etm(m3nudlmtn nvtl(farrr(rpoo0oee ioctldla rmu o;()trtrmfciodfmD ln s;t) etrxr ou1altnlfet ()s2tmx p;o4aexo fciltfaDrl(monu0 eenxrctotopDrau sls  exo(m oy1al  mfvt s s2rmum nt4optoiicildlsDrm(mo t)areomfcoytoptelu o s)t2urxr3iu1ome lfvtas)s2umx  oo4ale if3iad sDrmu ont0teeomr3ta1oa eanes;t) 2xrxopou1lpt mnctl(fs2rau ooo4alx io3tydfaDeau o ()areoxo oytfpteanes;s0trtmirpoo4apee ictat)a2uaxmpnt4opxomo3tldla2um(vo;t)texnxrctydopDrauvols0 2xm(r3oodllenlfcsa(fa2rr(r ot0openmfeiltfs rmnvs u)tlxoiociytoaDr i o;(0s2umir nu1om  lnvslt)artmx  no4opxomfetldfs2rmu p;u0tetoif3iatla rli i t)teumxopiudomenlfcsls artmxroou0altnmfcildfa ul(msnt0 lxniociytfpDe n i;(0 exmxr iy4am  lfciat) 2rrxrono4aexoifeilsla rlums t0 rxnmf ootfa  lnei s) 2ur(mpiu1ope lfvt () rra(rono4tptoiictyslm rau p;u)treomo totfp e n s;t) ruo(mpoy1llt  nvia(  Drmu  ;u1texo f3iys m uaumsn() rxomf oydlptrau ilt s2xrxm iu4al   icias sruaumo;u0aexnio3iyd m umu s u)trxomo3oydla rlu s;t  rtrxmpoodlltn fet s a2taxmont4altnif3iyslmDrmnmp;u)aeerifciatlaDelnvs s0trum(mpoo1ome mies (faDum( pot1texnioetad m elumpn() eenxrcoatoa r ieilt) 2ur(mpoodomt  neias  rrrur no1tpe mo3iydfs2el(mont4teermo3iodfp   ivol(  rxmxopnu1ll   nvils  rrm( p;u0tlenmo3tldfs umu o u) rermr3iodomD an o (0 etoiopnu4apeemivi ( a2umumooo0tlxo f3iasfm2rl( snu)aexomrcoatlpt lnvols0trtrxr nodap e nvsl( s2umur ot1olenifeiyslsDumump t0 renxrciytopt aivi (0srxoxm no1lpte ivsas s2tmu  ot4tltomietlsfa uaums (4altrxr3tadfptrlnvo;t)teurxopoo4ale lnct t  ruaump;o0olxomiciad sDel( o t0trtnif oodlmDrlivil() 2xo(m3iydlm  mfcil( a2raumooo1alenmicildls ea(mo u0altnxo3ia1laD au o;s sexmio nu4lmee neia( aDur(rpou1ale if3iaslsDelnmp;t)artrxr iadlaDran s;t) rtmxmpoydape mneiasfaDuaxmooo0tpxn fctltfs ea(ms (4altrirciytfptraivo;(0tetmimpoy4olt  neiat) Durx  ot4aexomfctat sDrmumsnt4trtoir3todlaD anvol(0 rxrxrpoydlmtelfctltfarrr(monu1opeoiictys m2eanvo;(0 rxrio tytomDrauvils0trxrio nydamtemfcil() 2taxr ou4tltoioetld aDul( s;t0arxoif3to1opt lieolt  rtoxopou4ll  mfct t  Drrx oot1oetn f3iys s ran o;(4 eeoiociadfmt ln sls)trtoxo io4llenmfvi t)artm(rpoo4oetn fciys m ranvo;t4areomf oytfa rliesls teur(o nodlm   fvi t s2umxrooo1ale if3iltfm2emn p;u)texoxf3ty1fpt  ues;(0tetoir io4om   nvils s2taxmoot4tleoiietlt sDrlnmp (0alxomr to1fa elnvi;( s2um(opnu4olenlnctl(  2ua( oou0oetomietlt mDrm(vo ()alxrif to1optelneo;s  2trir3io4omte ictasf 2umx ono4opxnmi3tatlsDrluvont0 rxnxoctytoa r u o;s)setmir3oy1altelivs () rraumoot1aeenmfeiltfaDrmums;t) ltrioctodlm  aueilt0 2ur(m3iu4aptemict t)srraxr ou0tex mo3iadfm ra(vs (0altrmf3iadfmD ai il()setrxo3no1omen nvslt)sDrm(mp;u0opt  f3iyd a em(msnt)trxoiocto1omDelu i () 2xrxrpou4lp   ictlt)sDtrxmonu4altnmf3tysfmDum(mpnt) renmocoytfm  auvi;t) rxoxo3iudlme  feiasfs2trx o;u0tle moeiat sDumn o (0aeermfcoytfate u ils)t2xo(m3nu1lpen net (fsrur(mpot0olen f3iys s el( pnt) exrxociotfa  aies;()seuoxr3nudlp emnct t) rtmxr no0tee mictltfm uanms;() lenmfcto1lp eaneils)srxoxo3oy1optnmivil(f rumurpnt4tleoifetad m eanms;t4aexnxf iytoa r ivs;t) 2toiopoy1al  mnvtl(  rrrx  oo4olxo oetydlm2rlu p (4 exnif oy1lmtr ivs s)t2toir3io4lpe mnetlt srtruro;o1aeto fetasfsDrl(vo t) rerxf iadopDrau s;s0 rxoxopiu1lp  lnvtl(fsDrauro;u1tlx  o3iyt mDeluvo;t4 eeomrcoa1fmDr u ol( setr(rpiydam  liesasfa2umxmoou0tetnmo3tld s2rlu p;(4 leomf ty1lptelu sl()sexr(m oudame mncia()s2urumono4tlxo ocilt mDua( snt) rtoircoydfptelu s;s0srtrimpio1lpee ivtlt)s2raurp;t0oltoioetatfa ulnmp t) ltnir3iodfaD  ivi;t0srxoxmpnu4llen fct s srraxm ou1tlxnioetlslaDuln snu0texrircoatfmDeluei;t  rxrim oo1lme mfcsls)
\ No newline at end of file
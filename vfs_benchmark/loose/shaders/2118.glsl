@@ -0,0 +1 @@
+ivi ( srxoxrpoudope mivsasfsDtmur ;t1olxnmociydlm2rlnvo () lxoircto1fmt  nvo;(0truoio oodaleemies t)s2raxmono4apt  oeiadlmDrmn onu4arxrmfcia1lmt lnei;t trxoxopiydlle  nes t aDrru poo1tpe micils a rmu p u)tltnmr io1oa rlivo t0trxrxopoy4lp nmics (f 2urxr ou1tpe mi3tasfsDumu on(4 exnmf3oatfaDeau s ()srto(o oodaptelivil(farrm( pot1tpto ieild a2uan snt0tltnmf tadoaD  ivolt texr(o3no4amtnmietl(  Dta(root0aee iicildlaDrluvs;t)artomrcoatla  lu i t0 rtr(o oydlleemfcs t artm( p;t4aptoiietltfmDumnvsnt) exomf ootlatrlivslt  rxo(r ou4ap e fvtat  rtr( poo4tet mictlslm2emums t4 eeomo3totfa e i i s)s2tmxm oo1ll emnetat)sDtaumonu4tpe mf3tysfs emnvs;t)arxrxfcoadfmD au o;s)texrir3no1op   fvs sfaDumur nu4optoifetyd a2emn snu)tlerxrctydfmDrau sl() exmxm io1amtemfcslt arrmu  nt0alt mf3iaslm2ra( p t4tltnmr tytla eln i;(0 exr(r3iodlmt mfes t s2rrum ;o0olt mfeild aDrlu sn(4tetnmfcoydoa e ieilt)trtoim iydomte iesas)arururo;o1oexn octydlmDemu snu) ltnif3oatfatelnvslt0setmimpoy4opteliet (fsrtaumono1ope ifctyslsDrauvo;u0altrifcto1lptranvols trumio nu4lm elncia( a2trxm ;t1opt if3iltfa em(mont0artrxr3iotlpteli sl() rurir3io4ameeliciat) ruax pot4tpxomfctydfs2rmu p;()aetoxr3oatop rlnes;t0 rxm(mpiodam n fvta(f Dtax  ;u4tlxo feiadfm em(mpnu)alerir oytfmtr ieilt)trto(mpoy4lpe mneta(  Dtaum nu4oltnifcilsla um(mo (0tltriocoydomD aneo;t) rxmirpiy1amtemiei t)aDumu  nu0oltn f3ild a2el(mp;t0trenxfciatoaDrliei t0srurxo nudapt  nct (farrrxrpot1aet moeilslmDrluvont0 lxoirciatlmDe neolt)setmxo3no4altemfcsat  Drax pnu1alx  oeiatls2emnvo;u0artomf3ty1lmDr uei;s srxr(opnudal nmivs sf Durur ;t4altniociltfa2elu sn() reoif3ta1lpD lu s t setr(r iy4ll nlnvi t)sDur( pou0oetomfeiyd sDelnmsn()aleomo iatfp rln s (  etrir no1alt lnesas) rtrxrpoo0tpeo ictad aDrmums ()trxnxf3to1lpD  i s;s) 2xoio iy1omen nvsa()sDrrurono0tex iietls m2umu o;t0 rtrmr3iy1omteluei;t0s2tr(o3iy1am nlieil()arrr(mpno0oetoif3iad a2ra(vp t4alermo oydomDr i i;(  2xrir3oo1ope lneiltf 2tax p;o0aetoiiciys aDum( pn(4 lxnxocootfatr ivi t t2um(o iy1omtnmieilsf 2tru oou0ole iietydlmDelumonu) lxnxr iotfaD  ivols0sexm(m3io1alt mict t) 2rrum nt4tlenif3iyt s2el(vsn(4aleoxrciadfp r ivilt0s2tm(mpiy4omt mfci ()srtm( p;u1opt ii3iasls2rmumpn(0trtoxr tytfpDe nvs () rurirpny4llenmneil( srum(  ot4alxnmi3tyt s uan o t)arxrxo todfate n ils)texm(r oydal emivt t  rurxmpou0aptomieiat m2emuvp;u)tltomrcta1omt lnes s0trtoxo io4om   ivta( s2tru  ;o4alt  f3iltfmDuluvpnt0aleoxr3oy1lm rauvil(0 exoiopny4ll   nci sf Dtmxrpot1tpt ioetyslaDumu s t)tlxnmf tytomteaivsl()texr(o3ou1ame mics (  2tau pot0tptomfeiat s rauvp;u4alerxfcio1oa elivs;s)texmxo3oy1olee nvsat sDrmur nt0oltn oeiydlaDulnms (4trxoio iytlptr nvo s) etmxrpiudom elncils srta(m nt1aeeo icilsls ua( p u4trtomf3ootla r i o;() 2ur(m ny1lltnliei s srurur nu4optoii3tydfm elnvo u4 leomf3oy1omDrau i (0s2tmim ny4lmee fvtl()s2rm(r ou4opt moctytfm rm( o;(4alxomf iadopteaieo t) 2toiopnudomtn neia(farraxroot4aee iietydfmDumumpn(0 eerirctytfa  au o s0 2xmxr3oo1llee iei s)arrrurpnt0oeeo octldfa ea(vsnt)aeeoio3todom   nvols)t2umimpoy1apt  ieilsf Durx oot0ole ifeiysls2rlump;t)alxomo iy1omD  i i t  2xrxo3oy4lleelnci tf Dtr(ro;t1opt io3iat s eanvo t0tltomrcoydfa  ai ilt srxrim iy1llt  ivias)srra(r nu0openioetlt aDran pnu0tetnmr3iotfp   ivi s s2ur(rpnydlpt livs tfsDurumo;u4olt ioetyd m2rl(vsn(0 etomrciytfa eanesls0s2uoxm3oydapenlnes ()aDtau pot1apeo oeias m rmnvs (4arxoif3iadlpte uvo;t trtoio3iy4amtn ieils  2trurono4teeoifeils m2rl( p t) ltoifciodlptraneols  etmio no1opte ieslt s2tmxmonu1olxomfctysla2ul(vpnu)tlxoxf3oadlpD aues (0setmxo3nu4oltn nvta( artr(rpno4altnmiciyd a eau s;()altoxfcia1om  aieils t2tm(r io4alee ivs () 2um(m ;o0oet  fetadfs ea( pnt4tetoxo iatfm e ies ( s2trim ou1amtnmivi ( aDua(mpou4tet ifeiys aDraums;t0altrmr3tydfmt  nei;( srurxopiu4opte ieilsfartmxmoot1teeoiociytfa ulu p u0tleoircoytfa elueo t srxmiopny4aleemnesl() rtm( ont4oetnifetasfaDumnvp t)teerxrcto1opt aivs t trtmxr iu1aleemnvtl( aDrr( o;t4aeenmoetlt m ra( snu)aeermf oatlp raivo;(0 eto(o oudolt lncta() rua(rooo4tptomi3iysla ea(ms u) exnmo3oy1la  auvolt0teum(m3nu4lmeemnctas) rra(root0altoii3iysfs el( snu0 reniocty1op eanvslt  rxmirpou4om elivt ()sDtmxroot0tlxnmf3tlsfsDelnvp;t0 lxrmociodfaDeaieo t srxo(r iy4olt  ncsat aDta(m ot0aee if3tyt m2rm(vonu4texoio3oodlp r ivs () rumio ou1lm e nvils)a2rru  nu0altnmoetyt sDeanvp;t0teenxo oy1oa e uvsl()setmxrpoy4ape mfviat  2rrxroou0opx moetlsfaDrlu pnu4aexrxfctadla e uvo;( s2xmio nodllen neil(  Dum(  ou4tpe  feiltfm2rau pnu) etnmoctydop e uvs;()s2xmxm iydlmtnmics () 2tm(mpno4tlenmoctytfa2ulu p;t) lxoio iytfateaivil() 2trir3oodal emncsl( a2tmxronu1texniieiyd m2em( p t) etnif tydop rau s s0teumirpnydom emnet (  2raurpnt1aeeo f3tydfm umnmp ()artomf3iotfateaneil( srxm(opnodllte ici t) 2rm( pnu4oleoiicildls ulu p u0 lxrmf iodla  li sls) eum(m oy1omtnlfctl()sDtmuroot0tle ifciatlm rau onu0tetrxr3iytfaDeauvsls)trtr(mpoy1lmeelnvt (  2ta(r nt4tptniociasla2rauvon(4aexomf3oydfp e uvs t0t2xm(o oy1llee fctls)sDrrxr ;u4aexnifetlsla eaumpnu)alxoxr tydfm  luvo t s2xmxr3nu1amtnmivt (  Duaxmooo0oexnioetyd mDea(vo u)aexoir3oatomDe u o;() exr(m3iu1alt lnctas)sDrmumpou4ole mfciltfsDra(vsnu) exoio3todopte n olt0teuoxmpno1ll nmici sf 2uax  ot0aet mfciysfa2ea(vont) lxrxfcty1lmt lnesl() 2toxo io4lm   fciat)s2tmx oot0olx  ictyt a2ea(mp;t0 eenxf3io1omteln o;s0 eurxm iu1amt mneslt aDrmxmp;t1alxo o3iasfa ranmpnu)tetrio iy1lateaivols s2toimpny4lm  lieiat s2rr(rp;o1oltoii3iatls ra(vs;(4trtoxociotla e ivilt0truoim oydopenlfcsas) rua( pou4olxn octad sDeauvp;u0 eenxr iodom e u i;t0 rum(mpiodopt mnct sf 2tm(mpoo1tpt ii3tadla ul( p;(4trerxo3oadopDeanvi;( t2xoxr io4ol nlivil() 2urx p;o0ale  fetlsfs ea( snt4trxrir3oo1op ran o t0trtoimpiy1lltelfctl()aDta(r ;o4opxo feias aDum(vpnt0tetrir3iytfa eli o;t0 rtr(opiydol  lnet s sDtauroot0optnifctldlm rmu s;() ltnmf tytlpD lnvils) etoir3nudlpeemfvias sDumx  ;t1opxnifciat sDelu s;u4 rermf3to1fmt ln ils truo(m oodllt lfvi tfs2uaum ;o0oee ii3tld sDeau snt4 lxnxf todlaDeau sl() 2triopoydoptelfet s)aDrmumpoo0oex iicils mDrm( s ()treriociydom rauvs s0tetmxo3io1al  liesas a2taumo;o1alenmfctydfsDua(mo;u4artnmr oo1lm e uei;s0texmir3iodlpen feias)srra(rp;u1tpt io3ildlmDumnvsnt4 ltoio io1optr n ol() rurxrpno1lptelnct tfa2rrumo;t1aeen f3tasla uanmo;(4tlerio ty1opt lu o;t0 exoxopiy1lm n feslsfa2taxrono1tlt moeiysfsDrl( p;()tlxoxf3oo1fm raies;(  rtm(m iy4al e fcsls srtr(r no1tpxnmo3iadfm2elnmo;u4 rtrxf3todomDr neolt0sexoxrpiu1ame licsl()srtmxmont1tex mf3iysfa el(vp;t4 etomocta1faD  ies;t0 2uoir ou1lmt lictltf Drrurpno1tlxoifeiaslm2ra(vpnu4trxnif tatfm e nvs ()srxoir nu1om emfcs sfsDum(rono1texn ociys s rlnvon(0tetrxf3oadlm  lueilt) ruoxr no1olt mfvt tf rtmum oo0tleomfeias s ulu s t)alerirctadlaDeau ils  2trxrpoo1amee neslt) rrm(mpno1aleomfeiadfm ranmsn(0altrxo3tydop eaneilt)trur(o nodap  lncs tfaDumum ot4apxomfciltlsDrln p (4 lxnmfciatfpt  n i;()t2to(r3no4openmnvtas  rumxmpno1oexo i3tyd a2ulums u)tleoxocoadlptrauvo;()s2umxm3iu1lmenlieiat)srtr(  ou0tex mocilt m2uln pnt) etomo tydopte uvs;t0trtoxm iu4ape mfctlsfsrtmum ot0alt  octydla eanmp (0 exoifcio1omtrliei ( seto(o3nu4op nmnes s a2rmxm ou1altn octydfaDum( s;u)teeomociytlpte i o s0trtrimpiu1aptn ivta(f Dtmx onu0opxnio3iyslsDuaums;t0 lxrmf3iatoaDelu ol(  euo(mpoydoltnlietlsf 2tmx p;o0tet  o3ilt a ulu pnt0aetoxo3tydfaDeau ols)s2umxr3iy4omenmnesas) rurx  oo0opeoifctldls rau sn()trerif3oydlptrai i;t0tetr(rpny1omtemfcils  rrr(roou4tlxnio3iydfa2eau s;(4texriocoatfpteaivo (0sexmimpoudam e ivt sfarur(m ;u0aeeomieiysfm rmu s;(4alxrir3oa1fm eaneolt0 exr(o3oy4altelicil()artrx  ot4tee  feias s ul( s u0 leoif iytfpDeanvi (0 rur(m3no4ol nmfciat arur(mo;o4opxo ictls s2emu o t4tlxrio3oadlpD li o;()trurxr io1ll e nvi ()a2rax  ;t4aptomi3iad m eln p t) etrxociatfmtelu o t0sexrim3ny1ole mncsl(fa2rr(moou1altomo3iltls2rlnvs (0 rerir ia1lmD  nei t0 rur(mpiydlptemnvsa() Dtmx poo4aexnif3iydla rauvonu4 lerif oo1fa  anvi ()setoio3ny4open nvs s)sDumumpot0tpt  oeiaslaDran onu)tetniocto1opD  uvo;()s2to(r oydam elfcslsfsDurumo;u0oltomieiaslaDelu s;t) etnxo oytlat aueilt  rxmim oodomee ieiat)aDrmxronu1opto o3ilslsDelu pnt4alermrcoa1op elu s;s  rtoxopnudlmtemivi t  2rr(ro;t4opx  iciadfsDelnvonu0tltoif3iadlmD luvo;s)truoim3iy4lm elfvias) rrmu  nt4oex mo3iyd s eaums u)tetoxo tadom  luvi;s)sruoxmpoodlmeelfeiat) Dum(r ;o1optnmieildfsDrmnms;(0tlxrir ty1latranvsl( sexrxr3iydamee ici sfsDtrx  nt4apxn iciatfm2ean s t4tetoxf totoaD aivol()seuoiopnu1optn fet (fs2rrumpou0olto i3iltfa2umu o;t)tlxnxocoytfpteaiei t srurxopoydopt lfvt tfaDtaump;u1tpeo octadfs emums;u0 ltrmo3totoat ln ilt teurim no1open iviasfsDra(mp;o4aptn ictadlm2uau pn() reoxfcoo1op   u ol(0sruoio3iydop nmfvtl()srtrurooo4optniieiasfs emn o;u4tlxomfctadop ranvi s s2trxo3no4ol nmfesl(f 2uau  ;o0tptoifeiatlsDeau ont)texrmr3tydlaDran i s0t2tr(mpnodale mivt tfs2tm(mp;u0olxn f3iytlmDrau o;t4areomfcoa1lm  lieo s0s2toxo3oudal n fet s sDrm(moot1teen ocilsla rmnvpnt4 rxnmr3iotlatr n ils0trur(r io1ame  ivta( sDum( pot4tptnii3iytls2rlnmp (4tleoxrcio1lmte nes;s0trxo(o3ny4oleelfvs () Dumu ooo0optniiciatfm2rmuvonu4tetrxf3oadlpDr ivo;s)trxmxo3iodlp  lfvi s)s2ur(m nt4tlenmi3tydla emnmsnt0tltoio iodlp  aivs;t s2xrio iydom   fes t  2uaur nu4ole io3iltfaDraums u4trtrxrcoy1fpt aieo () 2umimpny4amenmfvsatfa2rmump;u4aetomoetytfm ulu onu)teenxo iydlaDeln o t0t2urir iy4alte ieta(fa2rau o;t1tpxo o3tlsfaDea(mpnt)tleomo tadfm r n o t0 exoxm oo4ome  nvilsf Drmx pnu1teto f3tad a elnmp;t0teerir3oodfpt  nvsl(  2xo(opoydale  icils)srua( poo0tpx mo3tatfmDeln p u4 ltomf io1late ivs;()texm(opiy4apt mivsls  Dtaxrp;u0tetn ictysfa2rmums u)tetnmr3oy1fa e iei;(0 rtoio3oydlptnlnei t  2tm(  ot0altnmo3tlsfa ua(vp;u4aexoxfcty1fp rln s s) etoirpiudapenlnes (  ruaumonu4olxnmf3tyd sDemu pn(0alxnxoctydfmD ln s;s)seuoio3iodlmenlnesatfs2uaumpnu1aetnio3ils a2uanvpnt4trtnxr3oydoptraneo;(  rur(m nu1lp emfvsa() Drruroou4tex mo3tld m2uaumsnu4tltnircoadoat lneslt t2urio nydoptn icta( s2truro;o0apxn ieiys a2umuvs u0artomrcto1fmt  uei s) rumxr oo1lmt mictat)a2rmxmo;t0aeeo fciadfsDean p;()texnmr3ty1fmt  n s;s) ruoxr3ou4ameelivtasf Dta(mont1apxnmietydfa2ulu pn(4aetrxr tytopD anvi s)s2tr(o oo4llt mivt sfsruaumpoo0oltnifeiyt s2ranvs (4altoxfctatfpte u i;t srumxm3oydameelfetl(fs2trurpoo1aexoioctaslm2ran ont)alenmo3iadla  an slt0trtrxr nu4omen net sf Durum ;o4oleniiciatfsDea(vont) rermf3iotfptrlnvols0 2trim iy4op  mictltfsDua(ronu0oex  ictydla rlu p;u0 eenmo oodoa rluvi;(0sexrim3ou4om nlfvsa(f 2taxrpno0aeeomi3tat m uauvo (4 reriocio1fm eluvi;s0teto(rpoydalt micsat)a2rm( ont4tptnifetasfs2rau p t4artoxr3ia1om   n s;t) exmim3oudalt mfcias  Duau  nt1aetomfctasls2eanmsnt4aeenmfcto1fpD lu s t sexr(r nydam nlivsltfsrraxmpou4texo i3tysfa2rlnmp;t0alermr3oodfaD an sl( s2uoxr nodolt  iciasfaDrmuront4alxo f3tatlm rmnmpnt4arxoxocoytfpDrlues;s)sruoir3iu1am nlneta( sDuru pnu0tlt mociadla rlnmo;u0areoir iy1omD an o;t t2tm(rpno1ol  mnvt ( s2tm( o;u0texo ictad s2rmn s (0texnxo3iodlpt aivs;s0 2toimpny4ale lfvil()a2ua(mpoo1oeto ietlsfaDranvp;u)arxrmf3iydla rlneslt sruoio nu1omt  fet s a2umuroot0optn fetltlsDrau o (4tetoioctodla r i s;t) 2uoio3nu4lmtnmieslt a2rmxmono0aeen i3ias mDeluvpn()tlenmo3oytopDrau o;s) rxrimpou4lmt miet s sDra(r nu1tptn oeiatls umnvo;t)treoio3totomD lu i s)t2trio3no1lpenlieil() rumx  no0olt mictlslmDemnmon(4tlxrmo tadlmtrlu sls0texo(m3ny1lpee ivs tfartm(  oo4tpx  fciydfs2ea(mo;(0texrxf oa1faD ln i s)tetmiopiudllt lnvtlt srtaum ot4ope ioeiasfm2emu on(4 lermo oydfatrlivsls0 euriopnydop nlfet s aDrru p;o4tlx  feiydfa rln s;t0 lermf ta1lpD  uvs () exo(rpnydop nlfvtas srum(rpnt1teeniiciysfa rmuvonu0alxnxr3oy1lptrli il()tetrxm3iy1amenmict tfsDua(r ou1alxnio3iat mDem( s;u0 lxnmrcoatfpteli olt0texoir oy4om nliet t) Drru  nu1altomi3iltfsDuluvsnu0 ltoxf totfmD anvs (0srxriopnu1ll  mivi tf rtaxrpno4aee iictyd a eau p;t)alxrio3to1oateaueols0s2to(m io4om nmnvi t a2rrxmpno4tpxn feiatfsDrl(mo t) exrxr oa1faDeaivs;t)teumir oodaptelfct s) 2tm( o;o4tetn i3iadfa2uanvont4aetrxo iadlmte iesls)srxm(mpou4omte netas)s2uaxmo;o1tet moetasls rmnmont4alxnir io1lm eauvi (0sexr(m3no4ape mivias sDtaur nu4aex  iciysla elumo (4altoxrctodomt lu ols  2xmxopoy1ll elfcsas aDumu o;t1alxnmo3tltlaDeauvp;u)alenio3ia1op  an i;( srtm(r oy4lm emnei tfs2tr(r ;o0tpxn ietlslsDeanmo;()trermr tydom rlies;s) 2xmirpou1ol emfcil(faDrau  ou0apxnmoeiyslsDumnmon(0tlxnxr3oydoa  anes t t2tmxm nu1al nlfetatf 2taxr no0tltnifciytfs rlu p;() lenmr oytfpte nvo (0 rur(mpoy4lmte fcsltfsDrmxmpot1tptnioetyd s2ranmpn() etoif oodopDelueo t sexr(r3ny4omt  fvsasfsrra(rooo0tpx ifciat s2ua(vp;()arerir oadlmt lies;s texm(r ou4aleelnvias  2uax  ;o1oet iociad sDrmnvo;u0teeomo iadfp eli o t s2xrir3iu4amenliesltf Duaur nt4altoii3iasfaDeluvp;u0 reoio3iytlatr i o;(0 rxmir no4oltnlfesat) Dtrx  nt1ole  oeiltlm raums u)tetrmf3iodfpDeanvsl()sruo(rpiu4aptelfvsasf ruaxmpoo4tet mfcildlaDeauvs;t4 eeomf3ta1lp r ivol(0srxr(r iodllenlnetltf rtmxr ;t0tptniieiyslaDumnmpnt)teenxo3oytlp  lies;s0tetoxm ou1olee ivia(fsrrmurooo4tpt iieias s2emnvo u) ltnxo totopt li o (  2xo(r3iu4ope  ivs tfsrua(moot1aet ifciadfm elnmo ()arxnmfctydlaD lu s t)t2um(r3nydoleemnvsl(f Drr(m nt0tleomi3ilslmDelnms (4aetomo3tydfa  ln ols srxmxo3ou4alte icil(f Drax  ;t0olx  ictad mDuau on(4tltomf3iytfa  luvslt) exrim ny1opeelivias) Dtmx  nt0tpeoifeiys aDumn o t) lenif iodopDran i ()sexm(o3iu1ap e ncil() Dumu pnt0aptomfciadfmDulnmo;(4trxrioctodlp ean ol( s2ur(mpnu1lpeemiei (f 2rr( pou4aetn oeiyslmDuln pn(0tleoirciy1opD  i sl()srtrir3iy1lme mneta( srrrxm nt0apeniieiltlm em(msnt0 renmrciodlpDraieils) rtm(r iudlmenmictltfaDrrx ooo1oexoii3tat s2uauvs;()trtoxf3iatlptelneo s)trum(opiu1opte ivia()a2rax oot4alxomo3tytfa um( p;u4 lxrir3ta1lmtr uvi ( srumimpio4amtelfetatfsDum( ooo4tptnmf3iatlm2eaump;t)texrio ia1fm rlivo t) exrxr no4oltn nvi t aDra( pno1aexnmictlsla ranms;t4 reoio tytfa r ies s0trumio ou4alte ieiasfa2tmum no0aexnmictasfaDemn pnt)alxoiocoydlp ran sls  rtrxopno1lpenlics tf Drr(r ot1alt if3ias sDrlums;u4 eenmociytlm r i s s t2xoiopiu1om nmncils)srurur ;o1oleomfctltla2emn pn(4arenmoctodfat auei (  euo(mpno4ll emivilt aDraxmoou0tpeniocildlaDulu p;t)aetomoctotlmt li s t s2trxmpoo4oleemncilt aDtmxmont0olt ifeils s2rauvo;u4alxomocoytlatelivo ()t2xrirpiydoleemnesls)aDtax onu4aeto oeilslm um( p u) eenmr totfpt  nvslt  rtrxr oodlpeelncsas)arrmu p;u1aleo i3ild sDel(ms;u) eerir3oadlmte i sls0 2toxm3oy4oltemfci t  rrau ont4altoioeils s2umu s t)arxrxociytfp rau s s0texmio3iodom  miesl()a2tmxmp;o4teenmociydla elnmont)tltnmf3ta1oaD lueo t0teur(r3nodop  lfctlsf Duax pot4teeo ictyd s2emu snt)teermr oydoa   u il()sexmxr3ny1om   neia()sDuaxroot1tee  ociysls2ra(mon(4 etomr iatfpt ai sl()srtm(opnu1omtemivilt arrrxmont1tleo octldlm2eluvont0arxrirciydlm  aues;s)t2xr(m ou4lpe  fcsa()a2ta(  nt1olxn o3iytfs um(mp;t0aetoxf3oadlaDr neo;s0srurir ny4olte fvta(fsDrr(rooo1ape if3iadla em(mp t0 exnxrcoadomtelu s ()t2urxr3oudalee fvs tfa2trxrp;u0apx ifctlt aDrl(mp;t4treomf tydlm rlu o;s0t2urirpiodom n ncta(faDtr(rp;t0tet  fciytfmDra(vo () ltnmr3ty1op ranvo;(0s2uoirpiu1ap  mncs s) Dtrumpnt4apenii3tasls uaumo () exoxociy1fmD  i i t setmir nu4lm   fes (f Drr(ro;o4tlenmoctatls2rlu snu)artoxo3iotlaDeai olt)trxrxm io4ap nlnes t a2rau onu4alenmfeiysfm2ua( s t4trtnifcty1optrlnvo t0seto(o oo4om elfeiatfa2taurpou1olt mo3tasfsDrlumo u) leomf3totomtr n o (0 2uoir nydol  lfes (fartaxr no0ole ioctatfsDem(vs (0trerxo iy1opt livo;( texr(o iy4lpeelictl(fsrurxmpnu1aet iieilslaDum( ont4tltoio oy1la rauvilt0t2trimpiy1olt mnvsat arrr(ronu0aeeo oeiytls2ua(vs;u) exrifctydfptr ues;( s2xrxm io4lm emnvta() 2um(m ;t1ape ioeildlm ul(vsnu4 reomociytoaDrai o ( srxm(mpoy1ap emies ( sDrmx pnt0aetoioetltfmDrl(ms;t0aeenir3iy1op  ln ils0trurirpnudlpt lfet tfsrumxmpot1ape  ieiydfsDem(vp;u)alermoctatlp rlueol() rxoiopiy4lmee ietl(fsDrm( o;t1alt mf3ild m eanmont) rxrirciytop r ieil(0s2tmio oudlp nlicsltfa2tmxrono4oexnmf3ias m2eanvont4arermr to1la elieo t)t2trimpnydal n fct sfa2tmxmo;u1teen ietlslm uanms u0arxnmr3tadomtelnvi;t  2tmxo oo4lp nmicil()arrr(rpou1olt miciys m2umn sn(4tlenxfctotlmDrlu o s s2xrxm iy1lpenlfvi (  2rm(rp;t0aleo fciys mDuln o t)texrxoctydfpD  neil()setmxr3iydom nmicsa( srur(r oo0teenioeiltfm2uanvp () leomocio1lpte iesls) 2xrir3iudlptn nvtlt) Drmx  nt1oex  feiatfa uaumo u4 ltomfciy1lmtr n i;t)trxmxm oy1openlici s sDtmxmp;u0apt iociasfm2ra(mp (0aexrmrciydfp e u s;s)trum(r3ny4apt lfvia(fsrrax p;u4apt  fciydls2ua(vp u4trenxo3iy1oat  uvol(  eum(opiy4al  mfciasf Duax  ou4tpxn f3tlt m2um(vonu)teenif tadfmtran s t  rxr(m3io1olte fvsltfa2urxmonu0tpx  f3ild a ul(vs;(0 etoir iadlaDeanvo s)trxo(rpnu1apt mnesat arumump;u1aee  oeiatla2elu s u0trenmr3iatfp raueo (0 rxr(m io4alee nvsls)artrxronu1tet moetlsfmDea(vo;t0tleomr iytfatelivi s) exoxo io4op elnvs s aDrmurp;u1aetnmoetytfa2uanmo t4areomo oo1fmD luvi;s)trtoiopnodopeemnvsatfsrraxmpou4ope  ietatfaDem(mp;u0tleoxr3iatfmt lnes s)srxr(m3io4llen ictls  Drau  no4alxn i3tytlmDemu o u4tltoifciotom  ln ols0srurxo oudlmenmfet (fa2taumont0olxnmoeiadfm umnmsnt4texoxo io1lp r u ilt)t2xm(r ny1olt  fvilt)s2tmxrpnu1alenmf3tls mDum(vonu) eenxo3oy1lmD  n s;t t2tr(o3nu4lpeemietlt arrmx p;u1altnmoetas a2emnvp;t) rxnmrcoytoa   ivs;( seur(r oy1op nmivtls srumxmpnt4aexnmfctatfsDea(mp;t)artoirctadla r u sls0 etoxmpiu1al   nvs t) rrm( ono4teenif3ild s ea( sn(4trxnmrciytomtrlnvol() etoim3oy1lme mneta( s2urxroou0optomfctlsfaDeluvp (4 lxrmo ootom r u s t t2tmxr oo4ame livt tfsDtr(r ;t1teenmfeiltfs ulnmo t)trxrifctotoatrluei;() 2xmio3io4opt licilt)a2rmu o;o0oet  f3ias a uluvo;t0artnio todop rlu s t  2urxm nodoltnmfvta(  2ur(r oo1optoifetadlaDua(vo;t4texomo ootom elueols)seurio3nudalt  ieil(  2rr(root1oet mfciatfs2uanms (4 eerifcto1omDrlneo;s)trum(opoodap  lics () rrmur no4oetomfeias sDum( p u0arenifcto1oa  lnvilt0t2trio oodamt  nct tf 2rmur ot0teenmf3iaslaDumnvpn()trxriociytoaDrlu il() 2tmio iu4lpt mnetlt)aDuaum ;t4aee io3ilt m2ulnmsnu0teerxo3oodlmtrlnvslt) 2toxm ny1op  mieslt)sDumxm ou1tet  iciatlsDrmnmp;u)alxrirctytfmt lu il(0setoxr iu4omenlnvi ( aDuax  ;o4olen ietatfm umnms t4tlxnmr to1fateauvo (  etoio3iy1ll e ictl(faDtr(mooo1tpt ioeils aDum( s ()tetrxo ty1lptran sls sexmio3iy1ol emneils  ruax  ot0alenmociadfm2ua(vs;t4 eenxocia1fat aues;s  eur(m ou1ol e ieil(  Durxm ot1olx io3ildfa elumonu) ltnmf oodfmDr n i t  2toxr3nudlmenlfctat)a2rmxr no1ale moctysfa rl(vo;t)tetomr3oo1lat ai i t)tetrxmpny4ol nmieias)srumxmp;o4aetoio3tatls rln p ()artnio oydlp e i i;( teuoxr3nodapeemfvi s)aDuaumont0tltoifciltla2em( p;t0 exrmf3tydoaDe i i s sruo(o3iu4om emnct (  2umxm ou0aex moeiatfs ul(mo u4aetnir3oydfpD livi t)sexr(rpnodlmtnlneil( sDtmxmont0aet iociltlm el(vo;t)teenir io1op rlivslt  etr(mpny1ameelfctls) 2trxm ;o4olenifeiys mDemuvs u4tlerioctydlm  an olt0trurxmpno1ole  fcias  rraxro;o4apx  f3tlt m2rm(mpnt4 ltnif3oo1op raueilt) exo(opoodal elfvtl(f 2umxr nu0apt mo3iydlm umumo;()teerifcty1lpt  n ilt)teurim iy4op e icta()arta(moou4ole miciat s rl(vsn()arenxocia1optran s;t) ruoxm3ou1omenmiesl() 2raxrpnt4tpxoii3tlsfm2ea(vs u)tltrxf3iatfa ranes ()sexm(r ny1lmte fcils)sruru  no1aptoioeiydls2ul(ms;t4aeeoxf iadfat  ieols) rtmir3no4lme  nci t) Drr(ront0oet miciyt s2ranvon(0teenio3iatopDe nes (  eumim iu1op elnctlt a2tmxrpoo0oleo i3iyd aDean p;t0aeermrcty1lm elu sl(0t2urxr3oy1op emicsa( s2taxmo;t1alx  f3iltfm2ra(vp u)trxnmo3iodlp eai s s)trumio io4oleemnct (f Dtmump;u1alxnmieiatfaDel(vpnu4alerxo iatfm rlu s;()trtrxmpou1lmtemivsat) 2rr( pot4tetomo3tas m2rlumsnu0tetomf3ty1lmteaies;s0truo(rpoo1ome lict t)aDtaum no0tee  ociyd m2rl(ms ()texnxocoytfatrlivo;t) 2uoxopnudape  fet ( arrmuro;u1tlenmieils s2umn p (0teerxr tytfpteliei;s) etoxm oudomenmfeslt)sDumuro;o1tpenmfeiad mDumnmp;u)teeomr oadfp  lnes;(  rto(o nodaltemietat)a2rru oou0oltomoetys a2ea( s;u0aleomr3totfpteauvil(  euoir ny1al emfvtl(f Drm( p;t1oleo fctytlm uln o;()trtoif ty1lpD auvi;()s2to(opou1om nlneils srtmx  oo1ale mo3iysfsDrm(mp;u4tetoxfcoodlp r ies t t2umiopnodlpe lnct ()a2umxmooo1aex ifeiytlaDea( pnu4 rxrifctadla r ueol(  exoxr3iu4oleelivtat)sDtr(r nu1texo ictadlm2uln o u)artnmo3tytlpDran s;s texmim3nudlltn fet t  Dum(ronu1oee mf3iatfsDuanms (0trerir3oatopDraiei;s0trxoim3oo1ome lneslt sDtau  ;t0apen oetldfs2ulums u4tlermrcoo1faDeln slt0srxmio3nu1ope mnes (faDrr(  ou1olt ii3tatfmDrm( o t) ltrmo iy1fmDe neo t) eumio3no1ll   nei (f 2rax  ;u4oetnmo3tlt a emumsn(4 lxnmrciytla e i s;()t2trxopoy1lme licsatf 2taumpot1ape  f3iltlmDuau o;t4 rtomf3iytfaD lueo (0s2xm(m3oodlpenlncil(  2umu ooo0apt ifctat mDulnmonu0tlenmf3iytfmDe nvols  2um(mpno4omtemfcia( aDrmxrp;t0aexniieildfa2eau o;u4alxrmrciytfpD anvi t0trurio3nodomtnmieils)srtmx onu4texn o3ilt s elu s;(4 leoxrctatomt luesl()tetr(r3io4amtelieils)a2rru ono1tpx  ieildfsDrluvsnu0trtoxf3iatoaDe nvi;t tetr(o3iu1lm e nesa( a2ra( ono1opeo fctld a rm(vs;t)altnif3iy1lpDe i o t setm(m iu4op   ncsa() 2urumpnu4tet  o3tltla eanms (4 eenxfctodlaDeau o;s0srtm(o io4om nlfvs s)srrrurp;u0alx io3iaslsDelu p;u)aeerxocoodfm e u o;t tetr(m3oo4amen nvs s s2tmxm nt0ole if3tytfs2ra(mpnu)tltnmf3ia1faD lu ol()srxoxo ou4op elicil()s2rru  ot4tpxnmfciydfaDrm(mo u)alxoxr3iatlaD lnvs;(  2umirpio4op  lncs ( aDumxmoot4olx  fciydfm emnmo ()arxoir3todlptr ivi t  2toxmpiydlme lfvsl()srtr( pou0tpe  o3tltla2elums;t)artomr3ia1omDrauvs t texoxopoy4lp  licsat  Dtau o;u0aleomi3iyslm2elnvsn(4tleomf tatfaDelivi;t0s2xrxm oudapeemivias) Drrxroot1tltn icildfs em(mp;u)tleomocoa1fm   ieilt)truoio oy1apenlieia(fs2tr(  nt1tpxnmiciad mDeluvont0treoxrcta1lp eaiesl(0s2xoxr iy1ll   feia( srrmump;o0oexoioctld a2eaumsnu4 exoircto1fa r u o t)seuoiopiy1am   ici t)sDtrx  ot1ape mi3iad sDea(vp;(0 lerio io1lm  anvo;t)texmimpoo1lmen ivil( a2raumooo1tle iociatfa2rl(ms;u0areoxr3ootlm e i i t) rtmir oo1lme mieia( sruau p;t4opt iocildfs eauvp u0 lerxociytfmt au ol(0truo(o oy1ap  lics t  Dtm(mo;t4tptn ociltfs rl( o u4 lxomrciy1lat  nes;s) 2xr(m3no1olen ncsa(f 2rmxr nt4tlenii3iydla ra(vont0arxnmr3tytlpte iei;t)setr(m3iy4lm n ict tfsrrr(mp;u4alxn iciysfs2el(vp;()trxomo3ootoat aueslt0teurir3nudole mncsas)aDtru pot0aexoiociaslm rm( on()trerir ty1fmte iesl() exrxo oo1lptn ivtl() 2raxroot0oetnmociltla2elu o;() ltoif3ta1fa  au s;s0s2xrxo3nudlpenmneia()sDrr( pou0tpeniictytfsDelump;t4aexrxrciadlpDeaivs;t)srtr(m3oydlp emfeia(  Dtr( o;o4olx  octytfsDrl(vo t0alenmf iy1la rli sl(0setrxmpiudoltn fvsls)srrruront1tpt miciytfaDranvpnu)teenmfctotom e nvo t)texr(mpnu1lp  mfvsl(f Dtau poo4aexnio3iydfsDul(mpnu)tltomf3tadop e uei;t trur(o3ny4lpeemnvsa(f rurx  ot1oee  icild m2umnvsn(0aeeoifciydop e i sls) rto(mpoy1ome miei t a2uru oot4aptnmiciltfa ra(ms;u0 rtomf3io1opte i s (0 2trxrpiy4apenmfcias) Dum(moou4tlx mf3tltlm2ul(vp t4trxnmf3iotlaDeli il(0tetmirpoudlpenmieta()arta( oou4teeoiociysfm ulnvsnt4teeoifcoodoateln o;s  2ur(m no4am nlfctas) Drrx p;t0opxo i3iysla2umn s;t) rermf3iatfptrlu olt)s2tmio io4optn ncils  rurxro;o4optnifctadfaDra(ms u0trerir3ty1lpDrai o ()trtmxm oy4ap nmivsltf ruru pnt1aptoif3iytfs umn sn(4tltoxo3tytoatr ieo;t0s2xm(r oodaptelfes s) 2tmx p;u1oex  fciyslsDran p t) rxniocio1fpDrlivo;t  2xrxopiu1amen fvtasfaDtauro;o4olto fciytlm2rau o ()trerxrcoytoa e i o;()tetoir3oo4lp emfvs sf Dtmuronu0opeomo3ildla um( s (4 rtoxo3ta1opDrai i;() rxriopiy1alt  fciatfsDtmx p;t4oee mieils s2eaump;(0 etoxrcty1fptelueo;(0t2xo(opiydlpenmnetlt)srumu pnt1aee mi3tad m2um( snt0aleoir3todoa r nvi;( truoxo iudlleelnetas a2uaxr ou0oexnmf3tltfa ul(vonu0 rtnif3iy1oaDeauvs;(  etmim iydlm nlneiltf ruaxm ;o1oltomociyt m2elumsnu4 eeomfcoodom r ivsls s2trxopio4am nmivsat  Drau  nu0oltomicilt s ul(vs;u4 eeoxr3iytfpteaivs;s0t2xo(m iy4ll nmivslsfsDrmxmpot0opeoioetldfmDea( s u0arenmr3tatomtr nei;()sexmim3nu1oltemivsa( s2umxro;u0altoio3tytfa rauvp u4tetnioctydlptr nvs t)t2trxrpou1oleelivt () Drrxr no0aetnmiciytfs eauvonu0arxoxo3iy1lmD  u ol(0 2umxrpnydlpen nvi ()arum(mpno0opeomi3iaslsDua(vo;u0trtnxfcoydfp rlnei (  euoxm iu4lpt mivil()artaumo;t4tee  ieildfaDemu s u4tltrifciydfmD  i i;( teumirpiudapen ivslt  rraump;o1ope miciadls emuvo;(4trtomrcoadlaD  uvi;t)t2xm(o nodome mieiltfsDum(roou1aleniictyt a2ulu s;u4tetnxocty1fpDran sls  2um(m3nudomte ietlt aDrm(mo;o0aleomociydfs eluvp;t0tlxrif tydom eau ols  2xrxopiu4aptnlncsls sDtr(rpno4tleomoeiadlsDem( s t4trenmr3oydomte uei s)s2xoim no1ale lfcilt)arra(roou0tlt iiciatfm eanvpnu4 leoxo3iy1opt li sls0trxmxr ny1om n ietat) 2trum no4apen o3ilsls rmnvsnt0 lxnif3iydfaDrlueilt)sexo(r no1apeelfesat a2uau  ou1optnmfciltfmDem(ms () rxrxo tytlmt lnvil(0 rtriopiu1omen fvsl(  2ur( o;t4tet ifeilt a rlnvsnu4altoxo3oytlaDe i ils0trxoxr3nydamtemneilt)arrauroou4aee mf3iatfsDea(vo;u)tltnxo oatopDean slt)s2xrimpiu1apen ici ()s2rmurpno1oex ifciltlsDrlnvs u) eeoxoctodfmDrlnei;(0 rurxo3iy4aptnmnviat)s2umxroou1tlxo i3iasls2eanms;t)trxomf3oadlaDrlivo;t)trumimpno1lpt mnvsat  2uaumo;o4tleomiciyt s2raumon(4 etoiocoodlaDe uvo ( srxoxm io4om e ietlsf rrmx ono4tex  ocild mDumnmsn(0tlxomr3iotlm rlu ols t2xo(opiydalt lics t a2rmx onu4olto iciadla rlnms;u0 lxomr todlpt  neo t s2trxo oudoptemnesa( a2tmxmp;o1altomfcias sDemums t0texomo3oo1fmtelu o;(  exrxopno1lpenmnesas sDur( pou4olxnmictat mDem( s u) rtriociydlmDe nei;( s2umxo nu1olt mfetlt  2tmur ;o4tetniietytfsDuln s;u0 rermo3oy1lmDr nvilt trum(r3oodllenlncs tfsDrmumpoo4tpen oeild mDum( s t0trtomr oadlpDranes s  2tr(opoodom elnesltfa2tmx p;u1aexomiciad mDrl(mont0texrxr3iydfmtrlneol()t2xrxrpnodolenliesasfs2taurpnu4aetn icils a uln o;t)teenxr3tadoatran i;()srumiopoo4llt  fciasfa2tm(ro;o1tltniieils s2uan sn(4tlxoir oadla  lnes s0srxm(opny4lle lfct sfsDua(r ;o4opxnii3iatlmDel(msnu4aleoxr ootoat ai il( setm(rpno1am elfes t s2rmum no4tltn fctls sDel( sn(0trtomr iytopDeli ilt) etm(opnu1lm   fvtasf 2umu onu1apt mictldfa2ul(mpnu4tleoir tadfmDrlueo;t0srxrim3iy1llt mfvtasf 2ta( o;o1olxniiciytfa2ea(msnu0alxoifctadlmDrai s;(0srto(m oodlpee fvtl(fa2um(mpno4oltomocilslsDrlu s (4altrmocty1oaDr u s;t)t2tr(o3iodopenmnesl()sDurxront1tetomf3tlsfs2rl( s u0texoircoatfmDrli i (0 rxoxr iy4op e nvtls)sruaumo;t1oet iociasfmDum( s;(4alxnmo to1faDr n o;s tetmxo3iudlptemici t)srtaxrp;t0aleoiicildfaDrm( p t)tlenmf ia1fpDeli slt) ruoxmpio4al  mivt s srrmx p;u1tpx moeildfa rl( s u0tleoxocty1op ean s;t)teuo(r oudomtnliei s) rtaxmo;o0oetn oeild mDeanmp;t4 lxrxr to1fmDrln o (  2uoir3iydllt  nesl(f Dta(m nu1tpeniictls a ulu o;u0 lerxocoa1la rliei s0 etr(opno4alt  iei (fsDrm(rpoo4tptnmociadls umu pnu)alxomociytomDrlivs;(0 2xmir iu4op   ici () ruaxrp;u1tlx mfciatfmDemnmpnt4 rxnxr3tadlaD ai s;(0s2xoxo3iudol n ictlt  2rrx ooo1olto fctat s2ulump;t4trtnxr3todopDeln ilt  ruoirpiy4lptelivilt  Drrx  oo1tlx moctad a2elnmsnt4 rtoio oydlptelnvs;(0seuoxo io1al n netlt)s2uaxr ;o0altomi3iltfs el( p u4aexomo to1fmD  nvi s)t2trxopoydoptelicsl( aDuaur ;t1oexoioeiysfs rlnms (4texnmr3oadfp raneo;s0t2umxm nu1op  mfctlt)srrrxmoou1optomicild mDeanvp () rtoxf3oo1lmtrluei t0sruriopoydam  mfcta(f 2ur(ront4opx mieild aDuaumo u4treriocoadoa r i ilt) 2uo(r iudlmtelfvta(faDumx ono4aet iociys mDrmu o;t4 eeoxo3iytfpDean o s0srtmxrpiy4olenlncs s  2urx  ou0tltomo3tydfm2ra( s;u) rerxo3ta1om raies t  eto(r oudamt mieias)srrm(rooo1oeen i3iatls2uan o;t0aexnif3io1omtelu s;t0 rxm(m3io1lp  mfvils)s2ua(rpno0openiieiytfsDumn s u0 renxo tydom eau ils0srxm(m3nydlle micils sDrm(r ;t4aptn oetat s2elnvs;()trxrif3iotfp  lueil(  eumxm3oudol e icils)a2rm(  ;u4alx mfciytfa2eanmpnt0 eerxf3tytoaDrau ol( trtr(m ou1lmeelfetlt  Drrurp;o1aexnmi3iytfaDrl(mpn()artnxfctodlpt luvsls0setm(rpou4omtn feslt aDtmx oot1olxn ictasfs ra( pnu0trtrif ty1fpt lnei;(0 rtmio3oodamt  nct t s2ururpnu4olt moctldfm uan snt4altnif oydopDeau i t0 rurxopoudllenlfesasf Durx o;t1oexn ieiadfa elumsn(4tltnxociadoa  liei;s srxmim nudllt  net (  rrr(r ou1aetoio3tat a2rm( s (4tltrmf tadlaDrluvs t)seum(r nydop  lici tfs2raxroou1tetomieiyd m2rl(mp t0alxrmf oydfmDranvils0 exoxr3no4opteliesl(fs2um(mo;o4aexn fcilslaDea( s;t0treoxfcoatopDeanei;t0seuo(r iy4ll elict s  2rauront1alt ifctaslm rauvo t) lxoif3tatfat au sl()srumxo3ou1omt mfvia()srrr(m ;o1tleo fctlslaDel( o;()aleriociodoaD au s ()tetoiopoy1lm nlfetas)srrruroot0altoifctysfmDuln p;(4altomocta1fatraieo;s0 etoxo no1lmt  ncsas)s2ra(rp;t4tlt mo3tyt m2rlnvo;(4arenxf iotlmDr uvo s t2ur(m3iydopt mict sfa2taxmono1aeen o3iys s2eauvs;u0trxnmoctatfaDeluvi;t)s2uoim3oydal  lfctasfaDua( pou0oeto oetytfm emnvs u4areomf3oy1lm r ivo ()t2tmim oo4ll nlfciat s2um(  nu4tpenmiciydlm2ul( p;()aleoir tadoat lnvol(0 rxoiopoo4lmtemivil(fs2ta(monu0opt  o3tat a2um(mpnt)alxrxr3oa1opteau ol(0sexmir3nu1lm nlnvta(f 2umx pno0apx iictadfa emuvp;t4arxoio3to1opDeaneo t0texrxrpno1ll   ies t srtm(mo;t1olx ifcilslmDeaums ()areomo iydoaD  uvi t tetrxo3nydomtemfvsa()srrrurpnt1alen o3ilslm2rmumpnu0artrxf ootoaDeaieo;()s2tmir nudop  lfviat)arrauro;t1apxn fetas sDua(vsnu0trenxf3ootlmteli o t) exoirpio1amenlfci (faruau ont1alxoiocilsfa eau p;t0arxnxo tytlat lieol(0 euoirpno4ape mfetlsf Dtmxrpoo0opx mi3tadfm2rluvon()tetnio tatopDr nvil(0sexrimpny4openlfesasf 2ururoou0tex moctys mDul(vo u0tlxnxrcoy1op  lnvs;t teum(m3nydllte fetl()aDrmur ot0tex  ocildfmDean snu0alenmocty1oaDr i i;t trumxm3iodopt mivtat)arur( pot4teenif3iydla2uluvp u4areriocio1omt aues;t)teum(rpoy1ap  lfetl()aDraum oo0alenmoeiyt mDul(vo;u4 lxrmf3ta1faD luei;s srtr(opoo4am emnvsls) rrm( onu0oetoioetad a2rlnvo;u4 reoio iydfmDraies;s)setoio iodlm  lnvias)sDrm(m ;u0oeto oeilt m2rmu on(0 rermrcoatfp e u s;(0teum(m3iu1ll nlneta()s2ua(m ;o4oexniiciytlmDran pnu0trxniociotla  aieo t0texrio iy4lmt  ictl() 2urxmp;u4apx  i3iasfsDumnmp;u)alermr iydoaD  n s s0 euoir ny1lpee neslt)a2tm(m nu0oeen f3ilslsDuln p;u4altrifcio1laDr nei;t0t2uo(r iodop   ncil()arta(mont4oet mf3ilsfa2um( sn(0aeeoxf3iodoaD luvi s0 etrxr3oo1lpt  fet ()aDrr(moou0oeeomoeiltls em( o;u4tleoxo oydlaDe uvo;t)srxm(r3oudaltelnvtlt)srumx o;o4oetn fciatfm2umumo;u4 ltnir ta1laD ln ilt0 2tmir oydll emneias)a2rr(mono0oeenmieilsfsDumums;(0 ltrio3ootop eaues s0 2umxm ny1lm elnei s)sDtrumpot0aleo i3tysfa emnms;t4teeniocoa1lat luvi;s0seum(m3io4lmtnmneiat  Dta(rpno1ope mieias s2umu p u4arxomo3iotlmDeln o;s0seumxo3nudlpt  ictat)aDrrxro;t4alxn ociydfaDrlnvp (0tleomr totlm r nvi ( setr(o iu1lleelfctas)aDua( pnu4opx  f3iys sDum(vs;(4artoirctytoa  luvs ( t2toimpnodol   fci sfa2uaumonu4oeto i3iysfa rm(mp;(0 rxomo ootfp e neo;s)trtrir3iu4ol n nvta() rtm(rooo1alt mo3iltfsDrlnvs;u0aetoir oytlmteluesls)tetr(o io1lltnlnvtl(fs2uaump;o4oleomiciytfs2uan snu4arerif io1opDraneilt0tetoio3iy1ameelfvsl(  2urx p;u1oexnmf3iysfa ulu pn(4areoxrciydfatraneo s  2xoxopiy4apte ivsa()s2umxmpno1oetnii3iyt sDeaums ()texoir3totomtr nvo;t srumio oy4amen ietls  ruauroou4optnio3iyt a rmu onu)tlxnmfciy1lp  lnei;t)t2toir nodlm   iei t)aDurxmoot4tpxomoeiltfs2rl( p;u)tetnmrcoydlpte uvs;s0tetoxo3oudaltnlivslsf rum(rpno0tptniicias m rl( o;u)trxoio3todfat lueo s  exrim oydol   ictl(fsDtruro;o1tpe ifciydls2ulump;u4trtriocio1lpt ln i t)t2toxo iy4ameelneil(  Drmxmont4apeniieils s2rmumonu)trtrxo3tatlpt lnvs () rurxr oudlle  ivtlsf Dtr(m ou4tpe if3iytls2emnvsnu)aeeoif3iy1fmt aivi;( s2to(o3iy4lme  fesl()a2tr( o;u4aex mi3tas a umuvp;t)arerxr3oydfpt lnvs;(0srumio iy1opeemnvt tf Durumonu0ole miciyd aDelums u)tltnmf iotfpteaueils0 2xoim nu4lpte ivtls sDurx  ;u0tpt ifeiyslsDrlnvpn(0tltnmr iytfptr ivolt)t2umxo3oodome  fcsatf Dtm(mono4texn ieiytlsDemuvo (4tlxnmocoadlp eau ilt)tetmxo3iu1omte ncsa(  2rm(  ou0tpto icildlm rmnms;u0texnmo to1faDeluvo t teumxr iydamenmfciltf Dumurp;o1tltomo3tat s emn p u0alenmr iydfmD  nvo ()srtrxopiudlp e fetas)srtr( oou4aleoiiciltfaDrmn snu)trtoxf ia1lmD  ivo;t)trxoir nodol emiei t) 2raump;o0tpxnmieiys aDeluvs (4tltrmr3oa1lp  luei;( truoio3nudlltnlnvi t aDuauro;o4alt ii3tatls em( ont4arxnmf ta1fmte u s t0t2tmxmpou1ap e fvsa( aDum(rooo4apx moeiysfs eau o;u4aeermr3io1oaD lneo;s0srxm(m3nu1lpe livi (  rraum ou4olx iociydlm2eauvp u)artnxf3ootlat ln i;s)sexr(mpiu1lmenlivs s)a2tmxm ;u0tlxnio3tys a2um(vonu) exrxo iydlmtrlues (  2toirpoo1ol nmfesls) 2rr(mpou0ale  f3iyslmDrmuvo;u) etoir iadlp r n ols0tetrirpiy1ll nlfvsat srtaxr nt0aleo oetas aDea( s;(4 rxnmo3iodlptrlueo;t0setmio oodam  mncsl()artau  ou0oexo i3ilsfmDem(msnt4areoxo3ta1fmteanvo (0teuo(r3oo1omt mnet tfa2ta( oou1opeoif3iatlmDrm( p;u0tltnxf tatoateau i (  etoxm no1lmtnmicsltfsDrrur nu4oeto ociadla2elu p t0 rtnmf3oatomteanvs ( texmiopiu4ol nmfciltf 2trumpoo1oee  fetadfm2em(mo u) etoxr ta1lp rlivol() 2umxo oodaltnmfcsl()arra(ronu1alto ieils sDua(vont0alxrxo tatoaDr iei;s  2ur(m3io4ale mnei s)sDrrx p;t4tet  iciltla2eauvpnt4alerir ia1fatraues;t0 rumio3oo4al nmics ()srurumooo0alx  ieiyslsDelnvs;()aexnxf3tatlaDrln i t0teurim3no1altemivia(fa2ur(rooo0tlx io3iadfmDran s;(0tetoir3ia1fmt lnvo;(0t2xmxr nu1olee fvtl( sDumumpot4tpx iictatlm umuvp;t) reoir oo1fptrlnvolt0trtm(rpnu4ol  livsas sDrmxrpot0olt  feiltlaDel(vs (4tlxrxo totlpD  i o t trtm(m3oy1lp e nvtat a2rrx o;o0aptnmfetltls2rl(mp;t4 lxoirctatfm elu o;( texoio nu4lltn fvt () Drr(  ou1tetoifctldfa2ul( s;(0 lxoir iotfpDrlneo;()trxrxm iy1op emicias)srtru  ;t1aetniieiysla rmnvsnu0alermrctadfmtrluvo;s0tetoxrpny1lpe  fesa(fa2tm( onu1texomietytfs emn pnu4trxnmr oy1oa r n sl(0s2umio3nu4lp  mfvtas  rua( pno0olx  o3ilslm2rlu onu0aeenif3tatfm  aieo ()seur(r3no4ap e ics t sDtrxm no1olx mfciydls2raumsnu4aetoir3tadom   ies (0srtrir3oo1am elfct t s2rrxro;o4olenio3iyd s ulnvp ()texoio oodlmD anes;t0 rtrxrpou4ole  icta() rumumo;u0aeenif3iasfa ul( s t0 leomr oydfa  lueslt trtmxo ou1al elnvta( srrrumont4tet mf3tadla2rl(vp;t4 rxoir3oy1lmt  nvolt) etmxopiudlmte nvias aDrmumoou1ole  oetysls2eluvs;t4tlxrxf3ia1lmt  uvi;()t2to(m oodlle  ietl( a2uax onu0tpxo icildlsDra( o;(0 exrxf3oadlmteauvols) ruoim3oodllt mfviatf 2rm(m ou4oetnmfetadfsDul( pnt) eenmrciytlaD livi;s t2uoxm3oudll elfes t aDtruroou1olxnii3iad aDel(monu)tetnircoy1laDe nes;(0teuo(m3nydlmt  fvt t)s2raumpoo1apxoifcilt a ul( p t)texrmrciotfaDeanei;t0t2toxrpiu4lmte fvtat)aDrmum oo0ape  ieiysfm uan o;(0 rxrifciy1omt an sl()srumio3ou4lptn fesat s2um( ono1apenii3iatfa elumont) exrxocta1omt  uvil() eumim io1lmte ictlt aDtru  ot0oeeo fcild mDrauvs t4trxnxoctydla  lu s;t)srtrim3nudlp eliei () Drrxrp;u4tetoii3tltfsDelnvo u4 eeomf tadfpDeluvo;t0 euoir3oodllenmietat)a2rmurono1tlx  ictld aDrm(vpnt4 eerxr iydfat au i;t0s2tmxr3nydap  lfviasfs2rmur ;o0olxniieilt s2uanvon(0tltomf3oodoaD au s t srurxmpoodlmtelivt ( srur(ro;t1apenmictlslmDumumsn(4 exnxr3ty1fptranes;t)seum(m3ny1lpte icsl()s2rmumoot0ale if3tas m2rln s (4 etrir3to1la  ai i;t)sruo(o3ny1apenliet (fsrtmx  ou4ope  ociytla2ulu snu0tltoxf3ootfm  li ils0seuo(opnudomtelnesat) 2umx ont4tex ioetatfm emnvp u) etnmo tadoaDe uvi ()trurxmpny4amtemneslsf rtm(mo;t4aeeo o3iltfs rm( o;()aexnif3io1optrai s s)trumxo3iy1op emfcilt  2ra(  oo0oeenioetysla rm( snt0 etnmfcootoa rai o (0t2xoxrpnu1omt  nvtl(f Dumx pot1alto fctlt a rau o t)trxnxoctatoa raivi t)seuo(rpoo4ol  mivi t)aDtrump;t4tet if3tad a2uanvo u)tltoirciotlaD ln ol(0sexoio3ny1lptemivi (fa2tmurpnu1texn o3iasfs eln p;t0tlenifcoadomt  uvo ( truo(m oy4llt  icsl(  Dra(mpot1tlxo i3tldfaDelnvo;t4arxnxocia1opDe nes;t  ruoir nodomtemfvs ( sDuru onu4tlxoioeilslmDrmu s;(4treriocty1la eluvol() 2xo(o3iudomtnmnetat s2tr(  nu1oex  o3tas aDuluvsnu4aexoifcia1la eai i;t0srurio3nydoltemictl(fsrrr(mono4tpxn fcild mDuan ont4tltnirciatlptr nvi;s  rxm(o3iy4am  lics s)a2tmumpno0olx mfciyt a2umumsn(0alxrif3ootfaDr n o;t)sexrxo ny4om n ictat) Dur(moou4aetn f3iasfa2rmnmont4 exrmo3iatla  aueo s)srumim no4lpt mfcs t) Dtmum ;t0tpe mfctld aDra(vs t4trtnxo3iydoaDeaues;s tetoio ny1lpenmfcta() 2ur(m ;o0oexn ietad a2ranmpnt0 exnxf3tatoa  luvi s0 2um(o3iu1am nlivi tfa2trum ;t1opx  ieiadfm rmnms;(0 exoif oydomtr u o;s trtrxopny4lp elivsl( sDtmumo;u4apxoifetad m2rlnvp t)trxrio oatlpDr u sls)trxoxm3io1om  lfvs t sDraxro;o1opeo i3iatlaDel(mp u0 rxrifctadlpDeln slt0 rtrimpiu1lltnmfesa( aDta(  oo0apxoiociasla eanmp (4alxoxr to1lat  ueslt0trxoio oodal  mfct sfsDrmxmo;t0alxnif3tyd sDeau on()arenir iodomD auvils) 2uoxm io4amt mfetls s2rm(mpnu1tpe ifeiydls2emuvonu4 rtnio oatom r neo;t0seurxr oydoleelieil(f 2tru  nt1tpt ifeiatlm2ulnmsn(0arerir ta1fmD lu s;t)trtm(m3iu4lpe mnvtat  Drax pot4oet  f3ias m2umnvp u)tetnxr oatfpt  i sl()srur(m3nodlpe mnvs t) Dumxro;o0opxn f3tyd mDuan s;t0aexnmr3ootfp eaiei;(0trtmxo3oodllenmivtas artrx pno0opxoifeias s2ean p (4 eeoxo3tatoatrlnvils trtoxr3oydlpt lfvs t arrmu  oo0aexnif3iyt sDum(ms;u)alxomr3tatfatranvi t) eum(m ny4ll emivsas) Drrxrooo0tetniociys s ra( ont)treomfciy1omt lu i s0tetm(mpnudap  liei tf 2rmumpnu0olx ifeiltfa elumont)alxomf oatopt an ils  ruoir3iy4ap   nvil()aDtmu ono4tpxo f3iad sDumn p;(0tetnxr3oadfaDe ues;()srtr(m3no1lptnmncilsf Drrx  ou4olx mf3ild sDrm( o;(0tlxoir3tatlm raivi;(0 rxrirpiu1apen fesls sDtaxrp;t1oleoioctys a ra(vo;u4trtrif oatoateli s;t)seurir3no4lmt lfeil( aDuaurpou4tle  ieils m umnmp;()alxnxr iytlpteaieols0sexoim3iu1lptn nctltfa2umu ono4aptnifeiytlmDem( pn(0 reomfctytlat aieils  eurio oy1ome mfvils)aDur(m ;u0tpxn fctat a2ulnmp t0tetoxo3ta1optrlnvi (  rxm(r3ou4lmte nesat a2ur( pno4tlxniiciytfs ran s;u0altoxrciytlmDelueo t)truo(o3iu4al  lfvil(  rur(mpoo0tpt mfeiys m2ulnmonu4 lxrir ootomtelnvo () 2uoir3nydoltn ivs t artrxr nt0oex ioeiatls2ulnvs t) rtnxf3oadfmD anvilt)t2toxr oudlme  iesas s2trx  nu0tpe if3ias aDemu p;(0aexnmfctotopte nvslt0teuoimpnu4lptelivsatf Dtmx poo0opeomfetydls2ran p;t4arerxr3iotlptelueil(0 etr(opoydomen ies (f 2ua(rp;u1tlenmi3iyd m rmuvs t4 exrmr oydfptrlies;s0seuo(rpiy4lp n ivtlsf Duaxm ;u1tet if3tatlmDem( s;u4tleoxociatlate nei;t  etrxrpny1al  mivt sf Durx o;t4oltnif3iasls ulu o;t)teenxr3totfaDeauvo t)sruoxr3oy4ope micsat)s2umu  ;o0tptnmoctadfaDuaumo;t)tetoxo3tytlatrauvs;s trtrir oo4ape mnvilsfsDrm(m oo0tlenmociys a ul(vsnu0alxrxr ta1fa  ai s t teuoxm3nodop emncslt  2ur( p;o1ole mf3iasfaDea(ms u)altrxrcia1fptran o s0srtrio nudal  lfcsltf 2uauront0tlx mf3ildfaDem(mp;(0aetrmf3oa1opte uvs (0srtr(m oy4oleemnvta(f rrr(mo;o0alxnmfetadlaDrmn onu)tlxnxrciodfmteln s t0srum(mpnudlltn fetls)aDurumooo0oetnmi3iysla eln snu4teerio iotlaDr ieo (0t2xo(r iydal emnesat)a2ur( ono4ape ifctlslm um(mp u0alenxf tadlmD  nvolt s2xr(mpoy4llee fcil(f 2trxronu0texo oeiaslaDranvp t0artrio3todop e n i;t) rxrxrpio4lp  mfvt t  Dur(roou1tltomietltlm2eaumsnt0 lerxfcoytoaDelnes;s trxrxr ou4omtnlfvslt) 2ur( pou4tetnmoeiasla2ea(vs u) rtnxf3iodfm   ies s) rtrxmpiu4openlnetltfsrtr(  ;t1aee  f3iyd a ra(vs t0 rtnir3ty1oat an s;s0t2xmimpno1olee ics t)artaump;t0teen f3ildla2uauvsnu)trxnir io1laDr ieo ( setr(rpnu1ap nmieiltfarrm(mp;t1ape mfeiad s el(vo (0trxomr3tydopDeln o;s0sexm(opou1llenmneta() rtm(m nu4opx mfeilsla2ul(vpnu4trtoxf oy1omDeau o t) rxm(o oy4op   ncsasfsruau p;o0ape miciyt a rl(mon(4 rxoio3tatfa  luvslt sexm(mpou1lm   fcil( a2rrxmono4apxniiciatfaDrlumo;u0 rerif3ty1optelueslt0setr(mpoudal elivtatf Draumpnt1ope  o3tyslaDranmon() etrxocto1fmD ln o () ruoxo no1omte fei (f Dtaxm ;o0oexn o3iytlm2ra(vonu4artoif totlaDeaneo s srurio3ny1lpe lict sf rua(r ot0olxoiiciydlmDrm(vs u4alenmf3tatfa  ai i t) etmirpoodlm nmicta(fsrrmxmonu4tleomociytfaDeau s u0 eeoif to1lmDelues;(0t2xo(rpny4amtemivia(f rtm(r nt0aee  feias mDum(mp u) lxnio3tadla rlu il( texo(opnu1lmte fei (fartrumo;o0oeeo f3tydfmDuaump;t4trxomo oy1oa   n o t)srxmiopiodlpenlncs tfsDta(r ;o0openmi3ildfa el( s;u0tetoxr oo1laDeluvs;t0 2trxr3oy4omt livil()arrruroot1ape mo3tasls emumonu)teermf3todoaDr u ol()s2toim3ou1lle mnes t aDurxmont4alt  f3ils mDrl(vp () rxrxo3iodlm rlivi s  euo(r nodap nlfcil()a2umur ou1tltnmictys aDrmu p ()tlermocta1op rlivsls)s2umxr oy4apt  nvi sfsDrmu pot4apxomieiat s2emuvon(0 lermr3iytfp elnvsl()s2xr(r3nodllt  ici sf rrmur nu4tex miciysls um(mpnu)arxnif oy1fmteaivs;(0srxm(r oy1alenmfcs ()aDurxrpoo0texomo3iasfaDulnvs u4 lermfciytfm   n o;t sexrxr oydop  mfvils a2taxrpoo1opeo o3tys sDrmums;u0aeeoio tydlp ean s;( s2xrim ny1ll nmivi (  Drrxmoou0oex mo3iytfaDua( o u0areoxoctydomDrlnvi ( setr(m3oodamt mivtlt aDuaxronu1aex moeiltlaDranmo;t)aexnxo io1fmtrau s;s0srxmxopiudal nlict (  Dumum nu4tpto i3ild a elnmp (4tltomf3ty1oa eaieslt)truoxmpoodal elivi ()a2uaum no0tpt ifeildlsDumums t4tltrxrciytlm r iesls0srxrxm3no1omeemneta(faDtaxm ou0tlt  ieiyt a2rmumon(0 renir3oa1fpteai slt)t2umio iy1lm elfctat sDrrxmoou0tpx iociltfs uauvs (4teerir3todlp elieolt t2xo(r3oo4apt lfeta( s2uru ono4tpen ictys mDua(mp;(0tltnmo3tydfp  auvsls)s2xoxm3oo4ll e nesa(fs2rmu  ;t0texniiciytfs um(ms u4arerif tatopt  i il() etr(rpnu1am emiei s s2rax  nt1opto i3iytlm emuvp;t0 rtnxo iy1la  luei;t seumxr oo1lp nlietas)sDta(m oo1teen f3tltls ranvsnt4areoxr3ty1opt li sls)srtm(r3io1oltnmneias  2rmxmo;t4tpt ii3tlsfm ulnvp (4altrxo iydoa   nvo s0trurxmpoydlpeemfviatf Dtrumpnu1aleo o3tlslm2rmuvo;()alermocoadla eaues ()trxr(r3oy1ameelfcil(f Dumxm ot1olxomfetydfm2ran s;t0aetrif to1fptr i ol(0 2xm(m nydlpeemnesls)aDrmxmono4tpt  f3ias m emu s t4tetnir3oydlmteln o s)t2to(m3ou1ll  mfeilt arur(m ;u1ape mieildlsDrluvp u4trxoxr todlmD livil()s2urxo3iy4lpe licsl() 2umu ooo1oeenmo3tas s2umu s;u4arxoxr oytfpDeluvo;s0 eumxo3oy1opt  ivsat)a2trx  no1apeo i3tas m2em(vs (0tetnxf3iy1lpDe u slt)setoxopiydamte ncs t  2trx o;u4teeniiciltls rmumo;(0arxrir3oodlpDraueolt  exrxr3io1ol   fet t)srumur no0oexomfetyd a emu pnu)artrxfciatlm raneslt0 exrxo no1aptemfvi (fs2trx pou4olx  oetysla2eau s;u0alxoxf3ia1fate ues;s0setmirpnu4alte fet s srtmxro;o1tetomfeildlm umums;() ltoxo3totom   nei t  2tm(r iudop   ncta(farrrxr oo0tpt mociys mDulnmo;(0arxnircoytfatrlnvol()t2trio3no4ap nlfcs (fsrrruroou1ape  ociys aDeln o (4treomr totfaD li o ( s2uoirpno4om elncs s a2tm(m nt0tltnmfeildla el(vs;u0arxrxr3tatom eau slt)s2xmio3ny4al n nvil() Dur(mpoo1apeoioetydls rlu p u0texriociatfmtran sl(  etm(o oydlpe lneia()s2ururoou0tleomieiyslsDemu snt)alxriocia1op eln s;(  etoxr io4optn ictat)sDur( pou4oexnio3ilt s2ua(mo;(4trxomf3to1fatr iei t0 2xoiopoy1ll nlictl(f Duaumoou4apxnmf3tadlm el(mp u4 rtrmo oydlmD luvolt)t2ur(o3ny4olteliei tf 2umxr oo0oetn feiad s2rlu on(0 rxomocoatomD ln s s  2toio iy4lltn ict tfaDraumo;u0oex  ieiytfa ra( on(4tltrifctotoa  lu sl( sruoxr io1lm emfctlt)aDraxr ot1tpeomfetat s2rauvo u)arxnir oa1fpteluei s)texoxmpnu1lp nlneiltfsDtr(rooo0aeeniiciatls elu o u4 lxrmr oytfm   i ilt sruoxr oo4omtnlfvsat  Dtmum no4tpxo fctat aDuan on(4aexnif3ty1laDrlnvo;s) 2xo(r3nu4alte nvil()a2trxmoou0apt ifctyd a2rluvo;t0arxnmo3tatlmteaieo;(0sexrxm3iy4am  lfesas  rtau  ;t1olen i3iltfaDuluvo t0tleoircty1fm   u il(0 exoim3nydam   fvtl(  Dumumooo1opeo fctydlm2rluvp;(0 lenircty1laDrlnvsl(0teumim3no4lpeelfesasfs2ra(mo;o0optnmietls m umnvont0 ltnmfcoadlm eanvo;t tetmxmpnudap   nvsas  2rm(moou1oeenioeiys sDrmumsnt0trtomr oydfpte n o;s texmxr ou4lp  mfviat aDumxmpou1aex  feiytfm em(msn(0trtrmf3iy1lmtr ivols s2urim no1open nesl( s2rrxmont0alt mictadla2elu o;t) lxrxocia1faD auvolt)teumir nodaltemnctas)aDrrxm ou4olx mietadfa eanmp u4aetnxf3oo1fatrlnesl()srtrim3nu4lpt  feslsfs2tmx pno0tpxoioetltlmDua(mp;u4alxoif3ia1fm r nvi;t0seum(rpoy4aptnmieslsfsrrmumo;t1tex mo3iyt s2elnvs u)tltoif3oydoatranvo;t  rum(rpiu4am n fci t) Duax p;o1texn fciyt sDumums (4 lenif3iotfmDrlnvs ( setrim3iy1ale mnetas) rua(mpou0alenif3ildfmDem(vs u0alenxociydfaDe ivo;( tetoxopny4omt  feiat aDraxm ot1aexoio3ils s rl(monu4teeoir3iatlaDr neo ( t2uoxr iu1al emivs t s2umx pnt0oltnif3tysfm2eluvs;u4 etnmo iotfpt liei s0s2xm(r3oy4lpen nvia()srrau ont0oetnifeilsfs2ean o ()alermociodlp r ieslt)s2xrxr oo4lm emfes ()sDrmu  ou4oetomf3iasfmDrl(vp;t4tleomo iytlatean s t0srto(mpoudlme mivs sf 2rru ont0tpxoiietltfa ra( pnt0tltoxr oodlmtr ieslt srxr(m io4aptemfei () 2uaxr ;t1tlxo ieiysfm2rl( s u4 ltnmo tydopt  ivolt0srumirpny1omtnlivia(faDrm(ro;u1tltn fciad sDemuvont4 etrmr ia1lmDeaueo;()texmxrpio1lpenlivtls  rum(  no4apxo fcildfm2rauvo u)aetrir ta1op elnvs;t0seurxm iu1amte fcsl( aDrm( pnt4oet iieiadls2eluvo (0areomo3ty1fpt lies ()s2xoxmpio4ope lfvia(fa2ta(mp;t4tetn ietad a um(ms u0 rtnmfctatlmDr nei;s)s2xoir oo4ameelieta()s2urum ;t1oeen f3iytfa2eluvs;u0 eermrciytoptr nei;( sexoio io1amtemfesls)srrmur nt0oleo f3iysfsDulums t0 ltoxf oy1opD luvo t t2uriopiu1amtnlnv
\ No newline at end of file
@@ -0,0 +1 @@
+ivi s0setoxm iodole  fcs s)s2taumpnu0olx  oeilsla rmu s;(0tetnmo3iodopDraiei;s)sruoir3ou1opt mneilsfarta(rpnt4teto octys a2em( o;()aexrmr ootoat aivs (0setrxmpiudapeelfcil(fsDuau pot4aexomo3iys m2emu s (4 lxoxr3oadfm   neil(  exmiopny1ame mivs () Drr( ono4tpe  ociasfs2ean s;t0 etrxo totlpD aieo s0 2uoxrpiudop emfctls  2tau o;o4tpt mieildfa uln s;() rtoxo tatfmtraneils0srto(opiudoptn icsat a2tax p;u4aee io3iyt m emuvs t0alxoxf3tadlp rlivo s s2xoio iy1om   netltf 2urur ;u1texn oetasfs2eaums ()trtrxrcto1oaD ai s s0t2urir io4aptnmfetasfs2ur(m ;t1optoifciad a elnvp u0 leoio oo1oat auvo (0seum(o oy4llte fcils a2rm(m nt4teeomictatfa ea( o (0texoxrcoo1fpD anvs t0srumimpio1lmeelnei t  Dtrur ;t1tpxo ieilt sDrlumonu) rxrioctydfm rliei s trurxm3no4ole lfvsl(fsDrrumpoo1aetnmicild a rl(vs ()aetoxocoodlmD  nes (0setm(o nudoleelietltfa2rax p;t1apto oeiasla2um(msn() leniocto1omD anvi;s  2tmim io1lmt  fvtls)srum(rpou4olxnmociytlm ranmpnu4 eerio3iydop eluesl(0setr(mpoo4ap elictls)artr( pou1oeenmoeiaslm rl(vonu4alxoxf3todfp r nvs;s0 etr(rpnudam  lics sf Duru  ;o1aex mietatlm2umuvp u0texoxo3oatlp  li i t tetrim oo4ameemfeil( sDuru poo0tlxo fcild mDum( p t0aetnxfctodomtr nvi (0 rurxm nu4ll n ivslt)sDraum no1aexomi3tyt s2ran ont0texnxo oatfatr nvs;t0trtoxm nu4olenlieilt a2uax p;o1oex  fciltfa2ulu pnu) ltnxr iydfaDrau s t0s2trxo3oo4apen ivtat)arumxmpou1tleo ietlsla ra( s (0 rtriociadfmtraneil(0s2umxo no4alte nvt (  2trx onu1apxnifetyd m2rl(mp;t0alxnxr3iadlaD  ies;s teum(o nodll elnvslt)arumx  ot1opx  ocias aDeluvsnt0 etnxo ty1lpD ai s t trxm(m3ou4omtemfvias s2umxm ot4olx mi3iad sDelnvs;(0 rxnmr3oytopDe iei t)srumim ou1am emnvtlt a2rax ont4aetoio3tysfaDra( pn(4teeoif3iydop   iei;s trtrim3oy4omt  ncsas)a2trxmpnu0tee  oeiat mDua(ms;u)trtrifctytlpte ues;t t2xr(rpoudllenmivtas)sDur(mpnt0apx mocilsfm rln p;u0areoxr iy1fat li s s)teto(rpiy4apt mfci tf 2ta(moou1aptomoeiatfm2ua(mo u0alxrxo totlp r ies;s  rxr(m3nydap emfcs s s2tr(rpou1tlt  fcilslsDranmpnt0aleoif3tatfate uvil()s2tmxr iu1optn nci s artru  ou1aetniiciatfsDrlnvsnt4trtrxf oodlm raneil()sexoxo ny4amen fcilsf Dur(mpnu4oet if3iadfaDrau o u)texoxf3oa1fmt luvs s) etoir oodom   feia( aDrm(mp;u4tet  ictls m emnvont0alxoir oo1faDeaivs;( srxmxopiodalt  nesl( srrmx oou1olxomi3iytfs2em(mo u) lermf tytop  livs s0sruoxmpno1optelfei (f 2uru onu0olxomoeilt s eanmon()tlxoxfcia1om r nvo;t0 etrimpnodoptnlies s)aDrax p;u1optomoetltla raumo;u4aetrif3oa1fp raiei;s)sruriopnu4ap e ivsl( a2ur(r ;u1tpenmiciyt a2rmn s;(4 renif3ta1oa eaivo;s) rtoiopiy4lltn nes t  Dtm(mooo0tptnmocilt aDum(vs ()teenmo oy1fp ranvi;t  eumxm iy4oleemfvtas  Dtaxront1tpxo oeias m2rmn o;(0 etrmfcoy1fate n o (  2urir3oodapeemnciat s2tauroou1opxn ociyt mDea(vo;t0aexnxocoa1oatran s (0trto(o3ou1om emnet t  2rmumpot1open f3tyd aDra( o;u4tetnio tydoaDrli s s trxrxmpiydam emici t) 2urumpnu4olen octadfaDuau p ()tleoxrciydlaD lueilt)s2xrio3io1alenlies ()srrax ont4texn ieild a2uau s t0 rtrir3iytfp rai s s0 rtoirpiu4ll elnvsl() 2urxmpnt1tee moeias a2umuvp (4 rtnxf3tadomtraivi t  eumio oydame lnci (faDurur no1tlx  fetatfm2ean pnt)tlermo iatlat  ivi;t trxrxrpny4ll emics (fsrtmu o;o0texn f3tyt sDulnms;(0alxrxocto1lmDr nvs ()seuoxopoo4apenlnci (faDtmx oou1oeenmfeiysfa2ran o;u4 etnmr3ia1fm eaneol( setrxr oy1olee iesl(  rua(roou0tlxnioeiltlmDul(mp;u4altnmo3iadfa r n i s seumir nudlm   iet s)aruau pnu1apxoifeiysfa2elnms t)trtoif3iodlpte nvi;() 2um(r3oodoptnmfct s)a2tmxront0tltn i3ilslm2uanvpnu4 rtomo3ty1fa raneo;( trxoio3iu4olenmiviasfsrtmx  ot0aee moetysls2rl(ms ()teenxo3iotop elnes;()setmxm nydll  lfcsl()a2ra(  no1apx  oetasfs ulu s t)aetrirctatlmte nvi ()trumxo iy4lpee ivs ( aDrrurpnu4tet io3iadfmDeauvs;u)alxnir3oadlp  livol(0 2tmim iu4oltn iesls  rrr(mpoo4alenio3iatlmDemnms;u0 eerxf3iy1fa   ies t0trxm(m3oodlle  ivt t)srrmx oou4aeto fciasfa2ua( s;t0 ltomfctydlaDr nes s0trtm(mpnudlm emfci tfarururo;u0apt miciys mDem(monu)aeeomr3oydlateaneilt)truoxm oodlpt lfcta(  Dua( p;t1opxn oeiys aDranvs;t4artoxfciadlptrlivs;(0 2xmxo3oy4op emfvi ( a2ur( pnu1tptoifciltfs2rmnmonu4 ltrmo todoat  i s t t2xmirpiydapee ici () rtmum ;o1apt ifeiysfs2ranvs t0aetoxf oytoatr i o;t) rtmimpno4ol n fvilt) 2rr( pot1apt  oeils aDrmu p u)tltrmo ty1fmDe ueo;t trtoxopiodamt lncs s)a2uru oot4oleoiietls aDumuvp u)altomrciodom  li i () exo(m iy1ol  lieiltfarrr(rpnu0apxnmieiytlm ra(vsnu4tlerio3iy1oa elivsls0seumxr oo1oleelivia( artm(  ;o1oeenif3tytla rmumon()alxomo3oydoaD an i t t2xoxm3ou4omte iesl( s2ur(ront1oex micild s2elu o;t0aetrxrcio1lm eai ols)srtm(m3iu1omtemfeia(f rtm( o;u0apx  feiytfa eaums t)trxoxf totom eauvilt0s2xo(mpnydole  fcta()a2rm( pou4ole ioeiadla2ea(vp u0arxrxf3oa1fa ranvs;t trxm(rpou4olee feia()aDuaur ot1tltoif3tldfaDulu p (4arenir3oydfpD aieilt texm(mpiu4lm n fvils  2umuro;o0opeo feiltfm rlnmpn(4trxrif tydlpD  ivo s t2uo(opoo1am  mncta(fs2raxm oo4aptoifeildfs eluvp;(0tetnxoctotomtrliei;t srtr(r io4omeelfes t  Dumxmonu4apxo ieiyslsDem( s t) eeomf iotlaDelueolt)t2xoim oo4ol   fvs (  2uaxrooo1olt  o3tytlaDra(mo;u4 eeoxr totfmt ln sls)trumio3oy1lmeemfcs (f 2umu pot0tpe iictls a2ul(mp;t4artnmfctadfmDrln i;(  eum(m iy1ame lfvi tfa2ur(r ;u0tee  ieildfmDemnvs;t0alxnif totlpD  ueol() 2trxo oy4om nlfctls)aruaurp;u1tpx  o3tat aDem(vs u0 reoxr3tydlatr iesl(0s2ur(o3oodoltemfes s) 2rmu onu4apxniieiat sDeanmo u) lxnxr oy1lmtrlnei;t)teumxm3iydom e fvs s sDum(mp;t4oeen octatfaDemnvo;u0teeomf3oadlmte uvi (0seto(o io4opt miciat artr(  oo4oetnifcildla2emu s;(0trenxr iotfa  lu o t0srxr(rpiudam   ivtatf 2ur( oot4tlt iociytlm2rln sn()aetrmo ootlpDrai slt)trtrxo3ny1opeeliei sfa2tru poo1tlxomo3ilt m rln s t4 ltnxo ia1lmDe n o ( s2xm(m3iodolt mnviat s2ua(rpno4tpeomo3iltla2ean p u)alxoxr oa1fp  li o t0 2urim nodolt lfeiat s2tax pou4olenmieiatfsDua( pnt4 rermociadlptr iei ()s2xoxrpnu4omtnmfeil( srtrur no4oex  fctltfa uauvp (4teenxfcoo1lpDeanvsl(0 2xm(m3iudomenmiet s artrxmonu0tpxomiciltfaDrmn p;(0alxoxr3ty1op  lieslt)s2xm(r3nu1lmt mies t sDraxrp;t0tlenioeiad m2emnmp;t0alxnmr3tydoa  li sl()t2tr(r iodlm emfvia()srtmum ;o0alxo iciytls2ea(mpn(4tetrxf oytfm r ueo s s2xoxrpiydame  nctas  2taxrp;u0aetoiicias s2uauvo;u)tlerirciytom e uvil( sexoio nu4ope mivtls) rta(r ;u4aetniiciatfm umnmpnt)tltnio3tytlpD  nvslt0trxo(rpou1lle lnet s)a2tax  ou4aet if3ildlm umumsn(0areomo oydfa eaivi ( s2xmxmpny4lme mfcs (fsDtmx p;u1tltniociytla ranvonu0 etrmf oo1lm rlu s s setoxr iy1op e fci (f Dururoou0optomi3iyt s2ulnvs;u)tlenio ootfpD li i;()sruoxm nu1opt  nesatfaDrmx oou0openmf3iydfm rmumsn()trermr todoatean i (0s2xmio3io1lp  mivta(  rumumont0opxnmi3iytfs ul( on()trtrxf ia1lpD auvo;s  2xo(rpoo4op  mictat  Dur(roou1tet  ictyt m2ulumsn() ltnmrctatlpD  nei;s0srxo(o3oydlme  fcia( srrmu pnu0optnmi3ilt a2ran o;(4 renmociadla eln i;s0 rum(opnudaptnlfctltfa2tmumpnu1alxoioeiysfmDemuvo;u0tltoxf3ia1om rlnvs;t  rxo(m3ou1lmt  ivt ( arumxm ;o4oee ioeiysfm ulnvs;(0arermf3to1lmt  ivo s teuo(o3ny4amenlnesa() 2rmx p;t4optnmoeiysfm rm( o t4trxnifciotomDr nvs s)srtrxopiudomeemivs t)sDrrur nu1tpenio3ild sDrlnvont0tlenir3totlmtr ies;t  2xrim iu4al elnct ()sDtrxroou4tetnmieilslsDea(vpnt0 lenmr ia1omt  nvs s  2xmim nodolte neiltf Dumurooo0openmfcilslaDulnms;(4 renxr3io1fmtr ueils)sexr(o3oo1omtnmncs t  2ua(mooo1aptoiociatfa ua(vp t4artrmf ty1la elnvi;s0 rxoir ou4amt  fei t a2rruro;t1optoifeiatls2el(vs;u4aleoif ootlmt anvils tetm(r3iy1lp nmfcs () rua( o;u1tptnmi3iatla2uanmsn(4trerxfcootomDelnvo;t)srxrxm3oo4omt  fesl()s2rr(mo;o0apxoifciydls2ea(vp t0trenxr3ty1fmD  uvi;s  rumirpou1optnmneia() rtm(rpno4oetoiieiydfsDulu o () etoxr3iatlpDelnvils  eumxmpou1ale lncils sruaxr oo1opxn feiatla ua(vs;(0teerxf totlatrai i t s2trxr oodll  mfetlt) rra(  no0olx  f3iltla el(vs;u4 ltoio to1oa elueo s) exmim3oo4amen fctltfsDtmu oot0oeenmieiad m2rau o u4 exrmrctatfpDr iei;s) rto(opoydol nlnetasfs2umxr nt0opeomi3ilsfm2rm( snu)arenir iydoaDe n i;()seuo(mpnu1op elicta(f rtaxm ;u4oeeoif3iydfs umuvo t)trtnmfctadfa rau olt0 eurirpnydoltelfcslsfaDumxrpnt1apenmictasls rlu p;u4alxomf iy1fpDelues;(0 rtmir3ou4lm nmivs ( srua( ooo1openifcild m umnmpnu0tlxoir iytlaDrai o;(0 etm(o nu1amt mieil(f rrmx pnu0tlx mfctas mDulu s;u4 lxrmfcoatoa e ivilt)srxmir oydlpt mncsa()aDurump;u1aexnioeiytla ea(vs u) rxoxoctytfmtelivi;t0 etoimpiudopee fvi sf rumxmono0opeo f3iyslaDuauvo;t0trtrmr tydlp eau sl(0setmxopou4lmte ivt tfaDurx oou4oexnifeiad a2uanvp;t0altrifciatlpDraivs s)setmxopiy1amtnmfviatf 2ta(ro;u1aleomfetad m raumonu4altnmfcty1laDraivils)t2xoiopiy1ol nlnvil(f Dtr(  nt1tpxoiieiydlm2rauvs;u) lxnir3oodop  aivs s)setmxopoy4lpenmnvsas  rumu  nu1olx mfetadls ean p u) lenmo iydlateluvs;(0 eum(o3iudome lfeta(fsrrrxm ;u0optnmo3tys a2el( p;() exrmr iatfa eli ol() 2uoxo ou1opt  ics () Durxrp;u0alxo f3iatfa2rmnmpnu4tetoxoctatfaDr n ils) 2urim oy1opeelfviat sDurxrpnt0aeenmi3tytfs rlumo u4aetnxfctadomDe uvs;t  rtrio ou4om  licilt a2umxmont0tpx ifcilt m emuvp (4 exoio3iotoat aneols)sexm(mpou4lp  mfeia() 2tru  ;o0opxn fciys m umnmp;u4 rtnxo iadlaD  i o ( t2tmxr nudopeemnet tfs2rmuro;u4tet mf3iadla2uanms u)arenio3oatoat  i i ( trtmxopnudomee fes t)s2tmu ont0aexoiictltfm2um(mp;t) etoxo io1fmtr iei;s)tetoxr oo1lm emnesls artrxr nt0oetomiciysfmDra(monu0 rxrxociatoaD aues;(0trxm(m3ou4lmtnmfcs sfsrua(m nt4altomi3tytfa2el(vs;u) lxrif3tydomDeai sl(0 exmim ny4al nmnvia() Draxrono4tlt  i3iltfm2ul( p t4altnxrciodlmD luvo;s)t2xoxo3nodalen neia(farra(monu1tlxnmfciyslaDul(ms t) lxnio totlpt anvs s trtmim3oo1am e ncils)s2urxrpnu1tlenmfciys m ulnvp;u4 ltomf oydop r neils)t2tr(r iu4oleelietat a2rmxront0apx  oeils m ul( o t0 lxnmrcta1lpDeli sl( setrxr3oudoltelfetl()aDuau  ot0optn fetytlm2rm( s t4trtnxo oydfpt auvs;s0 eurxr3nu1alenlncias s2umuro;o1alxn oeiadlsDranvpnt0trxnio3io1oatrauvil(0sexrim3ou1lltn fci t  Durxrp;o4apeo octatfmDra( pnt)aexoxr totfa  an ols trxmio no4lpe mncias)a2ta( ooo0teeoiieiysfs ulnvs;u0 reoio3oydfatraiei;t trxmxrpnu1omee fvi ()s2trumont4oet mo3iltlaDuanmo;t0aexoiocootoa   nvs;s0 2xoxm3ou1ol  miesls  Drr(mp;t4tpt mieiydls2um( s;t0 etnxrcta1fpt livo;(0seuoirpoo1lmen nctatfaDtrumooo0olxomo3ildlsDuaums u4tetrio3todlm  aieo s0srxmimpny1aleelfeil(f rraur nt4opxniociytlaDea( snt0texrif3ty1fpD anvi;t0 exr(opiudamte fciltf 2raurono4olxnmoeilsla rl(mp;()trtomf tydlp  li s t t2umim3ou1ame lfei (f 2uau p;u4openiociyslm emumsnu0 rxoxo oo1opDeaieo;t0 2trir3oo4om e ies t)s2rr(r ;u1tee mociad sDem(mp;u)tlenmr iydoaD lies;()teuoxrpiu4apenmies s)arrax oou0tee mociltla2uanms u0 eeomr iadoa e nesls)trumir3nu4om n nes t s2rmx ooo1tpxn i3ils aDrln ont4tltrmfciatlpD lueo s0t2xrxopny1ole  icsl(fs2rau ono1aptniicildfa2emums u4 eerio3oatoatranes;s0srtm(m3io4oltelici t aDurump;o0teeo oeilt m2ranms;(4trtomocoodlat lueols s2ur(m iydalenlictl() 2tmumpnu0opto i3iatfa ul(vp u0 lenmo to1lpt li i s)teumir3ou4amtnlfcia(f rtrx oou0oetn icildfa2el( s u0 lerio3tadlpDe nvo ( srtmim ou1lpe mnctls)a2tr( pnu0olxn oeiadfmDuau snt)tetnxrciodop elnvs s  etm(o3oodll  lfct t srtmxr no0aptn o3tad a2rm(mo;u4aexrir tytfmDeln s;()tetoirpoy4ale  ivsls)sDtr( oou1tpeo i3iltfm ra(vpn(0alxoxoctytlpt ln o s srxoxm3iodap elfei t)aDuau  ;o0olxniiciadfs rl( s;t)altoioctadlm eaiesls t2xr(m3oydal   nes sfsrururo;u0tpe moetlt mDrm( on()tetrmr3iatlm  lneo;(0srtr(mpoy1lmen iei tf 2rmx o;o0optoif3ilt aDum(mont4tlermr3totopDr iesls s2xrxmpiy4lpt mnvtlt sDtr(monu0optnio3iytla rlnvo;(0 lxnir3iy1late u i ()srtmxo nu1lmtn fct tfsrurxr ot4opt iiciltla rmn pnu4aetoxfcoa1lpD  nvi s  etmirpiudlptemfvtlsfsDuaumpnt4oee mociaslsDrluvs;t)texniocoatlm e n ilt) rxr(opnydal nmfvtat)sDumxr ot1tlenif3iyt a uluvp;()alxoir oo1oatran s ()s2xmxm io4lmte ivi (  2um( ooo4olxniociytlm2elu p t) ltrxoctotfaDelivi;s setr(mpiu4ape miesa()s2taumonu1opxo ocils s2ulnms;(0 exrxf3iy1opt aieo (0trum(r3ny4lmt mnctat)sDta(r no1tlxn oetas s2el( p t0 exrxo iotfp elues (0sruoxo ny4lmtn nvi tf 2urxroou4tlx  ociydlm ra(vpnt0aexoxr ty1omteaivsls setrim iy4op e fcs t)aDumx  ;o0opx  f3iyd a2ea(vs;(0teeoxf oydfpDr u i s0 2umir3iy1lptnmfet ( s2rr( pno0tltnio3tydlm2rlumo;t0trtnircoytlaDelu slt) rxmiopoo4aptnlfvia() rraumoou0tex mo3iyt mDea(mpnt0 reoirciadlpte n ilt s2uoxm3iu1omeemnctl()aruaxronu1ope  ociysfs2rau o;t4 lenio3iodlptr ies t0srtoxo3io1olt  fvta() rta(  ou0texnifetysfa2rlnmsnu4 renif3iydlaDraneslt trtoimpoo1lpeelnetat)a2tmumpnt1tpx  ietlsla rl(ms;u)alenxo3iodoa rli s;t) exrxo3no1op  lfvtls  Drm(  oo4openmo3ildlmDulnvs u4arenmo3tadlaDe nvs;t s2um(o3ou4olt mfvt sf rta( oou0altn f3ilsla rl(ms;u)altoxocta1opDraueo;( tetmxm iydlmenlfcias)aDumumo;u1alxoii3tatfa2ua(mo u0teermocio1lmD li i;() eurxmpny1altn iet t)aDuaxroou0alt iieias aDuanvo () rxnir3oadomteln o s0srtrio3nu1lpenlnct (  2tr(rpno0oetoioctad aDrmuvo;u0texoxocoytlpDeluvsls0truo(r3iu4lm  mfvi tfsrrax p;u1tlxomiciydlm umn s;u)tetnir3iydomDr n s;t0srtr(o3io4omeemietl(fa2ra(ro;u1olt mfeils m rl(ms t)aexrmfciatoa r neslt t2xoxo ou4lm   nvtatfsDrm(mo;t4tltomfciasfa ranvo;u4aeenmo3iotlmDraies;s0seuoxrpio4altnmfvs s  2raxrp;o0apxoifciydlm2uanms t4tltoxr oydoaDelneol()texmxo iydamenlfctat srtr( pot1oeeoifetlt a2em( p;t) eermr iadoa e uvslt  2umxrpny1alt lfesls  2ta(r ;u1oexomfciyt m2emuvsn(4 exrxr3tytfp   u slt)t2uoxr3no1ll   nvsasf 2rr(m nt1tptnioetyd s2ranmp;u4texoxo oo1omtrlnvols texm(mpno1ole lietat) Drm(rono1olx moetyt sDrmnmpnt0 eeoxf3oodoa eln s;s  euoimpoo1op nlieils) rtru onu1tetniictltfm eauvonu) ltoio3tydomDr nvsls0 2umio nu4al emfvils a2tmxront0olxnifeiydfs2eluvpnt) ltoifciodop rlu s;t0s2trxr3iy1op   fvi s)sDumur oo4alt  ieiatfa2rl(mp;t0aexrmr3tydfatrluvs;t trxm(opno1lptnlfetlt)s2uauroot1tex io3iytfs2eluvs;(4trxrxr3oytla  luvs s0 etr(mpnu1lle  nvtl() 2uru  nt0apt  ictasfm elu o;t0alxrio3tadfpD luvi;()texmxm ny4optnlfetl() 2rmx pou0tpeomfctyt m ranmp;(4trermr oodomDelies s)s2trim3ny4am  lnvias) 2uru  nu1tle micils mDuanmpnt4tlerif iotlpt an i;(0setr(m oy4llenmiesat) 2truro;t1ape  f3tlsfm rluvp u4tetrio3iy1fat aiei t  2um(o3iy4apte netl() Drm( ont0apeomi3iadlaDrmnvs;u4aexrmrciotop elu o s t2tmxm nudomee fvtls  2tr(mono1alt mociytlm elumo;u4arxnxfcoodoateanvsls s2uo(rpnydlp n ieslsf ruaum ot4optn fetyd m2rl(mp;t4texnxo oo1lp  ai s;t)trtoim3ou4ap nmfcslt) rrr(  nu0aee  fetad m2eau o u0trtrxfcoydoat  iei;t)texm(opoodamtnmfvs tfsrurum ;o1tpt io3iad a emnmp;t4tlxomf3todoa r i o s0 rtoiopoo4amtnlnciasfaDum(r ou0alt  feilsfs2uanmon(4arxrir oytoa r nesl() 2uoxo3no4op   fetls)arua(mp;t1tle ifciadfm2rlu o;(4trtomo3tydlm eaiei;t srtm(opoo4apenmfeias)artru ono1opeo i3iatfm2ean o t0 etomocoo1oaDrluvi;s0srxm(m3iu4op n ici ( s2rrxm ot1opeomoeiyt a umn on(4tetoxocty1omD ai sl(0t2umxr3ou1lp  mfeia( s2rmuro;u1apenif3tad sDrm(vsnu)alerifcia1oaD lnes;t trxoio oodal n nvsl(  2raum ou0opxo oetasfsDem(vs u0trtrmoctytoatrai ol() eumir3ou4al elics () 2rmum ;u4oex  ocilt s2ea( p t0 exomo3iatoatranvil() 2toiopiydapenmfvta()sDrax pou4aleo o3tldfs2rm(msn(4texoio oydlmDe ieo s0srtmim3oy1lpenmiet (fsrurump;o1openmo3iad s ea(vont4 lenio3to1oa rlnes ()s2xrxo3nu1lm  mfetasf Duau ono4tpt mieiasfmDra(ms;(4arxnioctatopt  i ils0seuoxm oy4ame mfeiltfaDuaxr nt1open feils a2ul(vp;u4tltoif3oadomDelnvs ( t2tmxopiudlp nmiesls)a2rrumooo1aptnmoeiltfa rl(mo u0 ltnxr todfm  ai i s)teumxr oy1ape  fei ( sDraxrpnt0opeoii3iydls elu o t) eenif3iotfm elieol(0t2xm(rpoy1ap emnvtas)s2tm(moou4tle  ictatls2em( o;t) reoxf3tadomtrluvils)t2xo(m3oo4om nlivs t s2ta(r ot4ape iietat m2em(mp;u)tltrxocoodfp elnvo;()setmio ny1al   fei t arum(rp;u4optn oeiytlaDranvo;t4aleomfctydlp rln ils seto(rpiy1openmieta(fsDtr(r nt4opeo ieiatfs2umnmonu)aetniocoatlatr ivilt)tetoirpiodlpeemfct (fsrur( pnu0ole mf3ild m eln p;t4aeerxr tydomDr i olt) rxoxm3iodom emicias  2um(  no1tee mo3iyt m2ra(vo (0alxnmoctodlm rlueslt) 2toimpoudap  mnetls sDtr(m ot1altnio3tlsfsDum(mp t0 rtnio3tydfmt liei;t0 2xmio3no4ape  fvslsfaDum(  ;t4tpto feiat m2eanvpn(0texnxfcoa1la elu s;()srtrimpny4lltn fesl( srumu  ;u1optoio3ildlmDrau sn(0texnxfcty1lp eli i s trxmio3iodame mfcta( a2trxmp;t1apxniieiatfm2ra(vo u0aexoxr3oodoa rli o;()srtoio oydomtnmfvsl(farrr( ono4ope mfctasfs2eauvo;t4alxrio oydfat livil(0s2trxr3no1ll nlics s)sDrax  ;t4tleomi3iydfaDeluvs u)tlxomf3ty1oatr i s s0 exo(r3iy4ol emicta(  rrr(mono0aex  oeias s2rau o;(4arenxf iy1opDelnvolt0 2tm(rpnudaptn ictat)s2rrxmo;u1oexn fciyslm2ea(von(4tleomr tydoptr u sl(  rtriopiydlltnlivs t a2tr( o;u4tle ifeiys a uanmo (0tlerifcoy1om eluvi t s2xriopnydomt lneiat)sDuaxm ;t4opxo fcias m uanmo;(0tlenifcoa1omt lueslt)srtm(opou4amt mfct sf ruau  ou0tlxomfctltlm2emumo;u0 etoxf oatfmtrlivo s0 exmirpoudolen fei tfsrtr(r no4oltniietadls2rlumsnu0alxnmf3oatfaD an s ()trxmio3oo4aptnmivsasfsrtrum oo4tlenmi3tltlm2uan s;t)trxnxo iadfpD lnvo;(  2urxrpiydomtn feias)arurxr oo0aetnif3iytfsDuanvs;u) rtoxr3tydom e ues;s0trtoio oy1optn fes t) rurxrono0tpen feiad s em( o;u)tleoxocto1fpDe nvs;( srumxr3ny4om   fvslt) rta(mpou1tetn oetatfm rlnvp u)tlxnmf3oo1la ran s s) etm(opiodap n nci s a2ur(m ;u0optnifctydls2rmu pnu0tltomo3oatfmte u o ()trxoiopnu4lltnlfcsa()srum(ro;o1optnmi3iytfs2rlu p t0aetomfciy1fat  n sls) rxoio iodlpt  fei s  2tmxro;o1oetnmictltfa el( snt)arxrifcio1lat ai o;t0setoxm3oo1amte fvt sfsruax poo4ale  oeiysfaDuanmsnt0alenircty1omD aneilt)seumxm ny4ap nliei t aruru o;t1olx io3tydfs umnvo u)treomr iotla   ieols) etriopou1om  lnvi t  2taxrpno4tpxoiietldfmDrmnms;t0arenmo iodlm rlnei;s) 2tmxrpoy1omte nvtl(f Drr(  ;o0oetoioeiys a rlu s;(0trtrmf3oatfaDe ivi t)setrim3nu1op nmiesl(fs2tmxr no0aex ii3iyt m2ranvs;t4 renxocoy1lm rlnvi;()trxm(rpoydlpeemictl() 2tau o;u0olxnmiciydfm2rmnvp;t4tltoio3tadopD  uvslt) eumxr3ny4olte fct t)srurumpoo0altn icild a umuvpnt4teeomf3io1fmte ivsl()s2xo(m iy4omte neslt)srrax o;u4apx ifeiytfa rlnmsnu4tltrio totoatraneolt)setrxr oy4lp nmfvsat aDrrxm nu4oexoii3iys m2rlnvo;(4 exrir3oy1fmtranei s0 etm(m nydll nmfcsat  rrau oou4tee mocils mDraums;u0treoircoydfatelnvo t)srtoxm oydaltemnctlt)srta(moou1tlxo fetytlm2em(mo u)tetoxr oo1oaDeaueslt0s2urio nudlmtnmfvt (faDur(  nt0aptoio3ild m2el(mp t)aexrif ia1fa  li ol()srto(r3ou1aptnmfcilt artrxm ;t4tle mfetltfaDul(mpn(0 lxoxfcty1la e i s;s0s2toir oo1lmeelfviltf rumu o;o0altniociadlm rlnvs u4alxoiocoodfa  lnvil()srur(r3io1aptnlfet (fsrtmxr nu1olt mictyd sDuln snt)tetomfcoo1lpDe ieo t trtr(mpoo4am e ivtatfs2ra(ro;t1aexomfetlsfm em( o;u4tetnxrcto1oatelneilt0 2tmxr3nodlme lieil(  Dtau  nt1optnmi3iydlaDemu pnu0 leoxr tadoateai o ( texoio3iydll   fvias)sDrru poo4oexnmiciad a2ulu pnt)treoiocta1op elnes;s0trtmim oydolee fvias aDtmu  nt1aexnmi3tlt a umu snt0arxrxrctadoa   ueo;() eumio nudap emnvtas sDumum ;o4tltn icildlaDelnmo u0aleoio3oy1lpDr uvs;(0 rxo(opio1ll elictl()sDumx  nt0apen f3iys sDem(msn(0aexoif tytfm elieilt0t2urio iu1ap n ieta( srumu  ou1oexomf3ilt s2el( o;u0 lenmrcoa1omtr ivilt)srto(opou4alee nctasfaDuaxr nu4teeo f3iltlmDumuvon()aeerxr3tatoa  lnvi;s)t2xoxm3no1amtemieilsf rtaumpoo1aex  f3tlsfa umumo;t0altrio iadlmte i olt)trtrxm3iudoltemncil( s2tmu pno1opxoioeiys mDel(mont) eeomf todoptr ueolt  2tr(r3oodol  lfei (f rumxrp;t4teen fctadfa2ulumo t) ltnxocta1omteaues;()tetr(r oydol n nei (faDur(m ;o1oltnmoeiyd m2ranmonu0alenmf iotomDelivo;t)truoio3iodll nmneil()a2uaumo;t0alxomoctat aDeauvs t) leomocoo1la raieo (0 2xoxopiu4ap  mnvtls)a2taxrono4tle moeiysls2ul(vp () rxrmf3ia1faD au s;t)teurxm oo4altnmnvs t)s2trumpoo4tptnioctydfsDrauvs;u4alermo ta1omD auei;(0s2trxrpoy1lmt  ict t  Durx oot4olx  i3tyd aDea(mp t)tltniociadoa  lneo;(  eurxmpoodlp n ncta(f 2trxronu0olenifeild sDemnvo;(4 exoio oydoatrluvs t0 2triopno1ll nlfvsatfa2raxrooo0aptn fctltla2umuvp;(0 lerio3tatlate neol()t2xrir3no4al  mnctat)sDuau  oo4aetnio3tad aDrmnvonu)tlxrmfcta1lmD aiei;t0s2urio oudop e iei t) rtr(mpot0tpxoii3iatlaDra( s;u)tlerxo iytlpt lues (0 eum(o iudlpe lnetat) Drrurono0apx mf3iltfmDran s t4altnxoctatop eanvi;( s2trxm3no1op elnctat  rua(mpot4aeeoifcias m ua(mp;t)aeeoio oo1lptranvs;( s2uo(rpnu1lpt mfvt t  2tm(r ;t1alxoii3iltls ra( o u)teeoio3ia1fatr u il(0 eto(r3ou1lmt lnvsatfs2raum ;o1tpt  octadfaDel(vp;t) etrmrctodfaDrai s;(0seto(m ou1ol e ncs (faDur(  oo1oltoifciasfs2rau sn() rtnmo3oy1faD lu ols  exoim3iudll n ivi s)aDuaxmp;u4opxomociys a2eanmont) rtomf3totlaDelneslt) 2tm(r iu1omtemfvia() Duauro;u0olxniiciydlmDumumo;t0alxnxr oadoa eaieo s0t2trio oy1optn ivt tfsrrru p;t4oetniictltfs2el( o;()trenif3todfptr nei (  2tmxmpny4lltn nesa()artrxro;u4texnmociyt s2uln on(4texnif3ia1lat  nvslt)srur(m3nu4lmt mfei s) 2rr(m nu0tlxomfeiltfmDrl( s;u4 etoif iotfa eluvo t0 etmir3oudam emnvtltfsrumx pnu1tetn i3iys m rl( s t)artoxr3oatoate neolt0trtrir3iu1am elnctatfs2ua(m ou4ole mo3iltfm2rln o;(0 rxomrcio1optrlu olt  rumxrpnu4aptnlict ()s2trxm oo0alt ii3iasfs2rmnvp t)altrmociydla elu s s0srumir3iu4optemfetas arrmurp;u0tet iieiatfm ranvs;t0tltrxf oy1lpteluvsl()trum(mpiy4op   nes s  rua(mp;t0tpxn o3iasfa2um(ms;u4teeoxr3oydfaDr neslt0s2xm(opiydam n nvta()srumx ooo4tleo ictyd aDranvp;t0aetnmo to1fmt lnesls  2tm(r3iu4ome mfetl()a2ur(r nt0apxnmieils s ua(vont0aeeoxrciotopteaivi s) rxrimpoy1llt  fvt sfaDtmx o;o4aex ifetlt s2umnmo;()artrxfctodopDrauvo;t t2umxmpou1ape mnvtasfaDtru ono0texomo3iydls2rluvo;u4aexrirctydfm   nvo s0srxrxmpnu4lpe  fctlsf ruaxrpnu0tlen i3tldls emn snu)alxnmr3oa1opDeaneils) 2tm(m3nu1lp nlfcsltf Dtmum ;t0texn o3iatla emnmpnu) ltrxrcoy1lpDr nvs;s setoxm iodap n ivi (f 2tm(rpnu0oet mo3tadlmDeln o;() exnifcto1fatr ivs t teurir3iu4opteliei ()a2rmx o;t4oexnio3tlt mDrmnvo;u4tleoir oy1lpD  neolt)t2umio no1lme mfeil()artm(mpnu0oetnmfeiysfs el(ms;t4trxoxf3oatlmt  nes s)t2xoxr3nu4ole mivt sfa2rm(r ;t1opx  i3tadfa elnvpnu4tetnmo3iytla ean i t0t2urim oo1lpeelics ()arra(r nu4tlxnifcildfaDuluvs;u0trenio3iatopDrli s t t2xm(r3oo1ameemfvt t arrrurpoo0aptoioetltlaDemu o u0alxnmocoadfp eluvslt0 etoir oo4lm nmict t  2ra(  ;o4tpeo fetatfm2umn snu0tltnio tatomDrauvils) exrimpnodlmteliesl( aDrrum nu1tlt  f3iydfa2raums;(0 rxoxr3iotlm elivi s srurimpiy1lptn fcs ( sDraxroot4opeomiciasfm2ua( s u4alerxo oatoptelnvo;s srxmxopnu1ol n fci sfsrtmum nt1olenifeild a2ua( pnu)alxomr oodfpD  uvs;()t2tmim no4lp elnvsls) rtrxrp;o4oetnmf3tatla2um(vont)trerir3oo1fp e u o s)setrxo3oy1open ictas) rtmu poo4tpe mictas a2rl( s;(4arxoir3totfmD lnvsls)s2umirpiu4altemfviatfsDrmx ooo1altnioetlsfmDeanvp;u4tlxnmocty1fm rauvols  rtrim nu4ap nmivsa()arrrum ;t4tee iociyt m2raumsn()tltoiocia1fmtranvslt0tetr(m iodop emnciat srra(mpno1tlt ioeils s2raumo;()arxrircoo1omt lies s  eumir iodop emnesl()aDrauroou4apt moctytla em(msnt) eeomf3ty1lmtr n i s0setr(opnu4alee icta( aDur( pot0olto feias a umnvp;u) reomo3oodfp   uei;t0srtoxr3ny4op emfcs (  Draur nu1olt  i3tytlm2uan pnu4aetrxrcty1fa  lnesl( setm(m3nudamtemncs (fs2rmxront1tlxomi3iysfs elnmo (0 renmrciodfa rlueol() euoiopoy4ap  lnci ()sDrru  no0ale  o3tld m2elump;u)trtomr oy1oaDr nes;t trtrio iu1lm nlnvs ( aruax p;u4aexoio3tydlaDemnvont4tlerxfcoa1lmtr uvs (0tetoxrpoy4ole lfeias arraxroou1oleomfcild m uluvo;t) etnmociydomtrai il( srxmxm io4al nlivt s)sDraxrpot4apeomoetld a eaumo;u) lermf ty1laD lneo;s  euo(r oodlpee fvtatf 2raxmo;o4tpe  feiasls2rmu pnt0texoxfcoatlpt  uei;s s2ur(r oo1alte nvilt) rrax  nu0tptomfcild mDum( s;(4aeenmocio1omte ieils)t2xrxmpio4ame  ivtl(fsDrmu oou1aexomi3tyslmDeanmpnt)altrmf tydlpDrluvi t0srumir iu1altnmivsa(farum(  ;o4oeeniociltfaDrm(vo;(0arxnif3ty1fa  li i;t teto(r nodap e ncsat)arrr(r ot1aeenifcildfa ean s;t) lermf tydop   uvo s s2uriopny4lp nmivtl( aruax ono1optn fetyt m ranmpn(4texoir3iytfptraivols  exr(o3nu4ll elnvia( sruaurono4apto f3iydfm2rluvp;t0 exoxr3iytlpD luvi t setr(mpio4lm nlnet s sDtr(m nt0aexn ietyt mDeanms u)aeeomocio1la   ieo;t) rtm(opou4altnmneil() rurur nt4alenmociydlaDeanvo;u)tleoxo3iadlmtrau ils0 2xriopoydopeelnesat aDrruront4aptnifeils a ua( snu)aexnxo ia1opDrlnvo;t  rtrir oydlm elnvt t) rururont0oexn fetys s2uln p u0trxrxfcoadomDraivs t0t2xrir iy1al  lfeiltf Drmxrono1altomfciyt sDuluvp;u0aexomocoo1omDranvilt  rxm(opou4ome licsasfa2rmu o;o4apeoif3ias mDulnmo t0alxnxoctadom  anvol() ruo(m iu1lme  feilt) rrmumo;t4texomfeiaslm ulnmo u4tltnif3oydlmD au slt0trurxo iodomen ies ()sDua(mpot1aee iociad a2rmnvo u0areoifciydfaDr n olt0sexr(m3iu1ome livsa(fsDrau  no0aee moeils m eln pnu)tlxoxf tytfmD lu slt srtmxrpnodlpt  ies t)aruaxmpou4oex  fctat mDea(mo;()trtoif3oy1faDeau o;t0texmxr3nodlmtn fciat  rrrx  ou4tee mfciadlm ea(vpn() rtoir3iy1omD anvs;s  2trxrpiy4ole  nviatfa2rm(mo;u4aptnmiciysfaDumumo;()tetrmfctotoaD liei;t) rxrio3nydam elfvsasfsDumxmpot1opt iiciad mDumnmo;u0texrxo iodfp  aies t)teuo(r3no4oleelncta(f 2trur nu4apenmfeiaslm umnmsn(4 eerifctadoatelnes;t0trur(r3nydame mnvtltfsDrm(  oo0olxniietasfa2umumsnt4 rtnio ta1fp ran o t)texm(o oy1llenlfvt sfarumumpoo0teeoio3iytfm uln pn() eenmr oodlpteaueo;(0 rtm(o io1ll e neils srta(m ;o1aexoif3iadfaDelnvs;(4aeeoxo3iydom eli o s) eurxr iodomeelnvilsfsruaum ;t0teeoif3iatfmDua(vs (0trenmfcta1lptrluesls0srum(r nodopee icsat  2trum oo1olxomfctyslm ul( o;t) exomr3iatla e n o ()t2trio3oodoltemictlsfsDtax o;u4aleomfeiydlm rmump;t4tlenioctotlm eaieo ()srxrxm nu4ll elnei () Dtmxroou0tetnmoctatlsDra(mo;t4 lerif3oadoa elivi;s) euo(opnu4lme lfeilsfa2umxrono4tpx  ieilsfs2rmu p t)aeenif ty1la eln o;s) eumxopiu1omeemivi ( aDtr( onu0texnif3iydlsDrm(vp;u0tetrmoctydlateau o;()sexriopoy4ome lieilt sDra(mpou1alt mi3iys aDrmu s;()arerif3oytoa eln ils)t2xrxo nu4ll elnviat  Duax p;o4aex micias aDem(ms (0 ltoif ootopt  ieo t)texrimpiy1ol emiesls  rrmxronu1oeen i3ild mDra(mon(0 etnif oy1omtr ues;t teurxr3iu1lmen feils  2uaxmp;o0olxo feiltfa el(mp t4artnmr ootla ran i;s)trxmiopoo4amt  ieil()srtrumpoo0alx mi3iatla2rlu o;u0alxnmocio1fm  lu s;(0t2xmxo iu1apte feta( s2ra(  ;t1oltn o3tlt mDrmu o (0 rxrxr3ootlat livs t  exo(rpoy1olt lici s) rtrxmont1aee  i3tytlm uanmsnu4 rermr3todopDean o;(0sexm(m oo4aptn iesat) Drr(rp;u1tle  f3tld s um( s;()aetnxociadfptr n o;t)trtrxr iy1omtn ncsatf Dtau p;t1aex  ietys a2rlnms;u) lxnxfcoo1oatr nvols  rxrxm nydap nlieta( arraxront4apx io3iydlsDrluvont0trxnmo oadfptr nvs;t0t2uoim3nydalt  fei t)artm(r nt4aeeomi3iasfa ulnvs;u)alxoirciodlaD  u i ()s2xo(r iy4lltnmfvs (  Drm(mpot0optniicild m eanmo;(4 eerif tydomD aues;()teuoxm ou1am nmfet (fsrra(monu1tltomociltlm eaumsn(0tlenmo ty1lmDranvslt)texoirpoodaptnliesltfsDumu onu4tetn icilsla ua(vonu4 lxrxociytlaD  nvil() rxo(r3nodolt lnvsl(fsrtm(rp;o0tpeoifeildfsDul(vp;(0alxnif3tytla  aieslt0t2toxo3ny4aptn icilt)s2ururpou1aexoii3ilsfaDem( p;t)trxnxfcoa1oa   ivi;s s2tmxm3iy1amenmfvilt) rur( o;u0tltnio3iad sDum(vp (0altrif3oytfm elueils trxmirpno1lmee ncsl()a2taum oo0olt iieiltlm2el(ms t) rxoxo3iodlpD an il( s2xoxopiodolen nvtas) Durxm ot1oltoifctytfs umu o u4aetomo3oa1oaDran s;s)t2xm(mpou4lp   ivs s  rum(  ot4alxoii3tysfa2eanvo (0 eenxrcoo1fp eanes;()s2uoiopnodom nlieias) 2rrxmpou1aexnmi3iyt aDeauvsnt)artrxrcoydomD aueo;s)teuo(r no1open fcslt)arta( pno4ape  i3tadfa2ulnmp ()areoio3totlmte nvi;()truo(m iu1opt  ivs ()a2ta(rp;u1opt ioeilsfs2rm( on()tlerxociydfmDr uvo;t0s2xo(r nudaptnmneias)a2umx  ot1tpx mfeildla ua(monu0aexriocia1oa eaneo;(  rxmim oodolenmncs ( srur(mp;o1tlx  fciadfs uluvs t4altnifcty1oa r uei s srtmiopnydam nlnesltfarrr(mono4tetnmieildfs rlu p;u) lxnmo iadfmDean i s srumxo3oodape mneiasfsrurxr no1tlxnio3ildlsDua(ms;t4texnxf3oa1oat  uvi t0 exoxrpoo1openmnvsat  Durxrono0aex ifctat s uauvs t) etnio oodomD lnvsl(0s2umim3nu4ape lnvia(f Dtmumpou0oee mfeiaslaDra(mo;t4aeerir oa1omDrlues;(  exo(o no4amtnmfcsl(  rua(  no1apeomi3iydls ua( s;u)aetrmo3to1fptr uvslt) 2ur(o3nodaltemncs t) rua(roou0aleoifcildfsDuanmo u0 lxrif iadoaDeaneol( t2urxr3io4am  lfvtlsfsDum(mono1oexnmf3ilt m ulnms ()tlerir iy1oa raivo ( srumim iu4olt  fci s) rtm(mo;u0tptomf3tasfmDrlumpnu4aexnxocoytfptr u olt0 euo(o3iydome  fetl(faDtrxrpou1oee  ociatfa ul(mpnt4 rxoxr3oo1fatelnvi () 2toxopnu4op   nvta()sDrm(mo;u0oet if3iadfs2ea(mo u)trxrxf oadfptelues s)seto(opnu1lpenlicsa()aDumu  ;t4aeto fcild sDea(vo (0arxrmrciytomt  i ol() rxr(opno4lpenlfvt tfsrua(r ;u1aet  oeilsla2uln snt0altoif io1opD au il()trtoxopno4lmtn fesls s2urxr ;o1opx ifciadla el( p (4 lxrmr3iytlpt lueols0seur(mpoodalt  nvtlt  Drr(ro;o0oee  oeiasfs ul(mo t4 rtnif3to1opDrauei;(0s2uoim ny4lptnmneils) rtm(  oo4aetomoeiysfm2uau o;(0aeerio to1omtr nvil()srtrim3oo1ll emivs ()aDraum ;t0tlxnmfetysfs emnmo t) etoifcootlm  lu o;t0t2ur(o iydlptnmietatfaDumurp;t4aex  f3iysls rmu ont0 etoio3tytlpD au ils) 2toxr3ou4amtelivsat srrm(mp;t4olt ifeiys a ea(mp u)tltrirciytlpte n ilt0 2xoxr3iydllt  ncsa()aDuaxr oo4tpxomf3iltlm rmu o;t4tetrxociotfm rauvo s0sexrxopnydlltnlnct tfs2ra(  no4oeeo fciasls2elumo;t4aexnxo iodoaDran o s)trurxo no1lmee iciat)arrmum ;u1tet iieiasls2rm( o t) rxomocty1omDelueol(0tetm(o oudopenmfcias  Dta(r ;u0oet moeiyt s emnvs;(0aeenxf3iodlaD anvil( seuoxrpiy1lltn nvt (f Durxmo;u4oeenmo3tytfa rmu pn(4 etnif tadlmte n s;t0 2um(r oy1apen nvsat  rumxr ;u0ale  i3tlt a emums u)tltomo ootoa e nvilt)truo(rpiu4lltnmivtls s2uaxrpno1olx mf3tys s eaump t0 etrmrcoadlpDe ivsls0s2tr(r3nudap e neilt)sDtmx onu0tptnio3ils a2rm(vo t)tltrio tytomD  n ils t2um(r no4ll  livsas s2raumpoo4tpx ifetldla ul(mo t)texoir oadfp r u s ( srto(opio4lmt lfvsasfs2ra(mp;u1ole ioeiltlm2umuvs;t0alxrmrctydopt anvi;(0 2tmiopio1llenlfvt ( arrau pno0alxnmo3tytlm ul( p (4tlenxf ia1fpt ai s;t0srxo(m3iu1oltnlneslt)s2ta(mpno1tpx mieiyt mDrlu ont4tlerxr to1fmDe u i;s0s2uoir io4alt lfciasf Dtm(mo;t4alenmi3iatfa em( s;u0 eerxfcoytfa ran ol(0t2urim3ou4lleemieia()a2umumont1tle  f3iatla2rl( s;t4alxrir io1faDrln i (0 rxrim3no4ap  lncta( sruax oou1teeniiciltfsDel( s;t) etnmf3tydfp eliei s  2xmimpnydal nlnvi sfsDtax o;u4aee ifeilsfm2um(mo (4alerxrcoa1opt lnei s0s2tr(m3ou1alee fcilt)srtaur nu0tpe mo3tad mDua(mp;u)arxnmfctotla  lies;s)trurxm nu4lleemivsat  rtrurpot0tpe ii3tyt a2umums;t4artrxf3oytfptrlieilt)t2xm(r iy1ameemictasfsDum(moot4apeo ictat a2eauvo;(4tltrxf iodoaDrlueil()srtriopou1lltelfeia(f Draur oo1apt  fcildlm2rluvs u4arxrxrciydoa e u i s0srtrxr nudom nlfet (fsrrmxr ;o1ope ifciytls2um(mo;u0trxrmf3to1lp r ieo (  exmxr oy4lle livsls)srtax  ;u0oeeomi3iat a ul(vonu4artnifctytoat lues ()texm(m3no4lle mfcta()aDtmx onu4open o3ildfa ua(vp;() lxomf3ty1om eau olt  rxm(m3oodlptelivsat)sDtmx pnu0oexoiicias sDem(ms;t) leomrcoatlmD luvilt0s2to(o3nudamte ict ()aDrr(  no1ale  fetysfm umuvsnu) leomr3tatfpDrln ols s2um(m3oy4opee fvs s a2tm(rpoo0altoifciydfs rlnmp ()arerxr iodlmDrau s;()srxoir3no4ame mivia()a2ra(m no0tetoii3ilsfsDelnmo;(0tlenxo3tadoa  lu sl(  exmxo oy4lmenmfeils) rumxront1aetomoeils s um(mo;t0aleoxf iadfaDeliei;t0 rxoim nu1lpt mfeils)a2umum no4apt mi3tld sDrl(vo u4alermo3tadlp raivo s  etrio3io1lm nmicias sruru pot4opeomfetytla rmnvsnu0aetnxo3iy1om e ivi;( seurxm iy4om nlicsltfs2raxrpou1tltnif3tas s rl( o t4texrio oytomDrlu olt s2xrio oydoltemivt sfsDtru  oo4apenio3iat m2emnmont) exnxf3iodfa eanei;t0s2xmiopny4lpenmfvtatfa2rrxm ;u0ape  fcilslm ea( p;t)alerxo oo1lp elu s s)sexm(mpny1omeelfeslt) Drmxr ;t0tpenmfeiydfa2ua( p (4 exrmocoadfmDeau s ( t2xmxmpnudapt lfvias) rurxrono0alxnmociytla2eanmpnu)aexrio3to1fpteauvs s0trtmxopou4opeemivs ( s2trxr oo4aetn ieiydfa2rlnvp;u)texnio3oo1lm  aneils0texm(r3io1opt mfci s a2ta(  nu1olxniieiadla2em( pn(4tetnxrciadfa e ivi;t seuoxm3nu1lptnmiesas) Dur(m ;o4teenmf3tysls ua( p;() lxnxr iotlmDrln i s sexo(o3nudom   iciatfaDtrxm nt0open f3iad s2ranms (4tlxomfciotomDeaneo;() 2xmxo iu1ol nlnci sf Drr( p;o4opeoiiciadlm rluvsnu0 exnmr oytlmt  uvil(  etrir ny4om  lnvtasfs2taur ot1tlt iiciytfmDra(mo;u0tetrir oydfpDr nei;(0texrim3no4am nmiviasfsDuax  nt1alxoiietat s um(mo u) etoif3oo1omtr ueilt s2xm(m3ou4am  lnvtlt s2rau o;t4oleo fctyslm elums t4 rtriociy1laDrlivo (0trxoxm3ou4al elnvs (fs2ra(m ;t1oltnmi3tadfm2eanmont)tetnif tytfpte ueol(0t2uo(mpiy4opt liei tfsDuaxr ou0opxoiocils a2ulnms;u4 eeoiociotlatr neo ()trxoirpnodop emnctl(farra( ont0apx mocilsla2ulnmonu4 etoir oo1lpDeaivs;s)s2tmxm3oo1ape lnetas)sDrau ont0tpt moeildfs ra(vo;t4texoxf3totomDeai i () 2umxr nudamtnlfcia() rrax ont0tetnii3ildfs ua( o;(0 lermo3to1fmt aues s  rtoim iu1om emneta(fsrrmxrp;u1olxo ietlt m eluvo t)alxrxr oy1oaDeluei;t0seuoio no4opte fvi t)s2tm(ro;o4tet  f3tys m rm(msnt)trxrxr3oa1fm  aieo ()truo(r no1amt mnvtas)a2trumoot4tlx mi3tytls2elu s;u0 rxriociytlm ran i;( s2xo(o3io4omtnlnviatfa2trum ou4aet iictytfs2rlums t)altoxfcoadlm  ln ils srtoirpiudopeelieil()sDurxrpou4alx io3ils mDumu snt0altriociotfp elueo;s0s2ur(m3no1lle mics t sruax  ou1aleo ociytla elnmp;() rtoxr3iatlp e i sl(0texrir3iydll  lnei s sDrmu  ;u4texnifcilsfa2ran p ()trxoxf oodlpDeaues t) rtrxm3iy1lp  lici s sDrr( onu0open i3tat m ranvon(0texnxrcoytoatelueilt setrxo3iydlm nmieilsf Durxro;o0opxo ictydfa2ulnmsnt0alxrif oodoatraueol( teur(r iu1ol  lfvtlsf Dtmur ;u0tle mictlsfa2ea(mp;u4aetomo iadoa   i sl(0 2tm(mpiy1amte nvtat)artmur nu0apto o3tasla2rmnvp (0artnxocia1lpte ivsls0t2xr(opnodll  mfctasf 2um(  nt1tpeoif3iat sDrlu o t0aexnmo3to1lmD livi;t seuoiopoo1amt lfvs () 2umurono0apto ictls m umnms u0 leomr iy1omDranei;(0 rtrxo3oydlmte nviat s2rrx  nt1aeen fciys mDel(mp;() lxrir tatoa eln il(0seuoxo oo4oltemnvs s a2uaxm ;o0oleoio3tltfm2um(vsn() lerxf oa1opte i i ( s2uoiopiy1olenmfesa(fa2ur(m ;t4tlx ifcils a rmuvo (4 rtriocoydfptrluvs;s) etoio3oudlmeemncia(fsDrau  ;u0opxnioeiytfaDrmn o u0teenxf3iatfpDrauvo;( texr(o oydlptemnvt ( a2urxr nu4tlx io3tls m rmnmp;u4trxnircoa1fat aueo ( t2uoxm oodop e nei t  Duaumpot1aptnio3iydlsDeluvs u4trenmo iytla e uvs s  ruoiopiy1om n netat  Dtru ont1tpxnmo3tldls elnmont0 eenircto1faD  u sl(0trxrio3oy4ome  fvt sfartr( pou4alx  fciytlmDuanvsnu) exnio iy1lm  ai sl(0texo(rpoodomee ncsls srurxr nu1ape  oeiysfs el(msn(4teenmo iy1fp eau s (0 rxoim3iu1aleelnvi tf Durx ont1tptoif3iadfa2rlnmpnu4tetnxrcootfpDranesls0 eum(r3nodlme mnvil( s2trur no4oleoioctatfaDeln p t0 lxnmo iadfa   u s;s)t2xoxm3nodame liet ( sDrrx  nu1aptn oetlsfa2rmnmp;u0tetoxrcia1fpt ai sl()sexmxr no1openlnet ( sDrrumo;t4teto ietls aDumums (0arenir ootfpDrlivo (  etmxm3iu1lmenlivs t) 2urxm oo0aleomfciatla emnms t4altoir3tadfp  lies (0 rxrxmpiydlp nmfcias aDta( o;u0olto icias aDumu ont4arenxr tatfmD aues t s2uoxo oo1lp  mnes tfsDrmx poo4ope io3tad s2ean o;t0 rxoir oo1opDe uvsls0 rxrxopnydlmt  fcs (f 2tmumo;u0alxoiiciat a2emu s;t)artoxo iodoaDeluvolt srtrimpiydlle livtatfa2tauroou4tpxomfciydfs ea(mp t0 lenmo oadoatrluvs s s2umxr oo4al  lfetasfs2uax oou0oexnmicilsfm2uluvp () eenxf3todlat  ies;( sexoxm3ou1omt micia(f Dum(  no1aleomo3tydla umumo;(4tetnxr ootlp   ivs (  rtoirpiy4lpee neia()s2umxrp;o4alen i3iydfmDrmn o;t4 lerioctotomt  uvo t0t2uoxmpnu1altn ivt t  2trum ;t4oex  o3iytfm ra(von() etoio3iy1opDeaivo (0s2xm(o3oydameelieils)aDtaxronu4aet ioeils m rln snt0 lxrio3tytlmDeaieo t)tetmirpnodlptnlnctat  Dumxroou1apeomfeiadlmDel( sn(0trxnio3oy1oaDrauvo s) 2xmio3ny4omt  ies t)s2tax  ;u1opxomociltlaDum(vpnt)trxrxr3to1fmDe i sls  rtmxo iydlp elieiasfarrmx  oo4opeoifeilslaDelnvo (0 renmf iotfateaivi s0 2xr(m3ou4olee ies t)aDrr(m ;o4tlx mi3iydfs2uluvp;(0 ltoxrcootfm raivi;t  rto(o io4ome  ncta( a2tax  ;o1aptnmoetat m emnmont0trxrif oo1fpDrlueols)srurxmpoy4al  lfciltfaDuaxmoot4tpxoioeiydfmDea(msnu4alxoxocoytomt ln s;s0s2uo(m3iy1ap  lnesa( arrr(mpou4aetomf3tasls2ranmo;u0tltoxo tadfmteaueils0 rxm(mpio4amt lics ( aDtaur no4tpe ifciaslmDua( s;t4teeoio3tydomDeauvi (  exm(m oo1oltnmfcsas) Duax pou0ope moeiyd m umump;(0tlxnmf3totfpDeai o;s trxmxr3ou4al nlnesls)srtrumooo4opeoio3ias sDulnvs (4aeenmr3todfa r neo;s0s2ur(m3iy4alenmncsatfs2ra(m ;t1aleomictatlsDumnmp (0trenmocia1op r nvs;t)srur(m nu1llee nctltf Duaxm ;o0oltn i3tltfaDemumo (0arenxf ty1omtr u i t0 2ur(m no4llt mfetltf rtaxmpno1apeniiciyt m rm(vs u)arxnio3tytfm r ueilt)srtrxopiy4lltelivsl()arumxmont1openiociyd s2eanmp ()arxomf iydlp eluvi ()trxoxr3iu4opee ivt ( sDta(mpnt4olxnmf3tas a umnvs;u0altrir oa1fm rlnei;t)s2xmxrpnu4llt lncta(  Dtmumo;o0olenmf3iytlm ul(vs (0 renxf iytfm elieo;(  2urxm iy1apte nci t s2trx  ;u4ole mociysfa2eluvpnu)tetnmocootoaDeluvils)s2toxr3nu4aleemfcsas)artrum ;u0alxnii3iltfsDranvo;t)teermociodlaD luei;s t2umxm oy1opt  ivtl( srururooo0oeeoiociadls2rl(vo t4aexnmf3oytopteanesl()teum(o io4altemnvi (fs2taxroou4texn oeild m ranvon(0alxoxrcio1lpt aiei;( trtrio3nydll emieils  rrrumono4alxo ocilsls ua(vp;t4aeenir tytfpDrlnesls)s2xmxm iu1om emicsat)a2urum ;u0aptn ietls s el(vp;u4 leoxr ootlmD luvs s)seto(opiu4ll  mfcs sfa2um(m ;t1opx moctltlaDemuvo u)trxoirctatfm   neilt trumio3iu1apeemnci (  rtru pnu0aetnmf3ilslm2rlnvsnu4 exrio ootlp  lnvi;t)t2uo(opiodam  mies sfa2trum oo1olxo o3ildlmDumnmo ()aeerxociytfaDelnvs;( setoxo3no1ol  lfetls s2uaxrpnu4oltnii3iys a ra(vo t4 ltnmrctotlp rai o;(0 rtrirpoydamtelnes ( srrrxmoou1oeenii3tatfs2ran pnu0aeeomf oatlmt li o;s setr(r3nudamtn fcsls) rururono0tptomieiltfs2ea(ms ()texnifciydlaD  u il(0 rxm(r3oy4olt mfcils)srrrurpoo1oeto o3ildlm2rmuvo (0artnmoctytlmDe uei s0s2tr(m3iu1om e fvi sfs2rmxr no0ape mo3iltlmDrauvs t) lxomr3io1op rau o s) 2umxrpno4olte net tfsDurxr ou4opxomf3ilsfm2el(ms u)arenxocto1fpDr ues;s0 exr(o oodal   feils  2urumonu0oeeomi3ildfs umn ont0altnmfcoadomt  uvslt0teto(mpoo1ale  fvsa() ruaxrono0opxn icilt sDra(mp;u0trenmf iytlp   neo;s) rxmim nodom  lfesa()arumxr ot1tltnifeiyt s2rauvs;u4arxrmfcoatfmDr nvils0 2uo(r3no1olt lneiat  Duaxmo;o4tlxnifeiad m2em(mpnt0tetomo3to1faDelueols srtrxr iy1optn nct sfa2rmxmp;o4texo octatfmDuanmpnu0tetoxoctytfmt li il(0s2um(m nodomeemfcias srrm(mpoo0aptn ociyd m rm(mpnt)arxoxf to1lpte n i s s2tmxo oo4lpte ics ()sDrmurp;o0tet mfciys a rlnmo ()trermf3todopDe ues s s2tr(m3iu4lptn ietls  Dtmxmpnu4tlx  icilsla2elump;u4trxrifcootlp rluvi s tetm(r3oy1omt  ieils aDrrur nt0tlx mfciytfa2el(vp;(0 exnxociotfm  au i;t  2trir3iu1ll n fvsat  rumxro;u4oexomo3iys a rmn o t)aetrifcty1latr uvsl(0s2ur(r ou1oleelivtl()aDrm(  ;t4opxomiciatfa um(vpnu) exomrciatfmDrln o (0sexoir3iy1lm nmiet t)arrr(  nu4tltomictatfa2ean s (4tltnif oytopDelieo (0texmxr3ny4llt mnvslt) Drauroot4aetomicilsfmDemnvpnu4artnxf ia1op eaieo s texrxmpnu1oltn fctlt)aDtruro;o4tle iietldfs2uluvont4trxrmrcoydfmDe nvsls teurxm3iudamt mfes (fs2tmu o;u0texnmf3tadla rm( ont0alxrmr todfpD  u ils0 rxo(r io4omeemnct t)a2rm( pnt4texo fetytlsDemnmsnt4trtoifcoo1oateanvo;()t2trim3ny1opt mfcsas  2urxmpot4aleomfciad sDemnvo t)trxomoctytfm elnes t)trtm(r ou4lm emfvt tfsrrmx ooo1aptomfcildla el(msnu4aeeoxr3ta1fpt aueols) exriopio4apt  ies tfs2urx  no4tptnmiciaslsDulnmp u4tltnxf3iytfa rlueils t2urxm iu1op elivs (faDum(r ;o0oltnio3iatlm2uau s;()aetoio3tytop e n sl( trumim3iy4optnmivils  Dtrum oo4apxoif3tadfs emnvs (0 lxnmr ia1omDrai o;s0teuoiopoo4olte netlt arurxmpoo1oltnioctytls ran s u)arxoiocootoatelieslt srtmio3nydaltnmfvias  2rrxrpot4aee mfeiydfa rl( o t) exoxf iotop  ai ilt)trtrxo3iy4ape micslt)srurxmpoo4alen octlsfs uln snt4 leomrcio1optraieo;s t2tr(o3nu1llen iviltfsDtaurooo4apen ieiys a ea( o;u4 exrmo ty1lmteanvi t) exmim nu4al nlnvsasfartmx  oo1opxo ictydls2emn p;()treoxr tydla r neilt) exrxrpio4olt lfvils)s2taxm ;o4tpeoii3iys s rmnmsnt0tltnmf ty1opDelnvo;t0s2umirpoo4omt  nvt ()a2uaxr nt4tpt moeiydla2em(monu4texnxrctytlpDr u o t  2urirpiy1lm emfetat)sDtrx o;o0oeenii3ildfs2umn on(0alxnmr3oodopteliei;t)seurxo iu4llt  neilt  Drm(  ;o0aexnmiciatls ra(vp u0artoircto1fmt aiei;t)s2urxo3oydolt lfvt s  2tax pot1tetnmocilt m2raumsnt0artoxr3tytfpDrluvs;s0trxoxm
\ No newline at end of file
@@ -0,0 +1 @@
+u s t0srxoiopoy1oltnmnei (  rtm(mo;o1alt io3tysls em( o t4 lxomf3totfateaueo;t seumxm3nudomen feils) rrmx p;u1aeto iciasfs ea( p t0aleoxo tadlm ranvs (0seuo(rpiy1am   ici t)s2rr(rooo1tee  fetytfa rm(mp;(4 lerxr tatlat  ieols0t2xrxr3oydol nliei s aDuaxront1apx mfeilt aDrmnmp;(0 etrxocootlp rluvslt0sexr(m3io4optnmnes (faDtm(mo;u0tpeoifcildfs2uau p (0 rtnioctydop  au o (0 2tm(r3no4amte fvia( arum(r ot4olxomieildfmDemumsn(4altrmr3oa1lmDraieil(  rtr(r3oydamtemictlt aDumu p;o1tlt miciys a ra(vp;()arermr oatfptrlueolt0srxmio3iy1lmtn ncs s) Duaxmo;o0oexomf3ild m rmnmsn(0aexriociadfa r i o;t s2xr(m iydop   nes (f rumur ;o1opxnioeils a2uluvp;(4alenir3ty1la eanesl( srum(rpnydlmtn ivt tfsDtr( o;o4tex moeils m rlums (0arenxrcoydfa  lu i () euoim nu1open neta( artr( onu0oee iictyt a umumsnu4 eeoiocoytfat aneo;t trurxr3ny4ap emivtlt aDraxrpou0tlen icilsfm2umumo;t0arenmr3todfpteliei;s t2umxo iu4alen fvtltfs2tauroot4alt  f3iatfm2rm( p t0teenif io1fmte iei t0srum(o3iudapee icsat  rrmxmoot0aetn fciyslaDem( p;t0trtomo oadomtrlueilt texmxr oy4om nlfvsas) 2tmxr ot1alenmo3tyd mDuan p;t0tltnif iotoaD  n ols)s2xoxo3oy4apenlfcslt)srurxmoot4tetnio3iad mDeanmp;u4 lermf tydlmtr i s;() 2xo(r3oo1ol emict t)aDurx  ;o1tleomieiytla2uanmp;u) ltrir oadfm r neol(0teumxm3iodapee ieilt)aDrm( p;t0tpx  f3tydlsDum(monu0aetrmr3iytoaDr u o;(  rur(o oudopenlfetl(  2tmx  oo4aeenio3iys s rlnvp;t)altomr io1lmDelnvols)srtrxo3ou4open fvia(fs2trx o;t4aexoiiciyt a ranmont) eerifcoatlmD  i s;s tetmim oo1llt mfvslt aDraxrpnt4apxnmfetlt sDeln p;() reomrciodlmDe uvils sexo(r ou4lp nliei ( s2trum ot0tlxnmfetat a emumo;t4 exrmr todlptrluvilt0 2tmxr3oodole mnvtas a2umxro;u4opxnmociysfs2emuvpn(0tlxniociodopDeaneo s  rtmxr ny4omee icsatfaDumu p;u4oexoif3tysfsDrl(vp;(4aeeoxr3iotopte ies ()t2xrxo iu4amenlics tf 2urx  nt0tlx  ociltls rmn p (0treoif oodlaDrlu i (0 2tmir oo4am e fvsls)sDumumpou1aptniietad a eauvo;u) lxrxf3iytlp  lies s0s2um(rpoo1lle  fcta(fsDtaxmooo0oexomfciysfsDem(vs;t0 eenir3tatlmt auesl(0 rumir ny4aptemneiltfs2rrurp;t4tpxn i3iad sDrm(vo t4altomo3tadlpt anvolt0 rur(r3ny1olenmnvsa(fs2uaxrpnt0opx ifeias sDelu snt)texoifctotla raivol()seurxr3ny1ole lncslsf rtmxr ;o4oexnif3ilt a rmnvo;(4 renxrcto1lpDeanvslt0seto(m io1opt micilsfarrrumo;u0alenif3iytlaDeaumpnu4trenio3tadlmtrliei ()t2xr(opiy1omtnmnvs ( srtaxmonu0oetnio3tysfm2ran pnt4 lxoircoy1lmDelieo (  eur(r iudamt mneta(fsDtr(mpot0opx  fciytlm elump ()trermfctatoaDraieilt)teuoxo3no1ap e ncias s2trx ooo4olenifeiyslmDem( p;t)tltoif ty1omtr ues (0s2xoxopoodlpenlivsl() Dtmumo;u1tlx  ieildla ea(vp;u4arenxo ootfmtelu o;(0srto(r3iodlmtnlfcta( srua(moot4alxo ieiadfm rmn s () eerio ootop   neo;(0 rxmiopiy4ale lnviat)sruau ono1optoiicildfa2rmums t0 exoxocto1la elnes (0 exoxr3nu4lp  lfctas  ruaxrpou1oex  fctatla ulnmo u0aetnxr3oatfm  liei (0srxmxopiy1oltemiciasfarururoot0alx ifctytlaDumu pnu0 eerxf3oo1laDraneols trtmxrpou4ol emivta( s2uau poo0oet  ietadfsDuln o u0artnxf iatfa   u ils  2xrxmpiodapenmfeslsfa2taxmoou4texn f3iadlaDrm( onu4alxnir todom rlu slt0s2trimpoo1om emncsatfsrrau  ;t0tlt iociydla2ul(vont)arxoircoadlmteluvi;()truoxmpio4al e icias)a2rmurpno0tee  fciadla emuvp t)altrir3oo1om  ln i;(0srumxrpny1ap e fviatfaDrax  ot4aee moctyt s elnmon()artnmociy1op e i o t)s2uoir nu1lp n ncta(fs2umur nu4oetnioeildlmDrmuvs;u)tltrifcia1fpDeliei s)s2xmir3ny4alen fcsa( sruax pnu0tpxnmocild aDrmuvp u4trxnxr3iatlp r ueil(0s2trio3oudlpt miet tfa2raxr nu1oeenio3iaslsDemnvpn(0 lermr io1op r ivs t  etm(o3io4lmtnlnes () 2tmur nt4oeto f3tytlaDem( s (0 rxoxo3oydlp  anes s0srxmxo ny1lptemnes (fs2rmur nu0olxnmi3tadlsDelnvsnt)teeoxr to1lmDeau s;s s2trxrpiu1lpen fvil( srrmumono4tptoifeiatlm ua( p;t)teerxfctatomD  nvs;t srto(r3iy4ol n ncia(fsrtrumo;t0teeoio3tltls elnmsnu0alermr3oo1fp  auvi;t) euoxr3iy4lm e nct sfsDrmumonu0opxnmieiytla eanms u) ltoxfcoadfmt lnvo s)trtrim iu1alee nvsa()sDuauronu4olto i3iatfm rlumsnt0tltnifctytla   ivsl( t2xo(m3nodome mnvtl(fs2tau pnu1apxo i3iytfaDrau p;t4tleoxo io1optrlues;t0sexoio3oo4lme lnesls  2tau pnt4olx mietasfa eanmsn(4alerirciadoatrluvo;t0t2tmxopnu4oltnmicsltf rrr(  ;o1tlx  oeiasfs rl(mp () rxnxr tydom elu sl( t2tmim3ny1ll n nctas)aDrrur no0aetoifetldfaDrmn pnu) exoxocta1lm   nvs t0tetoxrpnydll elneilsfsDrrxm nu4tpenmo3tytfm ra( p;t0tetnmocoa1fmt  u s;s) 2xrxo3nydam n ncsl(farra(rono4aetnmo3iyslm2uanvont4 rxnxf oodomt ai i;s)srtmir nodolen ivil(f Drm(m ;u1tetn o3iytlm eluvsnu0aleoxrcia1lateaiei s)truo(mpiodame lnct tfa2um(  ;o1tpto ictlt a2ran pn() lxoif3tytopD lues;( t2uoxm oodllt lfvsas sDtr(monu0apxniictyslmDelump;t) rermocia1faDelivols t2ur(o3ny4op elictatfsrrax o;t1aptomo3tytlaDran pnu0alxnmo3oodlmDe nvo s)trurir3nydlm  mfvtat) 2tax  ou1tlx  o3iadls2ua( s;t)texoxrciy1fpDe ivs;t)s2xo(o oydlmt mfvsl() Dtrxm ;o4tlxniieias mDua( pnu4trxrio3tadfat  n i;t)texr(rpnudll n fetas) ruaurpnu4olt  ieiat a raump u0trxrmo3todop ranvo ()t2tmxopio4op nlfcslt  2rmxmpnu4oltomi3tydlm2eauvsnu0 rxrmf totfp  lieo s trumio nu4lm nmfvt t a2rm(r ou0apx  octytls ul(vs;t4trenifciotfmtean i s sexrxr oodap elnet t) Drm(  no1optnmoetydlsDrl( pn() ltnxrcty1laDelivi;t)srxmxopiydolt mnet t arra(mont1tptniiciadfaDel(mp u0 lenxf3oa1oa rlnvi t) rxoir3oy4ale  ict (f 2ua(  ou1texoif3iysfm2um(msnt0aleoif oa1fatr i s t0 rto(rpoydlm elnvi t arta(monu1oetoioeilsfa2eluvo;u0 etrmr3iytop  anei s s2toxmpiu4ap nlfctlt) Dumumo;o1tpt ifeiytfm emnvo u0trerxrcoadoaDeauvilt) 2trir3oodaptnmicia(f Duauro;u1aetomo3tysfa2elnmp t) rtomo3iodfp rauvo ()teum(o3nodal emfvsl(faruaxront4alxnioeiadfs emnvo;t) etoxociodfa elu ol()trumirpno1altnmfcs ()sDurumono0ape if3iasfs2rl( s u)aexrir oadla  livolt0srtrxo3oudlltelnvs (f 2ur(ro;t0apen ietad mDemn s;u0texomr tytop   n s (0seuo(o3iy1al  lnvsasfsrumxmpnt4apxo ocilt s ul(mo t0 etoxo oodlat anvo;s) ruoimpnydol e fetlt a2ra(roou0ole  ieiltfa2rl(vs;(4texoxrcty1fmDrlnvs s  ruoiopio1am elnet s)sruaur ou0olxnmictls mDea(vsnu)alxoxr tytopDe n olt srtm(o oo1ll n ietlt)a2ur(rpot4tex  o3tadlm uaumpn(4tleoxr tytfatraues (  rtr(r3oy4om e nei ( a2uax pou1altoiictydlaDraump u0trtrxr tatlmte nvi;s tetmimpnu1lpe lfcsat)a2um( poo4tlxomieilt a2eanms u4 rxoir3totlmt  nvol( teurio oy4lle mivt tfs2rmu pou1texoii3iyt sDem( p;()arxnmrcto1op   neslt  2trirpiu1ap nlnet tf Drmurp;o4ape iociaslaDrauvp u4artoio3tatfmD aieslt0 2to(rpny4ol n nvi (f Drr( pno4apeoioetatfa ra(msn()arermf iotfa   neo;(  eurir nu1lmenmnes (  2tr(m nt0tpeoifeilt s rmnvo t)arxrmrcto1op e ivi s)t2xrim3io1op elicsas s2tauro;o0aet mfeiatlm2el(mp;u0 eermf3tydfa rlieo s seur(r3ou4lm emfesasfs2urumpno1tpe mieiysfsDea( snt0 rtrxrctotlmtran i ()seumiopoo4lpe mneiat)a2rrum ot4oexnmf3ilt aDrmu snt4tleomo3iadop   uvo t texr(rpoy1lm   ncta( srtrxroou4teto i3iatlaDemu sn()aexrircoodop  an o;s)sexmxrpio1lptelieta()srra(ro;o1olxoio3iydfaDra(vo t4 lxrio3iotop  lnvslt trtmxrpou1oleemneilt artruroou0tpx mo3iyslm2emnmpn()tetnmociodomtelues;t0teumxrpoy4op   iet ( aDur(m no0optn oeiltfm2rlu p t0 rxrio todlpD  nes;() 2xr(mpoydllt  nct s)srrm(rpoo1tpxo ociltlm elnms;u0areomoctodlmtran ol( texr(mpny1ll emnci (fsDtrur ou4aexnmfeiydlsDeluvp;t)arerxr iydla  auvi ( t2xoxm io1am e nvtls) 2rm(rp;t1oltn octltlmDuluvo t)aeerxo ootlpD  n s s)trtm(m3nydlm nlncs () 2um(  ;t0aetoiietydfsDeauvon(0trtomf tatoat  uvsl()s2um(m iydlpe livi t)aDtmxrpnt1alto i3tytls2rln o u0 rxomo3io1lmDe u s;t t2urim3iodamenlnci ( sDrmxrooo1oex io3iasfm ea(vp (4 rxomfcty1lptran i (0seuoxm oy4ll nmfvi (f Durxroou0oetoioeiytfa2el( o u0tltnmr oodlat  neo;t texo(r3oy1llt mfvsas aDumxrpno1tpe mf3tatfa ua(mp;u)aexoircio1fm  livo ( t2tmxm iy1omte feta( s2rmu  ou0olen i3tysfa uan snt0aetomo3tytom elieo;s)t2toxrpoo1al emneta() ruru  ou4aleoioctas m2ulnvsnu4 lermf ia1lm raivi (  2toio3nu1amtn netltfaDtmurpoo1oetnmfetlsfs el( o ()tltrmo3tytfat ai i s)srxrio3nodlp   ivs ( aDumxmo;u0tpenmfciyslmDrau snu0arxrmf3tadlm  lu o s)trto(m3nudlpe mnvtl()aDtr(r ;t1apeoifcilt sDelnvon(4tleoxociatfatean ol(0 euoim io1ol nmnet ( s2tru poo4oetomictlt sDrm(msn(4 etnmr iy1fmt  n s;s)srtoxr io1altemiviatf 2rmxr ou0aptomo3iysfmDumu sn() lxnir iydopDranesl() rum(o oo1lmte neil(fsrtau  oo4oexn ictlsls rl(mo;t0alermr3todfaDelivi;t trxmiopnydapen fvtlt) 2um(  ;u1aexniieiatls2rmn s u0 exrmf3iodlp  au o;s srxo(o3iy1olt mnvt () ruaxm ;o0tlxomieiad mDulumo t4 ltrmr3iydop   ieo s0t2uoxm3ou1lm e nei tfsrrrxm ot0teeo iciltfaDemnvs u0aexnmr ty1fmDeln i s trtmxrpoydaltelfes ( arumu p;o1tlx ioetas m elnmpnu4 etnmrcoodlaDr n i s trtrxr nu4olt lfvs s a2tru p;u0teenioeiytla2ra(vpn(4 eenifcto1omtelnvil(  2umir3nudoltelnvsat)srumur oo0tptnioeiadfaDeau p;(4teerxfcoodoaDeai i t  2tm(mpoo1lmt  ncias)arua(r ;u0oee mfetys sDrmuvp;(4texrxo3oa1opt ln o s  2trxopoydlptnlicsa()aDraurooo1ape  iciltfsDem(mpnu)aeeoxr3oy1lmteaivilt) etoio iudoltnlnvsa( a2uru ooo0tlx mictydls emnvo t) exrxocty1fpte i s t tetm(m3oudol e fesasfa2tauro;t1oleo o3ias sDea(mp u0aeeoif iadop e ues s0 2xoim3iu4lme  fesas aDtmuront0oetn o3iadls2emnms;()teermf iytoa e i il()tetm(r oy4ol nmfesl()a2rrx  oo0oltoio3tydfm2uln pnu)tlermrcty1fa rlues;s  rumim3no4aptemictasf 2urxronu1aexnmietadls uau s t0 rxomfctodlptr nvils)srtoim iodam nlfvtl( s2rrxr nu4teenmoetytfaDemnvonu0trtomr ta1omDr ues;t)srur(r iu4lltemfeslt aDraump;t1aetnmo3iys mDelu pnu) exoxrcia1fm  livi;s0trtm(r3nodlmt lfvi t)aDua(mpnu0apx  oeiltls2elnvp;(4 ltnmf iatlatraivilt) rur(opnodolt  iei t s2tmu p;t4olen ictydfsDranmo;u)teeomr3oatfatrauvo s)teuo(m3iu1lltnlfci ()sDum(ronu4tpt mfeiyt mDua(msnt4texoio3ta1la raieo (0t2ur(r nu4ol n fesls a2rauro;o4aeeomo3tlsfm elnvo;(0trxrmo3iadla rlueilt)trurxo3no1ol  lnctat)s2raxr oo0olxomfciysfsDrluvp u)arxrmo oadfp r n o;s0t2xmxo3oy1ll  micias)arraump;o4olx ioeiyslm emu p t0teermfcoo1fa eaiesls0s2um(m3iudlp e fcs tfaruaxm ;o0opxn f3ias mDuauvpnu0tltoiocoydlmt  u o;()trumxo3oy1apeelfeiasfa2tr( ono0tleo ocias s rmnmo;()tlenif ootfpt lieslt trtr(m3ny1amenmfeta(fsDumu  no4tptn i3tls s2uluvp u4 eenxo todfmD  ivs;t)tetrxr3oo1alenmfcsl(  2rru oou1tlen iciatfa eanvpn(4 lxrmr3tatom rlues s) 2xoxopoy1opeelneiasfartm( o;o1tpt mieilslaDra(vp t)alenif3tydlp r ivs t)texm(r nu4omenmivta(  Dua( pno1aeeomocildfsDea(vo u) ltrxf3iytlp r nvil(0texoxopoy1omt lncta( artmxr ;u4optnmocilt a2em(monu0treoxo iytlmDeau o s srur(m oy1lpenlfvi t) 2rmxm ;t0oeenio3ils a rmumon(0 eeoio ty1fmtrli olt0trtmxr iu4olenlivsl(fsDrauroou1tpt  o3ils sDeln p;(0alxoio tatfaDelneo;t seurxr nu4al nmivtltfa2tru ooo4openii3ilsfsDrmumsn(0trtoirciatomDeanei ( seto(m io1apenmnct sfsrtaump;o1oeeo iciat m2uanvp u)teeoio oadfm elivs () etm(opiy1am n ncias sDrau  ou1aptnmieiysfsDem( p u4altnxfciatlaD  nvs;s0seurimpou4ol nlncsl( srumx onu1apxn ieias mDea(vs;u4teermf3ia1op eau il() 2xrxm3iy4opee ivtl( srrmu pou1apx ii3tlslsDea(mp u4alxnif3iy1fa rluvo;t seuo(opiy4am   fcsatf rumumpnt4alt  oeiytlaDrlnvont4tlxoircta1oaDrlivil(0 rtoir iodlpte nctlsfsrta(roou1ape iiciadls uauvpnu0 lxrio3todopDe n ols0trtrio3nu4lltelneslt)s2ua(m ;u4oeeo fctasfsDrm( s;t4tlermo iodfaDraieo s)trum(opnudol elfesls) 2uax  oo1opxomi3iad aDeanvo u0trerifctytlmtranes s trumir3no4apeemneils artmumoot4oltn ocils sDua(mpn(4tlerio3oy1fpD an o;(0t2toxo3iy1apt  ivslt  ruaur ot1aptomf3tatfm2rmu p;(4 lenxr3iatfpDe ivs;t teurim iu4ol elnvs (faDtr(rp;t0apxniieiysfa2rlu p (4treoxfcoatfpDeai o t sruoir3oy4lme  ncsas) 2tru ono1apt ii3tasla2rln p t)altoio3oa1lmt anesls) rxr(opno1apt lnvslt artmurp;u1teeomo3tadla elnvp;u4trermrcoatfa elu olt)srtr(o nodol e fvtas s2raxm ;o4olxo fctlsla2elnvp;u0trerxf io1la rli ils0 eurim3io1ap  lfvtltfs2tm(  ;t0tpt mf3iyt mDrmn p;(0tlxrmf3iotlatr nes s  rto(mpno4oltemncsas  2um(rpot0tptomietysfa uauvp u)tlxnmrcoytfaDrluvil() eumiopou1ame lfvsat)aDtru o;u0oexo ictyd mDelnvo u4 rtrio io1opt lnvi;t teuoxrpoo1lm nmietas) Dtm(r no0altniieiad a2elnvo (0teermf3oo1oat  u o s seum(mpnu1olenlfvt (f 2rru o;o4alxnmi3iytla eanmo t4alxrio ootom  aieo;(0sexo(o oo1lptnlfes tfaDta(m no4tpxo octadfsDeanvs u0tlxrmf3iadoat  uvils) exrxmpoo4lmtelnctltfaDrrxr nt1tetoii3ildfaDrlnvon() etrif3tytlm  li i;s setoxo ny1apt mfvil(f ruauroot0apx iiciatfaDeanmp u4tlxnirciadfmtraueo;s seurir3ou1ole lfetl(f rtrx onu1aexnioeiyt s ulumpnu)tetnirctatfm e n ils trtrir3iu1ll  lietl()aDtmur ;t4apenio3tytls el(mont0aexoifcootom   u i;s) exmim oo4lltn nvt s) rrmumono0ole  fctyslaDuan s;(0 rtrxfcoydlm e u s;s0 rxr(mpoodlmenlicta(fsDrr( o;t0opeo ociytfm2umump;u)aetoif3oadfmtelnvolt0 2tmir3no4omtelfcs sfs2tmu pnt4alxoif3tadlsDrm(vo ()trenxr iytop  lieilt0sexoir3oydlmt liet tfaDtax ooo4ole ifciat m2emnvp;t) rtoxo ty1omDe n s;t0s2tmxo3nudomtnmivs t) rtax poo1alto f3ilt m2uaumonu)trenxf oytop rlivo t srxo(opnu1ol emfeilsfa2trum ;t4oltn fctlt m2umnvp u)arxoxocio1oa rln ols trxmim3iydlme licta() Drm(m nu0tlto oeiytfm2rmuvsn(0 lxnmf3oodlmDrln ilt0seumiopoy1llenmfvilt)aDumxrp;t0tpt ioeiyd aDel(mp () rerxo3oy1fp e u s;t) euoxr3oudam nlnetlsfsDtm(ronu4tpx mfetytlaDulnmont0 renxrctadoaDrau i (  2xrxr3ou4al elfvi tfa2umurp;t0aexn ietysfs emnvsnt) eeoxocto1oat au olt  exoxo3oo4lm   nvta(  Drr(mono4tpxnmf3iytla2uauvsn()trxnmo3to1lptr uvo;s0 ruoxm nydal n fvtas  2taur ;o0oltomf3iltla ua(vo t4 lxnirciadopDeauvi t  2urir nodomeemnesa(  Dtm(mo;u0tleomocils sDem( o u4 rxrxo tadlp raues t  rxr(mpiy1omt  fetls arrmxmonu1apen fciaslm2uan o;t0 reoxfcoy1lpt  nvs (0texr(m3nydam nlicta() Dum( oot4olxoif3ilsfsDra( snt) rxnmf3ootfaD  nvo (0 rurimpno1apen icils)a2raxrpoo0apenio3iadfm2rm(vsnu0arxnxo oa1fpD  nvs;t)srxr(o iodolt lict (farta(mp;o4oetn i3iytlm uauvpn() lxnxocoadomt  i s s0teuo(m oo1oleelfvsasfarurump;u1teeniieiadls ulnvpn(0teeoif3oadlmDrauvils) eumxrpou1amenmnei t s2rrx  ;u4oltoio3iytlm2rmumsnu4areoio iodoptrau o s)t2tmir3nudolt  nes s aDur(m ot1tetnmocias aDumnmonu4aetoxo iydlpDrauvs t)setmxm3oo4lmee fvt tfa2raur ot0tlx mi3ilt aDeau o u)tltrir oy1om e uvs t  ruo(r3oudoptnlivtl()s2rmxmpnu1olt  feiad a um(vs;u0tltrmo oadlmte ivs;s)t2uoxrpnodomen nvs sfarrrxrono4opx if3ilslm rlu sn(0 lerxfcia1lp raiesl() exoirpnu1lptelfvtls a2umxmooo1texn ocilsfaDumump u) exomr oo1fm eaiei t  rtr(rpou4opt  ies ()a2um(mpnt0tle if3iysfa emnvo;(4trerircoatlpDe iei t) rtmxrpny4op nlfcsl(f Dtrxrooo1texoiietlt m eanvs t)texoxocoytlp e ivi;s0 etoiopou1alt  ivtltfsDuax onu4tee  ieiasla ra(vo (4aexoxr3oa1lmDeanei;(0seuoio3ou1lp elncias) 2rrumoot1oetomfctldls2elnvo;u)aetnxr3totomD  ueils0 2ur(rpiu4lleemietatfa2ua(  ;o1olt  i3ias mDeanmo ()aetoxr3oydla   u sl( s2xm(o oudlptnmfcils) rtrx o;o4tee  feiatlsDranmpnt)alxnif iy1laDeanes t0seuo(r3iu4lle  nesls  Dtau ono0aptnmoetysfaDrm(mp t0 ltomrcto1lp  aieo t0setr(r oudape livi sf rumxmpou0apxn ietatfa2raump;t0alxnxo ia1fp rlies;t)s2toio3oudalt  iesas srrrxmpnt0alenmfeiadfm2rl( pn(0 rxnmrctydoaDr n s t0trtm(opnu4lptemictatfsDua(  nu4olxniicild m ea( o;t4aexoircty1fm eli o s) eur(r3oo1ome  ici t) rtaxrpnu1apeomiciltlsDel( s u0 ltoxo3oadlaDraneslt trxmirpoodlm emnvias)sDtmx pnu4optnmociltlm2uan s t4 rxrir oydoa e nes;t)s2xrxr3no4lm e fesas) Dtm(rp;u4aleoio3tysfsDemnms u4tlxomociatoa elu o;s)setm(opoo4lle lics sfsDumurpou1alx ioctys a eln snu4aetoif oydfm  aivi;s) 2xrio no4ll  lfvslt)arum(r nu4apeo ociydlm eluvo u0aeeomo3oy1fpt  uei t)t2xm(opiu4lme mfvt ( a2tr(m ot1altnmietasls2uaump t)tltoir3ta1lpD aieo;t)sexoim3nu4apen ietls  Drr(r ;t1olto oeildla2rau snu)alxoxf3oydlmt aneils  rtrxrpny1ol emfct s)sDur(r nt0aeeoiociasfm emnvon(4tlxrif3oatlpD anvo s  eumim3ny1al emfesas)a2rm(r ;t0oexnmoeiadlsDrl(vsn(0aexnxf3iotlaD ai o;()sexoxrpio1omte nciltfsrtruro;o0aee  fetlsfmDranvs;t4 rtnir tydfat auvo;(0tetmxr3iodaltemfciat a2rr( pou4aexn fciadfa uauvs;t0aexnio3tadlaDeluvil(0truoio iu1lmeemiviasfaDua(monu4texnifeiltfa rmuvpn()tltomo iodomt ai i t)trumim3nu4oltemncil()srra(r ot0aexnmfctyslm uanvont4trtoifcia1fa   ivo;s) eumio io4lmee icils  rtrurpoo4apxo ociltfa2elnvs t0aleoif tytoaDrai o;s0tetoio iy1lltemfvsls) Dum(mo;u1tetn f3iadlaDrmnvsn(4aeeoio3tydfpte u i (0s2urxr3nu1amt  ieilt artm(r nt4alxomoctas m ul(mpnt4tltomo oodomDrlieils0tetmxmpoydap  mict sfaDumxmooo4texn fciasla eaumpnu)texoxf3tytfp rlues;t0texmimpnydop  lfvs tf Dtr(rpnu0openiociadls ra(vpnu4tlenxrciatlaDelivi;s)s2uoxrpny4lp emfvta(  rta( oot4aleo iciytfmDemu pnt4teeoxrcia1lmtrai slt)sexoir no4olt  icil(f 2urxmo;u4aeeo icildfa eln pn(4altomr totoa elies;t tetmxm oy4lmeemiviasf Dta( o;o0olto iciadfsDra(mont4alerif3iodfpD aies;()setoir nu1alte fei sfsrur(  ot4tpe  i3ias mDrmu p;u)aexrio3oydfp e n il(  etmim nu4omenmneia()aDumum ou4aex io3iad mDul(ms;u4 rtoiocia1lm e uvi;( sexoxo io4opeelivt t)sDta(mo;o4opxomo3taslm2ea(mo;() lxnxrciytom eli i t0t2toim no4ll e nvs t)aDrr(r ;t1tlxoiietld m ranmo;t0alenmr3totfa  lies t)trxoxm oo4lm emiciltfaDrmx  ou1oee io3iydfs2rl(vpnt0teermo tadlpte uvo;t0 rurxopiy1opee iciat  Dtm(ro;o1apxoiictlsfa rm( p;t4 ltrmo3todfpt au sls) exmir ny4lmtnmfvs t)sDraxmp;u0ape io3tltfm emumon(4artrmo3iadla e uvo;s)s2xrim3nodalee iet tf Duaur ou0oetnmictyt s ua(mon(4altrmfcty1fm e ivol(0trxrio nu4ol nmncilt) rrmxrpno4tpeoifeiatla2eln o t)alenxr iy1laDranesls)setrxrpou4ame mfei tf Drmurpou4altomi3tltfs2ulnvo t0tlerxr3oydoa  luvo;s)s2xm(m nodopeemfeias sDur( oou4aeeomi3iys m uaums u)trxrmo3ootoaDeaiei s)trxoxm3iy1ap emiviat s2tr( oot0opxomociyd aDem( sn(0 etrmr tatlpt au sl()srtoxr3nodlptn nvslsfa2rm( pnt0tpeoifciatla ua(mp;() etrmocoydop  ai o;s0 etoim3nudom n fei t  2rrum oo0opxniociad sDrl(mo u0artrio oo1lp e neo (0sexm(r io4lpt lieslt)sDumu pnt4tlxo f3ildla2el(vsn() rxnirciatlm e n il()trxrxm3iy4lpe  fcsas arurx  nt1tee miciasls ulnvo t) ltrxf3oadlpt lies;()texoimpoy1lp e nesls)artrx o;o0alt  o3ildlsDrmn p (0tlenio3tytlmDr n o ()tetoxr iy4am n feils)srtmxmoou4teenmf3tasfm emn o (0 renio3oy1fat lneo;( teumxmpoudlpe  nct ()arrrur ou4tlxomo3iadls elu snu)alermo3iy1laDr nes t  rtr(m iu1ll nmfei tfaDtau p;u1tlx iictadfmDuln s u)tlxrio3ootlp  anvi;s  etoxm iydapee ieiat) rrrx ono0tlxn i3tadfsDel(vs;t) rtnif oatoat  nvi t)s2tm(m oo4am  lfvi t)sDrm(r ;o1tlt iieildfs2ra( ont0 etoir3oo1fmD  nes ( srxrim io4ameemfctl(f 2ua(m ot4opeo fctldlm rm(mo;t)teeoiocto1oaDr nvils  2uoirpio4apt  nciat sDrr(  nu0aptnmoetldlm el( p t4alxoxr3oa1oa   nei;(0srumxr3io1aptn feias srtrxmo;o0tltomicilsfmDulnvont0 etoxf iadop eluvilt)teuoirpoydlm elnes s  rtaumonu0oex mfciatfa em(vo (0aexnio3ta1oaD luvo;t0srtoxr3iu1amtnmfvtlsf 2tr( p;u0olxn f3tasfmDrmnvo t0arxnir3oo1op raues;t seumir3nodlptemnct t)a2tax  oo1tpx moetad aDum(ms u0artrircoa1lpDelnvi t0 rxmxo ny4olen fesasfsDumu  ;u0tpenmociydfs ua(msnu)teeoxr3iydfmD auvo ()s2urir3iydomte fcs s s2rr(m ot1ole  f3tltls2rl(vp u4aeeoif ty1fmDe nvils0 rxoio3oo4al nmnesas)sDtr( pnu1tpe io3ils s2eluvont4 lxoxo3oatom  livslt0srtoxm ou1apenlncia() 2uaxrooo0opxn ietysls2eluvs;t) reoio3ootfa r nei s) rumimpoy4ape mnvtat)arrmx pou0opeomieilslm2rm(vo;u4trermfctytop r nvs (0 2uo(opou1om emfvi sfsDraxmoot0aex  ietldfs2el(vpnt)areoif3iytom rlu i;t)texo(o iudome miesls  2tau pnt1tpxn iciys m2ua(mpnt) exomr3ty1lateanvo ( sexo(o no4lmtelfctl(faDua(m nt4opto ocilt aDeanvp;u) leomocoatfptr n o t0 etmirpiy1lpenmneias) rrmxrp;u4tpeniiciytla el( s t4 rtoio3iadoa elieslt t2uoxm ny1ap   nct sfartmx pot0oltomfetadls ea(vp () exnmo totfpDrli i;s)trtrxr ou1lpenmfvia(f Durxro;o1optoifcild m2eauvs;t0trenif ta1fm  an s;t  2xoir3iu4altnmivs t)arum(rpoo0altn fetyd sDumuvp (0areomr oo1laD auvi s0 rxo(o3oy4am   iet s artr( pot0aexomoetadfa2rl(vp;() lxniociy1fpte uvil()sexr(rpny1ap emncil( a2um(ronu4teeniicilsfm ul( p u)trxrmr3oa1la r n s;()teum(o iudol nlfeias) 2rrumpnu4tleoio3iyslm2emuvp t0aeenxocootlpDeaivsl(0 eur(m3nu4ope lnesa(fsrurx pno0aeen fciytfs em(vp (4treoxo3iy1om rlues;s0trtrxrpnu1ll  lietat)sruaur ot4tpenioeiysla2rmnvs (0trerxo oadlpDelnei;()t2um(o3no1lm n ivsltfsrra(mono4oee io3iasfaDum(vpn(0aexnxf oatlaDeln ols)teurxr nu1lptelncslsf 2trx pou1apxo o3iaslsDum(ms;u4 eenmr iatom elies;(  2xo(rpou4apeemietl( s2tmx  nt1tlto f3tasls el( ont0 rxnif oo1op r n olt)sexoxmpoy1lpee ivtls sruru  ;u1tpx  fetaslm2rm( p (0 rtnif3tatoat au ol(0s2xmxrpnu1lmtelfctltf rrr( ooo4tetoioeiatla2umn p;u) eeomo tatfmt  n o t s2toxr oy1lmt mieia()sDuax o;u1ale iieiatla umu onu4trtrio iy1lateauei s0setrxopnydaltemivia(faDumum oo4apto oeildls el( pnu4trxrio tatfmteai i (0t2trxm3ou4opeemfctls)srum( p;o1teto i3iyslm2rl(vs;u)tlxrircootfa raueo;(0 rto(r io4am n fet s sDtr(
\ No newline at end of file
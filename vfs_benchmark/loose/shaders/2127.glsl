@@ -0,0 +1 @@
+nvo t0 euoir3no4ap e fct sf Dra(mpou0tpt  i3tytls eanmp;u)tltoxf io1oaDr u ols srumir3oo1op   nct t a2tm(monu1apt io3ilt m eauvs;t0 lxomocta1lpDr i olt)trtrir3iodomtnmnct s srrm( o;u1olt io3iltlaDumnmsnu)tltnxrctodoaDrai o ()texmxo iydope mfvt (  Drm( pno0tetoifciat aDul( o;t0 rermr tatfaDeaneo t) euo(o io4lpt mnes t) 2rmurpou4tetn fciasfa rmnvs u4 ltnmf totfm r neols  etrxm3ou4am n nci (  Duauront1oeto ietas m2rmnvpn()trtomfcoodomt au o t srur(o3iu1lmee nviat)arrm(m ;o4alxnmiciltfa2uau p u0arxomfciadopD  i i (0 etrxm iu4ope miesl( srtmum ;t4tleoifetlslsDuan o t0tleomf3oo1omtrauvsls)sexoxmpio1ol nmfvs (  rrmuront4alxo icild m2ranmsn(4aexrir3iotom eluvi;t)texmxopnu4aptelfei ( a2tmx poo1tetnmfeiydfs eanmpn(4 rtrmo3ty1lat  u o;(0s2xoxo3oodapt mnviatf 2rru o;u0oee mf3ilslsDemump;u4 lenmociatfp rlnes;t0truo(opou1ole mfcta(f Dtaumont0tet  i3iyslaDuaums (0trxomf3iydfmt  uvil()setrir iy4lltn nvsat)aDurur ou4tpxomo3tltla rm(ms;t)trxrxo3todlpt  ivo s  exm(m3ny1am nlneilsfsrtau ooo4oeto feildfaDuauvo t) exnxo3tydfmtrlnesls0s2to(mpiu1ap e nvs t)aDtrurpot4aetomo3iatfs2ranmo t)teeomocoodlaDr ieslt0 etr(rpou4lp emfct (f Drr(m ;t1tpe  oetysfm eau s;() renxf tydla eau o t0truoxrpiodlp  lnctlt)aDumu poo4oeeoioctytlm2rau p (0texnxo3iy1fpDrlnes s srxo(opiu1amtn nvsl() Dur(moot1apeomfetat m ea(ms t)alenmf iotlaDranvo t0srto(r io1alenliesl( sDuau p;o0tpeo feilsfa2rmuvs u0 etrmrcoadfaD  ueol( setmio3iudapeelicsas a2rmxrpnt1opeo feiyslsDum( s t0 rxrxrciadopt lneo;s0seur(r3iu4amee fcs () rrrxmont4teen octydlm ulnms u4tlerxf3oo1la   ues s0s2xm(o io1lme mneias  2uaxmpnt0oexoio3tltlmDeanmp;u4 lxnxf iytlpDranvs s seto(mpiy1omenmnei ()arrr(ro;u1oltomfciasfa2eanmo t0 rtrxr3tatlp  anei;s tetmimpnodol nlfviatfsDtruro;t0alt  fetydfsDem( s;u4trxnxo3oatla  lneo;t0tetr(o3oy4op emnvta( a2rm(roou4tltniieiyd m2rlnvpn() etnir3oy1optrlivslt)s2triopou4om  lncs s  Drr(ront1tlxnmfeiadlmDea(monu0arenxf totoatelies;() 2xrim ou4alt  fes (f rrauro;u1ope iiciasls2rluvs u0 lxomo3tydfmDelneolt0s2toio ny1llenmics t arururonu4aleo ictyd s2emump;()altoirciytoa raivolt) exrxr oydoleemnetl() 2trxro;o4openmoetyt a umnvp (4arxomfcoatfpt  ivi;s0sexoiopnydllenmivi (  2taum ou1olx miciadlm2rl( onu0aetnmf tadoatelnvslt  2urxr oydaltelfcils) Durum ;o1teeo fctasfaDumnvp (4aeerifcoatoa  lnvo s0 2xrxmpiu4ol  livt sf 2ta(rpou1ole ioeiysfa2rlnmsn()alxrmr3ty1om r ueo;t0 2tmimpoo1optn ivsasfa2uaum ;o4texo f3tysfa eanms;(0aetoif3iadomtrlivolt0s2xr(rpoudlpt mnvtlsfarrrxrpoo4apeoiocils m rluvo u)tlerif iodlp  lnvsls0t2urxo ou4ll  lnctls srururo;t0oexo f3ias m ra(von(0tlermr3ta1fp r uvi;()teur(m3ny4lpt lfvi (f 2tm( pot0apxnifetydls2elu s;t0 lenmf3ty1lmDeluvs;() rxoio3io4olen nctls a2tmxr ;o4tle  iciytlaDumnvo;u4 etriocoodfp rlnvo;s t2xm(r3ny1ame lnvsatfsrtru  nu0opeoifeiydlaDeaumon() leoxr3oytfmtrlivs;( t2xr(o3iu4amenlictl()a2rrxrpou1olxomi3tydfm2rmums;(4 rxoirciodomte nes t0sexo(m oudlp  mivsl()artaxmoot0oleoioctys s2rm(vo;t4aeerio ty1lmDe ueslt0trumxo3nu1ame micsls arrmx o;t1tltnii3iyd sDrlnms u0trermo oodfpDeln i;s) rumxo3no1omenmncias)s2trx ono4tlxo o3iat m2umnmo t)tleomr3to1fpDeanei;t s2umimpno4am emfvsl()sDrm(ront1alxoiietat m uluvp t4texoxr3iotfm eaivi;s teurxr oy4aptemnvs (fsDrmxmp;t0tleo fcildfs2ran s;()aeenxr iytoatrau sls)s2um(rpnydap nmfeilt  Dra(r nt0apxnmi3ils m emnmp u4arerxfctydla rai s;t  rum(r oodope  netl()srua(r ;o0tet mo3tydfmDel(vpnt0areoiociytom rlnvs;(0t2xr(rpio4lltn nci t)sDumxmpnt0tee ioetyslsDrmnmon(0 etnmo3oa1oaD  ivo;s0teuoir3nodlmenlietls) Dtmu ont4tpe if3tltlaDuau pnu4altrxo3ootlp r i ols)t2xm(r3oy1lptelivt t sruau  nu4tptnmieiadfa uan p ()teerxrcoydfpt liei;t) exm(m iudope lics ()aDtrx  oo0tpenmfciyd sDel(mp t4tlxrxfctodfmtelu s;()srxmxmpio4ol nmfcs sfs2rmxr ;u0oexomocilsfa2ua(ms;(0 eeoir3tydlaDeau olt0sexoimpnodol n icia() 2tr(mpno0aex mf3ils m ulnvo ()arxoxo iydfpteaues;()texmxmpiu4opt  nes ( srrau pou4aeen iciyt a ea(vp;(4aexnxf ta1oa elu s ()s2ur(o3oo4olenlnvtas)s2um(  ot0alxnio3iltlaDrl(ms;u)artnxr3oatfpte n ol()t2xoxmpnodapenmiesa(fa2ua(mo;u4oexnmf3iadfm2rl(vs;(4tetoxr3todlat  ivs s)sexrxo3iy4al   nei s a2taxm nu1opxnifciasfm2ua( pn(4trxnxoctytoaD  nes;(0 2urio ou1lle lfci s srra( onu4tpxn ieiyd a2rln s u0aetoif3oo1lmtr ueo;( srur(r3iy4am nlfvi sf 2um(ro;u4aet  i3iatlmDranvo t0trtnmr totla  ai ils0 etm(rpnudape  ietltf Dur(  nt1oeen iciat m eluvs () ltoif3oadlm r ues;(0teumxo oodoltnlnetat) 2ta(r no0tpeoiicildfa2uau p;(4trxomo ia1oa eauesl()t2xr(opiu1ll  mnei tf rum(r no4apxnmfciasfsDea(ms;t) exoif iydlm elnvs;()t2ur(m nydoptnlnvtltf 2uaurp;u0apeniietasfaDra(mo;t0aexrir3ia1lp rlivs;t0teto(m3io4oleelfvilsf rua(moou4texnifetltfa2uanmo;t4 etrmr iatopDe iei;s  ruoiopiydape lfcta()a2uaump;o4oltomieiasfmDul( p;u4alxnifctatomtran olt)seur(r iy1op nmnci (farrmxr ot0aptnmieiatfa ra( o;u4 eenir oadop r neo ()t2xmio3oo4lme  icsat)aDtaxm ;u0ape iociatlaDel(vonu)tlxnircoy1fpDrau i;s0 rxm(m oo1opt livi s) 2urur ;o4ale iicildfs rmnvo (4arxnio3tatoaDran s s)s2xoxopiu1lp   fcsl()sDtaur oo0apenmiciad m2rmu snt4tleoio iy1opte ivi (  2toir3ny4am  mfvsltfsrur( pnt0tlenii3tydlmDrlnvp (4tlerxo3tadlp r i i;t)trto(rpiu4ll nmnet s) 2umur ot0texn oeiyd a rm( p u4tlxrifctotoaDrlivi;s0seto(rpio4olee fvsa(fs2tau  ;t0alxomiciyslsDumu o;u0 eenxr tatfateaneo ( s2uoir nudlltemfeiat)sDumxr ot4olenmfctytlm2uln onu0 etoxfctydoa eaueil()setrirpou1lltelnviat sDuru  ot0aet if3tltlsDuluvpnt)arxnxr3oydomtr i o (0srurxrpnu1al nlfetatfs2rax  ;u4tee iietadfm rlu p;u0aetnmf oa1la raivi t s2tm(o3iu1optelici s s2rmx  nt1aexomietydfa eauvo u0 ltoifciadoateau i;s setrim no4al  lfetl( sDrmu o;o1oee ifciyd m rmu o;u0trtoir3iodlaD  i o;( tetr(o nu4lm  mieils) ruaumont1oex  o3iyt mDemu sn(0aexomr3oadlaDelu s;( t2tr(o nodameelfet ()arta( o;o4apxoiociaslmDuanmsn(4 ltnxf iotla e u ils0s2xoio3ny4omt mfvsa(fsrtmu ont0tleo ietadls2ea(vp;u4 eerio todlpDe nei;( srxrio ou1aptemfvtasf 2ururooo0aet  o3tas s umn p u) lxrmo oodfp  au i (0s2ur(mpiu4llt  fct s s2tm(m ;o1ope  feiadlaDeaumonu4aetriociydomD lu i;(0srum(rpiu1omtelfvsas)s2umxmpno4opxomiciatfmDulumsnt0trtomocoo1fpteli sls srtriopnu1lmenlfeta(f rtaumoot4aexomfciadfs2rlnvs;t0trenxrciotoa rauei (0 exmxo iu1oltnmieslsfarrrumo;u4tlt ii3tyslm ran o t4alxnxr iatfpDelivsl(0t2trio ou1ome micia( sDtmxm ;o0tpe  ocilslm ea( s;u)teenxocoa1oaDe iei;()s2xrio iy1ape  icta(fs2ur( ooo1tltoif3iatfa2ul(vont) lxrxrciotlmtrai i s0t2um(rpio4opeelfvt s)aDta(m ;o0tptnio3tld s2emn pn(4aeeoif ta1faDrlneo;()seuoxmpou4olteliet (faDua(m oo4teeo ociat sDumu sn() exrif ty1fpte n olt) 2uoxr ny4optelietls  Dta(rpno4alto fcildfmDulu onu)aexnxocoydlatranei s0teum(mpnodaptemiviat  rtaxr ;u4tetnifctlsla emnvont)aleoxo to1lp   iei (  2toxo3oudlptelici t)srrm(  nt0oeeoiocilslm elnvpnt0aleoxrctytla  lu o;s) ruo(o3no4llenmicils)arrm(m oo0oexomf3tltfmDul(vpnt4aeerifcoadfmD lnvilt0 rto(rpoydlp nlnvt tfsrtaxmono4tleo iciytfa2ulu p u4tltnmr iatlp  lues t s2xoxr iu1ameemfet ( s2trxmp;t4tpen ieiydlsDulnmp u)alxoircoo1late i s;s0srur(r iu1apt mncsatf 2uaxmo;o4tpeoifetasla2el(mo ()aleoir to1op   ivils) 2tmxrpoydolt lfetat aDum(mo;t0tlto oeiatfmDelnvont4 eerio3oo1opDrlues ( srxo(o3iy4ll emfvsl( aDtaxmp;t4aeenmiciasfs rl(vo u) reomr3iadlaDr u i;s0sexoxr3ou1lm nlnesls) 2rrur ;u0apxnifcias m2uanvont4 exnmf3oa1oaDrau olt0s2xr(rpou1omt mietat aDtmxm nt1tpxnmoeiyd m2emuvs u4arerxf3iytlmDrli i t)texrim io1al emnvi ()srrmumpot1altn oetyd a em( o t4 ltnxf3tadfa  an s;t0srtrim oudamen fet t  Drmxrpno1olto ociat a eanms;u)artrmf3iatfa e ues s)t2umxr nu4ale lnei s)aDrau oot4altoio3iat s2emumo;u4tleomo3iadom r ueslt) exmxrpoudlmtn fvsa()aruaur ou4opxomfciadlm em(vs;t)texrifciydomtrlivo;s  rxm(r3io1llenmneilsfaruaumoot0alx  o3ias a2eau o t4tleoifcoa1oa eli o;(0setoxo no1apenlfvil(fartrumpno4alt  fcilsfa uanvpnt4 exoxo iotlp e nes t  rtr(opny1op  livs (f 2umumpnt4aexomoeiydfm2ul(vp;t0arxnif3oy1latrlneo;t t2trxr3oo4ame lictat  ruaum ;o0tex mietldfa2el(mp;(4 exrmrciytlptelu i s0s2tm(r3oudoltelieil(fs2tmxm nu4tle  ieiltlsDeau s (4 leomo oydopDeauvs s)setoir3oo4lmtemnesat  Dtr(m ;o1oleo ieilsfa ran s;t0tetrmoctotfat auvi;s  2um(r3nu4altelics t srtm( p;o0tptn oeias sDean pnu) rxrmo tytom   ieo s s2tmimpou4alt mncsls a2umuro;o1oee  f3iytlsDrm( p t) lxnirciytfaD luvils0tetm(m iu4al  mneilsfa2uau pnt0apxo oeildlm umnvon(0tetnir todfate ues t)t2urxr3no4alee nes ()s2raxrpnt0aeenmfeiysfm2em( snt0 etomfcoatlaD li s s  2xmxo ou4lp elfvt t aDuru pnt0tpto f3tasfs2elnms u0aleoir oytlp eluvolt) 2xmirpnodapeemfetlsf Dum(rpnu1alenifeilsls2ulump () exnmf oa1lmD livols0 eur(o iydlpen fcs s) Drrx pot1tex  fetatfmDrln o u)artnmf3ootfaDr i slt)texmimpoo4lmtn nvt sf rtm(m ;u0tptn o3iasfa2ua( s t) lenxrctadlp   n i (0 rumir3nydlm   fvta(farur( pnt0oeen ieiltla2emumonu0 renxr oatla rlnesls) rtmxm no4amtelnvt tf Dtr(r ;t1olx  ociyd s rau s t0 ltnmoctatfatrlues;t0 2xr(r3oy4ale  fvs sfa2umumono1tle ifetasfa2rauvsnt0aeenxocty1lmD lueol( t2ur(o3iu1aleemfeslt sDuax  oo0apeomi3ilslmDul(vp;(4tetoxr tydlpDr u i;(  etr(rpiodlmt  iei s  rraurpou0opeomieilslm ua(vp;t0 rxnmf ty1fmDe ivo;( srxmxopnydllee neias) rtr(m nu4opxo ociltfm ul( sn()tltnmo3oydfa   u ilt0 rxo(o nudllt lfcsasf Dua(mp;t4texoifctytfaDeanvp (0aeeoxrciy1lateai o s)s2xoio nydom elictas a2umxmont4oetoifciatfs rln s;u)tetnxo oa1fm ean sl(  euo(m3nudlp   icsa() rrr(rpno4apen o3iat s2umuvpn(0arerxociytlmDe i s s srur(o3iu4ll  mnei tfsDtr(  ;t1aee ii3ias sDean p u) reoxo3tadfp e u i ( trum(r iu4omeemnetasfsDrrumpou4aee ifeiytfm uau s t4tlxoxo3oa1lmD aieo t0srxm(o iudomen netls sDuaum ou1tee iociasla2rm(vs;t0 rtoifctadlpt  ieo s trtmxmpnudolt lneslt aDuaxrpoo0openif3tatlsDemuvs;u0texnxfciotlptraneil()trxm(opny1amenliesas s2tmxm ;u4olen oetaslsDul(vo;() exoxo oy1omD livo s) 2tmir ny1ll emivtatfaDuax o;t1alen fcild sDrmuvo;()tlenmf io1fmDelivslt)setrxopiudap e fvsat)s2uaum nu0olxomicildla2um(vs (0arxrmf ty1op eanvi;t srtrxo3nu4olt lieilsfs2tmu  ;o4tetomo3tlsla2rmu o;t4 ltrifcoa1faDe ivol(0s2umxm iy1lm   fcta(  Drr(r ou1opx mf3tytls rln pnt) lxrxrctadfaD  nvo s s2xo(r3oodale mncs t) 2taxr ;t4tpe  o3taslmDrl( o t0 lxnir3oodfa rlnesls)s2urxrpnydllenmivsl(fs2tr(root0tltomf3iydfm2ranmp;t0tleoxf3oy1oat lieols) eto(m3ou4lpe  feia(f 2ur(r ;t1alt ifeiatfsDrau ont)texomf iotfp raueo t) rxm(o oydamt lnvsls)s2umu  nu0tlxn i3ildfmDrln p;u0 etnio3ta1fa  li ols0t2xoir3oo4lm n nci t  rtmurpnt1tet moeiyt sDran s t4 lxnxo oo1lpDeaueilt srxriopiy1lpeemfcsl()a2tmumpnt4texnifeiat s2rauvsnt4tetrifcia1lpte i i;s0srtoir3nu4olenmivt t) rraum ou0oltoifetlt aDelnmonu4 etnio oo1fateli olt)sruo(mpoo4lp   ict s)s2rru ono1tpx iocilslaDranvo (4trtomr ootlp   neils0s2xoim3io1aleelneia()a2rmu  oo4aeeomo3iadfsDranms (0 rxrmo tadfmt lnvs;t)srto(mpiu4omt mivsat a2tm(mpno4oeto f3iatfm em(vsnu0treoxfcootfp   i olt texmim3ny1omtnlnesltf Dumx  ;t1tlt ii3tyt s rl(vo;t4 lerxrctotla   neo s) 2toirpnu4openmfes s s2tr(  ;u4tlxo fctysfm2emums;t4tleomf3ty1fmte n o t)texrirpnodlltemnvslsfsDra( o;t4tlt ii3ilt a2um(vo;u4arenxf3iotoptrlneo s0srxr(m oo1opeelfvslt arur(mpno0alx  oeiatfsDemu s;t0alxnmo3oodoptrau o s0 exriopoo4am n fciltfaDtmuro;t0oee  f3iysfmDeanmp t0trxnmf oydlm  li s;t) etoir iudam  mieta(  2umumo;o4aexn fciadls2raumpnu) lxnifctodom   uei s truoxopnudol nmfcsl( aDumx p;t1openiieiydfm2umuvs;t)aeerioctodlptran i;s0srtrxmpnodol n nct s)sDtru  ou4apxn i3iat s2em( o (0tetnio ty1fat  i s;s)s2xoir ou4lp  lneia(fsrra(mp;o4oexo o3iltlaDel( p;() lxrxo to1lptraieo s0 2urirpnydal  lfctl(  2rm( pot0optnmociysfaDrmnmo;(0aeenmf3tydlm raivo s) etoirpoy4lptn fci s aDtaumo;u1ope iociadfaDumumo;()artomo3io1omtrlues s)s2uoir3oodlltnmncsl()arur(m oo4tltnii3iad a rlu s;t4 lxoxf oydopD  i s (0t2tr(rpiy1op e netls)srur( ooo4olto feiydlmDum(ms;(0aeerirctatlaDr i s;s tetrxmpoy1lpt lnes sfaDrr(mpno1ale moeiys s ranvs;(4artrir3oadomD  ueo;s truo(opou4lmeemfesat aDta(mpno4oexoioeiyt s2uan pnt0treomo3oodlaD aivol( teuoir3ny1lp n nvs (fs2trxr oo0aet  ictyd m2elnvsnt) rxnmfcto1op rluvs;t) rtrxo oydolenmfvsl(f Dtmxront4opxoifctatfaDra(vo;t) rtrmoctydoaDeln sls0 rtrxm oy1opeelnvia(fsDtmxrpnu1aexnioctyt m2ulu p (4aetrxr iydfm rauei t0 2xmxr ny4llt  feiltfsrum(r oo4openioeild sDua(vo;u4arxnxo3ta1fmtrln ols)sexoxr3oy1lptemnei ( s2rmxmp;o0teenmociyt s rlu p t) etrxrcta1fa elu olt0srtr(m3ny1ame  icils srurxr
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;( tetoiopoy1openlneil( arurx ont0aptomfctasfs ul(mon(0trtomrciadopD au il( trtmim3iy1am  mnctls)sDuau  ;o4ale  fctydfm2umu pn(0 eenmr oytfmD ai s;t0t2xmxrpou4lp nmfeil(f 2rauronu4tet ifeiasfmDumnmo;(4 lermo ia1laDr nes s)srtmirpoo4ope lnct t)aDra( p;u4aptn ietasfaDemnvonu)alxnxr io1oa eli i ( s2ur(rpnodaltemfvs (fsDta(mp;u4alenmietyslaDranmsn(0trtoifciydom elnes (  rumxmpiudllenlfcsa(farumxmo;o1olen ietytla uln pn(4aetrif3oydomte ivsl(  exoim3io1apen icslsf Dtrurp;t0alt if3iysfm2rm( p;u) eenxo3ty1lm rlues t0seto(o io1ol e icil(  rum(mo;o4oeto o3iltls ulnmon()tleoxr3iadopte ieo s0 2xmxr iy4am n ictl() Dururo;o4tpeo fctas s rmn o;u4 exrmr3oatlptr nes;s)t2xm(m3ny4amtnmicsl(fs2truro;t0aetomociadfaDrmnvsnu)trxnio oy1oat aues ()srumim oodap   nesltfs2tru o;o4tetnmictasla2umuvo t)teermr3iytoaDelu s;( teurio3nodlpe lfvias)aDtrxronu0olenifeiytlsDem(mpnu0texomo to1optrlnvil(0seur(m ou4lmtemnctat  2rmum nu4apt if3tadls2ea(vs;() etoir oa1la e u i;s0sruoiopoydlp n fcilsfa2ua(  ;u4olenmfciyt a rmnvo;u4aeeomrcoy1laDelu s s0tetmim iu4lp  mivias)artrur ot0tpe ii3ilsls2rl(vp u0aexrxrcoa1fmte uvi;s0t2tm(r3nudom nmies s)a2tr(ro;t4opt io3tatlm2rl( s (4texoio3oa1oa  luvo;t0 rxriopoo1lmeemnvtasf Dtax onu1aex  ociadfmDran sn(4 ltniocty1lm  lies s t2xmxm3ou1lp   iviasfaDurx pou4tlxo iciltlaDrl(vo;(4 lxrio3iydfa raueil(0 2tmio oo1lm   ieta(f ruauroou1tetnifcias a2ulums;u4 lermf3todfpt lueils)seuoir3iydol emfeiat  rtau ooo0teeo ietadlm2raumont)aetrxf3tadfatelnvsl()s2xoim3oy4lptnmnesat srrau poo0oetnifctyt s2rlu o;u4 ltnxo3oydoatrlivs t texo(m3oodap e nvsat s2taxro;u1olx ifciatls rm( o;()tetrxocoodop eauvsl(0srtrxr iodame mncsatfsrtrxm ou1tetnioeiydlmDranvp t)aeenmr3iodomDelnvi;s tetoim3ou4om emivi sfsrra(mo;t4olxn fciatfm ul( pnt4 renircoydlpDraieo;t  exoxo nydlme  iviat a2tm(r oo0olenmictyd aDemn on(0 eeomo3ty1fatran ilt0 2tmirpoudamt  ieils)arururo;o0opt mi3iadlsDeanvo;(0tltrmfcta1fate n ils  exm(mpio1ome  nei t sDtm(m ou1oeeoifciytfs2rl(vs t4arxrxf3oy1lmDe uvo t)seuoxo3iudaptnlivi t  Drrurpnu1texo i3iytlm elnvs () lxrmf3iatfmDelieo;(0teuoxmpnydlp e fcsas  rumu poo0tee micilt sDem(vsnu0artrir ootla eaieols0t2xrxo oo4op nmivslt s2um(ront4oee mi3tasla ul( o;u0aeeoif3todfpt ln i s t2uoxo iy4alee feiat aDraxmo;u4oeeomfctlsfa um(monu) eeomr3to1lptr uvs s0s2xm(opio1apt  fvsat) Dtruro;u1tlxnmociytlaDua(mo;t0tetoif3to1fpD aivil(0 rxm(m iydomeemivtl()s2tm(  ou0aexo f3tlt m emuvp u4 rxrmr iytlpDraues t  rxmxmpio1ope lfesltf Dtmuro;t1tptn ociasfa2ea(ms u4aexoxf3ootlpDe ivils  2umir3ny4alee fvias)arrrx  ;o1tpen feiadfa uanmo;(0tetnio3iodom elieils0 rxoiopoy4lme  ivi sfarta(r ot0ape  fetys sDumnmp;(0trerifctatlpt luei t)trxoxo oo1al nmiesa()aDurumpnu1tlxnii3iasls2umuvp;t0tlermo3iadfptr n olt)t2xm(opoudll nlnctas)arur(rp;o0apxniieiad m emnmo;u)aexrmfcoa1fmDrli s;s) etm(rpio1omt lneiatfsDtaumoot0tlx iietyd sDul( s;(4 rxrxrcootopteau s t0trumxmpoy4amt mfeslt  Dur(mo;o4teeoio3tad s emn o;t0trtnmfcia1fa r nesl( srum(o3ou1lptelfetls  rraum nu1oexomi3tld s uauvo;t)altrmo3oodfpt  nes ( t2tmxm oy4lpeemfviat) Drmxmpno4tpxomoeiasla rl( s;u)trxrmr ootlate uvolt0tetm(mpiodolt mfetltf Dtau oot1alx io3iytls2um(msnt)trxoif to1fmDrlivs t)s2to(r iodap e net t) Dtmx ono0alx mf3iat a2el( p;u4 eermo3tatoaD lues t0setrxr oudlpeemfvtat) 2rrurpnu4tlxn feiadfa2el( s (0alxrirciatfatrlnvs;() 2um(rpoydomtn ieia(  ruru p;o0optnifeiltls2ea(mp;t0arxomrcoy1lp  luei t)srtmio oy1llen ivsl(  2umxmpno1aeeoiieilt m2ua( s;u0alerioctadoa r ieol( trtrim3iodap e nvs ()aDta( pou4apeomociasla2el(vo;u0teerxo3tydfa rluvs s)setrxr3iy4ol   feil(fs2rrxmpot0alxoif3iysla2uluvpnt0 etnmoctatoaDe ues;(0 eur(m3no4apte fesls arrmx p;o0tet mietatlaDrmnvp () eerxrcoodfa eanes;t  2um(m iudlmenmivtlsfs2tmxm oo0oexniieiad a ra(vs;u4 ltrio3ia1lmteaieo ( t2xoim3oo1ope  fctat)sDrrurp;t1oexoiociyt s ua(mpn(0tlxoio todopD aiei;(  2toio oo1ole lnctl()aDurxmont0alt  o3iysfa2um(mpnt0 rxoir ia1oat aies;s)teurimpiu4alt  fvtlsfaDurxmpou4tpt mieiytlsDeanms;u0trenmo3iytlm r uvsls)s2tmirpio1ap   ncs tfaDurxmono1ale if3iaslm2rl(vs;t0arxrmfctatfpDraueil( setrimpnydlm emfet (f rta(rpno1aeen f3iytfa ranmo t)aetoxo3oadomt anvi;t)trtrxo3oo1lltnmfci (f Dra(  ;u1tleomi3ils s2ua(vp;t4teeoxrctytop rli il(0trxr(o no1lpt  icsa() 2um(mp;u4altoiicilsfaDulnvon(0tlxoirciadoat auvs;t) etm(opiy4al n fcsl( s2um( oot0aexomi3tasls uaumsnt4 rxrmo oadom  aues s)t2uo(o3iydoptemncslt  Dumx p;o1tpenii3tltfa2umn o (4 rtnio3ta1lm rai s;t trtrio3oudol  mfcsls  Drrum nt4optnmfciys aDua(ms t)aexrmf io1lmDe nvi;s)s2xo(r3ny1lpt  feiat) Duru pnt1oex io3tlt m2uan pnt)tltnmr3iytoaDrauvi s s2to(r nu4op e nvil()sDrrxmp;u4tptomoctaslmDeln p (4alxnifcio1faDelnvs t t2umio3io4om nmiesatfsDta( onu1tpxomfctytfa2uanvs (0teerifcoodlmDelnvilt)tetmio oy4olee nvt s) rraxm nt1aleomoctyd s2umnmsnu)trenmo to1fp   nvi;t0srumio3nodol  mfcs s sDumxm nt0optoiicilslmDuln s;u)altoxocoo1fatrln s;t0 rtmimpoo1ap nmnctltf Drmxrpnu4altnioetydfs2ea(mp;(4aeenir iydopDelnei;()setmxm no1om  mfvsltf 2taump;u1oexoioeildlaDrmnvs (0artoio oadom rln ol( t2umiopiodamtelnetat  2tauroou0olto ociyd s2rmn o;u4tetoxf iadfa e n i s0srtmio oo1omtnmfvias  2rr( pot4apeoif3tad a2eau o;(0 exriociadlaD ln s;( setoxr nydoltn fcia(fsrrmu  no0tlen f3ilsfsDumuvpn()altomf3iotoaD ln o (0srum(m3iy4ameemnvsl() ruau p;u4tpeniociytla2elnvs;t4teeoxoctytopDeai ils0trxoxm no1amtemfcs sfsDrmx pou0tetnif3iysfa2rlu s t)texoiocoydopt ai ol()seumxr3nodomtelivi sf Dum(rp;t1olx ifciytlmDum(vo t4 lenxocto1omt an i;t trtrxopiy1ap nlncias)a2raxro;t4tetnii3iydls2ul(vp;(4aeeoif iydoaD lu o t setmxm ou4om emnvslt sDumxront4aeto o3iydfa rau pnu)tlenir3iotfpt ln i;s)s2xmxm3nodopenmivi s aDtrx  ;u1aee  icilslaDranvo t)alxoio iotla   uei;() 2toxr3io4omte nvia(  rrmxr ;o4tpto i3tysfa2eln ont4trxoxrciydlmte nvs t  2xoimpiy4al elfeiat a2trumpnt0oeenmiciat s uluvo (4arxnirciy1lpD  uei ()s2xriopoydap nlnet t) Dua(r ;t1apx  fctld m ra(mo;u)aexnmr3oodfp  lnvs;t0 2urxopio4op emicsat s2rmxro;u1tpeoifeild m2ea( s u0texoxf tatfm e ies (0sexrxo3no1alt lici ( aDum(r ot0olt mfctldfm ul(mo;t4arxoir3totlm  anvo t0 2xoimpoo4ap nmicil()s2rmx pnu1olxnioetad a el(mpnt0 rtoio3io1lp rlnvs (0truoimpou4oleelnviat aDuaxr nt0tet  fciyd s2rau p t)tetrxr3oodomD ln olt0 exoxm3oodapee ivs () rtm(mp;u4tlxnif3tls m2ean p;t)aetrmo ootlmDranvs;t)t2urxm nu4lmtn ietl() 2rrx ont0tetoifctyt aDeau snu0alerxr3oadfp eanes ()trum(m3iydlpte nviatfaruau pnu4aetoiictydfa2em(mont4 reoiocoydop  ai ilt0 2xriopnu1ole mncilt a2rm(m no1openii3tas m2rmump (4tleoxo iytfmtean i (  eumim oy1ole  ies sfsDrm(r nu0tleoifcildla eaumont)tlermf ootfptean il( srxoxmpoo4lmtelfvs t s2rm(monu1ale mi3iysfm rl(ms;t4 rxnmocoytop eai i t)trtrim3nodom nmnvil() Drmur ;u0tlenifctysfm rauvo t) rxnir ia1la e nes;t0s2to(o3oydlpen ivtat)s2tmxrp;o1tpxn ociysla el(vo t)trerxo oodlaD ln o t t2xoxr oydlle miet ( arumum no4apx  ietlsfa2el(vo u)tlxnxo3todoa e uvsls0 rxoxrpnodam  mfesa() rrrumpnu1aet mociaslm2emump (0alxnxr oo1omD  nvi;t) rtmxr oo1lmt  icias srrrxrpno4apeoiietlsfm2uanvp;t)arxomf3oa1lpDeau o t) etrxr iydomte fcta(fs2tmxr ;o1alen ictadlm2el(ms (4tltnir3totfa elneolt0t2umxm iudamee fcsasfsrrru o;o1open oetls s2uaump u0aexnmociy1fmteau o t s2um(r3ny1lp elncslt) 2trxmpnu1opx  ocils m2emumonu) etoirctotopDe nvi;() rurxmpiydape licil(fa2rrxmp;u0alx io3iatls2ua( p (4teeoxr iadlpD lieo (  2xoim iy1ap  mnet t) Drmxm ;t0tpxoio3tyt aDumn sn(4altnmfcoa1fpDr i sl( texo(o io1omtemfcslsfartr( o;o0tetomocildfs emu ont0arermfcoy1laDrlueo;t0t2xoxm oy1lme  nvt tfaDrmxronu0oetnifeiydfa2rlu onu)tetomf oodomteanvslt)truoirpio4openmivs t) rtr( pno0optnmo3tys a2emn p t4teerxo3oydoptean olt0srxmxm nodllt  ivta( sDrr(m nt0texo f3iltlmDulnmo;t)aleomr ty1opD ai o t setrxmpoy4lmee nvs t  Dra(moou0tetoifctldlsDelnmpnt4altrmr iotlpDr ivils)tetrim3iudlptnmnvta()sDtmxr nu1olxoif3ilsfa2ra( pnu0 lenir oy1oa rlnvo;t0texmio3oo4alee fvt ()s2taurp;o0teeo oeilslaDrau o;()aeeomrciotfp r nvols)t2tmxrpno4op nlivtls sDtr(m oo4tle  o3iad sDumuvo (4alxnir3to1lat auvo (  2urio oy4amt  fct t a2ra(mooo4tetnmo3iatlaDrlnms u0aetnxo3oodlmte uei t) 2trxrpou4lmt  nes t) 2trum ou1tlx if3tadfs ulump;u4 lxrxr iydom rliei;s) etmim3iu1ope mfcs ()a2rax  nt0alenmo3iltlsDemnvo;t0teerxrciadoptr nvi;t)trtmxo3ny1aptemictls a2trxmpnt0aexomf3ild aDuln s;t0arxoif3todop eaneol(  etoxrpnu1lmeelivsa( aruru pou1opt moeilt a ulums;t4 etnmfctodoptelieolt0 2umxr3oy1ameemivsl(f 2tr( pou4aee  oeilsls uln o;t) etoxo io1fm elueilt srxmirpio4apte ietl(  Duaxm ou0aex  o3tad sDemuvpnt0altrmr3tatfptelivols  rtmxmpnydom e fvil()artax oot0tptoioetysls2uau onu4 eenxr3oo1fpDeaneil() rxmxo3oodolt mneia(fartm(r nu4teenmiciysfm2ua(ms;u)aeerxo tatfm   ivols0trum(m3iu1alt lfesatfs2urumo;u1tpe ifeias s2ea(vp;()artoxf3oatoaDrli sl(0trxoim3io1alenliei t)a2ra(rpoo4alxnif3tyt m2umn o t)trtnxocootlp e ueolt)truo(opiy4ol nmnctatf rtrxmpoo0oleomfeilt aDemuvp;t4alermrctadla rlivsls  2uo(rpoodam elict (faruau oot1tlxo o3iadla rl(mp;u0aexrif3to1opD ln i;t) euo(r iy4op emivt s)a2rrurp;o1aee  oeiysfmDra( s;t0arxrir oy1faDeln sl( teur(r nudom n nesl( s2um( oou1tlto oeiyt mDeluvsn(4 ltnxfctadfmtrlivs;s  rtm(opou4lp elnvtl() 2tax pot4texo feildlaDeln p t4 eenircty1la r u o;s)trxoxm3no1ol nlies (fa2ua(m ;o1tpe io3iasfs2ua( s (0texrxo iatomDr i slt  rxm(r oydlltelfetltf 2tru  ;u0tpxniicildlsDeluvpnt4aetnioctatoatr neol(0seumxr3nu4apte iet ( a2trxrpnu1apxnmoctlslaDrlu s;() eeomrciotlaDrln ils0t2trxo3no4ole mfetlt aDtmu pou0oeenmfetltlsDelnmp;u0 rtrxr iydomt livs t)trxoirpou1ame mfetl( aDra(  ;t4oexn fetysfs2eln onu0 lermf ootfa   i o (0 euo(mpiudol   ivs s srumxr ou0oexnmocias mDeln ont0 ltomf iytfpDeaues ()s2xriopiudole lnvi s)aDtr(mpnt1aexnii3tatls2ulums;t)artnio3todlmtrauvol(  rtm(r nu4ap emnctls  rum(m ou1oet moeias s2rl(msnt4alxnxr3todla  au i t sruoir3no1ll  licsl(  rtmxr ;o4tle  icilslaDum( p t)alerir ootop rluvs (0 2xmir3no1lpe livtltfsrtr(mont0oetoio3tytlsDeanvo t4 etrio3oa1fp  liei;s0texmir iodlltn iesat)arumxrp;u1oexnmfctltla elnvsn(4 lxrxo3tadoaDrau o;s0 2ur(r3oo1al nliet sf Dtr(  ou0aleomoctydfm eauvp u0 ltnxo3ta1op   iei;t0trxm(r nu4apee nvi tfsrtauroot1ope io3tysfm2rl(mp t0trxoxrcoatfmDrlu s t t2xriopio4op elfvslsf Draxro;u1oeeomoctydlmDem(mon() lxoxocoatoptrlu s s0 eumim3ny1amtnmivs s  Dtmx o;u4aetn ietydfm emump t0tltnifcoodfmD  ieo t) ruo(m3no4al e ncilt)artrumpnt0apxn feiydls rmn p t0aeerir3ta1latranei;t)sexmir3oy4lm eliviatfsDuaumonu4tlx if3iaslm umu pnt0altomf oo1oaDe neo;(0teumxr no1lmte ivt (fs2uru  ;t1tlxn i3iasfa2raumont0 rtnif totfm elnes;s trxriopnu1altnlfeiasfsDtaump;t1ale mfetydfs em(vo;(4arxoirciadomtranvo;(0t2trir3nu1optelfes t a2rmuro;u4apxomicils a rln on(4 eermf iytla eli o t)trtmxrpnudom elivta(  rtm(  oo4ope  f3iydls um(mpnu0altnio ta1lmtrai sls0seurxm3iudlme lnvtatfs2rrx  nu1tpe iieiytlsDrm( o;()trerir3tytfm e ieo () rxmiopiu4lm emfvtlt) rtaumono1oeenii3tldfs ra( p u4 renir3tydfpt  nes;t) 2urxmpoo1lpeemfei () rtau p;o1ole mo3iatfsDrln snu4altnif3iydoaDrlnvs t)sexrxr oy4ap emncil( aDta( o;t1apxoiocias s rm(mpnt4tlenxf3tytlaDeln sls)texoim3oy4apee ieiat)s2rauront1ole mf3ias a2em( snt0 rerxr oo1oaDe n il( srtmim3io4opeemictlt s2rr( ont1tptomfetls aDulnvs u4artrxrcoydop raivo;()teurxm3oo4omeemfes tfa2ua( o;o0tpx mi3iytfsDrln onu4alerir oatoat luvs;t srtrirpiy1ol nmfcias)artrx  ;o4tet ioeiasla eluvo t0trtoifctotfateauvilt0srtm(opno1amt livtat)aDtaxrpot0tlto o3iatfm2rauvo u)tlxnmr3oydomD  ueo () 2trxr3ny4amee ivtasf 2ra(m no1alt mi3tytlm2ra(vs;(0 etnmociadlm eai s;s) exm(mpiy4lpeelfvtlt sDtaur ;o0texnio3ild s ulnms;()alerxrcto1lp e ivsls)srxo(o nudlme lfeta( s2tax pno0openif3iytlmDelumo t4 reoxf3oadfat  n i;t  exrimpiodaltnlfes tfa2uru  ;u4oex  i3tlslaDrlnmo;u4aexomfctotopD ln sl() 2umxm iy1apt lieia( aDrm(r ;t1apxnioeiasfs uauvpnt)tleomo3tytfat livilt)trtoxopoudlptemnct s)sDrauroot1tpe iiciasfm uauvont0 etrxoctytfp rlu slt)s2xmim nydoptemfes t) rum(r nu4olx  fetyt s2elumsnu4tlenxo tytop rlueils0t2tr(o3io1optelfvil( s2tmum oo1alt if3tydls ua(mpn()aetrmo3ta1oat  uvo s0teurim3oodlm nlfvi s s2tmu ono0aexnifciltfmDrm( s;(4 lxrmr oy1laD auvsl(0srxm(m io1lptelics s)s2trx o;t4aeenmoeils a rl( pn()teenxo3oo1fmDe nvsls0 2xoxm3nodlptn nvi (  Dra(ront4tpenmfeiadlm umumo (4tlxoxrctotopteln s;s texmirpiydllen nvia(  Dum(rp;o1alx if3tadfsDraumonu0 eenmf ia1om e nvs (0teto(mpiodaptnlfvtlt aDumu pot4altnifeils s2rm(vsn(0trxnmf io1fmte i i;t0teuoim nodlpte ivsatfaDrmxr ot1optnmfciytls emn o;t)altnxf oatfmt li s;t trxoir3oy4apenmfcta()s2rrum ;t1tlxomfctlsls2ea(vsnu) rxniocoodlm   uei s) exmim oodal n netat)aDrm(rp;u0olxnmoeiydla2ul(vs;u)trxnmr3iadfa   nvols) etrxm3oudapen ivi ( s2umx p;u1opt if3tlsfmDumu pnu0aleniocoytlmt aieolt)t2xoxm oo4ap nlfctltf rrrumpno4apt mfciad aDemums;t4 exniociodlaD aivi s  rxm(opiydlmtnmfet t)s2rru  ot1tlxomfeiasfa umuvo;(0 exrxrcta1oatrlu i s0setoxm3oydapeemfvtatfarrrur ;u1alxniicilsfa2em(vp u)treniocootomtr u i;() rtm(rpny4apeelnvtasf Duaxrp;u4oee ifetatfm2raump t0 lxrmocto1faDeau ils0t2trio3iy4al  mnctl(  Drrum nu0aex if3iadfs2eluvo ()trxoxrciodlmteau sl()s2xoxrpoo1am eliei (  rum( pou0texomi3tasfa elu o t4alenmf oydfat auvo (  rumirpoo1lptnlici ()sDtr(rp;t0olt  feiysfs rmums;t4alxrif iotfa eaivslt0sexoxrpiu1ome  ivt (f Dta( p;u4apxomictadfm2eluvonu4 exrxocoatlpD  i o;t0tetoim no1ll e feil(fartrur ot1aee ii3tadfaDum( s;t4 lxnif iadfmtrli i;t) etm(o3io1op nlfet tfa2taxm ou0oeenmfctytlm2eauvonu) lermrcio1lptr nvo t) 2trxm3ny4om   nctlt sDtmu p;o0olto feiasfs2uanvont4arenxocoydlptelivs (0s2xrim nydlmtelicil( aruaxr nu4ole  fetytfsDean o;t)arermocoydlmDeli s;t) exrxrpoo1ll   fvi (fs2tax pnu4aex  ictltfaDelumpnt4arxnifciadoptran il( s2xrirpny4apenlfvi s)a2tax o;u0oeeomo3iytfsDel(vs;t0 etoxfcoytfaDelnvolt tetm(r oy1apt  feils)aruru  ot1oex ii3tldfs umnmo;(4 renxfctydlaDe uvslt)t2xrxo3iy4lpenlivtl()arrmxrpnt1tle moeiyd s2rm( pnu)alermf3iatlmtrlnvi;s)tetm(opiu4ap   neia(  rrrx  nt4opx iociad m ua(vpnt0tlxnxf tydlmD  ueo t s2xmxmpnudlpe mncilt s2tmu onu0tlenio3iytlmDeanmonu4 eermrciatfatrauvs s s2ur(r3oy1lme liesatfarra(rp;o1aptomictys s eln o;u4 rtomr io1fmDrluvsl()setoimpno1llen nctasfsrraxr ot4teeo i3iydfs ua( pnu4aexrmr totfptrln s;(0 2xmxopoo1apte nvilt)s2rru pno4apt moeias sDeanvo;t4 eermrcta1omDeaivs;t0setoxr no1lmtn net tf Drru pou1tlxoiociasfsDua(vo;(0tltrxf3iytla raivs;s trxo(opiudll  lnctatfs2ururpnu0tltomo3tls sDuanvonu0 rxomociodoat  neo;( trtrirpoy1lm n ictas srrmur ;t0aleomi3iytlm2eauvpnu) rxrxfctadla eaivi s) 2xrxm oy4llenlfeilt) Drau poo1aetomi3ildls elump t0aeenmf ty1lm elneol(0 rtm(mpoudolte ietat)sDrau pot0alxomoetytlm rmumonu0 etriociy1fmtran o;()t2xoxrpoy4aptnlncsat) 2uaxmp;u4teenif3iatfs emu o u) lxrmr3todla e n ol( texo(m3iudamtnlicsasfa2tmurpnu4oee  feiydfm ulnvp () eenxr3todop rli s () 2xr(m3nu4op n icsas s2raumonu1aeenmi3iytfa2um( o;t) rxnmr3oa1laDrai il(0setrim3oy4amtn fvta()arur( ooo0opeoifciys sDuauvo u4trermfcta1fa e neil( s2toir3nudllt mfei sfaDrrurpnu4tex iietyd a ulumpn(0areoio3oo1fm  luvs;s) ruoxrpnu1alee icslsfsrumurpno4altoio3ils m rl(ms;t4aetrif3tatfaDrauvs;t texrim3iydoptemivilt)artru p;t1tee mi3tydlaDemnmpn(0 renioctytop   ues;s)setr(r oo1lm nlfcslt)sDta(mpou0aetnmieiydfaDumumpnu)aexrif3totlp ranvi;(  rxrim oydale mivtls artmxmp;t0open i3tlsls2eanvs;t)tleomfcoodlm e nei;(0 2tr(o no1om n fcilsfsDra(r nt1aptnmi3iydfaDrl(vs;t0 exniociotlmt livo;(  euriopiu1lmte fvi ()arrmuro;o1openmi3ilslaDean p;t) rtrxr iytop elu o t0s2toim3oo1llenmnvtas sDrmur ;o0ape mf3tlsfa uanvp;u) ltrif ty1omte iei;s)srum(r ou4am elfci sf 2ur(r nu0opeomo3tat s um(mpnt4tetomrcoodoaDrauvo s  eurxm3ny4amtnmivsa() 2tmxmpou4aexniociaslmDea(mont)arxrmo oatlmDeanvo;t0trxr(r3iy1apt livta() rum(r ot4aet mf3iytls emnmpn()artnio3oa1fpD auei;s  2tmxm oodal   ietat sDrmx pou1aleomfciydlaDeluvo;(4aetoifcty1oaDelneils trtrio oy4alen nei t) 2uaurooo4tex ii3iys aDran sn() rxnmrcto1fatrlnvol(0 2to(o3oudale lneia(faDrr(monu0tltnio3iytlmDumnms;u)trtomfciodomDelnes t) euoir3oo1openlnvs s  Dumx  ot1apx iieildls2eluvpnu4 lenxo ia1lmtr uvolt  rtrir nodaptnlicta()srrm( poo4tltoio3ild aDemnmon(0 rermrciy1fa raivi t) 2uo(o nudolte fetltfsrumx  nu1opx ii3tasfa2ra(vp u)areoirciydlaDran i t)tetm(rpiodlmen ivilt a2tmxr no4ape  fetldfsDrmn p t4alenxo3oy1fateai sls s2urxmpiu1am  lneslsfaDumu oou4tptnio3tas s2rl( onu0 exrxr3ia1oatrai s t) exmio ou1lmt  nvt sf rta(m ;o4aee mietadla2rl( p;(4altnxr3oo1fptelueil(0 rtrim3nu1aptnmnvtasfaDtmx  ;u1oetniieild s2ranvp;u)altnxr3oodomt au o () exoiopnu4lp elncta(fsDta(  nu0ole iietlt a2uauvo t)alxrmr3iy1omt aueolt0setrxopiydlltnmieslt)arum(mp;o1aptnmfetlt a2ua(mp (4 rxrxr3todfpDeln i t0seumxo3iudol   ieiltf Dumxr nu0oltomoeilt mDrmuvont0tltrxrcoytfatraieo (0 eto(rpnodol n nctlsfaDurumo;u1aeto i3tldls2elumo;u0 eeoxf iatomt  uvslt)s2xrxo3iy1optn ivi t)srtr( pot4alxomietydfa2uluvp;(0 etnirciadlmD  neil() 2urxmpoo1lmenlfctls)sDrm(r nt4opx io3tad s ulu on()arxnio oatfp  lnvs;(  rum(opiu4amtemicsa(fsrururpno1tlenmoctytfaDra(vsnu4tlxoir3oytfpDeliei;s s2tmxr3nu1amtnmnvia( srraxmo;t0tltn ieiytfmDul(mp u) eeomr io1lp r ues t)s2tmxmpny1ol elfviat  Durxmono0aexomoeildfa elnvs;t0altniocootfat lnvo;t trtmxo3oudale  fciatfartrxrpnu4teeomfciad s2uln o;u0 ltrmr oo1lpDrlu o;(  2umir oo4op n ncslsfsrrm(r ot4oexnifciyd aDeaums;u0tltoxo3iatop  ai sls0seumxm3iu1alt lfcsat s2taxr oo4aexoioeias a2eauvs u4 lenir3iytfatrlu sl(0srur(o3nodolenlnvtls)srur( ono0tpx  f3tydfm2ea(ms (0aexnifctodfaDelies;(0s2xr(o3nu4olt lictls)sDrauro;o0aee mi3tat s2eanmo;u4 ltomr iytoa   u o;(  rur(o oydlpt  net sfs2tmum nu0teeoiociatlsDrlnvs;t4 rtrmf3ia1fmte n o ()texoxr ny1oleemictls) rur(  ot4oetnioeias m2umuvo;(4 rxnmrcoytfpD aies;t t2xriopoodoltemncilsfsDua(roou4oetniictys sDul(vp;u)trtnmr3oy1lat lues (0tetoxm nudopen ivtl()s2tmumpot1tpeomociatlm elnvo;(0artnxo3iodfpDe n o;t)trurimpny4oltelfcs s) rrrump;t4oexomo3ilsls em( o t4trxnxr oo1lmDeai s (0t2trxopny4lm  mics tfsDrau p;o1aeen icias s em(mp;(0trxrir3iy1fmD  i o s trxm(opoo1lmen nesatfsDum(m ;t4texoiietat aDulu o;(4aetnmr3tatlm e n slt)s2xmim nodapenlnviat)arurxr ;o4tltomoeilt s umumo;(4artoxo3todla   i i;t  etrim3iu1omt lneslsfsDtm(  ;u0altn fciat aDrlnmo (0 lxoif3iytom ean i s srumim3iy4olt lnvta()srrmx p;o4tptn f3tld m2em(mo u0tleoxrcio1lpD  nvslt0s2xr(rpiu1alenmnes sf rra(m nt0altnmieiadfmDranvp;(0 ltrir oa1lmtrli il(0 2tmxo3oo1llenmfcil(  Dum(mo;o1apto oetyd m2um(vonu)trxrifcoatomDr nei t0truo(o oydlmenlietls)arurxro;t0apxn f3tltlm2el( s u) renif iydlmtelivi t) etoirpiudlptnmivtatfa2uru  nu4oltomfctyd s um( pn(0texnio3iytlpDrlies s texmxrpoudapenlnvsls)arrmumpou4altnioeiad aDeaumonu0trenir3iatomDr ivolt s2uoiopno4lptelfvtat sruru  nu1alxn i3iys s2eluvs u) lenifcoodlmDraneils0 2trir nodllee fesl(  ruaumpou0tlt iietyt a2emnms () eerir iydfatrluesls0t2uoxrpiu4ope lnet (fs2tr( p;t0texnifetasfs2el( snu0 lermf oy1lat  ivols  rumir3ny4op emfvil(fs2ua(  nt1apeniieiydfaDem( p;(4teerio3iotlpt  n ol( s2trimpiudope  nei sfa2urxm nu1tltnifcias aDeaumonu4alenxrciadfmt lu sl(0seuo(o ny1opt lncsa() 2um(ronu1tlx miciad a emn o t4 rxoifciodopDranvols0t2uoimpnudalt  nvsat s2uax  oo1aetnmiciyt mDulu s;t) etoifcty1oateaivs (0setoim3oodlptnmfctltf Drax ono0aleoio3ils m umuvs ()aeeomf3to1omt auvil( teurir oodopt lncil( s2ra(  ;o1opeomietldfa2rluvs;(4artrmo ty1laDeluei ()trto(m3io4olenmfcs t srrr(ro;o4aexn i3iltls2ean onu4 exnmfctodfp rauvi;( setoir3iu4omeelncsltfa2tmx  nu4aptnioctyslm2rmnvont4 etrifcio1late nvolt)trtmxm3nu4altemfcil() Dtmu  nu0tpe if3tyd s2rl( p;u) lxrioctytfmDean s t)setmxm oudolt mivs t)a2tm(m nu1alxnifetaslmDumnvp u4tltomf3oo1omtr i o s0 etoio oodaltn fesa(faDua( p;o1ale ioeilt aDuauvs;(4trerxrcto1lat aieo ( tetmxo no1lpte ncta( srrm( p;u1apeoiieiytla rlnvo;(4 ltomo3ty1fpt auei;t)t2um(r3iy1alenlfctls) 2tm(r ;u1olen feiat m rmnvonu4tlxoir3iytfmteln o t0sexm(o3oo1om nlici tfartrxmont0tpxn ieiysfmDul( s;t) rxnir ootlm elu o;() rtm(m3nodlptemfvilt)arua(rp;t4opto o3iyt m2ua( snu)aleomr3todop elieo s0srur(r3io1omtemics s a2tm( pnu0oex ifciydla2umu o t) rxriocoo1lmD  iei;s0seum(m iy1op elfeiatfsDtrurpot1apt  o3tad a elumont0 lermo3tytlmD  ueils seurxo3iu1ap  lfvils  Durumoot4aeeoiiciytla emumsn(4 eermrctatfaD anvs s srto(o iu1op elnetasf rrmu pnt0olxnif3ilsfa2eauvs;u4tlxnmf3oadfmDraues;t0teto(o io4lpt livsas)sDurx p;t1tpt  ieiytlsDemnvs;() rtrmr3oodfm  ai i (0sruoxr io4al  mfcilsf rurxmo;o0aee mieiysfm2raumo;u0 rtnmrctotfa   nvols trum(opiu4amtnmivtls)aDrrxrpno0tpto ictytfs2uanvp (4trtnxo3iatfaDranvols setoim3nodoptemivi t srraxmonu1tpx  i3iysfm ulu pnu0alerxr3tatlmt anvi;t)sexm(r iu4lltn neia(f rraxronu0alenif3iyt sDua( o;u0arxnxr3iatfaDelivs;t0s2xmxm ny4lm emfetasfsrtmx  nu4aetn feiltfaDra( pnu)aeenmo io1lmDeaies (0 2trio3iodop   nvsat) Dra( pno0ale  fciyt s uln p (4 ltrmf3oydlpD ai o (  rxmxr3nu4opt mnvtlt) Drm(ront1tpeomociasla ulums;t4trtoxo tytlp  livo;s) ruoir no1lm nmncta( srrm(rpou0tptniieiasls rmums (0aexrir3ootoptelieilt trtrxo3no1amenlnci () rtrum ou0tlt micildfs2ranvp u)tlenxr to1lmD  nvi s0trtoxo3iudope  fetlsf 2uaur no4opxn ictatlm emn s t0 lerir3iytfm r ivsl(0t2xoxm oodlp elfct t aDrr(rp;o1opxomoctatlm2ua(mpn(0 renif3tydfa   n s;s sexriopno1ol emncslsf Drr(r ou0tlen ociadla2rau p;t4teenir3oatlm ean i t)s2uoio oudomtn ictat)a2rmu oot1ale iiciys s um( pnu0 renxr totlmtr n o () eumir oo1amee ici (f Dtaum ou0olx moeiltla2em( o;(4arenxf3tydfa r u i;(0seur(opnudoltelicsls  Dtmxr ;t1altoiociytlsDranmpn(4aetnmf iatfp  li i t0s2urim ny1al elfci (  Dua( ooo0aexn fetat m ra(vsn(4 ltnio3iotfm e neilt trumir3io4lmen fvi s  ruau o;o1aexo oeiltla uanms;u) ltnifcoo1lpD lu o ( trtoxo3oodal nlies (f Durur ;t4tlx mf3iadfm2eaumpn(0tlxnircoo1fat lueo;s0trxmxm oy4lle  net ()arua(rpno0aeeomieias a2ua(vp;t)trxrmo3oodfmD  i o s  euo(m3oydom  mnet ( a2raxmp;t4oet  feiat a emn ont)tlenifcty1lp rlueo;t  eurxm3io4al  mfcsl( aDtm( oou1aetn iciyd s2ranvo u0alerxr oy1fm rlieslt)trxoir3io1aptelietlt aDuaxmooo0tpx ii3ildls2rmuvp u0 ltnircoytlaDrlneo t teuoirpoo1ll nmnesls) rururp;u4apeoii3ild sDranvs t4texomo ta1lpD luvs;(  2urxm3nodomeemfcsas)aDumump;t4aexnio3iltfsDel(vs t4trenxf oydfptelueo s0 ruoim3iy4optemfvsl()srta(r nu4opeo feildfs2eauvp u4aetoirctadlmt auvs s0trurxopnu1oltnmivtl()aruaxmo;u4tpxniictytlmDemums t4tlermfciotopte nesl()s2toir ou4lp e neiasf 2rr(root4aptnmi3ilsfa ea(mo;t0teenif oydlatraneo s srxr(m nydomtn ivtl( aDtru onu4texnioctatfa elu sn() ltomf3todlmD aieils)setmxr iydlm nlfvs sfs2trx pnu0oetnif3ilt m rm(ms t)tlxoxr3oa1lmDraueol() etoxr3ny4aptelivsat) rtmx o;u0oeeo oeiltfaDumu o u4tlermf3tadlm eanvs;s t2tmxm io1lltn neil(fs2rr(mpnt4opt mi3iadfs ua(ms;t0arxoif3ia1oa r n s;s)srto(r oydom  lnei s arua(rpnt1apxoiicias sDemump;(4teenir3tatfm   uvol(  exo(rpio4lpee fvsasfsrum(mooo1apxo ieilt m ul(vo u4 leoio iytfpDr iei () 2umxr3io4alt  fcil()arrr( p;u4texn i3tas s2rlnms (4arerxocoo1oaD  ivi s) 2tr(o io1aptn ics (f rrm(mpoo1apxo f3tys a2uaump;() rxoio tytlpD  ieo s srto(r3oy1am  mici (  Dta(rpnu0tptoifciys sDemuvp;t) lxrio tatlptrau i s teur(rpnydol n fvsa(faDur(moot0tlxomoetasfmDulnvsn(4trxnmo3io1oat livs;t s2xrir3nu4ome mietat sDta(mp;t4ape ifctasla2eaums;u) leoif totopDr ies;s)trxm(r nu1optelfetlt)sDtrurono0alt  oeias a2ulnmpn(0tetnmo3ta1fmDr uvils0t2tr(mpoy1oleelnes s srrm(moot4apeoiociadlaDea( o (4trermf3to1lateaieols0seuo(o oo4lm emncs (  rtr(rp;o4aee mieiyslm emnmp;t0alenmf oy1fmD  ueo;t  rtrimpnydome mfvil(fa2rmx  no1alxnif3ildfm2uluvs u)teenif to1fptr ieols)texoim oy1lpee icilsf 2ta( o;t1apxn oeiysfa emn p;()altnxf3oadoaDrlivs ()teuoimpny1aptn ici t aDrm( p;u0texnmicildfa2eaumsn() etnxocoatfaDr ivo ( seur(r oydlmte fvtasf rrrur nt0aptoifciasla2raums;u4tlenmr iotlpDranvs (0trxrio3nodllenlnesas) rururo;t0apt ii3iyd sDrluvp;()tleomociodfpt aies;s0 exoimpiudol e nctat) 2raurp;t1teeoiocilt aDuluvs u)tlxoirciatlmD lnei t) ruoxm3oy1openlicsls arta(  ;u1ape mictlt m ranvpnt4aetrxr totoptr i ols  etoxrpnodamee fctas) rtmuroou4aexnmiciadls uauvp u0arxomr3iotomte u o (0trurxrpiu4lme  nvil()aDrmum ou1tptnio3tadfmDemu snu0aetnmo oatlmD ln ols0tetr(rpou1apeelivtasfarra(rpnu1tpxn fctat m2ul(vs u) rerif ia1omtrli ols s2trimpiy4lpt  fctlt) Drmur nu0texniietltfa el( p;t0tetrir to1late n i;s  exrxrpnudopeelietlt aDum(m ;o0apxo feiltfa2rlu o;u4aetrxo3todoat lueils0sexoim3iy1ome  ivsa(f 2tau onu0tlxnif3ilsfa2uaumsn(4trtoxfcty1lat aues;( srur(o3oodopen nvslsfartaumooo0alt ifctad s um( o;u)tetoif ia1oa  lu ols  etm(opny1lltn netlt) rumxr nt0optnii3iysla2rm( s u0alxnxrcoytfpD  n s;s tetrxr iy1lpt  fcia(  ruaxmpnu1oexnifciysla rmnms t)altrxfctytlat  ueilt0sexmio3oy1ap   ivia(f 2rrx o;t0optoioctatfs eluvpn(4 rtomf ootfp ran sl()s2uo(rpoo1opt lfctl() rum(mpoo0apen ieiasfm uaums;t0tetnio totopDr uvo;s0 euoim iudlmtn ivta(faruaumoou0alenmictysfsDumnms (4tlxnmf oatlpDelnvi ( teuoxo io1ol nmiciltf rrmxrp;o0aptnmociasfa2rm(vpnt0aetnxr tatla   iei;(0srtm(o3ny1oleemfvsl()arrax  ou0aex  o3iad s2rluvo;u0 lxomocoa1lmD  nei;t)s2xmxo oo4ape mncsa(fsDtrx oou4ole iieiyd a2umums u0arermf3ia1late nvo;(0 etrxr oudlpe mietltf rum(  ;t4alxomo3tat mDelnmsn(0altrxociodoat  n ilt s2toio oy4ol emfei ( a2rru pno0oltnmfctldfm2ra(mo u0trtrmr3oytlpteauvs;t)teuoxm nydoptnlneils) rrr( o;o4tpe  o3iltla2eanvont)trxoif3iotfmD anvsls trurxmpiudoptemnvsat)s2uaurpou1optnmfcils a2uluvon(4alerircoadlat ln ols  2um(mpiydop e fvias aDrrx oot0tee ii3ilslm2elumo;t4aexomo3tytopt  uvi;(0t2to(r nudaltnmnvtlt)sDrmxmp;t1olxomf3ils sDea(ms;(4aeeoio3ty1fp r i i;t t2umxmpio4lmtnlfvi s)artm(  ot1olx mfetasfm2ul(mon(4alxomr tatfmD au ols0 etm(o iy4apeemnvsat srum(mo;u0aptniocild aDelu s;()artrxociatfa e i sl(0s2umimpou1apen fvs t s2uau  ;t4alx  fctldfm uau onu0 etnxr3oy1fmtelies s teurimpiy1oltemneilt sDrm( p;t0tlt  feild a2ranvonu) eeriocoatfmDe u sls)srtr(o3nydamtnlietas)s2rax pnu1tpxnmociat s2raump;()artnir3iodlp   u i s)s2uoim iu4op  lictl( aDrrxr nu4ope mo3tatfa2rlnvont)treoio todlmteanvi s seurirpoo4om nlfcia( srrax oot4opxoiieiadfa ulnmpnu0 rxrxrcty1late u i (0t2um(rpoudlltn ivs tfsDrmum ou1oltomi3iatfaDrl( snt) lxnmfctotfp  lnes s) rurio oy1optn ncslt) rrr(r ;t4tpeo o3tatlm2rm(vp;t4tltnmr ty1faDeaieolt  exr(rpiu1lmen fct t aDrr(r nt0tlen icilsfsDea(vs (0tltoxr3todlatran olt0sruoio nudlltemnet tf rtr(rp;u0oeeniietldlsDuanvs;(0 exnio oa1lmte u o t) 2um(r3iu4ll nlfcsltf Durur nt4tpxo i3iyd sDuluvonu4treoif io1laD  ieols  etrxo nudoptnlfcs sfartrxr ot0olx io3iytlmDulumsnu0 rtrxocoadlp eli i (0 rumirpnodamenlnvtlsfsrtmur ;u0optoiictad s2rlnvpnt0aexnmo3oo1lmDelnvs (0 2uo(o oudale  fvi s) Dumxr oo4apxn fctysls rmnvsn(0 rxrxr oo1oa rluvs t0 2tmir iu1lmtn fet () Drax  ;t4aee ii3ilsfs2ea( s t)trermoctadomteln slt0trum(r3io4lmee nvtat) 2ra( pnu4tetnmf3iltfs rmnvsnt0 rxnmocoo1fp rau o;t) 2ur(m3oudalte fcil(  2uax  ;o1apxnmo3iytfsDrauvsnu0tlxnmo3tytfpD  u i t) exoxr3nydoptn ict tfa2rru poo4optomictydlaDrauvo;u0 etnmr ty1lateauesl()trtr(opno4ol nlfct s)a2rmurp;u0oexomfeiysfm2eanvo;u) etnmf iatla e nvs s truo(o oy1lltnlietltf Dumx oou1oeeo icilt m2emu p;u)altrmf3oodfaD  ieils0 ruo(opou1alt  ncsas)sDua(m no4tpx mi3tyd m2rm( o (0aetrmf oatlmDr i i ( t2tmxr ny4olenmfeslt a2taxrpou4tee ioetltfaDemumsnt4tleomr totlpDelivo t) 2urio oo4altnmfvil()s2rmu  ;t0optomf3iat sDea(ms t4tlenmocoydomtrlnvo;t  exr(mpny1oltemies s) rtm(r nt4opt ii3iltfsDea(mon() ltrifciadlateli i;s0texr(r3oo4lp n feiatfaruax ooo1ope  oeiys m2rl( snu0 rxrirciotla  lu ol(0trxmxm3oo4ape  iciat)a2taxr ;o0olenii3tytfm eluvonu)altrxo3iodfm  lnvo;(0t2urxo3iy4omtnlnesl( s2trx pot1teen o3iasfs2elnvo;(0trenmrcoo1fmte i slt sexoirpiu1ome mncs t  Dtauront0aeto ieiydfmDel(vo u4 ltoxf3iadfpD  neo;t)teurio oy4lpt  fet ()aDtr(ro;o0olt  fetyt aDulnms (4trtnmo iydopte ieo;t0t2um(m io4ll nlivt s arururono1tpeoif3iytfs uauvsnu)texrmf oytomt auvolt)t2tm(r oo1olt lietls  Dra(r no4teeniietydfsDel(mo;t4areomo iotlmt anes ( t2trxmpio4amenmfviat) rra(mpno0tlxo oeiad a2eanvp;t0tetrir oodlptr i s;s0 2urxr iu4apee icil( a2uaxmo;u0alen o3tldlm2rm(mpnu) reoircia1lpDe ivs;( t2uoim3oy1llt lfei (fsrtrumo;t1tpx ii3iyt aDrm(vp () ltnmf iytfmt aivo t) 2xr(r no1op e ies s)artr(mp;o4aex ioeiysla2rmnvp;t0aexnmr todomDean o;t0setr(opiu1om nlietl( arrrump;t0tetomoctltfm2rmn snt0arenir tadfpDelueilt)srxmxo io4amtn iet s aDurum nt1oetniiciatlmDum(mp u4altnmr ta1lp eaivolt0t2xmimpnu4om e fct () rum(ront4openmi3iad m2rln snt0arxrmf3todoa rauvo t0s2ur(m3iu4optemnvtat sDrm( p;o0altomoeiatlsDuan p u0aeeoir oadfa rlivols s2to(m no1lmtemncsas)srrruro;t4oetoioeiltlm ean p t) rerxo3tytomtrlivo ()srtm(mpiu1ame mncsl()aDtrurpou1oee mf3ildfm2el(ms;t4tlermrciy1la eanvs;s t2uo(rpiy4lmtemfvia()a2rmx onu0apenioeiytls2ua(mpn(0 etnmr oytopDrln s;( t2xrxmpoy4amtn ics (faDtaur ot4ole  ociyd s2rmu s u4trxrxfcoatom   iei;t srto(m3nu4amt mfci t a2rrxmpnt1alxn fciytlsDumu o u0tltnir oy1lmDeluvsl(0srtm(mpnu1op emncilsfarururonu1alxomfeilt a2emnvs;u4 rxoxf ta1lp   nes;()sexr(m3iy1alenlfctl( a2taxroou0oee  feiydfs2rm( o;u0 rxoir iotfptrlu o () rur(rpio4ole mfeslt) 2rrur no1oeen feiadla2ulnvsnt0teeomoctotfa elnvil(  rtm(o3nydll  mnvsltf 2uau o;u0aet if3ildfaDulu p t) rtrxr iatfpD  nvo;t sexo(m ny4lmtn iviat) rrmu ono1oex iiciyd s2uanmsnu4alxrmo tydlmte ivo ( seurxm nu1lpe  nciat)arur(  nu0tex  octadlaDumump;u4 etrir iatfpDrluesls  2xrio io1op n iet sfsDrm(mpnu4aptnmoctat mDrlnvo;(4alerif3ty1om  li i t)s2urxm3nydlmeemictas  Drm( pou1ole  iciysla uan s u0aleomr oodopD aies ( tetmiopiu4lpee nvs tfa2tax  nt0opxomf3iysfa2em(mpnu0arerioctotfmD auvi s0 2uoim oy1aptnlnvslt) ruaxr no1alx io3tyt m rl( o t4arxnircta1omDr iesls  2um(o3iy1lleelivtat  rum(mp;t4oeen o3tas m ean o u4artrxocoy1lmtelivi t s2xmxo ny1openmiei s)srtax ono4aeen octadfa umnvp (4teermr iadoa ranei;t0truoiopiu1amtemnvs (f Dumxmo;t4aee mfcias m elums;t)trxnxf ty1op raivs ( t2urio ny1op   ici ( aDtr( oot4ope ifeiasla2rmn ont)altrio tydlaDeaivs t0 eur(rpou4ap emfci sfarrmx p;u1oltnmfciltls2umu o;t) lerifcoa1la e i o s0srurxo3oudamt lncta( aDumx poo1aeeoifeiatfaDrmn o;t4 eenmr oa1opDeanei (  2tm(r3iu4ol emicsl(  rtaxm ;o4tex ifeilt aDua(vp;u0 rxnxr iadfpDeluvsls0srur(m3oo4aleemnei tfsrrau  ;t4ape iieildfmDrm(msnt)arxnxf3oytlaD lu i s)sexo(opnu1olee icsa( s2raxrp;u0alt  ieiadfm ua(vp (0artomf oy1lp  li il() rxmxo no1lp  lfcta( sDrru  nu1alxnmf3iasfmDuluvp u) lxrxo oo1omtr neils t2xr(m io4opee iesa()a2uru  ou4oetoifeils s2rmn p t0tlermocootfpt ai s ( trxo(o3ou4lpt lfvtat)sDumumono4opto ociytls rlu o;()trxomrctodlmDeaieo t0sexmimpnodame mfeiatfsruaumoot4apx  ictldla2rm(ms;u4 exoxr iy1lmt lneolt) rxr(rpiu1opee fctlt arta(m ou4apxo octltlaDrln onu0alxoxf3oodfp   u i s0trxoir3iu4amtnlfvia()a2tr(mpou4apx  f3tltlsDel( onu0arxnxr3ootoaDranei;s) 2urirpou4ap nlici (fsrrruro;u4aeeo fetltfs ranmo;t)aleoir ta1lmDrlneo t0srxoxm3ou4lm emics t a2umum nu4altnifetld m2el( s u4 lenir3tydfmtelivo s0 euo(rpio1om nlivs s sDrrx  ;t0tltnmiciys m uluvp u4 eerifcio1fateaivi;( srtrxm oydam nmivi s srtmur ou1apt ii3iat sDrmums u4aeerxr3oo1oa e neol()t2xmir nudlpeelivtltfarrau p;o1tptnmieilt s el(mo u0trxrxr oytlate i s;(0tetm(mpoy4oltn nvi sfarta(mp;o0optnmo3ias s2uan o t4trtrmr3oatfmDelies;()teurxrpny4lle  fctl(fa2trum no1teeomfcias s2ulump ()tltnif3oatlpD livsl(0trxr(rpiy1apt mfctl(  2umxrp;t1opxniieilt sDemumsnu) renxf oatlp eliei ()teumxo nydamt mnvtl()srumurp;t1apxnmociyt sDra( o;t4texnxo3totlp  luvs t sexmxm3nu4opee fvi tf Drm(mooo1tleoiocildla uaums;t)trtrxf oa1op eanvsl( srto(r nodom n ivtatfsrraurpot4tlx  ociydfaDua(msn(0arerxoctytlmDrluei;()s2tmxr3iodlmenmfetat)a2rr( oot1apx mf3iasfs el(vs;u)tlermf oadlp e i ils0setrxm nydap  mnei t)srumxmpoo1tlxomfetltlm2eanmp u)artniociytom  aueo;t)tetoxopoo4om  mnvtatf 2uaxmoou4olxomo3ild a eau pnt)aexnmociotlm e iei;s  ruo(mpnu4olt mnesa(farurx  nt0tpxomf3iytfsDrmnmsnt0aleoir3iatlpDeli olt0srtm(o3nu4op nmncils) Dua(mpou4tex  feiltlmDrlnvs;t)altomo ia1lmtrlivi t t2ur(r3oo1omtelfetasf rurumpnu0oetnioctas m2ea( p t4 rxomo ta1om elnvils0truoxo nodlptnlfcia( aDrmx pnu0tlt ifcilt sDul(mp u0treomr iotop  auvil(0sruriopoudom nmnes s srrrumpou0oex  i3tad sDuaump u0tetrio3tydlpD  ivs t)tetoxmpou1ape  fvia( s2rmump;t0optoioctad s2uauvs;t4 ltnircoydlaDeau slt) rxoim3oo4ll   fci ( srtrxrp;o0oltnii3tls m ulnmpn() lxnxrcio1oateanvo t)sexrim3ou1am n fvilt) Dra(mpnt1oetniociys a2rm(mp (0trerir ty1lp raieol() rtrio3iydame livs sf 2tr(  ot0alxnioctlsfsDrmumo u0 etrmocoodoptelu i t0 etmir nu1altelfvtat)arraxr ou0alt  i3iltfa2eanmsnt4 rxoir tadlaDrauvilt)setmxrpio1al n fvta( sDurumoot0apt  ieildfm uauvp;t0 rxoxf iatlp  lu sls  2tmxm iy1lmt mietlt  Draur ;o1oet iictlt a2emuvs (0aeerxocto1fp  lu o;t)t2tmim io1omtemfviat)srra(  ;o0apxnmoetytlm2ulu snu0alerxrcoo1fat auvsls) rxr(m3oydoleemnvt t s2trx  ;u0tltnmictysfmDelnvpn(0altnmr oadoaDe u i t0 euoim3ny4amenmfvi tfaDra( pnu4texo f3ild s2eanms;(4alxnxfctydlaDelueo;t seto(r nodam  lfctas  2rrx p;t4tlt ifciydlsDrl( o;t0alxrmociodoaD li s ()s2xr(rpoudap  mfctas)s2rmur nu0teto oeilt a2ul(ms t0tleomf iotlaDeaivil()sexrir nu4opt lncsls arraumpnu4olt mf3tydlsDelu pnu4tlxoxf3iodomtelies;t)seuoxmpnu1ole lfvsat) 2truront1tlx mf3iadlsDrlu o;(0arxrmrctadoatelues t0 euo(m no1op  lici t aDtr(  ;o4ale mieiadfa2uanvpnu0teerif3oo1fa e u s t0tetmio3iy4ape  feil() 2tr(rpnt1oleoifeiytla2uln o t)texrxr3oadfaDe u sl(  exm(m iu4ll emfctlsfaDtrxmono4tet mfciyt mDumnms (0tetrmo3oo1lpD anvi s0t2xmxm3nydamtnlnvta() Dtr(mooo1aptoifciasfmDrlnvsn(0aexnifcty1faDeau o;(0sexr(r iudamtnlneil() Dtau  oo4apt ii3iytls2rlumon(0altrxocia1fat li slt) rum(r nu4al   nctatfsDtr(mpou1tlenmocildfaDumums (4alxrmfcoa1opD aueolt0t2xrirpnodlp  livt t)sDrm(rpou1tlt  f3iad mDemn on()texoio3iatlaDr nvo () euoimpnu1lp  mfvils  Drmxmpoo0oee io3iytfm2rlnvp (4 lxoxfcoy1fm rluvo t)teuo(m iudlptemnet tfsDrax ono1olt mo3iadlm umnvp;t)aeenmo ootfp  ai ilt teuo(rpoydom  mnct (fa2trxm ;u1oltn o3ilsfsDea( s;u) rermfciatla eaneo s)s2tm(rpoo4om  lnei ()sDrm(mo;u4altomociadls2uluvs (0arenmo iy1fp e n il(0trtm(o oy4ope  ict tfsrurur nu4aexnmf3iysfmDrmuvp;(4 eenir todoatr ivi;t0sexmir nu1apt  nvta(f 2um(  ;t4tex iictytfaDrl(von()aeermo3oo1lp rlueol(0seuoxm3oy4al e iet (fsDumxr ou0alxomo3iadls2eaums t0 ltomr3tadoat  ivo (0 2xmir iy4op nmnvs s sDuaxmpoo4aexnmieiaslmDrl(mont)arerxrcootfp rluvs (0 2umxopiu4ll nmfvs sfsrrru ooo4opxn ietlsfa2ranvp u)trtnxo3tatfmD liei t) rtmiopoy1op  lnes s)aruauro;t0aexn fciad m2rmuvp;t)artoir3iodopD luei;t  exrxo oo1ol   fvt () Dtrx oou1tetomi3iltfm2rmnvp t4trenmo3iytlp   ivolt  rurxrpio1altemneil(  rum(mpnt1tptoioetldla ranms;t4 etniocoydfmDrlu o;t s2tmir3nu1lle mfetatfa2tmxro;t4tetnio3iad m2ra(mp;(0tetoxr ootoptrlu s s0texoir3nydal   fcs tfs2uru p;u4apx mietyd a eau o;u0altrio3oatomtran ils tetmxo3oo1al   fcsls) 2ur( ont4opxomo3iydfmDra( p () rxoxrctadfaD  nvi;s0 eum(mpoydlme lnesa()a2taumpoo1oeenmietadlmDea( o (4tetoio io1opDe u s;t0 exm(o3iodlmtemivia(fa2raurp;u4tlto fetatls emumont4texrmr3todomD an o ( setr(m3io1ap nmneiat)artaxrpot1optnmietadfsDul(mo t)alenir oytoatrauei;( t2tr(mpoo4ol   nviat)aDra(rpou1olenio3iasfm2rau s u0altrmocty1fmDeauvsls sexm(mpoy4ameemietls sruax o;o1tlx  i3tydfs eau o;t0tetnxr3tytlaD auei;s0s2ur(rpiy1amtn ics t sDraxmpot1apeniociatfmDemump t0trxrmrciotfa eau s;(  2urxo3iu4llt  fesatfs2rmxm no1oee moeilsfs uau s t0 renmrcoytla   n ol(0 eto(m3ny1openlictas) 2ururonu0tpxn icildlaDrl(vp t4 ltrmf3ootoa e ies (0texm(mpoo1ol nmicilsfsrumxmono4oeen f3tlsfmDrauvo u0 leomf tatfmt au s (0trxm(r3io4olen nctat  Durx pnt4opxomieiysfm eanmonu0aeenxf ootla r uvs;s) etoxo3iy1lmtnmivias  rua( pot0alen iciasfm rl(mpnu)tlxoxrctydfp elnvi;s0 rxoxr nudolen feils  Duaxmoou4aexoio3iasfa2rl(ms;u4tlxrxo3iadom  au sl() 2umxo io4opeelfvt ()a2ua(m nt1oeen oeiyslsDean pnu0tlerxo3oo1opDe ivslt srtoxrpio1lpeelnvta( sDtaxm ot1oleomieiytfa rl( o (0trtnmo3oy1oa  aies;s  eto(m3nu1ale micias  2rr(m nt0aexoioetydfs2eauvs;u4tleoif totfpDe ueo;t)trtrxm3iu4olee feslsfsrrrx o;t1aptomiciyslm2em( p ()texrir to1fp rlu o;s)trtm(m3no1al emfet (f 2urx p;t1tlt  oeild a2eln snu0tlxnmo3oatomDeaneilt0teumxo iy4alt  fvslt srtrxr ot1opeoio3taslaDelnvon()aetoxrciadlateai i (0s2xoim nu1ape  ivt (fa2umxr nu0tlenmo3ias aDemumont0 lenifciydfm   ieolt0 2tmim3no4am emnesat aDuaxr ;u1alt  f3tysfa2umnmo;u4aetrxf3iodfa  lu o ( t2urxo3ou1amtn net s)arra( p;t4tptnmo3iltfs eauvont)arxrif3iatlmte i sls teuo(o3iu1lptn nviltfaDua(ronu4aetnio3tlsls2uanvs (0 eerif3tydlptrliesls trtr(opny1ale mfctls  Duau ono4tet  ietad m2em(msnu4 rermrcia1omt aiei;s0truo(opou1aptnlnct t  2uru p;u4aeeo iciltfs ul(mo;t0texomr oatlat  nvs t srtm(r iy1ll emfvil( sruax  ou0aexomieiadfa eanvp;t4artrxo iy1fm rln o ()s2umxrpoy4am nlfesl(fsrrax  nt0tex if3iat sDra(vs u4artrif3iotlm r ivslt seuo(rpiy4ap   fet (  Dta(mo;u4olxomociydla ean s;u) lerio3tatop elueil(  exmxrpoy1am nlnet ()sDrmumono1tlt  feiytla2rlnmon(0tlxnxr3oydlmD aueils)srxm(r nu1omen ictatfaDuau  ou4altnmoeiytfs emuvs;u0 lxnxo tatlm ran slt0t2xm(o3no1ll  mfei t) Drrx oou4aeeniieildfa2uauvpnt0 etomrciytlpte ivs (0 eum(opiy1amenmfesa()srurumo;u1altn iciys aDrl( s u)artnxr ta1la ranvo s  2umir iydopen ietasfs2urx pno4olxnmfctlslmDraump u) reomr3io1omDrau ilt0t2trim iudop elfetas)sDrrx pou0oeeoif3ilsfs2uaumo u0artoifctotopt  ivil(0s2uo(r3iudamtn ncils artr( pno0tpeoii3tydfmDra( pnt4 renio3oa1lmt aueo;(  exoiopou1lp  lies t) rrax onu0aee moctatlaDum( o (0artoxo3iotopD ai s t) exm(m no4lpte iet s)srurxmpnt1tlt  fetyt m eauvpnt0texrxf oydlm   i o t0t2xmirpoudlleelivils  rtaumoot1tee  o3iasla2eluvo u)tltrxocoadlaD li i (0 2urxr3nudal nmnei ()srtaum no4tlx mf3ilsfmDrlump ()tltrxf to1fmtr n il(0seur(o3nu4olen ivsl( aDrrxro;u1tptomiciatfm2rl(mo t0aeeoio3oatopDe neo;()trxrxm nydop  lncsa(f Dur(r ;o1tetomfetasla rl(ms u4 exoio iytla eaies s) rto(r no4opeemiet t  rumu oou0optomiciyt a2uanmpnu0aexnio io1laDrlues (0 2tr(m oy1lp  mivtl( srumx  ;t1tpxnifctyd s rmumonu)trenifciodopte ivo;t0seuoxr iydapee fvsltfa2tr(m no0opto ictas a raumo t4 etnxr ia1fp   uvslt0srurxr oydolenlnvia()s2umumpno0opx mieildfm ul(mo u4trxrxfcoytlateau o;( tetmxr nodamen fvtl()s2tr(  nu4tltniieiydfa uanmo;u) rxomf oo1lat lnvil( srxmxo nodol   ivt s)s2urumooo0oetnmfctadlaDeauvs;u)texrifcta1lpDeanvols  2uoio3ou4apeelfcils  Drmumpot1altoifeiys m2emn s;u)aetnir ia1lp elu ols0t2um(opoo4lm emfci s  2ur(mpou0ole moetld a uanvsn(4 renif3iotfa  luvo;s)trxoir ny1apte nvtat)artr(m no4aetoiociasfsDul(vpn(0tlerirciatlmt lnvi (  2trimpiy4lmt lieilt)arraumpnu1oltn i3ild s eln pnt4trerio3todlat anvi;s  rtoim nydlptnlneia(  ruaumont0teeoifeiytfm2umump ()teerircoodla elivs (0t2xmxm oodome  ici s) Drrxrpno0ope  ietytlaDelump;u4aeeoxoctodfp e ivi;()s2uo(opnu1omtnlicslsfsrtm(r nt0aleomi3iydlsDrmnms;t0tleoirctodlmDrau sls t2to(o iy4alenlfctltfaDrmxr ou1aexn ocias mDuau snu4arxnmr3to1lp eauvi;t0truoxo iu4ome livsatf Duru  ;t1aetnii3ils a el( snu4tleoif ia1lp e ieslt0srtmirpiu4am emicsas)srrrx onu1apt micild aDemn p;(0 rtnxrctatop elnvolt)sruo(m3ou1ame lfvi ()a2tru ooo1olt ii3tlt sDemumo u)texoxfcio1laDrauvs t s2uoxmpoo1lltnlfvilt) 2tr(m ;t4texoifctydfm uau snt0 lxnmrciydomtr nvo;s  rtrio3no4olenmies ()a2rmurpot4olx  oeiydlm ra(vs;(0 rtoifcoatfa eli o s t2xm(m oy1ale  nes sfsDtrxmoot1apto o3ias s2emnms ()aexrmo3ty1lp  lu s;t  rurimpoo1lmtnmnvtat) rtaxmonu4tlx  oeiadfsDemump t0 rerxr3iy1om raivi (0texr(opiu4lptemncsat)arum(m nu4tlxomi3iltla ea(ms;() etnif totlm r uei t0trtoxmpoo4lmee fcsa(f 2umxmont1tlt mfciasfa2ua(vo t0 rxrmr tytfptrluvslt)sexr(r oydapte nvt sfa2ua(r ;t0tle moetyd a2emumo t4 reoxfciytlm e uvilt)seur(o iydamtn nct (f 2um( o;u4tpx iictltla2ran snt)areoiociadop   nvsls) eurxmpny1lm  lfct t) Dtaumoou0aee miciaslaDraums;t) rtoxr iytfm rliei t)trxoxmpiodamtn ics s)sDrm(mo;u1texoif3tytlsDrl(mo u0teeoxr ty1fa eaieol(0 euoxrpny1llt mnct sf Dtrur ot0olenio3ilsfsDeanmo (0trxoxr iatfat au i;s teum(m ou4omenmnesasfa2umu  ;u0aexnifctadfm ua(vp t0tlenxf to1faDeau o;s0 exmirpoy1amtemfeta()sDtruronu0tpt ii3iltla2ea(mo;t)artnxocoy1opt au s;()t2xr(o no4lltnlivsls arur(mooo1oet ioetaslm2umu pnu) ltrmrctatomDr uvi s0t2urxmpoodamenlivil()a2trum nt1oltn ociaslm uauvp;(4artnxo3oadfpDelnes s srxr(m3oodom nmictas  Dtr(r ou0tleo iciltlaDum(vont0tleoio tatfmt  n ol(0teum(o io4ope mfvt () rur(r ;o0opxo ociytfm ua(vo ()trtnmf iatop r ieo s0 2trxo3io4alen ics tfa2uauro;o0ole if3tytfa2rlnvsnt4arxoir ia1fptrlnes t)teumxrpnu4olenmivia() 2ra(rpnt0tltnifeiatlm uau p;(0artnmocto1opte uei;s t2urxo3nydopenmfctlt) 2ta(mo;u1opxomictldfs el(vsn()trtnmrctadfpDrlies;t0 2umxm iy4op elncil()srrru o;o0alenii3tadfa rmuvs;u)texnmr3io1lat ln ils  2xoimpio1lp elnei () Dtmxm ;o4teto fetlsls2emn sn()tltnir ta1lat ai ols0 2xmimpoo1lptnmnct t a2urxm no4ape mfetls a2em(vp;u4 eermf3iytoateau sls s2xm(m oudlmeelnvsas)sDtaxmo;t0oeen ieilsls ulu p u4tlxoio totoaDrau i s)s2xoim iydomee nvtlt s2rmumpot4oeto icilslsDea(ms;u0 eeoioctytfpt  ivs t) exmxm oo1aptn ivt (fsruru  ot1apenmi3ildlm2ul(mp u) rtrxoctotlpDrlu ol()t2xo(r3ny4open nvilt  2tmxmp;t4tpxo fcildfm uanvsn(4 lxoxo3iatoaD anei;s0srxoir3nudlm emfcias) ruaumo;t4ope iieild sDua(vo t4texrir3totfpte ieolt) rxo(o no4ol nmnesa()s2rax  ;u0tpto feiadfs2uau p u)trxoir oytlm rli sl( seto(m3iu4amenmivta(f 2rmxm ot4ape  octldfmDul(vsnu0 etnif oo1op  liesl() rxrimpoodaleelictl() rta( onu0tpe ifciyt m2rmu p u)texnxo3oo1lmD  i i (  exm(m nodomtn neia( sDur(mpno4aetnio3ilsfa2ra(vo;()tltomr oo1latrlu i ()seuoxm3nudllenmnesl(  Dtrumo;o1tet mf3tyd aDulnvp t0trtoxr3tatfmt an o t0trurxopnodol  mieias a2ra(  ou4aexnii3tldfs ulumo t)trtomrciydfmDeln olt0trxo(m3iu1llenmfci s s2taur ot4tet  icils aDum(mo;t0alxomf tatlm r ieols  eto(rpnu4llt mnci (f rtru  ot1olxn fcildfs ea(vo (0arenmf iatom ranes ()seurxm3no4aptemfvslt) Dum( pnt1apxoifetys s2ul( o u0trxomf tydoa rlues;s sexoxmpou4lmt  feil()sDrrxmpnu0opx  oeiasfa umumonu0trtnir iy1lmDelnvi s srtmir nudopee ivil(f Dtmx  ou4aleomf3tysfs2el(vo;t) ltomo3iadfmDe nes;t0t2uriopio4lleemfci s)s2trum ;u0oex  f3ilsfmDul( s t) lxrmo iadom   uvs;s srxmim ny4lme miviasfs2uaxrpou4ole  fctys m2uanmp () lxnifcoo1fp raues;t truoiopiu1am  mfcsa()arra(ro;t4apx  ietlslsDeaumsn(0 eeomoctadoatr nvi;s)t2tr(opiu4ol nmictlt) Duaxm ;o4tlx  ictyt s ulnms;() lxrxf3iodfptraivsl(0s2xr(rpou1lmtnmnvt (fsDra( o;u1alenmfcilsla2rlu p ()texrxfcoadlm e n o;( sexoio3nydap n nes s sDua(rpnu4olxo ociat mDem( p;(4altoxr tatlp ean o;s)srtmiopnu4ame lfesat a2rrx p;o0tet mi3ilsls rl(vp t0 rxomocoy1fm eaues s t2to(o3io1lptemict t)artaum ;u1oee mociadls rl(vp ()aexrxocoydfm eln ol(  rtmxr3iu4ll  mivt ( s2trxm ;o0teen oetasfm elnvsn(0tltomo tydfpDe u s ()sexrir ou1olen fvi s  Durxroot4aeeo f3iat a2rlnms (4tetoifcoytlp   u i;t t2xrxrpou4oltemfvtls sDrrxmpnt1aleo oeilsfs2el(ms u4 ltrxrciy1fm rlivs (0texmxopoydolt micil()a2ur(rooo4aptomf3iyd a2eln o u4 ltrir3totfpt luei;t)teumim3iy1amte ivtas) Drm(r ot0openmoctysfm rm(von()aeermo ootopte i o ( sexo(m iy4olenliesltfs2taur ;o0tpxoiieiaslm2raump t4 rxrmr io1omtelnvs t)teumxmpnodop e ncslt)sDtrx poo4oeeniictytfm ra( o t)texnif oytopt luei;s teur(o nydlltnmnesls srraur nt0aptn feiyslm2uauvs u4 lermr3tadfm r ivs ( s2xrxmpnudol eliesat srtmx  oo0olt ioctlsfs2em( on(0aetrxr3ty1lmteau sl(0trxmir3iydllte iesa(fs2tax p;o4aptomocildfs rmnvsnt0tltrir3ta1fmt au i s)trtoir3iu4lmenmfvtl(farrm(mpou0olxnio3tltfs rlu p;u)texoio iodomt anvil(  rxm(o nudlpt livtls  2rrx  ;t0alen oeildfmDulnvpnt)alxnmrcoadomtrlu olt) rxoxm3ou4lm e nvs s)srururpoo4oeenmieilt m2em(vo;t0texnmrciadfaDelnei (  rtr(m3oo1am nlivilt aDum(ro;u1texniictaslmDum( s;t0alxrmo iatoptrlivol()trtr(r iy1ome  feilt)arrr(rp;o4oltnifetys s um(vsnu4tltrio3oodoa e iesls  2trxrpiudoltnmneta()sDur(mpno4apto iciasfa2ra(mpn(4tlxrxfciodlm   ieslt  rxrxr iy1am emics tf 2uaur ou1apt  ociyt s rlnms;t4 rxnmf3iadfa rliesl(0srtm(opiu4omenmietasfaDraurooo1tpen fetas mDulumon(0alenifcta1fpteai o t0t2tmir ny4amenlfvt ()srrmxmpnu4openmoeiad mDum(vs (0tetoxf3iy1lpt lu i ()texoxr3iy4ameelfei (  Dtax pno4oexoiieiad a2eaums;u4artrxo oatoaDrlu ols)tetoir no1optemncilsf Dta(r nt4teeomo3iytla2um(mont0trtnifciodlm rli il(  rto(opiu1olte nviatf rtax p;t0opxoiietlsls2emnms;() eeoxrcty1opD lu s s0srxoxm3no1apt lfvtlsf Dumxr ;t0apeo ociadfm ea(mo u4trenifctytfa e ieols)trurxo iy1lmtnlnvt t) Draxr ou0tlto fetadlm2raums t)teenmr3oa1om   i o t0 ruoim3oo4apen nvsat aDrauro;o1tlxn i3iadfm2ua(vp;u4altnxf3oa1fa r nesl(0teum(mpio1al nlnesl( sDtrxm no1oeenifetytla uauvont0tetoxfcoa1fmtelnes;t0 eumxm3iu4lpte iesl(  2rauro;o0aeen ietysls rlump;()aeeoif3oadfate ivs;t)seurimpio4oltnlivta( a2rau pou1olenmf3tatlaDel(msnu)altoif3iy1om   i i (  exr(o3iydale mncsltf Drmu  ;t1ale ifetatlm2el(mp t) lxrxf3iydoa e ueo s)s2to(m3io1op nlncsa()aDurxmp;u4oetnmieildls2rm(vpn(4trenxoctatlpDelieils)srxrxopno4ol e ies tfarrmx p;u0altomoeiadlsDeanvpnt4 rtrmo3tatoaDeanei t0 exoxopno1apenmietlsfs2rax ooo1tltoiietadfm2uau snu0 leomo3ia1opt  nvil(  2xrirpiydlp  lici t) 2rrumo;t0tltn ociadla rmu s t4 rxoif3to1lp eauvs t seuoir3oy4am  miet t a2rrx p;o1optoiocilslsDeauvp u0 eenxf3iadla  anes (0sexrxo3io4am emfesl(fsruaurono0apxoiocildfmDrl( snt)aeenmo iatopD luvi t0t2xmir oo1llenlnesl()aDtaxmpot4tetnii3ilt mDuaumpnt0 eerxo ty1fmte ivs;(0srtrxo iydllt lfviatf Dururp;u1olx  i3tltla2elumo;t4alxomo totfpDeluvs s) rxm(opiodomtnlictat arrrxmont0tlenmo3iytla2uanvs;u) eenmrctadlaDeau s;t trxoir3oy4ap   fvilsfaDtm(roou1tee if3ils s em(vs;()altnif tytom   n ilt)srxm(o ou4amen ieil( arra( p;u4ole io3tyt mDua(vsnu0texrmf3oa1lm   nvi;t0 2um(o3oudoptn fvia(  rtmu pnu0texniictas aDemumsn()teerxf iotomDeau s t)t2to(o3ou1oltnlneilt)a2trum ;t4alenmfeiyd m2rl(mp;t) rtrxr3ia1lpDrlnei;t) euoxr nydamtnlnvt t  rtmum oo1tpxnmf3tatfaDel(msnu) ltnxo3tatfa elivsls0sexrim nu4ame mnei t)a2umuro;u0oltn o3ias mDrl(vsnt0 exomf3oodfm rli o ( s2xmxmpiy1openlivtatf 2urx pnt0olt iieiydfs2rl(mp (4trtomo3ty1fmte neol() rxrxo oy1olenlneta()s2truro;u4oltniictlslmDulu s u4aeeomr3oo1late u slt  2xmxmpoy4oltnlivtas)s2uaur ou0oex mfeiysfaDranmp (4trerircoytoat anvsls)tetrir nydomt  ivsa( srumxrpnt4tpeomfctadfs2eanvo t) reomr iydla rlivo t srxoio iydopenlneslt aDraxm ot1tptoifcild a2eluvs;t4trtnmf3oytlaD aivsls) rto(m3no1amen ivsa(fsrta( o;u1texo feilslmDul( o t0 ltrxfctydop eli ols0trtoio3iydolt  fvt ( sDra(rp;o4apenmietlt s2rln p;u)aexrmocia1oa  aues;s)t2trir ny1ome mfcslsfarurxrono4tpxniiciltla raumo u0aeeoif oatfpt auei s trumxrpoo4olte fvi t sruru poo0oeto fctatlmDem(mo;(0 ltnmo3todlateaneslt s2umxm3ny4ame mfvtasf 2um( oou4texo f3iyslaDem( p (4 eenxocoy1opDeaivsls)teuoimpou4al nmnetat a2ua(mp;o4tlen ocildlmDea(mp;u0arxoxr3ootlpDe ies (0t2uoim iy4oltnlivia(faDrr(ro;u4oltn ocildfmDem(vp t) eenmo iytfmD aivil()teurxrpoydlp n fesat)sDrrum ;t1tptnmictlt a2ranvo t4texrir oo1lpt anes;()s2toxo oo4om  lfctls) Drm(m oo0open o3iat a2raums;(4trtrmo3io1fmD lies s tetoxo oy1op  miet t)s2umxmpnt1texoio3iytlmDrmu s;() exrircoytla eli s;()seurxopnydllt lfetlt)a2rmurooo1apt mi3iatfm2el(vo u4 etoir3oatlpteanvs (0seumio nudlmtemfct t srrax  oo0oeenmfeiytfs2rmu pnu4 ltrirctotlpDe ueo;t s2xoxo3nydomeemfesls) rua(mp;u0aexnifetls s eluvo;(4tltrmo3tytlpD  uei;s  rumxr3iydlmenmfvta(fartaum no4tle mf3iydla2raums;t4alermocty1fpD  ies;s)srum(mpiy4ome mfvtat s2uauroot1apxn fetadlaDrl( s;u4 eeoif totlmt aivo;s srtr(o ou1lmenlnct s  2raxmpnu1tle  icilt s umnvo (0teeoxr oodfpDrluvo s)srxrxr iu4llte nvil()srrmuro;o0texo octatfaDel( p u4arenmociatlp ean s ()setm(mpny4ll elfvilt  2ur(mooo1tltomocildfa2rlumonu0areomf io1om elneilt) 2xoir oodome  nesl(f Dtr(  nu0tlt  feias mDrm( p;u)alenio3iatfpDelivol(0srurim3oodom  liesat arrmxr ;t4altoif3ilt m um(msnt0 rtoio3oy1oat  iei;t texrimpnodapeelnvs t  2tr( oot4olxoio3ilsls2ua(vsnt0teerif tatfaDr i o t0t2xmim iydlm nlnvtatfsDumurp;o4aeto icildls rluvp;(0aeeomr iotfa rauei;t0teurxm3iodomtemnvi ( sDumxmpno4aetomfetatls2emuvont4tlxoio oydlmte uvs;s trurim3iudole  ies ( s2uru  ;u1alenmfciat s2eanmsn(4 rerxf iytla eauvolt trtoxmpny1op  lfcsa(fa2trumonu1alx io3iasfs umnmp;(0aetrir iy1opDelivils0srum(mpnu1al n nct t) Drrxroou0opeo f3ildla2rl(mpnt0 lxnmr3iy1omt  iesls)texrirpnudope  fctls artru p;o4aetomietasla ea(mo t)artnxfcoy1oa   uvsls  rumir nydlm n fvsl( arrmu ooo0aleoiocildls2uluvpnu4 rxoir iy1lpDraneol( sexrxrpnu4ameemfvt ()srrm(mp;u1olxo ietld a ul( s t0trxrmrcootopt anesls  2tmxrpiu4oltn ics sfarrr(root0aee mf3ilt s umuvpnu4aexnmf3iadlaDean ilt0 rxoirpou1aptnlfvsl(  2um( o;u1oeto oeiltlmDran p (4tleoxr3iotfpDeli o;(0 eurxm3oo4lltn nvs (fs2ua(moou1altnmi3iatfs rmnms;()arenxr3totopD lu sl( tetmxmpnudlme  nctltfs2rm(rooo4ole mfctasfs uln onu0aexomo oadfm eanvol()s2tr(opiu4am emiviasf Drmu o;o0aetn octadfs uln s t)alenxrctydfa e ueo t sexm(r ou4om n net (f Duaxr nu0oeenifetltfmDul(vs (0alenif3oo1fa r nei;t t2toxo3no4op  lfcta()aDtmxmpnu1opxoiiciysfa ulu pn(0altnxrciy1faDraneilt  rxrio3oodope mfvi tf 2uax p;o4ape  ieias s umu o;(0 etnmf iydopteauvi;t)s2xm(o io1lle  ieiatfsrumxrp;o4aexn fetlslsDea(msn(4alenmr3oydfp ean i;s0truoio iodomtemneta( s2umump;o4ale moeiytls umums;(0 lenxo3ty1fat lneo;t tetoio iu1ap  micsa(f 2ua(  ou1olt  o3iys m ul(vpnu4aetrxf3tytom  lues;( trtrxo3oy1alt mfvi tf 2ta(roou1tleoii3iydls uln s;t4tlxrmo oydom raueols)s2xoim nodlpt mfeta(f 2taxmoot0opt io3tys s2rluvp u4 eenxf3oadfa  lu o;()t2ur(m ny1optnmnci s aDtmumooo1aexo o3tad aDemnms (4 renxo totoa elneol()trumirpou1omenlfcslsfs2umum no0apt  f3tatls2umu sn(4aexnifcta1fmt li s ( seurio3iy1lptnlfeiat aDta( poo4aptomoeiadla rmumo;u4 ltomf ta1lpD  ivi;t0t2to(mpiodomtnlfvtatfsDur( p;u4oexn ietadls rmu s;(0 rermfcoo1lmDrlueilt t2xo(rpiu4lmen ncias sDurum ;t4tpxnii3iadfaDrlnvo;t4 leomf oadomD lues;t s2toirpiodom   ieia(f rtru  ;u1ale io3tltfs2rm( pnt)altrxo3iydop  anvs;t)teto(r iu1amtelnetl()srtmxm oo1tptn ictyt s rmums ()tltrxo iodfate ieo;(0 exrxmpny1lle lfet s aruax  ;u4tet  ieiaslm2uanvpn(0aetrio ty1fmD lnes t) eto(r ny4ope  ncilt artmx p;u1tlt  f3iatfa ul( p;(4tlxnmo iodlp  ai o;t)srtmiopoudam elict s a2umum nt1tptoii3tasls2eln s;t)tltrir3iatlp ranvs;()trxrirpnudlp   ici s)aDuaxmp;o1alxn f3iytls2eanmp t)texomf3iydlptrli ilt) eurxrpiydapt lneias  2tmu pnt0aleoif3iasfa2um(vpnt0aleoxr oo1la eauei;s0tetm(rpnu1ol   fesatfa2tmu pot1tpxomietldlm2uanvp ()teenmocta1laDr u o;t0 rtoxr nu1olt mfviat  Drmum ;o1oleniocilslmDrl(msn()alxrmr3oatfatrlueil( teuoirpoydolte nci (  2ur( o;o0teto fetls m2uau ont0 rxrxocoatlmDeaieo;()t2xoio3oudoleemfet s)sDumx oou1tex mf3iasla2ranvp (0aetrir3oy1fp r i o;s seum(r iy1apt mnvsl(fsrrr(  nt1tpeomoetysfs rlnvp;u)texoiocoodlpteai s t seumiopio4apeemnet (faDtmu  nu0tlx  ocilsfm2elu o;u4treoxrcio1latr uvs;( seuriopoy1omt mict () Dtrump;t0tltnmietasfa2umnmo;u0tetnxocoa1faDean o s0s2urir oy4oltn neta()sDuaxmpou0tltomoeilsfa2ul( o u4artrif tydfaD anei;s srxmir oydllee fesa( a2ta(m ot0teen ociyt s2eanvs;t)alenxfcia1om r uei;t)s2uoxm3no1apeelicilsf 2tm( oou0alto ictatfa2eaump u0 lxoxfctytomteaieo;()truo(r3io4lmte nesa(fs2rrurp;u4tpen fciatls rl( sn()texoifctatlmD au ol()s2trimpoudam   neta(fs2rm(mpou0opxoifctytlm2elumont4texrir3ia1lmD lnvi;s  2toim iu4apenlnvtl(f 2ra(ro;t1oetoif3tldlm eanvp t4teeomf iydomDran sls) 2xoir oydomenlies ( sDrrxmpou0aexn o3tyd s2rluvs;t)aetrir3iatfpteaues ()s2xoir oy4ll nmncilsf 2rm(rpnu1opxnmf3iasla el( o t4alxrxo iodlmte uei t  2xmxm3oo1olt lieilt  ruax  ;o0alxomietlslm2uluvpnu4 ltrxfcoodlpDe ieo;t) euoiopnudaltn fci (f Dtr( poo1alt mfciysls2em(vs (0 rxrmfcio1oatr i s ()s2xrim iu1am  mfcsas)aDrmum oo4olx  i3tytla2uauvs;(4 etrmr3tydfpt auvi t)seurxr oudapt mnetat)a2tmx  ou4texnio3iltla2rln o u4aetrifctodfpDraivsl(0trum(m oudomenlivi s)s2raum nt0tpx mieiadla2uln p t4 etrxo oy1latrai s;t0srtoxr ou4ap nmfet ()s2rr(  nu0olxnio3iasla rl(mo;u0altrmr3tatom e uei;t t2xmxmpnudameelfeta()sDur(r ;t4optnmociys s2ulump ()tleoxo oydoa e n i t teum(m oy1lm   iet t  Dumur nt4tpxomfetys a um(mp;u)arxnxf ty1opt livslt0t2xmir oodlptemiciat)arumum nt1alx ifciaslm2rluvo;u) eerxf oo1fa  aues ( sexmxr3oudal emncils)arrmur no1olen i3iaslm2uaumsn(4 lxnmf3oodop raivsl() 2tmim3oydopenmfesas  2trurpno0aexoii3iasfm emu o ()tlerxf3ootfaDelieo;s tetmim iodapte ivtl(f 2tm(rpot4oetoifcias mDul( o;t4aexomo tatopD ai i;t t2tm(opoo4apt  ncils  2um(m ot0olto ietadfs2uanmo (0artrif iy1fp e uvs;s) eurxr oo1lmtemict sfsrrr(monu0tex iociydfa ua( s (0alxoxo3iotfa rai olt tetmiopnodlm emiesl( sDumx  ;u4olxoii3ild s2ulumo;() etoir ia1omtr n o;t setm(mpoydlmt lnes s s2tmx  nt1aetnii3tysls rluvon() reomrcta1lp  aies;(0texmxr iudal  lnesltfarua(r no4apxomoeiad m em( snt4 ltnmfcoa1lm eluvo;s)setrim3io4opt mieias)arua(ro;u0tlxn fciaslaDeaums;u)texnir ty1fmDeaneils)trxoiopnu1om e ncs ( arrm( pno4oee mo3iyd a umnmon(0 rtrmf iadfptrli i;( teumim iydlpenmnct s)a2umu p;u0tleniiciad sDua(mp;()tlxomf ty1lpDr i s;(0setmxmpoudll nlfei t artrum ;t1ale mfcild aDuanms;t4 lerio tatlaD aueils setr(o3no1ol elietl(faDtaxr ;t1opx  ietadlsDum(vp;(0aeenio io1laD an olt)srtmio3nydoptemfcil()s2ra(  ot0opt moeild s eanvo t0teerio iytop r nei;()sexoxm3nodol  lfeilsfarraurp;o4oex  feilslm2el(vp;u4alxomf3iotlaDe nei s0seumio io4openmfcsls arumur nu1oee mfciltla uanvsnt0aexrif3oatfpDelies;t  eur(m nu4ap e fcsas sDtrxm ot1aex  ocils sDrmuvp;(4 rxomf iydfm raueols0s2tmxo iy4alee ictasf rurum nt0altnmfciat mDrm( o;t) lxrifctodfaD lnei;s)s2urxo iy4optn iciat a2tru p;u1tpe  fciatlsDua(ms;(0 lxnxrciy1omDrln o;(0 rtoxr3oo4altnmieil(  rumxroou0aleoio3tysfa2ea(msn()trerxociytlm r u i t texo(o nydllen fesas srrrumpoo1tptomoetltlm2rl(mo (0trxnxf tatlm elu o;( s2xo(r nu4ol nmnvs tfaDumurpnu0opt io3tydls2ua(vs;u4altrxo3io1opD luvslt)tetrir3nu1ope  nei sf rum(mp;u4tpxo ictlsfa2umumont0 lerif tydlateau slt0 2xm(o oodll e nci s  Dur(moou0tpxomieiasfs2rluvp u4aetrmr3ta1opteau olt0sexr(rpnu4op   ivtls)sDraxm no4ole ioctlsls2uanvp;t4teerxr3oytfm  aneo s0srto(opnu1ap e nctat s2uau ont0teto o3iat m rau o (4arxnxr3oo1oaDr nvs;t trxmxr oy1am emnci s  Drmxmo;o1aetnifctat mDumumo t4tltnmr3oydlp  lues ()s2xmim3no4lltn icsltfsDrmumpou1tex mi3iasls2el(mp u)tlenmo3oy1op rlnvi s trur(mpoodamt mfei s) 2trumont1optn i3tltlaDrlnmsn(0aexrir tydfptelivols trxmxmpiy1apt  feiat)a2taxmp;o4aeen f3iydfa ranvsnt0 lxoiocoydoa  aues s0trto(o3iy1lmtn nct tfaDtm(r ;o1alxnmfeilsfmDua(mo (0tlenmr to1fmDranesl( s2uo(r io4apt mici t srurx p;u1opt io3iad m2ulnmp u) eenxocoydoa  lueol( s2xoio3no4amte icias  Dtmxmp;t1altn i3iadfa uanvp u0tlxomf iatoptr ieo;s s2tm(mpiu4lpenmnvslsfsDrm(rooo0tee ifciysls2um(vp u4 ltnxocoatom rlieslt)srxr(r oodamtelfeslsfa2tmu  ;o1tlt moctaslsDuln on(4 rtnmr to1fpD  nei;t)t2trxr3iodlm  lnvt s  Dtrxmpot4olt  icias m2ua( o t)aexoxf3ta1lmD lnei;t)t2xrir ou4olt lfetl(  2rmur ou1apx iietldla2rl( snu0tetrmr3oatlp  an s;s) exm(opno1lm  livslt a2ra(monu1alxnioctas s emnvont0teenircty1lp   u ols) rxoiopiu1op  lfcta() 2rmur ;o0aleomociyd sDel(ms t0aeenxo3oy1optraivsl() rxmxr oy4lltn fct (f Durx onu1aptnifetad sDua(vo;u0tetoiocto1oat  nvs s)srtm(m oy4lmtemieil(faDraumo;u0oexn fctys a2um(mo;t4 rerio3ty1omtrlivs ( s2um(r3iydamt liet ()artr(  ot1oltnii3iadfm2eluvs t0 eenmo3iy1fp elu i s0t2trxr nydomt mfcil( sDur(  nu1aee  i3tasfmDea( onu4trxnxf3ty1lmt ai o;t0srtm(opoo1om nmiesat  Dum(ront1aetoioeiltls2ua(vo;t4teermr oadop r iei;s0 2tm(mpno4ame miviat)arrmxmpnu0opt moeiltfs el(von()tetomfcoydlpt au ols)sexmim oydam  lfcsat)s2trx onu1oetomociatlaDuaumont4alenmf oy1fp e uvs s0sexrxmpiodol emiet s  Drm(m no4ale  fetytla2uaump;t4alxnxrcoo1omD an il(0srxo(m nu4altemiei s)artmuro;o0aetoiieiasla2ea(vo t4trxrmo oodfptelu ilt tetmxm iydlpen ivtat sDum(mp;u4alto oeiat a eln o (0 rtrmf oydom  luvslt0 etm(o3oo1omtemfeia(fa2tr(r ou0aptoii3tat a ranmo t0alxnmo3oo1omt  uvo () 2tmxr3iy4amenmfei ( sDraumpoo0oltoifetytls2rmu p u0 rxrmf3tytom rln o s) eurxr oodop nmfesa(  rrrurono0teenii3tlslsDrmuvs ()treriocto1lpDr nvs s0srtr(mpoo1lptn nvtl()srumump;u0olt ifciatls rln onu) eermo ty1omtrluvil( seurimpnudlp   fvsa(  2umxm ;u4apen oeiad aDum(mo;(0 lenxr3oa1oaDeai o;t0 2toio3iy4lp  lfeil(f 2rrxrpoo0alx moeiysfmDuauvs;(4teerxocto1lpD  n ilt0 rtoxr iy4ameeliet s artru pot0tle  fetasfm2eln s;()aetomo oatfmte neo;s  exoimpiudaptnmfcta(f rtrxm ot0aetomo3tatlsDem(vp;u)trxrmocto1op rai o;( seurxmpnudlm nmicsas srur(r ;u1aexnifetytfaDrmu s;u4tlerxocoa1fpt aueols0t2tr(m no4op nmict t)a2taxro;t4alt mi3ilsls rln snt0tlxrifcty1la  an s t) rtmxopny4oleeliesa( aDumx pnt0tptoifctys a rmumont)trxnmociotfmt lnvi (  2tm(o3nodoleemfci s)arurxro;t1alxnif3tadfaDrln pn()tlxomrcia1fa   u ol( trtrir3nu4aptemivi s aDtrxm ;o0alenioctldls2eauvpnt4 ltnir tydop r ivi;s  rxmim3io1aptemiet s artmuront1ope  i3ias aDrauvp t4 rtrmfcoy1omteaneilt)s2uo(rpiu1al n ieils) Drr(mp;u1apto ociyd aDuan pn(4altnir3ootfmDe u s;()teurio3oodlpenmnetasf 2tauro;u0oeto ietyt aDumn s ()tlerxr3oa1oaD  neslt0texoxopoy1ap e iesas sruaumoou0aetoiociadfa rau o u)treoxoctadlatean s;s0t2xmirpoydole mneias) rrm(root1tleniietys s rln p;()aexnxr iydom r u s;t0t2tmir no4lptn ieia(f Dtax  ot1oltnifeildlaDrlumpnt0 eenmf3io1laD lnvo;s)trxr(mpoo1amee fetlt  rtm(r ;o4tex mo3tltla2rmn o;u4trxnxo iatoatelnvs s)sexmxo no4lpt lneil(fsDrruroot4oltomietlslmDemnvsnt)texnmf oadoa  ln s s0t2xr(m3iudomt liesa(f Dtm( onu1opxomf3ias s2ea(msnu0trerxr3iatfaDe ivs s)t2xm(rpiy4ame mneils a2ur( pou0aexnmieiyslm rmnmo;(0trxrioctydlp  livs;s)srxr(r iy1aleemnetl()a2tmurono0oleoif3iyslaDeluvs (0aexnircio1oaD auvslt) 2tm(m iu4ame liciat srrruront1ope  f3iaslaDea(vp;u0aetnif iadfmDelues () rtrxmpnodlmee nei t)arur(rp;t1tlt  f3ildlsDua( snu0arxoif ty1laD aies;t0texr(opnodalt miet s aDtaxmono0tle mieiad m2emnvp;u)alenxr3tydlp  ai o () exr(m3ou4am elfeslt a2uru  no0alenifciytls2el( pnt0tlxoio ta1fmD aiei s0t2uo(o3nu4om nlnesas)aDraxmpou4tex ifetatlm2umu p (0 eerxr oydfptrlivol( srumxr oudom nlietlt)aDrr(m ot1ole  fciyslaDumuvp ()trtnxr3oa1lmDelivi s0s2xoxm3ny4olt lfvtas srrr(mp;o1alxo iciydfsDean s t)tetnir3tytlmt aiesl(0t2trir no1lptnlnctlt aDrax ooo4apxnmoctys a2umuvs;t) lenmrcoytomte n o ( s2xo(o3nydll  mnvi s)aruau ont1apeo ociad sDrm( o;u0alxrmo io1fmD aivols sexrxo3oy4lltelicta( artr(ro;u4tlt  f3ildfa umu s t4 leoio ootoptrlieslt0srur(r3ny4lp n fvta()sDrr(r ;o0texoif3iydfs el( snu)alxrxfcoodoat lueils)s2umxrpno4lmen ivilt)a2rr(  ;o4apxomoctatfaDul( o;u4 rtnmociydlm rlivi;t teumim3oy1ap elnvta( artaxmo;o1tleoiociyslm2ran onu0aeenmo3oatfmt  uei t t2urxo no4ol  mfvtasfa2rrxm ;o4apx  fcils mDemnvo;()aeerio3tydlpD  ueilt0srumir3ny1opeelnei ()srraurpnt1oeto o3iytlmDul(mp u4artoxf3totopt aneo t) rxr(opnodomeelnei s)a2uaumpoo1ale  ictlslm2rm(ms t)tetomfcio1opte ieo (0 2trimpoo4lptn fcia()s2rmx pnu4aex mfeiyd a rluvs;u)tlxomr oodoatrluvo;s)t2tmio3oo1omeemnetl() rrauro;t4oltomfeilt s2ea(vsnt4aeerxo iatlatrln ils)trtm(o io4altnlnes t a2uaxrp;u1ope miciydfa eluvs ()aleoircoy1lp e i olt0s2urxm iydapte ivi () rua(  ;o4oetomfeiytfsDua( o;u0tlxoir3iytfat lu o;t0 etrxmpiudom n ivi ()a2ra(mpou0alxoiociat s uanmsn(0aleomo ootlmtranvils0teumir nydlle mivia( a2uaxmooo0oltn oeiltlmDelnvo (4aexrxo3tytlmtrli ilt  2xm(r3oudlmtnmnviatf 2ur( oot0oeenmicild m uan s;(4 reomfcoatopt aueilt  rum(m iudlpt  nviltf Dtrxm no1tlxomicild a ulump () exoif oytlmDrlues t0 2toxr iudope lnvi () rtmxm ou0tpenio3ildfsDumnvs ()aetomo iotlm eln s t0trtmio oodlleemiet () rumxrp;o4tptomietytfs umnmont) ltrxf3oadlpDrlivils  etrxr oudom e ieils  Dra(  ;o4aetnmociydlm2rmuvo;u) lxnxo3ootomDeluvo t s2xmxmpoy4lmeelnci t)srtrum ot4teto iciydla2umumpn(0tltnxf iytoptraieo;t) rtrirpoudlm nmicsltfsDtax pnt1aeeniieiydlmDum( on(0arerxo3totfaDr neil( setr(opiu4am  lfes sfa2uaumonu1tlxnifeiatlsDra( p (0 rxomoctatoaD  i o;t srxoio oydam   fciasf rurx pnt4tpeomictls a2rm(mp;(0treoxf oodfaD  uvo (0trurim nu4am emivtat a2rru p;t0oet if3ildfa2rmnvp u0 lxriocoo1omt anvo;(0t2toxr oodopenmfctl(f 2umxmono0oeeoioctytfmDrluvo u0tlxoio3to1fp rlnvs ( texo(m no1lmtn fetlt)aruaurpot0tpx ifcildfm2ulnmp;u4 lxnirciatoaD anvols trtoim3nodop  lict t artm(ro;u4tlx mo3ils aDuln on(4 exoifcoodlpDr i ols t2uo(r3iu4ale micils  rur( pnt1olx  oeiyd aDean o;t)tltomfctatfmDrlueo;(  2toxm ny1lmtnlivtls  Drm(rpnt1tptomi3iydlmDrmnmp (0 rxoiocia1oatr n o;(  exo(o nodale liet ()artax ont0ole  o3tadfs rau s u0 lxriociydfmtrau sls)s2umxo oy4ol e icsas)aDrr(mpot0tlx mo3ildls2rmuvo u) exoifciadop eanei;s sexoxr3oy1omenmicia( sDtru  ot1tex  f3iys aDumu pnt4teeniocoo1faD  neo s0tetmxm3ou4ame lfeiasfa2rmum ou4alxo fetat sDumnvp;(0 rxrirciadop  aieo;t t2uo(opou1apen ivi t)arrau p;t1ope ii3tatfs2rl( o;() rxrif oa1fpteaueslt srumxm iy4ll nlfetlsfarraumpou1olt miciyd a raums u0arxoiocoo1omDe ies;(0 2ur(opiudalenmfcsa()a2urxrono0aptnmieiatfsDranvp;t0teerio3tadfptrlivilt0 2xr(r oydll nlivtlt)sDur(ronu0tpxoifctyt s2em(von()artrxo iatomDelivilt) exo(r oydom nmncil()s2raxrp;t0olto ictlslsDum(mont0teenxf3oo1fmtraivi s t2xr(mpiy4lp elneta(  rrrxmpno0aet iicildfa em( p ()arxrir3ta1fmt livo;t t2xo(opou1al nlnciasfarurx  nt1tlt  o3tytlaDemnvpnt4 ltnxo ia1latrlieo;s0 rxmxo io1olenlnvias aDtaump;u0openmieiadls2ea( p t4tlxnxf3io1opteauvil() eumxmpiudlme lncslt)sDrrxroou0tpxoioeiys mDel( p (4aetoio oydlmte i i;t0t2ur(r3iu1lmeelnvilsf 2urxm ot0tleomieiatfaDelnmp;t) rtrio3oy1laDeauvs (0texoim3no4ap  livsl(  Drrxr ot4oltoioctldfsDraums;t)alxrxr3oatlmte i o ()seuriopnodlp n fes sfsrtaur ;o1oee  feiadlaDelu s u) etnif oadom   neilt s2uoim iu1op emnciat  rrmu o;t4teen ociadfaDea(ms;u)teerxr iodlmDeluesl() ruo(o3ny4lpe mnvt s)aDtm(m oo0oltnmieilsla2uluvsn(0trermo ty1fatr nvilt)trxr(r3oo4lpe lnvil()s2urx pot0olt  octadls el( s;t4 eeoxr3ta1omtelueo s0 rum(mpiu4am   fvi (  rrrx ooo4aetomoeiydfa2eln o ()tetoxr3oy1fptran i;(  etr(r3nu4op nmfetls  Durumo;u1aee  o3tadlm2um(vo u0trxomr iytlaDe ueilt)t2xrxrpiydoltnlnctlsf rtr(roou1tpenio3iaslm elnmp ()alxoif3iy1lpDrauvi t0seuoimpnudaleelnesls s2tmx pot1apxo i3tat aDulnms;(4tetrxocoadlmD lnvs;t0srxmxo3io1alen fetlt aDur(  nt4alt ioeiydfs2ean o u)trtoircoydlmtrlnvilt  2ur(o3iodal nmfvt t)artrxm ;u0tleoiieiyt aDum(vs t4treoxf3tatfmtraneo;(  ruo(o3no4alenlnvta() rra(moot1alxoiociytls rln snu)aeenxf3iy1fatrln i;s  rum(m iu1omtnlneia() rur( ont1apt  f3iadlm2ua(vsn()aexrircoa1opDr n s;s)trurxrpou4ome  iciatf rua(mont4aet ioeilsfa rln s t)trxnxrcta1fmDeaueo t0t2tr(mpoydlmenmfesltf Duaxm ou1tlt mi3iadlsDea(vs u4 rtrxr3tytopDrai ols0srtoxr3nudapte fetls)srrm( pou0tle  f3iyt a2uanvsnt4 rxrir3tatlptelueo t  rxr(o oodap   fvil(  rrmumpnu4aeenmo3tldla rauvsnt0 rermf iydoaD li o;()t2xmim3oy1ol n ivt ()a2trxmpnu4altomietytfa2eluvs ()tlxomrctadlpt  ivol()trumim3io4al nlnet t) Dtaxr ou4oexnmfctlt a2uauvon(0trxnxf3oytfaD an ils)srxmim3nydalenmfes ( sDrr(rp;o0ope iociadfmDul( o;t4trtomfctadopDeaieols  2xr(r3nu1am nlivs s a2uaxm nu0apx  oeiad sDemuvs;u0tlxoif3ia1fateliesls0t2uoim iu1lmee net t a2rrxrp;u4aexo i3ilsfm2ulump t) rermr tadlaDelues;s) 2xoim iu1am nmicia(fa2trxrpnu4openmociad a2ra(mp t0tetnif to1lp   nvol(0trtoim ou4olenlicsasf Dtr(r nu4opx mfciatla2emnvs;u)aetoxr3iytlate i o t  exoir3ny1ole livi s) rraumo;o1oltnioeiytls2rlu o t)alxoio ia1opDrau i t)t2trirpoo1ope  neiat)aruax pot1apeoifeiydfm rm(vs u4 rxrxf tytomte u i s)srtoirpnu1ol nmnvils)srtmxmoou1apeomociyd aDrlnvpnt4alxomr3to1opt livsl(0 2xrxrpoudlp   ici sfs2tr(  nt4oleoioeiatfs2ea(ms;t0tltrmrctytlatraivo t s2xrxm3oy4ape  nvsltfsrtmx  ou1optnii3iydlm ran p u0alenifcoa1la   i o;s0t2xmio3nu1ll  mict t) Duru  nt0aet mfciyt sDeanmp u) leomociotfmDrln i t  rur(m3oydlptnmfcs t) Dtmu  ot4opeoii3ias aDul(msn()trxnir3to1optr nvo;s0s2xo(mpiudlpeemfcs ()arrr(rpoo1alx ifctadfs rl(mpnt0tleoif ty1fpt lies s)teum(o nu1amt  net s s2taump;u0aexomi3iat s2rlums t4areomf totlaDe i s s0s2tmir3nu1apen nes ()sDtrxm nu0aeenmociatfaDuanvo;(4aetnxo oydlaD lu i t0s2uo(opnydam  mfvia(faDrr( pnt1apxnmf3iytls2uln o;t0 ltnxrciadfmDrluvo (  2umxr ou4alee ivil( arumu  nt1tpx  octldlaDrmnvs;u0aleomf3iotlm e i s;t)trtmir3iydomtnmfcsa()srtmxmpnu4tpen octadfs2rm( p (4 rxrxo3tytoateaiei s0srtmirpou1olenliciltfsDrmumoot1aetomfcilt m2rlu p;(0tetnifctotlaDelivi;s0 ruoio3ny1op e fcsls aDtm(r nt0apt  i3tadla ua(mo u4 eerxo oodfmDe u s;s trxmxrpiy1lpe mnct s)sDtrum ;u0tpx iictasfm2ulu onu4texnmfcto1opt livilt0s2xm(o3iu1ame  net s srumxroot1oexoiiciatlmDulnmo (0aetomfcto1fpt  n s s texrimpnu4om emncs () Dtrumo;u0tptn icias a2umums u0arerirciydoa r nes;s)seto(r3iy1ol emfeiatfsrrmxrpno1tle if3iysfs rlnvpnu0trtrxfctadopDraivslt0srtm(r iy4am  miesasfsDumxrpou4apt moetls s2rmuvp;u0tetniociy1fp elieolt0s2umim3iu1optnmnctat  Dumurp;t0tet  o3tyt s umn s;(0 lenmocoa1la ranei (0t2xr(opiy1omt lnei s)s2ur(mpot1tpxoii3iytfm el(vonu4trxrxrcia1fmDelneo (0 rxo(o3no4ame  nesa(f 2uru poo0ale iieiys a2uauvs;(0 exrxo tadlp rlivo;t0trxmxr3oy1lmenlivs t) 2tru  nt4aexomf3iyd mDem(vs u)texnir3io1omt  ues;( srxr(m3iy1om  lfvils)arurump;u0tpeo i3iad a2umnmpn(0 rxnmocty1faDrlnvi;(0 eum(o3ny4ll  mnvi ( s2uau o;u1aee mf3ilsfmDemnvpnu)tlxrmrctadfmt  uei s trtmiopno4ope lfctas  Dtru  oo0tet mf3tls m2rm(mp;t) rerir iytlmD au o t)sruo(r3iu1lp   nctas)srum(root4aptnmfetat aDumums t4tlxnircto1latrlueo s0srtr(r3ou4optemnesls sDurum ot0tpxo f3iysfs ulnvp;u0artnxf3iytla rln i;(  rxrimpiu4altelfctlt) rrmur oo1tetn i3tldlsDumn sn(4tltnmo3oytom r n s s) rxrxm nydopt licta(f 2rrxr ;o1texoiociaslm eanmp;u4aeenifcoydlp eli i (  eur(opou1ll nlici ( srrr(  ;o0tleomociatlm2uanmsnt4 lerio3oa1lmDeaies t)texmxr3iu1lpe  ieiat  Draump;t1ale mi3tys aDeanmp ()tetrxo oytomtelnvs ()trtr(mpnu1optnmfetlt) 2tmu  oo4tpxomo3iytlmDuln s t0aeenmr3oytop raueslt truoirpiodamtemfctls)arrru oou1olenioeiys s el(mp;u0aexoxfctodfmDrlnvo;t) exo(opoy1lm n fcil(f 2ur(moot0tlx ifciasfs umnvp u4trtnxo tadfp raues;t) rtrxr3no4olee fvsl() 2tmx pno1tlx  i3ils mDrm(mp;(4alxnmo3io1oatrau olt)srtrxo3io1lm  mieslsf rta(  ;u1tle ii3tysfa2em(mont0tetrmr iatoa eaieil(0seurio iudalenmnciat  2um(  nt0tpx mi3tltla uan snu0 rxrmr ootlp eaivs t t2toxo3ny4apte ivsasfaDua(moot4tet if3iysfsDrluvo t4aetrxr3totoptrlnvs t srtr(m nu1ameelneta( srtr(r nu1aetn f3iatlsDel(vo (0tltnmf3oydoaDe ueo t0setoxr oo1op elietlsfaDur(m no1texo fciat mDul( s u0artrmr3ia1fp  au o ( srumirpiy1ape mivslsfs2rru  nt0tex mf3tydfa ul(msnu4treoiocoa1la   uvs (0 ruo(r3no4ape  iet sfsDur( pou4tlen o3tydfaDrm(vs;(0teerio3ty1fpD lies;( truo(m3oodomen ietl( srrmxr no0ole  o3tysfm umnmsn(0tetnio3tydlpt  n ilt)texr(m ou1op emfvi () 2rmurp;u4tpxoioeilt s rmnmo u0artnmf tydfaDrluvs s) rxr(m3iu1llte nes s aDuaxmoou1opxn ociytfmDuln p;t0tltoif iotfp e ueo s  eumxrpiu1op   ivslt)s2umxr ;t0tex miciatlaDem(vpnu0 exrmr iy1lm   uvo s seur(m ou4lp nlicias)sDrau onu4aee  i3iys sDea(mon(4alxrxf3oatop r u o;t0t2um(o oy4lltnlfetas srta(mp;u4aex mf3ildlm umnms;t)trxoifcoodfmt aieilt  2xr(m iy4ame mnci tfsDtrx o;u1opt  fcilsfa2eanvp;()tltnmo iytoaDran i s) rxm(opoodapte ncta() 2um( ooo4olenmo3ias sDrlnvsnt)arxomr3oodoat  uvil()setrim iydol e icia(f 2rr(mooo4tetnii3tldls ua(vp ()areoif
\ No newline at end of file
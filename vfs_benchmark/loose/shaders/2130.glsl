@@ -0,0 +1 @@
+ies s t2urxm nodam  lieta(faDtaxr ou0ale miciasfsDea(vp t)aetrmfciy1lmte uvilt0srtmxmpoo4apt  ivt sf rta(moot4tlto f3iadls ua(vp (4texrmfctytfate ivo s s2xr(o3oy1ll e feiat)a2trumoou4openio3iad m el( ont)tetrmr3iotfaD luei ()s2tm(r3iu1alte nvi ()s2ur(mpnt0tpt io3ildfsDrm( p ()arxrmf3ty1oatraneo s trurim no1lpeemfesatfsDrm(m ot0opto ociydfm uauvpn(4arerxr3oydoa r iesl( seurim3oodal emivsa( sDumx onu1aee  o3iys s2rlnmp u0aetnmf tytom r i s;(  rur(o3ou1alen fvtatfa2rmx  ;t0aptnifeiyt s2rl(mont)teenir3iodomD livo;s) euoxmpnodop e ncs s  rta(m ;o0aexn oetadfm2umump u)arxrmf to1fpDe n sls)t2uoxopnodlpte ivta( sDumu onu4ape io3ild a2uanvo t0altnmfciydfmD an o;t)trur(o iu4lptnmfcsl(fs2raurpnu0ole mfctydlsDranmp u4artrmo oytop e n o;t0 rurir3iy1ole mnesa(f rta(mp;u1opx mieiad aDuluvs;(4alxoif3ta1om rai s (  etr(mpoo4lm  lnvs sfs2umur ;o0tltnif3iyd s2raums u4 eeoxf oydop  li o t0seumxr ou1aleemneil(fs2um(r nt1tpeo i3iydfs2uanvonu4 rxnxo3oy1faD aivs t0srtoio nu1olee icsl(faDumu ooo0oetoioctyd sDrmn o;() leomoctytfaD lueo;s) etmiopou1ap nmnei s)s2rmx pot1oexomociad aDelnvo;()trxrio3oatfm eaivs;s) 2urim3nudopte fvi sf 2tax ooo4opeomociasfa2ean p;(4 eenmo3oy1om rlnvs;s0s2umir3oudamenmnet s) 2ta(r nu4olxnmo3iaslm eaumo u) etomr3oodfpt an i s0setmxopiy1amt  net t  2trxront4tltn f3ild aDum(ms;(0arenxr oydfmt an o s0tetrxmpou1ol nmfeias)sDuauronu4oet if3iyd mDeau on(4trermocoo1fmt lieo;t0 2xr(m3oy4ap  mics (  2tax o;t1tpe  oeiltla2rln on() lxnif3oodlp ranesls0 2xmxm nu1omen fetls  rrmx ont1tee if3iad m elu s u0areoir tytla elueo;s)teurxr3ny1lptnmivi t arra(moot1opto oetydfsDrmuvs t)tlenmr tatfatranvsls)s2xrim oy1lpee nctl() 2rmxm nt0tltn ocias aDeau s t4aexniocoodop eaneo t0sexm(o ny1lmen fcs (fsrum(m ;o1tlt ii3iltfs umums () exnmf iydlp r nvs () 2to(r ny1olen nvtls)sDumu ooo0tee  oeiatla rl( p u0treomocia1fatr i i (0sexoiopio1ll nmnesa(fsDrmuronu4tpt mi3tldfm2em(ms;t4 rtoir tytlatelivsl()t2umxrpiy1amtnlietl(farraxr ;t1aetomietasfa uan o u0tlerifciydfm e ies;s t2to(r ny1optnmncs (f 2taum ;u4tpxn ocils s ea(mp;t)tltomf3io1lmte ivils0trtmxr nudlpeemfvtls)srtau pno1tptoifeiadfs2ulumsnt0aeerir3oo1lmte uesl(0s2to(o3iudomt  ivta( aDum(m ot0optnii3ildfs umuvo u)tlxoif3iadoaDeaivi s)setr(m iydaptemnet s s2taxm ou0tetomocild mDemumpnu)trerir3todlm eln slt0trurxr3oo1am   fct t)srtaxm ;t1oexoifctys mDrm(mp;u0altoxr oytlmtelneils0 2ur(o3ny1al e ietat s2trxr ot0apt  oeiytfmDea( o;u0aeermo iy1lpD an s;t srurimpou1ope lneias) 2ra(r ou0tpxo fctas aDrluvo;()artnxfcoydla r n i;t0s2um(r iu4apeemnvt t)aDtm(mp;t4olt  ietasfs2ulnmsnu)aeerxr ia1optrauvo;(0 rxmir3iodll nmiviat)aruaxmp;u0aptn f3tldfs uaums u)trtoxocoatla r i i;s trur(o3no1olee nctls arrru pou4tptomociytlsDrm(von(4alxrmf oadlm e n ols0srxr(r3io1lltn fct ()s2umxm oo1aleo f3ildfaDemu p () lxnio iydfmDr n o;s)s2uoir3iydolen ieiltfsDra(m ;u0opxoiiciyd a ranvsnt4alxomo tadlaDrluvol(  2tmxo io1amtemfvt sfsDtaxm nt4aleo fctlt sDuauvo ()aetoir ta1omt li il(0seur(o iu4om nlneil(fsrur( pnt1optn o3ildlsDrlnmp;u0tlxrmr3totopDrauvi;s) rtoxopoo1oltn icsat  rumx  oo1oet ii3tatfs2eau o;()tetomr3iytfm  anvs;s0seuo(o iu1lmee nctlt  Dum(mont1apeo o3ils a rl(vp;(4 leoxf iotlate n i;() 2tm(opoy1omtnlfctl(f rrau pou1tetniicias m eauvsnu) ltnxr3oo1fmt luvil( sruoio ou1al nmnci sfsrtmu oou0alen iciys sDulu o u0tltoio iadlptraues;(0 eur(m3iydal nlfcil() Dtm(mooo4ape mf3iat m2umu sn(4trtnxf3tatoaDe i s;()seuoxopoy4oltemfeil()srra( pnt4oee mo3tls s2raums t4tleomf3iytoaDrai o;(0tetoim3oy4omt lnctlt)aDtr(r ;t0olto fctasla2uau p (4aeeoxf tydomD lneo;( t2xmir nu1olenmiet t)a2tm(mono0tltnifeiyt aDrm(vpnu4 leoifciadfmtr i ilt s2xo(r3iy1lltelnciat)srtr(mp;u4teeniieiadfs rlnmp t)trxoxrcto1lm elivs t0 2uoxm iydaltn ici (f Drmxm no4tet ifctys sDrm(mpnt)texoxf3tydomteaies s) 2xrio3no1lmtelnct tfaruau pnu4oee mociadlm2ul( s u0texrxo tytom  anvols trxmxo oo1optelnesls) Duax  oo0aeenmfetyd sDrm(mp;t4tltoif iadlm e ueilt srxoxo oy4om emnetatfs2rmuro;t4tle iieiatlm ul(mo;(0trxrxrctatfa r ieilt  rum(r3iy4ll nmics s)arua(mpot4tpx ii3iytfs ua(mpnu0arermo3oy1lp e n s t0trxmimpiy4alee fci tf Dra(rpno0oex moetatlm el( o t0tlxomfcoa1oateai slt  2xo(r3nudolee iviasfsrraum nt4oeeo i3iytls rmn onu0 rxoxf3ty1oa  ai ilt)t2uoxm oy1lp n nvi sfarua(m oo4opt iictatlaDumumsnu0tlenxr oy1om  ai il(0s2uo(mpiu1amtemiesas)sDtr( poo1tlenmi3iatls2el( pnt0alxnxr iadfa   ies;s teumxrpnydom  mics sfs2taurpnu1aptoiociat aDrl(vsn(0teenxf3ia1lmD anes (0s2uo(r oo4omeemfvsl( s2ua(mpot1oexnioetad m uau s;t)trermfcoodlpt aivo ( t2xoxr oy1amt  ieiat  2umumonu0opt mfciltfs2umumo (4aexrifcoodopDelivsl( t2xoxr3io1alenlfvil()artmu onu4aexo fctas m2emnms;()arxnif3oa1fa  li s;s) exoir iodamtnmnet () Dua( ono0optnmoeiytla ra( ont4alxoxocty1fm rai il()trxo(o3oodoltn fciat  Drrx o;o1tptnmieilsfm2el(vont0 renmocia1fateaivo ()trumxr3oy1llen fvsat)srraur ;u4oet ioeiltfs rln s;t0aleoxo3oatlp r u ols0s2um(r3iy1ame mnvt s srrrxmp;t4tpeo ietyslsDranvo (4areomrcoa1faDeli s s srtoim3nodam emfvt ( aDum( pno0tpenmociasfs ua(mp;t0trxnxf3iadfa rli o;t)t2trxr ny1lmtnmnci sf Drmxmpnu1opt if3tytlm ulnvsn(4 exnmf io1lm eluvi;t srurxo3iodlp  lfvils  ruax  oo4oetnioeiyt a2elnvp;(0tetoif3tatfp r nvi t) 2trxopoydlmtemnviatfs2ra(mpot4tlx mi3iytfa rluvs;t0 eeoio3tydoat lueo;t  2toxopoo4opeelfvt tf 2tr(ront1aleniieiysfs2eaumont4 ltnifctytla  lneil(0teto(o no1omt licia(  Dumxrp;o0teeomociltlm2uln pnu4 eeoxr oatfp rai s;t s2tm(opiu4olee fcslsfaDta(ro;u4aeenmfciatfm2el( o;()artnxrcoydlp r ivo s0texmim iodlm   net ()aDtrx p;u1tlxomi3tlt a ra( snt0alxrio3totomD auvo (0t2umxmpiudomte ici t) Dum(  ou1altnmo3ildfm2rmumsnu)trxoxo3tadlateln i (0s2xrio ou4lmen iviasfs2rrum nt1apen ieildlaDelnvpn(0treomf oodfmtr ivs t tetr(r iudll emnet (  Dururp;t0oexomf3tysla2ulumsnt0tlxnir3oo1omtr i o;t)trxoir ny4lle  ieilsfs2urum ot0tleomieiydfa2el(msn(4tlxrio3tytfateaueo (0 2toimpiudame lnciat)s2uaxr nu0alt  feiat s2el(vo;u4 rtrxfciadopt  n ols  2uoxr3iy4opt lfctat srumx  nu0aptnmoetys mDrlnmp;(4arenmf3ta1fpD lneslt0srtrxm3io4lme  fvt ()s2rrum ;u0tpeoioetadfa ea(mont0trtnxo3tydoateau sl()seuoio ou1ol emnctl() 2um(m no4tpeomo3iadlm2umnvs () leniociydfat auvs;(  rumxm iy4al  mnes s)aDumurp;t4tpx ifciltlmDrl(ms;(0 eermrcoadlateanvo;s0s2xoim3oy1lm e neilt)a2tmu  ;t1olx  fetasfmDrm(vp;t0aeeoio io1fpt lneo;t0 2xr(m3oodlm e ietltfs2tru ont1aeeoiicilslm rlump t0alxrxrciadlpDrln sls)s2urxmpiu4lmtelnes t) rraur no1altnif3ils s2emu o;(0arenxo oydoatr nvi;(  2xo(opoy4lle mfeta(f rua(r nu4open f3ildfa eluvo u) lerifcio1fmD livils t2xoxm oo1ll  mnesl()sDua(mono0texo f3iytfsDem(mpnu4 ltrxociy1lpDranvo;(0 rur(r nodapt mnctatf ruau oot0oetnmf3tlt aDuanmont4tetrmrciatlmt liei t) etmir no1lptnmies s)a2trxrpno4apt io3tatlsDeanmsnu)altnif3oo1lpD  u i (0 exrio3ou4alt  fvilsfs2rmurp;t4texo ociyd aDem(vs (0tltrxf to1om  lu o;( truoxo nu4alenlfvi () Drr( p;t1ale  icildls um(mp ()aetrxr oo1lpDeaues t0 rxrio nydop n nvs () 2tr(  ou0tpxomfciysls uau s (0 leomrcia1faDr ivo s sexo(rpnydal elfvsl() Drm(rooo4tptnmfctltfs2elumo ()arermr oy1fa r n s t0sexmir oo1am emieils) 2tmurpou0oeeo fetatlsDum(mp ()aexnmociy1laDranvi;s) exmxo3nydop n ictlt)sDuaxm oo1aptnifctlsfaDrmu p u)tlxnxf tadlpte i o ()sexrirpnodomtemnctl()a2ururonu1oex micilt s2emnvsnu0artoxf3iotfpD anesls s2toimpoodomt mivi tf Dum(mp;t0tltniietlslm2rl(msn()tetnif iytomtrlueils0 2urir ny1om elfvslt sDrrum ou1oetomieiaslmDrlu s t)alermr3tydlpD  neols0 etrxopnudlm elfvilt  2um( o;t0tpe iociydla rl(vp u4aeeoxf oytfaD auesl(0s2trxo iu4lpen fci s aDumurp;o0oet mfeiat aDulumo (0 eenxfctytfat lues t t2ur(opnu1om e nvtas s2raump;o4ole mf3iltlm ul(mp;(4artoxf tatla  lu s s sruoxo3iu1aptnlnvia(f rtmxmpou0aleomfeiyd m um(vpnu0alxniociatfptr nvils)seuoxr3nu1al  lnvtl(f Dum(mp;u0alt mfciyt m ua( snu0trxoxo ootlpDeaueol(0s2toxr iodlp elictat s2umu  no0tpen oeiysfaDrlu p;() ltnxo3tatlpDeluvol( srxoirpno1omen netl( artmxm oo4optomocild mDea(ms () ltrmfciytlmte neo ()srur(opoo4lpeelncil(f 2tmxrp;t1alto ieiad aDelu snu4 exrmo ty1om r nvi ( s2uoxm ou1ap elictat)a2urxrooo4opt  fctat a rl(vpnu4 rerxrcoatla rau ils truoirpny4lp emfesa()srtmum oo4opx mi3tydlm2umnvp;t0artoifcoytomt  i ols) exo(r oodlpenmiei sfsDum(  oo4oeto o3taslm elnms;u)artrxo oo1laDrau s ()trxr(o3oy1ll elfei s sDtaxrono1alxomietltfs2eanvp (4altnxfciodfp r i ils0setoirpio1lltnmneiatfa2ua( oot1aexnmfciadfm rm(mp t4 rxrmf oa1lat luvo (0tetm(r3no4om n fciasfartru p;o0tpt  ieiatls2rlu o;t4 etriocty1fmte i i s  etr(o nu4alt  nesa()arur( onu0oleo fciyt a rmn s;()aexriociytlpDraueslt texm(r3oy4lltnmiesls s2raxronu0altnii3tat mDemumo;(4 eenxo ootfa raivs;t) rxmio nudllte feslt  2umxroot0apeo fciytla2uau snu4tltrxr tatfaD luei t) rxoim ny4lmtemici t aDrr(mo;u1optoiicils a emumsnu0tlxnmocoodlateliei;s0texm(r oudolen feslt)aDumumpot1tee iiciysfm uan pn(4arenxo ia1la ranvi t  etrim3ou1lm  mieiat)sDrrx o;t0tlx  i3ilsfa rlump;(4 exrio iadoaDr ies ()setmxm iydap nmnctlt sDrr(m nu0apeoifciys m ua(vo;(0aexrxf totfa  auvi;t0s2urxo3iydam   nctlsfa2uau o;u1optn oeiytfs2rl( o u4tlxrif oatfaDeaneslt)sexoim3ou1lmeelivi sfarrmu o;u4aeenmieiat s2elu pnt4tlxrxo oy1lmDeaieolt)srxr(o3oy1ol  lfesl(fsrta(r nt1tex  ieiatfa2ulnvsnu4 rtoir3oydoatr iesls  2tmxm iu4oleemicias srrmxrpnu4ale micild aDeaump;(0tlxnxfcoa1opDr ivsl() rxmim ny1op  lfcil(f 2trum ;o4ope miciys m2uan s u4 lenmociadlp  livo;s0tetoimpno4lptnlnct s)aDtmuront0apxomieiys m rmuvs;u4alxnmr iydfateai olt  rxoxo oodaptn ietls)sDur(m oo1tlto ietys m2ran p;(4aeeomr iadlpt luei (  exr(r oodol nmiei t)sDtmumo;u1altniocias m ranvpnu) rxrif3tatfm r i s s s2tmxo nu4ll  mnes t)aDua(mooo4tetn fctytlmDulu p t) eeoir3ta1fmDrlnvs;t0 2xr(m oo4al emiet () rrm(r ;t0aexnioeiydls2umn p;t) ltomr oa1op  lnes s)srtrimpiodomt mies ( srtrxro;o1oee ifeild m rmnvpnu0tltrxf ootfp r uei t seur(r3oudal e ncs (  Drrx o;o4tlx io3ils m2rlump u4 etomr tydlp e uvs t srxm(r3io4aptn fvsasf 2rm(monu4olxnmfeiytla2eln pn()trtrio3oatlpt aues s0s2umio3oodape livi t)srrmumo;u4olen ietaslm2umnmp;t0tetomocootfatranesl(  eurxr3ny4lpenlfeia() Durxro;u1ole iociyslsDulnmsnt4aexoxrcoatlat  u slt)trtoio3oy1apt lfvtas) 2rmxr ;u1apt ifcildfa uluvs t4trenmfcoadlp eln o (0 rxoxr oydap e nvil(  rrm(mpnu4tle io3tls s2umn s;u4 rxoxo3oy1faD  nes;s s2xr(o oy4olenmietat)s2tm(  no4oeto ociadlsDranmo t4teenmrcoa1lp raieil(0 2xo(m3iu1ame  fvs sfa2rmxm nu4opx ifciyslsDrau s;()altrxo3to1lptelneo;t0 2xm(r iu1lp n ivs ( aDum(rooo0ale  f3tlslm emuvp u4aleoif totfmtelieo;s)srxrxopiodapt  nviasfs2urur oo4aptomfctldlaDemuvo;t4teermr iydlaD  uesl(0 exo(rpiodole  neil()s2tm(ro;t1aet  f3ilsfa2ua(mo ()tetnmf3tytopDrliei t)srtoxm3io4am nlicsl( a2raur ot1olen i3iatlmDra(vpn(0 etrmo3iotomD aiei s)t2uriopoudlpt livtls srumumpnu0alxoif3tadlsDra( s u4aetoifciytlmteli s;s)sexrim3nodlmtnmicias  2rax  oo0oex  ieildfaDel(vo t)trenir3tydlate ivs t) rtmxm iu4ll  mfvtl(f Dtrxm ;u1oeen fcilsfm uauvpnu)texrxr3tadlpDeanvo t)s2to(o oo4lmeemneia( s2tmur ;u1tlx iieias aDemump (4 lxoxoctatfm   i ilt) ruo(m iy4am   fci s sDrr(roou4oleo feiasls2emu o;u) lxnif3to1fat anvils  exmxo iodal  mnci t  2ta(moot4alx  feils s ea( pnu) exoif3oytoa eaues t0s2tm(mpiodllt lies ()a2uaxroot4oetomociyt s ulumo u)texoxf tatlpt auvo;(0srur(mpnydoptnmfcsltfs2trxm ;t1tpeo fctls m ulnmsnt0aetoifcty1fm rli o s) rtmxr oy1olt  nvsa(f Dtmurp;t0tpxnmi3iydfs uau on() eeoio3io1lptraneilt sexriopiy4ameelies (  rtmxmpou1tlt  o3tlt aDuau o;u)aexrmr oy1laDeauvol( texrxmpou1lp n iet (  rra( ooo0alx ioeiad m umuvo (4tlxnmoctatfmte ueo;t texoirpnu1ape lnvt t)srur(  ot1alt mo3tadfa ulnmont0tlxoio3ta1fp eau sl()s2xrxo3oo1lpenmivi t)arra(m ;t4altniociatfa2uan o;t)artrmr3todoaDeauvslt0srto(rpoo4al n ncs s)sDraxmonu4opto oeiydfaDul(mo;t0 lenxo ootopDraues;s) etrxrpoudomeemivs t) rrmu pnu4oltnmf3ilslmDrm( sn(4aetriocio1omteanei (0 ruoio3ou4apt livils) Dta(mpou0tlen f3iyslaDel( s;()tetnirctatfaDeai s t srurim nudap  livsatf Dum(  ou1tet iicild mDra(ms u0aeeomo3oa1fptr n o s0teuo(o3oo4lpenmfctlsfsrrru  ;t4oex ioetysfa2umu o;t4 etnxf ty1fmDe n olt0trtm(opio4olee fetl(  Dta( onu1apx ii3iyt a2uauvonu)tlenmr iatopDraues;s setrim3ou1ol emfctat  2ta(r ;o4texoii3tltfmDelnvs t4aeeoif oytopDe n o;t) rtmiopoy1om nlfcsls s2ua(rpoo1altomfctyt aDua( pn(0 leoio todlm rlivo;()s2uoio3iydlmtnmictas  rtrum ;o1teen fctlsfa rm( s;(0texoxfcoodoatelivo t)t2trio iu1alenmfcsat)artmur ;t1tle mf3tasla2ra(vp t)teeoif oodfp  aneol( s2xm(o3iudomt mivsl()aruru  nt4tex  o3iat mDemnmpnt)tetoir iotoaDe ueils)t2trxr nydap  mfes t) ruaum nu4tpe mf3ildfaDrln snu4 eenmf3oydlm rlu s s0setrim oy4om  miesltfsrumuro;u0opx mocilsla eauvpn() eenif tytlaD aneil() euo(o3no4lpen fes sfsDuaur ou4aleo fcilsls emn sn(0tltoxf3iadlp elu s;t)t2uriopoudol emivsas aDtrumo;t0aetnifeiydls2eaump ()alxnmo3iy1oaDe i i (  euoio3iydamte ieil(fsDrrum ;o0tlt miciadfs el(vsnt4alenxo3iatla r n olt  2trxopnu4lm  mncilt  rururp;u0apen fciys a rmu s;(4 rtrmr3io1op  aiesl()s2xmir3nu1op e fetls) Durxro;u0aeenmfctytla uaump;t0 exrio3totoa e nvo;()s2tr(o io4opt  iesls)sDuau  nu0tltoifeildlmDulu snt0 eenmfcio1fa eln ils0tetrim ou1am   icsas)aDurxrp;u0tlxomf3iatfmDrlnmp;(4tleoio3iotoaDeln s;t srur(m3iudlmt mieilsfa2rmx poo0tlt ifeilsla uanvpnt0teermo iy1omtelivo s setm(r3oydlpt lnvsa(f rtau  ot4opx ifetaslm2ran snu4 leomrctatlptelu o;s) 2toxr io1amenlfvslt srrmx onu4tex  feildla2umnvs u) rxnmo3io1lm eluvol() 2tm(m3ny4opt lnei t) Dururpnu1olt  ociys a uln p u0 rxrmf ia1opD  ivi t0setrxr iydolen nvt (faDtm(r nu4tlxomf3iysla2uaums;()trxoir oodop elues s0 eur(r3oodom emfeilsf 2tmumpot0tptomf3ildfm ranmp;t)aexoxociodfp e uesl(  rurxo3oydamenmfvs t) Dtrx oou1optomfeiatfs uanvpnu4tetoxr3oydopDrlu i t0 exoxmpiodapenmicil(fsDrau  ;o0oetnmfctls m2el(vs;t)teenif iadfpDr u o;(0 etrim nu1lmt lietat) Dtaxmono1alxo oeiyt a umump;u0teermf oo1fpt ai s;t) rurim ou1olen iesl()arrauro;o1alx iocias a rau pnu4aexnir3ta1opDeliesls srxrxo oodlltnlicslsfarurumoot4oltnioctltfmDelnmo (0altnxo oatlmDelnes t)t2tmim no4oltnlfetatfsrrrxrp;u1alx mi3ild aDrm(mpn(0 reoxo oy1fp r i i;t) 2xmim iydoleelnctas)sDrrxr nt1aee moctysfaDrmuvs t4teeoio iytfmD  uvi s trxmxopiudame lnetlt arrmx  nu1tpt  f3tlt m emumsnu0alenmo ia1lptrlnei (  euo(m no4lmtelnctat) Duax  nt0apxnmfctltfs2rm( ont0altnmr3oa1oa rau o t) 2xmir ny4lptn ics t) 2uau pot1alt  feiasfm rlnvo u) ltrmr3iotlpD li s;(  eumim ny4opte nctls)sDtr( ooo4apeo i3tyt sDum( snu0trxoxrcootop eaneols) rtoimpno1ale mnesl(  rtrxmonu0tlto oeiadlm ranmp;t0 etrmf3todlpD lneol(0srurim3iu1ll n net (farrru ono4tpeniieiytla umu pnu)trxnxf iadopDeln o s)s2umir nu4lp emics t a2um(rpou1tptnmoctlslmDuaumsnu)alxrxo oa1op e ieo;(0srtmimpoo1lpe  fcias s2urump;o0ale ifciyslmDrln on() rtoxociytoaDran i t)setoir3ny1opt lfvt (f 2ua( pnu0olxo octyslm rmnvo;t) lxnmo3iodfaDr ies (  exm(m3ou4alt licias sDrau o;o4oleo iciydfsDra( p;()tlxrif oa1lpDrai i ()texoxo3iu1lmenlncia()s2rm(moot0olenioeiat s rl(mo;t0trenxo3tadlm r nes;t0s2um(o3oo4op eliciatfartmxmont4opeoiociysfs2ua( p u)altoxf3oatlpDraueslt0trxm(rpnodllee feil( arrau  nt0aex mf3iltla2elump;u) reoio totlp r n i;s0s2xm(o3iu1om   ici ()s2ur(  ;t1aet mfcils mDuluvpn(0 lenmr3oatfaDrlivs (  eumio ou1am  mncia(fsrtm(m ;t1oeto f3ildfs ul(vpnu0aeenxo oodoptelu s;t trxrim nodlm  lieilsfsrta( o;o4alxomieiys a2uan o;(4alxrmf iy1fpt li i ()seurim nudalt miviasfs2rr(r ;o4tltoioctydla2uan s;u4tlxrxoctotfm  aueo t  ruoxm3nudoltn nvias sDraurp;t1olxnmieiyt s rmu snt)trxnxo oatlmDraivi;t0sexmirpou1lmtemneta(faruauro;u1opeomfetysfa2rlnvs t4 etrxo3ootomD ln ilt) rxmxm3oydaltnmncsas)a2uaxr no0alenio3iysfs ranvonu)arxrmr totfmDe i s;( trtrxrpiy4ome mfetasfs2rmump;t1tleo icilsfa rl( o;(0artoir3oy1la eaneo ( trumiopnu1lme lnctl(f Dtauronu4opx ifeildfsDea(vs u0 eeomf tatfateliesls0srxoxo3nu4om  mies t aDuaumpou4aexoifeiysfs rm(mpnu4aetrxo3tadlaD aieols) etmiopoy1lmt lfvt ( sDtaurpnu0aexo feiatfaDemuvs t4tetnmf3iatfpteli s;() 2toirpnudlmte fcs tfa2rau  ;o1aex  feiaslm2ran ont)tltnmf3iytfmteln i;s seurxopoo1apt mnetlt  rrrxr ou1aeen feiadlm2um(mo (4texrxrcoadfm r iesls) 2um(mpnudomen fctas) rrax  ou0tptn o3iadfaDrmums ()trenxoctadlmD au i;s0tetrxm3oy4alenlfet s) Dta(mo;o4texn oetldlm2rlnms (0alenir3ia1oa r i s t) rxm(opnydamtemietasf rtaxm oo0teenmiciltla elump;() ltrxr3oytfp ranei t0 rtrxrpiy4apt lietat a2ra(roou1oeeoifeiatla ranvo;(4tlxnxocio1op ean o;()trtriopnu4opeelivilsfs2rr(r ou1alto icilslaDrl(vp t0tlerif oa1omDeau ilt)s2ur(o3no4lltnmnvs ()s2umu o;u0open i3ilt s rm(vs;u0 etomociy1opDr n olt0srurirpoodll emivt (faDtr(mont0aeto f3tltls2ulnmo;u) reoirctatfmt  u ol(0srtoxo oy1amt mfei (f Drmumpou0texnmf3ilt m uaumo;(4 etomrcoatfm e ieilt t2trxr3io1aptelfciat) 2rrxr ou4opx micias s uanvs;t) eenio oodlm  aieo t)seuo(rpiu1ap   fcia(  Dta( oot1oeeo i3iaslmDul(mon(0tleniociotlate ivo t srumxrpiu1aptnmies (f rtrum no4oexoio3iadlm2rluvp u)trxoxr totfmD aneol(0seto(r ny1op e fcslsfarraum nu1opeomictldlm um(vs;u4aexoio3iodoaDelu o s)t2toimpoo1lpen fvs s  rrru poo0tltniieiytls2uanvo (4 exrirctytoatr ivi;t setrim3io1amtnlicil(  Dumurpno4aleo f3iyt a ua(vsn(4aleomrcoytfmtrlues;s)s2xrim3nydaptelneilsfaDrru pot0tlxnifeiltfaDem(vp t4 rtrifciodom  ai ol( teum(opiudoptnmiei t)srurum ;o0apeoiietysla el(msnt)aeeoxr3oodopD auvi;(  ruo(rpnudal elfes t)aDuax poo4tpe moeiltls2em(mo t)teenxo3tadop raneslt srumir iudamte iciat) 2tm(mpot1oex mieiydla um( ont4 reomf3iotlpt  u i;s tetrxm io1lp nmnvs t) Drrx o;t0aex mf3iad aDrmumo ()arxrmr iydop e uvslt) ruo(m3iodam   ivsat)arrm(rp;t4oeto iciltls ranms t) eeomf oydlp r ivo;s)srxr(r3iodll n fvsatfa2um(r nt1oetnio3ilsfaDrmumsnu0 rxnir oadopte uvils)s2xm(r oodomeelivtlsfsrumur ;u4texnmf3tltla2rm(ms u0 eenir oodfmt luei s) rurir oydllt  fcilsfartaurpnu0aptomo3tls m rlumo t4artomr ia1lpD aieo s0sexrio3oodape  nctls a2ra(mo;o1altnmfetldfs emuvp u4 rxoxo3oy1laDeli ils t2urxopiy1optemietas)aDtr(  ot1olenio3ilt a uanvs t0 rtomocoatfmDe ues;t  etr(o3io4aptnlfeiasfs2uauroou1oleniociltlsDulums;u0altnio oa1op   ivo t0srum(rpoydap   ietlsf 2ta(ront0ale  ieiysfaDrm(mont)aetnxr iadfpDrluvs;t) rur(rpou4llenmfesl() 2tr(mp;u4aptomo3tlsls eaumsnu4aexrxrciatop r ivsls0sexr(rpio1lmeelfvtatfs2um(mpnu4aetomi3ils m2eauvon(4tlxnxfcio1lmte uvi s sruoim oudlmtemnct t) 2urum ;u0aeenio3ias a umnvs t) rxnmrcta1lateai slt trtm(o3oy4ll   nvta(fsrrau  ot4aetnioeiadls el( p (4treomo ty1opDrliesls) rto(m nodal  mfeiatfa2um(mpnt4teeo octyd a2eluvp t0teenxrctatlmDeai i s0trumxr iudomtn nviat  2rau  ;u0tpxnmiciadls2rmu p (4trtrxr oytlatranvols0t2toim3ou4lme mfviat) rrru  ou4olenio3iyt a um(vsnu4 lxomo3tytop  lieo;s0 etoimpiydlm  lfvil(  2uaxr nu4oleomieiytfaDemnvonu)arxnir oydfmDrlnvi s  2xrxmpiudomtnlnvils sDtmx  ;o4tptomfctydls2el( s;u4 etnxr3oy1fmteaivo;s0 exrio3no4alt mfvsa()aDurumpou4apen octlslaDeln s (0 rtrmo3to1oa rluei;( s2ur(m3iy1olt lnvsas aDumumo;u1tlenmf3iysla rmu s u0 ltrmf3iytfmte neol()seuoxopnu4am   fvsasfartrumpnt0oexo fcildlmDul( s;u0arxrir ia1op eln s;t) rtr(o3oo4lm emfctl(  rrau o;u0texn ociyt sDuaumon()tlxrxo3io1fpteaues (0texmxo3no1alenliei sfarrmx pot4tpxoifeiatfm2eln p t)tetoio3iotfptrauei;t setr(opiy1al  mnet () 2uaur oo0tpeniiciatfm ea(vo;t4tetnmrciatom eli sl( trtoxm3io4om  lictl(farrr(  ;t1olx  oeils s2emu sn(0aeenif iodlat an o;t trxo(opiu1op elivta(fs2umx o;t4tpx mi3ild a2umn p;() leoxfcoy1lm elnei;t  rxrxrpiy4ol e nct ()srtax poo4tlxnmociydla umuvo;t0 lxrxr3tatoaDe ues;(0srurxo3iu1lmeelfvt ()sDtm(rpou1opeoii3iydla rl( s;t)trtrmfctytoat au ilt) euo(m iy1omtelfci s srrmxr ou4aeeniietaslaDrlums;u) ltnioctadlptranvils srxmim oodlm n fetltfs2trx  nu4teeomieiasla2uln p;u)aetnir iytlm   n s;()texmir oudoleelnctl(  2uaxrpno0tetnmietydls2rlu p (4tlxrxo3iodopteluei;t  ruriopio4alenmietl( sDtmur ;o4olt mo3tysfa rln sn(0tetrxr3oydlm eauvs;s)tetr(opny1omt  fei (farurumo;o0openif3iad sDeluvo (4 rxrio totomD lnvo;(0 2xrxr no4opee fvs (  rumumont0tpt  ictat sDemn s t) rtnmrcio1optrliei s)tetm(r no1amtemivs s s2umump;t0oetnii3iyslaDel(mo;t0 lenirciodomDean o;t0trtrir oudllt lncilt)srtmu p;u0aptn ieildls2rm(vsnt) etrmociytoptrlneols0seuoirpoy1ome livtlt) 2urxroot0tptnmf3iltfs2rlnmpnu) lenxf io1fpD ln i;(0s2xoimpoodoltnlivs () 2um(m ;u0ope miciydla uan o;u0 rxrirciy1lp eanvs s0 2trim3nodoltnlfvt s)aDurxr no1tpe  fctad s el( o t) renxf iotfat  i s s0seuo(r oo1llenmivsas sruaxrpno0tetniicild a2elnmsn()alxoxr oa1lpte ueolt) exrxr3iydomt  ieiat)sDrr(r oo0alxomi3tasls em(vonu)artnifciytlmt lnvi;s  2tr(mpnudlleemicsl( arumur ot0tpenio3tydfa um(mp u0tetoxo tatomtran o t  etoxm io1am nmnvsltf 2tmu  ;o1oee miciytfsDrmu p u4trenxr iytfp eaivi s)sexmio oudopee feslsfs2rrxrpnu1oltoifciasfm2rauvs t) rxrio3to1fp rlnvs s0tetrxm3no4olt lnctasfsDum( pnu4opeoiociyd m2um(mo;u)arerxr3tadoa rlivil(0trto(o3nu1omte icilsfsDrrx o;u1tex iictadfs uanmonu) renifctatoaDeauvs s)t2umirpoydome miciatfa2raxrpou1aex  feiaslm uanvo;u4aetoif to1oa  livol()teumir oy1lmte icsltfaDumumono0tlto f3iad sDum(mpn(4 leoxociytlmD aivi;s  eumirpou1al e neta(  2um(m nt1tpxn oetatfa rl( p;()artrirctatfa elivo s trto(o3oo1ol emieils aDua(rpnt0tlxomo3iadlmDrmumo () lxrxr iodop eanesls trxoxr iy4omee fetl( a2ur(  ;u1opx  i3iltla2rlnmsn(4aetnmo io1fpDeluvo t srxrir3oodomte ncsl(f 2rm(rpnt1teenmieiatfmDemnvsnt)texrxr3ia1lmDraieo s0trxmim3io1lpt mfcsls a2trxmpoo1olx mi3tatls rmu ont0aleoxrcoy1latrlneolt) rtr(r3no4am   icsl( s2raumpou1tee moetldfaDrm( s (4 reoxr oytfpDrluvil(0sexrim3nu4lle lnesl(fsrumx oot0olxnifetlt m rlumo;(4areniocoatlate i o (0trxmio iy4ll e nvs (  rtrxmonu0tlxo fetyd aDua(ms u0 exrmfcoydlptrlnvols0seuoxm3iu4openlnviltf ruaurpot4oltnii3iad s2emuvo u) ltomf3todomD lu slt srxo(opou1lptelnesa(fsDua( pnu1oltoio3iasfaDum(ms ()alxnmoctytoa  lneo s0s2umxrpou1amenlfvtasfsrrm(rpnu0aexn fetytfs2emnvo (4texrmf3to1omD ai i (  rxm(mpno1ope mnvtat) rta(monu1altnmfeiytla2um(mpnu4alxnxfctadlp e neo s) euoxm3iudal e ncsl(  2umxr ;t1oeeo i3tys aDel( pn()alerxrciadlp r uvil( t2xmxr3io1llen fcia( srurur oo0aex  iciadfs2rlumo;u0tetrmf iytlmD lnvo s0t2xoxr iy4lmt miei ( a2ta(m ;u4alxn ociytfm2eanvs u0trtnxfcoa1fpDrlieilt0 2urxm oy4ol n fcta(f Dum(m oo4oeeoii3iatfa rluvont0texrxf3io1fmDeaueil() rtmir3io4lme  ieslsf 2ur( ooo1tlenmfciltls elu o;(4 lerir tydlat an olt) 2tr(rpoy4lpenmfesls sDrmxrp;o4ape  ietas mDrlumsnt4teerio ootop elu s;t)tetrxrpoydlpe  ics tf Drm( pnu4aexnmoeiydla elnms u4aexoxfcoydla raneolt trurirpno4ap nmivsa() Dumxrpnu4tptnmo3ilsls2ul( p u) lxrifctotlm elies s)s2tmimpnudaptnliet ( a2raxront4ole ioctltfsDrm(vpnu)tetrmr ootfpDraueslt)t2xr(r iudal  mfvt ()a2tru ont1alxnmiciltla ea(msnt) ltomr tytla  ln s;(0t2tmimpoy1lme  iciat srum( ont4tptoifctat sDrmn s;t4aexoir iodlpt anvo;( s2urir3ou4aptnmnes t)artmu  ot1aexoioctlsfa2rl(vonu0tltoxo ty1fptr ivs t0trxr(rpnydoptnlfvsat s2rrxrpou1alen o3tad s uauvp;u4 rxrir3iydop   u i s) 2uoio3ou1alt lncsat)aDta(mpno4oexomo3ils m2elnvpn()tlxrxrctadfpt lu i s teur(rpnudlm nlivt ( a2tmur ot0tpxnmocildls ea(vo;t4texrir3io1lm   ueo s  2xrxo oodalt  fes t srtaxroot0aeeo fetasfsDrl(mp u) leoio3oo1op  anvi t seuoxmpoy1alt lnvsa()s2ur(ront4tpxo octadlm uaums;t4artnir tadopD auei t0t2umir no1lm elieilt  2um( ont4opxn ictatfmDemu snt)tlxnif todla eaieo t) 2tmxmpiy1am e ieiltf Dtrx p;o4oeeo fciasfs2emnvo t0aexnif ta1omtelnvo;s) exm(rpoo1am   nci ()s2rrumo;u0opx ioetysfs2rl(mpn(4trenxo3tydomDrauei;t seum(m3ny1lmt mfcils)srtau pnt1oexnioetyt m rauvsnt0treomo ia1lmt lnvi;s0teuoxmpiydlp nmict () Drmx  no1apen ieiadfs elnmpn(0tetoxr iy1lm rauvslt)s2xrxmpoy4optemfcs t)aDrru  ou1opx io3iatlm rl(mont4alerxo to1lm r nvi;s setrim nu1optnmies s sDtmx  nt0tetomfetyd a raums u4areomrciydfat lueo s0s2umir iudope liesasfartrum ;t0oex mietytfm2elnmont4 exnif iytfmtrlnvsls  2um(rpnydomee fcia() Durxmont4aex  f3iysla ua(vp;t0 etnmocoytlaDelues t0seuo(rpiy1ap e nvsl() 2tm(rpnt1tee  feias mDrln s ()alxnmr3to1laDraieo;(0trtoio ny4optemnesl(f ruax  ;t4alxoiociadfm2em(vsn() rxnio oydlmtrlues;(0s2xm(r3oodlpenmfei (f rur( o;u4tee  fctlsfm2uan on()texrmr3oydom ean o;() 2xoxo oo1lm elnvs sfsrumur ou0apeo feiadlsDemu p (0 ltnir3tydlpDeai o s)t2xrio3oodol eliciat sDtax  no1oeenmfeiasfm eln p;u)texnmfcta1fpDe uvils)s2xmxr3iodopeemnvils) rua(roou0opxomociadlsDumuvp;(0altrmocta1fm r nesls tetr(o iudaptemnei () 2rr(moot1alxoifeiasfa2rln p t)aetnmo iotoaDr u i (0truo(m3oo4openmfetat)arur(rp;u1tpxn iciltfsDumnms u4 lxrif3io1lm  li s t  rxo(o nodlleemictls) rum( p;u1tptn ieiasfa ea(mpnu)aexnir tatlpDrauvsl() rxr(mpou1al nlncsatfsDtax ont0aexniieilt a2ran o t) etniocoo1fmt aivils  rur(m3oodaptemfcs ( aDumxmp;t4tle moeild m2uaums;u4 eerxo ty1fm rluvs t)sexr(mpiy4lltnmicslsfs2rau ono1aexo fciatfs2uauvp;t4 rtnio3totfa  li ol(0 rtrio3oydal n iviat)arta(rpnu0aleoifciatlaDeau snt4 reoxr ia1opDrauvs;t sexoim nu4llt livia()s2uaur no1aptomi3iatfm rmu p;(0trxrxo iytomDeauvs;t truoxr3oo1alte ieiat srtmxroou1alx mfctyslaDrl( pnt) leomfcoydlaDeluvsl( t2xr(o oy4omt  neia(fsruax  nt1aex ifctyt mDelnmp u4 eeomfctadfpDelivo;s) 2trxrpoy4ll   fvtas  Drm(rpoo4alt mieiytfa rl(ms;(0aeenmfctatomDrlu ol()sexrir oudolt liet t  rta( pno0altn ociltls uluvsn(0aexomf3to1fpDr uvo t0 rumir iu1lltnlnvil()a2umxm ;u1oee ii3tld a2ea(mp t0tlxnmo3oytfmtr nvs;t) rtr(opny1omtnmfcsls srur(m ou1tpt ifciatfa uln s u4 rtrifcoo1fmDean ilt  rumxr iodamt mnetl( a2ua(mpnt4tlxoio3tat sDum(vo (4tltoio oo1omD lnesls0t2umirpoo4ap  mfvi () 2rrxmo;t4ope  o3iatls raumo;u)aetoxo oytoat anes (0trxmxo oo1opeelivs t)s2umxm ;o1opt  oetad s ua(mo (4alermrcoydfaDe ueil( trxrxmpiudomeelncta(fsDra( onu1tltomfeiytla rmu p;t4 etnxo oatfmD ai o t0setmirpoydlpee nvt sfsrum(r nt0tlxo fctytlmDrmn p t0trenxo totomDelnvs t)setr(r iydlmeelfcsas) 2rrx pno0texnmo3iatfm em(vo (4tlenmf ootlpD aneolt seuo(o nu1ap e fetls)sruau  ot4tpe mfcild aDel(mpnt4tltrmf3ta1lp eanvs;t s2trxr oy4lp e ncsltfsrua(  ;u1olxn ocils a eaump (4texoifctodopDrlu o;t0 exoir io1lm  lies t arrm(r ot4apto i3iasla2rlums (4texrxr3ootfat auvs t0srurim3io1op nlnesat  Durx poo1ole ioeias mDea(mpn(0treoxo ta1lmD lnei;t t2ur(m3oy4lltn nvtat srtr(mpnu1tee mo3tasfa ul( pnt0tlxnmr todom   u sls0srur(r no4opt  fei s srtmxrpou0tlxnifeiasfm rmn p () ltnmr3ty1lp rlivils srxoir oy4lleeliesatfsrrmu ont0ape mfeiyd a rln s;u4artnxr tatfpD lueslt) rtrimpou1omtnmieia( a2rm(m oo1tetnii3tltfa2raumsn(0 lxrxfcoo1omte nei t) rxm(r no4lpe lfci t)a2rru oot0olen f3iadfa2rmu on(0tltoxo iy1fm rai i s setmio3ou4lp emietatfsDra( pot0tle mo3iasfa2ranms () ltomo3tatfateau i;() 2xoio3oo4lp  livtasfaDua(  no1texomictltlsDumn onu)tetnxo3to1fa   nesls0trxoxopno4apt lnvslsfaDra(mpou0oetoio3tlsfm rmnmo;()alxoifciy1la r i i t0 eto(r3nu4aleemivil(fa2raum ou4aetomicildlmDea( onu)alenifctodlmtr nei s  exrxm3iodapeelnctl(fsDta(ront4aexnmiciasfs eanmsnu0 reoif oy1lp rlu s s  rxmimpoo1ol nmncilt)sDrmumont1aex  oeiaslsDrlumo (0artnmrcoadop rauvils)setmir3io1lp n nvsa(  2umxr no1aexomictatlm emn pnu4 eenmrcoytop r nesls srto(mpiudaptnmnvia()srrax p;u4tpx mociys mDelnvp u)tlxrxf3iy1lpDr ivi;(0sruoxmpoy4om e fesa(  rrmxmooo0apto fciasfa2emuvs;u0trtnir iatoaD lnvo t) 2umxm3iodoptnlnesat)srra( o;o0teenmo3tatfsDuanvp u0teerxfcia1opDelivi;(  2xoimpnydomt mfesat) rum(  ;o0apt iieilslm elnmo ()tlenifctotom e nvs t0teto(rpiy4lm  miet t) rtaur nu0alxo ieiaslsDea(monu)altoir3oodlatean i ()srum(m3iudop emfeilsf 2urxmo;u0oetnifeiad s uauvp;t)alxriocoy1oa  li s;( t2uoxo3iy1alenlietls a2tmuronu1ale ioctydla2el( p;()aetoirciadoaDrlivs t0seumxrpiu1lle livs t)srrmxr ;u4oet  o3iadfa2emnvpnt0teerxr3oy1la e uvo;s t2toxr iy1alenliesat aDua(r ou4openmf3tydfa2em(vo () etrmf tydlmteauvi;(0setm(o oodal nlivtl( sDrmumono1optn f3tad s2rm(vs;t4 rxrif iytom r i o;t) exoxr3ou4apt lfeia( a2rm(mooo1aleo ietltfaDrl(vo;()trenmr3oytlp rlu o s seur(m3no4apt lfvtasf Drr(m nt0tlt moetadfa el(mpnt4tltomo3ta1latr ivslt srxmio3oo4lm elncias) 2raur ;t0tpenifciltlaDeaumo (4altomocio1fp r ivils  rum(o iy1ap n fesls a2rmx  nu4tpt  i3iltlm ra( pnt) leomr oatfp  aueslt  2umxr3io1lpe lfci (  Dtm( p;u4tltnmiciat mDra(mp;u0aetrmr3oydfaD  nvil() 2um(m3nu4ale mnvsat)srtrur nu4olxo f3iytlaDraumsnt)alerxrcio1laDranvo t)srurio3iy1lm emfctas)sDta(rp;t0oee mo3tatfs eln p ()tlxoio3oatfp  anvsls)seto(mpny4omee iviasfaDumu p;o0oleoifciyd a umnmo;t0artrxr ta1oaDr ueo t  rumxr3no4ll e fviltfarurxroot1tle iociysfm ua(vs t0aetrif iytomD anesls  2xrim3no1lm emivt (fartm(  no1alen fetas mDrlnvs;u) eenmrciy1op  aivs s)trumxm iu4altemncil(f 2taxrpnu4alxo icilt mDra( s t0 etrmo3oy1laDr uvs;(0trto(r nu1opt miesa(f 2umuront4apeo fciyt s rauvp u4tltnir to1optr ueilt0t2xr(r ny1lle miviat) 2um( o;t1ale  octyt a2ul(ms () lenxf ty1oa eauei;t)setmxo3iydll e ncs (fs2ta(r nt1tle ifeiasla2ua(vs;u)altnxo3todlat aivs t) rurxr iydlpe mncslt arraump;u0oleo iciltlsDumn o u) lenmocoo1lp   neil(0seuoir3oy1al e icsls)arrmur ;t4oltnmociasfm2umu o;u) rtnmo3io1lpDeaivi;s setmim3nudlm nmnes sfs2um(r nu0apx iiciat a2rlnvo;u0 lenxr3oa1fmDeaivo (0 rurxm3no1apee fctls)srtmumpou1tpe ifciadls2rm(vp;(4 etnirctytlp eaivs t  2xoxmpio1ol nlfes t a2tau o;u1altomocias m2rm( s u4 exomocootfpDran i;t sexr(m3oy1ole mivtltfs2tr( onu1oleomfetytlmDuaums u4texoif ta1fatelueils0s2trir oy1lmt miviatfartaumo;t4ape ifctltfs ea( s;t)tltoio iydla raues;t) 2xrxmpiu4lleelfcslt)a2rmxrp;t1olx  ieiatfaDul( o u4trtrmociodfaDeaues;(0s2xrxo3oo4om e nvilt s2umxr ;t4tlx  i3tasfa2uln o;t)trerir iodoatr u ilt)trtrir nodalt lfci s sDtm(rpoo1oleoif3tatfa emums;t)alxomoctadla  ai s s) 2tr(o3iy4lp emivsat)sDta( pnt0aeeomfetadls ulnmo t)aetnio iatomtr uvi;() rto(rpny4altnmnvi s  rrax ono1tlt  f3ias a2umuvs;t)texnxrctatoaD lu sl()t2xm(m3oy4altelfvslsf rrr(  ;u1opt  i3tlt s emnvon(0 exoir iytlmD  ieo;( sexm(m3oy1lptemieils s2tmx p;u0oexoiociadfm2eaump;u4teeniocoy1lmt  ivs ( srxmio3ou4al elnesl() Drru p;u1opeo f3iltfs ulums;(0aexnxo3iytlpDrli s;s  rxo(mpiy4openlnei s arurx o;o4tlxo fciat a2ul(mo t0arxrmo3iotomDranes s)srxmir ny1aptnmnetl()a2tm(mp;t0apxomoctatfs2ul(mp;(0artoirciodfaDr u olt) rtm(m oo1ole mivtat  2ta(  nu1tptoiocilt m eln s;t0 lxoio3oy1la  lieils s2um(rpoy4am  mfesa( aDur( onu4tetnmf3ias m2rm( onu4 etnmfcoydfaDrlues s)t2xoxm3no4ol e nviatfsrra( pno4tlx  feils a ulnmp u4trerxf3iodlatr ieols) rxm(m3ou4lpenmivtlsf Drau p;o4tpe  feild sDraumo;t0tlxrmo3oy1fp eaiei t)srtm(opoy4op elfcsatf 2uax  ;t1teeoiictasfsDuauvsnt0texoxr iatomtraneo s0sexrim3io1llt lfeiasf Dtmxrpnu4teeomieild aDrlnmp;t) eerxr3io1op eau ilt0setoxopoudal emies sfsDraxm nu4oexomf3iatlsDelump u4 rxnif3iotlmtrlneols) 2uo(mpoo4lmte fvsasfsruru o;o0tpx  feiat sDrmuvonu4 lxomf3oytfaDeauvo;t  2xmxm3oy1alt  fes tf 2tm(mo;o0opeoioetasls umuvo;u0 exnxr tadfp r nes;( setrxmpoo1ll elneils) Drmumoot1tleoiietldfaDeluvpnu4arenirctytomtraueols)seuo(rpiydol elnetlsfaDra(mo;u0alx iieiydlm ea(mpnu)alerir3oodlaDeluvil() rtoxo iy4am nmnctatfsDrmxrooo1apto i3ilt s2ean o;() exrmo3oodlm rauesl()seurir3io4lm   fct tf Dur(mp;o1tlxomiciatls emnmo;()aetrifcia1om ranvsls)seurxr iu4ole  neil(f Dtrum ;u0aeeoioetaslm2rlumo u) rtoir3iadfp  lneo s texmir3iodlmtelnvtl(  2ra(ronu4oexomictytfsDeaumpnu)arxrmo3tytoa  ai i;t  exo(o3nu4lme micsa()aDtmx  nt1tlxo iciydlsDuaump ()tltnir oa1omtelnvsl( s2xrim iydape mnvi s)s2ta(mpou4aeto fcilsfa2ea(vs u)arenxo3oatopDrluvi s0s2to(r iu4om  mnciasfs2raxmpou0oexnii3iadlmDrlnmsnu4aleomrctotfpD  neo () eumxm3ou1ol e iei ()arum( o;t4tpenmo3tlslm2emuvpnt4tleoircootfmDe iei t) rtmxr3ou4lme mfetlsfs2rmumonu0apt  ociydlsDulumo t)tltoir oa1fmtr uvol(0s2xrim nodlltnlnvi (faruaxr oo1teeomi3iytlmDuaums t0 ltoxo iadopDranes;( seuoiopno4ame  neias) 2trx  ou1alxnmictyt a2um(mo;t4tlenxr3oo1fmtrli i ( t2uriopno1am emiei ( sDtr(mpnu1apxoii3iltla umn o;t0tlenmrciotlm eli o ( teuoir oo4al nmnvtlt a2rrxr oo4apx iietys mDrlnvo t)aeerif3iytlpte nvs;( srtm(r3oy4al  mfesa( sDraxm ot1apenmictytlm rm(mp u4trxnxr todoatrai s ()t2tm(opoodape lfeiltf rra(rp;o1oex  oeildfm2ra(vsn()tetnxrcoytom  ln s;s seumimpiy1ll  lictls arumu ooo1tle  feiadls2el(monu4 exoif ootlat lnes s) rtrxo iu4omee feils) rra(rpou0tpxo ictld mDrau snt4teenxoctytfpDrluei;(  2urxmpiydopen nesat aDuax o;o1tptoiieilt a eluvo () renmr oatfptelivols  2uoio3oo1lmt  neilt)sDtmu  ou1opx  ieiltfaDemn o;t4 ltoxr3iydom rau sls  eumxo ny4llt lfei () Dtaxmo;o1teto icildla2em( s;u4 rtnmo ta1lp eauvols setr(r3nu1oltnmfeil( aDtmumoou4tleo ociatlm rmn o t4aetnmo tadfp eau slt) rxm(r oodlptn fvs (f rurxmpno4aex mieildfm rmnvsnt4tleomocto1lat livo (  2xmxm3nu4ole lici t) Drmx pnt1oetn i3iyslm rlu p u)alenio oodfa rluei t trtoio3no4aleelfvsa(  Durxm ;o1oex ifeiaslmDran s;(4 ltoxf oodomtrai s;() etoxr iu4ape mictls)arraxmpou0oeeomf3ild a2rau o t)texoio3tadom rli i (  2urir3iu1olenlncils  rrr(mpot4tpt  fciasfa emn o (4aexoxoctadfaDelivols0 2urimpnu1ap nmicia() 2tr( ont0tee mo3iys mDuanmp t) rxomf todlm e i s s)trur(r3io4ap nmfci s) Dta(rpnu4aet mfetas a2rlnvs;(0tlermf3ta1oatelnvo;s  2umxopnu1lleelfvslt  Dtmum ;o1ope mietysfmDulnvo;(0aeeoir iatoatrlneol(  2xm(opiu4amt  ies ()a2ra( ont4tee ifctasfs rmn o;()arenxf3iodlm rai slt)s2trim nudam  lnvtltf ruaxm ;o1tpt  o3tad s2rlnmsnu4tleomr iodfatr nei;( seuoio oy4lm n nvt tf rrr(rpot1aptoioeiasfa2eluvonu0altrir oodoatraivils0texm(mpnodol  mnvtls)srtm(  ;t4olt io3iadla ea(mp;u0trenmr to1oaDraiei s0srxoxo ou1lltnlfeiatfsruax  nu0ape mf3iyslaDeaump;(0alenmocta1omDrlues t0 rxm(o oydalee nvsa(f Drrxm nt4tpx miciaslsDelnmp (4 exnmr3to1fm e uvol( t2xm(m iy4lmt  fetltfaDtr(rp;o1apto o3tldla emnmpnu4alenir3oadom rli sl( srxrxm3nodomtnlietlt sDrrur ot4oex  o3ildla umumont0 exrio3ty1fmDran ilt0t2xrim oydlmt lfcsl() Drrurpoo0tet  f3tadlm rl(mo u)teeoir ta1fpDranei ( srxoimpiy4lleelfvias) rtm( ono1ale moetasls2ulump;u0tlenmociytlpt  nvo;s  2tm(r nu1ap nmietl(fs2tmu  nu0tlx  f3tatfa emnvp;t) ltoxo ootla e ivsls  etm(rpnu4amen neta(f rta(moou1apxoifeiyslm uanvo (4trtrxr3ia1fmDrli i;t trtr(r3io1altnliviat)aDum(mo;t4oeeo f3iadfa ul(vp u4 rerio iydlaD auvsl(0setm(o3oydam  mfciatfaDrax o;u1tleoioctydlaDeanvs u4 leomfctotla   ivs ( setmxmpoo1aptemiesa(  Durur ot4oltoiociatlaDelums u0trenio ty1oa  au i ()trtmxr oy4lm nlnvi ()sDtrxm ;o4tlxn ocilsfsDeau snu4 leoif3io1opDe ivslt0t2umxmpoodlmeelfct sf 2tmxrpoo4ope  feiytlsDranvo u0 ltoxfctydlatr nvi t)s2tmim iu4apen ncsas)sDtaum oo0alxniieiydlm2uanmo u0arerio3tydopteaivs ()seumirpiy4aptnlncsl(fsrta(  oo0tpeoio3tlt m2eauvp;t4 rxoxrcto1fmt anei t0srtr(m3oydlltn ncs s)a2uaxmono0tpxn oeiatlaDuan s;t0trxnmf iodopteaivo;(  2toiopiu1olen ies tfsDuaxro;t4tlt ifeiatls2rl(msn(4tlxoif oo1fpt li il()t2xo(opoo1apee fvsltfs2raur ;o0alxoio3ilslmDum(mo;(0alxoxo3iatfp  aivi s0setrxrpnu4apte fciat sDumu pno4oetn o3ildlm2rm(vpn(0trtrmrcoatom  lu i t0seuoim no1ap nlnvtlt aDua(mpoo1aleo i3tat mDrl(vo;u)tleomf3oa1la  aivs t)truo(r3no4ap  mfvsas  rtrum ot1apeo iciyt sDranmsnt)arxrmocoydlatr nvs;s)sexrxo3oydap   fetltfsrrr( p;o1optoiictad s2rl(vo;t4 ltoxr3tydfat ln ils sexoirpiy4apenlfei t  2ta(rpou0tpt  iciydfm uan o;t0 rtnxr3ty1omt li ol() rum(r3nu4ome  ivia(f rua(r nt4apto iciyt m elu p t0tleoxo iadlm   ies s0teurir iudomt  net ( artmum no1tetoiieiatfmDemn on(0 eermr iytlp r neo;t0sexr(m3iu4olenmfvtl()a2umurono4tlxnio3tld s emn p;(4alerxo3iatla r nvo;(0s2umim3iudomtemfet s)arrrumoou1tpe  oeils aDra(vp t)tltrxf3ootlat lies t s2tmir3iodopt lfvils  Duax  ;t4oltniiciltlm2elnvo;t)texrirctatfp eauvi;s) exrim oodlmtnliesa( srrau ont0tee io3tat a rm( p u4 ltoir3ia1lpDrau o s)s2xrxmpiudlptemfvi ( aDumxrpnt1ole  i3tlsfsDuan p (4tlenxrcty1la e u s;()trtr(rpiy4ap nmfvsa()aDuaxmonu1tlxoifeiytfaDrlnvo t0artrxrciydfmte i i;s  2uoir oudlm  lieilt)aDurxmooo4tex micild aDrmnvsnu0aetoxo tydfa elnvs;t seumxo3nydap elnei s  Dumx o;o4tetnifetasfs2emuvpn(4artnxfcoy1latr nesl(  etmim3oy1alte nctlt  2trxmp;o0aex io3ildla rmu s u0altnxr ia1lp  livo;(0t2ur(o nodllen ncils  Drrurpnt1tpeomf3tys sDum(mpnu4altrmfcta1fmDe ueo ( s2tmir oodopt  fcia()sDua(r ;t0aee  oetyd s ea(mp;(0trtomo oodoa  lnvs (0t2xoxm3nu1alenmfctls) 2rr(moot4tpx mieildlm el( o;t0 eenmf ootoa rau o s) rur(mpno1ap nlncil() rtaumpnt1tltn o3ilsls2ul( snu)treomf3to1oat ln i;t0 2urim iodoptelfes (  ruaumo;u0teto iciyt s rm(vp;t)trtoiociytomDraiei t)texr(o3iy1optemnvtatf 2umxroou1tex iictytfaDul( o;t4 exoxrcoatopt livi t) 2xmxr nu4op emncilt arrauro;t4tlxomoeils mDelnvp;t4texoir io1om e ivo s0s2xmiopiydapen icsltf 2umxro;o4aptomi3tasfaDrln s () eenmo iatopDr uei s)teuoiopoy1olenmfvtls sDurxmpnu1tpt if3tasfa rlu s;t0 lxnir oo1fm  li slt tetm(m3oy4om elnvta() Dtaur ;t0tet  o3ilsfs rmumo u4tltomrciatfpDelnei t0 eumxo oudam nlieslt  2tr(  oo1tpxo ictls aDraump;u0artoioctydom r uesls0srxm(mpio4oltelfei tfs2ua(ro;o4aexnio3ils a2emu snu) lxoiocootomteaivi;()setm(mpnodomtnliciatfsDrm( o;t0olxn feiyd aDel(vsnt)artoxfcio1laD lues;t) rxr(mpno4lmt mnvsat)s2rrurono1oee if3iadfs ua(vo (0 ltrif3iatomt livi t t2tm(m3iy4apee ictl(  2rmu  no4openif3iytlsDem( pnt)altnxo totlaD luvi;t  ruoxr oo1lpenmncs ()aDtm( poo1opxnmfciyt a2eln s ()trtnmo oo1om e ieo;s0 2urxr nu1aptelfct s)a2rmx pno1texoiociyslmDumu p;t) ltoxrcoo1laDrai i;t0 2trim3ny4olenlnvils)a2raurp;t0tpxo iciadla rlump;()aeeomf3iadopt  uvi;s)texoio3nodaltn iesat) rtru pnu0aeeo icildfm el( snt4 rxnif3oydfpDeauvi (0srxoxrpno1om nmnctlt sDtm(m ou0tetnmietatfa ranvsnt) ltnmrciodomtelu s s) rxoxmpiodam nliesl(farumurooo0aeeo oetas mDrmu s;(0alenxr3ty1fpDeauvo t) 2xrim iy1lm  mieias)artrumo;t0tpen ieilsfa ul( s;(0aeerxf oydoatrlieil(0 2urxm3oo4lpenmneil( a2tr(rpnu0ope mf3tad s2eluvs () leoio3tytfpD lnvslt0 etrirpnu4amee ics t)arua( ont0altomf3tyd a2uluvo;(4altrir ta1fp e nvo;s0t2tmxo io1apt lfctlsfa2urxm ;t4tpt  oeiyd m umu p;u0 rtrxocoodlate ieols  2trxo3nu1om n fci ()sDrmxmpno0aex micilsls2emump t) ltnxr oy1fmDrln o ()srtriopiu1llt lfcsl( sDrm( p;t4apxniociat a2elumo (0trermr3oytoat lu o s)sexm(o io4openlnvilsf 2taxmo;o0tetnmoeiadlmDul(ms;(0 etniociatfa e u s;(  rumiopio1ol n ivil(f 2tmu pnt0optn ietatlaDrlu o;(4tetrxo3iatla eauvolt)srur(r iy4ole mnvs s) Draxmpot0optoioetldfs ulnvp u0tltrxr3ta1lptean s s)s2tm(m3oy4omeelfcsl(fa2tr(r no4aeeoioeiydfm2rl( snt4altoiocto1omtr uvs;()sexrim3oodlmtnlnei sfarrmx  ;o1tpxn i3iltlsDemn snu0 rxoif iatla  anvo s0srxoio3oudlmee nesas arum(moot4apxo o3tadfa ul( p u4 etoxfcoadopD an i;( setoim iydlptelieils) rtru poo4apxnmietasfa ra( sn()arenmf3tytfp r ivilt0srxoxr iy4omt lncta(faDum(mont4tlx iociysfa eau snu0tetrif ta1lpDelu o s)t2xmxr3oodlmt mnviat  Duaum ;u1alenii3iyslaDuauvo ()treoirctatlmtrlivi;s0t2xo(r3oudoltemicta( a2ua( o;u4apeo ociysfmDean o () lxnxr3iytoate nvsl( texmxo3nu4ll   fctas sDraxrooo4tpxnii3tysfm ulnmo u4tlxrmocia1lptr neolt0 eurxm oo4lm elnei t)srtrx p;u1opeomfciysfs2rauvo t4 rtomoctytoatrlivilt  ruo(o3iudaleemivt ( arrm(mpnt1oeenif3iytfa rlnmp u4treoiocoytopteaiesl( tetoxm nodlpt lfeilt)sDuaxmpou1alxnmi3iadlaDuln o;() rxrio iatoaDeaues;t0s2toxo3no1olenlnct tf Drm(mpnu1opx io3ias mDumnvont0aetrio oatlp rlu i;(0 2uoimpnydom   fcsatfaDrrxmpot0tpxnii3tyt m um(vs u4 ltnxo oo1faD  i s;t)s2toxo3nydlm nlnesl(f Dur(  ;o4ape  f3tydfaDrmnvo;u)tetnmr3to1fat  ieo;t)srto(rpnodom nmnvt tfsrurumono1aleo i3ilt mDrlnms t4artnircoadlmD ln s t  rum(o3ou1ap e net t)a2rmxm oo4olxomietldfm2umnmo (0 rtrmf3oydfmDe i o s setrxrpiudlptelietas a2tmur ;o4oetniieiltfs2uauvo;t4tltnmr tytlat  ueo (0setmir ny4olt lnciat)srtrxr ;o1tlenmfeiaslsDumu s;u0aetomfcoadfpt  nes;s tetmirpny1lpt mfviasfs2tax o;u4olxn feiys a2um(monu) exnifcta1lm ean i;t0s2tmxm3oo4ll n ncs ( srtm(  oo0aexomoctlt a2uauvon() rtomocia1om   n s t  2xoxm3oydopt mieilt  Dur(rp;o4aeeniieiytfa rlnmpnu0artrxf3oy1la  aues t0 euoio3ny1alt mnvsas)s2urx o;u0alenmo3tytfm rlnmo u0tltnif ta1omt ln s s0s2uoxm3oy4aptnlncta(faDtaur ot1aee ioctldlm rm( o u)trtrmrcoatfpDeai i;(0tetmim oo4amtnmfci sfa2rmxr ot0aptn oetyt m2rm(vs;(0 exomf3oatfm e ueilt seto(opoodomt  fvil(fa2rmxmo;u1aet ioeiat m2rln s t)teermo tydfm   neo ()t2uoiopio1llt  ies s a2taumpoo0oexn ocild m2rm( p;u0altoir3io1opte i i;s s2tr(mpnudlleelies t) Dtax p;o0aetoii3tld m2rmu p;u)tlxoir tydlaDraieil()t2toxr nydalen fvtas)a2rauront1alxn iciaslsDeanmo;(4 exnif oodoaDe uvi;t t2umimpoo4op e fvtatfaDtmur ot4opx moctatlmDra(vp;t0arxnxr totlmte ues s  2xrir iu1lptnliesat  2uau  ou1aetoiieilt s2el(msnu4tlxomr3tytlpDranvi s  rtmir3nydom emivi ()s2um(mono1apeo fetlsla ua( p u0tlxoir3tydomte ueslt0 exm(o io1omtnmnvtas srtrurpou1altniictaslm2ran on()aexoxrciotfp  lues;s0teurim nydol n icil()aDuau oou1texniiciadfs uau o (4trtoxr3tadfpt anvilt)trto(m3ou4lltemnetas) rrmurpou1alt ii3iytfaDelu snu4 rtrxo io1omD ln s;s  ruoxmpiu4altelfeia( s2umxmpou4tee mfciyslaDrlnmo;t4tetoxociadfat anei t  2xmim ou4ll   fctat)s2rmumpno0olxo f3tlslm2rmuvs;(4tlenmf io1faDrauvi t0texrir3ny4opee netl(  Dum(m oo1tlenmo3tatfmDumumpnu0teeomfciatlmtean s (0seumim oo1oltn fct s)aDtrumooo1oeeoifciysfmDemn o () eeomoctotfpt anei t)tetm(r3oy4lptnmfesa( a2rm( pot1tlto oeildfa uln pnt0areomrctodoaD  i i;t)srurim ou1lpt mfcsl( arumxm ot1tptniiciatfa rln pn() eeniocoy1fm elnei t setr(mpnu4olen netltfsrrm(  ;t1oeeomo3iysfa2rauvs;() lxoir to1oate u s;() etoiopoy1lp n fctas) rumx onu0openmociysfmDum( o;u)arxomr iy1oaDeaivsls0 2tr(r3iydam  mictl( artaxr ;u0olxomociatfa uaumo;u4altrmf3io1omt an s;t  2xm(o iy1alte fvilt) Dra(mp;o0optnmfetat m2rm( p (0tlxrmf tadlpte nvolt)texrio3oo1optnmictl() Drmurono0tpxoifeiad m el(vsn(4tltnxfcia1fa   u ols)s2toxrpnu1alee ivsas  Dumxm ot0oleniictydfs umuvp (4 rxnircoatoatraies s) eum(m3ny4op  lieil()artmuroou1tetnmoctydlsDumnvo (4arxnir3iydoat lueslt srtrxm iy4lp  lfvtlt artrump;o1apxn ietyt a umn onu4trxnif3to1fpt aivs s0setmimpoudomt mnvil(f 2uax ooo0aetomfciytfa2ua(vp;t4alermocootom  li ols0 etoxo3oodlm  mnvtl() 2tr(rpnt1teen ieiltfm2uanms;u0 ltoxociodomDraneils  rtoir3io1lpt  neia(  Drr(rp;t4oee  o3iatfaDumuvont0 leriocootoaD lies;s0 2um(mpoo4al   icsl(fa2tmx poo0tpxoio3iadls2eanvo;u4aetrircoydop eai ols)s2trxo ny1lle liesas) 2uaxroou0opx iietat m rm(mo t4 leoioctatlaDe i i;t)seuo(opio4lle  nviat)srumxront4aee mo3ilslm2rmnmo t0texnio3oo1lpDran i t  2umxmpnydlmenmnet s s2um(rooo0apxomieiydfsDranvp ()arxrmr3iotlmtran sl(0 exr(o3ny4omt mnci tfartauro;t1oetomi3taslsDrm(ms t4tlerioctadlmDraivsls s2xmio ou1olenlfvil(f 2uru  nu4apxn iciadlaDeanmon(4tleniocoatomDe i i;(0setr(m3oo4apeemfctl()aDum(mo;t1aeeomi3tytla emnmo;u) rermo ty1omtraivi;t0t2uoxm no1alen fci (faDta(rp;o1oeenmfciltlm2em(vs (0areomf3ia1fa   nvo;( seurir nudolte fcta()srur( p;t0teenmi3tls m rm( p u)alxnmrciy1fpDelivi;s  rxrimpoy4opeemfcta()sDur(rpnt4apt ifeiydls emu s u) etrmo oo1oatr nvo;t0teuoio3nodlmenmfctasfsrrau  ot0tee mi3iltfs2eaums (4aetoxo3oo1oatrln o s srxrxrpny4altelfvtlt a2urxrpoo0tlxo feiytls2rlu pnt)alxomocoatfpDeau ilt  etmxm iydam e fci s)sDraxr ;t1aee  i3iltlm2ulu p t0tlenxf3to1lpDeaieols  exrxrpiu4lleemiesas) ruau oot0alxoiiciysfmDrl(vsn() lxnir iotopte u o t teur(r3iydoptnlnviat)s2tm(m ot4altoii3iytla raumonu0aetnir3iydopDr uvo;() 2tm(r3ou4altnlfvsls  rumurpoo4tpt io3iys s2rm(mo;(0tlxoxrcio1lpDr nvsl( srxoimpio4op emncia() rrmx ont0tlt  f3ildfm2rmuvpn(0 rxnxf oytopt liei ()s2umio3nudopen nvia(  rrr(r oo0tetniieildfa2ulumo;u4 ltomoctadomt lneils0teuo(rpno4oleemivsl( arrrxr ot4openifeiadls2ra(mp t4 exoxr tydopt  n olt tetmio3ou1alenmfctltfsrtrxront0apeniocils aDulnvonu4trenir totopDran slt) eum(o3ny4amee ietl(  Dumxmp;u4optn fciatls um(vp;u0 eermo3ta1faDr n ol(0s2to(o ou4op  mivsa( sDrmxr ;t1oeen oeiysfa ranvpn() reomociy1lm e ivs s) etmxr ny1amtemfvtasfa2tmu pou1tltnmf3tlt s emnvpn()alxoif3oy1opDraivo s)trxrxo3no1olt livsatfsrtmxrp;o4texn feiltfa umn sn(4trtrio3iy1lm   u s;t0trumxr io1om e nesl(fs2ra(  ;u0apx  icildlm2uauvo u0 etrxo3tytlate uvs;t0 2trxo3ou4lme licil(f Dra(  oo4apxomfciltlsDumnvo;t4aeermocoadlpD lueo ( s2urimpoudllt mfeiltf Drm(r ;u4apt mf3tlsfmDeaumsnt4artrmf oodoaD livi () ruo(o3iu1lpenlfctlsfarrmxmp;t4opeomictysfsDumuvpn(4 ltrir3ta1lptrlnei;(  2xm(m ny1lmtelieslsfartaxmo;o0opt mo3iad a2emn ont4trermocoo1lmtelu slt)srum(opoudop elfct t aDtmx pno0olt mo3iasfsDea( p;u0 eerxo3ta1faDrai ils0 etr(m3iu4opeemnetasfa2tmum nt4teeomicildfs eanvo;t)trtriocoodfaD  n o;(0 rtoxo3iydol e nesasfs2tau  ot4openifetad a2uauvs (0tlenxo iatom rln s;s0texr(mpno1am n nvsl(f 2trxrpoo0tpe mieildlm2emnmp;u) exrmocia1fp  an i;t)tetr(r iu4om   neiat)aDuau p;o0tle ifciad a2ra( onu0aexoxf todlpDelieslt)texrxrpny1lme mncs (f 2urx onu4tet mfctltfm2em(mpnu4aetomf oadlm eauei;t srxo(opou1lmee net sf 2umum oo1tlxniietltfm2uauvo;t4 rxnmoctatlateanei ( trtmim3oudaltelfvt s sDur(mooo4tex  i3ild mDean s u4tlxomo3oodfmteaneo ()t2tr(m iu1am n icslt) rrrxrpou4tptomoctys a em(ms;t0tlenmo oodfpD au sls t2uoim ou4llt  fet tfartrxrp;u4apxoifciys a eau o;u0 lxomr oa1fat  uvs;t0 rxrirpiy1aleelfvt tfa2tmxrpot1openifciysfm2rmnvp u0tlxoifcootfmD livils0sexo(o3iodap emfei ( aDtrx  ot1alen oeiasfs rmnmsn(0alxnxrciodopDrln sls) 2tmxo3io4al nmici t a2rr(mpoo0apeniociydfaDum(mpn(4 ltnxf3oa1oa eau ils)s2tm(m3ou4apenmfvt s  2urxrpno0tetn fcilsfmDrm(vo;u0texoifciy1opDraivs;( s2ur(r oydopt mncils)artmxm ;u0opeo oeildla rlumsnt)altniociytop e i o;t texo(r nu4omt lfetl(fa2ua(  ;u0tpt mfcilsfsDemnvsnt0aexnmr3tadlp e ivi t0seuo(rpnydome  icta( aDrmuroot1tpt  f3tadlsDua( snt0altnio3iatlpDe nes;( t2tmio3iu1lp nmivslsf Dur(ro;u4tee mfciysfs rlnms;u) ltrxr3ootla  aivo;t0 rurim iu4ameemneia( sDrmxro;o4tet mi3ild m ra(mo;(0 etnir iatoa e ieil() 2xrir ou1al  licia(  2rm(ro;o0tptnif3tysfm rl(mo;(4aexrmf todlaDrlu sls)setr(m3oo1lle liesa() Dra(r nt1tlxn ietydfa eau o;u0arxoio tatopte uvs;()texrxo3iydoleelnei t aDtrx pou4alx moctydfaDelnmp (0treoxrcoo1latelu il()trtm(m3oydomeelnvtatf 2trx ont4aex  f3iadlmDelnvp t) ltnmo to1faD  nvi;(0 rtr(o3ou4apte nct s sDur(r nt0altnifciatlsDra( o;u)tlxnifcootfa raieo;(0teuo(mpoo1lmenlies ()aDtrur nt0apen fcild sDrlu s;t0 etoxr totfa r ies t0t2tm(o3oy1lmtnmivtlt arumumoou4tpenifciyd aDulu p;t4 renxrciatfp eliei;(0 rxoim3oudom emivsl(f rtm(monu1oexoiictas m2elu o;(4aexnif3oa1lpt li i s  rtmxo nodomtemfet t)arrrx pnt0tpxn ietltlm2eln s;(4 etomrciodoa  aivi;s0trxrimpnodlpt lnvtl( srururpoo4apt  ictadfsDrm(ms t)tleomf3oy1latrluvol(0 eur(r3nu4lp   fei t)srtmxmonu4oet  o3tlslmDua( o;()tlxnxr iatoatran ols)setoir3iodll nmfvi ( aruru o;o0apxoiieiysfmDra(mo (4arxoxr3iotfm rli sls tetmirpnu1op n netl(fa2tr(rpno1olxniocildlmDrmnmpnu)trtomo tadfmteai o;(0s2umim3no1am emfvsls)srrau o;u1aptnmo3tatfsDem(msnt4trtoif3oydfmtrli slt seumir3ou1opeemncsa(  Dtrum ;u0tleoifcildlaDrl(ms (0tlxoircoatfm eaivi;t t2urimpoy1am   nvt s  Durxmo;t1tpt  fetad mDranvs;u0 lerxfcoydlm r iei () eumir3oo4am nlnvt s artau  nt4tpxo fciysfs rmu o u0 etrmocta1lp  an i;()t2tmxo nudlmee netasfsrurxrpot1tle  o3tld sDumu pn(4tetrio3iatlpte ivo;s s2uo(o3iodlltn nci (faDtrx ont0teenmiciydlm2em( snt) eeoxrctotla rai o s  ruoimpoo4am nlici ( a2rmxr ;u0alx  i3iatfm rlnvs;u0aexoio3ta1lp eaivo (0trxmim3io1op  mivs (fsrrr( pot0aet  ociyslaDuln o;u0tetrxr iotlmDrlueo t) exm(o io4lptnmfetl(  Dtmxm no4tptoif3tldlsDrmuvp;(4arxnxrcta1omtranvo;s trumxr no1ameelfvt (  ruaum nu1apxomoeiadfs eaumonu0 exomrcty1oatraueo;(0 rxo(o3nu1optnlfctlsf rtm(  nu4tltomiciad a2rmnvp (4trenmr3todfm eaues;t)s2xrxopiu1lltn iet ( arua(m ;u1tlx  f3tytfa uluvsn()trtoio3oa1fmtrln sls seuoxr no1om n fci tf ruru o;u0tee mfeiadlmDuanmo (0altoir3ia1fpDeaneolt0t2xoxopnu4amt mfcsat sDrr(rpoo4tpxnifciydlsDelumon(0 rxoio3iodlm  livol(0 rurio3oy1op  mfcsls)aDra(rpnt1oeen iciltls umn o t)tlenio tatfmt ln i;s  ruoim oydol elieils) rtrx o;t1opt ifetat a umnvp u4artrmrciodomD  uvi;()texoxr3iy1am  lfvtas  Duaxr ;u0aex  ociadls umuvo u)arerio tatomtrau slt truoxr3no1apt mncs t arurx  no4oee mfctlsla emu pnu0arxnmrcty1fmDr ieo;s0sexrxr oo4om nliei s) Dtax o;u4alxo oeilsfa2ra( pn(4 rerxf oy1omDe n ils setm(mpiu1op n ictlt) rraur oo4teto fctltfs ulnmp;t4 lermociadomteauvs;t) rxoxopiydome  fctl( arumu poo1altomociasfsDuluvsn(4trtoirctytoptran o;s trxmimpio4aleelfvt ( aDtrx ono0olx mo3tltfaDua( o u0 rtrmf3iydoatrlivs;( sexmxm3ou4lpee nvi s)artrurp;t0olt  o3iatlmDumnvs;t4trtomo3oytlptranvol(  2tmimpno1optn ivsls s2tm(  nt4oetoif3ilslm2umu s (4 lerxocoo1omte ueils srtmimpio4opte ivsas)sDrr(m ot1aexn ocildfaDean p (0 reriocoydlpDrlivs;t) etoxm3iy1om  miesat)s2ra( pnu4tpt  o3ilt a el( o (4tltnxf ootfpDe ies;(  rxrxo3nydop elnet ()aDumxm no0tptnmfctytls2elnmon(4aeermo3iytfaDelnvs;t)trtrxr io4apt lneta()s2trurpno0tet mociatfa raump;t0aexrmr3oadlpt au i;( seuoxm3iudlleelnetlt) Dtru  no4aeeomocias a2uluvon()arxrmo3oadfmt livo s s2xoxrpou4lle mfctasf rua( p;u4tlen ictyd aDrlnvo t) ltomf tydlp rai ol( sexoio3oo1om emfetasf Drmurpno0opt  iciltfsDemumsnu0arxnif ta1oa e n slt0srurio3oy4opt lnvsltf Dua( ono0openmociadfm2rmnvs;t0 ltrxrcoytlaD aivs (0 exrxrpoo4ll  mivslt a2ua(mp;t4texn feias m2eanmo u0areoio3to1fp  livi;t) rto(m3ou1ap nlieias  2uaur ;o4teenifetld m rmump t4tleoifcto1fat anvs;t truo(m nydop e icilt)sDta(m oo4tlt mf3tatfaDuauvon() lxoio3iotlaD luvs ()texo(o oudomtemfci sfsruaurpnt0alxnmi3iltlm2rm( o;t4areoif3iodlat  neilt) rxmimpio4ll  mnvt tfs2uax oou1texomo3ildls rmump;u)texoif iytom  anvol( truoxopno4lm   fvslt sruau onu4tptniociat s ran snu4 rtomo totlmDrai o;t0 exrxr iodope mfci sfa2taumonu1aetoiociydfaDrauvpnu4aleomo3iy1fpD lnvilt0srtr(o oy1lmtelici s) 2urx pno0aexomictaslm2rmnmo t0alxoxo3ta1omteln i s0trxo(opnu1lm  lfcia( sDua( pnt4texnifciysls2ra(mp ()trxoxf tydopte uvi t0 2ur(m oydlm nlivias) Drrx  nu0tle  ietasfa umn pn(0 eeoifcoa1lp r ieo;t s2xoim3iu1lmtnmivt t)sDtmx pou4teeomoeiytfa rl(vs;u0trxrir3iotlat  uvi ()setrxr3iydaleemfct s  rtrur ;o4oeeomfeils a2um( sn() ltoio3io1lpDe ies;( seuo(r oy1omt mivia( artru  nt1opx iieias mDrauvs (0texnxr iy1omt aies;t s2trirpoy4ope  fesa()sDtr(mpno1aptoio3iydfaDrmnvo;u4 rxomr oa1omDranvo t teumxopoy1oltn nvtatfarrm(rooo4teeomicildlmDrmu p t4aetomo io1oatrlivi;t setoimpnu1openlicsltfa2uaxmpnu0aptnmfciadfmDelu p u)aexrmrcio1lpDr n i s0t2xoim oo1opeelnet sfartaum ot0tptnmi3tasfsDuauvsn(0 etoir iatopD  ies t)trxo(m3iodopenmfes sfsrrax  ;o4tex  i3ildfmDra(ms;(0 lxnmf totfpDraues ( trxr(opio4lp e ncilt srta( o;t4aetn fetltfs ea(vsn(4aexnir3iytomtraieils t2umxrpoodaptnmieilt)a2tm(r ;o4tlt mociadlsDum(vs;u4altrirctadlpt  ivi s0tetmxo3oo4ap n nvs tf 2uaxro;t4tlx mfcild s eln o u4tlenxf3oydoa eaueilt t2to(o3iydomt mneil(  Dtmx oot4aetoiietys sDumnvon(0 rermo ootlp   neo;()trxrim3nodll nlfvsasfaDtrxrpoo1tptnifciasla2uauvsnu0texrmr oytlmDeaivo t s2toxm iy4ll nmncsl()a2urx oou4oetoioeiltlmDrmuvs ()aexoxr3tatopDrli sl() ruo(r oy1apenmfvi t)s2taxr ou4texoifetaslmDrau p u4tlxomf3oodfm rauvsls srurim io4apeelfeiltfsrurx pou4alxoifetltfm2rln p;u0 etrmo tytlmtr n s;s0sexrir3nydll   feiat)sDrmx oot4tet ii3iadfm eln pn()alxnmrcto1om eanvi (  etoio iy1op   fciat)sDraxront0tpxnioetls a rm(ms ()tetrif3iotop r u ol()t2umxo no4llenlici s s2umxrpot1tex ifetat m rlnmpn(0 rxoxo iy1fpDelu o;s sexo(mpou1optnlieslsfsrraurp;u0oltoif3iydlmDrl(vp u0 ltnif oodopt an ilt) rurxr nu1lpt lnetlsfsruau poo1optoii3iyslm2ra(ms;(0aexnxf3oo1fm  ln olt0seurxo nydaptnlfctat a2rrum nu1aetn i3ildfm rlums;t4artnmfcta1oaDr u i;()srtmirpiy4lmtemfct tfsDtax ono4tetnii3iysla umu s u0tlxrio3oo1fmte n i;s0s2trxm3oo4ap nlfvsa()s2tmu pou1tlxnif3iadfs emuvs u0arxnxfciotopDr u i;()s2trio no1omenmnet s)a2uaur ou0oexniiciad m ulumo () reoirciatfateaieils0tetrxr3ny1lltelnviat) 2taxrp;t4olxoifctytlmDrauvonu) rxrio iytomt auvs t texo(mpoydlp e fesls artau oou1tpxn ocilt s elu on(4tetoif3oytoateai il() euo(opiy4apt  nei t)srrmx oou0tpt mo3tad aDeanvo;(4artomrcto1lpDeluvo;s) etm(rpiy4lmeelfvt t)sDtr(ront4aexnmi3tasla ulump;u4aetoxf tydlat  nes ( t2xrxmpnudomen iet s a2taur ;u1apen f3iadlaDemnmsnt)tltoxr3oatoa r nvil( srxrim3nudlltn fvils)sDtmxrpot4tetnioeiatls2eanvsnu)tlenmf iy1laDeau slt) ruo(r iy1opee nct s)artmx  nt1teeniociat aDuln on(4trtoifciotom rai o (0seurxmpoy4am e ies s  rtrumo;u4oexo i3ilslmDumnms;u) lerio oytfmDeaieilt0 2tmxm oodaptemicia(  rrrx oou4open o3iysfaDum( o t)aleomo3ta1latr nesl() rurim3no4om  mici s) 2rm( o;u4apeo f3ildlsDrauvont0arermo3oy1fp   ivi (  exmxm oo4lpeemfeta()aDtm(r ;o1oee ifcilt mDrmuvo u0trxrir3oy1omt ai i s0 exm(m3iodlm elnesas aDum(mpnu1tpxoiictyt m elumon() ltoxoctotla r ivo s) etm(rpiodaltnlics t)arrau pou4altnmicildlm2emu pnu)treoxocoatfa rlu slt trum(m io1aptemivtl()aDumumpnu4tpto fctatls2umums;u)arxrmr iydoat li ilt  rtmxrpou1ap  liet tfaruaxr no4tptoifeild mDrluvpn(0 ltomo iytomDelu ilt0trxmxo3iodlp e ies t aruaum no1oexn oeiyt a raumon() rxoxf iodlpDr n o s0 etoxo3iu4ap   icsat  Dtmxrpnt0texnmi3iaslmDra( p t0 ltoir3to1fp r ivs ( srxo(mpio1oleemnetlt aDurxrono4tex mfeiyd s2uan pnu)aetrioctodomD lnvi (0srxoxm nudlmeemicsltfa2rmurpnu0oee  oeils a rlumpnu4tlenif oytfp r n o;()seumimpoudopee ncsltfs2rrump;o1tlen feiydlaDrmumpn(0 
\ No newline at end of file
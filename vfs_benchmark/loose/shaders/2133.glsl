@@ -0,0 +1 @@
+ivo;s) eurim3io4amee netat)arrmx p;u1alt mieiadlsDuanmo;()aexoxr totoaD lnei;s) ruo(r oo4ol emfesls aDrm( poo4tlxo ociatlm uln o;u)tlenir3oo1op eanvo (0 2toxo ny1lltn fvtlsf 2tr( ooo1olto i3iatfm2uan snu)tltomr3oy1latr u o;s  rxoxr nu4lptnmncs s artm(ro;t1tetoiiciysla2rlu s;()aeeriocia1fa ranvi t) 2tr(r3oudomenlivsls s2trur ;t4tlt mociad aDeaumo;u0aeermrcoodoa eau s t  etrxo ou4ale mnctl(  2um( pnt0texnii3ildfmDumnmo () reoio3totoptr ivs;s) ruo(o3oodap elncias s2tr(  nu0texnmoeiyt mDulumsnt4 etomf tydopte u ils srtr(o ou1ll nmivi ()sDraumooo0aexn o3ilt a uan s;t)treoio oa1fatr uvi t)s2xr(r oy4alt  ictltfa2um(mpou4teeo o3iadfa2ranmpnu4trtnxr3iotfm r u i s)t2ur(r ou4lltnmivtlsfa2taurpou0olxomfetatfa um(vp t)aexoiocio1lp eln s;s0 rxrxm iydap nmfvi t)s2uru  ;o0opx ifciatlmDrlu p;t0aexoxf3iotoatrlu slt  exoirpio4ll n ics (f 2trurooo4tle mieildfs eln o t0 eerxocoytfm  ai i t0srtr(r3nydap nmnes ( aDrm(mp;t4tetoiociadfaDelnvp t) lenmrctotlm e nvils0srxrim ny4ap  mici t arua( o;u1opxoio3iadfaDrluvp (4aexnif oa1fa rlues (0 etrim nu1oltn fvtls sDrm(mpno1oexo fetydls ran s (0 etoxf tadfmD luvo;(  exmir iy1amtelfetat)sDtrxmono1aleomo3iatfs ulnvp;(4 renio3totlm   u sl()setm(r3io1ol  lncilt)srta(ro;o0tpeo f3tydfs el(msnt)tetnxr tytopDeaues ( setmxopio4lm nlicta()srrru pnt1aee  ietytfa2uanvp;(4 etomo3tydlat  uvo t s2xr(o3oo4ol  mnctls arum(mono0tee mfetydls umn s;(0trtrxo3oa1fmte uei;s)trxmir iy1llen ieiasfsruau p;t1opt mo3iydfaDuanvs u) eeoirctatfate uvolt  2tmxr3io1alen nviat)srtaumoou4texnioeiysla rln onu4tlxomocootop eaueslt0 rxmxr3ny1ol nliesatf rtm(moot1texn oeiad a el(ms;(0arerxfcto1om ranvo t) rumio3no1apee net tfsrta(m nu0apto feiasfmDrluvs (4artrxocoydoaDrlues;s) 2urxr oudoleelieilt) rrm(m nu4oleo i3iad aDuanmp;u)arenxf3ootop elneo ()srxoir3nu1llt mivtlt)s2urx onu4olx  i3ild s2ra( o;u0aexnir3oytlmDranes;s)teumim3oy4lle  ncilt)srtmuroou4texoioeiys s eanmp u0aeeoir3oo1la   neols)t2xmxm iodol  mncsl()arrmxrpoo0oleo o3ild s rlnms t0texomr oo1faDeaivi t0 2xrim iy1ap emncil()s2rmurpoo4apxnio3iadls ra( pn() lerxf oydfp eauvsls0 2xmir3oy1al  livt s  rur(moou1aexn f3iad sDum(vs;t0tetnir3oatom  au sls)tetrir iydom elfetat)sDraurpot4texo ietyd a2rmumo t4 rxnircoa1fm  aivi;( setrxr ou4lpe mietltf 2rr(m ;o4alx mf3iydfs rmnmonu4 leomo3oytlaD  nvol( seuo(opny1am   nvi ( arra(monu4teeo ociydlsDuln snt0artrif oodla eluvs;(  exrim3nodoptelneilt) Dtaxm ;t0opto oeildls2ulnvont0 lxnxrctydfa elivilt) rxm(r oy1lmee netas arta( pno4olt ioeilsfa elnvon(0tltrxf3ty1fm raiei t0teto(mpou1ol e ivsa( a2trx  ;o1opeoiocildfmDemnvp t4artnio3oy1fp r u ol( seuriopou1lpte fvt tfaDuaump;u0tpxomocilsfaDul(vonu4aeeoxf ia1la rlnvslt0s2trxm3iudome mncs (faDurx  ;t0tetoio3iadlsDeaums u4altnir oatfpDranvo;(0t2uoir3nudome mics tf rrru pnt4alt  iciasfmDra( pn(4 rtnmf3oytfmDeluvo s0 eum(m3io4lltemneslt)sDtrxr nu0optoifetatfmDuln s t4trxnmf3ootfm e ieo;( s2tmiopny4lmenlncsl()arrrxm no0aexo f3iad s ranvpn(0 rxrif oadfa rli ols  exoim3ou4lmenlfet t)s2trxrpnt0apeoiocild s2umu s t)aexoxf to1faDraneo t  rtm(o3oo1lmtnmfesls)a2ra(ro;t0apxn o3iysfsDua(mo (4texnxocto1faD lnvs t)trtoio nudom n fctls)sDrmumpou1olt ifetlslsDumnvo;t) exnxo iydopDrau slt  rxoio oo1olte ics sf 2ta(ront1alxnifetltfa rmu p ()alxnxo oy1fatelivo;( texmim ny1alee neslt arrrx p;t1tptnifciad s2rl(mp;t) etnioctydfaDranesls0setoir3iy1apt mfvta(fsDra(mo;o4olxn f3iasfa2uluvpnu0aetnio iytfpDr u s (0srxoim3iu4lpe mncsa( s2rrxro;t0tpt  fetysfs ulnvsn(4artnxrcoodfpDrai i;t  2xr(opiu1amte nvi t  2trum no0olxn octytfs rlnvsnt)alxniociadlatrli olt) ruoir3nu4apeelivias  2tmumpoo4oex moeiadlm2umumpnt0 ltomrctotlpD  neolt0 ruo(r3ny4op elfctl()aDrrxm nu0oeen iciydla2ua(vs;(4aeerxo3oydoa ean sls0srxrxo nodlpee fvilsfsrtrxrooo1oeeo f3iydlmDumnmon()areriociytlaD aieols  2uo(r3ou4om n ieslt aDrrx pnt4olx  o3tyd sDrmuvsnu) rerio oodlmtrluvil()srxrxo3ou4ole  feilt srrrur ;u4tetn fciysfs2elnvp (4 ltoio3tydlaD  uvsls  2tmio3nodlmtn ncslt) ruax o;t1tlen fciasfsDrlu pnt4tltnmo ia1fp  aneol()teurxm3nodoptnmivt t sDraum ;u1tlx mictys s2rlums;u4 reoxo3todfmt  ivs;s0tetoio iudom n fvias) Durumooo1tleoii3iydls elu p;(0arerxf3iytomteanvo;s  exr(rpiudol nlivsas s2uax  no0oee iieilt sDemumo;()aetrio iytop  lu sl(0 eurxm nu4lm elncia() rrr(mp;u0olx moetaslmDuanmo;u4aeerxrciotfate neo;(0s2xrxrpio1op e ivt tfsDtaumpoo0aex if3iydla2uaumpn(0trtrxf3ia1op  li ols texo(o3nodomtelnciltf rtm(mpno0olxnioeils a ra(vp;t)aetnmocto1fa  lu ilt s2um(rpiodlpt lict s)aDtmxroou0oexo ieiyd aDuluvs (0areoxf3oatlaD auvil()sexoxm iu1open icsas artaumo;t4opx mf3tydfa2umuvon(4 rtrxo oa1opD auvols) exo(opiy1openlfei sfa2rr(rooo0aexn oeiyd sDelnmo;(4alxrxfciodlmDelueo s0 etrir3nudameelietatf Durump;o0oee iicilsla rmu p u0 renxo3ta1lmt  ues ( srxoir iodalt  fes s)srrm( p;o0oleomi3iyt a rauvs;(4 renmr tatlpDeli i s t2ur(r3oo1llen ivta(fsDrrx poo4texomietlsfaDem(vo;t4 lxoiocoa1oaD aueo s0 2xoxmpou4amtn fvt ( arua( oou4tpxniictls s2um( o t4tlxrifcootfm rlnvol(0 rurim no1amee ncs tfa2tmxr nu0tlxoifctys a em(mpnt4areoir3iytom e ieolt  rtrir oy1llenlncs ()arurxmooo0aptomo3iatfsDuanms (4aetrmfctodlpDrlu o (0trxoxr3nodoltn net s)s2umx o;o4tlxoiieiyslm2uluvsn()trtnmr ia1opD  u o ( truoxm3ou4ale  ivs s) rra(mo;u0tpxniiciytfm2rln o t)altnmr oa1oaD au o;(0s2uriopiydop   iet ( arumuronu1aetnif3iltls2elu ont) rtrmrcio1oat livs t0 exrimpiodamtelfvi sfsDrru pno0tlt  icias m2uln s () lxniocoadoatrau i;(0s2umxrpiu1apeelfctasfs2rm(mp;t1alx mieiys a2ua(vo;(4tetnxr totfptranvo;t)srxm(rpiu4ape licta(fa2uax pnu0tpeo fctldfs uan s;(0alxoxocoytfateau sl(0trtmxopoy4lp n net t arum(moou0alxo i3iadlmDrln s t0teeomociytom rlueols0setoxr oo4amen nctlt a2tmxro;o0opxnmiciytls eau o (0teermr oadlmte i o (0tetmirpno1lmte ivtat  rtaxm nu1tpenmo3iat s rau o t0trtoxf3tydfatean o;( texr(r nydal  livs t a2um(m ;t4tetn o3tytfs uauvs;u)trxrmf totoa  aies;s s2to(rpoudaltnmfvsasfs2ra(r ot0alxnmo3iys s2uan sn(0tleriocootopteaieolt trxmiopiu4aptn ncs s sDtmxmooo1tpenmfctydlsDrm( o () rxnmociodfmDr uvolt) 2urxm3no1ape  fvtlt  2tmxr oo0alxn f3tas s uanvon()tleomr3iatlmt ai o ()t2umxo ny4ap nlici s srtmu ont0olx mo3tat mDuanmp t4arxrxrcia1fpte ies ( trxoxm oo1llenmict ( arrax oot1tle mieiaslsDeanms u0tetrmocia1lmD lueo s0 rum(m3nu1oltemnvs () rumxm ou4teto fetydls2umnmon()trxomo tatlp   n o;t) etoim3nu1llt lnesl(fs2tmx  ;u4aeenmociytla rm( pnu4 reomo iydomtr i i;s tetrxr3oodlpte fvtls arrau oou0tlen i3iyd s rln o;t4texoxociydla rauvs t0 2xm(m oy4open fetl() rtm(rpou1alt mi3iadfmDem(vs t4aexomoctodlp ranvi s)s2to(r3iydopeelfvslt)s2ururpou4ape iociys a2umu o;(4 ltomf iytoatr nvo t)texoir iu4op e ncsl( a2rmxroou4aeen f3tadfaDrl( pnt0 rtrmo3tadfm elnvols s2xo(o nu1olt  ncsl(fa2ua( p;u4apx if3iys a2um( p;t4 lxrmo iatfateanvs;s)s2to(m ny1oltnmnvtls)arrmxr oo0apt iictyt s2umuvs;t0tlxoiocootlaD aivo;s) rxrxm iydlmt  fes (  Dur( oot4aexoif3tadfsDrmu pnt0tetnmr3tatlaD livol(0 rumxrpoydolt livsl()sDtmxro;u4aexomfctldla2rmu on()alxriociodomt lnes;s)teto(o no4ll   iciltfsrrm( o;u0oee ii3ild s2uluvo;t0trerir3oa1opDraies;t0 exrxo oo1am e fctlsf 2ur( p;o4oee  f3ilt s2rl(vs u)teenxr3ta1opDr u sls0t2ur(rpiy1lm nmfci tfartr(roou0apt mf3tadlsDea(mo u)tlxrmf iotfmDr nes;t) rumxo ny1lm elicsatfs2umxroou0tlto f3tld a ranmp;t4tetrmf tydfp raneo;t t2umio3nu1olt  icsatfaDtrurp;o4ope mf3iytfs ua(ms;u0artrmr3totlpte ieo t)t2uoxr iydlmtemfci t)aruaurp;t4tlxoiiciaslm2elnmp;t4arxrxo3oo1lpDrlies;(0t2xrimpou4al elivt (  Dra(moou4oeenmiciatfsDulu s;u4 eenxo tadlp ean slt  rto(m3no4optemfet t)arraur ;o0teeo oeiyslsDrlu s;t4aexoxrciadfpD  u i (  2xoir nodoleelivt (f Dtruroou0texnmfeiysfa eluvpn() eerxf3oa1lmte ieo;s0 rtm(m io4ome mnvtls aDtau poo0opt ii3ias a2ra(vpnt0 rtnxf tadlatrlues ( sruoio nydapte nvtat sDtaumpou4opxoifctyd aDulump t)trxomf3iy1omDrlnvo;t)truoiopou4ll  mncta(fartm(mpou4apxoiiciysla2ra(vo t4texomocootfp e u sl(0tetrxopou4ll n feil(f Dtrxroot0alx  i3iat s el(mp t)tltnif ootlmt anvols) rxoio nudlmt mnciasf Durxr ou4oeeoio3tad a2eau s (0 reomf3oydlpDeaieolt setr(r3oudam  mfvsltfsDtmu o;o0altnmieiydfm ra(vsn(4 ltrifciodlmte i sls seumimpiudalee ivsas aDuaxm nu0aetnmieildlmDrm( sn(4 exnmrciy1lpDeaiei;(0trtmir nodamte nvt s aDrax pnt1alto icilsls2rlums u0trtoxr ta1omD  i ol()texmim3ou4optemiciat sDtrxr ;o0oex iociyd sDrln p;t0 exnmf3ia1oaDe ueo s)sexriopiy1om  mivtas a2umxrp;u1apxomiciydls2uauvo t0 ltnxrctatlaDrlnei;(0srumirpoy4optnmict sfartax poo0altnifetys m2el(vo;() exnir3ootfm eaieolt  euo(o3io4lm   nctls) rta(m ;o0opxoifcildfaDulu o t) eeomr oytfm r i slt  etr(rpio4openlivi t)aDtmumo;o0tptomf3iltfa um(mpn() rerxo3tydlatr u o t  2xmxopoy4lp nmnct t)s2trur no4oexo octys s rmnms (4tetomfcoytlp   ues;t0seuoxopoy1am e iesltfaDrau o;o0ope  fctaslm umu pn()trtnxf io1fatran ilt) 2trxo3iy4lmtnmfetatf rumxr nu0aet ioctas sDuauvpnu4trxomr oy1fmD  n s (0trxmio3oudolenlnctatf 2uru  nt0ape mi3ilslmDeaumsn(4alenif iatomDeanvi ( t2trio oo4oltnmnet t) rraxro;t1teeomf3tlsla rmnvo t)tlenmrcoatomDeau o s)trtr(o3iu1am  lfetat) Drau pnt0tlt mfctad a ranmsnt) lxomo to1oatrlivol(0sexm(r ny4am n ivi s)a2taurpoo1tet ifetyd mDul(vp;t0 exnmo tytfm  aivslt0sexrio3ou4om  mfvt () 2rrx  ;o1opxn icils s rl(vp;t0tlerif to1lpDeli o s0 2xmio iudale  icsl(  2taur ;u1opxniicildfsDuauvp;u) lenmf to1lm eaivo;s0 eurio3oudlle mfetl()s2raump;t1olto oeiaslaDulnvpnt0 lxoifcoa1omt anvi t0tetr(r3oydaptemietl( srtmumooo1tet  feilsfm rl( pnt0trxrmr3tytoa r u ils0srtoim oudolt mnvt sf 2ur(rono1ale iieiatla ra( s u4 rtnxrcoy1la eanvs s  2tmim iodllt mfct t  rrmuroou1tee mietatlaDrmn p t4texnmr tadoateauvol() ruoxm3oydom elicsas)aDuru pot0tpenmf3iys m2um( sn(0trenmo oodfa e u i t  2trxr iydolt mfctls)srtruro;t1aeeniieiatla rl(mon()artriociotlm eluvols s2tr(o iodaleemiciasfaDtru ono4tetoiocilsfaDranvs;(4trtrir tydla  li s s srxo(r nu4ameelicsa( aDua(mooo1apt ii3iatfaDul(von() renio iodfp e u slt)srurxo3iu1altnlfctltf Dtmxr ou4oetnio3iatla rm(vp;t) lxnmf3tydfp  aivsls t2trimpnydlmee icsas) Drr( p;u0tlxomfeiyt m2umuvs;u4tltrxocto1fm eanvolt seurxr iu4amtn fvt ( sDrau ono1olx  fetyslaDul(vp;t0artrxfcia1fpDe nvilt)tetr(opnu4optemics sf 2ua(rp;u1tlx mfeiad sDrlumonu0aeenxr io1fatranei t0trtrir3oy4ame  iesltfa2raxrpnu1tpxomieiytfaDrmn o;u0tltnmf3tytfa r iei s0 rur(o3nudlptnlfvtat)aDtr(r no0alt mfciatfsDea( s t0aleoio3io1lmte uei ()s2uoxopoodlptnmnvs (f Durur ;u1alenmo3tasls2uluvs (0 reoxr oodoaDrauei s teumxm nydlltelfctat arrrxr nt4tet  oeiatfaDeln o;(0artnio3ty1la  livo;t sruo(o3oy1apenmnei tf Dum( p;u1aexnmoeildlm rmn pn(4 reomo3oodfp   i i s0 rto(m3no4amtnlfcils  ruax pou0tex  fctlsls2ra(mo;(4tlerir iotom e nes ( sexo(o3io1om   nvil()s2raxrpno1teeomfetytfaDem( snt4 etnir iytlmDr ivolt) 2urxopou1omt lnvil( aDrau pnu0aee mfciad m eau pn(0 etnir3tadlmDr uvs;s) rxmxr nudlmeelnvil( s2tau  oo4oleniocils m2ea(vs;(0treriocoydlptrau o t0tetrxm no4ap  lietat  2raxrp;t0olx ifctyd a2uauvpnu)aeerif oydlmD lueo t0 rtrim3nu4om e nvilt)sDtrump;u1oeeomi3tldlm rlu s (0texrxr tytoa  ln ol(0t2urxm3oydlltnmiet ( a2trumoot1tpxomf3ilt s elnvs;(0aexoir tydop e uvo (0teuoim iy4op emivs tfsrraumpnt0oeto fctydla2emn p (4aetnmr3iatfat  ues;t)s2trxr3io4omeelici t  2um(mpoo4aptoio3ildfa2ul( snt4trtnir to1omD auvi t0 rtm(mpny4lltelnci s)arraxmonu0oex iocias sDumnmp;u) lxrio to1lpDrluvils trtrir nodoleemnctl( arrrum nt4tltnifciytfm2emn p (4teenmo3iotomDr u s () euoio3iu4ale lfet (  Dtrxmpoo1oexo ieiasfa2umnvo t4arxrmrctydfmDrau i t) etm(opnu1lpt mivt ()sDtru oot0olxnmf3tld s raumsnt4 lxrxf3tydlat lneo t tetm(m3iy4ame mfvsltfsDtrxrp;o4aetnmfciltla2uln p;(4aexnio3oo1optelnvi (0 2xr(o3no1lpenmfet tf 2rmurpou0altnmfctyslmDum( s;t4texrmocto1oaD lieols) exmxmpiu4apt  nvtls)artmump;u1texomfcias a2umnvonu4 ltoio ia1opDraivs t srurim3ny1al e nctltfarum( pnt4olxo f3iatfmDulnvp t4teenxo3iytfaD ln ils0sexoir3ou1lp nlnes ( aDuau  ;o1aee ii3tyt s2ua(vsn(4alxnxrctytoaDelnvi;()teumxr oy4lm   fvias)sDumx pot4tlxomoetat mDua( s ()tlxrif3tadopDr uvi;(0sruoxm3iu4lle liet ()s2raxmooo1oetnmi3iatfa ea(mp (0 eenmrcoytfaD lieols0teurimpnudoltemivs sf 2tm(  nu4altoioeiasfm ea(ms u0tlenmrciydlp  livolt t2to(opiudom elivtls  2ra(rooo0apto icildfaDemn o u4 lxrir3iotlp   ueo s trtrxo3iu1ape  icilsf Dra(r ou0olx  f3tatla rm(vo;t)artoif ia1lmt liesl( tetmiopiu1lmtn fcs ()arum(mo;t1alxnmietadlmDrmuvs;t) exnmr3io1fpD aieol(0t2xo(m io4apenmictlt)sDra(r nu1oeeomo3tadls emnms () rxomr iydfp elnvo;(0 2xoio3ny4ll emnvi t srumuronu1texnmiciatfs ua( p;(4aleomrcoy1fatrlu il( srtriopiu4ope livs (f Dtmurpou1tlxomi3tadfa umnvo (0trxoxf3oatopDrauvi;( t2xr(m3oo1opt  fes (  rra(rp;t0apxnio3iadfs eaumonu0 eenxfcoydfpteln o;t) eumxopiy1olenmici (  Drau  ;o0aet mf3iltfaDul(monu)aetrmrciydlaD an ilt sexrxr3ny4oltelnvia( aDrax  no1aexn fcias a rln pnt0aeeoif3iadlmte u o s0srtmim3oydoptnliesat) rrrur no0apeoifcild aDrl(mpn()aeeoxf3to1lm  aivilt)seur(r iudap n neta()s2urxroou0tlen f3tltfs2um( ont0artrmocoadomDr ivolt trumimpno1alen ietltf 2rrur oo0teeoiieiytfs2ea(ms t4tltrmoctatop rluvi;() eur(m3oo4op e iesas s2rrurono1optomfeiydls elnmp;u4aeenmf oy1lmtrauvi;s  rurxopny1ame lfet t)s2umu  ot0tltomo3ias sDul( pn(0teenif ootopDrluvols0 etrxrpno1lptnmfvi ( artru  ot1tptomoeiat a umn p u4arerif tytlm rluvi t0sexr(o3ou1al  lnvsat aDtmurooo4aex  iciat a2rlumsn(0 ltoxrcty1fmDr nvs (  eurio ou1omeemiei (farra(rpnu4tlenif3tls s umnvp;(4trtnio3iadopDr ueo;t texoxmpio4ome  ieias) rur( pou0alt if3ild s rm(mp t0tltomo3oo1lpDranvs s sexmio oo4lm nmics s)sruauro;o4ole moeiltfs rlnvp u) lxnmocoatlmD aivi (0t2xm(mpiu1ame lfcias sDururont0alxnmi3tadla uan o (0 rermrciadlmD  ivsls s2umxrpou4op elivt sfartmxmoou0altnmociasfm eauvs;()tlxrmf iydfptrliei;(0 rumxr3no4ol   ivs s aDrm( onu0opeoiociadlmDem(mo;t4arxrir3oodlp e nvils)sexr(opio1ame lfei ( srtr(mp;u1tpen oeiys sDeanms t) etnxf oadlp e nvo (  2xmiopoydalenmictl()a2urxro;u1tleomi3ildlsDuln ont4 rtnxo3tatoat liesls0 rxr(o ou1lmtnlivtlt a2trxrpnu0oee  fciydfa2el(mo (4 exoxf3oatoat aivol(0s2xoir nydamte ies t sDtrumoot1tlto fetadfaDrlnmp (4altnxoctatoaD liei;() rum(o nydol nlictl( aDrax  oo4tlt  o3iyd a rmnvo t0teenxr iy1laDr ueol(  etm(mpiu4alenlfcs s srtr(m ou1tpeoiietyd a2rmu o u0 ltrif iotfptean sl(  rtm(o no4ale mivi t  2rmum nt4olxomfeils m rluvon(4alenmfcoatlp r i s ()srxmxopio4ap n ieils s2rr( ont4oee mf3ild mDean p;t4trtrxr3tadfp eaneo s0 rxrxmpny4amen fetlsf Dra(m nt0tleomfciat sDean o t0texnmo tydomDeau s;(0truoxm ny1aptemnes (fs2taxm no4olxomoetysfa2ranmo t)tlxrxr totopt  iei;t trxoxm3no1lp nlfvi t) Drm(m oo0tpeomieilslmDel(ms u)tltoxf3tydla  an i t0texmxr iy4amtn ivslt sDtr(mpnu4tlt moetlsfmDrl( p t0aeeomocoatfp  aneolt trtrim3nu4oltelnes tfa2tmu o;o4oltniiciad s2rmn pn(0arermf to1lm  ln slt  2uoxm3io1om e ietat)s2ra(m ;t4tetomo3iad aDrm( o t) etnxrcoa1fp   ivsls)tetmxr ou1ap   iesatf Dtru ono4oee mfeias s2ra(vo u4 lxomr3iytlm rlnvo s  rxoxm3io4am  lnvtlt  Draxm nt4tltn o3tydfs eauvpnu) ltnxfcoydlpD aues s0 2ur(mpio1altemiviat) 2rmx  ou1opeoio3ilsfa rm(msnt4tlermf io1oa r n ilt trumim3nodomenmfvsat  Dtrurpot0olxn ietad a ul(vo (4aleoxo iy1fmD  n s () rtr(m3ou1am  lnesat  2tmuronu1texnifctas sDrl( s;u)aeeomocoodoat  ieolt0 rto(r3iu1ll nmfvslt) rrm(rpoo1tlt ifcias s2em(mo;u)alxnir3iodfptelnvs t)s2to(m3ou1ap n fcs ()aDtrxr nu0tptomfeiadfm rlu on(0treomf todop ran ils0texoirpoo4op elfciat arrm(mo;t4olenmf3tydfm2ranvo t4 renir oatlp   nvil()setmxo3oodolt  iesl( s2uru pot0tleo o3iltfm ua(mo;u0arerxo3iodlmt livi s) etmxo3nydlpe licsls)sDururont0ope mfetytfsDumu s;t0aetnifctotla e iesl() rtmim iy4ll eliesl()s2urxm ou1opt  feiasfa2el(vo;u)texomr3oytfptelieolt s2xmiopno4am e fcsatf Dtrurp;u4ale  ociasfs eau p;(0 rermrcty1oatr n il(0t2um(r3no4lp nmfvsl()a2rrxmp;u0apeoii3tlsls rmnmont) renmf tatfatrlivil( srxr(o3iu1ol   nesl(f Dtm(mpnu1aleoif3ils mDrmu on(4 rtnmo totop r ivs s0 exmxo3no1lpt mnct t) rtrxm ;t0opxo ieias aDean p;u4 exnmocoodlmDeanvslt)t2to(o3nu4omeelnetl() rraum nu0tptniieilt aDrmuvs u0trerxfctodlaDean ils)tetmir3iy1omtn fcta(farurxmo;t0apt  o3tytls2rmumont0aexrxo to1fpDrli o;(0setrio3io1olte ics () Dumum nt1texoio3iatfa ean s (4aeenxf todomte i o ()teumxrpou4ope  ivs t a2raxmp;t1aeeomfcild s um( p;u4 ltnmfcoydlaDr ivi;t  euoxr3nydamee fcia( artr(rp;t4open iciydlm2eluvpnu)teerio3tydlpDr n o;s0t2urxrpiudoltnlncils) rtmumpou1aex mi3iyslm umumpnu) rxnmo3iotoptrlnvs;(0trtrxm iu4ll  mivtls) Durx  no0tlx  i3iat m2ua( p u4tetoir3oadopDrlieol( s2urio3io1om elnet () rrruroot1oleoii3ias s emu o u4trtrif oadfaD aivs;s)t2xo(opiy4lmtnmieia(f Dur(mpnu0oleoii3iyt s2em(vpn()tltrxo3oo1fmtrai slt  2uoxopoo4lp n fvs (fsDtmu oou0tlto iciadlmDel(vs;u0teeoifcoa1omD lnvil()texr(o iodop nmnciat s2tmxm ot0oltomfeildla uluvs;(4altoif iatfaDe i ils0t2trir ou1apeemnvs ()arurx ooo1tlx  fctys aDrmn o;u)aeerio3iytoa r nei;s texrxr3nu4lmeelncils)srurxrpou0opx  iciydfa eanvp (4tetomo3iatfat liei t t2xoim ny4aptn ncia()s2rmx p;o4tptoio3iaslaDumuvpnu)tltomo tadfaDrlueo;(0texr(mpoodlpenlfes t)arumumo;u1aeen fctls m2elumo;(0aetnmo3oydfaD lu ilt0srtrxm3oydamenmfctas  2ra(  nu4aet  fctyd a2ranmpnu)artoifcia1fpDeaues;(  2ur(r3no1lpe lncilt  Drmx  ;o0tltomfctyt s ra( s;t)altomf ootlaD  n s;s srtmxr3no4lmtelfvslsf rururpnt0tet ioeiyd m rluvsn(4altrxocoo1laDr uvs;t0s2tmimpno4aptelncsl(fs2tmxr ;u1ape  f3iadls elnvpn(0teenifcoo1oate nvs s)sruo(r ou1ameelncsa()sDtru  nu4aex  i3iaslmDrmnvs u) lerio3oydfpDr nvsls0 rxmxopou4ape lncsatfs2taxr oo1tle mi3tysla eauvo u)tltrxf3oa1lp e ieslt0s2umim oy4omen ncsa( aDtrump;t4oet mfeiasfm ulnmp t0aeerif3tatomtelnei s trxoirpiu1altelfvtlt)srurxroot4tpe  f3tlsfs2uau p u)texrmo iytlm  auvolt)s2tmxr3nudop e ivi (fartr( o;u0opeomietytla eau s;t) rxrxo iy1faDeaivo s0s2xmxrpnu4lm nlicsltf rur( pnt0ale mo3iydla rauvp t4texnxrcootla  ai o;t)texr(r3iydaptnlicsa( arurxr nu4aetoif3iat a um( s u)alxrxoctatlat li o;t t2urim ny4olenmneslsfs2trx ont0texomf3tadla uau s (0aexnmo ta1om  lneo;s)setoxm3no4lp nlnetasf 2tmxr ot1olenmoeilsfm2ranmp (4alxrmf oa1faDeanvs ()t2xmim iu4ol nlivslsfaDtmxrpnu4apt mieild s2uau s;(4arxoxr3iotfpDe i i;s0 euoir3oo1am   ici t s2taurpou0tlenmieiatfa2umnmo;()aeermo3to1lm rlu ilt srxmirpoudape  fesls s2tmxmo;o1texn iciydfs um(vp;(0arxrir tadfp eanvi ()t2to(opnu1ope lnvsat sDurxm nt1aeto ociytlm2rlnvon(0tetrifcty1opt livil()trxmimpny4ome  nei () Drmxr ;o4aex mietyd s ea(ms (4trtoxr3oy1fatean sls0trumir oo4omte nvsa()arrmumpno4tlxo fctat a2rl(msnt0tetrxo3iadomt  uvi ()srtmxr3nu4ap elncs s arumur ot0aetn feiltls2uan o;u4 lenirciatfateli il()sexoxr iudal emieiat) rrmxmooo1aexnifciadla emnvpnu)altoxr3oo1op eluvsls) 2um(r3oodamt mictl(  Duru poo0tleomieilt aDeauvp;() reomf oa1lat an i;t0 eumxo3ou1lpteliet tfa2um(rp;u1tet ii3iadlm rlnmsn(0alxrio3io1opDeln il(0truoir iodaltemfvias sDum(  ;t0alx iictytfs2ranmont0 ltrif3iy1opt lu o ( tetm(r nydlmte ncs s) Dum(  ;t4oex iictadfa2umums (0tlxrmf3iotomt anei s0setmirpoy4omenmivi ()arurumont0aexo icias m rl( p t)trtomr3iatfptranesls  rumiopnudoleemneia(  rrr(ro;t1aexnmi3ildfm2emnms;t4aeerif3todfpDeaneolt  ruoiopoydop  mfetl( sDuaxmono0tet  iciydls ulums u4 rtrxf iydoa eaivi;s0s2xmio3iu1lptnlfctat s2uaumooo0optniocildls2rmu p;u4artoio tytfm rln ils trto(rpiy1lm   icsatf Dumu o;o0tltnmoetld mDemnmsnt4aeerio oy1fat ai slt srxoxopoodlp e nvilt) 2umu ont4tltnmictytla2umu p u4 etrxf3tytoaD luesl(  etmir3nodolt  net (  Dumxro;o4tlxomfeiatfaDrmuvsnu0 renxr iadfp raivol()seumxrpnudomee ies (farraxr ;t4aex ifctytfmDrln pnu)alxrmoctytfpD livslt0texmir3ou1ap e ictas)s2umu poo4tpto ociydla elnmo;()arenif oatfaD ai o;t)t2xrir3nydalenmfvta() 2tr(mp;u1olxo oeiltfaDel(mon()tetrxo3oadlm e uei;t  rum(r ou4al emfesls)srumu  ;o4opt miciltlm em( p;()aetoir oa1fpD  u s t0trumxm3iu4lmtnmnct (fa2tau p;t0oeeo fciytfm uanvs (4aetomo tydopDeli ols) rur(m3iy1ome  neia()aDrmumpot4alx mfeiydfmDran s;(0tlxrxo3oytfptrai s;t0trtoirpny4ol n ieilt) Dtru oou0aexoif3iat a2eln ont4trxoir totop  luvs s)texm(mpoy4omtemneias aDuaxmpnu4oleomi3taslaDua( o;t0arenmo iodlp  lnvolt0 2xrxr3iy4ol  livsa(fs2tmu  ot4ale  f3tysfa ul( p;(0trenircoo1lm   ueolt0 etmir3iydal n fvs tfsruaxrp;u0altnifciysfs uln onu4trtrif iotfpDelivol() etm(mpoodomtnlfvtasfaDrm(mpnu1aeenif3tls a ul(mp;(4 leoxr ta1fp r u s;s)truo(o3iy4ale  icsat) 2rrxr ;o0altnmo3iadlm2rmuvo u0 ltnmr oytopDelivo ()sexrio3iu1aptn ncslsf Dta(roou1aex  octatfa em(mo;t4artrmf3iodfmD ln sls0 rxmxo3iy4oltnmncs ()aDtax  ;u0oleo iciys a2ranmo;t0areoiociadomDr n il()t2xo(rpnydome  fvi sfartaxm nu4oexnifciasls ulu snu)trenxf3totoat lieo;t0 rxoxr3iy1lp  lfvt t  2rauronu1tpt ifcilsfsDum(ms;()trxoir ia1lateauvs;(0trtm(r iu4lmee fvils)a2uau pou4tptnif3tydfa rmu o u)tlenxf3iadfmtraivs;s)sruoxopny4lmt  nvi () rta(mp;o0olx mfctldfa rlu on(4aetnxrcoa1omt livils0 2uoio3ny1lmen fvsltf rtrx p;o1ale if3iytla eln snu4arenir oatla eanei;t0sruo(o ou1am nmfesa()s2rrurooo1tlt  feiys a2emnvo u) lerxfcoo1fp eau s;t0s2tr(r3oy1lmt mivta(fs2truroou1olx  o3iasfaDeanmon(0 lenif iydlp rlieo t0teuo(m3iy4op nmnvs tfsrrrum ot0tlt ioctatfm eau s;u4 exoirciadlm elnvi;t) rur(r io1apeemfes ()a2rrxmpou1tpeo octlsla2elumpn(0 lxoxf3iadoaDrluvo t srtr(m iydaptnmfviatfs2uau  oo4tptnmoeiatlm2elu onu) exrif io1oa  anvs s) 2trxo3iodome mfcs ( s2rauront0tpxniiciad s uln o u) etrxr3oytfp eaneo;t) 2trxo3iy1olt  fetas)a2rrum ;o0oexnmociydla rlnvs;u)tlerxr iytfmte n ols)srtrxo3iudopenlfvtls arrm(m nt4aleoif3tldfm2ra(mo u4artomf totlaDrai o ()setrxr iy1olenmfeiat)arur(m ot1aeeomoeiasfa2elnvp t0 eeomo3iy1lm e ies s sexmxo3ou1al e ncs t  rrax pno4opt mfeiyslm ul(vo;(4 ltomfcoatfaDeluvi;t  eurxm iudole  nci (  Duaurpot1texn feiat mDrmump u0 exrio3totlm   ivi s0s2xr(m nodaleelivs t)s2urxro;u1aeen feiasfm2ranvo;u) lxnxr3oa1laDrln ilt)trxrio3ou4oltn nci sfarua(r nu1oexn feiatls2elnmsnt4arxnif3oy1om r n o;t  rtoir oo4oltn fetlsf 2ra(moou0tlxnioeiatfm eluvs;u4 etnxf oa1lat  uvols)srtoir oodapeemncsls srrr( pno0olxnmfctaslaDeau ont4texnir3oatom   nvi;s trtmxr3ou1amte netls)a2rauront1tpenmoctysfmDrmnvs;t)aeeomf3iodfm  lnvi;t srxmxr io4lleemivtat artrxm ou1opeomo3iyd mDuanvonu0treoxf tydlpD anvi ( teto(o oo1lltelfcslt  rtrxmpou1apeomieilsfaDeauvp;u0areomr3iy1fpD ln sls tetrxr3io4op n ivta( arrr(mo;u1tltomf3iytla rm(mo;u0 ltomocoy1opt aueols  eto(opoydoptelivs (fsDrmurooo0tleo fctad s2rln s;(4 ltoxociydoptrlneol() eurir3ny4ole mfciat sDrau p;t4oexo ictydla ua(vp;(0 etoxo ta1oat lnvil(0 2uoir iu4lm nlivi s)s2trx p;o0olto fetysfs2umumpnu0 eermf to1fmteauvs (0 2xmio3oy1lle mnct t arumu  nt4oleomieias m elumo;u4tlxnio3iotlm  anesls truo(rpio1olenlivtlsfsDtmx ont0apx  fcildlsDraump (0 etrirciy1lmD  n s t)sexrxr3nu1lm nlfeils arrm( oou0oltniiciydls um(mon(4 exomrciadfat anvs t0 2tm(m no4olenlietl(faDurum ou4oeen i3tytfa2uau snt4altnxf3iadlm eanvo;(0 rtoxmpnu4oltnlfcias arrmxm ou1alxn oetasls2ulums () exrmf3oadomtrauei;(  ruo(r ny1om n nvsl(f rtaxr ou0alen i3iaslmDumnvs t0 rxoif3tatlmDe uei s0 rtoimpiu4optemfes sf Dumurpno4tltoifeiytla emn ont4tetrmrcia1lmD aieils0t2urxr iodapeemfvi sf Drru  ou4teenioeiaslm2el(von(0alxrxrcoadomte nvs (0s2tmim iodlleelncilt aruaumont1apx ioctatfsDuan s;(4 lxoxr tatlp  aueol(0 2ur(r3ou4olee ietat  Drmu  nu4tleoioeiadfm2ul(msn(0trerif oa1opD livi t  exo(m iy1lmenlnvsls)s2raxrono1tlx ifciatfaDranms u)texoxocoy1fpDr neslt0trtrim iudapte fciltfs2tmx onu0tlen ociyslaDuau o (0altrir to1opt an ol()srxoxo no1op elicslt)sDur(r nu0oet ioeiydlaDeanvo;()trtnmf3iytla   u s;s  2umxo ny4ome  ieia( srtrx  nt4oeeo f3iydlm rlnvo t0artnxo ootlp elivs;t teuoirpiy4amt lnetlt)a2rrxr oo4oetnmieilsfs2ulu pn(0 ltrmocty1fmDelnvs t0srxoiopno1ameemnvt (f 2umxmpnu0teeomoetldla uluvs;u4 lxnxocoy1lptelues;t  etrio oydal nmncsatfsDumumpnt1olx mieiydfm2ulu p u4altnirciatoate u i t) eumxopio4olt mnvs s)sDtaxm nu4tlxomoeiltlsDelnvont0 lenir oytfa rluvo s0 rtr(r3ou4optn ncia(f 2um( p;u4oex  ociysls2emnmon(4tltrir3iy1laDr iei;()trxm(o nu1lmeelfvtlsf rurx p;o1teeoifcildfm2emu o;()trerif oo1fpt  neol()srtrim io1amt mivi tf Durx pno4ale iieiatls2ua(mp u0tlenif oatoat  ueslt0trtm(r3nydll n ictatfarum(root4tltnio3iad s ranmo;() etoif tadfp eai i s s2xrir 
\ No newline at end of file
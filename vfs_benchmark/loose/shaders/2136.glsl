@@ -0,0 +1 @@
+nei t0 2ur(m3iudole mnvtlt s2trxro;o1tet  ocilt s2ea(mo t0 rtoxo3ia1fmteli i s)s2umirpnu4lleemics t)srtr(rpoo1opt mo3tasls emumpnu4artnmfctatopDelivi;t0 2to(opno1amt mfviat  Drmxmo;u0tetomictlt s rln ont)alxoir iotomD lueo;s)s2urxrpiy4am  mfvtlsfaDuaumpoo0teen i3iysfmDrm(mp u)tlxoxf tydoa r n s t) 2uo(rpiydal   ivi t  2rmx o;o4oeenmictls s eanvo;u4 rtoxr3tatlm rlu ilt trumxrpiy1lmenmicslsf 2tmumont0ape  f3iatls2el(mpnu0 exrmr3iytfm elieil(0t2ur(r3nydol e ncil(  2raxmo;o4aleo oetyd aDumnvo;(4tltrxo3tydfm e neilt s2xr(m3ou4openlfvia()a2uaum nu1olx  i3tas mDean pnt4areriociy1omDelues t0 euoxmpny1ape mfet sfaDrrur ot0ale mieiytfs ulnvs (0 reomocta1om rlu s;s0t2xrxo oodale mfesls  2taumonu1tpxoif3tasfmDelumon() etnmf oodlp r ivi;()t2ur(r3ny4ol  lici s)s2urum ot0oeenii3iydfsDua(msnt4 lerxo ty1fmte ivo t) 2xm(mpou4ll emivsa(fs2tau oot1texnmf3iysfa umu o u0trtoiocoytopt lieils texmio oydamtelnvtl(  Dur( onu4tpeomiciadla2rm(mp (0 rtomrcoa1fmDe u i ( s2tmxm nodaptelncta() Drr(moot1aeen o3tyd s2ea(mo u0 rtoxr iatopD ai i s srtoxr iu1omen fvslt s2trxmpnt4tlenmiciyd m2umuvo u) rxnif3oytopD auei;()s2uo(opno1alenmnvs (f rtmu poo0oexniociytfsDulnvo u0 reoio oydfpDeluvi t texrxm3io1oltemivs () rtau o;t1tpx ifciydlsDeau o t)artnircoa1fmDeaiei s0seuoxopiodopt mnctl(  Dua(mpnu1alxo ietlt a2rlu p u4trxrio3oadfaDr u o;t  rxoiopiodomtnmivs ( aDtmxr ;t1olt mf3iadls2eau pnt4altoxf3oodlp rau s;() rto(m3nu4lme mfes s)sDuru p;o4optnifctatlm rl(mp;u4 exrxo3iydfm e iesls s2uoxrpoy4llte fviat)artrum nu4aex  ieilsfaDeanmp u4aeerio tatopDelneo;s0trtmxr3iydamtemfetasfs2raxm ;o0opeo fciltls2eau onu0alermr3totlmt au ils0s2xoim3nudap nmnei tfsrrax  ;o1olxnmf3tatfa2ea( pnt0teerxrcoydlp  an s;t) rxmxr nodlm emivs s)arrruront1opx miciysfs elnvo;u4 rerif3oodfaDrli o (0 etrio3oy1ap e nvt s)aDrau  ot0texomfeilt mDel(vs;t)tetrmo3tydfp eanes t trxrxr3iudapenmncil(fsDtmxro;t0alt  f3iasfm elu snu)altnio totlpDrlnvi;t  2toirpoo4ll elfvt s artr(mp;t0alxnifciltla rau s t0artrmfctodfm ean o s srtoir3ny4aleemnet s)sDrr(m nt1ale mf3tldlmDumump;t) rxnxr iytopDrlneo s0 rxr(r iy1om e ivi s sDur(m no1tlto iciad aDrmn snt0 ltoif iadla r ivils) rxoir iydllte fetls) Dumxr ou4tlxn o3iltfa elumo;u0artnxr iydlmDe ueo;() rumxr iu1aleemiesa(faDrru p;u4aetnmietls a eluvon(4aetnmrciodlatrli i;t0sexoxo nydam   fetlsfsDum( o;u1tlx ifeiysfaDranmon() eenmr iytoatean il(0t2tr(opoodlpe lnvta() Drru  no4aetomoetlsfs2uau p u0 rxoxo3tatla r ivils)t2xrxr nu4am nmnvt t  ruaxronu1tlx iictldlsDemnmo u)aetomf3oy1fptrau s;t0texrim oy4opt livt s sruaxmpnu1ape  icildlm2umump;t0areoif oy1fp rlieo t)trxmxrpnydap elfeia(fsDtaxmoot0olx iociat aDea(vo;()trtnmociytoatrau s s0s2xoio no4ll nmiet s)srrrxr nu1alenifetatfm2ea(mo;u)areomociadlatelnei (  2umir ny1ap elics tfa2umur no1texnifciytls umn p;(4tlenmo oatopD luvil() 2uoim nydolee ieil()srumu pou1optnif3ils m uaumpnu0alermo3ia1lmDeliesls) 2tmir oudalt mnvil()srtaxr oo4oexnmf3ildlmDua(vs;t)altrif3tatfmt lieilt)texoxo3iudlm  lfcsas a2rrumooo1aeeoiieiyslaDrluvp u4aleomrciy1fp   ueolt) exo(r nu4lp nmies ()srtmuroou4tle  ociat a2umu s;u4texrmfcoo1fmtr ivsls seur(mpiudolenmnctl(  2trx p;t4oltnmfeiatla2elnmon(4 exnio3oa1fmtelivol(0trtmxo nu4apenmici s)a2tmx oot1texomfctadlm2rlumsnt4 renxociodlpD an i;s)s2xrim3io4ol   iviltfaDraxmonu0oleo oetaslsDrluvs t4trtnmrciydfm r ies ( trtmim io1op e nesa() Dtaxr nt1aex mociltfaDrlnmp;t4 eenmrctatfpt  ueo (  2tm(o3ou4al n ivilsfs2rmur nt4aeenmicils sDulumo t0tetoxo3tydlaDean o (0teumxr io1lp e nct t  rurxm no4apeoifetysls2elnmpn() rxriocoatlm   u o t  rxmim nodam  micias) rum(m no0optomf3iydlmDra(mo;(0altrif oo1fp e nvo;(  etr(m nydap elfesasfa2ra(rpot1oleo f3ils m um( snu4trxoxf iadlmDr ues t sexmxm oodlmenlnetlt arrr(m nt4tlto iciltfa umn o;(4aexomr tydlpDe nes s) rum(o3ou4ol nmnci t)a2ur(m oo4aptn o3tltfm ranvp (4treoxr tadfa e ivslt)srtm(opou4amtemicsas sDrm(  nt1apx mi3ilslsDemn o;u4alxoioctodfp rlnei;()trtrxrpnodame  fvt t)aDta( pou4alxoifctlslmDuanmp;u)aexnio3iotoa rau i s  eurio ou1ale lfeiatfs2urx p;t1oexn icils a rln s;t4 rxoxfciatom e i o s)trto(opiy1optelfviltfaDrru  ;o0aeto ietld m2eau sn() rxnxrcootfm raies;t  rtrxopou4op emivt tf rtmxroou1opeomfctatla2ea(vp;t)tlxoxf iodla ranei;s)teur(mpnodop  lfct s a2tm(root1oexoif3tytfs raumo t4aexrmr oytfmD lnvo;t0trxriopou4lm emietltfsrtaxrp;u1oltn fciasfaDemnvonu4 etnio iy1lpt ai i t s2tmxo ou4openmivtatfs2tr(r nt4tltomoeilsfa2ul(ms (4 ltrxf oadlm ranvo;( tetrir oy1op  mfvsl(  rrm(mpoo4alenmf3ils sDumnmpnt) lerxfcootlmtraneils0 2tm(mpnu1lmeelicslsf 2rmxm nt0aee  f3iasfmDrlnvpnu0aleoirctodomD  ieo s  euoxopno1altelivsltfa2tmumpnt0apeoif3iatlm em(vo u0texomrctydlatelieo;t)teumiopiu4am   fet (fs2trxr ;u0apxn f3ildls2elnms (0aexrxr to1oa r n slt srxrirpiu4ap nmnvsat)sruru ooo1aeto f3iat s eanmp;u4aetoif3iotoatr ivol()teuo(r oo4al   ncs s)srumxmpot0ale io3ildfsDuanvp;u4trermocia1fa  anvi;(0s2umxo io4lle mfvils  Drmxroot1tet mo3iasla ul(vp () exrxf iadoaDeaieo () ruoimpou1lmtnlnctas  Drm( pnu4apxnmo3ild s2um(vs u4teermr3tydopD auvi s0 rtrir nu1omee ivtlt a2rmuro;o1tetnmoetysfsDeluvo (4 rxoirciy1fa r ivsls0texrxmpiu1ole mivils)artmxr ;u0aex mo3tydfs2el( s t0arxnmf tatfpD  i slt)teurxr iu1optn fesat aDua(  ;o1oee iieildfaDran pnt0aeenmo iytlatran o t teuoir ou4lm elicta(  2raxm ou1aee  feiysla2ranvp u0 ltrir3ty1fp e nvo;s)trxrimpoudlm emici sfsDurxrpno1alt  f3iydlsDuanvsnu)aeeoif tydomtrlnvi s)seuo(m io1apenlfetls)sDumxrp;u1ape miciadls2em(monu0arxrmf tatoa eln s;t seuoir3no1alt mncsltfa2tmumo;t1texoiociaslm rluvpn(4aeermo3iytlm elnvi;t texo(o nu4oleelncsat  2uaumpoo1tptoiiciat sDulumo;u) eeoxo3iotlpDranvols)srtmxo ou1ol nlicias a2urxm oo0oetnmo3iltlsDumnms u0 lenmfciodfmDeluvs s trtrxmpio1omeelnci ( aDra(root1aet moeiltls ua(ms u0trermfcoadomte n o;( s2tr(m3nu4omtn ictlsfsrrrump;u0tptomo3tas mDrluvon()tetomr3tatfmtr ies;s tetmxmpoo4lmtemiviat)a2rmx ooo4alxn oetadlaDrlu s (0 lenmf tatomD  i s;s s2ur(opiydapt  nvi (fs2ur(m ;t1tlxn fciaslm rl( snu4 eenio totom e ivs s)s2uo(m3iydalt mietl() rua(rpno4oee  fctyslmDrau pn(0tltoxf3oydfmD anes s tetrim3oudol elncsl(  2tmx ont1oetnmfcils aDrlu snu0 reomocto1fatraneilt0t2tm(r3nu4lpt liet t)sruax o;o1altnmieiadls2ra(vonu0tleoif3iatfaDeln ols0 rtrim3iu1apee ieslt s2tr( ooo4oet  iciadfs2emn onu4aexoxf tadomteau o t0 exoio io1am  lfvilsfaDra(  nt0olto i3ilsfmDrmnmo;u)areoifcia1fatr n s;s0sruoiopou1altn ict ( srraur nu1tpeoifeiydla rauvp t)alxrxo io1op   iei;s0srxm(rpno1lm nmfcils)sDrmxmo;t0opx  ictyt a2uluvs (4 rtrmr oytoaDrau o;t)teumim3iudom emncsls)arrmx  ou1alt ifctasla2ran o;()artnxoctadom r neol( t2ur(m oy4ll  mfvt s)a2tmxm ;u1optn oeiytfm2uanvp;t)teeoxociatlate n i t) 2to(r nu1aleelnciat) 2tmxrp;o4tlt iociadls2ua(vp t) rxnirciytomDr u ols)setoimpoo4ap e nvtas srum(mp;u1aeeoioetls s2ranvs t0 exomo3iotfpDe ieols0 exo(opiudopt mietl()aDumx  no4tee ifetasla elnmsn(4tleoxfciydfatrlieo;s)s2xmxo3oudap  mies (farua(mp;o1tlto fcilsfmDulnvont0arxomr tatfptrau i;t texrio iu1al n netat srrm( o;u0olto feilt aDean o;u4tltomrciytlpt  nvsl(  rtoxr oydame livi (  2rruro;u1aeenif3iasla um( ont4 rtnmf3oy1lm eli il()s2xrio ny4llee fctl(f Drm( o;o0altnmo3ildfmDuln snu0aetomo tytfptelu o;t0 ruoxm oy4am n fes t)aDtrx ont0tex  o3iaslm ulnms;(4tltoxf iadfpDeai o;s seur(r3no1lme mnvt (  2rru poo4tleomo3iatla2uanvpnt0tlxnio totlpt  ueslt)teuoxm oydamtelicias)sDrm(m nu0tlt mfeiyt sDum(vo;t4teeomf3tytlptrlueo s0s2to(m oudlpte fviat)a2rm(m ot0oetnifetlt aDelu o;t0 ltnir3iodfpDraueo s teto(r3iy1ole liciltfsDtrum ;t0alto ietatfa2uauvs (0arxomf oytfmDrliei;( seuoxopno1lleemivs tf rtmxr ;t0teenmf3tydfmDrlnmp (4 lxrmo3tatfatelivi (0 etrir3oydlm   ivilt arumxmpou4tet  i3iydfaDel(mont4aeeoircta1fm rluvi;t s2uo(opiudlpe mncslt artmx  no4tptoiociad aDumu s u4aetrio3tadfmD livi t0sexo(r3iydop nlfvtasf rrr( onu1tltnio3iyt sDum(vs t)trtrxocoo1lm r nvi t teuo(r iu1oleemfvils  2tr(mo;o1aetn oetadfsDua(ms;u4aeermo3oytfpDraueo ( t2umxmpnu4omeelfetltfaDta(ronu1tptnifcilt sDrlu p;()trxnxo3iotom r nvolt0trtr(rpoo4apt mnvtls) rta(ro;u0aexomo3iyd aDrm(ms u)tlerioctadfaDeanei;s setoxr3nu1apeelictatfsDrru ono1opxnmociydlaDra(vp u0trenxoctadfmDr i i t0 euoxr3nydol n iet s)s2taur nu1oexn oetydfaDeanms;t)altriocoydop e uvi;(  rtmio iy4omt  fvsl(f 2rru pnu0apeomictltfm eln p u) etoxf oadom eauvsl( s2xm(rpoy1amtnlfvsa( s2tmu pnu1tlxniiciatls ranvon()aetrif3oa1fmtrai s (0srxoxo nydap  lfeil(  2ra(r ;t1tptoioeilt s2emnvon()arxnxo3oydfpD lu i (0teuoxmpoudlp nlicsat) 2urur no4ole ii3iat s ra(mo;u0 lermr oodomDelues t)sexrxrpno4lpenliesl( aDuaur nu0openmfciad m ranvs ()teerxf3to1lat  uvi ( t2urxrpno4altn ivilsfaDtmx pou1oltnmfeiad aDrlu s;u) renxrcty1fm  lnesls  rxr(m oo4lm nlfet s aDuru  nt1teenio3ilt s ea(msnu)tlermf todom rlueo;s0t2xrir iy1om  liesas artmumpoo4ape mfcils a rmump;u4aetoir tatfaDrli i t  rum(o3nodom e ictlsf rta(rono1alt mfctldfmDrmnvs t) lxrmf oy1lp raueo t t2ur(r oo4aptelnvt t) Drmx  ;o4tet mf3iytlaDum(mo;()artrir3totlp  lues (0texrxr3iy4lm e nvia(fa2tmu ono1alxomi3iatlaDumu p (4trtoxf3iatop eln o;s0t2xrxo ny4lp emfeiasf rtmurp;o0optnmf3iasfmDrl( o;t)aetoxo3iotlp e i il(0srxmxo3no1lp e neiasf rumu  nt4oltnmf3iat sDuau o;u0arenxo3oadla eaues;()truoimpiudopee nvtltfs2taxm nu4tpxnmfcias mDem(mo t) etrxf3ia1om rauvo ()sexo(r3iy4amtemivil()s2tru p;t0tee  fciadfa uanms;u)arxrxfcto1lat ai i;(0t2tmir3io4am elnvia()a2uaxr ;u1oleomietlsfa2umnvs;t0alenmrciodla rli sl() 2to(mpiu4alte iviat)s2tax  ;t1opxoio3iysfsDulu on()tlxnio3ty1faD  nei t) rxrimpiodamtnlfctas)sDurxronu4alxo ociatfmDrau
\ No newline at end of file
@@ -0,0 +1 @@
+uvi t)trxmir nu4om e nes t  Dtru  nt1oexnmociytfsDemums ()artnio3oadfm rlueo;t sexoirpoo4ol   ivs t)a2tr(m oo1oeeomf3iltls2uln p;u)texrif iodlptr nvs;s)trxo(o3nu1ol elivsasf Drrum ot0tlx ifcild a uanmp;u)tlxrir3oa1op raues (0 rurxr3iu1ameelfeia() rurxmp;u0ape if3ildlm uluvo;u0tltrif3oo1oa elnvils0tetmim no1alen ncsl()a2ta(ro;u1oex moctydlaDelu s;t0aeenmo ta1omD ln sls  exrxm iy1lpenlietls)sDtaxmp;o0ole  ieiytla2ea(vs;t4alxnifcootfp rlnvols  etmio nudlle  ivsltf rumu p;o1tlxo ictatlaDul( o t4aexrircoatla  lneo;t0 rxo(mpio4om nmiesls)aDra(m ;t0aptnifctydlmDum(vp;(0alxrxr3tydlpDeln o;t srxm(rpoy4ap elies (fa2trxrp;t0alenmi3iat a emnvonu0trxrir todlpDr uvs t0tetmio nudol e nvsa()arum(  ot1tex mociydfmDra( p;u0aetrmrctotlm   n o;s) 2xr(rpoodlmenmici (fsrrrxmoot4tet  fciaslsDumnmp;t4aetrir3oadlm   nvo;s  exr(r ou4olee ici (fsDrrx pnu0tltnmfctld a2rmnms t4trenmrctytoaD  uvil(0seto(r3iu4omeelfes s) 2raump;t0aexo ieias a2uln p;u4artoxr3oadomteai i t) rto(r iu4omtemfci tfsrra( poo1teeoiiciatfa eau pnt4artnio3ia1lptranvi;()s2um(r3ny1ll nliviat a2tm(mp;o0tlxn i3iydfsDuluvs t4trxoio oytom eaues s0 rxo(rpio1ap nliet tf rur(m ;u4teenifctaslsDem(vo u0trxoxf to1oaD li o (0setoimpnu1olenmiet t  Dtaum oo0aeenioeiys sDuauvs (4tlerxr oytoat  uvslt t2toirpoo4opeemncta() Dumu o;t0texoioeiyd a2um(vs (0arxnxo3tadopteau i;( setm(r3ny4lm elicsl(fsDrrx  nt0aexn feilsls uanvo;u4trxnmfcta1lpD  uvsl(0s2tm(opnudolenmiciat)s2rm(root1opxnioctlslaDuau on(4alxrxfciatoa  anvi t0trtoimpiydol   fcils)s2tm(mo;o1ope moetlsfaDumn s;u0 etrmfcia1oaDr nvslt0trurirpiodlp   nci ( artauroot0aexo ieiys s2uan onu)alenxrcootopt lu s (0srto(mpiu4amtemneia(farrmxrp;o1apx  ietytls2eanms t4tltrio oa1faDr i i;s) 2xoio3iu4olen nvi t) rum(m no4tleo i3ild a ua(mp t)arerxfcoa1lateanes s  2tmir iy1ll  mfes sfsrtauroou1olen iciysfsDum( snu) lenmr iotoaDeau ol(0 exm(r3ny1ole mfvtltf rrmumoou1apx  fetltlm2uanms;t0 lenxr oo1opDr u o;t0s2toirpno1alt miet sfa2raxrp;u1tetn f3tat sDelnmpnu0 eenxoctytfp   ueo;s  rtrim3iydapeemics ()artrurp;t1alt ifctasfmDrm(vp t0altomfcoodopte neil( t2xoim oudlptnlnviatf 2tau p;o1aleo f3iaslaDuauvo (0tlerxfcoatomtranei ( t2trir oodop emfcil(f 2uru pnt4tltomf3ils m2ra(ms;u0aeerxfctydlm e uesl(  rtm(opno1aptelnvils aDra(r ;u0apeoifetytla2rl(vo (0teerxf oodomtrlueo t)t2urio ou1ll elfcilsfsDrrum nu0tlx mi3tyt s2emums (4 lerxo3tytlpDeaiei;t)t2uriopny1ll  lies s  rrrxroou1oltn ieildla rmuvp;()trtomr3iytom eaueo t0trtoxrpiu1ame lfcilt s2rmxmpnu4alt  i3tldls2um(vp;(0altnirctydoate uesls)teuoir ou4optelict tfs2rrxrooo1tpenif3tldlm ea(vp;u0tlenif tydfm rli il() exmiopnydlpe mfes sfaDrrumo;u4oltomieiltls umn p u) ltrmocoa1fmDraneil(0 rxr(opiu4omtemnetl()arumx  ;t1tlxo oeilsfs emu sn(4 etnmr iatfptrlu o t0srxm(m3oy1apen fvt ( aDra( p;t1alxn ieiatfs2ranvsn(0teenmo oa1oat anvs;(0seuriopou1omenmfes s  2trum ot0apxn icias s eanvo u)arxrmf3oatla raieolt  2toxr no4lle lfes s s2rmxr nt4tee mf3iaslsDeanms (4trtrmf oydom e ieil(0t2urxopnydlptn ivsl( aDrmurooo1alx ioeias a rmuvp;u4texomfcio1lmt li i t texr(rpnu4omenmiesat aDraurp;o4opt mi3ias sDemu o u0 etrmfcoytomt auvo t tetmxm nu4lpee ivs s aDrmumoou4oee mo3iyd aDulnvp;() ltrmocoy1lateaues;t0srtrxo ou4lpee fcilsfartr(ront1tlt mo3iysfa2uln snu4 lenif tytfp  auei t)teuo(rpny4lm   ivs s) rtm( pnt0aetoiociatfs rm( o t0 leoiocia1latrau o s)t2xoxopoo4amt lnctlsfa2ur(m ;t0aptn fciatfa emnmon()alxoxfciytlatelivi;(  2toxopoodlpenlncta( aDurxr ;t4altomf3tltfa2emnvpnt) leoxfciatfaD aies;( s2to(o iu4omt mivi s)s2um(mp;u0alt  o3tasfm2rlums;u4arxnxf3iydlat lieils)seumio nudalt lfesl()a2tr( o;t1tlt  o3iyd s umu onu)aeeoxrcty1la r n o;t0 etmxrpoy4lpenmnes t sDuax ont1alt iieiltlaDrm(vp () lxomo oatoa e ueol() rtr(r3ny4ap nmnviasf rtaxront4tpenmfctytfsDra(vo;u0 lerif3ootoa ean o () 2uoiopoy4al emivtlsfa2truro;u4tleniiciys a uluvs t)aetnxocio1fptr ieo s  2trir3no1aptnmfcsltfa2rmur no1opxomi3iatls emnvsn()teenmr3iydlmtelueil() 2urirpnydamenlics s) rum(mono1apxoiieils s2um(mo;()arermo ty1om eanei;s s2uo(o3no4ome  nesa() Duaxr ;u0tpeoioctaslaDrmnmp (4artnmr3oatlaDrlneil() 2xrxr3oo4ome  ncslt)arrau o;u4ole  i3tld sDulnvo;(0tlermo totfpDr neilt0sruoxo3nydap  mivtas) Drr(rono0tee mociatlaDrmn snt4 rtoif3iodlpD au s;(0 exrxopny4lpte fcta()a2tm( p;t1ale  i3tyd sDumu o;u4artomf3oadop rli i;s s2xrio iy4apt  ivi tfarrr(  no0oltn oeiys m um( o;u)trtnio3iytla elueo ( t2tm(rpio4olee nvtlsfaDtaum ;o1texnmoetltfsDumuvont) lxoiocio1fpDe ieol()tetm(r3oy4llt lnetas  2rru  oo0ope ifeiydfm2raumpnt)tlxrxfcoatlmD  u i t trxr(r3oo1openmiei ( sruaur nt0optn fctad s2ra( p;u4 lenif3to1omte iei;( teuriopoo1amen netl(fs2tm(r nu0tlxn icildls el(vpnt4trtoio todomtrluvolt0srtrim iydlm  lict sfs2urum ot0ope io3ildlmDrauvs t0 rxnxf iotopt  neo;t srxrxrpnu1amenmnvsatfs2tru ooo1texn oeiatfa2emnvp (0alenmfcoadlm  lu o;t tetoxo oy1oltelncil( sDurump;o1altoiietatfm rlumonu) rxrif tydlatr u o s0truoio3ou4omt livsl( s2tr(ro;u4alxnio3tys a ranmont) exnir tydfa  luvsls0 2ur(r iodopeemfvtlt)srrmxm ot1alxnii3tldlm rlumsnu0aexnmr3totopte iesl(  2tr(m3ny1lpe mictlt)aDrm(mp;u4tpeoioeiltlsDeauvpnt)tlxrxo3to1la e n s;t)srtoio3ny1ll   fei t sDum(mp;u0texo octytfmDuluvon(4trxrxf io1latr neo;t  2xo(mpiydaptemics sf Drau  ot4tlen fetadla ua( on(4aetoxocoadfpt  ieo;()srxo(m iu1am emfetlt srur(mo;t4tet ioetadfs2rlu o;u0texnmfctytfateaivi s0t2umxr ou4ap emnvtl()srur(  ;o1opt ifeiysfaDeanvo;t0tlxrxo3iadlaD lieo;t) 2ur(m oydll elictatfsrumuro;u4tptn ietltfm elnvp;u) ltomf3iydomtran ils) 2umim iodlleemivtls)arrrum no4alto oeiltlm ulumo (0alerif3oa1fa e uvi;s)trurir io4ol nmncs ( s2ra(ront1tee moeiad aDem( ont4aeenio iy1oaDelu sl( s2uoir nu4lm  lfcsl()s2tru ono0tle  o3iad mDum(mp () exnircoadfmt  ivi t0s2xm(r3no1ole lfesas sDraxmo;o1apxomi3tadfm emn pn(0artrio iy1lmteln slt0 etoxm3iudamenmnes sfa2rrx ooo0tlxomoctyd m rlu p;u)artnmfciodfp r n sls)s2umim ou1lpt  nviatf 2urur nu4tee  fetasla emnmont4 exomfctatop rlneo;s)t2xmxm oy4ol n feiltf ruaum oo4aptoii3iadfs ea( o t)trxrmocta1op   nvsls) etoim3oudllte neias) rum(rpnu0aexnmieiad a rmn p ()areoxr tydlat  uei s  eum(m oodamtemfeilsfa2umurp;t0alenifctys m ra(vs;t0trtrxr3to1optr ieo;() exrxmpoy4ame  icta(fartr( ont1alxn ieiltls rlu s;(4trtrxf3iydomtranvs;t) 2uoxo ny4omtemncs t)sDuaum ;u1teto feiys sDrln s;u)aetoxf3iytlat  uvi s) 2urirpoo1altn ncsltf Drax pnt0tpeoio3iatfsDelu pn(4 ltoxrcoadlmte uvo s0 2toirpou4lltelfcsat)sDtr(  no0teeo ocildfa em( s ()tlerio3tadla eluvilt0texrim3iudop e fciat  Dtrumooo0opxo fctys mDeanmonu0alxrio3oatlaDr nvilt  rumxopou4lm  mivi sfaDrmu  ;t0apeomfctat s2rlnmp;()aetrmf3oydfm rlnes;t)t2toio3nydameemfeslt  2rru o;t4oex ifetldfa2rmnvs u0aeenifcoa1omDeaivs;t0s2xrim nudame lics (fs2rauro;u0apenif3tys sDua(mo u0arxnir iytfa r nvslt)srxmxmpiy4am elicia(fs2urxrpot4opx iocilsfa rlu snu4artrxrcia1fa rlu s s teuoim ou4omte fctlt  Dumx o;o4olt  fctyt a2rmn p;u0 lxoxo iodoaDrlu slt) etoxm3oudaleelivtlsfaDtm(m ;u4oleoii3tyt mDuaums;t)aetnmocta1fp r n i;s  eum(mpiu4alee nvt () rtr(rpnt1tpxomociydlm2ul(msnt0tlxomf3iatomDrlies t)s2tmxopoodap  lnvi tfaDrruro;u0oltnii3iyd mDel( o;(0 etrifciydlp rluvols0sexmir3io1omt mfesltfaDumxmono4opxnmoctydfm2elu s;()arxrxo oy1fptrlneslt) 2xr(m io4opeelivs ( a2truroot4tpt mfetytfm2ranvon(4tlerxr3tatoaD auvo s)tetoio3nu4oleemicsls s2rr(rpnt1aee  fctatfsDra(vpn()arermo todlpD luvols s2xrxrpoudolee iei s  2urxront1alxo feiys s ra(mo (0 etnir oodfa e nes;t t2xo(r iydal elneslsf rtr(  no0teeoifetyt s2rln o;(0altoxr3oo1lm  anei;t srto(r3nu4llenlfciat)a2rmum ou0alen feilt aDrau pnu)aetoxoctytfaDeaivi t0 rxrxr iudape mfcs ()s2tr( ono0olxn ociys a uauvs;t4aeenxo iatfmDrlnvo () rtrir iu4lm n ies sf Drruronu0oetomf3tls mDrm(vp;u)alerxo oo1la elnvo t teto(o3iodlme lfvilt artaxrp;o1olen o3ildlsDrmnvp;t4 lxrif tadlp r uvol(0 etr(o iodop nlnvsls)s2ta(r ;o4tlxnmfeiatfm eau p t)trtrmr3todfa eanei;t)t2xm(m no4lmeelfeia( sDrax oou4tetoif3iysfm2rl(ms u4 lxnmrcoydlptrlies s  exm(m ou4ole mieilt) 2umx oou0tltoifeilslmDeaump t0 renmr3to1fmtrlueols)s2xr(m iudll n ncsltfaDraxmp;o4opxnmo3iad aDuln on(0 rxrxf iotlp rli o;t)seuoir no4lpe mnvils) rrrum ;o4oexo oeiytlm2rlu p;(0altnmo3oodfm e ivo;(0 euo(m iudope  fvt tfsrtrxmont4opt iieiytla2uau p u)tlxoif3totlaD lueo;s)trtmxm nydomt  fcias srurxmo;o4ale  ociytlm emn o t4tltrmr tytfa rai i;t) eumim iy1ol  mnvil( a2urump;o1opeoif3tyslsDea(mp;u0alxoxo iydfp eaiei;s  rxr(o iydlp e net t sDrauro;u1altnmiciyt mDra(ms ()aexomr3iatlmDeln ilt trum(m nydlm  mfei t arurum ;t4oltnioeildlsDulnmsnt)aetomr iydoa e iei ()texrir3io1ope licsasf 2um(m oo4teto ociasla2rln p t)alerio3oy1fatrai olt) 2urxmpiu4ole liesas s2trur ot4ape  ictydlsDrluvs ()trxrxf iodlat aneslt) etrir3iy4apeemnvs t  2uau ont1openmoetydfm rm( s;u0areomo totlmtraueo s  exo(m ou1oltnlnvs t  2umu oot0apxnioeiltlmDean p;u) reoxociytfp  lu s;s0teuoxr oudaleemfvsa(  2rmu o;o1oee ioctysls rmnvp t0arenxf tadlp elnes;t) rxr(opnudlpenlfei t  Drr(rp;u0teeomociatla2uan o u)tetoxf tatopt au s t0srxm(m3ny4oltelfetltfa2rrxroot1oetniicils m ul( p ()tlxoifciadoaD  nvsls)sruoio oodlptnmivtat)s2trurp;u4altoif3tls m eaumonu4 ltrmrciotfmt lueo s)trto(o no1apt  fet t) 2umur no1olx  oeiydls rln pnt4 exrmocio1fpt ai slt0 2uo(opny4openmivt t)aDta(mont1opx  fcildla rmumo;u0treomfctydlateli slt  rumim ou4lm  lies (f Dtaumono0apt  octldlm rmnmo;()altrif iy1lpteau i t)s2to(o3nudalenmivtl(fsDrru pou1apeoiociydlm2eln onu)treoxocoo1laD aivs;s0 exrxo3iydop   fctlt)sDtmuroot4optn ietys aDelnmsn()texnxf iatfmtr ivsls0t2xoim no1lm  mfvilsf Dtax oot1aeeomoetldls rmn p (4trtoxocoa1lmte neo t srumirpoy4lptnlfvsas  rtmxmo;o4oetoif3tadfa2rl( o;t0 reomocio1om rlnvo () etoxo oo1amtemivi sfaDrru ont1oex  ociad s2raumpnt4tetrif oadopte i o t)trtrio iydom elfes sfs2um(r nt1oee iietlsfm2rauvo (0aeeoxr iydlaDraieolt0 exrxr3oo4ol nmnei sfarrmurpou1apt mfeiaslm ra(mont) reoxrctotfp eanvi (0srxr(o nu4llen nvsat aDurumooo4tleomfeiat a2rl(ms;t0texnxf3oytfpteaueilt  rtoxopny1al   ieilsf rraxmp;u0apto i3tadlm emuvo;u0trermf3iydopD liesl(  rxrxm iu4lmeemnct (  2taxrp;u0apxn i3tatla2ua(vp t0teeoio iatfm r neol()tetmxr nydll n fcsat)a2ta( poo1aetoifctysls rlu o;u)altrxrcoydlpDeanvilt s2uoxmpiu4alt lnci sf rtax pot1aexoiieild mDra(mont4 lenxf3iodlpt anvol(0 2trim3iudlmenmfvtl() rrrx p;u0tetoiieilslm2uan p t)tetnmfcta1laDeai ol(0 rxm(o ou1ameemfvsat arumu  ;u4openmocildfaDrmn s;(0 ltnxrcta1fpDr ueo s0 2tmirpio4lmee fei (f rraurono1texoifctldfsDuan pnu4 etnxrctodopD li ol( sexrim iu4ol emnet tfsDum(rp;t0aex mictydla2ulumont)trxnmocoy1laDelnvi;t0 exr(mpny4om  lfviatfarurx p;t4oex mf3iasfm2emnmsnt4arxrmf3iatopte ueils seurxopiydol emivs (faDtaxmo;u4alen feils s2ra(vonu4 rxrxr ia1fmtr i sls0tetmio3ny4opeemfvt (fsDtmu pno0oltomfctadfa2elu snt4trxoif oodlat aieol()seuo(r3iudlltemivs t)arua(roou0opx  iciydfa emnvo;(0aexoio3oa1lmD au ilt0 rxr(o3nydopte neils  2ur(  ;u1aeenii3tldfmDua(vo (0arxnxr3iotla  au o (0 2toio3oodomt lncs ( srrrxrpno4alxniiciasfm el(mp;(0teerxo totfaD aieo () eurio no1ole  fvsas)a2ra(m ;u0open ociatfm emnvon(0trenmfctodoateanvo;t)teurxo3oydlmtnlicsa(  Duru  ou0ope mictld sDrmnvo;()trermo iy1fm rauvols trxoxr3iy4oltnmnct s)s2uaumpoo1opxo o3ias a2ra( ont4tleoxocoydomDeluvi t0srurxrpnodlptemfvia(fartmu ont0aee  i3iadls el(ms;u4tlermr3totopD ai il(0s2xm(mpnudlpt mnctas artrx p;o1opxoii3tasls2ua(ms;u)trxoifctotom ranvols trtmir oy4lm   nes (f rrax  ot4tlx  ocildfaDumu s u0alermf3iatfateauvo t s2uoim3no4ll n ivt ()s2rruroot0alxo f3iyt sDelu snt0 etomoctatlmtrlu i s)s2to(m iydape mnvsltfsDtaxmooo1alx ifeiydfm rl(vs;(4alenmf iodfaDeluvsl()teurxrpiu1lpe  ivs t s2ururonu4ole  oeiatla2elnmo;u) rxrxoctytop  aues ( seum(o3oodamtelicil() 2rm( p;t0alx iiciadfsDumn sn(4artnmr oo1om r uvo s0teurxo3iu1lmeelnvi () 2umxmpou1apxoiictldla raumsn()teenmo iotopt auvsls)t2um(rpiu4om e ncsat a2ra(mo;o4opxomicildla2ra(mo;t)tlxnxo3to1fmDr n o;s0srxm(m3nydapenmiet tfaDrr(m ;t0altnmfctaslsDeln on(0trxrmo tytoate iei;s0 eur(r3iu4ap nlnvtat sruax pot1teeomfciys mDelu onu) etnmf3oadlm ranei s) eur(mpno4olenlnvt tf 2ur(rp;o1tpxomfeiyt s2rmn p t4 reoifcoodom r ieolt  rxr(r iu1omen neiltfaDraurpnu4tpe  ietyt s2ul( p;u) rtomf3tytlmD li sls)s2xo(rpoodaptn feilt)arrmx  no0alx iiciadla2rl(vp ()tetnxfcio1fmt aies;(0t2tm(m3no4ap  mictas)aDrrxrpoo1opx  i3iytlm rl( pnt)trtnmfciydfa  aieils0seur(m nydom emnvi t  2umur nu0oeen ietld m rm(vo t4 rxoif3oy1lp  ai i;t0 ruoim3nydal   fctls) rua(  ;u4ole mi3ilt s2ua( ont4alxnmoctadopteanvs t0 2ur(rpio1oltemiei s arrmur nu1alx ifctld sDem( o;u0trxrxf ootlaDeaies;(0tetoxm ou1lmte netls)sDrrx pou1ale mociatls2umump;(4artoio oy1om elu ol() rtrxr3ou4aptn ncta(  2umxro;u4ope ifeiasfa2ua( o u0trxrir3oy1faDeli s;(  2xrxr3oudlpenmneia(f rraumoou4opxo oeild sDem( o;(4aexrxoctydlp e i s;(0trurio oydlle lnctls) rtmurpot4tet if3iat s uanvont0aexrmo iotoateaueols)trumxmpou1olenlneil(fsDtmumono1texnifeiadla2umu o;() renmr oodoate u s;( truo(r io4ape lfcil() rua(ro;o1teeoiociydfaDulnms;u) leomr3ty1oa e n s t truoirpoy1olee nei tf rrmum oo4tee if3ilsla2umnmpnt)aeerir ty1opDrlnvi;s trxoxr3iodom   fetas)sDumumo;o4aet mo3iytfsDem(monu0 leoir iatlm r ivs ()trxmim oy4am nmnesat s2ua(  ;o0teto ieiad m2rln pn(4 ltnmrcoa1laDe uvo;s seurxopiy4al emicil(f rtmumooo0apt  fciasfs2emn p;t4alxomr3iodom r nvs;t0s2tr(r3oy1llee nvsa()arumumooo4tee iietys mDuau pn(4 eeoxfciotfp  lueols0texr(rpiu4optnlieilt sDuru oou0olxo f3tasla2rluvs;(0aleoxr3oatlmDeai s;t0 2umxr oy1am nlfcs t) rurxmpno1aexo o3iaslaDumuvp;u)aetnmrcoy1fateaivs;(0trtmxmpnu1altemiesatfs2taumo;t1olxn i3tltfmDra(vo u4tlerxf3iytopD  uvo t0t2uo(mpno1olt lfcsa( s2tmxr ;t0tle mfcils s2el(vonu) lxoxo oatlpD livo ( srumio3iy1lpt mivsls)s2ur(  ou0altnio3iltfm2ulu p t4arxoir3tadfaD  uvils  2urim ny1ole  fciasf Drrum no0opxnii3iltfa2rlump t4arenxo3todfmDeaivs;s0tetm(r oy1lmtnmneta()srraxrpnu0oetoifctltlmDelnvs;u)alxoxrctadfmD aivo;s0 eurir3io1amen ietas srrmur ou0texnii3tlsla rmnvpnu0tetoircty1omteluvi s) exmio3oo4lpe lncsat)s2raumo;o1apeomiciltfs ean p ()tetnirctatomtr ueo;t0setriopnu1am elneslsfsDrmurooo4aee  ociad m ra(vsnt0teenmociotlp rlnes s0s2toxr3iydap  lies t srrr( p;t0olx  ietaslsDelnvp;t) lxoirciadlm r u o t0 etm(r iy1op  mfeilt  2rr(r nu0oltniociltfs rln s;(4 lerxo3ta1oat ai ol( teurim3ou1ll nmncilt aDurxrpou1tpx  ieiys a2rmnmp;t0artomr ootlmtr n il( srxm(m3iu4lmtnmfvsas srtmum ;u1oleoifctltlm2el(vp t4arxnmrciytlm eau olt0t2xrxmpoo1op  mncs s aDtmxr ou4aeeomoetytlmDuln p;t0alxrxr tytfpDeaivo;t t2uoxr oodom nmfvsl()a2ra(  ou1teeomo3ils sDua(mpn(0 leomf3oydlaDrlieols setoxm3iodopeemfctlsfsrtrx pnu4apxnmf3tas aDea( p;t4 etoxf iadoaDraiei t teurir3io4amee fvilt srtaur ;u0tetnmieiys m um(mpnt4artoir3oatop   i ilt0seurio3oo1olt  fvt s)srtm(ro;u1tlx iociltla2emuvon()trermr3oo1omt  ieo;t)s2xrirpiydol   fvi s)aDtrumo;o4tee mo3iys a2rmuvs t)tltrio3totla rlivi;s trxmim nu4alt  ietas)arumur ot1apt mi3iatfsDra(vs t)alenmf3oy1lm  lu i;( teum(opoodlmtelnctltfaDrrxmo;u1tpxomiciyd m umnmonu4texomfctydlateln o s) etrir3oy4lp  lncil()a2rrxro;t4alen feiyd m ua( p () exrir iadomtrluei;t t2umir3ny1ome licil(f Dur(rpou4tlxoifctydla2eauvon()alxnio3tatopteaivo;(0trtm(opoo1ome  nvtat a2tr( p;o0texo ieiysls ua(mo ()alerirciytlat au o (0teurio iudlmenlfcsa()sDta(  oo1tleomfetls mDulumpnu)treomoctadfatr uvslt0sexoxrpio1amtelicta(fsrrr(mp;t4ape mi3tltfm elump u4alxomr oo1fptr neolt)s2to(rpnu4llee fvias arra( o;u1alx  ieiatla rm( s;t0 rxnioctodlp rluvs;t trxmxopio1lmtnmfviat srrru p;t4aex mf3ilsfsDuanvo;t4trtnmr3iadomD  u o t texo(m iu1op emfeia(faDtr(rpnt0oltn oeiasls elnmon(0tltrxociydfmtrli o;t s2toxr iu4apee ietl()srta(rpnu4tleomf3tyd aDrmuvpnu) exnmr3iodomDrlu i ()trtr(m3io1lptelnvsls  ruaxrooo0tlxn fciydlaDuauvs t4trtniociy1oa elu i () 2urxopiudapeelietl( arur( oot0openmoetlt sDuaumo ()artrmf to1omDran s;s)seumim iudoleelncsls)arrru pot1tltn f3iysfa2eluvo;u4 ltrmr iydfp eanvo ()truo(rpnudoltelfvilt) 2trxmp;o1aee  fcilt a2eluvp;u0 etrmfcoa1lmDrlueils0s2toxopiu1ll   ivilsfsrrax p;o0tpeoifeiysfa emnvp t0 eenmo3oatlaDrai i;s0texoxr nydlpeelfvt tf 2tmu ono1teto o3ils m elu s;t)arerxo iy1lpD  uvsl(0teurxmpoydoptn nci t) rtmu pno4tpxo oeiltlmDumnvpnu)aetrmocoatoaDelnei (0 2umim iydomen icsltfaDum( pnu1tle miciltlmDuluvo;u)trxrmr3iotfptean ol(0teuoimpnu1ameemicil(faDumurpnu1alxoii3ils m emuvs (4 etrir oadoaD lneo;(0srurirpoy4altnlivilsf Drax pno0texnmoctltlaDrlnvo;t0 lxnmrcoa1lat  i slt0sexmxopoo1ol nlncs ()a2um(mooo0optn o3iasfa rmnms u0 lxomrcoadopD ai olt trtmiopiydolee ici t srrmu o;t4tetoif3iaslaDra(ms t0tetnmo3oodfptean sls0 2tmxo3nudlltn fvia(faDtru  no4ale mfciat a2umnvs u0trxoifciatoat aies (0setrio3iu4lmt lfvi sf 2um(mo;t1aptomi3tls mDumnvont0 ltrxr iadlp elies;t) eur(mpnu4apte icilt) 2tm(root4tpeniociydfa2el(vo t)tetrmfcoadfa elieo ( trto(m3ou1ole  ict () Dumur ;o0texomieiatfs2emuvs u0texrmo iatfaDe n i;(0 exmxmpnydaltelivsa( aDtm(m ;o4tlxoii3iat m2emnvp;(4tetrio iy1opDranvi t sexmxrpnudlm   nvi t)sDumur oo1aleo f3iyd s2uan o;t4aexomrcty1lp rlueil() rur(opno4openmictl(f Dum(r oo1aexoifeiadla rl( s t) lxnmr ta1opt auvil(0tetmimpiudll e fvi tf rrr(  no0oexo o3iysfsDrm(vsnt4 leoxfctydlaDrlivi;s0t2toxr oydam n fcilsf rtrxrpot1ape iietad s eluvo;u4teenio3totlpD au ol(0seto(o io1op  mivs t)s2tr(mpot0opeoio3iltfs2elnvo (4trtrmr to1fmt ai s;s tetrxopnudlmtnlivsls) ruax ooo4oeenmociltls elu p u4 exoif iotfm eauei;t0srxoio oy4amen feiltfa2tax ooo4aex ifctydfmDrm(mpnt4artnmf totopDrlnes;t0 rxmir iy1lmt  ncs s)srtau  ;u1aetomoctat sDrl(ms;() rxnir oa1fatr ieo s  2trio ou4al nlivsatfaruax pot0teenmi3iad s rlnms;u0artrio3oatlptrlu s (0teuoir io1lmenmici s aDumu ont0tpenioetys m rmn o;u)texnif3tytlmDrli o (0t2tmim3oodopee feias) 2rmxr nt4tle mfctltlm2ulnmo;t) reoxo3oydlp  lies;() rtmxopoudllt lneilt aDtrx ooo0ape ifeiydfmDemu o (0 exrif to1fa   nvs (0trumxmpoodamt livil(fs2tr(mpnu1alenif3ildfmDumuvo u0tetrmf totfat an i;t0s2xo(o oy4lltnmfctltfs2ra(rono1alxnii3iytls rauvpn(0 rerxocta1oa r ivs;s) rtmirpoudlm n nesl(  Drru o;o0tltnmi3iltlm2ul(monu4 eenirctodfm eluei;() rtoxm oy4omtnlictlt s2rmxmo;t0aex  ictydlaDrlu snu4tetnif3iytfpDr uvi;(0 2tmxopiudopenliesa(farurxrpno1tpxnmi3tysfs2ranvo (0tltomf oytfmtr nes t) 2toiopoy1oltnmfei s arurxronu4texo fcils a elu pnu4artnioctytfpteaivo;t)trxr(m no1op e ncsl()arumx pnu1tpxnmi3tytfmDuaump;()tetrir3tatfm   ies ( t2tmxopiu4alt lnciatf rraur ;t0alt if3tysfs2umuvs;u4tltnxf3iodfmtr neols) rxr(m iodllt  iesatf 2tmump;t0openiieiaslaDelums;t)alxoif oadfmD  i i () exoir3ou4ape  nesl()sDua(  nu4alx mociad s2uan pn(0aeeomo3totfmD  neol(  2xrxr3oudlpenmnetas s2um(root1aleoioeiasls2rmn snt4aetnio3totfmDeaivs (0 2urirpnodom emfvi s)aDtrx pnu4tleniieils aDua( on(0 ltoio3tytfaD lnes;()sexrxrpiodalt lfvtl(f Dtr(mpnt1opxn f3ilsfs2uaump;(0 lenxrcoo1oatr nei;(0 exoxo3iodol elivilt  rur(r ot4oetomi3tadfs2uauvo;t4alerxoctatfa rai s s  etoxo nodome lneia() Durx  no0ale moeilsfaDra(vsn(4tleomo iy1laDelieo t s2tmir iu4alee fci t)a2uaxr nu0aeenifcias mDem(vo;u0 lenif tytfm e n i;()trurxr ny4ol  mfcsasfsDurxmoou0tptoifciatfs ean o t0 rerio3oa1fmD ln s (0 rxmxr3nydam  lfvi (  Dta(r ot1alto fciyd m rmumo u4 leomr3ia1lm eli il()texrio3ny4oleemnvil() rur(mooo1tleo ietadlsDrau pnu)texrxociydopt an sl(  2toxr3oo4lltelivsa()arra(r ;o1aptomf3tadfs2rm( o;t) rxnmf3iodom e ivi;s)trtoxr3nodap   ivt (fs2ua(r nu4opxomo3iadfm uaums;u0teeoxr3iytlm   ivi;s0texr(o oy1ol nlfvsls  rtaumono1oeenmoeilsfsDuanmpn(4 rxnxr3iydfa eluei s) 2xoxrpiudopeelfvi t  2urumoou4texnioeils a2umuvo;()tltrxrctatfpDeaiei;(0tetriopnydape mnvi s) 2tmu  ;o1tlxo ociytfs rl(mont0tlenmr3tadlmD auvslt0s2tmxopny4omtemfviatfsrrm(ro;u1apxnmfeiasfsDel( s u4 exrmoctodfpDeanvo s srum(r3iu4opeemnvt (fsDum( pno4apx  fciytfs2ean sn()tlxomfcty1laD  i s;t0 ruoxr oudlptelneil(fs2urump;o1apxomiciydfm umn o;t4 lxnif3io1opD  ivi;s0sruo(m oo4lpenmnesa(farra(ront4opt  i3ilsfs uanvs;(0arxomfctatoatrau o;s sexmxo oudolenlfvsatf Dtrx oou1tlt mietyt s emu pn(4 lermocty1fptrai i;t)t2xr(r no4ap nmfviasfsrtr(mpnt4tltoioctyd sDumuvsnu0trxrmo tydfm rlueil() eum(mpio4amtn icsasf Duaxmo;u4oleo oeiysfs emu pnu0aetrxrcoytfaDeanvol(0 2xoxo3oy1lpeemncs s)sDtmxmo;o1opxnmfeiltlaDrauvon(0 exnmo3oydomDeau s s)trtoir iy4ame livta(faDraur nu1tee  oeiytfmDelnvs (4 exnmr iydoptrau i t) 2xmim3io4ape mieilt) 2urur ;u1alxn fcias s2ul( s;t) exrxf3oodomtrln i t srtmxopnudomenlivsl(f Dtaurpno4texoiocilsla2rm( o t) eenif to1lat  u ol()trtoio iy4lp nlncslsfa2tm(  ou0opxomocilsfaDulu pnu4aexnircootfp  luvo t0s2xoxm nudlm nmiesas)sDtau pot1apenmociydlm rauvs u4aetoxfciodfmD  ivols0srtm(o3oo1omte nvias a2taxronu4aee  o3ilsla2rlums ()trtnif3oy1faD  ueo;(  rto(mpoo1llenmneils)srtmum ot1ape mieils s rmuvsnu) rxnxr3iodlaD aieo;(0trtmxr oydope lnesltfs2rru  ou4tlto ieiysfs ran ont) rermf3iodfaDeauvs;t)s2xriopnydlmtemieilsf Duax  ou4oexomfeiltfs elnvpnt4alenifcty1fa rlnvslt) 2tm(m3oo4amtelnei ( a2tax oot4tleo i3tlsla2eluvo t)teermrcta1fm   ivs;s)s2um(m3oy4lm eliviasf 2tru  ou4ale iiciasfa rlnvpn(4 leomo totlaDr ivolt)teuriopnudopte fesa()srra(root4olx  o3iatfs ulnvpnt0tleoxf3ta1opteluvolt0s2tr(mpoydalen fetatfaDrmuroou0teeomoeilsfa2rmnmp u4 reomrcty1fptrlu s t)setmiopiydlltn nctl(fsrra( p;o4tltnmfciadfm2ulnms;u4 exrxf oy1omDe uei;(0seto(r3iydapt mnviasf Dtr(mo;o1olto icilt mDul(monu4alxomrcio1fmDe nvo ( trtrimpiodap nmicias) rum( pou1tetnii3tat a ea(ms u0arerir3oa1oaDrluvil(0setmxmpnodoptemfetls srumxr ;t1texomiciltla2rlnmonu)aetomf3iy1fa rln i ()trum(o3oo1opt mnesatfaDumx o;t0apx mociltfa eau o (0 exnmocoo1oat auvi ( s2trir3oy1lle lfci tfs2tmx pou4teeo feiatlm ua( sn(4 lxrxocoo1oat  n olt0tetr(rpny4lmee nesls  2taxr ot0tltomoeiad m ulumo;(4 etnxr iodlpD ln i t trxm(opoo1opeemfcs ( arrmu pno1apx  ietadfs rlu pnu) exoirciodlpte ivsls)trto(opoodlle  fcias)srtmurp;o1tpxomi3iytlmDuauvo;t) ltrxfcoytfm ean i;t)s2um(r iu1ole mietas s2rrump;o1tpt moeildlm rauvo t) rxrxfciy1fatr i ols trxmxo iudame lfcsas) 2rrumont4oleo o3iasls eluvo;u0tlxrxo3iytfpte neols  rxrxm3no1op   iesl( artmumpno1texnioctytla rmu o u)altrxo oa1omDelnes;t0 exr(m iy4altnlfei t sDrmxrpoo4open fetadla umu s u4aexomrctodoat aneilt0 rur(r oo4opt  fvsls arumur ;t4alxomfciydlmDean o;t4arenxf3iadfpD aneslt) 2uo(rpiy4al  mivs ( srrau poo0oeenif3iydla ulnmsnu0aexrir tydfmtr ueo;()t2uoxo oydomte ncs t)a2umu poo1oexoiietyt mDrln o;u)teenir3todoa  anei t  eumir3iu1apenmivia(fsDtm(mp;o4texn fciad m rm(msn(0 exnio oydfm rlu o ()t2xoxm ou1open fcsls aDrmxmooo4texnmocias s2rauvp (4aeenif iadlmDelnvols) 2tm(opiu1apt mnvils aDraur ot1tltoifeiysls2ua( p;u4teenxocoadopt  n sls0s2tm(o ou4alenlfcs sfaruax p;u1aexo ieils mDumn s;u0 ltnxf3iatoa e i s;t s2tr(opoudll  lneil(faDrr(rp;t0aee mi3iad aDrmuvp;u0 rtrxrcoytla  lueils)texrim3no1am elivtltf Dtr( o;o4oeeo o3tldlmDran o t)tleoircia1fmD aueo;s s2xrio3iydopt lictl()aDta(rooo4opxo ociat sDuan o t4trxrxociotlpDelu i () 2xrxr3no4ale  neiat)srrmur no1oetnmoeilsla2emuvsn()tleoxf oy1op e ivi t0sexrxm3nydop elnvil( srta(  nu1open fciadfm umu o;(0trerifctodopDelieolt  euoxm3nu1omtemivs (farururp;o4oeen ocilt aDraump u0tltrxr iytfmD luvols teto(r nu4omee neia()a2rrx pnu1tpt  ieiadfmDea(vs () rxomr3iodlm r ivilt  rxrio3iu4opt mivilsfs2tmum ;t1olx  f3tltlm2eau p t0aeermf tadlmtelueols0t2tm(mpoydol nmfcs s)aDta(  ;t1alenmf3tltfs2um(vsn(0tetrmr tytfa  anvil(0 2trirpiy4ape lfcs tfarrrumoou0oleo oetadfs2ran p t0 ltrmfcto1latrlneo;(  2ur(opiu4ap n ieils a2tru onu0alxoifctat mDem( p;u)aeeoiocoatlmt au sls) eurxrpnydam   nes tf 2trumpnt0tpxomi3tasfa rl(vsnt4trxnxf3oadfptrluvo ()texmim3oy1lm  mivsls a2tmxmo;o4tpe moetyd m ra(mo u4arerio to1omtraneils0 eum(o no4lle mnvs () 2ur(mp;o1tptnioetasfa rlu s;t4trerxr todlat livo ()seum(m oudaptelnetlsfsDuru o;o0aptn i3iydfa eanmo (0 lenxrcio1om  luvo t0teurir iydapee ncs ( a2tau p;u4tltn ietydfa2ranmp;(4aetrxf ootomD lieols0 etoir3iy4ll emfcsat) 2umuro;u1tetnmf3ilt m2umumo ()trerxociytoateaues ( srtmio3no1aptemfeiat sDtmxmp;u1ale iieiysfmDulums u)tlxomr3oo1lpDeaneilt)trum(opoy1lmtnlfcils)sDtax pou1oexnii3tatfaDuau s;()texrircoo1laDeln i s)s2xmxrpiudlpee ictls aDtrumooo4ale ii3ilsls um(mpnu4 leoxrcoa1la eanvo;() 2tr(o io1lpe lncs sfsrtr(mpno4optomo3ilslsDulumsnu4artnmr3iatla  li olt) rurir3oydlle  fet (faDrmxro;o4tpe moetat m2uln s t)aeeomrciadom elieo ( setoir iy1lm  lfvi s a2trxrpot1tlx  octls sDemuvpn(0 etnxociy1om ranvi;t0 etrir oo4apeemiesa(f Dtmu  nt4oetn oeiyslm2ul( s t4tlxrxo3ty1fpDrau i;()trxr(opio1lptnlnvsat a2ra(root1opxo iciyt a2eanvo;u0tlxnio iatoaDeai i;t0trxoim3nu4omt livs t  2ta(m nt1texnioetydfa rmnvsnt) rtrmo3ootom elneil(0tetoir ny4ole lnvslt)sDrrurp;t4oexomi3tysls ul(ms;() lxoif ty1oaDrln il(0 2triopou4ap elfvs s  2rr(m ;t4alxnmietadfmDrln p;u4 rxnmr3ootlpt  ieol(0setoir no1al nmnvi () 2raum nt0tpx ii3ildls emnvon(4texoxr io1lmte n o;t)srtoiopnu4apee ncsas) 2rrum nt0aeeo f3iys a2eaums;u)arxomo3tytlmDelu o;t)trumio3iu4lm e ietlt) Duaum ou1tet  feias s emums () ltoioctodfa rai il(0sexm(rpnu4ll  lnvias s2uaumoot0aeeoioeildla2uanmo (0alermocoa1oa eauvs t)s2xmiopiy4lmtemnvsas a2rrxmono1tex ii3iydfm2ulnmo;(0 lerxr3oodopt aueols texr(r3no1lltelnetl(f 2trxroot1tlxniieilt a eaump;t4tetnmr iytomD aueo t  etmxm ny1opeeliesl( artm(r ;o0ale  oeiydfs em( pnu0 leoirctydlp r neolt)s2ur(m3oo4om emfvt t sDrm( o;o1optniiciys mDelnvs t0 etoxf oo1lmDeau olt)srtriopnu1ol  mivi (f 2urxmpnt4tltnifciltlm uau on()treoxo io1laD anei t) rxo(opiy4lme  nci (fa2rruro;o1oexoioeildfa2el(mp;u0aeenxr tytlp e n o;s0trxrirpiudll nlncs s srtrurp;u4apt mi3tat aDul(ms t)arxoxo ty1fmDeaivs s0tetrim3iy4aleemnesltfs2rr(rp;u4apxnioetldfmDeanmont) rtnxf oo1la elnvs;s0teumxm ny4oltemivtatfa2urump;u1aetomfctlsfaDua( o u) ltomrcio1fm raivilt0 2to(rpno1optn fvi sf rtr( pot0oleomi3iatfa ea(mont4aetnifcoydfate ivo;(0trum(mpoy1lm nlnvtat)a2tmxr nt4alx ii3ias m rln p t4tlxoiocoatfmD  ieo (0texm(m3io4om emfetlsfsrum( p;u1ope ifciyt s um( p t)trermfctodom   ieilt)trtrxm3no4lltelnvi (fsruru poo4olt mfciasls2raumo u0arxoifciydlptr i o s  rtmimpoy1om emnet t) Dtrxrp;o0opx  fcilsfsDelnmp;t4treomf iotfaD ln s ()t2toimpou4ame mncsat a2tmur oo0tpxnmfcilt sDrl( s t4aetrmrcootopDe nes;(0srxoirpnu1lpe mfvsat)srtrxronu4teenio3ils aDeln s;t4 rxrxo3ia1oaDr n i (  2xoiopoodlmen icsas  rra(ro;u0oltoifeilsfaDel( snt4tlxoifcto1fatr nvs;( t2umimpiu1ale mnct t sDrrur no1ole if3tasls2ra(mo u0altnio3iytom  aivo;t)s2xr(mpio4llte fctl( artmumonu1aetoioctysfa uanmsnt)texoiociatomtrai o;()seumirpnydalen net ( srua(mpnu0aexn o3iydfs ea( o (4aeenxf tytlm e u il( teuoxrpnu4apee fct ()s2urxm ;u0aee if3iad sDranvpnu0tlenmr3oatlmt anvs;( texmiopoo1lptnliesas  rur(rp;t0openmocils s2eau p;u0tlenir oa1lmDrai s t sruoxr ny4lpenmnvi (  rtrx oot4oltoioeiydfaDea(ms u)aexnifcoodlaDrlivilt0sexo(o3nudomtnmnci tfsrum(mp;u1oltnmi3iadfm emumo t0 renxf3oodoa eli o (0srtr(m3ny1aptelivia() rtrxmonu0opxoio3ils s2ua( s;(4 ltnifcto1oa e i i s s2tr(opnudol  mnvs tf Dta( ono1ope  octyt a rln ont4trxnif3oydlptelnei ( seur(r3oo1lmee icsasfa2rm(m ;t4alxo feilsfaDra( s (4aexnmfciy1la e ueo;t t2xrxopiy4amt lnvil( srtmu pnu0tleoifciat s2emn pn() ltrxo3todoptr nvo;t)sexoxr3oo4lm   fesl() rrrxm no0oetnifciadfm2eanvont4trtrmo3io1fm raiei;s seumiopny1altelfctlt)artr(mpoo0apt  iciasfm2ranvs;(4tetrio3ta1op r uvi;s srxrirpny4oltelfvsatf rrr( o;o1tpx  ociatfa2ea(vp;u0 etoxo3iotfp r u sl()trxoim oo1lp n feslsfaDtaumoot4aetomieiadla2em( pnt0tltnxr3tydoat auvs;t srxrio3iodameemivias)aDuaur nu4optn iciad mDem( ont0teermo3ty1om r uvs;t trumxr3oo1lp emnvt tfartr(m ;u0opxnmiciadfs2umnvpn()alerioctadla raivs;t t2to(r3oo1ole mfcsas  rra(mpou0tee ifeiat s2rmuvpn(4texrxociodfaDelnvo ( trurirpiudlmtelfci ()aDuaur ot4oexoio3tytfa2uaums;() rxrif3tadlpDelieol(0 rxm(opoudlpeelfvsa()aDtrur ;u4tee ifeiat sDrmnvp u)texomo oadfa   uesls0 2uo(r3no4lp nmivi sf rtrxrpoo4alto i3iydfmDumn s;(4aexnxo3io1fmt lueils)srxoio3ou4ll  livt () 2um(m nt1olxo f3taslm2ua( onu0tltnmfctatfm   u ol() rur(r3iy4lltnlfetas) 2rm( poo4tlxnifeiyt a ran snu)aetnmfcty1oa eaieo;t t2tm(rpno4lp emfvsat) rtmxronu1apeomo3iadfs2emnmp t)treomr tadfa ranvo t)srumxr3iy1lp  mfviltfsDra(moot0ape  iciytfsDulumonu0areomf3iy1op rlnvs;(0srxmiopnydapt lnet ()srtmxmp;o4oeen octytlm2ulnmp;(0 ltoio tytop   ies;s) rumxm ou4lmeelicsas)sDraurpot4ape mfeiytlmDelnms u0trxrifcoa1fp eanvil(0s2xoxrpoy4aptelfetl(fsDua(r ou1altomfetydfm ea( onu)trermrcoo1lat aivo;t t2xmxopio1ap elfet tfsrrrum ;t4ope mietlsfs ra(monu4altomo3ia1fat au s;t s2toimpnudlltn fvs s a2tmu poo4ale  i3iasfmDea(ms;u4 etrxr ty1faD lues s seumir3nodole lnvi tfartr( p;t0tex ifctys s umuvp (4trxnxf3tydoatrau i;s0t2um(r no1amee ictl( s2umu pno1tpxn fetydfm ra( on(0aleomf tytopDeln s s0trxoxr iy1lmtelnei tfaDuax pno1oet  f3iysfa2ea(mpnu) eenxrcoodfa eau s;s texrim iodap  mnesl()sDuaumooo1ole mi3tytfa rm( s t4 rtrir tadfptr nes;s0teur(opny1optnlnvsl() 2ur(rpnt1tpxomfeiadfa2ean p u0aetoxr3tadoa elnvo s srxo(r3nu1opt lfvsl(f rrm(rp;u0tpxo fctys mDuluvp;(0 renirciodom  aieolt)trtrxr oudol n fet s)s2um(mo;u4texoiieiyt m emu o;(4tetnmf ty1oaD anvil()s2tm(r no1lpen fcsl( arta(r ;t4opxomi3iysfs rmnms;(4arerifciatla elueils trtr(m oo4ame  nviat)a2ururont4teto i3tlt s2el( on(4arxrxf3iytlmDr u i;()s2xmim3no4amte ivi () Dumumpno0tptn iciatlmDrau onu4 rtrif3to1fpte iei;t)t2um(m iudomeelfcsl( aDta(mp;t0aeenmoctls mDra( o (0 etnir to1optelneolt0tetoxm ny1olt  net t aDrmur ot1openmiciaslsDum(vp () rtrirciadfatrlu i;t0t2tmxopoodlp elfetlt sDtru onu0tee mfeiatlmDum( p;()altnir3oy1omDr u s s teumxopoudaltn ivi sfaDta(rpnu0oex  fetaslm rlnms t4trtrio tadoaDeauvsl(  2tm(r3oy1om elnvia(  2umxrpnt1olen o3iad s rl(mo ()trtrio3iydlatr i ilt trurio3oo4lmeemnciat  2rrxmo;u4teeoif3iasfm elnmp;u)tltrio oodop rln s;()s2xrxm ou1ll emfvslt srtmu o;o1tlx iietasfsDuln pnt4tlenxoctodopteanvsl( sexrxrpoy4omtelfcilsfsrrmxmpnu4tet mi3ilt m el(vp t0aeeoxr todfa rlnes;t)texmio3oudomte ivt s)aDrrxrp;u0olen oetatfa2elu pn(4tltoiocta1fat lu ilt0 rxmxr3nydapeemfcil(fartrx ono4tetnmo3iadla umumo;t)tltomo ootop rlnvi s)texmir oodale mfct (f Dur(  nu1ale ifetlt m ulnmpn()treoir oodoa e u i t) eurxr3ny1ll nlnvi ()s2uau pot4tetomfetadfs rau o;u0tlerxr tadfp   i i t  eur(opio1amt  neilsfsDrr(mpoo0tlt  ocildlm ea(mpn(4trermo totopD  ivs;(  eurio nu4al nmnvil(fa2rrur ot1tlto iciyslmDeanmo (4teenmf oytoatraies;t0 2urxo io1ap nlies tfa2tr( p;t4tpe ifciltfm uanvs t4alenmrcoatop e nvi s)srtr(mpiodlle  nci s) 2rrxr ;u4ape  oetldfm2uanmo;u)alxrmrctatfpD auvil(0 eurxm3ou4lme lncils sDtauroot4tetn oeiatfa el(vo u)aexnir3io1fp rlieils) 2xrxm3iu4amte fcta() Dtmum no4optoiiciltlmDua(mo u) ltnxo iadfmt  u o s  2to(o3oo1apt  fvias aDrr(r ot0aptnmieiadlm rl( s;u4alxomr ia1lm e ivs (0 exmio3iydol  mfctls) rumu pnt1teenifeiyt s rm( s;u4tetomo oy1lptran o;s trto(o iydape  icia(fs2ta( pot4oltoifeiat m raump t0altoxo oo1fpDeaueo t sexmio oo1lmtn feta()sDrr( o;u4tptomf3iltfa2em( p;u4texomo ty1laDrau o s0 rxmxr3oo4amtn fvtl( sDtauro;t1optn icilslm eluvo ()tetrxo ootfate uvs;s sexrxmpoo1ap emiesls) rumxroot0oetnifciytlm eauvs;(4artnifctytoptran s;()s2xm(o no4lp nlfet s)s2ra(  ot0apx io3tadla ulnvsn(0teerxociatomDeau o;( sruo(opno4lm e nvsa()sDrr(mp;t1oee iietysfa2ra(vsnu4treoxf oa1op rai s t) rtoxr nu4apen ivslt aDrrxrono4tetniiciadfsDrauvs u0 exrif3todlpD lnvslt0 2xriopiydoltnlicia(f Durur no1tlxniicild aDea(msn(4 etnircootfpDrau s (0s2xrxr io4oleemfvsatfa2rmx o;u1oeto oeiltfmDelumo u4aeenxfcoa1fmD lieols texr(mpoodap n nct s aDurxmpno1ape  o3iydfm uanvs;u0tetoif3totlm raieil( srtr(mpnodap nmictasfarrrxront4oltoiociyd aDrau snt4 lxoxocio1latrln s t0s2xrxrpoy1altnmncias) ruru pou0oltnmicias m eaump;t)alxomfcoy1oa   i ils trumio3oydomtn fvs (farrrump;t0texn fcild sDrl(mo ()trtnmf3iydla   u sls  rtoxm iudapen fctls a2uaxm ;t1tltnmi3ils m rauvsnu0 reomr tytlptelu o s  2tmxrpoodap e netltfartr( oou1alxoiieils s2rl(von()aexnxr3oo1omtelnvi () 2xr(r oy4al nliet s sDuau  ot0ale io3ias a2rmumo (4trtrmfciotla   uvo;s)s2tm(m3iydapeemfvt t  rtaxrpoo4tex  o3ildla umumont4 ltrxr3iydlat lieo;t trumxmpoo1apt  icil()s2ra(mpou0opto ieiatlsDea(vp u0arxrmr ootlaDr n slt0s2uo(opno4lme licsltf 2rmurp;o0aexn oeiatfm emumsnu4 ltnirctotfp  li o;() 2umxopno1omt licslsfsrumu  ;u0ale mieiyd mDua( o (4altnir ty1lpDrai ol(0 rtoir3iu4ame lieil()arrm(r oo4opxnif3ildfs umnmpnt)trxoxfcta1la  an i (0tetm(mpno1al e ict (  2ua(m ;t1tetoioeiyd aDrl( o t)aetnmf ootoaDeaivs;()texmimpoy1lle mneilsf 2raumont0tetnioeild m2umn s;()arxrmf3oy1fpDeauei t) rtr(r3ou4olenlfcsltf 2uaxm nu0ope  fctyslm2rmumo ()teenmf3iatlm elu s s0trxrxrpio1lp nmnei sfs2um(moot1tleo fciatfm rmuvon(0artrmr iadlaDrlnvol(0 rxr(rpiodopenmiet s)s2ra(m ;u4aet mfeild mDrl(mpnu4alenmrciytfmDraivi s  exo(r nydlm emfei tf rtmum ou1tltoiiciysfs emn s u4altoir oa1lm rauvi s0sexmxmpou4apt lnvils a2rru o;t0oet if3tasla el(mo u0trxoxf ootoaD aues;t)texo(m3ny1ape lics t artmum nt0tetoifeiytlm eanvs;u4arerir3to1oa ran s;s)s2xmim iydoptnlici t)arrmu  nu1aex  fciydla2em( p;(0trxrio3oo1faD  neo;t0 2tmio nudole  icta( aDurxmoou4alt mi3iytla2elnms (4tltrxr3tatfa  lnes;s  exo(r3iudoptnmfvtls aDumurono1aeto oeildla ulump;t4alerir3ootfp rai olt) 2trir iu1aleemfcil()a2tr(rp;o4teeoifctad m elu o;t)treoif3oo1fa  an ils0teur(rpou4apee fei t)a2urx p;o0aetniieiys a rl(vpnt0tlxrmf3oydomDe n i t)setrio3ny1ap   fvil(faDtm(  ;o4tpx  i3ildlm2emuvo;(0alermo oytlpD lies;s)sexrir nu4ll nlietl(f rtaumpot4olt  ieiyd m ranmp u) exnmociytlpt au o;s0 eto(mpoy4apenlnctls)s2raxmoot1tlx  ociysfm2rl(mpnu)altomr3todla eai i;(  2xo(m3nydopt  iesat)aDtru pnt1ape mictytla2rau p;t)tltnio3iodlmtr ivsls)t2tmim3nu1lltnlnciat srrr(  nt4aee  i3tadls2ulumpn()tltnmrciydfaDeli s (0seumxo iudaptelnvs s)srur(mpno0tpt mi3iasfm2uan onu)aexrif oy1lmDeanes t sexmio oo4olenmfviat)srua( pno1aetn ietltfmDelu pn(4aeeoxrctotla  auvi s trxo(o3oo4ll nlnei sfa2uax ont1oeen oeiaslsDeanvo t0trxrxr ta1opte n il(0t2xmxo3io4om nmnetat)s2rmxm oo1oexnmicild sDrau p u0alermo3ootfate u i () 2uoxm3iu1omtnmfvta(fsDrmxmpnt1aptn fciad m2rmnms;t0tleoxf3oydom   ivil(0teuoxrpio1ap  lfcs s)aDtmurp;u4tlt  f3iat sDulumo;t0 rtomf3ia1lpDraies t)trtoxopno1ll  licsasfsrrr(m nu4olxo ieiyt a ulnmp t4 rerxf iatop  auvo s  2toir3nu4omenmnviltfaDrrxmo;t0tle ifciltls rl( p;(4 exomf3ta1lpDelu s;t s2tmxr3ou4olenlfvsls  2uaumoou4opt io3ils m2el( snu4 ltomrciadfp   nvi s) 2urir ny1ale  nesa()aDum( pot0aptnmi3iat mDumnms (0alerio oytomDe i i;t)setr(m3iu4lp nmfes tf Dtr(mpnt0alen ieias aDuan onu)trxnmfctadfat  nvols setm(o iudop  mncsltf rumx  no1alt  oeiltlm2emn pnt0aleoxfcty1lmD  ivi (  rxoirpny1aleelfcsl()artmum ;t4olenmfeiatlm2em(vonu4 etrxo ia1omDrai ilt)sruoxm io4lpenmietas)aDuau pou1tetn f3iltfaDuln s u0alenif3oydom  luei ()s2xoxopiy4ll e net t)arra(  nu4texnifctydla2um( pn()tetoif iodoptr nei;s  rxrir3ny1lmte ies t  rrr(root0tpxniieiadlaDemums;(0tleoxo3iytfm ean sl( s2xoxr3iudoptnmivsl() ruax  ot4tee mfcilt sDemuvsnu4trermf3iytop  ln i (  2um(m3no4ll   nvia(  Dtr(ronu0tpx mfciatfs2emnmp;u) eermf totomD lu slt texr(rpiu1ll elncia( aDua( oou0ole mo3tatfsDumuvs u0alxrifcio1lm e i ols) etoirpio1lmt mfeiatf rtaxront1tpe  fciydla2rauvp;t4 ltnir3tadlmDeaivs s0setmimpoudap nlfvs tfs2tau pno1oeeoifciydlmDeauvo t) exniociadomDe i s;(0texm(o3io4am e ici t aDrm(m nu0apxn iciatlsDumuvs () exnmociatfatr uesl() ruo(opny1llt  fvsa()arur(mpou4tee moeiaslsDumumo;u0tltnxo tadlmD lnvsl(  2uo(opnudopeelfvtltfsDtrx onu4alt ifeiytfsDulnvon(0alxomf3iatfmD ai ilt)seuoxr3oo4amen fct (fsruaxrpot1aexomociltfsDuaump;t0teeoxrcoatfm   ivsl()srtr(mpoudlltemneslsf rra(  no0opx mf3iydls2uaumsnu)altrir3oytlmtran i;s)s2xrimpnu1om nmfvils aDtm(root4ale mi3iltfs2rmnvo (4aeenxo tydlpt auvs;s0 etr(opiu1ol  mncta( a2rrx p;t0tlx mo3iadls2rlnmpn() ltrmocoo1omDrlu s;(0 rto(o oy1al   iesa(  2uaxmpot1tlx  o3tldla2emnmon(0alxoxfciatfa  lnvslt) etoir io4olt lfeia(  2rmx  nu1alen feiltfmDuan p u4tetnif iytfmDe u olt  exoxo3nodol   iesl(f rumxmo;t1tpt iicilslm em(mp;t4arenxo oodoatrln i;t)s2to(o3ou4omtnmies (fsDuaxm nu0tetnmfeiydfa rl(mp t4arenxfcio1opDeln o t) exo(r iy1lltemnvsltfa2umx ont1tpxn ictasfm rlnmo u4 eermf3tytlm rli o;t) rurim oodll elivils  2trxrono4apeoioeild s elu s t4 exrxr3iadlm e nvs;s trurio no1ap  licslsf 2rmur ;u4tptn octyd mDeln o;t0teeomo3iotfmDeln sls0s2uoirpno4ome micia()s2tmu p;o1alxomi3iat a2emuvo;u0 ltrmocoatfaDe ues () 2toxopno1lm e ictas)sruaumpou1tptnmociyd s2rm( s u4 rerxr3iatlm eau o (0 2tmxm3iudlm eliviasfa2ra(mpnu0optoioeilsfsDrmn p;(4aetoxr3iydopD an ol(0teuoimpiu4omeelivt () Dtru onu0tpxo f3iat a ean onu) lxnxf3ty1lateanvolt)t2xrxopnodoptnmnetl(f 2uax ont0apt ifciyt a rauvon()texoif io1lpDraivo;s) 2trxr3iudop nlnetatfsrua(m ;o0tltnif3iatfmDea( o u4 rxnif ia1lm elneo s  etoim iy4aleemfctas  2tmxrpnt4apx  o3tatla2eanmsnt0aetoifcoa1fat  n o t  2ur(mpoy1opt  ivi () rrmxmo;o4apt iietytlsDemuvsnt) leoxrcio1oa rli i;()s2tmir iu1op elies tfaDumx  ;o4opeomietlsfaDua(vp;t0tetrifcoadomDeau i;()sexm(m ou1lpeemfvtlsf 2rrx p;t1aexn i3iytla rlumo;(4 lenmf3iotlmDr u s;() 2xoio oy1aptnmfci t  rrr( o;t1oetnmf3iyd m2umnmp t4 eermf oa1opt aivil()trtoxr nudlmen iei s)arrmu pot0aleomf3tld a2raumo;t0tleriocta1opDr uvi;s)s2trim3iy4omt lfctasf 2uau oot4oeeniieiadfsDulumo ()alenmf3tatlmteanvo;t0t2toir iudlm n fci s aDtaumooo4olxn f3tlt a2emnvsnt4 rerif3oydfateluesls  ruoxo3oy4op nlnciltf 2ua(rpoo4aetnmi3tatlsDum( sn(0tltnxocta1lmDr n i t) rxoxrpnodalen ncsa() 2urxro;t0optnif3tys sDuanvp u4alenir oa1lmte iei;t0texo(m3nu4al e fesatf rtru ooo1tlto o3iltfs ranms t0 rxnmrctatomt anei;( texoir no4aleelivi t sDrmum oo4alx  feiys sDemnvo () rxnmr3iodfateauvo t  etr(m iudop elieslsf rur(rp;t4open fetadla2umu pnu4tltrxf oydoateaieo;s)setmim3iodlpeelfvi tfartmxm oo1oexnmfetatls umnmo t4artoif3tydla elu ilt0seto(o ou1lmt mivi t a2urxr nu0altn i3iysfm el( sn(0trtrxfcoadlpt lnvo s) euo(mpnudll nlfvs sf 2taurpou4tptniiciatfaDra(mp (4alxoir iytlm eauvs () rumxmpoo1oltemnctlt  rum( p;u4tpx  i3iys m2ulumo;t0tlenircia1fa raivol( t2toir3ny4op e icsat srtmum ;o4aeenmfciltlm2rlumpn(4 eeoir3ta1oatr u olt) etrxo3iodomenlivia(  2rmum ;u4tlxomictas s2ranms ()treomr3iytoa eau ilt  exmxo no1olte ieiat)srua(mpnu0tetoifctatfaDum(vs t4alenifcty1lpDr u olt) rxr(rpoo4opt liei tfsrtr(rp;t4tpx mo3tyt s eaumpnt0 rtoxrcoo1oa elnvi s trur(mpou4amtelfvia(f 2rmu  oo0oltomoeiatls ra(vsnu4aetnirctotfateaivils) 2trxm nu4ap   fvt s) 2tr(rpou0opeomfeiasla rmums;(0tlxrio to1fpt aueo t  exrim3ou1openmfcsl() rumx  ot4olt mfeiltls2rau p t)tlxnmr3tytoa rlnvo;()t2uoio3oydolenlivsl( sDrr( o;o0tlenmfetlsfa rmumo t)tltnir oytfmt luvo s0t2xmirpio4al nliesa()aDtaxrpno4opt iocilslm2rlnvp;t4texomf oa1om  ai ils0 eum(o iy1am emfct ()sDtaxrpnt0opt mf3tydfmDelump t0 eermrctodfmt lies;()t2xo(r3iu4lp  lici ()aDrm(m ;u0tetoifeiydls eln o;t0texoir3oo1om eaneols  2to(opoudlmtnlfci t)a2ta(ro;t0teeoifcildfaDraumsnt4aetrxfctytfmDe uvo t0t2ur(o oy4lpee icil(  Dumu  ou1apx  oeiys s2ul(vo;t4 ltrmf ootoa  anesls tetr(m3nu1olenlnct tfsDtm(mo;u4ole ifctatls2ranmsn(4 leomocootlpteaivil()teurxo3iydaleemneias a2rm( pnu0oltnifciadfmDrln o t)tltrxr iadlm  auei;() ruoir3nydoleemnes tf rrmxr ;o0oleoio3tasfa rmuvo t0 etnir3iytlmtean ils0srtoir ou1ape lfvtltf Durumpno0tpxnmoctaslaDuluvs;t4tlxrir3ta1omDe u i s)trtmxr io1ol nmfct (  rumuro;t1teenif3iytfa2rmnmo;(0tetrmrcoodla  aivilt sruoimpny4al nlieilt) Drr(rp;o0tee iociatfaDrmumonu4aexrmo iodlpD  iesls0 rumiopoy1ol n fvtlsfa2taxrp;o0tet iicils s uluvsnt4trxoxfciydop elueo;s)texoirpnudlp n ieils sDta(root4tpxn octldfm2ea( o;t4 eeomrctotfaDraivs;s  rxrim nu1ol n fvil() Duax oou4teto ieiydfm2rauvs;(0 reriocoo1lpD lues;(0trtrxr3nudoptn netl(farrax  ;u1tlxnmi3tydfs2ulnmo;(4 rxrxociydfate n ol( tetr(m3oy1aptemncslt)srrr(m no4altoiieiysfa2uau s;u)texoif3to1omDr ieils) 2uoxr oodlp emneils artrurono0open ociatfmDrm(vs;(4tltnir3iy1opDeai il( s2xrxo nudape liviltfsDrrurooo1tltn ictyt m2elnmpnu) rerxfctydfatrlueol(0srto(m3ou4optn ivt s sDumurp;u1texnmi3tasfaDuan snt) reoxr tydla rlues;t0t2uoxmpnodaleemnci () Duaxmoot1tpt mictls a rlump t0tlermrcia1fmtelu i ( tetoiopno1amt  nct s)s2uaxmont1tpto ictad m eauvo;u4trtniocto1op r neols  rxrir3ny4op  lfetas)srtm(mpou1tptn o3tyslaDelu pnt)alxnxocoatlpDr n o t tetrir3no1lmee nvs tfa2rrxroot0tleo feiltfaDum(vs ()artnxf3tydfpte uvs ( s2xrim iu1ll   ncsat)srta(mpoo1apxn i3tad sDuan p;()texnxr ia1oaD  i i s0s2xm(mpoo1amee nvt sf rtr( poo1opt  o3iat a ra( o u0tleomf3iydopte i i;t t2urxopno4llenlncsat) rum(r oo0tpeoii3iaslmDuln p;u0tetoxfcoadfpDeaues;(0trxoxrpou1ap nlfei ( arrauroot0tetnioeiaslsDeln on(0 eenifctydoptr ies (0srtmxr oy4ol e nvia(f 2ururoot0aet  ieiyt m2rm(vsnt)arermfciatopD aivi (0sruoxm nu4ale  icilt aDtru  nt0olenmf3iytlaDrlnms t4alxnxrctydopD ln i;t  etriopiy1lp emfetls arurxr ot4tpe  oetltlmDuln s u0tlxrmf3iatoa elieil()trtm(rpnudlm  mici t sDumu poo4altoio3iydls2ua(mo;(4trenmf oa1fm  anvs ( teuoio3oy1omte ncs t)aDtmxr nt1aeeomfetatlaDuau snu)artrxrcoatoat liei;t trxo(rpnudlmee fetat)aDra(m no0openiicilslsDuaumont)alenir3oodomD au s ( srurirpoy4olte nviatfsDra(rpno1olxnmociltfm ul(vs u)aeeoxrctadfa r u i;(0srxr(r oy4alt lfcsl(f Dtmu pou4oet ioeias m2ul(mp t0trxrmo oy1fmDe u ols texoxo nudope lneil()s2uaxr ou4aexoiicilt m ean s u)trxrifctodfp   uvo;s0trtrxopio1op   fvsl( srtmu  nu4oltn feiadlm2ua( s t)aexnmf3io1lp e n s;s)srxrim ou1alen netls)sDtaurp;t0tet  o3iytfaDrl( o;t) eeoir3tytlm r ivs s)srxm(m nu1optnlfcslt  2uax pnu4oeen ociytla eln p;u0aeeomf3oodop e nvo;t) rurxmpoo1ap nmfetl()a2tau  no1tetnmiciltlmDra(vo;u4 lxoxoctotfatelues ()s2urirpio1am  lict tfaDum(  ou4tptnmociydfs ulu onu)arxomf to1fa  ai i;() 2umxm3iudol elieils)sDtm( oou1opt  ociyt aDrauvp u)artoirctydfatrluvs s  2umxr io1amte nvt s)s2urxrpot4tltoifeiatfs rl(mp u4texrmrctadop rlivi;( teurimpou4aleelfvt s arrmxroot4tetoiietydfa2ul(ms (4 exrmfciy1fp rai sl( srxo(opno4lptnlnct sf 2ur( p;t1apx  i3iadfaDea( pn(0 eeomf oatopDraneilt teuo(m ny4lp  livtl()aDtruro;o1oexoiociadls2rauvs u4altoif iotopt anes t sexoxr iodomtemfcsl()aDuaum ;o1aexomoeiydlaDelnvp;u4aleomo3totomt  i i t)trur(o oy4omtn iet ()s2ur( ooo4alxomicild sDranmpnu)arxnmf iydopt anvs () exr(o nodlp   netlsfsDrmx  nu4teeoifeiyslmDul(vs u) etnmr3ty1fmDeau s;s)truo(r3oo1apenmici sf Dtm(m ;u0openmieiltfa ua(ms t0 rxrirctadfpDeaueo;s  exmxo io1aleemfvsas s2tmurpno0texoioeiasfs2emnmo t4 exomo3ia1fa  lues t0t2tmimpio1openmietls artmxmpnu0alt moctatfsDrmn p ()texrifctadfm  anvo (0setmir ou1llte ict t  Drrur nu1oeto oetldla umnvp t4tetnio3iotoatr i s () rtoir iy1lltnmiesls  2tau ont0aeenifciasls2ulnvp t0tltomo3oadlpteaueols sexmir ou1apeemfciat) Dtax pnt0apxn o3iatls2ra( s;u4 etrmr ta1faDrln o;(  2xmirpnudlmtn nctlt)s2rrumpoo1olto feilt m ranvp (0aexrmr3iotfmDrli sl( srtoimpio1omtelicil() ruaxro;o1opt moeiyd a2rauvp u4treoxf3iydfpDe nes s)srxo(m3oo4ol elnvsat  Dtmum nu4tpxnmfciadlmDumuvo u4arenxrcoatfmD luvolt  exoim3iy1ame lncilt) rtmx ono0tet iiciysfmDel( s;t0aetrxr oo1oatrliesls)sexm(opoudamenlfei sfs2rrx poo0aetomi3iat a2rlnms;(4arxomr3tatomDrauesl( srtrirpnu4ll emivil(fa2umxrooo1tetnmfeiasls2eluvs;(4aexnmo tytfaDrauvolt0 rxoimpou4om n ncilt) rurxro;u1tlenmi3iydfs2ea(vo t0trtrxr oy1oat lu o t0t2xo(r3no4alenmiviasfs2rmxr ot4tpxniociyd m umu o;() etrmo ta1fptraiei t teuo(opoy1lm   ncia()aDtaumo;o4oleoif3iltla emn pnu4trerio3oo1lp eai s s)sruoxo nu1om  lics (  rrm(m ot1olt mociasls umu p t)artomoctadomDranvs;()s2toimpoydol   fcil() 2ta(mpoo1oex  feilt a eluvs;t4trxoir3ty1fm r ieo ( seuoim iu4lmtelnvsl( srtmum ;t1teen i3iydlsDean ont0 rtoxf3ootlaDe uvilt) exrir oo4lpeelnei s srtaur no1tltomicilsfaDrl(ms () lxrif3iodlaDeau i;s s2um(o3io1omte feta()arrm( o;o1aptnifciatfa2ranvpnt0arerir tytfp r n o;s  exm(r3oydapenmies s)arumu  oo4ole  feildlm rmu o;u)trerxf3tytfpD ai ol( t2uoirpou4ol   nciat a2rmx  ;u1olx miciltlaDea( o (0 eerio iotlaDelnes;t sexriopio4ameelnvsl()a2rru p;o4tptn icildls2rm( pnt)trxrmrcoo1laD ai o;() rumxm oy1oltelict s  Dururp;o1opeo o3ildlsDem(vp u0 ltrmfctadfm ran s;t  2toir oydape micil( a2ta(rpno4aex mfeiysla emnvo u) lxrxociy1laDrlu i;s  2xo(opou4al nliet ( a2taxrp;o1aex  feilt m2emuvo ()tltrirciytlat livs;s)teuo(mpoydll emfes t sDumx ooo0aexoif3ilslm2uanvsn(0tlenir ta1faDeaivils trtrimpnu4op  mnvs ( s2umu p;u1olto feiyd s ua(vpnt0areoxo ta1fp elies;(0 etmxm io1lp  mfctlsfsrtrxmonu1tptoiiciydlsDean p;t)texrmfciy1oatrluvols0setoir3iydlp elnvsa(f 2um(mpot1tpeo ictatfmDemu pnu4altnxo3oadfa  li ilt)seumxm3io1apeelnvi s)a2tr( p;u4oeto icias a2ulnms;u4altrif3iadfate n i;(0 rtoxmpiu4al   nvtl( sDtax  ot4aex  f3tysla ua( s (4tltrmocoadlm eanes t)srtoxm3oy4ope  fcsa()srtru  ;t4teenmfciasla2ea(mp;u)texnmfctadlpt aivol(0 eumiopnu1lle mfvsatf Dum(mp;t0opeoifeilslsDemumsnt) rerir totomD auvsl(0sexm(m ou1om  lnei s arumur nu1olx mietydls ulumo;u)arxrxoctodlat lnvs t0 rxoio oo1am  livtas)s2rm(moou1olt mi3iyd m rlnmo;u0teermrcoadfp rlnvslt) rxr(r nodlp e ncias)sDrr(rp;u4ope  o3iyslm2ua(vs (0tetrmr oatfaD lnei (0 eurxm3nodam emivias  Drm(mpou4opeo i3tad m ea(mp;u4 lxnmo ty1fpt auvsl()t2xr(r iu1ll e ieiasfarrrum ot0opx mi3iyd m2rm( o;t4 rxnif3oa1lmteauvs t texr(o oy1op nmnet s)srumxrpou1oee mociatfs2rm(ms;u) leoircta1omtelivi;t0 exr(mpoo1ap  lnvi (f 2trumooo4aeto o3tatlaDuau o;t4trermf iydlm r n ilt0 rxm(opoo1altn fetl()s2rru poo4tpt mi3ild a2rluvpn(4 etoifcoo1lptraivil(0 euoxr ny1alenlieiat) rra(ro;o0tlxn i3iasfa uluvo (0 leomf3oo1fa rlnvo (0texrxrpiu1aptelncslt  Dtm(r nt4oex mf3tlsfmDean p;t0arermo io1lp  lnes;t srto(r oy4lmtelnvia(fsDtrxmooo0tee  ocilsfmDuanvp u0tlenir tadoa ran o;s  rumiopoo4ol elfcta(fa2tm( pou0aetnmf3iatfm2ua(msnt) rtoifciadfaDr i o ( seuoxrpoy1oltelieiasfs2um(ront0oet micias m2el(vsn()tltnxocoadfmDelies t teurxr iu4op  mivslt) Dtaur ou0aleo ociysla2ra(mont0arerxocto1fa rauvil() ruoim3io1lltn ics s  Drrum ou1teeo oetldlm ulu snt4tetoxf io1om   i s;t)s2trxmpnodomt mivtltfaDrmxr ot1aet miciydlm2rmn s u)aetoxr3ta1lm   ieil(  2toio no1lme  icslt srumx  oo1olxo oetydfa2rlnmp;t4artrxf3iatlmteau i t texoio oy1apee neiat) rururono0tpenioeiadlaDul( s (4trtoxf3oodlmD livo ()t2xo(r3oy1alte ncslt aDra(m ot1oexnmfciys m um( p;(0artnmo3io1lmDeauei s0t2tmirpno4lpen fci ()srtmurono1oeenmf3tydfmDrl(vsnt4trtrmr3tydla  li i s t2xm(r iydol e fcs s)srurxro;t1aeen ictysls umumpn(0aetomf oodfm eaiei;s)setm(o3iu1omt lfvs s  Duau pnu1oexo octatlsDelumon(0tlxoiocio1lmDelu i t0 rur(o3iu4amtemiviat)a2tax o;o4tptomociys sDeluvs u4altoirctadlptr ues s  etrim nudlpt  iet s srrax pot0tet mf3iadfmDulu p;u0tltnxf3iy1opDe n i s0 2tr(o nydop  lncia()s2rmxmp;u4aee mociytfaDeauvp;u4tetrxr3oadopteau s;t seuoir iy4lm n ictl( aDur(mo;t0tpxnmociad m2uanmo;t0altnxo3oy1omt livs ( t2uoio3no1lptemfesl()aDuru ont0opt ioeiys m rlu s u)alxnxo3todfpD li ilt) rur(mpio1amtemnci s  Dtmx pou4apt ioeiydla2rm(msn(0 rtnxo3iotom e ues ( s2urxrpio4alte nvi tf rumu  oo0oexniiciaslm2ua(msnt4 rxrmr tatomDr i slt0srtm(mpno1omtnlivt s  rtrxm no1oetomoetyt a2umnvo;u0aleoio iytlmDr u sl() rtmim io1alee nvi t srumx  oo4tlt  ociysfm2eauvp;(4aetnir iydopDr nvilt srtr(rpio1om nmnvsltfaDrr(mooo4aeeniiciasla2umuvs;u0 exoif iadlm r u il()texo(opnu4apeelnctat)artmx oou1aleo f3tltfa um( p u)aeeomoctodfpDraues;s0 rxo(o ou4ol  mfct () Duauroou0tptnmo3iatlsDrln s;t4arenir totlaD auei;t  euoiopnudaleemfctas sDrau ooo1oltnmf3tyd mDrl(vsn() lerxf3totlmDeau o t trtoxo3nudope mnvsls)sDurump;o1tex iietltla2uan o u) etrir3iydlptr ueo ()s2toxo ou1om  mfvia()sDta(mpnt1aleomieiaslaDel(vonu0aleoxr3ty1fm eauei;(0s2xr(rpno1ol emnvsl() rrmx  ou4opxniocildlm ra(vpnu) rtnif3oo1lp eaneils  2ur(m3iy4lpenlnetltf 2taxmpot0ape  oeiys a rlnvp t0texnxr3ootomDraies t) rxoxm3no4opt mnes t)artmxmono4oeeomf3iasfa eanmp;t)arermf3tytoa eli i () rxrio oydopt mnetls)sDrr(  oo0alxo f3ildfaDulnms;t)artomf3iadopt  ues;( tetrxrpoudlp   nvsltfa2trumont0ole ioctld s umnvs;()teenir3iy1lpDeau o s0t2tm(r3no1ame liviat s2uaumo;o4ope iieiytfm2ua(vpnt4tetnir iatoptrauei ( sexmxo3nu1lp elnciatfaruaxmo;o1apen f3tld m ea(vs u4teerxfcoa1oaDrli o s  2tm(m3iodopt  ivt t  2tau o;t4teeomfciasfmDran s ()alxrio3oatfmD  i ils0seumxo3oo4ll n iei (f rta(mo;t0tlt  fetadls2rm(mp t0aleoioctydfmD  i s (0 2xr(rpnudam elivs tf rtmurp;u1opt mo3tysfa2um(mp () rtnxo oadfmtrai ol( srtrir iu1lm nmfcsl() rra(rpnt0tpenmf3iltfmDem(vo;(0 rtrifctytlpDeli s;s) etr(rpoy1oleemiviltf rraxronu4apxoifeils a2umuvp t4tleoir3tydfmtrlueslt0 eurxm iodal elivilt)srtrxrpnu0aeeomictytfm um(mo (4trerxo oa1opD au s;t t2to(r nodlmenmics ( sruaurono1alx ii3iasls2umnmpnt0tlxrmociytlat auei;() etr(m3iudalee ieiltfaDrax pno0aptn oetldfmDrl(vs;u4tetnircoy1lmte ueilt)s2to(m iodomtnmicsa( arumu ono0optn fciadlm umnvo (0teenirciodfp elnvol() rur(r3iu1ol  mivilt) rraum ou0oltnmoctld m uauvp (4 lxrir todfp   ies s)s2urxopiudalt mnvil( artaxrpnt0olt  i3iltla2uluvp u0alxoiocoadfpDr uvilt)seuoxo3no1aptnlfesatfaDtrxmpnu0apx  o3iasla ea(mpnu0tetnmf oatomDeanei s  rtm(o3oo4lmtelietl(f 2tmxrpoo0texniictldlsDulumont0tetoir tydfp  au sls  etrxo3ny4lp  liesat) 2ua(mpnu4oetn fciysfs2eau o u)aetrxo tadoaDrliesls sexmxm3nydapt  ncil()arraumo;u4apt  oetat m2emnvo u0 etnxfciadfm rluvs;t0 rxmxo io1lmt liei s  Duaxroou1opeoiietydlaDrm(vs u0tetoxf oytlatrlneils) rtoirpiudale  nesls a2tm(ro;u1oeeoifctatlm rmu s;(0 reoif3tatomDeai i t0 eur(r no4lm   ics ()srrrx  ;t4oeeoii3iadfs2ul(vp t0 eeomoctadlptr neil()t2um(rpnydoltelfctat sDuru ont1tee  oeils m2eln onu)arxnxo oy1fmt aueil(0 rurxm iu4lpeelnes (f 2tau o;o1oexoif3iltfsDea(vs u4tlxrxr3iodlm  ln s;s) rtrxm3no4llte fes s) rrrx p;o0oeen octlslaDrmnvp;(0 ltoxf tytfmtr ivo s srtoiopiy1ll elietas)aDtr(r nu0tlxn octytlmDeau o (0artrxr3ta1oa rlu s ( s2xoxopno4llt  fcs sfs2ta(mono4oee  octldfsDrauvs t4trtrxo ia1omDeln ils0seuoiopiu1ll nmics s  rua(r nt0tlxoif3iatfmDumumo t)artrmr3oadlm eanvs (0t2xm(m3oy4aleelietl()sDrrxrpnt1aex  fciydfm rluvs;u)arxrxo3iodlaDrlieil( trtriopnydomtnlnciasfsDrrurpnt1aet iieiasls2ua( o u4tltnxr oydfpD  u ils)setoxm oydll   fviatfs2umxmp;u1optnmfeiadfsDumnmpnu4 exomrcoytlaDe neol(0 2toiopoydol emfvi sf 2rm(mp;u0tptnmo3iydfm eanvpnt0 etnxo3ia1opD auvo;t) rxo(r3iu1lleemfcil() 2tax oot1tptnmfeiadfs em(mpn(4arxrif3tydlaD an i;( teum(r3iu4am nmict t) rrruro;o0aee iieiytlmDranvp (0 eeoxr3iytlpt anesls texmxmpou4ope lfviasfsDra(mpnt4oltn fciyslm2rau p;t4trenmrctotomt ln o t)srurxmpiydoltn fvi s arraxrpnt0aeto o3tadlaDrl(ms;t4altoxr iadomD  u s s) 2to(m3nydlpte ncsat)srumx  ou1tleoifeiad a2em(vp;(0trxoiocto1la r u ol()srurxr3iy1am nmfcsas aDuau  no4opeoiietasla2rm(vp;t0arxoxo io1faDelu il()srto(m oodlmen fetas sDta(ro;u4alxoifctad m el( s;(0 lerxf iodom eli sl()t2um(r3oydlm nlfesls)sDum(  no1oleomo3tltfa2eanvo;u) exoir3iytop e uei;t0srurxo3ny4ap n nviasfsrta(ro;o0tpt ioeild m2ean p;() etnio3oodfaD li i;s s2urir nydalt lieias) Dtmu  oo4tlxo f3ias sDul( pn() rxrif3tadfmD  ieo;s0srurxo oo1optn ies t a2trurp;o1aptomi3iytls2ean o t0 ltnio3todfp r uvo (  ruo(mpiu4omt lfeilsf Durur oo1oee mieiatla rluvpnt4trtrir3tatomDeliei s)texrim3iy4lmenmfctatfsrrax ont4tptnmi3tatfm eaums t) lxnxo3iadfmDeau o (  rtoxmpoydlm nmncs (f rua( pou0olenmf3iyt s2ul(vp u) rxnmr3tytlp e ueo (0trur(m oy4al e fes sfs2ua(rp;u1apxoii3iadfm2eauvpnu4 etrmo todomDeln s;t)srto(opou1lptelneiat)aDtm(r ;t1ape  f3iad a2um(mp;(0tlxoiocoatlat  nvo;s0tetmxmpnu1lmtn ictas) rrmump;u1tet  octyd s rl(ms u4texnxo iotlm rluvolt0sexoimpnodalee ieiatf rrm(mp;u4tex mieildls emump (0aetnmf3io1fp r uvi;t) exoxopnu1lptnliviat  2rr(  no0apt mo3iytla umnvp;(0aetrio tadomt aieslt)texmxo ou4alte fct t  Durum ot0aexn fetyt a rmu s;t)tltoxr3oytlp  lnvo;(  eur(r3iudopte ivs s sDum( pno4oexoifetatlm2rlnvs (4 eerio tytla eau i s)trxmxopoy1lmt mneil()sDrru pno0tltnio3tatlsDrmumo t0 rxnircty1lm rai i () 2tmxopiu1lltelfeilsf rtr(r ou4oeeomoctatfa2rl(mp;u4trtrmr tatoa r u s s s2xr(o io4ol e iet s s2ur( pot0aetn ociatfs2eln p t) ltrmf3oydlmtr uvs;s trumxm3iu4oltnmfci t)aDurx onu1tpxnmi3ias s2em( ont4texoifcoadopD  iei t0trurxrpno4ll nlfcsa(farrm(rpnu1aetnii3iaslaDrmn s;u)altoxfcoydfatrlu ilt t2urxo oy4opte fetas sDta(mpnt0alto oeiydfsDranvo u0artrxo iotomteln sl(0 rxoio no1lmtemnetasfsDtmxr ;t4tptoifetys m uau ont0tltrif tatfm e nvo t  rumir3no4ap e fctat sDta(mp;o0tex  fciaslsDeluvo;(4 ltrmr3iadlmDraues;s s2xo(o nu1lpt lnesas  2umumoou4aexoifeilsfmDel( s;u0 lxnxociodom eauvo;(0s2xmxr3iy4altnmfvtls a2ua(mp;t4oex mictysfmDeau o;t)trerxo oa1fmD  u olt0 2uoim ny4ape  nci sfs2ur(r no1aetomiciysfs2uanvpn()areoxo oydlpDrluvi;t0 rtr(o iy4oltn nviat)s2raurp;o1tpto ocild mDel(vsn(0teeoxocio1lpte ivo;s0srtm(rpio1al e ici sf rtr(m ;o0tex mfctlsfsDuanms ()tlerir iatfa   uvilt0 rur(m3ny4am  mieil(faDuaxmpnt1apt mfeiyslm2um(ms;t4trtrif oydfmtrlieo ()setrxr3iy4omtemncs sfartmx poo4oleomf3tys mDrl( pn()tlerxo3tydop eauei (0s2urim3ou4om e ivsas)aruaurpoo4opxomociyt a2umnms;u)teenmr3iatlpt  nvs;()srtmxr3oy1ole mivs t)a2trx o;u1oee moeiydfaDuluvsnt0arxnif ty1om rau s;t  rtr(o oudame  ivils) rtaurp;o1optn i3iadlaDrlu pn()alerxociy1opDrln i t texoim3no4lptemivt (f rumumo;u4oltnmiciyd m2ua(vpn()texomf iatopDran i ()tetrim3iy1op   ivsl(fsDrru  nt4aptoio3ilt a2rm(monu) renxo3ia1lmDelu ols) rtmimpio1omtnlfvsat) Drrum no1tlt mfciysls2emn p;(0aexrxf3oy1lmtr n i;s)trxoir nu4omtn neil()aDtrx o;o4apeomiciys s2ul(mo u4 ltnxr tydfaD  nvs;t0setmxo3nu4om emieil( arrr(mp;o4tlen ieiasfm um( on(4trerxrcio1la r nvs t) 2to(opnu1om nlfvsa(fartrx  nt4aexnmi3iydfs2eln pnt4tetnio tytfat lnvil( trto(mpiy4lmen fetatfarrmxm oo0tltnmi3iatla2el( o u)tlerifciydlmtr ies (0srto(rpoo1amtemfctl(f Drrumo;t4oleomieias a2umnms;t) eermf3oytoptelueo s) 2tr(r ou1am e nviltf Dtru  nt4oex ifciyd m2uaums;(4tetomf tatfpt auei;(  rum(m nu4apen netat) Draxro;u0olenifeiysfa ul(mp;t4alxrmo3ootlpDrlu i t  etrir iy4lm  mict (faDrmxm ou0texo octasfs emn p;u0aeenif3tadfmD luei t)s2umiopoo4al  lfctas  rrm( pou1oetniociyt a2eluvonu4aleoir3iy1la elnesls  2xrim nudlme  fctl()a2rr(rpnt4alxnio3iytla uln o;u)aeermoctotlpD lieol() rxr(o3oo1omee fvt ( s2tmx p;o0tpen o3tydfsDuauvs t4 eerxf3iy1om rauvi;s) eumxo oydopte iet s)a2trxr ot0tet  ietlsfs uaump;(4 lxrmo oytoa rau o;() 2xrim3io4am   fctls)s2umu  nu4ale ioctatlmDrmn s t) exoxf oa1omte neo;(0seuoxopiy4ll  lfesls a2raur oo4alt mo3tltlaDumnms u0artrxf oa1la  anei;t)seurio iudll  mnetas a2umumpno0tpe moeildls2uln s;t0tltrxr oa1lat luvs s0 2tr(mpio1openlfvtls)a2rrx o;o1aexomfciytfsDrmumo (0aeenio3oodlatelneolt)t2xmir iy1am nlfeils)arurxr oo4apenio3iadlaDean sn(0treoxf oydfp e n s;s) 2uo(r3oo4ol nmies (f 2rax o;u4oeeo f3iysfmDulump;u4 ltoxr tydopDr neslt  rxo(m3iy4op  mfvia( a2rm( pot0tlenmf3iltfaDrm(monu0aexrxrcto1opDrlnvi () euoxm nu4omenliet () 2ra(mpoo0tpxomfciat aDemnvp (0aetrmfcoydlpteaneo;() rtoio iy1lm emfcsls) 2umur ou4tlt mi3tls sDea( s u4teerxfctydomDeliei;s0 exr(m3no4omee feta() rrrxr ;o1apt ifeiydfsDrlu s;u)alenif to1la r nes;t) 2urir3iu1al e nvsl(  2rru pot0tptoiietld aDra(vs t0texoif tydom rau s;t  2xrxopno1amen ieias a2uaxrpnt1aexoifcildfm ulums;t0tltoxr oytla rlnvs;( s2xrxo oy1lpenlnvt ()aDurum no1tptn fciysfaDemuvo (4arermr3tadfp rlneolt t2tmxr3oudol  mfvsa(fsDuaxrpnu4tlt  ieiltfmDul(vs;u) etrmfciatlm eaueo;t t2xr(r3iydaptnlivsas)sDumxronu1tpe  fetas a2em( s t)tleoircoy1faDr u s;t s2umxr oy1ol nlnvi t  rra(r ;t0tpxn f3iasfmDulnvp;t)trxomr iadlpDeli ilt0srtrxo3oo4olen iet sf rtm(rpno1tltoiieilsfm umn pnt)texoxfctytfpteaivilt0s2xmim iy1lmteliesasf rurxronu0tet ifeiadfa2eln s (0alxrmr3todfpDrli ils)s2tm(mpiodll e neta( s2umxmono0aetn o3iltla umn s u0arxrmr oodlaDe ivs s) 2umiopoy1apeemfvs (fa2rmum ot4tlx moctlsfa em(vs;(4 eenmo3iytlp  anvi;t0setrir iydlpee fet sf rrr(r oo0olx iieils a um(vo u4teenmo3iydom  li ils0 euo(o3iy1ll  lnei sf 2urxront4alx  i3ias aDrlnvpnt)aetrif ta1la ean i s) 2umiopnydap   nvt (  rraurp;o4opt  feiasfm2ua(vo;(0tltrxf3oodfa raieo s0 rumxo3io4al n ivt t artmxm ;t1oeeoifciatla2umnvp;u4 lenir3totlpD li o;t  ruoxr oy1om n fcilt)srrr(mp;t0aetomo3iyt s2el(vs;u4aexnir3oa1oate uvslt srumxo3iu1optnmnvsls)srrm(  ;t0altn fciatlm2ua( p;() renxr oa1lpDr n i;(  exrxm3ny1aleemnvsltfa2tm(rpot1tpxnmieilslm2eln o;u)trermrcta1laDrlivsl( texrxo oodlme  fvilsfs2umum no1tpeoiiciasls ua( p;u) exnmo oytopD  u sl(0t2toxrpou1llenlfct s)s2umur ;o4alx mieilt aDemu s t4 rtnmr3ia1fm raivo t)texrxm iodll  lnvta(  Dumxr nu1oex iiciyt s eaumo u4treomocia1opDe neslt texm(rpno1amtemietls arrru  no4alxomoeiad a2ua(ms;t)altniocoydlp   ueil(  eum(o no1om  mfcs t)aDrrxmpoo1alt iicias a ua(vs;(4trxriocoa1lpDelivo t)trxoim3ny4lpte nviltf Dtm( poo1alenmoctlt sDra(ms (0altnio ta1op  lneils) etrim3oy1am nmiet s  ruaump;o1tpto fciatfaDra( s;t4tlenmfciatfm eai i;t t2xrim iudal e nvs ( sDtr( p;u0tex  oeiytfaDumnvpnu0tetrifcio1lmD ln o;() 2tmxr3ou1lm nlnvilt arraxr ;o4tle  f3iyt a ea(vp;t0altoxrcoa1omt aiesls) 2xmim oo4omt  nvslt)sruaxm nu1tltoifetytla2eln snu4 renxr3oydlmt  ues s)t2urxrpio1oltemnvt (f rrrurp;o0ale mfciltfs2rl(vsnt0artnmrctytlmDr ivi (0 euoxm oydoltelieias)s2umumpot4oexnmfctls a2elu p ()aexrif iy1latraneolt  2xm(o oy4al n feias)s2tmurono0tlxomo3tatlm rmu o t4arxomf3tytomtelueo s0teumxo3oo4am nmnvia(  rraurp;t1teenifetyt mDua(vsnu4trerxo iy1op eaieo t0 rum(o3iy4apenlnctatf rur( ono1tpxoifcild s2em( p;u0tetoxr todfatrlueo;( s2um(o iydll   ieia(f rua(mono4olxnmi3iadla2umump;t0alxomrctatopDrliei;(0t2uo(r3io1apeemictat s2ur(rp;t4tpt iiciydfa rl(monu)trtomr3oydom r i i;t0srurir ny1omee ncsa() 2urx p;u1ole mocilt sDem( p u) exnxf oodlp eln olt)texrxo3ny4olt livsls) rum(mono0tle ii3ilslmDrl( p;t)treoxo tytoat  nvslt  2toirpou1oltelfetasfarra(rpnu0tltn f3iyd s2umn sn(4aeerxo3oadlpt aivslt srtoiopno1om nlnvsa() Dtaum ;u4tetn oeiys aDulu o;(4trxoiocto1om  lu o (0 2uoir3nudom emicsltfsDraxm oo4oee mf3ildlm2rmumsn(4arxniocoydopD  nvo (  rur(mpny1optnmivsl( s2rmx oot4oeeoiociytfs2umu o;t4tetoxo to1lp eanvi s) exmir3iy1am  mieia(faDumur ;t0tee iociaslm umumo ()aeenxr todomDeaivs;t0teuo(m3iy1ol nmnvi t sruru  ;u0olenii3ias a2uan o;(4altnir oodoaD  iei;t)trtrir oy1lmee net tf 2rmu ooo0oeen ociyt s ua(mp u0 exoxr tydopD  n ils  2xrirpou1ol nlici tfartm(rpnu4oex iieiyslaDrmn p u4 rermr ta1optrlneilt)srtoxrpou1omeelfctat a2um(mpnu0opxnifeilt aDelnmpnt)aeenmfctytlmtrlieo s0 etmxm3oy1alenlnvs s)sruaum nu1tetomietatlsDrm(vsn(4trenxr3tydlm  anvsls0sexoir3iydllenmicslsfarrm(m nt0tlxo ociyslmDrau pnu)tltrxocoadfmt  ivi;s0 ruo(opiu1open fvtl( aDum(mpno0tpeo fcildlm eln s;(4 lxnxf3iy1fatrlnvi;s  2uoirpnodam elfvias s2ra(mp;t0oee ioeiasfaDemuvon() etoirciadlaDrlu s t0seumiopoudllt lnci () 2raurp;u0opto oeiytfs2ra(vsnu) etrirctytfpD lu o;s)srtmxm3oy1op eliesasfa2ur(mp;t1tltnifeiyslmDuauvont4arxniocoy1faDeluvs;s  exoxrpiy4ome lfesls)srumu pnu0opeo f3tat mDrm(mo u)teerxf3tytop r ieo;( srtoir oodlp e nviasfa2raxm nt1tetnii3tadfm2umu snu4arerifcoadomtrlu o;t) rxrim3nudole lnci s sDtrxmoot4aeeo ociys m2ua(vs u4areomo3ty1oatelnvolt s2umirpoodam  lneils artau ooo0aptnif3ias a raumo t0tlxnxrcoatopD lu s (0texo(r3oo4oltemnesas  2rm(m no1tpt iietaslm2em(vp;(4 rerxf3iodlm  lnes (0 eur(m3oo1altnliviat)sDtru p;u1apto ictytfm elnmo t)aetoio3tadop  aivi s teum(r oydape mfes tfsrrax  oo1apt moctltlm ra(vp t) lxniocoatlat liesl(0 rumxr iydaptnmfvt s s2rr( ont0aet  o3ias aDelnms;(0altoir3tatop eaueilt0trxrxr iydamt  ncslt a2uaxmpou0tpe mfeiys mDean snt4 eeoir3ia1laD lu sl()sexoxm3no4lmtnlneias  Dtaum no1oeeomf3iytlm2ua(mon(0 lxoio oa1laD  nvi;s0trxm(r io4ap n nvia( srraxrpou0olxo fcilsfaDul(mo u4trxrmo3oytlp e ueo;(0truo(r3oo1am  mnvtl(fs2tmxr ot4optoiociad mDrmump;(0 rxoxociatfptrlnvi t  rurxrpno4ale mnvs t aDtmxmpno1tlxnioctytla ulnms t)treoif3ootfmte nvs (0sruo(o3nodap  mies (fsrraxrpoo4aexn fciys s2emnvont4areoxr3oo1fp ran i t0t2xmxrpoydam  lietls s2trur ot4aleomicildfaDemuvp;u4aeermrcto1lm eli ilt)sexrxm iy1ll e icta()aDua(ront0apt mfetys s emuvs u)trxnio3iatlm eauvs (0sruoiopnu1alen ict (f Dtmu  ;t4opeoif3iysfs elu s t4texomrcoytfpt auvo s)srxo(r3no4olenlfcilsfsrtrxm ;u0aee  ieiasla rm(mon(0 etoxf3ia1lm elieo;t  rur(r oo1al  lfcsa()artaxr ;t0oltn ieiydfm2ranms;(0texnxo3oatfat anei s  rxr(opoodomenmict s) Drau  ;o0apxomfetldfm2umu ont) eermf ia1lptran s ( s2xmirpnydoltn fvia( s2tr(rpnu4openmicildfa2uln s (0treoxocoadom e i o t) 2toim ou1aleelivil()a2ur(  ot4optnif3tysfs2ulumsn(0artoio3totom   ivol() rto(r3io1aptemiet () rtmxro;u0apto ieiltfsDum(ms u0treomrciytlpte nes ( t2tm(m3iu1alee fvsat sDrmum ;t1oexo i3iatlm2emnvont4tetnio3ootlmDelieo;( texo(m3ny1lpt mivtlt) rrr(mp;o1tetnmf3iad a uauvo;(0tleomocoatfm e u i;()tetoxo3oodamenmfvt sfa2rrumo;t0ale  f3iadla umnvs u) rtrif3ta1omD  uvs ()s2xmim nu4optemnct s  2tmx  nu1tltniocildla2emnvo u0trenmr oytfmteln s;t0trtrxm iy1lp nmictls) 2taxrpno0oltnmf3iasfs uln o (0tltomocta1fpteaneo;t0texrim3oo1lm elfvtlt)arrru p;u4aptnif3iydla2uanvon()tltomrcoa1oatrlieilt)tetrxm ny1ol nmfvt tf 2um(ro;t4apxnmociat a2em(msn()alenmr io1omD lies s srtr(o oo1lptn icia() rtmuronu1aetnmieiltfmDem( pnu0 etrmr iytop eli sls s2ur(o oo4llt mfcsl(fsDua(m ;o4tetomoeiatls2ua( o u)aeermrciatlm e ivi t trum(o3no4lptnlietasfsrrax p;o0olxomo3iydls emnmont4alxoir3totlpDeau s;s) etoxo3iodlmte fet s) rur(r nt1olx  oeiadfm2uau pnu0 lxnmf3ia1oaDelieol()t2tr(r nydapen neiat)aruax o;o0opx io3tasfa emums t) eermo3ty1laDe uei ()sexrir nu1lm nlneils arrm(mp;u4apxoifciatlmDeanmp;u)trxoxr3io1fpD an i s0s2tr(rpio4om emnvsat) rtm( o;u1ole mieias aDeluvsnu) rxnxociodoate ivi s)trxoiopiy4lltnlfviat)sDta(ro;o0opxoioeiytfs2rlu snu)aexnmr iydfpteln o;t0srtmxo3oudalt  ncsasfsrum( ont4oetomietltfs ul( pnu4aexoxf io1fm eanes ( tetrir3nu4ll nmfctasf rta( pou4oee  oeiatlm2rauvp;t0 lxomr oytfmtrlneslt0s2uo(m ou1lme mfct ()aDtruroou0aeeo oetadfaDuanvont4arerif oatlpte ivils) rxrio oy1am  lfesatfs2ur(mpno0teeo o3iydfmDelnmp (4 lermocoo1om eauvols0trum(opiy1optelivias)aDtmumont0olxo o3iysfs umu s u4altnifcto1opDrlneils) etmim ny1amtnmfesltf rra( oou4tpxomieiydfs2rauvo u0tleriocty1fpD  i i s texoio nydal elics s aruau  ou1tee iieiatfaDum(vo;u) ltnxf3iytfmt  nvi;s0 rxr(r3nu4lme lfesls) Dtrx  ot4ole  octyt m2elnmsn(4texrxrcootfaD  u olt0srumim oodoptnmnvs sf rrrur oo0alx  f3tysfm2ul(vo (4tlenmoctydlateliesl() rxmio oodoltemivsa(f 2urumooo1alx  octlt sDrlu p t)treoircta1fat  nvsls  eurxo nydlle mfet s) 2uaum ou0tet mi3iysfm2ra(vo;u4 rxoxr oatop eluvs () 2trxmpiydol e nvsl(fs2urumooo0olx  i3tyd a rmnmont) exrxf3oatom  aiei;s  2tmirpny1omt  ivt ( s2rax p;o1tpxoio3ilslaDul(mont) rerir3iy1fpteluei;s texmirpiy4oleemfvtlt)aDumxrpoo4alt mi3iysfs raump;u4tetrircto1oaDr uei s)sexmiopoydlp  lfcsl()srta(rp;o4tpen o3tysls elnvsnt0tltoifciotlmt  u o;s sexrxo3ou4lpenlfctls)arrmur oo1opeomfetlslaDumn o;t4treoif tadoate ieo s0 2xoxo3iy4apen fvs t srtaum ;u0oleo oeiyd s2uau o t0 eenmfciotlmDr ieo;t s2trim3nodape mnctl(f rtmumo;u4aleo ieiysfm emump t0alenxr tytopte nvs;t) exo(o nu1amte icils arururpot4oex ioeiadfs ranmo;(4tleoir tadlp  an s s s2tm(o iu1op  lfetlt s2umu ono4texnmiciasfaDrl(msnu)arerxr3oatlaDrln s s0t2xoim ou1opt lnvilsf 2tm( o;u1aexo ociad a2uaump;(4altnmfcio1op ran s;t  etoio3nodap nmncsa(fsrur(mp;u0alx ifetyt m2eln s;u4alxoxf3oodoateauvilt  rto(o oo4lle mfes t)a2umx  ot1aetn feils aDem(vp (4trtoxo3iydlat  n i;t0 exr(m oy4omt lnvt ( a2tmxmonu0olenmoetydlaDuluvs;u) rtnirctydomDe ueolt  eurimpiodol n fci s)arumur nu0oeen fciysls2ea(mo;() etrxr ty1fate n s t)tetoxr io1amtnlivtat)srta( pnt1aexo iciyt a ean p u)texnif3ty1oa elieslt  2to(m oy4al n ieilt)aDrmxr ou0alt io3iysfm2uaump;(0 eeoio3io1fm r i s t0trtr(o3iydlm emivslsfs2rruroou0tleomfciasfm rau pn(4 rtoioctadoaDraneolt0seto(o3ou4ll e fet ( s2trxmpou0oexoiieiasfs2rmnvpn(4 lenmf tadfa eli ils0trtm(r3ny4ap n icil()artax pno0ape iieildla rauvpnt)texoif todfmteaies;t0sexoxr3nu4llt mnvsl(fs2tm(m ot4tex mfciytfs rmn p u) lxnir tatfateaivs s t2xmxr3oodll elfesat) Dur(r ;t4tpx  fcildlsDrauvs;u) renmfciydfp rauvslt)texrirpoy4lp  lfvtl(farrrxm nt1alenmfcildla2ea( on(0treomr3iytoate neils texmim ou1altemnei () Dur( pnt4tpt mfctlt a2em( pn() lxoir tatfmte i ols s2xrxmpnudllte fvils) rtrur ;u0texomfctldla ran p (4 reoir oy1faDr iesls0 rumirpiodoltemfvilt)sDur(rono4alx mfeiltla2rm(vp;(0trxnio3iytlaDrauvs (0teur(mpou1lp nlnesltfarrrxmonu1tlxomociys a2eln o (4tlxoif oytom eln s s setrxo iodaleemicsa() rtmu  ;o1tlxnmiciytfm2elump () ltoxo ootlaDrluei s0trtoir io4om   nesls srrau  no4teen ieiltfm uanms;(4 eerxo3oydopDelu il( t2tmxr3ou4ol   neia() rrrxr ;o4oetnmocildlsDem(mp u4texnmr ootoat au o t)t2tmxr3ou4al elfvi tfa2ta(  ;t1opx miciasfa emu pnu)aleoxf iadop rlnvil(0s2toxopoudaptemfeiat  rumu  ;t1tpxomoeild s2raums u0aetrio3to1omtr nvil()seurir3nodll  mnctlt) ruru o;o4oexnioeiasls eaums;() rtnxf3todoatr i ol(  rto(m3no1lp n icil()sDuaxroou4openmfciys m2raump;u0alerxf ty1fpD  ies;(0t2xo(o ou1amtnmivta(fa2tmumont1olenmo3iys m rm(vpnt4 leoifctodlmD auei;(0s2tmxm iu1omte ics (f rtmurp;u0aet io3ias sDea( s;(0teeoifcoydlpD lu i;()tetoxo no1lmenmncsltfaDrrx oot4tee moeiltla2ua(vo;(0aetomf ty1fat  nvo;s) etrxo no4omenlfetl( arumxmo;t4olt mfctyslsDua(mo u0tltrifcto1lpDeli ol(  rurxr no1apt mietl( aDtrx ooo1ape ii3iltfm emump;t) etrmrcta1lp e ivolt)texoir oy1ol elfcsas artmurp;u0aptoiociltlm2ra(mo u)texrxrcia1lmt aivs;s)trtrim ny4lme lfvt ()s2ururpnt0texoifeildla emuvsnu4teerxocoydopt ai s;t)seum(opny1ap nlivi tfsDta(mp;o0aet mi3ilt mDrl( snt0 ltrxo oatopt li sls teur(r3iu4lpenlici ( sDtr(  ot4olx io3ils a ua( pnt4aeeoir3to1lmD aieil()srxr(m3nydlmtnmicil(fsDuau  no4tltniieiltfm rauvsn(0 etnxo oa1f
\ No newline at end of file
@@ -0,0 +1 @@
+iesls) ruoim io1ope  nct () 2ua(rpnu4alt iicias aDrmnvo;()altnxocoytoatrau s;()s2tmiopoodopeelfcs sf rrmxrono0alx iictat s2rlnms u) rerxrciatfpt aneo s) rxmxr3io1om  lfcslt srumxr ;u4apeomfeilsfm2uanvo;u0tlxnirctotfpD auesl(0texo(o3no4omee nvilt  rtmu pou4tlen ociadlm2um( p;t0tleoircootoaDranvi;s) rtmxo3io1amt lfesas)a2tr(rp;t4aeen ieias a um( s u4trxnxf3ty1fmtr u o s0 eurxo iydlm emfviat) 2ur( p;t1tptnifeildlm eluvsnu0tleoxr tatla   ueo s  2xoxo3iu1alenlnct tf rtaurpno0tet iociys a rl(ms u0 eenxociydlaDeluvo s  rurio3no4om n ivia(fsrrrump;o4oleo fctlsfs em( o u4 rxomrcta1lpDran o;t t2trirpiodalt mictls)aDtmxmo;t4tleo ietyd s2umnmp;t4tlermfciy1lp rln ils0 2tr(o3iy4lme  fes t)a2tau  ou1teto ictltla2rlums t0aeenmo tatlat  n i;t s2xmxo ny1apt mici (  Dtrxrpno0oeenifeiyd s el( pnt) rtrir iadla   nei t)trtrxm3ny4om nlivilt) ruaxmo;u0alx ii3iyd a2uauvo;(4texnxrciodfm  lu i;t)t2umir3iu4apenlnvt tfaDumx o;o4tpeomf3iad sDul(monu0arermfciatlat li o;s teto(o3iu4oltnmfvtlt sDrr(mono1oex mfciysla2rmu o t)areoxr3ootfpDelu s;s) etmxmpnydol e ietatfsrtmu pou0oeto ociatla eanmo;(0arxnxfcty1fa rlieo;( srxr(o nudlptelici ( arrrurpou4opeoiictldfaDrmuvp ()alenif3tydopDelivo;s  exmxrpnudamtnliesl() rua(  ;o1altn oeiadfmDulumsnu0 etnir3iatlptrlnvi s) 2xrxopno1optnmnvias) rumum ;u0oee mf3iad mDea(ms;u0 lxrxocto1omtr ivs ()srtriopno1al  lneiltfsrururp;o4olxomo3tadls2emu sn(4alxnxrctydopDraiei;() eumir nudaltemnetls) Duru  ;o4teenmf3iad sDel(mp (4teeoir3iotoateanes t t2umirpoudomtnlfctas  rra(rono1altoioeiltfm emnvon(0teeomr oa1fmD luei;()t2uo(o3oy4omtelfci tfsDrax  ;t1aetnmfciltlsDulumsn(0altrmocio1lmte u slt0 eumxmpnu4altn ncil( a2tmurpnt0tltnmo3ilt mDeanmp;(4altomr3tatla e ues t) exo(m3oodomtn fvt tf rrrx  ;t4aetn iciytlsDra(mpnu0aexnmocta1omD  ueol(  rto(r3no1am elnctat s2um( poo4aexo f3tlsfm eau p (0texnxr tatom eanes;s s2tr(opiu1altnlicia(fs2raurp;t1aptnifctytfm emn o;t4 eerxrctotop   i o s)seurio ou1lmtnmfcsa() 2tm(rpnt4apenii3iad sDulnvs ()tlenmf3iodfpDelies;t0 exoxopiy4al e ncias aDua(rpot4ole  icias m2rmu s;u4tetomo3oytlpD lu s t0 rtr(mpny1lmee nci tfa2umx p;u1ale ii3ild aDuanmonu0 lenmfctytoa ranvil(0trumxrpoy4om n neias  Durur oo1tlx mo3iaslmDrauvont)texnir3iotla  liesl(0trxo(r oo1ll nlfes s s2rrumpno4oetomieiatls2uauvp;u0 rxoiociodlmt anvo t0tetoxr3ou1ap nmnes (f ruru pou4alxn fetas a2umu p () rxnxf iytoptrai ilt0srxo(r3oy1am elnvtl() Drmumpnu1oetnmi3tadfmDrlu snt)aetnmfciytfa ean ils) 2xm(r iodlle mivtat  Dtmu oot4tpxn o3iytfsDum(vo ()tlxrxo tydfpt  nvo;() etmirpno4opte fes (fsrtr( o;u4texomoeiyd sDel(vs;(4tltomrciytomt  nvo;()truo(r3ny1lp nlnvt (f Duaxmoou1aexnmfetatlm uanmp;t0arxnio3todop r uvsl()t2xoir no1opt  icslsfa2rrxro;u1teenmo3iatla ra(vp;u0aeeomr tydopD  uvilt)s2um(r3io4optelfcil(f rur(  ;o4tpxo fetlslmDelums u0 rerircto1la eaues;s  exoxo3no4lmeemfvt ( a2tmxmpou0tetomoetydla rlnmsn(0trxoir3todlmte ivi;t sexoirpoy1om nlnvsa(fs2tm(ro;u1texnio3iytla2rmnvpn(0altrxr todfptr ivi;t  2toxmpoo4omtnlfetat aDrmxr oo0tet iociyt aDuln o t)trtrmfcoytoaDeln o;t0s2uoimpoy4ap e fci t s2rru  ot0tpenmictysfsDrmumont0tlxnxf3oy1fp rlivil(0t2xo(m ou1op  lfcslsfaDraxrpno1tpe ii3iysfmDemnms;(0 lxnmr ootfp rauei () etoxr oodoltnmnet (  2tauroou1oexn o3tatfa el( s (4 ltrmocty1fa e nes s t2urio3io4amtnmnei t s2ur( o;t4apt ioeildfs2elums;u4trtoir totoptrluvils  exm(m nudllenlies s) ruaxmp;t0oexomo3tyd s eaumo;t4trxrio todop  anvilt) rum(r nu1am nlfei (fsDtax p;t4oexo f3ildlm2eau on(4 etnmf oydom  aies;s srxr(r nu4lle mnesatfaDra(m ;o0tlt  iciyslm2eaump u4treomrcootlp  lueo;t t2xr(o no1lm  lfes t sDrmu poo4aetn fciyd mDuauvsnt)aetoxr3oa1oaDeauesl(0tetrxrpoy1omt lnvt s)artax ooo4oetoii3ildlm2rluvonu)alerif3ootfmDeli il(  rumxo3oudop  mnvtlt) ruau pou4oetnmf3tytlm2um( p t0artnmocoatomtrlivslt)setmxr oudlmenmfvtat)aDtmurpoo4texnifciysla uan on(4tlenircoytfm  li s (0trxrxrpno4lp  mfeil( sDta( pno0aptn oeiltfa ean p (0tetrmo3iy1om  li sls)sexo(r3oo1optnmiesasfaDtm(ro;t1tpeoiociysls2rmuvo ()alxnxo tytlaDr neo s srur(m3oo4ap elneta()s2uau p;o1tet  fctlsfa2rau s u0artrmf ia1fa rli o s s2ur(r nodome  ivsat arrrurpoo1tltn icias a ea(vs t)areoxo3tydopDrlueols) rxrxr io4lm elneilt srur( pno0alx mieildfaDel(vs (4treomoctytlaD  neolt0seurxopou1om nmfvtl( a2uax o;o1tpx  ietas s uanmsnu) rtrxfcto1op   i s;t0 exoim3nydom emicsa()srtrumoot4apenii3tyt m ra(vs;t)alerxo iodomt luvo;s  rxo(opiy4lp nlneil(fs2trxrpno4oeeomociadlsDuan p;(0texomrcoytoaDeai i s0trumio oodlmen feil() Duax  ;t0tlen feiyt sDumn sn(4 exnmfctydlaDelnvi ()seto(o3no1lmenmfvs t sDuaum oo4tpen ieiytfs2uauvpnu0 renmocto1omt  uvs;(0t2uoxo no1lpenlncilt srrmxrono1aptn octadfsDuln pn(0trtoxf3tadfaDrlnei;s trumxopiu4lmtnmnvt s)sDrmu oot4olx ioctydlmDranvo t4tlerxo iydfmt anvsls0teto(r3iydal nmivil() Dtax  no0olxniieiltfm ul( s;(4tlerxfciodla rai i;s t2tmio nodlm nmivt s)s2trurpno4oetoiieiat mDelnmo (4alerxr oadlmD luvi;t0teurir3ny4lp nmfeiltfaruaumpot0tlto fetlsla rau s t0altrxo iadlpD aivs t0s2xoim oo4amtnmiei ()srrrur nt1tpeomociys a ul(mp;t0tlxoxo3iotlpDeanei s  rur(m oudlle lnvia(fs2urx  no1tlxnmi3ils a rm(vpnu0altrxo totomDrai sl(0srtmirpiu1altelncsls aDta( pou4apx  ieiytls2eauvo;t0texnio3io1om ean o;s tetr(mpou1am  lfvsa(fsDta(mont0oltnif3iytfa eauvont4 leoif3tatfmD li i;t0texoir3iy1am  mivt (  rtr(r ot4tpx  ieiltlmDumu o u)aeermrctotlm  lies s) exm(o ou4ame lfct t  Dururpnt1tpeoiocild sDranmo;(0 exoxo3todfa rlnvs;t) rxr(mpou1omenlivsl()a2rr(  ou1oltomoeils a2um(vo t)trxoio tydom elnvols)s2xrxo3iu1ap nlfvi t  rurumpnt4alt ii3ildlm ea( o;t) rtnif3oo1fpDrlueo;t  rtrimpiudlp emfcs t s2umu  ;o1alenioeildfs2rln p;u4tlenmo oa1lmt  i slt tetm(m oodol nlnvtat srrr(r ou0oexoifciat a2eanvo;t) lermo to1omD  n i t0 2tm(mpiy4lm emnvsasf Dtmxro;o4tlenifctlslmDel(mo;t4 rerxf oytom  livo;s)s2ur(opoudamtelnei s)aDtmx oot0oleniictadfm rmn o;t0 etomr tatoa rln slt texoir3oo4op  mies tfa2rmxr nt0oeeoifctysla ra( s u) ltnmr3oadfmD anvils)s2tmxo ou4amtnlicsas) 2tmum ot1tleo ietat sDeluvo t4 exnif iy1om rli o t)truoxo io4ome  nesls s2rax pnu0tex miciadlm elnms;t4arxomf3iy1lat  nes;t srur(r ou4lmtnmncs t a2tmxm nt0aetnifeiyt a eauvo;()alxnxf3iydlat  neo;(0 ruo(m oo4omee icsl(f rrmx o;t0oeenio3ilsla eanmo t)tltoxr oatlmt  ieo (0t2tm(r3iu1ap  mncia(fartr(ronu4teenmfcilt a em(ms u)alxrio3iytoa raivs;s)trtmir ou4olenlfviat aDtmu oou0olen ociasfa um(vo;(4arxomr iatoatr nvolt0t2xrim3oudoptemiet s  2tm(ronu4apeomf3ilsfsDum(ms;u4 rtniocoa1om raueo;()srxrirpiodalt  feslt aDurx o;o4oet mictltla2uan s u0altnio iydfmDrlnei ( trxm(opoy1lptnmfvtas sDurxroot4oleniocilsfmDul(mo t)trenxf3tytfpD li s t teuoxm oy1ll   ivia( arurx poo0aexn ictys a2ua(von()aetrxr3iodlpDeai s;( tetm(m oydoleelietls  2rmumpnt0ole iieilt m2el(vo (4 leoir3oydfm eli s;s)srumxopnu1alt lfvias)s2tr(m ;o4altnif3iad a ua(vs u0tleomf3oadoate ivils teurirpou4lp e ivs (f 2rr(r oo1alenmfctat mDrlnvpnt0 rxnmo3iatlateaneo;t  2tr(opoy1lm n ies t)srurxrooo4tpe moctlt m ranvo t4 ltoifcoy1fp  livo s  2urim iu4ll   fvi sfa2taxr ;u0teeoifciaslmDem(vp;t4tleoio oo1opte u i;s trtoio oydlpe livil()aruax ooo4aetomo3iadlm2rauvo u4tltnircta1oatraueols)srurxopiy4ol  livtas artruro;o4tpxniietad m2ra(vo;u) ltrxf3totlat lues;t)s2xo(opou4alt mivs t  Dta(mont4texnmiciydla2ua(ms;()aetnxo totlpteanvsls srurim3oy1ope lnctl(fsDra(mo;o0tpeoif3tasfa rl(mo;u)tleomo iodom  aues t s2um(opoodam nmies sf Drax p;t0ole mfciadfm um(vo (4texrxf tytom r i o ( s2xmxm3nydope  nvt s a2ra(r nt1oex mo3tydlm ulu o u0 exrif oo1la rln o;(0 2xrio3iy4amt lfvil( aDraxmoot4opxo f3tltla rlnmp u4areomo iadfm e ueslt) rtmio3nu1oltemivil()s2rr(r ;u1tlxo fciatls uau o;u4arenxf3oadlaD  n ils)srto(m3oo4ol  lnvia(fsDtau o;t0tet  feiatlmDuluvsn(0 lerirciy1fpDrluvils)s2uoiopiudaltnmnes tfs2ur(mpot4opxo icilsfm2elnmpnu0trtrio ta1fmDrli i s0texo(r no4lmt licsa() Drmxmono4oet  feild s ranmp u0aexnif3ta1oatraivsl( s2tmxmpno4aptnmicsa() rta(moou0aeeomociydlm emu sn(0aexoio tydfateanvo t)s2toir3nu4oltemicsasf Draumonu1ole iicilsls2elums;u) eerxf tytfp  luvo t t2xrxo iy1amtnlieilsfaDtru  oo4tpt mictlt s2ea( snu) rtoirciytlmte ivs t0s2urxmpoydap elnet ()aDum(r nt4oeto ieiltfs rmuvp t4alenmf iytlmDrli i t0 rxr(m ny4al  livias) 2ua( o;o4aexoio3iltfaDum(mp u)aexrirctydlp e n s;s)t2to(mpio4ame mnvi (fsrraxmooo4apxo o3iys mDrm( p;()tltnmfciodoaD luvi;s  2toir io4omtemfesls aDtr(moot4alxn f3iat m uan s;()treoircia1lpt  nei s0 rur(r3oydll n fcslt)srurxm ot1oee  o3ils m ua( pnt4aexrxo3iytfmt anvs;t)trtoxr io1oltemicias)s2tmxr oo4tpeo i3iasla rm( p u) lxnif tydlp  aueo s) rxr(o3oy4lmt mncsat  2rm(m ou4tltn f3ils m ra(vsn(4 renmocoodfa eaueslt) rxrxm3ou1am nlfvils srtr( poo0olx mfctyd s2umnms u) ltrmo tadlpt li o;s  etr(m oo1ome mnetasf rrm(roou1apeoiicilt m2uanvo t0trtoirciydlptean ils0 2umirpiy4opt mnctlsfaDraurpot4oltnifetadfm uan s;t0arxniocoa1latean o;t setrim3nudop nmncs t)s2tmu ont4aetnmo3iyslsDeanvp u0alxrxf iatomtrauvo;(0 2xo(mpoy1omte iesasf ruaur nt1alxn feildfsDrlnms u0artrmocoo1optrln o s trxmxr oydll nlieslsfs2uax  ;t0optomf3ilt s2elu pnu) reoirciadfatraivs s0 rxrxo3ou1apenmfeiatf Dtr(r nu0oee  ictyd sDean p ()tltnxoctodlp ranvs;t)srxoio iy4al e fvsls s2rrxrpnu4opx  ietltlm2eluvpnu) ltrif3iydfmDean ils t2trirpiydlm  licils)arumxmp;o4apt ii3tldlaDemn s;t4areoifcto1late u i (0s2tmxopny4omte ieiat)sDtmx p;u4tlt  iciysfa2rmnms u)aexrmr3ty1fat aivi s)srxmxo3io4lpt liviat)arrax  ot1opxnioetysfs2el(vo t) leoif3ia1fa r nvols0teur(r oudaltn fcsa()s2rmxro;u4teen fciadfm2rauvo t0areoxf3iadlm rlues;s0t2trir nu1al   fvt ( srrmurp;u1aetn ieilsfm rl(mp u)aetnio3ta1lmtelnvsl() rto(mpou1ame mncilt  Draxmpou4aex io3iatfa rlums;(0teenmo3todlmD  ues;(0 2umim nydap n neil()sDtmx pot4ale miciatls rm(ms;t4alxoxf tytfp eluvsls0 2xrxr iy1lptelnci sf rumu  ot1teeo o3iyslsDea( o t4 rxomf3oo1oaDr uvs t)s2to(opny4opt lnvsltfsDtru ono4aetnif3tasfaDeau o;u0 etoxr3oydlpDe u i t  rxoxm3nudom  mfetl(f Dtax  ;t0aet  i3ildfa ran s;t0artrmr tytfat au s;(0trtmiopnu4ole mfvtat)s2tmu poo0alt mfctas a el( o () exnio3oa1la rauvs s)trur(opoy1amt lfeiltfartaxr ou4tetomo3tytlmDrm(mpnt4 exomr3to1lmDr u olt t2ur(o iodoltelfcsas sDururp;t4aleomieiatfa2umu p u) lerxo3totopDrai ilt0tetmiopny4amtn ictas artru p;t0tptoiiciadlaDrmums ()tleoxo oydlm eaueols)teur(o3iy1alen iesa()s2urx poo0tetoiociatfs2emnvonu0 rtrmo3iotlp r u o;(0 rur(r iu4lp elieias)arur(r ot0aexnio3iat mDum( p;u4 rxrio3io1om r n slt0 eumir3iodll e neias)a2tr(rp;t0alt iieias mDua(monu4aexrmrcto1lp rai slt srto(mpno4omtnmfeias artrx  nt0opt mf3iytfa uaump;u)alxrif3iadlaDe n i;()texrim ny1omee fvi s aDrm( pnt0altniociysfm2um( o u0alxnio3tatlpD  ivo;(  exm(m nu4lmtnmicslt  2raumpnt0aet  o3tasfa2el( s;t0 renmr tydoa   ivsls) etoim3iudop n ieslt a2urumpnt4tptomicilt s2emu p u) rxomr3iotfp  aues t)t2tmxm iodap nmivsa() Dtr(ronu1aeenii3iadla el(ms t)aexnmf3iodlaD  u o (0srtm(r iy4omtemicslt  Drruront4apenmi3tld a2el(vo (0 lxoxf oodoaD livs;s0trxm(rpnu1ap nlivi s)aDraxm ;t1tpxo fciys m2rmuvo t0trtnmfcoatoat ai i ()s2xm(o3iy1ape  fcsas) Dtmx pnt4alenmoctltfsDrmu p u0trenir3tydlatrlu ilt t2xmxm oydoltn ics t) 2urur nu4tlxoio3ildfs umn o;t) leoif oydfpD aueo;s t2ur(r3ou4lmtnlnet ()aDrr(mp;t0tlenmietadfsDrmumon()tltnio oodfpte n ol(  2umxr3oudlm n iesat)artmum no4oltnmi3tadfs uln pn(0 lxnxo oydoatranvi;t)srtrir io4lmtemneta(farta(m ;u0aetnmf3iytfs2umn o u0tetrxr tydlmDrlneilt0 rxo(o3oo1lmen nvsltf 2tau pno4oltomfciys s rlu p (0arerif oy1lat  uvo;()t2tr(rpoudape liesltfsrrmx pnt0oltomfeild sDean s u4 lxnifciy1latrau o s)s2umir oudal nlivias srtaurpot0alxomoctld aDuan s u0artoifciodfp r uvil( tetrirpno4altn fcta(farumxmpnt4apx mocilslm2ulu p;u0texnmr3iadomt lieslt setoim3nodap  micsl()aDtrx  ot1texoiociasfa ulu snu4trxrxfciodfptrluvsl(0 etm(m3no1lpenmfcias  Dua(rpoo4tltnmfctyd mDrln p u) leomf to1fp   i s t0sexm(o ny4lp n ieiat)sDrmuroot0tlx  ictyd s2ulu s ()trxoxocoydfmDe i o;(0seuoxrpnodamt mnctlsfsDtaump;u1olx iieildfm2eanmp () ltnxf3oo1lmteli i t)t2tr(r3iu4lpt lics s a2raxr nu0aexoifeiyt aDrlnmp (0tltomo ootlmtrauvi t0 euo(o nydomee nct sf rta(mp;o4ope  ociltlm2rmn s;u0tleoxr3oodom  auvilt)teumim io1optelnvtatf 2tmx  ;u0opx iieiydls ul( s;(0trxnifcoatfa elieo s trtmxo io4omeelictas) 2rrx o;t1alxn i3tlsls2umn p u0 etoxo3ta1oatraivilt texrimpoy1opt lfctatf rtaumonu4tet  i3tas m ulnmp;t4trtoif ia1fmDeaivo;s0 rxrxmpio4op n ivtls s2rmumoot4alto f3iasla2ea( pnt0tlenxrcty1omte nvo t s2tr(o3oydopen fvtls) 2urxrpou0ale ifctatls2rluvpnu) eermr3totomDraivi t)srto(r3ny4lm emics (  2ur( poo0olxn fciys m2uanmp;t4 renmrcio1laD lneolt0srtm(rpiodlptnmietl( sDur(mpno1altnmietatfsDra(vsnt0 renmr3iytopt aiesls)s2tmimpnudllt lneias s2umurpoo1aexn i3iyt a ea(ms;t4 rxnio oa1lmDeaiei ()srtmxrpiodap  lnvi ()a2um(mont0texo feiydla2ua( p;()tlxrxo3oo1optrlueo (0s2umir oydoptnmfcil(f 2tr(r ;u4aexnmiciatfm rlump;t0tltoxoctydfmteauesls0 euoim3io1omenmncs s  ruaxmp;u0alen oeiatlaDrm(vo (0aeermf3iydop e ueo;t tetr(mpoo1ape mnviasf 2umumo;o4tle io3iys s rlnvo;u)tltnif3iy1faD lues;(0srtrxm3iy4alt mnei tfsDtaxm oo4ope iieiydfa2rmuvs;t0arxnmociy1lmtrai s () exoxr3iodlp n nvsas)arur(rp;u4opxomi3iysfm emu s u0aexrxoctadfmD  uesls0t2to(r ny4amtelnctasfarrrx pou4tlxnii3iadfm um(mo;(0alxnmo3oa1omteaivi;()trtoim3iy1lpte fvsa( s2umu  ot0olx mi3iysfs ra(mo;(4altoioctytom  luvil()trumxo iydllt  ncsas sDrmx  nu4opeoifetldfs rlu p t4 renxo3ta1lpD  neilt0s2uo(r3nudom emnetlt)s2urum nt1oet  i3tltls2eau o t4artrxo3oatfaD au o t trxmio no4ap  lncias  ruaum ot1tetomf3tldlsDrmuvp u0tlermr3iadlaDeanei t)s2xr(mpoo1ol  lietlt aDumuro;u4oexnmieiltfaDuln p;u0alxnio3iydlp raivs;()sruo(r3iu4ll elivils) Dtmur nu1aetn ictlt m2el(vs ()treoir tatfateaivols0s2uo(r3ou4amtemfcia()s2umu oot0tee  i3iasls2uanmo;t4texnxo3oatom  livi s0t2toxmpiy1ole  ietas a2um( o;o1tptnmoeiasls2ra(vp;t4tlerir oadoa e iei;s0srxmim iy4lltnmnet tfarrr(mpnt4tee mfeiatfa2ra(vs;(0arenmf todlpt  ivs;t) eumir iydam nmivtl()a2taxm ot4tpe io3ild a2ul(vp u4 eerir3iatoat li olt)tetmxo3oo4ol  lfvsa()a2rau ont1openmoeiydlaDuan pnt)artnifciy1oaD lnvo s)setr(rpoo1aptemfetat)s2rmxmo;u4ope  fetytfaDrl(monu)aetoxocia1fatelueo;t  2xmxmpoy4ole mnci sfsDtau  ;u4openio3tasfa rmn o;(0aetrmf oa1faDeln i s s2umxo io1apenlnctls artax pnt4oexnio3ild aDrm(vont0 rxrxr oadfp   ieolt)trto(m oydoptn nct tfsrumum nt1tpxniociys a2uln on(4tetnirctadfp r iei s0s2xo(rpio1omenmfetat) Drmu onu4apxn fcilt m rlumont0 lxnmf oa1lm r ivol()texoir3no1aptemieia()arurxr ot1opto f3tldls umnvo;t4treoifctodopD  ues t tetoxrpoodamenlfetas  rrm( pot0olen fciyd sDuaumpn(0artoxfciotlmDelnvs t  2uo(mpno1apeelneslsfaDumu p;t0tpe mictys s ulnvp;u0tetoxrcoy1latr u ilt0trur(r iu4apt mici tfartmu  ;u0oetn ictasfaDelump;(0trxoir3iotfmDrluvo t0srurxr iudomt  ivia(fsDraxm ;t4aex mf3iatfs rmuvs u)texrmrcoy1om   ues t)tetoxrpiy4apen netlt  2tmxmono1apt moeiatls2um( s (0areoxo iatfp r u slt0srxrxopiodole mnciatfsruru ooo0olxnmfcilt mDel(msnu0tetnio oadoa eaivi ()sexmxopnydamenlivs (f 2umumpoo1opt mocilsfa2em(vs;(4 etnmrcoodoaDr uvo;(0srxm(mpnodalee fcils  rrru pot0olt ioctyslm emu on(0tltoiocto1om e u i;s)t2to(mpiodllt liesasf Dum( pnt4apeo fciysls em( o;t0 eenmf3oadop eluei;t)srxm(rpno1omen nvsat)aDuaxro;u1oleniociatfa emu p;()artnxf oo1lmDeaies s0s2trxo3ou4om e fct t s2rr(mo;u1tptomoeiys s rmu p;t0 etoxo3oy1op e n i;t0 2trimpny4omtn fetasfs2rax pou0aee iiciatfm uluvo;u0 lenio3iy1lp rluei;t0 rumxm iu1lptnlfcsl( sDta(r ot1tlxo i3tat mDranvp;u4treomfciotlmt aneo s0 eumio nodlpenlicsa( artaxroou1opx  oeildlmDrl(ms ()trxnmo iytfmDe uei ( t2xm(opoodop  mfvtat)srtrxm oo1tlt ifctldfm ul(vo;u) lxnif3oodomtr i i;t0 2xmxr iudame lnvi ()aDum(r nu0tlxo feiydfaDuan o;(0 lxnmrcootopDe u ol()texrimpnudlp e fvt tfa2tmx poo4tetn f3iys a uan ont0alxnxr iadomt auvi;t  euo(r3iy4om  mfvsat) 2rm(rpnt0opxo fctydla2umn o t) lerio3oytfmD lnvi;(0 2xmimpno1ol  lfvsa()aDrm(mont0tpxniociyt m2ea( onu)tlerxoctodlp   ivo (0 eumim oodal   nvsasf rrr( poo4apeomo3tysfa2ulump;(0 renxf3io1lm  lieslt) rumim3io4ameelnetlt aDuaur nu4oetomieilt s2umnmonu0artomoctytfm rlivol(  eto(o nydal elfvtas  2um(r oo0olx ifeild sDra(vs;t0 lxnmr3iadla ranes;s0 exmxm3oydolen fvtls)srrrx  nu0aptoioctlsfm2emnvp;t)aleriociadlp  lnvo t0 ruo(opnudlptnlneiat s2ua(m oo1aexoii3iys sDrmnvs (0altoxo3ootlp   u o s) etrxr iu1lptelnci sf 2rru oot1oex mieilt a2ua(vont0 lxoxf oo1lpt luvs s)sexm(m3oudame lnes tfaDum(mpoo1aeeo ietytfm uaumo u)areomo3iydoa r ies ( s2tr(r3oo1om emiesasf rtaumo;t1opeoifeiltls uanvp u)trtrmf ia1lmt luvs;s  rtoxr3ou4ape mfviat a2uaxmoou0tpx ifeiad sDumnvp;u4 ltnir oa1fp r uvo (0trtrxo oy4lm emivs () 2tr(ro;u1aexo f3tydfa ulnvon(0treoxo ty1fptrlivsl(0s2xoirpiy1om elneslt)a2urumpot0aet  o3tls m2elnmo;u) etoxf ty1la eai i s0s2xmiopnu4ap elicias)arrruro;u0opto ociyt mDelu onu)treomrcta1la rlivs;s)texm(m3nodale lnetltfsDra(mp;o1tpe mictyt aDeaumo t4arxnxocoa1opDeli i t0seuoxrpnudalenmivt (f rurumono1teeniociyt sDua(vs;u) lermr oodfmDe iei;(0sruoxo3oydome mfvsl()srua(m ;t0tptnmoeilsfs ua( o (0aetrio3oodfa  liei;s0 rxmim io4lmt livt s)s2umum oo1tlx mieiys mDeau pn()aeermf oatfaD au olt) rxr(opiodome miesl( a2tmxr ;u1oexnio3tlsfs rmu o;u0artrmocoydomt  ieo;t)s2tm(r3iodop nlfvs ()sDtr(rono0tpeomoeiaslm2um(vp;u0texnxfcty1lpD  nes;(0 exr(rpny4op nmicil(fa2taxroou4alxo o3tld aDeau s t0 etnmo3ia1om elnei;() eurim3no4lm emiei (f ruru pnt4tpt mo3iatfa uau p;u4texnmr3tatfmteluvs t)s2tr(rpnu4ope lnvsl(f Drmu pou4apeo fetlslm rlnmo u)teenio3oodlaDeluvils  2um(mpoydlm  mfvi s aDuaxmp;t1apeo ociysfs2elnvo u) ltnmf3iotfa  lu sls0seumio ou1ole  fcils)artmx oot1oleomfetad mDrm( on(0 lxrxrcoo1opD aivsl()s2toim nudlltn nvi s s2rm(ronu1tex mociytfm2ranmpn(0alermf3oatlaD lieils)t2umxm3iydlpte feslsfarurxr ;t1teeoiieiltla rl( p;t0altrmo totfmD auvs t0trumiopoodll e fesa(fsDrau poo0tet  fciys s2rl(vont0 rxrmfctotoa  livo s)setmxmpoo4am  mfesltfsrur( o;t0opxoiieiaslm eln p;() exnxrctydlaDr nvs (0 2xmxr3iudamt mncs t  2ta(mp;u1aleoiicilt mDuanvon()trxomfcoodoatr i il( s2toir3oy1lmte fet s s2um(m nt1tpxoiieildfsDuau s () rxnxo3iotomD aivi t0s2to(r3oy4lpe liviat artru oot0tlenmfctytfaDuluvo;u)trtrirciadlatrln i t0setrxr iudlmenlivs t srtm(  oo1opeomiciydfa2ua( ont0tlxrio3tydopt ai olt0t2tmxm3oudomtnlfei t)a2ur(  ot0apeoif3ils m rln pnt) ltrxf3oy1omtr ieols0s2xo(m3nudolenlivt ( sDurumpnu4aleoiociysfaDum(vpn()arxnif oadoptrlivi;s sruoxm3no4oltnlictltfa2rrxr nt1opxnioctasfs um( s;(0 ltoxfcoatopDelivo;()srtoxmpiy4ol e ivslt a2rmurp;u0teenmfctadls2elnvs u4 rerircoydfaDrluvi;t0s2uo(r3oo1ol elnctasfarta( o;o0aex if3tasfs2ua( s;(4trxrmr3iydopDelnvils)srxmxrpny1ol   fet t)s2rrurono0alxnmfciydlm umnvp (0alxnxocoydfmDelueils) rxr(m nu1op nlics t)sDrax oou0tpt  oetls a2rmnvon(4aexoio3ootlmDean sls  2ur(mpoydlpte ncsasfsrtrx  ;t1teeo fciltla2rln snu4 rxnxo3oy1om elnvi (0srtmxmpno1llen ncia( a2umu  oo1oexn ietltls emu snu)aexrio oy1la raivo;s0 rur(rpno4lpee fvta( a2rr(mo;o1opt iictldfmDean p t4aetoxocoytfateluvi;t)t2uo(o3iudaptnlnet tf rumur ;u0aet ifeiydls2umnvpnt) rxrxf oodlmDeaneils  rxm(m3iy1lpte fet ( srtaxro;t0apeoiiciatfs rlu p t0 etnirciadoptrai s;()t2xo(r oy4amtnmneiat  2uaumpno1tpto fctaslm2umuvpnt)texnxrciydoa r nvo;t  2um(opoydoptnmncils)sDrmum ;u4altn iciasla ulumo;(4 rtoir ta1omD lueo;(0srto(m3iu1op nmivilsf Dur(m ot1olxo ieiltlsDrm(vonu)artnmr todom  an s;t  exmirpiu4ll emnes (fsruaxrpot4oleo fcild sDumnms ()trxnmfcoadoptr ivslt0s2urio nodoptemfesl() rrmu onu4aeto feiltlm ulump ()altoxfcoytfpDeaies;s)srtrir3nydal elfesa(fsrrrxm oo1apeo fctytfsDrlumpn(4aeeoxfcio1fate uei;t0setr(m nodome  nvs s)s2truroou0apxo iciad mDuan s t)trxrmf3oy1la   i ol() etm(o nydlmte fvi ( srrmu pot0opxnioeiasfs2umn o (0 rxrxr3ta1fp rlnvo ()s2urxm iy1ap elnvs ( a2rmumo;t1tpe mieiyd a ea(vpnt0treoxf io1fa rlnei;t trxr(r iu4op nmncsa( srur( o;u4aetnmoetlsfs2em( p;t4 rtnmociadlmDeaivo s teumiopiu1omt  ncsas a2rrx oot1aexoii3tld a rluvo (4tltoxf ootomtraivo;t0t2trimpou1ol   nvia()aDururpoo4tptn fctld m2umn pnu0 exrmo iadop  auvolt)seurxrpno1lmee net s aDrmump;o1oex if3iyslm uanvo;(0 rtoio oytfptrlneolt0 ruoim3no4ll   fvtlt)srta(r ot4aetomfcilt a2rluvs;(4tltriociotoaDrlivi;t  eto(o3iu1altelfetltf 2rm( o;t0aleomietyt mDum(vs;t0arxnircoadfm e n ols srtr(o iydomtnlfesl(  Dua(mont0oleomo3iadfsDem( o;(4alxnxfctadlptr u i (0t2urxm oo4al  livsl( a2rmxro;u4tpx  o3tls m uau p ()trxrif ia1opDr n s t0 rxo(o oodame lfvi ()arumu p;u1alt  octaslsDumn s;t4tlerif3ta1oa ran s (  etrio nydop nlnci s a2raurpnt1opx ii3ias sDum(mo u)aleoir3iytlm e nvo;()srxm(o iy1lltnlnetlt aDrm(  ou4apen octld s eln p t)tlerxoctodopte n s t0 eumxmpiy4ol nmnvsas  Drmxrpoo4aeen ietasfm ra( pnu4tltrio to1fp r neilt) 2triopiodope mnci t arua( o;t4aptomoctydfm2emuvp;(0alxrxrciydopt  ueo s  rtoimpoo1opeemfesat srur(mpot4apxo ocias a umn p;u0tetrmociytfp e u s;s0sruo(opoudlptelivs (  Duaum nt4tlxnmietydfmDuauvpn(4 ltrxo ia1lpD ai ols  rurir3iydop   fcslt s2trum ou1tleoioetas aDea(mp;u4 reoio3oadfmteln o;s0t2tr(o oudopenmiesatfs2tm( onu4tpt  o3ilsfa uauvsn()tetnmr iotlpt  uvs ()s2uoxo3io4om nlfetas) 2taxr ;o1oeeoifeiltfm emu s;u4trtoirciatfa  lies s s2toxr3oodll  mnes s  Dua(r ;t4optnio3ild s rauvsnt)arxnmf3oytoaDraiei t  rumxrpnydolt  neta() 2ur( pou4ole ifetys s emums;t0altrxo3iydfmt lies;s) etrxopoy4lp n nes sfs2tmurpot0oet mietyt m emumo;u4arerxr iy1fmD  uvi (0 rxmim3iydllt mfei s)a2rmxronu1openmfctltlaDemuvo t) lermf io1oa r uesls)t2xm(m oodlm e feils aDum(r ;u0aptnifetys sDua(vp (4arerxr3totlp e u i;t)t2uo(o3ny1lmt mnvs t  2ur(rpnt1aeeoii3ils s umu o;t4trxrxrcoodfpt li i;()srtr(r iy4lle mfesl(fa2raxrp;u4teeomi3ilsfa2rmn o;t4 etoif3ootlm rli ol()seuoxr3oo4lptnmneia(f 2umump;u4apxn f3iydfs2uau s;() reomr totlmte ivilt)sexmxm iydll e ivi (f 2ra(m ;u0aetn o3tat m ul(vs (0tltrxf io1opt lueilt  eto(r3ny4opte nvt t a2tmxmo;u4teto octatfm rl( pnt) etoirctadom  lnvs;t0texrirpou4omt micils srumxmpoo1ope mietat sDraump u)tetrircoy1lateai sl()t2umim no1lp elfet t)s2tmurp;o0tptnmoctyd a rauvo;t0 exnxociodop  luei t  2xmxopnodop n fvsas)aDum( pnu1texoif3iytfa ulnmo u) ltrifcoatfatr i o (0 2xmxm no1op  lfeil(fsrua(m ;o4tlto i3iydlsDeluvs u4altrif io1oa e ieo s) rxmimpiu1ape mfct t)sDua(ro;t1tetnii3tat a ulu o () exomf io1fpD  nvs s)srxmir3ou1ll  mfetas)sDtmxm nt0olxomietls s2elump u)arxrxo3iadlptraiei t0s2urxm nu1op  livs s)a2rau p;t1ope io3tad aDel(vo t0 exnmo ta1oa eauvilt teuo(mpnu1lpee fvta( a2truro;t4oexnif3ildfm elnmp;t)aeerif oydoa  lu i;s0sexm(m oy1ll  lnvi t a2trum ;t0tptn i3tatla2el(vo;t4 lxrxf iotoa e iei;s0sruoimpiu4llte icsls)srurxrpno1olx mfcilt mDea( on()aetnmo3tydomD auvo;(0s2xrxm3iydapt mnesas a2raur ou1aptn o3iatls uaump t) rxrmo3oytop r n sl(  rur(mpiudapte nct t)arrru o;u0tlt moeildfaDrmnmo;t4 rxrxo3ootfm r ivslt) rtm(o3iy1ap eliesat)s2rax o;u0tlt iociltfa emn o u4artnxo3iotlmtrau o (0 eto(r3nodal  lnetlt)sDta(  nt1tpenmfetlsls eanvsnu)aexrmo3oatoa raivi () rxoim iudom nlfvilt  Dtrx o;o0alx  o3iasfsDemnms;t4aeeoiocoo1lmDeauvo;(  ruoir oo4ll elivsat  2trur ou0tptomo3iadlaDua(vsn(4 etomo3tatfmtraivols0t2tm(o3nu4omtemfvils)a2rau o;o1texn fcildlmDuan o;()tltrir3iodoaDraues t srxmxr iy1apt lnciat)aDraxmo;o4oleo oeiatfm2ea( p u)aexnio oa1fpDe ieolt)setr(r3oudom elfeiltfa2rrxm nt0tet  feiysfm rlumo u4 ltnir ootomDeaues t) 2tr(o ny1lmtn feiltf rrm(mpoo0oetn fctatfa ra( s;(0trenmr3iatopt  i o;( tetoio3ny1llt mivils)sDraxrono4tpxniieiydfa eluvs t4trtoxrciodop eaneils) euoir io1openlfct s)sDrrx o;o1alxoiociat s2ra(vp;(4alxnif iatfaDeaies;()s2uoxmpny1olenmfct s  2tmumpoo0ole moctydfa eanmont)aexoif3oadfatrln s;t0sexr(mpio4alee ivtas) 2tr(monu1oex mociasls rauvsn(0 rtoxfctytlm   nesl(0texrxmpny4apt  ncsat)a2ra( oot0openif3tytfm2rlnvs t4tetnxf3iadlpDeli slt)sexmxmpiy4am nlivtlt)srrrx o;u1oet ioctytls2rmums;t0trtrxf tatlp rau ils) rto(rpny1amee icia() rua(monu1altn fciysfs2ul(vs t) ltnxf oa1optranvi;s0 etoirpny4lmt lncsl() Duax pno4olxoiieilsfm ea(mp (4 rtnio3oodoatraivslt0s2xm(r iydapeemfetl(f 2taxr no0tetnmietatlsDel( on(4 rtrio3tatlpD auvo s sexo(mpno1apeelnct tfs2rm(r oo0tpe mfeildfa em(vs;u4aetomfctydlm  li i;()s2xoio3oodolte fes s srururo;t0texoifeildls eluvsnu4arxnirciodlmteli s t) rurxopoudll nlfeta( a2rrxmo;t0tleomfeiaslsDul(msnt4alxnirctodfptrlivi;s0 rum(r nu1lm  lfeil(farua(  oo0oltoioctysls emnmpn(0artnxf iytlmt lnvs;(0s2xo(mpnu1lpt lncs (fs2ur( p;t1alt mfeilsfmDrl( s;t)tetoir3oadfp   n o;t sexm(o ou1lmeemfvi (  rum(  ou0tpto i3tldfs2uauvs (0 rermfctodlp  liei s0 rxmimpou1op e ietas a2tm(mo;u0tee  o3tatla rl(vsnu) exrio oa1lptr u slt0trtmxm3ou4am nlietl(  rumxm nu0oetoiociyd mDuau s;t0aexnxfcoo1fa  ln o;( setrir iudalte fct ( aDtm(m oo1apt ifctatfm2ul( pn()tltoircoodfmt  ivi;(  rto(m3no4llt micsa( sDrrurpoo0tet moeias m2ran p;u4aeerxr oo1om  aneo;()sruoxm3iy4lmtelivilt)arraxm ;t4alxnmfcilsfs uauvp;t0teenif oadoptr ueo;( srxoim3iu1omte fcsas)a2uau ooo1opeo i3ilsls uln pnu) eermf io1lat  n s;t srxoxm oo4lmenmnvtlt) rta(rp;t1oeeoifetasfmDrln sn(0tetnmfcio1opt lnvi;t  etmirpoydomtemfvi t s2tm(rpnt4tlx moetltls eluvp t4teermocoodfmDr i o;()trxm(r3ou4omte fctl() 2umu  ;o1opxoifeias m ua(vpnt4texomo3tytfaDr u olt texm(opoo4am nmnci t  Dua(m nu4apx mieildlaDul( p u4arxnmoctodoaDr ieols0srxrxr3nu1lpenlieiltfsrta( oou0aeeo i3iltfsDrmn p t4 etnio3oadoate n ilt0 eumxm oodamtn ictas  Durxmpnt4opxn fciadlaDulums;t4 ltrxrciodom   ieols) exoxr oo1lptemies () 2tr(  nt1teenif3ilsfa elnms;(4 eenir iy1lp eln olt t2tmxo oydol   fvil() Dua(m nt1apt mi3tat s2rl(vo;t4 lxrxo3ootfm rauesl(0srurxm no1llt mnctlsfarraum oo4texo iciad s rluvsn(4aexrmo to1omt lu o (0 etoxrpoodom  mnvsa(f Drmu ooo4ale io3iysls rm(msnt0 lxrmo tatlpDean i t0srtm(opoo4apenlnvt (  Dtmu  ot4tptnifctat m umn p;t4alxnxf totlpteaues;s  rxm(o iu4apee ivt s)arrr(mont4ape mociasfa ua(mp;t4aleoir3iytop eli s;( srto(opny4apee fet () 2tmumo;o0tltn iciadfmDrmnvp;t4aetrircoy1fat aieslt sexoxrpno4ome  fct sf rraum no0tpxoiieiydls2el(mp;u0texrir ty1lpDraivsl(0t2xm(o3io4al  mfciatf Dtru p;t1aex mi3tysls2rmu o;t) etnio3iadfptrauvi;()trur(m3ou4lp e netls)srrm(rpno1oleomfctltfaDeauvo u) ltrif3totom r n ols) etmio3nydllte ivt s  Drmum nu0oet mf3ilsfs ra(von()trtrmfcootfpDrlueol(0trtmxo io4llt lfcs t sDraumooo1opeoiieiydls eauvp t0 rtrir3ta1faDeai o s tetmir ny1aptemnvsa() 2um( oot1aet mf3iasla ranvonu4alxnmo3oo1omDrlnvs t0 2ur(m3nydol e nesls srrrx pot4alt ii3iydlsDel( onu4 lermo3tytfpDe ivi;s t2to(r3iu4ll elfvta(  Dtrx pnt1tpxniieiysfs2eanms;t4areomrciodlp  au i s0 2xrim3iodlltn ici t  rtm(r nu1tlxomo3tatfs eluvo t4trxomo3ta1latrai i;s0 eto(o oy4ap emivias sDumumooo4tleomietadla ul(mont) leoir iatomt lneil( s2uoimpiy4lp e nes ()arua(rpno4aexnii3tyd aDum( pnu)tlenif oatlpte ivsls)trxr(o iu4llte fcsls  Drm(ro;u0opeoiictadla elnvonu)alxnmo oadlpteaues;()tetoim iu1opt lnvsltf Drrumont0oeto ictydfa elnmp t4teerxo3oodomte uvi;( sexoxo3ny4am  lncta()a2taumpot1alenmoeiyslm2rauvpnu4 lxniocootfptrln o ()seuoirpiy1ap e icil( a2taump;u0ape  i3ilsfs2rl(von(0altnmf3oydfaD auvs;t0sexmxm iy4ll nmfet (  2umxmono0tlx if3iad mDrlu onu0texnmr3tydom eaivolt s2xoimpiy4lpe lfes t sDtru onu4olen iciyt m rm( o;()trtnir3oy1oaDrlneo;(0s2xrim oo4alt  iesa() 2tm(m nt4apxo fciadlmDrlu p;(0trtrircootlmt  nvs;s0sexriopnu1oltelivi ()srtmu p;u1aexoiieiysls2rln o;u4aetoir3tydfa  aies s0trxo(mpnudol nmfvt (  Dtaur ;o4alxn fctltls rm(vp;()aeeoif3oodopte ivil()srxr(r3io1amenlfvtl() 2taxmo;u4aee mf3iysfmDrmn s;u0tetrmo oydlmD  u i t setoxo oy1ll  mnvi tfaDuaxmo;o4tpen ietadls2um(mo;() rxoio3iydomtraieolt)srxoiopiudlpt mfctasfaDumu pno0aleomictlt a2rl( sn()altrxr3tadfm r uvi;t) etrxmpiydam nmfci tfarraxm ot0tpt mf3iydfaDemuvp t0aeenir iadlmD lueils) 2xoxrpou4ap n iet sfs2um(mpnu1alxn oeiadfsDulump;u0trxomf3to1om r n i ()tetrim ou1lm nmictlt)a2uax  oo4aptomi3ildls rm(mpnt4 ltrir iodlpD anvs (0setoxr nu1oltn iesltf 2tr(ro;u0altoii3iydfa el( pn()aexrifcio1lm e i o s0 rxmim3no1am emnvsls  Drm(mpou0opxnmoctyt m2em( s;u4altnmo3oa1fp e ivi s teum(r iu4ll n ncs ()s2tr(rpnt0tpt ioeiys a2el(vs;u0tltrmr3iydfp r ues s0s2xrim3oo4lpt mnesls) rrrx p;o0olen i3iyd sDea( o u4 etrxf3ootomDe u i;t  2xrir oy4am nmicsl( aDua( p;u1alx mfctasfs em(vo ()texoif3oa1om raivi t0 rtm(r ny4amte fetls) rtmur oo0tle iiciyd m2uan s (4teerxoctodlpt lu sls) eumxr iodole mfctl()sDrm( ont4ope  oeildfm2um( p;t4aeerxfctatlpteauvs (0 rxmxopno4op nliciat)s2tm(m no0oex mf3tyd s rm(mp;(0treoxf ty1oat luvo;t)t2xo(r3ou4ol nliesl(fsrtm(rp;t1olx mieiltlm eaumpnt0 rtoifcoadla   nesl( srtoimpno4lptelnetas aDtmx  ou4oltn i3iltls2emnvsn()altrmo3iydfaDr u ilt0t2xmxopnu1omeemnesas)srum(rpou4optn ociytlm uau s u)alenir3oy1fm  lneil(0 rurxr nu1am nlfvtltf Dururpou0aexomoeild a2umn p t4trerxo3iodla  aivsls0t2xo(r3nodll nmici s)s2rr(  ot0tleomieiyd a rl( pn()tlxrmo oy1omD ln sls) rxmim3nydom e ivsa( s2tmump;o0tpeoii3iydlmDeln pn()teermociy1fpDeau s t0srtmimpiu4ome mnvs t  rumu o;t0apx  i3ias a rau pnu) lxnir3to1lm rln s () rxmirpiu1olteliei s) 2trurpou0openifctad sDelump u) rerxo oytfaDrln o ()s2xrir3ny4lp elfct sfs2ua(moou1texn iciysfmDeanmo;() lenxr3oy1optrauvs s0seto(r nu1amtn fvt tfsDtr(m oo0optoii3iysfaDeluvp;t0aeerxr3oodfmt lieslt)sexo(m3nu1aptemfvtls) 2trx o;t0tptoiociltla uanvs;t)tltoxociy1fptelu o;t  2xm(r io4alenliesl(fs2trum ot1alenii3tat m2ea(vsnu0 ltrxf3oydop rlies s0 ruo(m3nudolenlfvils) rrrxmo;u1tltnii3ils aDranvpnt) rerxfcoadla r u i;t0 rto(r iu1lmtemfvtlsf Drm(m ;u0oee  feias a rl( onu)tltoirctadfmDelnvi s teuoiopoo4ope mnvtas s2rmu  oo4opxomo3tltlsDrl( p t0trerircoa1om e i s;t)seurxmpiudlmeelfvi (f 2rmu pou4olxo ictyt sDuaums;t4trtoircoodfmDraues;(0 rxmirpiudop n iei tfsrtru p;o4oleo i3iyd sDumn ont4 eeoif iatlm  anvs;s)s2umimpio1ll nlfvi sfs2ra( onu4tlt ifctatlsDemnvs;(4 rtoif tatomteaivi;( t2uoxm no1optemfvtlsf 2umxmpoo0tlx mocias aDra( p (0altnifciadfaD  i s;t0s2uoxm nodam n nvt t arrmxront4tpxomfciasfsDra(vo;()teeriociotoat li s t)s2umxo no4lltelfcsl() rumx p;t0oltomictysla uau s t0 lenircio1om  an i;t0 etriopno1aptelfvs ( a2ua(r ;t0tpe mo3taslm2ulnvo;t) lenif oatomD anvo;t teuoxo3io1olt mnvil( sruaumoou1tlxo ocilsfmDem(mo;t4teenmrciodlm  lues;()sruoir ny4al emivtatf Dtr(  nu0tetomi3iysfaDrm( ont) lxrio tytlpDe n o;t)s2xmxopny1oltnmfvia(f rum( p;t0oetniieiytfsDum(vsnt4 rtnif iodlmD  nei (0 2uoio3nydapeemfvtlt arua(ro;t4tlx moetld a uan ont0trtrmocia1fpDeaivsls)tetrxrpnodlpeemncsltf 2uau  no1tpt  oeils m rmnms t4trxrir totomDrlu o;s) 2trir oo1amt miesat) rra(mpoo0ape  ietlsls2rl(vonu4aleomoctatfpD au s s)srtoio iodlle  fes ( srrmurono1aexn ieiaslm ea(msn(4tltoxo3oadomDe n s;t trxo(opio1altn ietat)aDumxm no1olt ifciys mDeaumo;u0tltoxf3oatfaD luvsl(  2xrxo3no1olee fct sfsrtm(  nu4alxn i3tysla rm( ont0 eenmociy1lat lnes;s0srtmxr3oydlpt mfvsas srtr( o;t1texn f3ilslaDulumpnt)alenxr3iatoaD ai sls0t2trxopoo1optn fcs t)aDtax  oo1aet ioctadlm ra(msn(4alxrxr3tatfmDe i s;t)srurirpiodlm   ivi (  rrr(ro;t1tet  iciatfa2rmnvo;(0treoir3tadom r u ils) rumio3ou1amtnmfcilt sDraumoot4aexniociytlmDeanms u)arermf oy1laDraneolt0trtmio3oo4olt miei s)aDuau  ot0oexnio3iatfm rlumpnt0aexnxr3iadfm eau ils)srxo(m3nodll emicsltfaDtrxrpnu4opxn i3iltlaDea( p t0aexrir oo1laDeanvols)trtr(m oo1lp eliviatf Dumxr ;u0olx if3iyt m2ran o u0arxnio todlaD  uvil(  rtrim nudop nlfcils)aDuru  ;u0apxomoeiys aDrm(von() rxnxo3oatoatrluvolt)seur(mpnodolt  fcsl()s2tr(m nt0tltnifeiltlaDel( o;u)tlxoir3io1fmDrlneols sexrxopnudam elnct t a2tmu pnt1opx mocilt s2ulumonu4trtnmrciydop e nei s0teumim nudapt mfct ( s2ra( ooo1olxomietatfmDumnmp;() lxnirctatfpt an il()tetr(m nydll e ivtlt aDrm( poo0tpx iieiys s rm(ms;u4 ltnxo todomD  u s;s t2uoir3ny1optelnctlsfartrxm ot0ape ioctlt s eauvsnt)tlxnxr3to1lpDelnei t0srur(opoudomenmnvta( a2tmx ooo1aeenmo3ilt mDra(mp;t4teermfciydom  luvi;s0t2ur(o3no4llee netltf 2trxmp;u4tpen ieilsla ra(mp t)tltnmr io1fmt lnvilt0setoxm3iy4altn fvtl( srtmu pno1oexoioetys s2rm(mpn(4tlerio oa1lateln s t teumxr iy4ol   fcias  2ua(mp;o1tpeomociysfm rmu o;t4tltnxoctodlaDrln o t)t2xmim3iydopenlncsa() 2tau pnu4opt  fctasfm em(vont)alxoxfcoodopDrln ol()tetrxmpoo1ap   iet ()srtax  ;u1alt iociadla2rmumo u0 eerircoytfm  luvi;t t2toxopiodopeemnct (fs2ur( oou1ale ioctasls2rm(mp;u)aexrxf3ty1lm eli ol( t2xm(m3iydamtnmfci s)a2tr(m ;u1opto oeiytla umu o;(4arenxf iy1omDelues;(0trxrxm iu1am nlivtas)a2rmxm nu0teenmfciasfm uluvsn(0tleoifciy1latrli i;()teum(opoy1aleelictls arrmx oou1tptnifetyd mDrln o t0alxnxr3to1om eln s (0 rto(rpiy1lp   fcias)a2raxm ;t0oexn f3iltfm rl(vpnt)trerxr3iodoaD luvs t) rto(mpio4oltemnvi s)sDua( p;t1ope  oeildfs2ranmp;t0 rtrmr oydfm rlies t  rxo(m3iudoltnlivt sfsDrmu  ;t1apx  iciltlm rluvo;(0aexomrcoo1optr nvol()teur(rpnu4lmtemfei s  Dtaumpot1alx mi3ilslm2ranmp;() eeoxo todoptrlnvo t)texrim3io4amtn fvsat  2ur(root0tpe  iciyd a umumo;(0 rtomr oo1lpDe ieo;( sruoxo iydom nmieta( arrau pou4apt mf3iyt s umu p;t) reoxo3io1oaD ai s;t0sexo(r io4ope lfvils)aDraxmont1tee  oeiydlsDeanvpn(4aexnmr3oydfa eau s;t0t2xrxr oydopt miei (  Dtaxmp;u1opeomfcildlsDrmums t)texnxr tytfp raieo;t)trtm(rpou4ap n fcs tfsruru  nu0olt mfciydfs2ean onu)aetnmfciodfp rai i ( texoio3iu4alen ncilsfsruru  ot4aetoiietlsfa um(vo;u)altomfcoy1om rli ilt0srumir iudomt mivsat  rrrur ou4texoioctldla2uaums;(0 rxnxociotfa elieo t  rxrxm3iu1omtnlfvslt)a2tm(m nu1tlt  f3tydfa2rmnvp;u0aleomocoatomDeauvo t s2uoxo ny4lpen neiat)s2tr(ront0altoioetadfa2eanvsnu0 etnmocoodlmt lu slt) 2trim3iu4omt mfvt s)sDumumpoo4teeoio3tydfm2umumo (0 eerir oytlp e ueo;( sexmxr oo1ape mietltfsDtmx  no4tlx  feiadfmDuanmo;u4trenmrcto1omtr u o;()s2uriopnu1al  lieia(fa2um(mpoo1opx ii3tytlmDul(vp;t)trxoxf3todfmD  i o s)trxo(opio4lp  livsa( a2urum nt0texoiieilsfm uau p;t4 exrir oatop  ai i (0 etr(o3iu1apeeliet t sruax oot4olxniictasfa2eln o;t)artnxf oadfp elu i s0t2xoxr3oy4ale mivi tf Dur(  ot0apt  oeild mDrln p t4 etnmocio1omD aues;(  2ur(r oy1lpee iei ( a2ur(m nu1altniociltfm2emnvo t4trxnxfciodlpDe uesls  rtr(r3nu4om nlfvs ( artm( ono0alt mociytfmDel(vs (0aeenmocia1oatrlivi;t0t2toxr3ny1am  mncs (fartr(ro;u0ole  ieiltlmDua( o;t4alermf oadfmteaiei ()srxo(m3ou1ol emivs s)aDtmu ont0tltn ociyt mDemn o t4arerir iatoa r n i;t)trurio oo4am e icsatfaDrmxr nu4texomo3ildla elnvo u4alxnif iotla e uei (0 2toxm3iy1optemncs sfaruaxmp;t4tpxn oetytlaDuan o t)trtoif oydfpte uvi (0srtmir ou1op   fesa( a2urumpot4aleomi3iys a ulu p;(4artoif3oadoa r ueil( setoir3nu4ale mfetat a2ua(m ;o1altoiociadfa2umn onu0trtrxo3todlp rauvils  rxmirpiu1omt mfvs (fs2um(  ;o4oexn feiat a2ua(vs;u) etrmf ta1fmtrln o;s teuoio3iudapen fvtat) 2urxm nt1tptn ociys m2uanvsnu)texomr3tydlmDeaneo;s truo(o3io1ome  fcs sf Drru o;o1tlxnmoeildlmDrmuvont0aexnir3tadoateln ols0t2trxm oydolteliet t  2rmum nt1tlt  f3tad m rl( p u4aexnif3oydoa   iesls) rxmxo3iu1ll emnesa(fs2trxr ;o1tlx mictas m umnvonu4 ltnxf to1om   i s s0 rtoir3iodll elnctatfsDuau  ot0oexnifetyt sDrl(vpnu0 etrxr3ty1faDr ivi;s srurxm3nu1llt lnci tf rrru  oo1oee  fetysfa ua(ms t4alxrxf oy1fa r i ilt  2tmirpiu4ome  fci s)aDrru  nu4olxn fetld m elnmo (4aleriocoydlm e n i;t tetrxo3oydop   ictltf rtru  nt0texoiieilt sDem(vp;(0 lxrxociy1oate ivo;t0truoxm nudllt  fcsl( sDta(m ou1texo i3iadla rluvo (4trtrmr ty1om rlnvo;s0 2tr(m iydolt lfvsas srtmumpot0alt mietydfsDelnvs t) rxrirciadlaD  nvilt0srxoir3iy1altnlneta(fs2tru oou1apenif3ildfs2rmu p;u)aleoio3oo1fm  anvi s0 eur(r ny1ap n fvtlt)arrrxmo;u4olenmfcias s elnvo t4tltrxo3oytfa r nes t)sexrxo ou4lm nlnvt t  2tau pot4tleo feiatfm rln sn(4tetnif3oytlp e n slt)t2trio ny1ope mfesl() Dtmxrpno4alt ioeiytfmDrlnms u)trxnmr oodomtranvs;t) exrio3io1ope  ieiltfarrrum ;u0tlen oeils s ranmp (0arenxo iotoa eauvil() 2toir3oodom e nct sf 2rr(  ;o4opxomoeiat s rl(vs;u0altrxr ta1fm rauei;(0t2xrxopnu4opee nci s) Duaxmo;u1oltoiictydla elnmp;u4 rtnmr to1lm  an s;s0texoir3oodame  ivsa(f Durx onu0opt io3ias a eanmo u)trxrxo3tadomtelneslt)t2trio3nu1ole livtl(f rta( o;o0aee micils a2el( o;t4 leomociadfaD aieol(0s2um(m3no1ale  ivia()a2uax ooo4tltn o3ilsfsDum( s;u0tetrircoatoaDraivo;s texo(rpnudllte nvtltfs2ta(rpnt1openmoetat sDrl( pnt0alxnircootfmtr uei;()t2xoiopio1lm n nei sf rrmu  nt1olxoioetltfs2umnvpnt0aeenirctytfp e uei t0 2xrxm3ny4lltnmfvi s aDumumpnu4oexn i3iltla rlumonu4 lerxr to1oaDr iei;( setr(m3oudolenlicsltfa2ur(  ot0tetn o3tad mDrmn snu)areoxr iotlpteau s;( setmxm3iy4amenlfetas)aruaumooo1aetnmf3ias s rauvp;t0altnxf tadfmDran o;s  rto(r ou1lm nlnciat)aDra(r ;o1tle mieiyt m emuvs u4arxnir oadlpt  nvo;s teurxr nu4opt mfes s sDtmx ont1opxnmo3iatfa2eanvsnu4aeerxf iadoa r uvols)srur(r3iu4lm elnvtatfaDururo;u1aexnmiciytfa2rluvonu0tlenmo3tytlpD  nes;s0srxm(opoy4olteliei (  2tr( oot0aet  ietytls2eauvo;u4trtnxoctotlm e i ils0trxm(rpou4omtnlfei ( aDtaur ;u0aeen f3ilsfsDrm(vonu0 rxoxo3ootfm r neo s texo(rpno4al emict t)aDrr( p;t4apxo ociys a2uaump;u0alermf to1latelnvo t)trxo(m3io4ale lnvi t aDrrxmpot4aet iociysla eau p u4teeoxo iy1lmtran s t0 euo(mpoydom   iet t) Drrur ;o0aexnmiciatfm emnmsn() exoxf3iodfmt lnvolt0 eto(r3nu4apeemnesas)sDrrxm ;t4apx moetysfm ua( s (4alxrmo3iy1fmt  n o;(0srtmxo io1aptnliesls  2ururp;o4teeoiiciys s2emn o u4aeermf totfpDeluei;s  rumxr oy4altnlfci (fsDrax  ou0altoifetltfaDumumsnt)arxnio3io1faDeluvsls)t2ur(r nu1op n icia() 2rm(  ou4aetnmociyt s2umuvs;(0 lxoio tatlmDeau o s) etrir io1olte nvs tfs2raxmo;t4aexoifctydfm2rl(vp;(0tetnxocia1lp raneol( t2umxrpiu4lm   fctl() Drmxro;u4oltnii3tat sDelums u0tlxrirctatop rln s t t2urxopnudlme mfvi t a2ta(m no0tetniocilt s2ul(mp;() lxnxrcoy1lp   n o (  etrirpoo1oltnmfesas)aDurumo;t4ape ioeilsls rm(vp;t0treoiocoy1fa e u ols s2urir iu1omee icsl(farrmuro;t0olenmietyt mDrmuvp ()altoio ty1laDe ieol(0trtmir oodlpe livsl()s2ta(m oo1olx if3tys mDum(vs;(4tlenmociy1oaDr nvo ( t2to(r3nydom e ieslsfsDur(m oo1apx mi3ilsla rm(mpnt4trtoxociytopDraieo s) 2uo(opnodapte fvil()arraur ;o4apx ii3ilsfsDeanvpnt)tltniocoytfat  ieo t0teum(opnudoptemicsls a2uau p;t4opeomoeild sDran p;u0aetrio tatlmtrlnvil()seuoio3nu1omee ietlsfa2rrur ;u1tet  i3iytlmDrluvp (0aexrmfctodomDrlnvil(  2toim3iu4llee fcil( aruru  ;o4aexn iciadlsDelnvs;t4arxnxf iodlateli s t)texrirpnu1am elnctls  2rmumoou4oetoifciydfs2ranvo u4tetrxr3tydfpDrai s;s)truriopoo4omenmneta() 2ur(r oo1texo octltfa2emuvsn(4alxoxrcio1laDrlnei;t teuoxr nudapenlfcia(f 2rau p;o1tpe iieiysfm2rmnmo;() lxnif3oadfpt  n olt srtrxo3no1apt lfet ( s2rm(moou4tptnioetysls2elums (4 lxrmf3oodlptrauvils teuo(r3iy1open net s)sDumxmoot0oee moeild a2uan s;t) rxoif3tadlptraueo t0 rtm(mpio4omeemnci (farumum oo1opx mfciyd mDua( p;t4aeenxf3iadlpDraneil( setoir ny4alte ncsl(fsrra(m no0tetomfciasfm umu p u)tltnmo3oodlpDelu ols) rxr(mpoodol nlnvia( s2rau pot1olxomf3iasfsDum(mp;u)artrmr3oy1lp rluvsls)s2umio io1opee neil( s2tr(rp;t4optomfciadlm ua( s;u) ltnxr3iydfm raneslt)trtm(r3nu4lmt livils sDuaxm ;t0optn f3iyt s eaumo;t0teenxfcoydfpDelies;t) exrir3ny1lpte ivs t s2tmurpoo0aeto fciysfaDrlnmp t0alxnmf oytopt livs;t trxrirpiydapen fvslt aruau pnu1aetniieilsls2em(vs t0tlermrcootla eaueol( t2umio3iy1oltn fvsls artrxmo;o0olt mfeiadla uau s;()tlxrif3tatomDeaneils)srtmimpnu4lm emnciat)aDumur nu0opt mfciad m elnmsn(4artrmo3oy1fpDrlneol(0 eurxrpiudal  lfesltfa2tr( ono1ape if3iytfmDem(mo;t4tlenmo oy1fm e nes;s) exoxm3ou1amtnmfci s)sDrmxmono0oetoio3tys mDeaums;u) ltoxr3oa1fa   neo s sexm(m iy4apenlfeiasfa2uax pot0oexniictldfm2rlu o u0 eenmr iatfp  auvi;()t2xoxopiy1llt lnvtasfsDrrxr ou1apt  ociltfaDean snt) lxrxo3oa1lmD  iei;()setoxo oy1omeemici (f Dtmurooo1alxomf3ilt s2uaump u)tltnxo3oo1fptr nei t) etm(m3no4lmt lfvsltf rtaum ot1teeo o3iat mDelnvo;u) rxnxo3iydlaDean o;s)trxrxr ou1amtnlivsa()srrrur ot4oetoio3tltla rmn o (0 rxomfcia1lmDrlnesls0trxmxo3ou1lp emfcils)s2ta( o;t0oeeo ieiydfaDrmn p;t4aeenmr tadfa ean s s)seuo(opoudole mneias arrrxmpot0tlx  o3iatls2el(mo;t4texoxf tydfpD aneo;s) 2to(m3io4ap elicsas)s2urxmpot0optn ociysfa2um( o;t4 lerif iy1fatrlnvols srxoio3io4ome mictl()srrru p;o1oleo icildlaDemnvp t0texrxr tytfpDr n o (  rtrio3io4lltemiesltfsruax ono4tpx io3iatls uauvo u0 rtrir ootoaD luvi s0 rxm(m3no1al  mici ( a2tmx o;u0apxomo3ild s2uln p t) lenif3iytoptelieolt  rxr(r3nu4lmtelfcsasfsrtmx onu0olx mietytfs ra( s (4alerxrcoydfp r neol( seum(rpiudol  lfvsls  2tauro;t4oeeo ieiatfaDraumo;t4tltnio3oatlpDe i o () eum(o iu1lmte nesa(f rrr(  nt1oeeomo3iatfa2um( pnu4artrxrcio1omDrlu slt0trto(o ny1apeeliciasfaDumxr ;o0tpeomi3iatfa ulnmsnu4 etnio iotoaDraieo (0srxr(mpoy1lp elivs ( s2rmx  ;t4tex mo3tatls2uluvp (0alxnif3tatfaDranvo t  2xmxo oo1ol  lfetat a2ta(rp;o4tlenmocilsls ua(vp;u)treoxfcoatlatraueo s0seuoim iy4opt  nvi (  2rr(mp;t1aexnioeiytfa2ua(ms u0 ltrxoctadfpteau s ()s2um(m3ou1opt mict t) Dur( pnu4tpt  oeiys a ran p u)trxnmr3iotlatelieo;s0s2xrio3iy1ol n netl() 2uaxrp;t4aetn i3ilsfmDul(vo u)alxrir oytlp rlnvilt)srxm(opoo1ol nmivslt) 2umu  oo0opto iciat a2rmnvsn() exoxf3tatoaD ln s;(0 rtmio3oydoptemiviat)s2rrum nt1apxniocilt aDuaums;t)tlxoxrcoatfptelies;t)s2uoir3no4llt  feil( a2urx ooo1opto f3iasfm ulnmont0artnmf oydom r ivol( t2xmio ny1altnliciasfaDraxront0ape iiciatlaDemn p t0texrmf oy1faD  n s (0 2umxm oo4olt lfvsas aDrau pou0tpxo feiltlsDean on() lxrxoctadomtelieo;s  2tmiopoydlmt mnvi s  2um(  ;o0olen ictlsla rauvp;(0areomrctotfat  nvs;( s2uo(mpiudlleemfvia() Drmur oo1olenif3iydla2ranvp;t) reomrcoodomteanei;s0 2ur(r3oudapeemnet s a2ta(m ot1ole mi3iyd m rau p;(0 reomo3ia1latelu o ()tetrxr oy1aptn iciat  Dua(ronu1oetnmietasfaDrl( o t0tltnir3oadomtean i;t trtrimpio4ome  iei sf Dtrxrpnu0olxnio3iltfm rau s t0trxomf totlmDe n s t seuoimpiy1alenmivia()srrm(r ;o0alt io3iaslmDua(mpn()tlxrircoa1lmtrln s t  2xm(opnodam nlictatf 2tm(ro;t0olenif3tld a eanvo;(4artnxfciadfpDeaivol(  2xm(m oo4altelivia()sDrr(rono1tetnmf3iyd m2eauvp (0aeerxo3ia1om elueil( s2trirpoo4olenmfvslt s2ra(mpot4tpenioeiltlmDelumo;u4trxnmo3tydoa  livol( trurim3oo4ape mfciltfsrum(  nu4opt  i3ilslm uan p u)aexnircoydlaD auvsls0s2toxmpiy4ll e ici s) rrm(root0aee ii3ilsls rmuvs u4 etrio todlmtrluvo;t0srtrxrpio1am elfet s a2raxm nu0apeomietytlm rlu o;t) rtnif3ta1laDeaneilt t2tr(o3iydomtnlfvil(f Drm(mo;o0aleo ictyd a2rmnvp u) exomoctytoat au ol() ruo(o iu1lmenlneil()srurumooo1alenioctaslmDrl(vo t)tetnmocoydfmD  uvs ( seumir3nodapt  ivsl(fsrrmuront4aeeomietyt s emumo;()aetoir3oo1fptrlnvilt)srxoirpiodlltelnet (f 2uaum oo4optnmi3ilt s elnmont4 rtnif3iatfpDraneolt)s2toir3ny1omeemivt sf rrmx o;t1ope ioeild a2rmnmo u4tlerxo io1op rauvi;()t2toio ou4ape  fei s  rrru o;u0aex ii3iadfaDeln p (0 lerxr3oatop elu ol() rtrim oudlpt mfet s)srrau  nt0alxo f3iasfsDelu p u0 rtnmo3oytoat anvol( teuriopoo4amtn nvtltf rrau  ou0apeniocild aDuaumpnt)tlxoxf oo1fm  lieolt0sexr(r3nu4apt mfvtat  Drmx pot1oetomoeiydlsDrmnmon(4 etriocoadlp eliei;()trxmxm iy4opeelfeslt)sDuru  ou4aetoif3ildlsDumnvpnt4aleoxocoy1fmDe i i;s0sexrir ny4lme lnciat)s2tau oou0apx mietltlm2emump;t4tetnxr3tadfmDeli s ( trxo(rpiy1apen feta(fartaur ;u1apenmocilsfa2eanms (4texrmfciydoa   i s;s)t2xrxm3oudamt  ivt s aDumxm no1oltoifeiatfsDelu o u0alenxrcoodfmDr ueo () eumxmpou4am nmfcsltfaDtm(r ot1apt mfctatfa2rlump;t0arxoxf ootfat lnvi;(0t2tm(mpnudlpen icsatfsDrru o;o4oexn ietadls2ran p;(0 lxnifcta1fmtrluei;s t2tmxr iu4lmt  fvilt  2tr(mp;t0tetniociatfa2umnvo t0arerircoadfm e neols)s2uoim3oodaleeliesatf 2tm(monu0oeeomfeiytfm uan s u) ltoirctytopte ivo t0t2xoxr3ou4aptelnvta() 2rrx pno4tet  f3tyslm2uauvs;u)altrmo3iydfp ranesls)srumim3io1lp  micslsf rumxr nt0texo octls s2uauvpnt4tlxrxo3iydlmDelnei;( s2umir oo1op e ies s a2rru  oo0oexo fctldlm rlump u0trxrxf to1oa   n i;(0seuoirpoudal e nesat)arrrum ot4alenmietatlaDem( pnu0 eerio3oa1fm  livo t) 2xmim nu4ll   nctlt a2tr(ront1alx  ieiltfa ea(mp t4aeermo3tadop   i i s)s2urim3iy1om n nes ( s2rrxmp;o4tlxniociyt m eau onu4altnxf3io1latr ivilt) etrim no1lmenliciatfs2tmx  nu1alxnmfeiatlsDea(vs (4arenio3ootfpDr uei s trur(rpiu4ale  ici s srrm(rono0tlxnmieiydfs2ea( s;u0 exnmfciodom rlueo s)trurxm3oydamt livia()aruax  ;u4aleoif3iaslsDrlu snt4alenir3tadfmD livs (  rto(m3iudole mfctls) Drru pnt1oeenmicias a2rmnmont0trtomociytlptran i s trumxopoy1ol e fes sf 2raurooo0tlt ifeiatlmDemnvs;u4aeenxrciatop e i i s  2umxo3ny4lp nmnci s)arur(mpot0alx moeiasfsDrl(mo;(0tltnmociytlp rlieo s0 2toxopoodol   nciat)a2rr( pno4tleomo3tlslsDemuvonu) lxrxf iadop elues;t)srurxr3oy4lmeelicta()srrrx pot0oexnio3iat a2ean s;t0artnxocoy1fpDeli i ()tetrxm oo1al  mivsl( srrmx  ;o1oexnmoeiatfsDemump u4alxomoctytlp elivo (  2trxopiy4al emnvs tfartmurp;t0aexomo3ilsls2ulnmo;()trxoio3oodfatrln i s srtmxr3nu1altnlnesas artaxrooo1alxniieilsfa2rmnmp;t0artrir iatlp  lnes (0 exrxr iydomtemnetl(fsrumur nu1aleoifeilslm2ulumo;(4altoxf3tadoat livi;() rxmxr ny4ome  netl() Dtru oot4oexn octyt m2rln pnt4trenir3iy1laD  ues s)trtmxm3iu1optnlietltfs2ua(r oo4apt mo3tydfaDel(mon(0artoxrcia1omDelnei;( t2uo(o oo1amen fvsa(  2ur(r ;o4oltniietytla ulnmo (4alerxo tydfatr nvs;(0t2uoir3nodom emics (faDrrx  ot0texnmoctydlmDemump t0arxnif oa1oa rlu sls  2uo(r3no1ll n ici (faDrr( oou0oltniociys s2um(vpnt4 rtomo3oytoateai ils  ruoio iodll n nes () rua(rpnt4opxo ieiydlm2uauvs;() eeoxo iydlpD lneo t) ruo(m3iu4lmee nesasfs2rm( p;u0ope mfeiyslm eaumsn(4tlxrxf iy1oaDrai sl(0t2tr(o3oydlptelfei sf rraxrpoo1tpeoio3tyt a2el( o u0aleomociydoaD livo;s)seumxm3iodlm  lfciltfaruau pot0tetnmoctydlaDemu ont)aexomrcootlmteluvs;( trtoxr3nudlltnlnct s  rrrx oot1oet ii3tat sDrlnvp u4aexrircio1opDeluvo;(0 rtrir3iudaltelnei t)srur(ront1aee mfctydfa2rmnvp;t0 etomr3tadlpte uei;( teuoxopiy4ameelfvsls  Dtrxmpno0olt ii3tyd mDum(vs t4 rxoiociadlp r u s;t0s2uo(rpou1apeelneta() Dtr(rp;u0texo oeiltlm umnmp u0aetnio3ta1fa  au sl( sexmir3oy4oleelfcia()sDuaur ;o4apx mf3iad s ulu o;u0tlxoio oytla  auvil() rurir oy4alte ieiasfartmxmp;t0oeeniiciad s2em(vp (0aleoir iotlm ran i () exo(o3ny1alt lnci tfa2ra(r nu1olt iieiatlaDrln pn(0trxniocoodlateauesls t2xrir3no4amee net (f rtrxrpnu1tee  oeiydfmDul(ms u0aetrmr3oadom r nvo;t  euoxrpiy4amtemfetl(  Drrxr ot1apt io3tydla2ra(vs u4tlenxr3iadomDraivsls  rxriopiu1oltnmfeiat a2rrxmo;t1teenioctls a2ulumsnt0 eenif3tytfpDe uvs t0t2urxmpno4oltn nct ()aDururont0texn fciysla2elums u4trtrirciytomDeln s;()s2toir no4ll elfvtl( sDuaumono0tpx  fctyt a2elu p t4 ltnifcoytomD li o;t0trtoxo iu1om  mfes sfs2um(rpot4teto ociatlm2uanvp t4aeeoio io1oaDelnvi t)s2xriopoodlltelnvtlt)srta(mo;u0tleomfetysfs ran p;()tlxoxf ia1fm  au olt seum(o3iu1omtnmfctatf Dumumoot1opx  ociasfm2rlnms t0 eerxo ootlatrlnes;( sexrxmpny1lpenmnvsltfsDrm(rpnt0ole moeils m ulumsnu0alenxf oadfmDeluvolt t2uoio nydapeelict s  Drr( ono0apx iietls s rmn p;(0 rxnmfcoodfatr n sl() eto(opnydop nmfcslt)sDur(ront0oet  oeiasfs rmuvo;u)aexnxoctadfmD liesls)sruoxmpiy1aptelncs s) rtaumoot4aexnifeiaslmDeanvo;(0 etrio3oadfptrln slt)s2xoir nodap  mivils  Dum(  ;o1teeoifcildfs2rauvo;()trtrxr3oydlmtrlueo t t2urxo iu4altelfvil( aDtmur ;o0opxn ociadls rmu p u)teermrcoytomtelivi (0teum(mpny4ol n ivs t artrxmp;u4oee moeiltfa eanvon() ltrxfciotlptelieolt trurimpio4lmt mfeta( sDtm(r ou4altoii3iatlaDea( o;(4 exoxr to1latr u i s)trxmim3nydomeelnetl(faDtmx  ;u4aeto ociltls2umuvo ()tlenmf iotlmte nvo s  2xm(rpno1ll nlnvslt) 2ua(monu4aex  ietyslm2ran p ()arxrxf3oo1op elivi;t)srxr(r3io1alenlfeslt a2urum nt4teeniieiydlaDul(vs;u)teeoir3to1fpteauei;( trtr(mpiu4alee netltfs2rruro;u0tpt ioctldlm2raums;t4arxoio3tadomDraneo;()t2tmio ou1ap nmietlt srumxr ;t0tltnioeiadfm2ulnvpnu)tetnmo ootopDranes s0s2trio oydlptnmfeilt sDuau pou1ole  i3iatfs2elu pnu)alxnxfctatlpD  i ol() etriopiudlp elnctl()aruaxr ;o1olen i3tltfs2eaumsn()tetnmf3iytlptraueo;t truoiopiydam e ivs (  Dua(mp;u0tlx moetlsla2umu p t0tltrifcty1opD anvo;t0t2urimpoudllt liei tfa2uaxmp;t4olxn oeilsfm2elnvo;()tetnmrcta1lpD ln s;t)texmxm3nudapenmnvslt) rumxr ot0aeeoii3tydfs rluvs;u0tlxnif3iy1lptr u s;t)sruoxrpoy4omtelnesat sDtmu pou0apeomoeias m el( p u0texnxocootoateaueo;s)s2to(m3oodlpte fctl(fs2rmx p;o1oeenmociytfa2ran p;u0 etoxr iatoa  livo t0setmxm oydlpt lfcs (  2ta(mpnt0tltn f3ildfa uan p;t0treoxr tatlpDeanvil()tetmim3ou4ape  fcs sfaDrmur no0altoiocildfm rau pnt)artrircoa1omD luvo;s0s2trio3io4altelnvi sf Drax  oo4aexomfeiytla2elnvp;t0aeenmo3iytlptr uvols) 2xo(o3iu4ol nliesat artrxr ;u4tlenmi3iatlm ul(mp (0 etomo3tadla  luvolt)setoio iy4ap nlfct tf 2raumpnt0aee ii3iatfaDrauvpnt4aexrmfcta1optrlnvs;s0srxm(r3io1lltemfvsas) 2ur(mont0tpx iociadla2rm(msnt)alxnmocoytlpD  u i t) rtoxmpnudol emneilt  2raumooo1tex micilsfa2emuvsn() exnirctadop eli o s0 rtm(o3iudal nmnvtas  Dumxr ;t0tpe ifcias a umuvo;u0 rtrio tadfpDrli o t truo(rpiodome lnvtatfa2ra(mpou4altnmieiysfsDelnvo t)arerif tadfaDe uei;t)srxr(o oy4lltn feiat srta(m ;t0tex  ictyslaDrau s;u)areoifcoadfmt luvo;t0trto(r nodop emnvils) rta( pnt4tpxoioeild s2umnvsnu) reomo iy1la eai s;t0t2urxr iy1apeelnetas  Drr(ro;t0tet  o3tldlaDemumo u4 rtoxocty1oaDeauvilt0srtoirpnu1lmtnlneias) Dum(r nu4alx ioctydfa emnmp () ltrmr oytoa e nvi s0 2to(rpiydlpt mfvia( a2rmu  ;t0tex miciadla ua(vo t0areoif3iadopDr n i;s t2umiopiudaptemietls s2rrumpou1tpxn f3iytfm elnvo ()trxrio3iytlateluvslt) 2tr(m iy1oltemfcsasfarur(moot0texnmieiadfmDrl( o (4aeeoif3ootlmDrluvo;(0 exm(m3io1lm e fvias arurxrpnu0oltnmi3iytlm rlnmo;t0 exrmocoy1lmt  uvo;s  2toim3io4lptnlietl(farra(rono0aleniietyd aDemnmo (0 eeoir oatoa raneo;s t2tmxo3oo1alen feilt s2urxr nu1tltn iciys m uanmo u0aeeoxfciotlaD  n olt srxmirpio1oleelieslt)a2trx ono1aee iietld aDeaumsn(0 etnmf3oydomteau o;s setoxmpnodapenlicias  2rrxrp;o0ole iicildfa ea( on(4 renircoy1opteaieo (0 rxoiopiudalee nctltf Dum(  oo1optoiiciltfaDeau pnt0aeenircoo1opDrlieslt) 2xrxo no1aptnlietas)aDrr( o;u1aptn oeiytls2eaumpnu4 lenmr iotfpt  nes t0 etrxo3oy4om emnvilsf rur(  ou1altoio3ildfa rln snu4texrifciotfmtelu o;t0trxo(m nudapt mfvia(fartr(mp;o1aet if3iydfs2emu s t) rxoxo3iadlaD an i;( tetoxo no4omen ieilt)s2urxm oo0altomi3iyt a emu p;u0 rxnioctydfa  auvs;( t2uoir no1lmtelnci t sDtrx ooo4tpx moeiydla uaumpnt4aleoiocoydlptr ieols0texo(o oodaltn fct sfa2urum oo1tlxoiieiad aDeanmpnu0 leomf3ta1faDelneo;s)srxrirpio1aptelietltfsDua(r ou0aptomfctydfa2rm( p u)artrif3oodoaDelu o;t  euoxm iodlm elietlt  Dtmumpnt0aet  feiat s2rmuvpnu)arxrmociytom ranvsl()srtmxrpiu1llt mnesl( sDtrxm ;t1apeoiictadlm rm(ms t0treoio3oatopDrli i;()tetoxm oo1lptn fes tfa2tm(rpnu0oeeo ieiydfm elu o;u0trtriociytfa ean il( truo(r ny1ol e nci t) 2umxm nu4aeeo f3iasfa2eanvsnu4alxrioctotlp raues;() 2xr(rpio4am e nei s arrm( pou4aet mo3iat s2eanvp u4 exrio3iy1fp rlneo s)srxmirpiy4lptn fvilt)a2rm(ro;u0aleo ieiltlm2um(mon() lxoir3iodlatelies (0trumxm3nu4lp elieiatfartaxmo;t4tpxn ociad a el(vo t0 etrmf oatom  aiei;( trurirpiu1ape lnvtl(farumur ;u4tpeniieiatfsDrlnvsnu4 rermr3oytlatr ieo;t)srum(m nu1ll  lictatfs2urur ;t4opeomo3tls aDemnvo (0treomfctotoa rlnvi (0 exr(o3oydlpt  fesasfsrrrxr ou0optomo3tld m2rlu s u0 lxrmo3iotfmDeanvil()trumxopiy4al n ies t aDurx p;t0olto f3tas m2ul(vo (0alxrxfcio1opt livs;(0 euo(o iudomen nesasfaDtm(m nu4ale iieiydfa rmu o (4aexoif3oodomDelnvi;()texmxm oy1ol nlnvsasf rrrxr ou4olenii3tlt m elnmon()trxrmf oydomtean s;s0texmim3oudlmt mivt ( srur(mooo4tpe ioctld s2uan s (4aexnif ia1om   ivs (0 exmxopiydlleelfct (farumump;u1oee moctysla2em( on(4 exrxfcootfatrlnei;s srxmxr3iydaptnmictat)a2tr(rpnt4alenifciltlaDrlumo () reomo3oadoa eaieo t  rxrimpny4lpenlivta(fsrtr(r ot0apxnmf3tls a2rmn p ()trtoiociydomDeaueslt  exmim nodomeemnciatfa2rax  ;u4tptn fciad sDeanmonu0alxnxo ootoatraivsl( truoio3iy1oleemnvt sf Dtmum nu1oexn o3iaslmDel(von(4aleoxr oydfatelivi;s0 rxmxo3iudal nlnet s) 2taumpot4teeo i3iydls2ea(vs u)tleniocia1fpt  u ol(0s2umxm oodam e ieta( s2trx ono4tleo ictydlm elu s () ltrxo to1omDraivi t) exrimpoydopeeliesat)aDtmxm ou1olto fcild a rmums t0 rxoxf3totop   uvs;t)trxrxo no4lp  lnetls  2urur oo1tptniietlt a2em( snu4 etrxfcoo1lpDr nvo s0 ruoir iodomenmnvil(f Dua(mpnu0optomicilsfmDran pn()trtrmr tatlm e ueo s)sexmxm3oudop e nvi t a2uax oou0ope micilsfs2eanmont)trxrmfcta1lpDr nvo;s0t2uoio3nudlmtnmivsa(  Dtrur ou0oeeoio3iyslm2um(vont4 rxoxf3oo1lmt  iesl( srtmimpou4ap elnctls)a2urxmp;u4apt  o3iydlsDumn p;t)artomfctatfmteluei t s2um(m3nodlltn ietat sDrmu p;u4oeeomfcilsls2rm( o t0artnio3iodfaDeauvolt trtmim3iudoptnmietlt) rtaum nt1aex moeilt s uanvsnt)aexomr oo1lmDeauvi;(0t2urio no1amt  ivil()srra(m ;t1texoio3iydfm2ua(vp;(4alerio3oytla r ueols0t2xmir3oydomeemictlsfs2ta(  ou4tptn octatfa ua(ms;t0areoxfcoydla rlues;t  rtoimpiy1ll e nvt s aDra(rpno0tlxn iciytlm ul(vp;(4 lerif oydla eanvs t0s2toxm3no4aleemfvsasfaDua(mpot1olxo fetadfaDrmu snt) etnxfctotlmDrlu ilt)trxo(mpnodal e fvi s a2umxrp;o4tpt  ictls m emnvo u0texnif iy1la ran i t  rumio nu1op nmiei sf Dum(r ;u1aeto ieiysfsDulnmsnu)alxoxrciytlaDranvi;t0trxo(mpoo4alt  nvsasfaDra(roou1oltnioetat a eln s;(4trermr3tytfateauvo;s) rumio3nydllt lfeslt sDrr(m nu0tlt  o3tlslaDean p;t4 leomf3oa1fate nei (0 2trirpou4am e fvs (fsDurxmoou4teenmo3ilsfm2eaumsnu4tlenxfctydfa rlnvilt)srur(o no1openlictl()srrr(roou4teeoioeiasfs rau s u)aleoir3oodfmDr ivils trxrim3iy4olt  ncsa( a2tmx pnu0apxoiiciad s eln o u4 rermfciadom rlnei;t)s2xrxo3nu4omeemneta(  rur(mo;o4altomictlsfa2rm(vp u)texrmfctotoaDr nvils)trxriopoudlpe  ieil( arrau ono1aleo fetyt mDul(ms u0trtrif tatomD anvo;t)t2toxr3oydlltemnviasf Dua(mono0tlxoio3iasfm2eau pnt4 rtrmfcoy1oaD an s s0 2umxm nu4lltnmnes s  Dtmxr oo4texoioetydlsDua( o (4tetniociy1fmtr u olt  ruoxr ou1ll emnvt ( sruau ont1aptoifeiytfs2emumo;t4 rxnmocoa1lpDeluei s)sexoxo3iudomtnlnciltfaDuaurpnt0open ocilsls umn s;u4artrir oytomt lnvils teurir oodopenlivsa() Dum(  ;u0oex ii3ilsfm elu s;u0artnmocoatom raivs;()s2to(mpnudolenlfvia(fa2urxm ot4oexomo3ilt a2ul(vp t0tetrio tatlaDeaivi ( t2toxm no4amtemfetas) rua(  no1oeeoii3iatfsDrlnvs;t4 ltnir oatfatraneols  rxo(rpoo1apte icias)sDtmurooo0tlt iietatfa2umnmo t4 rtnmr ootfp elies;s0srxr(m3iudlp  livslt)sDtax oot0altnii3tysls eaumpnu4aeenmocoydfp rauei (0 exo(opio1apeelivtlsfsDrax pou4apeomf3iadfm elumpn(0 lenmr oy1oaDe ivs;s sexmxo3io4altelneiltfa2rr( oou4aexn ieiyt s ra(mo u)tleomfciotom  liesls t2xoxmpnydll nlfeiltfarur(  nt0tptoiieiysla eln on()tlxnif3iy1laD livo ()sruoim3oo1op   ncilsfaDua(m ot1oet iieild mDraump;u) etnio3tadfp e u i t0srtoim no1lptnlictltfa2tr(r nu1tpeomfcilslmDemump u4alxnifciotfmDelivols0srto(r3ou4opt  net tf 2raxmp;o1aetnmo3iytla2rlu onu0teenir oa1lat lies t) etr(rpiudlp n nctat)s2ua( ont1apxoioeiatla em(mo;u)alxrir3ia1lmDe iei;s) rurxm oo1lpt  ies t  2uru oou1alt mi3iadfs umuvp;(0treoxrcty1faD  i s t  2ur(m nudlmeelnviltfaDuau pnu4tpxnmicild aDelu s;() etnmo3ty1fpD lu s;(0t2xrxo3iu4al emnvt () rurxmo;o0oleomiciyd s2rl(mp;u) lerxr iy1fa ranvi s)sexr(o io1ame  nviltfarraumoot1aee mfeiltfa ua(mp u0 reoio iydlp   iei;()t2tmxo oy4am nmncs s) rtmuront0tet mfeildfa2emnms (0tlxoir oodoat lu ils tetoxo iy4om  mneil()a2urxmpot1tpeo feildfaDeanmpnt0 etnif oo1lat ai s (0tetmio iu1omtnmnetls)s2rmurpou0tlxomfetyd m2elu o;(4aexnif oatlat luvo () exm(m3ou4lmeelies s) rumxrpou1alenmfciytfa2rmnmo u4aetnmfcoatlm ranvol( s2to(rpio4alenlfeils) rtaxrp;o0alxnmo3tas s em(mont4 ltrifcoy1om eln i s seuo(mpoydoleelictas s2uru pno4alen f3iyd m el(vp (4tlxnmr3totomt auvi t texoir3iu1am e nvslsfa2uaxroou4alxnio3iatla2rluvpn()trtnmf tadlatr u o t0trxoxo3iudolenlneil()sDrr(  nt1tex ifetlsfmDea(mo ()tltnirciatlmD luvs ()sexmxo oo4altnlnetl() rurxmooo4olt ifciadfsDel( o;u)altrmf tydoaDe nei (0tetrim oo1olt lnesls aDrmxront0tlxn octysls2el(mo;u0aexnifcio1lpD  uvs s0t2xr(r iu1altelivta(f Dtru pnu4tpt iictadlm uluvsn(4 leoxfcty1lp raneo t0sruoxo3iodal  mnvslsf Drm(mpnt1tleoifctas s emnmo;u4tetrxrctadlp  lu s;()srumxr3nu1am nmnct s  rtm(mp;t4alto fetldlaDum(mp t4 rtoiocoodoaDeli il( t2umxrpny4lmtn ncsl(fsDtaur ;o1tle  feiad m2emu snt)teerxf3tatlpt lieols truoio iodopeemfctl() Draxr ;t4oexnifctydfaDemuvpnu)arenxociatfmDraueo ()t2ur(rpny1ope mnesat a2uaum ;u0oet  f3tydfs2um( o u)teermfcio1lmtran ils0 rtr(rpoudll  mfvsas a2tmum nu1oltnmieilsfm ea( ont)arxoxr3tatop rlnei;s  rxrxrpiudap emivs tf 2tau  no0aex  f3ilt m2ea( on() reoif tadfa elu s s0sruo(opio4al  lncsls)srra(m ;o1aet iictldlaDrm(vs;(0aetrxfctatfptrluvs;t trtrim3oo4optelfvsas  Dtru o;u1aexn ociaslaDrlumo (4 ltoxocoo1fpt ln il(0t2tm(m3ny1lltnmfct s) 2uau p;o4opxoio3iat m eaums u) eenxrctatlaD lu ols  etmxmpny1amenmneslt)a2trur no1oet io3tysls umnms u0texriocoodfm e neo;t seto(m3iu4omtnlncta() rurumont0tpt ifciyt sDemnmo u0texnio io1fmDrlneils)s2tr(o iudaleemnvs sfaruaump;t0tlenmoctld mDemnvs u4 rxnmo oadfmDe ueils t2uo(opoo1alenlfeils)arrmx onu1aexo o3ilt a ua(msnt4texoir tadopteauvi t)texm(m3nodlmt  ivi sfs2rmurp;u4tpeomo3tyt a2rmnmont0teenxo oodfpt aneo ( trto(mpoy4ol  mfes tf rrm(mont4aexomfeiys m uluvo u4tlxrxo oydoa e ueslt) 2to(o3ou4omt lfcsas  2umxr ;u4tle  feilsfs eluvo (0trtoxr3oytlptrluvi s  2umio iodol e icsl(f 2taxm no1oex ioetydfm2rmuvs;t) rerxo todlptranvol()trxmio3oy1oltnmfeias sDtmxmpnt4aexomi3iytfs uan pnt0artrir3iadomDran s;t0 exrir3oydlpt lnvtl() 2ta(ro;o0oet iiciasfsDeluvp;u4 lxniocia1faDeai s;t)trtm(r oo4ap e ici t)sDum( onu4alenmieiatls2rl(vo;u0 rxoif3oo1fat anes;t t2uoxr3iydopen net ( sDtm(m nu0tlenmoctas m2uau s;t) etnio3oodfpteaivs;s setm(o3oo1olee iesltfsDurxm nt1tleoio3iyd a2ranmp;(0trtnmf totfmD  ies s0srto(m3iu4lpe lnei (fsrurxrpnu4apxoiieiat s2um(vs;t4 lxrif3oodlmt  n s s0 2trxmpiy4op n ivs (  rrrxront4tpxnmo3tls a rmums t)tlxnxfctydoat lu o t sexrirpiudllenmneilt arurxmont0apeo oeiadfsDelu snu4altnxfciy1om rauvol()t2umim no1lptemicta()sDurxmo;u0apxo fciyd m eln pnt4 eeoxr3oytoat auei;s0seto(mpny1lpt  iei ()artmxrpoo4aeen octldlsDeluvp u0 rxnir3tadfpDeli s t0 etmio3io1olt micsat) rtmx pnt4aeen ictyslaDel(vpn(0trtnif oytlate nesl(0srtr(r3oydll nmictls sDumxr ;t0tpe  ociyd a em(vs;()aeeoxfcty1fpDelnei t trtr(m no4ale mnvtls) 2tmx pou0aexoifeiadfa2eluvo;u)tltrxf oatopteauvs t srtoxmpou1lp e ivt ()a2umu  ot0tle mfeiyt sDrl( o (0tleomfcta1fpte neo;( srxoxr io1om  liet sfsDtru  nu4aet  ieias a2rlnvs;t4aeeoxrctotfmDrln s;t)t2tmxr3iudlp nmivslt)s2urur nt0aee ifciltfmDrauvpnt4aexnio oa1omte ieolt) etoiopiodlpt mivils  rta(m ot4altoio3ils s rl( snu4alerxf3ia1optrauesls)setoiopnu1olee nci ( a2tm(  ot1altnif3iytlaDel( s;(0 rxnxfcta1lpDrlu i ()setrxo no4apenmfvsl()sDrm(mpno4alenioctasls2uau pn() rxrxf3todfp   ieils) rtmiopiodameelfvs ( artru o;o4tpt ifetadla2ra( o t0aetoifcoo1oa eau o ( t2urxm3oydolt mfcs t sruaxrpnu1alxn oeiydlsDuauvo;(4 rxnxo3tatfp eai i s)s2uoxmpnu1oleemfviat) Drrxrp;t0oltniieiasfs2um(ms (0aetoifctydoa eli s (0s2umxm ny1ame mneia() rum(mp;u0tltnmf3ild s2ua(vp (4aeerir3iydfm r nes;t  2xrimpnu1op elfcsls) Dtau pou4apeomf3tas m el(monu)trxomo ootoat anei ()texo(o3iu1om   icsls)sDrmxmpou1tlxnmfciysfs rmnmsnt) rtniociydla rlueo t t2ur(o3ou1ol nlnetlt)aDrmuro;u0apto i3iltlm rm(vo;t0texnxf3totfmt an ol(  rto(mpiy4opeemnvias)srrrxmonu1apto fetlsls2eanvo;t0aexnifcio1lm elu o s0t2um(m no1amtnmfcs t) Dra(rono1tlxomoetyt m2umuvo;u4 lxrirciodoptrai olt t2urxr iudap emnetat a2uauro;u1ape  f3tldla2emumsnt) exoif io1opDeliei (  rxoxo3no1lmtnlivsa(f rururooo1oetoii3iatlm2eanms;t)trtoxr3oo1lp r neils0t2tmim3oy4apen ivs s aDum(m ;t4aex ii3tltlm rmuvont)tltnmrcta1lmDe ieols  2tmxr oy4lm emfes t)aDurxrpno1aptnmoeiltlmDel( o;u) rtoxfctytlmDrli ils  rto(o ou4ll  mfet ( sDra( pno4tltomoctldfa2emnvs t4 rxnxr oy1oaD  neo ()srtrio3oudlpte ieia() rumxm ;t0tee moctatfa2ulu p t4 etnmr3tytoaDr nes;s0srumim3iu4al  lncsltfartau o;t4tet moeiatfa rl(vo;(0trxrxr oo1lmD lneo;s t2umxm3nu1oltn fesls srrau poo4altoifciyd s2rm(vs u)aleoir3oy1lp e neo;s seumxrpiy4am n fvi (fsrrax ono0tle ioctyt s ul(mp ()aexnxrctydoptrluei t0sexmxopno4olee fvt ( s2urxm nt0tpxomociatlm2rmn p u0texomrciatlaD ln sls) etm(o nudllen iesat)arrrum oo0apenmoctydlmDulu pnu4trtnxr3iotoaDrlu i s0texriopoydoltn fvi ()aDtmxm ou1teen o3ild m ulnvpnt0 rerxocoo1op rauvils) rto(o3oodal  lfcil()s2tm(mo;t4olen icildfa2eluvonu)aetrxr3tatop  aueslt) rtriopoy4omee nctltf Drrum nt1alt mi3iat s2rlu s;()alxnxo3iotfa rauvi;() rxo(r3iu1ape lieiasfsrtau  oo4oetomociytfaDrluvo;t0texoxr3totlmDeln o ( t2to(rpiudalte fcs sfsrtrxm ;t1alxoifciyt a ua( s u4tetrirctydlp r uvsl(  rxoxrpoy4lpe  icil( aDra(rp;o1tltoio3tasla2ra( o;(0 rtrxr3tadfmteluvs t) 2xoxopou4ale lfvia()s2rm(rpnt0tex moctas sDuau s (4 eeomocoodla rlivil( trtr(o3oo1llen nvils  2tm(  oo0oltoifctasls2uln s (0tltrxrcoydlaDrlu i s)teumxm3oy4ol nmnvt (fsDtrur ;u0opto oetydls2elumsnu4 eeoir oatfmD anvols0t2uoio3ny1ale  feta( arum( p;t1tlt iieiys a2rmn o;u) eeoifcoy1oaDr i s s t2um(r nydlmtn nvilsfa2rmxrooo4apx  ociyslm umnvp u4altnxr3ootlpD an s;s  2urxm3io1alenlivs s srra( pnt4tlxo fctysfsDrau p;u0aexomr iodlmt lnvolt0trurxopoo1apt mnctas  2taxro;t4tlx ii3tas s2ea(mo;t4artomf oydfatraivo;( texrxo nydlpe  icsl( a2rrur nu4oee  f3tadlm ran s t4teeoif oytfmteaivols)s2ur(r3oodamtn nvs (faDuax  ;t4tee  f3ils a el( o;t4 eeoio3oydfmDelnvs t0 2uoxopiodlpte ict s)a2rr( poo1tlxoiietadfa em( o t) rxoxf oo1latelneslt)srtoxmpno1apee fvi ()aDraxrpnu0aeeomieiltfm eauvp ()tetnxr3ta1fm eliei;()t2umxmpou1ol  mnvt t aDur( o;t4opx mfctlsfa2eauvo (4artrmo3iytom rau i;()s2toxopoo1ap  micilt)a2um(m ou0tlxnii3iadlm2rmumo;() etrmr tatoaD li sls0trtmxr oo1opee ict (f 2tmumpnu1tex ifciys m2elump;t) exnxf3oatfaDraues;t) etrim3io1ol n fvil() 2taump;u0aexnii3iyd mDemu p;t4tlermo3iadop   u i ( trxm(rpnudomtelncsatfsrumxr nu1opt miciydlsDemu snt4aeeomocio1opD ai ils)srtrir ny4amenmivtlt) Drmu ooo1tpxnmi3tyt s2rln snu0tetnxfcia1la  lu o;()srtm(opou1openlfvia()s2um( pno4tlxn f3iltfaDeauvpnu0 leoxf tatom e uvo s trumim3nu1alt mnes sfaDtmumpot1tlen iciysfsDemnvs u4tltoiocta1fpDrluvslt)s2to(r3nudlmeemnvta( a2rr(mpot1tpx  oeiyd mDeanmo t0trtoxr tatoptrlieolt0t2toxrpoy1aptelfetls)sDumxmo;t4aexnmi3iydlm2uluvsnu)aeenxocoytomDran ol(0trumxopoy1ol emfvtlt s2rmur nt0texomicild m uluvs u4arxoxf3oytfpDeaues s0trxmxo no1ol emfvsas sDtr(m ;u1ole mi3ias s2umnms t)trxoir tatop rlneol()trxmir3ny4amtnlfcsas aDtaumonu4aleo o3ias a2ea(vp (0tetoxo iatoatelnvs;t) eur(m3io1lltn fcia( arta(root1olx ioctyd s2emu s;(4 etrif3iatfaDeau o (0s2urxr iodop  miei sfa2tmxmpot1opeo ociytlaDuau p;t) reomfctytfaDrau sls)trtoxo3oy1ap e ivia(farrru onu1optoiiciydlmDranmo;t)artomfcoadopt aieils t2xo(r io1opeemfeias sDumu pou1opx ifcilt m2ua(mp;u0aetoxf3oydomD  iei;(0srxmirpiudal e fei t)srraur nt1tptomi3iys aDelu pn(4artrmoctotopteaueils0t2xoxo iydlmtemncsat)a2taumpoo4opt ifeiatfsDuluvpnu0 etnxr ootopD  ieo (0srtr(o3no4alen icias)srrm(r no1olto o3ildls2emnmp;(0tlxnmf3ta1lmte i o;s0 exm(r3oy1al elieiat s2trumpoo4openio3iydfsDrlnvs;() rxnmociotfa   n olt0seurxo3iu1amen icsasfsDtrxr ou4oet mieiad aDrau o;(0alxnmfcto1lpD  u il(0 2tmim nu4llee icilsf 2taxr nu1tetnmf3tatls rm(ms u0 ltrxr oy1om  li sls) ruriopnodapt  fvs t) Dtaurooo4oetomfcild sDum( pnu4 etomrcoa1oa  lieilt teumiopiu1lmtn ivi ()a2uax pnu1tpt iietlsla2ran p t4teeoif3oatfat  nvol(0teuoxrpoy4lpt mnvs s) 2tmxmont0opt  o3iysls rmump;(4tetnmr tydfpteanvsls)tetoir3no4ome  nvs tf Dtrx p;o0apenii3iatfm uanvs;u4alxrmr oodomD livil()teto(opio4om  mfctls  2rru  nt0tptnmi3tlt a2elnmp;u4tltomf iadlat  uvi ( tetmio3iydll nliet t s2rau onu0tpenifeiyt sDumuvs (0aeenif iy1lpte n ils teumxo iu4opt lncs (faDta(  ou4texnmoeiaslsDumuvs t) exomo to1lm rau ils) etmio nydlmte net t)aDtru  ;u0tpeoiieiyd s rln sn() ltnir oodfpteluvi t)texmio ny4lmenlieta(fa2taxrp;t4olt mieildlm el(vont4tetriociytlmDrlu ols)tetrxmpou4apt mivil( s2rm(mo;t0oltomietlsfm ran s t4 ltnmrcoa1optrlueo;()t2ur(rpno4lltn nvtat  2umumpnu4ale  o3tyslm2em(mp u4 etrxr3ty1fmDr i olt)tetm(mpno4lmenmfvt s)a2tm(mo;u1tptomfciltlm2el(vont0 rxnxr3iydopDrluvi s srxoxmpny1aleelfctat srtmxmp;u1altoif3tldls elnmp;t4artoxo3iatlp e nvo;s0teuo(r3io1lp e fct tfarrmu oou1apen i3tyd mDemnvs t4trerxfcia1lpDrluvo t t2uoxm3iu1lmtemfeslt)aDuaxronu0olt  
\ No newline at end of file
@@ -0,0 +1 @@
+i s s sexriopio4lm n nesls)a2tm(mp;o1ape mi3tad a umn pnt4tlerifcty1oaD luvolt  2toim no1lme  nes sfartm(ro;o1alt mi3iltla elnmont) reomf oa1lm eauvs s)t2xrir iodlltn ncsat  2rmum no4tetniieiadls emnmont4altoxf tadlp   n o;t  exrxo3oy1ol nlnvtls  2rmxr ;u4oeen oeiad a2eln o;u4 rtoirctatlptr u sl(  exo(mpoudlp emivs s aDrr(ronu4aexomieiatfaDran p;t4 rxnmociodlatr ueols) 2umirpiodll e nviat)aDrm(mono1tpeomo3tltlaDrlump;u) reomociatfpDrlivi;t)texrio oy1alenmfcs sf Dtr(ro;u1olenii3tadla uan s;u)aetnirciytfmD  u o ( srtoxr3oy1ole lfes t aDrm( poo4aexoioeiyd mDrl( o t0tetrmo oo1optrlneil(0tetoxo nu4ap  lics t  2ur(rp;t4altoifeiys s rmuvo;t4artnmociodlp ean sls trxr(m3ny4amtnmfvia() 2tmxrp;t1aptomfeiydla em(mp u4 rtrxfcoy1oa raivo t srumio3iu1olt  fcslt)a2ur( onu0ole iocilt m eanmo (0teeoxf3iytom   nei;()s2uoio nu4ap elfcslt  Dtr(monu0tet  fciadfs2ea( s;(0teeomrciytoa   ueils) 2xr(m nudam e ivsasf rumx p;o1teenmi3tltlsDumn onu4tltnircoy1lat  iei s0trxriopoodal   fvi ()sDumur ou4ale mf3iyt m2umn onu)aeeoxr3to1omtrlu il()s2um(mpiu1lmtemicsatf rrrxm ;t0tltomieiltlm elu o u0tlxrxr3tydfm rlneo t0 rur(m ou4ll   ivt (  Dum(ro;t0aee mociat mDemn s;() lxoxrcio1oa e n s;s trumim ny4omenmnetat arurur oo1opxn ictad mDrlu p (4tetrmr3ootom e u o;()sexoxo oydopenmivi (fsrumum ;u4aptnmietltfsDuanmon(4 lxrmrcoytomteauvils)teurimpnudlltnlnvil()a2ta( pnu0oltnio3tldfa2emuvonu4 lxriocto1lp  lnvs ()s2tmio oo1lleelnes sfsDumxro;t1tle mf3tlslm2emuvs u0aexoiociadlmDrluei;t seurxm iydaptemfvilt) 2rrxmo;o0olto o3tltlm eaumpnt0aexrmfctydlp   n i s  2xrir3iy4am nlnes tfaDtrum ot0oeto i3tatlaDea( o;()trxoif ty1fm   nvs t s2um(o no1omenlnvs t  Drru ont4teenii3ildls ra(vs;(0 eerif3iodlate ivsls s2um(opoy4omenlivsl( s2uaxronu4oee  oeiysfs ean onu) exnmrcoo1oat livslt s2toirpio1ol  mfvtatf rtrxront1teenmi3tysfs rlnvp t4 etrir oa1fm e uvi s  2umxr oudlm e fvsls)srra(rp;t0tpxnmfctytlsDem( s u)aeeoiocty1fpt lu o;s s2uoim io4llee ivs s sDur(mont1opx mo3tytfs2elnmo u4trxnmo3oa1faDeauei t  rxmxm3iy1omte iei tfa2raurp;o4tlx  ietydls uanmsnu)arxomfcto1la e nei;(0t2um(r ou4lm n ivtls) rrmxm nu0aexnioeiyd m2emn p u)arenmr3ty1oa r neil()sruo(m nydll e ieia( arua(rpnt4altoio3iytfm2emums t4aeenxo3io1fatranes;( srtm(o3oy4amte nvtat a2um(moou4teeoiietysla um(mo;u4aexnmr iytoaD lueolt0srxoxmpnodol  mfci s a2tm(mpnu0opxo i3ildfs rau pn(0 etnmrcoo1fm rlu s s)trxoxrpnydol elfeiatfsDua( oot1apxomo3ils m ulnmpn(4 ltrxocoy1fm  anes;s0 rtoxo3io1lmt  fvslsfsDum(mpoo0alxn oetlsfs uan s;t4 eeoio3ia1fm   u i s)seumim3ny4lltelfetas  ruau  nu4apxo iciat m2rmn s;(0 ltoxo3iodlpD  ueilt0trxrxr nydlptn fci tfsDtr( pnt0aexoifciydfsDrmu snt4 exoirciotfp eai i;s0trto(o nodom nmfvtas s2ta( o;u1altnmoctasla rl(mp;t)alxrir iytoat ai o;s0seurim3iodalt  ivtatf 2tmxr ;o1opxnmi3tytlm2ran ont4trxnmoctatomt aies;( s2xr(opiu4al nlivia( arrmxm ;t4alx mieiyt aDrauvp u)trerif oo1oaDelieo;t0 rxo(o3oy1lme mietls s2rrur ;u0oetn f3tytlsDel(vs u4aleomrctydoat lues t0 ruoxrpou4ol e nvsl()sDrmxro;t1olt  ieiasfmDrln o (0tleoxfcoadla  anvi;t0sexoxr3nu4ope mfei sfaDrrur ou0apeomfciydls2ul(ms u0tltoif oatlatranei ( srxrxm3iodom e icils a2ur(rpno1olx  ociatlm umnmo;t0aleoxf iodlmte ueo;s  rtm(mpny4lm elfctat)sDtax onu0tex  feilsls2ua(vo (4trxrxo3iodoaDraivo s texoirpnodal  liviatf Drau  ;u4aex mictld m2ea(vo;u0aexrmf3oatomte nvils0sruo(m no4lltemfvi s)aDtrxrpou0aexnmi3ils aDuaumonu0 rxnio tydoat liei s tetoxrpiu4amt lfvtatf Dtm(m nu4oet mo3iyd mDumn pn() lxoxo3oadomDe i ol() rxrxmpoo1lpt mnvtl( s2rrx oou4aee mi3ilt s rlnvp;() etnir3oy1opD aueo t)texrim3oodop   nviat)arumumpoo0ope  i3tlsfm2el(ms;t)altnir3to1oa  anvs;t)tetoiopoo1omeelivsat)sDtrumooo0tet ioeiysls2ranvo;(0trxomf3iadlptrau s;() rxr(opoy1olt mnvsl()aDum(mp;o1tle  i3iat mDean pnt)arerxrciadlpt  ueils)setoio oy4llenmfeiatfaDtr(r ;t0ope iictyslm2eluvpnt)alxoio iadomDelnes;s0seuoxr io1om   nei ( a2raxrpno0aleoiocils a ranvs u4aetomfcio1lmt  u il( t2xmio oo4omtnlics (fs2rrxr ou4ape mi3ilsla rln onu0 etrxr ootla  livsl()truoxo iodoleemfesltfsDtr(mpnu4apenmocildfsDrlnmsn(4 ltoif tytlat lnvs;()srxm(mpiudlmt  ncias) 2tmumpoo1apeoifcilsla rlumonu4aexnxocoatfpt luei s) exmir3oo1op n ivsa()aDtrumpot0aet  i3tld mDrmnvon(4 ltnxfcoa1fmte ues t  etr(opnu1ap  liesls)aDurumpnu1tpeoio3ildlm uauvon(0artrxfcoytlpt  nvs;s0 rxo(r nodom  lfcils)sDtaxroou1oeto o3iys a2uau ont4arenmrciodfpD luvi ()t2xrxr iydalen feta(fs2rmxmo;o4olx mociyt sDrmnvs;t)tltnxfcto1lmDraieils srxrxo iy1lmt  ict t)arta(ro;o1tpeoifciatlsDuluvon(0teeomr3tatoaDeln o s t2umio io4lmtnlietat srtrur ou0ole mo3ildfa2uln pnt0teermf3iydomte u o ()srxr(o3ou4amee fvt s) rrrum ot0tpe ii3iysfa ua( p;t0arxoir ty1lpD anes (  eur(o iydapeemfviat) 2urumo;u0tlx  fctytlaDeluvonu0 lermo3iy1op  luei (0trumio iu1ape mnvs tfsrtrxroot1tpxoifcils aDea(vo;t4alermr iatfm raivi (0 2xmxr3nu4aleemnet s) Draumpnu1tpenioeiltlsDrmnms;()arenxo to1fpt anes ( trurimpiy1alt lfeslt sDrrump;o1tpxo i3ild aDra(vo;()tlxrmr iotlaD livi s)s2toxr nu1llt lnvsat)s2trxm oo4oleniieildfaDumums;t)alermf iy1optrli ils0truoxo3iodapee icilt  2rrurpoo1alx  o3iyslsDrau o;()trxnmocoo1lpDr ieo;s0t2xoio3nu4lleemnvtltfsrrrumont4oeeoii3iadlaDem( onu0aeenmfcoatlmtrln s;(0setmxo3iy1ale  nesltfarra( p;o1tle  ieias sDrl(vo;(0alxoxfcoo1fp  anes t texrim oy4op  miviat srur(m ;t0tet iiciltls2uauvp;u0tetnmf tytlm ranvs;t tetoir nu1omtelfctas)sDum(rpnu0opeoiociyd m2ul( p (4 ltomr3tatopD aivil(0t2xr(opnydllt  fci sfaDrmur ot4oleomfeiytfa eanvp;u) rtrmr iodlate n slt srum(rpou1aleelics s)srrrx ont0alxnmieias a emu s u4alermr3todop  lnei;( t2xr(opiudlmt  nviat)srumum nu1teeniocils s2eanvont4artrmf3oy1lmt luvslt  2trxm iu1apt mneils  rtmu  ;o4ole  ieiytla2eaumo;(0tlxnmr3tytoat  iei;t  rum(mpny1apt lfcsls sDuaumpoo1apeo f3ildls2um( p u0tlxoxr3iodfm  lnvi s)texm(r iodamenlfvslt a2tm(rpnt0oet ifcias sDemnmon(0tetrmf3to1laD  i ilt)s2tmim iy1lp elnct s  2ra(  nu4olxo oeiys m2el(vs;t)alerxr oydoaD aneslt srxrir3ny4oltelicils)arumxrpno0alx  o3iatfm2ran o;() rxoxr tytfat aies;s  2um(m3no1lpt  fvt s  rrr(m no0oltnmociaslm2uln s ()trenxrciytla elnvils0 2xr(m3iu1al  lfviltfsDrrxmo;u1teto feild a2elu s (0aexnmo3iy1om rlu ol(0 rur(rpou1llt  nvsatfaDum(ront0opt  fciys s emnmpnt0altnmr oytom  lnes;s) etr(mpou1apeemneia( a2tmxm nt1tetnmf3iat mDrl(vo;t4 rtrxocio1lmt luei s0texoirpoudomeelivi t)sDtrxmpoo0alenmictadfa2elnvo ()aleomr totfptelneo;s0sexmir3iydlpe  fvi tfa2tr(r ou1aet mi3iasfs2emnmont4arxomo3iydlat ai slt seum(r oydllt lncilt)sDtm(  ou4aexnioeiatla2el( o;u)trxrmocto1lp   n olt0s2xo(rpnydlm  mnctatfsDrm(rooo0tpxomo3iltla2umnmo t4 eermfcootla elivil(0truoxo iodameelfvias  2tru ont1oltnmf3iytfs2ul(ms;t4 lxnxrctytom ran il()s2xoxr iy1ape  fei tfa2rrx ooo1oet io3tysfm2rlnmsnt4aexomo iydfm e ues s) etrir3io4altelneil( s2rmumono4apeomoctydls2umnmp;t) rxoir3iytfp e i o;s)srtrimpoy1oleelicilsfa2trum ot0tpt ii3iys m2rlu o t) etomo3ty1fp ranei;s)seurxrpnodome  nesa( aDum( oou0alx io3tyt a2elumpnt0alenmr tytopDrln s;t  rxmxmpiydal elnvtas arrru o;o0tlxomo3tldla ua(mo;t4arxnio iotlp  anvo;t0seumxr3nu4aptnmnvt t aDumur oo0apen f3ilt sDea(ms t)aexrio3io1lp   nes;()trxoxr3io1lltnmfctltfsDtaxroot0aptniietad mDemu p (0aetoif to1fmDr nesl() rxmxm ou4am e fcsat a2ra(r nt1opeoiieiyt m uaumpnu4tlenmr oydoateai s () 2umxr3iu4ll nlfvsa(fa2tmumooo1aee  o3tyt m2emuvonu) ltomfcoydfm elu i;t t2umxmpio1amtemivtltf rta(rpnt1texo i3tadfa2ulnmp;()aexoir3iy1la eai i t  etm(mpoy4oleemnvsls artmuroot0texnifetydfsDea(vs;(0aexoifcoydfa r ieolt)teumxopoodlp   neil(  rraxmooo0tptnmf3tlsfsDrl( s;(0 rxnir iydlaD auvilt)t2um(r3oo1ll elietat aDuru onu4tleo f3iyd s uanvpn()aetrxo tydlpte ueolt  2xrxo ou1olt mncia() rrr(  ;o4tlen f3ilt a uan p (4tlxrmr oo1fmte nes;()t2xo(m3iudlmtnlnvi t srtr(rpou0ope ifctlsfs ua(mpnt) rtrmocoo1om   iei;(0srtoxm io1amtelieilsfsrurxmoot4tee iieias aDeanvs t4tltrxfciy1om   n s s s2xr(r no1optelnesasfs2ta(  ot0opxo i3tlslm2uln s t4 etnmo3oadlmtrau i t0 rum(mpnu1am emfviat)s2tmumpnu4apeoifeias mDem(vpnt4 eeriocoy1lmtrlieslt seurirpny4lme mnet ()aDurx ont0olxnmfeiytlsDem(vpnt4tlerxr oydlateaieslt)srxo(m iy4optelics sfa2umxmp;t4aet mictadlsDeaumo;t4 rxrmr iy1op rluvo (  2uoxr3nu4al n netl(  Dum(root0tpxn oeiat sDelu p u4tetrxfctytfmDeaivs;(0 rtmxrpoudllenmivslt)srtaxrpnt1openii3iad s ua( snu4tlxoxr3iytfa e ivols0t2tr(rpiy4lptnmfetl()srrr( p;u0alt  oeiltfs2ra( s;u4 exoxociytop  ai i s0 exrio3oy1am n iesltfaDrr(roou1teen oetatls2umu p;u4 rxnio ia1omt lnvs;(0t2xo(rpiu1lmenlnvsls a2urx onu4opxniocilt a ea(mo;(0aeenmr3oa1fmt ln s;( teumxr3oy1alen fcsatfsruauro;u0tlxn feiadla2ra(vpn()aexnmf oytomDeaiei (0trxrxopiodlm elfcsa() Draxmpot1texo feiys a2rm(mont0trxnxf iatfp rlu o t0t2toim oodape lfvs ()aDtm(r nt1opxo octad m2emumsn(0 rxriociytfmte ivs s)tetrxrpou1aptnlieia()aDrrurpnu0oee ifciys s rl(ms u) rtrmfcia1lpt luei;()srtoirpio4op   ncsat)sruax oot1tltnmoetltls ra(ms;(4 rxoir iy1latrluvslt)teumxm3iy4ale mici ( aDrrx  ot1oet  ociytla2em(vpnt) ltnmfcty1oa elnei s0setoir oo1olee ivsl( arrr(ro;o1aexoif3tytlmDrlu s;t4 lerxo3todfp eanvslt s2toim3ny4ap nlfvsa( aDrm(rpou4apxomociydls2em( s;t0 reriocootfm rlnes (0srtmxopou4om  lfvs (f 2taxmpou0altoifciatlm2rlnvp (4aetnmo ia1fpD an i s  exmxmpou1llte ietlt srtmx pnt1apxoiietldfmDuluvp () leoxr oydfmDe u olt)trum(r nydlm  lfeslt s2raumpou0olto feiydfa2rmnmo u)treniocoa1la   uei (0 rxm(r3no4altnmivsat)aDtrumpoo1aeeomoetyt a2umn p (4aeenmr3tadoa  anei;s0texmxrpoydolenmfctls)srrmu  ;u1aex iietyd m em( s u)teenif3tatlptraues ()setoxo3nydaptnlnvsls aDuax  nu4aeeo i3iatfaDeln pnu0alermfcoo1op raieo s  ruoxr no1om e nciltf Dum(  ou4aexnio3iltlsDel(ms t)alxrir3oy1laDr nes (0t2xr(o oy4alt  fcsltf rtmumpot4olenmoeilslm rl(mo;t4trenmo3ta1lmt lnvo (  rxoxo iy1olenmnesltf rrmxmono4tpxomiciadla elnmp;u0arenxocoy1faD  ivo;(0seurxo3nu1olt liesltfsDrrur nt0tlx if3iasfa ran pn(0tetrmf todomDr uvi s0t2xo(m iydol elnvtasfartrxr oo1oex ioeiltla rmuvpnu)aeeomocoy1fa r i s t)setrxr ou4aleelivi t)sDrm(rpot0tptnmicias s2ua(vp;(4 eerir oy1op eli i s0 rtm(mpiu1omte ivslsfa2raur nu4olx ifctas sDea(vo t4 rtoio ootfa rlu i;(0t2xr(opoudapt lnvsls sDtr( pno0tptnmiciatfs2uluvpn()aeenir to1lpt  uvi t0 2uoir iudom elneia()artaur ou4oexomo3ild a elump;t4arxomo3tatom  luei t s2xr(r3io4ol elfcil() rraxm nu1opto iciadlm rlu o t4alxoxf iytfmDrli sls srum(m3iodaleelfcils) rurxmp;o0aeeniieiadls eauvp (0 lenxfcoy1oaD auesl()srxo(rpiodape  fvt ( aDtr( pno4tpt  i3tas mDemn s u)aeenmr iadlm r i o s)trxmim oo4opee nvi s aDrru pno0oltniieilslm ea(msn(4trxnmrciy1lp e iesls0setm(opoo1lp n ivsl(f rrr(mono0optnmiciadlmDumuvs;t)tlxnxo3iytfp rli s t0srumxm3oo4lp emfcilt) Drau p;t0tetn oeiasls2emn p u0teermrcoo1lptrlu olt)sruoim3ou1omtelfvsas srururpou1tet  ociysfs ra(vp;(4trtnmocoa1fp elivs t  2toxo iodameelfvia()aDtauroot1tlx iocils m2uanvp;u)texomf todlp  aivs;()s2urio3io1ameemfci t s2ua(m no0oexomi3iatlmDea(mp;(0areomrciotlpDrluvs (0s2xmxo3nydoptelieia()a2tr(rpou0oltomf3iys m2rmnms;()trenxf ta1lmD lnei t  rurxo3oo4am n icsl()aDta(r ;o1oeen o3tatla eanms;u)aexrio iytfp  ai olt0srtr(r3ou1olenlfetls)a2rrx  ou4aeen oetyt s rl(mp (0teenxrciadla r ivol()texmiopiy1ol nlieilt  rra(mpou1tlx mfeiyd mDrmnvp u)aetrmf oydomte n s t) rxrxrpiu1llen fcsas a2ra(mooo0texn octltfa2ean pn()artnmo oodomD anvi;t)sexoimpoo4opt lfviasfaDua(r ;u1aexnioctytlm2rluvsnu0 rtnif3oa1op  aivs;(  rtm(o nydlpeemietas aDrmx  ou4aetnif3iltfa um(mp;u4 rtnio ootom   ieils  etr(m3iy4optnmivtls) Dtaxmpoo4alt mf3iltls2el(vo;t) ltoircootoatrai slt trurxo iydol e nvs ( artm( o;t1olxoiociad s eau o;u4aeerircoy1oa eau s;s teto(r3ou4altnmieta(fs2ta( o;o0apxo ociatfa2rmn s;(0teeoxf3tytfptrln sls) exmxr iy1op e nci s)arrrx pnt1tpx iieiat s2rlnmo u)texrxocoadlm  lieol() rtoiopiydlp emnct t)a2urump;t0aptn ietlsfsDemn s t4 eeoxo3iytfmDeaivi (0 euo(o ny1om   feias s2rmur ;t1aeeomfciasfmDra( pn()texrif3iatfaDran s;s)srtmxm no1altemnvt s srum(mpno1oeeo i3ild aDrl(mo ()texrmo3oytlm r i ilt0 rxrir nudlmee fctat sDta(  nt0oltomoeiyslsDuln sn()aleoio3io1op rlieols0trtrirpoy4ale  nvtl(  rrmur ;u0oetn ictatfa elnvo u0 exrxo iatfp r ueo;t  exmio3iodlltelnet tfsrur(rp;t4tpt  iciydfm rm(mo;u)arxnif tatfat ln sl(  2uoim ny4olen fes (  rra(r no0apt  i3tysls el(vp;t0artnxf oodfmt au s;t)trxmir no1am   ncta()srua(  ou1teenmfciadfa umnmo;(4artoxo ta1fpteluvo;s truo(o ou1lpen ivs (f 2rax ooo4tlx io3iadls rmums u)aleoir3ty1fm ran s;( tetoir iu4lleemivtlsf 2trxroou4ale  ociad m um(vp;(4 rtrxr3iatlptrai ilt)texm(o nu1amen ivsa()aDtrur ;o1altn octatfmDumumsn()texrmo3oa1lmDraieo;t teumxmpoo1lp emivsltfa2um(rpou1oeeomfctltlaDul(msnt)altrir iy1lmDeaivi () euo(m3oo4alte neslt)srraur no0apt  fetad a ran s u0 exnio to1optr n i s) 2trxr3io1am elivil(  2tru pno0teto fciydlm umuvont0 exomf oatfatr nvi t srxr(r3nu4lpenlfei sfs2trumpou0alt  i3ils aDuauvpn() rtnxociytlpteluvs;t)sexrxmpoy4ll nlictatf 2um(m ot4oex  i3iyslaDuanvs t)texoxf oa1fpt  i sls0 2uoim iy4lmeelnvtatfaDrm(m nu0alxn fetls a2um( on(0 rxrxr oatoa   ivo;(0 exmxr3iu4llt  fvsl( aDtaumo;t1oeeoio3ildlmDumn onu4alermr3totfpt lu slt trumim iydop nlivilt s2tmxm ;o1tlx ifcildls rmu o;() rermocoadop e uvol(0trtmxm iodameemiesa(  Dtrxrpnu0aeenioetaslm2uauvont0 etnxf3totlp rli olt  rxmxmpio4lm  lnesls s2rmuront0opxomi3ild m uanms t0arenxfctadfmDe nes ()seuo(r3no4optnmncs sf rumuroou0tet moetas s ean ont0 etoxr3iodomteau ol()t2to(m3iydol  livtat)sruaxr nt1open ocils m rm( p;()texoxf tytfpD aueo s t2xr(r iu4omtnlnvt (fs2tr( p;o0tpx  feias s2em( s u) leomf ia1fpteauvs s)sruo(r iudlmt lfvta()aDum( pno0tet io3iyd aDel(vo;t4aetomfciy1fat livs;s)t2xoirpiu4ap n fvs (f rtr(monu1opx iiciltlaDrlums t0aeerirciatop  lnvo;s srum(m ny4olt  fes t)arumxr no1aexn fetytla2emnmpnu4aetnxr ia1lmDr neils texo(r3oy4olee fetat) Durx  ;t1alxn f3tltlm ul(vo;u0tlermf iotom e ivols0sexm(rpoo1opeelivi s)aDum(rpno4aexn ieilslmDua( sn(0 lenio ty1fpDe n o s seum(r3ny1op elnesas)srrrxr no4apxnmoetlsla el(vp;u4teerxf3oytla  luvs s  2tm(rpno4lmtnlfvil(  rtax onu1tpe mfeils sDulu on(4artrxocoatop eanvs ()srtmxopiudomenlicsas)aDrmurpno4tetnmociyt a2uau pnt)teenirctodopDelivo t)t2xm(o3no1opeelfeil(fsDua( onu0oet  oeildlm eanmp t4aeeomo ia1omDelnes;s  exrim3iy1alen fctls  Dta(ronu1aexoioetatlm elnvp;t4texoifcoo1omt  uvs () euoio3nydlpenlnctatf rururo;t4tex mictasla uanvo;()teerxf tatlmD  uei;(0trxrxm nudlptn nct ()s2urumpnu0olt moetydlm rluvo;t0artoif io1fmDr nvi;s trtmxo3iodam  mfci s srrmu  ou1tee ifeildlmDrmu p u4aleoxr3oo1fp  anvs t  rtoim no1ape  fviasf rumumooo1alen o3iasfm rau on() exnmo ty1fmt aueilt) rtmxo3ou4llt lieia( aDurumonu4tle ioctltlaDrl(von(4aeeoxf3iadfmDeauvi;()t2umxm3io4om e nvsas) rrr(r ou0ape  i3iadlm2eluvp (4texrxocootlpt livsl(0trumxmpoydal e iet sfaDrr( p;o0olxomociltfsDul(vs (4texnircio1lmDeli il(  rxoxo no1oleemicias)sDtmx pou4opx  ieils m ea( onu0arerxf3oadlpt lueil() 2tr(o iodopeemfci tf Dtaxrp;t4teeo ieiydfsDum(mp (4treomf3iadfaDr neslt) eto(mpnu1altnlfvi tf rrr( pou1aleoifetat m eauvs (0alxomf3tatla r n s;s0 exoxo3oo1oltn iviasfaDtmu o;o4aetnmfetlt s ean o t4tltoio3ootfaD  n s s teto(o io4lltnlnvtl(f Duaump;o0aptomo3iytfs umnms u)alxomfcoytom ranvs;t t2xrxo3oy4aleelieia( srumx onu4olxn o3tad a uln p (0 exrxfctydfaDranvsl() exm(rpiodop  mics s)arra(ront1texnmfeiltfm ra(mp;t4 exomr ootfpte ivo t  exrxm oo4lm nmfet ()sDtmum ot4tet ifciyd s2rmu s;()aexoxo iotop eauvols) 2trxopnudom nlfvt (f rrr( ont4tpxo ociydls2rmn snu) leoif3iodop raueols0s2xoim oo4llt  ies ()aDta(mooo1apeoifciytls ranvo;t) leomf3oytlmtr ivs;t)t2tmim nu4op n ieilt)a2rm(mono0teenii3ilt s eau o;u)artoxfciadomt liei (0 rtoxr3ou1lmenlncsa(f rurxrpou0aet  feias m uluvpnt0arxrmo tadfmD lnvs t seumim ou4omee feiatfa2rmu pno1aleniiciydfaDrl( s (0artnifctadfa   nvi;() rxoim oodalen ict (faDuau  ot4apeomfeiasfs2emumo;u) eenif tadlpDelnvilt) 2xr(m3oudllee nci s)aDtaum ot1altniocils m2ea( p;t) eeoio iydom r neols0setrir3io4al  mfcils)arurumoot4optnmieiydlm rluvo;(0altrxrcty1fate nes;()sruo(o iu4oltelictl()a2urxm nt4oexomfeiad aDeanvs (4trxnircoytlaDr u i t0sexr(mpou4lmtelfvtl(fa2tmu pou0tltnmieiatfmDrmnmon()alxrxrciotfaDe i i s)srxr(r oy4ap  mnci t  2ururpnt1apxnmoetltlmDrl(msnt4arxnxo iadopt  nvo;s)seuoxo iudlltemfes (f rumur oo0tlen ictadlsDea( s (4tltnio oytla eanvslt0setr(mpoodole mictasfarrr( pnu0oetnmoeiysfmDumuvp;() rtnif iydlaDe i i;s0texmxmpnu1am elnviasfa2tr(r ;o4optoiiciatlsDra(mont4artrmrctadlmDeanvi;( t2tmio3iodomeelfcsasf 2urxrpno1tpeoioetaslaDumu o u4trxoxo iadfat li i;t) etriopnodap n ivtat) Duaxmoou1oet mi3ilslsDumums;t)texnir oatfaD auei () euoxm oy1ap   ivtl(fsrrr( pot4oet  o3iysfmDrmnms;u4texrxf3io1fa ranvo ()t2ur(opiudomeelicsatfsDua(r ;u4alto ocilsla elu s;u4 reomfctadfatrauei ()trum(o ou1ope lfei ()aDrmurpnu4tpenioeilsfaDraums u0tetrmrcoa1oateaues ()s2xm(o3nudalenmfetlsfartmu p;o4tltomoctysfs2uan p;() leoxocty1fmD au s (0srxm(r3nu4llenliei () rumurpno0olxo feilsfm rmuvs t0arermo oodoa e uvo s)trxo(m3iu4ome lfvi tfs2rm(r nt4tle iociydfmDulumpnt4 rerxf ootopt lu sls0 rxmim3ny4am nlfci t)sDrmxmp;o4tet ifeiasfm2rauvo;t)tltnir3tytlm  lnvs;(0 rtr(mpou4ap elieia( a2urur oo0olxomf3iatls em( snu0 reomo3oy1oaDeaivs;()srur(opiudlmtemfvsls s2uaxm ot4tpxomf3iatlm2rlu o;t)artriociodfp   i s;s0srxrxrpiu1optnlncsa()srumu  ou4teeoiieiadfsDuanvs;()tetnir oatlpt anes;t0trtr(opny4lmt micia(  rumurono0texnifetltla ea(mon() rxoif3ia1fm eli ols0 euoim3nu4optn fcil() rtr(monu1alen f3iatfm umu p u0artnmf3tatoat  u i;t0seumio nu1amt lict sfsrraxmp;o1aeto o3iydfsDra(vpnt0aeerxf oy1fmtrlu i;s0srxmiopoodlltelfvs s srua(m nu0tlxo iciytfa rlnvp ()artnxf oo1oa elueo;(0seurxm oo4aleelictls  ruru ont4aeenif3ilsla2uan snu0 lxrmo oo1fp raivi;s t2tmiopno1ll  lnctls a2umx pnu4oeen o3iatfa el( o;(4aetnxfcio1fpDe i sls)s2xm(m nodal   fetl()aDururo;t0olxnmicildls ul( ont4aexomf tydoatelivsl(0t2tmxr iy1lp nmnvi (  2urx  ot4aptnif3ild m2umn p u0tlerif iydlaDeai i;(0seurxopou4ole mneslt) 2um(m ot0olxnmiciadfm rm( o;(4aeerif oytlaDe neolt  rtoxr3iu1lle mncils)a2tm(  ;t0tltniietad sDrmu s;u) ltoxf3todfpteli s;() rurxo3nydoltnmnvils srur(rp;t0oeeoif3ilslmDrm(monu4tltrmr oy1fpt aieo t0 euo(opiydoltelfet s)srta(rono0tle  ictadlm2um(msn()arenxr3io1lat  uvs s0s2xr(rpny4lpee fvsls aDumumont1oexnmocilt m ua(mp u)texoirctadlpt  ueolt)texo(opnodalte iet s  Dtmx pnu1aex  i3tlt m uan o;(0 eenxo3oy1fpt auvo;t0teur(o3oy4lpee ieil()a2umuro;t4olx  f3tas m rauvs t0 rtoif iydlatr i sls0teuoir oo1amtnmnvtl()a2taxmono4alt ifciadfm ua( pnu0 rerio oadoaDr nvo;()s2uoxr3io4om  lies t)srrrx  ;t4oltnifeilsfs uan ont4altrmo3ootlpDraueo;(0seurxo io1olenmnetasfarurx  oo1oleo i3ilsfa2emuvs;(4trerio oy1latrln ilt) etrxo iu4ol emfviasfaruaumont4texniietadlaDea( s;()trtoxr3ta1opteluvi s0 rto(m3ou1ol e fcta(f 2ur( oot0oexnii3tldfm ra(mo ()teeoxocoytopD lueil(0tetm(rpoudol  lfeils) ruru ont0tpe  o3tys a ea( sn(0trtrxfctydfmD lieo;t t2xrxo3oodll elnvil() Drmu pot4texniieiyt s raumo;u) ltoioctytla e ieils0trtrxrpiu4lm nmfes (fs2rru p;o4tet iieilslaDrauvs;t4artrirctatfpDrai slt0t2ur(m nodaltnmnvtlt  2taxmonu1opx  ociasfa2rlnvo;t4 rxnxo io1lp elnei s)trurxm ou4openmietlsfs2tmu pno1tpxoiocils s ra(ms;u)alxrxfciatoaDrlueo (0sexrxo no4llt lfesl( s2tm(  ot1optn ociyd s um(mp;(0arenmfctotfaDrauvs t  etrim no1optelfcia(  Dumumooo1aetomfeiltlaDrm(ms;t4 lenxo io1om elieo;() rurxr3oydap nlnvilt arrmurp;t4aeenmo3iltfa umnmon() lxomo3oadoaD  i s;t s2uoxmpoy4ol emnvt t) rrmumpno0tlt ii3iat s2ua( snu4trxnmo3oadfmDe ivo s0s2urxr3ny4lmte feias)sDtmu pnt0olt if3ias a2ea( o ()aeenxf tytomDeaies t trtr(r nydlmte ict tf Dua( p;t0alt mf3taslmDrlnms (0 eerio3iodlate u ol(  2uo(rpnu4lp nmnvslt)sDurxrpnt1aexniieils mDelnmo;u4tleoir3oo1oatrau sls)tetoxr nodoptelfvs t)sDtr(root1aeeoifetadfs umumo t4aleomo ia1fpt auvi;s) rxo(m ou4om  liesasfsDuaxmont4olen ieildfa2rmumo u) lerif3oytlmte ieo s)setm(r3oy4apenmiesa()arrmumpoo1altoioctys mDranmont) rtoifctadfatr ueil(  rxoir no1lltelivs (faDum(ro;o4olenmfcildls eauvo;u4 rxoir iodoa eluvi ( texoxo3oodapee fvt s aruax ont0tetnmo3tyt s2emn o;t0aleoir3iodoptrln i ( s2urxr3ny1altemncslt srurump;t4aeenmi3tysla umn snu0alenxf3ia1lat  neilt seurio3nu4ol nlfei sfaDtmur ou0tetoio3iyslm em(von(4 etrmf iytlm   uei ( t2uoxrpnudol elneia()aDumumpot1oee mieiytlmDrl(vo;u4tetnir totoaDelivo;s  rxoirpnudomte iei () rum(ro;u1oexoifetysfm2ua( s;()trtoif3tytlmteaivs s)sexo(mpoy4altnmfciltf 2um(m ot1optoioeiys a um(mo (0 etoxrctydoatrluvo s t2um(mpno4aptelneslt s2ta(  ou4tlxn oeiytlm2rlnms u) rtoir3oytoaD anei;s) 2uoxrpiydop nlfvias) rtrxmp;t0apxn fcildfsDeaumsnu)trxriocoadlptraivsl()srtrxopoydlle lfvsltfa2urxmo;o4texo fetltfm2rlnvs u)trermo3io1la  ai il(0 etmxo3iy1ol e fct s) rur(  ou0optn fciatfa2emumsn(0altrmr oy1om raneo ( truoirpiu4alt  ietls  2tr( o;o4tet  oeiadlaDelnmsn(4 eeomocoatfp e nesls0 etmxm ou4lle mncsas aDtm(r ;u4tpt iocilt a2uanvp u)aetoir3oadfm  livi;s)texoio io4lle mfcs (farur(m ot1oleo ietyd s ulumsnt0aexoxo3iydfp r u s t)sexrxm3oo1ale  neilsfsrrm(mpno4ape mo3tat mDel(mp;(0tetrirciatfmD  n o;t0t2toxrpny4lpee fvtas  Dtmx  oo1oee mfciytfaDraumsnt0 leomoctotlp elivols0srtrxr oydlpe lnei () 2ra(mp;o0aexo o3iadls2el( onu0 rxnio3tatopDraieolt0s2xmim nu1llenmfesa( aDur(rpno0oex  fcild mDuanmsnt)tlerxo oa1omtrln s ( srto(r3oo4al  mivtat)sDururp;u0ope  ictysfm2elnmsnt0teenmf3ta1lmD aues;s)srumiopoo1amtemnvt t)sruaxm ;o4ale  fciyd s umumont0trxoxr3to1lm eauvil()t2xmxrpno1om elfvtl() Drmur ot1openmocild aDelu p t4altnio3totfptrliei t  2urxm3ny4lltelncslt sruaumpno1tpxn feiltfa um(vo u)treoxocto1fmD lnei (  rurxm ou4omt  fesa()a2trumont4ape ii3iatla rmumpn()trtrmr3iy1fmDeluei;s0 eumxm3oo4lltnlictat aDuax ont1apto ieildfmDemn sn(4trxnirctodoa e i olt  ruoxmpiu4lmt lnvsl(fa2ur(  ;u0tlxnmfcildla rmuvs t0 etnircootfmDrlnvs t) rumxo nydol nlnvsat) 2rrumpou1olt mfciaslm2emnvp;u)alxrxr oodfaD auvi s trtmim oydalee fesl()artmurpoo1tpt mietasfa rlumo;t4 etnmr3tatfatr ivs s0 rtoxm oy4om elfct sfsrtaumo;u1tlxn f3tltfs eanvp;u0trenmrciotfa e i s () rur(mpou4om n nviatf Drr( oot1apen ictytlsDulnmp;u4 eeomr3ia1lateau slt  rtmxrpoydlm n fcs s)aDua(  no0tpeniieiyd a rmn o;t) ltoxo tatfmDrln s;()teum(m3nodlme lncsltfa2tmxr ou0oexo ociatfaDuanmo;u) reoircoa1opDe nvsls)srxmiopny4ll nlncsatfaDtr(m nt1optnmiciys s rmnmp u0arxnxfciadla  aivilt0t2um(r io4olteliciltf Drmum ;t0oleo ieiatfaDemu s;t4 etnif oydfm raneo s0 euo(r nodaleelfeslt arua(moou4apeomoeils a uanvon()tlerxo iotomDr u s;t s2tmio3oy4aleelfeiat)a2trumono1tpe  ieiat mDrmn o;t)alenxr3oydfp   nes ( s2tmxr iy1lmtn ivslt)a2uaxr nu1olx moeiadfm2uanvpn(4 exoxo3iodlmDelieslt0t2xo(r3oydlp   fcs (f Dumx pno1oex moctatfmDel(mo () etnio oytoaDraneo;s trtrim3oy4llt  neta(fsrrr(mpno4aee mfcilslsDel(vsn(4 ltnxr3iadlp eluvs ( s2urimpoy1ameemicias sDtrxmp;u0teeo oeiadfs2rl( s t) exrmocty1faD ai o;(0trtm(rpny4ll elfei s) Drm(ro;o0apen ociydfaDrluvs t)artrif iotfa  auvols t2xm(r3ny4llt lnctat a2ta(ronu1oexoii3ilt sDumnvs t0 lxomf3tatlm r nei t)tetrxr oy1lp elfvtl()a2rrxroou0aee  oeiytfm2ul( p u0trenxo iy1lpDraivs t) rtr(m ny4oltnlieiatf 2ua( p;u4alxo fetas a ea(mon(0aeenmf io1optelnes t0 2ur(o iy4lltn ieil(faDta(moou4apxnifcildla2umuvo (0tltrxocoydlm   ivol(0setrxo ou4llee icil(fsrurur oo1opt  i3iydlm2emu s u4tlxnir tatoatr uvo;s t2xrxm3nu4ol nmivs t)a2rrxm nt1opto ociyd aDulnvpnt) etomf3oo1fpDrlues;s0seurxmpno4alen fvta(fa2rau o;t0texnmociltlmDulnmo u4artnxoctodfa   ivilt t2urxr ny4ll emncilt)a2rr(mpot1tltniietysfm2eln onu0 renmr iotlmteluvi;( t2trio ny4lptnmfetatfa2rrxm no0oeenii3tldfa2rmnvp u)aetoif tydfm  auvi t teuoxmpnu1omeemiei ()s2rau pno4altoiieiytfmDumu snu) eeoifcto1oa  au il(0srxoio ny4opee ietls  2raumo;u0tle miciadlmDem(mp t) rerxr3iydfmDe nes (  etrimpiydapt mietltfa2tax oot4apenmfctyd aDem( ont)treoio ta1omtrai s ()texo(m iodam elnciat)arurumpnt1openmi3tysfmDem(mp;u)tleoxo oadfmt lu o;s truoim3no4lmtemicilt) rtm(mo;o4alenioctat a rlu pnt) eenio3todlaDraies s s2xmxrpnydamenlncsltf Drmu oou1tlt mfciysfaDemuvs;t0trxnxo todfpte uvilt srxo(m3iu1omee nvsl()a2tm(roou1apxomiciat a ulnvon(0arxnxf3iytoaDr uvs;(0tetmio3iy1omenliesa() rtrxmpno0ale moeiad sDel(vo;(0alxrifcoo1lp eanvols0trxmimpnu1ol emieia()sDrm(mono0oee moctydls ul(von()areoiociatoaDe u s;s0texrim no1lmtelfcta(fsrtr(ront0tpen f3tldfs rm( pnt4tetoxr totlate ivolt) rxmimpou4optelfetlsfsrtru  ou4tlt mi3iad s rmuvo;t4altoxrcoy1opDr i s s0s2tmxmpio1lpt lnvilt s2umumo;o1aptnmo3iydfmDrl(von()trxnmrctytomtrln o s setr(m3ny4am elicilt sDtm(mpoo4aptoiictat sDraumo u4trermo to1lpDr ivsls) 2uriopiu4amtnlfesasfsDtmurono1altnif3tltfs ran pn(4 exoxr3oatlp   n s (0trtrio nu4lp elfct s)s2um(rp;u4alxo ictatls ulnmsn(4alxoxo io1faDraies s) 2xrxm iu4aptnlnetls)sDtaxmpot0ope  ieilt a2elumpn(4arxrmfciatlaD  uvs t) 2to(o3io1llen ivt s aDrmum nu0teeo o3tat m uaumo;t)texrircoydlmte u ol(0s2um(r3iudamtelnet (fa2tr( onu0olt ioetlsls ra(vo;u4 exomo ia1fate ivs s) 2xr(m3nu4oltn icia(fsDumurp;u4tex ioetydfm2uau o;u0arenxf oo1laDelueo;( srurimpnydape  feils)srtm( pot4tex ifeiydlm2em(vpn(4aetrmr3tydop  lnvil()t2umxo oodlm elfctat)arrru pou4oltomi3tlt a2ran o u0arenxf3totfmDrauei s trumir3no1omenlivi (f Drrx pnu0tex  o3tydlm ulumonu) rxnir3iydomt lnesl()sruo(m iudomtelics ()arurxr nt0altnif3iytlm2eln s;(4tlxomo oatfmDeauvolt t2urxo iy4lltemfeil() Dtaxmo;u4tlt  iciysfa2ranmpnu4 eerifcoadlmt anes;t) rxm(rpio4apt mneil()s2rrxr ;t1tpx ifeiltfsDuln o u4 lerxo tadla eaueslt0s2urxo iu1apt mict s  Drmx pnt4ole io3iyd s2uau p () renmfcta1fp rlies;t  rxmxopny4lm  mnetl()s2uaxmp;u4opt io3iytfm emn p;u0 lenmrcootfpD  uvolt)trxmir nu1lmtn fvil( aDta(rpot1tltn feildfa umnvp;t4trenxf iotfm ean s s0trxrxm3oydopte nvt s aDrmu p;u1oltnioctlslm2um(msnt4trtoio3todlaD aueo (0setmirpoy1lltemnci s) 2ta(mp;o1alxnmo3tadfs2uanms;(0aeeriocootfp rlueslt  2xo(m3ou4opeemfvta(fsDururo;t0oetn feils aDulnmp;t) rxnmocoy1fmt lu i;()setrir3ny4ap n icsl( s2trxrpnu0aee  feilsfs2rmumo;t4alxrmfciodfpD an s t0 etr(m iudopt mnct sf Dta(r ;t0alxoii3ils a2ua(msnu4treoifcoa1opDran o;t)srtmimpiodopte netlsfa2raxrono0oeenmoeilsfa rlumo;t0aetoif oytop eauvi;s s2urimpoudomt livsls)srtrxr nt0tex miciat s2rmump;t4 rxrmr oa1opt  n i (0 rxm(m3ou4lmtelnctls srum(  ou4texnmieiadfm elnmp t0trxnir3ia1lmDrlnvo;s0 etoio3iu1omt mnvslsf Dtrx onu0tpen octatlm rl( o;u)aetrir3iytfpt lnei ( tetoxrpiodoltelfvsas) 2ur(rpnu0alxn fctadfaDeln p;u)texrmf3tytlmte u o s0sexoxrpiudomen fes s) rrmuront0alenmoeiyslmDul(mo;(4tltomr3ia1faD luei;s0setmxm3nydlp nmnct tfaDtrum ;u1apxn f3iyd a2rlnmp;(0 lxrifciotoa eli i;s)setr(o3ou1oltnlfcs s) 2rrxr ;u4tlt iicilsfa uauvo;t)tetoxr oo1fmtrln i;( trtrxm iudam   nvtlsfs2ra(r no0open ieiad a rluvp u)teeomocoy1fp rai slt0setrirpnodlp nlivi sfa2rr(r ou4optomf3iasls emuvsnt4altrmfcta1lp eli i;(0 euo(opiu4lmenmfvia(fs2um(m ou0oeenmf3ildfaDumn s () lenir iadfm raues;t)s2xo(o io1lm elfvtlt)arrruro;o0ape ioeiytlm eauvont4aetomrctadfat  n s;() 2xr(m3iudam   ieiatf Dum( o;t0tetniietys a ua(vs t0 renxo oodoaD  nvo;t)texoirpnodlmt mfetas a2raxmo;o4oexoifeiatfsDelu snt4 etnxf3tytfpD  neo;t0trtr(r3no1omt  iei (fs2rau o;t0oexn feiytls2uauvont4 exniociytlmtran i;t)srum(o3iy1lpenmici ()artaum ;o1apxn ietatfaDumu s t4aexrxocoy1oat aues s)texm(m oo4llt  iet s srtru onu1oetn feiasfmDua(msn(4tltnmfcoa1oa  lnei;t0s2urio3oy1lmtelietas)arra(moot1tpxomi3ilslaDulums;(4altoif3todfp ranvo;(  rtm(o io1lmtn ici ()srrr(  ;t4openiietlt m2ra( snu0texnmfctytlmtrlivs t0srumxm3ny4lptnmneils a2tmu o;o0aptoiietatfaDrmnmon(4trtomo oydlaDrauvil(0 2uo(rpoodomte fctls) 2rm(m nt4oeenmo3tltfs raump;(0teermf to1optraueol()sruo(r ou4am emnci ( s2rmxmpnu1tle mi3iydlm2rmnmpnu4 rtnxf oytoa e uvi;t s2tm(r3oodlpenmfvsas)a2rru ont0oeeo f3tysls ua(mpnu) rxrxo ty1fp  livo t)sexmxm3ou4lpe liei sf rurx  ot0aex mi3ild mDum(mo;t0arerio tatfpt  ivols)trtmim3oudlpen fvtlt)artr(r ;o0teeniieiyslaDem( pnt0 lxrxr iytlmD livo;t0setm(rpny4ap n nvil( sDtmumoot1tlxoiieilsfm rmu s t)alxomr3iytfpDe n sls0s2tmimpoo4apeelncs tfsDtmu p;o0opxomfctad a rlu onu0tlxrmo oadomtr iei t0 rxrxmpiu1omtemfes (fsrtm(  ;u0altoiictldfmDulu p ()tlenmr iadfpDrluvo;t0texm(r3ny1ol  lnei () rrr(ro;t0tlx ifeiatfm2elnmp;t4 exomfctadlm  aueo;t  ruoir oo1lmenlnesat arurxmpnu4tltnif3tasfa2uln s u)arxoifciadoaDelu s t0srtmxr no1optelfct sfs2rr(rpoo4tetomfeiltlsDulu p;(0 ltrxo ta1opD  i i;() exrxrpnudlltemfct ()a2rm(mpot1oetn octyd m elnmo;(4aetoxrcia1lmDe i slt0 eum(o ou4lle  ncsa()aDum(mo;o4tlto f3iadlm2ra( s;(4 etrxr3oydlat lnvs t)srtrxr3no1oltelfcs (f 2taxr ;o0olxnmieilsla2ulumon(0 rtoxoctadlaDeaieo (0srur(m3oy1llt  neta(fartrurpnt0oet iociyd aDra( sn(4 etnif3iy1omDe ivi (  exr(opoydap nmnctl()artrxmooo1opxnifcild s2elu o u0arxrxf iatomtelu o (0texriopiodap e nvtlt arum( ont1tetn o3tydlm umnvsn()texnmf3iytlmDeaieols0 2xr(m3io1omteliei t)srra(mp;t1tpenio3iydfsDeln s (0 etrxo tydopt  uvi s) 2uo(mpiy4lpe  fetlt)a2umx pnt0tlt ioeiad mDuanms t0tleoio3oo1optranvs t)s2trim3oy4lp  mnvtl(fsDtmxmpoo1aetoii3iadlsDra(mpnt4aeerio3oo1lpt aies;s) 2um(rpnudlme  iviat  Drmxmooo0oexo fciatla elu o t) exoircta1fp eauvsl(  rxrxrpny4op  mncils)srrmum oo0texn o3tytla2umu o t0trtoxr3oydom  auvsls s2xm(m no4olenlivia( srur(rpou1alenmieiydls uanmo;(0aeerxr ia1fm elivs (0 euriopoodalt  ncsls sDrrurpnt4aexnmi3ias m2ulu s (0altnio oa1fmt  n il(0t2xr(m3nydapt  iei ( sDtrum ou1oeen fetlt m2eln p;t)aetnxo tydopt  nesl(0srum(opno4optn ivt tf rumxm no4oltnioeilt aDrmnvo (4 exnmr3iadoptr uvols seum(opnu1ap elnctl() 2uru ono4teeo o3iyslm umums ()altrmr3oy1fatelueslt0 eurxo3oy1alenlfcilt  Dtrxrpot4opeoiietyd s2ul(vs;u4aeermrcto1fmt anvs;(0trxm(o oodaleemies t aDua(rpnu1ape if3ias mDua(msn() rxomr3oytopteau s;t) ruo(o3oy1ll e icsas srtm(rpou0oleomieiltfs rauvp;(4altrmo3iodlp eliei s0tetmxo oy4lmeemnvt s)srrm(root0apeoii3tlsfa ulumo;u)aetomo ia1omDr ieo;t0 2xmxopoy1llt licias aDua( pno0teen ietaslsDrlnvo u4artrxo3oy1oaDeanvs;t s2tmxr nudapee fei (fsrtmxmpoo4alt  o3iltfsDua(vsnt4trtnxocto1faD lneo t0srurxrpiy4omt lies s arua(  nu0oltoii3iadlaDeau s;u0 etnioctotom  ai olt srxmim oo4lm n nei t) 2raumpnt1opt mo3ildls2umu snt0altnxo3io1oateln ils0 rxrxrpno1lptn ici t  Dtaxr nt4tet mfeiyd m rmums;u0tltoio oadfpteauvo;t0 rxmxm iu1lp elivt ()sruax o;o4tee iociydfa2ua(monu4altrio oo1op eai s t0srtoir3nydamtnlnvsltfartax p;o0oex mociltlm2rau onu) rxomociotom elieolt0 exoxopiu1lmeemnesls) 2rrxmpno0tpe  feiydfaDum(mpn(4 lxrif oodfa  auei;t)trto(opiodaleelfes s a2uaum no4oee ifctyt sDelu snt) lxomf ootlp  aneils trtmir3ou4omtemnviatf 2ua( pno4apx ioeiys a ua(vont)tlxnxr ootlmDrluvil(0teum(mpiudap  lics t)a2rmxr ;t0teen i3iys a rau sn() ltnmo3iodfa eluvol() exm(o3iu4ome liet s)srtmu o;t1oee mfeiysfaDrmnvs;u)treoif3iadopt  ueslt0t2tm(opnudamtn neia(farum(rpou1oltnif3iadfs ulu s t4 rerxo3io1opD  n slt)t2trio3io1ap nlivta(  rumuront4tpe  fetldfa eluvs t)altnif3iydfat lnvo ( srtoio oudapte ietatfaDuaum oo0optn fcild sDulnvo;(4tlermf tytom r uei;s0 2trir oodoleelfvi (fs2ua(mpno4aexn oetasla uanmsnu)trxoircia1oa r nvil()texrir3iydame  ictlt srrrx pnu4tlt  feils sDeln p;(4 rerxo3tytlaDeluvols0texr(rpnudoptn feiatfs2ra(r ;o1aexn o3iadfa el(mon(0 lxnmo3ootfmDran i;t0srtrxmpnudomen feil() Dtaur ;t4altn oeiys a rmnmonu4tlenifciydfaDeln s;t0teum(r3nydal e fetltf 2ra( ont1olxomi3ils m rlu s;u0arxoxocty1lm rli ols) 2umio3iudlle mivslsfsDraxrooo0opx  iciydla emnvp ()trtoiocoodop e ies;( tetmimpoodopee ivtl(f rumxmpoo4olto o3tydfsDelnvsnu0tetrmrctytfaDeaieslt0setoxopiudlmt mneta(f 2raur oo0opxo fciytfa umuvp t)tetnifciotomDrln s;s0t2toio3iu4ape  fcslt  Dra(rpot1ole  ociytlm emu p () ltnxf iatopDrlu o s0setr(rpoudapee fcslt aDtmur ;t1tle io3iltfm ulnmo t4trtnif ootomDeliesls)t2tr(o oo4am n nvt (  2uaumpnu4ape mi3iys a umu o t4tlxoxr oa1lm rlu i;( texoim3oudal elfvtltf rtruro;o4oltoifciadlm2rmn o u4texnmf iy1fp e n o (0 exo(o3io4om e net ( aruru o;u4tet mf3iydfm2rln o u)arenmo ty1optrlieols  ruo(m3io4lptemfvtltfsrta( onu4aeeomoeiadfaDemnmo;u0trxrxo3iotom   n sls) 2uoxo oy4lptn feils) rtr( pnt1apto oetydfmDumnmo u4 rtomrcoodfmDraues t) 2tmir iudape mnvsls)s2raxmpnt0opeo octadfm rl(monu4 reoifcto1fp eai s s srxmxm3oo4lmt lfes t)sDrrx  ot1tlxn ociyslaDemumpn()aexnxfctotla eau s t) 2trxo no4ap nlivs s)s2ta(  oo1opxnifciasla uaumpnu4trenif tytomDe ieilt  exmxr3nudllte net tfartrx  nu0ope mf3iatfaDrlumpnt4aeerio3iatfmDelies t0 2trimpio1lle mnei t  rumx pnt0olto octydfaDuluvp u)artoif tatopDeau s;() 2tmiopiy4lmtnmnvil()srtm(m ;o4tltn ieiasla2uauvo;(0 ltrxrctytfaD  n ils)srtmxo ou4olt  fes s a2rax pno1tee iiciydlm emnmsnt0tetrmo iytopt au o s setmim oydomt mfcsls aDrr(r ;o1aleo f3tyt m ranvp t0trxrmrctotfm raueols0truo(opiy4am elfeiltfsrurumo;u4oetn ieildfa2um( o;t) renxo iydfatrlivi;t s2tm(r nudllen ieias) ruauroou4texomf3iyd aDrm( pnu)trxrmf3iatoaD livs;() euoxm3iodomen fciat) 2trxrp;o0ope ioeiat m rmump;u0tleoir iadlptr ieolt0 rxo(o3oy1opeelnvs s)arumu  ;o0oexo ociatlaDea(vsnu0altomrcoa1fa rli i s s2urxr io1omenlnvil()artm(  oo4opx mieiytls2eanmsnt0trxrmrcto1op eau s;t0trtr(o3oo1amtelncsasfaDumxrpou0tlxnmoetlsfs2ean pn(0alermo3oodfaDeanei ( tetmxr3io1am elict ()s2uaxrpno4tlxnio3ils s eaumonu)tlxoio oa1oa elnvs;(0t2xrim ny1am  lnetasf Duaxm ;u1alx  octat sDul(vs u4tlxnmocty1fpD au o s0sexrio3oydlle mieils srrmxm ;t0tpe iieiatfa rmn on()areomfcootfmD  u o;s0t2umxmpiudoltn fvt ()aDurxmp;u0apenmfetltla ra( o t0tlxnxr oa1la eluei;s  euoirpoo4om  miesl(farrmurono4tpto fcilsls umu onu)aexniocta1opDrauei;t0trtoxr3no4omeelieils)sDum(mo;o4tlenif3tltfaDuln snt)arxnxf3oo1lpt lnes;s) ruriopoodap e fct sf Dur(rpoo4tptomo3iasfm2el( pnt4alxoxrciytfmtrln o;(0s2trxrpiu1al elnci s) Dua(rooo4oet mfcilsls2emnmon(4 eermfciytlat aivo (0t2toir3oo1lpen iet s) Dra(mono1tlx mieiys s rmu s;u4 exnifcio1lpt an s;s0srtrxm io1oltnlnvi t) 2tr( onu1tex io3ild a2rmn ont)tltrxo3iatlpD lu o;t)s2tmio3oo1om elnci t sDtrxmo;o0tlxnmfetls m rm(vonu0 exnir iadfmt lnei;s s2xrim ou1lpe lncsltf rtau o;o1oeenioctadfmDum(vo;(4 lxrxf3oadlmtrli i ( seumir3io4omeemiet sf 2umx  ;t1tle moetlslsDrmump;t)aeenxrcoatoat ai ilt)trxrxm oy1aptnlfvias)s2rmx pou1olxomf3ilt a2rmuvpn() etoxr3io1fm  li slt0 eurir3ny4lltemfvsas)a2rrxrpnu0apx  f3iytfmDeaumsnt)tlxrio totfpt au i s  rtrim3iydal emnviatf Duaxm ou4apenio3tasfa emu o (0 rtnxr3oo1fpDrlivil(0 2ur(o iudol eliesa(fsrrr( oot4oet if3iyd a emuvsnt0texomr oodla elu s;s) rxmio iudlmen nvtatf Dtmxr ;t4optoii3iys aDumnmp;()areoiociatom  livo;s0 2urxo3iy4amenlivsl() 2ra(m ou4oeenmf3ilt a uau s u0altrmf3oytoptrli s t  2toiopnu1lmt  feil(  Dtrxm nu1oleo i3iys sDeln p ()tltnif3ia1faD lnei;(  etr(o nodlp  mfci (faDum(ro;u4aeen oeiyslmDul( p;t) rxnxrciy1oatraivo t) 2xrim iy4lp  mivi s)aDrrx  no0texoiieiasfs2rlu s u4alxrmr todfptr uvi () etrxopiodalt lieta( aDrmur nt0teenmoeiat aDumumsn(4tltrxo3oadla  aieilt0t2trim ou1altnlnvtlsfaDuru pot4olt iociys s2rm( o t4trtnmo3ia1lmDr ues;t)s2triopiy1apt  iesa(farra(r ;t0tpto oeilt s umnvs u4aetnmrcoa1lm ean slt0s2to(r iudol n ieta( sruax o;t4apx miciatlmDrlnvs u4 rtrmr3oy1fmtr neo t0sexoim oydllenlictasfs2rm(ronu0tee ioetys a raums;u0trxoir3oa1laDr neo;t  exmxrpou1lmenlieiasfa2uaurp;t0teeomocilsfaDeanvsnt)alxnmoctadoa eanei;s) rxoiopio4llte nvsl()a2rax  ;t1tpxoioetltfmDrmnmo;(4tltriociadlmt aueol(0 2um(mpou1lp  liesl()sDrrxm nt0oexn o3tys m uluvs;(0 leoif3oytfaD aivs s)teur(m3ou4ol n ivta(f rrmxrpnu0tltnio3iysfm2rau p;t)artoircto1fa  auvolt tetmxrpny4optemfviat) rrmxrpot0opxo feildfs umnmo;t4 eermr3ty1oatraneols0s2xmxm3iu1lpt  nesls srum( onu1apxniiciadfsDel(vonu0aetoio iotlm   ivi t) rurxo3iodlpte ietlt)srtruro;u4opxomieiltfsDel(ms;t4aexnmf3iytfmt au i;t0s2xr(mpoy1amtn fvi ()s2ur(m ;o4tpen f3ils aDran s u0arenxr3to1lm r u o;s  rxoxmpiy1lmeelnvi tfsrrm(rono1olxomoctat aDulu s;u0tetnxociodomDrliei;t0trtm(m3oodalte ictlt s2uru pnt4opeoioctydfsDuanmo;t) leomocoadfmt livslt) rxmxm3ou4openlnctls  Dtruro;u1oeeoifcias m2uaumo;(4trxrxo3oy1fate nvo s)tetoimpou4olen fei s)aDuaumoot0tpe  i3tltfa2rm(vs (4aeerxocia1fm   ueo t0s2toxm3iodapenlfcilt s2rrx o;u0olx  f3iatfm umu pnu)arxnmrciotfat luesls) rto(m oydalen ivias)aDtm(r no0oexoiieiasfa2ra( s;(0arxrio oo1fpt livi s0t2tm(r ny1ll n nvsls  Draurp;o0altnioeiatfm2uaumpnt)aexrif3iydomDrlieo s)srtoxo oo4al nlfvt s)s2tmxroot4tet iietasfsDemu o;() reoxrciadlmtrau ils sruoxo ny1omte fes s)s2ua(r nu4tlenmi3iyt m2eanmp;t4tleniocoodfaDeau sl(0setr(m oo4lpe mivt s  Dur(rpnt0opxomo3ias a2uan o u0 etoir oydlpDrlneo s)sexr(rpoudlmtnmfcil(  rumxm ot1tee  icias aDel( on() exoir3iatfa eli o t0 rxrim3oy4llt mfcs s)arumx  oo1texn f3tasfa umnvsnu)tetnmociadlmt  ivi (0srurxr oo1ol elnvsat srtaumpoo0tet  i3tldfmDrlump;() exoxf todopteluvs ()sexmxm3oydale liet s  Dtrumono4opeo i3iyd sDumu pn(0 rtrmfcoatla  an i;(  rum(rpou4lmtnlnviat a2uaxmo;o4opxnii3tydlaDel(vs (4aexoir3iy1fpD lneols0t2um(mpny1lme  feta(f 2rr(roou4ape io3ildlaDeauvs;(0artoxfciydoatraieil(0truriopiydlm nlivia()a2rr(m ;u0tetn i3tyd a em(msnu) lerxf3iatfmtrai s (  rxoirpiudll n fcils s2tr(m no1ope moetlsla umnmo u)tlxnifcoodfmt lu sls0trumxr nydlltnmivt t)aDtr(m nu1aptnioeiyd mDrau sn(0 exrxfcoytfaD lieo;s t2toxrpno4lltelfeia(fsrta(ro;t0apxn ieiysfaDrlnvs (0 lxrmr iydlmteanvols)trxmir nydlm n fct s srumu o;t1aeeomo3iysla elnms;u)treomr oatopD lies;s  euoxopoo1op nmivtltf rrr( o;u0apto ieiyt sDumnvo;u0artnxr tytopt anesl(  2xoxr3no1op emncsls)a2ra(mpou4oltniictltls2ulnms;(0tltrio oy1oa  aivilt)srurim nu1op nlfetasfsrtaxro;u1tlt moctlsfm uau on(4 lxrmf oodoat aivi () rxr(o no4optelicsl()aDua(rooo1tpe micildfsDeln s;t0tlxrmr iydlm elnes;( s2xm(o3oo1opeeliesas)sDra(mp;t0oetomoctydls2ulnmpn(4trxrmo oo1oaD aieols t2xrir3iodlptnlnvi t  rumx  oo4apeoiociydfmDemn ont0tltrxfcto1oaDrau s t) 2xrio nu1alte ietatfa2urxmp;t4tptnioetyt s eauvs u)tltomfctodlmD  nvilt t2toio iu1lle  fvt tfaruru p;o4oexnmfctyt s2uau pnt)aeeoio3oatom rlneils)texoimpnodom  mfvs s  Dtmxro;o1tpeomiciytlsDea(vpn(0altnifcoatfmDelnvi s) rxmxr3io1lm nmfcia( sDtax o;o0alt ioeiyt s2um( p t0altoxrctadfp eauvs s)s2xrio3iu1omenmnetlt)arrax  oo4tle  ietad m ea(vp;u0 eermf3iodfmDraieslt0s2um(r3iu4aptn nvsa()sDumur oo1tlxo oetlsfa2rauvo u0 rxomf3io1opD lu sl(  exrxrpiu1alt  ncsat  2um(mp;t1oetn o3tas s2emnvp;(0tlermfcoodlm e i i;t t2um(opnu1lle  iciat  Dur(roou4tltn icildfmDemu o;u0tetnxr tadomDr uei;t srtmio3oo4al nlivt t) Durum ou0alxnifciadlsDemumpnu4arxnmf oo1fatean s t0s2xoim3iy4op n iesls)sDua(  nu4opx  f3iat sDelnvon(4 etnmf to1fa elnvsls0trto(opnudllt lncs sf Dta( o;t1oet mfetydfm elumo () eenmr3oytlaDr ies t seto(m no4alenlnci s)a2tmumpno4tlt  iciat aDra( s t4 exomrcoydfa   ues t)t2tmxm3no4lp e fctatf Dtrxmoot4tlxoio3iydla ra( snt) etrxf3ta1fmDelnes;t t2umir nu1olee nvt s s2umx pnt1apto oetlsfa2emn pnt) rtrxfcoytom r uvi s  rxoimpnu4oltnmfct (faDumuro;o1aeeo iciydfs rl( p;(4trermf3oo1lpt lueils)trum(r3iy4lle lncsat)a2rmuroot4teto o3tytls el(msnu) leoir3oadom   n s t0trur(m3nodaltemnvi (fa2ra(mp;t0oexoiieils s emn ont0arxrxf oa1lpt  uvi;s0t2xmxmpny4am  mivtatfs2umxmont1tpe  ictysfs2ulnmon(0 eenxo oadoaDeau i;t0s2xmxrpio1omt mnvsl(  Dur(m ;o4teeomfcias aDean p;(0aleoxocoytopt  ueo (  euo(o nudll nlnes t)srurxm no4ale iiciydls2eanmp;t4 lxnmo3iydoat aieo ( s2umxr nu4ol n ici t artmxr oo0tet ioetltfs umnmo u0tlenmocia1oa rli olt)s2xo(r3iudaptemfctatfarra(  ;t0alxo oeiasfsDuauvo t0 lxoio oy1lpt  nvs;t tetoxm iu4op nlivi t arrmu  ot1alxnmfeildls rluvs;(4trerxrciy1fm eli sls  etr(mpnodlptelieiatf rrm(mo;t0opto oeiysls ul(mp t0trtnxocoodla rluvil(0s2toiopnu1ome lncsatf 2umxm ;o4alx  o3ildla emuvp;t)artrxf3oydfmteanei t0s2um(opoo1ll elics tfs2umxr ou1ope mfciys s2emnmp () lenmo3oy1fat lu i;t)sexoxopoo1oltn ncias) Dta( o;t1alenmieiltlm2rmump;u4texnmr3io1lmD livolt0 rxm(o3oy4amen feiat srua(mo;o4ale mfciytls ul(mo u4artrio3ty1lmtr ies;t s2xoxm no4amt  nvil(fs2raumo;t1aeto i3iltfaDel(vp;()teerxr oatop   ueilt) rxrxo3iudllt lncils  rtau  oo0tle iieilt m ra( s;(0 lenmoctatopDranvi;t0t2xo(r iydaltn fesas s2um(m nt1tpx ii3iysfa emump;t) exrmf tadoptraiesls0s2xoxopiu1ap  mfei t) 2umuront1teen ociad m2uan o;u4 exrxf iytop e uvols trxmim3nu1lp   feias  2trx oot0aptn i3tadlm2ul(vsnt) ltnxfctydfaD au ilt)t2tmiopnydomtemnvil(fa2ra(mp;u0aexnii3iydls uanms;() ltoxf totopteanei (  2xo(o oy4alt lfei t)s2uaurooo1teeomociysfm2emumo (4 rxoxo iodlmD aies;(0teuo(r3ny4opt mivta()a2ra(  ;u0oltn oeiys aDrluvs u4arxrxfciotomt au o;s0srxoim3iy1ll n ieslsf Drm( o;u1tee mfciyslm2ea(mo t4tltnxrcoatlp elivols0 rur(r iydllenmncsat) 2trur no0tet if3ils m2ulnvsnt4 etnio3tadopteluvi s)t2urio iydolte fcilt)sruaum ;t0oltoiociyd s2umump;() lxnir oytoa  aueols0 rxrxr io1omeelfvia()s2urx ooo0tpxoiiciasla ra( o;u)aetnxr ootlmDr i s ()srxmxo3io4olt miei t)arua(rooo1opeomoetyslaDrau snt0 rxomf3oatlaD aies;s0 2xo(m iodoptnmfcsa()srtr( oot4aeto o3iltlm2rmnms;t4 etoxrctatlm  luvolt) rxoxm nodlp nmici t) 2rrxm ;o0aeenifciasfa ran pnt)arxrxf totla e nei t) etr(opnudlleemncilsfaDtrum ;u0oexo ieils mDrlu p;u4 etomrcoytoptelivi ( tetoxo3oy1lm  lnvsa(fa2ua(ront0tlxnioeiytfa um( p;t)arxrxfctatfm r i ol(0 2ur(r3iodapt mietas)srrm(ro;t4tlxoiocilt sDumnmsnt)arxnmf iodfatrlu ilt)srtm(r3nodlm nlfct ()srtmx o;t4oetomieiydlaDumump;t0alenir3todfpD livo (0 eurirpoo1altelnetlsf rtrxro;u4opx  o3tasfaDuanms (4 etnxfciy1oaDe uvs s) eto(opny1ol  liesltfsDrm(mo;o1tpenif3tadls ul( ont0aeenxo oydom r ieolt0srxr(m3no1lme lnvil(farrr( pot1olx  icilsls2rlu p t4teeoiocoytfmt liesl(0s2xo(opou1alen fvtlsfarua(m ot1ope mfeiltfm2um(vs t0 lxoir oytfaDe ueo;s) exmxo ou1lmen ncslt)artrxmpoo1tpenifeiysfm2emn p u)aexoif3iatfpDrauvo;t trtoim3nydam emict t s2tr(rp;u0apeomo3ilsla rl(mpnt)trtomf3oa1fmtraiei t)t2umxmpnudalt lict ( arrax onu0oet  icildfmDra( sn()alenxr3iodoptr nvil()t2xoxmpoy1olee ivt (f Drrxr ot4tex  f3tyd s emuvs;u0texrio tydlp raueo s) 2xo(r iydopee fvsasf 2rax pnt4texn feiad aDranvs t)arenio oadom  aneo t)s2trimpiy1olt mfvta(fsrrmurp;o4optoio3tlsls umnvp;t4tleoio3iotlpt aneilt0srtm(r iudlptelfetatf rtmx ont4alxn ocildfsDul( sn(0aexnmrciadopD lu s s)s2toxmpno4ale  fvil()a2raxmp;t1tpxoioetatfmDemnvs t0 rxrmo oatlpte n s (  2xmiopoy4omtnmieia( sDrrxm oo1ape iiciyd mDrmu s;t0 lxnircoatfm eauei t)teurim3iy4lpt mfvtlsfsDum(m no0alxo ietytfm2umn o u0tleoir3tytlmte ueslt0srxrirpnu1lpe lnet (faDrm(rpno0tltniociysfaDulu s (0alerxf3oatoateanvol(0 ruoxrpio1lpt  fesas sDurxm oo4oeeo fetysfaDum(vp u4artomr3oy1fmtrai i;s) etrxm iodlm e ncta() rraur ot0optn f3tlt m rmnvo ()arxoir oytomt ln o;t0sruo(rpio1lle livs s) Drrx oot1texnmictltla2rmn s;u0 eeoiociytlaDeanvsl( trumxrpnudom  lncta( a2tm(mo;o4aleoiieiltfsDeluvon(4arenif oa1fp rauvil()seurir3no1oltemieia(fsDraxm ou4oltomf3iysfs2rmu o;u4 eeoxo oy1oaDeau ils0 2um(o3ou4ole mies (faDtruro;u4aetomf3iydlm2em( pnu0arxnirciytoptr n slt  2xo(rpny4lltn ncta()s2trxr nu4tpxnmfetls aDean p;u4 rtnircto1lateai ols0 etmxopnu1apeelfctlsf Dtr(ront1aet mfeiaslm eanmo u)tlxoxr iodoa ranes s s2xmxrpoodlleemneta(  2um(mpno1olxomieiad s rm(vpnt4alerio3totfp   ivsl(0t2xrxo nu1optnmfvsls) Draurono1tle  f3tysfm emn p;t) ltnircoydla  au il(0setrxo nudolt  icia(faDtmurpnu1teen feiltfmDemumpnu) lerircty1fa eluesl(0seumimpnodapen nctat)s2rrxr no0altnmoeiatls ua(ms;u0trxoxocio1oa elu i;()t2xo(o oo1amee nvsa(faDtmumont4texoioctaslm rm( o t4 lxnifctotla eanei t sexoim iu4llt  nvtl(faDtauronu4ape  feilsfaDrlnmpnu4 lxomr3to1oa  lu i t0srtrio oudape licsl(  2rrum ot0aptoiiciaslm2em(mp;t0trxnmfcoa1om ran o;t)teuo(rpno1al nmnei s sDtaxm ;o0oetnmociltlmDulumo;()trtoxrcto1lm  livslt0s2toxr oydap  licsasfaDua(  ot4olt mi3iys mDul(ms;u)tlxrmo3iodomD li s;s)sexoxrpoydllte neia( srrr(root0tleoiictatfa2ulu sn(0tleoif3totlmte uei s s2xr(o io1alenmici sf rurxrpnu4alt ifctasla rmnmp;() lerxrcta1fpDe n o;s seuoxr3iodlpenlnctat arta( pno1oltomfetysfs ul( p t)tltomoctodfa eaivo;t)seumxopoydlm elies tfartmx  ;u4alx miciysfs rln o t0alxrifciydla   ivs ()srxrio iudap  mfcias)aDraxmpnu4alt iiciltfm2umu pnu0 lerirctatop  lnvo (  euo(r oy1am emieilsfaDrr(r nu1oltnif3ildfsDelu o (4 lerio todoaDelnes;( texoio3oo1lptemnes t)sDra( pno1teeoio3iydfs2emnmp;(0 reoxo3iodfptrlivs;s0setrxr ny1lm  lfvtl(  2urxront0tet mf3iadls2rl( on(0 renir3tatomDrlivi;t0t2xrxmpnodoptemfciat)a2tmx  ;o4oexomi3tysfaDemums;u4aetrif iodfm elnvsl() exr(m nu1lp nlivil()s2rrur oo0texnmi3iatla2eau s;t) lxrif oo1fp eaues t0t2tr(rpiodll elivs sf Duau pnt0opt  oeiltfaDeauvp (4 ltoxf tydlp r u s t  rxrir3iy4opt lnei s  rur(roou4tlxoio3tatlaDuau sn(4tetrif3oodlpDrlnvo ( srxoxopny4lp  lncs (fsrrr(  ot4oexomi3tasfs2umn onu)alxomf3oatomDelivs;s0 rxriopnodam   fvtl()aDrr(mpot0oexomieiad s2eln s;t4 eerxrcoodlptraieol() exo(o nudlp n fei s  Drrxmpnt1alen ieiyslm2raumonu4 rtnmr oodfm eaneolt)s2urio oudaptnmivias sDrmurpou1oleomietysls2rl(msn()artoxo3ootfp  lu i;(0 etrxrpio1llenlnesat)sDrr(  ;o4oetomociad s2eanvo (4tetoir3iytlaDr ieslt0 rtrxrpiu1ale  fcil(fsruaur no0oee io3tyslm2ua(vo ()trenio iydomt aneo;s srxmim oo4om e nctltf rtm(mont4aptnif3iatfaDumnvs u0 reriociytlm rlivs t0 rxoim nu4openmfct sf 2rr( o;o1aex  iciaslm ra( ont)tltrmf3tytom raneilt0srum(o iy1amtemivi s sDrmumpnt1tpt  o3tydls uanmsn(4arenmf oy1lpDranesl()tetr(o no4amtnlfci (fsDtru  nt0oeeoio3iatfmDelnmsn(0 exrif ia1lp e u o;s s2xr(opiy4llenlici (  Duaumoot1tpeoiieiyt a2rm( pnt0tltnxo ta1lmt aivi;( texrir3iy4ome  fvsat s2um( oot1alxo ietyd a2el(vo;u)alxoiocia1fp eaueo t) eum(opny1lptn ivta( sDtr(rooo4aptnioeiytfs2uan p ()trxniocta1oa  ln i (0 rtoxm3iy4lle lncsa( srrmumpot4tee  oeiaslmDemnvpnu)altoio ootfp e uvsl(  etm(r ny4aptemfvtasfa2ra(mp;o4olt mi3taslm umnmp;u0aetrmf iotfmD lieols) etrim oy1amen fvtls)sruau  ;t0tptoiociytla2rmuvs u4tetnxo iadlat an i;s setm(r3iy4al e ivsl(f rta(rpnu0alx iicildls um(mo;t) lerxrciatfmt aivol(0 etmxr3iy4altelneils)srtm(r nt1tlx moctad m ranvpn()aeeoiocio1fp r i s;()srum(m3no4ap eliet sfsDtrxm oo1tlx  ictadfm um(mp;u)aexrxo iotfpt  ivsl()s2uriopiydope lncsls aDua( onu0oetniictas s2ra(mont)trenxf3iatlpDrlnvo;s srur(r iu1ol elfvt t sDtm(rpot4opeomieild mDumnmo (0artrmr tadlatrlueil() exo(r3nodlmeemict t)s2tmu o;t1olt ifeiadfa2umnmon(4aetoxf3tydfpt  u i;(  etoxm ny4amtnmnvtas aruax ont4oetnmfetaslm2rmnvs;(4altniocta1op rln o;t)t2urxo3ou1am  mneilt s2rr(r nt0oeto fcildls2emuvont4 eeoif3oy1lmteai olt truo(r3iu4aptn fvi t) 2ra(rpnt1oeeomoeiasla2ra( o;u4altoir3tadlp eauvi;( trtr(o ou4apen iviatfs2um( o;o4tptnmfetlsfaDelu sn(0 rxnioctytlatelnei;t) 2xoirpoo1al   nctl(  2tr( pou0opxoio3iysls ulumont4arxrmfctatlpt luvs () rxrim oodolt mfvsas aDtm(m nu4tetoii3tlt s2uau p;u0trtrio3ia1latelivo;t trxrimpnudaptn ivs s)sDrm(mp;o4oltniocildlaDelnmo u0tlermo oatoatrlivolt srtr(o iu4ll elnctas a2ua( ooo4teeomfeilslm rmnmo t4treoioctodfmDrluvo (0setrimpno4alt  nvsl() 2trumonu1oex moeiydfmDumn o u4texoxoctodomD ai sls  etrxopiydal e ieilt)srurx p;u0teeoif3iyt mDemn o;u) eeomf ty1oatr u i t)tetrimpnodopt lictlsfa2rrur ;o1aee  ictlt a uan s;t0 renio3iy1fmte u o;t0s2xm(o ou1al  lncsl()aDumx ooo4oex ioeiat s2um(mon(4aexomocoadoaD anvs;t  2xmir nudame mfvslsfarrrxroou1olx  f3tysls ulumo;u4 lermo3iatfpteauvo;s0teumxmpnu4am  mneia( s2trxm oo0openioeiytlm ean s;u) rxnircoy1fm e n o;() etmxrpoo1om nmfvsasfa2rmxronu0ope if3iatfa2el(vp u0 lenxo iydfaDean il( trurxmpoydapt  neias a2tau o;o1tpenmfctlt a uan ont) rtrxfciodlm elnvi;(0 rtm(o ou1apeelnvs s  Drmx ont1teeoii3iaslm2ua( o;u)arxomoctotomt luvolt t2tmxo3oo4ome mnvsatf Drmxmont1apeomi3tlsls2ean p;(0 renir iatlm elnvo;s s2um(m oo4lmt  nvtlt a2umx o;o0oleomociltla uaumo ()alermfcia1lp elies s)sexr(m io4ale mietl()srraur no0tpen o3iasfa eanvonu4artrxoctydoat luei s) rtm(rpiydomt  fct s) Dtm(rooo4apto f3tadlm raumpnu4 lxnxfciytlaDrlnvi t0 ruoir nu1alee fcslt) rrr(mp;o0tpto feiyd mDranvp;()aeenmf3iydom rauvils  2trxo oo4ol nlivslt aDua(mont1aee ii3ildfsDemnvs;u)tlxoxocoo1faDr ivo;t0 ruo(o3iu1am n icilsfsDraumooo1ale mo3tlt mDea(ms;t)arenircio1lpDrlneil(0sexoxm iu4ameemfvtasf rtax o;t4apt ioeiydlsDuanmp u4arxnmo3iydoaDrlnvi;s) rurim ou4lmenlnvs (fsDumuront1apt ii3tltfaDelnvs;(0aleomrcta1la eln s t)trxrirpnydllt  neta()arumu  ;o1oet  i3ilsla2rlnmp u4 eermo3iadomDeaneo s teurxo3ou4lp nlnvslt sDrmxm ou1altoio3ilt s2eanvpnu0texnir oy1lpDe nvs;s)seur(mpny1omeemivi t)a2rrumpnt1apxomi3iad s2ulu s u4tlermr iy1fmDr nvi;s t2xrim io4lp emfeil( aDuaurpno0olxnmoctlsfsDrlnvo;t4tltrio3ia1lmt an s;t)texoxopou1apeelivtlsf 2uax  nt1tle ii3iyslmDean p;t)trtrif iadfm   n sls0srxoxo oydlpee iciasf Dumxr ot0aexniietatfm um( snt4alenmf3tatla   neols texoimpnudap  miesls)sDua(  oo0apx ifetysfmDrm(vp (4 etnxf tytlmt lnvils)trxrir no1lm elneias)artrxm nu4tpxomfeiad a2eanvpn() lenmo tadfpDrlueolt0trurimpou4am eliesatfsDrmx  ;u1aetn ictatfm2rlnms;()arxoircty1fa rauvo;t srxmxm3io1amenlicia(f Duaxmono0tptnmicilsfa2ua(mont)aexrmfciydop eanvi;t tetoim iu4aptelnei (fa2um(r nt0opxoioeiadlm eln s;u0trtrmo oadlmDranei t0 rtm(m3io4lle mfeslt  Drr( o;u4tpt io3iat sDuanvp;(0aleoxf iytlptelivs () 2to(m oy4opt  ncs ( s2raxmp;t4ole io3iydfs rmn pn(4arxoxocoadop eli o;t)srxrxm io4om  micslt  2tr(mpnu4alxo oetltlaDrln p;u) leoio3iy1optr n o;t trumxrpou1oleemnvta( aDumxmo;t4oetn ieilsfs2emumo u0trenir3ty1fmDelieo () 2xoio3iy1ll e ict t  Dra(rpnt4optnmfetadlsDemuvp u0teermr tytopDr n i;()sexmxm3iodlltemnvtlsfarta( pnu0texnmfctlt a ra(vp;() ltnmocoo1opt  iei () rtrxo3iy4lm elneiat)srrrx p;o4opxn o3taslsDea(mpnt)texnmociytlm   uvolt) rxr(opnu1lmt lfcslt s2uru  nt1aeeoifciys s2ul( ont0 rxoif iodoaDeluvols) 2urxopiy4opeelnesls aDrmxmp;o4texniieiltlaDrmu o;u) lenxf3tadoatrlu o s0setm(m iy4olenlivtas  2uaump;o0tex mocilt sDeluvp;t0tltoxf oatfmDrlnvs s0setrirpiodamen fct t srtaum ;t0tpx moetldlm2elnvo;(4arxomf ia1lpDranei;(0tetr(m ny4omt mfeilt aDtmxm ot4ole mo3iaslaDrmnmo t)tltoxo3oatla e ues ( trtmir3nydalt lneslsfarum(rono4tlxoifciyd mDemu o;(0artrmfciodlatrliei;s0s2tr(r3oo4altn fcias  rtaum no4tpxomieiasla rm(msn(4tetrxrciytomt ai o;(  rxr(m3oo1aptelnes s sDumumo;u1olx  iciad aDrmuvonu4tltrmo tatfaDeanvo s  2triopiy1alte ictat) Draump;t4olt  i3iydfa rmuvont4 rerif3oa1lm elu s t0s2xmim3iu1am nmiciltfs2uru ono1tpxo fetytfm uan onu0aeeniocoytfp eauvilt)s2xoxopnu1llen icias a2rax p;t0tptomi3iaslm rmnvpnu) lxnmrcia1fmD auvi;(0 rxmxr iu4amtelnci ( sDum(r nt1teen oeildfs uluvsnu)tlxoxf3to1oaDraneilt)t2tm(r3iy1alenmnvslsfartaur ou4tet mociydlm uluvs u4teerxrciotfatr ueo ( s2tmio ou1alt lnctlsfaDtrx pno4ole  feiytls2el(mp (4tetoxr totlmD ln olt0trurio oudol elivil( a2raxr ;u0altoioetld a2ea(mp t)treomf3iodlpte nvs ()trurxrpio1lpt  feiat) Drrumoou4aee  ieildlaDrmu p (0aeeoif oytfpteaues;t) eto(m oydamtn fviatfs2tm( pou0alxniiciytla2emnvo t4aexrio3iotomtr nes;t0teurxmpoo1lm   nvtlsfsDraumoou4alx if3iyt mDumuvs u4altomf tydoaDrai sl( seuoio3oydamtemnvsl(faDrrumonu1apx if3tatfa umnmp u0artnio oytlatr i sls) 2umxo3io1omenlivia(  rtr( oot0ale mf3ild m2umnmonu)teerifcto1faDelivs s) 2toxmpiodamtn fvilsfa2um(mp;t1teenio3iysls2ua(ms t4 renmrcoy1oa  li s;t0s2to(o3iu4lpeemivs () Dum( pot0aleoii3iys sDraums u)aleomfciotop raivs (  2urir3nu4lm nlicsa(fsDumx o;o4oexnmoetadfm2em(mo t4 ltrmrcoo1oatrlnvsls seurxm3oy4opeemieil()s2raur oo0alen icilsfmDuau pnu4tetoxf3oy1op   n i;()s2uo(r iodllenliciatfaDtmu  ot4aptomiciadla rm( o (4artnxr3iydom eai s;s)s2tmir3iy4opte feilt)sDurxmooo4teto o3iytlm2ulumo u4trenmf3iatfm e uei;s0t2xm(r ou4lm elfcta() rtr(mpnt0tetomociatfs2elnvont4tetoxrcto1opD  nvols0trxoxm3oy4opt livs t aDumx ooo4olx iocias a2um(vp u0trtomrcoydoptr iei (0 2ur(r ny1open nct sfs2rmumpnt1tpe mfeilsfs2eluvpnu4altrir3iy1fpDeaueo s)trtoxmpno4amtemiet s)s2umu p;o1alenmfeiytfa emump;() exriocoa1opD  n i;s trtm(o iy4lp nliei sf Dtax o;o1tlxoio3ils s2rl(vsnt)trerif iy1fa e u sls0t2tm(o3iydapt  nvsatf Drrx  ou0oeeoifeilslm eanvs;t4trxrir3ta1oatrau s;s0setm(r3iy1op n fvtl(f 2rr(rpnu4oex iieiyt sDum(vo t4aetomf3oytfmDelivol( trtrxmpoy4lp nmivslt)s2ra( ono4ape iiciaslm2rlums u4tetnir tadlat ln s ( s2xo(o oydol emfeilt  2rrxmpnt1oex  ietatlaDrauvp;u)tltrxocto1lmDeln s;s  rtmxo3ny4altelfvil()a2um(root1tpe mfciasls emu o;u4teerirctotomt  i o;()t2xrxo nu4om   neta( aDuaxr nu4aptomoeiysfm rlumont4 lermo iodfate uvol()seuo(mpiydlp   ivsat)aDrmx  ot4tpeomf3iatfa2rm(mont)aetoxf io1fp eaueols0texoir oudom  mieil(fsrrmu pou0olxomf3iydlsDrln o t0aeeomf tytfmDrliei s0teum(r3ou4ll nmieiatfsDtm( pot4aeen ocias s2umu onu)arxrif3oo1fa eluvi s) rxm(r3ou4aptelfet s srtax pot0olxnmieildlsDrm(ms;u4alenmr oytfm  ln s;(0 rxmir3ou4apt micilt s2tmx oot1oee  fciadla ranms u0alxrmr to1omD aies;( trxoirpnu1ale lneslt sDrrx p;o4altnifciad aDelnvs (4 lxomo tadfmD au i;s  eumxr3io1omenlfvs s srtrx o;o4tpeniieiyt m umnvp;u4tlermociy1lmD ln s;(  rxoir3ou1lltnmnei tf Dum(moot1oet ioctldfs2emums t) rxrmoctytlaD  nvi;()sexr(mpnudol elict ()arum(mp;u1tle mf3ildlsDrln s;u4tetnxf iydomteauvs;(0srtrxrpoo4ale  ncil(fs2uax ooo0alxn ociltfm2ranvonu4tlxnxr3iy1oa r n i s)s2tmxrpnudlmen net ()srrmu onu4tpx  f3iydlm2ul( o (0aleoiocio1fmte ivs;() rxrxopnu1aptn ncia( srurxrono1oetomo3tas m uaumpnt)arenmf3ia1fp r ivs;s seuoxopiudoptnlfcils) 2tmum oo0oetnmoetydla raums (0 rtrif ia1fm  aneo t0t2toxrpnu1ome mncs s)a2ra( p;o4tlen ocild a uaumpnu0 rxnxoctydlatr n s t s2uo(rpou4lmtn nvias)srum( pnu0apxn ietyslm um(vpn(4aleoif iydlp e ueo;(  eurimpiodole  ictltf 2umu onu4alxoiicilt sDrmn pn(0 rxoir tytomDeanesls)s2ur(opiy4amtnmncsa()aruaur oo0aet iictytls2umu s t) rxrxf todfpt luvo;( trxrir oo4ame  nvsls sruaurpnt0aeeomi3ils mDranmpnt0 rxrmf3oadfmD  uvilt  2toirpoo1aptemieiltfa2urxmono0altomietytls uanvp u) ltoxr3iotoa  ln i t0 exrim3iu1ale licil( a2tmum ;t0ale ioctasfs2el( p;(0alxnmo3iodfpt an olt0texmim3io1al nlfesasfs2tax  ot0tex io3iyt aDrmu sn(0artrirctotfatrluvs t  exmxr3ny1apte fvt s srurxmpno1ole mf3tlt sDuau o;(0artnxfciydfmDeaues ( srxoxmpiydape mivsls) Dtrump;u4oexomfeildlaDra( p;(4 exrif3oatfa eaies ()srtm(m3iu1optelfcsat)aDtaxmoou0tpt iictysfs2elu o;t4 rtoxrciydlmtr neo s)trur(o io1altnlfet t sDururpoo0tptomfcilsfaDeau sn()tetoxr totomte n ols)trum(opno1ape  fvtl(f Drr(monu1oeeniicias sDrl(vont) etoif3ta1fmt an o s)setrxo3iy1openmfcs t s2ua( pou0opto fctad a uan p (0 exoxrctadlatr uvs t0t2tm(rpoydom n feilt)arrmxront0tptnmfciyslm2rluvs t0 exnif3oydfp rlnei s)s2tr(opny1amte nvtlsf Drmumooo1tpxomfeiydls eanmo u0 renmf3tytfa eluvils0srxmio ny4ome  nct t)sDraurp;u0aet  ictldfaDrmumsnt0alermfciotoaD  uvo ()s2tmxrpoudlmt licilt a2ra(  ot1ope if3ilslm umn o;()alenxfcto1lpDr uvi;t  rxo(r oy4apeemfctlt)sDur(m oo1olxniieiatlmDuluvo;(4tetnxo oatfaD anvs t0 2tm(r3oo1lm  lfet sfa2ta(  nu1tleoio3tydla2raump;(0tltoioctodfptelies s0 rxmxr3io4ale  ivias)aruaur nt1aptoioctld s2uluvo () rxoxrciytomDeaiei s seurxopoy4alenmneiasfsDumx ont1aetnmfciytfsDrmu sn(4 eeoxrcoydom e n i;t)trxm(o3no1lp e nvs sf 2tm( pno0tetoifeils sDea( o (4treoif3tatlm eluvil(0srtrxo3nydom e icsls)a2ta(  oo0texnmiciltls2umums (4tltomr iydla elnvo;t t2umxm3ny1am nlictas)artmx p
\ No newline at end of file
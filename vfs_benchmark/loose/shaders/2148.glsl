@@ -0,0 +1 @@
+n i;t  rxoxopnydlpen fvsa( a2ta(monu4tltnmf3iltls2elu pn(4aetrxf ta1fmte neols)s2tr(o io4omee netasfarrmumo;t0tlx  fcildlm2emnvp (4tltnmf tatlmtr uvs;s)s2tr(r3no1ap   ivil()sDtr(rp;u0teto i3iyt mDelums u0 rtoxo tydlatrau o s)s2xr(opnydalenmneils)srumx pnu0alenifctyslsDrau o;t)trermr3oydoa r ues;(  eum(r oydamtn fvs t  rrr(rpnu0tlxomfetlsfs2ulu pn()areomo3oytfpDr nvo ( teumir oy1omtnlncta( s2urur oo1aee mfeiatfa2el(mp;()arenxfcoydfpt lieolt  2triopiu1op  mieil(fartm( pno4aex mfetyt aDrmuvo;()aetrmfcoadlmt an o t)seuoxm3ny1lle mnctas  rrm( o;o4texoifciys mDran pnt4artnxo iotfp r nvslt t2xo(r3nu1aptnlnet ( sDtmumono4tleomiciatlm em(vo;t4 renir tydfa  lu i;s0tetmimpou1ll emnvsls)arrrxr no0tpenii3ilt aDul( pnu0alxnio iy1fmD  n s t srxmimpoudam n nci s)srrrumpoo4opeoiictyd sDua(msnu)trerxocootla rlnvo;s0seur(r3oy1am   ietasfs2rau o;o0oee  i3iyslaDum(mo u4 leoio3oa1fa  aueil( t2xo(o3iodllen fvils arrmum nu4olx  o3iytfaDul(mp;t4 rxoir totfa r ueolt0s2uoxrpno1altnlnctas)a2rr(  oo4aleoioeiyd mDeauvo;u0 etoxociotoa ean s s)seum(r3ny1am nmfvt () Drr( pot1alt  feiydlm2ra( o;(4 reomfctotlptrlieo s)sruo(opiy1alt micias srtaum oo0tltoioetls m rmnms;t0alenxrctotom   nvils)trtmio3iu4omenmivtatfaDrmu o;u4olen o3tadlm2ua(mont) etoif3ootop  ai o;( t2xr(mpoydlpenmnetlsfa2ta(  nt1tpeomf3iad a rlums;t4 rxnir oadlaD an sls s2tmiopiu1amte ivtlsf Dumxr ou4tltn ieiyd a2uln pnu)altnmrcoo1fptrlu olt0 rumimpiy1alen fvsl()srrruroot0alx ifeildfm2um(vp;(4aeeoif iydla rau s;(0 etm(m ou1ome mnesl(  rtmu  oo0tpe  fciasls2rmn o;u4alxoxo3to1fmteanvi s0 rxoxm ny4ll emies () rrm(ront0aeen fcildla2uluvpn() rtnxfciodfa e u i s0 etr(m iudop   fctl() 2trur ;u0aexnmo3ilslaDulnmp t0alerif3ta1optraivi;( trur(mpny4altelnvsls) 2tmxmo;u4tlt mf3ilt m2eanvsnt4trxrxrcoy1faDrln o;t) 2tmimpiydap emfcias  Dtmxmp;o4apxomoeiydfa rmnmpn(4tetnxr3ootfm  anei (0s2trxmpoodll nlieiltfsrtaxm no1openiietlsla2el(ms;()aeeomrcoa1oaDeaivs;s0texrir oy1lpenmictat) rtaum nu4tltomieilsla ea(vont0arxnxf3iadfp e ueo;( s2xrio no4oltelieil()a2umx p;u0alx iictltla rlnvsnt)tlxomo iotomt lneils)trtr(m3oudlm   ietl(f 2rr( pot0tpen ictytfsDel(vo ()tltnmrciodlmD lies;t sruoim3no1openmfeils) 2umumpou1ope mi3tydfm em( p;(4trxnxr3oytfpDe i i ()trtmxm3io4ll e iet t) rrrxmpnt0openii3iadfaDumnvsnt) lerxociytfa  an s () rtmxr3oy4amenmfetl( s2rru  ot1aetnmietys aDeanvp;u4 lerio iatlmDrauvils0s2xmio3iydlptnmfeslsfs2rax onu4tpen iciatls2eluvo u4texoxo3todopteaneo;s0s2xmxmpiy4amee fvi ()srrm( oot0tlt  feilt m2em(mont4artrxo3ootoaDelnes;(0sexrxmpnydlmt mfviat  Dtau p;t4ale  ociydlm2rlu p u)altnmr to1fat  nvs t srur(rpio4alt  fvi tf rrmu pot4altomoetysls2ua(mp;() ltnio ty1lmtr nvo;s0trumxm3nodomeelnviasfaDrmum oo0optoifetltla2rlu o u0 lxrxocoo1opDelues t0srxmxr3iodoleelnvs t) rum(m oo1tpxn ietltlmDra( s u0 rxrmf oatfaD aueo ()srto(mpiydaptnlict (  Dta(rpoo0aptnif3tadlm2em(vo;(0 etoir3ia1lpDrli sl(0seumim no4lpenmnetat srrmu onu1oetn ictadla rmu s t)aetoxocoy1fm   ivo;s trxo(opoudaltnlneta()s2trxmpou4aetomf3iltlm2rm( s;(0aeenxf3io1laD  nvs;s0 2xoxr3iy1omtemivi s  rrr(mooo0oleniiciyd s2uauvp t4trtnmr3tytfat  i ols s2toir nu1lp emfeias)s2rm( o;u1teeomietysls rlnms u)aetomo iodlp rai ols  etrirpnudlmtelnesat  ruax oou1aeenmicilslm2ulumonu)trxnmr oydlateai s (0trtr(rpoydomtnmictatfaDua(m ;t4olen ociys a rl(mp u0 lxrir ty1om rliei t t2tmiopnu1lme liet t)aDtm(r ou0opeoifctadfs2ra(mo u)tetoifcta1latelivi;s seurxo no1lm  miet sf ruaxront4tpt mocilt sDumnmont0texnxocootlaD aieo;t sexo(o3iy1llee icsat  2um( o;o4oeto ietltls eanmo t0 exrmociy1faDeai s;t) 2uo(o iu4lpeelivs t) 2uauront4tlx  iciltfaDem(vp ()texrxf ta1fmD  u s;s  2uo(o3no4altn fvsa( srrru p;o0opt  ietasfaDua( s (4alenio ia1fatr ivilt texoxm ny4altemivi (  rrr(m ou4optn ocildlaDemu p;(4arxnir ty1fp raivs (  rxoxr nu1oltemfeilt)arrrxr ;u4aexo o3ilt a2rmnmp t) rtrmo3ta1la r ies s  2tmxm io1llenmfcsa() Drm(mpnu1teeoio3iysla rlnmp;t0alerxr3oydfptr ueo t0t2xmxr iy4lm  lfciat) rtau  ot1apen fciys a2rmn pnu) rermr iotfm rluvo;s)s2tmim ou4op e ict tfartm(r oo0oltn i3ilsfsDel(vo;t0tlxnxocia1fa rlu i;(0trxmir3oodlleemivsas  Duaurpot1oleomfcilsfsDeluvpnu4 etrxr to1opDeau s;(0srtm(m3nudopt micils)arur(m ;o0tptoifciatfaDeanmo;u)tetnir3oatfmD  ues;t t2um(r3no4ll nmfetatfsDrmxroot0oex  fcilsls2elnmo;t4 ltrmo3totopteln o;t  2xrio3oo1op e ics t)a2ra( ont1ole ioetlsfs2el(ms ()altnmo3oytfm r neil()t2xmio io1lmeemfcsasf 2raum ou0optomf3tldfs el(vpn(4aexoio3oadlat lieo;(0 exmiopiy1ol  lict tf Dtmxrooo4opt iieiysls2rlu on(4tltoir tytoa rlieols trxm(mpnu1lle lnvtasfaDur(roou1olxomoctaslsDrm(vont4altomf iatfm eluvol(  rum(m iy4am elivi ()s2uax  ;t4oltoif3ias m2ulums;t0 reomo oadfp rlivi ( trtm(o ny4olen nvtls a2tax pnu0tptn fctad a rln s;t) rxomr oa1opteaieols teurir oo1omeemivi ( aDua(m ;u1apeo octat aDrau snt) eerxf3ia1la rai o;t0 rtr(mpoy4ap  lncsa(faDrrxr nt1tet micils s rl( s;t4arxomo3oo1lmD lnvi;s0teur(opnu4apee ivs t) Duaxm ;o1opx iictatlm rlu p;(0teenmr iy1fpDrauvo;s  2tmio3iudapenmnvia(fsDrm( pnu1apto iciydlm emu s;t4texoifcta1omDe neolt0sruoio3oo4altnlict tfsrur(mp;o4tee  feiltfm emu o;u0 lenmfctytfmDeln olt s2xrxo3oy4aptn ies sf rra( o;u4opxoiocildfa eluvp;(0arenmf3oy1oat anvo s s2tmio3nodolt mncsls)s2umxront0apt miciyd s2ulnms;u4 rxrir3iydlptr nei;s)srtoxmpnu4amtelivia(f rrm(  ot0teen i3iat sDumumsnu4 rtrxo3oo1lmtran s t sexo(r nu4amtn fcsa(  ruaurono0olx mo3iysfsDuaums u0aexrmr oodomD lu ol( setm(m nydal n ivil(fsDrmumono4tlen ietadlm2ulnmp u)texnxr todfpDr neilt)t2tmiopoodaptelfctls) rum(mooo0tleo o3ilt mDuln o t)treoifcoydlat lnvsls0 rurxm nu4ope mnet sfaDurxront1teeomi3ild mDrln p;(0aleoioctytfm e ues ()t2toxopou1lme lfvtatfsrtmumpno4apxnmo3tytfsDem(vs (0aleoifctotop  an sl()texoir3iydlm emnctat sDumxm nu4opx  fetls m2elump;u0areomo3oydlmtrlu slt0trxrxo3io1om nlies ()sDurum ;o1tetn i3iaslaDeau pn(4 lxomr3oa1omteluvo t0tetoir iudom nlics ( aDrru pno4altnio3iydfmDemuvo u0tlxnmf io1oaDe u i;( trtoimpiu1am e icils s2ua(  ;o0tpx iociyt sDrmnms t) lxoir ty1laDrluvi ()srur(r3iudlpenmfetasfs2um(mo;u0altniiciytls2rlu pnt) ltoir oytlm  lieolt)setmxr3no1lmtemncsa() rumump;t1aeenifeiatla ulnvo;(0areoxo iydopteai s s0t2xrim3iodam nmieiltfarur( p;u0tpt ifciysls2rmnvs u0alenmo to1la  luvslt0 2xoiopno1lltelnetatfs2rmx  nu0tptnifcilsfs2rau s;u) etrmfcootoptr n slt0 exo(o3iy1ll elnvil(fs2tr(mpot1optoif3ilt sDem(vp (4aeerxfciotom   iei (0 eur(m3iy1omen fesltf 2ta(rpot1opxn ietytlsDeanmp;t0 etoxr iodlp eai i;s0t2xoirpou1openlnesatfarrrur ;o1altoifeiadfaDelnvsnu4 leomr to1la e neols)srxrim3nudlptelnvsls)srum( oou1alto i3iysfm rl(vs u4tltnxo3tydlptrlu s;t)s2xrxo3iu1ap  micils srumxrp;o1tlto f3tys a2em(ms t0tlenmr3oo1faD  ueslt) eum(o3oy1ameelnesasfs2taxrpnu1aexo icilsfmDemnmp t4arxrxf3ty1fmD aies s)tetr(rpiu4aptn nvt t)artaxm ou1texo o3iydfa rm(monu4 etnmf oy1la r nvil( trxrim ny4omt mnci t) 2ta( poo4opxnifciytfmDuaumo;(0 exrir totlpDe ieol()t2tmxo nu1ol nmivtas srumum ot0tpenif3iltlmDeluvo u0teerxocoydfmDranvi s  eurio nodlpee nci t)a2ta( o;t0apx mfeiyd m rl(mpn()texoxf oodfat  n o;s texo(rpnu1llenmnetls aDrr(rp;u0oex miciysls ua(vsnt0tlerxoctotfmD  i ols0 2um(opiodlmt mfvtltfsrrmuro;t4tlxo ociyd m2el( p u) etniociatlmDrlivo;t  exrir3io4ap emietas aDtmx pot0oleo oetld mDelnmpnt0aetoir3tytfa eauvo s) 2toxopoydllt mfeil( sDuau  ou4ale iicilslm rmumo u) rxoif3tydfpDr u i s) euo(r3no1al   fvi ( srtmxr no4aeto ietatfs ul( p u) lxrxfciytfatr n o s) 2xmxo ou1altemnct tfsrrmurp;t4aeenmi3iasfsDel(mp t) etoio oydoa  aueo t trtr(o iy1ap elfctl( sDtmur ou4oeen ocilslm ea( ont0 rxnxoctotfaDraivi s  rumxrpny4op nlfvtl(  2umx pot0opxnmieiytfaDumumsn(0alxriocta1omtraies;t  etm(m no4ome lici s sDua(r ;t4aee mfeiytlm2ran pn(4trxnxo3iotfmt luvs;s0s2xmir iudll elnctas  Durxmpno0aexn oetydfaDrlnmp t0alerir3oatlmt  uvi ( s2tmim iydope  icsls)a2uaur ;o0tptnmiciat sDuauvs t0tltnif3oo1fptelivi;s t2umirpnu1ope micia()sDurumoou1oltn f3tytlmDrmump t) ltriocoodlaDr i il(0setoimpio4lm  mfes s  2taxro;o0teeoii3iadlm ulnvsnt)alxnmocoytoatelu o t0s2xoirpny4altnmfvsa() rumxrp;u4alx  ictad mDemuvp;u4trtoxo ta1oaDeluvi;t)trxrxm iu1amte iviltfs2ta( p;t0alt mo3ilt a eln s;t) rtnmoctatfaD li ols)t2urim iy4lleelnes s)aDuau onu1alx ioetltfs emu o (4 eeoiocoatfa   iesl(0t2xrirpiodamtn iei t) Dtrurpou1olt iociadlsDemumo t)aetnxfcoo1la  aivs;t t2uoxo nudaptelfeils sDrrx p;u1tpenmfeiasfaDum( s t4arxnxf3iotlm eai s;t srurxrpoo1llenlfei sfa2rm( poo4oeenifciatlsDel(mpnu) rxrxo3ty1fa elnes ()srum(m nu1ame  fvi sf 2urx p;o0ape io3iasfs2umnms;t0tlerxfctotopteaivo;t0 etoir ou1lm n ieil() Drmu ont0oexnmictadlm2rln o;u0trxrxf oydfp  lu il()trtr(opio1lme  ivsat  rrmxront0oetoifctldfm rlump;u)trxomo ta1fpte i s;s0 exo(mpnu1lpee iet ( sDum(ro;t4olxoifeiadfs2eln o ()altomfciydfmt au o;t srto(m3oydolte ivilt arumx  ot1apen i3iltfmDraumpnt) rxomf3iytlpt livo ()trtr(m nodope lfvsatfsrtax  oo4tpxniiciydfa rlnmp u4 rxomfciodopD aieo ( t2to(m3oo1lmtelfvi t) rrrxrpot1tpen ocildla2ulnvo;t0teenmo ia1opt anvs () eurim nudopen ivi s  Dtru  nu1tpxoifetadls2rmnvsn(0 rxrxociatfp eanvils)srurim iodal  lfeia( aDuau  nt4olt if3ias m emn o;t4arxrxr iy1oa  ln o ()texm(o3oy1llt mietl(faDuaxmonu0alx ii3iad sDuanmp t4 ltrio iadlmtr uvilt0setoxm iy1ape  nei s)arrru  nu1ale iieiatfa ul(vp;t4texnxr3oadfaD anvi;s0 etoir ny4op   neil( sDtaxm nu4tlxn f3tys mDrmuvs t4altnifcoydfmtr ivi;s) etrxrpoydlmee iei sfarrmxmpoo4olen fetld m2ua(mo ()trtrxr3oadlm  aiei;(0 exmio3nu4opeemnvi t)aDtaurooo1oexo icilslmDra(msn(4arxrif3iadopD  u s;() etoxo3iu4altelfcia(faruaumono4oex  ictyd s umuvpn(0 rxrxf3to1oaD lueo s  eurxr3oodlme mfvs ()srraxr oo4apx mieiasfaDel( s (4altnif3oytfpt  ies;(0trtm(o3oudalt mies t)sDtr( oou4opxnio3ilsfs2eln s;(4alxnif oa1lateaivi;t0 2ur(mpnu1lmt  iet t srtrxr ot1tle mi3iatfsDeanvp u4trxoif oa1om rai ol(0 etm(rpiu1om emfvil(farua(mp;o1olxo ictltla emn snu0trtnmf3iytlaDeli ol( texrxo ny4amen fctl( sruru  nt1oexnii3iyd m eaump t)trxomrcoo1la r n ol(0trto(m3iy1ope lict sfs2rmur nu0apt iociyslm2umn o u0aeeoxr3oydfa   ies;()srxoiopny1ome mfes t s2umu  ot4tleo f3iytfm ulump u0artnir3iotopD  nes s) eumimpiydolee nvtl(  rur(rono0aetniieiyt mDelnmo u)texrir iytlmt aiei;t0setrxo io4lptemici tf 2taum nt1aeen octltlm2ulnvo;u4 rxrifcio1lpD  nvol( texm(m3nydamtn feiasfsDrmurpot4apxoiieiltls rl(vp;t4 rxnxr oa1lm   ivo;t0teuoirpoudomtnmnetlt) 2urxro;u4apen ociyslm umuvsnu0texrxr3io1lmDeauesl(  etm(r no1amtn ncil()a2ta(r ;u4tltnio3ils mDemn s u0trtoifcty1optrln i;()t2tm(r3io4om nlnct s)arururo;u1apeomoctaslm rm( p;t)aexnmocoadlpDraies;( s2uoxm3oo4altn netls)arrau o;t0alx  oeiltlsDemnmo t4tetnmo3totoat  u o;t0srxo(mpiu4lp nmfcs (  rraum oo1apeomociysla el( p u4 renir3oatfm r ivilt teur(o3nu1lme  netl(fa2ua( ont0tetn ociat s rln sn(0aexrio3ty1fateanvsls sexmirpoudol n
\ No newline at end of file
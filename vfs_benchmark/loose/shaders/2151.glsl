@@ -0,0 +1 @@
+ivils sexo(r3nu4lpe  ivsl(fsrum(monu4openii3tldfmDrlu o;t0 exnir3iytfaDrlnvo s0 exrxopny4op  mietltf rtm(  nu4open ociysfa ulu p;t) rxrxocoytop r nvolt0s2xo(m3oo1omeemfvsa()s2uaum ;t1tee moetytls elu ont0altnircoo1lp elieol(0srxoxrpoo1alee nvil()aDrr( poo0aleomociadlm2rm( s u)tltoircoytlm r iei;(0sexoio3nodom  mnvs ()arrax ont4ape  fcildfmDum( p;t) renircoadlm elues;(  2xo(r3nydlmeemfvsl(f 2tru  nt0apeo octyd s2rmuvp;()tlenxf3iotfmDrlu i s0s2to(rpno1lp e fvsl()a2ururpou0aleoiociaslm rlnms;u4 rtriocoytla e iei;s srxo(m ou4op nmfcs tf Dta(rpot0oeeo ociadfmDrlnmp;u4aetrir3oatla  aivsl(0 2xm(mpoo1lptemiei s) 2rmu onu4tlxoif3iatlm2rauvp;t4tlxoxfciy1om  ln slt0setoxm iodll emieiat s2tauro;u1aet mi3ilt a rmu s;u0alxomf3oatop e n s s t2tmxm iodop e nctasfa2rr( pno4aeenmf3iadlsDuanmsn()tltoio3ta1fp rlu o;t srxmiopno1ole  iesl(f 2tr(r no1ole mi3iys m2um( s (4 exrxo3iydla  au ols)seuo(m ou4ap e ivtl(f Dumx ono0oltoioeiltlsDrmuvo;u)areoxf oatla rli i t0sexo(rpno4altemfes ( srumxm ;o4alt ifcias aDrlumpn(4tetnmr tadlate neslt srum(r ny1lmt lfviasf Drruro;t1tlxomo3iatlm2el(vpn(0 rxoif3ootlmD lueol( t2uoxm3io4ll nlnvsat arumxr ;o0tpenmictyt s ranmo t4trxnif tadfateaivsls trxrxopiudamtnlfes (  rrmu p;o0apeniictytls2rl( o u4tltriocto1fmDeli slt) etrxm3nodaptnmfcslt)arurumpnt4olxnmiciadlsDeauvs t) exomfctatlat livi;t trxmir3iu1amtemnvsl( a2urum nu0tlenifciysfa elu sn()trermr3oa1omt lneo;s)sexrxo3nudapt licsls arumu  oo4oeeomo3iltfm umuvp;(0texomf3oadfp   nes;s0 rumxo nydll nmfcils)s2tmuro;u4oet mo3tysfm rmump t) rerxrciydlp eanvs s sexoxm3oo4lme  fvsltfaDumxmpoo1oetomfctydla2em(mo t) rtnir ty1oaDe uvol(0srtmxo3oydll  lnvi s)aDrm(rp;o4ape ioeilt s uauvo;t4areoircoydlatelivsl( trxoir iy4oltnlnct (fsrtmx  ;u1tle  ietad sDeaumsnu4trxrxf iydfa   i s;s0t2urxmpnydlptelics sfarurx oot0alxnif3tltfa emnvpnu) exoircootomtelivs t)srum(m3oo4ameelfetasf 2rr(rp;t1tlxomictaslmDul( s;t)tltoifcootfmD  nvs;(0s2trir nu4ame lieiat aDtaxm ;o4alt  feils m2um( pnt4 ltriociy1oateanes;t)sruoxo iudlpee fei s)s2tr( pnu1tlt mfeiad a emuvon(0tltrxocoadoat livo;( t2xo(rpnydlle lfetls s2tr(mpnt0oetnioeiys s2rmn p (4trtrxocoo1oatean s;s0srtmim ny1ale  ictas)s2rauroou1tlt iiciytlaDelnmsnt) rxrxo iytlmD lu sl(0trxrxo3oy1al e icsl()a2tr( p;u4alen f3tat m2emu o;(0 leomf iatlaD  u s ( srur(r3no4lmtnmfviat)aDrrumoot1opxnmfctls a rm(vont4alxniocoatfmDe i ilt t2uoir3io4ap   fviat)aDrr( p;t4aexo fciltlsDelnvs (4trtomr3iodfptraivi t s2xo(r oo1omee nci tfsrum(  ot1aetoiictad s2eau s u)tltomrciytla raivs t0 etmio3oydlmt  ivi ( artmumo;u4olxniieiysfm2eau s;()aeenmo3to1lmD ai sl(0texrio3nodaltn fcs t  2rmu  no4oltn fctys m2ea(ms t0aetrmrctotlat  nesl(0 rxm(o3ou4lleelfetlsfsDurur ;t0apxoiieiad m2rmuvpnu)tlxnir3iy1lp  aies;s t2toim iu1lmee nvi ()aDumuro;u4tptoiiciyd a2el(mp t) rxnmf3iadopD  i i s0 ruoxopoy1alte fci t srur(  ot1tpxn o3iyd m ea(vp t0teenmr3iydfaD  ieol()tetoiopiodam e ics tfaDuax ooo4tlxnmfeiatfaDelnvpn(0altoio oydoaDr uei;s0t2xoxopou1ol n nvi tfarua(rpou4oex  ictytlaDua(vs;(0tlxrxocoodfpDeln s t) etmxr iu4open feils s2rrxm oo1apenmfeild a el(vs;u0 lxoif3totlatr iesl( trumxo iudameemietasfaDrmumpot4teeo octaslm2ea( o;t4tetnxrcoatopt  neo;(0 2to(r oo4ll nlicsas) 2ur(m nt0tpxn o3iatlm ul(vpnu0altnxo todlpt  n s;t)sruoimpou1lmeelfei ()srurxrp;u1ole mo3ilt s emnvo (4tetomrcio1opD  u i;t0teurirpny1lpeelfvt t)aDua(rpno0optn oeiatfsDuluvsn(0 lenxf3oa1omDrli ols setmir3nydlp   ici (  Dumur nt4tpt ifciytlm2emuvp;t0texrif oo1fpDr uvo t s2tmirpoo4ll elfet s)arurx pnu1tlenmf3ild aDuanvo;u4tltnmf3oadfm e ieo ( t2um(rpou4lm  mnci s  2rax o;t4oltomoeiltfs emuvont0trermr3oytfpDe uvsl(0 rto(mpoy1openmiesatfa2uaxmo;t0tpto o3iyd s rmu o (4tlxoifcoydoaDe n s;s0t2xm(mpou4lmt  ncils)sDrrum ou1optoif3iydfa umu s u4tltoif iy1fpt auvilt t2tmxr3iodamt mivtat s2ur(mpoo0texnmoeiad s2um( p u0tlxoio ta1fpD luvil()trto(m3no1llt lnvils)a2tmxr no1alxn f3iadfm2ua( s u4tlxrifcootlpt aivi;(  etoir nu4ole mfeta(fsDuru o;o4tex  o3iadls umn p t4aleomf oa1fp eanvol(  rxmio iu4ap elfcs sfsrrmxm ;t1aetnio3ilt s2raums t)aetnmrctatla rlivil(  2urimpiy4opt lfvi t a2ur(r ou0aeeoii3iys m2uluvo;u4aexoio totlptelies;()truoxo iu1apeelics t)sDtr(r oo0ope mf3iyt m uau snt)texoxr iotlaD au o;t)srtmxrpiy1aptnmnesltfsDrm(ront1aet mocildfm2eaumsn(0tlenir3ty1fateai i t s2umio3iodll  lfesatfa2raump;u1tex  iciltla rlu p u4 lenmo3iadoaDeaueo;t)t2to(rpou1amenmfciat  2tax  nu1oex mfciatfaDumnmp ()aexoifcoo1fptrluvi t0 exoir iy4alen ivsas)aDua(roou1alxniictatls2rl(vpnt0arxrmfcoodfp eaivilt t2xmio3iy1am   fetls sDuax  nt4oex iieiytfaDrln onu0tltrir iydoptrln i;t teuo(opio4lm e nvtl(  2uauroou0tpxoifciydfs2rlnms;u0arenxo tatfm rluvs;( trxrxrpou1lmtemiesat aDtmu p;o0aptniietltfa2umnms;()aetnmo3oa1lpDelieols)s2umim oo4am nmfcslsfaDurxrpou4ape ioeiytfm ulnmp t4 rxrxfciy1fpDe ueo s sexoxo nodam elfvtas) 2urxrpnt0tpxn ietlslm el(monu) rxnmocio1laD  neilt0 2tmxo nodlmt liciat) Drmxmpnu1tltn ociad s2ul(vp;(0 lxnmrciydopDeai i;t) 2tm(o3iudlle lieil( a2tmxmooo4optnmfetltfs ul( o;t0aexnxr tydfmt  nvol( setmxopiydaptn neia( s2ra( ooo0altomo3iadlsDeluvs u0 lxoio oatopD ln i;s s2umxm io4lm  mieiasf rurxr ;u0optomoetldlaDua(vont4alerxr3iodlaDeln i;s t2um(m iy1ap emicsl(fa2uau  oo1apenio3ilsls umnvo t)aeenirciodlp raivo () rxo(mpoo1altelfvi ()aruax  ;t1tpxoifciyt s rl(vs u) exnmocto1fmD  uvil( seum(m3oo1ol e net sfaDumum ou0tex  ieilsla umuvo u0artnmr3oytfm e u s t)t2xr(mpiy4apt  fvi tf 2um(m ;t0aleomocildlm2uan snu0 rtoxfciodom r ueolt0t2uoxo oo1lp  lfct tfs2umu o;u4oetoiietasfmDulnmp;t4tltnmo iadlpD au o t setr(r3oo1llte ivsas)s2rmxmono1oltnif3iatlmDuanvo (0tlxnxr iatfmDe uvsls0s2xmir oy4omt mnet sf Dtr(mono1opt mociasfm rauvs t) rxrir ta1fpt ai o;t)t2tm(opiu4aleemnvi tfsrta(r no4oeto ietadfm eln s;u0artoxo tadfmte u o s)trxrxo ou1amtnliet ()sDuru ont4altniieiatfaDrlnms;u)aexrioctatlm rlueo s0trurxrpiudlmtn ics t) Dtmxm nu4teto ociatfm uanmo;(0 rxnmf3oydom   ivs;()sexmim3no4op emnvt s aDta( oou4apeomf3tytla uau o;t)tetnxrcoodfm ean ol( t2uoxm3nydlptnlnvtatfarrr(r ;o1alx mfcils m rm( on(4alxnif3totfm rln il(  2to(opio1op n fcs (  rumxm nt4tetnioeiysfaDrluvont4 exrmo tytlmDrai i;s0tetrxopiy4ap nmncia()sDta(m ;u4aeenmiciysfa2elnvsnu0teerxf3todlm rluvi ()srtoxr oy1optemieil(  rururono0oeto iciatfs ea(vont4artrmocoodoateau i;t0s2xrio3oydlltemfes s)srrrx ont4aleomoeilslm ul( o t4trtoiocoo1oa  an s (  2ur(r3oydaltelnvs t s2raxmpnu0ope  f3iyd s2rmn o t)aexrmo3iadlmDelies (0truoim no4llenlnet (f rururpot4tlx if3tyslmDuanvp u4tlenifcta1fpD luvi t truo(rpou4omtn fvsasfaDrr(rpnu1apt mociltfm2um(vont0 exnxfctotop e ivs;s)texrxrpoodlpt lnet t) ruaurp;o4aex  fciys s uln p t4 lenir3oydlat auei;( s2ur(o3iu1ap n ici s srtrurooo4apeo f3iytls umu snt4arxnxocty1op eauvs s truoimpny1opt mnetas) Dtmxr no4tex  fetaslmDum( pnt)tleoirciydopt lu o;t)trtoim nu4amtemicsltf 2umu onu0tpxoio3iysfs2ean p;u) rxnifcta1omtelues;s texm(o3iydam e fetl( sDrax ono4aexn f3tlsfs ul(vont4aleoif totom  lneolt  2trxr3ou4ame mnei s)s2ua(m ot4aeeniieiyd aDranmont4trenxfcoytfmD  ivo t  2urio oudlle lfcsas  2umxmp;o1tpeo feiyt m2em(vp;t)aexrif3ty1fmDrai o ()trtmxo oudolenmfeiat)a2urx  no4opxo o3iatlaDul( s;t)altnxrcoodfm r i i;s trxo(m3oudope  ivs ( aDtr(mont1optomfctad m em(ms t4texoir io1om  aieo;t0s2urir no4ll   nei t  Dtm( oou1tlt  oeiaslaDeanvont)aleomr oytoa  lneo;t tetm(mpoy4ol nmnesl(fs2umx  ot0opeoio3tat a2ulnmsnt4aexrxf3iatomDeli
\ No newline at end of file
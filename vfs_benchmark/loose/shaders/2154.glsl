@@ -0,0 +1 @@
+i ilt0t2xmir ny1opte ncs t)sDtaum ;t4opxnmf3iytfa2ua(vpn(0teerxo3iydfa rlueil() rxm(rpnodaptemictls) Duaxronu0teeo o3tlslm rln snt0aeenir3iadlmDeaues;t t2toxmpiy4lp nmnvtls  Duaxrono4alt mictld sDumu o;(4aeerxf oadla eaues t)sexoiopiy4lpeelicsas a2ua(  ;o0aetnmfctatlaDrluvs;(4alermr3iy1fmDeanei;t)seumxmpoo4lptnlfci s aDuru pnu0ope if3iysfs2um(mon(4teeoio iodfmDe ies ()srxriopnodomt  nvsl( sDrmx ooo0tltnio3iadlmDean o;u)aeenxf3iytfaDrli ilt  euoxm no1opt livils) Drr( pno1tpxoioctytlm2rmn snu) rxnir todfa e u s;() rumir3io1lmtn fcs t a2ua(rpou4aexo i3iytlmDea( s t)trxoio tatfm r uvs;s)setoio ou4omee nciat  2rmx  ;u0oetnmi3iat mDrmumo t0 lxomr3iy1la e i o ( t2to(r iydop nmieils  Drrump;t1aexo o3tldla uluvont)aleniocio1lpt aies;s s2to(o nu4lmenmfctlt s2urxr ;o1oeen fciadfm2elnvs u) renif3totfpt  ues;t  rxoxo ny4lm  lfvtlsf 2tr(root1olt ifciasfm2rm(mo;(0teerioctadlaDeaivi;t) rumio3no4op n ivsat arur(m no4olxo icilsla rmuvsnu) lermr tydfptrln i;s  2umxo3iodapenmnvsl(f rur( oou4oet iictad mDuanmonu) ltnmfciodoat  ueolt)trtrim iu4lpee ieil( aDrmu pnt4optomfctldfmDeauvp ()tetrxfcty1opt an i t teurxo nu4opt lfvsls s2uax pnu1olt miciadlm emu sn(0 rtrio iotoa ran o t)t2uoxm iy4ol  mivs ( a2rmurpoo1oexn i3iytlmDulnvs t0tetoir3oodopte ueolt0texr(o3iodolt lfvt ( artmu pno4oet mietadls uau on(0alenxo3iy1fpDeai o;()s2trxr3io4lle licils)sDrmumoou4tet mfciatfs emumpn(0arxrmr io1oaD  iei;s) rxmxmpoudope  nei () rta( pot0apx iietatlaDuluvsn() lxoxo todoptean o;s0s2xo(r3ny1lm e ieiltfsrra(  oo4aeto fctysls ran sn(4arxnxf3io1oa   nei ()s2urxm3nydal nlnviat srrm(mp;t0olxo fciatfmDelnvp u0aetnxfcoydopD au s;t)teto(r3iy1lptnmivtlt) 2umurpno1openifctadla2um( snu)tetrir3tatlpDe u i;t0texoiopno1ol  mivt t)s2tmu p;o4oleniiciatfa2rlumo t4 leomf3oodfpD luvs;s0t2tr(opiu1ole  ieia(f Duax  ;u1tpx iieiadla2elu pn()trerio oo1lpD  neo t) exriopny4oltelictas  rumumpnt1tpen o3tys s2emumonu) ltrxf3oatlmD lnvslt)t2xo(r ny1ll nlnct ( arur(rpno0aex io3tadfmDumums;t4 lermr tadlmte neo;t  ruoxopoy1ape liei () 2trx  no1apto fetltfm rmuvp;t4 reomr ty1lmD an ils0truoxo oydlme  ivil(fsDrmxronu4alxnioctat m ua(mp;t0trxrxf ootopteanes ( t2trirpny1ope  feils s2rmxro;t0tpt miciyslm2rmnvp u)tetrxo ootfmDe i o;s srxmxo3nu4omtnlnvt t)a2uau  oo1olxnmfciys s2eanms;t4alenmo3ta1oat lu sl( sruo(o nu1lm n nctls s2trx pot4tpt mfciysla2uan s (4aetnio3iydomD  nvo s0 rurxopiy4ll e nvsl(  rrmxmp;t1oeen i3iydfa eauvo (0 lxrxrcia1oa rai i t) 2xrio3io4omte nct t) rur(mpnt4tet iietytfmDuauvs;u4tlerxfciytfm elnvs t0 2xrir iu4olte fvtlsfarumu pno1tpxn iciltla rmu s;t) lxnxr io1fptran o s)srtoxopio4lpt  ivilsfsDrmxro;t4aleoiictytlsDrlnmsnt4tetrif3ta1fp  lnvolt0setrim no1op n fvtatfsruax  ;u1opeoio3iat a2ulu onu)trermr3totlmDelivolt0trtoim3io1am  mnctat aruaxrpnu4altomociadla rmumsn(0tlxnir3oytfatrli o () rtrxm3nydlm n ivsas srtrumo;o4tpx  ociad a eln s;u)arenirciydlm  ln s;()t2trxo oydam n fvsls arumur nu1alxomi3iys a rlnmo;u)altrmr io1fmDr uvi;s s2xrxmpiu4lm nlieslsfa2rmur ;o0aexnmieiydfm rln p t4tlxrif oa1op eaueolt trtoir iu4op e ncias s2rrumont0tptn fcildlmDel( pn(4aetnmf3tytlmDraivo;s  eurim3iu4opee nci s srumxmpou1apeo f3ilsfa2ua(mo;t0trermr3iydlp rai ols) 2um(r3oydlpt lnciasfsDtrxro;t4texnmietltlm emn p t) leoxocoatfpt auvo t trxm(o3no1altnlivtls  2raxrpoo4olxnioetys a ra(mo u0aetnmocoydom r uvi s) eto(o3ny4ap nmfvias)aDurxroot4olxoiieiat aDeanvont)aetnmo iotomtrln s t0s2xmxm iodll nlneias) 2uax pno0teenifetldfmDrlnms;u0treoio ootfp  luvs;s) rtmimpnudamtn nvsat)srumur ;u4tpto ietaslm2uanmpnt) ltrifcoydlmD  ues;t0seuoxr iudlleelnesasfaDra(rpnu4opx  o3iat m umums (0tltrio tatop elu i ()teum(mpoodll nmivilsf ruru oou4aleo o3tys s umuvp u4 rxnmf3todlmteau ils0tetrxrpnydopeelfcsatfaDtmxm oo0aet io3iydlsDelnms;(0aeenifctotlp e uvo s) exo(o iu4ll e fvsl(  ruaur ;t0alxnif3iytfa2umuvo;(4aeenxr oodoaD  n s t) 2toxo3oo1op elnvsas a2rm(mpot0tet  o3ilsfs ra( p;u0aetnmrcoytoaDelieols0t2uo(o3iudlle mfeilt  rtr(mpnu0apto ictldlm2umnms t0 reomr oo1lpDr iei s0 exmxr3oo1amenlnctasfaDuru oot1tpenmieiys mDulnms t)teenxf3iydlaDeaivs ( s2trxr3iydaltnlicsl() 2tr( p;o1oltnmietas mDrlumsnu0aetnmo iydlaDrln o t trxmio3oo4llenmietls) Drmumpoo4tlx mi3iat a2eanmpn()tetoif3to1laDeaieilt  rum(o no1lltelfvsltfaDurum ;t0apxnmoctatfs ean s t4 rxoif3totfaD livs;s) rtoxr iodopeemnet t s2rrum ;t1aeeo f3iyslmDulnvonu)tltoxr3iotoatelnvo;s0seumxrpiy1apt  ictl()artax  no4tpxnioeiatla2uluvs () etoxo oodlpDelnes;( teumio iy4lmee nviltfs2ur( pnu0ale mf3ils s2em( s;t0 lenif tytfp  lues;( t2uoim oydam nmfvi t)s2umum nt1oexo fcildls2uaumo t0aeeoio3tadfmt  n il()trto(opny4ll n netlt srtaxroot4apt iietlslmDemnms;(0 lxrmf3iytoptrai o t trxmimpiy4om  livi t srumxm ot0tltnmoeiltfm2eanms t0 rtnxr ty1oa e n s t setmxo iy4lmenmieia( arumurpno0olt  ictatlm2rl( pnt0tltoxr to1fmD lnei;t t2tm(rpno1ope  ivsl()s2umxmpot4tlto f3iadfsDeauvp t)tlxrif3to1fmte nvo;t t2xoxo ny1lpeemnei tfa2rrur ;u1oltnmoctlt s rlnmonu0 etnio oatoptr nvol( t2toimpoodapt lnesls)sDrau  nu1aeto i3ias aDrluvs;t)texomf totlmteluvs s)s2urxo ou4lmee nct tfa2ur(mpnt1aetnmfciydfm2ea( o;(4texnir tytfmD lu o (0 etoxr iydllt mivsasfsrra(r ;t0texnmociasfa elnmpnt)trxrmr oodopDe uvo (  2tmir3no4lm nmnvsasfsrurxrpot0opx io3iytfa elu onu) exrio iy1lmt anesls0t2tr(r3nu1amte fci ( aDurum ot1aeenmf3iys m ulumonu4aetrxr3ootopD  ivsl()trtoiopoo4apt mivs t srtax pno1oexoifetytls rl(vs;t4alxnmfcoytom elnvols  rtoxm nodlpe mnctlt a2raur ;o1openio3tydfsDean o t0trerxr3tatlmD lieo;s0sexrxo3oydlmtn fci ()sruaxmo;o4alx iictatlm ulu sn(4 reoxo3oydla  lueols0 etoio iodapee nesa(fsDurur ou0ale ioctlsls2ulnvonu4 etoxocoodfpDrli o;() etm(mpnu1lme lies t) 2um(mo;o0optn oeiasfsDrl(vonu0trenio3ta1lpDrluei;s) eurimpoydape mncia(f ruru  no1tpe moeiyslm ua(mp u)trtnxf3oytlmte ueils  2xrxmpiy4lltnlfcsls) 2rrur ot0altnioctat s emums u4alenxo3tydomteau s s0teuo(o nu4olee ivtls) rtru o;u4apen ictlsls ul(vonu4 lxriocio1latrlu o t0 2uoim nu4ol elnvsls artrump;t1tpeomoetls m2ra(mp u4alermf3iotopt aueil( teurir oy1amtnmfvi t a2uax pou1ale miciyslm uanmsnu4tlenio3tydoatr i ils teurim3ny4amt  fviatfsrumu p;u1aptn o3iydfmDrmn o t)alxnxo3oodopDeaiei;(0t2xoimpnodlm  mfctatfsrta(rono0teenmiciasfmDumu o t)aetomfctadopt  uvo;()teuo(rpnu1ll  miesl()sDrax poo1tpto i3ilslsDemums u4 etnmr3iadomtr i o t teurim3iy1op nlnetlt)aDrmxmonu4tex mfctls a2eluvsnu) etrif3oodopDelieils0t2trxo3no1alt mivs (fs2tax p;t0teto ociytlaDel(mp t4texrir3ta1oa rliesls) rur(o3oo4op   fvilt artru  oo0oetniicias a umn p t0alxrircto1la rlues;(  rxm(rpnu4alenmieta(f Draurp;o1olxn ictltfsDemu s (0 rxrmf3todlat anvs s seur(r3oodome miei s) Drm( o;t4tlto ietldls rlnvp (0 rtrmfcoadfatrliei ()s2toxo oy1openlieiat)s2umxront4alxoiieiysfs uan pn(0aeeomo ta1laD luvsl(0 2ur(opiu4ap e ieils  rtaurp;o1tpt mo3tyslaDel(vp u4aeenio3oy1fpDeai o;( s2xmiopiu1ll   nei s  2rmum ;t1texnmfciasfmDelums u) eenmrcoadfpDrlu s t)srxr(rpoodlpe lieiltfs2um(m nt4opxo o3tat s eln p t)tlenir3totfa rli i;( srur(r3iy4ll elnci ()aDrr(rpnt1oex ifeiydls elnvpnu4trxnmf totopDeluvol() etoimpnu4lpee netls) Dumxr oo1aet iiciytlm2rln p;()altoxo3iy1opD anei;t) rxr(o3nu1lm elivsas srrmxmono0aetnii3iys a ul(vsn(4tetoxfcootfaDelnvi (  2tmio3oo1lptemnvil(faDrax  nt1aex moetatls2ul(vsnt4 lenmo to1fmt  u i;t) rtmxopno4amtnlncia( sDtr( pnt0oleo i3ildlm elums;() reoxr iadfm   n o ()teumim3iu4omt miesat)a2umu o;u4ale  iciydlaDrlu s;() lerxfcootfmDrai o t0truoxm oudlm elfci t  2urxrooo0tlt moeiyd s2ranvp;(4artnxf3oatla  ln sl()t2to(r3io4opt lnes t)a2rr(  ot4oexoiietaslm2el(mp t4 rxnio3oytfateli o;s teuoxm3iu1lp e icta( aruru  ;o4texo ieiysla emnvs;t4 ltrxf3iy1fp rai i;()truriopou1llenmfei t)srtru pnu4openiietltfa rmu sn(4tlxomfcoa1lp  aieo t0s2uriopnu4lpeemfeiat) rumxr ;o4altomiciaslsDeanmp;()aetrmo ia1op e ueil() 2umir oy1om  mieia(fa2ua(mpot1opxniiciys sDel(ms;u0 lxoir ootoat aiesls  2uoio iodoptn ivsasf Draxmo;o4alt  oeiyt s ean p u4aeeoio3oy1lpDrli s s0srxoxopnodole mfetat  Draxmono4texnmoeils aDuan p u4trerxo oy1opDrauei;s0srxm(mpio4ome  ncil( a2ta(r ou4olx if3ilsls2umnvp;u0alxoir tydomtraneils)s2to(rpoodapeelfeiasf Drm( p;u1oeeniiciyt m2emuvont4aleoxfcootfpt aneil(0setr(r3oy4am elivsatfsrumxr ;t0ale ii3ildfmDulnmsnu)trxomf3to1fpD an i;t)srtm(mpiodlp  livs t)artaumoou0aexn ietlt s umnvont0aexnxf ta1fatelivo;(0s2tmio io1ope  fvsat)srtax p;u4opeo feiad m umnms;t4arxrxo ta1fatrli o (0 2umxr no4al nmnvsls  rra(  ;o4aptnmictytla eaumo (0tltrxr oadlaDrlnes;t0 2tmimpio1amtelivi (f rurumpot0tlenif3tyt m2rmnms t0areomoctodopt  nvs (0 rxo(opiu1om  mncsl(fsrtru ono1aee  octls m ul(msnt4trtrif3iotlpDeanvsls0tetmxo iudlme mivs tfsrrmxmo;o0opx  o3tadlm em(mo;u0arerxo iy1lm eaivols)seuoir oo4ol nlies sfarrru  nu4tltomocildlaDem(mp u)aexoif3oa1fatr ivo;s)tetrir io4lltemfvta( aDraxmp;t4optoifcild mDulnvp u4 ltnxo oa1lmDraivi;s texr(r oydlmtnmivsa( srtrxrono4alto ieiyd a2um( snu4alxomr oadomDraues ( trxmir ou4om eliei ( aDtm(root4openioctls m2um(vpnu0artrxo to1fm r n o s  rtrxr3iudllt mneiat)sDumx oou4aptomociyslmDum(ms u0 etrmr3oydlaDr i ils)s2ur(mpio1ope  fvt ()sDumumoot4tpto ictlt mDuanmpn(4artrmr tatla  livi ()truoxo3nu4omt mnet s) rurxmont4opxn ociatfsDuln s;t)tltnmr3oy1laDe i o;s  ruoxrpio4lmt  neils arua(ro;u0olxoif3tytlm umu sn(4aexomf3iotfp  ln sls0srurxm3iu4ol nmictlt  Duau p;u1ale  ieiasfm ea(vo (0tltnxfcootlmDeli o;s)s2xmim oydol  lncils) 2raurp;t1apxnmieilsfm ea(mp;u) ltomf3tadopDrai i (0 rumim3oodape mfcsl(  rtax  ou4tlxnmoeildlm2ran p u4trtrir3io1op r ieslt) etoxr3io4apenlics s)s2rr(mpnt4oltn oetydfa2um(vpnt)alxnmf totoaD lu s s)teurxm oydaptnmncsa(  rra(r ;u1apen iciydfa2eln p;u4 reomo iotfp  aivi;() 2toxopoo1lpe  ict tfarumumpoo0altniieiytfa uaums;t0aetnmf ta1lat  i slt s2tr(rpiy1ap nlnet tfa2raum nt0aeenifetas a2rmuvpnt4trxrxf3to1fp   ivilt s2toxo3oo4lmenmncsat  rtm(r ;t1aetnif3tydfa ul( p;u0texomr3tydoatrai s t)teumxr iu4aptn ici s srta(mpoo1aexomieiydfsDeanms;()trtoxfcootoaDelies (0 rxoim3ny4aptnlnct ()aDrrxm ;u4opxniociydlaDranvon() lxrxfcoy1lp e ueolt0trxmimpiydole lfvtlt  rrr(mpou4tee  i3iysfa el(mpnu)teeoxociodopD  ivo;(  exrxrpio4alt lfvtlt srta(moou1openmi3iad a ul(mo (0 renio io1lpDeli sl(0 2ur(r3nydlmte iesas) 2uru  ou1tpxoioetyt m rmnmo u4teermocia1optraneols)trumim3iodamtn nvil()artmumo;o1ope  feiaslsDea(mont)arxnmo ty1laDe nes t)seuo(r3oo4apen ici sfsDtr(roou4apeoii3iydlaDeanmo;t0alermr tadlp eau i (  rxo(m3iu4opte nesa(fsrrmu  ot1tlenioctlslmDrm( pnt)arenmf oatfpD livi;() exmim3iydaptemiet s)sDua(ront1tpe mfcildfsDeanmpn(4aleoxr3iytlpt  uvs s0 euo(mpiydalt mnvia() 2ur(m ;o1tpxoifeildfaDemuvsn(4teermfcta1latr u s;(0sexo(rpiudome mfvil() rta(m oo1apxo oeiat aDua( p;() eeoio oytfptr neolt0s2uo(o3oodaleelncslt s2uaxm oo0olxomf3tldla2eau snt)aexoxr3tatomDrluvi;t)srtrim3oodlle lnes s)srum(  ;u0tlx mfetyt a emn o (4altrxocoy1oaDrli ol( s2umim3nu1aptemnes ( srrr(rp;o0oltomietyd m2ea( o u4trxnmr oa1opDrlneol(  etr(mpnodoltelnvsas aDtru pot4opxnif3tytlmDel(vonu0 ltomr to1op r nes () 2tmxr iudoptnmfetlsfartrump;t4aleoioeiasfa2emump t) ltrxf3iydop eaiei;s0s2toxrpnodol  lnesat a2rr(  nu4oee  oetls s rl(vsn(4 rtomo todomDrlueo;s0 exr(r3io1oltnlfvi ()sDtmur ou1tee ii3iltfs2rlu p (0 lxrxrciodlptraivsl( srtr(m3ou4amee ieilt)artr(mpno0teto ociltfs elnvs;(4texomf iytoaD  i olt srxmim3nudlp  mnet sf Dumxr no0olenmfctat mDrmuvp u4 rermr iy1fmtr uvo;s) 2tm(rpnu1ol elieilt)sDrmu o;t4tlenio3iltla ua( s;(4texomoctydlptrln ol(0 eurio iu1omenlneiat  2rru ont4alxomi3iadla2emnvs;(4artnircootoat luvi t t2tmir3oo1ole lici ()sDtrum nt1alto octlt mDumu onu4 etnmo3iodfp   neo;t0 2xm(rpoy4om n ivtlt srurumpnt1olen ieiadfaDemump;t)arxrmr tadlpDeaies ()sexmir oy1ol nlnvia( aDum( p;t0olxo ieildfs eauvo t) exrio oytop elies s)seto(rpiu1ole livta(  Dtmxmoou0alx  ocias a emnvp;() ltomf ootfmt  i i s)trumxmpny4lp n icsls)sDtm( p;t0aeeoiieiadfs2em(vsnt0aexnxf iotla elivs;(0seurio no1lpe mies tf 2rrx  ot0tee mocild m ulnvo;(4trtoxr3oatop eaivo t) 2xr(r ny4olte ictls s2uax ooo0ole mi3iatfmDra( pnu4 eerxfcoatopDrluvo t  2trirpoodope lfvtls s2rmu onu1aexnmf3tasfa uaumo (0 rtoirciodlpt li o;() euoxo3iodamtelnvtlsfs2urumo;o1apx mi3iltfmDrluvont4aeenmociy1lm  li sl()srumxrpiy1apte ncilt)s2rr(r oo4oexnmocilt a2elnvs;u4 exrxo3todfpDrai o s truoxrpnu4llenlnvsl(faDtmx onu0oleomo3iyt a ea(mp t0trxoioctodfp eaues s  2toxr3oy1apte fviatfartaump;o4oeenmo3iydlmDran o u0altnifcoy1lpDe nei () 2urxopio1alen fvsas arurxmonu4oltnioeiytla eauvs;t)altomr oo1omtrlieslt)s2xm(o oo1amt mietasf Drr(r nu0olenmo3iydfsDelnmpnt4altomf3oydop  auei t0 etm(r iy4ole  fci sf Drm( oou1olxoio3iytlm emump () ltoxo3iydopD li s (0srur(rpio1opee fet t aDumum ou0tpeoif3iat s2el(mo;() lxnmr3oadlp raivolt) ruoim ou4lpe livsl()sruau  no1olt mf3tydfaDelumonu0 rtrxf3ootom r i s s  2tr(o iu1opeelieils) Drax p;o0opxo ieildlmDea(msnu0alenmo oytomDr i il(0t2xmxmpoy4amt  fvias)aDumx ooo0tee  feiysls ran o;t4 rxrmo totomDe nes;()trtrirpoo4llte ietas  Dumxmp;u1tpe micildfs ean p;t4 lenirctotfmDeln o s t2xmim ny4lltemfesls srtrurp;o4aptomfctys s2emuvs t)alermo3oo1fptean sls0t2xm(r3nu4alenlfvsl(fsDtaxr ;o4apenmiciys s emn pnu4 etnif3tydop rlu ils) rtrio3ou4al  lnvia(f Dum(mo;u0tpxn ociasls2rmn p u4 rxomr3iydlm e n ilt  2tr(m nodoleemietl(fsrumur ot1opxoiociasla2ulnmonu4treomr3iadomtr ivi;s trurim3nodlme  ietlt  Dua(m no0ale mieild mDeluvp;u0 exoif3tadom   n i (0 exrio ou4lp nmiei ()artm(  ;o1tpeomfctlsfmDuaumont4artnmfcoatfmt liei;(0srxm(mpnudlpen nvtlt) 2uru poo4teeo feiysfs2umnvp;()teeomf3iadlmD  n olt)s2uoio iu4ap nmivil()sDtrump;t0teen i3iadfa2ra(ms;u0alxrmf3to1omD li s;s)s2uoxr nu1omtnmieia( aDurum ;o1oexniociytls2rlumsnt0 ltnmo3tatlat ai s;(0 rxrio3nydllen iviat)aDur(m no0apt moeiytfs2ra(mp t4teeoxo iy1fpD  i ils  rurir oy1ole  fct () rurumoou4oetn iciydfsDumuvp;() etoxocto1laD aiei;()trtrirpno4ope micils  rta(r oo0olt  fciltla eau pn(4 eerirctadfa eaies t)trtrxm3io1amtelneslt s2um(r ;u4apeo i3iys a em( s;t0 rtoxf3oo1lpDeluvilt) rxm(m3nudome  fvs s)a2tmum ;u1optnifetas s2eluvs u)areoio3tytfmD aueolt t2trirpno4opte feil(faDtrxrp;o0oex mi3iatlsDem(vp;u0 rtoio oytlateln i;t0t2xr(r io1omte iet s sDtrumpnt4tlt ioeiltfm ra(mo;u4 etriocoytlm   uei ( tetr(o io4omeemfei tf 2ua(r nt0oetomf3tydfmDean s t0 rxnif3oydlat aivil(0srto(o3io4amt lncsat)s2rmxr ;u1openii3iltlsDrau p u0tlxoif3tydomt livi s)s2trxo oydop elfetls) Dtmur ou4aexniieiatfs emnvpn()teeomf3oa1lp  aues;s)t2uo(r3ny1omeelfcils) Dra(  ;o1opt iietaslmDrmnmpn()aleomr3iodlat an i;(0truoio3io1omtemnet s  Dtmumont4apx mietydls umn snt4aeermf todlpD  nvsl() rur(m iudop emnvtlt) 2tru o;o4tlxomoeildfsDul(mo t0aeerir3ia1fpDr ivi;(  rur(opoo1ll   fcsltfarrmxro;o1tlxoifeiydfaDem(vsnt0arxoxr oydfmtr i i () ruoir io4lp  mnct (fs2rru oou1aleomfctatfsDel(vo u)artnxf oo1fmDrai sls)s2to(r3no1al  lncs ()artr(  ;o4aeenmoeiytlaDulu s;u0 rxrmo3to1lp e nvs s teto(m nu4aptn ieslt) 2rax oot0opxo fctyt a2rluvo;t) etoif oodoaDeln s;t) 2tmxm3iy4opeemfviatf Dtr(moou1tle mietas sDemuvsnu)alxrxf3ta1fmte iesl( sexmxm nodlpt lfei s  2urxm oo4oexnioetldla2uan pnu4 ltrxo tydfptrlnvolt0 2xrir3oo4aptn icil()a2ta(rpoo0tpt  o3ias s2elumsnu)altrmo ia1fmDe u sls) 2xriopoodlp  mnvtat aDrm(m ;t4oex mfeiyt aDrlnms t0 ltrxo iotopDraues ( s2xrimpoy4am elnet t a2tmxmo;t4oexnmoetltfa rmnmp t)aetoio oydfpDeanes;s trtoxmpiu4lltnlfvsltf rumx  oo4aetnifeiltla2rau s (4alxnxrcio1lm e n sl(0s2tr(o oy1lpteliciasf 2tmur ou4olt ifcilsfs2rau p;t0alxnmo3oydopDr iei;(0texm(m3no1aleelicilsfs2umu  oo4altnmictldfs2uluvon(0 rtnxo iydlmD ai o;()srur(r oo4ame lfcta(fa2ta( p;t1opxnmo3tlslm eaums;(4 rtnifcia1omDrlieols0 etrxopiy1olenlfesls artaxrpou4tlxnmi3tlt s2emnvont0aeeoir3oy1lp   ues s)trxoxmpnu4lltemivsls  rtru  no0tlt  o3tatlm uanmpn() eermocia1oa  luvs;(0 rumxmpiydolenlivta(fa2tr(r nt4teeo ociatfa elnvs (0 rerircio1lpDeanvi;t sexmxrpnu1amenlneilsfa2uau poo0apt mocildfa2ra(vo;u4trtnmo tadoat  u s t)seumiopoydll nlivia(f Dumu  ;u1olxomfciadlm rmumo;(0arerxo3tytfa  au ols) 2to(m3oo4ap emics s sruaxro;t0ole io3iyt mDeanvp;(0texnif3to1lmteaueilt0s2xo(r iudlmenlietlt artm( ont1apxn ociat sDrau on(4 rtoxfctotfaDeli ol(0texr(m no1omee ivsl(  Dta( o;t0aeeomocilsla2umnms;u4 eerxrcio1oa rluvs t)t2triopno1opee fei () rur(m nu0oltoif3tytfs2rl(monu4texrxf oo1fm e ieo;s)srxo(r3oo1aptnmnvi tf Drrx onu0oeenio3tltfs2eluvsnt4 eerif oadfm elivslt) ruo(r3iy4ale lieslsf rtmuro;o0aptnmi3ias m ulums t4alxrxr3ia1lat aueo;() 2umirpou4amtnmfvi (f rur(  nu1tpt  i3tas a um(vo;t0aetrmrciydlm raivo;(0 2toirpoudlptelnctl( arrmum ot1tpen f3tytfm2rlu on(0tlxnir iytlm rau i;s s2umiopiy1op  lnesl(fsDtmx  ou4tlxo f3iadls uanmp;(0tetnio oadfp   i sl( setrxr oo4aptelnvs sfs2tmxro;o1aex  o3tls a2elnmsnu4aeerio iodomD livs;() 2trirpoodlpee nci t)s2rmuront0tptniociltfa2elnvs u)texnxo oo1oaDeanvi;s)srtmxr3iu4llt mnvslt)a2umxrpnu4oetn feiatfaDuanms t4arenxf3ta1op e i s;s)teuo(o nodlmtnmicias arta( p;u4aptn ociltfs2el(vsn() reomf io1latrai ils s2xr(m oo1ol emivsl(  2trxmono4texo oeiltfm uaumon(4 rxnxfcio1laD lu i s) 2uoim3oy1om n fctl()aDua(mp;u4teeomoetyt mDulums (4 exoio ty1fm  auvs;t  2xm(r3ny4ame  ictl( aDum(ro;u0tlxomfctysfm2rmuvp t)trenmr3iy1opte nvsls0teurir iu4lp   nesls s2tmxmono0tpx ifetas s2uauvs ()arxrmfciydfa elieo;()t2xo(opou1op nlietas)sDraumpnu4aexn fetltlaDra( pnt4areoxf3ty1oa r u i;t0s2tmxr io4amtnlivsa(fsrraurpnt0tlt ioeiltlm2rmnmp t0teenmo3iodlmte u olt)srxoirpno4lmtnlfciltfarrr( o;t0optoif3ildlmDeau pn(4teenxocia1lpteli s;( srur(m3ou4lme mnvil( s2tr( pnt4oee io3iydfs rau o u0tlerxr iy1lp rauvi;s0 rxriopiu4optnlnvt sfa2umum nt4oet mf3tltfs2uaumonu4trtomf3todlpteaieslt)sexmxr3oy4lme  nei ( s2rr(  ;o0apxoio3ild s2rl(mo t4 reoxo iatfa eanvs t s2xrir3iodlltnmieil() rrmx pou1ape mo3ilsfa rl( p;t0 lxomo tatfpDe n s;(0t2xrimpoo1olee fetlt)sDumxmont1tetnmietltfm2em(mp;t0trenmo oodfaDr neo t0trtoxopny1ol n nctlt) Dta(  oo4tleniieiltfa ua(ms t)alerxo3ia1fptelueil( tetoiopiydllt  nct (  rumxm nu1oeen i3tytfmDumu s;u0arxoif ta1lat aueols0 2xoxm ou1amt  neil(  Drm(mp;o4alxn oeiys mDelums;u0trtomr oy1fpDeln s;t0 2xmxr3oo1olenmnciat  2rru pno0olto i3tyd s ranmpnu) rxoiocoodopDr nvo t0 etr(r3nudolt mncs t)srtau pot1tltniicilsfa2em( pnu)aetrmfcoytom eln s;s)srtr(r ou4ome  nvsas aDuax p;o4opeo ieiytfa2rmums;t)trermf3ta1oatr ieol( t2urimpiy1ll n fcs s a2tr(  oo0ale iieias a el(mo;t)altomr iydfa eauvol( t2tm(m3oodlm e net (f Drmxrpoo0altoifeild sDeanmp (0tltnmr3iydomtelu i;t srtrxm oodlmtelfvs (faDur( oot1alxomiciltla el( s ()alxnxr io1lmDrlu o;s  eur(mpnydop  mfcs (fartmum no1ope  ieiysfsDem(vp t0 eerxr3oydop rlnvslt)t2tr(m3ny4lpe  nct ()arrax pnt4opxomoeiatla ranmp u)areoif ootopD  i ol(  2umimpnodom nmncslt arumx  nu0tle mfetlslmDemumsn(4tetrir3tadopD  ivs s)srtmio iodoptn iviat)s2tmx o;o0tpx  fetlsfsDeaump u)alerxo3io1fmDe n i;( srtrxo3iu1lpeemiesa(farra(  ot0teto fciyslm2el( s u)teenxfcto1oaD au i t  eum(o oo4ole lnesas sDumx oou0olxnmf3iyt mDemnmsn(4 exrmr3iodoaDrli i;( texo(r3iodap emfei t a2taurp;t4oet iietatfsDumuvp;u)tlxnmfcto1fm eli il(0 2to(o oudamtemfetltfa2rr(  ;o0teen feilsfaDrm(vo t)arenxrctatfaDrauvs;s s2xrxrpiu4op emicsatfsrra( ont0texo ietltlaDeauvpn() lermo iodlpDr n slt0trtoiopiudamt licias s2trx  ;o1opx moeiadfa2rl( p;()aexrircoatfmD an il(0tetrim3iu1llt  ici ( a2taur nt4opxn fctlslmDua( o (4 leomrctadoptrln i;t)t2umio ou4olt  ictl() rtrumpoo4teeniocias m rmumpnu0arxnmfctydlat anvi;(0s2xmio3iu1oleelfetls)aDtrx  nu0tex iociydfsDulnmont) rxnxocia1la  li ils) 2toimpny1ol  mnvilt)a2tmumoou4alxnmfctas sDulumpnu0alenmoctytlaDrlu ol( srto(m3ny1omeemivs t)artru pnt1altnii3iasfaDrm(mpn(4trxrif3iotlpD li o ( t2xoio oudapeemfvi ()arrm(  nu1oleoiiciysla2ua(vp;u0 exriociadoptrlies;(  rur(m3nu1al  lnesa(  Dua( poo4teeoiieils mDrau o;u4 rtnif3oytomDelu slt srtmxo3io1lmtn nvsas) 2ra(mont1tlen ietydla2rln snu) exnmf3oydoa e nvs s)setoxopnydlm nmivsls  2ur(m ;t0apxnmietltlaDrluvp u4tltrmo ta1opD anvs;s)tetmir3no4lp emncilt s2tr(r ot1open i3iysla2el(monu4arxnmf iytop  lu i t0s2tm(opnodamee iesa(f Dtm(rp;o0tet if3ils s elu pnt)arenmfciodfm eaneo;s)t2xrir3iu4lme  fvsl()s2ua(rp;o1aleniocilt m2ulu o (0trermr3oytlpteauvs;()srxr(opnu4lmtelfvi sfs2ur(m ou1tpt io3iyd m2eanvo;u0 renxf oo1faDraivs s0tetr(mpoo4llenlivta() 2umuront0texoif3tat s uln p;u) exrmo3oytom rlnvo s trxmiopno4lptn ictlt  rrrx pot4apeomfetyslm2emums (4aexrxo totlaDraueo;s) rur(opiudame livtltfsruaurooo1aptomfciad m el(vs;(0 lermo oatfmt au i;(  rxoxrpoy4opteliciat) Dumur nt4opxnii3iltla emump;(4 exrmfcto1laDeaivsl( srtr(r ny1op  liet s)s2rrx  ot0tet mfeiydls2elnvsn(0arxnmf iydlmtrlneo ( srurir oo1alt  ivil()sDum(m ;o4apxo fciydfa rl(vonu)trtnxociytlmt  uei t  2xmxr nu4amtelnctasfsDrrxronu0alxnii3iydlsDuauvp (4 exoio ootoat lues (0s2urxo oy1ol nlfvi sf rur(mono1tptn fciltfmDrau snt0 lxrio3to1lp  li olt0 2xmxrpiodap e netasfsrtaxrpou4aetnmf3tytfm ea( pn() lxomf todlpt lnvslt  etm(o nu1apt mivtlt)a2tmu o;t1tlenifetyd mDel(vo (4 lerxrcoydomD aiesl( seto(r ny4alen fciatfarrm(mp;u0olxomieilsfaDem( pn(0 rtnifctodlpDeluvs;( seto(r3oudomt  fci tfs2uaxr ;u1tleo octaslm2ra(vs;() etomr ty1opDrlneolt  eur(o nu4lmenliesa(  2tmxmp;o1tpx mo3iydfmDeanvo;u4aeeomr iytfaDe n i;( t2xrio iy1al  mnvt ()srur( pou4oeto o3iasla ua(vonu0 etrmrciotopD  ues (0trurio3iudlltn fvi s) rtaxm oo0opeo fetatfa2eaumo;u4arxoxf3oodlmD aneo ()srtmxo3oy4lmeemfvtlt  Dumur ou1olxomfeiydls2ua(vo t) rtomf iydlatrli ols0 rtm(opny4ap emicsa(fsrtrurono4tpt  f3iyt s2uanvs t)trtnxr tytfa elivilt) etmxo3io4lp eliciasfsrua(mo;t1teen icilslsDua( p () ltnxf3todfat  nvol()t2xriopio4lm emiciasfarra(ro;t1tetomf3iltlm2um( p (0 exrxr3ta1fmte ueol(0srxrxo3iodomtelivias srtr(mpnt4oee mfctld sDemnms (0tetoif tytlpteauvs s0texm(rpoo4ap  mics tfaDtmu ono1alt if3tydlmDumump ()trtnmfcio1lp   u o;s0s2to(rpiydaptnlnvil() Dtrump;u4tlt  oeiydlm uauvo;(4tltoif tytfm  anvsls)t2xrxr3iudamt lneiatfsDraumooo0oltoifetadfm ulnmp;t4 lxoir tadlat au ilt t2umxrpoydlm e ictat aDrrx ont4tle iieiasfsDranvpnu4teenxrcto1om eanvslt) 2tm(rpiu4ap elfvilt) Dtrxm ;u4tlxo ociadlaDrl( pnu)tlxomo3tydlaDrlu s s)s2toxopnu1ol nmfvtl()s2ta(rpnu1optn o3iyd a rm(mpnu4trxrxo3iatfat lueolt0 eumxr no1amen ietl(fsrumxro;t0alen oeiltla2elnvonu4 exrxf3iytlmte uvs t)setmir iu1omeelncsa( aDtmxrpnu4aeeomicilsls2ea(von(0aexnxrcoytomDrlieols0 exo(m oudomtn fvt ( sDtmxmpnu4texnmfetas sDeln sn()tlxoxrctadop e ivs ()srtrimpoy1aptn fciasf Dur( p;u1aexo oeiadla2ran s u4 eeoif3iytlpD auvo (0 rxm(m3iy4alenmieiat  rtrxm ;o1olenmieiltlm em(vp;()altnxf3ia1oat  ieil()teur(m nydame livils) Dra(r nu4tpxnmfeils m2ulu o t)alerxo oo1fptranvo;s)truriopny1ll nmiei s s2umur ;u1tpe ioeiyslmDel(ms;(4 ltnxociotom raneil() 2xr(rpnodame lfvs ( s2rax  oo4tetoiictasfs2um(vo;(4 ltoiocio1oa eanvs;(0 2uoim no1lltelnvia( s2rmxm nt1olt mietadlmDumnvpnu0tetoioctotop r ueolt0srxrio ou1lmeemnctlt) rrrumpot4aexo f3iytla2uauvo u4tetnio iy1fpDeai il( texmir3iudlm nlfvsat)arrr(mpno1tlen oetyt aDemn o t)aetoxr iadoaD  nesls seto(r iudol emfci t)a2rrx  ou1opxnmfeiys s elumo;u) rtnmr tatfpDr i ol(0 2trxo oo1omeemnci s) Dua( onu4oee mfctysfmDeanvpn(0alxrif3oatlm raneil(  etmim oy1lp   net (  Dra(rp;o0tet moetas aDelumpnt)tlxriociydlpDe i il(  eum(r3oy4lmenmncslt  rrmxr oo1olxomociltfaDulnmpn()tetrmo iytfp  aueil(0srur(r oo1am   fvt ( sDrm(mpoo0oee io3iyt a eauvs (4artrxf oo1lmtr i ol( srxoxo oy1altn ietas s2tmur no0aeeniieiysfm2rm(vs;u0 renioctodfmDe ueilt0teum(o oo4al   fct ()srum( o;t1ope io3tlt a ulnvo;u0 rxrmo iydomDeli s;s0s2uoxm3ny1op   nesat s2rrurpnu1aeen ociysla2uau on(0 lenxr oatfateaivslt) rxoim nu4om emivilt)a2rm(mp;t1aexoif3iadlaDeanms u)alxnir iatfaD anei;s)s2xr(mpiy4apee fcta(faDuaump;o0tex mfciltfm ua( onu0tlxomr iadomDr n s;t  etrxm nu4ome mfcias  rra( pno4oltniieilsla2ulnmonu) exnmo tytfaDrliei;s0sexmxo3nu4oltnmneil(f rraxmoot1opto f3ild m2uau s t0trxoxr3ia1faDr ivi s s2trxopoodlmtelfcs s) rtaxro;o4optnmoeiltla ranvonu0trxrxr3iotfa  lies ( trxr(m3iy4lme  fctat s2rr(ronu1tptnmf3ilt a emnvo;t) lenmf3totla eauvols trtmir3iydalen fvsasfsrtm( pot0tptoiociltfmDeau s;(0 etrxocia1fmD livslt0 rxmim iu4ll nlivt ()srrmxm oo0apt ioeiyslm emnvonu)altoxf tydfa elneo;(0t2umxopoo1lp e icsl() ruax pnu4tleoio3tydlaDuaums;t0arxomfcto1opD ai s;s0trto(r3io1lltelietl(faDua(m ot0tpxo i3iltfaDrmuvs;(0 rtrio tytlpD  nesl(0srxrirpio1alt livtatfsrtm(m ;u1alxn feiysfa elu s;u4aetoxr3iadopDean o;t0trxriopno1omtnmncil(farra(r ou1tpxo f3ilsfm2rmnmo;t4trtnxr3ootfa rluei;t setoim no4ope licsatfsrrm( o;t0aleo i3tasfs rlnmo;u0aleoxociotlaD an ols texoxm3iy4lm nmiviatf rumx  ot4oexomo3iat m ua( o;(0aexrxr3tytlaDr uvi s0s2tmxr3iydamtn net sfa2uax  ou1tleo ieilslm2ua(vs;() renmr oy1fmtrau o;t0setoxrpoodlpen ncia()s2taxmp;t1texnii3iatfs rmu snt4aleoiocta1lat au ilt0s2trirpoydoltn fcslsf 2trxr ;o1tptn ietyslaDrl(vsnu4 etnxf3oodlpDelneilt0 exmxm oydolenlfvtat  2urumont1tle mociad mDemuvs;t0 ltoxf io1fmteluvs (0s2trio oo1lle mfctls  rumu  nt0aeen feildla2emn pn()alxoif iydoaDe iei;s)trto(o3io4altn iesl(  Dtaxro;t0oetoio3iytfs2um( s;u0artriocoadfp eluvilt0trtm(rpnudlmen fet t aDtm( o;o0aet  oeiysfa ua(msnu4 eenio oytomteli ils)trto(rpnydol nlict s)sDumxm ou0tpeoio3ild a eluvsn() ltnxo3iytlmDe u s;t srxm(m iu1lm elnvs s) Dur(mpou1tpeoiieiatls2rlnmp;()texrio3tytoatean s;( t2xoiopiy1omtn fes s aDtmx oot4tpeoioeiytfsDuau s t4 rermo3ootomt lueilt) etmxmpnudop   ieiat)artau o;t0tpeo ieiad sDum( pnu)altnio ty1lpt aieol(0 eurir oy1op emnei (f rrr(rooo4olenmieilsfsDrmu onu)alenmo to1omtr n o;s  eurxm ou1lp elnvsat srtmu  ot1teenmictyslm2ua(mon() eermf oa1lmt lieo;t)seuoimpno1llt livi ()sDrr( pnu4teeomieilt m em(vo u0aleoxf3oo1fm e nvo;s  euo(mpnu1ape  feil( a2urump;u0aee io3iaslmDrmn p;t0aetoir3iotlpDrli ilt0teum(r oy1ap   fvs t  2raur ;t1tle iietlt s2ul( s;(0trtoxocia1omD  n olt0setrxm3oodomee ietltfaDururont0oexomi3ilslmDeaums;t4artoxf oydlm eai o;() 2uoxopoy4altelies tf rrrxr ot1openiiciytfa uaumont4 reoif3oytlpD  neolt0t2toio3iy4llt lnct t s2um(  no4ope iocils aDua( snu4aexoxo3oodfmtranes s0seumim3oudopenmfcsat  2taxmono0aet  ocildfmDulums t4 renir iydlmtelieo s sexr(opnudopeelivi s sDtmxro;o1oltnifeilsfs2ea(ms;u)aexomfcoydfa e nvo;( t2umiopnudamt  nvsl(fsDrm(m no4tpeomi3ilslsDrl(msnu0 ltrxfcty1fmD luei ( t2uo(r3nodlm  lnvtasf rumurpnu4aexoifeiys m ulu snu0 etomo3tatfm  an s;() rurirpoy1al elicsltfa2umxmpot0alto i3iatla2el(vo t)tlenmr tadlpte nes s)setm(r io1lp emfvia(  2trxrpnu0oeto f3tlt m rl( s;(0tltnmo iydlpD  u ols0trum(o nodlp e nviatfaDtmx  ou4aleo oeiyd s ua( s;u0alxriocoytomDe uei;(0 2um(r oudal nlfcs tfaDra(rp;t4ope  ieilsfsDumnvsn(4teenir iadlpDr ueo;t)truo(m no4ame  icil( srrm(rpou4tee mo3ilt mDelnvpnu) rtoxfcto1opD auei;( texr(opoudolee nct t srrrxront1aee mietad sDua( o;u4texoifciydom raneo;s)teurxo3ou1lltnmivt s s2urxmont4oexomociyt sDemumo;u4 exrircta1faDeaieol()trtm(r3oo1al nmfcs ()s2taxrpot4tpen iciad m um( o;(4 lxnxfcia1fpt  uvs s0 2toio3oudom nlieils)arumu poo4aetniiciatlm2ea( s ()artoifctotla  aueslt0trxoir oy1ome  nctatfsrumx  ;t0olx ii3iatls2rlnvsn()alxrxf tytlm rauei t0s2trxr nu4ole mivtl()srur(  nu4olx mi3ilslsDulu p u0trtnmo3tadlp rluei;( truo(m3io4aleelfvtlt) 2rmxrpoo1alenmo3iasfsDran snu4tetoxr3tatfpD  iei;s srxm(r3ou4lpenlfctat) rrr(r ;o0tetnmf3tad aDemnmsn(4 etrxo ootfpteaiesls0srtrir oo4alte fesa(fsDumx o;o4teeo f3tas m2rlnvp;t)texnxo iadfat lu il(0 2toiopio1op   fvtl( a2ra(rpnt0aptn f3iadls rm(vs;()trenmr3oadoaDeln ols0seumio3no4lmee fetl()aDtrx pnt1apt mieild mDem(mp;(4 leoif iatom  lnvs t0t2tmio3iu4omeelics ()sDrrx ont1tpen o3tasfa2ul(vp u0 eenio3iodlatr uvs ( trtoimpoy4ll  lies (f Dumurp;u4ale  o3iatfa2um( p;t4 renio3tytla elivi;() 2uoxr3nu1ape  nctl(fsDuauroou1opx mieilsfa emuvo;u4 leniociytla raieols)srur(o3iy4amen ict s) 2tmxmp;t4apxnmfeiysfs ul(vo u0tltrxr3to1lp e neo (0t2umim ou1aptelfctlt)s2um(  ;u0tlxnmictlsfmDuanmp t)texomfcoodfp eluvo (0setr(opnydapeemfcslt  Dtmu  no4apxo fetysls ea( s;u0 rtoio3tydomDelu s ()t2xoir3ou4omtnlnvi tf 2raum no4aetnifciytfm2eauvs;t) rtoif3io1fateaieolt)s2uoxmpiodlltn ieia( a2ur( ont0alen fetytfaDua( snt4tlxnircty1opteau il() ruo(m no1llt  fctlt  Duaur ;t1aptomietat a rlu ont0 renifcta1fmD ai olt  eto(opnodom nlnvi s aDuau  ou1ole iieiat a uanms (0alenmo3tatlpDean i;t)s2xoio nydomeelies (  rta(r ;t4opx  i3iadlsDelump u4trerxo tytlp r uvols0seuoimpoo4alenlfct sf Dtaurp;u4apx ifctad mDeanvo t0trxrir3ta1fmt  ieilt)trxoxr no4op e fciltfs2ra(m nt1aeeomfeiyt s2eaumsn(0 rerxo3iatoaD  i s;t)t2xriopoo1ome  nvslt a2urxm ;u0apt mictlsfa2umums;u0arerxrcoodlaDean s;t  rxo(m3nodopenmfct ()sDumu p;u1aleomoetys a em( p (0 ltnirciotlm  anvo;(  rxr(r oodoleemnciatfartrxr ot1opx mfciyslsDumu on(4artoif ta1lp   nvslt0t2umxo3oudlp emfvilt)s2umu ooo0olx mf3tltlmDemu p u4 rtnxr oadlaDraies;t  rxo(r oy4lm nlietas s2umxrpou1aptomoeias mDra( p;t0 renir oodlatelnes;( texrio nudlm  mfctl()s2urxrp;u0ale mf3tltlm rmnms t) lxnio iy1fpteauvi t0trumxrpiu1al elnvs (f 2taur nu0olenmfeiltlsDrmuvs t0 eenxf oy1fpDeanvsl(0 rxo(mpno4lpt  fcsas sDtrxmpou1alenif3iadlsDrm(mo t)aeeoio iadopteauvi s0 rurio nodole lfetat aDraum ;t0apeoii3iatls2ulumsnt4 rtomo ta1laD lieslt0 rxm(o3io4aptnlnesas aDtm(rp;u4tpxn ociys a2em(mo;(0tetrxf iytla  liesls  rxrxrpoo1ol elieils)srtm(root1alxo i3iatlm ranmp;()teenio3tadopD an s s0srto(m oydomtemiviltfsDtr(ronu4oeenifetltls ulumsn(4alerxocoadopD aues;t)srtrxm nudlp  lieslsf 2trx pot4apx ifciatfs2umnvsnu4teenxrcoodlp raivi s  rumio oudlme mnvi s sDum(mont4apxn oeiytfm emu p u0aeermo iodlaDelieo s trxoxo io4ol   ivt t  rra(r oo4oetnmiciad mDel( p (4alerio tatlaDr u i ()srxrxo iydoptemnetls  2uaxmonu4teeomo3tltfsDemnvs;t0aetrifcoadlaDeai i s0setoiopiy4lpe mfctls)a2raumoot1opxo iciltfs eln s (0 rxomrciatlaDelueo;s  exmxmpnudam elfcsl()s2rm(mp;o4tetn fetadfm rlnmo;u)alerxf3io1fm   nvsl()t2toxm iy4ome miciat)a2urxm ;o0tpeomoctltfa uanvsn(0trxrxfcty1op  livo;t srumio nodlptelnvtlt)arraxmpnu1apxnif3iys m2elu p (0 lxnif tytfaDean s;(0texmir oy1am e ivsas)aDtmur ou4oltnmfcild a uau o (0 eeoxf3io1lmtrlu i;( trurimpoy4opt  icslsfa2tr(rpou0tlxo oeiatfa2um( s t0altnxr3iytlaDe ivs;t t2umxr3ou4optn ivt s a2rmxr no4opxo oeiltlsDumn p (0 exrircootomD an i s)t2tm(r nu1alee ict s a2tr( pnu0tee mieilsfsDranvo;t0 rtrmr tatfmt  u slt  etrim3oo1apenmncs s)s2uaurp;o4opxn ociatla2eln s;(0 ltoxf ta1oateliei t0texoiopiudape lict t a2uau pnt4oeeniociadfs2ranmo;t0arxnxr3iytfmt  uei t)srum(opnudam n fvsl() Dtr(m oo1oex  feiysfs2um( p t)alxoxf iytopDelneo;( setoxr oo1optn fci (fs2taumpou4olxnmfetat a2rlnvp (4teenxr tydopDrau i;s  exoxm no1op  lfci sfaDrr(m ;o0tlt mfeiadfm2el(vp t0arerxfcoy1fptrli o s  euriopnu4opeelivsltf Dumu  oo4olt  feiyt s2em( ont)teeomfctodfpD  uvs;t0trtrxr3io4ap  mieta(  2rruroou0tptnio3iad mDumuvp t)aexoir3tytlm e uvi;()srxoio3iy1om  mnvt t)arrmxm ;t0teen ietldla2elnvp;u) leomfctotomt anvs;s)trxo(opiy4alenmici t)s2umum no4tpe  fciaslm elnvon()tetrif3ta1fatean sls0t2uo(m3iudolt lncsa(  ruauro;o0tet ii3ilslm ulnmon(4 etrxrcty1op rau sl(0tetm(opiy4op  micsa(  Dumxr nt4tetn o3tatla rmumo;t)tltomrcoodomtean o;t t2xr(r3iu4opeemivtlt srtm(mont1olt  oetydla2elnmp;t4aleomrciytomt  neslt t2ur(rpnu4llt mfvilt) rtm(monu1oet micildls2eauvont)teerif3iy1fp   nvolt) 2umxm ou4lm elnct tf rtm(  ;t1olxnmfeiys m2uanms;()tltoircoodfmD lieo;t0srtrio iu4ll nlfvia(  2raxrpnt4oee if3ildfs uauvpnt)alenio ootla r nes t)srxmim3iodlptn fei (f rraxrooo4tltn ieiysfs rlnvs;u4tleoxrctotlp  an s;(0t2trxr3io1ol   icsasfaDra(rpou0tex  i3tlt s rl(ms t0aexnif iadfaDean i t teum(m oudlltnlfeslt  rum(m oo1tpxoiiciydfsDrm( s t)trxnxr3oy1lmtraneo t0trtrirpoydol e nei tfaDtr(mpno1oleniiciltfaDua( s u) lxoxo ty1lm r ivi;(0setmim3iy4opeemnesa( sDrm(m nu1ale  o3tys s ulumsnt0tleomr iotfaDeau s t0srxmir ou4lm emieia( arta(r ;t1ope ifeilsfsDelnmp u) etrxocto1om   neo;()seumim oo1op  lnes () Dur(mpot4opxniieiydfaDrlnmp;u)artrmrcia1oatrln ol(0trtrxopny1alenmieta() Duaxmpot0ope iieiatfsDeln p;u)trxoif oatfmDeluvolt) ruoim3iodom e fvt t  Duaxmo;o1oex mf3iysfm2ran p u)altnmr oodfaDrlu s;()t2tr(o3ou4lp elfcsatfs2tm(rp;o0opxoifciys s elnmo;u4alermfciy1lm elneslt0 2toxrpoy4omt  fes s  Durxr nu1optnifcias a ra(vsn()artrxrcoo1omtr uvs;s teumxr iydaleelicilt srtr(mpnt4tleomo3ilt s2rlumpn(0alxomocto1lm raivolt  ruoxmpoodomt lnvtls arrau  ;t0ape  iciaslm emn onu)artomf3oo1omDrliei s0t2xmxm ny4am nlfes t)aruaxmont0aptnmfciytls ea(mo u0tlenio3oadom   ies (0srtoim nydlpte ies () 2rauroot4oex io3iat a2rmnmo t0trenxo3todop e uvolt) rxoxo3iu4ape  iesat  2rmurono0aeeo f3tlslaDumnmo u)treoifcoy1fmDeai s s teto(o oydlle lncsat)srtaxmpot1alx mi3tyt mDuln o (4tltrxr iadopDr nvils)setmxrpiy4lptnlnctatfsrtau  ;t4aet  iciadfm2eanvon() leriociytla ean o t0 eto(m3iudom nmnvs ( artm(root0tlxnif3ilt s2rm( s t) ltomf ty1fp eai ils0s2trirpiy4lp  lnetl(farrruro;u4alxoifciyt sDel(vs;(0tltomociotlmtean s s0srxoxopny4ole mneta()aDrmxrpot0tet if3ias m ua( o;t4 etnxocoa1lm   nvil(0trurxo oo1lmenlfviltfs2tm(mo;o1tlxnioeiad m2em( p;(4 ltoir tytlp rluvslt0tetoim ny4opt  fcs s sDumxr ou0tlt mfetlsfm ua(vo t)aeeoirciy1faD li ol(0s2toxopnu1lp   ies tfsDra(monu4alt  oeildfm2ra(vs t4texnmrcoadoa r ivils texrirpiu4optnmfet ()aDtm(root1ope ioctyd s2emnvp u4aeeoxr3oadoptrlu i s0 2xr(r oydlp e fvtl(f Durx  ;t0tlx  fciasfm el(mp;()tltoxrctatfaD  uesls0teurirpiodlp nmies () Drru oot1apxomieiyslm rmnmonu4tetoxo ootomte ivi () exrim nydapenmfvsl(farrm(  ;o0alenmo3iltlm emn o t)artomo3iydomDe ivs t0 rxmim iy1am nmietlt)sDtrxr nt1opeoioctad sDemnms;t0alxnxf oatfaDrauvil(0seurxo3oo4apenlnvs (fsrta(r no0openif3ildla2elu o;u4 etoif iadfpDeauvi;()t2um(o io1apeelncil(fsDum(  oo0tpe mo3iydlmDra( p t4 exnxoctydfmDeauvslt)s2urirpno1llt lnet t srrrx ont0alxnmfciyt sDea(mo t0trermf oatomt lies s  rxo(m3iu1al   ict (fsDtm(rpnu0oeeoio3tydlmDemnvp;u)tetrxf todfmt aivslt0seuoxm nu1omt lfcs (  Dum(mpno0alx mo3iltfmDulnvpnt0tetriocoa1oaDeln olt0 2trxo iu4lp n fvil()arrr( pot0oexo iciyslmDrluvonu)trxoir3ty1laDr uvols0teurir3iu4omtnlieils aDurxrpou1tle ioetydfs emnmp;t0 ltnxfcoydoptraies;t  eum(r3io4olte nciat s2tm(ro;u4ale  fctysls elu s (4 ltrmr3oy1lmD ln s;(0 rurir3nu4al  livtlt)srtau oot4olxomi3tlt mDrlumo t0aexrxf3todom eluei;(0 rxoxr3io4omt mfctls)a2umurpno1tpeniictadla2uan snu0 eeoxr oy1lmte nei ()texm(m3iu4lleemncsa( srumxmooo4oexniieias s2emn pn()tltomr oadlaD lneo t) 2tm(mpoo4lme liviasfaDtrx  no1aex  feiad s emn on() etnio3ootop eaiei () euo(o3io4apee fetls)a2uaxrp;t1tle mf3iatfaDrm(vo;(0trxomoctatlmDranvs;t)seum(m oudale mivi ( a2rr( o;t1tet  icilt aDel(mont)trxnmoctydoptrluvi;t) 2toxr3oo4lm e nesa()a2taxm nu1aex ifetat s eauvsn(0altoxocoytom r n sl(0trxoxr iodamt lieta( sDtrurpoo1apenifetydla uauvo u4trtoxr3tydfmD anes ()trxoirpiudap elivsa()sDurum oo4olxnifeiatfa elu o t)alxrio oatoaD livsl( trur(opoydll nmnvi (fsDtaurp;t1tlt  ietysfa elnvon(0altnir ootoaDrluvs s setoxo nodomtelfvilsfartrxmonu4aeeomoctad s uaump t4 reriocoytlmteaivsls0 exr(rpio1lp e icslt a2urum ou0aeeomfcild s2em(ms;()tetnmr tatlmtrliei;t) rtm(m ny4olt mivsl(  Dumum ;t4ope  i3iyt m rmu s;(0texrxo3iotla r ivi;t s2umxo3ny1al e iesl(fsDrmu  oo0ape if3ils m2eau s;t4tleriocoatla rai ols teurxm oo1lpeelnvia() rtm( ono4alenmfetydfsDuauvo;t4aeenmo3to1fmDeanvils  rtrio3oodam nmnesls a2tmum no1oee moeildls elu o;t0trtnio3ia1omDeauvo;s)s2toxr3io1am nmfeia()srrmxmooo1olxoiicilt m2emuvsnt0tlenifcoodopDrlnvols s2xoio iudlptnlfes s) rrrx o;t4alx mo3ilsfa2umnmo () etomf oa1la r uvs;s0sexmirpnu1opeemfesa(  Dtaur ;u1tlxoifeiltfm ranvp;t)trxoio ia1oatraueo () exoim3ny4ap e fctl() ruaurp;t0altnii3iadla rmu s t) exnxfcoadopD ai il()trxmxr3io4oltn ivtl( s2tmum ot0apxnmiciydlm umnvo (0 ltoifcoytfaDrlueo;t0 ruoirpou1om nmnei tfsDuru ono4aeeo ocias s ulnms u4aexoif3ia1fp  lies ()seuoxopoydll e ncsat aDtrurooo4tpeoifetltfa2el(mo (4 rxnif iodfmDrlneo s teur(rpiudam e fetat arua(r ;o0opxnif3iatlsDulums;()trermrcoodlmt  uvo;s0trum(m no1am emnct (fa2trumpou0oetn fcild m2rm(vsnt)tetrmf oatlatrln ol( teurirpoy1oltnlnvtltfsDra(  oo1aptoif3tlsfm uaums;(0altnmf iodfate ivi;s0 rtrxopiudlpe lnvta()srtmum ou0tlt  feiys s emu o (0aetrif3oo1op rlnei;t0sexr(mpny4al n neia(f ruax onu0oeeoiietyd sDumnvp (0arxrifcoatfpDeluvs;() etrio3no4lmtemfeta(fsrumx oot0optoif3iyd aDua( p t)tltrmrcootfpteln olt texo(opiodolt lfei s s2tmur ot0oeen ieiltlmDeanvsn(4 etnif oo1oaDe nvo t0t2uoxr3nodomte net (f 2ua(m ;o1oeeo o3iltfm ranvs;u0alxnxf3oadfptrlu s;(  exrim nu4ap emnvs s  2um(rpnu1oleomo3iadlmDemnvsn()teerxr iotlm  ai o (  exo(m oodal emnes tfs2rmx oou4aex mo3tytlaDem(mo u4trtomo3oydfmt  i i;t texr(r3iodoltelieias) 2um(mpno0apx iieiadfs2ulu pn()aetrir ootlpDraiesls)teur(o3ou4optelfvtl(faDtau poo0teeomi3tysls rluvo;() rtrxf ty1fmD  ueo ( s2tmxr iu4ap  lnci t) Dur(rpnu4olxn oetydls rl(vp;t0aetrmo iytomD aies s)srtmxr oydameelnci ( srum(ro;u0tptniociydfm2eanvp;t4arenif ia1omDe nvo;() 2trxo iydlme  fcsl( sDuax p;o1oexnioeiasls rln s (0 lerxo tydla e i i ( teuo(r oy4lmenmivsa() rra( poo4alt  o3iyd m2umuvo u4trtrmr tatfp e nes t) ruo(r iy4lmtemfvt s) Drr(rp;u4oetnmocilsfs2um(ms u) etrmo oodop elnei;s)trxrir nu4lptnmnvs sfarumx  ;u1tpto fctysfmDeluvont4tetoxr oydopt lueils) 2toir nydap  lnei s) rtrx p;t4tle ifetld m rl(mont0 exrio3tatomDeaivils0s2trim ny1llee fvsa(f rurxm nt4tpt mociys s uaums (4 lxriociy1om r ivo (0 eurir iudope mfciasfa2rmx  ;t0altnmieiad s rm(vo;u) ltomfcoodom  auvsls0 eumxr nu4ape lnvi t srrmur nt1tptnmi3ilsfa2el(mon(4texnxf oydlpt  uei;(  2to(r iu1ape mivtl( sDtrxmpot0apto ictaslm rmnmp (0 rtrxocoydomtraiei;s setmxrpno1omenlfei (  rurur nt1tex  i3tytfs eaumo (4trenif3tadfpDelieo t0t2trir oy1op nlivtls  2tau ono4oeeoif3iydfa rmumo;u4trenmocty1lmDraneo;(0t2tm(opnudaptn fvsat) rtm(  oo1tltomi3iytla2uln o t0artnmrciadlat  i ilt  2tmxr oydapt lneslsf 2ur(rooo0tet ii3tldfs em(vonu0 eenio oa1opD au ils teuoimpoy1lm  lietl()sDrmxm nu4aexn fetat sDra(vpn(0tlerioctytopDranei;s0sexr(o nu1olt  icta(  Dtrxr ;u1oeen i3iasfa rau p t0 rerxo to1lat li ilt0 exmio3ny1lmenlnvsl() 2ua(mpou1aex ioctyslaDua(vp;()texoxf3iotlp  aieolt s2trimpny4ope  nciat  rrm(mpnt4oexnio3ildfs2elumonu0alenifcio1fm   nvo;t)s2umimpnudlp  mfeilt sDtmu  ;o0tlt ioeiydfm2ua(mpn()arxomocoytfp r ieo ()tetm(o oy4ap nlfet t)aDtrx p;o1opeomf3iasla2um(vs t)aetoio3io1oatelivs (0t2xrxr3oy4lpe  ivi ()a2umum ou4tpenioctyt a2um(mpn()teeomf3iodoat aivs ()t2trim ny4alen fct s) rraur ;u4opx  fciyt s rmnvsnu0 exoxf oa1la r uvi;( s2urxopou1ol  liet sfs2uauroot4aexoifcildfa2ean pnt) leoircto1fateau i;t srxr(opio4op elnvtlsfsrrr(rpou4tlxn fetys mDeluvo;t)tlenxfcoydoa ean o;t) 2xoxopio4lpteliei s  Duaxrpno1aptomi3tltlsDul(vont4aeerir iodfaDean il()srxrirpny4am  lfeta(fa2umxmp;o0tltn i3tyd aDea(mo t0trxrxf oo1lpte nvs (  etr(mpiodale  fes () 2taxrpnu1apenmoeiaslaDemums t)aetoircoatlp e ies;t0 exmim iy1ope  fvia() Dtmu ont1opto fciad aDrlnmsnu4 ltrir ty1fm raivsl() rto(m oydomeemiei sfsrrmxm ou0aexn f3iadfa uln o;(4artrxo3totlpD  uvo;( trxo(o3ou1amtn icil()artmxmpot1tlxn f3ild a ranmp u)aleoir ia1lmDr ieo (0texm(o3ou1ap nmfeilt)srtrxmoou1teeoio3iad a2elu s;u4 exoiocto1omDraivi (  2xo(rpoodlltnlnctls) 2umx  ;t4oeeoio3ildlm2uln p (4 eeoio3iydfa elnvols) etmir iydome mici t arrmumonu4texnio3tysla2ul( p ()trtoxf iotlmDrluvo ( srxrxr3iydlmtnlfci () 2tmum ou0opxo fciyslmDua(vpnu4 eerif oytfp ranei;s)setrir3io4om n nci (fsDra(monu1aeeo ictls m eln pn()teeriocoytoptrluesls0trurxrpnydolen nes s sDrm(  ;u0apeniieiaslm2rlumo;u)tetomociatoaD lnvo;(0texo(r oo4ape mnvs () 2urx poo0alt mfetyd s emump;u)tlxrxfctytlmDeauvi s0seurirpoodamtnlfvia(farrmur no4apx  octatfaDumn p;u4alxomrctydfm ean i t)srxmxr iy4ap  mnet ()sDrax oot4alenmo3iyt s ulu p;t0 eeomoctodfatr uesls)srtrimpoydlmt  fvias a2ra(m nt1tlxnif3iysfs2rl(monu4treoircoodfmD aneolt)s2umimpiodlpe  nesl( s2ur( pot0altnifciydfs2umnvo t0 rtoxo iatopteaiesls0s2tr(m3no1lme mici sfarurum nt4oeeomociatfsDemnmp;t)trxrifcootoptelueo;t t2umir ny1aleelici tfsrurxrp;t0texn f3tyt aDra(mpnt0trxoir oydoaDeaivi s0srtoim3ou1alt  feilt srraxroot0optnmfcilt m2rl( o;t4aetomfciytlateauvi;( t2xmim3nudap  lfetat) Dta(mooo1oetn octat mDrlu on(0alxrifcoatlpt lies;t0 2to(opny4lle  nct t)srtmxm ;u4aeto fctytfm2eauvp;t)tlxnxr3oytop  luvols s2uriopoo4ol e ics ()s2um(root0oeeomictlt s rlnvp u)trxomfcootomD lu ils)t2uoir3nodopeemfct ( s2rru oou4ope ioeiydfa2umn s t)teeoxocoodopDeanvils  rxm(rpiu4op  mivia(f Dtau pnu1tpxn ietat s2ra(mon(0texomrcoatoptr nvi;t0 rtmir iy1am nlfvsat)srurumpoo1tlx mocild aDua( o;u4trtrmf oydfa eluvolt)trxmxm iy4lme mici ( aDrmxronu4apt mo3tysfa2ra( o;()arxoxfcootlmt aieolt)texrxopio1lle  nvsas s2ra(mpnu4openioeiadla2rm(vp;u0artnmfcoodfmte ues;( sexoiopou1lme lfcsl(fa2urx pnt0aexoifetaslm2eau p;u) etrxo tydoa eliei;s sexm(o3oy4ape  fvil(fsrra(monu4oee mo3iytlsDelu s;()trenxr oa1lm r uvs;t0t2xoxr3no1om emivils)sDururooo0tpen ictlsls2eanmsnu4 etnmfcoatlp   uvi s0srxriopiy1lltnliesl()a2rmxrpou0oleo feiatfa2rlnmpnt4 rtrmr3iodfpD auvsl() eurxr3iy4llenmfvi tfs2uaxmont4tleniicilsla rlnms t0 ltoiociatlpD au ils)setoxr nudol nlieia( srum(ro;t0olt moetldlaDuauvsnt0 eerir3iydfp  auvs;s) exm(o3ou4al  mnvslt)a2raxronu1optnmoeiydfmDulnmp t4 etomociytfpDr uvo;t t2um(o3iu1lp emnvsl() 2uaxrpou4teeniiciytfmDumuvo t4teenmr tytfat auvo s truriopnydlm  lfcta() rtrx ono0tpt  ictadfs rl(vs u4treoxf ta1lpD  iei;s trumirpnydlm   fvtlt)srumx  ;u4opt io3tas sDel(vsn() etrxocto1omtraneil(0teum(o oydlmtelnesat  Drr(rpnt1apeomf3ilsla rmumo;t0 eenxf3iy1lptrliei;t)tetrxmpny1amt livia(f 2uax pou0texoioctatlmDelu o u0artoio3tatlaDelivs s  rxoxr3oy1am   fetasfartm(rpou0teeoiicias mDul(vs t4altnir iotfm   n o s0trxoio3iodam  mieil()a2tmumpou0alxomoeiasls2eanvp ()alxnircoytfp r ieolt) 2xr(r3oudal   icsat) 2ur(moou4apxn f3ias aDrlnmont4tltrio tytlm ranvi (0 etr(m3nu1aptn netl( sDra(m ot0optn fciad s um( o u) ltomf tadlat livils0trurirpou1ape mivi t)sDtm( pot1oetn oetysfaDem(vo;t)tetnir iotop  ai s;(0tetrxm3iy4lleemivias s2tm(mooo0olxoiiciadls2emump;u4 lxomo3oy1opte uvi s  2tm(o3oodamtn neils a2uru p;t0tpxoii3ilt sDem(mp;(0tlxomr3ootfm eluvi;s) 2xoio iudlle lnct (fa2rau p;o0opt  o3tad aDuanmon(0 exnmrcia1op   ivo s) rxo(m nu1ope lnci (  Dumx p;o0alenmietltlaDeaumpnt4aexoif3oadlmDrliesls0texmxr3io1lmtelfcslt) Dtru  ;t0tptoifctytla ul(vs ()artrmfciy1lateaies t sruo(r3nu1amen ivi ()s2rr(rpnt0apenifcils sDemu p () exrif3totoatr n i;t sexrxmpiodopte icsat aDtmxmoot4teenii3iatfaDemnvsn()altnio totfaDr ivols0teuo(m3iodamenmnes (faDur(r ;o4olen iciad m2eau s;(4trtnmrctytopDeaieo;s0 exoxr oo1aleemfcil()s2rmum ;t1tlxoifeiatls2eanmo (0trxomocoytlpDeau slt0s2urimpio1om e fei s) rrrur nu0opt  fetldfaDua(vpnt)alerxo3tydlptran o t)s2urxm iydll nmfvia(  Draxmonu4texn i3iys mDumu snt0texoxf ta1opD auvi ( sexm(m iu4am n nvsls sDra( oou1aetn ictadfs2eluvp;t)trxoiocia1lm eliei;t)trxr(o3io1lp elnetls srra(rpou1apxnmf3iysfaDuaumsn(4 etrxr3oo1fp  ai s s tetr(mpiy4aleelfvi t arur( o;u0tpenifetatfs2uaumpnu4 renxrcoydoptrli slt t2urxm iu4lm  mnvtlt  rtaumo;u1alxoifetat a2rm(ms;t)arxoxf iytfmDe i i () 2to(opny4ll   icsl()aruru pno4aet  oeiys aDean o t0artrmr oo1faDe nes t tetrxo oo4ol   ieil(f 2trumono1tpeo f3iltla ulnvsnu4aexoio ia1oaDrlueo;t trtoxr nudomenmnvtl(f 2ra( o;t1oetn oetaslaDrmums t)texnio3iatfm r ivi s)s2xrim3oodom nmfvt tf 2rmx poo4oleoio3iltfa2rlums (0 rxomocta1la raivs;s0 eto(m nu1opteliciatfaDrrum ou4tptomi3tldfa2rlnmonu4 rxoxocto1fm elueolt) rxr(m nodamtnmici (fsDtmx poo4tpenmoeilt s2em(mo t)teeoxr3iydop eli i;(0t2xrxo oudole mivsat sDua( poo1aee ii3iltfs rlumont4 reomociytopD  i il(0 rxrio3ou1om nlfvtas)s2ra(ront4aee iocilt s2umuvp t4 ltrif oydfatrlu sls)t2urxr ou1om emies t  Dur(ro;t0aexnmfctasfa2eaump;u4 ltoifciotlp rau i t0srtoim iu4am  lfesl()artmxrooo0apx ioeiytls2ra(mp t0 exnxr3iydfaDelneo t srtrxo3iy1llenliei s)artmxrpnt4aetn f3iyt a rl( p;t0 reoio3tadoatr u o t0t2trxo3oo4al  lfvtasfs2rmxmpnu0tpt mi3iyt sDrln o (0treoir3iadomDranvs t0teur(o io1apen nes ()aDur( pnu1apenifetas sDrlump;(4teerxocta1fpDeaieslt)seto(opny1lm  lfcsa() rumur nt1altnmo3iadfs uluvo;t4aexoxrcia1omteai ils0 rxoxm3oo1omen fesas)aDumurpou4apx mo3iasfs2ua( snu4artomrctadomDr nvol(  exrxm3iydaltnmies s)arrm(mp;u4tee iieiad s elnvp;(4arxoxo iadla e u ol()s2xmxo3oodlp   ivslt aDuau pnu1alt mictatlm umn pn()tetoxo oydopt  ivo ( teuoir iudlpe  fvs sfs2ua(m ot0opxnmociyslm eanmpnt0tetoir ootoatraneo;s0 ruoim3nodom e fvi s) Dta(mpnu0tpxomfeiytla ulnvp u)alxrxo ia1oaDr nvo;s t2xr(rpio1lpen fcsl(f rrm(mono0oex if3taslm2rauvp;t0aetomf3iytlaDeluvo;s0srto(rpiy1lltnmnctlsfsrrmu pnt1tlx mi3iydfsDrln o t4teerxo oo1la eli o;t0s2umxr no1amee fvilt a2rm(mo;t0alt ifeildla ulump u)tetnif3todfpDeliei;s)t2trxm iy4lptnlnciltf rrmumpnu1tlx if3tldlmDrmu p u)tlxrir iytfm rai s;( t2toxmpoy4llenmnei s srrr(m ou4tltnmietlt a rlu s;u) rtomfcoadfa e ueolt setm(r ou1lptnmfciltfaDua(mooo4aee ii3iysfs uan o;u4altrio3iydoptran s;s texo(r ny4om nmiesasfaDrmxrp;o1aee ifetat s2uanmp t4 rtrio3oa1om rauvo (0 rurim3oudalee nvtls aDum(  ;t1teto iciadlsDem(vont4tetrir3iatfmteliei (0trumir3iu1lle  fvil( artmxrp;u0oetn feiad a2rlumo;u0teenmo oo1laDraueo (  2um(opio1am   fcsltfarrruront1aetomf3ild a elu o;(4trtnif3iytfa e ivi;()t2to(o iudal emiei t)artm(m ;u4tlx iieiydfa2ranms;u0 rxnmr3iadlpt luvils0t2to(m3nydome  ieta() rrmxm ;u1tleomfeiytls ulnvo u) etrxf3totfmt ai o;(  rur(mpou1oltemfei s arrm(rono1oexo o3tasfsDra( s;u4arenxrciydlptelu ilt)seumimpiodam elfetas)aDrm(ro;u1tpxo icildlm eauvsnu0teerxocto1om elnvi;t)t2tmxr3iy1amte ict s artaum oo4tptoiocils aDemnvp t0 exoif3oy1latrlieslt0s2um(mpiudlmenmicil( a2ur( o;o0aet ifeildfa2rm( on(0trtnxr3iytopt  i s t)teurxo ny4ll nlicsat aDumxrpnu0aleomieild mDrm(vsnu)aeeoir iadoaDran i;t s2ur(opnydomtelnetl()aDrr(  ;o1aptn i3tlsfmDulumo;(4trxoxrciy1fmDelieils)sruoxm3nu4lp nmnesatfsDtru  ou4oleomo3iytls eanvp;t0aeermfctodfa eli o t0t2tm(r3oy4lltemnct sfsDtrxmp;u0tleomi3iytlmDeln pnu) rtrxf ia1fateluesl( s2uo(o ou4lme lfctatfa2trx o;u0apeoioctyd s ranmo;u0tltnifciadoaDeluvi (0t2urxm io4omenmivi t)s2tm(ro;u0aexn iciytfaDulnvs t4texnmociadopt an o;t0trxoio3iu4ll emnvil() Drrum nu4tlx mf3tysla eauvp u4aetrxfciy1lmtrlivils0setoir3nu1ol n nci s) Drrx  ;o0alt  oeilt m rmumo;t0alxomr3iy1lat anvs t)srurxr3oudaltemncils sDrmum nt4oeeoiiciadlmDuau o u)trxnxo3ia1fat luvo;t0 exmim ou4lm  lnciat aDua(mono4olxo ictaslaDelums u4 renifcoo1oate nvo;(0 2uoxmpiy1lm nmnvi (fs2rau pou0apeoiiciad s2umn o;(0alermrciadoat liei;s)srtoxmpiodapt mieiatfarur( pnt4alxnmoeildla ra( pnu4 ltoir3iy1oa eauvo t0s2trxm ny1alenlfci () rrrx  ;t1olto i3tydlm2elump;u0 lxrio ta1fm rau s t0trtm(m3nodap   nes sfarrr(ro;o1apeomf3iat a2umn o;(4tlenxocoydlateauei;s)t2xrxm iu1lmtelivsl(  2ta(rpnt0alxnioctysfsDea(msnt0texrmfcio1oaDeluvol(0setriopno1omenmiesls a2urumonu0tltn fctyd s2ea(mo (0altrxfcty1opt  uvi s0teuoxr iodlme  nvslt)s2um(  no0ole  o3tyd a ulu on(0aetnxo3oadfaD ai o ()trumir3nydale mfcsat s2ur( pot1olxomoetad s rmuvs u0 lenio3ta1omtrauvi s0teum(o3oydlptnlfcsl(fa2raurp;t1tetn i3iatfa ea(vsn() rxrir3ta1faDelnvo;t)tetr(r iydlmenlfctls arrrumonu0tpt iieiadfa2uauvo;u0teerio3oy1fa elueilt  2trxopiudomenmiet t)s2tmu  nu4tpe mf3iad m2elu o;() ltoif3oo1faDranes t)t2uo(opiy1lpee fvt t)sDur( p;o1altomfeiltla rlnmpn(4 exrxocootfaDe ivs t0teumir3iy1ll nmfcsls  2ur(r nu4tle mi3iytlsDra(msnu4teerircoodlaDeanes;s0trxoxr ou4ll nlfesl() Drau  ;o1tpeoioctytfm2em( on()trenxf ia1lp eliei (0truriopio4ll elnvsatfs2rr(mont4alxoiicilsfa2uaumont) exrxo iadoat  ieils)seur(mpiu4ol nlfvs (  2urx  ;o4tpeo oetydlsDrau o (4aleomf todomDean o s0trtmxrpnu4ap e fvilt aDrax p;o4tpeoiictadlmDeanms u4alermo todfa   i ils  exmimpoy4al  mnvtl() 2raumpnt4ale  fetldfsDea(ms u0 reoir3oadfa elu i;s0t2uo(r ou4om elivt t s2tmum ou4tpxn feiatfm2rmn pnt0teermrciydoa ran s (0trxoir3iodlmtnmfcia( sDur( ont0aptn feiyd a2um( s;()artnmr3tytlpD  ivi s)texoimpiydol  mfeias arur(r ;o0tle if3tlsfs ea(mp;()tlxnio iotfa  lnesl() exoxm oo1lm e iviat  Drmxmp;u4altnmociad mDuan s u4altrif iydfaDr i o t) 2xoxm3ny1ol n fvia() 2rau p;u0olto ieiytlsDrm( pnu4tlenxo3oydlaDe ivs;(0 exmxr io1lp   fci ()sDraum ot1tetnmi3tadla2umn p;t) rtomf3io1fpD ln o s0 rxoio ny4optemncs sfa2ur( onu1tltomiciydfa2rlnvo (0texoxr3oydop  li i;t) eurio iodaptelnetlt)aDrr(ro;u0opeo ictydlsDem( s (4teenmr3oo1fa rln ilt0t2xo(o nu4lmt mfvil( s2ta( ono1opx mi3tydfm2ua(monu)arenmf todfpD  n ols srumimpiy4ol   nvslt)sDumxrpot1olxnif3iadfs2emnmpn(0 lxrxr iy1lm  lueo t t2toxopno1lmtnlfvsltfs2rru oot1tetnmieiyt a2uan on(0altnmrcootoa  lu s t texoxrpny4lm n ivi t) rtrxrpot4tetoii3ildlmDelump;u) lxnifctodopDelnes (  rumxr3iydapee fcsas) Duaxro;o4ole  fctadlaDran s;(4trxnir todlat luei (0seur(m3oo4alen ietlsf 2ur( oot1tet mi3tytfm elnvont4 exomr3oadopt ai sl() rurim3iodapen fesasf rtruroot4tpxn oetyd mDrm(ms (4tlxrmf tadlp ean o t)s2um(rpoo1ape  ict ( a2urxr ;t4aleoiocildfs2rlumo;t0alerif3ty1oatran s t  2ur(o3iu4llt lnvi s)s2trur nu0oltomoetytfs ua( s t)aeenifcoa1fpDrlu o ()s2uo(o nu1omt licsas aDraxrpot0aee  o3iytlsDeluvs;t)tetomr oo1oatranei;( srxmxrpio4am e ict ()sDum(  no4aeeo feils sDranvs t0tlerio3tytlp e n i;s0tetr(opiu1aleemiei s artm(r nu4apx  iciytfmDrl(mpnt0aetrmf tydfm e nvslt0seuo(rpnu1apee fet t  Durx  oo1openioeiytfaDemn p u4altomrcia1omDraiei s) rxrir nodap   nei ( arrmumpou4apeo o3ildfsDrmnvpn(4 exnxfciatla elieil(0setrio3no4altemicsa( aDtaur oo1oeto o3ildlm2umuvo () rxnmf3ta1lm r i il(0 etr(opoudameelnvsatfa2tm(r ot1optn ietyt mDemnvonu0altrioctydopteau o;s0 eur(m oodomee fcsasfaDrmxmpou0alx mi3iatlsDulump ()tltrif oy1om   ivi ()t2xr(rpnu1lmt  fvsa()aDra(r ou4aeenifetat s2eaumpnt)aetrmf tadfat au s (  2ur(r3ny4lp n fet sf 2umxrp;o0olxniiciyt m ulnmpnt4 lenmf to1fpD an s (0tetmxm3oy1om n fctatf Dtr( p;o1alxoif3ils s rlnmpn()tlxrmrcoadomD livi;()t2xmim3oodllt lieias)sDtrx  nu1opx  oetydfsDrmn o u)teenir oy1fp e i ilt)trxm(m3iy1amtnmnet () 2raumpno0aeen feiadlsDrmnvp u4tlxrmocoy1fa raieslt) 2tr(opnudal elnct t aDtmx pnt1teen i3iyd a2eau p;(0tlxoir3ta1omt  u o s sruriopoy4amtemicia() rrrum nt4ale  oeiysfsDum(vsnt)areriociotfa ean i;( s2uoxr3oy1ol n nvslsfa2rmxm ot4texomoeiatlm2rl(von(0 exomf totomDr nvo;s  rtrxopnu1op e feiatfsDtmx p;t4altoifetlsfmDul( pnt4artnmo3oydfp  aneo;(0 2xoim3iy4lmtnlncs t  rraumono4aet moetasfs em(mp;t)trermr todlm e ueil(0sexrio no4llt mfesasfarum( oot0aetnmo3tad a2ul(msnu0altomr tydomt lies;s)setmimpiydlltelicsat)srrmu poo0tpx  f3ildfs2eluvp t4 rtrmo tatfm rlnvs t)teumio iydomtnlnci sfa2ur(mp;o0tpx mo3iasfm2eanvo;t)aetnmfctodla  auvs ( seur(mpio4olenliesa(  Dtrx  ;u1tetnifeiadls2ra( on()arxrmo3oo1optr u o ()texmir oo1llen nesa( arum(m ;t4tltniietatfs ul(vp (4texnmo3oy1opDrlueo s0 euo(o iy1lpenmietltfaDtaxronu0altoifetas m2umuvp;(4trtoxf todopDrlneilt0t2um(opno1op  mnvilt srum(  ;o0apx  icildfa2ranvs;(4artrmocoa1lpDeanvs t trumio no4ame lncias)s2ra( o;o1tle iietad m2em(mp t4alenxr3oa1fpDe ues t) exrimpoodamenlncsas)srrmu pot0tpe mociltfsDeau s;t)texrxo tytfatraivils)t2uo(rpiydoltnmnvt s s2rm(roou4openiicilsfs rmnvp (0 rtomr3iatoptr ueolt t2urimpoo1amt lieslt  2ta(rpno4teen oeiltfa emu s t0aleoxo todlmDe u o s0 2xmxm3ny4al  mfvia(fa2ta(m ou4alx ifciltlm2el(mpnt0aeeoxo oo1fmDe n o;s)s2toir nu1ol  mietltfsDta( p;o0olto fetat m emnvp ()tleomr3iydfmte nvi;t trxoimpiodlmtemivsltf 2urumo;t4aleomoeild mDua( o;t)alerxo3oytla e nvi;s0t2toir oo1omt mfvi (f rur(rpno4olx io3iltls rauvpnt4altomf3iodomteai i s)s2xmxr3oo4lptnlncslt aDtr( ooo0alto ieiys mDrmu s (4aeeoir3ty1fmt  n o;s0trtoio3no1omt livias srtrxmono4oeeomieiltlm rln snt4tleoxo3tadlaDelnvsl() etoxm3oodlpe mivsas sDuau  ;u1altomi3iysfaDeau snt)areoir3ta1om  lnvs t)s2urim iodaltn fvsa(fs2rm(m ;t0apeomoeiysla elu p t0alxnxr3oatfmD aieo;t tetmio nu1oleelieilsf 2um(rp;u1optn ieiaslsDua(vp;u0texnmf3oydoatr nvi;(0 etr(m oo1alee fvil(farrau pno0tlxomoeiadfsDel( pnu)tlxomo oadfmte n o t  etriopiy1ale lneiltfsrrmuro;o4oee mfeiatla eau o;u4 lenif iodfmDraiei s0srtriopiy4ole livi t) ruau  nt4alxo fciydfsDrl(msnu4tlxniocoatfp  lnvilt)t2umxm iy4llenlietas srumxmono0oexnmf3ilsfa ulumpnt4 leriociytop  lueil( srtmiopoy1olte ietls  Dtrxrp;u4olt mieiad sDrmnvs;t4trerio tydfm e ueilt  euo(opoy1omenlnet sfa2tm( oou1apen feiys m ra( sn(0tleoircio1faDeanes () rxmxr3iu4ll e nvi t)aDuaur ot1ope if3tasla rmn o;u4altrir3totlpDr nei s  2tm(m no4lm   fcia() Dtax pot0apx mf3iys s rau pn(0 ltrmo3iy1lpteau sls  exmim3no4am  mfvias s2umu o;o0olxomo3iatfa2ulums t0aeenxo oadoat  neo t trxmxm3oo4lmt lnvsltfa2um( o;u4tpeo fctatfm rluvon()artoxf3oadlmD luvi t0 rurxrpnu1alenlfvsl(fs2raxmpnu1apenii3tyt sDrlu p t0 rtrir oydfpDrlnvolt)t2umim iudap e nesa(faruaum ;o0texoiieiytfs2rmu p u4aleomrctadfptr ieols  ruo(mpoy1ol emncslt)aDtauront1tpx ioeias mDumumonu4arenif iytla   u s t setrxm3iu1lmen ivi s)sDtmur oo0opx mfctltfaDranms u0 rxoir tydopt au i s0 etmxm nodamenmnetls) 2ururonu0aptniieilsfaDelumont4tlxrmo3ootlmteauvi s t2xr(m iu4lm nliet s aDtmu p;t0apto oeiytla2ul( p;()aetnxo iotla rau o t teumxopoodolenlnciatfsrrm(  nu0ope mieiydlaDra( s u) leomf3io1lpDeaivo s0t2uoimpou1amtnlivil() Dur( o;t1oetn ieildlsDul(vpnt) reoir totopD livolt)tetrxm3oo4al emfvi (fs2uru onu1ole mieiydlm eanmsnt0arxomo3totoaD  ivslt0 eur(m iodllt mics t)s2uru poo0tpto iciasfm em(mo u0arxrmf oadom  lueo t)trxoxrpoodol  lfci t)a2rau pot0oex ifeiysfm2elnmo;u0trtnir to1omteai olt)t2tmio3nudap  lics (faDum(m ;t0optoioeilsfs emums () rxrmr tytom eln i s)teuo(opnu1llte ivsls artru  ot0aee  oetydlm2eauvs;() lxoio3totlmt  ivs ()srxoxmpoydlpe mfei ()srtaxr ;u1aeenmfetadla2umnvpnt4texoxfciydopDeliei;(0teumxr3iy4lmeemnciltfaDua(m ou4opxn i3ias a2rlnmp ()texnifciodomtrln ol(  2umxmpoy1apt mivs tfsrrrxro;t0olto fetyt m eau p t4 exnmr iy1fat  n o;()srumiopny4lp   ivi ( srumxmpoo0alx mf3iyd m elumpnu) exoxrciotoaDrau o;(0 rto(o3oodlme mneils)sDum(r ;o1alxn icilslm2umu s u0 lxrif tatlpDr neil()tetmir oo4ll nlivt ( a2rmx o;u0alxoio3tldfsDumn pnu4 lenirciodlpDr i s;s)s2toio3nu4lp  mfei () 2ua(rp;t1olen iciasls2el(mpnt4teenxo iytomtrau s;s srxoir3iu4aptn ivt t  2um(mp;o4openioetyt m2umu pnu0aleoio3oodfpDrluvs (0seurxopnodamtelfvsls)s2ta(m ;u4oleniiciytfaDrmnvp;(4 eerxf3iodlm eau sl()s2xmir nydoltnmivtat)aDrmxmp;u1olxn fetatfa2elumont4tltnmocty1lp   iei;t)setr(r3iydap  lfvi (f 2tmxm no0aexo fciadla2ea(mpnt0tltnxrcoa1la rlneo;t)teuo(m3ou4ame mnei (  rur(  ;t0aleoifcilt aDra( o;t0 rxnmf3iytlmtr uvo (0 2xmxo3oudole  ietls arurumoou4tlto ocilt s2um( s u4altrmrcoydfp rau s s0 2toxo iu1altemfvtat) 2uau  nt1oetomi3iadfaDuauvpnt4tlenxo oa1lmte iei (0s2tr(o3nydapeelfes sfaDrr( oou0aleo f3iyd mDuanmont0 rtrirctydlaDe u s;s trurim nydol  mivi tfsrtm(mooo1opeomiciydlaDrlnmo u)arxnxf iytoatraueils0 ruo(m io1lptnmnctl(fa2rmu o;o4apeoioctadls2ulnmpnt0 ltomo oytfmDean s;t0t2xmxrpny1ll e iet sf 2tax pou0tlt ifeiltfmDeln ont)tlenxo iotopt  ies s0seuo(r oo4ll e fvtat artr(rp;u4olto ietldlaDrmn o;()tlxrmo oytlm rai s s0seuo(m3oodal   iet ( arum(ro;u1ape  oetatfmDuaump;(4tlxrxf ootfm rau o t) rurirpno1olt lfvt s)arum(r oo4openio3iydlaDumn snt)tlxnmf3todopDeanei;s0s2uoxo ou4ope  icias) Dua(  ;t0tpxnmicildfs2eanmo;()areoxf3oa1la rlu s t)setr(mpnu1ol nmieia(faDumx onu1opxn ieils m rmu p;t4altnxr ootopD luvo;t)teuoimpoo4aptemietlsfsrumx  ot4olx mfciysfm uan s;u0alerio oo1omDelivi t)t2umim3io4olee fcia()artrum nu0aexnifciys a elnvs;t)tlxnxoctydfa r uei t seto(o3iudape mies ( srrau  ;t1tpxoiiciysla rmnmp;(4alxrmo3oo1op r ueo s teuoir3oodapeemnetls) Dum(rpoo1oeen ieiatlm2emnms (4 rxrmr3tydomDeaies;t) exmxr io1omenmfciasfa2umxm no1tpe  fetytlmDuauvs;(0aeerxo3oy1lptrauvsl()t2umiopiu1ol   icil(farrmum ou1ale  i3tlslm rlump u)arenio3iy1lpt aues;t)setr(o3iy4om n nei () Drmx  ;t1altnifctlsla uaump;(4arxrmr iadoatrauvo t trxrim oudamte fetlt)s2um(  ;u4oexoiiciytlm eaump t) rxrioctotfaD lues (0tetm(o3oy4lp nmfesas  Drru o;o0aex  i3iaslm umn s u)altnmf3iotomD  i i;()trtrxopnu4al   fctas)aDrru  ;u1teeoifcilt a2em( s;t4 lerir oydoptrln s t)texm(mpno1lpte ictat srrm(  ;u1apxomoetydlm emuvo () lxoxo3tadfpDe ueils  2xrxo nodopt lfvt (f rraum ou4oex mf3tytls emnms;t0texrioctotomDr ivo s0 etm(m ou1lptnlnvia(fs2trumooo1tleo fciat a elnmonu4aexomr iadlpteaieo;(0texrim3iydomt mnetl()aDra(rpoo1tpt mfcils m eluvp;() renmr3ia1omt  n i s)s2umirpoudalt lfcsas s2tr(  ot0tpe mf3iysls2ua( pn() exnxocio1omt aneo (0seur(rpno4ll nlnci t a2rrurpoo4apt  feiyslm2uanvp t)arxrmr3totoatr neol() etm(m3ou1lmenlfvt t  Drr(rooo4oex iieiltlaDemn o t4artnmr iytopD  nvs;s) eum(mpno4optnlics s)sDrrxrp;u4ope ii3iatfa el(ms t0aleoxo3io1faDrau ilt tetr(m3iy1ap nlnvsat aDua(ro;u4tetn o3iys aDum(vo t)aetoir3oatoat lnesl(0s2toxo3ny1lpeelics tfarrmxrooo0apx mictlsfaDelnvo t4 exrxo3to1oaD  ueils trxoxopio1lmt lfeiat artmu ooo0oee  fciys m rmnvo;t4aetnxo ta1opt  nesls)tetriopou1openlfei t) 2trumono1tlen o3ils aDemump;u4aexoir3tydlmte i ilt srtm(opnu1lltnmivs t) Dtru  oo4tpxo ietyd s emn o t0tlxnifcoadfaDrlu ils) rtoirpny1optelfctlt aDtax pnt1openmf3iltlm2ranmpnu)tlxoir ta1fa  luvils0srurio3nu1lpen icsat  2tm( poo1apenmfciyd sDeanvsnt4 lxomrcoadlp r i i;( s2uoirpno4lpenlfcils)artrum ou4oeen ieiadfa em( o u4tltomf iy1oa  livs;()sruo(r iu1alte ictl(fs2urxrp;t1alxnio3iadfa2elnmont0texnxocoatomtranvs s trurir oodlp e nesls)s2uau p;t4tleniieiatfsDrmnvont) lxriociodfatrlueo t t2xrir3nu4lp  lfciatfa2ra(mo;t1tex  ocildfs2ua(mpnu) eenmo3iytfp  lneo;s0 2toir3nydlpt  fcsl() Drrumpnu0ale mfciadfs2ua(mp;(4treoif ia1fmDr uvs s)texr(opnydapte feia(  ruau p;t0ole  fcildfs2emuvs (4 ltnircoy1fa   u o;t s2xrir nydll emicsltfs2trx ont1ole ifeild a2um(vonu4 eenmrctatoa   i slt0t2uoxm io4ap emieiat s2uau  nt1openii3tld a ua( o;()alermr3ta1lmt anei;s tetmxrpiudom n fesa()srrru  ;t1openiieias sDrl(ms;u0 ltoir3tydlpD  ieols) 2ur(o oodlmt lncs tf rtau  ot1ole iicilt m2um( pnt)trxoxr ia1fpDe i i ( trurio oydomen nctlt  Dumxro;o4oee mociasfs el(mo;u0tlermr3todomte n i t0 exo(o no1amenlneiat) rurum nt0apx mi3tadls ranvp;(4 reomocta1lpD lnvols) etoio nydlpeelfct ()sDuaump;t4tptoiieiydfs rauvsn(4arxrmrciydoatrau s;s) rxr(m nu4al  lnetat  2ra(rpnu1tpxnifeiys a ulu o;t)arenif3ta1lpD  nei ()s2umirpio4om nlneta(  rtm(rpnu4texn f3ias a eau s;(4trtomfctatfptrlueo s teto(mpnudlm n fcs sfa2ur( onu0opeomfeiyslaDrm(vo;t) rxomfciatlmt auvi t)sexoio3nu1omtnlnetas)a2rmum nt0tpxoifciydlm ranmp t0 eenxf oatlmtraueo t  rumxmpiodll  lict s s2tax p;o0oetn ieiysfaDuluvp (4alxrxf3iodfa eai sl(  2tmxo nudlmte ivta(fa2tmur no0tlen f3iadlm rlu pnt) lxoxrcoa1om rlu i ( trxrxr oydlleelneta( sDtmur ;o1tlen o3iaslaDuan p t)tetnxf iatopDe ueo;s)setrio3oy4ll nlfcilt) rumxrpoo0tex  o3tltls rauvo (0aeeomf iytlpDrlueilt sexr(rpiudomt lfet t)s2uax oou4olx moeils s2um(vsnt) exrircoadlateaiei () rxr(r iy4aptemnctls)srrr( pno0aetomictltlm eln snu0trxoif3oydfp  aivol(0 rtoxo3no4om emfet tf 2ta( pno4olx ii3iyd a eanmp;t) ltrxr ty1lat  n s s0 exm(m iu4ol nmfcil(  2trurono1aexnmieiat m2umu o (0 rxoirciydom  luvolt  euoio3iy4am nmictatfsruaxrooo4alxoif3iad a rln o;(0areomocoadfatrai sl(  exm(r nu1opt  ivi t aDrmumo;o4tpxn o3ilslaDra(vs (0alermf todlm rauvs;t0texo(opio4lptnlfvt t  Dumur nt1alt  fciydfm2eluvo u0tlxoxf3tadfa eaueo;s0srum(r3iydlm   ici sfs2ur(rp;t4opeoiietasls2emuvpnu4texrioctydlm eai slt0 rxmxopoo4ope  netatfsDuaurpnu1ape  octadfmDel( o (4trxrmocoodomDeaieilt)trxoxmpnydop eliei tfarrm(m ot4aetnmictltfmDel(mp u0 eerxf3iotopDrlnvo;s  etr(r oy4am e fvi t) r
\ No newline at end of file
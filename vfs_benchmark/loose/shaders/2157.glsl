@@ -0,0 +1 @@
+iei ( setoim3io1ap n fet (f rur(mo;u4aee moetydfs2eanmo;u)aeeomf todfm  lnes t  rxrirpou4lp e ietl() Dtmxmpou0apeo ietydlaDelumon(4 exoxr3oodlp rauei;s  exr(r nydolenmnviat aDtr(monu0tlxoifetas s ean o (4teenir iy1lat an olt)s2uo(opiydaltnlfeias)sruru  nu0altn f3tlt a2emn p ()aeermo iadlptrluei;s)t2ur(m iodom   nci (fsDrmxmont4aexomf3iytls2uauvp u)arxrxocia1fpDraues;s)tetrxo ou4ale  nesat)a2trxmo;o0apxo o3tysla2ranvp;(4trxnifciytlp eauvols)trxoiopiy1op nmfvi t)a2ra(  nt4oltoiietysfm eaump t)aetrxo3iadlaDe n o t0sexrxo ou1ome  fvi s aDtaxmp;o1openiiciadlm rmu pnt4aeeoio3tadfpt lu o t0trumxo nudllen nvt s) rum(mpnu1tpxoif3iatfs2uanvp t0altoif oo1fmtr i i s) rxmxmpnudomtn fci tf Dua(r nu1tlt mf3ildfmDua(mp (0 leoxo3oytfaDeai o t) rxoio3oodamen fvslt)s2umxrono0opeomi3ilt sDumuvo;(0aeenxf oa1lat lies;(0 ruoxm3iu1ale lnetl() Dua(m ;o0oltnii3ild sDum( ont0 etrmr tatfmt  ueo t0 rurxr oy1al  lieia(fsrta( ono4opxnifeiytlmDuau s (0 rerio iydfatr i s;t setoxr3oodopenmivsltfaDra(rp;t4aee  oeiyd sDrmu s (4 eeoiociatfate n i s) rxmxrpio4lmenmfct s  Drrxr no0oex ioeiysfsDeanmp (0teeoxf oytlmtrai s;() 2xm(rpno1olt lfvs s a2ra(rpnu1tpxnmociytfaDul(mp t0artrxf3ia1lmtranei;s  2um(m nu4ameemfvilt aDta(  ot1oex mf3iatlmDrm(mpn(4 ltnif3tytlatr i o s t2xo(opio4al emivtl(  2uaur oo1tptoioctydlm rl(msnu)tlxomociydlatrlivs;(0t2uo(rpno1ap e fetas)s2rm(mpot4open octatfm elu snt)arermrcia1oa eliei;() exoio3oy4altnmfcilt) 2tm( o;t0oeenmieiadlaDrm(ms;(0trtomociy1omD  ueilt0s2xrxr3iu4ap  mfvs t  2trxm ;u4tpxomfeiadfs2emnmo t0altnxf tatfp e iesl() exm(o3ou4ole mncil(f rrmxr ot1oltomfeiytfa emn s (0 exrif3io1om  ln s ( trxmiopno1ale lfeilt srtmx o;o0apxomoeiydlaDumnmo t0aexnmo3oytfmt  iei t  2tm(o no4openlfviltfs2ua(  nt4oeenmietlt s ulnmp u) rtoxr iadlp rlivs;s)srur(mpnudale livslt)aDrmx oou1oexnio3iatfaDrmumon(0teerxfciydla elu o ()teurio ou1lm  mnctltfsrrmxr ou0oltomfeiytfmDeanmsn()altomr3totfaDrluvils) 2xoimpoo1al n ncsl(fsDrmu  ou4aeen oetasla eln p u0tetnmoctodlaDeauvo;s  2umxm io1am nmicsat a2uaumont4olen o3tyd s ul(vo;()aetoifciy1fa e u o s0 ruo(o nu4al e ict ()sDuru  no1altniiciytfaDrmnms;t0aeenxf3to1fpDr nes t0t2xrxm oo4lmeeliet ()s2raxront4aptomo3ils s rlumo t4trtnxfcoa1lp   i ol()setmio no4lp nlfeil(  2tm(ro;o0aptnmieiltla uanvp;(4 lxrmr oo1oat  uvsl()seuoxo io4alt mfvt s)s2tmx  ;u0texoif3tld aDelump (4alxnmf3iodlptrln o ()t2uoirpoudame  fesasfsDumumont4aptnmfetldfsDumumont4arxnxrctatla rlivs t  rurim3iydomee ict (fsDra(mpnu1opx mi3iad mDelnvp t0texomociytfmtran o (0srtoimpou1openmfetlt sDurxr nu0tetnifeiad a2uanvo t4teenio3to1omDr nvils0trtoxm nydamt lnviltfs2tmx p;o1apeomiciydfsDuln s;t0tltrxo tydfpD ln ols)tetrxr nu4alt lnci t) 2uaxrp;o4oeeo f3tat m em(ms;u0trtrifcoadfmDe nei () 2uoxopnodlpt mfvs s  rtmxmooo0aeeomf3iltla2uauvs ()tltrio io1lmtraues;s)t2ur(r ny1alenlivt tfs2umu ont0tpt  ociasls ulnvpn()trxoxo ty1oa eln s s0tetrio nydap emnvtl() Dtr(mono0openmi3ildls emn p;u4 lxnxoctadlpt auvi;(  2urimpiy4om   fvias) rtrum no1apt if3iyd sDel( p (4 exnmo3ootlptrai s s0s2xmim3iudlpte nvtatfs2tr(  ;o0tlt mfctasfsDrmn ont)trermfcoadfptr n s;()s2toxm3iudamenmfeta(  rururo;t4tptomoeiytlmDuln o;u0trenmo iotfmD ln o;t)t2xr(opiu4op nmfcs (  2rm(ronu0ole ioeiytls umnmp;u4 ltniociytopDrai ols  2ur(rpny4ame mics t a2rauro;o1tlt ii3iys a2rlump;t0tltoiociodop elu s ( s2umirpiu1lm n fcils)aDumx  oo4aex  fciaslmDeluvo;u4alerxf iadfptrai slt t2uoiopnu4altemfvias)s2rrxr oo1tlt ii3tlsls2uaumsnt) leoxoctatfatrlu i;s)t2umxmpio1altnmfctasfsrtmum oo1aexoifctlt m eauvpn(4tlenmf oa1lpD  uvs s  eum(mpnydlpe  nvs s)a2urx  nu1alxnmoctasfa2ean p u4 exniocoodfmtrlneol( srurim iy1omeemnviat)arrr( oot0tltomietls s2umu ont4aeermrctydlatr i s (  2xoxmpoy4lm nlici t a2tm(r nu4tlx  o3tldla2uauvp t4 renif3tydlpte neilt0setoxr3nu1om   ivs ( sDtmxr ;u4tptnmieiltls2ua(vo;u) lxnif3totlpDrli ol(0srurio oodalte netasf 2umxroou1oeeomoctatlm2uluvo t0arerxrciadomD lieo;(  rxo(o3iu1olt lnvs tfs2tax oot1aet  octytfm ra(vpnt4artoif oydomtr ueolt  etoiopnydlpt liei (f 2tmxmp;u4tet mietytlm el(vo;t4 etnxfctadomteln o t  rumxm nu4oltn fcslt)srumxr ;o1olx  f3iysls2rl(mont4areoxf3ia1fpD auvo s0srxrio3ou4lleelneia()aDum(mooo4ope iictat a elu snt)trxrxr3iodfpDr ieo;(0s2xrxr iu1lptn ncias)a2rmu  ;u0opxnif3iaslm2rlnvo;(0arerif iodfat  nvils sruoxm3iy1omtnmict ()arrm( ooo1apto f3tasfm2rlumonu) lxoxo3todop ranvi s t2tm(rpio1lp emfcsa(f Dur(mo;o4tlxoii3tldlmDea(mp () rermocoadlm rluvs ()s2urxm3oydalt lfvias  Dur(m nu4texnmoeiyd aDelnms t0artrif3oatlm rai o t0s2uoimpoy4alt mivils aDtmx  no1tpxo o3iytfa2el(vonu0arerircto1oat  uei;s  etmxm3ou1lmt  nesa()s2rru o;u1aeeomictyt a2uaump;(0 reoxfciodfpt lueo;(  exrir3iu4ope mfesa()srtr(rpnu4ope iiciatfa ul(vp u)alerxr3oydomDe i i;t  2to(r nu4op n netl()s2rr(r ;u1olxo f3iat aDelums;()arxomrctatla r nei;s)sruoir no1apt lfcil()s2trxro;t0ape  o3iat a2ul(mont0aeenxo oadoa  liei s s2trir3ny4aptnlivt s aDrrumpou4tpx iieiadls2rmnms;(0 rxoxocoatop  lieo s0 etmxm3nodom nmfetas) Duau pnu4apeo ieiydfsDelumo;() rtrmo iadlaD lnvi s0 2toxm3no1aptnlfcsatf rumxroot1oltnifctadlaDeln pn(4tltrmf3io1oate i o (0s2xm(opnodape lncia(fa2rm(mo;t0tet  ieilt sDel( snt4trtomf iodlatraneo;t0t2xm(opiy1am  mfvi sfs2rru  ot1opxnif3tysla el( o;t4 exrmo iodom  aieil( trtmir3iu1lme  ici sfaDtm( ono0oexoiictadfaDean o;t4tlxrmfctatfm elnvi s0trtoxopiy4al  mieil() rrrx pou0opx mfeiytlaDuanmo;(4teerir oadlmDr n o;t0s2trxopoy4lp elnes t  2tau  no1apxnmiciydlaDum(vpn(0treomr3tydopD anes;t)s2tm(mpio1lp elfvsat)arurxm ou1tet  fciyt aDrln s t0tlenir tydoaD ai s;t seuo(rpiudlptemfvi tfs2rmxrpnu1tlxnio3iad m eaums;u)arxrxo3todom   ivo;( sexo(rpoo4ome lfetatfa2ua( o;u1tptoiiciysla el(monu0trenxo ia1lmteai olt)srur(opou4amtemivs sfsDtm( pno4teeoii3iydlm2el(mo t4texnxr3iadfmDe ivol() ruoxr3nu1olt  iet (  2taumpoo0tptomoeias aDumuvont)alenio3oa1opD ln i;( s2trio iy1oltelfct sf Dta(rooo0tlxnmoctlt sDean p u)texomfcia1lmDeli i;(  etmio iy4lpt mfctat) rumu  ;u1alxnmf3tyslsDulnvs u4trtnmociadfmD ln o;() 2toxr3iy1alt lneilt  Dur(ronu1tetnifctat a ulnms;u0arenxrciydoptrln ils t2toxr3iodlpen nvs s a2ra(  ot1olxo f3tytlmDranmon()arxrmo oodfpD  i s s setrxo nydapen fesatf rrrumpno0tex ii3iatlmDulnvo;()arenmf3iatfmt  uvol(0trtoxo3oy4amt mncsasfartmu ont4olt moeildfmDrm(vonu) lenmf3oydlmt aiei () exm(opiudlpenliesltfsrua(m nt0oetnmo3tad a2em(vo u)trerio ootlmDraieo;t  etmxo nu1ope mnesa(fsrtmurp;o1tlto icias m em(vo u0tetniocoytomt anes s  2tmxm oo4lmt  fei t) 2ua(mpno1aee iocilt aDea(vp t)aexoxr3oy1laDeau ol() 2toim3iy1opeelnvtls sDrr(  ou0olx  f3iadfm rln ont4tleomf3io1opte neilt  exr(o iudalt lfctat)srtrxro;u4ole iocild s elnvp (4tetrirciadoaD auvs;s0 2urxo3oy1am elnesls aDrru poo4apxn ociasfa rm(vonu4 eeomfciy1fmDelivo s)t2xo(rpnudlm n iei s a2uru pno1opeoiieiaslm2umu p;t0tltomociatom eln ils  rto(m3oodap  lncs s sDra( ont1oleomi3tadlm2rm(mp u)texoir3iotom  au o;t0 2trir3nodlpe liet t)s2urxrpot0oltoifeils m2elnms;u) rtrmf oydlmDrln ol()s2tmxr3io1amt  ietat)a2uau pnu4alx ioetldla elums;t4 ltrmfcoy1fmt lueil() exrim3nu4op elnetl()a2taumpou0aleomo3tat m rluvp;t4 ltnxf3oydfpDrlu slt srurxr oodaleemivsltfsDraur ;t1oleniictatlm raums;(0 etnmfctytlat auvsls0 rxo(o iy1lmen nci (  2trumoot4opxnio3tls m2ulnvp t)aexnxrctodlaD lnvo;t trtmir iu4al n feslsf rtru  ou1aeto i3ilslaDrau snt) lxomf3oytoaD  u s;t  rxoxr ny1lm  lieta(  Drau  nu1oltnmo3tasfm2eanvsnt4arxrxf tydomDe u o t  2umimpoy1amt  icsl(f 2ur(ronu0opxnioeilt s rlu s;t)arermociydoptrai il()s2xr(mpiy1ol emivtasf 2um(rpnu4oexomi3iadfaDul(ms;u)trxnir iy1laDr i s t) euo(opnu4ol  mnvsatf 2ta(mo;t0oetniietltfsDelump;t4 rerxfcoadfpt  nes t srxrio3iy1al  lfcilt)arra(mo;o1tpeomf3iys s2um(mpn(4areoio oy1oa  an il()texm(mpoy1am nmiet tf 2taxr ;o0apxomfetad s2ul(vpnu0trxriociydlaD  ueol( t2xmxr3iy1lme lnctat aDtmurp;o1aexoifeiydfs2em(ms;t4 renmfctytlp r i s;s s2urxo ou4am  lnctl()aruaxrpot1olxo i3ilt a2umuvpnt0altnmf oy1faD  nes t setoxmpno1apen ncsls  2rmxr ou0tee ioeias m ean o t4teenxo3iatlmtrlues s)t2xm(o3iu1am  lnvsas)sDrmumono4alxomi3tadlm emumpnu0tlerxo3totfmt  u s s0s2xrio3ou1lpen icilsf Dumx  ;o1altn feiysfa uau s;t4texnmr oatomtelivols  etoxrpou1lme lfetl( srtmxmpnu4tptnmiciysfm ean o (4teerxo3iatoatr u o t teumxopoo4al n ivs t sDumx pou4alt io3tltls2rm( s;(4trtnmfcoodlmDelu o;t truoir iy4am nmici s  rua( onu1apxnii3iytfm ulnvs;()tltrircoytfmteanei;s0srxriopnu4lpt  iesl(faDrauroot1tpxo f3iad a ulu snt4texniociy1faD  i i s) 2toxm oydoptnlictl() rtau  ;u0aptnioeildls2rl(mo u)artnmf3oy1fmD lueo;s) rtr(m3oudomee nvt (f Dtmumpot1tleoiictyd aDeluvp;()trtnmf3tadlaDrlnei t0trtmim3oydlmtnmnvslsfaDtr(r ;o4aexniictld mDel(vsnu)alxnxfcoy1lmte u slt0truo(m3iudomen nciatfarrmum ou0apx mo3iytls2ua(mpn() exrif3oydoaDraues s)trtm(rpiu4omtnmnvs tfs2tr(r ;t4tlto i3tldlmDumnmo u)tltoxfcty1fmDe ueslt0srxmxrpno4llt livt s)a2rrxroou1opt if3iasfm rmn on(0aeenifcty1la eaueo s0teurxmpiu4llte feslsf Dtrumo;t0aet moctysla2rm(vonu)trermrcoadlaD lu i;s) eurirpny4amt lneia(  2tr(mp;u4tle ioeiadfm rmn o u)aetoio3oytfp rauei;(  2umxopnu4opeelnviat aDua(r nu4aee iictadla2rmn o;t0arxrxo3iodfm eli o;( sruoir3oy1al  mfcs (  rrmxmo;o0aee  ictysfa ra(msnt)tltrmo3io1lmDrluvi t0s2tmim oudom emfctatfs2um(mp;u4tptomo3iltfs2ran pnu)texrxr3todfa eln ilt teumxo3oo1omt  ncia(fs2ra(rp;o0opxn iciad m uln p (0aeeoir oytopDe n o s sexoimpiy4amtemivtas  2umurono1texo i3tyt a uanvo;t4 rxoxo iy1fp  li o () etmio oo4amt lnei tf 2rm(ro;t0aptomocild a eauvp;u0 eenir tydlmDe i olt  rurxm iodam e fet s) rrmx  ot4tlenii3iltfaDelnmpn() lxoxociydfmt aies (0sruoxm nydlm nmnvi tfs2rr(r nt4opeoiietad m2emumo t0alerxf iatopt  ueol( tetm(m3oydomenlfcsl(fartmxmo;t0oexo f3iltfa2ea(vp;u0 leniocoo1late i o;t0t2um(o3io1al   nciltf Drmxm nu1oetomictas s umums (0 eeoxfctatop rau i;s s2toio oo4lmtn iviat artaxm ;o4texomoctltlm emn p (0areoxrcoadlpDr uvo () exrxo3oo1amt licsl() Durxroot4aee mi3ilslm emnvp;t0 rxrxf oo1om rlivs;s0tetmio3ny4am emicsas  rurxm ou4tpe iociadfm rmu on(0 leoxrciatfmD  u ilt  2xo(o ou4lmtnmfes t  Dum(mpou4aptnmfciysfs umnmo;t0tlerir oatlptrluvo ( texrxrpiydlm  lnvsa( a2taxrpoo4tlxo f3iat m em( o;u)aleomrcoodfpte n ils)srtoir iydop  lnviat arurx  ;o4optomf3iydlsDrmuvsn()trtnio iodop rau s s  euo(r3io4olte fvs sf 2ururoot0olxoif3iltlmDeluvpnu0tetnmfciytlmtr u sl()teuo(o io1lltnlfetlt  Duaxrpnu4oetnmo3ilsfaDea(mpn()texnifcoatoat auvslt0s2uo(rpou1lle mfet s sruaurpot0opx mfciyd sDrmu p;u0 exrmo3tytlmDe nesl( srxo(r iydam n icsls  rta(m ;u4opx  fetas s rmnmonu0 ltomo3oadoaDe neo s) rtmim3iodale mici s  2umu  ot0apt mf3iyt aDumnmsn(4tlxnif3oodoa  anvo () rxrim3iy4ll   ivt s srtmuroou0alto fetlt a rl(vp;()trenio ta1lp e uvo () rumxopiydap nmfvtl(fsDrrx p;t0alxo oeiydfm2rln onu4tlxrif3to1lpDr n o t0 eumim oo1omenlivsas)artmur nt1olt ioetld m2raump;u0arxrxr3tydfaD ln s s t2tmiopnodll  liciasfa2uaumpnu4ale  ociysfs2elnmont) etnio tytfmtr ueols t2uo(m3ou1lm n ivsat) rtmumpoo1aexniietadlm eauvs t) exoxoctodfa  livs s)srtmio3nu1ol   ivt t srtru  ot1teenmi3tldla rl( on(0 lxrxrciytfa ran i;() rxo(opoydomtn nct t  Durum oo0opxniictydfs ua(ms (0trtomfcoy1fmt lu sls t2trxm3oy1lp e fvil(  2rmxmpoo4apx  octltfs rln p () lxrif tytfmtrli ilt0 2trim ou4ame lnet sfa2uaumpnu1olx iocildlaDua(mp;()tetoxo3oo1fptrlnvi;s0 etr(r oudlmee iei t) Drmurooo4open o3iytfm umnmp (4altoxr3oatoat an o () 2tr(r3oy1altnmncsl(fsDrrxro;t4oeeo fciltfm2rlump;u0 etoirciydfp   u i;(0seurim oodom e iesa()s2rrur no4tpxniieils m elnms;(4 lxoircoo1opt aneols) eurxopno1lpe mfctls  Draxmoot0aetomictad m emn ont4trtnio totoaDranvi;s0setmim iudllte nciasf Duaurpoo1apxnii3iltfs2ulu pnu4 ltnif3iydlpte ieo;s  2uo(r oy4altnmnct ()sDumx ont1tpto iciyd s2ul( o;u0trxrifctydomDr nvo ()s2urxmpnu1oltnmfvt () rtm(mpnt0alx  f3ilsfmDul(vs;u)artnxrcio1omD lnei () 2xrxm3oy1ome mnesatfsrtrxm no1apeomoetytla2emnvon() rerir3oy1fmt  i sl()setoimpiy4al  mfcilt  2rrxm nu0tlxo ieias m2rmu on()trxrircia1fa rlu o;t  rto(rpou4olenmfcsa()aDumxm ot4aexnifciydfa2ea( s;() rxrif3tytlp eaneo ()s2um(m3no4llt lies (fs2urxmo;u4oeen i3tad mDrlnms;u)tetnxo3todlpD aieol( seuoirpno4olee iei tf rtau pnu1opxoifetytls el(vo;t4teerir3iytoa  auei;t)s2xoxrpiudop e ivtat)a2rru onu0texnmoeiltfm2um(vs;u4altomo todomtelu i;t)s2ur(rpnydalt  ieslsf Drmxm nu0aexomf3ils s2rlums;t4tltomf3tydfate i s t setm(m3nu1ole mfeiatfsrrax p;u1apeniociaslm2emumo;t) eeoxfctadfp rlnei;s0srtoxopiy1oleemnvtat sDraump;o1apxo fciadfm2elumo;() etrio3io1lat  n s;s0s2xoimpoo4lp  lfvsasf Durxmpou1tleomfeiyslm el(von(0 rtnirciydopD  nes s sexoxmpno1amenmnvsa(farrmu  ;u4aeenmietatlsDra(vsn(0tetrmo3tadoaDrau o;t0trtrxo nudllte netlt) Duaurp;t0tetomfeiyt a ul(vs u4tetrir iy1fm   u ols)s2xrxo3oo1ol emnviltf Dtm(mooo4oleniicilsla2umnmp u0altoxo3todoa r neil(0 2xoxr oydoleemfvtls)srrm(rono0aeeomo3ilslm2emuvo;()arenxfctodlmt livo ( setoxr oy4amte nvt s artax ont4aeeo f3iadls ra(msn(0areomrcoatoa e n i;s) rtmxopoo1omeelfcs tfa2tauro;t1oetomi3ilsfs um( o u4 ltrmrcoy1laD  u s ()srumxr no4ol nmics ()sDra(  oo1optoio3iyt aDrl(vs;u) ltrir3oy1opDrluvs;s  2toimpoydlpe mfvs t  2rru o;t4oleoiieildfmDulump u)teermociatlmtrau i;() 2xoxr3iodaptnmnvslt) Dum(mooo0apxoioeiysfaDeanms u0altnmfctotlpDrauvi;t srxm(rpoodlpen ieil( arrmxm ;u4tlt if3tld sDrln p t4tltniociotopteanvslt0trurimpiu4om nmfcsas s2rmx  ot0oleoioeiyd a emn s;() ltrio totfat lu o;()srxm(opoydap nlicslsfsDta( ont1tpxomf3iyt aDel(ms;u0trxnmo3todlptrlivs s t2trirpiu1apen fctat)s2umum ot4tpeo ictydfmDuln sn(4 renif iydlpD  iei;t) 2xrxo oo1lpe  ieil()sDrmum ou1olxomfciasfs rl(mp;(0tleomfcoadlat luesls srxoxr3no1omtn iesatfaDtmump;u1oeeoiociasfa ul(ms t0artomf tatlmDrlu olt0 exrim3no1lleelictlt a2rauro;o0opeo ocias a uan s;(0tetrio oodop e ieolt trtr(opiu1opt  ncilt)s2uaxmoou4apxniociatls2elu s t4 exrio oa1fpt  neslt)srtoxrpnu1omtemfctasfarrmumooo0teeoifetaslsDrmnvsnt0arerir3totomtrlu s s0 2xr(opou1lmtnmivi ( arur(mono1tlx mi3iytls uln on()texnmo3tytlmDrlueo s  eumir3iydlmeemfctl()srur(  ot0oet iieildlm2ulnvp;t) reniociodlp elu i;s0seurirpoo1ol e ivtas) Drax pnu4texnifciydfa ulnmpnu0arenmf3iy1lm   ieo t0sruoxo nudlpenmfvt (f 2ua(mo;o1oex  oetldfs2emump;t4 rermo oy1omtrli o;s0trtoio3no4lpe  iciat a2uaxroou4tptniociys s elnvs;u4aeerif tadlm elieslt0t2toir3io1lmeelnvsas)sDtr(mont1tpx mfciydlsDrm(mp;(4trenifciatop   ueil() 2trxopoy4lme mfcsas s2taxr nu1tpto ociyd s uau o;u0 eerxf tydfmtranvo (0t2umim3io1lp emfcslsf 2ururpou0tpxomfeiydlsDeluvs t0 rermf3ta1fmtrlu s t0 rumir3oudop nmiciat sDrmum oo4tlx ioeiytlsDrlnmonu4 rxnmfctodla eaieo (0 eto(m nydalt lieia() Draxro;u0tet mictadls2emnmpnu) rtriocoo1fa   u i t  rtoxo3ou1lleemnvia()aDuau ont4tee moeias a2ulu pnt4 rxrmrcoatfatranvo;()texo(r iy1lltemiesltfsruax  oo4tpeomo3ilsfm2em(vsnu) lenir tydlp  ln s t  euo(opnu4am n fciat arrm(rp;u0apenifetasls emn ont4tetoxr to1omD auvi s s2trxm3ou4ape  nes tfaruaxrp;o4oexo f3ilt aDrm(monu0areoxf3iatoateaiei;( trurio3ny4ol nmfcias)srtaurpnu4oex iietatfm2uan o (0texoif3to1opt auei (0trurxo3oo1apt mfesas s2rr(mp;u4tle  oetad aDemn p (4areomrcoo1lpDelu olt0seurxopiydape mnvsa( sDtr( poo1oltn iciat s ranvont4trtomrcio1opteaues;(0trxmim nu4om elfcsl(fa2uaxr nu4olt  ociltlm ua(vsn(0trtriociotoaDeluvi;s)t2to(o3iy1am   ieslsf Dta( ono1tlxnifciytls elnms;t0 eeomo3tadfmDraieslt0 rxo(opoo1al n nvs t  Dtr( p;o4tpt ifciadls2uluvo u0teenifcty1fa elivi t0t2trio3iodlpe mfvt t srrmur oo0tle mociyd m2emu p t4 exrxr3ia1lmtrai i;s  exmirpiy1omtnmietatf Duauronu1ape  i3iat a2ranmp;u4trtnio3tadfptrlu s;t trxriopio1altnlncs t arraxr ;u1olto ociad mDeanvo (4trtomrctodom rlneo s sexoxopoy4ol nmivtls)aDrmurpno0teenio3iadls ea(vp;u4altomrctadfp rlues;s) etrio3oudlp n ieia() 2ra(rpnt1aptomoeildfmDuluvs;t4trtnir to1lpDr uvi (0teumxm3nudlmt lneils sDtr(mp;u0apx ioetasfaDuauvonu4artrmrcty1oa eli i t0t2uoxopou4lpe  fet ( artmxm ;o1tpeoioetld sDrln o u0tetoir ootla rlneils  2trim3ou1al nmivia(f Dtr(rooo4tpto ictad a2rluvp (0artrir iydla r u i s0 etmxr nydop n ictls s2tr(mpot0tptniociasfm ul(ms;t0arerxrctydoptelneo t) etrir nu4amtemfet sfsrtaump;u0oex io3iytfaDumn sn()trtnif3tatfatrluvsls0s2um(r3oodlmeelfeiat)srtau pou1ole  octls mDulnvsnu4arxnio3oatlpDe ues ( seto(m3ny4omt  icsa()sDrrum nt1tpen o3iydlm2rmuvp u4alxoio ta1fmDran o (  2uoxo iu4llt micsl()sruax onu0aleoifcilt s umuvo;t0texoio3tadlmtrlnvi;s0tetrxr io1amt lnvsat)a2rrx pno1tlt mi3ilsls2eanvsn() rxoxo3tatoa   ivi t0s2toim io4ale lfvsls)arrrur ;o0ale  f3iatfa2rm(mpnu) rxrxr tytop eaiei;(0 rur(r iodaltnmneilt) 2rm(m ou1ale mi3ild sDumn o;t)arerxfcio1lmD  i o;(0trtmimpny1ap  lfeil()aDrrx pou4opeoiieiysls eanvsn()tleriocoatfat au ilt seur(o oudap  mivs s)srtrx  ot4oltn f3tytlaDel( p;() reoif oa1fmD lues;s  2urir nudopen fesat)s2uaxr no1apt ii3tldlm2rm(vo t0aexoxf ty1la rluvolt0t2xoxmpny1lmen fet t)sDraxr ;t0tlxnmfcilsla ranmp;t4altomo3ia1omDr ivilt)srurxm nudol emfei tf 2ua( p;o1opx  ociadfm2ua(mp t)teenif3tadlaDean ols)trtoxo3oo1lpeelieta()aDraxroou1tlt iictytla elu s (4tltnif tytoa r nvolt0t2tm(o nydope lncsas)s2tm(m ;o4opxnmf3iadla2ua(mp;(0 eeoircia1om e n i (0 rurxo ny1lle mnvils aDuax  nt0tpx io3tasls ra(mp;(0 rtoxo totlpD anei;t0srxriopiudlm  mivia()srrmu o;o1tle  i3ilt aDrauvont)tltrmocio1opDeluei (0 exmir3oo1lmen netas sDtax ont4olenio3tas mDrl( on(4trtomocio1fat  i slt0 rtrxrpiu1alee fvi (fsrumurpoo4apt mfciltla el(msnu)trxrmrciatfaDrln s;t s2tm(rpny4oltn iciat a2rax pnu4tet  o3tydla emnmo t0 renmr io1fptelivi s0 2xmir iodapeelfetl() Dtax p;t1opx  fcils m2rmumo u0tetrxoctatfat lneil(0 exrim iy1omt lfesat  2umxr ot1aeen o3iadfs2rau p;(4treoif iytfpteai olt  2to(mpnodamee nei ()aruaurooo4ape mfcildfs2uluvsn(4alerxo tytoatraieol(  2ur(m oy1lp  mfcs ( aDrmurp;o1tlx io3iytfm2rm( s t) lxnxr3ootomt  ivi;t)s2tr(rpnudoltemiesasfaDtmum no1apenmieiltfa2emnvon()treoxr3iy1lpD  nvi;()texo(mpoo1am e iei s aDuaxro;o0ape mi3iaslm emu snt4aetrioctodla eaies t0 etm(m3ou4lm elfeia()arumxmpou0oleoii3iltfa rm( onu4tlxnxf3oodoatr ieols0 2tm(rpny1ole  iesltfa2raur nu1tee mfetyd mDrmnmp;(0alenif tytfpD liesls teuoxm oy4lle  fvsas sDuru pou0tlt mietltlm rluvon() rtrmf3oo1fpD aieo ( trurxopiu1ol elfvt ( sDurxrpot1aetnmfeildfm2emn o;t)tleoir ta1lmDe ueols)truoim3iu4omenmicta( s2rrxm oo1aexo fcild s2raums;t4 ltoir3io1fmtrauvo t)s2xm(o ny4oltemfvtlt srtmu pou0aex mfctydls2rl(vsn(0altoif iadoatrln il(0 2ur(opio1alenmfeil() 2tmx  nt1tpx  feiys m2el( pnu4trenmrcoytfmDelneslt srtoirpiodaltemfeiasf Duru pou1apeomo3tlsfm rl( s u0teeomf3iytfp rlneols) 2xm(mpoy1ol nmictat  2uaum nt1olx  oetys a rmuvs t0texnif iodfaDrlnei s  ruoirpoydllen fvslt)a2tm(mont1alt if3taslm2rm(mpn(0altnif3tytlmD aivo;s0seuoir3oydamtelivs s)s2ua( p;u0aeen oeias mDrau s;u)tlenmo3iodlmte ueo s srurxr3ou1apenlictlt  rrrxmpot0alenioeiyt sDelu onu4 leoxrcoydopD aneslt srtmxr oodopenlfcsl(f 2tmx onu1texoioeiadls eauvp u0tlerio3to1fat  ieo t texr(m3nu4apt  iesat a2ra(m ou1ale  f3tytls eln snu)alxrxo3oy1lateln ilt sexo(r3iy4op e ieia()srrmumpou4tee miciytla2uluvsnt0arxoir3todopDeluvs t0t2urimpoo1lmeelncias)srumurpno1apxnmi3iytlm2ul( p;() exnxo iotfpD  ivs s  2urim iy4lm   ncias arrmxmoot1texoif3iytlm2ua(ms;t) lenxo3iadoaDr i o;t  rurim oydame  fesl(  Dtr(ro;u4opto fciltfs rl( s;u0tlenioctatlaDe ies (0srxo(opno4olt  ictls)arurxronu4tpt mietad a uanms;u4trtnmrcoa1la eaieo;s) eumiopiu1alt  fci (f Dtrur nu0apen f3tat m2emu o t4alxrir3oo1lmDrli il(0s2xr(m3nodomen ict ( a2tm(m ;o4oltn ieias aDrlnms;t4alxoxf3iytlmt luvo;( teuo(r iu1lltn ieils) rumu ono0teeo ociasls2emnvs;() etrif todoa r ivo t0seumiopoodlp emnetltfa2umur nu0olx  fetyd s ulnvo (4 eerxoctatlmt  i i t texrxo iudll n icsltf 2ra(mo;t4opt mf3iatlmDemn o;u) lxomfciatopDr nvi s0t2uo(m3iodal n nesls)a2tmx p;o4tpe mictydfm2uau p;u)arerio3oodfpDrluei t srtrimpoy1lmenmfesl()a2rmum no1opxn f3tasfm emnmont)tlenmr3iodfa  livo s0 rxoir ny4oltemfeslt  rrmxmonu0texn o3tyt m2ul(vonu4 lxnxf iytlmteau s t)trxoxo ou4oltnmict s) rur( ono0tpe  ociat m ul( p t4 exomfctatopte ueo ( texoxopnodam  mnct t)aruax pnu4tee  ieias aDra(mp;t)teeomf tadom  ln i;t  rxo(m no1openmies tf Dtmumont0tlen i3iat s ulu s;()tlerir tytopD li s s  2xoim3oodolte ietl()a2raumpot4oetnmoeiysfsDul(vp;u4tlerif3iydfpteli o;t0 2xrxo3ou4apt mfcs s) rra(r ;o0optn feilsfa el(von(4aexnxfcoodfpt aivi;t)s2tmimpnydam   ivtls srrrxr no4aeeo ictlsfa rmuvo (4tltrxocty1oaDran s;s setrio3oy4opeelncs s sDtmum ou4aptoif3iat m elumo u)texomocoydopteluvi s) eurxo3oy1om n nvsat) 2uru  ;t1tex moeils sDeaums;u) renmo3iydlm raies t t2trimpoydopte nctls  Durxmp;u0aleo octas mDelnvo t4tlxrmfcta1fpt lu il(0 2xo(m3nudale mncs t sDumx  oo1tpxomfeiydla ra( p;(0 leomf3iodom  li i s0t2um(o ny4al elfvsas) Dur(m no4aex  oeiatfa2emu snu)arermrcia1om eln ols) euoxr3oo4llen nvt () rumxrpno4oeeo i3taslm uan o t)aeerxocoatfatelivolt0truoxr oodlpt lnvsat  2uaur ;t1opxoifetad mDelu pnt)alxoir3oydomDeaneslt) rumxr iu4alenmfci sfartrxmp;o4texnif3iydlm eluvp (4tltnir3tytoa eanvs;(0srtrim3ou1lltnmnci (  2rm(ro;o4tpe  ieiaslm uln on(4 eeoir iatop eli sl() 2umxm nydlle lnvtat)aDtmurpnu0aleo fciatfs2emnvo;t)aeerxo oatlm  lieo;t0srtrim3io4ap  lncsa() 2ra(rpnu4altnmiciltfs2uln o;t0aeeoxf3tatomD lnes;t tetm(mpoo1lm n fctl(fa2urx o;t0tpx  fcildls2ea(vp u)tleriocoatoat au s;s0s2tr(r oy4lmt mneil( aDuax ooo1oetnifctas s raums ()tlxnmfcootop e u i;s)setmim oudlmtemictls)a2taxrpot4aet mi3ils aDua(vont)aexrir3iatfaD an o;t trumxmpiodalt mfvsl()a2tmxrp;u4tpt mf3iatfaDeanvp (0trermo tadomDranvols0 rxrimpoodop  miei ()srumx p;t0optn iciysfs rm(vs (0aleomoctydfa   ivs;t0 2tmxr3oudlmte ietatfa2tmur ;o4ape  o3iytls uauvo;(0 rtnmf3ty1omDr nvils)t2xrxopnydap emictlt  2rrxmp;t0aetomietlsla eanvo t)teeoioctatlaDrau s;s teur(o ou4ape  iesa(fsrtruroot1olenio3tltlaDumu p u0tlxrmf3io1opt lnvi;s)s2umiopny4lme lnvi ()srtrump;o1tetnmfeiltfaDrmnvp t)alxnxrcto1la  li ils0sexmiopnodol e ivi tfsrururpnu4oex moctlsfa2rl(ms;u) exnxr3oo1op rauvo;()srumim nu1apt lfct t)arur(  nt4tptoioctlt m2ranvpn(4tleoxf3oydfatrlnvols  2xoxr iudl
\ No newline at end of file
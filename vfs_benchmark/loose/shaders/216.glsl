@@ -0,0 +1 @@
+uvs;s)tetrxr iu1optemneta(fsrrr(ront0tptn iciysfm em( s ()altoifcio1faDr nesls  2urirpnu1lpt mfvi t srtru  ;t4altnmfciytfs rauvs t)alerxocoadoaDranvo;s0 rxm(m3ou4al  lieias)sDra(  oo0altomi3iysls2raumpn(0teeoir3tydopt  ivils0 rum(o nu4llteliet (f Drm( o;o4aetnifeiyslm2uln o;u4 lerxrctatlaD  ueo;t  2tmxm oo1apee fvt s  2tau ono0tlt  oeiatla2rlums;() rxrio3oy1omDrln i;t setmxmpio1alenmiet tfa2ra(rpnu0tpe if3tas m2um( p;() eeoirctytfa elnvi t)seuo(m3oo1lltn fesa(  2tau p;u0oexn fciysfa2umnvp t0altoxo3iytoaD li i s) rxoim oo1lmt mivias) 2rrxmp;t4olxomfciaslm ua( p t)trxrir3tytlmt  nesls0trurim oy1amtnlnvt s s2taxr oo1oleoifetytfsDemu pn()alenmo tytlpD aiei ( sexrirpoydll  mfeil( s2tau pnt0opeomf3tlsfs raumon(0 rxrio ootlaD ln s (0t2tmir3ny1llenmnei tf 2uaxr ot0aexnifetltlm umn pnt0arxoio3oa1omDr ivi;( srtoxo3iodam nmnvilsfarraxr ;o0tlxoioeildlmDrlumo;u4trerxocia1fpDrlivi s0 rtr(o3io4oleelnvta(fs2ra(r ;o0tlen o3iatfaDuluvp;t0 ltomo ta1oat  ueols)tetoiopoodom  lnvi t)sDtrxm nt1olenioeilslm rauvs;t0 ltrxo oodfat lu s;t srumxo ou1aleeliesat arumx  no1optnmfcilt s emump;(4trtrxocoadoat luei ()seuo(o oydll nmfcsls)srtm( oot4olto ieiyd s2ulnvs;t0artrxfcoa1opDrln s s0 2to(r3iudlmen neiat srurx p;u1oeenio3iytls umu o u0aleniocoo1omDr n o;t texm(o nu1optnlfcs t arrauroou0alxomictasfa eauvpnu0aleomf to1oaDelues t seurxrpny4om   ivsat) 2rr(mpoo1tlt mfeilsfsDrmnmp;t0 eenio iytlpDeaivsls t2umimpnodoltemnvt t  2rmx ont0apxnioctytfa uluvpn(0teenxr totfpDrli i;(0 rurir iu4lme  iesa(fsDur(  no1opxn ieiatfsDea(ms ()tetrxo iytlat  uvo (  rtmirpno1al  mncias  2rrxr ;u0aetnmiciydla2elu s t4arxrmrcootoa ran i (0 eto(o io1lme  fct s a2uaump;t4tpxnioetadfmDrmn s;(0teermo3to1op  lueo;t)t2tmim3no1lmeelfvilt) rrm(m no0tetn ieildlmDrmump u0 leomr iodlmDeauvs t)tetm(opnu4open fvsltfaDum(ro;u1apenii3iysls2raump;(4aetrmfcoa1lm  aivol(  rxmim3no4ome micsasfs2rmxro;o4ope  i3iadfm uau p;t4 lxrio tatfate nvs;( trxo(rpnydop   fes s)s2uaum ;o1oleoifctasfm emnmo;t4 eeoxr3oy1faDrauvs t s2xr(mpoy4lpe lieslsf 2uaxm ot1aexomfetytfs rmu pnt4arxnmocoa1fp eai i;(0truoxo iudll e neil(f rtm(monu1tlxnifciytfmDemu o;() reomocoy1lm eluvslt)tetoxo3iy1lp elfcs t) 2rr(r nu4tex iociadlm2elnmp;(0 rerir3iodfa raivs t truoir iydop e ieta(f Dra(m ou4olx mf3iydfsDranms (4 rxoxo oytfmD li s s)t2toxr no4olen iei t aDtr(mpno0tpenmo3iytls2eau s;()texomoctydfaD  nei t)tetrimpnudole mfvias) 2tmx  ot1alxnif3tatfm em(mpnu4trxomo ta1fateluvolt srxrim3ny4ope mics t)s2tm( o;t1aeeomi3tyd s umn p u0 ltrmr ootoaD lu olt)t2tmiopiodllen ici s) 2rr(r ;o1ope mi3ild s ulnmp;(4tetrifciatfm rluvi (  eumxr no1llt  nes ( a2urum no0tltn icias sDeaumsnt)alenio3ta1opDeluei;s0t2urio io4aptelicil(f 2ururoou1oexo iciysfs ul(ms u4tleomr3oy1lp eluvs;s  euo(rpou1lm emiesa(fs2trx  no4oet iieiat a2elnvp;t)trermr3tatfmtran s;(0 2umir3iy4opeemfes t)s2rmxm no1aeeo fetlsfm ranvs;t4aeeniociodoat aueols)tetmxr3nu4amt  fes ()sDtmxronu1aet mi3iyt m2ulnvs;t0 eenxr3iytlpD aivo s)s2to(m iy4al  mnvs ()a2rau pnu0teen i3iltfa eln on(0 ltrmf3tatfpDrlu ilt  rtrxo nu4lmtelfcs sfaDraumo;u1olt  iciyt sDrmums u4tlerifcta1opDraivolt)tetrxm3iy1ll nlfcil(f 2tru pot1tpxnioctyt a ran o;(0 rtnxr io1oate u s;() rtmxo3iy4ap elivsasf rum( o;t1tpen i3iyd m2uan s (4altomo totom e neo;t0 2xoiopno1alen fcta(fartru ono0ole ioetatla2rmn ont0tlxoiocoa1fpt lu ols)tetrxo3nydaltnlfesa(faDtmumont1apxo oeiaslm rauvsnu0aetomf tatfptrauvo s0t2trir iu1altn fci s aDrr(mp;o1aexo oetldlaDuau pnu4 rtoifcoadfpt aueils0trtoio ny1ome  ivsas  2rm(r ;t1ole ifciadlsDumums;t)aexrxocoatoate nes;() 2urxm nu4ol  mnci () Drm(rp;t1tlto ocildlsDrmuvp (4tlxoxr3ty1op ranvo;t0trto(m io4amtemivsa( artm(rp;t4teenmfetaslmDumnvp;u)arenmf ta1lm  lu il(0trxoimpny4alte nvt (fsrrm(r nt1teeo ieiys aDrl(ms ()aexoirctytla eaneo () eumxmpny4lptelfcs s)sDtaum nu0tetn fciltlm rmnvsn()aeeomocoatla r uvs s0 rxoimpou4lle mfviat sDur(m oo4apxo ieiatfa elnvo u4texnmf3ta1opte uvi s0 rtmio oy1openmfesa(fa2umxrp;o1opeo iciytlm eau p (4arenmf iadfatrai sls srxoiopiudop  lnet t)a2ua(mp;o4apxoiocild a2rmump u0aeeoxf todfa rau sl(0srurio3iu1lp nmncilsfa2rmurpou0tlt mfcild sDranmon(0tltoio3oo1fat  iei s0 euo(mpou1op   fet t a2ra(rpnt0aee iictlsfm emnvo;() lenio oatoptelu o t  etm(mpiu1omtelivtl()srur(  ;t0tlxn o3tldlmDrmuvpnt0 rtoxoctadomt ai olt  2uoim3iy4olt mfvia(fa2trum oo4oexoiictyt mDemn snt0alxrxfcootfateauvsl(  rxo(rpio1om n netlt) rtr( onu0oeto ieiys a ran s;(4aetnmf3oo1fmDean s;(0trxm(opiy4ap   nei (fsDtm(mp;o0tpe mfetltfaDeluvonu4 lerif iytoatelieolt0texoio3oydlpt  ivi s) 2ua(rp;u0opx miciat mDulumont)tetrmf3oo1lm r n o;(0trtrxrpoodole livt t)aDuru  ou0aeenifeiltfaDuluvo t)texrmrcoadlmDrliei;( srurio3iy1olenlfctls sDra(ronu0olenmo3ild a uanmo (0 exomf todfaDr nei;( tetr(r3oy4lm n ietls aDrrump;u0oex ifeiltfsDranms t)arenxr3oytoaDeli i;(0teur(rpoydlpt liesl(fs2raxrp;u1ope  o3tasfs ranvs (4alxrxf3iotfmD aiesls0 exoir3iydape mfei s) 2ra(m ou0ope mfetyt mDeanvpnu) eeomr oydlmD  uesls) rtrxrpnu4lpee fetat sDur(rp;u0alxn ieiadfaDuaump;(0alxoxf iatoaDeanvil() ruoxo iu4llt lfeslt  ruaxm ;u4tpxn i3ilsls2um(vsnu4trxrmr tytoa   u o s)srtmiopio1olt lnctas  Drr(rooo1altnioetltlsDuauvp (4tlermr3todom rlneils) etmiopoudapen feilt)s2rr(mp;u1apxnmfeilsla uan snu0tlerxociytlmtean s s0t2toim oydlpt lnei tfsrtau  ou4tleo fctytlm ulumo ()aleoif totlpDeluvsl() eumxo3iy4opte nci (f Dtrurp;t1optn i3iysfmDrluvp;()aetrmr oodoptr n il(0 rtrxrpoo1olee fct s s2rr(  ot1aeen o3tytls2ulnmpnt4arerxr3tadlptr ueols s2tmimpiy1omeemfcsls s2uaurpnt1olt mi3ildlaDemn pnu4aexomr oatom ran o;t0trumim3nu4am  mnctas)s2rmxmpou4tpx  i3tls aDeln o u0aetrirciytfp rluvo;()trumirpiodoleelnctls)aDra(r oo0tpeoio3tys m rmnms (4 lenmr to1lm  lnvs;s0teum(m iy4lptelfesa(  rua( pou0aeenmi3ildlmDuanvonu0 exrmf ootfmD luvo;()s2tmxo3ny4lm nlieiat  rtrumpoo0aet iictys aDrln onu)artnio3oydfm elueols tetmxmpou1amte fctat)a2ua(m ot0altomi3iysfm eaums;()altoxf3oo1lm   u ilt) 2xr(r iy1om n ivs t)sDur( o;t4tpeomo3iydls rlnmo t)tleomo3ty1omt lueolt0srtr(r oodap nmfesatf rurx p;t1aetnmf3tad a ran on()texrmrcoatfmD anvi;()t2uo(m nu4llt lfetat) 2taurp;u4aetn octas mDulnmo;u4trtrir tytoa  ai ol(0srtr(m3ou1lp  mivsls)sDuru o;o1tlt ioeiytfsDrmuvont0 exomo3oatom rliei;t  etm(o3no4amenlnctl() 2rmu pnu1aeeomietadlsDul( pnu) lxomf to1lmtr u i;(  eurio io1lm emnvsl( s2urx p;u1oex ioctlsla2umnmont4 reoircty1fp   neslt)t2xm(opoy1om emncil( arum(  oo4tlxn oeiyt a2eau s;t0tetnxf3oa1la  auvilt0teuoxo nodapee ncils)sDurxmp;o4tpt  oetadfs2el(ms u0aetrioctotom   u ilt0trurir oodam n fctltfs2raxr ot4tleoiieiyt m uauvs;t4tlenxo tytfaDr n i (  exo(r3ny4lmenmivs tfs2ra(mpot4tpeoifeiadfmDemu p;t0aleoir3oodfp rai sl( t2uo(r oodap nmietatfs2umumooo4aleoii3iyt aDrlnmsn()tlxnio3to1opDeluvs s  ruo(m iy1apen fet t) rtmxm ;o4opxoiocildfm uluvon(4tltnxf ia1oateaneo s)seumxrpny4alte fciltf 2ua(root4oeto ocildfa2em(ms;u)trxnmr3ty1oa eli sl()tetoxmpoodomtemfvsa(fartr(m ;o4aleomfetadfaDeaump;t4alxrxo iy1late u i s)s2trxopou4opee ivtas srtru  ;t0oexnmiciytfm2ulums u0tlxrmo oadlmtrliei s0srtrio ny4opt livias aDta( o;o1opxn feiasfmDuluvo u0texnxo3oodlp ranvi t0srxr(m ou4al emies t  2rrump;u0olto ieiatlaDrlnmo t) exnxo3ia1fmDrluvs;s) rxrxo nudom n icta(fa2trx pou4ale if3tlt s2ulu pn(4trxoxf iatlm  aiei (0trtrxrpiydomenlneslt  2tm(mo;u4apxoifcilsfm rmn pnu) exnxr tatomte ivo (0 2tmimpio1lptelicilt) Dra(r oo4apenifetatlaDranmont4trxrir tytlmD  uvi;s)trurxo nudaptn netas arurx oou4oex mo3ilsls2rm(mon()tlenxf tadfa eaivil() 2xoir ou4al  lieiasf rtaxront4oet mieiltfsDuan snt4aeenmr3iotoaDr nes s trumim iy4lptelfet ()sDtmumono4aet iocilt sDrlump;t0 ltnmf3io1fpte u i s0t2tmim3iudlmee fcsatf Dur( pnu0tptoif3tldfs2eln p t4 eeoxoctotomDeln o ( srxo(r3nydamtnlfvtlsfs2ua(rpnt0aptniicils a rmu o;u) ltoxocto1fmt  n s (0texr(r3oy4optnlicsls srrr(  ou0aexnmiciydfsDem( o t0 lxomr3todlaDraivi;t) etrxr iu4opt  iei (  Dua(moou0aet mieiat s ea( onu0 etrmf ta1omD  uvolt)t2urio3iy1amtnmiciatf rta(  ou0tpt mfciaslm2eluvo () eeomo iatlmteaieil(  eur(m3ou4om nlics (  2urx  oo1tee moetytfs2rm(mo u0 exoxo oatlpDrluvo;(0 exrxm3ny4amte icslsfa2rau oou1oexomicilt a2rmuvs;(0 ltnmr tatfptrliei;t trtmio3ny1alenmfetasfsrtr(m oo0opt mieiydfm rmuvpnt4aeerir3ia1faDeliei;(  rumxr iudamtnlietatf 2umumpno1aex mfetldlsDranmsn()artrxf3todfmDrai o t0s2urimpnu4lptnlicsas)aDra(roou4openiociat a2rlu snu4trenmr ty1om  aiei;t0 2to(r oo1optelictas)arra(m ;t4aleoifeiytlsDemnmp t) lxomr3ta1fa rln o t0s2ur(m3oo1llenmfetatfsrrmu pnu1oltoifctlslm2rmuvsnt4tetniociytlmDrlies;t t2uoio iu4aptemnciatfartmuro;u1teen feildlm rmuvp t0 rxrxo oatoa  auvo;s0 etr(r3iydlmtn feil( s2rrurpnu0oexn fcilt m2ul(vpnt4aeenxr oatom rai o;s0srurir nodop nlnvi s)sDtr(r nt0tpx moeiysla2ra( p;u0 etomo iodfmDrau slt0seuoir oydlpt mivias a2rax  nu0oleoioeildlaDraump t4tlxrir iatfaDrlu sls0trur(r3io4apenmieil()arua(rpou0tlxnmociys sDumu o;t4aexoifciodlptr u o (0seur(mpno1am e fcsltfs2ta(r ot0tltnmf3ildfs rlu o;u0alenir3ia1opD  i ils)sexrir3oudllt lnesat)aDur( pnu1aetomi3tadfaDemnvs t0texrxo iatlpteai i ( srtoxm3iudole mnvt (farua(r ot4altomociyt s2emums (0 etnmocoadopD  uvsls) 2tmim3no1al elncsltf rtrxrpnt1oex mo3tyd a eanvo (0 lxnmr oydfaDrluvo;s)setoir nudam  lici (fa2umxr ;t4oetniiciatls2ranvonu4aeeomo3oadop eai s;(0teurxm3io4ll emnci t  rumumonu1oee  fciad a emnmpnt)tetnif3iydop   i o t0s2umim oo1lm   nci s) 2rm( p;o1aptoioctltfsDuln o;t) eeriocio1omDeauvi;(0teuoxo3no4alee fvilt  2um( pou1ope moetldls2elnmo;u4alxomo3oatfmDeau i t)t2um(o nudalt mietlsf rra( ont1apeo ietldla ulnmo u0tlenmf3totoaD lnvs (0 2xrxo3io4alt  ieia() 2rmurp;u4ope  i3tytfa rln p;t)texnmo ootfat au s;(0 2xmimpoy1al e nes sfaDtmx o;o0tleo ociysfs2ulums (0 rxoif io1om e neslt  etr(r3iy1lpt  iesl()sDrrum ;u0aexomf3iyd s2ea( s;u4alxnirctodlp eaivo;s)teumxo nodll nlfei () Draumono0oleoiociltfa el( pnt0aexnmf oa1lptelivs t)trxoxr3iodamee fvslt  2rmum ou4texn i3iaslm umums;(0 reomr3ta1fm r nes;t  2toxr3oo1lmtn nvtas)srtaur no1apeo fcias s2rlu p;(4arxoxf ty1fa  lnes t0 2umxm3nudope mietat) 2ta(rpnu0olxnmictyslmDrlnmonu0aetoio tadlaDrlivs t) rxr(m3ou4ll n ict ( s2uax poo0altn ietas a elnvp ()alxoio oadfpteln olt srxr(rpiy1lpen ietlt  rta(r nt4teeoifciytla rmumpn() eerxo ootfa  auvolt setoio nodopt  nctas a2um(mo;o4oex io3ias a2uanvont) lxrxrctatop rlu ils0setoxm3oodalte fctasfaDtax p;t1oeeomiciadfs umnvon(0trxnir to1faD lu s t)trtoxo3ou4amt lfeslt  Draum ;u1tet ifeilsfaDumnmpnt)trtrircoydfpD  i o ()truoio nu1ome mnetat)aDua( o;t0apt ii3tydfs umnvs () ltoxo3oatlmDe ies t s2umim oydolee nci s) 2rm(rpoo1apx  feiydfaDem(ms u0areoio3oadlm e nvo;s) exr(opnodam emnvsl(fartrxmp;t0oltn fcildfs2emnmp;u)texoxr tadla raieo t  2xriopiy4oleemneils a2ra(mpno1aexomfciydfmDelump;u4aeeoircio1lpteln o ()s2uoimpiydomte ncsl(f Dururoou1opx mictytfm2emnmp (0tetoxr3oytoaDr n s (  rtrim nudam emnvtlt)srumxr ;t4tpx  f3iadfm ean on()texnxr iydlmDrau slt)s2xrxopnudamtnmnvta( sDta(  no1aeto fcildfaDra( s;()tlerxr oadlmt  nvi;s)srxoxopio1oltemivsas aDtm(  oo1tpxo iciytfm rl( o;t4teeoxr3tadfa  au ils)srurirpiudam nmict t)sDrm(m ;u1oetomietldla eaumo;()tetoir ootomD ai s;t)setmir iu4altelnvsat  2rrx ono1tex mieias a2eanvp;t4 reomf3oadoat  nvi;s) euo(o3iy4al   fei t)a2tmxro;o1olen f3tyd m2emumo;(0 rxrif3oatfmtrlu o;s srtoxr3no4alee nvilsfs2trxro;t0oltoiociaslm emuvo ()trxrxrcia1fa r ueils0teuo(opnu1lp nmfct sfsrum(ro;t4oeeo octldfs2ul(msnu4 reomf3iodfm rlies;t0 2xm(r3nydop n ncslt  rrm(monu0tle mfctyd m rl(von()tltnmo iatla  li o;t srxm(opoo1lptnlietltfa2raxmpoo1aex  icilt m eauvont)aleoifciytla eluvs s0srtmxr ou4am   ivsatfartmxr ;o1aptn iciydls emnmonu) lxrxo3iy1lp e i s;t0 etrir oy1al  mnvs ( sDrmurp;t0aee miciytfaDrmnvsnu)texoxr iodla rlueo t0s2xrio3oudop elfvsls)artmum ou0tpxn fcildfa elums;u4texnmr oytfatrlu sl(0srtoxm nodlmeemnci s) Dta(mo;t0texoif3iasls2el( o u)arxnif tytom   ieol(0 rtmxm oy4om elivtl( s2um(rpou1alx ioctltlm2emuvp;u)aexrio3iotfp ean o t0t2umim3ou4ol e ietas sDuax ooo4oexoiiciadfsDuln p (4tetrircoydlmDe iei ()teuoxmpoudamtn ivta( a2rmxronu4aeen ieiytlm2umu s t)tlerircoydfa eauvs;(0srxrxmpio1lpt livsat)s2rr(mpou1openmfctaslm eluvs;t4tlermf tatoaD aieils0 2xoxr iu1lltn nvtatfartru onu4tlenmictld a2rmnmo t)tlxnif tytfaD  n sls  2toxmpnu4oltnmfvtlt)srtruronu1openii3tld aDelnmp (4 exoxf iotomteln sls) exm(o oydlp  liet t)a2rmurpou4tle  feilt a rmnmo u4 rxrxf3oo1fm eln ils) rumxo3ny4optemfctls)srta(monu4tpxnmfeildfa rau p () eenxrcio1opt  ivi;()texm(o ou4lpenlnvslt s2umxmpot4apx  ieiysfaDeauvp;(4tetrio3oytla eaivs s0texm(mpnydlm emnvils)srumurooo1oexo ieiadlm2raums;t) eenxo tydfpDeaivs () 2tmxrpio4apenlnvi (  Drrxr ;t1oltnmoctasfm2ranmp u4 rxoio3iadlm  livs;(0 eurir3nu4al emnvi ()srurumpot1ope mocildfaDuluvp;t4tetomr oadlpD lnei;s0s2tr(r3iydaltemiet s srumumpou1olt mietadla rmnvs u4texrir oadop rau i (0trxrir3io1amte fvil(f 2raxrpoo1tpt io3tysfs uluvo;t0texrmf3oo1fm   nvi;s t2umxm iudolt lfeia( srrrxrpnt4opxn i3tadfs2eluvp;u4 eeomfciodfm rluvi s  eurxmpno1ll  lfetlt  Dumu  ot4ale iicilslaDeluvs;t)trerxrctadoptelues;()texriopou1omt mncia(f Drax ono4texomfcilsls ulumont4aetrmr3totfa eau s t trxoio io4altelnetltfarur( ont1aee  i3ildfs ul(ms t0areomo oytoptraiei ( trtm(m3nu1am nmncsas artrxmpot0aex iictadfaDulnmp u4 exoif3io1fatrauvsls)texoio ny4amt livs t) rtmx pot4tleomfctys mDeln p;()arenif ootla raiesl()setoxopiydolt mnesls)a2rmx pou4oeto oetas m2rlumo u0tltoio io1opDr uvs s0t2uoim3ny1openmfcilt  rur(  no4alxn ietasfs2uauvo;t0trtomociatlm  auvils0srxoxm oy4op nmfeiat srrrx ont1oleoiociydfmDumump u4artriocta1fmD lieil(0t2umxrpio1ome mnvils) 2rrxr ;t1tetn iciydfaDea(vs;u4 ltrmrcoo1lmtelnvs;s)trtrirpiu4lle mictls) 2ururo;o1teeoiietltla eln p;(0 lerif oadfaD luvils)seurim3iudlpe  fvia(  Dtmx  ou0tpeomoeilslmDul(von(4 rtrmo ta1fmDrluei () 2xo(r oy4omenmicsat artrumonu1tpx mociyslsDrln o;t0 etomo oadfpt  ivi (0 rurxopnu1apeelfctat  2taxrpou4tle  i3ilt s emnvo t) lxoxf3oy1om e ieslt0trtriopiu1olenlivslsfsDrr(mo;t0tlt ifeiys a umumo t) ltomo3iodfpDr nvo;t)s2tmxr ny1am  livtls)srtmxrooo0tpt moeiadfs uan o t0 rxoifctydoateln ilt teto(mpiu1amenmfes s) Drmur oo4tlx if3iysfaDrmuvs (4aeenxf tydfatelueolt)trxr(r3oodom e fcta(fa2rax  nu4tle if3ils aDrl(vpnu0 lxrxfciydla  li s;t0 rumir3oo1aptelict t)arur(mpno0apt  ociyt aDelnvp;u) exoio tydomtraivs;( trxmio3ou4alenmiei t  2rru p;u0tltomfeiydfa2emumo;(0 exoioctytlmDeln ols s2xr(o3oo1lmtelfeta( sruaxrpou1aetnii3ildlmDemnvo u)altnxrctytom eluei;s tetrxrpnodamee nvt ( a2ur(m ;t1aex iicilsfs2ea(vo;(0tleoir3oydfa r ivs ( s2xrir no1ame mnctlsfsrrm(mo;o4aee ioeiatls ra(vpn()artomo3todopDr nei ()texm(m nu4om   netl()aDrmxr nt1tetnmf3iatlaDea(mp t0altomr iydla rau i s)s2uoir oydame lfetls  Drmu oou1alxo ietls mDemu o () renxf oa1laDrau slt) eum(r oo1ame lnvt t)sDtax onu4aeenii3iytla2eanmp;t4artrxr tatomtelu s;( tetmxm3oo4lmt mies t) 2urxmpoo4oex ifciltls eluvs;()aeenxr3tadlpteai i;t0t2xoim3nu4olt  feil(fs2trxr ot0oet mf3iasla uauvo u4aetoif3tytoa r ues;( t2xoio nudoltnmnvtls  Drm(r ;o1ope iieiatfs umuvp () ltrxr todfmDranei t0 rum(rpoodopee ieia( a2tmxrono0tptn f3tas a2eanvp t) ltnmf io1oaDeai i;s t2xmxo nodol  lictas)aDtrxr ot4alx mo3ils s emu s t0teenxr3iatlm r nesls) 2xoxr iu1opeelncta(f rraur ;t1tleomfetatfs2em(ms;u)alxoif iydlaD an s;( trtr(mpno1lp nmnctas)srrmxroou0tleomi3ilsla2umn o u4 etnir oo1faDraieo;t teurxm ny1lmeemnvtl(fa2uaum no1tpt mfciysfm2rmums;()trtnmoctotfmtr u ilt0srxmio3nudomtemfcilt)arraur ;t0open ieild s2elump;t)trtnmo3oodfat au o;t)trxo(r oydlmee icsa(f Dtmumono0tet ifetatfs eau snu)alxnio iodoa e uei s0texm(m iu1ole  ieils) Dta(mono4tpeomfctlslaDrluvont4altomr3iydla elu o;(0s2uo(m3oydlp nmneta()s2rmuroot4aleo octat aDumnvo u) ltnmo iytoa rauvs s t2xr(o iu4ll e fvslt  2tm(r ;u4aexnmociad m2ua(von(4tltoif3ia1fmDr i o;() exo(m iydlmtelncs s) rtm(  ot1tet  f3tlsfa2rm(msnu)trxriocty1op r uvs;(0 rur(o iydom nmneils) 2urumpnu4opxomictltlm2rl(vp u)tltoif3to1lmtelnes s0 eum(o iudal  mfvsas aDumxrpoo0open o3ild s ra(vs;u) lxoifcoodlaD auvol(  exoio3oudlp  mivi t)s2rm(m ;u0aptnioeiatfs2rau s;u0 leomr3io1fmteauvo;t0tetr(mpny4ol elfetat)sDrr(monu1olxn ieiysfaDuanmpnu) leniociadopte i i s) rtm(r3iy1ameemfvi t srtaxmonu1tpen iciytla raump t4texomrciotomtr ivs;s  etoio ny4aleelnvs ( arrmumo;u1altomocias m eanvs;()tetrirctytoa   i o;s)s2ur(rpoodame liesa(fsDumxroot1opx mictytfs uanmp;u0tltoir iytomt ai ilt)srtoxm iudopenlfvtasfa2tmxmpot1opeomociltfaDranms u0trtrio iadlat  nvi t s2tr(o nydam emfvt s arrmu pot0tetoioeiydls2uanvo (4aeeoif oy1fmt  uvs s) rto(m oo1ap emfctl( a2rru poo0apxomiciadfaDemn p u4 leoxfcootfaDr u i;() eur(r3oo1lmt lneta()aDuru pnu4tpt  iciad aDuan pn(0arxnmf iotopDrlivslt  eurxm iu4olee net sfs2tr(ront0opxoiiciatfm rluvpnt4tetoiocta1fmDrlnvsl(0 2tmimpiy4altnlfvilt srrr( o;t4apxo fetadlm em(ms;(0treoxf3iodlmD lnes;t)trum(o nodlpt mfviatf 2rm(r no4optnii3iysfaDuanmp t4 etrio3totfm e i s s) 2xmim3iy4omt mncsas) Duax  no1oeeo f3ilsfsDrmnvp;t4 rxoxfciodomDe u sls teto(r3iy4alt licias a2raumooo1teen ictld a2ea(msnu0tlxrxr ootlmtrlieolt tetr(mpnydoleelivsa(faDua(m oo1opeo ieiytlm eluvp;u)aetrif iy1lp e uei s trtm(r iydllt livt ( aDuru  nt0tpe iietys a2em(vp t4 eerxrcoodfatr ivi;t seuriopnu1aptnlfvta()a2rr(mp;t4tee ifciydlm ranmp;t4tlxomr todlm   ieol()trtmim3iydomte ivt sf 2ur(  ;u1opxnmfetldls2em(ms (4aetrxr iy1om elivs;t t2to(r nodolen fvil( sDumu pno4teenmoetat s ra(mp (0texrif3iotoptr u i;s truoir3nu1am   fcsas)arumxmooo1teenii3iasls raumo;u0 rtrmo todlmtr n o;()texrxm3io4lm   nesa(f rtrurpnu0tpe micils s uaumo;t)treoxo iodfm eau s s srxoim3oudoltnmies t) 2ta(moou0oetn ietyd s rlu p;(4tltoio3tadlatrlnvil(0teuo(r3nydal nlnes s)sDumx oou4teto feildls2uluvp u0 renxrctatopD lieo;s truoir3iydllen nesas)aDta(roou4opt ifeiysls2ua(vo ()arenxo to1omt  n i;t)setmxmpnudol elnvs tfsrtmx  oo1oetoio3tydfm eanvonu0 eenxo3totopt ln o;s0 rto(o no4ome lnvt t)srrr(mpot0oltnmf3iasla2elnms (0arerxr3to1om  lieo t0trtoiopnudamenlnctasfsrrax p;t4tptomictlslmDulnvp (4 rtnmo3iadfpDe n o ()srxm(o3ny4ame  fviat) 2uau  ot1alxomicils s2emuvo;t4tlenxr3oy1fa   uei s  2um(o iu4lmenmncsa( sDrax  ot1teeo feiadfsDelnmon(4tltnio oatopDe u i s)truo(m iudomt lieia(fa2tmuro;t1tltnio3tytla eau o;u0arxomociadlm rlueslt) rxrir oo1lpeemivt sf 2raxrp;u1open iciatfsDulnvo;u0tlerifctotfm eluei ()teur(o3nu1ole  nciat srtaxmpoo0aeeoioeiatlm emu o t4 lenif totlmt li s (0 etrxm io1al emnviat aDrax pno4tlto o3ils mDranmo;t0altoxf3oatlateai o t)t2xr(o oydlme  fetas) ruru ooo1aeto iciatls2eluvont4alxrxr tydlm elueo;t teuoxr3nydlptemfcsas)srrru pno1tptn oeiyt m rlu on(0artomrcoytfa eln o s) 2tm(r nudomtelnvt s sDuaur ;o4texomo3ias m ea(mp;u4tetomf3iotoatrli o ()seurirpny4lptn fvt s a2uau o;u4aptoifciysfm ea(ms (0texoxfciatomDelneilt s2xr(m iodolenmfvia( srrau onu4ale ii3tad s rmumo t)texomfctydoaDraueo;(  etr(r iydap elnvtl() rtaxmpno4aexnio3tatlm rln p t0arenmfciydlptr n o;s)texrxmpiy4al nlict t) Drr(mpou4aeto fctlsla elnmsnu4tlermr3iydopt  n o (0t2tm(o3oo1lmt lneils sDtaur ;o0aeeomfetlt s2rmn p t4teerxf oytlpD  ies s0srxrir3no1oltelfet (f Dururpno4tee io3iatfs2elu s u)treomr3oo1fpDrlnvs s)trto(opiudole mieslt) Drrx p;t0tpe  fetat aDumu p;u4 renxr3iy1fmt  ivi (0truo(m3no1ol nliei ( sDrrx p;u1tetn oetlsfs2um( o;(4alxnxo iatlmD lu s () 2uoxo nodalt  iesa( srtm(r ;u0apx mociadfs2ulu s t0trxnmf3totfm elueil( seurxm3nydlp n nvi s aDumxmp;u0tptoioetltlaDemn pn(4 rxoifcoy1oaD  n o;s)t2trxrpiydam nliet ( srtr( pnu1ope  ieiys m em(vp (0trtnir3iodoaD  i olt  ruriopny1ale mncilt arrrx oot0optomi3tls s rm( p t0tetrmr3iodom  lnvo;(0t2um(o3iy1ll  lnvilt aDurx oou0opxn ieiltlm emuvon(0 eeoxf3iotfmDr i ols)setoxr3ou4lmeelics s) Dra(  ;u4tpt mi3tatlmDrln p (4alxoif3oa1lpt anei;() etoxo ny4lltemictasf Dra(m ou0tpx  octysfm2ranvp;u)alxoio3oo1fp e i s;s)t2toir3ou4lmtemneiat)srtr(  ot1tptnmociatfaDrmn pn(4tlenif3iotoa  aues;s0s2uoirpoy4ap  lfvia(fs2rau o;o1tetoif3ildfaDua( o;(4aeenxf3oatomD anes;t s2trxrpnu1om n ivs s)artaxr ou4opx mfetysla2rlnvont4arxnircoy1fpt livo s0s2trxopiydalenmnvtls)s2trxro;o4oee  feilt m2rmnvo t)altomf3ootlmteai o () exmir3ny4optelicta()aruaxm ;o0optn i3ilsfa em( on(4aeenxocty1fpDr ieilt)sexmxopiy1alt  fei t) rumxmp;t1tetoiieiatla eauvsn()altoif iytopt aivsls) rxmxo3ou1omtn nvs tfarrmxrp;o4tltniociadfs ea( p;(4tleoxr to1faDran ils)srumim ny1olt lncs s) Dumxmonu1aeeomoctytfs ean p;u)alxnxo3ootoptr u ol(0t2tmir iodlmte fvtasfs2raumpoo0opto feiadfm2ran p ()aetrif ta1fp rli o;( srum(mpio4optnmnetls) 2ururp;o0olen i3ilsla2umnms (4teeoir3oy1lpD ai ols)trxoxo iu4apee nvta(f ruau pot1optnmi3tasfmDemnvo u4tlerif3ia1fmtelivs;s) 2umir3oydol e icia() 2tru  nu4aptn o3iys a2ranvo t0aetnmrcoatlp r nvo;s  2xriopoudlptn fcs (faDrmumoou1teeoii3tydfm uau on()aeerxo iotlaDe nvi;s0t2xrxo io1alt mivi s s2uaum ;t0aee ioetldls2emnvon(4 lxrio io1fp eauvo t t2toxrpoydol  mietls sDtmx  ;t4opt  fciad s ea(vo;u) eenmociotop r ivols) rtrirpiodlptemietlt) 2um(mpoo0tlen fciyslsDumn pn(4tltomfciatlpDr nvo s t2urxmpiodalt micias s2tru pno1oexn feildfa ran onu0 exrmf iydlaDrau s (0 etr(r ny1amtelieta(faDua( p;t0oetomfeilslmDem(ms;()treomrcta1faD lu s;()t2trim3io4ape lncil( aDtrumpno4tltn oetlsfs ra(mpn(4trerir3oadopteau s;s  2uo(mpiydaptemnvtl(fs2taxrp;o4oeen iciadfm ul(mpnu4arenxfctydlp eaueslt  rtm(m3oodopte neilt)aDrrxrp;o0tee mfciys mDrmuvpnu4trtomf3tytfaDrluvo s t2umir3oo4ome  nvsasf 2rrxmo;u0oexomictatfs2emnmo t0tlxrir ia1lpte ieo s)tetrxr3iu1amen neiatf Drr(  ;u0tpxnioeiyd m um(von(0trxnxf3iatoaDran o t)srtoiopnodlp elictls)s2taxmonu4apxnmfetydls2rm( o;(0 renxf iy1la e nvil()truoim ou4lm nmnctltfaDraxm nu4tltomfeiysfa2umump;(0 eenxociotfp  anvo;t0srtrimpny4altelivs tfa2trx  ot0tlxnif3iydfa el(vsnt) lerif oa1fm eai s t) rxrio nudalenlnes ( a2rau  ot4ape io3iat mDem(ms;u0 rxnircoa1fmDrauvo ()sexrxr io4omt  nci s s2uaumoot1apxoioetad aDumu snu0arxnmr3io1fatrlivol(0srxo(r3oo4lp nliesatf 2trumoou1aee iociat m2rmnvs t0 rtnio3tydopDean s;t srto(o oo4al emicilt s2rmuronu1oeto ictldfsDran pnt0 rxnxfcio1lptr uvilt)teumxo3ny4altnlicias sDua(  oo4opxoifeiyd m rm(vs;t) ltoxf3tydfp  an s;t s2to(opiu4apen nvsat  2rmxmooo4opxnifeild sDuau p u) lxrxfcty1opt lies ( sexoirpio1alen ictas aDumxr oo4tee  octltls2uauvo (0tltrif3oa1lpt  ivsls  eumxr iu4aleelfeiatf Drm(mpoo0opx if3ildls2rm(vo (0trerxfctotfa   ies t0sexmxopoo1ope lieslt)aDumu onu1oee  ictysla rm(msnu0tlxnmrctotoa  lnvsl( t2umxo3ou4lmtnmfet sfs2uaxm nu0oetnifciyd a ean s;()teerxf oatfpteanes ()srxoxmpoo1lmeelici t  Dtru ono4tpe ifcild a rl( o;(4trtoif tatom   ies;t s2xmxm oydlptnlfcta(fa2ra(m nt1tleoifctadfaDumn p u0 ltoio3ty1lmt ln ol() rurxmpio4omenmivi (fs2tr( pnu1alxnio3iadfaDumu s t0teeoif ta1faDranvs s0sexoim oudlpee nvslsf rrmxmpno4aeeoioeiytfsDrmuvpn(4alenxr iytlatrauvs t  ruoirpiodalte ieilt aDtaxr ou4aetoii3iydfsDeanmp t)teerir oa1omtelu o t)trumxm iydll nmfvtat)srtru  ot0apenifctas a2umums (4trxnmr3oytoatrlivo;s t2uoirpoy4om e ieilsfaDrmxrpnt0alt  i3ildfsDranvp;()aeeoxf3ty1fa eaueo;s0sexoiopiodap e ietl() 2ta(rpnu1opeomi3ilslm umumpn() rtnioctydfa rlu sl(0sexrio iy1aleelfvta(f rtrxm ot1ale iieias s2uluvs (4tetomf oa1oa r n o t0seuoxm3oo4om nmivs () rur(mpoo4olxo fctatfsDuluvp (4 lxoioctodlpDranvo;s0s2tmxr3iydlpt livils sDtm( o;o4olt  ieiatla eluvs;u) exnxo iatom  aiei;s  2urxm3oy4lpe  fct tf rrmu pou1tlxnmiciytlaDrauvpn(4trxoxf oatoate n ilt  2ur(m3ny4lleemfes t)s2ur(ro;u0optn feiad sDuluvp;u4tltrxf3io1op  li i t)teuo(o3no4lm  lneias a2ra(rp;t4tpeoioetad mDraump;t)altrxfcoatomtrlivi s0teumxo no1amtnlfcslt  2urur nu1tpxomi3iyt a ul(von(4tetoxo3iodlm eli slt0tetrxo3iydapt lfesa()aDurx  no0tlx moeiaslmDeaumon(0arxomo oadlmt  ivo s  ruoio3oo1altnlfes (fsDurx  ou1tltoii3ilt a2um(vs;(0texnmf oo1fp   ivslt0 etm(o no4am   fcslt)srrm(monu1olt  oeiltls2uan sn(4tetrxf oatomDr ieols)truo(m nu1altnmfvsl() 2raur no1oleoif3tad aDrmn p t4altnif3iodopD auvo s) 2toimpoudlmeelfciltfaDuax  oo4alt ii3iad aDuau o ()texnmo3iatla eai ols texmimpiydam emivia(f 2tau ono1apxoifeilsfs2rmnmp t)tetnxo iy1fm rlnvi t0 rum(r3iy4ll  lfvs (  rumumpou0apto i3tytlsDrl( p;t0 exoxf tytoa eluei s0seumim3ou1llt lfesat arra( pou4oex mfcild a ulu o;u0alxnir3iotfaD livi () exrxo3nu4opte nesa(fs2rrxmo;o0alx mictldls2ean sn(0teeoxr3iodfatelivs (0sruoir3iy1lm nlfetlt) rur(mont4tleniieiadls2ua( o u4alenmr3tydfm rli slt) ruo(m3nu1ameelivilt)s2rmxro;u0opx  oeiltla rauvsn(0 etoxf oatfm  aieilt trtmxopoudap   fctlt)a2tm(moou4olx mo3iatfm uauvo;u)trxnmr3tydfaDeaueslt  rxrio nydop emfeta()srtaxr ;o4alxoioctld s2rau onu4 lxnmocoadfptr uvilt) rurimpnu1opeelnvtatf Dtr(moot0aptn fctas aDulump (4alxnmociadfp  lueilt  rurxo3io1ol elicsl( sDtmumoot0tlxomietldla uln o u0tetrifcoytfmt liei t)t2urxrpoy1ameelfesltf 2taxmp;u4aexn icils a elnmon(0alxoxfcoatfmt  uvslt setr(mpoudom nmfciltfaDraur oo0alt  fcildla ean s u4arxnxr3oa1fpDr n ilt0 2tmio ou4oltn nes s srtr( oou1olxn ictat a2umnvo u4 renifcoatlat li i;t0s2tmim ny1aptemnvsls srtmx poo0oltnmfeiyt sDrlu s;t0teermrcoadfaDeauvs;s0s2xoxmpiu4ameeliesa( a2tm(m ;u4olx mfciydfs eau o;t4 ltnmocty1laDeanvs s)trurxm nudomeelics t sDtm(mpno4olxn ieiatfm2rlu pnt) etrxo tydopt  nesl()s2uoxrpny4alee fesl()arrmx  no1tlenifeiydfaDea(vo (0 rxnmf3iytlmDrln i;( s2urxmpio1alt mfetat)arta(mooo0altn iciyt m uaumo;u0tetrxfctadop rlnei (0srxoxm oydopenlfvt sfa2um(m ot1tpe io3iaslaDrl( s;(0tetrxoctydfatraueol()tetoimpou1amtemnvtls arrrxmoot1olxoii3iadla ulnmsnu0 etnxrciadfat anvo;t t2xoxr3no4ap nlivtas)artmx pot1tpxnio3ildfm2emnvsnu)aetnxfctadoaD li i ( trtoim oy1op n nctasfsDrrum ;t1teeomf3tld m2ul( p;u0teenxrciytomteaivo t)s2tr(r3nudal n icslsfsrtm(  ;o4oltoiictysla rmnmo;u)arxoif3oatlateanes;t) rxmio3nydapenmicia( aDraumont4altomo3tat s2uau s;(0 eeomr totfaDe ivs s)trtoimpio4lleelfvs ( a2taum nu1altnmo3iyd s2emnms;t4trerio3todfp  au s;t0t2toirpoo4apenlfeils  rrr( ono0tlxoii3tasfm um(vo;(0teenio3iatfp eaieolt0s2uoxm3ou4amtemiviat  Draumo;t4tpx iociad sDelnmp (0 etoxf oydlpteai s;s texo(r3iy4ap  mfcsat s2um( ooo4aet mo3tyt s um(vs;u0 exrxr to1fpDeai i;(0 rxo(o nodllenliesatf Dtrurpou4ale mocildlmDua(mon(0 etrio oo1late nvs;( seumiopio4amee ietas)s2urx pnt4apxn o3iydfsDrmuvs;t) exrio oo1lm eaneolt srtrim oo1amtnmfetas)s2tm(rooo4tpxo i3tltlaDrln o;u)aexnmf tytfp  ai i t s2toxm3no1apt  fetl() Dua(rp;u1teen ociatlm2rlnvo u) exnmr oo1fptran i;t trxmxr ou1aptemnei t)sDrr(  nu4alxnmieiadfm2uan p (4texnif3oytfm e i s s  2um(r oy1ap n icsas) 2uau poo4apxniocildlm2rlnmpn(4tlxrir oadoat anvi;s)teuoxo3ou4lpenmfcs (faruau p;o1texnmi3iltla eanvsnu) eenmr3oo1lmtrlivs;s)t2xoxo3oy4lpen nvi t) 2tmxmoot4ale miciltfs2umuvp (0teermf ty1fpteanvs;t0 2xr(o ny4amtemfvilt  rrmx ono1olxomieilslm2eau s;u4 rermo3iadomDrli sl()trxoio3io4lmtemnct () Drrx  ;t0oee  icilt m um(mon(0 reomr3iytlmDe i o;( s2xmio3nydlpt lfvs t)sDtax pnt4aeto ociadfmDrm(mo u0tlxrir3oadfp  aueols sexm(m oydap n nctlt) rraur oo4aptnmoctlsla um( s u4aetnxo3tydfpDraueslt0seumiopno4optelncslt)aDrax o;o0aleoifetldla2umumsnt4areriocoodfptr nei;s0srtmiopiy1lp e ncsa(f rtau  ;t4alen oeiad a rmn snt0texoio3totom  auvs;t trtoxrpou4amtnmfesatfs2ra(  ou1aexnif3ild s2rm(vo t)tltoifctatoa   ueo s)texo(o3no1lm  lfei tfaDuax o;u1apxnifciltlaDua(vsn(0trtrio oatfateauvo s0 2toim3nu4lp   fesat)s2um(rpnt1aeto feiyslsDrluvsn(0teeriociatlp r i i t) exo(r3no1ol nlfeslt)a2um( pno0alenmf3iysfa ranvs;u0 lenmfcoytlat aies s0 etrxm3nu1alen fctas)aDtmum nu0oex moetytlsDulnmo () ltriociodlatelu o t)tetmxr nydlpt lfvt t s2ra(rpoo0tltomocils sDraums u)arxniociadfm rluei;t0truoxr3oo4lpenmfcil(  rraxm ;o0tetomi3ils m uauvo;u0aexnmo3oo1omDeluvs (0setr(rpiy4omenmnei s aDrmx o;o0tet micils a rlnvpnt4tlenmf todoptelueils  2tm(opoo1lmtelieils)srum(r oo1oex moeilsfa2el(mo;u)aleoxo to1lpteaneo;t t2to(r oo4lle  fvsatfaDtrxrooo0tle  fcilsfa rmnvp;()tltrmoctatla r ivolt teuo(m nydole mfes s srumxrpno0tleoiictyt m uau snt0tleoxocoydoateluvi;(0 eur(m iu4oleemiei ()sDururpnu1tltn f3ils sDel(vonu0altoxr3oodoaDe ueo;( texoir ny4ol emfetasfarra(  ;u1apxoifctytlm2rl(mon()arerxr3todlatelu sls0trxoir iu4lp e ietls)artaur ;o0tlxomfcias mDeaums u4 leomo3iytfaDelivils)s2to(mpoo1op   ivi tfsrur(rpot4aex if3tldfmDel(vpnt4tlxoxrctotopt ai o t) exoxm3io4op nlfvtls) rrruro;t0tltnii3tyd a rmnvo;u4 ltnmf iatfm  aivi ()teuoir3ny1amtn iei t a2taumont1tpeomicildlmDraums;(0 rtoxrcoa1om eaueols)teur(m3nodoptelfcsat)a2trx  ou0tet mfciadfa elnms;u)alxnir ta1fmt aies;(0 2trio iy4omenlivia()a2uaumpnu4tpe  ictysfaDua( s (0trxnir iytfm rauvs;s srtrxm3oo1ol nmnvtlsf Drmu  no1tleomiciys s uaums;u4trxomr3oodlmDranvo;()sruoimpnu4ome mietatf 2umxro;t1oeto fetytfs rmumpn()trtomr3oatlp rli sls)t2uoir3iy4aptelnvtlt  2umx p;o1tlt iietytlmDrln on()alxnxo3iytlaDrluvo;( t2tmio iu1lltelncia( s2um(  nu4teenmi3iad m ulnvp u4alenmr ta1lpD aiei;(0 rxoxr3ny4al e fvs s a2rm(rpnu4opxn iciyd mDum( s;t0 rtnioctytoa rlnvils)s2xrir ou4altnmfesls srrax pou1aptnmoeilslaDemnvont)aeenmf3iydlp eauvolt)trurio3iy4lleemncil(  2ua(r ;t0tltnifeiysfsDel(ms t4 lxnxf3iydlmtrlueilt)trum(o ny1lm  miviat)aDrm(rpou4oee mo3iatls2el( p t)trenxo oodfat  nvi;()trxmirpoy4amt  iesasf Drrxmpoo1apenmfeiatlm2ulnvs t) rerxr3ty1fp  luvs s0t2xo(opoo4amt liei t  2tm(  ;t1tee if3ils sDra(mo u4trxoxr oadomDeau s;s0t2xrimpoo1llenmfciasfsrraurp;o4aexn fcildlaDrm(mo;()alenmo3oy1laDrluvs s)setm(rpoy4omt  fviltfa2rmu o;u1altn icildfmDuanvpn(0 exoircoa1omteluvs s0srtoxr ny4lp   nct s a2trxrpoo1ole if3iatls elnmpnu)trxoifciadfpDeli o ( sexrir nu1op nmfvsls) Dtm(mo;u0oetoifciydfm eauvp t4 exrmocoytoa e u i s)setoim3oy1ol nmivsas)arrmxmpou4tex mfeiytls el(vpn(4trtnxr oo1laDrln ils0t2umxm3nu4llte ietasf 2ururont4aeeoii3iltls ranmo;t)tetnxr io1fpteauvo (0 2toxm3nu1ameelici (  rrm( poo0opeoiocils a eau ont4 rxnmf ia1fm  lnvs s  rtr(mpny4amt lnetas)sDtm(rpot4openii3ildlaDrmumo t)trtrxrctatoaD lies ( trtrirpnodaltnmfci ( s2uax  ou1oeenioetydfaDumnvsnt) ltnxfcta1lp  aivilt0trtrimpiy1lp nmieilt) 2tmxm no4tex mf3tydfm2ul( onu0alxniociotoa r i slt t2xrxrpoy4lle  nvt sf 2taumpnt1tpenmo3iltfmDumuvp ()aeeoio3totlpteaueo;s0seum(r3nu1lltemfes ()sDrmu pnu0alt  oeiyt m raump;t)aetnmf iatop eau o () rtoim iy4omt  ivtat aDtaumo;o4oeeomietldfmDrlums t)trtomo iotlm  aivs;t0srumimpny4lp elnviat)arrmx poo0apenifciatlmDemuvpnu)aetrifcoo1fpt  neil()trto(r3nu4om nlieils  rurump;u4olto oetat a2uan ont4tlxomrciy1fm eanvsl(0t2xrir iy1omte ncia(farra(rp;t1tex ifeias m2umuvs;u4teeoif3ootlaDe uvilt  rtrirpno4lm   ieiasfartaxr nu0opeo iciaslm2rmnmo;u0arenxo oadfatrai i (0t2toiopiudap  mfesl()aDrmu  ot0opxo iciysfm2eanvsnu4tltnir totfmt  ues s) 2tm(mpnu4amte iesl(fsrrmx ont4aptomociltlsDranmp;u4aetoxrcoa1fpDeai o;t)t2xm(r3no4lle  ictatfarrmx p;t1aex io3tydla eanms;u)aetniociydomD anei ( trtmxr nydal  mnviat  rtr( o;o1teeomoeilsfm uan snu) ltoxf3oo1fa e n i;t  rumio iydlpte fvtat) Dumumono1tpto feiytfm elnms (0 renmoctydoptr n i s  eumio3iudlmtelieta(fsrua(mpno1opx iieiydfm ea(von() leomrciadlmD livs;s) eumiopio1altnlfeilt)s2rm(mpoo0opx mo3ilt m2um(vsnu) ltomr3ta1fpteanes;s  exoir3oudop  lics tf rtmuronu4tltomoetlt a2eluvo;(4artomf3tadfa eaueilt)seuo(opiu4op n ivils) Drrur nu0oetn feiadfm2ean s;u)tetoiocootlp  aivolt seuoxo3ny4lmenmncs ( artau ono4alxn f3iyd s raump;u4arenxf ootfa eanvilt0texrxm iydape  ivt tfs2umump;t0ape  o3tyslaDelnmsn(4teermo3todoaDrlnvo s setmxm3oodap emnvta(fsDtrxro;o1ale ifciysla uanvont0 lxomrctodlpD  ivs;s)trxrirpio4om  mnesas)srumxrp;u1oeto i3iad sDranvpnt4teeomo3oytomt aies (  2trxmpiu1lm emivtl()s2ua(moot0tpxn ocildls2em(vs;() ltrmo3oytfatean o (0t2xoxr oy4lpee fet ()arurur ;o0tpxnmoeilt aDra(mo (0 eenio oydfat lneols)sexm(m iu4apt  nvs s  2ur( o;u0aptniictatfa2rmnmo u4altoir3to1lat  ueilt0sexrio oy1oleemiviltf rrrxrp;u4openiicilt a rmuvo t4 lenxo ty1fp eln o t0s2trxopiodale mnvt sf rtm(  ot4tlxo fetytfa ulnmpn(4tlxnircoodfate i i t s2uo(mpnudamenlfciat)s2ua(monu1tptnio3iasfm2umumo;(4aexnxo oytlatrluvils) rum(mpou1lmt lfvta(fsrrrurpoo0teenmieiydlmDuluvp t4 lxomo3tatoaDelu i t s2xmio3iy1ll nmfvsl()arrm(ro;o0oetn fciysfa2ua(ms t0texrmfciotfm r nesl(0tetm(opno4aptnmfvs tfsrrrx o;t4aeenmiciasfaDrmuvonu) exrircta1fat an s (0trtoio nu4lmtnmies t sDtm( ono1alt mf3iytfm2um(vpnt0 lermocoy1fptrau o s0 2tmxo iu1amen ivils)aDumxr ;o0teenmoeiydlsDrmuvp t4aetomf3iytlpt an ols0teum(r3iu1lp n ivsl( s2taxrpno4tleomi3iatlmDrl(mon(4areniociotopt  nvilt) eur(mpny1am nmfctltfaDrrxr ;u1tle mfetasls2ua(msnt4tlxrxo ty1op eau slt)s2tm(m3iydomtnlfvi s s2uax pou1aptnifciasfm2umuvp;t4alxnmfcoytlm r neolt0texr(opoo1lp   fviat)arurxm no4tee  fetytls uln p;u)aeenxr tytfaDeanes;t0srum(r3nudamte ncta() ruau p;o1opxn i3tasla2el( o () etrxf oodlmt luvsls)sexm(rpoo4al elneil() 2raur ;u1alxniociytlaDea(vp;()alxrmr io1oaD auvi;s sexoxo3oodll n nvtls s2urxm ;u1altnmietatls eaumsnu)trxoxocio1faDeliei;( srtr(rpou1ale mfct (f 2ua(m no4aet  o3iltfm2rmnvs;() lxnmo3io1fp rli i;(0 rtm(m ou1op elieiatfarrrx ooo0apx mo3iys sDranvo;t4areomo todlmteau o;t  2xoim3oy1omtelfvi (fsDrax  ;o1ole  fctldfm rlu p (4aetomr iadopteaueil( srxo(rpou1lpee ici (f 2tru  nu1oeen octls s ulumpnt4 reoxf3oatfa eli o s t2tmio3oudapeemfcsl() rtmur no4tpto ociytla ra(vo;t0 lerxr iodlate i slt tetrxr nydomtemfvt s artaxm ;u4oleo i3ildfa2rmu p;u0 reoxr ta1fmtrlivolt0sexr(o3io1om emfesa() rtm(mpno4tpenmf3iadlaDemuvp;(0tetrxoctydopD luvi;s0setoxm nu4amt lnetl()arra(r nt4oexnmfctasfaDemnvs;(4arxnmocia1lmD lnvs;s t2trxo3oy1ome mnvtasfarumuro;o4tltn fciasfs elnmpnt4tetnmo tatfmt lneo s)seumxopio1lleelncs s)sDrmur oo1olx miciysfa emuvont4 eermfcta1lmDr ues ( t2trxm ny1lm e fct s) ruaumono4aptomoetat m rm( pn() eenifciadoatelu ils)trxmxm io1opt livta( aDtrur oo4oex  ietyslmDea(vs;t)trxrmrctytlpt  u o t srtrir io1amt mnvsa() 2tmxm ;o1tptoif3tlt s umnvp u)alxrmrcoytoptr n ol( t2uoirpiodll elfesl()a2ta( ono1tlt  f3tadla2ranvp;u)trtrir3ty1om r u o t0s2xmxm3oy1lltnmietat)a2um(r ou1olt miciytfaDrmnvonu)aetoxo3iy1fpDe uvo t0srxmir ny4apenlieia()s2rax p;o4aee moeiys s2umump;(0aeenmo oo1fpDe ivol(0 exrxo ou4opte nvtls arrax o;t0teen ieildlm2ua(von(4 lxnxrcoadfatelnvi;s s2to(r3no1ole  fct t  rtr(mpou0apt  o3iadfsDemu p ()teenmr3ia1fat lnes s srto(o3iu4lmtnmics t) rtr( pnt1tlx  f3tyd aDumumont4aeenif3iytlate nvo;t)srtoir3nydal  mfvta(  rur(m nt1tlenii3tad mDean p;(4tetrxr todlmDranvols0s2tm(r3oo1lp  lfviat)aruru p;o0tptn iciysfsDuanvs;u) rxoio3iodlmte i s (  euoir3oy1lltemfctls)srtrum nt0oee mi3iad a ea( p t)alerxf3iy1laD  n olt)srxm(opiydal   ivia(fs2taumo;o0oltn i3iatfm rm(von(0aleoxo3iytfm  luvs s srxoio nodoptemneil(fsrrrx pot4olxnii3iltfm eanvs;t0tltnif oa1lm eanvs;t t2xmxr3nu4optn ncs (f rra(r ot1opx ii3tldfs uau ont)texnmfcootlmDeau i s0 2uo(m iu4ole lfvt ( sDrmump;o0aetnioeiydfa2eln p;u4 exrxf3oydfmtelnvs (0 euoim3no1apeemivtl(f 2ta(ro;o4aexn oeiatfmDrln p;(4aeermo oadfate ivols)sexmir no1optnlnetl()a2taxr oo4tlx ifeiltlm2ua( on(0teerxf3iy1fp eli i s srtmim iydalt  ncsa(fsDuaxm no4altoifctyslm2eluvp u)alxomociydom rlueilt) exoxo iudoptnmiesat s2trxr ;o4apx mfetytls2um( s u)tltrxo3to1fm r n o;(0texmio nodllenmfcils)aDrrxm nu1olx  fcilslm ea(mp t)tetrmo3oadlpD luvi;s t2xr(m3io1lm  mfes t)artm( poo1aptn fctlsfaDul( s u0 leoxo iydfmte ivo;()t2uoxr iydam e fctat)s2trxronu0tpenmfciltfm em(mpnt)aeerir io1fmDeluvs;t)t2xrxr3oudom nlncta(fsDrrumpoo4alxomfciasls ul(ms (4 lerio3ootoaDelu s t trxrio3nu1llt lfeias)s2rmurono4aptnifetasla ul(ms (4 reomo3to1fatr ieo s0 etm(rpoy4ome miesasf Drr( poo0apx mfetltls2ua(mon(4trxnir3tatlmt luvo s0s2umxr3no4olt lnesa( arumu p;t1aeeo ieiyd m rlu sn(4artnxo io1oaDe nvs;t)setm(o3nu1lpt  iesa()aDrmxm ;t0apxnmoeiydfa2ranvo u0aexnmf oy1fa e ieilt sruoxo3oudam nmfvsa() Dur(mont4apenmieilsfsDraumpnu0 eeoir oodoatr nvolt)setoim oy4ll emnvtltfaDuaxrooo1olt iictlslm2raumo;u0arxnmocto1lm rln ils0 2ur(m3ny4open nvs tfarrm(mp;o0alen i3iatfmDrmumpnu0 exnircoydoa   ieo s) eumir3iydapte ivias)srtmxrpot4texomfciatfsDrauvonu)alxoxocty1oaDe ivo;t0teuoxmpiy4lpe lnesls) Drmumpot1oeenmfciad s ul(vo t0tltrmfcoy1omtr nvo;s  euo(r3oo1lltnlfcil() rrm(r ;u0olxo octltlsDranmont4treoxrcoa1om  anvi;s0texmxopou1lleemivsl(farurxmpno4aeeo oeiyslaDrl( o;t0 eeoifciatopte i i;()s2umxr no4ameemiesa(fa2uaxmoot0oltnmoctldls2rlumpnt)altomrcoo1faDe nei t)trtmiopiodal e ncs t)sDur(m nu1ape ioeild a ua(mpnu4aetnif to1fpDraueol()tetr(opio4aleemnctat  Drr( poo4apeomietyd a ra(mo;() rxomocootla r uvi t)teum(o oudom n fet s)sDtrurpoo0olto ieiltla em(vs;(0teenio oatoatr nvil() rtrxo3io4llen fvt t sDurxmoou0alt iictasls2rln sn(4areomo3todomt au ol()s2tmxr no1llenliesl() ruauroou0tlxo f3ils s ran p;t)aexnxf tydoa r ueol(0t2xoio3iy1lptn fei s)srur( o;u4tetnifciysls2ea(vp;()trtnmfcia1fpD lu s ( s2trxr3ny4opteliet t sDrrumoot1tet  i3iysfs uauvsnt4 ltrmf3totfpDran i (0t2xm(m iodal   ivil()arua(m oo1oetoiietas aDum(vo;()tltrifcio1lmD lieo;s)teuoxr3no1omt  ivi t  2taumooo4aexoiiciydls rlnmont)arxrmo3iotfaDe ueolt) exm(rpiu1ope lfesasf rtaumo;t4ale ifetls a2ra(vp t0tleomf3oatoat luvi;s trtr(m3oy1aptnlncsat)srra( o;u1teenii3tadlm2em(vo (0alenifcoytlpD luvo t) 2uoirpny4al  mnctl( a2trxrp;o4ole mf3ild s2rm(vsn() leoxfcto1om rln s;t0 exmir3ou1alt  nvsas)aDum( pou4apxomictls sDra(mp (0 rtnxo3iytlm  aivs t)sexoxm iu4ame lnvslsfartmu  ot0oleniietytlmDrmump t0texrir ia1fm ean ols0t2tr(rpnydlme lnctat) rta(m no0texo fciatlm ul(vp u0 exoxf ta1fp e uvs;t0 exr(opoo1al  mfvia(farrm(mo;o4tptoioeilt a2ul(vp u)trerio totfmD li i t t2ur(o3iu1omtelfcs t)aDra( oot4aex mf3tyslm2ran snu)tlxnif oatlm e ivol(0 2xrim3iudll nmiesa()s2urur nu1tetn ietat mDra( snt4 rermr3iatlpDranvo t)trxmiopnu1altnliet sfartrumpoo0opt mo3tlslmDulnvp u0alxnxr ia1op   ieols t2umxopiy1om  lnet ()sDuaumont4optn icias a umn pnu)texrxr totfpte ueol( sexrim3oo4ol   ncta( arrru pno4tetomi3iadfaDrmumpnu)tlenio3ia1lmDeaieol( srtrir oodol  lfvt s  Draxmooo0texo f3iytfm um(vsn(4tleoio oatfmDe nvi t texo(o3nydop e iei tfsDra(rp;t1ape  feiasfa2uaums;(0arerxr iadfpDean o;(0 rxrxo3no4om  lies sfaDtr(ro;u4tpxn oeiydfaDem(vo (0teenio ty1op rauvo;s s2ur(r3oudam elnesasfs2umum oo4tpt mfcildfa rl(vpnt4trtnxr tydlm  auvs t)t2toxo3no4am nmfeilsfsrra(mooo0aeeomo3tasls ean s ()tltoxr tadfptrluvo t) 2xm(o3io4ole mfesatfaDtm(mooo4oeeoiietat s rm(vs u4 etnmociotlmD au il(0 2toxrpiu1omtnmfei s)artaxm nu0apx mo3tyd sDra(mpnu0aexnxfctytfa  luvi t trto(o3io4amtn fesas srtax ono4ale  i3tlt s eauvo;t4 rtoif3totlmDrai o s)tetmxr no1lleelictat)arrmx  nu1aetn feilsfm2rmnvon(4texnio3oa1omtr i s;s) 2xrxr nu1lp nmiesls)s2trx p;o1teen feiyt s2ul(vp;(4 rxnio oodoa r ueo s)setrimpiydomeeliet s srtaxro;u0aexn f3ilt aDea(mpnu0tleoxo oo1lpDrliei;(0srxmirpoo1alee feia(fa2umx  ot1alt  oe
\ No newline at end of file
@@ -0,0 +1 @@
+u o;()texmir3oy1lmt  ivs sf 2ur(m ot4aex ifeiatls rmu s;t0 eeomo tadomDr uvolt) eum(opoudomt lncsls)srrm(r nu0teeo ieias m2ranmsnt4texnir3iy1fpDelu i;(0 euo(o iy4amenmivsls)arum(ronu1aptn i3iysfsDuan pnu4 eeomf ta1laDr uvs;(0seurxm nu4ol  lietlt  2rrxmp;u0oee moetatfs2emnmp () lxnir ta1fptrlnes t)s2trio iu1amt  fvi t  rra(m ou1olxn ieildfmDeaumpn(0areoio ta1la rau ol( trtoir oydlmt  ivtl(  rur( o;t4opeomfciltfm2eaums t0 renxoctotom  aies t t2xoimpoudll  lnvta(f 2trxmo;t4tpxnmictadfmDumn sn(0 ltoxo todopDe nei;s s2toxr nodamenliei s  2uauro;t1aexnioeild sDemu pnu4alxrmo3oytlmt aieo ()teumiopiydop   fctatfaDtrxr no1oet io3tatfmDranmp ()aexrmfcty1oaDelueo;t0 2to(mpnu1al   ivsl( sDrr(rpoo4oet mfeiydfa uau pnu4trtomr iy1lmDrauvi t trxoxopno1alee ict (fsruaurono1tlt moeiadfm2ulumo;()areoioctodlmt aiesl(0t2uo(opiydomee nvi tf Dtmxmp;o0tpxnii3iydfaDrluvpnu0 rxnir3tadoptrau ils0srxriopnu4altelncsa( aDta(  ;u4tleoioeiydls rlnvont) rtoio3ta1lpt anes (0setoir ou4lleelncs ( srta(rpnu1oetoio3tlslm2ea(vonu4tetrxfctotomtrauvi (0 2toxm3oo4apenmieiasf 2rmuroou4tlxniietls m em( o () rermf ty1fmDrliei () rurirpoy1omtnmfcilt  2ur( p;t1ope mo3tyd a2el( s ()tlxrxo3tydlmtelnesls seto(opiu4ape lnvs s aDta(moou4aee  fetytfm ua(vo t)alerirciydlmt aiei;(  2toiopoo4olee netltfsDrax pot0aex  ocilt sDrauvp u)teeoxo3oo1la rlu i;(0 2xoxr3iu1amee ivilt) rrr(rp;o0tex ii3iysfa rmu p;(4aetnmfcty1lmD  n sl()t2toirpny1apt mnciltf 2rm(mp;u4opx  feiysfsDua( s u0arxrifcootfptraivslt  rumxo3iu4llte ivtlt) rtaurpnt4apt ifciaslm2rl( s;(0trtnmr iytfat aivs;s) 2tr(o3oudomee nctatfa2uaurpou0tptoio3tasfa2uluvs;t0 rermocoo1fpDeaieo s0s2umir3nu4lpe  nes ()aDurum no4apt  oeiys mDra(msnu0treriociydlat lieilt) rtoxr3iu1ap nmnci sfa2trum ;o1apx mf3iyd m ea(vs u4 renmf3oo1fp r u il( trxrxrpio1am  mnctlt)srrmx p;u1ole  o3tlt sDumnvsnu0 etoxr3io1fpDraivi;t  exoir ny4lme lfciat s2tau o;o0tle iiciytlmDulnvsn(0tltnif3tydfm rluvo;t  2xriopiy4lm emictlsfs2tm(m ;t4oee mi3iyt sDuanvpnu)texoxrcia1fm   ivo ( s2tr(mpou1am nlncsl( aDtmx onu4tpe  feiad s2umu snu0trtoxfcoodlmDr nvi t t2toir oy1lpte iesas)a2tmu p;u0alxomocild a eaumo;()trxrxf3tydoateli i s  2xm(o oodomtn fvil()s2tm( onu1alxnii3tytlm emu s ()treriocoatopDeai sl( s2xrxrpny1amen fcta()aDrmumo;o0tptn ociatfaDea(mp;u4 rxnxfcia1lmD anvs;(  exrxo nu4omtemieilt)aDraxmpoo4alxomieild a ul(mp (0arxrxo iodfaD  uvsl()trxoim3nodlptelnvt s s2rau  ;o0apeoioetltlmDea(vo;u4 ltomo iydopD auvslt  2xmim3nodomee fvia()aDurxmpoo1olenifciadfaDrau ont) rtrxfcty1omDrai o;( t2tmxrpiy1op elfes s  rtr( ono0tle mfciys a2em( p;t)arxniocoadopDraneo;t)s2urxo oodome lneilt srumu pou0apxnio3iyslmDemnvs t4 lxrircoydoat  u s s)teuo(opoo4ll n netl()arrru  nu4olenmieiadfa2rlu s t0tltrmoctydla eau ilt)t2xm(o iu4al  lncilt s2urxmp;u1tet io3tydfmDranmpnu) eerxr3oadoaDranvi s srxoio iu1llee fci (faDrrxmo;o0texnioetltfa2rauvo (4arxoir oadfmtr nvo;s0s2xrim oy1ome lietl( sDrrumpou0oexnii3tls s umuvs t) eenir io1lm   n ols) 2tmxrpnudop n nvi s  Drru pno1tpeo i3iadfa2rmn p;t)trermf oo1opt li s;() rtmio iu4omtn fct tf Drauro;u1olt mfciytfm ran ont0 etrmr oytfpt  iei s setmirpio4aptnmncs sfsrumxr ot1texomociasls ra( on(4 exnir ia1fp eauei (0 rtrir3ou1olt  fet ()aDtrumo;o4tptnifeiadfa rau o t4altrmo3ta1fmDrln olt0 etmiopiy4lmeelneiatfsDrmur ou4altomoctat s rlu sn(0 renxrcoytlmDrlu s t  2um(r oodomtemictasf rtrxm nt0alx mfcild a umn s (4trerio iatfpteln i;t) rto(r oy4omt mfesls a2rr( onu0tet  fcilslm2uln p;u4tltomr tytfmD  i o;( t2toim3nodaptnmnvtas  rtmx  oo0opxomiciytfm ulumsnu4 exrif totop r ueolt0 2xoiopnudoleemivtl(f Drm( p;u0teto f3iyt aDuan s;t)trtnmfcoa1latelu sl()trum(o3nydoleelieil(fs2raxm oo0olenio3tad m2eau o u4 etrmr iatlatrai slt  exoir oydlmee ieias  2ur(mo;o0aleo ictysfaDuln p (4 etrxr3ty1fmtr uvo;t0t2umxrpiu1llte fvil( srra(monu4oltn ociatfmDeanvo;(4arermocootfaDraiei;s0truo(mpiudap nlfcil(farrmxront0tltnmoctasla eanmpnt0aeenifcoy1fp e i i;( t2toirpny1al  livi (f Dtaump;o0aptn oeiaslmDrlu ont4 exoif3oadoa rlu il(0s2xoxo iydaltnmfetas) 2ta(mp;t1tet iietatls rmn s;u4treomo3todlpDeaiei;s) etrir3iu1opt  icia()aDuru ooo0openifciatfa2raumpn(4artrmo tytfm   ivsl()trum(opiy4lp n fetls aDrmurpou4tltomociydla2uauvo;(4 reoxf tatoatrauvils s2toir3nydomee fesat)srtau  ;t4tlt mfeilt m2eau s (0areoir oy1fp   uvolt)t2xoxr nu1op nmfci (fsrurxm nu1tet iiciltla umuvp t)tlerio3ty1omtrauvslt0texoim nu4oleelnetat arrmumoou0opxnmicilslm uluvp;(0 exomfciydoa rlues t) 2tmxo3nydoleemnes ( s2tr(mo;t1tlto f3iys aDra(mpnu)trxrxrctytlp e u o;s0s2xo(r3nu4al elict (  rrrx  ou0tle mo3iatfs2ua(vont)teerxfcty1oaDr i ol() rxrio oy4aleemictas sDtm( p;u4aeeoifeiadlsDeluvpnu4 rerio3iydfm e uei;(0seto(opoydlleelfeia() Dur(ro;u0opxn o3iat sDran p u4 reomocto1omtr nvo s0 etm(r3ny1ol   fvias a2rax  ;o4tleo ieias m2eau p u4trtnxo iadfmDr neo;t)t2tmxrpio4lltelicsl()sDrm(m ot4alxnio3tysfmDumn pnt)arerir tadlat lnes t0sexrio nu4alen neils)srtau ooo4apenmictyt aDemuvs u0areomf tadfpteluvslt0srtoxr3oy4lle lnciltfsDur(r nu0olx io3iad mDel(msnt0trenxoctadopDeli o;t) 2xoxm nodalt  ivta( sDrm(rpnu1altn fciasla rl(ms u0tleoxociodfpt li sl(0 eurxm oo4amteliviat) Drmxmpnt0olxn feiydlsDrm(ms t0 lxomo3totlm raiei;s sexrimpio1alt mncia(fa2truronu0oetn f3tldls2ulumo;(0trxrxociy1lmt lu o s)srxoiopoydom nmfcils aDtm(m nu1teen octadfs uaump (4alxrxr tatfmt  n o s  eum(rpoy4omeemfctasfs2taumpnu1tee ii3ilsfm rl(vonu) eenmrcootfpt li s;s)s2xm(m3iy1al e ieilt  2rm(  oo4aeeomietls sDea( p t0 rerxo oadomDe uesls)texrir3nudolt  fviat  Duaurpnt0ape  icild mDulumsnu) etnmf tadla rau ilt0 etr(o iu1amee iesls arta(moou4tpx  iciyt a um(msnt0alxnir3iatfmDeli s ( truoio3nydolt  feilsf rtrumoou4ope  oetltfs2elnvs t4arxnif3io1opte uvi s) 2tmim3oydlm e fvtlt) rraxmooo1oex  o3ildfmDrm(mo (0treoxr iytoat aivo s0trtmxo nodope mivtat) rrmumono0aetnmfeiyt a ea(ms;u4tlxrmo io1oa elivilt teuoxo3oudlle lfcs t)srrm(mp;u0ale  ociydfs2rmnmo (0 etomfcio1om  anvols0seuoxmpiudamenmfctl()sDtr( ooo0tetnmietasfmDea( s t0areomrcootfmt anei;s0trum(mpoo4alee nvtl(fsDuaxm ;t1tleo i3ils s2rmump ()tltnxrctodomDraiesls)setrir3ou1oleemfvi sfarraur oo4tltn feilsls2uln o u0arxoif3oy1omte nvs s0srtrirpoodlmt mici tf Drrx oot0aetoif3iyd s emuvpnt0teeoio ootoaDr nesl(  rtmim3nydlle  fcia(fsDrm( ont0opx mociat a raumpn()altnmo3ta1op r uvs t)srurxo3iu1llen ivs s)srrmxrpot1optnioetld s rm(vo;t0 leoxf oadlmtrli o t0 exmim no1amenmfes ()a2tmu  ;t1alto fetyd a2eau s;(4teenio iydlp   uvol(  ruo(o3oodoleelieta( aDrrx ooo4oetoifcias m ua( ont4aetrmo iodoateluvi;t) etmir3ny1omen nvils arumu ooo4tltniictadlmDua(mo;u)texomf3oa1lpte u i s) eum(opou1olte iesl(faDuaxmo;u4oexomieiasla2el(msnu4aetrmf oadop e neols setrir nydoleemnvs ( a2rax  nt
\ No newline at end of file
@@ -0,0 +1 @@
+u ol()t2trio ny1lp  lfvilsfsrtmur ot4oleniocils m elnvs u0 exomo3oytfptrauvilt0sruoio oo1ap elfetas)a2rrxrpot4oltn oeiatfm2elu s;()aeeomociadom ean i t)srumxr ou4op nlnetltfsDrrxro;u0ape moetadlm2rmumo u)trxoxr3iatop r i i;s)t2ur(opnu1lpe lnctas  Dtmu pnu0ape ii3iat aDul(vp t)arxnxo ia1op  ln i t)texm(o3oy4lp nlfes ()arrm( pnu0alxnmociatfsDum( p;t4trtrirctydfptranei;()setriopoudame lncils sDta(  ot1aeto ociyt m em(von(4arxoif iotom rauvo;t teto(o3nu1ome mfet s s2raum ;u1aee  oeiytfsDuanvpnu4 leoif totla elieo (0sexmim iodap n fci t)a2ta(  oo4apt ioetydfm uauvp;(0 lxnxrcoytfm r uvi;s)srumio3oo4llte ivt ( s2tax o;t0alenmocild a ua( s (0arxnmfcto1lat aieo;(0srtmim iy1op n ncs (fsDraumpou1tleoif3iysls2el(ms ()trenxf iatop rli s;s s2xo(rpnydape  fet t)s2rr(  ou4opxniiciysfsDuanmpnu0 lxrxocia1faDeluvils trto(o3nydoleemivtl( a2tmu pou4aet moctltfmDul(vs;(0trenio3ta1lp rluvsls) rum(mpno4ll elivi s  Dtru p;t1oltnio3iat sDumuvpnu4aetoifctydomDran slt0texm(r oy1amtelieil()srrr(rpno0apxoio3iydfsDemu on(0aleoxrcoydoa eaneslt)s2xmxr3oy1om  mfvs ()a2um( ont1aeto i3tad aDul( p;(4artrxfciotfp e u o s s2um(r3nu1amt livi s) 2uaumonu4olto ictadlsDeanmo;() rtoxf iatlm eanvi;s)trtr(o iu4olee nciat s2rrxm nu1tlx  o3iltfaDeauvs (0 lxoxrcio1lmDe nvilt0tetmxm oy1opt lnet t aDrm(ront0altnmieilt mDrmu p (4areoxoctydlpDeli il( t2xo(m ou4ll nmfetat)srurxmonu1alen icildfa rlnvpnt0arxomf tadlm   n i;s0 euoxr iudal e nciat)aDrrx  ot0apenifetys sDean p t0 ltomr tatfm rli o (0 ruoxopiodlltnlivsa() Dumu o;u4tleoioeiltfm2eluvp;u)altrio iadlpD aues;( s2um(o3oudoltnmfvil( a2tm(rpnt1opxo feiadfmDemu s (0alxnmf oy1oa  lu o;(0 2xoio3oudoptnlies (farumu  ou1tptnmf3iatfaDrm(monu0arenxo3tatomDe ues ()sexoxo oudomenmietas)s2trxrooo4olxnmieiltfa ulu snt4tlxrirciytlat anvolt)sruo(o3nodllenlnci tf rumumont1tpeomi3ilt aDemnvp;u0alenmr oodlpDeluvsls0srum(o oydomeelfvsl()sDtmuro;t0aleomo3ias s ulnvsn(4 lxnmrciotfaDeau s (0srtr(m iodaptnlictatfa2rrxro;u4tltniociatls rm(monu4 exrifciatlmteli o;s sexrxo oydopt mnvtatf Drr( oou0oee iiciatls2umuvo () eeoircoadlpteln o t  2xmxo no1altn neil(f Dra(ro;t1tpxoiietatfaDulu on()trtomf3tatlm e ivilt)trxoim3iu1lme  fcia(f 2ua(monu4tpx ifciad a2ran ont4arenio tydoa   neo;t0texm(m iudaptnlncslt)s2umxro;u1aexoifcilt aDrmnvon(0 rtoxf3iatfmDr nvi (  rxr(o3ny4alt  ict sf 2tr(mp;o1oeenioeiat a eln p t)tetrxr3iotomtr n o (0 ruoio3iu4lme  fciltfaDrmumpnt0alxnio3iatlm2rm(mp;(0teerxr ia1fate ueolt sexrxrpio1aleelieiasfarta(mo;o1alt ifciadfm2el( s;(4arenmrctadop   nvslt0s2uo(m3oudol emfvs tfartrxro;o4aex mfeildfsDuln o;(4alxomf iydlpDeai s (  eum(mpiudlpt  nvil(fsrrm(r oo0alenmfeiaslaDel(vp u4tetrif3tatfp e ivol()sexoim nydame  fvsl(fa2trxmpnt4apto fctysfs uanvont)arxnmf3to1fatraivs ()srtrio3no1al elnviat  Dtr(m ;t1olto octls s ulnmp t0 etoir3ia1omtrluvs t trumim oo4opte fvi s artaxrooo0tpt moeiytfmDuluvo;(0treoir3iadom e i sl() 2xmxmpny1amtnlici ()sDumxmpoo0altomf3iasfs uln pnu4 rtrif iatfaDrli i;()tetrxmpnudll nlfcias  Dtaxrpot1tpx if3iadfs2eln p;t)texnmr iadlpt lnei ( teuoxm oy4am e fcsl(fs2taxr ;t1aleniictasfs2em(vpnu)texrif iydom eai s t t2umir3no4lpen netls  rtm(rpoo4opt  icildlsDumnvs;u) eeoxr3iadfa eanei;s) exoxm3oo1lpee fetlt a2ua(ront4aptomo3iyt mDrlnmsn(0trxrif3iatfatr ies s0srur(r oodlpenlivs tf Dua( p;u1alxniiciyt m uan sn(4trtoir3ia1fat auvo;s s2trxopoydll  lfvsat)arra(r nu4teto f3iad mDea( pn()arxnxf3oodopt  n s s0t2toio iodoptnmfcs ()s2rmxmp;u0altnmo3tadlaDemn o;(4aetnmo tydlpt  i s;t  rtrxr3nodapt  fetas sDrauro;t1aetnmo3iytfm rau sn()trenxfciatfaDe u o;t texmxrpiodaleelnetls) 2taxrp;t0tlxn ietas a umu s;(4arxomfctytfa rlivi;( trtoxr3nudlmt mfei s srurxrpoo1apxo o3iltlsDrauvp;(0 rtomo3iotlpDe uvo;(0setmxopiu1opeemnvil(  2umxmp;u4olxnmf3iatlm2ranmsn(0texoio3ootlm rau s s0teum(mpiu1ll e icsas srrm(moot0aleo i3iaslaDemnvsnu4 eenmo ty1fmDeluvi;()s2tm(opio1lpeemfvt ( sDurumo;t4aeeo ocildlmDrmnvo (0aeenio3iotfate i s s t2ur(r3oydome lfvtas)arrrumono4tltn i3iyslm2elnmsn(0trxrmf3iy1fp   u i;()texmiopiu4apt  neil(  Dur(rpoo4olto f3iyd m2rluvs;()tleoir3oydlmteai ils0 2to(o nu4optelnei tf rra(mp;o4tlx if3ilslm2uanmo u4trxnircio1fmDeaiesls) euoxr3ny1omte ici tfs2tmxmoot1alx iictys mDua(mp (4trxrxo3iy1fmtrau ils  rtrirpoy4opte ics s)a2uauro;u1tlt  ictadlaDrmnvs;t) exoxocoa1lmt lies ()t2xrxm3no1ll e fesl(  2tmxmp;t4alxnmfeildlm2rmnmp;() etrirctodlpDraiesls srxo(m3iy1olenlivt s  Draxmp;o1tlx miciasfm2el( onu0teeniocoa1fa e ieols0s2trxr no1om n fvs s)a2rr(m ;t1aetnif3tyt mDemu p;(0 leoxoctotoa  livo ()tetr(opny4llt  icils s2rax oou0alxnif3iatfs2ea( o u4texrmf3tadfm r n ols  2tmxo iu1lm elnet s  2umxmpou1aleo i3ild mDra( snu)treoxr oatfmtelu sls t2xrxopiodam elieias arrmx  ;u0oetomoeiytfsDeluvsnt4treniocoatlpD lnvils  2xmimpnu4lltemfcs (faDua(ront0apx iieiytla eanmont)trenmocoo1fptrlnvo;t)sruoxo nudllt lieia(fartau  ot0teeomo3iadls emuvpnu0aexnmrciodfate u o t tetmir3nu1ll e ics s  2taumpnu0opt ii3iad aDeauvpn() lerxociytlmtraieo;( sruoxo3oy4lmee ivi ( a2tmu  ot4olx  o3tlsfs2rmums;t0 lxnxf ty1lpDraneo;s0setmxmpno4omeemict s)sDumxmoot0olenifcias m ulu o;()aetrmo3iotlp raneil( texo(m3iu4lmenmivtlt) 2uaumpot1ole  fcilt m2umuvs;(4aeenxr3ty1lmtr i i;()srtrir nodol  livsa(fsDum(ronu0aptnmoetyd a2eanvs;u)tltrxf3ta1laDr neo t0t2triopou4ome  ietas) Drmurooo1apxomieiasfaDuln p;t0 eeoxo3tytlmDr neo;s0setrxrpio1apen ivil(f Dur(r nu0oee iocilt m2um( p u0aleoif3iadlatrln il(  euo(r no4am emfcslt  rtrump;o1tlx  oetld s um(msnu4aeerir3tytlatraneil()s2umio3nodapt lies tfsrrm( p;u1oeeomi3tls a ra(mo (0 rtomr3ty1faD ln s;s seuo(opnodap e fci t arua(mp;u0aetn oeiytla rl( s u0tltoxf3oatopDr i ols  2xoxrpiu4lpeelneia( s2rm(moou4apto f3iatfa2ranmp ()arxomr oodlm elueols trtoxr nu4llenlfetlt)sruaurpnt1apt  octlsls em( p u4tltoxo ta1fpD  u olt0texmxo3ny4optnmiet t)a2ua(mo;t4aeto fciasfmDea( o;u0 rxrxrcia1la rai i;(0 etmxo io1olte nvia() rtr(m ;t4ale iocildls ra(vp;()tlenifciy1fp e uvs s tetrir3no4ap n ivia() rumumoou0oee mf3tat sDrmumo;(4 rerir3oadop eln i t0tetoxrpiydlmte neilt)sDtrxrpot0ale mfeild s rmnvs (4trxnmo3tydfm  aueolt)srur(o oodolt  iei ()sDrau o;u0olenio3iys mDul(mont)treomo iydlp e i o s sruo(m3nu4lme  icil( a2umu pnu1tlen o3iyt a2emnms u4aeenmocio1fmDeai o;t)teuoimpnudame  feia( sDrm(rpnu1apenifctad m2rmnvpnu) lxnxr to1fp  aneil()texoxo3no1alenlfesas  Dumx  nu1openmocils aDul(vs;t)artnxr oa1la  auesls0s2umxr oy4ol   ncsas) Dua( poo4olen iciytlaDrlnmpnt)tlxrmrciytomtelnvi s0setoxr3oy4am e nciat  ruaumonu0tle moetaslm2ulnmpnu4 lenifctodoptr nvo (  2toim nydlptemivsa( artrx oou4alt mociyslm elnvo t) leomo3iotfaDean s;(0 ruoimpoydom emivi s a2umuro;t4olt mociadfs rmums;() rxnif tytlp   ies;s) 2xrio oo4aptemfvtlt)aDtax oou4openifeiatfa uau p u0alxrxfciydoaD an olt)teumio oy1alenlnvtatf rraxmp;o4aexoifeildfsDrln onu0tltrxr3iytlaD auvi ( t2tmiopou4alte nvil(  Dtaxrono0alt if3iydfmDrl(mpnu) rerxf tytlate uvi;s)t2toir3ou1alee nvsa()arumu onu4ope ifeiad a2uanms u0altnir iytfp  aivol() rxoiopoudome livtlt  rrru  oo4oetn oeiatfs ra(mo;(0arenxo iotopDr ueo ()trtoxrpoo1lle lnvt t  2urum nt1tleo i3tlsfm2rmn o;(0 leoiocoytfp  aivo ()teuo(m3nydlpe lnvil()aDtm(ro;t4aetniicild m2rm( s u0aexrxf iydfmDe ivs;t) 2tmxm ou1amte ivta()aDtr(mpnu1tptn feiyd aDuaump;(0 lxrmf3oadfmDraieo s srtr(r3nodlpt mivtat sDur(r ;u1alxo oeildlm2eauvpnu0treomo3iatlpteau i;(0srur(rpio1lltnmieil( arumxr nu1alenifeiat sDeln o;t) etnmf oytlpt  nesl(0t2tm(m3ny4opeemnvs s sDuaur ot1tpx mfciltfs elnmsnt0treomr iy1fp raieilt)trtoxo oy4ape mfeiatfs2tm(mpnu1tee mfetadfsDulumon(4 eeoif3todlpte n s;( tetmxr3nydomen iviat  rtm(  ou4alx ii3iyslmDelumon(0arermo tydlatraneo;t0t2uoim3oo4llt lfcs s  Drmxrono0openioetysfm el(mp u4tlxrir3oo1fmDrai i s  etoxo no1olenmnetat aDraxr ;t1aeeniicias sDel(vp (0tlxomr3oatomDe iei s0 rxoir3io1amt mnvilt  2ur( onu0aex moeiasfa em(vs () lerifcio1optraivilt0 eto(m nydaptnlicsat aDrrx  nu1oeenii3ilsfmDua(vsnu) exoxo3iadfmDrai s;s  2trir ou1oltnlnvsas  rrrxm ;u4apt mietadfsDrlu snt4 rtoxfcoy1fpt  uvol()t2xmxm3oydal  lnetl( s2uax  ;t4texomfeils m2umn on() rxrifctydlpt lneol()t2xoio oudaltn fes sfarua(mooo0teeomfeiadla2emuvs (0 exnmocoatop elieo ( s2tr(o ny1op n neslt aDum( p;t0texniicilsla umu ont)trxomfcoydopDe i s;s0tetmxrpiy4lp n ivi sfsDtrx  oo4oeenmf3ild mDean pn() rermrcta1omDelnvs;t0 2xrxr oo4ame lics (  Dum(  nt4tptomictld m eluvo;t0tetnmr iytlmDrlnes;( sexoxopoy1lmeemfctls)sDumu o;o1aptnioeiysfs eauvp;t)alxrxr3ta1oa eaieols) 2urxmpou4am n fvilt) rtrx o;u0oet mo3taslm umuvpnt)arermr oodlm  auvsls0srxoxr iy4lp e nvi tfsDra(rpno1oleomieild m ulu o;u4 etoxf todlp rlu sl(  exmio oo1ape  nvi sfsrrruronu4tptn fcilt s2rm(vp;t)trxomr3iatoaDr u i;t0 2urxr nydopenlfvtltf Dtrxrpoo0tptnifeiyd s eauvs (0tlxrmf tatlaD  i s;()t2tmio3iodap e fetas srtmu ooo1olt mictlt sDrluvp;t0trxnxr tadfp r iei;(0 2toimpiudamen iesl(fsrum(mp;u4ole  ieiatfa ul( snu)tltomr ta1fmtr iesls0seurxr no4lme mfci (faDrmurono0apxnmiciltls2umums (4 rerio3ty1fmDeaies (  exrim ny1ale mieils s2umuroou0tpto fciadlmDuanvpnt)trtnxo3oodoaDeai s (0trumir no1om  livtltfsDuaxr nt0apenii3iys aDumu o;(4aetnxo3tytlpD lies;t0s2uo(r3io1ol nlfeta()srrmu p;o4altniociys m2rluvonu0teenxo3oodfa  luvo (0truoio3ou4omt  ivtas)aDtmur oo0oee ifeiytlm2rmuvp;u4alxrmrciadfpD  uvi () 2tmim oodope  fcta() rraxr ot1ope mo3iat s2rauvs t) leoif3iotomt  ueolt)tetmxrpio4op   nei s)aDumx pot1oltoif3iyt s eluvonu0areoxo3oytoa rlueilt) rxmxo3ou1lp elfcilsfaDrm(mo;o1ale mi3ildlmDelu o;(0arxniocoytlm e uvi;(0 2urxr3no1amt lfetl(f 2trxmpno1oeen feildla em( o;u0artrxoctatomD aneo (0sruoxm oy4lltnlnctlsf rumur ;o1tle ii3tad mDemuvs;t4tetrxr3tadlpDeauei s  2xoxm oy1al emfvia()srraxrono4apxo feiydla uluvo;t4 rtrmo oy1lpD aivo;(0sexoio oudalee icsa()aDrmx ont0alxomi3ildfm2eluvp;u) rtomr3oytla e u o;t  eumiopno4lm n fcsa(f Dtr(mo;t1tptn oeild m um( p;t0texoxr3iotlaDeaueo;s0seum(mpiydolt lfeslt srrauront0tetoioeiaslm2emn s;(4trxnmfctytfmDe iei;t setoio3no1altnlncta(f 2rrx o;o4optoiiciasla raumo u0 ltoxoctodfpt  neols  rtmxr3ny1lmt lnci s)aDum( ooo1oex io3iytfs ua( s t4trenio3oodomD luvo;t  eumio iu1lm emfeia( sDtm( pnu4olt mictad a uln s t0 reomo ia1fp rlu o s0s2toxr oy4oltemfct ( aDtm( pnu1alxnmfeiyt mDulu p u0texnxo3oo1oa raivo;( setm(r3nydam nlfesl(fsDra(root1aexomoetlt s2ran sn(0aleomr3iodoateanei;t t2to(opoo1apt  iesa( arumx ooo1apx  iciatfa2umumo;u4 renmo3tadopDelnvsls0 2tm(o3oodll e fvi tfsDum(root4ole mo3iyslmDranmp;t4 rtrmf3oodopD anvolt)t2tmiopoo1amt lfviatfartmu  nt4tltnmf3iatls raumonu0texrmfctadomDr nvi s t2toio3nydal elncslt)a2rm(r ;t0altniiciyd m um(vsnu0tltnmo3oytlateaiei;s)srum(o oydal  lnvil( s2rrxroot1alxn fcilsfm2uau sn(0 etoxr3tatopteaueo;s0 rtoxmpou1lm elncs sf rtm(mo;o0alt mfeiadls2uanvo;u0 rerxo ootoa rlu o;s)trtoir3oy1aptnmfvt t srum(mo;o4altomieildlsDra(mp t0altrio oy1oatranvolt t2trxrpnodlltnmiviat  2ra(r no1alx ioctad s em(vsn(0aeenio tatfm raivsl( srtr(opnu1olt mnvsls) Drau  ;u4opeo f3tys mDulnms ()aexoxrcoodlaD  ueslt)s2umxopiu1ameemics () Drrum nt0tltnmo3iytfa2elumsnu0 renmrcto1lpDrln i s)sexoxrpny4lp emiciltf 2rr(mont4tle mo3iyt a2em( p t)texrmo ootfaDeau s;(0texoxrpiudoptemnciat a2taxm nu1oeeoifetlsla emn pnt0 leoio3todoptrluesls t2um(o3iodllen feias)aDtmump;t4opt mi3tldla2uau pnu4altrmfctydfmD  ies;t0setrim oy1lm elnvta( s2rruro;o1tlxo oeiytla2emumont)altnmocty1omte n i s s2xm(m3iydolen neta( sDrrxr oo1olxnifcilsla2ran p;(4 ltrmf iydop r n o s0 exr(o oo1lpe lietls arur(r nu1oeeo oeiasfs2raumont0teeniocoatlmD  i ols  rxrxm3no4lptelnciatfs2uru o;t1tpt  ictldlmDrm( p t4 lxomr3io1oaD li ils setmir3oudaltnmfesa(  rtrxrp;o0apeo i3iltls2ulumo;(0aeermo oytoa e i ol()seumxm ou1ll nmnci s artm(  oo4apxnmfeiytls2rlnvp u4trtrio3oo1fp e iesl() eurxr iy1ap emieia(f Drm(mono1tet  i3tadfa ulnms ()altrmociotfptr n ols)seurxmpoodal e feiasfsDtru  ou0oleomoetatfsDul(vo;u) eerxfcoy1lat auvi;() 2um(r oo4ole mfvsa( s2tr(ro;u4tptn f3tad mDul(mp;t4tetrxrciydfa   iei t0setr(r3iy4opeemnctatfs2ur( ooo4tpt moetysla rlu pn() rxrmr3iydlmteln o;t s2uoxmpoydlltelicsls)srua(m ;u4ope  o3tlt a eanvs (4 rtoir3oodlp   nvi s0trxoxopiy4ol nmies () 2ra( ont1oleoii3ilsfm2ua(mon(4 etrmr iy1fmD  ueo;()s2uoim3iu1ope lnvils  Durx  oo4olxnii3tydlmDrmuvs u4 lenxo3to1fm elieo;s s2toio3ny1lm emfesltfsrtr( poo4oltnio3tatfm umn ont) reomf3todopDe ivi t trxm(o3iy4opeemicilt srtr(rp;o4tee mfciytfsDulnvo t4tltoxo3oydomDelu i;t sexmxo oy1al elici s)sDur(rpou4tpxnif3iat s uluvsnu4 exnir3oydlp  lnvs;t0 rxr(r3iu1al elfct s s2uax onu1optnmi3iadlmDuanmo t4 rxrxr3todop   i ols0 2xm(m3iu4lpen fesl( aDta(  ;t1ope  oeiys a ea( p;(0tlerxo oa1opteanvolt0s2um(mpoo4lpeemfetl(  2urxm no0tlt if3tyd s uluvonu4tlermfciadoa r i o;(0trum(r3nudlmenlfcsa(f Dtrxmpou1tpt ii3iysfm2ea( s t)teenxf3ia1fpDelies t0texo(m3io1lpt mivi s aDrmxrooo4oetnifeias a2rauvo ()trtrmf ty1faDe iei;t0t2xoim3ou1amen ivtlsfarrm(  ;u0apt mictasfm2rmnvpnt4arxnxr iatopDr n s s seur(o3oydlltemivslt) Dtmxm ;t1tleo o3iaslmDrauvs;()altnxo3ootfpDelnvsls  etoir3oy1alt mncil(fsrrau oou1aet ifeiltlsDranms u4tetnxf3tytfmtr ueo t)trxoiopnodamtemnetltfarra(m oo1apx mfetat mDulums;() etoif3oytfm r i i;s seumxopoy1olenmnvtl(  Dum(rpnt4tpxomietas mDeln pnt4aetrmfciydoa  ln i t t2urim3nu1lm   nvilt  Duau  nt0oexnmfeildfs2ra(vs;(4alxrxrcoadla elneils)trxmiopio4ol  liesls)artaump;u4olx mieildfaDeln o t)tlxrir3oy1lat au sl()t2xrxo3no1aptelicilsfaDtmxmpnu4aleoif3ils aDuaums;u0 rtnmr3ia1lmtean ilt0 rxmir nudaleelnvias) 2um( poo0opx  ociatls ulumo;u0trenmr3todla raues;(  eurxr iu1aptelici (  rtr(rpnu4tlxo fciasfsDrmnvo;u0texnmocoa1opteauei;t  exm(o no4opte ivtas)srrrur ;u4olxomi3tytfs uanvsn(0tltoir3ootomDeaivolt0srum(r3oy4opee nct ( aDuau ooo1tetoifcildlmDuan o t4texoxf3ootoaDrln i s0 etrxopnu1ap elnci (fsDurur ;u1ope ioeiysfm2ua( onu4trxoxr3oadomDr ieo;t0s2xrxr3iudllt lieia()aDumurpnu4aetn f3tadla2emnmpn(4 rxomo3iotfpDrliei;s0srtmxr nodamt  ivtl(  Dtrxm ;o1texnmf3iat aDua( sn(0tlenif3oa1oa r uvilt teto(r io4ol nlnvil(fsDrmx  no4alxo iciytfm el( sn(0 etrxrctatomDe u o ( seum(o iodaltn neslsfa2uaxm ot1tpe micilsfm uluvs u4tltnmf3oy1lmD lues;t0 exr(r ou4lpeemfeilt)arumum oo0aptnifetytfmDrln o t0 lxnxfcia1lateanvo t0 etrxrpny4lm  lict s) 2rr(  nt4oetnmfeiatfa2um(mo u0texoxr3ia1lpt  nvi;s) ruoxr3ou4ome lfetltfsrur(  no1olenmieiydfm rmnmp u0tltoxr3tydfaDrai i s0t2to(opoudamtnlfesl( sDrm( p;u0apx io3tytls ea(mo;t)trtrxr ia1fpt  i ols) rtr(m iu1lltnlfesa() rumu  ;t1tptnifcildls2rluvpnt) etrxf3oy1oa ean o;t  rxoirpiu1lpen nvt s aDuau  ;t1texoiietas a ean p;u4 lerxo3ia1lm  lu o;s  2xo(rpoo1lmtemict s)a2tru  ;t0optn octydfs2uluvo;(0 exoxo3totoptr ivilt trxoio oy1olt lfvsas s2urump;u4aet mieiys s2umuvs;u)tlxnmf3iytomD anvi s)t2uoim3iodapen fesatfsDtruronu0tlx ioeiasfm ranvp;u0aexnxrciydlm r uei ()trtrirpiu4ameemncils) 2rau pnu1oltn i3iltfsDuluvpn()trxnir3oatfp r i slt) euoxopno1llen ieils)sDtm(rpnu0apx ioeilslmDem(vo t4 etnxo3ta1optrluei;s  rtoxm io4op   nvi s  2rrx o;u0apt  oetadfm emnvon(0 renmo3todopt livs ()trumxopnodapt mfeia( aDrr(rono1oee mo3iatlaDrmuvpnu)texoiocoadom  auvs;t trtoimpiydape  ivi ()srtr( onu1tpx  oeiad a ulnvo;() eeoxfciytfate ieil(  rurxo oo4amtnlnvtlt)s2tauront4texniietlsls2uln s;u)tlxnif3iatfmtrln i;t) rxmir3iydlmte nvt (  rum(ront1olxo f3ilt a2ra(mpnu4tleomr3ty1lat an o t  rtrir no4al elfci s) rurur nu1aetnifciad m2umu o;u) rtoif3iotlpDe n i;t setoio3oodlp n fvt s) rrauronu4texniietaslmDranmp;(0treomf ta1fatrau i;t)trtmxm oodamee feilt aDtmxmpno1tpxomfcilt mDeauvp;() renxoctadlmDelnei;( t2xmxm3iy1lm n ictat) Dtaxmo;u1texomoeilt a2ran pn(4 rerxr iy1fpteauvi t seum(rpoydllee fctas srrmxm oo4alenifctatfm ea(mont4 eeomo tadfmt aivs t)srumirpio4altnlneils sDtrxr ot4alt  o3ilt m2emuvs () exoxr3oa1oaDrlieols)trurxo no4lp nmivsas) 2um(m no4apt moeiasfmDranvpnu0alxrxo3io1oa r ueslt0setmxr3iu4llenlfvt t)aruaxmpno1aet moctldfa raump;t0arxnxr iy1fa eli sl( s2tr(m iydomtnmfetl()sDumu pnu4oetomi3iysfsDul( p ()aeeomo iatfm eluei;s)seurxmpio1olte netat arrax  ot0aeeo oeias m rmuvs;()teermrcoytopDeanvsl()trtoxo nudllt  fvsl(f Drax  ;o1olxn f3iatlm ul(vp t) ltrxr ia1opt lueo t t2uoio3oydame lfeil( a2tmxront0alt mf3ilsfa uauvon(4trtrxr3totfptrlies;t  eum(mpiy4ape mnct s) 2tm(rp;t4tle mfciltfm2rl( o (0 rtrif iydfpDrlieils t2tmxr3iy1olenlfct (faDrr(r ;t4oeto fctlt m emnmo;()aetrmo ty1lp e ues;()t2um(mpou4am elfctltfarta(rpnt4aeenifeiyt m em(mo t4 renir3io1lmte uvs ( seurxr nudalen ieiat a2rmu o;t0ole  o3iydfa2rl( s;(0tetoio3iotfmtrlues;s)trtmxo3iudamtnmfesat)a2rrxrpnt0teeoii3ils mDrluvo;u4texoxr3iatfa e ies (0 etr(r iydal e nvsls)srtru pnu1teto i3tytlm2eaumont0 renioctodfmDeai olt)s2xm(m3ny1om nmivtas a2trxm oo0texnii3ilslmDranvs t0tetnmr ty1omDrln i t) etrimpou1amenmieils)arumxm ;u4aeenifcils sDulums t4 lenmr to1lmt  i s;s0 2xrimpiu1amtemivsl(fsDurur ;o4tpeo octltfs rlu pnu0trxrxf ootlp rlivsl( srxoim nodapte netat s2tmx o;o0tltnmiciysfa2emump;(0arerxo oatlmD lu ols  2xo(m3oo1amtnmici (fsDrmuronu0tpx ifciydlsDum( o;u4 leoxr iadopteauei t0 eur(opio1aptelfctlt) Drmx poo4aleniietydfsDuauvpnt4altrmocty1lmD  u ilt  rxmimpoy4omenlivt s)a2umuro;u1texo ieildlm2rl( on(4alxoxo3tatlpDe uvo;t  etr(r3oy1amenmfvsl() Drr(  ou4olx  oeiytls2ulumo () rxnxo iodlm e ivs;()s2tm(m no1omen ivs sfartru pot0aptnio3tyt a2rl( o (0arxomo iotopDr nvil(0 2xm(m3iu1ole  ietat) Dtrx  ot0ape mo3iaslm2rlnvs;u0 renmo ootfpt  ieol()setm(o3nu1aleemies tfaDtaur ou1alxnmictasfs2umu p u4alerxo ty1lmD an i;s)teuo(r nodll e icils  2umur ;o0oee io3iatfs2rmumo u0texomo3ty1omt li s;(0 exmio oy1om nlictl( srurx  ;u0oeeoifetltfmDra(vpnt4 etrirciotla ran s s0 2uoxr3oodlm   ncsasfs2rrurp;t1oeeo ieiad m umnvonu0trtnmo3todlmDeln s;t0teuo(r oy4ol nmivilt  rrrxrpou1aetnmiciltla ra( s u)texoxoctatop r u i t)srxmxopoo4om nmici t)s2tmxrp;t0tlxnmi3iasls2el( p;t4altoxocootlmD livsl( srxr(o nu1llenlnvs tfaDuax pot1optn octat a rln s;t4 etnxf ty1oa  aneo;()s2xoim oy1aptelfetlt) rtm(mo;u4opeo ieiyslm2eluvo;(0 rxoio3oo1lat auvi t sruoxr nydal nmnetasfs2umu p;t0aexo octlsfsDraumont)trxnif ta1lp e nvs s0 2xmxrpou4omt lnctl(f ruaxmpno1apxn ociysfm rlumon()trenmf tydom r u ilt  2tm(rpiudapeemfvtas aDtaxrpou1altnio3tyslm em(mo t)aexrmf tydfa e uvs (0setr(o3oydlltn ics ( a2ra(r nu1opx  ociyslsDeln p;u4areomrcoatfm rlnvo s texr(o oo1omeemnctltfa2umx oou0ole mietydlsDumn p;t0arxoxocootfmDr nvols t2xrxo oo1opt mncilt  rtr(m no0aetomo3ias a2eln p;(4aeenio oadfmtranvo;s)t2tr(m ny1lp emfct s)srtr( oot4tlx  f3tatfa elnvs u)aexoio ty1la   n i;() rxoxr io1apeeliviltf Drru ont0opt moetlsfs2eanmpnu4treoxfctotlp   nvsls0srurxm3oudomt lfet (fa2uax o;t0alxnifctld mDum(ms (0aetnir tydlmDr ivi t0texmio3iu1ome miei (faDumumo;u4apxn fciytls rau pnt) etnxf tadfpt aivs t)texmirpnu4apenlivi (  rtmxmp;o4tle  oetydfm rm( p;t4aleoxo3iotoaDe i s s0t2xmir iodll  micil( a2um(mp;o4optoiociat mDulnvs t0texnirciadomD auvs;(0t2tm(mpny4lltnlneslsfa2trx onu4apxomieiydla uanmonu)treoirciodlateau slt s2uo(r iy1apt  nei ()aDuaxm ou4apenmf3tadfa ranmp t4trxomr3oy1oaDranesl()teumxm3oudllt livil( arrmxmp;u4apenmieiaslm emump;u0 lxnxo iotfa elnvols) 2toio ou4ol emfctasfaruru  ;u4aptnmoctlslm2el(vp;(0texoxo to1lpte uei s0 2xoxrpio1lle lnetltf Dtax pno4tlx if3iyd a ea(mpn()aeeoxf oytlpD livo;s)s2xrxrpou4opee feil( srua(mpnu1tex  fciysls2elumo;u)aleniocia1fmt an sls0 rtrxo nodal e ivtatfarra(moou4tptnmiciyslm2umnmp u0tlxoircoatfpt lnvilt)sruo(r ou4lpenlnvi () Dur(m ;t4tpto ieiytfm2rmums;t4 eerxf iytlmDran o;(0t2uoxr nydlm n nesasf Dtaump;t4open ieiat s2emuvsn(0trerxo iytlpD an sls0 2xoim3ou1ap nlict sf rraumpou4alx iieiltlaDrmump;u0teenxf oy1laD luvsls0 2xoimpno4olenmfeia( s2rm(  oo0oetn f3tydfa2elnms;t)altoifciadfpDelivi s0tetoimpny4lmeelnesl()sDtaxmp;o1tpe  iciad m2uanvo u4artoxo oy1fa rauvi s0t2trim3io4ape  ici s sruaumpnt1opx mieiltlaDrln p u4aleoio3tadfptr nvil(0trumim iodaptelfviasf 2urxmp;o0ole mo3ilsfaDelu snu4arxrmr3io1omte ivs (0seumio oudomen iesatfs2tmuronu0tet mietys s2eanmpnt0tlxnif oy1oat  nvolt) rtoirpiydllt mivils)arraumpnt1olt iiciat s um(vp t0alerif3oa1lpDrluvs;()sexmxopio1ol emfeias s2trurp;o0teenif3iasls2rmu s;u) lerxo3oatfatrlueslt s2toio3ou4om nmnvtls srrrx o;u1oexn ocilt a2ra( p t0arenmr tatfmDe ieo;t0srxo(r ou1lpen ici () Durxm ;t4alen o3tadfmDrlnmon() lxomf3ootomt ln ils)s2ur(m oy1lp elfesa( aDtr(m ;u4oeenifciltfmDemn p (4 exoxrcio1omDe neol( t2toxm3oo1ll e nvils)a2urx o;o4alt  ocildfmDelump t0 lenxoctydopD li o;s t2xoxopno1oltn ncta(fsDtrxrooo1oet  oetldfs rmuvp;t0 ltomo iydfmD lu sl(  2tr(rpoudlp   fvsasf 2tmxm nt4aex io3ilsfaDelumo;(0teermrctodoat anvilt)srxmxo oo4apenmiesls a2ua(  no0oee iictysfmDumumsn(4teenmfciotomDrlu s t0truo(o ny4oltemfetlt  2ur(ronu1apenii3iaslm elump;() rtnmo3oytlaDrau sls0tetrirpoudlltemnvtatfaDurx pou1olxnif3iysfaDuaums;t4aexrmf3to1fmte ivols t2xo(m nu1oltelnvi () 2ua(mooo1tetn o3tytfsDrmn p;(0tltrmf ootfmD auvo s s2uoirpiu1ale micslt) Drau pnu0ole iiciadlmDraumont)tltrxf3oo1lpteaiesl( setr(r iu1am n fetl()sDtr(ront4aptnmo3ilsfaDrm(vp;(4aetnmr todlm eli i t trurio nu4ol   fetatfartrum ;o0tpeomoetat m2um( s;u0 eeomociytfaDrauvo;t  exmim3nudoptemnetls  2umxmono1oeto oetad mDra( sn(4tlxrio to1opte i ol(  2toxm nu1optnmict t sDtmur ;o0apxnii3tadfm um(von(4alxrxfcoydfp elivi t0tetmxopiudomt  fvtl() rumu pou4olxo o3tysfm2rluvo;u4alenif3tytop   uvs;(0tetmim ny1olt miciasf 2rm( pot4tetnif3iydls eln sn()aetoxfcoo1oa  livs t  2tm(m3oudamt mietls)arta(mp;u1tlxn feiydlsDrlnvpn()alenif3oo1fm  aueols0s2xmxo3iu1al nmiesa( aDur(root1oetnioeiaslaDuln p u) exoxocty1lmteanvs t0trtmxmpoudape  ict s) Draurpoo1oetn fctldlsDul(mp;u)aexnxr3tytlmDe i o t s2uo(opio4apt lfeilsf 2uax  ;u1tpen fctyd sDea(monu0aexoxr tatla ean i s0 2trim oo4lpeemivt tfsDur(rp;u0tlen f3iyd m2umu p (4aexnmo oa1opD anvs;t)teuo(r3ou1lmt mnci ()srta(rpoo0tlx  o3iat m el(mo;(0 eeoifciytlaDraues;s t2umxm io1omtemnei tfa2umx p;u4tee if3iydfs2rlnmonu) etomo oy1omDelnvsl( sexmxo iudlm n fvtl()srtmuront1olx  feild aDrmu on(4tlenxf iodlmtrau s;s0t2xoio3ny4ameemfvia( artmu pnu4tptnmieiadfs2um(vp;t4arxrmr3to1op r nvolt0 2to(m ny4lm  mnvil( s2taum nu4olxn oeiaslm2ranmp;t4 exnmr3iytoate nvi;()sexrxmpiydap elics s)aDrrxrpoo4tpen ietatla uau snu4tltoirciydlatraivi t0 exrxr oydalt mfviat)sDrrurpno1oeeniociat aDua( o;t0 rtomfcoodfp eli olt0seum(rpiu4lltn ivsat  Dra(moot4texomicias s2em( snu0aleomrciytomD au ol( trtoxr3oy4lme  fctat)arumxro;u4oetn oeiatfa ra(mo t) rerxr3iy1lmDrln i ( trxrio3ou1lm n neilt  Dtmu p;t4tlenmieiatlmDel(ms t4treoif oodlmDeai ils0 2ur(r ou1am  licils a2tax pot1olxnmieiadfsDemums t) lxrmo tatfa ranvo ( srtmir io1ll  lncsat  2trur no4apxo fciadls ul(vonu0 lerir iatfpD lnvo t  eumiopio1lmenlfcta( sDraur ;u0optomfctatla uauvo;t0artnir to1lmDr n i (0seurxmpiu4amtn ict sf 2rm(rp;t0oetnmfeilsfa2rln s;(4trenirciodfat lieilt)s2umxo no1aptelivilt  Dtaumont1tpx mfeils s2em( s (4 etoxo3iytla eli o () rtrxrpoudll nlicsasfaDta(mpou0opx  ociad s2umnvon()trxnifcia1fat aiei s tetrxr nydole mfvtatf Dur( o;t1tex ioetadlsDrl(vsnt4 rtoiociadopt lnei s0s2xmxo3nydome mfeils) rrrx oou0openioeias m2rln on(4arermr ta1omtrauvo;( srurir3ny1opt  icsatf ruauro;o0tleo octydfa ra( s ()trtrxfciatomt lnes t0t2urir3iy1lp  mietlt) Dtaxrpnt4tpe  icilt s ranmon()aleoioctydlptelu s t0teumxo nodlp  lfetlsfa2rmu p;u4optnmociadlmDelnvo t)aetomrcoydlat anvs ()s2uoxr oodam nmietat) 2rmx p;o4apxo ieiys s2rl(vo () ltomo iadlmteauvs;s tetrir3no1am  liei tfs2rmx pno0olxnmfeias s2elump t) eermr3todomt auvi;t) rtoim3ou1amtemnesa() rtrumpot0teto o3iatfsDemu sn(0trxnmocoodfmDrau olt0 eumxr3oodlmt mivsat)a2tau  no1apt  ocias sDeauvsnu0aetrmo3iydomt li o t trurxrpou4ll nlfvia(f Drr(mpou4ole mo3iasfm2uauvp;u0trerif oa1op raiei s0 rtmiopiu4op  mnvtl(f 2umx ooo0opx mi3iaslmDel(mo t4tlenxrcto1fmt an ils) 2um(m3nodapt  iesl(fs2rr(mpno1tetnifetlt m2ulumsn()aeerio3tytlaDr ieilt) euo(o3no4ameelnvil(  Dtm(rp;u4tlxnmociasfs raums;u) rtnxf3oytom rlu s t  2xoxopoo1omee fviatfs2rm(ronu1opxomf3tasla el(vsnu0 lenxr oodoa  anvol( trtmxo3oo4om n icsat)artaxr ou0aetoioeiytlsDeau p;(4 ltnxo3ty1omDrlivo;(0s2xr(opnodamtelnetasfs2trxmpno0opt miciadfm rm(ms (4texnxo oatfmDe ivo t0t2toxm3nu1openlics tfarrr(rpnu1oetnmicilt sDea( s t0artnifcoodoa elueols  rto(opnudlp emfctas a2taur ou0altoiociytfm el(mo;(0trtrmr oa1lpDeau o (  2trir iu1ameelici s)srtaxrp;u4alto oeiyt a ua(mon(0artnxr oytfpD aiei t trxoxo oudlm nlfvsa()sDumum ot1aex ioeiatfa eauvonu0texrxr3iydoatranvo;() etrxrpiy1aptnlfeia()s2rm(mpou0apeomf3tydfaDelnmsn(0 lxnmocta1fp   nvo (0teuoim iodoleelnci (f ruru onu0tlxniieiatfaDua(vsn()trtrxf ty1lmtrau s;s0tetoirpiodamenlivtat)s2rmu  ;t4aet iociasls umumo;u0 eeoir3oodlpDe ivs;(0t2urio iudam  lneia()a2urxm ou0apx iieiltfs2emn o u)trtrmf3oy1lpt ai ilt)truoir3iydopen ivt tf 2taum no4oex mf3iysfs2ea( o;u0 rxomf oadfaD  uvs;(0t2xmimpiu4lmtnlnviat  Dua( o;o4aptoifctasfmDum(vp;(0areomfciy1laDraueil( s2uoxm3ou4lleelnesltf 2rrxr nt4aee mfctatla emumont0aetnxf3tatfmt auvi t  2to(o3oy4ll  micil(fs2trxrpnt0oetn oeilsfa2uanvsnu4texrif3iadfpDeaiei s  rtr(m3iu1op   fcilt arur(rpoo4opt ifeiadla2ranmsnu0 ltoxr3oytlmD  uesl()trxoxo3oo4lle lneil( sDtau o;o1teeoiieild m ul(msn(4alxrxf ta1fp eaneols) rxm(r oy4op n fes tf 2ua(mont1alen ieiat a el(monu0altrmo3ootlat au slt)setoxr3iydlmt lfct t)srrmur ;t4tpx iieiyt m2elnvp (0alxoxf ia1fpte i o s) rxm(r iy4lm nmfct sfa2rmx  ou4aleo f3ild sDrmnvo t0 ltnxfcoy1omD  ivo;(0srtm(rpio4aptn ncsas s2trum ;o4tpe  o3tatlsDemums u0treoxf iodom   nvol(  2tmio3ou1alte ieilt) 2rm(r ;o4oltn ieiaslm2rmu o ()arxrxf3oodfaDr n ol(  exoxm3ny1lpe lies t) rtr(mono1olt  fcilsfa rlnvs t)tlenio3oa1oaD lu slt trumio3oo1ale mneias  rumx ono0tetn octlt aDrmu p u0 ltoircoydfmteli ols) 2to(rpno1lpt livtlt) Durxmont1apx ii3iat sDumnmp t) rermociydlpD an s;(0seto(opoudap  mictlt)sDrm(mooo0teeomictytlsDum( s t0 exomo tytlpDe n o;( texr(mpnudal n fvsltfarrr(mooo4teeoifciys aDrm( p t0aetoircootlpt  u ils0srurxrpiy1am  mnetas) Dururoou1apto ocilslm rlump;t0tlxomr3oa1laDranvil()setmxrpnu1oltelfeiltfsDta(m ;o0optn f3iytfmDuanvp;t0 ltnxf oytfmtr ivi;s) 2toirpoo1om emietls) Dur(m ou1oee ifciasfsDua(mp t0teenxr iodfm rlieo s  2ur(rpny1oltemnct () Drmx o;o4teenmo3iat sDeln s;(4tetrxr3oa1latean i s srtr(mpoo4am  lnes (fsDtru o;o1teeniictad aDulnvo ()alxomr oytlmt aneol(0srurio iy4ap nmiei (  Drm( pot1oltnmi3ias m ea(vp;t0alxoxo ty1op elneil() rxoiopny1lmeelfet ( arrmx  ou0opxoif3tlt sDrl(vs t)trtnio3ootop  liesls s2tmxopiy4lpt mivslt)s2umxrpou1aee ioctytlmDemu s ()areoxo todfmt anes;( srumim3oudlleelncsl()sDrm(  oo4oleo o3tydfs uanvon(4arxrxf3io1oaDrlnei t  eumxmpnydlptnliesltfa2uaum oo4aexnio3iydlm2rlnms;u0tlxrio iatfpDeau o s0srxm(o oy4om elnvsa(f rrmx o;u4tltnifctyslsDuau pnu0 leoif3oydfmt  n s;()tetm(m oodolee ici sfsrraump;u4alxo f3tlt m umnmon(4arxoif ta1fm  anvols  2to(opou1ll   feslt)s2ra(rpot0olt  ictat a2eaump;t) lenxocoodoat anvsls s2tmir oy4ole lfetatfsDrrxroot1aleoif3ias aDumnvo t4altnxrciatop   u i;s0 exr(r ou1ole  ivilsf Dur(ro;t1oetomfeildfaDum(vpn(0tlxrmfcio1fpte i o s)trur(mpoodol nmfeils)sruax ooo4oltniociadfa eln s u4tetrmfcoydlmt  iei;s0 etrxr3io4lmtnlncslt)sDrr(  ;u4tet mfctytla eauvs;t0 ltomo3iy1lmt au o () exrxrpio4lle  ieias)aDumxro;u0apx if3iadfm2ul(ms;u0 exoxr oodla   nvi;s0srxmio nu4llenmnctas  2trum oo0alxn oetaslmDrmn ont0tetrxfcoytfp rln slt0s2tmxr ny4ll  lfvtls)s2umx pou1opxn ocildlsDua( s;u0treoxf3oydoaDeauvsl( sexm(o3nu1opeemici sfsDur( p;u4ole mfeiysfa2rln o (4texnxfciy1lpteanvsl(0t2urim3io1omt mncsl()sDrru ont1alenio3ild mDumn s;u4 rxrxo3iatomD auvs s)sruo(r3nudamtelivtas)aDurumont4ape moetat m2emnvo;t4aeermocty1fp eaiei;t0 eurimpno1open ieilsfs2um(m ou1apeoiieiltfm2uaumont4tltrxr3iytlpDrli s;t tetmim nu1altelfvs s)sDurxronu0opt mfeiys m2eauvpnu0aexomo3oatomDeli i () 2xrirpoudaptn icsl(fs2rax  oo4ape  feiltla ranmp;(0 renmf3tydfptrluvsl()teum(mpoy4lm nlfvsls a2ta( ono0opx ii3iydfmDrau o (0arerxociadom eanvilt  rtmxr oy1lme mnvsa( s2ra(mp;t4tetomieiyt m ranvp;u)teenmoctadoaDelu ilt0 euoim iu1altn netat)sDrau oou4opxo oeiydfaDua(mon(0arerifcoydfmD aieo;( teuo(r3ou1lpt  ics s sruru p;u0oex mfctasfaDrm( onu4trtnxfciy1lm eai o t)s2tmxo nu1apte iesl() rua( p;t4tltnioeilsls rauvp u0 leoir3todfa elies;(0t2urxo ou1altelnviltfaDuru  ou4opxnmo3tasls2elu o;u)trtnmf3ootfp rlivi;(0 2xoir3no4om nmicsat)aDuaxm ;u4aptn i3iytls rmump t)artrxfcto1fp   u i s) rxm(m oy1om nmictls sDra(mooo0apxoii3iltfs2emnms;t0trxoio tytfmtrau s;t0 ruoir3iu1lm emics ()a2umxr ;t1olx  ociysfaDeauvo (4 etnxo3oatfp  lnvolt) eumxr iu4open nvi (fs2uax pno4aexo fciat s ranms;(4 etrmr3iatfpD  n o;t0trtoxr3nu1apt mivilt srrmx ono1opxoiiciasfs2emnmonu0 lxrmoctatop eanvi;t  2urim oy4ale mncia()arua(m ;t1oetoii3tasfm eanms;u0arxrircoo1latr uei;() rtrxrpoo4lptemnvi s  2taumoou1apeoio3ilslsDel(vs u) lxnxo3todfaD aueolt)setoiopny4ame lfcils  Drmumpnu4alx mo3iat s2rau snt0 ltoxfcoadopDe uvi;s)tetmxmpiodamtn ivi () 2rau o;t0tpx  feiadfmDua( p t0arxrmocoy1optelivslt  exm(o3io1omen fci s srraxmo;o1tetoii3iytlaDrln on(4arenif tydlmDe n i;t0t2xm(r3no4opeelictas) rtmx p;t4aetomfeiatfm uanvont4 etnio3oy1op ranvo s trtoio iu4lpen icil( aDurxmpoo0oexomoetasfa2rlu o (0 rtomr iatomtr neslt)trumio nu1alt  ies () Durum no1apxniieiyt a2emumo t4treoio3iytlateau ol(  eurim3nu1lm   neslsfaDtau p;t1tpxnmieild a2eanvo (0texrxo3oo1opD aivil(0teuo(o3iudomenmivils  rtrx o;t1tlto o3ilt s raums;t4aetnmo iy1fmte nvsl( s2xoim3nu1llte nei t)artmur ;t1oee  o3ilsls2em( p u)trtnmf3oy1fpDeluvs t)seumio oy1omen netl(fsrtm(  nu0olto fctlslsDea(ms u4aetnmo oy1oatr nvs s)teurio iu1oleelietatfsrtmu  ou0tlxoiociyslm ra(ms;u4trerxf3oa1fmtr nvs;s t2xo(r3oudalt miei s)sDraurooo0aleo ieils a2ean o u4aexrxr todfm  aivo;(  rxrirpoodal  mnesatf Dtrx  oo1alen feiltfm em( o t4trerxo tytfmt ln s;s0 euo(r iy4oltnmiet (fs2tr(r ot4texo f3ildlm uluvsnt0tltomfcoy1fa eluvo ()setr(r nodlmenlfct (fsDurxmooo0tpt if3ildlaDeauvp;t0aexomo3tytfmtraiei;( teto(opoodlp nmfcta(  2taurp;o1oeto fctytlsDuln pnt0alenifcio1latran s s) exoxrpnydlltn fvtatf Dur(m ;t4alto octatlm2um(vont0artoio tadomDeanei;(  rxmir3nydape  ivsasfarum(rpoo4aetn o3ilsla um(vp;u0texrxfctadoptr u i s0 exoirpny1lpt  iet tfsrrmuront4tpt  fciydfsDem(vp u0tlenmf3iy1lp  lneil()setrio iudllenlfci sfsDraxro;u4alxnio3ils a2em(mo;t)tlxrif iytoa e nvo;(  2toiopiy1optnmfcil()a2tmumono4tpeniociasfa2ul(mp;()tetrmr3oa1lm rluei s  rxmir io1amtnmies s)artrxrooo4oex if3iadfaDum(ms t0 rxnmr oa1fptrlu o () 2tr(o3nu1alt mfesasfartaum nu4apeomfeild mDrlu s;t) rtnmo oytla elies ( t2toxm3no4lp e feiat)aDtru  no4oexo fctytlmDeln p u0tetrmf oy1lp   ueils0t2tm(m3ny1al e ietas)srrm(rono4aexn feiyt sDel(vsnu)artoir tadlp  an olt)s2tr(opnudlm n ivia( s2uru poo0apxn fctatla umumo;t)aleomr totlpteau i ()tetoiopoydaleemfctas  rururo;u1altnmieiytfs2ulumsnu4 eeoircoatoateanvilt teumir3nodlpenmneta( s2ua(mpot1ale  octatlm umn s u4altomr tatfat  iei t)teuriopiu4aptelicta(fa2uaxm nu1apxoifctyt mDumumo t)tlxrio oo1op rliei;s tetmxm iy4lpe livia() rrr(rpnt1tee  iciat s rl(ms;()arermr3oa1opD ai ilt t2tm(o3nydom nmfctls)sDuaxmp;u1aeenmfetys sDrm(msn(4 rerxoctatlaD anvo t srtrio3oy1omeemncsasfaDra(monu1tptnifeiat m2emnvs t4texnmf3oy1opteanei t0setm(m3ny4lm e nviat sDrrxmpnu1alx ioetatls uau ont) ltnifciotfm  lies t)truo(opiu1ap elneslsf 2rrx pot4tptoiictatla em(vs u4 rxoxfcoatla  lnvs t tetoxo3oydlp emies ()a2tmxmo;o0teeniieiasls2rauvs t4 etnir3io1opDeaueo;()s2urxopiodape  fesasf rtaurpoo4opt mi3tatls2em(vo t0 rxnxf iotopt  iei;(  ruo(opiodapenlncta(farumxrpot4olxn iciltla eanvsn()trxnmf3iotfm  anvo;t0t2umxopiudlm nmneias srumumpno4oee mf3tltlmDranmpn(4arerxf ty1la  lnes () 2uoxr oo1ameemnetls aDua(r no0aeenii3iadfmDelnmo;(0 lenxo3ootomte nvilt0srxoim3ny4al emfctls  rrau o;o4olen f3iyt s el( s;u)alxrxocio1omDelnvsls)truoio oo4apte fctltfsrtm(  ;o0tpxnioeiydfaDea(ms;t)tlxrxf3oodfmDe u o s0sexmim iu4ol nmnvt () rururpnu4tex moctytfaDuaumpnu0 rxrmo iy1lm ranesl(  etoio3oudome lnvsl()s2tm(  ;t1ape mfciytfmDra( s (4texrif oodlpDe nesl( srxo(opno1aptelictasfsrurxmp;o1tpxnmociysfmDuanvs u0artrxf3todlaDe u s;(0 rtoim3no1lptemnvs t)s2rr(r nt4tpt mo3iytfa2emuvp;(4tlxomfciadfa ean o (0 euoxo3nydlmte fcs ()sDum(m ;t1tpt mf3tat s uaums u)trxrirciodomteaies;s0texm(r nu4omtnmfvsat aDrrumpnt0tptnmi3iaslmDeau o u) ltoxf3iytoa rauvs s s2urxm ou1am nmfcils artmum ;t0tex moetysla umumo u0altnmr oatfpD lnes s0s2xrxmpoo1ope lies (f Dtrur ;o4aptn f3iytfaDea(vont0 lxoxf3iatom  ai slt)sexoir ny1lm  mnes t aDra(mooo0olx  i3ilsfa elnvpn()tltomo to1opteaivo;t trurxm ou1omt lics (f 2ta( ont1olt  ocilt m emumo;t0artoxrciydla eauei s)trxmir ny1opee ivs tfsDtmxrpou4tltnmi3ils sDemnmsnu4trenmo iatoaD lnes (0 euo(opnu1llte fcs tfa2umumpoo4tpt  feiysfa elnmpn(4altnxfctotfa raneolt) etoxm nodalenmieilsfarta( p;t0oetomfctad s uaums ()aeermfcoo1opDrln s;t) 2xoio3iu1op elfvtltf 2ta( oot0aleomo3tadfm2uln o;(4trxrmociadlaDraneilt)s2triopiy4om  lietlsfaDtrx  ou0tet ifciltfm2el(msn()tlxnio3tydfmt au s (  2tr(opoudap  mnvia() 2tm(m nu0oet mietlslm2ra( p (4tlxrxf ia1oatrauesls0teuo(m io1altemncia()srrr(rpno0aptniieiytfs el(vsnt0aetoxoctotlaDrauvi;t texmir iu4open feias)s2rmx oou0tltomo3iltls2ua(vo;t)arerir3oadoateluvi (0 2xoir3oudoptemfcsa()a2um( poo0teenmoctld a2umn s t0tlerxf3oytfmDelueilt)seumim oydlltemfesa(  2tmu p;u0aeeomfetlslm rau o t0 ltoxf iytfp rau i t0t2ur(rpio4amee icslt sDur( onu1aee  f3ilsfs2rlnvonu0aleoxfcoa1faDelnvs;(0t2xrxm3oydlm  mfciat)srrru  ;t0opeoiieias m rlumo t4tetnmrcoodla e u s s)teuo(m iydll  mfetl(faDur(root1aleo fctadfa um(vs;u)texnir3oadomD lu sls0t2tr(m nu4omtnliesas) 2tru p;o4alxnmfeiytfaDrm( pnt0tlxoir iy1fm e uvsls)t2xoxm3oodllt mfvil( sDra( onu0open oeiltfm2ul(vo u4 etnmocoo1faDeanes;()s2xrxrpno1amtnmnet s) 2tr( onu4aeen fciydfaDrmumo;(0treoio totlpDraiei (0setm(o oy4aptemncsl()srtmxr nu1ole mietasfmDranvsnt)texnmo ta1lpD lu s s teumxo3iu1lp nlfcs sfa2ua(mp;o0open ieiatlaDrmnmon()trxnirctotlp  ai ils0srxoir3no1omtn nei s s2um(rpoo4opxo octadfm2rm(ms;u) exrmr io1opDrlivo;()trxrio3oodapen ncs t aDrr(ro;o0texnii3tatlaDra(vs;u)tleoxf iotfpDe nvil()srxoxrpiu1lmt lnvt t)a2rmu o;t4tle  f3iytlmDrln o (0aeerio tatlateanvsl(0texo(o oodolt mfcia( arrrxm ;u4tlt ii3ildlsDelnvs u)aexoir ty1oa rlivi t)trxmim3no4alte ivsa(f 2rr(mp;o0opx io3iadfmDrau pnu) exnxr3iadomD aneslt)seurxrpou1am elncs s a2ur(m ou4aexn feiat mDeau p;()tlerxo3to1oa   nvo;t0srurir ou4am n nciltfsDum(  nt1aee ii3iytlaDuaump;t4 eenio tytomDe ueol( s2urxo iu4optelfct (f rtaur nt1tet  ieiatlm ean onu)aexriociotoat ln ol(  2xoio3oy1amee netatfs2taxrooo4apeoioetydfm2rlnvs;t)altrmf totoatr uesls0 etmxo iudalen ivi tfaDurxm ;t0teeomi3iyslmDum(vonu4arxnxr ty1oa e uei ( seur(o3io4lmt mnci (fa2umxrp;t1aet moctyt aDelnmont0aexniociytfm rlnvi t)s2ur(r nudoltelfctasf rrmurpoo4tlxn ictlslaDelump (4arxnxfcto1oaD ai o;s seuoim io4olee ieta(fsDrrurp;o4texn ocilsfa2el( p;t4tltrmo3ootlmDeauei s0t2xm(mpnodlpe mietlsfaDtr(rono0tex ioctyd s2rmums u)artomfctytlptrlnvi;( truoir3oy1apeemfct (  2ur(r ;t1oltnmf3iytfsDrauvsn()artnxrctotopD anei;(0srur(r oydamt lfcs tfsDtru poo4apenmo3iatlaDea(mpn() eenir oodlaDeli i (0seto(m iodap nlnviatf Dtmurp;o0opt iiciys m rmuvs () lerio3iotfa eauvol(  rur(m3ou1lp   ivi t  2um(rp;u0oeenmfcilt s raump (0 eeoxf ty1fm eauei (  rxmio nydom   nvsls sDrmu pnu1aptniictysfm2umnmsnu)treoxoctotfaDr n i;t0teto(r3ou1ll elfct s)a2rm(r ot1aetoifeiatfaDra( o;t)arxnmocio1fptranvo;(  exo(mpoo4ame mnctlt) Dtaxm ;t1opxoifciysfa umn s u4treoircia1lmteli o t0 rxm(o3oodlmtn ivsls)arrr(r ;t1ale  ieiyslm2rm(mo u4alxnir3ootfat lu ils0srtrio nu1ameemivtls a2ururp;o4teeoio3tlt aDrm(vo t0 ltnxo tatfa  au ils0seuoim oo4ll n nvil(faDrmuro;t0texomieiatlmDemnvo;t0 lxrmocoa1lptrluvils0 2tr(m3nydllt  nviatf Dtr( ono4opxomf3ilsfa rmnvs (4 rtnxrctatlmDraiei;s srxm(mpiu4ll eliviatf Drm(r ou4ale  oeilt m rau o ()tltrir3ootoptran i;(0sexr(r iudop elivi (fsrrrx onu1alxomfetasfm ea(ms;t) exnxrcio1fateanvils0srxo(m3nu1ol  lneils)arumur ou1ape  ieildfm uan p t4aeenmoctatlp eau olt  euo(r3oo1lmee icias) rtaxmont1apxn oeiltfa2elnmp u4 exrir iy1lpDe uvi s srurxmpoudolee nvs t  Drrxrp;o4alx moetaslm2rluvo t4arerio3oadfatrai slt0texr(m ny4al  mnvsl() Dtau  ;t4optomoetatfs2uaums;u) lxoxr oatoa  ln i t0t2ur(rpoy4lltn fvt sfsrtm( o;o0alxnmieiadlmDuan on(4tetnxocoy1fp rau o;t  rurxopio4ole mfci s) 2rrx o;o1open oeiytls2ran pn(0 etoxf iatfa r ivslt)sexrxm3oudap emnciatfsrua(rpou4ope  icilsfm2rln snt4tltoxr3todomD lneolt0srxr(mpiydoptelfvias)sDumxm nt4alxomiciytlmDuau snt4alenmf io1fmt  ivi;s0trtmxo3io4om emnvi tfsrumuront0ape io3iadla ea(monu0 lxrxo3iy1opteli ol()srxoxrpoo1opeelfctls srtm(r ot1teenioeilsfa2rmnms;()trerif3totlat lnvs;t truoxr nu1apenlfvtls s2raxmoot1oleomieiyd sDrm( s;t0 eerir3oo1fa  lueo s)truoxo3iodome lict ( sruaxmp;t4aetn f3ild a ea( p t0aetoxo3iydoaDrai o (  exrim no4olt  net t srumuro;t4olx  fciyt a2em(vs () leoxfcoodlaDr ivs;s  rxo(opou1amtn ivia(farrru poo1tptnifeiys m eanmp ()aeerir oadla rluei () 2tmxrpio1ap emnvsls)srrm( onu1apeo f3tys a2uan on() rxoxo3ty1omDelies;t0srxr(m iu1omteliei (fartr(ro;t1aeenioctltfs2rmu s;(0 rxnmfctydoa  li ils0 rxm(rpoy4omenmncs sfa2uaxmp;u0tle  ieiyt s2ul(vsnt4alxrxrciytlm elu i () exmimpny4ol nmncsat srraxmo;t1opx  fciyt sDeaumo;()aetoxr to1fa r n ils t2tr(o no1lp emiet s)srrmx ont1tetnmiciat a rmnms;t4tlerxr iydfpt luvo;t teurxrpiy1llee neias)srtru o;t4apto i3iltla2emnvo u)aexrio iydfa   nei;s0t2xmxr iu1omtemfvi ()s2raxm ;u1texoiociltlsDeluvont) rxnxo3ia1faDrln o s)trtrxm3ny1lleelivs t)srtaur nu4olxoiieiat s eln o t0alxniocoydlmDr nvolt) 2xmim oydoleelfcsat sDumu  ;t1teeo feiyslaDeanmo;(4 rxrmr iy1lp elieslt)truriopny4om nmnvsl( srurxmont4oltomoctltfa ulu p;(4altrxo oo1opte uvo t0texrim3io1olee fcilsfa2rmu oou0aex mociadla ua(vont)teenif ty1fm e n s s)seurxr3no4llt mfvsas)srrm( o;t4aeeo fcild mDem(vp u)tlxnmrcia1latrauei;s)srur(r oo4am emncs (fa2umx ooo0opxnmocilsfs eln s t)artoifcio1lmtrlueo t)tetmio3oo1am nmnct ()a2rau  ;o1tlenmf3iltfm2rmu s;t0artomfcoatoateln s s)s2xoxmpou1am elfesl()s2trx o;o1olt mi3iytfmDuan sn()trermf io1oaD an ils)t2uoim iudlltnmfci s) 2tm(moou0tpxoii3tat mDelu p (0teermf io1latranes ()t2uo(r oudalenmncsa( aDuaxrpno1oetomietltlmDelump (0alxnif3ta1faD li i;( setrxo3iudap   ietlt) 2urur nu1tetnif3iat a2ul(mpnt)tlermfcoytoatrlnvo;s  rxmxo3iydapt  fciasf ruaum nu1olx  i3iadlsDea( s;u) ltnxo3to1omtrlu o;(0sexrxr3nydlm elivtl(  Dtrxm nt4tetnmieiydlaDum( pnt4texrxo oydfpt li olt s2tm(opoodal emfesl(fsrrau ooo4tpxo ieiasfsDran o u4aexnxfcoydfpDraivs;s)tetmimpnu4olen ieil()srtmu pou1tetniiciydlmDrauvpnu0aexnxr oy1fp  lieols0 rxm(m ny1lp  mictl()aDrmx onu4tptoifeiadfa2umuvp;() rtrmoctatlp eauvi () 2toxo nudlmee nvtl(  rraxro;o1alen iciad a rauvp;(0aeermfciodoa  auei;s)srur(o3oudamtemiesasfarrrx oot1teeniieiltfsDemnmpn(4arxrxf oodop  lneslt0srtm(opiu1ape lfesltfarua(  ou4aleniociadfm rlums u4artnmo oy1oaDrln o;t)t2xoio oo4lp nlfvt tfa2tmx oot1opto fetlsls2rmn o;u0 reoir3totfaDraues;( texriopiy4lmeelictlt)sDta(rono1aexo ictysfa2elumpnu)teerif3oy1opD  nvs;s0 exriopny1olte fvsa() Drmu pot4altoiiciys m2ra(mon(4trxomr3oa1fptraies ()texoxo3oy1om  mnvtlt)s2ua(rp;t1tetomf3ilsfs2rmn o;(4arermf3iodfpDeai il(  2xm(m iydapt mict () 2raur oo1tltoii3tasfs ua( snt0trxoxociodfpD aueo;(0tetoxr iu1apt liet () 2urx ooo4tex ioeiydfm em(vp;t0texrmo to1lpDraueils  exm(m nydolenmfeslt aDtmumono1ale moeiytfa2ua(vo;t0tlxniocoadopteaiei;t)teum(opnydllte nei ( srtm(r ;u0ape  o3ild s rm( p u0alermocto1laDe uvs s teurxo no1apt  neslt)a2tr(  nu0aetn oeildls rlnmp;(0texrxfctadlm raivi;() 2urxopoy4openmfvtl() Drm(r no4aptoifetadla ea( p (4 etrmr io1lm ran i;t trumimpoudol emfes sfsDtau ono4tlxnmi3ildfsDum(ms;t)aeenxfctytoatraiei s)seurxmpoydlme mfetlsfsDrrxr no0texoiociatls2rmump (4tleoxf iytfate i sls t2tmio ou4altn nvt s)artmumo;t4oexomi3iltfmDulu p t)aleomfciatfaDelu s s seuriopou4lpe  fvias aDuaump;u0ape ifctatfm rl(mp;(0alxnmf3oy1la eai o s  etoiopoudamtelivia()arrmur oo0tlt  oeils sDuanms;()trxoir tatfatraneo (0 rurir3iu4olt mnctl(  Dtaxm ;t1texnmiciyt aDea(mpn(0 exrio iatomt luvs;t)seum(o3ou4lptnmieias)s2ra(ront1tee mfctls aDuln p (0 leniocty1op  aivo s) eum(m ou4oltemfes t a2ururpoo4tpt  fetydfs2ranmo;u4arenif iydfptrai s;t  rxr(opiydom e iet tfaDrax o;u0altnmiciadlmDrmnvo t4 etomo oo1omDrauei;t0trxmim nodll  lfvt (faruru ono0oltnifcils sDemnvpnu0tetrifcoadopt  uvsls)t2ur(rpoy1altemnvsat) rumxmoou0tetn octydfsDul( s u4 eeoio oodopt  i i (0 rurxr nydaltelfvilt sDrm(moou1aet mietltls ul(vont0trxrmf io1oa e nvi;s0 2um(m3nu4om emnvt s) ruaur oo4tpx mo3iltlsDranvs t) leoir iatfmt lu i s0 2xm(m nydolee ivs s) rrrur nt1aetoioeiltlsDra(vs t)aeerxr3oytfm eln o s  2xm(rpiu1lpt lnetls sDtrumoou4aptn ictad aDua( o;(0aexrifcia1faD luei s0srxrio ou1amen iesat aDua(mp;t0alxn oeildlm um( snt) etrxf3iydlm eli ils)t2to(opnudop emfesas s2trxr ;t1tltn ociydfs2ea(mpnu4tetrxr3ia1op   u ilt)t2uo(m3iy4alenmncs ()a2raumpnu4tpen i3iyt a rm(mpnt)alxomo tadfa eai o (  rtrim3oo4omee fvtlsfsDurum ;u1aleomoeildfm2ra( s;t4aexrxocoodomt  nvsl( trtoio oudalenlivi s a2urumo;u0teeomieiytlmDem( pnt0altnirciodfpD luvo t)sruoir iu1lltn ict s  Dtmx pot1optomiciyt sDeanmsnu4tlxoifciatfmteln s;t seum(rpny4opeelfcsa()srtaxm ot4tee miciat mDea( o;u) lermfciodoa  ai s s  exmxo3oodlpte nvs t s2tau onu0aee  oetat s ea(vsnu0alxrxo to1fp eluvo t0 2xo(r oodlptnmneils)a2rm( pot4oeen ictlsfm2el( o;u)tetomfcootom   n sl(  etrio iy4ameemfesltfsDur( pno1tpe  i3iyt s2ua(ms u0 lxoxrctytoptr uvs;s)teumxo iu4omt lici s arrru  ot0tltnmfetydfsDrm(vpnt) lermr3ootomtr nvs t)t2xm(opny4opee feslsfsDuaumpnt1tle mf3iyd aDelnvo;u0 reomf3ta1optr n i;t0teto(m iodll  miesls  2ra(r ot4optnioeilsfm rau p ()trenxo3oatopDeaivs s tetm(o3io4lltn neils a2ur( pno0tex iieilsfs emnmpn(4trenif3iy1lpt  iei;t0sruoim3oo1amt lfvils) rrrxmo;t1aet iocilslmDrm(vpn(0arxnmo io1fmDr ivi s0 exr(o iu1ll eliesl(fsrtax ont1tpenmictadfs2ea(vonu) eenio oadoaDelieol( srum(r oo1alt lnei sfsrrr(mono1texnmfeiyd a em( o;(4trxoif3oodoa raneils trtm(rpnu1ap n fctlt) 2um(m ;o1tpxomociys a2emnvo u)tetrxfcty1lpDr iei;(0texoxm3oo1llte nes s)aDumu pno1tpeoiicildfa um(msnu4trenxf3ootlmteaues;t0s2tr(o3oodop e neiltf 2uaur ot4olxomo3tasla rmu s;(0artnxo3ia1laDr i ilt)s2xm(o oydlm elivtas)arur(mp;t1ole iictatlm rluvo t)aleoif3iydfaDeau o;s0t2uo(opoo1om  miesas srtrurpnt4aexomfeias s uluvpnu4aetomr3oydfptranei;t s2uoxopio1lp  mneiat) ruru p;u1olxnmietysfm rau s (0tetnmo3oodfpDrlivo s0t2uo(mpoodam   fet t)srtax ooo4altn i3tadla ranmsnt)altnif3io1lmtran sls) 2trir ny4amtn fes t srumumont4tetomf3iyd s ra(vsnt) lxnio3ta1laDeln i t)trtoio oy4omeemieil(faDrm(r nt1olenmo3tas m umumo;u4 eeoxf3ootfaDrai i;t s2urxopiu4lme  fcsa( s2urxmp;u0oetnioeiad a emu p;(0trtomr3tydom e u i;(0truoxm nodap n fctltfartrxmpot0tpe moeiydfs ea(vsn(4alerif iodlptraieilt)t2ur(o oo1ole mfct s a2umx  ou4apx mo3tld a ra(vsnu4 rtoif3oy1optr n i;s t2tm(rpiy1apt mfvias)a2rrxrp;o4oeeoifetld s elu o;t) rtrmr3ta1lptrlivo;(0 exm(m no4altn icsl( sDrr( oot0olt  fetydlmDem(vp;u0 reoif3iotomteaneslt0s2tmim oo1lp   ncilsfsDrrxm ;u0aex  octlt s ulumo t) renxr iy1oatraivilt)srtmir3ny4om  lnetltfsrrmxm ot0apto ieiytfm emu s t0teenmo3oa1fateli i s)t2trim3oydol n fvi sfs2ua( p;t0altoioeias m2um(mon() etnir ia1fmteauvols srumiopiudom  mfes sfaDtmuronu4tet mictytlm2rlnvo;t4 eenmo3ootom   ies t0 exrxo3nudomtn feils srua(m ;t0tee mfeiatlsDulnmo ()tetrxocoytfat  u s;t)t2xm(opoo1apee nesasfarraxmp;o1tle mocias mDem(mp t0aetomf iydlpteliei t s2xrxr3oy1ol emnct tfarrm(m no4altn i3iltfmDeanmpn(0aeenxr ty1faDraivi;s0 ruoir ou4omte neslt)sDurx  nu4ole  o3iasla rmumsn(0artrmo ta1lm e ies s)srum(o3no1am nlnvsa(  2rm(mpno1tlt mocilt s ranmo;()tltoxf iy1fmtrlieo;s0sexm(r io1ol elnvtlt s2rrumo;u1apenifciasls um( p (0 rtrif3ia1fatr iei;s) ruo(rpoo4lpt mncs s sDum(rpoo0olxniociatfsDrlumpn()arermocoo1lpD aieil(0sruo(rpio1omtn nesltf 2umur no0optnmo3iydfaDul( o (4tlxrmo iatomt luei;s setrxrpoy4lmtemivtls  2urx p;o1ope  ietlt a2em( on(0tetoif ootlmDran sls t2uoim iodlmenmfeiatfs2rau  ;t0tltn f3iltls2eluvsnu4tltnifciydfm  luvs;t0srum(rpiu4omt livsl()s2trumpnt4teeoiictatlm ea(vpnt0 etrmr3tatlatelueil(0teur(m3no4ope mici t aruaxrp;u0oeeomoetatfm2rmnmsn()texoxfcoytfmDe uei;()trtrio3iodlpenlfei (fsDraxr ot1aptomo3iyt a2eauvonu) eerxr ty1lpt  uvs;t sexrxo oydaltnmnesl()sDua(mo;t4texomfciysfm2eaumo (4 rtrxf3ty1latrau i ( sruo(opnydamtn icil(fs2ta(m ou4texoii3iasfm uaums u0teenxr3iatfpDrluvs;s)srxr(o3nu1llenlici t) Drax o;o1tle moeild s2el( onu0teenmf iatlp  auvilt seurxm nudlmee neiat sruaxm oo0oeenifcilt mDrl(vsnt) lxoxr oo1fat aueslt) 2urxmpoy4amtn ici s) Duaumo;t1tpeo o3iltfsDelums;t)alerxr3ia1lpDeln o t0 exoxo oo4ol  mfcias a2um( pno1olxnmociydlm2rl(vsnt0texrifciatopteluvols  2xoxm io4ll nmnvsl(faDumump;o4tlx mfeilslsDeau s;u0alxoif tadlm r uvi (  2tr(mpny4amte feilsf rum( p;t1apeo ieias s2em(vo ()artomf iydoptelnvs;t0 2xmxo iy1alte nct s)aDuaxr oo1oet mo3ias sDeaumpnu0trxrxf3oa1lpDelueol(0s2urir no1ol  livsltfartmuro;t1apeomoeilslm rlu sn(0artnmf tydfm  auvilt) 2tmxo3oydoptemfvias)srrruroot4opto fctld mDumu o;t)areoiocio1fmD lieols)truo(o iu4ameemiei ()a2rmurp;t0oleomociad a2um
\ No newline at end of file
@@ -0,0 +1 @@
+ueol(0trtoxmpnu4amtelneiasfsDumurp;o4aet io3iat s2rlnvs u4aeeoif oytom elnvols t2trxrpoy4ap nlics t)s2ur( pnt0tpx mo3tyd s2ean p t0aetnio io1omD  u s s) 2xm(r no4ol n fes ()arrmx  nu1apx  fcild s2rmuvsnu0aleoxf3iotfp e ieo ()teuo(opio4omee iet sfs2umur ou0apen ictytlmDea(ms;t) lxnifcoadoa  au o (0trtm(mpnu1altnmfeiatf 2ra( o;o4oetoiieild a2ua(vp u) exrio iatoaD  u o s seuoirpiy4al   ics s arumuront1oleomfctyt s2ra( p t)altoxrcoa1la elues;s0srxoxmpoy1altemncsl( srum( pnt0oexnmictltfs2ul(mon(0aeenmo tytfa ranvilt)t2tmxr iydlle lnvtls)aDuru p;o1olt  ieiytfa2uau ont) eeoxf3tatoateanvi s0tetmxo ou1op nmivsa( s2tmx o;o0opx  feild s uau snu4tleoif3oa1oate u ils s2trim nydapeemivsltf Dur(r ou4apeomoeiatla rm( snu0aexnir tydfmDr ivslt) 2xo(r io4ome  iesls) rra(mpou1ale ifeilsfm2ra(mont) etomf3oadlmD livo;(  2tr(o iydomeelfviat) rrru  ot0altnmiciadfa uluvs u0 rtoiociydla r i ol()s2trimpoydomt mfvs ( srtaur nt0apto i3tyd m2ea( o;u)trxomf oatlatr ieolt0tetoxr3oudap nmncta(  2ua(  ;o4alen oeiatfm rlu sn(4 rxoif oatomDe ivi t0tetrim ou1ap nmfvi s)s2rmu  ou1oleo ietadlsDuluvo t0 ltrxo tadfpDr n s;s t2tmxrpnudol  lfvsltfsDumurpou4tpt mo3iysfs2uluvs (4alxrmoctodomDrlueo s) exm(r iu4lm elietat)a2tmx  ot0apto o3iatla uan s;t0trtnio3todlmD anvols0srxmim nu4lme mivias aDrru  ot4tetoifeiltlm2em(mp;() rxnmfcoydlmD liei t0s2uoim3ny4omt  feil( aDum( p;u4apenioeilt a2ul( s u4arxomo3todla  aieo ()sexr(opoy1ol  lnvt s) Duaump;o4olt  f3ildla2rmnvs t4 rtnmr3totomDeli i s0seumirpio4lm emiet t sDururpot1tptoif3iasls2uaums;u) exrir iy1lmt ai o s)srxo(m3oy1omee fvtas arum(m nt1teen ociydlmDel(vp;u0 leomrctytfmD an ols t2ur(o3oo1ll nlietlt  2tm(m ;t4oetnmieiaslsDrm(mp u)teeomo ta1om  lnvs s0trtr(o no1op nlici s srtmurpou0oexo fciytlmDrmnmsn(4tetoxo iy1op e n s s) rtoimpoy1am e fvi t sDtaumpnu0oexn octlsfaDuluvsnt0trenxocoodomD  nvo;s0teto(r ny1apeemfeil(  2urxm ot1ole iieias a elnms (4aexrmo iotoaDe nvs;()t2toimpno1ome mfcils) rraxmono4apt miciatla eanvo;u)altnio3oy1fa   ues;t texoxm ny1om nlnctl()artrxmooo4oeeo fetydls2rauvs;t4texrxfcoydomt lieils)truoio iu4ap emfctl(f Dum(m oo4tptoifctyslmDra( snu4 rxnir oadoptranvs;t  etoirpny1am  livi (f Dtaxrp;o0tpenifctltfa2um( s t)aexomf todla elneil()t2um(r3iu1al n fes () Dta( oou1apenio3iatfa umnvont0tlerxf ootfa   i s t)trumxo3iu4aptnmnei tf Dtm( pnu4aexn feiytla rmnvo;u0altnxo oydfat anvs s)s2uo(m oodll  lnes t)aDumu onu1tleo oeiydla ul(vpn(0 exrxr3oatoat aueo (0sexr(o nodolt mfcil(fs2uru pot0tex  ocild a rmnms;u4aexnxo ty1lpt  nvo t sexoxrpiudom  mfcsat)srrmurono4aeeoif3iydfm ra(vp;u0aeeomf tydlm rau olt0 etmim ny1amenmfvtlsf 2trur ou0tleniictls m rmn p ()texoxr3iodfp e ueols sexo(o oy4am emnvtltf 2rmx  ;o4tetoio3tatfmDua( pn(0 exrxf io1oaD ln i;s tetoim oo4amtemfes t)artmumpoo0tpenmoctldfmDulnvp u0 eenifctytlpD aivols t2xm(m3iu4opeelivsat s2raxmooo4tex ifeiydlsDuln snu4 exomf iytfp rlivs s0sexoir3ny1lp  mfviasf 2uaxrooo4olx  fciadfm2uaumpnu4 ltnir to1faD aivs s0s2trxrpno1lmee iciasf Dumu ooo0aexn ociatfmDrmn on(0 rtnmocta1fmDeaivs s)s2urxopnodlptnmnes tfs2rm(mooo1tpxniieiyd m rlnvp t0aeerirctodlmDrlnes;t0srtoio iy1al e nctatfs2urxmpoo0alx mfeiys m ea( s;u0 eenioctotoa e ivs;( t2xrim3io4omen nvsa() Dtauront4opx ifetydls umums;(4treoioctytomD lnvi s0 rxr(rpou1amenlieiatf ruaxr nt0apt  fciytlaDrmnms (4 etnxr iydfaDrlnei ()trtmiopiy4lpenmieilt artaumo;t4oleoifeild s2ra( p (0tleomocoodom  au o s)trxmxo oudomtnmfvilsfsDra(ro;t1oee ifcildfs2rmumont0teeomf oytoaD  uvol( s2trirpny1amen iei s)sDraxmp;u4tet mi3tat a emump (4 etnxociydfm   uvol(0t2xoim nydllt mivtl(faDuau  ;u1aetnmfetltla2um( snt0trtrif io1fmt livi;(0 2xoirpno1lleelnetlt)aDta(ro;t0oeen f3tls m rau s;u) rtnio3ta1laDran slt seum(o3iudomtemnvi s s2ra( p;u0altnmietatls emn o u)altoio3oo1fpDelnvsls  rxmxmpnydalt mfeiasf 2tru onu1oeeomfciltfaDrmu o;u0arxnifcto1fmtelnvi;(0teum(r iy4apee fvs t  rraxm no4tltnif3ildfs2rau s (4altrxr3todfpDrluesls)s2xmxm ou4lmenlivs t  2rrur oo1aet mietadlsDemuvo ()trtoio3iydoaDraies t)srtrxo3oy4amen ivilt)s2ra(  ;u0aeenifeils m umuvp;t0artrio3ta1lm raneils0seur(r3ny4ope mici ()sDta(m ot4olxnmo3ildlmDranvs u0tlxrxr iy1lmDrlu s;s)srxriopny4apen nviat arta(m oo1tleoif3iadfs2uanmsnu) lxoifciotop   i s;(0 ruoir3iudalte nci tfsDumu o;u1tlxomi3iydfaDrm(mon() reomrcoodfmDelues s)texoirpoudopeemnvtls  Dtm(ront0tet ii3iadfm uanmp;t0 lerio3oydlateaivs t) etr(r3nodomte ictl()srra( p;u1tlx mi3iadls ulnvp t4tlerxf oodfm e nei;(  ruo(opio1ope mncias) rurxmpoo0aeenmo3tat mDua(vs;(4arerircoodla ran s (  rto(mpnydam  lfcias) rtrx  no1apxo f3tlsfmDranmsn(0 lenif3oytlp rln ols)srtrim3nodomtnmivsas  2trum ot4opxo f3tyt a umn o () lxoir3iatomDe n sls)t2uoim nudoptn nviat a2rrxrp;t1olx ifciyt sDrluvp;(4trtomrciadopt  uvils trumxmpoo1lp e ictltf rrmxrpnu1openifetlsfmDel(mp;(4trxnxo iadoate ies s) 2umim3iudop nmfet s) 2raumpoo0tetomo3iadfm2em(vo u4areoxf3tytoa eliesls trtrxo3io4lm  livia()sDtm(  nu4olt mictad a2em( s;(4artrmo3todfmtranei t trtm(r nu4am nmictltfarrrumoot1opeoii3iydlaDeanmp ()arxrxrctytlmDelnvs s)srxmxm3nydlm  mnvs s)sDtau o;t0tlenmfciad s eauvp (0tetrifciatfa   nvo t)srxr(opoy1aptn ieiltf Drr(  ou1altomi3iatlmDuau p t0aetnmfcta1la elnesls)srtrim iudlmenlnetlt s2tr(m no0tetomfciatfmDemu s;t) etrmo iodlmte i il( trxo(o oy1lmte nvt (fa2rax pno4tlx  fetat a2elnmonu4tlxrxr3iodomD ai i;s trum(m iodlp nmfvsa()s2uau pno0aeeo iciat aDum(mo (0tlxnir ta1opDeauvo;() rtmxm no4ap nmiet s a2tm(m ot4apxniiciadfs ranmonu4tltnxo3tytlptrlueils0setm(opoodaltnlfetlt  Dtmxm no4aexoifeiltlm2ul(mp;u) etrmf3tadfat  nvi;t srurimpnydalt  fct ()arum( oou1ape mictytls2em(vp u) exrxr3totoa ranes;()seum(r iydolt lnctat)aDrm(rp;t4oeeoioctasfmDum(mon(0aeerxf3iytfpte u olt0 2tm(r3nydalt mivslsfa2rr( ooo1ole io3ilt m rluvo (0arxoxocoa1om  auvi;()s2tmxr3oo4op e ncil() rrmurono4alenioeiys s2eaump t0 rtnif iotlm rlu s ( srxmxm iydale  fvtls)sDrmxrp;t1tet io3iat sDuln s;t) rtrmr iytla e ueolt  rxrxrpno4ol emncsl( s2ururpno0tlenmfetlt m ul(ms (0texoxfciytoa e i o;() 2to(r no4ll nlncsls a2umxront1tlt moeildfmDranvo u0 etrircoo1opD auvil(  rxmxmpno4lle mfeiat s2ra(monu4teenmfciydls2em( p;t) rtrmr ty1la r ivo ( trxm(m oy4apen iet () rtaxm ot4opeomoeiydlm2ul( s;t4alxrio3tadlatraivi s0s2xr(m no4lmt livtlt) Dur( poo4oetn ieiydfs2ulnvs u)teeoxo oy1fatrlnvsls)t2urxm ny4op  lictat  2rrxmpno0apeniocilsla emump;t4tetriocoadoaD an o (0s2tmio ny4ap nmfcs ( aruax  no4tpxoiictytfaDra(mpnu)tlenmfctytoaDrlueo;(0srxr(opiodamenlicsat)srrmuront1olxomi3iad sDemuvon(0altrio3oo1fp eluei s)t2xmim3oy1olenmieilsfsrtmumpno0tetniiciad mDra( s;t0alenif3oodfpDelieo s0tetrxo nydam emivils)arumump;t1tpt mfcilslmDrm(vpnt)treomr oatfptr n s;s) rto(mpiydamtemivi t  Dumxmp;u4opeomo3iytlm2uaump t)tlxnif iadlpt li ols  euoxm oudlmt mies ( a2rrxmo;u1apeo i3ils mDrmu s t4 rxnio ootla r uei;s)sexoxm3nu1lmenlnci (f rraxrpnt4texnio3tysfa2uanvpn(0trtoxf3oodlmt ln o;s setm(m iu1lpt mnvtl( a2uaum ou1tlx ii3ild s2umu s;(0aleomociadoatr u slt  etm(o nodol nmnvils s2tau p;o1tpe mo3iasfmDrm(monu)texrxr to1lmt luvols0texoxm3io4llt  fcs tfaDtmurpou0apeniietad m2rln pnt)aeenxrcoydfmteli i;() 2urxmpnodlp  lfesas  2uaumo;u1tpe mo3tltfsDrmnmsn()aexriociatomt ln ols tetmxmpny4aptelics tfaDrr(rpnt4aetnmi3tltfm emn o t4 reoiocoy1fate ies t trxoxmpiy4lpe  nesasf rra(mpno1oeeniociltfsDuanvo;u4tetrxf3ootfaDraies;s seumxo nudlmenmnct s a2rrxmonu1tetnmoctasfsDul(vo u0aexoifciatfaDrliei;(0texoxm ou4olen ncs tf Drau ono4tpx  oetlsls2ra( p;u) rxoif oo1lm elieo;t0trxr(m3oo1lpe  ics tfsrum(rpoo0tpt miciadlmDrauvs u4 rxrmf3tytoaDeauvsls  eur(r3oydoptnmicsasf 2tm( pnu4alt ioetysfaDrm( s;u0 rtoxf3oadoaDelieol()t2trxr no4aptelfct ()aDrrxr nu4oltoii3ild mDua(vo t0artrmf3oytlpDr n ol(0 eto(rpio1ameelnvsas) 2ur(r ;o1apx  feiatfa2eluvont4trxnxoctatfmDrli i;t) exo(r nydapenlfeslsfsrrmxm ou4opto iciat aDrln p;()aetrmf3to1lmD ai s t0s2uoxr3ou4ole  nvsls)arurx  ou0aptoifeiasla2rmuvs t4tlxoxrctydfmD  n ils0sexr(r3nydlpe  fct sfaDrmu oot1aeeoifcias m2rln s u0 lerifctatlaDrlu ols0srur(r ny4omenmfcsatfsDrmxrpno0olx  ociys m2rl(ms t)teerxocoy1lp e ues t)s2trimpiu4op  lfeias aDtmu  ;o1olxo octad mDeanvs;(4trxomo iadlmD  neilt srtrxr3iy4lle micil(f rrmurpno0tleo ietadfsDrluvs;t) exnxr3ia1oaD  u s;t teurxo io1ll   netl(fa2um( ont0oexoio3iltfmDrlnmpnt4tlxnxrcoydlmtr i ol()t2xrxopiydol  mnei ()aDuaxrp;o4apeomociaslmDrauvs;()altnmr3oodfptrlivils0truo(m iodlmte fvils)a2rr(rpnt0tptoifciaslaDrm(ms t)tltrmo oydlaDraiei ()t2xo(m nydamenmfesl( sDrax  oo1tetn o3iat s2ul( o () eeoioctydlp rli s (0 2xoim oudam e ivia()sDtm(  nu0opxo i3iys a2eanvsnu)texnmo3iatfptr ivi s  exmxr oo4om elfvias) 2ua(rp;t4aeeo f3iadfm uauvo u4tlxrxr oydoa ran il(  rtrxopnudlpen feils  2tm(ro;u4tpt ioctatlaDrlu pnt4tetnmr iatlp r ueo;()t2toio3iu1omenmfet tf 2rrumpnt1alen fciatfsDelu s (0 rxrio3totom rau s;s) rxmio3nu1omtemfeias) 2rax pnu1optomocild s uan s;(4tltrxr iatlm r u i () euoio iydal emicilsf rrm(mp;u4tleo ociadlm2um( o;u4 etoircoa1optr nvs;(0s2xr(m iydaptemictlt aDrmumont1tleniicias aDumuvp u0trtnxo oydla ran o t srxrxm io1lm  lnvtltfs2tru o;o1aexoiietys a2el( p u4trxoxo3iatfpD  nvs t0t2ur(rpoy1oleemieilt srtaxmpnt1oeenio3tat aDran on()arxnmf oatlmDe ivils  rtrim iy4ll e neslsf Duaurpoo4alto o3iasfmDrln p;t4aexomfctatlpteau o;t  etrir oo1ol e nvi tf Dum( pot0ope iocils s2umuvonu)tlxrxo3ta1latelueils)setmir nydlmeemfetls arraurpno4aeeo oeiat m2em( p (0 lerif3oa1fmtranesl( teumxo3oy1ll e fetls srtaur ou4aetomietlt m2ra( onu4trtomr iydlmDranvs s0s2uoimpnydlpeemfvsa()s2um( o;o0tleomieiatfm em(mo;u4artrmrciatlmt  uvolt0trtoim ou4ap nmies ()aDrau oot0oeenif3tltfsDem(vp u)aeeriociatlm eanvsls0trxmirpoodlpe livslsfaDta( o;t4alt  f3iadfa uanvo;u0texoif3oy1fm  aues (0 2tmxr oydolt lfcil()aDrau ooo0apto fciydfaDean o u4tlxoxr3iadla elnesls)texoimpoo1amtnmies t arrmxrpnt4texnioctls s rmnmo;t4 ltrxr tydlp rluei t) rxrimpoo4amte ictasfsDrmx o;u4aex  ociadls2el(vpn(4 ltnmrcoy1om rlues;s0 2toim3iodlltnlncs s s2ta(mpno0aptnmo3iyslmDum(vo ()tltrmr tytfp  lieols  etm(rpno1lp  lnes () 2raxm nt4aex  octysls uaumon()alxnxr ty1opt li o (0srxrio oy4lp nlnes t)a2urxmpnt1aex iieiatlmDelums t0 rtnmocia1lpD auvi;s)srtoxo3iu4lleelfvtl() Dra( p;t0alxoiietlt aDraums;(0 eerxfcty1lmDelies s)texrimpnydap emictltfs2raur ot0aetomi3tadfs rmuvsn(0artrmocoy1lmtr neo t truoxm oo4llenmietls  Dtrump;t1aetoiociydfm2ua(mpnu0tlxomo ta1oa   ivs;t) exrxmpoy1lptnlneiat arrrum nu1tle iietyd mDea( s u0 etomrciodomDe i s;( truoiopny1lm  lfetlt  Dua(mpot0aeen ictydls2rmu pn()tlenmr3ta1lmD anei;(0seurir oo1om emivsat) 2ta(mo;u1teto octyd a eln o;()trenif iytfm r nvs;s  exmxr3iy4lmt mfvs sf 2umum ;o1oeenioeilslmDuln o t0aetnir3tatomDraneols0 2urim io4llenmivtlsfsDurxmpnt4oeeo ictadfsDra(ms;(0aleoxfcty1omDrauvs ( srxmir nu4ol nlneta(  2tm(m no1alto ociydfm2um(vpnu)teeoxfcoatfpDeaivsl(  rurio nu1openlncilt)s2taxm nu0tee mociyt mDuaumpnt0aetrio oytlp   ivolt  ruoxr3iydom   fvtl( s2rmu ooo0opxo feiysfa2ulums u4trtoiocootoa rlnvsls trur(o3ou4ol   icsasf rrrumoot4tetnmoetydfsDea(mpnt0tetrxr3iydfmt lnesl( srtrxrpiydamtelfct s)sDrax pnu0tltomf3ilsfmDea(mo u0artrxr oydla rln s;() 2tr(m iy4ome mfeils aDra(rp;o1opt ifeiat s2rmu p (0 leoxo3oadom e uvs ()srxmxm io4omenmfviltfaDrrumpnt4texnifeiatfmDum(msnt4alxrmr tydfmDe neil()setoim io1omeemictat  Dra(m ;u1tpen ociydfa rlumo t0arerir3todfpD  uvo;(0srxoxo iy1oltn fctl()arumumonu1aeeomi3tadfa2ul(vsn(0aexnmf3iydlatrai i t srumir3iydaleemivil( arraurpot1altoif3tyd s uau snu0artnxfciodfm ean sls  rtrio3oy1llen neiat)a2trur ;o1olt iieiadls2ranmont4alxnmo3oy1opD anvilt)trtm(m3oo4amt lfei t arua(  ot1tlx io3iydfa2rl( p;t0 lenir oodfmtrln s;t0sexm(r io1oltn fvils) 2tm( p;t0aleo i3ilsla um(vpn(0trtomr3oadfmtr u s ( tetrim3iu4ame mivt t) 2rmxroot4optomf3tltfa2ulnvo u4arxoif oytfm eaivo t t2xrirpoodam  mnesls) 2trur nu4optnii3iadls eln s t) eeoxr3ia1opt aneilt)texm(m3nydlptelncsl(fs2rr(  no1olxnmfcias mDeluvp;(0aetoxocto1op  luvs;t  2to(m3iy1lltnlnesls) rra( pou4alenmo3iytfmDulump;t0aleoxr3iy1fatelieolt t2xr(r no1oltnlnvtlt sDtmxrp;u1tpx  ictatlmDuauvsnu) rxnirciy1fm  au s s0teurir3ou1ome mnctasfsrrrxro;u0aptniociadfs uanvs u4alerxf3oytlaDean sl(0 2um(rpnodamt lietlsfs2tm(mo;t1apxoiociytfsDuanmp t4trxrxociytfm eai s s0s2xmim3oo1omee net s)aDrru  ;u4olx micils s rlnmp u) lxoxo iatfa   iei t)t2tmxrpou1ole  nesasfsDra(m no4alt  ociydfs2ua(mp;u0 rtrio3iy1faD aueo ()s2xmir oy4lm e fvs t aDrr(r no1tpt  o3tat m ranvo;u)trtrxo3tytfate i slt) rxmir3oo4omenlieil(farrrx ont1alxomoeiydls rm( onu)teeoxo3oy1lmD anes;s0s2xmim3nu1ame  ivi (fa2ra(rpno0aetnmi3ild m2raumpnt)alxoxo3iydlp  aies;s tetrxr3nu1al elivsa( arumumpou0teeo ictydfm2um(vp;t)trtoxfciy1oat  u i s teto(o3iodlmtemivtas)sDuaxr nt0tpeomfciadfs uaumsnu0texrmoctytopt auvsls)tetoxopoy4am  lfesas  2rmx ont1ape ifeiltls eluvs t4 rtnxr oadlpD aivs (0seumim3oydal  lnci s s2rau  ou0aetn oetld m2emnms;t0arxrmo3tatfm r uvol(  exmir nudopee fesatfaDtrxr ;t4optomi3iadla2eln s;u0altrmrcoydfpteaueil(0teuoxrpnu1am   fvils sDur(rpno4tpxoio3tys a ul(vs t)alxoir3oytlatran s;s) exoxr3oo4lp  lnvsat aruaxrooo0oeeoii3ils s2ra(msn(4 rtoif iytfpDelueil() 2trirpno4lp emnvtasf Dtm(ront4oleomietadfm2emumpnt4aexoif3oatfpteanvolt) rxrim oo4om n iei ( sDum( p;o4oltniictyd m umuvs;u4 leoir oo1lpt  ivi () rxr(opnu4alenlnvtls a2uau pou4aet mfetlt a uauvs;t) eeomfctotfm e ieo;t trxo(o iydape mnvi () rumxmooo0tleoioctldla rm(vpn(4 etrmf3tatopte ivils teto(m3iodamtnlivi (  Drrumoou0alx  ietydlm uln s t)trtnio3oo1fptr i i;s0 rxmxr iy4al e ivs t) rtrxmpot1aexoiicilt m2eauvp;u)artrxo oytla rlueslt0trtriopou1altn ivias a2urxront4teen oeildfs uaums;u0 renir oydfatrliesl() rtrxrpiudolee fesls a2tax oou4tlxnif3iatfm rl(mo (0tltrmrcoydoaD  nvi t  2xriopiu1lp  lieta(f Dtrxr ou1tetn ietydlm eau s () renif tadlmtraneolt)setr(o nydal emnvtl()sDraxmpou1oet iietytlaDumnms;t) eerxr tytlmtraivo s trur(r3io1om   ictasfs2tm(r oo4optn ociyd sDraumo u0tetrmrcoadfm eli sls) 2tmxm ny1lleemivtlt)s2uaumpnu0oltnmo3tyd s ea(vsnt)tltoxo oy1lmteli s;(  2xo(mpny4oleelnciltfsDtm( o;u4olxn i3iyt a2ea( pn()alxnxf3oydlm   nvi;()trtr(opno1lp n net t)s2um(r ;o4opxo icilsfa uauvs (0artrxo3oydlpt ln o;s trtoxm3oy4llenmneta(f 2rm(rpnu0apen f3ilslsDumump;t4tlxoiociodlat aueo;()srtoimpou1lpee ict s)sDrr(ro;t1altn o3tysfs2elu o;t0teeoio3ty1lpt anvi;s)trto(m io4lpt lici s)srtr(m ;t1oex  ociadlmDeau s t4 etnxf3oatom rluvils) 2xo(m oudlme lfvsltfarumu  nt1oee mfcilsfsDrln s;u0 etnmo io1opDran i;s s2xmxm3io4lpeemnes s a2raxr ;u4ope iociytfaDuluvo;u)texnxoctadlpt  uei;t0srum(m3nu4lltnlncsls)s2raumont0alx iictadlmDemu o;u4areoxr3oa1faDrlies;()texrxr iu4lp emfvsl(farua(r nt4oexomociyt sDraumpnu)arxrmrciodfpDeaiei;t0 2tmxr iy4omeelneilsfa2trumo;o1tpxnmoeiaslm2emnvo;()aetrif iatfpt auesls s2uoxm nu1ll elicil(fsrrmx p;o0opxniietas m elumpnu0aetoxr3io1faDeau ilt)srtoxr iudaptnmfvi (fsDuax  ;t0tpt  oetytfaDelnmpnu4aexrxf ia1laDrlnes;s  2toxo3no1amtemfvias srrm(mont0tpe mi3ias sDem(vs u0 exnmfcoatom eai ilt0tetmiopnu4opeemfci t)sruaxm ;u4alenif3ils s2umn o t0aetnio iodfmt auvi (0 rtm(o3iydomtemnvtas  Drr(m ou1aetnifeiatfm2um(vpn(4 exoiocto1opD  nvs t tetoxo3no1openlicsas arumumo;o0aleoifctlt s eluvpn()aexomocoydfmtr uvols teuo(r no4lpen nvtl(f rrr( oot1oexnmf3tltfa2emn s u0tetnircoatlp elu i;s0trxmimpiodol   feslt  2rmum ou0texniociydls ua(vs;t0alxnmr oydla rau ils0texoiopiy4op elnvi (fsDumx oot0oet ifeiltla eaumo;u0tltnxo iytlpDeluvo t s2tr(r3ny4lm  mivt tfarurur oo4teenmo3iatfm umuvo u4 renmr to1fpD  uvilt)srtmxo iodope lnetlsf 2umxrono4alxn fetys m emnvpn() eenif3oydomteluvi;s0trtoim3iu4ameemnet t arta(m nu0apx mociytlm2rmuvs;t4 eeoxr3oodop rlnei;s)truoim3iodomtemivt sfsrtmumo;o0tetnmfctys sDulnmsn(4trtnifcoadlptranvi t0t2xm(o3ny1ape liviatfa2rax  no0tptn ictlsfsDra(vsnt0 leoxrcoodlaDeaivs;t0teuo(o ou1lp   nesl(fa2um(  ou0oex iieiat m elums;(0tltoir3iydoate uvslt s2uoxr ny4al n nvsltf Dtrxm oo0aeenifciat s2emuvo t)aexrmf3io1optr neil(0teto(o ny1apt mnvils aDta(rpnt0olxniiciydfsDranms (0 eermr oydfm e nvs;(0trtmxmpnodlm nlnci ()sDrrxm oo1tlxoioetyd aDul(vs;t) renmf iadfmDr n il(0trxo(o3iydll elncsa()a2rmuro;u1olxnmfeildlsDem(mo u) lerxf3oatomt livolt  euo(o oydapt lfviasf rrrx p;t4oeen ocild s em(ms;t0aetnxf3oytoatrlnvsls  euoxr3nudap   ncsasfs2umumo;o1apxo oeiltlsDeau p ()aetnifcoo1oaDelu slt  rtm(mpio4lpe mfviatfsrua(  ot1open f3iasfm2rmums;()trtnxfcoa1fa r n i;s0 2xoir3ou4lm e fviat)srumxrpno1tleoioetysls2emuvp;(0 renxf3tydfa  lueilt0teumxopiodlle  ivs t  Drrxm ou1tlto f3ild s2umnmo t0alxrmr oa1laD aueslt0srtoxm ou4lpenliet sfarrrxm nt0ale if3tydls2rauvp;(0texoxo tadfaDr neo;t0 euoim iydom nlnvslt a2tmu pno1apxo fciydfsDranmo;t)trenxoctatfmDeli i t0t2xmio3iydapeemics t)a2umumo;t1oet mfciatls ul(vs u0aexrxocio1opD aivi s0t2trimpoy1opt lnvtl()s2tmxm nt0oexniictydfaDuanvo;t) reoxr tadop rlneo;t)tetm(o oudapenmfei s)sDrm( p;u0teto fctad aDrm( pnt)tlxomo3to1op rlu slt0s2urxm3ou4amtn nvtlsf 2tmur ;t1tet miciyt mDul(mo () rtnio3tadomtelivsls) exrim3oodamtelnvsl(fsrtau poo4tee io3iad s ran pnu0tleoxr iydoateluvs s0trurxm nu4olenlncslt)a2uru  ot4aptoio3tas a2umums (0texnxf ta1fmtr iei;()trtoio3iodlm nmieta(  2taum ;o1aex iociadfsDrauvonu4 eeoiocoydlmtranesls0 rum(r3oudal emivt t a2umxm nt4apt ioeiysla rmuvp;()arxrmr to1omtran sls0 etr(rpou1omee ivs t)arraum ;t4aptoifcilsfsDumu p u0alxoif io1lpD anesls) eto(o ou4apen nci ()s2raxrpot0tetn f3tatfsDrlnvo (0alxomrcoadomD  i o t  rur(opnydomee neiasfsrrau o;u4teen fciytfs2em(vp;() lxomo3ia1opDr nvo;(  rum(o3ny4openlneta() Dumum nt1open fetyd a uaumo (4 renio3oytlmte i o ()teurio no1altnlfctas)sDuaxm ;t1tlt ifeilslaDea( o;()tltrmf iydlm ran i t0srtmir ou1lm n ivs t arraxr nt0ole iictltls ra( o;(4aleoio3iydlpt lnvils)s2xr(r3ny4lm  lnvtl()a2urump;t1tlx if3ilsfs2eaumsnt)tetnxrciy1la   n i s0 exo(r ou4alt mnviat sruru  ;u1oexomi3tytfm eanvsn(4aexnir tatfaDrlnvi () etrim iydlptnlnvtl()s2tauro;u0optn octad a2el( pnu4 lenifciydlp ean o s)s2umxo ou1omt mivt s  2uau  nu0aee ioeiyt s2umuvs u)tlxomo tatfptelneolt0 exm(rpno1lleelictl()sDur(moou0oexnifciatfm2rm( p t0 rerxf oy1faDeau slt0 2trim nu4optn nes (f Dtrumpnt1oee ioeiatla rmnvs;t4 renmrcoo1lpD  u i ()srurio3iydop n nvi t)sDrr( p;t4opx mi3iltfm2eln o;(4artoif3ootomDr i s;s0 2xr(rpiy1llenmneiat)s2um(mp;t0aeeo ieilsfs ra(mo;u4altoirciotlmD luvs t trxriopou4ameemnei s) Dtrxro;u4oexo fetatfm2rln s t4 exrir3oodlptr uvils)s2tr(mpny4amtn iesat)aDrruro;o0opxnmoeildfmDea( s;() reoio oa1fp raueo;t)texmxm nu4lmenmnci (  Dta(rpnu4alxomoeiatlsDulums;t4trxnxr tydlpte iei;t0 2uo(r oodlmeelfciat)sDuau pnt4oeeomi3iysla rmums;u0aetnirctydopteaues (0sexo(o no4al nmivta( arraum ou4tpxo ietadla2ulnmo;u)trerxrcoo1laDrai olt0 2tmxopiu4ll e fcsa(farururpou0altomieild aDra(vp;u4 renxf3iodlm r n o t)srtoirpoodapt mnviat  rrrxm ;t0alxnmietydlmDem( p u4tltnxocia1lp r ues;()t2ur(o iudll e fctl()arrr(moou1oltn fciadls uluvp t4trtrxo3io1fmDeanvo;s t2trxm nodole  nvs s)aDumumooo0apeo ociatfa2rlumsn(0texnxrcoatlm e ivi;s)srxoirpoy1ll e icsa( a2ua(  ou1alt  fetldlm ulump ()tlxomo oytfa  luei t)sexmxo3oudlle  fvta( arraxro;t1tetnifeiyt s rl(mp t0trxoioctydlmD luvo;(0s2tmxr3ny1lpt mnetl(fa2ra(rp;u0tlxniieildlm2rmnmsnt0 rxnir3iydfmtraieo (0tetrxm oo4lmen nvil( sDrmxmpnt1olen oeilsfs rmuvsnt0 eeoio tatfa r iei ( texoiopio1al nmncslt) Drmxm no1olxnifetatlm rlums u)tlxrif tadfatr nvil()s2xr(opiydaptemivs ( sDumxroot1oexo i3iadla2uanvp (0 etomr3oa1lmD luei;(  rtoxr3iu1amtnmivsl()s2tau o;o1oleomf3iltla uluvp;u0tltrmr oodopteaueo;t0 rxoim3oy1lp nmnetlt  2tau  ;o0tee  feiad m ea( pn(4treomfciodfptelu s;( s2toimpnodope  fvsls)sDua(monu1alxoifeiasfs rl( s;u)trtnif io1fpt aiesl(0 eurim iydaltnlnct t) 2uaxroou1tltomietat m elnvs u4aexnmfcoadlateluvs;t0 2uo(rpoo1ame mfcs sfaDrrumono4opeomo3iydfs2ul(mo t4trxrmf tytopt  ueo ()texoxr3nu4op elfvtl() 2tr(r ;t0tpxo oetltlaDra( s;t0tlxomf3iy1fatean s s)s2xmir oo4lme mnvi ()a2tr(  ;u1tetniociyslm2uauvo ()artnxr3tydoa r neo;t)s2xo(o iudope mneta(fs2rmxroou4openmf3tls m uanms (4texrio iotoptrlivi;t)seuoir iodol emncsat) rta(rooo4tpx ii3iatla ulumsnt0 etrxo3tatfpDeln s t tetrim io4optelfvs ( srtaxr ;u4alt ifciatfm ean on(0areoxf oytoa eln o s0teuoio iodlpeemncsat srraur ot1oex mfeildla2rlumon(4tetoioctodfmt an i (0trto(m3iodoptnmietlt) Dumxmpnu0tptnmfeiat mDemnvp t0tlxnmrcoy1opD livilt0 rtmio3ny4opt micilt) rra(mo;o4oltomf3iad m rmuvsnu4alxoxociydlpt anesls0 rtoimpiy4op  lfvt t) Dtr(r ot4oetnmi3iydfsDrm( s (0alxoio oodlpDrliesls  ruo(o iy4opt mnei sfsrtmur ;o0opxomfcildfs2umu p;()teeomo3tatlpt luei (0 eurio3io1oltelicslt) Dtr(ro;t4texomfcild a elumo;(0tetnifcio1lat lies ()seumimpou1lp  lictl(f 2taurpnu1teeomo3iyd a2rm( o;t0texrxf iotfptrai s s)srur(opnu4al  mfvt () rrrurpnu4apt mfeiadfaDem(ms u4aeeoxocto1fatelivs s0 rtr(mpoo4open nesasfsDraxmoou4opeomf3iltfsDrmuvs;u)aetrxociytomteau o (0 exmxopnu4optn ivil(fa2uaxr nu4aetoii3tatfsDranmo ()alxnmocta1oa  lueslt0t2toxrpiu4lltnlnvils sDrm(moot1tpt  ieiad sDrmu s u4arerxf tadlate nvols0s2tm(m3iydom emfviltf ruaump;t1tlt  oeiys sDrmn onu0arxoxr ia1lpteliei;() exr(opoo4amenlfetlt arrmum ou0tlenmietadlsDelums u0texnxf3totfate ivils)texoiopoodop nlieia( sDtaum ;t4tlt  fetldfmDuln s t)alenmfcio1fpDraueil(0srurxmpoy1lp e ivs t  2taump;o0altnii3taslmDemnvo;(4 exnmf oodom e u i;t0 2umxo3nu4op n fcta(f ruaxm ;o4alenmietldfmDuluvp;u4trtomf oodopDrai ols0s2xm(r3oo4aptelivi t)s2rrx oot0oeenifctadls rau p u)trerio iotfmD  i slt s2xrim3iodalen fvil(fs2umx pno4oexnii3iyd m2uln s () eenmf3oodop rau il(0 euo(m3io1lm e ietatfsDrru  ;t0aet mi3iysfm el(vs;u4alermr3io1lat  n s;s  etr(o iodaptelivtatf 2um(r ot1aexoiictytfaDulumsnu0 lxoiocoadlm rln o;t0 rtmxm iy4ap emnct (f rrru ont0oet ifciadlsDemu o;t0 rerir oy1fpDeau i () rtmxm3iu4lm  mnvt s srrrxr oo4tpt  ieiysla2uaumsn() lxrirctydfmD anesl(0s2uoim iu1opeemfvil()srtax pnt1apen iciyd m um(msnu0artomr iadfmtrlu o ()trum(mpou1opt mict (f 2umurpot4opx mfetatfs2uluvo;(4trxnmf3tydfmDe u i;t0sruriopiu1om elnetat) Dumurp;o1olen i3iadls2ea( p ()tetrxrctatlaD aueols s2um(o3iy4amt mieil( aDumu pno1oetniociasls2uaumon()tltoxfciy1laDelnvolt tetoxr ou4altelnciat s2tr(rpnu0ale moeiyd mDrm( s;t0tleomocoadlmDrau o;t)sruoir oudal  mfvsls s2tm(rpnu1tlt mi3tltfmDemu o (0 rxrio to1lm  auvsl()trxoxo ou1ol emfctat) 2tmu p;o0apeniictytla2ea(mont0 rtnxo ia1fatraivi;s  2xm(m3iu4ol   fct ()a2rrxmpnu1altoif3tyt sDea(vs (0arxnio3iytfp rlueslt0trxr(o3nudlp  mieil(fs2ur( o;u0tptoiociasfa2um( p;(0tltoxf3iadoatelneo;s0 rur(r oudol e ncsl() rumxmpou0oeeo f3tldlsDranmp t) ltrmoctydom r ivi s s2to(o3nu4olt  ncsls)s2umu pno4ape  fetas s2rm(vsnu)aeermfcty1la  livil() rxrio3no4oltnmieslt) 2ururp;t1texnifctytlm2elnmsn() ltnir oydomDrli i;(  2trimpio4aptn nes sf Durumooo0teeoiociys s2rmu pn()tlermo3iytfpDrluesls) 2urxrpou1ll e iet sfartaxr ot1alxniietasfsDemnvs t4artnif3iotfpte nvo t0t2xo(o ou4amte ies ( s2ur(mpoo1tlxo o3ias sDumuvon(0artnxf totlm r i sl( s2toxmpno4apeemnetatfartm( oot4tlx  ieiadfm em(ms (0aeeomrctatoa   ieil()seur(opiu4lpt lfvtlt)sruaurono1tptnmfetld mDumnvpn()aetnir tadfaDrli ils)texm(m3ny4apeemfvs sfartr( pnt0oexo fetydla2rau ont4aetomo3iy1lmtrlies;t trur(rpoudom n iesas  ruax poo1apxo f3tytlmDelu s;u4arxrir oy1opDr iei ( sruo(rpnudal nmfviat a2uru pot4texnmo3iatlaDra(msn(4trtoio io1op rlivi s)t2trir3ny4lpenlfet sf 2rrumpno4tpxoioeils s emnmpn(0aetomociydlm   nes () exm(r3ou4lpeemietlt) Drmxrpno0tpe  ietldlmDum( p (4 rtrmf iotlmD livo s  rtoxr io1amtn nvt () 2tauroot0tpe  o3iadfa rl(vont)trxnxf3todla   ies s t2ur(r3io4aptnlfvil( sDurx  no0olt iociydfm2rmnmon(0teermr iotoaDeauei;s t2trxm oy1lpt mictl() 2raumpnu4tltn feiat aDemumo;t0aetrxr3ta1fatrlieo (0texmir3iudlmenmncilt)aDrmu ooo1aeenio3iys s2rm( o u)areomfcoy1opt anvi;t  rxr(m3ny1lm  lnes t  Dumumont0tleomietldfmDul( p t)alxoir ta1faD lneo (0 rtoxo3oo4aptemicils  2umxmpnt0optn i3iltlm2rmump;(4 rxoirciadlpDeaivo t trtr(r io4ll   nvtas)aDuru oou0tetomietasfaDrln s;t)aetoircia1fpDrlneo;( tetr(r iu1ape mnvsa(  Dtrxronu4apeo fcilsfa2rlnmo;t0 exnmfcoodla elneolt) 2toim no1olt  fvt t a2tm(mpou0oexnioctadfm rl(vs t0 lerxf ta1oaDr ivo;s0srxo(r nydolee ncs tfs2tm(root4opxnmictad mDraums t0 rerifcoy1opD anvo t0 rxrxr iy4lle lfvs s sruaxr ;t1tlenmoetaslaDel(vo;u)trxomocoa1fptrluei s)teur(m3oy1opt  ncsltfsDumxr no1olx  i3iad a2ran snu4alxrxr iy1om   nvi s0s2toir nu4apen fet t)a2tr(rooo0tpe moeiydla2uauvon(4altrmf3oadomD  ivo;t) exo(m oo1ol  lfesas)a2rmxrono1olxnmfeiyd s umnvo t)tltoxrcoatoaD  uei s t2uoxm oudale  ivtlt  rrmx pno1apxoif3iasfm eanvont4tetrxrctytlaDrauvs;s seuriopiudol   nvsls sDua(rpot4tlxnmoeiatfs2rauvo t0arerir3oadop  livs;s)t2toim oy4alt mnet (f rraxmpou4tlxo o3tas s raump (0 ltoifciadfa eluvs s) rxmir nu4optnmfci tfarurxront4aet ii3ilsfa2rmu p;t)artnxo iy1fmDraneo s trtrxm io1ap  mieil(f Dtr(mpot0opx  oetatfm2umuvs;t) ltoif iatoateai o t  exmxrpnydam  licsas) rtaxm ou4oltomfctytlsDrm( s;u) eerio oa1oat ln s s trtrxo3oudlptnmictltfsDraumo;t4alxo octlsfm eanvp;t0 rxomr ty1oa   nvi (  exoxopou4lp  lfvt (fsDrrxrooo4alt  f3ildfm emnmonu0arenir tadlm eaivo ()srumxrpiu4amtnlfcs tf 2rrxr ot1alt mociydlmDel(mo;t0tlerxo3oytlmtraneols t2xoio3nydamtemfcia(fsDrr(  nu0aet  fetyt a uanmpnu0areomo3oy1op rau i t0setrxm3ou1am nmnctl(fsDurx  nt4aex ii3tatls em(vsn(0aexriociatop e u sls)trtmxo iodap   neta()a2tmxrp;o4aexnioeiaslsDran snt4 reoir3ia1lpDelnvi () 2urirpoy1ole mivs tf 2trumoot0aptnmo3iasfm2umnmonu4aeeoxocoatop r ieols0trxmxm oudol nlict () Dta(m ;u1teto fctltlaDea(mp ()tlxomo3ia1lmDrlivs (0 etoir3io1lpte nctlt  Dua(roou0tltoii3tlt mDelnvo ()altomr3iotlmtr n slt0t2xr(m iydol n fctlt)a2urxm ;t4tltnmfciad a um(mont4 ltnif totlpDr ivilt seurxm io1ap   feil(fsruaxrpot4tet io3ils mDrl(vp (4 rtomr3oa1fmtrlueols) rxoxr3oy1omtnlnvtl( sDtaxmoot0oeenmfctydfm2emnvpn()tltomo3to1opt  nvols srtr(r3ny4lp n nvsa()sDuaurpnt0tlt ii3ild a ra(mp t4tetoio oodlp rauei;t0tetr(rpny4lp nlfcsa( s2rm( pou1apenifctytfs em(vs u)tetrir iydopte ieo s trxoxmpny1lmtemnvsas)arrauroou0apxnifeiltfm2rmnvpn()trxrmoctotlmtr i ils  rxm(r iu4omtnlnvs (  rrr( pno1opx ioeiyt mDean s u4tlenxocoodoa elu s;s  2to(mpou4ap nmncsasfaDururpnu4ole moeiytlm2elnvsnt)artnxr3oy1op eaneols)seuoir3oodlpee nei (f Duru pno4oeeoifeilsfa2ea(vsnt)trenmf3tytfaDeln sls) rtrio3oudolt  fcslsfaDtrxm ;u4aleoioetlslm elnmp;t4texrmr3oytoptean olt0t2uo(r3oy4ap n netlt a2um(rp;t1ape  i3iytfs2el(vsnu0teeoif3oy1laDr uvs;()s2um(o no4apee iesat) 2urxmo;o1aptoii3ilslmDemn on(4 exnxr3oa1omDranvil( t2xo(o oy1altnmiesa() Dum( o;o0tpen i3iydlmDea( o;t0arxrio3todfmDe i i s0srxmir3iu1lptnlneiatfsDurx  ou4teen oeiyd mDulnvp (0aetnir3tytla   neo;s0 exoir3nu4llen nci t)s2ua(rpnt0texn fciytlsDeln p;t4tetomf oytlp  auei;() 2umxm oy4olenlnviltfaDtrxmpno1alxo feiydfa umn p t4teenxocia1fpD liei s0trtoio ou4am  mict s) 2trxroou1texnmfctytfm el(mpnu4aeeoio3iy1lmDrauvi s)t2urir3nudlm elfei ( s2tmxr ;t0oexn i3tadls2emnmsn(0tleriociadfp   nei s texmio iu1lme lfetlt)s2rmxmoot4tltnmf3tatlmDuln s t)artoxr3to1optean s;t srxoio3io1om emnvta()arumum ot4oex ioctyt mDrmu o t)teenio3oatfmDean o t) rtrxo3no1ole  fvil(fs2ra(  ;u0optnio3ild s2elnmsnt0 lenxocia1omDraivo (0texoxm no1optelfcs ()sDum(rpoo0ope  ietls a2eln pnt4trtrio3oa1lp  ln s t0 rxoir3iu1lmtnlneias)srtr( p;o4oeenifciat a2uan p t0tetnxfcoo1lptrlies;t t2to(rpoo1lm elnci t)artr(m no0tltoifeildls rm( p t4 rtoir oo1fpt  u i s  2uriopny4amtemiesl(f Dta(  ou4tlxn f3tltfa em( pnu)tlxrxo oodfp  auvsl(0texoim3oo4alen fci tfs2tmxr no1texnifeiadls2rm(msnt0aetoirctydlp  lies;s sruoiopiu1opt mivs t  Drrur ot4olt moeiaslm rl(mpnt)alenxoctotoateanes;() euoxopio4open fesat)s2ra(rpou1tpe ii3iyt m2rlums;u0tetomo3iadfpDrauvi t srtmirpnu4lpeemieil(fsrtru pnt4apt mictyd a2ean o;(0 eeomr iotfmte ivi ()s2urxopoodap   nvilt)srtrxmoot4openmfeiatfa umnvs (0texrirciatomD  ivo;t0srtrirpiy4lptn fetas)a2ururpou0alx  f3tas m eluvp;(0 eeoxf todlatraies;( trtr(opiydomen fet tfsDtax poo4teen ieiadla2ea(vo ()teeoxf3tydfate nvolt)srxr(m3oy1ape livt s) 2ur(roou4alxniiciytls rlumsnt)altnifciodfateaieilt0t2um(o nudopeelfcil() Durur nu4tle  oeiyt a2umn p;t4trtoxf oadoa eli i (0trurir iodom   iesat)srtaurpnu1tltomietytla2umumont)arerxocio1oa e u sl(0 exrxr nudopt miei tfsrum(m ;t4ope  iciadfs rlums t4 rtoif ootlptrlu ilt trxrir iy1lmte nctlt)a2rrur ;t1apxoiictydlmDrl(vont4 reoxr3io1fmD  i s;s  rtoxopnu4ll elivsatfsDrm( o;o4oeto fciydls2ea( ont) leoxfctytfp  lnvi;s0 etmir3nodame liet ()srtaurp;t0alxomi3ias mDem( p u4aeerxfcoytfm raivols s2xmxm3io1lmt mfvilt)s2taxrp;o1oleomfciytfs2umnmpn(4altnmf oatlp  au o;()s2toxo3nodamtnlfvtas) ruau o;o0tetnmoctytfmDrau pnu4 exnio to1opDeanvi t  ruoim3oudamt  ictat aDururpoo4alx mf3ildlmDrlnmpn(0arermfctydlp  aneo t0t2xr(o3ou1op elneias a2ur(mpnt1apx ii3iatfm2ra( p;u0alxomr3ootfp rlu o;()texr(r3iy4lpt mivsls a2taxr no4teenmfetlt s2eln o;u4tlerif3oydfmD  nesls0texoirpno4lle lfcsat)s2umx  ;o4olx ii3iyd a ulnvsnu)teermo3tydomDe u i t0trto(o oudlmen ictas aruaxm ;t0alx mo3iys a2uau s u)texnxr io1oa   ivs;( setm(opiu1lm  mnesas)s2tr(r nt1apx  f3tydfaDrlumpn() rxnifciy1optraivs s0s2toxmpoudlptemnvtlt a2uaxro;u0opxnmieils s2ulnvsnu4trxrifciy1fptraieil( t2umir iu4op   ieil(  Dumx  oo4aptnio3iltlm2eanmont4tlxomf3oa1fmDrlu s s0 eumxmpno4ap eliesasf rrrump;t1olto o3taslmDran o u4artnxrciydfaDrau s;(  2xr(r3oo4ap  mivils  2rmumoot1apxnmictysfsDrmnvp () rxrmf3oytom  liei t tetmir iy4lmenmncsas aDtmum ;u4oeenmieildla rln pnt0 leomfcoadfaD lnvi;s0srtm(m io1llt mics sf rra( p;u0opto ociydla2uluvpnu)alxrmr3oytlpDelieo t)trtoiopoodome lfcia(  Duax ooo1apto fetys mDrmnvp;t4 etnmfciydopDraivilt seumio iy1lpe  fcsat) rum( o;t4opto fciad m2rm( s;(4aexrxf3tydfm eluvil(0t2um(opio4lp   fet s)aDrmx pnt1oeeniieils mDran p;(4tlerxr iotfp eaieols srtr(r3iydam nlfctas s2ur(mono1aptoiieilsfa2ra(mo t4 reniocty1opDe uvils) 2toio3oy4amtelfvsasfsDraurp;o1tee ifetyt a uauvo u0trxnxr3oadlmt aivs;t teumxrpou1amte iesa(fsDrmu pot0tlto feilt s rmnvpn(4 rxnir ty1oa  lnes s0srxr(opiu4apenliet sfsrrmur oo1openmfeilslm2eaump (4 lerio3tatlptelivolt)truoir3nydam e nvtl( s2rmxmono0tpe  fcilslmDrm( pn(0aexrxr3ootoaD  nvo () 2tmxo ny1olte nvslt)a2rmuro;t4alxniietadfsDuanvo;(4 rerio3iotlaDe ivo () rtrxmpoy1al nmicslt) rurumpnt4tptomi3tatfs2ranmp;t4 leoif3tytfpDelnei (0seumxr3iydll elieslt)sDrau ono0alxomieiyd s2eanmp u4trerio3iytlmDe nvo (0 euoxmpoy4optelictat s2tmx o;t4tlxoioctasfm el(vpnt)texnmrciytom e nes;s)trum(rpiy4op  lietl(f 2ua(ronu1alx mfetydfa ul( ont0 exnmfcoydlp   i s;( s2uo(o3no1lmt mncsa()a2rrurooo4aeto i3iatfsDumnms u4tlxnmrcoatfa rlnei () rxmxm3nu4lltn fctl(faDum(roou0tet  f3iysla el(mo ()arerif oatlmDeanvs;s0srtm(r iodom nliet ()aDtaum ;t1ape  ieiadfm2ranvo;t4trxoxocta1fat aneo;( tetm(rpiy4aptn fct sfa2uaxm nu4opx  octasfa rlnvs ()trxrifctydfaDraiei;s seumxrpoo1ame lnctl() rua(  ot4aleo ieiydfm2um( snu4alenxfciytlaDr uei ( trurirpoo1ol nmiet t s2ua( onu0aexnmociysls2el(ms t0tltrmrctadlm elu olt)s2trxo nodlpen nvt (fa2tm(rpno1tleo ieiydfa2ul(msnt4arxnxo3iatlaDelivol( srumxr3nu4ole mietasfs2rmurp;o4tpt iicias aDea(ms (0teeoir io1lmDelies ( s2xmxm3nodlltnmncs t  rra( ooo1olxn oetydfa2uau o t0 lxomr iodlmt  ieo t teuoxm iu1omtelictls  2umuronu4alx mfeils aDul(mont0 eeoif3iodlp r ies;t)sruoxo no1al elfcil(  2ua(r ot0tlenmictydlm2uau s u4tetomo to1lp ranvi;t teuoxr3oydll n nes ()sDrauroou0tpxn o3tas a2emn o;u0trtomo3oy1laDe uvslt)srumio3nodope micta( aDtrxrpnu1aeen oetydfs rmnmont0artrxo3tydom ranesl( trtrio3iudlm   neils)srrax  no4tpt iieilsfm2ua( s;u) rtoxfcoa1fate uvils)srur(o3iydopt  fciasf 2umur ;o1aetn ieiltfm2em(mo;() rerircoatlpDeai s (0trtmxopnudomtemieias srtax pnu4aptoif3iasla2el( s t4altnmf3iydfaDrlnes t0srtm(o oy1omt lnvsas)a2rru pou1teenmictytlmDem(vpn() rtnmrcoodlat lu ilt0seurimpoo1lmtnmietltfsrtmum no1altomfeildfs eauvp u4altnxrcoadfpt  u s ()srxmim oo4llt  nctatf 2uaxr nt0apxnif3ildfm ra(vo;u4artnmf ty1om  aivilt s2um(rpiudlmtn nvsa()sDumu poo1olenmicild s2raums;t) lxoxo tytfp   neo;t)teurim3ny4am nlici (fa2tm(m ;t4olx  fcils sDul( s;(0tlenmo3ootlp raivs t  rtm(m3iu1opt  ieslsfartrurp;t0tltomoeildfaDrlnms t0 rtoio oa1fm  lueil()s2urxm no4lpenlicsl(  Dumxrono4oetn oetytfm umuvs;u4alenirciydlaDe i i s0trtoxmpiudom  lnetl(f Drm(mo;t1tpto fciasfm2ran s u0 lermf oatfp   ieslt0 2trimpoy4lm  mfvta(faDrrx  ;u1opxnifctytlmDeluvp;(4 ltnxrciadomD aivi;t)srumim nu4lmtnmnvt t s2tm( p;u0tetomieiasls ranvs;t) eermrcoodop r u o s0 2xrio iy4ale  nvs ()artrxmoot4olx if3iadls2umnvo;t4texrirciytfaDrluvo t0 2tmio ou1lmen iesas) 2rr(ro;t1alxn oeiatfa2rlnms (0alxnifcio1lmtrlieo ()trurxopny4lpeelictl()srumu onu1tle moetld m rau onu4tlxoir3oodoaDrlneo;t texrxr iy4amenmiesa( a2rm(rp;t0tltn octad m ulnmpn()treoxfctytoaD ai o t sexr(o io1lmt lnvi s sDtrump;t0teto ociytls rmuvsnt0tetomr oo1fmte neo;t0t2uriopio4ape  fet s)arurxrpoo1tlxnmicild sDuauvs;u4tetnir ootlm eaivilt srumir oo1ap emfctl(faDraump;t4olen iciadla2ul(vo;t) lenxo3iatopD lieil(0t2xriopiodop nmfcia(fa2umum nu4oetomi3ildla2um(msnt0arermr3oytfpD li ol(  rurxo no1aptemicsa()sDur(mpnt0alt iietldfsDrmuvpnt)alxrmf iy1optr nvs s0 exmiopiu4lpe  fei tfa2rr(m ou4altomi3iatls2uau p;(0trermo3iydlmteli i s0s2xm(o3iudll emfvt (faDua(moou0alx mfciys aDem(vsnu)teermr oa1optrai o;s trxoxopoy4altnmfeil(farrruro;u0tpeomfeiyt s2umnvsnu4trxoxr iadoaDelu o ( sexrimpnodol   fesl() rtr(rpoo0opeo o3iyd sDulnmp (4tetnif ty1la eanes;t0teur(opiu4lmtemnvi ( s2rmx pot0ape moeiaslm emuvs;()tleoxr oa1fatrlueo ( teumim oodapenlfvtls) 2rmx poo4apxnmfctyt s2eauvp;t)aetnio3oodfmt  nes;(  2xo(o3oy1alt licta( s2rmx pot4tex ifciatlsDulums;(4 eerxocio1omteaueo t t2uoxo ny4omtnmfcsls srtr(mont1aeto ietldlaDrln pnt4 ltrir3iy1opDeluei (0srxmim oo1aleemnes s)a2raxronu4ole mo3iyslmDum( o (4aetnmr3iodopDe uvo t)srumxrpnu1amee ncsasfsDta(r ot0tptomfctat m2umnmo;u4 eeoxr oadopDelues;()t2um(opnodop emnesltfsDra(r ot4alt mo3tlt a rmums;u4 renxfcty1fp rai sl(  etm(mpnydaltn feil() rraurpnu0apx iiciatfs rm(vp;(4aleomfcoodopD li s t)teumxr oudoleemfvs () 2uaurpou1oetomietatfa em( o;()aexoxf tatoat lneo;s seuoxrpny1op nmneil(fsDtr( o;t1tltniictld s2umumsnu4aeermfcoa1opD lu s ( t2umim iy4apt lfvtls  2ta( onu1tltnif3iadfmDumums u4artrmrciytomD  ies;( teto(o ou1om elnvtlt  2rrx  nu0aeeomo3iysfm rmnmp (4tlerxo totoptelues;s0 2umir3nydal  mict ( aDurxr ot4oee moetad s ranmpn(4 rtoir oy1faDrau ol( s2xmxrpiudal nlicsltfa2ta(rp;o4altnioctldla2rmn s u4 rxrmr3ia1optraivil()t2tmir oo1alte ivt s)srtmumono0tlen ietldfa2rlnvs (4tetnio3oadfm elu sls) rxmxr oy4amtnmietls)sDurxmonu1tltnioeild s2rmuvont)aeerio3ta1lptr nes s s2urio3io4ameelfvtatfartr( p;u4opxnmocias mDul(vp;()aetnir3tatoaDraueils setmxm3nodlm nlfvi (f 2ra(mp;t1tleoioeiyslsDul( p;u0aetoir3oy1fpteauvo;() rtrxopnodom nmfeslt aDtmxm ou1tlxoio3ias m uluvs u4 eeoircia1fmtrln o () rtm(o nu4al  lnet ()s2ua(ro;t0opxomfeildfa ra(vs;t) eerxfctytlaD  ueols) euoxo3no4ale mneil()a2rru pnt0oltoifciad m2rluvs;t4trtnio iotfmtr n s;s0 2xm(o3oo4lp e ivtas)sDur(m ;o4oltomociys mDrmnvpn()treoio tatfm eli ils)trxr(r no4op e fvslt) 2rau p;t1aeeo fciytlmDem(vs t) reriocoytopt  i i t0s2um(o oydalt livslt) 2taurooo4alxniietyd m ul(mo;()arxoxrcootfpteaueolt  2urirpou1lpt lfcias)artm( pnu4oetomfciadla rmuvp;()aetomf3oadfm rlneo;()tetrir no4al elnes (  Drau ooo4olxn iciltls rm(mpnu)arxrmr3oa1latraueolt0truo(o3nu1opee feia(farta( p;o4tlenif3iatfaDumnms t4alermr iodop eaneo;s0 2xo(r ou1lmeelnvslsfartmxm ot4tpe mieilsfa rl(vont)arxnmo iadfp  luei t0teurir3oudlmeelnetas) 2tm(monu4teeomf3ildlaDelu pn(0 etnir iy1op e uvs ()s2umim oudoptemfeiat) 2uauroou0tlxo fciadla2em(vsnt4tlxnmfctatfmtr nvsl(0 rtoxopoo4am n ivs (faDtr(  nt4aet  oetytfm elu pn()altnxrcio1la   iei s0seumxr3oudlme  icia(  rum(rp;u1aptn oetat a rl(vsn(0tetnmf3iatoat anei t)s2trxo3iudalee ici sfa2ua(rpoo1opt moctasfaDeauvp u4treoir tytlmt an il() rum(r3no1lmen ictltfsDuax  ;t0alenmoeiasfm2um(mon(4 leomf3todomDe ueo s) eumimpoo1ape licsl() rrrxr ou4aexnif3tlsfs rmnvo;(0 ltomo3oodlmte ieols) euoirpoo1amt  nvia() 2ra(root0apxomieiydfa rm( on()aexoifctatoa e u i s0t2uoxo no4llt lfcia(fa2raurp;t4altnioeiyd m2rmu pnu) renir3oy1fmDr ivi ( trxo(m3io4lmte fesl() Dumx  oo0alt iiciysfaDra( o u)treomr3oa1opt  nvi;t0 etmir3oudap e ncil(  Duru  ;u0apeoioetyt mDea(mp u4aexoifciydlaD ai o t trumxo3no4opte ncil(f 2uaurpno4olxo oetad a ra( s;(0aexnxrcto1omtr nes t)sexm(m no4om n fcils)s2rmxmo;t0oex  ietydfmDulnvont)alenmf3ia1lpt aieils) rxoio iu4olt  fcs t)sDtax o;u1oleomfciyd m em( pnu4altoxocty1lm  lnesls0t2urio3iodam  mfeils)sDtax o;u4optoioeilslaDrmuvp (0 ltrxf3iotla ranvils)s2xoiopnodlmen ivias)aDrr(rpno4open oeiadfa2um( o u)tleoxr3oo1omD lnes;(  exoirpoy1lpte fcs t)a2ta( o;t0alen ieilsfa2em(mpn(0 lxrxrctodlaDr i ols)tetrir3ou1lle  nvslt)srurxmp;t1tlxoifetyslm uanvs;t)teenir ia1fptraneo t0 2xo(rpoo1lpt  fetl(fsrrrxmono0tltomi3tld s2uluvpn(0aeerir3ty1lmD lneslt srtmir3iydlpt lnciatf Dtr(monu0alxn o3iasfsDulumpnu4aeenmr ty1omDrln i s)s2trxopoodapee icia( sDrmum nt0aeeoif3ildls2rl(ms u4 rxrir3to1fpt  uvil(0srxmxm iy1amt  ieta()sDrmx  ot4tpe ii3iytlaDum( p;t0 lerxfcoa1lmtraues (0srtrxo3nydopeelivta() rrauronu0olenmi3ildlmDel( p;u)arxrxfctytlateli i;()srxoim3oo4lm n nctas a2umum ot4tpe ifctydfsDum(vpnt0aexnmf oydoa elueolt) rxoio3oodale lnct t)a2rmxm no4tptnmiciltla umump u0teeoxf3oodlmDr i s ( trxoirpoo1am emicia(f Drax ono4ale ioeiatfsDrl( o u0artrxrciytom r ieo;s)trxo(r ny1lmtemivil(f Draumonu4oee iieiaslsDum(mo () reoif3ootoa eaies;()t2xo(rpiy1llt  ieilt)srrrxmono1tpxo f3ilsfa2eanms t0trenio3tatoaDe uvols0texr(m3nydam emictasfs2tmuroot1aet ii3tlt aDran s;()altnxo todla eluvo s0 ruoiopoy1am nlieil( a2umu ont1aeenmietldls ulump;t)tltnxf oatlpD  ueil()trxrxm nu4am emfvs t) 2rmum nu0opx  fcias a2ean o;u4aleoif totlp eauvil()t2trir nodlptnlnvils  rta(  nu1olenifciatlm2rlums (0tleomf3tytoaD livi s) exoxr3iodoptnmfct tfs2rmu  ;u1aee  fetys sDelumo u0 rtrio ia1latean s t0 eumimpno1ll  liet s arra(m no1tlxnmf3ilt a2em(vpnu4altrioctotla  aivslt0 eurim ou1lp  lfctlt arrmu  ;t0tee mo3ils mDea(vs t)tlxnxfctotomteanvsls0s2tmxm no4lle lnvi (f rraxmpoo0alxnmfctltfa ulnmo;t4 etoxf tadom  lueol( s2xoxm3oy1op elietlsf rurum oo4olen o3iytlmDemuvs (0aexnmr oydfptrli s s srtoir3iodal  lnvsat) Dum( ont4altn o3tatfs em(vo;t0tetrmr ta1omte iei;t0tetr(rpiu4op n fvslt s2tax pnt0aeeomoeiydfs ra(vo ()arxnif tydlaDr u s (0 2xmiopiudlpe  netl(fsDumxrp;o1ale  oeildlm ulnms;(4 exrio3iy1fat  uvs;t)sruoxm nodoltelncilt)aDrmx pou1aet mociyd m uau o (0 rtrif3tatlmDr u o;t  rtriopny4oltelfesas sDumxmono0oetoiociydfmDuau p u)tlerxf3ty1opD li o;s  2to(rpou4amtnlnetl(f Dtm(m ou0apx ii3iatfm2em(vs;()alerif3iytlp ran slt)sexm(r3iu4openmfct t s2trx  ;t1opx ifetas a uanms t0artrxf oy1omDrlu o s) rxoxm3iu1alenliesls)srtaxmpnt4ale mictytlm elnvon(4 eerxr oodfa   ivi ()srurio io1lle mnvil(  2rau pou1ale  icilsfa2el(ms u)tlenxfciodlpte ieolt)setoxrpnydalte ici (fsrurur oo0opxn fctasls eanvo u)tetnmo3iy1oate ivolt s2umxo3no4ll n ivsa(faDua(mp;u4alx io3iadfs2ran p u0 rerio3iotomDean s;s) rtrxrpnydlmte fcslt  rua(mpnt0aptn i3iysls umnmp;(0 rxomo3oydfaDrlnvi;(0 eur(m3io4ame lfvsls arrr(mpou1tpxoioctysfs raumpnt)teenircta1oaDrlueol()seuo(r oudlp n fcia()a2umu o;u4aeeoiicilt m2rauvsnu)artnirciotfm elu slt)srxo(opio4lm n ivt s  rtmxmoou4tptomoctys m ra(vs u0arxoif3oadomtr ies;()trtrxm3oy1am e fctlt sDur(m ou4opeoif3tasfsDem( p;(0tetomr oatopt lu o t  rxrirpno4olee ncilt sDrrx pot1tleoioctldfmDum( p;t)alxrmoctotfmtrluvsl()t2umxr nu1lmeemnvi t) rua(ront4opxomoeiys s2rmnms;(0 rtrio3iodfaDelnvo s0tetoir ou1aleelnesasf Dtmxmpno0tpt ioctasfaDumnmo;t4alxoxocoy1fpDe n i;()sruoxm iy4opee ict t a2rr( onu4oexnmiciysfa el( s;() eenio io1fmte uvsl( trxoxm oy4lptelfvilsfartmum ;u0tpx  ocilslaDem(vp u)trtnif3oy1omteau ils t2xrxmpou4lltn iesl(fa2tmumpot4opxnmoeias m2rmn p;()alenifciotom rauesl(0 2tmxmpiudal nliviat a2tmxr no1ape io3tytlsDeln pnt4trenifcootoaDrlues t0teumim3iy1am n ietat  Drrx  no4aeto oetatls2umump;t4texnmrctatoaDeanvslt)trumio iodap  lfetlt) 2uax pnt4oeenmf3ilsfs em( snu4aexrioctatfaD lu i t0s2xrxm iu1llte ictas srtmx p;t4tetomietyd mDum( snt4aetoxr3totlmtrlneo ( trtrxr3nudop e fei (  rtrump;o0teenif3tys mDrmu pnu) reomr to1fmD aies;t t2tm(opny1ol nliviat  rtmur ;t4tex mfctys a2ra( onu4 reoif tatlm e ivs;( srum(o3ny1omeelnciltfs2umxm oo0apeoio3iaslmDum(msnt4artrmo tydomD luvs (0 rumxr3nudlltelnct sfsDrr( p;o0opto oetyt s ean s t0altrxr tatomt livi (  rtmio3oodopenlfvt s sruaxro;o4oetnmfctlsfmDuanmo t0alxnif3tatlpDe uvsls0setm(r3oo4opt lfeil()arta(rp;u4tlt io3tld s2eanvsn()arxnxo3oadoptrlnvs;t  rtoirpiodllt lnvi t)arururpno4oee mi3iysfaDumums u) lxoxfcoa1lat  ues;() ruo(o iy4alt mivsas)s2urur ou0oeeomi3ildfs uln p u4teeriocoydfpDranvo;t0sexmir ou1lltemfci ( s2tm(mo;t4teeomf3iasfaDemnms;t4 etoxf iytla  aivo (0 2xo(o io1op  lfvt (fartaxmpno4teto ocilslsDem( snu0tleomf3iydomte nvilt  eurxopnudop   ieilsf 2tr( onu4tpxoioctydls2uln sn(0tlxnmfctadfp rlu s t)sruo(r iy4olee fvia( a2ra(mont0altomictld s2rln o (0alxomf iy1lptelneol( srumxm iudopt lfeil(  Duru  no0olto oeiatfs emuvo;(4artrmf3iotomtr neo t0t2urxo iydopee netas sDrruro;o1apenioeiys a ulnms (4areoio3totoa   uvslt0tetmir ny4ap elnctlsf rrmur no4oeeomo3tys sDraums u)trtnmo iydoa elieil(0truoxmpno1apte icta( s2tr(rpoo4ole  fciatfaDem(vs u0 lenmo3ty1omt  u s s0 eur(r3iodam  mfeta(faDtr( pnu4aetomieiltfsDrmumo;()texnifcoytoateau o s0seur(o3iy4olt lncilt  rrm(rpot0tle moetas a2ea(mont0trenir3io1lpDr neo s0 etrxm oo4ll   fvias  Drrx  ot1aeeoiocild m rlu pn()tlxrmf oa1lp r ies t srtm(r nu4lpeeliei ( a2ur(m ;t0oeto feiyd s2ra(mont)aeerifcty1fm rai o s0srxrimpoodol emivt (farrmxmont1alt mietls a el( o;u) etomo io1oaDeliei;t trxoirpoydlp  lfet () rrmu p;u0opxo f3ias m2ea(von(0artnxr iotlmD  uesls t2xoxo no1lmtemivsat) Drr(rono1tptn feiyd aDem(mp t0trtrxfctodoa  aivs (  2umxr iodllen fet t)s2rm(mpou0openifcildlaDua(mo t) ltrio3oa1lpteau i;(  exmio ou4oleemfvsls aDurx pnu4tlt  ociltls rl(vp;(4 rxnif3oa1fptr uvo;( sexoxm3nudamen fvilt  2rrxro;u0tpt moetadlm2emuvo;t0trxrmf3iatop r uvsl()texrimpny1lle liei (fs2rmumo;u0oexnioctas m2emnms (0trtrmociytfpt  nvs;t0setrim no4am nmnvt s)a2taurp;t1tpto oetat m2ua(mpn(4 lermoctotlmt aivols)s2urim3iu1amenmfvt s a2rrurono1open fctysla em(mo t0altoxr3totlatrlu ols)s2to(opio1ale  netas srtmxrpno4altn f3tlslm eanmpnu) ltrxr ootomD li s;t0 etmxopoy1lleelnesl(  rrmxmo;t4tlxnifetysls2um( sn()tlerif3oytlp eaivo (0teurir3iy4omenlncsa()sDtrx  ot0tleo oeildlm2ua( pn()trenir3ia1oatelneol()t2toir3io4lmee nct tf rrrx  ;u4tltn f3iydfs ulnvp ()tetoxf oatoateaivil( trxm(o3oo1lm e icsatf 2ta(rp;u1aexnmf3tldfa ulumo;()tetrif tydomt au sls0 euo(m nudamenmfviat) Duaumo;o1alx ioetldfa2rlu s;(0 etomocio1op   i s;s0texrxrpnu1oltelnet (f Dta( o;t4teeo i3iat mDumn onu0 rtrif3to1om raieils0 2trxo io1aleemietls  Durxrpnu1tex mietytlaDuluvonu0aeeomfciy1lmDe neo;() 2tr(opnudom e fct (fs2umxmont0tetn icildls2ul(vp;u0tleoxoctotfa  ln s;s s2xm(mpny4omee nvsltf rrmx pot1tpe  ieild aDuau p;(4 reomo iydfpt  i o s0 rxo(r oydame lnci ( s2taxmoot4tltoii3tytlsDulu snu0aeenxo3iydlaD  ueo t) rxoxr3iu1apeemfviasfsrurumoou0oltn ocilslm2umu sn(4areomf3io1lat luvi t)texrio ou1aleemnvslt) 2rm(mo;o1tptnmfciydlsDelnvs;u0tetnxrciadla   nvi;( trxr(rpoydlptelieil()a2ta( poo4tlxoii3ilsls umn s;t)trxrxfcta1fa r i ols0s2trio3nudapt  ici ( sDtmxr ;u1aleoiietasfaDuaumo;(0 renxf3ty1fp  luvols) exo(opoodam n netls srtmxmo;t0oexoioeilsfa2rmumpnu4aeeoxocoadoaDraies t0s2trxm no4lmtnlietat arrm(mp;o0tlx ifctydfs2emn p;u4trtnmo3iadla  au i;s trurxm iy1olee nctls)aDta(rp;o1tlto ictyslm2emuvp t)altrxf3tydla eauvol()seuoirpny4amt mfciasfa2ta(mp;t1oexoif3ildfsDeln s (0texoir3oa1optrlieo;s0 rtrio3oo4om nmivsas) rrmx onu1tpenifetyt mDranmp t4aetrmr ta1lptranei;s) rurio iydape  ictl(f rum( o;t4ope  oeiad a2em(vp ()tetoxr3ta1fpDraneilt tetoxr3ny1ol nlfes () Drrx oou0olen fctyd mDem(von(4 rxomfciydop e u i;()sruoxr3no4lpt  nei t) 2ra(rpoo0texoifcils aDrm(mp (0aexoxo3iodfm eanvs ( sexr(m3oo1amte nvtlt)s2rr(  ;u0texomieiad a2ra( p t4alxoxoctatop e ieils0tetoxm oo1aleelnctltfsDtr(r ou1tpx ifeiadfmDemnms;()aetoio3tytoptrln o s) rxoxo3iy4opt  fctl(  2rm(m oo4alx  o3iadfm ulumsnu)artnxr oa1la eaneo;(0s2tr(o iodlpe  ivtas a2tmur ot4tpt mieiat s2emu snt4trtnmo oodfatelieo s)t2toxr3iy1ape liesa(f rtrx  ;o4tpt mfeiysfs2rmnmpn(0alxnxo3oy1faDeaueil( sexoxr iy4ll   nci () 2uaump;o4alt ifcild s rau p t)trxnmrctadoa eaieslt0t2to(rpnodapenlfvils srua(ro;t0tet  f3tlslsDuaumo;t4 eermf3iadfat  uvi s trtrxo oy1op n ivsatfs2urur ;u0ope mo3iat m ul(mont4aleomr tytopteaivi ( t2uoir oydlp  mnvilt a2rmxmpnt1tpen i3iytfmDua(mo;(4aeenxf3todoat ln i;(  exmirpou1ll elfvilt srrru o;o1tleo ietlslm2ra( s u4tetnxfcoydopDrln ols)truriopnu1apt  nvi s)a2umx o;u4opeomo3iys mDrluvsnu)tetoirctotlmDeanvs s)teum(m oy1amtnlivtl(fs2ua(m ;t4aee mi3tadfa um( s;u0alxoifctadlpD livs s0 rumio3ny1lpt  fctas sDraump;t1alt mictadlmDea( s;u)alxrxf iotlptraies;(0 euo(rpnodopenlfci s  2urxr ot4oltoifetldfa ranmo u4 lenmo ta1fpDr u i ()trxr(m3iudlmt mivtls)a2rau p;t1aee  octydla eluvont0aetoiocty1lpDe u olt)trtoim3nudlpt  ictl(  rtaurpoo4aex ifeildfsDrmu pn(0 etnxfcoo1lm rai i s)sruoxo3iudop e ivsls)arrax o;t4tltoii3tldlm emnmp u0aexrmr3totfp  lu sl(0trurxr iy1apt lnvtltf 2ur(  no0openmfctyslm rmnmsnt)arxnio oo1oa r uvi s t2xr(rpny1llt mnvia() 2tmxmp;u0open i3tld s ul(vp u0aexnmfcoa1op  an il()trtmxr nudoptnmiesltfsDraumont1oee  fciydfs2ranmp (4trxnmf3iydfpt ln i;s)trtrio no1llee nctasfaDrr(m ;o1tlxnmoeiatlm2ea( p t) etoxo3oodfaD  uvs ( sexmxm iy4om e ivtat aDum(mpoo4oexo o3iadfaDran o;() rxnmr3ty1laDe neo (  2ur(mpoo1lmeelneiltf rtr(m ;o1opxnmfeiyt s elnvs;u)alermf iadlp eln ilt seurio oy1lpen ictas srtrxmono0tetnifciysfm2uauvont4teenir iatfptrlivs;(0s2umxmpno1ope lictltf 2rax oou1tltoif3iasfs2umnvsnt4 ltnmr oytoaD  iei s  exoim iy1omee fct t)s2rr( poo0tle  ictytfs2rm( s;()tltnmf3iy1lmDr ieol(0 rtoir oo1opeelies ()aDta(roou0ope ioeiytlaDranvo (0tetomfcto1fa e ieils)t2xmxr iu4lp nlfvi (  2uax p;u0oet mi3tyslm2elu o;(4 lxnmfcto1fm  aivi t setmio3ou4amtnmiei s)aDuaumpnu4oeenmo3tldlmDulnvo;u)tltnif3tadlmDe ivo;s0trtmir iu4om elneiltfsrtaxr ;u1opxomo3tad s rlumo ()arxoircoy1op e nvo;s  euoim nodop e fcs (faDrrumpot1texo o3tltfa rl(vsnt4tetriocio1fmDran i;t)srtmxr3no4ale lfcils) 2tr(r ou0oltniiciasfmDulumsnu0 ltomrciadlmDrlivolt0 2ur(o ny1am  mfei s srta(  no1optomoeiys a2emnmo t) rermf oa1oaDe i o;s)t2uoxopoy1aleemfcsls  2uaurpnt1tpt  ictadfm elumsnt4alermf3iadopDelu i (0truo(rpno1amtelfctat)artaxmpoo0tlx mo3ilt m2elu pn()trxrircta1omtr ues s)s2uriopiudolee fcta(f 2uru  ;o4oee moeilt s2el( o;t0 lerir todomDe ieo;t0 rtr(r3iudale lnci sf Drmx onu4tpto feildfmDuan on()texoirciodlmDran slt)s2toxo3nodol   ivsas sDrax o;u4apt  ocild a raums (4aexnmo3totfa raues;t)teuoio nodape lnvsat)aDur(r ou4aee iictydla2el( p ()teerxocoytfmDraieslt) exoim oudam n icta()srtmu  nu4teeoifeias m ran o (4alxrmf tydoaD lues;s0 2uoimpny1om e ncil(fa2tru ono1ole mo3iatfm raumont0tltnir3to1latraivs;(  2xr(rpoudlm emncta(fs2urxm ;u4tleo o3iatfs rmnvp;t)altrxo3tadlm r nes (0tetoxopiu1oltnmics ()a2raumono4alxn i3ildfmDrlnvs;t4 lermfctotlaD au s s)t2xr(opnudamtelictls)aDtrxm ot1aetnmfetltfm2el(vs t4 eeoxr iytfaDrln o s0s2xoxr3iudop  mnvil( s2umurpnt0aleo f3ildfmDra( s ()tlxrxo3ia1omteln sls0 eur(r oodolt lfci t s2uax  no4oex  ietyd m2ra(vo t0arermf iatopte iesls) exrxr iy1lp nlnetl()sDrm(mpnu1aleomi3iasls elump;u)altrmo3oydopD  uvo t)t2umim3ou1llenlfeslt arra( pot0tpt mfeiltlm2ulnmp;t4 eenxrcoatlaDe ivs;t)s2um(r nydalen fetltfa2ur(rooo0apx iictyt m el(msnu) eeomrciodfmDeaies;t setrxr3oo1oleemivsl() 2ur(rpot0optn ietysfaDua(mo t0texomr oo1optrauei;(0trxoir3oy1llte nvil(  2ta(rpnt4tee mfetasfs2ra(mo t0aetrxf ty1oate ivs t0trxrimpiu1aptemncs (fsDtr(r ;o1alxnmf3ilsfsDrm( o u)teerio3iadlm r uei;s)texrir oudol n ieiltfaruaumoot0tpx  fctatlsDrlnvo;t4teenxo oytlp eauei (  euoxo3no1op emfcil(  2ra(mpou0tlxnii3ils sDuln ont0areomfcoadlaD  i s ()tetr(m3oudlm   ietas  rtm(mpot4opxniieiytfmDrm(ms;t4arerxf ty1fpD  i ols srtrxo3ny1aptn netat)srrm( p;t4apt  ociytla2raums;u)trtoxf todfaD lies;s)truoxmpiodlltelfes t srtrxmoou1oeeoioeiad s2rmn o;(0 etnxr ta1fm   iei;( teurirpny4al e ictat  2umurpoo4opx  i3tysla2raumonu) eeoiocio1lm rli i s  2um(o3iu4lpenmneia(  rraumo;u0apx mfetatfm2el(mp;t4 ltomr oadla   i o;t) 2uoirpno4lmte ivils) ruaxmonu0opxo octld sDumums t4texrxfcoydlaDraiei;s0sexr(mpiydomtnlncs s  rtr(  no1teeomo3tad a eln s ()alenmf3iytlm eaneilt s2urirpoo4ame liesls aDtau onu1tle ii3iytls2el(vpnt4 ltrio3totlm   ies;( teuoxr ou4omeemfctlt a2tmump;o0oltnmo3iatfs eluvon(4trtnxr3oydomDe u o t0 2xmimpiudameelfcsat) rrmum nt1tltnii3iysfmDeau p;t) etnxo oatopD an i;t0s2tm(rpno4ap e nesas s2tmxr nu0aex mictysfm2emnms;(4tleoircoydopDrlu s s0trumxo nydomt liciat  2rax  ;o0olt ifetlslmDemump u0alxoif tatomDrluvo;t0tetoir3iy4oltelncia( a2rm(  ;u4opxn o3iadfm2uanvsn()aetnmo oytfmteluvi;() 2xm(r oodam e fvsl()s2uau poo4alx  f3tltlsDrmn o t0tlxoio oy1lpt livil(0 rtoir oydlp emivtl(farum(m nu4teeomieiasla rmn p (4 leoxfctydfmD  iesls)t2urxm oudomee icsltfaDumx onu0aetoiieilsla um(mont)artnio3ta1oa  lneo ()trur(mpnydaleelieiltfsrum( p;u4tex  fciatfmDrlnmo;u) eerif tytfpD  n s t srtmimpnydomeelfvtlt  Dtax  ou0tlxnmo3iydfmDranvs;t4alxrxocootfpteliei;t)sexmim3nydlpenlfcsl(  2umur nt1tee ii3ild aDemnmonu0alxoif ty1fmD ln ils) 2xrxo no4ope  icsasfsruaum nt4tpeo oetad s ran pn(4 rxnir3oydlpt lneo ()s2xmiopiu1op emfcsl(  2raxmono1aexomfetytfaDum(msnt4treoio oadla  ln i ( s2xoir ou4am emnes s s2ua(ro;t0oeenioeiaslmDea(mon(4 lxnxf3iy1fp rlivo;s)srto(opoo4lpt  ncs s  2tmu pot1aleo ocildfa em(vo u0aexomf3iotla  livs s s2urimpiudalenmivtls  rrrumpoo0optnmi3tltfs2eluvs;t0artnmf tatfa  au sl( setoir3oydamtnmicilt) 2um(ront4apeo i3iadlm2rmn s;t4 etomo iadop e n sls0srtrxm ny1lm  mict tfaDtrx o;u0tptn fctld s ulnvp t0aetomr ty1fpt auvs t) 2um(m oydaleemfcslt) Dum(rp;o0alxn octyt a ea(vpnt4 etnir3iotop  aues;t)s2tm(o3oo1lpe  nvt s s2ur(rono0tlen i3ils aDumuvs;(0artoxrciadfm   ieols)t2urxr3ny1lptnlncsl( aDtaxmpnu4oltomf3ild a ea( p (0artrxrctydlmt  ies;s) etoimpoo4aptnlncs sf 2rax p;o0optniiciatla2rluvpnt4alerxfcty1latraueo (0 rxrir3io1amt  ivsltfarua( o;t1tpe mfctad s2rlums (0alxrmf3oo1fmtr u slt  eto(m iu1opee 
\ No newline at end of file
@@ -0,0 +1 @@
+uei t0s2xr(r3oydlpe mfct (fs2tmur no0ape  fciyd a2uauvs t) lenmo iatlpteln o;t)s2xoxm3ny4ol  mnvs ( srrr(rp;t4tex iiciatls rlu o (4trtoirctadlpteaues;t  exmio3no1lpte nvta(f rrr(mont1tpt iiciytfmDraums u)artrir3totfpDeaivi;(0s2xmir no1lme lnvtat  2rm(rpnu0oexn o3iydfs2eaumo;u4tlenmo3oadfaDr n i;t0 rurxopoodlmt mfcsls sDrax p;u0alx mf3ildla2rmuvpnt4alxomfctatla   neo;s)srumir nudal nlicsat sDtm(  nt0apx iociadfm elnmon(0teenmrciydfmDe nvs;s t2toxm3nydlpt  icta() rtm( o;u4teenmi3iysfs2um(mo t) exomociy1fmDe ueo;s sexoxo3oo1lm e fes t)s2ururo;o1aexo ietyd sDemuvo t)aexrmrcia1latraivol(  rtm(opnudlp  lfesa(f rua(m ot1alenmoeilslmDumumo t0artnir ootla  lueilt) exmirpny4omenmicias  Dur(ro;t0altnii3ilsfsDrm(vs (4alxrxrcoadom e neols srtoxo oydol   nvtas) 2taurpot1tptnif3tydfs2umnvsn(0 ltoio3iydop ean o s0 2ur(o no4op  mnvi t aDtr(mont1aee  feiatla eluvo u4arxrmr iydlm e ues t)tetrir3ny4olenlfeilt srum(  oo1oeeo ictytfsDem(ms u0tlermr3to1fpteaieolt0trtoiopny4opee fciat  2rr(root1aee mieiyt mDemnmsnt4aetrif oodlpt an i;t  2xm(o nodamt  iciasfarrrum ;t4tpxniociadfsDul( p ()tlxnio ty1lptrlnei;s0trxrxrpoudameemivs ( srtrxr no0alxn oeiytfm2rl( o ()teeoxocootomt aivs;t0s2tr(o3iy4aleemici (f rua(  ;t0oex iicild sDrln sn(4aeerxo iytoat  uvo t0s2tmir3ou1al nmfcil() 2umum ;t1aexo ictysfsDul( p (4areoif io1oatrln o s t2xrxr oo4ll  lfcilsfsrrm(mp;t1alenmociltfs eluvp t4 exomf3todomt li slt trto(o nu1am emnvi s sDtrxro;o4aee iociadla2rlu s t)teeomociydomDe ues (  rxoim3oy4lltemiet (  2tru  nu4ope ifeiadlm emn on(0altrxfciydlp  aivo;s  rxoxopiu1ll elfvtlt s2tmxr oo4tetn ietat sDelumsn(0aetrmf3iytopDraivslt  rumxm3nodope lncsa() rrr(  ;u0oet  o3iat m emnmp;()artrifctydomDrau o;(0s2xoim ou4am n icsls  Dum(mo;u4oeeomo3iyd aDelu s (0trtrifcty1lat anei;s0texo(opny1ll   ivtas s2ra(rpot4aetoif3iysfm2rlumo;u4texrmr3oo1fm eln s;s srxoiopio4lpt miviltfarum(r ;o4optomfciat m2emn pnu0tltomf iatfaDeai ols  2xmxr3nudomte ict sfsrrrxm nt0teeoiietyt a umumpnu0tlenxf3oy1fptelu s s0 2xrim3oydlltnlncs s  2raumpnt0tpxnifeiydls rmu s;()trerircia1fpD aivsls  rtrxopny4altn iesat)srtau o;t0tet mo3iatlmDuauvp ()arxrxr3ootom e ueo;s0 exoxrpoodolt lnctat arua(mp;t4opx mi3ilt s2um( s;t0trxrio oodoptrau o;( srtmio3ou4ope mivs t)arrr(mpnt0apx  feilslsDemuvonu4artnir totfat liesl(0t2to(rpnodlm   ivt (f Dua(m nt4apeo ociat s umnmsn() lxrirctotoatr i i t  2uoiopoudamtelfcils) Drrxrpno1alx  f3iatfsDemnmp (0tleoir oodoptr nvi ( seumxopoo1oltemfvtas)a2ua(m ;u1tle  f3iad m2umu snu4artomocoodfaDe neo t) rxmir3iu1ap emfcsls)aDrau pot1apxoiietatfm2rm(mo;u0 lxnifciy1fm ranesl()s2xo(r3no4lmenlivsas  Duaxmp;o0tpe  oeildfm raums;()tetomf3oatlmteluvsl()trum(r nodalenmnet t) 2ra(r oo1aee  o3iydls rmuvp t0artrif3tytfm ean i;()teurim3oudol   netls  rtaxm ;t0aeeomoetatfa2uluvp t0 rtoxf oadlmDe ueo;( t2trio nydol n iesls  2urxrpou4opxnmociydlm2eau ont4 leoxfcto1oaDean il(  2trxm oy1ape mfcil( s2tmum no1opxnifciytla rlnms;t4tlenircio1opDrlnvs (0texmio nudlpte neilsf Duau  ;o4opxnif3ildfa2umuvo (4 ltrmr3ta1opDrlnei t truoim3ou1openmfcsltfsrrm(rpoo4ole mociasls2ranvont0aexoiociytfp r i i;() exo(rpnudal  mici () 2urxmo;t1opeo f3ilsfm2ea(vp (0aeeoxrcoa1lm e nvs s0 rurio oo4lpee ncslt)sruau  ou1teeniicils m ul(mp u0 rxnxfcootoptrln olt0seur(rpoodomtemnvia(f 2rmu ooo0aptoii3ildfmDrm(vp u0 ltoir tydfpDe ueols0s2toir iu1apt lnctl(  rta(m oo4oexnmfctltfsDul(mpn(4teenmfciatlpD  uvslt0setr(o3oo1al elivsl( srumxrp;u1tle if3iatlm ea(vp (4 lxrmrcoatomt lu ol(0 rxr(opoudole  nvilt  2ur(rp;t1tpx  o3iys s umnms;()arermr to1lpteauvs s0srur(o oy4ll e netas a2rrx p;t1alenmi3iytlaDelu s;t0aeermr oatlptraivo () exoxr3oydamen icsl()s2trx o;o1tltnifctytfa eluvp;t)aeerio3iydla e neo s  rurio3iu1apt  ivia(  rtmxm nt4oexn ietatls rl(mont4aeerxf3oo1fpD anvi;t0trtr(r3oo1oltelneiat arraum no0tlx  ictyt m rmnvp;(4altnxf tadlmDe uvo;s)s2urirpoo4amen ictl( s2rau  nt4oee  fetad a ra( s (4alxrmf3tydfaDe iesls0texrim ou1ol   icsa(f 2ur(  nt4teeo o3iltfs2umnmsnu)texnif todfa  li o (0 rxo(r3oo1ale  ivt sf rtmxr oo4oleo oeiytfmDeluvo u)aetnir3todom eaivsls0srtoirpnodlmeelncs sf rtrur ;o4aetnmfciytlsDeauvp;u)altrif3to1fp rluvi s0srumxm oydlm n feilt)aDrmx ono1tpx mfetadlaDuanvo t0alenio tatfa e n o;(0 2xmxr no1lpenlietat) rrax p;u1tlt iictysla ra(ms;u0 ltrxr3to1lm r ies t srtrio iu1omee icsat  2tru ono4oetnmociytlaDulums;()trtrif3oadfp rauvo;s) 2trxopiudlltn nciatf rrm(ronu0olxomo3iydls2rl(mpn(0alxnmf iytlm rlivi (  2uoxr nydolt  ieias)s2uaum nu4oee  feiatls2um(mo;(4 lenioctadlp eln o;s setoxr3nu1lltn ivilt a2rr(r ;u0apxnii3iyslm umnmp u0 ltoir3to1oatrluei;s0sexrxmpiudam n ivils srur(r nt4tptniieiydfm eanvon() rtrxr3tadfa   neo t)s2tmirpio1om nmfvil(f rrrurono1apto f3iytfm emnvpnu4 etrxrctodoat ln i (0srtmio ny1omee ictat aDuau  ou1opxn fciadlm um(vpn()arerxo3to1opt aues;t) 2umio3nu1opte nvsl()s2ta(mpot1openmociyt s el( snt0 rtomr tadfpt  ueslt s2uoxo3nodlp nmnvs s sDumxm oo0tle moeiytlmDua(vo u0 lxrxociytoaDrlu ilt0teur(o3nudopt livtlt) 2urx p;t4tpt if3iyd s eanvsn(4altoir todfmD aies t teuo(rpno1ol elfvi () rrm(ro;o1aex  fciadla ulumsnu0arerio tytlmD an o (0srtr(rpiu4omt  fcsas) Duau oou1oeeo icildla2ranmo (0 rtrxo to1fp  luei s srxmxmpou4lm   nvia(  Dumu p;t4oleo ieiatfa emn s;t0 eeoxr iodfmD  iesls)s2xoxopio1ol e nci t) Dumxrpot4tltoif3tyt sDemums;t)tleoxr iatoat lnvils) etoio no1oltn ics tf Dua(rpoo0tpen o3tlsfmDemu s;t4aexrmrctotlmDeluvols0s2xo(m oydoptelncs sf rumu  ou1oex moeild s ua(vs;t0 reoio ia1lmtrauvo;t0trto(r iy4op elnvs sfsrum(root1alxnmoctlsfs elums;u0 ltnxo tatoa raivi;() 2tr(m ou1omt mfcta(faruau  ;o0aeeo iciytfm uan on(4 rxnxr tydomtr u o;(  rtoio3io4lp nlfctas)srurx  nt1tlen f3iltfa rm(mo t)altnxo3oo1la rln o t t2um(mpoo1altn fcilt srrm(moou1tee moeilsfaDua( o (4 exnmo oadfpD  ueil()trxo(o nudop elietls sDrmur ;u1tleo f3iydfs2rauvp u4texoir3io1fm rau o;s) 2tmir iy4lp emfei s)sDtaumo;t1tlto o3ilt s2um(msn(0trxoif oatla eauvi (0srum(mpoodopeemnvi s  2umu ont0teto feilsfs2ea(msn(0tltnir3tatla r ivo t)texmxopoo1ale lietas srrau o;o4oet ioeiltla2rlu s;() lxrxr3iytfp r uvols0texr(opiy4ope lncsa()s2tmu oot4alxnmf3iysfm umn p (0trtnxf3iytfaDraivilt0trurim3iy1alee iciltfs2rrxmont0tpxnmo3tadla2elumo;t4trxrifctadlptelnvils sruoir3no1apee ncs s)sDtm(m nt0optn i3tat a2uanms () lenxocio1lmD li sl(0 rtoirpoy1omte nctas)aDtauro;o1tetnmictyt a2rm(vs;u)arerirctydlpt luvo t teurxrpnudam emfvil( s2ur( poo0aet moctydfs um( sn(0altoifcoytlmD  n sl(0s2xrxo3iudoptn nvt ()srua(root1optomi3iys a el( onu0trtnxfctadlp rli slt) etmxr oy1ol nmicsa(f 2tmx pnt0tlt  f3ias a umums t0tltomr ia1fpDrau slt) eurxm3nydll n fesl(f 2rr(r ;t1ole iociasfa rm(ms t0tleomo3oa1omte nvi s  2tm(r nydame mici t s2trxro;u4aeeomoeildlm rmnvsnt4artomr3oa1oa eaies;t  rtoxm3iy1amt  iesatfa2ua(rpno0olxnmoctyd m el( ont4artoircoytfp e ues s)s2tmio io1op nlnvta(fsDra(m nt4ole  ocildls2rln snu)arenmrctatoaD  i o ()srtrxr3io4apt lfes s  rua(rp;u0tleoio3iydls2eauvsn()aetrxo3iy1op elivo;t0s2xmxr no4ameemnetlt aDua( p;u0tltnmfctldlsDem( p (0tlenxo3iydfa eaueo s)srxo(mpoy4lp nmnvi t)artm( pot1apenmf3iyd s2um( s (4tetrifcta1lpteai s ( setmio iudopenmnei t  2umumonu0oexoifctadls2eanmp;t4 exomociotfmD ln s () etoxo3nu4omt  ivtl(fa2rmx o;u0aexo ieiadfs em(vs;t) ltomr3iytlpDeliei;s)s2trxr iu1ll e ictl(farurum ;u1olenmi3tldfa2uluvp u0texrxo todopDe i o;t) 2xrxm iu1amt lnvtas a2rau p;u0tlxnmieiadfaDemnvo ()arxomr oatop e uvsls) 2urxo3ny4lmenlies tfsrumx  ot1optomo3tysfm2uaumont4tlenmr3tadomtrli i;()s2uoio ou1apt miciltfa2ur(ro;o0teenmoeilsfa ulu p;t0 eeoxociy1latrlivol() 2tmxm3oo1op  micsls) 2ua(rp;u0olxnii3iydla2uau pn(4 rtomo ia1fa elueo;()t2tmxo3iodamtemivslt) Drmu ont1aee  iciasls ul( o u0texoxr iadopD  uvi;t)srxmxopnu4altnmfvil()a2trxm oo4tptnmf3ild a eluvo u) rxnmf tytlm rluvo (0seur(m3nydlm  mivta(fsrra(ro;o1tet mfeiydfsDrlnvpnu4teermo3oydla e ies () eurxo3oy4lm  lfvilsfaruaumpnu0tlx mfcilt a ulu p;u)altrmf3iadla   ueo;t  2uo(opny1altelieiasf 2ra(moot0olxnmo3iad sDrmnvs;t0aexrmo3oa1faDrai i t0trtoxmpou4lme mfci ( srurx  ou4altomfeias aDel( s;(0aetnxrciydfpD li il( s2ur(r oo1ame  iviat a2rr(mo;t1tex ioctydfaDumnvonu4tleomo todlmtr neo t) exm(o3iy4olt  iviasf Drmx pnt0tlen o3iys mDea(mo () rtnxfcto1lpD  uvsl(0 rumxo3iy4llenlict () 2tmu  ot1apx iociydla ean p;u0texnxf3iytlmte u i;t0 etoxo3ou1optn feil(  rraxmpnt4oex  oeiadla ul(vo;(0 lxnio3tadfmteluvsl(0 rur(r3ou4lptemnes tfaruax ooo0tpeomicildlm2eluvs (0tetnmociydlatraneo;s  etoxopno1om nmfctas)sDraxr ou0aex  i3tld m2umnvonu0treomr iodom e i ol( srtmio3nydalt lnciltf Duaxrono4alxnmf3iadla2rmuvon()trtrio ta1lmD  nvo;t0tetoxr3oo1amt mfcs sfa2rmuroot1oexomo3iyd mDea(vs;u0texnmr iodopteliei () 2xoimpou1alte fesa(fsDrrurpnt0teto oeiytla elnms;t4teenmo3oydopD aieilt) eumim iy1apt lieils s2rmur oo4alxoii3ild aDrlu o u)aleomo3iytfateln ols0s2tmxo3iy1llenlnesa()aDrmu p;o4ale  f3iatls2uluvpnt0 lxnxfctytoptelneolt  exmxm3iy4ome mnei t  2umu  ot1optnmfciltfsDea(vo;()teerio3oydop   nes ()s2xrxo oudam nmnvta(f Dumxrp;o0aptomoctas m umumo;u) eerxr3iotfpDr ivi;s0texr(r nu4om eliei ( s2urx  ;o0alxoifcilsfs umnvpnt) eeoif3iatfaD  u ilt0 rurimpno4amt  ieslt sDuau p;u1apenifeils a umnmsn(4 eenif oo1fa e nei ()s2xoxopiu1omen fvslsfartauro;u0apeo i3tldfs2rl(vont)artomf3ta1fpt lnvo () rtoir iu4omenlict ()a2ra(m ;t1opxnifciytls2rmnvont)texomr ia1omDelueo;(0t2um(m3oo4ll nlici (  Dtrxmpnt0aetn ictls sDeaums;u)aexnmf3tatfm   nvi;s  eur(o iu1am elnviat)a2rmu p;u1oltoif3tltfsDrlnvp;u)aexrxr3tytlmteauvol( tetrxm3ou4lpt lnvsat)a2ur(ronu0alxo oeiatlsDel( p;t4 rtoio ia1lp raieols0s2xoimpoo4apeemivias)s2tmu pot1olt mfcias m elums t4trxomrciodopDeanes s texmxo iu4omtelfetas) rtru ont0apeo i3iatfm eanvsn()artrxo oy1faD  nvi;t)seurxmpou1lm emfvtas) 2umum no4tlxn f3iyd m2rmnmon(4 exomociydfptrauvi;s)seuoxo3ny4ol e iei s)s2tmxrp;t4tlt moctydlmDrlumo;t4artoio3todfa   n i t) rxm(m3iy4amtnlfvias a2rm(monu0alx mfcias m ea( o u)tleomrctytop e uvils t2trim3nydol emict ( srrr( o;u0apeo feiydfsDemn snt4 etnxr3ta1lmtrai ol(  exoxr oo4ol   nes () Draurpoo0tltoii3ils a ulu pnt) exrxf iotom eln o (0t2xrirpio1aptemfeias)a2taurpou1aet  ietatfa rmnvs;u)aeenmr3totlp  lu s;t t2tm(opiudlpe mfeils a2rrurpnt4alto oetatfsDul(vo t)aetomf3ta1fp ranvi;s trxm(o oudap  lies ()s2uaxrpot0aex miciys s2eanvp;()tltrxr3oatop   i o;s)trumio io4lptemictlt)a2trxmoot4tlt  iciasfa2umnvon() exrxocia1fpteli s;t s2urim3oy1optnmncias  Dtrurono4tpx moctldfmDrmuvp u4altoxo tatfpDean o (0s2um(r iy4omte iesls)artmuro;o4texomi3ils mDrlnmo t)artrmr3todomDr nvo t texmim3iy4lle livtls aDua(  ;u0alto fctldfmDemnmon() exnxr totfp e nes;s0s2uo(r3io4llt mnctl()a2tax pnu0apenii3tydlsDraump;t)arxomr3to1fmD ai i t) etoxo3nu1open neias)aDumxrooo0apx moeiad s2uan p ()tetoxo ta1lpDe n s s0tetrim3nu1oleelivtl(fsDrmxrpno0tleo feiytfs rmn p (4teenmfcoatomDe ivs;()t2uoim3nodlm   ivta(f Draurpno4aet mociasfm rmn pnu4 rxrxfctodomD  ueols)trxrxopou4alt mfcs s srtm(ro;o1tet  fciatfmDemnvp;u4 rtrmr3iydla rlueslt)trxrxr oo1lpeeliviasfsruru p;t1aetnmf3tysfaDrl( p;(4tltrmr todom elivils)t2toim ny4optelnviltfa2uaxm oo4tleo ietadlsDeauvp u0tetnir to1faDran ol()srxmxo3iu4ole  ncsa( sDrm(m nt0oexnif3tad s ran o t4teeoir iadfaDrlieilt  2uoio iu4ol nmnvslsfaDraxr ;u0tpeomiciyslaDelnmp u0aexomr3iydfptr ieo;s) 2trxmpnodope lfvils) Drrx p;u1tle  f3tasfm uln s;(4 rtoif ta1fmDrlueo t)sexmxo nydomt lieil()sDuaur ot4tetn ietldfm eau o u0 eerio ta1lpt  n slt s2urxrpiu4olee iviatfsDrm(mo;t0altn oeiasfsDulnmpnt0 lerifcoytomtr ies s)s2xrir oo4omeelfcil(fs2taur ;t1olen ictltfaDeanvs;(0 rtrmrcootlpD lnvs t0sexrim oodlpee ivsl() 2tmxmpnt0altnifctat m2eaumsnu4 lenxo3iotlm eluvo;t0srurirpou4om nlnesat)s2rmxmpnt4opxn i3tadfa2emu s;u4 leoio iotfmt luvolt)s2trxo3oo1om e ietl(  rtrx oot4opt  ieils s ea(mp ()alenxo3ta1lm e neo;s)srtoir nodaltnlietat arrrx ono1oee  ieiys a2rlu p;t0 eenxrcta1la eliei;s0setm(rpno4llte fcilsf Dtmu pot4aetnmoetydfm emuvo t) ltomr3ta1fp  aivi s)s2uoir3oydap nmivilt  rrrurp;t4aex mfctatla2ulnvsn(0aetoircoatfpDelu s;s)s2tmim nudap  mfvsa(faDur(  ;t1tlx ii3tldfm2ulump u4 exnifcoodomD  ueolt0texrir3iy1altnmivs (f Drrum nt0ape mfciys a2eluvont4 lxrif ootoptrai o t0s2xmxm3io1optnmfci tfaDtaurp;o0tpen oetls m2ulu o t4trxnmf3oa1fpt au slt srumxmpnodop n nvsas s2ra(  ou0ope mfeiysfa2eauvonu0 rtnirctytlm rln sl(  2trim3oo1lmt mfctlt)srur(r ;t0aeto feiys m rlumsn()trxrir iy1laDeaieo;t trxm(m no1apen ncil( sDrmxmooo4open o3iys s2uauvo u)aexriocoadfpDr i ilt0trtoxmpno1alen ncs sfa2um(r ou0aexnmiciadlmDrmump;()aeeomociy1omDean o;s0 ruoio iudlmt lnci () Durxmo;o1oexn oeiat mDra(vp t4altoxf3ia1fpDeauei;s sruoxo ny1op   ieiat a2tr(root4oeenmf3tyd a um( o (4 lxnxr io1fp rauvi s s2xrirpio4optnmics (fa2uau o;u1tpxomiciydfm2eaumonu0teeoif3oa1fmDeauei (0 etr(opoo1ll nmncs t) 2tru poo1tpt moeiatlmDeaumo (4trtnxf3iotopD lnvils) 2xo(mpiudlp nlivil( a2urur oo4ope  i3iysfa2rl( o ()texrif3to1opt  uvo;(0tetmio3no4ope  ivs ( aDtmumpou4aeeniicildlmDumu s;t)trxoxf3iotfa  aues (0 etmxm oy1llteliesls  Dtmxmono1aetnioctytlmDumu snu0artomo ootfat liei () 2tr(opiy1ole  ivsl(faDuax p;u0ole mociyd mDemu s;(4trenxr tadfp ran i;s)srtoio iu1omeemicils srumxrp;t4opxomf3iadfs2rmumpnt0trxnxf oodfa elu il(0 rxmim nudap  micslsfa2ra(monu4opx mi3iltlaDel( s ()aetrmf oatfm  anes t)trxmim3oo1lpee ictat  2tr(  no0teeniietadlm rln s t4 ltnif3iodlaDelnvi s0 2xoirpnu1apt  fei (  2taxm ;t1oexnii3ildlm ra(vont0areomr3iytlmDr uvslt t2xoim iy1lpt  ncsltfs2rr(mpou4aleo ociadlsDelump;u)texoir3to1om  aivil( teuoimpou1lm nlieil()a2uax onu4tpe mfetldfmDem( pnt4tleoxoctotlpD lnesl(0s2xm(r3nu4openmiet sfa2ta(ro;o4tlx  fcild s2emumo;u4aetrxr3tadoaDe u s () 2xm(rpnydoleemfvils s2urxroot1apto fcilt s umums;() etoxo3oydfmD li olt)trxmxrpoudopee feils)sDuax oot4aeeo f3tyd aDran pnu)trtomf tatop eaivo;s t2trxo3oo4omt lfcsls  rrm(r ;o4tle mocils a ranmont0aetoiociatoatraneo;t)texmxr3ny1op   nes ( a2trum ;t1texniiciysfs2umu p t4 lxrir ta1lmte nvs s0trxmxr iy4lltemicta(f Dtmur ;u0tex iociasfa ul(vs;u4areoxo3iytfateaueo ( setr(opoo4lptnmfvsl( aDraur ou1teenmfciyt a2umump;u4trxomf tatfaD  neil(0s2tmxo3oy1am elncia()arurxront1oetomfeildlm2rlnmonu)trtrxr iodom rli s;(0 etmxrpiodale lfvtat srumu ono1olen oetaslaDrl(mpnt0tetnifcoo1laDran s;t  2uoxopnudale  nei t s2rm( p;t4tpx mi3iat sDrlnvp u)trermo3todfpteli o s t2xmim iu1lmeelnvtlt) 2um( p;o4oexoio3ildls ra( p;(4tltomrcoy1oatr ivi;t) 2xmxo3iodop nmnvs s) rumxmo;o1aeeoifctlslmDrlu s (4 renif totopDeanes;s)t2uoiopoy4optn neslsfa2uaxroou0oeenmictytfsDua( p u)alerxrciatlmt aieils s2xmim io4ll n nvi s  Dta(m ;t0tpxnifctlt s elnmp u4tetoircoydom eln i s) 2xrim iodlp  lictl()s2raxmonu0tex if3iasfa raumont0 eeoio ootfp  ln ols setoim3iodaptnmietltf 2tmxrp;u1aet mo3tltfa2ulnvp;t4 ltomo3tadfpteaivo;s) rxo(rpiy1lm elfet s)artrx oou1apen ieiatfaDulnmpnt4arermoctydoaDeln s s trxrxr3iu4aptnlietl( s2um(m ;o4tpto feildfs uanmpn(4aetnircia1om  anvo;(0trxoio3iydale mncsas)a2trx p;u1tlxnmociatlaDemumo;t0texnxo3iadfaDeln i s seurimpno1opeemics t artrxront1tlt mo3iltfs2rmn sn()areomo3oa1fmDrluvols)truo(o iu4ap n ncsa(  2rauro;u4tpx ioeildlmDum(mo t4texoio3oydfmt au s;t) exo(m iudlptemfvtatfa2umumpnu0opeo ociat mDelu p t0arxrmo ia1om  auvil(0s2xoxo iy1al   fctl()aDrr(r nt0aleomoeiatls2ea(vo;t4arxoxf3iadlm   nvo s seuoxr3ou4alt lfeslt)sDtaumo;o0oltomoeiyt mDeau s;u0 eeoxocio1faD lu i;t)s2tr(m oy1amt  iei tfsDtrxmoot1tet  f3iydls2emums;u)alxrxrcoatlm  ai i t0teuo(o iodlmtnlnvias)sDrmxmooo0tpe mo3iaslm ulnvonu4aetrmo3oatlptelnei;s trum(m3nudam  mfct ( sDumx oou4aexo ictydlm2rmuvo u0 etnxr3oo1laD ai o;s sruo(o iu1ap  mnvt (f Drr(  no1aptniictytfmDrmnvsnu4 exrxociy1lp eau i;s) etm(m3oy1omtemfcta(fsDrax poo1oetoif3tldls2rau o u0trtrxrcoo1late uvils0teumio3iy1lp e ivsasfsrtrx p;u0apt ifciaslm2um(mp (4artrio ia1laDe n i;s) etr(rpnu1amtelieia()sDrr(  ou0olxn oeiys sDem(mon() eerir iotfaDrlu i;t)trtmiopoo4ap nmnvt tfa2ta( pnt0oeeoif3tydfaDrlnvsnu)trtrio3oo1fmt ai s;t)t2uoirpoodlm emiesls srra(rooo0texn ociat s2em(von(0 ltnir3ootop eliei ()trtm(opoydomenlneilsfsDtmxm ;u1opt  fcilsfaDrln pn(0 eenir iodopDrli s;() rxo(opoudom  mietasf rtax  ;t0apeo iciytlaDumuvp () ltrif to1lm eli o;t seur(r3oodlle  ici s s2ua(mpoo1texn o3tlsfaDrmu o t4 exomrctytlm r n i s)sruoxmpiydlp elivtls)sDtaump;t0apxoioeiyt aDean o u0tlerxf3ta1op   n ils) rxm(rpoudamenmivsl(  2uaxmo;u4aeeo oetyd a2umn s;u4tetrifcia1fatraiei;s0srtrxo3nydamtnlfesa(  rrrx ooo4apeoiicias sDrlu pnt) lxnif oytoaD lnvo;t0teuoim3no4lltnlfciat)s2um(ronu4optoioetltlsDua( p;u) lxnmr oydfaD  n sl() exmxopno4lltelictlt)s2raurpoo0aptn ictyd m em(vs;t)texnxfcoy1oatr ivolt truoxm oydameeliei (faDum(mo;u4oltnioctysfm rm(mo;u) eermfcoy1fp rli s;s)sexo(o oo4ll   fvsl() Dtaxro;u1oexomociydfmDum(mo t) rxrir3ta1lat ln o t) eurxr3nu4ll  lfvt sfsDrrurpno4tle  fetldla rlnvp;u4 rtnxo iadlpDe n o t) rto(mpiu1llenmncs t s2ur( ont0alenif3iltfs2ra(mo u0aexrif3iatopDe u il(0t2uoir no4om  mfcs s  2rm( onu1apenifctytlm2emu o u4aexrifcia1om  luvs (0teumxr3oy1lp n fes (f rrmxmpnt4alxniiciysfm rln snt0tetnxo3tatoaDraneols t2tmimpnydoltnmfvi ()arur(m ;u1ope  o3ias a2rmu s t0alxrmo iatoateauvslt0seuo(r oy4op n nct t  2rr(moot1tee mieiysla umuvo;u0 rerxf3oodlaDeluvo t trum(r iudllenlict sfaDua( p;t1oet iociadfa rl(vonu)altomf3iotop r iei;( srtoxr no4alt mivt sf rur( ooo4teenio3iatlaDuanvpn(4trxnir3oydfaDrau i;t  rxoim3nudoptelfct sfaDuauroot4oexomieiys m2elu o t0aleoxociytomDelivs s) 2xoxm iudol nmfesatfarrrx pno1aptoifeiysfaDul(vo (0 rxoxfcia1lp rli o;(0s2uoxm io4al nmieta( srumxr ;u1aeto fcilt a rlu o;() rtoxo iatoaD ai o;t0tetoir oydapeemnvs s sDtmumooo4oetnii3tltfa ean snu4tltnxo io1fp rln s;t srurimpnu1lpee fvt (fs2rrur ;t0tltoiietltfs rluvsnu0aeermf3oytomte nei t0 etoimpoodaptemfctl(fs2uau  nu1aeeoifeiytla uanmp;(0 eeoir ia1latrln ol(0s2xm(o iu1ol e ivtls  2tm( p;u4tlto iciadfs2ul(vo t4trenxfciydomte uvs;( s2urimpnodaptnlfviat arrr(r no0tpx  fciltlaDra( onu4alenio tydlp rln sl( s2um(m3nudopee ivtls srrrurpnu1aeenmoetls a2rau p (4 etrir3tydlp eauei t  2xm(r3nydop emfcils)a2rrumo;o0opx mi3iat m2eanmsn(4 etrxocoatfmtrlivo;s)srum(r io4openmneias aDrr(  no1tpxnmictldfm2rln pnt)aetnmo oa1oaDeaneo;t srxmxo iydlmeemfes t a2rax  no0aexnmictadfm elu pnt4 leomfcootoate ies s0trumir3oodam nmnct t  Dtmu pno4tpxoiociytlmDemuvo;t) exnmrcoadfmtr ues t0s2uoirpio1optelfvia()srrau  ot1apeomieiysla2eau o;()trtrio3ia1lmDran o t)trtrxr iudlltn icil(f 2tax  ;t1texomiciltla2ea( ont4 rtrxf3ta1lmDr uei;t) eumxr iy1oltn fvt s sDtaxrpot1ope mfciys s emnmo;u4teermrciytfmDe n o ()texm(o iu4apt  fvta()a2rmxrpno4tptoiieiysfm2ranvo t0trxoxr3oydoat aneol(0 exoxr3nu1om  lfvtls srua( p;u1aeto f3iytfs rm( o t)trenio oatfm  aies (0t2to(opny1ale  ivtlt  rur(  nt0oexomi3iadfa elnmo;(0altnmociotomD aneo;(0t2xo(r3nodlpeelfet s aruax pou4aleo f3ils mDranmont4arxoiocty1fa  aneo;s) etm(m iy1lptnlnctl() Dua( pot1tlxomo3iyslsDumnvpnu0arxrxo iatfmteln i;s s2tmxr oydop emnesl()s2urump;o0tlx iociatls uanmp;()tltrif ia1omt  uvilt0teur(m io1lm n iei sfsrrrurp;o4oex iicilsfsDrm(vs (4 rxnifcoa1oaDr nvolt)seumiopou4aptemnci t s2urump;o0ape  f3iltla2eluvs;t0alxnxociatomtelieo;t texrim iydomen ncs t arumx o;t4tltn ociyslm2emnmsnu0 lxomrciotfpD aieilt t2to(rpou1amt  nvt s)sDtmxmpou0tetnioctltlaDel( pnt)arxnmr ta1latrlnvs t trtrxrpnodapenmiesl( arraxmp;o1texniociysfs umn o u4arxoiocty1oa rlueo () etmir3no4lle  nctas)aDuaxrooo4tet mo3tydlsDranmpn(0tetoirctydoat  i i s) rxoir io1lltemfvi () Drax  ou4teenmo3ildls2uan s u0aeenxo io1la  lnvs ()teuoxm oo1lptnmfesls  2rmxmont1oltoifeiydlaDem(vsnt0texoxo3tadlpt auvs t  etrxr3oydop e fvs sfsDtrxrpou1tpxn feild a2em(ms t0 rtrxrctytlpteaivols0trxoir3ou1opt lfci sfa2rm( p;t0opx  o3ildla2eluvp u0treoircoodop rlieolt) 2uoxrpoo1lm nlfesa(faDtax o;t1openiociydls ua( p (4tlenir3tadfmt  ieo ( t2xm(o oo1oltemicil( s2ta(rpou4ole mi3ildlm eaump;(4aeenxrcoo1oat anvo ( s2tmxm io1omtelneta(fsrum(m ot0tetnmfciltls2ulnvp;t4trxrmr oatoptr nei s)s2xoiopny1olee iesls)a2taum no0oee mfciys s umnmpnu) lxrxo tatfaDean s s0seuoxmpiudalte netlt)srtrurp;o0tpe iocias aDua(vp;u)teenxrciatlmDr neo;s)s2toxm ou1lmtemnet ()aDtmur oo0teenmf3iltlmDrmuvp;t4 etrmo iydlm r nvs (0t2uoiopio4oltn ncilsf Draur ;o4oet  fetltfaDeln pn()texoif tytfm rlieslt0t2xm(r oy1al  mici tfsrum( o;o0aee mo3ilslmDea( s u) etrio3oy1lpt ln s t0 rtrxr iu4lmtnlietas  rrr(rpot1olenmf3tydlsDrlu pnt0aeeoir3to1fp  aivs;s trxmim nydopee neia( arrm(monu4tpe mi3iyd s eln ont4trxoif3ty1om eaneo t)srtm(m io4lptnmivsat)srumurpou4opxoioctldla uanvpn(4tlxnmr3tatfm  livo;s0 rtmimpou4lleemnesatfa2raxm ot0apenmiciytfm rmu o;()tetrio tytoa  au s;()s2umxopou1llt  nctat a2rau  ;t0aetn octls m emnvp () ltriocoodlaDelues;()tetmir3nydol n nctls)aDtm(m ou4tetoioeiasls umn o;t4alxnxr iatopD aueo;s0sexo(o3oo4olenlnvsasfsDururoot1oetoioetydlaDrlumont0 etnxr3oydoate neils  euoxm iydlme lncilsf ruaurono0ape  o3iyt s rlumo;t)arxrmo3tatlaD an i s)trtrir ou1lpe lfeiltfsrraumpou0oet  feiatla2uanvp;(0alerxfciadlp e n s s0trumio iydlpt mnctlt) 2rm(mp;u1tex mieiaslm ranmo u)treoifcoadom  lnesl(0 eto(mpiudlpte feslt srtaumpno1aeto i3iyt m rmuvo;u)tlerxocta1fpt  ieils)s2ur(o3iudlmtnmictls s2uaum no1ape ifciyd m ul(vsnu4tetomoctytfmD lu o () 2xrim3io1ale lfvsl() 2trxm oo4opx mfcias sDea( o t4teenio3iydomt ln olt) rxoxmpno4op  mfctas s2tmum ;o1alxn fcilsls ea( s;u)tltrxo iydoa  li i;(  2xoxm3ny1lptnlicsa( sDuau ono0opxoiocias m2emnvs;u0 lenmocoatoaDelu i;s setoim3iydamen ivs tf rra( oot1opt iieiadfaDrauvsn(0alxomo3tatomtelneslt)srtr(r nudame mivtls)s2ur(mp;u1oeeo o3iaslm2elu snu)altoxr iy1lm elnvi;t srtmxopiu4op  micil(fsruax  nt4oleo fctyslsDelnms;u0aexomociytoate ieo;(0trxoim nu1lpt lncs tfa2urumono0tetoii3tld m2ul(msn(0 exrifcoatlatelivi t)t2triopnodapee netls srrm(r ;u0tex  oeilsfsDua( p t) lxomf3tydoate uvs;s) rtoim3iy1om nmict t)aDrrxr ou1olxn o3tyt a2um(msnu)alxomr3todoa   n sl()teuo(rpoo4ole mncils)aDra(mpot1alxnmieiaslaDeau p;u0tlerifcoo1fmD  nvsls) rxm(m3no4ll  mnvtat sDum(  ;t0opx  iciad m2rl(vs t)trtrxr io1la rli o;t0 rxrxo oy1olt mfetasf Dua(rpoo0aeeoio3iatlmDea(mo u)tleomf3tatfaD  ieils)texrio3ou1aleelfesas) 2ur(mpno1altoif3tysla el(vp;(4 reniocoodfptraivols0 2uoxm3iu4ol elivslt  2rr(mont4opxomociltla2rlu p t)tleomo tadfatelueil( srxrxr ny4ll nlfvsasfa2urxmpou4tpxn ieildfa ulu s t) lxomo3iatlpt livs;t)seum(rpiudomte fcia() Dur( o;o4opxo ieiyd m rluvo;u0tlxomr3ty1lm  lnei;s0texm(r iy4ap   nci t) Durx ooo1texoifciys s eauvp;(0arenmo3iodopt ln i;()setoxm3iy4ol e fvtltf Dumxrpno1alenmfetydlmDuln p;t) renifcoytfatrlneo;()truoxrpiu1op nlfcs ( srrrxr nt1olt  o3tlt sDemuvs;t)texnxfcoydom eanvilt  2xm(mpiydlptnmfvsa(faDrru ono4alxn oeiytfaDrm( ont0texoxf3todla e uesls  2urxr nu1apt  fetat)sDtr(mpno0aetn o3tlsfsDulnvo;(0arxrxf3iadfatrauesls)teto(m3ou1lp  mneiltf 2tr(m nu0aeto i3ildfsDem( snu0 leoxocoo1om raivi;s0t2toimpiu1om  lnvt s) Dua(mpnt4oltnmf3iatls ul(mp;u0 rermr oodlpDr nvs (  rtr(r iudopte ivt s) Dta(rp;o0tpxnmoeilsfmDrln p;u4 rtnir3tytom elnvi (0 eumxopiodom n nctasfsDraurono0alt  f3iaslm eauvpn()aetoir iotfate ivil(0seur(r3io4apee ictasfaDraumont0texomo3ilsfs ea(monu) rxomf oytlp  lneil( trurir3oy1amtn ietlt  rrrxmpou0altoiiciadfmDrm(mp u4 rxnxocty1faDr nvs;s t2xoim3iodol elfeiat) ruax oot1tltoiieiltla2ua(vsn(0 exnioctytopDelies;( srtr(o3ny4olee icslt srtmx  ;u0tetnmfctydla2rm(vp;t) renxo3iy1fmDeluvi;()trtm(mpoo4ole mneias)sDtr(rpot0aeenmi3iadfa ra(vo (4 rxoio ta1om  lnvi;s0 etrir oydlpt lnvil(f rrr( p;u4opxomi3iatfa2uanms () rerif iatfp elieo s)t2xmxr iu4ll elfvtls aDrr(mpnu4olxn feiyt m ulnvpnt4 exomf3tatlptrlnesl( teumxr nudap  lics ()arua(  ot4oex  ictlsfs rm( o;u0alxoxo3oy1lm raivi ( s2xoxm iydolenmnei (fsDtauroou0tle mf3tydfa ranmsn(4tlxomo iotoat  i sl(0 exrio3iydamtemfei (f 2urxmpou1texn oeilt sDra(vsn(0teeoxo oo1op rlneo s) exo(mpiodamtnmnetls srtrx pnu0oee ifetys a2ranmp ()tlerxfcootfmDeauvo;( tetoxo io4omtemnesas s2rrx  no0oex  ieiatfa ua(mo t)aetrio3oatoptr u s;t  rurim iy4olen fviltfs2urx pnu1oeenmo3iyd a2ea(vsnt0aeenio to1lp elnei;(0trxmim3iu4al nlivsat aDrrxm ou1alxnmocilsfm el( snt)arenmocty1oaD  ues;s s2xoxr oo1ap  miei sfsrrr(rpot4apeoifcils m2emump (0trtrioctodfateli i;t0tetmimpiodap   ics ()s2um(m oo0tlt  ietls mDuluvsnu4trtnxr ia1oa  auvilt s2xmim iodap nmiviatfarumxrp;t4ale ioeiydfmDrm(vp t)alxnxrcio1oaDr iei;s srtm(r iu1omee fcs t)artr(r ;o0tle  ocilsfsDraums;t0trtomo oodfp  liei t s2uoxr iy4optnlfvi ()a2tm( p;u0oee mfctad m2umumpnu) lenir3iydom eanvsls0 etmxr ny1lm e ictlsf Dra(rooo1opt ifetldlaDeanvs t4 rxoxf ty1la  lu olt s2tmxr3oo1ll e ict s) Dtmurooo4apeoiieiat s ul(mo;u4aexoif3oydlmtrai s;t0srto(m3nydolen ictas) 2umx o;o0tpt ioetadla elnvsnt)tlxnmo iotfm rlneil( srtr(o nu1omen fvtatf Drm(  ;o0tetoii3iytfa ranvo;t0alermr3ootfmDr i ilt) etoirpnu1ale mfcs s a2taxr ou4tlen fetatla2rl(vs t0 rxrxf iadomDelieo (0srumxopnu1al emicta()aDrm(mpno0alxoiictltlaDeauvs;u)aeeoio3iydoaDraiei;t  rum(opiu1alt mietl()aDtmx pnt1aptn o3iytfm rm(mon(4 eenirciadom rai ols0teurio3io4lmeelfcs t aDta(  ;t0apxomi3iltfa2ul(ms t0artrxrcoadlpDr n i t) eumio oy4omtn ieilsfsDtmx  ;t0olx io3ils mDua(vpn(4trxrifcoo1fmt  ivi (  rur(rpoy4lpt lnetls) 2tmxrpnt1tpx ifciltfaDuaumo t0aexnxociadlmt  neils0trumiopio1lltn neslt  2raxm ;u1tpt mo3tydla2rauvo u)tetoircto1op ranei;t  rxmimpno1opeelncil(fsrumx ooo1oexomoeils a el(vp;t)trxnmr3iydlmD livs;s  2trio3no1optn nesl(fa2uax p;o0ape iociysfsDeau o;()teeoio3ootomDraivs;s)t2tm(rpiy1ome  nes t sDtr( p;o0apt if3tld m eaumsnt4arenmr oa1omteaivsls0t2trxm io4am  mfeta(  Drax  oo4alenifetltfa ul(ms;u)trermocto1omte uvi (  2uo(r3iy4opt mietl( s2umu  ;t4texo iciysfs ranmont4arxrxfcoy1op r ivo ( sexm(m3ny1al nmnesas) Dtm(  ;o1aet mieiydfm elnvp;u0tetnir oadlaDrlnvo (0seurxmpiy4lmt  iet (f 2rmx ooo1altomo3tltfa2rl(vo;t0 leoxo oodopDranvils)tetmxopou4opt mici ( s2ua(roou4optoiietld s eauvont4 rxoif oadfpDrauvo;s)sexoxo3iydome liciasf rumxrono0aetomf3iydfs2rmuvp;t0 eeoxo3iadoptrln s t)t2xmxr3nu4omen neiltf Dta(r ;o0tpenmi3tadla eln p;u0aetrmf oadom rai s s) 2xm(opny4ame  fetat aDrmurpnt4tlxomiciatfsDem(msn(0tlermfcoatla eaiei ( srtmxm3oodomenlictls srua(ront1tlen fctltfs2ra( s;t4aetomr tytfmD  uvslt srxmxo oo1altnlfcsat  Drr(r nu0aex mfeiadlaDuanmp;u0altoiocoa1faDeauvil( trxmim oo4lp  mict ()a2umurpno1olxn i3iatfs2ra( snt)teenmf3oatfp   nvo t)t2xmxr no1omt mfesa(f 2umur ;o0oetn ocias m2eau pnu0 rtrif oydopte nes;t)srumio oodap  lietlt aDrmxmooo4opx mieiltfa2ea( p (4 rtoio3oytfp   ueo t0srtm(rpou1lmee ictl(f 2uru o;o1tlxnmf3tys sDea(vo (0tleoir3oadfatr ivils0sexo(r ou1alen netl()a2rmxmp;t1tpxnmi3iysla2ea(vs t)arxrmrcio1fmtrli o;t)s2tr(r nu1optemfviasfaDtmur ;u4aee io3tysfmDumuvo;t0 ltnif iydfmDrauvslt0trum(m iydap nlnesls)aDtrx o;u4tltoiictyd s2emu p;t)texrxr oatlmt lnvo s0 eur(r3iydlm emieiatfs2trxm no0apen icild a2ea( o;t0tlxomo ootlm   uvs s t2tr(r3io1opeelicslt aDtmu  nu0ope iieildlaDelu p t0alenio ty1fa e uvs;s0 rxoir oudll e fvs t)aDra(r ;u1tetoifctasfa um(vo u)aexrmr iydfmDranes s0s2tr(m oo4lltn ies tfs2rru pnu4tpx mfciat a2rlumpnt0alerxoctadlp  li s s) rxm(m oydaptelnvtl()srumxronu4tle iictldfm rm(vs;t) eerxr to1omt auvs t0 rxr(r iu4om e feil(fsrtmu  nu4ape iictlsfa2um( o;u0tetoio tytlmDeauvs;t)teuo(opnudalen fvtlt)artmxr nu1opt iociatfaDem( onu)altnmoctadlatrai olt0 2xmxmpiu4lmt  fvias)s2um(mo;u4tle ioctldfaDulnvp (4teerxo oatoaD lnvils0s2trxmpoudlme lfeiltfsDtrurp;o0olen ictytfmDum(vo;u4aetoxociadfmDrln i t)s2xo(o3nudal nlfet (fsDum(rpno1alxnmocilslsDeau snu0teerxr to1fm  lieolt) 2tmirpoo4am   fci tfsDtmurooo1teeomfciydfa rmnmp t4tltrio totomDe i olt trto(rpoudolenlfcils)aDuaur ;t1tptoioeiaslaDumuvpn() reomr3oydopte i ol() rumirpny4alenmnesl(  Drrx oou0opx ifctys sDulnmo t)tlerxo oadomDean i;(  eumio nu1lp e fvsasf Drmx p;o1opxomociatfs2um(ms;(4aeenmf3oa1fat luvs;( texo(m iy1llt mfvi t a2rr(r ou4aee mfeiat m2ulums;u4tlenmr3oydoaD li i t0s2tm(mpoo1lm emicsl(f rtrxro;t1oetn f3iyslaDea(vo;u)treomf3oadopD auvsls s2xrxmpiudope mivtlt) Dtmum nu4aetn ieiydfs2ea(vo;u)trxnircoodfp raiesls) 2xoimpnudapt mnvt ()s2rr(rpno0tle io3iat aDrmumo;(4 ltoio to1fm e nvs;s) etoxmpiu1om emiet t)srua( pnu0aexomoctasfm2ea(msn(4texrxr oy1op rluvo;(0t2xoir3oy4olt lfeslt  rtr(rpot0aetn ieiatla raumo;t0teeoxocoytoaDrauvi t0srtrxr3nydamtemfet t)sDta(m ot0oeeoiictytlmDrm(von()arxnmocoa1lp e uvs;s teur(mpnu4olte netas sDurxm ou4tleomi3ilsls umn s;u)tlenxocoydlaD li s;t0seumxo3oudamenmfcias  2rau ont1tet iiciasfs2em( s;u) ltrio3oytlmDrlueil( srtmim ny1oltn ieil( a2umu ooo0tpxnmoctys mDem( s u)alxnio3oadom   u s;t)srtm(mpoydlleemfcil( srta(r nt0olen ictltfm2rl( p;(4trxoxr oo1la rlnvo s trxr(m3iodllenlfctl( sDuru pou1alt ii3iltla2ua(msnu) exomo iatopD  u i;t)teuoirpiydome mfet (  2urxrpoo4aleo fciadlm2el(mo;u0areoioctytlmDraies s0setmxr3ny1lmeemnesas) rrmxr oo1tlxomictydfm2emn ont0 lxrxf3ia1oaDr uvi;t)s2xoxo oudomee fcilsfaDtax onu1olxomociatfs ea(vp u)tleoio3oy1optr nvo;(0 2uoim3iu1ap nmicslsf rururpnt4tpx io3iadlaDem(vp;t0altnxr3ty1lpD  n s;t)texoiopoy4ap   fvi (f Dra(moou4oltn ociytfa eaums t0 lenmo ta1opDelnvs;s) 2xmxrpnu4ole  ictat)arumx  ;t0tpe  ietltfs2umuvs;()aeerio3iotop e i i s srurim3io1lm e fei s)arurumoot0texnifciadlmDumnmo;u) rxnxf iodlpDeau slt trxoirpio4op  lfcilsfsruau o;o1tlenmi3ild sDrln p t)aexrmo io1fmt ln s s  exm(r3ny1omeemiesltf rtr(  ou1opxoio3tlt s2elnvo u0 rxomo3oatfmDe ivs ( trxrxopiu4lp n iesltfsrrm(mp;o4tpxn ocildlmDuanvp (0 ltnmf3tydom e neo;s)s2toim ou1omt mnvi t) Dtmx poo0aeeomietys m rmuvp u) eermo oo1lp rlnei;t)t2tm(mpoo1omt lneils)srtaxrpno4tet micilslmDuauvs t)tlxniociytfat  neo;s0srtr(rpny1apt lfvil( s2umumpou1optomfeilt m ea( sn(0tlxoir3oadlm eai sls  rtoxm iu1opt lfctat)s2tmuroot4aee moetltfmDel(vont)arxomfcia1faDeanes;s0 2tr(r3iy1lp n neiat  2tru  ot1tle io3iasfs ea(mo t)tlxnif3ty1latr u i;t0 2tr(m nudomtn neil()aDuru o;o4oet iieils s2eanmo;u)texomr tydoatrlu i;s0 2ur(o nu1apen ict s s2taxmpoo4oet  oeiadlm rlu s;u)tlenmociadfa r u i t0 euoir oydamen fci tf 2rmur nt1tpeomoeilsfm2uluvon(4trtoxfctatfa rai s;(0 etriopnodaltelfctls  ruaum nt1tpenmociyt m ean pn(4 exrmf oytopt  uvslt) rxmxo3oydlpen ici t arrmumpou0aeen i3iasla2rluvon()altnio3totop e neo;t0 exo(opoo4oleelivsasf rum(r ou1opx  fciadfsDum( pnt4aetrxf3tatlate u i;t0tetmxrpoo1lm elnetat)srtm( pou4oltomi3iyd sDeanms u0alxrmocty1lat ln s t t2xoim3nudapt mfeiat)arumumont1aeen iciat s ul(ms () lxrxfctotfaDrlivs s0 2xr(opiodlme lfet s) Dra(m nt4tex ifeiad a2emuvs t4arerif3oodla r ivo;t t2tm(o3nydoleemnei s aDraum nt1tptnmoctlt m eluvp;u4tltomociy1fpD  nes;s)texo(r3iy1olte fvtl( aDtrumo;o1tlxomociytfa emnmsnu4 rtoxf oatoat  uvs s)tetmxm3oo1lmt  fvsl(fa2tmum no1apxoioeiyslm ulums u)altnmr3ty1fp r nes;t trtoir3ou1al  mfetlt  2umump;t4aeenmoetldla2rm(vs;t0 lxrmo iytfaD ln s;s) eumir iodal emiesa(faDrrxmpoo1alto o3ias s2rmumpnu) renmo tydfm elueo s0t2urxr3oo4lltn ies s)aDumumoou0olx micilsfa umn pnu0tltrirctytomDe nvolt)setoxr3oo4lmt lics tfs2trumoot1opxnmf3iys sDeluvs;()aexrxf3iytomDelueo s0srurim3io4alenlivi sfaDum(mooo4opt mi3iyd m2rmnvsn(0areoxoctatfp e u i;(0setr(mpoo1ol  mnesat srrru o;o0oleo feilsls2ulu p t)alenxo3oytlat  nei;(0 2uoxmpnu4lme mfcsls)srraumoot4tetnifctas s eau pnu4trxnmrcoydfpDelies (  ruo(rpnodamt  fes s)aDrr( o;o4apxoiietlsfa2uln s;(0 rtoxf3io1la e ivo (0 etr(opoy1amte ivtltfaruaxronu1tetoioeiat a2uan s;t0teenxr3oytoat lies t)trxoirpoo4lle  fvtlt) 2rr(r oo4oeen o3iytla2rmn snt) rxoxf3tytfatelnvols trtmxopny4altn ivt (  Durumooo4ale mi3ildla ea(von()teeoxo io1fm  luvo;( seurio nu4om elnctatfaDumu  no0olt mo3iytlmDrlnmonu) ltrio3oadomtrai i;(0texoim3io4lpt lncilt) Dta(  nt1aptoifetas m uln o;t0 rermr ty1om e u s;(0 rxr(r ou1amtn icils)a2uru  no1aeen f3iyt aDua(vo;(4texnir3tatfmDr i o;t  2trxo3oydlm  mfeslsfsDtaxroou0alto i3iyslm umuvo;(0aetnir iydom rai ols tetm(r iudap e ictlt a2ta(mpnu1olxo oeiadfaDrmnmo;(0alxoxr iodopt aieo;( s2umxo3ou4opte fvilsfs2rm( ooo0olxnmoctad sDrm(vonu4 eerxr3io1fp ranei;( t2ur(opou4al nmfet (  rrrur nu1tlx ioctys s2uanvo t0aexoioctotfmDeli sl()setr(mpno4llenlncils srumxroot4tleoii3iltla2umnmo;(0tetnmr ia1lpDrli o t s2xmxm3io4ap n fetlt  2ururo;o4alx  feiytfm uanvsn(4 eeoxf3iy1lp rli i ()srxo(r3oo1apen ict ()aDum(r ;u1teeoioeiat a umnmpn()areoxf oy1lp rauvil( t2xr(o3iydolee feils) Drrurpot1apx iicildlmDrauvpnu0altrif3tydla eliei;t)t2uoxo nydomtemfvsas)aDurx  no4ale if3tltlaDem(ms;()trtomr to1laDelnvo s) rtoxm3nodlpe mnetatfarrax  nt4altnifeiadls2ra(mpnt0texrxf oy1fatrauvi;( setoxr3iu1lm   icilt aDrau  ;u4tle mfciltlaDrlumsn(0trenxo3iytfateauvi;s0texm(mpno4lpen neiat sDraxrpnu4opt mieiysla2ea(vp u0arxrif oa1fptrai i;t)t2to(o oy1lmtelncslt  2tmxmpnt1olx mf3iat mDuluvonu4 ltoxr3iadfpDr u i;( srtrim ou4al n ict ( srtaxmo;o1oex  f3tatfmDrmn s u0alerxr3tydopDeauvil( srtrxm ny1lpee ieslsf rrrx p;o4aee ioeiys mDeanvon()alerxr3iatlmteauvo;() exo(m3no1lleelfesatf 2urxrono0tpe  f3iyt m2ranmp u0tlenmfcoytfat  nvs t) rxoxo3nudolenmfvs sfsDtmxrpnt0opxomi3iysfm rmump;t)altnxocoodlmtrluvil() 2umxm3ny4ll emietatfsDrrxmpoo0aetn o3iytla ean s;u)artnmo3iy1fm   uvs t)trtoxo3iudam  lfesls)a2ua( o;u1aptnioctatfmDrlu pn() ltrmf oy1fp  anvil(0seum(rpoo4alen ivi t sDraxr nt1aex mieiysls2rln o;u)aexnif3oydoaDe n i s0texoim ou1lptn nei sfa2trxrp;u4oexoifeiad s2em(vp u0 eeoxf3ty1omtrlu s t seuo(m io4ap  lict s  Dtmx oot0optnmoctytlm2rmnms t0 ltnmf to1lp  li o t)srxmimpiudopeelnei (  2tmu oot1aet mietytlmDemn pnt)aexoir3todomtr nvo;(0 rumim io1altn fvslt)sDtmxrpnu1tpx mo3iysfm rln pnt)arenio3ia1op eai i t0seumir oy1al  miei t)a2rr(r no4texoii3tasla eau o;t4artrmrctotlmD  n s;()tetrxopoo1olte nci (f rurxm ;t1tpe  i3tatla2rl( s;(4 rtrxo3ta1fa eluei t0 etrxm3no1lltemnetat srtm(mooo0alxn i3iatfm2emums ()tetomr3iytoa e n s t0 rxrim3nu4am n fctlt s2trxmo;u0olxnifetlslmDelumpn(0 eenmrcoatoatelneolt0 exrxr oy4apen fes (f 2tau onu0olt if3tlt mDrm(mo;t4 rtoxr3oydla rauei (0t2toio ny1omtnmict ( srrm(ronu4tpe mi3iys s ea( s;t4 ltrmr3ta1omt  ues ( sruoim no4om emfct tfsruax ono1teen oetasfmDrmums;t0altrifciotlaDeaies s) exrim3iudap  lieils) Dtrxr nt1tex ifetysfa rmnms;u0trtrif3oytfa elnvi (0 rurir iu4lle  icilsf ruaxrp;t0tptn o3ilt aDrlump u0tleomr tytom rluvs;t)trumxo nudol emnvs (faruru  ou4tlenmf3tltfs2eau sn(0tltomrcoadfp rau s;s0 2xr(r oodopeemicta( srua(ronu1oleomietadlmDea(mont)trerxr oydop  aneo;s0trxr(r3iodlpe lfct t)srtrurpnu4aex mfeildfaDrlumo u0aeeoxr oo1fmDrlnvs;(0seuoxo3ou1amtnmnctlt)s2ta(m ;o0aetn feiyt s rluvs (4 ltrifcto1fp r ies (0s2tmxo3iy4alenlietas  Dur(  ot4tlx  fetls a2el(mo;t)altoxr ootlpDeaueo t0 eto(r ou4llenmict t)sDtm(m ;t4ope ioeiltls2ra(mont) eenxo3ty1omDr ieo;t0s2uriopoodamt  feiat arra(r nt0alenmoetysla emuvs ()teerxo oydfpDeauvs;( trxmiopnu1lleelivia( arrau p;t0altoiieiadfm2umums u)tltomf iydlp r iesl(0t2to(mpou1lmtnmies ( a2raxmo;u1olxnmoctlt a emnmpnu0tetrmocoadlpDrau i t)t2trir3oy1lpt  fct tfsDtaurooo1open oeiasfaDrl( sn(0trtrmf3ty1oa r u i t  exmxopnu4opt micslt)artr(  no1tltnmfetyt s2rmu snt0 rxrmo tatfaDe n i s0 2xr(o oodaptnmnci t) 2rm(  ;t4tle  o3tlt a eaumsn(4 rxoxo iodfpD  nes t)srtmxr3oo4ol nmnvi (f Drmu  ;o4apenio3tltlaDrln o;u4tlxoxr3totlat lnvols)srxoirpiydap nlieia(fs2tmx p;t1olto oetasfm ul( on()aetniociytfpD livs s t2xoir oodomeelfcias  Dumx p;o0tlt  ociytls rlnmpnt4teerif io1lm rlies;t) 2xrio oudlpe lfeiat) 2ua(ro;u4opxnio3tyd aDrm(mo;(0aeeomfctotopDe n il( srxm(o3nodamtnmivi s arumxmooo0tetoio3iydfaDumumsnu4tltnmrctotopDe iesls) 2uo(o nu4lleelfeiltf Durxrpoo4aetomocildfa2rluvo;u)arerxf3ootfp rlnvo t t2toir3nudal n fet tfsrrmx  nu4texo fctys a2uauvo u)altomo3iatlate ivil()sruoxo iy4om   fciasfarumxr ;o0olt  oeiatfaDulu s (4arxnxrcoo1lat  n ilt0srumxmpny4opeelictls)aDum(mp;u4tpt  icildfsDum(vs t4tetrxf3todlat liei t teumxrpio1llen fvslsfa2rrurooo4altoifciatlm2ranmp;u)altnio oy1fmDe n o (  2xriopnudoleemnvia(faDuaxmont1aeeoioetls aDraumsn(0texnxf3oytfaD  i i;(0sexmxopoy1lmtnlfeia(fsrtmx ont1oee mfeilt s2emuvo;t)alermfciydopDr i o t0srtoxr3iudamenlnes s) 2tmxmpot1opeoio3iad sDrlnms (0 leoxr3iytfmD aivils0srtoxm oudameelnesls srumxmpou4tpenmfetasla2emu ont4aetomf ta1fpDrln o;s)t2xrxo3io1amenliesas) rumxrono1apeomfcildfm2ua(vsn(0 eenxf3ia1fmt aieols0trtr(mpny1apt  nctat s2tau o;u0tex mietlsfaDuauvp;t)alxnif io1fm eaieilt t2xrir3ou1ap emnvt t srraxm nu1aleomoetadfmDelums;u)aexnxfciodoa  livi;s0 2umio3ou1ole  ncia(fa2tau  ;o1texnmi3ildfm rmnvsnt)tltoiocoytoptr u s;t)t2to(o oo4amt lfci (fsrtrxmo;u0aetniietadls2ulnmo t) ltnif3totfatrauvs t0 rtoim3io4opeelnvils  2urx pou1tpe  f3tysfmDrl(ms t)trtrir3tadomtrlu ols0s2xrim iu1openmnvsl(fsDtmx  oo1tpe if3ildfa2eanvs;u)treoif3oy1oa  livo s0 rto(mpoy4alee nesltfsDur( o;o0apto oetytlm ranmo;u0 rxnxfcoytlmD luvilt) rumxmpiodomtelici tfs2taumonu0aex ioeils aDuaumonu0 rxnmr tydom r ivo s t2tr(opoy4altemiesl(fs2um(rp;u4opxomoetadla2rm( s;(4 rxrmr tytlm rluvo;t0trxrim3ny1amtnmfviasfsDrm(rp;o4tee ii3tlt mDum( o;(4aexrioctotlatranvs;() etmxr no4oltn nviasfsrur( oou1oexnmoeiyd m rl(mo;(0aleoircta1om   n s;s setm(m3iy1omtemnvsl(fsrrr(rpno0ope  ieiyd s2uanmo;t0teenxr ootfmDrluei;s sexoxr no4omeemncils)srtr(mpot1aee iicils m umumpnt4 rxnxr3oadomDe n sls tetmim iu1lptemnes t) rurxro;t0oeeo fciyd m ul( sn() rxnio oytomD luvil()srur(r3nodlptemfeil()a2rmx  nt4texnmieiltfm2umuvp (0 ltnmfcio1lpt lies;s tetoxrpio1olt mnvt t) Dumxr no4opx ioetatfs umump (4trenxfctadfateln i (0srxoxrpoudolenlnvtas) rtauro;u4optnmfetltlsDrlnvonu) renxo iadlmD auvil( s2urxr3iy4lp nmiei t s2rmumpno4tpen fciatfa rmumon(4 lenmocoodfmte neolt0 2uoir3iy1am   fcsl(f ruaurpot4tpe ioeildla2uauvs (4teeomfcoa1la raivs t  2xoxm3io1om  lfcia( arur(rono1open o3iytfsDum( s t0arenif3oo1faD au olt0setmim3no4opte neia(f 2um( p;o1aee  ietatlm umnmp;u4 etomo3iadlm   ieils0t2urxrpou1ll elfctatfaDtrx  ;t1tpx  f3taslmDean snu) rxrmfcia1fa ean s s0 etr(rpoy4lmtemiet t)arrrumpou1tpenmo3iatfa eanvo;u0aexnifciydlaDeluesl()trtr(o3ny4altn ictl()sDrau  ;u0olxomf3iadlm2rauvp;t0 rxoxr io1omD au s s0srtm(rpiy4am  lncsat s2tau  ;u1oleniieiydlmDrlnvon() lxoir3ootoa eli o;( trtmxo oydapenmfetls srta(rpnt4altn o3tldfa emuvo;(4teeoxrctadlptraueils s2xoxr3io1lpt  iciltfsrraxmpoo4texo oetltla ra(vs t0tetnirciydomDrlueil(  etr(m3oudlptemfci sfarrmur oo1tpen oeiltlm2el(vs;(4 eenxr3oatomteauvils)srxoxo3iodom   fvias aDum(r ;t1tpxnmictlt sDulums u0arerir3iatfaDeaivil() rxoir3nu1aptemivi t srumurpot1oeto ieiys m eaumo;u0trxoxrctytlpDeai s ()texo(o iu4amen ncil(  2uaumono0aexoioeilslm ua( s;(0trenmfciotfm  li s;s) 2tmimpou1lle mncils) Draum ;t4tptnmicils a umn p t0 rxomo to1fmteli s;t0 2tmxm no4alt  netatfa2ta(r ou1ole iiciltla ea(mpn(0altnio3oatfmDe n s;s0srxo(opoy1lmtnlfcslt arrmum oo4aee iictyslsDrlnvs;(0 lxnmf iydfatelieil()t2urxmpiy4apte net tfsDuax pnt1tetniociys sDemu p;(0arxrifctadfpD anvol( t2to(r io4lmenmfcsasfsDtrumpot1opt  i3iyd sDrl(vont0 lxrio oo1opte ivols) ruoxmpnu1lpenlfeilt sruru ono4tlenmfetysfa2umu onu)trxoxo tytomD luvo;s)tetr(opiy4openmivs tfs2ur(mp;t1oex moeiyd aDelumo (0aetrxf io1oaDe u o ( trtoio iydolte neia(f rtrxm nu1ole mieildlsDulnvo;t0tetoxf3iatfp ean o;t  2uoxo iydlmen icslt  2rrumo;o1tetniocildlaDem(mp (4altrir iydomDeaneils) rxo(m iy1al   nviltfsrrr( p;o0aex mo3iasls2uanvon(0altrxo oytomDr u o t)setmxm3nu1om n feiat)aDta(rpnt1tetomfctysfs2ulnms (4aleoxo3todlat lnvs t0 2umxmpnu4ape lfci ()artax  ;u4ale io3ildfa elnvp;t)aetrioctadfpt  ueo;t)srtrxm3ny4ll   ics s s2umxr ou4tlxn i3iltfsDumn s;(4 lxrmf3tytlateai o;(0t2xrxo oodaptemneta( s2umx  nt0tpe ioetad a uln pnt4alermocoadlmt ai i s t2umio nu4ome livtls  Dtmur ;t4ape mfcildfa2uluvo ()arxomr oy1oa  livo;s trurxopio1om  mfcta(fs2rax onu4aet miciytfm2ul(vs (0alxrmocoatopte uvsls srtmxo3iudal  lfesat sDururono0altoii3iydfmDrau onu)artomoctadfpt luvi s teurirpiodamtnmivt (  2ur(ro;u4aleoifciyd mDumn pnt)altrmr3iytfmDrliei ()s2tr(mpoodomeemnvs s  2trxr ;u4alt  iciadlm2ulnvo ()tlxnmfciatlmt ai o;t0 ruoxr oo1lmt lncsa()aDuaxr ot4tpxn feils s rln sn(0altoir3tydlatrlnvil(0setrxrpnu1opeelfcs tfs2uru  nu1tptoif3ildfa2uan p;u4tleoiociytlp   ueslt teumim3io4alee fetl(fsrta(mo;u4tpx mi3iat aDeauvo;()trxrmo3tatfp e n ols0 exm(mpiydaleemivsltfartrxmo;o1tlto ictys s elnvo t0alerxr3iydom eai o t0 2um(r3oo1om emnvias arraxmp;u1opxn fciatla2rmuvp t) rxomr oa1omt  ivil( t2tm(o nodameelncs s) rum(  nt0tle  i3tlt mDemu p (0 rxnxf io1lmDeanvi;( tetrxr3iu4lme  ict t)sDur(m no4altniieiasfs ua(mp t)artnxf3iotla   nvs;s setoxrpny1altnlnvi tfa2uru oot0tex ioeiadlm2ean s;u4 eenir3iydlp elivi t teuoio3oudlpte ici s)s2rrxr no0tptoif3tysla2rln s u4aleoxf oydfmteaies;t0seurxr iydamtelfeia( s2urur ;o1tlxoiiciltls2ulnmp t0aexoir3totfate i ols texoxopoo1apenmiet ()a2trumoou0tptnifciytlaDra( o;u0 etrif oydfp ran i;s) euoir3ou1op  livtasf Dtm(monu1oetomoeiysls2elu o;t0artnir totlpDe uesls0 2xm(o3iudll   ivsa(fs2ra(r oo4alt io3ild mDumumo;t4altnxf ta1oatrauvs (0 2xrir3oy1alee fct s)aDrm( ont1texo ictysls2rmnvp (0 reomr3iotoa rauvo () ruoim3ou1ole  neias a2rmurp;u1tpxoii3ildlm2ea(vs u4trermo3ootopDeauvslt0srtoxm ny1lltnlfviltfs2tmu pnu4tetnmoetlsfa eln sn(0trtnxf oa1omt au i ()srtrir3ny1lp e fvsat sDrrumpnt0tpt  i3tldfaDrm(mo;u4aexrif ta1lptelivol(0trur(r ny4lpen fci (fsDrm(m ;t1ope mi3ilt aDemnmpnu0 ltrif3oydlpt lnvs t0trtoxopoo4op elneiatfarra(r ou0olt  oeiasfa umu onu0tetomf oodlmDrai sl( t2xr(r3no4ap emies t srtrur oo4aeeo octldfa2umumsnu0 rxoio3iadfmDelu i;s trxmimpio4lmtemict s s2rrx pno0apenmoetytfa emu pn(4 lxnifciydfa r uvil()trxoxopoydap   nctasf 2um(  nt0aleo feiat s raumpn(0artoxo tytfpt anvs;( srxo(r nu4optn fci t srrrxmo;o1tpe ii3tadla2elu snt)aeerir tydfmD auesls  2umxo3iudll nliei s a2umum nt0apxn o3tyt aDumu p;u0aeenxrcto1lmt aivo t  2xmiopou1ome micias) Dtmxmont1aex ifetatfa2ea(mo;(0tlenmo3iytoa   ivo t0 rur(r nudlp nli
\ No newline at end of file
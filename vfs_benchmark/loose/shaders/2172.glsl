@@ -0,0 +1 @@
+i o ( t2xrxm oo4openlfcsas srururp;o1tpe  f3iysfa2rauvont4 rtnmfcoa1fmDelivol() exoxopoo1ll  lfcta(faDururooo1alt if3iyt mDumumpnt4tltoxf3iodoa r nvil(0setrxopiu4lp n ies s  2uaxr ou0apenifciydfa2um(vp;(4 leoxr ootoatelies;() 2to(rpoodlm elietasfs2rmumono1tpx  ietldfm2uaumpnt)alermfcio1fa e ivol() eurim ou1om n ietas)aruaurp;u0alenifctadfa2ul( snu0aetnmo3tadlmte ies;s)seur(rpoydlltelncias a2umu o;t1tetnifetasfa umn onu) eeoxr3iy1om  aneil()s2urxo nu4ame lfvtlsfa2tm(mpnt1tlxnii3iad a2elnms t4 rtnircia1fmteanei ( t2xo(rpnu1omt mietasfsDrr(rooo0openmi3iltlm uanvo t4 exnifciytfp ranvols)s2umxo3ny4amenlieilt)a2raum ;o1aeen fetadlaDuan on()tltoxocoodla  an ol( texoxm no4ale  fctat)aDra(ro;u0olt mocild aDum(mpn(4trenxf iadlatrlu ol()texrxmpiudop e ivils sDta( o;u1oetnmocilsfa rlump () rtomo iatfp e nei s0trtr(opnodam elfvt (f Dua(mono4apx mfciasfmDrauvo;t4aexrxr3tytoaDelnes ()t2urimpio4lpen fes t)aDur(m ;t0olx  iciltfmDua(vonu4 ltnmfcoy1fa   n o s0t2trxo3iy4am nmfvsa( sDtmuro;u1tlxnii3tasfm2rl(vpnu4aetomf iy1la rln o s) rumio3oo1om nmnei () Dtru  ;o4tetomi3iatfa ra(vo u)aetrir iytla elnesl( trtrxm3oodlpt  nvt sf Drm(  ou4opt  oetlslaDem( o u0aexomfciodlmDranei ( seum(mpnu4lmtemfct t  2tmxm ou1tpeomieild a2rmn s u4 renmo3oydfaDr nvs;()t2tm(r oo4apenlneil(fa2raump;u4apenio3iltfsDeaumo;t) eerif oy1op  ln i;s)srxmxm3iy1lp e ics t)artmx  ot0tleoii3tatfm2rmuvpn(0altrmr3totfmtelivo;(0sexoxm3oy4lp e fei sfaDumxr nu4tlxo feiatla2rau snu0altoxrcio1oa e n o s sexoir oudoptemictltfarum(mpoo0tlxoiictldfa ul(vsnt0 etrxocty1omtelivi s)texmir3ny1om  mfet ( srtr( o;u0tpxoifciatla2ean p;u)teenxrciytlpDe ues;t0 etmirpoo4ome lfcs s srta(root1alt moetatlaDulu p u4tlxrmfcto1lptr nvs ()trxr(o oy1op nmietl(fs2uaumpno0tee iicildls umn s () exoxo3ia1oat an sls) eum(m3nu4opeelnvsa()aDtru poo1tet  oeiasfaDrlump t) lxrmociatlm   i i;(  rumxm oo4lp emnvt s) Duaurpoo1aptnmociatfm uln snu0 etrmfciatfaD  ies (  2umir3iudlpenlfvsl()s2umurpno4aetnioctldfm2eanmp (0tltrxocta1fm eluvo;s) eurxr3no1lmtemivslt)s2rrx ooo0tpt mi3tlslaDulumo;() ltnxfctydlmteaivs s t2xr(r3oodomenlict sf rumurp;u1olxomfcildfs2rau ont4tetrir3io1oaD anvo;s s2xoio3no1lmeemict t  ruru pno1oexomoctlslmDrmn s;u)trerxo iadlmD aivilt  rtmxo ny1ol  mfci s)a2rr( oot4opxomo3tyd a ranmp;t0arxrioctydlatraivi;t0 2xo(r3iodomt lnes t srtax  ;o1ape iictltla ulnmonu)altomf3oy1lpteaueolt srtoxm ou1ll   ietlt  2rmu o;t1aee mo3tadla elnvp;t0trtrir3oo1fmD ln s s0s2uo(o3iy1op e icsa(fsrrax ono0aet moctad mDea(mo () eermr oodfp   ies (0sruoirpoy4open ies ( artm(r ;u0oeeomieild aDuau s (4 rermfctotlmDr ueo ( trtrxm3oudaltnmfcsa( a2urxrpot1ole if3ias s2em( s;u)alxnxo3to1fat ln i t) rto(o iy4opeemncs t  2ur(r ou1alxoifciyd a rl(vsn()trxrxf oy1lm r i o t  2toxm3oudolt  fes (  Dumxmono4oetniociyd s2ulu sn()altnio3tatfpDrlivo t0teumimpny1lp elncsltfs2umu pno1aexo fciaslsDeauvp;()trtomocio1oateln i t trxmxo io1oleelieia()s2rrur ou1tex  fciysfm2elnvo;t) ltnmo3ta1om eln i;t)t2xm(opiu1openlfvs (fsrrauro;o1tpt mo3ilt aDrmump;(0arenmfctodlaD aues ()sexm(m no4ll elnctas srurxm ;t4alxoif3iadlaDeaums u) eeomr3tatfaDrlnvo;s s2tmxo iodoltemics s) Dtaurpoo4aleomfctysla ulums;(0tleoio tytlm r n o;s) rxm(opoodaleelnctls)arurx onu4tpe  ietasls el(ms u0arxoxfcoadlpD livslt srtmir3iu1alenlfeslsf 2tmx  ot1tetnii3iltfmDuau snt)aexoxr ta1oate n i t trurxrpio1opeemfvsatfs2trxronu1teen ietlt m um(vo;t0altnmo3tadlm  luvi;t  rumxo3io4lptnmfetas  Dtax p;o1tlxo o3ias m eanmp;(0 lxoxociytlptelnvil()setm(r ny4lp elncsatf 2umurono1opxn i3iatfm2rm(vs;u)tltoxo3oadlpDr uvi (0 2xoir3oydam n ietl( s2urxmpnt4alxnmociydlm2ra(ms u)altnif iatlmDrli o t)t2tr(rpno1om elicsl( s2tr(monu4tlx if3tytfs eluvonu)arenmfctodfa r u ol(0sexmxm nodaltn ivt ( s2urxmooo0altnmf3tadla uluvo;t)arxoif ty1fmt  n ils0t2um(o3oo1lmt  nvi (faDrmxrpnt1tex  oetlsla2uauvp;t) reomrciydlptranvo;( sruoio3oo1oleelies s)a2ur(monu1olxn iciydlm2em(mo (0 rxrmf oy1lmD lues t0trum(m ou1lpte fvil( aDrau o;t4oee mf3iydfm2el( p t)altomf totlpteln sl(0trtriopny1omenmictltf 2ra(rpnt0altn oetadlm2ra(mo;t4tlerxr3oydoaD li ils  exoir iu4omenlfet tfsrrauront4apt ifeiydla ea( p u4 rxoxocoydom rauvo;s0trxoirpny1aptelicsas s2rau  ;u0aeto f3iys s rl( p (4 rtnmo3oydlpD luvsls t2tmxo3iu4al nmfvtl(fsruaxr nt4oexn o3ildfs2rm( s t)tetnmrctytfaDe ueilt trxoxo3nu1llt  fctlt a2um( pnt4aexo o3tls a umnvsnt0 eeoxfcoa1fa e n o;() rurim3iy1alte nes sfaDuaxroou1tptnmf3tldfmDelnmo (0 eenxo3tatlpD liei t0t2tr(r3oy4lpeemfeilt)a2rrxro;u1alx iietyd s2umuvs;u0 rxriocoo1latr uvi (  exr(r nu4om  mnctls)aDta(monu4tet mieildla umnvp (0trxrirciadfmt lueslt)setmxopoo1lptnmieilsf 2umx  ;o0tpxnmo3ilslm2um(vo;u4tltnir ta1lp eaieslt  2xmxm iudope  nvtas) Dtm(monu4tpeo fciatfs elnms t)aetrmo3oadop raies;s srurimpnu4lm  lnvt s)a2ta( p;t4tetnif3tydla ua(vp t4artriocoo1op eaueo;t  2xoxo oy4lpte netl()sDurumo;o0ope mietatfm raumo;t4tleriociadla r ues;(  2xoiopnu4olte fvtlt) 2raum no1tptoii3ild m2eanms t)texrif3tydfp eln o ()t2xo(o nudlptemfcil(fs2rauroot4apeomoetyd s ea(vp;u0treoif3oo1opt ln o;t0 etrxr3oudopenlnvt tfsDta( pno0olxoiiciadlm um( s t0tetomr3totomtraieil(0 rtoir io4lp  mics t sDum(mpnt1apx moeiyt sDum(msn(0 eerxf3oa1lm rluvsl(0texoxr3oo4opte fetltfsDrrxmpnt4tpxniociatlaDran s t0 rxrif oydoa  anvo;( texm(o3iodopenlneiat)aDtr(r oo4texn o3tad aDrmnmp;u4 rtoxfcty1lm e iei;t srxm(m3iydamtn fes (fsrrm(rpoo4aetomo3iasfm2ul(mpnt4aeeoiociatfa  li sls0 ruo(opoydameemfctas arrau  no4alx mfciadfmDra(vsn(4artrxo3iy1fptr u o (0srxm(o3iy4omt lfvtat arraxm no0tetnif3ilsfs eau pnt4artnif3iotfpD lneslt) exoxr3io4oleemnvi (fartm(m ou0aexomietadfs2elnms;u4texoifctatoptran slt sexr(m iu1ol   fct t  ruau  ;t1opt iociys m ul(vsnu) lerxr tatlp  anvol(0 rxmiopoydol  mfetas) 2ur( oou4aeeomo3ilsfaDra( o;u0texniocoy1fmDeauvol(0t2tm(m3ny4omtelnciat srrmxmoot1aexniieiat a ean snt0 lerir ootoate nvol(0trtoxr3iydlpt  nct tfsrraxmoou4ale mfeilslm2rmn onu0 ltrmfcoo1omtelu o s  2urxr3io4optemiesas  2uau  oo1tpenifciltfa2uauvo;(0texoxf ia1fp eanvil()teurxo nu4altelnvia(fsrrmumo;t0oleo oeiys a2emuvs;t0aetoif3oydfpDeaieo;t s2toxmpoy1lmt  ici s sDrrxr oo0tpt mf3tasls rln o;()arenifciydfpD anvi t  rtr(mpoydamt mivsa(f Drau  ;t0oltnmfeiat mDemu pnt)texniociodoaD  neols  rxrxm3ny4al n fvil(f Drmu p;o1tleo iciltfm2emu o;u0 ltnmr3ty1fp e u i t0seurxo3nodllen fvslt)s2urxm nu1tle  ictlslmDeluvp (4trtoxo3io1laDr iesl(0 eur(r oo1ll elicta( arta( oot1oexo fciadfm ua( p;u4artoioctotfa  lnvs t teuoxo iudlpte fetat aDurxro;t0aeenioeildlmDrmu sn()trtomfciadomtelnvs ( t2ur(m nu4ap  mictlsf 2rr(m ;o0oleomocilsfsDuluvo;t)trtomrctytlpDrli s t)teurio3nu1lp elicia()aDtrxr ;t1oetoio3iadlaDuau o u0 etrxo ty1la   ueols)s2trxm iydllen ncs () 2tmu  nu0tlxn i3iydlmDraumo;u4aetomf iotfatranvols) rum(o3iu1opte nvils) Drm(r ;t1tlen f3tad s2emn o;()altriocta1laD lneil(0t2trxr iydamen nvt s aDrmx  oo1alenmfeildfm rmu o t0altoio iatfp  lnvi;()trumir3oo1lle  ncsa( sDtrxm ;u4alx if3ilsfm2eanvp t0trtnxf3ty1fa ran ol() ruo(m ny4omtn iei t sDurxmoot4alxnmi3iadlm2rmuvo;t) lerxr3oodfmDr u i;s texr(mpio4olenlfcsas)aDumxr ;o0oeenmfetadfmDeaumpnt4 exnmoctotomt an i (0trurim3nu1amtnlfet t arrau oot0tpenifciyslsDuln p (4trtomfcoy1lm eluvo;( s2uoxo ou4alt  nvi t  2taxm nt0oeenifcils s um(monu4texnmrcoatopDranvo t0trto(opno4alt  ncsl()sDumumoot1tltoii3iadfa2rl(msn()altrxr3oatfp eaivslt)trtrio3iudopt lnvsltfsDtrxmpno1aleoio3iytfm2rm(mp (4 lermrciytoaDrluvil( seurxrpoo4lp elncsa()arraurp;u0olt  i3iyt s el(mp t4teeoxoctydfp rai slt srxrir3no4om emncsl(f Dta(ro;o1oltnmoetad mDrauvs;(0artoxfcto1fatean sl( seuriopnudap nmneil()a2raur ;u4alto ociatlmDulnmsn(0aleoio tytop r nvo;s0texr(o3iu4olt mneiasfaDuaur ;u4oeeoiicilsfm2ul( o u) etoxocia1lm rauvs;(0s2xr(r iu4om   ieias srtaum ;u4texnmocils mDuln pnt)artrxfcta1lpDe nvi;s)srxrirpio1lm e ivta(  rra(ro;u0texniiciytfa ean o;(4tltrmr3ootfatranei;t)tetr(m ou4ap  mnvi ()s2rrumooo4oexo fctldls eln o;(0 exnif iytfpD aivi ( s2xmxr ou4olenmfci tfarua( p;t1tlx  fciatlm2ranvo t4aleomr to1fpt an s s  2urxr3iy1al emfet tfa2urum ot1olx  i3tlt s rluvp t0tetrmfctodfa eauvi;(0srxr(r ou1ap  lfvsa(  2tm( o;t4tpxomieiydfaDel(mp;t4 ltriocoy1lmteau slt0teurxm3iu1ap  lneslsfaDtmumono1apt miciytfa emn onu0 reoio iodfm r i o s  exm(m3oy1amee ncsatfs2raxrpno1tpeomietytfm elu sn() lxniociotfaDelneil()trxmim ny1om   net tf Dtmumpnu1tpxnio3tat a2rl( on(4 rxoirctatlmtr ivo;(0 rtoxr nu4ameemnvsas s2uaxm ;u1opeoifeiysfa2ran s;u) renir ta1fa r ueslt)sexmim ou4ol e nvs t  2ur(mp;o0olt ifeiasfa um(vo (0tetoio tydla eauvo t0s2xriopnudomenlics ()srua( pou4tlx  oeiytfa um( p;t0areoxr3ootfa rln sls)texo(r3nydoleelfci ()sDtaump;u4alxnmiciyd s rl(mp;()aleoifciy1la r nvo s0 rtoirpny1olt lncta(f Drrxr ou1aeeo f3iytfaDel(ms t) eerxr iodlmDelieolt0seto(m io1apeelfcilsfsDrax pou4texoifciytlaDrlnmo;(4 rerifctodop rau o s)s2xrxm3io1omeemnesatfaDuauro;u0aeto feiydla emu ont)texrmr3iatlmtrluvslt srumxm iy4omtnmfvt (fsrtr( p;u0opxomiciltla2rmnms;(4aleomocootom ranvilt s2to(m nodlpte neslt aDur( p;o1tpe ifetlsfsDrm( s;t0texnif3iytom  an sls0sexrxm3nu1aptnliei s)arrmum ;t1aeeniociatla2uanvp u)altomo3totfate iesl(0 rxmxm3ou4amte nes tfaDrr( pnu0aexomi3iltls rlu o;() exnmocoadlmtelnvs;(0 2umim3nudope  iciatfaDrrx oot1altnmf3ild aDeanvs u)aeermr oatoatelnvs;(0 2xm(r ou4lpee ivs t)srrrxrpnu0opeoiieiadfs emn on()artrif3oytoaDranvo ( s2trir3oy1alenmicsa(fs2tmumpoo0olto ietytfm2rlu o;(0 eenmr oatla e ieo t) rtrxo3io1am nmieils  Duaurp;o1oetnmocilslaDulump u0arxrxfciodopt  uvo;s s2xriopny4am  lnes s  Dumu  no4ole ioetls m uaump u)aexnmocoadoptr i ils0 etrio3iudape mivtlt)sDua( p;o0oex  ieiaslm2rau on() rtomo3iotoa eaivols)tetr(o nudaleelfetlt aDtm(  ;t0opt mfeiltlmDel(vsnu) ltrif3ta1fa rai s;s  exriopiudaltn nvtat  rumx pnu0oetn o3iadlm ua( pnu)teermf oodlaDeai s ()trtmim3iy4llen nvia(fsrtmum nt0aetnmf3iadls umuvp;() lxnxf iotla elneilt)s2uoim3oy1ap nmfctl()arra(m no1texn ieildls2eluvp;(4aeenmrcty1faDe i i s)seuoir3ou1lle mnctl(  rrru p;t0tex  fcildlsDel( ont0texoio3ty1faDe uvi;s) 2tr(rpny1lm e fvs t)aDtmxmooo0olt mfetyd a2rmuvpnt)alenmr3iytomDeluvo s t2trim oodaleemfvta(  rumu  ou1ale  f3iasfm emnmsn()aexrif3totla  aivils)truoim3ou1alenmivi t)sruaumo;t1tpeoioeiyt a2umuvo;()aexomrcootlpt an o t)tetmxo oydomtemicias  rrmxmp;u4apto octatfaDumuvo (0treoifctatlpt aiei;() eum(m nu4lm e icslt arurum no0apen f3tydfsDel(ms u4alenif3oa1op elnvs (  euoxm no1opee feiat)srtm( pou0tpeniieiad s2rau s (0arerxo3ty1lm rlnvi;s0setrxr3nudameemivil(  2uax pno0tle mieilsfm uln pn(0 ltnmr3tadfpt  iei t)t2xr(opiodom   fvt tfa2umx poo1opeo ociad sDulnvs (4teerxf3ta1fatr i o;t) 2xoir3io1ap nlnetlsf rrmumpot0tpeomo3iatfm eluvp;u4aexrxo3todlatr uvo;s)trxr(r nu1open nct s)aDrmuro;t0ope  iciaslaDrluvsnu)artnxr oydlaDr nvo;( truo(r oo4altn fesl(fsrrr(rpot4tlxn feiatfs2elnvo;()aetoirctodomtraneo ()srtrxm3nydomen ivil( sDtaump;o1apx  fcilslsDumu o;(4aleomo totlatraueil( teumxmpoy4aleelnes t  Dtauro;u0apto o3iyt a2ua( pn(4 lermf oo1omtr ieo s  rxr(mpnudop nmnct t a2trum ou1aptomoctadls rl( snu4 eenif oatfp eaneil()s2uoxr no4op nmnet s) Dtr(r nt0tpx mo3iysls2ea( p u4tetomf3todomteaivils)trtr(r3nu1ll n fvia(  rur(mpot0opxo o3iad s2ulumo (0aexrxr todlm r uvi t0s2xrio3oo1openlnctasf Dur(rp;o4tlen ociadfsDrln o (4alenio iytlm   nvs;t0srumxopiu4ll n fvias arrrur ;t4ope  fcild aDrau o t4aetnmf oadoaD  ivslt s2xoxopiodapeemivslsfaDua( pnt1tlt mf3iydfa el(mo u0aexnmfcto1oa e u i;s  etr(r3io4ap   ivslt)aDurxr nt4tet moeiytfaDrlnvon()teenir3oytfmtranvsls s2uoir3oy1lp nmivt t  rum(ront4tetnmf3tydfmDrl(mp;u0tlenmo3tydomtr ueol( s2xmxrpnydamt mnesa( a2umurp;o1olt mi3tys m2uan pn(0tltrxrctytlat  n slt)s2xoio ou1oltnlneiltfsrrauronu4oetomfeiltlmDrmnmp;u0tlxomo todfateluvil(0 2toio iu1ap emnvslt sDtm(rpnu0alxo oeiasfm2rl( s (0arxoir3ootlptr uvo;s0t2urirpnu1amenmivilt srumxr ;t4tee mictadfm2ua(vs;()arerxfcoy1lm  aies;t0s2xr(mpiu4altnmfcs () ruaxr ou0texo icildls umnvs (0 eenxrciotfaDelieo ()srxrxo3io4apeemncs sf Dum(mono4apto i3ilt s2elumo t0 exnxrctadop  ai s;() rxo(m nudapen ici (faDtr(  oo1olt io3iysla2ulumo;u)texnxo3tydlm eln i;t0sexm(mpoy1amenmfesatfsDtauro;u4olt ii3tas sDean onu)alenxrcoytfatrlues ()tetmim nydll elnesltfa2urx  oo0tptn o3iyslmDrmu sn(0trenmrcty1optrli s;t0s2xm(m3iodome mnesl( a2rrumpnu0texoifciaslm2ulnvo t) etriocoytfaD anvil(  2uoir nu1ol   fcs () 2urump;u0tee ifeiasfa2uanms u) exoxoctadfpDran i;t0texr(r3oy4ope lfci (f 2urump;t1tpto icildfm rau p;t)tetnxrcia1lmDr n s t)s2xrimpnu4lp  mncsas)srum(monu1aptomicilsls2uan snt)altrif3tydlpteliei ( srxmim3iodll   ies sfs2raumpou1aeto f3ild mDua( o;u4 rtrxrcto1omDraivi;t trtr(r3ou1al nlfviat sDtaur no1aexnmoetldls ulnmo;(0trerxo3iytlp eaueo s0sexm(r3iu1aptnlncsl(  2rmxm no0aeenioeiydfm ulnmp (4altoxf3oa1fmt aneo ( sexoiopio4lpee fet ( s2ta( p;u1olx if3tld sDrl(mp (4alxoio3todlmtr uvs s tetoir3ny4oleelnvt t  2rau  ou1olxnii3ilslaDumu pnu)tlerxfciydla  li s;s srtoxm io4omeemnctasfaDrru ont4oexnioeiys m umnvsnu0 exnmr3iatom eaneslt teurimpno4optnliciasfa2tm(  ;t4apenmocias mDuln ont)tlenxfctytoat lu s s)s2xr(opou4opee iesa(f 2tm( p;t0oexoiociys aDem(vo (4 lxrio tydlm r n o (0t2tmxmpio4aleelietat s2ua(  oo4aeeomi3tatfs2rln on()trtrmo3oatfaD luei t)t2tmim iy4ameemnesasfarrm(  nu4tlxoif3iaslm elnvpnt0trtnxo3iydfm r n s t)teuo(mpou4omt mici ()srurxr ot4opxoioeild m um(vp (4arxrxfciytoa eai sl( truoxmpny1lpenlicsls)aDtaump;t0aex  ietat s2eanms;t4arxomrcio1lateaueils0trxoim3iy4aptn ietas  Dur(rpno0tlxnmoeiatfs umu on()aexoxrciydlm e n sl()sexm(m3ny4al e icsat)sDumu  ou1optniieiyt a2uauvpnu) rxomfctodopDran s;(  2uoxo3iydoltemicslt)s2trum oo0oeen oeilt a2ua(monu4aetrxfcoydom  luvils0texr(o3oo4ome mivs tfs2ta(mpnu0tpx iicildls rmnmo (4tleomo oodfaDeln s () rxoxrpoodope lfvt tfsrtmxrpno4aee moeiydla2umuvs;t4 rtrxfcio1lp  an o;s trxrir3oudapt  nvt ()s2taxr ot1tetn oeiyslm2uanms;()aexrmr ia1fat lueo;( t2uoxr iydoltemiviatfs2ta(moou4tlt iieiaslm rlumo;(4trenxf iodlat li il( t2xm(m3nydlm elictatf rrmxr ;o1oleniictlslaDeaump;t4alxrmfcootoatelu s () rum(m nu1lpenmnvias aDtm(ronu4tptnmociad a rlumo (0tltrxo3oa1fpDe ivi;s0t2xoimpiy4olt lnvsat)s2urxmooo1tex mfcils mDrln s;u0arxrir3ty1op ean o;s0 2umir3nudomt  fesatfarra(r nt0ape mfeias s2rlu o t0tltrxo3oodoa rliei;t  rumxrpiu1am  mfetltfa2ta(moot4tle ioeiysfmDrluvo ()tleomf3oatfp  au i ( teum(r iu1lleelneiatfaDta(  no0tle if3iydlmDrmumpnt) lxrxf ia1opDe ivs (0srumio3ou1aleemncsat  2rr(mpno0apx  icilsfm2ua( p;(4arxnmo tadfate neol()s2urxrpoudap e fcs ()srrm(  nt0tltn oeiyslsDemn onu0trermfcoytlm r nvo;s0 etm(m3oo1ap  mneilsfsrum( pnt4apt ifctlsfaDul(vsnt) lenxf3iadfa e nesls s2umxopny4lp   ivs tfartrxrpnt1alenio3iatla2rmump;u4alxnmo3iydopte u i s)s2xoxm3oy4ape lnei sfarrrxm ou1oltnifeiltlm2umuvs u4 etnif todlaDr nvo (0t2urxr3oy1aptn nvtls)a2tmxrooo1ale ifciltfmDrlnmp u0texrmr oydla ran o;t0tetmiopou1alt  ncsl( a2rmx o;u1opxnmi3iad sDrau sn(0teenif tydfmD aiei;s)s2xr(r iudlpt lictas)aDrmx p;o4tle  f3ilslmDrmnvo u4 lxoxo tadopte i il(  2xoxmpiudll  lfeta( aDrmuroot1apxoif3iad mDem( o;(0tltrmocoo1lp eaieols) 2xmxopnu4ap e ieias) Dumu oot1aexomi3iyd s2emumont4teeoxr3iotfp e uvi;t  ruoxmpno4open fviltf Dta(m ;t1tpx iociltfa2uanvsn(0trermfcoodfmt  u i t trxmxm3oodlme lneia(fsrtau onu4aeeo oeiatfaDua( p;t0aexrifcoatfmD aneo ()trxrir3nudolt miesl(  2rmump;u0tlxomi3iyd a el( snt4 lxoio ta1fpt aieslt t2xmim3oo1omee iet t srraurpnu1apx mfciaslaDrlnmp (4arenxf oatoatran ols truoim3no4opte fes s)srtmumpnt1aee mo3tytfm uau o;u4arxoif3oadlp rauei t0trxmxmpiu4ape mnvsat srtr(ront4optn oetlsfs uluvsnt4trtrxrciotfaDe n sl( sexrxopiu1al  mneia(f Dumx poo4olt if3iltls2eanvs;u0tlxoxo3oadlat auvs;t0trurxr3iydlmt  ivsls)a2rmx oot4teto i3ils aDumn s (0aexoiociydlat  n olt)trxo(o3nu1omen fci s)arumumonu0tetoio3ild m2ulumo;u)aexnxf3oatlat  u i s) 2toio3io1lmtemnvt t aDtaxmonu1alt  fciatfs2eauvs;() rerifcoadlm eaueil(0srtoimpoudam n nvils)a2rr(  oo0opxniieiydls rlu o;(0 rermo oodfm e u o ()t2tr(o iu4amenmiciltf rrr(rooo1altoii3iysfs2emu s u)arxnmrciatomtrau s;t) euoxo3iudap  mics s) 2urx pot4teeo feiaslsDrlnmpnt)arxnifciotlaD livo;s  etrxrpoudoptemfctas sDur(moou0aptn ociyd a eanmsnt4trtnxf3oodom e n sls t2xrxr no4ll   fcsat)s2rmum oo0altn iciytlmDuaump u4trxrmf3tatfaD  n o (0s2xmimpoydopeelict t)aDum(ront4tetnmo3ils aDrl(ms;u)arxrmr oa1lat lieolt0seumxopny1lltelivtl() Drr( poo1oeto ociytla2rl(ms;t0 lxoxfciatoaDr ues;(0 2xr(r io1llenlfesls)artr( o;o0opt ii3tldfm rl(mp;(4tlxrio3oytlpDr nei ()tetoxopnu1omtn fei ( s2tmumoou1tee mieiadfa2rm(vp;t0 ltoxo ootlm rli i;t  rxr(o3oy4ome  nctlt) rtrxmpot1tpe  i3tytfaDrmuvs (0tltnxo3iodfmtraneolt) eurimpou1apen ieils)sDrr(m nu0tlenioctasfa2eln sn(0arerxo iydoaDran i () rtmim3iy4alenmics ()aDrau  nt0tpenif3iyt m2rlums;t)tltomf tatfmt luvs;t seur(o3io1op emfci s) 2raumono1tptnmfeiltla elnmp u) exnxocootlmtean ol( setm(m3iydaltn ivt () rtrxmonu1optomociydlmDem(vp (0teenxfciadlp e uvolt0trtmimpoy4lpen iviat)sDtr( oou4aeeomoetytls2rl( o (4tlxrio totop e ueo;t0sexoirpno4oleelfct s)sDtmuro;o0oltoif3tytls em( snu0texrxrciydlate ieslt sexo(r oudalte iet ()aDum(mont1opto o3iytls2ean onu4tltrmfctadfaDrln i s  rtoim ou4op  lfvsltf ruauro;u0aexnii3iydfm rm( pnt)teeomrciytfmte neols0 etmxo io4openliviltfaDrrur ou1opxo ociyd a2el(vs;(4 exoxo iadlmteaivsls)trto(mpnudlp  lfctltfsrtrxrpoo0texomietas m ean o;u4tltnxo totom  aieo;s)srxoim oy1omtelivsls s2tmxrpnu1tltoioctadfaDrl( o ()tleoxfcio1lmD au o;s)t2xmirpnodlmen nei (faDur(m oo4oleomietltlm emnvs (4aetrxfciytlptrluvi;( tetrxo oudamt  ivtlt artmxm ou0tltnmfcilsfaDelumo;u0 eerio3iotfa rli i () rxo(m3oy4op e fvtltfaDrax  ou0tpenmictltfa rlnvo (4 ltoxr3oo1om e nvils0 euoim3oy4am e neiasf Drrx  ou4apenioeiyslaDum(vo;t)aexoxr3oatlp e uvsls0 2uoim ou1am elfcsa( a2tru oou1texo i3ildls eluvon(0aetnifctatlmDrlnvi;s  rtoxrpou4apee nci (f Dur(rpou0oltomoeils mDelumo t)tltnif ootfpDr nes t seumxo3ny1omenmnvi t  Dururoou0texomoetldfaDuluvpnu)trtomo oadfa e n s;s)s2toxm3oy1omeelnet (f Dra(m ou1aptn ietysfm uluvonu) lxrif iy1la r uvi;( setm(o3ny4omt lfcsas)srtmxrpno1olx iieilsfsDul( sn() ltomrciadoatrluesl()t2uoimpiy1optemnci t)srua(mpoo1teto ocildlm2ulumo (4trxnmf tytfaD lieo;t seurxo oo4lpe lfvs (fs2uau pou4oeeniocildfs2uauvpnu0aleomf3oadom  ai i;s)texoxr oydaltelncta(  2rmxrpnt4texn feiytlaDul(mon(4 eerircoadfaDe u i;t t2uo(o3ou1ameemicilt aDrmu poo1oet mf3ildfs2eln onu0aeerxr3iydopDraiei s s2xr(m3ny4lpe  fcilsfs2rmx  oo1aeenif3tltfsDrl( p;u)trxomocoatlaDr ivil(0seuoim no4am e nctas) rum( o;o1ole mo3iatls2rmumo;u)teerioctatfate n s t)t2tr(opnu4ll  mnvi t)aDtau o;u0tpxo fcilt a rlnvp;t) lxniociadfp ran ols0 rtrio ny1ll n ict s aDtr(mpot4tlxomo3ils m emn p;u4artnmr oo1lp  lnesl( srum(m ny1lm elfctat arta(  ;t1tptniietld s eanmo;t4 lxnir3iy1opD an s;() 2urir no1lpe lfvi t)s2urxm nt4tlenmoetadla rmuvo;(0altoifcta1fa rauvs;() rum(rpoy4lmtemneias)sDur(  ;u4tee  octas m umnmp;t)tlxrxo3oodoptr ivo;t s2xmxrpiu1optelfviat srum(  ot4texomo3iyd m2elnmo u) eenif totlaDr ieil(0s2toio3iydom nmnci (f 2rm(m ;t1aeenmi3ias s2rlnmont4 exomfctodoatraueo t0trxoim3iu1olenlnet s)aDtrx pou1aeto fctasfa rmu p (4altrir tydopt anvi;t)s2xoxmpno1ll  mieia(f rurx oou1texn octys s2ra(ms;()tltrir ia1fateli ols sexr(opio1lmen fctasfsDuauront1opxnifeiydfa ranmsn() rxrmrcoadlatr nvils0srum(o oo1amtnlfesl(fs2urxrp;t0tpeomf3iasfm2rluvs;t4teenir3todlm  aivils  2to(r3iu4lmeelicsasf rtr(r ;o0olxoiietyd sDuan ont)texnxr oy1lmteanes;(0 rur(rpnydope  fetasf Dta(mp;o0alen fciydfm rau o;t0treoir3totfa   i slt) rtmir3oudom emnvilt  2tmu pou4aex moeiadfm em(mp u)trtrif3oa1faDr i slt setr(m iodaleemivtlt)srta(rpoo1alxnmoetls m2ea(mo;u4altnxfciydop r iesls)seuoxr3no4altn fcils  rraumoot1oetnmfctad s2rlumont0altrxocty1opDeluvo;t  euoxr3oo1aleemfes s)artmxm ;o4tptnmo3iatfaDuanmp () eermocoydfp   uei;t) 2umxo oo4lpe lfviasfs2ua(r nu4tpenmf3tatla eauvs t)texrxf io1oa   n s;()srxoim3iudol nmivslt sDta(r ;o4tpxo ocils sDel(vsnt)tetnxfctotfa eanvsl( s2xrxr3nu4olenlnetatfs2urxr ou4optn oeilsfaDrmnvo u0 rxrio iy1lmt ai ils)s2uoxm ny1olen fvs t  2rrur ;t1tlt mocilsfa rau p;(0teerio oodlmDrlneo;t)sruoxm3nydal e ncs tfartmumo;t4oexoifetlsfsDrm( onu)tetrxfcoydla rluei;( sruo(mpoy1amt livsas)sDum(  nu4oeeniietaslm2um(mon(4 lenmo oytlpte nes s0tetoxo3iu1op elnctlsfsDtmu pot4oex ifeiadfa umnms t4aetnifctytlm  li s ()truo(opoodomtnlnvtas) 2rax onu4alt iieiyd s2rmnmo;u) renir oa1omte nvs s0 2xo(m oy1llte fvt tfsDtmurpou4oexoiociasfaDrl(mo u)texomocty1faDrln i t0srurim ou1aptn nvt tfaDtax  ;o0alxo ietyslm2em( o;t0 exnif iytfmt aieolt0texoxr iu1amtn ieilsfaDtaxrono1tpxo f3tldfm um(vsnu) reomo3iotop rlu o s0teumir3iu4opeemivtltfs2trx p;o4oltn feilt a um(ms t4aleoxf3oydfpteaueol(0teum(r3iy1ol elfvtasfsDrmu  ;t1aptoioetys a ul(mon(0 lenxrctadlm  anvo s0sexo(m oy1lpt mfvta(fa2ua(mp;t4apenmfetldfm2umumo t0trxnirctatlatrli o;t)teum(o nudapeelfet ( a2urumo;t0apen i3iad a2ea(vs (0artrxr ta1fmDelueo (0tetr(o no1ole mfeta(  2umu ont4tee  octlt a ra(mp;u0tlenxf3iatlpt lu ilt trtm(m io1lpe  iesls)a2uau o;o4oexn ictadlsDua(mp;u)tetnir3oodlaD  ues s0teumio nydlp n fctat) Duaurp;o1tetn ocild m uanvo (0 lxrif3oy1lmD lu il(  rtmim3iydlpte fet s)a2rr(r ot0tleoiieiasfm rl(vs u4teenir3ty1omte ivs s  rxm(o3nu1optelnetl(farrmx pot4tetnii3tatfa um(vsnt4tleoircoy1opD lnvsls) 2umxrpoodaltelfvt s)a2rmu  ou1tlt iiciyt m rlumpnu)texrir3oadfaDe i s;t0texrim ny1lptn icta(farta( oou4alxomoeiyslaDemnmo;t4 reoxf oy1faDean ilt) etm(o oy1ope mfvt s a2taxmpou1apx  i3tytfsDul(vpn(0 eeoir3oydlate ueols s2tr(opiu4al e ieils a2umum nu0ope iieilsfs rlnvs u4 rxnir3to1lat lnvs ()teum(m3ny1oltnliesat)srum(  nu4oexnii3iltfa ranvo;()artrmf3iydfp r uvi s)srtmirpiodlm emfeilt) 2urxmoou4ape  fciasls elumonu4arenxf oo1oate uei;( teurxm3no4omt  fcsl(f Dumu p;o1tlt mietydla2rl(ms;(4trtnmo to1lmDeaneo ( s2toxmpiu4lmtnmfet s a2rax ont1aetn i3iys a2rlu pnt0altoxrciydop  lies;()seumio nydam elivia( sDrr( oou4ole ifeiydfs2ranmont)texrif3ia1oa eaivs;s  2xmir3iu4lm  mfcsls  Dtru  ;u0olx  o3iadlmDulump (4arxnmf3tatoaDr ieo;t srurim oo4alenlieslsfa2rm(rpnu1opto ocils s2ul(mo;t0areomrciy1lateaieo;(0srxoxm iodlle lnesls)srtmumo;o4opxnmfeiltls ea(vonu4 eenxf iodfa e n i s0texoxo3ou4omtn ictl( s2umur no0oeenmiciyslmDrl(vpnu0 exoxrcoytlm  lu s;s)texmio oydale mies sfarurx pno4altomfciatfa2rlnms u)artomf ootlmD luvs;()trumxopnodome lfci s)srrax o;u0opxoiieilsls2elnmp u4aexniocootlmt an i;()texrxrpiydame lncsl()artmx  no1tlx  ieildfm eanmo t0trtoxf tytfmDranes (0t2umxrpoo1op n net ()sDtmuroot0aex mictad m2rmu ont0aetrir oydfpte nei;s0trtmimpno4lpe  ieia()artrur ;t0aetomf3iatfaDrl( s;(4 rxnmr3oa1fmt anei s)srtrxopoy4apee iciat) Drmum no0alxnio3ildlaDea(mon(0tlermf oytfm   ivsls t2xoxr3ny1ap emfciat aruau  ;u4tpeoio3iysfmDrmuvs;(4alxoxo3totfmteaivils  rumxr nu4lptnmfesas srum(m nu4oexnmfeilsfm2rau p;(4 rtoiociotfmtrauvi s  exmxo3iu1lptelfetlt) 2umu  ;u4aetn f3tys aDua( s;t4 lenxf3todfpDrlueo;s  2umimpoy1amtelivta( sDta(mpou0aetnmo3iat s2ulnvont) rxoircoa1la  auvo;s0s2trxm3no4opeelnei t) Dtaumpno0opxn f3iatlsDelumsn()alenmr iodopt  neo;s) 2ur(o oydapen nvslt  rururo;u1oee if3iltfs rmu p;t4arxnif ty1latraivo t0s2xoxr3nodll nmfvs t  Duru  ;o0ope mictasfs2uluvsnt0altrxoctytla   iei;s0trxmirpou4alteliciat srumu ono0oet ifctytfmDum( p;t0altnirctodfmD  ieolt trurxr oy4ope mfciatfaDtmxro;o1tleo ociydfm2ua( o t)alenmf oa1opDe ivil(0teumxr3nydam   ncias  2rmxmono0oltomo3iydlm ulu ont4 eeoir todfaD livo;s) 2xoim iu4ol  lnctlsfa2umx  nu1optnifeildfaDean p;u)tetomfcta1om raivol()sexoxrpoo1am   ivil(fsrtrur ;o1teeo feiyt m ulnmsnt4arxnmr3iytlm r ivo;()sexmirpoy1omtnlivslsfaDtmur ;u1opxomieiatlsDean o u)aexnxfciy1omD au ol() exr(o3nu1op emncs t sDrmu  ot1oexomoeildfsDumumsnt4 etomr3todlp eauvo;s) exr(o ou1lmtemnct () 2raxmoot1tpt  ocildfsDulumo (0areoxf ta1lpD luvil()t2xrxm3oudll  mfesat sDtmumo;t4oleoioeias m2umuvonu0 eerxocio1fpD  n slt)trur(o3iy4lm emnetat aDua( ooo1aptnmo3iad aDum(mo t0 eerxr3oydfmte ivsls0 rxr(m3ou1lmtnlfcsatfs2urxm ;o0oetoif3ilsfs ea( p (0texoio oydlm   n s t0sexoimpno1altnlfcsls) Dur(m oo4alx  iciad aDemn o;t) lerxo tydlaDe ivo;t0 2xrim oydlmtemnctlt  Dua( onu1opxoifciytlmDul(vsnu0 renif3iadoa ranvsl(0teurirpoy4llt  ivtl()aDtru  no4oleoifctydls rlnvs u0tetrxocio1faDrlies;s  eurxm3iy1ame  ictlt) rraum nu0teen ieiltfm2ra(vonu4 eenxo oytlaDeln ils0texo(m oodol emietlt arumuro;u0altomf3iaslmDum(mp u4 lxnmf3to1opte nvs;s seumiopiydllenmict ()arur(rpnu0oeenmoetytfa elums t4alxrxociotlaD lieslt t2tr(opiydolt  fvi (fs2rr(  ot4aee mf3tys m2rl( on(4tetoiocoa1opteaivols t2xrio iy1am nlnet tfsDraurp;u0oltnmoctatlaDrau o;u0 lxnmr tydomD au ol(0 2trxr3iy4lm emnviltf 2um(m ot4olt  ieiaslm em(mo;()arerif iytoaD luvi t)trxrir io1lpenmnet t)artm(m nu0ole  ictadls em(vs;u0 etomfcoytlpDeanvsls s2urxo iu4ap nmiviatfarur(mo;o0alx  ietatfa rm(mp t0arenxr3oytlmteaneils)texrxmpnudapt mfeiltf Dtr(mpnu0apt moeiytfs2elu p u) exnmf oadfaDeanvi;t truo(m3ou4amt  fciltfa2tm(m nt4texo i3tlt aDumnmpn(4arxrmr3totlm ean s;s0setoir iu4llt  fcil( sDtmxm ;u0altnmiciatls eln o (0tltrif3iydlmDelnes s  ruo(o3iy1lm n neslt)srrr(mpou0olxo fcild m2ranvpnt0texoxr3ootfateanvslt trxo(r oodomtnlfvil(fsDtm(mooo0oee iictadlmDuanmo;u0 renxocoydopt livs ()trtmim3ou4lpee fcs (  Durumont1altoii3iyt sDra( snt0 lenxf3to1fpt  nvo;t tetm(r3no4lmtn fes tfs2umxr no1olen i3tldlaDum(mo t0tltnmf tatomDr iei s)trxm(o3oo4oltnmfeslsfsrtmx  nt4ole iictlsls2uaumo (0 eenio tydfmtr uei (0 exrim nydaltelfvsls sDtau pnu0aptoifeiltlaDeln o u)arenio tydfaDrlneolt0teuoxmpiu1ol e fvi s)artmumono0apt  octytfs2uan on(4 lxoxo3todoaD lu ols seumxrpoydop nlivs tfaDtrx poo0apeoioetltfs2uauvo t4alxrmfciydoa r uvo s0s2trxopiy1openmfviltfs2uau poo0opeomocildfs2ua(vsn(4 reoxo oadlmtraneo;(  rtr(opnudom emiesa( a2rmxrp;o0tpe  o3tytlaDrmnvs;u4aetrxociy1fpt  ivslt0sexo(opnudoltn net ( aDra(m nt0oexoii3tad sDemuvo;(4 renxrcio1fm  auvo;t trxr(m no4omt mfvs t a2ur(moot1oeeoiocild a2rm( snt4alerxf3iotlmt  nvs;s0texmxr3oodap n fci (f Dumx  ;t1tpxoiocilslaDemumo t4tetoxo oatfm  an i ( sexm(r3oo1ol  mfvtat)srtruroot1oexomfetltls uau p;t)tltrirciy1oatr n o;s0teurirpoodap elnvtat)a2tmum ;t1aet  ieiydla2ean s u4 eermr todlmt ln i;(0 exoxr3oudal e ivs s) 2tr(mont0oltnifciadlsDrmnmpn(4alxnif to1fm   n slt0 2ur(o3oo4olenmfcil(fs2rrxmpnt4tee  feilt aDuaumo u)altnxr ootfmDe iei t0 exoxopnu1llee nci () Drau pnt4tpto ietld aDua(vp;u) ltrxf iadlp  livi;t) ruoimpoudlmeemfetlt aDur(rp;o1oetomi3tasla2ea(vo t0 exrirctadfmt  nvo s)srurxrpoo1omtnmfcias) Dua(monu0apxoiociasfm2el(vo (0artnif iotoaDean ilt0trxrxrpoo4ol n nes s) rum(m no4oeeomi3iytfa2ua(mp t0 lenir3tydlm eaivi;s  2triopoy1lp nlfctl( sDrr(r oo4aex  feiltla rln snt)arxrif3iydoa raueo t0s2uoxopiu4lp nlnesas srururpnu1alx moetld a2rau o u)arenxrcoytfm eli olt  exr(o oudlmtnlivtas)arurxmoot0tetn ietadlmDrmn s u4 etomr oatlm eln slt0t2to(opiu4lmt  nvta()aDtaurpot4texnifetlt mDul(ms t)texnif3tytlm e nvs ()teuoxr oy4apeemicils) 2taxmpnu0tetomfciys aDrl(vo t0aleoxo3to1fat aiei;t0setm(opiy1apte ivilt s2urxm ou0olxoifctls mDea( on(0 rxrmo3tydfa rli i;s) etrxopou1om  mnes sfsDtrx  ot0teen oetlt a rmn pn(0 etomfctotfpDeauvils0texmim oudape mfciat  2um(  oo1optomf3iatfs2uln o;t4trtoirciotlatraies;()t2umir3ny1omtemfvil(fa2tmxr ou1tptoif3iadlm2um( p;(4tltoif3oadlptr uesl( srtmio3iydalt mfvs sfaruaumpot0ole  oetldlsDem( o u) lxnxr3oodlatraues;()t2uoir nu1optnmneilsfa2rm(m ;o0opeo fcild s2umn s t4trxnifciatfaDeli i t)trumxr oo4al elfcia()sruauronu0apxomfeiydfmDulnvonu)teermo tatfm e i sl(0seuoiopio4ale lfcs sf Dtrx  no1altomi3ilsfa2ean pnt4texrif3oytfpDrln s t0srtmxmpiy4ol n iciat)a2ur(monu4tetoiiciyd sDelnmo;u)aexnmo3totfat anvs;()t2trirpnydop  lnesa(  Dum(rooo0aetnmi3iat s2ra(ms;(0trenxoctodfaD an sl( t2tm(r nudalt  ict (  rtruroou4tpxn ieiydlsDra(vp t) eeoio3iotopD lueo;t) rtmxo iudllt micilt arraxrono1apxnif3tatlm2uan pnu)aexrxo3tadla   ivs () ruoirpnodamt  iei t sDumxrpot0ole ifciatla2rmnvs;u)tetnio3to1fa eln i;t seur(m3iu4am e ivt (f rtaxmp;u4tee mieiytlmDul(mo () rxrmoctodlatrluvs;s0setm(o3oo4amenmfvta(  Dtaxmoot4apeoif3iyt m uauvs;t4arxrxo3oadfatrlieo t sexriopoo1altn feias  Dumurpno4tpe moctad s emnvp t0tleoio3iytfpDeai o;t0setm(rpnu4apte fvi s s2ra(m ;o1alt iieilsfs2uluvp;t) reoxfciydomte nei s) exrir3oodol elfvta(fs2tr(r ;t1tlxnif3ild sDul(mp u0aetnmo3tydopt anvs;s  eurxm3ny1op  mics t srtau ont1tpe mo3tytls2raump;t) rtnmr3tadoa rlieol() rur(r3oo1ape mictls  rurx oou1opxomi3tys aDumnvpn(4aetnxr totomtr u o (0 2xo(o3oy4lpen fvs (f rrmu  ou0oeen f3tlslm emn ont0 etomo3oydfat aivs;(  rtmxrpiu4lmenmnvtat  Duru ont0aeeo octld aDrl( snt)artrxrctydfp e ivslt)trxr(r io1lp emieia(fs2tm(ro;t0tpto o3ildfs2rlnvont)arxrmr3tytfa  livi;t  2umxrpoydaptemnvil()artr(mpno0olxnmiciydls2eluvsnt0teeoif3iytom rlnvs;s) etr(m3oy1ap nmicias aruax ono1aex  fctldls2em(vpnt)texomocty1faD aivols0t2umxo nodlmte ictls) 2tmx  ;o4oetomieilsfsDelnvo;u)aetrmr3oatlmDrluei s)s2xrxr io1am   fes () rtrumpnu4ole mi3ilslsDem(msnu0aexoxo3todla rluvils srxmio ou4ol e ictls)sDurxm ;u0apxn oetatlsDul(mo;u4 exrir totfa   uvsl(0srxrxrpnodame lneil( srtmumpou4oetoii3iydfs2eanvo;u0aeenmf ia1fmt au i ()t2trim3iy4optnmfvsas)a2rm(mono0tlxn oeild mDrl(vo;t4tlxoif ty1omtranvo;t)trtmxr io1ol elnesatf rtrum ;t4opxo octadla ra( o (0aeerxfcty1lm rau il()teuoxo3ny4llenlicsa()aDururo;u4apt ioctadfmDuanvp;u4 renmr3oatlaDeaies s  etrxr3nudam  lfeil(  Drmum ;t0alt mociltla eluvsnu4tleomocoytlmte uvi;t)trto(mpoo4altemnciat)arurum oo0tpxomoctat a umnvsnu4artrxf3iodlpDrlneolt0 exmio3nydameemietl( sDtmumooo0aee iiciydla2eaumsnu0 lerxr tatomDrai sl( t2xm(mpno1al nlneslt) 2tauro;u4aexnmfeiyslsDea( s () ltomociatfatrluvi;t) etmxmpno4lmte nct tf 2trur no4apeniociys mDemn p;u4trerxocta1faD auesl( srur(m3iu4amen ivsl(f 2raxmooo0apxnmoctadfm ulu onu4aetoxocoa1fmDr nes s  2uoxo oydaltemiet (  Dtau o;u4aeenioctltfa ran s (4teeomrcio1laD  neolt) 2umxr3iy4lmte fviasfarur(mpnt4tle  o3iltla rm(vpnu)aexnio3ta1omte nvs;s)srxoxm3ou4omtelicsl()sDurumpnu0tlx ii3ilslmDrlnvs;()texnif tytomteli o t trtoio3iy1olen nei (f 2uau  oo0opxo ocildlsDum(vo (0trxrxrcoa1fmte u ols t2xmxopny4amtelfcsasfaDua(  ;t4tex io3tlt s2umums;u0 rxomf3tadopteau ol(  exo(m ou4optelfvi (farua(mpoo1optnmfeiadfsDelnvo;u4altrxrcoy1lm   u s t  ruo(rpoodomenmnct sfsDur(m oo0texnif3ias s rl(vs;u4artoif3oy1fmDraies;(0sexr(mpnu1op   icsl() rumurpnu1teto ocildfsDemu o (4 rxomo3oadlmtelu ol(  etrxo3iu4altelfctlt) rurx  nu4optn o3ils a2uanvs u4tetnmocty1oaDeliesls0 2trxrpiu4ll emicsas artaurono4alx  feiat sDel( p;()aeenxfctytfaDeli s;()t2trirpiu1lm emncias)a2trxmpnu4apenmieiyt mDeln o;(4teeoxo iadfaD au i t)s2urimpnu4aleemict t) Dtmu  ;t4apeo ictldla2umnmon(4trtrifcoy1lp r ivs;(0srxmio3ny4altn fctltfartm(mp;o0aet  f3iydls2rl(vpnt4aetoirctodfm e n i (  rxrir3no1omeemfeilt)aruaxmp;u0alxomoeiysfa2ua( snt)tltoxf3iy1lmD an s (0 etr(r iy1amt  ivtas)s2uaxmp;u4oltnifeiydlsDulnvp;u0arermf io1lpDraivo;s)srurxo3iydaptnmivia(fsrtrxr ;t1oetomoetldlm2elnms;u4tlxrif3iydlptr ivi s srxmxm no1aptnlicilt)sDtmu pno1tlen i3tlsfs2ua(mpn(4altrxf3tadlp  liei (0s2uoxopiydapenlivs tfa2rm(m nu1tee mf3iydla ean p t0tlxoifctydfp  aueo t0s2uoiopiy4lltemnet (f rrrump;o0teeoifctad a uan p t)arxnircoatlp   nvo;(  etmxm3oodom   icsat aDuru o;u4tltnifeiys mDuln pnt4 rxrif oo1laDr uvsl()srtoir ou1lm n ivs ( aDrmx ono4alx mfeiytls eauvs;u4aetoioctatoa e nei t t2xm(mpiu1ame  fvtlt  rumumono4tetnmi3tldls ranmo t4aetomf iy1lp elneo;t)s2urxrpio1lmtnlfct tfsDurxmo;t1aexnio3iys s ua( s () rxrio3oodomteaneo;()trxrxm3oodopt mfvi ()a2rax  ;u0oexoio3iad sDrlnvp u4 ltoxoctadlm  anvo;()s2xo(r io4lp   iesas artm(m nu1tetn oeiadfaDulu o;t)tetomf3todoat  uvi;() rtrxmpiy4al nlnesat) Dum(  ;t1tpeo fctatfmDelums ()altoxo3oa1lmDelu ols0 exmio io1om  lfvta()s2trxmo;t4tleo f3iytfmDumn o u0 lenircia1oa rlu o (  2xrxo iudom elfvt s s2umu  nt0aeeoioetyt m2ulnvs t) eeoif3tatomt  ivo;()srumxr oo4ap emicilsf rurxm ot0alx moeiys a2rmumsnu4 rermf oy1fa e nei s)trur(m3oydlmt livs (f rrm(mooo0alt  feiat m2el(vs u0artnxociatfp   neil( trumio oo4ap e fci t)s2tau  nt0tltnmictyd m2elums;u)aexnxrctadoa elneil() 2xmio3nudll n nvia(fsrrmump;o0apt  fciysls2rlnmo (4tetoxrcoydla   uvs (0 rxo(r iy4al nmict t a2um(  ot0apxoiociadlaDem( pnu) etrmf oadfptrluvo s)texm(o ny4lpe mfeils)a2raxmpnt4oet  feildfmDumu snu0 etoxrciatlptr i sl(  2xoxr3nydlptemieiat)srtm(m nt1altoiociytfa2ra(mo (0alerir3tytlmteauesls0texr(o3iu4lm e ivsas sDrmx oot4oltoioetadfs2umuvon() reoxo3oatlate ivo t)srxm(mpiu4lp emncs tfs2uru ooo1tleoiiciasla2emnmsn(4altomrctodlmD aies s  ruoxmpno4open nvi tfsDtrxro;o4aexomoeildfs2elnvs;u)trtoxfctatla raivs s0s2toirpnudlmeelnei ( srtm(mp;t1tlx  oeiat a elnvo;t0tltnxo oodoat  iei (0trur(m3iy1ape mnvtasfarra(r no1tetniiciyd a2rl(vsnt)artnirciatlm eanvols0seuoxo3ny4lpe lfesl(fsrraur nt0teeoioeiysfaDranmo ()texrmfcoy1fa e nvo t) rtm(r nodolen ivta()a2urur nt1altniiciat m2el(vp u) exoio io1omt anei;( sexoim3iodolenlnvs ( s2ta(rp;o4alt  i3ild sDuaumsn(4altrxocta1opteau il()trumimpiodoltnmnvi s) 2raur ;o4alt  fctltlaDua(vp;() rtoifcio1fat auvol( s2toxmpou4oltnlnvtltf 2ur(mp;u1tpxoif3tyd s ean p;t0 lxrir iotomt auvsl()t2xo(mpoy1omee nci (fs2rmurpou1olxn o3tysls2rlu pn(4 etnir oytopt  iesl()teto(o nydlpen icia(fsrurxr oo4ape ifctasla umu o u0artomf iadlmD auei;s0 2urim io4lp   nei t s2taur ou4opxnmf3ildlaDrl(mp (4 reomr3ty1fa e i slt) euoxmpno1omtnlfeta() Dtaumoou4tltnmictatlaDuauvo u) exoxr3tadfm   ivs;t)t2xmim3iudll emfet sfarumxmpoo4oetomf3ilt aDuau p;(4arxnir3oytop rln s;( s2uriopnu4om elnct s  rrm(mo;t1tpxo ieiysfsDemnmon(0treoir3oy1fmt lnvsl( srxmimpnydopen netl( aruru o;u0olt  i3tldfm2rlnvp;(0trtoxfcoo1laD  ivo t  eum(opno4ape lfet (faDtaxrono0oee ifctltlm2rlnvp;u0tlxnmf to1optrlneo s0teuoxo no1lmtn fvslt) 2umur nu1oeenmf3ildfm ulu p;u4 exrir3ootopD aueols texoim oydapeemiciat)aDtmuro;o0aeenif3iat s el(mo;()alxoxr iytlaDrlivs;t  2xrxr iodlpt lfcsl(fa2raxmpoo1aptnmoctadls2umu pn(4texnmo tydopDrluvol( t2xmim3iu4lp   ncta()srta(rp;o4open feils m2ra(mo;u4 rtnif3oydfa  lneils0t2uo(m no1lpeelicilt a2ta(ronu0aexn o3ild a2umnmo;t0aetnxr tytfpD  i i ()srxoio3oo1oltnlfct ( arrrxrp;t1oex moeiydfa2rm(mp;u4 lenxrcoatoa r u s s)setrio3ny4omte nct t aDtrxrpnu1aetn f3iytfsDrln o;u) ltnir iodopte neo s0 2tmxmpny1omt lfet sfaDrrumpou0apeniictydlaDran snu) exrmf ta1opD lneils sexm(o3iudol nlncil(fsrrrxroou0tet miciasfs2rl(vs;u)aeenxf totoptr u i;t0srxoio3ny1lm  mnctls)aDrrxrpot4olxnii3tydfaDulumpnu)tltrmr3todfpt  u olt) euo(opiy4ll  lfeslt arumxr ot1alt  i3tyd a2ul(mo;t)alxnxr oydlp raieo t) rxo(o3oo4olt lfesltf Dtrur ;o4oleniiciytlmDrlums;u0tetnxf3totomtelu olt)t2umimpoo1ll nlnet () Drm(  nt0tptn fcilt m2umn o;u) lxrxo3ta1fat  iei ( setoxo ou4altnlivias)sDta(r ;u1tle mfciydfs2ul(vsnu)alxoxrctotlpte n ils srxoxrpno4omee nei (farrmump;t0apx moeiysfmDemuvs t0 rtomrctotlp elues;()trtm(o3oydllen iesl()arraxm ot0oleoifciltlm ua( s;u0areoio oo1fmD auvol(0 etrxm oy1ap nmictlt) rrrurpnu0tlt  fciasls2rmuvpnt)arermf iodfatr neil(  rxoiopoy4ol  mics ()aDuaxrono4apxnioctytlsDrmnmp (4 exoxfciodlpD anesl( s2xmxmpnodomee ivsa(f rrmxr nu0optoifeiatls rmnvp u0alerio3oatoaDe u s s  eumxo3ny1lptemnviasfarua(r ;t0texnifciasfmDrluvp;(4 lenmf3to1lpD au s () rxo(rpny4alt lfetas)aDraumono1tetn oeiys aDrln p ()aetomocoodlm ran o;()t2xrxo iy1opte feilsfsrumu pou0tlx  fctydlaDumnmp t0alxrmfcoydfmDrlivs (  exoir ou4lm nmneiat srta(m oo0apeo feiytlaDrl(vont) exnxr tadoptrln o;t0s2urio3no4opt lnvias)aruauroot0tlt iicias sDrmu p;u0texrxocoa1fp r i ol(  2tmir3iu1om  mfcsls aruax pno0optn i3iat s uanvp u4trxnmf iadop rlu s;s  exmxo iy1llee ivs tf rrru o;t4teenioctlsla rau p;t4altrxo totfpt lnvo t)sexr(m3nudopt  icsas aDrrxmo;o0tlxoif3iyd m2rauvpn()aeenmf tydlp   iei t) etmim oudam elics (fa2trurp;o1apt iociltfm2uan p;(0arxomr oydlptr uvol()srxm(r oydop eliesls s2taum ot4tetn oeildlaDumnvp;u4texrif3iytomtrluvo;t s2xrxopnydom elieil(f Dum(  nt1tet mietytfaDumn on(4texrmrcoatlat auvil(0t2xoxm3io4oltelnvias  rrrxr nu1olt if3iytfaDeluvs u)alxoxo iodomt  nvi;s  2xrio io4amenmivsas)sDur(mo;t1aex  oetatfs ra(vsn(0areomo tydlpt  u s s srtoio oo4lmtelfcil()arrm( pno1tpen fetaslmDean o (4aeenmf3iodoatrluesl(0 eto(r iu4ll   iesl(f rrrurpoo4tlxoifeias a ra( o;t0tltoio3iy1fmt  n sl( truriopoudlpen fvta() rum( o;o0opt  fetas s2ea(vp;(4 etrmr3ia1lm eaivils0 2urxopnodlp n nesl() Dtaxmono1apeniieiltlaDrauvs t0arxrif iotoatrai o;() eumxo iodlm nlfvia(  Draxrooo0ale iicilslmDra(von(0tetrio ta1fp  lnvslt)t2toxr3ou1lle  nctlsf 2trumpoo1tetoifeiad s2eln p;(4 ltoxo tytlpDr uvols)trumimpny1llt lfvtlt)srum(r oo4apt mietltlmDemnmo;()texnmocoy1lpt aieil() rxoxo iudoleelivt ( sDta(  ;u0opto ieiyslaDeaumonu4 renir ty1oatelnvo () rum(o3iudom  livs ( a2umum ;o0opxnmieiadls rmumo;(0aeenmo iy1lmD aivs;(  rumxmpoo1om nlnctat arur(rpnu0oexoii3tat a rlums t4 lxomf3ootlmD ai s;s0sexo(o oy4ameemivslt s2umxm ;u0altn f3tld m2ranmp u) lxnmo oadopDean sls s2xrxrpnudlpenlfei t arra(mono0tlxo fciadla2rmu pn()artoxf ia1omte u o;( t2tmir3iydlp nmnvsa()a2umxronu0oeenifciydlaDrm(mp u)areoircty1lpDr ivi;s) exmir oodamteliesat srur(r no0ale  f3iasfm2ranmonu)aetomrcoydlpt  ieo;(0 eumxm iodom n ncsl(faDrrxrpno1oleniieiysla2uanvo t)aetrio3ia1lp  aueol(0 etmxo ou4omtemicta() rtrxmoot1aetnmi3iaslaDrlumo;(0teermrciodlptean i;s)trurxr3iy1altelneilsf Drrum nu0opx if3iasfsDrlnmsn()aetoxocta1lmtr uvo s texo(opoo1ame  fvtat) rrmx onu4tetomietys m2umuvp;(4tlxrif3iatop   nei t)srxo(m nu4opeelneia(f Duau pou0alt  ociydfaDulumsnt4aeeoxr3iy1optran s;t0s2xr(r3iu1amt  fesl()artau  ;u0tptn i3ild sDel(vs;(0texnifcoadomt luei ()t2xrir3oo4ol n fvta()sDururpnu0tet mfeildfaDraumon(4aeeoircoatoatrai i;s)srtr(mpnu4am   neilt  2ta(ro;t4tex  ieildlaDeanvp t0trtrxf iydom rli s s0s2xm(mpio4ll  lncsl(  rrr(  ;t1oeeoiociyt m rlums;(4altoxo3ia1lm  aueil(0 euoxr3nudaptnmnct s) rtm(mpnu0aexoifctys sDul( p (4aeeriocoadoa r n ilt0 etoxo iydomee icsl( srtrump;t0tetomictydfa2rmuvpn(4tlxrio3ootlaD lueo (  ruo(opoo1oleemiesls)a2um(moot4tptomf3tysla2uanmo;u0aeermo tatoatraues t t2ur(o3iy1ap elncsl()srumumono1aleomieiytla2ea(mont0 rxrmo3oodlmt aivsls t2xoxm3nu4ap n nvsasf rrr(r ou4tlt iieiatls elnvs;() lxoxo3oodlmDrlieilt0s2trxo nudolt mfcs sf Dua(r nu4olxnmfeiytlsDum(msnu0trtrio tadla rlu i t0seumxr3oodlmeelfeil(f Dtau p;t0oetnifcils mDem(msnt4 eermr oytfpDrlu ilt0 rxmio3nydapee icsltfsDtmur ;o0texnmf3iasfmDul(mpnt4alerir ootfa   uvo t trumxm3iy1altemici s)srrrumo;o1apt moctyt a2rl(mp (0areoif3iodomtelivs () etmim iy1am nlneias  Dumump;u4aeeo ociatla eanvpnt4arenifciytoa e i s;t0 2ur(opoudlme mncsat s2tauro;t1aetomoeias a2ulnvs;t)tlxrxr3ta1fp   ieols0 eur(r oy4ol nlictls  2raxmp;t1aexnmfeildla eanmsn(4 reoxo3iodlaDranvslt sruoxrpoy1ll emfeta( s2ra( p;t0altnmieiasfaDua( o;u) lxrmrcoytom  ln sl(0t2xo(o3oy1alt mietl(f Dtax p;u1tlxnio3iydls2uau p;u4aeenir3ty1omDeai sl(0seuoxo iydolenlfvs sfartr(  ;o4apeoioctatfa um( o ()alenio tadfa eanesl()s2xo(m3iudoleelnct (fs2ra( p;t1texomo3iaslsDra(mo;t) reoxf tadla e ues;()teurirpno4oltnmnvsls aDraump;o1ale mi3iytfm ulnvp;(0tetoxr oo1faDranei t t2uo(mpiydomtn icsl()s2trx  ;t4tlt  fctydlaDranvon(0artrxr3oodoat  uei (0sruoir3iydlpe mneias artax  ;t0ale mfciysla2ulnvont)aexrif3oy1fmt lu o;t0 2urim3oo1am nmnvt tfs2uaurp;u0tpxomociasla2uauvsn(4alerxocio1lpD  ies () exmio3io4lm  lnvsa(f 2raxro;t0tpenmoeiltfmDulnvs;u)tetrio3oodomDe i i;s0teurimpno1om nmicsl()sDuaxrpno0olxnmo3iyt m2um(vp;u)arenxf tadfatr u sls) exm(mpiy1altn fvi t)sDrmx  ;u4tptn feildlaDulnms;u)aetrmo iydopt  i o;()srxrimpnudope  ncsa(f 2tm( p;t0olxnifeiyd m ea( o ()artomr ia1lm rln i t sruoim3ou1alte nvslsfsruaxmooo4tlx  f3iltfs2ul( pnt0trtrxf tydlp rlivi ( srtoir ou1ope licilt)s2rmxro;t1opxnio3tas s2uaumon()tlenxrcoy1fm ranvo s)s2urxopnu4ol  mnvs ( sDtaxmooo4olxnmociytlaDumnmsnt4texnif iadfate iesl(  2urir3ou1op elfes ()s2um(mpot4ale  octad s2emnvo;()altnmfciadoaD anei;( teurir nu1lmtn icslt arraxront1teto i3ilt sDul( pnt4 ltnxr iodfmDe iei (0t2xo(r3iy1openmieia(faDua(mpou0altniictysfsDrln o (0 eeoio tydlm  ln s t s2to(o io4lle  nvias s2urx o;u1tlxo fciltlsDeanmp () lxnxf todlpteau i;(0tetoir ou4lltelnvi ()srurxront0opx  i3tatfa rlnvs ()trtnxfciytlptr nei (0 rtrir iudopee fcs sfa2trum nt4optnmieiydfa uau pn(0 exrir3oy1oa raivsls)texr(mpnu4alte fviasfs2rm(r ;t1tlxo f3iltlm2ul(mont)altomrctadoaDr u s;s setoxopnu4op elnvia( s2tmu  no1olt mociytlaDemnvpnt0 rxomocoy1om   iei t0 rxr(mpiodom elfei t)srur(mp;u1oeen feiadlsDeau s;(0alxrmrcoytla r ueo;(0tetrxmpiudlpen ncsat a2umxmoou0oleomfciltls eau onu0alxnioctadomt  n i t)s2tr(mpoy1lp  lieta(  rur(m ot4optoiociyd aDum(vs;t0aeenxociytfp   n o;s  2trxo3oy4lpt mneia(  2raurooo4apxomoeiadlm2eanvo;u0 lenxfcia1opt anvils) exr(rpno4al nlfvtl()a2rr(mp;o4apeo o3tasfm2rau p;t4arxnmo3totfat lnvs s seumio3ny4lp emfcsl() Dur(m ;o0aetnioeiyt sDrau o;(4arxrxo iy1fa e u sl(0trxm(o oo1al elnctat srra(m ot0open i3iytfm2umu snt4arxrmocto1laD ln i (0trtmir3oydaptnmfcilt) Dta(mpnt4alxnioeiyslaDul(vs;t)artrxo3tatfaD an il(0trto(o no1am  livi tf 2ua(m ou4tetnioetadfs2ulnvs u)aeenmf3io1fa r n il( teur(mpoy1openmicsas a2uaxmpnu1tle  feiyd mDean o u4teenmr iodfaDraies t) 2tm(r iy1altnlncilsfsrrmuroou0oltoio3iyslsDumu p t0 lenio3iotfa e uvil()teuoir io4altnlict s)aDua(mp;u4optn ictaslmDuluvpnt)artnxf oydop  ai o s s2tmxr iu1apee fei s)s2rrum nu0openmfeiad m2umump;t4treoxr ia1opD livs;t)trtoxo oo1aptn fvi tf 2uaxm ot1ale mfeilsfs em( pn(4artomf oydfaD lu olt0 etoio3oy4amee fcils)arraxm no0olx iieiadfs emuvo;t)artriocty1oatrlueol( seto(o3oo1lltn feilsf 2tax  nt0apen oeiys a2rl( onu4texrio3tatoa   u s t) eurir3no1lpe miet ( a2ra(rooo1alen fctlsls2rlump u0 rtrmo ty1omt livo;s0s2tm(m nudomt mncsa(f rraumo;u1tle  i3tas a ulnvs u0 rxrif3tytoateaivol( t2xoxo3nudolte fes s) Draumono1oeen feiyt sDra( o;t4aexnmf io1opte ivi s)sexriopiy1am emnvt (f rtrxront1altn iciys a eluvp u0 exrmrcto1lpt luvi;t t2to(opnydal nlfcia(f rumur ot0oex if3tysla rluvo t0tetomr3oatom eli s t srum(mpoudapenlnctat arrrurp;o0apeniictyslaDrlnvpnt0trxriociotla   ivo;s0 2urxo oydaptelncs tf 2um(  no0tpenifctldlsDum(mo;u4 rxrmo iadomDrlneols0seur(mpoo1ome liesa( arrmumo;u4tpxo ieiydlaDua(vs u0aetrxfctydop eau o;(  exm(mpiy4open nvsa() Dtaumoou1oetnifctysls ul(mo;() etoio3oytlpt  nes ( setrxm iydaptnmfctls) Drr( pno1ape ifetyslaDua(vp t0aetoifctytop  aieols0 2trio3nu4ol  mfcs s)sDumumpoo1ope iietadfs uanmon()tlxomo iy1op rau o s0s2xoir iodol  lfctl()srrrx  ;u4aee iociyt sDel(vonu4altoxrctotomtraieo ()teum(rpny1lpt licil( srrmx ooo1opxnmfeiasfmDua( p;() lxomf ty1om  aieo;t0 2xoim3iydamee feslt)aDrax ooo1altniictat mDuau pnt0texnxo3todfaDean i;(  eurirpiydamtnlnviat) Drruro;o0aetomiciysfm2em(vsn(4alenxrciydfmteaivi s sexo(rpnu4altn nes tfarraxr nt4oeenif3tadfa rmnms;u0tltnmoctatfptrluesls)sexr(o oo1lmt mnes s)a2rrx o;t4tpe  oeilsfm2umn s (4texoircta1la ranvi t0trxoirpiy4olt mneiasfaDtmx pou0apeoii3tydlm ulums t) exomociotop rlnvi;s)trxrio iy1op  mfes s)arrr(mpoo4aetnmociys aDulumo;t) ltnxrcto1lp eluvo (  rtmxo iydlmtn fvsatfa2um( poo4oltnmi3iys a ra(vonu4 ltrmr oydlp   nei s0tetoxr3ou1amt  iet t)aDtauro;o1apt mfetad a2ranmp;(4areoio io1omt an s;(0srur(o3oo1lpenmfcil()sDuaxm ;u0alenifciatlm rln p;u)trtnxfciytlpD  i s t)t2ur(m iodameemicias) rrax ont4tpeo feild a rm(mon(4aetnif3tydoaDr ueolt0 etm(r3nydom nlncslt aDur( pot4opxomi3ildfmDeln pnu0 leoir oatopt lnvs s  exrir3ou1amte fetlt  rrrxrpot4olxomi3iaslm ean onu)tetoir3iodlat  uei;t teuoio3oo1ameelfvil(fs2uau  ot0apt ii3ilsls2ra(mp;t) etrmr oo1la  aivi;t srxmxopnodalenlncsa()arur(r ;u1olt micilsls um(vpnt0aexrir3tytopDraivs;()teto(m3nydlpee fet s)s2rmxrpou0ale mfeiydlaDrlumo () rtrir oytom rluvs s t2ur(r3nu1lp  lfei (  Dtmu  nt4alt  i3tldlm2emn pn(4 ltnxo3ty1lptelu sls setrio io1ll  livsl( s2taxronu0tlx mi3tld sDumuvo u)texoir iadlp eaivs;(0srumir oy1opeemnvtl()sDumx oot1tpxniieiysls2elnmsnt4 rtrxocio1lptraivil()sexrim ou4ame  ics (fsrrm(  no4opt mo3tys a2uluvon()tetnxocoo1oa   ivo (0sruoim3nu1om n feil( aDrru onu4ape ifeilsfa emn ont0aetnmoctadlaD lies;s)setrxrpoo1lltnlneta(farrrx onu0tlx ioetlsfm ua( p;t)altnmf ootop   n i;t0s2urxo no4ale  fvtltfsDurxm ;t4aetnmieiydlm ra(vs t4tlxomr3totoatr uvil()t2to(mpnu1lm  mivsatfaDrmx pno0aexoii3tydlmDea( o;u4alxoxo oy1omt  n slt0s2xoir iu4lm emnct t  Drrxmpno1tpxnmicildls2ea(vp t4aleoxr oodlpDe i o;t0tetmxo3iu1openmfet s  ruax oou0aee miciytfs2em(vs;t4arxoxr tytoatr uvo s)trtrio nydopenmnvi (fs2rr(mont1altniieildfaDemumsn()trxrircta1lpDe nvi ()seuoim3no1opeelfvsl(f 2ur( o;o1aptnmiciad mDel(vpn(4altnxf tytopDrlu ols) etrir iu1omtemics sfs2ur(m nt4apx miciydfmDrm( snt0artrir3iydfmDe ivsl(  ruoio3oudom nmnci () rtr( o;t1olxnmi3iat m emums (4alenxr oadopt  n ils)t2trim oudlmenlict (fa2urur no1tex ifctadlaDeanvp;t4 etnmoctytfpD au s t  rtoio3iy4al  lfcsasf Drrurp;o4apeoio3tyslmDra(msnu) rtnxr3tytfpte u i;t0trxoxo3ou1apt  feslt)a2umu  ;u0aexo f3ilsls rm( onu) rtrio oatfpDe n i;( s2ur(o ny4lpt lnviat)arumxmont1tlxnif3iadfm emuvs;u)alermoctadlm rau s s  etm(o ny1apte iesatf rumxront1apenif3iltfa ul( p t)tlxrio3iydfmtelu i;( s2ur(r iu4optnlfvia(fa2um(  no0oetoioetydlaDuau onu0 lxrio3iotomDran i ()trtoio ou4lp e nes ( srtrur nt0tet ifciatfsDrln p u)aeenmo3ootomtr n s (0 2tr(rpnu1al nmfciatfarra(m oo0altnmoctydfm2eanvs u0 reoxf tadfa e ivolt0sexriopoydome lnct sfaDtrum ;u1tptn fciatfm2rl(vp;(0aetrmr3oatoaD lneol(0srxrxrpiy4lmte ivilt arrmxmpnu1tex ioeils a2ulu snt0 etomf to1om ranei;s tetoio3oo4am emncsls  2urumono0apt ii3ild s2emumon(0altrio oodoaD  nes;( teuoio3oodamtemfeslt)srtmurpoo4oet ii3tytlsDem( o (0 lenircio1lmDeli s s0 2uo(rpno4amt lfvtasfsDua(  ;o1opt iiciat a eauvs u4 etoxo3ty1la rln slt0tetmxopnodop  livia( sDur(mpno1oetomf3iasls2ua( s;t0alenif oodopte ivils)t2uoiopoy4op eliei s a2uaxmp;u0tlxo fcias aDeaumpn() ltrmoctadfa  aieils)s2xm(m nu4ameeliviasf 2ta(monu0tetoifeildfm2eln p;u0artomf oodfa eaueo;s texmim iodlpe mfcsl(faDur(  ot4tex  f3tlt a2ran on(4tlenmf3tatfpt  ueo t)srtm(r oy4lltn nci s) Duau p;u1aee miciat a2emu o t0tetnxfciotopDr ivo () rtrir io4lltn ieil(fsruax ont4olto fetytla2eaumsnt)aeenxf3iotfateaivi ()srtrir3io4apte net s) Drr( pno0tetn oetldlsDum( o t0trerio iotla rlivols) exm(m3oy1lm elivias)sDtaurpno1tpe  f3iltfaDrluvs;(4 rtnmo oydlm  li o s0 2ur(m3no4omeemfesasfa2tmu ont0tpenioetlt m rm( onu)tetnir3ootfm eau i s0 eurxr3nu4altnlfcs ()arum(m ;u0tpxnii3ild m emnmpnt4 etrif to1omD lnesl()t2umim3iudol n fci t)a2rm( onu4tlx  fctasfs2emu ont0areoxf oo1faD  u ols s2trimpio1lptnmivt t s2tr(r ;o1alx if3ild a2emu snu4 rtrxf3tadlmte ivols)s2toim io4lpt lfesa(fsDrrxrp;u4alt mi3iatfaDrmu p;u)trerifcio1fp  ln o;(  rxmxopio1omte nvi t)a2rrumpoo0oet mociyt a ra( o t4teeniocto1lpDrluei s0t2xrxmpou1amtnmnei s s2ur(  ou1oeenio3iydla rlnmp;(0aexnmf ta1oaD livs ()setm(rpnudlp nmicsatfartaxmpoo4aetomf3iasla2ua(vont0 etrioctodoat aueils  2to(mpnudol eliviat aDurxm ;u1aptn o3ildfs emn s;t)tlenio3oytfp r ueo;t0setoir3no1openlfvtat s2tr(mp;u1teeomi3iyd s2ulnms;(4trxoxoctotoaDraneo s)sruoxo3no1lmtelici t)sDua(r ot0oeenmo3iasls um(ms;t0aleoio3iydopDrli olt)teuoio iy4lmenlncsat)s2rmxmono1olx moctadfa ean p;t0 rerxo iy1lm e nvs;t0srumir iodllte fciasfa2rrx o;u0oet  i3ild aDea( p;t0arxrmocto1opDelneil(0 rxoxo3ou1lpt mfeil( sDta(rpou1aex mf3tys a2rmn o;u) rtnxfciydfatraivs;s s2toim oy4apenlfcilt arrrxrp;t4oexoif3ild s2ua( o;(0 lxrxfcoydop ran ils texoxm oo1ome mnesat)srrmu o;t4tpxomoeiltfsDea( p u4 lxnmf todfateai s;t0 etrxm io1omte nvt s s2raumo;u1optnii3ilt sDua(vp (0 lenmo3iatop e u ils  2umio3iu1am nlicilt) 2rrxmo;o1ope moetlslsDrmu o u0 ltnxo ootopt auei;(0 eurxo oy4lle lict s sDua(m ;t4oet mietadlm rau o;t4 renmocoy1op rln i;()tetoim3oy4lmenmnci t) Drm(m ot0alxo iciat s2uanvon(4tltrxf oo1lp  lu s t0t2xoxopnudoltelnei s  rua(r ;o1tlto ociyslmDraums;t0tetnmr ta1faD lnvsls0 etmirpnu1lm  liet tf 2ur(r ;o4aeto o3iltlsDemump u) exriocoo1lmt li s;t s2toxo iudamt lncsls a2rr(  no0aptnioeiltfm emumpn(4aeenmf3ta1opt anes;t) rxoxr oudlptemiesl()aDur(mpno4olxnmoctyslaDranmo u) eeoir3to1laDe i s;t)t2tmirpoudamte fcsls sDur(m ;o4oeenmo3iytfmDemnmo u0alxnxfcta1oa  anei;t) rto(o io1lpe  ivil( sDurx  ;o4oeenmoeiadfsDraumpnt0alxoxo3oadlptrau o s0seurxr3ou1opt mivils) Dtmxrp;o1ope ifeiydfm rmn p (0arxnio3iytomtrau o t) rto(opoy1lm elfes t  Dur(m nt4alen o3iytfs rlump t4 lxnxfctytopteliei s0t2tmxm iodlpe  ncil() rta(mo;o4tlen fetysls rau s t0arenioctotfmtr ivs;() ruoio3ny1omtnmictas a2um(r nu4tpeoifetlt mDuluvon(4tetrir iatfatr u s () rxm(r3no4lpeelnesasf 2umxro;o0tlx ii3ilt s emnvs (0aeeoxrcia1fmt  nvs t)srtoimpnudlp nlneilsf Dtrxm nu0opt ifcildlaDrmnvo t) renio iy1faDe u s;t0trto(opou1olenmneslt)srur(root0tlxo iciatfa um(vsn()tetoxr tadlaD  uvi t)texm(m oy1amtnlfcs t s2raxront4oeen octyd aDrmnmpnt4 exoxf ta1oa r u i;s setoiopou4lmen nvsa()sruaurpnt1tpxo fetytlmDean snt0tlerir3iatfmt  u s ()s2xrxrpnydole  fet tf Dumu pnu4aexnioctyd a2rm(mpnu0arenmfciytomDrluvi;(0 rumim ny4ap emfei s)aDua( pnt1aptniicilslm ean p;t) rtoir totfateau s;(0teuoir nydamenlieil() rrau onu4oltomfeiadla elnvpnu0aleomocoytla eaneo;t seumxrpiu1aptelfvi tfaDurxr nu1opeomfctyt mDra(ms;u)tetnxrciotomtraieols teumimpoudole lfet s  rurumont1tltnmo3iltfa2ul(mon() eeomfcoydlat aivs t)s2toxrpoodalen fvi s srtru  ;o1alx ioeiytlaDrmu on(0 etnmf tatoaDr nvs s0trxo(opio4omenlnviasfsDumxmpno1opx  o3tyt mDrmuvo;t0altnxr oadfptrliei;()s2umio3io4om nlfvi sf 2raxro;o0aetnmiciyd aDuln s;t)aexoxo3ootomDrlivil(  exr(rpnydlptemiei ( s2umu pno4tpxoifciatla2ul(vsn() ltoxf tytlmt  ivi t0texrio iodamt livias)a2ur( p;t0tltoio3ild sDrmn o;(4trtnmf3iy1oaDr uei () rxm(o iydom e nctas) 2tmu pnu1tpt  oeiydfa em(vsnt)aeeoxr oydlat lies;s s2trio3iudlleemnvs (farua(  ;t4tleniocilsfm2umnvo t) reoxfciatom  lnei s s2uo(rpiy1altnlivt s s2um( p;u0opt  ictydfm2elu snt4 rxrio iodopDelivi (  etoir no1lp n ncs sfarta( o;t4apxniocildfm rm(mpnt)tetrxf oy1laDe nvi t0srtoxo nudam n ici (  2ur(ro;t1ope moeilsfsDrlumsnt)aexnmf oatlm   nvilt0s2xoxm3iu4lltemivtat)aDraum ;o1alxo octydlm2rmnmp u0aeenircoo1faDr uei t)setm(m nydalte nctas) 2ra(rpot1aeenii3ilsfmDuau o;u) renircio1fatelnvi t srum(m3no1ale  fes t)a2umur ot4oleomo3iadfs2ul(mp t)aexrif totlat luvi ()t2xmxo3oydomenmfvsasfs2ta(rpoo1teen ictldfsDuluvo t)aeenmf3oa1fa e uvs ( sexoim3ny4lm  lnvilt aruaurpou1aeeoio3iadls rau p ()tltoxf ootopD  ivi t)srtoxr oy1op  lnei s)s2taxront1oexo oeiltfsDrluvon()tlermf3todfm  luvol() 2toxm3io4lme lnctatfs2trxrpnu1tpt if3iadfa2ean s;()aexomr oydla e nvo s) 2xm(m3ny4olenmicias  2urxmpnt1tee  oeiatlaDuauvpnt4tlenxo3tadlm r ieslt)sexrxrpno1ol  livtasfa2ua(moot1tex ioeiltlaDra( p u)teenxf3oodomD aneols0 rtr(r oudlptnlietat)a2trumpno1aeeoioeiatfs rmums;u4teeoif3tytoatrauvsl()sexoimpio4lp n fci ()s2ta(rpou0alt iieiasfa rlnmpnu0arerxf tatlp eln o;t0 euoxo no4oltn iesas sDrm( ont1tee mo3ilt m2ul( snu4tlxrio3tadfm eaneo;( sexo(o iydlpeelfei ( srrm(r ;u0oet ifctldfsDuanmsn()alxoxrcoatlmDelnesl(  euoxm no1lp  mfctas)sruau  ;u1tptn f3iad m2uanvonu) rxnxo3iotlp  ln ilt) euoio nudlptn ics t s2trx  no0tpeomoetys aDulums t4tlenif3iadlmD li i ( trtm(m3oy4op n fvtltf rumumo;t0alxomf3ias m2emu o t4trenmr oa1op rlu s ()trtr(o iu4op elivs s  Dra(rp;o1tptnmieiyd a2rl(msnu)aexrif iatoa ran o;( setrxr3oy4openmnet (fsrumx  ot4apenioctldls umnvs;t) eeoxfcta1omDr nvil( s2umxm3oy4ape mictlsf Dururpnu0tlxnmfeiltfm eau s;(4tltoir todoaD li slt) 2trim oy1lm nlncsatfarra( o;o4tltn feiatla2ul(monu) etoxfctotlm r nesls  2toio no1oltemfcils)aDrrum ;u0apxn o3tlsfs2em(vo t)aeerxo oy1lp eli slt)s2to(o3nydap   fcil(fartm(  oo1aptnmietytls rl( p;u4arenmo3ty1la  aueol()srxrxr ou1omtnmnci ()aDrax ont4tex moeiltlsDul( pn(4arxnir oodomtrlnesls)srxmxo nydaptnmncs sfsDta(root1olt miciad m ea(ms;t)tlenir oydla r ivsl()setoxo3iudlmt lfetat aDuax  ;t4tltomoetasfm2umumsn(4tetrio3ootfmDean i ()texoio nudam emnctat)s2rrx p;o4open ieiyslmDeluvon(0treomf oydopD luvi;t0t2umxr3io4lmtnlfesl( sDtruro;u4oleomociaslmDuauvp;t4aexoif io1faDrau s (  etrirpoodam e netls)s2tmxrpoo0texn fetaslm eln s;t4 eenmo iadfpDeai i;( trurxr3oo4ap nlictl(f rrauro;u1oet if3iltla elump u0texnxo oy1lmDrli i;(0tetmirpou1ape licta(f Dumxr ou1alxoiiciydfa ra( o;t0 exoio tytoa raues t trtr(mpiodlpt  ncias artm(ronu0apx ifeils s umnmo;u0teeoif3io1lptr n s s  exoim ou4optn ivsat srururpou0oexomoeiasls2ean pn(0 lenio3oadfp elnei (0srurxr3ou1am emnet s  Durxrooo4oetoif3tlslsDrln pnt4aeenio3iytomDeaivo t)srxm(m3no1altnmfviasf rtmxmooo0aet mfciatfs ulnvo;(4aexnxrcoytfm r uvo ()seur(m3iy4am elfesa(fs2tax  nu0altomfeilslsDuan o t0trxrxrcoadfp eai i t)texmim ny1omtnmicilt) 2rm( pnu0tlx io3iltfaDuanmpnu4arxrmf oydoat ln s;t)texrxo3ny4apt  nesatfs2taumpoo0tpeoio3tydfsDuanmsnu0 ltrxocia1om   iei;t seumxo ny1llen nvt (  rtrx  ;u0oexn i3tasfsDrm( p;u0 rxrif oa1opDr n s (0trxr(o3oo1ll nlfvi t)s2ururono1tpxn ieiadfs rmu p;()teenxf3oo1latrlieil()t2tmxr oy4amtnmfvta(  2tm(mpnu1alxoii3iyt aDum( s ()arxomr to1fat  nes;(0srxrio ny1ol  lfvt t)a2rrxm nu0apxo feiyt a emumsnt4tlxnirctotfpDrai s;t0s2tmim3io1lleemiesltfsDum(m nu0tpenmi3tldfs2rmums t0trxrxrcoydlmtelnvi ()s2xoirpnu1lle mivi sf Dra( pno1teenii3iydfsDranmp (0tltomr3oa1lm r n sls  2trxo ou1aleelnesas)a2raumooo1olt io3ilslm ul( pnt) ltrmfcoatoatrlnvs;t0srxr(m3oo4amte iei sf 2rmurp;o4opxoio3ilt s emu pnu0 renir3totfmtrlnvi s seuoimpoo4lle  nvs t) Dra(r nu4tlxn ieiasfaDumnmpnu)aexrxf3todoatrlivi t0s2uoxr3ny1ameemict sfsDrmumo;o0opt mieiys m2ea( onu0trtnxfciodoa e i o ( t2tmxmpoy4opt  fcs t)a2trumo;u0olxn ieiydfs rau pnt0texriocto1omt  iei;(  rxmir3nudllen nctl( s2uaxmont4tpen ociat m emuvs;(4 leomfciatomteau s () 2to(r no4lpee fesatfsrumuroou1opxomfeiydlmDumu p ()aleomf3oodoaD ln i s0trto(rpoy1lmtnmnctls)aDtmu  ot4apeo feiat m uau pnt0 rermr totlm elnes;t) eumxo3oo1olt  fcs t)artmumpnu1tex mi3tasfa2ea( o;(0 rxomo3oatfm r n s (0trxr(o iy4amee fcsltfs2rrxmpnu0tex mfeiadfmDumnmo u0altrmr3oo1fmteaues;s)s2xm(mpio4am e nesat)srumur ou1oexnmieils m rlu o u) lxomo3ta1la elnes t)s2to(opiodll n fvil(  Dua(  nt1aee if3ilsls2umu pnu) rermrcoydfm  aues;s0seuoir io1lle  ieslt) Dumu  ou1oltniieiatlm2eau s t0tltnmr3oytfaDr nes s0tetr(m3nydlm  lnvsls  Duau onu4opeo i3tls a2ul(mon(4 reomf oydlat au s s texoio3oy1op  mivil( a2rax pou4olx  i3ildlmDranvo;()texnmo iadlmDeaivolt  exoim no4apt  fvi s)a2ra(mpoo4aetoif3tld aDuauvp u) ltrxr3tydopDrauei;t)t2urxr3ny4ameelivias  Drmx oou0texnmieiatfa uln ont0areoxf oydlmtelneo ()sexo(r3no4aptnlfvt () 2tr(m no0apenio3tydlsDel(monu0 lxrif tydoat li s s) rxmxm iu1apee nvi tf Drrxmpoo4aleo fctatls2ea(mo;(0tetrir tatfmtr nesl( sexmim ny1ameemfes t)s2umu  nu1aleo i3taslm2rln onu4artrir tadlpD anei s0 rtm(m iy1am  mncsas)arraxmp;t4tlt  fciltfmDrlu s t)aeenifciatlp  aivilt) eumxmpnodamtelfeslsfs2trxro;o1oetnioeiyt mDrln p u0tltniocoy1fm  anes;s0 etr(o3oudop elfvilsf 2rrxr ;o4tltnii3iasfa2emuvont4artoifcoadlaDr uei (  rtrim ny4lm  lfct (fsrurumpnt4oleoii3ilsla2ran s;(0 rxriocoydopD livslt)t2uoxmpou1opt mneia(fsDta(m no0aeeoio3iat sDeln p u0tetnir3ta1fmt auesls0 rtoimpnu1omtnmivi () Dum(rp;o1opt mo3ildlsDemuvp;u0 rtoxrcootfa eaivs ()teurxo3no1ol e nvi s) Dtm(mo;o0teenmi3ildls2ulnvs (0 lxrir iadfa  liei t) exo(r iu1lm  mfet sfsrta(  ;o4olxniieiys a rl(mpnu4 lxrmfcio1fm  au ol( t2xoxm oudopeemnct t)artaxmpno4aptoifcildlsDrauvs;u4aexnxf oytop raivs;t0seurxopiu4ope mnes ()s2tmx ont0tlxnmfeiyd m2rm(mo t0arenxfciytoaDeanes;s0srxrxm3oudlpt  netls s2ua(mo;o4oeen i3iadlmDeanvo;(4aeenmr3oodfatr nvsl( trtmio3oydolt mfvsatf rur(  ;o1tpenmo3tld s um( s;u)tltnxo3oadlpte nvs t)trumimpiydol  mnesl(  2rru onu4tptomietlsla2rauvs;u4aexomr3oy1lp  lneolt0texo(mpiodomtelicsltf 2tru oou0tet mo3tlt sDra( p;t4artnmf oo1lp elivolt srxm(r3nodame lfetlt aDtmx oot1aetoii3ils a ua( o t4 etrio3tatlm eaues;( teuoimpio1apt mnvsl()arumx o;u1tpxomfeiysfs2elumsnt4trxomf3oa1om e iei;() 2xoxo3iy1amtnmfetltfsrtrxmp;t4olt if3ildfs ul(mo u) etrxocoadlaDraieo;(0 rxoxmpou1lltn ncsa( a2truro;o0ale io3iysfmDemuvo u)trerxo3iatoate ieo s)seuoimpiu4opee iet s  Dra(mono0teenmictatls eanmp t) rtnmo3tatfate ivs s) exo(r ny1omt  fet (  rtmur nt0aptnioetltlm2umnvp t4trtrir oo1lp e iesl()s2tmir oydope lnctltfa2ta(ronu0apxomoetasfs em( s t)trxnxfcoadlp  livi ()setr(r nudop nmnci ()aDtaumoou1oltomfeiasfsDra( o u4 eeoxo3oodfa   nvol() rxm(o iy1llte fet tfsrua(rp;u0tpxniociltla uauvp;t0 exomo oodlat aivo s)teuoxm no4om  mnvi s  2tmu  oo1tetomocilslm2rmumpn()alenxo iatoaDeaueo (0 rtr(rpnu1om   icta()a2tr(r no4opxoioetadfs rlu p (4 eeoxrcoa1fmt  i s;s srtoirpiu1aleelnvt s)sDtm(r ot4tleo i3tyt s rmn p ()tlxnmf iydfa elivs s sexoirpou4omtnmfei (  2rax o;t0ope  icias s umnmo;u0 eermocia1fpDeai i (0 exoxr iudal emfvt () 2ur(r oo1altnmoeiydfa2rm(monu4altrxf3iy1fmteanvi;s0setm(m3oo4amt lnetatf 2tmx  ou4ale  ictyd s umu s;u4 rtoxfciotfmDrauvs t) 2xr(rpny4amtnmnvt t)sDrr(  ;o0apxoiieiadlm2ea( p;t)teerio iodomD aivi (0tetoxm ny4alenmfvsltfaDrrx
\ No newline at end of file
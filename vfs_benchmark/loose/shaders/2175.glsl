@@ -0,0 +1 @@
+i i t trtoio io1optnmivtl(fsDrrx o;o4aleomi3ild m2um(msn(4 etrio3iydfm raues (0texr(rpnodalenlivtl() 2uax p;u4alxn f3iysfm umnmsnt) reomrcta1op eanvi;t)texmio no4lmteliesas sDrr(r ;t4aee mfciyslaDran s;u0 exoxo oydlaD aivo;( srxm(m iy1omtemfetasfs2ua(r ou1opx mi3ildlmDem(vo;()tltomo3tydlat  nei (0 2xm(mpno4omt mieta(  Duru  ;o1altnmoctytfa umnmo (4 rtomo oydoa eaieols)trxrir iydamenmies ( sDtm(rpoo4apeoio3tatlm2rm(mo t4tlerircoatlpt anes (0 eumir3nu1ape  nvil(faDrmxm ot1ole  fctydlmDrmump;u)aetoircto1optrln ol(0 rxoir3oo4am e neia(fsrrr( pou1oleoioctas a2ra(monu4altnmfciydlmDeaies;( seumir ou4lleemncil(f 2ua( pou0aeto oetydfm2umu sn(0teeoifciadlm rau s;(0t2toirpoydapte ivi ()aDtrxmpno1tpx  i3tas m el( p;()trerioctotfmt lnvol()trxmim no1llt lfci s  2ta(  nt1oeen i3tatlaDrm( o u0arxoif3io1fa rln o;s) 2toxr oydam e fet ( srtmxmpno1tlx if3iad aDem(mp u4alxnio3ia1fpDeanei;() rxm(opoodom  licils  2ta(rp;o0oltomociadfmDul(msnt4tlxnio iydfp e neil(0seuoxopiy4olt  nvtatfs2umu pnu4ale  ictat sDem( s;() ltnio3to1fatrln ilt) 2toimpno1apt licslt)a2uaxrpnu4olx ioeildfa2um( pnt)tltnxo3oa1om  lnvo t0truoimpoo1lp  lfcs s s2urxr nt0aexnmoeiydlmDeln o;t0trxniociadfp  au s;s0trum(opiudlltelnvtl(f rum(rpoo4tptomietytls2umums ()trenxoctotfp   nvo;()teto(m3nu1optnmfetlsf ruaxront1tltoif3tyd s2ua( o;(0altrxr iatlpDraues;s0srxoxrpno4op  mncslsfsrtr( o;t4aetomoeiasla eaumo t4texomf3totlpD lieo s) 2xo(mpoy1omte ncsat) 2tm( o;o0apen ictysfa2emnmo;t0 ltomf ootoat livs s0s2umxrpiy4am emnctl()aDtm(mpou1oetnmocils a2um(mpnu4areoif3tytlaDr n o (0trtrxo3iydal nlivs t) Dtaxro;t0tltn i3iyd m rm(vp (0tlxomf tytoaDrli ols0 rurimpoydlpenliet t) Drau oot1apx  f3tadfa umu p;t) rtoioctatfpte uei s)t2xmiopiu4omtnmfct (f 2tau  nu1tpxomf3ias s um(vp t) rerir todomteli o;t0 2um(m iu1lm nlncil(fa2tau pno0tpe mf3ias s ranvpnu4tlxnmf3iodfa ran o t0s2xoir ny4lmte nei t)sDtrx pnu1oltoifeiatlsDrlnvsnu)artriocoadfmDe u s s t2xoimpoydlpeelivtltfa2uaumonu0oeeoifcild aDrlu pnt4tleoxf oatopt  u ol(0sexrxm ou4alee net ()srumu  ou4teenifeild a2emnvp;u4 etrxoctadopDrlueil()setoio3iy1lp n ivs s) Dta( pnt1tlt ioeiyd mDeanmo t4 rxomo3ta1opD li sl( seuoxo3iy1am emnvtlsf Drrxmpoo4opeoiiciysla ra(vo (4 etoxf oodfmDe uei;s texrimpnodlp n icil()sDtmum nt1opxn ieiat s elnmo;t) exrmocoodfp r iei;s)t2triopoydaltn fetlt) 2umxm oo4olxn fciydlsDelnmpnt4tlenxfcoatlmDr nvs ( s2xr(opoydlp   icsa(fs2trx p;t1apx ioeiys a rm(vo t)tlerif tatop   u o;s seur(mpiy4oltn ivtls  2rmxmo;t1tpeo ietyd s umnvp;t0arerio oadoa rauvs (  rxm(m ou1ale licsasfs2urum ;t4tlx if3tlt s emnvs (4teeomf ia1fmD  u ols0 etm(r3iy1lme  ics t)sDtaxmpno4tleoif3iytls umn p u0arerxr3totfpDelnei;( trtoxm3nu1lpen nesa(f rtaxmpot1aeeoiictltla rlnmon(0 lxrmfcia1opteai il(0 eumim nu4am nlfct ( srrrx p;o0tpen i3iatla rlu pnu0alxrxr3tydom   neo;s)teurxm oo4apeelfcsat)sDur( pou4altniicildlm2em( snt)texoirctadlm rauvi;() rxr(r ny4llte ieil() 2trx  nu0optn f3iasfa2ea( pn(0 ltoir3io1oa rlnes () etoxrpou4olenlfciat) 2uaxm ;u1alt mo3ildfmDelumo;u0alxnxf oadlmte uvsl( trumxo oy1op e fcs ()s2rr(  no4tpeomoetltlaDrlnms;(4tleoirciatfa eaues s0trumimpiodaptnliet t)a2taxm no0tpenio3ilslmDem( ont0tltoif3iodoaDelieil(  exmxr3nudomenmfvs s  rtau o;u4aeenmoctlt aDum( o (0 eenxfctydfmte u o t)trxriopoydolt  nvia()aDtmuro;o0alenmoeiytfmDum(mo;u0tlxrxo3oatopDraiesls0 2xm(r3iy4lptn neilsf 2umxr nt0oeeoiictydfm uan p;u) rxrif3to1fmt liei;t)srxr(o3oudam nlncil(  rurx  ou1teen i3iyd a2uaumo;u0tetoio3ty1fp elivo;()trtriopiudal  mici s) 2raxm ot4tpxoiictysfa2el(vo u) rxrio3ia1fmDeluvi;t0 exrxm3oo1ap  lictls  rrau p;o4opt  ieiad sDea( o t)trxnio iytomte uei;t0 etmir3nydll   fvsa(f rrmx ont0tpxniicilslsDumuvo;u) etoifcty1latelnvsl( seur(rpnu4lleemfvta()sDum( pnt1oeeomf3iasfs2rm( p t0teeoiocoy1fa eaies s)s2xoxr ny1lme lnvtasfsrraurpnt1oltoii3ilt a2rlu s u)arxnircoatoatelnvilt trtrir3ou4lleemfctlsf 2ta(m ot0tetomo3iydfa2eln p;u4aetnir oo1oate nvi ()t2urxo io4altelict t)a2raxmo;u4openii3ilsfa um(mp u4alenxoctydlmte i s t srtrimpny1ome lfcia(fs2rmxmoou4tpxo o3ild a ra(mp;u)tlenmr3ia1lateaivslt) exmxr3oy1lltelnvil(  ruru  ;u1aet ioctadlaDem(mpnu4aexrxocoatopt luei;t)texo(rpoydlm elfvslsf rtax o;o1tpen ietas a2em(vo (0arxomr3oydfaDrlu s t0 rto(opiu1lpeelnvs ( a2uaxrooo4altniietltla2rmuvsn() etrmf iadlateli s;s0t2xr(m oo1lp n feilt arurum ;t0oex mfcildfa2rauvonu)arenxfciytop ean o;(0teur(rpio4amtemfct s)srraxr no4apt ifetydfsDrmnvp (4artoxo tytom  lieo;( t2tmim3iu1lmeemietat)aDuaumpnt0apxo octyd sDulump;u)alxrxocoytfm eluvols0trtr(rpoo1lltnmictas)sDua(rpnt0aexomoetat m2rm(mo t)trxnmrciotfaDeaieo t s2uoxmpoydapenlfcs t a2rmump;u0tleo ietatla umuvsnu0 exnmr3iy1om eliei ( sexo(o3oo1lpt livt tfsrtau  ;u0teen fcilslm umuvo;u4 lxnxo3iotlp rauvol( texmxm nodlpeelfvtat)a2tm(mpou1olx iieiyslmDuanms;t)tlxnmrciy1fm e uvo;s)tetrio3iydalen ivsasfaDtrxmo;u4opeomieils mDuaumsnt4tlxnxr3totlatrau o t trtmiopnu4oltelietatf rrmur nt4alenmfciadfmDel(mp u) etnxfcoytlaD anvols)t2xm(o3nu1op nmfcsl()aDrrxm ou4opt  i3tad sDuauvsnt0tltrmociy1la r u o s0s2xr(m iudlpe lfetlt)srrrx ooo0tetnii3tlsla rm(vp;t4aexrxo3tadlm   nvi s)t2um(o3oydomte iesl( a2rrxroot0apx  i3iltlsDuau o;(0 rxnxf iy1omDraiei s) 2umim3no4apt mnvsa( aDrr(rpoo1olt  feiydlaDuaump t0aeerxr3io1faDrau ol(  rumxrpiu1omteliviltfaDtau  no0olto fcils m2elnmo u)tetniocia1oaDr uesls) exo(r nodole  fcsltfsruaum nu1oleo i3tadfaDul(ms (4artoif3iy1oa ranes t setmim3io4ale  feslsfarraurp;o1aleo fciad s em(vpn()texomr3oydfaD ln i;(0 rtoxrpiudopte fvtat) Dtaxm ;t0texn fetldls2umumsn(0 ltnmo iadopt lieo s0 euo(o oy1omen fei t)sDrruront4aetn fctydla eanvs;t4trerio tydlmDeaivil( sexm(r3iodolee ies t srrmx o;o1oltnio3iatfm2ranvp u4arxoxf oodfmDelnvi;t)s2to(o3iy4lpeemfei sfsDuaum no1oexomiciltlaDul(mo (4texnifciy1la  an s t0seurxr3iydoltemfcsls  2rm( pnt4tleoiieiad m2rluvont)tltrmf3oadfm e ivo () etoir3ou4lpe mieta( aDrmurono0alxo feiadfmDemnvp;u0trxnxr3totlat lieil( texr(o iy1om e ictlt  ruaum ot0tlenmfeiadfmDrmu s;u) lxnir3io1lpD livo;() exoxr no4ap elnetat)aDtrxrp;o4oeenifciadlmDuln p t0 rxniocto1lpDrlieo t)setrxo nu1ap emieilt)aDrm( pnu4apxo fctas m2rluvo t)trermr3iytlateluesls0t2tm(mpno1al nlneta(fsrrrxr ;t1tpxo feiltfs rlnms;t)tlermr3iodopD  uvs t) rxr(rpoodome  iet ()aDrrx p;o4tpt miciltfs2rm(mpn(4aeeoifctodfp rlnvo;t)s2uoim oodlme mnvtls s2rrxr nt1tet  i3iyd a rmnvp;u4trxnxr3oo1lpD anvi;(0sruo(o nydlpee ietas) Dtau pou4opxomfeilslm uau p;t)aetnxo oa1fatrluvi t) exrio iydlpt  ieia(  2tm(r ;u0teeomfciatlaDemuvont0arxnmf3ta1opt  ivo;s  exmxmpiu4ol   ivslt arrm( o;u0alxniocilsls rlu s u4aetriocoatlaD aivol(0trur(o3ou1ll  mncsa( sDtmumpou4optnio3iytfs rm(msnt)tltnmr3iodomteln o;s  rumxm3iu1lpe  nvsat aDumu  nt4teenmiciasls em(mp;() lxnmrcoytfmt luei;s  exrimpiu1opee ivs t aDtaxrpoo1alx mieiysla2ra( s;(0trtrxo to1oat auvsl( sexo(mpoodlp nmnvtl(f 2rm(mpot1oetniociltfa2ra(vont0texomo iotlpte u o;(0texoio io4olenlfet tfarumxrpnt4ope  fciltfs rl(vont)aetoio tydfmt  uvs;(0trtmio nodaltn fei tf Dum(rpnu1tlx ifctadfsDem( o;() exoxociydomDrli ils)srtoir3iudlmeemivtatf Dtmx oot1oexomoetlsfs uluvsn(4alxoxf3ia1oa e ueo;t0 2urirpnodam  micia( a2tm(mp;o0tlt io3tltfm2rmnvp (4trerxr3todfmt auvi t0 eum(r3nu4ll elivia()s2ra(rpoo4oetniiciytlmDranvs;t)aetrio3todlaDe n sls) 2tmim oydlle mneil()s2raxrpot0olx mi3iytls eau p;(0artnmr tytop eln sl( truoim3iy4ap e iesl()sDrmxm ;t4tet iictldlm el(mo;u0 exoxf tatom  an i s  rtr(m3io1op   neil(f Durxrpou0olx mfciaslm2el( pnt4teermo3oydfmtrauvo t srxmimpio1apt mictatf Dtrxmono4alto fetasfs raums t)treomr ootfm  ai s t s2uoim3ny1apt mfcslt s2taurpno0teeo feiad m2rln snt4tltnxfciydlaDrlnvo;()tetoiopnydlme mnctls  rtmx p;u4optnmoeiys m rlnvp (4 renio3tadfa elnes;t0s2xoir3iy1omenmivilsf Draumooo4oltnmoeiltfaDrluvo t4 exomo oo1op eau il( sexrir3nodapen fctl() Dtmxm ;t4tlen i3ias a2elnmp ()artnmf3io1oa eaneol()trtoirpno4ame lnesa( a2umu  ;o1oexnmoeiad sDrl(mp;u4 lenmf3tytlp  an olt truoio3iu4apenmiet sfaDtmxro;o1oexn f3iadls rl(vsn(0artrxr3oy1la rai sl( s2umxopnodalt  ivi s aDua(  ;o4teen o3ils a ua(vp t0 leoxociy1laD  i s;s) rxoim3oydom nmietltfsDum(moou0openmf3iasfsDua(vont0aexoxo3ta1fatr nvo ( s2xrimpny1apeelnctl(f Drrxrpno1tle if3iys a2umumpnt0trxomr3tatfa elu s;t) rxr(r nudame livsat aDrr( p;o1oet ii3tyt s2rl( pnt)aeeoxo iotoa eln s;( s2xoim iodam elictat aDrm(  no1oex  o3iatlm uauvp (0aleoif iotlpDraues s)texrxmpny4am   nesl(fsrrrur nt0tpe mfetatfs2eluvp t)tlerxrcoy1fmDr u o;s)srxmxopou1olt lncs sf rururo;u4optoiieiydfs2ulnvp (4altnir todoptelu o ( sexmio3oy4apte ictat aDtmxrpou4texniiciat s uaumo u) rtnxo to1omDean sls sexoxo3no1lmte fes sfa2tmxro;t1optnmocildfaDumnvpn(0 eenifcto1opt lueo ()tetrxm3ou1op elivia(f Dururoot4tex mf3iatls2ran sn(0 ltrxo iotlmD  ueo t)srurxm3oudopte fvs (  Dta(rpou1ape mietlt a el(ms u) ltrmrcto1oateluvslt0teuoirpoo4aptemivt t)arumxrpot1tptn oeiytla umnmp;(0 rxomocoodla  aivs;s s2trio ny4opt lncta()s2umxro;o1optn ieiltlsDumnvs t0 exrif iodopte i o;( texrir3iodapeemneilt  Dumxmpno1oexnmoeiadfaDraums t0aeeomf iy1omDeaivo (  rtoxrpio1llenmnesasfaDraur ;o4optn iciadla2eanmont0altnmo3oytfptraivs;t)teto(mpiy1ape mfcias a2rrumpot0opxoioeilt sDuau pnu)artrio tadlmD  ivi s t2umxm ou1opte fvt sfarurxmo;t0aexnio3tydfm eln p;t0alxoxo io1lmteli i;()srto(o no1op elnvsltf rrmx  no0tleoiiciyd a umuvp (4 exoxo3io1lmte u i t srurxmpoudopen nvi (  Drr(r oo1tleo f3tydfsDeaums t4texrxr3iadoa raivslt sexmxr3iy1am  mici t  Dtr(  ou1aee  i3tld s2ranmon(0 lxnmf3tadlpDrauesls)seto(opio1alenmici t sDrru  ;u0aptnmi3tatla em( o;(4texrxfcoo1lat lnvol(0srumxo oy1omtnlnes s)aDur(  oo0aexn fciltfsDuau o u4trtoio3iydfptr ivi s teurim3oo1aleelnvta()aDuru  nt1aetomociysla rln p () etoifcoodlm raneo t) etrimpoydomtnmicslsfartm(mo;u4tpenifciadlmDrmumo t)trtoxr3ootfmDe uvil(0t2xrir iu1al elietltf rtm(r ot1tpx ifeiyt s2uau snt4 exrio oatoa e ues t) rto(mpou1lpt liesl(  2umxrpno0alxomocilsfsDuln o;u4aetrxf3oydoa  li ols)trxmxo oodamtemnvt sfaDraum no4tpe ifeild m2ea(vp u0altrirciadoa e uesls) exrxmpnu1amtnmivsat)sDum(mpno4tpt  oetas sDran o (0alxnif3oa1fat au o;(0texo(r oydom nlnvsl()sDta(mpot0opeomictyt sDemums;()altnmr3iodlpDeanvsls)srtrir nodlmee fet tfsrraxmpoo0tpxn icilsla eanmo (0arermo totomDr nvi s srxrir oydlm n nvi (  Duaxm ;o1optn o3iyt mDea(vp;t0tlxoio ta1op   n i;(0 ruoxopio4op nmncta( srum(moot4opxn oeiytfs2ua(vpnt4trenircootom raues t  2to(mpoy4lm emict ()a2rr(mono0aeto fciyd a ulumo;t)altnxo3io1lpDrai il()seuoxo nudlp  mfesl(fa2trxmonu0opx ii3iad s ua(vsn()tetrir oy1lp  au o;( trxrxo no1lp  mfviat aDtauroou4apxoii3tasfa emu s;(0 eeomo tydfp   nei t t2uoim ny4op nmieslt)s2rmur ;o4tpe mietytlm raums ()texnmo oo1oat auvo;(  exrio oydop n iet sfa2uaumo;t0oeeomo3ias m em( onu)tlxrmo oodoa rauvslt) rtmxopoy4op  mici (fa2ur(  ;o0oeenmieiatfs um(vo;u4arerif3ta1lmteaueil(0sexo(r iydop emneiat) 2rm( ooo0alen iciasfaDeauvo (0 lenmr3todla  ln sls  rum(m3nu4lm n ict (f Dtr(rpoo0opxnmi3ild m2el(vp (4arenir todfmD an i t t2xrio3iy1apeemfctl()aDuaum nu0aeeo f3ildfs el(monu0 etoxfcoodfaDe i o;()srurxo iodlp nmiet sf 2tr( pot1tle mfciyd a emnmpn(4 exnmo3iy1fatrlnvi (0 2umim no4ale  ivsat sDtmur nu0oeto ieiasfs2emuvs;()tetnif iatfpDelnvs;t0sexo(r oo1lleelietas srrr(mpnu1oee ioeiytfaDeanvs u)texomr3io1fa e iei;(0 exmimpoudlmte ncs tf rrmxmp;o1aexoifciaslaDrlu o;u0aeerio3ty1fpt luei;t) etoiopnudalee ncsa( sDtrurpot4aexoii3iaslmDrlump;u4 exnmf tydlm  an i (  rtrxr3oy4olenlnvsa(f rururo;t0tptnifciytlsDul(mp;u0aleomo iotfaDeauvslt)t2xo(mpno1optnmfes () 2tm(  nu0optnmf3ilslsDuau p;u4alxnxr io1lpDrai ols)teuoxo iydolen fvslt)s2rrurpou0tlxn oeiat s2emnvonu)trtoio3todlpDelivil() 2xr(o oo1ap  micsa(f 2rau pnt4texomi3iltfa ul(vo (4 lerxf3ta1opt  i ilt0t2uoxo oydameemnesatfsrtrxm ;u0aee mfcias m rmuvo (0treoiocta1lpDr u s s setmxm3ny1lleeliesat sDtr(moou4apeoio3ild aDrlu s;t0aetnmfciadfaDrlues s trur(m3iu4opt  icta( artau  nt4apenio3tltla rlnmp;t4arxoirctotoaDe uvi ( seuo(r oo1llee ivia(fs2rr(mp;o0tlxomietlsls rmnvpnu0artrifcty1fa eauei;s seur(o3nodoltnlnei sf Duau pno1teeo oetytfsDua(mo;t4 etoirciotlm   ieils  etr(m3oy1om  mfvtlsfsDurum ot0olto i3iydlmDrluvp;t0artoxfctytlpDe i o;() 2umxo nu4olt lnesltfa2ua(mooo0oltnmf3tatfsDrmuvo;(4arxoxo3oydlmD  u s;t0tetrir3no1llt mnvi ()artm( onu0apxnmoetas s2umnmp;t)teeomr3oytlmte uei;( t2tmiopiu4al  lnei ( a2uax pot4aptnioetyd s el(vo t4tltnmr ia1oa  aieo;(  eurxopnydlp e ivsatfa2uaxm ;t1tptniocils mDemnvont)aeerirctadomD au s;( sexo(rpoy1ope  fctas a2rrur nu0opxnifetlslm emums (0alxnif3to1oatraivo (  2xr(r oo4amt mncs sfsrrrxronu1oetn ietytfa2ra(vsnu0artrmf oydlatelneo;s)srto(m3iu1lmte ieils)artr(r ot4optn oeiytlaDea(vs t4altriocta1lmD  neils texmxo io4lpe mfvslt sDta(  nt4aetomietys m2emums;t)areomr3iy1fpDraivi;t texr(opny4oltemicsat arua(rpnu1tpt mfciydfm rlump (0tetrmf ia1omDelu i s s2tmio ou4omenlivtl() rrauronu1oeeomi3tltfm eanvo t0artrioctatfmtelnvo;t truoim3nu4ope  ivil() 2umurpno1opxn f3ilsfa2umnvo u0trxnmr3tatfaDraies;s) rxmxr iydaleemnctas  2um(root1oleoioeiydfm2ua(msnu0arxnxo3ootlaD  n i;s0srxoir iu4lm e iei (  2uau  oo4olxoiieilt s eaumo (4 lxoxr3oatfat  iei;t0 2xmxmpoodopt  neias)aDuauroot4tleomieiydfa2um(mp;u4 ltrmocoy1lat aivs;t)sexoio iodam   ieiasfsDtru  ;t4opxo o3iyd m2rmumo;t)aetoif tydoate uvolt)srto(opou4lleelivias) 2rmxrpou4ole ifetls m rlumo;u) rxrir iadoate i ol()seumxopoodamtelfcil(  rrax oou0opxnmoctltfa eln o;u0 etnmo oodlpD lues;() 2urxo3ou4oltnmivsas) 2trur ou1aexn oeiat aDra(mo u4alxomrciydlm rlnvi t)srtoxrpoodom  mnvt tfaDrru  ot4alx  i3iadfa eluvpnu4 exoxr3oo1lmDrluvs t)t2xoim oudam n nesa(fsrumxr no0apen fctyd s um(vont4tltoirctadlpt li s;t srto(r3oydlle  fesl(fa2rmumont0apx ioeiyt a ranvo t0tlxrif tatfpD lnvo;t) etmxo oudal  lfeslt)aDrrxrpno4tpxnifctlsla uaumo t0treomo3oodfptr ivs ()s2xo(rpnydamen iet sfs2ur(ront0apeoiictltls eanvs;t4alxrxr oatfmt au s;s s2xoim iy1opeelneiasfartm(mp;u1optnifctld m ea(msnu4arenif oydfpDeanvi;s0s2xrxr ou4amtemictas aDuaxmoou1aeeo ictlslm eaumonu) ltoxo iotfaDeaiei;s srtoxr3iu1alt mfesl() rtaump;o4tetnmieils mDuan p;u)aexrifcoodfm  anvs t  rtm(opou1open fcsas)sDua(rpou4tltnmieiltlm raump;t) lerir3iotfp  luei s0seurxr io4op nlieia()sDumx ono1open fciatfmDumnvp;u) eeoxf3iotopte neslt)srxr(r no1ole mietltf rrm(m nt4tlxo i3iltlm2rlnmsn()trxoif3to1lptrauvslt0 rurxo3oudlp n ncta(fa2ra(rp;t1alxoio3tas aDuanvs () etrxo iy1omt aues s)trum(r3nu4ap e fvil(  2ur( onu0tpeomf3tasls rmn s;t)alerxf3oo1lmtraies;t s2umirpoy1ap nliet s aDtmur oo4tpxnif3tldfa2ea(msn(4trxrxo3oadlaDean ols  etmxrpiu1amtnlietat  rurxmpnu1apenio3iltla2umnvs;()aleoif oadoaD  u ils sruoir nodlmeelnet tfaDumxr no0oleoiictldfm2ea(mo u4 lxoxf oo1optrluei;t) etmxr oy4lptemfcsltfaDra(rp;o4alx  oeiatfsDemnmp u4arxrircto1oate uei t) eumxr3iu1omte ieia()artax oot4ole  iciltlm2rl(mp u4trerxf3oydfmD  ues;s0t2ur(r nodll n nct s srrrxmont4aexomi3iys sDrm(vpnu4alerxrcoo1lp  li s;t trxoxo iy1lptelfeil()sDumu p;o1openmfeilslm umnmo;u) eerif3oytoa  anvs;s sexo(o3nu4al  lnei ( sruaxroou1oet  o3iytlm ea( s;(0altoif oatfp rln sl(0srxrxopoo4oltn fvtasf Dua(mono1opxnmfciyt a uanmp;u)tleoiocty1laDe nvs (0sruo(m3oo4aptn ivs t  rrm(rono4oexn o3tasfa uan s;(4 rxrmrcoydlatrai slt0srtmimpoy4al e fciat  rta(  ;t1apt  ieilsfaDelnvs;u)teenmf3oa1latrlies;s)tetrim ny4alee nci sf Duax  nu1aptoiieiyt mDulu p t0arerio3io1omt  i o s srtmxm ny4lp nmfcsl(faDuru ont0aetomi3iasfa ulnvs (4 rxoirciatlmDrauvsls0trtrxo nydopt  ivi sfarrrx onu0tptomocilslmDrmuvp t) reomrciy1fate u o ( teurimpny1ap  mies ()artmx oot1opxn fctas s2uanvp;t4texoxr todla r nvo t0trumxm io4ll emncsltfsrurxrono4olto f3tydfs2ea( s u) rerxf oatopDe ivo;t  etmirpio4om emnci (  2rau ono1alxnmi3tadlm2rln p;u4tltoxocia1lmt anvi;t srtoio3ny1oleemnet (fsrtaum ;t0apxn ictys a2ulumo;u0aetnmociy1oa eaivolt) 2uoio3io1lmenlnvsat) Drmumoou4altoifciltlm2emn ont0 rtrxocoy1omt lnvo s  2toim3ou4optemfvsas  rumumpot0tex mfeild m2emumpnt4 rerif3ty1late nei () rxoim3io1om nlfciasf 2ur(r ;u4aeen ictat m elumsn()aeeomr3iadopDe iei;s0sexrxrpiy4lltnliesltfsrtmx ont1tex moeiysla umnvpnt4 lxrmf3oatlpD luvi;s) 2uoir3iy1omtelnvtl(fsrumumpot0opx  i3iatfa2ea(vo t)aeerif totfmt auvo s  eumxr oy4lp   fcslt aDumur no0oeto o3tat s ua(vpn(0texnifcoydlpDelnesls0setmiopoo1ope livi (fartaxmpoo1tee iociysfs ul( o (4arxnxfcto1lmt liei s  eumimpoy1alte ncil(fa2um(r ou0ape moctytfs em(mp (4 lenif ty1lat aivils) etr(m3no4opt mici tfs2um( oot4opxnifctad sDrln p (0 renxfctytlpDean o t t2uoxo ny1lmte ivslt  2tm(mpnu4texoiiciasla el( s u4altrxoctydoa r ivi;t texoir3nu1lmee ncs ()srua(rp;o0tlxomicils mDrlu s;u4arxnif3iodomtrli ols  rxrxr ny4amenlneiat) rrrxmont0oet  fctatls2uan s;(0tltrxr3oadoptrai i s  rxmir3oudap elfvs s)aDuax pnt4olxoif3iydla2uan o;t0 rtrxrciatopD aivol(  2xo(rpny4lltemfvta( sDtaxrono1tlxo ietlsls2umuvonu0aleoxf tydop e uvil(0 rxmxm3oy4op e fvias  2raumooo4tlt mf3iatlm ulnvo t)teeoifciodlmDelnei;(0teurim3iy4aleelivt ()s2rrum nt4teenii3ilsfmDemumonu) rxnifciadom eaueo;( setrxm oydlpt  ivsat) Dtr(mo;u1aexomi3iasls eln s;u0tetnirctatlpt luvs t0 2tmxm io1amt liet (farrmu oot0alt  oeiadla2rluvpn(4tlxomrcoo1lm rlneo (0s2toxrpoodlpeemnvtltf 2trur nt4olt mietat sDeauvon(0 exrio iatfptrlnvi;( teumxrpno1op elicslt sruaxmo;t0apxn f3iytfs2em( s t)trtoir3to1laD anei;t s2trir oo4llen fvs t)sDrmum ot1openifeiasfa um( o;(0tetnxf3ootopDrlivol() euoxopnu1oltn ncs ()sDurur ;o0tltn ieils mDuln pn(4tltoif tatfmD aueo;(0setmxm oydamte fvs t  Dtrurp;t4aet iicild mDelnvs;()texnmocoo1opt livi;( s2trirpno1apt  nvs tf 2umuro;u0oex ii3tytfaDean p t)teerxf ia1fpDraiesl()t2xo(mpiudolen fvsls)aDtrxmp;t1aexn oeiasfm eau ont)aexnxo3iydlptr i olt)srxo(mpio4llenlfvi t) 2rrx p;u0opxomociasfs elnms;u4 lxoxo3oo1fm   i il()s2umiopoy4ome lnvtl()a2um(mpoo0alxomoetldlm2rlumsnt) exrifctytopDrlues;t  2xriopnydameemivi sfs2tmu  nt1tpeoiociasla emnvs;u4teeomr ootom r ivi ()srxrxo3io4apt lfeilt)a2um(r nu1altoiiciatlaDrlu p u4tltrifcty1fp  lnei t seurio nu4lmtnmfvsatf Dumumo;t1alto ietad m2rmn p;u0trermf3oo1la ran i;s0trxrxo oodam e iet ()a2ur( poo4aee io3iltfm2rl(mpnt)tetnmf3ootfa rau slt)sexoimpiy4lptelnet () rrmx p;t1apxnii3iys a2rm( on()alxrmr oodlpDelivo ()s2xo(m no1lp   nviltfa2tau  ;o1tltnmoeiydfa elu s;u) ltrmf3oadlateai i t) 2xmxrpnudalenmnesas) rurxmp;u4optomieild m rl( sn(4aexrio3ta1fpt ai ol(0trxo(m iy4lp  mivt ()a2tmu ono0olxnioetas m umnvs;(0 eenxfcoo1fptelnvi ( setrxo nudopeelici () 2ra(mp;u4oeto fciltlm umnvsn(0tetrif3iy1omte ivols)srtr(mpno1ape  ieias  rtaumpno4tpx ifeils sDrmump t0alxoxocia1fm   u sl(0sexrir ou1alenlfes (  Dua(m oo0oltoio3ild a2um(monu4arxomr3to1fm elnes;s  rtrxm oo1lpt licsas  rtaxronu4altnmociydlm2emnmo;(4tetrmo ia1laDeaivo s s2xrirpoy1om e nct s aDum(moot4aetomfeilt m2elnvo;u0 ltoif3iatlaDean i;( teumio3nu1apt  ietl(f Dur(mp;u0opxomfeiatlm uan o;(0aetnir oy1oate n ol(  etoirpoo4lmenlivsl()srua(rpno4alxnmi3tasfs2um( p u4alerircootlaD livi t0trxoio3iudaleelfeil()a2um(ro;u1oex  o3ils m2uanvo u)teenif to1fmt anvi (0 exoir3nydap nmivtl(  Dtm(mpou1oexomfeild aDuau o;u)tlxrxo tadlmDraues s teuo(m io4amtelfvsls artaumpou4opt ifetlt m2eaums t0aetrmf ty1lmDranvs t  eumxm3ny4ome  ivtls  2umxronu4apxoifctld m ua( snu)aexrmfciydlat auvi s)t2trxopou4lmenlicsatfa2uaxm oo4oltoioeiysla2ua(vpn()altnifcio1omte n i t) 2umxm oydal n nesatf rrrxro;t4tpx  fcildfa2ua( o t0tlenio3oydfm rlu o;s  rxmxmpoy1lp emfcta(fsrumx  nt4tetniociytfm uluvp u)texrxfciydlat  u o s  2xo(mpou1al elfcs sf Drm( ono1oltnmicilsls emu onu4texnircta1la  li sl()sexrio iu4am emivtlt srtr( oou4tee mociytlsDrmn o (0aeeoxfciodfptr ueols) rtmxm3iudalt livsltfa2rm(root0aet  o3tytls ran onu) leniocoo1omD  n i;s) rtmimpnu1ol nlnci (f ruaxmpoo1ope ifciatfs2emumonu0trenxr ta1fm rlnvi;s0 euoxmpio1amtnmivs s) 2rmumoot0tlx  o3iysfs rmnmp ()alenxr to1oa rli ols0trur(r iudoptelneils)arum(rpoo0tle ifeilsfaDemu ont0 rerxrcoa1faDelivi;s setmxo3ou4omt mictat a2rmxrp;u0teenmictysfm rm( p;t4aeermo3totfpDrln i s0t2to(mpoy4lp n ies s) Dur( onu4texn fetys m em(mpnu4 ltomf oa1lmte nei t0texo(m iydomt lnvi sfsrururpno4apeomi3ilslsDeauvp u0 renif3iodfaD  u o;(0 eto(rpiu1olt lncs t arrmuronu0tpt iiciysfmDrluvs t) rxomfciytlmDean o;(  rtr(o no4llte neta(f rtr(  ;o0opxniicild aDul(vp;u)texnxr iy1lpD  u o;s trtoio iu1ole micsatfsrur( pnt1oetoiiciadfm uanvpnu0alerxfciotfaD  i olt)s2xr(o io1ape lfcia(f rurxronu1alenifeilsfs elnvs u4texrmocoytfp   n i t)teumim nodomeelicil( srurum ;u0oex  f3tlsfa ra(vs t0aeeomo3tydlpt au i;s s2tmiopio1oltemfctas)s2umxmpnu0aee micils s2em( o;(4 rermfctotop  ln il(  2uo(r nu1lpenlnci t  2ur(r ;o1opxn fctad m rlnvs;t4artoif3oytlaD au i;s0s2xoxo3nodameeliesasf Dumx  ;o1olenmoctydlm ea( o;u)texrmr iy1oat anvi s)sexoimpiudopt lnvta(fsrur(  ;o1tpe moeils sDea( pnu)aexoif3to1fpte uvi;(0 exmio nu1omeelnvsa( srum(mono4aeen oeiyd s rlnvs;(0texnif3iy1omDr i slt  rum(m3iodop   ivslt s2tm( pou0oeenmf3iaslaDelnms (0tlenio3todfmDe nvs t) ruo(r iodolt lfvia(fartaurpoo4aetnmictat a em(vp;()trerxrciydfmDe neo t s2urxr nu4ole lnvils s2tm(r nu4aeto icilt m eanvp t) renif tydlp   nei;( truriopou1op e fcsl()srurump;u1tpeniietlsls em( p;t0aexrif3oydfpD luvs s) eumxo iodoptemnet t) Draum oo4aexomieild mDul(vpnu)tlxrmo3ty1fpDeluvolt trxmir3no4ll  lfci t sDumurooo4tpxnmfcildfm2rmump;t)artnmr iytlaDelnvs;(  rxmir ou4apeelictls)s2umump;o0olt ii3iydlm uaump;u4tlenifciy1opDrluesl(0s2umxr nodam  mfcils s2rm(rp;u1tetniietadfm em(mo (0tetoio oa1fmD aieslt0sexmxrpoydope  fctasfsDtm(root4tleomfciaslaDrlu p;u0alxoxocoytfa rlivil() 2to(opio1lp nmivs () 2trumpnt1olxnmi3iltfsDelnmo;t4 lerxrcta1op rliei t s2triopno4ap  mnci t)sruaump;t0teto ocils m ranms;u) reoir iydfmDr i s;s0s2trimpou4lmt miciat)a2uaxroot4texnmo3iadfm2ea(vo;u0 rtnmrcoy1om elueo (0sexrir3iy4ope mfvsl( a2rrur nu1alxnmiciadfa2elums;t0 exoxf3tydlm elneo t)seuo(r oydoltnlfetls) 2rmumo;u0aee mi3ildlm2ran on(0tlxomf iy1lmDrlnvils) rum(opiydllte fctl()arrm(mo;u4altoii3iyt mDel(mp;t) lxrmf oytlatelneols0 etr(r no4aptelictlt)sDur( pnu4olxnifciasla2rm( s () rxrxr oo1omt anvo;t)sruo(m oydole lneta(  Dta( o;o0tetoioeiysla2ulu pn(0texoxo3tadoa   uei t s2xo(mpno4alen fei ( arrm(mp;o0aptnii3iltfmDrmums u0texoif oydlatelneolt0trxrxopou1lmtnmnei ( srtrx oot4olt ii3tatfmDemnmp;t0trtriocoatomtr ieo ()s2urio3oydomtelnes tfaDtmu pnt0opt  ictld s2uanmo;()alxoxociadla raueolt)t2tm(r3nu1apee fvtasfaDrr(mpou4tlx iociytfa2elnvs () etomo oa1fmt  ivo;s) exm(m oy4ll  mieilt) rrrurooo0texn f3ils a2em(mp;t) lxnmr3io1oa elieilt t2xr(mpnudaltn fes t)srra(r oo4aleomoeiadfs rmnvp;t4tlxrmr3ootoptelues s) rxr(m nodom nmivtlsfs2tr(rp;u0aexo fcilt a emump u0tleoxo3iodfpteanes t) 2urxr iy1apt lnetat) Dtr(r nt1ope  f3iytfaDum( o;u0aeenmr oa1fatelnes;(0teur(m3nodlltelfctl()srtmumonu0ape ioetadla2emnmsnu)aleoio3todfp ranei;s) exm(opnydop nmnci (faDrr(rp;t1opxnifctydls uauvon()alenif oo1lpteaiei;(0 2urxo iudop emnetl(  rurxmooo0tptomfetlt mDea(mo t4aeenxo to1fmte uvi ()t2umir nodap n nvil( s2rr(mpou4oet mictad sDrl(ms;u4 ltrmr3oodoptr ueols s2tm(o3iy1ap emfvtls)a2ta(ro;t1alt  i3iytfs ulumsnt4aetnir iatlpDrlnvol()trum(m oudol elietatfs2ta(r nt1tet  ociatfs2em( o;(4trtrircoy1omDraivi t) exrxmpnodlp n netat) rrrurpnu1oleoioeiad m umumo;(4 ltnifcto1fmtrauei;s)teurxm3io1alee ivsat) 2rm(m no0oet iieiydlsDra(monu0 lxnxf oydfpDeln s (0 eurir ou4openlici ()aDumxmo;o0oleoifciatfa2umu s u) rtoxocoytfa r uvsl( t2tm(r nu1alenmict t) rrmx pot1ole iocild mDra(mo;u)alxnir3ia1lmDr uesl( trto(r oudlmt lfetlt)aDtrumonu0tlx  fciys a rl(vs;u4 ltomocoadfat ai ils t2uoxo3oy4olenmivs ( s2uaxrpno4apxoiiciyslmDeln p;u)aetrmrcta1fmD lnvs;t) 2to(r oo4am  mfvsatfa2uaxrpot4olt micilsfsDumums;u4 eerif tatopt  ivs t s2xmxm3ny1ome  icilt arta(r nu0oltniiciadfs2umnmont)trxrxf ootomD  nvsls) ruo(m nu1aleelncsat)s2ra(moot1ope ifciys m2elnvp (4aleoxf iy1lmteaivi;t t2xr(o3io1lm nlfesatf 2rau o;o1opxnmieiasfa2umuvpnt)artrxfcootfm  aivo;t)texo(r nydom nmfvias  2um(  oo4aeeo oetysfa ra(mo t0trtrif oodomt  iesl() etoirpoodaptemfvs ()s2rr( ono4oetn o3iaslm elu pnu)arenxo3iydom e nvo t0 rxmxmpno4al nmfvtl(f Duaxro;u0opxoio3tldfa2umumo;(0treomo3tadfmDr neols) exoir oydamee fvs ()arrr(m nt1aptomf3iytla ua( o (0tleoxf3iy1fmtrlies;s) ruoxopnodap elivslsf rrr(rpou4altnmfciat aDrmnvsnt4teermr3iatoaD ln ils0tetm(m3oy4alte feil( s2raxmo;o0tet iociytla el(mpnu0arxnio3oa1fptrai i s) 2tm(o3iudlptnmnvt () rtru  ;o0tpxnmi3iadlm2rmnmp;u4texrxr3ta1fmDeaieolt0s2to(r ny4openlnvsasfsrrr(m oo4tee mocils a uanvo;u0aexomr3tatoaDean s;s0s2ur(m3iodllenlietat)arurxmono0opxo ieiadlmDeluvpnu4texrmfcoy1omtr ieil(0 exmimpoy1llenmfvil( srua( ooo4aet mfetltls eanms;t4 eeoxf3io1omDrlnei;s)trxoir3nu4llee nct tf rtrxrp;o4ale  feiydfm2ranmpnu4artnmociy1fpDe nvs s)t2to(m3nudomt lnetat)srrmur ou0tlxo fetasfa2emnvs u0 lenir tatoa   u s;t)s2uo(r iu1optn fei tfsrrr(ro;u4tlt mfcias a eau pnu0arxoircta1oa  lueo;s  2tr(o io1apt livtl( aDraxr ;o0tleoiocias sDra( s;t0tltoxfcoydlmDeaueo s)tetoxm nodom nlfvil(fsDum(m ;u0teeomictldfs2rlumsn()texrir iy1fp e uvi;(0t2tmxopnodap n fcsasfsrur( ont1alto i3ilslmDrauvp () rtnir tatlaD lieolt srxr(o3iudolt lnet ()a2uru oot1oexnmo3ildfaDeaumo;u)tetrxocta1omDelivol( trurim iu1opt  ivil(f 2rm(mo;t0altnmo3tltlsDrlnvont0 lxniocta1faDr ivils0trxoxo io1ap  lnvslsf rumurp;t1oee ioctldls umnmo;t0arermrciotop rlueilt0 2xmxo3no1opte fei s) 2tm( pnu0tptnmoeiltfm uauvsnt)aetrmf3oo1lmt lneo;t) 2umio io4amenmnvtas aDur(ro;t1teto octyd s emuvs;t0alxrif iytlmt auvo;( texo(mpnu4ape  ivtl()a2rr(mono0opxo fetydla rl(vo;u)teeoir tadlpDrlu o;( srurxopnydlpeemivi s  rtmxr nu1tlxomictltlmDelu s u4 eeomfcoydlpte ivo t srtmxr iudoptn nvsatf 2ur(r no4apeomfeiat s rm(vo t4texomo oo1op elnes;t t2trimpiu4lltnlncsltf Drm(mp;o0tpto fcild s uan o (0trxoirciytlmtrluvo;s0 2xrxo3nu4llen ics tfa2rau  nu1teen octyslm2uauvonu4 exrircto1oaDeauvs s)trxr(o3nydal nlivsasfartrum nu4tex ioetasfaDuauvs (4areomr3iy1latrauei;( texr(mpiodole mnvia(f Dur(mono1oetomi3iat sDeauvsnu0 rxnmo3tatfm r iei;t0texoxo3nodol nmnvt ( a2um(m ;o0aee io3tytfs2ulumpn(0 rtnxf3iotlp e u ols)s2ur(o3no1altemnes t artmuroot1ale ii3iltlm2ra(vonu0arxnxfciadop  li s s  2tm(o3nu4olte nvta(fa2taxr ot4apx mieiad s2emums;t)alenir oa1oaDrauvi;()trxoxo3io4am nlnvils)a2um(mo;t0apxomf3iydfsDra( snu4aexnxocoadfp   i o s)srumio3iy4ome  neilt aDrr( poo1oeeoiociys a el(vp;t4tlerxf iadoat lneol(  2xoio3oudam  lnesl(farurxr no0aet  oeilt mDua(mpnu0teeoif todlmtr nvolt0trtoirpny4omee ivil(f rurx o;o1tlxo oeiltfm ulnms;u0 etoxo3ootlat anvi;t teuoxm iy4olt mncs tfa2uaumpou0tlenif3iatls2eln sn(0 etomociydfaD  n o;t)trurim3oydll nmfes t)a2uaumono4tpe ii3iaslsDuanmp (0tlxoir tatlm rlneslt  2umir3ny1ap n nviatfsDurx o;t0tpxoio3iadfmDeaumo ()arxrifcoodfa rai sl(0 rur(o3iydome  nctl() rrau pou1opto o3tys a2uanmo t)trxoxo ootlaDeln s;t) 2um(opnodolt mivta(f Dumxroot0teenmociydfs ulnvo;t0 reoxf to1fm rluesl()teur(m oo1lp  lfeiltfaDrm(r no1apeomo3iytfm raump;u0treomf3iatoaDelnvo;()srxrxr3ou1om  liet () rra(rpno1optn f3iltfs rmn o t0 rtnir tatopDeaneo s)t2um(m3iy1omtn icsasfaDtaxmo;u0tlxoiieiydla2rm(vs;(4 lermr3io1lpDrlieo (  etoxo3oo4apen ivtat)a2rr(  ot0olxnmi3tasla2ua( on()artnir iydfp rlivo (  etrimpoy4omenlncslt)sDrm(m nt0altnmociadlm uanvonu) rxoxo iy1laD li i;() rxrio3oydll  lictlsfsDrrxr ot0apenmfctad s eanvo;t0texnio ia1lmD  uvo;s)srxmim oo1oltemivsltfaDta(m ot0oleomictldfaDuanvsnt0tetnmfciotlmDe ues;(0 2uoim3oodolenmfvs sfa2ur(mpno0texnmoetatfmDra(vs;(0 lenifctodop eli i ()t2toxo io4lp   iviatfsrurx o;u1oee iictatlm2umuvon(0texrmo iadfmDeauvi;t)t2xrxo nydolt lfcs ( srrmxmpno1tle moctyd a2eau snt)alxnmoctodomt lueo s s2umim3ou1altemnetltfa2uru  ;u4altnmo3iysfm2ua(vp;t4aexomf3iadlmt  ueilt)trxmxo3iy1lm e feia()aDtr(mo;o0tpenmoeiysla2elums (4 eenmr3oa1fp rlivi t0s2uoxr nu4lpt mfcias s2tmxr ;u4oltoif3tyt m ulumont4aetnxo3todlm  auvs;t0s2xr(m nudlmenlnvtl(fs2ua(r ;t1oexnmo3tytlmDemnmo u)aetnmfcio1oa eln i (0t2to(o ou1amtelfvta( sDur( ont4oeeomoeiytfm2em(vpnt)alxnir3tadlm eauvi t s2toio iu4lpeemfvi t aDum(monu1oltnmfctyd s emums u4 rxrxfctodlm r ies s trxrxo nodameelfetat  Dur(m nt0oeenmieild s2elu p (4 eenxf3tadlaDrluvils0seurxo3io4amtelfvsls) rra(rpou4apt  f3iasfa ua(vpnu4aetnio3oadoatraueo t0t2xmxo iu4op elfct s  Dtmurp;o0ole  ietlt aDumn snu) eenmr3ootlaDe ueilt0 exm(rpoo1aptnlfvt (f rtm(ronu1tptoioctltfa2raumo ()trxrxr iytopD lnvi t teuoxr3nydlpeemfeils a2urx p;o0teenmicilt m eln p;u)trenmo3ty1lpt ln sls t2tr(opou1op nlfctltf 2rauro;u0aexnmfciat sDuan p;u) lenio oo1lptr n i ( s2to(o io1lpen neils sDtrx ono4tpenifciytlm2ran pn(4aetrif3tatfat anesls teur(o3no4ole  ies ( sDra(root1opx moctat s2rln p;t0tetnxf3iadlm e nei;s0seurir oodape  ncsat) 2ta( ont4aexn octltfa2ranvp;()arermfcty1faDeanes t) rtmxr3ny1am  mfvs s)sDtaxrpnt1alx miciatls2ra(mp;t0tlenxo3oadop e iei t s2xmimpny1ll   iciatfaDur(rpou4aet  fetatfm2rlnvsnt0tetnio oa1lm   ieo s t2xrxo3oudom e nvs (fsDrmu o;t0ale  feiyt s2emn snu)aetrmf oydopt  i olt  ruoio3iy1lptnlicilt s2rr(  no1teen o3iysfm2um(vont4texnif totfpt luvslt0 rto(o3ou4opt lfvia() Duaump;t1tet iicias mDrmn p () rtomfctodomtr uvols0seur(o iu1opt  nvt t artaur ot1oeenifcild mDuluvo ()arxrifcoadom e u olt)srxmxr ou4ll nlfet t srurxr nt1tpx mocildlsDemn snu4aetrio todfa  aneo t0srurio3iu1lm nmneilsf Drm( o;u1alto fetlt aDua( s ()alerir ty1lp eai ol(0srtoxo no1amen nvil(fs2rau pnt0ole  fetltlm2rl(mp;u)teerxr oo1op rlnei t0s2xoxmpoy4amtn fcia() rtmumpnt4oetnmfciytfmDel(vo;(0aexrio tydlmDr u i;s0 2tmimpnudllte iesls)aDta(rpno1tptn feiatfs2ra( o;u) etomociytfa raivi t0seumxr iu4ap  miesltfsrraurpno1texnii3ias m2rlnvs;u4tetnxociy1fmteluvilt0 exmio3oy1am  lnvt s) rumuro;t1aeenmoeiltls2umn s;(0alerxo oy1fmDeanvi;t  euo(opoudole  feslt) 2tax ooo1tex  f3tadfm2rlumonu4texnir3tytfpD lneolt0tetrimpnu1olt mfcil(  Dur(  nu1tet  ociadlaDuau p (0arxrif3oydom r ivi t t2xm(opiy1ome  ivtlsfsrrm(m nu4tet  fcilslm ulnmo;t)aetnxrciy1omtrlivo;s s2ur(o oydal emfeslt a2tmum ;o1opxnifeilsfa umumont)tetnxf oodfpteanesls0 rtm(mpiudoptemnesltfs2trx oou1olto ieildfs2emnvpnu)alermrcto1laD auvo t)sexm(o3iu4amtelfet ( aDtax pnu1tlenmfeiytlaDuaumsnt0trxrmr3oa1oaDe uvsls s2uo(m no1lltnmnci s sDumuro;o1oltomoctyd mDel(vo;()aeeoxo3tytfmtrlies s s2umir oy1llte ivt s s2rax oot0tpto ictad aDemu o;(0trtomr3oytfaDe nvo t)trumiopny1om  lfciat)s2uauro;u1oee  oeilsfmDrlnms;u4 rxrmo3tydlateln s;t0teum(mpoo1lpt lfetas  rum(mo;u4ope mf3iltfm2uln p t4teenmfciy1fmDelnvs;t0 rxmxm3oydomtelfei s)sDrau  ;t0aet  ietatls2em(vo (0aexnmo tytopD an slt0 exoimpiy4opt  ivt ( srum(m nu0alt  iciat sDem(mo;u4teenioctadopDe nvo t) 2uo(m3ou4olt  netatfsrtmxr ;t4alx ifctasfm rauvp;u4 lermrcoatfptrauei;s) 2umimpiodop   fctlt aDrmxmont4aee iiciad s umu o;u) etnxf3oatomte i s t)teum(m3ou4llt liei s) 2urxr oo4optoio3ils s rmums (0alxnifcia1fateau o;t0tetoir3oy4lmte ieta()a2rm(m oo1apenmociatlsDeluvo u4 exrxocto1la e i sl(0texrirpio1lmenlfvtls)aDra(rpnt4oee  octytfsDel(ms (0tlerxo iotfmt au sl(0sruoxm3nu4aptelnvil(f 2trump;o0texoiociyt a ulu s u4trtoifcoydlpDelnvo;(0trxr(m3oo1lm elnci (faDuau oou0teeo feiadfmDrmnvs u0 renio oodlpDeaiei s)s2urxo nodolee fet t artaxr nu1ope mociasfa2rlnmpnt4 exnmr3totom  au s t  rtmio3oodap elnvt s) Dtm(root4tetnmfeiytfs2em(mp;(4 ltrmf iatlmDr i s;t)tetrxopoo1optelfeil( srtr(ronu0aptn o3iasla2elnmpnt) exrmfcoadlm   neo;(  2uoirpiy1lmtnlfvt ()s2tm(rp;u0aetoiictld aDrm(ms u)aleoxr3iodlp raieilt0 etoxr oy4ope  fctas)sDurxm ou4opto oeiatlaDumumo t)trtoxrciodlp  auvs;(  rxrim3no1alen feiat srumuro;u1alt iietydls rmuvs ()artomf ia1laDelnvs t0srum(opnydopeemncta(fsrtaxr no1oleoif3ild a2umn s;(0artoif3oy1opDe ueils)srtrxm3iudolee ics tfs2uaumono0oexnmoeilslm ea( ont0alxnir tatlm rlnvi s0teum(mpou1lle lfvta(  rraxront0alenmietytfmDemn p;t)aeenxo3oa1late n s;(  2trxm iydoleelnes t)aDta( o;t4teto fetasfm2umn o;t0aexoir3ta1oate uvslt0srurxr3ou4lpte icil(  2urxm ot1olxniieilt s2ulump () rxoif3totlm rau i t)trum(o3io4omtnlfvt ()srrr(m ot0tpt  ietas m rl(mo;(0 reomrciy1oaDranvi ()t2xmirpiudap n nctls sDrrum nt1aeeo fciadfsDrm(mp;u) eerif3oadfmD anes;s) ruoiopoudlmen ici t  Dra(m ;t1aleoio3tat m elu s;t0trtnmrcio1lat auvsl(  eum(o3ny4lpen net ( a2ua( ont0tlt  oeiytls rl( p;u0tltnmf3iytlm e i ols)s2tm(r iu1om nlfvsatfartrx  ;u4teeo oeiasfmDemn p (0tlenxr3totomD  i i;()texo(r3nu1lmtelivi ( srrm( ooo1aex  o3iasls eauvo t)arermr3iodop  lnesl()s2urir3io1altelfctlt aDum(  oo1oeto f3iytfmDrm(von(0 renxo3ia1fm rlieo;(0trum(mpnudlpeemncs tfsDrr(mp;o4tptnii3iadfm ulu p ()tleoif todop  ai il(0t2trxmpio4ol nmfctlt)a2tru  ;t0tpenifeiat m2rmnvs;(0texoif3tatla r u i ( trurxm3io4olenmnct sfaDta(mpnt1tex io3tydfm2elu s ()aetrmrciodfm r i s;() 2umxopoo1ome  icslt)s2rmumpnt4oetnmfciasfaDel(mp;(0trxnxf3to1latelueo t0srtoiopiodaltemnctas s2raxmpoo1ope mf3tls mDuaumsnu0 rtrmo3tydopteln o t)texoxm no4oltnmfes ( sDrmx ono1olxomieiatfmDra(vo;t0tetoxr3oatoptr n o t)trum(r nu1al   fesa()srurum ;t4apxo ictlt aDuluvs;t)aetoiociotfa rli i t0trtrxo oodop nlfeiat)sDtmxr ;u4oex io3tadla2ra(vo t4alxrir tydlpDrli o;t0seuoim nu4lm nmfvsl( sDua(  no1oet  iciydfm2emu onu0 exrxfciadfm rli s s) 2toxopoo1amenliesl() 2uaxmo;t1texnif3tlsfaDranvs t0aetnxr3oadomDeluvo;t)sexmxo nudll   fvslsfarum(mpot1ope mfeiadls uaump t0arxrmr3ia1lptrlnvs;(  etoxopio1lp e iviasfaDur(moou1oetnmicils s2elnmp;()areoxf3iytfmDrluvil()t2xrio iy1op elfet (fs2tmumont0aleniietadfs2ra(vo;(0texnmrciotomDran olt0 rxoir3iudop n nvs tfs2ua(roou0tpenmociytls umumpnt) rxnif oadfp  luvo;t) rtoxmpoy4omt mfviat s2taxm ;t0opxn feiyslmDuaumo;t) etrmfcoadla eli s t seurxrpiydlltnlncsas) 2ta(m ;u4aet miciadfa2elnms (4aexrio oy1opte ieo ( sexoio3no1omee fvsat)s2rr(mp;t4altomfciydlmDra( ont0tetnxfciodopDeauei s0 rurxr3oo4alte ivtls)aDtm(mono0opx mfeiytfa2umums;u)trxrmf3to1lmtraueol(0t2tmimpoy4open nvi (f rurumono0oexoioeiaslaDemn o;t) lxrxo totfp rai s;t0tetrxr oudol  lneta()a2tmu  ou0tle ifeiatlsDulump (4 rxoif iatoa   neo;s  2tr(rpio4llt  nei (farrrum oo0texomicias s2rmuvs () ltnir3totlm raies;s0seumxo3nodop emneslt)srrmx pou1optnmfeiyt aDumn pnt4aetniocoodfm e n o t0sruoxr oy1lpeelneslt  rur(moot4olx  fciat s rlu o;u)alxnxf ty1faD aivs s0seum(o oudam nlfctas)a2uau  oo0tpx mocilt sDel( snt)trenxrcoytlpDrln o;s0sruoir oy4op e ivia( srtm(rp;t4openmi3iyd aDumnmp () lxomo3todlm r i s s) ruoxr3ou1lpeelieilsfsruax  ;u1opxo ociatfa eauvo;u)trerif3iytfa  luvols  etoxm3oy1lptnmnciltfsDrr(m ;u4tpen octld s ran o u0aeenmf3tydom e i sl(0srxmxr oy1apen ncias)sDtaurpnt0alt mfeiat m umnvs;t)alerircootfa  ln s t0setmimpiydalenlfetlt s2tmxmpoo1opx mietld s rau o (0 etnif oy1opteaivs ()s2xrir3io1lp n fci s srrm(  oo0olx ifctltfa2umuvs;()alxoio tytfm  aneslt)trumir3ny4lme livsltfs2taurpot4tpeniictydlaDrmu pnu) rtnxr3iadfp   uvs;t0 etoxr3iy1opt lfeilsfaDraum ;o4oee  feiltlsDran o;u0tltoif3oydlm rluei t) exmir nu1lmtn nci s aDrmumo;o4oee  iciydfmDemnmsnu0 rtoifciodlpteanvo (  2xo(o3oo1ol n nvi t) 2uaxr no4tlxo fcilslm rmuvs (0 eenirciodfmtr ivi s trxoimpoudop elnvsl( a2tmu oou1alto fetld mDua(vo;t0texoxo to1om r ivs;s0 euoxm iu4ope  ict s arra(m oo4apxnmoetlsfmDumnvo (0 ltrxf iy1fmDeaueo;(0trtrio oo1aptemicta( sDraumpno1teeoiieiysls2umuvonu4tlxrxo3ootlat  ivo;t  euo(rpnu1ap emies (f 2uax pot0alxomiciasfa2rmnmp (4tetoifcoydfm eaueo ()t2urxopno4olt mfvtltf rta(rp;o1ale mieiyd aDrl(vo () exnxr oa1lmtelies;s sexrirpiodlmt lici s sruax  nt1tpenmicild mDrlu o;(0alenir oodoa rlneslt trtoimpnu1am nmfvtat  rum(ro;t1oexn feilsfs2eluvpnt4aeermo ta1lpD ln sls  rum(rpoo1lme mnctatfarua(rp;t4texnmoetydls2elumo;t4 rtnxfctotfmDeaivilt0 2uoxopoy4apt  ieias a2tmxr ;t0texn ociadlm em( snu0 etrxr io1fmt aieo t sexm(r oy4apee iei tf Dtrxmpno0oleoiocils a umnmonu4treomf3io1laDe nes s0srxmxr oy4lp  mnvs s) rumuro;o1ale  i3tydlm2rlu snu4 rxoif totlpt aies s0t2umio io1lptnlfciatfsrur(root4aet mociyt sDra( p;(0tltrircoo1fp ranvo;t) eumim3oo1aptnlnei tfs2uaxro;o4tpto feiasls rmu o u) exrmf3io1op   n o s truoir3io4lp n ncil( a2rrx ont1tet  ieilt mDeanvs u4treoxoctodlmtelieol(0trxo(m oudamee fes t) 2um(mono0alxomieiadfs2emnvo (4trtrxf oodfmtrau i;s trxr(rpnu1lmee nvsls) rua(roou4tptomo3ilslsDua( o;(4teermfciodopDrlieilt)texrxo iu1lptn nesl(f Drrxrpot1tpe iictlsfm elnmsnu0aetrir todlaDeai o t)t2um(opiy4apt  nvtasfartaxr ;o4aexnmi3taslm um( p;(0tetrir io1opD  ivo;s trumio3nu4opt mfvt () Draxmpoo1oltoioeildla2rlu s u4altrxr3tytlp   uvs () 2xmim3no1oltn fvs () Dtmuront1tetnifeiasla2elnvs (4 rxoir3iadoa ranvs s0teum(mpoy4omeemivtas s2urxrpou4tleoifciyd aDua(von(0treomf3tydomtr uvol(0s2um(opoodomt mnes s)artmuront4apt mfetasfmDrl(ms u4 exnmf3iotopDrlieolt teuriopiu4lm nmivta( aDrm(  nu4tpeniociasfm2ra(vpnt4teeoxf3iodomtraieo ()teumim oo1lp e netas sDtmxmp;o1ale moctas a2em(vpnu)arxnif3iatop ranei (0trxr(opoudll  licia(  2urx  nt4tetnmo3ilsls2emnvpnt0alenmf3oydopD livi;s)tetoxmpoudolt  nesls)a2raxm ou1aeeoif3tld s rmn o;(4aleoxocoatopteaieil( sruoir iodale lnesl(farur(rpno1ape  octlt s rmu pnt) etoxr oytlm r ues s)t2tmxrpno4aleelnvsltf 2rrxmp;o0opx  f3tadla2emump;t4altomrctydlptr nvi t)t2uoiopny1opt mnvta(  2rr(mp;t1tleoifeiyt a2elnmsn()arenif iodlmtr nes t srto(opiudlptelnvtltfaDurx  ;o0oexomoctad a2emnmo (0 rerif oatfm ranes;s  2toxmpou1apenlfei s) 2uau onu4oltn feild aDuau s;(0 etrmo oatfpt  i olt  2trimpiy1apenmnci tfaruru poo4oleo ieiys m rlu pn(0trxoxr iodfmDean i;()seumxo3ou4lmee ictl( aDtru  ;u1tpt mfetas a umu p () eenxf oadfa   ies;t sexm(r oy1lm e neslsf rua(rp;t4aex mo3ildfaDrlnvo (0trenmrciodoateli slt) ruo(r3no1alte nviat) 2ua(  ;o4tlx  fciltlm uau s;(0 renmocoatlpt auvols  eurio3nudom e nvtl(f Drmu  ;t4aee  o3ilt m2rmnvsn(4alxrmrcoa1fm eanvs t trxmim io1ol n fvslt) ruaxrono0optomi3tadfmDua(vp u4altnio tydoaDelieilt setoxm3oy1ap  livt t) rtax  nt1optnmf3iadfm2ra(ms t0 exrxo iydfp eluvils)t2xr(opoydlltn ici s  Dtax o;o0alt  ociyt mDrl(vonu)altrio tydomDelieols t2to(rpiudlp nmiesat)srtrx  ou4tle if3iytlm2emumont0tlenxf3tadlpDrlnesls  rtm(o iu1aptnmicsls  Dtrur ;o0altoio3tls sDrmuvp;t)altnmociotfat  iei t0sexm(o oudol   nvt s) Dtrum ;t4tpenii3tasls elnvs t4aetrir3tatfm  au ils0t2uo(o nodlmt  nesat sDurxr ;t4aexnifetasfm emnvs u4 rxomo3ty1lptr nvo t)seum(o3iydope mfeiltfaDtmumpnu1ole mi3iyd aDuauvonu)tetrmr tadoatrli s t srurir oo1lle lnesat)s2taumoot1tltn feiatfa uanms t4 lxoxoctotlaDr nes t)s2ur(r3iydomeemncilsfsDraxm oo4tlxnmfciad a elnvonu0trxnircty1oa r u o t  2xrir no4ome licilt  2um(rpnu0tpenmoeiysfa ul(vp;u4areoxf iatoa elueil( srumio nu4altnmivtls aruaumooo4oexniicias mDem(vp u0 exrif to1opD lues ( trurxo3iu1lmen ieiatfsrua(mpoo1tlxn o3iad mDeanmp;u)aeerxfctatfmDraneilt)tetm(rpoo4ol   iet ()s2ua(mp;u4oee  oeiadlm emnvo ()teeomfciodfaDelu s t  rxmxrpny1omenmicsat) rrrx pou0olx mocildla2elnms;()arerxociodfm raieo;(0 ruoir3ny1apee fcias  Draxm nt0aptoio3tas a um(vsn() leoiocoadfm rauvols0 2xrxm nu1aleelfet t)sDuaumooo1olenmietadls2ranvp;u)artrmf iydlmD luei s tetoir ou1omee ivi (f 2rr(mo;u4aeto fcildlaDem( snt4alxnmf3iytlmDrluvsl(0tetmxopou1omeelnvs ()a2umu ooo0aetnif3iysfm2ul( p;u)alxrmf3ootlp   nvsl(0 eur(r3ny1olt lici (f rtmu pnu0alxn i3iyt m2el(mo u4aleomf todoat livols teumiopiu1omt lfeiasfa2ururpot1oeto o3iasfs eanmp t)aetrmr oatfptelivsl()s2xrio3ou4omtemivs t srra(  no1tlxnii3iad mDrmuvo u4artoxf3oa1lmtr uvo (0s2umxo3iydam e icsasfsDtau ont0aexnioeiytlm um( ont4tetrmfciotoa  ln i;t0t2xr(o3nu4optn nvtat srtm(mo;u1tpt iiciat a elnmp;t0aexrxrctodfmt aivsls0 rtmim3iydll  lnei s  ruaurpno0tle  ictlt sDea(mpn(0 rxoxo iotfmt lieo;(  rxo(o iu1oltn ncs sfaDuaump;u1apxnifeiydls2ua(mpnu0tetoxrctotoaD  neolt)trum(rpnu1al n feta()aDrmxmp;u4tlenifcils aDumn s (0 eeomocty1lm  ln i () 2xmxm3no1apt mfcs sfa2rmur ot0apeo iciyd a2rluvs;t0artoxr iytoa  auei ( sexr(m3ny1om  lfcsl(fa2tr(  ;o4tpxoiiciatfm rau o u)artoxo oy1fa  an ol()trtmiopoudolt mivsas)s2ta(m oo1aetniieilsfmDum(ms u4 rxrmrcoytlmtranvi;( tetr(o3ny1lp e ics s  2raxm ;o0oeeo octydfm ean o t)tltrxo tydoa rlu i t t2xrxm iy4ol nlivi s sDrr(r ;t1tleniociadlm2emuvo u)trtoxr3oa1oaD  ueil( s2xrirpiudom   nvia(fsrtm(m ot0tlt moeilslm2el(vs (0teerxo tadfmDelivo;() rtmxr iy1altn feiat  2rmxrpou0tpxnmieiat aDeluvs;t0aeermr3ty1omt  nei;s srurxm ny1ol nmiviat)aDtm(ront0teenioctld a2el( onu0arerxrcoatla rlues;s0sexo(m oo4alt mneiat) 2rmu p;t0opxoioetysla rm(vo;t0 exnio oo1oa e ueils  2xr(o3iu1ale lfeia()srraxrooo1olto f3ils a rmumo;u)arenir3iy1fatrlivi s0srtoxr oy1al n ncsa()sDuaumpou4tlen fctyd m uan onu0 lxoio3ootlpt anvols)texm(o3ny1al emnvt () Drrumooo0tlx ifctadfs ea(vonu4 exrir totfmtraues s0trtmim3nydlmt  nctatfsDuaumo;u4tlx mociyt m el( s t4 rerio oadopDe ieols t2uo(o no1amtnlieilt)srumurp;t4alt io3ilt s ulnmsn(0alerxf3totoate n o;t) 2urirpio1olt livs tfa2taurpou0tpt  feiydls2uauvp;t4 etrmf3oo1fmDr ieolt texr(m3iudlp  lfvt t)s2trx oot1olxo f3ias aDrau s;t)tlxrmf oydlaDe i i t)srtrir iy4lp  mivt tfsDurxroou1ape ioctld sDulnmont)tetoxf3tatoptrlneil( t2toxrpnydop n ietatfsrrrump;o0tlxnif3iltlm2ul(mont4alenxo io1omDrlnvo ( srto(rpnodom n ics t  rrr(rpoo4tpe  f3iltlm2um(msnu)tlxriociytopDrluvi;s0teuoxr3oodol  lfeta( arurxrooo1aet  o3iytfm emumo (0trerxr iodom  an sl(0sexoimpnu4alen fcslsf rtm(mpnu1tetomoeiysfmDuaumo (0aetrxocoadfpDelueo s0trxoir3no4omtnlfvsasfsDur(mo;o4oee  f3tatlmDemnvo u4 reoxr iotfpt lueols0s2tmio iy4op nlfvtlt)a2ta(mooo4tpxnmf3ild s rmumpn(4 exrmf3tatfp r i s t)seuo(m3oydolenmfcs sfsDrm( p;t1apxo feiad s2ean s (0aexoxo3oodfp e n sls0t2umir ou4lltn nei () 2rr( pnt1alx miciaslm2ul(ms (4aexnxr3oodfmDe ueo;t srtmxr iydal nmncsl() Dtau oou0oeto i3iyd sDranms u) lxrmocoytfpt  n s (0 2toir3io1ap nmfcs t)s2umur ou4alt mfeiadls2emnmpn()texrxo3oa1opteluvi t) etmxrpou1am e fvil()s2tmxm no4olxo oeiltfa2eaums u4 etomo ootfmDr u ils0seuriopnydope  iviat  2tmxm ;u0ale  oeias m ran o;u)texnmr3oy1laD livols) exr(r oy1op  mieiat)s2urx  nu0apeoiieilsfa2rlu s u4 leoxocty1oat  uesl() 2to(mpno1lptelfes t aDtmxmpou1tpxn fciyslmDeln pnt)texrif oodlptr nes;s) eumxr ny1ol nlnvs (  rururp;t4texnmf3tyt a eau s ()texnmr3oydfpDe n i s0teumxo3oydameelnctat  rtru  ;o1tet ioeiasfs2rmuvo t4altnio3oadfmtelnvil()t2xr(o3iy1al emivt s)a2rm( pou1aleomictydfmDumn snu4 lxrmf3io1fmtr i sls)s2urxo3oydoltn ieil(f ruax oot1oex  f3iad a2umnmp ()aeermf3io1faDeaieolt s2xrio3oudal elfcs t)a2raxm nu0apx ii3ildfaDrau pnt4 lxnif ia1op   ivo s0t2trxmpnodop n ici (faruaxrpot0alx iictat sDua(mo t4texnxo3oadlp r ueo ()t2xr(opnu4altn ivtlt  Draumpoo1openioeiaslaDumn o u4tetnifcoy1omt ln s;()tetr(m nudope mnes t)artaxmpou4opt mf3tysfm2ran s ()aeeoxf ty1lmDraivi;s s2xmxm3nudlle  feia( sDuaxm no1oleo f3iys s2elumonu4aexrifcoatlmte nvil( trxrio3ou1lm  livtat)aDrau o;t1tetnio3tlsla2emnvp (0 rxrmr ty1oatrlivi;s0t2xrio oo4optnlncias)s2uau  ;o4altomi3iadla2emumo t)trtnir iatopDeluvslt0s2xrxr3iy1lmte fesa(fs2umxr nu4aleomfciysfs2ranmp;(0teermo3oadfm e u ils  rxm(rpiu4opeelnvt (f ruaxmo;o4tpt if3iadfs rlums t4 exnxr3oytla rau i s  rtrxr3iy4ap  mneilt)s2rm( pnt0alxnmociadlm2ulnmpnu4 eermrcoatomteaieo t)tetmio3iodop  miesatfsDtm(r nu0alenmi3ias m ean pnt4treoxrciytlaDe ivs;t)s2uoir no4lm elfvil(f 2tru  ;o1alxomietasla2rlu o t4 lerir3oydomt an i;t0 exoxopoodomtemnet ()s2tr( pot4opxomo3tytlm rmnms;()treomo3tydla rlivols0t2xriopoodlptn ici t)sruaurpnt0olt mociltfs2el(vs;t4 rxrmf3iotlptr uvi;( t2xm(r oydopenlivtl(  rta( p;u0tptnii3ilt m2uau s t0 exnxo oatomtean olt s2umiopoo4omt  netas) Dra( p;t4olx if3tasls rmn p;t0tltoxf3oydomDr uvs s0t2toim3nu4ll nlivi tfsrraxro;t0apxo f3iltlmDrmnvp u4 exrxfctodfpt auvsl()srxmxr3iy4lltemiei ()sruaurp;t0aexnmiciysls2rlnmo t4arenmr oy1lmDe u s;t0 etm(m oo1lpeemneils aDur(ro;t1tee ioeiyd sDumnvp;(4aeeoxr3ty1oateaneils0srxoxm3nudlp e nvilt)sDtrumpoo4openmi3tytlm ra(vsnt) exrxocoatomt lues (0 exmxo oudlptnlnvsl() 2tmxrpnu1apeomfctas s ea(ms;u0teerio to1la eln o;t) rxr(o ny4lme micsa(  2tr(rpot0tpxn i3tasla2ulnmont)tltnmocoytom  auei;()t2tmxm3nu4llt mfesa()arraur ;o0tpt ioeilt sDrm(vs u0alxnmocoydfpDe ieils0trumir3iudomte nvtasf 2trx pot4tptomfctydlmDuau p;(0trxrxf ty1lp  lnvi s0srxoxr3io1om emnes (f rtau o;o0olenifetysfsDem(vp t4tltoif3oytop eau i s0sexmio3oydlmenlfvi s srrmurp;o1tex mf3tlsls el( o;(4tetrxociydopD  u ils)tetrxmpio1al  lfvsa(f Dtrumpnt4apxnmoctadls2ea(mp t) rxnxrcio1opt au o;t)texo(o3iudomenlicta(fa2uaum ou0optniocils s ua(vp u0trermo iadfaD auesls t2xrxr iy4ome  ncs tf 2uaur ;u4aee moeildlm2emnvp (0 leoxr tydoaDr nes t0s2xrxr ou4lpte fci t  Dua(  ;t0tle mictadlsDemnms;u)texnxrciatfa   nvol() 2tmxrpiudopenlivtatfsrraurpot4apt  i3ilsfm uauvpnt)texnmo3tatlaDr i i s tetm(mpoo4ale lnviatfa2urur nt0tpe  fctlsfm2ua( s;u4 lenxf iytlmDeanes t  2umim3nu1ol e ies tfaDra( poo1tltn iciatla2rluvo u4 etrxr oo1fa   n sls)teum(o iudlmtnlfesas)sDta(mo;u4oexomfctlt m2um(mo;u0aetomo oytop e u o;s teumxo3iy1aptnlicta( s2ua(  ;o0alx mf3iysfaDea(vsnu0 etnmr oytom  ai s;t) eumio3iy1lmt mfvs t)s2umxrpno0tpxo ieiadfaDrmums t0aleoir iotlpt au i t0 eumxrpiu4amtnlfeilt)s2tmx  nu1tptoioeiysls ul(vsn(4 renmr iatoa   ivs (  2tmxm oudolenlieils)s2raxr ot1opeoiociad m el( p u4 exoif to1om  livs t)t2uo(r3oy4oleelneil(farraurpnu4apxnii3ild m2uln pnt0trxoxr ta1fa  lieo t  ruo(opnudop eliei (  rrru pou1tptn f3iat a elumo (4trermrciotfa ran s;t  2urxm iy4optnmncia() rtm(m ;o4aex ifeias s eluvo;()aexniociy1laD aivolt0trum(mpnu1lp elnvtltfsrrmxrp;t0tptnmociltlm2raumo;u4tltrifctatlp elueo t texo(m3oodlptemnvslt  rrmumpou1aetoii3iat s2ra( pn(4 rxrxocootfat auvs s0 rtoxm3nudom   fetas)s2tr(m ;t1apto oetydfm um(vo u0tltoxr iy1om e ieslt srxo(opiydlleelfcias) 2tm(r oo1tet moctlt m ra(mo u0altrmr oytlmtr uesls seurxm3io1om n icsatfarumxrooo0teeoif3iad s rl( p;u0 eenmo3ootlaDeanvs;s)trtr(m io4oltemfeilt) rta(r ot1oee  o3tld mDumu on() leoxo iotlp eli o;s  ruo(r iu4optelnvsatfsrtaxro;o4apxn ieiyd a um(mpnu0tlxrxr3tydopt  u i;s)t2uo(rpiy4apt mict t sDtr(  no0teenmo3ildla rm(vsnt)arenio oatfptrau s t sruoio oy4ol   nvta()aDtrumo;u0oltn iciydfm eauvo (4teermrcoydla r nei;t0 exrxr nu4amtnmict ()a2rrx ooo0oexn ieild mDeaump;(0aexomf oy1lmD auvils0setm(mpnu1op  mncta(  2ur(r oo1tpt mf3iadlsDrlnmp (0alxoir3ootop e nvs;s  2ur(r3ny1lle miei t) 2tru  ;o0tet  i3ias aDrm( onu4arxrmrciydfpt luvo;()teuoxo3ou1oltemicilt)sDrmur oo0opx mi3iatlm2uaums t0 etoircoo1lptrlnvsl(0srurxo3oo4ameelfcs ()srrax ono4aex  o3tydlmDeanms;t0 exoxf3oa1fp rau ols0tetrirpiy4op nmnctasf 2rm(r ot4olxnifciadlmDumnmp;t)tlxoxf3iodlmte u o;s0 rxrim oudlme  fct s)s2ur(moot1oleomf3ilt s rm(vonu4aexnxo3iytomt  i i t)srxrxm3oo1apeemfcslt)artaumpno1apx moetaslm ulnms;u4trxnio3ta1fa  au i (  rxo(mpoo4aptnmnciasfaruaur ot0aex  octydfs2uln p;()arerifcio1om rai ilt)t2urir iydll emivta()aDtmx  ;t4alt io3ils a2ra(msnu4 rtoifciatfaDelu ils0s2uoimpny1optelietls arur(rpno4tleo feiatfaDrm( pn(0aexnxr oatom r n olt t2xr(o3oudop nlivi s) Dua( p;t0oetomiciys aDul(monu0arenifcia1fmDeluvo;(0s2tmxopiu1amtn nvtl( a2tau p;t4apt ifciad sDuln pn() etnmrcoadfmD luvslt0 rxmimpiy4lmee ietasfa2rm( pou0aptnioetatlsDeau pnu) reoxf iatom  anvs;s  2xrimpiy4amtn iet t) rtaumono4texnmiciyd a el(vp;u0tltoxo3iatlaD  ieols)teto(rpiu4opt  nei sfsrrr(mont0ale  f3iytla ulnvo t)teeoifcoo1la rln i (0srto(rpoudoptnlnctlt aDua(  no1apenii3iyd m rm(ms (0tlenxr iatfm  aieo t0s2tmiopiu1om  mivilt  Dua(r nt4tlxnmicild a uanms;t4aexrmf oydom e n i;t)sexoxo3iydlp   ivtls a2rmxmo;t0olen feiytla rmn snt0teenxr3iatfa r uvo;s) 2tmiopou1ol nlfctat) Durx pou4oetn oetadlm em(vsn(0 lxnifcoa1op  au ol( s2trxo3nodam nlictls sDrmu o;o4alxoif3tyslm2eau o u)aleoxo3tatfp e u i t trtoim3io1amen fci ()sDrrum no1apto ieiytlm2uan s u0 etoircio1om e n i;s0srtoxrpio4op nmnvt sfs2ua(r oo0optomieiadfm2ea( s () lxrir3iy1om rauvo t)t2trim iudomt  fei ( sDum( poo0altn ociyslm2ra(mpnt4trtnif3totfp eli i (0 rurir ny1lpe  fciltf rur(mo;o4tlxnii3tydla rmuvp;t)aeerio3ootoaD  uvol( teum(r3ny1omtnlnes tfsrurxm ot0alxnmfctydfaDeanmp u0treomo oo1fp rau olt)trtmxrpnydameemicia(f rrr(r ;o4tet  iciasfa2ulnms ()arenif3ootfmD aivo t0teur(o oy4alee ies (fa2umu  nt1alxn oeiatlsDrmuvon(0arenirctytfpDe u o t tetoxm nydaptnmfcils s2rmxroou1tptomoetaslmDel(vpnu0trerxf tadfmtrai o;t)texm(rpnydlmee feilt  Durx  nu1teen feildlmDrmu s t0tltomf oydfmDrluvolt)t2umxm3iu1lm n ies t  Drauro;t1oeenmo3iltfm2ea(mo;(0altoxociatoa   u olt  exrimpoy4olt  fet sfsrrrurpno4aleomfetadfm2rluvpnt0arermo3oo1omtrlu i;s)setoxrpio1ome mfesls)artau  ;u0tleoifeiysls2um(mpn(0 lxrio3oodlpt  i i;t trum(mpio1aptemncta( srrr(monu0tpxnii3iatlm umnvp (0 lxnxf3tydfmD li o t0t2xo(o3io4lpenlneiltf Dumx  oo4aeen oetltls ulu p;(0tltnif3ta1oa rli i s  eumim ou4lpe lfvslt) rtmx p;t1alenmo3ild mDrm(vp (4tlxrmo3iytlptelnes t) 2to(o3nodlmee fcs s)arurumo;t1olxniietlt mDua(ms t4texoxocio1optrauvi;(0trxoio iu4al nmnviat s2um( ont4tlxoioctasfs uln o;()altrio3to1fa r n s;s seuo(o3oy4lltnmfesat  rrrurp;u1aee ioetas m emumsn()trxnio oadla e uei s0sruoxmpiy1oltemfvt (fsDum(mp;u0tpen ieildla2ranms t0 exoxfcoy1fpDeluvo;t)sexm(opoydal n ivta(f Draxm nt1alxniociadfm ra(vs u0arenmfcoatla r n ils srxoxm iydll e ivsas  2urxmoou4tpenifciat a2rmuvsn(0trenif3tatoa  aivils  etrir3ny4altnmfctlt)aDtrxmonu0olxo octldla rlnvo ()treoiocto1latr u i;s0t2uoim3iudameemivtl()srrr( pou4teeoiociadls uanmpnu)texnmrciatfpDrluvils0 exmxr3iu1apt  nci t a2raum ;u1ole  o3iyt s2umnmpn(4altoxo oodfaDrauvs;s0t2umxo3io1lmtemnvtlsfsDra(m nt1tle  fciys aDelumo;t0trxrmfcto1lmt lieo s t2tmim oudlp nlivsat) Durxm oo4tpe iictltlaDumnmp t4aexoxr3iadlpteauvi t  etrxmpnu1ap elicias aDrau oot4tlxnii3ildfa ul(von()altnmo3ia1latr ieils)s2ur(o iodlptemicia( a2uaxr nt1olen fcils aDea(vs t0alxnmr3tytlmte ieslt s2xrirpou4amtn fctl( aDuaxm oo0opx ii3ildla um(vp;t4trtoir3iydlaDr nei s) 2tmim oy4ol  mfvsa(faDtr(  ou1aeenifetadfm2eanvon()arxnmrcto1lp e nvi t0 rurim3io1alt mivt (fsDta(  nu0optoifciatlm umn s;t4 exrif3oytfmtelu i ( t2tmxm iu1op   fctas  Drrx  ou4tptniociydfsDeluvpnt4artrmo iodfat lies;(0seto(m io1lleemivtlt)srta(rooo1alto oetlt a2rl( s (4aexomfctodomD ai i s)s2toim ou1lpe lfes s)a2tax oot4oetomoctasls elump;t) rxrxr tydlmte i s;(0srxrir no4lpe lfet sfaruaur ;o4oexniietld sDem( s;u0teenir iodopDr u ol(0t2ur(r iydom e fct (  rra(mont1aptn f3tasls ul( snu0aetrio tadlateaivo;s t2urxr3oy4lmee net t)srrrxrp;u4texo o3iytfs2em(ms;t)altnxoctytlat au s t) rtmxm3ny1lpen nvsa() Drau ono0alenmoetysfa2umn s t)trerxr oo1fp r n i;s trtm(o oudlmt lfcsat a2taxr ou0apeomoeiyslaDrmumpnt0arxnxr iodomD  n o;s srxoio3io1al nmfct (fa2rmxm ;u1tle mietyt s uanvon(0aexomfctatfpt aivs s)srtoim iu1om  lnct tfsDuaxmoou1apx mi3iydfaDeln o (0aetnmfciadfatrlnvs;s) eurirpiudomtnlnvtlsfs2tmurp;o0aptnifetadfm2rln p t)trtrifcia1fptrlnvo;()s2to(o nydome mnvta() Drr( o;t4tltnmi3tytlm em( o;t0 rerxo3oodom r ivs s0 exoio3oudolt lfct tfsDtrx  ;u1opxnmfetatfmDrlump;t4 eerio3ty1optr ueo;()t2tmxo nodoltn fesl( artmx  ;u0aexnmoeildfsDra(vs;t)trxoxrcty1lptrli i s0trxrxm oudap nmncsat)aDua( o;o4tlxo i3tadlaDeanvs;t)trtnxo oo1fp  an o (0 2xm(opnu1opeelnviatfsDtau p;t4alxo octad s um(mp;u4 lenmr3iotlpt anes;(  2xrir3oy4oltelnvi tf Dtmumpno1tpx ioctyt m umnvs;u)tetoxo iytlat lneo;()teumxm3oodapen fvtlsf 2umxrp;u1oeeoioctatfs elu onu4 rtoifcoy1opDe neo;s srxoir3nydal e nct t) 2tr(  oo1tpx mfetyd s2rmn s;u)teeoir iadfmteaiei () rxo(m iu1llt lfcslsf Dtrum ;t4olxnif3tys aDelu pnu) etnxociatlpDrlu s;()teur(m nudal  mnvsl(f 2taxm ou4oet ii3iatfa ra(mo;(0 rxomr3oodfpteaueo (0teurimpiu1llen fcs (fs2uaxmp;u4tlenmf3tlsla2uau pn()tetnmf tadfpDr uvo s)teurxrpnydll nmfcsas)srrr(mono1olxnmfctyd m um(mo;(4artnmf3iydfm  an sls  exoxo no1om nlici ()sDrrxrpnt0aeenmoeiasfsDrmnvonu)aeeomfciydop   i s;t0s2xmio iudolt lfvils)aruau p;u0tpx  o3iadfmDuluvp;t4artoxf3iotlp eauei s  eurir3ny4ome  ici ()srtr(mono1olxoiiciydlm uaumpnt0arxnmocoydoatr nvil(0s2ur(o iu1lptnmfci t) rtm( o;u1tetoioeiytla2ea( s t) ltnxo oy1fa rlieilt)s2uoiopoy4alt mnvi sf rtaur ot4aleomf3ildfsDeauvsnt4 rtrxo iadoa r i s s) euoim ny4open neilsfaDtax p;u1tpt iociaslm um(mp;u) etrmf iydfm e u sl()srxrxm3oy4alee ivs s)a2tr(mp;u0oleo fciydfaDemnmo u)areomo iy1oaDean s;(0seur(mpny1lmt  ict tfartmxr nt0tpx miciaslm um(mp (4texnir todopt lnei s t2umxo3no4llt mfci tfa2rrx  nu0tee moetas a2rm( snu4tetoxo oatfa e nvi t) 2toimpnudomte fviatfaruau pnu0aee  fctydlaDum( sn(4tlxnxr oa1fmtr nvilt)srxoxo oudlpeemfcias)artm(mooo1ape  fetatfa um(ms t4arerxf ia1optrli i (0t2xmim oo4ame lnvils aDtaum nt4opxn i3tlsls ua(von(4artoio3ta1lmDr uvslt sruo(m oudamen net s)s2rm(mo;t4opx if3ild a2rln o;u0trenxr tatfp ranvil(0srxr(o iodoptnmncia( arumxmpou1aptomictasfm um(vp t)teerif oo1faD lnvs (  rur(r3oydlmen fciltfsrrm(monu1opxoiociadlm uaums;(4altoifcoydlmt aueol(0teurxmpoy1op  lfvi (f Dum( pnu0opx ii3tyt sDumuvs;u4tltoif oy1fmtelnvs;(0 exmxopoy4oltn iesa( arurur ;u1oe
\ No newline at end of file
@@ -0,0 +1 @@
+u ils)srumirpiy4ol  mici (fsrur(rono0olxoioeiytfmDeanmsnu0tlxrir3todla r ueo t  rtr(o io1al   fcsas  Drmu  no4optniieildls ulnmpnt0altrif3to1fm e nvs ( sexoxrpnu1omtnlfvsas)s2tmxmpnu4oltn ieiysfm rmnms;()altnmo oy1opt anvi;t)tetr(opnydam  mfvi tfa2uaxr ou4opx mf3iytls2rl( p t4 rtrxocia1fpt  ues;()seto(m nudam   nctat)aDrauro;o1tpeo fciyslaDrl(mo t)alxrio3iadoaDr nvs;(0tetr(r3nu1lpt miei s) rtaumpnu0aetnmictadls umnms (4trerxoctatom  au i s0 2urxrpiy4lltnlfcs (f rtmumono1open fctlt sDrau o t4 etnir3iy1lp eau o t sruoio3oy4ol  livtasf Drmu  ;u1oltnmi3iatfs2rlums;u0aeenmociy1lpt  ueo;(  exoxrpou4omeelnes tf rumxm nt0texnifciyt a rl(vpnt0tltnmr oodfmDrli ils)t2tm(mpou1lptelivias aDtmxr ou4oleomoctyslmDumu snu4 eerxf3iodfa eaneslt0trxrio io4lmeelfvilt a2tr( ono1oet  fciad sDelu p t0artomoctydlpDr n o t  euo(m3oodame lfci () Dtr(r nt1apx mfeiysla2eluvsnt)aexomr3ia1fmtr nei s0srtrxmpno4ap elneilt) Dtmu  ;o1aleoiociltla2em(mo (4texrifciodomt livs;t0s2uoir iodomtnmfctlt)aDtrurpno1tpxn ictatla2rau p u0tltnxf iadlp  aieols0 2uo(r oy4ol   fvsltf rra( poo4opeo o3tat aDumnmpnt0alxoxf totom ranes;(0 rto(mpoydam e fcta(f rrrxrooo4olxn feias m2rmnvpnu) leoxrciatom eau o ( trtm(m oy4lp   ncsas)s2trumono1apxomo3tyd sDrlump;t0tlerir3oa1fmt an s;()sexmxmpiodom emfet (  Drr(r nt0oet mfctadfmDua(vs t4texrir iotoate u s s  2umxm3iy4oltemfvsl( aDrrumpot0oetoif3iytlm2rmumpnu0 lermfcoydlpt au ols0t2uo(m oo1ale liciatfsDtmxmp;u1teenmfciydfaDrl(vs;u4tltnmf3iadlp elieol(0tetrio no1ap   fcsat  ruaur no0apxomieiyd a2rau o;u0 ltnxf tadfmtrln s;(  exoir nu4opeelnctls)aDrm( p;t4tptoioetadlm2uln o (4trtrxo iytlpDrluvs (  2to(o iodamenlietlsfartm(mpou0tlx mf3ils s rm(vsnu)arxomo3oy1lm e nei;s0t2uo(m3oy1llenmncslsfsrtrxront1tpxnmi3iaslm ulnvonu0trtnmr io1opt aneils0 2uoxm nu4lp  lictasf 2truronu4tleoioeiyt m umumpnu4trxomoctatoatrai o;(  etm(r3oo1al   nvtat  2ua(r ;t1aexo icilsfm rm(vs;(4arenir ootomt auei;t) rum(m iodamtnlfvtls aDua(mp;u4alx  oeiysfmDrmnms t4trerirciydlp rlnei t teum(o nu1llee ivsas  rurum nu1ape ii3ildla el( p;t4 rtrxo3tytlmD aivils)setoim3iydoptnlfvtls arrmxmpot1aet  o3ildfa ulu o;(0 lerir3iodla  au ils)sexmim3nu4op e fcs t) Dum(mooo4aetoifciadla2ua(msn(0aetnxociatopDrluesl(0teuoir iu1ameelivt t)arurx  no1olxomoctytlm el( s (4tlxnxo oytlptelu ol(  2uoxm iudlme lfviat a2uaxm nt1ape  f3iydlm ean p;t) lxnmf3ootop   nvslt0trto(m3iy1optnmivtls)sDtrx pno1tle  ieiat a2rln o () renmo oo1lpDraneo;t) 2xmxm oy4omen fei s)a2ua(mpoo0tlxo feiasfa ua(ms u4trerxo3ty1oate u s;s0s2tmxm3ou1lltelnciatfsDrrxmp;o0olt  fcias aDuluvsn(4 lxoiocio1laD anvi s srxr(o oudaptnmnes sfsrtmx onu4tleoif3ias a emu s t)alermf todfp eau o t0trtoirpoy1op e nviltfa2tr(rooo4tpxniicildfa2em(vs ()tlenxf tatop  aiei;t teuoio ny4lmtemfeta( a2trxm ou1aee  fetydla rlnvpn(0alxnxrcty1lmt  nvs;s setrxo no4alte ici ( artmum ;t4opxn f3tltls2umn o;t4arenxf oo1omD  uvo;s0s2xrxopiydlpenlfcsatfa2tm(mpnt1tptoifetld a2elnvo u0alxrmr iodopt luesls)s2tm(o oudaltelfei tf 2uru onu0ape iocildfmDea( o;(0 exomr oodoa r neslt0 exoio iy4openlfetlt  Duau  nu1tet mfcildfmDulu p;u4 etnxfctatfpteln o;s0t2xoir3oo1olenmfetlt) 2rrx o;t4oee  iciytfa2emuvo ()aeenxrcia1oaDrluvs s) 2xrxr iydale lfci s  rrrumpot1aeenifciyslaDua( o ()tlerxoctodfpDrlieils) 2xm(m3oy4al emfviat)aDtax  nu4tetoii3ildfsDrauvpnt4teenxr tydfmDean o s teumxmpiy1lpe  nvilt  Drmxroot4oleoio3iyslmDua(vo t4teermo oy1opDe uvs;t) 2um(o3iudap e nct t)a2rmu p;t0alxn f3iasfaDuaump;t) reoxr3oadfa  luvo () 2toir oo4oleelivi ( sDum(m ;o1opx  ociatfmDrm( s u)aexnir3iatlaD  n i;( s2xmirpoo1amenlivi tfsDur(roou1apen o3ildlsDumumsn(4 ltrif oa1fmD lueolt t2tmimpno4omee ivs tfs2ur(mpnt0olxnifctadfs elnmsnu0treoifcia1lmDe nei t0 2tr(o oo1lpt mfes sf 2umxr ;o1tpxoifctlsfmDra(vs;t0tltnmf iy1fp   u ols)s2toir3iodomt lfeil(  rrmxmont1olt  feiytls rluvs u0 rtnmrcoy1lmtrlivo;s trtr(mpiu4oltemnvs sf 2uaxroot4tptomietadfm rl( p;(0treoirctotopteaieo t0trxoio3oo1altemnesl( srtrxrpot1tptomoeias a ea( o;(0texnir tydom   u sls)truo(m nudole lneils aruru  ;t1aeeomfcildlsDrmnvs;t4tlxnxrciotlaDr iei ()srtmir3no1ape  nviasfs2urumpnu4ole if3iyslm2rmnvs;t0aleoxo tytlpDe nvs t)sruoirpoy4lp  mnesas)srta(  ;o4apx iieiytfm ua( pnt)trxnmo oadfm   i s ( trurim iydolee feia(f Dumu pno4tetomieiasfa2elu o;t0 reoxfctodlmtr ivols t2tmxopiu1opt mfct tf Dur( oot1ope  f3ias m ranmo;(0trtnxo3todomte neo;( seuoio3oy1omte fctlsf rtau  ;o1opt mfctatfs2rmnms u)alxnirctydfaD livs;t0 2xrio iydal nlfcta(  2ur(  nu1aexnmf3tldla2rl( p u4aetnmociodlm rlneilt)t2toirpoydalee fvsls srum(  nt1oltoifeiltlm rmuvon(4tltrxocoadfmDr ieil(0sruo(r3ou1op nmncs ( s2tmu p;u4teeomieiysfs2rauvo;()alenxocia1lmteauei;s sruoirpio4lmt  nvtasfaruru o;o4altoiiciltfa emumo;t0aeenircoytfpD aieils0 rurio3oodoltelnetas) 2umx pot4oexoiiciytfa2uauvs t0 ltrxr iadlpt  uei;() etm(m oy1lmt mivtl( arrm(r ;o0aet  o3tasfaDua( on()arxrioctodfaD anvs;t t2to(r3no1ol nmivs t s2rru p;t1apt  iciytla emump (4aexrmr oytlmteln i;s trxrxr oy1om emncsas) 2tr(rono1tpt  ictyd sDumnvs u0altrxf3tytlaDrauei;t0texoirpno1al nmivtls s2tm(mpnu4oeenif3iyslm2umnmp t0 eerxrcta1om rluvsls  etoxopio4lmtnmnes (  2tmxrooo0tptomoeiatfaDra(vs;u4aexrif tadomt livs;s sexr(mpny1llt  nvsa(f rrmxmpnu1tet mfciyd s rl(vsnu)tetomociytlm ranesl(0t2tmim no4altnlivia() Dtau p;o4aeenio3iysfmDeaumsnu) eenmf tadlpt lieo t  etoxopou1op nlies t) Dumxrpnt0opxnii3iydlaDrln pnu)tetoxr3ootfptr ueo;s)seuoimpno4ame mfvsat s2tmumoou4tlt  ictatfa uanmo t)tlxoxfciotopt  ueils)texriopiy1opte ies t)srtaxr nt1oexniociltfm umnmon(4tltnmrcoadlpt lneo t trtoxrpiydalte ivilsfarumxm oo1opxoiocilt m2rlums;t4 rermr3oytfmDrlnes s  exmimpno4ole lnctl(fs2uaxmoou0tetniietld aDrauvo;u)alerxfcoodopte i ol(0srtoxmpnu1open ietlsfa2uax  nu0aet ii3tyt mDuln o t4tetnxr io1op   n ols) etoxr nydlpt lnctls aDum(m nt1ape mo3tasla2ulnvpnt)aetrir3totop ean o s0seumxr3iu1lm  mfcta(f Dtru  ;t1tpeo i3ildfm em(vp t)artnifctodlmte n sls)teur(r io4om nmiet (fsDraum nu1oleo icildfa rlnmsnu4aexrxrcoa1faDr ivolt) rtoio iu1oltelnvsa(fa2tauroot1tlxn fctld s2ua(vpnt0aexomf3oatlp  auvo;s0s2xoxm3iodomtemfes tfaDrmuroot1apx mo3tlsfmDemu o () lenxo iytlaD  u i (0 rxr(o3iy4ap nmneilsfs2rmx  no1tltoiociat m umuvo;t0 lxoir oytomD  ivol() etmxm3oy1lp nlieia() ruau onu4oet mictat sDea(vo u0tetrmf oa1lm e u ols0 2trio nudlleemicils sDtmurpou4tltn i3tlsfsDua( s;() lxnmo iy1fmDrln il(0t2umxo iu1lltnmfvt t  Dur( onu1aetoifctatfsDeluvo;u0 lxrxoctydlaD aivi;s0trxo(m no1ll e nes s arra(rp;o1optoiiciltla2el( p t)tltomo ootom   n o (0 2toir io4lp nlncslt srtmurooo1olxoio3iasfsDum( o u4tlenio tytop eluvols) eur(o3oydoltemicsa()sDrmx o;t0aet if3taslaDeanvs t) rxomo oatlmtrau o t) rxoio ny1lltemfvilt) rrm(mo;t0tlxn oeiadfs2rau p;u0aeenmf iytlmtrai s s0 2xm(m3ou4op nlneia(fartr(m oo0openmf3iydfa2eaums u) eenxfctadfm  ln i;s trxmir3oydopee icil( s2ra(m nu0altoifctlsfa ra(mp;u4 rtrmfctotfpt ln o s  2urxm no4open fvi sf 2rmurpou4altnmfcils aDelu onu4 rxnxfcio1fp   nvo () exrxmpnydape mfeia(fa2urumooo4aetoii3iatlm2el(vs u4 etrxo3iatfp  auei t s2xmxrpoy4opeelnct t) rurxmpot4oeeomo3iadlm2ulu s;() lxrio tatfat livo;s t2xmxo3ny1opt miviat s2trump;o1tltnmfetasls em(vo ()arerxf totfpDeauvsls)t2trim iu4am  lfcsa() rtaurpou0tltoiicildfm el(vs u0 exomf3iytopteln sl()srtrir nodoleeliesl()sDtaxmoou4olxomo3iydfm emuvp u)arxnircta1fmD lu s t0srto(r3no4lmt mfeils a2rax  oo0tptoio3ild m2el(vsnt0tetoxr oodfmt lueilt0 2to(r iy4opeelics s a2uax poo4apxn oetlsfaDrmu s;u0 rxoxociy1lateanvo;t0s2um(r nudam   feia( srrrurpno1oeto icildfs2uluvo;t4tetrif tydfm ran o;(0 rumxm oodop  mnci (f Drrx p;u4aee iiciat aDea(msnt4aetrxr3ootfm  anvo;(0 rurio3nodapt lfesl(faDtaumoot1oleomoeiltfm2uln o t0 eenxocto1oat aivo;(0trto(rpnydam nmivsas)aDuaxmo;t4optn fciadfm uln o u4trxrmo todoaDrluvi;t0tetrxo oo4lm   fes (fa2taumono0tpxoiietlsfsDeaumpnt4altrir3ia1fmtelues s)tetr(m3iodlle  nctltfs2ur(m oo4oexn o3tas mDuln p;t)alxnmrcia1optrlneo;t0 rumxopno1lmtnmiei t  Draxmono4opx ifciadfs2ea( o;t) rxrioctodlatelivs;s) exrxmpou4oleelnvsa()artaxmono0aetnifeiad m eau onu4tlxnxfcoo1lptr i o s0srtr(o iy1ame mnvs ()arta(  nt1openioeiysfs2uauvp t0trtnmr oytfm raivo;s  2umirpny1amtemivi t)sDta(  ;u1aexo o3iyd aDemnvp t4 exrxf io1fmD au s s0truoimpiydaltemnesl( a2ua(rp;t0tptnmfeias s eaums (0 etoxo oodla e nvo t texmxm iydalt  nvslsfsrtmumpot4tpxoiieiydfm rln pnu0 rtoxo oodoa   nesls0seur(m3no1lle  ivi t aDra(rp;o1tee ifcilsfaDrlnvsnt) ltrmfcio1lpD  ieil(0setmxm3oo1optelnvslsfarumxrpou1tptn oetld m ulumont0aexnirctotlat luvil(0t2xo(rpiudaltn netas)artmu oou4aptnifeiatfaDrmn sn()aexrxf3todomDr nei;s0t2xoirpoudoptnlfvt ( aDrrxr ou0tlxo oeiadlsDua(vsn(4aeenmf oa1fa e nvi s0 2uoxm no1lptn fvils  rrr(m ;o0apenio3ilsfm eanmpnt)teermr ta1fpD ln sl(0trumimpiu4am   feiat)a2tmxro;o0oexnmictls m2uluvs u4tetnmf iadlmt aneil()t2xoxr no1alte ncil()sDrrurpnu4altnmiciadla2rmu o t4trxoxr oa1om  an s;s srurxr ny4altn neias  2rau  ou4olt ii3ils m eauvp (0alxoio ty1omt au i;s) exrxopio1amt lnvt t  2tmum nt1tltn ieiasfm2uauvsn(0trenmrcio1lmteaieo ()trurxr3oudolt  ics t  rtmxmooo0oexo ociydlsDrl(mp;(4 leoxo oo1fptraneo;s srxoxrpoydomenlfes (fs2urxm ;t0opeomoeiatfm2em(ms;t0texoxocoatomteluvo ( s2tm(m3nydame  nctls aDtmum nt4tpe moeias a2um(msnt)arxnmo3io1opDe ieo t t2umimpnudlp  lfesas srrm(m nu0oetn o3iltlsDem(msnt)tltrirciydopDean o (0t2urxopno4ll  lneslt)sDrm(rpou4aeto ieiatfs rlu o;u4 rermocio1fp rlnvslt s2uoio3no4op nlnvi (f 2um(root1alen ocias m2rauvs t4tlxrxrciatomteln s s0 rto(m3oodal elicsa()sDta(  nt4tle mf3ils a2ua( s (4 etnmocoytlmte uvs t srxmxo oy1omeelfei ()artru o;u1tet mfeiydlm ran ont)texoir3oo1latrln s s)trxrxmpoydap nmnei s)aDraxr nt0tpxomfciasla2emnms;u)teeomf oadlaDr ivo s0s2xoimpny4amee fct tfsDtrxmpnu0ale mietatfs2el(von() eenxoctydlpt aivo (0seur(m3no4lp elivia( a2taxmpno0oltnmo3iltlsDrmums;t) eeomr tadoptrln o ( teurxo oo1om  lfvslt)s2tauroot4oexo feildfa2umnms;u) exrmo iotopteluvsl( trxoxr iudopeemfeta(f rurumo;t4altnif3iatlm2rln s;t) etnxr iotfaD lueils  ruoimpiodap emnci s srtrxronu4tpeo f3ils s2ua(msnu4texrmf oytomte i ils0srxo(opnu1optemieil(f Drr( p;u4aleniictldlm ra(vpnt0trtnmr iatfaDe ivo;s s2uoxr io1amt  netls a2urx p;t1aetoio3tadfs2rlnvsnt4alxoifciy1op  anvs;t  2xm(r3ou1op elnvslt  rra(ro;t4tltniociasfs2uln s;() lxrxocoa1oa   n ols)trxo(opoo4am  lncia() Drmum ot1teenmi3iadls ra(msnt0trerio3ia1oa e iei;( s2toim ou4opee fvi ( aDrm(rpot1apxo iciltfmDrmuvpnu0aeerxfctatom e uvi t  rtrim nudalt mneta( a2taxmo;o4ale mf3iydla2ea(mp u0 etoirciodopDeanvi s trtmxo3iy4altelictl( a2tm(r nt0ole mieiyt a ran s;u0 rtrmociatomD lieol(0 rtmxmpno1lpen fetltf Dur(rpnt1oeenmocildfs2um(mpnu)trtnmocoy1om  lnvi s) euo(r3ou1aleemfct t)aDum(  nu4aetnifctytlaDel( o (4alenxr ta1fat  i i (0s2xrxr io1ome  feilt srtmu pou4opxn f3ilsls ea( o;()tlxrxo3ty1lp e n i;t0srtr(o oydll nmneia( sDumxro;u4tltn octys a2ra(vs u) rxnmr iodlmDraieo t)s2toim3oy4aptemfvs tf rrrxm ou4aetn fctat s2rmu s u)aeenmo todfa e nes (  rtmio3oo4amtn fet sfsDum( oou1tpt moetytfsDeanvs u0arxnxo tadlmt luvi s  2trio3iu1altnmfvsls sDtrx o;u1tet iieiatfaDemuvp;(4 exnirctatla r ueol( t2um(opiydalt  fvtlt arur( p;u1tlen oeiasfs2uln o t4aetnxrctadlm r n o s)tetoir3oo4lmeelivia(farrm(m nu4tlxo o3tatfs em(von(0tetnxr3todoa   n olt) exm(o iy1olenlfctlsfaDtrx  nt4tpt mociltfs ra(vsn()teeomoctadfaD auesls0srxrxo3nodopt  nvsas  2rmumonu4aeto f3ilsfa ran p;t4treomocty1om  li s t t2toio3ny1alt  ivtat s2raur nt0oeeniocilsls eluvonu4tetrircoa1omD  neil( srumxmpio1ol elicsltfa2uau oot4oleomieiys s2uanmo;u4alerir3ootfm elueo t)seuo(mpny4amte ieia( arurxmpou4oex  oeiyslm ulnvs t4arenmrctadla rlnvs s) 2toiopno4ole mfet t) 2raxro;t1olxomfciatfmDeluvs;()alxnircta1laDr uvo;t s2to(opiydlpee iesa(  Drru pou4tpe mfeiad a2ulu sn(0trtoiociydfa eaues ()tetmimpiudol nmfeiat) rur(moot1aetnif3iasls2rm(vo u4altnxr oatfaD auvi t0t2xrirpoy1altemfvsls a2rrur ;o0olxomociasla2rmn o u4 rxrxf oatopDrau ilt sexrxm3ny4om n nciat s2tm(m ot0tpeoiiciatfmDua(mpn(0 lxnxrciatfm eanvilt)teto(r oy4lme mict t)aDrr(rpoo4oltnmi3ias mDean p t4 lenmo3oo1oa eli i;(0trur(opou4lleelfct s)artaurp;t1oetn ieiasls umnvs;t) etomrcoytlpDrlieils)sexrxopoy1op  mnesat  Dtax  ;t0tltoio3iytfm2uaump;(4 ltrmr ootomt ln i s) 2xoxo oy4aleemnvias) rtau p;t0ale  ieiat s umuvs;u0altoxr tadfm rai o;s)seuoio nodlpeemictlsfsrrruro;o0oetoii3tadfaDrluvs u0 rxnio oydlm   u i;t) 2xm(m3no1ap n ieta( sDururonu1tpx  i3iaslsDrmnvsnu4alxnxo oo1fm e n s t0s2um(r3iy1lm emiei () 2um(rpot4oexo i3iyd s2eauvon(4trtrxrctotomDr uvs;t0 eur(opoy4lmtn nvtas srraum no4apx iieiasls eanmp;u)artomo iodfmD an s t teurimpiu1lmtelnvtas  rua( o;t0oexn oeiyd a2um( s;u0 ltrxo ty1omt  uvol() rto(r iudlleemfvilsfsrumxr ou4ole iociatlsDelumo t4tetoxr3iydlmD livs t0 exrimpny4lp   ietat) Dtmuro;t4tpx ifeiatfaDran p;u4 eerxr ootfa r iei;t)s2xmim nudlmen fviat)aDtru  ot0olx mfciydfa rmu p t0aetoxo ty1la eaivs (0trurxr no1lpt lncslt s2um(ro;t4texo fciysfaDel( onu) lxoio tytfpDelieo () etrxo3nydol elnci (f rurxro;o4apt mf3ilt aDumu p;(4artrmr tytopteluvo s seuo(r nu1altnmnct tfartr( o;u0apt mi3iyd s rlnvs;u) lxrif3iotoaDeauvils) rto(mpiu4ol n icsasfaDta( oou0aptnioctad s rauvo ()tetoir3todfp   u i;( s2xmxr oudaptelieil( s2urum ou0oexn i3iytfaDranvon() rxnifcoy1fptraies;()s2xmxr oo1ol   ies t srtaxm no4altn oetydlaDua(mp t0teenifctytomDrau i ( seuo(r iu4aptelncta( sDuaurono4tlx mfeias mDea(mp t4 rxrmr3oytoaDraueo s  rxoxm iudoltelnet t)sDurur no4olen ictldfa ean s u4 leoxf iytfmteaieo;()t2xmxr iudomee nvsls aDrrxmono1apxoiieiadla2ulnmp;u4texoxf tydfa rlneils0s2xo(r ou4olt  neta()a2raum ot0altn i3iat aDrm(msnt0tleoirctatfmteaivo;t seumio oo4omenmfei (  rrm( pnu4tpeo oetlsfm ean snt0 ltomr3oy1lmtelues;s) etr(o3ny4amtn iesat) rua(r nu4aeto ociat mDra(mo;t0trenifciodfaD anes;t0 eurxr oodol emfci tf rur( onu0apt mieiasfs uauvs;(0tltnxf3iy1lpD aueil()t2uoxo3oudlmeelfvi ()srrmxmpnt1apeomf3iydfs2rmnmpnt0aexoxfctytoa elieo s) etm(r3nu1llt mnci t artrurpnt4aetnmfcild a2ua( onu)alenio ootoptr nvsl( teur(m oydlmtemfcs (  rurx  ;t1aleo f3iltfs2ra( o;(0trxriociadfpDeanvi;s)trtoir3ou1lmtn ict s)srumur oo4apenmfctatfa2elu pnt0 lxrio oydfp r u i ()s2tmir oodllee fvsa(f rumu  ot0alx  iciydfs2ea(msn(0aetoxo3ia1optran il()trtoxm oudam   fctlsfs2tmumo;o0oeeoif3iyd s raums;u)alxnmrctadoaDeaues;(  2tm(m3nydoltnmnvsa( srtmu  ;o1aetn o3ilt m rl( s;()altnir iydop ranvs;s t2toir oudal n neta(f Drmxmont1tee mf3iasfa2umn o u)aetoif3iadoa elivi;t0trumxm3oodlmt lfetlsf ruaxrpno4oltnmo3tadlmDemuvo;u4tleoif3iy1fm rln i;t)t2uoxo oudlptelfctas  rtm(  ;u0texnmiciltfa2ulnvo (4 rxnxfcty1opt lieils) rtoimpio4lme mnei () rtrump;t0aexoioeilt s umnmp;t0 rtnmf3oydoa e ivi;s srxmxmpnodlmtn fvi t) Drrum nu0olx mi3iasfsDean sn(4 etomr3ty1fmD  u s;s seumio iy4amt  fvt ( sDtrxro;t1tltnifciyt m ul(mpn() lermf tatlp  li olt)trxmim iudlmtn nvs ( sDtaxmpou1oeeomoctas a rlums u0aeenmf3iatlptr uvi s)srxoxmpou1am nlivtl( aDuau pno4alxoif3iys s raumo;t) etoxf3tydlptr u i ()sexrxo3nodope mfcsas)sDurxmpnu1oetnmietys s ra( snu0artnxr3tadfpDeluvi;() 2umiopnudlpenlicsa()srtmx  no0oetnmoctltlm2rmn o (0 etomfcio1opD auvo;( texmim oo1al nmfeta( aDtmu pno4tpe mf3tasfmDuln snu4trtrio3ta1om  aneslt0t2xo(r oo1ap  mnvil(f ruaxrpot0ope ii3tld m2uanmp ()trxrxf3ty1om eaivol( srtr(mpiy1openmnetas sDuaumpnu0tpxomocias s ran onu4 lenmrcoodfat au o s0seurim3iodlpeelneta()aDrru pnt1ope mo3iadla elnmo t4tltnmo oa1fmte uvo ( tetrir iydom n ncia(f rua(  ;o1alenif3tytfm2uaumo (4 lxrifciodoatelieols) 2trxm3iu4al nliet sfs2umum ou0aet mieias sDemuvp (4areoxf iatoa elivs ()texmim3iodope micia( aDtm(m oo1olt if3iadfm2el( o;(0tetomr tydlpt  nvsl()t2trxm3ny1lle mictl(fa2ur(mp;t1aeeo oetasls rm(vsn(0 rtnmr3iodoa  lu sls)t2umir iu1al e fvt ()a2raxro;t1tet mo3ildfm umuvs;u4artnir tatlm r ieslt  2to(m3iu4op emfcils)srtru  ;u4apx ifciatfm2ea( pnu4altrir oodfpDraivs;s)srurxm3oydomen fvsl( a2rruro;t0aee  f3iydfsDel( s u) lermo tydfa   ivo;t0sexoxmpoydlmee nvil() Dtm(mpou1tptoifeiytls2elu s u4treoif3oatopD anvo t0 2tr(rpio1ame  ies t)s2tau  ;o4aexnio3tls s uanmo;u4 leomo iytfmDe i o ()teto(o3oudomtemnetlsfs2ra(r ;u4tex mfciaslm2ulu onu4 rxnio3iodfmt livs (0s2xoim3oodole mivias  Drmu o;o4oleniictad m emn o;(0tetnirctydoate nvsls  eur(o3io1lptn nvi s)aruaxr ot1apxomo3iyt aDrluvsn(4arenmociydlp eaivs t0t2um(m iy4om nmnvslt s2rru ono4tetniicilsla2elnvont4tltnxr to1om r uvs;(0 2xrxr nodlltnlics t arrrxmono0tpx  oeiatls el( p;(4 etrxr3iadom r ueols trtoxopnodolt miei ( s2rau pno0alx  o3iad s ran s t4tlxnxf3iatoatrlnvs;(0 2xmio3nudap  mfcsl() Dtrum ou4apto feildla umn p;u0artoxr3todomDe nvo;t0s2trir3iydap e nvt t) Dtmx pnu4altoio3iadfmDeauvo;(4treniocoydfptrlieils)t2xmir iu4ol nmics sfartmur oo1opt iieiatls2elnvsnu) exoif tydfmDelivi;(0tetm(opno1am nlnes (  2rr(m ;u0opxnmoetytlaDea(vp t4alenir3iadlmD livi;t  eum(m3iu1ol eliesls)srtrxmo;u4tex ioeiytls umu p t)areoio3oa1lmD li sl(0trxrxmpiu1ap e ieilsfsDrmump;u4teeomf3iys aDul( snu4artrxo iadlaDraivilt0 rtrxm oodapen ncilt)sDraurpnt1alto octytfmDeanvp;(0 rxoircoydfaDraieo t) eurim3iudom n ieil( sDua(rpno4tpenmiciytla um(ms;u0arxrxo3ootopt  i ils0 2urxopnu1om n fesl( arrm(rp;u1olxniieiasls2ranvpn(0artoio3oadlmt lues;t seur(o iu4alt lnct t) rurxmp;u4aexnioeiatfs2rlnvon() rerif3oo1lmDeaieolt0 rtm(o oy4op  mfvt t) rra(ro;u0tlxoiictlsfa umnvs t0tleoirciytop ran o s t2xr(o3ou4am  liesatfa2uaxrp;t4aetnii3iys a uaump t0 rxoxocia1opt lnvs s) rxm(m no4lm emfcil( aDurumpno1optniociysls2uanmon() etoxo oadlmDe nei t)s2tmxrpoo1amt miesl(f Dtm(mp;u0tee mo3ildlmDrln o;u0texrxf tydlm rlu o (  rxm(m nu4ll  mfvtasfa2uru  nu4alx moeiltfs ulums;t)altrmf tytomteai o;() 2toir iydap nmfcsatfs2taum nu4aleo o3iysls2um(mont)aexrmrcty1fptr uei;s0t2xriopiy4apt livi tf 2tmxmoou0aptn iciaslmDraumpnu4tlermrcoytlm   n sl(0seurxr3iu1lp  lfes s  Dtmu pou0aet iicildfsDumuvo (4arxnir3iadlaDean sl(  rurxm3iydalenlnvs s)s2tmu oou4tltomfeiys mDuanvpn(4aeeomo3iodomD luvsls0t2xmxo3nydomt mneilt)a2ur(rpou0opxn ieiatfs2elu onu0aleoiocoytlat  nvs () rumxo3no4olt lfcsl(fs2rrx ooo4olxnifcilsfm um( pnt)tltoir3oadoptelieo (0t2xoxm oudom   iciat a2taur ;u4oeenifeiyt s2umnvo;(0alenio oadfptrln o;()s2toxmpoudop  mnvia( artmxmp;o1tpt mfciaslm eanmp (0 exnmfciy1omDelnei t texm(r3oodlmeemieils a2tmxrono0tpx mfeias a emu s;u0trtrir iy1latran s;t0teuo(r no4ol   fesltfa2ua(r ;o0tleoif3iydfm2emnvp t0trerxf tydoa ean o;s)setoiopio1llt  fcsl()a2ua(m no0tpt miciatfm2el(vs;(4trtnio3iydlmtrau i;t0texmxm oo4ole lici (fs2urump;t0tpx ii3tydls ulnvs;t4alxoxf oytom  liei;t0trum(m nu1amtnmiet () rua( oot4alenmoctytfs uanmp u)tltnmfciodopDeluvo s)s2toir3io4amee ivtl() Dur(  ;o4oetnmo3ils a2ulnvs;(0 etnmr3ia1omDraies;t0sexo(o nu1oltnliviatfsrua(moot1olx  octad s2rm(mp t0altoir3oadomDraivo;s  etrxo3ny1altnmneia( sDuaxr ot1altnmf3iad a2rluvs ()aexrmr oadlpDeln s s) rumxo io4ole mfct s  Drmxmont4oexoio3ildfaDrmumsnu4 rxrmr3io1opt an ols0tetmxr oo4aleemnct (fartrump;o0opxn fetydfsDeanms;(0aetnxf3io1lmtelnesls t2xrxr3oydopte ici t srrrumono1tlt mieild m raumpn(0alxomf3oo1fmtelnvo;s0s2toxrpnudale  feta( aDtrumo;t0oltnioctytla2emuvpnu) ltnir oo1oat  u o;s srto(rpiy4opeemnvil() rrr(r oo4oexnmfciydla2eauvpn()aetrioctydlmt aies;(0srxr(o oudlmee fesatf rrr(m nt0tpxnmfciydls2rl(vpn(0 eeomo iodlaD anvsls)t2tmxm iy1am elfct (fsDur(mooo4tet ioctlt m rmn onu0trtnmfcootlaDr u ol()s2uoxopnydaptnlici s  rraumooo4oexnioeias aDran onu0 eeomoctydfpD lnvsls0 exo(r3ny4lptnlfesasfaDra(root1olxo oetldfm2uanmp;t0tlxnif3tatfmt  ieo;s srtrir ou4lpt lnctas sruaxmo;u4oleoioeiysfa2em(vpnu4 etrir3iy1fm elnes ( trxmxopnu4ll n fesl(f rtm( o;u4tle mieiys m2rmnmp u0arxrxf3iy1oa  auvo ( s2urxm iydll nliesl()s2ta( poo0oleoio3iadlm2ul(vp (0 etomr oo1oat  uvo;t0 exr(r io4ap nmieias a2ur(mp;o1oet  oetadlmDel(vo u4 eeomo ia1fmDe u s t0s2trxm nu1ll n nvsa()sruru ont4oetoifeiaslm2rmnvo;t4aexnmo ta1faDr ivo ( srxr(m iudll   fesa( aDuax  nt4opt  ictatls eanvsn()tlxnmr3ty1opteai o t0seurio3iydlpee ncsls)a2ra( pnu0opeomietatfsDua( p (4 etnmo tydop elieols) rum(opoy1apt micias s2taxrooo4tet miciyt m emnmo u4 exrir3oatfpDran s;s)seurir oy1al nlietas)arrauro;u0ole moeiltlaDran onu)aetomo oo1fptrlu sl()teurio3ny4aptn nvtlt a2rmxr ;t0opxnmoeiadlaDranmpnu)artoxf totlpt liei t) etrirpoydop   nctlt srtax  oo1alxoioeilsfs2em(mont0trtoif3oy1lat auvs s t2xoxo3oodlpe liet sf 2taurp;o4opxoiieiasfs2uan p;t0teenxo3tydlm e neils0texmxopnudlltelieslt) 2uaumpnu1apt io3iltfs2ra(msnt) leomo3ta1fm eln ils sexrio oo4ap emivs () rumumono4tptomoetls s2uaumo;u4 eerif3totfpte n ols  2uoiopoudom e fetl( sDuru ono4alx  oeilt m emnvo;u)trtomr iodfmDe i i;s)trxmxrpoydapte nci ()aDrax  ot4aet mictlsfa uau p u)arerio tadlate nvil( s2urio3oo4ap n fcia( a2raxr ou4optnmfciat m2uaumo;(0trtnxf ty1fpDr u ilt0s2tmirpoudlle mivil( s2rr( pnt1alenifciys aDeluvo u4 renmr3ia1oa r i sl( srumxrpiu1altelnvias artmumpot1opeo feiaslmDemnvp;u4trtomoctotla elueo t0t2uo(m3ou4opee ncil( srumu pno0oleomociadls eanmo () etnmf3tadfpt  ies;t0texmiopoy4ap elfes t)sDra( pnt1alxoiociyslmDelu p;u) ltrircia1lpD ai i s0s2umim io1opeemnvslt)arrr(rpot0tptnmieiatla2umn s (4teeoxo iydlat  nvi;t trxoxr3ou1ape mnesltf 2um(m ;u0apx ioetydfm2rl(vpnt0aeeoif iytla  aues;s trxo(r ny1lpeemnci tfsDrau poo1oleniieiadls ea(mp t0 rxomocto1laD ai o t0texmim3ou4al nmfcsl(faDua(r no0oeen octyslaDrluvonu4trtomo tytlmtranvs;()s2xm(o io4lltemivt ()aDumxm ot1tleoioctld sDrmu o;(4trxomf3io1fmt  uvi t srtrirpnu4lpeeliet s artaurpnu4oee  icildfa2em( s u4alenmoctotopteaieo s)t2xmio3iu1ap   fciat s2uaumpnu1apxomiciat mDeanmont0alxnircoytom eluvils s2xoxo3ny1olt  ncsat aDurxrooo1tlxomoeild a ul(vs;()tleoifciydfa eaueolt0t2umxm ou4opee net t s2rm(rpou4optomfciadla ua( o ()trxomrcootoa rai i (0trtm(m3iy1alenlfet s a2ta(mpnu0aexnmoctat a2um( sn()texomr tytfp e n ols) exr(opoo1optnmfeslt  2rax ono0opx mf3ilsla2umumpnt4altrmr3tatlp r i o t  rtoxr3no4lpt mnvslt)s2ta(mo;o0oet  ieiys a2uanmpn(4arxrmr io1optraiei;()truoxm iu1amenlictl(  Durum no0teenmiciydfa eauvs;u4tetrmf oa1lptr uvilt0t2tm(o3oo4lm  mnvsatfsrrmxrooo0tlenmi3iysfm2emums;t0texnio to1op  livols trur(r io1lmtnmfctasf Duaxr no0aet  f3iatlaDumu o;(0 ltoio ia1opDrli s ( t2toxm3no1om   ivtlt a2uaxrp;t1optoioetld s um(mpn(4aexnmo iy1fm raiei t0trur(rpio1lpenmiei sfsrtmumo;o0tpto ieiat mDrl( o u0tetnxf3oatfpte n o;t)srxrimpiu4oleelicsls)a2umumpou1opx iictytlm2umump;(0 rerxf tatlp e nvi t srxoim3ny1apt  feiasfaDtr(  nt0ope mi3tys sDelnms t0 rxnxo todoateluvi t trxmirpiydll emnetls)aDum(mp;o4oet iociytfaDrmuvs;() eermrciotlpDrai o;(0t2xoxm nu1ope  nvi (fs2ta(  nu0tleoiietys s2ran o t)treoif3tadfatr n il(0 exoxr ou4amt liesat)aDtau  ;t0aetomo3iatfmDul(msnu)trenmo3to1lmD aueo t  rumxm ny1lmt lfeslsfsrtaxrono4alx iocildfa uanvpnu0 rxrxr oytlmD lueo s  rurxr3nu4lpt lncs (  2trx oot1olt mo3tad aDrmn s;(4tetrif to1fa  au slt truoim3oydlptemfcsl( sDta(rpou1tlxoioeilt a ulu pn() eenxr oodfm  lnvi;s setoimpiudll nmfvtltfarrmumo;o0olenii3tadla rlnvp (0texoxr3ta1lmt ln s;s0trxoio3nu4amtemncilt srtaurono0aleoifeiatfs el(mo (4artnmr3oa1fm  luvslt srxmxm3iy1ap  mfvia()aDrru  nt4tpen f3iad mDrm( s;t0alxoxf3to1fateaneo;t)seuoxr3ou4am  lfvs () Dtmumpnu1alxo ictad mDulu s t4 etomf3oodomD au o;(  rum(r io4lmtelnesa(  Dtrxmo;o1alxnioctytlmDeanvs t) eenxo3iadla  au o;(  exm(r3oo1amt livi t s2uru  ou4apxoiieiatfmDeauvont4artrxf3ootfaD anvi;(0 rumxo3nodap  mnei tfsrua(m ou1tpeniociyd mDulump;u0 eeoio3todlpDelu i;t)teur(o oudamtelncilt)s2urxroot4oex  i3tlsla2rmump;u4teerif todlmDr ues (0teurirpoo4am n fcslt  2um(m ;o0tpto o3iatlaDrlump (4areoxf3tadfa rau i;t)texmirpio1lltnmfvsas  rtmum ;t1opxn fcilsls2emnmo (0aeermr tadfm rluei;s) exrxrpnydomtnlfet t s2urx o;t0tet  i3tasfa2em(vs u0 exrmrcto1fpte u s s)s2trim ou4altn fct t  Drm(roou0opxnif3iytla2rmn p;u4trtnif3oydfpDr ivi (0 rxmxrpiydapee fctl(f rtrxm no4tpeo oetydfm2ul(ms u4 rtrmocia1opD anes s0trur(r iodop nlfcia()srtmxm ;o1tlxniieiys m2rl(vo;t0teermrciydlatraneo s)teumir3iy4op  mivtat) rrruro;o4oee  ocilt s2uln s;(4teeoxr3iodoaDr ivolt t2tm(m3iu4aleelnvt t)a2rm(  ;t1teeniociyslmDea(mo;t4 rtnmr3tatoa   uvi t  2xoxopoy4altnmivsl(fartmuroou0tptoio3ildfs2elnvp t) rtomfciadfatr n s t s2tmirpou1ol n fvilt  rtauro;t0tlxnmociyt m eluvo;()trxrxociadla r n o (  rxoiopny1lme mnetat a2uaur ;t4opx  oeiydfs uau s (0arxomo3tydfp e neo s)trtoirpiy4oltn nci sfsrumu  ot4apto ietas s rmu o t0altnircootomDeau i () rtm(mpoudape mncslt) Drm(ro;t4ape  feiysls2rauvp;(4aexoxf3iadlp  au o ( srurio nu1al   neia() rrm(r ot4oet mieilt m uluvo t)texnmoctotla   nvs;t) rxmxopiy4lmt lfcsa(fsDrmumonu0tptoif3iytls2ulnmont4aetrircoydomtranei;t setrio nodapee ieslt  2tmxm ot0tlxoifeilslsDrl( snu4 rtrxf todoa  lues s)texr(rpoy4altnlnei (fsrur(rpnu1oee miciadfa2raumonu0 leomf3iytop raiei;t sexmxo3no4lp emnet tf 2tmu p;o4olxn iciat a emnvs ()texoxf3iadfm r uvsls0srumirpoudlpeelfviatfaDtau p;o4tpxoiieiltlm uaumpnt4tleoirctydomD  i s s0sruoio3iodlle  nvta() rrm(ront1teeoio3tlt m2ul(vpnu0trxrxf3iy1fpDeaneils)t2tm(rpiu4amenmnesat)a2ur( o;u1tpxnmietat mDra(monu4 lxnmocoydfmDelnvs ( s2xrxrpou1lp  lfvsat sDrm(r nu1tpenmi3iltfs2ranms;t0tetnmr oo1om   neols) exoxr oodole mfet s  2umx o;o1tlxoifctytfa eln s t0 ltrxociydlp   iei t s2xrimpiudlme  fvtlt srua(mo;o4tltn f3ilsfsDuanvs;t)alxoxf3iadoa eaivs;t0 rtoxopny1llte fvsat)a2rm(rpnt0oexnmfcilsfa ua( s;(0arxnmf iotfmDeluvs;t trtoiopno4aleelnes s  Dtrur no0oex io3ias a2em(mon(0aeeoxfcoa1lat  neol(0 rumimpoo1lp e fet t sDrmxmont1ale ioeiysls2eluvp t)arxnxr iodop e nesls) rtrir3nudopee nesls s2urx  ;t0aexnmfctltfs2emuvp () rxomfcia1oaD an i;t0s2tmirpoudopt  icilsfaDrmxmonu0teeniietld m2em(vo;t0treoxfcia1faDrauvs;t)teuo(rpoy4am  licils)aDta( p;t4oet iiciadla ranmo t4arxoir3tadfm   nvs;t setoio3oy1apt lieilt)arum(ront4tpxoifctadfs2uln p;t0aexomrcoytfateaneil() rurxo3nydame mnvt t  2rmx pnt1tpt  oeiasfm2umn p (4 ltrifctatlmD au i t seuoxmpoydam nmnviatfsDtru p;t4aeen ocildlm2uaump u)tetrxfcty1omt  nes;(0 rto(mpnu1olee ietl(fartrurpou1apxnifctyslsDrmnmpnu0artoirctodfpD lieo s) exo(m3ou1alt lnetlt)a2rr(r ou1teto f3iasla emnmon(0 eeoxf ty1lp eaneols0trxrio3no1altnmncsatfsrrm( oou1apenmi3tlsfsDra( ont0teerxf3ootfat  ivs s0sexm(r nydome lfet s a2tmxm ;u4aee  feiltfm ul(vsn(4 exoif3oydfp eln sl(0 rtr(o3oydape livs t s2um(mpnt0oexn feiat aDrmuvs t4trxnmrcoydfaDrluvsls) rto(opiy1amt mnes sfaDrau  nt4tpxnmiciyt sDel(msnu)aleoxo oadlmD au sl(0sexrxm nu1lle  nvsa(  2tmu  nt1tetomiciyt sDem(vo;t4altnxrcta1om e nei (0srum(m3iudlp n nctlt  Dumu p;t4tet  i3iltfs umnmsn(0texoirciadopD anes (0seuoxm3io1lp  mnetat)a2ta(mpnt4aptomiciatla umu s u4tlenifciatlp rlieo (  rxrim3nudalen nvi t) Dtr(mont1olxnifeiyd m2ran snt4alxoxr ty1fatr uvil(  2urir iydomeelncsatf Drm(mp;t1oexoifeils s2rm(vs t4tlerxf iydoa  aneslt t2tmimpny1ole micslt)sDtr(mpnu1tptnmociytfaDra(vonu0artnmr iodfat aiei s  rurim ny1olt lfctat)arumxr oo0tpxoiieiysfa eauvs;t0aetrmrctatlaD au s s  2trimpoydoltemicil( srraxrpnu0oexniocilsfa2uaump;t4altrif3oy1lpDrlnvi;( trtrxopoo4olte ivslt s2um(r nu0olx mfetlslmDea( o;t4aetnmrcoa1fa ranvi;()texmxr oodamenmnvil() rta( ont4aee  i3tatfmDean s u4 etnmociytlaDeluvsl(0teurirpiy4lp e nesasfaDuru o;u4apxnif3iytfa uln s (0artrmo3oatfpD anvsls sexoir3iy1altnliciasfa2trum no4oet miciyt s rm(mont)teeoxf3oadfmDe uvi ( srur(opou4aptemfcsa(faDua(r ot1apxnmfetltlsDrlnmp;t0texrxo3iatlmD lueols  eurio iu4am elnvtatf Dtr(mo;u0tee iictadfa ulumo (4trxrif3oodfpDranei;t s2um(m iodoltnlnesltf Dua( o;t1tlxn ictltla uau o ()trtoifcoatlmD ai o s0srur(mpoodale  ics t)s2urxro;u4teto ieias a ea(vp u4tlerxr iydopte n ol(0trxmir3no1alte fctl()srtrxmp;u0aeenio3iyt aDuau p;(0 eerif3to1omDrli i;t s2xrxmpoy1lm  lnviltfsrtrxmp;u4tex  ietltlm elu o u4altniocoo1lp   uvs t0trtoxopnydole mfvilsfsrua(m nt4alt moeiltfa2rlumo;(0trenmr oodlatranvi t) rxmxm oy1al n icil(faDtmu p;t4tex mocild s umu p u) rtnxf3to1fp eaues;( t2xo(mpnu1openlnes s srrmump;o0tle  f3tas mDrmu sn(0 rxnio oo1la rln i;s0srxrxm iu1apenmfvs s aDrm(r ;o1aee mo3iatlm2rlnmp (4tetrmr3ia1omteaiei s0s2xoim oydlmtelfci (f 2ururoou0aexniictldfa ranmp u0aetriocoy1fp e ivi s srxoirpoy1apee ics (fsDurx p;u1tpeoii3iyt sDeau p u) lxnmocoa1oaDeaies;s) rtmio3nydole mfvsat sDtrxmp;u0aetnii3ilt m ul(mp;t4 rxnmfciotlat  nvs;()s2xm(o3io4amen fcilt s2rr( pnu1tpxomo3iyt aDeaumon()trtoir to1lpD lneils s2xoxo3nu1opt lfet ( aDur(m ou4optn i3iasla umu s;u0tetnmf ia1fpDraues;(  exmim nydal elfesat sDtaxrpou1apx mfetyt m2ul( s;u0altnmfcoy1oa e ies;t0srtr(r nu4lm elfes s arta(r ;u1aet ifctaslmDumums;u4 reoirciotoa  auvsl( srumir3iu1opt liet () rtr(m ;t1oltomo3iasla2umu pn()areoio tadlmtr i il()setm(mpio4lm nmicsl(fs2tmxm ;t1altniicildls emn pnu) ltrir ia1om e ieols trumirpiu4altemictlt)s2umxmpou1oeto fciysfa rln s (0aexrir3oo1fptr iei t0 rto(opny1apt mietasfaDtmumpnu4oeeomo3iys s ran pnu0 reoxociytop e u ilt  rtmir nodamt mfeilt)aDtm(mo;t0teeniocilsfaDea( s () lxrmf tytoa   nvo s0t2tm(opny1ap emnet s srta(r nu1tetomf3iydfm uau onu4 ltrxr3to1opteln il(  2xmio oy1amtn fvs ( sDraum oo4oet mocias m2eaums;u0 ltrxf3tytfm eai s s s2tmxrpiudam n ivt ( s2umxmpno4aee ii3ild s umnvont)tlxoxf3totfmteanes t0trumimpno4lp   neias) 2um( o;t4tetnifciydls2umumpn(4tetoif tatlpteaues t t2trir iu4apeemnvi (fs2tmu o;o4ale mi3tydfmDemnvsnu4 rxrio iadoatr nvi t t2um(mpnodolt lncs (f rrmxmo;u1alt mfeiydfs2ea(vs t)aeeomocio1opt li i () rurir3ny1ape  iesls)sDtruro;u1oex  o3tldfmDum(von()teenmfcio1om e uvs s0 2xmxm3nudlmtnmivtlsfsrrrx ono1altnioeiat m ran s;t0arermocio1lpDe neilt) eum(r3ou4aptn nct s srrmuro;u1oexo ieilsfs2eanmon()arerxr3iadoa  aieilt) etmir3oy4lptnlnvsas s2uaurpno0tltnioeiytfaDemumpnu0tlxrir oo1omDrluvsls) rto(m ny4omt lictltfsrrmxronu4apeniociytla2uaums;t0trxoir iodlm elu i s  rumio3no4ome lnesls) Dur(rpou0apenmociyslsDrmnmpn()tlxnio oatlateau i ()tetr(mpoy4op  mnctlt) Duru  ;u0tpeo f3iyt a elu pn()tlxnmrciydlm  an o;() rtoimpiu4ol elivtatfa2tmu  ;t0oeto ictydls uln p t0tleoxrcoydoptrln sls0s2xrxo nu4lle  nesls)s2rr(mp;u4oet  i3iys m rm( s () eeomf3oydlatr uvol(0teur(r iy1al  lictlt srta(m nu0tle ioetltfa emnmo t) rtomo3iadfaDranvs t)t2trir3oy4lm  mnes s  Dtmur nu4oeen o3iltfaDumn ont)aleoxo ty1oa eluei s) 2toim3oodomeemnvtas aDuax o;t0alx  f3iasla2rau p () etnxf totopt  nei;()teur(mpoodlme mncs tf Dta(moot0apt  f3iatfaDran o;u4 rxomf oa1omteliei;( t2xmxm oo1lptemnctlt) 2trx  ;t1oetn f3iltls rl(ms;t4aleoxoctydoat  ieo;( t2to(m ny4lpe  nctasf Dtru pou1tlxnifetatfmDem( snt0 exnxf iodfp e ivols  2xmim ou4ol emneta(fs2rmumo;o0apxnmo3iat aDumuvs t4 etnxocoytoptrauvi t0teurim3ny4ap emfvtls sruaumoot0oexn fctatfm ra(vs;(4arxrxr3ia1fpte n s;()sexmio3io1ol  lici t sDum( ooo1optomi3ilt m2ra(mpnu) rxriocoatop rlu slt)s2tm(o ou1llenmivt ( s2rmur ;o1olenmieiadfm umnmp;u)texrxf iadlpt aieo;s setmxmpnydomt mivsl(fartrxront0altn ictydlaDuluvp;(4aexomr3iadfm   i i (  eur(mpoodlpenlfvia(  Dua( oot4ope ifeias s2ea(mo;(4 renmf ty1laDran i t srxmimpoo1lmeemncsls) 2tmur ot1apx  ociadlsDemumsnt0altnio tadfmDeaieols0setr(o3no4lmt mnetasfs2urumonu4opx  f3ildla2rlnvp u)areoif ty1fmt anvi;()tetm(m oo1am elivt sf rumxr ot1tpxniieiatfs2rl( o;t4arxrio ia1omDrluvsls) euoiopou4ame livslt s2rrumonu4tet mf3tas s2ran pnt0alermf3iatlpt  nes;(0s2urio3iy1lmtelietltfarrrxmpnu4aeeomoctadls emnvp;u4 lxoifcty1lmD  ieol() exo(r3ny1oleelfetatfs2umx pnt1tlenmfcias aDemn p u) lxomf iodfp rauvo (0t2trio nu1ame lnctas s2ua(mp;u1tltnmoctlsfs uln s u0tlenmo3oodlaD aies s0trumxr iodlm n feil()aDuaum ot4tee iocilt a2ul(mo u) lxnmf3tytfm e neo t)teuoir3oudlp n fei t)sDrmx  ;o0tptn oetaslaDuanvon(0aexoif3oytoptrlnvo;( tetoxopnu1lmee fcslt) Dtaxr ot1aexnifeiatfs el(ms t)texoxf3ty1lmD  n o;s  2uoxm iy4om emfes s s2tax  ;u1tptnifciys s um(ms ()tlerxrcia1lm r ueil(0sexoxr3iudllenmncsa(  2rr(mo;o1tleomieils a rau ont4tetnmf3oodlatrauvi ( teum(mpnodalt miet t  2rmu onu0apt  ieiadfm uanvo (0trxnmf3oy1omtr nvo;(0 rurir3iodaltelnei s  rtm(rpnu1aleo f3iatla ea(vs t4tltnir iatfateauvo;s0s2xr(r3oo1aptemfvsls) Dtm(mpot1teeo ictlt sDumnvp;u0 rermr3iodlm ranei t)trur(m ou4amt  fetat a2tmu onu0tetomietls m2el( sn()trenxo tadlm e ues;() ruoxmpoy1omtelics (fsDtrxrpoo4ole mf3ias mDrm( o;() exrxr3ty1lat  nvo s  etr(rpno1olenlnvsasfs2ua(mono4tpen ictydfm rln p;t)trenxr io1fpDeanvs s)srto(mpiodol  micsat) Dra(mpnu4tpt  octytlm ea( s;(0 rxnxo3iotlp  lnvs t0s2xoir nu1lpe lfcil(  Drrurpno1opeo ieiyt sDem( o;(0tlxrmf oy1fm eli o;(0 2xrim ny4lpt lneias  Dumx poo0optn fciltla2rau pn(0 etomrciadlp e ivilt0t2xm(m no4al eliesasfa2ta(mo;u0tee iictyt sDelu snt4 rtoio ootomtranvi ()t2tmxr3oo1om   nesls a2rm(r ;t0tpxn ociydls em(mp u)artrif iatoat  i o (  2xr(m oy1omeelfeil() ruru o;o4tet ifciltfs rmums;() reoxr3ootla raieolt  rxo(mpio4ap emnvt tf Dtru o;o4tltnmf3iat s umnmo;()tleoiociodomte uvi s  ruo(m3ou4llee nesa() ruax  ;o1oltnmfciadls2ulnmo;(0 rtrmf ia1lat aiei;(0seum(r3nydlltnlieil() rumxmo;o0tee mfetytlsDuauvp () exoir3iatfm eluei ()teur(opnu1opt  nvslt  2tax o;t4aptn feiatlaDeaumo u4trxnmr3oodfptraueo;t) rxr(o nu4ole  netl( artmxm ;u0tleomf3iad s2uau snu) ltrmrcoodlpD aneilt)s2umxo 
\ No newline at end of file
@@ -0,0 +1 @@
+ivol(  2tr(mpoodomen feias  rrr( pnu1aetomfeiatfm ran pnu0altnxfctadoaD  nei t seumxo3iudal   ivt t srta(m ;o4tpxnmieiadla2uan pnu0tlxoxr oydoatrlneo;s0 2xo(m iudlpte ivta(fs2ta(moou0oeto oeiadla uan pnu) ltnxociy1oa r nes t) 2toxmpio1lpee ncil()a2tmumont1teeoifeiyt aDem( p (0 ltomf tadla  lnei s0 2toim io1lm e fvtasf rurxrp;o4alt  oeiytla2uluvo ()alermf iotoa rauvsls srxmim3io4ale  fvtlt  Dtrur ;u0tlt  oetyslsDean on(0arxrmo3ia1oaD lieol( teurxm3oydam  miesatfsDur( p;u0tpt mieiadlaDua(mp t)tltoxf3ia1fa eluvil( trumio3no4lptn nei (fa2ta( pnu4tetoioetasla2uau on()tlxniocio1lmDr ivi ( s2toir oudllt lictl() Drmur ;o4opeo f3tas a2emn onu0alxomr oy1fp e nes;()texo(r3oydll   fvi s)s2rr(m oo4aeeomoeiltfaDea(vo;t0texomr oa1laD  ues;(0srtrxo3ny4apeemnei t  Drrumpou0tpenio3tadla2ra( o;t0alxrif3iadla eaivs t0srto(r3nu4lp nmfeil()aDrm( poo0tpt ifetldlmDel(mo (4tlxrmf3iytlm ean il()seum(r oydapeelfct t sDumxr no4aetnmo3tadfm rm(vs u0aleoxr3oa1fpDr u ilt) rtoim iy1amt  nviatfsruau oou1olt mietatla el( o;(0altnio3to1lmDranei t) etmxm3no4om   fvsasfsrrrxrono4tlenmf3iydlsDumu s () ltomf3tydoa   i i s0 rur(o iy4lle mnetl(f 2um(  ;u4teeoiociatla2ra(vp;u4 exoio todlmDrli slt  exriopiy1lmee nct sfaDrmxmoot1aee mocias mDel( s;u4treoxfctytlat livsl(0 eumio3iu4om elnvsa()a2tm(ront4tpto fetltla2ean o (4teeoxfciadlatr iesls)srur(mpoo1amt mietlsf 2rmumooo4apeoifeiadfaDuln snt0aexomo io1lpDe n ols  rurxm iy1ll nmncsat a2urx o;u1optomicilsls emnmon(4trxoxrciatfpD li o;s teuo(opou4apeelncsls  ruau pou4tltomfciyt s ul(mp u)trtoxrciy1lptrluesls)setmirpiodoltelict t)artmu pnu1texo feiltls2ranvs t)altrmr tydoa e nvi;s  rurir ny4oltelfvil()a2ur(rp;u4tptoii3iys sDrlu p;t) rxnmf3oatlm  livols) 2tmxmpou4apt lfei sf Dur( p;o4apxnmo3tltlm2rmums;t0 rerxr3iy1fa ean o s) 2trir3ou4alenlies sf 2trxrp;u1aetomi3iatls uanvo;(0 exnifciotlmtr u i;t)trur(m no1lp emfvsls)a2ua(ronu1alxo octldfm2ua(vpn(4tlxrxocto1laDeauvils0 rxrirpoy4lm   ics (faDtrx pnu0oee  feiat a2um( pn(0 ltnxfcto1fa  luvo s  2tr(o nu1al nlncsl(  Duaxrono4aet mfctlsfa2rl( s;t0altoxf3io1omteaneilt0 eur(r3iy4ol e neilsfaDum(moou1olt moctldla emn p ()trtnxf3totlaDeaivo;s  rxmxr nu4aleelfet t)srrmur no4ale ioctls sDrlnvp;()tltomo ty1opD luvo;t  rum(opoydoptelnesa(fs2umum ;o1aetoifeiysfs ul(ms;u)alxnmo3iatfmtrlnvi t0 ruoxo no1lptnlicsl(f ruax p;o1altn f3ildlaDeanmp u)altnmo3oydfm e uei;t)t2tm(opoydameemnvt s sDrau ont0tlt if3iysfm2uau pnt0texnmrciatlat anesls)teuoxmpiu1ole livslt)sDuax  no4olt  feiyd m rlu s t4alxnio3totfaDelnvol(0t2xrir3ny4lptnmfeilt s2taxr ou4tpe  ieiysla2ra( s t4areomfciadoatrlueo;s) 2tr(o no4omeelictat arum(mpno0tptnmf3iytfs rl(vpnu4tlxrxo3io1oa  lieo (0trumim nudome  iesas)sDrmumpnu4tlx ioeias a2um(vp u)artnif iodlaDr ueo (0 etm(mpno4lle  ieilt a2ra(m ot4altnio3ilt a el(mo;(0 ltoxfcia1omDraivilt0 rtr(r3nydam nmnctls)srrrxrpno0ale mictytlsDumnvs t)treoir3oydlmDrau ilt trumir3oy1om emnctl( sDurxmo;o1oexomociasls rl(mp t0 etnir oytopDelues;s0t2umio3oo1ole lnvslsfsDurumpot0aeeoifcild s2rlums;t) lerxocio1omt lueo;(0 eumxm oo1ap e fctat) rrm( oot0altnmoeiltlaDrl( s u4teenmf3tydoaD anvs;t sruo(r3nodlm nmneta(  rtm(m ;u4aeto feiyt s2rl(vs t)trtrxo3iadfateln ilt) etr(mpio4om nmietlt  2um(r nt0aeeoif3iasfm umnmo;(4tetomf oa1lm   nvo s)t2xmimpoydlmt  fvta(  2rmum nt0tlt  fcild mDum(mo ()tlxnir iydlptr nvs t0teum(o3iodamt lfes tf 2rru o;t1oleomfeiyslsDrmu o;u4 ltoio3iodlaDeln il( t2uoxr iydaltnlnvs tfaDuaump;o4oetn feiat s ulnmo;(0 lxniocoy1optrlies;()t2xr(o3io1opeeliesls  rta(moou4alxniictydlm ulnvo;u)teermf3todfp e ivs;s)trtmio oodlmt lnet sfa2rrx p;u0tet mf3iysfsDem(vo;u) rtomf oytfp r neo t0sexr(opoy4lm nlncilsf Dua(mpot1oetnif3tas mDea(vp;u) rxoircto1fmDelu i;t  exm(mpoy4lltemfvta(fsrumxm oo4tlto fcias mDraums t4 etrir oadlatean i;s  rxrxm oy1lpe mncils) rur( ont0tpxo ociadlaDrmn s ()arxomfcia1omDrlies;s s2tr(mpiy1lp  lnvsa( srua(r ;o4alxnmoctat a2em(mp;(0aetnio oatlatrlnvi;t  rxoxmpoo4lltnmfcs (farua( pnu1tpx iietyt m2um(vo;(4 rxrxo iatoaDe ivi;s) exmxr3iydlm elfetlt)sDraurono1tpx  fetadfm rlump u0 reomf tytlatr nvs t)t2uriopnydaptnmfesa(faDur(mpoo4apxniiciaslm rau on() lxnifciatomt auvs;t)tetoxo oo4lm e ics t artrx p;u0tpeomf3tlt m2rmu pnu)tltrif3oydfm elivils  2tmio ou4aptn nvs sf 2rrxrpot4apxo octyd m eau s;u0tltoxo oatom rluvs;s0s2umir oydap n nvtls)s2urx o;t0oex mo3iatlsDrmu onu0 eeoir ty1oateaneilt) euoxrpoudopte ivslt)sDumx  ou1aptoifetat a2emnms;u0aleoir io1lmDranei (0t2trxo3nydll elivtls aDtauroou4ape miciadfm2uanvo;t0tetnxo3oydfm   u s s s2trxr oo4lpt mfeilsf rtax pno1apenmo3ildlaDrl( o ()trtnifctydfp rai s (0srxrirpnudap nlfetat srra(mpnu1aptnioctasfsDul( s;u)tetnio tydfmDe ueols s2uoir nydolt  nvia(fsDtmumonu4tetoiieiyt a eauvs u0trxnxr oodfptraieols t2toir3io4op nlfcsa( aDrru  no0aexoii3iad mDrmnvpnu)areomo3oatlptraieil() 2xm(r3ny4altn nvils srumu  ;o4optn fciad a2umnmpnu) rxomrcio1fp e ues;(0tetmxrpiu1alenmneslt)arurxm ;t1olxoifetasls umu ont4tlxrxf3oadfm r neolt0srto(m ny1lpeelfcsas  ruau  oo0aeeoii3iyd aDum(vp u)teenxr todlmDr ueols)teuo(m3oydolee fet t  rrmumo;o4tpto o3iytfs rlnvonu)aeenio3iotla  lues t sexoxrpnydopt lfeils)aDrmxrp;u1tex  i3ils mDeanms u4alxoxr3iotla  aueo;s) rxrim ou4lpte ict t)arurum ;o1tpxoifeiytlmDeanvs u4aeeomo3ty1fate ieolt0t2tr(r3ny4ameelivtas s2ra( onu0apxo ocilt sDuauvs t0 etrxf3oy1om  an i;t0 exrxm3iy1lltemfei tfarururpno0apxnmi3tlt aDrlu s;u4teenio oatlateluvolt)trtrxo ou4oltnmncs t aDumurp;u0tpe iiciasfaDean onu0artomf oydlp eau o;( texoio3iodal elfcsl( sDraxmp;u4tptniocild aDrm(vs;u)aetrmf3iotoptrauvi ()s2xmxo iy1om nlfvias s2ua( pnt4olto ieiytfa rl(msnt0tltoif to1om elueilt)setrxm3ou4omtn iviatfs2rmuro;o1tlenmoctlslsDemnms (0trerxo3oo1fm rlueo;()t2trxopio4apee nvtas s2uaum ot4oeenif3ias s eauvo u) etrio tatlmt  uvi;()trtoxo3oo1al nmieiat)arumxr ;o1apeomi3iasfa rlu s;u4 ltoir ia1laDrlieo s) 2umxm3iy1lltemnei s)aDraumpno4tetn ocilsfs ua(vsn(4aexnir3iatomtrli sl(  rxoim iu4lle  fetlt aDrrxmpou4optn ieiys mDel(vs;t) etoioctatoptr ieilt  2tmim3nodll  mneiasfsDtax p;u0alx mfcilt sDua(vp () rtrmo3oatoaDe i ols)trtrir3iodape mict t sDuaurpno4oeeomieildlm2um(mp t)tlenifcoa1opD au ils s2xo(mpio4amtemnvia(fsDraxr ou0ale  oetltls2rauvon()aeenxociy1oaDrlues ( teumxr nu1lpt mfvta( a2rmurpoo4teeomfeils a uau p;u4treoxf3tydfa  li i s  rxoxm oudlpe  iesltfs2ra(r ou0tltoiociydfs2eluvo;(4 eenio oy1fmDe ieols)srtr(o3iudllee ict s) Drmu  nt0opt  fciltla umumpnt0tltoirctadlmD li i;(0setoxrpnodaleemfvta()s2rrx oou4texn fetltlmDelnmo;t4 rxrir ty1opt aieil(  2trimpny4lpee fetat)srta(mpnu4tltniicias s2ean o;u0 rxnmr3iy1la   ivilt0 eumimpio4ale mictasfartru pnt1opxnifctltfa2ra( pnt4 lxoir3tytfat  neol(  exmxr iodlm elietasfs2tmuront0opx  ociysfa elnmo;(0 etoxf3iatomD  i i;()trxrir iy1am  mici s sDtaum ;t4olenmoctatls2umuvp t0 lxrir3oy1opte uvilt  rto(r3ou1lpeelncia(  Dumu oou4tltomietldlm ra(vont) rxoif iytfmDeluvs;s setoxo iu4llen fct s)s2uaxmpno0oeto f3tatls2rln p;()teerir iydfa  luesls t2umio no1apt lnes s)artrur oo4alx  fciysla2el(mpnu4trtrxrcoo1oateln s;s)trtoxopou1am   fesas)a2rr( pno4tlt  ieiysfmDuanms u0aeeomr3oo1op r nvo ()trxmio ny4lp  mfvslsfsDtmumono0oexnmiciasls2ranvsnt4trxomf oatlmDrlivs s) rtmio3ny1op nmneilsfs2ta( o;o1tle mo3tadlm em(ms;u4aetnxociytla  li sl()tetrxm no4altnmivsl() 2tax  oo0opxoii3iad aDea(mo;(0trenmo totoatr u i t0srxmxopiudol  lieslt aDta(ro;t4tltnmoctyd s2ean ont)alxomr tadomD  u s t) exoio oy4al nliei s  2trxrpno1aptnmi3tyslaDeluvp;u)texoif iy1lpteaieol(  etoim3ny1amenlieils srtrx o;o0apx  fcildls uanvsn()texnmf oydlp ranvo s) eum(rpiy1am nlieta()sDrmum no4tltn f3iysfsDrmumsn(4treoxr totlpDrluvil(  exo(m3nu4lp   ivs tf 2uauront0openmfctltlm rm(msnu4 ltrxf3oatoat  ueo;s)srtr(rpnodaptemivtlt) rtax oou0optoii3tasls2elnvon(0artomr3to1lptrlnvsl()s2umxm oydam  lfetat aDta(  ou1tpenmf3tld s rm( sn() rxrxr3iodfa  livol(  rumxo oo1lle  feiasf Drrx ont1aex  ociadlsDelu pnt)artrxocto1omDelivsls0srumimpio1omte ncsas) rrmum nt4alxn ociytfa2ranms;(0artrxr3iytlpteluvil(0 rxoxrpoy1altnlfci tfaDraxmpnt0tle moeiytfsDuauvo u0 rxnmr to1oatraneslt  2xm(r ny1lmte fetas) rrr(ront4optomi3iaslsDra(vs (4 exoif ty1lpDrli s t sexrxo3nu1ope  ietas)sDurxr oo1tpxo i3iydls ran pn(4 etnirctadlaDrlnvs s)srtoxm3iydamee netasfa2ta(mp;u1oet moeiat m2umumpnt)treoir ty1lptrau i t s2umxo iu4al emivilt) 2urxmoot4aeeo feias aDemu s t4texoxf ta1omt auvo t)texm(rpou1ame  ict (faDra(m nt0texnioctls a2el(vo t0trxomrctadlaDe n o s0srto(m oy1lm eliet s  rumxm ot1openmietat s emn on() reomo3tydfatelnvs;s trum(o3oydol n icta()srtrx poo1olx  fciasfsDrm(msn()tltrio ia1op rlnvo;t  2xmxr3nodopt mnvs s)a2tr(rpoo0ape iicilsfaDrmums () rtnxocta1fpD an sls)s2xm(m3oodal   iesls s2rrx  no4oexnmfetltlmDea(mp;t0tlxrxf ootfaDeliei;(  euo(m3oo4lme  fctls sDumu  nu0apt ioeiyslm2emump ()alermr iadfpDeln s t)trxmxo no1lpee icslt)s2ta( pnu0oltomoeiytlm umnmo (0aeerxr3tytopD luvs;s)setr(m3oy4lm nlicil( s2taxr ;u4tpe mfcils m2ua( s (0 exrmf tytopD  iei;s)sruoxmpnu1om elnesl() rtrx  no0oeeniicildlm2rm(mont4 ltoir3iadomt  uvo ()sexr(r nu4omt livtl() rrr(rpot1openifciadlm2elnvpnt0aeeoifcoadlaDe i olt  eumim iodlmtemiviasfsrrax pno0aexomfctlt s2el( onu4alenmoctodop e iei (0t2xm(o3no1om n fciatfaDrau  ;o0tptnmictls a2emumont)trxoxr tatop e ivs;t) rurio nodlpen nviat) Dur(r nu4altoifetad mDem( o t)aeermr3iatoaDraieol(0s2xoxm3nu1om  mivtat)sDtm( ono4oetoiieiysls2uanmpnu4trtnmo3oodlm elu ils)srtoxrpiydll   ictat  2trur ou4olt micils m2um(msnu4alerif3iadfaDrluvolt sruo(r3no4omenlfcsl()srrrxront4tpt  feiasfm2ranvs;(4 rxomfcoadfaDraivslt trurirpiu1llt lnci t)aDtaxrono4tee  ociysfm2rmu on(0 rermocoatlpte i olt  eumirpny1omtnmiesa(  Dtaurpou0optoiiciydla rlnvon(0 exoifciatomt  nvols) 2uoxo nu4optelfcias sDrm(rono4aexomo3iadlsDuan o t) lxomocootlm ean s s0t
\ No newline at end of file
@@ -0,0 +1 @@
+nes;t)sexr(opoo4lleelfeta()aDtm(ro;u1aex ifeiydfm2umnmo ()aeenmr ootlm eanvo (  rur(mpny1om elnvsat)aDurx ono1aptn feiytfaDulu pn()texnxo3tatlat  neo;s tetrir3iodaleelnesa() Dta(moou1alenmfctys m rlu on(0trtomr oytomDeli o;s0 eumimpiy4lp elfcia()aDuaur nu1opt  fetatlmDemu s;t)aeerir3oo1oatean o;s0t2um(o3oy1lmenlnctl()aDrr(mont4altn i3tatfa2emums u)aetnirctadfpt  nei;s0t2urir3ou1op  mfei (  Dumxr nu4apxnmictad m rmumpnt4trenifcia1fpDrli o;(0texo(o3iu1altemicsat) Drm(m ;t4oleo ieiasfm ul(vs t) leoxr iodlpt  nvo (0 etm(m no1lptnmicias)a2uaxmp;u4olx  ociysfm eanmo u4alerir3oa1om e ueilt0s2tm(opiu1amee ivs s  2rrx ono1oeeomfciatlsDulnmont0artriocoydlmte ieolt)trtr(mpnudlp  lnctl(fa2trxmoot0oleo i3tyd sDrmuvp;(4aeenmf io1faDr n s (0 exrxo3oydomte fetl() Dtmxm no1ale mo3iasfa2rauvs;(0trxoxf ty1la   ueo;(0 ruoxm3io1omt livilt a2tmxmont4oee ifctld s emnms;t4arxomr3ootfaD anvo s0 eumirpoy4lltemncs ()sDum(  nt1teenio3tltlm2rlums;u4 ltnxrctytfp  auvo s s2xmxm3iu1opeemfes sfaDra(m ot4oeenifciytfm elumont0tetnxr oodlaD au olt0trxmxr3oy1ame mfvt (fsrtrx onu4tltnif3iysls2rmnmo;u4tlxrxfcoatlm ran s;s)s2tr(m iy4altelfeilsf Dtrxmp;o4aee  o3ildfm2raumpnt4trtoxr3iotlpDr ies (0s2umxmpnydomenmivia(fa2rrxm nu1tex iicildfs2ra(vo t)texnxf ty1fmDe nvs t0 2tr(o nu1lm nmiei sf 2trxr nt4alenii3tydfm2eaumpn()texrxo3totlp r nes s) ruriopiodllenlnesasfsDtrum no1teenmiciad mDul(msnt)arermfcio1fp  lieo s) eto(m3iy4amt  fvs (fsrua(ronu0oetomf3ilt m ulnmp;()trtomo3oadlmtr u o (0t2xm(r no4ole lfvs t) Durxmont0oet  fctas s uauvo;(0aetoxo io1omtr nei (  2uo(m oodamt  nvsls  2tr( p;o0oexoiiciadfs rln pnu) ltnxr3oa1fatrli slt srxo(r3io1olenlnvs s)s2raumoot1aeto o3tasfa2um(mp t0altrmf tatlp  aneils)truoirpoo4am n fviltfaDtru p;o0alenmicilslsDean pnt) exnmrciadoptr ivi;()teur(r io4omtelnvi tfs2uaxm no0tltnifciat s ua(mp () reomf3oa1opDr uei;t)teurxo3ny1omtemivi t) 2rruroot1apxn i3iltlaDua(mp u4 ltrmo todlpt  nvo t0 exrio oydlleelnvtat a2umxro;u0oexoioetytlm ulnmo t4arenxo iy1fp r nesls)texmxrpno1lptn fcs t aDtrurpno4ole  o3tlt aDulu s t4 etoircoatopD aivi t setrio3ou4ap nmies (fsrrmxm oo0ope iiciytfs2ranms;t0 exomf3iy1oa rlu i t s2xmirpoo4amte iei t)aDrruro;u4tlt  o3tyt aDrmu p t4tetoxr iydfm rluvi s) ruo(m3io4omee ncilt) rrrx  nt1opto oeiltlsDemumonu)trxrifctotopteaneo;s)s2xm(r3oy4al nmfct s  rra(rono1tltoifciysfm uauvont0tetomfctatfpDelues t  exmir3oo4llt micil(fsrrrum ;o0olenmieilsfm2emumpnt4alxrio tatopD  n o (0 rxmxm3iydapenmncsls)sDrru  ;o1tpe ifeiatls2rlnmo;u4tlxnio oodfp   u sl(0setmio iudamtn ictltfs2rrxro;o0apx  f3iatlm rmuvpnt) etnxo3iotlatrluvilt) 2uoxr iy4apee nci s a2ta(m ;o0tlenmoeiyd s2em( s (0 rtrxocoytfpt aieols) 2xr(mpiodlmen iei (  rtmxm no0oetn o3tldls uan o u)trxrif3oa1lm e nei;s)trxrxm3nu1ameemiet s)a2tmump;u4teenmi3tls sDuan p;(4alenmr tydfmt au o s0texr(m oydom e iet t) 2urxrpoo4aee mociadfs2emump;u)arxrxrciatlatelivi;(  rtmxopiydomen ivslt sDrmx  oo4tpenif3ildls ra( o;u4tlxrio3iydfpt auei;s s2tr(r ny4lpt  fvtlt)srtmxmoou0tpxn oeilt s umnmo u0 rerxr io1omtelieo;t0trum(o3iy4am n fvilsfaruau p;o1altnif3tydfs emump;t0alxomf3ootlpDr nvi;s0trtr(m oodap  lieil( artax pot1oet mf3iydlaDel(mp;(0 ltrxo iodoatrlnes;s0t2uoimpnudlptnmfctas artaur ot1olxoioeilt m2rlnvpn(0aeenmrciotlp eaivolt0teto(m io1am n nes s)srra(r ;u4aptniicils aDran p;u0tetnmociatopD lueo;s srtrxo no1aptnmneiasf Drau  ot4apeoii3iyd m ea( s;t)aetrmfcoa1fpt lieolt)trtr(r iydlpte ict (f rrrx poo0tlxoiietysla umumpn(0texoircoatlm eluvo;t0s2um(rpiodll e ieil(farrau  oo1tpx  o3iatfm2umu s t0aeermrciy1omteau il( srtmim oydamtnlncsl() Drmx p;o4olt  o3tld aDean snu0alxrxr3to1la  lu s ()s2trxrpoodlmenlnctat sDtmurpnu0olxomi3iasfs eln o;u)texrxoctydfm raivols t2xoxr nu4omt lnvils srtauro;u0olxoif3tyt m em(monu0 lxoxf3oatlp  lueilt) 2trxr3ou1lptnmieil( aDuax  ou1tlxnmoetatfa2rlu p;t4treoircoa1oat  neo s0tetoio nydlp nmnetltfaDumu pou0aptomoetatls rmnmsnt0 renxo tadop raiei t0srur(r3ny1lm   iet t srtm(roou4tpt mo3iyt m2eluvp;t4aexoif3iotom  auvo s)texmio ou4lpt  fcslsf 2ur(m nt4ope  o3tyt a2uln sn(4texoif iodlm   ieslt) 2urim oo4ll  livsa(fsDrrx  nt4ope mo3ilt sDuln p;()areniocootoptrauvi s0 exrir ny4al nlieslt)a2uaum oo0apt mf3iydlmDeanvsnu4altoioctytfmt lu sl(0 rxmxr3oo1lpenmfesas) 2tr(  nt0tpen iciat s uauvont4aeermoctotopteau olt seur(m nudomee ivtas srtm(mont0teen iciytlaDuln s;t4 rtrxo oatop   i i;s) 2xrxopno4op nmivta(  Dtr(rpnu0opxnmf3tadlaDua(vo;t4arenif3oatoaD aivi;s teto(r iydam  mfcias)arua(r ou4apx ifetyslmDumnmp t0alxoio oydlmt lu olt0 eurimpou4lpt mneiasf Duau  nu4apxoii3iytlm2rlnmonu0 eermrcta1la r ivsls trto(opoo1om elivsls  Drrur ou1ape ifetldla ranvs (0tetrio ta1fp rln sls0 etoxr3iydam  lfcilt)sDurxrpot1tleo o3tytfaDua(vp;t4artrxo3oytom e i s;t0 etr(rpoo4apeemiet sfs2tax pno0oleomictasfmDrluvo t)arenmf ty1lpDrli ils0 2tmiopoudomtelivta(  Duru  ;t0tlx mo3tad s2umn s;(4 lenif3iy1fmD aieo;( tetm(m3iudape mfei (  Drmumoot0aexnio3iltlm umnvo u0arxnio ia1lm eaneo;s  2uoim nudome lfes s s2ra(rp;u1olenii3tltlmDrl(vsn()arxnif3tatomDeanvs;t) 2urxo3no1lm  lfvslt aDra( o;u4ape  fciyt a2rm(vp;t0aexrirciydfmt  i i;t seum(mpnu1alte fes (f 2rmx  oo4tpt  icilsfsDrlu pnt)trtnmf iodla  an s t srtmir no4amenlfes t)s2ua( ono1tleoio3iltfa el(mpn(0tetnxo iatlaDeanvi t)trto(r nu1altnmfviasfarraumono0oeeo oetltls2ua(vo;u4 ltrmf oytlp  au sls  euo(o3oy4lpee ivt ()srumum ;o4oltomi3tasls2eln p;t4texnir3ia1om e i s t) etrirpny4ol   fvtat) 2uaxmpno1aeenmfciyslm2uaumo (4tetoxo3oodla eauvi;t  rtmimpny1apt mneilt sDtax  ot0alt  octat m2rluvp u)teeoxf tatfaDr n o;(0s2uoxopnudam nmnvsa(farua(rpnu1oleniociyt aDrmnvon(0treomo3tatomDean o t0 etoxm3oydamtnmieil(  rtmu ont4olt if3iyt a2rau snu4 etrxf3totfp   u ol(0s2xrim io4aleelnvsl()sDrr( p;o1tlen fctadfs umump;t)trtoirctatopteaues;t0t2tmio3io1lp e nes t s2rr(root0oexnmfctadls2umn o;t)alxnmoctodoa rluvi t) eur(r ou1ome  nvil()aDtaxrpno1apt  f3iyd mDulnms;(0alerxo todoateli sls sruoim3iydal e fviasfa2raxrono1alx ifetas m2um( o;() exomr3io1lmDrli o;( t2tm(mpou1ap e fvslsfa2ra( pot4apx micias s2rm(msnt0tleoxf oydomDrlues;s srxr(opnydoptn nvtl()sDtm(mp;u4oltomfctasfm ran pn(0teeoxo oodlm ran o;s0trto(m3iydlme lnesa(f rta(rp;t4oleo iciys sDrln o;u0artriociadlatelu s t)trxmir3ny1lm nmivtl( arta(mpou0oltomiciadfm ulu s t0aexrir ootfaDeauvolt)seuo(m3iy4lmt mivtasf rrruronu0tlenif3tat a2em(vp t) ltoir iy1la  ln i (  euoxopny4lmtelnesa()s2ur(moot4apxnmi3ils aDuauvo;(4tltnir ty1opt au s s)srxr(m oodaptn iesa( arum(r no0tlenifciatls ra( s;(4tetoifcto1laD li i s  rxmxmpou1apenliet s)srta( o;t1oexn fctas a emnvsn(4 rtrxo3iotfp r neo t srxmiopoy1ome lietat sDur(rpot4oeto o3iatlmDra(vp;u0aeeomfcoatopD  neo (0truoxopou1altelivtlt s2rmurpnu1oeenmi3tlt a ea(ms ()tlenmrcoodfm rlu il(0s2toxm3ou1oltnlnvt ( sDrmump;o1tleomo3iltfs emnmsn()aexnmocoadop  auvi;(  2toirpno1op  lneils) 2tmx pnu1apxn oeiat m2rmuvo;()alerir3oodlpteau o t)trtoxo oydap  mietat) rrru p;t0tleo oeildlmDra(vp t0tltnif oadfmtr i i s)s2xo(m ou4lmt mncs s)arumu  ot1texo oeilt a2raums t4aeerifcoodlpD  i ils0truo(rpnu1lpt  icta()arraumoot4oleoifetatfaDulu on(0altoir3io1op elneo;t srtmir3nu4lmtnlfes t aDrau oot1ape moeiltlmDulu p;(4artoxocoatfptr nvo s tetoxrpno4op emictl() 2tmurp;t1oleoio3tlt mDeau pnt4aeeoxr totoa raiesl()trxmxopnu4ll emncil()sDuax oot1oex  fciad s ul(msnu0 eeoifcia1fpDr i s;t0 rto(r3nu4omeeliet s  rraump;u4tet mfeiys a rmnmp t4 ltrmrcoy1fmDe uvo t teumiopno4olenmietas arurx pnt0oee if3iadls ranmp t4altnmo iydomDr u ols srum(opoy1lm emnvt ()aDtr(rpoo1olt mfeiydls2rau p t0aexrmo3tydopDrauvo (0 etmim nu1amtn icsat)a2tmxr ;t4tex ioctyt m eaumo;t4 reomrcty1fateluvs (0 ruo(mpny1lmenlivi t  Dra(rpno4apto fetad mDrm( s (4 eenio3to1oatrlnes;(0 etrxr3oy4oltemiesa(fsDraxmono0aptoif3ildfs2eln p u) etrifcto1fateai o;( teuoxm3ou4lmtnlfvs (  Dtmu  no0tpxo iciad mDumnvp (0aexoxocty1lmt  nes;()srxm(rpnudap elnvsl( sDrm( oou1aetn i3iat a2elu o;u4aeeomo3oadopDraies;t  rtr(opoodome mnvsls) 2rm( ont0tpe  i3iltla2ua(vsnt0aexrmrctatlmte ivilt trtmim iydop emictl( s2um( o;t1tee  fetltfs2umumont0tetnioctatoate n s;t0trxmiopiu4om emncsa( aDuaxr no0optnmfetltlsDuanmo;t) eenir oa1lmt lu s s  2xm(rpiu4ame  ieils sDtax  ot0opt  iciadfm elnmo;t0trenifciodla  lueol(0 2toxm oydlmtelnvt (f Dururo;u0aeeomieias a ul(mon(0 eeoxociytoaD ai il( setrim iydopee ictltfa2ta(mpou4oeenmfetas aDuauvp t0alxoxf iodop elnvs;(0texr(m3nydll emnvsltfsDumx o;t4aetn oeildfs rm( s;t4tlxoxrctydfaDeli ols) 2uoxrpoy1lme  ies sfa2um(  no1tlto fcild m rmnms (4tetrmo ia1fmDr u i (  rxo(m nu4lp nlnet ()s2rmxmo;o0ale mo3ilslm rl(vp;(4tetoir3oodoatrlu s ( s2xmxr oo4ol elietlt)aDrrxm oo1opt mietytla2ulu ont0 lxnmr3oo1fmteauvi t) ruo(m3oy4altnmnvil(fsrrrx  ;u0apxn o3iasfm umump;() exnxocoatlmteaivslt)teuoxr nu4omt lncs s sDrmu o;o4olx  icils a eau p u0tlxnmfcia1omteaivi t0setmir iu1ap nlnvsa(farraxmpno1tlen ieiyslsDuan p u0texnir oodlm  lieols)tetr(o io4lleemfei ( sruaxro;u0olxn f3tltlm2emu o t4 rtnircio1lat ln o;s)srurxm ny4olt  fesa()aDtrxr nt0texoioeiat a rmuvs;(4teermf3tatopt auesl( truo(rpno1opt mnei t) Dta(  ;o0ale ifctas a2ul(mo;() eenxociadoateluvol(0texrio3iu4lm elietat srrr(mp;o4tle ioetls m rmu o;(0treoirctytlmteau ils0trtoxo oudolte nvias srrmxmpoo0olt ii3iysls2rauvsn() exnxo3iotlmDrlueo;(0srto(m3ou1omenlfvilsf rrrurpno4optnif3iadlm2uau p (0 ltoif iodfatr n ol( texrxopiy4ameelicil(f rta( poo1oeenif3tydfsDrl(ms u0 leoif3oy1lm elnvsl( teurirpoy4lmee ivtas  rra(m no4openmfetas m2ranvo;u4tlxrmo3oatla elies s0 rxo(mpiydlmen fviltfsrua( pnt1tlen i3iasla2ua(mp ()arenmo3oytlmteai o t t2to(r3oy4lm n ncsas)aDrmuro;u0altn oetltlm2eauvs;(0tetrxr iotomtrlivslt0 eumxo3ny4lm e nvtas)artr( p;o4teeoifciltlm rmu s;u0trtnmf ta1fatrlnvsls  exmxmpou1optnlfcils s2raxmpnu4oltnmo3tld m rmuvp t) etnxo3ia1optrau o;s  rxmxr3nu4omenmnesls) 2urxmpnu4apt if3tltfm2elnvont) exrio3oydfpDeau i;(0 rxmim3io4am emneias) 2tm(m nt4apt ii3tys s2el(mpnu)aeenmr3tatopt aivo;()sexrxr3iodal elicias aDtrum ;u1aetnmiciaslm uanvsnt4tlenio tadfm  lnvils0 rxr(mpiy4ll e iesl(  2ur(rpno4aexn ieiys sDul(vp u)tlermocoytomt anes (0 2xoio3nu4amt lnvtas arta(rpoo4opxn icildfm2uluvo;t4tltrmr iytfm r neolt  rumxm ou1ameelfvias  rraxmono0tpeomi3iydla um(vpnu0aetnxo ty1oaDe ivo s  rtoxm3nydolt lncslt) rrrxrono0oeeoioeiltla2umnmsnt4 exoxo tadopt aueslt0srxoxm3nodam  mivi ()arrm(rp;t0oetomfeiad m2eau snu4 ltoxf3ty1om rauvi t0 2xmxmpny1lle lnetlsf Dur(m ;u4altniictadla2ea(mo;u)aetoif oodfpDe n i;(0seto(r3no4amenmivi sfsrtm( p;u4tltoii3ilsls2rauvs (0tetoxo3iadom e i olt0sruoxo no1lm  mnesa()arra( pnt4ole  oeiaslmDemuvs;() lxrir3oatfatraiesls trtoim nodomtelieias  2tmx poo1tee  iciasfmDelump u)aeerxo3iatfaDrauvs;(0 2xr(m3io1oltnmnvi t) rumum oo0oeen i3iadfs2elnvo ()teeniocoo1faDr uei ()t2trirpou4ll emieilsfsruaxmpoo4opto fetlt m2em( snu0tetoircoa1oaD anvs;s0s2trxm3ou4lmte ivsls arurxront4ape ioeiytlmDumnvp (0tltnmr ta1fp  li o;s)s2trxo3oudale lfcs ( srurxmonu0tptnif3iasla ulnvs (4 rxrxo3oo1lpt livo (0trurim3oodamtemictlsf Drru ooo4tleoioeiadfmDrm( p u4arxoxo iydfp  ai ol()texo(o oodope  fci sfa2umxm oo1openif3iasfm emnmo;t0 ltnir oa1lat anei s0 rur(r3no1lmtnmncsl( srurx  ;t1texo ociyd aDul(mpnt) rtnir3oydlpt  ues s  rxoxm3nudolee nvtatfs2taxr nu0apen f3tls mDrmnmo;t0trerif oatlateli s s0 rtmio3oo1aptemictas  Dtmx ooo0tptomo3iys a ranmo t0 rtnif ta1opDr ivo t0srurxmpoo4apt lfeta(  2taxmpoo0aleomf3ias a2eln o (4tetnmr3tydlmtrln i s0 etoio3io4lpen fvsat)s2uax oot4texomicildlm2ul( ont)tetomocia1lmDeaueolt)t2tr(o3nu1alen ncsl(f 2rr(  oo4apxnif3iyt m ul( snu0artnmfctydlaDelivs s)texo(m3ny4lm   fcs () Dumx p;u0alxomi3tlsfs ea(vp;u4aeenmociydfm e nvs;s s2xoxopoy1lptnmfeta()arra(mo;o1aexoifctltfmDem(mp t4aexnmrcty1fmDeau s;() 2tmxrpnodop  mivslsfaDtmxr oo1tltoiicilsfaDrmums;u0 ltnxr3iy1faD  i slt srtriopiodal   ietlsf rtmx oot0alxn fcils mDrlu p (0alxrmfctytfp  lneilt) exrxmpno4optemnct tfartaum ou1tlt mictydla2ra(mpn(4tlermrcoadlp rauvi;t  2trxo3oy4ape livt tf 2ua( p;t4tltniociasfa eluvs u0tetrxfciotfmD ai o;(0s2xrxr iy4lm nlncsls a2rmu o;u1apt mietldlaDuanms;(0arxoio oadopD  nvilt t2toir oo4ameemfeil() ruaur ;t1oet moetyslaDelnvo u)trtnmf3ia1optrau ils0seum(r3nodam emies t s2tmxm ou0olenmieiydfs rm(von(0tlxnxo3oatlpDr uei t0s2xmim3oodlmtemfesa(f Dtrxrp;t0tetnmo3tlsfa elnms;()artrxr3totoaD  nvolt)trxoxo nodlme mietl() Dta(ro;o1tex moctatla uluvp;u)teeomfctotfmtrlneo t)trumxopoo1ll elnctlsf Drm( pot0aeeoio3tatlm2ua(vpnt)teenxo3ta1op   u sls sexr(rpou1lptnlnei sfaDtr( pot4olenmi3tat m2el(mont0 lenmr todom r ivsls0 2toio3ou1llt livi tfsDumxrpno4tptnmfeiltlsDem(mpnu)aetrmf3oatla   uei;(0t2xoirpno4omtnlnesls sruau onu1ale moctysfm2eaumo u0aexomrciodoaD  ieslt0seurxrpoo1lpenlivs (fsDtr(rpnt4tpxn fcilsfs eau on(0tltnifciatfmte iei;s0setoxrpiydame  fvils srum( ono0tpt io3iasfmDrlnvs;t) ltrxo iotlmD ln o () 2umim oy4ap nlncslt) Duaur ;t1opxn ietlslm2elnvo t0alermr oo1fatr iei;t) 2trio3iudlpte nvtlt sDtr(r oo0ole ii3tys sDrmu onu4alxomf oy1la rlu s;t) 2to(m3iydaptemncta()s2taxrpnu1ale iietyd aDuauvs u4aexomocootoate ues;()s2urim ny1apee ivtl(fsDtmum no4tlx  fetls s umnmont)altnxr3oytlate ivi ()s2toio oydom  mfvslt)s2umur ;o4altomf3iasfs rl( p;t0 lenxrctodlmDe neslt0seto(m ny4ope lfcsl(  2taumo;o0olxomi3iadfmDeau ont0tlxrmo oy1fp raneols)s2tmir3ou1olee fvtas)aruaurono1tpeoio3tyt sDelums;() ltnmf tadfpDeli i s0seuoxmpoy4omte nvslt) Drr(r oo0texomi3ilslmDelump;u)aeeriocoadfa r u i;(  exoxopny4amee fvta() Dta(  ;u0teeoio3tad s2eauvs u0texomrcoadopD livi;t s2uoio3ny4apt lnvt s  2rr( p;u1oet if3tysfa rau o;(0arenmrcia1omDranes;t) 2xoiopoydlptnlivi (fs2tr(  no4opto o3iltlm rln onu4aeerxo todomD au il()tetmxmpiodomt lncsas) 2ua(mo;o4tpt  fctatlaDumuvpn(0alxrmociodfm  an ol( setrimpiudomeemicias) 2tmuro;t4altnmi3tltfsDrl(vsnt4altoxr3ootlpD lnvolt0seuoxrpoydomte ncsat a2raurp;t0olxnmfcild s2ea(mont)altrifctodlmDrlies ( seuoxmpoudll e fci t sDrru  nu1texnii3ildfs2eaump;()trxoxr oatlp  luei;s  etrxopnydol   nesas)srrr( p;u1oeeniictlt mDemu pnu) leoxo ty1oa  lnesls tetm(o nodam  mnei ()aruaxr ot1alx  fetydls2emnvon(0alxomr iadfm   neslt0 2um(o no1lm nmfeias arum(mo;t0apto fctaslm ulu p (0 ltomrctodopD livo s s2trio io4omen feiat) 2rr(monu4alt  iciatls rmnmo u0tltnmrciodom e iei;( t2tr(o3iydoptn ics (f rrax  nt4tpxomfeiys mDemuvonu) leoif iatfptr uvs (  2umxopiodamee fet sfa2rau oot0openio3tas a2emuvsn(4 rtoir oodlaDe i o;s0teuoxmpny4olee ncils)arrmxrpnt0olxomociyd sDelump;(0 rtnxr to1oaD  ivsls)s2xr(o ny1lp e ivi s  Dum(r ;t0tptnif3ildfs eaump u0alxoxo3to1fa r ivsls0seurim3iodamtelivs tfa2tauroou1aetn i3iydlm2eaums u) rxoxo3iodfmDe ueolt0sexrio no1lp n neta(fs2ra(ro;o4apxoif3ils a rau p t0trxnio3ta1fat  uei (0 rtrim3iudlme licil()sDtm(root4tetoioctlt m2emuvsn(4trxnxr3oy1la ranei ()sexoxmpny1ll elfetatfa2tm(ro;u4olt mfctldfs ulnmp;t4trxnxf tytlpteaieo;(0s2toxmpny4lmee ietls) rra( pot4altoifctytla2rau s;(0 exoxf3oadop  lnei;s0trxm(r3nodame  fesasfa2ta(rpot0tptn fcild s umn p;(4altrxo iytlpDrln il(0srtmim iydlle mfvsasfartmu ooo0tptnio3tasfa2ra(mo () etomfctatopDean o;(0t2tm(m iu4olenmiei sfa2tmurpoo0tptnii3tatlmDrlumo u) exrir3oydfm  lnvil(0tetoxo oo4lm n nctl(f rurxrp;o4opeo feiydlaDeaump;u4tlermrciodfat aues;()sruoimpnydame mfvs s) 2taumoot4tlxniietydls2rmnvon(0tetnmrctotfmt  neol( t2xo(r3iydom   iesas) rtruro;u4apt  ictadlsDem(vo;(4tltrxr3oy1fa eln il( t2tm(r no4lpeemnet sfs2tau pnu0tlxniietadlm2ran snt0 lxriociatfmDrau sl(0t2uoim nu4ome lfct ( sDtau  ;o4ope io3iydlaDua( snu) eenmocoy1om eaivs ()trtmxrpno1omte fvt s s2tr(rpnt1oetnmieiasfa2emuvs t4alxrifcta1fm elivi t0 2umir3oodameemictls)aDtr(m ou4tlt  ociad mDea( o;u0 lxoxo3oatfm e u sls)t2xoio3iy1lp emncsl(farra(r ot4tpt ifeiydlaDrl( p t0trxoifcta1faD lues;s)texrxo3nodam nmiesa() Duax o;t0tltn ieiatfmDumump t)altnir3iodfmtr n ils)seuo(m3no4op elfei sfs2um(m ;o0oltnmociytlm raumo (4trtrmo3iydlmtelnvs s0 etoxr nudam  livils)sruaxmpot4apxnif3iatlm2ulu s;u) renir oy1fmDr uvolt0srumxrpnydllenmfvils)sDua(mono4aeenmietydlm2rlnms;u)alxnio iytfaD li s (  etoxopoo4openmfviltfs2tr(mpnt0apxnifetysfs ua(monu)aexrmocoy1laDelues s0srxoxo3iudll elfetas a2tmu pou4aptn fcilsfs2umumo;u4altomr ootoaDr ieo t) etoimpoy1ame  ivsl( srua(mpno1tet  o3tatfmDumnvp u0trenmr3iodlpt lnei t0s2xr(o no4ll elfetls)a2ta(  ot0apx  ictldfa2umu pnt4 rtoio oytfm eauei;( setoio3ny1lp nmnctltf 2umxrono1teen o3iydlm rm(vont4aexnirctytfp r u o;s)s2uo(r oudomtnlivtas sDuaumo;o1oleomf3iadfmDrauvp t)tlxnmf oadlmtrlues;(  ruoim oy4al n net s aDua( p;t1olxo ietat mDrl( o u4trxrir3tytlmD lneo;(0trur(mpoy1lptnlnetlt)artmurpnt1oeeomi3iad s uanmo u)altnmo oa1optr iei;t)texm(opny1op   fctas) rtr( o;t1tlenioeiytfa ean pnu4altnxfctadfm rln ilt t2toxr3nodlltelnctlsfsrumumoot4opx  oetad sDem( s t)areomr3oadlaDeluvi;t0srtrxm3io4aptnmfcs t)aDtmxr ot0openmieiyd m2rlumo;t4texnmfcoodop eanvs;s srtr(r no4ol nmiesls srtm(mpno4tpe ifciysfsDua( p;t4trtoxo iatopD  ivils  2xrxr3no4omt liviasfa2ra(  ou1tex io3iad m rm( s;(4artnmociatla e n i;(0trxmxo ny1lpe lnvtatfartauroou1alenmiciyt sDeanvon(4teerifctodfpt lu i s0 etoirpou4op   nvs t) Dua( pno0apxn feildlmDea(mon() renmo3iadfpDelueilt)trtoxopoy4ap   fvta() rtr( ooo0oltoii3iyd mDrlnmsn(4 eenxocto1fm  au o t setrxopoo4oltelicsas)aDurx pnt0aexnifetatfs um(ms;(4tlenir3tytoptrlu o ()teur(o iydopee fesa()arrrx  nt1alenii3ilt m2ua( p;()alerxo3tydoaD  neol()s2xoir3iudam elfvtasfa2trxmono4olen ieild a eauvs;(4aexnio3todoa rau i;t)s2urxr3io1omen fesa( sDuru p;t4ope moetydfmDemn on(4 lxrmf totfm  lies s s2urxr3no4alt  fes sfsDtrur nt1tpe ioetldfs2elnmo;(0tetomf iotfm eaivs;(0 eum(o oy1olt lfctl(f rur(m ;t4olxomi3tlsla rm( pnt)arxomfciydomtean i;s srtoxm3nodlm nmfvi tfsrrrxm ot1aexomfctyt aDulu s (0 lxrxr3ia1fmD auei;s0t2uo(m3ou1om n nvslt) Draurono1opt mieiasfaDeau o t4tetnxo3ty1oaDe uei;t0srtrim iu1altn feta( srua(  ou1aet  i3iydls2um(von(4tetrio oo1latrai s;s) 2um(mpou1lmtnlfctltfa2tr(ronu1apen oeiys sDrl(vo u)alerxr3iytopt lues t  2to(opnu4openmfciat  2ra(m ot1altn ieiys a2rmn onu0 lxrmr3oodfm rlueo s0tetrxrpiydlmenmfes ()sDtmurp;t1aexn ocildlm elumonu0tlenmo oodomt lueols0trxmio ou4olte nvsa(fs2trxm nt0oleo iciat mDul(msnu4 reoxf tytoa rauei;t0 etoxmpiodope mnvslt srrr(rpnt1teeniiciadlm em(von()altoxocoa1lp eli i s) etoxo3oodamt livsat srrmu ooo1olxomicils m2rlu snu0trtrio3iatop rlu ils0texmiopnydlmtemiesas  rrmurp;u4tle if3iadfm2rmums;u0 ltnxf3iodfmtrai slt)sexrxo3io4amt lici () rurxmp;u1oex mfctad aDel( s;t4trtoir3tydfaD aues s0 eto(mpnu4omeelivt tfs2ua(m oo4olx mfetydlsDulu sn(0altrxrctydoatrlivols sexmxr3io1oltnlfvias)sDumum no4tpenmieias m2ul( p;t0alxnifcoytopDelivo;s  2xoxm nodomt lnesl(farurumo;u4optnmocildls2rm( snt0 eerir ootoatrai i;s) rxr(opiydopt mnvsasfaDuaxmonu0tltn feiasla ul(vs t0alxoxo oydoatrauvo ()sexm(m io1ll   fvsat  rur( o;u1olt mi3tyd sDeauvp;u4trxoxo oodoatr n olt0teurim ou4altn fcs s srtmu p;o4aex  i3iatlmDuauvp;t0 rxoxrcoo1oaDrlnvi (0texoxr ny1om emieiat aDta( pot1tee  f3iadfa eanvo;(0 reoxr oydomDrai ols  2ur(opnodam  lfcia(fsrurx  nu1oleniociad m rl(mp t4artrif3ootfatr uvolt)t2uoir3iydole mfctas sDtmxmoot0apxoiociadla2ua(mp u0artoxfctodfm r u o;t)texriopnu1optnlivsa()aDrmumo;t1tptnmoetysfa emnmo u)trxoir3oy1latr nvslt0srxrxo nu4ome  iciatfaDtm(mono1tet  fcild sDran s u0arxnxr3oadomDe uvi ()srxrxr ny4olenmicsa(fa2tm(mo;o0alxo iciatfsDrm(mo;(0texomo ia1oatean sl()t2triopoodol n nvs s s2rax  ou4aptn octaslm ean o u)aexnir3totfaDeauvslt0 eto(o3oudlmenmnvt ( a2tmur oo4ale  oeiydfm rlu p u4aetnmoctatlpDeanvs ( s2uo(opiu4amenlfvias aDur(mpnu4olxomieiatfs2emn o;()tetrmfctytop elieo t)tetmio3oy4oleemnvi tfs2raump;u0tet  fcilt m ua(mp;t)altnxo iytlatrauei;s  rxm(opou4aptnlfvi s) rua(  nt0tpe if3iatfa2uauvpn()arenif iatfa   iesl(0t2tmir3no1opee neiatfsrumxr nu0apxomoetys sDean s u) rtoxo3ia1fatelivi ( srtrxm iu4ol nlieilt)srrmxrp;o1tptnio3ils sDumn s t0teeomocto1fmtr ies;t)seumir io4op nlieta(farrm(mpot1aexn o3iys m2um(ms;u4trxomo3iytfpt  ivo;()texrxo ou4lpenlnesltfsrumxmo;u1aptomi3iys sDemu o;(0tetoxr oa1lpt  n ilt srtrxr iu1amtemnvtlsfsDra(r no1apx ifeiysfa2raumo;()texnmociatoaDrlues t0tetm(o3nodaltn nvtas)artmx  ;t1alxo o3ilsfm2eanmo;(0altomo3oo1lp   uvs;t0 2xr(r3oo4ale micta(f rta(mp;o1aexo f3iat a umu sn(4artoircoa1oatrai o ( trxrir3iodolt mfcs t)sDtaxm ;u1tetn fctlslsDumums;t)aeenio3iotlpDeluesl(  2trxopou1lpee fvi s arururpno1olx mocilt sDrau snt4 etoifciotfaD aueol() rxr(m3oudll elics ( sDumu oot0tle mi3iatfa2elumpnt) eeomo3oo1oa e ivi t0s2uoirpnu4ale livi ( s2rrx o;o4oleomfctad a el( p;u4aexnxrciy1oatrlivo t  2trir iy4ap e ics () rumumonu4aeeomfeiydfaDuanmp;t4arxomrcoadlpte n ol(  euoxo3ou4apen icta() rumum no0aptomoeilsfs2umu onu)arxrxrcootfm r n o () rur(mpoudop   fct s  rtmuro;t1apxnifciat m rauvs u4 exrxr iytomD ln i;()sexo(m iy4am   nes sf 2rmur ot4tet  ieias sDeau p;(0 lenxr tadfp e neo;() rxm(r3iu1opt lfetl()a2rmurpoo4tpeomieildfsDrln pnu4trxoirctytfat auvi;( seuo(r3iu1aptelnetasf rumx  no4tetomocilsls uanvont) rxnio oa1fa  lnvo;( t2toxm no1omeelnet () Drm(ronu1altn octlsfa rmump;t0 eeoifcoa1oa   ivolt s2umio3nydom n nci tfa2rm(rono4aleo oeiysfa2rmu ont4 etnmr iy1fmDeluvs t seuoimpnydapeemfesatf Dumx p;u4optnii3iat aDuluvp u) rerxo3oydop e iei;(0srto(r nodll nmicil(f ruaxm no0oee moeiytfs2em( pnu)trerxo ta1fmD an s t seuo(r3ou4ap elnci t)aDra(r ou4aleo oetltfs2uau s;()trenmf3oadfa elneslt0trur(o3iydam emicslt)a2taxrono0tleomoeildfmDelnvo;()arenmrcia1fm eln ol() etm(opny4lptnlncs (f Dumu ooo0oexn feildfsDrlnvp;u)alxrmo to1fmtrlieilt s2xmim3ou1ll emnviat  2urxrpno0teenii3iyt aDea(vs (4 reoir tytfa  auvsls)tetoir3ny1lp nmiciat)artau pou0ale mo3tlt m umnvs t4 eenmr3tadfp  lueo s)teumim3iydlmte netatfaDta( pot0tpe mieiatla2umnvonu0tlerxociotfa   nvs;s  rum(r ou4lp   ieta( aDta(mo;t1aeeomi3ilt a2umump t) rxnmo3iadfmt lues t) 2xmxr3ou4oltnlfvt tfaDuaxmo;o0teenmi3tytlm2ul(vs t4texnmr3iadfpDraivs;(0seuo(mpoy4ale  fvt tfs2umu pot4tleo f3ilsla umnvont4aetnif3oo1lmDe i s () eurim3oodapenmncilsf Dtm(ro;t4opx  o3tydfs2uln s;t)teeoir3oa1oat auvs;t)tetr(m3nydam   ivtls sDur( ooo4tleomf3tlsfa ulumonu4treoir3ta1faDrauei;s teur(mpoodalt livt t)aDta(r ot1aee iieiatlmDem( o;(0arxrif3todfa rlu o;t0texrxo ny4lmtnmfesat)aruau  ou1tlxnii3taslmDrm(vp (4 rerxo3oodfpt  nvslt sruo(opiodolen fviat) 2ur(mp;t1texn iciytfs2eanmpnt)aeenxr3totlpteli sl(0 2xmio oydlpeemfcsl()arrru onu0aexn iciyd s uanvp;u0trenmo tydop  liesls s2tr(r3ny4op  livsa(  2uru oou0aeen ieild sDelnvo;u) ltoxr oodom   ieslt tetoiopoo1lmt mietltf rra(  nt4aleomictlsls rm(vonu4 etoxrcootfa ean o;( t2xmxopou4omeemnvtls aDtrxr nu4tpt ioctldfm2emu p t) lxrxr totoa rlivi;t0 etriopio1lpen iei sfsDurx pnu4teen icilsfs2ul( pnt4 exnxocta1op ranei;t t2xoio3oy1lmtnlfet sf 2uau o;t4tltoio3iat m2rl( o (0texomfcto1oaDraivsl() eur(m3nodome mnei () rurxronu4tpx io3iys aDran o ()trtrifcty1oa   iei;() 2umxm nu1apeelivs (f rraur no0oltomfciatfm ea( o;t4 exoio iotlpD li ols sruo(m nu4am elfcsl( srtrurpnt4opeomfetlsfm2emu o t4 lxrio iotfmD li ils srtoxrpnudlp elfctltfsDta(m ;t1tlenmi3iyslm2eln p (4alxrmr iy1lpD  ues (0 rurim3nudop  lfes (f 2ur( pno0apen f3tas s2ra(vs u) etnmr oo1fptr n i s)s2xr(m3iu4op nlfcs t) Dua(  ;o4oex  ociltlm2el( p;u0 rxrmo3oo1lmtelu s;(0srumxm nu4lmenlneilt srumu  ;o1oee  o3iydlmDul( pnu4texomr3oa1op eluei (0s2trxr iu4altelfctat)sDtmx onu0altnmfctls sDrln s;t0teerio3ta1om e ieo t0t2trxm no1ole lfcils sDuau o;o4aet if3iydla2ul(mp (4alxoif3oydlmte u i;t0 etr(opou4lm   fctl(  Dtm(ronu0tltnmiciytlsDeanvp t) eeoio3tatlpD luvil(0seto(r nodlpeemfes sfsDumumonu4olen iciyt mDemu s ()tetnir ia1fm elueslt)t2umxr3iy4ame  nes ( srur(m ;t4altnmfetytfs elu s ()aleoxr3oodlaD livs;t  rxm(opoy4al nlicil(fsDrrxrpno1aleomietld mDrmump (4 leoircio1fmt ai s (  2toxopio1omt mncsls) 2raumpnt1optomoeiadfmDrlnmsn(4tetnxocoa1oate uvol( s2xoim oy1llenmivslsf 2ra(rpnu4oeeoif3iadlsDulumo;u0aetoio iadoaDe ieils0trtm(r oo4olt  fvtlsfaDurumono1aex  ieiasfm rmumsn(0tleomr3ty1laDr uei;s teuo(o3nudal   fvslt)a2rrxmp;u0tlen ietlslm em(mpnu4 renmrctadopDelnvils)s2uoim3oydopee nvils) Dumumooo4optnmoeiatfmDra( o;u4altrmrcoydopDeluvo s0 eum(o3oudolenlfeiat) 2tau oot1tlx moeiadfmDranmp t0tlxrmf3tadfmDrai o;t0texoio3oudom nlivs s aDtr(mp;t0aeeo f3tydlaDea(msn(0altoif3iatlaDelieilt0s2uoxo3no1lme livtls)sDrmu ono0apto feiasfaDua(vonu)tlxnxr3oo1lpD  u i;t)t2uoimpny4lm  lfet t srua( pnu1tetn fciydla rlums;t4tlxrio3tydoaD luei (0s2toxr3iy4lmeelics t  Drmxrp;u1tee ii3tlslaDem(msn(4teeoxr oatla r n il()texrxm3iu4ap  mnei t s2uax ooo4tptn feils sDrmn s;(0 eerxr oo1om e nesls0 2uoxmpnu1lm e nvta()arra(mooo4tpxomo3iytfsDeln o;u0arxrmr3iadlatrluvols  ruoio3io4ll   fvtl(f Dur(mpnt0aetoiociat s elnvp (4 lerif3iatom r n o;s) rxo(rpou4ol nlfeslt sDumx pnu1olt mieiydlmDrm(msnt0 etomr3iotfp  ai o;s s2tm(m iodal emfvt t)sDumu  ;o1tet  i3iltfsDel(vp (4arerxrcto1faD  nvi (0s2trio3no1ome mfci s)s2tm(rp;t1apen o3tlslaDulumsnt) exrmf iatop e ivils)t2tm(r nu1lpe  ieslsfs2rm(r no4altn f3tadlmDrl(vpn()artoxrciatlmD aies s0srtmio oy4lptemnvias srtrxm oo4opt ioeiyt a2ua( onu)aetomociatfa eaneo (0trtmir3oy1ape mnciatfartau pno4opxn oeiatfm2ea(mp (4arxoif iadlmD au o (  rxr(mpou1llenmivilsfsrtmur nu4opt ii3tytla2uan o;t0aetnir to1fa r ivslt)s2xmir no4ol   ivtls artmx o;t0optoii3iadfm2ran s u0 lxomo tydlp rlnvo (0s2xm(m nu1omenmies tf 2umu  ;o1tlxo feiysfa2rl(vsn(0 rerircoodfa rlnvo;t t2tr(r iodap nmietlt)srtr(r ;t1oeeoif3iltlmDelnvsn(4trenmo3oy1fmDrauvolt seurxopnu4op   fes t) Drmxro;t4oltnmi3iydls eauvo;t)artomocoodfmDe ivo;(0srum(r oo1lm  lici t)arrmx o;t0alt  iciat a ea( p;(4aexrmrcta1fm e i ilt)sexmirpou1al  lnvtl() Drru p;t4oeenmo3iadfm2emnms;u)altrif oadoa   neols0s2uoxr3oudlp  lncsat s2umumo;o1tlxoio3iysfmDemnvo (0altrirctotlat  nvs;(0srurxo3oydop nlfesltf 2taum ou4tpx ii3tysfmDel(mont4aetrxr3todfa r uvi;s trtmxm3ou4ll   ietlt srrrump;t1olen i3ils a2ranmsnu)arxnxfcoadlptr u ilt0 2tmir io4al emncilsf Dtmu pnu0apen ociadfs ea(vs;(0 rxrircio1op  aueol() exoxr iu4ll nlncsasfartrum ot0altnio3tys a ua( p;u)alxnxf tydlmtelnvs (0t2toxm3iudlle livia(faDrm(rono4oee  f3iatlaDuanmp () ltnmo oydfa  lies;(0s2ur(m oydapee ncils) Dtmum ;u1oeen f3tld a2ua( pn(0tltoxo3ty1lptelieil()t2xoimpny4al nliet tfaDtrxro;u4apx mo3iadlsDraump u0teeoifcoodopDrauei s)teuoxmpiy4omen fei t a2um( o;o4oee  ocilslmDrauvsn(4 ltriocoa1opD lneo ( srxmxm nodol   nvtasfa2ua(mp;u1tpx mi3iad mDrlumonu)trerif tadom rlivs (0setoio io4lpe  nct s)a2ta(rpnu4alxn f3iasla2rmnvp;(0 rtnmf tadfaDr n s (0 rum(r3oy1amtn ictasf 2taxmonu0tetomieiydla2emuvo (4aexomocoo1lp eluvs;(0 etmxopno1lm nmnvil(farum(r no1oltomoeiysfm2uauvon()alxoxr3to1omtr ieilt) eumim oodalt lfcsls  rur(r ot1alxn feildla rmuvo t) lenxr3ta1fmteaueslt0srtmxmpno1apeelfvtl(fsrumx  ;o4optnif3iyt mDra(vs;() etrxo3iodfpDr u i;s) 2xmio nydlpee nvtatfarua( o;t0aeto feiltfa ulu snu0aetoirciodomteauei;( setoxmpnydlptemnci s) Dtaurpnu0tpeoiieiytfm2umumon()tetrmfcty1la eai i;s  etoim3oo1am   fciatf Duaumooo0altomoeiadlm uluvo (4tltrmrcoy1fmDe ivolt trum(opoy4alenlicsl(  rrrxrpou4tetnmf3iysfm ua(mo (4tlxnxociydfmD anvilt0s2uoxo oy1lptn fesat)aDuaxm nu0aexoii3iad a ulumsnt0altoio3tytlptean o;s  rxoim3nu1am  micsls) Dumuront0ape  oetat a ea( o;t4aeermrctytlmD au o;( s2xm(r iydomen ivta(  rrrxmpnu0tet iietld m2rm(mo;u0artnmf iytfm rli il( srxo(o ny1al nmnvtl(fsDurur ;o4alxnmocilsla ran o (4aeenioctadfmtr i il(  eto(r3iudll elnvs s aDta(rp;u1oexnif3iytfmDrauvp;() rerif ootlmt  uei s0 rurim3oydopt  icia( a2ra(ro;u1tet mi3ilsfaDra( s ()altrxf3oydfpteli i s) eumxo3oo4ap emictl()a2urumpot1oleoifcilt m ua( o u4aetrmf3tatoaD  iei s0s2xmir oudolt lfctlsf Dtr(r ;t4aetn ictlt s2raumont4arenmrcoydoa   iesl() rtmimpoodape lietat)sDurxmpnt1apx  feiysfm2ul(vs u)aeerxfciytlm eln sl() exrxm ny1omtemnvslt)artrurpnt0olxo fciytls2el( s t)trxrxf tydfateaivo (  ruriopiu1am elics t srtau oot1tlt  oeias a2el( p;t4tlenmfcio1fm eanvi;t0t2tr(r3oo4ap  liet ( s2umurp;t0opxnmo3tad a2umu p t0 ltoxr oadoatraiesls)t2toiopoudoltelnvi ( aDur( ont1oeenmfeiyt a em( p (4 etomrcio1opDrlu i ( seto(mpiodal elfvt (  Drr(r nt1tptoifctytfm umn o u0trenxo3iodlptraieil()s2ur(o iu4lp  mivsl()srtm( o;o4tpe io3tydfa2ua(vpn(0 lermo3oydlptrai il(0trtrimpoudale  fesas aDtr( oot0ole mo3tldfs2rm( p t4 exrxocto1omDe nvs t)srxoxo3io1lm nmivtlt) rraxrono1apt if3tysfsDel(mo;u)altnmo oa1lm  aivsls0 2umir nu1op  lncsa()aDtaum nt1apto i3tysla2elu snt) rxoirctydoptelues s  euo(opny1om  lnvsas)artmu  oo0apxn fetls a um( p t)arenircoo1fp e n o;t  rtrxo3oo4ap nlfvt tfsrtrxmonu4alx mi3ils m rmn p;()arxnir3tydfat ln ilt t2toim3iy4am  miciatfa2urx pnt0olx moetatfa2umnmont4 eeoir3iotoa eli o;t seumio3nu1olt lnvi t)aruru p;o1aeen icilslaDelumo;t)aetoir ta1latrlneo (0t2urio3iydom e ieias)a2rmum ;u4tlt  ociatfs
\ No newline at end of file
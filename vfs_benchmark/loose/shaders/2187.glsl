@@ -0,0 +1 @@
+n s;t0 rtmim3oy4lp nlfet sfs2urxm ;u1aptomi3tydfs elu s u0 rtoxr3tydfa   neil(  ruoirpoo4ape mfeslsf 2uau  ;u0apeo ietyd a2eauvsnt4 rtrmf ia1fm  aivil(0 rur(o io4alt lnvslt srurumonu1apenmociys aDuan pnu0 rtrxr ta1lm  lneols t2xo(rpno1lpeemfvils sDumumono1teeoiictatfm em( o u0 rtrmf oatfmD aieil(0trxrxm iudamte ivsltf rur(m ou4apxo ieilsfs2umuvp t4tlerxo oadoatr n i t  rum(opiy1ameemneslt)s2rau ono4tpeomoeiltfm rl(vs ()artomrciydla e n s;s0 rxmirpoydome  nvil()a2umumoot0aee iieiadla ua( snt0trtrmrcoytfmDeau s t) euoimpnodll elicilt) 2tmum ot4tex iicilt m ra(vpn()aexoxfcootlmDeanesl()srumxr oudlltemfeia(  Dtr(root4olxnmi3tlsls2rau ont)arxrmrciatfp r n i t0t2tmirpiudamtemnes sfaDumurooo0aptn oetasfs elu o ()aexoif totlat  ieo ( trxr(m3nudameemfcs t a2taum ou0tex mfetatlsDran s;u4altrmociodoatrauvil( trxr(m nodop n nei s)aDua( oot1tlt if3iltfs rl(vs u) eeomr3oa1oa rlues (0s2toxopnu4ome mfetlsf Dur(moot1tleoii3tydlmDua(vo;u0trtnmr3oytfa rauvi t0seuoxrpoudom nmiesls) rumxmooo1oeeomi3ias mDea( s;t)tetrmfciotomDeli o t  eurio3oo4ome mfvtltfsDrm(  nu0texo ocilt s2um(vo;()arerifcoo1lmtrai ilt0trurxo oodal  mnetlsfaDumxrp;t0oltomietaslsDua( o t4 leomr oadom   ivo t  rtoxmpny1ap  mivtat)aDumxmpot1tpxniictytfmDua( o (4aexrxf3ia1fp eanvo t  ruoxrpny1llte fetas) 2rrx  ;o0opt if3iyslm eln s;u) ltnxrcia1la eli i s  rtoirpou1lme liei tf Dur(m ou1tlt iociysls2ra( p;u4 ltoir oatlmtrlneo;( sexmirpny1optnmneiasf 2rr( pot0alxomoetytfa2umuvpnt0 etrif tatom raueils0t2xoxopoo1om e iesa()s2tr(rp;u4alxnmi3iasfsDean p;()teeomociadopDe n ols0texr(opiydopen nct s a2umur oo1apx  i3iatfmDrln o;()arxomo3iadfa   ieolt0 2urim3ou4lpenmfei t) Drmu pnu0opx moeiadfa2ranmpnu) lenif3ootfatrai sl( truoxo3ny4ole miesl(f Drm( ono4oexoioctltfs umnmpn(4tlenxo tydoptr i o;t)texoxr3no4lm n feia( s2rr(r no0teeomoetlslm ulu on() lerifctytfptrlnvs;t0s2xmxr3oudll nlicsl( a2ur( ooo0aptnmocilt m2rlump;t4trtrirctadfp rln o ( srurxmpoydopt mietlt  2rrx pno1tlxomi3iltfaDumnmo;u0arerif3iatlaDe nvo;t)t2urxo3ou4amte feil(f 2umu  ;o4oetnioeilt s uluvsn(0 rtnxrcoa1oaDelu i;(0trxo(mpio4alt lfesl( s2uaumpno4tltnmf3ilsla2ranvo ()aleoxociotfatelneils  2uo(o iu1ale livils)arumuro;u1olt  i3tlsla2rln pnt0artnir3iy1fmtr ivols seto(opoo4ol nlnvs (f 2urxro;u0apenioctysfsDrm(monu)artnmo todlaDrlieils)trtrio iu1alt lnviatf 2rmumono4teeo feiatfa ranvp t4 exnxo3to1lp rlivs t  rtm(o oudaptnmfvsas  rraxmonu0tlxoii3tadls2umnvs u0tetnxo3oodom e nvo t0sexmxrpiodaleelivi s) 2uax ono4aetnifetadlmDemu p ()alerxo iatoa rln i;s0t2um(r io4lp   fctasfa2rmxr ;u4aexnmfetatla2ean on(0alxoxf ty1fpDe nvi;s)sruo(o3oodlmtnmnctat artru  ot1alxo f3tatfa ulumonu4teeoio3iy1latrluvo;t) 2uo(o iydamt  fvi (fa2uaxmont0tltomociydls uan sn()teenxr iotomDeaiei;s)texr(r ny1llee fcsa()arraxronu4oexniicias sDrmuvs;()trtnxf ootoaD  u ils) rtmxr3iudllt mfei ()a2trumooo1aexniieiaslsDel( pn()aetrio3iotomDr ieo t0seurimpiy4om n ivslt  rurxm no1alxomfctysfsDrmnms t0 exnioctotlaDeaies;s) eumiopoo4apteliesatf Drax  no0aet ifeiatfs rmnvsnt)arxnifctadla  lneo;()tetm(mpoy1opt miviasfsDrau  nu1apxniietltla eluvont4alxrirctotomteln o (0teum(opoy4al emfes s aDtaxmpou0tee  o3iaslaDrluvs u4tlxrxo3to1om eliei;t0srxoim iydamt mivs ()srua( ooo0tleomfeiltfm2ua( pnt)teenifcootopDelivs;s)srxr(r nudalt  ici t)arum(r nt0olxnio3iysfaDumu s ()altnmr3iodomt  nvsl()srum(rpou1ame  fvs ( aDua(ront4tee mfetldfsDum(vpnt0tetnmo oo1fm r u i (0t2toio3iydap emieils)aDtr(roou1tptoii3tldfaDelnvo;u4 rerif tatfmt aueils) 2xoxm iy4ome livsa() Dtmx oot1altomfcildfa rln s;t0artrmo oadlmt li o;t0tetoiopnudopen ivs (faDum(  oo4tetn feiadfs el(vo;t4 exomrcty1om  aivi t sexr(m3iodop n fct t)aruax onu1tpx iocils a2rmnmpn()alxnif3iatoptr ieil(0setmxr iy1lptnlnvs tfs2raxr nu0tle mfetydlm2elu on(0tltrmrctytlaDe neo t s2xrxo oo1am emnct s  Drm( pnt4tleniietat s2ulnms (4aetoio3ia1lmDr ues;t0trxrxr no1lm  livilt a2ur(ro;t4oeen fctydfmDrmnvpnu4tltoxo3to1lmDean s s tetoxo ny1amtemieils) Drau  ;u0texnmfciltfa rmnmpnu) leoir iatla r u i (  2to(mpiydllenlfvi (f 2rmum nu1opxomieiatfs rl( s t4 eenxf oa1fat anvi;() rto(m oo4altnmfct ( sDur(  nu0aex iociydls2elnvpnt4tltnxo3iadla ranvs;t  etr(opiudamenmnetas)s2rmumo;t1oet ifetasla eanvpnu0aeeoxo3iydlp  livo t) etm(m3ny1olenmfvsa()aDurum nu4oltnmi3iys s rmuvp u4arxoxocio1oa   ues;( t2xrxr oudlpt livt tfarumuro;t0opxnmo3iatfm rmn onu0aetnxf ootlpD aivo s s2to(o ny4al elfct t)srtr(mpnu0oleoii3iyslm eanms u0 reoioctydlpDrluvi;()setmir iu4lp emfcsasf Dtm(r nt0tlt mf3ilslm2em(vpn(4artrif3ootfpD  ivi s)t2ur(o oo4olte feia(fa2rax p;u0apxnmieiydlm rluvo u4 rtnxrciadlateli ol(0tetmiopny1apenmictls)a2tr(rp;o4oeenmfeilsfmDrluvo;t)aexomrcoydoptr i i;s srxoxr3iudomt lieiat)arra(m oo4tleo o3ildfs rlnmpnt4 etnmfctotfaDrlueo (  exmxo iu1aptnlfetls arta(ro;t0tltnifetyt mDulump;()altnxoctydoat li ols0 rxo(mpoydlp   ncsl( srumx  ou0opto fetls aDra( pnu4tltnxocootlm raieol()trtr(m oo4omtn fesl()sDrm(r ot4tlxo ictytlaDumumpnu) eenmfcoy1lpD  nei;s0setrirpnu4amtemfvtlt)srrm( onu4olxo f3iat sDrmn s;t4texnxo3oydopteli sl(  rtm(m3nu4al nlfei s)srurxmpno1olxn o3iydfmDumnvs;u4alxoioctydom e nes;()s2trxo io4omtnmnetl()aDtr( ono4aexniiciyd s2rmnms;t)arenircoatlp e ues;t trurio nu1opt  fvsas aDum( pnu1optn feiyd m elnvont)artnmfcoadomtran i;s  2tm(r3iy4ape mfcta(fsrtrumono4oleomieildlm2emn p () exoxr3iatlaDrauei () rtoim3oodlpee ici () rtmxrono1alx micils m2elnms;() eermo3iodlaD aivi s srxo(opoy1al n ics (fsrum(rono1tpxo f3tyt a2ea( p t0treoir3tatlpte i slt t2urio3oydaltnlics ()aDumurp;o1texomictasfmDumn sn() lxnmrciy1oaDeau o s s2trxo nu1lpen nvi tfarraxmo;o0aexnifetls mDrln o;t) eeoirciy1la r neol(0s2um(mpiydlltelict (  Dtmurp;t1oetnmf3tldlm rauvo;(0arermr3iytlmt lnvolt setrxm3oo1am   fcil(f Dtm(  ot4tlt  fciydls2rluvp t4alxoirciatom rli ols s2tm(mpiy4lptelivs ()srum(m ;o1oex ioctysfs2ulu pnu4 renio iatoaDeluvs ()s2xmxo oy1olt  nvsls)a2tmu  ;t0alt  feildla rluvont0aeeomrcia1oatr i ols) ruoimpou4olen fvs t  rurxr ;o0aet if3ilsls ra(mo;(4tleniocty1omD ai i;s0teumiopou1lmtn ietas srurxrpou1tlxomi3ias aDemuvs u)tlxnif3tydom e u s ()s2umio oodllen ivtasfsDtmu pno0aexniietyt s rm(mp t4teeomo oa1fpD lies t  etm(rpny1lp nlfvsltfarrr(r ;u0opx  icild s2rluvp (0texnif to1fpteau o s)sexmio iy4lmte ivsa() rrrxront4olx  f3tas a ra(msn()trtrxo3io1lpDrlnvi;(  eur(m3oudole lfci s) ruaxrpou0alt mfctysfa rmnvs t)treoif3tytfm   u o (0 rxrir3oy1lpe  nviasfaDtaxr no4ope iictlsfm ua(mo;t)tltrirctadoaDr nvo;s0t2toxmpiu4omtn fcsls arrr(ro;u4tpe mi3iltlsDum( o t4altnio oydopDe i i;s) exmir io1openmieiasfsDtauroou0aeen fctlt sDeanmp;u0arermr oa1fmte ieo s0sruo(mpiudol  mnct t srrr(rpnu0tlxoiicildla el( o u0texrxf3totfa e nvsls) etrir3oydopeemici tfs2tm(rooo4aex  feiydla umnmsnt0aetomocoydoptr neo s)s2urxmpiy4om e icsasfsDtrxm no0apxo iciyslaDul( s t4arxoif3oytfpDelnei;t)t2umiopny4ame  fet ()s2umu p;t4apt ifciltla rln s (0 lxnxr3iydla   neols)srxoxo oy4alt  nci s  Dumu o;o1tle if3ils a emnmonu0 rxnxr3oytomteluei;()srto(m3oydale  nci (faDrrx o;o0alxniictltfs el(vp;u0texrxf3oa1op   ieol(0 2toxo no4ameelnesl(f 2trx o;u0tlx iieils mDemuvp () reoxr io1op  lnvi (  rto(o iudopenlnctatf 2uaxm ou0tpe  fetas a ua( s u) exnmocoydom elues;()trxmxmpoo1om   fetlsfa2uaurp;o4oexnifeiytfs elu o;t)texrmo3oydlm rluvo ()sexmim nu1op  lneiat) rtr( ooo4tlxomociatfsDra( o t)aetnxfctodlm elnvs t)trtoirpiydolenlnvi t  Duax o;o4aexomoeiltlsDum(vs t4trermr3iadfa   ivols  rxo(o oo4apenmnvt tf Drrx pnu1aet iocildfa2emnvp;t) etriocia1lptrauvi t)teurim iudalenlfesl() rrmxmpno0ale io3ilsfm2uln onu)alxoxr tydoaDelivils)teto(o io1ll nlfvi s arurxmono1olto icilslaDrln o u0aeerxo iatfmDe ivo;s setrir3no4lp  lnvt (fs2rmx pou0aee  f3ils sDeln pnu) rxrirciodoat  ivs;s0texr(opiydolte feslsfs2ra(mpot0tlx mfctat s2rmump (0arenxr oydomDeanvs s0sexrxmpoydome  ictl()aDtmxmoou4alxnmiciltlsDem(mp;t0 etrmf iadop  lies t)s2xoirpnu1lpe  iesls aDrmur oo4alx iociltlm2uanmo;u)trenxf3tydlpDeauvils trtrio oo1lptnmncslt)a2rau  ;o0tpeoii3ilsfa2eau s;u4aleoioctytlmDrli o;() 2tm(m3io1alenlnvt sfartmumo;o4olenif3iyslaDrl( pnu4texoxf ta1fmDeln ols)s2tm(r3iy1aleelnvsls srta(mpno4apto fciysfs rluvonu4aexrmo tydlpDrlnei t0trurxm oy4opte ieias aDta( onu1oltoio3iyslm uauvp;u0texnxrcia1lptelivo ( s2xo(rpno4al nmfvi s  Dtmumpnu0ale ii3ils s umumo;(0teenirctadlpD ln ols  2uoio3oodome mnciat)sruaum ;o0apxnmfciysfm ulnvont0 eenifcoy1fpD aieo s0texoxr ou1amtnlfet t)sDtm(rpot0altomi3iadfm el(mont4texnmr3tadoa  an s;s trtmxopoy4apenmnesa()s2tr(r nu1aexo ietas s2ea(vp (4treomf3tydlaD  n o ()t2uoir iy1alte fvt ( sDrr(ronu0tetniictytla2uaumpn() eerxf oydomDr ueslt0texr(rpnu4op   fesatfarrm(r ;t0aetn oetlsfm eanms u4 lxrxociy1lptranvi;(0 rtmxo3oo4amtnmfctls s2tmu o;t1aex  feiyd s ranmp;u4trxrio3oadlm ean i ( srtoxm nudlptnmieil( sDra(  nt0aptnmi3iasls2uau o;(0aetoxo3todopDe uei;s)setrirpno4omenmfvsl( arrm(r nu1apt  fciatfm2uln pn() eeomfciadom  auesl(0sexr(m nu4llt mncias sDuax pnt1tlt mi3tls a2ea( o;() ltnmo io1lmteai ils) 2umir iu1lme mnesat)srua( ont4ope  fctas sDem(vp;u0aexnxo3tydfate n ol() rtrirpno4ol  livs t  Dtau ooo4oetn ocilsfs2ua(vo;t0tlxoxr3tatfpD  i s ( sruoxo3no1omee ieta(fs2trum ;o1texn i3ias s el(vonu)altoio3iatlateauesl() rum(m oudal emfeiatfa2rrur ;o4oexomi3tls s2um(msnu0 rtnmo3iotfm rlueo;(0t2ur(opiu4ole mnctltf 2rmur nu0tleo o3tlslm2el( o u0aetnxf3to1lptrln ol( teurim3nydopeelfct sf rua( pot0ape mietas sDra( s;(0aeerif iydopD an ol()setoxm oydal nlivta(  Dur(rpnt1oet  f3ilt s2rmuvo (4tetoxr3oydfaD auei;(  rxo(opoodape mivi s srua(m nu0tpt iieildlsDul(vo t)aetnmf iytomDe i o () 2umirpiy4lptnmnet sfartax ono1oex ioctls mDea( sn() rtrircoadla   uesl(0setrim3nu4lpte fctas) 2rruro;t0tee ifeilt a rmn s;t0aeenxo3to1op eaivol() 2uoxo3ny1lpenlfvi tf rtaur ;t1tltnmieilsfa rl(mo t4texoifcootla eln i s) euoxmpoo4ll  licil(fartrxr ou4aptomieilsfs ra(mo;(0artnmocoy1fa  liei;t s2urxopiu4olen fetlt  Drmum oo4optomoeiyslm ean o (4 lerxrctytopt  neo;s0t2urirpiodal   fvil(fartaxmpnt1aeenmietlsfaDumn onu4trtrxo3iytfat aues s) 2umio no1lltn ivsls  Dta(rpou1ole  f3iydfs2umnvpnt0arerircio1op elu i ()truo(m3nodll nlfeils  Dum(ro;o1oee io3iat mDemu pnt)aetrxo3tytomtrlnvs;s0t2xmim oudam emict (  Drrurono4oetomo3iys m uln ont0aeerxfcoy1laDeanvi;s0 rxm(mpiu4am elnesa( sDrau  nt0tleoif3iat mDum( s;(0 etomo3tytfat an s;t0t2xm(r nydomtn feta(fa2raxmp;o1aeeo icild mDel( sn(0tltomo3ty1faDr nvs t) rtmir ny4op elfcsas arraxm ;u4tlto ictldfsDrmumo () lxnxrctotfaDeai o t)srxoxm nodaltn ieias  2ra(ronu0tlxn ictydfaDranvs u) reoxo3ty1omteaiei;( s2toxr3oodam   neils)aDtm(m ;u4ole io3tydlm2ean s;()treomo3ia1laD livs ()trxo(opno1ol emnesat artmuronu4altoiiciatfa2ul( on(0 lxniocootom e ueo;t)seumim3ou1aptemnetlsfaDururooo0altoif3iad a2el(ms;(4 lxnmfctytop eau s ()tetrir nu4apte nctl(fsDtruro;o4oeeoif3ild aDulnvo t4tlxnxo3iatlaDe uvs;()sexmxo iu4lme  icils)sDtaxm ot4tpto oeiat s2emn p;u0 rxnif ootfpDeaies t0s2tm(r3iu4lmeemnetls)a2rmxm no1aeenmoctls aDea(ms t) rtoxf tytfa r ivi;(0t2toim3nudomenlneiltf 2tr(ront4optoioetld m ua(mo;u0alerxocoydlm rln o;(  2toxopoo1lp n ncil(fsDrm(  nt1alxniocilt aDem( s t4 etnmfcta1la  auvs s0 rxoim3iy1lpeemict sf 2tau  nu0apx mietld mDeanvo (0 rxoio iydlp e n ol(0setmxr3oo1lmtelieiat  rrax o;o0ole  f3ildfa2eanvpnt4 rxoif3tadfmtr ivo ( s2urir oo1ame  fci (  2tru  nu4altoiieiltla2uanmo u4tetrmf tytlp rau ilt texrio3iy1amenmici () Dtru o;u1alxnifcilsfs rl(vs () exnif3to1om raivsl()s2xrxrpnu4ll  lfesat)s2tr(mont4tlx if3iyt a eluvsnt4teeoxoctatfatran o s t2tmim nudoltnlfeil() Duru  oo1tleomoeiadfsDrl(vsn(0 rtrmrctadoaDr nvol() rur(m iu1op emfcs ( arra(m ;u1ope  ietyd m2uau ont0 rxrxr3totop  lueo;s  exmiopoy4ol n ictatfs2rmump;t4aet ii3iasls2el( pnt0 lerxr oytlp r u sl()t2trxrpoy1lltelivi s aDra(m nu0tlxn oetysfm2uan p () lxomfctytomDeaivi;() eurxr nudlleemivi t)aDum(mo;u0olto oeiasfm2raump u0trxrxr oy1late u s;t) rtm(o3nu4ll  mfciatfsrrmuro;o0aet iictatfa2elums (4arenxr oydfmD auvilt0 rxrimpny4lm  lneias  Duaxmo;t4teeoiocilsfaDumuvo;t4 etnif ty1lmDe nes t texmirpio4omt  nctl(faDrru  ;t4ole  feiatlsDumnmo u4trtrmo3tatlp ran s t  exoiopiy4amenlncils  Draxrp;o1oltomoetlsfsDea(vs t4artnxr3iatlmt auvi;(  rxoio iodll  lfvi s)arrm(m oo4tpt ifeiltla uanvp;(0trerxr ta1fmt lnvsls0 rtmxo3ny4ol  mfeilt aDtaum ot1texnii3ild a2ea(mon(4tetrio tydomDraieol() rxmxm3oydopen fcsat sDra(m nt4oeto f3ilt s umuvo;t4arxnmf tydopte u o t0t2tm(r iy4optemfcilt  rtm(ronu1aleoiociasfa umuvs u0 renif3iydlptrln i () rtoirpiu4lmtelfeia(faDta( oot0aet mfeiyd s2ra(vpnu0texnmoctotlp  lneo;t tetr(r iu1ope lncslt)srrru o;u4aee ii3tytla2emu p;()aexrxfcoytfm   n s;s) etmxopno1ll e fvs t) 2raxmono4olxnio3ild s2em(mont0texrmf iytoaDeau i;t0srtoiopiy4lm emnei tf rtmxrpnt4tpen icils s rl(mont)tlxrxf tydop raieslt0srtoxo3oy1omeemnci tf Dua(  ;u1aex miciatls2emu sn(0altnir3todoa r neo (0 exr(rpou1ll   neslt) Drrumonu4oeeo ieiyt aDea(mo () rtoir iydla r nvs s seuo(opiy1lmeemieta() Draurono4texnioctadfaDrl(von(4 exnmrcia1lmDelu i;(0s2umio3iu1alee ncslsfsrta(rpno0olto fciaslm umu o;t)aexrmocoatlp elnvslt)s2xm(r3oy4lptemnci ( artm(mpoo1tle mf3ildfs2ea(vs;t4aeeoxo3tatfa rlivol(0 rxrxr io4lm n icta( a2tr(mpou4tpxoioctad m eanmp u4aeeomo3iatla elieo s)srxm(r nu4ll   fetat  rtr( o;o0aet if3iadfa2emu o;t)trxrmo3io1laD luei t0 eum(mpnudlptelnvs s s2umuro;t4opx  octlsfmDrln o ()texrif3iydlaDrlu i;t  2um(m ou1aptn fvil(f rtmuronu1apen fetyt m2elums;(0aetoio3ootlpDelu s;( teurim3oudomtn icias arrau p;t1oexnif3ild a ean o t) ltrmr iatlpDr u s ()t2xo(opoo4omtelneiltfsDrrxm ;t4aet mfeiyd a uln p;u4 leoif oadlat  i o;t  rurio3oydlm n nct t s2ururpnu4tlt ifciytla2rmuvpnt)tetnxf ta1lp  livi s teumio3iodomt mivilsfsDtax pot0openiiciatls rmu snu) lxrmo ootoa rauvols0 exo(mpoy4ole lfciltfsDrr(  ;u4oeto f3ildfaDua( p;t4 ltomr oo1lm   uvils0trxrxr iu4lptelnvil() 2rrx o;u0tpxnmo3tytla2elnvo;t4 exnmo oydlmte ueo s0seto(o ou1apenlfcslt s2trxm ou4aetnmicilt a ra( pnu0teermo3oy1latrln i;t t2urimpny4lpt  feslsfaDum(r ;o0tee  oeiatlaDuanvp;u)texrxr oa1opt  ivo;t) 2xrxo nu4ol e nvtas srra(monu4tet mociyd a uauvsnu) lxoxociydlmDraivi;( tetrxr iu1omtnmiei t artrum ;o0olx  ictlslsDuanvpnu0treomf oytfpD au o t0 rtmimpny1omen feiat) rra(mo;o4oet  f3iat mDemnvo t)trxoxf3tadopteanvs;t truoxopou1alenlfcs s  2rrxmpnu4tex mi3tydlsDulump t)tetrxrciotfmtr nvilt) eto(r3oodolte fei ( arrr( ono1apxoio3ias s2raums;u)teerxr io1la eaivo;s  exr(mpnu4am e ivtl( srraur no4tltnio3ilsla rlnms;t)tltrifcoytoatrai s ()seum(o3ny1apee iet sf 2ur(m ;t1tle mociadla2rauvpn()tlenmocoo1fm eaies;t) rur(m io1amtnmfes (f Draxroot0aexnioeiltlmDum( o;t) renif3oy1opD  neol(0trumimpoudalte iei tfa2trxmpou0opt mi3iasfa2raump u) lerif3totfat  uvo (0 2urirpiodomenmieta(  2uaxrono1apxnmf3iadls2rm(vs;t0alermf oytlptr n o s s2urxo3iy1openlfviltfs2rm( p;t0tltnmf3iyd m uanms;t)arxnmr3oodomDeaneo;t0 eto(o oo4ol n ncta(  rrrumonu1tpx mocild m emuvont4aexoifctydoa e ueslt texmxmpiy4aptn fvt (faDuax pou1optnifeiadls2rmumont4 rxnxr io1oa r ies ( seur(m nudlmte nesat)aDrru ont0tpe mieildlm uau s ()aleoircootopDranei;(0 2xoio nu1amtelnvta(fsDrru pno0tetomictytfs2rmump u)aeeoifctotfaDelueilt) exr(opoudomtnlncsat arumumpno4tlt mo3iyd m2eauvp (4tlxnmf oydlmD aneo t0texrxo3io1lmt livt t  2umxr no0altoiociltfaDeanms (4 etoxo ootopDrlnvslt) exrxo oydlptnmneil(f Drr( ono0altnmi3iyd a2uauvp;t) etomf iodlaDelu ils)trtoxr nu4om nlncil( aDumu p;o0oet  oeiadla2el( p t) lerif ia1laDrauvi;t)truo(opio4llt  fvt (fa2ta(  ot0teenif3iad s ulump;t4trxrir3oodlm e ueo t  etrxr oy4ape lnvi sf Dumur ;t0tptnmfciadlmDuln p t) rxrxf3iy1lmteaivo;()t2tr(rpiu4ol nlieilt) rtmxm ;u1oetn f3iydfm2rl(mp;u4aexrxo to1oateaivs;t)sruoir oo4ol n nctl(fa2rruront1alx  oeiat a rmu s t4altrxoctadomt  neo t)trurirpiy1oltelivs s)aDtau poo0aet  fciyslm2umuvp t0 ltriocoo1lm rlu i (0seum(opnudoptemfviatfaDtaur ;u4opt if3ildlm rm(vs;(4alxomfcia1fpDelnvols s2umxr3ny4oltnlfet tf 2ra( o;u4aetnmfeiydls rlums (4alxrir iatfatrln i;t) 2urxopno1amte ics (f 2tr( ono1alen fctyd aDeluvp;u) ltrmr tadlat aieo t) rtoxr ny4openlivsatfa2rrumonu0tpt mociytlsDul(vpnu) lxrmo3tadlaDr uvo s0teumxm3oydopen fct s) rtrur nt0tltnio3iadfa rm( snt0tlxrifctodoatraueo t0s2to(o no4al nlneta(  Drm( p;u4oee moeiadlm2ulnmo;t)artoxfctytlpD  nvs;(0seuoio3iodopenlfctlt artaumpot4ale mietyt mDranmpnt)artnmoctadfpDeaivo;s t2tmxm oo4opt lfvi s)a2rmu  ;o4apto ieiydlsDraums u0tetoxo3oatlpDr uvil()setoxr3nodole mfviat srtrump;o1tee  feils aDul( ont4aeeomr3tatfm  lu i t  rxm(mpiu1oleelfet t  Dtau oot1tptn o3iys s2rmn s;()trenir3totom  luvils0tetmxm3nudam emnes tf rrrxmpot4openmieiydfs uan pnu4artomfctydom elivs s t2uoxopny1lpt  fcia(fsDrru pnu0aex  fctytlmDel(mon()trtnxo oodlpt  u i s)sruo(opoudlm  lfetas)srumurono4aeto o3tyd sDrl(vo;(4 lxomf3totla r ues;s srxrimpiy1lleemics sf rrm(m nt1texomfctadfs ulu sn(0trxnxrctotla r ueo (0sexrxm3nudlmte ict t)srrm(rp;u4tlt  fcild mDemumo;u4aexnio iatoat au o;s) 2urxr nudaptemfcia(  Dua( pno1opxnmfctatfs em(von() lxnxr3totfate uvi;t) rxmir3iu4al n ncilsf Dtaurp;t1apto i3iyd m rmump;(0alxrifcio1lpD li i;s)s2urxmpoy4lpt mfciatf Dta( o;o4texnmociat s ea( onu4aeeoxo ootlatran o;t0t2xo(o3nudap e nci () rtau pot0olxnif3ias s2rmnmo (0aeermf oodop   neo s)setmxm3nu1ame lneilt s2trxrp;o1oeeniieiad s eanmon() etoxr oa1oatr i o;(0t2toim ou1ol   ictl( a2tmu poo0altomoetadfm2ulu s t4 reriocio1lm rli ilt trumxo3ny1openmnesls) rrr(mpou1tpeoifetlt mDulums;()tetnir iydlm rluei;s)trxr(mpno1oleemfctl( a2ururo;o4optn i3iysfsDrlnvpn(0 reoio3oytfpDran ilt) 2um(o io1optemfei t  Dtaum ot1texniociadfs elumo u)artnio3ta1omDrlivo;t texoir oy1ome mfcilt)arum(rpnu4tlt mietadfs ra(mon()trxomf ty1oaD  nvsls) rur(rpnydam e nesas sDrrumpou0aexo ocilsfmDrau pnu)teeoxociatoaDe ivo;s  2xoio3ny4alt mnvsa() Dtrxm ;o0oexn i3ild m2emnmp;t4altnmr3iotoptrlneolt0srurim iy1lltn neilt)aDum(mpno0aetnmoctlsla umnvpnt)trtnmf oy1laD  ues (0srtrirpiudolenlnet sfsrrmxrp;o1opxoio3ias s2ulu s;(4 rxnxf oodopt lnvs;s s2tm(m nydaptelfvtlt s2uax poo1tpe  i3iytfs2elnvpnt0tlxrmocootfmt au o;t0 2urir3oo4lp nlicta( a2taurpou0aexo ietlsla2umuvs;(4trxnircio1lptrlueo t0tetrio3ny1om n fct s)srtau o;u4tetnmfeiat mDumn p (4aexnmf totlaDr ieolt srumxm3oo4ol  lncs ()a2rmxm nu0oetnmfctydfm2ua(vo t)trxomf3oydoatelueslt0 rtoio3io4lpee nvtlt)s2rmxr ;t0tltnifctat aDumnvp;() rtomfcoydfp  aiei (  euo(o no4lmeelfvsltf rum( ono4texo octat m2um(msn(4artrmr3ty1oaD  nvi;s t2xr(r3oo4lleelivta( srrmxr ;o1aet  fciltla2rlumo t0 reoxo3ty1fa  luvi t0srxoim io4lptelfeiat)srtr(  ;o1altn o3tlt m uln p (0arenxf3iotfa rluvslt0t2xm(m3nodlptnmnei tfsDtru oot0oeeomictld a2uln s;t4 reoxrcoa1la ran o;s0 etr(r3oydlp elfetl()aDum( onu0altomieiydfa uauvsnt) lxomrciytlpD  n ils truoxm ny4lpee nei t sruau  ou0tpxomf3iydlm2ul(vp;t0alermo ia1fatrlneo s)t2tmxopny4apee ictls s2rr(m ;u4apto oeilslmDelnmo;t0tlxoxoctodom rliei t)srxrio3ny1ame  ieia(  rtr(  no1tet mfctyt m um( p t4 ltnxocto1omtr ivi;s0s2xrir oodomtelfesa( arua(mooo4alenmoctadfm rauvs;u0trenxf iy1fm  lneols)t2umxm3oo1olt lfet t  rrrur ;o1tpt mietad m eauvp (4trenxo3tydla ean i s t2toim ou1amtemfcs s)aDtrxrp;t0olxomiciadfs eluvon(0aetnmf io1fatr u ils  rxrio3ny1amt  nct s  rumumo;o1ape ii3iyslsDulu pnu)tlxnxrcootfmDeluvilt)seuoxrpnodalenlfeilsf rum( ono4oeeo ietltfs eluvpnt4aetrxrciadfp elies;s)tetrxrpiy4lpenlneslt  2umxmp;u4apx iictadfa rmu snu4aexrmr3ia1opD aivilt0 2to(opnudalte nctl(f rrr(m ot0tlen fciydfm2emnvp;t4tetoirciotlat lnvo;t0 exmio3oodap elfet sfsrrm(rpou0tpen ictls sDrl( o;u)trxoir iydfptr nvolt)sexo(rpno1lp nmivi t)srta(mo;u4ope  fcild mDrm(vo;(4trxomocoy1lmtrau i t trumio3iy4alte fesl() rrau p;o0tpx  fciyslaDranvon(0altnif3iytfp   i ols  rtrio oodolenmncils)aDum(root4teenifeiltla ulumo t)teermocoatlm  livs s) 2tr(r3ny1ape mfet s  2rmxrp;t0opt mocildfa2em(vs;t)alxrmf3todlptraivolt s2xmxr ou4om  mfci tfsrtm(rp;t4tltniiciyd m rm(mp;(0arxomr oy1fpD  iesl( t2tr(m3io4amee ies t artrxm nu1opx  feias mDrmnms u0 ltrifcoydoptrai ols)srumimpoodope  fci t)srrrxrono1opeoifeilsls rmuvs ()trtnmfctydlaD ai i;t)setmxr ou1apt mfeta(f rtr( onu4alt ioctys aDel( o u4artrxf3tydop eluei;t0 exm(mpiy4lmte ictlt a2urxrpnu1tlx ii3iytfsDrauvpnt0 rtrxrctodfateaueo;(  2umim ny4ll nlictas) 2umx o;u4tet ifetadfaDrln o;u4treoir oytfmtr nvol(0seuo(o ou1altnlfcs (f rumurpnt0aptnmi3tas a ul(ms ()aeermrciotlm eau s (0s2trio iodaleemivslsf Dtr(rp;u1aexomfctytla2um(mp;u)arxoifcia1lpDean o;s  eurxr3iu1lp nmnvsls s2raum nu1oexomf3ild mDrmumo u4alermf io1lat lnes;() 2xmxopio1omtelietls  rrmu o;t1olxnifetld mDrluvs;() rtomf iatfpte uvo s)trxm(o3io4aptemfctat)arur(mo;u1aetomfcild aDeluvo;(0alxnxf oatfpte nes;s0srxoimpiu4opt  ieta(  rumxmp;t1aptn octat m uauvo;u4 rerxfctatla elu i;t0 ruoxo3no1ome lfctat) Drmurpot0altnmoeiad m2rln s;t0teerxrcoo1lpDe n i (  etm(r ny4ll  mfvi t sDtax p;u0texnio3iad s um(mp;t4tlenxf3io1la r u i;s)seur(r oodolt mfvsltfsrum(m ;t1texomociydfaDel(vp t) lxoif3oy1omteanei t) 2xmxr3oo1opee fei s s2rmxm oo1tex if3iyt mDemumo;t0 eenif3iydlp e u i;t0trumxr3ny4omee fet s) 2trurpnt4oltoiociys a2uln s;t) rtriociydfatranes t)srtoxmpio1apt  ivs tfaDua(m nu0ape  ieiytfsDul( o u0arenir3oytoat ln o;s0tetrxrpou4lpte feilt  2rr(moot4optomietlt a rl(mpn()aeeomf iadlatean s s trtr(opno1om nlfci t sDtr(rpoo1tpenmociydls2uln p;u) rtnmo ta1latelueo;t0 2urio3oy4al emfesas)arrrxrpou1oexo o3iltla2ua(ms;t4altomrciatfpteli i t t2trxopoodlltemict s)sDtr(m ot1tle mf3iat sDeanvo t4aeenir tadfpt  ivs s)trtr(o3oodamte fvi s)sruax oot4olxn fciatlm rmnvont0 rerxo io1fm rlneolt srurio nydol emfvt ()a2tmxrpno1tpe  oetytls ranmo;t0aeerircoatoaDe ueols trtoimpno1amenmietl( a2tmumoou4texoiietatfsDelu o;t4tetnxrcoodoaD li s t0sexrxrpiu4ameelivsa() 2uaurp;u0ape mo3tytls2rmumo;() rermf3iadfpt  iei t0sexriopnudap nmivt tfaruaxr nt0apx mieiaslm2em(mp u0alxrir iodom rai s;s0teum(r3oo4am e fvsat) 2rmu p;o1opeoiietlt a2umu o;(0 rxoxocoydfmD  nes t)seto(mpou1al emfvia(  Dra(mp;o1opxoifciytlsDuau s (0teeomr oy1lat lueo t)sexoxopny1lmeemfcs (fa2urxrono4alx moeiasla2uan o;u)trtnif3ta1fp raues;s0 2uo(m oo1optn fvs (farta( p;t4aee  ieilt sDrmumo t0 rtnxrcta1optelnvo;( s2umxrpou1lm   ieil()sDurxrpou4opx moctydfm emnvs;t0aeeoio todfaDeli sl(0teur(mpoo1omtelnesa(f 2taurooo1olt mi3iadfm ra(ms t) eerio3oydfmt luvi;(0 rxo(r oy1opte fct () rtaxmpoo0oeeo ociydfa2rlumon(4artnxf iydlaD  uvo;t)setrxm3iy4ope lnctl(faDtmxr ou4aetoifeilslm uluvo t) ltrxrctytoaDrlnvi;(  rumim3ou4aptnmfvi () Duauro;o4oexn f3iadfa emn sn(0texoio3todomD lu il(0sruoimpno1ll  mictl() Dtaxm nu1tlxn fctld m rmuvo;u)aeerxo3oatoaD  ivils srum(opny4olte ncs s)arum(  no0aexoifctys mDua(vsnt0 leoxfcoytfatrauvslt t2toir io1am n nvslt srurxm nt1oeeo ociysla emu p;()aetrif iydfpte nvs;s) 2xo(m3io1op emncta(faDuaum ot1ope  icils s2rluvsnu4alxnxo3tydla e iei;()t2toio3no1ap nlfctlt  rur(mp;o1aleoio3tatlaDrmnmp t4tetrxf3to1lp e n s;t0s2xo(opiy4lm  lnvias sDtrurpnu0optnio3tld mDrluvpn()aetoxociotoa elu olt0 eurxmpnodlmtelivs (faDrrx ono4aptn i3iytlm eau o;u)trxomrcoydlm eln i s truoir oy1am nmfesat  Dtrxmpoo4optomfeiys m2uanmpn(4 lermo tytoaDranvs s0tetoxm3ou1optnmfes (f 2urx  no1teeo i3tyt sDuluvpnu4 rtrxf oytfmteli s ()tetrxr io4al e neiltf Dtrurp;t4opt ii3ilsfaDua(mp;u0 renxo tadlmDrlieo;(0 2trim3iydomtemfvsls sDtr(rpot0apt mfctltla2em(mp;u) ltoxf3oo1lpDrln ol() eumxmpoydop elfcsasfsDur(m ;t0tpt  oetys aDrlumpn(0trxrir3ootlp e n i s0 etoio oo1al nmivi tf rta(m ou1oeeomfeiys a2ranmp () lxnxocta1optraueils0 rxo(m3nudlp elnvta()aDtmx o;t1altoiieiysfsDra(monu4altnifctotomt  n o (0 euoxopnu4lpte ivsat)s2rrurpou4apx ioeiltlm2eln pn(4tlxoifcoodlmD  ieo s0 2xrir oydllt lnvs t sruaxro;o4oee  ieiytlaDemnmo u0alermf3iatlm e n ol() etrxm3iu1apt lies s)artaxroot1aee mieiatfs2ea(msn(4alxnxf oa1omDraivolt) etrir nu4aptn netlt  rtaxmoou0oetomi3ildla em(ms;t0areoir to1fpD luvil() 2toir ny4aleemncilt  rum( p;o0openifcildfm2umumo;(0 rtrmf3ta1laD  i o;t0t2umir ou1al e ictlsfa2ra(m ;u4tlxnioeild s2ea( snt) eenxf3iotlm elueo;t)trxrxrpny1apen fct tfsDtaxrp;o1apx  ociat a rauvo;t4tetnifctodla rau ols setoxm3oy4lm elivsat) rrax pnu1apto oeilt s eluvs t4 reoir3iotlm   ues s)t2tmiopno4lpt lnvtls s2ur(r nt0oex ioctys s2umn snt4tlenxf3todoptrliei t  euo(o3ny4lp n ieils  Dtauront0olt if3tatfa2eluvpn(4alenif iydoateai o;s trtoxo nodlpeelfvs t)srtr(  no0opx miciat m2ua(ms t4 ltoxr iatfmDeanvo t0s2urxmpiy1llee ict t  rumu p;t0altn ocildls em(mp;()trtrxrctadopte i s;s tetoirpoo1ameelfvs ( srtrx ono4aex  i3iydla rmnvp;u0altrmrctatfm  aivo ( trtoirpiy1ol e ncs s a2ur(  ;u1opxomociydfs2ulu o ()teeniocoodlaDraieolt)s2uoxrpio1ll nmnvi tfaDtr(r ot0alxomi3tatfaDuanmp t4altrxf iatfa   i s;t trxoxo3iu1lm n nvtat)s2umxrp;u4tpeoifetltfsDemn s () rtrmrcto1la e ies s0 rxoxr oo4ll  mictatfaDraumpnt4aptomfeiyd aDea( p;t4 rtoxrciotfaD lu o t0 rtmxrpoydll  lnvtlt s2rrx pno1texomfeiytfa2ul(mpnt4trenmo3iatfa rlues t s2trxr3iu1al   ivsas a2uaxm ot1aleo f3ildla2ulnmpnt4tleoxr oatfp eanvo s0seto(o oo1amtemfcil( srra(  ;o1texo icildfs eluvpnt0tlxoif ootfpDran s;(0 eur(o ny1apeelfcils srtm(m ;u4tltnio3tysfm uauvs (4treoioctytfa rluvol()srumxm ny1llt lieilt srtaumoou1opxn ieiadfs ran p u4 lenxfcio1lp rlnvs;() 2xo(rpnu1olt  ivsls)a2trxro;o0aetniociad a2um(vsnt0aexnxr3ootfpD  uvi t) 2xoirpoodaptnmicsl()s2raxmo;o4olenifetyt m2rmnvsn(0tlerxr3oytoaD  i i (0trurxm3iy4lmtnmici ( aDurxrpoo4aeenifeilsfsDrmnvs;u)alxnxocia1lp  luvi;s sexo(m3nu4lmtelict t aDtrxro;u0tleoif3ilslm2em(mo;t0trtoxr3iotla e nvolt0 etrio iodal n nesasf Dur(rpou4oetnmo3ildls ul(vp (4trtoif3oodfm  ai il(  rtoxr3iy4omtnmieta()s2umxrp;o0olx mi3tysfs2uauvs (4tltrxf3ta1omt  iesl(0 2toio3iy1amenmicia(f Dur( p;t1tetn icias m2raumont0altoir3oa1fptr uvsl() ruo(m3iy4lp  mfet s aDurumo;t4tpeoif3iad mDuln snt4tlxnirctytoa  li i s) rumxo3oodamtelicils)sDtm(mpnu1alto feiadlsDrlnmp;(0 exnxfcoadoate neo ( s2xoxm3oy4amt  nes t)arraum ou1tle iietld m ulnmsn(0altomociotla raneol( t2xrxmpoo4op nlnesls a2urumpoo1texomoeilt s2uluvo t4artnxf3totomt  neo t)tetmxo no1amt mivtlt)srumxr ot1tpenii3tysfm emn p t)trtomfcoytom rluvi t0t2triopio4am   ieta()s2tmx onu1apxniocias sDea( s;u0artnmoctytop elivo;t srtrxm nudamtemnes ()artrum ot4tpto iciysfmDulnvo u4 exrmo3iatlm rluesls  rurxrpou1omenmieia( aDtaxr no0tltomfeiydfmDra( on()aexrif3io1oatr n il( t2uoxopoydop emnvtl(fa2trx p;t4apxoif3tadfa2eau onu4tetnio3oatoateanvi t0setrirpoy4olee ici s)aDtrxr no4alenmiciydfa2rmumo;t) rxoxo3ta1lmte u s;(0tetoxr3iodlmtemfeilsfsDtaum ;t0tlt  ieiadfm2ulums;() etrmocia1fptrlnvs t)trumxm ou4alt lici t)s2tau onu4tetn f3iadla2rmn o t)teeoxr3oadomt liei;s srtoio no1oleemiesls)sruax  ;t4apt  oeiatlmDrl(ms;t4treoxrciydlpD lneo;t0 2xmio3oodam  lieil()sDrr(ro;o4oltnmoeias a2umump;t) lenxrcoo1lp eau i ()s2trirpoodapen ncil(farraur ou1tlx moeiltlaDeanvo;()teeoioctotopD livolt trtoxr3io1aptnmnvta()aDrrx p;t1texoiietltfa2ua( o;(4tetrir to1omt  n sl( srxrxopoo4lpeelfeils)s2ra(m ;o1tpto fcils a2rm(ms t)teerxfciydla e ieo;s)s2tmir3iy1amt  fvsatfartr( pou0oee if3tytfa rlnvp;t0 eenmo3tydfm   i ilt0 eurimpoy1lp nlfetltfarra(mont1teeomoetys m emuvonu4aeerxf3oa1opteluesls  2um(opoo1olenmneta(  2rau pnu1tpenifctydla2emu pnu0tlxoxfcoydoaD  ues;t tetm(r3ny4altn ivils)arur(rpot1alenioeiadfm2ranmo;(0artrmr3oytlp  au s t)setoiopoo4amtnlfvil(fsrtru p;u0olt io3tasfsDra(ms;u4aleomr oy1lmD auvo;t)tetriopou1omen fct (fs2tm(m no1aexnioeiatfaDrl(vs;t)tetnmrcia1optr u sls0s2uo(mpoudam   nvslt srrrxmpoo4aptn o3tadfa umn p;t) exoio3oodlaDeauvs;( t2um(m oy4lleemfvtas  rurx oou1texoifeildlsDuau snu4trxrxo tatfpD  u sl()trxoiopiu4opt  net () 2rrurpot1oee  octytfm2rlu s u4arxnxoctatfa r iei;s  2tm(o3ny1ol   fci ( a2raxr ou0tlxoif3tytla2um(mp () reomo3oa1fpt auesls)sruoiopny1alt  fciasfarua(mono4aetniicildlm2rlnvont0arxoir3iy1fa r i o s sexmxmpio1lmtelnvs t a2rm(r ;o0oexo o3iydlsDuau s;t0 lxomf oadfmDe uvi ()s2xo(opny4lm  mivta(f rtrxmp;t4tpxnmocildlm2uaumpnt4tetoxrcta1oat auvilt0setr(m iydlmtnlieils)a2tau ooo4alt mociytfm rlnvsn(0tlxnioctytfptelies (0 rtoimpoy4lmee feslt a2tmxr ;u1tpxomf3ilt mDea(mo u0alermr io1fptelues;t sexoxm oudlp nlfeia()a2uau o;o0tpxo oeild a rluvo;()texomr3iytlmtrln o;(0sexrim3oodalee ncsls  Draxrooo4aptnmoeiadfm2emnmo u)altomrcto1omtr ieo;t) 2urxr3io1lmen ieil( aDrr(mp;t1oex  fctad mDranmp;u) reoxr3iadlptelues (0texmimpoydllte neilsf 2raur ;t1tpxo o3iat s ua(vs;u) rerxfciytomtrln i (0srxm(rpio4omen fvta(f rta(mo;o0oet  ieias aDrl(vs;u4teermf3iotla  lnvsl(0srtr(o oy1lpenlivtlt a2uax oou1texoifetydfmDrmnms u4aetoxociatlm  anvo;t0texrxmpoo1ale  fei (f rum(  no4ale io3iys s2em( s () rtomr oytomDr neslt0s2trir io4ap nmnvt (fsDta(m nu1tpxn feilsfm raumo;(4arermo ta1oatrluvi;(0s2urxopno1am elnvia()a2rr(rp;o1alxomf3iadlsDrlnvont4artoxf3ta1opDeaivsl()t2umio oo4ll   ncils) Dum(m no0tltniictydlm2ulnvp (0 ltrif3ty1lptr ies s s2trio3nu1olee ivtasfartmx oou4tpx ifciydlsDea(msn(0 eeoir3tydfm r ivol(0 exrim iy1om e ncia( sDrr(rono0opeoif3tasfaDelumo t4arxrxrcoodoa r ieo;s0 rxmio3iudlp   nvils)s2um(mpot4opxnmfetas m2emump u)tetomo3iotfm rluvi;s)srtrirpiudlm emieslt)aDua( pnt1opxn f3tltlm ulnmon()alxrifciydfaD auvi;s) exo(m3iydaltnmictl(fsrtrxro;t4apt  i3iltlmDul(mo;u4arermrctadlaD  neo (0 2uo(rpnu1ap emivtlt)sDtaump;t1olenifeilt m2umumon()arxnxr ty1fa r n s;( s2toxopiy4op  lncs tf Drmu p;u1oltn ieiadlm2ul(mo t0alxnifcoy1fm r i o s  2umir oy1aptn fvsatfarurxm oo0opt  f3ilsla uaumo;u4 eermfciy1lp   i il()t2tmirpno1ll nlnet (fsDrrumpot1oeenioeiad sDeanvpnu0tetrxrcoadfptr n sl(  etmirpno1lptn fvtatfaDtm(moot1olxn f3tytfa eanvp;t0trxnmfcoy1om eliei t t2urxo3nudal  mfvsa() 2tm(m ;o4apxoiieiadlsDulu o;t0 rtnmrctadlmDraivs s  2toxo3oo1alt  ncsatf rrm(roou4oeen oetad aDra(vo;u4 ltrxfctotomt aneil( t2umxr3ny4apen fvslt a2ta( o;o4tlxomf3tyt s2rln ont0tleoxr ty1laDr iei;s0trxrxr3oy1ll e ieia() Dtrumoou4alx  ieiydlsDrmump (4texoxfcoy1lmtrln olt0texoxr iu1opeemfct () ruax o;t1apxoiociasfs ul(msnt4 rtrir iy1lm  auvol(0 2uoir ou4aptnmfvsat)s2ua(  ;t1olxnmf3iytfm2ua(mp;u4 eeomocoo1fpD aueo;t  etoxopiydapt mics t  rumum ot4olen octys aDeln s t4texoir3io1la e uvo;(  etr(r3nydoltemnvtasfartmx  ou0oexomoeiytlsDranvo (4tltnxocoydoa raies;( srxoiopoy4olt mnesl(f Dtrx  ot4aeenii3iadfaDrl(mp;u0arenir iadfmD lnvs;( trtoim iudalen fetl(  Dum(mpnu1tlt mf3iadla ul(mo (4 lxrxf oodlp rai ols  exr(rpou1llenmivslsfarrmxrpot1opxnmo3ildfa umuvp t)aexoio ty1oaDelueo;( t2uoimpio1lme  fesl(  rumu pno1tpen fciytlm eauvo;() ltriocoadomteau s;(0texrimpio1ll n netas aDrm( p;u4teeomfeiat m rmuvpn() lxomr3oatoa  an i (0trtm(rpiudopteliet s  rurxmpou1texnio3tatfs2rl(vs () rxomrcia1fatelnvilt0sexr(r3io1om e ivt tfsrra(mpnt1teeoifctltfsDum(vsnu)alxnio3ty1op eaneil(0t2tm(opno1ameelietltfaDua( o;o4opxnmf3iysfm2rmump;u4 exrmr tytlaDrai ils0t2tr(m oudlltnlncta() 2ra(mp;u1tlxniiciyt a2ranvs;t4 rtrxf3todom elivs;s trxmxr oodaptnmnvtl()srtr(r ou4aetnmocilt s ul(mon(4teenmrcoadlaDe n o t  rtr(m3oo4lm nmfesl() Dta(r ;t0olxniociytls2uaums u) rtomr oydopDe ivil( tetr(opno4lp   ncta(fa2ua( ont1tlto fciasls2eaums u4aeenmociotfmtrli ols) eto(o3iodlm nlici t sDtrxmpno0aeen octyt a2el( o t)aetomfcoadfp eln i s)t2umir3io1ll e neil()aDraxm oo4tpx io3iyt s raumonu4arenifctodom  aiei;t)t2xoxo3ny1lp n fvtlsfsDtmur nt4opxniicias a ean p;u4altnxrciatfm elivs t)sexoim3nodll  liciat)sDtrurpot4aeenii3tlsfsDemu o;u)tetrio3ia1oaDranvo s srtm(mpno1lm nlictasf ruax poo0oleomf3tysfa2ua(vs u4tetnmfcoytfm e neo;s0sexoim3ny1olee nvs t)srum(m oo0olen ietls a umnmp;u0tlxnir ty1fm e u slt)s2umxrpny4omtnmictl( aDtr(m ou0aetn oeilsfaDeln o u) lxrmrcoa1la e nvo ()sruoir oudamt micslsf Dum( oou4teenmoetyd m ra( o;t4alxrxr oa1fatr nvi;t)sexmir3ny1ol emiviltfsDrmx pot4tetomieiytls ua(vp (0alxoxr oo1fpD li s;t) 2uoirpoy1omtnlictas)a2um( o;u0oltnmoctyd aDulumsnt0 lenmo3oatfa  aies t0trxm(o iu1op n ivi s artmx o;u1opxoifeias a el( p u0 rermo3totopteli o (0setrxmpiydaptnmies t)srur(r nu0oexo feiasfa2emn pnt) ltrmr3oo1fmteai i s)srxoxr io1llen fci s aDrax  ;o4alenif3ild s2ea(ms ()artriocty1fatranvils) rxrxo iy4oltelnesls srtr(r no1tetomocilt m ua(ms t) exnxf3to1fa raieilt  eumim3oy1open fei tfs2tmu pou0tpt mi3tadfm elumo (0 lermr tydlpteauvs (0t2umir3iodolen nvt tfs2rru  ;o4alxnii3iat a2el(vo;u)tetoirciy1omDrlies s)s2uo(rpoy4lme mnct s)srta(m ;t4tpx iieiydfa2ranvp;(0 lxomf todfpDelues (  etrxo3iodoltemiei t)a2ra(m ;o4alt ii3ilsls emnvpnt0 etomf iydlm   nesl(0s2xrxr3iudal   fcsat) 2tauronu1opxn f3iysla2rmn s t)teerio3totlp r n o;s tetmio ou1amtemictat s2ur(m nt1oee  ociadfaDra( pnu0alenxr3ootoat  nvolt)srxoim oo1alee fvt t a2tmx  ou1tle ii3tydfa2ran p t0 rxrxf3ootfa rluvi ( srxmir no1altemfvs ( arta(rpou4tpeomfeilt aDel( p u0tlenmf iytfat ai i () 2uoio3oydale lncsat s2rr(r ;o0tpe mfciytfm ulnms t4teermf io1fp elnvolt sexoxr3iu1ll nmncsasf Drm(rpno1oltnifetys sDemnmo;t) eeomf3totopDeanes;(0 rxm(o3nudlmtemfcs s  Duax o;o1ole mietasla2ua( snt0 eeomociodlp eauvo;s0trumimpiy4lp  mivil() Dur(  ;o1apxomfetas aDuaums u4 exnir3oydfa raueils texo(rpiudol elfvil()srrrx  no1oee  iciat a rmu o;u)aetrmfcoatomt li o;(0 2tr(opoydlme miesa() Drmxront4tlxnmoeiasla uanmo;(0altrmocoy1lmD lnei (0s2toxm iodam   neta( aDtaum ;t0tpe  oetad mDel( ont0 rtrxrciotop elivs s)t2xmxm3nu1ap e fvta( aDrax  nu4tptn icias s2em( pn(0areoif3iytfm rauvs;s)s2tr(mpiodamt miei sfsrtm(rpnt4opxomiciyd s rmn ont4arxrxfcootfpt anei s)s2toxr oy4altnliet tfsDtrur ;u4alxoifctytlmDeauvo;()tetrmfcoy1fmDrau ols)trxm(r3oodlm  lfvta(f 2rau  nu4tpeomocild a2rmn o u4arxnif3tadfpteli slt0 rxrio oo1al emfvi tfaDrmxront1tle mf3ild aDem( pn()tetomfciodoatelnvs ()tetr(m nydop emfet (fsrurxronu0opx  fciadfm rau o u0artoif3ty1faDr i o ()t2trxrpnodlp nlfvsl() rumx p;u0opto feiysfaDrmn o;u)aetomf3oytopDrai o t  etr(m3ny1ap nlncta(f Duru pno4oleoifeild sDeaums;u) ltoir3oatfm   n i ()trxm(r nudlpeelfvias) 2uru  ;t4texomociys a2rlumon()aeenircto1fmtelnvs t  exm(rpnodap  mnci t)sDrax  ou0apenifctyt s elu s;t4 etniocty1faDrluvo;(0 2xmir oo4amt  ics tfsDurx oot0oex mfeils a2ulnmpn() rtoxocoy1fa  livo t)s2tm(r3nu4amenmnetas) rum( oou0tpenmocilsfmDrluvo (0tltnif oodoa eaivs s0seuo(m3nydopt lfesa() Draxm ot0apx  o3iatls2umumonu4aeerif ta1faD aneo (  rum(opnudllt mictas) 2umu onu1aeeo octytlaDel(von(4alenxo ootoaD ai o;s  2xmim3nudope lfesls)aDrrxrp;o0tptnifetlt aDelu pnt0tlerxf oodfpD lies;t  2triopou1om  mfct (  rtmu p;u1tpe iictyd s em(msnt0aexnxf3iy1oa  lneslt sexm(r3iu4lp e nesl(fsDraxro;o0tlxn i3iyt m ea( ont0trxoxr ia1fmtr ies;s s2xm(opnydllenlnes ()a2raxr ot1tptniociydfa rmnvonu4 exnmrciytlmt lnvs;s s2xoio no1op nlnetas a2rr(r no4tpto i3ildfmDrln o u4 exniociytomDeaues;s trto(mpoo4ol elics t)srtaxr ou4texo ociadfm2uluvs;() eenifciy1fp e uvo;(0t2xr(r nodlmtn fvs ( s2tr(m ;o0opxn oetlslsDrm( p;u0tlermf iytopD au il(0t2um(rpnu4ope  fvt sf Dtr( pnu1teenmi3tat aDuan p;()altrxfcoo1oa  livils trxo(r iu4llenmfvs ()arrau  no4oltn fciyt a2rau o;t)arxomr oy1fm rluvo;s0s2xr(mpoo4am  lfvs (faDtmu ono4tpeomociys aDua( onu0tltnxr oytomDean olt) 2xrim3nodalenlfvilsf Dtaxmpot0aptnmieiltlm2emu snu)arxrmo todfaDeau i;(0s2xoxo ou4ape mnvslsfsDrrur ;u1oexo feiys s elnvs u0 ltoxf to1optr i s s) 2tm(r3nydlm  lfctas) 2ra(m ;o1teeo i3iltls rmn p;(4arxrxfcoadlmt  i o () rumxrpiu4amt  iet s sDum(m no1tee mf3iytls rmuvo u4aeenxr3oodlp  lu sls) exm(o3oy1om nmivsls)sDtrx  nu0aet ioeilt s eanms u4tlxoxr oy1laDraivi () ruoio3io4om e fctlt)arrax ont1ale moeiat sDrm(mp t0 exrxrcoatlmDrau s;(0 2xoio oy4lm  mivil( s2um(r no1oeeomo3tytlaDelu s;t) exrmf ootoptrlivi;t0sexrimpiy4omen nesas aDtax onu1alxoii3iatlaDrmumo t0arxrmf tydlaDrai olt)t2trxr3nodlpe lfvi t srtr(ro;u1apt  f3iyslaDuan o;(4 etrxrcoatfaD anesl(0sexrio iydol  lnvs () 2rmx  ot4alt  feiad aDemnvs u4trtnmocoytfpDe n s;s0 2xrxm oodll n fei t a2umxr ;o1opxn f3tasla uluvp;u) rxrxfciytla eauvs t) eto(m3oodlmen fcsa( sDraxr ;t0tetnmi3tldlmDemu p;()alxoircoo1fm  lneslt)seuo(opou1al nlnvils  Dra( oot1tle  oeildfsDuauvpnu4arenmr3oytoateai i t)srtmxm3io1op nlivi s aDrm(  no1tlt ifciat a elnmsnt0tltoxr3iodfm e uvo;(0srtm(opio1llenlfvtas)a2urx pno1tlxoiietldls2eanmo;u4arxrircto1laD ln i ( texm(r no1alenlicta(  2urumono1tleoiiciytfmDra(vp;u) eeniocoatoatr i i t)s2ur(rpoydlmeemnetlt) rraurpnt0oet ifeias s2emn p u0altnir3oodom   uei;( sruo(o oo4al elnct t) 2urxr ot4tpe mi3iyt m uanvonu4aetnmo io1la  luvo;( texoxrpno1ale mfctat) rrmu oou4alt mfciydfm ea(mpnt0tetnmfcoy1latranvsl()sexmxm iodlp elnvi (fa2trxmono0oetnifetatla elumsn()aexnxfcoydlmDranes;( trtoirpiu4ol nmiesatfaDrm(rpou1alx iiciyd a2um(vp (4trxnxf3io1fateaies t0seurxo iu1apte ivtlsfarrmx pnt0tltoifetys m2em(ms u4 leoxr ty1opt aneo (0t2um(m3io1op nlici s  rta( p;u1tptnifctad s2eauvo u0 eerxf ty1oaD  ivo;s0 euoim3no4al emnvs t) 2rru ont4oeeoiociysfs2ulnmsn() lxrioctotlpt an o (0seto(o nu1oltnlivtls) rtm( o;o4aet if3iatlm2ra(vp u)alxoio3ty1fa  au s;()t2xo(mpio1al elfeil(f 2tax pnu1tleo i3ils aDuln p;t4aexrxo ty1la  ai ol(0setr(m3no4ape livta( sDurxronu4altn f3iltfsDrauvsn(0aetoircoydfmD li il(0texm(rpoy4apenmnei tfartmxmoou4altomoeiyt m2uan pn(0tleoxf oadomDeau i t0 etmxr3ny1ol e fes t)s2ur(r oo4apto feiytlmDel(vont4aetnmo3todfpDrau s;t0trxrir3iodlm nmfci sfs2trxro;u4tptnmoctasfa umu o ()treoxociytlmt  i i (  2xmxrpnodll nlfeia()s2uaum ot1texomo3taslm2el( sn(4tetnxoctytoatr n o t)setm(o ou1lpe mieils  2umu  nu1tetoifeiatfa rl( p;t4trermr3iatfaDran s s)tetoxo nudap nlnvt s) rtrumonu0alxoiieiyt s2ea( sn(0 ltrir3oodom eauvilt) rtmio3oudale  nctltfaDtr(rpot4teeo ociatfmDumnvp (4 rerxf oytlpte u o;() rxrim3oydomenliei t  2um(r ot4optomieilslsDrm(vs;u0trerifctydopDr ues s)t2urxo iudll emieslt) Dtrx p;t1apenifetldfsDrm(mon()aleoif oytopD auvs;()s2trxr iy4op   nvtat)arrm(mpno1tex  feild s2rl( o u4artnmfciodlpD au i s) rxmxr3oydopenliviltf Duaxm ot4oet  icildlm2rl( on()alerxrcoy1oate nes;t0t2xoiopiy1oltn nvtl(fs2ra(r ;t0apenmociydla2eln ont)aeeriocoodop elies;t t2xrxo ou4opeelicsat) 2ua(m nt4texo fciytls2eauvp;u4 rtnxr3io1opt aivo;t teum(r io4olenmnvta()s2urum nt0alxn i3iytlaDumn pnt0 lxnxocto1omDeaneils texr(opoo1lmeelict () rumumpou4apxo ietys s rl( snt4altoxf oa1fmte n i t)teuoir3nudoltelnesa(  2rau pnt0texnifciydfa2ulnvp;t0teermf3oatfaDelneilt)tetrir3oo4oltnmnvs (  2tax pot4aet  octls m rauvo;(4 exrmf3iotfm rln slt t2umimpnydale  nctlsfa2uaxrpot0alx  i3iydfm ul(vpn(4tetnmf ia1opD  n o s  2trir3ou1lp n iesls sDrax o;t4opt  ocilsfaDemu pn() etomo oa1lpt anvs;s0setmxr io1lme mfvtl() Drmumo;o1alt ifciyslm rau p;t) lxrxr to1lmDeaivols s2xm(rpnu1lmtnlicslsf rua( onu1aexomi3iatfa elumsnu) ltomo iatlpD lnvilt teuo(m3oydole mnciat)sDuau p;o1tetniocils aDel( o (
\ No newline at end of file
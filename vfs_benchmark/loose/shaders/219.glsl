@@ -0,0 +1 @@
+ieo t t2xmir io1ap nlivtlt s2rm(m ;o4tptnmi3iltla2ua( o;u)tlxoirciytfm e ieils0trtoim iu4lp e nvtlsfs2ra(  oo1apt moctys a ea(vsnu0 etrxf3ta1faDrluvs;s trurim3oydol   ivsat)artrxm ;o0ape mo3iasfm ra(msnu0 rermf iytomDrluvil( setmimpny4aptemfeil()aDtru  ;t4aetomfcildfs2eau p;u)tlxrxr iadom rln o;()sexmio iy1lltn ietls) rrrxmpnt0oeen i3tlslmDel( o t4aexnio tytlmt  ieolt teto(opno4ale lfvtl()aDrmx  oo0tee if3tysfm2uaums (4 rxrioctotomteauesls0seuoim3nodapt  fcsls artru pno1tlenio3iasfsDra( s;u0 eenmocoadlp eaiei ()trxoirpnodamt mivtat sDuaumpnu0tleomiciaslmDem( p;u)trerxf tadlateai o s  exr(opnodopeelnvt s s2uaurpnt4oex ioeilsfs um(vo t0teeoio3oy1op elneo;t seto(r nudom emicsltfsDrm( pot1aexnio3tlsfa2elnvs;t0texnxf3iy1lm  lnvo s0setoimpnu4lp   fetls)arua(m ;o4apeoioeiat m2um(vo u0trtnxr iadfm rlieol(0seurxmpnudol emnctls)s2rmxm ;t4tleo ociadlaDraumpnt0 eenir ootlatrlies;s s2umxm3oo4ll e nvt s sDrmu p;t0tpxo f3ilt mDum( sn(0trxoir iodomDelues ( teto(o ny4al  lies ( srumump;o4tleoiieiytlaDrl( s;u0 eerif3ootfptr uei;()srumim3no4aleelnctas sDumu pnu1aet ifetasla2emuvo;u4 rtnmo oatfm  lu o ( seuoxm3nu1ll nmncilsf Drmxmpot1olt iocildla ra(mp;u0aexrir3totomtrlnvilt)s2um(mpou4omenlfvsls sDtmxmp;u0tpenmoetasla emnmp u0 rxomf3tadoaDraneo t s2umim3oydom nlfcsasfartau oot4aetnio3tyd m ean s t)artrxf3oadla  auvo t)trtm(r3oydlmtnmivsa( arur(r nu4apxn oeildlmDem(ms u0 lerxociydlmt lu i (  2xr(m3nydlp nlies t)s2rrump;u0olxnmictldfs ra( o t0alxnxr3tatopt ln o;s) exmir iy1oltnlfes sf rtruro;o4tetn fctys sDea(vp;(0 etrmrcty1fmtrlueols  2xm(m3oydol elnesasf Dum(r ot4olx iocilsfa emn p;u0tlxnmf iydfp   neo s0 rtrxo iydlpe  nctlsfaDua(m ;t0aleoifetat m ean p t)texnxrcoo1oaD  nei t texmxm3io1omtelnvsa(  Dum(  nt0oet ii3ildls umn p;(0 rtnxo3iydlatraneilt)sruo(rpoydllt  ivs s)s2rru  nu4optniocildfs um(vs t4trermo iodomDr n i;(0srxoxo iu4ap nlnesa()arua(  ;t0oetnioeiasfs2rlu o t4arermr3oa1fpDr i s;()srxrxr3io4olee fetlt)aDtrur ou1oexoii3iytla rlump;t4texrxo to1op rli s;s)srtmio iu4op nmnetls srum(rp;u1oexnmo3tadfa eln p;t)aeenmf to1oa ran s t0s2uoir3nodom   ivtasfsDraum ou0tpxo ietadfa uaumsn(4trerif3ia1oateaneol() 2xrxm3iy4aptnmivsa(fsDumu p;u0aeen o3tad mDel(mo t)arxnmo oa1lp eaueslt0 2trxo3io4al nmivs t) 2taxr ;t0ale  f3tasfs elu snu)tleomf3iodomteaieo t)s2xoim3ou1lm elfcsls sDrr(r ;o1tpxomfeiyd s2um( s () leoxfcoodfp elneilt)trxrirpnu1al nlfvt sfs2uaurpnt0tleo ictatfm ranmo t4trxnxr io1lm r n s;s trur(m3iodaltelici (  Drmxrpot1tptn oetyt a2rlnmpnt4trenxfciotfaD ai o;t0 2uo(o3iudope lfesat srtrxmoot0tptn ociys s rl(msn(0 exomfcoa1lmDean sls)srxmxrpnu1ole mnci s  rtrxm no1oeen i3iydfs2uaumo t) ltrmr totoatraivsls trtm(m3nu1alt  nes t s2tmx ono4tle miciat s ran pn(4 lxnxociadfm   i o;()truoxrpoudlm emfvt (fs2umum nu0apxn o3ildfaDuluvonu) rxnxf tatfpDeaivils  rtrio3nydopeemfcsat s2tmxmpno4oeeoiietlt mDrmu snt4 reoxo3io1om rlnei;s)s2umio3ny4apenlnctlt s2uaum ou1texomocilt sDelnvpn()altrmr3tadlpDeau s t)s2umxmpnydlp emiei tfartmu pno1aexo f3iat mDem( p (4trxnxf3oo1oat ai ils)trtmxrpio1ape mictls)s2tr(rpot1olxo iciysls emuvp t0areoir3tatfmt aneslt)t2uo(m3nodalte fetlsfa2tru pnt1oleniiciyt s ean pnu) rtrxfcty1fmD  ueolt)trur(rpoudlpe mneta()s2tmx pnu0tle mietysfm ulumo;() lerifcto1oa rlies (0 rxrxr3io4optnmicsl( sDrm(  ot1tlx mociytla ea(mp;t)tlxoxr3oytfmD ai s;s)teuoir no1lp e nctat) 2rmx poo1oetomo3tld aDumnmo (4trtoifctydfm raivs ( seumiopiu1lmtemivia()artrxr ot0tpxn octytfm ra(msn(0aexomfcoy1opt au slt  exrxmpio4ap n fcia() 2uaxrpot4tlxniieiyt aDumn o u4tetrxf3oatlptran s (  2tmxopiu4ol nmfcsl()srrmxmpno4texniociytls2eauvo t0 rxnxr3oadfatr nes;()t2trirpio1aleemfvta( sDraxmono0opxo feiyd aDul(mo;t4arenio3oadomtr u o ()t2umir nudomtemnctls a2rmum ;u0optnmf3iydla el(vo;t0areomocty1omD luvo;t) 2xmxr3oydame  icsls  2rrx  ot0olto ociad m2uluvo;(0teenio ty1lp  li i s) euoim ou4lltnmfvslsf rumurp;o4tle  ietysla em(ms;t4 rtrif3todfp e nes;t trto(r3oy1aleemnctas s2rmu pno0oet miciydlmDumums;t4alerxo ootla r u o;(0trtoxm3iy4aleemfcilsf Drmxr oo0oee  f3iyt m2rau s;(4 lenxoctotlatrlueo s t2tm(rpio1apeelieslt)s2rmump;o1oeenmo3iadfsDem( on() exnircio1oat anvs;s s2umirpno1lmenlietls aDuru p;t1aexomi3tydfm2ulu s t0aleoir iodomD aneo;t) rumimpoudal  liei tf rururpnt4aex  oetas a2umums (4 rtoio tytoaDeaivi s seurim3io4lm nlfetlsfs2ur(rp;o0ale ifeiltfsDem( p;t0texrxo oytlmD auvo (0 etrirpnu1opeemfvsa(fsDuaxr nt0optomfetldfs2uau pnu4areoxf3io1faDr u s;( t2xmxr ou1oleelivi t)aDuaur ;o1optn ieiyd sDul( p t0 eerxfctadlaDelies (0sexmxr oo4optn nct s arrr(r no0apeo i3ias s uau s t0arxrircoatfpDraueslt t2xr(rpoodlmtn fes tf rrau oot1apto f3iltlm ean on(4 eerxr3oadfmDranes;s0trxm(o iy4al nmnet s)srra(m ;o1oeto ocildlmDumnvonu) lerifctodfpDeaues () 2uoir iu4omtnmnetatf Dtrxr ;t4oetnio3iytfmDranvo u)treomr ty1oaDrlues s)s2umxo3oudolenlict t)s2um( p;t4tle  ietld s rluvo;(0 eenir3oodom   iei t) 2uo(m3oydlltn ncia(f 2urxrooo4aexnmoeilslsDuanms;u)trtnmo3io1optean o;s)s2xrxr oudllenlfeiltfarta( pno4tee mieiyslm2umnvp;u0 leomo3iadoat luvi s)s2uoio3io4ol elicsa( s2ur(mono4tlxn fctldfs el(vsnt) lxomocio1faDrauvils) 2xoirpiu4omen iesl(fartaumo;o1alx mocias m2ul(mo;u)aetnmociy1lmD ln o;s sexmxrpoo1ameelict tfarrm( o;o1ope  oeiysfsDeaumsnt4 leomf3oatoaD  ues;( setoim oydlleemfesa() rur(r ot1oetnifeilsla em(vp (0texoxfctatlm eaiei;s sruoio nydoleemnesltfs2rrumoou4apx iicild s2emnmsn(0 eenmfctadfa  luvi;(0s2trio3io1aptnmnes ( arurxro;t0apxn o3ild s2elu s t4arxnxf3iy1oaDrlnvsl(0t2xmim3iy4omtnmneslt s2rru  ot0tlxnmietatfm ul(vs;t0tltrxo3ia1fmt aiei;( srurxm oodaptn ictlsf rum(root0aetoiiciat m uluvsn()arxnxr ootlp rauvs s)trur(m iy1am   nvta(fs2raxm ;o1teeo fctydlm2eluvo u4tltnmrcoo1oatrauvi s  rxmim3ou1ll e neiasf Drm(  oo4aexnifeiydla2ranms;(4alenir iatfa e ies;t)t2um(mpnodom elfvi sf rta(r ;t1aptn o3ilsfs ranms u0areoxf io1fmDe u o t)srxo(r no1lpeemfctltf 2umu p;u1alx if3iadfs rl(vo t0tltrmociatlmtraues s  exmxr no1ame mfvs tfs2ua(rp;u1aptniietltfmDuaums;(0trxnxf3io1fmD lnei s)srto(mpnydomt mfeiasf rra(mo;o0aexomocildls umu s;t)trxomocia1fatr n sls)teurirpiodolt mnvia(  rumxm ;t1oetnio3iysls umumonu0tlxrmf3io1lmDelues;s)trtrxrpiudllenmnvtat)sDur(mo;t4aeeomoetad a umump;(4 etomf io1fmDraivol(0sexmir iu4lpe  nviat arum(rono4teen fciad aDuluvo;(0altomo iatlatrlies;(  2uo(o nu4am e ivt ()a2tau  ou0tet  iciatla2emuvo;t0tlxnxr3iotop elnes (0seurio3oy1olte ictl() Dum(rooo1tetn ieiaslsDul( o;(0aetnif todoa eaivsl() rum(m3iodlp nlfcsa()srrmu  nu0oeen oetad aDem( pn()texnmocta1op rau s;( teto(r nu1alt lnvsls  Dtm(m ot1oee iieiydfs2emu o;t0tltnxr iy1lmD  i o s0srumiopnu1lpenmiei t) Dtrxrp;u4altnmiciadls eaump t4treoxr totlpteaueil()t2xrxm3io1llenmfei t sDraumoou4oeeniictas a uluvp;t0artrmo to1lm  lu sls0srxo(mpnodlmte fvil()a2um(roou1olt mieiydfaDrl(mon(4 lxnxrciydoateaies;s)srxoir3nu4omt  fcs t  Dumumo;o1tpxo feilslm ra( s u4 rerxocoo1lm r neo ()trxoimpno4om  mfeiltfa2tmx  ;o1tetn ociyt s2uaums;t4tleoxr3oy1opt lieolt0trxmio3nudape  nciatfartax pot0tlx mociltlm rl(msn(0tltrxociadop  au ilt  euo(o3ou1ole lfciat) Drrxm oo0tpenmo3ilslaDeau s (0 lxrmfcoydomt luei ()teumxo3oo1op nlnvias)a2tmu o;t1opxnmoeildfm em(mpn(4areoio3tatfaDeaivilt  rxm(o3oy4apeelnei t) rumumpot0tleomfciysfaDeauvpnu4aeermfcoadlat lieo s)seurxo ou4lltemnei t arrmu oot0apt  iciatfmDeaumo;u4 exrir3ia1laDe i il() eur(mpoy1lptemivtl(fartrxr oo4apeo oeildla emnms t0tleomo tadfp  livsls srtrxm nydal e nvi (  2ta(ronu0apxniociyd sDumu s;(4 rermrciydop   nvo;t0srtmio ny4lle lict (  rrrur ot4opxomf3iys aDumn p (0tltoirciadfpte ivi t srxm(r io4lm   ict s)srurxmo;t4opeomoeias s2ea(mpnu4 etoir3oodoaDrli o t0s2ur(m3iodop nmfeilt  Drmu  no4aee  i3tysls2elnvpnu4tetoxo oatfmt ai olt) 2xm(r3iu4lm n ictl( aDua(r no0oeeo o3tasfa2ra( p;()texrirciotomDeanei t) eumxm3iydop emfet s)srtmxrpot1oeeoiiciasfmDemumpnt4artrxf totlaDr ueo (0srurxmpoudlm nmfeta(  2rmx pno1ope ifciyslsDumuvs;()tetrxr oa1omtrln o;t0trxmxmpoo4omeelncsasf Dtmu  nu1aeeoiictlt s eaumonu) ltoxo oadfaDraieslt0texmxrpiy4op elfvs s)aDta(r oo4oleoif3iys m elnvs;u) eeoxrcia1fpDraivs t) 2uoimpiudale lictlsfartmu pno4aetnmfctydfm rlnvon(0 rxomf3iy1fm eauvi;s0seurxrpiydoleelieiltf rtrxmoot1oeto iciasfm2rlums;u4 lxnio tytfmDeli olt0srur(r iu4openmiviat) 2ta( pno1apt miciytlsDulnvo t4aetrmr oydfm e ieo;s) rtrio3nu4am e neta(fsDuaxrp;o0tetomoetadls2rmuvo;t0alerxo3iy1lat ln o t0t2tmim iudaptelfvias) Draxrpot0opt moctltlaDem( s t0 etrxo to1fm  lnes s) exo(o oo1alt  ieia( srrru o;o4teeniocildlmDrln s (0 lenif oo1opteln olt)srtrim nydol n ics s a2raumonu4oetoifeils sDemumsn(4 lxoir oytfmDrauesls) 2trio oy4openlietlt  rum(r nt0altoiictyt s emuvp;u4alermr3iytoaD  neo;s)tetoiopio1altn nei () Duaum nu4alt iictytls um(msnt) eenmociydfp ran o s0t2tr(r3iodlpeemfcs sfsrtru  ot1tptoif3ild a2umnvs t4alenifcty1fpDr u sl( s2xmxrpou1om nliet t) Dur(monu4apen ieiltfmDea(vsnt0altniocto1fa ranvo;() 2ur(opoydape lncs (fs2uru pou4alenifeiaslm2el(ms u4 eenifcoa1lpD  nvolt)trtrxm3oo1apte nct s)a2rr( pnu1alt iietat a em(vp;u0artnxfcio1op  lueol()trto(o ny1ap n icslsfsrrmx pnt1aetomiciytfs2rl( snu0texoifciytfatrlnvsls  etrio3nu1ap e ivsatfarua( ont1tpe moetyd m rln s u)trerif3to1oaD lneo;t  eumio nydameelfcs sfarrau  ou0alxniiciydfm2rauvo t4treomocoytlp  luvs;( t2um(m iu1lltnliesas  Dra(monu1aetoii3ildfsDrauvs;()tlerif3iytlm r ivo ()seum(rpnu4lmtemivta(fsrtmu pot0alx ioeiasfs um(mo u4texnxrcio1fmDrauvo s)srtmim io4ap emfvsasf 2rrxm no0oex mo3iltfs2em(msn() leriociydfmtean olt0 euoirpny1lpeelieiatfsDrrxrono1opeomociytfm2ulnmpnt)tlenxo iadfatrlnei;t) etr(o nodapen nviatfaDraumpoo4alt mi3tadfs rlnmo;t4tleoxf ty1fptranes t)t2to(m3oo1lptn nviat sDtmurpnu1tleoii3iadlm2rluvs;u0 eenxf3iadoptelues;t)sexo(o oo4ll elicta(f rua(moot4oetnioeildfm umuvsn(4altnifcoa1oat li o;t0sexr(o oy4ape mnctlsfaDrrx pnt0ole mfeilslaDulnvo u0 renirciy1lptr uvo t trtrim3oo4al nmnvi sfartax oou1aeenmiciytlm rmnmpnt0aeeoxr3oo1fpDr ueols)trumxr ou1openmnvsls)srtm(rpou0oexoioctltfaDrln p;(0aleoxf totfa eaies;s) 2xmimpiodam e nvtat)s2uaxm ;u4openmoeiytla2uaumpnt) renmr tydomt  u i;t t2trxo3no4lmtemncsa(f Dtm(r ot1apxomociys a elnvsnt0 ltnmo ia1om   uesls  eur(m3nudopte ics ( sDumxmpou0olxnio3iydlsDeln sn(0trenircta1optrli i;t) rxm(opiodam n nvsat  rurxrooo4tpe mfciytls ean pnt4trxoio tydfat lu s ()trxm(r3ny4aptnlfetl(faDraxr ot0ole ifetytls2eln s;()altnmoctadom  ai ol(0sexoxm3no4lp   nvi ( arurxrpou4alt  oeildlsDrmu p t)tlxnifciytopDe iesl(0trxm(opnydlmenmfctatfaDua(m ot0alen ocils sDra(mp u0 rtrif iadlmteaueo;(0 exrim oo1am e fvia(faDrru o;o1teto oeias s uluvo;u4 lenmf tadlatrai i;s)setoim3iodll emies s a2rrx  ;t4ole mociatlsDrluvont0trtrxf oydfm e ues t0teuoxo oodlmt mnvi t)sDrmxr oo0tpx mi3iys s ea(mont0alxnmf tadoaD li i t  rtmxr iudal   icslsfaDrr( ono0tle ifctltla um( p t4 lxnmf3iotom ranvs s seumio3oy1lm emfcsat  2um(ront4oexniietytfaDra( sn() rxomo3ta1op  lu s (0t2tr(m3oydalee ncslsfartaurpno4olxnii3tadfs uauvp ()teenmo3iodfptelnvs t  2uoiopnudomtelnei s arrmurono1oee  o3tas sDuluvs u4 rerxfctadfpD  nvslt trurxmpiy4om emieias  Drau pnu1tlt if3ildfaDumn onu)altoxf iodom   i il(0 rtoxopoodlptnmfet t sDra( oot0aet mi3tadfs2uan pnt4 exrir3iotfmtelieilt0 rtr(o3oodol n ncsa(  rrau  oo0opxo oetas m eaump;(0treoif3to1lp e n o;t sexmiopnu1oltelivt sf 2trxr nt4alx mi3iad s raumsnt0tlenxr tadfmDrai o t)t2tm(o3iy4llen fvs ( a2ra(m nu1tpt mfetas m2umu o;u)trtomo3oy1fp   uvs;( s2xmxmpoo4opt mnvtl( a2rmxmp;o1alto f3iyd a2eanmpn(4 rtoif todlpDeln slt)sexoxo3oy4ap  mfctlsf 2rrx o;t0tlxomfcildls emu p u0 renioctodlmD lnvi s0t2xo(m3ny1lpt lfvi () rtaum ;o0tle if3iat mDrmuvs (0aleoxf todopteln i;s0tetrir3io1ale  iesa(fa2ur(m ;t0oeeomfctytfm2rmu sn()aleoir oytomDeau i;s)s2xo(r ou4lp   netat)arurumo;t1optoiiciatlm2rmnmp;u4 rxoircoa1oateli il(0trurio3iodlpenmfciatf 2rauro;u1aeenio3iasfm2ulnms t)artomr oo1fpDraivo () 2xo(o no4altemncsat  rurx ont1alxnifcilsfa2uanvpnu4artomo3ia1la r neslt0s2uoxopno1ope mictas sDumump;o1ale  i3iyd m2umnmo t0alxnif3oytomte i ilt  eur(r nu4ale mfetl( a2rru  ou4tlen feiydla elumo;u4 eermo3todfm e ivi s0 eto(m nu1lptn iet t  Durump;u1tpeo oeiysfaDrmuvpnu) rxnio3oy1oaDr uvo;s0s2toxr iydlpen fcia()a2rrxmpot0alt  fciydlm ra(ms;t)aexrircoa1fa rlieo t)sexo(opiu4am emfcslt arrm(rp;t0ale ifeils aDem( pnu4treoifctodlp rlnvs;s) eumxopoudlm  mivt (  2ur( o;u0opxoifciltlm2em(vp t4aexoxr3io1lm rauvslt teur(r ou4ale mnctlsfa2raxrpot0olenmf3iysla2elnmp;t) reomrcoadfmt aivol() rtm(o3oudlmtemiciatf 2rr(m no0tpe mfetadfmDemuvs t) ltoxfcoo1laDelueils0seur(o3oodape  fei s a2rrxronu4alxniociys m2emnvsnu0 renmf3oytoa elu s s trxmiopoy4lm nmnvtasf Drmurpoo0aet moeiyt mDrau pn()arxrxrcoydlp elu il( setoir oy1ope  ieilsfs2tm(m no4tptomo3iaslsDrl(vp (4arxnio ta1fmD livi t)seuoxrpou1ll nlietas)s2tmxrooo4altn i3ilsfs ua(vpnu)artomr3ty1oa e neilt sruo(r3ou1lpeemici (f rtrur ot1tltomieilsls2uaums;u4aetnircto1lmD lieo;s0 exoxo3oudaltelfvs sfa2raxr nt0olxo iciadfs2umu pn(4tltoif iy1lptrau o;()s2xm(o ou4ap e nciasf rra(rpnu4aex  ociltfa rm(vp u4 eerxocoydoaDranvs;(0t2trxm iu1llt licsa() Durump;o4tlt ioctatfs umn o u0 rxnxrctatomD anvs;t) eurxr3nu1amtn fvias)srra( ono0alxn i3iatla rm(mp t0 etnmo3iy1fm eai ils  exo(r3oy1ap emfci s)aDrrx p;o4tlxnmf3iltla uanvo;t0trxnio iytlat  i ol(0texrxm3ou4llenmncs s)aruau  ou4tltoifeilsfsDuanmo;t4alxrifcoy1fat aues;s) 2uo(o iudlleemfct s srtaxr ot1tlxoifctlsfa el(vpnt) eerxoctodopD  u ols setrio3ny4am elfvtasfs2rmxrpno1olxn ictydfm eauvs u0artrif3iodlm r ues;s) eumxrpoo4lptnmfeiat) 2taxmpno1aeto fciasla2rauvs;(4 eenif oadfa   i i;( srtmiopnodale  net s) Draum ot1olx mi3tasfm2um(mpnu)trtnxo3iytfatrluei (  euo(m iodol n ietat) 2tmu  ot0alxn ictlsfm elu p (0 ltnmr todlmtraueolt)srumim3oydape mfvsat)sDum( poo1apenif3iadls2uln p (4arerxrctatopt aies;t0tetrxopiodomeemnesas)sDta(rp;o1ope mociydlsDrl(vs t4texrmo3iodlptr n s;t0srto(rpou4lpe mfcias)sDrm(moou1oeeo o3tlsfaDel(mo;t4 exomociatlmD ln s;( t2uo(r3ny1am elfvias) 2umxmpot0olt  ieiyd s2elnms ()aeeomfcoo1lm rlivi;s0t2xm(mpou4lp n nctlt aDtmurpno0oeto fctls m ea( o () lxnxf tatoaD lues t) rxoio no1lpt mfeias  rraxm oo0texn i3iad s umuvo;u)arxrmf oa1lpte uvs;( srto(o oudopt mfeslt) rra( onu1tlxn ictadfm2el(mp u0 reomr tatlm  au o ()sexr(r3nu1amtn net sfsDuaxrpot4oltniiciytfsDemuvont)arxrxociotfmt  n olt trtm(o nu1ol nlictls arururp;t1openmociysls ua(vs;()texrir iatfmteliei (0t2trim3oy1am elfviasf 2umumpnt4tleniictytfsDrmuvs t0 rtrxr3iotfmDrlues;s  rxrxr oy4omenlnctat)srtmu p;t0tlxo f3iytfa2umuvo;(0 renifciydlmDeln i;s  eumxo ou4am  licilt s2tr(  ;u0olxomiciat mDrluvo;t0areoxo iatfaDean i;t)sexrxo nu4lp  mivt ()s2tmu p;o4ape mi3iytfmDea(vsnu) reoir3iy1omD aivol()t2toxr nu4lpe lfvilsfa2rmxmpou0open ocilsfaDul(vp;t) rtomociytlm e nvils0 rtrirpno1lm   ivs t)s2uaur ou4opeoioeildla el( p;t)tlxrif3oa1omt lu o;s0t2xo(opio1lpteliviasfa2tr(rp;t4oex  fcils a2ua(mpn(4arerir tytlpt lnei;t s2xr(mpno4alteliei tf ruaum nt1tptnmfciyt a2umu o () rtniociytlate uvs;s teuoxr3ny1opee fvi (  2uax o;t1teto ociatfa2emu s u) ltoxoctatla r i olt  eumim nudlmtemnci t  Dur(rp;u1tltoiietyd m um( ont) lxoxfciotoat an slt)trtoim iu1am nmivtltfaDua( o;u1tptn oeiyslm ra( snt0tetomr oo1la  lieil(0 rxo(mpiydlpeelnet (  rtr( ont4oee mo3tldlsDulnmp;(0alxomr3todlpDraiesls trtr(rpnu1ole mfvi sfs2rr(mpoo1tpxn octltfm uluvp;t0artomr3iydlm eanvi;t0setmxrpnudal elfct (fsDuaxmono0oee  i3iytls2emu pnt4aeenmf oadoateau sl()texrxr3oy4amtnmics s) Dumxmonu4tltomi3tldls2rmnmp;t0tltrif tydoateaueilt) eurxopiy1op n fcsas a2ua(m ou4olx ifctyd m rl( p;u) rxnmr tadoa   i slt s2urxm oo1opt  iesa(fa2taump;u1altomociytlm rm(vs u0 leoio3oytla  liei;t0srum(r3oy4om  lnvia( a2tmur no0tetoiiciatfs uanvp t)trxrif oo1omtraivilt) 2urxo3oy4olee fcilsfs2tmx o;t4teeomoeiydls2um(vp (0trxoxf iytoaDeau s;(0truoio3io4llt  feils)aDtm(m ou4aeeo fciaslm2rl(vonu) eeoxr3ootoptraies t srxm(rpoy4om  mnciat)aDtr(r ;t1ape if3tyt m emump t)arxrxr3totfaD  uvs;s)srtoiopou4alen iviasfsDumxr ;o1aex mi3iydla eln snu0 lxoxociatomtr u o ( trxrxmpiudlm  lics t)sDrr(mono1olxnio3tydfsDem(vo (0 eeoxfctadoa rlnvilt0sexoio ny1lmtemneias  rta(r nu0oex mocias aDean p;t0 rxrxr3iy1om  liei;t)srtoxo3ou4ap nlneiasfsrumxmoou0apt ii3iysfa2eanmo t4tlxomf3oadlat lu ilt) 2urxr nodapt lnvslsfaDurxr no4ope  f3iasfs uau o;u4altomo3oodfmt aues t) rxoxopoydlltemnvtl( a2tmu ont0altomfeiad mDeaums;u0trenmr3oadoa eluvi s s2uo(m3oy4ll emncs tf 2rrumpnu0aet if3iltfa rmu o;u4artrio3oytlpDrlueo s  rxr(r3iu4amee fvtlt)arum(rono4aexomi3ildlm el(mpn(0 etnmo iotom   ueo () etm(opio1llt mfesa()aDtmxmoot4tlenmocildfsDeluvonu4tlenmf ty1omDeliei (0trtmirpiydomt  fcta()srua(m ;t1aexomieiyt a2ul( s u4alenir3iatlaD aneils0s2xo(o3oy4olee nvt t)s2um(mpnt0tet ii3iltfmDrl(vont4 rtrmf3tatfa r nesl(0trtoxrpio1lptn neslt) 2uaxr ;o4alxoifcild m uanvo t4alxnmo3oydfa  auvi;s sruoim oo4amtelicilt) 2tru  nt1aetoiociys s umnmo;t) rxoxfcty1lm  anesls)t2umxo ny4lmenliei s)s2taxroou4alx moeiyd s rln pn(0altrmrcia1opD livi s) 2xrxm io4lp emnet t sDrrumoou1oexo octatlm2eauvs (4 exnxrctadlmtraieo;s0trurir3nu4optemiesat a2urxm ;t1aexniociydfm2el(mon(0 ltrxf3iadopteluvs;s)s2triopoy4omt  fvsatfsDua( poo4aex iiciasfm2rmu s u4 ltnmrctytfaDeln ol(0srxrio3oudop emneia()aruaumpou0tpxnmieiat s rlu o;()trxnmrciytlat au s t) rtm(m oudlmenmict tf rua( p;u0texnioctydfm rln p;()arxoxfciadlpt ai sl()setmimpoy4om   fvsls)s2trxmpoo1oexomi3ilsfm ea(vsnu)tetoxocootopD  uvils0 rxrimpou4altelnetltf Drru ooo4alt ifetltlm2rauvonu4 ltnmfctadfpDrli i;(0setm(o oodllt lfcilsfartmx ono4tee iicias s eau s ()alxomr totopD anei s)sexoimpiu4lmt livsatfaDrr(m nu1tpxnii3iltls2ul(mp t4 lxnmfctatfatr neo (  rxoim3oo1ape micsatf rrm(r ;o0tltoio3ils mDulumo;t0 lxnmo3ty1omDe uvi;t0s2uoiopiy4olte ivtlt srrm(mp;t0tlxnio3iltla2uluvon() exrxo3totlmt  n ils) rxm(o3oo4ale micil()a2tax pou0tltomoeiytfm uau s u0tlenif to1faDe uvi;s seurio3ny4lmt mnctl( sDtmu ooo1olt  o3ild a2el(vs ()aeeoir ia1omDr uvolt)trur(r3iodam n fctl( a2rauront4ope mi3tys a em(vo u)trxnxo3tatfpte nei s s2to(r iu1am  lfvsls) rtr(mpoo4tpt iietlsfsDumums u4 eeoifciotfa  anvs s  etrirpno4lle  iet t aruau pnu1oexomocildlm rmn p u4aeeoxo3oytomDraueo t) 2xoim3no1aptnmietl( aDrmu oou4olt iociyt sDeanvs u0trenio3oodoaDe ies (0 rurio3iy4lmeelnesat arrru pot1alxniociltls2emn s;t0 ltrif io1oa  li i;(0s2umir nu1lmt  fes t  Drmurpot4oltn fciydlaDemn on(0 lxrmrciotoate i slt)srxmxr oo4ll e fctlt) 2rmxm nu0apeo i3iysls2uauvo t0arxoxr3tytfpteai s s0s2toxm iodomenmnvta(f rra(  ;u1opeomoeiydfa2uanms;()aexnio3iodla elnvs ( trxoxr no1al  mncs s)a2raurpot4texnmfetldla eaump t0aexriociydfaDraivi;s0t2xoiopiu1oltn ivia() 2trxrooo0oeeomfctatfsDumuvp;t0texomocootopDranei;t0 eto(rpio1lp  mnctatf Drm(m nt4oeeomfciadlm2emuvp;(0alxnmr3iytlmtr uvi s teurxopiy4ome mncil(  rtaxrono4apx miciydfm2rlump ()arerif iy1fmD  u s;s)t2uo(mpou4al nlnctat a2tm(m ;u4olenmocildlsDuanmon() etoxf ia1lmte ueo t  euoxrpoo4ap elnvta(  rrrx oot4tpenmictasfs2ea(mp;u)alxnxo oytfmD  n i;t setmxrpny1ll nmies s s2umx  ou0openiiciad mDrl(von() rtoxrcto1lm  anvsls) rtrxm ny1lpt  nvsl( arrruroot4olxoii3tysls rm( p;(4 rermrciotomteau s (  2urio iu4al  lfci t sDrmu  no4tlx ii3iltlsDel( p;()texrif3io1lpteli o t)srum(m no4opt  neiasf 2trurpot4oetniietad sDrmn snu)teenmf iodfpD  nvslt0 rxo(mpiu4am e nvi tf 2ua(moot0tltomi3iadfa em(vp t0aetrxr ty1optrlues ( srxm(r3iy4lmtn icslt srurxmpnu1altnmietadlmDemn onu4teenir ia1lp  auvi t0t2trxmpiydamtn fvs t)s2trurpou0oex  fcildla2rau ont4teeoxo iy1laDelneo;s trxrio3nodomenliviltf Drrx poo1opxomoeiltls uluvs;t) lxnxfciodlp eli i t0srurxr ou1lmenlfcias)arumx p;u4olt moctadla uan s (0texrmfciodlaDe n s;s) ruo(r oy1oltnlfesas)arrm(  ;o0tetnmi3iltfmDumump u0 rxrmo oatomDr n ilt)t2tm(r iodlle mfetlsfa2ur(rp;t4oeeoioetasfsDel(monu) ltoio3tadlptelivi s trxmio oudop nlncs tf Dumu pou0opeoii3iad aDrm(mon() exoiocoy1lptr i olt)teurxmpny4optnmfcsa() rtmur oo0oltnifciadfmDrmnvs;(4 lerio iydoaDr nvsls) euoirpio4al elfctl(fsrrax pno1altomfeiydlaDeluvsnt)teerir tydlp  lnes;t)trumir3io1am elfciltfaDumxmono4alx  iciyd s2raumsnu)aexnmf to1oa e ivo;t0s2um(r3nodlpt lietlt s2trum ;u0olt  i3iaslaDean s u) rtomo3todfpDe ieils  rur(opoydol nlfciat)srtau p;u1oexo o3iaslm2uan p t) rxrxf tatoptrau sl()seuoxrpoo1op n ncsls) Duaxro;u4ope mieiat sDea( o t0 etrmocoadlm ranvi;( s2toxr3oudlle  feilt  rrrumo;u1apenmieiasfm2emumpnt4arxrircia1fm  liei t tetr(rpiy1alt licsltfa2taurp;t1alxo f3tlt aDelnms;t4aexoxr oa1fat aivi;s0t2toimpoudlp nlnesa( s2umum oo0ale iociys mDrluvon(0 lxnxoctatfpDe neil(0teto(o iu1lmee nvias) 2rrx o;o4tle iieiltlsDumn o;u4 etniociy1opt aiei t t2uo(m ny4ale mnctlsf 2tru ooo1teeomicils a2uanmo;(0aetrxf tadfpD lu s (0 2trxrpoo1apt lnvtltfaDrru  no1aexnmi3ildla rln onu0aetrir3oo1fp ranvs s sexm(m3iudol e fviatf rtm(  ;o1alenmi3tls s2ea( snu)trtnmfctatlp  lies;s)s2xmio3no1lpee nvtasfarrmurp;o1oltniieilsfs rlnvpnt4 etnxocoadlpte i o;(0 2umxmpnudapeemnvsltf Dtr( pno1alx ifetyt m2rmnms t4altrio tytopte ieo;(0 2xrxr ou1al n fcs s)a2umxm nu4oee iociat m ran s (4 rxrif tatop e i i;(0s2toxrpiy4ll elfes (fsrtrxmpnt0aptn ictatlaDra(vonu)trermrciydoptelieil(0srtr(r3oodlltelivs t)sDtr(r nt1apxnioeiadfsDel(vo (0tleoxrctydlmDe neslt t2trimpiy4llenlicsa()sDta(moou4ope  f3iytlm rmu snt4arxomo io1fmDr n i t  exr(opoo4aleelfct t) Dta(  ;t1ale io3iyd s2umu o;u)tlxoxrcio1fp raneo s)s2xrxr3iy4optelnvta()srtruro;u4tpxomi3tysls2el( snu4 ltrxf iotomt aivs s  rxo(o3oudope  nes tf 2tmu  ;t0tex  o3tad a rmu s;(0trtrmf oo1op  li il(0s2uoxrpiy4oltn ncilsfsruaumpnt0oeenmociatlsDrmuvp;u)areoiocta1om   ivo;t srurxr3oo1lp e ncs (f 2rru  ;o1olxnmo3iyt aDelnvp u0 etomrctydlm  aivo s srurxopio1opee feslsf 2tmxrooo0apen iciyslmDel(vpnu)tlerxoctotfat lnvs s t2ur(r3nu1lptn ictat)a2ur(m ;u4tltomoeilt sDean p (4tltomfcoadop   ivo;(0seuoim3no4al  mivil()aDra(mp;u0aexn oeilsla2elnvp t4trerxoctadfmDr ivo;( tetmirpou1lp e nvs (fartmxroou1teeoifetlsla2rlnmpn() renir iytlpD ai o;t srxo(m iy1lpe lnctls)sDrrxr ;t1aee mo3ilsla2ea(mp;u4 rxrxfciy1oaDe u o;(0srumxo3ny4alen fet s sDtmx p;t1alxnmoeiyt m2emn p ()trxoir iy1lp   uvs t sruoir3oo1op  lnesa()a2raxr ;o0teenmietltfaDua(mo t0 rxoxf iydop   neo;t srtr(r3oy1alt  ics t)sDua( oot4alxo feiad a rlnms;(4texoif totfaDe ivs ()setoxm oy4op n fesltfs2trur ;u1apxnmi3ilsfa rln s t) etrio3iytlaD  ies ()texm(r iy4optelnet () 2ta( oou0oltnmf3iadlmDeauvp u4 etrxrctatop rauvols0 rtrir io4amtelivsls  2rmurooo4alt  fciyd mDuan p;t4tleniocoy1oat  uvs;t0sexmxmpno4lpte iesasf Drr(rpnt0alt  feils m ua( p t0aetrmr3ty1omD aivi ()teurir no4openlnvils)s2tm(m ;u1aleomi3iytlmDrau o;u4aetoxociodopD  ivolt0seur(r io1om   fcslt srrmurpoo0tptoioeiytlaDuln o;u)aetrio ty1lm  auvslt0t2ur(m no4olenmietl()srtax  nt1apeomieiys m2emnmsnu4 exrxo oatfpD ai s t)t2xrxmpiodlpen icsl(farum( p;t0apt  f3ilt a rau o u4arerxociytlaD lnvi;t) rtrxopnu4am nmiei sfartmxront0tpe ifetasls2uan o;t)tlenxo3ia1fa r nvsl()t2toxo io4ole  nci s) Dta( ont4apxomo3iydlmDrlnvs t4 etrio oodomDelivo;(0seurxr oy1lltemnci () rtm(mpou0aptnmo3iys m2rl(mo u0teerif io1fpDeauvol()srtr(mpnydoltnmnei s) 2rr(m no4oexomfciatlaDua(vs;t4 rerxoctytlm   ues;t0t2tm(m3iudlm n fct sfa2rr(mpnt0apenmfctys a elump;t4trenxf tydopDe iei t seuo(o ny4aleelictl()srur(mpou1aptomiciysls2elu snt)aeerif iatla e uvi t0texo(o3ny4ameemnct s sDtm( poo4apx ifeiyt m2um(vp (0 etnio3iytlaDranvsls0 eur(opnu4omeelfvtls artau  ;t0olen ictatfmDulu on(0aeeoif3tatfp   nvo;(0s2uoxrpny4olenmieslt  rta(  ot1aet  fetasfm2uan p t)teenmr iatlmDeli olt trumir3oudapt  ictat)srrru  ou1oexoioetas mDranmont4arerxf3iatlpt ai s s)trxm(rpnu4lp  lfes t  2rru  nt0ole mfciytfaDuauvpn(0arerif oy1oat aivi t0seuoir3ny4ome lnetatfsrtmu p;o0tpxomiciltfs raumpnu0tetnif oodfmD ln o s sexrxm ny1ll nmfciat  Dtrxmp;t4oeeomf3ias s emuvo;(4 exnxf oa1fmt ln s;t0 rur(opoy4amen fvs t  rrruro;o0apt ifciasfs rmuvs u4texoio oodfmDr nvils truo(m oy4ape mfvtasfsrur(mpoo0opxoio3iadfs2rauvo;t0 etnir oadfptrlnvilt0setrir3oudom emnetasfs2tau pno0tpx  iciyd m rm(mo t) rtnmf3io1lp eli ils)t2tmim3iodlpeelnetat a2rr( o;t1oex mf3tasfa2rl(msn(4 rxrif3tatoaDr ueil() 2urir3nodlm  lneils sDrrump;t0olenioeiadfm ea(ms;t) etnirciodomtr uvi;( setm(m ny1al  lncs ( aDtmum no1teeoifctlsfm um(mpn(4aetrio3to1fm r uei;( trtr(o oo4amte ictatfsDtruront0alenmfetyt s rmn pnt4altnif3iotfm rau ols s2xoxo oy1lp emiesls sDumur nt1apt  oeiasfm eluvo;(0trtomf todfmDr uvs;s0 etrxm3iudope  fcs t sDra(m ot0aptoiieiytfs2ulu onu4areoio iatlp rln ols0 ruoim3ny4llt mfcsls sDrm(root0ape  fetat sDra(mo (0tlermf3oa1oaDe nes;(  rumir3nudll  lici tf rrm( pot4opxn oetysfm rluvp t) rtoxr3tydoa  livs;s t2trim3nu4al emfvils  2tr(m oo1opeomiciadfs ulnms ()tetnmfcty1oate iei s0teumio iodom e nes sfaDtrxmpno0aexnmo3iadlsDemn o;u)aetoifcio1faD aivs;s0t2xrxrpiu1al nlfei t)artrxm ;t4texniociatlsDemnvo (4aleoircoadfpDelivo;t)setmxo no1lm elnei ( srrr(m ot0ope mictyt aDemn sn()trxrif3iadom rln o;()s2uoxopiy4op   nctlt)s2um(r ou1oexnmieilt s2elump;(0trtoxocia1fmtr n i (  euoxo3iy1ol   ictatf 2tr(rpnt1tpeoiocilsfs2rl( o t4 lxrio3oodlpDe u s;t srurim3no1omeelivsl(  Drau  ;t4oeeomieiadfsDrl(ms;(0altnxo3oa1fmD li s;t sruoxm ou1olee ivsl() Duax pnt1oeto fctlsfa2rlnvsnt)alxnmfctadfa  ln o;t0 rxo(mpiu4lpe lfesas)a2taxroou0opeomociyslmDuln p (4areoxfciotlptr u o;s seurxr3iudam nmfci t  rtm(mpno1oexnmieiat s2umnvsn(4tetrir iydlatr i s t0s2toxm iudopeemivsls s2ua(mp;u0aexnio3ilt m2emnmpnu0arxnio ootlp  livilt)t2ur(m3nudlptemfet ()a2rrxronu1tpeoio3iydls el(ms;u)tltrif3oy1fat livs t)seur(opno4optnmivt s s2tm( pnt0alt if3tlt a2ra(ms;t0artoif3oy1fmDeluvi ()srxm(rpnu4op   ncias a2rau  ou4opxo f3tldlsDrm(vonu4 ltoxociydfmtrau i s  rumiopnu1al nmnvias) 2rm(  ot4ole mfeiadlsDranms (0trtnxfcio1opte nvs;s)t2xoio3nu1ap elncils arrrxr ;u4apt mfcild s ea( o;()artnmr3io1fmtean o;t)trum(opou4am elnvs (fsrtr(ro;o4tlenioctysfmDrau pn(0trxrmo3totfmDean ols  rxo(mpiudlp elics (  2raur nt4apxnmiciad mDeanvp;()teeoir totlpDeli sls  2trio3nodop nmicilt  rrm(rpnu4oetomfetydfaDrauvonu0alxnir3oodfpDr ueo;()texr(opoudope livils)s2tru p;t4oleoiociadfsDrmu p ()trtomr ia1op   nesls  eurxopio1amtelieslsf Dtm(rp;u0teeomfeilsls rlumont0trxrxr oydlmtrau i;s0texm(o no4optnmieiatf 2tmur ot1tet mi3ilsla2uau p t)tlxrif3oydla   i s () eurir3iy1ll   fcs t  rur(mpnt4tpt iieiyd mDelnvpnt) lxnmrciadoa rlivo;()s2urxm3oo1olt mnvsls  2trx  ou4aeeomiciadls2ra(vs t) lxoio oy1fm rluvo;t t2xrirpiodll   ncs s) Duaxrpnu1oexoioetltlm ua(mpnt)tetrmr3oy1fpDrlnes;s s2xr(r oodolen iet ( sDuax poo0apto i3tldfa2eanvo (4aeenxr3oydopD ai i;(  2xm(r iy1ol n fcil()sDtaxm oo1tptniietys m2rmn o;t) rtrmo3oo1fa  ln o t s2xm(rpnudomtn fvsasf ruaum ot4tpx  fetls s em(vp t0tetoxociytlptelieol() exrir iudoptn nvtl(f 2ra(m ou0alxnmf3tydlsDul(mp u0trxnxfctadoa eluvo (  exrir3iy4llenmivtlt)sDua(r ;u1tet  o3iltfmDuluvpn() exrxfctodoaDeai o;(0setmxo oudameeliesat)arrau  no4alxo o3tydfm2elnmpnu4alxoxfcoatlmDrauvo t)srum(r ny4op  mnvs sfs2tm(  nu0apenii3iytfsDul(msnt0areoifciadomtrlneolt srxoxm3nu4opeelneia(fsrtrumpot0oet mociad a2um( p;t4trtniociy1laDe nvs;t) rto(o3iudolt mfei s  ruau onu0texn oetytlaDra( o t) rxoxo3oytfm elnvo;t0s2xr(mpiy1ol  licilsfa2rax  oo0apxo f3ilt s ea( o;(4aeermf oy1omDelieol( t2uoirpiy1lmtnmneias)srua(mp;t0ole ioetat a2ea(mont4alxomoctotoa ran ols0s2xmxr3nudap  lfvslt s2ra(ronu4alxnio3ias s2rm(mp;(0tlxnmrctotopD an o ()sruo(mpiydal elfetltfsDumxrpoo1apxn ietysfs rmu s (4trxoxr iytop  ai i;t)t2toiopiy4ale mfvsas  Dtr(rpoo4olx  iciytlaDemnmp (0 etnxf iy1la rauvi s)texoio iodlltnliesa(faDrrx poo4tpxo icilsla rluvont4trxrifciotla e nvsls  2xmxm3nodop elnetltfarua(mpnt4ape ifctysfaDranvp t4alenxr3to1fp  ai i;s) rxr(o ny4lm n fvs sfs2tmu  nt4apxn o3iytlaDra( snt0 lenifcoatfp eaues t0trxo(opnu4am e nvilt s2rrxmoou4apx mfeiatfs2eau s;u)tltnio3iy1omDean olt0 rxoim oy1ap nlivt t  ruau ooo4tptomietltls2eluvo;()tlxnif oytlaDelneil( tetmimpnu1om n fcia()sDum(mp;o1olxn octlsfm em( o;(4 etrmfcoydop  ln i;s0 2xoxo iudomtelfvtls) 2raur ;t1texo iciydfsDulnmo;t0arxoif ia1lptr ivolt)tetr(o oy4apt livsas) rtrxm nt1tpeoiiciytfm elnvp ()aetrmr ta1lpDrluvi;t0s2umxm nydol  mnesa(  rua(  oo4tle iieiys m eluvpnu4arxrmf3iydfm   nvo s0setmir nydlme lneiasfsDtmxroot0oeto fcildlsDrlums;() leomfcoytomD  uvo s)t2xrxm3nydale mfviltfaDraxmp;t1tlt if3iltfa2emnmp;t0aexnir3totlate neo;s0texr(rpnu4openlnctlt sDtr(moot1ale miciltfs ranvs;(0trtnmf tydfp rlies t setmio3iu1omte ivt s sDurum ot0olxo ictasls2rlnms u4 eeniocoydfmte uvol() 2umxopiodlpte fesasfa2umxrp;o4oleoioeiyt aDrmn pn(4tlenmo3iytlptr i i;t)sexm(rpoo4amt  ieils)srrmumonu0oltoif3tat s2ulu p u0 rtnxr3iatfptrlu il(0 etoxo oodalt  nes tfs2ra(rono4aeen i3ilt aDrlnmp;t4alerxrcoytlateanvs ()teuoir oo4al   ivtls srrmuro;t4opt  fctldfaDem(vp u) ltrir oatfp eaneil(0trxoio iy4lptnmieta( arrau p;o0opxo ociydlm2elnvp;()aetnmrciy1la  aieo;s)texoxo3oudale  ietat) Dtaxmpoo1olt ifctlsls2uanvp;()tetrxr3iotlaD  u o;t0seuo(o3oudop  mneiatf Dtmxmonu1oeenif3ilt aDum(mp;t0 ltrmf iotfp ran o (0 2toxmpiudlm  livslt  Drmxmo;t0tpt mo3iatfs2umnms ()trxoxo3iatfm  luvo;s0 rtmxmpnydaptelivi s a2um( pou0oeeomfetas s rmuvon() rxriocootoa  lneil( texoxo oudape  ncs sfa2rr(m nu1altoio3tlt s ea(vp;(4arxnxfcoatlmtrai o;s  2umxo3ou1ap nlnet tf 2rmxmpnt4apenmfctltlm rlnmp;u0alxoxo3iotlm rlieo t seuo(r nu4am emnvsl(f 2uaxronu0oeenmoeiysfa emu snt0alermo ootoa  lnesls0 etmiopoudll e feilsf 2um(r ;u0tex iietydfmDranmpnu0 ltrmr3totoaDeau o t0 rurim oodlle  fctat sDtm(  no0tlt  oeiad a2uluvpn()texrxf3tadoa  anvsls0srxoxr3iy4lleemics () 2uru pnt0openio3iadfm eln s t4 ltnxf tatfa rauei ( t2umxr3io1op emnesa(f rur(mont4alxn ictat m el( pnu0 rtnxr ootfmt  u o;s)texmio ou4apt mfcsa(  rua(mp;u4opxnifeiytla ea( p t4 lxnmf ty1lpDe ivi;t0s2ur(m iy1llt lnvilt a2tr( pno0tpxomociytlmDean snt4alxrmf oytfpDrln o;( trtmxm3oy4lme  ici ()a2raum nt4tee iieiydfa2ea( s;t0 leoxr3oo1faDe nvi;t) etrxopnodll  lnctlt  rtr(r nu4tltn oeiydlaDra( s;()arxoiocoadlaD aieo;(0 etm(o3iy4om nlncsat  Dtrx o;u0tet ii3tytlm2ul(msn() rxoxo ia1oa raieo t)trum(m3ny4oltn nesa(  Dtr(rooo1olx mi3tld a emuvo;t4tetomo3iydlpDelneil( seumxopnu1lm  lfvt sfsrua(ro;u1optn i3ilt aDra( s;u)teenir3oytlm r i o s  rtrimpnudlmtn nvtls) rurxr nu4teeniiciyslsDemnvp;t4 rxniocoydlpt  uvo;t)srtmxm3nydlpe mfes ( srurumpoo0aleomfeiydfm2rmnmsnu)tltoirciadfatelu i s)tetr(o ny4lmt  net ()artrxrooo0tlxn i3ild s uau pn(4tlxnmf oatfm r u i t0 rxo(m3nu1lltn iesl(fsrtrur ;u1aeeo ieiydlaDean p;u0trxoxr totlp eau ol( seur(o iu1llt livtatf Duaurpou1tpxomf3ild m el( ont0texnir3iydlm r u s;()s2to(m3oo4llte ivtls aDrr( pot0oexn feiatlsDranvp;t)teeoioctydfatrli o;(0t2xm(opou1ome  ietat srur(m ;t4ope mo3tytlm emuvo u0arermr iy1fpDrluvils trtm(mpoodomt lncsatf Dtaxroou4ale iicilsfsDulu o () exomr iatfmtrai o s srxo(r ou1lmen fvtas)a2um(  nt0ale iociytfa emnvo u) eerxfcty1latrlneo;t  2um(r iu1op   ncsas)aDraxrpot1oexnmf3iatfaDemumonu4tleomf3tadoaDr n i s)setm(o3ny1lle lfesl()s2taxmont0tltoioetydfm uanvp;t0 leomo to1omte i i ()sexoio3oodlpe lieia(f 2urxrpnt4tptnif3tatfs umu p;(4aexrxociodlm  lnei (0 eurxm3no4omen ictls) rrm( pou4oexoiietytlm rauvp t)aetomr oytlm elueols) 2xrxopoodlltemiei ()s2um(mooo1open oetytfs ranms;u4 lxrxfciadfaDe uvo s0t2toxo3oy1lm n ics () rtmuroot1olxn o3ildlmDrmuvpn(4aeenio3ia1oat lnes;s0t2xmxm iy1olt  ncsas sDurx  no1open ociysfm rmumo t0texoxo3iy1latr u ilt s2trio ny1opt  ieilt  Drmxmo;u0aleo oetad m2umn pn(0artomrcoo1fpDr iei;t0s2tr(o3nydlle liesltf 2rmumont1tetomfeiysfm2ranms;u4altoxrciy1faDranvo;(0trum(o3ny1amt  fvt s  Drrump;t0apt iocils mDum(ms;(0trxnmociy1fptrau s;()seto(o3iudlmee ictas aDraur no1olto octydlsDul(vs u4aeerif oa1faDeaies s0truoim3oodole  nei s) 2ra( pnu4olxn oeiasfm rm(mo t0 lxrmf ia1lp   ieo;(  exmio3iydalte fvs ( s2uaum no0apxnmi3iytfa ul(vo;t4tlerxf3iadfmDr ies () 2ur(mpnodom e ieta(  rtruro;o1aeen ietyslmDrm( snu4teenxo3tatfmt ln o;t0s2tr(opoudolt mfvias) rtruront4tlen f3ilt a2umnmo;t) eeniocoydlmtelues;t)t2uoir3nydol elivtlt)a2trur ot1aet  feias s2um(vsnt)aexoxr3tydlmDr nvols)t2tm(mpoydopeemncslt)arraur nu1aetnif3iasfs ulu snt)aexrmrcta1faDelu s;s0truoir3iy4omtelieils aDtaxro;o4oetnmieiad s2eauvs u0artoxo iodlpDr uvo s0 2tmxopiy4am e ivta( aDtax p;t0aexoiieiysfsDrl(vp;t) eenmf3iy1oa  aivilt  rtrir3ou4am  mict t) rra(ro;o0aptomo3tlslsDem(msn(4arxnxrcootopDraies ( srtr(o oy4lp emnei tfs2raxm no1aexomo3iytla rlumsnu)treoio ia1op  ln i t trur(o3iu1lpee fvtat)aDtm(monu0oeenio3tys a raump;(4tlermr totlpDe n i ()sexr(rpny4om nlnes s)arra( o;t4tpx  oeils sDumump u0 eerif3iy1latrluvols srtmirpou4lm nlnvil( sruaxmont1oltoiictasfmDrluvs;t4 lxrxr oa1oa  au il( sexr(rpio1apt lfei tfaDrmxroou4alx mi3ild a rmumsn() lenmr3iodfpDeau s t0s2tr(r oo1lmtnlietlt)srra(ro;o1tetniociysla rlnvsnu4 ltomo iadlp raiesl( s2xoxr3nodap   fctls)srrax p;t1oet mo3ils sDel( s;u)aeeoio3tadoa r nvo ( trurim ny4lltelfvt s) rumu pou0oeen fciatfs2el(mpnt4tleomo3tytlaDrluvs s) 2umir iy4aptn nvtlsf Dua(rpnu0tee ioctyd m2ra(vo;t4texomo ty1fpteaivs s s2trxm iudap emfeiat) 2uru  ;u1oetn f3ilslmDemuvo u0 rtrio oo1oat  n sl(  2xoir oodom e net (f Draxmooo0oet ifciatls um(vs u4aetomocoadlm  lneo;()s2umxo3iudlmt  fcs ( srtrx pou0aetn icils mDel(msnt0tetoxo3oodop  ln ols) rxm(mpio4ome lncsasfs2urx  ;t1oltnmfciyslm uaumon() rxoxo iotfaDrlieo s s2to(rpiy4ap n nvsa( a2raxmoou0teenmoctyd sDeauvo;(4 rtrxf iytfa rln i;t)texoxm ny1lpenlncs (  Dtmum ot1aetnii3iyd sDuaums;u4 etrmo oatfpDeln ol() exrio nu4lp n ivils)s2tmx o;o4oltomoeiat s eluvpnt)teermfciadomtr ieil(0t2urxopoy4omee nei ()a2rrurpot0aptoif3tas aDrl(vp;t)trtnmo3tatfpt anei;s)trtmio3nudlm nmivias artax  ;t4tltnioeiad s eln s;()tlenmr3tadfptean ils srtrim3iy1olt lncias srur(mp;t1tpen f3iysls2ul(vo u4alenmo3ta1omD lu i s seumxm oo1ol n fet (f Dtr( ooo0opxoifctat aDean o t4aetnmf3oydlptrlnvo (0 rxo(r3oydal e nct s arumx  oo4aeeomi3taslmDrl( pnu0arenir oatlptelu ils0texoim oy4ope mncta(  Drmxro;t4ole moetyt m2rl(mp;(4 exoxo tytoa r ivol( teuoxm no4oltnmnvtat)s2ur( poo0opxoifetydla2eanmo;u)arxnmr iy1oa eai s t) ruoxm3iydlp emnetltfaDrmumpoo1tpeo fciyt a2elumpn() rxrio tatop eluei s)tetmim oo4amtnlnctl(f rumumpou1tpxomociltlm rluvpnt0texnxf3oy1lmD aieol(  etoimpoudll nlnvi s  2uaumpnt0tetn f3ildlm el(vont4artnmfctotfm ean s;s0s2tm(opiy4lm  lnvta( a2urxmpnt1tltoiocilt sDul(vp;(4 exoxr3iytfpt lneilt) rtoxr oo1om emnvia(fa2ra(  nu4apxnmicilt s2ea( o u)arermf oadomD luvol(0tetriopou4lmeemnvtltfs2tru  ou0aetniieilt s rau o;(0 etoiociatopD  neols0 rtr(mpnu1lptnlivi sfa2ururp;o4alxoioctlt s2rlump (4arenmo oo1op r nvs;s trtrxopiu1llenmfeil(faDtax  ;t1tpeomi3iytfm rlnvp (0 eeoxocio1lmD auvs;t) ruoxo3nydam e nvsls)arta(mo;o0tpxnmi3iysfs elnmpnt)trxnxr iadfatranvi t0 2tr(r3nodlme  iet sfa2umur no1aexoif3iys aDeaump u)teerifcoo1omtr ueo s trxr(o oy4am  lfesltfs2raumono1oet mo3tldls ul(ms;(4 rerxr3iatfp  lneils0texo(m oodap nlncsa()aDta(r nu4aex  icilsls rl( p (0tltnmo ootfm rln o;s)trurim oo1apee nvsl(f 2rm( p;t1openiiciat a2em( sn()aetrxo3totfatr n o;t0 2tmxmpiu4om e nes s  Durur ;u0oexn f3tadfmDem(mo () eerxr3ootfpDeln s (0srxo(o oydlm  mnvsltfsruaumo;u1aexoiieiatls2ulnmpn()trxnifcoytlaDean i;(0 rxrxr3ny1lmtemnetl( srua(  ;u0opxnmi3ils aDelnvont)artniocoodlmDe nvs t truoxr3nudam  lncta(f Duaur oo1apxn o3iysfaDrmn o t4aeerio io1la elu olt0 exm(o oy4ome liesls sDtrx ooo0tet ioeildfa rmumpn()altoxrcoadfpteanvo t)srtmim iydapenmfvsl() Dta(root1tltoif3tydla rlumo t4 ltrxociatfmDe uei s) 2tmimpiy4op eliesas)s2trxm ;u1ape iiciatlsDrau o;(4 etoxfcoatoat  u s ( sexoim3ou1ape  ieilt aruru o;u1tpx io3iltla2umu s u0 ltnifciytla eln s s s2tm(o3ou4ll   feil( a2trx ono1oeeomoeiat a2ua(msn(4tetoio3oatfpt  ivi;t  exoio iodopeemnvsat)aDumxr ;t1oeeniociyt s eanmsnu0tleoxo tadfmDrlnes t trtmim3no4omeemfetl(  Dtmxm ;t1altnii3tys s2ea(mp;(0aeenxociytlmDe u s s)srtmio3ny1am  lict ( a2ra(rp;u0aptoiietltfa ean o;u4artnif to1omDeai i;s srtrxm3oudlmee ieilsf 2tr( p;o1tlx  iciasfm2emump () lxrif3iatlaDelu s;s)t2uoxr3iu1alenmicsat)s2rr( oou4tlxnmo3ilt sDulu p;()altniocoy1lpt auvi t0 2tm(r iy4ll e ncsl() Dra(m ;o4alen ieild aDeaumo;()tetrio3oo1opt auei t)trxmxm3oy4om e fcsa(  2umumpou1olt  f3iasfa2rlnvo t0aetnxfcta1lptrai il( srxriopoy4ome lnvi t)aDrax ont4tex ifciat s2eauvs;(0altnmo3iadfmt lnei;t0t2trxo oy4lmtnmfvta(faDrm(mont4olt  ietatlmDulnvo (0alxrxr oo1fmteauei t0seuoir iydlm emfcils)aDururpnu1alenmfeiys aDrlu o;u4 lerxr3iytlmD livslt) etr(opno1lle  ivtl()aDua(rpnu4aeen ocils mDeau p;t0teenxo ta1oat  ivi;s)t2toxo3nydap elict t)arrmu  no4oexoiietldfmDumu s;(0altomfcoodfmDrli ols  ruoirpnydol n ivsat  rtaxrpot1tpx  i3tlsla emuvo t0trerxr3iadoatr i slt)s2trxm oo1llen nvtltfarur(ront4aeeoifctatlm2uaumo;()tetoio3oy1oaD lneil()trurxr3ou1aptnlfes t  Dtmuro;u0olt  o3ild a umump u4aeenxocoadfp  livols0t2xrxopoodomt mncsat) 2um(m ;u4olt  ieiatfm el( o;u0tetriociytom e u slt)trxoio oy1ll nlivs s) rrm(  ;o4tlt ioctydla2ua(mp;u)tlxnmfciy1lm rlivsls  rurimpnodal  liesas)s2tm(m ot4tlto ieiat mDua( p;()tlxomoctodlm r n olt setoxrpnydlmtemncsl(f rrm( p;u1tetn f3tltls2raump;(4aexnxo oatfpte nei;s  euo(r3iodlpe lfviatfs2rmxr nu1aexomf3iyt m2ranvonu4trxnio3oo1lp   nei s0 rxrimpiu4omt  fcs tf Draxr ;u4apx mf3iatlmDemnmpnt0 eeoxfctotomDr n il( t2toxo3nudlmtelietlsfs2rmxmono0aeeo ieiys m um(mp;u)trxrio tatlp rau sls setoio ou4ap elivtas  rtaxrpnu4oex mietatlaDrmuvonu4texnxo iodfp  lnvs () etoir oo4am elfcs t)srtaxm ot0apeo iciytfs2ranvp u)alenmo oydfmtelivs s srumxr iy4al elies ()sDrmxr ot0olxoioeiat aDrmu o t0tetrxocia1fmD anvslt seumirpoydome lfcslt artau  ou1tet mf3iatfs2emuvsnu4 reoxr oadlaDeauvi s)srxmim3iu1lpe  nvslt artr(r oo4oeto o3tldfa ua(msnt) eerio3ty1oat  u ols0 2xoir ny1ll   ictlt)aDtm(r nt1tptnmieilsfs2elnvo;(0 eerir io1om   n i s srtmxmpoy4ape mfcsasf rrax poo4tptnif3ias aDua( o;u4tlxoxr3ia1omt lnvslt)trtoxmpiudal   ictls aDtrump;o4ale  oetytfm ua( o;(4aleoxo3tydop   neolt0seto(opiu4lmtnmfeiasfa2um(  ou4aexomoetls a umnvp;u)trtoxocoydla rlieils0texoio3oo1ol  mnvt (  2rmxmono4tpxomoctyt s rlumpn(4artrxf3oodoa rluvils0 ruo(opnydaltnlfcils)s2rrxr ou4opto ieiltfa rm(mp (0 ltoir3oo1faDr neils0teurxr ny1amtn fvs () rrrx ono0tpx mo3iaslm ulumo;t4tlerio tydop e u o t0 exm(opoodlm nmnvsl( aDtr(mont4apxnioeiydfsDra(mo;u0arxrxr3to1laDe uvo (0t2toim3nydlltemncs t  2uaxr ;o0tptoifetys sDelnmp u4altomo3ootoaDrlnvs t0srurxm3iudalenlncil()a2raurono4texo feiaslaDel(ms t)aetnio3iadoaDrlu o;s0texo(mpnodopenmnvt (farur(ro;o1aptomfciysfaDumuvo t0altomocia1fpDranes;()s2tmim3nudamtnmfctls a2uru p;o0oltoiietldlm elnvpn(4 leomf iydlpDrluesl()setmiopnu1olte fciltfa2rrumpnt0aet io3ilt sDumn onu)aeeomfciadoa r i ils0 exmirpny4am emici s a2umu  ot4aeenmfetasls2rlnvo;()aleomo oytfp raivo s teuo(rpoodaptn fcils)artrxm oo1oltn fetasfsDumuvs u0 reoir totfpDelnvo s  eum(m oydlltn iei s)aDtrx  ot1tle ioctaslmDeaumont)tetnmfciadlatraieolt t2umxrpio4lp   ivslt)s2raum no1tlx ifciltfm em(vs t0trermo3ia1lmtrai ol(0texmxrpiodome mivtas aDtmu  ;o4apeomfeiatfmDem(mo;(0trtnio3iytlp  lnei (  2xmxr iodlptemnvslsf ruaxr ;o4aleomf3iyslm2umn onu0tetomr3iy1lptrli o;t)seumir3iu4lpe  icta(fsrtrumo;o0aetniocilt s rlnmo t) renif iy1faD ai i t0setmxr3ny4apenmfciltfsrur(  ou1oet mo3ildfs2uanvp t0teenir todlatean i (0sexmxm3oydop elivt t) 2ua(m ot1aeen feiad s rmn o;t4aetrmo3iydoaD  nvo s0s2xmim3nu1openliesatf rurxmpot0opxnioeilslsDumump t4 ltnxociytlmDr iei;s texo(r3iy4apenmiviat) ruax  ;t0tlenmo3iad a rlumo;()teeomf3iodfmt au s;s0s2xmim3ny4amen icias)aDrmxrooo0aexomieilslm2um( s () ltoir3oy1faD  ivo;t0trtoir no4aptn iet t) 2tm(  nt1aptomoetat m2rlumo;t4trxnxr3iatlatr uvi () etmxopnodlmeelfeiasfa2rruro;t0oet io3iad aDul(vs t0tlerxocootopDrln i;t t2urxo oy4ll n ivil()a2trxmpou0ole mi3iyt sDrmu pnt)aetrmfcta1lmDelivi;t)s2urim io4omt  iet (f 2taxrpoo1oee io3iltfa2rlnvo (0alxrmo3tydfa raivi;s) rurxm nydomeemfvtls arua(ronu0ope mfeiat sDeanvp;t4altnmfcoo1laDr n o;(0teuoio iydllenlfesa(fsrrrur no0oetnmi3iatlsDrl(mp ()texoir3oa1laDe ueols t2uo(o nu4ale lfvt (fs2tmum nt4alenio3iasfm2ua( o;t0arenxf3tatop r iei;t  etm(rpoo1opeemfvt sfa2trxmp;o1opeoii3tys m ea(vp u4aeenmocoodom r i ilt)t2urxrpoudap  liesa()arua(mo;o0opto f3iyslm2rmnmpnt4aeeomfcto1fmtelnvols0srxr(m nu4amtnlivi sfaDtax  no0opxomf3ils a2el(vo u4tlxoxfcoytlpt auvo;() 2uoxm3iu4lmt lfvtl( a2rr( ooo1tetniieilsfmDem(vont4tlxnxf iatlm rlneo () rtr(rpny4lmeelictltfs2ur(r ;u4apeoiociysfa2elu p u)aeerxr tadop r n s s0 2xrio3ou4ope mfetls arrmumo;u1olt ifetydfaDrmn o;() rtniocto1la rlivo;s seur(opoodlp   ictlsfsrrmxrp;u1optnmoeiyslm emums t) lxrxo iydfpteln i;(0srxoio nydlm   nvtl( srumu p;t4tltoifeilslm2ranmp;t0altnmfcoy1lmt  ueo;t)t2to(o3ou1lm nmivil(fsDumxm ;u1aeenmiciad mDulumpnu)treoiocoodlpDrlu o;()trtoxo3oudalt lnet t)arta(rpnt1tlen i3iasls2rln o t)tltnmo io1fmDr uvi (  2urir3no1amtemnctatfsruru  oo0oetnio3ildla2emump (0arenxr iytoa r uvolt seur(o oo4opt  nct t sDrmu p;o0olt  o3iatfs2rmump t) leoxr3iodoa rlneols0setmir3iu4lltemneilt srrr(rooo4apenmi3tldfm2ra(vo;t0 rxoiocoo1fatr nvol(  rtmir io1lle lnci t  rrr(m ou4aptnioetyt sDrmu o u0trtrxf3oa1fm rlieo s s2xr(o3iu1am n ivs tf Dta(mpno4opxomictasfs elnmp;t0arxnmr oadomte neslt trxo(rpnydll   fvtlt)aruauronu1tpt  iciat s elnmo;u)tltrmr3oytopDr u s;s0tetoxopou1lmenmfesls  rumxm nu0tpxo o3tltfa2emuvp (4 leomf ootfmD  ueil()sexrio nodlm elncia( arrau p;t1aleomieiadla ranvo;u4altnxr iodlmD ai o;()texr(rpoo4alee ivsas)aDrrxmpnt0tpx ioetysfaDrmnvs u4trtrmr tytfpD  iei s) rtoio nodopee fvslt arumu  nu4oleo ietydfa rlnmsn(4alxoio iydlaDean s;t0s2xm(m io1lmeelict tfa2trx pnt4optoioctad m2uanvp;t4texnmf ta1oaD anvslt)trtm(r iu4omee nvils aDrrxm ot0ope moeiasfm2uln p t0tetrio3io1fmD lneo;(0trxr(r ou4ope lfvi () Dtru pou0apx ioctaslm2uan p;t4aetnxfctotoa r iesl() rxm(m iu1lptn nctls) 2trx  ;t1oee ioeiasls2rluvsnu4alxoxf3oadlm eai ils0 eur(m3iy1apeemnciat)a2rax pnu0olenif3tldfsDuluvo t4texrmf3ta1om e uvsls0 ruoim3nu4olte nvtas srrmumpoo1apeo iciad s2elnvp u)texnxrcoo1la   ieol( tetmimpoudamtn fvi tfsDtrxro;t4alenioctydlm ua(mp u0artnmo3todlmte ueo;s0t2xrxrpiu1om nmnct (f 2ur(r ;t0aexo ociad aDrl(msnu4arxoxr oy1la  luvils)sruo(o nu4om elnciasfsDrr(m ot1teeoiieilt s rm(msn(4tlxnxr3tadop elu il( setrim3iodap nlfvil()sDrax  ou0tleoii3ias s2um( p t)artnxrciotfm rau ol(0t2xmim3io1olte fctlsf rtrx ont4opto fciytfaDum( o;(0arxrif3ta1lp eli s;t)t2xr(m3nudapt lfct (f Dururonu4aleo oeild mDuanmon(0trenmo3iydlpteaueo t0t2trxo nu4omenmfviasfaDum(rpoo0opto f3tydls emn onu4texrxo totlat  uvi t0 2um(r iodol emfes ( a2rau o;u4alxoifciyslsDrm(mp;()trxoxf3io1fa  aneo;t0 2xoim3nodopee fcsls) 2rr( pot4aex ifeiyd mDrluvsnu4 exnioctytfa  ai o s  2ur(rpno1ame mnvtltfarurumpou1tptoif3tysfs rln ont) eeoxo3to1lm  ai sl(0sexmio3oydam n ncils sDrm(root0aee moetydls ea(vs;(4aetnxociatlp  an i () 2uo(r3no4optemfvsa(fsDtm( p;u1oleo fetls s eau pn(4trtrxo3ia1oaD  nvs;t  eurimpnodll e ncil(fs2trur ou4aetnifeiasfaDel(vs;t)alxomfcty1laD auvolt srxoim3ou4omt mfcsas s2urum oo0alx  icildfm2ul(msnt)teenxf iytoat auvil( s2xo(m iy1lmteliei tfarurxmp;o4olenii3iad a2uanmsn(0alenir3oadla rluesls  rum(rpoy4amtnmnvsa() 2rmur no4tlen f3iadlsDuau o (4alenxo3oodfaDe n s ( t2trimpoo1lmeelfeiat s2rauroou0tpenmociatfmDum(vp t0 etnxr oytfp e u il(0 euo(m iy4open fct ( arrm(m ;u4aexomfeiadfm2el(vs;() lxrirciadoaD lneo ( teum(o3nu1alt  icsatf Drrx pot4oeeomiciyslm um(monu) lxnxo3oatomteanvi s) 2to(opiy1opt lnviat)s2uaxrpnt4tpx ioeiys mDumnmo t)artoxfcto1lat  ueilt s2to(r oudapt  iet s s2umuronu4optoif3tysfa2eln o;u4altoio oy1la elieslt) rtmxr3nodolee iet (fsDra(ro;o0teenmociadfs eaumsnu) rxoxo3oa1lateaues t0trtr(rpoo1al n fvs t)aDua(  nu4tetniietatfs eluvs u4teeomfctydlateauvi;s)s2tr(o ny4alen fcils)sDur(moou1oee  ieiatfsDel(vs;t0 rtrio3oy1late uesls0t2trio3iy1olee ies s srtrumpnt0tleomicilsls raump u) etrifctydfm r n i t0s2tm(rpiy4om elnvt ( sDua(m nt1oeto fciadfa uanmp;t) rxnmf oadlm r ivs ( sexrio nydope mnctls)s2tr(ronu1tee mociasfmDemnvs ()tltrmo3oatlp e u i s)texrxopny4olt  ncsls)s2urx  nt4tpxomi3ilt mDemnvo;u4aexomf tadomDr ueilt  rtr(o oy1ope mnctas)artrx  no0opx mf3iydlsDemuvsnt4arenxoctotfm rluvs;t) ruoxm no4al nmfeils)aDra(r no4aex  ictadla rmn p;t)arxoxocoytfaDelivs;t0trxr(m nudolenmivil(  rumxm ;t4tpenmieiysfm rau snu)texnmf3iatlm  lnvi;s0 2um(rpiydllen fvi tfs2tmxrpot4tpeoiieiyd a emnmo u4 eenmocoydopDeauvo t)trumxo3iy1ol nmictl(f rtm(mp;t1opt  o3iydfm2ua( p t) rtnxr3todfm  aivo;()trurxo3iu1alenmnvs s aDumxmp;u0openif3ias mDum( snt4aexrmf oydfpD  n sls srxo(rpiy4lpenmnei sfa2rmxmo;o1tex  feiysfaDumnms (4aexoxfcootfmD auei s0 2tm(m3no4lp nliet s)s2rr(mp;o1aex ioetas a rmu o t0 etnxfctatfptr i ils seur(r3oy1optnlicsl(  Draumo;t0oetnmi3iydlsDem( s t4 renxo3oydomteluei;() eurio iy4apenmncsa(  2uru  nt4oleo fciydfs2umumon(4 eerircio1om e u i;t trumxm3iydam   fctls)aDrmxronu4opeoiociys s2emuvsnu4aeerio iadomt  ueolt0 eumiopiy4lmt lfcias  2ur(rpno0oetnii3iltlsDrl(vsnt4teerif3iy1fa ranei ( trtrxrpoydaltelfvi s srrru pou0tetnmociydlsDrm(ms;t0texnxf3totfpD aies;s)t2uo(mpiodomeelnesat s2trx o;t0aexomi3iasfa em(mp ()teeoxo todopteauvs;s0s2xrio3nu4ameemfet ()s2taxmo;u1oleoioeilsfsDemu on()tlxrioctatfaDranvs;()srumim iydapenlict sf rtmxmpoo0alx mf3ils a ranvpn() rxrxociodoptelies ()texrir3iydlltemnvilt  2taxrp;t0tleo fciatlm rmnmont0aetnif3iotla raueolt0trxoxopoy4am nmics (faDuau  ;u0openifeiad sDumnvo t) lxnif ty1latelivs t  2xoio ny1lpt mnct s s2uax o;u1oltnif3tad sDrau pn(4aeeomr3oytopt li ils0s2toxr3no4am   fvias)srur(  oo0aetn f3iat m2ulu p;(0tlerxr totopteluvils0trurxmpiodape livsa()aDtmxr ot4olt if3tat a2umnmpnt4texrxr iy1opDelu o t0teto(o iu4lm e neia(f ruru o;t0oetoif3ilslsDea(vo t0alenir iotlpD luvo;t srurir iodop   fes t arumur no1tpto fciadla2ua( on(0altrxr3oy1fat  u slt)truoxmpnu1alee ictas sDum(r ;o0oeeo feiaslaDuaumo u)tltomo3iydomte ivo t sexrim3iy4oltelnes tfartmxrp;o1opxnmieiydfa ean sn(0trtomfciodom  li s;t0srtmio oy1omeemnesls  2tmumoou4tpx  fetld a rmnmo;(4 etnmo tytoa  aues ( srxm(m iodope mfvsas) Durum no4aptnmfctlt aDelnvo;t4 exomoctatoptr i s;(0 rumxm3ou1lm nmfcslt a2raxr ;u4tpenifctltla2em(vp;t4artnif ty1omDeli sls s2tmxr3oydal nlneias s2ururonu0aee ioctydlm uaumo t) lxnir3tytlat  ivils0setrio3iu4altnmncilt) rtm(rono4oexniicilslaDrauvs (4arxrmocoa1lmtrli i;(0t2umiopny1lmt mnvta() 2rmxrpoo0tlt  feiyt a elu s;u0tetomo3oytlmteanes ()seuoxrpnodapte nci s srra(ro;o1opeoioeiydfm2uaums;u) rxnmrctodfa   i o (  rxrxr3ny4opeelfvi t) Drr( oou4tlxomf3iysfm emump u4teerif3ta1oat aiei;t0setoxo3oydap emfetat) 2ra(ro;t0tleoio3tydfa2ul(ms;u4teeomrcio1lpt  ues s  rxr(r oodameemfcs ()s2tmu pno4aet mfeiysfsDulnmo t4trerxf iodlpD lnvs;t) 2xo(o ou4al  mfei (faDtax p;t1oee micildfsDrluvsnt4aetnxf iotomDeln i t0srxoxo oudll   iviasfaDrm(r ;o0oetomf3ias m rmnmonu)tltnxo3to1omDeaivi t  ruo(mpoo1ape  nvi s  rurumpoo0tlt  feiad a2rmnvp;u0treoxr3oydomt au slt0trxrio ou4altnlicias  2umu pno4aexo oetltfs2eluvp;u0trerir ty1op eluei;t)setoxm iudomt mics s)srurump;t4aeeomo3iytlsDem(vp;u4 exoxo ia1opDeauvs ( tetoxo3io1omte net t) Durum ;u4altn o3ild m el( s u)aeeoxr3oydfat  u olt0texo(r3iudlpeemfvilt a2uaurpno1tleniietlsls2uan s t)aeenmr3oadlmDeauvil(0t2tr(mpou1aptnlnvs t) Dtrum ot4aetnmietatlm rl(mo;t0tlxoxociydomteanvols texrxr3oudlle  ieia(f rumxm no4apt iieiltla rmnvp;u4artrir iy1faD li s t  exoim oo1am emnet tf ruru  ;u4tpenmf3ild a2rau onu)texoif3iotoatelueo s0teum(r ny1op nlfesas a2tmxm ot4aptnmieiatlmDuan ont)artrif3tydomte ivs (0 2toxm3ny4amen neilt  rraur ;t1tltomoeiyd sDul(mp;t4aetnxrcootfpte uvi;(  rxrir no1aptelfvtl(  2trurpoo0tet if3ias a2umu p u0aexrmf iotlp rli s;t) 2umxr3iudalen nvt s)aDrr( ooo1texo fciys m2ranmo u4trxoxo3to1op e n il( t2um(m nudlmeemicsa(farumur ot1apenmietyt a eln o;u)tetoxf3iydoa eli i t)t2xmio3oodamenlfeta() rurxroot0aeenioetad aDelu s;t4areomrcoy1om r ueol( t2toio3io1oleelivs s) Durumont1aexnmietlt a2ulumo;()aeenmo3ootomteaivo (0 etriopoo1ol e ivs (fs2umxmpot0tlx  oeildls eanvpnu0arxrxr tatopD  ieo;(0tetr(mpno4lmeelfeiatfarrr(mpou0oetnifctas s2rmu p (0 rtrir3totfm eaueo t)s2toir3iy1op e ieias aDrrur ;u1oexo f3tas m2ra( pn() reoifcto1fateau s t trtoim oy1alenlicias) 2umxr no4texn o3tytfmDelumsn(0areomrciatom ran s (  etoxm3oo4lm e fvi t) 2tru poo0tpeo oeiytfm rlums;t)artriociodomDeaneilt  exmxm3io4lmtnmfvtl(f 2tru pnu1tlenmfciysla2rlu on()trxrxf3tatoa e nvo;t)trtmir nu4openlfctl()srua(r nu4oexnmo3tysfa emnvp;()tltnircoy1fateanvol( trtrxr oo1opeelietl(fa2tau onu1tex  ocildls rl(mp;u4treoio3to1laD anvs;(0 2xr(r nu4apeelfvias  Dtax oou0tle iiciat mDrl(vsnt4tetoxocootfmt  i o;( texrio no1apeelnctat  rurxm ot1tet mfctlsls2ul(mo;u0 etrmo3tatlmDeanei;s) 2trxmpiu1op  lnesl(  Dtmu o;o4oltn f3tad a rmuvpn(0tltnmf iadop  au o;s0 eumxo nu1opee nvil()srrr(rpoo4aexnio3ildlmDem(vs u)tetomocoytfmtr uei;t0trxr(r3ou1lpe lfvsa(fsDtaxmpno4tptoioctatfa ea(monu4aleoiociytom e uvi s tetm(mpoy4ameelnei t s2tmu o;u0optniociyslmDea( o (0tltnifcty1lp e ues s)truriopio1opeemfviat)sDtmxm nu0tpen o3tytfa2umnvpnu0artniocoodop r i sl() 2xm(o3iy1oleemnei (faDrmuroot4apenmfctlsfs2ra(mpn(4alenio3ta1la   u sls srxmxo oudll nlicslt  Drmu p;o4oeen feiatfa rl( sn(4 ltomfctatop  aues;t  rxmir3oy4altnlfctlt)sDur( poo0tetomoeiat mDua(vpn()alenmr totlaD  nvo t trur(rpou4opeelnetas sDtrumpoo4oexniociadfa rmuvpn()aeerxf tatfpte u i;( srxr(o no1lmtn fcil( sruaum nu1aetoiieild mDeaums;t0trtnir io1fmDranei ( trxr(opnydlmtn fvias srtmu  ;u0texn ocias m eauvs () reomf io1lpDe nvs;(0trur(r3ny4optnlivt t  2trurpnt1tee iictlt m rm(vs;(0aeermr oadop   n olt)srxoxr ny4openmictls srua(  nu0tptnmi3tatlaDemn s;t) reoxf3oadoat lueo (0tetoxrpoudomtnmnesat aDtru pno1altn oeiytfaDrm(mp ()altoif oydlmtr nei;(0s2umimpiy4llenlfes tfsrrrxm ;o1oexn i3iyd aDeln o;t4 rxnxf3tadfmt  neo;(0trxrimpny1ale lfei s arta(monu4texnii3tyd sDeanvpnt4aeenif tatfat  iei t0trxo(rpoo4omeemncsls  Dra(  ;u0oexnifctydla2ea(vonu4areoifctotfpt  neo s t2xmiopnydaltn ncsls aDrau  ot0aee mietls a rlnvp ()tetoif3iy1omDraneols) exrxm3oy4lp nlietlt  2tmxmoot0openmictadlmDrmnmon()artnxr iytla e neolt t2to(mpno1amte iesls a2taxmono4altnio3iltfs em(vp;t)treoxr oo1oa rluvslt) 2tmir3no1lmtemfvslsfsDrr(rono1aeto oetlsfa rm(vo;u)aexnmfctotfaD aivo s0srtrir3io4ap  lnvsas aDtru poo1altnmieiyt sDumuvp u4trerir oy1fp rai o;(0s2xmxo3oo4oltnlictlsfaDrau  oo0aetn ieiatlm2rluvo t) rxrxo3oodfmtr ivo;() rxmio3iu4am e ivsls arrmxr ;t4altomiciyt s2um( o t)teeoxfctytlmteaivsl(0setmxr oo1apte fesltfa2ur(mont1alt iiciasls2elnmpn(4 lxoir3iy1oa rauvs;s  rtoir oy1am  licsls) Drru o;t1oltnmi3iys s ean s;(0altoxfctotop  lneils texrio iodal nmivsls) Dtm(rpnt0tle ii3tad sDelump;t0altrmfctatfmDe u il()trxoir nydapen ivtat)arum( p;t0tlx ii3ilt mDrmumonu4treoxrcootfmD aneolt0 2uoim3iu4apee nei t)a2rmxmp;o4altoifciyslaDum(vsn()tlerif3tytfa raueo (0 rumim ny1llt lnct (f 2taxmoou1opxniietlslmDumumo t0arxrif3iatfp r nei;s0t2tmim oydll  lfci s)a2umum ;o4ope ifetyt mDua(ms t4texnmr3iatlatelueo s0tetrxm3nu1alenmictlt)aDtm(  ;u4olx moeiydfa2elumon(4trxoxo oytom  lues s0sexoir3oudopenmicils)aDtmxmoou1tpeo feiltls rm( s;t) lenmf tydlmDr nei;(0 eumxo nudlpte ivil(fsDua( p;t4optnmoeildls uaumpnu4 exnxrcoydlmD aiesl(0sexmxo3iy1ole livil(fs2ur( o;t0opx mieiadfm rm( pnt4arxnxr oydlpDr uvs t0s2ur(r3iu1ape  fcsatfsDtaxmpot0oleoiociys mDeluvo;t0aeeomf totfpD au s ()t2umxr3no1olee feias aDtru onu0tet mociyt s2rm(vs u)artnmo3iodlpD  ivo t0s2uo(mpoudap   ncsatfsrrr(rooo0aleomoeiydfs elnvs;(4tetoxr ty1opDrln o;s trtrim oudalee fvi sf Dumx pnt0tetn fciatfa eluvs;t0trenxo iotfaDeaiei (0trtoxr3nodoltn nviasfsrtaxr ;t0olx if3iasfs2eluvs ()artriocoytfp  lneolt srtoiopnu1ameemneiat sDtrur ;o1aetnmoeiysfm umnvpnt) renxr io1opDr u ils sexmim io4ll nlivs ( sDururoot4apxn feiatlm ul(vs (4arxoxr tytopteluvs t0tetr(o3oy4oltelivs ( aDururono0texoioeilsfa ua(mo (4treoif3ty1fmD aivo;()s2xr(m iudam  lneiatf rtm( ont1aexn f3iatfs ul(mo;(0artnir3oatfm eaivols sruoxo3no4lmte nvtas aDumumonu1apen feils aDum(mp (0 rtomrcoytfa rli sl(  2uoxo iu1ome lietlt)artaum nt0teeoifciasfs um( p;t)alermf tatla  aivsls tetm(r io4olt mfeiatf 2uaum ou0opt mo3ilt m2eanms;t) exoxo3iatlptrlnvo t)texr(mpiy4ll   fviasfaDtmxmooo4aex  f3iyt aDrmu s u4aexrmf3iytlp eau ols)setmxr3nodlltemnvsas a2uaxrpoo0olto f3iadlm ean o;u4treomrcootfptrlneo;s0 rxm(o ou4llt lfct s) 2tmx pno1tet ioetysls2umn o;u0arxoio oatfm ean o t0teto(rpio1omtn netas arrmxronu0alt mociasls2ua(vp t0tltrmocoydopD lieo ()tetr(rpny1ome  ncsa() Drmxmo;u4alxnif3iadfsDumu pnu0 etnifcto1faDeaivo;s0trtmio nodlleemivil(farrmxmooo1tlx ifctys mDuan s;()aexoif oydlpDrli i s)texmio oo1lme lieias) rrrurpou0tpt mo3iyd mDean o;t4 lerio3todomDeln il( trumim ou4om  lfci t)srraxmono4aptn oeiys s ua(mp;u4aexoir3oa1lat  u s s trxmxo iydamtnmnvs sfsDrrumpno0tlt  feiad m2eluvp (0texnxr iadomDr nes s) euoxr no1al  lieia(f rtaxrp;u0optoifeiltlm2ul(mp (0trxnirctadlmDeanvsls0srxoio3nudopte feslsf rra( p;u1aptomfciydla rmnmp;(0 lenxo3todfat an s;t0t2toxo3oydopt micia(f ruaxm ;u0aleo f3iad s ulu ont)tlxoircootfpD  i ols0trxoxmpno4ame  ies (f Drrxm ;u0aetnmf3iatlm em(mp;t4tetrmf iydfp   i o;s0 euo(m oydlm  lnesa(f Dta(r ot4aeenmociltls2um(mo u)tetoxo oo1fmteln s;t0 2xoxo3nudaltn fctasf Dua(r ;o1olx iictad mDemn pn(4 reomo iydoptrlu o;t)tetmirpny4ale miviat) 2raur nt4olt mieildfs emn s u4aexrmo to1lat aiei ( s2xmxm iudolen fciasfs2trumo;t4open f3tysfaDemuvp;t4arenxo to1lp rai ils s2tmir iu4lpee iet s  Duau p;u0aee iieias a2uan p;u)arxomfcoo1opDr i i;(0 etm(r3ou1aptelivtl(fsrrrur oo1aex  feiysla eaums;(0trenif3tatop rai i;(  eumio iudlleelfcsltfsrra(r nu1apxo feiyslsDrmuvpn() renxf3tytfa  aneo (0 2umim ny1ol   ictl(f rua(m ;u0alx mo3tytlm ea(mo;u0 lxrxr3iydoaDraivi s0sexrxm nu1llenlnci s)a2urxr ;u1tlxomfcildfs2em(mont) rtrxf3iotla   u il()s2toxo iu1ame  icilsfsDtmumonu0altomo3tlsfsDum( s t)tlxoir3oa1om eln ils) exrir3iu4olen nvias)s2rm( o;t1texn feiadfs umn o (4aetomrcty1oat liei ()trxm(o3nydol   ncsatf 2rm(root1apt miciydls2um( o;u0trxnif io1lp r n slt t2xr(o3no1lleemnesls a2raumo;t0tpx moetytla2uaumont0arxnxf3oo1lmtran i ( s2trio nudomt lfeil()s2raump;o4oeeomieiadla2umu o;() rtnif3todlpDeauvo;t teurxm3oy1olen ics s)a2ra(  no4tltoioeiydfmDrlumpnu4alerxfcto1oa  lueo;t trxrxo3oudap elnes t srrax oou4tleoiociasfmDuluvo;u)tlxoio3iadfateauvs t0 2tmxrpoy1lle  icilt srtm(  nt1apeniicildls2eluvp;t4 lerir iotoatelnvs t srumim iydlpt lietat) 2rrur no4opx  oeilsfmDemuvs;u0trxrmrciotoat  ivo ()truoim oydopenmncsatfa2urx  ou0ape  o3tltfm emnmsnu0altnmfciodlm   uvs t) 2xr(m3iu1omteliciat)sDtru ooo0tlxomietld m umu o;u0aeenxo3oo1op rauvs s)t2um(m3iu1alte nvsls artmxrpou0aeenifeiysla2uluvsn(0 eerif3ty1fm r n ils0t2trir3iydom   ieslt  Drmump;o0ape  oetldla rlnvs;t0 rtoio3iydlaD  ieils s2xoxm iy4lmtnlfcia( artr(rp;u0oleoii3iatfaDuau ont4alenio ootlmDr i i;()trtr(o oy4aleemfetlt a2taurpoo0tptnioctytlaDeauvp (0arxnmoctotla elnes;s seumxmpno4ape  fvt s srtmum no4oet  o3iytfs eln snt0tetnxf3oydop e uvsl( texr(r iudol e netas artr(monu4tpe  f3tat a rm( s;(0 etnif3to1oaDe i sl( srxm(r3io4lle mnvi sfa2rm( oou4tpe  feiltfsDua(monu4 etnmfcoo1oa r neols0s2toxm oy4ol  mivi t)artmx oot0aex ii3tyt m2eanvp;(4artrircoy1fpDrai o;s0 2xoxo ou1lptnmfct t artrum no4alx  ieiytlm elnvp u)tltrxoctadlpD an o;()texm(r3oo4op nmfvt t) rum(  nt4texnmfctytla2rmnvo;(4texoxfciydfpDr ivs;(0teumxm3ou1aptnlieilt srrax p;u1texn fctltfsDel(mo t4aetnir3oadom  auvil(0 ruoim oy1lpenmicsltfsrua(ro;t0tee if3iyd sDrl(vs t)aexomrcoydlmDr uvs ()seuoirpnydlm nlivta()srrr( ono1tex mfctas s2ranms (4aetnmr tydoa   uei;() 2xm(o no4ope lfesat arurumo;t1texnmfcildlaDrl( pnu)teermfciotlm   nei (0 rurxr oo1omeemiet t a2uau  ;u1tlxo oetydla2rau s u0teenxrcoo1om e nvs s) rtmxopny1ol  lfctlt aDua(mp;t0tleo ieiasfa2elnmp t) lxoxfctydfmtrlnvo;t) rumir3oudame  nci t aDrmxm nu1tee iieiytla2rmu s (0aexoxf3oa1omDe ieo t) 2umxm3nodom  mfcta(  rrmxr ;o0teto i3ildfs2rlnvs;u4 lxnif3oytlmD  ieilt0s2uo(mpiy4lme  icsa()s2tr(  ;u0apx mieiyslaDra(ms;(0trtrmf3ia1fp  lnvol() 2umxmpiu1ll e neiltf 2tr(mp;o4olxnmfeildfs2emnvs u4texoir oytopt aneils0srxrxr ny4lltelnvsa( aDumuro;o1tlt mf3ilt sDem(mo t)trxoif iatfpDrluei;()srxo(opoo1ole  icta(f 2tmxroou1tlt mfetlsfaDrluvs (0trtoxr3tydlp rli il()sexrio io1lme lnviatfaDtr(rono0oleo ieias s2rluvont4tleoioctydlmDraivi;s  rtoirpnu1lmenlnct tfa2ra(moou4olxomi3ias aDeluvs (0alxnir iy1opt aiei t0 2xoim nydlpte nes ( srtaxmono1tltnmi3tysfaDuauvon(4 ltoxo oodlp   nvi t)srurxr3iydaptnlictls  Dur(mono0ole mf3tyt aDumnmp (4arerir3iytlmD lueils0s2uoiopou4lp elnviltfarrm(  ;u4teeo ieils m2em(vonu0 ltrxf tatfmte uvol( s2xmxr ou4apte fei s) rta(r ou4aexoiieiydfm2elnvp () rtoxrciy1fm raiei t)teto(r3nu1lmenlnctl()sDrru ono1tex ioeilt m eanvo;u4 leomr iatfpD lnes t  ruoim oodapt lfvsat a2rmxr nt1tltomf3iat a umuvp;(0 ltnmocty1fpteaieil(0 eumim3iodaleelncs ( s2taxm ou0aexoifetldls ea(msn(4tlxnmr3ia1lptelues;s0teurio3ou4omenlfesas)srraur ;u0alxoiicildfs2ra(mp;t0trerxr3io1la e u slt)sexrxo3iudam nlictlsfaDta(ro;t1aeenioeiyt a2elnms;u4arxnxr tydfat  n s ()setr(r3oydaleelnetlt srrmxmpot0tpenifciytfm2rau snu0 rxoifciytlateluei;t0sexm(opoudlm n ietlt srrm( pno1alxn fcias a uluvp;t)arxoxo3to1fmte nvi;()s2umxo3nodll e ict ()arurxmont4oexomociyd sDran p (0aexnir3iotlatraieols0s2urxopnu1op   icta(fs2uaxrp;u0teeomfciydlmDrmu o;t)aeenir3to1omDr nvilt)srum(r nodll emnvtlt aDua( onu1opxomociltfsDrl( sn(0trxnmo3iatopD lneo;s s2tm(mpoydamen ietas)arum(rpoo0aetoifeiyt s umnvo;u4 lenmfcto1oat li olt)s2xrxm no1lpe liet (f rrrxrpnt0ape if3iadlaDeauvp;t)artrio3todom  liei;() rtoim3oy4lptnlieslsf rrau oou0tpxn fctadfm2emumsnu4 exoxrciadoptr n i;s0trtoxr3oo4lme lnct sfsDrrxmo;u4aetnioeiatfa ea(mp;t)tlxoxf iy1la eanvils)trxm(r3oydomtelfcsasfaDuaxmont4tle mo3tls s umu s u) ltnxociotfaDr uei;( t2urxrpny1am e icia(  rumuronu1tptomi3iysfs elumsn(4artomf3iydomDelueils t2toxo iy4am elnetl(fsDtmum ot0tptnioetld s uluvpn(4 exoxfcty1fa r nvo t)setrxmpiodoleelncia() rtax  nu1apto iciyslm em(mp t)alxoirciydlmD lu i (0 eto(mpny1alt  ivt t)srua( pou0aex iietld mDuauvsn(0arxnmo3ta1om  luvols  2to(m3iodlme mivt ( a2taurpoo0aex iieiadfmDranmont4 exrxo iy1fa rlivs;s srurxr3nydamtnmncilt) 2tm(  nu1alto oeiltlm rlumo;t4 rxrmrcoa1oaD ln i (0s2to(r3iudamt mfvi (faDtmur no4tptnmfeiadlmDuan s t0tlxrxr3iotla e uvo (0 exmir3no1om e icsat  2uax  oo1apeo f3iys a2emu o;t)trtrio3oa1omtrlu s;s)s2xmimpiu4omtemivi t)aDtmxmp;o1olxnii3tas a uanvp;(0 leomo ty1oa   neils) 2trio ou4omenmictl(  Dtmu pnu0alt  fcildlm2rlu s u)aleomr oadla elu i ()s2umxm nydomee nvt (  2uau  ;t0tetnmf3iltls2ul(vs;t4aexrir3oadoa rlneo;t0t2xr(mpiu4lpt micils) 2tm(mpnt1ale moeiydfs rl(vp u) lxrxo iy1lp eaieo;t trtrir ny1ome mneia(f rra(moou0oeeniiciltlsDrmumon(4tetnxf iotlat  u sl(0 rtrio oo1am e net tf 2um( oot4tleoioetat mDran pn(4 eerxr3iotlmDelieolt)setoxrpny1lptn ietl(  Duax pot1alto o3tlsfa2rmn o;u4tltnxf3ia1lpDe uvs;()s2uoim3ny4al  livt ( arurxm oo4texoio3tld s2rln s;u)teermrcoydfm  lnei (  2uo(opny1lp emneias) Durum nt4oexnmfeils sDemump;u4arerircoa1fmDe uesls0srumxrpou4oltelfvias) rrmxroot4ape miciyd aDumnmo;t4 exrmfciy1oaDeli o s0sexmxm oo1apenmicsl(f Duau  nu1oltnmf3ils sDum( on(4 etoxfcoo1lpt  ivils0s2uoimpiy1omenlfetltfsrrauroou1apx mi3iys aDra(vont0tlerifciy1oatrluvi;t t2xmxr oydop n ictltfsDraxmpoo0apxniieiydlaDran p;t)arenmociy1fpt  u ils0 ruoxo3io4aptemnvtl( s2rrxrooo1apxnmieilsfs2rm(ms u0 rtrxfcoydom r n i s)s2tmio oo1lm nlfeia( s2tr(mpno1tlenmieiasfa2em( on()alermo3iy1la elnvi t0sexoxm3nodlmtnlieils aDrr(m nu1oetn octysfaDrm(msn(0tlxomr3totlptrai ils0s2xrio io1ol elnetltf rtaxmo;t1oltomf3iysfa ulnmp;u)alxnir3iy1optr ivs;(0 rxriopnu4ope lfvtltf rrax  ;u0tle ifeiltfs2emuvp;u0aetrxf ta1lp  ai olt sexr(r3iydomeelfvslt  rur(r ot4optoioeiytfs2eauvsnu4texrmf tatlpDr ues s) rurxopoo1ome micil()aDrr( ooo1olt if3iydlm2ranvs t0 eenmf3tydlpDeauvo s)trxrxo oydolt  iesa( a2tm(m nt1oetomociat m eaumonu0 lxnio3iotfmtrlivils  exmir no1oltn fvsat)arta( p;t1tpenmf3iyt aDumums;u4aexoifciatlpDe n s s)s2to(rpnu4om elneias a2raxm ;t1alx if3iasfs rln onu4 rxnirciydomDraiei ()t2xmxmpny1ll  mieia( sDrrx oot1ale mietls m emnvo (0 exnio3io1fateln ols0 etrir3nu1llenlivtatfs2ta(monu4tee ifctltlm rmu sn()tetoxo3iodfat  nesls0srtrxmpiodomt  fcs () rraxmo;u0texomieiadfm elu o u0 ltoxfcoo1laDrli o s t2tmxo oudoptnlnci s) rurxro;u1tpx  ictyt sDumnvs (0 rtoio3ty1fateauvil(  2um(o3iy1lmen fvsls  Drmu pno4tet ifeiasfs ranvp;u) ltnmr oadlm ranvo;s0t2xr(opno4op n nesas arrrumoot1olt mfeiyd mDum( p u)altnmf totoateanvs;t s2tmim3ny4altnmnct ( srrau  ;o0oleo ictltfs2rmump (0tltrif oo1lateaies;()setoxm iodlpt mnei sfartmxmo;u0tee mieiaslaDrl(mp;t) eenir io1fmDr uvs;t0 euo(mpnu1lmen fcslsf rra(mpou4tltn fetysls2uan o;t4 lxrmfcia1fptr ues;t0 2xmirpnu1lp nmnvs s  rra(root4ape  ociysla2ra(vs;u)tltomrcio1fm eanvi;t sexmimpoodomenmics t a2uau pnu4oltn iciyd a uluvsn()tltnmr3iodfpt auvsls  2tmir nodaleemieta(f rrrxroou4teen f3iatfm2ean p;u0trtoio iy1lpte uvi (0seurio iudll n nci (  Dtaumont1oex  o3iytfaDranms t) rtrif3oa1lm e i ilt0setrxm3io1opt  nviatf Durur ou4teenmfetlslmDrmump t4 renio3oo1oateaneo t0trxmxrpio4llte ivsa(f 2tmxr ;u0apxo o3tyt a emuvs;u4aeeoif oy1laDr ivo;t)srxmxo iy4om elfetat)aDuaur no4oet ii3ildfm2ranmo;t4altnmf iytfpDeanvs;()srxr(r oydlpeelnvt () Duaxmono0oet  fctys a2ea(vs;t)altomfcty1lpD ln i s)trxoim3nu1apeemneia(fa2uaxront4aleomfciytlm2umnms;(0tltoxr oatoa ean o t teuriopiu1op nlnvsa(  2rmx oou0oeenifeiasfs2elnmo u0 eeomf3oydopDrlu s (0teto(m3ou1am emnvtas)sDrmur nu4tlxomietad s2ul(vs ()areoxo3iodfpD  ivo (  2xr(r3io1apte fvtl()s2taxr nu0tpenmi3tatfs2ra(vonu)aetoxo oydfa ranes;( texr(r nudllte nesltf rum( o;u0alen fcils s um( p;(0 rermf3iytlate i ilt) ruo(m3oy1ol elfcs sf rtaxr nu0ole  o3iatfs emnms t4arenmfciytoat lnvilt0 2urxm3io4opt  ivt s) rrrur ;t0aet ii3ils mDrln o;(0 ltoif3oo1lpD aivo;()srurir oydol   ietlsfsrua(rpnu4apt mf3ilsfs um(vo t4tltrxfcia1om eaueo (0srurim3oo1ll   nctls)arrm(r nt1aptn f3ildlmDemnvsnt)trtnmf iy1oaD  u s t trtmir ou1lptnlfvta( a2rrur nu4open ociatlm rmuvo;(4aeenxoctydoa rli i;s) rxmxopio1ome lfetltf ruaxr ;t4aexomi3tadlm uanmsnt)tetoxfcia1fa ranvi;t0t2xrio oydlpenlieslt aDururpnu1aeen ieiysfa eluvo;t4alxnifcoo1laDe i ol()texmxm3iydll   fetl( aDrrumpoo4apt  ietadlmDua(mpnu4trenxo tytomDr ivolt0 exmxr3io1optemivs s sDtm(rpoo4aee  iciys aDul( sn() rerir oa1lpDeluei t)seumxr3oy4lm   nvtas) Dum( ont4aeeo i3iasfm2rlumo u) exnir iodom ran i s trxoimpny1lp n fvtltfa2ua(  ot1ale  ictltlsDeauvont4alxoxo3tytomD luvslt texm(r3no1al  licsatfsDtmxrpno4aetomi3tasfm uanvs;u4arerio iytfpDr u s;s0srum
\ No newline at end of file
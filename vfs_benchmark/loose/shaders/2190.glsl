@@ -0,0 +1 @@
+nvs;s)trtm(opny1om   iei (f Drru pot4teto ociad a ulnvont4arxnmr todfaD aieo s  rxmirpou1al  lfetl(faDtr(mpnt4altomiciasfa2emums t)tetomr tatopteli o t)trtoxmpnudome  nei sfsruaxmp;o4alx  o3iydfa2eanmp;()teermr3ootopDr iei s0trxrxm oodale  fes t) rraxmpou0tlenmfetlslsDrl(ms;t4 etnif iatlat  ueo;t)tetoxr iodopenmiei s  2urx o;t0tltnmfctldfaDuanmpn()alermfcty1fatr nes;t trurxopou4alte fesa()aDrmumpot0oee miciytfa ua(mpnt4 eerxo3oadop e n ols  rur(o ny1lme mfei tfaDtmxm no0alx  f3ildla umn s;t)arxrir oatomDeln i s)trtmxr3oo4ll nlivtl(fartaur ;o4aeenmieiatla2uanvs;(0altnmrcoa1lateaieo;t setrxr3nodlmtemfvs ( s2urx o;u1alxn o3ildfm eln s t)trenxo3oy1lpt ln i (0s2toxmpoydam  miet tfsDumurpot4tlxnmi3iys a rlnvonu0artoifcoatoatrli s;t s2urxrpoo4am   ivs sfsDur(mp;u0tpeomi3ild m rmuvo t0teerir3tatlate ivsls)srxoimpoo4ale mfviat a2ur( ont0aleomf3tlsfaDrl(vp (0tleomr ty1om e n sls0s2ur(mpnu4ll  lnvtat)arrau  nt0optomf3iatlmDem(mpnt)arermfciodfm e ues t)trxo(mpiudlp  livsa(fsDtmxr nt0openmoctatfs rluvs (0altoxr ta1fpDelues s0trxoir ny4lle  fes sfsrua(m ;t1opt mi3ias a uau s u0aexrir iotfmDelnei t  2xrimpiu4am emfcsa( sDumu  nu4tlt  iciadlm ea(ms (4alxrir iy1fpt  n i;t truoir iodllen fvt t)sDrrx  ;o4apx ifctytfa2ulnmpn(4 rtoxfcoy1lpDrai ols)t2toxm oydoptemiciat  Drrxmp;o4aee moctyslsDel( o u4 etrxo iadop  lnei;s s2urxopiu1omt  fvsas)srua(r ;u0tltomfciat aDem(vo t4 lxomo3iytoaDrlivo;s)texmim3io4alenlnesl( s2rr(ro;t1oeeo fctaslmDraumo u4 etnxr3iy1omteauvi s  2uo(r3oodolen feslt)sDtmumo;o1tlenmociad s2rl(vs;u4 rxoxr totoaDe i olt0t2tm(r3oydapt  ieiasfa2ua(m ou1opeoiiciatla2elnvp;(0trtomocia1opteaivo;()srtrirpoo4lm e nesl()aDuaxrpnu0ole mo3iys m umu p;t0alxnxr3iadlm   ivils  2trxm3no1lmeemiesasf rrmur oo0teen f3iadfa2ran sn()trtrif3iatopteli i t t2xoiopnodal e ivias  Dtaurpoo0aetnmfeiltfsDrau onu0altnmr3oy1lm rli i ()seto(opoudalt lfvia()aDraurp;t1oleo ictlt mDeaumo u)tlenio oatfpD an i (  rxmio3oo1lmt lfvt (f Dua(rpnt1olenmietltfs ul( sn(4texomr oy1om rauvi s s2triopnu4ll nmicsat srtm(rp;o0oetnifeiyd s rl(vs u0 lermr3ia1fp e nvo t trumxopoy4lm   fcs sfa2ur( p;o1ape  i3iaslaDrmumsnt0aeermo3oytlm e ueol() 2xr(m io1altnliviltfaDurxr ;u1oleoiieild a2eau p;u4teenxrciytlmD ln i;t)teum(mpoudlm e nvs sfs2tr(  oo0tltnmoeiad s uln s t0 eenxf3iy1fm r ieil(0srtr(m oy1altemietlt s2raxrpot1apt  f3ilsfa2ua( snu4 rxoif3iodlm elies s0 eur(rpoo4ape mictls)sDuau o;u1opeoifciadlm umnmpnt4aexnmo3iadomt au ils0 2um(m iudope  ncsls) 2tm(rpnu4optoio3tls aDuluvp;u)trtrif3oadopDeai i;t)s2xmim oydlpeemnesl()aDtau o;t4oltoioctat a2rl(ms;u4tlxnxf3iy1lpDeaiei;t sexmirpiu1alen nviat)a2tm(rpno1tptn oetydlm rlnms t4teeomfcia1lmtr uvi (0srtmir ou4al n ivias s2ta( oot0tpxomf3tlsfs uauvo t4teermfctotlm eanes;t seumiopiy4olenmnci s  2um(monu1ole mf3tatfm uanmpn(0trtrxr io1fa   nvi s t2toxr nydole  ietl() Durxmonu4oex  iciyslaDumu s;(4 etnxrcoytlat lueo;t teumio oo4omt  icslt  Drm(mpoo4ole miciydls2um(vs ()texrxr oatfpteaueo s seurir oo4al nmnvsls aDuaxro;o1aetnmieiltlaDrmnvs;() eermfciytfmDrluvs;s)sexoxm3iydapt lfei sfsrrrxmpno4apeo octatls2emn snt4tlxrmocta1oa   n o t0 2xmxmpiudalee iesl()a2umumono4apt iieiatla rl(vp;u) rxomr todfpt  nes;t s2xoim3iu1lpeelnesas a2ra( o;t0alx  octys sDrlnms;()alxnifcoo1lpte n o;s  2umxo3iu1opt lnesl( s2rmxro;t4aee  fctasfs em(mpn(0tltoirciy1lm eaueils)trur(o3io4openmivs sfsDrax  ;u4olt if3tadfa2el( o u0arxoxr iadlmtrau o s) euo(o iy1lptnmivt () Dua( pno4tle mf3iltla2ran s (0texnxr totfaDeai s;t0srxmxrpoy4oleelivia() rrrum ou0tpe io3ildfs2rluvont)aeeoxr iytomtelneo;(0t2xoxm3oo4lle lfctltfsrrm(rooo0tlxniociyd mDeau p t) ltrxf3totoate nes;s)srxo(mpny1al  mfeslsfa2tmxrpou1tleo o3iaslm elu o t)tltrmfcoa1fatrln o ( seuoir iu1ope mfctls) rur(mono1aex if3iytlm2elu s;()areoif3oo1lptrliesls srumir ny1am e nei (fs2trumpnu4aexnmfeild s2el(ms;(4tetnirctatla rli sl( tetoio nodoptn icslsf 2rmum oo4tltnmo3tytfs2ranms;t0 lxriocio1la eaues;(0 eumxmpoo4al   nvs tfs2urumooo0alxn fctatfmDulnms;u)altoxrctodfa e n o s)trumxr3oo4lm nlncslt)arur(ront4opto oeiyslsDum(mp t) ltnxr oydlptr ieil(0 2umir3oudaptelfvs ( arua(rp;u1alto i3tasfaDrmump;u0aexrir oa1lmDrai ol(0s2xr(r nudop emictltfartr(mono0apt ifcildlaDem(vp t0trxrxfciatopte uei t)s2xoir3nodoptnliei s)artrx pnt4tetoifciysfm el(mp;(4 reoxocoa1faDeliei;s s2xm(mpiy4llee netatfaDrau ono4tpx  oetltla ean o u)aetnxf oodlatraies s  rxo(rpio1ll e ivtls srurxr ou0olxn i3ilsfa em(vo u0treoirciadfaDran i ( trxoxm oy1al  mnvsa( s2rrxmpno1oexnmociltls2ua(ms t4tetnxr3oytlateauvs t t2xm(m nu1alt mfcs t arrr(rp;o1oeeoif3iltfm2ran pn(0trxrxo iodlpte ies t0s2tm(mpoodame  net s)a2tru o;o1aptn f3ilsfsDelums t)texnmr oodom r i s;t)s2urxrpoo1llte nvsat  rrrxro;t1tetomociyd a emnvo (4aetnmf ia1fpD ln i s0s2tm(o3oo4ll e fci s)sDuaurooo1tpxnii3iytfs ra( s;() ltnif iotoate nvil()t2uoxm iu1olenmnvs (faDra(m nt4oee  ieild a um(vsnt4 exnmr oatfmt lues;s trurir3iydlmtnmfci ()arta(  ;o4tee  feilsfm2rlu o t) rtnxocoodomt li o;t)seuo(mpnu4lpe lnvsat  Dur(r ot1ale mfcilsla2ua( p ()trxoxr oo1laD auei;s0t2xoio ny1lmt  feils  2rr( poo1olt mfeiadlsDul(mo;u4altrirctodfa rlivil( trxoio iu4ap  mnvsat)s2ra( pnu0tex if3tlslaDeauvo u4texomocoadlm eanvs;s)texoxopio4omtelfesa() rraumonu1apeomo3iatla2emuvs u0 lxrmo3oytlpte neil(0srtoimpiy1oltelfeiltfs2um(ront4tee mo3iasfaDeauvp t4arxnmf3totlpD  neo t0sexmxm no1amt lfcia( srtaumpot1opx  feiat a ul(vsn() leoifciodom eai ilt)t2xrio3ny4apeemfcilsf 2tmum ;u1olxoiociasls2ulu sn(0tetrxr3tadfpt lueilt0 2tr(r3oo4om n icsl() rra(m oo0tlt  o3iad s el(vs (4artnif iatlp rlivolt)trtoxo oy1openlivs t)a2umu  no1olxoio3ilsfs ulu p;t0 eenmf3iatlmt lnvsl(0t2uo(m3nu4omtn fcsls aDrru poo0alxoifcildfa ran onu4 eenxfciydlate ueil() exrxo nudome lfct s) Dtax  ;t1opt iociltlmDrm( o;u0 etrxocootfmDr uei;() rtmxopiy4ol e iet t artmur oo0ole  iciydls2eanvo;t) rtrxr totlpDranvo ( srxr(r oy1alee netat)aDtax p;u0ape ii3iat m2ulu snu)teerircta1fmD li s;t0seto(r3iu1amteliesltfsrrrxrp;t1apen ietyd a2emuvo;(4aleoif3iydfpDrlivsls0trumxo ny4lptnlfesl(f Duaxrp;u1tlen f3tytlm raump u0aeenir3ty1omtr neo s)texrim3oydlp emnei t) 2ra(rpot0aexn f3iatfs2elums;t4tetnifcoy1omD luvo;t0s2tmxr3ny1ome mfvsat sDurumoou4oltomocild sDumnvp (4aeenxocto1op rlneils)s2xoxr oodamenmfcilsfsDra(rp;o4tpxoiietydfm2ranvsnt0altoxo3iydlat  uvils0trtrxr no1lm e net s  ruax  nu1texnii3iydlm2rm(vs u) reoif3io1lmtrau s s0s2umio3oo1omtnlfvsa( a2rrurono1tetniictas a2elnms (0alxrio3iotlpt an s t)trxmim3iodll n feslt) rtrx o;u4teto o3tltfm emums u)tetnxo3iotopDeluvsl( srum(rpiy1op  micils)aDtmxrono0tle mictldlsDeanvp (0 eenxf oo1om elues s  2xmio oo4lmt lncs s  rrmu pot4alx iiciydfaDelu s;t0alxoircoytfmt lueolt) rtr(m3no4lme livias  Dur(rpoo1apeomi3iadfaDra(vs t)treoio3tatfaDrlu sls  rxo(m3oydome lncsasf 2umuront1opeo fctlsfsDuau o u4 reoifcia1fat luvs;t0teto(m3iodlp  mivsatfarururp;u1alt mf3ildfa2rmnmo (0tleomr tytla eau ilt  exoim ou1om n netatf rumurpno4tet  ociat sDrlnvp;() lenif iytla  ln s s) exrio nodlmt mivtl( artm(mono1aptniietlt a2rlump;t0alxrmfctytfm rai ols0s2xoxr3oodalenlnvt (faDrax  ;u4oee  ietas sDumu snu)alxomf iydfm eaiei s texmxo3io1oltemiet tfartax p;t0tpen f3ilsfsDemn p t)teerxrcto1fa   ieils) exmio nu4lpenmicias  2urx pnt1aeto ictadla uaumonu0treoif3oydfpDeauvols) 2urir3oy1lltnlnct ( arum( poo1optoiiciasla2em(msnt4altrir3iatom  ln o;s teuoxr3oodop n nvtlsf Drrx pnt4aex  iciadfsDranmp ()altomo totoa r uvo (0truriopiu4lltn ietlt a2tmurpnu1apt  o3ias sDulump t0aetnir io1oaDelnvi t0 2umxo oy1ol  lfvsls artrurpot1tle mi3ildfmDea(monu0 rxrxf oadfaDr ueols srto(m io4omen nciat) rraur no0tpxn i3iytfm2rlumpnt) lerxf totla ranvi;s) etrio3ny1lltnmiesl(f 2tm(m nt1apt iiciydlsDumuvs u0 ltnmo ootlaDeliei;s)t2xrir3nu4lp emiesl()a2ur(rono4olt  ieiltfsDrm(mo;t0 lxomocto1opDeli i;t0tetrxm iydop  miei (fsDrax  no1alt  i3tytla rlnms u)tetoxf iatlp eau ol( texrxr3io4al n neta( a2umxr ou0tpxo ietat a2eluvs t0 ltnio3totlatr u ols0 2uoir oy4omtnlfvt sfa2rr(m ou1ole ifciydlaDumu onu) lxomo3to1omteanei s) etmiopnydlp   fvilsf rumx o;o4oet mociat m2ra(vsnt4aeerircto1omteanvs s t2xrir3oodal e ieslt)arta(rpnu4tpxnif3iyslm2elu p (4trxrmfciodfmtrlu s s)s2umxo3nydlm  mncsa()a2tr(rpot0teenmf3iytls umnvp;()artnir oatlpt  u sls0 etrxmpiu4llte ivt tfa2ururpnu1oet ioetas a2emnvont)aetrifcoo1oaDr uvi t0t2xmir nu1lmtnlnvsatfa2rau p;t0tle  ieils m eauvs;u)tltomf ta1lmtraiesl( trxoxo oydomtelies s s2ta( ono4oltnif3iydfsDeln o;(4arxomf3oy1fmte uei;s  ruoimpnodomtnlict tfsrtmumooo4tlxn feiasla2raums;u)areoxr oy1fp e ues t0 2uo(o3nodom n ncta(f rurxm ;t0tlen i3ildfa rmu snt4aetnxf3oydoatrlivo s t2um(r3oo4lm nlfeiltf Dum(m nt4tptn ociasfa rm(vo;u)artrmo totfat lnvs;t)srurxr3iodlp elfcta(  2umx onu1oexnmfeiad sDem(vp t0trxnxo3iotoa eauei;t) rxoxmpny4amt  neta(  rrrx poo4opt  feiydfm elu p t)alxrmocta1faDe i sl(0 rto(o3no4omtemfesltfa2ur(mp;t1tlto octlsfs2uauvpn()areomo3oydom   ues s t2tmim oo1ll n fvia(f 2rrxmp;o0opeomi3tytfmDra( s;(0arxoxf3oatfpte iei;s) rtoxr oo1op n feia(  2uaxmpot0aeeoifctysla2ranvs t4tetnirciotfatrln sls trtmirpiy1omenlfesas) 2rax oot1alenmi3ildlaDel( s;u)treomr oydfatelu slt) eur(o3nu4lptnlivsat)aDraurpno4tlt  feiat m ra( s ()aetrmr3oo1oaD ai ol(0s2xoio no1op emnei (fsDrmxro;t0apto ociyd a ra(ms;u4areoio3ta1faD liei;( trtrir3iu4ap nmfcils)aDur(mo;o0apeo octytfa2ea(vp ()tlxnio3oo1oat  ues;s0trtmxmpnydame  ieia(  rrru ooo0olxo o3tlsfmDuanvp;u4trtnir3iotoaD luvo t  rumiopnodll  mics tf 2rr(mpnu0aexn oeildfsDemu o u) etrxfcoa1fpt  i i t0t2trxm nodap  licsa()sDtmu ooo1tltn icilt aDuln snu4aexnxf3tydlmte nvo;s0trurir3nydlmeemfei (fs2rr(r nt1opt  fctysfs ua( o;u4aetrxfcoatlat luvolt  rumir3oy4al nmfcs t) Duaurpoo4tex  ieiadfmDrm(ms;(4 leoxf oodfm e u ilt) rur(o io4opee ivt tfartau ono4oex mo3ilt a rmumpn(4arxnxf3oytfpt  nes t0sexoxm ny1op  lict tfaDuax  no4alt moeiytlm ran s;(4artomf3tydlmD ai s;(0srur(m nodaptelnesltfsrrru p;u4aleomfctatlmDra( o;u4trtnifcoytoate u i;s) 2urxmpou4lmt mfci ()srrmuront4ape mietltlmDemuvsnu0 ltoxf3oodfmDeau sl(0s2toxo ny4olenlncs (fs2trx  nu1tpenmf3iytlm2rauvs u0trtoxf3tytfpt an i;(  rxoxr3oo1llen netat sDrmx oot4tptnmo3ilt m emn snu0tltoirciydfmtrlneo t teurxo iodlpe  fcia()s2ta( o;u4tpx  ociadlm elnvp u0 rxnmo iatlat anes s  exr(mpoy4omenmivtas  2ta(rpnt1apx ifctldlaDrluvsnu0 lxoifcoadfa eluvo;s)t2xoxr iydomeelneia()artax pou0olt mfctydls rmuvs t)trtrir3iytlm r ieils0trum(r3iy1om e ncilt a2tr(monu4optniociydfaDelnvpnu)artomrciodlmtelu o s0sexrxm oo1optnlfvsls) rrr( oou0oexnmo3iasls ul(vont0alxnmf iydom eauvo;( trtr(opno4lmtnlnct t srrrxmpot4aexomo3iyt sDem(vp u)texrif3tatfp  liei;s)trumxmpou4op nmfetas  2rmuroou4oee  oeild aDrmu snt)arenmrcty1op elnvi;s t2xr(m iu4llen ictlt aDrr(ront4alt ifciytlmDrm(ms (4tetnir3totoa rln i t0srtrxo3ou4ape  fvi ()aDrru  ;u0olxo o3tasla emnmo;u) rtnio3iy1fateln i s0 exo(r nudaptelfctatfsDum( ono1tpe iietysls2ea(vo t4 lxrmociadfmDeauvi;()setoxr oo1ol nmietl(fsDtm(ronu4alxo i3iyslm ranmp;t4 rxnxf iadfatr nvils)sexrxmpio4ll emieslsf Dua(moot4tpt  i3tat m2el(vonu) exnmocoatla raies ( s2xr(m nu1lp nlfcsa(fsrur(rpnt0altomo3ildlmDea(vo;u0trenif3to1fate nvs s0s2xo(m3nu1al elncsa(fs2ua(monu0ale io3iadfs2ul(vs;()tlerxf3ia1omt anvi (0trxr(r nydale lnvs sfaDrmx oou0tpxomfctatlm elnvonu)teermf3iydlpte n s s texrxo iu4ameelnctl(fartaxmont1tet ifeiys m2rm(mo;u4 reriociatlmD li olt)seum(m3nu4ap nlfcia( sDrax  nt4apxo f3iadlm2rlu p t)artomrciydoaDrln olt)t2urim nodom emivilsfsrta(mo;t4aetn i3tadfaDra(vp;u4 lenmo3ia1faDe n o;()sexoxopou1omt  netls)s2umxmp;u1opeomfetytlmDra(vs;u) lermf tadom  livo s0s2xrimpou1olt  ncsl(farrr(mo;o1oetoiocilsfmDrmumo u4 exrircoytfa   uei;() exrxmpnudomen nvi ()s2ur(m ;o4aptnmo3tadfaDeaums;t) exnio3iodfp  lueols t2xrxo3io1alenlncslt arrmxront1tle  iciysls2emuvs;u0trxrio3oa1oaD  n s t0teumiopoudolt  net t) rtaum ot1olxn o3ildlm2ran p;u0tlenxfcoa1omtraivs;()trxo(o ny1lp  mictl() 2rm(r oo1tlx mieiat a ua(mp t)tlerif3todfaDrlivils s2xoxm3oydal   icia(faruaur ;u1aexnmf3iytfa2rln pn(4 etnmrcia1oateluei s0 2xriopiy4altnmivtl(  2taxr ou1aleo feildls2eau p;(4aeenxf3oa1opDr ivi s0trtrio3nu4ope mnvtas arraxmpoo1tlxnifeiyslsDulnmp t4 rtrmrcoytlat  ieo t0seurio ny1aptn nvia(  rumumoot0aeeomfeiltlsDrl( pnu)tleoif totfpDr ueo (0trtoir nu1lmtelnetlsfa2um(rooo4ape  iciadfaDrmuvp;(0arermrctotoat lneol()seurim iodoptemieslt)s2tmxm nu1teto i3iyd sDrluvs;()tlxrxo3ta1lmDe ivo;()t2um(o iydlp elfet sf 2tm(  ou0tpx mi3tat aDul(vp;(0 rxomf oo1la   n sl(0 exrim3iu1lm nmnctl(f Drmurpnu1aptomieilsfa elnvs;(0arenircia1omDrlivs;t) rtr(rpiu4llenmncslt  ruaxm ;u4altoioctaslaDea(vo;() rtnmrcio1fptr ueslt trurir3ou4olte ici t arrr(rpnt1olt mfciydfm2ua(vp;(4 eenmf3tatomDr nesls)srxrxmpoudaptn ncs (f Dum(rpnt0alt iociydlsDrmn snt) exoif3iotla eanei () 2trxo3no1lle  fctatf rtm(ro;u0tltnio3iatfs2ra(msnu0 lxrxfciytfm elueilt  2toio3iy4amtn neilt) Dtrum no0tpen oetlslaDrlnmon(0 exnif3oy1fm rau ilt s2xoxr oo4alt micta()s2rr(mp;u4aexo fctysfmDumnvs;t4arxrxr oa1lpt auvsls  etmxmpoodam nlnctlt aDum(  ou1tex mf3iytlm2rm( o (0teerxr3iytfm  aies;s  2xoir3no1op  lnvia(faDtrumpno1aexnifeiadla eln o;t4 lenmrciadfptran i;() 2tm(rpnudam emfvsls)a2uax  nu4opxniieilsla elump;t4arenxo3totfpt aieilt  2tmir io1op  licils)a2tm(mo;u1oex moeiasls ul(mo;(4 eermo3ootfm  auvs ( texr(r3oudomte nvi ( s2tmxro;o1apt  f3tys m2uan pnt4 lxrifciy1laDraies ()seuo(r3iu1ape  nci s srrmu oot0optomo3tatlaDuaump;t0 lxrio3to1lpDr ies (  2urimpiu1lptnmfviat  rumumpnu4oleo fetydfs2ulump;(0texnmo oodoat auvi t0texrxo io1lptnlfci tf 2trx  oo0aleo i3tls m2ra(ms (0 rtrifcoa1fat lnvil( teum(r oydop  mnet (fsrta(rpnt0altn i3tysls2eau on(0alxnio3iydop rlues s0 euoio3oo1amtn fvtas sDtmxm ;t0ole ifeilsfm rln sn(0tltoxo3totfp  li slt) eto(o3oy4lpen icsa(fa2trxmont4tlen f3iasfm el(vs;(0 leoxr oydfpDe u i () exmxm3nodomt mfeia()a2trum ou0aetomf3iysfs2uln o ()artrirciodomDeai o ()setrirpio4oltelfes s aDtrurpoo1aetn ieilsls ua(ms (4aexoir ia1oa ranvo ()teuo(o oydom  mfet t a2rrx p;o4tpx  ieiytls um(vs;u)aexrmr oo1fp r nes (0s2uo(o iudom n feiat aDtmxmpot4tpe if3ilsfm uluvs ()teeriocio1fatr n sl( srxmxrpou4am n netasfsrrrxr nu1alto ociydfs2ea( ont)tlxoif iydlaDelnvi t s2umimpio1lptelfesl() Dur( oou0oee  ictysfm eauvs u)tlerxr3tatfmDrluesl()tetmxo3iu1llen ncsa( a2tmur ot0apx  o3tldfm2ra(mpn(0alenmfcto1lpD lu i t0s2toxo3oy4amtnmictls s2tau pno4apeoioctad m emumo;u0arerircoa1lmtr u sl( s2xriopio1al n ics t srrm(mo;u4aexnmociytfs2uau o;t0 eenir3iadlaDr ivil(0seuoio iy1apeemfciatf 2ta(r ;o1opxn fetlsfs2um(mp t4alxnxo3ootom raiei s0 eur(rpiu1lm elies (fsDtau oot4oeeniictydla2ulu o;(0 lxoio io1latr nesls0 2xr(r3oo1am  mnvtlt) rumxrp;t4alxn o3ilslmDran p (4alxnmf oo1laDe u o;t)sruoio3oo4lleemncils  Durxmp;u4opxn iciatlsDrl( o () renir3iodopDrli s;( s2xrir nu1amtemnetas sDumx  ;t1tptn oeiysfaDra( sn()alxrmfcoatoaDelnvs () euoirpny4lptelncsas  Dumxmont1aexo iciasla2rl(vp t0trtnmrciodomDran ils t2to(m iy4al n ncias)srrm( o;t0tlxn o3iydfm eau pn()alermr3iodoatr ueo t teurio iu1opee nvtlt s2rmxro;u0oleniiciasfm2rl(vpnt) etomocia1omtrluei (  exoxm3iy1opee ivsl() 2tmum ;o4opt io3tysls emu s t0 ltoio3totfatelu s;s0truo(r3oydole lfcsl(  Duau pot1aeeo f3ilt m2uanmo;(0artrxf iodlp rauei;t0 2tr(o nodlp eliviltfsrum(m no0oeenmi3tlt sDrl( o u)tlxnir to1lptrlnes;s  2uoxrpnydamenlfvils arurum nt4tpeniiciltlsDrl(mpn(4altoxf3iy1fmt ai olt)t2toxmpno1ll nmfct t srta( ooo0tetn ietysfmDulums t4 exnmr oatlmtrlneo;(0 eur(o3ou1openmfcsa(f rrm(  ot1teenmiciat a um(vp u) etnmrcoytfmt  u i;t) 2xo(m3nudamt  icsa(fsDurur ot1ole mo3iydfs ea(vo t)trenmf3iatlp  aiesl()setmio3oo4alenlfcias s2rm(  ou0tee mfctltfa2uau pnu4alenio3oydfpDe n i s texoxo3nodlpte fctltfa2ur(rp;u4tex iiciatlm2em( p t0tlenmocia1oat lneols)srumiopoodll emfvtls  2ur(  nt1tetn o3iydfa2uln p;(4arenxr3iotom e nvs;s  etr(o3iy4lm  mfcs tfartm(m nt4olx mi3tld s2rm(vont0 ltrio3totlp  li ilt0 exmxo oy4lmee nvsas artaxr ou0apxn i3iatlsDum(vo;(0texoxr3tadfmDrln o t s2trxopnu4ap   ict t aDrrx oot1oeen f3iysfa2rluvs;() lxnxocoadfat anvs;t0 2urir3oo1lmtemivsat)s2taxmoou0aet mieiad sDrm(ms;(4artoxrcoodomD  ieols0 eurxrpoy4ll  lnvias s2taur oo4optnmoctadlm ranmon() exoxf3iadfat  i ol( srum(o3no1ame  ivsl(f rtr( oou4alxn fctltla2rm(vont4aleomo3ia1fpD auvs s0 2xoxr3iudop e ictl( artrurpot0aptomfeiyd a eau pnu4arxnmf totfp e ues t0 etoxo ou4lpt  fesls s2rr(ronu4oexoiiciytlmDrmu snt0aexnir oadlmDrlnei s seum(opiydlm   fctltf rua(m oo0apxnmfeiasfm ulump u4arxoxr3iadoaD an s t  etmir3iydlpt lnesls)a2rmur no0tpe if3iysfsDemnms;t4 exnio tytlpt  nvslt)s2xmxrpio1op elivi t sDtr(rooo1olxo octyd m2rmnmo;u0tre
\ No newline at end of file
@@ -0,0 +1 @@
+ueol(0 rtm(rpnu1ll elfvsa(f Dum( poo4aeeo fciys a emnvo;t0tlerio3oatlpD  uesls0s2umxo3oo4oleelneiltfsDtax  no0openii3iat mDea(vsnu0tlxrxfcootoateln o;()trur(rpiu1lle lnvt tfarra( o;o0aptnmf3tys sDemuvonu0 etrxocoatoa   ivs;s srtrio3iu4amen nesat aDrmurono1aexn ietadfs el(mo;(4 eerxr3oa1fmDeauvils s2xrxm3iu4lpenlfeias sruru  no4tpeoif3tatfs2umn p u4 lermocoy1fpDe n s s)trtmxmpnu4ale  nesas)sDua(mono1olxomoctldfs2umnms;t)trtoir3tytomtraieo s seurxrpny1apte ivils) 2ra(mpnt1olt  f3tydls2rmnmon()texoxo3iodomt aieo;t  rxr(m3oudapenmiesl(f 2rrxmpno1ole mfetyt s elnvp;t4 rerir oatlpDelnei ( t2to(mpoy1al n neiat)s2urum no4alen o3iytlmDulnmon()trenxo tatfa eanvi t)tetrir3oudope lict ()srra(  nu0aleomieiydlaDuln o t) rerxfciadlp eanei;( t2urxo3nu1ll emncsa(fartrurono4olx  fctltlm2eln s u)tltomocty1opDr u i t srtrxm3iu4ll n nctl()sDtaum nu0aexoifciys sDemuvsn(4texomo tytlpt auvi t0sexrim3oydlpt  ietasfartrumont0oeto oeiyt aDeluvpnu0 rxnxociotfatelu ol( setr(o oo1op  lfetltfs2ua( pnt0opt if3iydlm2eluvo () ltoir io1oa eau sl(0srxmirpoy4amtemfvtas)sDumu  ot1aeen feiytlaDeaumo t)artnifcoadlm   n ol(  rtrxr3nodoptnmiet t)srtr( oou4altniiciltfs ranmp;u)aetoif3tydop r ivs s)t2xo(r3io1apte feil(fs2tm(  oo4tpt ifetyd aDemn pnt)texnmr tadfpte i slt0texoxmpno1am elfcilt) 2uax onu1tetnmo3iatfs em( snt0teerifciy1laD lnvo;() 2xrirpiydlp elfetas a2ur(roou1tlxo ietysfmDua(vs;t4 lerxo3oydomD aieols srxmxm3nu1ll emfcsls s2rrumo;t0apxomociatlm rm( snt4 ltoioctodlpDeauvolt teuo(o3iy1lmenlicsls  2tm(ront4opx mictld a2raump u) lxnmf oadom rlnesls  rtoxm3io1am n fci s sruaxmpno1tpxoiiciytfsDumuvpn(4 exomo ty1latelieilt  exr(m3oy4apee nvt sfsrrmxr nu0apt mictydfmDrlump;(4aetomfcoo1lpD auvsl()t2xr(o3iydlptnlnvta()sDum(m nt0tpeo f3iyt sDrlu onu)arxoxfcio1lpte ivol( s2xo(m3no4lmeelfet t)sruax  ;u0oet if3iadls emuvo u0trxoxo3iotlpDraues;() eumxo oodame  net ()sDtmxrp;o0aetoii3tltfsDrln s u0alxrio totlm r ueo;(0 2trxrpou4am nmivtatfsDrr(r ou0teeoiietadfm2rm(mp;t) ltrmfcoy1oaD  ivs (0setmirpnudlmen fcs s aDrrxrp;t0tet  fciltlm2elnvsnu) exnmr3iytfptrluvi;s)trtrir ny4altn fcs s  rurxm ;u1aeto ietadla emu snt4tltoxrciadfm e n i s  2xoio ou1lp e feias sDuaxmpnt4tlxnif3tytfm elnvp;u)aetoxr3tatlm   u i;() rxmio oo1omtn icsl(f 2tmurooo0tlxnioeiadfs2ranvp;()trtoirciytomt aivs (0 rxoir3io4omtnlnesls  2raxmp;o4aeenmf3iysfs2ranmo;() rxnxo oatlmt anvs;t)srtm(m oydllen fetlt artax  oo1alx  oeilslsDranvp;u0tlxomfctotlpteanei;t0s2xoxr3iydap  mfet tf rtaxr ;t4tlxn oetyt a2rmu pn(0 ltrxr iodlmt ai s s) 2xo(m nudop nmictls srua(mont4oee  ociad mDrluvp;t0 exoxf3oytomDe ivi;()seur(o3no1amtnlnvsas)sDurum ;u4opt  o3iysfaDulnmpnt)aexrxf3oatoaDeai il()setrim3nu4ap nlfvi t)arurxrpnt1opxo fctas m ua(monu)tltnir tytfat livi;()srtm(o3no1al   nvilsf Dua( pno1opt  oeiltfs2rluvsn(4 reoxo3iadlpDrlu o;s trumirpny4ome  ivta(f 2rax  ;u0opxoifetyd mDrm( s (0 lxoxo3iadfm  lneilt0t2xmio io4lmtnlfctat)a2rmx ont1teeoioctlslm eln p;u0altnmo3iatoatrlnesls trxoiopoudlltemfvs (fa2um(rpou1teenmf3iytls eauvs;u0aexomr3tadfmD aueo;s)srxm(mpoo4lp e icsa()arrmurp;t4apeoii3tldfsDulu on(0trenxo tatlptrai s ( srtm(m3oo1apte nvtl( aDrmu  ;t0teenmo3tltfa2ul( o;(4 rtrifcoytla   nei s)t2umimpoydam  lfct ( srrrur ;o4openio3tlt a ean o;(4texrir3ta1om r uei s0 2tmxmpoodllenmfcs sfsrum(  ot1tlxn oetasfm el(vo;()aleoxo3totlpDrlieolt trtmir3nydam   ieia(  2urxmp;t0teeniicilt a eaump (0 rerxr iodom e nvilt srtm(r3oy1lm n fcsas)srtm(moou4apeoiociytfm umn pnt) reniocto1omD ln i s)s2um(rpiodapeelieia(faDtr(mooo4aexomo3ilt a2uau s u) lxnmo3ootomD lnvs t tetrim3iu4ameemnvtasfartrxr oo0tleo o3iasla2ranmsn(0treoio3iodfmD lnes;(  rtoxo3oy1lp emnetlt) 2rm(mooo4aee ifeiadls2ul( s u4 rxrifctotla  luvo ()s2to(rpoo4ale lfetl(fs2rmu poo1alxnif3iatls2el( p ()aeermf3oa1omDr iei;t)texm(o3no4lmen neta() Dua(mp;o1tetnmfcils aDemnms u0 lenxo to1fmtr i o t truriopoodam nmieiltf rrmxm ;o1oleo o3ildlsDrm(vsnt0tlxnxrciotla eauei s0tetoxopiu1llt  iet s s2uax  ;u1tlxo fctatfs2emump u)teerif ta1fa r uvilt t2xoir3ou4ape lfvslt) rum(rpot1altomiciytlaDem(vpn(4trxrmociatlaDeaivo s srxoiopiydop   nei (fa2rm(mono1tetn oeiatfs2ranmon(4arerir todopte nvo;s)s2toxm iodllte nvi t)s2urumpoo1oex ii3iytla rmuvp t)tlxnmo3iytfate ivol()s2xoio3ny1ll nlics (fsrraxroou4texnmieiyt a2uluvpnt4trxnmo3io1oaD ln i s0trxm(m3oo4llte ics t  rtr(rono0tptoifeiaslsDea(vs (0tleoir iatla raivs;t teuoxr3ou1lp  lncs (faruru pno0oexo oeils mDrmu snt4altnio oo1om  au sls)trumimpny1al elfes ()s2ua(r ;o1oexnmieiatfsDumu s;u4arerir3iadlmDr uvils)s2umxr3no4lpe lfvs ()sDtru  ot4aetomfetydfaDranms u)teermrciadfpDr uvsls0trxr(mpio1ll  mivt t)aruau p;u0opxo ietlt a2ua(ms;() lerio3oodlm e ivs;t s2xmxrpny1llt livs ( srumump;t4ole io3ils m rmump u0teerxfcty1omteln s t0trurir oodap  mfesls)srum( oot4tetn o3iat aDuaump t4altrmfcoadla elnvo;( texoirpio1al  mfcs s)srta(m no4tltomoetysfm elnvo;t)aexrxfciotop e ivi;s)t2tmxm3nu4opeemfeta(  2urxrp;t4aeeoioeilt m rm(mp (4aleomocoa1op   i i;(0srxmim3nu1aleemietltf rum( onu0optn f3iys s rmn s;(0arermfcty1oat lneo;s  rtmiopoudapt  fvia( arrmum oo4apxoiiciydlm ulu pnu4aeeomo3tatlpD anvo;s)trxo(m oy4apt lfvia(fsrraxmp;u0tpe ifctyd a2umums;u0trtnmr tydoa r i s s0trtmxopio1omt  fci s  rrax pnt0apeomoctas sDumnmont4tlxrio3oydfmtelueo;t0 etmxr3oo4om nmieta()sDrr(moou0tlxnifcilslaDua( p;t)teerio tadom rlnvi s seum(rpoy4omt lfes (fsrumu p;o1tpeoioctyt a2ul( p ()tlxoir3io1fa e n slt trxmim3oy1lp  lncs (f rtrum ;t0tee mfciasfaDrln o u0tlxnxrctatom elies;( trtmio3iu1olte nesat artmxr ;u1tpxo f3tltls emumsn(4alxoxo3tadom rlivi s)sruo(m oy4ol e fcs tfsDra( p;t0tpe  oetldfa2rmnvo (4treomf3iytopt  neil(0 rur(o no4altelfvsas srur(mo;o0opxniociatls rmnmpnu0trtrifctadfpDrai ols  eurxm3ny1lm nlneia(fa2umumpnu4alt  oetat aDuanvp;t) rtnio ootlaD ai o s trxm(m iy1lpe  nvslsf rumurpou1optomfciysls2el( pnu4 etrxo ia1lpt anvs;t)srxrim ou4ome lnetltfarrm(r nu1olenii3tydfs emumont0aeeoxr3ootlat lneol(  2tm(opnu1openlicilt srtmum oo0ole  feiatfm2ulumpnt)aetomfcoatfpte ues s)srtmio3nu4ol emivia()s2uaxro;u1oee mfciatfs eauvs u4 leoirciytlm elivi s0 eurxr iy1altn nesls a2rm( o;o1optoioctlsla ean p u)aeermr3io1oateln o;s) 2tr(o iydomte feslsfsDumu pot1ale iicilsls2elnvs;t4aetrmr iotoa   ueil(0texr(m iy1alt mfvta( sDumum oo1aleomfctytls2eanvo () eeoxfctadfmtranes;s teum(o oydopeelfvia(f Duax  ;t1apxoiietldfa elnvo (4 rerio oydfa  aneol(0s2uo(o io1op   feiltf rrau p;o4tlxo fciaslm2uanms;u4areomo3tydomtelnes;s sexm(r3iodlptemncias) 2tr( pno1ale  feiyslm rmnms u0tetoxr iy1fmtrln i;s0trumio3nydlle mivslt sDumu p;t1tpenmiciytla2ulnmp;(4aeerxr3iodopt lneolt0texo(mpoo1op nmfeiatfaDtmu pnu0aetomo3tyd s2rmu s (4alerxr ia1omD au olt)teuo(mpoy1lle  ivil(f 2uru  nt1oet ifctydfs eaumo;t0arxrmo3oy1fatelnvi ()s2xrir oudopt mnesat  2tau pnu1oee if3iadfm2rm(vo;(0tltnxrctydlaD lu s;(  rxrxr3ou4llee nviasfsDum( p;t4alto o3iad mDrmuvo;()tetrxfcoadopt lues (0seurxmpou4lm e fvil() rrmumpot0tex mietasfm2rmnvo t4 exomo3oodlp eanvo t t2xrim3oydomenlivs t aDtmx o;t1aeenii3ils sDumn p (0arermf totfmDrluvils)texm(mpiy4ap  lfvslsf Dtr( p;u1tlxo octldfm rm( pn(0altoxf oatomD an s;()t2toxr3ny4om elnvtl() rurxrp;t4olxomfciltlm2el(vs;(0tlxoxf3totoate ivo;( srtrxopno1lp nlnes t a2urx  nt0opeo fciyt s um(vsn()aeeomociatlmteau ilt trurxr nu1ame lneiatfa2rmuroot1tetnmoeias a emn s t0tleomr3ia1fa rln i;t0teumxo3iy4olen feia()aDtmx  nt1aet  fetlt s um(von()tlxrmrcoo1fmtraivs t) rumxm3no4lpt lieslsf 2taxrp;t0aleoif3tad m2eau o;u0aexoio oadoa  aiesls s2tmxopnodlleemncslsfsrua(mo;o1optnmoetasfa emumsn()alxrxfcoo1oaDranesl(0srtriopou4aptnmieil()a2umxrp;t4optnmi3iltfs ra( on()trtnif3iytfm ranei t0s2xrxopou1amtnmivtas)aDrrur no4olxnmo3tlsla2rmuvs;t4 leoir3iydopte u slt setmiopoy4om   ietl( a2tr( p;u4aeeniieiydlm2rmu o;() etrxfcootoptran il( s2xo(o3ou4llt liet s)s2tr(  ot0alxo f3iltfmDulnvs u4tlenmfctodfa  luvslt0trtoio no4al nlivilt  rrmu  ;u0ole  i3ild m eanms (4tlxnxr to1lat lnvs;t0srtm(o3ny4lp nmivt t)s2rmxr oo1altnmo3iysla emu o (0tetomfcia1oate ivo;t trto(rpny4altemfvs (f rraxmo;t1apto i3iatfm umn o u4tltnxrctatfate i ils)t2uoim ou4omen ics sf rtax o;u4tlt  f3tas a2rm(mpn(0texnmf3iytlat aieo t sexo(opoo1lpt lfci t srtr(r ;t4aexn ieiadfmDua( p u4 exnxf3tadfp rliesl(0trumxr3iu1lptemnvtas) rrrx ono1oexn fcildfs rlnvp u4aetrmr3oydfmteluvs;t0trxrxmpoo4omenlicils)srtrum no1teenioeiadlm2elnvsnt4tetoio3to1opteluvs;s0s2tmiopiy1ll n fvt t arur(m no4tle mfctltfm rmn ont4 reomo to1lp  li il(0teto(opiu1omeelneilsfaDum(rp;o1oee mf3iasfsDrau o u)altrxocta1om  ln sl(0 2tmimpnudllte fes t sDraxmpnt1oeen i3iytfs eluvpn() exnif oa1lmDelueo;s  2to(o iu4lme  fesas)a2umu  nu4aex  feiatfa2ean o t) lxoxf iadfm rln s;( trxr(o3oodlptelfvt (  rrmum ou4opx  f3iatla rm(mo;(0texrxr3io1fm elneo ( s2to(m ny1lmen ivtl(f 2tmurpnu0olenii3iad aDuan p;t)teeoxo oadfmDran i;s)texoio no4altnmnvsl()s2tm(mp;o1tex  iciyd aDrmu p () ltrif oadoa   nes;s0 exmxopio1olte ncilt a2rrxro;u4tpx  f3ias m2rmu p t0artnir3tatlpt lnvi;t0 rurxo3nu4ll e fes () Drru pnt0aee iocias sDrauvon(4teeoir iytomDr neol(0texrxo iu1ome  nvt (faDtaxro;u4apeoiieild m2ulnvsn(0arxrmfciytfm  lneslt tetoio nudolte neilt)sDrm( o;u0texn f3tyslsDel(mp;u4 exnxr3ootlaDelivs (0 2xr(m3no1lleelfeil( a2urxmoot0apt iictld s2el(vont0 ltrifciodlaDelnvo;()setmxm no1lle mfesat  2urumpot0opxomietys mDul(vpnt0 rtnir totlmt  nvi;t)teto(m3nu1ape liciat)a2tau  nt0aetnmf3iyslaDea(ms u)trermr3oytlm  au i;s)texmiopoodoleemicia(f rtau  ot1aetnmi3tydfa2ul(mon(0 rtnio3tadlmDean s s0sexoxr oo4lmtelfvtlt sDta(mp;o0aptn f3tasfa eaums;()tetnxo oy1lpDrlueo;(0 eumio3oydlmtelivta(  rtaumo;o4apxomfciatfsDrm( on(4altrmrctadfaDeli o s)t2um(o nudom nlnei tf Draurono4altnmfeiysla ulnmp t4trtrio3io1oaD lnei s0sexo(opoo4lmt miviat  rtm(mo;o4opeoiociat a uau p u4artnxo io1fmD aieslt)s2toxopiy4ameemnei ( s2rau  no0aexnio3tld aDrm(vp;u0 lerioctydom  anvi;()sexmxmpiy4aptemfvs t  rrau pnu0tlxnmo3ildfm elumsnt4trtomfctytomD luvsls) ruoim io1llte ncsa(f Dtmxmono0tlxniictasfs2ran s (4alxrmr tadfmtr ueslt srtrxr nudomtemfvils) 2trxrpoo1apx iietaslsDemu p;t4 etrmf3totlaD  uei (0s2trio iu4oltnlfei (fartmumpnu4apt ifetltfsDrmu p u)arxniociy1oaD lneslt)seuoir oodlpte fcta(  rtmxmp;u4opeo f3tat s rlumo u4alxrmociydlp  aues s texmir3nodlmenmivt s  Dururono4apxnmf3tyd sDulnvsnt4texnmf3to1fatelueils0t2xrir iu1am nmnvs (f Dtm(mpnt4aetn fctys m rln s (0tleoxrctytlmDean s t srtmxr3oo4apenlicsls s2ururpot0oltnmfeiat s2elnvsnu)aeeoxrctodomte i o s)s2xoxmpnodapeelnes tfsDumxr ;u1tetoiocias s eln pnt0 ltrmf3iytfaD lies t0 2toxr ou4lpenlivt s)a2rmx p;u0teeo f3iysfsDrlu o;u4alxrxo3iatfm ranvo s t2urimpno4ale  icsas s2rrxmp;u0apxo i3iad a rlnmo;t0tetoxr oadla  lneo;s)sexrxo3io4ol  livsls)aDtax ooo1apeomieiatlaDel(vp t4trenxf3oytfaDe i sl() euoxr3oy4apt  fvsl(  Durx p;u0tpxo feiatlmDean onu4trenxf ta1lpDelies;t  2xoxm iydol emivtat  rtaxrpot0oetoifeiysls umn pn(4 lxrmf oo1fm r u o;s)s2umio3oudamt  nctas) Drrxro;u0tlt  oeiyd s rm(vs u0trenmo3iytlateanvo;t0srxoim ny1lpeelfct t) Duaxmpot1texo fctytls2ranmp;t0 exnio tadfmteanvi;(0trxoirpiy4omt lfcias sDrau pno0olenmf3tas s rm( o () exrmo tydlpt li olt srumirpno4amenmfvs t)a2taumont1opeo oeildfs ra( p;(0 rtnxr oytlp  aneslt t2ur(o3iu4optelnciltfsrtmx poo0olx ifeiysfmDelu p;() ltnif3iatlaD ai ils0trxmio3io4ll nmfesl(f 2rmurpnt1tlto f3iltfmDrl(vs (4aetnif3oodlpt  nvol(0 2to(o3ny1om e feta()a2umuront4tex if3ilsfa2ea( s;(4treoxf todlmtrauvolt)s2tmio oudlmee nei () 2urxr ;t1aet  oeiltlmDem( s t4 lenir ootfp ran o;s srxrirpoy1lm n ictas s2umx pot4olxnmi3ildfm2umu s u0 rerxf to1oa elu o t)seurxmpou1omtemfcsls) Dtmx o;t4tltn o3iadla ea(mp;t)trtrif tytlpD  ueo;s0 exmxo oydamen ictat)srumx onu1tlenmi3iydlm2rmu p;t0tlenmr iodla r ivo t  2uriopnydll   netas  Duau  ou4tlxomfciysls2elu p;u0alxoif ty1fatranvo;s0 etrxr3iu4lltemfci s srrr(ro;u1oet mieiltfm ra( sn(4 ltoxf iadfmtraneols0texr(o3nu1ll e icia( aDtmxr ;t4tpe  oeiytlmDemu s t4 eenxocoa1faDr n olt)t2tmir3iu1alenlivi t) Drrx onu0alto o3iys s2eanvon()arerifcoytfp eaivo ()s2tr(m oo4lmtelfcslt)sDta(mono1alt moeiytls elnmo ()aetoxr3oy1fptr iei s srumim ny1amt  ici () 2ra( pot0opxo feiltlsDumn on(0aeeriocoo1oaDeluei;s0 2ur(r oy4aleelict tfa2ua(  no4tltoifctadfmDrln on(4 lxrmr oodfmD  neols0s2xrir iudlpenlnci tfsDtr(mooo0oexoii3tls mDelu o u0 lenio iy1omDrli s s0s2xmir3iu4llen nesa(faDtaxrpot0olxnmfeias a rlnvs;u0trxrxfcoydoaDe nei;s)srxmxm no4ap emnvi s a2ta(rpoo1teenii3iysfs2rm( p;t)aeenircio1fa rlueil( srtr(r3io1amtn neils)sDtrxr no4alxnmf3tadfsDemu p u)trenmf3io1laDeln i s trtrxo3nydlp nmneia( s2tm(r nu4apt if3tltlm em( pn(4 rtrio3todfm  lnei t trum(opiu4ameelivia()s2uaum nt1oetnio3iltfmDeluvs;()trtnxr3tatfmD li sl(0seur(opou1lp nlivsa()aDuaxm nt0tpeo f3ildfaDuan pnt0 reomo3oytfpDr u i t)seuoxo3iy4am emfcsas  2rau pou1aexomiciys s rl(vonu4aeenmo3to1opt  neo t trtrim iy4omtn iei t a2tm(rpnu0olenif3tldla2eanvpnu0trxnir3oytoateluei (0trtmio3oy1omt mfvsls)a2umxmo;t4alt mociytlsDrl(vo;t0 etoif tadopDelu sls  etr(r3ny4lp   fcs s)srrr(m ou1tetoioeiyd aDul(vo;u)artnmr oydopD aneolt0 eumxo ou1lpeemnes ( a2rm(rpnu4oeto iciyd m el(vs (0 ltrif to1omDeaneils seto(opoydop  lncs ( aDtau  oo4opx mociadlm emnms;t4 lenif3ta1fm elueilt)trxmxm oo1altnmncslt sDurxro;u0oet mictydls2emu p;(4 ltnif3iadom   n i;t  rto(m3oydamtn fct ( srua(ronu1tltoif3iasfa eau o;u4 etomo3oytlmD  nvs;(0 exm(r3nodlm n nvilt  Drr( ooo0aptnmf3ild s rmu pn(4alxnmfcoo1fatr nvo;s) exrirpnudome lfctl()srurumoou1olt  o3tlsfm emn o u4arermr3ta1om  lu ols) ruoxmpiodlltemnctl(f rrmurpnu1tptnif3iat s2ea(mpn() rxrxo3totfmDrlneil(0 2urxmpnodalenmfctltfs2rmurpoo0oleoifeias a2rm( pn(0aleomr oytlptran sl() rxrxrpnu4lpe lfcta(f 2uaxmo;u1tlt iictld sDeluvo;t)aeerxo3oa1optelnvi t0srtr(opnydlpt  ncils)srrm(mont0alxomfeiltfs elumo;t4trxrifciodoaDranvo;t)trxoir3iudom  liet t s2raur oo0tlen i3tad s em( p ()trtoiociotlateauei ()srurxopoudlme  ivta()aDrm(monu0tle mietadfm ea(mo u) lxrxfcoydlp  lies;(0 ruo(rpoudlp emfvtl() Dtaum no4tle moeildfm2rmuvo (4tetrio3oa1om raivslt)teuoim3iydam nmfctat  2truronu0tlxomfeiysls2um( sn(4 rxrmr oytopDeli s t srurir3oydamt mfei s a2urx pno0tle  f3iltls el( onu0 ltnxf3todomte uesls0t2xr(r3iy4ol  lieiasf Dta(rpnt0apxoifctadla2umuvsnu0aetnmr ty1lmte u o;( teur(r3io4om   nctas a2uaxr ot0alxoifeiyt mDulnvp t4trerxf iytopDran s;t s2tm(r oy4am   fctat a2ta(r ;u0opto oetld mDrm(ms;u0texrir oytfmtrlivo;(0trtmio3nu4lpe mfcsat  Durum ou0oeeo feiydfaDemuvon() exrxo oodlptrli il( sexoimpou1aptn fvsat  2rrx  no1openmoeiat s2ua(vonu) lxrmfcoytlatran o;s) rxr(m3iodllte feiasfs2um(r ot4oexniieildfsDean pnu4aetoirciy1fatelies s  rurxm3io4olt lnvi (f 2tru o;u1oet  o3tytfmDrluvo u4 rxoxoctytlaDelivo;() 2toirpiy4op   icias)sDurx  ;t1tet mfeiatlaDelu o t0aexnmo3to1lpDr n olt0 2to(o nudam elncs sf Dra( pot4opeomfeiat s emuvp;u)texrifcoodoa   nvsls0 eurxmpnodalenlics (fs2tau  ou0olxo iciltfa ea(mp t)trxnir oydlp r nvi s0 euo(m nodameelfvt tfarrr(rono1texoif3iad m2ul(mp;u4 eeoxf3iytla  aues;( t2toxo3nydal emivia(fs2rmu ont4altomi3tydlm2ra( p t0 exrxfciotfpt  ivi s0teum(mpoudlm emfviasfa2rmuroot1aee ifciysfsDrmnmo (0 rtrifctytomtr n s (0s2xr(o iy4lmte fvi t sDra( oou0aexomf3iasfm2umnms;u4 rtoxr3tadoa e ieils  2to(opno4optn nctat) Durxm ;t4aex  fcild a ulu s u4aexnmrcoadla rlivi;(0 rur(m3iydlpt  nesa(fsDuau  oo1teenmi3iydfa2ua( p u) etrifciy1latr uvil() euoxm3ou4altelivias) 2ur(root1ope mfeiyt a uau p t0trtnmo3oatlate u i;t) etoirpio1apenmfes tfaDtmxmoot4tpenmfeiysfs2eanmp t0tlxomf3oydopteaivo t)trxm(rpnu4opee ici t)sDrm(r ;o0ape ifetydfaDrlnvo;u4aeenif3ootoptrlueslt s2xrirpoy1lltn nci t)sDtmxrooo4tptomictas s2rluvon(4aetoif3iatla eli slt)trxriopiu1opt lietas) rrmumpnt1tlxoii3ild mDuaump ()aetrxo3iytom  lnvil(  2tm(opnodop  micsas s2raxr ;u0tpe ioetlt s umumo () eerxo3oytoaD anvo s)t2xmir ny4lmtnmieiltfarrrxmo;t0teenmf3tyd aDrlnms t4aleoxf3oodfmtraivs;() exr(o3ny1ll   nciatf rrm( o;o0aex ii3ils m ra(vp t0areomo io1om  aivs s texm(m3ou4lmtelfeta( a2rmu ono1tlxn i3ilsfaDrlnms u0aetnif3ootfmtr n ols)t2umxr3ou1om  mieslt aDtm(  ou4apeo i3tltla uau s;t4tlxoio oodlpte u s s)srxr(o nodllee nvs tf 2tru p;o1tlx  ietysls umnmp;t4 rerxocoytoa r ieols) rum(mpiodlmt  ivtl()arta(mpot4tpe mfcilsfaDrm( sn(0tetriociotlmt aivo;t)srxoxm oodll   fcsa(fsDtm(mo;t4tpe  oeildla2em(mpnt)trtoirctotoptean ol( trum(r3no4amtnmfei ()srtaxmont0opxomictltfs ulu p u)artnio3tatfpDelnvi;s)trto(m3oydal e ieias arrrur nu1aexnmictydfs2elu s;t0arxomo to1opD auesl()sexo(m3ou4oltn net tfsDtr( onu0tlt  oeilslsDemnvs u4altoxr to1fptranvilt  eurim nydlle mivsa(f Dtmxm ou0apeo oeiadfm elu snu4aetrmr3iodfaDeaieo s) eumim3ny1optnmncs ( srrmx oou4aleoio3ilt mDelnvo;(4altrmf ootopteliei;( trxmxmpoudllen fcs s aDuaur oo4aleoifeils a2uln p;u0aetoxoctatomDraivsl(0teurxrpoo1lptn fvsas s2rru pno4tpto iciad aDumu snu0artrmr3oytopDeai o;s)tetmio3oydopt mfviatfaDtruro;u4aeto oeias mDuaums;t)arxnifctytomteai s;() rxo(r3oydop elnci sfaDtaum ;t0alt moeiat s2rm(ms u0 rtoxr tatoa r uvi s  2toxo nodlme lfvias)srtmurpno4oexn f3ilsfm em(vpn(0alenmr tatlat livi;t  rxrxmpoodape  ivia(faDtr(m ou1aeenmf3ias m2ea(vo u4 rtoio iotlpt  nvo;s)texrxo nodolenmictl(  Dra(  ;t0texn iciatfmDeau o;()tetoircia1la e nvs;s)srumiopoy1lmeemfvils)s2tmurp;o0teenioctltlm2rm(vo t)trenmfctytlat  u olt trxoir oodameelnvsltf Draxr ;o4aeenifciadlm ra(msnu4artnmf3tytomD  n i;t srxm(m oo1op nlnctas)srrrxr ;u1tpeomoetadfm2rl( s;t4altrxfcoadlmteai o t setmir io1alte nvsas) rtm(ronu1oetnmfeils a2rmnms u0teerxo oatlat lnei;s)teuo(r io1al nlicslt  2rrxm no4tlenmi3ilsfs2emnvo u) etoxocoy1omD  ivi s srxo(rpoo1lm nlictat a2ur(m ot4apeomoetydlm2elu p ()trxnxo oatlm r n o;s  2to(o3io4opeemfes t) 2uau  ;o4openiieiydla ra(vonu4 rerxr to1lpDeli i;( trxr(m io4op  mneslt)s2rau oot4tptomf3tld s ul( o ()trermo to1fmDrlnvi;s0trurxrpoo1lme lnes () 2rmxmp;o0olx moctldfsDel(mpn(4tlxnmf tytlptelnvs;(0t2umirpnydole lnvslt arrr(rono4tpe  ietldlmDul( snu0 rtoir totlate i i;s srxmim3oo1apeemfesa(f Dua( ono1tltn fciyslmDum( pn(4 lxrio totfp   n s;(  rurxopnu4ap   fvias aDraxmpnt4aeen fciat s rln s u4trenmfctotlmtelivi;t0seumxm3iu1oltn feilsfaDrmumo;u0aexn ociltfs2uan s;t0 reoxr3tydfpDrliei () rumimpiudlm n fcsls)sDrrum ;t4aleo ociydfa2elnvp t)alxnmf3iadfmt luvi s t2xmirpiu1ap  mnctls s2uru p;o1texnmi3iltlsDeln p;u0teeoxf3to1fpDr ivo () eumir oydlpteliet t) rra(rpnu1apeo f3iys m2um(vo u4trtomo3iytfa  aiei s) 2um(opou4openmics sfa2tmxm no4tpxo ietyt s2umu o;t)aetoifcia1lmDrlnvi s)setm(o3iy4op   nctas)srur(rp;t0tlxomoeiltls2uauvp t0 lxnmr3iodlm e uvslt0 eumio oodope licil(f 2rmxr ;t4aee miciytla el( s;u0 rxrmo3oatlatelieol(0srumimpoydalt  ieslt)srumumpno4apto o3ias s2el(vs;u0aetnif3iy1fateaneo (0srtr(r3oy1lm nmfvs t) 2taxm ;t1aee  ictytfaDemuvp u)tltomr3oodlmtrln o s0trumxm3iodolen ictatf rtr(mo;t4tlxnmoeiytls2em(vs (4artoxf3tadlp e i i t) etoiopnodap elnciltf 2rax oou4olenio3iydfm2emu p (4arenmo iodomteanvsls0srxo(rpoo1optnmncsls arra(m ;t0oltnmieiydlm um( pn(4teenirciatla elivols trtm(o nu4lm  lies t)s2urumo;u0opxnifetasls2uau ont) rtoxo ty1fa raneo;(0 rxmxo3oodol emnvil() 2um(m ;o1tpenifciadfs el(vp;u)trtrxr iydfptraivi (0s2umim3iydop nliviatfa2ta(r oo0ole  feiyslsDemnmo u0arermfcoa1lmt auvi;s) rumir oudom nlfeiatf rra(ront1opxo oeiyt aDea( o;u0tlxrxrciatlpDe ivs t t2tmio3oy1amee nci (fsDtaurpnu0aeeoiieiadfa2eau o;t4tetrio iotomDeluvils0 rxoxo3ou4om  mictl(  Drrx  ;t0alxoifctls m2rmu o;u0tlxrio oatoptraivi (0tetm(opnudaltnlnetl() rrrumonu0aetnmi3ils sDua(mont0aexnxo3io1lpt  u olt0t2uo(r nodalt  fviatfa2ta(monu0altoifctysfaDrmu pn(0teenmo oadfpteau s;()sexrxmpno1lp e ietatf 2urxrono0texnmociyd s2um(mp;(4tleomo oodlm rlivs (0 eurirpoudlm nmivi (fs2raumont4tet moctyslaDeluvo (0aexoif3iadfate i ils trtm(r3no1al e nviasfs2tr(  ;u1tet io3iadlm2rm(vsn(0alenmo3ta1oat li o t0s2umxm3nu4apt lfeil(  rtmumo;t1aee mf3iydlaDum(vs;(4alxnifctytfm rlieilt0t2tmirpoo1am nmfvt t  Duaumoou1tpt  f3iysfs rln pn(0 ltrmo3oodlp e nvs (0s2trio no4ol nmfvsa() 2tr(m ot0opxoiieiys a2umuvo;() exoifctotopD  nvilt  rtr(m3ou1op   ics t)artrx pno1alen ieiat m2emn pn(4tleoir ta1oaDrluvils  rxr(r iy1llee fvt tf rtrumo;u1olenifeiad mDemump t4tltrxr oydlmtr nvi ()srto(o ny4ol emfcil(fsDua(r nu4tpeoiociasla2ulu o;(0 ltnmo oa1fpD lnes s) 2uo(m3iodolt  fvilt)arurumpno1apxniiciasfm2uluvonu4tlenmo iy1fatelu s;s  rtoiopio4ope lnct sf Dtrxroot0aetoiociltlm2elnvs t)altoxo3tydlaDelieo;s0s2tr(o io1lmtelnvtat)sruax  oo0apenmfeias sDumu pnt)altoxo oatfp   nes;s srxoxo3ou4lpe livsas) Dum(mpno1tptomfciasls2eluvo;u)tlxnmoctadfpDrluvs;s0 2xoxr oy4ap nlnvilt)a2trxr nt4aee  oeias a2elumpnt4 renmr iatfm   nvo s0srtr(m3nu4aptnlivtat  rraumont4ale iociaslm ra(mp;u4tltrio iydlp eauvo ()t2xr(r iy1al   neilt)srumum ou1optnmfetydfsDrm( o;t) etrifcoy1fm  luvo s0 rurxo3nu1omte ietls a2tax oot4openmoetyt mDean onu) reoio iatoatraies t) exrxo oudapt mnvt s  2umxmonu4apeoioetyt s umnvpn(0teeoir iydom eaivo s0t2to(mpnydalt lfvi t) Dtr( oot0teenmfeiyd s2ra( p t0aetrio3oydfm eaivo;(0 2umxmpio1om   fvil(f rrrump;u0oeeomf3iyt sDrluvs ()tetrif3iytfm rln o;t) rum(mpiy4llenlfeslt)aDrrump;o0alxnio3tyd s elump (0teeoiocty1om eliei;t)teurimpnudoptnliesl() 2tm(m no0altn iciasls2eln p;t4trtrir to1fat  uvi s)sexoxm3io1lltnmfcsls arurur ot1tetomoeilt sDeaums;t4 exrmr iatoaDr n o (0 eum(mpoo1lle lict tfs2rmurpou0opeo f3iltfm eln pnt0 ltrxr oatlp rlu ol(  2triopoodlpe  nvtat)sDta(mo;t0alxnmictysfa umnvs;u) exomf3to1lpDe uvsls0truoim3iu1lmtnmiesl() Dtmumpou0oexoiocildlm emnmo t4 lerxf3ta1op  aivs;t)seur(r nodap e nci s s2raxmpnt4apxnmictldlm umumo;u4 etoirciodopt auvo ()t2to(r3iu1lpenlicsatf 2raxmono1opxnio3iysfa em(ms;()altrmoctatopDr u il(0sruoimpnodaleemiei tfs2tm(  ;u4tex if3iltfsDumums;u4 exrxocoy1fmDeliei s t2uoxr3nu1om emivt sf Drm(  ;o0opxnii3iyd a rmn o;(0 rtoirctytfaDeai s;s0teuoiopoy4omtemfcia(  2ua( o;o0olxn feilsla2em(ms (4altoxr3oytla elieslt) rtoim3iudlm nmfci (  Dtaumoot1openmi3ilsfm2eauvo u0 ltnxf3oatlpDrlnes;()teto(opiy4am emnvtas) 2ur(mpoo4tetnmf3iltfmDuaumsn(4 exrxf oatoa rln o (  2umir no4aleemiviasfsDrmxmonu0teto i3tytla2um( p;t)alerif todfatraieo (0t2ur(m3oy4alteliciat)srur( oou4tleoif3iyd mDelumpnu4 etnmr ty1opt anvolt0 etrxmpoy4amtemnvtls)sDtmx oot0apx mi3iytfaDrl( s;(4trtrir3iotlptelivi;t)t2xmir iydal nmfes ()arumumo;u4aet  ocilt a ul(vp;t) rerircoadfmD auei t)t2xoxrpnudaptelfvta(  Drauroou1ape if3iysfmDum(vp t0 ltoir3tytfmtr i ols) rxoim3nydlm elfct s artr(  no0tpt iieiadlm2ul( o;t0trtomo3oa1omtraueo (  etm(m ou4apt mivta( sDtmx p;o0apeo ictlsfa ranvo;(0 rxrxf io1oatr ivsl(  2toir3oo1lm emieil()a2rr(mont4aleo i3tldfm2ra(vpnu0 eenxo3oodop elivslt trtr(o ny4alenmnes ( arururp;t4apxnmieiydls rl( o u4 etnio tadlmD anvi s) exmim3oy1optemfvi () Drmur nu4tpxn ieild s2elu p;(0 lerir3oa1fmD au i t0trxr(r3nu1apeemfvils sDtau p;t4olxo ietasfs eau s u0alxrmf3iydfpDrai ilt trum(m oo1lme livtlt)aDuax pot1aeeomiciyd mDrm(vs t)tltrxo oa1fa  lnes;s srurxm iodllenlfeta(faDtrumpot1olxn fetldlm umumo;t4tltnxfctatop eaneol(0 2tmxr iy4lm emfviatfsrrmump;u0olenifeiys a uln p u0 exoxr3iydfpteaivi t seuoxm3oo1om e fcsas  Drr( onu0aet  i3ilslaDrm(vs;(4 exrxr3ta1fat  n ol() 2tr(rpnodlptemietls s2rm(rp;o0aleo icils a2emu p;u)alxomf totom  lieil(0tetmim no1am n ivsl()aDrr(  ou4altoif3iytfaDrluvs (4tlenxf oo1lmtrlnvi;s trtmimpoodlleelnctas)srrmur nt0ape  f3tydfa2ra(mo;(4alxomr3tatlmtr ivslt0 2tm(m3iy1lleemiet (faDum(rpoo1opt  o3iad sDul( pn()teermo totlm e uvilt0t2tr(r oodlp   fci sfsrtrxmoot4oet ii3ias aDranmp;t0 etnxo3oy1lpDe ivs;( srurir3iydap   ictlt  2ra( o;u0openif3tltfmDuauvpn(4arxnio3todom   neolt teuoxmpnudop nlnct (faDtaxrpoo1alx mf3iyd aDemnmp u)tltrmocio1lp e ivi;s srxm(opny1opt mnesas)a2ra( ooo4tet iociytfs2ulumont4aleoif3iytfaD auvolt0texr(m oy1omtnliviasfa2um(m nt0tpxnmoeiydfaDrmn snu0tlxrif3oytlat au o;t seumim3oy1alee net tf 2rrxro;o4aetn ieiydlm2rmu o;u0teeomo ta1fpteln ols  ruoxmpnodop  miet s)srurxmpou1aetnifetlt s umnvs;(0teermf3tadfm eluei;s0 exm(rpny4aptn fcia()srrax  no4teto fetlt aDuluvsn(4trxrxocta1fpDrauvi s0t2xrimpno1optelfet t) 2urxrooo0alt mi3ild m2um(vo;t0teeomfcto1lp  an slt)trtr(m iy1lleelfcsls s2tmuronu1oeeoioeiatla2rm(vp t4 etnmfcootlmD au o;( setm(r3no1amtemnvsa( aDrax p;t4apto ieiasfa2ean s u4arxoir3todomt  ies s)teur(mpnu4apt mfvsasfsDtr(  ot0oetnmociyt m elumsnt0 rxoxrcoytlm elieil( seurirpno1opt mici (  2ua( pnt4tetnmi3iatla eau s u4areomf3tydfa  lneo;s0srumxmpnydop emieil() rtmxrpnt4olto ieiasls ea(vpnt4aetrxr ia1oa   ivols t2xrir no1lp nlfctas  2taur ot1oltnmfciysfs ra( p t) rtnmr3tatlmtr i o;()srtm(opoy4opt  nvia( s2umu p;t4oltn i3iyslm raumsnu4trxrxf3iadlm eaies;s sexoxm3oo4oltn ncias)a2tm(roou4oeenmociytls rln sn(0 ltrirctydlmDe i s s)seumxr nodolt liesltfa2rr(rooo4texo ietatlmDulums;u)tetrxrctotfpteanes ( truoxr nydaptelfcilt  ruaxrpnu1opx mociat mDeau p;t4areoxr ia1lmD  ueol(  2umirpoo1ol nlivs tfaDtaxmo;t1tlt  oeildla elnvo ()alxnir3oy1fatrlneo (  2um(m oy4omtnmnvi s)a2taxrp;t1olt io3ils mDua(msn(4arxomociatomDeli o;t0 etr(rpoo4amee nes s s2rm(  no0teen ieiltfa2eln p;u)altnmr3iatfm ranvo t teumirpno4omeemivsa(fsrur(r no0opt iicias s2elnmsn(4 ltnir oydfptr nesls) 2uoim3iy1ll emnci s  Dtau ono0teto octadfm2rm(mpnu0altrxo oa1fp e n s;s0 rxrxopou1omeemnctl(fsrur(rpno0opt io3ils m um(vo;t4 rxnxf3oa1fpDe nvi;t seuo(mpoo1lm nmfet sfs2urumo;o4teenifctyslm2umuvsnu)arxnxf oa1opDraivs s0 ruoio3no1am nlneta() 2uru o;u1tex  i3ilslm rmnvont4 rtrir3tadfm elnes t0texo(mpno1al e ivilsf Dtmur no0tpt ifeilsla2elnmo t0 etnxo3oatlpD lnvo;(  rtmiopiydomtn nciatfarurx pnt1tleomf3tld m em( o;(0 rtrmrctatomDelnvil( trtr(o oudopen ics () Dumu p;t1tlxoifeiadfsDrm(mp t4 renirciadoaDranvi;s0sexr(o3nudlpee nvtlt  Dtrur ;o1aptn oeiad sDul(mo;(0arxrio3tydfa r ivi;t)seuo(r ny4alt lfvta(  rumxm ;u0opxomfctldlsDumn snt0 rerxrcoa1fa  anesl( trtoxmpoy1am  mivtas)sDrmxmpnt4tlt  ieiytfm um( snu4teeomf3todlmDr ueilt s2xo(r io4altemieslsfaDrr(rono4oltn f3tld sDemuvonu)artoif3ta1lmt lneilt0s2uoxr3oy4lm emnvs tf rtmxmo;u4tptoii3ildfmDumu s;t)aexoxr io1optrlueols0seto(m ou4lm e fei (  Dtrur oo1tpxn i3taslm2ra( s;u0teeoxrcoy1lmtrlivo;s0 2xmxopoy4ame  ivs s artmumonu0aeto oeiydlm emn onu0 eenmr3to1faDelu sl()truriopnu4optn nei s arurxmp;o0tlt mfeias m2um(vp;u)altnxrctodopDe uvs;s)trtoxm3iy1om emictlt)artrxrpno1aeeomieias sDul(vo u0tlerio io1lpDr ueolt t2tm(r iy1apt lncs (fs2taxmpnt0alt  o3iytla ul( snu)tetnmo tydlaDe u ols  euriopnu1opee fvtas  Dtaur oo4texomietydls ra(monu)aetnmf3ootop  li s;(0sexrir nodolenlfet s)srtru o;o1teen i3iadfs elu o ()aleoxr3totoatelivi;t0srxoio3iu1al   ies sfs2trxr ;o4tpx  ociydfm eln o;() exrmociydoa  anvi;s)setrim iodape lneta() 2ta(moou4altomicildfm2umn sn(4altoirciotlmD  i ilt s2to(rpoodalen fesl()aDrr(  nu0olxn oeildfsDul(vo (4 etoxocta1fa   uvils seuo(mpio1lmt  nvsatfaDtr(moou1oeto i3tys sDemumo t0teeoif io1lm  lueo;t)texmimpio1ope livt tfsDumu p;o4altniociytlm2eluvsn(0tltomf3oytfp elivs;t0srumxo no4lle mieils aDraum ot1aetn icias aDelnvpnu)artrxr3iotfp eanvo;( texr(mpiy1ll nmfvta()artaump;u1oeeomfetlsfm uanmpn() rxrxr oy1lmt  ueilt0s2xrio3iydaleemnvtl(fsruau ooo4tpe ioetys s ua(vo;t) ltnmrcoy1oaDrlneo;s  rxoxm oy1apeemicsas  rrmx  no1aexo feiytfsDel(mp (0 lxnxocoa1fp rlies;s0 2toxm3iy4ome miesls  2ur( poo1oltomoctlslm2ul( p ()arermf tadfa raivo s0 rxmxo3iy1lm  lici ( a2rmum no4tltnifeiltlm ulump;u0 renmf3totopDe n i;s  euo(o iu4lltnmies (fartmu onu0alx ifctyd m2rmu pn(4 exrif3ootlatelivsls)trxoio3iy1ol nlieiat)s2uaxrpno1aex mi3iatls ulu on(4aexrif iadfmDrlivo ()sexo(opno4al  liei (fsrrau  ;o4alenmo3iaslsDulnmsnt4 etnxr oy1fpDeai o s  2xrxr3oudomtnlnvia()aruaxrp;t0alx mf3ilt s emuvs (0trenxfcoytfmDeaieslt trtm(o oydamt livsl( arua(mp;u1tpeo ociytla eauvo;t0texrio iydla eli o;s teurxmpoydaptelivi s sDrau pot0aeto i3iys a2rln s;t4 rxrir iy1fa r uei t0 eumxo3oodlltnlfvtas sruaxr oo1apt mf3ildlm ul(mo;u4 rtoifcoytlp   ivs;s truo(m3nu1olte fciat  Durum oo1tex  o3tydlaDrmumpnu4tetrxr oydomteanei;t0srtrio3iy1alt  nci s)aruaum ;t0oetnio3tas mDuau p;(0 rtoif3oatom rluei (0 2xrxm io1lmtn iei sfsrua(rp;u1tex  fetad mDuln s t4trxrxfcoodla eluvi;( sexmim3oy4op  lnesl()sDtr(ro;t0apxo iciytla eanmpnt4aeerio3to1lmt  i i t) exm(o io1ll   feils  Duaxmoot1oltomoctyd m elu o t) ltomrcio1opDraivi;t0 2tmxmpnudom n ncil(faDrau ooo0openif3tldla ul( s u) leoxo3to1fm  au o t) 2urim3ou1olee nciltf Duau  ;o4optnmoetytlsDem( o t)alxrmfcoodfmDraieilt) 2xriopnu4lmtelnvtlsfartmxm ;o1tpeo oeilslmDum(vp;t4 exnif iodfmDr ies;t t2trim3ou4lptn netltfs2rmumo;t4alxniicilsfs2rauvp;u4 ltrmr3iytoat ln il(0 rto(r3iy1alt lnei t) rtax ont4aeto f3iytlaDrln snu)tetnio oatfaDraiesls0 etrirpnodam  lfesltf rtmxrpot0olto ieiyslmDul(mpn() lxoirciatlm   ivils  2umimpio4lpeelnviasfs2tm(mont4optniietasfm ean o;u)alxoif oy1fpDe uvo s srtm(o iy4apee fes s)s2uaxmono4alenmf3ias aDrm(mpnu4 lxoifcoydfate u i;t setrxm3oydapeemnvilt)s2ta(  ;u4opxnmiciadla em(mp (0 etoir oydopteauvsls t2uoirpno1olt  ictatfsDrm(  ou0oex  i3ilt m2rmnvp t0tltomrcoo1fm   n i s0setmxm oudlmte fetl() rrru pou1opeo iciydfa2umu pnt) rtnio3ty1opt au ols t2uriopnu1altnmivsat artrumpno1oleoioetadfs2ra(mont0 exoircootop  li i t  rxo(mpiodaltnlfvia( aDuau ont1tpeomieild aDrmn pn(4 eenxfciadfm e nvsl(  etr(o iy1al nlivsatfsDurxro;t1ape mfciys s rmnvo (0trtnxo tatlp ranvsl()t2um(rpny1omtelfes tfsDumxrpot0apenmfctls m rmnmsnt0alenmr iatlp   n il( seurxmpoy4ol elivta(faDtau pnu4oee ifctatfm2ulnmo;t4trxrxr3ty1fpt aivi;s0s2toio3nu4om n fvslt)a2umxroot1tlx ii3iydls eln ont0trxoxo3oadomD  ueol()s2uoxopiy1alen fes t) 2urxmo;u4olxniicilt mDuau on(4tetrir3ty1om rlneilt0 exo(m no1ol nmivilt a2ur(m ;o4tpt  f3iltfm2emuvo;t) etrio3oy1la eanvi (  rurxr oodlpee fctlsfa2rr(roou4aet mieilt a rln s () eenirctodfp rlivi s)trurxo3nodal nlfvi t)arurxr ;u0apx mi3iatlm em(vs;(4texrmf oodoatr ivi;(0 2trxmpiy1ope mfctas s2urxr ;t1tpt ifeildfm2uaumo ()alerxrciy1fatelneo;s0trtmxrpiu1om elnesa() rraurpno1oetoio3iytfaDemumsn() exrmr ia1lm raivs;t  2xoxrpno1openlfvt ( sDrm(m nt0tlenmicils s2ranmpn(4 leoio iydfa  lueslt)t2xr(opoudom nlneiltfarrrurpnt4opx mieiatfa2rl(vp u0 lxnmrctatlat au s t0 rxoxr iy1lmeelfesl()sDra( o;o4tlxnmictlsfaDem(vsnt0 rtnxoctodoa  au s;s t2xoxo oy4ap nmieil()sDtmxrpnt0tet mietyt m2ulnvo;(0trxoxocto1oa elivi;t) exoir3iodlltemieils sDtm(roou4aeeomfctad s2ua(vp (0 lerxr ta1fp r u olt0 exrirpiudamt mnes t s2rrurp;t4tpe  fciyd a rmn s;t0aexoxociodopD  u i;s trumir3oo1lm emivsa( arurur ;u1tpeo i3iasla2ul(mo;(0 ltrmf3ia1fmte ivs s s2xm(m iy4olen ivs tf ruaumonu0openmfetltlmDra(mp u) exrmocoatomD luesl(0tetmxo iy1ll nlfcsl(fsrrru o;o0aexn octldfa2ranmsnt4aexnmr3oy1fa eliei s) etmxrpoydolee ncs (fartaum ;u1tltoio3iadla eluvon()aeeoif3oadop r nvs ( srxoim3ou1apee fvslt  Drmump;t1tpe iiciat sDemn s;t0tetnmr iytfmDeanvils  2xo(r oodop n fvsat sDrr(mp;t0tpxomoetat m umu p (4tltrmrciotfaDeaivo s0t2urir oy4aleelivtls s2ua(m ;o0tpxnifciyslaDrm(msn(0 etnmo3oytfateln i (0 2toir3iy1ol nmnetas)s2taum ;o0opxo fetytlm2ua(vo;()tleoio iotfaDeaneilt  2urxm3nu1lmtn ieils)a2tm( p;o4ape  ietyd a um(mo;t)altomrcoo1lpt ln i s0 rxrxm iy4lme lnvt sfsrumum ou1ape  ieiydfs ulu s;t)texoirciadlateauei;t t2um(o3iudopt  fet s aDtmxm ;t4olxn f3iyslmDeauvpnt4 rermfciadop raies;t sexmxr ou4alte fet s) Drrxm nt4alxoiocias mDulu p;u4trxomr3iatoaDeaivol(0t2tm(r oy1ope licsas srtmx p;o4opeomicildlaDrl(mo (0 exomo tydop r n i s texmxm oo4op nlncsls) Drr( oou1apxoiieiytlsDem(vo;t4 lerio tadoa rlnvi;( trxoir oo4ope lieta( aDuaur no0alt iociat m emu onu0tetoir3tatopt luei;t seuo(opoy1ale mfcilt a2uax oot0aee if3ilsla2um( s ()trermo3oy1oaDrlieo;s)teuoxo3oodoltnmici s artru pou0teenmieiltfs2emumpnt0 lerif3tydlpDeauvo t)s2uriopno1lpt mictlt)srrmur ;o0aptomociysla2uaump;u)tetrif oa1lmDrlneo s) 2xmio3oudlme lieias arurum ot4aee mi3ildfa rl(vp ()trxrxf3ty1laDr u o;t trtr(o oo4altelncil(farrm(mpoo4aptoiociyd m2eanvpn() rxnxf iotfpteln o s texm(m3ou1lp  lfesls  2uaumoot0alxoio3ils m umuvpnu4tetoxr3oatfm ean s t)srxrir3iu4apt mfeilt  Drau oou4opto fctls a rmumsnu0 exoif3oatoa eau s t) rtrxo io1ap   fvilt)a2ua( pno0tle mfciadfs2um( snu0trxniocoytlmtr n s t  rxr(r3ny1lmtemnet (f 2uaxr no0tltnmoeilt mDelnmo;t4 renxrctydfmtrai olt0trtr(m3oodole mivi t s2rrum ;o0apeomi3iys sDuanmp (4trenmr3todlaD  u i;t)trurxr3nudlm  lictas)s2urxr ;t4alxomoetytfm2eln o;(0 reomr oy1fp eau olt  rxrxr3io1lpee ictat)sDuaxrp;t1tpe miciat m umuvp;()teeomr3ty1omteauvo;()trurir iy1lp  lfvi s  2tru pou0aeeomoctydla2umn o (4aetnif3tydfat lies;t s2uoir oudaleemfci s  rrmurpnt4optoioeiad m2umuvs;u0 rxoxrcoa1omtrln s s0sexmxo nodop elnvsl() rua( p;t0alxn f3iad m2rln snu4aetnxf3iatlpteanvolt  2um(o3no4ape livsls sDumu p;t1opeo oeilsla2rm( s (4 ltnmf3oo1fmDelivs t)t2ur(opoodale  fvt (f Drrx o;u4aex if3tlslaDemnvpn()tlxnir tatfmDelnvs;()t2xo(r ny1llt  iet t)sDtmuro;o4oltoiietldlsDrln on(4 eenir3oy1lp  livi;s) etm(m3nu1alt mivt t)s2tmxr ;o4tltoioeias m rm( sn(0 etnxo io1faDr n i;t)t2xo(o io4lp elfctl(fsrraxm ou4optn octlt s2rauvs;t)tlerif tytfa rai ol( teumxr nu1lmtn ietl(fs2umxrpnu1tlx  o3tls mDemu pnt4aeeoxr oy1oaDeaivslt  2xrimpno4olt mnci sfsDurumo;o0tet ifeiyd s2eanvo t4 lerio3ty1op e nvo;(  rurxopiu4lp  lncslt) rrr(ro;u0oexnmf3tasfm ea(monu0aetnmr3iadfaD luvs ()tetoio3oo1omt licsl()aDta(mono4aex mietas aDelnmo t4aexrxrcoadlateliesls  2uoxopoo1altemictasfa2uaum oo0oexnmi3tytfm2ulnmp (0alxoio iatfm eluei;s)truoim3iy1aleemics t srtmx  nu1olxomfciydfm2ranvp;t4teenir3todlp  aivs;s sruriopiydape  net t sDumurpot1tpx  feildla2em(vs;()alermociadlpD aieolt0 rxo(mpoo4lm  mfvi (fsDum(mooo4aet mfciytfaDrmuvs t) exnio3oatla  an i () exrio nudlpte ictat)srraxmoou4alx iietas mDel(ms;() exoxo3oy1lateluvo;()s2tmxo3oydol nmfctas)arrm( p;t1apxn fctlsfs ulnvs (4 exomfciotom e nvi;s)t2tr(o3nodlm nmivi t)aDuaxmo;u1apen ieiytls2elnmo u4aleomf3tadomDean o;s0tetrxm iudaptnmivt t a2tmu poo1texo ociltla2eau sn(4tltnxfcia1latrluvi;() 2xr(m ou4oltemfesat)s2rrur ou0apeoif3tadla2uauvs;t)teeoxrcoa1faD livs;()t2tr(o3iodame mivsltfaDtaumpno0tltnmoetatfsDra( p;(4alxrxo to1lpDeanvi;t  rtoir ny4alt mnetat)a2tmx pot1tltoii3iltlm umn p ()aeerio3oa1omDeauvols0srtoxopou4aptemfvta()a2tmxm nt0apxoifeiltls2umn o t0tetrmrciadfptr uvs;(0s2tr(o3nodope mnct s)srtaxmo;o0aleo fctat a2ra( p;u0teenmo iatlaD aneo;s  2toxr3oy1lp elnvs s sDtmur nt0tpxniiciadlm uluvsnt4treoio3oadoaDeanvslt s2xoir nudolenlivsasf rrrxro;u0olx mfciatfa rmuvp t4tltoxrciy1fmt auvilt0teurxo3oo1llt  ivil()srtaxrpnt0altomociltfmDuaums () exrifcoytlmteau il(0tetoirpny4apenmneta( artrumpnu4tpe io3tatfm2ul(mo (0 lermrcoatlm rlivs ( srtr(m ou1lme mfvtlt) Dum( pou0apenioeild a emuvs;u) rtnxocia1lmDrlues s0s2umxm nudamtnmivsat)s2urur ;t4alx ii3ildfm2ranmpnu4 ltrmf3oadlmtranvi t sruoimpoudll  miet ( a2urx ono0tetoii3ildlm ua(vpnu0 reoxociydfa   nvs;() ruoir nudlpee ncs ( s2tmu ont0oex  ieilslmDrmn pn()areoir oodla   ueo t  exo(mpiy1amtnmfviat  Durxmpoo4tpxomieiltfa2rlumsn() rxnio oydoaDr n ol(0s2to(mpoo4optn ivtatfsDum(r nt1apxn oeiasfaDemu sn()artomo3tydfat  n i t0setm(r oudapt mivils)sDur(mpou0oleo oeilt aDrluvp;t4 lxoxocta1lptr uvo t) 2um(r3oo1lle mfvsl(fa2rrumpnt4alx mfeiasls2emnvonu0alenxr3io1fpDeanvo s)srxrim3oydape lncs (f rrrurpno0alxn iciltfa emu p;u) exnif3oytlaD ln s t  2uo(mpoy1llt mnvia(  Drax  ;u0aet  oetatlaDraumo t0arxrmocty1oa  lneo;()seuo(r3oo4ap emfct tfaDuaxrpoo4olenmiciat s ea(vo;u4aeeomoctotfm rai o t)s2uoxmpiodope mfvias)arrmxrpnu0texomf3ildla rluvs;(0aexnmf oy1opD  ivilt t2tmxo no1ll elict tfa2trumo;u1apx ifeiytfs2uanvs (0aeermo3iatfa rauvi;s0 2uriopiydalenlnvs s)arumumpno4tptomo3tat m em(ms t4tetomr oadom rlivslt0tetmxopny4am nliesa(fsDuaur ;t0tptoio3ilsfs2umuvpnu0trtnmr3iy1laDraiesl()trxr(o oy1amt mnvt (  2rm(m ;o0alt  ietlsls2umumo;t4aetniocootopDrlnvs;t) rxrir no4ll nmfcs s) 2um( oou0oetoioetysfmDrl( s;u4 lenir oatoaDraieol()trxo(r ou4op  mfvsat)artaxr ;t4apx  iciatfaDem(vo t4texrio3iatoaDelivslt) rxrxopoudlp e nviat)srtmx p;t4ale  i3tld m ua( s;t)texrxo io1fmDe i i ()tetr(m iu4lp n nctls  rraxrpno1tlxo fctatfaDua( ont4 exnmf oo1lmteai slt s2trxm3oydlp  livtltfs2umxrp;o1tlt  iciadfs2um(vs;u0tlenir3ootlmD  u i;t teumimpno1oltnmicsl(  rurumpnu4teeoii3tys aDuanvo;u0 exnmf3iodoateauvs;(  rxr(mpny4lltemncsl( sruru ono1openmietytfaDrlumo;(0trenxr3io1fmtraieslt0s2xrxm3nydoptelivi ( artrurpou4ale  icils aDranms t4 ltnif3ia1omteanvols0t2xoiopiydlm nmfeil(f rurumo;t4tet  feiytls2um(mp ()trxrifcoa1omte u o;t0 rtrim iy1opt  fctatfartmxr ;o4alx moetltlm eluvsn()tltoio oy1laDeau slt0setmxo io1ap  mfcs (fsDur(r no4tee  fetat aDrlump t)alxrxf3tydomtraueo ( seurim oo1lme  ict (  rur(mpnt1opeo icilt aDulnmont0tleoxr io1lmt  i ol()setrir oydom elivt sfarrmuroot4optoiiciltls2rlumo u) leoxfctadlpt luvils0trtm(o nu1amee fcs s)srraur ;u4apx mi3iyt s emnvp;(4aetnxr3iodlpD auvils)trur(m iu4am emivsls  rur(mpot1aee  i3iat m um(mo;t4trxrxr ootfm rai i;t t2xo(m3oudolte fcsat)arrrumpnu0oexniiciysfaDem( on(0aexrxociatlm raieol( t2xmxr3iy4omtn icta()srua(moou0apeomf3iat s2rl(vpnu) eeoio oodoptrlies ()srxoir nu4optn fvs ( aDrau  oo4ale moetydfsDrmnvs t0 rtrmocoo1lpt luvs s0trumxo3nudome miciat a2ua(monu4opxn i3ilsfaDra( pn() exrxo3io1oa rau o;s0 2um(opio4olenmfci t sDumxmp;u0aetn ocild m emn s t0alxnmrcia1fpt auei t sexmim3ou1omtn ivtlt  Dua(rpot1tltoioeiatla2emu o;t4alermrciodfatraneo;(0s2uriopiu4ape mfci s)sruax o;o1aexomi3tatfaDrlnvo u4 etrir oo1opte n i;(0 exmio io4op  mnesat) rrrx  ou0opxnio3tld s uluvon(4aexrmf iydopDe n i ()s2umio3oydoptnlnciatfs2umu onu4apt mo3iad aDelump (4 ltoif iadfatr nvolt0 euo(opiu4ape livil( sDur(  ou0alxomoctltls rluvo u) lxoircoadlatrluvs () exmio nydom nlieta(faDtr(rpnu0olxn feils m ranvpn(0 rxomrciodom elnvs;(0teto(opoodol  livsl()sDtm(mp;o4oexnio3iyd m2umumpn(4tetrxfcoo1oaDe nei s0s2trxopny4aptnlivil(fs2rr( pot1alx ifetldlsDul(vs;u)trxriocto1fmt lnvs (0s2tmir iy4am e fvtltf rtmxro;t1tlxoif3iltfaDrl(von(0 rerxfctytfmtrluvo;(0 exmxm iy4apt  nvtat)aDta(rpoo0tpxnii3iltls2ulnmo;() lermr ty1optraivilt) rtrxmpoydlpt  fct t srumxro;t4olen i3iadls2rlnvsnt0aexnif3iatfaDeanei;s0s2umio ny4ap  licslsfsDrm(m oo4olt moeiasls2ea(vo;u)aetnxo oy1lm eluei s trtm(m3ny4om emfci s arta( o;u0aex ifeiltfsDelums;t0tetoio3tytfa e uvo ()teurim3ou4lpe  fetas)artaumo;o4aptniieild a emu pn(0trxrxoctydfa r n o;t) ruoxm3oo1alt mnetlt) 2tr(monu1olen f3tyd m ra(vp;t4alxnif3ty1fmDrlies t) 2xrimpoydalt mfes tfa2rmum ot0texoii3iasfa ea(ms;u)altnmo3iytfa e u o;s0srtr(m ny4ape  icils  2um(m ;o1ole mf3iad sDrau snt0tltnxo iytla eliei;t0tetoim ny1ole micil( s2ur(m ot4olxnmoctlsla2ranvont)areoif ia1fpD  u sl()s2trir3nudlm eliciasf Dua(m nu4aeeo fcildfaDrln sn(0 ltoxr3iytoatelnei;t0texoiopoydomee nei (fs2raurpnt1teto fctlt a2ranvpnt0teenmoctatlaDelueilt)trxrxr ny4lm   fvilt) 2umxmpot1opeo i3iydls umnvont4tlerif oadoa e n ols0 exmimpnydlmeemiet t sDra(mo;t1oltnifciadfa eln o u)arxnxf oatoa  aivi () 2trxr3iu4lp e iesl( s2urxmoot4aex mi3tysfm2um( on(0 eeoir3oatom  auvils)trumim3oo1om nmnvta() Durxroot1olxnmfeiytlsDrmumo t4 exnxocty1opDelu i;t seuoxmpiy4lp emfciat s2trxm nt0aptnmf3iatls eaumsnu4 exnir3iotlp e iesl() rtr(m nudlm emfvias) 2ta(ro;o0opx iocild aDelums;t)arxnxo3tadlaDrln i (0s2xr(o3iydop eliciat)artmurooo1aleo ocildfm2rl(vs t4teeoir3ty1fm  lnvs (0srxr(o3io4lm  micil(fsrtmx  ;t0aetnifciatfm rm( on()texomr iy1omD  nei (0srtmir3oudlptemics sf Dtmurp;t1ole  feiat mDrauvs t)tlenxr3tadomDrli ols0 etoio3oo4am n fesls)sDtruroou4tleoii3tyt aDuanvonu)aeerif iatfpDrlneo s  2toirpio1lmtnmnvils) Dtaxroou1tex mfciad mDumu p t4aexnxo3iytfptrli sls  rum(r3iodlle mieils)s2raxrono1aptomi3iat mDeluvp ()teeomf3iadlmDran i;t)t2uo(mpou1ll e nesa(  2rmx ont4oex  iciadfs2umump u0aexrxo oydfpDeauvs;s0trtoio3ny4al nmnei (farur( p;t1tlenmoctldlaDul(mp;() lxomf iy1fpt lueol(0t2trirpiudol emivils  rtaur ;t1aptoif3tatlm2ra(mo;u4alerif tytfatrli o ( trtm(o iodlm e fei tf Duaxmonu0oeenmoeildlmDemu s (0 ltnxrcoadomt livi;(0tetmim3ny1om elfvt ()sDraxrp;o4olxnmietlt s2rm(vp ()aeenxrcoodfa elnvsls) ruoxr nudamen fcil()sDur( poo4olxnmf3iyt a rm( s;()tlxoir3tadlpDr neo s  2tmxopiodlltnlfctlt)srua(r ;t4alt  o3tld m ra(mo (0altomo to1fpDrlivs s) eumxr3iy1op nmfvi (  Dtaur ;o1aee mfeiyslsDea( o (0teerxr3ia1opDean o;t)s2um(rpoy1apt  nct sfa2rau  ;o4texo fctad m2ul(vs;u)aeenxfciatfaDe i ols)sexoxo iy4lm  livt s)sDur(m nt1tltniietld a2eln ont) rermociydfmDraueo s  2trxo iy4lp e nci (  2rmu  ou0apeomf3iytlm2um(vo (0 ltomfctodlptraivo t)trxo(m nudlm elfeils)a2ta(ro;t1tpxoifctydla uauvs u4trxnxr oytoptrauei t s2trxo iydlleemieilsfa2rrx o;t4aleoifciasfaDua(msnt4tltoxr tytfateli ils srxrxr3nudom emiciatf 2tr(m oo4oetn fctys aDum( o;u) etrioctotfm e n s (  etmxr ny4ol nlivsl(fa2taurp;t4opt moetldls2ul( p t)alenio3iy1lpD lues;t srxo(o no1optnmici tf Dtmu onu1texomi3tadfa rlumon(4areomf iadfmt livi;(0trtmir3ou4amee fvslt aDtmurono4ale  fciltfs2eanmsnu)aexrioctydlptr nes t0 2urxopny1lp   ncslt  rua(rpno0aptn ocils a ulu o u0alenxfcio1fm e n i;t0s2umxmpiy1lp  lfvsl()s2ta( p;t1tpeoif3ias m2uauvsnt4tetrxr3iatopDr nvs;t) rurirpnu4ole micia(fsDtrxm ot1olx iietyt sDul( pnt)aeeomr oo1opt auvs;t0 exr(rpoydolenmfvtat  2ta(rono4tpt ifciyt m umumo t) etrif3oydfat  nvo (0t2trxr3io4om n fei (fsDrrurpno4altomfetadfaDum( snt)arxnxf3oo1lpDeau s (0trtmxm nu1omt lfei ( aDrrxront0tpxo f3tat aDrluvs u0alxnir3oytlpD lneo t sruoirpoo4op  mncs s) 2rax  ;t0oltomictltfa elnmpnu0 ltrifcoa1lpD  iesl()seuo(m3iu4ame lfesat sDrrxmono4tlen ietldls ea( snt0trtrio oytopD  ies;t0teur(r iu1ap nmivs s  2rrumpno0aet  feiltfm rmumpnt0 lxoio tatoptrlnvslt) exrim3iy1ome lfet (f 2taxr nu1tleomo3iatls emnmp;u)alxnifcootopt an i (  etr(opiy1op  mnctlsfarrm(moou4aee  ieilt a rl(msn()artrir ta1optelnvils0t2uoim ou1apeemfcsltfartaxrooo4aetnmietyt sDran o u0artoxrctadomte neo s)truoxm3ny1ll nlfetatf 2rax  ;o0tpe iociydls2umnmsnt0 reoiocoa1fpDrai ils0 etmxmpiy1lpen nvt (f rtm(rp;t1oeenmociadfa2elnms u)tlenxr3iotlmDrlivi;t tetoirpnudap elfetatfsDtm(mooo0optnio3tydfa rmnvp;(4aeeoif3iadfm   n il(0trtoirpno4lpe mnvsa(f rtr(r ou4olx  feiyslmDuau pnt4 exoircoadla e ieo;s0srxr(opno4lmenlnvt ( s2urxr ;u4opx iiciltls2umn p;t0tltoio3iodfp ean o;s) rxoxr io1omtemfvs s aDuaxmoou0ape  feilt a2umump ()aetrxf3iy1omD aivil( setmim3oudop   iesat) Dtmx  oo1teenmiciys m2ua(vp t)teeoifctydlp e ieol(  eur(m3iy1am nmnvsasf rumu o;u4olxoio3iadfm raums;u)arxrir tadlptraueils0 2umim iy4ome mfvs ( a2um(ront1oet ifcilt m2ea( o;u)artrmr3iytlpte nes t)seuo(m no1op e ncsa(fsrtaump;o1olxo ietatlm rlumon(4teeoxfciatomtrln i t srtm(opnu1lp  mfei t srtm(  nu4ole mieiys a ranvont4arxrmr iydlpDeanes s0t2tr(rpou1ap n nvt ( arumuro;t4altnio3ilsls el(mp;(4 lxnmocootlpte neils0trtmio3iodlptnlicsl( s2ua(m no4oetnif3ildfs eanmpnt0 ltrxr3iy1fp elieils0t2tmxm io4ome mnvta( sDrax p;o0tltomieiadfs elumo;u4texnmf oa1opDrlnvslt0texmxo iodllt livslsf ruau p;o4tpe mi3iadlaDulu pnt4treoxo oodlp elueo;s)seto(o io4aptnlfvils srtax  ;o4apxoifctytlm2umump t4trxomfciy1lpt anvi ()teuoir ou1altemieiatf Dtm(m ;u4tpt  f3tysfs2ua(ms t) rxnxr ty1omtelneo s0sexr(rpiy1lltelnesat artax p;u1texomiciyd s uauvp u0trtomf3iy1lateaueol( sexoxm3nodalt licsa(fs2uaurpou0optoioeiyt m emuvonu4 lxoxo3oo1fpDelnvo;(0 2xoxrpnu4lmeemnvi s artrxrooo1aexo fciadla rlnmpnt)treoxf tydlp ranvs;s0truoimpiy1aleelicsl()aDtr(rpnt0aeenmi3iadls2ulumonu4tlxnxr3tytfmD  n sls0truoirpno1lp e ietasfs2uru poo4tee mfeild a2elu s (4 rxoxr oodop ean o () 2ur(m oo1apeeliesl(faDumx  oo0aexomo3tysfsDul(vo;()aeeomo ty1op  ln i (0t2uo(m3nudlp elnvi ( a2rmumoot0tetoifetytfm2ranmp (4trtomf tatfmDeau ol()srxrim nu4openmfesat)a2ur(m nt0altnii3iydla2rau p t)aetomfctytlm rauvo ( s2umimpio1aptemfcsa() rtaurono1alen fctas aDrln s;(4tltrif3tytoaDrluei s trtoxm iodaptemieslt)sDua(mo;o1teenmfetadla2rl(mo;t0texnircia1lpD luvs s0 eur(mpoy4optn ieia(faDrmxrpou0tltn o3iytfmDrlumsnt4alxoifctadoaD  ivs;()t2to(o3iudlptemfcia()a2tr(m ot0oltnmi3ildlaDelnvs;() lermf3tydfmDr u i;(0teumim3nu1om emneia( s2rmxm ;o0olxomf3iasfm2eanmonu0 lenir iotlm  ai ols) euoxrpny4op n ncsas)a2taur ;o1tee mf3tadla2rmn o t) lxnmrctotop elnvo;t0trxmimpiudlle lfvtlt arrmxmo;
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;t0 etm(o3iy1lltnmnet s artr(m ou1aex mi3tld s emn p u)tltrmr3iydlpDeauvs t) 2xmio3oy1ameelicilt)s2ra(mo;o1oeto o3tadlmDelu sn() leoio3tytom   ueo s) ruo(m iudap nlictl() rur(mo;o4aptomi3iltlaDel(msnt0tlxomf3oatopDraivo;s0 rxoio nu4lpenmfetasfs2ta(r oo0aleniietltfm umuvo u0tlenifcoodfaD lu i t0 exrio3iy4am nlfvtat srraump;u1tet io3tld a rmu on()tlerxo3to1latelnvs ()s2ur(m nydapte icia( sDrrxr nt0alxomi3tytls rmnmo (4trxnxo3iytoat lnesl(0 2xrim3nudamtnmietl( arrrump;u1aetoif3ilsfsDrmnmpnu)altoxf3oatfp eai ils0 rur(o3ny4apte fet (f Dtauro;u0olxnmoeiytlmDum( snt) rxomo3iatfmteai i s  euo(rpnodlpen ict (  Drrx  ot1oexn octytlsDel( onu) exrifcoodlpDeanvo;s0 rtoio3nu1ol   neia(f Dum( poo1tpxo o3iatfmDrluvs u0texoir3io1lmtrlu s s0teumxo3oy1omee ivtat) 2umxr ot1aex mf3iyd mDranvon(4 eenmr3tydfaDrlueo s)s2xrimpou1altemneilt)artmu oot1oetomo3iasfm ulnvpn() rxrircty1fmDe u il()t2uoiopoodapee nesl( s2umum ;t0oltomi3iyd sDem(msnu0 eeoxo3to1oat lieo;t)t2trxopiu4apt mfeia(  Dta(mo;o4opxnmictytfa eln o;u0aexrxociy1fptr n s t  2umxr3io4lme mfcsa(fsrumu  ;u0openmicilt s2rl(mpn(4altrio3oy1oaDr iei t)trxr(r3ou4lm n neil()srumuroou4alxoio3ilslsDumuvs;(4trerif oydlmtrlnes;s0s2urxrpoudop e fctl() 2ra(root1olt  oetasls uauvs;u4aetoio to1fatrlu o ( sruoimpoy4lp  lfeiat aDumu oot4apto iciyd mDelu o;(0aexomr tytfp e ieil( setr(o io4am nlfet s)aDtrx pno1opeoiictlt s el(ms u) exnmf3iatlaDrau il(0 2uo(m3oy4lmeemnvsatfa2rr(moot1open o3ilt a2ul( p u0 eermrctotfpteluvsl(  rxrio3oudlmt lneiat)s2ta(mp;t4tee  oeild m um(vo (4 etoxf3oatlmtelu o;( srumxo nu1om   net tfaDum(  ;o0aee  i3iltlsDrmuvo;t0 lxoxf iadfa elnei s) rtmxrpoodlpee ivil()sDuaxmp;o1oeenmietysls em( pnu)artomf iatfm raivol()srxr(r3iy1ol emies sfs2rrxrp;t4apeo ictydfa2umuvo;u)tlenxo3oatlptelnvi s0 eumim oydlp  mivs sf Drmxmoou0aeeoif3tadfaDrlnms;(4 lenir oadfpD  ues s t2uo(mpou4lpenlicsls aDuaxmonu0alxnmictatfmDel( o;u4trtnxf3iy1lmt lies;t trtoxm3iu1opt miesa( a2raumooo0aeeo o3tatls um(vs;u0tlermr ty1lmDr i s s0 2toim io1lm n fvia()a2tr(mpoo1tlx mf3iydlm emnvs t0 eenxf3oy1lmt lieo s0 rtr(rpiydlpt  ietlt  Duax p;o1aeeo oetlslm2rm( pnu0tetomr3tytfm r iei;s)t2ur(o nydapenmfesltf 2urxr no4tlxnmi3iyd m2emnmpn(4alerio tatlaD lu il( s2umiopno4ol e feslt  Drrumo;o0tlt ii3tyd sDrl(ms;(0 rxrir3oytfm  luvo t0sexrio3ou4amen fcs t) rra(rpnu0apx iietldls2rm(mo;t)tlxoif oatlmD  ivol(0 euoxr3nydapt mnci t)aDuaxr nu0apt mi3tyt s2raumo;(4aeeoxfciadopt lu ols srxoim3iydopte nci t aDumxroou0oexnmi3iat m2umnmsn(4aeeomr io1lp e n s s  ruoxm io4ape  ivtas) rumu onu4olxo oeiaslm2rl( s t4teerif3oydop  ai ilt) rto(o3iu4opte icils  rrr( p;o1alto icild mDel(vsnt4 rtoiocia1la eluei t0tetoiopno4omtn fvs ()a2rm(  ;u0ape mfctydfaDrmnvs t4alxnir3oatfptrln o;s0s2umim3oydlmen fvsas)sDrr( o;t4tpx  o3iltla2ra(ms;(4trtoxo iadlp   u s;s  2tmir3iudol  liei ()arraurp;o1altoifetadls2rm(mp u4 renxr3tadop eau o;t trxoxm iudamtelfesat s2urxrpou0apt  o3ildlmDumu o;u4tlxnio3iatoatr ies;s)seumxr3no4lpeelfcilt)a2taurpnt4openmi3ilslmDel(vpnt4alxoxr3todoptr u s t) rur(r iu4opee nvilt s2rrxrp;t0tle iiciytla2eluvont4altnxf3io1fpte nvs;s t2uoimpiudlmt mfvias) 2raxm nt4oexo icildfa ea(mo u0aexrir3tadopt  ueil()trtrxmpio1ap elnvi t aDrm( pnt0tpeomo3tys sDrmump;(4areoif3totfp  an i;(0setmxo nydlmt lnvs t) rtmu pot1aet mfciadlmDea(vs;u4aexnmfctytlmt  neo;t  2umxr3nodapee nvta() rua(root0tlx  fctytfs2elnvonu)teeomfciatlmDrli ilt0 2umxr3iu4altn ics (  2ur( pno0tlt mieiasls2rl(mo ()treoif todfm rauvilt0t2xo(r3oo1omee nvs sfs2trx o;o4tle  ieiatfs2ulumo t4artoifciatlmteaueo;(  exm(r oy1lptn fcs (f rtm(m ;u4oleoif3iasfs2eanvo t)tlxomfctadoa  luvsls0srumxo3nu1lmt lncsa()sDrm(ro;t0aeeomoctldlsDeluvo u0 lxomo todla eln o t s2xoim io4amenlnctas)artax oou4aetoii3iysfs ra(vp;u)artrio iodomt aivs ( s2umxm io4olenmfvsl(fsrrmx  oo1alenio3tad sDum(vp u) ltnxf3iatlaDrlues;t t2umxr iudlm emnvtlsfarurxro;t4alxn o3tltfm2el(vont4 exriociatfmDe nei;()s2xmxo io1opt  fvs tfaDtm( p;o0tpenii3tad m2rmn p;t0aetnxf oadfmDrli o ( setrir ny1lp nmict sfsDtm(r nu1oleo f3iysfa raump () rtomocoo1lmt  nvsl(0s2urimpoydom elfet (fsrum(mpou0alx  ociyt s2eauvs;t) rtnio tadfm e i s;s s2uriopiy4lmeelictas  rumu p;u1apen ieiltlm ulu o u0arermr3oo1lmte ieo;s sruriopiodal  lfcilsfsrraurpno1teeomieiadfsDrmnmo;(0tlxoir oodla raueo;t  2umir oydole mfviltfa2um( o;u1aptnmfetlslmDrlnvo;t0tlxnmfcoytfa  au s (  2umio oy1lpe  fesls srrr(m ;t0alenmi3iyd m2elnvs;u0alxnmf ty1la eaueol(0 etoxmpou1ol  mfes sf Dtm(rpno4tle ioetlt a umn s u)texrxr3oodlat livi s trxrio nudal elnctltfaruaxroot1apenmieiadfsDea(vo ()teenmf3iotfpt lieo s0texoio no4apt lncs () 2urum ot1tleo ociys s2ra(vo t4trtnmr3tatoat auvs;s)s2xmxrpny4omeemivi (  Dtrxrp;u4tet  fciadls rl(mon() rerxr tydfpDe neslt)sexrio io1al n icsas)a2umumpoo0alxomi3iyslm2umnvo (4 rtnxfcoo1lptr neolt0trxoxr iu4apt liviat sDur(m ot4apxnmfciasfsDrlu pn() rtoxr3iydopDe uvs (  rxrxr3iudamtemiet ( arrau poo1oexo o3iaslm ra(vp (4tetnir iotfmt lnvol( sexoio3oudomenmfvia()s2uau pnu0tpto f3tydla2eaumon(0teeoioctytla   iesls0 2um(r iu1lpe  feia( srrax p;o4ape  ictad a2em(vs;()tetrifcio1lp e i i t seum(o3oudop emnesl(  Drau o;t0alen i3iadlmDem(vpnu4aexrif oo1oa  li sl()t2uo(m3nydopt liesa(f 2ua(  nu0aptnioeilslm2uau pn() rtnif iadfm  lu o (0trtmxo io1omenlietl( sDumx  oo0oet mfeildla2uln pn(0tlermrcoatom r ies (0trtriopoydaltemncsa(f 2umurpnt4olt  o3ilt a umnmpnt4arenxfcoo1omDeluvi (0tetrxrpoo1op nmiei s s2tm(mpnt4oexnmoeias mDrmu onu) renir3iodop raueo s srtrxo3ny4lpeemivsatfarurumo;o4aexniieiyt mDrm( s;t)areoxfcty1fpDranei ()trurim3oudlmt  nciatfartm(mp;t4olx  f3tldlsDraumo;u0 exrir todfm e nvi;(  etoxo3no1lp e fvtat  Dururooo4oeenifeiysfs ulnvsn(0 lenir3iydlmt  nvs;t s2toxrpoodol nmneiasf rtru  ot1optn i3tytlaDem(mon(0aetoxr3iytlatr uvs;(0t2xrio iy4amtnmfei ()sDum(rp;u4aptnmfctldlm2rmu onu4teeoxr oytlpt auvs;()s2xrirpiydape  icsatfs2rr(m no0oee ifetydfm2emu s;u0altnxo oo1fate uvo;(0seuoio io1olte ncilt)sruaxm ;u4oetomictldfm2eluvpn() rtrmr3iotlm eln s (0 rtoxo3iy4apee fcs ( srtmxm oo0tpx moeiadfmDeluvp t0 rxoirciytlp rlieil() ruoxo3ou1aptn nvs t srtmu  nu0ale  iciasfs2um(vo;t)artnifctadlm  anvi;( t2uoim3nudam nmfeiltfsrtm(root0aex  ieils sDrl(mp u4altnio oodlmDeaivolt  rtm(o3nydlltelicia( a2ua( pot1tlxoiieildfaDemums;t0tlenxo3oodopD livi;()teumxm nu1ll nmneta()arrmumpoo4oex mietyslm2eluvo;(0teeoif3tydfpDeanei t0 2xm(m3iodamenmfcsls)srua(m ;t0oexn ieiyslsDuanmsn()aetnxocty1lpD anei t  rto(m3oy4lptnlnctatf 2umx  ou4alxnmf3ilt a2rmumpnu)arxomfcty1lm  lnvi (0 rxm(m3ou4apt lnet sfarrrum ;o1tltniociysla em(mo u0aexrio3oadlpDrlu o s s2tr(opnydlmt lictls  2um(r ;o4olxnioctydfsDelnmp;u4 rtoxfctatfp elnvs;t srtoirpoudlltn neia( srtaurp;o4altnif3tytla rl(mp u4trtomoctadfptrlivs;( s2trio3nudllenmfcilsf Durxrp;u0alxniictydfs2ran on(0 lxnxo oytlp  lnes;s)sexmir3no1om   ncs (  Dra( pot0teenii3iytfa2rl(vs;()aexoxf ta1faD auvo s0teto(m3oudop e fesls a2tm(m oo0tpe iicils m ul( pn(4aleomociotfaDrauvs;s)trxoxmpou1am emietl( sruaxmpno1oee  f3tas m2rau sn(0teenmr3todfm rlivo s)t2uoir3oo4ome mfesa( srrr(m ;t1alxnmiciyt mDelumo t4 ltoxf ty1faDrai sls)trum(m3oo4lmte feta(fa2ra( pot4alt  o3iydfa rauvs;(0arxnmf3oytoaDeauvs;( srurxo iu1al  lnvil()s2tru ooo1teeoiieiysfa2ra(mp;t0 rtrmocio1fm rlnvsls0teurxo3ou4lme  fvtas a2trxronu4opeomo3iad a rlnmonu4 eenioctotla   ues;( t2toxopnu1lptnlfcias sDra(ront4oexomoetldfa2rln p (0 rxomo iatla  ln ilt0t2toim3io4alen fet sfa2rrxm ;t4tleoio3ildfa ua( s (0trxnxrciytlm r nvi s)trtm(r ou4alte ncs s arumx ono0tpx ioeilt mDranvo t) etrif3oo1la rli i ()s2xrxr3iudap e ivilt) Drru oot1aexniietas s uauvs (4alerxociadop e i o;s)tetrio iy4lltnlfet (fsrtau o;o1apt  i3ildlaDul( s t0trxrmrcty1fat aueol(0seumxm3oydopenlnctl(fa2rru ono1opeo ietadls el(vp u) rxnmo3oy1faD  i slt0 ruoimpiu1alenmfcias aruaxr nt1openmoctatlm emnvsnu4 etoir tytopteau ilt)t2trxo oo4ope  ivtls) rrru  ;o1tlt ifeiadfaDumnvpn(0artnmr3ty1lptr uvi;(0texoxm3nu1omtn netlsf 2raurpoo1aex  i3tldfs2eln o u) lxrmf iytlmt auvol()truoir3ny4ope liei s)aDtmum ou4oeenio3iytfs2el(mp;u4arxrmf3oytfp raivslt0t2trirpio1oleemfviat)aDuaumo;o0texoii3iad m eauvo;(4aexnxociadlat  nvs;(0 2xoxopny1llee fvta( srua(ro;o1tlxomo3ild m um( o t)trxoir oadlpDrlnes;( texmio3ny1alenmncslt aDrruro;o4alenmoeiltls2rau o ()altomfctotfmDrau i;s  rto(r3oydlleelfvtltf Dtr(ro;o0apt mietyt aDraump;t)trtrxr iotla  aivo () eto(opoudoptnmnct tfs2rrxr oo0tpxo oeilsfmDrlu o (4 reoxociy1om eli olt) 2tmirpnu4om nmics t artr(  ;u0alx if3tat a2rl(mpnt)arenxf3totfmtr ivsls  eur(opou1olt mnesl( a2ta( p;o4olenmi3iatfmDrlu o;u0tlxrifciadoatrluvo t)srxm(mpiy4lltn icta()s2urxmo;u1oetomo3tlsla umumont)aetrxr tatfm e i s ()srumio no4ole miesat)a2rmu p;t0aleoioetas sDea(mp (0treoio oytoateaues;t)setoxm no1lltelicilsf rumxmoou0alxniictldfs2umump u0trenxfctadomtelivs;s0sexoxm nu1amtnmicsatf 2rmxmpnu1opxo o3tytlaDuau s (0tetrio iotoa r ueils seurxr ou4op  mfeslsfsDraur no0apenmoeiltfa2rlnvo;t) rtnir3iodfaD ai sls)s2xr(m3nudlmee nesls aDrr(mp;o4tpt mfeiyslmDum(mont)arxnxociodlaD aivo;(0tetr(m ny4am nmies t  rumxrp;t0teto oeiytlmDumumsnt)alerir tytlaD lu i;() 2tm(rpny4apee ics (f Dtr( pou0texn ociytlmDelnvpn(0 eenio3oodlmt lu s;t0 ruoxr io4lp  lfviat  2uaumo;t4tee  f3iyd aDrm( pnt4tlxomoctodoaD aneo;s)srumiopiy1omenlivsa(farra(rpoo0altoioetadfs2elu p;u4aeenif io1fp e neolt0srxriopnydap e fcs sf 2um(moou4openmoctlslsDeanmon(0 ltoxo iatfa eluvo;t0s2xr(r3ou1amt  ieil( s2tm(rpno1tee mi3iydlsDra(vo;t0aeermfcoa1fmtr uvi s)trto(o3iydlp elieil(  Dur( p;t0apxn ieiatlm ea( pnt4trxnxrctydoptr nvo;s) eurxr iy4lmt  ivsat)aDtr(rpou0tleo fetasfa ul(mo t0 rtnxf ta1fmDe n il( s2tm(r3oo4opeemieias)s2tau pnu4tlt  f3tasls2rmn on() leoif3iy1oaD aueo;s)srurim3oudlm emfvslt  Drrur nt4tet mi3iyd aDrmumo u0alxrxo oatop   uvo;s0s2xmxr nodlltnmfvil() 2tmx o;u0tptnii3tatfaDrl( s u0 eeomf3oo1lpDrauvi s teumxo3oydomt mfvtl(faDumx ono0tltniietasls ra(ms;u)tltrmr3ta1fmt anvsl(  rxmim3nu1am   fcilsfsrtr(rp;u0opt ii3tyt a2emump;t)trtrxo ia1lmDe ieils  2xrim io1lptn nvil(farraxm ;o4aet iieiysfm2ea( p t0altnxr tadfaDrauvs;t0tetrir3ny4lpenmfvsl()aruax pou4teeo i3iasfa2elnmsnu0teerir3iydlmDr neo;s0trtm(m3oudol nlncs t  2taumoou1aeeo ictat aDua(vsn(4trtrmr3todop  li sls0teur(o iu4ale lnesas)a2tm( o;t0tet moeilsfm el( ont0artnxrcto1oaDr nesls  exoim3oudole lnvsasf rraum ;u0olenmo3tadla elums;(0tlxnif3iytlaDe n s s0 rxm(m nydllee ieils)srra(mpnt0alx mfciydfs umnvo;(4texniocia1lpte i slt)truoio3no4alte nctasfaDumx pnu4oltn o3iltfsDrmuvsn(4texnio oatfa elneolt0t2trio ny1aleemfcils) rrmurpoo4tpxnioeiys s ulu onu0trxnxo tytoptrai slt0teuo(m3oo4lltelnvt t aDtaumo;u0oexnmicild a rmnmsn(0 lermf3iydop raiei;() eurirpoy1alt livs tf 2taumoou4olenmiciatlsDrm(mp;(4 rxrxo3iatom  lneols0 rtmxm3ny1lpeelnviasfsrta(m ot4tet ioeiyslm2um(vs u4 leoxo3iydfaDe ues;(  2ur(r3nu1om elfvsas)arta( ooo1oee ifetas m2em(vp;u0tltoiocoa1fm  ln s;(  2toirpiudlm   ieil()sDtmx pot4oexniieiatlm ulu o;(0 eerxr iadoaD  neo;t)seumirpiodomee fvsas)s2taxr no4alxnif3tyd sDemuvonu0 renir3tadomDean s;s0setm(o io1lme mnes s s2ua(r oo0olenmoeiat sDrmu snt4tlenxo3tadfpDe ueil(0 exrim ou4ameelieil( arumu  no1aleo i3tasfmDem(vsn(0trenio3iatlmtrlu i;(0t2ur(rpno4lmeemfesat  Dtaxm ;u1tex  ocild s2ul( o;u4tlenir3to1fa eln s (0s2ur(m ny1aptnmict t) Drr(ront0tpx ifciyt m2rmu p;() etnxr3tadlmtr ies t srxoirpnydapte fesls a2umx p;u0oeeniociydfsDelnms (0 eerxo3ty1lmteanei;t t2um(rpiy1am   icsas  Drrur no0apt ifctadlmDemnms u0tltnmrctytla ranvil(0 exm(r3oudapt  nvtlt a2rmumpoo0aex mo3tytfsDel(mp () etomo tydla r nes;(0srumirpou4om n nvilsfaDumxrooo4tet  i3iat a rmuvs () rxnmrcoo1lpDeau i t0setoxm ny4ap e ictl(f 2tmxmooo4texn ocildfaDem(vsnt)aeenifctatfa r i o s0trxoxm oy1ole lietatfsDrau pnt1opxomfctysfm emnmont4teeomr oatlaDranei;s setm(m oydaleelnvia( a2uax pno0oleoiieiad s2rm(vsn(0arenir3io1lmtrliei;s)texoxr iudoptelneslsfsrumum ;o1tpe  i3tlslm elnmpnu4tltrxo iatomDeau slt0teuo(mpiu4omtelncils)aDrmurpno4aexomoctat a uan s t4altrmr3oatfp  livs ()seto(o iodam elivs (f 2tau  ;u1texoioctytla2ua(ms u) exnif ty1faD  nvo ( sruoxrpio4lle miesl(f rrm(mpoo0tetoifetas a2ul( onu4alerxociadfpt  i s s)srxr(m oy1al n nctlt s2tr(ronu4tltnifeiyd mDrau ont0tlermr to1fpD ln s t0srxm(o no1lmeelnesl(f rtr(mp;u0apenmo3iyd aDeln s;u4aetoxr totlpte uvi;(0 2xm(o3iu1lm e icil(fa2urx p;o4tleo ociyd a rlnvo;u4 reomfciydomD  nes;s teto(rpiu1lp  mies (fsDurx poo1oexn ieils a emn pn() lxrmfctotfa  liei;s0srtrir3nu1lpenlfetl(faDtr(  ;o1tleo o3tltfa2rlnms ()alxnif3iadoa elnvs s trto(opno4ll nlnvi ( a2rrxmo;t1oltnmieildls ean sn(4tlxoxfcoytlmteanei (0 exmio3nodomt lieia( s2ua(m ;u0oexomi3iasfm uauvsn(4trxnxo io1opD  uei t  euoimpiodoltn feilsfsDraxmoot1opx  i3iys s rlumo;(0arxnxr iadlatrau slt  2to(o ou4optnlnvtat)aDrmumo;o1aee  ocias sDrmnvp;t0aexoir3ta1om elu ols0t2umiopiydom  lfvsls  2rr(mpot4optoiociltfa2eaumo t) lxnmr3oatoaDelivo s texrimpnu1lm e fcslsfs2ta(ront4apeoii3ilsla rau onu4arermrcoadla e n i;s  2xrxo no1amee fci (  rrruro;t4oltn f3tydlm2ulnmo (4tetomrcootlm rlneolt tetm(mpoydaptnmnvilt)s2tmuroou1opeomietas a2ua(mp u)arxrif totlm  lnvo ()sexmxmpou1op  lfcia(fsDrau  ;o0teeoifeils a eau o t0 rtnir oatop rlueol(  rtmimpoy4llenlnvias  Drax  ot4alt  feiad m2ranvsnt)areoiocia1lm  lneo;s) euo(r3io4op n ncia(fartaum nu0tpxnmicilt sDum(vo;(0altrxo ootomt  ivo;t)srxmim io4olee ncsa( sDtr(  ;t0apt mociatlaDumnmonu)artnxocootlaD  ivs (0t2umxmpnydop e fvtat)a2um( o;u0oexn feiytfm rm( o u)altnioctotlpDelnvs t)seuoio3nu4lp   nvi ( sDrru  no4tlen feiadfm2uauvo;t)aeerir oa1laDran sl()srto(r3iydamte ncslt a2trur ;o0ope ioeiatlmDea(msnt0alxnirctytfpDelivo;t)texrxo iu4ol emivsl( s2rrxr ;t4opx iiciadlm ea(vo t4 rtomo3ty1opDe ues s  2xoio3oo4lpe mnvi (fa2trurpno0opt miciadls ua(mpnu4 rtoio iydfa rau o;t)trurxm iy1ll nmics () 2raumonu4tpe moeildla um( p;u) rxrmr3ty1fptr u sl(0trtmir oudlm nmfctas) 2ur( pno1optoiieiytlm2rlu s;t0aleniocoydfa rlu ol( tetrxo3io4oltnlfvia(fsrrmur ou0alx  ieiyslsDean o;t) rtnxf3oatlmDeanes;t  etm(m iudoptelnvsat)a2ua(r ;t4aet  o3tltfmDraumpn(4teeomrctydfa  ai olt)srxrio nudamen feia( s2ua(r ;u0tltnmfciatls2emu sn(0 lerxo io1opteln i (  rtrxr3iydlm  mictlsfsrrr(roou1tlt  oeiyd s2ranvsnt0trxoio iatlaD lieol()teto(rpnydamt lnctlsfa2umxmo;o4tpt mictldfs2ea(vo u0texnifcio1fmteai il() exrxr nodolenmiei s s2raxmpno4apenioetad a2eanvo;u)tetrxocoa1omD  u ilt setrxo3nudap  mnvi (  rrm(  no0oexnifeias m2ea(ms (0texnmociydoaDe ueil() ruoir3iydap nlfcia() Dtrx pno1aptnmi3tytfm ul(mp t) lxoxf io1fmD lies;() euoimpiydol elfcs (f Dtaxrpou1aleo oetatlm ean pn(4aeenmfciydfpDr uei;s0 2toxr3oodaltn fesl(farrrumpno0aex if3iltfs2em(vsn(4aetoif3iy1oa  aivil(0srtoimpio1ol emicsa()a2tmumo;t4olto f3ilt sDrl( on()tetrmrcoy1fatelues t) etm(r ny4altn ivsltfaDrmu ont4tlxo fetydlsDraump t4 rxrmo tatlatrluvols  2urim3no4omenmivias arururpnu4alxnifciytfaDrl( ont4texnmfcio1la  luvs t) rtmir3nu1lle  ietlt)arrmxmooo0teeo oeiadfa2rlump (4tlenxo3tatfpt an s;() rxmxr3iy4lmtnlfetatf 2tr( ont1tpxnio3tysfa rln snu)artrircoa1oa eauvs;()s2trir io4lpte icilt) rraur ;t4aeenmoctasfsDeluvsnu0 rerir3ta1lmD  nvs;s tetr(r3nodomeemnctat) 2raxm ;t0tee  icildfa um(vp;t) ltoxocia1omD lnei s srxmxm nodomt liei sfa2trxrpoo1apenif3iytls emumsn(0tetrmr oa1opD  nvi s0s2tr(mpnodame  ivt t) Dtruront0olt mi3iltfm uan pnt0artrxrctodlm e nesl( teumxr3iy4am   ietl( a2trxm ;o1altomf3ild a ul( p ()trxoif oo1omD  nvi s0trurxm iudaltelivs t)sDtrumpnt1tpx  fctasfmDrln pnt0 rxnxf3iotfmD auvi ()s2to(mpoy4lmeemnct (f 2urx pno0tleo f3ildlm ulnmsnt4texoxfcoadomt au s;t)texoxo3nodol e ncsls)srtmxmoot0aexomf3tlsfm rm( p;u0 rtrircoatlat  ieo;s0trtmim3nudapen ieia( sDrrum oo0openmo3ilsfsDuan pnu4trerifciodfmtelu i;s  euoir3oodolt mnet tfsDrm(rpno1altomictysls2raump;(0altnmfctydfmDelies t)sexriopnu1apt  fcta(f Dum( o;t4ole  f3iat s ea( s;t0altoxfcio1oa  lnvo;t0 etrim iodamenmivi (fs2raumo;u4oeenif3tytfsDea(vsnt) eerxfcoytom e ivo (0s2xr(o oodlptemfet t sDta(mo;t1oetn ictyd sDeln sn(0 exrxociadfaDe uvi;s t2xm(r3iudlmtn nvias) rrmxm no4tetoiieiatfa eanvp;u0texoio3oatomte i s t0trurxopiydlm emiviat  ruaxmpnu0ape ifetldfm ranmp;u0aexrxo oatfpDrlues;(0sruoxmpoudlpeelnes ()artru  ;t1tex ioeiatfm2ulump;u4tlxoirctydfa   uvo s0srtrirpnu1ap e ict sf 2uax  ;u0ale  feiltla2em(ms;t0 ltnxf iatoaD lues;t sexmiopoodop nmivsa(  2uru  nu1aexn i3iyd m2uauvp;t)alxniocoodop eaneol()srtoiopny4omenmivi ()aDrrum ou1tet  i3ilsfa2em( s;u)trtnmr tadoaD  ies (0t2toxo iydlle lfcs s) rtmu  nt4oee mf3tyslaDuln pn(4arxrxf3tydfpDe ieol( sexm(r3oy1opte ncsa() rua(mono0apxomf3iyt aDea(vs;()alenmf tytfmteau s t t2uoxo oydlptelfetls aDtm(mo;t4olxnmf3tadfa umn p u4aeeoircoy1omtrli o;t texmim3iu4ll   nvi t  2uaurpot0tetoio3ildlmDelnmpn(0 reoio iotop raueo;s)trxoxo3iudom  lnvil(fartm( o;t0tlxn ociysfsDum(mp;(4alxoxf3to1oaDean sl(0s2xrio3io4ap e iesa( sDtax pno0tet ifeiasls2ranms;t) lenxr iatomteaieolt)t2xoxo io1op nmfetl()a2um(m ;t0olenmo3iatfa umu p;(4 lxnxfcoydoat  uvo t t2xr(m3iy4apeemies s artmum ;o0aet  fciysfaDrmuvpn(0trtrxf3iydomDrauvo;s)t2xoiopny1apt miesl(  Dra(r oo4aetnmi3tyt a2ulnmp;(4 ltnxr oo1fmtr uvs;(0 exo(r oo1am  lfesas)sDtr(  ;t1oetnmfeiyslm2eauvp;(4trxoxo ootoa r u i;( trxmxm ou1ope  ivt s)a2ua(ro;t1aexoioeilsfa em( s;u0tetomo ta1opDelnvi ()srurxm3io4lp emfvtl()sDrmum ou1tlx mf3iatfa2elnvs;u0alxrio3oy1fmD lues ( t2umir3ny4am   ict (f 2uru  oo1apxnii3tyd a2eauvo t0trtrxo ootom rlu s;s)sexmxmpnodopen icilt sruaxr ;u1aexnio3ils m2rlnvo;u)aexoif3iy1optr uei () exoxm oodapee fet t)arrau o;o0altoioetltlaDuan p;u0trxoif tydoptr u o ()t2tr(mpnu4al emfvtl(fsDtax o;o4aexn o3tls a ua(vp u4trtnmf3oy1lpDeln i t) 2umio io1opee ict (  rumurono4aee io3iydfmDul(vont4 lermr todop elu i s0srtmxm iu1al e nvs sfsDrr(rp;t0aptoioetys a emn p;t0aleoifcoytlptelivolt  rtr(m nodope lfesasfa2umumpot0oetomietydfsDra( p;t0trxrmo oo1opDeli s;s0 rum(mpoodlltnliei s sDurxront0texnifeiyslm ua( s u)treoircoa1fp eli il()tetr(r nydoltemfes sfaDtmurpot0optn fcildfm rmu s t)trtoxociadlm eaiei (0 rxmim no1llt lnetls) Dtr(ro;u1oex  oeilsfm rl(mon(4 exrmr3oodoa rauvo;(0t2uo(o3oo4al  lnci (  Dua( pnu1oetoio3iyt mDrl(mon(0 rxnxr oadlaDe uvols setmxrpny4ap nmivt s aDtm( pot4tptoii3iydls2umump t4tetrmf totlpt lnei;( setmir3oy4olt livia(faDua( oou1aeto f3tysls2rlnmo;t4arenxf ty1laD  uvi;s)t2uoio3iy4ame mies s)sDtru onu1apxn iciad mDelnmo;t)arxoxf3oytfatr uvi s)sexrxmpnu4lmte nvs (f Dtmu p;t1aexn fciadlmDeanmo;u0aetnmr iadomt  nvilt0trxm(m3iu1lmenmnesls)sDtm( o;u4texoiiciadfsDelnmont0 ltnxocoydlmtraueil(0truoxmpoy4om e ncias)a2trur ;o4opto i3tas mDulnvp t) lenmf3todlmDr u ols0sexm(m3oo4lpee ivt t)srum( ooo0aeto o3tyt m ua(vp;t4aexnxf to1omD lneo;( t2xoxm3oo1lp nmfviat a2rmxmo;u1alto icildfaDeanmsnu4aetnxr oo1oaDrln s;s0 2urxr3ou1optn ivsa( srraumpou4optomicias m2emuvpnt0alxnxf3iadopDe u o;t)trtoio no4om nlicsltf Dum(  ot1oltnmfeilslmDrm( s u4tltomrciotlptrlnvi t) 2tmir3iu1amtnmfvt (fs2urxmpnu0olxnmietadfm umums u)tetrioctydla rlneo (0 2xmxopio1op nmnvt sfs2tru  ;t4oexn ieiysla2uan snu) eeriocoydlmDe n ols0t2xoio3oo1omte fvt s)aDuaxrpno1oetnii3iytlm2ulu s t)trtnmf tytfaDrlivsl(0 etrxmpnu1lpen ici t srtrump;o4texn i3tlslsDua(vpnu)artnif3oy1opt luvs;s0s2tmxopou4ol   fctas)arur( pnu0tltnmf3iytfsDumuvs;t0areoio oytlmtrauvo;s)s2umxm3oo1opeelnvt () Duaxronu0apx ifctasfmDrau s;t0 etrmr oatfpt  n sl()trtm(rpiu1lle mnct s)aDtr(rpnu0tet mf3iltfm2raump (0trtrif ty1laDeli il(0setr(rpoudalt  ieia( a2tr(m ou0oleo i3tad mDrm(ms;u0 rtoio iydom  au i () rto(m3no4alte fetlt  Dtax o;u4opxnmoctatfa2eauvp t0trenif ia1lmDran il() 2xmxm oy1llen fvt s) 2rm( pou4opxn fctltfaDumn pnu4teeoxo3io1opt aueo;s0 exmxr no1amtemfesltfa2raumo;t1oeenioeiyslm ua(msn()trxnirctytfpD li olt)t2xrirpio4amen iei () Drmx  nu0tpe  f3iad sDul(vp;t)trerxrctatfpte nvilt s2ur(r3nu4ap  lncsa(faDrr(mo;u1teeoiieiltfa rlnvp;t4artoio3tatfmD li sl()texrxr3nudol emfciatf 2trxmp;t0ole iocilt m2ul(vo u)areoxo3iotfpD auvo;s trto(m3io1ap nlnctas aDurx pno4ole  ieiltlsDel(vpnt0aeeomo3to1laD aivsls srtr(m oydopenmfcs sfaDrm(rpot1tle  ieiltfm rlnms t4alxrir to1fpDean olt)srtoxopiodomt livt t) 2umxmpot1apt  ocild m2ea(vpn(4aeerir iydoaDr uvil(0teto(m io4lm elfetlt s2ra(  ;o1olx iictad s emnvs;t)arxnxo oydfa  aieil(0texr(r no1altelnetat aruaur ;t4olenmoetls s2emnvo;u0 rxomrctodoptelnei s  rxmio ou1altelivia( srtmxrpou0texo ociaslsDea( o;u4arenmrctytfa rai o;t t2xm(m io1ap nlnesl(  rumxro;u1tetniictat sDuanmo (4texnmr oytom ranvi (0s2trirpoudolt lfeta( artrumoou4tex  oetydfm2ea( s;() ltoxr3oatfmDrln slt)s2umim iodlleelncils)a2tmur ;o0tlx mfciad m ea(vont4 ltrifciytop r nvi t0srurxopnu1am   feiasf Dta(r ou1texo f3iys a eaumo (0 rtomr3ty1oat  ieo;s0trxoxopou1ll emfviat srrmxmoou1aeenmiciyd a2emuvs;t)aetnxfcoo1laDr neo;s tetoxmpiu4oleemnei sf rtaumpnt4tpt if3ildfa2ea( s u0 ltomo3ta1faDeaneolt s2uo(o iydol emiesas  2tmuro;o1texomoctadfmDemu s (0 renxoctodfmDrli o ()s2tmio iodol emnesa(faDtrurp;u1altomf3tydfaDeauvp;t0trerirciadopt luvs;(0trurio3iy1ape mfvs t) Drau  no4altnmiciyt s2el(vp u)areomf ootomDeaueo;s setrimpio4ome mfvs t sDtr(r ;o4tetn octatlm2rluvs t4trerif oatlp r ieol() rtr(m3no4aptnlfes tfa2uax  nu1oltomf3iltlm2rlumon(0 rxoir3oydlmtrlu o;s) eurir nudlp  mivta( s2rmx oou4aet ifciydlaDemn ont)aexrxr3oodfa rauei;( t2trxrpio4omtemfvtas)sDuaumooo1ole mfciltfaDrl(msnu0 exnxo3oodfaD lnvo;( t2trirpiy4alee ics sf 2umurpot0tltnmiciatfm2rau s (4alerio3tytopDrli s;s t2xmir oodameeliciasf 2rax  ;u4oetomi3ilt s uau p t4 rtnifciy1lmt aueolt setm(o3ou1ll n feilt)arta(rpnu0tlen o3tlt mDem(mo;u4trtoxociotom rlu sls) rtoxm nu1lp  mfvtls sDrrxrpoo0optnif3iysfaDrl(vs;(4tlenif ty1fateliei (0tetoxmpno4am e fetas) Dtr(r ou0teeo i3tltla2el( o;u)altoir3iodfpD aivo s  etr(opoydomt mivs () rrrx oou1tlxnmociasfm ua(mpnt4 exnmociydfaD auvi ()trtrimpiodalt  ncta()a2rm(m nu4oexn iciydfs eanms t)trenmf3iy1fa e ivo t)srxrxrpiudll nlfcs ( a2trum nt1alxnioetls mDeanmp ()aetrif3oy1omtrlnvi;s)srtrxm iy1lpe  neil( srrm( pnu0alxoiieiyt s ea(vpn(4 rtoiocta1lm eaivi;s s2tmio3nodame mnctl(f 2ra(mont4ape io3tltfsDeauvp (4texoio3iatlm raneolt  rxm(r nu4olenlnvt s s2tr( o;t0oeto f3tlsfm rmnmo u0treoxocoadlptrlnvs;t)s2xmxrpiudlp n net s s2tau  ;u4optoiieiyd m um(msnt0 rxrir oo1om rli o;s  2toxmpou4lltnmfeils)s2ur(rp;t4tex  feiydfaDem( o ()tlerxr tytop rln s s)s2trxr3no4ole mnci s  rtmxr ;o1oee ifetasls2emnmpnt0tltoir ootlm rlivo;(0s2xoimpoo1optelictatfs2um(r ;t0apen i3ilt m2ranvp;u4artrmf tydfate ues;() ruoxmpny4apee ivs s  rrm(mo;u1opt  ietasfm2rmu s;(4 lxnmfcoodfm  livi (0s2umio no1ap n iviasfsDua(m ;o4olen i3iad m2ra(vsn(0aeermf iotfm r ivo t0t2uo(rpiy4alenlncilsfaDtmum oo0alxnmoctld m2emnvpnu0tlxnxr tydlaDe ueo s0 2umimpnu1al nliet s sDra(mpnt0oleo o3tatfs el(vo;t4tleomo3oydla r n i t0teurxo nu4olte nct s  rrmu  nu4tex  ocils sDuanmpnt4 eeoio3oo1fpte ivi s) 2uoir3iudapenlictas)aDrrxr oo1oltomo3ilslaDua(mo (4arxrir tydfa   uvols)seurim3no1al n ieias sDtr(rpnt0tee  ietls m2rm( o;()texoifcto1lm ranvs;t trumiopiydllt lneta()srur(m ;o0opeo i3tasfmDuan o;() reoir tatom e u o ( t2trxmpoy1amt lieiatfsDum(monu4alxniictld s2ulump t)aetnif oytfpDeli ol()t2xo(r3oy1lmtelicsl() Dra(r ;t4aet mfctld a2el( sn(0alxoifcoa1fpt  nei;t) eurxmpnu1amtelfvsas  rtr( ono4altoifctadfm2rlnmp (0 lxrir iadomD  nvi;s) rumxrpoy1amtemnvi tfaDum(mo;o4openmoctldlm ea( o;(0trtoxr iadlmteau ilt)trxmxm nu4altn ivsas  rtrxm ;t1tpeomfeiasfs2ulumpnt4alenif3tytoat auvi;( setr(o nodap  mfvi tfsDrr(mpnu1apt moeildla el(vs;(0tetrirciatoaD lu o;s)s2xmxm3ny4ope mncil( a2tmxmp;u1olxomf3iydfs ul(mp u4trxrir oodfateau s ()sexoxo3nydoptnmfeil(f rrrurpnu1olenmieildls2rlnvp;(4aetnmfcoatfatelneo s truo(o3ny1lmte nesl(fsDurumont4apeo i3iad m ua(mp ()aetnio3tatfmDe nvi;s  etmio nodal e ivilt)a2uaxronu0texoifetat mDranvo;(0teermo oatlaD lieo t) rum(m3oodlltelnctl( a2rrur ;u0oleomfeiltfa2uluvp;u4 ltnxf ta1lp r u i (0trtr(r3no4lpenmietls) 2uaur nu4teen ociad s ea( p t)artrxo oatlptr u s s)t2xmxo3no1opeelnctas s2rmu pnu0alxn ietls m2emu snu4 rtrxr iydfmDrlivo;(  2xoxmpno4lp n netls artr( pot0aeeomf3ils aDra(mp t) reomo oodfa   ieslt)s2xoxopoydape mnvtatf rrrxmp;u1opeo oetldls rluvp;t0 rerir3oo1fpD  i ilt0 2uo(opny1op nlieia(fa2uaxm nu1aexnmieiysls ra(vp;t4arxoir ootfat  n i;t)t2xmimpno1aptnlfci t) rtrum ;t0texomf3tldls ea(mp;(4tltoio ootoateaneo t)tetoxo3ou4om e fcsl(fs2urx poo4apenmfeiat s2uau p;t4 eeoxo3to1fpt  ivi;( teuoim oy1ol  livtlt)a2trxmonu0optomf3iaslaDelu o;()arxnif3to1op e ueolt setmimpnudom nlnvia( srumx o;o4tleoio3tad aDeluvp (4 rxnxrciodlp rluvols0s2umimpno1am nmnesls) rrrx ont1tex mi3iadls rau p t0teenxr totlpD lu ilt0 euriopno1lmtelfcsl(  rraxrono4aetnmieiasfaDul( onu0alxoio iytomDr iei;t)s2uoxopoo4op nmfcils)s2raxrpou0aexo i3iys sDemnms (4tltnxocoytomtrai olt)s2trio3io1al  mivt ( artm(mp;u0tpe  octltfmDea(vpnt0alermfcia1omDrauvo;(0setm(m oodlpeelictasf Durxrp;u0olxo i3iydfs2rlnmont4 rxnxr3iy1fptrln o ()sexmxrpoy4omte icilt s2rau  oo1oet  f3tyt aDum(vsnt4 renmo iadoa elnei;t0 rtrirpnudol   netl()srrmum nt1tleoioetad mDrluvo t) eeoxr3iodlp elneo;s0 exrxopiudlptnmnciat)sDrrx ont4aptomieiytlaDumnms;(4treomo oatop r nvsls0 rtmxopoodalte nvt t a2truro;u1alto ociydla uaump;()arxnmocta1om r uvo;(0t2triopiy1lptnmfct ( s2tm( ooo4texnmieiaslaDumu s;u4altnmf iydlmtrln ilt0srtoxm3iy4ole  fcsls)artrx pou1opt  fcilslm2raums u0tlerxr iotoptr uvs s)t2xoxmpiydap  lnes (f Dta(r ;u1aptomoeiltlmDeauvp () eeomoctodlp  ln i (0srxmxrpno4om nmnvsa()srtmxmpot1tptnii3tydfmDrauvsnu0 ltomr oytfmD auei;t0setmim3nodop   ncsls  Drm(r ;o4oetoif3iytls2raumpnu4arenifctydlpt li i;s trurir ou4altemict t) rrmurpnt1tleomi3tlsfm2emn pnu0tlenio oo1fm rlivs;t0sexr(rpny4llee ncs t) rtrur ou4tpenmiciys m2elnmo;()aetrmr io1lp   ivo;t0 eum(o3nydalt mictl() 2tr(rpnt0opt mo3tldlaDuauvs u4 exrxf tytfp rlnvi s0srxo(mpnu4lpen netasf rta( o;o1oexnmocild m2elu o (0aexoifcoy1fa  aivslt) rur(o3oudlleelfes t  rum( p;u0ale io3iytfm2eanvs;u)tlenxf3iadfmDr nes t0setmimpoy1alt  fvtat)srrrxmo;u1oexn fetltfm2rln s (4aexrif3oo1omDr n i t0s2xrim3oo4al elncsa( sDrm(m ot4ole mo3iydls2rlu snu4alxrmrcoytfmtr ivsl()teuo(rpoy4ame  ivsa(f Duau pno1aptoifeiadfa ul(ms u)texnir iadfaD au i s)tetmio ny4aleemieta( a2uaurpnt1tee mo3iyt s2rmnms;u4aleoxr iadfm r nei;s0 2urim nudal nlnesl(  Dtm(r ;o1aleoiietasfs2eau on(0tltrxo3tytfm   ues t texoimpiodamt lfcs sfs2urumonu4oetomo3iytlm2ean o t)arxnmr3tadlmt lu ils srurirpoodaltemnet (  rum(  ;o4aex if3ildfm rmumonu0texrmf3ta1la raieils0seuo(r3no1openmieiltfsrumum ;t0apxo octysfs rmnms;()tltnif oo1lm  auvsl()teurxo3iu1omtnlnvi sfs2tmumonu0tpt mfctlsfaDul(vsnu4teeomf3iytfatraivs ()trtoxm3iu1olee nviltfartru o;u0opeo o3ildfmDrmn p;t) rtrmr3ty1lptelivilt  ruoiopiy4lltemnesl(  Dtrurp;t0tee mietad aDra(mp;u)aeermr3ta1omtr u i t)teto(mpiy1llee fvtl(fs2ur(rono4aleo ictasfa2emump (0texrio oydoaDr uvslt  exrirpio1lle mfvs ()a2rm(rpnt4aeenmoctld aDrln s u0arenifcoa1omteau sls0tetm(o3nudlmtn ivs ()srur(m ou1teenmictadfaDulnmp;t0 rerio iytfa   i ols  rtrxo3oy1amtn nvslsfartruro;u4tlxnifetld s2rlu s;(0aetnifcto1fp e n sl()setrxmpoy1ol nmneta()srurxmono1tet iocias mDua(ms u0altnmf3tatlpt aueilt  eto(m nydap  mictl(faruau p;o0aee  fetldls eau s t)trenxf iatoatr ivsls) rxmir iu4lp e ivsatf Dtm(m oo4teenmietyd s ea(vo t)altrmocto1oaDr nvslt  2xoxrpoo1op emivi tfarrax pnt0oexoiicildfsDuaump;t0aleriocoodlaDrlnvo t0 2xoxo iy1altemiesa(f 2ta(m ;o4tpxnifetytfs2ulnmo;u0 reoxf3to1fpDeln il(  eumxo nodlptelivias srururpnt4open fciyslsDra(mp u)aeeoio iadlmt anei t srxo(o io4ole lnvt ( srraxm nt1aetoio3iadls el(mp u4 rtnxo oatfmtranvi s tetmxopnudop elicil( aDtaxm ;u0tpenifeiys m2ran o;t0arenxr ta1omDr nvs;t srtmxopiudlp emfesat arta(  ;u0oeenmf3iydfa ean pn(4tetnxo3io1fm eai o t) 2xo(r ou4lptnlnci s a2um( pnt1tpt  fetltls rlu s (0tltnxo iy1lmt li olt0 rxoxm3nodam elnvsltfartmxrp;t0ale  i3iadfa uau o;u0 lenir3iytfpDrluesl()t2uoir nydame mivsat) 2um(  ot1alxo iciyt m2ra(vsnt0 leoxo3tytlaDran ol(0seurio ou1apeelnvta(fsDuau p;t4texn f3tldlm2eluvsnu0alenio tadlp e uesls)seum(r3ou1lm nmnvia(f Drau o;t0alxn f3iasfm2ran pn(0aetnxf3oydomt lnvil()trxrir3oydam elivi s)arrr(mpou1apeoiociadlsDean o t4tlxoxf3to1oa  livo;s) 2umiopou4apt  ncs s) Dtm(mo;u1apeniieiltls um(mp;u4alerxo3totopt liei;s) 2xmim3oo4ap   nvt t srra(moou1apxoiociysfm eln on()altriociadlm  li i (0s2tr(mpoy1altemieia(f 2rm( o;t1aptnmf3iadfsDra(vs;()tltoio iatfp rlu s s)t2xmim3iu1oltnmfeias sDurxr no4alx  iciatfa2elu o (0 rermf3oydoatrau o () etrxm no1ame  fci () 2uru  ;t4olxnmi3iydfa2um( snt) ltoxrcoytoa  lnvs;() 2xmir3ny4op  lictasfa2rmumonu0tltnmfeils m rl( s;t0teermr iytfptrluvo t trxrio io4aptemfvs (  Duaxm oo4tlxn ictad sDulu o;u0 leoxocta1oat anes;s trur(r nydlme mfctls) rum(r ou1open ociadls uanvs t)aexomo3tatfmtrai o;t trxrxo3oo1llee ivsatfs2raxro;o0tleoioeias mDrm(vs;(4 lxnmf3iy1oa  an s (0 eur(rpiu4ol e nvtlt a2tmum no1tlto o3iad a2rmnmsnu4aeenmf3iy1om r iei;s0srtoim oy4amenlfvil(f rrrxmpou0oet  ociat a ran snu4 etomf ta1fp   n ilt0t2xoxm oy1am nlnet tf Drmxrooo4aetnmiciadfm ulumsn()arxrxf3ta1oaD ai olt s2tmirpio1op nlnvslt artrxr ;t1tle ifciasfmDea(ms;u4alxrmrcoodop   ivs t sexr(opoo4aleemnesa(f 2rax  ;o1oet mieildlsDrl(vp;(0texoir3oytfatrli i (  eumiopnu1omeemiesat)s2ra(  ;u1olt mi3iydfaDeanms;u0texoio ty1oa  luvi;(0srumimpiu4op  lfes tf Drr( pnu1aptomfciydlmDeauvpnu0tlxnif todfaDelivo;t t2tmxrpno4lltelfvtlsfaDtaur ou0aleomf3iadfa uln p;t)trtrxr3iadlat luvo;s)tetrxr iodomt lfvi ( sDtaxmp;u4apxnmietyd m2emnvonu0 ltrxr oo1fmD  uvilt srurxm3iu4ap nlics t  rtaxrp;t4tpxniictld s2uauvsnt4 rtrircoodoa r iei (0teuoiopio1op elfesatfs2rmxroot1aeeomfciyslmDrlump;u) rtnif3iotoptrau o t  2xmxopny1opt mnvtat)s2tmxr no0aex iietytfm rl(vo t4 rtrxr iodlate iei ( s2toio3oydlmte nvt (f Dtmxr nu0tet io3iyd sDum(mo;(4 ltnmfcty1fa  lnes t srxm(opno4optnmietl(  Dtr( pou0oleoifctatfsDuan o (0arxomr ta1oaDeauei;s0t2tmir ny4lmenmneia( artr( o;t1olxn feiydfs2ua(vont) rtrir3todfp rluvilt srum(r oy4alen nvsa(  Dtau  ;t1aptn f3ild aDean p t4 ltrmr oytoatrln slt)truoio oodoptnmfvs tfsrua(mo;u0tle mfeiasla2uanms;(4 eenmocoa1op eaieol(  2ur(rpoydapt  ictas arrm(r ;u1tptomictysfs ra(vpnt4 rtomo3tydfaDr i ol( srumim iodope mfvs () 2tmxrp;t1apen f3tld aDrl(vsnu)teenxo oydoat  nes t0 exo(m ou1lm nmicias)aDur(ront0aexn oetas s rl(mp;t0tetomr oy1oaD  uvil(  2ur(m3io4ol elnvsl() 2taxrono1alxnioetatfa um(mo t)tleniociadoatrlivo;(0seumxo3iy1lp elnet sfsDta(r ot0oexo ieiydlm el(vo ()tlxnmocoatomDeluvs;t0s2uoio3oy1am n ietlt)a2raxm ;u1olxnmoctysfsDeanvs u4 rxrifcia1oa ran o (0tetmir3iodapt mfcsl() rrr( onu4tleniociyt mDelnmpnt)aexoxoctydlmtr nvs;t trtm(o nu4lle lfvtlsfa2tmxr oo4apxomfctatlm eanmo u)artrmo3totoa rlues;s0sexoio3iodom   ieias)s2rmum ot4apto ictlsls2emnvs;u4tetnir iytop eaieol()seurio nodalen ivsatf 2umuro;u0oeeomf3iatlm2elumsnt)aeenio3iytfm elneilt teto(o oy4ape liciasfsrtr(rp;t0aeenifciltlaDrm(mpn()trxoiocoodoate u sls)srumiopny1apt lfvi (  Dtr(m ou1aptn ieiltla umuvs u)arxnxoctatopDrli ols  rurirpiydol elnctltf Dumu poo1aex io3iadls el(msn(0artomfcoytlptelueols0 rur(r3io4apt  fesat)sDrau p;u1aptnio3iatlm2rm( s;t)tetrmf io1lmt  uvo;s)sexm(r3oy4lm   icslsfaDrax o;t4oet ifciasfmDrl(vs;t4 etnmf3oy1lat  n o;s0trxmio iu1opee ieilt s2ur(moot1apxnmiciad s2ea( o u0 etoxo3iydlpt ai ol(  2urxrpoydlmt lietltfaDrru  no1aetn ieilsfm2ra(ms u0 etoifcia1fptr n s t srxo(m oudlmte nci (fs2rax  ou1ape micilt m2rl(vs u4trenmo3oo1omte ueolt0trtr(m3nu1ol nmfct s)s2rmuroot4tpto oeiydla emnvs;()aetoxf3tadoptr neo t s2ur(o iudale lnvias  rrm( poo1tleoifetadfsDeanvp;u)trxoifciatfmtraieo (0s2uo(o iu1alen ivtls)aDrrxr nt0optoiieiat s2emn sn(0aeeoxr oo1fm eaies;s)texrim3no4lp nmiciat)srtmu pou4tex mfeiyt a2umnmp;t4treoiocoytfa ean s;s)srumxopno4ll eliesas) rurumpoo0tpt iiciys m umnvs (0trtnircia1lpDr ueslt0texmxrpnu4lleelneta( aDuaxronu0olt mo3tld sDel(vp u) reoxr to1oatrln o;t srum(opnu1amtnlietltfs2tr(mpnu1aptoifetys a rlnvpnt) renxfcootfa e uvi (0t2to(r3ny4al n ics s sDtmumoot1alenmicilslmDrmu sn() etomo3oatfmte nvi;() 2umir3oodapeelicia()artaxmpou4tpxniieiaslm2umu p;t4 ltnxocoa1la elnes;t0seumxm3nu4apeelnvias  Dtmuroot0oeenii3ilsfs2rau s;t)areoxociytfaD  u i t  rtmxopoodlp e nctat)s2rru  no0opt mfetadfs rmu onu4 lxrmf ta1laD  ues ()trxrim iu1olt lfesltfarrau pou0tee ifeildfaDeluvpnt4texomf3oydop e uei;s)tetmir3io4opte fvs s)sDrrump;u0oeenio3ild aDemu p t0 lxnif ia1fmDeli ilt  2trim3iy1amt miviat  rtax o;o0openiictydla2el(mp t)tlxoxr todlmDe uei;()s2xr(m3iu1al  livtltf 2taur oo4aptnmfeiysls emuvsnt4tlermfcoatfmDeaneo (0 exmxr iydopen iviatfa2tr(moou4alxnifeiadfm2emumo;()trtoxo3ootoaDr nvo t) rtmxopou4lltnlnvslsfaDtaxm oo0aetomiciatlm ranvs u4tleoxr3oa1lm  aueil() 2tm(m ny1om   nvtls)s2rm(m nu1tlxniieiltlsDrmn pn()aetnxfcoo1lp eli i;t)t2urxo3no4ap emneil(  rrmum ;u0tpe mfeiad mDumu o (0 eenio3ootomtelneilt trtmxr3iy1ll   nvsls)a2tmx onu1aexn f3iaslmDumnms t)teermfcoatlm eluvi;s) etoio oy4am  mnei s) Dur(rpnt4tpe mi3iad aDua(mo;u0texrircootlpDr neo;( sruoim iu4om emfctltf rrax pot0teenio3iad s2ra(mp;u)alxrifciadopD lnes t0 etoxo3iudam  liviat)s2trur nu1tlto f3tadlaDrm(ms t) lxnmrcia1oaDe i slt0srum(o3io4oleemfvtls s2tax  ;o0olt ifeiltfa el( s u0texrio3tatlaDrlnvo s srum(opoydomeemictasfsDtmxro;o1aexomoetlsfa2ranvs;(0areoircoydfa  auei s)trxr(o nu1omt lnet t)sruru p;u0opto i3iatlm2rm( s ()alxoio3tydfpD aivo;t srtm(o oy1op nmneia() rrm( onu1apxo oeilsfm2rlumo t0teeomo iy1latrauesls0srumiopno4llenmfvsatfsrrru  nt4olxnmo3ildfsDemums;(4aleoio3oadlaDelieo s) rtmim ou4omtelncsl( s2ua(  ;t1oltomi3iyd s eau s t0aetrxo oatopDraivil(  rxm(r3iodole lfvil(fsrrmur oo4teen oeilt a ul(msnu0aeenio oy1lateau ilt  rxo(rpiu1aptemicslt  2uaxm oo1aexnmoeiydlmDrmu s t4texrio iatoa e neo;t setrxo nydam e ivs t)a2ta(mp;u1alt iicilsfa rau snu4 rtoio iytoptrai s;()setmir ou1aleelfvtl(faDrau pou1tle  i3iadlmDra(vpnu0 leoxf3tytoptr neils)s2xoxr iy4om   fctatfs2uax  ;u1apto f3ildla2ea( p (4tleoir iadfptrlu o;s0 rumxmpiydap e nvtl()s2ra(mo;u0olxnmi3tls a rmnvo ()trenmr3oo1fm  luvi s t2tm(r3io1opt lfeslt)sDum( o;o0oet ifeiysls um( pnt0aexnmr3totopte ivs ()t2umio3nu4optemfei t s2rm(r ;t1aleo f3tytlm2emn p t0teeomr3oy1laDraues s t2xoxopoydome lfetlt)a2uaxmo;u0apt ifetytls rmnvp t0tetrif3tytfaDe ivol()srxm(o3nydolte fvtatf rtm(rooo1tlxn fciyt m em(vo;u)tlxoxo3iytoaD aies;t0 ruoirpno4ap  mfeta()a2tmu o;o1aexoiictlsfmDumnvo;t)trxrmo tatlm eauvil()t2tr(r nu4lpen nvtas) rtru pot1tpe ioctydls2ranvpnu0aetnif todom  aivols)t2tmir3nu1lleelfcs t  rtmum oo0teenifeiaslm2rm(vsn()altnxrciy1fa e nvolt)t2umir io4optemncil()artruroot4oltomfeiatfa emnms;(0trtomrciytfpDe ieolt0trxo(opoy1lmenlivil() Duax  no4tlxnmoetyt m rauvp t4artnio oy1fpt aivo;t0 exrim3oy4ale  ietls)arta(  ;u0oeeniocilsfmDumn o u0 rerifciodoaDrlneo s0 rtrio3iodap  lfcia( a2tmumoot1tpxn ociys sDrluvs t0trtoxr tydfaD lneo s0 2xmim3oo4lp nmnvtat  Dumum nu0tpe  ietldfa eln o (4arxoxr3oodfaDe ueo s0t2tmxmpnu4ll nmfcta(f Drau  ;o4tpx  o3tyt sDra(mo;t0trtrmo ta1lm e iei t  2toio iudol elfvt ()sDrau o;u0alto iciltlm eaums ()aeenxo3io1fatrlivi t0 2tmir nu1opt  fet t) 2trxr ou4tlx  o3ilt m eanmo;t0aexoxo3iy1lp r ivo ()trum(m3oodom n neiat a2trumpot4ope moeiysla2emnmo (4trerxrcootfp   n i s0s2umxr3ny1ole  iviasfaDuaxmpoo1tpxo fctltfs2um(mo t)altnxo oatoaD lu slt seum(opnudlm e neil()sruau  ;t4tee ifeiadlm em( p;(4 ltomo3iodlpD livs s0s2xmio nu1omt lncia(fa2ua(rpot1aetnmi3iltls elu sn(0teeniociodfmDr nvi s srxm(o3oodaltelfcs t)s2rr(  nu4tlxomf3tad m rmnvs u0trermfctodlp rlies;t0 rxrio iy4lpenmfvs (fs2ua(monu4optoifeiat aDumnvs;u)arerxf iydlmte nvo s0 etrxr ou4lpenlicsatf rtaxmooo0olxo icildfmDrlums;()trenmr oytoaDr ies;( setm(opoo4lm  mfvsasfarraum ot0texo feild a um( sn()alxnxr oa1lp   ivols teto(o nydlmeemfeia(fsDrau  ot4aleomoctld m2rm(ms;t4aleoxfcta1latrlnei;t) ruo(opio1ome  nctl() 2rmxmpoo1tetomo3ilsfs rmn ont0tlenmocoadlm  lu olt seuoimpny4lpt mfes tfs2rau poo1apeo f3iatla uauvp t)texrxfcootfa ean i;s0s2umiopiy4omtn ncs ( aDra( p;u1ape mietyt a2elu sn(4 eeoiocta1fatr uvsl(0t2umxopio4olee ivtltfsrtruro;t4aee ifciytfaDrlnms u) ltrmfctadfpteauvi;(  etrxm3iu1lpt mfvtltfa2tauront1ole mfctad s2rln onu)texnmr ia1fmt ai ils0 2uo(r iydal elfvsa()sDtaxront4alxomo3tyslm2eanvpnt)treoircoo1lpDe ivs;t0 2xm(o3oo1lmt mncsa()srtaum ;u0olx io3tls a rm(mo u4tlenxocty1fpDraies s)sexo(opou1olenlnvsatfa2trxm ;t4oee ii3iys m rlnms;(0alxomf iadfmDeauvs t)sexoiopoudlm elfetlt) rua(m ot4tleo fetadla2rm(msnt) lxoxf iydfp eaueo t)seuoir3io1lm  lfet tfsrra( o;o4oeenmf3iatfa ra(mp;t)altoif iodfpt  nvs;s)trtoxm iydal nlfviasf Dra( pnt0olx  i3ilslm2umnmsn(4trtnmo3to1fp  aieo;( trur(o3iy1llenlfcs t srtrurpnt1aet io3ild aDea(ms;t)aeenxrciatlm e n o t)s2um(m oudalenlnvsa(fsDta(r ;o1ape  fetldls um(vp t4aexnio3todfateliei () exrio nodlmenlies s)sDumx  nt0oee mf3iadfmDrl(vs;()arermo3iatlmt aueo;(  exo(m oy4apt  iviat)sDrax poo1oetnifciat sDuluvp u)arxoxf io1om e u olt0 rumirpiodomtelfct sfsrtrxrp;o1tee io3iasfsDrl(vo;t0 lenmo3oadfaDr iesls) exmir3nodap e ict s  Dtrxr nt0olen fctys aDel(mo u4alermfciotfpDrlneo ()srtmxopoo4lp  micils  Dta( p;u0tlt  o3ils mDul(vp;t4tleomrctydlm   neo;t)trtmxr iydamtn ieiat)s2um( p;u1openii3iltlmDumnvp t4 rxoxr oy1latelivslt s2xmirpiydol nmicslt)sDrr(r no1aexoii3ilslaDua(vs u) lxoio3to1lp rau o t  rto(opiu4amtn nei sf rraxmont1oetnifciadla2rmu pnt0aleoxocty1fate ueils0 exrim3nudop nlivsat)a2um(r ;o0tpeo ociytlm um(mp t4aeeomr3oytlmDeln slt0tetoir3oodomeemiei sf 2taurp;u4apt  f3iysfmDrlu p;t)tlerxr iodlmtranvo;s0 2xrxr3ou4open fes s  Dum(rono4tet ii3tysls2ul(vpn(4aetnmf3oadop eli i;t s2xmio3oodom elnvs (fs2trxmonu1aex iieiytls2el(ms;t0texoxo3iatfmD livi s0 eumxo3io1alenlfei t  2ta( p;o4olxo i3tasls2rl(mo t)trxnifcio1lp  lnvs;s0teuo(o3iu1lmte fctatf Duaum ot0olen o3iasfs umuvs;t4tltnmo ta1lpte nvil(  rxm(mpnydap e ieslt)aDrm(r nu1texomietldlmDumnmp t0alenxf3ia1lpD lnvilt  2uoir oo1omt lies s) 2ta( p;o0tlxomf3iyt a emnvs;(0 rtnmf3iatoaDelnei;s) rumxr io4lm n ieia( aDrrur oo0tpenioctydfs2rln pn(4texnxo tatopDeauvo;(0trtoir ou4lptnlnctlt  Drmumo;o0apt  octasfs um(msn(4aleomr todoat auvols  rto(r3oo4optemfcilt  rra(rpno0tleniociyt m2um( o ()trxnxociytfaD anvil(0setoxo iu4amee fvi () 2rrxrpnu1oleoii3iydfm ulumpn() leoio3ta1omteaueil() 2xo(o nu4ll   fesat sDur(monu0oeenioeildfs2umumo (4treoif oytom eaneo;s0 rtrio3oudlp   nvtltfa2uaxr ot1altniietld a2raums t)teenxo3iotop eluvs t0trumim3oo1al e fvsatfartruroou4opt ifetydfa rl(mp u4trtomf3iy1om  lues ( seuoiopnodolte nvtl( aDta(moot1opeomictytlm rlnvs;(0trtrio ootla  ai o;t0srtr(r iodom  lfcs (f Dtmur no0teenii3iysfaDum(vo;u)tltoir io1laDeau s;s)s2xo(mpoydlpee ici () 2ua(moou4oexn fciatlm2el(vsnt0treoir3oa1lateanesl(  rurxo ny1al nlnctlt) Dtr( o;t0apt  octasfs ua(vp u4tetoifciodomte i s;t s2urio oo1al emnvilsfa2rr(rpoo1aex mfctatls2emumonu)tlerir iodoaD aivs s  rurxrpiodll nlneiat sDua(m ;t1tee ifetadlm ul(vo;(4tetrifctatla  ai s (0 2umim3iy4om n icils) rurxrono1aexn feiadfs rmn s u) eenir3ty1lm raueo;s0t2ur(m iudame lfci s) Drrur nu4aet  i3ild s rl(vs;t)tltnmfcoydomtr nvs;s0setm(rpoy4opeemivta()artmx  ot4aet  iciyt sDul( ont4tltnio3iytom elu s t0 rto(o3no1am e nvia(  Dua(rpno4tpx io3iytla2eau p t0 rtrxr oytfmD an i t t2xmxo3no4omenlietl() rumxrp;u4olxoif3tys mDeauvp;t0 eermf iatfateaies;(  exrir3ou4amtelfetas sDtmxmpou0optn oeiadfa2em(vo;u0trtrmr3iotfat  nvi;()trxoxm3iy4lptn neta(farrrx oot4teeomo3tldfm2ua(vs;(4trenxo3totomteauei;s trxo(r io1ap   fvs t) Duru pou4tetoii3iat aDrlnmont4aleoxo iodomteli ols) 2xoio no4om n ncsls)aDtr(r ;u4alt mfeiasla2umnvpnt4 ltnmf3oadoaD auvo t t2toir3nu4ol   nesltfa2rru o;o0apen oeiydlm rlumsnu4arenmr3oytlat ai s t)srurio3oo4lme  fvt ( sruaxmo;u1oltoioeiadla2em(vpnu0tlxoircoo1fmDeaneil(0 rtrxo3iy4ll n fvs (f Dua( o;u4tptn iciltfsDuan onu)alxoiocoytfpt lu o;(0s2to(rpoodll nmietl()sDur(r oo0ale  i3tlsls um(vo;(0 etrmo3iadfmD anvs (0sexoxopny4optnmies tfa2ra(  ;u4oleoif3tyt a emu o;t0 lxrmocia1lptr n s t texmxm3oydap nmnciat srtmur ou4tlxnmf3ildls emnmp;() leoxrcty1lp  lu ilt) euo(rpoudom n ivsas)srurxrpou0tlxoiicils m2eanmsn(4artoio3iotfat  nei;t0srurxo3nydoltnmnet (  Dtaxmpou0alxnmfciadla2ra( o t) ltrif oo1op rlivs ()setrxm3nydal  lnesasfs2raxm ou0aee  oetyd m uan s (4texoif oadfaD  n sls)trurxo3oy4op nmivsatfa2raumont0opeoiiciytlm2rm(mp t0texnxo3ty1fate ivo (0 exmiopno1olenlivs t s2um( pou0aexoiociysfs2rmn s;(4arermo iatomD lieslt s2ur(r io1lm   ics t)arrmxmono0aleoiociltla2em(vo u4aetrmf3iatoa r iei;( seurxo iudaltn feilt)a2rau onu1tlxo feias sDrm( pn(0aetoifciodfmDeaueols  euo(m iudlmtemnetl()s2rm( p;t1tptomociasfa rln o u) lxnxf3oo1fpte uvsl(0trtoxmpoydol  mnvtls  rtaurpoo1opx  feiadlm2ulu pnt0teenxr3ootomte uvsls)t2xm(rpny4lptelivsas srumur nt4opxnioetltfa um( snu)alenir3oodlmD lu o ()trxoxr oydaptn fes s srrmxroot4tltnmoeils a2um(vsnu) ltrir3tadlpt  ueols)truo(o3no1ameelnvsl()a2umurono0aleo i3iltla eau o;u0 lermoctodop  au i;( sexo(opiu4op n nvtatfsrraur nt1aeen fcilsfaDel( s (4artomf iadlp r nei t) 2xoxo3oydlm nmicsat)s2rrxmpno4texn f3iadfm el(vs;(4 rxrmf oodfat aueilt0 rxm(mpnu4lleemivilt)sDum(rooo4olt  ieiyt m2ul(vs u)alenxoctadlmDraueo;t)srumirpny1llenlnvi () rtm(m ot4tlt ifeiyt aDumu on(4tltnxrcoy1op rlneo s)setmxo3nydll  mnciltfarta(mont0oexnmi3iat sDeauvpn(4tetrioctodfmDeli il()t2to(rpoy4op nlfciat  2um(rpnt4apen fetysfsDran snt)tetnxocio1fpD anei (0t2xoim iu1ap nlnetl(  Draxmp;u0tptn oeiadla umu s;u)areomo to1laDrluvi;t0s2trxo oy4ll nmivil( s2tmxroou4tptn iciltla emu p;t)arxnir3io1fpD lnei ()srxmxm oy1opte ictatfsDrrump;t1tlto oetlsfmDum(vo;t0altrmr oatfpD au sl()texmim3oudopeeliet sfsrta(rpnu0ape moctldfm uln pnt4trtoxrciadlmD auvi s  2toxm3iodlmtn neilt)s2rrumpnu1tee iicias s eauvsnt0tlxnmoctytopD aieslt  rxoim iy4ll   nvt t arrmxrpno1oet mfciytls2rlnmpnt0alxoirctatop elies;()srtmxmpno4olt  fvsltf Dtrxroot0apx mi3iltlsDrmn pnu) rermr oa1om e i s s)setoir iu4lp elnei t aDrm(  ou4olxnmfciys s2uanvo;t0trxnmo3tydlaD luvils  rxoxrpnu4lm e fvs t srtrxrp;o4oee  fciyt a2rmuvo (4aexrir3iy1oatrau i;s0s2urxm ny1ol  lnct t s2uaxmo;t1teeoiiciltfa rl(ms u)altrirctatlaDrlneo t)srxmxmpnu1open nesls arur(m ou1olenmiciasfa ra(vp u4 exriociytfaD ai ols0tetmio iu1lleemfcslt  Dtr(  ;u0tetoifetld a2ulnmp;u0artoircoa1fpDe n i;s0 exrimpiodol nmnei s)s2rm(  nu4olxo ociysfa rl( o;u)tetrio3totop e ivolt srxr(m io4apenmictat)s2tmu ono0opeomo3tltfaDraumsnu0alxrxo io1opt lu o;t)sexoim nu4lpe mnet tf Draxm ou0oexomf3tasfa ranmp;u4teermf oydfpt anvo;s0 rxmio nu1ome  fctlsf rtaum nu4alt  oetltls rmuvs (0arermfcto1omDr nvs;t0 2xmxopoodlpenmfcil()sDuaum nt4ale  ocildfsDuan pn(4 eerif oytomt lneol()s2toirpnu1al emfvslsfsDtr( oou1oet ifciytlaDrmnvpnu) etoio3ty1opt auvs () 2uoxm nu1altelfvt (fsrurx o;o1aeenmfeiydfs eluvp (0 eerio3io1fpD  nes;() eum(m oy4lme lnci t a2rmxmpnu4opxomi3ias s em(vo;u4trxnio3tadfate ieol(0seur(r3io1lmenmneiat)a2rrum nt1tpxnmoctldfmDumnvs u4alxnmr io1fpDr ues;s0trtr(o oo1ole lfciltfaDrrx  ;o0alxniociltla umumo t)alenmf ta1la eluvs;t0s2umxm3oy1al nmicsls srta(mo;o4tleomf3iaslmDran ont) etrxr oatoptr ueo;s0srxrim3nu4ameemivtl(f Durxrooo1opeo ieiadlm2ua(vs (4aetoxf oo1fmDean sl()sruo(r no1lmtelivt t)sDurxm ;o1tpxnioctyt mDemnmsn(4trtoifcoatlat  nvolt  rurim ny1lmee nvs ()aDumumo;o0aetnmfciadfs2eaumo;t4 rxnmf oo1om eluvi;() rtrxopnudop n fcils)aDtr(ront0tex mfcias a rlumpn(4teerio3todoa  lu s t  euoxm ou4am  mfcia()srururpoo4aeenmfcils aDrlumon(4aexnio tytlpDeaues s  rxoirpou1lm  lnvtas) Dtau  ou4tleoiociys m eln p t0trxrmo iy1laDranvil(0srxr(m3nu1ameemfeil( a2rmxrpnu0aleoifeiad s2uluvpn(4 rxrxr3oy1op  aneilt t2uoxopnu4lmtnliesasf 2tauront0tlx mociys aDra(mp;t4texnxo3oydomteaiei;t  rumxopnu1olt lncils  Duru p;o4olx mociadfm2um(vpn(0trxoxr oy1oatraneols0trxmimpoy1lmt  nviasf 2ra( o;o0ole ifetys a eau s t4teerir to1la  ln i (0trtmxo3iy4op   nvia() rumx p;t0apenmfcildlm2rluvo t0tltoxoctotlm rauvi;(0 exoxr3ny4amtnmnet s aruaxmont4oex  o3ias mDrm(mpnt)tlxrif3oy1oaD lneo t0t2urxrpiodapenmfcs sf rrmxro;t1ole mietytfsDem( s;(4 eeoiociadfpt ln o t)s2xoxo ny4ole mies t)a2raum oo4apxomo3tldfs emn s;u4trxoifctodla  lues;()trumxm iu4lmtnlfcslt)s2taurpou4opxomoeilsfmDrauvo;(0trerxrcootom eau ol(0texr(r nu4am  lnctlsfaDumumpot1tle iiciys s2ul( p (4aleoio oy1fatelivs s  2umiopiydole mneias sDur(mo;u4tltomfciyslsDrmums;u0alxrir3tatfpD anesl(  exo(m3iy4lptnmiviat aruau  no1alto oeiytfs ra(vs;u4 etrmo3tatlpDr ivs s)teuo(m3no4ll n nvt s)arrr(ro;u4apto ictasfs2el( o t)aeeoxo iadfaDe i i s  ruoxrpiu1lleelnvsl(f Dur(rooo4opeo f3tas aDum( snt) rxnio io1opDe i o;s0t2tmxo3nodomt  nct (  2rm(  ;o1aetn o3tas a2uanmpnt)aeeoxf ta1fatr u o;t0t2xoir nu4amen nvil(f Draur nu0apt miciatlm2rmnvp;t0arxomf3iodfmtrlues;s)s2xrir iodlp   ivtl(  2tr( oot0aleomoeiytlm elnvp (0tltnxocta1fmt lueslt)s2tmiopnodlptemnes (  2ur( o;u4alx moetyslm2umnms;u0artoif3todlp   nvs;(0texmxopnu4omt  fctas)a2ur(rpnu0aptoioeiadla2el(vp;t4trtomrcootom  au i t srxr(mpiy1amtnlics s  2tmumpnu1opxnioeildfm2elu sn(0trtnifciadom rai slt seumxo3nydomtelnvta( srurum ;t4oltnmfcilsfm2ulumon()tlxrxf3ia1omDrli o ( sexoirpnudopenlfvsl( arra(mpno1aeen icilslaDumu pn(0 etoxf oydomtr neo;t0 rxmxmpiydamtelietls srrm(m nu4aetniieiydla uanvo;()tltoif3ta1oa   ies s  rxmxmpou1lpee fvtlsfa2tr(r ;u1aleoioeiatfsDra(vp;(0alxnxf3todopDrlneo (0t2xoio iu4aptnmnvs ()s2urumpot0olxo o3tad mDrl(ms;u0 rtrmr3tadfate ies t0texrxr no1alee netlsf Dum(monu0altn ictls m2emnvont)tleoio3oodomD luvi;t0tetr(o3iodaptnmnvsl(fsDumxr ;u4optoioeiat sDemn pn(0aetnxo3oatlpte n i;t0 2xrim3iy1lle  nctat aDrmx  ;u1oet  i3tas m ranmp;(4alxrmr totoptelnvs ( teumir nu1oleemncilt) Drmxm ;t1tleomo3ils sDrlu s u)arenxo oa1opte ies;s)trxrxm ny1lmtn ictlt)arurumo;o4alt  ieiadfa rluvp t) lxnio oadfp   ivo;()t2xr(mpnydape miciatfs2ra( pou1aet mieiad s2elnvp t4aetrxr iodlaDeauvslt)t2xm(r oy4ameemneias sruaxr ou4alx  ictydfm rmn sn(0 lxnxr3tatom r ieo;t0seto(o ny4apen nvi t) 2uaxmpot0alto ietytls2rmnvs t0 exoir oodomDraueol(  2trxo iydole lfvta()a2uru pnu4apt  o3tytfsDeln s u0artoxf tydlp eauvs s) rum(o no4al e feta()srum(r nt0tpenmfetys s rluvo;t4 renxf iydoa ran il(0 rxo(opoydll  licil()aDurxm no0oetnmiciltlm2um(mp;u0tleoxf3oo1opDran i;s) rurxr iu1llt  nei t)a2tmxrp;u0tetomi3iadlmDrlu o (4aetoxo3oodfaDrli olt)seurir nodll e iei ()sDua(roou0oeeo oetytfm emumo;()trtnxocoatlp   u i;s srxm(r3iydole lfetat)a2rm(r nu4tee  feils s rau p;u0 etoxr3tytfpDrlu o t s2trio3oodlmenmnvt sf 2trx  ou1tltn feiydls2ranmo (4 etrxfcoodlpD lu i;()trumxopiodap nlfci ( srumur no1altnmieias m2eanmp;u) eeoxf oa1oatr nes;()t2umxr nodopeemivil( sDurxmo;o4tlt ifetydlm rm( o t0 ltomr todfmt aueol()t2uoir iodol emietlt) rraxrpnu0tle ioetadfm2rl(mont4trtoiociotfptelivo;() 2xoiopiudlme mivsat) Dtmxr ou0apx ioeils sDrlu s (0aeeoif3oo1lptr iesls  2trim iu1aptemnvtls  2tru pot1tlx  o3ildfaDul(ms;t4areoiociadopt  nes;s)srtmir io1olenliet tf ruaurono0tlenmiciasla2ea(mp;t4tlxomf oa1opte u i;t t2uo(opoodop nmivt (fsrurxmono0tpeoiiciytfsDem(vo t4 lxnxo oo1lp   ivils)trtrim3nydom emietas  2rmuro;u0tle iiciyt m em(mo u4tltoif iytfpteluvolt  2uo(mpny1llenlfetlt) 2ra( onu1tle  iciatlm2umump (4texnir iodfmt  ivi ()seuo(opny4lltelici (fsrurur ;t4tpxomietat s2el(ms;u4tltriocoy1oaD lueolt)tetrxrpoodomtnlfetas)arurxmp;o1alxomoeiysfsDum(ms;t0 lenir3iadfmtr uvolt)sexmxrpny1llte ies (fsDtm( ono1olto ietasfm2rl(vp (4trerxf3oodopt lnei s)t2toio oodlmeelies s sDrru onu4tex moetltfsDrm( s u0tlxomfcoadlpt aiei () rtoxo3oo4oleemfes t a2ra(  ou0tet  ictad a rm( s;u)texnmf iotlp rlnvils  exm(opiy1amtn fcilt) Dtaumpou0olenio3iadfm uanmp;() rxrif3oo1oa  ai s;t)s2ur(rpiodlltnlfviasf Dum(r ot0opx micilt mDua(vp;(0tltrxociadfm elies s0t2uoimpnu4ole  icsl( aDrru  ;t1ape iieiltfm rl( pnu4alerxr3todopDrau s t)seumir3ny4ape mnet ()a2rmxro;u1apeomfeiytfa uluvs;(4altnxr ty1omD aieil(0t2ur(opou4omtn nes (fsDum(rp;t4teeoifcias s2ulu on(0 exrxrctydopD lies;() ruoim3iydopenmnetat s2rm(r ;t1aex ioetatfsDrl(msnt0tltoif3iadomtelieol() eurirpio4am e iei s)srur(r ;u0aet  iciytfaDulump;u0teenxr3tatomDe nvil( seurio3oy4lme lfctl(fa2taurpnt4tpe ii3iasla rl(vs;(0trxrif3iatoa eluei;t  2xm(opnu4opte ictlt)s2rmxrp;u4teeo fetyslaDrm(mpn()trxoifctatop ranvsls0sexrxm io1amtemneias)a2urxm nu0oetomo3iyt a el( s (4aeenif oa1opDelneo;s
\ No newline at end of file
@@ -0,0 +1 @@
+ivo s t2trimpoodll   ivta(fsrrr(  ;u4alt  i3tadfs2emnvonu)alxoxr todfaDean ol()setmxr oudlle mnvilsf Dumu pnt0opt  oeiatls2uanvs (4texnmr iadla r n s;t0teur(o3ou1aptn iciltfarur(rpoo4apx iicils m2rlu p;(4artoxo3todopDran i;( t2um(o iodamtnlnvslsfs2rr(  ;t4oee  fciatlsDrau ont0 lxrif3tydfp   ieil() etr(o oydaltnlnvtlt)arururp;o4altniieiydfm uaumpnu)treomo3tydlaD  uvs;t trur(m3iu4am   ivta(fsrur( pnt1oetn octlsls2em(vp (0arenmr3ia1oaDrlnvs s0sexmim oydale  nesl( sDtmxmpnt0alt iocias s2ranmp u4aeenmo oa1lmDranei (0 rxrxm no1olt mnvias artm(m nt4opt  ieiytfmDrmump t)aetoxo3iatfp rluei s) euoxmpoo1ol   feil()sDtru o;u0apxn i3ildfm2eluvo (4 ltnio3tydlmDrai i t seumir3oy1aleemiviltf rrmxronu4tlenmieiasls2elumo;t)aetomr tadla elu i (0trxrim io4lp  miciat)sDuru  nu4ope  f3ils sDem( sn(0 exrir iydoaDe u i t0trtm(o3ou1ame miet s) rtrumpno0tpx  feiltfm2rm( o u4trermr oy1fm rlnvols)texmxo io1omenmivtatf rrrx ooo0apxn ietysfa ea( o () rxrmrcoadoa r nvs t0 2tmio3oo4al  lnetltf rum(r nt0aetnmieilslm ea(msn(0artrxo3ia1laDeaivol(  rurio ou4ol  livt s srra( onu0tpx if3iatfmDea(vo;t0 leoircoatlaDean slt0t2tmiopoy1om e ieiatf 2trur ou0texnio3tatfmDemnms;(4teeomf ty1om  livs;s0trxrxopio1apee nesl(f 2rmumpou0aleomocild m2el(mo u4tlxnir3oadlp  anvs;t)teurim3oydamt  ics (faDrmxroou1tee moctysls2uanmo;u0 etrif3iy1lm eauvi;t truoxm iudopeelfei (  2rm(moot0oeto o3tasla2umn o;t0 reomr3oa1lmteai ils)sexoimpno4lle lieils aDrr( o;t4optnioetysfa2uauvo ()arxrxocta1lpD au o;t  rtrirpoo4lmenlfvt (farta(r no1alt ifcilsfsDuauvon(0tetrxrcio1lpt lies t) 2tr(o3no4ap nlnetlsf rtrxmpoo1ale mo3ilt m2ra(vsn(0 rtrir3oa1fm   u ilt s2tmimpoydomt mnetat s2trx o;u1olx moctyslm rmn pnu)trtnxf3iodfpDrli s t srxrxrpoo4lltnmfvilt sDrmumoot0tpeoii3ildfs2emump;(4tlenif iatlaDeauvslt  2xm(opny4altelfes t) 2rm( ooo4tpt mf3ilsfaDuan on()tleoxr ty1lpDe ivol(0setr(m3oudlm  mfvtat)sDrm(m ou1oltoioeiydlmDran s (0 ltrmo oydom eanei s s2xr(m oudomenlivtatfarur(m ;u0olenifctyt sDumumsnu)tetnxf oa1fp e nvo;s0 etmim io4ame lfvtat) Dur(monu0tetoii3iadlm2uan on()trtnxfciotoaDr ueols0setm(o3ny4lmeelncils arrmu p;t1tetn ieias a elnmont0aexoif3iadfpDran s;( tetrio3ny1apt mnesat)s2trxrpou4tlxoifciyd s2rl(mp (4aleoxo iodfp  li s;t0tetm(m3oydal  mics s)artrur oo4tlen ietytfmDua(vs u0tltnmo3ty1fpt ai s;t  2uo(o oodopt  fvi t srrmxm ot4alxomiciad mDeanvsnu)treoxo3oa1fa eanvs;(0t2tmxr3nodame mncsas)srrru ont1teto ieiadla2rm(vs;t)trerif iy1fp eaivs;s sexm(mpio4al nlnci t  2tm(moot1aptoioctltfa2ulnvp;(0aexnxr iy1fp  lnei s0 rto(r iu4alenlics sfsrtmxmpou0aexoiociasfsDrau o;u) lxnmrcoadfp elu i;(0 rxoxr ny4lmenlfetat)a2rrur ;t4olxnif3iytlm2rlnmo;u0 exoifciy1omtr ies;s0 2tmim3iydlpenmivtlsfaDtrxmoot0oeenmi3iaslsDrlnms u0 lxnio3ty1lpt anvslt t2xrxm ou4ale  fci t  rtmxm nu1oeeo ietadfa2umnms ()teeriocoy1lpDr ivils  2urxr3nodapeelictlsfa2raxr no0alx  o3iat mDrmu sn(4texnif3oodopDr ieslt)trxr(m iu4omenlncsasf Durur ;t4tpen f3iyt s2ua(vs t)aeerif3iotfmtelnvol() exmxo io4lpte feiltfa2umxmp;o4altn i3tasfa uauvs;u4 exoio3iodlaDraues;t trtoxopny4ome mnviltfs2rr(m ;u4teeomfetyslm raumsn(0alenio3tytlm  an s t  2urim nydom e icsl(f 2rax o;t0tet  fetatfm2eluvs;t4arxrxr3ta1lat ai i;t teumxr3ou4al   nctls) rraxm nt4alen feiaslmDrm(vo;(4tlerio todopt auvsls0s2xoxr3nu1opt lfvtas)aDrmxro;t4alxn ictltfs rmums u) leoif3ootfpDr u slt0 2xrxrpnodlmenlfcslsfaDrrxm ;o4altn iciasfa2rln o () ltrxr3io1lp r ivs;t0trtm(m3nodlp e ieias a2urxmp;o1olxnmoctld sDumn on(0trtrif3oodopt  u o s0srto(o iodap  livt (fsDurx  ;t4aleoiocias mDrmn s t)texrir3iotoa e uvs;s)t2urim3ou1lm elfeiatf 2uaur ;t0opxoii3iadla2rl(vo t4altrxociotfm   nvo;(0 rxo(r3io1ap   icia()aDrmxmpnu1opxnifctadls2ulnmpn(4tleoxocoatop   ies t s2xoir oodomenlnvtasf rtm( onu0ole iicildfa2uanmo u0trtrif3ta1om raiei;t  rtoxm3iu4alte ietl(fs2rmumooo1opeoifciat m el(mo;u)tetnxf oa1fm eluvsl()srxo(mpno4om nlnvsl(  rtrxmpnu4aeeoifciadfsDrmuvp t0 eeoxf iytla e n s t)t2trxo ny1amen nvs t)a2rrxmp;o1tptnmfciasla uan s;u0 rtoir oo1lpteauvol(0 etrirpoy4ape  nci (f rrrxrpno4tlxomi3iadla2rlnvs (0 ltnxfcia1omDran o t) etmio3nu1optn neslt aDrru oot1tex  fciltls2uau p;(0 eenmr ootfp rlnei;t0t2xoio oo1om emfvi t  2rru  nt0aet mictatfs rl( s;u) ltoif3tadfa e ieo s0texoxo nydlpen fvilt)srumxmoot0oex  oeiad s el(vo ()texrxocta1fpD li o;s0sexmxr oodopee nctl( arrr(m oo0olxnmoetytfmDum( s u0artnxocoatfmD lieo s)seto(o3iudaptnmicsl(  Duaumo;u4aleniocilsls ran pnu4 lermf to1lptrluvo;s s2triopoudlm e ncilsfsruax  ot0tlxo ociltlm2ua(mo;(4treoxf oy1omtr ivi (0trum(mpoydamtemfcsltf 2um(moou4alxnifeild s umnvs u0alenif3oydlatrln ol()trumxmpiydlp nmfvs s) Dtrx o;o0apeomo3iys mDuanmo (0tltrifciy1fpD lues;( seumimpoy1altnmnvsas)a2rr(  ot1alx  oetatls ulnmo;(0trtnir3oatlaDrliei;()s2tr(o iy1optnlicsatfaDtr(m ;o0oeen ieiad s2eau p;u0aeenxf3totlp raivsl(0 2xrxopoo4ol emncslt srta(mo;o1tlxn f3ildls2um( pnu)artoircia1fm eaivs ()srtmxm3oudopenlnvt ()sDrrum ot4tlen fciltlmDul(vont0teeoxocoatlpDeai s (0 eum(o3nudope mict s) rra(m ;o1tpx ifeilsfa2uluvo t0 exrxo3tadfm  au slt srtmim oo1lmtelfvs t sDuaxrooo4opx mietadlm2ulnms u4 etnmrcoodfpDeluvs;( truoxo no4opeelnesatfa2rrxm oo1tptn iciltlaDua(vp;(4 eeoio3iadlp   ivol() 2tmxo ny1ap  lncsl( srrmxmonu0tleo ieiat a2rmnmp;() etrmo3tytfaD  uvs ( trtm(r nydop nlfcs tfaDrrx pou1olt ii3tat a elnvs t) exoxr tydoaD liei;s0 etoxmpiodlmt  icils)aDrm(rpnu1tpx mo3tytfsDem( snt0 lxoio oa1oa   ueils0 exoim oudopeelicilt  rtr(m oo0tltomoetadla2umnvo t) rxrxfciodoatranvi s  2trxm oudapenmnvi () rrr(mpou0aleomo3iltlmDeanvp;t)tltoifcoadfmt ai o;(0 exmio3iy1lp emncsat) 2tru o;o0aexnmfciasls2emu o (4teeoxo totfa eaieo;t srtmimpoy4ol  mnctlsf Dtaumpnt0texn i3iysla em( s u0artoxociytlmD  nei t setoxo nodapeelictls) rtmxmo;o0oexo o3iyd aDulnmon(0 lxoxoctotopDr ivo;s)srtr(opiydome livta() 2ua(  oo0tlxnioctlsla2uln snt)trerxo ia1op   u ol()srur(m3ou4lm nmieil(farra(monu0tex ioetad sDea( s t4tlxnxfciytoateauvols)trxoir3nu4ole mneia()sDuau  ;u1olx iietysls ran s;t) exoxo totfat ln o (0s2urxm3nodom n fvtlt) 2tax poo1ope ifctlt a2rmnvont4aeeoifctatlmtr ueo ()tetmim iydll  lnctas)srumurooo1opx  ociyslmDel( o u)arxoxrctydlmDeluei (0sexrxmpny4apenlivs t)arur(rpou0ope ifeilsls2ulumpnu4 rxomf3iydoa   uvslt0srtoir3oo1open nci s)srtaxro;u0oex if3iydlsDul(vsn(4 eermr todlmD  iesls  ruoxopiydomtnliet tfa2rr( p;t4tle mietadfm2ra(vsnt0aetrmocoa1fpD lueo t0 2urxr oudll elnciatf Dumxr oo1apto ietaslm2el(mpn(4alenmr3ia1lm   ueols srxrxr no1ap e fcils  Dumxmp;t1aetnmo3iysla rlnvs;t4aleomo oo1fa  au s s  exm(opoudomtemfcil( s2rrxrp;t1opxnmiciydla rlnvont)arxnir iotlpD  ueo;s)s2xmxo ou4lltn fcils artaxmo;u0oltniociys s raump u) rtrmf iy1opteli s s0 rto(opiydaleelnvsl(f 2tmu pnu1oeen fciad aDrau o;u0tlxrmfcoatfaDrai slt)s2urxmpiy4altemics sfarraumoou0ale  f3iasfa2uln s;t)aexomociotlp  lieo;t  rxmir oo1lp emnetl( arrr( ont4aeeomieiydlm2elumo;t)alermf3totfaD  ieo t) 2umio3oo4lm n ivs tfsDurxmpot1aex moctatfs2rlnmsn(0texnmr3ia1opDrli sl( srxmirpio4lp emfvs (fsDumxrpou1teto o3tldlsDeanms (4tltrio3oy1fa r u s;t)texmxopoo1lm  mfctl() 2tmur nu0aeenio3iytlm ulu o;(0trtnxo3oatlmDeanvols t2urim3iudape mfet sf 2tmum ;u1tetomociysfsDean p;t0 lxoxfcto1latraieslt)srxrirpny4ol elnci t)aDua( p;t4tpxo f3tysfaDuluvo u) eeomr3todfm eaieil() rtm(o3oo4op nlies t sDtrumoot1opx moeildls2eluvpnt0aetrir3totfaD  i il( tetoir3oudlleemfvtl() ruaxmooo1apx io3tys a2rln p;u) etrmo ootfpDrlueo t texr(mpny1lmtn nvtat sDtmu  ;t4tltoii3tltla eanvpnu0 rxrmf3oytopDeaivi s) exrim3nudoleemnes ()artru ono0alx iieiltlsDeluvo t4altrmf3iy1op e nes t)srxrio iodal   ncilt)s2urx ono0tpeniieiysfm2rm(ms t4aexoifcootoaD lu slt)texoirpiy4al   nesasfs2rrxm ;o4apeoii3tyt aDelums u) ltoxfcto1lp  lueil() 2to(opoudlleelfetlt srraurp;o1tet mi3tldlsDelnmp;t0 lenxo oy1lm e ivi;t trxoxr oy4om elfcta()a2umur nt1aptn ietytlmDrm(vpnt4artnio oytlm e i i;( s2tmir oudlmtelnct tfsDtmx pou1tetomietadfmDea( s;t4tltrmo3tatop  aieils)sexmxr3iu4llenlfviasfa2rr(rpoo1tpxnmfeiytfs2um( sn(4tlenir3to1lmD livol( t2xoim3iydolen fctasfs2ua(m ;t0tpt iociltla rauvs t)texrxfcty1lmDraieols)seumxo3iodlp  lfvil(f Duaumonu1teen icilt s ul(vsn(4 exnirciytom elieo t) 2xoxo3nudlltnlfcils s2tmumpnt4tetnioeilsfa2uanmp;t4texoxo3to1om   ivi s0teurxopnu4oleelieilt)aDra(  ;t1aex  oetadfa2ul(vp u0aetrmr3oo1lmDranvol()seurxm3iy1olt mivsatfsDra( ont4tlx ioeiaslm rm(vs (0tlxoio3oodop  aivi t sexm(o3ou4alenlfeiatf 2raumo;o1aptomf3iadla umu s t0treoxo3totfm  lnes s s2tmio3iu4am nlivsat)sruaxmono0tleo feiyslm2ul( snt4tetnmr oodfat auesls0sexoxr3oodlmtemnciat)sDraxmpou0opx iocilt sDrmump t0trerio oa1latrlivi;t) 2xoio iy4am emivtls s2tr(  ;u1tptnioctydlm2ulnvpnu4aeeoxf3iytla rli s;t texo(opno4lptemncia( aDtrur ot4ole  oetatlm2rauvo;t) exrmf oa1fm   uvi;t0 2urim3oy4llee fcil( a2umurpou0tle iociytfa ran o;(0teenxr iydfm raueslt  rumir3iu4al  mfvs t)arta(  oo0opxn ietls m uln s t0tltoxrciy1lpDe nvs t0 eurxo oy4lp e ncia(faDumu ont4aptn ietas mDumnvs;(4 leoio3iadomt  uvo (  eumio3no1altn fvt t sDrauro;t4opxnmiciatlm2rm(von(0tleoxr iodfpteaiesl( s2umxo3io4lm e iet s) Drrxrpnt4olenioeiyt s2umu s;t) exrmo3oatlmtraues t s2tmxr oy1lpt mietl(fsrtmx oot4tptn ieiatla rlnmo;() ltnmrciydfpDean o;(0 2tm(r ou1lp nlncia(  2taur oo4tpenmociydfs ua(mpnt0altnio to1omtraivi s)sexo(r3io4olee ncils)srumuro;o0alt  iciltlmDrluvo t0 lenxo3oodfpD ln o;( srur(opoy4amtn fvt (faDumu pou1oee  ociatla2uanvo;(0tlxoifctatopt an s;t  eur(mpno1lm e ietat)artm(m no4teen f3ildfs2rauvp ()tltnxo oodfmD auvi;t srtoiopio1lmtemicil( srtrxm ou0aexo ociad s2uluvo;u0alxnxr3tydomD anes;t)tetm(o3oy1ap emici sfarururoot1aexoio3iad a2rmnms ()texoxr tatfmDr i o ()trtm(rpio1lpenmnvtas s2uaxm no4teeoiietysfs raumsnu4artrir3iodfaD luei (0tetmimpoy1lmenmicsa()arta( ont4aexo iciat aDranmp t0aeerxf3oodoa eaieo t0trum(r iu4ol   nvs tfa2rrxrp;o0aetomietat a2ea(mp;t0 lenxf3oodoatelivo t0t2xoir ny1ol emfet t)aDtruro;u4oleomoctyt s eau snu0 ltnif to1fpDr ues;t0trtr(mpiy1lp nlics s s2um(rpnu1tle  icias s2el( onu) lenmocia1laDe uvil()srtrim3nu1lltnlncils sDrmxrpoo0tlto ocildlm rlumo;u0alerxr iodfa elivilt0 rurxo oo1lmeemivi (f rtrxr nt0texoiociadls2ua(vp t)aexoxrctadfptr n o;(0srtm(m oudomtn fetatfsDumur ou0ape micilt mDemnvs t4 rxnmrcio1lpD luei t) rxm(r3no4lp elivsl( a2ua(rp;o1alto ieiydfaDum(vonu0tlermrctodfp rlu o t0 rtmxo nudom nmiesasfs2trurp;u0teeo i3iyslmDuan s;()altrmf3iy1fm eauvo t)tetrxmpiydolt livi s arrrxmono1oleo i3iysfa2umuvp ()artnxr iydlp ean ils trxm(o iudlp nmnvilt  2urxm ;t0tlxnmietyd s em(mp u)teeoxf ta1lptrli s (  exm(m iudllt livilsfs2ur(  no0oetn i3iyslm eau o;u0arerir3tadom rlivo;t) 2xoxr ny4am nlici ( arumumpnu4tex ifcias a2rm(ms;u0 lenxoctatfa r ues;t)tetm(r3nu1lpe mict s srum(rpoo4opxnifeiydls ulnmo;()teenio todlp rlivi;t)s2xr(mpiodllt lfei t) rrrum ;t0apeoioeiytlmDrlnvs t4trxoif3oa1lp raivs;t)t2xmxo3nydomee fcsl(fsrtaum ou0aexnif3tltla eln pnt4aeerir oytfateluvil()t2ur(r oy1llt  iei sfarua( pnu4olenmieilslmDel(ms;t4aeenio3oodfpD  ieolt seumxm3oy1lmtemfesat) Duaum nt0oltnmf3tatlsDuauvp ()altoxfcoytoa eauvslt0trtrxopio1optnlfvt (fsrua(moot0oleo ociasfa elnmp (4 rxnmr oadoaDr ies;t0 rtoio3iudape mieta
\ No newline at end of file
@@ -0,0 +1 @@
+i i t) etoim no1lp  lnes sf rrmx oot1tlen fctasfaDul( pn() rermocoatlpte u s;s)s2xmxmpoo1lle lneilt arraump;t1aptomfeiadfa2uan s;u4artoxocoodla r nei (0srxrimpoy4aptn iesa(  rtmxmp;u1opto ociat m ulu p (4tetnio3to1op e u sls)tetrxmpnudlltnlnct sfaDuaxrp;o1oltnmfciatls2eau s;t)arerio3iadfmtr ues;s)s2um(o oy4omtnlnvtl( aDraxroot1alxoiiciasfs uau p t) lxoxocoadlm e ivo s0srum(m3oy4am  lfcs () Dum(m ;o4alto ieiatls uau o t0treoif3oy1om elneo (  etmim3iu1op emics s)sDurx oot1alx  octlsfaDeanmon()artoifciodfmDraieo;s  rtrim3iu4al elfcsa(fa2rauront1aetnii3iydls umuvp;t0arenio tatomD aieo t s2xmxopnydll n fct ()srtr(ront1aleomi3iat s2ul( o;t4tlxoxf3tydfpD aivi s0 2um(mpiy1lltelfvias  rra(r ;o1tet  oeiltfm2rauvsn(0 ltrmo iadlmDe uvols srxm(r3iy1al emnei (faDtmurooo1tex  feils aDrlnvo u4alermr oydlptr ivi t0srur(opoydal   nvias  rraurpnt0alx miciadfsDea( o;u4trtrmf3oytoaD aies;(  rtoio3iy4ole  ics sfa2umumpnt4tex mfeiydfm emump u)aeerxr3iatom r ueo;t teuoxm no4ll elnesa(f Drm(m ;u4ole micildlm eaumonu) reomfcto1lp  luvilt  rxo(m3oo4lm   netls)s2umurpot1oexo fciydla ea(mp;u)aexrio iadoa e ies;s)t2ur(r3iy1al nlncsl( a2tauront1opeo i3iydfs2ra(vp t)treoif todla   ivo ()sexmxm iu4lpenlieil(fa2tmxmpnu4tpeomfeild m rmn sn(4teermf to1fmDrai o;( trxmxo3nu4lm  lnvslt aDua(m no1olt  f3tysfaDuau o;(4aeermo ootopteanei s0 ruoxm no4ap e fcsl()sDtau pot4apx if3ild s2umnvo u4 lxoxo iotopD  ivi;t srxmir no1olte neiat) rtau  ;t0olxomo3iatlaDrln o (4tleomo3iydfaDeanvo s0sexrimpno4ame mfvtls s2uaxmo;u4aptnmfetytfs2em(msnu4arerir ia1lm   ueo ( srxo(o3iydlpt mivi sf ruaumpot4tpenmietld m2ulnvon()arxrmf ty1op  ln o s)trxoirpiydamenmfctl()s2umxm nu1teen o3iydlsDel( snt4 lermo3ia1fp eauvi ( trtoxm nydope miesl(fs2ra(rpoo0optomfciyt s2rl(mo;u4tlxoir iy1om ean ilt0srxo(o3iydlp emivtl(  Drau  nu4tptomf3ildfsDraump;u0 exrxf3iydlp  ln i;t0tetrxo3nudol nmfvtltfaruaur ot1ope  octytlmDuluvo;(0trxoif oydfatr uesl(0 rtrxm3iy4optemneils)s2uaum nt4aeeo i3ils sDemnmp;u0tlxoiociy1oa eaivs t) rumio iodll  lietls a2tmurpno0oeeoiocilsla2emnmp;t0altrif3oadlaDrlueo s0 etr(r nu1olenlnvs ( aDumumont4aee if3iadfsDea(von(4tltnxf todoat  u s s texmio3nydoltnmncs () 2rax pnt4ape  feildlm2ua(mp u4trtrif3to1fmt lnvs;(0s2um(mpnydamt miesat  2ua(mo;o0olxoioctys sDea(ms;t0tetnio3ty1lpDrau o;( teur(o3io4open ncta() rtaxront1tpx  icilsfa2uaumpn(0 ltrxr3to1omD  ueo t s2trio3oudlme lneiat)aDtmurp;t0tee ifeiadfa umnmpnt0 rtoxr3ootfpDraneo s)tetrxrpiu1optnliesltfartrur ;o4olto fcildfmDuaumonu4 lxomo3iatfa r ues;t  rtmxm iydalt mfeslt)a2tr( p;u4aeeomf3ildla ea(vpn(0 lxrxo3tydlmD auvo;( tetr(r3nydolen fvtl( aDtr(mpnt1teeoiocilt mDrl(mo u4texrxr3tatfaDr ues;() 2urxr ny1omtnlfvsl( srrmuronu4tpt ifctyd m2umu s u4 rxrio iy1oa  lieo t texo(opoo1lptnmnesl()s2uau  no4apx mfetatfsDel(vp;t)tlerxfcoadlat aies;t)s2tmim oy4llt  fes sfarrmum ou0aeeo oetatfmDemnmo (0alenifctodlaD  uei;s)t2xm(opiydal  micil()s2rmxr oo4oex ii3tyt aDrauvont) lxoif oo1oa  luei;( trur(mpio1olee fetlsfsDtmu ont4aex ifctldla ranms ()tetoxr oydfaD liei ( t2umxo iudope lnctas)srum( pno4aexomfeiltfaDrmnmo u)teeomociotfp   uvol(0t2tm(opoy4ameemfvtls srtm( o;u0tpxnioeiysfs rl( s u) lxoif iadlpt aueo;(0 rtrir3no4opt livsat)srur(moot1apxo fetlt m umu o t0artnxfcio1fmDe u olt0t2tmio3iy4lptnmncsa(  rrrx  ou4altnioetyt a rm( s;()alxomo oo1lm elneils0 eumxo3ny1lm emfvsa(  Dua( ooo1aeeomo3iadfaDulu p;u4 rxomrctydfmDrli sl() 2tr(mpou4ll elnvias) Dtmxrono4oetomieiasfmDeaump t)artrxfctytfatrauvo;s  etrim iu1openmfesltf Drm(rooo1teeoifciydls2um(mon() reoxf totfat au i t  exmir3nodom  livtat) 2tmurp;t4opeo ictatfm ul( onu)altrxf ty1fa r ivi;t)srxoxopoydlptn ietas srua(root0opx  i3tydla elumon(4alerif3io1fa eanvi ( seurimpoo4lp e ictlsfsrrru poo4tetnif3ilt s2elnmpnt0 ltrmo io1op   u o;s)trur(o3nu1om e nvi s  rumu ooo1aptomfcils m2em(mp;u0 etoio3tadlm rai o;s)t2xoxo3ny1omtn nctl(  Drax o;o1olx ifetytfaDrmn snu4aetrifciodoptean ilt teumio oydlm e nes ()aDtaurp;u4olt  f3iytla2ea(vp ()aexnioctadopteai slt t2trir oodapt lieiasfsDraxrpou1aet micilslaDra(mo;t)trtnxfctotfpDraies s tetoxopoodam   nvsas sDta( pno0tex iocilsfs2eanmon(0aetoio3oydop elivs;t truoxr3iu1apenmfvt s)aDtmu poo4tex  oetyslm uanmonu0alenmo iodomtr ivslt) etmimpiu1lmt lictls) Dtrx poo1aexnmfcild mDel(ms u) rxnmf3tytomDrau o t  rtm(m3oodol n nesat sDtru pou4tpxn f3tltlmDumuvsnu0arxrio3tytomte ivi;s)s2xoir3iy4alee fci ( sDrau p;o0tpxoioetydfa el( p (0 lxnir3iydoaDelies t0 rumxo3oudllt lncsls)s2rax pnt0opeomictad m el(mo u0 leoif3tytlp elieo ( seuoirpiudop nlneias srumum ;u4olxnii3tyd aDrln p;u4 rtrir ia1omtrau i t)setr(opiydap elnvi ()artrxmo;o4tpto o3iyd m eaumont) etnxo iotfa   i o;() 2urxo iy1amtnmfvsl()aDuauro;o4tlxnifetysfs ranmon() rxoiocoo1fptelneol(0t2xmxmpny1op  mfvt s arumxmoot4oeenioeiytfmDeaums u4tltnmr3oo1fmDraneslt0 rtr(o io4lm e nvs t)s2uaumpoo0tpxniociltfa2um( p;u)teerxrctatomD ai o;t) rumimpiy1lmt mfei s) Draxmono1tpxo f3tltlsDum(ms;t0tetomfcio1op rlivils)teuo(opnudamtelivt (  2taxm oo0aeeniieiysla2ean p u)trxrxo ty1lmt anvi;s sexmxr ny1lpt  ici s) Dtau pou0aeeo ictatlm2emnmp (0 rxoio3oydoaD aieo;()s2uoim ou1lme  netatfaDtru  no0oee  oeildfsDuau p;(0 rtrifcoodlpDr i i;()trxo(m no1lpte fet tf Dtm(mpnt4tex iietlsfm2rm(ms;(4altomr tadomD  n ilt)s2xm(o iodame mfcs ()s2trum oo1tlxn iciatfs2em( s;()altrxocia1lm eluvs;s)teumxmpiy1olen fctlt  2rmur ;u4tpx if3iadlm2uau o t0arxrmrcto1fa   u i () exoio3oodam emicta(  Dtm(ro;u0aexoii3iadlmDel( s t4 etomfcto1lpD aieil(0 rxmim3iu1ameelfctl( a2ta(rpnt4tleniieilsfsDrmnms;(4 rerio3oadfa   uei;s  eurxmpnu1amen fetlt a2rrx pnu1optn f3iaslmDrln o u4aeenmociydlptelivo () 2xoxmpio1lme livt ( s2trxro;u4ape mo3ildfa umums;u4tetoxoctytfp  aneilt  exr(rpoo1al emfct s)sDrrxro;u1oexomicilt sDrmuvs;t0altniocto1fm eanvilt0 eurio3iy1lp  mnvsl(  Dtr(mpoo0aex mo3iydlmDranvs (4 lxnio3tydfa  ai i ()tetmimpno1om  mici sfsrta(  ou1opt ioctls s eau s;()altrio3oydomt au il( sruo(rpno4amtnmfcs tfsDurx ono4olx  f3tls a rm( o (4 rtnmocoo1lmt  u o;()sexoxo3no4am emiet sf Dua(  nu0ole  o3iysls2elnmp () eenmr3iytoateaueo;s  eurim iy1al emnetl()artru p;t4oetomoetyd a rln o u0 exnioctodlpD
\ No newline at end of file
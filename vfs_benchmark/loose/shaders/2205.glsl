@@ -0,0 +1 @@
+nvolt0 2to(m3no1apte nes sfa2taxmoou1oex if3iatls2ul( p u)tetnxo3oatla   u ilt0t2xm(opno4omee ivil()sDumumoou4ape mo3iyd s2rm(msnu0alxnxo todfmD luvo;s0 2tm(o3no4am nmfcsatf Dumxmp;u1aetn f3iadls uln ont)altrmoctodopt li s;s0 rxoxo3io4ope  fvsatfsDur(rpno4oltnmfeiytfa ran s;(4trtoxr tydoa e uvi;s)t2uoxr ny1lptnlnvs (f rtauroou1oltomo3ilsfaDrm(vsnt0tlermo iodfateai ilt)t2tmiopny4lleelneilsfs2umu onu0aptn ieilsfa2eln p u4 lxrxf3ty1oa eai s;t seumirpiodlleelncsls) 2rmx poo0ole  o3tyt m uluvs ()areomo ty1opD aivo;t)trum(opoo4opee fvsas  rraxmono0altnmfeiytls rmn s;u) etnifcta1op eaueils texo(r oy1ome  fvtas sDumumoot0tleo f3iysfm rmnmp;() exoxfcoa1fm e uvi;s seumxm3iodape mnesl()srrmur oo1oeeniiciytfsDelnvonu0 lenxr oatoaDe i sls) ruo(o ny4alt mfvtatfaDrax pno4opto ictydla rm(vs t0 ltnir tytfmDr u i;s0tetrio iy4am   iei t)aDtau  ;t4texomi3tldls2uan onu4trxnir3iytfpt li ilt0srtrxr3nydamtnmfci t  2umumo;t0aexo fctltfs rmnmo t4tltrmf3oatlate n s (0t2triopnodalt mnvsltfarrr(r nt1tlenifcias m2rl(mp u) lxoif oadfmDr nes;t trxr(m oy4lltemfcslt a2tm(mpnu0apt ioctysfa2ua( s u0aeenxf to1fm  ln i ( t2tr(r3iydope mnes sfaDurxroou0opxniietltlm2ulumon(4tetrmrcoatlp ran il(0srtr(opiudap  lfcilsfaDtm(ro;t4tleomicildla eluvo;(4alxoxr iy1lp e i s t0sexo(r ou4omeelncs tf 2ur(  nt1olxn i3iydfaDranms;(4aleriocoo1laD  u i;(0trurxrpiudom e feta()srtru pou4texoifeiadfa ul(vsnt) exniocoodlm e i s t  2urxm iydllen ietltf Durxro;t0alt ii3tlsfm2rl(ms () rermrcoydlpDeaueolt  eto(o3oo1omen nci tf rtau  ;t4tlxnif3tas mDrm(monu0 rtnmfcia1la elneo;()trxrxopoo4lm e fvt t) 2rrum ot4aex mfctytlsDrmn p;()tlenif3ia1lmtr n ils) etoxm3oodoltn nci s  rtrx ont4teeoiociltfs ea(vonu)aexnio iotop raivol( srum(rpoy4opt lneia()s2umur ;o4oleoifciaslm umums t0 rxrio tadlaDr ies;(0t2toio no4amen fct sfs2tm(  ;o4tpxn i3tadlm eanmpnu4aexrio ta1fpDr n o;( trtoio3iu1amenmfesa( artrxr oo1olen ieiyd sDrmu sn()artrmo3ootlm  anvo;(0srxo(mpnu4optn ncil(faDrrurpno0texn i3iysfa rlnms;(4tlxrir3iytlpD li s (0s2ur(r io1altnlnet tfsDra( ono1ope mfeiytfsDel(msnt0 lxoif3ootlmteaiesls0srxmio iodaptemfvsas s2tr(ro;o0alx ifctldfa emnms;t0arerxo3oa1fmDraueo;s srxrxrpou1lpe mici t aDtrxm oo1texnmoeilsfaDeluvp;t4aleoxr3iy1lmteaneo;t0sexoxrpoydlpte nvtl() 2urxm ou0oltnif3iyt m ra(mp u4tlxrirciotfptran slt srum(r nudlltelnvtltf rur( p;t0aetnmo3iltfsDemn s;()tleoifcoatlpD  nvs;s)tetmiopny1apte fet t  rtrxr nu0tltnii3iytls2uaumo;()arermf3iodomtrai sls0srxm(m3nydolee fesa( a2rmu  ;t4olxomociad s emn s;(4 renxo oadfmD  ueols)trtmiopoo4ll n fvi tfsrtmurono4tlx mi3taslsDrmums;(4texoir tatopDr nesls  rxoxopnydoptn ncil()aDtaur ot0aexomfeiydls2em(mp (4teeomrcio1faD ai o;t0 2uoxmpio4ap   nvi ()srrru p;t0aptomieiad a2emuvsnu4tlxoxo iatfpDelu olt)tetmirpnu1ol elnvsatfsrtr(  ;u1oet iiciysla ean s u0aexrmrciatlm r nesl(0s2urir oy4om nmfvtasfsrtmxmono0apenmf3iyt mDulumonu)tetrmo oadfat lnvi s  2trxo3io4ol nmietat s2ua(mo;t0aptoiociyt a2rl( p;(0 eenxr3iadfmD lieolt)seum(o iodoleemfcsat) 2rrxmpoo4optniocils sDemuvp (4arenir oydfaDrln s s trtoim ny4omeemnvtat) Durxro;o1aee  f3tlt a rau o u4trxrirciy1lmteanvi t texoxo nydol n ivt t)srtr( p;u4alx mociasfs uan o (0tleomo3oydlatr nvi t0t2trir3iy1ameemfctlsfarra(ronu0tee  o3tat a ulu p t4aetnir3oy1lm   ivi;t0 2umio oo1lle livs ( a2rr(r ot4oex  ietls mDumnvo u)tltoxf iy1fpDeln s;( trur(r oy4lpe lncsa(  Dtm(mp;u4aeeo f3iltls2rmu s (4tleomf iydfa e ueo s) rxoirpiu4apt lfesa(fsrurx  no1openifctytlsDelnmonu)artnxocoo1lpt au slt0srumirpio4apee nvsl(farurumo;o1openio3tat a2elu sn(0aexoxo3ootopD lieo;s0 2uoxo3no4lmeelnvi ()srtau  ;o4oeen o3tltfa ua( s;(0trxnxfciytfmteaies (0 2to(m io1lpeemfvilsf 2rm(mpnt0tpxo oetyt mDemn s (4tltrxo3oydlptelu sl( t2tm(r iodop nlnciat)s2rrx  ;t1ape io3tasla2rlumon() rxrmr oadfaD  nvs;( srxmir iodlp elictlsfsDrm(rp;u4ale  o3ilsfm uluvo;u)teeoio3iodomtean s t)trurxopoodapt  fei sfaDua(rpno4oeen feiltfaDeanmpn(4 lerxr3iydfaDraivs s sexm(r3nudlpeemicias) rurxr ;t4tpt mfetltls ul( o t)aeenmo iadfa eaiei s)trxoxrpno1al emfetls) Dtrurp;o1oleo fctys s emuvp (0trtomo tatfpD  ivil(0texrir3oudlpt  ivs (fsDrmu pou1alt mieils a2el( ont4aexnifctatlmDeaivi s  exriopnu4al nmfci sf 2rrxr ;u0alxniictytfsDrmn on(0 leomr3ta1fat an s;(0 euoir oodolt mivslt  rurx ono0ale if3tad s elumo;t4aexrxf3todfa eaivo t)s2tmxopnu4lptn nci () rraurpou4aleomf3iyslsDel(vs;u0alxrmr ty1omte nvolt0t2urirpoodoltemnetl( a2taxr oo4altn oeiytfsDemn p t) exnir iytla elnvo s0srxm(opno1al   ictls  Drrxm nu4tex  i3ias s ulnmp t0tetrio tydlat aivi t) 2xr(r ou1op nmfetat) rtr( pnu1apt if3ild s2rluvpnt)tlxrxocio1omtelnesl( tetoxm oudameemfvsl()arumuront1aexoifciys a2ean o;u) eeoifcootlaDranesls)trxmxm iu4amen ncsls)a2rrxronu4opxomf3ilsls rlumsnu0 lenxo iadoa rln i;s s2to(m3iy4ap nlnctas) 2tau  ;t0oetnmfeiad m2uan s (4trxoxf3ta1optran o (0trxmxmpno1om n ictls sDrrurpno1oltomfeiys m em(vo (0trxomr3io1fpDe neo s0setrimpno1ol  mncsl(f Drrxmp;o4opt iocildlm2ul(vonu0alxrxo iydop e neo (0 etmio oy1lpe  fes s arua(mo;t1oetnioctysfm rauvonu4arxoxrcty1lpte ivo t0 exmim3oy1am n nvsat aDtau pno1opxomieiltfa2umu s;()treoxocia1omDraivi;() exr(mpoy4llen icsl(farrmu  ot1opxoif3iytfm elnmont0 etnxr oa1om raies t0 2uo(o3io4am elfvi tf 2ta( ont0ale  i3iytlm2umnmsnu0 rxoif ty1fmt  ivslt tetoxo3iu4lme  nct sfaDua(moot0tpt ii3tysfaDum(vonu)arxnmocoydfmDr ivilt)s2uoiopiu1alee netlt)aDumxm nt0aeeoif3tas mDrm( pn(4 rxrxr ia1lmD  uvols)tetm(m3oodapt lfviatf Dum(  ;t1tpx iietlsls2rlnvs t0trxrxo3oytlmDr u o ()sexo(o ou4om emnciat sDraxmoot0tex ifeiytfm el(vpn(4texnif todomt liei;t)s2umio nu1alt lnes t)aDur( p;o4olt  o3tydlmDelump u) ltrif iytlmtrluvil(0s2urio3iudol emiet () 2ra(mp;u1aetniocildlsDuaump t0tlenio3iytom  auvil()t2xrio iudape livtas) ruaumpno0tptnio3ilslmDum(mp u)teenxf iytom eaneil( seurir ou1omenlict ( sDumump;u0alxn octys mDemu pnu4 rtrxr oatfmte i ilt  exoiopnu4lm  mnvi sfartau pnu1olt if3iysla2rmumon()texnxr iydlmD ai i;s0t2xmxr ou1omeemfeils srua(m ;o1tpenmoctat m rmnvp (4 etomr iotfaDe ivs;s texoxmpoy4apt lfcs s aDra( oot1tpxo oeiys a emnmo;u0teeomo ootlm ran olt)texr(mpoydom  micsat) 2um(moot0aet mf3tlt m uanms t4alxomr iodomt  nes t0trtoim iodap  lfvtlt a2trxroou4aexoifeiadfm ea(ms u)trxomo iadoaDrai s s s2toxm3iodlpt  fvslsf rtrur oo1apxomiciysfa2eluvont) reoxr iytfmDelivils t2toxr ny4lpeelfvtltf 2urxrpot1oexnmoeiyt s2ul(vp;u4aleomf3ia1fpteauvs;() 2urim3ny1llt lfvtls aDumxro;o0oexoioeiys m ra(vpn(0 lenmo3io1faDrai olt) 2ur(r io4lp n nct ( sDtrxr ot4oetnmfctld a ul( s u)aetrmo3iytlp eauvs s srxo(r3io1llt mnvia(faDtrx onu0tpeo ieiat aDrmums;(4arxnmociy1lmt aueolt t2uo(m nu4lptelnetlt srtr( p;o0oexoifcildls ran onu0areomr3oo1opDe nei s0seto(rpnodaltnlivsa( sDtm(m nu1aexomi3ildfs ranms u0aexniociotoaDelnvo ()tetoirpny4opeemictlt) 2rrurpnt0olxo fcilslmDelnmsnu) renif3ia1la eln o ( sexmxrpnodopte ivs s aDrmumont0opxnio3tyt m eanvs;t4tetrif3ootfaDeanvo;t0seto(o3ny4lmee nes (fs2uaxm ;o1tpxoioeils sDrmnmp u0 rtomo iodfp  lnei;s0 exoir3iy4am elfvtas sDur(m ;o1tptomfcias m2rmnmp (0 lxoif oytfptrlivsl( sruo(rpiy1olenmieiat)sDtaurpot4tee mfeilsfm2elnmo;u)aeerxr3tatfmtrluvs;s seuoiopiydale mfeias)s2tmx oot1oex micils s em( s u) etoio iotomt anvs;t srxrimpoodal   ncsas s2ua( poo1tltniieilsfa uln o (4tetrmfctatlp r ueolt0 rtr(o no1ap emictas)aDurx ooo1aexomiciytfm2umuvs (0 exrmocia1fm rlneil()t2xr(r nodome  ies s) Dtrurp;o1aet mfetatfa ranvs;t4alxoxr3tadlm eluvo ()trtoxm3ou4lltemfcsas) 2tr(mpot0ole  i3iysfa2elnmo;u)alxnmr tytomDran s t0trurim ny4al   iesa(  rra(mont0optnmi3tlt sDrlnmp t0tetnxf3oydopDelnei;s t2xoxrpou4op n nes t) rtaxm ;t4aet mi3tadfm rmnvpn()aetrif oytfaDraies;( t2trxrpnudopeemnes ()srumxmonu0tltomo3iytfm2rmu s t4 rxnmrcto1oaDraivo;t)srtr(opoydoptemfct (  Dtmuro;o1tpe mfetlsfa rl(vp;u4tltnxr oodopte uvi s srxr(mpiodolt lnetl(f Dtmu  oo1aexnmfctysfm el( p t0trenir tydfaD  uvols  2xr(m3no4omtn fct s) 2ta(rpno0alt ifciydls2rlumon(4 renio3oytfmDeai olt0 eurxm iu4ame miesatfarrm(monu4tetn fciysfm2rmnvsnt4tetnmocoy1fmDr uvs (  rumxr3ou1al emivslt aDumu  ot0tpt  ociysfaDel(mo (4trxoifctadoaDr ieo;s srtr(r nu1llenmneias)arumxr ou0oex iieiadla uanms t0 leomf3tadlaD luvs s t2xmxrpoo4open neslsfsDtmumono4oeto i3iytfmDra(vpnt4tlxrmf3oytoatelnvs s) etr(mpiodlmenmicslt arur(r ;o0alenmoctadlaDul(vp t) reomrciatlp eai il(0s2tmio3ny1om nmfvt s)aDrruro;t1oltnmoctasfm raums t)arxomo oatfpD  uei t trumxopnydamenlies s aDuaxmpoo4alx mieiytlaDulnmo (4tltnmo ootfpDeli ils0seuoxo ou1apee ncsas)a2tmx o;o1tlxnmoctysfa2umu s t0treoircoytfp   ivo;s0srtoxo iydlmenlneslt s2ra(mp;t1oee  f3iasla el(mo;t0 rerif3oo1fpD lueo t trxm(o3iydopenmfvsat  2rmxm no0tpx ifeils s rlnvs u4arxrmo tatoa raneo;t  2xrio ny4lptnmfvtl(fsDuaxm no4tlenmo3tasfs2eau o;(0trtnir3oatlmDelueolt  2tm(m oudame  icsls)sDrr( onu1apxnmiciatfs2rm(mo;(4 eeoio iotoateai i t  2xrir oo4lmen fetas a2rmurpnt4olxn ociatfa2rlnvs;t0 eeoir3iy1op e n ols)sruoir oudomenlnvt t) 2rmxrpnu4alxomfeilsfa2eluvs t0tlxnir3to1faD  u o;t)setm(opiodop  livils s2umump;t4oetoio3ilsls2ul( on(0teeomf3to1oaDeluvs;()texmir3ny4omenmfctasf 2urum ;u1oet  ietyt s2elnvpnu0tlenir ty1fpt  nvs ( setmxr3ou1am nmncsl() Dtrx poo0optn oetatfa elnvp t0 ltnxociytfp  anvol(  eur(o nydapenmncslt) 2rrxro;t1oex  oeildlmDrauvp u4artoif3iotoptrlnvs;t  2um(rpnydomtnlivtls aDurxmp;u0olt ioetasla2rau s t0aetrxo ia1omt  iei t) etriopiy4am nlnvs s) 2tm(mp;t0oex iociys m em( snu0 leomocia1faD lieo (0trumiopny4omtnlietls)aruax pot0altomoctldla ul(vs;(4tlerxf3oadfmtr uvi;s)seuoxr3iu4lptemncs t)s2rrx oot4alenmociasla2umnvo;t0 lxnxfctadfaD  ivilt)t2urxo oo1opte fct (  2tr(moou4alt ioctld aDelumpnt0tetomo totla   ivil(  etr(r nydlme mfvi (farrmurp;u0tpxomi3iasfs2uan p;(4tetoif tytoa   neol(0srtrxmpoo1ll nmnvils sDurxmp;u4aexoiocils s elnvo;t0texrmr3oadlmtraivs (0s2umxm no4opte ici t  rtaumpot0oexnii3iytla rlnmpnu0 rtrxf tytlptrluvilt sexmxm oy1lmte ivs t aDrm(m ou0apt  ietls s2rm( pnu0 rxrif3iytop eaivi s0texr(mpoy4lm nmfct (fa2raxr ;u0tpxnmi3ils a ea(vs t) rxnmoctotoa e nes;t0s2xr(o3iu4altemncsa( a2rmx ooo1alenioctlsla umuvo t4 rxoxo iadlmte nvs;() etmxr nu4amtn fci ( s2taxrp;u4opx mf3tltfs2emuvp t)tlxnio3totlpt aueslt t2xoxr ny1amen ics (  2uaxm no4tptomf3ildla2rm(mpnt) reomociytoa elnes s)srtoxo3oo4op   fcsl( aDum(ro;o4oleoifetyt aDranvsnt4 lxrxr3totfatranei t  2to(r iy4am nmfctas)aruaxmpnu0tpenmiciytfmDum(vp;u) etrxfcoydlate neils0 rurir io4lmt mfeta(fs2ua(ro;u1teeomf3iydfm emn p u4alxrmo ootfp  an s s0trtoxrpoodlpt mfvtlt sDuax o;o4opxnmo3tysfa uauvs;u4arxomfcoydfa   n ilt0teumxopoy1llee netat)arur(mo;u0aexo fetltfm2uauvpnt)aexoxr3todlp  an i;( srxrir3nydllenliesas)sDraump;o0tltn ociat s eaump;t)tleoir iy1fmtr i olt0 2tmxr nudoleelnvi ( a2raxmp;t0tpe ifciyt a ea(mp;t0trtnio3oadopDr n i;(  eur(opoo1ome  ietl() 2tmuroou0apxoiieiytfaDulnmp t)trxrio totop   ieol(0 2toio iydaleemivsltf rumumpnt4aetomoctydlm rmuvpn(4texomo3tadom  anvols)texoiopno4ale  netas a2urx oou0tex mf3iat m rl( snu4aeeoxr3totomt  ueo;t texoir3nu4ol e iviltfaDur(m ot0oet mi3iydlmDemn o u) etnxr ta1oat  n s;t0 2uoxo3oy1lmte nctat)s2tmuronu0tlx  feiadlm2ua(vs t0 ltrxf iatomt luvols)texo(r oo1lm emfvtlsfs2ua(rp;u4aee if3tlslm2umnvp (0texrif3iodfa  anvo;s  etr(r3io4lmte fvi tf Dtmumpou0texnioctlslmDrmuvon(4arxoif3totomt li o (0sexmxm no1alt lfcsas aDraumpnu1oex mi3iysla2rm(mpnu0alxnmo3iadfp rauvilt0srxrxm3iodamtnmiesl( arrr(m ;o0apeo octlslm rlu s u4 etrir3oadlmD lneilt) exoio3io1oltnlfvsls)aDtm( pnt0oet  ictasls2uln s;(0trenmr iotfmDrau o s0trxo(m nudlpt  fvtatfa2rr(m ot4opxnmoeiasls2em(vsnt4trtrxr3to1fa  livi;s0tetrxr3oo4ape  fcsl(f rtrxm ou4texniocias s2emnms;u0aeenxr ootfp  luvils0srxoim ny1aptelfctatf rtaum ot0teenmi3iydlmDeluvonu4 etoifciadlatr nesl(0srum(opnudalt  neil(fsrra(mont0alenmfciltlm2emnmo t4trtrif3iy1oatrluvs;t) rur(o3ny1lptnmfcilsf 2rm(mpnu0tpeo ictytfmDemnmp u4treoio3tatlpteluvo t  etr(opno4lleemivtas sDum(mpnu0opx mietysfa elu pnt4aexrmf oy1fp e iei s t2umxr3nydlltnmfetas aDurxm ou0oetoiiciatfaDrl(vp;(0alxrxfcootopte ies (  2xoimpiu4omtnmfcs (f 2ta( p;t0apxo i3iysla rlnvp;(0altnxr oytfmDelu sl(0 rurxr3iu4oleemivilsf Dtmxr oo1tle  fetadls2emumon()teenxfcty1laD auei;s0trxrio iodol   fcs t arta(rpoo4olx  ictadlm ulu p u)tlxoifctytlpt lieo;t0 2trxopio1olt mncs tf Dtmx  ;u1oee mo3iytfa elu o () ltnxf3oydlm elu o s t2tmiopnodlle  fvi tf rtrum ou1tpx mi3tasfs2rl(ms u0arxomoctytoptr nes t sexo(o3ny4amtnmicias  rrr(m oo1alxnmicilt a el( p;(4alxnifciytfmte i olt0t2urxo nodlp nmnviltfs2taxmo;o1apto oeiyt m2emumsn(4trenxfciytla  aivils0seum(m oo4am emiesa( srurxrpot0apxn f3iltfa eluvo u0treoirciydoatr nes t0 exrxm ny4lp n ictlt aDtr( oot4ole ifctad sDelumsnt4altoif iadop ean s;s)teuoim iudol nlicsls aDur(mp;t4openifctaslm raumo u0altnio ty1fatrli o;t s2xrxo nodolt  fvils)aDraumpoo0opx if3tltlm um( o;(0texrio3iytlp e ivilt0 etm(r oudol n iviasfaDrm(rpnt0olxn o3iltfs2rmn ont4 rermr3oydom eanesl(0truoiopnu1op  lfvtltfarrm(m nt1alx ioeiad a rlump;(4 rxrmr3oodfpteauvo;s0tetmirpny1apee fesat)a2tmxrp;u0tpx  fcildfa2rlnvp u0alxoio3iatoa raues;()t2umxm3iudlptemivsls sDraur oo1aee  ietlt aDra(mon()aleoifciatfmDe i ilt0s2tmxm3io1lle  ies ( arrau  ot0opto feiydfmDrmumo;u4 lxrirciotfptr nei (0 rto(o no1al nmics ()aDrau o;o4olenmfciysfs2emnvo t4 exrifcoo1lptr u i ()tetr(o io4ome  ies t)srua(rpoo1texn ieiydla rmumo;t4 etomo3oatlm eauesl(0t2xoir3oo1alt lfvt tfsruaxmp;t0tlxnmociasfs rlump t) ltoif3iy1laDeau s ()texo(o3iudom n ietatfs2um(rpnu4oee moeilsfs2ra(vs;u4 lxoxo3iy1fp  lies;t setmio ou4opee feslt  rrrxmpot0oeenmoeilt m2ua(mo (4 exnmrcoo1op rau s s srxrxm io4olt  nvt s) Dta(mp;u1tle mfeiltla2ea( o;(0 rtrxocoytoptelnvi (0 etr(opny1olt mivs sfartr(r nt0tee ioetasfaDeau s ()tltoxo totlmteaiei;s texmir3nu4al  lfesl( artr(  ;u4opxnmfeiysfaDel( onu)texrxr iadlp e uvil(0s2umimpoydlpeemfcsltfarrrxront4apx iociysfaDemn o u)arxnmrctatfpD lueo (0sruoimpnu1lmenlnvi ( aDtrx  ;u0oleomiciyslm2ulu p;u)aexomfctodlpte i i;t)sexmxo iydopeelieias)artr(rpnt4apx  f3ias a elnmsn(0trxnio3todomt lnei;t s2uoxmpnudapt mfviat  rtaxrp;o0apeoifcilt s eau p u)artrxfcoodfpteluvi (0sexoio3iodlp  mnci s)aDrmxm ;o4aee  f3iyt s uauvo;(0 rtnmrciotfpt ln slt)srtoxopnu4al elieiasf 2rmu  ;u4tpxn fciltfa2rm(mpnt)arerxf todlp eluvilt  exoim no1omt mncilsfsDuaur nu4tlt miciysfa2ulnvpnu)tleoxrctadop raivo;t0tetrxopiy1lm  liviltfsrrmxroou4apeomocias sDrluvs (4 etrio to1fmDe i ol(0t2trxopno4ale lieil( srumu o;u4tptn ieiadfa2ua(ms;t0areomf oo1fm   ues t0setoxr3ny4al n fctls aDrr( o;o4oee mo3iydlaDulnvp (4arxnir3iy1fm r u o t) rxmxrpiodaltn fct tfarrm(m ot1aeeomo3iys aDuluvs u)aexrxf3tatomDe nvi;t0srtmir no4op  liesa(f 2tr( p;o4oeenmfcilslm el(ms;t)tltrmf ty1fmteai sl( t2um(rpnydlpe mnet (fartax  ;o4apto i3iysfm rm(vp;(0 rxrmo3to1om r ueil(  euoxr ou4lptnlnvilsfs2ta(m no4teenif3iydfm emuvp;u)aetrmr tytfpte neilt0 rto(r3oy4alt mfvtas arua( ont4tee iociatlm rlumsn(4 eenio iotlaDeanvo;s) exoxo3io1olte net (fa2um(m nu0tpe mo3tlslaDrau s t4arxoxfcio1opt  nvsl( trtoimpoo4al  lfeiat)s2umu ono0optomoeilsfs em( p () lermo tytlm  aivsl()seurxm3iy4lmenmfesls) 2tmx pou0optnmfeiytla2rlums;t0trtnmr3iotlmDrau olt)trxrxm ou1omenliet t  2raxmp;o4aetoiocils mDeanmsnu)artoiocoodoat  ieo ()sexm(o oodalt liciasfartaxr ou4apt ioeiltfaDrlnvp;t0 exrxr iy1faDrluvi (0 eumim io4oltnmfvsa() 2uaxmonu4olt  o3iltfa eau s ()trxnmr3oy1opt anvols texmir iudom  livtas)srumuro;t1ole  fciatfmDran snt4trenxrcoa1fat  n o;s0trur(r ou4optelfesltfarum(ront1tptomo3iaslaDulnvo () etrio iadlpteln sl(  rtmxo3iy1ome lfei (fa2ua(mpou1aexnmf3iasfa elu on(0alerifciotfaDe nvi;s0tetrxrpny4op n fesl( a2tr(  ot1optnifcilsla2rmnvo;()alxniocoa1op eau o;()seumxr3no1lm n icta() Draxr nu4aet mieiadls em(mon()tlenxfcoadoat  u i;t0trxoim3ny4optemfvia(f Drmu  nu1tpt  oeilsfm rm( o;(0alxrxrcoatlmtr ivs (0srum(m3iu1opee ivs sfarrr(mpoo4tlxo f3tltlm rlnvo (4aexrmociatom elivo;t0trurirpiu4lmtn fvsa(fsrtmx p;t4oexoifciltfa um(mo u4aetoio iotfa  lu slt  rtrxr3ou1amtemicilt) Drmxroot1oltnioeild a2eluvp (0aeerxo3iy1lm rliesl(0 ruoxr oo1op   nvsl()aDrmx o;t1aexnmf3tadlaDranmon(0 lenmo3ty1lmt lu i;s) ruoirpno1apt mivsas) 2raum oo0oeeo ieiadla2uauvs t0alenmo tytoaDraivi;t0trumxopio1lleelfeia( sruru p;t0oex  oeiys sDeauvp t4 rxnif oy1fp e i s;s0 exo(mpiydlmtelnvsl()aDtrxrpno1oexnifeild s2emn s t)altrmociytla e uei ( teum(o3oudam   neiasfsDum(r ou0oltnif3ias s ua(mp;u) reoifciotoa elnei t0seumio3ny1aptn ivsa()srum( ooo1oltoioeilsla2rmumo;t) eerxr3oydlaDe ues;()t2trio3nodlptnlieta( arrmxmo;u0aptoioeias s umn o u4trtrxf oo1faD li olt  ruoxmpoy4ope lici t  2rrxmoot1ope  i3ilt a2em(ms ()aexnxo3iatoa  li ols)t2xmxm oodllt  iciasf rrmx  ou1ale  fctatls rmums;u)teeomr3tydfm   u s s) 2tr(m3iu4altelfvta( s2uax p;o0tpenmfcilslm eanvs;t4tleoxf3totopteln s t srum(opoo1lmtnlfeias s2ur( p;u4alx  i3iatlm rl(vo () reomrcoytoa   ivol( tetr(opny1ll   ictls)arra(  ou4apeo ieiytlm rmuvp;t0 rtnir3to1fat auvslt0trxoim iydomtn fcsat  rtrx pnt4tetnifctydfsDul(vs u0alxrio3io1op   nvs t setmirpoudop   ivs tfsDua(  ;t4ope miciys m2ean s u0aetnir io1fmD lueo s)setoxr3nu1lp emnctl( srurx poo1apx iiciys m rmnmo;t4trxnxfcoo1fm e ieslt0trur(opiudlltnmicsl(  2raump;t4ole moctysfm2emn p;t)trxrmo3ta1fatrlueol() etr(m io4lpteliesas) 2uaumpnt0opeo oeiat m ulu s t0teenmfctatlmDe neol( s2xmir no4ap nmieia()sDumx poo1ole iieiadls2elnmpnu0aetnio oytfp e uvo s s2tmxm iodale  neilt) 2uaxm ot1opeomicils a ua(ms t)teenir3tatfatranvilt0 2xmxr ou4altelfeil() Drm(  ou0tptnmieilsla em(mp;u0altnxo3oatoptrau sls tetrxr ny4ol n fvtls) 2tmurpou0oltomf3iytfs ul(ms;t)aeeomf3iotoate u i s0srumiopno4op emivs s arrm(mo;o0tlx iietyt m eanvpnu4trtrmfcto1lpte neo;( t2xrim3oudam  mnctlsf 2umxmono4altoifciasls ean p u4alxrmf3tadfpDelu slt0tetrxrpio1omt  fesa() rrr(r oo4oleoiicilsfs ulnvp u0arxoiociydfp  aivo (0t2urirpnodlmt  feta(f Dtrur oo0tet mi3iytfaDrln o;u4artniocoodlaDrauvo ()srtmxm3iy4ap e fvs sf Dta(mo;u4oeeomocildla2rl( o (0altnmfciodfmDelies;t0s2xr(r3nu4ap   fcsat sDta( p;u0ope ii3iydla2rl(vsnt) lxrif3oadla  luei s0 ruo(r io1aleemieiltfa2rax  nu0tpx ii3ilsfaDuanmpn(0arxnmf3tydoa eaies;t seumirpiy1al n nesl(fsDtmxmpot1teeo oeiad aDumuvo t4 ltnifciytoat  nvolt)texrxo ou1lmtnlncs tf rtrump;u0opxoii3tls aDum(ms u0aetnxf oy1oaDe iei () rum(m nydll nlnesl() 2ururonu4ope  ociytls rmn p;(4arxoxo3oodoa   ies;t0srxoxrpno4lm  mneils aDuax  nt4alx mieias mDemuvs (4 eermo io1faD lnvol() ruoir oy4omtemnes (fsrtrx pno0aet  feiad a2rlump;() lxoir oo1late n sl() 2urxmpio4ameemiei ()a2tm( o;o4apxnifciysfaDean p;u0 rtrxr ty1lpDrluvs (0 euoxo io1oleemfvi s  Dtr(mo;u1teto i3tatlmDrmu pnt0texoir tydfp elueols t2tr(r nydome lfcilt a2rr(mpnu0alx io3tldfa2um(vo u4tlxnxrcoydfpDrli i t srxrim iydal nmics t)a2ua( p;t0altn iciydfs2ra( snu)aeenif3oo1omDeauei;t  2xr(r nudomtemfcs sfa2ra(ronu0alx mf3iytfs2umu o;(0 lermf3oadfpDeauvi;t t2uoxo3no4alt  feiat)a2tm( pou4oet ioctatfm2eanmo t4tlermf io1lptr nvs;s  rumim iy1aleelnci s a2urxmoot4olxnmfciydla ulnvonu0arxrio3iydoatrlies;( texmir3oodlmen fesl(faDua(mp;u0tle  feiadfm umnmp t0aetnxo3oatomDe n o t)srxoxr3oy1oltnlncsl()aDtm( o;o1oltoiictatfa elu o;t0aetrifcto1lm rlivil()srurio nodlpee fci (  rumxr nt1aptoii3tydla ea(vo (0 rxrxo oadom rlnvils0texoxo3no1amen ies t a2umxm ;t0olt io3ildfa um(vp u4 etrxo3iytfpteau s;s)tetr(m3iydamenmnes ( artrumpnt0olxnmfciat s ean s (0tlenmf oatom rli s t) exo(m nu1open nvia(f Dtaurpnt1tpxomieias a rm( pnu4 rtrio ootopDrli ols0s2urir nydlle lics sfaDraurp;u4opx io3iysls2uluvp;u0 rxoio3tydfaDrlivo;s sruoim ou4lp emncta(  Draxrpnu4ale  iciyt m emuvs t0texrmf3todfmD aues s0truoxo ou4omte nvi (f 2tmxm nt0aee  octydlm2em(vp;u) eenxrcoo1omte ueols0srtmxrpiy4ol nlfei (farrrxm oo1oexnifeias sDem(mo t4aexnio iydfpD ln s t0setrxo3iy1omeelictas aDrmx  no0tex moctys a2um( pn(4 exrmfcoytop eai i t0truoim iu4amtelfcslt)arumu  ;o1apt  oeiad mDulu sn(0aeerio iydlp e i o;t)t2toim3io1olte fetls s2ta(rp;o1teto ocildls2uluvp t4tlxoxo3tytoptr ivs s)t2umxopoy1apenmictlsf Dumxm nt0aeen f3tldfa umnvs;t4 rxnio oytfp rluei;s)teumxm3oy1am   fcsl()s2tmu  nt1tlen ieiyt sDrau pnt0 exrmo3io1oa eauvol()texm(opnydll e feslt) Dua(mo;o4teeo f3tatla2umumsn(4 exomo oydlmte i i;t0 euoimpnu1omenlnet (f rta( p;u4oetoiiciysfm2rlnvo;t)altoxfctodoa  an o () rxmio io1ll n nciasfaDururpou0tex  o3iyt m rlump (0arxnir totomD ai o;t0trtoiopoydll emnvsatfs2ururoot1texoiiciadlm2ran s t)artnxf iy1faDeauei t teurxo iudap e nvt (fs2umumono0apx io3tatfaDul( s;t0arxnxr3ty1laDe uvs (0trxoxr3oydameemiei s s2rrum ;o4tlxnii3tat m rlnms;()teerio tytlatr ieilt0teur(m iy1lle lncil(fsDua(m ;u0aptnif3iydfm2rl(mo u)areomr iytomte i i;()teumim3io4amee fci ()arra(mpou1tleoioetasfaDeau o;(0tetrmr3tytfm elnvs;() 2uo(m3iydamtnmfcsls) 2tr(  ;u0opxomocias m elnvs;(0aeeomo3ty1om eau ol(  ruo(opoodop nmfci ( a2uaxr ;t4alt iieiydfm2umnmp t)tetoir3io1lmD  nei s)seumir oo4openlnciat) 2um(  oo0tpx  o3iad m2emn pnt)aeenxfciotlaD anesl(0 rto(r3io1optn fesl(f Dtmxmoou1oee micias m ul(vsn(0arermo3oo1faDelueol( setmim3ny4omtn nci sf Dumxrp;o0oetnmo3iytls2uln o t)texoif3iodfp eanvo t0trurimpoodomtnlnvi ()a2ua( pnt4opxn iciltla elums t0altomocoadfaDeluvs;s) 2um(o iu1olt  fciasfsrrrxm ;o4olt ioeiadlm2elnmsnu0trxoxf ta1op elnvo s)srxoxmpoo4lp n ivt () Drmurpnu1tlx mociydla2ulu p u4alxomocoo1fm  anvils sexoio nu4alen fvtas) Dta(m ;t1tpeo f3iatlmDrlnmp u0tetoxo3iodfmDraivo t)s2toxm3ny4llt mnci (f 2raxmpot0aexnmfeiytla2ulnmp;(0arxomo3tytlmt  uvilt)sruo(m3nu4amen nvsas) rur(  ;t4oexnmoeiytfs2uluvs;(4trenmfctodlmte ies t s2tm(opiydaltnlfvtas) Drm(m no1aee mo3tls a2ea( onu)aeerxr iy1lptr nvil()s2ur(rpiudlm elivtl(f 2rrum nt4olxomf3tls m emn o u0aetrxfcta1omDranes (  2umxm no1lmeemivtlt)a2tm(m ot1tet  ictydla uln s;u)tlxnxfciotlpD lueils trxr(m iy4am n iesa( srtrur ot4oeeomi3tydfsDumnmsnt4 rxoxocoodopDean i;t0s2to(rpoydlleelncilt)aDtax p;t0apxn ictyd a2ul(ms;u)areomfcoadomtr n ils)srur(opnudape mncsas)a2rm( oou4texoifciyt s2eauvonu0 etnxfcoadlaD  uvslt  2trxopoy4amenmfvi tfa2raur no4opt io3ilt s2elums t4tlxnio tatlm  li sl() ruoimpoy4amtnmfvs sfsDrru  oo1olx ifcilsla2ua( onu0artoxf3iotfpte nvo;t0srurim3nu1op e ivt s)aDtm( onu4oexomi3ildlm2eluvont0trtomr todfpDeaivs;t  rurim3iu1opt  net t)srrrxr ou4aeto f3ildfm eau o;u)arxrmr iydfa  luvs t)s2xo(rpiu4opt lfvtlt)srtmx ono4apxnmfctadlm ea(vo;(4tltrif3iytoaD luvi s0 2umiopiy4lmtnmnvsa( arumx o;u0aex mo3ildls rlnmp u)treoxrciytfateluvil( sexr(m iodol  mfcs tfa2ua(m ;t4aleoifeiaslm2rmnms t0 exrio3tydfmDe ues t)setr(o oodamen nviat) ruaxroou0oex ioetyslm uln ont)aetnxfctodlmt anes;( srxr(m3io4al   ietlt aruaxmpoo1openifciys a2rlumpnu) leomo3oa1om rlivils0srur(mpiy1ap elict sf 2tmx pnu0texoif3iltfa umn p (0altrxo todop r neo ()t2urxm iydll  lfvt sfs2rmxm nt4tle  i3iytfm2emnmo;() etrif iydfpteauvo;t t2uo(m3nydapt mivtls) rur( ooo4oexomf3ils m2em(mo ()trenmfctotlatraneils0srxrim3no1lm  mfvilsfs2trxro;o4olenif3iasfs2uanmp u4 ltrio3oa1fmtean sl(0texr(opiodlm  lnctls)a2uau  ;t0oet miciys m ranvp;t)texrxfcta1fpteluvi ()trxoxr3oo1llee ictasfsrumx ooo0tpxomocilsfs ranmp u)tltrmf3oadfp r nvi (0 exo(mpoydapeelfesls sDrr(roou4alxn o3tadfm2umn s u0altoio3to1la  auvo;(0teum(rpiy4llt mfesl(  2ur(ront4oeeniietytfm2elumo;t)alxoxo3oydfmDrli s s0 exm(m3nydoltnlfet t arrrurpot0oetnmf3iysla2elums;u0 lenmr3ootla   uvi;s trur(o3oy1ome mnesltf Duru pou4tle  ieilslsDua( o (4trtnio3iodfm e nvil(0sruo(o3ou4lm elfesltfarua(r ou4tee mi3iat s rl(mo u4 rxnir oodfmte ivs;t)texmio io4amen nctasf Dta(rpot1oet if3tatfmDemu s u0aleoir tatfm  livsl(0 rur(o3nu1lpte feiat)srur(mpoo4texomicils sDuauvp;t4artrmf totfpD auvo;() 2xoxr no1al  micilsfaruax  nt4aexn ociltls uan onu0arerxr3oytfa   ivilt)seuo(o3ou4omenmietl()a2tmxrpou1texomociltfa ul(mp t0aeeriocootomt livol(0texr(m3iudal emict s)aDtaxr ;t1oltn o3iadls rmu pn(0 lxoir tydlat li i t0 rurxmpio4lmenmict s  Dtrxr nu4ole  icild s umu p;t4trtoirciotopD ln i;t) exo(r3oodlmee icia( a2tmuro;u4tle  i3iytfm2ul(mo;() leomo3iatomD li ols seuo(r3iu4lpeemicsat  Dtru  ;u0tpeomfeiytfmDrlnmon()alxrxf iadfm  anvi () rxmir nodameelieil( s2ua(ro;t1opx  i3iad m2em(vp;(4artoif todfp elnesl(0seur(opoy4apeemncias)arraur nt4alt  i3iltfmDrmnmp u4alxrio ta1laDe uei t0 2trio3iy1lpenlivt sfs2raurpnu0tptnif3tlt sDeanvs;u) rermfcoodfate nvil(0srxoirpny4ap nlncs t sDtmxmpou4apenmocildlaDrluvs t0trerxo3oa1fatr uei;(0t2umxr nu4lmenlics (farrmur nu4opeomfetatfa2el(ms (0tetoio io1oaDrlnvo;(  eurxm3no4oltnmnesa( s2taumpno4alenifcildfa ea( p t4altrif oo1oaDeanvs s  exrxo3ou4oleemivs tf Drau poo0oeeniociatfa2el(mont) reomf ootfpt  i i t) etoio oo4oltnlfetltf Drm(mooo4oex ioeils s umn s;()altnxr3oydfaDranvol( texrim iu1ome mfvsas sDrmumont0aexnmfeiadfa2elumo t4teerxf3oa1opDrauvi t)teuoxr nydlp emietlsf rtmumpou1tlx  fetydls emuvs;t)tlxrxrciytfp   i slt0setmxm oy1lmt  ivt sfs2tmxmo;u0opxomiciyslaDumumo;t) etoxf3tadomt livs;s setr(o3ou1ll e iei () Drr(m no0tlt mi3iatfm uauvp;t)alerirciytoptran o t t2xoim3io4apee neilsfs2umurp;u4alt  fciadfsDrmn p t4artoxo oydlm eaneilt texmxr3no1opee nviatf Dumu oot0ope mietydls uln sn(0tetoxocia1lpt  ueilt0texrim3nydlpenmfcs ()a2urumoou4oeeoifetysls em(msn() renir iydopDeaneo s) euoim3oy1optnmncilsfs2urur ;o4aeeomi3iys sDrl(vs t4teerxr3ta1fpDeai s (0trtrxo nudapeelfvtas) rur(r ou0tpxn feiysfsDumu s t) ltoxfctydlpt ai slt0trtriopnydomtnlnes s) Dur(  nu4apxomo3iytfm ua(vo;t) leoir oydlpD  ueol() euoxo3oodlme mfvtls sDumxr ot1oee mi3ils s elnmo (0 ltrir ia1lp r ues;(0sruo(m no4lmenlivsls)sDua(m nu0aeenmociytfs2rl( sn(0 reoir to1lpt lues;s0setmxr oo1lltnmics t) rumumo;u1apx iociydfaDeluvp;t4alxrxfcto1oaD  n s;( setmxo3nydoleemnesat sDrrxmo;t4tptnifetasls el(vonu4tlenir3tydfp e u ils sexmxmpiodlmee nvt ( sDtaxmpno0apt miciadls elnvp u0aexnio oo1lateauvilt setoiopio4lpe livi t)aDrr(r ;o4oet  fcils a2rau onu4aetrifcoatfpteau s s  exmirpou1apeelncsatfs2urx  ;u0teenifciatlaDemnmp u)trerxo todfm r u s;t) exrim ou1ope mnvtat) rtr(mpnt0tlt iociysfs eaumpn(0treomrciotfa r nes;(0t2uoimpiodolt  nvsa()aDrmurp;t0texn fetaslmDea(vont4 rxomrcoydlp e nvols s2tr(r3io4ap n ics (faDtaumpoo1tpe  ietatfs elnvp;u4aetrmocoydlmt an i (0t2ur(o oy1lm e iesltfaDtrumo;o4ape mo3iyd m umnvsn(4trxoxf totlm elnvo ()sexmxmpiu4lp n nct t a2um(mono1apeoifetytla ran on(4 exomo3tytfpD  ieo;s  2toxmpoodlpt  feil()sDta(roou0aexo ictls a2uan s u0 rxrxfctytlmtrauei t)sruoxm nu1opee fetatfarrmx  ou1openmoetasfm2el(ms t4arerircoadop e ieols  exr(rpiu4ll   fei (  2umu oou4tlx if3iat sDumn sn()tlxrxociydfa r neilt) eumxr3oodopeelfcsa() Dtru  ;o1aptoifetaslmDelums;t0 exoif3ia1lm  luvilt)tetrxm3io1alee ivtasfsDuau ont1tleoio3iytls emuvs t4tleomo to1om e uvs t0s2um(r3no1amenlnesa(f Dta(mo;t0opeo ociytfa2um(vp;(0 eeoifcta1fpDrlnesl( t2tmxr3iudamee fci ( sDtmu pnt4alto ietldla2rl(mp u)aetoxfctatopD au i;t) rxmir3iu1lle mfvi (  Drmu  no0apx  iciyd sDeau p (0arenio3oydfmte n ilt)srtrxopiydap eliei t sDua(mo;o0optomfciasfmDea(mp t4 eenir oy1faD lnesls)srtrxmpnudapt liesat  2um(roou0tetoii3tlsfaDrmnvont0tetrxr oodoaDeauvs;t0trtr(o nu4omeemfcia()sDurxmpou0texn f3tyslsDua(msnu)altnmr3oy1fatr i i s0 rtoio3ny1lpenlivs s)aDrm(rpot4altn feilsla rmumo;() eeomf3iodoatraivi;() etoxo ny4am  mivsl()srtmurpot1opxoiietldlm2umnmsnu)alerir oytfaDe i o;t0t2um(rpnydome  icsa(  ruauront0apxnmfeiyt s2rlnvo t4 rtoxo oodfmte n ols  eum(r nodlmtnlietltfsrur(r nu0alt mo3tld s2ulnmo u0trtrmfciytfmtr nvil()trtrio nydom emiei s s2urx  ;u1aeeo o3iytls ean o (4trtoio3tydfm rlieils)t2xr(rpio4aptnlncslt) rra( o;u4teeo f3iadfaDulnvo t)aetrmf3iatfp eai sl()srum(rpnydapeemfciatfarta(rp;u0tee  i3iytfaDrm(vo u4tlerxr3oytop r uvs;s texmxm no1omtnlivta( s2ur(r ;t1oleo o3iytfa rm(mp;t4 lerio ta1fptelu i t0 etoir3io1alen feil(  2taur nt1tptoifciatlm2ul(mo;(0aexrirctotopDr ueilt)trtmxopoo1lleemncsls artr(mo;u0tlx  ictydls2ulnvpnu4texrmr3to1oatraieo;() exrim oy4omtn fvi sfa2ur(rpnt4aexo i3tas mDuanmsn(4tlxoir3oytlaD aivo s0srxrxr iy1om n fcsat)sDur( o;u0apeoio3ilt a2em(mp;(4teenircoytlm r nvils) ruoxm oo4al emfcsltf 2rru ont4aeeomieiysls2eaums u0 ltoir3totfa raivs;s0 2xo(o iodaptnlfetasfsDtmx p;u0tetnmieiatls uaump;u4trtoif3tadom r uvslt)t2tmxm3nudlmtelictat  rtaxro;t4tptnioeiydfa eanmon(0 exrxo3oytfptr uvolt0 rur(r ou4ome  ivsls) Drax p;t0apx mf3tasfsDul(mont0 rtrifcta1fa elu il(0 2ur(r3no1optelfet t a2tmxro;o0teeoii3iadls eluvs;t)tlxrmociytfmDeaiei;s t2toxm3oodlpe lfeiatf rtm(r nu4open icilslmDrluvs;t0artrxo tadfmD anei;(  exrim oy4lm elies s  rtmx o;u1ape io3tatlm2ulnmp;(0alxnmf ta1fmtraneol() 2xmio3iu1oleemnesa(faDrau  no0aetn ieildla2ulu snt4aeeoio3io1oaDeln i t t2to(rpou4lmtnmieil()s2tmx pnu4alx  i3tls a emnvsnt4arerio3ootfa  aieils trurxr io1olee fcta()srtr(rpnt0aexomfetltfs eanvsnt4artoio totlpD  uvs s seurxopio1ll  lfes (fsDtm(  oo4apeniictatlaDemnvo;u4trxomfcoatfptr ivsl(0 euoim3iudolenmfvsat) 2uru pno1tpt ifeiasfs2uanvsn(0 etnifciytopDeai ol( s2xrxopiu1lltn icils  Drm(r ;u1aee moctldls2rln ont4tlxrmr3io1lmD  ieo t t2trxm3nu4ll  mivsltf 2urx pno4aetnmiciasfa2rauvo t)alenxr3totfat  nvs;()srumim3ny4lp e fcs tfs2tr(m ;o0tee mieilt aDuan p;u)tlenmo3oo1late ivo;t  euo(o3no1oleelfes t  ruaur oo0teeo oeilt m2eluvo t)tlenxr todlpDe u o (0t2um(opoydll  livsat srrmxro;u4opxnmiciys s2umnmo t4alxrxfctotla ran s;s)s2tr(r iy1alt lfvt s arurum no4oeto oeiadls emump u0altnir3iotopD lues;t t2xmxo3oydap   ivilsf 2umxm ;u4oeeo f3iysfs2el( on(0aeeoxrcto1omtrlneo;()tetmir3iy1lltemfvsa()sDur( oou1aetoio3ildlmDulnmsnu0artnmo tatlp eaueilt t2xoim iy1lmeelivtl( arrauronu4oeeomiciydla2eauvs;t4arxoxr iotlpD luvi ()tetrxo oydlltnlfvsltfs2rrxront4tptn f3ild a2rmn p t) etoxf3ty1lpD lieo t)tetoim ou4omtelieias aDumxr ot0alen ociltls emn p u)trtnmf3oodla  lueo;t)sexrir ou4oleemnct tfs2rru ono4tpxoioetad m2ulump (4tltriocoodfatr uvi (0s2ur(mpnu4ape mneias)a2ur(mpot4tpxo i3tytfsDemu s;t)altnif oadomDeai o s  rxr(m3oydapeelnctltf rtrxm nt4tpx io3tadfa2ean pnt)teeoxf3oydoaDeanei t)t2toxmpiydllen neta( aDrr(mp;o0openifciysfmDum(mo u0teerir3tadlp rln s;t0s2urxr oy4apeemics (  Drax  ;o1teenmo3iytls el(mp;u4artnxociotfaD lu s;()setrxm3nydomeemivt s  rtmxmo;u0tlx if3iaslsDrm(vpn()trxnmocoydom  lu slt0 rtmiopnu1lmtn fcil()aDtaxmpno0oltnmieiyt s2umu s;t4 lxrmf3iytlateli s;t0texr(o io4omtnlfct (fsDur(r ou4oleo fetysfm raumon()aetrmo tydlpD luvi t)sexmir no4lm e ncilt)artmurpnu0aptnmiciadla2rau s (4alerio3iatoatran o;() 2uo(o iudlptelfctl( arra(rpoo4tlen icilslmDuluvs;u0tltnxo oadomDelieo;s  rxoiopny1ll e ictl(f Duax pot4opxomfciasfsDrmu s;u4aeenmf3iadlat  u i;( trtrio3oy1lptn ncslt)aDtmumpno1altoif3taslaDelnvo;t)tetrmr3todfm raivsl(0srtrio no4lptelnes sfaDtmump;o0openmf3tytfa2ul(vont)tetrxfciodoat lu o s0tetrxopny4ame  ivt (fa2umu pnu0tltoioeiltfsDumnms;()trerxfciy1omt  u o;s0s2uo(r nudale lneil()s2ra(ro;t1tlxo ietydlm2eluvpnt4 eeomrctotlpDe u o;s0s2xrxopou4altemneiat a2rax  no0tptoifeiad m rlu pnt4 exnxf3oydfp r nvi ()t2uoimpnydlpe lnvtls arrmxmo;t0oleomo3ias m2umnmo;u)arxrxo3oatfmteaueo;() rtrxm no1llt lneia()aDtrur ou4olt mo3iat aDeau o;u4areoio oa1laDeanei;t t2uoxm nydalt  fet tf 2raum nt4alenioeiysla2rm(vsnu4 ltoifciydlpDeln il( sexm(mpoo1amee ivsl( aDtmur nu4alt  i3iydlaDrmnmo t4arxniocto1fmDeaneols trxr(opnu1op nmieia(fa2uaurono0altomf3iaslm em(mo;u4texoir3io1lmt  nei s)t2uoim3iodoptn ieslsfsrururont1apeoifctltls2ul(vo;u0 rxnir3tadoptelneo;t0 rxoxm ny1ole micia( a2rrurooo4tlenmieias sDrm( p;u0tetnmo tadlmt ai ilt0s2xm(r3io1lp n iesasf 2rrxro;u4aptnmf3tas m ran p;t0 rtnxfciadlaD an o s) rxmxo ny1ap elfetlt)sDrmu pou4aeenmiciat sDeauvs;t4tltnmo3todomte i s t)s2tr(m3no4lme miei s s2tm(  nt1aetnmi3iys sDelu o;u4aetoir ta1oa raueo;()tetoio no1apenlfctat artmumo;u0tee ioctasfm raums;t0 exnmr ootfpDeaiesls0truo(rpoy4lp emieils aDtr(  ot1teto f3tldfs2ul(msnu)arxrir3to1lmteai o;s)s2toxo io1am  mfcil() Dra(rpnt1ape iieiad s um(mo;t0 leoxr3iotopteaueol() 2xoirpoo4lptn fctls)srtmur ;t0alt  o3tltfm2elnmo (0 eeoxfcoadlmDrlnvo;( teur(o3no4ll n fvtl( a2tr(roou0opeo ieiltfaDrm(mp u4texoxo iodoatrlivs (0 eumxm oydaptnmnvs tfa2tmxr nu1olenmfeiat a rau ont)aexnxrctotfmD aues t0s2xr(r ny4opt liviasf rrm(r ;o0apx  feils m em(vonu)aexomo iadlm elivi t)s2trio iy4lmenmicsa(f Duau  nu4oee mo3iat aDea( p u)tltrxf3oytfate u s t  2ur(mpny1om  mivsa( arra(r ou0olxoifetadfa2ranmsnt)texrxr tytlatraiei;t0 rumir oydolee ics t)a2um( o;t0olxoio3tydfmDua(vp u4 exrif oydfptrai s t0trum(r io4ale  ncsl(faDrm(rp;u1optnii3iatla2rl( snt4 lenmo oa1fpDr i s s0 2uo(m oy1lmt mneiat aDra(root4apx  f3tadfa ean o u)aeeomo iydlm r nei t) exmxrpiu4opeeliesls)sDrr(rpno0opt mfeias m ea(vo;t0trtnmfcoa1omDe nei;s0srtrir3nu1amtelfviatf rrm(r ou1apx  feias a2eln p u)texoir oadfaDr n s;s)srum(rpio4am   fvi tf 2tmxmo;u4oex iiciltfm2emump;u0trenifcoatlmDran olt0teuoio no1amenmfctl()sDrr(m no1tlxnmf3tld aDemn s u4 leoirctatfaDe ieo;(0srtr(o3oudaleelncsa()s2ur(  ou0tpe mietaslaDumuvs t4trenircoatomtr uvs t)t2urio ou1am n ncsat) rumuronu1tpxnifcild sDrm(mo u)texoif3io1omte nvi;()teto(opno4lmtnlnctlt)s2umu ont1oexnmfciltfa2rm( s u) exnxfcootlp rluei;( t2tm(m3oudap emics s s2trxr nu0opxomfcildfaDrluvo;u4arenxocoydlateauvilt)t2xm(m io4am  mnetlt)s2umuroot1oltomocilsfa2ulnvo (4altrio3todlp  ln s;(0t2triopiy4aptnmieslt) 2ta( pno4optomo3tldla2ra(vont4 lermo iatop  lu ol(0sexrxmpoydoptnmivia(  Dtm(rpot1apto ieilsls2uanmonu0aeermr3oatfmtraieo;( srurxmpoo1altemncias)s2rmxmp;u4tptnmfetydlm2emumpn(0tetriocty1om eanei;s) eum(o oy1lmtnmfvt s  2rmx  no0aee  fetys s2rln p u0arxnmocoo1lmD  nvi s0s2xmim no1om e fct s  2tm( pnu1apenioeias mDean pnt4trxrmf3oy1fa r uvi (0setoimpio1amte ivtas)s2rau pou1aee ifcilsla rau s (0tetrif ootopD au o () euoir io4apee ictl()sDtmu oot4tlenmoeiadfa2ulumonu)trtnmo oatopDr i i t) etmir oo1op nmfvi sfarumxm ;t4tpt mi3iysfa2ul(vp;u0 lermr oodfpD  n s;s)srxoirpou4optemnvt sfsDtau onu0teen fcild mDrlumpn(0tlerxf3todlm eli o (0t2tmxr nu4lptnlicsl() Dtmumo;t1tetnmietyt aDuaumsnu0tlxrmf oo1lmt lu ils) eur(r3oydomenlies t) ruaumoou4aptoifetatlm emumpn()tlxomociadfmDe n i (0srxo(m3no1oltelictat arra(rpnu4tpenmi3iyt a2emnvp u0trxomr3oytfmDe neils0srur(o ou4al  mnei t s2trumpoo1tpxo iciydlm ua(vp;() leoxf3ootfpt livi s0s2um(o3nudome lneia() Dtrxrp;o0apt  octlslmDeanmo t0altomo tatlp  luei;t) rumiopnydap emfcs tfartm(mpoo4olenmo3iadfmDemuvon(0tltrif3tadlp  aneols) 2tm(m3iu4lp emfcsa()aDua(  nu4texnmictydlmDeanmo t4aeerxocta1lmte n ils trxmxrpiy4lmtemfeiat) Dumxr ;t0tpxomoetydfmDrmu s u0artnmo3iydopD luvi s)t2xoir3ny4lp elfciatfsDrru poo1apt io3iatlm elnmon()aeerxfciotfaD  uei t0trxmxo3oy4lpt mfcsa( srrmumpnt1tlen ieiysls2rlu o;u0texrxr3iydoaDeaneo;s0 rtrxo io4lmeemnvsl(fa2urx ont4altoii3tat m2el(vo;u)trtrxrciy1fmDelueolt0setm(opny4op n fctls)arum( onu4optomf3iysfa2rlu s;(4arerxo3ty1laDean i;t)s2um(r3nodapeelfvs ()aDrmuro;o0oet miciys a2ra( snt0teeoifcoy1omDe u ol(0 2umxr ou4ll nlnvt s)a2umxmp;u0teeoioeild a2rauvsn(4teenxo3to1fatelneolt t2xm(m ou4olenlfcs ()srrrur nt0teenmf3tldlm rln s;u4 rtrxo3iotlptrlies;()t2toxmpio1al emieiasfartm(r nu1opeo fetatls ulums (4arxomo3oa1lm rau i;s0 eum(r ou4lmte fcilsfa2taxmo;t1tpto o3iyt a rmu s () lxoiociatfp eln s;t0setmxr iy4lpee ivtls)aDrmxr no0aeen ociasfmDrlnvo t0 lxoxociadlatr nvs;( tetoim3nodopen nvi t)aDrrx onu4olx  i3ildlmDum(vs;(4areomr3oatfpDe n s;t)trxmxr nudoptn ncils)arurxr nt1ape  ieiadfm2rl( s;t0 renifcty1fmD auvsls sexmxrpno1al n neslsf Dtr(m nu1openmociytfa eluvp (0tlenmoctodfp ran i;( tetoxr nodlpenlnvtas) Drrur ;o4apx mfciysfa umump t0trxomr3iatfmDeaiei s0seum(mpnu4lptemnvtas  rum(mo;o1ope io3ilsfa uaumon(0tetrmf3oadfmtranes s s2umir nu1lpe miesa()s2tax pnu0aleo i3ild a eln pnt)aeenxf iadoaD auvs ( t2tm(r oy1omt lfvilt aDururpnu4olt ifeilslm ra(vsnt)alenir3todoatrlivs;(  2toio3nodapt lncias) rtaxrpoo0opxoioeiatfa2elums;t)tetoxf3
\ No newline at end of file
@@ -0,0 +1 @@
+nvi s0trumir3iydope mies ()s2uau o;t4tlt iictyt a2emn pnt)trtnxrcoy1fmDr nvils) 2xrir iy1am nlfcilsf 2ur( o;t4tltnmoctldlaDran p u0aexomr3oytlate uesls0 2xmxr oo1altemiet t aDum( o;t1oexoiociysfmDrlu s;(4trenmociatopteaies s)s2tr(o iu4am n ictl(fs2tmur ot1opx ifciatfsDua( p t4 eeoxfciytla r u s () 2xo(o iu4lmeelfvsls arraurooo4apxnifcildfa uluvp;t4aeermo3ootfpt ln o t)sexoxo3iodolt lfei ()a2rrxmont0tex  f3ilslm umu on() lxoxrcoydoatrlnvo;t)teuo(m oo1lle lncsas)sDra(  ot0altn f3ildfaDea(vp t4alxnmrctadfm rai s t  rxmxrpiodolenlfvsa()s2uaxrpot1tex  fciytla2eaumpnt0 exrmr3ty1lm r i i t0 etrim3iy4lptemfesat) 2tm(roou0tet if3tasfm2eaump;()tlxnio3to1fm e ies (0teum(r3iy4amtemncil( arrr(r ot1openmfeiat m2uluvpnt4tleomr3ia1lmDrau i;t  etoiopoy1lpt mncsls) 2tm(r ou0texnioeildfsDul(vonu4aexrxf3tytlaD  u o;s0trxoir3ou1om  mivs sfs2umump;u0optnif3tydlaDrluvonu) lenmo3iotfp  lneo ( setriopno1aptnmnctlsfa2taxrp;o4oltnmf3iyd a ranvp;u0 renmr oa1oat ln i;t  2toirpoy1omenmnctas)aDum(r ot0oet mfetltla elums u0 eenxf3oydlaDe ues;(  2toim3iodal emfci ( s2rmurooo1aptniieiyt mDumnmo (0 lermf oa1lpt  i o t0srur(o iodopeelfvsa(fsrtm( pnu0tlx mi3iaslsDra( p;t0aetomo ootomtr ieols)t2tm(m3nu1omt lfcias)sDtrur no1tpx iociasfsDelumsnu0 lxomf3tatoptrlieo (0 exr(m nudam n nviat) Dtmxrp;u4oeeoiiciadlaDrlu o u4alxoxr oytomDr ivil( s2toxrpiu1lm  mnvia()s2rr(mo;t0apen ieiad aDum(mo;u0trtnircoadoat  ivo;t)tetmxopiydlp elneiatfaDra( pno1tpenmi3iasla uaumont0aexrmo3io1fpteaivs;t0 2uo(m3oy1lm nmnei ( a2ra( o;t0apen ietadfmDraums;u4alxrif ta1lm eanvils srtoxr iy4ol  lfeiasfarta( pno0tpeomoeiatfs uln p;()aetoxr oytfmtelu o () 2xoxrpny4opt mfvsl(fsrtmx  oo0tpen f3iytfsDumu s;() rxoxo iadoa r ivi;s) 2umxmpoodol   ivs sfarrm(m nu4teeomi3tadlaDemnmp;(0teeriociadoatr ueilt srumxr oo4aptnmicsatfsDtaum ot0ape mi3iytls2rlu o;t4 lxoio io1fpt lnes;t  rtrxopou4lmenlnvtl()s2urx ont4aptoiietld sDemnmo;(0teermfciotfaD anvo s srxoim io4opt miesat)a2tmum ot1tpenii3iyt m2eluvs;t)artomf3iatfm rlueolt0 ruoimpiy1omtnlfvtas) Drrum ;o1opeomo3ilsfm rm(vs () eeomf oadfa eauvi;t s2tmirpiu4optnmicslt) 2trx onu4tpen octadlm emuvp;u0 rerxf oy1fa  lues s)t2uo(m3no4ole  fcilt)srtmum ;t4tpeoioctasfs raumo;(0trxoxrcio1lpDrln s;t) etrim nodlpt mies (  Duru pnu0aptn octat s2el(vo;u4aeerxrctydlmDraiesls)t2tmxrpnudal eliei s s2rax  nu0aeto f3iasfa2eluvs;t4 ltomr oytop  lieolt)srxrxopiy4lpt lneia()arra( o;u1alxn o3ildls2ra(mp;(0trtoxocoytfmtelnvi (0srtmir iu1ale  nvslt) rtrxm ;u4olx mo3ias m rmnvp;t0tltnxf3iytlm eauei;t0 rum(r3oydlltelics ()srtaum ;t0opeomi3tyt mDrl(vp ()aetrirciatfaDeln i;()s2xm(opoy4opt  ics s a2rmumo;o4aptnmo3tltlm2emump;(4aeenxfctytfa  lnes;s0texrxmpoodolt mfeia()arur( o;o0alt  i3iatfmDelnvsn(0 lxnir3ty1lat li i;(0texmxrpnodlp elfeia(f Dtmur ;u4tleoif3iys m2eau s;(0tltrxf oa1fat ln i ()trxmio iu1lpte fcsls arrr(mpot0alx mfetldfmDel( pnu0alxrxr oa1om eluei;t0s2xr(o3nydlm   fcsatfaDtaum no1apxoiieiatlsDul( s;u4 renir to1oa r i s s)texoiopio4lle  icta(f Dtru  oo4oeenioetld a2eaumonu0alenmr oytomDranvsl(  exmiopnu1ame  nei (f rtm(  oo0aptomfcils m ul(vsnu0texnif io1omDe u o s  2uoxo3iydolee ncils)aDumum ot1aptnmoeiat m2ra(vo t)trxrxf3io1lm r ivils0 2xm(r3oo4ol  lfcsl(fsrtmu  ;t1oltnmi3iysfm2ul(vp;u)tlxnmrcio1oaDeau s s0s2urxopno4am  mieils  Dur(m nu1aeenmicildls2rlnms (4altrxfctotfmDeanes (  exoir3ou4ale  fvilt a2umump;u4tpxn icildlsDra(mp t)texrxf ta1fpDrai slt0srxoir3iydlpen nvtlsfsrrr(rpot0apt mi3iatlm ul(vsnu4tetrxocootlpDr n i t sexoxrpno1lmtnmictl( a2umu  oo0olxnmfeiytfm2rlu s t4alxnxrctatlmD  u ilt)s2uo(r ny1am nmfesatf Dua( oou0tet if3tadfm2elnvs u4arenxr3ta1lmte uvo;t  2xmxmpou4om elfes ( aDtmuro;t4ole mfeiyd s2ranmsnu)tlxrxf3oytfatelieo;( sexoxm oy1al nlnctls)sDrrumono4olxo fctat s2uauvon()aeenxfciytopDr ueo;t  rtr(r3iu4ape  ivi sfa2rr(rp;u0aeto fctltfm2raump t0 lxnxf3iodfptr ueils0tetmimpiu1lpeelicsas)srurumpot0oexoioeiysfmDua(vs;t4treomfctydlm  luvs s) euoiopio1oleemfetat)artr(ronu1ope mfciyd mDemn sn(0trtrmf3tytfpteaiei;t0texoxm oodopt mici ()s2trx ooo4aeto fetldfs uauvonu4tlxrxr3ty1opDe uvo t0 2uoxr3io4lmte ics t) Drax  ;t1oeto i3iyt m2ra( pn() eenir3oydoptr uvs ()setr(o ny4lpen fvsasf rraxr nu4tetnmo3ils s rm(mp t)aeeoxocto1lpDe i o t t2urxmpny4am n ncs s)sDtmum nt1olxo ieiatfaDuan pnt)tlerio3iatopDeai sls0teur(o oy4lm nmfet () Dtaur ;t4oexniietydfs2eaump t)aleoxf tytopDeaues;s0trtrxr oy1op  lnei ()sDumxmpnt0alx mo3iaslaDrl( p t)trenxo iatfpDrau s;t  2uo(mpoo1oltnmnvslsf rraxm nu0opt iiciadla2ulnmpn() renio iy1lpteluvi;s0s2toir ou1opee ictl(fs2rr(moot0aexniiciaslm emumo t4arerirctadlaDrlivo t) 2ur(opny1llee fvi tfsDur(rp;o1alt ifciatla2ra(mpnu) exomr oodfmDe ivil(0 ruoxmpiu4ape  icia() rtau ooo1oee miciydfs2um(vs;u4 rxnmf todomD liei (0trxoimpoy4olee ivtas  2tmxmp;o1tpxo fctyslm elu o;u4texnir3ia1lpDrlnvs ()s2xmxr3oo4lm  lfetatfs2rrurono4optoiieiat m uauvo t0aexomocoydoptelueils teuoxr iy4lm nlncilt aDrrumoou1aptomicildfm el(vs;t4aeenxf3tydlatr ies;t srxr(mpoo1am   ncs ( a2rrumpoo4oeeo feiasfs2umn s (4aeeoir oytfptrln ols) 2urxm nodam e fvsa( s2rmurp;t0tltnmf3ilt mDea( on(4texrxocoatom  auei t0 rxoxrpnudomtnmivs ( a2uau  ot4oleo fetldfa2emnvsn()aetoif3oadom rluvslt)s2umio oudop elici s aDtmx pnt0tpt if3ildlsDuaumsn()alxomo todoaD aiei t0 etmio3iy4apt  ncs ( a2ta(rp;t1oeto i3iltla em( s () exnifctotfatelues t t2triopnudap nlnvia()s2tmurooo1oexomfeiatlaDrm(vs;t4tltrio iadlat luvsl(0s2to(o3ny4lmte fesas) Duax ont0tlt  fciaslm ulnvp t)aeeomf iydfmt  neo;(0t2urxo nydapenlfct tfa2urxmpnt4opx  i3iasfs ulu o;()tleoxrctatlmD au o (0 rtr(o no1llt  fctasfarrax  nu4opxnmoctld mDua(vs;(4tltomr3oydfmt lnvslt0sexrxrpoy4open net tf 2tmumont1oexnifctys m elump t0tlerxfctytom   n ilt0trurio3oy4am e ivs sfsDurx  nt4tetnif3tldfs uluvpn()trtrifcoy1fa  lu o ( seum(o oudape mfciasf Durur ;o0aptnmfctltfs2ea( o u)texoif3oadop e ivs t0sruoxm3nydap nliesls) Dtmu pno0tltomf3tldfa2uanms;u) ltrxfciotopDe uvi;t s2xoxr3ny4op emfeia(faDurumpnt4oltnmo3tadla umnvp;(4treoir3todfpD au o;( s2toxo oo1amtemnvta() 2um(rpot0apxo feiaslmDeln snt)aeeoir3tatfp raieo t0s2urxrpio1lm e fcilt) 2tmumpnu4tptnmfeild m ulumont4trtoirctadla eli s;(0 ruoxm3ny4alte ncsas sDtmu pno0teen ietldfsDea(vp;t0alxnir3oy1la rai i;s  exr(o3iudaltn nvilsf Dtrumo;u0aleomoeiysfa2emn o (0alenxr ta1omtr i sls0 eum(r3oy4lp  lnet (fsrra(  ;u1oee io3iasfm ul(ms u)artoxf tydfm  ln olt) eurio3nudomeemiei s)sDtaump;o4aetniietaslm2rau pn()tlxrmo3tydlat ai ol() 2urim oudlmtnlici () Duaurooo1tlxo iciysfs ulnmo t0 renmfctotlmtrlneo t0 2xoxr3iu4ol  mici (  2tru pno1tlxo ocilt s emuvp t)tleoxf tydlmDr nvo;s) 2trirpoydole  fet t arra(r nt1oexomfeildla uanmp t4 eermf iatfmDe ues t) 2toir3oy1altelfesa()sDtm(r nu4tpx  o3iysfm2umums (4 lxnmf3oytlm   nvs;t) 2urim3oo1op nmietlt srrm(r ot4apenmiciysfsDum(vs;t4alxrmr iadla r u i;t  exoxrpnydlmtemicil( srtaumo;o1aetoioctyt m2ranvs;t4arxnio3oa1lmD  u o;(0srumxm iu1lm nlfctas)aDtr( onu0tex mfciadlmDrmnms () eenirciytfpD  neolt  exm(opoo4lpe  fcilt)sDrmx onu1opxn oeildlm2el( s t) rxnio iydlm  aivils) rtr(o3oy4ope licils aDuaump;u0oexn fciatfm2rmuvonu)aetnmfciy1fatelivols0t2tmxm oy1ol emfetas)aDtmurp;u1olx  oeiaslmDumuvp t0 lenio3oo1lpD  u o t)t2umxrpou1lltnmics tfaDuru ono4olen ieiadfm2uan p;()aexoxr tatlp ranvi t trumxmpiodom n fci ()arra(m oo1texnio3iysla rm(vs;(4texnmf oa1fmDraies;s0s2tr(r oo1ame lfvtl(f ruau o;o4apxniicildfm ulnvo;() lxrir3tytlp rluei s  exmxr3oy1amen ncs (  2tmum ou0opeo ociyslmDeau s t0tleoxrcoytfmD  ivi s s2xoimpiu1alt mict (faDumu oou4apxnifcild mDeauvp;t) exomfciatfpt aneil(0s2urxo iodopt lneilt a2rm(root0aexomfciadfs2uln p;(4alxrir3oy1la e ivi (0 rtoio3nydal nmfvs sfaDtaxmo;o4aexnmiciltlaDemu s t4 ltnxf todoatelnvol( s2trim nodol e nctlt)aDtr(rpnu0opeomocild s em(mp;(0 rtomrcoydfpt aneo t s2xr(rpoy1llee icsa( arrmumo;t0tptn f3tytlm um(vs (0 lxomr3oadomt  ivolt trtoir iudopte nctls  rtaur nu1oltn fciadlmDum( o (0 rtnio3oodlaDeaues;(0s2uo(r3oo1lpe  fvils a2rau pno4aee iociasfaDum(mpn(0 lenxr ty1omDelnvs (0 rtm(rpny1lle livt s) Drrxroot1oetn feiyt mDum(ms;(0alxnxocoy1opD  u i;t trxrxo3nodlme lnvsas srra(m nt1oet mf3iaslm eanvp t4alxoio oo1om  an o t0teuoxr3io4llt  ivtat)a2umu pnt4texo oeiatla eanmpnu)aeermr oo1fpD  uvs;s s2umio iudalee fet ( srtrxmpnu4oltniieiasla ranmsn(4texnifctatoatelu olt0seuoiopio1om emnvslt a2urxm ;u1tlxo oeiytls rlnvsnt) lenmo iytlaDe uvil(0seuo(opiodam elfeslsfaDurx pnu4opt ioeias sDua(ms (4 exoirctydoptr ues;s  exoio3oudll elnci sfa2ta( pno1ape  f3iadfa emnmon(0trxomf oy1omtr uvs;(0srumxm iy4al emiet (fsDumump;t1oeenmi3tltfs2eluvo u) etnxociytlm  livsl(0seuoim3oy4lle mfeil(fsDraurp;o0alt  iciat m2ra( pnt0tleoif3iydop   uvs ()teuoim ou4al  lfvs ( artru pnt1oeenif3tlsfm rmn on()artoio ty1lp  liesl(0t2tmim nydal e ict s) 2umxr ;o4tpxnmf3ils a rmn o;(4tlermo iodlpt  ivs s)t2trir io1ope lnesat srta(roou1opxnmi3tysls umuvp;t)tlenxr3oydla e ivi;(  exmir3nu4omtnlieiltfsrum(mpot0alx  ociasfsDumumo u4teerxociotfp eluvol( setoir iydalt lictls aDtaxro;u1alto ociatfs rl( snt) etrio3iytlptrai s s0 rxrio3no4ap nlici t  2tmur ;t0opt mfetldla2rlu s t0 renmo totlaDe uei;(0tetrim ny4apt mfesasfsrrr(m oo1oltomo3ildls ean sn(0texoxr3oatfpDeaneilt)s2to(m ny1lltnlivslt  2tax  ;u1opeo f3iytfsDeluvont0arxoio tadop eaieolt0 exm(r oy4open icsas artmurp;u4ole if3iasfa2ulumonu0trtoir3oo1lpteanes;t sexo(r3iy1llen ietls)srurumpoo0ole  feiltlaDeln snt)texrmr oodlaDrln s ( t2trimpiodoleemnct ( a2ta(r ou4oltn o3iad m2rauvp;u0altoio3oytlpte i i;s) rxoxr no4am n neslsfarum(r ;t0tltn iciat m ea(von(0 rxrircto1opt ai i;() 2umxopoodale  feil(  rrmxmpot0aexnmoctltfs rm(mo t)trxrmf3io1lm e ues;s  rumio nu1om nlfeilsfs2rmx p;t1oeeoii3iyd s uan o;u)aexnif tytlp e nes (0setmxrpiu4ol nmnvsa( aDuaxrono1openifciysls eaumo;t)trxrif to1lpDr ies ( s2xr(rpou4lltn neta(fs2urx ooo1ale mociyt m2ran on(4texnmfciadom eau i;( teum(opiy1lp emnetltfsDuaxm ou4open oeiydfa ulnvsnu)artrmocoatomDranvi;()t2xmio oydol   fesat arraur oo4apx mo3tyt s2ua(ms (4aexoxoctadomtr ieo;( srxrxr3oy1ap   fvi tfa2rrurpoo1tlxomfeiltla ul(vs t4trerio to1fp eli ols0 rxrxm3no1om  mnvs t srrm(  oo1tptoiieiysfsDeanmo;u4 ltrirciadfm rli i ( teum(mpou1ope  fet sfsDtr(mpoo1oex mieiadfa2eanvp;u4 exnmrciy1lm   neslt)srxrxrpio1lpte ictltfa2taum no4oeeomoeilsfm ra( s;()altoxocoa1fmt  ivi;t t2xr(rpiydlp nmfvtat  rua(ront1olx mo3tld aDulnvp;t0texnmo3oydfa  livi;s setr(m3iy1lpt mnes t aDurxro;u0apxomfeilsls2ranvp;t) etoif oa1lpDr uvslt  rxo(r iy1lme  ivtat) 2tauront1tee mieiadfa um( on(4 eeoxoctytomD ln s;() ruoxrpoodomen nct t srrmum nu1olxo fctldfs2ul( p;t0 rxrxf3to1om rauvi (0t2xo(opno4ame  fvsls) 2rrxrpou4tptomo3tatls rl(vpn() lxoxocoy1opt anvs;s) exmio iu4ope  ici sf rta( o;u1opeo fciydfa ulnmo;()artoir tydfp   u i;s0t2toim nu1ameemivs sfartrxr ou4oexoioeiyt sDum( o;u0tetnif3totfat auvils0 2ur(r3oydapt  fcsat aDuax ont0apeo f3ildfaDrauvpnu) etrif iadop elnei s)s2xoio nudoltemfct s) rrm(r nu0aexomoeiadlaDumuvpnu)tlxoxo3tatfmt livil( tetr(o3oydll nlnvsatfartmu  ou1alxo o3iasls um( p ()tlerxrcia1opDelieo;t0 2tm(r iu4al e ivia() 2tmu onu1opt  i3ilsls2ean on(0tlxnxo iatoptr ueils0sexmirpoy4ale  nvtlsfa2rru ono1oltnio3iltla2uanms;() lenir3tadfpD aivs;t)seumir3io1oltnmfvta()s2tmurpnt1tlxomi3iatfm em( s;u0 exnxr io1optrlnvols0srurio3nudome mfvilt  rtaumont4oeeomoctys aDum(vs;() lenifciytfpt auvs;t trxrxm oo1apenmies tfsrrrx  nu0olto i3iasfs2ra( o;u)trxomr iodlpteauei s srxoir iy1amenlnetl(  rrmurpno0oetnmictadfa umnmo u)trtrir3iotlmt an o s t2umim ou4lpenlnctl(farurxrpnu4alto i3iadlmDrau p t0artrmociydlmt aivil(0trtoxr3nu4ll  mfvtls a2tmxrpoo4apt  i3iydfaDemn pn(0 lxoxo iodfp  anes;(0 2xoxo oo1altnlnvi s  2tmx  ;t1teen octytls2ea(vo;(4trxnmf tatomDraivi t) 2urir3ny1omenlnetl(  Dtaumpoo0oexnifetldfaDean ont4trxomr3tydoaDelivslt trxo(r3iudlm nlnct (f rumur oo0tpeomieiysfs2rmnmo;u0trtoif tadla  livo s) ruoio nu4apt mivi tfsrra(m oo1tle mf3iltls ra( pnt4trtoxr oadoat  nei s)srurxo3iy1oleemfctl(f Drru pot4aet ifcilt a2emnvs;()aleoirctatfaDrlnvolt)s2urir3iy1optnmieiatfs2umum ;u4apeo f3iadla umn s (0aetoxr3oy1oat  u i;s setrio3oy1lptnmnesl(  rtmu  ;o4oeto fetytfs2umnvpnt) rtnmoctotopDr i i;t seumim io4apt  nviat sDrax pnu0opeo ietltfs ulnmo;(4trtrir ta1lp  lues;t)truoxmpiy1apeemfes () 2tmumpot4opxn ietysls2umnvp;t0 eeoxr3to1omtrai il()trxmxopnydoptnlfeta(fa2tmumpot1oltn fciydfsDean o;u)alxnxr ootlp   nei s)teumxr oy4open fcs (fs2ur(r ou0ole iietysfa elu p t4alxoxo3ootoa rlu il( t2xr(opiu4lpenlfes t) rrrx  ;o1tpt iieiadlm ranvo (4aexrirciotlmt  nvi t  2tmim nu1ll  lici t)artm(  ot0oexomi3tlslm2umu sn(0arxrmr3oydoa e uvsl() 2xm(m no4apt livils) 2uaumoou0aexo ictyd s rmums;t0aetoxocoadfpD anvols0t2xm(r iy1omen ieiat arum(mp;o1alxnii3iat s ra(vpnu0texrif3ta1oatraivo;t0srtmimpou1llenmieiat  Dtr(mp;t1tpxn icildfa ean o t4arerio3ta1latranvi;(  eumio oodaleelnetl(fs2rax  nu1teeomfcilt s2rm( o;t0 exnxfciydoa r ueo (0srtmxopno1om emnesat  Drr(mooo1texo feildfmDum( p (4trtomociadfp  lies t) rtrxm3nu1aleelfcsl()aDrm(moou0tpxn octydfmDulums t)teeoir tydomDr nesl()trxo(m3io1omeelnvtas aDurx pno1tlx io3iysla2rm(mont)trxomfciotlp  li i;(0t2tmir3oudam  livtat)a2tm( p;t4opeo oeiyd m rmumonu0trtrmr3iydlmDr uvs t  2toio3nu4ole livtl( a2tmu poo4aptn oeiysla rm(vs;u0tltnmf iotlpt luesls s2xmxo ou1aleelfcilt arta( pnt0olx ioeilsfmDumn p t4 reoifctydfmDrau ils setm(m nodam emfcs (  Dtaurpot4openmi3iadlmDrmnmpnu4trtoxo3oytlpteai o;s  2xoir oo1op elictl() Dum(mpno1aex mi3iltlm eanmon(4 leoxrcio1lp eluvi s) 2to(m iodop  micsltf Dtaxm no1aexoiieiadfaDulumpnt4 etnif3tatlmte ivo;t)t2um(m3no1open fes sfartaum ;o0opx iieiytla2umumont4 rxnir totfpDrlivo;t t2urxo3no1oleelnctas)a2tmx onu1tlen fctytfsDrauvpnt4 lxoxocoytfat lnvol() 2tr(o3nu1lm  mfvt t srtmxm ;u4alx ioetls a emn sn()tleoioctytfp  aies ( trtmim3ny1omen fesltfsDtmuro;o4opeomoeiadfs rl( sn(4 lerxr iytfm  aivs ( seumio no4olt lfcsl()s2tr(  ot1oeenmictatfa eau p u0altnir3iatfatrlivo () eumxo nodap n ncsl()sDtm(  nu4tee iictad a2rlu o;(0altnif3tydlmt  ivo (0t2tmxm io1opt mfctls) Drr(mpnt4tetomi3tlslm2el(vsn(4artoio3totla  lueilt)s2umxrpnodale micilsf rrmu pou4oet iicild mDra(vont4 lxrir oytomDe n o t)teurxm iy1op  mnvs (farrau p;u0alxn i3tysfs2rluvs;t4teermrctodfat ai o (0 rxoir ny1ome mnvtasfa2rmu oou0olxn f3tasls emu o (0teeniociotfp elnvil( sexmiopiydopee fvilt  rtrxronu1aeeoiicilsls ran on()trxrmo3ty1oatelieslt)tetriopou1apte icsl(fa2tr( pnu1opt  fctatfm2em(vp (4teermociatomteluvi (0setrxm3iu1omtnlfcils arra(  ;o1oetoio3tydlaDua( p;u4 ltoio3oatlp eaueols0t2tmxo oudape mfviltfarua( o;t4tpx  o3iasfa2raumsnt4 etrmr tytopDeli s s0 2uo(m nydlpe livt (farumx p;o4oleomoeiytfa2umnmpnu4aexrxf iadla  luei t t2urirpny1optnlivtatfaDrrxrpot4olxoio3tasfs ua( s;u4alxoxf3ia1oaDeluvils) 2xoxopiy4am n nei tf 2umumo;u0olx micias aDem(mpnt4 rtoircoy1opDeanes;s0 ruoio nu1omtnliesls)s2trumo;u0opeoifetasfsDrmnmp ()aeeoxo oodlp  ai sl() rxr(o no1altnmnvt (fsDumu pno4aet mieiadla uluvs (0teeomf3oydopD lu o;(0trtrxo ou1apen ieslt sDuru o;o1tle mo3iysfa elnmo t4arxnxo3ootlaDelivs s0srxo(m nydllee icsa(  2uaum no1tee if3ilslsDranmo;u0aexnmr3io1omt an s;s0srxm(o3no4ap e iei (fa2trump;o0oltnmfeiat a2ea(von(0trtoxf3io1fm  lies t  ruoxm3nydapte icia()sDurxmonu0aetomo3ilsfs2umn p;u4trxnxo oodfatean s t0 2xoimpno4ll  mnvtlsf 2rmxr ;o4tetnmfetydfaDrlumsnu)trtrmr totop e i i;(0 rumxm oy1ome mfesat arrax onu4alt ii3tat sDrm( o u) reomrciadlmDeli s (0srxrxm oudlleemnvtl(f rrmxmp;o0aleomociyslmDrlnvpn()aeerxf3iodop eln ol(0t2uo(m3oy4amtelnet sfs2raur ou1texo feiydfa2ean o;(4texoif3ta1fm e uvol(  2uoir3iydolt mfvil(  2tm(r ;u0oexo f3iytfa rluvo;t4tetoifctadopD lnes t)teuoimpnudolee icsat)s2uaur no4tlxo ieildlm2eau s t0trtrircta1omt aivsls s2ur(m3ny1lmtelfeiatf rraxrono4apxn octlsfm2um( pnu)alxrir3ia1lp rau i;t srxrim3io1omen ivia()srta( ont1altn feilt a2rmn o t0 renir3iy1fp rau ilt s2urxrpno4lleemfctas)a2uax ont0oet mf3tad s2uln onu0arxniocoadlaDelnvs t0sexrio nydamen fvilt s2tmum ot1opxoif3iydfa2uaumpnt0aetnif3ta1fa ran slt  etoxm oudlpte nvtas a2rr(root4aetomieias mDel(mo;t4 lxrif oy1fpte ieo s0 rtrxrpiy1lme  neils)sDrmxm nu1opxnmo3tadlm rluvo u)arermf3to1omDean o;t) 2xm(rpoy1am nmnvsat)s2rrx ooo4apeo fetlsfm2rm(ms;u0aetnif iadfpt lueo t s2tr(o3ou4ol elics t)arumurpot4tltoio3ils sDua( s ()tlenifcoodlateai sl(0texr(opoodol   feiasfaDrr( onu1tetoiictysfs2emn p u4 renmf oo1lptelivo t texrxm nu1opeemneslsf 2tru ooo1oet io3iytlm rl(mo;t0 ltnirciadomtrlnvi t)s2xrxo3oydopenlnvia( arrm(m ;u1tptoif3ilt m2eanvs;u) reomr to1fmD  neo;t0s2tm(opio4om  mfetl(f 2taxrpot4oexn fciaslmDulu p;u4trtrio oy1fpt  uesls)sexriopnodolt mici ()s2tm(rp;o4olxo feiydls ean s u4aexrxrcoadfpt lieols0t2uoio3nu1ll   ivt ()srumxrpot1apeo feild s2uluvon(4trxnxr iotfa eau s t truoxo3io1opt  fctls)sDtaur ou1oleo oeiyt sDrm(vsnt4aetoir3tatom   uei s trtoir3oo1lpenmnvs ()a2rau  ;o0oeeoifetltfs ua(ms t4 eermfcia1lpteaivo ( t2tr(m oudamenmfcsls)s2rrxrono4tlen i3iatfm2em(mpnu0altoxo iytoaDr u o;s trtoimpiy1lp e iei s)sDuaum oo4olxnmi3iat aDrmu o u)teenmo3oydlpD an s;( s2xoxmpnodamen fesl(farur(  nu1tlto ociysfsDranms;t0tetrif3oadomDe i ilt texo(r nodlme mneil(f Dururo;o4aex mi3iys s2el(mo;()altrmrciy1lptrln ilt)sexo(m3iy1amtn fvt t)a2tr(rpoo1optnmf3iydfaDrmnvs;(0 lxnxf3oa1fmDeaivi;s)s2xrir3oydlm nlnetls a2tax ooo1altomfetasls2rmuvs u0tlenir3tatopD  n s;t srtrxmpiudolt mnetat)srraumpou1tpeomo3iat aDua(vp t)trtriocoodlmD aivo s seuo(opou1lmenlfcia( srra(rono1tet iiciys aDel(ms;(0aetoxr oo1oa eluvo;()tetrim3nudoltnlncs (f ruaumono4oeenmo3ilsfa2eau s (4alxrmr3iodlpt liei () eum(o3nudap nmiet ()srtmurpou4tlx mi3tyd mDem(mo u)alermo tydlpDrauvs;s0sexo(m3nu4am  lnct t) Duaumo;o1texn ietytlaDraump (4 rxrxr iotomDe nei t)sexoxr3oo4optnmfei ()aDtaxmooo4oetoif3tysla umnvont4arxomfctytop rlnvi s s2tr(m oydome lics tfaruaumooo0olt  ieiasfs2umnvp u)trtrmfcoytopt aueo;t)trxo(r3nydolt lfvs t  Drax  ;u4tex mfeildls2rlumo;u4artrmf3totfpD aues t  2tm(
\ No newline at end of file
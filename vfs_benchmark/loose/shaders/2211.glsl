@@ -0,0 +1 @@
+ieols  eur(o ny4olt micsls) 2ra(rpou0tee mictldlmDem(ms u4aeeomf iodfp eanes;s)trurxr nudomenlfesls)s2umum oo4oetoiictyd sDrlu s u) eenif iotopteaivo;t0 2xmio3iy4lp nlfvs tf Duau p;t4aleoioeiysfa rlu snu4trxnircoydfmt  nvil( sruo(o3ny4ape micsasfarrruro;t0tpxnifeiadfm2uauvo t0tltoxociatoat anes;t)s2xrxm3oydlm nlivtas)a2rmx pnu4alx mo3iadfaDuln p (0 rtnir oytom   ivi;(0srxr(o3oodlmtnlfvtlsfartmuro;t0oex  o3iydfsDulnms t4alxrxf ia1fm ean i t  exo(mpiodol  mivi (fs2umx ooo4aetnmoetasfs2ua(vo;()tltnmfcoatopDrlieo s srum(rpny4altelnvt t sDraumpnt4aeenif3ias sDumnvs;u)aetoxf3tatoat aivils sexo(mpiu1ol emivi t)a2rrxrp;t1tetoioeiat s ranvsn(4tetoxr ty1fptraieilt  etmim no1op  licil( aDur(r ou4opto iciadla2ran s;u0altrmocoodfa r ueol( s2uoxr3nodomtn nct ( sDtau ono4tpe mfciys a el( p;(0alerif tytfpDrlieolt)tetoxmpno1ap e ictat sDraxmpnu4olxn ietyd sDranvo t4alxomo3tydoptranvil(0t2xmxr3iu4lptnmnetas  2taxr ;u4opeo feiasfm elnms;t) etoio oytlmD ln il(0teurim3no1omtn iesatfsrtr(monu4ale ifctyd sDrmnmon(4arxnmr3totfmDe ueilt)srxm(opou4olenmict ( srtmurp;u1opx ifcias a2el( snt4 lxnmf io1oaDelu ils)tetmxo3oy1apt  fct (fsDumu ooo4texnmoeildfsDea(vo u4 lenxo3tydfmDe u olt0s2umiopnudal  lfvs (  rtaurp;o1aptnmociaslm emn s;u4tetnir io1fptr ivols0tetrio io4om nlieiat  2tauroot4tpeomi3iydls ra(ms t0 leomo3iytfmte ueols0t2umimpoy4lmt lfcs t  Drru o;t4texnmfcilsfaDelump;(4alxrxfcoatoaDrlnesl(0sexoxr iu1amee ncil(fa2trxmp;o0optomoeiys s2eluvs;(4texoxociydoptr neo;(0trur(r3iudap nmicil()sDtm( oou0tlenif3tlsfa2eluvsnu4artrmrcoydfat au il() eto(o3iudamenlnetl() Dtr(  nu1ope iociyd sDrln snt0 rxnmo ty1fmD aivo ()teurxm3iodoleemncsasfsrtrxm no1tetomoeildfa2ulu pnt4 etnxo iadfmDe nvo s trumxo iodlltemicil()artaum no1aptnmictldfs ea( snu4 exrmr3iodfm eli o;(0t2xmir ou4lmen nesatfs2tmu  ;t4tee  o3tatla2ea(mpn(0tltomocia1oa rlivi;(0seumxmpnudome  fctl(fsrtaxmo;u0oltn f3tydfa2elums;()tetnxf iodlmteaivs ()sexrxr oo1om nlivt t)sDrax  ;t0oltoifetatfm umn p t)teeoif iydlatr uvs t)s2tmiopoo4amtelnetat  rrau ono0alxomo3ilslm ea(von()trxrifcoadlaD anes;s)s2urirpiy1optnlicsasf rrrxr ou0texomociatfs uanms;t) rxoirciadopt luvsls)s2urirpiu1al e fei t) 2urumoou4alxomicildfm rauvp;t0aexnir3oadoa raiei ( t2xmxo3oo4lm   ncil(faDtaumpnt1tpxoifciad sDelnms;u4 lenxr3oytla eaneils  rxmxr oo4am   feia() 2rm( pno0oeto f3iyslaDrlu p;u0 rxnif oa1la eaiesl(  2xr(r nu4apen fcta() Dtmxrpoo0opeomfciyt m2emu s;u0tlxnxf3iytfpt livslt0sruo(m3no1lm  lnvta(  Draum ou0olto i3iatla ea( sn()trtomo iadomDrlnvs;( seumir oo4am nlnct s) 2umu  nu4aptomoeiadlmDrm(vo u0 rtoxocoa1optrlieo;s srurxo3nodlm e ivs (f Dtrx pou4aeeniocils a2rluvp;() ltrxr iadomteaies;t0 2toxmpoydlm e fetl(  2tmxrp;u1opx ii3ilt a ra(vo;t4 eermr3ta1op rauvs ( tetoxr iu4oleelivia()a2tm( pot0oltomoeiytfs rmuvo;(0tlxoio totfm  lnvsls0seumxo nu1om e fes (  rrm( ono0aeto f3iydls2em(vpn(4arxrxf oytfmtrauvo s)tetrxo oudam emnvi tfarrm(mo;u1tpto feiasls umnvo;(0 etnmoctadlat aues;t0srurimpny1omt mnetatfsrtmx  oo1oltnii3iyslsDrmuvs;t) etnifcio1om e ivo;t) 2xm(rpou4ameelncta(f 2umurpoo0tlxo fctasls2umu p t0arxomocia1op rln o;t teuoxr nu4lm n fvi tf rrm(m ou4ole mi3tydlsDeauvonu4aleoxf3oydop   u olt tetoir nu1olt  fvt (  2tauronu0aet io3iyt s elu on()tltomfciydfp eli s (0 ruo(m nudlltelicsasfaDrmumpno0tex ii3iytlmDelumo u0treoxrciotfp r n i t  rxm(m oydlmen ici ( sDta( pou0apt  oeiysfsDumnmo;(4artoxf ia1fmDelivs t  exoxrpny1om elfes sf rra(r ;u1olxnif3tysfm2rmnvont4teenircootoatrau slt  rum(r3ny4omtnlnctasf 2trxrpot1apx  fctld aDrmn o;t)teeomf iatfptr nvi ()t2xrxo io1om  mfcsat  Drmu poo4aleniictyt s2rmnmpnt4 rtrxrcia1fpteli o;()t2xm(m oydapeemfvtl()arrmx p;t4olt  i3tad a emuvs;t) exoir3to1lmteaivi;t)t2tr(mpny4lpenmiesa(f Drmx ooo1oeeniictltfs2em(ms u0 etrmf3io1lptr u il(0 rxo(opoy4lpt lnci tfa2urx p;o4alenmiciadfsDulu p;t)alerif3oydfa  lues t)t2tmxopnudap elfesa(fs2taur ;o4alenmoetyt mDulnvpnu0aeerxf todla eli ilt0t2uriopnu4ame mnctas)srumxm nt0opxo i3tlslaDra(mpnt4trxrxf totoptelueo;t)t2tmxm ny1ll n fvs sfs2uaxmo;u0aetniictlslmDulnmo t0 ltoir3iydfp eanesls t2tm(r3nudll n ieilt artrumpoo1aeeo oetytlsDuln s;u) lxrmocty1lpDeauvslt s2trxr nudlpeelfesl()sDtmumoot1tpxo fciat sDulnvpnt0 ltnirctotom ean sl(  2xmxmpiu1al  mivsa( arumurpot4apto fctls aDul(vp;(0alxnio3tadlaD lies;s setriopoy1ap  lies sf rta(rpoo0aeeoiietasfm2rmumpn(0 ltrif oatlpD aieo ( t2toxr3ny4lpeemneilt) Drrx o;o1optomfeiydlm eanvs;t)aleomr3iy1lat  nes;( s2ur(o iy1apt mncia(f 2tmx  oo4teeo feilt mDem(vs (0trxrxfcoadomDranvils) rtrxm oo4oltn fesasf 2tmxmpnt4alt io3iyt m rmuvpn(0trtrxf3oydomtrluvo s t2uo(r3ou4om   fct s  2uaum ;u0apen iciatlm rm( s;u4aleoir3ta1omD  ues;t0s2trio iu1am   netas  rtrump;t0alx mo3tysfm2ranvsn(4tleniocoydlaDrlnesls0t2trir nu1ap elnetlsfsDuax o;t1alenii3ild a2rmnmp t0trxrifctodomDrlnvsl()seurimpoodolte fcsat)aDtaum nt4tetnmfciatfm ra( p;u) rtrmf oodom e n s (0trtoim iy1amtnmnvsa( aDrr(mont1optoif3iysfsDra(ms;u0tleoirciadlpD aivils)srtrim3iydoltnlnei sf rrrxr ;t4alxnmfeiasla2ul(mpnu4aeenxo ty1fmteaivs s t2ur(mpiudalt miet t)a2urum ;u4alxnioeiasls el( o u0texnio oa1laD ln o s  2xoim iy1ome  ietas) rrmxmoot4alen ictad m rm( s;t4tlermrcty1opt luvs;s)texoxr3nu4omenlnvsas)arurumo;t0ope  ociytlsDumnvs;u4arenxo ia1fmD aivi;()t2xmimpny4alt mnei (fsDur( pou4aee  i3iyslmDua(mp u4arxrif iydomDe i s s t2xoio iu1oltnlivsl()s2tmu ooo0tlxnif3iysfmDumnvsnu) ltomf ia1opt  nvi s) 2tr(r iodomte nvsa(fa2uauroou1apxoif3tasfs eanmpnt)arxrmf3iy1lptelueil(0 eumirpio1ol  mfcs tfaDrmxmoou4tpeo feiytlmDrluvp t)trtoxrctytfptelnvi;()s2xmxr3oo1optnlnctl(fs2urxrp;t4opto ociat aDrl(vsnu)tleomf3oydlateaies s  2xm(r oy1opt mfcta() 2rrx pnu0tet  o3iltfsDelnmon()alxriocto1lpteauvs;t  rum(rpio1lltemictl(f Dururo;u1olxnif3tad m2uanms;u4arxoxfctatoateaivslt0 exmimpoo1llenlneilt) rra(rpou0ape io3tadfm rm(mpnu) ltnio3oy1fpDe ies;t)srxmxr3io4alt mfvils)s2um(rp;t1aetoioctatlsDra(vs;(4trtnifciytop  an o;s0truo(mpou4omt mfctl(fs2ur(r no4oltnio3tys m2ulnmo;t)trenir iodoa elneil(0t2ur(mpoudome livsls)sDur(rp;o1tlenmoctad aDrmnmpnu4altomocoy1lateluvslt sexr(o ou1lpe lncsas) 2tmu pot1apxoiicils aDum(mo;u4 lxnir oatfmte i ol(0trtmxr3iodlm elncsa(  2tm(  ;u4texnio3ildlaDel(mo t0arxrmo oydfmDeli o;s  ruoxr3oo1lmt lfct tfsDra(rpno0tetnmi3iltls ulumon(0 ltomf3tadfa eai ils)texrirpoo1ll n netl( aDrax pnu4opxo iciltfm emn p (4teeomf ty1fpt aivo;t)setr(r iy4ole mictatf Drr(mpnt1opxn f3iltfm2ua(mp (0trermr3todlaDr uei;t0texm(m oy1ll n neta( a2trxmpou4tpx  ietat aDra( onu4tltrmfciytomD  nvol()s2xrxm3oo1altnlivia() 2umxmono0aex  o3ilt s2rl(mp;u) rtrmr oy1lmt  ieolt  2xm(r3iydomenmivsl()a2rm(m ;u1aeenmfctytls rlu s t)tetrirciatopD  u s;()trtoxm3nu1opt  ncsa(f Dta( p;o0tpto f3iasfa2eln p;u)tlxrmf iadfpDeau o;s tetm(opny4lmtnmnesa() Dumum nu1altn f3iasls2eau o t4arxnxfcia1fa   i o;s) eumxo iu1omeemics t)aDurx ono1tpx mi3iadfa raums;(0teermo3ootop  livs ( teum(m3ou1lmt lfci t)sDrr(rpnu0tltoiictltla um(vp t4 rxoxf3todlp  auvi;t)trtm(rpiy1ll e nvilt  2tru pou0oleomociyd aDemuvs u4 lerxo3io1fatelivo (0srxrxr oudlmen fvt tfa2rmxm ou0tltomf3tlsfm ra(mpnu) rtoxo3ia1fa ran o t  rxrxm3io4ol n fci s)arrmumpnt0opeo fciltfm ea( p;u4 ltnmr oa1la rlneo;( setoim iu1lm   ietlt  Dumurpnt4apeoiiciasfm2rau s;u4teenmf tatlaDrauei;s s2toxr io4omtemfvias srtrumpnt0oee  o3iadfs2uln pnu4trtomf3oy1lptr ieslt0 eurio io1ome mncilsfa2ta(rp;t4oeto octad m um( o u)alxnmf3oodlmD  n ol(0trto(r nudllenmnesat)sruru pnt1aexnifeiyt s uluvo u0aexrxf3oodoa elivo t0seum(rpoo1lmt lictl(fartrxrpot4tetomi3tadfsDumu s t0tlxoxocta1laDrluei;s s2umio nydom emfct ( s2raurp;u0oeeoioetys sDrm(mo;u)tltomr iytfaDrli s;()teum(r io1lme  ivtl(fs2tmump;u1olxoif3iyt a ulnmpn(4trxrmfciy1optr iei s t2uoirpio1lptemfciat s2tmumont4oex mfeiydfmDulnvpnt)tlxrmf3iadlp r n s s sexrxopnodllt lfcil( srrmu ont1oeenmoeildfa emnms;() lxnmr3iytlaDeanvilt trtmio iu1lltnmiei tfs2tmu onu4oexnmoeiatfs2eau p u)arxrmoctytlatrlnvs;(  rtrxopoodlm n ictl(faDta( pot0aptoio3iatlm rau p t)trtnio tytfmD  n i s)srtmir nu4ol nmnct (fsrtru oot1apen ociydfs2el(mo;u0arenmr iytfmD  ieo s s2toxo3iu4lltemfesl( sDrrxrpnu0teen ictydfs2elumsn(4teeoio3io1faD auvi t0s2xrio3oy1amt mnetat  Duax  oo0tlenio3iysfaDum(vp t0arxrirctodoaDr u o;(  rto(r oo4om  mietas arurx o;t4texniocildls uaums ()aeerxf3iadlateaies t)t2xriopnudaptn fcs () 2urxm no1tet  i3iltfm2rln o;()trxrio3io1opDeau o;t0sexoio iu4ol nmictasf Duaxro;t1tpeo o3ils m uanvpn(4 reomf3ty1opte neo;t0t2urirpno1amtelfesa(  2ta(  nu4texoiiciltlm2rm(ms u4 rtnxr to1lmD ai sls tetrir nu1apee ics s)artaxr no1altomfctaslsDeauvonu0trtrir iytfatelues t0teuoxrpnu1opeemivi s) rum(moou1apenmoeiat s um(mpn(4altnir totfpteanvi s0t2uoim nodop emnetasf 2tmu pno1aexniieiytfaDelump t0tleoirctodlmtrluvo;t)setrxr3oo1amtelfvsls) rtaxmoou1alxo o3iyt a rlumo u)arxnio3tatoa rlivo t  2xm(m io4ol nmnvtls)srraxr nt1apxoiietys a2uanmpn(4artnmo3oy1omD luvi s setm(r3nu4lle lics sf rtau pou0opxomfetaslaDrl(vp;u0teenmoctatomtr neo;t)trtoirpnydopee ncsa(f Drax  ;t1oee mo3ildla ul( pnt4 exrir tytlpteanvo;s teuo(r ou1omtnmfes tfsrtrur ;u0tlt if3ilt s2um(msn(4arxnxocootfate n i () rxrxm oodol  lnet sfa2urx  ;t4texomoeiasls um(mp;(0aexomr iatlmDraivilt0trtoxrpoo1am elfviasfsDtaxr ;o4opeo oeiytlsDra(vo () rtrxocoydfmt livi;t0srxrir3no1alenlnvilsf 2tau p;t4apenio3tytla2eaumo;() rermf oatoaDrluesls0s2uo(o io1omtemivsat)s2raumpot1tle  i3ild s2rmnvpnu0 etoif3iadlp  aneo () rurir3oudomtelfesltf Duaurp;o4opto ietatls2rl(vo;(4 rermf3ia1latr n i t) rtrxo no4oltnlivsa() 2ra(rp;t1oexo fctysfm elu s;t0aeerio oadfpDr nes;s  eum(o3oo4ll n ncil()s2tmx  nt4ape ifetatfsDemuvo;t)tleomf3oo1latrli sl(0t2xoxr3io1lm n fctat  rtm(ro;t1alxnio3ilt sDra(vp ()texrxf3oy1oa rau s;( tetrimpiy4ape  ivtls s2tmx ooo4opeo octys m2uauvsnu0alxnir totfmt luvols trxo(m3nu4ll nlnvia()aDraxmoou4oet mf3iltls rmnvs (4aeenif tytom e ivi;s0 eto(m3nodolt livslt arta(  ou4alxniiciyt a2elu p;u)teeoxo totlaDrluvo () eto(mpiu1omtnmivilt arta(rp;t0tlxn o3ilt sDum( p u4 lxoio oodlp eau i;( s2xm(m iu1alt lfvils)sruru  ;t1tlx ioetasfaDumums;u4 eenxociadfp rlu s;( srxoxm ny1omeemicia() Dua(rpou0alxnifeiys s2el(vs;(4aetrioctatfa e ieolt t2trio oudolenlnvi tfarumu p;u4tetoioeiad mDelnmsn(4 eenxfciatomt an slt)t2xrir oo1lpenmfvsltfa2ua( pot4oetn iciatfm2ra(vs;()arenif iatfp elies t0seur(rpny1lltemicslsfarraumo;o0tpto ietltfa elnvon(4tltoxfcto1fa eluvo () 2tr(m3no4omeelicia(fs2rmurp;u1tlt  f3iyt mDran o ()treoirctytopD  n o;s0 eum(opiy1ap n iciat arrmxrpot1oleoiocils s ran o ()artoio oatfm r nesl( trxoirpnu4olenmfviasfsrrruro;o0openmi3iydlmDuln pn()tetnmo totfatr i s;( s2umir iu4amtemnvtat  Dum(rp;t4alx  ietldlmDuan p t4 renif3iydfmtraueo;s srxr(r io1ole  ncsat a2uaurp;t1tpxo f3ias s2ua(ms;(0 etnio iotlpD  uvo;( srtmim iu1opt  ncsls)s2taumoot1olen o3ilsla ea(mpn() ltoxr tytfpDrli ilt)tetoxo no1omtn nvsatfsrtm( pnu0tet mi3tlsls2ua(vo u)aetriocoydopDelueo s0 rxm(mpou1lp nliet tf 2tm(  no1tleomi3ildlm2umnms;t0 exoxoctotfpteln ols)s2trxr ou4lleemfcilt) 2umum no4opx ioeias s uln snt4 ltomfcoo1fpt aueo;s)srxrxm3ny1omenlnct s  Dta( ont4olx iiciad sDrlu o;t4 eeomrctodlmte n ols  2tr(m nodamtemietasfarum(mooo4tpeo f3iadfa2em( s t) exrxocootoaD au s;s srur(opou1omenlnct sfaDrmxm ;u4teen f3tasla em(vo u)trxoxf3ta1op  aueo s) ruo(opoy4ope mfei t)a2uaurpoo1tee ifciasfs2rm( s u)arxrmr tytfm e u i t) 2uoxr iy4ole miesa()a2rr(r ;o1alenii3iaslmDul(vp u0teeoir3oo1fpDean sls)t2xrxm oodap emict ()s2trxront1tee moeiltls rluvon() etrir oytlatrlnvol(  eumir iy1ll e ivil( s2ta(m ;u4tpxnmoctls sDul( o;u0altnxr tydoaD  neo () 2tmim3oo4amenmiei s arraur nu0oet mfciadlsDul(vo;(0 etrmrciytlaDeai ol( srtoxr3oo4ame miesasfsrtrumont4aee mieiyt a2rmnmsn() exrif oo1fmtrln slt  rtmio3oo4lmte ictat sDururo;t0olen f3tys mDua( pnu0tlxnmrctadop  lueo (0 2urxm ny4omtnlnes s)arua(mp;o4tptnmfcils aDrlnvs;t) reoxoctodlp eln i;t)srtmim iudol  mivtl()a2rmxroot4apeoifctasfs ea(ms;u4tltnir3io1lmt  ivol(0setmxm ou1lpt lici s s2taxr ;o0optoifeiydls emnvsnu)alxomf tadla e ues;( seur(m3ou1ap nmnvi s a2tmxmpot1tlxnmoctasfs eau pn()teeoio3io1oatr nei t)trumim oydlp emivsa( aDum(rpou0tpxomociysla ulumo;u)tlxoxr3ia1lmt  ieo s0s2xmio3nu1al emfet (  Dtr( pnt0teeomiciytls2elu onu0altnio3tydlpDrlu ols sexoxopnodole  nvt tf Dur( o;t1tlen fctyd mDranmp t4trtnmr tadlmD an ils0 exo(mpou4amt lnes s sDtauro;t1olt mociytlm2rm(vs;u)arxrmf3to1lp ranes;s s2uoxo3iu1lltnlncs () Drau  oo0tltomfctld a2ea( o;u0 etriocoy1fat  uvs;( setoiopiu1lme lnvias aDtauro;u1olt ioctaslaDul
\ No newline at end of file
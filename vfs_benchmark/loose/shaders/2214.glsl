@@ -0,0 +1 @@
+ivo s0sruo(rpnudomtemivtl(f Dtmurp;u4olto i3iysfs eauvont)aeeniocoodfaD anes;(0setoxo no1lltnlnvs sfsrrr( pnt0texn oeiys aDul(vp t4aetoioctydfmte uvo;s)srxm(r3iy4ame  nci t a2rr(rooo4aptnmietytls2umnmonu0trtnxr3oydlaD auvo;s tetmxmpoydllt  nvtat  rta(mpno0tptomo3iadla ul(mo ()alenio3ta1oaDeanvs;(0 exrim iu4ope  nci tf rtmxmp;t1oeeomoctytfs2ranmo (4teeoxfcio1lmDrluvi;s0s2uoio3nydol elfcs t) 2tr(mono0oexn fciad sDraums;() eermo oytopD an sls srtrxrpou1amtnmfes s)aDurx poo0aetomoctatla2ean pnt0tlxnmf3ootfmDeanvi s0 exrxr3iy4ap n ieslt s2ra(moou0tetoiieiadfmDeanvo;u)treoir3iadfmD anvo (0 etmir nodam e nes t sDrmx o;o1tlen o3ilslaDrl( p;(0trxomf iotom raneo s)seur(mpnydlm e ivsasfarta(ronu1tpto fetadlmDel( pnu) etrmf3ia1fmDraueilt0srto(o3nudaleelncs ()s2rrumont0aetn octyt a rau o;(4 reoif3iadoa raiei () exoxo nudol   netat  2tmx oot0alt  fetld m umumo;u4alermo3oytlaDelues s trtmim iy1lm  mnvs (f Dtrumoot1aeto oeiadla2emn onu4 etoif3totfatrlies (0srxrir iy4amte nei (  2umumono4alen f3iatfa2um( p (0 rxrio3ty1opDraues;t0 2umiopoo4alt lfvtl()srumumpou1opxnmictytfsDumuvp ()alerxo3tatopDr n s;(0 exrir3oo1lmte nvi (fa2urxmooo0tpx  f3tasfs emnvs (4aeermr tadoa rluei s)tetm(o iudam  mfctatfsDuru ono4teto o3tydfaDuanmo;(0tlerio todom rli i s  2xrxr iy1lpt livsas)a2ta(mpou0texoiiciatla rmuvo t4aexrxf iytfm  lieolt  etoxo3no4amtnmfei t) rtaxm ot0apxoiiciaslm2umuvp u4arxoirctydlpt lu ol()t2uo(o3oy4optnmnvia(fsrur(mpnu4oetnmfcildlmDrmnmpnu) etoircoodop r neilt  etrxo iudll e ncsasfs2uaumono0tleoifcilsfs rlu p;u)aexoxfcoodfa r i o t)sexr(m iu1ap e nct (f rta( p;t4oexn i3iytla2ua(mp;u)treomocoytlaDelnvi;( setoxm nu4ap  mfesls)a2uaxm ;t0alt  ocildfm eaumsnu0trtrir3iodopDeauvs ( trtr(mpnu4ap n fvil(fsrtr(m ;u4alxomociydfsDeau p;(0artomo3tadlpD auvil()tetmir io1lmtelnctl(  rurx pou0alenio3ilslm rln p t0 eeoirciydfmDe i o;t0srumio3nydlmt mnci s  2ur( poo0tlenifciad s umu s;t) exrxociydoptrlueo t) ruoxmpnydlmtelnetasfs2rmx  ;u4texnii3iatla2ran pnu0 rxrxr todfmDeaieslt  etr(r no1op  mici () Dtm(mpnt4oetomi3iys m2rauvp;t0alxnmo iatopt  ivslt0 etrir3ny1lle  feiat)a2trx pnt4aleomfeiysla eaumpn()altrif iy1fp r ues;(0 2toxr no4alee nvtlt a2ta(  no4apx mfeiytfsDuanmont) rxoxf3iytla ran s;t)seurimpny4olenlicilsfs2umxmono4aexo f3ias s2umnvo () eenio3ootlaD  ivol()t2urio oo4lpeemnesat sDtm(m nu4optoifciatls el(msnu)aetomocoadlm eaivi;(0texr(o no4lme  ivia( sDtr(m ;t4aexoifctasls rmu o (4aetoxocto1fmD aies;t0s2xoxrpoydom emics s srum( poo4tleniieiyd sDeaumsn() renxf3to1lpD aivils0srtrir oydom nlnct ()aDtmxmp;u4opx iictys aDea(ms;(0trxoxrciydlm  lieo;(0 etoirpou1am e fctltfarta(rpoo0teeoifeildlmDrl(vont4trerxo3todfmt auvol( t2xmxr nu1oltemietasfaDumxmpoo1apt iieiltls um(vpn(0arerir3iydfateanvs;( setr(m3iu1lpenlfei t) 2ur(moot1apto ictyd s um(vp;(0tetnmf iotfp eln s;s0setrxr3iy4omenmfctat s2truronu0aeeo o3iysfm2ulu pnt)teeomf3iodla r i i;t)trur(r3io4apee icta( s2ra( p;o0tlen fctydfsDemnmsnu0tlxnxf3oydfm   u i t)t2uo(r iy1ol nlfvt t  rtaxmpnu4opx miciys a ea( pnt4alxoxo3todfpt  nvo (0setr(m3ny4openmfviasfsrraxmpot0apenifeias mDemumont4 eenifciotfaDrauvo t) 2um(rpoo4amtn nvs t srtaum nt1olenifetlslm2umump;u)tltomf ta1fpDe i s ( srtrxo3ny4ol  lictlt s2tm(ronu1aetoiieiatfaDrmu o () rxomo3oy1opDe uei (0 2xoiopoy4oltemfviat) Dururpot0aexomfcild aDrm(mpnu0altoxo iydlmteluvi;s teurio3oydapenlieia( sDta(  no0olx ii3tysfm2ranmont0tlenmr iadopteaivil(0 rxmxm3iydaptn icta(f Drr(m ot1oexo ocils s rmu s u0 renmf3totlmt anvs s  2toio oy4ol n iet t  Draxrpou1openmo3iad m2uln sn(4aetnxrcoadlpt anei s s2toir ny1lptn fei sfaDtm( pno4ale mfciltfa um(ms u)trxnmf3oytoaDeluvi s  eumxo3ny1am  lfeils srtm(m no1oet ifciytfs ul(mont0aeenio to1opDeluvo;(  exrimpiu1lmen iesat a2uaxrpoo0aeeo ieiyd sDrmuvo;t) rxrxfcio1fpt lnvols) rto(r3oy4llt livta()a2tax  ;u0apt moctas m2rl(vp u4arerir ta1fpt lies ( s2uoxmpnu1al eliet (fsruaum no0oeen ietasla2ua(mo;u4 etrif tytfa eaues;t0trxoxm iu1lle lneta(  2umxr nu4tetnmfeiadfm um(vo;t4alxnmo3ootlmD aies;t)sexo(rpoy1ale  nct ( aDrm(  nu0opt  ieildfmDea(mp u0 etomr ta1fa r ueils)tetmxrpiu4amtemfvsa() rrmxm ;t4tet  oetldfm2rmuvsnu0trtoxr ia1la  lieo ()setoir ou4openmfciltfa2rmum ot0apxoioetytfa2elums u)alxrxrcto1omtrluvs s s2toxo3oy4amenlfvtasfaruaxmonu4oeeomfetlsfaDuau p;(4 rerxr oa1fpte n i;()s2xoxo io1om   ncia()aDumxmo;t4tpeomieiltfa2umuvsnt)aetnifciotla   u ols teurxr oodopenlfctasfa2tm( ono1opt mfctltls2emuvpnu0 rtoxf iytlptrauei;(0s2tmirpiy4llen ivslsfsrur(mo;t0alen ociaslm2eau o;(4teeoiocoy1fmt  n o t seumir3ou4optnmfesatfarur(rpno4olxomiciasls2uan s;u4tlerirctadopteanvi;t0srxrim3oy1ll elnvs (f Drm(m no4tptn o3iad a ulu p;u0 rtrmr3ta1laD aivi t0s2xr(r3iu4lme lnei s)s2umum no4oltoiictyt s2rm( o;() ltomr3ta1fp eluei t seuoxopiodapt mnvt (f 2tm(mpoo4tltoii3iad s umnvp;t0alxoif3iatomDe iei;()trtrxr3iy1llen fesl(fs2raxr oo0oltoiiciydfsDul(vo;u4 lerircoa1oa rau o t sruoxr3no4lp  lfesltfs2tm( onu4tet ioctysfs emnmp;(4artrmf oadlm  lies;s0 ruoio3oydll emnctls s2tmu o;u1aeeomieiyt a uau on()teeoio3totlptrln il(0 exrim3nydoltelnvtas)a2tr(m ot4oee ifeiatfs2eaumsnt0tlermr to1fp rauvo s) rtrxo3ou1amt lfci s)srrrxr ;t1tpx iiciltlm ulums (0tetnif ootoa rlueo;s trxm(m3iodlme lfcsa( aDraxmp;t1tpen octadlm2ra(vp (4tetoirctydoa  aueo;t  rxrim iydlpe micsl()arraum ou4oet ioctydla ul( pn(0 lxoir3tadop raneil()trxr(o3oydlle lncslsf Dra(rpnu0teenmo3tas m2uan pnu0aeenir iytfmtr nes;t0 etoir ny1omtelfvtatf 2tmuro;u0tpxn i3iytfs2rmu pn(4texoircio1opte nvo t)setmxrpiy1lleemneia( s2tmxront4alenmo3ils s rluvsnu0tetrxo3io1fatelivo;s0s2xm(rpnydlpt micias)aDrmum ;u1texoiocilslsDel(ms;t0teeomo3iadlp elneo;s) etoir3iodomtemfvtatfartaumo;u1tet mf3iydfs2ea(vo u4arxnmocto1fptelues t teumxr3oy4lm   fetatf ruaxmpnu4aex iiciatfa el(mpnu0tetrxf3tatla ean slt)s2um(o iy1al   fvtlt) Dumuroou4apt  ieiys s2eau pnu4aexnir3iadfa  liei (0 etmir ny4ap e fcsl()sDrm(m ;u0teeo ociys mDum(vo u)tetomfciytlmtean o t0trtoxo oydop  mietatfsDuaur ;o1alx io3tysfmDeanvp u)altomo3iotop  auvs;s)t2xmio ny4ope lfvsltfarrrurp;u0aeenmf3iat s2emnmp;u4tetomf iadoatr iei ( srxoiopou1ap elnvs tf Drm( o;t4opxn fctad m2uau s;(0tetrircoa1latelueslt0s2trim no4omt  fvsa()s2ururp;u0tpe io3ilt aDrln snt)artrir3oo1omtrlu i ()s2trxo oudlp n net t  rraumono0tlt  i3ilsfsDrmn onu0teenmo3oadop rln s s0seuoxo3oodam emnvsl(faDrru  oo0tpxnii3tydfs2rauvs;(0artrmoctotom rluvslt0 exm(m3nu1aptelncias) 2tmumpoo1optnmiciyd m rmn p (0 rxrmr3iotopD  iei t0s2xm(r no4openmfcs tfsDumx pnt0tpxo ociat m rmnmp u0 exrir oytoaDeai o s0srxrxopou1omtnliet s  2ta( pnt4aet mi3ildlm rln ont)tlenxfcoytlm r ueils)trtoim ny1llt mfvs sfsrum( oot4apeomoeias mDrlums t)tleoxocty1laD au i;( teuoxr ny1alt lncslt) Dtm(m nt0tpt  f3tatfm2ua( o;u)aetrxocoadlm rluesls)setoxopio1lmeemfvt t)srta(  oo0tltn i3iadfsDean snu0 etnmo io1fptelueol( seumimpoodole lnctat  rtrum oo1aetoioeiyt a rmnvp u0 exomo oydfa eliei t) rur(m3nudom  lfes sfaruru pno1olxomfeils mDumu o (4aeeoifcoydoatraies;(0srxrxmpio4ape  ivsl()s2rax o;o1ope mfetatfm ua(vs;u4altrxrcia1omt  uvolt) rxr(m3oy1lptemnvil() Dtm(r ;o0altnifeild m2rmu pnt4tlxoxfcootfmD anvslt)s2trir3nu4ol elivi (  2rr( pnt4alxo octld sDeanmsnt0trxomr iydoaD li s;t  rxm(m3oo4amtnlfvtas)a2rrxm ;o0oex ioeiytls2rm( p (4 ltrmf iadfm r nei;s0s2tmxm oo1oltemivi s s2rrumo;u0alt  oetysfs eanmo;(0trtnif oatfaDe n i s0sexm(o3iu4ll nmfeias srumxmp;u4tlx ifctatlm2eanmp ()altnmr3oa1omD  uvi;( srxrio oodoptelivia(  2trump;u4texo fciadls2ul(vp;u) rxrxo iodlaD aueslt srtoxopoydol emieia(f 2urxm nu4alxoifctydlm2rl(ms;u4 ltoio oodfmte i s;()teur(opno4lmtelfvias)aDumur ;o0optnmi3iltla umnmo (0 rxoxo oytlpte ieils)sexmim3ny4ll  lietltf rtr(mont0apeoiocildls2emn s u4teerir3tatlate neols  2xoxm3oy4aptnmnesltfsDrau o;t1apxoifetldfaDemnvo () lxrif tadop rluvs s  2umxm3io1lmenmies tfsrtm(r nt1oeto fciydla rlu o;(0alerio tatlp elneslt0 rtoiopno1amtnmnet t) Dtrx onu0oeeomfeiadlaDumnvsnt4 rxrio3oytom e i o;s)t2xo(o no1lp e icta( arua(monu4tptnmi3iad s2elnvs (4artrxfciy1lp   i o (  euoir oo4oltelivs t) Drmxr ;t4aex iociatfs rmnvo;u4arxrxociodoateluvs (0 2xoim no4ll   fvi tf rrmxr nt4aee  octltfs um(vo t0 exoir3io1lpD li o () rum(o3ou1oltnlnct () Drr(mono1olxo o3tadfa2um( pnt4aleoir ty1fatelueols) rum(o3oo4lm nlnvsas) 2taxrooo0alenioeild a rln o;(4 rtrxo3to1lpteluvilt)srum(r iu4apeemnesltfaDtm( o;u1olen f3tlt mDrm(vsn()aeenxocoo1omDeauvi (0srurxmpio1ame  ncs sfaDur(r oo1opxn iciasla ua( pnt4aeeoio3iatlm rai i;t  etmxo oo1omeemfeil(  Drmumpno1tlto ictytfs rlnvs;u0 rxnxo ty1opDelu o () 2uoim oy4lpenlfesa()s2tmuro;o1tleoifeiyt a emums u0aetoxf todlm   ueo s0 rtr(o iudapenlieiatfaDuax  ;u1apxo o3iaslaDuanvs;(4treoio ty1la  lieol( srxmir3oydalenmfcsls arumumpou0olt ifetadls2elu p;t4 etnir3iy1oa r ueo;( s2urxr3nodalenmfetl(f rrmur ;t1aeeomocildfm ran p u0arxoxoctodlpD lnvil( srur(r iu1alenlnetls arua(r oo4ape moeias m rln onu0texrmrcoydomDeln o;s0 exoir3nudlmt  ictltf rtr(mo;o4aet if3tadlsDum(mo;t4texrmr3oytfptrlnei;t) rxr(o3oo4oltelnctat) Dumxmpoo0alx io3iat aDum(ms t4trtoiociatoptelu i;s0 exr(r3oydlm  mfvt tfaDuauro;t0olxnmfcild mDemnmp u4tleoif3todlaD  nvi t  rxoxmpiu4am  lnvta()arrmx pnu1teto feildlsDrmnmp;t4 exomrciytoat  n ols  rtrxopnydom  mnes (f 2ra(mpnu4alxomo3iysfm ea( o t4texrmf iodlpteauvil( srurio nydomen nvils sDta( ooo0alxnmicildlaDrauvp;u0tltrxo3oo1optr n s t)teumxr3ou4llt lnciltfs2rm(rp;t1tpen fctlsla el(vonu0tleoioctatfpD lnes;(0 rxoim nodomenlfeia( aDumumpnu0tetnmfetydlm2umumo;u4altrmrciotoa  li s;s)trumxm oudole mfciatf 2ururpoo4olxo ociatlmDemnvpnt4texnio todfmD  ivi t0srxrio io1lpen fciatfa2trx pnt1texo f3tyslmDrm(vo;u)tlerio3oy1faDe uvi s teuoxopiy1apeelfet sf Duau p;t4tlto icildlaDel( o;u)trtrircoo1lat  u s;t) eurxm3nu4ol nlieil( sDrr(m ;u1apxnif3tad m rl( sn(0tltnmr oatlaDeliei;t t2xoirpoydole  iciat arrr(r no4apxoifetltla umnmsnu4areoiocoydlaDean ol( s2xr(o io4apeemfcsa()arurxmpou1ole iieiyslm2uan snt)alermr tadfmteaueolt s2umiopnydamtnlfeta(  rururp;t1opt mfctysfs rlnmsn(0teerio3ia1lm  aieo;s)s2xo(o oy4lme mfvilt)aDrrxm ;o1apt  o3tydla2uauvonu0 rtriocoadlatr iei;t0 rxrir3oydopt  fvi tfa2ra(r no4aleo i3tydfs2ul( pnu4tetrir3oy1oaDeaieo;s) 2um(mpou1ol n ncs ( arua(  oo0ole  fctatfm uanmo;u4 rtoxo ty1lpteauvi s) 2xmiopiudol nlietas)srtaurp;o1tlxomoetldla ean s u) ltoir iatopt luvo ( srurirpio4ol   ies s)aDrmxm oo1tex mictydls ran o (4aeenxr3iodlm e n i;s0t2um(o ny1lleelnet (fa2tru oot1oet  oeiasfaDem(vo t4 ltoif3tytoa  luesl(0trum(opnodlm elnct (  Dta(ro;t1ale ioetydfa2eanmpn(0artoir oodfptelues t0 rurxm3iu1lm e fvsa( srrmxmpnt0olen feilt aDuaums t4trtoio tytlate nvi;s) rtmio iudopeemietat sDumumooo1ope mi3iyt s2eanmo t4tlxrmo3oo1fa r ivi ()trxoxrpnudaltelfct tfartr(m oo1oeeo ietatfa rmnmp;t0tltoir ta1fmte nvs (0 euoir3oy4ap e fetl(fsrtr(mpnt1alxoiieiasla2ean snu4 renio oytlatrluvolt truo(m ou4omtemnct sf 2ur(r ou4aetnmfciyslm ea(msn(0altrxrciadlmDr uvs;t texrxm oodlp  miei t) rrrumpnt4tpxo f3ildfmDua(vp;u0aeermf oydfmDrluvils0s2um(o iudop  lfcta(fsDtaxr ot0aee  o3iytfmDelnvpn(0aetnxf iotlmD anvo;s)s2toir3no1optelieias) rtau  nt0tltoioeiatls uln ont0 etoircta1lm ranvs t0truoxo iu4lp  mnvt sf Dta( pnu4apenif3ias m eauvs t0arenmfciy1lm  auvs;() ruoxopnu1am  mnes t) Dumumpot0ale iicild a2emnmo;(0 ltriocio1laDr ueo t seur(opoydlmeelieil( a2ra(moou4apeomf3tat m ua( o;(0tlermfcta1fateanei ( texoxo3nydopen ieslt)a2taxronu0tex  fctlslm elnmpnu) rtoif3iydoaD au i ( sexoim ou1omenmict tfsDtaxrpnt0tpe  f3iysfsDemu p u4 rerio oydlpDr ivs s0 exoio nudlle  icsatf rtmum oo4oeeoiieild s rmnmpnt)treoioctydfmDeluvi s0srxr(mpoy1lptemnctlsfa2rmxro;u0oexo i3iat a2emnvonu4texrio3iy1lp raivo;t0texrxmpoy4apee ncil(faDraumpoo1tlto f3tytfa eaump;(0 etnio iydfmteaiei;(0 eum(opny4ll nmfci tfs2umu o;t4teen ieiasfs2uln sn()trxomfctatlp  lu s;s)trxoir io1ll  mfcs () rrmu pnt0optn fetldfa uan sn() etriocoytlmt aueols0 rtm(r nu1aptnlicsas  rrmur no4tetnif3iat s emnmo;u)arxnxr ty1faDrlnei (0s2tmir no4ap n nvtltf Dtr(m nu1aex  feildlm el(vo (0 eeomf oy1fptr i s t0 2uoiopoudap emietltfs2rr(r ou0olxn i3tlsfm2rlnvsn() ltrmoctodomtrlivi t  etmxrpny4oltelfvil()s2trxrpoo4oet  icilslm2elnvsnu)alxrmr oo1omtrau ils0trtrim oo4lp e fvsl()a2uaxr ;t1oeenmf3tat aDrauvp t0teeoio3oydop rau s t0 exmio3iydaltnmiciat) 2uaumo;u1tptoioctld m rm( pn(4 lxnmo3oadla elu il()srtoio io4ale mfvtltf 2uaurpnu0olx mo3tasfsDelu sn(4arxrir3io1oaD aies;()t2xr(m no4ap nlnvs () Drrxr nu0oeto fetydfmDrmn s u4aetoif3oo1lmteanvsl(  rxoxr iydomenmnvilt s2taumpnu0tpeo f3tytfaDrmuvo t0 rtnmr3ty1oat livil(0s2xmimpoy1alte fcsas  Dtaxm ou1apeo feiytlmDrlnvs;t)tltnmo3ia1lat ln ilt0trxoim3iy4ome miciat artrumo;o4optomfetldla2ua(vs;() ltoir3ty1fmtrau i;s texmxo no1amte iei ( srtrxmp;u4olxomfetlsla2um(mo t0artrxoctadoaDeai i;s0tetm(o oo4ale mivsas aDuau p;t1aeeo o3ilsfs2elu snu4aeeoio iydfa r n ils0 2xrxm3oo4ll e icil( aDurxm ot1altn icilsfa ua( pnu0tlxnmr3tytfa  lu olt0 eumxopiydapenliviat)s2urumo;o0tpxomieilsfsDuanmsnt4alxoxrcoadfpDrlnvs (  rtoim3ny1apenliet ( a2um( ono1oexnmo3tadls2emn p ()tetnir io1laDranesls0 euoxr3iudam   ieta()srraumpou4aetomfctldfa2emn onu4areoxrcoydlp rluvs (  rxmir3oy4aptelnvil(f ruax p;o4oex  ieiat mDeanmont0arxoio iotfpteanvs;t)srur(rpoodop emivslt) 2trum ;t4aeenifeiatlm em( p;(0arermr totlp  ai s (0texmxm iydlme mncsl() rurxrp;o0tpt  ocilt sDulumo u0areoio iytlatrln i t0 rxr(rpoudop nmici sf 2tm(r ou1opxoifciltls2uanvs;() etrxo3todlmD  nvs;t0 etrio3nudlpt lfctas) ruauroou4tetn oeilsfa eanmo;u)alxrmf oydfa  aiei t)t2tmxm3oodlpt lnet tf rrm(roou0tptnmictatlm umnvsn(4trenxocoydlp r ivo t)seumim no4omen nei t sDumxrono4tltn ictltlm uln s;(0 lxomfcta1lmtr uei;s0 rxoirpoydll  livs t a2ra(m nu1apxoifeiasla2ua(vo;u4teeoifcoy1fp rlnvi s)t2ur(o ou4lm   fcslt sDtmxr ;u1teeniieiyd m2ea(vs;()treoir3tytfmtrlies;t sruoim io1lp  mneias) rum(moot1tpt mfciasfm eanvp;()artrxfctatoptrlnes;t0t2trxm ou4ll nlietatf rtaxrpnt4oeto f3ilsfa2eanmp () renmr tydfpte ivil(0trtrxo ny1amt mfvsa( a2tmu poo4aptnmi3iyslsDranmsnu)tltoxr oytfaDr uvs t teum(o nu4llt livi ( a2ua( ooo0aexomiciytfsDem(mont4aexoifcoydfaD an ol()sruoio iudamte fcsls aDrau o;o1oex  oeilt mDumumsn()trtnxf3oydom   ivi;t0trxmxrpiudol nmnvsasfsrrrxr no1alxomociatfaDran o (0 etrir3oa1lmt aies t  2tmxo3nu4lp  mictl()sDumx o;o4tpeniiciysls rmu o;()aexomr3oydlat  nes s srumirpno4lpenmnvtl( s2rrurp;t4ole  f3tltls eau pnu0trxnir3tytfptr ivsl() rtoim3io4lp nliesa(  rum(mp;t0alt iiciad s ean pnt0 lxnifcio1fpDe u ols0trxm(rpoo1op nlics s  rua(r ou4altomfcils s2em(vs u4tltnmr ta1lmtrauvi;t0tetoim iy1amt  fvt s)s2umu p;t0apeo i3iyt mDra( pn(0tltnxr oodoaDeluvil()sexoxm3iy4omt miesat  rra(mp;t0aptomi3iasfm2elnvsnt) lxrxf3oatla rauvi;t  rtrio nudol n nct ()arta( o;t0tle miciytlsDrmnvs;u)trtrirciatfpDe n o;t0srxmxopoydaptnlfcia()sDtax o;o0ole  oetaslaDrm( o t0trtnir tatfm eluei;s) rtr(r ny1altelncsatfa2urxmoou1oetomi3tadls ran p u) exoxo oo1lp   iesls  eur(r3no4ale lfvsas  2umu o;t0aetoifcildlmDuanms;u4 lxnmr iotlp elnvi;t0t2xm(r nudole  icsls)srta(mp;u0apxniociltla2eauvo (4 ltrmfciatlmD  i i t0srum(r oydopt lfetlt sruax ooo1tee moctysfsDem(vp u0 rtomf3oydfpD lieo;() 2uoxr nudam nlnesa( sDtaxmpoo0tpeo i3tadla2ea( pnu) renif3totfate nvol(0t2xrir ou1lpe  ncsa() rrr( p;t0aee mociadfa2rl(vp t4arerxocoa1lpDr nvil(  rtrio oo4ap e nvsa()arraxro;u1aeeomoeiasfa uanmp;t)tlerxrciotlm elueo;t0 2xrir3ny4llte neilt)s2umxro;o1tpe mociysls rl(mpn(0trtnxoctatfatran ol() euoimpiudapenlncs tfaDrr( o;o4opxoiictyd sDrm(mo;(0tleomf3oy1lptrlnei t0seum(mpio1omte fcs tfsDrau oot0aeeo f3iyt a el( on(4tlenxo3oatlm ean ol() 2xmio oy1oleemfvsa( s2um(mooo1tpeo ieiyd m ranvpnt0 rxnxf oy1opDelneo;t0s2xrim nu1opeemfcs s sDtrxmpoo1tpxomi3iytfa2uln o u) ltomocty1laDe u ils0 2xrio3iudlptn nctls)sDurxmpou1opt ifcildlaDuan s;() etoio3oadoaD livs;t t2um(mpno4apen iet tfartm(r ou1oexomf3iytfmDrm( s;()tlxoif3tytoptrlu o s  2toirpoo4omtemict tfa2rm(  nt0optniiciltla umuvo u4tltnxfciatoa  lu i s)trto(o oo4lpeelics (  Draumpnt1oexn fciytlm2umums;u4 rtoir tytopD lnes;(0t2uoir3ny1lm  mnvt t aDrm(mp;o0tetniieiyslmDranvo (0tltnxf3oo1fpteai sls srxmxr3nu4am  mieia(f Dumuront1tetnmoetadfm2umnmo (4trxrxf ta1fm eanvs s0 rxm(m3nodameelncia() 2ua( ono0oet if3iysfs ra(vs ()alxnxf3ty1lm eluei t)setr(m3iy1alte fvias) rrrurpou0opxoifctat a2ulnmpn(0trxriocoatfpD aneols0 exmxm3nu1amtn fcs ()sDrmxro;o0oeto octlt s2ea(von(0tlxoif3tydfp eluvo;s0s2xm(mpny1amtn fvslsfaDrau poo1oleomoeiltfm2ulnmp ()artnmo3ootfa eanvi;s) 2tmim oodal n feilsfsDta(  nt1tpxo ieiatfmDrlnvo () exriocoy1laDeln slt) etrxo oo1apt  nvs () rtmx poo4tlxo fctytla2rmuvp;u4 etoio totlmtr n i s  etmio3ny4lm emfcslt s2trxmpnt1tee  fetld sDrluvpn(0aexoxf3oodla  lnes s)setrimpoudom  mivt sfsrumxrono0opeomicilsfs2uln onu4 eenio oodlmte ueil(0texoxmpiydomt lneilt arrm(r ;u1tptnmfetldfs2rauvsnu4 ltoiocia1lptr nvi;( setr(r3iu1lmtemfei t arrrxr ot1olx ii3iad s2eanvp;(4arermocta1omtraies (0texoir iodolt  ncsasfsrtmumpnu1opx  ociysls ulums;t4 ltrxo3oodfmt anei;t)t2toxr3iy1amtnmieiltfa2umx pou0optn o3iytlsDeauvo t4tlxnxrciotlp rai i t)teumxrpio1op e neils)sDum(  ot4olenmicildlm ul( p t0 renir3oytlm  livo (  2xo(o nudapt mfctas s2trxrooo1opxoio3tad a2eanmont4 lxoio ta1la rau s;(0 2xmxm3io1omenlieiat)a2ra(m ou1ape  fctys a2umu on() etomrcoadoa e neols0sexoxr oo1olt  nvsas)a2umx  ot1teen f3tldla2ea(msnu0 rxrxocoa1omDr ieilt0 exoimpno4am n nctlt)sDrmxm ou0aexo iciysfa emu onu)arenio3to1lmt  n sl(0trxoim no4ol emncs s aDuau pou4teeoio3iat a el( ont)alenircoytfmDeaueo;()teuoxo iy1oltnlies s s2tm(rooo0opt if3ilt sDulums;u4altrmfcta1oa elneol( srxo(mpiodoltnmncsl() 2uaum ot0tet iieiltlmDuanmo;u0tlxomo3ta1oa   u o t0setrxopny4lm e nvt ( s2ta(moot0aet  feiad a um(mp u) ltnmrcoodfmDeli i;s  2umirpnodamenmfctls)a2umumonu4oexomoctasfs ua(vs;u0aeerir3iydoaDr uvo;t  rxoxr iu4lmee feilt)sDuau onu4apeomo3ilt a rm(mont4aexoxfcootfmtr ivi;t  euoir3iydol elfvtat a2ur(mpno0tltomoeiaslaDum(vp;u4tleoir ta1oa   neo (  rxmxo3io4amt mfvtlt sDtaxroou0ale  o3tydfsDuau s;u4tltnmr3iydopte ueilt)seumxopoy4op elfetls)srtr(rp;o4oex moeiatfs ulums () rtoxfcoodfmt aivs;t0 etoir nu4ap n fctlt arumum ;o1aleomi3iltlm eanmp (0arxnmo3oy1opD ai s (0 2tr(r nudlp  mietat) Dtaxr ;u4opxnmoeiasls2umnmpnt4 rxrxrcoadlateaueo t0trtmir3oydoltemnvs sf rraumpot4aleomoetlsfa ra( o;u4 etrxo3io1fmtelnvi;s0srxmio iudoltemnetls  2urxr ;u0tptn ieiys m rmu o u0trxoxr iodla  aieol()srxoxmpio1ap  lfvtat)aDrrx oou0ope  i3iadls uanms t0tetrmf io1lpDrln sl()truo(r3iydomenmfviatfartm(r nt4ole  f3iysfmDemnvon()teeoio3iadfp eln slt)t2ur(m nydam elfctas srururp;t1aptn ocilsls umu o;t) rtoir3oydlpteluvsl(0srtoirpny1lptn iet (  2umu pou0oet mo3iatls2umuvs;t)tlenxo3iotlmte u ol(0 rum(rpio1ap   ieslt  Dtmx p;t1alenii3iatla2eauvo;u0arerxo tytlmteauvs;(0teurxr iy4aptemfesl(f 2rm(ront4aptoio3ildla2rmnmp;u)teerxr3tytfmDe ies ( teto(rpoudlp n ncta( sDum( oou1alx  f3tlt m el(mo u0 eeomo3oodfa rau ilt  2urxrpoodapt mnei tf 2rrump;u0tetomfeiyslaDea(vsnt)aleoir io1lpDeau s;s  2uoxo iu4lmtn nvtat s2tau  ;u1alx mociyd m2uan o;t0trenmo ty1lmtr nvilt  exoxo3oydamtemfvsl(f 2ra(mpot0optnmiciydlmDulnvonu)arenir3iydfmDe ues (  rtrxr iudol  lnei tf 2ua(rpoo4aee  fetysfsDrl( o () eermr3ty1opDrlues s)t2urxm3ny4lpt lfcslt) Duaxr oo0ape io3tls m2uanvp (4tlermrctotoaDran s t0sexmir3oo4lle  fvsls)arumxr oo4altomoctasfsDrmnms u4trtnmf oa1omtrli o;()srxo(opnudll   iei sfsrua(ront0oetnifctytla umnmo;t0tlerxrciadfpD lieols trtrio3oudlptnlncsat s2uaurpnt4apto ictldlsDulu p (0tleoxfctadfpDr ivi;s0srtmxr3io4lle mivi s)a2ra(  ;t0tpx io3tld s2rau p u4aetomociy1oatelnvi ()t2xmirpoudom nlfcsa( artau  ;u4tltnifcilslm2rauvsn()trxoxf iotom r ieil()t2to(r3io4omtelfvt t arta(mpou4ale  o3iyt mDea( on(0 etnxo3totoaDeauei ()t2xmir io4oleemnvs ()arua(rpoo4opx ii3iydls rlnvs;u4alxrmr3tadfmt ai il()trxrimpnodamtelnvils  Dtm( oot1opeomfeiatlsDean onu)alermf io1lmD  nvs;t s2tmirpnodopeemfcils sDrm(r nt0oexn fcildfm rmn pn(4 exomr3iytfaDrlueols0 eum(mpnu1aptemivt t) 2rru onu4tet mfeiyt sDra(mp;u4arerxo oydfm elues;(0 2trxm3iu4omt mneiat)a2uaurono0apto feilsfaDuanvo t0 etoioctatfp eln olt)sexoxrpoo1oltelivsls  ruaumono4aleoiictlsfsDrm( pnt)teermr ootfpte nei t0sexrio3iy4ome lfcilt)srtr(mpno1opeoioetydlsDeanmsn()arxnmr to1faD  ivs;(0trur(o iy1omtnmnesa(f Dtaumonu1apx miciyt sDrlums;t0teerxf3oodfa eluvs t)trxoir3oodamt mfci sfsDua(m nt1tlenmieils aDuan p;(0texomr3tatfptrlnesl()trumxr oo4amt mncta(faDrr(moou1ope ii3iadls em(vo u) exrifcoy1fp eaiei ( tetoio3no1ll   neslt) rumxrono4altoio3ilsfmDrm(mo t4arerxrciatlm   i ol( setmirpnodlme mncsas)arraxro;o4tee ifciyt m2el(vp t)treoirciytomDeanei (0 etoimpoy4lleelfei s) ruau p;t0tlxomoetysla el(ms (0aexomf ia1fatr u i;s  rxr(m3iy4alt lnci s  Duru poo1alen oeiysfmDemnvsnu0trxoxf tydlpDelieo;t sexo(opoydlmenmfcias aDurur nu1apxomieiyt a2uanmpn()arxnxfcia1faDeauei;(0trxo(r oy1alt mnvsltfsrraxmpnu1ole  f3ildlmDumumonu4tltnir iy1oatraivslt)srum(opnydlp  mics ()a2tm(r no0aeenmfctat m ul(vont4alerxr3ty1opDe ueslt0s2xrxmpnu4om   ivi s) Dum(m ou4tltn oeiydls2rl(mp;u0tetoxf3iodfp ranvilt teur(o oo4al emfct t)aDtrxr nu0tee moeiytfsDumump (0 exrxo3ootlpDraueo;t)trxoxo io4amtnmiesa(fa2um( o;u0oet iocildls2emnvpnt) rtnioctadfp  luvo s trxrim3oo1lltelfcilt) 2tm(m no1tlx ifeiltfs2uln p;() eeoio3oadoaDelu o ()setmxopiudlltnlietat a2rrxr nt0tptn octys a eanvsn(4trtnxoctydlate ieol()s2um(o3ny1optn fes ()srrauroou1aleoifetyt s ea(mp u0aexnifcoy1lmt lu i s teto(m oydop emiesl() rtax poo0ope if3iadfs emnms u0 etrxrcoo1fpDeauvilt texmim iy4lp n neiatf 2rrxr nu1tlto fctasfsDem( p u4 ltriocoodopD  uvo ()sruoim iudale  fesl(f ruaxmpnu1ape iocildlm2eluvs t0arenmo3iy1oa  auvi ()srurio3iydaptnmivi sfsrrmxmoot0tlxomociad a2uluvp ()tetnxrcoadopDrlu i;s texoxm io1ol  lictlsfa2uau ont1oeto ociys a2raumsnu)tltrir3iatfa raieolt texr(o3nydolt mics ( srurxrpnt0texo f3tytfm2rmumo t4texomo3ty1op r ivs;( s2trxo3no4optemnct t)s2um(monu1apx mocild sDulnmp t)aleomr oodoaD ai il( truoxm3oo1omtnlnvt tf ruax oot0oeeomfctad s2emuvp (4alenxocoytfpte u ols  etmxopio4ap e ivsas)sDtax  ot1apenmfeiysfsDrmnmont4tlenxociadlp e neo;s)seur(rpoo1olen ivslt)sDtr(rpou1tpeomfeiat m2el(vo;t0aetrirciotlp e u o t)sruoxo3oy1op elneta(fa2umx ont4alxo icils m2umn o;u0 lxrio3oy1faDr n s s)sexoxo io1aleelneslt sDurx p;u0oetnifctyt a em(mo;u) reomr3oydlmDrli o;s0 2xmimpiu4oltemfei tfsrtrurpoo1tpxnifetld m2ranmo;u4alxnxr3iodop eaiesls) rxmio3nydllte ncsl()arrax p;u0aptomi3ilslm2ranvsnt4treoif3oy1om eau o s0trtmxo iodope lnvtls) Dtmu pou1tpxo ieildlm2el(mon()trxrmo3tatoaDeli s s0s2toxr oo1ol  mfcsa( a2rr(mpnt4oetomoctydfaDulnvp;u0 exomo3ia1oaDrlueo s) etrim ou4opeelnvtasfsDua(moou1aee if3iadls2umump;u)teenmrcoy1lp e ueo s0trtoim oydll elivi (fsDraxmp;u4tleo i3iadfm2rmnmpn(4tlxnmr oatfmt  u i;(0texo(o3oy4opte fctl()a2tm(mont1alxo o3tat a2em(vsn() etnmo3oa1fm   nvo s0teto(mpiudoltemfeta()aDuaumonu1aetn fciltfsDumumpnu4 lermocto1om e n i s)sruoir3no1lpeelnei t)aruaxrpou4aet mictytlmDrmnmo (0texnmoctydopDe ivs s trxm(o oo4llt lfei (fartaxm oo0tltnioctltla em( s;t0 ltomo3iatfpDeli ils  etr(r oo4omeemivt ( arta(mooo1aee ifeiydfs2emnmo u)texoxociytoptrluvo s) 2trxo3iu4am e iet t)s2tm(  oo0aet mieiysls2ulu snt0 rtomo ia1lpDeluvslt0seumxo3ny4ol nmfvsas)sDtm(  oo1aleomoeiytfaDrmn o ()teenxf oatlpDr ivolt trto(opiudom e fctltfarrru p;t0aexoiieiltlaDrm(vs t4trtoif tytlate ueolt  exoimpiu4lpe mictat arrrx  ot0opxniieiyt aDrln o (4artrmo ty1lmte ues s)t2tmxr nodlpt mfet s)aDta(m no0olxo fciydla2uau o u4 rxoif totlaDrau i;(0tetoio no1ll elnvsatf Drau pno0apxoiietas m ua(vp;(0aeeoxr oy1lm e uvsls tetrxm3iu4ome  ietatfs2umu poo4alt iiciadlaDra(vonu0trxoxo iatla r u o ()t2xrir ny1amt lfctl(farua(r nt4apxoio3tadfs2rm(vp t)tlxomo iodfatr ivils trtrxr3iodalenlnci sfsDur(m ;u1tpenmoetysls2uln p;(0aexrif oydfmteluvo;s tetm(opiydape  fvt s)srtr(root1alx mfeiatla umu pn(4aleoif ty1omD livol() rxr(r nu4amee iviasfsrrax ont4tltoioetls a2rm( p t4aleoiociytfmDrlu s s)teuoiopiy4lp  miesl( aDrmx oot0olxnioeilt s em(vsnt)trenmr3iatoa  lu slt0t2xrim io4lmtelfeiatfsruau  nu1tpeo f3iadfa ea(mp t0tleomr iodfm  luei ( srum(o oy1lpen iet t) rra(rpoo4oltn ietasfmDelnvonu0tltoxf3oadlmDrli s;(0srtm(o nodom   feiat  2trumo;u0alxnmfetyd a ua(mp t0aetnif oatlpD  i i s0 ruo(r nu4op emietltfs2ra(r ;o1olenmi3iyt a uau p t)tlxnxr3ty1oaDrlivs t)seuo(rpoy1om elivs t)aDtmx  ;u4tpenmociytlm ul(vo;t0tetoio io1faDeli ilt)s2xrir ny1lltnmfcsltfsDrrxro;o0aex iiciysls eluvs t0tltrxfctydom rau slt)srtrim no1lleelnesatfsDtax  nt1altn f3iltlsDea( p u)trxomr3tytlm  lueo ( srxriopio1al n fetatfa2tru 
\ No newline at end of file
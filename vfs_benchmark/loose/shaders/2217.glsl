@@ -0,0 +1 @@
+ieil( sexriopnu4lmenlict s  2tm(mooo4tetnmictlt m em(mp (4 ltrmo to1fat  u o ()srumiopiy4lmteliet t sDrrx o;u0aex  oeildfs emumonu4trenirciotfp  li s;(0seto(r iu4lm nmnci t  Dra(mpno1alxo octldfm2eau pnu) lerircoa1fmteaieil()srtmxr3oy4amt  fcsl(farrm(mp;u1alenmf3ilslaDranmo;t0aetoirciytla   ivs;t) eum(opiudam elncsas sDuaump;u4oexn iciltlaDra(mo (4tlenxociadfp ranesl(0srumimpnydomen netl(fa2rrumpnt4tlt ifctysla umnvs;u) leoxf iodfpDe u i;( t2xmim iy1ll  mfesa()a2raur ;u4aleomi3tltla umnvs t4texrio3iytopt lu s t)teum(o3io4opt lfcsl() Duaxmo;u4olenmoeiaslm2umn o;u0arerir3oodomt aivs (  rum(opiu4altnmietatf rtmumo;o1opto oeiytla uanmpnt4 ltrif3iytfaDrlu o t  2toxm3ny4openlnvtatfs2rmum ou1alenifeiatla2emums t4texrxfcia1lat au ol(0 2xr(rpiodlpte feias  2tmx  ;u1olx iieiatfa2emn s u0artoir oydfat livs;s)s2xoim3no4lmt liciat  rum(rooo1opxnioctas a rln o ()altoxrcty1fp  an s;s) rur(m3iu4opt mivi (f 2um(rp;u0oltn i3ilsfs rlu o () rtrir tadlp eanes t)t2tr(rpnodom nlfet ()s2rr(rp;t0opeomocilsfa eau s (4tetrifcoadlmtrlnvo (0srxr(opoy4lm e ivtat)aDtr( o;u0tetomfeiad mDua( sn()tetoxo3iydlmte nesl()srto(o3nudale mnetltfsDtm(m ;u1oexn ociatfa2umnmpn(0 ltnir tytomD lieo;s0 2xo(m3nydomtnmfcil( srrmur ot4tpeomi3tld m2umu p;t4artoio oo1laDeanei;t)srxoir3ou1alen fcta(f Dumur nu1aeen ieiltlm eln o;(0 rxrir3tydlaD  ivsls0 2xoio nudlpen ivslt) 2tmxront1olxoiietlt m2em(ms;t) ltnmo3oa1fpDr uvols)t2toxopiudape  iciat s2tru  ;o1teeoiieilsfa eaump;t)artoxr to1lpt  nvo (0seumxo3nudoltnlnesas artmxmpnt1optomietld s2um( p u)treomo3tatoa rluvs;s) rtrxm ny4llt  feta( s2rm(ro;t1tpt iictltlm rmnvp u)teeomf iy1oa   uvs;s0 etmim3iu1alee fetas) Drrxrpno4texnif3ildfmDea(vs;t4aleomf tatlmteanvi s0 2urio3oodole  ncs ()a2raumo;u4oex ifciatlm2ea(vsnu4trtoxr oy1lpt an s s0sexr(o no1lptelfeias a2rmxroot0opxo f3iysls em( snt4 exnxr oadfpD  ues;() rtrxmpio1ap   ivsa( srtr( onu4oexo ictldfa ulnms (4 rxoxf oa1oa eauvi;t0 2xm(r oy1lm emnvt s aDtm(  ;o4opxoiieiyd mDrl( onu4teerxr todfaDeln o t0t2toxm3no1lmenmicil(fsDur(rp;u4tptn o3tytla rl(vs;(4trerxo3oytom e ies;s t2trirpoy4olt  fcta() 2urumpot4ape ioeiasfaDumnmpnu0trenmo3to1opDe u i;s t2to(mpoudllt mivi s  rtrurpoo4tlxnii3iys a uanmp u0 rxnxf3oy1lmDeanvi;s trtm(m iy1ol nmnesl() 2ua( ono0alen i3ils m em(vp t)aexrmo3totopteaueo;s)sexrxr iy1ap  mncils)s2rrxmo;u1apxnmoctatlm2rlnvp u0 renir3iy1fpD  u i;t0 eumim3oudlm   nes (fsDumx  ot4tptoioctlslmDemu ont)aeerir3to1optrau i;t  rumxrpnodolt  nes sfaruaxm ot1ole ioctysfs2ul( pn()trxrmf iatla raieilt0srtrxr iodapt  ivia(fsrrr( p;t0apxo f3iadla2ul(vo (0tetoxr ty1opD anvi;() ruoirpiydll nlncsasfsrrrxr ot0tleo ieias sDelums u0 etrxrctatfat  nesl()srumio3oydom e nesls aDrr( onu1optomo3iasfm2elu o ()aeeomr oatlmDe u i t)t2uriopoo4amte fci t)s2tmxront4opxnmfctydlaDrluvsnu4teerxf tytlaDrlieo s t2uoxmpoy4om emictatfsDumumono0aetnio3ias aDean s (4tlenxf3iydoptean ilt)t2uoim nydoptnlnes t aruauro;t0alxoiietltls eau ont0trxoiociydoaDrluvi;t trtmxr3ou4alt  nei t a2urxroou0alxnio3tydfm eau snt4 reoxrciotlm e ueo t0texo(m ou4ome lfcilsf rrrur ot4tpenmicias mDrluvp (4trtomociodlpD au s;s0t2uo(m nodlptemicia()sDrru  ;o4apxomfctys sDemu s t) etnircoy1lmDe nei t)trxmir3oydope mfvs sfarumum ;t1tlxn icild a rl( snt)treoxr oy1oa eaueo;( trxoimpou4ap   ivt t s2tau oot4tpxoif3tys a rauvpn()tltrxf3tydoat luei;t0 2tr(r iu1ameemfvi (fa2tmum no4oexn fctyslm ra( ont4 reoxf3tatlm eli o ( t2urim3io4lmenmnvi ( s2rm(r no1ape mf3ils m eauvo;t)aeenxfcio1lpteli o t0trumxrpou4ome  ictl()sDumu ono4tpxnmf3ildls2umuvpnu4tltomf3totlptrauvol(0teumxmpnu4al emfcslt aDrru  oo1apt ifctltfaDeaums (0artoif iadla  luvo;(0 rtmxrpiodlpeelict ( a2tr(rp;t0apen ietydfa um(vpnt0 eerif3oadfaDr ivs;s seumiopio1op nmfeta(f Durumpnu4optomictydls2ran sn()trenxociatlmtrln s;t)srtm(o3nu4altemivta() 2rrxmo;u0tptnmoctasfm ul( p u)arerxf oatfptelu ilt tetm(o iodaltemfes t  rurx pnt4apx  fctydlm2eau o u4artnif iy1oatrlieo;s) rtmxr3nu1ol  lnviat)aDtmur no0opxnmo3ils s ulnvo;t4aetomociydlaDran o;(0s2xmio iy1ll e iet ()aDrru  ou4tlto feiatfs rmumo;t0treoxfcoatlm  aivs t)t2xrir3no4open ncilt sDra(ront0oetomo3iad s rlu snu0 lxoxr3oa1oaDe ivs s)truo(rpny4lmenlivtlt)a2ra( ono0oetn ieiadfm2ulnvpnt4 lxrir3oadlpt lneo t0trurimpiodal emiviat aDuaxmp;u4alxnifeiysfa umnvp u0 lenmo ootfm ranvs;t  rtr(mpiodolen nei tf 2tm(  ;o4apxnmictadfa emuvs;(4 lenif totlmDe nvs;t)tetoim3ny4am  lfvtasfaDrmx  ot4tpt  fciysfm2em(mpnu0areomr3tydfa e ueols)texoxrpnudlmt  feia() Duax o;o1aptn iciytfmDuau p t0altnmfciatfmDr nei t sruoir3nu1apt licsas  2taxmont1oeen feiatfsDulu onu0 rxoio3oydlm rlnvo;s t2xmxm iu4lpee iet (  rurx pnt0apto fctldfs um(vp;u0arxomo oodlpD luvi ()sexo(opio1lpe mietasf Duau  ;o0alxnifetydfs2ranvont0 lerxocoodfmDeai s ()texmim oo1ape miet s arrm(roou1tpxn fciatfa ul(vo u0artnxrcoydfaD lieo s) rxmxm iu1lmeelfctlsf 2uau pou1aee mociatls eluvpnu0altrxrctadomtr ieo s) exoio3iu4oltn iei s)srua(  ;t4tptn i3ilsls em(vo;t4arxomf3iytopt ln ols setmir iy4op   ncsltfsrtaur ot1opxomieias m ul(mo u) ltnmr oa1op rlieol(0 rtoxm3no1lm  lneiasfaDrmur nu4tltnmi3iydfsDea(mo;(4 eerxr3oatlpDranesl( t2umxm3io4ape mfesls)a2urur nt4aet mo3iatlm um( s u)texrir3oadfm e n sls0srumir oodom   nciasfaDtru  ;u4tpt mo3ilt aDean s;t)tlenmf iytlaD luvol( tetmio3oy4altnmnetl(f 2umumo;t4tpe  icias mDrluvp;(0aetoxo3oadlpD lieols0trxoir oydom n fci tfsruaur ;u1olxnii3ilt a2emuvp t0tetrir oatfaDelu i;()s2urio3iy1opt  nvilsfa2ta( oou4teeniietld m ea(mp (4tlenxf ootfa rlu o;( srurim iu4amtemivias)a2tau  ;t0oexo ictadls2el( p;t0 etoxo3totlmteauvs;t seuo(opnodapeelfvs (  2trxro;u0ope  octad m2ra( o;t) rtnxociodomD lues ( t2umiopio1am e nvt tfaDtau pot1tex  icildlm2rlums u4tltrifcoa1om rauei;t seumxo nu4om   icsasf Drmuro;t0olt mfctatlaDumump;t4trtrxfctydlmDranei (  2umimpiodom  lictatf rtaum ou0tpxoifeiltlsDran p u0 ltnxr3io1fpD lnei s trtrirpiodllenlfct t)sDraxmo;o0aet  ieiltfmDrmnvp u)alxrifcto1oa e u i t0t2uoxo3oy4oltnmfvsas sDuax o;u0tpeoifctytfs uanmpn() ltrmrcoa1fp rauvslt0trxmio no1ope mnesat sDtmu  no1oet ifetas a2elnmpnt)tetnmf oydopD  ueols0srxmxrpny4lp e ici t)arrauro;u4apeoifctytlmDeanvpnt0tltrmociadom   uvi;s) eur(o3nydlpe  fci (fsDta(  ;o0tet  oetys aDul(vp;u4 rtrxf3iotopDelieo;s0srxrxr ny4ole  fesat artr(ro;o4aptn ictaslmDem( p (4altnir oydlateanvo;(0seur(m iy4ameemnctasf 2taxm ot4tee  i3iasla emums;t4arxoxfcoa1lp r neil(0 eurxmpoodameelnesls) Duaumoot4teto fetld m2emu s u4trenmo iydfm eln slt)trur(r nu4am nlnctat  Dumu o;t0tpenmfctat mDrlnmp;(0arermf3iy1oa r uvi;(0texo(rpoo1lltelnvi ( aDtmum ou4tex  i3iydla eau o;() etrxo tatfa e n s;s) 2xr(o oodal nlnes (fa2trxr ;t0tlx mf3ild s2rln p t0 exrmf iodfatrauvils sexrio3nudlmeelietls)sDur( pnu1oet  i3ildla um(vs;u)trermo3iotoaDeanvols srumiopoy1lm emicilt)sruaumonu4oltn fetlsfaDeaumpn(4texoxf ootomD aivs;(0srxoim3oy4lp elnvi t arua(mpou1apx iicias aDua( o u0 etoxo3oytfmDrluvs ( t2um(r ny1lpte ivsat  rtmuroot4aexo fctyd sDumn p t) reomf3oa1fmt lieo;t0 exrirpnydllee ivtatf Duaxmp;u4aet  f3iysfmDua( s;u)texoxf3totfaDrauei;s)trxmimpoodolee ieiatfa2trum oo4alt mfctaslm2umums u0aeermfcoodfp  lnei s0s2ur(mpnu1aptn fes s) rum(mp;o4alen fcildfs ranmsnt0tltnxr3iy1omtrln o ( trtrxm3io4llt lietls)sDumurp;t1alxnmictls m eauvs;(4tetoio3tydom   nes t) rur(mpio4al nlnvi s)sDuaurp;o1opto ieiad aDum( ont4 lxrio oy1lpD  uvo s)trxo(mpno4altnmnet s) rtaxrp;t0opto feiadlsDrauvsnt) ltriocoydlpDelu olt seuoir3nydale licilt)aDuax  oo4tlt moeiltlm2uan on(0 exrir3oadlmte nvil(0s2urir iodlp nmiei t s2ur(  nu1tpxnmf3iyslm2rlnvon(0arxoifciatopDr ueo s0setr(mpnu1omte iciat)artmum ;o1oet  f3tyt a rlu p;u0 eerxf3oadlatrluvo t0trxrio3oy1ome miesl( aDtr(m ou4oetoifeilsfm2rl(mo t4tlxoif3ty1omt lies (  rtrio oudam nlncsat arumxmont0aptomf3tadfm ua(mo;u)tetrxo3oa1oatrlnei ( s2tmxr3oy4alenmnei sf rtau pnu0aet ifcilsfmDrm(ms;()tlerxrciatlmte i sls t2xrio3nu1omte iet s  Duaxmooo0tpx ioctatlsDeau p ()texomf3iotfpD livi;(  rtrxm3nudalt mfctlt s2ra( pot0aee moctytls2rln o (0teerircia1fat  ivsl() etrxr iy4oleemfei ()arta( pot0olxoiiciyd a2ul(vp t4tlxoiocoatlpteaueilt0 rumim ou4ol emiet sf rtmx onu4tee moctyd s rluvs;u0aetnmr iotom raieils  rxmio3io1alt mfcias artm(r nt4optniociyd a um(mp u)aetnxociydlateanvilt)srxmxo iy4aleemiet ()aDtmxr nu4aexnmicildla umu p;t)aetoio totfm eln i s) rtoim3nodaltelncil()a2rr(r ;u0ole mi3iltfaDemnvp;t0 rtrxf3iydopDelnvs t) rumxm nu4oleemfci () Dtrx  ;u4ope  ieiydfa um(vo;() etnif3ty1fpt  ieilt)trxmim iydaleemiet ()sDtmx  ;u4texn o3tadfsDuanmo (4trtomf3oodomtrli ols t2xmim3nu1olenlfeia( aDrrurp;o4oet mfciasfa2um( pnt)trtoxf iotfpteau sls0trurir3nudlleelfvtat)srtr( p;o0tltoioetys sDrmnvont4tlxomf oydfaDr n i;(  rumxo3iu4llte nes s)sDuau  nu1tpenioeiysfa2rm(mp u4 rtnmrctodoaD lieo s0 exr(o3iy4ome lncils) 2um(rp;o1apxnmo3ilsls2el(ms u0arenxo oo1lmDeauei s0srum(m io4op emfvsa( s2trumoot4aleomietlsfaDulump u0 lerxo ia1oaD  ivs s)sexoir iu4am  lfeia(fsDtr( ono1teeo feiytfs uluvsnu)arxrircoatlmDrlivs t)srumxopno4omenlicsat)sDrau  ou0opxn feiad s2ean p;t4tetoio3iotlaDr uvi;t sexrio ny4lpenmnctl()arrax  ot4opxniiciyt sDum(vsn(4aetoxo tytom ran s t)teuoiopoudom elfei sfaDum(mpoo1oeen i3ildla2rlnmsnt) etnxr iytoaDeluvs;()s2ur(m iydamt micilt)sruaxm ou4tlx iietydla eln onu)texoio3iytfa  au olt0trxo(opou4op emici sf Draurp;t0tpe ifcias a2ul(vo (4tetoir ta1fa eaues (0t2toir3iu1lle  neslt)srumxrpot0oex iieildfaDulu snu)tltnxrcoo1omt lnes;t0trxrxrpnodomee netl(farta(r ;o1aleomieildlmDemumsnt4 rerxociytomt aiesl()trtrio3oy1lp nmnctl( a2ta(ro;o1texomi3iytls2emnvo u)aeerxociy1fptrlu o t) 2xoxo iydole mfvil( s2trxmoot1oeeomiciyt aDumu p (4 ltoxf3iydlmDelieo;s0seurio iu1amt mies (f Dta( pno4tpxnmf3iysfmDelnvp;t)trtoio3ia1opt anvs ()seuoim nu1lm emivsa(  rtrxr nu4oltoii3iltlmDum(mp u4trxnmfcty1oat ln i t0srum(o ny4omee iesl(fsrurx p;t1tptnmoeiytla rluvp ()trxoxf oodlmtrlu s;s0 2trio oo4apte nvtas  Dtmx p;u1opx mo3tadlaDemumo t) etrmocoydla raueo;s0srtrimpoodlmenlfes tf ruaxrp;o0ope  i3iadlm rln p () rxomfciotlptrlivsl(0tetm(o oy4al   fetlt s2rmxr nt0aexomf3tld m rmump;t) exnxr3oy1op e ivi;(  etmirpny1ale  nvtat)arrm(  nt4aeeomoetytlm rm( o;u4aexrmr oatomDelieo;t0texoir3nodal e icils) 2um(mpnu0tle mfeiat a rmnvp;t)aexrmfcty1om  luvo;t)srurxmpio4ope lncsa(fsDtrxm nu1opxo fciatfa rln s;() rerxocootfpDraivi (0truoir3iodape lfviat sDurx p;o4tpeomoeiasla rmuvon(4 eenif ta1fatrlnes ()teurxr nu4aptnlnct tfsrumump;o1tpx  i3iad s2ra( snu4alenxf oadomte i i t0t2xr(m3ny1alen ics s)a2rrxr ou4tpxn ieiasfm uanmo;t4trerio3oydfaD aivo t0srto(o nu4ll emnes t arumx pou1tlen feiltls2um( o u0 reomf ootom  au i ( sexr(mpoo4am nmfetlsfartr( p;o4tet  i3iyt m2ra( p;u4 lxomr3tatoa   nesls)seurxrpio1ap e ncsltfsDta(m ;u0tee mo3iysls umnvo u)tleomo oy1fm rau slt seurir3iydamt mfvi t  Dtaxmpnt4altnmoetysfa eln on()teenio3iydfm rlnei;t sruoxr3iy1olen iviltf rrm( ooo1oeeniieilsla2eluvp;t4tlxnxocoy1laDrli i s) rxr(mpio4ope mfcs s)srrmur ;t0apto ictltfm uanvo;(4aexoif3iy1omDr n sl(0trtmxo3oudlm  lfvias s2tr(mpno4ale  feild s2umuvpnu4aeeoxo totlpt lu o s  eum(rpiy1al elnei (fsDua( o;u4tlxnioctlsla2ulump;(4texrmo3io1lmDr ieol(  exrimpnu1omtn ivtlsfarrrurp;t1tptoii3iad s em(mp t0aeeoio iytfpDelneolt0 eurio no1omt  feias arrrur ou1apen fetyt sDrm( pnu4 etomf iy1fpt lnes;( trum(mpio1lm elicslsfaDtax p;u0tltn oeiat a ra(mp t) lxoxr iy1oatranvo;s0s2to(r3ny1lm  lfciatf rtmuroot1oet io3tytfm2ra( s;(0alxnxr3tadlm eaiei () 2urxr oy4lmeemnvsatfs2tru poo1tlxniiciysfm elnvs (0tetoiociy1lmD  iei ( sexr(opiodlmtnmics sfa2tm(rpoo0tptnii3tat a2ul( on() ltoir oadfm   n ils0texrio3iydllt lfvsat) 2uax oot0tpe  f3iydfs2emu pnt4artoxr3ia1fpD lueils0s2tmxr3iydomen ies s  2ur(r ot4tlx  i3tytfs2ea(ms u0altomo iy1fmDe uvils)srurxrpiydlpeelictas)a2umxrpno0oeeomieiltla el(vonu)tlxrir ootfmt lnvol( seto(o iy1lle  icsat)a2rr(mooo0alto ietat mDelumo t0areoxfcia1lptelu s t)seum(m3nudllenmfeta(faDtrx  nu0tee iieiyd s2rmnvo (0trerxf3iytlaD an o s0 rumio3ny4lm e ivias sDua(r oo1tpxo fetltlsDrl( snt0aetrxocoodlmteauvo;s)sexm(o iodlp nmnctasf rra(rpnt0optoifeildlaDuanmp;t4trenxr ia1la rlnvil(0 2trxopoodlmt lfvs t  rtr(mpnt4ope  i3iydfs2uauvsnt)tlenmr oy1lp  livs;( texoxr3oy1lp emiciatfsruaumooo1tlt miciysfaDrmn sn()aeenxr tatomteliei s srumxm oodlmtnmivsltfartmu onu0alenio3ilsfa uauvsnt4 etnmr3oatfmDeaneils0s2xo(rpio1llte icilt) Dtaxmo;t0opeo ietls m rlnvsn(0trtnxoctotlp eauei;s) eto(m3io1lpte fes (  2raumo;t0tltnif3ilsfsDul(vpn() etnir tytlp  an i ( tetoimpiy1lltemieiltfaDrrx  ;t0tlen o3iaslaDrluvs u)tltnif iadlpD  i slt  2uoxo oodape livs ( a2urumono4oexnioetas sDrlnmo () exrxo3oo1opteanvi t  exm(mpno4ap   nesa( aDtrxrpno1optnmfciasfa2rlumo (0aleoifciydomt lnes;t  2xmxmpno1ameelietas  2uau p;o1apx mi3tadla2uluvo u4aexoioctytlpteln olt s2urxrpoy4lmtelncsl(fsDtmx onu0alxoifctasfa uau snu0 ltnmociytfp raiesls0sexoio3oydlle mfetatf rtmxmpot1apto f3iydfsDulnvo u0texnmocio1oaDrai i;t0 euoxrpoo1lp  mfes sfs2raump;t0apxnmfetys a2rlumpnu) eerxo ty1fm eau o;s setr(r iy1ome lnesl(fsDuaum oo4apto o3iydfm ul(vp t0 ltniocoo1opD  nvs s0trurio3nudoltemfcsa( sDraurp;t1aeen i3ildfs um(mont)artomrctytlpD  ivols teuo(r3oy1apt mnesa()s2rr(r nu0texomiciadfaDumnmon(4alxrxr3totfa  lu ilt teurxrpnu1lp emicslt sDuax  no1tpe io3iydfm eln o u0trerif iatopDe ivs;s0s2xoirpny4lpt
\ No newline at end of file
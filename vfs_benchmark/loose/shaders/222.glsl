@@ -0,0 +1 @@
+neo;t teuoimpno1lleemiet () 2uaurpnt4apxnifcils s ean onu0tlxnxr oa1faDr ieo ( trxo(r3nu1lmtnmneslt)artr( p;u0opt mociasfa rlums t0trxrmr3ia1la elnvo;(0texr(rpio1lle lfctatfaDrau pno0oee  fciydfaDum( pnu0 exrxr iytoptelueols seurxrpoy1al   ictas srum(r ;u1alx mictydlsDrm(mpnt) etnmr3tatfptr uei t) 2trxrpny4apenmnvs t srtrx ooo4aptomfetltlm umnmp;u) rxrxf to1fa  luesl()truo(o3oodlltn fviatfsrrax onu4tpxn i3iydfsDelu sn(0 eerxf3todlp rli o;t sexoxo no4ap  lfvtasfsDrm(  nu1ope  oeiatls rm( s u4 rxnxr3tadfaDrli slt0setmio3oodllen neiltfaDta(m ;t1tlt iietyt sDumu onu0 etomo3ia1omDr n ols0seumio io4omen feia( sDrrx  ;o4opto fetyd m2elu snu) rxrxf3totfptr i i ( tetmio ou4lmenmnvil( artaxrono1apt mi3iaslm umuvs u0altomocoa1fmtraieo;t  2uoxo oo1lltnlics ()arua(m oo1aptnmietytlm2rlumsnu0tetoxo3totopteau i;(0srumim iy1llenlnetas aDrmu  ;o4teeo f3tasfa um(mo;t0 etrxfcio1fmte neo;(0 2xrxrpio1lmeemfviatfaDrrxrooo1alxo o3iys s uln p t4alxrxo ty1om eln ilt) rto(rpoo1apte fetat srum( pnu1teen ieiad s rl(ms;t)teenmr3oadlptr iei;s)setr(mpny4al emieils  Duaur ot4tleoifeiytlmDran on() exnmf3todfmD livi s)t2xrirpoudaleemfcsas a2taxmpnt4olt moeiydla uanvp;u4alenxrcta1lp e n slt0srtoxr no4lmteliet sfarrmxm ou4altoiieilslm emn s;t) leoif iadfa   u s s  euoir3oy1lpeeliei t) ruaxmoot0aet ii3tas s2ulnmo;t)tlxrxfctadlp raiei s srtmxrpnodoleemictl( a2raxrpnt0texoifeiatfm2ua( pn(0 lxrxf3iy1omDe uvo;s srumirpoo1lltnlfcs tfarrm( p;t4texnio3iyd s rm(vpnu4aetoxrcio1lat au i () etmim oy4aleemict t srtmxm no0oltomictlslm2emuvo u4trtoxr3tadom rau i () rxrxr3nu4llee ncs t) Dtmx pou1aleomfeiysfs2elnvs;t0alenmr totlat luvo ()trxrim3oudop nlnvsa(fs2rmurpot0ope mi3iysfmDel(vs t0tltrmf3tatlaDr nes s t2ur(r3oudop nlncs (fa2tm(r nt0olt  o3tyt a um( s ()tltoif oo1fp e nvs s0 exm(r no4amtelivsa() 2tm( onu0oetoifeiad s em( snu0 rtrmo3to1om rlneolt trxmxm ny4lp emfeiatf Drrx ont4apxn feiyslm2umn s;u4trtrmf3oydfpt  nvs;(  exmir3ou1ope  iciat)a2raxr oo1texn ociasfs el(ms t0 etnmfctydlaDe ivs s) euoxm3oy4lpt  neslt) Draumono4tltoioeiadls2ea(mpnu0 renmo oatom rln sls0trxoxo oo1ol   fetas)srrmx oou4aex ifciltfm el(mpnt)teerio oodopDr u o;t0 rum(m3ou1lp n fes sfsrum(mp;u1olt mictad m ua(vo u0alxrxr3iytfaDr i ol( srxrio no4opeemicil(fs2rax o;o1apxo ociatla2ra(vp () rtnmfciytlm raieo;s)sexr(r3no1lp nlnvsls)aDtax o;t4teeo fciyd aDrmnmsnu0artnxr3oydlmtr iesls) rxoio3iy1olenlnctat sDrm(r nt4ope if3ias m2rluvpnt)aetrxrciotfp eaiei;() rxr(o oo1lpenmnvt s s2tr( oot1tlxnifctls a uau s;t4tetnxf todopDeluvi t0s2toio iydlm emictlt)srtaumpnt4apeomociadfmDeanvpnu4 etoifciadlptr i il( setmim3nu4oltemnciat)aDrmxrpnt1opt io3iat a2emuvs;(4arxrxo oytomDelnvo ( trto(r nu4opee ivt s  2umurono0tltn o3tltfs ul(vp ()areomocoatoa  lnvils0t2xm(mpiy1omeemnei sfsrrr(moou1aleoifciysfs2eauvo u4aleoxr3tydom rln i;()tetoxmpiu1lpte nctlt  rtau pnu1tpxomieiltlsDemnvo u)treoiociydoaDrlueo s0srumimpoydolenlivsa()sDraxro;u1ale ifciad m rluvont) ltrif3tytlmtrlu s t teur(o3io1al nmfcsatfsDtmx  no1apxo fctas s rauvsnt4arxnxr3iodfa rluvo t0t2tmxmpiy4omtnlnvt (  rtru ono4tptn o3tyslm2umu o;() etrif oo1lpte ivils)texrxrpnydameelfei t) rraur nt4optnioeild a ul( snt4tetnxfcia1fmDrai o;(0 2trxmpiu1lptn ncsl()srrrx  ;u0tlxnmo3iltfm2eanmo;(0 leoxr to1faDe u olt0tetmim3iydameemnvi t)artaxrooo0aeeniieiatlsDuluvp;u)altrif oodfpDeln i;s0truoirpoudlm n fvtlt) rra(  ot4tpxnmiciltlsDraumsn(0altomr3todlmtranvi t) 2uoirpnodll elivtat srur( pnt1oltomietldfs ua(vs;u)aetnxfctodoaD luvs;() etmxm3nodomtnmietas)arum(mpot1teeo i3iytls uauvpnt4tetnmf3iodop  livi t trurimpnu1ap emiviat)sDurum no0altnmi3iysfsDrln p (0 leoio oatfp elivi;()tetr(o3nu4opt  nviltfsDtr( pno4olt  o3tad aDem(mpn(4aexnmr totomte nes;t)srtmxrpiodom e fesl( srrmu  ;u0tpeoiietadlm umnvsnu0arxoio ty1lm e u slt s2xo(rpny1lptemivi s)sDua(r nu1apenioeilsfs ra( ont4aeeoio3oydfaD  nvi s)texrxrpiodopte feil( arta( pot0opx  feiyd mDuauvsnt)arxoir oytlm   uvi;(  rxmxmpoy1lp  lneiat s2ur(r ;u0aee mfeilslm2rl(mpnt4aeenio oydfa r i i;s0 euoim3io4oltelnvi s)arumur ot1oexo icildla rlu pnu)tlenmrcoo1oatraies s seur(mpiudlle  nvtat aDtr(r no0aeeomieiat m uauvo () eeoxo3oodomtr nvs ()srurir3oy1ap elncil()sDtmx  ot4opxn f3tas mDrm(vsnt) lxrmrciytom rlu slt srtoiopnudol elncs s srum(m ;t4optniictls a rm( p;(4tltomrcto1oaDranvs ( texrirpnodlp elietas  rtaxrp;u0apxomiciatfm2elnvs () lxnio3todfmD lnvilt truo(m nodopenlfcsatfarrrxm ;o0tpt  o3iys sDum( s u0aeenir3ia1fmt auvolt0srtrxo3ou1lmenlncs ( srtmx  ;u0alt if3tyslm2ra(vp (4alenircoy1lpDeluvolt  exo(opiu4lpte ieiat  2tm( pnu0tleomictytlm2elumsnu0 lerir3oodlmDe ieo;()t2xr(o ny4op n ncta( s2raum ot0apt io3iad aDea(vpnt4tlerxoctotlat livi;t  2tmxopio1am elfetltfa2rru  ou4optnioetltfmDua( ont4alxrio3todfpDe ueo s)setmxo iu4alenlnctltfsrtm( poo0tpto o3ilslm2emn ont4altrif totla ean o;t)srxr(mpoy4lleemfei sfsrur( o;o1tet  fetad s eln s ()tlenir3oa1om  li olt) exm(mpoodlmtemfctlt)sDtr( oot0tptoii3tadfs2emn pnt0 exnmo oodfptrlnei t s2xoim3iudole lics (  rua(  ou4tpt  fetaslm2uluvo u0 rtoio iotla r i slt) etoxmpnodapt  ivtat aDrmxmpou4ole  ictltfa em(ms;t0 rxnxr iadla rluvs t0tetm(r3iy4lm elivias) rtrx  ;t0open o3tyd m2eaump (0alxriocoy1fp  anvolt) euoiopoy1lp nlncilsf Draxrp;o1altnmieiad aDemump;u0tltnmo ta1lp e iei;s tetrxrpno1lptemiet (f Dumx  ;t0tlt mo3ild a rlu o u0tetomf iy1fptr u ilt)s2tmirpnodapenmnet t)srraxmpou0olt ioctlt aDeauvpnu)tltniocoa1lpt  ies s0 2umio3nydolt mnesltf 2ra( pot1tlx ioeiadla2ul(vs u4 lxoiocto1oaDrlneo;s)t2to(o3nu4lp nmicta()a2ta(  ;o4opxo ietlt mDeaums;(4aexoio tadom e nvs;s0t2umxo oo1ll e nvils a2rm( ont0apt  fetlt m el(msnu0 ltoxrcoodoptr n il(  2tr(m3no4lm n fvtl(fa2raur nt1aet ii3ilsfs2ra( p;u0treomfctytlmt an il(0 eumxopiy4lp emicils) Durxm ou1aexoif3iydlaDrlump u)artoir3oadoaDr i i t0texo(r3iudlmt liciat  Dumu oou4apxoifeiad m2umu p;t4aexrio3oytfmteanvilt) etoio iy1apen ivi ()aDtmx oou1tet  fciatla ranvsnt) ltriociodom e iei;t)trxmxrpnu1lmtn nviat srumu  no0oexo iciytlaDem( o (4alxoir3tytoa rai sls  2xr(o3oodope  net t)aDraxm ou4aptoii3iadfa2rmn p;t0aexomfciadoa  aies;s0s2umio nu1omt mfvsas) Drmumono1tpeo f3tlslmDeaumpn() reoiociytomDelu ils)trxr(o3oo1lp emivt t)a2tm(mooo4apeomfctydlsDra(vs u)altrmfctodop raieol()srtoxr3no1lltelnes ()sDrrxrono4aexniieiytlaDuanmp t)altomr3oadop   n s s texoxo nydlmeelivslsf Dumxmpnu4oltomieiltfaDrmn sn(4 eenif3iadoatr ivo (0s2xo(o3io4aleelnesas  Dta(r nt4tlx mfeiys s emumsnu0alenxoctatomte nvs s0s2xmirpno1optn fesl(fartr(ront4tlxn o3tytfm2ea(vp (0trtnxr ootla  anvil(0s2xr(rpiy1am  lfvi sfaDuru  no1tet if3ildfmDuanmp t0 exomf oodfptrlueil(  rtoio oydlmeelncsa(fs2urx pno1opt mf3ils mDrauvsn()arxnir to1omt lies;t0sexmxmpiu4ap  lnvsls)sDtru  ;u1aex io3ils mDumu o u4tltrxocto1lpD aneo t0texmiopnu1olen nvia(f Dtmu  ;o4oleniieiadfm ranmsn(0tltoifciatomDe neolt sexr(opiy1op e ici (faDtrum no0ope if3iydlmDrmu s;(4aeenmocio1la raneil( trumiopoo1lle mfcta( aDtmurpnu0oetoii3iydls rm(ms;t0altomo oydfpt anvi t0 2uoxr3iy1om nlncsas  Dumx ont1apto icilt m2umu ont) rtnmf iodfpDe ivo (0teur(r3ou1lp  lncsltfarrmx o;o0altoiieildfa ean onu0trxnxr3oodop rln s;( texriopnydamtelfetas  2tmxr ;t0tltomi3iadla ulump;() exoir iadomtrau ils  exo(r nu4lmenmiei t a2uaxmo;u0alt  feilsfa eanvp u4trerio ia1lmDr ieo ( teuoxm3iodamtnmfvsls) 2tmxmont0tex ifeiyt s2eanvp u4altnmf tytfa r i il(0seuoir3ny1ome lfeils) 2ta(r oo0tpenmociasfm2em( s;u0tetrio3oadoaDe neo t)srxoirpoudam elncsltf rrrur ;o4open oeiad s2uau ont4aleoircoytlaD luei ()srto(opnudopte iciat s2trumooo0olenmfciysfaDuln o u4aetrmrctytlm r ieil() rtr(m3nudale mfeslt srurxrp;u1opx  feiysfm2umnvo t0 exnir3to1omD lueilt  exm(opoy1aptemnviasfsrrmum ou1aeen fcild aDranms t)aetnxo to1lm  luvil( texmxrpiodlm emfeta( arraxroot4tlxn icilt sDua( p;t)aetrmo ootoaDe nvols setrxmpny1alee nvt t) rtru o;t1tee  feilsfs2emumsnu0tlxrxf3iodfp eluvils) 2uo(m3oy4om elfesa( sDtaxmo;o4tpx  icilsls2emnvo;(4 ltomo oa1fate n s t  ruo(r oy1ol nmici ()aDrr( o;t4opxnifetydfsDul(mo u0aexrmfcoytfm r uvi ()setrim3nudapenlfesa(f rtmx p;u4opeomiciys a umnmon() renxr oadfaDr ueol(0 etrxo3oydame mnciatfartmump;o1oeeoiieiytfaDrm( snt) exnxf oy1oa rau sls) 2triopoy4ape mnvs t  2umxmo;o4alx  f3iaslsDrau o;t)trxrmo iytopte ueol(0s2trim3oudol elfviat sDuaum no1oet  ociltfa2ranvont)treomf ia1laD lu s t)t2xo(o nu4lptnmnctltf 2rm( p;u0oeto o3ild sDemu p u)tltnxocoatlpDraieol(  rxm(m io4aptn ivsl(f rtmu pou0opxoioeiyd aDea(ms;(4trtnxf oadfate uvsls)texo(m no4opee fet t)srtr(r oo4apx mo3ias s umu pnt0aexrmr iytlptraivs;t)s2xm(r iy1opt  ivs () 2ur(rpou1tpt mfctlsfa umumont4 exomrciotoaDe ivi;t0trxm(r3io1ope lict (  ruauro;u0aexnmi3iyd m2em(vo;u4 eenxo3iytomDrlneo;( t2xrxmpou4alt micil() rumxrp;o0aex mfetadlmDea( o t0tltoxocta1oaDelueo s0s2uo(r3oydap   nctasfsDtrxm no1aptn octas s um( s u)tlxnmocoodoptrln slt  exrxmpny4oleelfvsls)sDrm(r nu0tpe  f3iasfaDrmn p t4teenmrcoodfat li s ()trtrio io1amee fesat)a2raumonu1tlt  ietad s2ra( p (4aetoxo3iatlatrau ols tetoim oudlme  fvs s arrru p;o1alen i3iyslaDuauvs;t0aeenircoa1fa  ai sls teumir oydap  lict t aDuax o;t4oexn feiyd m rmn snt4tleomfcoytomt lueils)sexo(r3io1ap nmici sfarur(  ;t4oet iociytfsDrl(mp u0trxnif oy1opDeaies (0trxm(r nodal   iesls)a2urxmoot1oexnmfetad m2em(vo t)texoircoa1omt auvol() rxo(o3ny1altelnvi tfsDum( o;o0ale  fetldfsDemn o;u0 eenmr3totfa r u s s0s2uoio oudape  ies tfsrrm( pou1teeomfeild m eanvo;t0altriocoydfpD  n o;t0texrxo3iu1op n ics (f rtaxm ;u4tpto f3ild a2ulump;t0aetnir3ta1fpte u i;s  eurxr3ny4ape lncias  2tr(mpot4tpxomo3tldfm2ua(ms;()aleoxrctadoptraivs;(0 rtmim3iy4al nmietl() 2rmurpot0texomoetls s2rmn ont0 reomocta1fa  ai ils trurxr iu4optelics t)sDumxm no4aexomfctlslm2ua(mo;t)teermrcoatfmDrliesl(0truoio ny4lptnmnci (fs2uaxm ;o1aexn o3tad mDra(vs;u4arxrxo3iydfat ai i;s sexrxr3io4altnmfcil()s2rrur ou1optniiciydlmDrmnvpnu)trenmr iytfm   ies () 2ur(r iu1optn iciat  2urxr nt0alen ieiydlm eln p ()tlxnmr3iotomtrlueslt0srxmxrpnu1lme mfvias  Dum( poo0opxoii3iasfa2uauvp (0 rxoiocoatlmD luvs ( srtoxm3ou1ap eliesa( aDtm(r ;u0apeomieiysfsDrlnms u)artnio3oodom  anei t0t2tr(opoudomtelietas) Dra(m nu1tlxniictlt m2ra(vo;u4texomr3oo1lmtean slt t2umio3nodlltnmiesls artau o;o0alto f3iytlmDulums;t)arxomfciatla raiei t0t2umir oy4ll  lncils)s2tm(rpnt4oeen o3iadfm eln s;t0texomf3todfp rai s s)teumir nydom elfet t s2umu  oo1ape mf3iyd mDrmn p t0tltrxo ta1fpD auvslt t2xo(mpoodaptelnesl( srraxmp;u0oeeo fcildlm2em( o t4trerxo oodoaDrlnvi s0t2xo(o3iu4om nmiei ( a2tm( oou0oleoiieildfsDulnvp t4teeomf3iatom   u s (0 2ur(mpoo4al  lnviasfsrumx  ou1aexomictld mDuan s;()altoir3todlpD  uvo;t)trxm(rpnydoptn fvsat a2umu  oo1oleoioeilt m umnvon() leoircoadfpDelnvols) rtmxr3io4lptnmnvs ( s2uaurono1oeenifeils s2emu sn()aeenir3ootom   ieilt0t2xmxr no4oltelietasfaDtrxr ;o0tex mf3iatfm2ea( p;t4teermr iadlm raneo;s0 rtr(opiudlm  mnvtas)s2um(r nt0tltnmfcilt a2ulumo u0 ltoxf3oatoptrluvol( t2xrir iu4lmtn iei sf Drrxmp;t1oex  ictydfa emn s t4teerxocty1fmDeli sls0 2xmim ou4lptnlieslsf rtm(r no0apxnmo3tadfm2rmuvs;t0 ltniocoadlpt luvsl( s2toxmpoodll nmiei () rtaxr nu0olxn fcilsfa2uaumpnt)teenxf3oadlmte nvi ()truoio3oodome licsas)a2raxrpnu0tpt iictasfs rl(von(4 lxrxfcoatlptrlneo;(0t2tmirpoy4lptn fvslt  Dtmuront0aeeniietldfa emnvs;t0tltrir ty1omDrli i t t2xo(r3nu4optnlnvtas)sDtr( pnt0teeoifciltlm2rmn s;u4 ltoxfctytomtraieols)t2tmir3oy1al  mfesat) Draxrp;o0ape ifcias s2rl( s t4 ltrmociatla raueo;()seurio3oodop nmfci (  Draur nu0alt  fciys m rln s;t4alxrmf3todopDeaueils0srxmim3iy4lmtelncs (farua(ro;o1teeoif3iysla eln s t4treoxf3iadoateaiei;t) rurir io4opeelnct t arrr(  no1tpxoii3iytfm ran o u4trtnio3oy1fm   nvil(0seum(r iu4lptemfei ()sDuaumooo0apeomo3iys a2ra(vo;t0 lxoxo3totfa eln o;(0trtoio iy1apeemncsas)sDururoot4tet mi3ild m ean o (0 eermr tatlm  aneslt0trtm(o oudlpen feslt srur(rono4tptnio3iatfs2emnmp;u)aeeomr3iadlaD luei (  exmxo3nu4lp e nci t)srta(  no0aetnif3tydlmDrm( snt) lenxo oy1op  li ol() eto(mpny4ame  fvi ( a2rrx ooo4aexoif3tlslm rm(vp u4alerxo3iytomtrlivi;t tetrir nu4ameemnctl( s2uaxmoou4oleo oeiytlaDulnvp t0 lermo3tadfm e n slt  exmxo no4oleemivs s)s2uau  oo1alx io3iatlmDua(vp;(4alxnxr oatlpDrai i;(  2xmxr3nu1lm   ieilt s2ra( ont0alxoifetas m um(ms;u0alxrxocio1fptelueils) 2xoirpoodlle  nviltf rrmxmpou0aeeoif3iyslsDemnvo;u)aexrif iy1fpDe n sl() euoim oy1al elnciasfsrrm(m nt0tlxnii3ias s umnvsn()alerirciatfaD  ivo;s sexrxmpnu4lptelncta() Durx pou1oltoifeild s2el(vonu0 rxnxf3ty1fa  liei t)trurxm nudale lfcilt s2trxmo;u1olt moctltlaDulums t0arxriociydlmD lnvi s0trtoxrpnu1lpt lnvslt)sDtaxmont0tpt iieiytla rm( s;t0 lxrxf3iatlmD luvslt)sruo(r iodop emfeilt srrmxrpoo1tex  i3tysla ra(vo u) eeoxf3iy1oaDeli i s) 2xrxm3oodamt lfeiltf rur(mp;u4alx mietldlm ra(vpnt4aetoif3iydopDrau s;t)s2xmxo3iydlpeelfctl()sDtmxmpot1tpto o3tldfm2ua(monu) eenxo3iatlmt auvi;t trtrim3nudlm n nctat sDraxm no0ale mfeiytfs2ua(ms t4 rxnxr3tytlmteaivil(0 rur(opiydlp elnesatfsDtm(mpno4aexo ociad sDel(vo () ltoxf3oytopDraueols s2xr(r3no1ol nmfviasfs2tmx p;o0tpenii3iyslm2umuvon() rxnxr io1faDelnei;t)srtoimpou4altn ies t aDtmxrpno0tptomfctys sDem(ms;()tlermr oytfa  aieol(  rur(r oydol nmictlt) Dta(rooo1tpt mfciyslm2rau onu4alxoxociadfpt  n i ( s2xr(mpiudopt lfetasfarua(  ;t4tex  oeiadls2ulu s (4 etoxo3tadomtraieils0truoxo oodale mfviatfa2rr(r ou4olenifcild mDrmu ont0texoxr3iotopD luvs;s  2urim iu1ll e icia()aruaxront1ale  i3tadls um(mo;u) lerifcia1lptelivo t) etr(m3iu4llee fvt s arrax pot1aexo oeiasfs2rluvpnu4tlenmf3oo1lp elieil( teuo(m3nydllte neta()arumxrpou0tleo feiatfaDum(vp u0 exrxr todoa raieo (0setrxrpiu1oltelfvsls  2tr(mp;t0apeoiocildfa uauvon(4 ltrxr oo1oaD  nvs t  2trirpnydlm  lneta( srtmum oo1tpe iieiytlaDrm(vo u4 etoxo3tydop rauvi;()sruoim iydomenmneta(fsDtaxrpou4tltn icild m rau o u)tlermr3iodfp  li o () exo(o3ou1apenlnvsls  2um(  ;o4oexn ociyt s2ea( p;t0 leoxr3ootfateaiei ()s2xo(o3iu1lm  lnetlt  Dur(rooo4optomf3tys s elnvo u0tlenmfctytlp   i i;s trtmio ny4olenlnes ()sDum(  ;t1aee mo3taslaDrm(vont4 rtnxf oa1fmDeliei;()sruoio3io4openlfcia( arua( pno0oeeo o3iasls em( o u4trxomf tadfaDe i i t0sruoio io1ol e ict sfsrtaum oo0ale  f3tad s elnvs;t4tlxoir oa1fmte ivi () exoir oodape  feslt)artr(ro;u0tltoio3ildlmDrmn onu0 leoxf3oo1fmt  n s ()t2urir iudal n nvs s sDra(m ;t4oeeo fetltfm2ra(vp (4 rtrmf3iatfateaues;t truo(m oy4al  lfei tfarrax ont0aptoif3iyd sDemnmsn(0 lxoxr io1omD aivs (  rxrim iodolt lici t a2rrxmonu0oltn fctlslmDemn p ()aexrifciadlp e ues;s)sexoxm iu1op emnvils srurumpnt1tet ii3iatls rl(vp;t0 lxnmo3tydoatr neo ()sexoxm3nodol nmictas) 2umxmooo4ape  ietatfm emuvsnt)alxoio3iotop r nvo ( seuoirpiydolt mictasfsrrau  ou1tptomo3tadfsDrmuvs (4aexoir ootoatrluvil(  2urxmpiy4om e nvt t arumx oou0aeeo f3iadfmDemnmpnu4 etnmrctotomDr nei (  etm(o3nodame  ivsa()s2rm(mont4optnii3iasla ran on(0arenmo3oytfaD  nes;( trtoim iy1ale lfvtls) rur(mp;t1tltnifeiatfa2uaumpn(4 etrio iatlat luesl(0sruoio3iodlm nlietlsfa2rmx  ;u4opx iietydfsDulnvs;(0arenmf to1oate u s t0s2xmim ny1ol nlnesltfsrrrumpot1tltomictlt sDea(vsnt) eenxo3iytlp elnei;(0t2xoio3nydalte icsas a2rmxmpot4tetoifctltfm2rau snt4 rtoir3todfmDr nes;t0 2xr(o3nudlmt mfci s)srra( o;u1oet mictyslmDelnvs t0tltnxfciatom elivsl(0t2urim3nu4lmtelfet t  Dur( o;u4tlxnmieiytlmDuln s u0aleomrctadopte ivi;(0t2uo(m oo4op emict t sDtmur ;u0oetoioetyt a2ul(vo ()alxomo3iy1fa e neo t)texmxr3io1altemiei sfs2rru  no1opt  fctysfmDuln pn(0texnif3iodoatr ieol()seuo(o iy4ale livsasfartaumo;o4teen ociadlsDuanmp t4tleoxr3iy1opD an i t0seurir3oy4altnlnct () Drmuro;t1aeen feiysla2um(ms u0alxrmf3oatom raieilt0trxoxr3io4lltemnctat  Duaur nu0oet iieiadfa2eluvs;(4 lerxocoytopD  u i;( seum(rpnodomtnmfei s)a2ur( ono1teeomfeiatfmDeaumo;t0 lenifctytopte ues s0 exo(o iu1ap n fci ( a2rm(  ou1tltn icilsls2el(vs;t)teenmr oydlmDeln i;s t2toimpnudopenmncsls)arum(mo;t0alx  octldfaDuauvo u4arxnio3oa1fa  aiesl( srxmxo io1ole  nei t)aDrrum nt1tlen oeiatls2ul(vo (0aeenxociadlat  n i;t s2umir3iu1lmtnlfcils)aDra(r ot4alx ii3ias aDrmu onu4teermfciotlmD luvs t0 eto(mpno1lm   iei (f rumxmp;o4tlx mfeiyd s ua(vo;t0trtrif iotfat livsl()truo(rpiy1olenmfvsa( srrmxr ou1aetnmfcilsla uanmpnu) lenxf iy1fpD ai i;s0s2umim oudap nmfci t) rururp;t1oeeoioetldla2rln onu4arermr oy1lpt  i o;(  etrirpou1lmtelietltfsrtrxmont4tetomf3ild m2ranmp;u0 etnmo3iodfmDe u i s0srur(o ou4om emnvtlsf 2urxm nu1teeo iciysfa ea( p;u) lxnxf tadlpte n s t s2trxo io4op nlfetlt)aDrm( oot0texnmo3ildfaDuln s (4alerxf3to1op rluvs t srtoxm3iu1ome mnei t) rtauro;u1texoioetadls2ea(vp t) rxrxo oatfm  an i;s)t2xmimpny1lpt lnes () rtrxrpou0oetnmfeiytlmDul(vpnu)trtoio3ty1lp eaieol(  rto(opoudlmeelfvsl( srur(mont4tlenioctasls2ean sn(4altnmo3oytlaDeau i s  rur(mpiodlle  ncta(f Dtmx  nu4oeenifetltlm2ua(vs () ltnmfctatfm  livils)srtoxrpoy4ale lfvslsf Dumu ooo0ape mi3ilslsDuln pnt0artnir ta1lmtrau s t0texrirpnydapee ieiat)arum(r no1opeoif3iydlm elnvo u) etnir ia1omt anvs (  eur(r3oy1lp elncils)arraurpno4tlt ii3tlslm rmuvsnt)alxnmociadomDr u o s0t2xr(r3ou1lpe lnci s sDrru  ot4ole  ieildfa rlnvp;t0tlermfcoytfmt auvo ( trtr(o iy1op nlncsasfsrta(ro;u4ale mi3tysls umnvont4 etrio oo1fp  au i s0sruoxmpiy1lmtelivta(f Drau ooo4tleoiociytlm el( pnt0tleoircoo1laDraiei;s t2trir no4alee fctasfs2tr( pou0alen oetldfs elumo t4treomf oo1opDrlivi t0t2xoxrpiudal emivsas)a2rauront0teeoif3tldlm elu s u0artoxr3oodla   iei t  eurxr no4lm   fcs t)aDurxmont1apeniociyt s2rln p (0tlxrxocoy1opD an ols0srxm(m nu1amenlnviltfsDta(mooo4tee iieildfs um(vs t)alxrir3tytfpDe u sl(0srtmxo3oo1ll e fvt ( a2urxmoou1ole mo3iltfs ea( s;t0 rtoir3ootlmDr ivi t) 2tr(m no4llt mnvs (  rraxr nt1texoiiciltlm2uauvpnt4arxnxocto1omD lnvs (0s2xmim ou4olee nesasf Dtrur ;t0oeeoioeiyd m2ulnmp u)arxrmfctytlat auvo;s0t2xoir oodoptn icsl()s2ua(  ou4opt io3tlsla ulums;t4arxomo tatla rluvils0 rxoiopou4lpe  ncslt a2raur ;u4tleniietadlm2rmu o (0tltnxfcoatomt au s s)sexmim3oydopte fesl(fa2rr(root4optn f3iyd s2rlu o;u) rxnxr3ty1oaDr ies (0 2xriopiydlpee neias) Durur ;u0tlxo i3tys a ua(mon(4alerxrciadoaD  uvo (0 2xoxo ou1op  lncslt sDurx poo4apx mo3iatfmDem(vo t4aetoxfcoatfpD auvo (0sexmxmpou4ole  ivilsfsrumu poo4opxnifciad aDean p u) ltnmf io1laD an sls0texoxm3oy4lptn ics sfsrtrxm no4olxnifctls s2uanvs;u0aleomr3iydlaDeln olt0sexo(opnu4ll n fesas arua(r nu0apxn i3tldla rln snt)tetoxf tatfp e uvs s0srxr(mpoo4lpe mfvia( s2ua( pot0ope mieiatla uluvo u4trxnir iy1lpt lnes;t0 rur(mpiy1opeemnei t)srumuroot4tptn fctltlaDumu onu4teerifcto1la e u i;s t2xrxmpiodamt mncil()arrmx ooo1oex iietlslaDemn pn(4altnmfcoo1omt  u s;t s2xm(o3no1ameemfciasf ruaxrpno4oetomfeiys a um(vs t0alerxocto1fm e i ol( s2tmxmpiudll e fcslt)aDraxmpno0tptnmieiatls rlnvonu4artoir3iodfmDraivs;(  rtoxo3io1alte fcs t)artax p;t0apxnif3tatfa2ua( p (4tleoxf oa1fmDelneo;()trxo(mpou4om emfcta( sDtmxm no1tlx  i3ildfa rl( ont0 eerio3oytlm  lueo (0 ruo(opoo4ol   ivtatfa2tm(r nu4tpenioetldlm emu sn(4 lenxfciydfptrlu s;t sexmirpny4ol nlivtl(f rraum ;t4aee io3iat s elnvont0altomfciadlmt aivolt) rumim3ny4alen nesl()sruaurpnu4oltomi3tld sDeanvs;t4arenmo totomDrliesls0srtrxmpio4lmen ici s aDuaxront0olxn oeiatla2rln p (0aeeomf3oytlpDeauei s)sruoiopnodamt mfviltf rum( o;u1opxo feildfa2um( o;(0 rerxo iytoatrluei;t)s2trxo3nydlltnlictls aDumx ont0alenmfciydls umu snt0 rermocoadfaDraueolt srtrxr oudll elncias a2urxmonu0tetnmfctltfaDemnvo u)texrif3iotoat ai il( t2uoxr ny1lp  mneiasfaDtr(root0aeeniietydlm2ra(vpnt4arxnxr oa1fmD au ils)s2urxo3io1lme mfctasfsDuaxro;u1tlxniictatla2rl( o (0tlxrif3oadfmDrlu o;t  2xoim nydlpee nct s)aDtax  nu0olenmi3ilsfaDumu p t) ltnio ia1lp e nei t)srumim3oudop  mivsls sDtmxrpoo4opxnmocilsls ra( o;u)trtrmr3totoa   ueo;(0trxmxo3no4om n icsl()s2trxrpou4oexoioetytlaDea( snu4 lenxr3oo1fm   i i;(0s2to(m3io1aleemfetlt srrmu o;o4tptnmf3iltlsDelump u)aetriocty1oaDe ieilt0s2umxm oo1al nmivtls) rta( pnu1tpto ociydls2ulnmo u) lerif3ia1om e nvils srurxrpny4am   nvi (fa2rax ono0apx mfeils m2emu o t0aleomf3todlat livs;s0t2tmxr oo4op e ietl()srur(rooo0tltomo3iytlmDulu p;u) rxrmo3iadop   i ils0 exo(r3iu4amenlfetl(fs2trxr ou0tptoiicias sDean p t0arenxf3oodoptrln s;t) rxr(mpiy1ap n iei () 2rmu ooo4alxnmfciyd s2ean onu4aleomf iy1fmDrluvo t s2tmxm3oodam nmnct t)aDraxr ot0tet io3iltls2eluvon(4trxnio tydopDraieo t0trxmxm3oydome  ieta()srrrxrpou1olxomfeiytfaDrauvs (4 exnxf3ta1fpteaivo;( s2toxr3nodap nlietas s2rm(rpno1tpeomietyd mDemnvo;u) exnir iytopD  u o t srxm(r nu1ope lncs s)aDurump;o1tetomoetaslmDrlnmo;u0artoif3ia1lp eanvs;s srtrxo3oy1ope  nvtltf rtrx pno1tpxo ieiatfm2umumpnu) ltrir todoatraueo;t0 2xr(o oy1am  lics sfarurx onu4oexniietadfs2elump;u0 ltoir3oydopD  ivi;(0s2tmir3iydlmtnmivil(fs2raxroot1ope ioeilt s ulnms;(4aetrmr ty1lm   neo;(0tetoxm ou1am  mfcilsfaDurxmpno1alx iociasfa ra(vs u4 eeoxo3iotlaD lu o;t)seuoxr3nudapte ivsa()s2umu  no4teeo ictysls2umnvo;u0texrxr3oodfp ranes s)truo(opiudapt mfcils sDtmump;t4aex mociadlm ulu on(0 lxoxfcia1lpteaies;s0srxo(mpoudalee fvtl(  Dtmxr ;o0aexnmiciatla ranvs;(4aleoxo3io1omt livo s0t2tmio3iydaltnmiesl()srtrx p;t1olenmoetls aDraumo () etnmocty1oa  anvs;s)texrxrpno4lpeemictas)s2raxr ;t1apto ociadfm uau s t0aeerxf tytlm r i s;()s2urxrpoudoltnliei sfaDum( oot1texo ictlt m ea(ms;t4 rxrxrcoy1la e iei s0s2ur(mpnudlpenmnvia()s2urxrono4altoio3iyd sDrmnvs;(0aeermo3tydfaDeanvs ()t2toxrpio4om e fetls)a2tax poo4tpt mf3iysfaDrmuvs;(4aetrmr3tatop rlieo;s s2tmimpoy1ap  liesat)s2tm(root1tle mociltfs2rmuvonu)alenmfcoytlaDeaues s texmir3iodole  nctas arua(rpou1texnio3iyt a2rl(monu0trenmo oy1lmDrlivil( s2toxmpnu1ll nmnctl() Dur( oot0opeoiiciytfa eluvs (4texrxo3todlpD auvi (0setmxo3ou4am  mncs ()sDrmu pno1tpe ioctlsfa rmumo t)tetnxr3ta1opt anvsl()t2uoiopou4ale  ieias)a2uau  oo4tpenioeildfsDeln onu) rtnif tytlatr iesl(  exmxmpoy1alte fei () 2rr(r ;o0aexnmoctas sDumu snt4 rtoif oodfaDrlueil(  rurxm no4lltemfesl()a2ta(rpnu1teeo f3iat s ranvp;u)tlxrxr oo1opDr ies t0setr(o3io4lm elivils  Dra(r ;u4oet iieiydla ulumo t)tlxnxrcoytoat  uesl() eur(rpoodame  nvilsfa2tmu pnt1tpxoii3tadlmDrmuvo;u4 exrxf oy1om eluvs s0 exo(o nudllt mivsat) Dtr( ooo1tpxoii3iltlaDranvpnt0arxomo3todomD  ivo ()truoxo oo1aptelfes s aDrrxr ;t1ape ifeildfm2rluvs (4 rxrmf iotomtrluvi s)sexrxm nu4lm e nvt sfsrrmump;u1aptnmfeilt s uanvp;t)texrir3iydlpDe ieslt0seurxr
\ No newline at end of file
@@ -0,0 +1 @@
+u o;( sexrir ny4am n nesl(f 2uaump;t4aleo ietat m um(ms;u) rxrmf3iadopDrlivi;()trurxm ny1ope liet ()srtr(  no1tle mocils aDuln s (0alerxf totomteauvsl( s2tmxm io4am emnet tfs2rrurpou1apxn fctytfa umn sn(0tlxoxf oydoaDranvslt0 ruo(opio1ap nliei ( arraxm ;o4alxomf3tyd m ea(mon(4 etnifcty1lmDe nesls0trxoxo3iu4am  mfci (faDtrxr ;t0tlx io3iyslm ra(mon()tlxnircootlaDe n s ( trxrim3io1ol   fcsas)sDraumont4olen octadfaDum(ms t)tltrio3ia1oaDeaneol(0t2xo(m3ny1om nlfetl()srumxr ;t1teen f3tlsfaDul( s ()aeeomf3totoateanvils0 rxr(r3iy1ape mivia() 2ra(m ;u4aetn ociysfaDrmnvo;u0altrif3tadfpDr iei;s0 rtoxrpoy4lme lfvsls sDrm(m ou0altnio3tyt mDra(ms u4texnif3todlm r i s t0teumxo3oy1ol nlicil()a2urx oou4oexnif3tadfsDuaumpnt4trxnmf io1fp eluvs;t)setrxm oudal  lfcs sf 2uaurono4optomf3iadls2rmnvo ()aleomf tatlptr n il(0setrim nu1amtn icsas)s2tr(mpou4aeto i3iytfaDeln o;()aeenir3oytop eai ols0setmxrpny4lleemnes ()s2uaumoou0oleomfctld s2umu s t)trtoxo3oodfa eliei;()t2toio oo1ol emnetltfaDtmxmp;u0aet mociadfmDel(vp t0aeermf iotoatelneo;( srur(o3ou4apen fvtl()srtaumo;o4alx ifeiytfa2eln onu4texrmfcto1oa  li o;t) 2uo(m ny1am  lietat s2ur(ronu1ale if3tatla el(mo t)arerif ootoaDrluvo;s)s2xo(m nydole mict t)aDtru  nu0tet  o3tlslm2el(vo;t4trenxf3iatfmtrai i s  2trxr3nu1ameelfvils)s2ua(mo;t4olx ioetls aDra(mpnu4tlxnio iy1lat luvo;()teumxr oydoleemnci t  Dumu  oo1tpeo f3iyslsDul( o t) lxrir iotlmte uei;s)srxm(rpnodop nmnes ( arur(mp;u1tpxomfeiadfm2el( onu)arenxrciotoaDranvo t t2toxo3oydlle lnesas)sDrr( oou0tlxnii3iydfa ean s (4alxrifctydfmDr ieils) 2tr(mpny4op  mncilsf Durxrooo0tpxnmi3ildls eauvont)texnxoctydlp e n o;t t2tm(r3nodolte nvias sDumu o;u1ope  ietltfm rauvp t)altnxfcoytlmDrluvo t)teuo(m oudomeemivs () rraxm ot0opt  i3ilsfm2ra(vs;(4artrxf3iytlat li il(0s2tm(mpiydop  mnes s) 2taxr ;o4tet  ocils a2em(ms () renmo3oodoa rln o ()s2trxm3iu1ope  fcs t) rtaxr ;t4olxnmfetatls elnvp u)aeenircoy1la  lnesls0t2um(rpiudlm emnei t  Draurpoo4oleoii3tltfs um( p;t4 rtoxo3iadfaDr u i;s t2xrxr ou1amenmfcs ()sDrm(ront1oeto i3ildls ea( onu0trtomrctatlpD lies;t  ruo(opiu4op n neiltfsDtaxro;u1oex io3iasfmDel( on(4arenmf3io1omtrlnvslt  2uoimpiudlmte fvs t)arrmu  ;u4altnioeiltfm umn snt)arenxr ta1laDr ivsls0 ruo(opiudom  lneslsf rum(r oo1aet ifeild m ra(vp;u4aleomo oa1fpD auvilt0seur(opnydame mnvtlt)s2umu o;u0alt iiciasfsDrmuvs;u)trtoir3iodlmDe ies;()t2xm(opoydap elfvsat  rrruroot4aee mfctldlaDulu pn()tltnir ia1opDeaueo;()setmir oudape lnvtl() 2trxmont0aee mf3iasfa2umnvo (0 ltrxo3oo1lm eln ol()s2tmxopoo4ame lfvils)aDur(r ;t0oltn oeiytls2umnvpnt4aeeoir iytlmDe ivsls0 rtmxopnu1opee ivtltfsrraurpoo0oleomfeiysla elumo;u)texoif3ootlm e nvsl(  rxmxopoodol nmncil(faDtr(moou0olx  fctytfm rl( o (0teeriociadlatelivs;t0 exr(r oydoptnlfvsltfsrtr(mp;t1ape io3ilsls2emn o;(4aexrir3tatlaDeau slt)texrxrpio4om emfeils  Dtr( p;t1tpt ioetasfs umnmo (4altoircta1lateanvo s s2tr(mpoodape mfvia(  Dta(rono4tpxnmicilt m umumo ()trenif oadlmDe uvo t s2tmir oo4omtelfeiat)aDrrxrp;u1aleo fctldlaDemn o;u4teerirciytoaDeln sls0 eurxrpnydol e feil(f Dua(m ;o1tpen octys m uan s () rxnmr iatlmDraiesl( sexm(rpnudlpte fet s aDtax pou1tpen fciad a uanmp t0arenio oadlmDeaivil(0 eumxr nodlm nmfvt s)aDtax  nu1tle ioctlsfs ul(vo;t4trtnmo3ootoateaivil()trxmxo oo4oleeliesl( srum(mono1apx  oeiadfa2uaump;t4trxoxr ta1lpDe ivsls0tetoxopno4alenmfvt s  rrm(  ;o1aleo icilslm2uanvsnt4tleoxo3to1lpDelivslt0sexmxm iodlm  mnviasf rumxm oo0alxomoetatlm ranmo u)texrmr3oodfmD anei t)srxrio3iodaptelics s)s2rm(  ot1openifcildfs ul(mo (0 reoio to1lm rliei t  2trxr3nudom  lfeil(fsrraxrp;t4oex  f3iltla ulu p (4 ltrif3io1fmtrlnei;() euoio ny1olte netls)s2tr(r ou0oexo f3ildlmDrluvo ()tetnio3ta1lp eauei;(  2uoiopio4opeelfvslt)aDtrumpnt0ole mictad s2ua(ms;u4 rxnircoo1fmteaiei;(0trtmxm3ou4llt  fcsa( srtmx o;t0tle iictysla2ul(mp;t) rerxo3iydfa r u o t)srurir3ou4lm   nvi sf rrrx  oo1olenmo3iyd mDul(mpn(0tlermrctytfpDrlivi s0srumio nydap  lneil(  rtm(rp;u0aexn o3tysla elumont4aexnxr3oydlpDelieol() 2trxo nudap e feslt)aDrmx o;u1opxnmfcils a2ea(msnt4 ltrxr oydfmtr nvsls tetm(m iu1om  miciatfartmxrpnu4ope  f3iasfa2ulu s;()aexoir3iotlm eau s s srtoim oo1omen nesl(  2raumo;o0tlenifeiltlm2ran on(0aexrxf ta1faDe iei;t)srumxopno4aptelfcils)s2urumpou4tpt ifcias a2rlumonu)trtoif tydlaDrli i t0teum(r3iudolen fes ( aDtax onu1altoiieilt a umnvsn()altnmrciotfa rlnvo;()s2xmiopoydll  lneil( a2rau p;u0alxnmictatfsDrau pn()tlerirctadoatranvslt0 2toxmpoo1amee nvilt sDraxmpno0tpx  ociatfm2ulums;(4 ltoif3ta1lpDeluvo;s)srtrxo io4alt  iet tfarrm( pno1alenifeiyt aDeau p;t4arxnmr oo1opt  i s;(0 eto(m nu1om   icsl(faDtr(rp;o1optn feild s ulu p;(0 eermr3totomtr n i;( s2toim oodalenmicslt)arum(rpot1teen oeiaslmDrlnvs;t4texoir3tadfaD  n i;(0 2tm(r3no1ope  icsatf Drauronu0olxomiciltfm2elnmp;u)teerxfcia1omDe i i t0s2xm(o3io1lme micsltfaDur(root0apen iciytlsDuaumsn()texnio3ty1fmtr n ols0srxm(m3nu4omen nvt (  2rax ono4olenmf3tydfaDra( s u0aetrircto1lp elues s  eumxo3oo1lp n nvsat sDrmxr ;o0tpxn icildlaDum(vs;t4tlxnmo3oydfm  aueo;s0trtoirpoo1omeemics t)s2tmu  nu4tpxo feiysla uln snt0teeoxo3todlmteanes t  2xr(m ou1amtemfciatfarrru  no1alxniictasfsDrl( pnu4aeenmfctodomDeai i t)trur(m iu4lptn fvs tfs2taxrp;o1apx ii3iltlsDel(vs u0texnif3iytlaDrluvol()teuo(o nydamtelnet t artmu  ou4apxoif3iad m2ul( p;t4tetoif oy1oaDelueils) eumxrpiu4ap emfctls)s2taur nt0apxoifeils sDulnvs;u0 lxoxf3io1fat lu s t trumirpio1ale mnctl(  rua(ront4open ieiydfm2rmumo;()trxoxrcoa1fmtrlueslt)t2um(rpiy4om nmncslt  Drrump;t1aex  f3iasfmDul(mo ()teeriocoy1oaDr i s;s s2tm(opnu4oltnlfesat  2uaum ou4tpt  fciysfm rl(ms (0aexoif3oadlpt  n olt)setmim3oudlmeemfvs s s2umur ;t0teen ociatla ea(vo () rxnxr todoa rau o;s0trumxr3oo1op e netasfs2rrx o;o1tet ioetadfaDemump t0altrif iatfpD au i (0 2umir3nu1apee nvias s2rm( pnt4opxnmociltlm2rmump (0 lxoxfcty1fa r ivs;s0trtmxopiy4aleelieil(faDrr(r oo0tet  ietytla2rm(mo;t0 etnmo3oydla eanvslt)sexm(r io1lptnlfcs t a2urum oo4tetomfetysfs ranmp u4 exoxr3oatlm eauvo t0s2umim3ou4ap   fcs ()sruru ooo4tex  iciltlm2ulu o;()trtnxo oatop e uvs;s0t2umir oy1lp e fcsat  Duaur oo0aetnmoeiysfa ul(vsn() ltrmo3iadlmt  ueo t0 eumxr3oo4lle lfei s s2rrumooo4ope mi3tyslaDrl( ont0aexrxo iydfatr iei s)setr(rpno4ame mnci t) rumx o;u4apto i3tyslmDeln pnt4aeermfciodfaD  nes t) rxr(mpio1apeelfvt t)arrr(mono4texo feiys s rmnvo u) etnmo iydfm rlu ol(0setrxo3nydllen nvta(f rtrx ont4aexnmieiatfs emumont0 eeoxr3tatfateau i s  rxoxo ny4alt lietlt arururoot4alx mfetltfm2umnvp;()altnxf tadoa elu s;t0 rto(r3oodlpt lnet s sDurx  ;t4aeeoio3tys s ra( o (0aleoxf3ia1omDelues;s sexmir nu1ameelivia()sDrmuront4oeeomf3iadlmDrlu snt0texrmr3ootla eluvils)s2toir oy1olt lfvtltfa2umu ono0tlenmietltla2ra( s u0texnmr oo1omteaieo;(  rtoim3iydlp n fetl()a2ur( poo0oee ii3tad sDulnmo (0aetomfciodlaDrai o;(  rurimpnudole  netas)aDuru ono1oetn f3iasla2uan sn(4 etniocia1la e uei;s texm(m3iydlmtelfvs t)sDrrxmp;t1oee  i3ias s2ra( s u)trermrcto1lmD ln o;( sexm(m iydomtnmncsa(fa2ururoou4alt mfeiys m2ua(vo u4tlxrmrcto1fa r neo (0seur(r iydam n fvta()a2rmxm ou4opt  fciatfs rlnmo t4texrxfcty1lat aieils  etm(o iu1opt lfeiat  Dtmxrpnu1tetnmf3ilt s2ea(ms;(4treoifcoodfmtrau o;t)srtrxr oo1om elnesas s2ta( ont4tpeomiciatlm rauvs u4aetoxr ty1fpDeli i;s srtoxm3oo4ope mfvta()artrxro;o1oleo f3iyslmDemnmp;() ltnio iodlpt  ivi;t  exrimpou1lp nmncsas)a2raxr nu4tptn i3ias s rmums (4 eenxocoatfate n s;s  2xm(o ou1op nmfct s)srraurpoo0aetn iciasla ranmo;u) rxrifciy1faDrlivi;s)s2uoxrpny4omen neta(faDrr(mo;t1tptoioctlsls umu s (4texnif3to1oa ran i t trurxo3iu1omtnmfei (fs2ua(  ;t1altn octysfs raumon(0 exrifcoadlmteli ols  2xr(m iy1lpte nvs sfaDraxmpno1aee  feiltfa2rmumo;(0tltrio3ty1fmD  uvo t srxrxr ny1olen net sfsDtru  oo1oetn i3iltfmDemuvont0 etnio3oatlat ln o ()s2ur(mpiodamenmfcs s) rrmuronu4olt  i3iys s rmn p;(0tltnxrctydomtrliesls srto(m iu4aptn ncs sfa2ur(  ou0opxn fciyt m2elums;(0arxnir oytfa  luvo;s)t2xo(o iu4olenlfet sfaDrr(ro;u4tex mfeilt m2umnmsnu0alxoifciotopt  ivi;s0s2xoxr3iu1am n ivsa(fsDumu oou1tpx moctasfm2emu o (0 rxrxo iadfatraues;s t2urxo io1lp  mfvsls)aDtmumo;o4aee  octyslmDua( on(0altnmo3ootfpDraivsl()truoio oydlltemivs s) Dra(  ;o4texoifciatlm2rmu onu)tltoif3oatfateai i t) rxoxopio4ap emiesatfsDuax pnt0alxoifcild m2ra( s (0teeniocoy1opDr nvil()s2uo(rpoo4lp  mnci t sDuru  ou0tpe mfetysla um( p u)trxrir3iatfpt  n o;() eto(m nu4opt mics ()aDtrxmp;u1olx ifeiltfm2ua(vo;u4tltoxo tatom r ueo (0seumirpiydapte fvtl( srrrur nu0alto fetysla2rauvo;t)alenircoydfmD  ivilt)s2xrir oydom nlfvsa(f Drrx ont1alenmicilsfs emnvpnu)teeoirciodlmD  u s;t t2xrxm3iy1omenlnvsat)a2uau oot4ope mocild a rmnms;t4tlermf3oy1laD  i ols0s2umir iydap e ivia(fs2rrxront1opeoif3iltlm umnmpn(4 rxomr3tadoptr ivi;s0 rum(m ny4lpenmnesltfs2trurpnu0oeen ieiyd a eanmp (0trtrmr3iytlat  iei;s s2ur(r3nu1omen fetl(faDra( pou4aleomi3tldfmDelnmsnt4tlxrmo3iotlatr ueol() rtrxm3oo4ll   nesas) ruau p;o1aet  icild m elu snt4arxnmrciytlm rlivs (  eum(o3ny1apte icsl() ruaur ;t4teenmiciyd s elnvs;(4texoiocoy1lat ai ilt0 rtr(m iudlpenmfetl() 2ua(r ;u4aptniictyt a rm(von(4arenmfcto1oatran o;s0seurio iu4aptelnvtl(  2uaxmp;t0alt miciasfm2umuvsnt4trenmf iytfmtr neilt t2to(opou4opee ieta( aDumur ou4tlx ii3iad aDeau o t0aeenmr3totfa  ai i;t tetrxm3no4ape  ietlt  2ua(  ou4aptoii3tltlm2rm(mp;(4arerxrcty1fa   nes;(0 2tr(o nydll n nciltfa2rr(mo;o0teen oetlsla2rln o ()alenxr iotfpt  nei;() 2urxm3nu1apenmnvsltfarumxronu1aetnmfctld a2umn p;t)trtrir ia1op   uvo t0srxm(opoydlltnlfctltfs2ur(  nt1tetnmfetys m ulnms;(4 rxrmo3oatlpt  ivi (0tetmim3iu1al n ncsltf 2rm(mpou1aeenifetytla2rm(vo;(0 lxnif3tadoa ran o (0 rxrirpou4ll  lfcils) Drmum ot1tptnmf3tlsls rmn s;t) etomocoy1fpt  ues s)trurirpny4olee nvs s srua( pou0oetnmi3iys mDelu o u)aetnio3ty1lp elu o;( teur(rpoo1ome  neta( aDum( oou4altn ietltlm2ea( s;t0 reoxo oo1lat anvolt0trurxm3iy4lpee fcils) 2tru p;t0tpx moeiytfa2ulnmp u0altnmo3oodoa ranesls  rxr(rpnu4ap  lnetls sDrmu  ;t1alx ioetlsfs el(mp;t) rermfciotoaDelueilt  2tm(m3nu1ap  lfvt s  rum(  oo0oee ii3tlslmDrluvo;(4texnio ia1fp elnvi () rtmxm3ny1oltemietls a2taxrpnu4aeenifciltfa2ra( o (4altrmrcoo1faDrli s;()s2um(opio1apt mfcs sfsDuaxmooo0tpe  icild s2uanmp;(4tlxomf3iy1optrauvo;t) rxm(opou1oltn ivsa()a2ur(r ;o4tpeniieiatls uaump t0aetrio3oydlmDrli i;s) ruo(opio1lmt lnvtlt  2rr(r ou1aet ii3iadlmDeln s;()aetrio3oy1lptelues t)trurxr oy1lmt lfviasfsrtrxrooo1oet  ocildfs2rau p ()aetomr tadfpD lneil(0 2xmxr iu1llen netls s2rmx pno4opxnmf3iysls rmn o u4arerif tadlp  an ol()t2xmiopiodoptnmfvslt aDrr(ro;t0teeoifctydfs emuvs u4artoir3oo1lm  lieols)texoim oy1ape lncsat) Drau pno1aleoio3iydfa emumon(0trxrmrcoytfaDeaneol(0srurio ou4llt  ics ()sDtaum ot4tltn oeiat a2umu o;t) exoioctatfaDranesls0 eumim3nydlmeemiesas  2rr( poo4apt mi3tytls ra( snu0trerio totlp raues;t)truoir3iydale lnvsat)sDur(mo;o1alxnmociad mDelump;(0 exomr oo1lpte n ils s2urxr3iy1olte fcta(fa2urumooo0aee  ictysfa2ulums;u4arxnif3iy1laDean sl(0sexmxopnodlp  lfct () 2umx pot1tetomfciat s2rlums;u4alxoio3todlp eaues s)srxrim iu1alee fvtltf Drrx  nt4olxoifciytfmDul(mp;() lxnmr3iydlmtr i ilt)trtmim3nu4lme  ivias  2uaump;o4optnifctydla2umnmp (0trtniociotlpDr nvils0seum(r oodomtelieilt s2rm(rpou0tlenmo3ilt m um(vp;t4tlerxr oa1om eli i ( trxo(r ny1apeelivilt)sDtrx  nu1aptomf3iytla umnmp;u4altnxr oodla rlnvi;s srxr(o nodaptnmnvi tfsrra( pno0olx iociasls ulums;u4 rxrio3tydfmD livilt)t2xm(opno1ol  lfvil()artmur ot1tlxnifetlt s uaumsnt)tltrmr3todfptraieils) 2umio3oy1amen ies t)arua(  ;o0teeoioeiasfa2uluvsnt4alenmo oy1lp eluvsl() 2trxo iudolt livt t sDrrur oo1tpeo i3iltls2elumsnu4aetrio oatfpDe uei t)srxmxm3ny1ope mivi t  rurxr no0aex mi3ias s ua(vs t)tlerxfcoy1fate nvs (0t2uo(o3nu1am  liei s s2tmuro;u1tex ifctlt mDrmn s t0trerif3oytoa  lues;( s2uo(rpny1lpe lnctls s2uau ooo0aee if3tldlaDrl( on()arxnmo iy1fpD  nvilt0texmir nydoptnmicia(fsDtmur ;t1tptnio3iatfs eluvonu0arxomr3oodoa rai i;t)s2xoxo3ou4lm elfctl( s2tm(r no0oee  fciytls eauvpnu4altrmo3oo1omD lneslt0trxrimpiy1om  micsas srra( o;o4ope mfcias m eauvpnu0tlerxo3to1lmD auvs (0seto(o3nu1omt lnvt ()a2ur(m oo0oeeomietatla2em(mo;u) reoxfciytfmt aivo t truo(opoy4amenlnctat)arrmxmo;u0tptomoetydfa ua( o (0 rxrxociadfatrau i;(0 2toim3no4olt lfvils)a2ua( ont4opx mf3iadlsDranmp u0treoxr3iy1omD aieo;t) rurxopiy4omee icsatfsrrr(mo;o4oexnif3tls a ran s (4tlenxr3iotfm   nei s0texrim oudopte ncsat) Duaurooo4tpto oeildfaDeauvont4altoxr3iatlmDr uvo ()sruoxm3oudlm nmivt ( srtmumont4tleomo3tlsfm eanvon()trxomf3tatfptrlnvo (0 2uoxm oo1ap elfesa() 2rrxr ;o4oee mf3ilt a rmums;t)trxnir3ta1opt  uvo;s) rtrim iydaptemnci (fa2rru  ;u0olxniocils s2ul(vo ()trtnir ty1fp eaueo ()srto(r3ou4am e fct tfa2umxmpou1oeto ietasla2em( on(0trtoif3tytlptelieo s teto(m iu1amtn icsls aDurxroou0tetn ociatfm rlnvon()arxnmf oa1fmD lies;t s2xo(rpou4alt  fei tfs2um(  no0aexoif3tldfm2ean p;t) lxoxr to1fmDeauvo (  exoxopnu1op e ivs t  2uaxmpnt4opxoiieildfaDulnvo;t4aeeomr3io1lm e neil() exoio3nu1lpe mfeslt sDra(  ot0altomiciys sDuln o t)altoxfcoo1fatrau ilt teumxm3io4open fctas)sDraxrpou4tptomociad s umn s;u0tetrxf3todlm e ivo;s setoxr3nu4ll elncils)artaxrpnt4texnmf3ildfaDrlums;t)aleoxf oadlptelnes s)trurxm oudlp  lnetas)s2rmu pnu0alxoioeiysfs uaums;t0texrir3ta1lpD aues;(0setmxmpnydamenmivslt  2ur(  nu1olxniieildla2ranmonu4aetomociytlpD  nei;s)s2trxopiu1optn iesas s2rrurpno4opx mf3iltfm2eluvs (0trtrif3oodfm elu ils0setoim iu4am  mietas)srrmxront1tlxn oetydfs2ranvsn()arenmo3tytoaD aivsl(0srto(o io1lmen ict s) rrau  ;o0tee ifeiytfm2ra(vs;t0trtnmf3iatlp r i olt)trtm(m no4lme  ivtls aDtmxmp;u0opt  feilt s2elnmp ()tlenmrctatfatrlieilt0trurxmpoydoptemivi sfs2umuroou4tpto f3iyslm2uaumpn(0 etoio ty1oateau sl(0s2toxr iydoptn iesas)aDumxmpnt1tle iieildfaDem( o;u4trerxoctydfmDeluei;s0texoio no1omtemfct ( aDtaumpnt1openmfctysfa2ulu onu4texnmr ootomDelnvs;()texmimpoydlmeemncia(farrr( o;o4tpeniieiydfmDuauvs ()tltoxf3iatfa  luesls)s2xrirpoo1ope mivsl(fsrtmumpoo4olt ifcildla2emnmpn(4tetniocio1laD ln s;s) ruoimpoy4amee fvs (f rrrxrpno1opx  f3tatlsDuanmo t0 rxoiociytfa rau s;t0 2xrxm no4apte fvs () rra( o;u0tetomictyt s eauvs;u4 rxriocoodlatrlu o;t0 rxrxm ou1om elfeias) Dtmu pot0oee if3tysfaDrm(vs;t4areoxo3todfp  aieil( truo(o3oydlp nlnvslt a2taxr ou4opxnif3iat m2elu pnt4trtrxr3iadlpD  neo;s)srtmio io4lmenliviat  rtrur nt1alx mi3iatls2uauvs;u4tlxoio3oy1lm eln il( sruo(o oo1al   fcsls) Dumu o;u0oetnii3iyt sDrmu p;t) rxnxf3ia1fa e u i;()seuo(m iudlp nmivsltfaDumx oot1oleoiocils m umnvon(4artrxociydfpt  ivo ( trum(m3oudal emnvsl(fs2trxrp;t4oeto f3ilsfsDul( o;t)tltnxo oytlat  nvi ()t2urxm3nodapte nvs t a2tm(mpoo0apxomoeiyt m ranvonu0aleomr io1lpDr ueo s sexrim oo1lltelneias) Duau oou1texnifeiyd a el( snu0trtnmo3ty1fmt luvs ()s2xo(opoo1lmte ict (fsDururpnu1alxo o3iltlaDua( s () ltnmfciotoa raneilt)s2uoxo3nodam n fvslsf Dtm(mpoo0opt iiciytla2rl(vsnt4 rxrmfcty1fmteaivs t  2umxopiu1amtnlivs s)sDrmump;u1opxo fcilsfsDemu s;u)arxrmfctytomDelneo;s0srurim3oo1ome  ivsl(fs2um(r ;u4tptn iciasfm ua(vp u4 leoxf3oy1fa eanesl(0trumxrpiu4aleelfetat) Drru pnu0tetnioeiysls ulumpn()arxoif3to1opte i o;s0t2urxmpio1om elfcsls  Dtrur nt0olen feiadlm2uau o;u)trenxf3ta1lmD  ueil(0trxmim3iy4lltnmiciatf 2tr( pou4aexnif3iltfm2umn on(4 exrircoodoat an s ( s2urio3oo1op   fetl(fartrxro;u0tpxomo3tatfs2eau pn()trerxrciydlat aueo;s) 2toim3oo4opee icia(  Drr(monu4texomf3ilslm ranvont4 ltrif3iytfmDraivolt)t2xrirpio4amt  netl()arrmumoot1aex moctas sDua(vsnu4alxoir3iatlaDe neols)seto(o3iudom  mncsl( arua(roou1olxo feiat s um(msnt4 ltrifcoydop ran i s t2xmxmpoydap nmiei t a2ta(moot0olxo o3iydlm2eanmo t4trxoxf ootomD ai i s trtm(r oo4ol   icsat) Drmx pot0opxnmfeilslm el( o;t) eeomo3iydfm eln o (0t2xm(m nu1amenmieilt)srta(r ;u4tpxomfctatlmDuln s t) etnxr3iatfa rluvils t2xo(opiy4om emnvtl()sDuru onu4opxnmieiadfm2ua( pnt0aeerifciotoptran olt0srtm(o3io4al  lfcia( srumumpot4apenmi3iasls uaums;(0aetnmfcto1lp r ivol(0srxmxmpoudamtelics ()a2rr(r oo4oeenifetad aDra(mo;(4artoxo3tytoptr n o t0 exmirpnudlmeemivt s)aDraxmo;o0aex  f3iltfa el( p;u0aexrxr3iodopDrln s;(0setm(m nu1ol nmfvs s)arra( ooo0tlx mf3iat aDumump (0trxnxr3iotla   u il( seuoxm oy1lpe  fesasf 2rm( onu0opxnio3tadfa2umuvp (4 etnir oatoatelnes s s2um(m oo1ll nlivilsf 2urumpot0aexomfciatfm2elnvsn(4arxrxf3iytomt  u i s)teumxopio1lpenlnvtatfaDrax pnt1oetn ictydlmDuluvo;u)texnxr iadfpDrlies t)setmio3oo4op   fcias a2rmumoot4apt mfeiytlaDeaumsn(0 reoifciadlaDe n o t0 eurio iy1op nmivs s aDtr( ooo1oexnmociltfm2uanmp;u)tetoio3oa1oat livils) eurxo3nu1lmenlfesa( srrrxr no4apenifeiys m emuvsn() ltnxr3iodfmDran slt) exo(r3nudlpenlnesltfaDtm(mp;u0alenifciadls um(vp t4arxoio iodla rai i s0 eum(o iodoptemnvtls) 2trur ;u0oetnifeiatla rm(mo t4 rxomf3iadfp  lueol(0s2xo(rpou1alen nctat artmx  oo4opxnmoetasfs ea(vo;u)artrmf oy1oatean o s)teum(r oodam n fesa(faDra(  ou0apeoiociad sDel( p;() lxnmociadopD aues t srtmio3nudamtemfeta(f rtrxroou4oeeomiciadls2ea( onu0texnir3io1op  lies;t)s2tmxmpio1ole lfvi (fsDtrxmont4oeeomi3tytfsDel(vo u4altomr totfmD livsl( sexmio3io1ap  lfvsltfsrrau oot1oleoif3tyslm rau s ()tetrmr3io1om elu i t)t2triopio4lp elivslt)artax onu0tpx io3iad a2ul(mp;u0artoxr3oydoptr nvols sexm(r iudaptemfcsltfaDur( oot1opt mi3tytls2el( on() etrxo todomteaivo ()setrxmpnodllt mfvsltfarra(r ou4aptoioeiatla em(vo u4trtrxr tadomD lnesls0 2trxo3ou1llen ivtltf Dta(mo;o4tlto fetyd a2elumo;t0 eenxf iy1fmt  ivo s tetrir iy4am e ivt t a2rm( onu0oeenmieiydlm ranms;u4 exrir tatla elnvo t  exmir oy1ale  ivs s) Dra( o;t0texoifctlsfaDran s (4 ltrxocoydlmDran ols0 exrimpnydlpenliesl(  Dtrx  ot1apt ioeiysfs2rmnmo;(0 rtrxfciatfm  aueo;t0tetoxrpno1apen icsl(f Drrumpou4alxnmfctls a ul(vp t0 leoxf oy1omtr n o (0srxm(r iydllenlivi (fsrurxmoot1oee  fciatlsDrauvs t4aexoxf tatlaDrln o;t  eurxr iy4ale mfcsls  Drm( p;u4oexniiciadlm emu ont0texrircoydlmtraieol( t2xmxrpoo1lm nlieil() rum(rono1tpenmfciyd mDel(mp u)aeeoxf3oodoa  auei;s  2xriopiudol e neil( aDur(  ;o1aexniietytla2ranvpnu4tltoxf oadfm  lu i;t)teuoim oy4olen ici sfarraurpnu1altnmiciadls2eluvo;u4 lermf oa1opDraues (0srto(m nydop   fcs ()aruaumo;u0aex  f3iaslsDeln p;u) lenmfciydfmt livolt srumimpou1omtnmncs t) 2um(mpno0tlx iicilslm2elu p;t0trenir oa1lmt anes;t)trtmxo oydoltnmfes sf 2taxr ;t4aeto ieiltlmDrau ont0 etoxfciytomDrluvo;( teto(o ny1al eliesl( sDrmxro;t0opxo ieiat m2rmnmo u0 rtrxo3ty1opDranvi;t)t2xoxm iy1lp  livils)a2trx ono0ape  ociltfs2elumsnu)aeeoir ootlaD  i s s  etmir3iodom  lfvias  Drm( p;u4oet mf3tatfmDeluvonu4 rxriocoodfm  lieo () rtmxo io1lp elicsa( aDrmu ont0aleoioeiatlm elu p;u0tltrir oytlmt liei;s0 exoxrpnu4lpeemiesat sDta(r ;t0oetn o3iydlm2elu snu4tetnxo3iotoptr iesls srtoxr iy1lleemfvils sDur(moou1aptoiocias aDranvs;u) rtnxr3oatlmte u i;()setr(rpio1omtnliet t)a2tru  ;o4tlxnmi3iatfs2eaums u)aexnxo io1fm eaneol(0 etrxo oodal  lfes ( sDrru pnt0apeoiiciydlaDumu p;t)tleoxfciy1omDrlieil( truoirpio1omee fcs sfsrtm(m ;o4tpto iciat a elu p ()texnmr3ty1lpDrlnei s) ruoxm3oo4lp nlivtlt)a2ua(moot4oet mictyslaDuauvpnt4alxomr3tadla  anvo s) rxriopoo4opeemnetls)aDumxmp;o1oetomoetat a umumo t4artrir iydoat  uei;s)trtmio3ou1apt mivsl() 2um( oou4tpx  ictyslm ra(vo;() leomf tatoa rlivo t  rto(opiudol  mnvsas  rtaurp;o0tpx  o3iys s ul(mp;(4 lxnxrcta1op r neo s0 2urim oy4amte fes (  2tm(mono0tpe mfeiysls2emu snt4 exrifciotoatrai ils0 ruoim iy4lpen iesasfsrum(mpoo4oleo ieiaslmDrlump;()arxoxr totlpD ai o;s) ruo(o3iudomenmivil( srumxmo;t4oleomf3ils m eanvp t) rtomo io1oatr uei;(  rxo(opoy4altelfci tfa2tmx  ou4alxoif3tas s elnvpnt)trtnmo3totfate i i s0s2uo(o3nudlpeeliesa()arrmumpot0tlx iictltfmDua(mont0 exnxf tytomtr ivi;( trurim3ny4am  mfctlt s2rrxm no1tltnmiciys mDeln s t4 etnxo3tydlmD lies s0trur(m oodlp   nctlt sDrm(  ;u4apto ieilt aDeaums;u0 etoir3tatfmDelivs () rtr(m3iodol   ivia() Dumumpou4oetnifctatlsDelu snt)alxomo3oatlaD  nvolt t2umim3iu4ol e ivtas  Drrxr ;u4ole  f3ilt mDrl(vo;()arxoifcoatfpt li s;t)t2trio3oo1ole livsl( aDtau oot0tlto o3iydlm rm(mpnu0texoxr tydlpDeanei t tetrxo oy1aptnlnei (fsDrax pnu0oeenmictld sDem( o t)trerxf tatoptr nvo t0 etr(m3oodalt lics t) Dtru  ou1aetnif3ias s2rlu pnu)trtnxo3tatlaDe ivil()trtoxmpou1aleemnvsl(fa2urumpou0aptomociytfaDraump;(0tetnircoodla   uvi t0setoirpnu4omee icsas  2um( p;t4tpt iiciltfaDeln s t) lenifcoadfaD  nei;s)srurim iydom  mnetltfarrrx  ot4apeomf3iatfsDumn p;t) reomfcootla e i s () exrxr nu1olenlivsltfsDraxm no1tee  oetad m eluvont0 reoio3tydfpt luei (  2trim3iu1lme licils) Duauronu1aptn f3iyd a eauvs t0alxrxr tydfaDe i o t t2xmir3oudomtelics tfsDum(r ou1olt  oeiatfa rl( s;u) lenmr3ty1lmD  n s;(0srxmimpiy4ome  icsas) 2umxr no1alxo octad m2rmnmsnu0 exnmf3oytlaDranei t srtmiopio1omee fvtatf 2urump;u0oltnmfcild m2elumo;t) lxnxr3ta1op r uvols)trxr(r oy1alt  netatf rtr(rpot1opx ifetys aDumn o t0tetnirctadla r uei;t)srxrxo iu4om   ivtlt sDra(mpou4olxo ieild m ulumo u0 rtnmf tadlpDeauvs;s)srtr(r iudom nlnet ( srrr(mo;u0aet mo3iydlsDeanmpnu4arxnioctodom eluvils0sruoxm3iydolen ncsa(faDurump;u1tpxomf3tyslm rmumsnt4teenmf tadlmtran o;()seuoxmpiudll emfctlsf Dum(mo;u4alt moetasfs rlumo u)aeerif iadop raies;t0 rtrxopnudom nlies t)aDrrx  ot4oleoio3tyt s2umnmo u)altrmf iadfptraneils)t2xr(m nudlme lieslt sDraxronu0texomfcilsfa2eln onu0 exrxf3tadoa e uvi t)trxmim3oo4omen icil(fa2tmu  nt4tltomfetaslaDra(vpnu)trtoir iatomD  uvils srxoxopno1olt mnviat  2urxmoot0altnmoeilslm umuvs (4tlxnmf ootfateai s;t0srxr(m3iodom elfeiltfaDtru o;u0tpt if3iydlmDemump;u4aeenioctydlmt aneils0 eur(m3ou4ope lfvtls sDra(rp;t0tpenmfciadlm2elump (4 rxrxr ta1lpDranvo t tetmxm no1apenmfvil() rtaxm ;u1tpe mfciydlmDrmumo;t0 etnxociatfmtrln i;s  2toxr3no1am emfeiltfaDtmx oot0tpe mietls m2ran s;t0arxrxocto1optr nvolt srtoxmpio4al e icil()sDua(mpnt1opx iiciat s uanvs;(0 etrir3tydlm r nes t)seum(m iodame mfvs ()s2uau  oo4aex  icilsfm rmums t0 etrxfcoadfmDeauvs s  2xr(r3ny1op nlietl()s2ur(r ;o1olxomo3ias sDranmon(4tetnxfciodomD anei s)sexmxopio1op elfctls) 2uauront1aexn ictldlaDrmnms t)tltrxfcootomDr i olt teuo(m iy1lltnmfes t a2rruro;u1texoiociasla2elums;t0tlxrmo ia1fpte u o;s srtrxr oydom emfcilt) 2uaxro;t0tpx iiciyd sDuln o;(4 lxnio3oodlp  li s ( srtoiopnu4lm nlnesl(fsrtr(ront1teenii3iatfa elu ont0aexoir oadlpDrauvo;()trtr(r3nu4opeelnviatf 2rru pot1texnmiciatfaDum(vpn(4 leoir oa1fm   ivo;s)trum(r3iy4lmeemnctat s2urur ot1apx mieiasfmDrl( pnu) rtomrcta1lpte uvo (0t2tmimpiu1ol  mnci (  Drmurpnu4aexnmoeiltfsDul(mo;u) rxomocta1fmtr uvi;( s2xo(r3nydapenmfvt s)artaurpnt1aptomfeias s2ra(vpnu4trerxf totfatr nei;s0s2tmxo ou4lpe mfcsl()artaumpnt1tlenii3iydfa2em( snt0 reoxo3oy1fa   u s;s0 exo(rpny1ap e ivilsfaDrrxm nu1opto ictasls2uaumo (4teeoxr oadlmtelnvo;t) 2tmir3oy1ape lfcs sfaDtm(m nt1tetoioeiysfa2emu onu4 reomf3tadop elueo;( t2to(m oo4ame  ies ()sDrrxmo;u4aleoif3tad a2uan sn(4texoxf oadop elnes;s truoio no1ol n fvs (fsDuru  no1apeomo3iltfa2ua(ms;()artnio3ty1oa  li sls  etrir oo1olen fvs tf Dtmuro;u4apeoifciydlmDua( pnt0 rxrxocia1faDr uvsls0 2xoim io1amte ies () Dum( o;t4alxn iciad sDrmuvp;(0 exoiocoadfm r neols)t2urxm oodlpt livtlt)s2rau  no1tpenmoetytlm2uau p;(4 lenio ta1fptrli il( srurir3oo1lmeemiet s  rrr(r nu4apx mieilsfa2uanmp;u4alxnxo3tytlm rlies (0trxo(m3io4alt lnesasfartr(mont4oeeoifeilsls rlu sn(0tlxrir3ia1oatelneo s) 2xrxm3nydll emneslt) Draxm ou0optn f3tld s umums u4teermocootlpDeli i ()trur(m oodamt mncsa() Drrxroou0tle  fciad a ranvo;()aleniocta1lmDe uvo t setoxo3iu4lmt  neia()a2tm(m ;u1oexnmfeilsfm rmnvp;u0altomfciydlpDrlneols0srtrxm3ou1alenmiet s  2tm( pou4oltomfetatfm2eluvp ()aetoircoadfpDeanei s0srxo(opny4apt mncsl()srumxr ou0tex  fciysfs2umnms;t0tetoio iotlaD aies s) 2um(o3io4am emfvtasfsDraur nt4tptoiietydls rln p (0tltoxo oadlm   nvo ()truoimpoy1om  lncsas)a2ur(r ;t0apxnmi3iytfaDuaumpn(4altrmf iodoatr n i t0s2to(mpiu4al  miesltfarrm(  nt0altomfetyd mDuauvsn(0texrif ia1fm  lu ol(0t2urir3nodalte ncias)sDraumpot1tpxomoeiasla2rmnvsn(4tetnxf3iydfat au s;s)t2uo(rpou4ope mfci s s2um(mpoo1opx ii3iadfsDelnmsnt)trtnio ty1fpDelivi;s0setoxo3iodllee nvs ( a2uru o;u1teen o3tatfs uanmpn()artnxr3oytfmD  ieol( srxoirpny4ap elncia(fsDtaxrpou1teto ieildfa2uauvonu4texrxr iytoaDr u i s  etmxrpoy4apenlietlt) rtrx  oo4oee if3ils mDul( p;t4 exrmo3ty1fmD auesls sexmxm io4lp nmiviasf 2tmxronu1ole  ietytlm eln o;u4 lxrxf3oodfmtr nvsls0 rxmxm nodlltnmnvils  ruax ont4olx  ietld aDrlump;u4 ltrmr oa1lp rlivsls t2tmim ou4alenmnes ()artr(r oo4oetomieiatfm2ea(mpnu)aetoxr3iadlpD luvslt s2uoxopio1lme  fcsa(fsDraxrooo1aetnifeiyt aDrl(vpnu4teeomf3io1lmteli olt)s2toir3iy4lpe mneil() Dtmurpou4openmoeild m2ulnmo t)arxnmf3todfp r n slt teurxrpiy1altnmnvtat)s2umxrooo0tpt io3iydla2ran p;()alxomr3oatlm  an il()teumxr3ou1amt mneilsfsDurxro;t4oexo f3iadfs ean s;(0texnircia1oate u s;(  rtoxr nu4ope mics tf Dtauro;o4oexomo3iltla2ua(msn()trtomf ia1fpt lnvs (0 exm(o3oo4lm nlnctl()sDuru pou0aptn i3iasfa2emump t4tlenmociodopt  nes s)setmxr3io4op   feta()s2tau  ou1apxnif3ildla2ua(mp t4alxnxfcoy1fptelueo s  2toxm3nu4lle mfeils a2um(m ou1altnio3tys s ra(vp;t0aeeoio iydoptelu s s0 2urimpoy4lpenmnctl() 2rau p;t1aeenmieiasfa uanmp (4tlerif3oydfaD  n ilt0srxriopiodomee nvs t srtax p;t1tltn octltfmDulu o;(4aeeoio iytlpt aneo ()trxoim3iy4oltnlfeils)a2rrum nt4alxomoetydls rmuvs u0 etrxf3tatom r uei t sexr(r oodaltelnvi t  2rm( p;o1ope miciatla uau s;(0artoxo iy1fmt an o () rurxo3nodll elfctlsf rrru ono0oeenmi3ilsla ulumont0 ltnif3iydomteaneo s)tetmio3iudal eliet t  Drau  nu0alt mfciys s2umnvo (4 ltrxr3iadlp r u ols)s2tm(o3iudomt lnes ( a2rmumo;t4aexo feiyd a rm(mp;t0 exrmr tadfatrli il(0 rtm(o iu1al nmfvsls) Drmurpno0tpenmo3iysfa el( p;u)arxriociatlm  li ol()sexrim oy4apt livia()aDrr( poo4tleoifctys m2elump (0alxrir3oo1laDraieo ( setr(m iydop nmfeils aDuaxro;t0altniociad m2ea(vpnt0alenmfcta1lm ranei;s0 ruoirpio4om n nvsatfarurxrp;u0oetn ieils aDrlnvsnt4artoioctydoat aivi;t srtr(r3ou4amtn feiltf Dtmur ;u1opto ieiatlm um( s t0 lerircto1la raneo;s)trurxrpio1ol emfcia(fs2ra( pno0tleomfetls a2uauvs;t)texnif3tatfp  aneils) exmimpiudamt  ietls) rrmx oot1oetomfcilsfa umums;(4arxoifciotfmtrai ols0srtoxmpiydlmt lnvs tf 2tmx ont4openmocias sDumuvo ()aetoxo3iatfa ran s s0 euo(opio1olt lnctasfs2raxm oo0tex  feiyd s el(msnu0teeoif3oytlatraueo;s t2um(m3iodalenmfcsa(f Duaxronu1apxnii3iytfs2uanms;(0 rtnmr io1fpDe ivi t0trumio oudopeelivias)srtmu poo0tpe mo3iysfa ea(vp (0 rtnirciatlatelivs;(0 exrio3iodop n nctl(fsrtm( ooo0tpxomfeiyslaDem(ms;()texoir3iadlpDeaivs;( t2xriopnudlmeelfvs s s2uax pno0aee  oeiadfa2em( p u4 exrmfcoy1oa rai s s)sexriopou4ame lnetls) rtaumpoo1alxn iciys m eanvo;t0trtnxf todomteauei;t0srtmxm nydopt mictls) 2ur( o;u0aeen iciysfa rl( o;()aetrxf3iytopDrau o s)t2urxopnydom emfvtas s2ur(rono0opxomieiydfm ua(mpnt4trxoio totom eluvo t0 exr(o3ou1op emfvt s)sDraxm ;t1tlxnmfetldfaDemuvpn()alxrif3ta1lmteauvi;()trtoxo3io1ap e nesas a2raxmonu4opt  ociytla2ranvp u4aeenif3io1oa elneslt0texr(r iudoleemieilsfaDuax onu0tleo f3tydls2ra(mo (0aexnmrcoytop r uvo t0srxo(r3iudopt lnvt t)aDurx pot1oetnmiciys a2rluvpn(4aexnxr3tydomtelueil(0texrxopoo1amee ncia(f rrm(r ou1oleoiiciyt a em(vo;t4aexnio3io1oa ean o t texoim3oo1ol   iet s a2tm(root4tee mociltfmDelumpnu)tltnir oodoaDr uvsl(  rxoxm oo4al   ieiasfs2rmx ono1ole mfciytls2rau s () rtnio3tatopt liei;s)s2xoxm3oy4amt mict ()s2raumpot4ale io3iys m2ul(msnu)aetrxr iotlpDrlivs;s0srumxm3iu1alenlnvs tf Dumum oo4tpx ii3iasfsDranmont0tlxrxf tadla rlu olt0srtoirpoydlmtnlnvtl( s2raumpot1tpxo oetatla2um(mp;t0tetnmf3ta1op eanvo (0 etmirpiy1olt lictas  Dtm(rpnu4oexomietldlaDea( o;t) rxrmo3iy1lp eln s s seuo(o iu4altn ictl(  Dtr( oot1oetomi3ilsfa rm(vs;t)aleoxr iodlatr uvo s) eurim iu1lp nmfvs sfaDrr(ro;u1tpt ii3ilt s2rm( s t4 lxnio3ty1fp e n s t0trtmxm3ny4am   ict t srumurono4aptoio3tydfm uaumo u0tetomo todlpD lu o ( srtr(r3nu1omee fcsl(f 2um(rooo1optn i3ilsfs ran o (0 reoxf to1fa eluvs;()srtrxo nudom e icsl(  Dtrxm ot4tleo fciytlsDrm(vp () lxoiocia1op  lneo s) euoxr no4ole  nvsatfaDra(m no0alenmocilt sDeanmo;u0artoiocia1fatrau ilt) etriopny4ll  mfei t)s2truro;u0alt  ictys sDelnmpnu4aetomf iotlat au olt t2tmxm3ny4llte fvs t a2taxr ot4tpx  iciydls2umu p u4 eenmfcty1fptr uvs s)teumir iu1oltnmfcs t sDtau pnu4oexnmo3tyd m eau snu)tltrxo3iadoatran s;(0tetm(m nu1op nmnet t sDtrum nt4alenifciadls2rl( p;u4 exomo oytlatr ueol(  ruo(o3iu4om n nciasfsDumxmo;u1tetnii3iytfm ea( snu4alxnxo iy1fateauvi t srxrxmpiu4alt lfeta(  Dtmu onu0oeeniiciyt s rmnvo;u4 lxnifcio1la rlu s (0trtrimpnu1optnliciatf 2trxm ;t1alxomo3tasls2rlumpnu0tltnmociadlpteluvil(0 etrim3nudam   nvt tfsrtru  oo1tee  ictydfaDum(mpnu)teenir iotfa r uvils0t2trim oudol e fcsl()aDrm(r nt4aeeniiciat sDel(vp u0tltnxr tydlmteauei s s2tr(o oudapenlnvils aDra(moot0tleomf3iydls2ulnvo t0 lxomo3oatom e n o s) 2trir oy4ap elivs t)artau pou0apeo f3iys a2um( p;(4tlxomfctatopD auvolt0 rtrxm3iydlltemiei sf 2uauro;o1opx mf3iytlm rlnvpn(0 eeomr3ootlmDran o s)teuriopoy1llt lnvi s  rur(mo;o4tle iicias m elu o (4aleoifctytfmDean slt tetrir iydal eliesas)artrum ;u1aetoii3iat a2rmnvpn()artoxf3oodomteaueo ()trtmxm oy4olte fci ( a2ra(  no0aexoif3iat s2em(vs;(4tltoxrciodopDe nvi;s) rtrxo iy1omt  fvs s sDrrxmpnt4tee ifeilsfs ea( pnu)alxrxrctatoa rau o;t0t2xm(rpou4apt lnesl( srrmur ;t0oeto ictytfs el( onu4 etoio3iodfpDe nvols  2umxmpnu4ole lnvsa(  2rrxmpnt0oeeoioctydfs2emn o;u)texnxrcty1fpD aneilt trur(r io1omtnlncil(f 2uaxmo;u0ale ifetat aDuaums;(4artrmrciydopDean slt t2uoim iudlp nliei t)aDumu  ou4oexnioeiytfa ul(vo;u0tetnmo3to1fmD aieo s) etoxrpiy4am nlnes tf Dua(r ;t0olt ifeias a2emn pnt)tlxnxo tatfatrai o;s t2uoxo3ny1oltn ncilsf rtru p;u1tle ii3tyd aDrauvs (0aeerir tydlptrlneslt setmim3iy4ll n ivt (  2ra( ooo4tleoiietytlm um(von()trtrxf to1oaDrai ils) 2trio3oy4opee net ()artaxroou1aetnmfeilsfm2em(mp;(4 rtrmo3ty1fm eauvo s0setoir oy4al nmncsl(fa2ta(mont0ape io3iasls2ean o;t4arermo iytfa rli ol( srxo(opoo4ol emnvtas  2rmxmo;u4tlt miciatlm2ranvp;t) rxoio3ty1fat auvs;t)trtmim3io4oltnmfcil(faDra( o;u0olt mietls a2ra( onu4trtoxrctodlm eaueo;t0srxr(opoodlmeemivsas sDumumo;t4oex moctas s2um(msn()trtrmfcoatfmDe nvs;(  exmio ou1ol nmicil( srrrx  oo0olxo i3tat m em(mo t0 rxnirctytop eauei;s0teto(r3io4alen fctlsfsDtaxm ;o1tpenmictld s uanmo;u)tetrirctodop   ueolt teto(m3oo1alt mfeia()s2rau poo1tle iiciatlmDum(mp;t) lerio oy1lp   nvo;t)trtoxm3ou1lle  nvtlsfsrrm(mp;u1tlxn fciysfaDrl(mp u)tltnmf3iotlmD luvi;s0sexo(rpio4ll  lncslt)a2rax ono1oeto oeiytlm2uauvp;t0 lxrxr3tytfpteliesl(0 2xmxrpiydlltemies t) rraxm oo0tptoiocildfaDrmuvpnt4arerir oatlatean ols0 rxmir nu1llt lfeias)sDur(ro;u1aetnifetad m2uau s;(0 lenmrcoo1fptrlueo;t) eur(r iodom  mnes s a2tmxmonu0opeoif3ilslaDrl( o u0alxomo3ta1fm  anei;t0seuoxo3oo4ol elfcsasfsDtax  nu0tee if3iatlsDrlu s u)tlxrxr ty1fpD  uei s s2tr(r oodal emfcsas)srtmxmpot0tetomieiatlaDrmnmsnt4texrmo3iytla eaivs;t0s2uo(m3nodalen feia( artruro;u1aex  feiyd a2ea(vo;u4tltnxr totfate ueil(  rxo(o3no1lpeemfeta(f 2umxr ;u1tle  o3tydlmDraumpnu0alerio3ta1fptelies;( srurio3iudlltnmiei sfs2rmu  ;u0tee ioeiyt a rlnvsnt4 eenxrctydfatr iei (0 rxm(o3oy4al   fvs tfa2tr(rooo1apt iieiadlm2emu s;(4areniociotoateau o s  2uo(r oy4olt  fci tf rtaxm ot4tpxoioctadfm2ua(vs ()artnmr oa1fp  auvil()t2um(mpiydop  lieta( aDrmx ono0tlx mfeiadfaDuan pnu)trenxr3ootoat lnvs;(0 exr(o3ny4lmtemiesa( s2umuro;t1aetoiicilsfa rmnms;u)altnxo3oadfa rlivils0srxmxm3iu1opeelivt ( s2tmxrpot4tpeoifcildla2rmnvs;u0 etrir3iy1fpDrauvs;s0srur(m3oo4lmt mnctlt srrrur nt1tet mfcias s rm(mo;(0trxnio3totlpD  ueo;t0teumxopiu1lltn fetl() Dtm(rp;t1apxn octatlmDranmp u) lxoxfcoatop r uvo;t0sruo(m nudlp emnci () rra(  nt4tlx mocils a ra(mpnu4aexnxo3oodlpD aneils seurirpou4lpt mnctas  2tm( p;t4alx mf3tltfmDeanvp;u0 rtrmrcoydfptrlivol( texmxo nydamenlfvsls)s2um(rooo0aeenif3ildla2ul(mo;(4alxnio io1fa  livi;()texr(rpiodom nmnvia(  2rm(ronu0oetn f3iyslsDul( o ()areomocoo1lmD an o s0 2umimpny1aptnlnct s srtmx  ;o0ope mf3taslm2rm( p;u0alxrmo oadlpDrauei;t trxoxr3oydapt miciatf 2ra(ro;u4tpenmietyd s2rmuvs t4artrxocia1lp eln o;s)t2toxopny1ll   fcsat srtaurono0tpxomi3iad aDra(vont0tlxrxoctadfaDranei s)srumxo3iy4amt lncs ( sDum(mo;u0tlto i3iytla2rm( snt0aetomrcoydomDeluvsl(  2xrxm3nu4op nmfeslt  Drru ono1aeenifetasfaDrmuvo u4 ltrxf3iytfaD aivols srxm(o3iodom  lietlt  2tax o;u4apenmi3tyt aDulnvsn(0 exrmocoa1la rln o s)teumimpoo1ol  lneslt  2ua(rpnt0oltomfciat m rmu ont4 renxf oytfatelivsls0srxmir oy1ape livtasfa2taur ;u1apenif3tatls2umn o;t)trtoxr iatlpDraies ()trumimpnodlltemfeil(fa2rruront0open oetat m2ulnmon(4alenifciodfatr nvol(0s2xmxm3ny4lp e nvt ()aDtax p;t1aleniicild sDrluvont)alxrmr3todfpD  iei;t  euoxm nu1olenmfcs s a2taxrono4tpt ifctld m2uluvp;(0tlerio3totom rln s (  2uoxo3nudoptemieils  2taxmpot4olx mi3iyd s2em(von(4aeermf3oytlpDr nvi s)srxm(m3oo4ope liei sfartrxroot0tltn ieils m ul( o;t4 reoxr totlat auei ( sexrir3oudll n icsl(  rtrxrpno4apeoiiciyd mDea(vo;u) renif tadlaDeau o () 2uoio3ny4lp nlfct t a2uaum nu4tpto fctatfaDuauvpnu) lxrxo3oy1fa  anes;s)t2tm(rpnu4apeemfcslt aDtrumonu4olt  feilsfsDul(mpn() exrmf iadla rlivo;( trxo(m3iy4alee fci (faDuru  ot4alxo feiadla2ul( s;u)trerirciotoptranes (0srxr(rpiydam   nesas srtm( ono1altnmocilt m el(vp;(4 ltrxr iodop  li i;()tetrxr ny4amtnlfetlsf 2rax  ;t4tetn f3ilsfm2rluvs (4 exniocio1lp ean ilt t2uo(m iu1lm nlnvt (fs2ur(mp;o0altnifctysfs2umu pnu0tetrmo oatoaD  i s s)seuo(mpio4opeemnei t)aDta( pot1opxoiietlsla2ul( pn(4 eeoxf oadla rlnvslt) 2urxr iu1ole mfvias sruaxr no1tpeomfctas s2eanvp t0aeenxr3ia1latrlnvolt0srur(r ou4lmtnlfeiatfaDrmxro;u1tpxo octat m ean p ()alermr tatlp rlnesl(0 2xrxrpnudapenlivia( artax  no0tlxnioctas a umnvp u0arxoxr ootfpD anvs t0trurim3oodomtnlfesatfs2ua( p;u4opxnioctldfs2uan pn(4tltrir3tatomtrln il(0srtoio3ny1omt liesa(f Dumu  ;u1alt mieiaslm2eauvsn(4altnxo to1lat aneilt0tetrim oy1lpeemnvsat)s2trumpoo4ale mf3tytls2rmuvs;t4tetrmfctadlp e uesls0 2xo(m3iy1op nmieiltfaDum( pno4ole  f3tltlm rm(vp t0tlenir ty1fmt au i s0t2xmim iy1oleelieils)aDrrxr nu4tpeomfeiatfa emuvp u4 lxrmf3io1om r ivols) 2xrio oydamee feilt  2rrumpnu4alen ociadlm2uanms t) exrmrcoo1fmDe iei s srtr(opou4lltelnes (farrr(rpoo4tlxo i3tat m2rln s;t)alerir3oytlp eaivo;t0 2ur(mpoy4lp   ivils a2tmu oou4oee  iciyt s raump;t0texnir3tatlpDe nei ()trxriopou1omeelnvia() 2raumont1oetnmo3ilsfm rm(vpnu)trxrxr iotlpteau o t seur(m no1altnmfeta(fa2trxmooo4alx  ociyd a elumsnt4tlxomo3ia1fpt  n il( truoxopio1lpenlnet t sDrr(m ;o1aptoio3tatlaDulu snt) eeoir3oatop   uvo s s2xmxr3nudlp nmnetat)a2taxm ;u4olenii3iysfmDrm(vonu4alerxr3tadopDranvs s) exoxo oy1lp  mivtlt srtmxrp;t0apt ifeilt s rlu pnt)tetrxr3oadfatrauei;s setoirpio4altelfviat sruau pot1opxnmo3tldla2elu p;u0trxrxf3todom  ai i;s0t2uoim3oydol  mnetlsfartrurpno4aex  feiytfs2uaumo u4trtnxf3ootlaDeanvslt0teto(m3iydaleemicils a2rmumont0opx ifeiltfmDran on(0tlxrif tydfpDean o s srumio ou1om  lfci s)srtm(rpnt1alxnmieiytls el( pnu0 rtomrcia1lat aies t texmimpnu4amenlieia( aDrrum nt1tpen iciasls2rm(mo;t) rerxf3iy1lpte ieo ()srtoiopio4alt  ies s)arrr(m no1tpenifeiydlmDeauvs (4 rtnmfcoadfmt lueil()s2toim3nydope  nct (fs2tmxmpot0tpen ictaslm2rauvs;t)alxoio3oodlm  lueols0tetmiopoodlpt mfeslsfsDtrx oot0oet  iciytlsDea(vp u0arerir3tatla e nei ( srxm(r3iy1lltn fct t)artmurooo1ole  feils a2emnmo t0trxnmocoodomtrln sl( setmxr oodlmenmiciat artm(ro;o0tlx iietaslaDelump t4 exrif oo1op eli i;(  2xmiopno1ol n icia()a2trur ou4ape  f3tatlaDul( pnu0arerxr3oytlatraivils)s2uoxmpiy4apt mfcs t) 2tmumpnt0oltnmociytlmDumu o ()alxnmf3todfat luei;t t2xo(r3nodlm nmnci (  Durx p;o4teen f3tas m eaums u)tltoifcoy1fm rln olt s2toir nydoleemnvia(f Drrumo;u0tlenmo3iat sDum(msnu0teeomo iydlp  lueol( sexrxm3oo4ape mfvtltf 2ur(mp;o4tlxoif3iasfm uanmo;u4artnxr iy1fmDrli s ()s2uoim iydalt mncsls a2uau  ;t0tpt  i3ildfm2rlnvp;(0tetomo3io1lmDelivo () 2uoiopou4llt miei tfa2um(  nu1apt mi3iyslm2rluvp u0texomr3iy1fmDeau ols0srxrio3iodolenmics (f Dtr( poo4oltomieiatlmDuauvo u) exrmo oodlpt li s;( seto(o iu1lltnmivia( aDta(rpot1oeen f3ils aDrmnmont0 rtrir3tatfmtran o ()trur(o3iy1ll   neta(fa2tm(  ;u4alenmi3ildfm2emn sn()aexnxo3ootlmteanvs;()seumimpny1apt mnvil(f Dtmx oot0tlt ioeiad aDeanvo;t0aeeoxr tadomD  uvs;s0t2ur(m iu4ope livi tf 2raxrp;t4opxnmoeiltls2um(msnu)teeoif iodfmteaivols  rumxo3iy4ameelicias)srtax pno4olx mfetysfm emu on(4artomf3iodoptranvolt) rxrir iudlpe mivtl()s2ua(monu4tetn i3ilt mDea(vsn(4tlenifcoytlaDr nvi;(0srxoxrpiy1ole lfeilt)sDra( o;t0oexn ociyslsDuaums ()altnioctytla r nvo (0t2umxr3iu4olte fvi t) rumx onu1alx mieiydfs2rm(vonu0aexnxf3iytoaD aueils0t2xmxo3iu1lm  lnvtasf 2uaum nt1opxomoetltfsDumuvpnt0 rxoio iotoptranvol() 2ur(m nu4ome mfct sf 2ur( pnu4aeeoioeiad sDra(vo;(4 rxnif3io1fmDeanes;s0trtoxr ou1alenlfcsas  2uaur nu0ape mf3iatlmDra( o u) lerir3oydoa ranvslt0trtm(r3oy1omtn feilt srtau p;t4tlt mf3iaslm ra( ont0aleoio iadfm  auvo;t0srtoxr iy4lpeelfct (f 2truroot0tltnmocildla2ul(vp u)treoxfciotoatelneol(0 2xoxr3nudllte fvt s) Draurp;t0oeto f3tadlm2elnms;u)aetoir3tatfmDr ueils  eurxmpoo4apee feiat arraxmpnu4ape ii3iydls2ea( o;t0teeoif tytlpD lnvs s0 euoxr iydaleelncta(fa2tm( pou1tet  f3tydla2emnvp t)trxomoctadopte n o (  exoio iy4omtnmfvsa() 2taxmpnt4apt io3tlsfsDeluvs ()alxrxrcoodfaDe ues ()t2umio3no1opee neil(fa2rm(rp;o1oex iieiatfa2elnms;u4 rxriocoydomDr iei (0 rtriopiodame  nviatfa2uauro;t4oex  ictydls2rm(vo;t0alenxo oatoa   u s s)srxoim3ou1optelfvsat artaur nu0apenifeiadfm2rmnmo;(4 lxnir iodlptr u i t)s2toxr nu4opt mivtat  2uaxrpnt1optn iciadla rm(vpn(4trtrif iotlaDeaivi t0tetm(o ny4lle  ncsatfaDum( pot0tltomoeilsfsDuaums (0arxnmo3iodfa rliei t)srxrirpoo4lmt lici ( a2rr(moou0alxomiciadlaDua( s t)texrxo3todomDr n ilt0seurxrpnu4amte ivias a2trxr oo4tet mfeiasla2ua(vo (0 exomrcio1oatrau o ()srxo(m oy1omeelivslt arrmur ;u1aet miciyd m2rmn on(4 etnif3totfaDraiei t0 rurxrpoo4omen iesl(  2urur oo0tpeomoctls a ra(mo t) reriocootlatrli sls0s2xoim no4amtn neiatfsrrrx ooo1teeo f3tydfa2el(ms;u0altnmfcoa1fat lieils0teum(o3io4ame  net tf Dua( poo1ope mo3iyt s ranvp;t4alxrxo iatlaD lueo s0srtrxo iu1apen ict sfa2ta(rpoo0tleoioetls aDumnvp;(0tlxnif tatoa ean i;s0trtrio iydlm nlfesa(  Dtm(moou1aleoiociysfs ra(vo;t) ltomfciydoa rlnvs t sruoxmpnydoltn fcsls  rrrump;t4olto icilt s rmuvon(0aexrxo3iodla rau s t0tetrirpno4alteliviltfs2uru ooo0opxoif3ias aDuaumo (0arxrif iytop rliei ()s2xmim3io4lmt  ivt (f 2rmxrp;t4altomfetatlm2rlumo t4teerioctotfpt auei;(0tetrio oo4alee fetat)sDrmxmp;u1aptoiiciatls uluvp u4 etoxrctadlmDr nei ()srum(opnydopeemnetltfsDurumoou4ope  f3ils sDranvsnt0tetrif3oa1op   nvs t setriopnu4lltemnct (  Dtmum oo4tee miciadlaDrl( s t0 lermrcoatoateanvs;s) etrxm ny4opt  nvtas  2trxrp;u0tleo o3iyslmDranvs (0 exoxr3oytfaD livsl(  etrxrpnu4lltnmictatfsrrm(rono1apto fciltla emn pnt)trtnxo iydlaD  uvi;t)sruo(rpoudoltn nesls  Dra(m ;o0ale io3tatla emumo;(0texrircoatlpDran s;()t2xrio3iy4ame lfcia()s2rax pno1alenii3iasfs2ea(mo () eenxfctotom  luesls0t2trxm3ou4al nlfetasfs2ururonu0alxomf3iltlm2emnvp;(4artrmf3iydfaD lies t s2xmxm iu1ll  lfvtat) 2tm(ront1oeto f3ilt s2rmnvs t0 lenmf3iydopt  n i (0t2xoio no1lptnmnctat  2ur(m ;u0oexomoeiadfaDra(vs t) lerir oatfm  luvolt) 2xmxrpiu4lp emicils)a2tr(mpou0aetoif3iaslm rmn s;t0aexomfciotlmD anvo (0sexoxm3ny1ome lfvi (f 2rmxro;u1tle  feiydfaDelnvs t0 leoxo3todfmt anes s0t2trio3no1llt mfeil(  rrau  ;t0olt  fcildlaDrlnvs;()altrxrcta1oa rau ils srtr(r3ou1alte ieslt srrrxrono1aeeo icias m ra(mo t) rtrmf3oodoat  u o;s)t2umxo oudaltnmnvias)sDrru o;t4aexniietaslm rmump t4 rxnmo tydfmt  u sls)s2trir oudom n fvt t  rumxmpot4tle moctlsfa ua(vpnt)tlxnif oytlmD lnvilt) 2xm(m nudapt lfvsl(f Dta( pnt0oetoif3iyd a rl( on()arenxocoa1fat  ivi;s)t2xr(m3iy1opeelfcs t)aDum(mo;u4altn ociyd a uln s (0 rtnio iodfm ranvs (  exo(o iy1ol  mivtas)sDraxrpno4aetoiiciytfm2emn p u4aexrmo3oatfaDrlueil( s2toim oydop nlnvslsfaDtaxmp;o1tlen fctadls2rmumsn(0 rermr3oydla eaues t0 exr(mpiu1om emietas)sDrm(ront4altniieiad aDrmumont0 lerxo3iadla   i i (  rtmxo3iodalenmnvtls s2tru onu1texomiciyt mDrm(vp u4altomr3iadfpte ueslt sexmio ou1lmt licsltfsDrm(mo;t4altn i3iasls2uan pnu)aleoio3ootfa   n s (0 eum(o oudamenlfvilt sDurx  no1ape ifeias s2rmnms (0 rxrmf3ia1faDeanvs;()s2xrio3oydope lncil(f rra(rp;o1tex io3iasfa ea(vs;()alenxfciytlp elu s (  rtoxr io1lltn ivsa() Dta(m no1olxo iciasfs2um(ms u0 ltrir3iodfaDeai o;s trxrio oy1omtemivilsf rtmx pou1aptn fciltfa eauvp;u0alerxr iatoaD lu i;(0 rxmxm3ny1altemieiasfsrraurpoo4apxn ociyd m ul(ms;t)aeeomf3oy1fa raieo;t0texr(o iu4lptnmiesat  rtmu pnu4oltoiietas sDua( p (4aetomo iodfat  uvi;(0s2xmio3ny4alee iesa(fsDumum ou0alxnioctatlm2rl(mon(0 lermf oodopDeli s;s texoxm3nydaltn ici (  Dtm(ro;u1olx  f3iltfm2em( onu)trtrxr oatfmte n ilt t2toimpny4ope  nvil()srrm(roou4olenmfeiadfa2uanms u0 rxrir to1lm r ueols0 rxoxmpnu4alt lnvsl()arrmxroot4apxo iciysfa ua( o;u)aeenir to1omtrlnes;s)trxoir nodam elnvta(fsDrmxr ou4tpeoifeils s el(mp;t0 lxomr totlp elneol()setmxo3iu4ll n fvsat)s2ta(r ;u1aeeoiietld s ra(vont0aeenmr ty1lmt  i s;t) rtm(r nodolenmics ()s2tax o;o4teeo oeiltfs2uanvs;u) rerxr3ia1laDelieols0trtoir3oydop nmfeta( aDtmxm no4apxomoeiaslaDrluvs;t0tltrir3ta1fp ean s;s) rxriopiodllenmict t)aDtrumo;u1texn fciltlmDra(mpn()texnxrcoy1fmDeaivo;s0s2xr(o nydlp n nvsatfsrtau pnu4altoiieilsls umn p (4artrmf3oa1fpDelnvo t) 2ur(m3no1amtelivs tfaDtr(mp;o0oetomfciaslaDumu o t4aexrirctadfa rlnvols  2umimpoy4opt mivtasfa2rru  ;t1olx ioctys a uaump;(0tltrxf3to1lm  ai ils0sexm(opny4ll nmfctl()s2rm(mont4ope  ieildla rlu o;(0texoif oadlpD  neslt)setoxmpny1am elfvsa(f 2raxro;u1tlxomfciasfm2emnvs;t)aetnmo iydfm rln i;s0 2trim3oudlptn ncta( arumumont0apenmfciaslm eanmp t0areoxo tytlmD li sls)texr(opoy4ole  ieia( arrr( ont0oeenmfeiysfsDrlumonu4 rxrio3oatfat aies;t)s2xrxm3oudlp  mieslt s2tmxmooo0alxnmocildla ra( s;t0tlermfctytfaDeau sls) 2xo(m3oo4lme  netasf rtru o;t1aeeomictld a um( s;(4alermf ta1oa   ivo t)trxmxr iy4ope mfes t)sDurxmp;t0tee  o3tlsls rlumsnt4 ltnmf3iodomD ai ilt  exo(r nu4llenlncslt sDuau  nt0oeenmociysfsDra(vs (0tetnmocoytlp  aivs s seurxr oo4oleelnciasfsrrax  nt1openmoetldlm em(vsnu) reoxrciodlpt lneol(  rurxr oudapt  fvta( srurum ;u0tle iiciatfa2rmums (4trtrxrcoa1fm e uvs;() 2toxrpnu4olenmnvsltf 2raxrp;u0tlx  fetydfm umuvp t4aetnmr3iadomDe ivils0 eumim3ou1ol emfesl(fsDra(m ou1tpt mfctyd s um( sn(0trtrmf3oytop r u s s0 exr(r iudamee ncsa(  rtm(mpnu0oet mo3ias aDrmnvo ()altoxrcoadfm  ai o t)s2tr(m3ny4am   nctlt)aDrru  ot4alt mociyslm2uanms;(0tlenmf3tatlaDraivols0srtoxm3ny1lle mfvia() 2taxroou1alx ioetytlm uluvsnu)artrmf3iytfmtrau s;t0srxo(opou4ale lnetl( arrmxmpoo0altoioetad s ulnvonu)arxomf iadfm   uvs s0teto(o3io4amtemfvsas) 2tau ono4aex ifetatfa2emn p u4artoircty1faD  n s;t)seumxm3iu4alen net (fartmxmp;o1apxniieiatlm eau p;(0arxnxoctydlaDe nes;() 2trxr ny1al nlieslt s2raum ou4tlx mfctyd s rm(vo;t) lxrxf3ootomt an o ( t2toxm3iy1oltemicslt s2urxronu1oetomoctltfmDem( o;u)trxrio iotlm e i i;s)srxoxo ou4ll nmivtl(  rurx o;t1texn feilsfs eanmo;()trenif ta1laD  ueo;( trtrimpoy1lle lncias)aDua( oot4aetoii3tyt a2umn s;(4 eenioctatfaD  uvo;s)seto(mpiudlmt  iesas)aruru ont0teen o3iaslm elnms (4aeenmr3oa1op rai i s teuo(rpiydlltnmfctls) rrrxro;o0alt mo3iltlm umnmo u4teeomr3ootfmDr ueslt0 rtmxo nu1lpen ivi tfa2ur(r ou4optomfeiasfm2eluvo t)trtnxo ootfmDelies t0 2trxo3oudlpe lfcsas artrxm no1oex ifeiadfaDrmu p (0 rxnmfciadfp   i o (0sexmir3ou4om nlietls)aDrmx pnt1apxn f3tadlm2uaumon(0tlerxf iodfm rau o (0 etr(m nodllenlfct t) 2trurpou4aex mieiadfs2el(vo ()aetomf3iodopD lnvolt  2trir oy4olte ncsl() rumur nt0opxn ictydfs ulnvo u4tlenif todlmt au o;t0trtrimpnudlltn nctat aDtrx pnu0tltnmoetadls2emnvo u0tlxrir iodfmtrauvils)srxrir nu1op n ivs t) rtrxrooo0aptn ociatla rlumsn(0 ltrxr oodomteaneo;t0 rxm(r iydapenmnvslsfs2ur( poo1tltnmocilt s elu s (0aetrmf3tydfptrlnvi;t0 2tmxrpoydlm nmivtls a2rmxroot0tlen iciyd mDra(vo;t4aeerxo3ootlaDr ueils)sexo(o3oy4omee iei sfa2urumoot4apx  i3ilsfa2rluvon(4teenmr3ty1fateli i;s) 2toxmpoo1op elfcsas aDurur nt0aetn octat m emn sn(0 eenxo oodoatrlueo s) exrxm nu4lm  miet tfs2ra(  oo4tpx moeiysfm2rl(msnt0 rxoif tadlmDeanes;t sexoim3no1om  lietlsf Durxrpot0opx  octasfa uau o;(4altrio to1oaD  nvo (0t2tmim3ou1opeemics sfsrrmx p;o4oex  ictyd a rmnmp;t4trxoxocoa1fptranvo s)texmio oudaltnlieiat)aDua(m nu4tlt moetldfmDran s;()teenifcia1oat anvo (0trtriopiy4ale mfcs sfarraump;t4tltoifeiysfs ulumo u)alxnmf3oa1lmte ueo;s)t2xrir3iy1am eliesls aDtm(ro;u0opt  f3iltlaDua(vp (4arenmo3oatlatr nvi;s) 2trimpno4olenlnvtl()artm( p;t0tex mfeias a2eln s;t)trtrio3oadoaD lueslt0 2urirpoudaptnmfvias)srrru p;u0alt mo3ilsls rmn p;u) eenio oa1opt  n s;( srtoxr3ou4optelivt t  2urx o;u0aetn i3ias a2emn s u) rerir iytopDeanesls  etrirpnu4olenmivt t) Dtmum ot4texoif3iysfaDulnvsnt0altrxo3ta1la e i o t srum(r3io4om n ieia( arrax ooo4tetomfeiyd sDrmums;() lxnif3iotlm e ies (0t2tm(r3iudop emictls)srur(  nu1olxomoeiytlsDuaump;t0aetnxrctodfm r nvo;s0teuo(m oy1om   nes () rum(  no0tlx  ociyd aDuauvsn(4alxnxo3tydfpD lies s srto(mpoodll elfvtat) 2trxrp;t0apto ictytfa2elnms t)texrxr oydlmD lu i ()s2tmim iu1apeemnesasf Durur oo0opxomfctlslm2ran s;(0arxrmf tytoa elnvo;t0texoxr3oy4olenmnvsas)srur(m nu0aptniieiltfm ra( pnt0tlxrmr3oatomt li i;s0tetm(m3nu4alenmivil( a2ra(m nt4tee  feilsfs2ea(vo t)tlerir3oatlat auvo t0s2trim io4lpeemncsas aDtmumpnu0aptnmiciysfaDrauvonu4 rtnxfcoo1fpD  ivi;()setoir3oodapt  nvsls  Dur( oot1altomieilsfa rluvs (0alerio3iy1fmtelies t)setrxmpiodam nmieil(f ruaurp;u0apxnmf3tydls2em(vp () etoifctadoaD anvsls) exo(mpou4om e ivi tf Dtru p;o4apeniictyt sDumnvs;u4trerio3iy1lpt luvo;s)seum(r oydlpeemfeil(  Drrxroou1tetnmfciysfaDrln p u)artoifcoatfp e ies;s setoim3ny4am nlictatf 2ua( pnu4teeoiocils a2emums ()alxnxfcootopD  ivs ( s2xoir3nydop   fvtl()arurx  oo0optomf3iltfs2uaumsnt4aetnxr3oodlptrli i s)s2xr(opoydomeemfct (f rtm(r ou4tlto feiys aDuan o;(4altrxfcto1om  liei;s texo(o3ny1lp emfvt ()sDtmur ;t1tex  fctadfm2emuvp;t4 rxrmrcoo1fpteluesls srumim oydamenmfeslsf 2tax  ;t0altnmocildlm2ul(vs;t0 etoircoo1lmt liei;(0tetrim oo4olen ieils arra(  nu0aetoif3iaslm2ua(vp;u0 eenxf3ty1lptraivs;s texrxopoydoptelfetlt srra(mp;t4apt mfeiadla2umump;()aeenxf3totla   u ols0seum(r io1ome lfvilt) rtrxrpnt1alx ifciysfs rauvo t0trxnio3iatoa  li sl(0 2tr(rpiudam nlics t) Dtmxr ;t0opxomoeildfm2rl( sn(0artnmocty1fmDrlnvolt)s2um(r3oo1ol   fvs ( sDuaxmoot1oeeoif3ils m2elnvo (0 rerxfcoa1fa  aiei t0tetrxrpoydllen fcsas s2raxmpnu1oltomoeias s um(vp u0arxrxo3tadla e iei t)t2xoxm nu1op elfctltfa2rr(  ;u1tpxniieildlmDua(mp u0altrxfcty1lp rluvs;s  2toirpou4lltelfesltf Drau oot4tetn oeiyd a2emu p;u4trxnxr3tytoaDr u s t t2to(o3iu1om  lietlt)arrmxmo;u0oltn ociyt m umnvo t) reoio oodfmt  u sls0 euoxo3iu1apte fvs ( aDur(m ;o1optnifeild s2raumont) ltnif3tatlpteai o;t0 2umiopou1llenlfvtat aruau  oo0tltniicils sDrmump;() lxoir3iadfp eaueo;(0 rxoxopno1lmenmfctltfs2tru onu4texn iciadls2uan p;t)aleomoctatfaDr ivs s0 2umimpnydape  ici ( a2uau  no1oexnif3tatla2eauvsnt4tltomrciadoate nei ( s2trxmpnydlp  mict t) rumxmono4opeomo3tlsfmDuanmpnt)trtrxfcoydfmDeanei;s) 2xrio iodame mnct t)s2umxm oo4aeeomfeiysfs2emumon(0alenmo3iatlptean i;t)seur(mpiu1olt lnvslt a2uaxmpnt0texomi3iysfm2uln o;(4altnmf3iydomD  ueil(  rumio oudoptnmivslt) Dra(mp;u1oetomfeiysfaDumnms;t4tltomo iydom rlivilt)s2uoir3nudal elnesl(fsDtmxmpoo4tlxoiicilt a2ua( p;(4alerxr3todoa  aues;(0sexm(o3oydop elfvslsfs2ta( o;u1aeeoiietadfaDrl(vp t)arxrmocoa1fpDe i o;(0srtr(opno4ap n nviat  2tmxm nu4tptn f3tat s rluvs ()aetnio iy1fpt aivi;t  2toio oy4ole micsatf 2uaxr ;u4ale ifeiydlsDuaump;t4altomrcoa1omt aivols)setmir3oydal n ivils  Dtm(mpou4ole ifciat s eln o u4 rxrmo3oatoa  lu ol( trxo(rpou4al n fet tf rurx  ou1aeto f3iydlsDean p ()teeomo oydfmteluvo;t)s2xoio ou4aptnmfvi ( s2taur no0aeenmfciadla2ra(vp u0 lxomf3tadfa  lnes;s  etr(rpnudapenlfeil(f 2tr(mpou0altn feiad s2emuvp;u0tltnxrciytlat aueo;(0 rxo(opiudomtnmfvtlt s2rr(r ;o1olt  i3iatlmDrau p;u0teenioctotla  liei;(  rtm(m no1ap n ictasf 2rr(  ;t1opt mi3iasfaDranvp u4 eenxo ootlmtran i;( trxoiopoy4apt  fci t) rtm(r ;u1tpenmfctyt a2ea( snu) ltrio ty1lpDe ues;t  rum(opiu4olen ict (farum(rp;u1tltoif3tad a um(vp;t4 etnmr3to1fm eln i s) etrim no1lm emiesa( aDra( p;t4oeen ociltfs uan o;(0artrxo iotoa eaues s tetrim io4olenlfci t)aDtau oot0apxo o3tat s rlnvs t)alxnifciytopt an sls)trxoxr3no4lltnlncs t) Drmum ou4oex mictls mDumnmpn(0 reomr3tadomDeli sls0seum(m ny1amtnmfvsl(  Dtr(m ;u4tptoio3iydlsDrmuvsnu4tlxrmf oydlaDeanvs;t0 eur(m3oydllenlfvsat)arrau  ;t4alxo icild s2umu s;t)aeenmocoadfm rau ils t2xmxr3oydaptelfesatfaDtaxr ;o4apx  octls m2ua(vp;t0tlenmr3oytlmtranvi;(0srxoio ny4omeemfctas)srta( ooo1aeeomictas m el(vo;()tetrmocoy1la eai i t0t2to(r iu1lmtnlicsl() Dtaxr ;t1texomieiaslsDulu o;(4trxrir iadopt ai s t0 etoxrpiudlm elncsl(farraxmo;t0alx  feiyd sDea(mp;u0teerirctatfa e uvs s  2ur(m3no4lme  fct () ruaxm no1tle  iciadfm2rm( pnt0 eenxoctydfa  anvi t0seto(r3nodam  mnvtatf 2ur(ro;u1tlxnmf3iltfs umu p (0 lxoio iodfat  n o t trtmxm iu4amtn ictas)artr( pou4aetn fetldfa2uln snu0 rxnxo todfmtrlueo t0s2xr(m3ny4opeelfetlt a2rau pnu4ope  i3iadfaDea( o (0tlenxocty1omDrlivs;t  etoxopoy1ol  lict sfaDrru onu1olxnio3iyslmDrln p u4 lxoxf3tatlpDeliesl()t2uoxmpnudamenmfetl( sDtm( o;o4olx mictltls2elumsn(4tlxrio3ty1oaDe ivi;t0 etmim3ou1al   ici () rtrxm ;u4tle miciltfaDua( onu0aetrioctotfaD lnvi;s) 2umim3ny1lpt livtas aDtaurooo1tpeoioeild mDel(vp;(0 rtnxf3oy1lmtrlivo;() rtm(m3oudale mnesasfsDtrxmpoo0altomociydfsDumu pnu0arxomfciy1lptr iei ( sexmir3iydam nmnvtasfa2rax p;o1oeen ieiatfm2eluvont4arxnmociatlmD luvi;t trtm(o3iodope lnesls  rum(moot1tpen f3tadls2emumsn(0 rtnioctadlmD lneils0seumxo nu1lpenmnesas  Dumurpno4tpx if3iltfs2rlump;t4tetoxf3iatoaDe i s ( tetoxm oydlleelnesa(fsDumxm oo0aptoii3tltls2elumsnt) rxoio3tytfmDe n o;(  2urxo3ny1al  mncslsfsDtrx pot4aexomo3tysfa rmums t)aexnir3oodlmt anvs;t0 euo(r3nu4altnlncsltf 2tax o;o1opeo fcias mDelnvon()texomf tadla eaneslt  2xmiopio4olen nct t  rtru pou4alt mictatfaDrl( snu4alermrcoadlmDr iei t0t2xrxm ou4llt mfvslt  rraxronu1aetn ieiyd a rln p t4trtoxf3tadla eau il( s2um(r3iy1ale  netlt)aDrmur ;o1tlx miciydlaDrmn o;(0aetoxo todom  aieol() rtoxmpiodop  lnvtasfsrtauro;t0opx iieiys a2rl(mp;t)artrir3todfaDrlnei;t0t2toim3nodomte fvslt a2rr( ono0oetomfctyd sDrl( onu) renxr3tadfmDelneo;s  ruo(o3io4ameelfesl() rrmxr ou0open octltfs2uluvs (0arxomf oytop  anvolt0 eumxr3iu4apen neil()aDua(ro;u4tee ifeiltfmDuln snu0trxnir3to1omteluvs;s t2xrxr ny4ol n nciat)aruru pno4ole mictysfm2eanmo () eeoif iatfptelieo;t0srxr(m ny4lp  mncsl() Dum(mpnt4aeeoiietatfsDua( s u)aexomo oy1oaDr neo t srumxrpoy4amt mncta()sDumxmoou4tlt  ociydls2um(mo ()artrif3iotlatelu s t0 etrxm ny4ape micsl()s2rr(rpnt4teeo i3tatfm2rmumo;(4trtrmfcoydomtrlnvo;t t2to(o ny1opt lfes s  2rr(rpno1oltn fetytfm2rauvp;t) eeoio oo1opt aneo;() etoiopno1alen icsl( artrurono1apt  o3tltfm2eau o;t0tltrmo3oy1fpDe ivo s0teto(opny1lmte fcslsfs2ta( ont4tex  f3ilt a emnvp;t0aexoir tatoa ranei;t0s2ur(m iudol  lnvtat  rtaxr nt4opx io3iltfm2elnmp;(0 exoir3ia1fmt aiesls  rurirpnu1amen ieilt  rra(  no1tpeoif3tydfs2rmn s (4 eenifcty1fmDe i o t0 rumxrpoo1op n fcs (f 2uax onu4oleomiciad s uluvp u) ltomf3io1fp   ivi t) rxrio oudoleelnvt ()srrr(  no1aex iocilsfs2umnms;()altrmrcto1op eln i (0t2umim3ou4ap  lfetls)sDra( o;o1tleoiieildfm ea(msn(4tetoir3tydfp raneol() rto(m oudlpen fesls  Durxmpnu0tetnmfeiydfaDum(vp;()altrirciodlpDrlues t0 exrim ou4ope liesasf Dum(r ot4tee io3iydfmDumuvp;(0alxoio3oytomDeaneslt)srxo(m oy1ol  mnes sfarua(rooo1oeeniicilsfmDul(msnu4 exoxf tatfa   ues t0truo(o oydopenlfvil(  2raxr oo1tptn i3tldfm rm(vo;(0texoxrcoo1lp   u ol()texoim3nudlmt licsl()a2rmu ooo0ape mf3tlsfsDuln s;(0altnircoy1fa  liei;s)t2tmxmpiodomt mics sfa2tmu  no0tlxnmociltlaDum( s u4 lenio io1op  anes () rxmxr ny1al  lfctas a2raxmpno4tlt mf3iyslm2em(mo;() eerxr iydfaDranvs;s) 2xr(o3iu4olt lieils)sDur( p;o1oee mfeiadfa2ra(mo u4 ltomf io1om rli o s t2xoxm no1lm n fvias  rua(r ot1openmoctldla umu p t) rermf todlpt livs t) euriopnydlpenlicsasfarrau  nt1aex moetatfaDrmnvsnu)tlenmo3oodfpD au o t0 rumir3iydoltemneil()artmxmp;o4apx  i3tas s ul( p;(4tleomf iy1omD liei;t0srxoio ny4alenmfcs s)srraur ot4tpxoif3tasla ulnvpnt)areoxoctytomD  u o;s texriopnudlptnlieil( srraur oo4tpt mieiasfm2emuvp u4tlxrxrciotfmD  iei s)sexmxo ny1al  miesls s2ta(roou1oeeoioeiyt aDrlump ()alxrxocoo1faD li slt t2tmxo3iodol e nvil()s2urxr ot4tpe  o3iyt a rauvp u0tleoircoadlm eauvi t) rxr(o3oudlp n nvi t) 2tmxr ou4olto fciyd s uan s;t0arxrio ty1fmDeanvs s  etm(r oodomt lies s)s2rmxro;o1oetniieiadfs elnmsn()trerxr tatopDeli o t)seuoxr no4amt  fciatf Dtm(mpnt1opt  oetasfa2ulu onu4 etrxo3iadla  au s s) etm(mpoy4lpe lnvi tf rrax ooo0oeto i3tyslm uauvpn() etrxr iodlmDr ies;() rumim nu4apenmnvtat  Dtrxroot1ale  i3ildfm uanmsn() rxnmo3iadfat auvo ()t2tmir3no1ll e ieiltfa2ta(mp;u0aetnifeiadfa2umu pnt) rtnifcia1omtr uei;( t2umxr3iu1lle mivta(f Dumump;o4tetomoetyd sDemuvp t4texrmfcio1fa   ieo;t s2umiopiu4alt  ivi tf Drrumo;o1oetniietys m2ea(mp ()tltomrcoa1laDr nvo t)tetmxmpnu1amtelivta()sDrrum oo0ale  ictadls ul( o t0 lxnxf3tydoa e uvil(0trtr(m3nodlp  mnvsat  ruaxmpnt0teto ietat m2umnms u4 rtrxrciatfpt  i olt0 2triopio4omenlfei sfsDtr(r nu1tee  ietas aDrl( pnt)trxrmfcoadfaDranvi ( seum(r iudoltn nctasf Drm(mp;o1optnmfciatlaDelumpnt4altrmrciotla e ueol(0 rumir3iu1llt lnvtlsfsDua(monu1openmfciyd m rlu o t4 exnxf3iotlm eaneo s s2uo(r oudalen iviatfsDtrxr ;o4aeeomoctys s2ea(vpnu) etrxrciadoaD aueslt setm(o3nu1am emnvt ( arrr(rpou1olxomo3iytfm2ulump t4tlerir3to1faDeaivs t)srto(opnudal emivslt)sDrr(rp;t4alxniociys a2rln o;(0trtnxf3to1laDelies t0srxo(m3oudame  fvia(fs2ua(rpou1tptomoeiysfa2ulnmo t4artniocootlp ran o (0 2ur(rpiydalt mfvtatfsDururp;o1ole  ociatla eluvp;u0aexrif oytopD lies;t0s2xrxr ou1apt  fcsatfs2rmx pnu4ole  f3tytfs2elnmp;()alxoxf ty1omtrlnes (0t2trxm no4olt mncia(farraxm ot4ope ioeiltfsDrm(mo u4 eerif iadlpt lnvi t) ruo(opnudll  mncilt arrrum ou0opt mietld s2ea(vsnu0 ltnio3iodlp rlu o;t)srtr(r iodll   ict t arum(m ;o4oexn f3iyslsDuau p (4tetrio3ia1opDrlnesl( trurirpiudlmeemnvt s)sDraumont1oeto oetlt a2eau s u4artnxo ia1opteai ilt0t2xoir iu4ope lfcsl(f Dua(mo;u4tleo fciyd aDul( s;u4arenmf tytop eauvols sexo(o oo4oltnmfcslt)s2rm(ront4oltn o3tldfm emnvpnt0teeomo iodlate uei;(  exr(rpnodal   fetlt)a2tm(rpnu1oee mfctyd m2ulu s;u0trtrif3iadfm elueo s0texr(m3iudomtnmnvi t) Dtmxro;u1tptn f3iltlaDuln s;u)alermf3to1opDe i o (  etmim oudlmen iesa(faDuaxmpnu4oltn feilt s2ua( p;(0 rxnmr3iatlpDelues s0texrirpnudap elfei t) rurxr ;t0tex ii3iasfaDelnvsn(0trxnio3totla eluvs;s) exmirpoo1omeelfctls)a2rr(  ;u4openiictyd m2eanmp;(4aetrio3oatfm ranvo;t)s2ur(r3nu1omenmnvi ()sDtrxrp;u4texn fetasfs rln p () eenxf3iatom raivi;(0s2urir3nydomenmnvtlt)srrm(r oo4tleo iciatfm2elump u0altomf3tydop   ieil(0trxrxopny4llee ncta()aDtaxmono0olx ifciysfa ulnmsnt0 leniocoy1opDe ueils0s2trio3no1amtn fvi t)aDua(  nu0ole  f3iltlaDrl(mo t)trxrir oatlpD aies;t0s2uoimpoo1alee ictl(farta(r ;u4tetnio3iytls2rauvp;() exomr3oytop elnvils)t2trxr no4apt  fes () 2umx o;t0alxn oeiadlaDuanms;u4aexnmrcoa1lpDeluei t) 2tmio oy4lmenlnvtasf rurxr nu4apx  i3iatfa2uluvo t) reoircoodomtran o;(0seum(o3no4altnmncia()sDrax onu1aetoiociydfs2uan snt0 ltrxf iy1faD  ueilt s2urxopny1om   ictat s2truroot4oetomicildlmDrmu s;(0alxoircoy1fm r u i;s0trtrxo3ny1omee nvsa()aDtrurp;u4alxoioctls m2rl(vs;u4 exomo tytfatrli sls0 eumxopou4apen net (f 2um(rp;o4tetnmfetlt sDean s;(0treoio3ta1fat  i i t0srurirpiu1op nlnei s aruauroot0aeen octas s elu snt4 exrmo3ia1om rluvils0setmxm3oudom   nesat)srtrurpoo4alxn feildlsDua(vo t) rtrxo3tydomDe n sls trurxm3io1alt  nvtat)s2trxrpno4alx mfeiad m2ul(vo (4tetomf iodfaDr ieo t0tetm(r io4om n nesl()srumum nt0oex miciytlsDrmn pn()texnxfctatfmDeliei;(0seuoirpiudap  mncia(fs2rrxroot4tlxo o3ias aDulu o t0trtrir3to1oa elneo;s0 etoio3ou1lltnmfctlt srrmumo;u1tpe mf3tas m2eau o;u0trxnmrciydlm rli o (0tetoio iy4apt  ivsa()aDra(mpnu1ole  oeiatls2rm( snu0trxrio3iotomD au o;t0s2xrxo3iu4optemnctat)s2ra(rpou1apen i3tasla2rmnmo u)trxrxfcia1lmteai i (0s2xmxr oo1al nlfvia() rtru oou1teenmf3tydfa2rmnmp t4 etnircty1omDraneo;()sexrirpoudomeelicsls)artrxmo;t4ale moeiytfs ea(monu0 etrir tadfm  anes;t0s2xm(mpno1lle mncia(fs2urump;t0apx  f3tadls2eanvsnu4teenmf3oytfaDrlnei (0trumimpou1oltnmnvsls) rrm(r ot4opxn ociyd m emumsnt4 ltnmf3tydfm elues;s0 2uoxrpiudap  mivtlt srtru ont4tpeo feiydlsDem(ms t)aeermf iydoa   u olt0trum(m3nudaltelfeia()aDta(ro;o0tpxoiiciysfs2umu pnt0 rtrmociy1lpD ai o;()t2tmio3oy4om  mfvil(  2tm(m nt4tlx mfeild sDemnvs;t4tlxomf3ia1lmDe u i t0truo(r oydom e icsa() ruaxrpno0tee  ietld m um( p;(0tlxomr3ta1fp  lieils t2xmir3no4lmeemnvsas  2urxrp;o4oetn o3tysfsDeau pnt)alermf3iodoa e ieslt  2uo(rpio4ameelnvi tf 2taxmpoo4olen oetadls2ranvp t)altrmoctatlaD lu s t) 2toimpnydaltnlfesa( arrmxm ;u4tltomf3ils m2ra( s t)tetnmrcty1om ran i t)s2urxrpoodapen ictat sDrrurp;u0texnmi3iad s2eanmpnu4 ltoirctytopteauvs t) 2um(o oy4ap n fvi t) 2ur( ont4tet ioctyt s rlnmo u) ltnmocia1fpt  nes;t)trxmio nu4olt lnvs s a2ra(  ;u0opt mietydls2emn p u0 rtrxr ootla r nvilt0 2xm(r ny4oltnlfvtltf Draxront1oltn fciyd m2ea(vs t)aeermrcoa1opt au il(  rxrim ny1apt lfciat  Dua( oou0tlt  ictasfs2emuvp;t4areomo oa1la  lneslt0 2xmimpnodlm nmnvilt)srrax pnu1aptnmociysls2ra( pnt4 ltrio ta1lpDraneo;(0t2xm(m3nydomtn neslt) rum(rp;o0opto icilt sDea(mpnu) exnmfciy1fmteluei;s0srumio3ou1ol   fesat) rumurpot4ope  f3tys sDul(mo u4tetoif iatlmtranvs ()t2uoxo no1ol   nvta(  Dtrumont0altomo3iysla rlnvp t) etnir ty1fp rlieo;( srxoxr3no4al emncsas srtrxmoot0ape io3tatls2rl(mon(4altrircia1fp  liei s0t2tmir3io1open icsasfaDta(rono4oet  ieiyslsDulnms;t4trtoxf3iytfpDran ils) 2toxr ou1lmen iviat)aDrmum ;o1tetoiieils m uan pnt4 ltrxr oodlm eln ilt0tetoxr nydame lfesasf 2ua( o;o1oltomo3tat a2em(mp;(0aexoxr iytopD lnvo t)srtoim iu1lp elfvt s  rra( pou1teeoif3iytla rmnvsn(4 lenmo3tatoaDrlieils)sexrimpny1ol  mncsl( arrmx oot4tet ioctat mDua(vonu4aetrxo3iotfptr uvi s0texo(m nu1lle micsl()s2umurpnu0aptnmi3iyd sDrl(monu)trenmo oadfpt ln s t)srtmxr3iudap   icias)arrrx oou1ale mi3iadls um(vpnt) etnxf3ootlpDraueslt0s2tmxmpnudameemicslt) rrmu oot1aeeniictltla2ul( s;(4aetoxo oydfp rai ilt)srumim3ny1alen net sf rtm(  ;u0aex  oeiytlsDum(vsn(0artrxo to1omtean ils0t2toio nu4optnlncsatf rtr(mo;u4olenmf3iyd m ranmonu) ltrif iytfa rlnvi;t)s2uo(o no4op nmfcils a2rmxr nu4alto icilt m uau snt)artnxrcoytfat an s;s)srtr(mpnodll n icsls sDurx ooo4tleomo3tysfa2el(ms;(4tlxriocty1fmD luvils0 etmxr3oo4om nlfetlsfaDtrx ono1alt mfetysfmDumnms;u0artomr todlp   nvo;() rtrir3nodlm e fvsltfa2tau pnt1aet  i3iasfs uanvs (4trenxr3tydlatran i (0 ruoio3ny4op e fviatf rraump;t1texn fetadfs2rl( o;u4alxrxo3ty1omDr u i () rtr(o nudop elfci tfs2tax pnt1ope  fctatfs2rmnvs (4 rerir iadopteanvo t srxmxm3no1op  lfvtlsf rrru pou4aeeo fciysfa2ua(vo;u)areoir3iatlaDe uvsl(0s2xoim3oo4lp nlivi () rtau p;t1opxo feias m el(vsn(4trtnmr3todlat anvi;t)trxrxrpio4ap emfvilt)artau p;o4olxo o3iatlm2uaumonu) eeoio3tytlmt aiesls  eum(o3iu1oltnmnvsl(fs2ur(mpnt0tlxoiietydfm2rauvs;u4aetnir ta1op r n ils  2xm(rpoydlmte ictat  Dtrxrpnt1texniiciys s rlums t4artrxfcty1fm eaivi;t  rto(o ou4ol elfvtlsf Durx p;u1aeeo oeiadfaDemumpnu0aeermr3oa1fptr ieil(0s2urxmpoudam   fvtlt aDrmumooo0texo o3iadfs2rluvp t4aleoir3oy1opt lnvo s0t2toxopoudoptn fvslt)s2tr(mo;t1ole mfciysla2rlnmonu4tlenmocta1omt lnvi t) eumio3no1olte ivsa(  2uru  ou4tleoioctas a2rln o;(4aexnxf iydlpDeai slt seuo(m nudlltelfesat)arrm(mp;t4aptn fciyd m umuvont0teeoio3iadfp eau o;s0 etm(r iy1ale  nvil(fsrtau o;t0apeo fciatlaDum(vp t4aeeomo3totom  livslt0trtoio ou4olt lfvsa(fsrumum ;t0texnii3tydfm eaums t) etoxr iodfatrlu s;() etoio ny4lp elivt t s2raxrp;o4alxo ictatfa2uluvo u0tlxrmf todfm  lnvi;(0s2xmxo ny1ol e fctl()s2rr(  nu4tpxoioetyslmDemu pn() rermo ty1oat aivils0teuo(m3iy1lmtn iei ()srtrumpno0tptn i3tasfm rauvsnu) etrxf todoa eauei;()s2xmxrpoy1amt  nctls)aruax pot4opxoioetatfaDemn s;t)aetnxo3oa1laDelieo t0seur(o ny1ome lneils)srrmx  ;t0oltomoctytlmDumump;t) rtriocoy1lpDrau o s0 2tm(opnu1amtnlicsas)aDtmu  ;u1ope if3iadfs2ea( o t0aexnmf oy1op e uvol()srxr(r nu1lme  nes tf rur(rpot0tetnmf3iyt s2umnvp (0 rxrir3totlmDeaueils srxm(o iu1optnmivt (f Dtr(mo;u0oetn oetys a rmuvs u4 eeoxf tatfmtelnes () rurio3oydamenlneia()aDtrxmoot1tlt iociyt a2ul( s;t4altnxf to1om r ueols  2um(r3iy1ape licia(  2um(rp;t1olxnio3iysls um(mpnt4 lxoxf tydfm eanvs t)trtoxm iydlpt mfctl(f rtauro;o1ale moetldlm rl(vp;t0teeoif to1fp e nes;t t2uoxo no1lmtelivslsfsrrm(rono0aee mociaslm rlumo;(0tetrif oo1fa e i ilt0 eur(o3io1ap emfes t  Dur(rpno1tex  iciyslm2rln o;u4aexrmo tydopDr uvsl( srurir io4alt  icsat)aDrrxmp;u4tpt  o3iysfa2em( o u)alxomr3oo1fa  lnvi t0s2tmxm io4lleelfctlt  Drmu  nu0oltnmictltlaDrl(vp;u4alxoxo3iytlp rlnes;t) rxm(m3iudlmt lfci sf rtr(mont4aexoiociat a eau snu0 rtrmfcio1fpDraneslt trxm(m3iydllen icsat)aDumxrooo1apeo octld m2rl(vo t) rxnir3ty1omDr ues;(  rxrim3no1lp emfvsa(fa2uaxm no1tpto fetlsfm emn o (4tlxrmrciotlatraies;s  rxrimpiodope  nvsas a2rr(mp;o1oex iieiysla2eln pnu4 rxnif3tadom eau s;t0trxmim3no4lmeelivt tf Dum( ont4tleoif3iadfaDrlu p () rxrxfcto1lpD lies (0 2xmio no1ll emnvia()sDtaxrpoo4opx moctytla eauvpnt4aetomr oytoaDe nvo;s  2umimpnodaltnlfeta(f rrmump;t4optoiiciyt a eauvs ()tlxnmfcoydlp rluvo;(0sexmxm ou4open nciltfa2rmu pnu0oexomfciytfa2emu o ()arxrmo tadlm eaivils0t2um(mpoodopee nvi s sDra(r nu0oetnmoeild m2ua( snt) eerir3oodlaDeauvil()s2tr(m3nydll emiesl( a2ta(mo;t4apt miciadfmDuanmsnt)altrio3iytopt livs (0 etrxm3oodlpteliesl(fs2tmx p;t1texo oeiltfa rl(vp;u0aeeomrctodlmDe ieilt0s2ur(r3no4apt lfvta() 2rrx pno4aleniiciydfa em(vo u0trxrir3oadlpt  uvo;t sruo(opnu1lmt  net (f 2rrx o;o1alxoifeiyt a ra(msnu0altrif3io1fm elnvs (0seto(m oydoptelncs (f Dumxm ;u1oexoifcildfa ran ont0tlxomf io1omDr ivil(0t2ur(mpny1omeemnci ( sDrrxrpot0apx mf3ilsfsDumn pnu4aeeoxrciatlpt luvo;( teurxmpoy4amtnlfvs sf 2taxm nt1apt  ieiatlaDemnmont0altnmf oydoat  i il(0trum(m no1lp n ncsat)srrm(  ;t1tptnmoeiad m2uln on(0aeerxf iytlpD an o t0 ruoio iy4apt mivt tfa2ur(m ;u1oltnmfeilslsDem( s;t4arxrmf oo1fmD aneolt0s2ur(o oo1ol nlnei s
\ No newline at end of file
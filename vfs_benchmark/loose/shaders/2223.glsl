@@ -0,0 +1 @@
+neo ()s2xmxm iu4omt micils  rrau p;u0ole  oetatla uau s t4 etrxr3iydoa raiei s)srurxm3oo1lm   ict sf rtmum oo0aexoio3tlsls2rm(mp t0aetoxf3ia1fpD aues;() rto(rpou1apeemnei t)s2uau p;t1opeoif3taslmDrluvpn(0 renxf oodfptelueo;s srxoxmpiodlmen ici ()aDurx poo0aetomf3iydlmDum(mont4aetnif3iydfmD lieo (0 eurxm no4omenmfctas sDtaurpnu4olxomoctlsfmDem(vp t4trtomr3iytfa eai slt) exoir3nodopte fvs s)a2rrxmp;o4tptn feild aDel(mp;()aeerxf to1lpDeauvi;( t2xoim nydaltnlfetl( arur(ro;u4aetomi3tas sDumuvo;(0trtoir3iodlpDrlnes;s0 2umxr3oy4oltnmfci s  Dum(mooo4tpeoiietadlaDrmuvp;t0texrmr iotom  li i s setoir nodlm nlnvtls) Dtrxr oo1alt iictls aDea( pnt4tetoxo iotfmte nvslt)t2toio iydlm e nctlsfs2urx ono1tlxo feils a2uauvo;()teenir oodom  anei s)s2xoir3nu4aptelfetlsfsDur(ro;t0aex mf3ilslaDul(vs u4teenir3iytlat anvi;s0t2triopoydlmtn ncslt)artrx p;t0oeen oeiysfsDrmnvo (0texrmocoatopDrluei;t)tetrxm3io4omte fct t  2taxr nt1alxn octld m2rlump u) eerxr oytfpt luei s0trtmxrpoy4lp elncsat) Drmx  oo4oltnif3iasfsDuan ont) lxoxrctadla  aues s  eumiopno1opte fvilt  Dumurooo0olto feiyt m2emn onu0tlenxfctydlpDranei;()s2tr(r io4ome lnciasf Dtm( pno0ole mieiysfsDuanvo;u0aeenmfciydfate ues;s)seto(opoydlm nlieil()srra( p;u0ape  fetytfm2eauvpnu4tlermfciatfpt  ies;s  rxoxmpiu4oltnmieias s2rm(mooo1tee ii3tlsfm umnmp;u4 lxnxo oo1fp  livils)srxo(r iy4lmenlicil()sDta(mono1altnmfctatfsDulu pnu4alenir io1omDelnvs;(0 rumir oy1lmtn nes sfsrtaxmoot0oexniiciasla rmnvpnt0alxrif3totlpt lues;t) exoxm no1omen nvi sfaDtaxm oo4aleomfetadfm2um( p;t) rerxf3ia1fmt  nvi;()srxriopio1op   ivtlsfs2rm(rpou4optnioeiyt mDemnvp;t)aeeoir3to1om eauvs;t) 2xrim iy1ol n fvtas  2tm( o;t1alx  f3tltfs ra(mo;u4arxnio oydfp  lieo s  rurio nudoltemfesas) 2um(ronu0aexnmieiatfaDuanvs;t)teeoxo iodomD  iei;t) 2um(r io4ol   neilt) Draxmp;u4tpeomf3ildfa2uanmpnu0aeermr3oy1lmD  n i;t trtoxr ny1oltnlicsa( a2raurooo1olenmf3ild mDel( s;t0aexoxr oydlaD aueolt)srto(rpny1lm   ivias)aDumx ono4aexo ietyt m2eauvs;u0trxnmo3totomt ai o ()t2to(o iy1lpe lieslt) Dtau pou1alx if3iadfm rmnmpnt0 rxrxr3ia1lmt  neo;s)truoim iu4altnlfcsas)s2rrxrp;t1aex  ieiys a emn s (4trxomo iatfm   n i;t0 exmir3ou4olee fcsl()s2uax pot4tptomf3iltfmDrln o;(0tltoxr to1fptr i s t0t2trir oo4lle mictl()srrax poo1oet  oetlt aDumuvs u0trxnmf3tytlmD luei;t0t2xo(o3no4alenmivsl(  Drax pnt0tlx mo3ilsls2uanvo;t) exrmf tatfaDr uvolt0t2tm(o ou1apenliesatfaDrrxrp;u1olenmfeiadfmDemums (4tltnxfcoy1la   n i;t srxmir3no4lpenlnetls) Drax  nt0tet mf3tls m2um(vo;(4 etrif oadoateaiei;s trurxopnodap   ivs sfaDrau ont1opxo i3ilslm2el(vsn(4altrmr3todoatrluvo t0 eumxrpiy1ome livtatfaDraumoot1aeeoifetyt a uau snt0trxoxf iadomtelu i () rtrxmpnodlmenmictat)s2trx poo0tlxnio3tys a elnmo u4trtniocoytlpt anvo t)seto(opnodopte ictl() 2ra(root4altomoeiatfs uan onu4arenxf3oadlmD lu i t s2uo(r no1ol  livt sfaDuru poo4oee  ocildlsDua(vo (0tltnmo3iotoaDeau i s) rxoxopoy4llt liesa(  Drrxroou1optoioeiadfsDrmnmp u4aetrio3ootfm elnvils) exmio oodll nmictas srurxro;o4opt  feiyd mDrlu pnt0 eenif iy1opDeai o s)trtoxopiydap   fcs t artau  oo0teeo octadlaDra( snt4altnmrcoo1lpDrli o;t0 ruoxo3oydaleemictasfartaur nu4alxniieias s emums t) eeoif ootlp  ln o s texrxr3iy1apenmfeiasfs2rmum ;o4apx ii3tlsls ranmo;u0tlerxo3iytoatrlu ol( texo(o iu1altelfvilt)srrrxr ;t0alenmfetad s2elu snu0aeerircia1oatr ivi;s) rxrir no4ap  lieslt  2tm(monu0opx iieiat a ean p;(0 etnmo ty1fp  livol(  rum(r nu1am emicils srrrxr oo0alxn ieiysla rmn snu0texnxf3ta1lp ran ol(0 2trxo no1lp n fvt sfsrumxro;u0texomo3ils a2rm( snt4areoxo iatlaD aivi (  rxmirpiy4apte ncsls)s2tm(moou4alxn o3iys m2um(msnt)aleoifcootfatraues;()trurxr3nu1om e nci t) 2ra(  ;u4oet mo3ilslmDrl(vo;() etrio3ty1lmt ai s (  exrxr oydolen neta() 2taxroot4opxn octys s2raums u0 ltoio3ty1optrlnvi (0trtr(o iu4altnlies (farurxr ;u4tltnmiciadlmDrm(mo t0 lerxo3oy1lm ran s (0sexm(r3iu4om   nesa() 2um(mpnt1opxnifeild aDumu pn(0 exnxo iy1lp  au o;(0 exrxmpiy4lleelnvi s)sDuax  ou4tee  ietlt sDeau ont)tlxnifciodfmte n ols srtoxm3nu1lmeemnvt t)aDurxm nu4tlxnmieilsfs2rl(mon(4 renxrcoo1oatr n sl() exmxmpny4lle  net (  rumxrooo4apt mo3ilsfa2em( s;t) lxnmfctatfpD  i il( srtrim3oo1lp emfcta( aDrauro;u1aee  ictadfs2ua(vo;t)tltoir ootfaD au s t0setr(mpiydolte ncsatfaDumxrpot0apxomocilt aDelu o;u0 rxrmf3oo1fmD  uei (0 2toim3io4ope mfcsatfsrrr( pou1tetnmf3iltlm2rmuvs (4aetomr totoaD luvils  2tmxm3ny4lpe livs (f Dtm(r ;u1tetnii3tys aDrm(vp t)trermf todlpD  ivils  exmxo3ny4am emfet t)sDua(  ;t1tlenifeiyd m rau o u)aexomf oadfmD aueol(0 etm(r oo1optnlfcia()sruaxrpnt0ole iociltfmDrluvo t0aeermo oa1lptr neo;()t2trxo3nu1omt mivslt)s2urumpou1teen ociydlmDeanmsnt) lenmr ootlmD  iei s0 2xrirpiu4olenlfcsas aDurx p;o1aptnmfeiyd m eau pn(0tltnxf oadfa   neolt)sexrxmpny1op emivslt)aDrmxront1texo f3iltfm2ua(vs;t0 rerir3oytfptrlies;s0srur(rpio1al n icils artru o;t0alxn f3iat m2ul(mpnt4tetrio oo1opDrlnvsls s2to(r oy1omt  nci s  rrauronu1tpenmocias m umu pnt0tleomf iodomtr i i;t) ruo(o3oudaleemfctasfaDtmxm ;u0oltoii3iatfs emums;u0texoio3oa1omD aivs t t2xo(r3io4opt lncsa(f rtr(  ;t0tltnmiciyslmDel(ms t0tltoir3totfpD ln o s0srxoxr io4am nlnvsl( srtr(mp;t1tpt ifetls a elu snu0tetomocoadfpDr u olt0s2xo(mpny1lptemieilt)srraurp;u0apx  iciysfaDranmpn() rtniocoy1op  luvo t0t2urir3nydomtnlfeilsf 2taxr ;t4optnio3ilsfs ul(vo t4tltrxf3tadoptelivs;s0 2xo(r3iodomenlnet s)arrmu o;u4aex ii3iltlsDrluvo;()tetnmrcoadfmt  ivs;(0truoxo ou1lm  mictat)arra(rp;t4opeoifeilsfm umuvp;t0arxnmf ia1fmD au o s  2toxopiodomtn nvsat s2tmxronu1oexnmoeias s2uluvpn()aexnmr3tatoptrai sl( teumio3no1oltelnet sfs2taxm nu1aeeoioeils aDrm(msn(0 eerir todfpDeaueo;( tetmio3iu1aptn ivtlt  2raurpnt0tet  i3tlsfa eau s (4tlxrirciotlmD anvi;t t2trxr no1ale mivtlt)s2rmu ono4tptomfciltfa el(vs (0trxnif3io1lmtelnvslt s2to(m io4llenmfesltf rra(rp;t1olt  i3tydfa2ra( p u)trxniocootomt an sl() rtr(rpoydomee ieiat)s2trxrpou4aetnif3iasfs2emn p;(4teerxo oadop e i o t)srtrxr io1alte fvsas)s2ua(mpnu1tex  o3iasfs2rm( o t)teenxoctodlaDeauvi (0 rxo(o io4llt lfviat)srurxr ;u1apxo fciatfs2eluvsnu4arermocoodoaDelnei;s0teumim3ny4opte ivslt)s2tr(  oo0olxo o3ilsfsDua(mp;(4tleoir oo1fmDr ues t0tetmimpiodoltemfcils) 2rmx  nt1aet  o3tlslm2uanms;u4 ltoif3tytfaDeaueols) 2tr(rpnu4ll  mnctlt) rtr(roou1oleo i3iytla2um(ms (0trxriocoo1la rlies;t trum(r3ny1alt lneta() Drr(mpno0openiiciasfaDem(mon(0texrxo3tydomtraueo ( sexoim ny4al  mivil(fs2tmxmpnt0aee mfetlsls2emumo;(0tlxnmo3ta1opt lnvi;t)s2trir nudap emieiat)a2rr(mono1ape  i3iat aDelnmo;t4 exrxfcoodfaDelieolt texoio ou4op  lfeil( sDtrx pot1tleo f3iysfa ul(vs u) lxnif3iy1omDrau s;s s2umxrpnydlpt lfcsat artrxm ;u0oltomo3tldfsDrlnvo (0arxrxf3oodlat  n i s)s2toim oy1omtnlfci sfa2uaxroou0aexomoeiaslaDrmump;(0trtrmoctatfpDraues;s t2xoxm3io1ole  nei (  2umxmpnt1apeo o3tltfsDrm(mp;(4 eenmfcty1lmt  u o s0texr(rpoo1optemnvils  rrau ont0aleomf3iat s rm(vp u0 reoxo iytfaD au slt srxrxmpoo4ope mnetlt sDtr(mono0aleo fetls a umnvp;t0tetrmo oo1oat li olt texmxm3iy4omen fvt ( aDra(  ou4opx ifetltfm rm( p;() rxnmf oatoaDeluvilt  rurimpoo4amenliet sfs2tax pnu0opxo iciydfmDem( sn(0tltrmo3oa1lmDrlu o ( teum(o3oy1lltelfcs sfa2rrxr nt1tlt if3tadfmDelnvp u0tlxnmo io1laDe ues s0s2uoio iy4optnlfctl(fsruaxm nu1tltoiieias m2uaumo () etoif3oa1fatelivi t0t2ur(o ou1lptemfvi sf Duaumooo4texnmf3iltfa umnms u4 ltnxo iytomDeau o s)trurxo oo1aleemfcsa(faDraxmpnt4tpxomo3iyt s rl(mont)trtomr oo1fatrlies t)s2uoxo3oy4al n fes sfaDtru o;t1altomo3iadlsDemn ont4teeomf3oadlmDrln il( trtr(o3ny4opeemfes tfartrxr ;o1tpeomoetatlaDrau s;()artoiociodlm elnes;()tetmio3oudape mfvilt) Drrx o;t1tptomfeilsla2eau o;t4alenio3to1fm eluvi (0 etmir3io4ape licsasfartrur ;o1aleo i3ildfm umnmpn(0 exoif iydop   i o s0 ruo(o3io4lpe lfet s  2ur(r ot4aetnii3ilsla2ranmpnt0alxoif3totlaDraivi;s)trum(r3ny1olenmncs ()srrau oou0oetn ociltfmDuauvsn(0 lxoxfcoodfa elivils texmxr3oo1lm emnvta() 2trum no1tle mieiys m2ul(vp;u4tltoio iatlm  auvs ( s2xrxmpoo1opt  ncsl( sDua( poo0aptniieiytla emnms t) etomfciydoa r uvols0teumirpiy1ole mnvtlsf rurumpoo0teeoii3tasfm em(vsn(4tetnif3oo1op eaneo;s sexmxr oudlpenmivta( arraxrooo4aeenio3iatlmDemnms;(4aeermo3oa1op r ueols texm(o iy1altnlfctltfaDrmu pou4ole io3tas s emnms t0 rtrmr3oa1lpte u o (0 2trir oy4omt  nvilt arua( oot1alxoiicils mDra(mpn() rxrxfciotfp  lies;(0 2um(r3ou4ame mfvs tf Drrxmo;t4opxoifctat a2rlu o u4 eenmr3iatfpD  nvo;s s2umirpnodalee nesa() 2urumonu0aeto feilsls umu pnu)tltrio iodfm r n sl(0srtmiopoy4apenlnvi t sDurx  ou0aee  f3iat m eln p;(0 exnio3ootfpDrauvo;(0srxmim iudop e fci t)sDurum nu1ole  ietysls rauvon(4alxnmf oydlat ln i;( sexoio io4al emfvt t  rumumpnu1tpxn f3ilt m emnvsnt)texoio oytfpDraues s  etm(r3iy1lpt lfesl(f 2ta(r nt4tpxniieiysfs2ua(mp u) eenifcto1oat aivo;t)s2uo(r3iy4lp   fci t)sDtmx pno4tltoiiciys s2ulu snt4 lxrxocty1fpDraies ()trxoirpny1ll nmfcs t srtr( ono0ope mfetadlaDuaums () lenxfcty1lpDrlivi s0 rurirpiu1amtelfcilsf Dua(rp;o1ale  f3iydlaDua( s u4tlermf ootfat livo t)trumxopnydal e ici t)srrmx ooo1apt  o3iltfm2rm(mp t0aleoxocio1latran il(0t2xrim3no1omen iet sfarrm(r no4tet iictasfa2eau s;()texrxr3oy1fmDrlivi () 2umio3iy4amtelici ( aDrrx  ;u0oetoifeiys aDumumo;t)trtomo3iytlm elnei s seuoxm3ou1lmte fcia(  2urumono1apt mf3tldfmDua(ms;u4 leomfcoy1lpt  i ol()seumim nodlptnmnvtas) Dtrurp;o1alt micilslaDul( s;t4alxrifcootop r i o t texoxm3oydameelnctls srrrxr ;t1ape moeiys a rl(ms;u)aleoxr tadlat  u i;t0 2urimpiy4alenlnet (  Drmu  nt1alxnmfeiysfs2ua(vonu)altnircia1fmt ai il(0srur(mpiu4al n fcias)srra(r oo1tpeoio3tld sDrauvonu0tlxriocio1lpD an o;t0 rxoir no4olenmnvt t  Dtauro;t4oetoiieiltla ea(vo;t)tetrir tadoa  auvils0srto(o3nu4apt  nesatfs2umu  oo1tlxoif3iat s2uan snu0 leoif ia1optelieo;s  2tm(r3oodalenmivsat)arrr(moou1teeniicilt m uan o u)tltnifciadfa elieils)seurir3oy4olt mnvi () rum(mono0tltnmfcilsfa2emu s;t4trtnxfctatoaDeln sls  exr(o3io1alt mnvi (f 2raumo;t0tet mietadfm emnmon()arxrxocoatoa rli s;s0 2xmxo3io4om   nesa(fsrur( o;u1alto oeildfa uau p t4 exnir tadfaD  ueo;s srtm(rpiodole  fvsls)arrmx pno0opx  oeiytfsDuln s;t0 lenmf iy1lmDeauvs;s0s2urxo3iodaltelnviltfarrmumoou0aee moeiad s umnmp (4 reoio iytfa rlu ols0setriopoydap emnvtl(fsDraxmpot1alxnioeiyslsDrmumon() etrir oa1fm   u i s  2uoxm3nu1op  mivsas)aDrrxmpnt0oleo octlsls2um(mo;(4trtnio3tadomDeln ols)s2uoim3nu1om  lfvs tf Drmum no4tlxoiictat a2uaumsnt0altnircoytom   n slt  euoxmpoudlpt lnetatfs2tauront1tlxn i3iydfm2uauvs;(0 ltrifcia1lmDeaueslt) 2xoxopno1am emnci ( aDtau o;t0ape ioetydlsDrm(ms u0aetomr3iodomDelnvil(0 etrxr3oudlpte fci sfsrrr(m ;u0apt moetasla rm(vo u)trenif iadlatrli i (  eum(r3oodoptnlfeias  rtm(r ot1tetniieildla2eaumpnu0 exrirctatop  aieo;t)t2xriopnydaltnmfctlt a2rr( o;u1alt mieildlaDra( p t) exnir oy1omtelnvo t0seum(rpou1omenlicta()arrau o;t4oex ioetad m eanvo;u4aleoxoctodlmteluvs;s)t2xr(o iudoptemfei ()sDrmx  ot1oeenifctysls rl(vp (0artnxf ootfa rli s t  rxriopoy1lm   ivtltfsDtr(r ot4tpx mfcilslm emnms;t0trtrxr3iydoateaieil() rtoxm3nu4oltemnvtas  2tr(m nu4texnmo3tatlsDrl( s u0altnxf tytlmD ln o s) euoxmpou4apeemfei t a2urxro;t0oee  o3iytla ulnmpnt0aetrif totomDe i ols  eurxo io1lpe lneiat) 2uaumono1alxo i3iad s2ranvs;t0aeerircto1fm rau o t  exmir nudllte ieil(f rrm(rp;t4alxnmoeiadfa ra( s;()tlxnmocta1oa  luei;t) rxmim3oudal nmnesl( sDumxmpoo0tltnmf3tatlmDem(msnt)trxoxr3tytop eaneo;( trxo(rpiu4am n iet sf rrr( ooo4oex moctasfa2ra( sn()altrmo3oo1lpt  n o;(0tetmxrpio4lle licilt  2ur( pou1optoif3iasfa ra(vo u0teeoxfcoadoaD  n sl( srtriopio1oleelnci s  Draxm ot4tptoif3tyd m2ranvsnt0artnmr ta1opDe nei (0teum(m nu4lp emnvtltfa2rrx oou4alxo i3iatls2emnmp;t4 etnxfcoydoaD livo;t)trxm(m3nu1lp e iet () Drm( ono1tpeomictlt s2ra(mon(0 rtrmrciydlp rluvsls  rxo(rpoy4lpt mfctl()srtm(rpnu0aleniiciydlm rl(mo (4tetnif3oy1lpD aueo;s) eurio3nu4al nmfeias  rrm(  ou4apxoioeiydfaDumumo t4trxrmfctodomD  ivi;s0 exr(o oydape lfeilt aDrax  ;o0alenmi3iltfm2rlnms;u0altriocty1fmtr nvils)tetmxm3ny4opt  nvsls)sDuau p;o4apxnmo3ias m2rlu pnt0altomr ia1latelu ils0teurim3iodlmeelnvta(farra(ro;o0tlxomfeiyd s rm( p;t4arxrircoydlm eau sls0 exmxm iydam nlnvta(  Dtrur nt0tpenioeias m ranmp;u4treomf3oytfpt an sl(  eto(m ny1om elfcils)sDrr(r no0tleomi3ilsfa rm(mpnt0altoxrciodfaD livs s)teto(opoy1oltnmfciasfa2tmu  ;u4aexn feiytfa umnmp t4trtrxf iy1fpt  ieilt) etm(o iu4optelfet ( arua(rpot1tpxnmf3ildla um(mon(0altomo tatfa eai sl( srurimpio1olte nvt sfs2tr(  nu4tpt mictytlaDel(mpnt)alxnxf ta1oa elu o;t) eto(opny1lptnlfctatf rtmxrpou4tpto iciltlmDra( p;u4artnmr3todomD  ues;t) exoir oo4ale  fvilt) Dtrurooo0tpt ii3iad s2ea( o;t)aeeoiocoadfp e u o ( sruoio nudap emici s)aDtmxr ;u4opt  f3tydls2ra(ms;t) renio3oo1lmte n s (0teurim iy1lptn nvt tfsrtmxrpnt1apeniictydfaDrlnmo;t4alermociydomtraies;(0setmxrpiodlltn fcs ( a2rr(mpnu1tle moeiltfmDranmo ()altrio3ia1fp   n ilt0t2trxrpiodamt lnvsat a2rru ont0ole moeiltla2elu p t4trxrmr iadlpt auvi;(0 2xm(r3nodameelivi (fs2rmu  oo4tltoii3ildfmDrl( p;t4aeeomr to1lm elu s (0srxrxm3oy4ll  mieil(f 2um(mpoo0aleniocildls2um(ms;(4aexoxr3ia1fa e neols trxm(r3iu1omt mfetatf rrm(mp;t0tlen f3tadla2rau p;u4 rxrif tadfaDrlneo;s0 rtm(r3oo4aptnmneiat s2rru o;u4aleomociyt a2umn pnu4tlxoxrciydopte uvi;s t2ur(opio4openmictlt srumumono4ape  octld a2ulnms t)alerirciytlpDeluvilt  rurirpiudll elnvt t sDraxr ;t0altnif3iys mDranmpnu) eeomf tatoatrln o;(0 eur(rpio1apen ivs (f 2urx oou0tpe  oeiaslmDrmu o;t4 exnif3iytoaDrlneil(0s2uoio3no4ome  fviatfsDrrxrpnu1tet  i3ilsfs2ulnmo (0 lenxfcto1optrlivo t)t2trimpoy4ap  lics s)a2uaumont4olt  feiydfsDumnmp;(4 lxnmr3tytfateaueol(0 rxo(r iu1lltnmiesas  rtax o;t1tlt moctlsla elnvsnu0 rermr3iodom   n i;s  2xrxr3iu4ap nmieta(fsrumu  ;t4apxo ietlslaDelu s (0arerxfctytlmt li sls t2xriopio4ll  miei tfa2um(m ot1ole io3tlt mDea(ms;u0trenir3to1laD an ilt0 rumxrpiu1ll nlncslt aDrrxmp;t4teeo oetltfsDul( p t4alxomocoatlaD lneilt0 rtoxm3nu4lm  lfet ()a2urxrpno4alen oetldlsDelu ont4altoxf3iadfmDr uvilt s2urir nu4alen fvtatfsDra(  ot1opeo iciltfs2elnvon(0arxoxf3io1omD lueols) eto(o3oydam nmivtlsfsrraxr ou0ale ii3iydla2rm(msn() exnio iotom   i i;( s2xm(m iy1amee fes ()srurumono4tpto octltfm2rmnvs;t4alerif3oy1oat livi (0 2um(rpou4amtemneslt  rrmu ono1texo o3iydls2rmn o;(0 lerir3ootoatelnesls0sexmio3ny4al  lnei ()s2uaur ;u0tetnmoeilslm emn p u)trxrio iodlaD  iei s)s2tmxo iudom  livs tf Dta( pou1teto iciatlaDum(vp () leomr oodoptr nei t)s2tmiopiy4al emicias) Dtmxroou4olen i3ilsfa2ul(vpnu4texrmf oadoa  lnvsl(0 exo(rpou4aptemfvs s)srtaum ;u4aexniieiydlaDua(ms;u)areoiocta1laDe neo (0 eumxmpnudaltnmfvtat aDrmxrp;t4aex  oetad sDran p;u) ltnif oydlmt lnes ( teurir ou4ll emnvsltfs2tmur ;u4opt iietatfaDea(ms;(0aetrxr oytomtrli il( setrxrpiu4olenlnvilt  rtau pnt1tpe  fciasfsDrl(mo;u) ltomociydlate n il( teuoxrpoodamt lfetl(f rtrxr no4tetnifeiydlm2rlnvsnt4 eerxfcoytfpDr ueo s teur(mpnu1ame mfcs t  Dtrur ot1tex ifctas m elnmo;u)altnmoctodlm eluvs t0teuo(m oodlpee ici sfs2taump;t4opeoii3ild m2elnvp;(4aexnmoctatla   n o;t)s2tm(r3oo1lltnmfvi (fsrrrur ou4aeenmiciltlm rauvs;(0trtnxocootfpD an i;s0t2urxm oudop  lfetatfa2taxrp;t4altoio3iydla2umnvsnt4aleoxo ty1laDelieols0trxrxm3nu4lmenmnvs ()a2rax oou4olxnii3ildfa ea(vs (4areomo3oodfp   iei (0srxmio iy4omeemfcslt)arta(rp;u4optnmociytla rlums;u0alerif3iydfmDe u o;t0s2uo(opiy1olt mfvsl( a2uru poo1olt ii3tatlaDranvont) etrif oa1opDranvi t  exo(mpoy1amte nes sfsDtru  ;t1alt mfcildfs2uanvs (4teeoir oa1om  lnesls0s2xmxo oo4lp emicsat  rtmxm nt1tle mfetadls2rlu o;u4tltrmrctodoat anes ( sexmxm3nu1al  mfvi t aDua( oou1aetoifeiadfs uaumsn()altrmrciytoaD ai o;(0t2toio nodomt  nvia(faDur(m ot4ole  f3tldfa rauvp;t0tlxoifcio1om eauvsls0srtoxm io4omenlnesa(  rtru oot0tpxnifeildlsDrlu pn(4 rxoxf3io1lat  neo t0srxmir iodal nmictat)arur(rp;o0ale mieiltfsDul(vo t0arerio3oo1lp   n s t  rurxo3oo4omenmneiasf rrax ono1tpeomf3tld m2uanms;() reomfctydoaDelivil()setriopoo4lmt lfei t) 2rmxrpnt4aeeo ociad a2emnmpn()tetrxfciytfmtranesls  rum(r3oo1optn fesa( aDrm(ro;o1oeenif3iat sDea(vpnu0trtrmf oy1fpteaivo;t0 rxrirpiu4lptemnei t)a2tmxr ;t0teeo o3iad s2eauvo;t0 ltoif3ootlpte n o;s0sexrxr3ou4lltnliesa(faDur( o;o0tptn fetyt a eauvo ()alxrmociatfm  lnvilt s2uoxr3iodomt lfvtatfaDraum oo0oltniietlt s raump t0 eermr3iatoa   nes s0 2umxm3oo4alee ivsasf 2tmur nt4oexniieiysfm2emnmo;t0tltoif tatlmD an o ( s2uoir iy1lmen fvsa()s2rr(mp;t1tlxomfciat m eaump;u4 reomrctatoaDe i o ( trur(opnudll n nvtl(f rurum nt0tpeomo3ils aDumuvp;u0 lxnio ty1faD lneil(  rxrxmpio1ole mics tf 2ta(monu1alto fctldfa ran p () rxomf3iodfmD an olt  eurxo iu1lleelfei sfsruaxmo;u1opx  fetytfa2ranvo (4trtrio iodomDrlivi;t)s2toim3nu4altelictlt s2ua( oot1aetnmocildfaDran s;u4alenxr3iydomt livolt  etrir3nu1apte ics sf 2rmumoou4ope  iciatla uanvont4alenio3ta1oaDeaieo;(0 rtr(r ou4op  mnct s sDtaurpoo4alenmi3iytfsDum( o;(4altrmf iadlatrlivi;s  rtoxopiu4lmtnlivt s)aDumxrpnt0oexoiieiasfsDum( p;u0 ltoxf3oytlm e nes;(  exm(opiydopee ict t) 2tr(mo;t1opt ioetld a rm( p;u0 eeomo3iatlate nesls0 rtmxopiodam emiesat)sDumxr ou0olxnmoctad m rlnmo u)altoif3oo1fp rai o s0 eumxopiydaleemivil()aDta( p;u0aetn icils s rlnmont4 rxomr tydlmDr ieo s s2uoio3iudlmte iciasfaDrr(  ot1apenmieiatls umuvs t4 rxoir3iadlp e i s s0 rto(opiy4ale  ncils)s2uaxro;o1oexo iciad a em(mo;() lerxf3tatfaDelnes;s0 euoxmpiy1llte iesa(fs2urxmo;o1opx ifctasls2emuvs t)artnmf oadomDrlu i;t)trtrirpoo4ll elneiasfs2rmx oot1texniiciltfsDuanmo;(4 ltnifcoydlpD lueol()trxoxmpoydlpenmivsa(f 2taump;o1olxn fciadfmDrl(vo;(0aexoxf3oy1laD anesl() ruoxm io1optelnct tfs2umuro;u1opxniictydla2emuvpnt)alermf3ty1lm  lnes;s)srxrxopio1amt  ict () 2ur(r ou0oee  fcildfs2eanmsn()tleomrcoa1oaD  u ol( texm(o io1apenmfvsa() 2tmum oo0aleoiicildlsDranvo u0alxrmr oa1lpte iei t)t2uriopoydoltnlfcsl( srra( onu1ale  i3tadls2em(vo;u0 ltomocoatoaDranvs ()s2xoimpio1lp   iet s)a2rr(moou1oexnmoeiyd s2el(mo (4trerxr3io1fm ranesl( seumxopno4lmee ivias)aDtaurp;o0oee  ieild sDel(vonu)arxrxr io1fmD aiesls0trur(r no1omtnmfvils)arrax oot4oexo f3tyd a2umnmp;()tltoxfctadfatran i ()s2xriopio1op  mnvi t)aDraxrpoo1olt  ietld sDuanms;u) etomfcoy1omDr u s t) rxoirpny1al n fctas)sDuru  nt4olt  oeias sDumnvon() ltnio oatlmD  u s s0teur(m nodlpeemics ( srtmump;o4apeo i3iytlaDea(vs u0tleoxocoy1faDe ivi;(0 ruoxm3iy1lm nmieil(fsDua(rpou4tet  iciyd a emuvo;t)altrmf iotlpD ln o s s2uo(m oo1lpe lfcsatfsrtm(  ;t1tle  feiad aDemnvo (0aexnir oy1lpDelies (0 rtmxo iu1ape lnet s aDurx ooo0opt iieiydfa rm(mo u4 exrxr3oodop rlnesls0 rurxo oo1op emfesl()srrr(rp;o1optnmf3taslmDran p t) eenmo3iytla rlies ()srxoio3nodlpt  ncils arrm(mont1oeeo f3iyt sDum( s;() rtoircoadfat  u o s  rtoxr nu4alt lfvsasfsDurxm ;u1tltnifetadfsDrl(vs;u4 reoxocia1fpD  uvs s) eur(m3no1lmtnmivsasfsrtrxm ;o4oltn ieilsfsDuanvpnt4 rtrif3totfpt  nes s0sexr(o nydap elfes s s2urxr nu0aee  o3ildfa2ua(mp t4areoir3to1oa eli i ( s2tmim iy1om  lnesa(  Dtm( ont0oexnmociad s2rmnvonu4 lxrif iatlm  an s;(0t2xriopoodome  fei s) Dumurp;o4teenif3ilslsDumn p (0tltrmo3tatfp rli i ()t2xoir3iu4omtn ietas  ruaxmpnu1oeeoio3iysls2rmnvo;t0trtoxo3iatfatran i;t t2urxmpio1lmeemieils srtrum nu4tetoif3ild s2emnmont4tlxomrcoodfp  aneol()s2um(r oo1op n ieiasfaDtmurp;o0ope mf3taslm ran sn(0 reoxo3totomDeanei;t srxoxo3iodllenlnvia(f rrm(mo;o1tpeoii3tys sDra(mpnu0 rtoif3tadomtranes t0trtmim3nu1omenlnct t sDumxmonu1ope mfcild a rl( s;t) etnxr3io1fp rlueo t  exm(m iy4lm n netl(f Drrxmono1oleoiietysfm2emumsn(0teerir3to1fpDrln slt)t2uoim oy4lp elnesl(f Dtrxr nu4tlxnmictltfsDra(vp u)trerio3ia1fa   uei;t0s2uo(m3oy4apte nviat a2ururoot1tlxn ieild s umnvs t)arermf oy1omDranvs;(0srur(r3nu4oltemnvslsfarrauro;u1oeenmfetltfs2uaumpnt0 lermf3oytopte ieo t  rxm(r3iy1am n fetasf 2urxronu1olt  oeils s2rlnmsnu4aexomrcoytfaDe iesl(  rxrxo3oo4op nlncilsfsDtru pnu0openmieilslmDel( snt0aetomf3io1op  lies;(0trxo(m3ny4ol nlivs ()srrmurpnu0optomfetat mDrm( on(0aeerxfcoy1lp  liesl(0 2xo(m3oy1aptemiei s)aDuaxrp;u1ale mi3ildfs2eanmp u0aetoxociytoptr i il(0srumxopnu4opte fci s sDrmurp;t0olxn ieils s ulums t0tltnxocta1latelnvils)srxrxr3nodlmt  ivs (farum(mpnu1aex ifetldfsDel(mp;u)texnmocoodlpDeaneols)trtmxmpiu1ale mnci t  Dra(mo;o1apx  ictydla2rmnms u4teerif oodfp e i o;s setm(r oy4am nlietlt sDuau oot4alenii3iyt s2el(mon(0tlxnir tadlmt  ieo;s sexmxmpoo4apte ietat)artr(moot4opxn fciatfa rlu s () etnxrciotfmteaivs s)setrim3no1optn ieils) Durumpou0tptniieias m2rm(vpnu4tltrxf oytlmDr n s;t0t2to(opnu4lp nlncs t  2taxr nu1aexoiocilslm2el(ms (4texnxo3iytlmDeaivilt) eto(r3oodlpenmieilt) 2raxront4alt ifeiat m2ra(msnu0alermfctotoatr ueol(0 eurxrpoydoltnlncia( a2ua( o;t1tpt io3iatfm rln snt)trxrio io1lmDeanvi s0srxr(o io1lpte fct ()a2um(  nt4olxn f3iyt s2eauvs;(0aetrif3oydfm eai slt)teur(m3iy4amt  iei t)a2tmu p;u1tltomictysfaDrlnmo;t) lxrif tatoaDrlnvi;s  eurir oo1ap nlnesas srra(ro;o1opx mo3iatlm uauvo u4areomr3ootfpDeaivils trtm(opno1amen ieils  2rm( o;u4oexomf3iytfa2raumpnt0trenir3io1fmteluvi;(  rxrimpou1omt mfvs tfsruaxrpno1optoii3iatfaDranvp t0treoif to1fm eanei;t)srxo(rpno1lmenlfvt t)a2raurpno1ape  i3tld a2el( p t0 reomo to1fpDeanvs t) rxm(m iodllenlnctltf 2taxmp;t0open oetydlsDrmn s;u4arxoiociodoaDelieo;t t2xmxr3iu1apt lfeia()sDrrxmp;t4olxn i3iyd m eluvp u0artoircoadfm ean s;s)s2xmxo ny1olenlieslt s2ra(r ;u1aex  fctatfmDeluvs (4artrif io1omt  uei;t0trxoxo3iy4ope  nvsat)aDtmu pno4apx ifetys s2ra(vo t4trenxrcia1omDr ueilt trxr(r3iu1omeemfvia()a2ta(m ;t1open o3iad mDel(vs u) exnmf3iodomDeaneols0trto(o3ou1lptnmnet (fsDuaur no4oleo o3ildlaDel(vo;u4 renir3oy1oa  aneo t)tetrxr3oy4omt lnvia( aruau  ;o0tpeoioeiltfs ran s;t4trxoif oytlat auvs;( trtrio nu1oleemfetls) 2tmx  nt1aeenmieiysfa uau sn(4trxoxf3iadfa rluvs;( trurxmpiu4amte ivsatf Draumoou1oeen f3ils m ulumsnt0 rermr tadop eaieo;(  exmirpoudlm emieil( aDumu pnu4aex miciatls2rl(vo u0aetrxr3iadlat anei;s)seumxmpnudom emies t aDrrx p;o4tetnmieiasfa2rmuvpn()tlenmfctydlmDrau s t s2urir iodlm emfvtlsf 2ra( o;t4oex  fctydfa eau sn(0 eeoxr iodlmtr n o s0 exo(rpou4lm e nvsat s2ta( o;u0olx  feildfs rmn onu4 etomr iotfatr u s () eurxrpiy1lmtemiesa() 2ur(  nu1apto ictys m2ea(vonu0tlermo totfptrlnvolt0trxmiopiydam  lfei (  Dua( p;o1tee moeild sDeanvo;u4aleomf oodfptelueols  2um(opnudop   nvsas) rua(r nu0olx io3iad mDeau s;()trxoxo3tydfm raueo;(0 2tmiopoo4lp n nes (faDrru  ;t4aex mfeiytla eanmont)arermf iadlmteanvil() 2uoxr ny1optnlictl( aDtr( pou1texoiieild a2uau snu4 rtniociotop r nesl(  2uoir oo4ol elicsas) Dtmu  ;o0apxomoetadlaDranvp;(4 rxnmr io1lateai i t0s2urxo3oudam nmies sfaDrr(r ot0teto oeiltlsDemums t) leomrctadfmDraivi s s2toxmpio4ol e feta( a2rmu poo4oee ii3iltlmDem(vpnt)artrmr iatoa  aues;t0srxmxr3nodom e nvs t)arraur ;t4tltomfctad a raumont0altoxf3tydoa  lnes;s  rumir oudamtn ncslt)srtr(  oo4oee micildfa elnvon()tlxoxf tydlp  lueo;s0t2to(r3iudole  nvt s s2trxmoou1apx  fciysfa rmums t4aexnir3ootfaD li o;s0seurio nudlpt  fei ( srrmuro;u1open i3ildfmDem( o;t) etoxf iodfa  an i;t0srumirpny4ol nlneiasfa2uaxm ;o1optomociasla2ea( p ()alerxr3oodlat lues t0 etrxopno1lm emnci (fsrrrx pou0aetomiciad aDran p;u0aeerxocootoa ran i t0seuoio oudole lfvsas a2uaur nu1texn f3tys m2rmn pn(4 rxnxfcoadlptr nesl( t2urir oydamtnmfvi ()aDrr(monu4opeoioeias s2emnms;()arxnmr oytfpDe nvi;t  eumxr3oydlm elivsas)srumxmoou4aexn f3tydls2uaumsnt)texomr3iy1omt ai o;( tetmxm nydoltnmfeil( a2tmum ot1apxnii3tytfa2elnvo t4aeeoio oa1om rlnesl()texmxr3ou4ol  mnesat)a2tr(mono1oee  i3tltfs2elnmo (4texomr3todomDrauvo;s0srxr(mpno4aleemfetlt  Dumxrono0aex mieiatfm uln s u0 eeoxocia1fmDean s;( srxoxr iu1omee nvslt) 2tm( onu1tlenmoeiyt aDraumont0aetnmrciodlmteluvsl(0 ruoxr3iu1ap nmnctlsfsDur(r no1aexn fetadfmDumuvo u)treniociadopDeauvsls0 eumxo3oy4omee ictlt  Dtrx ont4alxnmiciyd sDeauvsn(0tlxomocoo1laDeauei s  ruoir nodal n neilsfaruau  nu0aet mi3tasfm2rmu o t0 leoxo oytfaDrlivs;s0 2toxm ou4ole mfetas  rtmxr oo0aleo fetld mDrmu s;t4aetrxf oodlmDrlivo t0 exoim io1olenliet tfsrur(mooo4tee  fcils aDrmnmsn(4aeenxrcty1oa elueols trumimpny1ap emieilt arraxm ot1tleoif3iyslm2rauvpn() rxrio3iy1oat lu slt  ruo(r nu1op  lfes t)aDumur no0oet ifcils aDrluvp () etomf3oo1la  lneo;t  exo(o ou1lmt miesa()srtau pnt0olxnmoetlsfmDrl(vo t4trerxociy1oa r u i;s)seuo(m3oodomte ivs ()s2um(rp;o4olxomf3iyd aDulu o;(4arxrmf3oatlm   n ol( teuoxr3nudlptn ncia(fsrururo;t0alxn feiasfa2uan o u4trxrirciy1lm  lu slt)t2urxr no4ale lnviasfsDtaumpot0oltn i3tltfmDemump t0 renifcoadom  livo;t0texoimpiydlm  lncslsfsrrm(rpoo4aetnioetad s2eau s t4aetrxr3tatfmte uvi;t t2uoxr3iydllen fci tfsDtr(  oo0oexn feiydfa ua(vo;()tlenxociytfmt  nvol(0t2tmxr oudol   nciasfartaumont1apxnmfeiatfmDel(vo t4trerioctotoa rlnvsl(0 rxo(r3no1amt mivtasfsDraxrp;o1aetomoeildla2ea(mp () eerxr3tydlaD luvol( s2to(m3iydole lfetl( srrmumono0opto ictatfa uanvo;u4 lxomf3oatopt  ivol(  2xmiopoo1optelivil( sruaumont4apt mfeiat a2raump;t)aexnir3oadoat auvs s trurio3ou4ol   fci s)sDum(rp;u4apen f3tatlsDem( s;u)alenmrcoodfa eai i ()s2uo(rpiu1al nlicsl()sDrr(rp;o0olxo iciys m ua( ont)tlxrmrcio1lpDe nei;(0 2trim ou1opeemnesa(f Dtmxmp;t0olxn i3iadls2rlnmo;u)tltomf3todfat lieols)trxrxr iu4lp n ncsas aDrmumpnt0tlxo i3tlt a eauvpn()altnif3iytfmD an s s0trtoio3nydlltelfct (  2trxrpot4olenifciydls2uau p u0 rxoiocia1lpDr u slt)t2um(r3oydam nlfeiasfsrrmurooo4tltomociltla2ea( pnt4tltnxo3oo1lp e nes;s0s2xoxm ny4amtnlncta(faDra(m nu1texoifeildls em(von(4trtnircto1late u s;s s2xm(rpoydol  licsas) rtaxmoou4openmfeiatls um( snt)aleoxr iy1lpD lueo () rtr(opiydaltemnctl(fs2rax p;u4tlx ifeilsfm um( p (0 lxrif3oadfaD anes;()s2xr(opiu4altnmfei t a2urx pot0opt io3tat s2el(vp (0artrif tatfpt lnvo t)trxr(m3io4lpenlncilt)aDrmu ono1tpxo iciat mDrau o;()arenmf3to1fm e n sl(0teuo(m io4om  liesl(faDrm(r ;u0texnmf3tatla2ra(mon(4 lermo tadopD auvs;() eumim3io1alt lictat  rum(rp;u0aexo iciyslm2ea(ms;()artrir3ty1op   n ols  2tmio iudapenmiet s  Dua(rpot1aptomfeiytfs eln o u0alenio3oo1la rlueil(0srxr(o3iu1alenlictat)a2rrxr no1olxnmf3ilt a2rl(vp;u)texnmo3oy1fa ran s t0 2xoxmpoydameelfeslt sDrrump;u4texo f3tat sDum( s u0 etomf3oytoa rliei;s0seuoiopny4ap  mnesl(f 2urumo;t0tex mi3ilt s raums;u0tlxnmr ty1opDr ivo;t)tetr(m3iudalee ies s)aDrmxm ;u4ale micias aDrmnvpn(4alxrirctotfat ln o;t t2xoxo3nu1om emfvil(fs2umxm nu4tlxn ieiltls2uanms (0 rxoir tatla eaieo t0t2tm(o iodlltn neslt  2tm(ro;t1tet mieiydlmDuau o u)trxnmr3io1latr u s;t0texm(r no1olen fvta( a2tr(r ;u1ale iieiyslm2ulnmo;(4teeoir totlat  ies;s  exm(o iydlleemiet t sDuaxrp;u1aeenmociasls eaums ()tlxoio3oodopD luei;t  rto(r ou4ol  lieslt sDrmuroou1oeeomiciytlsDeauvs u0trenxr3oytlpDeau s;(  2xo(r oydomtelictatfsrtaxrpnt1alenmf3ils a2ra( s u4 eenifcto1lmte ivs s)s2xoir io4lmt lfes ()aDraxmpot1aex mfctasfaDeanvo u0texrxrcoo1lmDeli il(0 2to(mpnu1aptnlncs ( aDumu ono0optnmfetasfa rlums;(0 eenxo iatop  luvi (0trtrim ny1lmee fvilsfsDrm(r ;o1oetnii3iydfs2umnmpnt4aeermr io1oa  anei t teuoirpio1opte iei ()aDrm(roou4opxoioetatfaDrm(vs;() ltrir iydlpteln o s)s2tmio ny4om nlfvi t) 2uaxr ;t0texomoeiatfs umu onu4areoifctytfpt  ies;t0 rxrimpnu4omt licta()srrmu o;o1apx mfciyd a rluvo (0aetrio3iy1opD aueols)s2urimpiu4ap elivtlt)s2uau  nu1tex  f3iatls rm( p;()treomf oadom  li i;(0 eto(o iudomt mivs ( s2ua(  ;u1aexnifeiyd s2emnvs;()arxoif io1fatr neo;s t2xmxrpiu4lp   fvsatfsrrmuro;u0aetn f3iasfm2ua(mp t)aetomf3io1fpt  iei s  2tmxm oydll elnvia( sDtrurp;u0tex mfeiasfs2rmumo;(4areomrciytla ran sls)trtoxrpou1ope  fci sf rrmum ou1aee mietld m ra( p t4 etrmf iydfpDr uvils)srum(opiy4op n nvt tf 2tm(mpoo4tltnmfciatls el( o t0 ltrmf3todla raues;()t2umimpiu1om emnetas)a2taurp;t0aex mictyt m2uau on(0 ltomr to1oa r uei t srtm(o oydope lfei s a2uru  oo4olenmfetltls rmumon(4 etnmfcoodlm rauvs s)t2toio io4ale  fet s  Dtaurpnu4tpxnifetltfs2rln p (0 lxrio iatomtelivo;()tetr(m ou1omte fcilt)a2rmu o;t0apen ietytfa2ua(mo (4aexnxf3iadfa r ues s trtmxm ny1amee nvilsf Dtaxro;t1tetnmfciydla rau o u)trxnir3totfmD lneo;t0sruoxr oy1ol  mncil()sDrmumpou1aet ioetysfa2ean s (0 lermo iydfptr nesl()t2trio3oudllte ivias)sDraumoot4ape ifeiytfm2emuvp () lxrxo3tydopDr ivi t0setoxr3ny1llenlnvi sfsrtm(r nt0opt ii3tld s ran o t4treomf io1fa rai slt) etriopou1lmte icsa(f Durx  ot4altnmietld a ra(vo;(0artnmo oo1fm e nvil(0trtm(mpio4altemnvilt)srumxr nu1aex  oeild mDul( s u0arermf3oodoa e ivs t)trxr(o3nudap nmiei tfsDuru poo0tle ioetatls2rlnvo () etnxf3ia1fmDelivo;(0s2ur(o nydomenmies t arrru  ot0aleniieiatla em(msnt0trxnir oatomD  ueo (0t2trirpoo1apt lfciltfa2rrx oou1tee  oeiad s2emnmo;()tlxnir3tytfmt aueo;( s2ur(m ny4ll e fcsltf 2umxmp;u1aex mfetys a2eaums;u4teeoir iytoa rauvils  rtoxrpoodaptemfcslsfaDuaxmont1tlt mo3tld mDra(vs t4teenxrctatlmte ies s trxmio3nu4lp e icslt aDur(  oo1teenmfciadls2em(ms;()texrxr oo1omteau s t0srtrxmpiy1al e fetl(f rrmx p;o1oet mfcildlm2ranvo;t4aexnif3oa1faDr ueslt tetr(m oydopt mivtlt)a2ua(monu0apx mfeiat s el( p ()alerxf3iydla raivi s)setoxmpio4alt liesa( artrxroou1tetnmieiadls um(msn() eenxo3oo1lpt aieols truoxr oo1omt lnes () Dtrurpnu0aeeo o3tadlm rl(vpnu4aeermf3oatom  an i t s2trxr3io1oleelfvsas)srrm(  ot1tlxn feiysls2emn ont) eerxf3tydlateln s t) rum(r no4lpte ivt (f Dtmu pno0tptnmo3tad sDel(vpnt0artoir oatfpDelu o;t)s2um(opou1lptnmfvsat srumxr no1tptnio3iltfmDulnmp ()teermr3oydfmtrln olt sruoxr3iydlmenlivias s2tm( p;t4oex miciydla rmnvpnu0teenxf3oatlp elies s0srxmxo iu1apt  fetlsf Dua(mont0tlxn ieiytlaDrmu s;u0 rxnmf3ta1fpt  ivs t srumxopno1olen feia( artm(ro;t1tpe  i3iytfs2emu o t) rerir oatfa eaieo (0sexoxo3oo4op emnes t a2trurp;o4oet iicilsfa rm( s;(4 lxomo3iydlptr ivo;()teuoxr oy4apee icsl(  2tau  nu4oee  o3iytfaDea(mon(0altrxo oo1lat aivol()srtoxopoo1alee iesl(  Dtmx p;t4olx mi3ildfmDea( o ()tlxnxrcia1om rlies;t  rtm(opiy4amt mncil()a2umxmo;u4oleo f3ilsfsDea( snu)aetrif3iy1lm e nvols trurir3oy1alt mnvsls)aDur(rp;t0tlt mietat m uau o;(0altoir iy1fp rluei;s0teum(r oo1ap   fvil(fsrumu  ;u0aee mictydls ranmp;t0tetoioctydoateaieo;( trtmxmpio1ll nlncias)artr(mp;o1opxnmfetytfsDulnmp;(0tltnxo iodfmDelu il() rxoxr iu1lm  mnetas aDta(ro;o0open iciyd a um(monu)tlenmocoydop  aieslt0 exmxo oydopte ncslsfaDuax p;o1olt  iciatfa uanvo;(4alxrxr iytfat auei;s0 rurimpio4ome mnct ( aDua(moou1oeeomoeilt sDrauvs t) eeoxo3oytopDelivsls) 2tmim3ny1amteliet s  Dumxr ;u1tpeo i3iatlm rauvp;() rtnmociadlmtean ol()trto(rpiu1lmtelnvt t)s2tmum ;t4aetnmietytfmDrmumsnu0aexomf tydlpt aivsls)trumxo3ny1aptnmict sfa2rm(  no4apxoifeiyslmDelnvsn(4artrif3iodlatrlu o s0 eurxr no4am emnct () Dur(rp;o0alt ifciasfmDuau o u4 rermo todfmD au sls trxmxm ou4lltelfet t) Drrx  nu4ale ifeilsfmDrauvs u0 lerxfcootfmt ai o s0 ruoxmpiodom  lfvslt sDtrxrp;t0alt  fctysfa rl(vpnu4 leomo3oatlpD au ols0 rxm(m ny4lle mncia()aDtm(  nu0aexoifciys a emnmonu4trtnmrcoa1om ran ilt) etoxrpiydlm  micia() rtrurpoo1alt iicilsla2ul(vsn(0tetnxfcoy1laD au s;s) rur(opiydol elfctatf Dra(rpot0tee iiciys aDra(vpn(0aeeoirctytfmtrln ils0 eumir oydomenmics t) rtmx o;u4alen f3iyt aDuln o;(0 ltoxfcoadfaD aieolt  rtoxo3oy1am  liesa(faDtmumoot4tlxomo3ias aDul(vo;u0 lerif iydfptelnei;s0t2umir3nodoleelfctat  2trxmo;t1oee ifeiydlaDrluvont4 lxrxf oatlpt aivi s) eumiopoudam n nvsa( artrx o;u1tlt mieiaslm ua(mo;t) eerxf3ta1op   neo;s0 rum(opoudome  fesls)a2tmumo;t4apxnio3tad aDra(vpnu0aexnmociydfp raueo t0trxoxr3oo1lpte ivtl(fa2tmumono1alxomo3iysla2rlu p;(4tlxoxr3iatop rai o t)sexoxr io4lpe  ncs tf 2ra(m oo1ape mf3iyslsDuln p (4 rtrxo3iotlm   ivo (0t2uoim iu1ol nlfvtasfs2urxrpou1aexn ieild s eauvp u4 lerir3oytoaDe u slt)sexmio iodal elfvs () 2trxrono0oltomo3ilslm emnms u)arxoxocoydopDrli s s)s2uoir iudlm nmfetltfs2uau p;u0oexn feiasfm2emums t)altomo3iytfaDeli s t)srtrimpio1lm   fvsl()srtaurp;u0ape  i3tad a2ul( o;(0aexnio3ia1laD  uesls0teto(o oy4lleemivsas)sruaxrpoo1tpxn oeiltfa rmumonu4aexnmf3tadfmtr i s ()setrxm3oy4amtn ncs ( sruauroot1oetnif3ilsfm ranvont)artniocta1latrau i t  exm(m ny1optn fetat)a2tmu o;u4opeo o3ilt a ulnvp u0trtomr3tydfaD aneo;s0 rxmxm3nydalt liesls) Drm(m ou4tet mi3tydls uanmpnu)texniociy1la  lneo t) etoim3oo4om  mivtls sDuaxm no0ape  ociad a uln o;t)tltnmrciotfmtrlueols s2ur(o3iydomeemivtl()a2urx  ot0olxn i3iys mDrln o;t)trtoir oo1om ean o t trxm(o ny4ole  net t)a2urumono0aee ifeild s um(vs t)trxrmo oo1omte neo;t truoim3ou1lpen fci t) 2uax  ;t4apenmfciys mDean snu)arenif3oa1omDrauvi t) rtrimpoydol e fcia()srtaxrp;u0apxniociysfa uln p u0 ltomrcio1op  aiesls0 2urxm3nydopt  fcsas)aDrrumont1tex mocild a2ua(mpn()artoircoo1opteluei ( srur(m ou1alt mfct s a2tau o;o0tlenmi3ild m2umumpnu)alenmf oytfmtran slt tetrim ny1apeelieslsfs2umu  nu0aetnmf3ilt m eanmsnt4alxoxf3oytfpDe ieslt)srtoxo3iy1lm n feils arurur ;t1aeeoifciysfaDuanmo;()trxnifctydomte i i s srtr(m3iydllt lfetatfsDra(moou0altnii3ilsla em( snu)tltrmo ia1fa  au o;t  rur(m no1oltn fei sf 2tmum nt1apenmoeilslaDulnmo;t)arxrmf3tytlp  auvo;s0srur(rpno1oltnmfci (fsruru  no1aee mfetyt a2emuvsnt4teeomrcoodfm  aneol(0s2xmimpnu1omtn ncias s2trxmo;o4tptnifetasfm2rlumpnt4aeeoif3tatlpt lnvs t)tetmirpiy4ap nmfvsa()sruaumooo4aeenmfcild m um( o;u0artrmoctatlp eli i;s0srtoxo3oo4ole  ivtl(fa2um(mont0oltnmociatfs ean o (0teeomr tatomte nvs t0texrir3nu1alte fvta(  2rr(root4tle iieiad m2ea( p;() rxoxf3oy1om  auvo ()trtrio io4ll emfei t sDtau  ou1oee ifeildfm2ea(vo u0 lxoir iy1faDr nvo t) 2uoxr3iydopenmfetat)srurxr oo1texo fciyt a2umnvp;(4aetrif to1fmD  uvs t  2tr(r ou4olee ivtlt aDraumonu1tpx  fctld mDelumont0 ltnxf ty1lp  lneils)sruoxm3nu4olt  fetlt)srrrxro;t4altn oeiad aDrm(mp;(4teerio3oydopDr n slt s2xo(o3nydomenlfvsas) 2tmxrpnu1olx mo3ias s2ea(vs (4aeenmo iotop r nes;t)srxoxmpiy1am elncsl(  Drax poo0tetoio3iys mDuanms t) rxrmf ta1laDeaivs t) 2tmxopou1ol   nctl() rumu p;u0aex mf3tadfa2rl( p;t4 etnif3oa1fp eluvi s0t2xrxo oodlmen iciatf ruru  no4opx mf3tldfa2uanmp u)texnmociatlmD livs () 2uoxrpiydlmeemivt sf 2rm( pnt4apeo ietls m2rau o u0trermr3oodlp rlieslt  2xm(r3ou1oltnlivt () 2rr(mont0opt  octat mDem(mpnu0aetnxo tadlpt  uesls) rto(opiydlptemieilsfsrrrurp;o0olx mf3iat aDul( snt0aetoxf3oadfpDrlnvslt trurim3ny4ope mivs ( sDumu  nt1opt mo3tas m2um(mp u4trenxf3oydfa   uvo t0seumxr oudlp elnciasf Dumumonu0oee mfetltfm elums () eenxr3oytfp  lu s;s  rur(opiydaptn ieslt)arururo;o0oeen fetysls rmu o;t4tetrxr iatfmDran o;s) eurio no1op e fvsa( srtr( ont4aptomiciaslsDelnvp;u)aeenmrctatfpDeliei t  2xmimpiydlme  ivtltfsrrm(mo;t4olenif3iatfa el( s u0aexomo3to1faDean s () rxm(o3no1am   nvt ( arrmxm nu1oex  fciadfa2eau p;u0 etrmrcoy1fpte ivs (0 rxoxr oo4al elicias arua( ono1opt mf3tltla rlnmo t4 renio iy1fpt anvslt trur(rpiy1omeemfet s)sDumuro;o4tlenmoetld a em( pn(4 eerir3to1faD lneol(0 2xmirpiu1lp  mivi sf 2um(m ;o1alxoiictasfm elnvs (4tlxomf ia1fmDeaues;s) 2umimpoydopeemivt t)arrmxmooo4tlt mfctasfa umums;t)tltoxo tytoateli ils texo(r oo4ape  feiasf rtm(  no0oltoif3iyt mDuau o;u0altrirciodfm  aieslt)srxm(opnodomtelfcil( arumuront1oet  fciytlsDrlnmont4 reniocty1faDr ieslt srxo(m3oo4al  micsat srtax ont4oetn iciyslaDelnvs u)arenio3oadlmtelivs;s)sruoirpio1lmenlnvilsfsrrm(rpot0apeo ietydfs ean p;u4teenmo3oydoa  ln i s0srum(r iudomte ivia( aDrmumoou4olxn oeiydfmDeaums u4areoir to1omtrln sl( t2xrxr3ny1ap n nvs (  2ua(m ;u1olenii3iytfsDrmuvp u0tltnxf tydlmt  uvi t)t2xoxopiy1lpt mivs s  2raxmpoo1tlxomfetys s rluvo;t4aetomf3oadla e ivol( seuo(r3nu4al  mfetas a2tauroou1olxn feiasfs rm(mo;t4aetomr3oydfmD  nvsl(0 etoxr ny4ole  ncsas)aDumxm nu4ale  octld aDel( pnt0aetnif3tadomt anvo s0 exmir oo4oltelietls  Drrxroou0olen o3iasfa ra(vp;t4 rtrifciatlp   u o s t2tr(o ny1lptelfctlt  Dumumpoo1tetoiocias s eluvo;u0teerir3tadlpD lnesls trurxo nodlmeelnvs s)sDrr(r ot4olxoifctltlm2rlu p t4aetrmo iy1la r ieol( sruoxo oodlleelicilt)s2umx p;t0ole iicildfa uaumon() ltomr tadlm eaieo;s0s2tm(mpiy4op  mfvs (farurxronu0tltnmfciysls2ranmpnu4aleomf iatfat  u s t0 etm(o3iu1apee nvilt)srumu  nt4oetoio3tasfa2ul(vs;u4 rtnif ta1laDe ueils) 2uoir no1lp  mivt s) rurxmo;o1teenmf3ias a rln s;u4alxrif iodfp r ies s)teum(r3no4olenmfvs ()a2trxr ot0texnmociyt m rm(vs;t4arxoio iydopt li slt) rtm(m3nu4am   fvta( srtax pot1oexnmi3ilslmDran s (0artrxrciytlaDrau o ()trxmxopio1olt mivsltf rrrump;u4tlxnmf3iad mDrlnvp u) exoxrctotlpD  u i s) 2toxo io1ol nlncs ()sDrax pou1tpt iocild m2umu o;u0aexrmoctytfp r i o;t) eur(o oo4lm n nvtl()a2rrumont0alxnmieiydlmDrm(ms;()arerir iodla  lueo t0t2tmxm3iy4omtn fvs (fa2ur(mpnt0apxomocils a umnvp ()tltnxf3oy1lp  ln s;t0 2trxrpiydlptn ncs sf Drm(mooo0oleoif3tldls umnvo;u) rtrxf3totoaDraies (0trxr(o3iy4om emncils sDururpno0oleo oeiltls2rmump t)teerxf3ty1la e ivs t teur(r3nodlpenlfvil()arraxm ;t0alx mf3tldfs2eaums;()arxrif3oy1la ran i;t0trxrio3iy4lpt lnesas) rumxr nu0olxn ociyt mDulnvs t)teenmfctytfmt  n o;( teumirpnu1open fctatf Dtm(rpoo1ole ii3iasfa2ea( ont)tetnir3iatomteai i;t0trxrxo oodalen neiat)a2uaxm ou0aexniiciat a ra(vo () eenif iatlmDr ivi;(0t2tm(m nodam  miesa()a2rrxr ;u4tptoiieildfsDra(vp u) rtrircoa1lmDeau o;t)trxoiopou4omeemnvsas)a2um(rp;u1tlt iietytfsDum(mp;(0texriociydlmD auvi () rtr(o3iydomtnlfvils) rumxroou1tpx mictltfmDelums;u0aexnmf tatomt lueo;(0teuoxmpiydomt livtat) Dtr( onu0alx mf3ils mDumnvpnt0trtnxr ia1laD livi;t)seurio nodam nlics s s2tmuronu4olx ifeiatfaDumump;(4 rxoir3iydfpD aues (  2umxr nu4amtnmicsas) Drm(m ;u4ape miciyt s el(mp (4trtnif3oytfmteanvs s)srtr(opno4lpeemfcias a2rr(m ;t4oex  f3ilsfs2rm( pnt4 eenmf tydfmtelieo ( texmiopno4opt  ics (  rrr(mpnu0apxomo3tasfs rmu on()texoxo todomt ln ilt) rtoxmpou1alee ieslsfsDta(mp;t1tet mociatla2rmnmpnu0trxnxocoatfmtr n s t0teurxr nodamenmfes (fsrrr( pnu0tltnmicilsfm2ean pnu4 eerif3oydfpDe uesls) 2tmio ny1aleelfeils  Dta(r ;o0apx iietadlaDra(msn()arxoir iadfmt li sl()sexr(o ny4lltnmicta()aDrm(mpou1altn f3ilslm eanvo u)tlxoxr3oa1oat  ies;s0sruo(m oy1altn fci t a2ra(mo;o4tpt moetlsls elnvs;()alxoifcta1fpt li o s)srto(m3nydop n nesas srrmur ot0oexo o3tyd a rau s;(4 rtniociotfmtrai i s0s2urim no1llt lnei (f Dtrurono1aeenmfciatfs2ea(ms;u0artniociydomtrauei t trxrxm nydolee nvsl(farta(rono1opt iieiyslm2ua(ms t4trermo3totomt  i s;(0 2xm(rpiy4oltnlfcilt)s2uaxmoot1aeeo i3iyd aDuln s t) rtnmr iotfpteau o;(0sexr(o ny1optelivs s arta(root0opt  fctyd s umn p;(4 etoxo3to1oa rlieil( trxoxrpio4al emnvia(f ruru pnu0teeniietls m rm(vo;u4 eeniocto1lp  an sl( srxmxr no1lme mfesa(faruau onu0apxo i3tlsla2eanmp ()aexnxf iydopt ln o s  2uoxo3io4optelfvils a2tm( p;o1tlenio3ildla rmnmp;t0 lxnmr3tydopDrai ol(0s2umxmpoy4ll nlfvt sf 2rau  no1tlx  f3ilsla ulu p u0 rxomocoytom rlu o s)s2xmiopiy4olte ieslsfs2uax p;u0oexnifctat m rl(vs;u4aeeomo iatfptran sl(0s2trimpoudlm emics ()srum(mpoo1tlen fctydlaDua(mo (4arxoxocta1lmDe ies t) 2xr(rpio1lpeelnctatfsrtm(r ;u0ope ii3iadla rm(vo;(0texomfcoytoaD liesls) etmir iy1lptnlfctl( sDrrumont0opeoio3iyslm2umnms (4 ltomo3iy1lmDr n o;t0 2umir io4apt lfes ( s2um(r ot4opx iieildfsDel( s (0artrircta1lm e n ilt0seum(opou4ll  lieils aDtr(  ot0tlx ioeiadfsDrmu p u0trtoircty1lmtelueslt)teuriopny1lpeemfvslt a2urxr nt1aetomo3iatfm2rmu s;u0trtrmoctodlp e ivsls) exm(m3nudap  livsltfarta(  oo0tltnifctadfaDrlnvont4artnxf ootfpteanei t0tetoxo3oodlp   icta() 2uaxmont4alx mfeilsfa2elu s (4altoxfctadom rau i;(0t2xm(o3iydop  mieta(faDum( p;t1opeomo3tls a eau pn(0trxnxo oo1fm  au s;t0tetrir iy1lmtnlnviasf rtaxr ot1olen i3ilsla2rm( p;t0trxnio3iotomt an s;s)trxr(o3oy1lmtnmncils) 2rau pnu4tee  ociltfmDra(msnu4tetrifcoodlp  lnvi ()sexoio3io1aptemfci tfsDur(rpno0aptomfciydfa2rauvp;(4alerif ia1lpte i o s  2xoir3oo1omen iet sfs2uru ono1tlenmiciysls ulumo;u) rtnxrciodom raues t0tetoiopoo4aptelfeia()sDta(m ;t1apx  f3tat m rmnmpnu4 lxnxr iotfa rlu ol( teurio3nydape mncs s s2rr(ro;u4alxo ietas s2rm(mont) rermr3iatlmt  i o;()sexrxo iy4ape mnct s  rrrx  ;u0aexn ocias s rlump;u4tetoio iy1fptr ivs;s0 etmim3io1llte fcs ()s2trxrpot1olxo oeiadfa uan o (0tetoxrcoodopteaueo;t)teuoim no4lpen nctl()srtrxrpnt0aex ii3ias a2ranmont) rxoif3to1fmDr ivo s) 2xm(r3ou1om  lics s srrmum ot4teto i3iasfm2uanvs u)tleomr3iatla eai o;()s2xm(o3oydlmtn nvtas) Draurpnt4oltomoeiasls2elnvo;t)tltrio3tadoatr nvs (0teuoxm3iydomenlietl(faDrmxmpoo1aetoioeiatfm2ulnms t)tetrircia1om eaneo t setoxo3oodlp e fvsl( a2tr(roou1tpeoioeiatlsDuan p;()trtoircoa1omt  nei;t t2uoio3iydolt mnvsl( aDrm(  ;t0altn fetadfsDrmumo (4teerxf3totlatrln s;t0s2tmirpiydomtemfci s sDrr( pnu4tptnmietyd m2eluvo;u4arxrmo tydop   u i;t0t2xo(opou4op nmietat  Drrxmo;u4olxomiciaslm2rluvp;t4alxniociydfpDr uvo;t0s2urio io4llenlnciat)sDraxrpoo4tleo oeiat sDea(vs u)alerxf oo1oatelies s0t2tmir oudaleelivs tfa2taumo;u0altomf3tas s2ranvont0teeoiocio1omDraivsls s2xmxo3oy4lpt  nctls  2umx o;u1teen feiaslm2el(mp;t4alerxfciy1fpDean i;s0trtriopoy1apeemfvi tf Drax o;t4aetoioetldfa2rmu s;(4artomrciodoaDeln s (0texoimpou4ameelieslsfartrum ;u4tlx  fcildfsDuan pnt4tlxomo oo1lpte nes;t0t2uoiopnu1openlivsas)s2rau  ou0olenmo3iadla ul(mp t)tlenmfcoodfmtr u ilt) ruo(mpiudal n fcils)sDta(m no4tpto o3iat aDul( p () rxnif tadfpDrlu ilt trxoxopnydalt lnvsa(faDrrumooo4olt mociadfm rm( s u0 rtrxr3iadoa e i s ( s2trxo3ny4lmt  ieia(f rtauroou0tpeoifcilsls2rlu s (4trtrmf oa1oatraueolt)teto(m ny1omt  ivs s)artmur ;o1oexn iciytfa2ranvs (0arxnir3iydomDr nesls trumim3no4lptn fciasf 2tmurpot4tetn feiat sDuln s () etnmf oodfaD auvsls)s2tmxo3iu1omt lncsas)artrx o;u4oexnmfetlsfa2rmu pnt0 reoxf3oatom eli sl(0 etrxr ou4lp e ncta(  Dta(mpoo1tlt io3tasfs uanvo t)trxnxf iatfa   ueo t setmxrpiu4llt mnesltfs2um(ronu0teen f3tlsfaDumnvs u4areoio3oytlaDrluvo;t0s2xm(m3oo4lp elfct sf rrau ooo1aexoio3ilsla2rlu p;t)tleoir3ootop r neo;s  2tmxr3nudlmtnlivslsf 2umxr ;u4olxnif3iasfmDrmumo;t)arxrmfctadlp raivi () etmxr no4ole  iesl( a2um(r ot4alxo f3ildlm2umums ()texrif oadopDean i;t)t2xrir nu1olenlfct s)artrxrooo1oexoifetld mDelnvsnt0artrir tydfmDelnvsl( s2xoim ou1ame  fvsls)a2umxrono0oeeomo3iadlmDum( o u4teeoxo oadfp  lueol(0srtr(o3oy1lmtn fcsl(  Dra(mooo0olt ifctas m um(vsnu4aexnioctadlpDelivo t)texoirpny4alee ncia()s2uau  nu0aet mo3iyd m2ua( o ()aetrmfcoodfm e nvslt  2xoxm ny4ap n ictasfs2rmxrooo4oex io3tadfmDraump ()trxrir3ty1laDelueils)t2xm(m3nu1lpte ieia() 2urx ooo1tpe if3iatfsDul( s u4arenio3oo1fm elu ols)sexm(rpiu4al n ies s srtrxr no0teeomo3tas a2ra(ms;t0aexrir oadlmteluvils0trto(m3oy1am  mict t) Duax pnt4ale  ociaslm2eauvs;()artoiociydfm e n o;s)srtoxm3oo1om   ieils a2uax  nt1tpxo o3iadla rluvp;(0 exnxf3ootlmt lnvi;s)t2tmim3oydaleelnes t)s2tm(  oo1oltn feiydfsDelnvp u0altoifcio1la rli sls sexr(rpnu4amtelici t s2ra(moou0ole mi3ilsfa2ea(vo u) rtrxr to1laDr ueslt sexoir ou4lme  neia(f 2ur(mpno4opxo oetasfm2rlu ont4teeomo3oydfpt  nvo s  2umirpio1aptnlnet tfa2raur ;u4alx iieiadlm em( s;(4texoif3oatfmDr uvilt)t2xoimpnydole miesa(  2ua(r nu4tpxnmfciyt sDel(vp;t4aeermocio1lpt lnes;s0teuoim iu1olenlnes t sDuaumono0olxoii3tatls ulnmo u0 etnmr oydfate nvs t  2tmxr iu4lme lfcs ( srua(r ou4teeoifeiytlmDrlu p;(0texnircoodfat  i s;t  eto(m3oudlltemicils aDrr( ont0tetn i3iat m eluvpn() rxoio3tytfmteaiei;s  2umxr3oodome lfvs sfaDurx pot0aexo icildfs emu s;u0teenmf iytlaDelueo t0 rtoxm3ou1oleelnes t  rrrumonu1alxnmieiysfa umnmsnu4alenmf ta1oa e uvs;t  eum(r iy4om n ivi ( arum( p;t1tlx  oeiyslaDuan sn(4tlxnif3to1lptelu ils) 2xmio3nydlpt  nvtl()srumxmono1opx mi3ilt s rm(ms;()aexnif3tytlatelnvi;t seumim3nudllee ictls) Dtaxmpot1oeeniietlslmDrmumo;(0altnmr oydla e ivo ()trxm(m3nudop  mnei (  rtrx  nu1apeomi3iysla uauvo t) lxrmfciodfpD  nvs;s)setmxo oudope  nesas a2tax  nt0aeeo o3tyd s2rm(vpn(0texniocootlatrauei;s) rtrxmpiydll n neia(  ruaum ;t4aexnifetadlmDuau s u4artomocoytlmt an s (0 rtoim oydaptemfcslsfaDraxmoot4opxomociaslm elnvo (0 exoir tadlp eanesls0 2umio ny1amenlnes (farrrurpoo4oexoio3iyd m2rl(ms u)artrmf iotfp   neo t0trum(o3oydalt lictl(  rumuroot4aex  i3tysfs rlnvo;u0 exoircta1lp rln s;s)sexmir iudaleelfes (f rtm( o;o4oexnmieiadfaDra(vo;u4aexrioctodom   nei;s) 2uoim nu4lp n icsl( aDraxrpnu0texnio3iysfs um(ms;()tlenxf3iodlpD  ivs;s)t2xr(o iy1lpe  iviasfsDtru  no0tet  ieiat a2em(mont)tlenmf3to1opDeaivo ( t2uoim oydale mfvia(fsrrax  ou4aex  f3iytlaDrln o (0 eenmrcoodom raueols trtrio nu4aptelnei (  rtmx poo1oee iictls m2ua(mon() eeoxr3oodlmDraneo s) 2xoimpny1lleemfvsl()arrrxrpnu4tlxn icilsfsDeanvp;()arermf3to1oatraueo (  2uoimpiodomtn fci t aDtru pou4apxnmfcild mDran p u0tltnxoctadlmt aivs s)s2xoim3no1al emfvsa() Dtaum oo4alt ifeiysfs2rauvsnt0 etrio3iadoa raueols)sruo(r oo4olt liviat)sDtaxr ;u0tpeoiietydlm elu o t4texnio oy1lmDeluvols0trtoxo3iudamen nviat s2rmurpou0opeo i3iyt a rauvp u0teenio ia1laDeaivo;s) rtmxr3nu1ole livslt  Dtr(  ot4olt  oetatfaDemumon()trtnxr3iotlpDe ivo s0 2uo(o iodamt  netlsf rrruro;o1oet if3iasla2umu o;t4arxnmf iatoa r i ils)trxmxr3no1opte ncs sfsruau ono1oetn iciytlm2rlnvs t4texnmr3iytfa e ues t0 2xrxo oydolt mivt s sDtrxrpnu4ole mociysfm2rlu s;u)tetrmf3tatom  li o;t  2umio3ny1aleemnvtat  2tm( o;o4oeeomoetydfs umnvon(4 lenif ia1fmDelivilt  etrxm3iudll nlfvsas) 2rm(mont4apxoio3tadfs ranvon(0 lxomr3oo1optrlu i s0truo(r iu4llenmicta(fs2tm( pot4oex mietytlaDrln snt4 reomociytfat livs s teuoxopny4olt lneias)srra(mont4tetnmf3ilsfaDeanmo t4tlerxociydla   neo;()texrxr3iy4optemies t)sDua(mpot4ole ii3tlt m2ranvont4tetrmociatfmteluvs s) 2urxopoo4op   ivs ( sDraur ;o4apxnmicils m eluvs ()arxoir iytfm   ueo ()srtrxopoy4amtelivsa() 2raxrpot0apeomfetat mDrm(mo u0 rtnir oatfp r neo s0 euoxr iy4om n fei () rtm(mpnt4oetoii3ilsfm2eaump;t)trxnxfciydlmtraivils)srtrirpoy4ll  licias aDuaxmp;u4oleniieias m2raumpnu4texnir oatopte u sl( teur(opoy4ll  lnetlt a2rm(moot0olt ii3tldls rm(mpnu)tleoxr3io1omDeli i t)srum(m3no4op emnctatfaDrrxmp;o4aex if3ildlmDumump;u4 rtrircootomD  uei;t) eto(rpoydolenmfeils arurumpno1opto f3tydlsDra(ms t0areoxf3tytfaDeai ol(0 rxrxm3ny4oltnlivt ()aDta(rp;t0tleoioeiydla eln s;t0treomr3iatoa raieo s truo(rpnodam nlnvi ( aDtr( oou0alt mf3tls m um( pnu) leoifcoytoa  aieils0 eur(o iydale  ict tf 2tm(m oo0tlt iieiasfs rlnvo;t)altrxr3ta1opD  nvo;s  rurir3iu1lpe mivsasfsrumxmo;o1texnifeiytls elumonu)arermf3oydop eanes ( srxmxm ou1opt lnctl()srrr(  oo1aet if3iys m uanmp u0 exomf3tatfmDe u s;(0 rxrxr3oo1ameelnvtltfs2ua( o;u4teto fetldlm2eaumon() lxnxr iadfp r i ol()s2uoiopoy4lpt lneia()srrrxmo;o0aetnmictld m ranvs (4teermo3iatlptrlu i t)trtrimpoy1ope lfvi s) rurxmo;u0ole mfetat a2rmuvp;t4artnmf3oadfaD  nesl( seuoimpio1lptnlictas)artr(m ou4aeeomfciytls2rmn o;t4aetnmr tadlat aueol(0texm(mpoo4alte iesls s2rmx o;o4openiieiysfaDra( p ()alxnxr3tydlm  aieol()sexmxr ou1ape mivi (f rrm(rpnu4tltoiictlt m2ra(vp u0 rtnmocty1oa rli i t) 2uoio3nu4lp nmfvias aDua(mono0tpxomfciasfs um( sn(4 rtomf3tytfptraueil() 2xr(rpiy4ol emneiatf Durx ono0aeto f3tldfm rluvon(4 lermfciytlm rli sl()t2umim ny4op nlnvil(f 2uru ooo0texoiietytla2elnmo;u) lxomo oydlpDeauei;t)t2toimpoo4lptemivtl( a2rmxmpno1olenifeils m2rl(msn(0arxnxo ootoa   n s;s  rum(r3ou4om nlnci t) Duaurp;u0tlxoifctlslmDean pnu0treoir totfa elneo;s trtoxo ou4op elivi sfsDumumont1ale mi3tlt a2umnvsnu0 rermo io1fa raueslt)srtrirpnu1amee icta( arum(mooo0oleo fciydfm eln sn(0aleoxf3iytop e uei t  exo(m3oy4omtnlnvt s)aruru pno4tlxn o3iydfs uan p;()trenxo3todfatr ivi;s)trtoirpoo1om   iet t)arua(ro;u4oltoiieiltfmDel(msn(4 exnio oytoate nvs;( sruoxo3oydlle lncsl()sruax oot4ale  ieildls2elu pn(4alerxf3oydomte u il(  2umxrpoodllte netlsf Dtmxrpno0tpxomfeilsfmDrmumonu4 etnxr3iydfpD  ivo;s seumxr3oo4om emnetltf 2taxmp;t4teenmoeiys a2rauvsnt4altomociotlm   ueo ( t2xoxr iu4am nmnct ( s2rrumpnt4tlx mictydlm ran sn()trxomfctadfpD  ies (0 exrxopiy1omtnmncsat  2taur nu0tet  f3taslmDeau o u4 rtrxr tadlpDeli o;t)srur(rpoodll elfeilt s2urur ;t1tex if3tlt s eln on(4 rxnxrcia1op r i s t)texmiopnydomtemncias)s2tmur oo1apxomoetasfa elnvsnt4 lenio3tatlp r nvi;( tetrio oy4lpt micsatf Dumumpoo4altn fcildls uan o;(4areomfcoy1lpte n o;s s2xo(r ny1optnmfeslt) rrau p;u4opeo oetltfm ul(mo u)teerxr3iodfmte uei;t)s2tmxr nydap   fcs t)a2rru  no1oexn oeiasfa2ea(vpnu0arxnmo iy1fmDelueslt texrim3oo4al n nvtl(farra( p;t1apx mf3tldfa2emuvon(4 rerirctydoaDe nes ( teuoxm3nudomeemfctls)s2tmx o;u0apxniieilsfaDeanmsnt) leoxo3totfaD  ues t  rto(r3nydol elfcs t aDtax o;t4aexnmociad a umn p;u)aexoxoctatopD  uvo ( s2tm(opnydapt mnvt s)sDtauroou4opt mieilsls2rl( pnt)trxrxr oatom  anvil()trtoxm ou4open fcsat  Dtrxrp;u1tlx if3ilsfm em(vont0 etoxf3iydom elnvi t texmxm oo4omee iei t) Drmx ont4aetnioctyd m rmnmo u4 etomo ia1fmt lieils  2uoim nu1om nlfcils)s2urxm ou0oexn ietasfm umnvp;(4areoxrctydfm r ivslt teuoio oudomt mivtat s2tm( ooo0tleoifeild aDrm(vp;t4alerxf iatlm rln s;s) etmirpnu4omt lfvtas  rurx  ot0opxoifcildlmDranvp () ltriocio1op eau ils)setm(o3iy1optnlnciltfs2urxro;t1tpeoioctyd m2ul(vs (4 ltoircto1la rlneo t) 2toio3oodomenlnei s s2trxrpnt4apeomociyd s ea( s;u0trenio tytlpt luvs s0truriopny1al emfvsl() rua(mo;u4tpxnmfeildfmDra(vs;(4 eermr todopteanvolt)sruoxr iodllenmivt s) 2tru pnt4aptn octatls ean p t4 ltrxr3iydoaDraues;s  2tmxmpoy4apenlfcslt)aDur(  oo0oeeomieildla2rmumonu0arxnmf totoaDrlivs;t)trxoxm3iodam nliviatfaDrr(  nu1tet moetatfs ulnmp (0 reomr3totla  lnvs;t) 2uoxr iy4om nmictl(fsDtaurono0aeeo ociyd s2rl( sn(0trxnxo3oy1lm  lieils  2urxm oo4om e ncsa()a2uaurp;u1teenif3tat sDelu o (0tetrmo tadlm eaivils0 eurir io4op nlivtlsfsrra( p;o4tptomf3iad a el( pnu)arerir3ia1la r ues t)t2uoiopnudale liesls)s2ur(mpnt0oet  i3tad a emnmo u4tlxnif iodopD livs s0teumxopoy1omtelict sfaDrm(ront4tptoifctatfmDumnmp u) rxnmfcio1omDe u s t  rxoimpou4lmeelicil(fsDum(  oo0oexnmictasla emumo t4texoio3tydopDelneils)srxm(r ou1lltn icias) rtrum ou4tleomi3ils aDelumo;(4aetrmr ia1optean s t srxrir nu4lpenlfci () 2tmuro;u4alto o3ildlsDumu o u4aeerxr iatlm   i i t0 2toxmpoy4ame  nciat  rtm( oou0tpe  ieild a ea(vp u0treomr3oatfp eauei s)s2tm(m oo1alen ics sf rta(r ou1texoioctytfs2ra(mp (0aeerif3tatop ran sl()t2uoxm iudom nmfcsltfs2umur ;o0open ietlsfa2ea(vo u0 lxrxr oatop   u o;s  exoiopno1om nmfvt s s2tm(mpoo1altoiietytls2umn o;t0trxrif3todopDrln i;s sexmxmpio1lpt  fei t a2uaxmpot4tlxomi3tlsls2rau onu0areoxr3ootomDelu s;s s2xmir3no4lm  lfvs ()sDumxr nt1tlt ioctat sDulu ont)arxoxrciy1la rlieils) rtoxm3iu4om elnetasf rtrumono1alt moetysfm ulnvp;t4 etrmr3oy1opDran i;s)trxoxo3nu4lltnlncsa() 2tax  nt0opt  oeiadls el(monu4 lenir oydlate neo;t) rxoir3no4aleemfci t)srrm(  ;u1ole ioetasls2ua( snu0altoxfctydfpteauesls seumim3no4omtnmfeia( sDrax ont0alenmociat mDum( o (4alxrxo3tytomtr nvi s t2xr(r3io1lmtemivtl( arrmx  nu1tee io3tydfs2ea(vo;() eeoifcoydlmtrlu i;() 2uo(o oy1llt  iviasfsDum(ro;o0opt if3tas m2eau snt4 rtnxf iotoaDran s;s  rtmxopnodaptemivtls) 2uaxr ;o0apx  f3tatlm rmumont)trerir iadfp rlnvo;t) 2trir3io4amenlnesls)srtmxmp;t1tpe mfciltfmDea(mp u0tetnmr tydlp r uvo;s tetr(opoudlltn nei sfa2rau p;t4texn f3tadlm ulu pn(0 rerirctadla  ln s;s sexrxr3ny1amt mfcslsf 2rr(m ;u0opeo ociasfa eanms (4artnir3tatfatraieslt)texoxo3nydamtn nesasf Dumxr ;t4texnmoctlt m2rmumon(0 ltnxf iatoa e i i;s srtoirpou1ale mieslsfsDtmxr nt4tpenmieias mDrl( o;u4texomf3iadoa  auvsls0tetr(o iy1ll e nesl()aDtmxrpot1apx ioetasfs2um(ms (0alxrxo3oy1opte i i;( teuo(m ny4apt mfcsls artru ooo0tetnifciatfm2emu pnt)alxoxr ta1fa rln il()srxrxopnydameemfvi s aDum( ono1aexnmiciadfmDemumpn(4treomfcootfm  au s;(0trumirpio1op  mfvsat) 2rm(mp;t1tetomfetld m eanmp;u4tlerif3iy1fpt lnei t texmxr3oydlmt  fetlt srtru  nt1alto feiaslmDeaump;t0aetnif totfmteauvi;s0s2tmim3nudlmen fcsls) ruau pnt0aeenmo3tysfa uan pnu0aexnxr3oo1lmtean il(0teurimpiy4lpt mncil()sruru oot1aetn oeiyt mDemump u)texoir3tatfateau o t)srtoxmpiu4opt  ncsl(  Dum(ront1apx mf3iys m2rmu snu)arxnmf iatop eaiei s srxrir iy4ol   ict s s2tm( pou0aptoioetyslm2rln s u0tlermrctodfp  auvs s0srxmxm nu4lmenmiei s  2trxmpou4tee mo3tldfaDumumsnu4 rtoxr3oo1fmt  uvs t trtrxrpnu4lm elfciatfa2urum nt1oee  f3ilsla2eanvont0tltomf tatfpteluvi t seuo(m iu1lmtelivt s aDtr(mp;o0tpenii3iasla2elums;(0 leoirciadfp  aieo;t  2xr(mpoy4omt  feiat)sDum(rono4alen ieiyt m2uanvo;t0 lerxf tydlmD aneolt0t2xoxr3nudomenlivslt) Draurono4apxnmfeias s2ean snu4 eeoxr ia1fmtrlnvsl( texo(r3oy1lme mfvs s aDurx p;t1tptnifctatlm2ranmsnt4aetrxf3ia1lmtrlu slt0t2tr(rpiu1al nlivias  2tmx  ;o0texomfeiadlaDeanmp;u)aexoxf todoa eaueil( t2xm(r3io4opeemivs ()aDurxrooo0oleo ieils a rmnmp t0tetrio3oodlpDelies;(  2xrxm oo1ameemncsl( a2ur(r nu4tpe  ieiydlmDrlnmp;u4aetomo tadfpte u o t  2xmxo nu1oltemiet s) rumxr ;t4opxnmictldfs2eanvo u4alxrxr3tytoptran i s0setm(o iydome mnvsas)srtr( pot1apx mietys aDua( s u)aexnmf3tydoa  anei t setrxr iodlmte fetls  Dtmump;u4oltnmo3tat m2emu p;t) etoxf oo1lpDe uvi;t0srumimpoodamt mictlsf rtm(mo;u4oleoifetls s2umuvo u0arxrmo3totfp eln olt0 2tm(r3iu4lp n fes s  2uax poo0tetnmociatlm2umu p;u4 rtrxociotlat  ivs;(0 exrxo3io1alt mnvtas arua(mp;t1apx  iciydfs um( p (0trxrmf tytomDrln s;(  exoxr3ny1amte neiltfsDtrx  ;o0altniieiydls2ranvp u)alxoxr oa1fa   i s;() exmxr3nu4apt lnci t arrrxronu0aetnio3iatls2ra( ont4aeeoxr3iydlmDr ues s0s2xoxrpiu1ome  icsl( arrmu oou4tpe mfetatfs2rl( sn()alenmrcoadfmteln i;( seuoio ny4aptnlfvs sf 2umumoot0oexo octysls uanmo u0 etnxo3todlat luei;(0 rtmim3ny4olenlnvsatf Drauronu0alx  iciytfs uan s u) rtrxociydlaD  nvi s0trur(m ny4al n nct ()aDrmurpou0tle mfeilsls rmnmpnu4trtnxo oo1oaD lueo;()texm(mpny4altnmnesasfaDtm(rpou1alxnmieiys sDrl(vs;u4artnmfciodomtraneo (  etrir ou4ll
\ No newline at end of file
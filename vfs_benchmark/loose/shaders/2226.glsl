@@ -0,0 +1 @@
+nvil( tetr(rpny4lpe lnesat)srrm(mp;u1opt  fciydfm2rmu p (0trxnxr oytomD lnvs t srumiopiu1optnmnvta()a2ur(mpnt0aptoiictydlm emnmonu)treoxr ootoaDranesls0 etrxo3nodlltn icilt)a2rmur ou4oeen iciysfsDeaump;(0tetrxrcoytoaD  uvs;s trtr(r3nu4amenmnvsat a2trxrpot1tpen i3iltlm rau o t) rxoif3iy1oaDeluvs t0s2trxr oy4omenmnvi t aDrax pnu4optoiiciad m2eauvo;t0 lxnmf3tydlmtrli i () rurimpnu4op n ivtltfsDrrxr ;o1optomf3tat s2ran p t)altoxocoydop r uvo s0t2uoir3nu1al nlfesatf 2uaxmp;o4texnmfctadfmDrlnvp;(0 ltomocoatlmt livols)srurimpou1ll   fcilt  Dtr(m nu0apx ioeild a2elnmp u4 lenxo3tadlaD  ieil()seum(rpnudalt  fvilt aDrrxr nu1aetoii3ias s emnvp t) rxnmrciydomDrau i;s)s2tmxopnu4llen ietlt)aDrax o;u4oex  icildfa2eluvont) lxrmrcta1fp e neols0sexmimpoy1am nmnctasf 2rrxrpou4oee micias a2ra(vp;u0 ltoxr3io1faDrlu s;()sexm(o iudapt mfcsls arua(rono1oleo ieiysfs2elnvsnu4 lenifciotfa r i o;t  rur(o ny1om  livtls)srraurono4olx  o3iasfs2rl(mp;t)artnmocta1omteln i;s t2trirpoy1ol e ncs ()a2rr(mooo0tlt iiciatfaDrln s;() lxnxf oydfaD livi;s)srxr(r oy4lme mfes t) Drr(  ot4oexnmicilt m elnmo;u0teenxr3ia1oat  u o t srto(mpou1oleemfvs (fsDumx  ou4tex mo3tadla2ea(vs t)artomfciydomt anvi s)tetrxm no4lmeelnvtlt aDrru p;t4oltoii3iasls rmu o;(4tlerxrctadlm r uvi (0sexo(r oo1optnlivtas) Duaxmpno1aetn ietyt mDua(vpnt0tetrir3tytomDe ivilt) rtriopnydole lnesls srraxrooo1alenmo3ild sDrmuvp t0tltoircia1opDeanvi s)srxrirpoy1lmee fct t)arraxrpno0olxo feilsfaDemu p ()altoirctatla elnvsls0texrxopou4optnmneilt)a2taumo;u1oex  iciyd a2umuvpnu0tetnmociatopDrln ils  euoxr3iu4opte nes tfsrrax o;t4ale  fctadfmDrmn snt0 rxoio3totlmDelieo;s tetr(m iy4lmtemfcsls)aDua(ront1tlx  ociysfm2rm(mpnt)texnmf3tadlaDrlu olt0texrim3oo4lp nliesa(f 2rmxr nu1tlt moeiyt a uan pnu4 eenxr3oo1laDe uvo;s0trur(opny1op  livslt)sDurxmpot0alx ii3iyd mDuluvp;(4artnxo oo1fp r nes s0s2umio3ou4ap  mnctl( s2rrx ooo4oexnmictatfs2ranvp;t0trtrmfcootlpD auvi t0 2xrxo3oudamt mfeta(fs2ra(rp;u4tpe  fctlsfa ranmpnu0trxnmoctodomDrliesl() etr(opno1lp  lnes sfaDtm(  nu1tlx miciltlaDel(mo u) lenifcia1opDrlieo s)t2xr(r oydapen ivt t a2rau o;u0aetomfciltfm2rau o t)arxnxf3oatomD au o;t t2tm(mpoy4aptemnvs t) rtm( o;t4apt iictat s2ul( o u4aetrifcoadopD lu olt t2trir oy1am elivsltfa2uaxm no0aptn oetls s emuvs t4 renxrciadoa eli i;s trxmimpnodll e ics s)aDrrumoot0tlxnifeias a2ulnvs;(0altnxocoydopDe ueslt  rtmxrpoudaptnlnvtlt) rumu oot1oexnmoeiadls elnvsnt)alxrif3io1faDrlueo;(0 2xrir oodlme mfes tfsrta(ro;u0open o3iasfmDrl(vsnu4tleoxo tydoaDraies;(0 2xo(m3oydam elfcsl() 2tmx ooo4aexo fctaslm umu o;t4tetoirciodlmDeai o;s sruo(opoy4lltn ncsa( a2ta(m ;u0tetomietydfmDrmuvpnt4 ltrmocoadoateli olt0setmio3iu1lmeelietat aDrr(ro;u4tpx ifeiysla2rlnvo (0texnir3to1lpDr nei;s)trxrio3oo4olenmieias sDumu p;t1openmoetysls2rl(vo t)texrxr3iydfa rln ols0sexmio3ny1optemivsat)s2rr(mont0tlxnmfeiatls2rm(vs;t4 reomrciy1lp   n slt0s2um(rpoodlm elfesa(fsDrau poo1oetoio3iytfs em(vs;(0tlxrif3oy1oaDrlneols s2toim ny4omee nes s)arrm(r nu4teeomfeild a2ra(mo () exrmo3tadoa rau i;() rtoim oo1lleemfeil()s2rmxmpno1aet ioctydls uan ont) exnmr3tytoaD livi (0 euoxrpnudopenmnviltfsrtmxr no4apen octltlm2rauvo;u)altnmo iy1lp  ln ils) etoir no4olen ieilt)aDrmu o;u1ole iieiatls2rmnvs;(4 lenxrctodomDelu i;t0 rurxo oy4alt  ies t srrrxmoot4tptniieiyt m2umnvs;()trtnif oadfmD lu il(  eumxm iydlmtnmfei sfsruaxmono4apxn ociydfa2emump t0 leoio tadla  auvi;s) ruoxo ou1omeelnvtas) 2urxrp;o4tlx mfctasfs em( p;u) rxoif iydlmtranvsl(0 2toim3oy1ameemfei sf Dtr(m nt4aeto o3iasfsDrauvo u)texomfctotfaDelies ( setoirpoo4lptemfet (f rtm(mp;u0apx mo3ildfs2emnms u0artrmf oytomteai ols)s2toir3nudap emics (fsrtmur nu1aeenio3iat m um(monu4areoxfcio1fat ai i;(  2xr(r no4lmt  fetas srum(mono0oee ifciatfs2rmu p;(0 ltrirciodfmteluvs t)s2xo(o oo4amtn feiat)aDta(mpoo1tetoioeias a2um(vs (4tlxrxo3oy1lp r ues;t0srtoxopoo1lp elnvi sfaDumumpot4ale mieils s elu p (4alerxociydomte iei;t)sexm(r iudame livt s)a2rrxrpno1tee mfciadfsDrl(vs;t0altnir iytlp rlu o;()s2uo(opiudlltnmivi tfsDumurpno1tpenifciadfs2rlnvo;t4arxoifcto1oa e uvi s)srxrxr3nudlltn netas)a2tau  no0oeenmfetls s2rmu p u0artrmr totlpDeluvi s  rurio3ou4aptelfviatfa2um(  ;u1oltnif3iysla rmnvsnt4treomf3totlaDrau s;t srxmir3oy4lptnmnctat)a2urxrpnu1optn ociltfaDeln s u)tetnxo to1fp eaieo;(0trtoir nu1lm nlnvs (f Drrurpno0tptoiictlsfm ua(vp;t0texomo3oy1fpDean s;s texoxo nudll elneils)a2ta(rono0ope mietyt s uanms;t) etnircto1fmD liesl(0setoxr3nudlm  livt s) Dtaxmpoo4tlen ietls mDelnvp;(4arxomr3tytopDe iei;s0srtoir nu4al  mieil()s2tru  oo4oee  ictyd aDuluvo u0tlxrmr3iy1fpD auei t0t2xrim3ny4olee netlt arurx pou1aptn oeiat m2rl(mo;u0altnxr3totomDr ueo;t) rxrio3ny1omtn iet ()arra( p;t4tptnioeiysfa2ul(ms u4 rxrio tadfp r uvil(0 2xoirpio4amen iviltfsrumxmpno4apto feiat a eaumsnu)alxnmo oydla eln o;() rtmir oo4lmt  ivtas a2ta(moou1tpeoio3ild s2rmuvs (0aexnxo oo1fpD auvol( s2toxopny4am n fes ( srumum nt0oee  fciyt a2ea(mo (0arxomo oydopDr nei;s)t2um(m3ou1ap nlivil(fa2rruro;u1teto fetlt sDrl(mp t)tetrxf iy1oatelieo t) rtmio3ou4lm  liei sfaDua(  no4oeto ieildlm2emn pn(0arxrif iatlate u o t)seuo(m3io1lmenlnviatfsrtax p;t4alxn fciytfmDuanmpnu4tltnio oydfp r ieo;()s2urim3nu1lm e nvslt aDrm(r ot4oetnmoeilt m em(vp (0aexrir3todom e ivil()srxrxr3oy4altn ieslt)a2raxr oo0oleo f3iytlmDrmumonu4 exrio ootfat aivols s2to(r3nydomee nes sfsrrmx o;o0olxoifciltfa2el(mo t0trxoxf iotfa   ivilt  rtrir oy4ol elneiat)arta(r ot1ale  oeiysfs2eaums;u4aetrir iotfa r i o;()sruoirpiy1op nmicilt)arrrxmo;t4apto feiytlm2eauvon(4 rtnifcoytop  luvo () rtoimpiydamee ietat)artr(rpnu0oltomf3tas sDeauvp;(4artnxo ia1oa rluvs;t s2xr(rpiydal nlies sfs2trxr ot0aetnmf3tadlsDrluvs;(4 rxnif3oa1omD ln s;() eumxr3oo4lle  ietls  Dtax  nu4tlen icilslm2rl( s;()artnirciy1la  lies s)s2trxr3oy4alenmfcsat  2um(moot4aex mietlsfa2eln p t4tlxnmr iydoaDe ieol()s2toir3io4omee fvtlsf 2uau o;u4tlxn oeiydfs rau snt)trxnmr3iytoa elnei;s0srtr(r iudlpte fcsl(f rumxmpot4opt  ocildla um(vpnt4alermo totoptr i i (0 2umxo3iy4llen fei s) 2uaxmont1tex  ictlt mDul(von(4tltnmr3ty1optranesls)t2tmio3oydalt  ncta( artm(m ot0aeeo ieiydlsDrmu s;()arxrxo3ia1oaD an s s0 exmir nudolenmfci tf rrau p;o4ale  oetadfs2uln pnu)arenxoctytlm r uvsls srtmim3iydop n ivilsfsDrrur no1tet moeiydls2ra( s;t4areoio3iytfa rluvi t0s2xrio iudapt  fcs () 2rr(rpnu0ope mieiytla2raump;u4trtrxrciytoa raivil( srtmim iudlmenmfeia()arra( p;u0oetomictytla2raumpn()trxnif3iy1omDr ieil()setrimpiodom n icsas a2raurooo4oetomietlsfmDrlu o;u) lermfcootlpte i i s)seumxo oy4lm n net s)a2uax oot0tex mi3iytfm2rmu p (4arenioctadoptelnvi ()srtr(o3nodlle  ncsl( sDra(mpou1tleoiicils s2emnmon(0trxnio ta1oa  lnvs;( setoirpoy1lltemnet s)aruaumooo4tee moctasfm2ulumsn(4treomo3todfaD  nvs s s2tmio3iodomenmnvsl()srrm(rpou0tpeo ieiatlm eanvo t)treoxo3oytlpDe u i s texoiopnydllt lfvs tf rtrum ;u4olxnmf3tatfmDelu on() etomf oa1fa  lu i;t0sexriopoydapenmivtlsf 2trx oou0tetn fciltla ul( o (0tlenxrctytfa eaivi t) etr(r3io1llenlivs s artaum ot1opxoifcildls2ranvs;t4 ltoxr3ootoa elneo t)trxm(o iy4ol elivsl()srtmxr oo0aptnmi3iatlaDumu s;u0aexoioctydoaD  ivo;s0sexmim3ou4al nmivs sf Dta(  nt1tptoiieildfa2emn o;(4aexrio3ta1oa   ies s0trtmio3oodlmenmnet (fs2rau p;u1oeeomociadfaDumnvs;t0aetnmfciytlm rai i s texrxo3ou4omen icta( arurumpoo4ope mfciad sDrmumo u0 etnio iadlpD  ivi (0setm(o3io1lp  mnvsltf 2rmxm nu0tex mo3iysls ua(ms;t4aexnmr3oatlaDeaivs;t) ruoxo nodaptelictls) 2rm(  no4apt mf3iadls2uanmonu4tlxrio oo1lpD  n s t trxoimpiu4optn ieilsfsDraxmo;u4ole ifetas mDemu o (4arxomo to1opD liesl( t2uoir3nodlpt lfvi tfsrra( ono4aee iocilsfm2rlnmsnu4 rxnxo totfm  ln o s) eum(mpoydom emfct ( aDraur no4aee mictldlmDumn pn(4 rtrmocio1lmDelieo t t2um(o io1apt lnct s)srrr( ooo0opxomf3iltfa2eluvsnu0aetoio iy1fat  i slt) ruo(m nu1aptnmnet t)aDumurono0tleomictysla elnmont0tleoif iodlmtr u ils0tetoim nu1lpeelieslt)srua( pnt1tex iieiysfm2ulnvsnu0aexrmf3oo1oa ean o t) rxr(o3nu1lpe  nvt s)a2ra(m nu4tltoii3iyslaDea(mp u)alxrxo3iotlmtelneslt0 2toim nudlmtnmiesat a2uau ono4tetn i3iytfsDeanvs (0trxoifciatoaDeln ils srumirpiy4amt lfvsasfaruaur no0texomfetydfs raumpnu0alerifctatoaDrlueol(0 ruoimpiu1lm   nesls)srra(m nt1tltnmf3iyt m rauvont4trermfcta1lp eanvil()seumxr3ny1lmtnmfeiatfaDrm(rpou0tleoifeildls rln p;()aexnirciytfaD  ueol()s2umxo io4ol emfeiat  Durxro;o4tetomocils s uaums;t)arxoif oatopDraues s0 2uoimpiudopt mfcsl(fsrta(r oo1tpxomo3iat mDra( s (0 lxnmrcoydom rauvo;t) rtrxopnudameelivi t  rrmuro;t4aeenio3ild s rau p t4trenmfciy1fpteluei;s)texrimpio1omtn fct t  2urxmpou0tpto o3tyt sDul(msnu)artoxo tydopDrlieil() etmirpoy1lpe  nvi t aDtm(  oo4olx  i3ildlm ra(vp u0arxoxf3oadomDeau sl()t2xoir iy4olen nvtat)s2tm(mo;o0ope mfcilt mDeauvp (4 lxnxo3ta1lmD aieo;() rxrxr iy1ll elfvilt) rur(  ;u1tex if3ilt a2emumont4arermf3iadfm  au i s)s2urio iy4llenlivi t) Dur(ro;t0tltnio3iatlmDemnmsnu0 reomo tadopDrli ol(  exmim3no4apt mncias sDraxmpnt4altn fctat m umnmo;u4alxrmr3ty1oatrlnvs (0srurim3oo1lltelivsa() 2ururpnt4tltn o3iaslm2emumo;t0 exomociadfmte nvil( teumir ny1ol elivt s sDrmu oou1tlto ocildfaDemums u4 eerio ia1la  lu o (0 2uoxm iu1lp  licsl() rurx pou4oee  ietaslm uauvp;u4 exrmrctotlp r ivi;t0truoiopiy1amt  ivi t aDtr( ont0tlt  f3iydls uluvs;u0 rtnmrciatoaDe nes;t) eto(r3iu1olt  ivtl( s2uru p;u1tex mo3tyslmDumnvs t0tlxrifctydomDe neo;s0trxrxr ny4om nlieta(fsrurxrpno0opt mo3tldfsDean pn()tlxnmo3oodfat aiei;t)srxrirpnydameelfcs t a2um(root4oltnmociyt aDem(monu0areomr3iydfp   n o;(0 etoxopiydol emictatfaDtaxmo;t1opxnmoeils sDem( snu0aleomo3totfa r u i t0 rur(r3no4omen fcs (fs2urx  ;o0tee iictltlmDrmnmpn(0 exrxf3tytlpDe u i;t0trurxmpoy1oleelfviat) Dur( onu1tpeo oeias mDum(vont4texnir io1fm  li o t trtrxm oy1ameemfvta()srrm(mp;t1tpxnmociys mDuanvo;u0tlenirctotla eaues (0s2umxrpnudlltn neilsfsrumur ot4teto fcild aDem(vonu0artnxr3to1oatean il()tetrir iudlp n neta(  rurxm ;o0tpt moetytfm rauvs t)aeeoiociadopD luei s0s2urio ny1al elfvs t  Dumxroou4tlto fciydla2eaump u0teermf3todfaDrlneo s trtr(m oo4al elfesltfaDururp;o0opx mi3tyt s elnmsn(4arerxf3iydomt au i s0t2ur(opou1lmeelnetls) rurxronu0oee mfcils m2raump;t)aleoif3tydfpDrai o s0s2uo(opiu1opt mies t)srtax p;o0optniictldfsDua( s;t0alenxr iydlaDr ivsls t2xoim3nu1omenlnes t) Dta(rpot0optomictydfs2emuvon(4 lxoif3iy1laDrlnvs ( trtr(m3oo4apeelnvi t s2tr(moot1tet if3iydfa eaumpn()tltnmr tydfp  au s s0seurir3iu4amtn iesat) 2rmxrp;t0teen fciltla2el( on(0 etnifcoa1lpDelivi s) eto(r iodope lfei s)aDtrxm ;o0aleomf3iytfsDrm( s u) eenif3tytopDr ivils0s2xmiopiy4amee ivsat)s2urum nt4tpx  o3iytfsDuanmont4areoxf ia1lpDelivo;(0seurio io1lm nlneia( sDta( pnt0aet  fctat m um( p ()treoif tydfat  ueo t0t2toiopiudlpte neiasf rrm( ono0apt if3tat s2uanvs (0artnmocoydlatelieo;s0 2umir3iu4ol  lfctl(  Dtauro;t0tlto fcilt a2ul( ont4texoxr oydfaD lnvi;s t2urxmpnu1optnmnes (fsDrmx  ou1olxnioctatfa2ran s u0 ltoio3ia1omDrlu s s0trxmxr3nydlpen fei s)aDurur nt1optoif3tys mDuanmp ()areomf3oytop  aiesls  rtriopiy1lp nmictlt srtmxmp;o4aptnif3ild s2eau o (0aleoio iydom r ieils0teur(m no1oltnlfesa(fsDumx ono1tpxnmf3tydlm em(vp t4alermo3iotfpD anvols)t2xrio3iodop emivil(f rumxrpou1teeomietyslsDrl(mo;u0tltnmo tatomD au ilt0 etmxmpnudlleelfcta( s2ta(r oo0tee mieils sDulumont4aetnxrcoodfmtran ilt)sruoir nu4lmee net (  Duaur ot0tetomo3ilsfm2eau on() rtnxocoo1om rauvs;t)trtoxo oy1amt lfcilt)sDtru  oo0alt  i3ildfs2um( o;t4tetrifcio1faDeai i;t  euoir nodaleelnvsa(fsDurx  ou4aetnmoctydls2uanmonu4trxoxo iydoa e u s;(0srxr(m3nu1om   ivs tfaDtr(  ;u0tpeomi3iltlaDuan s u)texomo3ty1lmtrlneolt trumxrpnu1lmtnmnvs t s2tmuroou4teeoiociaslmDelnmsn(0 etnxf3oytla eln sl( s2xmxr no1apee nesat) rta(m no1ole ioetls mDrau on(4 reomr oodoat lnei s) rtrim3oo4ome livt sfaDra( pot1tetnif3iyslsDulnmo () reoirciy1oate n s;s t2urxm3iudlp   icsltfsrtrumo;t4aetomiciatfs ra(vo u4treomo iadlpD  ivsls)trxrirpiy1amt mnvilt aDtrxm no1oleomfeildlm rlnvs (0alenifctadlatrli ils0srxrir iy1alee ics t s2ra(mp;t1aleomfciytla ea(mp t0 etniocoatlp eauvi t  rurirpno1am   fvil() Dumx ooo1aetnmoctasfm um(vp u4 eeomf io1omtraieils0 2tm(mpoo4lm  mivsl(f Drrurp;t1aleoiociysls emnms;u4tetomo3iatlpDelivo ()seum(r3iy4lp  licsa(  2rmumono0tltoifciyd m rmnms;t)trtrir iytfptrlnes s trtr(o nu4ol emietltf Dtr(mont4apxomo3tasfmDranmo t0teenmf3oatopD aneo t) 2xoxo nudape lfvs s)a2ua(r ;o0oeeomo3iad m rm(vp t4texrxfciytfp rlnvolt0texmim3nydam e nvtat srtmuro;o0aee moetasla em(vo;u)trerircoydlpDr ueols0 2urir3oydoptemfvtl()arrru p;o0oeen i3iatfs uauvp;t0 rxnmo oodlmDraivo t  eumimpnodape lnviltfartaurpoo0teto feias a rl( s t4arxrmocoa1lp ranvo ( s2uoir3oy4ol nlfet t  Dumu pot0alt mi3ias aDua(vo;u4 exoxfcta1lm eaiesl()s2xoxo3nodop   fvia() Dtm(m nu0oetomi3iadlm2em(vont4tlxoxo oatfpDr uvilt setoir oydomtemnvsl(fs2rr(rp;o4tex ioctysls um( snt0 rtomocoodfaD an sl(  2tr(opio4lptnmncs () rtax o;u4olt ifciat aDuluvs u0altrmo oytlmD  ueils trurxopoy1lpeelncslt) Dumurpnt4tlxo o3iad s2eau onu0artnxfciatoptraues;( srtmxmpoo4ole lncsl(fsDraumooo4tlxnifetad s el(vs (0artnir oodlaDrluesl(0srtmim iy1al n ncsl(f rum(mpou0tlxnmiciadfs rmums;()aleomrcio1fm rli s;(0 2uoiopiudaltnmfvtlt artaum oo4alenmoetyd mDuan s ()aexoif3oodfa r neol(  exr(r3nodap n nciat)aDraxm ;o4aetoioeildls2ra(vs ()aetoxo totfpDeluvsls)trtoio3iudop nmfvias  Drru o;t1tetnmi3ilslmDra(vp u4aexrmr oa1op r i s s0 2uoxr iodom nlfei ()srtau  oo0tetn o3tlt a elumo u0alxrxf3iatomt  ieils tetr(r nu4apen nvs ( s2tmumpnt0alxo ieiadlaDua( p u4trenir oatla eaies t  rxmxm ou1omen nvil(fartrxmp;u1tlenioeiasfaDelums;() reoxociytomD  u s;(0 2xrio ou1apeeliesasfa2ua(mooo4opto fciad a ulnvp;() ltrifctadlm e n s;t)tetoiopou4omeemfeil( sDumu  ;u1optomfcils s2ua(mon(0aleomoctydfm eluvs s teumiopiydope lfvil(fa2um(m oo4tleoifciad a emnvsnt4alermf tadfatr ivs s0srto(m3iy1alenmfcs tf Drru onu0aexoioetls s2umnmon(0 lxomfcoadomD aieils)truoim iy1optnmfvta(  2rmu ooo1oltniieiydlm2ulnvsnu)trtoir3iotfatrlu i s srxmxm3oodalt  fes t) 2rmu  nu1apenii3tytla2elnvo;u0areoif3iytoaDe nvols)tetrio iu4ame mncsat  2ur(rpnu4opx  feiydfaDrlnmsnu0 rtoio3oadopD  nvi t0tetmxrpoodlptn fcsl(fa2rru o;u1altnio3iadlm2rl(vsnu4tlenioctatlaDrauvols seuoxr iudal n neias)srurump;u4aexn o3iys a elu p u4aeermfcootfa rli s;s0 etmim3no4omeelnctlt)aDrru onu0optoioctydfa eau onu4tltomo oo1la elieils0 eumim nodame lfvil()aDuauronu1aptn oetysfa2em(mon(4trtrmo3oytlmDe n sls0sexrim3oy4ll elnvslt) Dtrxmo;u1oleo i3tlt a2rauvonu4alenmf oy1fpt luesl()t2um(opoy4om nlivs tfsDrrxm ;o4oee  i3ilsfa rlu sn(0artoxr iytfp   nei ()t2tmxr iy1omte fei tfa2rmxmoou0teeo fciltfa rmuvp (0arenio tatfaD luvi;t) rxrio3ny4lleelfcsatfs2ta(r nu1oee iictlsls2uauvonu0aexnxo oo1om  aivo (0srxo(opnodame mnctls)sDua(m ot4tlxomo3ildfs uan o;()tlenmrciy1op rai olt0 eum(o3iy1lleemfeslt  rua(root0opeomociatlmDuan o;t)areomr tydfat aneol(  rtr(r3nu4altnlietl( a2tr( o;t4aexoifciyt a em( s u0 rtrif3tatlp ran i t trxm(m iudapt livsat) 2taumont1oeeo fciadls2umnms u4texnif3ty1opD  u o s)teuoxm3io1ll nlivsl(faDurxr ou4alt  o3iytfmDemu s;u0trerio iatlp elnes;t trxoim3nodlm nlnes ( srraurooo0aleo fetydfa2rl( p;()texrxr3oatfa eln o s t2xoim3ou4openmfcsasfs2trxront0oleomi3iydlm2rl(vsnt4 lxnxo3ta1latranvs;t) 2xrxopoy1op elfcsas a2tm( ooo4oleomf3tat m elu p t)altnxo3oatfateau sls  exmim oudom  mfcias)a2uau o;u4oexoioetyt aDeauvs t4arxnio iadlaDranvi (0 rxrxr ou1op emfcta()a2uaxm ;u1olx mieiydfm2el(vp;u4 lermf oatfpD li sl(0s2xm(o3nudoptnmieia()s2tr(moou0alxomfeiydfs2emuvo;t4altrmr3ia1la ean s s) rtr(opoy4ol  mfeta(  2umx ono1alxnmoeils mDulnmp t0aleoxr oa1optrauvs t) exoxm3nu4lltn ncsl(fs2raumooo1aeenmi3tys a2umu pn()tlxomrciotlpteaiesl(0s2tmir no1lmenlnesl( sDtrx o;t4apx mfeiys s2rl(vo;(4alenif oytlmD lies;s s2xoim3iudal emfei sf Duau pno4oex  feiltlm eaump;() eermociytfatrli i;(0 eur(m3iy1alee ivsat)aDumurono1oexomf3iad sDelnvo u0trxrif oa1opDrau slt0trtoxrpny1omeemiesat)a2urumo;o1oeto ietld m2ul(msnu)arxomf3ootomtrlnesls)t2tmir nydaltnmncsls) ruaxr ou0altoif3iaslm2ea( pn() ltoxrctotlmDelueol(0 exrim3oy4omtemivtlsfsDra(  ;o0texn oeiydlmDrlnvs;t0teenir to1lmD  u o t trumim nudam emnci s sDtaxr ;u1ale  feiltlaDra(vsn(4 rermociydfatelnvs ( teur(m3iy4lpt  nvsa(fs2rmu pou1teenioeiad mDuau s;t4tetoxf oadomteai i;s0trtmxo3nydlmen iet (fs2tm(r ot1tee  ieiyslm rlums u4texrmr3oatfpDr nei;s  2xmxmpnodolte nvi s)aDumx ont0olt mfeilsfm ea(von(4texrif oy1lm   uvsls  2umxrpno4amte netl(f rumur nt1ole  o3iyslmDrmuvont)aeerxo iydoat au o;(  2tmio3ou1openmnvsat) rumxmono0tlxnifctaslsDumnmpnu) reriocoy1fmt lues s0tetmiopnodlp n fctatfs2um(mo;u1tpeoiictlsls emu pn(0tlxomoctytlmt  neilt0 rxm(r nudlptn ieslsfs2urur nt4opeomicias m eanvs u4arxoxrciatomteau il( trxo(opio1lmen ici ()sDrru ooo0opx mfeiatfaDrmumont)arxrmocoytfp rau o (0 eum(r3oo1ap nlfcs ( sDtmx ont1tltomicildfm ulump u) eeoifcia1fptean i;s seur(mpou4lpt  icslsfs2rr( ono4texomoeildfaDua(mo;(0 ltomf3tadopDrau o s)s2umxm iydlpt liei s  Durx o;o1alx mocild mDrmnmp;t0tlxrxf3ta1fpt  iesl(0trtr(r nydlp  lfvils srraur no4tptniietadls2elnmo;(4altoifcto1opte uvilt0setmxm iy4oltelivsat)a2raxrpno4oltoiociatla2rlumont0 rtriocoytlm elu o;s0setmxr io4al emfvils)sruax o;o1tlxn ietysfmDemn pn() eenxrciodlp e ivo;s)sexm(rpio4lmte ictltf rurumooo4alto i3tad m2ua(vp;t0trenmfctydla  lneo;s0t2ur(r nu1lltnlieias)arrau  no0aeeoiocild m elnvp;() lenmf3io1lp e n s;()s2umxo3nu1aptelieslt)s2rrxm ot4oex iictyt aDem(mpn(4tleomf oydfatrauei;(0trumio oy4am nmnci s)s2uaxr no0tpxn icilt aDulnvo;t0trermr ty1optr neil() rur(m3nodalen ncs () Drrurp;u0oet iiciytla2eauvo;(0arerxr iytoatrlneslt) 2xrxr no1lmt  feil() Drm(r ;o4aex moeiatfsDra(vp;t)trtrio3oo1opt  ues;(  2xmim3oudaptn ies sf Dumxr ;o1oexn fetldlaDuln p;t0alenxocoadlmDrlneol( sexr(m io1ol  licilt)a2rr( pou0apxoifetytfa rl(vsn(0trtrir tydfa eauvs t) 2urio3oo4lpt  fvt tfa2rau oou4oex io3tysls em(vo ()trermo3oydopD auvol(  etr(m3oy4lptn nvilt arrrxmpot0texomi3iytlm emnvonu)tltnmo iadlp r i ils)t2tm(m nydap e ieiat  ruax p;u4open o3ildls2ulump t) eenmf3tatla rluvi t trtoimpiodolt lnctlt)arrr(r ;u4optn feiatlaDumnvo t0tltrmr io1lmtrlieol(0teuoim3no4aptn nvtlt sDrr(ronu1oee ii3iad s ul(mo u0 rerif oytlate n s ()trtoimpnydlptnmfcs t  Dum(mpoo1optomf3iysfs2ulnmo;t4 lxnxf iotlm   ues t) 2xmio3oo4ol e fvslt aDtaxmpno1aetnifeildls2em( p u) ltrio3oadlm eauvsl()t2xmxo oy4amenliesl( s2uaxmpnt4tetomociys m2emu s u0texomf iotlatr nvi s texoxr oodol elnet sfsrrmxrono4tetn ociadlm eanvpn() eeomr iy1oatrai sl(0trur(mpiydaltn fvsasfsrur(  ;u1teenmfciydlmDumn o;u0trtnxfciodoptelu sls sexrxrpnodop elnvtasfs2rrur nt1ope iictldla2rmuvp u0alxoxrcoadla r nvs s seto(m nodamtnlfci t arrm(  ot1oex mi3iad mDemnvs ()tlerxrciy1lmDe n s;s trtr(o3iudlmtnlfvia( s2ua(root1aptomf3tad sDrmumont4teeomfcio1fmte ivo;s  ruo(m ou4ll nlnci (fa2rau p;o1oex ifeiadlmDrluvsn() etnio oytlmDelu s t  2ur(r iudol emieiat)sDtax  ;o1oet mfctysla2ulu pnu4areoxr tytopDe uvs;t) rxmxopoudameelfvil()a2uaumoou1ape  ietysla el(von(4 etrir3ty1fa  an o ( trurxmpoo1lpt livt () rtmumo;o1texomf3tadfa rmnvp;(4tetnxo3io1lpD auvo;(0t2umir3ny1am  mncsa()sDurur oo1teeo fctlsfm2uaums;()trtoifcoytoatrauesl(0texm(rpiodam  lfvsls) 2rr(mont1tpeniociysls rlu p;t0 rxnif iatoateluvo s0setrir oy4aptnmnct s)artaurpnu4tpenii3iytfmDulumo () eerxo ia1oaDranvo;s) eur(opny4al emivs tf Dtmxm nt4tptnioeilsfaDua( p;(0 exnxo totoat lnvs ()setr(o3iu1op e ivilsfarum(  ;u4tlenmi3iaslmDum( s (4trenio to1laDeanei t) 2trir oudamee nctltfarua( pou1olt mfciadfa2eanvonu) rtrmociatfp  lieslt) ruo(m nudape lfcil()aruaxmpnt1optniiciydla2rl( s t4aexrirctotlmteanvilt s2uo(o3iydlpe  fcilt)aDtm(rpno4opxn fctyd s emn s;t) lxnir tytfpDraneo s)t2toir3io1lmt mnciat s2tr(rpot1texnmfciyd s2elums;t) rxoxrcoadfat livo t)srxrxm nodale  nctlt)s2rrx  ;o4oeeoiictadlm2emumo;(0tlxrxf tytomte nvslt)sexmim nydaleelfeils  Drmurpnt0opxnif3ias m2uanmpnt4 rxnmrcty1fm   n s (0texmimpou1aptn ivtat arurx p;o1apx ifeiadfm2rm(mp u0 eeoir totlmDrau olt tetm(m iu1amt  netat aDuaxmont1aee  ociyslm ul( pnu) eenxoctotoa eluvolt  rtrxr3no4op  mncta(fsrtmur oo4aex  oeildlm ul(vp u)tetrxo iodomDe u s;s)trxmir3iy4lleelfesat aDrm(mp;o0altoif3tysla2eau p;(4 exoxr iytopDe i o t0s2umxr3iudapenlnvta(f rtr( ono0texoifeiasfa2rln pnu4aeerio oy1lmtr n i;s0setrxrpiydapee nvils s2ra(mooo1aetnmoctadlmDulnvpnt0 etoifctodfaD  n s;( texmxmpiu1alt  neiat) 2tmx p;t1tpeomociatfm2uanmo;(0trtomr3ta1fa rlnvi ()texo(opio1omt livi tfarur(mo;o1openmicias a rmnmo (0alxoxociy1lmtrau i ( seurxr3oy4ap emneias a2ua(r ;t0opt ioeils s2ulumsn(4trtoif3oydlat aiei s  exoio3iy4lle  iesa(f rrm(r oo4apx miciad a ra( p (0tltomf iytfp eanes;(  exo(mpoo4om nmnctl( a2ra(mpnu1alxnmictytfs2emump;t4 etrxociadomtr uvsl(0 2to(m3no4amtn icslt)sDta(  no0texo o3tltls2rm(vp (0trenxr ia1fatran sls0 2uoirpnu1ap e ies ( srurxroot1alxoiieiyt mDrlnvpnu0 rtrmo3oadom rli o;()setrxr3io4openlfvtat)a2rr( pot1oexnifeiytls umn o ()aexoxr3oydlmD aneo;( trumxopno4lmtelnei () Dtmxr oo4apx iietytfa2ean o;t) ltoif tytlmDeanvs;( seuo(r3oy4ol e nvt (fs2ur(  ;u0opx  oeiat a2rmumon(0aeeoxoctotoat au ol(  2tm(m3iudlm nlivi tfsrrrx  ;u4aexnmoeilslaDua(mpn()artoxf tatlptrlnes t)s2tm(r oy1ll n fvsas)aDtaxmpno4open fciaslmDulnmo;t4 etnio iotomD lu olt0 rto(m3nu4lm n fctasf rumxrono1alx io3ilt s2rmu s (0aexrxo3to1fp  ai slt)trur(o io1olt mncsat  rtm(mo;o1tleniieiatfmDrm(mpn()alxomfcoadlpDe uvs;(0 rxm(opiu4ll   nesasfaDtmxr ;o0apxnioetyd s2emuvon(4arxrmr oytlm rluei t0 etoirpoodll e feiasfaruax pno4aptoii3tldfs2rln p;t) etoxf oodomDelnes;t)trurxo3iy1am nmfci (fsrtru p;u4olx  f3iys aDulnmo;t0tlxoxfciadlpD  uei t)sexo(r3nudal nliet tfsDumxroot1opeoiiciltlm2ulnvpnu4 ltoifcio1fptrauvo;t) rxoxm io1omtemnctlt aDtm(rp;t4ale mf3iatfaDuanmo t) etomf iy1fpDeluvi;() 2xmxmpoy1om e fcilt sDtrx  nt0alxnmociadlsDuaump;(0arxoxfciydfatr n s;() rur(rpou4oltnmfei (faDurx  ot4tle  ieiatlaDumuvs ()teeoif iadoa  lu i;() euoir3oudaptnmiet t) rtrxmpot0aptnmi3ildfmDuanmpnu)artnxfcoa1fp e nes;s)seumxmpiy4lmt miei tfaDraxmo;u4apeniiciatla eau s u)aeerxfciadfpDeanes (0t2umxo3io4lp e ncsls a2rr(rpoo4tpe mi3tatla uaumo ()trtnmo iodom eanes;s t2umirpiu1omenmivi tf 2ta(ro;u1tltoiieiysls2eauvo;u0tetnmr iodomtelu o s) rxm(o oy4open nct sfsrtm(r oo0texn ietadlaDraumo t4altnmrcoy1fm  lu s;t) etoxrpoo1lme licsa(fsDur( pnu1oexn i3tatlsDuauvpnt)teenmf to1faDrlu ol( srum(r iudal nmieiatfa2trx poo4alt mfeiltfs2uaumo;(0 rtnir3oadfatraieo t0sruoir nydaptnlncils a2rax  nu1tpxn o3iydfa ulump;t4aetnxo3oadfaDe ueslt  2xoxm3iu4olenlicilsfaDrrur ou4tlt  fciat aDea(mo;(0trtnifctotfpt lieil( setmxm io4opeemncs ()s2um( pno1apxnmietyslsDem(mo t4alenxfctotoate n ols teto(r3iodole mnetlsfaDua(rooo0ape mfciys sDra(msn(4tetnirctotla eluvols trxmio nu1omee fetl()aDtm( p;u0tlxo ieildla2elu s (4trtrxo tytfa elnvo t0 eurimpoo4al n fvils)aDtr(rpoo4aeenmfeiad mDumuvo;u4tlerifciadopDe nvs;t seurxr ny1ome lnvsls) Durxm ;o1alt mfeildlaDeauvp;u0 rxoxf oodlpt  ivsls0srtrxrpno4olenliet ()s2truronu0oee iietldlm2eauvs;(4artoiocta1faDe u o;t  etmxo ou1lmenmictlt)arur(m ;t4apxnmf3iadfm rlnvpnt4alxomfcootlaD  neo;(  eurim oodalte icils) Dtaxr oo4tet  ieiltfa rmnmpnu4 ltoxo oatlmte nvo s0 2tr(m3oo4openlfet (fsrum(m ;u1tpxo icildla2rlnmonu4teerxf ia1faDean s;t srxmio3ny1lmtemfesls)srtrur ;t0olt ifeiad m2um( o () ltoxf iotfmDean s;s)trur(m iy4lme  nciat artmum no4aetn f3iadfs2el(vpnt) lerxr to1lmteauvs;()srxr(mpnydlp e nvtls artrur ;o0oeeomoeiyslsDeau sn(4artrxr3iodlaD  nvi;t)s2urxmpio1ll  lncta()aruaxm oo1opeoii3tydls2ea(vo;(0aexriociatfpDe ivs;(0seumxr3no1ol n fcsasfarumx  nu4opxniociyt m2umnms;(4aexrxfcoatopteanvo;() 2xmir ou4lpt livsa()sDrmxm no0aleoio3iad m2rluvo;(4aexrxo oatfp r uvs;t0trurio iy4ll n fesl(fsrtrx poo4tetnioetyslmDumuvs (4aeerxocoodoaDranvil( t2tmirpno1amtnmfvtlsf Dua(ro;t4aexnmfeiasfa ranmonu0 exrxf3iy1fm  aivo t)tetoio3oy1omtnmfcsatfa2raumo;t4aptomo3tadls um(vpnu4altomo iodop  luvi;s0s2xo(r3ny4lp e nvtl() Dtauront1tltn f3iytfaDranvpnt0teenmr ta1fate i o s0s2toxo3iu4ll nmics ( aDua(r oo0optomiciysfs elnvs;t4 lerir3oatlmt  u il(0 2xrxo iodlpeelivi ( a2um(m ;t4texnmoeiatla2rm( sn()tleoxo3oadlmD  i sls s2xoirpnu1ale  nciatf Drmx ooo1alxomieiytfaDem( p u)alxriocty1la elu o;()trurim3oo1amee nesas sDtaumpnt1apeomo3iytla el(vs t4aetrio to1op  aivo s0tetmxm3ny1amtnlfet t arta( pou1alx ifeiltla rlnvo (4 exnmf3oydfa rlies;s)srxoio3iydole miei s  Dtm( p;t4olxn icildfmDel(vp u4 eerifctydlaDran i t0seuo(rpny1olt lics t srrrump;o4ole mf3tatfm2ul(vo;t4aeeoif3oa1oatr ivols)t2xrxm oydlltelieiltfs2trumpnt4altoiociadlm2uau o (0treomfcoydop e ivil( setmirpou1apeemncilt) 2urxmp;u4opeo oeiatla uln o;u)aexnxr oa1lpte i ol(  exm(rpnodam  lfvsatfsruax pnt0ale ifetas m2rlump (4tlxoxfcoa1fmD ai o s  euo(r iy4lpte nvtlsf rrmumo;u4oee  fetysfs rlnvo;u4tetrxf iadoaDraueo;t) etrxopio4aptnmictat  2rrum nu0aptomiciatlaDrl( s;()tetnxrcoo1om e uvi (0t2xoiopno1lp nmfeia( a2uru  ;u0oltoiieiadfsDeln s ()texrxo3tatom   u ol( s2uoio3ou4ap nmnvs (fsrrr(  no1altomictadfa umu sn(4aexnioctytom  liei s0 rxoir3nydlpee ncil() Draxmpot0aexoio3tadfa2uln s;u4trxnmfctydoptelneo;t)setr(m3oy1lmeelfvi t) 2umum no0olx iieiasfs ean p;u) rxoxr3oadfpD anei;(0 rum(o3oy1aptnmivt tfsDrm(rp;t1alx  oetlslm rmuvpnt0arermfciatop  aues s t2xmxo3nodamee ictlt)arurum ;o1optomfetysfs ea(mo;u0 lxriocoytfpD lu sls0texo(r3oydlmte fei t  2umxmo;o0olxoif3iaslm2ea(vo (4 exnifciadoa  ai s () eur(m3oydom nlnvia( sDuru p;u1tle if3tadls2uauvs t) etrir3oytopte iei;s0s2xoxo3iy1altelnvs t) Dtrum nt4tet iieiydls ua(msnt0alxoiocoo1fatrlnei;t0teum(r no4lmeelnvsat) Dtmu p;u4apeo iciat a2emu o u)trxrmo3iotfaD lueolt0 2uo(rpoodom e fvi sfsDurxr nu4apxn o3iysfs2uluvsnu)teermocta1optrli slt  rtoim nydoltelics ()sDtaxr nt4aptn f3tytfsDem(vpnt)trtnxo oytlpD li o s teurxm nodaltemieslsf 2tm(ront0alxo f3iyt aDranmo;t)trtnifcoy1omtelneo;s srxm(m oodam   nvs sfsDtmu  nt1openmociatls2rmu sn() exnmf oy1fm rai sls)srxrxo3io1lptelfvs ( sDrm(rp;o1opxomfcildfa rm( o u)tlxnxr ia1fp r ies t0 ruo(m ny4om  mfcils sDtmxmpnt0tpeomiciytfs2ran pn(0alerxo oa1la ran ilt0srxoxrpoo4lme livs ( aDrmu ont4texoio3iadla eaumo;u0 rxoxf3iodfa  auvi t0seto(rpio1ol n neta()srumxrp;u4tlen ietlt m umums (0trtoio3iadfa rli o (0srumxm oy1lm elnei () ruaumoou4aeeomfeiasfaDul(vpnu0aexrxo iotlpte nvilt  eum(rpnu4ll elfctat)a2tm(r ou0tpeo f3iatlm2rmnms;t)tltoxf3oydoatr nes () 2trxr3nudlptemfcias  2umum ;t0apxomiciasls2eln ont4tetnif3oa1faD  nvi;s) exmim oo1am e fesls  Drrumooo0tet  fetad mDulnmonu0aeermfciadoa rlneil(0 rxrir3io4open ivi s) rta(rono1opxnmietysla2ua(vo;t0 reoxrctotom  li slt trtrio no4amtelnesat)s2rrxmpnt1altoiieilsfm rmuvp;() exoir totlaDelu sl(0s2tr(o3oudal  mnct t  Drrx ono1ale  o3tydfmDra(ms;() rxnifciydlpD aiei t)setmir oodaltnlicil( sDrauro;u1aetn oeiys aDem( s;(4artrio ootfaDrliei ()srumim3ny4omenmfetlsfartrx oou1aet io3iydls emnvp ()tlermf3iydla  li i t srurio3iy4lp   iesat) Durx o;t0apt io3ilsfa2rluvs u4 lxnmf iatla  an ilt0trxoxmpnu1amen fcsa(fsDumx oot1aetomfciys mDum( o;(4arxrmfcoodop r uei;( texoxr ou4lmeemies () rrmxrooo1olxn i3tys m rl(ms;t0trtomr iatla  luvi;s t2tm(opnu4lpenlfeta( a2tm(m ;u0opt if3iasls2eaums t)altoircta1fp   nes;() rxrxm nu1lmt mivi (f Draxr ;t1tlt ioeiat mDrm(vp u)treoxo3ia1laD aies;s  ruoxm3iy1olen nesls s2trump;t0ope  iciysla2rlnmp;u0alerxr3oodlmtranvs;t)trxr(opnu4lle lfesl()s2uaumonu4apx mieiysfaDem( o;t)tleoxr3iadlpD  u o t)trtmxm nu4omeemictasfsrta( ono1optn i3iydfmDuanmp;u4 lerif3ta1lat luvi s  eurim no4ap nmnvsl() Drmxmono0oleoifeiadlmDeanmsn()aetrmo tatoatraues;s s2xmimpny1amtn nvt (fs2tmu  ;u0tlenio3ild a2ulu s t0 rtnmo iy1opt li olt0texriopou4omtemfetl()arururp;u1tleo icilsls um(vo u0aetrxo3ootopD au s;s)seto(mpno4ole livs t  2rr(ro;o0olxo f3iltfaDemnvsn(0trerio3oytopDraneilt)srxmxm oudamtemfvia(  Dtmx poo0apt iocildlsDelnvo;u0artrxrciatfa e uei;s) rurxm ou4omte netl(fs2taxmp;o4altomoeiyd a emu snu)arxoxf3ty1lmt aivo (  eumir3oy4apt  neilt a2taxmont1alxomictlslm ua( pnu0aexomf oatoatraiesls)srumxrpiudome livi s aDuaum no0aeenif3tydfm eanmp ()arenmrcoytfp   i i;(0 rtrir iodapee fvtas  2trx pno1aexoifcilt a ra(msnu4tlenmrcta1fm rlnesl()srxm(o3nodllen fcsas sDtaxrp;u0tlxn iciytfs emnvs u)texnxf3oy1oaD lies;( s2umio oydlp n ivta(f rumu  ;t1tlxnmoeilsfm2el( p () lxoio3oa1fm raieo;()trtrxm nydllenlneiasf Dua(mo;o4olto o3tysls elu snt4trtrxr tydop   nei (0t2xm(m oudaptemies s aruaxrp;o0apen oeiat a2uanmpnt0 etrxf oydlatrauvols)tetrxm3ny4omeelnctltfaDtrx  ou1oltomf3tatlm elums u0 lxomr3ty1opDrlies;()s2um(rpoodame  neslt) rtm(m nu4alt moeiaslm rm(vo;() ltrxf3ty1omDeli s;s)t2tmxo ou1ape mfeiatfa2um( p;o4oeeomo3tyslsDemuvs t)tltrmf3oatfaDe ivi s t2tmxmpoy4lmee fcia(f 2trxrp;o4alt  f3iadls2emnvpnt4trtnxfcoa1fpt lieo t sexm(mpnu4lmt lneiasfsrraxm nt0tpx moeiatfs eaumsn(4tetnxo3ty1lmD  nes;s t2tmxr oydlltnlfcsat  rtmu ooo1tetn f3tltfmDuln s;()aeeoxfctatlm  ln i;()sexrxr3io1lle lfvtat)a2raur ou4ole moeiyslsDuluvp;(0 lxnif tatfa raivolt  euoim iu4ame  ivs (f 2rrxm no1tpxoifctad m eau ont) exrxr3iatoateaueslt) 2xoxr3oo1lp   ietasf rtrxmooo1alxo iciyd m elnvp;t) renmrciotlmtr i ils0t2um(o iudlme  fct s sDrrumoou4ape  oeiyt s2raums ()tlxrio3totomD aivo s trtrir3ny4ope  ncs s) Durxrpnt1apxn feiadlsDrlums;(4 renmr iytfm   u i s)srtrimpoo1ole  nctls artru oou4tetomfciadfmDrlu s;t4tlxrirciadlm eli s (0trxr(r no1ome lietatfsrrrxroou1aleoii3iad aDeln p () lerif iodop e i i;t t2urxo3oudaptnliet ()a2raumo;u1opxnioetldla elumpn() etnmo tydfaD au il()srtoxo3io4aptnmneta(fsruau pnu0ole iieiytfm emuvp u0 lxrxoctotopDeanvo;t)s2ur(o3nu4ole licsatf rrmurpnt0tlx io3iydfa eanvsnu4texoiocoa1fa e iesl(0 2xoirpiy1lmee fctatfarum(monu4opeoioetys mDuanmsn(0tlenxo iodoat livslt  2urxr nodlltnmnvtas) rum(m ;u4aeto oetadlm2emnms;(4aexomf oodomDrlu i s0 2xoxo3iudlm  mictltfaDta( oou1oeeniociasfm2eanmpnt0texrxf oadfm   ivs (0trtrir3nudaleelici sf Drmx o;t1oltomfctysfm2eaums t0trxnif oadomte nes ()trxm(opiy4op  mfvi s s2taum nt4olenmoctat s2emumo;t0 rxoxrciytfmt luvo s) etrxrpoo1omeemies (farrrx onu4tlxnii3tys m2uln o () rxomoctytla elues;s) 2ur(o3iu1omtnlivi ( srumx  ;o0aetnmfeiltlm2umu s;t0tetrmocoy1fp r u o s) rtrxrpio4optelivs tf Dumu pno1aetnmoctatfm2umn ont)teerio3iadoa eluvo s)teurirpou1oltemivtas a2taxrp;t0tleo ieiasfs ul(vp;u4 rtrmr oy1oat liei;t) etr(opiu4ale  ivs t)arrax  oo4apt ii3ild a2raump;t)areoxf to1oatraivi t srtoxrpio4lp emfei t  Drr(ront1aet mieiat m2ul(vs;u0alxoxocio1opt  nes (0 exrir3oy4olen fvs s)sDtrxmpnu0tpxniieiltlaDuau p t4 eerxocoy1faD  u s;() etmio nu1lptnmncta(fa2trumo;t1tpt iieiatlm2eau ont4 lermr tatoptr ivs t srxmxo3oo1ol elnci () 2uaurooo0oetn f3iatlm2elnmo (0 eeomr3iodlmteli o (0 2xo(m io4ap  lfvsa(f rumxmooo0olen f3iad a um(ms;t) ltrxr io1oa  li i t0texoxr iydomtelfeiat sDtax p;t1oleo oeiatlm el(mo (0 eeomr oa1oa   uvi;s)srxmxm nu4apt  fesl(faDrmxrp;u4ale mf3ildfa ul(von(4 rtoxfcoytfmD ai i;s t2uoxr3oo4lptemici tfaruaxmp;o1opx ifcildfa2rl(vpn(4artoxoctatfpt livs;()srxmim3iydap   fesat  2rm(rpno4tlxomfciysfa2uln s;t4 ltomo3iodopD  ivs;t)t2xrxo3iudaltn ivta(  Dtmu pno1aptnii3tlslaDua( s;t0 reomr3ty1lm raueo;()trxo(rpoo4ome lieils sDtaumono4tlx  octas s2umn p;u0aeenifcio1fm raies;t0 exr(o no1al nlfvi t s2rru pnu4aex mi3iad s2ua(mp;t0trerif3oatopDeauvil(0sexr(o3iy4al nlncslsf Drr( o;o1aptomf3ildfa rluvpnt0aeenif3iadfpte i ols0 rtmiopoydop nlfvias  Drmxmoou1optniictad s2emuvs;u0 leoxf3iotoat aivo;t  rtoxo3iu1ll   ncsltf Dtau oot4oex moctysls eau p;t4teermf oy1op r n ils  2urirpoydam emfvtls sDtr(mooo0aexnmfeiad sDrl( p () ltoircio1laDranvi;t  2uoxopiudom  mfcsl(f rurxroot0aleoiieiysfa2ra( onu4trtrxo3ootfmDr n slt) euoirpnydlptnmfvs (  Draxr oo0tex miciydfm2ea(vo;t4alxnmr oo1fat  n i;s)trxoir oy1ameelncilt sDraxr ou1apeomictytlm ranvpnu0altniocia1fpD ln ils)s2uoxrpiy4om emfvi sf Dua(r ;t4ope ifciadfs ulumon()arxrir3oo1lmDrluvsl(0trtr(r no4oltnmivtlsfarrau o;u1tpto ietadfa2umnmp;t4trxomf oatlpD luei (0 rxmio oydolt  netl( s2tm(moou4ope  iciyt aDemu p t0 ltrmr ty1fpte u sls0sexmiopou4lleelieia( arrmxmo;u4apxn f3iadfa2emnvont4tlxnmrcootoptelivo t0t2urxr ou4lp emivil(farraurpnt0aetomo3iad a2ra(vp;(4tltnxf3iytfmte uvol( tetrxr oodamtelicslt  2taxr oo1optoifctytfa2rmuvsnt0treomrcoadlatrlu i s0 2tm(r3oy1ole mivi tfaDur(rpno0tetnio3tys a2em( o;(0alxrif oo1fmDe u s t  rtmxrpnudlmt livi (fsrrru o;u1tpxn ictytls ea( s;(4aeeoif iatfm  lnei ()tetr(o3iu1lmtnmnetas srtr(root1texnmfeildfs2ul( p u)aetrmf3iotlmDeaies t0s2xo(r oo1ol n nvtlt srtaumpoo0tlxomf3iaslsDua(ms;t)texnmo oytfmDelivo;s0truoxo3io1lle lncia(fsDtaxrono4tptnioctydfsDrmnmo u)tleomf ta1lm  lues;s  exrxm3no1ll nmicsl(fa2uaxmooo0tlxn fciad mDeaumo ()alenmr3oydlaDran s;t  2ur(r oydolenlnvt sf Drru pou0oeeoiieiyt m uanvpn()altomfcoy1lm ran s;() 2xo(opoo4lltemiesat) Duaurpou0tleo ieiadfa2rmnmp (0arxnio3ia1op  au i;( t2urir3nudome licia( srtrumpou4alx  iciasfaDelump;u0aeenmfctodlaD anvi;t0 euo(mpiydal nmivi s s2raxm ou4opxniictas m2elnms t0tetoxociydlm r uvslt0s2xmim iu1ope  fctlsfsDraumonu4tpt iietls a elnmsnt)tltnmf oodomtr ivi;() 2umxo iu1amt mnvtl( a2rr( o;u4alxoiietytfa2elumonu0tltoxo3oy1fmtrai o t)s2umim nu4aleemnvsas aruaurono1tptnmictasls2rau o;(4treomo oytfateluvilt s2tr(m3oudlltelieiltf Duax  no1altnmfciys mDelu o;() rxnmoctydla  auvs t) eumxo ou4aptelnetlt)sruax oou0ole iicildfmDul(vo t) rxnmf3oadfpDelivsls)seur(r3nydop  lfviat a2um( pou0olen fetlsfmDrau on(0 eenif oatfpDr n s;t0 2xoim oo4ame  nci ( artrxmpnt1tetnmfeiad m rln o t0aexrir oydfmteaiei t)tetm(rpny4oleelivt s srrr( pnt1ole mfetysls2ran o u0 etrio iadomDe u s ( tetrimpnydopen ncs s arum(m ;o1tptnmo3iytls2ra(ms;u0trtnxfciy1fat auvil(  rtmxo3nu1ameelfeia()a2raur ou4apxnmi3iyt a2emnvs;(4 rxnioctytfa eln slt)trum(opio1lptemfeiat)s2rr(m no1aex moeild a2emnmo;(0artnmo3iy1fm  anvi;(0 2xriopiy1op   fvilt)a2tr(r oo1texoioeiadfaDrmnmo;t)tetrir3ta1oa  livs;(0tetrxo3io1ll emiciasf rrmum ot0aeto iciys sDrmn p u) renmf3oa1lp  an s;(0s2xmxm3oo1am emivia()sDrrump;t1oet  fcilsls ua(vs t0aexnmf3iodfatrau s;( trxrxr3ou4ol n nesas a2rru pnu1opxnmf3iysla2rl( p u4arermr3iytomtelivo t0srxr(o ou1lptemicsa() rtrx  nt1aetomieias m2eauvo;u) eerxrctotlaD aneo;t srtoimpoo4amt mfvsas a2ua(mooo0apxnmi3tys mDrau p;(4texoircoa1lp   i o;s)srxrxm nu1lpeelnesl(fs2tm(monu0oltnifeilsla rmnvpn(4aleoxf3tytfaDr ivi s)texmir no1lm  lnctls sDrrxmono4olt moeiytfs rln on()artoxrctadfateaivs s t2uoirpiy1ame lfcs s aDurur nt1tlx  i3iltla2el(vsn(0tltnmo3ta1la rlivi;s0 rumxm3io4omenlnctls)aDumxm oo0oetomociasla umnvs (4 exnif oydla ranvi;t0texmxo iu4lp  liet t)a2tmurooo0olx  octlsfmDelumsnu4trxrxfcoadfpDeln slt)teumir no4oltnlnvs s)arumxro;o0apxo ocildfm ua( p u4arermf3oatom rlu ilt)truoxm iudolen fvt s)aDrru  ot0ole iictysfs umu p;t)tlxomfcta1omDranes;t trtoxmpny4lpe mieilt sDum(  oo1tex moeildfa el( p;u)tlxrxr3tadoa elieil(  euo(m3oodomen iciatfsDrmx  nt4tpeo feiysfm ulnvp t4aexrxrcootomD  uvslt trtrxo3nodame mnvil(f rtaxr ot0ole  f3iydfs eanvs (4alxomrcootlm raivs s  rto(mpny4ole mfcil()s2rrx  ;t1alt io3taslsDrlump;t0aexrif oydoa  ai slt) exmxr3oodlltnlfei () Dtr(mpno4tet ii3tldlmDum( onu0alxoxr io1oa  anvs t)teuoirpou1amtnmncsls)sDra( p;t0oex mf3tas a2em( onu0artomrcta1fpt luvs;(  2trirpiydam nlivi tfa2tmur ot0opxn ieiaslsDrl(vo (0artoxf tydomt an s t0s2trio oodamen nvs (fa2umumpnu4oex mfetyt m rmnvsn(0 exrxfciydlp r ues;t0 eurxopiy1amenlfeslsfs2ta( pot4opx iociaslm ulnvs;u0tetomrcoodfm e ies s0 eumxmpio1om  lfvs ( a2umxrp;o0tpxnmf3tas s2ranms;(4texoxf iadoptrlneslt)srxm(r nu1ale lfei (farur(rooo4tlxnioeiatfm2rlnmpnt0 lxrmo3io1opD  uesl()s2xmio3nodaltn nvsl()arrmxm oo0alxnmo3ildls2elu p u)tetoir tytoatelueo;s trxoimpiydop emfvsa()arta( pno0opx ifeilt m2emnmp;(0areoif3iatlptr i ils0 exo(m iu4aleelivia(farra(r ot4ole iociatfm emnvonu)teenxrciytoatelies;s texo(m io4lm e iciat)s2ua(  ;o4apx mo3tydla2rl(vs;(0tlxnifcio1fpDean olt0seurio oudol   nct ( aDrrurpnu0aleomiciasla umums t4texnmrcia1fmteaiei;t0teur(opiudalenmfei s)sruru  ;o1oet  f3tys mDeanms u)aexnio3todla  livs t0t2xr(opou1lpeelfcta( srua(moot4olx if3iytfm2uan snu)alxrmf3iatfm rai i;t) rto(r3oy1alen fetat)s2tm(mpno1optn fciysls elu pnu)trenxo oo1oa eauvi;t) etoimpnodam e fvi sf Drmum ou1aexoifeilt sDrm(vp;(4trtoir to1fpD  i s;(  euoxrpny4lmtemncs s)srtrxmp;o4optnifeiydlm2um(mon()alxnmr3oydlptrli o;(0 rxr(o3io4aptemict (  Drr(  oo0oltniicild s2ra(vp u4 ltoxocoadlpt aivs (0trto(o3oo1lp e fciatfs2rax  nu4oexomf3tytlsDrmnvpnt)aexnmfctytfpt li s;() euoxo ny4aptnlfeilt)aDtaurpou1optoiietasfs2rm(mont0tlenxf3ootlm r uvs ( srum(r3no4lltn fcta(fartmx oou0alto ociatfmDumuvs;(0altrifctydlp rlu ol()t2xm(m3oodopeemiei tfsrrru p;u0tpx miciasls2elnmpn()arenxfcty1oatr uvo;() eum(m3io4omeemnesat)aDtaxr ;u4teeo fctld m2ua(vp;(0tetnmf3iydfm  anvo;t0seuoxo nudlmtemiei t sDuaumoou0oltoio3iyd mDra( snt4arxrio3tatoaDe ieo s  rumxrpiy4oltnmicsl(f 2tr(mpno0tet iieiatlaDumn p (4altnio3oodopDean i (0srtoxm3oy4openmnei (fsDumx o;t4apeoiociydfaDrmu o;(4tlxnxocty1lmDranes s sexo(r3iodopee ieil( arra( o;t1olx  o3iydlaDua(vp t0trxrmf oy1fptr neilt0s2xmio3ny1lpen fvtl()s2rrumpnt0tleoifctasfsDumnmpn(4altnmfciotlptr neols0s2trxmpno1lptn nci s)a2rr(mpoo0tlt ii3iatlm ra(mo;u)aetnxfcoytla  li o s0 2ur(o3io4ol elnci tf Dumx pnt4tptn fetas s rmn s;u4tltrxfciadlmD anvo ( setm(r ou4alt lncs ()aDrrxmp;u4teeo fetys s eau snt)tlenmf oy1lp raues s0srumiopio4lleemict tfa2rm(m ot1apxomo3iydlm uaumsnt0aeenxr oy1op  aieolt trumim io4opte net (  2rrxm ot0aexnmi3iltlm2umnmpn() lxnir3iotfmteanesl()setrim3oydamtelivil( a2ur( onu4oetnmfetysfaDra( o;t4trtoio iotom  lies s) rxoim3ny1op  mivt (fsDuaurono4optnmoctasfs2umnmp ()texoxrctatlp  au slt  exrirpio1ape mivt ( srumxm no4oexnmfctyt aDrlumo ()aexnmo3ootlm rauvi s)setm(rpou1ap n neils  ruau  nt0ale ii3ild a ulumo (4 etnmo3iatfa elivo t trtmxr3oo1lpen nvsa(  2raxr no0olx  ictadfm2em(monu4 reomfcty1fatrliesl() 2xmxo3oodome lfvt s aDtr( p;o4oexo f3ilsfaDrmn o u4 exrmrciodopDeln sl() etmim3iydomtn ncsl()srurum oo1aeto ociltfaDulu p;(0arerxo3iatlp  ai ils  rxrirpiu4ll  lnvsa(f Dtru pot1opx  oetlsla2umumpnu0 rtrmf3to1fpteaiei;t srtrio3oudllte fes tfsDum(rpoo4oex  feiyt m el(vsnt) rxoxo todopt li i t srxmxr3oudomenlieia()s2rm(ront1aexn fctytlm rmumo u4texrmo3iydoat aiei s) etoir oydlmtelneil()s2umu  ;u0ole io3iytlsDel(vs;() rtnmo3oatoaD an slt)teuoxopno1lp  licia(  Drr(r ;u1alt mi3iltla eanmsnt0texoio3oydoaDeln ils  ruo(m nu1ale livs t)a2trumpoo4apt iiciaslm ea( s;u0texnmocto1la rai ol(0t2to(mpou4lme  ivtat)aDurx oot0opeoiieiysla2um(ms () eeomr3iadlpDe n s;s)teuoimpiydomt licilsfa2ra(mpnu1tpx mf3tytlm ul( p;u)altomociodlaDrauesl(0texm(r3iy1lme mncil()arrmurooo4ope  o3tls s2ran pnt0aexriociadoatrlnei;t sruoio3iu1opte ivia(fsrtr(monu1tetniietys sDulu pn(0aexrif oadfaD li ols0s2tm(o3oodlle lics s  rtmu  ;t0oex  iciat aDrmnvp;t4altrxfciydfpteaneil()t2tr(opoudole  fvsat)a2tr(  ;t0aleoifciysfm2ranvsnu)tlxnir3ta1fpDeli ils0 exoxrpno1apeelfciat arum( oou0tpx mfeiaslsDemnms;u0aetnio oo1la  au ols)sexrxr3iy4aleemncsls) Drau  no4apeo feilslm2umumsnt4 renmf oo1lateluei t  etoim3oy4lp elfctlsfs2ra( pot0tetoifcilslmDem( o;u) rxnmo todlatr neils  2xoxmpoydomtn feil( sDra(mpot4tlxoif3tad mDemn onu) reomf3totfmD lnvs;(0t2trxm oo4ale  fvi sfsrumur no1tlxnmf3iytfsDum(mo;(0areomo3ty1latranvs;t0srxrxrpio1omtnmivil(  2tm(m ot0apt moeiatlmDeaumo u4altrifcoatomDelivi;s0tetoxrpiydopenmfct s arraxm oo4tee miciadfs2rmnms;u4tlxomo tadlpDeauvolt  rurxr iydoltnlfesa()sDrm( ooo4teen ociatlsDumu s;u0 exnmr3iy1oa  ln s (  ruoxr3oo4lpenlnetat)s2uru  no0ole mf3ilsfmDraumo u4trxnmo io1omDrau o s0sexoxmpiydll n ivi t)sDtruroot4ope mieildfm eluvp ()alenir3tadfm rln il(0 rxo(m nu1al emieta(f rrmuro;o4opxo i3iaslaDum( pnu)arermr3iodfpt ln o t  exrio3nu1apenmivi sfs2tru o;u1olx ii3ilsla ra(mp;(4 etnmfciodfatr u s;t)s2umimpiu4aptn ics sf 2taxmo;t0tlto o3iltlm ranvo ()trtoxrcoy1oaDr i s ()trtrio3oy4omen fct sfsDrrx  nu4oetnifcias sDrmums u0 rtnxr3iadoaDe i ilt)s2um(opoo4omtn nvtlt aDuaur ;u0tet iiciadls2rau sn()alxrmo ia1lmtrli s s0s2xo(r nu1ol  mnet sfsrrrxmoot1ape ifetatfsDemn o ()tlxnxf oy1lptrlivs (0teumxo3ny1altelncsatfsDuax  nu1alenmo3tld m2rm(msn() lxomociydfmte n olt) exmiopio1am nmfcs t srur(rpno1tlt mocild m eanms t0artnir3oodlmteluvsl()sruoxo ny1lpt  nei s)aDrmx ono1opxo fctldfa rmuvp (0 eenmf ty1op rln o;s  exmxm io4omt mfcsl( a2ur(mpot1apt  i3iytfa eau s;u) renifctydlatrlieils)trurir iu4aptnlivsl(f rtru p;o4altnmictasfmDumn p;u4 lxomociatfm  auvi s0 2xoxrpiydlltn nvt () Dtm(r ou0tpen o3tatls2ranms;u)artrmf oydlmD  n sls)srxo(m3oy1lm   icilsfaDurxmpot0oexnmocildls rmnmp t4 lenmf todop  anes;s)truo(m3io4ap nlicias) Dumuroot0tlen iciasfm2elnvsnt)arxoir oytlpDrlnvil(  2trxopio4llen fctlsfa2tr(mo;o1tetn fciyt s rl(vs (0alxomo iy1la   u i t truo(m3iu1oltnmncs (f rrmumpou4aex  ieiatfmDuauvs;(4tltoirctydlmD au ol()texoxm nu1lm elnvsltfsDuru o;t4tlxnmfeilslmDranmo;u)aexnmr3ty1lmDraivs t t2umimpnudaltemfesat  2trum ;t4aptoio3tltfm2rm(mp;(0tleomo3oo1lpDrauei s0trurim3ou1optnmics t a2tr( ono1oexo fciysfmDuln pnt0trtrxo tydlm eauei;s0t2umio oodlltnlnvtl() rta(r ;o1aetomoeiadla2umn sn(4treoio3ty1lmtelues;t0 rumir3io4ap nlfeta( artmuroot0alt ioeilslaDrluvo (4tltomr oytop  aiei;( tetoxrpnudapenmfvtls) Dumur ot1altniietlsfmDeauvsnu)tlxoxf iytomDe ueils0tetr(r3iu4omtn fvta()aDra( oot1oexoif3tytls ea( s u)aeeomociadoaDeaies (0seumiopnu4al nmiesa( sruax p;o0teto o3iydla uluvp;(4 rxrxfcoydom rai il(  etriopoy4op nmnvi t aDurxmp;t0oltnifeiydls umnvo;()tetomo3iotlmDrlnei (0s2urxr3iy4lpte fvia( arumxrooo1aexo octat s2ra( snu4aexomocoy1lp e ivs;t  2urio oy1ome mncs t srtmuro;t1aleomoeiysfa rmnvs ()alxoiocoadfmt luvi t)trxo(opou4llt  icsl( arur(ronu0tlto feild s umnmo;u4tltrir oodlpt  uvo;t) ruoxmpoydom  mfcsat sDrrum ;t1tleo i3ildfm umn o t4trtomr oadoa e ueil(  rtoxmpiydalee fvsa()sDtr(mp;u4apxomo3ilslaDrlumo;u0aeeoirciadfat lnvilt0trtrxr nu4omtemfeta()srum(  ;t0tleoii3ils a2um(mo;t4alenmr oa1lm e n o s0 exmiopoo4lleelnes t s2taurpnu1oee ii3ilt sDemuvpnt4arerxo ta1op eaivs;(0t2trxo3oydll emnvia()sDurumo;o1tpt mfcias aDelu pnt4tlxoirciatfmtr n s t) ruo(o oy4lpenlfvt sf Dtaumpot4tex iieiys s ranmpnt)tltrmrcoo1la raivi t)setmiopoy1apeelfcils) Dtr(  ou0tlx  o3iyslsDumn sn(4altrxo oo1fm  lnvs (0 2tmxm iodal   nvt tf rtaxront4oeeoiocilsfm umu onu4 eeomf to1fat lueo s s2umxo3iy4ol elnvsa()aDur(ro;u4opxoiociad m umuvo;(4trtnir3oa1fpD au i ( srxrxmpno1ol n fvsas) 2tru  ;o4tee ioeiytlsDeanvpn()tltoxfcoa1op r i o ( trxoimpoudaptnmnetlt srtaurpou0aex mietatfs emnvpnu0aetoxrciodfmtean ol( trxmxo ou1lp nlnvtasfs2tm(mo;t1oex  ietadfs2ulu pn(0tetnif3oydfmDelieo () 2toirpnudlpt lncs t sDrm( onu0tptnifeiytfa rmn o ()areoxr3iodlat luvsl( truoxrpoy1omenlictasf
\ No newline at end of file
@@ -0,0 +1 @@
+uei (0trtr(mpiodamtnmfvtltfsDuru  ou1optnif3tls m2em(vo t0aleomfcoydfaDelues;s)texr(r3oy4llenmnvslt  Draxrp;t4olxn ocildfa rlu o;()arenxfciytfm rlivil( srxmir oo4ol   net ()s2tm(m ot0aptomicild m ulnmp;u4 exrmf oy1oatr ies;t) rtrio ny4ape mfcils  rra( poo1tlenmf3iyd a rmn onu)arxnir3ootla   neils)trto(m ou4lpen ietl(f ruaum nt1tpto feiadfs2eaumsnu0altoirciadoaD  n ils srum(r3oo4olee iesas aDuaxm no4tlxoif3iltfaDeluvon(0alenmo3ia1lmD luvo;s  2trxopny4ol emfvtlt)sDur(r ou1teen i3tyd a2ea(ms;() rermr iotfpt  u s;s) exo(o ou1opeelici t  2urxr oo4aleoio3tasfsDrmnvpn(0 exrir3oytfat an o;(  etoio3io4am nmneil(  2umu  ;t1oex ioetydlm2umums u4aetoir3oatlaDean sls0s2ur(m iy1ame lfcia( aDrr(m ;t1olen f3tatfsDea( on(0treoxo3to1omD  n i (  etmxo nodll e iet ( aDrmxrpou4apen feildla2umn pn()altoifcio1omtr nes;t0sexmxm nu4lmee iesas) Dtrxm oo1oeen fcils a rmums u)artoxf oodomtrau i;t)srxrxo io1lmt lnvilt)s2taxmpnu0oexo oeiaslsDua(mo (4tetrmf3iotfm e uvs t)t2trxo oo4opeemieilt)a2rr(mono0tex moetadlsDrlnmsnu)arxnxo todlm eanei s0 eum(mpnu4lm emfvi sf ruru  oo0opt  o3tlsls rl(vpnt)tlxoxf oytfm elnesls)s2xr(mpno1lme lnvtlt  ruru pou1tlxomf3ild a2ulnmp t)aeenmrctatfat lnvol( teuo(mpiydopeeliesl(fsDra( o;u1oltn fetadlmDrmn o t0 lxrmo3oy1oa eluvs;t)seurirpiy1lp nmnetlt)aDta(mo;o0texnmfeias m ra(vp t4trtoxr3oatlpDeln i s  ruoim iodlp n ivsat)arrr(r ;o4tex io3tyd s rmumo t4teenxo3tydoa eli o;t)trxrimpou4lm nmfetlt arum(ro;t4aetnmietyd mDuauvp (4alxomocoa1lm  ln i;s  eum(rpny1lpeemivt t  2rm(mo;t1oee ifeilsfaDrm( p;(0 rxoircootfa r ies;t0srxmxrpiu4olt  ivtl( srtr(  nt1tpeoioctatfa eaumo t4trtoxo to1laDr u il(0 2uoir3oodlltn fvsas)arta( ooo1opt mfeilsfs2emnmpnt0aexoiocta1late nei s s2xmxr3ny1lmtn nvs tfsrtau poo1optoiociytfsDrl( snu)aleoiociotlaD  ivo t tetoxopnu4apt mivtl(faDra(  nt4tpx mi3tld m eln p u0 rxomr oy1la rlnvo;t t2trim nu4optnmiesasfsrum(m oo0tlt moetatlm emumsnt)teenxf tydoaD  uei;()texrim oy1apte neia(fsDta(rpnu1aptnmfetadlm2eau p (4tltoio oo1lp  ai olt  rurim3nudlp  mfeslt  Dra(m ;t1tlenmocildlaDul(vpn(4alxomociatfptr ivols0sexmiopoo4lptnmici ()a2umxro;u4aee iieildlm rlums;()tleomf todlmDe nvo t  exo(r iu1ape  ivi ( s2rm(rpnu1apt mietas a uau pn(0teeomf tytfm eauvo;s)sexoxm3iu4al nlfvsasfsDra(  ot4oeeniicilslmDrm(vpnt)tlxnxfcoa1fmt aieils)seurxo ny4oltnmivt s aDtru oou4aee mfctas a eanmp;t0 rtomo ia1opD  uei t)trto(opnudop n neta()aDrm( ont0opeo iciasfm emnvs;(0aeermf3iotfp  anvils s2tr(mpiudalte icsatfsruau pou0aptnifeiydlm2umnmp;t4 eenxr tytfa e u o ( trtoim3nu1ame mnvs (fsDrau o;t0tpxoif3iysfm ulnmo;u0aetoif iy1oaDelivo s)texmxr oydlleemfeilt  2tr(ro;t4apeo i3tadlmDrln p;u4tltoxo oy1lateaiesls)t2ur(r3oudol nlnct sfarraxmpou4olx moeilslsDulumpn(4 lxnxocia1fpDraues;t) 2tm(o3no1amenmncilt  2trurpot0optn feilt m rmn o;u4tlxnxo3oatfa rai o;s0t2ur(r oudlm  miesltfaDuru ooo4alen ieiasfm ul(vo () exoxr3tytfpDrlneils tetmimpoo1llenmictlt)sDtmumpou4oetnmfciadfs uanms t0areoio totfmte i s ()t2ur(m ou4llt lnei s s2rrump;t4tet micilsfm2rmuvsn(0tetnxr3todlp  livs;t0s2xoiopiydomenlnvsasf Dtru pnt4oee iiciyt m ua(vpn(4tetoxr ty1fatrlivils setmxmpnu4lm  mfes (  2umu ont4aetoifeiadfm emnms u) rxoifcia1faD  nei;(0s2uoimpiy1alenlfvil(fartax  ou1tlx miciltfm2eluvs t0aeenmf3iotlpte ivi;t0 rumio nydomtn ivtls  Drr(rp;t1alxn iciatfa2ul(vs t)alenmf to1lm rluvs;s0sruoim no4am nmfvt s)a2tmu  ou4teeomociltfs2rl(vpnt0teeoirciadlmD an s s) eur(o nudol  mnesat)srumumpnu1olx miciat s rln ont) etomociodfaDrlu slt0 ruoxrpiudomenmiesl( aDrmxmpnt1tpeo fctatfs rauvont)teerio ia1fmD lneslt  2ur(opnu1lmee neils)arum(moou4apt ifctlsls2uaumsn(0tlenxf3to1fpDr ueilt0t2xr(o iy4lme  neils)aDtr(ront4apeoiieiytls2ra(vo t4 leoio3iytlm  aieol(0trxoxm3oy1omtn fvtl()artau poo1altoiieiat sDemnvs;u)aexoif3iodoat  ivs ( t2xr(m3nudlltn ncil(fsDrmxr ou4aeeomoctytla em( o () lxnmr oodlptraneol() 2xo(rpoy4apte icia()sruru o;t1altn i3tltlm2eau p;u4trenmociotfaD lnes;s  rto(opiodalen ieta()s2rax o;u4openiieias a2rmn s;u)tltomociydlp elueo s)trxoxm3iu1op nmfvias)a2tru pnu0ope ioeiadla2umnmp t)trxnmo3oy1lmDeauvilt0teum(opnu1al emfvtlt sDrau oot4olen fcils s rmumo;t)areoircoodoptr u o t) euo(mpnu4alee fetls)s2rr(moou1aexn f3tltfs umnmon()tleoxr oodfateaivo;t srxm(o iy1omeemictl(fs2trxmp;t4tex mo3tasfaDua(mo u0tlxoxo iotfatelnvols) euoiopou4ol n fcta( aDtaumooo4aee mo3iat a2eluvsnu4trxnmf3oadfm r ivo;t)srum(o3io1aptelncslt)s2trxm ot0alxo i3tat a ua( p;u0 renmr ootlmtrluvi;t)tetoio iydale lfeiltf Dtrum ou0alx iociatfaDemuvs u4 ltnxo ty1fp r uvsls0 exm(o3nu1alenlfci ()aDur( o;o1oeen ietysfm umu s;u4artrir iatfpDeaieol(0tetmio3oydop emivils sDtaurpno1olen oetatlm2rmump (0altriocoodomDrauvo ( setmxrpoo1optelfctatfsDrr(mp;u0tlenii3ildls emnmp;u) rxoirctotfpt auvilt)tetrxm3oy4ap n ivtlt) Dtrum nt0aexnmietyslmDea( p;u4altoxf3iydfmDr nvi;t srum(r3oydol e fei s  rua( p;o4opeoifetyslsDul(vp;u4arerxo3io1lp e nvo t0 eur(rpio4olte fvtl(fsDrmxm ot1aee if3iad aDrluvpnt) rtoir iodlm ran i;t0s2xoxo3io1op e ivsl()a2taur nu4tlt  i3tls m2rm( snt4arxoif ta1fptelnvi (  rum(r3iydll emictas sruax oou0oexomf3iyt s2uln snt0alerxr tadlm ranei;s0 rtmxo3oydolt mneils  2tr( oot4ale iietytfs ulnvp;u0arxnio3oo1laD lneo;(  ruoxrpoodlmtemfcil(fa2urumoot0olx  i3tat m um(vpnt) rtrio3oatfp ean sl(0 2tmxm ou4alt liei (fs2rmx p;u0tpeomoeils a2ran s;u0 etomf3todlptelu i;t0sexo(r3io1ap  mfesa()arraxm oo1opt  ictadls2eluvo;(0 eermocoo1opte nvs;s)t2umxmpiu4lmt lietatf 2tm( oot0aleomf3iysfm ulu p;(4arerio to1fmDr nvi s tetmirpoo4ol e netls)a2tax  no0aptoiociytfaDrl( s ()texrmf tydopD aneo;t)trtoirpnodlp n nciat)srra( p;u0tetoiiciys m um(vpnu) renir3iydlpt anes t0s2uoim3nodome  iei ( sDrmxmooo0oeenifeilslaDelnvo u4tlxrmf oadfpDeanes t0trxoir nudlm elncta() rtmum oo4alx iictadfmDea( onu)arxnxr3todfaDrli i;(0srxo(opnydolen ivi ()aDtmxmp;t1oetoif3iadfa2ea( s;t)trtoxocoydlpDrli o t0srtr(r3iy1ol nliet t) 2uaxmpno0olxoii3ias s rauvo;t) leoio ia1fat livi s)teto(r3oodalenmfei sf 2uax oou4oetoifeiatlmDemumo u4treoif iy1lmDeauvs (0 exrxr oodame mfes s) 2uau  ou1oetnii3iyt m ua( p u0teerifctytlaD aieo (0 exoim ny4lm e fesl( sDum(rpnt1alxnmo3ild s2elums t4trxrxfcto1fm   ivs t0trumxmpnudlpte ieil(fsDraxrpno0tpx mfeildlsDuln sn(0tltoxoctodfpDrli o;s)seto(o ou4lp nmneilt sruru p;o1alx ioeiyslaDua(monu4tlxomr ia1laD  ieilt) exrxr oydalt mfcil( a2ur( p;u0aleo fcildfmDul(mo u0arxrircoo1laDr u s;() 2umxm3nu4optnmncs (fa2rrum ;o0oeeomfciyt mDumnmp;u4teenmo3io1fp rai ilt  2trxr oy1ll   nvi t artrxmo;o1alxniictlt a umu p ()tetnxo3ta1faDeliesl(0 2uoxmpiy4ap  mivsas srum(rooo1aexo i3tysfa ra(msnu)alenir3oo1fm rau s s seum(m3nydale  nvsatf 2rmxr ;o0aexo f3iad sDrl( o u0 rxoxf iy1fm  lu o t)seumimpiu4optnlietl(  Dtr( oot4apx if3iadfaDrlnmo;()aeenmfciy1lmD  nvilt trumim3iydllt lnctl(fsrtrumpnu1apx  ictysfmDemnvp;()treoxfcoa1omtrau i;( tetrimpnydopen nctls srrauro;o4tet ifetlsla ul(mo;(0alxomf ta1fm rln s;( t2tmir3no1apeemfeslt)srtmu  ou0optn i3iasfm ulumo t) reoiocta1fmD luvo t0truoxo iy4omenlfctls)a2trumonu4aexnmf3iytlaDeln o;() eenif oa1opD  ues;t0teum(mpoy1ol   nvs () rtaxm ;u1oee mi3iad mDulu s;u) lenmfcoatfa  lnes;s0trtr(r oydap nmfvsasf Drrxmpot4apen o3tydls rlnmp;u4trenmfcoo1lpteln o ()s2xm(m io1ole mfes sfaDtm(  nt1olenmf3tyt a2rlnms;t0trenmociatlm ran i;t texo(o3oodomee ivtls)a2rr(mooo4tee iietys mDuau s;u0aetrxr todoa  luvilt  euo(m oy1optnmietas  2taumonu4oexn ieiydfs ul(vonu4aeerxfctotfpDeaivo;s0 euoio3ny4amt mfctlt srraur ou4tpxnio3tasfaDem(mpnt0trenio oytlp   nvo;t seurxr3no1lpe  ivt t) rumxmpnt0oeto i3tytls2elnms u0aexomr3oydop rau o t)s2xoxm oo1ol   ivtl(  Drrxrpoo1oex  ictldla2eluvp (4tleoxr iodfmt li il( s2umirpnu4amtn ncta(fs2ta(r no4tetnmfetlsfaDuln s;t4 exrxr iytfm e ieol( sexrxo3iudlleelici s)aruaurooo1tlxn f3iadfa2rmumo u0aexomr3to1fat  ivols texmxr oo4al elfcta()arrmur ot0tle moetysfaDeanvo () reomr3oa1lmt aivslt0trtmir3nodomenmfcsatf Drru  ;o1teeoifciatfsDumumpnt0teeoir3oytoatr ueslt)srtr(o3iu1alenlfcsa()arumur nu1tptniictasfs rmuvp;(0teenxf oatopD anvslt0setrxmpny1lptn iesatfa2taumonu4aexoiiciytfm2rl( s u)teermf3iatlpDeli i;t)t2xrir iu4olen fetl(fsDtax onu0opxn fctasla2eauvs u0aeerxf3iadlp raues t)srxmio3nudolenlnetlt)sDumurono0tle mo3iltlm eaums t) lenmfcto1omDeaues;t  rur(o3no4ap nlivs tfarurxmp;u0tpeomo3tydfs ea( o t0 etomf3oatlp e ivi;t)trur(o3nu4amtemfetl( srrru pnu4oltoiieils s2rluvs;u) renmr ta1faDr u slt s2tmir no4ame  ivsasfsDtr(r ;u0apt  o3ilsla umnmonu)aetnmfctytfa  au i;s0 2toio no4lpe lnvsatf 2uaxm ;t1oexomo3iltls2umnmont0arxoxociodlp eanvi;t0seur(mpnu1lptnlfct sfa2urxrpnt0oexo i3ild a2rlnmo;t4tetrxocto1laDe n o;t t2xoim iodop nmfciltfaDra(r ot4teeniictydlaDrau p t0arxrxf3to1lpDe uvs;(0teuoxopou1op n nctas) 2ua( o;o1tpxoiieild s umn pn(0trxnxrcio1lmD livols0 eur(opoydol n fetat)srtrur oo0ope  ieiasls2uln s;u4teeniociadlmDean i s)t2umir iudlmenlfctlsf rtmumonu4aeeo ocildfaDua(mo (0alxoxo3oadlmteaueils0trtoim3iydoptemiei s  rtmuroou0tlenmoeiltfa rlnmp;(0altrioctytfp e u s t)teumxr iydomtemivt s) Drax p;u1opto fetasfm2ul( p u)altnif iy1fp r u ols)teuo(r ou1llte fetl() Drrxro;o4oet  oeiyslm2ea(vs t0teerxf oo1optraivols0 rtm(m3oydlmeemfcilt a2rm(m nu4alxn ieiyt a2uanmo u)arxrio3iadoa ean s;s  exmxo3nu1lptemicsat) Dtax p;o0aet iietytlmDuanvs;u0arxrmf io1oaDrluei (0 2uoir3ny1optnliesls  rumx o;u0apxoiictld aDul( p;t4aetoif iodlaD ai i;( sexr(o3ou4op elivilt)arrrxrpnt4tptomfetlsfs2el(vp;u)alermr oy1fmDe nvi s0srumxo3oydolenmictat  rumu ooo1aet io3ilt m2rl(mpnu0aetrifciodlaD lu s t  2umxm3nudolt lfvs tfsruau oot1tptomf3tyslmDul(mpn(0arxrxo3oa1fmt lnvo;s s2xoxopny1lpte fci s a2tru pnu0tpeomfciydlmDeln o;(4arxoio to1lp eli s;t tetm(m ny1lmt lncs ()s2ur(mo;t1opt mfetysls ea(mp (0aleoir3ia1opt  n sls)trtmxopou4ol  lfcs (faDtr( pnu0olxnmieiadfs2elnmpnu)tlenir iotoaDe uvsl(  etrim3iodlmen netas s2taxmoot0tpeoiociydfa2ua(vo;t)treomfciadfpDr ieo s srtmir3oydapeemnvsl(f rrax pnu4oet ifctasfm elnmp;u)aetomociodfm rluvo;(  2xmxr3oudlmenmnetasfarrr(m nt0tleoioctyd s2umumo t0texomf oatlp elneils  rtoim ou1lm  lfvslt s2tmu p;t0optomieildlm2emnmp u0arxrio3iatopDrai i;s0 etoxopnodll n nvsls sDumurpnt1tptn oeilt m2ea(vo (4artomociy1fpt li o t0s2um(m ou1lltemfctls srrrxr nt4olxoifeiat m2ra(vp u0arerif3ty1opt aies;s)setmir3ny4lleemfvs (f 2rr(mp;o1teen fciadlm umu s;t0 eeoxr ta1faD an o t trxm(r oo1apen icta( s2ur( pno0tle iicias aDum(mp;(0tlxrmo3ta1fptraivo ()t2xmir ou1amenmfct ( sDur(r nu1apx iociydlm ulnmo;u0tltomoctytlm rln o s tetmio iodoltemfetl(farra(ronu4opto i3tltlm2emnvpnu0altnmr3tydfaDelnvo;t trtm(r3iudame mici t  Dtm( oot4tptnmoeiytfa2rlnmsnu0aetnif3ty1lp ran slt seuriopoo1lme mnvta( a2tau oou1olenioetlsla2uln snt0tlxrio3ootoa ean s t0 ruo(r3nu1aptemneia(fsDtmuro;t0aexomo3iat s rl(vsnt) renxf iadlm rlies ( seumxr3no4olee ietat a2urxmpoo0opxn o3ias s2em(vs;t)areomr tytomtrln olt setmir ny4lmtemnvtl(  Dta(roou0aex moctlt aDrauvs t0tltrmf3tadlmtelneo;t s2trxmpnu4al nliciat s2ururpou1texoifctadlmDuanvo t0tlenxr totlptrai s () rxmxo iudomtelneslsf Dtax p;u4alx  octld mDul(ms;u4 reriocta1fa rai s s)texrio3oo4omeemfvt sf 2trx pno1olx ifeilsla2rm( o;(0texnmo3iy1oaDr ieils0teum(o3iu1lptn fvtls aDtr(mo;t4olenmfetasls2emnvp;(0tlxnmrcoadlmtrluvo;t trumxopiu4opt licsl( sDurxrpou0aeto fciyd sDuanms u0 lerxo tatfmDrlneo t0 2tmir iydom nlicils srtmx  nt4tltoioetydfaDrlumonu4tetnxf tadfa eanvols0t2trir iy4amt  nvta( srtm(m ot1aeto oeiyd a2um(mpn(4artnxr3tydoaDelu ol( s2uo(m iudalt mfcs ( srumx pno4tet moeiydfsDua(vsnt0altoif3oytlpDrlivs t trumxr3iydomeelicslsfs2ra(rpnt0texniietydfs2rmump;t)teeoif iadla   nes t) rxrxr ny4oleelnvia(f 2urx ont0apxnmo3tatfaDeanvo;(4aeeomrctodlp rlies s teur(rpnu1ol emfvias) rra( o;o1aet  oeias sDelu p;()aexniociatlmt an o t  2urxr3nudll   nci s)aDum(ronu4opt moeiad sDrl(vonu0aetoxociadoaD  ueo;s0t2tmxr iu1ap emfeil( a2rmur nt0aexn feiydls2rlumpnt0 lxrxr iytfa e uesl()trumiopou1lptemics s)a2truroot1aet ifetas mDem(vs;u)trtrxf ia1lm ean sl( s2tr(o oy4am nmnvi (f Dtax oou1alxoio3iysls rmuvpn(4teerioctytop elnei;s0t2xr(o no4aptn nvs t s2tru pot4ape mietyd a um(vsn() renif oatlmDranvolt0sexoxm ny4ole mietas)a2rm(m nt1opx if3iatlmDranms u4 rtrmo to1oateaies;t)trxoxo3ny4omee iesa(fsrtax  ;t1texnmoctltfm2ul(ms;(0arxrmr3oydfa r ieo;(  exoxopnydape micsls) 2urur ;t4oee  fetltla2emnvont4tltrxf3ootfa  lu sls tetoxr3ou1llee fcs s  2tm(  no4teenii3tltfaDean s t4alxrif todfmt aueilt t2tmirpio1ape mfet t  2taxrpnt1tltnmf3taslaDrmums (4texomr3todfpteaieo t0 eurxmpio4ameelnesl( s2rm(  no1opxnii3iydla eanms ()aeeomf iodfm  lueol(0 rxrir3nu1alt  netl()aDua(rpou1texomi3iyt s2uln s;t4aleoir3tatopt  n o t)tetoirpnu4om   iesas)sDtrxrp;t1oet iieiltfm2uan s;t0 etnmf3to1faDraivils0seumxo3iy4ame mfeilt aDumxront0tex  i3iltfm2rmnmsnt4aetrmo3iy1fmteluei t)s2xoir no1omenlfvias artaumo;t1oet  octasfa ua( s;u) lxnxf tatlmte i o t) 2umxm ny1al nmncia()srurx pot1opx iictytlmDeln p;u)texrxo3oodlmt luvils) rtrxrpoodaleemnvsls)aDrmxmpnu4oetnmfetas aDem(mo;t4 lxoxr3oytopDe uvilt) rtriopiu4ale  fcsl(f Durxmpnu0tlx mi3ilslsDrmuvsnt)areoxociotfpDrau s s  2toxrpiy1alen iviat)artmu o;u1ole io3iydfsDeanvo u) eenmo tatfp eaneslt)s2uoxmpiydol emnet sf 2trurpnt1apxnmo3iytlmDel(vp;u)tetrxf oy1omteauvi;()trxmiopio4lpenmfetltfsDtrump;u4aetnmfcias a2emnvonu4trenmf to1lmDr i s;s trur(o oo4ol nlivia(fsrrrxrono0tlenifctydlm em(mpn(4tetrxr iotopteai ols0teto(rpoo4opt mfvtl(fa2um(r no1oetoiieiysfsDuanmpnt)aeerif3iadoatraueslt0texo(r3nudoltnmnci t)a2uru pnu1tpxn i3iatlaDumumont4aeerxociatom e i o s srto(o ny1alen fcta(farraxr ;t4tleoiiciysfm ua( pn(0arxnxr3todfptelu s () 2toxo3iy4oleemncsasf Drrx onu0alxo oetatfa um( sn(0tlxnxr ta1omtrlivsl( tetmxo oy1lme lfesa(f Drmum ot0apx io3iadfm2ua(ms;u0 etrxf3iy1lp e ueo;()sruoxr3no1aleeliesat)arumumpno0tpeoif3tat s emuvo t4texoxr iodfatelnvsls0 rxoio oy1om   fes tfsDrr(mpnt0tptnioeiyd m2elump (4tlxrif3iodomtr ues s t2urxr3nydll   fvi sfsDtrur nu4tleo octytfaDem( o u4aetrmfcootoate nvsl( seurio3ou1altn ieia(fs2uax  ;t4aetoifeiydls umnms u) eerxr oytfaD aivs t t2toimpny1alt lnesls  Dtmu pno0tlxomf3tysfs2ul(mp u)artnio3iy1latean o ()srtoxopou1optelfci tf 2umxr ;o4oeenmf3iatlm eanvs u0 rtrxo3oytlm ranvi s) eto(rpno1llenlnvtl(faDrmu ooo0oleoioeiys m2el(mpn(0tlxnir oatlmDe i ols0 rxoxo iudlm nmfctl(  Dur(r ;o4olx mietasfm2rauvp ()tlxnir tydlaDelueo t tetr(r io1lm emnctlsf 2rmu o;t4aexniociydls em( p u4 exoirctytfpte nvilt s2trxr3oo4lm  livslt)srur(rooo0texomi3tad s2rluvs;t4 exrxf iodlpD anei;(0 2uo(opio4open fvil(f 2trx  oo0tpeo iciys s2eanms;t)alenio3iadfpDr i i s) euoxm3nydal nmict t) Dtmxm ot4alxomiciydlm2em(mo;t4 renxo oy1fmteauei;s0t2tr(rpiydapen ieiasfaDtm(rpnt1olto f3iyd a elu p;t0altrmr iy1oate ieo s) 2tm(m3nu4ll  mfcilt)a2ur(  ;u0alt ifeiasfsDemu s t)alenxocoytlaDe u ol( t2xmir ou1ape mnctls srtr(mpnu1olxoiocils mDra(vo u0arxoir3oydla  anei;s0 2xoxo3nu1alt  fetat s2tau p;t4apxoioctyd s2rauvp;(0alxomo totlm   nvo;s srum(m3no1am elfvtltfa2tmu  no1oleo ietyslm2emumsn(0tetrmrcoytlm  an o t0s2umim3oy1lmt  fvs t s2tr( ont4ape  ieils a emnmp;()tlxrmocoydfpD lieols  eum(mpny1om  lfetas)arrrum no0tlxomieilslaDuluvpnt) exnxr3iydfpD  neils  rxo(rpiu1altnlivsl(f 2trxm nu4oetomicilslm rmu p t)tltnmoctydfm e ieilt0s2uo(o3oydam  mietlt)sDrau oou0aleomfctysfs umn on(0 etoxr3iatom rlueol(0t2urim iy4ame lnvi tfs2taumooo0tee mocild mDra(mpnt0 renxfcoo1oa e u s s0srtoio ny4opee iesasf 2rmurooo4tlxn f3iydlsDumuvs (4alxrmf3iodopDeln ilt0texr(r io4apenmfvtat  Drm(rpoo0olxn icildlmDem( pnu0 rxnxrciy1oa rlu ol() rtrxo nydlltn ieslt) Drm( pno4aex io3ilsfmDuan o;t0tetnmo3oadfpDrlivi s seum(rpno1omt  feias sDrau  nu4tpx iiciasfm2ra(ms;u)aeerifcoadoa rau o;s)trur(rpiy4am e ivs tf Drrxmo;o4apeomoeiltfmDra( o t0artrmf3oy1fmDraivi;(  2um(mpoo1ameemfvi s)a2tmxr no1tlx  ociysfmDemums;() eerxo3oodomt  n i;t0teuoim oy1oleelncs (fs2urxm no0altomociatla2ea(mo;()artnxfctadopt an slt)teto(opoodlp  lncil() rtaxm nt1teeomf3ils sDul(mp;(0aexrirciotomteauvslt)tetr(m oo1ome  icsls sDurxmoot4tle  fetysfa2uauvo u4trxrir oa1fptraivs ()srumxm oo4lp  micslt s2tax pno0aexomfcildfsDumu sn()aeerir3oa1lm rlnvolt) rxmirpoy1op e fvta(  Dtrx pot0tex if3tys mDum(vs;t)teeomr oatlm  li i;s)teto(m3iu4lpe lfcilsfarumxm no0aee ioeiyd aDum( o u0aleoif3to1oaDeaies (0s2uo(m nu1ole mfvt t  rtrurpnu4tet iociytfm2ul(vs t0 exnmf3oytop eanvs s t2xoimpiu1oltnmfetat arumu pnt4alx iociadlm2emu pnt0aetnmfcoodlaD aieo;(0 rxr(o3nu1lmeemnctls) 2ua(rpnu4oex mietatlmDeln p t4treoiociodfa r ieil()s2toir3iodal   ieilt s2ra(m ;t1tpxo ictyt m uau o;u0trtnxf tydoateanvi;( tetrir oo4ol n net tf 2ua(mp;o1opxomieils aDemump u)aetnmf oadom eli o (0s2xr(m iy1lp nlnvtat)a2rmur nt1tpen fciltlaDrl( s u4tlxnmf oytlptrlnvo t  2tmxo no4lpeemncs t sDum(rpno1ape mfcildfmDem( sn(4altnir3tydlp eanes s0t2tmxmpiodoptnmfcsltf Dtax  ;o0tlt ifcildfm ua(vont4 eenir oy1lmt anvs s0setrxo oy1amtnmictas)aDrr( o;u4opto f3iad a2umn p u)teeoxo iytlaDr i ils) 2xr(r3iudam nmicilsf 2taxr oo0tpe moetadls ulnms;t4tltrxo tytfa e nei t0s2umio iy4ol elivsat  rra(mpnu4tlxn iciys m2ua(msn(0 eeoifcoydla eaivs;t0tetm(o iydope  ncias)a2rru  oo4oexo i3ilt s raump;(0tlxrmf3ta1laD livs (0t2xrio ny1lptelfei (fs2ur(rono0opxo fciadfs um(vsnt) lermo3tadoateaneo;t  eum(o ou4alee nvs s) 2trurono0oleo ictldfm rln p u0aeeriocoatfmteauvs;( t2trio3nudam elies s  2ta(ro;t0aeeomfctydfm umu o u0teerifcoodfmtrlueil( texrxrpny1lmeelicil()aDrrx onu1aexo ieiad a2um( on(4tleoxr3tydomD ln i s)s2umxm nydlme  nvtasfsrtrxrpnu0alxn ieiys mDrm(mp t4texnmfciotfp rluei t0s2um(m iudop nmics s  rur( pnt1oet moeildfs2emn p;u0 rtomoctydfate neol(0sexrxrpno4lmt liviatfsrrmur ot4tex ioetytfsDrlu o (0teerxfctotlm   i i;t s2tmimpoy1ameelnvsatfaruaxmpnu0ope mfctltla rl(vp t4altoxr3oydfp   u s;()setr(r3oudome lnesl()a2ta(ro;o0oexn ieias a2rmumo;()trtomo3to1fa eanvsl(0 rxrir iy4lp  mnei sfsrur(rp;o4aetn o3iadfmDul(msnu4altomf to1laD  uei () exo(opny1omeemiesat)aDtrur ;t0oltoif3ild m2rlnvp t4 reriocoadfpD ai sls)s2xrxm3nu1aptelfet s)a2raur no4oee mf3tld a emuvp u)aeeoir tadoaD  nei;t) 2tmir ny4ape mncsa(  Dtmump;o0aeenifctyslm ra(vo;u)trenif3oodoptrlnes;(0s2tr(rpiy1ap nlieils)s2rrx oot4apeomieiyslm2uau s u4trermo iodoatr i s;s) 2to(mpny4altemivt s srtmur ou1ale mo3iad aDum( pnu4tetnmr todopDrluvi ( s2urxmpoodlptelnvtas) rra(  ;u1altoiietlsla2elnvp u0 eermo ta1lm  aivs;t  exmiopnu4ol   nvi ()s2rmurp;t4tpt  i3iyslmDemn pn() rxoxf oatlaD  ueo s srtm(r3oy4opee ivs tf 2raxmpnu0ole  fetatfm2rm(vs t)aetnxocoydfptraieilt0 rtmxopoo1opt lfesa()aDumumono0opto iciat a ua(vp (4 exnxo3oodlmDelnvs;t)sexm(r3nodamtnlfct s s2rmu pnu1oltn f3ilsfmDuluvp;u)tltnmo io1opD lnvolt  rxmxmpou1al  liet () rurxmp;u1aexoifciydfs um(mpn(0treomr tatomDr nvo;t)s2xr(r3iydalt mfes ( arumum ;u4teen feildfm rl( o;()tetrxr3iy1fp rai s;t  ruoxrpnu1lleemnvtls)aDtrxmp;o4tlen oetys a2umums;(4teenxrciy1omtelueo t)trxrxo oodllt  ics s  rrm(m nt0oetoifeils a rmn p;(0trxnmr ty1lpt lnes;()s2tmxo3iy1om  lnvt sfa2trxmooo1oee iiciyslsDemnvont4 lerxf oadom e n s ( trurio3iodlpe lneiat)aDuru p;t0tee  fciyt s ua(ms (4 lxoxf3tydlpDr n i;t s2um(mpio1ll   fcsas)aDraxrpou4opx  oetyt m ranvo;u)alerxr to1lateanvilt  2xrxo no4lm nmfet ()a2tr(r ou1tpt  fciatls2em(vo;t) etrir3iatlpDrlnvo ()teumxo3nu1altemnvsl()srta(r ;u4oeeoif3iltlaDea( p t)trxnmo iydlm  lnvi s0t2urim io4apeemnetltf rrrxrooo0aexo f3ilsfs ran p ()tetnmr3todfpD  iesls0t2xr(rpoo4lpte fvia()s2rmxm ou0tltnmo3tytfa2um( o t0teeomo iatla e ies ()srum(o oo4lmt lfvs s)arrr(  ou4texnmoeiat s rmu pnu)aeermfctadomDeauei (  2to(r3iu1lp  mfes ( sruau poo1alen fetlt a2rm( p u4tetrif oadlmtrln s;s trurio3nu4apen iesat) Dumx o;o0olen iciydfm rl(ms (0 rtnmo3tytlat ln ils trxoio io4lpeemnviat  Duau  nt4texoioetadfsDulnms t)aetnir3oadlmDe ivil(0t2um(m nodaptemnvias) Drm(m oo4tle  o3iysfaDrau s t0 leomrcty1lpDeai o s)t2tmio3iy4lltn ivta()s2taumonu1ale ifetatfm um(von() etnmf3ta1laDranei;( t2xmir3ny4olee nei s)a2rm(ro;t1oleomfctas a em(mp;u4 etnifciytfpD luvo;t  2trimpoodoltnlnctlt  rrax o;t0tlxo feiadlsDrlnmsnu4 ltomr iytoa elu i;s0sexm(m nu1lmt mnciatf rumu  ot0alenmfeias a2rlu s t)alxrmf oodfpt aivslt0s2umio3oudaptnlnvtlsfsrtmumpoo0teen octldls2um(mo t0texnif3iytlpDrli i;() 2toir3ny1llenmivtlt aDua(mp;t1oex  ictyslmDrau snu0 etoio iotfm rln o;()s2xmio nydap nmfvi ( aDtax o;o0oetn fciadfa2rln s (0teenmf oo1laDr ues;t0t2to(m iy4ol   nctltf 2ra(  nu0texniieiytfm rauvo (0arerir ia1fatr neo;(0texmxo io4ll emfcsl(farrmu  ;o4tetnif3tld a2ul( p;u0treomr3ty1faDelu o;( setm(o3iu4am e icsat) Dtmxrooo1aptn icilt m2ranvonu0tetriocoy1late i s s0trxrimpiy4ale mfvi (  2rrum nu4oeeomf3iys a2rlnmp;u0 rtnif3oydom rlu slt) etmio3iy1am e ivs s)s2trx onu0aexo ociytfa elnmsnt)aetnio3tatoat au ils0texoxm3oy4al   nvt (  2umumpot0aeenifeiytfmDrmu o;u) rtrmfciy1fm   neo s s2xr(r3ou4amt  nctlt) 2tmxm ;t1aeen f3iytfa eanms;u4teeoifciy1fmtrauvo;t)seumxopoydlptn fes (faDtmurp;t0texnmo3tyt s rlu pnu4alxoxr ootom rlnvi;() 2xr(m iydap e fvs t)a2trxmoot0tex mfcilt s ulnvp t0tleomo3iodlmDr u o (0t2um(opno4ol  lfcia(fs2umu p;u1tetomictyd s ua( snu4aetrxf todlatrlivi (0 2xo(r no4opee feil(fsDum(r ot0apenifetytlmDeluvsn(4alxoxr tytomteau o s s2uo(o oydam e icsl()s2tmxmono0tpen iciltfm emuvont4aexnxo iytla r ivo t)trxrio3nudlmenmictlt s2umu p;o0olt  f3tldlm2ua( s u0 renif3tatom  aivs;s setrim3iudomtnlici s  Dtaxr ot4aexn ociytlm2uln p u) lermocoy1fm   ies (0 rtmxrpou4ole licias)srurxm ot0apen ieiaslmDrlumpnu4 rxrmo3tadlp r uvo s0s2umio io1am   fvs t aDtrurpot4oexo ictlt m rm(mo;() lermf3to1fa rauei ( sruoirpiy1omenlnvs sfs2rauroot4oet  ieild aDrlnmo u0aeeomr3tytfmDrlu s t) rumirpoy1apt  ivta(faDtauro;u1texomf3tasfs2ea( p;t) ltoif3oydlmDeaies;(  euoir3iu4olt mfes s  2um(mpot4oeen iciydfmDuauvo;u0 ltrxocoydlmDr i o;s truoxrpny4ll   neiasfs2tmxm ;o0aptn oeild mDemn sn() lxrio oodlmDe u olt0 2toxmpio4openmnvs (f ruru o;u4tpto ieiad m2rmn ont0trenmf3oo1lptelieslt  2xrxo no4alen fet t)srum(r ou0apenmo3iadfa2umnvo;t)aetnif3oadoa raneo;(0 rtrim ou1ol   ivsl() 2tmumo;o4tpxomoetys s rm( s;t4tetnmfcia1fmDrauei ()t2xm(m nydoptnmfvi t s2rm(root1tpe  o3tltfmDem(vp u0teeoxrciotomDean s;s)trtm(m oudlltnmfviat  rraump;t0optnmf3tytlmDranmsnu)arxnxfcty1lmDe ieols)trurxr3oydamte nctl(  Dum(m ou0aeeo o3iadlm2elnms;u)alenxociatom r ues;(0s2xmxm io4al  livt ( a2uaurooo1teeo octatfs2ean p (4tlxnio3to1laDeli o s trtrxr3ny1amt lfcta(f rrrxm ot1tlto f3tad a2rm(mo;() rtnio ootoa ranvsl() 2xo(r iy4lle mivsa( arrmx  nt4ale mf3tytla umn on(0alxnmr oodlateai i () rtm(rpny1ol  lictl(f 2raur oo4optn feiydfm ranvo;t4arxrxocoytoa ran i;t srxo(o oy1aleelneia(fsrum( pot0tpt iiciasfa emums u0arxrxo3oytfaDran s (0texoxo iydope  ivs ( srum(rpoo0aet mfcild s um( pnu0 exoio tydfp raies;()s2tr(r ou1al e fvs () 2urxrpoo0oexnioetat m2eaumo;()alxnio3tytlmD  u sl()sexrim3no4alt miei (f rurxrpnt0aee  f3iasfaDuan o u0arxrxf3ia1lmDrliei;(0 etrio3no1lpt lnvs (f Durxroot1ope ioetytla2uau s (0 etnir3tatlmtrlneo;(0s2xm(o iy4al nlfetlt sDua(r ;o0tetn fcias sDuluvpnu0 lxomr3oytfptr uvsls sexmxo iudopt mivias) rrrxrooo0teenmf3iltfmDul(ms t0 etnifciadoa elu i;( srxm(rpno1ameelfcta(fa2rmx pnt0ope ioctytfa2uln pnt0arxnifcta1opte ivi t)teum(o no1lptnlfctlt)a2tr(m no0aexo iciltfm2raumont0 rxrxr3tadlm rli o;( tetm(o oo4altemivt (f Drauroou0oltn ieiysfmDeauvo;(4 rtrxfctatfm   n s t  rtrxm io4om  mfes tf ruaxr ou0tetoio3iysfa uau s;()teeriociatfmDe ivi t s2trxm oo1ape  ietat a2rmurp;t0aee  icilslmDeanmsn(4 eeoif3oatfa   n o;t0 etoiopoy4lpt  netl() Draxm ou0olt mi3iad mDelnmp;(4tltoxf3iydfpDeanvs ()s2to(o oy4amtn ictas)s2ta(rpot0aetnio3tadlmDrmuvp;(0trxomociydfpD lnvs ()s2xoxm3oydom emnesls artr(mp;u4aexomieiasfa em(vs;t4artrio3tydoatelnvslt  ruoxr oodll nmnvtasf rtru o;t0tptomi3ilt s em(vo;() rermf ia1lm eliei s0 rto(opio4lmte iesat artmuronu0aex ifctltla eauvsnt4 eermocoa1oa  an slt)sexmimpiodop emivia()artmu  ;o4tlxo fciyt mDeanvo (0 reoioctodfa rlu i ()trxmxr oo4lmtnlfvsl()srrmur no4oetomietls m2rauvs;t0tlxoxrctydlpDr i s s) eurio3oydlltemfvil() 2tm( oou4oltoii3iasfaDelnmp;() eeoxo oo1omDe i s;()texrio3iu1lpt lnetat a2tau pnu1oetoifciyd s ua(ms u4 rtoif ty1opDelnei;(0 eur(mpny4op elfvtl(f Drmxmoou4altnio3ilsls raumsnt0tltnxf ia1lpt ln i;( s2xrimpnu4lltnlfeilsf rtaur ou0olen fctad m2ea(ms;t) eerifciadfmDranei;t setoxr io1ol emiet sfsDuaxr ot1aetnmicildfaDrluvs t0altoio3iytfate i s t0 rxoirpoydaltn nctas srraur nt4aexnmociltls rl( s;t4teeomoctotfaD  ies () etrxm3ny4aptnmici t arrru  oo0optnmieiltlaDua(mon(4trtrifcoy1omDraivsls0t2xmir3oudam   icsatf rumxmp;o0tet ioetaslm el(vp;t)teeoxociytlptrlivolt)truoim oudal elfvt t sDta(  no0tlxnio3iydlm eaump;(0arxomo3tadomDeai il( trxr(opoo4ap nmfvt () Drrxrono0ale mocils a uau pnt0arerir tydlmtelnei (0texm(o3nydolee icsat s2tau  no0aetomfctldls2emuvpnu4tltrio ootomt ln s t)seurxo3oydop elfctltfsDrmx p;u1apxomocildla eanms;u0tetoxrcoodlm  li o t srxoxo3ny4lp nlieil()s2urum ot0opxoii3iytfsDuauvsn(0trerxfctatlpDranei;s)t2xr(rpoydal  micils aDraxm ;t0tpeoioctadls um(mo;t) lerir3oa1oat ai i;t trxmimpoodlleelict tfsDrmxmo;o0tex  f3iatla2um(ms;u4 exoxo tatom  an sls0 exmim3iudomenmiviat aDumx  nt0tet mociys aDulnvs ()alenxocoadfmtrai ol()t2toio3iodomenmncia(f 2uaumpot0olxnmiciydfs rlnms t4trxrif3ia1fmD luvolt sexmio3nu1omee nei tfs2tau p;u1aex ii3iadlm uan o;u0teenmociydomtran s (0 rtmiopiy4amee nctas)sDum(rp;u1tpeoiiciadfa rlums;u) renmfcoa1oaD  neol(0teuoxo iydom nmfviat)sDrru  nt1aex mi3iltls el(vo;t)tetnxocoydfmteau o t)t2umxmpoudal nmietasfs2ra(  oo1tpeoifeiasfsDran on(0teenioctodfmt aueo;t0 rumimpno4lmenlfct (fsrtm( ono0opxoioctldfs uanvp;(0tlenxf ia1om raivi;t)setrim3iudol nlnct (f Durur ;u4aetoiieiasfs rmn o;t0tetnxo3iodomD lnvols srtrxo3ou4optnlivta( aDraumonu4tle  oeiys m rln snu0aeermfciadomtr uvi;(0t2xrxmpiudop n fcta( srrm(rooo0oleo f3iltls eauvont0teerxf3oadomteluvs;(0srurimpno4lmeemnvi sfaDurxr nu0alxn ociytfa rlnvs;(4tltrmf3oydlmt auei (0srxrxrpiu1amenlfcsa( arrauroot0opxnmoctat s rl(vs t) lxnif3iy1fate i il(  rxo(r3no4ap   icils a2um(m ;t0tee mo3tld a umn pn()texnmo3oatfaDrlueo;t0 exrxm3oudomte icsa( a2umx  nt1oexoiictyslmDeanmonu0trerifctodop rlu s ( srumiopiudlm nmietatf rraur no1tetomfciyd mDem( o;t) etrxf3todomDeanes;()t2urxm iu1amt livs (fsDtaum nt1tpxoioetlsfs2elnvo;t4 lxrxo tytopD lneolt) eto(m oy4lme lnct (fs2umxmo;t0tpxomo3tlsla eluvp;t0 lenxo tatfpt  i s t seurio ou1ameelivt s  rtmxmpnu4altomo3tltfs2uauvo;u)alxnmf3iydfa rlu i t) 2tm(m3ou4ll nlivils)a2raurp;o1aptoiictysfa eln s (4tlxrmo to1lat lnei;s0trtm(o3iodlmt lfvs ()aDraumo;u4oleo icilslm2eaums;(0artrif oytoa  ln s (0srxrim io1opt lfetlt) Dtaur ou0optoio3ild s2um(vo t4 rxnxr3iotla   ivo;(  euoim3iy4am  mnetltf Drrxrpnu0tlxo ieildfs2umuvpnt4 lxnxo oadlmDe u s (0 rurxmpiudlptelicilsf 2tmu ono4open o3tas m ua( p;u4tetnmfcty1opDr ieo;t)teurim3oo4al nmnesasf rum(mont1alx  o3iydfmDulnmpnt4aeerxo3iodlpDelueol(0 rtmir3no1al  mnci (  Dtrur ou4teeo fciysfa2emn o;(4 lxnircoodoate nes t)trtoxm oodlm  livt tfs2tm(  nt1tlenii3ilt sDulump;(4arerir3ootomteanes s  rxmxo io1lmtelncslt)srua( ono1oltn fciasfm2rmnvo;u4tetoxo tydfatrlnvols)t2trio3oy1alt  ivs ( sDtauronu0oex  i3iadls2rl(vo;u0 rerxr3ia1lpD ln o s0 exrirpou1lltnmfvi tfsDuru pno4tlxo fetyslm2rmu p;t)tlxomrcoytfpD lnvi;s)s2uo(rpou4oltelivi s)s2rru pou0tlxniietatlaDeaump;t)arxoxoctotlptrli s;()srtoir3iy4optnlnvs s)s2um(rpnu4tpxniietatfm ea(mpn(4arerxfctotfptrli i;( seum(rpiy4ol e nvsa(faDrmxr nu1aptoio3iadfs2elnvs;t0alxnxo3oy1optrluesls  rtrio oo4apeemici t a2um(ro;t1aexnif3iytlm2el( o;(0 lxrxrciatfaDrln il( t2to(r oodlp n nvia()srrmx pou0apxniieiydlsDean p u) eenir iodlp  auvo t)setrim3ny1apenmncil(fsrurxrpoo4apx ii3tltfa em( onu0 etnmr3oodom eai ol( t2xmxo3ou4lp nlnctltf rra(mp;o0tltnioctat a2uanmsnu)alenmoctotfp ean il()tetoio iy4lptnlneils  rurumont4olen fciadlm2uau o (4artnxfctadfa e nvols texr(o3oo1ape  nvt sfs2rmx p;u0olenmociysfaDeln on(0 lxrmr totlm rlivi;s0 rxriopno4op nlfet t  rrm(rp;u1apenmfciat sDemnvpnu)texrio oa1omte neo;t)s2xoxmpiodal   fcsl( sDrrumpnu0tleoiociatlm rl(vp (0 etrio to1lptrluei;s0 rtoxr3no4ap  mieia( aDta(mont4opxo fetls mDuan pnu0 rxriociadomte neolt0 2xrxo iy4ll emfvias)aDtru poo4texnmi3ias s2umnvp;()arerxf3ta1om  ln o;s) 2to(m nu4ap elfvil() Duaumoou0texomo3iysla2eluvo t4alerir3ia1lmDe uei;t0srxm(r no1omtemfvslsf Dtru ont0ope if3iltla2rmu o;u0arermf oodomD an o;t0 etmxo oo1opt  nvt s)sDum(rp;t4tpxo fetyslsDuluvs ()teenir3oo1fmt aieo s  rurxm3io4omee netat) rraur no1oee mfetasls2eaums u)trxnmf3iatfp eau s;()trxmxr oudapt miei tfaDraxr ;t1oet  ieiydlsDemnvo;()trtomoctadlm r nvs;s0seto(o3ou4llteliesas)sDumxrooo1alx iictatlm2ul(mp t)alxoxf oodop eanvo;s srtm(o iy1oltemfvs t a2taxr ;t1tpeomictldla ranmo u4alxrirciadfmtrli ilt s2uoxo no1ap emfetltfsDtmuro;u0ope ioetatls2uluvonu)artrxf oydfa eaiesl()truoim3iy1apeelfetls a2trxm ou4altoif3iltfs ua(vo;(0aeeoxo3ta1fmt aivsls0trur(opoydll   nesa(faDrmu  ;o1tlen o3ilt a2eluvsn()alenmo3iydlaD an i ()teto(r nydal nmncsas  Dumu  oo4olx ifctlt mDrluvpnu0aeeomocoadfatean o;() 2xoimpnu4am elnes s s2tmxmp;t4altoio3iltlm uanvpn(0altomf3todfptrauesl()sruoirpoo4lm  lnei t sDrmx  ot1opxoifciyd m2rlu pn(0aetnmfcoydfm rau ilt s2uoxm3iodlmtnmfctls  2tax  nu0oltnif3ild m ea( pnu0artrmocoatfa  lueolt sruoir iudapt  neilt)aDrru onu0alx  f3tydfsDrauvon()treoif3ta1lmtelu i (  eurxo iydol  mfes sfsrtrx p;t1apeomoeiytfa ea(mon(0 rtomr3oatoa r u s;t)s2urxm3nu1apenlietls)aDurxrp;t4aeeoifetatfaDrln p u0texoif to1omt aiei;s)t2tr(opnydomeemnciasf rtm(mo;o1tex  o3iaslsDeaumsn()aexoxf3iadfpDranvo ( seurim nodlle lfvia(fsrurxr ;u1olt if3ild a el( pnt4trtoxf3oydfmD  neil(0 rxr(m3iydoleelncta()aDrm(r ;o4opxo o3iyd s2ulnvont4teerifcoodlm eaues t) rxr(o iu1amtnmnvia()srtrxm ou1aetoiocild s rlnvo;t4 lxnmocootfmte ies;s t2xrxo oy4om elfvilt)s2rau ont4opx iiciydls2eanvp u)tetrxrciotop  lnesls0srtr(r3io1op  lncs ( aDtm( ont4apxn fciltfs rau p u0 lermr oytoa e u i t) euoim3no4omte icias)a2tr( p;t1tetomieias m emuvsnu0 etnmrcio1lm rlnvs;()tetmim3ny4aleemfvia(faDtau  oo0olenioeiadlm2uanvpnu0trerio3totomDrlivols)t2trxo3ou4opee ici s)aDumx oot0aptoioetysfmDranvp u0aeeomf io1lateluvolt  2tmxm3nydapen nvi t) Dtm( oou4optoifciasfaDrl(vo;t4altrir io1opt aivils s2uoxr oydam n neilsfsrrru pno1tleomf3tlt aDrlnvon(0arxomo iotlaD lneo t  rto(o3oy1al nmncil( aDtrxmp;o0tex iietyt m2umnmo;t)arxomocto1oaD ln i;t s2tr(rpnu1al emfctl( aDuaxmpnu0apenmi3iat s rmnvs u0trxoxo3iodfm rlnvo t t2xr(mpio4ape lfci t s2rrxrpnu0texoif3tysfm elu snt) rtnio todlpt luvo;t0tetm(r3iu1lpt mictat arrauro;o4apxo ietltfa2el(vsnu0teerxf3iy1fmtelies t teumim3iudale  neslt sDtaxrpoo1tex  ieils sDrl( o;t4tlermrciydfpt lues;()trxmxmpnodomt  ncia(f Dumurpou4texnmi3iytla2ea(vsn(0aeeomrcia1fa  lneilt) etrxrpio1ap nliciat  Dtrxmoou4tetomieiatlm2ea(mo u4 exnif3oa1laDraueo;s)trur(r3nodllenlictltfs2uaxmp;u1oetoiietas aDrmu p;t0 rxoxfctotlpDeluei;s teum(opno4lmenmnvsasfartmurono0aeenmi3ilsfs rmu o;(0aeeriocoy1fm eaivols0trur(opnodlle mfeias  Dtrumpnt1tleoiictls aDul( p u4 renmo iatlm eluvilt) etmirpio4lle mfcsas)s2rrxmo;u4tpxnmoetas m rmu s;(0teenxo3to1lmDe nvo t) 2trirpnudol   neiatf 2tr(mono0aleniociatlmDeauvp;(0aexoxfciatfmDe ueo t texoxo3ny4llenlnes s  2rauro;o0aptoiociysfa uanvont0 renmfcio1om e ivo;t srumiopiydlme mnviatfsDraur no0olt moeiyslm2ua(mo u4aetrircta1fmD livi (0srto(m nodam elfcil()srta(rpnt4tetnmf3ild a rl(mpnu0aeerxo3oa1fa r n il(  ruoxopoudap nmnvia(fa2ua( p;u4alxnio3iysfa rmu on(0arerircoa1omte nei t)trxoirpnydalee ivi (f rtau pou0ope ioeiasfm2rmnvo ()aexnmr3iadfm  au ol( s2tr(opno4lpeemnvils) 2tmxm ;t0alto ieilt sDea( ont) lenxocia1fpteaues;(0srtrxmpiudlme lici s)a2trxmooo1olxomf3ildlsDemnms u0tetoxociadla eau i (0 2um(m oodap emfci ( artmur ou4ope moeiatlm rl( s;t)aleomr3ootfpt  n ols0s2tmir3nodlleemnctls) rtau pno4oexoifciad sDrlnmsn() rxrxfctotlpD auesls) 2toim3no1oleemncta(  Dururonu4tltoifciydfaDul(mp t0 ltoxfctytlatr ivi s s2tmxm nudalt lfcsatfaDurxrpot4tpen octad s rlump (4tlxnircta1lp  li i;s sruoxm oo1lptn ncsa() 2tru pnt1optoifcils m ra(vo;(0 lenmf3tadfp  lueil() 2xr(rpiu4ll e iciat  2tmxmpot1oexo i3iat m rluvp t)aeenmo3oydfaD lnvs t  euoxrpiy1op nlfci (faruaumpoo4alto f3iyd a2elnmp;(0 eenmf3totoaDe uvsls  etoxmpnudoleelncslsfarra(mo;u4aeenmoetltlaDrl(mo;u0arxnmrctydfpD anvo ()trxrxo3ou4lm elnvs s) rra(moot1tlxoii3iasfm el(vs u0trtoxf3iydfat lneil()srum(opoy4lmeelieiltfsDrm(r nt4alx  fcilt a uan pnu4arenxo3tatlaD livolt0 2umim3iy4apt micilt)aDur(rp;o0aetn ictadfs2el(vp u4 rerxf3to1oaD lnes;s trxoxo3ny4ap n nvtlt  Dtmuronu0alx io3iytla2ranvo;t4 reoioctadlm elnvo t)seumxopiu1am   ncils) Dua(ronu1olt mi3tlt s rmumsn(4 eenxr to1lpt  uei s)seur(o3iy1omeemnct s  rur(r ot4olenmo3tltfs2eauvsnu4trxomr3iy1lateln ols0s2umio3iodlptn nvsl() Drru  ;u1alt  fctas mDrlnms (0teeoifciatlptr ivslt sexrimpnydalen fctlt  2rruro;u1apenmociys a ul(mo u0tetoxo3iadfp r n i;t0 rum(mpoudal nmfesatfsrrm(mp;t4aptniiciyslaDrmnmo;t)alenmo iotfmDrlues;s0s2tmim3ny4lle  nesltfsDra( onu4tleoiociadlm ean o;t)aeenxfcta1lmtr ivi;() rtrxmpiu1lmtnlnctasf Drmxrp;u4olto f3iydfa2ul(vsnt4altomo iydfmt au i () 2trim iu4ll emictasfsDrrxm oo0oet mf3iltlmDrl(vsn()aeerir3to1omD  ieol(0trto(mpoy4opee ieil() 2rmumpno0texnmo3tat s um( pnu4tltoircta1fatelieslt0t2to(opiu1apen fetas)a2tm( ont4tlxnii3tlsls elnmo u)tltomr3io1lmD an slt)srxr(r3oodll   icils)aDumurp;o1aleomoetls s2ran o (0arxrmo3ootlmD anvolt s2to(m no4lle  fesas a2rmurp;o4tet  octldfs2ul(vo t4alermf iatlat lnes (0 rur(o3iy1lmt  nctltfsrtrxmp;u4aptoiietltls2eluvonu4 exoifciodom ean s;s)s2tm(r3io1omeelieiltf Dum(ronu1opt iictlslmDrmuvonu)teenxo ta1fpDr i s;s)s2to(r3io1apt livtlsfsruaxmoot4apeoif3tlsfs rluvs u) rtnmocoa1latrlivi;t)teurxr nu4lpe lics tf 2rmu  ou0ole  ieiadfm rmuvsn(4treomr oy1fpt  neols) rumxrpoydop  mnct tfarrax  ot0tpx ioetldls el(vont4aeerxf3io1lpD an ols  etmxopnu4ope  fvi tfs2rmxrp;o4aet  octyt s2elums u0 rtnio3tytlpt aivil()trtoxo3ou4al emfct s)aDtrumpot4tetnmicild a2ean p ()tlxoxo3iadopt luvi;(0 rtrxo3iy4al nliesl( srrm( onu4texniiciltfaDrluvo;t4aexoio3todomtr u i s  2toxm ou1ap elivsltfaDtaur ;o0tee iieildfsDumuvsnu)altrio totopt ai s;s)t2tmio3iudlpt lietls)srur(mo;u4tlen i3tatls umuvsn(4 rxrxfcoodop e ivi;t0 eumir3io1apt lfvtltfs2umxmont1alenmoetlsfsDum(vo;t4 exrif3ty1fat an i;t0s2xrxr iu4optnlfes (faDumx  ;o1tex mociaslm uan p t4tltoxf iadlm  anei s) 2umxopiy4lpeemivs sf Dum(mpot4texnifciat sDua(vo;t4 exrxoctadlat ln o s)s2trxopnydllt  nvsls sDrrxmp;u0teen ieiatlm2emnms t)alerifctodoaDe u ilt srum(r oy1omtn ieia( aDrau  ou1ape mo3iyslaDrmums t0 etnxrcoydfpt anei;s  rtr(m oy1oleelfvs tf rua(m no0alt mf3iltfaDraums;()altoxo3todlmDrli slt teurxm3io4altelnvtas) rurx pou1oeenmf3tydfs umumont) rtnxf oa1lpt  ivo t)t2trir oo4ll emicta(f Dtmu  nt0oetomiciytls2eauvont0aleoxo3oydfaDrlnes;(0srtmim3oydope mieta(faDur( pnu1apxnmictadlm ul(vont0aetoirciy1fpDr ieo;t) rtrxm3no1ll n nei sfsDur(m ;o1aetnifciysla2umn snt0arerif ty1omteanei t  2xrio3ny1al emnvs s) 2rr(rpnt1opeo fcild m eaumon(4 reoxo3oytoat lies ()texoir3iy1amte ivsl( aDuaxmo;t4teto fciyslmDel(vp ()artoif3iatlmtranvs s)teumxr3oo1lmenlfvsa(f rtaur no0tltniictytlm ra( p;t0arxoio oy1fpD anes;(0 2xrxm oy4llt lfctlsf Dumxmonu1olx  i3iysfsDem(mo;u4aleoxrcoy1optelueolt  2xrxmpny4amee fes s)s2tmurpoo4tltn feild s rau s;u0trtnxrcoo1fmt an s;s0texoir nudap n ieil() rtrurono1tptoiietatfs2rlumo t)arxnmoctotopDrlu ol() rum(m oy4olenmivsas) 2trx  no1open f3iatfaDelnvp;()aexnio3iadlmDeli i s)tetm(rpiy4al   ict s) 2taxrp;u1olx  f3ildfs2um( pn()texnmrcootlpteaies;s sexrim oo4omtnlivt ( s2ururpnt4tptnmo3ilslm rmu o t0 eenxrctotfa   ieolt) euoxm3oo1op   icilt) rum(  ;u1oleomfciadlm2rmuvo ()altriocto1fpDr u ol( seum(r3oo4aptnlnet (fa2taxro;u1aet  o3ilsfs rmnvo ()trxnmocto1opt lues;s) exmxm no1lleemivi (f Dua(rpou0aetnmoeiatla2el(ms;t4 exnxf todlmtr iesls0 exm(rpoo4llte ncilt arrm(  ou1olenmoeiydfm rlnvp t)teerxo ta1lp elueils0 etriopno4oltnmicsa(f Drmum nu1ole mfetadfs ulu s () ltoio3tytfmteli o;t0texmxr3ny4ape mivs (f 2tr(rp;t4opxnmfciadls2rmnvp u) rtrircoydop raneols0s2tmir3io4ame mnvia(fsrtmu o;u0aeeomf3ildfa um(vpnt4 etnxr3oytlpD lneo ()tetm(rpiydal nlieils  2urum ;u1tpeomoctldlm rmnvp;(0teeoxf ia1lpD aneilt)srtrim io4aleelnesa() 2umxmoou0tlto iciatlsDrmu o (0 ltnmf3oodlp eln o;t)sexmxr3oy4am elfeil( aDtaxro;t0texo f3iasfm uanvs t4arxrxr oodla r iei s)setmir3iodlle mnetls s2rr(m nu1ole  ictltls2ulnvo u4tlxnmr3ty1fm eaiei () eumxm3oudaleemivtlsf rua(  no4teeomfetls s2ra( o (4aetrxoctydfaDelu o;t0t2xrio oy4om emivi t)s2ur(rp;u1olx mo3iyt m2rlnmp;t0trxnmocto1lpD  ivo ( texr(r oo4oleemfcia(fa2tmum ;t1tee  i3iatls2elu pnt0 lxnxocto1faD li i;t seumxr iodlle liesas)arrm(m ;t1ape if3iadfa2umn s;t4 eenmo3todoat lneo;(0s2xo(o3iu1lle mici t)a2ra(root1apt  iciydlaDrmn p;t0 exomr to1oatrlieolt) exrimpnu1am emiet ( sDra(r nt4tle iiciatlm emnvo;()arerxocoatfp   n sl( tetmim3nydameelies sfaDraxm ou4tlt ifetatfmDelumsn(4aexnir3iotoa eliei (  exo(m oy4alt liviatf Durum nu0olxomfeils a2uaumpn(0trerxr ta1opDeanvo;t  exmxo3nydapeemivsls)s2tauroou0apto fcils mDulu pn(0tleomrctodfmte u i t  2xoimpiu4llt  fei sf rrmur ;o4tpxnmicils s2rau onu0tetrxoctotlpD luvs;s)sruoirpio4aptn fetl(  rtr(  nt0tpx iieiat mDran on()aetnmr3io1lmtraivil(  2xmxo oodolee fci t)a2urxmono1aeenmf3iat m umu s ()aetrxfcootlmDeai ils srurim iydamen nesat)a2ur(rp;u1oex io3ias a2uaums ()trtoifcoa1lmDranvs t  etoxmpiy1al elivt (faruaxm ot4ale ifetyslm ulumonu4texnio3io1opDrlivils)s2xmirpoo4lpenmfesl() Dtru p;t0olxnmf3tyd m ranms (4artoxo3totomDran i t0srxrxo3iodlpenlici t) rrm(  oo0opto octltfm rlnvp t0artrxrcoatopDe iesls) eto(mpiy1amt  nes ( arum(mo;o4ale mfctytfm eln s;t4arxnmociotlp rlies (0 rxr(o3nu1ol emiciltf Drrxr nt0tlxomfctat s2umu o t0aeeomrcio1fat ai o t0srumio3oydom emicsl(f rurumpno1tptoifctls a uanmp u0 rxnxf3oytlpt anvs;s) exoiopoudopt mnesat)aDrm(mpou0teeo ieiytlsDem( p (0alermf3iy1lpD  n i t  exoxmpnu1lle lies t srurxmoou4olenmoctatlm2ulu s u0alenmr3oa1lm e nvi s  2ur(o3oy4om e nvi (farraumoou4alx ioetys mDumnmpnt) exoifcoadfaDrai o;(0srtoio io4lp  lneias) 2umxrooo4tptomoetlsfm2rlnvp u0altnxo3oy1opDelueil()s2toir nu4lmtnlncsltf rtaxmont4olxnmiciydfm emn p u4tlenio3ia1fat auvo;t t2trir io4ll nmncsa(fsrtmxmo;u1aetoifctas m ulnmo t) lenmr3ia1fate u ilt seurxrpnu4ll  mncsls)s2rrxm nt1alxoio3ilslaDrm(mp;u)artoxf3oy1lmtraieils)s2tmir oo4amtn fvsl(f Dtmx pno1tpe mietadfaDrm(vp () rxrio oy1omDeanvo;s)sexr(m3oodol n icta()srrrx oot1tlto ieiatfm rm(mp;t) ltnifciodfatr uvo;()s2xrim iodolt  nesltf Dtaump;u4ope  ietldla emn o (0 lxnir3iy1lm r nesl( trxrxo3nu1omt  nciat)sDur(m oo0texn o3tldfs2rmn o;u4arxrxo oadomt  nvi () rxoimpiu1am elnet tf rrr(m ;o4ale miciatfa2rl(mo;(0tltnir oo1fat  uvsl( t2tr(opiy4optnlfesatfs2tm(mp;o0alxnifeiad m uluvp;(0tlxoif totop e neils setoim3iudomtn fet t a2tru p;u1oetn octldfm2umums;(0 etnif3oatlpD aiei;s seum(o nu4al   nesls)arraump;o0apeo icils s2ea(mpnu)trxrxfcty1opt  ieo;s trur(m oy4am  lneilt  2trxr no4olt  ietysfaDrmump;(4altoioctydoptraivsl(  2umxo3iudal e icias  2rr(mpnt4apx  fcias m2rlnvpnt0aexomfcoy1la r uei;s0 rur(o no1aptnlnctlt)srtm(r oo0apt  o3iat m emnmsnu)tetoxf oatfat  i sls)seuoio io4alte icil()artaum ot1oeenmo3iadfa eanvs u0 rxomfcoytlpt  nvs;t  2xmxo no1lpeemfesas a2tru pnu4aexnifcils aDeaumo;u)tlenir iotfp  livil()texm(rpno1ll nmfvil(f rrrxrpoo0alxniieiltls2ua( o t4alxrmr oatoa   n s s trtmxo3iy4lmee ies ( sDtmumo;u0tpx  oeiatla2rmn s t) ltnif3totop eaieil(0texrim3iy1opt lncta() 2urxmo;t4optnmociydfa2rmnmont)aeerxfciydla elnei s) euo(r nodamtn nvsltf rumum ;t0apt ifciytfa umuvsnu4aeeriocio1opDr ueo;()t2xo(m iydlpte iesls srtaumonu1tpeoifetad m rl(msnt4trxomo3oydomDelivs s) etmim nudlpe lfeiatfs2umxmpoo1aet  ictadfsDuanmsn()trerifcoy1fa rli i;s  etoir3no4omte neias)sDta(ro;u4apx micilt s2umuvo;(4 leoxr iodopDr nvi;()srxo(o3oydalt  fesas a2rmxrpnt0tltnmieiltfaDrm( snt0tltoxf3oy1optranvil(0t2tmiopoydlp n fesls)s2raxrpnu4aet  f3iat s rm(vp u) lxrxf3tadomDelivs;()seurxr oo1amte neiat)sDtr(  ;t1oeeo f3tat a uln sn(4 ltoir3oydop rlnvs t0 2um(opno1op nlfctl(f rrr(r no1apxnmfciatfmDra( o ()teeoir ootom   neslt)t2uoxo3nydopt lietls s2umur ;o4tetnioetyd s rl(ms t4teerxo3oadop  auvi s)srxrim3nydoptelivs t)a2rr(mo;u4tleo ietlsla2uauvp (0arxrxo ty1fmDeaivilt sruo(r iudomeeliet s artax pno4oeenio3iytla eluvs t4trxnmo tytom rauvi;s t2xr(o3iydoltelnesas aDuau ooo1apto ietyslsDua(vp;(0 etomo iodoa e ieo;(  2uoxr3iy1lpt lict tf Dtrx pnt0tpenmocildfsDra(vo;(4aetoxr3tydomtrlnvslt0 rxrxm iydam elnciltfsDtmumo;o4aptnioeiad a2uanmp;u0arenmf tadlm  aivs;s0 rxrim3oudomt mfcsa( aDtaur ou4tpxnio3iatfaDumnmon(4aexrxf3oadlp eaneols setm(mpoy1apt lieslsf 2taxr ;t0teto ictltfsDran o;() leomo tatomD  u i s  2to(r3oydlm n fci (  2rr(ro;u1tet  ociltls ul(vpn(4trerxrcia1fmD  i i (0 rxoxo3no4omeeliet sf rua(m no4olx mf3iys a2rmu sn(0altnxociadoptr ieilt0 rum(o nodole mnetas)srrmu o;t0oet  fctatlm rau on(4alxnmfcoytoate u s;(  etr(m3oodap   fvsat sruax poo4aexn o3iyd m2eaums;u0trermrciydlpDrauvo s) 2uoxmpnu4omtnlnvs (fa2tmum no0oetn feiytls2ea(vo u0alxnioctydoatr ieo (  etoimpiy1omenlfct (  2urump;o0tleomfeiadla rluvs;(0arxoiocty1laDr ieo (0tetr(o io4aptelfeta()a2trx  nt4aptnmf3ilt m2umnvo;t0tleoxo to1laD aivi t sexmxopnu1lltnlneia(fs2uaum oo1ape  feiydfm eanms;()trtrxfcootlmD  nvil()srtr(m ou4oltn ncia(f 2uaurp;o0olt moeilsfs eaumpn(0aetnio3oa1omt ai o ( seuoxopnodom nlieiltf Dur(mpno4oee miciadfs rlu p;u0tlenmrcoydlp   n o t0 exoxr3nodal elicsa(  rtmur ;u0olt miciyslm um( snt4altrir3iotfpD  nesl()srumim3oo4om n ieiat)aDumurpnt0opx ifctytls rau ont0artrircoo1fate neslt seuoio3nydll  lietasf 2tm(rp;o4alxnmocilsfsDeaumo;() eenif totopteai sls) ruoxopiodamenmnetls)s2taumono4oex  ocilt s ranmsnu) rtnmf3ia1fmD lueilt0srurio nydoleemnei ()sDrrxm ou4aetnmoctyslmDrl( o;t)aexnmfciydoatr ivo;(0 rtoim io1lpenlivta( aDtrxrpoo1teenmf3tlt sDumuvo t)teeomo iadfat  n s s0trxr(r ny4lm emfvi ()arrrxmo;u4alenmf3tad s2emnvsn(4alxrir3iadfmDrauvo;s)setoxrpoy1open ncil(faDtaxrono1tlxn o3ias aDuanmo;(4altnmo3iytoa  lieols0 rxmxopnydol nlfctl(faruaxm ;u4aexomi3ilsla rmnmp t4 etnxocoadopDeauvils0 rtoio3oy1lp n ivsas)sDrmxront1aetomfcias aDelumon(0teeomocoadomDrlieo;s0trtr(o3ny1op nmivil()sDua(moou1aptnii3iad aDra( snu4trtoir oatom  ln o;t)srtr(o3ou1ap emnvt tfa2rrxrono0altoif3ilsfs eanvon(4 rtrif3ty1fpt  n i;s)s2xmirpnodom nmivi s artmumont1optn f3ild s rlu snu4teermo ty1fm   uei;s s2urimpoudlltemnesl(farua(mp;t4tlxnif3iltfs eanvonu)trtoio3iydomDr nvolt0srxr(rpiudlme  nvtltf 2trum ;u4alenifciyt aDum(vonu)aleoir3ootom  ai ilt0s2tmio nu4lltnlivi s aDtaxrpnt4alt moctytfs2ulnvs (4 etomrcootopDrli s;( seumim oodlpt lneils  Dtmuroou1aetomoctld mDumn snu)trerxociadfmtelu i;(0srxmxr3no4omen ici t) 2ra( pnu0altnio3tat a rm( s () exnirctotom   n s;s)sruoiopoy1ll  lietl(fsDur(mono4alxn oeiad s elu s;t0tltoxr tatfp eau o t trtr(r iodlm  lncsatfsDtrxrp;u0aexnmf3ilslmDulumpnt0teerirciydom raneo;() 2xo(r3iy1ap  lnciatfa2urxr ou4oeenmfcildfa emu o (4aetoxo totomte neilt  etmio iu1amtn feia(faDtm( onu0aexoiieiadfm elnmpn(4tlermr iytlmD luei t)trtmxrpiydameelietls arra(moot4aetoioeils a2eauvp;u0alenmf to1oaDr uvs;t0seur(mpoo1om   fvi (fa2rmu  ot1tex iieias s emnmp;(4aexrmf3iytlatelnes s s2tr(o oudlleelfctlsf Duaxront0aetn octlsls2ra( p ()tlxoxf3iatfmte uvi;t) rxoiopno1lp n nvtl(fs2rr(ro;u0teenmociydfa uauvp;t4alxnxo3iotlmDeanes t) rxm(mpnydam  mictlt  Dum(r oo4tlx  ociaslsDuaumsnu0 ltoxr3tatlp  liei s0t2ur(o3no1llte ivs (faruaump;u0apxomoetldfsDra(mp u)arxnif iadopDrlivs s0sexrio3iydaltnmivs s) rurxr ;t0tltomoctltfa2eau o;(4teeomfctydomD livo s sexoxopnudll  lnetls)srtmu o;u1olx  icils sDumuvo;t) etrifcoodfpD lu s;t  2ur(m iu4opt mivtasf 2raxrpoo4oeeoii3iltlm2em(vp;t) etomfciatoat ai i ()trtmiopiu1lm emfcs (  rtrx  ot1olenmociat a emumo t4 rxoif io1lmt  i s;s0 etrxr3no4ap n fes () rurxmo;u4aetnifeiytfsDuanvp;(0altnxo3tatoatelivo;t0seumirpoy4oltnlnvtltfa2tmu oot1ole iictltfaDrm( s (4artoxo3iadomt  uei s) exoxm3no4om elfvt s)s2trxmpou0tet iicildla2el(mp t) lxnxr oo1fm rluvsls0t2uoirpiy4oltn nci t) Drmuronu1opxomieiatla um(vs u4tlxoir3totla elu s;t) 2uoiopoo4lp  lnci (fsDra(mo;u0oex ifeiytla ul(vo;t)treoxo oytfmDr neols0tetrxm3nodam e ieiat) Dumumpno1aeen i3iadfsDum(mpnt0teeoxf iatfat an il()srxmim3nu4ll emict ( artm( pnt1olenmo3iat m ranvont0tetnxf3oatfmDeluvi () 2ur(opoy1lm nmnei t srta(ro;t1tpxn oeiytlsDemums u4tetnmo3oy1fmDrln ilt)s2toimpiu1ape lfetat aDra( o;u4alxomo3ilt s2um(mo t)altrxfctotlpD anvo t0 rumio iydoltemfctat aruru onu4tlxnif3tyt m ra( o u0aleoirctadlmt lueo;s)t2xrxr3oy1opte nvs s)artrxro;t4tleomfeilslmDra( p u4trtrio3iadoa elu i;s)trxrio3oy1lmtemivs t)srur( pou0oex  oeiyd a2eanvs;t0tetnxrcoatomDe neo s0 exm(m nu1lptnmnvsa(  2ur(m oo0apxnmo3iatfa2ua(mp;t4alxomf iodfmDe ieo t0sexrxr nodameelneia(f 2um(rpoo1aptn o3tatla uanmo (0 ltomociadoaDelnesls0 rxoxm3ny4ll elfvilsfartr( pou1aeenmfeiltlm2ran p;()aetomf3ootlm rau ols srtoim3iu4lpte nvs sfaDrau  ou1oltoio3iltls ulu pnt)artnmr3tatlmtraues s0s2um(mpno4apt  ivt ( a2ur(mo;t0tet mf3tadla2ran pnt0 lermocoatlp  aivo (0t2umiopiydamtnliei sfs2uru  ot0apto ieiyd aDrmnvo;(0teeomf3oodomt  i o;( srxmxrpnodaptnlivtat sDtmu  ou4olx mi3iydlm ul(vs t4 rxoiociodomte ivo t t2to(m nudop nlfeiat s2urxrooo0tet ifciys aDranvont0 eeoxr tatopD anvsls tetrim oo4amt mnesas  rtrump;u4tptnmieias m2rmnmo;t)alxoxo ia1fa   uvs t0 rumio3nodal nlnvta(f 2rrumpot0alt moctlsfm umnvsn(0treoio3tatoptean s;( tetmim no1open ncil()sDtaumpou1tet ifeiys s ul( p;u0 rtnifcoytom elivolt0 rtmirpnodop e fctas) ruax  ;u4tlt  feildfa eanmpnt0 exrio3iydlmDrlueols)teumirpoodapt lici t) 2tmxmpnt0opto iciatfm em(vo;(0tltnmrctodlpDeau ils0t2xmxo ou4ll emfeta() Drrxmpoo1oetniociyslm2um(vonu4tlxnmr iotfm e nes s0s2xoxopno1altemivsltfs2rrumono4oeenmoctls s ra( pn() leoxo tadlp raivsls)srtm(o3nu1ap   feilt s2urxmono0tlto feiytfaDrlums;()arenmo totfpt aneo (0truoxo3iy4al   nvt t) 2trumpoo1aexomi3iaslmDuan pn(0aeenxo3oo1lp rluvo t)tetoio3ou1lpeelfvt t aDtrxr ;o1oet mfciys a em(von(0texnxo3oo1opteaivi s) rxmxm3iu4op nlnet ()aDuau ooo4tptnmociasfm2rmn o;t0tetnmo iy1omt  n i;s t2tr(mpnudop elfeils)sDrmurp;o0ape ii3tytfm2ua(mo;u4trtnmr ty1omDeanvi;t)tetr(opnu4omt lncs s  rur( o;u0teeniictls a2rm(vp;t) eerioctatlatranvo s  eumio nodole  ivias  Drau  ;t0tlto fetad a rlnvp u)tleomocootlpD aieols)srtrxm3oodom n nvt ()aDuau  ou1ale  o3iyd aDul( s;(4tlxoif3iotlatrai ils0 ruo(o3ou1oltemivt t)s2uaxmono1oee  i3ilsfaDum( s;t)texrio ia1oateanvo;s  2xoxr3nydoltnlnvilt  2rrxronu4aleomf3ilt aDeluvonu4areoir tytfpD au i t)trum(o3nydoltelnci sf rtr(m ;o0tpto fctld aDeaumont4alerif3ta1oatrlneolt)trxmxopiy4lltn fci ( sDrm(rpnt0texnifetat m ra(vo t)alxnmr iy1fm  anvo;t0trtmio3nu4aptn fes (f 2rrx onu4tptoiociytlmDra(ms () etrmf tydfmt lies;() etm(o oy1apee fetatf 2rmxmooo1apxnmietad mDel(mo t4arxnmociatfpD lu s ()srurio iu4optelivslt a2rax p;u1tlxoifeilt m2ranmp (0alxoxf iotfateanvi s srxrxm3oy1omtemfesa()srtru  ou0alxn ieils sDumn ont0 rermfctydlm rlueilt)t2urimpiu4llee fct (f 2rrxm ;o1aetnioeiydlmDrln p t4tetriocootla  an sls0 rur(mpnu4ap e ivs ()s2ra( p;u0olxomfeiad a um(mo u0teenmrctodom rai o s)texoxopoy4ap nmivtltfaDtaxrooo1tltomfciytlm el(mon(0texnmo io1oaDeaueo (0srtm(o ou1ol nliesls)artrumonu0ape  oeias s rlu s t) leomrciatfp  aueo;s0 euoxo iydop e fvi (fsDrr( pno1tlx ifeias m rluvonu)alermr3ty1opDr ieolt)trtrxo iydll  lfctlt) Dtaurpnu0apeniietldlaDrluvp t)teeoir ty1laDrluei;s srxmimpnudllt  ivt s s2ta(  nt1alxo o3tydlmDelnvo (0artrmf iotlp  lu i s0s2tmxm3iodlm emfet s  rum(  ;t1olx mfeiytfsDean pnt4alxnmfcoodfm eaivi;s  2ur(rpoudop elncta(fsrtr( pnt1aee  fctldla umu snu)trtnir3ta1fpt  nes;t trtoxmpou4optemietat)sDrrum no1tpt  ocias a emnmpn(0alxrmf ty1fa rau i;( trurxo oudlm eliesas)srrrum ;t1olx  ietyslm2emuvpn(4 exnxrctytfmDran o;t0 2xmxmpoo1ame mfesatf 2umu oot1tpxoiiciysfs2eln p t0 exnxr tydfaDrau ols tetr(mpou1optnlnvt ()s2ra(ro;u0optnmi3ilt s2rl( o;t0trerxf3iy1fm r iei t)trxo(r3ou4omt mfvil(fs2raxrpou1aeeomicild s2uln o u4 exrioctatoaD aivs () rum(o iu4omt mictasfartrx  ;t0tleoifctys mDrmumpn(4alxoxo3iytfp rln i;t  ruoxm nudome livtlt) rrrumpno0opxo i3tas mDrmn o u)alerxo3oa1oat lueo;s trtr(rpoydal nlnvil(f 2ua(m oo1oltnii3iadfaDem( pnt0 lxnifctadlmt lies;t0texmxo iu1lpe mfei t sDur(  ;u1tet mfciysla2umnvo t0 lxrxr3oa1lm  anvo (  2urxm3oy1om  mnes s)aDra(moou4tee mfctytfsDean onu) lxomfctytlpt  n i t texoxm3iydlmtnlfeias) ruau ono0tpenmoetat m2rl( o;t) exrir iydoate ueolt)setoxmpiy1lpe mnet s sDrr(ro;o0tet mfetldlaDrm(mo ()aeeoxfcta1fmt au ol(0trtr(opnodamt  ics ( arurx  ;u0aexnmfeiaslm elu p;t) eeomo3tydfp e ieo t) eurio3nudlpe  fvsas a2ua(mpoo1olto ietat sDrmu pnt0aexrif3tatomt lu i () 2xr(opno1ol elivtas aDuauro;o4aetomo3tas s2ulums u) ltnmr3tydfmDeanvol() eumxm3oy1om  lfvtlt) rtm(moot1tlxoio3iad aDrlu p;() ltrmf3ty1lptelu ols0tetoxopnydlptnlnvtls sDrmxro;t0tpeomf3iltlaDum(vonu0trermocoydfpt  i i s0texmimpiodlmtnmfes t) Drr(mp;o4aet mf3iytfa2elumo t4 renxfcto1fa  luvol()trtmxr iudlp   ieta(fsDrmxroou1tpx mfcilsla2umumont)trxrir totom eauvs () 2xoio io4lm e fesl(fsrtauront0tpxnioeiltfm ran s;t)artrxo3iotlp rli ils)tetoim iudame  neilt)a2trumpoo0tltn o3iytla eluvpn()teerxf3iodlpDeaueo;s0trumxr nu4oltnlfeil( sDuaur no1aee  o3tadfaDemuvsnt0texomf3ia1latr nvi s) 2tm(m3io4aptn ncsls aDur( pot0tee ifeiadfs umuvs;()tltomrciadfp eluei;(0 2xrimpoydamt lnvtl(  rtmx o;o4teeoiieiaslaDemuvo;t4trtrmociadopteanvol(0texmio io1aptemieils) rtru  nu0aex  feiyt m rlumon() leomf3ta1oaD  n i;s)srxr(m iodamt mfciat) Dururp;u4texo oeiysfaDemumo t4 etoxo oadla e u i s s2xoirpio4al emfvta( s2trxm ;u4oee  fciltfs2eanvs;u4arxomo iy1lmt  n s s0tetr(r nudomtemfvsltfs2uaxm no0olx mfeiyd mDul( o;u0teeomr3io1lm  ai i;s0teur(mpoodlpe mfes t  Dtmur ;o1tetomiciytla rmu o;t)trerxo to1la  aivsls0s2tr(r3ny1aptn iviat)a2umumonu0opxn fciysfa emuvpn(4 etnmo3iotlm elieo ( tetmimpny1al emici s sDrax pnt0oee  oeiasfsDean o;(0tltomfciy1omD  uvs ()srurimpoo4lpenlnvs (  2tmumoot4tlen oeiadls eanvpn(4aexrif oytfmtrai i s seuo(o3nu1lm nlivsasfsrur( o;u1tpt moeiasfa em( s;()tlxnxfciodlaDe ivils t2xmxr ou1openmfcil(fsDrax  ;t0ape mieiydla2rlumo u) lenio iadoptr u o s0teum(r oy1ameelncs t)aDtm(m nu4aex moeildfa2raums u0 lerirciodlm rauvi;t0 euoimpiodol emfesltfs2uaxm no4opx iiciadla2uanvont0 rtoif3oa1la elieslt)trtmxo3oydlleemfetas)s2umxmonu0tlx mictadlm2ean o;() renmf3tatfm  ln i t0 2tmxmpnudomtn ics t  2rax ont4oee ifeiatla emnvp;(4aetrxf3ootfm rai i s sexoiopnu1om n nctlsf 2ur( o;o1apeniictyt a2uau pnt4 rtniociotopDr uvsls  rtrxrpno4lltnlivt sf rur( o;u1aleoio3iyd sDemnmonu)artrxr3iadoptrlnvi s srxr(rpnu1lpt lfcil(fsDtaur oo0texniocildlsDrauvpnu0tlxnxr3oadfpD auvs t)srtmxmpiy1oleelivt ( sDumurono4teeo fctytfsDemnvon(4tltoio oytfpD  neo;(  rtoxr3iy4op   nesa()sDua(mont4apx  ieild a elnvon(0teeoxociydfmt  n slt)srxoxm3nodlm nlnctls)artm( p;t1tetoiiciadfa um(msnu0 etrxf ootomtrlueil()s2xrio3ny4alee neiltf rtr(m nu0tpeoio3iys s uan snt0trxrmociadoptelivsl()srxmxmpnodam nlfciltf 2rm(  ;u0oexnioetat sDeau o (4altnmo3oodlp e neo t t2xoxo3io1ome mnesl() Dtmxmo;o1ope  f3iydfs em(vp;u4alxrmfctydfatraneo;(0setoim ny4omtn ivtl( a2urxmoot1alxoifcild sDrau on(4 leoio3iydlm rlueol(0 2uoir3io1lme livslt) Drr(  ot0apx mfetat aDemums u0alxoio3tydfaD li il(0tetrxm nodamt  icilt)srua(rp;o0olxoiiciydfm emnvp;u4aeermr3totoptrlu o (0setmxo iu1openmfvsat sDraxrpoo4aexniiciad aDrmump;u) lxnmo3ta1lmt ai s;t0s2to(r iu4lpeelfeta()a2trur no4olxomictat a2rlu o;t) rxnxf iotlatrln ils)s2xo(r3iu1lpenliet sfaDtruro;u1alxoioeiltlsDrmu s t4aeenxrciydoa eaivilt0 2ur(m ny4ol  mneia()aDrrxmo;t0oltnmfcias s eauvo t4alerxr to1la rlivs;t0 rto(rpiu4opte icsat)sDrr(rpnt4apxo o3iltlm elu snu4 exrxoctadfm eauvs ( trtm(r io1ame lneil()a2taxr ;u1tlxo i3ilsfa ulumsnu0 rermr oo1fm r uvi t) rtmiopiu1optelicslt)srtaxmo;t4ope mieiys m2emnvs (4 rtoxrcoy1fatrlueil( t2urim3nudlme lfci tfaDrm( oot1tltomiciat a2uau pnt)trtnxfcoadfmtrau s;t0t2xrir3iodom   ncsltf rrm(mono1altoiiciasfmDrm( 
\ No newline at end of file
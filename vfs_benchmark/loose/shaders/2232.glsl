@@ -0,0 +1 @@
+nvols  eumim3ny4lm nmfvsa(  rtm(mpnt1opxniieiysfa el(ms;u0trtrmr3io1lp   ivs s  etmir3ny4ope lict ()srumx p;u4apenifcils s ean sn()tlxrir tydfp  li ol()srum(r no1lpen iei s aDtaxro;o1aexomictldlaDeau ont4 rxomoctodlp   ivo;()trumxr nodop nmfet s)a2urxmono0alxn i3tat a rlu o (4trxoifctytlm  auvo s  2ur(rpou4openmfctl(fs2tmx oot0opx ifetltls2rmnvs u0trtoxf ootfa e ivs t) 2toim iudolte netlsfaDtrum no4olt mi3iys m2um(vs;u0tlxoxf iydoaD  i sl()texmxo oydape lictat  2ta(  no0open fctltlaDranmo;()alxrio3ty1lp raues s srtrim3nu4lpenlivsls) 2ua(  oo4tpt  octldlm2ranmpn(0 eenmo iatfpD lnvs;t)s2urim3oodale  fvsa(farumu pno0aexn i3iyslm2umnms;()alenmfcoydfmDranvo;s  etmio io1amtnmivsas aDrrurpnu0oexnifetydfm elnvs ()aetrmrcoa1la rlueo t)trxo(r nu1ap elnvi (fsrtru  ;o0tlenmieiydfsDrm( pn()alxnmr3oo1omDrlivils0s2xrim3iydll nmiciat) Dumurp;o1tltnmietad sDuaumon(0 exoifcty1fateln i t s2xr(opiydlle lict tf Dur(ronu1apenmociat aDranvo;u4 ltnxo iatlat  n s (0trurxo io4omtemfvi s)sruaxrooo1alxn ieiasfm2ua( p;t)alxrxo to1fmDeai olt)srxm(mpou1om nlnvta(fs2tmu  ou1tpeo i3tatls um( snt4 ltomr iatfpt  n s (0sexmxmpiu4lp e icil()a2um(rpoo1oetnmfetysfaDum(vs (4aetomf iodlm  livi s)srtm(r nudalt mfvsltfa2uaurpnu4teeniiciytla2umuvs t0tltoxr oytomDrlues t)tetr(m3no4am elfeilt  rumxm ;u0tptnii3ildlm ea(vo t4 lxomf3oatlpDe iei (0sexr(o3nodape  nesl( srta( pnt1tlxnif3tls s em(mp u)tlxnxrcty1oat  iei;t)s2toxm3iydlpeemieslt aDurx ono0opt ioeiytlaDulnmsnt) reoir oo1om r ues;t0 2um(m nodopeemnct s)s2rr(  ot0olto fetlsfm emnmo;(0 ltrmf3oatfaD  i ils0s2um(rpnu1ameemfvtl() rraxro;u0aexo o3iatlaDumnvs;t) ltoir iydop e nvo () eumio3nu4omtnlnctas)s2tr(rpno0tlxomi3tlt a2umuvs;t0alenir3iodlpD  nvil(0srxoxm3ou1oleelfvta() 2rrx p;o1apeoifeils a2rmu o (4artoxr3iotoat lnesl( setmir3nudaptelictatf rumur ;t0tleo i3tlsfsDrmn o;u)trtnirctydfpt  uei s tetoio3iy4alt mici s  2rax ont4optomo3iysls elnvsnt0aexrmfcio1opDe neolt) 2umirpoydomtn nct () 2trxmp;o0olxn oeild a2ea(mont)teeomo tatlaDeaueil()s2xmir io4lp elnesas sDrmxm oo0alx mfeiyd aDem(vo ()tlerio to1lpDrlu il(0s2to(r oo1ol elnct t) 2taurp;t0oex ioeilt a2ul( s;t) lxnifctatom r uvs;t trxr(o3oodale  ivtlt) rrrum ;o0tpeoifeiyd mDeanvo;t4 exrir3oa1fpDrau s;t  2xrxopiu1omtn fei ()s2tmxrono4aeeo i3tytfm ra(vp ()teeoir tatopD aneo;() etriopoydolen ieils) rtaumo;o1openio3tlslm rmu o;() etoifcty1lmDr ieslt0srtr(opoy4lp  lnci t srumur ot0aee mo3tyt s emuvo t4 etriociytfm  aueil(  eumim3ny1lp e fcslsfaDumumooo1tlxn fciad m em(mo;u)aexnxfcoydfaDraivi t)teto(opiu1ale  ietlt)s2umx p;o0tpenmi3ild a raumo (0tlxrmo oo1lm eaneo;t0srxm(mpiodlmenmnvs (  rumumont0oltn feiytlmDrmums;(4 reniociadoatelnvils trurxr3nu4lp e nctas aruau ooo0alen o3ilsls2uan s t0 rtrmf io1oatraieol(0tetm(r nu1alte fctl(f Dtmxroot4oltoiietlsfaDulnmon(0teenir3ootoatraueo;(0 rxrxm iodoltnlfes t) Drau p;o1tet  fciydlsDemu pn(0alenxr totlm ean sls) 2ur(opnu1opt mncsl(farrmu  ;u1aee moeiadfa2ulnmpnu)aetoif iotop eluvs;t0trxmimpnu4openmnvia() 2um(  ou1aeeoif3ild sDulnms;u4alerif iydfmt luei;s0tetrxopnudll n ictat s2umxronu4opeoii3ilt s2um(vonu4 reoxr3tydlaD lieil( srxmxm3nudomtelfvsa() rum(rpno0oee  ieiyd mDulums;u0aetnmr iodfmD liei;t)teurir oo4ll e fct ( aruru oou1apxomi3iyt a2ulnvpnu4 exrxo todlp ranes ()srumirpnu1am n fes s)aDrru o;u1tex mi3iyt s2rlnmpn()trtnxo3ta1lmDeau s s)t2ur(o oo4omtnliesltfs2trxr no4opeo fetltfa ulu on(4 rtomrcoa1lmDran s;s)seto(rpnudome mfctls)s2tau o;o0olxoio3iytlsDrmnmsnu0areoxr to1fp   ivil(0 rumio3io4llenlnviasfsDtmx p;t0apt  fcildlmDemnmo;() rtnxf3iatfa  aieslt)teurir nudlltelfvias  Dtmu ono1tpt iiciadfmDran p;u4tlenmf3oytfp eaneo (0 2tr(m oudoptnmfesa()srtaxr nu4olx  feiydls ulnvont4arxnxf3iy1lpD auei t)teto(m3ou1opt  ivt () Dumxroot0optnmictydlsDuln o;() ltnio3oadlp rlnvs;() exrxr oy4ol  lietas srua(rpot0tetn fciydlm2rl(vs t) lerxo ty1la eaivsl()tetmxmpio1ap e ivtas  rrrxr no1oltn fetlsfa ul( s;t4 etomo totoaDelues ( srxmxopoodllee ncia()sruru  ;o4tlxoioeiltlm2emumo;t)areomfctotfmtr nesls seuoim3nu4lpeemict s sDuax  nt4oeeomfeils m2ul( o;t0teenxo oy1om rli i t t2uoir3oo4ome mncsatfs2ur(r ot0oltn octadlmDumu p;t4tetoif3iotomDe neil(  rtmirpnudlp emnetatf rraxmp;t0aexnmf3tlslm2elumsn() rtnifctotfmDrli o t) exo(opnu4lm e nctls aDurur ;u4aetomieiysfa2um( s (0teerxocoytfm  lu o t0t2xo(o3ny1lmtemfet ()aDra(rpnt1teenmfeiltfa2umnmp u4tleomo ia1fm eaueols srum(r no4ale lnvia(faDur(mo;t1teen o3tas aDulnvo t) rxnirciadoaDr ies t0 euoiopoy1lpt mncsa() Drr( ooo1apenmf3tldfm em( s u) rtrmo3oa1lmDeluvol( trumxo3no1amen ncia( a2taumpou1opxniocilt aDrm(vp (0teeomfctytomDe ivs;(0trxrir no4ap elics s)s2umxm ;o1tpen octat m2rm( p t) lenxf3tadla rlnei t s2tmxmpnu1op  micta(faDtmumo;t4aet iietlsla umu p t) exnio3ia1fate iei;()setm(m nydaptnmieil()a2ur(m nt0apeomiciyt sDrm(vo u) ltnifcto1omDraiei t) 2uoxo3ou4lm nmneslt sDra(mpot1oltoiicild a2ua( pnt4aexrxo3oatopt liei t0s2trir3io1ap  mfcs s  rur( p;o4teen fcilsfs ulnvsnt4 etnxo oatopte uvi;(0texo(mpnydop n ncsasfsrtaxrpoo4openioeiysfm2um(vs;u0teeoxr3oodoaDe neo t)srur(r3oo4omt lfctas a2rrur ou0oeenmictld aDemump u0artrmo3oatfpte n slt  2xoirpou1optn nvsls) Dtrxro;o0tpxoifeiytfs2rln ont)aexrmfciodoa elu o ()texrxm iy1opee neslt)srumurpot0oetoifctls mDrmumo;t4tltoiocio1lm  aies;( t2xm(r3nodap e ictlt a2rrx onu1alt mf3iad a2ran o t0tlerir iotlateaueo s  rxmim3nu4lltnmnet t a2ur(r nt1oeeomf3tysla2rauvp t4alxrxo oo1op r i olt0teto(o3nudap  lnetas) 2um(mono1tlen feiysfm2eln s u4alxnirciodoa   i sls0sexrio3nudalenlieilt)arrmumoou0aeenmfcilt s2umnvo;u0teeoxo oa1om e i i;t) exoiopno4ape lnctls artrurpnt0ape iieilslmDumnmo;t0arxoxo io1lpt au s s) exrimpno1alenlfctat)s2tr(  ;t0oee ioetlsfm2rlnvont) eerxf3oo1la ean s;s tetmir3ny4al e ictlt aruau  nt0tee  oeilt m2uan o t4aexnxf3tadoa   neo;s0seto(rpoy4open icsl(faDrm( oou4apxn ieiat a2rluvsn()artrxf iodomt luvi (  ruoiopou1lpe  icslsfa2ta(  ;u0optnmietadlsDeln on(4alxrmoctotfpD lieo t0srum(m oy4op  micsltfaDtmxrpnu1opt io3ild m2ulu onu4 exrxocootlm  aies;s srxmiopno4openlnct s)artmx pou4tpxn i3tltla2ulumo;u0 ltrmrcoa1fp elu o t  exrxo3nodlpt  nvsatf rururpoo4oltomfetlsfaDum(vo u0tlenmociadfpDr u i t texrim iu4ap emnvsa(f 2ua( pno1altoifeiydla umn p t)aetnmf3iytlaD  uvolt0t2urxm3nu1apen ivsas) 2rmxr ;t4aee mieils mDumu o;t0 lenmfcto1om rlies s t2xm(r oo4ope lfvsas arrmumo;o0olt io3tysla2rluvp;u4arxoxo iadlmt aues;( sruo(m3io1lme lfctatf 2rru o;u0ale mi3tyd m em(mo;t0 reoxo3oytom  lnvsl()s2xoxm3iydomeelict sf rtm( pot0altoifetatlm uluvon(0 eeoioctytlatraies (  2xmim3iodomtemicil()aDrrxro;t4ope ifciydfa rlu p;t0 ltrirctotfm rli ils)t2xrim ou1lmenlneils  2urumoot0tle mfeiyt mDum(vo ()aexrir3oodfmDr u ol(0s2toimpou4op nlfvs s aDrau p;t0tpt  oeilsfmDrl( s u0 rtnio3iy1fm raivsls0 ruoimpoudom  lfvsl( sDtm(rpno4tpen feiys mDea( p;t0 exnmf3tydlpDr i s;t0 2xrxmpiy1omenlfctas)s2truroou0opxo f3iys sDemnmo t4arenmr iatlmD an i s0s2tm(rpiy1alt  fcils  2ra(rpnt0tltnmfciltfs emu s u4aeerxo tydfp r i o (  2uoio3iodlpe lnvilt  Drr(mpnt4aeto f3ias aDrmnvsn(4aexoio ta1fptr ieols0 etoxr3nodlpt mnvi sfa2taxm ;o4tpeomoeilslm2ra( s u4 lenmr3iy1faDeau s (0s2tmimpio4ol emivil( artm(m ot0texoifctydlaDrmu o t4 exoifcootoaD au i s)t2trxo3nodalte feilt a2urxmpou1tlxomo3tat s2umnmp u0aetrxo tatlateanesl() rtr(o oy1lme miviat  Drr(rpnt4aexnii3iltls2em( sn(0aetnxfcoa1optelivo s) rtoim3ou4lleemivslsf Dtaxr ;t0tee  i3iysla rmnmo t)trtnif oatlmDrln sl()srtrir3nu1lp  livil() rtrumooo1opxoif3tat a uan o u)arxnxr tydlp elivi ( s2xmxrpoydalee neiat srtmurp;t0texnifctat a2emnmpnu0altomrctadlm ean sl(0sexr(o ou1op  lnesas aruaxr ou4ale iictlslmDelnvs;u) rxnxrcoodoaDrai s ( s2xo(o3oodaleelict s s2tmxmo;u0tptnmo3ildla2uanmp;u0tltoxr3iatopDrauvi t0 ruoxo3no4apenmicias arrmxmp;u1tpxniieiatla2rlump t0aleoxf3io1oaDeauvslt)truoxmpnodlp e icsasf 2ururoot4tet  fciasla2uluvo;() lenmo3iatomt ln i;t  rtmxm3ou4am nmfcs t)a2raum nt0aexn oeiasfs ranmo;(4aetrmf3ta1lmDr uesl( s2toxr3iy4oltelivtl( s2umxmont4tpeniieiltfmDelnmpnt4 rermr totfmt aivo s0sexrxo3ou1amee nvtat a2rauro;t4alt mf3ilsfmDumnvs;(0 rxnxrciy1fp ean i () 2xo(m no1al elnei s  Dtm( ono1alenmoeiad s2ranmpnu0 lenxr oatlmte i o t trtmimpoodaptelfcs t aDrr(mpoo0tpt  f3tldlsDul( o;u) rtnmoctotla rlu i t0 eumirpoy1op n fes t)aDuaxrp;t0oltoii3iad mDem( snu0alxoio3tatla  luvi ( sruoir3oodale livtl()sDtmur no1opxnioeiyd mDuan snt) rtnxrcootfmD anei (  etmimpnudomee ncias) 2umuro;u0alto i3iatlm2umuvp;u)trerir iodfm e ieslt)trtm(m oy1lmee fvt t a2ta(r ot4tpeomf3iatla rmnmp;u0tltrmo3tydlp eai i t0trtmxr3nydape  nciatf Dua(mpno4tpxnifciyslaDea( o;()arxrmr3oa1opDelneolt0 rum(mpny4lpe lnetat sDum( ooo4apeomi3iytfm ea(mpn()alxrmo3ty1lpDrai o t)s2toxr ny4lpt mnct ()arrr(ro;u1ope  octas s2rm( s u0aeermr3iytfm  an slt teumir iu1llt  iet t) rumuroou0oleomfetytfaDrmnvpnt0tlxnmf ty1op e uvi;( trurio ny4lm nmivia(  ruru  nu0tlxn oetytfa2emu onu)teerio3iydlaDraneo (0t2uoxopoydoltelnvia(fsDra(rpnt0texomfetytlm ran ont)artnmr to1lmDran o;(0t2xmxr3iu4ll  lfesas a2tm(ronu4texo ietysfa rl( p u0arxoxfctodoaDe nvil()texoio nodol  lfvi ()s2rauro;u0tpe ifciadfs rln s (0trerif todla  li s;(0 2umim io1lpen nvs () 2ur(r no0oeeo fctat a um( sn(4 eeoio3io1lp   uvols)srtm(r oy1altelivtat)srrr(m ou4oetnmo3iyd a uan sn(4 rxnxr oatfp   i i;s texoirpno4lp eliviat) rrax p;u1alxniieiadla uluvp;u4aetnmr3iatoa e uvil()srtrirpiudopt lnetls srtrur ;t4aeen o3ild a em(vo;()altrioctatfmD anvi (  rxrxm no1lptnmics s)artm( o;o1tlxniicilt aDra(vsnu0arxrxocoy1lp eln i s0t2uoio3oydlm n nctas) rumx pnt1ale micilt a emn on(0arxrmr3ta1fa ran i s0 rumim oudam  mici t)srtmxronu4opeo ociadls2uan o;t0trtoir3oadlmtraivils)s2trxr iy4ap nliei t a2rmu  ou0olx  feilt s2em(vpn(0 leoio oy1fa eln o ( srtmxrpnudaltnmfeils artr(mo;u4teeoio3tyslmDrm( snt) exomf3ia1fmD  ivi;t) eto(rpou1ame licsa()sDtaxr nu4oee  o3iltfs2rmump u4teeniociy1lmDrlneo;()setrio oudlltemivsat) rum(ro;u0oleoioeildfs2emnvs t0tltrmrctadlp elnes;(  2xmir3ny4apee fvia()sDtru oot0tet mf3tytfs emnvs;(4alxoxrctydopD li o;t) rxoim oodllt lfviat)a2tr( pou4tltomi3tas a ua(mp;(4teermr3totoat  uvs;t0srumim nydlmte nvs t)s2taxrpnt4teeo oetas m ua( p;t4aetnio3iatlm eau s;t  rur(o ou1lpeemieslsfsrta(rpoo0apto f3tls s2ea(ms;(4aeeomrcoatoa ranes (0 2uo(m3oudlmeemfvsa(f Duaurp;o1oex ifciatfs2um( o t0tlerxrciydom   nvi;()tetrio oy4aptnlnctls  rtaurpnu0opt  fciytfsDem(vo;()tetnmo oodfa  ln s (0trto(opoydlm nmncs sf 2taum ;u1opt mfetaslm rlumo;()teerir3to1fm ranvs;s)seum(mpnu1altnlnvil( s2ta(mo;t0tpeniiciatlmDem(ms u0aeeomrcoydfa eai s;s  2uoxr3iy1opt lfct tf Drax o;u0aetn feild m2umnvp;()aetomf oydfp r ieol()sexmxr oydale  ivsa() Drmxmo;o1olxomf3ils s rmumo u)arermfcta1fpDelnvo;(  2umio3iudamt  fei tfaruaxmpot0apxn i3iytls2ulnmpn(0tlxnmr ia1omDran i;( trumir3iy4amenlict t sDtaxr ou4oetomiciasla2rau s ()tleoxo iytfmtrlueo ()t2xmim3oydam  lfcslsf rtm( onu1oleomfctadfaDeauvs (0 etnirciadoptran o s) etoxmpiydapt  ietl()aDur(r nu4ope mieiytls2rlnvpn(4 lxomrcia1fpD aivil(0 exm(o3oo1ll nlicsltf Duau o;o1ape  ociytfm el( p;t0 etnmo ta1fpDean o ()trtoxo iy1al  mfes t) Dtaum no1tltnii3tls a2umnms;(0tlermo iytlmD  u ilt tetm(m ny1lm elnciasf 2tr( pno0aptomo3iasfs2uanmpnt)trxnxr oo1omtr neol()srurxrpny4lptnlneilt arurx oou0opx  o3tyd s em(ms;t0tetoxr3ty1opD luvo t)t2ur(rpno1aleelnet t)srtmx p;o0optoifeiydfs2ul( s;u)trxnmf3iodlpD aues;t s2tm(m nodaleemfetas a2umur ;o1aee  fciysls eauvpnu)trxrifcootfmDrlnvsls sexoiopoy4am  lnvilt) Durumpoo1oltnmo3iasla eanmsn(0aexomo3to1lmD  nvo;s) 2tmxopoy1al n fvi s)a2umx poo0tptnifciys aDrluvpnu4 rxnxf3oo1lpD  iesl(0tetrimpou4opt lnvias)aDrr(  nu1ale mictas s ra(ms u0tlxrxf tytom elueil( trumxrpiu1al emnvsas)aDtr(mono1apx  o3tysls2ra( sn(4 renio oodfaDeaies t0tetm(r nydlptn iesat a2trxro;t1alxoifetldlsDulu o;(4alxrxo3ty1la ranvi s0s2ur(r3ou1ll   fvsasfsrumum oo1oeenioctlslsDrau o (0 exomr ia1fmDrlnvs s0 2tmxmpio4lpenmfeia(fs2umuroou1tlxnmfciad a um(vs;u4arerifctadlm   i i (0sruoxo iydapt mnesas  2ur(mo;t1oexnmieiad s2emu o;t)tltomr3tadfmD lnvsls)s2xoim3oydapee fctls a2tau  nt1tpenmi3tydfsDrau snt4trenirciodlpt anes;t setm(rpiy4ameelnetltf 2rrx o;o1tpxn ieiasfmDumumont0trerifciatfpD aies;s0 etr(m ny1ome lnct tf Dtau oot1aet mf3ils aDrlumo;t0tlenif iy1opDrlu i;t  2xmimpiydape  iesls  Dtrxro;o4tpxo ieildfmDeaumont)texnif tydfaDrluesl()trxoio3iudomte fet (fsDrr(r nt1oleomociysfmDrm(vo u)aeenxr iytomD  nvs;s0 eur(opiy4oltnmieilt)a2rr(rp;t1oee  ictaslm2um( pnt)alxrxrcty1lpt an il(0s2xo(mpnydlpenlfcta()aDur( o;t1alx mocild sDrl(vsn(4alxrir3iytfmteli slt0t2umxm3no4omtnlnesl( s2rr(r no4alx mfciysfm ulnmo;t0alxrmocootomt luvo s0 2to(r3ou4ll nlnes ( sruaurpot1opeo ieiatfaDrl(mont4teenircoa1lmD lu o;t0s2urxmpoy1op  mivi t)srum(mo;u1apenifciltfaDeluvs;t) reoio3to1la eaies t0 exrxmpnydom e fvsl() Dtrur no1teen f3iadlsDelnvon(4aexrxf tytopDe n il() 2toxo3oo1alen iciat)aDtr(mpnt1tlxnmf3tld m2eaums () lxnmrcoadfaD  ivilt) euoio3ou1olt  ivsas arrr(rpot0texnmicild s el(vp t0 etnxr3tydopDr nvi;s)srtrimpnodole  fviat  Duaurpot1alx ioetat s2uaumpnt0tlxoxo3ootopDranvsls0s2trirpiodalen nciat s2uru  nt4aeeoiociysfm ulnmpn(4arenmfciotfmt an il(0tetmxr3oodol e ics sf 2uaxm oo4teenifetlsls2el( s;u4texnxo ty1omDrlnvslt s2xmxr3nodom nlicsa(f Draumpoo0oex  o3iatfm2rlu onu4trtoio tydfm  lueils srumxo iy4amen fcsls)sDtru  nu4ope iieildfaDeanvo;u0 etrmf oa1fpDeln o s) exoxo3oo1opt  ieiasfs2ra(r oo1texomieils mDemumo ()teenxo iotfate nvs;t0trumimpno4om e ivilt  2ua(mpno4tpxo ieiyd mDua(msnt4tetrir totlm elies ()srto(opou4lpen fvil(farum( onu4tpx miciytfsDrlumo u0artomr3ootlaD  neo;s)s2xrio oodap n icsl(f rtmu ono0ole mf3iat sDul(von(4aetrmf iatfptr i o t)texmir oodape  nctltfsDtrxr no4ope if3tldls2um( s;u) etrmo oytfaD lnvs (0trurxr3iydalt lnes s  Dtmur nt4tee mf3iysfa2ean snu4treomr iadopt lies (  2tmio3iydole lnet ( aruaur ot1opt iocildlm ranvo;()trenmfciydoptrauvs (  2urxmpiudll nmfvi s  Dua( pnt1tee ii3iydla2um(vs t0aeermocta1fp r iei t0tetoim3nu4op e feias arumxmp;o4apx iiciyslsDemnmpnu4 etnirctydomDr uvi t s2xmimpoudol   neilt s2uaxmp;o1ope ii3iadlaDrlums ()trxomfctydomDrai o s)s2umir3nydop emfvslt)srua(mpou0opx mfctyslm2rluvs u0 lenxfcia1omte i i t)s2toim nodlptemfvtat)s2raxrpnu0teeo oeiaslsDrlnvp;u) eeomo tydoaDeai sl() ruoio iydam nliesas s2taxrooo4tlx  o3ilt s uan s t4 rtnmfcoydopDelueo;t0 rum(m iydole licsasfarrrurono4aetniociyt sDranvp (0 lxomf to1laD aieo s  eto(o3ny4lltelncs t arurump;u4oetnio3tlsfsDul( s;()texoxo3iotfaD lieol() rumxrpno4omt lfvtat)artm(  ;u0oex mi3iyd a2uanms (0texoio oy1oatrlueilt  rxmiopio4lpt micsas aDrr(mp;u0tpxn fetas s2um(mp u)trtrif iydfp e i s;s0sexr(m oudlptnlfeslt) rrmxrp;t0tet  o3iys s um( s;(4texrmocoa1laDe n s;(0 eum(m3no1lp n fei s a2uru  ou0oltn oetadfsDranvp () lermfciodfpD luei ( s2toxo nu1llte netltf 2raxmp;o0olxomociatfm2ea(vsn(0 etomfcoytfa rlu slt) 2ur(m3ou1lp e nvi sfs2rau  nu1tlx  o3tadfs rmu o;(4trxnmfcoy1omtran ilt0s2trio oy4lp elici s) Drrum ot0oeeomiciytlm2ul(msn(0teenmf3oa1lpDe u o;s0 exmim3no4lmtn ietasfs2tmxrp;u4oltomictldfsDrau onu0 rtoxfciotlmtr ueils  2xo(o oy1olen nvia( a2tmxm ot4tetnmoeilt s2emnvs;u)alenmrcoy1latelnvils  eumxrpno1lm  mfvt ( s2uaxmpnu1oee  ociydfa rlnvo t4aexnxfcoatfpDrauvi () 2ur(rpoudoltnlfesat) Dtmu pot4altoii3iytlsDrmu s;(4 lerir ia1lat  uvsl()t2xmiopoy4opeemivta(fsrur(  ;t1olx mi3tldlm2eanvo (4areomfcoodomt auei;()texm(r iu4lle  nes t s2umurp;t1teeo oetydfs eaumpn(4 lxrir tydlat  uvo s) rxoxo no4olt mfesa( aDtmxmpno0tltnif3iyt m rl( o (0 rxoxrcoa1fa raieo;s t2umxo3iu1alenlfeslsfaDurur nt1tetoioetyslsDrluvonu0tlenir3oo1fp rlues;s  rtrirpoydapeelnvta(f 2umur no4aet mfeiydfsDel(msnt) rerxf3iadlmDran o;(0 2xr(o3ny1lmtn fvs s)aDtmx  ot0aet mfeildfs eln p;(4tlerxo ootop rauvi;( setr(r no1om  lnctat sDuau onu0apx ifeiadfa2umu sn(0aeerxo iytfm r u i (0s2xrxr3io4lpenlictat artrum ;o0olen oeiatlaDeanvsnu)tlerxfcootlmt li o;(0 2xm(r iudop elfcsatfa2raxront4olenifeiydfm2rm(ms t)alxrxo3totfp rli o (0srxoxr oodope lnvtlsfsruax o;u1ope mociydlaDuau s u0aeeoxr3iy1fa eli i;s t2uoxr ou4lle mictltf Dumuro;t0aleniiciyslmDemuvp t) rxrxr3oo1lpD lnei;t s2xm(r3io4lmtelfeiatfarrau oot1apxomictatla eluvpn() rerxo tytlm   neo t)trtm(m3iu4lpenmiviat)artmurpot1oex mo3iysfsDum(vpn(0 eeoxr tadfaD  uvs;(0s2ur(mpny1llte ivslt sDuaxm ;u4olxoiiciytfm em(mo;()alxrir3iytfa   ueol(0 2toxr3oodomtn nvia() ruaur ou0oexn icils a emumpnt0alenmr oydomDelies (0s2xrir3oodlptnmivsl() rtr(r ;u4texomiciasfaDemn snt4alenif iydop   nvi;s  rxmir3nu4am nlicilsfsrtru ono1apx mo3iysfmDrau o t)tlermo ty1fpt  n o s0trtrimpiudoptemnesatfaDumump;u4alt  ictat m2elumont)tetrmf to1lpt  nvi;t0srtrir3oy4aptnlnciasf rrr(rp;u0aeeomi3iad m emnvs u0 rtrxfcoodoatrau o;t0 rxr(m3oy1op  mfviat  ruaxro;t1tle iociydlsDeaumo t) eerxr tydom   ies;( texrir oodaltelnvs t)srtrxmp;o1oetnmietydlm2ua(msnt0texomo3io1oa r ivs;t) exmxo ny4openlivtas)sDtmxr oo0aexoiiciat m ea( o;() exrxo3iatomt anei;(0teuo(opiu4llt  fcs tfaDumu p;t0opxnif3ildfs2umnvs t4trxrircoytlpDrlueo;t srxo(r3iy1lmee ictls arrru p;u1apxnmieilslm umu o (4 reoxf3iytlmDrln i t0 2urir oudlme mics ()srtmur oo4tlt ioetatlaDrmn o ()aetomo todlat aiei;( texmxm3oy4opeelies s artrxronu4texo ietls mDeanms u4trenxfctytfp  luvi (0srtmio no4lltnlfcilt)artaxrpnt1ope  fetasfs ran s () renio3todfpteaueo ( srur(mpiudlp nlfes (f rumxr ;u0oee io3ildfaDrm( s u0trtrmo iytfaDr nes () rtoirpiodam e ieslt  2umxrpno0tlt miciyd s2el(vonu4artrxfciy1oaDeai s s)seur(r3oy1lpte neias)srtru  ot4opeo o3iysfsDum(vo (0alxoifcta1fpD aies;s t2tm(r iodal emiei () 2urx o;u1tpxnioetadlaDuau p;(4texnxfctadoa eaiei;()tetmxo oo1lm  lfctlt s2umxrpnu1optnmiciydls2el( p u)artoxr tydlmtrlneol()srurir3iodale mnvtls)aDurxr ot0tpen o3iytfa uan p t0aexrxr3oa1opDe iei;s)t2uo(o3iy1omen ivslsf 2rrumooo4apeo ictltfsDuauvpnt)aeenmo iatlm rluesls  etrim3oudomte iciatfa2tmur ;u1aeeo fciatfs rlu snt4altoxf3ootfat aieils0t2umxo iydlpe lictlsfs2trxmp;o0tetniieiydla uauvpnu4tlenmoctodfpDe ivs;t)t2xo(m3nu1oltn fet t sDuaxmpnt1apeoifcild a ul( o t4aexoif tatlpDeln ol()srtoim3no1lpt lieilt a2uaxm oo1ope iieiytfsDeauvsnt)aeerxf3tatop  aivi;(0 rtrxr3oydlp elnvta()arumumpnt1tee mo3tlt aDean s u)treomf3iotop   ivo;() 2trio nu4lmen fvtas) ruauronu1tetn oetys mDrln pnt0trxomrcoa1latr n i s) etr(opiodol emfviat  2rrurp;o1tetomfeiyd mDeau pn()texnmf totla e uvsl()truo(o nydomee feta(fa2urxmpno1apxnif3iys m2umn p t4alxomf oydlmD  i o;( t2ur(opoy1ap elfctlt  Dua(rono0opto ietytls2umuvon()texrio3iadfaD  ieo;t t2xo(r3nu4om   nvtl(farrrxrp;o0alt  octydlsDrl(vp;t0 reomf oytlaD  ivi;t trurxmpnu4lmenlnctat)srtm( pnt0oexnmo3iasfmDul(mpnt0 lxomf3tatfpDe uvo;s)t2umxr3oy1ap e icsl()s2raxmoot1tetoioetld a rlnvo u4treomocoa1fpD auvilt trtoxopoudlpt  ivsasfsDurxm ;t4apxomieiasla2ra(mpn(4treoxr ootomteauesls trxo(m3nodale lfesasf rtrxm nt4alxnifcias s2rmnmp;t0aeeomfctodfpDeaivolt  2toxopoy4ol nmici ( a2uru onu0teenmiciys m2em( p u0 ltomo tadlm  luvi;(0sexoxr3iodop n ivs (fsrtmur ;o4altoifciadfmDel(vp ()tltrxf3oatop   ueo;()s2umim3iu1am elfcias)a2trxmpot4teen ieild m2um(mp u)artomrcoa1fpDrai i;s0trtmxo3iu1ape micsas a2rr( poo1tpeo ieiasfs2ranmpnu)alerio iydlaDeaivi t) 2urirpiy4am nmncsasfsrumu p;t0apxo o3iadlmDrl( s;u0aexoxr3todfmD  n s;(0s2ur(rpiu4lp   nvils srtmum ;t0tee mo3iytla2umnvs t0aexnif3tatlmD lnvil() 2um(o3nu4oltemfcslt  Dtaxr ;u1tpxn o3iadfm ul(msnu0trtrmr3ootomt  ies;()srxrim3io1omt mfcsa(f rraxmo;u4optnmf3tasfmDraumsnt)tetnirctadfaD anei;t)sexrxo3io4ol nmici t sDumxmpnu1tle  ietlt mDra( o;t4aexomo3oy1lp rlnvsls0sruoxr iy4apt mivils) 2rr( pnu1aet mf3iys s ua( o;t4tetnxf tydfm eauvi t)srtmxm nudlp e ies ()aDtr(m ;t4tptn f3iadfa2umuvo (0 lermo3tatoaD ai ils sexoxopoy1lmenl
\ No newline at end of file
@@ -0,0 +1 @@
+ues t) 2to(o3nudamenmiet (fartaxm ;o1alto i3iys a umums (4 lxrmf3oytom r n s t0teto(o3oo4ap emfcsa(  2um(ro;t1alx mictldla ua( onu4tlxrxf3todfmt au ols) etm(opiudome mnvil()sDrrxr ;u4altnmf3ilt s eanmp;u0tetrio3oytlp eaues;()teuo(o nudlpe  iei sf rumu o;t1texn oeiltfa rmnvs;(4arenxfcoo1oat aivols)t2umim oodopte icils)s2raumpoo1tltomociatls eanvp u4 renxoctydop rlnes s t2xoirpou1am nmieils srtrxmp;t0oeeomieiadla2rl(vsnt4aexnif3iadopDe nvils0trtr(r nydlmee ivt (farur(m oo4opx if3tlsfaDulnvo t4alxomr oytomtrli s;(0texmxopnydom  liet ()sDtrx o;t0aet  ocilt sDemnmsn(0tltrxr3iytoatrli i;( t2trim nu1am  lfei sf rra(monu4tleo f3iydfmDelnms;u)tlxoxo tadlm  luvo;(0 exrio3oy1aptnmictasfsrtrumo;t1oetnmoeils s2ra(vs;()treriocoo1lmD auvs s)teurimpoodlleeliesls) rrr( oou0ape  iciyslm ranmo ()tlxrmf3oadoateliesl(0t2xmio3iy4lm   fcia(fs2rr( ono4alenmoeiys aDemn o;(0texoif3iadop raieo s)seum(rpiodop nmfciasf 2tr(rpou1aexoiocilsfa2uaump;t0 rtnmf iadla elnvo;(0seurir3nudlptnlfci ()srtrxrpno1oex ifeias sDel(vp;t0altnioctydop eaivi;(0 exrxopnydlpenlnet t)srrrxrpnu1tpe  ictas m rmnvo;u)alermr3oy1fptelu ils0t2xmio3ny1ap  mivs s aDtmxr ot4tlxnifciadfs2rauvp t0trxnio oytla  lnei;s trxr(opiy4al nmfvtl()a2ua(rooo1apeoiieils mDul(mo;(0tltrmociotlaDeau ilt  ruoxrpiu4omt  fci s a2tau  no0alx  iciyd m2uau snu)tlenir oytfpD  u ilt)texm(mpiudal emnvtl(f Durx p;t1tpto ociytls2uanvo u4 exnmrctotom   ivil() rxo(r3nu4amtelncs s s2rm(mpot4aexnifciyt aDra(msnt)tlenmfcoydomDeluvs;t0t2uo(opiudalt livia( srra(rono4opx ifeiyt sDrln s;t0aexrxfctydom  luvol( trurir3no1omee ietl(fa2raxr ;t1ale ii3iytla2el(ms;(0 leoio oa1fatrlu olt texmxm3oo1lm   ict s aDum(m ;u1tpe moetadlsDrmnvsnt4 ltrmfcty1fp r u ilt  2umxopoydlme mncslt)artmu  no0olto feiatls rl(vs;t0 etoir oa1fmtrlu s;s)trxrxr io4omeelfetlsfa2tmum oo1tpt iiciltls emumo;t4tetrif oytfaDr i ils0 etmimpou1ap e nesa(  ruaxr nu1olxn oetltfs em(vsnt4arxnxf3totoaDr ueslt)srtrir oo4ll elnvt t)sDrruront1tpeniieils a ea(ms;t0tlxrxo oy1fpDrluesl(0srtrio iodomtnlnvsat)sDtaxrp;t4tlenifetatfs2ul(mpnt) exomr3iodlaDr neil(  2uoirpiu1am  mfct (  2rr(roou1tlxnif3tys m2emn s;u)aetnxrcoa1fmD luei s0s2umxr iy4llenlnvtltf rtrxr ot4aleomi3tad s2uluvp t0 leoir to1fat lnvi;s t2to(m3nu1lp nmicslsf Duru onu0tleo ieias s rln p u) rxnir3ta1opD aies;s0s2tm(m nu1olenmieslsfa2uaum ;t4apto o3iadlmDel( s u)arermo3oadlaDelieo;() 2xmxr oy4olen iciat)srua(  ou0tpx  i3iys mDuln pnt) lxrxrcoytfateauvil( texoir nydlm emnvil(faDrmxrpoo1openmo3ils a2eau o t0artoio iydfpte ivi;t0 2um(mpoy4omtnmfvtlt sDur(mo;t4oleomf3iatfaDulums t) etomf tytomDelues;s0t2umir iu1lm emfvsas) rtmu oou1olxnmi3iadfs2umn snu0trxomf io1omD lnes;() 2uo(m nudlp elnes (  2umu ont1optoiieiydfs2emumont)alermf3oydfa r u s;t texrxr3iydameelfeil(fartaxronu1optoiietasfm2elu o u4texriociy1oaD aivi;s) eumxm3oy4op nmfci sfsDtm(rp;u4opeoifetls s elu snt0 reoxo3iotoaD an i;( s2trio3ou4lpen nvt (faDum(mpoo0tpxnmiciasls elnmp;(0artrif io1oa rluei;t0 ruoir nydap elnesls)arurxr nu4oetnmfciat s2eanvp;u4tltrmf3oatom e u i t)sexo(o3io1opt  ivtlt)artru  nu0olt if3ildfa ra(von(0 ltrxo3oo1fpteaivs;s)tetoxr iy4amee ivsas arraxm ot1aptnif3iad a uan o (0alxomf3oatlpD  uei s0srtm(o iudllenmfvt t)s2tm(r ou4oex  o3tyd mDuaums;()aexnmrciydoaDeanvs;s0t2trir nydlmt  fcias a2raumo;u1ole ioetyt mDelu p u4aeenir iytlmteau o s  rurxrpiy1apte fesat)srtm(  ou4oex miciytfs2rln p;(0trxnxf3totfmDraieo ()t2um(o3iu4ol   fcs t)aDuru  ;u1tltoiociys mDrm(vo u0aetnmf oo1fpt anei ( s2toiopou4lpe mfvi sf rum( oou0ole  octad a rauvo t) leomr3oo1op  an sls trur(rpiy1al n nvtl(fsDtm(  ou0tlen fetadls2raump;u) eerxf3iotfaDe uei () exr(rpio1omen ieils)s2raxmont4tex ifetltfa um( ont)arerif iy1oaD lnvs t)trxrxopiu1ol nlivslsfa2rr(  ou0tetnmociatls rl( o u4artriocto1oa   iesls0 rxm(o ny4lm  licils)a2umu onu1olx mo3iyd aDuanvp t)tlxnmo oydfp e uei (  ruo(r3iy4optelneilt  rua(r ot0olenmietydla2rmnvs t0trtnmr3oa1lmDrluvils0teurxopou1lm  lfctlt  rtru p;o4teen o3ilt s2rlump u0aetrmrcoodoaDean slt setm(rpio1ll  miei s) Duaurpoo1optoio3ild mDumumont0 exomf iydfp ranvolt  rxr(o3iodap   iet s s2uru ono1optomf3iltfm2ua( o;u4trxrmfctadlpD lu s;t) 2xoxo iu1alt lnvs tfsrumx onu1oeeo feiltfmDrlnvs;(4 lxoiocoydoa eanvi s0trxrir3nodomenmfvs s  2tmx p;t1alen oeiat a rl(vo () reoxrciydomt lnvolt0trxriopou4amtelnetlt)arraxmont1alt mo3ils s2emumo (4 rxnxf tydfm  an i;t  exmxopoy1olte fvi (f rraxmpno4oexnmf3tatfaDuluvsn(0aexrir tatfmt  ivo;s0seumxrpnu1lptemncias sDra(mp;t0aptnmociadfmDulnvpnu4 etoirctytlpDeaueslt) euoxm3ou4ameelfvils  Dta(rpou1oee  o3iysfs2rmuvo;t4 rxoxocoa1fmt au s;s trurir3oo1ole lfvslt  Dtm(r ;u1aetnii3ildfmDranvsnt0altoif3iadoa  lnesl()srxoxo3iudolenmfetas)arra(m nt1tpeomoetatla ea(mp () ltrxr to1fmDe i il()s2trxrpnodam emici (faDum(m ;t4aetoiocildla emu s;(4tetrxf3tadopte ueolt)srumxopoo4ol n fct s)srrmxr ;u0tlen ociydfs2uluvo t0altoio iydom eaivs;t)srum(m3oo4ap   iet tfaDtmxm ou0opxn o3iatlaDumnvpnt4trenxf3iadlmt lnei s s2xrio iu1llenlfvs t aDur(mo;u0tpe iieias a ulumo (0alermr ta1lmteau s;t0sruo(o3oo4opt livil(f Dtr(r ;u4apxoiietadla2uanmp;u4 rxnir oodlpteaivs;s)srumxr3nu1oltn nciatfarra(mpou4aptomoctytfs2ranms (4artriocoodfm raiei;( t2xmim3ny1ope liet s arrax  no0tptnioctldla2eaumo;()aeerio iatoa   i ol(0srxrir3iudol  lfcs tfaDrm(ro;o0tpto f3tytfm2rmumsnu0trtnxoctatfmte neslt)texm(o3nudlp emfcils) Dtrum ou0oltn f3iat aDum(mp;(0trxrifciadfm r nvi;()setmirpoydll eliet tf Dtmx  ot1ole  i3iyslm2eluvo;u0tetomr todlmt  i o;s)seuo(r oy1lmen ncilsfsDtrur nu4oexnmi3tls mDea(mpn(4aexnir iy1omt lneslt  rxoxm3nydamtelnvtasfs2ua(r ;u4tlxoioctyd aDrlums;t)tetomo3ootfptr ueo ( t2xm(m3nu1lltnmfcsasfsrtrx  nt4tpxnii3tysfa ul( o;u4artrxfcoatom rluei;(  2urimpnu1amtn icilt a2rrxr ou0tee ifciytfm eanvpnu0teermocoa1oat ai olt0 exoxm3nu4ap   nei tfa2umumoot1texn o3ilslm ra( p;t0arerxfcoy1omte ivsls0s2toxr3nudll nliviat)sDraump;u1olxoifeiatla2ul(msn()aeeoxf oa1optraiesls) rxr(m nudole livt (faDurx poo0tlxo o3iyd sDumn sn(4 rxomfcootopDe ueo () ruo(rpiu1apt  ivsl()aDuru oou4ape  f3iltlm ul( o;u4 rtrxrciydopD livils)t2tmxrpoy4al  lfcsas)srtrxmo;o4olen oeild s uanmpn()altrio oodoa eauei;(0 rxmxm ou1apt  fctat a2ur( o;o1ope iociydfs uaumsn() ltomrcoa1oatranvo;(0t2ur(rpno1lleemivta( arum(r oo4teeoiieiysls uln snt)tetnifcoy1fpD  i i;( trtoxm nydol elfcsat)sDumur ;t4apxnmfetytfm2ul( s u) lxrir3oy1fpDrluvils0t2xmim3no1aleemietl(f Dtmx pnu1ape iocias a eau pnu4tlerio to1om   nvo t)setr(mpnudol nlfcta( a2trxmo;t4oleomoetat s uanms;(0aeenmrcoodom eluvolt0 rurim3iu1optn netlt) Durxmp;t1opxnmictatlmDra(mpnu0texnif iodom   n sls) 2umim ny1olt lnctls sDraxmono4tlxomf3tad sDuanms;()aeermrcto1fpD lueils s2xoxopno1llt  nvtl( aDtrxmpnu1texniocilsls2umnvp u4 etnmo3oodoatranei s0s2ur(mpoy1amt mfvt t a2rmu p;u0alxoioetad mDra(vo;u)tlenxf tadlatranei;s0s2xr(r3nudop  lfcs ()sDurumonu0tleoifctysfs2ra(ms;(0aeenxf tatoate nvs;s seuoirpio4ap  lfeias)aDtrxr ;o4apxomf3iysfa ul(ms ()artnxo iy1lmt aueil( t2xoxr3oo4am emfesl( a2tr(  nt0tlt ii3iys s um(msnu4 ltrirctytfat  n sl( s2umxmpiodalenmncta(farrrumono0tle mi3iasla ua(mp;t)treomf iy1omt  ueol()teur(mpnodop  licsls)aDrm(r oo0olt io3tltla2umnmp;u4alerxr3tydlmDeln o s) rtm(o3nu1amte fei (f rrmu p;t0oltoif3ildlm rmn pn()aeerio oy1fatelivs;t  2uo(r3oodll e fvt s)srururo;u0apt mf3iydlm2ul(vonu)teeomocia1lpDraiei;() 2umxo3no1lm n nesasf 2tmxmoou4oex  ieiadlmDrmump u4 rtnmo iydfpDe ues;() 2xrxr3ou1optelfcilt s2umum ;u0oleoifciysfm2ua(vo u4texrio tytlpD  u s (  eumir iy1omenmfciltfsrtrxmooo0apx  icild aDumnmont0trtrifcoodlpD an o s)tetoxm no4lp n ieta() 2uaxrpno0aptnmietldlaDrmump;t4trxomr3iytoatrai s;t0 rumir iu4lltn icsls)aDua( o;t1ape ioeiytlm2umu o ()alxrifcoy1omt  uvi s0 rtrxr nudll emiei (fsrtru  ot0alxoiieildfm emnvpnt)tetoxo oadlpDrli i t)texrimpnudlm emicilt aDrax p;t4open feiydlm2uauvo u4 leoio io1op rauvolt  euo(opnudol e fct s  2ur( o;u4tpxnio3tyslsDrl( s (0aexoioctydoptelu o t)sexmxo io1lptemfct ()a2rmumo;o4alen f3iatfs2ea(mp u4aeerir oatfmte ieil() 2xriopiy1opte ncsas aDuru pnt1oexomoetyslaDelnvo (4areoioctadlm e n o;t trxrxr3nydoleemfcsas a2rm(rpot1aeeo ieiadfs2rl( s;u) rtomfcoydla e u o t) rtrim3ny1om   fvt ()a2uax  ;t0tpeomociadfsDeaumo;()arxrio3iy1oaD livo s)s2urxm iodole lncs t  Dtmx  ;o4oeen fctadlm eluvs;u) reoxr3iatlm elnvolt0 eumim3oydap   fctlt) Drrxmo;o4opxn feiad mDrmn sn()aeermf ia1faDe nvols  2umxmpiy4lp nmnet s  Dra(mo;t1tlenmi3iytfsDuanms;t4teenmf ia1lmD ai o t)s2tm(mpoo4om elfcils aDtr( pnt4oee mictydfs2ra(vp u)aeenmrctytfmDrli ols0 etrxr3nu1lp  lnci sfs2urxront1tpeo f3ilsfm umnvo;u0alxnmociytlpteluvs (0 2tmxm oy4lp  lncilt  Dur(mp;t4olxoifciad m2rl( s u0 rtrmf totoaDranes s  rto(m oy4lmt  iei ()a2rrxro;u4tpt  o3iltfa2emuvon(0tltrxf3io1fpDeluei t)t2urio3iydoltnmnvsas)a2urumpoo4alt  fetadla2rluvon(4arxnio3iadfmDr ueslt0t2xoxr3nu4lp nmnvta(  rumurp;t0aptnioctldfm2em(ms;u)aetnmocoa1faDrauvs t0srxrim3ou1lle mictat sDtmump;o4oexo f3tysfaDul(vpnt0tltoir iydopteanvi t trur(rpou1omenlict tf rrrurpnu4oet mi3tldls ul( s u4aetrio tadlaDraivolt seurxopou4lleelics s  2ta(mooo1apxnif3tltls rau pn(0arxoif3oytfptrlivi;t)trxo(o io4aleelfct sfs2uaumpoo0olx mo3iytls2umu on()tleomr totomt  n s;s trtoimpiy1am  mnvs (  2uaum ;t4oeen fctlsla umn s u4tlxnxrcoadlpD  iei;s t2xrir3nudlptelfci s) rum(ro;o0tetn ociys mDuln o t) exrifciotfpD  nei s  etmim ou4lptnlfetltfaDrrxr nt4texnmf3iysfm2rl(vs;()tetnif totla  li i s) 2xm(m3oo4lmtnlfvtatfsDtmxr ;o4aex mf3ild m2raumsn() rxnxf3ta1fmD  nvs s)tetmiopiy1ll nmfeias) 2umum nu0tlenmfetls a2rmuvpn(0texrmo3oytlaDraieols  eurir nodlleemfcsat) Dum(m nt4oetoifeiad s ua(vsnu4 exrif oadoaDe u i t trxr(mpoo4oltnlnei t)aruaur ;o1texn i3iasla ra(mo;u0trenio iatop eanvilt)texrxo3iy1lpenmieiltfa2rr(m ou4alxn fciys aDumnvsnu4 rxomfciadopDraieo;s  ruoxrpnodolt  net t arrr(  nt0apt mietytfm2rau p;()tlxrmf oydfmteln il( trxoio iy1ol  mnvil( a2umxront4teeoiiciadlsDemnmo;t0tlenmf tatfat  nes;t  etoiopio1llenmfciatfa2ra( pot1aleo feils sDul(mp t0teermfctytlm elivi (  eurir oydlm nmivtat)sDrmxmpot1teen i3iyslaDran pn(4teermrciodopD  uesl( trtoxm iodapt lfvt tf 2tmuroot1tpt iociysla umums;u0 rxnxrcoy1fmte n o t) rxmir oy4ol  lnetas  rtmuroou0alt mfeiys m2rmu p u0alxomrcoo1op elu olt0 rxo(rpnudll  lncias) rrau  ;o4texn i3ilslmDulumo;u4arxnmf3io1optean i;() exrim3oydop e ivsa()artm(rp;u4oex ioetlsfaDean p;(4texnxfctodfptr i sls) rurxo nydole lfvsls) rra(m oo1alxn f3iltls2umu o;(4areoio3oa1lptr i ils)s2toxmpoo1opt mfvi tfs2rax  no4aexo ictatfaDra(mp;u) rxrir oa1oatrlu i;s)t2to(m iudamt  ics t arrm(rp;u4aexo o3tyslsDrln sn(4 exoio3oo1omDeau i t)sruo(opoudll  mfvilsfsruax o;t0alt iictadlaDuau sn(4aexrmo3to1lp eli ol()s2xr(mpoo4aptnmivs s)sruru p;o4ole mictatlm2rlump;u4aetrmf3iydfaD  n ols)s2to(r3oodol  licta() Dtrxmpnt1alt io3ildfs2elump;t4aexnxo3oatop r ueo;t0t2trxm3nodllt mivta(faDtmu oou4aetnmfcias mDem(ms u0artoif3oa1om eluvil( s2tmxopio4ale  fcil( aruru poo4olen ictasfm2rl(vo;u)trxrirctodoat  u ols) 2umio3oudlmenmfesas  2taxm ;t4opxo i3iatlaDrmu p;(0artriociy1fpte ivs t)trtrxr iudllen nct s) rraxmoot4tetoiociad a elu o t0 renircto1lp r nvi s0 etoxr3nu1alte neias a2rmxr nu0tpeoiietldfs2ul(mo u0 leomr iytfm  li sl(0 rxmxopoydlmte fetl(fs2raxm ;u0opx mo3iyd sDua( onu0altrif3oo1fm e nvo;t0 ruo(r3nu4om emivsas)a2rr(mono0alenifeild mDrlnmo (4trtrio3oydom ranesl(  exrio iodamtnlietasfarraxr nt0aptn f3tytfa2ulnmp;(0alenirciatfmDrluvi ()trumio nydlpt lfeia()s2tmxroou4oee iiciyd a uaumpn(0texoif iy1om  lies;s) eumir3oudll nmies tfsrtauroot0ape iieiatfa2ulnvpnu4 rxnxf iodla raueilt  2toim3oo1ol nlfcta(faDta(ro;t4tee mfciyd m ra(mont) etomrctodomD lneslt) eto(o3io4lm elncils srtmu  ;u4tlx mieiys s um(vp;u0 rtnir3tadfaDr n il()t2xmir3io4al nlnetat) Drmx  nt0tetn ieiad aDumu o;u4artomr io1oaDeaies t0 rxoxm io4lm nlfctasfartaurp;u4alen oetasfa el(msnu) rtnio3ootfmDrlieil()t2xmio3oy4ole  fvtasfs2rau poo1tet  f3ild s2rln onu0 lerio oatop r nes;s0s2xoir ou1ol   nvs (fs2tmxroot4tet ifeiyt aDemnmp;()tetoxoctydlmt  neo;()t2trio ou1amtemnvsa()srum(rp;u4alenmfeiys a uanvp (0 rermo3oo1omDrai s ()s2tmxopiu1al nmfctlt aDumxmp;u1opeomo3iadfm uaump () eeoxr totoptraivo t0 2uoxm oo1amtelfcias) 2ur(mono1apt ifetldfaDuauvo;u0 eeoxo ty1oa eanei ( sruo(r ny4llt mies t)s2rmuronu1altnmicilsfs umu pnt0alermocto1fmt  iesls tetrir3io4lltnmncsat)srumu  ;o1altn oetadfm2raumsnt) rtnxf todlpte nesl(  etrir no1lme mnvils  ruau ooo4olxomf3iyslm um(mp t4arxnir ty1fp e ivi;()s2trxm oy1op elnesatfaDumu  nt0tpx  icildfm2uanmpnu4trxrir iydlptrlues;()srto(o io4lp   fvi () 2umuro;o1ale iociatfmDeaumo t4artrmr3iotlaDeaivols)seumxr3no4lme  fetlt)sDuaxrp;o1tee io3iad aDranvp t4aeeomr iadfaDeai s;t)t2trir ny4ape liciat a2raurp;o1aeen f3tytlsDul( s;()artrmf iodoptr ivo s0setoxrpoudamtnlfvil(fsDraumpnu1tex  feilsfm ra(ms;(4tetoiociytopD lues;t0 rumio3ny1olee fvt ()s2uax  no1optoifciatfs2el( pn(0teeoifcoy1lp rauvslt)trurxopoo4ape  fes (fs2ua(mpno0aexn ieiydfsDul(von(4artrxf iytom ran i;s0trxo(o3oydlpe  ivils s2rrx ooo0aleniieiaslm2ran ont0arxrir3oatlptr uvi ( tetoio3ny4llte nviasfaDta( p;t4aleomi3iysfm elump;()tlxoiocio1lpteluvs;(0setm(r iudam nmict ()sDrmx  oo4olt  f3iadfa2el(ms;(0aetnmr3iytomt aueo;()teuo(rpoy1lpenlies s)a2tm(ro;o1oltniociadlmDrlu o;t4aetnmrcoo1fmtraneo (0truoim iodam   nct s)srrr(m no4tpen iciydlaDulnmo;(0aetnxrctydoat aiei;t srumxo3iydomteliesls a2uax pot1altomieiltfa2umnmpnu4 eeoxrciytom e nvsls)setoio3ny1lmtemneil( a2um(rooo0tetnmfciad mDrln s u)trxrmo iodfm r nvo t0srxrxmpoy1apte ieslsf ruru oou1olx  oeildlm2ranvsnt) reoif oy1oaD  neo;(0t2umxm3no1llt licta(f 2ra(  nu0tpeomo3iyd mDel(mp;u4trtrir3io1op r ieol( tetr(r nu1am elncsls aruaxront1opxo oeilt s ranmo;t4 eeomoctodom  luvs (0t2ur(r3oy4lle  fet ( srrmxroot4tltomoctyt m2umuvp t0 rtnxr3tatfpDe ieil( trtrim oydolenmnvta() rtm(ront1alen octys s2rmuvp;u4 renmfcio1faD lneilt trtmim oudop  mieiatf Dtrumpoo1oeeoiictyd sDemnmo;u4 rxoxociytfmDeluei;t0seumir oo1op nlnct s)a2rmxmono4apeomf3tydfa2um( s (4 lxrmf3totoa  luvi s)s2uoirpio4ol   fesltfaDuau o;t0apt  f3tadlm rlu s;u) ltrmr3oadlm e u s;s0trxoxmpoo1lp   ieiat) Dtrxrpnt4opxoio3ilsla em(vo;u4 rxomr oatlaDrli o s) rurxo3ny1aptnmietltfsDraumpnu1oltn i3iat s2uluvo (0tlerir3todfp ranvs;( t2xoir3ou4al elnctl()sDrr(ront1tpx mo3iad s rmu o t0aexnmo iadfptelnvil(  2xr(rpiy4lleelfvias sDrrx  oo1aptoio3iadfm ulnvo;(0 rtomrcoy1fptrliesl( seuo(r3oydom nmncs tfsrrrxmpnu0oex mi3tyt m2elnmp;(4tlxnxf3oy1oa eli o;s0 ruo(rpiu1lptn netat aruax  ;u1oltoioetld m ulums (0tetrif3oy1om   uvi s)sexo(o ou4apt  iesas)arraxm nt4altoiieiytla ea( p;u)trtnmrctytoat  nei;(  rumxr3io4omenmnetatfaruaum ot1opt moetadfmDulumo;t) exrxfctytfa e n o ( trtoxrpno1apeelfvs ( s2tmxrp;o1aexnmieilt mDra(mo t0artnir ootfpDr n o s tetm(m3oo1oleemncslsf rururoou0tleoiocildfmDea(mp t0aeermr iy1fateau il( s2uoxmpio4ol   nciat  rrm(mo;t1tltomi3tad m uauvp;t) reoxo ty1fp eanei;( sexr(r3ny4lmee ieilt)s2raurpot1tltn i3tad aDrlu snu4aexnxf ty1fmDr i s;t0 exo(m oydom elfcsl(  Drm(m oo0tltniieiat s emn s t4alerif todfmte ieo;t0setm(opiudlp  mnvilt artr(rooo0tpe  oeiat s rm( o;u)treomr io1om e ivsl( s2umir nodapt  fvils arua(m ot4oltoifeiytlm2umnvsn(4 lxoio3iodopteaivo;s  rxmiopou1ap emnvt (  Dum( pnt4olen i3ildlsDum(vs;() reoxocio1optelies;(  eur(o3io1op elfvs sf rum( onu1apt if3ilt a rmnvpn(0tetnif tadlaD  n s s)sexrxmpoydaltnmieiat arrrumoou0tlenmfeildlsDulnvs;t) rtrmrcio1optrlu s t0srum(r ou1ale  ivil() Drr( o;t1tpeomo3iltfm el( o t0 exnxfcto1lpt aneslt) 2toxo oudlpeelivt sfsrtruront4tetoifetyslmDumums u0 eenmrciodomD  neslt0s2xm(o3iudam   ics () Drrur ;t0aetn ociysfs2rmumpn()tlxnmociy1lm ranvslt teto(mpiydlp  mfesas  2umxmooo1aeen octys sDemump;u)texomf ootlp r iei;(  rxr(o3ny1opt  fes s  rtmuro;u1tle  o3ias a2el( o;t)aeeoxfcty1omt  ivil()t2trxmpou4olee net t arurxr ;o4ope mo3tas aDea(mp;u0altoif tytomteai i (  2tmxr3nydal n nvsas aDtmxm no4tle mieiydlm2uanmpnt0 rxomr3ootfa e i o ()trtrxo iudlptnmiesas)a2rm( o;t0ope  oeiasfs2eluvo t0alenxf3oatoa eanes t s2tr(o io4lpenlicsa(fsDrrx  oo0olxo ieiltfmDrm(msn(0trtnmr3ta1oa eanei s teto(m3iudalee netls  2rm( ooo0oetomf3iaslm uluvo t) lerxr tadfaD ai o;s) rxm(mpoy1omt mfct s a2rrurooo1tex moctyslsDulu p;t4 exnmo3oo1fmDe ivo;t t2tmiopiy1ap nlivs (fsDrm(r ou0ape iicild a ul(vs;(4artrxfctydlmtrlivi t) rtrir3iydlp n fet sf rraur ou1opx ifeias aDeanmonu4trxrir3iadomtr ueils0tetrir oo1omtemnei ()aDur(  ;o1oetnmieiyslmDul(vsn(0tlerircoatfp  li s ( s2ur(m iu4oltnmivtlt)artr( pno1teeo fetls m emn s u0 rxoxf iodfm   ieilt)srum(o iu4optn feiat) 2tmxmpno4oex  feiydla2uaums u4tlxnir tydlmt  nvi;s0 rxo(rpoo1optnlfci ()aDtrum oo0alt  o3iyt sDumump t)trxnir oa1lmtranvi (0s2trxopou4apeemivsat s2uax ono1tpx mfciat a2ulnmpn(4trtoiocty1om  ai il( srum(mpiy4lm  livils)aDtrumpno0apxo fciatlsDra(msn()trenxf oo1lat aneo s t2xoiopno4omenmietl()arurum oo4apxo ociaslmDra(ms;t0 ltoifcoo1opt aiei;s0s2uo(opoydomen fci sfaDtruro;t0ale iieiatlmDrmnmo;u0trxnxocootfmteaivils  2xmim io1llenmnei s)arrrxrpno0oexomfcilslsDumu o u4texnxr oa1omtrluvi s0tetoio oo1ol  mietlt)aDumum ou1tleomo3iatlmDel( s u0arxnmfctodlmDelnei (0trtmirpno4om nmnvsas)a2taxm ;u1tpx  feias mDemuvpn() exoircoydfpDe nei s) etrxm oy4om emfctl()artmum oo0tetn i3tys mDuan s u4 etrir iotfpDrliei t0setm(m ou4oltn ivsat)srta(ro;t4tpxo o3iltlaDumumo ()alermfcoytfmt auvsls) exr(o nu4alenmivtat)srurum oo4tltnifeildfm2em( pnu0aetnmf iatlptrlneo;(0 etoxo nydam nliviatfsDtrx ono0tlx if3iysfs2ea( p t0tleoif3ia1omDrlivs;( t2trxr3iu1lmee ictl( artm(m oo1optomfctydlm2rm(mont)arxrxo3oatfp rlu s;t0sexm(r iydam nlfei (f Dtr(monu0tet  ociytfa uln ont0 exnmr3ta1fm rlueilt0 etrio3oudoptn icsa(f 2raxrpnt4oeeomoeiadls ea( p t0tetoxf3totfpt li i;s0s2trirpoodap emnctls) Duax ont0tlx  f3tysla2em(vonu4aexnmr tytoa  luvo;()t2xo(opiy4optn ieta( a2ua( p;o4alen i3tldls2rlump t) exrmo iytomtean s;( srur(o3iu1ale mfciasf Dtrxrp;o1aleo f3ildfsDum(vs;(0trtrir3iydfat  u i (  exmir ou1ap   ncil(fa2raxr oo0aetomociyslm ulnvon(4tetnxoctotoat  i s;(  2xo(rpno4al   net s srrrxrp;u1oleomoetldlmDeln sn(4 etrif3iatfmte u o t)trtoxr3ou1ope liet ()aDrr(mont4alenmoeiysfm2rmn o t0tlenir3iydfmD  i o;(0 2urir iydamtelnvtas)sruau oou0tpxnifeiad s rm( pnu4aleomrcto1lp rai i;() exmxmpoy4lptn iciatf rrau  no0alxn ictls aDua(mo t)aeeoxrcoy1lateaneol() 2ur(opoy1lp   fcta()sDumuronu0olxo i3iyd sDum(vs;u4arxnxr ootlmD  uvol() 2tmio3io1lp n feiat) Dumuroou4aexo fcias a2elu pn()arenxrcoadfp rau i;s  eto(r iodale lfet t) 2rr(rp;t0tptn oeiad m2ul(vp;t0texomf3oo1lp  lu ol(0sexm(r3nydopt  icslsf rtm(mp;t1olxoifeiad mDeaumon(0tetnmf oy1fmDean o;s trurxo3ou1oltn nvtlt)srumxmpou4tetnmiciat s2rmums t4altomf iotopDe ivslt0srxo(m nydol n ieiat) Dtm(  nu1openmo3iyt sDel(vs;u)alxoircoydopD luvslt setrxr iudaptemiesat) rrax onu1opt ioctld a2em(vp;u0 exoxf to1fpDeliesl(  rto(mpno4lm elietat) rta( poo1aleo feiyd m2ulump (0 rxoxf3oatfmDelnvi s)tetrxrpiydamt lnetl(fsrurx oou1apt mietadlmDemump;(0trtrmr oydlmtr uvsl() rxmxr iy4om n netls  rraur ;u0aee iictltfa ra( pnt4trxnxo oy1fmD  uvols0t2urxm no4amen ivtlt artaxmpnu4opx  octlsfsDrl( s;t0 rxnio3tydlaD aiesls) rxoir3nu4lleelfvsas  Durumpoo0aetn ieiyd m2em(vsnu0tlxnxfciytfpD lnei t  2urxopoo1ole lfetlsfsDrm( pou4tpeo ietadfa em(vp;t)treoxr todfpD  n s;t texm(opou1lpenlfcil(fsrrr(rpot4aexnmfcildfaDrl(mp;u4alxnio io1fmD  ueo (0 eurirpoy4al n nesat aDrmurpot4ole mi3ias sDrmu on(4trenxf oo1latr ivols setmimpny1ole mnet s) rraxmpot0tetniieiaslaDrmn o ()texrmo oy1faDelneol(0 2xrxm oydll nlnetl()arumxrp;o4tpxo i3tysfmDum(ms (0trtoio3oa1omt luei (0t2xoir iodlm n ict () rtmum ;t1tex mocilt m2ranvp u4 eeoxo ty1lpDeli sls0 rtoxo nudlm nlici t) 2raxr ;t1aptoifeiadla em( s;(4 rtrircto1latelneo s0 2toxo nu4omt lfei ()srtru ont1tpx ii3ias m uanmp;() rxrircoydfm  livo;t setmxrpiu1lm emfvslt  Drm(  ;t0tex io3ils a2eluvs u)alxrmr3ootfp  luvi;t)seurxo3oydoltnlicias)aDtmurpnu1apxomfeiydfs ranvs;u)artnmr3oydfmteluvs (0 rxoxopoo4aptnlfei s s2ra( o;t1tle  octlslmDrm( pn()alxnxf tadfat anvi (0 etoxr iodaleemieil(fs2ta( o;u1aeto ietas sDel(vo (4 etnio3totfa  li s;s0trum(r3io1ale lieiasf Dua(mp;t1tptoif3iydfa2em( onu) exnmo3iytoat livs s0setr(rpno4lpenlicils  rtaumoou1oee iicilt a eanvo;(0aexomo3ia1lp rlu olt truoxm3oodlpe mivilsfa2rru  ;o0ale ioeilsfaDemnvpnu4tetnxo ty1fa rlnvolt)srxrxopio1omen ici (fsrumx o;o1tlxo i3ildlsDulnmp;(4aexrxf iadfpDran i (0 eur(mpio4altelivi t)sDtrx oot4oleomfciyt a2ua(mpnu4tlerircoytlpt aieo;t0sruoxo3iydol n fes (f rrrxr ;o1tlxoiocils m2emu snu)arxnxr3oo1optrlnvs (0s2xrxr3iu4llt lies (fa2ua(ro;u1oee mi3tytfa2raumo t0 rxrmr iytfatr nes ()setmxr3iydol nmict ( artr(rpnt4altomociasfsDemuvon()treoir3totfateln o;s0t2trxr iy1openmfvias artmum nt1aetnmoeiat a rlnmonu)arxrifciytlaDrlivi;t) etr(o no1lmeemneils)a2rmx pot0apxnmicias a ua( p (4arxrxf oodomDraueo t0srto(r iudoptnmfetlt a2um(rpot4tpt  feiad m2emu s ()aeeoio todlmteluvsl(0 rurxr3iy1opte ivs t  rtmum ;o4oexnii3tadla2umuvp;u)alenifcoy1fm  au i;s t2urxopiydlm  mnesl( sDuau o;u0tpx mictldlmDeanmsnt) rtrmo3totoaDe nes ()setr(opno4llte neslsfaDrmur nu0tee  f3iytlsDel(ms;(0teenif3oatlmD lnvsls0s2xoxm no4lptnmfct (  Dumx onu4tlt mfeilsfs el( s;t0 etomf totoa   nes t  2xmir3oodame licslsfs2tax pno4apxnifeiasla rm(vont0 ltoxf oydoaDrlnvils0 eumimpno4omtelnvilt) 2trxr ou4aet mieiyt aDem(vp;(0 leomo tadfa e nvo;t  2tr(m iy1ome liet () Dta(mooo0tlx  f3tltfs2el(msn()tetrmf to1fmte ies t) rtm(m3nudll nlfctl()aDur( oot0tpto fctltlm2raumpnt0aexnxf3ootoat luvi;s0t2tr(o3iu4omtn fesa()aDta( ooo4aeto fetltlm rmnmo t4 renir iy1omte iei s)srxmio iudom nlnes sfsrrrx  ;u1ope io3iltfm eauvs;u)artrxf3iadfptr ivs t) 2to(m3nodam  lfei () Dtm( o;t1tpeniocildfmDrmums;(4aleniocty1lmtrln ils)srumim oodopt mfesa(  rraumo;t1apenmfeiyslm2ranvs ()tltrif oydlpD lnvils  rum(rpnu1opt  fcsltfsDrrur ;u4tlt  oeiysfaDumnvsnt)teeoxf todom   n s ( t2xriopnydomee nvs ()aDraumpnt0oltomietadfmDrauvsnu0altrmr3oytoaDeanvs;t)t2tmimpnu1amee fcs sf 2rrxr oo0oexoii3iasfm emu p;u4arerxr oa1omDr uvo;s) exm(m3oydlp eliesasfarrmumoou1olx mieilsfa rmnvsn(0 rxrir3iadom  li i;() 2xoxo iudlmee fvils arraurpnt4apxnmocils m ra(mo;u0aetrir todom r ivi;t srtrimpiu1ole  ivi () rrm(m nt1altn f3tysfa ran snu)texrxf3ty1lp r u i s) eurxopoy1lp  lfcsas aDtm(m ;u0alxnmfeildlaDea( p;u4aetomo iy1fa eanvi ( t2xo(mpny1alte fvi tf Drr(r no4opxnmo3iyd m2ulu pn(4 rtoxr3ta1omD lnes s0 rxoxr3ny1lmtnlici sfartr( o;t4tle ii3iytfs ulnvp t)arerxrctadoa rlueslt  rxmxopno4ol emneiasf Duaxm oo0oet mf3ilsls rl( p (0alerxrcoydlaD  ieo s0s2urim nu4ame  fctlsf 2tr(mpot0aex iiciys s2ea( s u0alxoir3oodomDeli i (0s2trimpiudapt livi (fsDuaurpno4aeeniocilsls2rmn o;u0 lenmr3to1fatraieolt)srtm(opnodomeemnci t)a2urxm oo4oetnif3ilt m2elnmp;t0aeeoifciydoa  lieil(  2umirpoo4opee neta()arrmxroou1aeeniietys a uanmonu4aexoxf3ta1lmDraivs t trtmxmpoy4al  mfvilt)artru p;o0optnmoeild sDrlu s t0altomo oatla eau sls texmir iy1lptemnetas artr( oou1tlt  fetas a ra(vs t) etnir3tytoaDeli o (0trtr(r3iy1omt mfcil( sDumu  no4aptn iciyslm ra(mo u4tltomr3ia1optrlivi;(0srtoirpoodamee nctl( s2rauro;t1tpx mf3iat m um( sn(4 lenxf3totlmDr uei t0 rto(rpno1ol nlieil()a2urx  nt0olxomo3tas mDea(vp;() rxoxrcoadop eaivi;s)seumxo iy4openmnviat)sDra(rp;u4tee iietatls eauvo;u0 exrif3tytoptelieo;()setr(r3iydlmtemfeilt)s2rruro;o1tpxnioeiat m umnmpnt4 exomrciytopD livsls0 ruo(m3oy1alt mnei s)sruru  ;o1tet ifeiatls eanvp u0trxoxfciydla rlneo;(0s2urxo no4om nlnvslsfa2rm(rpoo0tetnmoctld sDran p;u)arxnifciytlptelu o;(0setm(opnu4lme  fcsasf rum(mo;t4oexn feilslmDrauvs (0trtnxrcio1lateln i;( setmir3iy4olen fesa()srtaum ;u1altnifeiydla rln o ()trxrxo iatlm  au o t setrxo3ny4olte ivilsfarraur ou1opxomfctad m rmums;()tetrircto1oatraivo;t)trxm(mpiy1lpenlfes () Dtrum ou1tex mo3ilt aDemnvp (0aeenmr3io1oa eaivs (  2tmim ou4lp elies () 2rr(moou0teeomoctas a2elnmp u0teeomrciytoa  ln s;t)trxrxo oy4apeelncslt sDtmx  ;t1aleomiciyd m eanvon()aexrxfctadfaD  n o s0 rxoxo3nydom   nct s)a2tmxm nt1oetn oetydlaDemn p;(4tlxoxo3iatom r nvsl( trum(m nydopee nci ( sruaxmpou4opeomociytla2rmnvont) lerxf3ta1faDelu i s0 2to(rpnu1al  mivt ()arrmxroou1aexomo3iys m elnvonu)tlerif3io1omD aiei s0 etoxo3iu4altemnesa(  2rmumont4tptomf3iysfs2uau p;(4 ltoircoadlm eaueo;(  rtmiopny1lptnlfvtas s2rmu pou4opxoii3tydfm2rmu onu0aetrmfcoydlm r n ols0teurxm nudlpt mnvilt arur(root4apxn oeiatlm ulnmp;()teeoxf3iotlpDraivsls  rxmxm3io4lltnlnct (fsDururpnt0altoio3iatfm2el( p t4artnxo iodopt  ueils s2uo(o3oy4al   fcs s sDur(mono4tpenmo3iadla elumonu0trtnxfcootom   neolt) rxoir nu4ap nlfvtas a2truro;t4teeo o3iydla em( s;t)alermo oytopDraueo;s trxoxr no4ope mfet ()aDtau ooo0tleomietas sDemnvo;t)arxomo3oadlp rluvslt0 eurim iudllenmfct tfs2rrumpnt0tpt  fctytlm2ea( s u4 ltoxf3iodlpDelivi s)srxoxopnu4lm nlfctl(farumxmo;t1open oetat sDemumpnt4tlxomo ty1omD aieil( srtmxo3iy1op nlnetlt)aDtrxmp;u0oex ifeiys s raums u0 ltnir oo1oa eaivi t)t2trxo3oy1amt liesat)s2uax p;u4aeenmi3ils s emums;t4tlxrif3oytopD lnvi;s) rxmiopiu1llte ivil( aruaum ;t1opxnmietlsls2rl(mp;(4tetnio3iytfp eanei s0 rxrir iu1apeemfetls srtaxr nu0olenmf3iasfm2emn p t)areoxf tatlp r uvs s)setoiopoo4opeemietasf 2rmxro;t4aet io3ildfsDrl(vsnt) ltnif3oodlatrai ols)setr(opoy1oltn neiat a2tau  no1oltomoeiys m eaumpnt0texrmf oytlpDe n o;s0 2xmio iu1lptelfeiltfarrrurpno1aetomi3ilsfa ra(mo;()arxoxr3todlpt  ivs;s0texo(mpno4olt mnesasfarrau oou1alen iciadfs emnvpnt4tetrmo oadlm raueo (0 rxrxrpno1op elivs s)a2rmurono0ape ioctysfs2rm( s;t0 etnxf oa1omD  ivo t)srtrxm nydlp n nctlsfsrur(mo;o4opxo ieiydfm2ean s;t)aeerir3iodopt  n i;s teur(mpoodap  lnetlt a2umx  ou0ape mfeilsfaDul(vs;t4 eenxo3tydfaDr ivo;t s2to(m oy4lmtn iciat  2urxmonu0aeeoioeiadfa2rmnmo t4alxrxo3iatfateanvo;( trxoio oydopeelnct ( aDtmu  oo0alxnmi3tadfaDrmn s;u4aetomr3ty1oa   i ilt0texoimpiu1olt mfesatfsrtaxmpoo0oltnifcildlaDuln snu4tlxomf3oy1fpDrau i ()s2xm(o3oy1apenlfesl() Dumxrpou1olt mociyslmDrlu p t0arenxrciadfmDranesls)sexrirpoydop n fetatfsDtm(m nt1tpxn ieiytfa2eaump;(0tlxrmr oytlpDr ivo (0t2tr(m oo4olte ncta(  2uax p;u1tpxnif3iadlsDumumont4 eerif oadfp rln s;(  etoir iu4lp nmnes sfa2tm(ro;o1apenif3iyt m el( s (4 rxrmfciodfpD an sls0t2umir3oudole mfvsa(fsrur(moot0altoiiciatfmDemu snu)aetrircootlaD li s;s0 rur(m iu4ol e netls  2ua(mpnu1aetnmociytfs rmn onu) rtrifcio1fp rau slt0sexmimpoy4ape mivil(faDrmu ont0olxo i3ildfs2rmu ont0arxniocoadlmt  uvol() 2xmiopiy4ol nmietlt)a2rax pno4opx ii3iatfs2uauvp;t)arxoiocta1fatrluvi t) 2tmio3ny1am  lieil(fartmx oot0tpt micild a2rm( p;u4aeenxr3ta1lp   nvo;t) etoxr ny1apee fet (faDrmum ;o0ale ifeiytfs2rluvonu4 rtoxo oo1fate nvsls  exo(rpnudamtemfct s  Drr(r ou1tleniicias s2uan o (4 exoxrcoytlpD aneols) 2xm(r3ny4altemicilt a2tmu pnt0aee iocilslm2ua(mo u)artnxfctydlaD au o;s0sexmxo3oy4al   neta(f Dtmu o;o4apenmiciys m eln p u)altnmr3tadlat  u ol(0 2tmio io1ope mfcsl( aDua(mo;o0aee mo3iytlsDrl( o;()arxrxo3oo1lp e n sls setm(r nydom nlfetls aDta(root4tltomfcias aDelu pnu) lxrmocia1lp   neo;t) 2urxopoydomee nciat sDrrxm nu4tlt if3tat s2elu o;u0 leomr3totoa  auvi;t)srtmxrpio1lpt mfvilt sDtrurpou4apx  o3iat s uan o;(0 ltrifciytom eai il( srxrio3no1ll nmfvs s  Dtax p;t4aexnmoetadfm2uanmsnt0trtnxr3todlptelivol( s2tmxr nu4lmee nvt ( arrax  nu0olt mietatfa2uln pn(4trxrio iotoa rlnvi;t  exrio3nudlpenlfctlsfs2um(rooo4tlx mo3ild sDrau o ()trtomf totom  li olt seurir io1ol nmivslt s2rax o;t4aptnio3tad s uanvo;u0 ltrmo3oytfa rauvol() 2xmxo3iu1am  lfci sf rtmxr ot1olxoioctytfm emnvpn(4 lerio oytlp  lu s (0trtm(o3oydal  mfvtl( a2uax oot4olen f3iasfs rlnvo;t)alxrir ty1oatr i il(0tetmxr iy4ol  lfvta(fsrtmu  ou1optoiiciadlaDemu on(0tetnxr oy1la r uvi ()texr(m3ou1am e ivsltfarumu  ;u0tlt mictlsfaDeanvsn(0aetoio3tydfpDelu s;t)t2xmio3oy1lltelfeiat a2trum ;u4oleomoetat a2ran o;u4 leriocoytlaDran i s  etoimpoodlpenlfcsltfa2umxrp;t0tltn oetysfa ulnms (0trtnxrctatfp r i ilt  2xoim3iudoptnlfcslt)sDua(r ou0tleomociadlaDeluvsnt0aeeoxo iy1faDraues;()trtrxm ny1apee netl()sDtrxmooo1texoiictlsfa uluvsnu0altnmr3iytom rauvo;t0 rumxr3oo4alt  ict t srtrx p;o1openiieilsla2eanmo;u4 eerxr3totlatraneolt)s2xr(rpnu1olen icsl()arua(ront1alt mieiydfa2rmums t0texrifcoytfmDeanvi s t2umxrpnydoptemieias)s2ururo;o4tpxomi3ilsfsDumump;u4 renxrcta1lp elneilt0 2toxr3oydapt  fvsl()s2rrxm oo1aee if3tat m2uau snu0aexrxocoo1fa  aivi s) 2xmxo3ou4ol  mnvi ( aDur( oou0altoio3tadfm rluvs t4tlenir3ta1lptrlu il() 2umxopiydaleelfci s s2ur(rp;t1aetnii3ild m eau ont)alxnmf3totlmt lu o;t  exoio no1omt lfvtltfs2tr(rp;t1apto ietyd sDrm(vp u0teeomrcoy1om e iei s0 ruoxmpiydllt mfeilt artrxmpnu4tle mfciyd s2umnvsn(4trxrmr oydlm rauvol()s2tr(mpnudalte fvs tfs2urum ;u1tltomoetat a2rm(mont)texomrciydla elnes;t)trxm(m3nydlme  nctlt)srta(rp;t1oltoiieiyt a rlnmpnu0aleomf3oa1lmD luei;()s2uoxm ny4lleemncsat a2tmu pou0olenmfctasls uauvpnu0alxoif tydfa  auvolt)seuo(r3iy1aptemivt sfsrtr( o;u4oleoiicils mDulu onu4tlermo ta1fatr nvi;(0s2umio nu1ll  lneia(fa2raxro;u1oetnmietas s2ul(msnt) leoxociytla  aieolt0sexm(m3ny4amee ivs (fs2umuronu0alx mietadfs uanvont4trermf oy1om  lnvols texmxm nu1lme mnetl(f rrax  ou0aetn f3ild m2eanmp t) lxrio3iadop eau o;t0trxm(rpiudomte ies sfsDum(  ;u1apx  fetlsfa rm(vp;t4trerir todlmD auvol()trxoxr oy1op   nvil(fa2ururo;o4teto oeiysls ra(mo t0alxrxr ia1fpte uvi ()s2xoxr3oudllt  nvi sf Drr( ono1olx mi3iysfmDeauvs;u0artnmr3iatfpD lues;(  euoxm3oo1ll e ncsl(fs2rru o;u0tltn o3iltfm umuvsnt0 etnif oydlmtrluvi (0trtrxmpiydomtelfeils)srumxrp;o4aex  i3iat a uan s;t0 eeoif3tatfp  lu i;s0s2xoxm3oo4ome mnvt s srra(r ou1oeeomictytlm2rmuvs ()tltoir3oy1lptrlueolt)seurxr3oy4ol e neias) rur(r ou1aexoio3iyd a eau o;t4altomo tadoatean i;s0 rtmim3oy4olt miet ( aDrr(rooo1tlxniocils mDuaump u0teenio3oydop raneils0s2uoxo ou4op emfvtlt a2ur(mpnu0opto ociadfm2elnvp;(4aeerxo3oo1omDranes;s)setm(opoo4lp emfetlt arur(r ou0aeeo o3iyslaDeau pnu0 exnmfciydfpt  nei t0trto(r io1apeelfeias sDrm(  ;o4tpx ifciytlm eau o t0trenifctatlat anes;(  2tm(m3io1lptelieiatfaDuaur ;o0teto oeildlaDulu p t0 ltoxf totoa  anvsl()texoir nodop elnci s  rrm(mono0tpxn f3iaslsDemumont4 leoxf3oy1oaDe ieo;(0 exmio iu1ap  livt s)s2uaxmoou0oex iictls sDrl(von()arxrmo totlm eaneils)s2xoir3oy1llte ietat)srta(mp;t4tetn o3iysfmDumu p () ltrmf3ootfpDeln s;() exmim oodaptelnes ()a2urumpoo0aleo octas m2ranmo;(4 reoxo tytom e u i ( s2trim no4lpeemnvt ()aDraurpou4alenmf3tys s2elump u4 lenxr oy1la r uei;t0 eto(m3nu4ale mnvsl(f rtmumoot1aex mfctldfa2ra( o t) rtriociodfpt  ivi;t s2ur(rpoo1ap nlicilt artax pou0tpxoioetydfm2eau s (0 lenmo totlpt  nvo;( s2toiopny1altelfvtlt)arrr( o;u1alen oeiat s2rl(monu)aexrmf3iotfpDeluvi;()setm(mpnydolenmnvsa( srrrx ono0oltnioetydfa2ua(mp;t)arxoxo3oadfmDr neilt trtr(r iydapeelfctl(fsDtmum ou1teeoiietltfa2elu o u)aetrxf tadlm eauvsl()srxmir3nodlm   ici t) rurumpno0opxomf3iasla2rm(mon(0 rxrxfctadfpD  i o;()srtm(o iy1lm e fvta(  rumxrp;o1tpen o3tltlsDrlnms;u4tetrmrciy1lmDelivo;s)t2xrir3ou1amtelfvslsfa2ua(mp;u1aexn fetadfs2el(mont)tleoxf3ia1omte u sl()sruo(rpny1opt mfcia(f rrmumpno1tpxnmociydlmDrlumpnu4altnxr3iytop   u
\ No newline at end of file
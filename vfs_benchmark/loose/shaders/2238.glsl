@@ -0,0 +1 @@
+uei;s0 2trim io4lp nlietat)srurxroot4tle iieilt aDumnms t4alxnxoctotlpD aivs () 2xoxm3nodlmtnlfvtlt)s2uaxm ;u1tltoif3ias m um( p t0 eermo ty1lm ean olt0 rumxm3iydlmtelnesatf rrrur ;u0oeenmf3tls s rauvpnu4 eeoio iadlp e i s () exrimpoudll   net ( arrrumoot4tlx iicilt a2umn sn(0aeeomr tydoptr iei ( teumir3io4al nmiciltfartm( pot4aeeo i3tyd sDrauvsnu0 lxnxo3oadfa   i i ( sruoxr3iu4lm  lnci t aDrrxmpnt1olxn o3iat m2uauvs;()tetoxfcootfpDean o t0teuoxo3oodlmtemfcias)aDumxrooo0opx iociytfa2eln s;u4 rxnif3iadoat lueo;s tetmiopoy4omeemivsas  rrmur ;t1teeoifeilsfs ean p u0arermoctydfa rliei t s2to(r3nudamt  netas)s2rrx  oo4tlxn o3tasfsDemn pn() rxrxf3iotla rlu s;t) 2xmxrpou1ol   fesl()a2umx oot0tpxniociysfa rl(vpnt0 exoif3oydopDe ues;(  2umiopnu4olee feslsfa2umx p;u4aex  feiadfs eluvpnu0 etoxrcty1lat  u s;s) 2tmxrpiu4ame mivsl(fs2trur ou4opx iocils s2ra( s u0 lxnmrcia1fatrlu o t tetoxm3oudlle mnvs t aruaxmpnt4tetomi3ilt m2rlump t)arxrio3iydom rau ols)s2uo(m nydop  lneta(farumxronu1olxoiocilslm umnvp u4 lermrcoodfm eau o t)trxmir oydolte ieiatfs2uaxmpnt4olxoioctadfm2rl(vsn(0 reoio3oodlaDraivs t  rto(rpnu4llen nci tfaDrauro;t4apx ioetadlmDumu p;t4 rtnxo oadla eanvo;s setrimpoudalte ici ( s2rr( pno1oetniiciydfa2ranvs t0 exnxrciy1oaDeanvs ()trxmxmpoodaltnmfci (fs2tm(rpnu1olxniieiydfmDumuvs t4texoxocia1op rauvolt) rxr(mpio4lm nlivia()arrm(mo;u0tlxnifciatfaDeanmpnt0tetoir ootlmtraivi;s)trurxmpou1op   fcilt) ruax ooo1oee ifetlsfm rlumsnu4 etoxr3oo1fatraies ()t2uoxmpiu1ope lieiatfsDrau pou4opx iietasls rm( on()tetrxociadlmte ueo;t  ruoxr iudlmtemivi t) rua(mpot0oee  ietyslm emumont0artnmr oydfptraies s) 2tr(opio1optelietas a2uru  nt0tptnmfetydlm2ua( o ()aeenmo3iotom eau ils0 exmxmpoudale lnvsls)aDtaum no0oet ifciltfs2ranmo u0tlenxf ty1oa  ln ol(  2trxo3iy1lleemictas)arra(r ;o1tpx iietatlm2um( o;(4altnmociodopDe i o;t t2to(opio4lle mnct (faDtmu pot4ope  ociyt s eanvsnu) rerif iydlaDraivo;s0 rxoio3iydomt lnvsls  2tmum ;t1ole  o3ildfa ulu s;(4 reoio3oadom r n s s0texrxm oy1amtemivslt s2trxmpoo1oexomfctytlaDean onu0treoif iytomt auvs s0trtmxr iudllen nci (faDrax  oo4oexnioeiatfmDemuvp u0arerxfciy1lmtelueo;()setoim3oo1lp  mivs s artmxr nt0alx io3tas a2uln onu4 rtnxocoadoaDrlu sl(  2xoxrpoo4alt mfetls) 2trxmpnt0tpxnmfeilsfm um(mont4aetoif oodfatrlivo ( srtrxmpnodamtnmfei () Dum(  ot1oleoioeiyt aDumnmsnt0tetrxr totlm rauvs t) etoxm3nu4opt liesasfsDtr(mont4tpx ifeias m ranmp;t)texnmo3oa1fpDrln s s) exrxm oy4amtn ictat s2raum no0apx mf3iat s2emuvo t)texoif oadla  lieo ()texm(r iy4ol nmncs s s2rrxm ;u1optoii3iyt m eaump t)altnmo oa1lp e i ols)truoimpio1lp nlnvs sfs2um(mpnt1tptomictls s um(ms;t0tetnmo3oa1fmD lneol(0s2uriopiy4lmen nvslsfaDur(r ;t0alx if3tatlaDelnvp;()aetrif tadoptraues;s0t2to(r no4omt  netlt a2ra( pou0apx iociyd mDrm(mpn()arxomf oatoa rlneil(0srxmimpiodam  mfci s artaxrpoo0aeenio3iys m rau onu0aeermr3tytlate i il()s2ur(mpoy1lmtelfvs t  rtrx o;u0tltn f3iltfmDul( p;(4aexrirctytfm  lnvo t)s2tm(rpoy1lpee nci (  Dtmum ou4alto fetltfs eau p;(4arxoxo tatoatr u ol()sruoxmpny4omenlictl(f rumxmont4tpen fctytfs2ean p (0tlxnirciotlmtelivi s)teuoxo ny4openmiet (fsrtrum ;t1apenifeiydfaDeanvo;t4 lxoxr tatfmDe ivslt)setoim3oydlm nmfvsltf Duaurpou0oetnmoetydfa ea(mo u) rxoxfcty1fmt  iesl(  2uoim3no4ll n ivt t)aDuax p;u0tpto iciydla2emnvonu4trtomfciodlm   nvslt  2uoxm oy1lltnlies tf Dtax ooo0teenmoeilsfm ulnvo;t4tlxnir3tytlp   ueo t teuo(mpno1ope  iei sfaDtm(roou4olx moeiatla2umumont4texnmf3iydla e iei (0texmim oo1oleelfcias)arrr(ront1altniieiat a2uanvs;u)aexomf tatlmDrli i;t0s2xmio3nu1ll elics () rra(ro;u1altniictld a2em(mpnu0 eeomo3io1latrlueo s0trtoio no4am e neias)srrmxmo;t0oexniociydfs umnms;() rtrmf tatlmDr neol()setoxr3iu4amtn fci ()arur(r oo0optniociat sDulump;t4arenmf iotfmtr ueo;s srumxm3nu1lme  ivt sfarum(moou1teto octyt m2rm(mp;u0artoir tatlmD an i s) euo(o3iu4ol  lneilsfaDrmxmp;o4altnmo3ils s2uauvpnu0tltoir3oatlptelivs s s2tm(opny4olt lici t aDta(monu4alx  fcildla ra( on() lermrctytlpD aiei t0 2tr(m3ou4oltelicsl(farrmu o;o1oexoiieiadla2emnvo;(0 etoxo iadfpD ai il(0 exmio oy4al e ies ()sruru  ;t4openioetaslmDrauvo;u)teeoir todop  lieol(  2urxo3io1lmeelfesa( s2ur(r no0ale  i3iyslmDemumo u)artrif3tatlat  u i s) 2trxo3io4amtemnes sf 2ua(ro;t4aleo i3iyd a rmnvo;()arenxo3to1lpt li sls s2urxo3nodaptelncia() 2trxmo;t1alenmfetyslsDemnvsn() lxoxocio1fmD lnvolt)seur(m3iydamtnlnetas arrmump;u4tptnmfeiatla rau o t0 lxrxf iytlp elnvi;( seur(m oy1aptn fcs ()a2umxmpno1tlxnmo3iysfa2rmnvs () exrxfcoa1op raivo t) 2uoxopno4ap  lnciat)srrmu  ;o4aee mo3iysfsDrmnms t0 lxomo io1laDeau sls)tetr(m iy1lmenlict sfaDtrx pot1olxnmieiaslm2umumont) rxoxocia1lm  anvi t0 etm(m oudopt  ietas)sDtax  ou1opeoif3tldfa2umuvp;u0aexomr ia1lmD lu olt t2xoxopiudam  mneia()a2tr(moot4oeenio3ils s2elumo;t0arxrmrcia1lmt lnvolt trtm(m oo1lmeemivsl()a2taxmpno0apxnifcias s emuvo (4trtrxo iotlmt li s;t) rxrxmpno4llenlicta() ruaur no1tptnmoeiyd s umnvsn(4trenir3iy1fp eaies (0trtmxmpou1am nlfes s  Dtm(rpot1alt ii3iatls2el( pn() reoir3tydoa  auei t0setmxr3iu4optelics t aDrm(mpoo4tltniieils sDraump (0tltriocoatfpDraneil()setoxo3ou4ol nlivslt)aDrr(rpnt0opxnmictaslsDul(vpnu) etrmocoodoaD lies t)t2tr(mpnu4ll  lnvil( sruaxmp;t4tlt mi3iytfaDrluvo (4trxoxfciadfmD an s t) etr(mpny1ope lnvs sfa2uru pot1olxniicilt m2ra(vo t0aetnif3oadfateaivil()s2uoim3oy1om   ivil()a2tm(r ot0oeenioeias s ulu o u4 etnxo tadlptr n ol()srumxopoodapt miei t) rrau onu4oex mf3iysla2eau ont4trerxr ty1laDeli s;s0s2trirpio1ale  iesas)sDtm(ronu1oeen icildlm2rmump t0artoxr3tatomt an s;t t2xrxr no4altnmfct (fsDrmurpou1tlxomo3tlt aDrmn s u) eeomfcty1lat lu olt)s2uoimpny1op nlfei t a2ur(  oo1tpe mo3ils m2uan o;(0aeerifcoydfp eai i s0 rtrio3iy4op nmivtas) Drm( pou4tptnifciltfs eau on(4tltnif3iodfa ranvo;()s2xoxr3oo1ll e fesasfs2rm(rooo4opx moctlt aDuln onu) exoioctydlm r nes;( trxoxopoydlpt mncilsfsDrrxmo;t0tetnif3tydfsDem( o;t) rxoxf to1om rlnvs s)srtoio3iodlpen nes sfaDuau p;u4olenmoetlt a rl(vsnt) rtnmo iy1oat ai ils seumim3iy4op   icsat a2tr(moou4ole mociatfm ea(vs;t)alxnxo oatfpt anvo s)t2trio oy4ole  fetat)s2tmxrp;t1aexn fciysfa2ulu s;u0texoir3oa1oa ranei;(0trtmio3ou4lptelfcs tfa2umu onu1opeo f3ilt s rm( pn(4arenxf3iadfm  lueo;s s2to(opno1lm e fctl(fartrx pot4teeoii3iyt aDrau p u4 lerio3todlmtrluvo;t  etrxopoy1lm nmneils)srrmxmp;u4apx  f3tasfs2uanmo;(0aetrir3tatop rlieol() 2xrio3io1lptn fct s  rtr(rpnt0aexo ietydla2um( s;u4arerif3iy1lm  ai o s0 rxm(o3nodll n neias)sDta(mpnt4tlx ifetatfs2uauvs u4tetnir3tydoa elivo t srxr(rpno4lpt mfes ()srtaxmoou4altnmfeiatfs2uanvp;t)teeoxf tytomDe ieils)srxoim ou1alt  nciltf Draurpou0teeomieiaslm rluvonu4 exnio3tydfptelieil(  2toimpio1aptelfcs sf rurx ooo4ope  i3ilt s rluvpnu4 rtnir tydlmDraueolt0t2umxo nydol  licsas) Dtaxrpno4tlxomfciad aDean snt4trerxoctatla  lu o;s  rtriopio1lm emfct sf rumu ont0aet ifciltla2rlnvo (4tlxomr todfaD luvs (0 exm(o3oo1opt lfvtas  rumxroot1opxomfeilsfsDrmnms t4altrmf todfpteanei;s0trxoxo oydlpenlfciasf rrmu  ;t1apxoiieiydfm2umnvo;(0 exnxo3to1lmtraieolt t2trim iudomt lies t)a2tax o;o0aeeo f3iltfm2uan sn()trerxfctytopDrlneol(0s2umirpoo4optelfesl(fs2ta(roou0tlenmoetysfsDumu s () renmrciadopt aieo t teumxo3iy1aptnliet tf ruau  no4olx mocildlm2umuvsn(4altoxfcoa1omDran s;(0s2uo(rpny4lleelicta() Dtrxmp;t1oeeoifeiad a2ulu s;(4aeenxociatfmte neo;s)srxm(opoo4lptnlictlt s2ua(ro;u4tlxnmoeiatlaDumuvs;t0teerifciydfp eanvi;t s2uoio oo1altemivta() 2ur( o;t1oetomfeiltlm2em(vs t0 lerxo3to1oaDrlnvilt sexr(r3oo1llt mnvtl()sruauro;o4alxn ieilslaDulums;(4 ltnxf3io1lateluesl( texo(mpio1ale  ietl(faDurx  no4oexnif3iysfa em( p (4altrirciy1oat  nei (0t2tmirpiy4omt lnvt t)srtm(r nu4olx miciytlm2umnvs u)trxnmo iotlaD  n i s t2uo(mpoo4optnlnet (fartm(mp;t1ope if3iat sDrluvp (0aeeomrcta1oa e ueo;s0sruoxo nu4lm  mfcsl( aDuaumont1oeeoioetysfa2ranmp;u0teermfcoo1laDrlueols) 2umiopoo1ll emfei sf rurx o;u4tpt ifcildlaDemnmo (4artomo iotfat livolt0 rtoxo3oy1lpt lneiat srur(m no0altn i3iatlm2ranmpn(4 etomo3ty1oaDranvi;t sexo(opnu4opt  fet s  2raxmono0apto ieiad sDrm( p u4aeeoif3oytfa r u o s)teum(mpiudll emfes t s2urxmpnt1oeeo iciltlaDuan snu4trxomfctydopt  ies;()trtrim iodll nlncsat)arrm(m ;u1aet ifciltfa2emums;u)trtomr3tytfmte ieo t)trtrxmpou1aptelnvi ( s2rr(mpoo0alxomicild a ulums;()aexnxo ty1om r ieols0tetr(r oy1openmfesa()aDta(moot0tpxnmoetas mDua(mp t)aexrmf ta1lmDrlu o;t t2urir io4apenlnvtlt)a2ra(m no1oex  oeiaslm rmnms (4 rtnxrcoadlmt li ol() 2trxr iudlptn fei sfsDrm(ront1opxn i3ild m2rm(ms;t) lxrio3iy1om  livs t  etoxr iodole  fet () 2uaurp;u1oexoifeilt a2emums;t4trenmr3oo1fa eaivo t)sexr(r3oo4om n netat  Dtaxronu4tpe ioeiydfm2uln p;u0 lxnmr oo1lpD lies s0srtr(r3iu1ale  ictls)srtmuronu0olt  o3tyd s2elump;u4 rtrmr3oadopt ln s;s0seur(rpny1altelnetl( srrru  ou1olen ociytla rln p u)alerircoy1op  li i ()trtmiopnu1opeelnciltfaDrmu oot1optnii3tysls ea( o (4teenmrcoodoaDrauvo;()s2uoxm iy1om  lieiasfaDtrx  oo4ole  iciatlm rl( onu4aeeoifciytoa eaieo (0 rxo(mpiudame livsl(farrm( onu4optnmicild aDrauvo t4areomfctadlaDeliesls) 2toxm3iudopen fei () Dtmx ooo4olt  ieiyd a ra(ms;u) etrmo tatoaD au i;t srurim nodll nmfvilt) 2umx o;u0aee ifetysls eauvo;u0texnmr oo1fa elivs;s tetmim oy1open ies () rtmur ou1olenifetas s raumsnt) rtrmo oydom  aivo s teuoiopio4ap nmicsat) Drmxm ;o4oetomfciysfm2ulnvs (0texnmf oydomte nvo;s)setoio oodapt  nesat  rtmum nt1ale mfciysfsDrlu o;() lerif3to1fp eln i (0srxrxo oy1lltnlfesa( sDtaxrp;t0olxnioetytls em( p (0texoxrciydlptrlnvs ()tetmir3iodaltnlfciat arra( ont0texnmo3tys a em(vont0artomfciydfmDeluvi t0 2xrxo3nu4optemnvtlt) 2uauro;t0olx mfetadlaDulu o (4trxniociy1faD  neols)t2xrxo nudlmeelfetltf rumxrp;t1opxnmf3ilsfaDumn sn()tlxrxr3ootfmD au slt0setrxm iydap elnci ( sDraxronu1apxo feiydfm uanvo;t)tlxnircta1fmtr uesl(  rtmimpou4omtelfcsltfsrrmumoot4olxn oetldls2rl(vs u0 eermf3ia1lm rlueo t trxr(m ny1opee ncsas)aDtmu poo0tpe ioctltfs2ul(mon(0alenirciotlmtrli s t0srurio iodlpeemnei sf rrm( pno0tetn fctlslm2uln p t4trxomf tytlmD livo t trxmxm oydomenlnvia(f 2raxr ou1alxnmieiltla2ra(ms t0aexnio3oadfmDeln sl( srxrxopiu1lp e ivsat)aDrmu  nu0oet  fcildls emnvs t0artnmf ta1fp  au i s)seurxrpno1optnlfcias  rtax poo0alx miciad mDrm( s t0 lerio ia1fate uvol(  euoio3nydomtnliesl( arumumoou0oee ifeiytlm rmums ()altoxo3iatlat livs;s s2um(opno4amte fvsas  Dra(m ot4alxnmi3tltla ulnmo (0 etoif iadfa eau s s0 rurio3oydopenmfcilt) 2rrxmp;u1aexoii3tldfs2rl(ms (0 leomo oy1op e nvo;( teum(r io4alte fvt s) 2rr(m ot1texn f3ildla ulnmont0 lxnirctytfpD  ueo t  rxo(r iu1ll n netl(fs2rm( o;u0ape  oeiatlm rlnmont0trtoir3oadlatr nes;s0texrirpou1llenmnvtlt  Duaxr no4oetomictls s raump (4tlerifcoa1omD  i s t  eto(m no4ole lneslt  rraxmo;u1oetniieilsla2emnmonu)texoirciytfmDeluesls0 exrio3iydlle lfetl(  Dtmump;u1aeenifetatls2rluvo;t0teermfcoatfa raieil(0trtmxm iodopen icilsf rrrxm no4opx ii3iat s2rmumo;(0aeenxrciadoaD  nvi t t2xoxr3iydlp  mfvtasfa2uaum ou4aexo fcild a eaums t4 eerxo3tytomDr uei s)sexm(m no1alenlfcil(farra(monu0oeeomo3tysfsDua(vp t)trxoir to1fpDr nei;( sruo(m3ou1omtn ivia()sDrrxr ou1tex mi3iasla2eanmp;t0aexrxo oa1fp  lues t  2ur(mpiu1amenlncsa(  Duaxronu1texn ictltfs2elu pn(0 eerif3oytfp e n slt t2umxmpoudop   netat  rrrurp;u0aptnifciltfs eluvont4alxomf3oytfptr ieo;() rtmxrpnudop nlieta()srtax onu0opeoiieilsfm umn snu) ltrxr iytfpt  ieol( t2urim iudop nlies ( arum(m nt4apeniieiatlm2ulnmp;t0 reriocootlaD lu o ( t2xm(r3nodal  livils  2um(mpnu1tpto fetyd aDeauvsn()trxnxocto1laDeai s t  rtoir ou1ol   ici tfs2ua(r ot1tpt miciaslaDumuvo;t)arxrxr3oadlat auvo;t0teurir ou1openmict s aruru onu1texomo3tlsfaDeluvp;()artnir oy1omD aivs;( t2umxo3nodlm n nvia(fs2tmxr ot4aeeoiocilsfm eluvo;t0 exrmrctadlmD anvo s0trxo(r3no4ope lneiatf rrrurpnt1olxnmo3iyt s eauvo t0 exrir3to1lpD ln ilt texoir3iu1oltemfctatf rtrxr no4teen octys m elu s () etrio iatfmDeauvsls) 2um(mpno1ol nlnci s a2uaxm no1alxomo3iydlm ul(ms t)texoxf3oo1lmDr i s ()s2toxr3oy4lp nlfvsa( sDrru p;o1optnio3tat m2umumpn()alxnmf3totfp eluvo s srxoxrpoydole lfvtat s2um(r ;o1optomf3iytfm uau s u)altriocoadlm eaueilt  2xrxr ou4omtelfciltf rrmx pnu4oexnmiciasla2emuvo;u0aexnifciydfpD  u s;t0trtoxo3iudlm n nei t sDururpno1aet ifetasls rl(msn()alxoxoctodlmDeli ols0t2xo(m3io1olee iet ()srtaxmpnu1tlenioeiytls uanvo;u0aexoxr oatfp e nvo t0sexr(r3oodape mfvtls) rrr( o;o1oeeoii3ildfs em( p;u4tlxoxf iydlmt lueo ( t2xoxm ny4am eliet ()a2tmu  oo4oeeomo3iasfs rmuvpn(4 leomf3tatfm rli s ()s2tm(r3iy4oltemnvil()a2uru ooo4tlt  i3iltlaDul(monu4aeeomrcoytoaD lneo;t  exmim nu4ope  fctlt  Dta(m nt1aeeomfetyt m eanmo;u4tleoirciydoa e ieolt  rxmxr no4altnmfes t)srtrx  ;u0oleo fctlslmDrlnmp u4tetnmr iatopt  u s;t) euoio3ou4apt lfct s) rurxm ;o4ape  icilsfs2ul( o;t) eeoircoy1fp r nes;s s2xm(opnu4op n ieta(  2rruront4oetnif3iaslm uluvpn()aetoxrctadfp e uvs;s trumir3nu4opeelfetl(  Dtm(root0olt ioeiatfa2uanvs t) lxoif3tydfmtr nvi;() euoirpoy4ll   fcslsfarua(ro;o0apt mfciasfmDea(vpnt)alxrmo3oodoaD lnvs s) eur(mpnu1ape mfesa()aruaump;u1tpxoiieiatfa rl(vs t) ltomfciydomtelu i;s s2trxopiu1alte nvtlt a2taxmoot0altomf3tytls2uan s;(0 rxnifcoodlaDe ivolt srur(mpno4omee fci t)a2taurpot0tpen icilt a uanvpnt)treomf oo1op eluei s0trxr(opno1amte ivtasfsDur(mont0ale mo3iyslm em(vont0 exoifcoo1opDelivslt s2trir3iy4ape mfctat)artm(mo;t4tpenmi3iyt a2ran pnu4 ltrmrctotla raivi ()t2umxm iudom n icsa(  rrmump;t1ale moctat a2ul(vsn(4alerir3tatopDranvils srxrim io4opeemnvta()s2tmu pot4tetomietydls2rl( onu) lermo3totlateaueo;s0 rxmxr oydaltnmiesls)aDta(rpno1altnmf3iadlmDrl(mo t4arerxrcoy1lp eau ol(  2trir3oudomt lfetatfa2tmu  ;o0ale mociadls2emuvs u0 ltrircoatfat aueo s trtrxm iodaptelfes tfsDrru  nu1aeenmfetldfa2ul( onu4tlxnmf iytoaD luei;s t2tmxmpny1ap n ict s artaumoot1olxo oeiat aDran pnu0altnifcta1oaDran s ( texoirpnu1opt lncs t)a2ta(r no4aexomfeilt s um( o u0 lxrmr io1lpD  nei;t0s2trxrpnudameelfcsasfsrrrum ;o4tee  ietyslaDum( onu0tlxrio3iydoa rlu o;s0 2trxrpoy1lmtnlncils arrm(r ;u0aexnioeiyd m uaumsnt)texrif3oy1fa  ai olt0trxmxmpoo4olt mfes t) rtrur ot4oetnmo3tlt mDrm(msnt0texoxr oadop elu i t  2xrxo3nudolt mici t) Draumono1olx  o3iat mDuaumsnt0 rerif3oadomt  uvi;(0trum(mpny4optemnvtl() rraxr ou0aetnio3tatlm emums (4 rermfciydfm r nvo ()trurir3io1ale mncs tf 2ua( p;u4tetnmf3iyd sDem( p;() ltoifciatlp raivolt) rxm(rpou1apeelnvtltf Drmxrono4opx mfeiyd a2umump u)alxrmociydfaD lu s;( s2tmxm3oo1openlnvta()srrr(rono1alxn o3iadfs2emnvs;u)arenxrctodomtelivi;(0trur(r3oydoltnlnvi tfaDuaxr ou4tltnifcias a umnvon()aeenxf3oy1fpDeli o;(0 rumir3io1aptelnvtl(faDraur ot0tlt  fcilt a ranmp t)tltrmr tytlateli o s  eurxm3ny4lmt mneta( s2ua( oot0olxn ietadlmDul(mp u4 reoxf3oa1lmtrlu ol( setoio oudll   fesls) 2rmur no4tpxnio3tltfaDelums;u4aleomr oy1oat aneslt t2trim3nu1lmt livsltf ruax  ot0opxnifeild m ulu o u4 rtoif3to1lm  aivi s)texmim3oo4ape  ieia(f 2uaxmpnu4alx  o3tltfsDuluvp t0artnxf3oy1om rlieols0 rum(o3no4lp   fet sfaDrr(mo;o4tlxomicias m2uluvs t)teenxr oydlaDrln o;t0srurxm3nudll n fci ()srraumpou4tpeomocildfmDul( s;() exrxr3oy1fmtrlivo;t0seurxr3io1om  lfvtasf rtrum ot0texomfciydlm2rl(ms;()texnxrcoytlpDe ivo;t) rxrxr3oo4ll emfci (faDurxmpno0tpt iieilsfa rmuvp (0alxrifcootlmDranes s0sruo(rpiu1ame lictat srum(  ou0oeen ieiydfa2ean s t4teermrctadfp eluvo s0t2tm(rpio4lmeelnct t)srumum ou0tlxo ictlsfa eaumsn(4trtomo3iydlmt livslt)srxr(r oodamee iesls  2ta(moou0olxo ietltfmDraumsn()alenio3iytlp eaivslt0 2umxrpno1al   nvsas)s2rau pou1aetnmi3tas a ran s;(0texoxociy1oaD luvs;s)srumirpno1ole micia() rururpnt1tltniiciltlaDulump (4aeeoxr3oydlpteanes t)t2xrxm3oo4ol n nvt ()aruau pnu4aet mfctytfa emu o t0 etnxr oytfm r i i;t) rxr(o3oy4altn ncs tf rraum ;t4oexn f3tyt mDranmo;()tetoxo3ta1laDeaues;( srxrir3oo1ll n iesa()aDra(m ;o0aptnmoeilt s um(mp;u)tlxnmf to1omD  uei;t)t2umxopoo4lmee fcilt)aruaurpnu1apt ifetltlaDuanvo u) renmr iadoptrluvs ( srurirpio4op nmfcs s) 2rm(r ot4aptn o3tys a emnmp;t4 lxrxr oo1lpD lnvs;()tetoirpio4ame  fvs s  rtaxmoot4tpen feiat a uan snt) rtrmocty1op   i ols)seumirpny1amt mnvtl()srrrxmpno4ope mf3tys m2rmuvp;(4trtrmocoodoaD  u o (  rxo(o3nu1optemnvils  rtrurpnu4aleomoetltlm2ranmo;(0teenif oy1omtrluvi (0tetmxr3nodolenmncsltf Dtaxrp;u4tleniictadfmDumnmp;u0trtnmf3iotlaD auvols texrxmpny4lmeemncsas)srtmumoou1openifciydfm ea(mp;t)aexrmf3tatfm  auvi (0srtrir oo4omenmnes ()arua( oot1apx miciad sDra(vs u)tltnif totfmDrlueils0srtoxo ny4aleemivs sf Drrx p;u4tpxoiietltfsDulu o;t0 rtrio3oy1lpD  ieil(0 eumxm3nu4amenmivs sf rrmumont0opx iicils sDeln p;u) renmrcta1laDr uvsl() rtrirpny4lp emfci sfs2rru pno4oleniieiasla rluvs t4alxnmf ootlptran o s)t2xoxopiy1amtelnetlt) Dtr(mooo1aeeo fciydlm ea( pnt)altrif3oa1lp   neilt)tetr(opiy4lmtnlivtat)a2rm(m oo4aexnmfciasfsDrlumonu) rxomrcoytomD au i ( tetmim iy1om  lnei ()artr( p;u4apxo i3ild m2ea(mp u) exoif3oadlmtrau s;s t2uoirpoo4al   fes (fartmumo;o0oetnmi3tldlsDrau p u0altomo3tytlaD  neo;t t2xo(o iy4lmt liet s)srtmxro;o0tee mictydfm rlnmpnu)tltnircoytfaD lnvslt  2uoxm3ny4amt  nvtas srrm(mooo0apx ii3iydfm2ranvsnu) lxnmf io1la rlnvsl(0 2xoio3nu1ol   ictlsfaDtrxro;o1tlx miciasls2emumpnu)trenxf tatoa raivslt) 2trir3iodol emnctlt  rraxro;o1oex iieiasfm2ra( pnu0aexrmociydlpte uei;(  rtrxo no1lp nmietas a2urxrono0aexo f3iys mDemumsnt) eerioctytop  lu i;t  exrxmpoydap   nvslt) 2umx  ot0texo ocilsfm2uau p;(0 rxomo3iadoaDe i o t)teum(opoodal elfei ( arrr( pnt4tltn ieilsfaDum( o (4 rxrmfcio1lmDeluesl(0trtoirpoudomen icslt a2taxm ou1alxoiiciatfs2uluvs (4aexoif oo1fateau i (0t2xo(o3iudamenlivs (fsDrmur nt4alx  fctlsfm eanvs;t)artnmr oy1faDr u s ()s2xrir3iydol   fvsas arrruro;u1tet mi3tas s ea(mpnu4artnxr3tatopD  ies s trtr(mpnu1altelivia()artm( poo4apeniiciysfsDrmump;(0 lenmrciydfpD auvo;s)t2toxm3iudlp e ici tf Dumx o;o0tleoiietlsfs ua(msnt) lxrifcoatfmD lu o s0tetoxrpiudlmtnmfesa( aDurx ooo1optomf3tatfmDumnmp;t4 etrio3iy1fp r u o;(0trxm(opno4ole mfvias) rrmuront4tlxomfcildls ea(vpnt4tlxnxf iodlmtr u o s srxmxo3iy1opt micsa()artmumoou1open ictyd s ua( s;u4trermo3oatlp  lieols  2xmxmpio1lpte ici s)a2trx  ot4aetn octaslsDumnvsnu0aetomo3io1lptrlu il() 2ur(opiydllenmnvsl()a2trxr oo1tltnmi3iad sDul(ms;u)texoxf3ia1opDrln i;t)t2to(r oudopeemnesatfaDraumpou4aeen ictatfa ranvp (4arerircty1faDrlivo;() etm(r ny4ol n ivs s  Dtaurpoo4olt io3iadfaDrmnmo;u4teenio3ia1la   nvslt)t2umim3nu4amtnmieilsf rua(m ;o4olen feiys s eanvpn(4arxomrcio1oateluvolt0seum(r no1amt  fciltfsrtmx p;o1oexomictls sDrau o u0trtomo3iydfaDeauesl( setrim3ny4apt mfeil()aDta(r ou0ale  ocilsfs rmnvont) lermrcoa1lp eanvi s)s2xmxo ou4lle  netasf 2ur(  ou4aexn oeildlmDelnmpnu)alerxo tatfpD  nvo ()teumxo iy1al  livi s s2rr( o;o4teeoii3tyt a rl( pn()aexniocto1faDraieo t0seurim3no1al   fcias s2raxrpoo1olen f3iadfm um( onu)tlenxf oodfaDelnvs t0 rxmimpou4lmeemicia(  Duaxrpno1olxnmfetasls uauvp (0 lxnxr3tadfaDeaivi t s2um(rpnodalenmfetas) rrr(rpnu4tlxo ociltfmDum( s () rtrir tydfp r nes ( trxo(m3no1ap  mfctl(fsDrmum ;o4tex ii3iadla rl(vo;u)alxnmfctodlpteaues t)t2tmio3ou1ol  mfcta( s2um(r ou0tet  octas s2rmums;(4 ltrxoctodfp rauvilt0 exo(m3iu4am n iesltfsrrruronu1tetn ictldfm2rau o;(4 rxrifciy1fa  auei;() eur(mpno4omtnmnvtlsfs2ua( pnt4altn ietlsfs el( s u)trxrir3ia1fptelneo;()srumxo nudll   ics tfa2ur( pou0tpxn f3iadfsDel( o;(4 eermo todfa  aivs;t0 euoxo3oy1op n nei s a2rr(mooo1tleo fciyd s rlnmo;u)tltrio3oy1faDeaueols0 etrxo oydoleemnvs s srtru pot0opxomfetydfa2emnvo u0texrmocia1om e ivi;s) etrimpio4lmenlncilt aDrrumono0texn feils s umnms;u0 rtnxfcoatfpDeluei;( t2xo(m3oudalte nesls  rrrx  ou1oexomieiytfaDuluvs t0aexnxr iatom  ln i;s s2toirpiudomte icil(fsrrmum no0tlt moeiasfs2umuvon(0tlxnio3ia1lateanei (  rxrxr3oudal  lieta(faDurxr ou1aptomo3tydlsDrlnmo u4 exnir iytfp   nei;s0s2trxo nudop n ncils  Dtr( pou0apxomieiaslm ra( p;t4 lxnxr3iytfmtr uvils  2uoio nu1opt mncs (fa2uaur ot0alx io3iltlaDumnvo;u)trxrmr3todopDrlnvo s)texm(m oy1altnmicslsf Dur(r ou4apxn ocildlmDeanmpn()aetnxf ootfmteauvils)trtm(r no4ll elfcs t)aDur(mpnt0apxn fciltlm ul(msnu)treomr3iytlm e n i t0seuo(r3iu1altemfcsat sDrrxmp;u1apxoiociatfa2eln o;u0teenirctadoaDr nvslt  2urxrpny4amte ncilsf Drrum ;u1aeto f3iydlm2um(von()arerxf iatlpteli o;s0srtm(m iodll elnvsa(fsDtau p;t4opeo f3iys m ra(mp t0tltoif3to1lmtrau ol(0 2triopoy4lmte ieilt)sDtaxm ou1aleoiociatfmDeaumsnt4aeerir iodom ranvsl( trxrxr oy1ap nmfvsat)s2tmur ;u0oee  ociad mDelnmp;u) lxnmrctadfpD auvs t0 rtr(mpnudamenmncs t  2tmxr nu4aetomo3iydlaDum(mpnt)trxnxf3oadlmtrluvilt0t2tr(o iy1lptemnes tf rta(mp;o4aex ifeiytla2rl( snu)tetnxoctytlmDraueolt  rxr(o3nodamt mietlsfa2rru o;u1alen ietlt a2rmn o (0altoxr3totlpt luvils0setmir3io1amtn fei s  Draxr no0tlx moeiltlm2ranms t)arenmocoodoptr n o t0 etoxo3oy4lm elnes s srtmuronu1oltnmi3iytfm rlu ont)alxnxoctytfmt  neol(0seurxmpoydomt lict t a2tr(rpnu0apeo f3iys a emn o;t4 eerxr3ootlaD luvi t) 2xr(m nu4apen nvs s)aDumuroot4aexn ictas s2ulnvsnt0aexrir oytlmtraueo;t  2xm(r iy1olee fvi s  rtmxrpoo1open ieildfa2rmump u0arxoxf3tatlpt  u i;t)sexrxmpoy4oltemiesasf rurxr ;o1aptoifciydla2um( p t)tlxoif3ootfmD  u i;t)trtmxo oy4olenlnetas) rrmxrpnt0tpxo feiatfsDrl( sn()tlenmr3oa1omtr ivilt srxoir3nu1omee neslt sDraxroou1tptn ociadfm emnmo;()tltrmo3ta1lmtr nei;s0 2uoio3iy1altemiei () 2tmu o;o4aleomoctytla2uanvs;t4aexnmf3iydlat ai o;t t2xmxopno1al eliesltfs2umum ;o1tptn oeiytla2eaump t4texrioctodoat  uvs;() 2xo(o oy4am elfvi ()sDrrx o;t1tpx ifctysfs uanmo u4arxnif oatlmDeluvi () 2um(mpio4llen nvt ( a2tmurp;t4tltn ociyd aDra( pnu4aleoio3oy1fat anvi;( s2xoirpoudal nmncsasfarra(  nu4texnmietatfmDelu ont0texoxr io1la eaues;s)texo(r oodaltnmnci s)a2uaur nu0altomf3tlsla ul( o;t0trtomr3tadlpDe u s;t trur(o3nu4amt lfcs (fsDrmx  nu0oleoioetas m ea( onu) exrifcoatfaD  neilt)tetoim3oodope  nei (  rtm(ronu4tetomfeiysls umnvon()aeerirciy1laDranesl()trurxopiodlpt  nvsl( a2rmxmo;o0oexomieildls2rmu p;u0 rtnif3todlp rliei;s)s2xo(opiydolt mnvilt artmu  ;t4oltomfeiaslmDuln s t) lxoifcta1fpDeaivs;()s2to(opoo1amtnmnvia()sDrax  ot4tleo oeilsls umnvp;()tetomf3iadlaD auvs;s srto(r3oo4lm e nvi s a2trx  nu1tet  oeiadfs2ranvp u)trxoxrcio1lp  an o s  rtoxo3iu4al emiesat srua(mono0oleoiocilsfa2rlumsnt)aetnxf3oadomD  n s ( trur(o3io1ale  ncia( aDumur ot0ape if3iydlm2uan s t0 rtoif iatfatelivo;s0 2xm(rpiudamtelfci sf 2rmu oot4optnif3tasls ul(msn(4teeoif3oydomDrlues;t trtrxo iodol  livsltf rtrxm nu0tpeniictasfa2eau p;u)trtrmo3tadop   u o ()s2trxopiudolte nci s)s2taump;u0tetomietadlm uanms u0aetomfcoydomtrln sl() 2xmiopiy4apee iesas arum(rpot0olto oetysfm2rauvpnt) etnxociydfatranvs t) 2trxr ny1ll   nvt tfa2rr(  oo0texoifciaslm2ul( s t0trxnir3todlaDr uvs;(0trxm(m3nodlm n ivs ( arrrx  ou1optn f3iaslmDrmnvs;(0 eeoir3iytlmDrai o s) etr(m3iy1am nliet (  2uaumpou0ole iociasfm2eauvp (4tlxnmf3iytlpDr ivi;t)tetriopnu1amtelfcsasf Dra( p;u4aeenioeiat mDua(mp t0altrmr3ta1fp raueil( srurim oo1omee iviat  2urxmooo1texoio3iysfm rlnmo (4 rerir3oadlaD an s (0trxoxopiy4oltnlicsl(fs2umxmont4tpt mocias m rmn o;u0tlenmfcio1omDe uvol(0t2xoxr oodop  mnesa(  Dum(r ;t1aexn ociytfmDeln pnt4alxrif3iadlaDran i;()trurxr3iodape mietlt arur(r ot4alxoiocilsfsDemuvp u4artnxfciytfpDeai ilt0srtrir3no1omt mfctl()arrru pnu1olt  o3iasfaDul(vp;t)trxnif oodomD  uvo ()sexm(rpio4lmeelnesat  Drauroot0apeo feiysfs2umnmont)trtomo ia1omteln slt0trur(r oy1ll nmieslt  Dtaxm ;u4aex mfctatlm2ra(vpn()areoircty1laDrli o (0 rxr(rpiy4aptnmicslt) Dum( o;t4olxomfctytfm2emuvpnu)arxoxr tydopt au ils) 2xmxmpoo4am e ietlt aDta(  oo1texoioctltlm2emn o t0tetrmf3iy1oaD  nei s sexmxrpoo4lpenmivsl(fs2umxrp;u4aet  ociydlsDuau p;(0 exrxocio1fa r ieo t setm(rpoodam   fetlt) 2rau onu1opxnmo3tyd mDuanvpn(4arxomo oytop   ivs s) rto(mpoy1om nmivtlt sDur(r ;t0tptomociysfa2ean ont4aexnir iytfpDrai o;(0t2trimpno1apt mics (fa2rmxr no0oetomf3tyt aDrm( o;u4 rxoxrciytlmteaivi;t0 rxm(m3io1ole lnes (  2urx pou0tet ioeils aDrlumo;t0 exrmr oy1omDean olt0 2tmirpoo4lmtnlieil(fartmump;o1olxo fetlsfaDeau s u)aeeoxfctotfmtrlu s (0t2xoim nydamen fetl() rrr(rpot4oleomi3tatla2uan o;u4tltrirctytfaD  nvols tetoxo3oy1ap   nvslt arrmxrp;o1tpxoiieilt a2rmuvp;()aetoxrcoatlm eluvi;s s2uriopio1ll  mncsa() rrmumoou4aexo f3tasfs rlumo;t4texoir3tadoa   ieslt0srxo(o nu4omte ivs sf 2urumpou4oee micild m rmump u0 rerio ty1lpD luesls)s2toxm3iu4altnlfesl( srururo;u1opxnifeils m2uauvs t0areomo oo1lpDr ieo s0 2xm(m iydol nmict sfaDtmuroot1tlx iiciasfs2rlumonu0aetrmrcto1lpt  n i t0seuoim iydllee icia(fa2ua(r nt4ale ifeiad s rlu o ()tltrmocia1oa   neo ()srtoiopio4openmncias arrmu oou1tleniocilsfs raumpnu0 eerio totop eluvi;t  exrir3nydalen icslt arrrx o;t0altn feiys mDra( pn(4 etrmo oodfpt ai i;( s2tm(r3no4ol emfctls)srrm(moou1aleoioeiadlm ean o (0arxnio3tatlp   ivols) rum(m ny1alen ietlt)aDraxmo;t1olt  oeiad s ra(mp u)texoif3to1fp e uvo;s  etoxo no4aptnlnvsl()artmur oo0tpeoiieiatfs2el(vo;t0artrxo3oodomDr uvi;s)trumxo ny1oltemfetat s2rax pnu4tpe if3iatfmDranmo t0 ltrmocia1fmteaneo;t0 exoxm3ou4optnlnvslt aDumxmpno1apxomociys a2elnmp u)tltoirciy1fmDr u o (0 rtrirpoy4lle mieta(  2rrxmoot4aetn fciydlmDul(vonu4tetnxo iytom r uvo;s s2trxm oo4lpenmnci s)s2ur(ro;u4oeenmfctyd aDuau o;t)trenxrciodlmDr nvslt0seuoir ou1ol  livt tf Dta(mpoo0aeto ieiat mDum(monu0tetnif3iadla eaivo ()srtr(r oo4apeelfei t)sDuaump;u1apx moctltfm ranmsnt0 exoio oy1la e ivs t trurio3nudlpenlicsl( aDrmx poo4aexo fetatla2um(mo t4aeenxrciy1faDr i slt trxriopou1ale mfctl() 2um( ono4texn f3tatlm2ulnvp;t4 renxo ta1fpD lnvols0t2uo(o ou1ame  fcslt)arra(moou4apxo f3iltlsDumuvpn(4arerir3oa1fm eaivs;t texm(m oo1ole mfetlsf Draxmooo1aet mieias m2eau p;t4 lerxr oa1la  au ilt)s2um(mpoo1apeemfeslt)srtauro;t1tlxo ieils a2rl( s t0arerxo3oadlpD auei;(0 rtrio oydopt micsa(fa2raxrono1aptnioeiytlmDum(vo;t)teerxo iydfmDrauvol( texrxr ny4om emiet sfs2raur ;o4tpxn feilslaDel(mpnt0aetnxrcootom rauvsl() etoiopnudol nlfctlsfaDrmumono4apenmfeiysfa2ulumsnt0trtoiociatfptr ies;s)teuriopnodlm e ivi ()srtrumpoo4optnioeiyt a ea(mp;(4 eeoio totom rluvsls)setrxmpiu1ap nmneiatfa2ur( ooo4alenmocils m2rauvp u0 rxrmo iodlmDeluvs;s s2uoxm nu1omt  ivs s)a2rrx pno1aeto fetasla2rl(ms u) lermfcoatlatrauvi (0srxoxo oudllte fet s arraxrpot1teeoio3iytla2uluvp u)arxrxocoo1fmD aivs;s0s2to(m3ou1ap elfvia(fsrrr(r nt1texnmoetadfaDranvonu0 lxoxr3iy1opt  ivsl(0t2toxm iy1omtelivtatfs2tm(mpoo1apxnio3iydfm rm(vp;t0tlermr3oadomtrai i t t2umxr iu1lm  lfviasfsrtmxroot0teen octldlaDemu p t) lxnir3ootfptrli o;t0 2um(r no4llen ictlt  2tmxr nu0tleoioctlslm2rln s;t)trtnmo tatla r neilt  rxrio oodal  mnetlt s2tmx p;u1tpxnii3iytfm emuvonu0alxnxf oytla eluvsl(0setoxr ny1al nlfvsas a2trxrp;u1apxoifeiadfsDrlnmont) rerif3tatlaDraneil()sexr(o3nodope licils)s2ua( o;u0oet iocilsfmDrlnmont0artomr totlptr ueils)t2uoxo ny4lme mivslt aDrrxmpou0opx ifciydla ul(mpn()tetnxf iydla e uvs;( seurirpiudalt mies s)srrr( o;t0olx  ociasfsDean p u4teenmo3iodlatean s;s0 2xrir iy1ol nmnviat  2rrxr ;t1tleomfctad s2umu sn(0 ltriocootomteaies s  eur(rpnodoleemivsat)srur(mpot1tltn ociaslaDrm(vsn(4 exnxrciy1oat lu s;t0 exrxr3oodape licias sruru pno4alxnmi3iltfm rlnvo;u4 rxrmf3iodlat aiei;()tetm(r3no4ope  fvi t aDta(mpot1t
\ No newline at end of file
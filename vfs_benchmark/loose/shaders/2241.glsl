@@ -0,0 +1 @@
+nvo t0t2urxrpou4omt  fci ()aDrmu  ;u4alto o3ilsfsDrm( o (4alxoxr3iotoptrli i;() rxm(o3nudaptn nct (fs2taxm nu1tetnmfeiaslm rm( p u)aleoir3oy1opDe ivo;( tetmxr3ou1omenmfei sf ruax  ot0tptoii3tytlmDul(vo t0 eeomr3iadfptr n olt) ruoimpiu4oltemici () Drmumpnu1tltoif3iyslm emuvsn(4texrir3io1fatraneo () 2tmxo oy1omeemnvslt  Draxr oo4tpe miciadfaDranmp (4artrmf3iydlpD anvi;t0t2umim3oy4ope lnviat) 2trxm nt4aptomo3iytfm el(vpnu4texnmf3iotfmte i o;s sexmxmpoydll nmnvia( a2rr(roou0aetnmf3tlsls emuvp u) rxomfciodlaD aneo t)setoio iodamtnmfvtas sDtmu onu1oetomieiyd sDeauvon()altomr3oatfa rlieilt)seum(r io4llenmfvi s)aruaxr nt1olxoifctys sDrmnvp;t)alxoxr3oadfpDr neolt)tetr(o oodaltemictas  rtr(moot1aleoifetld sDrl( pnt4 eerxrciydfa  aiei;t)teur(m3iudlm emnciasf rtrx  ou4tptnmo3ildla2rl(vont0aexrxo3tatom  aueo (0seurxmpnu1am n ncias srrax ont1aexoiictyt aDulumo;()aeerifcty1lmtrlu s;(0t2xmimpiu4alenlfctl()s2uaxm nu4alxniieilslsDulump t0artomrctodopDr nvi (  rxo(r no1al emnvtas s2tr( ont0tet  fciytfm elumsn()texrxfctatlpDeauvs;s0 2urxr oudamtn nvt ( s2rrurp;t1olt iictatfaDrauvp u0tleoirctadfat aues s srurimpiy4opee netlsfaruax  oo4tpxn ieilsfaDeluvo;(0 rxnxrcoadlp e i i t)t2tmimpiy1lmtn fei (  rtmxront4aetn fcilslsDea( pn(0 etrmr ta1faDrai s;()setoxmpou1olt lfci t)srurx  ou4ope iocildfa2uluvo;u0arxrxf3oydlpte ivs;t0 rtrxm nu1lmen iesl( aDraxr nu4tetnmoctytla2um(vs;u0 lermo3iydlate ivsl(0s2toir3oudlptn fvta(f 2urxronu1aeeoiicildfsDea(vont)altrxr3iadlmte n s (0tetrio3oodopt lnesl()s2raxmono4tpt iictatfsDel(mo (0arermf3oy1lpt aneil(0t2xm(rpio4ape  fvil() Duaxronu4alt  o3iydlm2eaums (4 rtnxf3tydoaD  i sls0s2xm(r ny1ole  ivtltfs2rm( o;o0oetomieiltls em(mo;() rerxf3oo1op r iei;t)srtrir3oy1ol n ivsls s2ur(ronu0aeeo i3iasfs2um( s (4 exnxo io1lm rlnei;(  2xmim oudlmtnlfvs (  Dtaxmo;u0teen o3iat m2rl( on(0tltrir ia1opD  ies s)t2ur(m no4lpeeliesa()artaumono0opeo oeiatfs2eau p ()arermo tytoateai s;(0tetmxr3oodaltelnvilt srur(mpou4opx  o3iltfa umu onu0aleoxf3tadlm r i il(0tetrirpny4alenlfet t)srurx oou1aptoiictldlm2elnmp t)aetrmr tytfatrlu i t s2xmio3ou1ole mfcs ( s2rrxmoot4aeen octatlmDumump;()tltomrctotomte ieil(0tetrxmpoodome  ictlt) rtrurpou0openmiciadfm rlnms;t0tleoxrciadomte iei s0truoiopnu4lm   fcs t)aDtm(mont0tex  ociatfaDrmu p;t4 lxomf3to1faD  uei t  etrxrpno1lmt  nvsl( srtmuro;u4alx mfeild mDemnmpnu4 exrir3tytlp ranes t)s2uoxo3oo4lm nlivs t)aDrr(rpou4olx  fctadlm2emuvs;t4texnifcia1lm rlivs;t s2uoxrpou1lpt mfeil(  Drrur no4oleomfeiasfa rm( o;u) exnmf tadlm  aieils0t2xm(mpoy4amt  nei t) Dumxrpnu1tpx mictas a elu pn(0teenio totfp   u olt setoio iy1olte fetat)sDtmxmp;o1ope moeilsfm ea(ms u4 eeomf iatlmD lu o;t) rtm(o iudlpt lnetl() rrm(m ot4opxn iciyd s emn o;u0texomrcta1fpte ivo t srxmio nu1lmenmivi tfsDumurpoo4oltomf3iatla2ulump;() etrir tytlpDrauvil( s2uo(m3oodol e icia(fsDrr(rono0altomoeildlaDulu p t4tltnifcootoaDran i s0 etoirpoo4llen icilt srtm(  nu4oleo octas mDea(mp;(4 exrxfciatfmDeauvi ( s2umir3ou4al  mnetl(faDum(m ;t4apt ifctytls2rmn onu4treoxo3oa1omtelnvilt)trum(m3ou4altn fvsat)s2raxrooo4opxnioeiytfa2rlu pnu4tetomr iotfmtr uvsls) rurirpiy4ap nmivta() 2ta(rpnt1tptn ieildfmDeanvon()aetnxociytfmtr ieilt0srtmimpoo1apeelfvslt)s2trum nt4tptoioeiydfm el( snu4 ltrircoadlmtrln o;() etmir3oudll  lfet sfs2taxr ;t4tlxnmieiys s rmnvo u0tetoxr todomtrln i t0texoxo ou1aptnmfcsas) 2urumpoo1tex  oeiyt s eluvo;() exoir oydlpD aivil(0t2tr(o nu1ll nlictls)sDra(m ;u1olxnio3ilt m2ra( o;t4tleriocoadopt  nvs t)trur(m ou1ap nlnct s) rtrxm ou4oet ioeiatfs2ua(msnt4 ltrxr3to1op eln i;s0t2uoim3no1alee nct t)s2rr(m ot0tpxoifeiadfm eau s u4arxrif3iatoa r uvs t  rxoimpiydllt  fesasfsDuaumo;t0tex io3tysla2rluvon(4teenxo3oodlmtr uvo t  2urxm3io1lltnliet t)a2urumo;o4tpxomo3iltfs rl(mo;t0tltrmf ootlm r uvi;t t2umxm oydllee icilsf 2rrxmp;t4tptoii3iadfm2ul(vs;t4aetnmf iotlaDe ivo t  exoirpiodop emieta( artr(m nt4oetomfciadfs2elu o u0alxomr oydlpDr n i;t) 2tmxo3iy1op   nvs t)aDraxmont1alto ictytfa2eanvpnt) rermo totopt liei;s  euoio nodaleemncs () 2ra(m ;u1tlxnmociydls2emnmp;t4aeerxo oydlmDeau i t0tetoir ou1lptnlfvtl( sDumxr ot4tleomfcias aDrmump;t4trxoxfcty1fpDeln o;t) 2trxmpou4lmtelicta(fsrrrxro;t4tlx mi3iys s um(vpnu0 rtoxf oadlaDe i i t0 ruoir3ou4llenlfeilsf 2ua( pnt4texnmf3iadls2rln ont4trenmr io1fmDrau o s)teumxm3io4ol  mfeia(  rtmx  no4texnifcildfaDrm(mo;u)treoif tatoaDr i ols0trurir3iy4amtn nvtatfa2tm(  nt0tee  oeiltlsDra(vo t)artoxocoo1fp eanei;( s2xo(r nodom  lictlt a2ta(  ;t1altnmi3tytfsDrmnvo u4arxomrciotomt  n i;s0srto(rpnu4lpe mivsl( s2taxrp;u4teeniicildlmDrmu pnt)tlxnio3tadlmt livol() rum(mpoy1omtelnvi tfsrurxr nt0alt mfeiytlsDemnmp u4teerif oytop  aues;t0 2xm(o io4amt mieslt a2tru o;u4alt  octyt s2ulu snt4teenif3tydoaDeaieo s0t2urio3ny4lltelfci t) Dta(ro;t1altnmicils mDulu sn(0 ltnir3ia1opDrlnvs ( seur(opny4amtemivsl() 2rru  ot0alxoifctas sDumu snu4 ltomf3tydfmt an s t  exrxm3oo4lle mfei (farurumpoo1tltniietys m ul( ont0 lxoifctytom e ivolt) rtrxrpoydamt mfeia()sDtrum nu1oleo oeiysfa2rln s;()texnxr iatom raieilt s2xmxrpnodlmtemnvia()s2tau oot1tlen fciltfm2eanvsn(4tlxoxfctodom   nvsl(0t2xmio3nu4lp  lnvi t)s2rau pno1tltnmoeiys a2rlnvsn(4 eeomociadfmtranvs;t0 2xmimpoy1ape mici ( s2raxm ;t4altomfeiydla2emnvo ()aeerxf oodfm   ivols trumxopnodlleelivta(f rtmurooo0apeoioetld mDelnvpnt0 ltnxf todfmD  neilt  rtrio3io1amte fet s s2ur(mp;t0opeoii3iyslsDelump;u4 eenmr3iotom rluvsl(  rtrxm3no1al elieil()arum(mo;t4tlx ifcild m ul(mo u) etrmo tydop rlies;s0tetrxm3oudamtnlnetls aDtaum oo1tpx iieiysfmDea( o;() rtnio3oo1lmDean i;(0srtoxm3iy1ol elncta()aDua(  ot1ole iieildls2rm(vpnu4trenmr oodom rlu ilt setm(opno1ope  ict s)sruau  oo4tle if3iyt s ra(vs;(4 etoxrctatfaDr iei s)trtm(mpoudlmtelnvsas)aDuau  ;u0tpe ioeildfm2rmn p;t0 etnir tatlm rlnvsl(0 etr(o3nydom elivs s sDurx  nu1tpeomfetltfm2em(vs;u)texomo ia1oatrai slt)srtm(o iydame mfvs s)arum(r ;u1opt io3tatla umu snu4 rxnxo tydfpDeau sl()s2ur(r ny4amt lfvia( s2ra(ro;u1tex iieiydfaDulnvs;() lxnxo tytop r u ol(0srxmxo3nu1aptnmicta(farururpou1aetoif3tlt m2um(msnu) lxnmrctadom rai sls0 exr(o oy4altnlnvil(fsrra(  ou4aeeomictlslm2emuvp (0 lxnxf3oytlmtrauei;(0seum(o no4alee ictatf Draumo;u1aexo feildlaDuan p t)aetriocty1fm   u o (0srto(o3io1lleelnci tf Dua(  ou1tlt iicildlm rlnvo () etrifciodla rai s t)srxrxrpoydlmenmivias s2rrumont1opxnmociltlm2rl(vp;u0tetomo oo1fpt  i s t0setoir3iy4ole  fcils) Drm(rono1aetn iciys a2uauvont0aeerxf totfpDeaivilt  rxoxmpiu1lp  mfvtat) 2taum ou0tptniieildfs2emu o;u0tlxnxfcoadoa   uvs;(0 rur(m ou1omeemfesa() Durx  ;o0tpen fciys a2eaumo t) renxociatfa  an o (  rur(r3iu1ap e fetas) 2uau pno0altnmieias s rlump (0tlenmocoydomtraues;t0srtmxr no1op n feils)a2rmx poo0tetomfctlsfsDeln p;t)arxrxfcio1oa   i sl() 2xoio3iydlmt  icsa( a2tm(moou0apxomfetlt s2ulnvo (4trxrxr3ootlpDelu i;( setmir3ou4lp elnvtls sDrmx pnu4tle if3tysfa uan pnt4tetnir iodopDeli o;s srxmirpnydll nlicsa()a2ta( p;o0tpt iociatlmDrluvo t0texoxf3ty1la elivi;t)texr(m oo4lmtn nci (fs2rrx  no0olx miciyd mDulnvs;u0texrio io1fat livo (0 2tmio3ou4ap nmiesatfs2raumonu1aptnmictyslsDel(vo t4texnxr iytfmDr ivol()sruoir3io4ll elfctl()s2tr(  ;t1opt mieiasfmDum(vo u4 rtomf3tydlmDraneo;s s2xoir3no1omee fctas  Dta(rpou1olxn ietls a2elump t4 etrxf3totfpD au sl( teumio3iy4op nmnes s)a2rm(moot1aetomfetlsfsDemumsn() exnio3iy1lmDe iei ( seurxopoy1lp  livias a2tm(  oo1ole io3tydla rmuvsnu0tlxnio tydla  luvsl(0teuoim ou4llee ncia()s2ta(roou4tlxnmoeiltfsDulumo;(4tltrmo3totfmD auvils0 rxr(o nodap nlfcilsfaDtauront0tleomfetatlm2rluvs;(0 rtnxf3ootfp  aues s trumim iodlpt mict (fsrua(rpot1tetnmicils s uln s u4artnxrciatoaDean ol(  exrim3ou4opee icia(fsrur(m ;t1alxomieiyslaDul( o u0 rtrif ootfp e ivi;t) 2umio nu1llenlneiltfsrum(r ot0tltnmocildfsDel( o u4artnxoctadopt  ues s trtrirpoy1altnlncsa()srrrurpno0tpe mo3iasls2umumo t4artoxfctotla  lnvo;s  2xrim nu1op elnetltfs2trum ;u4aexnioeiat m2ra(vp;t0altrmr todoatr u i t trxo(r3ou4om nlnci t)sDrmxm ou0tetnifeilsfm2uanmo u4trerifcoatla   n i t teur(rpnu1al e fvt () rtrurpot0aeto oeiltfaDranmp;()aleomfcoa1fpDeanvs (0 exrio3nudlpe livs t) 2rru o;o0olxo ieiatfs2umump (0aexnxo3ia1lptrlneo;(  rtrir3iy1olt mfvi ( aDtruro;u0apt  ieiad sDua(ms t0tlxnxfctatlateln ol() rxo(r ou4amen fvia()a2rm(  ot0tetomfcilsfa2ea(ms;u4 lxrio3oodfaDr uvslt trtm(r3iudape mnesa()sDraxm ou1opeomf3tadfm2rm(mpnt0trxrif oatopt ln o t)texrir3oydap e ncias)s2rmu pnt1tleo fcildfm eluvs;u)arxnioctydfaDelueo;() 2xoxr3iudlmt  fvsl(  Dtr(  oo0aexo o3tls m2ul(vsn(4alxnmf3tydoa   uei;(0texoxm iu1omtnlnvsa()artrxrp;u0tpe if3tydlsDel(vs (4 eerxr3totfmt luvils0 rxoio iydop elict s  ruau ont0texnioeias sDea( o;(4trenxf iodla r ieols  2xoxm3no4ole lnvt (f 2tm(mpno4ope mieiatlsDrln o;u)arxrif iotlptr uvol(0s2urim3oo4alenmncia()arrrx o;u4oet io3iatlmDuaump u4tlxrmf oodfpDe ies;t  euo(o nu4alt  ncs ( aDururonu1olx mfeiadfs eanvs (0tltrxocoy1fpDr i olt)s2umxo nodap emfctlt)srrauront0aet  i3tytfs2eln on(0tlermrciadfa e ueslt teum(r oo1ape  ivi t srua( pnu4oee mieiat sDum( on() rtrmf oadlp eai o;s0 2xrxmpiy1al nliesatfsrrmurpnu1aetnmfetaslm elnmp t0artoxfciy1lptrln s (  rxmir ou4ol emneslsf rur(m ot4tlxniicilt a2el( pnu)tlenmo3iadlmDranvo ()s2xrim3no1op nlfct sf 2ur(ronu4texomf3ildfs2rlnvs;t0 rxnif3tatla r uvs;t0t2tr(opoy1amenlnet ( sDrrurp;u4aptomociltlm uaumo (4tlxrxf oytlate ivilt0 2tm(r3nydaltnlfeslt a2uax  nu4tltnmieilt m2uln snt0texomf iydfaD  u s s)trtmir3no1altn nciat  rrmxmoou4olx ifcias s uanmo u)altrif oatoat  nvo (0sexrxr3oy1lm  mfeslt aDurum ou0oexo fciysfmDrlumo t4 leoir oy1opDean ols0s2xmimpou1amenlnvils) Dtaumoou0opeoii3iyslmDelums u4arerio3totfpDeliesl() exr(rpnydal  lnesat) Dtmuro;t0aexo o3iysla2ua(vo t0 rtnmf3oatlpDrlneo;()trtoxo iydopee nct ( sDurxmpoo1olenmfcildlm elnvs;u4artoifctytlmt aivo;( srumimpnu4lmenlnct s)srtrx pno1opeoifeiydlaDrau o t) eerxr3iy1op  aivs;s s2xmxo iu1amtn fciasfs2ua(  nu1alt iocildls2ulump;(0aleoxf3ootfptr nvo t texoio3nudalee fci sfa2trumo;t4olxnii3iyt s uln s u4alenxrctodlmDrlnvsls)srtmim3ny4ale lneias  Dtru ont1oeen iciatlaDumnmont0alxomfcia1opDr i i s)srumxo3oodlltnlnct tf Dumx pou4tlenifcilt a2eanmo;(4arxoxocia1om eanes;(  ruoxo oodomtnlneil()aDuaxront1oleo octat mDem( onu0texoxociadlpte ieslt)teuo(r nudamt lnesl()a2raxmp;o0tpxnmo3iat m2uln o t4 lenmr oodfmteaneo;t teurim3iydlpe micsa()aDta(  ;u1aeto iciysfm2ranvp;t)trerxf3tytomtean i;t0 exrxr ou4lme mnct s a2rr(rpno1oeen ieiydlm2ran p ()tlxrxo oo1fp  lnvo;s0s2trxmpiydale lfeils)s2ra(  oo4opxnmictadlaDel(msn(4artnif iydlpt auei s0sexo(o3ny1lpe mieia(  ruauronu1tpxomi3iasfaDemn p;u4texomo oydomteaivs () 2xo(mpnu4ap   iei t  rrr(m ;o4oleo f3tldfaDea( o t)tetrio3tydfm  lnvo;t  2ur(mpoudlp nlfetasf 2rrx ooo4aet  o3iytfmDrlnmont0trxnmo tytfaDeaivs (0seuriopiu4ol nlfct () Duax  ;t0oltnmfciys sDrauvs t0treoir ootfmteln i;( s2xoxrpno4llenlneia( s2rru  ot1olx ifcildlmDumnvp t) leoxocoadfatelueo;t) 2trxm3nu1lmt  nciltfsrra(mpot0olxnmi3taslsDrluvp u4trtrmo oy1lpDrai s;s trtoxo oo1am elfetat)artmxm ;o1tee mo3iltfsDraums ()trtrmr3oatopt  uvs;s trto(o3no1altemiei s s2taxm no0tex  f3ilt a ul(vo t0altnxf iydfa rai ols0tetr(m io1aptnlneiat sDua(rono0tpx  ieiad s2umnvont4texoifciotlp  luei (0trtr(opio1aptemies t sDua(r nt4oltnmociytls uaums (0aeerxf ootom raivi (  2xrimpny1ol   netat)sDtmum oo0tpt  ocildlmDrmnvsnu)altrmo3oa1omtrai olt)seur(m3no1amtelfct t  Dtax  ou1oetoif3ias a2ua(msnu) renxo iodfpD lnes;t0s2xoxopoydom nlfet ()sruaurpnu4tet mf3tadls ulu s;t)tlxrxo iydfmD luei s0t2umxm3iy1ap  miet s) Dtruroou4aexomoeiat a rlnmp;u)tetrmr3tatlaDranes;s  rxmim3oodlmen nci sfsDrmx oou0olen fctat s eanms;u)trtniociytfpt livolt0texm(o iu4lpe mictatf rrax p;t4tlxn oeiytlmDea(vs t4 rtnir tatfpDe nvil(  rum(m3io4oleelivs sfa2urxr ;t4tex iieilsfm2ra( ont) lxnxrctodfpt livi s trurxr iudamt lnctat)aDrmx p;o0ape  o3iasfs umu o;u) exnmf3ta1omD  uei t0s2xmxo3oydlptemncilt arrmxmono0teeomociydlm ea( pn(0 rxnio iytfptr nvo (  rxr(m3nudomt lici tfsrurxr ;o4tpxniociltfaDel(mp;t0 rxoif3tatfm eaneil(0trtmxm iy4amenmnesls)aDrr(  nu4olx mi3iatlaDrl( snu4alxnxrcoatfa elneo;(0teto(m3io1altnlncsl()sDta(rono1opxnif3ild s raump t0tltrxociodoate n s (  rur(rpiy4lpenmnvi tf Dtrx pot0oee moeiadfm rmnvsnt)alermf3oydop rlu s;t)srurim nudaptnmnvsl( arumx ooo1aetnifeiadfm em( o;t0trxrir iydoatran ol(0trtoir iu4lmenlnvt t  2rrxmp;o0aex  ietldlmDul(mo;()areomf3iotfp   n ils) 2tmim3nu1lpte ncs ( srtaxroou4aeenmictltfs rm(mp u4trtomfcoodopteauvo ()s2tmxrpoodlmeemfeia( srrm(rpou0oexomo3iasla el( snu0 ltnio3ty1lpte iei;t)teumiopoo4lltnmnet tfaDumxm ;u4tlxo oeiat a2um(mon(0altnmo tytlmDelu o;t  eurxo3oydaleelnvsl(fartau ono0teeomieiytlm elump u)alxnmr iydfa rliei s0tetmxm3io1omee nesas s2tax p;u4aetoiieiyt m uluvo u)trtrif3oa1om raueils0t2tmxo3iy1llenmnvs (f 2tm(moot1oex miciasls um(vs;(0altoir tatom e nvi ()trxm(opoydolenlneiat)sruaxm ou0alenii3ils aDumn s;t) rtnmo3oa1lp r i il()tetrxm3iu4ap n fesatfsrrm( ont0opxn oeiasfa ulumo t)altoiocto1oaD au o;t srtrimpoydlmt  fcilt)aDur(moot4oleomf3ildlm emu snu0artoio3ootfpteli i ()seto(o3nu1opt lnctl()arrm(mp;u4oexo feilt m2rauvont) ltrmr3oydlmt aues;s)seurimpnudlm  mivsl(f Drmur ot4olxoifeiasfmDemnmo;u) ltrir iy1laDrauvsls0 rtmim3nydalen ivs ()aDrm(ro;o1apeoiieiydfa emu pn() exoio iydfmD au s t) exmim3oudomt lies s)a2ua(r nu1opeo feilsfa2ranvp t0 reoxrciodfmt luvi t0texrim3io1lmtnlnctl()a2ur(rp;u1oleoiietysla2emnvsnt0treomf oa1fmtr u il()teur(o3iy4ap emnvtas a2uaxmpnu4alx  i3ilslaDulnvo u)trxnmociadoatelivsl() eumim3iy4open ivi s  Duru p;t0oetnmfetltlm2umump t4trxnxrctotfpD anvs;t0 exrxo3ou1lp   nei t) 2rrxm ot1aet mfciyt m elnvo;(4trtoir iy1oate ivi;t  rto(mpny4lpeemfcsltf Dtru  ;t4tleoio3iasfs2eluvont0arxnif3tatlm rlivs t0tetrxm oy1ol   nciat)sDrm(  ot0oeeo oeiltfsDean pn(4alxnmo tydfaDeai o;t s2tmio3iu4ll   nvtatf Duaum nt0opx  oeiatfm2uanvo;(4altrmf totoptrln s ()trurxm3iydap emiet ()aDraxro;u1aet io3tltlaDrlump ()arerif ta1lpDe u ol()trumxr no1om  micsat) Dra(moou4oetomfeildfs2rlumonu0artnmrcoodfm e nes t0 rurxrpoo4ll nmnvias)aDrm(moot0tpeoio3ias sDumn p;u0 leoio3oa1fp elnvi;( t2tmim oo1lptemnesa(fartau ont0tlx ifciyd m2em( onu0aexoifciotom  li s;s0s2toxrpnu1lltemnvsas)aDtaurpot1tetomictytla ea(mont)tltnircia1fmtrai sls)trxoxo nudapt lnvslsfsrur(m oo0aex mietlsls2rm( p t)arxomo3oytopt livslt) exmxrpio1apen fvtatfsrrrumooo4ape  f3iyd aDrm( pn(0artrxr todlat anes ( t2xr(mpnu1ope  fct tfs2tmxmo;u0tptnmf3tat m2emnvonu0 etnmrciy1lp   uvo;(0srxoio ou4amt  fcta(faruaxrp;o4opxomiciltls ulnms;(0aetnifctodfaDr uvslt  rxmxo3iydlmtelivilt s2tmx onu4aetnii3tytfaDeaumo;(0altnmo ootlpDrai o t)sruo(o oy1al elnetl()a2rmx pot4altoiieiltlm rmumont0tlerir io1lmD  ivi s) 2toirpoodal nliet t aDurxrpnt0ope mf3iltlm rmu snt0 rxoxr3oadom rli slt) 2tmxo ny4ll e nei t sDtau  no1oex  fetld s2rlnmp u0tltrmo iadoptrluvo s0t2uoirpno1am e fcs ( arrmurooo4altnii3iasls2rmnmpn()tetnmo3iytfmDrln o s)seum(mpiu1omtnlivt s)sDtmx  nu0ope ioctatlaDuaumpnt0artrmrciy1optr i i t0t2xr(opny1ap  mies t srra(r ;t0oex iieilsfs2rm(mo t0tltoxfciatlpD aieo t texo(rpno4om e ncsls  rtmxroou1aptn ociadfsDrmnmo;t0teeoxf oodfa r i s;t0sexoxrpnudlm nmivtlt)arta(mp;o1aexn i3ild a rlu s;t)arxnifctytfmD lnvols) 2xrio3iy4alee fetlt) 2rruronu0tlxo o3iatfs2um( o;u4 exrxo3io1fmDrlu s;()t2um(o3iu4ap   nvsa()sDumu oou0aeeo f3iaslaDul(vo u0tetrxr3iodfpDranvs;t0t2xr(o3oo1optnmfetl()srraurooo1aetnmfctldls rlu snt0trxnxoctydopDrli s ( s2umxo3ou4opteliei t)srtr(ro;u1aptnmfctldlmDel(ms u0 etnmr tytlpD lieslt)srxr(o3oo4ol   nvi t) rtmumoou1texnmfeiys aDemuvont0 lxoxr3ia1op rluvi s t2xr(mpiudomt  nct s sruru  ou4oeeomf3ildlm2rauvs;t0 exrmo oy1optean o;t  2tmxm nydap   nctltfaDtrur nu4tptnmieild aDranmpn(0trxnifcty1lpDr u olt0srxrio3iy1om   nei s  Drrxro;o4aexnifeilsfm2em(mo (0 eeoxf3iydlatelueols0sexmirpoy4lmeemfvias  rrru  no4aleoioctydlmDranmo ()tetnifcoo1fpDe ivi ()srurir ny4omte nctatfsDraxr ot4aexomietysfmDel( sn(4artoxf ia1lmt li s ( s2toim3no1lme lnvt (f Dtm(mp;t4optoifeiltl
\ No newline at end of file
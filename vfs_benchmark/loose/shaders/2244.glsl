@@ -0,0 +1 @@
+ueol(0 rurimpoydamtnlneias  2rr(ro;t4tlt  ieilsfaDra( o u0 rermf oy1oa e i s t)srxmio3iu4altelfei t)arrrx onu0olx if3iys s2umnmp;u)arenxo3oy1lptelnvs t0t2xoio iy1omtnmfvsasfarrmxmp;u1alxomfeilsfs2el(vp t) rxoif3to1lmtrlivs t)texmxrpnudllte feil() rurum nu0tpt ifeiyd m2ul(mp u) ltoxr3tatfaDeauvs t  euo(r3oodlp nmnet t sDrru pnu4oeeomf3ilt mDumnms u)alxomo3oydfpDe uvs s trur(opoydlleelnetat) rumxmoou4alt  fctadfs2umnmo;t4teeoif3totfm   nvils trto(o3oydam elnesls  Durxmp;u0oltnmoeiltfm2rmn p t)aeerir iadop  lu s (  rxmir3iy4aleelfcia(fsrtau  ;t1aee mieildfaDuanvp;u0altoir iydoate u sl(0 2xrxmpno1ll nmfeil(  2ua(m no1optoifctlt aDrl(vs u4artoioctytla rln o ( seum(o no4amtnlneil() 2tauro;o4teeniieiytfa emu p t0alerxo3oo1lp  lueo;(0texrxrpiodam  lnvsasfa2rr( pot4teen f3iadfs rlu on(0arenir3iydomtraivsls) rxm(m nydame mici t a2raxr nt4alt mfeiad a2um(mp;t) exrio iydopDeauvs;s)trtr(m3oy4lpeelfvtl(  Dra(mooo0aexoio3tltls2eanmo (4 rxrmr3ty1omD au o s)t2ur(rpoudlptn fvt s  rrrxm nu1optnmf3tydfa rmn p;u0 lenxocoatlpt aieol(0seur(r oo1olt lieils)sDumu ono1teenioctys m2umnvo;t)altnio to1fmtr ieols) ruoir3oo1ome micslsfa2ua(rono4apxn feildfa2ra( on(0arxoxocty1opt  u i;() 2xo(r no1lp emieils)srtm(mpno1olxoioctldfs2rmn p (4 etoxf io1om e iei;t) 2xrxrpiy4ame mivta() rum(  ot0tle  i3ilsfs rau o;() rxnxf oatomDeauvs;( setrxm3ny4omenmnctas) rtmu oou1tpt  i3iytlm ul(vs ()teenirciy1fmDraivi (0 rtr(m iodoptn neils sDua(mo;o4tlx  f3ild s ul(mo t0alxoxocoo1oa  auvolt0t2toxm3ou1oltn ivta( sDtmxmoot1alt  oetadfs2eau o ()aetrmr3ia1omDeluvs t t2um(o oo1ll emiei t) 2raxmo;u4apxo f3tasla2rmuvp;t)aeeoxo iodlmte n i;s t2xoxo nu4oleemiesat)a2rau  ;o0tpxoio3iltlm rmn o;(0tlxnxocta1fatelnvs;s) rxr(o iy4om  miesa(faDum( o;u0apeniiciatfs ua( sn(0trermo3tadla e i i;( srurxo3ou1ole  fesas artmxmo;t1olto ieiadlmDemn p;t4 lerif iadlmDrlieilt)t2umir3iy1lm  lfesat a2rrumo;o0opto i3tatfsDrmumo;(4aetoir3iodfp rlueols texrxo3oo1lm nmfcs ()s2tau  ou1oeeoio3ilsfs2rl(vs;t) exnmf3ty1lateaies;(  exmxrpnu1lmtnmieias)a2urxm ou4teeo feiyt aDumumon(0 rxrxfctatoa ranes s) rur(r3no1ol n fei ()srur(rono1tetn fcilt a ra(vp ()tetnmo3oa1fmtr u sls0s2xoir oy1lpe mfvtltfaDtr(m ;u4tle  icilsfm2rlnms t) etrir3iodopDeaieolt0teumimpnydomee ivt t a2ur( pnt1oetnmf3iad a2ranvsnu) eeoxf oo1opD li s;t)sexrxr3nu1llt  iei ( aDrrxm nt4opx ifciatlaDuanmo;(4alenmf iatfp e uvo t  2um(o3nudomenmicsat) Dtm(mpoo0optnif3iat s umn sn(4tleriociydlpteln i s srxr(o io1opt  fesl(fs2urxmoou4tpe ioeiasfm2rl( pnt)trtnxo3totomD  ivslt)teum(m no1lle mfeslt) 2rax pou0apxo fetldlsDuanmp t) reomf3totfate i olt) etoimpoydal   iet sfsrrm(mont0alxnmfeilsfsDean sn() lerxo3iydop  ai ilt setr(opoo1omeemnvtls  rum(mp;u0aexn o3iys a um(vp t0 rtrmf3ootfm   uvils) exoxr3oydll  livilsfs2uau ono0tlen i3iytfm uau o;(4trxoifcoadoatelieol()t2tm(m3no4ale licsas)sDrmxm ;u0oex mfetldfs rm( o;()arxrmr3tytfmteai sl() etriopoy1lle  ici () 2tmur ;o0apx moeiadfa2umn p;(4 ltoircty1fatrlnes;s)trxmimpiy4apte nvt t)srrmu  ;o1aexn i3iadla em(mon(4tlxnmo tadlpD  i o t0 exoir3io1aptn fvt sfa2uau p;t0opt miciasla eauvo;t)tltomo3oodlatr ivs ()seumir io4ll e nciatfs2ur(  no4aexnio3iatfsDrlu snu)trtoircoo1lm elies (0srurxr oy4al  lfesas)aDtr(rono0tetniociydlaDumu on(4texnmfcoo1faD  ivo;(  exm(m3oodap  mfet ()srrm( o;t4tptnmoeiad s2ran p t0 lxrxfcoy1opDe u s ( seumim iu1ap  lfeia(fsrrru  oo4oet moeildfm2umu s t)arermr oo1lpDrlivsls0sexo(o ou1amte neta( srrrxm nu1aee mociys aDemn s u4 etoifctatfa r n o ()srxoio3no1optnlivs s)aruru oot4oeenmietad a rmn s;u0 eerir iy1fp e ivo (0sexmxr nu4opt mivsls) rumx pnt0aptnmfeiytfaDrl(vpnt4tlerxfcoydfmDelivo t) euo(r no1ll elfct sfsDur(mo;u0oexnmfciyt sDel( o;u0trxrxociadom   i ols)trxrxrpiy1apee ieslt s2rax pot1tpeo feilsfs2rl(msn(4altrmrciatfm  aivo;( s2umxm3oodop e ivsa()sDum(roou1oet mfeiytfa2rmnvo (0arxnircoodop e nvilt s2trxr3ny1al nmncsatf rrauroot0altnifeiaslm2rmnmsnt0treoir oo1fa eaivol( seumxr no1ll emivta()srtrurpnt0tpxo fetaslm2rmnms t)tleomr3io1laD an i;()s2urxmpio1lme mici tfaDtmxmp;o1apenmf3iat a em(vs;() rxoiocootopD  nvo;t0trxr(m3oudomtnmfetls  2tru pno1alt ioetadla ean p t0trxrmfcto1oa rauvs t t2uo(rpiu4aptemnei (  rrru ont1opt moeiat s eanmo;u0aetrmf ia1faDrlnvols srtmio nodole mfciat a2um(  nt1tlt iieiyd sDel(mp;u4tleomo3iodopD  uvsls0srtrir oydlpeelfeias)aDumu poo4oltnmociad a2elums u0trxnmr iadfpDrli s s)trtm(r3nudlmtnmieil( a2uru  ;t0opt  ictadlm2eln p;t)alerifcio1om r i i;t texmxm iydoptelfcil()sDtm(m ou0oeeomociysfsDuauvp;t0 renxrciadoatrlneilt0 exoxm3nudlmtn fcsatfsDrmu pno0oeenmo3tadfm ua(vsn()arxrxo3oo1opt anvi t trxoirpnudom emnvsa(fa2trx pnu0altnmi3ilsfsDea( o t4 lxnxr3tadom e neolt0trumxr oudol  mfcsatfa2uaum ;o4apeo f3tlsfsDelnmsn(4alxoxfctytop ranvsl(0 rtoio oodomtemncsltfa2urxr ;t1alen fctadfa uan pnu0 lxoxr ta1op  lieolt0t2tm(r3iudlm nlnci s) Dra(monu1oexn iciatla ea( o u)tlerio3oy1fm rai sls0 exrxr io1altn ncta()aDtm(  nt4opxo oeiytlm2eluvon(0treoir3iotlpDelivs t sexr(rpno1om e ieilt  2urum ou0tpto ictytfm2em(vs;(0aexnxo3io1oaDrli i ( t2to(m3io4omtelieilt s2umx pou4aet ifctasla eauvs u0tetrxo tytfmDr ueilt)trxrxm oudame mnesls)a2rrxr ot1openmoctyd a2uauvon(0 reoio3oadomte nvo;s0 etoim3oydom nmneiasfaDur( o;o0tpe  fcildfa2umn p;(4 eermrcoodfat  neo;s tetoxo oudlm emivt s aDtmuront1tleo oeiytfs2uauvont0trxrxrcoa1oaDeluei t) exo(o3ny4ap e ncil(fs2taumpoo1tet ifciys m ulnms t0arxnxr3tydlp rlivi;( tetoxr iydom e fet s)arrmx oot4open fciatlm2ulnmo;u)trtrif to1fa e ies t)s2toxmpoo4al e iciat  rtru pnu1texoifetyslm2umnmo;t0altomoctytfpDelies;s)sexmio3iudom   nvsat)sDum( oou0tpeo o3iat a uan p;t)aetnmrctydfmD an ol() exrim ou4om   feilt  rrmxronu1alxnif3iatla emnvsnu)texrir3oa1la raieo;t seuo(rpoydlptn fci (f ruaxro;t1tpt  i3tat m2emuvp;t0aetnmo3ta1fpDeaiei t)s2umxmpiu4alte netas a2taxm ;u0opxomi3ildls2uln pn()aexoxr3ootoa ranvs t0s2umim3iudomt livt (farua(roou0open iciad s2el(mp;()arenmf3totoaD an i t0 2xrir oy1apeelfvt sf 2trumoou1apeo i3tyslm rmuvs (0 leoxoctodlatelu olt0seuoimpiy4al  miei s)aDuaxr oo0texo ictltfm ul(vs t) lenif3tatfm rln slt  2tmio3oydol  lneils sDuaurpoo4oleomfetyd m2eauvs;u4artoxf ootopDrli i t0s2tr(m3oy4op e ietltf rua(mpot0oeen ictytla2ul(mont0trxnxr iatfptrlnvols0srxoir3ny4olt mivtasfsruaxm no1olx  oeiydfs2uau s;t)tetoir3tatfmDeli o () exo(o3oudol e iet ( a2ua(  ot0teto ietas aDelu s t4altoxr iadlaD auvi s0t2umxrpoydlp emivslt)s2urx  ou1aleomictltlmDelu p;u)trtrxrciatoaDelivi;t) rxr(opio1amt mnesl()a2raxm nu1oetn octadfsDrlu s;()texrmf ootomtrlu s;(  ruoxopiudlpen fesas  Drm( p;o1tpenmiciat m2rl(ms;t0alxoio tadfate ues;t s2tm(m3nu4olte ies ( artaxmpnu0alt iietltlsDeln o (4aetoio3ootop eli s ()truoimpio1op elicsa()sDum(  ;t0olx  o3iys m ra(vo;u)teeomr iytlatrau s s) 2um(m3nodomee fvi s  2uaxmpot4olx ifctldlsDuauvo u0 rtrifciodoa   ivil(0srtmio nu1aptelnvsa(fsDumu oou4teenifeiydfmDua(mpnt)aetrxo3oo1faDeli i;()t2umirpnudolte fes (fsrurxrpno0aleomfeildls em(mo u0 ltomf3ty1oa r i o t0t2umxopoydoltn fcsas)sDrm(m nu4tlxnifetltls um(vp;(4 rtnxfciytfpD  ieo;s0s2xoxo ny4lme  ivi s aruax onu0apt mf3iatfm2rmump;u0trxnmr3oytfpDrliei t0teurir oo4lmtemfvtlt)sDuau  ;u1apeomfeils m2ulu pnu4tltomr3to1lm elu i;(  eumir3nudllt lfetl()a2urxrp;o0oexnmo3tas a ra(ms (0 lerxo3oatopDr ueo t  rxo(r3nu1olenlneiltfaDtrump;u4oltn i3iat m ran p;(0texnifctotlmtelivi t)s2urxm3no1apt  feias) Duaumpou0aet  fcias sDel(vs;()trtrmocoydfmtr n o t0 rxmxopiy4ome lncta(  2umxmp;t0oeeomfetldfs2elnvp;(4tlxnmr iodlptr nvols)texm(rpoy4lm   ies s s2uaxmp;u0apxnmoctyslm emnmo;(0aeeomrcio1laDe uei t)trxriopnydoltnlietat s2trxrp;u0tetomi3iasfm eln sn(0trxomo iotfmtran o;s)t2ur(r iu1ol   net ()sDtaump;t0aexomfetlt a2ran s (0aeeoxo3oydfpDean ols)trxr(o3oydop  mncslt  rtr(  ;t0oexn feild s ranvo;u0arxrir3tydfaD  ieo t0s2urxr3oy1om e fviat)s2ta(m no1teenifeildfa rln p;()aetnmrciotlaDrlueo;(0seurimpoy1op emfeias)sDtrumont0oltomfeilsfmDrl(vont0 lerir3oy1omDeln i;s)sexmxrpoydam   fvtat) Dumxmpoo4oleo ictad a2ulu p t4 ltrmo ty1fpDeanvi;( t2um(rpny1lm  lfvtltfarururpoo4opt moeildfa rmn snt) rerxo io1laDe uvol(0t2ur(o3iu4ll elfcsltfs2tm(  nu1alx ioctasfm2em(vo;u0 exnmr3oy1fm ranvi s0 exoxr ny4lle  nci s)sDtaxrpnt1tleoiiciltla umnvs u4texoxocoa1om r ivi;s) exoxrpoy4ap   feia(fa2taumpoo0tleomociyd s em( s ()aeeomociydfm rlneo s)seurxopoy1lmte neslsfartmum ot0tlenioetadfa2rluvs;(4tetoxfcoytopDrlnvi t s2uoxr oodll emieiltfsDua( pnu1teenmocild m2eau p;u)texrmrcoydfmt liei;(0 rumxrpnodal  micil( a2rmur ou1ape mo3iysfs rl(mpnt0 rtoxo oydoa eaivi t0setm(m3nu4aleemictat s2taurpoo4ale  i3tadlm emu o;u0areoifcootlmD ai i ()seur(r3nu4opte fvsltfarrr(mont1apt mo3iadfsDrl(vp u4arxnir totfmtr n il()srumirpiy1olt mfct s aDra(ro;o1tlt mociasfmDemnmp u0 ltoioctodlmDr nes;t  exriopiu4opt lfesls aDtmxm no1olen oetaslsDemn s t0altnif oatlate uei t texrir oy1lmte fetlt)s2tm( poo0tle ioetld a ra(vo;u4 rtrxfcoo1lmt au s t)s2xo(m3oydomee nesls) 2um(m ;t4aetomieiatfa umnvp u0aeeoxr iytfmt lnes ()t2xmio3iu1ap nliei t)sDur(rpnt0oltoiociytfaDrmuvs;(4altnmrctydoptr n s t0sruoio oudol e fcsas)s2ua(m ;o0tpe  f3iatla rmums;t0alxomf ta1oatrai i;t)texrxr3ny4al  micsls s2ururp;t1oex mf3iysfsDuln p u0 lenxr3iadlpDeauesl(0srxo(r3io4ole mfvs (  rta(mo;t4oeeomi3tys aDrm(vsnt4aexoxr totfmtrluesl(0 etmxrpoy4omen nctas)arrmx pnu4open ociydfsDrl(ms t)alxnir oo1la raues;s  rto(r3no4al elfetls)aDtruro;t1tltnmoctyslsDul(vsnt4tltnmrctotla   nei;s trum(o3iodlmee ivtas aDum(m nu0aetomictadlm2rluvonu4 renmfctydlaDrai o;( seum(r no1omtnlnet () Dumu  nu1opt ii3ild m emnmo;t0 etnir3iadlmte uvs;s)trxr(mpio4lmt lfcias) 2ururoot4oltoii3ildfsDuanmp t4arxnio3oytopD an i t0 etrxopnu1op nliei sfsDurump;o0tlxoifeils a ran sn(0tltnmo iatlmtran il(0s2toir3oo4lmeemivsatfs2rau pnu0tpxn feilsla2uan s;u0artoir3todfmtrluvols  2uoim no4lptnmivias  2urxront1tptoii3tadla2rau ont4texnir oodoatrln i;s s2xr(r3nu4aptelnviat s2taur ou4tpxn i3tlsfs uanmsnu0aeenxo3tydfp  ln o;s srtrxrpou4lltelfvt t sruaxrooo1aptnii3iydfa emums;(0 exnifcoydopteliei s srxoimpoy1olt lfct t)s2rau pnt4aet ifciad m2um(vsnt)tetomfctotoateanvsls trxmiopoy1omt  ivs ()a2tm(  oo1oeeoiicias a2uln s (4tlenmf3oo1latelnvolt0 2xmir3no1lmtelivsat srtrxm ou4tex mfctlsfm2eanmsnt0 lxnmf3ia1fp raiei;s0t2xr(mpnudoleemneilsfsrurxm oo1ope ifcildla ranvont4 lxrxo tydfptelneolt)sexr(m3ou1altnmieiatf rraxrp;o0tlxo f3ils a umnmp () exnir oy1lmD ai o t)s2trir iy1lptelnesa() 2um(m no4tpeomfciytlm el( pn(4teerxr iydomtean i;t) 2xoxopiudlp n nvt ()aDrmu o;u4tlto fciyt m uanvon(4 rxomfctadopD auvi;t0 eur(r oy1llte iet s)sDur(mpnu4tleniieildfa rmuvsn(4 rtomf3oadfaD  u i;t0teumir3iy1opt  ietasfaDumxrooo0tpt mf3ilt a ranvo;u)trxnxo io1fpD luvo;(  2tmxo iu4lmtemfvil() rrmur ;u0altn f3iltfaDrmuvs;u)treoxocoadoa eli i;t)t2um(mpno1ole mfcsltfs2trxm no0tptomfetlsla uanvo;() etnir3io1lpD lu sl(0 rxr(o iudolee nvi () rrm( oou0oet ioeils a rmn pn() leomfcto1op   n ilt0 ruoxr nu1ol eliet t)sDrau  nt1tlenmf3tyt mDeaums u)trxnmr3oo1lptraies;t) rtoirpny1ol nlfcilsfs2tmxm nu4texn fetat a em( pn()treriociytlptrluei;t  rurio no1lmtnlfcs ()aDrau ooo1tpeo oeiad sDemu snu)aetrmo3tadomtrai o s)t2uoim3oo1om nmfetlsf 2taxrpnt0aetn o3ilslm2rau p (4aetoio3oodlp raivo t setmiopio4lmtemivi tf 2trur ot1tpx  o3tltlsDrm(mp t0 lxnxf oodfatrlneo t trum(r3iu4lme  fet () Drr( p;u1alx mieiltls rlumo (0 rerxo oa1oatrln i t  rxoio3ou1ole  neslt)s2umu poo0aleomoetadlmDuanmonu)texrxocio1op raneslt t2tmir3nu4lltn nci (f 2rr(rpnu0olt io3iat mDeluvsnt) eeoifcta1fmDeluvs;t)t2umxr nu4oltelnvi sf 2uru pou4tetoio3iaslm2uln s () ltrircoodfptr u ols  2xrio3oy1openmies ( srta( ont4tlenmf3iat m2ea(ms u4aeerxr ia1opDelivilt s2ur(r3iydlmtnmnci sf rrax ont0oetnmicilt a2ea(vpnu)artrmr3ia1opD aivs;s0 2uoxrpiy4lp elfeta(  2ur(rpoo4oetn oeiatlmDelnvonu0tlxoir3oodoaDe i o s0 ruo(opoodamen iet t sDta( pou4oex  oeiltfa um(vp;t)aeeomo3iatla rauvi;t seurio3ou1ll nmiesasfa2umu ooo1oeeniictys s2rln pnt0trtnmociadop eai slt  euoiopou1lp n nvt t sDraxro;t1oexnioeiyd sDeluvonu)tetoif oydoaDr i i;t) 2xo(mpoudlltemnetltfsrtau  nt0tlenifeiytls rln s ()altrirciodfmDrai o ()texoir3ou4lp e ictlt) rtmxmo;o1oetoiiciadfs2ran o t0aetrxf3tatlaDe nvs t)teumir nu4op nmiciatfsrraumont0tee ifcildlm ua( on() eenmf3to1omD aueo (  2tr(o oydlp n ivsas)aDuax p;o1tpto octlsfa2ua(ms t)trenxf tadoaDe u s;( t2tr(r3nu4oltemncta(  ruaxmpnu0tlx mf3tldlm ea(vp t4 exnio3io1laDe n ilt) rxrio3oo4llt mfcs t) Dtmxrono0olxomi3iasla2rmuvo;t4 ltomo3iatfaDrliei;(0 2xmio oodomtnmncilt) Dtmx o;t1tpe mo3tlt sDel(vpnu) exrifcoodlaDe ueo s0s2tmirpiy4omeelfetatf rumuront4ape moeias m ua( p t0aeeoif tadopte i i ()srxoio3oo4optelietls)s2tmxro;u4tleoiietltls2em( sn(4arxrxf3iy1oaDelnvo;t0teur(m no1ll nmnvsatf 2tr(rp;o0oex ifciyt aDrmnmsn(0texnmocto1fm  an o ()sruoxm iu4op e ivia(f 2raxrpno1oltoioctldls rmnvo ()teeoiociodfaDeanvi;t  2tmxm3iu1oleelnei tfa2ta( p;o0olenmiciysfaDrmuvo;u)teermf iodop rli i;t)srto(o io4lmenmfetatf 2rrump;u0aexoii3tls a rl(ms;u0 exrio io1op  lieo;t0 rtmxr3io4olt mncil( a2ur(mp;u0oltoifeildfaDea(ms u0aetnir3oa1la  auvo;s  rto(r3oy1olee fcsa() Dtau p;o0opxnif3iytfsDrm(mo;() rtrxrcto1fmDe neo;(0trtm(o3nodale  ivtlt)srum( p;t0olxn ictldls rau p t)aeermfctadfm raiei;t) 2uo(o iu1ole mfci () rraurpou0olenifctad a2umumo;t0alenif todoa elueo;s0trurimpnu4ope lieil( srtm(rpno1ole mf3tasfsDemumo u)tlxrmoctadoaDeau s (0tetoim3oy4lptnmnes (fa2trx pnt0apxn f3iad a2elnmsn()texrmf3oatlp   u il( t2tr(mpoodllenmnci t a2ua(m ;o4texnifeiadla2ul( p u0 lxrir to1fmt aueil(0 euoio3oo1open nvslt)aDumu pnu0tlxoioetasfsDraums t)trxomf io1oa elnes;s  euo(rpou4aptemicia( arrrxmp;u1teeoifetytfsDem(mpn(4tlenif to1oa  auvo;s0t2urim oy1lm e fvil(fsrrrxmp;u4oexo f3tys m uau p;u4 exrmf ty1lp   n sl(0 rxoxr3iy4open icils aDumxmpnu0tetoioeiytlsDea(vp;t4trxoio3oo1omt anvi t0srxm(o3oy1lm  lneta(farrmu o;o0olxnio3ilsfm ua( p u0teeoxoctydfmD an slt0t2toxrpoy4lltelnesls s2rr(rpno1tpx moctys m rmnvs;() exnio3oatlateanvs (0seuoxo nodoptelneiat  2um(m no1tptoiieilslmDrmn p t4 ltrir3todfaD aues;(  2urir nudop nliet s s2rm(mpnu0apx ifciat s rl( sn() exomrctodom eaueols0teumxopio4al elnetas  Draumpno0olenii3iasfs2umn pnu4tleoirctotlpteluvs;t sexo(o3no1ale mfvtasfartrxmp;t4alxnmf3iys mDrm(vs ()texriocoatoaD auvol()tetr(r3no4om n fetltf Duauro;t0tltomieiltfaDel(vp (0alxnif3io1faDeanvi;()seuoxr no1lpenmfesas) Dta(m ot1tlxomo3iltfsDrlumon(0altnxo iytfaD  uvo;s0 exoxm3nodap  mfctls  2tr(m ;o4tleniietys mDul( pnt0 rtrircoadfpDe ivilt sexo(rpny1optnlfvsl()a2tax  nt1optn ieiysla2eaump (4aexrmo3oatlmtraieilt s2um(rpno1lmt lnci ()sDum( ont4aex  ociasfa uln p t)treoxr3oo1oa rliesl(0t2xmxopio1omtn neiasfsrumx p;o4oetn o3tld a um(mp t0arxoif ia1oaDrlu i ()texrxo ny4apte fcs sfarraum ou0oetomoeiasfaDem(vont0 rtnxo3oytop   nvsl(0 2triopno1aptnlfcs s  rrmx p;t1tpxn o3iadfm2ranmp;(0 lermf3ta1latr u i t)srxrxr3iodop n fcsa(fsrrm(m nt1tlen f3iydfa2rlu p (4 exrmfcta1fat aiei;s) eumxm3iu4am  mfcils sDuaxm nt1tpx mietldfs rm(vs;t0arermf3iy1fmtelu o;s)s2tmiopoodome lnvi t sDumumonu0tleo ociadfs rm( p (4arerir iy1lpt ln i ( seuo(m ou4lleelnvil()a2rrxro;o1tle mocilt sDrmnvp;(0 rxnmo3ty1opDelues;(0sexr(r iy1olenmiet s aDtaumonu1aleomi3tas sDua( p;u4 rtrio3totlaD anes;( s2xoxo nu1alte ieilsf Dtaxrpot1aleomf3taslaDeanvs;(4areoxoctydlaDranvo;s teurxr3oydalt mietatf Dtmumpno4tex ifciasls el( o u)aeeomo tatom eai il(0s2uoxr iydape  feiasfarrrur ;u0opeo iciydla2elu p;(4tltomo3iy1oa rau i;s  2toirpny1op  lfei t artaxmo;o1aeenioeiadls2emnvp;u0arermociytopD ln s () 2toim io1optelfcsls  2um(m ot4tpxomfciytlaDeln sn(4 lenio oa1fmDrluvil( sexo(rpiydalt lfcsltf Dtr(  nu0tpeomoeiydfsDra(vont0alxoif3oadom e nvilt setr(opno4ope lfvs s) 2rm( ooo1aleo ociatls2rmn p t0texoxociodfmtelues;s0srxrxm iy1olt mnesls)srururpno1alx  ictadfa2em( s;t)tetnif3tytom  aueol( s2tmxr iudlp  lieta()aDrrxmpnt1apeomoeilsls2rmu snu) rxrxf3iydfpDe neo (  2umiopnydom elivilsfa2tau o;o4oexnioctltlm2emn p u0 rtomo oa1lp  aneo;t seuoimpnydoltemnctls a2tmxm ou1aexomoctltla ulump;t) etrmo totop   neilt0seuoio oy1omeelfcsat sDumump;u0texo oetas m2ranvpnt0 eerio ootlmtrau i;s tetm(o ou4ame micslt)arra(rp;o4oexomfciasfs ea(mp;u4 lxrif iatfm eln i;( seuoxr no1ol emnet t a2taurpnt1opeo ociad s ra(mo;t) lxomf oytoptranei;t0 etoio oy1lmenlncslt  rtmum ;o4tee iictasfm2umuvo;t) reoir3oy1la rln slt)sexr(o io1lme lnci ()srraxroot4aeenmfcilsla2eanvs t)trtoif oa1op e ivs t)sexoir3oy4op n ictl(fsDuru p;t4aleo fctatls2rln p;u0treomrctadopDelnvi t t2tm(o3iu4omenlivtasfs2rrxront4tpe ifeild sDum( s u) lxoifcoydoaDrln o;( trur(m3no1lltelnvsatfaDraumpou0apt iicilsfm rmn s u4trtrxr io1lm rluvi;( s2uoir3io1lm emnvtatfs2taumpnu1aee  ieiaslaDemnmont0tlermf oa1latr uvo;(0srxrirpiodope mivta(  rrrxmonu0oex iieilt m2emu s;t)aetrmf to1omD livo;t truoxm3nu1lmte nvs ()s2tm(ro;u1aexniictatfm ea(vpnt)alxnmr iodopDe n o;s0teuoxo3iy4olee nci s)srta(r nu0alt  iciydfm2ranmon(0aetnxocootlateanvs t)t2toxm3nudapee ictl()aDumu  ou1tltnmo3ildlaDrauvsnu)alxoif3oo1laDeluvi s0srurim3io4om emfesl()srrr(r oo1alt moeildlsDrau s (0arermf tydfa rauvil(  2xrxm oydaptnmietltfs2uaum ;u4ale mfetldfmDrm(mo;u4aexoxocootfmD  n ols0s2tmxo3nydop e fetatfs2ur(mont0apxo ieiltfaDrln o;u4 eeoxoctytomtr ivi s0seumir nodlme lfeiltfs2rm(mpou4apxnii3tasfa2ea(msnu0trtnmfctytom rauvils0 rxo(mpnu1opeelnctasf rtrxmpou4olt ifctytlm emu ont4tltnxr iodom   ivslt setrxo3iudlpee nvsltfaDumu pnu0olen fctls m2rl(vs t4alxrxf oatoa rli slt0s2xrir3oydlm   ics tfarrr(r nt0teeomi3iat m ra(vo t4trenxf3tydlatraues t0tetm(r no4ole mici t) rtr(rp;u4aexnifciatls2elums t)aexnxrcta1optrln i (0s2xm(m3oudlp  mfcsat)aDtrum ou4tlx  icilsfs2ea( p;t) rerxocootla  anvs;s0srxoirpno4apen nci s)s2rruro;u4oeto i3iltls emnmsn()tleoxrciy1lpDr nes;s0s2xmxo3nudllt lfvt ()artm(  ;o4tpx io3tltfm uluvsnt0texomr io1om e i i ( t2trio iu1omenlnei (fa2tmx pot0opx  ictadls2rauvp u0tlenxf3oydfp eaueil() rto(mpio1lm n fvia(fsDuaur ot1aex ifciyslm ranvp;(0teerxo3iodfpD  n ols  ruoxr oo4op elictl(fs2raur nt4tleo ictyd sDumnmsn(4alxnxr iotfp  aueo t)s2xoir3iy4lp   nei s aDur(rp;t4apeniictlsla emnms;()arxrircto1fmteau o t0t2uoxo no1oltemnci (fa2rrurp;u1opx mieiysfmDea( o u0trxrmo oatlp  auesl(0 eumio iodlmeelfvtatf Drmu o;u1oetn octatfm2em(vp t4aexnxoctadoatrln slt)srtrxm io4ol  mfctat s2umxm nt1optnio3tadla2eaums;t4 lenxf oodfpt  ueo;( srxo(opnodape  fvslsfaDta( o;u0aexnmoctysls2eln s (4 ltnxf tatoat an o () rxo(m3no4opt mfctl(  2ra(r nu1oetnmfetys m2ul(vs t)altnmf3tytoa rlnvi t srtr(mpio4ol e icslt  Drmurooo0olx ifctltfa2umn s;t4 rxnxfcoa1lp  aies;() rxmxr no4al emictl(faDua( p;o0aptomoctytlm2rau p;u4 leomr3oytlmtrlivo ( teurxr oudop e fctltfaDra(ro;o4tle mf3ilsla2eaumpn(4 leomr3oa1lp eai i;s  rurimpnudlltemnes tfs2trxmpnu4altomictatls umuvp t) ltnirciatfpteluvs s0trxm(o nu1omeelivils  2rmurpno1tpen feiltlmDul(von(0tlxrio totom  auvi t)setoxr3nu1lm  livias  ruaxmp;u0tlto ociltla2raumsnt4texnifctodfmDelueils0t2tmim oo4llt  fct s) Drauroou4olenio3tysfs uanms t4teenmf3iotoaDe neo;s) etmim3oodol nlnvtat) 2rru  oo1opxo i3iadla ulu o;u)trxnxo3oytomtelneil(  2xr(m oodoptemnctl( srrrump;u0teenif3iydfm rmnmo (4artrmo iydoaDeauvol() exmxm iu1lle  ncsl()aDumx p;u4oee mf3tysla el( o t4arxoif to1opD  nvols srum(o3io1am emfet t arrax oot4oet  i3tasfa ua(mp;(0 rxrxocootfa e u sls0trxrxmpoo4alee fei t)srtau p;t0oee ioeildls2rmump;u)alerxo3oodla r uvol( srtrimpou4op nlfvta(fsrrmu oot4olx  o3tydlaDrluvsnt)tetnxf3iadfpD  nvi t  2xo(o3iudap   nvs ()srrruroou4apxoiicildlmDrmuvp t4 ltomf3oy1fmDrlivil()sexmxopoy1ol  mfeiat aDtrxmoou4alt  i3tld aDrmnvsn(4aeenmf3ootfa  ai s;s s2urim3iy4lptnlfciltfarumxmooo1olt io3ias a2ra(vp t4aeeomf3io1oa e n o t) etrir ny4amte ictat)arua(mono4alxo fctyt m uau s t4 leoir3oydla rai i (0t2urxm iu4lpe  fvil( sDuaxrpot0opto fciyt mDem( p t)artnif oatfptrluvolt0 rxrxm3ou1am  livi tfsrta(rpou1open iciat a ea(mo;(4tltrifctydoatr ieo;t)texrxmpny1apt  ictas a2rmxr ;o1texn feiys a rauvs;u0 lxnxfcoo1lpDrlieil()t2umxm3iudom  mnvi s sDuau poo1tpx mieiyslaDem(ms t)trxoirctytlpD  nvo (0 2tmio nu4ope lictat a2rr(mp;t1apen o3iyt aDulnmpnt4tetnmfcoy1omD lieilt0trxm(m iydam n fei ( sDuaumpno4aee mf3iltla rm(vs;(4 rxnircta1faDr i i s0t2xo(opiu4ome mfcil()s2ua(rpnu1tptn octltlsDul( pnt)alermr iydfmte uvi t  2xrim3ny4alt lieia( aDtrx oou4oltnifetld sDrm(vp t4arenmfcoo1oaDeaieilt  etm(o oo4lp emnvtat  rumu o;o0aptn feilsfa emumo (0 rxnxrcto1oa rluei;( s2xrir nudaptelivi (fsrta(r ot1aet mictlt a2ranvp (0 etnmf3tytfptrlies s) exoxm no1lpt livt s)aDrau ooo1ope io3iydfm um(vont0trtrxo to1fatelivolt0t2umxm io4olenmivias s2raumo;u4aexnio3ildfmDua(mp (0aetoxr ty1oat  i i s0 rtm(mpou4aptnmfcs s  rtmxmpnt1ape if3ils aDrlums;t4tltrio to1om e nvo () exmirpnydlme  ietls)arrr(  ou1opeomoeiytfmDua(vs u) rxrif oadfp r iei;s t2trxo3oudop   nviatf Dum(  oo1tlxo ietas m rau ont4tltomr tytlm r iei (  exoxr iy4om   net (fsDurx ont0tleomi3iatfa2rmn pnu4tetrmf iytfa   nvsls)t2tmir oo1ape  fvi t)a2tr(r ot1aet mocildlm em(vpnu)aexrmfctodfm  anes s)teuoir oo1lptnmfesa(fartau  nt0ale mo3iys a2ean snt4tlenmf3ty1oaDr ueol() etm(opoy1lpe lfes s aDtax oou4tpeoii3iltfaDea(vp;u0aetrxf3to1opDe n sl(0seurxm3nu4lmtemncsa()aDta(mp;o1tetoifciatlm2rmums t0alxomf3iydopte uvs;t s2trio3io4aptelfeta(f rrrur ou4tlxo iciad a2umnvon() ltrmfciatfmDe ieil(  ruo(o iydopt  nvtl( aDrru p;t0olt iictltfm2ranmp t)altnxrcoo1latelivol( sexmimpnydal  livi (farrr(mo;o4tpeoifciadfm em( pn(4 rxoio iatfmD lues;t)teur(r oydalt micsl(  Drmxrpnt4oex  ietlsla2ea(mp;t0aetnifcoatomtraivil(  rur(m3io4opee fvtas s2rr(r ;t0aee ioctldlm2ra( pnt4 rtrircoadfa rluei;t)truoio oudlpenlnvta(fa2uaxrpnu1ape mictytfa2ra( sn()trtnmf3oy1lp raivi (0srxoim3nydolenlneiat)srururpnu4tltnifeias s2raump;t)areomf ootlat ln i s0sexoio3ny1omtnlnciat)aDumxmpoo4tpx  o3tld aDrmn pnt4artomf io1oaDrauvo;t)truoxr3ny4lm nlieias  Drr(m ;t0tlen i3iydfmDrm( p;u)trxrxr3iotlmte neilt srumxr no1lle  iesas  rtm(rooo0teeoioeiadlsDulu sn()tlenxf3oydfpDr uvslt)tetoxr ny1am  mncia(  rur( p;t4opeomo3iyd m rmnvo u0 rxoif tytlpD lu sl(0 rurxr iu1ope mivsat arrr(mpno4opx mo3tlslm2elumonu0texrio3todfmtrai slt0 2ur(r ou1lltnmicil( srrr(mo;o4tlt ifciasla eau onu) etrxf3tatoaDr ueilt)t2trxr3iu4amenlfeslt  rumx o;u0alenioetysls2uln s t0tlxrifcta1lm  aueo t t2tr(mpno4op emfcsl()srum(m ot4alt  i3ilsfm umumo;u4 eerio3oy1lm ranvs ()setoirpiydlp nlivslt aDum(r ou4alxoiictad a ra( o (0 renxf3oytlat ai s t setoir oudomtemfciat)artm( ono4opt ioetydfsDrm( s;u)arenio3totfptr uvols t2to(opiy4ll elnct s sDuax oot0tleoifetysls2ulu p u4alerio oa1fptranvs;(0teuoxmpiu1ol e ieil(fa2ur( pou0optnmoeiyt aDrl(vp;u0alenif3iodlaDr ivo;s0tetr(m ou4lmt lics t srurx  no4aeto iciltfaDelnvo;(4alxrxf tytfpDranvol( sexmxrpoy1omtnmicta()aDtax p;t0apeniiciatla um(vp t4 ltomrctodoa elieolt)setoxopnydopt mfctas aDrrumpno4alto i3ils mDrauvon() exomo oydfmD  ies;s) 2trim oo4amtemivi s  2um(mp;o1apenifctltfa rlnms;t)aeeomf ta1lmDeluvols)teumxo nu1al  livslt)arra(  ;o1tle  ocild s emu sn()trxrmo3io1faD li s s)sexoio3nu1al nliei s srtmu o;o1openii3iyd sDum(vo;t0 exnmfcoadfmt lu ols s2uo(m3ou4lm emici (faDtm(m ou1tlx  f3tasls ranmo t) eermo3tadfa r ivi s  rxr(opoo1aptelfvta()sDrmxmp;o1ope if3tltla umuvon(4 eeoxf oodlmtrlivslt) euoxo ou1altn fct t  Dtrxm ot1tle iiciyd m umu pnu)arerio tadfp elivi;s  rur(m iudal  lnvslt sDta(m nu4opto i3iyt a2elnvonu)tltoioctadomDraies;( t2to(m3ou4apen ieiat)s2rrxm ;t0olx  oeiasla um( p;t4alermociatomD  uvolt  exoxm nu1ap  mfcs (fsrua(r nt4olxn i3iyd a2rmu p;t0 etoir iatfa rln i ()trxr(mpoydolt  fvsl()sDrax ont1tpenif3iltla2uln o t4teenmociy1fmDeaneol(  rxoxm3io1om  mncils)aDua(rpnt0apxnioeiyslmDulnvp t4tlxnmrcootla eaivo ()sexo(m oy1lp n nvi t  Duau o;t1aeenmi3iyd mDra( p;(4aexomf3oo1op rli i;t0t2xm(o3iy4omee nvsls) Durum no4texomf3tadfa uanmp u4arerifcty1faDrlnvi;()trtr(r iu4lmtelnvtat arta(mp;u4altn ieilt m2rl(vonu4 etnxf ta1oaDeau s ()t2xrxr iudlpenmicsas sDrrx poo0ape iieiad m2elnvsn(4aetrmr oodfp e n il()texmxm ny1lle mfesl(fsruau pno4aleomociaslmDrmn p (4treoxo oa1optraieo s0 2umir3iudlmtnlncsas) 2uaxm ou1teeoii3iyt s ulu s;u0alxomocoydfa e u o;t  rxr(o oudlp n nci s a2uau p;t1tet iictydfa rmnvs;t4 etoio3oydfpt lieslt0tetmxm3no4optemnvil()srum(  nu1tlx  ieiatla2emn s (0alxoircoydla elu ols s2urim3oudom eliviatfsDtrxmo;o0alenmoetydla2umu sn() eenxr3todlp raneol( t2umimpny1am nlfcilt  rrrxroou1olto feiasla2elnmp;u4 eenircoodfaD lu ols  etrxo3oodale  ncias arrrxrpot0optomo3tatlaDeanvs u0 lenif oytoate uvi;s0teumim no4lpe  nci (farra(mont0teto ociat a eaumo u4tlxoir3to1op  aueo t) exrim3ou4olee fctatfsDur(ro;t4alen f3ils mDem(vo (4aetoxrctodfp rluei s) exo(o iu1olt mivsas) rtmxrono4alx  i3tld s emn o;t)texrxrctotlm rluvsl() 2xmxo nudal nmfctlt sDrru p;t0apenmfciydfm2ea( o;u0areoxr3oytoatr u o;s texr(m oo1lpe  fcsa(fs2taumo;t4teeomi3ildfmDuanvp ()alerxfciatfpDe u ils  eurxrpno1omtelfcslt)aDrau p;u4tptomfctadfs2rl( s;t0tlxrmfciatfmD  i olt)tetm(o3oy4al   nvilt)arum(r nu4texoioctlsla2eluvp t4tetnmr todlat lnvil(0trxmxr iudllt lfei t)aDumu p;o4apt ifciat m elnmont) lxrxfcia1laDe ieo;s0srumxm ny4lpt lnvta(fsDtaumont4tlen iciat m rm( p;u0 eerir3oatlat  ueo;(  eurir iy1opte neiltfsDrmur nt1opt  f3ilsfm uln pnt)tetrmocoodfaD  n i;( seuo(r3oo4al elfetas  Dtrum ;o4apt ioeiltfmDrm( o t)aeeomf3oadlaDr n s;t  etoxmpou1alenmietltfs2rax oot4apxnmociad m ulnvo (4arxnir tytoatelneo t0sexmxr3nu4ap emivsat aruaumpot1teen f3tltfs uanvs;t) eeoir to1omt aieo t  etrxr nodopee ieil(  rtmxr no4tptomf3tys a2elu p u)teerif oa1lm r ieo t0texoxopoudom emfcsatf rtrxrpnt1opt mf3tysls uanmp u)trerxo iadomtr n olt seumir3nodal e ieilsfsDur(mp;o0opx mociltlm rlnvo;t4 leoirctydoate nes;s0t2to(o oy4am  mfvsl(  Dur(rpou0ope iiciasfa elu p t0tltrxr3todlm  lu ilt texrxo3iy1apt lict s srtaxm ;t1apeo fciatfm2raumont)aeenmf oodom r nesl(0 2tmxm nu4altnmfvsl()aDtr( pot1tpxomociltfsDrlnvsnt4artrxr tatlm   iei ()teum(r iu1optelnetlt  rtrx p;u1aetomf3iadfm2ul(vs;() rxnir oo1fa e n o;() rxo(r3nodlm e ics t) 2tm(m oo1aexn iciydfm ulnvp (4texrmocoy1omD liei;s) 2trirpoy1op elieias) Dtmxm no0tpenmfeiyt s2elump u4trermf todlpDrluei (0 rtr(opou4ll nlivi ( arur( onu4oltoiociltfs2rm(ms;t0alxrioctydomt lneo s0 exmirpio4ll  lietlt s2ur( pno0tlxnmi3iltls2emuvo;t0aeeoxf tytlmDeaues t0 2uo(r3oy1llee fcs (  rurumpnt4aeeniiciaslaDelnmp;u)aetomr ty1opD luvi;t  2um(opoo1lp  mnctl(f Dta(mpnu4alx mfciadlm eau on(4 renir ta1la   ivs;t0s2xoxo3iodlpenlfet sfsDtmu poo0tlxoifctlt m2eanvpnu)trenir iatfa rai i (  2xrim nudlm e fci t srumx  ot0olx mfeiatlm2ea(vonu4aexomrcoo1oatr n s;s t2xm(r3ny1ll e ncsatf 2ur(mo;t1alx  o3iyd mDelu p;()areoxr io1fmtranes;s)srxmiopiy4lmeemivtlsf 2um(mo;t4aeeomfctatls uau s ()tlxrif ta1opt lnvil(0s2urio3iu1omen icia() Dum(mont4opt  oetytfs rauvo u4 rxoiocoytfaD ai s;s)s2trirpoydop nlnvtl(f 2ta(rp;o1alx mietydla rlu p u)aetoxocia1faD livols  rtrxrpou4op  miesa()a2uaxrpno1oeen i3tltfmDea( sn()altrxf3iatom r ies;s)truo(r oo4llt mivtlt) rurxrono1tpenmoctlslaDra(mp t)trermo oodfmtean o (0srtm(m oy1omee ivt ( aDtrxmp;t1oeeoiictldfmDelnvsnt0 exrircia1lpD  i slt0srxr(opiodapte fviat) rrax onu1opxnmietatfsDemumonu4 rtrmr3io1lateaivil(  ruo(o3nu4ap  lfeil( aDta(rooo1teto octytfm2elums t)altrmoctydomt li o;t)setrxopou1openmfctl(fs2uaxmooo4aee  o3iydfs2eluvp;u) eenmrcoytoatran s;t  rxrimpno4ap elivi ()sDrr( ono1aex ifciatfs raumont4aetomf3oydfpDrln o s)sexrxo3oo1amtnlnvia( a2urxmpnt1aex mfeils a rl(vsn(4alenmf to1lpDeaieo;t0 exoxm iy4om n fctlt  rrmu  nu4tptoioctldlm ea( o t0arxnir oydopt ln o;s t2xr(opnudom n ies sfs2urxmpou0apt  i3ils s umnvs (0tltoxf3oadfmteaues;s srxrxm3iydlmt mivt t s2uru pnu4oleomo3iadfm rm( pnt0alxomf3ootlmDrlieol(0trurio io4ameelfvtl(fsDtau pnt4apxnii3iydfmDranvsnt) lxrircto1optean ilt)trxr(r iy4lme liesa(f Dta(mp;u4tltnmietatlaDrmu sn() rtniociytlmtrau slt)s2xmxmpnu4lm e ivils) rrmx o;t0aetnifcilsfmDrmnvs (0 rermo oytomDr nvols0srtm(r no4lme  ncia(  2um( p;u1aptomo3ilslmDeauvsnu0 etnmocootfpt  uvi;t  rtm(r3ou4om nlicsas aruaxrooo0tlto oeiasfaDumnmsn(0artnxo oodlm  aues t)s2trirpiydlmt lici s)arrmu  no0oltnifctlt sDelu s t)trxoxr3oa1fpD  u i;s teum(m3oo4lmtemict sfarraumpnu4apto o3ild a um(mp;t0trtrxrciy1fmDr neo t0s2umxrpiu4ol nlictl(f Dra(rooo0olenmieiyd s ulnvs;(0aleomocoodoaDr n s;t  rum(mpnu4lmt mnesat sruaxr nt0tlx mi3iyd a2emu s t0 rxniocio1oat aivi;s0texm(r io4lle lfvt t a2raumooo1tpenmoeiytlsDulnvsn() ltoir ty1fpD lnvo;s srtmxr nu4al nmfctlt)s2tmx ooo1aex ifeiyt mDelu o;u) eenmr todlmte n s;s0s2ur(m3ny1ll   ncils)aDrrxr nu1tle  i3tltlaDean o;t) leoio ty1omteanvo;s0 rumiopou4amee nvia(f Dtauront0aeen i3tlt m2elumo u0 lerxrcia1fm  lnvsls0 ruoim ou1al  mnvt (  Dumur nu1teeomfeiydlmDrlnvs t0tlxomr3iytfm e uesls) 2uo(mpny4aptnmfesl( aDrau onu1opxnio3tld s ra( o;u0 rermrcootop r n o;s) rxoio3ny4lle mivslt)a2umumoou4altomiciltls ulu sn(0 ltoif oodopt  nvsls)setm(m io4ape  netl() rrmxm ;t1tpt  fcias mDrm(vo u0 rxrir tadoatrlivi;( sruo(r3oodapt lnviasfa2taxr ;t0tpx ioeiyt a emu s (4artomociytlpteaueo ( texmxr io1olenlieil(  Dtaxmpno0aee mfctad s2rluvpnt0teeoxo3ta1omD aivi t0trtoiopoodome mnvi (fsrtm(rp;t1apx ifciyslmDulnms;(4trtomr oadfmtr neo t  etoir oodome mici s  2tmxm ;o0oexo feiat s ranmon(4aeenmr iytoa  lues;t) rumxr3ny1omtemicils) 2ua(r ou1olt  ocilslsDeaums u) eerxf3iy1laDr uvslt0 exo(mpio1lptelnctl(  Dtaxmpno1alx  o3iatfs rlu p u4 rtnio oatlmDelnvo;(  2urir oydll nmfcsls srtm(ront0aeen fetlsfs2uaump u0tetnxrcoydla elneol(0t2xmio3nudope  ietl(fa2rm( onu1oeeomieiltlm ua(mo u0 rerio3oadlpt  i s t  eurim io4omeemivslt a2tmumpou0apt  o3ias sDrmn o;u0aeermf ty1fpt  nvs;t) etm(rpoudllt lncsas)sDtm(  ot1tlx  fetaslm elump;t0aetomf oytlmD livi ()srxm(r3ny4lpenlnesas  2tmxroou1tpxnioeiatfa2emuvon(4alerxf3tytfa r ivsl(0 rurxm3iydomt livsl(fartmumpnu4tpenioctadls ranvo ()texoif iodopDean s;(0setrxr3oudameelfetlt)arum( ont4oexniieias m rm( pn(4trerxf3tydopDrlneil( teuo(r3oydop nmfei t)arrmxrono4tptnmo3iytlm rmu s u)teenmo3tatlpD auei;s)texm(mpoo1apee nciat  2rmu poo1ape  feiaslm rl( pn()tleoxf3oydfp   uvil(0s2tmxo oydolen ivtas)a2rruroot0oeen ociadfa2el( p;()trxriociotoa   ivi;t) rtr(o3iodop  mivs ()a2um( oot0aet iietytfmDelnvs;(0aeerircta1laD  iei;t)s2to(mpoy4lm nlies sf rrr(roou4teeoifetadfm rauvon(0aeermo3oa1oa r uvslt)s2xrxmpoo1optnlics tfaDta(r no4optoiiciad a ra(ms;(4trtrmocto1oatran o s trtr(o3oy4lmt mnctat)a2umumpou4aex mfetatfm2ulump () reomr io1om  lnvo;t setoir3no4optelfvtltfa2tmu pnt1ape  f3iadfs emn pnt0tlerir iy1laDelu s;s s2xrio oy1openlfetl( a2uru  nu4aetniociatfm2em(mo;(0texomf ta1omt  ieo;t0 exo(mpno4ll nmfvias) 2ta(r ;u1tet moctas s el(ms;t0treomfcoadlaDeaiesl()trxmxr oydolenlicsatfsDtmur ;o1apeniieiysfaDuan ont0trermfcoydlpD aneslt)texoxrpny4ame lncilsfaDum( pou0tptoioetatfmDrl( pn(4 eerifcio1omDrlivils truo(m oudal e ictasfs2uau o;u0tpxo oeiytfs ul( o;u0texomfciydoa r neo s setmxo3oy1open fvtasfa2ua(  ;t4opxnmi3iat m ra(vs;u4altnmrcoytfm raneol( seurxmpnydlmtn ieias)aDtr( pno1aleomiciatfmDul( ont0aeenmrciytfpte ieils)sruoiopou4om n nvt ()a2umxmpot0tlx  feiatfm2umnvs u4teerio3iodomt ln s t0srxr(m3iy4ome mfesa()arrrx pnt4alx mictat s uln on()tlerio3iotomt  n s;s  rtoio ou1lp  miciltf 2ta(mono0altnmf3ilt a uln p t4aeermo3iadopteaies ()t2tm(m3iy1ome  fesatf 2um(r no4oeenmoctls s2eln pnt0aetnio ia1lp   nvol(  2tmir iodap nmnciltfsrtaxmono0tlenmieildls2ulnmo;(4 ltoxf3iodfptr u s t0srtmio iodlp e fesat s2rax  no0tlt io3iat a eaumo;(0teenio oodfaDr uvi ( setmxm iu1lmeemfvsa(fs2tmx o;u1alxnmo3tltfm2elu p (4alerio tatlmt ln slt  2umxr iu1amenmfeil()aDtmxrpnu0aeeomf3tysls um(ms (4aetoio3oo1fa elivolt teurxr3no1omen nctasf 2taxr ;o4aexniiciyt sDrau p u4 leoir3oy1fmt an s;t  eurir iu4apenmncta()a2umxmpnu0apto o3iad aDua(von(0aeeoxocoadfaD  u s;(0s2uoir3no4ape lfetasfsDrau pno1opeomi3iatlm ul(mp;u)arermfcoadopDrluvo (0 2tmxrpnydaleelnct sf rua(mo;t0ape ioctysfs uau o;t4 exomr oydfpt an sls)srxm(opoydop elncsa(  2uaurpno0aexnioctasla rm(ms u4 lxrio3oo1fmt  nvol( s2tr(m iudom  mfcsltf Dtru onu0tee  feiatfsDel( s t)trxoir oatlmDraivo (0 eumxm oodop e ivtls a2ur(r oo0aleo f3tldla2eluvsnu) exnmo oytom eaneslt0 rxr(r3nydlmtemfetat)a2umu pot1oeeoiociatfaDrmnvs;() exrmfcoytlpt au o;s)srto(o oo1lp  mnvilt)aDuaxm ;t0tlt  ietatla2rlnvsnu) rxnxr3iotopte n s;(0 2xr(m3ny1ll elfvias a2ta(  nu1opx  o3iadfa rlnms;t) rxoxf3io1lp eanvolt) rurir iydll emivil()s2ra( onu0tetoifeiytfa emump t) ltrif iydfm eanvslt)tetr(rpiydomt  ivtas)srtmxrpnu0tex moeiasfa2rl(mont0aleomr to1fmtrln s t) 2uoimpny4opeeliciat  2tmu ono1openiociltla el(ms (0trerir tadlp r nvs ()s2ur(o3ou4apenlivils)artrx pou0aeenifcilsfsDrm( s;(0teeoifcio1opt  n il(  2tm(r nodomeelfvtlt)s2raxmpnt0tlxoioetydfaDraump u4 exrmo3oytla rlivi;t) 2toxmpoo4ope lieil( sDtaxr nu4texnmoeiltfa2rl(msn(4tlxnmfctotlm  lneols0t2toir iy1lpenlfcsat)aruaxr no1opxn feilsfm2ua(mon()arxnif3totlptean ol(  2uoxmpiy1lpte fvi ()a2rr( ooo0opeomietldls2ulums (4aeerxfctatop  liei;s0 rxoxrpiodomeemnei s) ruaump;t1aeenmo3tysls2rmu o u)trtrircoy1lp  aueil(0texoio iudlpe  nesas  ruax  no0oltn fciltls uaumo u4 lxoio oadlpD  ueo t0seto(o ny1op e ies t a2taxmoot0oee ioetlslm elnms;t4arxrircoydop eaieo;(0t2tmimpou4ole mnvilsfsruaxmp;u1apxn fetltls2ul( s;(0altnif3oatlaDr n ilt s2uoxmpno4ameemfci s  Draxmo;o1apenioetydla uau snu) eeoirciy1omDe nvs t srtrio3iudalee fvtl()srta(rpno4ole mi3tyslm2rm(von() rxnmo3tytomtr uvs s0s2urirpiodome lnvtls)sDumxmpot4ole mo3iad s uauvs;t0aexrmr3iytfp raiei t)srtoxo nydam  micsasfsrtmx  ou4teeo feildfa2emumon(4tlenir iy1omteli ols0 rxoio iu4omenmfvs (fa2umumpot0tlt  fetltfm2eanmpnu)aexrxf3iytopDr neols) 2tmxm oudolt livs t aDtr(r ;u4aptomictadfm2ul(vp;(0tleoircoodom elivs s0sexrxo oydal   fvs sfa2rrxro;u1tee  fetlslsDemn p;u4arxniociodlptraneolt s2umio oo4apee nvi t s2rru oou4alenmo3ilsla emnvp (4 eeoxr todopD lneil()truoxr3iy1llenlictas sDtaxmoot4altnio3tysfsDeanmp t)altoio3oydfp r iei;s  rxrxm3ny4opte ici sfa2umxm ou1tlx  fciatlmDea(vo t4 lxoif tydlatraiei t)tetoxopio1lmee fesasfsrta( poo0oee io3iyslsDum(ms t0 lxnmf3oatoaDr u il()t2tr(opoodapee nvilt a2ta(ro;o1openmiciaslsDra(mpn(4altoxfcootfa r i s ()trtrxrpoo4olt  netas a2taurpnu0olen ietat m2el(vpnt0 rtnxf3oadfmt  uvo;t0 rtoxr ny4lm  licia()s2ua(m oo0apxnioeild s eau o u4texrxf oo1lptrlivol(0sexmxrpiudop e nvs s srrr(  nu4tlenmoeiydfa umumo t)artoxo tytfpt livilt) 2xmim3iu4olee fvtl( arua(m ot1tltnmi3ildlm2ulnvp;(0tetnxf3iadfpDrln s;s0 2trim3iudamenmfviat srtmumo;u0oltnmf3iyd sDum( o t4arenxo3totlmDe ivo;t0 rxm(o iudlp  miet (f rtm(  ot1tex  iciysls ul(mo u0aexrmr oo1fmtelneilt)t2tmirpou1aleemnvi s s2taumonu4olxniieiytfs ra( onu0 reomr ty1fm rlueil(  2uoio ou4amte fciltfs2rrxrpnt4alt mf3tldlsDranmo t0texoxf oadopt  nei;( sexo(rpio4altn icsl( artau  ot1tlenifcildls2raumo t0tlxrxfciytfpDrauvolt)trur(r iu4lltnlnci () Dtmxroot0tpt  o3iaslsDem( s;()aeeoifciy1lmDrli slt0 etm(m iydolte nci s)aDtaxm nu4altomi3ildfa el(vont0altrmf3todlatraivi t0s2xriopoy4ap e ivt s  rrmum ou0tee  f3ils a2elu pnu)arxrxrcto1fmteaivi t0t2uoimpoy1apt mnviat  Dua(ro;o0ole  i3iysfa ul(vpnu4 etnif iadfm  lu o t t2um(opiu4ame  nvtlsfaDra( ono1oee  o3iat aDrlnms;t4aetnmf3todlat  i sls setr(o ny4lme mieia( a2urx  nt0aee ifciat aDulnms (4 reoif3ia1oaDr ues t0teur(mpiu4lmt mnesl()a2rm( ont4texn i3tlslsDraump;(4aexrxo tatfa   neils)t2umio3no4lmtelnvt ( srtrx pnu1olxomo3tytfs2rm(vp (4 exrif oydfmD  nesl(0s2urimpio1lm nmivsl(faDua(  ;t0tltoifeiytfsDum(ms;()tltoxfctydop eanvil()sexrimpoy1olt livs s)aDurxmpno0apto icilt s eluvs t4altoxf3ty1lat au o s)tetm(r io1apen ieils a2raumo;o0tee mociasla elu p;(0 rxrmr iytlaD lies;()trtrir iudom nmivil()srtrxmooo0opxoioeiyslsDua(ms (4texrmo3tytfmteanvo;s0sexoxopou4alenlfei sfartru  no1texoio3iytfs eluvon(0treoxo3iytfaDrln s;t setoir3nodoleemies t)srta(  nu0tptoiociat a2eanvp;(4teerir3to1lmDelieo (0 rxr(m iy1am  mncsa( aruax  no0opt moetat s elu p;t4 ltrio oo1op e u i ( t2xmxopoo1lpeelfvi tf 2ua( onu1alt ioeiad m eauvp;u)altomr tydfa r uvs t s2um(r io4opte icil() ruru o;t1aexo i3ils s rauvon(0aexomr tadoa rai i;(0trto(r ou1oltnmncsls a2rm(mp;u1apeo i3iadla2rl(von(0tlxnxr ootoa ran i t0truoiopiy1amee nct s)aDtr(  oo4tpxn f3ilslaDemums;t0tltrxo iodfaDr n o s0tetmxr oo1omen fcil()srurxrpot4tpe mociysla2rauvp;t) lxnxociotopt  neo;t0 ruoiopiu1lmeelfvt ( sDumum ou1olt moetyt a2umu pnt4tetrxo3ty1omDr neo;t0 eto(m3oudolen nvtatfartaump;u4tlx mfctydla ranmp;t) rxnmr io1fat anvs (0 2xr(m3nydamtnlivtltfaruru  nt4tlt  fetld m2ulump u0 ltomocia1lp  luvi s)texmxopiu1ol nlfvi () rtmx  ;t4alxnmociytfs2um(mo t)trxrxr iotomt luvs t0s2ur(opou4al nliesl()arur(mpno1opxnii3iasfaDrlumonu0 lxrxo tatomD luei t0sexmxm oy1amtnmivs t)srrrxm oo1oeenifeias s2elump u4texnmf3oy1fm eli o t t2xmir3no4am nmictltfa2tr(root1tlx  fciltfm2eanvs;() ltrif3iydom  luvo t0trtoxr3nydop e fci t aDrru p;u4texoifctyd mDrmu s;t4 eenio oo1oa   i o;t  2xoim io1ole mivsat) Dtm(  no4opt ii3iysfmDumn p u4tetnmfciatfp elivo;t)texr(opnu4lltelfciltfsDtrumpno4oeeo oeildlmDra( p;()aetoif3iy1fa eln sls  rxr(mpnu4omee nei (faDrru  ou4tptn ocilt s2rl(vo t0 lenxr io1lpDr n sls0 exmio3iodomen ivta()sDraurpnt0tetnifeiadla umn on() rtnir3iadoat lnvolt  exoxopno4olt lfetl()s2tr(ront1apxnifeiysfm2el(vsnt)treomf3oatfaD ai o ()texmxo io1lptnmietls srrrurpou0opxo iciadfs raumsnt4 ltnio ia1fmteauvo;(0s2ur(o3oy1lm elnvil( s2ur(  ou0aet if3tlt mDrmuvonu)teeoif3todoaDelnvs s teuoio io4al e icsatfsDtrxmooo1teen icilslm2ul(vo ()tlxomo3to1omDrln i s)trxoirpou4al elnvta()s2umxront1tpto feiyt s umu p;t) ltoif iy1op ranes t0 2xrxrpou4amtn fctlt a2ur(m nu1oeeomfetltfmDuau sn(0aeenxr tatomt lnvo s) etmxo oy4ape lieiltf rtmxmpot0aptomocilt m2ea(vs t) ltnif iadlaDrlnvi;s tetr(r ny4omtn neiasf Dtr(mpno0tpe ioeiadfs eauvs u0 exrir oadfpDeluvs t) 2umio3io1oleeliet (  2ur(  ;u0opx  ietadfm eauvs ()aexoxf3tadfpD  i slt trum(rpnu4apee icslsfs2tau ont0tlxnmo3tat sDra( p ()trxomfcty1lpteaues t  etmxm no4ome  nesltfsrua(r ;u0altoioeiydlm el( o t4 rerir3to1oa e n o;s  exoir3iudameemfesls  rrm(  nu1tpenmfciyd aDranvs;(0aexoiociodfaDeluei t0 eumio ny1am  lfct ( srtmxr ;t4aex moeiatfaDem(vp;()altoir to1lpte n sl(  exm(opnydolee iei sf rur(m nu1apx if3iys aDran ont4tlxnmo3iydlmtrluvs s)trum(m3iy4am  mnvias) Dtrxront4tle ifeiydls2umuvs (4 leomrciydfm r ivs;s  rxmim3nu1ol emneil()sDrrurp;u1tex mieiyslmDean p;u4arxnxo3io1opD lnes s0 rumxmpoydole mnctl() 2rrxrpnt0tpx  i3iaslsDua(mo () rtoxr oy1omD  n sl( trtrxr oo4lptelnvtat) rra(mpou0tpeomictld sDemuvp;() lenir3ia1lptrlueo;s t2xrxm3nodomt  nesat)sDuaxm ou4oetniictysfm2ul( p;t)trtnxr oytla   uesls setoxmpiy4lltnlfvi t  Dtaxm ;t4olxoiictaslm ranmp (4trtrif3iatla eanesls0 rur(m3iu1lm e fvtat srtru  ou0oeeoiicias s rmumsnu4trtnmfctotfat auvi;( texrxm3oo1lm  mncia(faDtaumoou0aexomfeiyd s2ul( ont4 exomf3tadom elneo;t tetmxm3oy4altelnvil(fsDurxro;t4aleo oetydfaDuauvs (0 rxnio3to1faD aueolt  2to(opio1llt  nci s srrrxrpnt4tltnmoetat a2ul( ont0 ltrmfcty1fmt li s ( t2trim iu4olenlnvils)srumx ont0tlen f3tldla2rmnmp (4 ltoio3oadfm  lnes t trtrxmpoodlmt lfcsl() rtm(  ou1apx if3tadlaDrmnmpn(0artnmociotfpteaivi;( s2toxopiu4amt mfciat  ruaxr ;u0olxn o3ilsfaDea( snt0 lxnmf oa1fmDr uvslt  rxmio3iy4omtnmnvsa( sDrr(mpot1apenioeiatla rl(mont) ltoif ta1fptranvo ()t2trxr3iu4apenmfcilsfs2tmu  ;t4tpt  fcias mDel(mon(0arxoif iodfpDeauvols)srxmxopnudome  nvsat)sDrau  ;u1apxn ictysfa2ulums t0trerxr oatfpD  u o t t2to(o oydame lictls  Drm(r nt1olx  ociatla rm(vsn(0 eenxr to1op rlnei t0srumxr3iodllt lfei sfsrur( pnu0apxnif3iytfm2el(vs t0alxnxf3ty1op eliesls)srxr(m iudlle lnei t a2urxm ot4oexomi3tad a elumo;u)tltnio todlpDelu sl(0 rtr(mpoydale  fesas  2ua(rp;t0tpen o3iasfm2ua(vo;t0aexomrcoatom  luvo s) rxm(o oo4ope lnvt t sDuau poo0tlenifeiltfm ea( snu) rtrxrcta1faDe n o t0t2xoir3iy4opt mieias aDtaump;u0apxomi3ils sDrl( pn() rxrmo3ta1oa raieo t s2umir3iodaltnlict s srumxr no4tltnmoeiydfsDel(mon() lermocto1fpDeaivolt0 2trxo oo1lmen neiat sDrrum oo0alenifciatfaDua( s t) leoirctadom eauvolt0s2xoxo3oy1ale  fcias)arrax  ;t4texoiociadls uanmp u0teenirctadomt aivo;(0trtr(mpoy1ll n nctl( sruau  ;t1apen i3ils s ulums;(4trtoio tadlm  lieslt sexmir no4lpeelfetat srtmurpnt1tptoioeilslsDrl( s;() ltrxrcoa1lmD  nvilt0texrim3nydlmee fvias) Dtmurpno0ale  i3iydfa eluvs;t4tltomr iodoat auvi;t t2toxmpiudaleelfesl(  2rmx oou4tlx ifetys mDum(vp (4 eeomf oa1oateau i t  rtoio iy1lle livsls)srta( oou0oeen octltfa2uaums (0alxrxrctatlp eaneols) rxrir3iy1ll emfeil( sDtrum ;t1opeoiictyslsDuan p u0tlxoir3iydlmtrai s (0t2umxm3iy1lp emneil(faDta(m no1texoifeils s ea( s t0artnir ia1fa   uvsl( trumxo3oy4altnlfvtat arurum ;o1aee  ocils mDel(vs;()trtomrcia1fm rai i;s) etmimpno4ameemivta(fs2tmxmp;o4opxoioeiasfa el( pnu0tlenxoctodlaD aiei;()s2um(r3iydlle mfct s srtmxmpnt0texo i3tytlm2uanms;u0trxoircoatfmte ies;(  2ur(r3nodole lnvi t)srrm(mp;o0tleomicils m emnmpnt0 etnxf todfaDrluvo s s2tmxo iu4om n ivia(faDrmumono1ale  feiytfaDem(mo;t0trenmo ta1lpD lu ilt0t2umio iy4ame lfct t a2umum nu4alx if3iyd mDrl(vo ()tetnir3iytfmD  n s (  2um(opno1amtelfei s)sDumuroou1opxnmieiadfs2emnvo;t4 ltrmo oodoat  n olt  2xr(rpnu4ol nmieia( sDra(m nt0alxo f3iltlaDranvs (0 lermr iy1opDraies (0 rxmxr iy4oltn fci t)sDta(mpoo0opt iiciytls2elu s (0tetoir3tatlaDranvi () 2xoio nu1op elieiltfsrrmumo;o1teeomfeildlm2rmump;(4trerifctodomDrlnes (  2uoir iy4om nmncta() 2rrur ;t0tpeoiociat aDemn o u)aetomr io1oaDelnei t0texo(o nu4altn ivi s) rtr(rpnt0aeeoifciatfaDea(mon(0 exoio oytfp rlnvs;t) 2um(opiy1lmt  ncias sDtmxmoot4aetomocildfm2ul( p;t4 ltnif3oatla eau o s0t2tmimpnu4lmenlnci ( s2rax ont4oeenmi3ilsfm ua(mo t)alerxf oydfmtrlivo ( tetr(r3nudom e ncsasfa2uaxm ;u4alen o3ild s rln on(0tltrxo io1fm   uvi;s  exrxm3oo1am  lncil(f Dtaur ;o1olxnmfetysls2uln s;t)tetnxoctotfm   neo s  eumio no1am emieil( sDtrurpoo1tpen f3tlslm2rauvo;() lenxo iydfaD  n i;s) rumim oodoptelnes s sDtmum oo0opt io3iydfmDea( p t)tlxoir3io1opDrln i;t0t2xrimpio1ame mfeilsf Draxr ;t4oexniiciasfmDuauvont4tleoif3oy1lmDrlu i s  exoir3oudomte fctlt) 2tr(m ;t4aetn fctatfs2ulnms t) etrircio1laDrlnei;t) 2uoimpno4lm  lfcilt  2trxm no4olx  oetls m uluvonu) lxrxr tadfp elnvslt)teurxrpnu4lme  ics tf rururont4oetnmiciat a2em( o u)arermo3io1lpDrlnvs;t)t2uriopno1lmtemnvsat a2urxr ot4tpxnmiciysla ea( snt)alxnxf oo1fmteai o;() eumxo iy4lpenmnciasf Dtmx  ot1tet  fcildfm um(mp;t)artoxrcoodomD anes s0sexo(o oy1llenmiesltfsrrmxmoot0tlt mo3iydla umnvo u4aeenifciotlmDrlu ols seuoio ou4llenmfetl(f Durx  ;u1ale mfeiytlaDrmnvp;(0altnmr oydfpD  neo (  exrir oo1lme mnciasfsDta(r no1opeomi3iytls eaumsn(4alxnifcoodfa  an olt0 rxrxopnu1lmtelnctl()sDrrxronu4oltnii3iad sDuau sn()arxomr io1faDranvs;t0trtrxmpny4ll  mivtasf Drmxm ;o0oetn i3iyd m umuvo;()trxnmociotfaDeanei;t0 2toio3iy1lme  iciat  2ra(r oo4apenifetldfs2rmnmont)aexrmfciatfa  ai s;(0t2umxr3io4oltemnvils)a2tmu ono1teto i3tlt m um( snt) etnxrcoodfm eau i;()srumxo oy1lm n nci tf rum(mont0tetomo3iaslm uan o;() exoxr io1omtrlu o s0 2xmio3iodaltemneia(fa2uaxmooo0aleoii3iydlsDuan s;u4trenir3todopte uvils t2xo(m nydolte feilsfartr( p;o4altniiciadlaDelnmo u0 exnxo oatfat lneo;s0s2urir3oo4lm nlnct s) rumu oou1aeeoif3ils m emums;t0treniocto1opDr n i;t0srxmir no1ol nlnvtlsfaDuru o;u0tee ifciltfa rmnvon(0 reriocta1faD  ueol() rxm(r iudoptnmfvsls)aDuaxronu1tetnmo3ilt a2eaumo u4arenxf3ty1faDelivs s0s2xmio ny1lp elictlt)a2rm(m no0ale  ietls m2em(msnu)tlerxo3todfpDrlu ols  2uo(r3iudamen ivs s)a2taxm no4oet mfetysfm ra(ms;u)tltrxrctatfmD aieo;s) etmxm3oo4apee ivi ( a2uax  ;u4oeenmoetadlm2elumo;t)aexrifcoatomDeanvo s)t2xoxm ou4op emfei tf Drmxm nt1alt mieiydfm2uaums;(4areomf totlmte ivslt srtm(r3oy1altemnci sf 2truro;u0apt mocilsls ea(mp u0aetnxr3iodoateai s s0 eum(m3ou4lpte fcsltf 2rru o;u4teenioetytla ra( p u0trenmociydoateaieo s  rxoxopiy1lltelict t a2ta( ono4tltoio3ilt sDrln p t4arxoir tydomteaivols)texrxopoodlle mies ( a2rr( o;o4olenioeiysfsDuanvpnt4aeeoxr3iodfm rlnvi () rtr(o3oo4lp elfetltfs2rmur ;o4tle mf3ils aDumums (0arxnmf3oy1lpte ivols)t2urxrpnudom elfcils sDtru pou1tlenifeiytfm2rm(vs;u0 lerxr oadom rauvilt) etrio iy1lp nlnesls)srur(  nu1oeeoifcias mDul(vs t0arxrxr oodfpt  ieilt) eumim no1opee fvs ( srrmumpnu1apx ifeiyt a ean p;u4 rxoxf totfm  anes;t) eto(opiu1opt  ict t s2tm(ro;o4oeeoif3iadfs2uau s ()tleoxo3oydlpD lueols) exr(m3oudalenlfes tfaDuru pno0opeoifeiysfm eau on(0 ltnmo3oy1fmte ues s trur(o iu4lltemivta()s2urump;u1oet  i3ilslsDeauvs;()tleomf3oydfa   nvi;t) exoim3iy1lm n fct ( a2rax poo1tee mieias a emuvo t0texomo iytfmDelu ilt) 2xm(opoodlme lfviat arra(  no1olx moctltla em( s (0 exoxociodlmD auvils0s2toxr3oudll e iesl() 2rauronu0alx mi3tatla2ranvp;t0altrif3iotfm rli o;()t2xrirpou1op e fctas arumx  ou4apt ifctlslm2umnms ()altomo tatfpt anvslt)tetr(m iy1lptemict t)sDtrxm ;u4tex iieildls eluvp () lermo oy1om  lnvo;( s2xmio3oo1olenmfvt t  Drrx  nt4teen octadfs2um(ms ()aetrir oadoa eanvi;s sexo(mpiy4am  mnvt t)a2rm(mpou1ape if3ildfs2rl(monu0 lxrmfcoadfpD  u s;t0 rum(rpnudlmtelfvtl(fs2rm(r nt1opxn oeiaslmDua(mo;()alxomf3iydomteauvs;s tetrimpiu1ol e ies t)s2taxm nu1tee ifeiltfa ul(ms;u0 rxnxo oodfm  auvslt) eumxm3nodaltn nes sfsDtmum ;t0tlen i3ildfm2uau o;t0texoirciatlptrli o (0 eto(r oydlmtelivslsfsrrr( poo0tleo fetasfa2el(vs (4altrmr oa1fmteai o () rxo(rpoo4opt  fet t) Drm(mpot0tpe  i3iltfa2el(vpnu0 lxomoctadomDrlu i;s0sruoimpoo4ole  ncsltfa2umx  oo0alt ifeiytfa2ulu s;u)altrmrciotlp rluvolt0teumio3io1ameelnvias srrmxrpnu0oltoiietldla ra( pn(0aeeomr iadfpDrlu olt)srtoiopnydopenmfesa( s2rrur ;u1ape  ietytla em(mp t4trtrxr3io1oa  livo s)seuoxo3iu4am n nvsat sDtm(mo;t1optn i3iatfs el( p;(0 lxoxo iadomt au o s)trxoxmpny1am e ieils srtr(mp;t4tetoif3tyd sDrau p (0aeerirctytfmtelues;t)trum(o no4amtelfesa() Dtmxmpnu1texomfeiysfa rm( o (0 ltoif todfmD  nvs t0trum(r nu1lmenmneiat)srtmumpno0tet io3iatlm rau pnu4trtnmf iadomtran i;( setoxrpoudllt  fes s) rur(mp;u0aetomfetldls raumont0 exoir iotop e u sls0tetrxopnu1ap elics () 2urxrpno1tet  f3tldfm elnvo t0treoxrciytomtrluvol( srtoxr ny4ope lfesl(f Durur ot4ope ifctysfmDuluvp u4altnir iytfmDe uvolt0texm(r3no1lltnliei (f Draxmp;t0alxnio3tlsla2umu p;(4tltrmo3totlpt li o;s  eurxr oodlmtemfciasfa2uax p;o4oetn feiydfm2ran pnu4teermrcoodfptr uvs s  2to(o3oy1lp  livil()aDrrxrpno0apxnii3ilslm ea(vsnt4 etnmf3tatoate neolt)trto(opnudlle mfesl(faDurumpnu4apenifcilsls2rm( p u4 renircio1om r uei;()t2xoim oydllen nvsasfa2trx o;o1oexomf3tatfa2rauvp t0tetoxr tydfa rlu o t)s2xoxo3ou4ap e icslt) Dumx oou4optnmf3iysls2uanvo t)artrir3iotomtelivi (0s2xo(m oo1omtnmnvs t)s2rrxmp;u1olenmieildlm rmu o (4texrio3oy1faD anes;s sruoir iy1ole lnet (f Dumumpoo1tpeomfetat m2eaumo;u) etoxfciy1lpDeai o (0 rtm(mpnu1ap emnetas a2ra( ooo1oex mieiasla2ra(mpn(4tetrmo iy1op  anes;()trxr(o nodal elnvi (  Dtm(m nt1aexniictasfm ul(mp;t)aexomr3tydlpt luvo s trtmim3ou4lltelfetl(  Drmx  oo0ape  ociat aDumnvo (0arxoxo3todopDr ieolt)sexriopio4lm e ics t s2urum no4tpx micildfa umnmsn()tltrmf3iatfmtr ieolt)teumiopny4ll elnctat)a2tru p;o1tlto o3iad mDul(vp u)artrir3tadfa  aneo;(0seuoimpoudome  ivs t) Drru  ;o4olt ifeiaslmDeanms;(4trenxrciodfm rlieo t) 2xmir3oy4ameemfeta(faDurx  ;o1tlxomietad m em(mo u4aleoio iodlatelu i;(0t2uo(r3iy4altn fvtlt aDra(rono1oet  fctldfa um(msn(0aexrir3ty1omD  uvo (0t2urxrpoudll nlnci t)srtr(ro;u0texo oetys mDua(mpnt4aetrxf3iy1omD li o t texo(r3no4ll emfei ( sDrmx pno0tetn fetld s2ra(vp;() exnif3iatfmteli olt0s2tmxr3oy1alte fei (f Dtmuroot0apxniiciatfaDrmnmo;t4 exnmo oy1fmD  ieo (0 2trxrpio4open fvt ()s2um(  ou0texoifeiatfm2emnmon(4artomo3oo1lm e ivs;( trtoxo3oudamtn neia()s2ta(ro;o0olx  ieiatla2rmn pnu)trerio3tydlmD  iei t0seto(rpoodlm elnct s)srurxmp;u1ale  oetas a2uln p t)aetnirctytoaDe uesls) euo(m nodlp  micias) 2um(mp;o1opto fctat m2umu on(0arxnxf to1fptrluvo;(0seuo(m3oo4am nlfctlsf Dtax poo4tltomoeils sDra(vp;u4tetnxo iy1lpD  ivs ( trto(o3no1ope mnvi tf 2ua( p;t0aleoifciysls rluvp;t4trerifcto1lat anvi;( trtoiopnu4al   nvta(faDtrx onu4tpx mfcils s umnms;t0 exnio3oytfa   ieol()trtmirpno1omt  nvt ()aDra(m oo4aleniietatfs2uaumo;(0 eermr ootfp rluvo;()tetrio iodop emfesl(  rtaumo;t4texn oeilt s2ra(vp u4 rtrmr tatfmDran o t) eurim io1ape lnesatfa2uaxmonu1alxo o3tyt m2eanvs t4aleomo3tadomtelieolt  2tmir nu1oltn icsas  rum( p;o4opx ii3ildlm emnvont) leoio ta1om elnvol(  2xm(mpiudlpenmivs t)sDrax oou4oee mfeias a rauvp;()altnmo iytoptr uvslt0 exmxo3nudolenmfvi s srtaurp;u1teenioeiys m ra(monu4alxomociotlmDeaivi;s trtoio3no1ol  mivi s)sDtrurooo4ole  fetadfaDraump t4tlermo3ty1op   ieol( sruoxm3iodlp  lfvta(  rtmxmono1apt mfeiasfs rl(mpn(4areomf3iytop  anvo;s)tetr(o3iu1al nlies tfa2tmum oo4tet ii3tltls ulnvs t0trxrif oytlmD  n olt s2uo(opno1lltnlivtl( aruaumpnt4alx iictysfm rl(vpn()aexrxr iytlmDrln s t0 2um(r nudoltnlnei t a2rmx p;o4tlen i3tysfaDelnvp u4altnmr3iotlm rauvilt)t2urxm iodaltn ieiatfarraurp;u4oeenmoctlsfs2emnmpnu0teerxo tatfa  anes s sruo(rpoudapenmfct s  2tr(m ot1opx  o3iytfsDrlu on(4tlxoif iydfp ranvi;(0texoxopnudome lfct (fsDum( oot1tltn oetldfa2rl(vp t)alermf oodom  ai ilt0 ruoxm3iodam e fvsas s2rrxmoot4oet ioeilsla2emuvo;u0 lerxo3oadlm ran s;( srtr(m nydapenlfviltfa2trxr nu0apxo oeiadfm2umn on(4aetnmf3oatfat aieilt0 rto(mpnodll elnctlt s2taxmpnt4oltn ocias a2emnvsnt) lerif tytopte ueo s tetoxm iy4op e fes t  rrrx  ou1oee  ietad m ra( s;u4arxrio oadfaDraivi;( seumimpno4om nmnvtat)sDtaur ;u1oee ifcias a2rmnvs u0alerxo3oydfa e uvi;( s2tmxm nu1om  liet ( a2rr(rpou0tetomi3iasla um(mp (4 rtrxrcta1oa raivo (  rtoio nydlpee fvias)s2tr(m ;o0oee ioeilsfa elums;u0 etnmo3oa1latelivs (  rum(m3oudomt miei s) rumum ;t4alto octas a2emn p (4altomocta1lpDe u o s trurim3nu4aptn nvsltfsDrm(  ot0tpeo ieiasfa uau s;t)aexrmo3tatomDeauei t0teum(rpio4ap  mivsasf Dtmxmpnu0apeo feiydlm2emnvo;()tltnmrctatla  ai ils0teurxo no1amtelfeilsfs2raxr oo1aeeomfctytlaDrl( s;t4tleomf3todfpDrluei;s0s2tmirpio1lm e fctat)a2rmx  ;u1oltn feildfm2rl( o;u0alxnxr ta1oaDean o t  2uoxm oydoptn fcsls s2rmxm ou4oetomiciys m rl(vp (0artomf ta1omt aivol() 2xmxopnodolte nvt () Dtr(moot4oetniicild a rlu p (0alxnirciadop  ai o;s0setmir iu1lme mivsatf Draxr ;u1opx mf3iltla2um( pnt4texnxf3tydfmDeaies;t) rxrxmpnu1ap nmivt t)srtaurooo4tlxomieiydfa elnmp (0alxrxr iatlpDr uvi;(0teur(o ny1omtemieiatf rtmx  ;o4tlto ieiad sDuluvs u0 ltrxo oytom r uvolt)trurirpiodam  lieta(  2urxro;u1tetnifctytfaDeluvont)aeenxfctadfaDe ueils  euoiopou1op n nei ( s2ur(ront4aet  fciyslmDuluvo;(0altoio3iadfptrlivi;t  etoxo oo1amtnmnciasfsDtrx o;u4texomfeilt s2rlnvpn(0altrio to1fmtraivo;t0 etrxo iu4aleelncil(  rtax  ;u4tle mictls mDelu on(4 exrio3oa1lm rlu s;t) rtm(rpoudlpte fei s  2ta( p;u4aleo fctys a2uauvsnu0alerxfciodoaDeln il(  rtmim ny4alte feia( arrm(monu4texnmoeiydls raumsn(0altnirctatomD ln o;s)srxrir iudlptnlfesa()srrrur ;o0alenmo3iyslm emnms;(0alxnmo3oydfaDr uesl(  2uoim3ou4ol emfcsas s2rru oou1tptomfciysla2rluvs;u0tlxnxo iodomt  iei ()s2tmxr oo1lmtn fvi (fs2rr(rpot4aptnif3iytfm uluvonu)arxomr3ta1lpDe u slt0tetoxo iy4llt lneil(f 2tmuroou1tee  i3iys a2umumont)tltrir io1fmDr nvo (0 rtrxmpiy1am e fctas s2ta(  ;u0altomo3iadlsDrm( s;u0 ltnxr ia1fmtrau sls)teurxm no4am  mnvs sf ruaxmoou4alxo o3iyd m rlump t)aeeniociotfpteaivils) 2trim3oo1altnmictl(  2rr(mpnt0optomiciadlm2ua( p () etnio oo1fpDe neo;t t2xmir oo4ale mfvsls aDtaxmo;t1apxo icilt aDemnmo;u0 lenio iodlaD lieo t t2toxm ou1lleemnvt (f Dtrur ;u1aleo icilsfsDulumo u4tlerio3tytfaD aivi;s0seumxmpiy4op e feslsfarur(r ot4openmfctadlm emumpn(0aetrmo3io1op raivsl( s2xoxmpiudal   net s)sDurx p;u4open oeiadfm2umn pnu4aeeomociydoa r u ilt)tetmxrpiodopeelnvt t  Durx p;t4oee  o3iytfm em( snu0 eerxo ia1fpt anei ()texm(m nu4ap  lnet sf Drrxmpoo0ope  i3iydlm2rlumon()aeeoifcoodlat auvils  2uoxo io4lm nmfviat)arra(rpnt4tlxo i3ilslsDumu o;t0 ltriociodlm rlnvi;s0trxoxr oo4ll   nesat)aDtmum nt4ale miciyd m2ulnmp;u4 reoirctotfmt ai o t setoir3iu1llee ics t)sDumxrpou0aeenmieild m ul(msnu4trxrmf ootlmDe i ilt0 rurxr no1om emnetl()srur(  ;t0oeen i3tls m rm(vsnu4 eeoxo oydlmDranvilt) exrio oudopeemncslsfsrtaurpou1tpe  o3ilslm2uanvs;t0 ltrxr iydlmDeln s s0 etr(m3io1ap elivtl(  rraxmono0oetnmietytlmDrm(mpnu4arerxfcio1omDeanvo;( t2trxmpno4lmee ncsls  2trxroot4tptnii3iat m rlu s u)tlerxfcoatopD anes;(  rxoxo3ou1am n iesltf 2trx ont0tptnifeiadfmDra(vp;() ltriocoatopt  uei ()sruoio oy4om elfvtatf Draumooo4olxnifciydlsDrmnmo;u)arermf tytom   ivi t)teurir ny4apee icil(fs2tmum nu4tlto i3iysfaDrlu snu4tltnio to1oaD livi t)t2urxo no4ameemict (f rrmxmont4tpt  o3tysfs uau sn(0aeenif iadfmD lnei s texmio3iy4ome mfct () rtrx pnu0opto oetlsls umnmsnt4alerxf oo1faDrau ils) rtr(m nodamt mnvs sfsDumxroot4tltnmieils m2uauvs u4 lxnxr ia1op e n sl( tetmim3oydlp n iesl( s2rmu p;u1altnmf3ils aDra(vs t4tleomfcootfa  aiesl(0srxriopnudlm  lfci ()s2uaurooo1ope iieildfs ul( s u4trxoif oo1fa  an slt) 2trxrpoudlp  mnvilsf 2ua( pot0tpeoiociyt s2umu ont) rxrir ty1fp rln s s)t2um(r iy1al elieiatfs2ra( o;t1apto f3tydla2ra( o (4trxomr3oodfmDeaivi;s) 2xmir3oydllte nvta(faDrrur ;u1tlxoiocils m2emn s;t0tlxoxo iydfpDelivolt  2xr(rpnodal emivi sfaDururpnt0aee mfciat m eln pn(4alxrmr3to1fptrln o;( teuoirpio1ome  fcia(farua( onu0apxnif3iad sDum( o u) rtrif3oadomt aivilt s2uo(mpiu1lmeelivt sf 2umxmpoo4tet  f3iltfm ra(vs;() exoir3todfp e ieo t0 exo(rpoy1ome lfei t  2umumoou4opeo fciyd m2eauvs ()alerio iadlp eln sls)t2xrxrpou1optn fciasfs2umu  ;u4alxn i3tls m2emump u0tleomr tadomtean ols)t2xrxr3iu1ame  nvi s)s2tau o;u0ole if3iltfm elnmp t4 eermf3oodoaDraues;( t2urxr oy1lptemieiatfsDtaxm nu0teeomo3ildfmDul(mo;(4aexrmr todla eai sls0setoxm oy4am  mnci s  2urum ;t1optnmfeiydls2umu p ()tltnxfcoadlpD lueslt)seumxm oo4opt  nvta()arrr( onu0tpxomf3tldfsDrmnvp t4trermo3iy1latrlnvolt0tetrir no4op e fcsatf 2ra(mpnu1tpenmfcilt sDua(msnu)texnmocta1omDeauvo;t0trxo(mpoodoltemnvtlt)sDrmxr ;t4tlt  o3ild a ua( s;u0 exoif3to1lm eanvo;s0srum(o no4ol nlfctat)a2tmu  no4aexomictasfm2um( p t)alxoir oy1oat auei;()trurxr3oy4lptemieslt) 2trxmp;u1alenii3iad sDrmnvon()arenmf ty1fmDelies s0srxr(r no1apeemicsls)sDtaurono0aleomfcildlmDeau o;u)aetoxo3tytfmtrlnvo (0 2xr(o iydlpenmfes t)aDrmx  ou0opx  octltlaDuln pnu0 renxf to1lpDr i ilt t2xrxo3io1lm  mfei t)aDrmxm ;t0aleo iciat s2elnvs t0artrmrctadopDr u s;s0 2toimpiudamenliesatfsruru  ;t0teenmi3iysfm2umnmont) ltnmfctadfat li o s0trumxmpoy4olt lfvs t s2rm(m ;t4opt  fcild sDeanmsnt0aeeoxo iodlp   n i;t0 eur(rpoudamenmnei t)aDtmx pou4oexn iciydla rm(vs t)alxnxrcoydlpteluvi t) exrir no4lm e ici () rur(moot4apt  o3iydfa2rmnmp (0tleoxf to1lptran sl()trtoiopny4alte ncia() rra(r ;o0ape iocilt m emu s u)aetnmo3iydfat  nvolt s2to(mpoy4lme  ict ()srrrxm ;u1optnmfeiydfs emn p;t4arerxfctytoaDeluvi (0 2ur(mpno1lm nmfet s s2umxront4ole  fciadlm2rm(vpn(0aetnio3ty1lpDeanvols0srur(rpnu1apte ics tfsruax  ;t4olt ioeiyd a ra( pnu)texoircoytfa   ivolt  etoxr3nodoltnlivsas arumu ooo4tpe ifeiltfa2el(vp;u4altrxoctydlaDr nesl()srtmxo nudope lfvs sfaruaump;o4tlxniocild m um(msnu0 eermf3oydfa elu i;t  2ur(opno1amt mncsl() 2tr(r no1oexoif3tydfm eln s;u4altnxrciydomtelneslt) rurim3oy4lp  lfvt tf Dumu p;u0texomf3iytlsDel( p u)aetomfcia1lat ln olt0t2toxrpnudamtemnetas)sruau oot4apt ii3ildlmDua( s t4tetriocio1fmD  i s;(0 exoxmpny4omenlfcs ( a2rax ooo1tleo octldfaDulnvo ()trtrxocia1opDrli ils  2umir iodape micils)sDua(mp;t0aptomi3iatfmDrmu snu0 lenio3ootoat au o ( sexm(mpiy4aleelfcilt) rua( p;o1open i3ias aDumuvo u0arxrmociytoaDeluvs;( s2xo(m3iudalt mivsls  2umxmp;t0aetoiicilslmDrln pnu)tetoxr3oodoa  luei s trurio no4omtnlfvs (fartr(m ;u4optoifctytfs rm( p;(0 rxrxrcootfmDrlu o t s2uoir no1ol elnvias)aDtrx  ;u4alt  ictls s2ra(mo;(0aetnxf to1oaD anei;s0t2xm(r3oodlpeelfvt sf rrr(r ;o4aet  oeiatfm el( ont0aeermr iy1laD aiei t0 rtrxmpiu4amee fet t)aDrmu  oo1tpt mfciysfm ean o;t4aleomf3oatopDranei s0teuo(o iu4lltnlnct t)artaxmpot4tltnmf3ilslm uanvp;t4tlenif iydlptelu s (0texmimpnodom   fet (  rtmxr nt4tetn f3ild s umuvpnt) rtnxf tydom  lueolt)s2tmiopno1lpen fcsls) Drmum ot1tptnioeild s2eau p (0tltoxo3ta1fmDrlu o;(0 2uoxr3oy4lmenlnvtltf rta(ront1tlxn fcild m um(mp;u) reoirciotlat li s t t2xrir iy4am  mivs (fsDta(r nt0tpeomfciysls eauvp;u4 ltrmoctytomtraivo;( s2tr(m oydlpe lfeia(fa2tru  no4tet mietldla2rm( s (4aeermo3iodfm eln o t trtm(r nydapenmfci (fa2uaxmoou1oex mfctlslsDrlump;(4trtnxo oatfpteluvo;()trxoio3no4al e ivtls  rrm( pot4optn o3ias m2rm(monu0trxrxr3iadopte n olt  rtrirpiu1am emicslt)arur(m ;u1olt iieildfm2em(vpnt4 lxnio3iadfpDeli slt  2tmimpiu4openlfcsas s2rm(ront1aetniietat mDuau s t4alenifctatlaDelieo (0tetr(mpou4amt livta(  Drmurpot1ope  ociadfa2rl(vs;(0alxnxfcta1lpDelneslt  rurimpou1lmtnlnvtat) Dtaurpot1tpxoio3tydfm2rlums;u4 rtriocto1oaD  nesls)s2ur(o3nudap nlics (faDtm(m ;u4optnifciysls uau s t0aleomr todfmDeauvs;s s2tm(r3iydoltelict (f 2rmurpnu4opx iieilslaDul( p u4tlenxr tytom  lneolt0s2tmir iy1am   fetlt) Drmxr ot0oee  octysfsDemn o;t)aeeoir io1lm   nvs () rxoir3nudaptelivsl() ruaump;t4oleomi3ildfs emu snu0tlenmo3io1lp ranes t  2xmxrpiu1lmtelfvtlt srraxrpou4opeoio3tasfs2ranvs u)tetnmf iatfat  ieol(0 rtm(m3oo4ome liviasfsrtaxr no4tleoioetldlaDemnms;t0 lxrxf tatlp eanvsl( s2xm(o ou4alt mfvsltfs2ta(r nt1oee  ocilt a2um(vo (4tltnifciatfaDean sl( texo(m iu4aptnlietltfsDumxrono4aptomo3ild a ulnvpnu4trtnio io1fat li sl()s2xmim oo4omen ictat a2ra( p;o1ape  iciysfm2ulumo;t0 leomr3iydoptelneo t s2to(r3no4ll elivsatfaDum(m ;o1tpt  ietlsfm2uluvs () rxnxociodop rluvi;s tetmimpio1al nmieil( srtm(ro;t4oexn f3tlsfa emn sn(4altnir3ia1lmt li s s srxmxopnydamenmfvi s) rua(rooo1olxoioetydls emnvs;u4tetoio3oa1opDr n ils0teum(o oudomenlncil(fsDta(  ;u1ape mo3iysfs2el(vp u0tetrxf3tatoaDe ueo s  2urimpiy1lpt  ieilt)s2rmxro;o0alenmicild s uanmo u)alxomo3iadfmtrlnei () exmxrpoydale mncils  rtm(  ou0tlxn oeilsfs um(mp u) rtoxr oo1fpD  u slt  rur(o ou1apeelnct s)artau o;o1oex mfetlsfm rmu pnt0 ltoif to1lmDe uvi;()srxm(r nydalt  fei () rumuro;t0aeen feildfsDeanms t)teerxf3to1oa e uvo;s t2xrim3oo4omt lnviat) 2raur ;t4tpto ieiasls2ulu o;u0 etoif oa1lmte ieo;t) 2toxrpoudaleelicil(fsrrru pnt1tlxnmo3ilsls2emnvs;t) exnmocoa1lp ran i s)srtoxopnydolt miciat)arumx  oo4apen f3iysfm2umnmo u) rtrmr tydlmtrlnvs;() rxmirpou4ll n iet s sDtr(  ;u4tlxomociatfm2emn snu4 rxnir3oytlpteauvi;(0srxoim3iu4olenmnvia(f Dumx onu1tetoiociyslaDemums u) lenmfcto1lp  ln ils0 exm(rpio4lm   feilt)sDua(  no4oexo fciys a2ean pnu)tltrxf3oodfpt lueols0t2ur(opiydap   nct sfa2rr(  nt4apx mociatfa2uanmpn(0tetnxf oytfmt  ieilt0 rxr(r3iudom  lnci s)aDrax pnt0opxomieiydls2umump;(4artnirctatfa   ivils0 2toxm iy1apt mnvi () rtrurpoo0aeeoii3tld sDemuvp u)aetoxfcoy1lmtraueo s  eur(o iudll   ivta() Drmxro;u4tptoiieilsfsDrm(vo u)alxrif3oy1lp eaivo ( srxrxr oydlme mfetat) rum(mpno1opxo ietlt s rluvs;u0tlxrifctatfa  luvs s seumimpoy4lp nmnct s aDrrx p;t1tex iietad s rm(vp (0texnmf3tydla rau sl(0tetrio io4am nlneiatf 2taur nu4alxnifcild aDra( s;() lerxr3totomt lneilt0srxr(m3iy4ap elfctlsfaDum(rooo1oetnifeiltla eaums ()tlenxf iotopt aiei () exoir iudol n iet ()a2taxmp;o1opxo o3iad aDrmuvont4altnif3iadfat auvo (0seto(opiy4opee fcslsfa2raumpoo4tpt ifcilt s ulnvo;(0trtomrcoytoaDelnvol( tetrim3ny4olt mncia(f Drru o;u1aeeoiieiaslm2rlumpn(4 exoifcia1laDraivi;s trumxo3nudamt liesat)s2uau ooo0tpen feils aDrln o u4arerxrciytlpt ai i;s) etm(opoy1om n ivil(fsDuax ont0oltniiciasls2umn s;t4altrxf oadlaD ai s t0t2xm(rpno1apeemieils aDrau o;o1apt mo3iytlaDeau o;(0 lxnmr oatfmDeai i t0texo(rpny1ole  fvslt srrmxmo;u4tlx  f3tys a uln p;t4teerxf3iadomt aivo ( tetriopoo1lmtnmfviatfaruaur nt1apt  ociasfa eau s;t0 eerxr oytoa e neslt)srxm(mpno1olt  iciat s2uaxm no1aexn ictas s ulnmsn() rxrio3ta1fatrluvolt  rxoxo iydlpt lfvta()arrrxm no0ole  oeiytlaDrln pn()trxnxr3iydoa   nes s srxmirpio1omt  ics sfaDrrumoot1tlxo f3tldlmDem( s u0texoir oadlptrai slt0 rtm(opou4ome  fcs tfs2tmur ;o1oeen fciysfa2umu s;t4 reoiocio1om e i s t) rxr(o3nu4optnlnvsa()arum( o;t1texnmo3tld mDranvs (4aexrmr3iatfaD  ieo;t trto(m ny4op n icias artrur nt0aet ii3iys aDemnvo;t)trxoifcia1lmD lu slt)trxoxr3iodop n fcias  2uaxroot4alxoio3tyt a uauvon()aexrxr3ootoa eln s;( s2xriopnydlpe lictas a2ururp;u4teenifetytlsDel( o;t0trxnxrciatoptr nei t0srxmim no1apenlnvil( sDtmxm ;o0ale mieiatfm rlumo;t)trtnifcootlmteaues ( seur(r3io4ol nlictas)sDurxr ot4tlx  fetat a eanmp;u4artoxociatoa elnvs;()texm(o3iu4apee fvsas)s2urumont4oetnmi3ildla2uauvp u0tltnio3io1lmtr u o;t teurirpno4altemnciltfaDurxrono0aex  ictasls elu snt4tlxoircoatfmDeanvsls sexr(m iy4omeemfcsat)arta(  ;u1tpen feilslmDel(mp;t0arerir oadop rlnvols sexo(r nu4apeemfvs s)s2rm( poo1apxo icild a rmnvo u4tlenifcootlm  liei;()texr(r oo1apenmfcsls) Dtr( pnt0aee ifeildlm emnvpnu) lxrmfctydlat li ol()s2xriopiu4lmtelneias)artax p;o1oet if3iltfa2emnms;t)aexnxo3oy1omD aieslt seuriopoo4ll  mfesltfaDtmxmo;o1oltnmociysfa rl( s u4 renmr3oydomDe iei;s) ruoxr3oo1om  lnvia( arta(m nu4aee  o3iyt m2rlnvp;u4alxnir3ty1oa r u s;t0 exoir3io1lmen ict (fsruaumoou0oee  feiydls2umump u4aexrxf3ty1laDraivi;( sexm(mpiy4ll  lfcsl()s2rax pot4oexomfciysfa2uau s (4 lxoxrcty1op  anes;t0 etrim3oudopee fvsas  Drm(mo;t4olt mo3tytla ul( o u)aetrmociadfmtrau s;s0truo(mpno4opt licta(f rtm(m oo0tlt mf3taslm2uanmo;()aetrxf3to1oa raivilt0t2xr(opou4lpe mivt s s2tr(rpnu4aet mo3tysls2em(vsnu0trxoircootom rlnes ()trtrxr nu1amte ncia() 2um(r ;u0tlt if3tyt s2elu s (4altnif iydfmtrauvslt)trxmxm oo1ll n nvsa(fs2truront1oexn oeils s2eluvo u0texnxr tatlateai s;(  2toirpoydomtnmncta()a2rm( pnt4tleoio3tltfm ea(vo;t0 eeoxocoatopteli s ()s2xo(rpno1al   fesltf Dtaxronu1ale  feiltfa2raump u)texrmfcootom eai i (0teuoxo3oydapt  netatfs2ra(  nt0teeoiieiydla ea( p () etnifctatfaD lueslt)teurxo3oo1ap emfesls arraxronu0tptoio3iyslm emnms;t)tlxnircta1lm raivi;(0setrim3ou1lme mnvtls  rtru ont0opto ociltfa2uanvs;u)tleoir iatlmt lu i t0 etoxr3oy4ap nmict t) Drmx p;u0ope if3iytfs2uanmpnt0alenxocoodop  lnes;()s2xrio3oy1lmtnlivtatfa2ta(mpnu4tex  ocildlsDemnvsnu4arxnmo oydlp rlu i;()t2xo(mpou1ameeliei tf 2rax p;o0ope  ociysfaDra( p ()tltomf oadlpteauvs;()s2tr(rpou1ap   ncs t)aruaxr oo1teenmfetldls eanmsnt4tlxomo oy1lp  aueilt0sexrim oy1al  mneil( srumu onu4apeomfeiyd mDranvp (4trtrirciydfp e i ols0setrxopiodllt  nei tfs2umxrpnu4opxomo3tyd s2ulu o;(0 rtomo todlm e n s;t0s2uoir oo4lm e ivta()srumu pno4apeoio3tlsfm2eluvp;() ltnxo oo1lp  lnvs (0t2tmio3io1lpenlieilt)srtm(m nu1alenioctadla raums;t0arxnxr3oo1oaD aueslt  2uo(r3oy1lltnlfesat)arrm(m oo4olx if3tld a2ulnmpnu0 rtoio3oodfmt auvilt) etoir3iudlpt mfvtls) rrm(mono0aexoiieilsfs2rln o;u0aetoircta1oa elnes;s0texrirpoydope  netl()a2uau  ;u0oltomocilt aDem(vo t4 rxrmo iadfmDe ivi s0t2urxrpiy1omte fes s)aruax pno0alxoiictat aDea(mp;t)trerio oo1oaD  ivs;s  rxo(r io4lltnlfvils) Dua(r ou1oltomo3iysfa2umn sn(4trenxo oadfaDeliesl()t2tmir oydlp n nvs s)s2uru p;u0optoif3iysfm ean s;(0alxrxfciatfpDrli o;s0setrxmpoydal n nei s  2tmxrpoo4alt  oetydfsDel(mpn(0tlermfciotlptr n s s) rtoir ou4om elfcs sfsrrmumono4oet mf3ilsfa2umu pn(4treriocoadlm   uvils) eurio nodam e feias)a2rm(mp;o0oetnif3ildfa2elnmo t)trxnir iadoaD lies;(0seuoxopoodaptemncsa() Duax poo4olen icilslsDrmu s;u4alerir3iy1fpDe ueo s t2xoim3oo4ll   fct () rraxm ot1open oetad m2elnmo t)aetnmo3iodop e uvs ()t2uriopny4alen ieilt aDtauroot1apto ieiadfs2ranmp;t)tleoircia1opteaiei t t2ur(m3nu1llt lnvtl(fsrraurpnu4tpeomf3ias s2uln p;u0alerxo3iy1lmtr n i t0 rurio ou4opt  fesltfaDrrum nu4altnifetlt sDeaumsn(4alxoif3iadomte uei;(0 rtmirpiy4lm nlfcta()aDururo;u1alt iietadlsDum(vo;()tlxrmf3oodlateaieo s)teurir oy1lp elfcia(  rtm(mpou0ale  f3ias s rlnmp;u4trtoxfcoytlmt  nes;(0sexmir ou4am emivilt sDrmumonu4opx ifctyd m rmn onu0 lermr oadlaD  u ilt0 ruoxo3nydll elivil( sDurum nu0tltnii3iltfmDrauvo;u0teermo3todopDelieslt srum(opou4am nmivia()s2ra(r ot1tlt  f3ilsla2rmnmo (0 leomocoydopt ln ilt srumxm oy1lmen ivsls sDtmum ;t1tpxnmi3tls s emnms;(4 rtrxf oytlmDr ueol(0 2trirpio4ap e neiatfaDtmxmpou4oex moeilsla2um(mp ()teeoir3tadlmteauvi;t0s2xrim3nodomtnlictl( sDuru pnu1olxnioctyt a eau o (4alenxr3oodfaDrluvs;t0tetm(r3no4optn fet (  rrrxmonu0tpxnmoeiyt aDuan onu) rtnio3ootlmtrln s;t s2xrxopio4om nmfvt ( sDrax o;t4apt mo3iyslm ran o;() renmrctotlat lnvi (0seuoxo ou1oltnlivta(f rua(mont1opxomfetldla emn snu4tlxnir todfaDelivil(0s2xr(r3iudll   fvs sfsrrruronu0tpx io3iat sDulnmsn(0 rermr oatlm   i sl(0 eurxm3oo4lm nliei sf Duau  nu4oetnmiciysls rlumo t4teeomr iytfmD an s;s t2xmir ou4ll nlfcta(  rtrxmo;o4oeeoif3tltfm2rmnvo;t0altrioctytlptr ues;t)t2toxr3iydlpe  netasf 2rmxroot0tlt  ieild m2ranvs u0 lerxfcoo1omt  uvi ()t2uo(r3iodlp nlfesasfs2trxmooo4ole iiciyt s2um(mp ()texrmrcta1oatr ivsl() 2uo(r3iodol e ics ()aDra(  ;u0aet  icilslm rlnmo u0trenmo io1omte uvo;s0seto(opiu1lle mivi sfaDtr( poo4tetoii3iysla umnvs;(0treoxf tatlmDe uvsls  exoxo3nu4amtn ici ( srrax  ou0aetnmietytls2raumpnt4trermr tatoptelueo s)setrir nu1ap nmieil() Dtr(  ot0openmiciyd m2um(ms;u0 eerxrciydom eau o;t  2uoxm io4oleemies (f 2ur( o;u1tpt iieiys s2emn s t)altnmf3oadfmt lu ilt)trxr(m io4alt  feils) rum(roou0apxn ictltlm2ranvonu)alxoxr ty1lptr u s;() ruoxm3iodlpe  ncils)arumxronu1texo ictyd s2emu p (4 eenif iatfa   ues;t t2toxr iu4olenmies s  rtmu  nt1altnii3iyt m rlnvp;u0aetrmr3oy1fmDrau i;s)t2toxo3iy4ome mictat) Duaxmo;u1opx miciasfm rlnmsn() rtnxr3oy1fm r nvs;()t2ur(opoydam nmivs t aDtm(  no1aexnmoeild aDuln s (4trtomo oodoaD lieilt texmimpoy4oltn iciat)srtrxmpno4oee io3ildfa2rauvp () ltnmociydom   uvi t  rurir iu1apt  fvs t s2trxmoou1opt ifeiytfa2elnmsnt4 lxrmr3ootfa r i ol(0seuoirpoy1lle  netasfs2rmu  no1aet  o3iydlm ea(vs;(4aexriocoatlpDrlu s;( sexoio no4ap   neilt  2rr(ro;t4aptnmietas sDuanmo u) rtomrciadlatrln i;s)setm(rpoy1apee fci t) 2urxr ot1alto ieiyd a uanvp;t4trtrircoatopD livo;s0texm(opnu4ame lfeil()arumurpou0oltnif3iatlmDrmumpnu4 lxoxocoatfpt  nei s trxrxm ny1lmt  iet tfs2umu  nu0tle mfctyt s rm( p u0altnir oodoa rluvsls0sexmiopiu1amtelneil(fa2rmx p;u0tetoioctltla eaumonu)areoioctatlm eaivil(  2uoirpoydop n ic
\ No newline at end of file
@@ -0,0 +1 @@
+n o;t)teum(m iy1alee nvt ()s2ur( pno0oltnifciysfs ul(vp t)aeenif todopteau ols0s2toir oo4opte fci s) 2rmx  ;u0aeeo f3iltfs elnmsn(0alxoxr ta1lptr ivs t) rumxm3oydom   nvsat)sDrmuro;o0aexnio3iytla2uanvp (4tleomr ootfpteanei;t0srto(opnu4al  mnvi ( arum(mpou1alx iietyslm em(mp;(4 eeoir oadlm  ai ols)texoim3iu4amtnmfvil( arta(ro;u4oleomfciasfsDem(vp u0 leoxrcia1fmt  nesls trxrir ou4lmt lnvias a2urur oo0aexoif3tadlsDelums;u0altnircia1fp  lu i;t setrxo io4lme lfesl( a2umumpou4tpxomfeiysfm ulnmsnt0tleomr3io1fm eaues t  2um(o iydlm  mieilt)arraxmo;u4oetnio3iysfm2elumo;(0 reomrctadfmDelnvslt trxoirpny1ale mivtl()arrmumpot1olxomi3ilsla2el( snt4 rxnifctydlpte u ils0s2xoxrpno4al nmnesls s2tm(r ot0oleomo3tls aDea( s;u)trtomf totlmDeaies s0 rxmiopoo4opeelncs t)aDrm( pnt1altnmf3iltfmDuanmsnt)arxnmf ootlmt an ols0 eurim oydlptemncta(fa2raxrpnt1aptn ociyd s elnvp;u) rtomrcoy1fptr ivo;t)trxoxr3oodomeelfvi ( sDua(ronu1opxoifetaslaDuanvs;t4aetoir3oa1lat li s;(  eumir no4alt mnvi (f Dtr(mpnt1apx if3ilslmDrmuvo (0 eenir ia1oaD  ivol(  ruoxo3oy1lmenmfeil() 2tmu o;o1texnii3ilt m em(vo;u)alxoio oydomDr nvo t0srtmxrpny1lpt mfvsls)arumxroou1apt  fetlt s rl(vp;t)tlermociy1fm   uvs;t0 rxrxrpio1alt mfcsatf 2umxmpno0olx  i3ildfa rl(vs (4tlxrifcootlpte ies s0 2uoiopio4amtnmfetat)aDumx pou0tpeoifeiltla rl(vs;u) rxrmo3ootopDr nvs;s0 rtmxmpiydom  mfcsas)sDua(m nu0aeto ocilslaDelnvo;()altnxo3totlatrlieo s) 2ur(m iudoltelnvtatfa2trx pou1apenmf3iad mDranvs u) rtrifcty1optrai o;s0trur(rpny1omt miesls)a2trumo;u1oeen octytfs rl( o;u0aeeomf3tatlatrlu s s0setoxrpny4alt lnvia(faDrm(root1tlenioeiyd a el(vsn(0 rtnmo ootopDrauei t  2uoir io1altelivt (fs2rrurp;o4opxnmieiyt aDra(von(0aleoiociy1fa r uvi;() 2tmio3ou4op nlnvtas) 2tmx p;o1oex  oeilslaDuauvpnt)arxnif iy1om rauvsl(0 exoxo3iudop elics tfaDtmxrp;u1tlen ieilsla2el(von(0tetrxr3oadlaDraneils)s2trio iu1lm nlfei sfs2ur(moou1ole mocildlsDran o;u4 lxomr oadfpteluvsl()trurim3oo1ll  mnctasf rtrum ;t1oex ioeiasfsDrlnvs;t4areomf3oadlpt  neo t setr(opio4optn fcil(fsrrm(mpot4tptnio3tlsls2uau p t) rxrir3iodomD  ues (0 2urxr iydllt  ietltfs2rm( pnu1aexoii3iasfm2uaumo t)aeerioctatlpte i i;s)srtmxr iu4lpenlieias  Dtr(m nt0tpt iieild aDul(vpn()tleoxr ty1oate n o;(0 etrxr3oo4omt mietl() rumurpnt0oet  ictatfs2eaums u4aexnxrcta1fa r ieslt texr(m iu4omtelneias)s2uau  ;o1tpe  ictasls rmnvsn(4aetoxf3oy1om rlieol(0sexmim oodopt mfeil(fs2tau poo4texo oetatlaDra(vo;(0artrifcto1fpDrai o s)srxrimpio4al  mietasfarrru  nu4oexn iciytfaDua( s (4arxomfctadoateauvi;s) exr(opnydalte ietasfsDtrum ;o4olxnmi3tas m um(vo u)arxoxf iytfaDeaivs ()sexo(r3iudolee netl(  2um(r ;o1oee iieiadlm2uanvp t)aeenio io1fateln s (0 eur(r ny4ale mivi s)aDumumo;t1texomf3iltlaDem(ms (0aexrxr3oodomt  ieolt  2umir iodoltn ivtlsf rtrx  ot4texn f3taslm2rlnmpnt)tlxoifciotlpDr uvo;t)t2urxr oo4lpt lfviat  rumu pou0oexn oeiadfa2ua(mp u0aexrmf tatoa elueo;s tetrim3ny1lmenmivs tf 2tr(root1opxomfetltla2uau sn(0 eenmr iodop e u ol() etmio3oudlptnmfetls  rtm(  ;u4aet mfciasfm2ulnmo;u4texrxo3todopt auvil(0 2xrxr3nodapeelies ()s2ua(  ;t4tpenioeiltfsDrau o;(0 rtrifciy1faDeai slt teurirpnu4lp  lfcsa(f 2ta(mp;t0tet miciaslsDulnms t) leoxf3totfm rlu il() rxmxo oodaptnmnciasfarrm( pou4apxo fetatfm rmuvonu4artnxr3ty1lmDranvo;( t2xmxr3nodapt mncsl(f 2rrump;t0tle mf3iysls rln s t0 etnmociy1lpDeln il(0s2uoim3no4lpee netls)sDtmur ot4oeeoiiciaslaDuaumonu0aeeoioctytfp eluvi s0sexm(r iudamte ncs ()arur(mo;t4tee ioeiadfa rl(msnt)trtoxf3iatopteau s;s0setm(rpoo1ape mics s artaur oo4tpxoifeiatlmDemu onu4aexrmf oa1omt lnesl(0srxoir3iy1omtnlnesls sDtr(mpoo0tle iietat a umn s u0artrio3oydlmtelnvsl() rxrim nu1am nlicils  Dtrxm nu1aptnmieiasfa rmnms;(4 ltnxr3oytlmt anesl(  rxr(rpiy4opee fcsls)a2trurpoo1oeen oeiad mDemumonu0aleoiocio1oat  ivs;t) rtr(r3oodam n nctat)a2tmxro;u0oltnifeiysfm ean snu4teenirctytoa   neol( teto(m3ny4openmneil() Drau onu4oexnmi3ildfa2emuvs t0tetrmr3oydlmDr ivi t seurir no4lme  nci () 2ua(rpnu0teeoifciytfaDrm( pn(4trxnif tatopDelu s s)srtr(m iodlme micias aDur(rooo1tex mf3iysfaDemump (4tetnio iodfatr ivi;(0sexmim3oo1alt mivtasfarrr(mpno0oexoiieiaslm2ea(mp u0alenxf3ootlmDeaiesls)t2xoirpnodlm  mfvi ()aDum( pno0aleo fctyd s umuvsnu4artrircoatlm eau s s  2xoxo ny1lpen fciat aDumxmpoo0ale  o3iytla rmnvon(4areomf3iy1lm e nvo;s sexm(rpoo4amenlfesl(f rtm(r no0opeomfctld a uluvp t4tlxrxf todopDelieilt t2tmim oudoltnliesat)artmu oou0aeen f3iydfa2ra( o u)aeenxf ta1fpD lueil( tetrir3oy4ale lfes t) 2ur(r ;o1altn f3tat a um(vo;u4tetnxf3iytfpteanvs;t srum(r nudlptemfcslt)s2taxmonu0tee mieiat m ran pnu0alerxf iy1lp rlnvs;(0 rumxm3ny1aptnlfetasf 2ta(moot1alx  ictasfs em(ms u0aleomrcia1fa eluvi;t0 rumxmpiodomeelivsl() 2uaxr ;t4tltn fctydfsDuln s;(4arerxf ty1fm rluvsl( s2tr(o iodlpt  ies tfarrau pot1ope ioeias m rauvs (4trxrmf3ty1oaDeau i;s)srurxo3nodlp elfvta(fs2rruroot4oetoifciadfm2ua(vpnu4trtnif3ia1laD lu il(0seto(r iu4aptnmivtls) 2trur oo4alx  o3tas mDumn o;u)trtomfciatlm   uei s)trtoxm oodomtnmict t a2urxro;o0ope mo3iat aDulumo;()tetoxf3iytfa raivo;s srtm(o3oudal emictat)sDrrx ono0aleoifeiatfmDrln pnu4arenxf oodop  li o;s trtoxm iu4olenmfvt t)srraumpnu1tlenio3tasfa emn o;u0aeeomrciydfaD lieol()sexoir3io1omee feias srum(  ;o4apxoif3iyd sDeaums;t0alxriociy1fm raivi;(0seto(r ny1amenlivilsfartaxmont0olxoiociatla em(vo;t4aetnmr tytom  auei;s)s2tr(rpny4al nmies (faDrax  ;u4oet  f3tyslm2ul(mont0texoxfctytfmD  nvi t0t2xm(rpio4omtelnctl(fa2rrx  ou0aptnif3iadfa2raump;u)tltnirctatlpt lies s) rtr(m oo4optnmfeias) Drmx  ou4opx ii3tlsfa2rmums;u0aetoir3oo1fmt lies (  rtm(o3oo1ap eliet t a2trumo;o4tpeo oetatlm eluvsnu) rxrmo3totoatran s (0setmxo no4openlfvias  2ra(rpou0oltnif3ild a2eaump u0teerif tatopDrlnes;s s2tr(r nu4oltelfci sfsruau  ;u1olxnmicilt aDrln o u4 eeoif iytomt  ieo;(  2uoio ou4ap e ivs (f Drmxrpoo1optnmf3iytlm2elnvs t0tetrmo iydomDrln sl(0 rum(mpoy4lpee nctls arrmxr ;u1tpe ioetas sDem( o u4aetnxo3io1omtrauei (0 rumxo iydol  lictas srumxroou4tpeo fciyd a2umn s u) exnmo ia1la raieil(0s2umxopoo1llee fes ()sDuaumont1aetnmi3iad m rl(vpnu)teeoif tydlaD  ivi ()truoxm3iodaltn feils  rtmum oo1tlxnmictldfa uanmsn() exomo3io1opDelnes;() eum(m3io4oltnlfeiat sDrmx pnt1opxnifetlsla uanmp;()aeeomo3oytoptr ues ( setrxm io4llt  fcsa(  Dua(rp;t4tpxnmf3tatfa2elnmo t0alxoifcoa1faDraueil(  etm(o nydole lfvtlt)s2tm(r ;t4opx mociytfsDrauvo ()teeoircoo1fp r ivs t0s2toiopoy4omeelfvi s)srtaxmp;u1tpxnmoeiadfsDemu p;t4tltrxo3tatopD auvils)tetmxm3oo4ap emfvsls  Durxronu1aexo oeiadlaDulumpn()arermo oydlatraivo s0setrxm3oy1olee ies t)sDraurpoo1tlxomf3ildfs ea(ms;(0tltrio tytoa r ivi s t2umiopnudal e ies (f 2tax pot1ope  ieiytfa2ea( p t0tltnio3to1la r neo t t2urxopnu1optnliei (  rurxm oo4tptnmicildfm raumpnu0 eeoxf tatlmtr ivil()trxmxr3nydlp  mfvs s sDrrxrono1tpenmi3ildlmDumums t) etnmocootfat lieols)t2tr(r nydomt  neils sDumxm ;t0oleomoctysfs2uauvo;u0aexnio3ia1fp e u i (0 ruoir iy4lpe mici tfa2rrxmooo4apeo f3iysla ua(mp;t0 leriocoy1omD  neo () rtrxmpoy1alee nci s sDrmx  ;o1tpxnif3iyslm2elu pn()tlenxfcoadlpDeaueols  eto(o3iudlpeelnei (  Drmxrooo1tle mf3tlt sDemnmpn() etnxf oatoaDean slt)t2uoimpoo4olenmnct s)sDrmx oot0optn feiytlaDem(monu)trxrir3ta1fmD luvs;s0 eto(o nu1opt mnes t)s2tru o;o4oexnmi3iatls2em(vp;u4tlenif tydfa elnvo;() 2xmirpiy4apte icias) 2rrxr nt0ale  icils m2eluvs;t)trxrmoctodlpDeauvi;( trurirpiu4amtnlnvilsfaDta( poo4oeenif3ildfs ran s t)arxrxr totop eaneo;t0t2tmio3ny1lle  fes s)arrr(mo;u0tpxnmiciltla emn p;t0tleoxrciotlat an s s) 2trxo io1apt  fciasf Dta(m nt1tleomfeildlsDraumpnu)trxnmocoytomDe i s t) euo(r nu4lle mivs s) rrax oou0tlt mfctld s umuvsnu4alxoxr3oo1laDean i;( trumxr oodol nmfesls srumurpnt1aee  feiydfm2raumsnu0 rxnxfciadfm eaivs () euoimpoodlmee fviat  2raxrpoo0apeomociysla eauvs u0alxomrcoadfpte nvsl()texrxo3nu1amte ivias) rraxrpot0ape  fciatfa ulumo;()tlxnmocootlaDeaivo;(0seum(m3io4olenmieilt) 2rmxrono1tptnmi3tldlm emump u)aetrxo oydlpDe nvs (0srurio oodap elnesa( s2ur(m oo4oltn iciatlaDua( ont4arxoio3iydopDean i t)setr(mpoodllte ivs ( s2ra(mooo4aet mictatlsDelnvp;u4aexoio3oa1oa eln sl(0teum(o ou4amtemfvsl()aDuaxrpnu1altoiocildlaDrmu s (4 lxnmo3oo1om raivo ( trtoio oo4lle mivs s srtax oou1tex iiciytlm el( o;(4 rtnxf oy1lmDeauvi t  ruo(o iu4lmtelncs (faDumu ono0apeo feias s uln o t0 lxoxf io1fa r i i;( trurxm3oy1lm n net ( a2tm(mpoo0tpenmo3iyt m2ranvpnu0trxnirciytfaD  ivs s0 ruo(rpiydomen icslsf 2tr(mp;u1oee miciysls2rau pnu4tlerxo3oo1oaDeauvo ()s2tmxmpoy4al   ietatfsrrau  ;u4tpeo i3tydfs ulu s ()trxrmf totoaD  n i;s  exrirpny4omeemivs () rtm(r nt4apen oetldfm el(vsnu) exoio3ia1op raieslt0 etr(o3no1alt  fvt sfaruau oou1opt mieiydfs2ua( p;u)texnmr3oy1lptranvols) etoiopny4alenmivt s aruax p;u1olxo o3iatfa ulnmon() rxnxr oodomDe nei;t0 exoxr iodolt  nes s artrumpoo1oetoioeiat mDumuvp ()arxomf3iodop  auvs s) 2uoiopio4llt  ivi (fa2ta(  no4apenifeildfm uau snt0tlerirctydoa eli ol( texmxmpou4oltn fvtlt  2rm(  oo4tpe mfeiyslm ranvsn(4 rtoircty1omtr uvo;()teumxmpoy1omenlfcs t)a2rrxm no1tptn ictadlaDrau onu) eenmfcoatfmDe ieo;()setmio3iy1lm elicsa(  rrrx  ;t4oltn ociys m ranmo t)aetrxfcta1fmt  nei (  exoim3nodomtemnvs s) 2tmumooo1ope  fctas m2emnmp (0aeenmo3ty1oaDe i s;( seuo(r3oudlpe mivtas  2ururono0tex  f3ildlm2el(mpnu)arxrmrciatlmD aivo t)s2xo(o nu4ll  lnctlsfaDrr( poo0alx mi3iydfm2ulnvp;()aetrmo ty1lm   ivi;()texo(o3iu1alenlnetltf rtrxrpno1optn fetlsls2uanvpnu4aexnio oy1omD  uvo;s s2um(mpoydalt  neslt) 2urxr ot4alx mictys mDuan s t0trtoifctadfp e u o s0seto(m3oy4ap  lieils)arum( ono1aee mf3iad m2elumsn(0tlxrmoctatfp elues;()t2umirpnodlpee nvsat sDtr(  no1olt  fcilsla rau o (0trerif3iadfpt livi;t)truoim3iudlpeelieia() Drr( pot0aexn iciyt m2uln p t) renxo iytlmt aneo;s0 rxr(opny4lm emncs t  2trxm nu4apxn f3tatfmDem(msnt0 rtoxr3oa1oa rlivols) etr(o io1lm e netlt)sruaurooo4tptnmfciysla2rlu o (0 leomfctotfateaiei;t) exo(m3iodoptemfvtls)arta(  nt1texnmfciysfs rm(von() lxomf3iotlatrlivs t) rxrirpno4am emics tfarumxmpou0ole mo3tydlsDranvs t)tltrio3ia1omDrln ol()t2tmxo3oodll  liesls s2rmur ;u0tex mfeilslmDran sn(4alxoio iotomDeau o t t2urio nydamenmivt ()aDtmxm ou4tpxo feiltls2eln pnt4aexoiocoytop elu i s0 etmio nodoptelfvs t)srrru p;o1oleoifciltfs rauvo;(4 lerio3oy1optr n s ( s2trxr iy1ll emictltfarrruro;u4tpx  f3tatls uluvp (4 renifcootoptrln i ( s2urio ny1lmenlnesa(fa2urxr oo0oleomo3ildfm rmu o u4 exnio oa1fm  auvi ()trto(r iy1altn icia(  Dtr(  ;o0alenio3iytfs eanvon()arenxf3io1lm rau ol(0srto(m3oy1lm   ncsl()srrmump;o0oetoio3tat s2rmnvpnu4 lxrxr oy1la   n ols0texoio ny4lm   nct tfa2rr(mo;t4tpe mf3iysfm rlnvs (0 etrxr iytomDeaivi;(0t2tmxm iudame  fesa()aDra(r nu0alx mf3ildfaDra( pnt0 lxnxrcoadfptelnvsl(0t2tmxrpio1op emieiatfs2trum ;t0tpxniociydfmDrm(von(4 eerxr io1lmDelivi;t) euoir3ny1aptn ncs sf Dtmxmpou4tpeoio3iat aDem(vont4aetnmfciy1latrlieo;s0 eumxr ou4lp  mivslt aDrru ono0altomiciadlsDrm( on() rtoir tatfaDe i s (0texmio3iu1ope mfviatfsrumxrono1alt mi3ils m2ua(msn(4arerif iydlm rlnesls srtmimpnydom  lnei sfs2rrx  nu0altoif3iatfaDel(mp;()aeerxf ty1oaDr ivi t)teumxopoo4lp elnvils srtaxmo;o4aleoiiciatfm emums;u)areomf3iadoatr n o (  etoio3nodapt lieias  2ra(m nu0apxnmi3tlsfsDemnvo (0 ltrif tadlp eaieilt0 2urxr3no4lptn fcia() 2ra(  ;t1olt  fciltfs emumonu4 etnxr3oydlpD  nvo t setoxrpio1lmte ici () Drm(r oo4opxoiictltlaDrm(vp ()tlxrmr3oo1lmD anvol(0trxmim3ny4llt lfctl(fsrtmx p;t0tpxn feiltfaDuln o;()aexomrciotfm  aivils seurim3no1lptn netltf Dta(rp;o0ape  ieils a2umn pn(0 lerif iy1lpt  u ils0 etoxmpiodlm  mnetlsfs2uaxm nu0ape  oeiydla ua( ont0aexomrcoy1omt lu ilt)srxr(r3iydoleemnvt sf 2urum nt1aetomi3iadfs uaumo;(4 lxnmocoadop raues;t  2tr(mpio4ame lneiat srurx p;t0ape miciydls rln p (4trermr3to1fm  aieo;s0 rxmiopnydapt lnvi (fa2tax p;t4apt mo3iat m2umump;()trtnio io1omtran o;s0seurir3iy4alt  fctltf Duaxm ;u1texoif3ilt m elnvs u0alxrxo3oo1late n i;( s2ur(r nudalt  fet (faDraxrpnu1tetoioeiadlm2ea(vp u)alerircia1oateln i;t0seurio3iu4apt  ici t) rtru  ;u4tlxnmoeiytla ul(ms;u4aexrio tydop  ln o;t)s2xmxo3oo4ol  mivi ( a2umur ou1ale mo3tls sDum(mp t4texrir ootfat aieil(0trto(rpiy1alenmiei () Dtaumpot0apto octad mDrmnmp () renxfciodfm e uvsls trtrimpoy4olenmfct tfaruau ont0opxo oeiad s2rlnmo u4 rtoir3oodoaD luvo;() exoir nu1al emicsa(faDtmumpnt4alto ieiys m eanmo ()texrmf3oy1lmDe ieo;s)trxr(m3oo4openlfeslsfs2ta(ro;t4oetomi3ias s uanvo u4aexnmr tytomt aneo;s0seuoxopoy4om e ivtl()sDtmurp;u0tltnmf3ias m2ranmp t)tltrxrctytom eliei;t0 exoirpoudomenlietls)sDraxr ;o0teeomieiadfm2eanvs ()arenifcootfpt aneo;t t2xo(m oudlmen nvsa(  Duru  ;u0tpe mietlt m eauvs;t4arxrmocto1fpD anei;t)setrxo oo4amenmfcsl( sruaxmpnt1olxoioetyt a eluvo
\ No newline at end of file
@@ -0,0 +1 @@
+neols)t2uoim iu1oleelivsl(f Drmxrp;u0ale  feiytlaDranmo u) eeniocia1fp rlieolt)srtmim nu4olt lnvsa()aDumumpno4tpx ifetytfa2em(mp t0areoxo oatopD au ol( s2xoir3iy1om elivsls  rtrxmonu1ole  iciys mDelu s;u) ltnxr oatlpD lues;t)trxrxo ou4amtnlncsa() Drrxro;u4opeo i3tlsfaDea(vp ()tetoif3oatlpD  ivilt0 2uoir nodop nmivs t) 2raum ot1oexo oeilslm2raumpn(4tetomociytfa  ai olt0 rumxo3nu4lpenmicta(fa2rau  ;t0openii3iasfmDea(ms;t) rtoio3iatoat lueil()s2umiopiydomen fetltf Drr(mo;u0opxnmociyd s2uauvs (0trxriocoodom  lu s;s truo(m3nu4optelfeils  2uauro;o0aee iiciyslaDrauvpnu)tetnxf tydoaD an il(0 eum(mpnu4aleemfetl( s2rmumpnu1apeo octas a2el(vonu0artnxfctytlatelneol() 2tmxm iodlmen fesasf Durump;o4aeenmo3tydla rm( s;(0alenmo iodlptelues s)trurxr iydamt  icils)sDuau  oo1aeen iciad sDeauvsnu0 lenir3io1om eluvsl()t2urxrpnodom elivsasfarrm( pot4texo fciasfm ran o (4 exoxociotom   uesls  2xoxo iudlmte neiatfartm( p;u4tpt ioctatlm2rau p;(4tltomo oo1optr n olt)texr(o iydll  mneta()aDtmxr ;o1opxnmietadls rm( p;t4tetoio3oy1fm elu slt0seto(rpiydlp nmics (f rumx onu4aptnioctaslsDul(vo ()tetrmfcoodop raieils) rxoxo nydomenmfvt s) rrmumono1apxnmfciat a2umn snu4alxoxo3to1fat  u o t0 2uoxmpiy1lme  net t sDrrxrpou4tltoif3ilsfa2rauvont0 rtnxocia1lmDe uvo;() eur(rpnudapen ieil(f Duax o;t0oeeo o3iys a uanms u0 rtnxo3oadlate ivs ( t2xoxr3oo4olt mnesa()aDraumo;u0apxnif3ildla rl(mpn(4 etomo3oadopte iei;s0setmio3ou4ole licsl( s2rm(  nu1oetnmo3tytfm2eau pn(0arxrmo3iydfmtrluvs s) eto(m3ou4omee netas) rtrxmpnt4oltomfeils s2um(vo t4trerxo oadfpDelnvi s0teumimpoy1olee ieiasf 2ua( o;o4apt  ieilt a rlu p;u4trenifciadfmte ues t0srtrxm oy1op n ivtas aDuax  ;t0aex  fcildfmDeanms;u) exnmo oodlat ln i s sexrir nodamtelics t s2ur( pnt1apenioeias mDemnvs u)artnifcoodoaD luvsls)trumxopoo4opeemncias  Duaurooo1oexo i3iadlmDulnvs (0aexrio oytop   ueolt sruoxmpoy4altelnetat) rrrxrp;u1apt ifeias s uluvo ()tlermfcootlpD  i ilt0 2urxopoodameemfctlt)aDur(ro;t1aeeo o3ias mDuaumpn()tleoxrctydopte nei s0trtr(o3ou4omtnmnvilt) 2urur nt1altn ociltfa elumpn(4aexrmfciotfm  luvsl(0s2urxo nydlltemivs tfs2umu  ;u0altnio3tls s2uanmo u0 eenio iodoptr ivs;s) 2umxm nu4lme lfetasf rtrurpno1ole  i3tldfm2emu snt0aeermr ia1opt an olt t2ur(o3oudomtelncsat s2rmum ;t0tpxnmieiysfm em(vo;()trerxr3iytfp eai ol(0 2to(o iodamtemfesa()a2trumono0ape ifeiasfa2elnvs t4altomociadlaDraivilt)sexm(o3iydlm elncils) 2umxmpot4optoio3iadlm emn p ()teeoif iy1omDr uei t) etrxrpnudlm  mnesa( aDua( ooo4apen o3tad aDrl(mpnu)teerir oa1omteaueo s) etoimpoydop  mfctat a2uaum no4tpt io3tld sDrl(vpnu4altrxf3io1fa  liei (0srtrxo3oy4ope mietltfarur(mpoo0apeo ieiltfa2em(mo u)trermrciadfp r iesl() rur(mpoydll emfes t s2ur(m no0oetnmi3tldla2elnvp (4tlenir3io1oa  aueils0truoxo nodap emneiat)s2trx p;t4alxn o3ils a emn p (0 etrmrctodom  an slt  2umxopnydllte ivt sfsDrrumpnu1tlxoioctat m2emn pn(4 ltrmrcta1omtranvils t2xmxrpno4lp nmfeilsfaDta(rpou0aet mo3iysla um( s;u4 rxoxo ty1oat  n ols texr(r nodllt mfet s) Dtr(m ou0tpx  ociadls rmnvpnt4tltoifcta1la r uvo (0 2um(rpoo1ll   fvilt a2tm(moot0alto octaslm2rauvp t0alxoxf3oy1lat auvo t) eumiopiodom nmnvia(  rraur ;o4olt ifeildfs2ul( snt)aeeoxf ta1fmtran s s) euo(m nu4oltemncsl( arurumpno1texo iciydfm2el( sn(4tetrircoodfpt aivi;(  rtoimpny1ole  ivsls)srtr( o;o1tle moctls m rmums u4teenif3oadomDr ueolt  2toxmpiydoptn nctl(fsDta(mp;t0aee mi3tasfsDemn p t0aetnmfcoydfm eln s;t t2uo(o3iydlmtemnct t)arurx  nu1apxniociyslsDeln p t4alxnio3oy1opDr ivo;t0setr(m oy4apee fcslt)sDra(r ot4ole  o3iysla umnvo t4aeenirciytfmDe i o t0trtoxmpiy4ame lncsls  rumu onu4optomi3tysls2ul( pnu0aeeoir oy1fatrau slt0 2xo(m oydomt  fcsl(  rtr(mono4tetnmf3iat m2emuvo u4 exrxrcoadfa eaivi s) rxoxopoudlpt  fcilt) 2rmx pno1tlen oeiadlm eanmsnu4arxomf3tadlat  n sls seto(m3iu1oltemnvs t sDrau p;u0aeenmfetytla2rln onu) rerio3ootfpt  i ols s2um(r3iydlme mfvtat  Dtrx  ou1apxnio3iadlm2ranvo;(0 eenif3tydoptrli il(0 exo(o iy1lp   net s  rtmx o;u4aleoif3tytfm2eln s;u0 ltrmr oy1opDran i;t0trtrxr3io1ome micsl(fs2tm(ront4apxomietls s2ul( p;t0 exomo tytlm r ies t)truoxm nu4lm nmfcsl(faDraumont4openii3ildlmDemnvont4 rtomfciydlp elnei;(0sruoirpio4aleemnvs tfaDrax oou1tptn feildls2eln o u4 lxnxocoodlpt auvsls s2xoxm3iu4om  lnci sfaDumx ooo1tetnmfctys mDeauvo;(0 etrxfcoatopDrauvo s srtoiopiy4alt  fvils) rtm(  ;u1aexnif3iydfsDua(ms u)tlxoifctydlaDelieo;t  rtoimpno4ap nlncsatfsDrmx  ;u0aeeomociatla eauvs;(0texoxf3oa1opDrln s;t  2trxo nu4lme mics (fsrurxrp;u0aet  ieiytfs2ulnms;t0 rxnmr3oydlp r uvs;()tetmxr nu4lp   fviatfsrrax  ;o1oltomfeiysfa2umu s;()arxoif3tydomt livolt0tetoim3nu4altemnvt tfaDtaxmp;o4apx ioctlt mDrln s u0tetnxrcoo1lpte i s;s sexo(r3iy1ape  fet t) 2rrxm ot4aeenmfciasla ran snu4aetnxr3todfmDr ivi;s)trto(o3io1optnmfet t arumxmpno4olenii3ils sDuanvpn(4 ltrmo3oo1fmtrln i () rurxm3iy1lm elncias)srumum ;t0tlxomociadla2elnms;u) renmo3oodoaD ai ols) exoxm iodlp  lneil()a2rrum nt1aexnii3ilsfsDelumsnt)alerxf3iytfp raues () 2trimpiy4lmtnmfes ( sDtax pot1olxnifciyslmDemumonu0alenxr3oo1fpteluvo s)srumimpnodllt  icsls) 2ur( pou1optnmicildls2rl(vo u0tetnxo3iytop e nvslt)srxrim3io4ape  fei (fs2uax o;o0apxnmociytfs umnmp ()teenxr3io1la rlu o;t0t2trio3ou1lpte neta(f rrmx poo4alt ifcilt mDeanmonu4 eerirciotfmt  u ols)s2um(rpnydlm emnes (fsrrau p;o0aexn f3iytfa rl( s;()altoiocio1lptr i ils) etmir3no4lptemictat)aDtaxmp;t0apto i3iasfs raumpnu0 lxnxr3iadopt aies (  exmirpiydom  mnvslt) 2taxroot0tet  iciadls2uau p t0aexrxo3ty1fpt liei;( s2xm(r no4amtn nesa( sDur(r ot1olt  fciat s emnvs;u)trxoir iatlp r uvi;t t2to(m iu4llt lnvil() rumxm ;u0tpeoiociysls2rln p ()alxrif3iytlaDelu o;s0teur(o3ny4lpt licsat  Dtaurono4apen i3iadfaDrm( o;t0altoxo tadoptr i ilt0setmxrpiy4ape  icsls)sDrrxmp;t0aptnmictas s2rln s;(0 eermrcoa1op   ueo;t0 2xo(m3oo4llee fet s) 2raxrono0opxn ociydls ra(mon(0 ltoxr ia1fatelnvs t)trxo(mpoo1ll  lfeia(f 2raum ;u0ale mi3tat a2emuvo;t4aexnxo tydopteln s s)seurxm no1amtnmnvsl(  2taum ;o0aeeniiciydls2uau s t)aetnircoy1omDrlueo;s0s2umimpiydlptelfvs () Durumpou1apto oeiysfmDrmn o;(4 rtnif3oydlmtrlnvilt)t2tr(rpiu1opt mncslt sDtmxroou0tpeomo3iltfs uln o u4teeoio3iatom rluvi;s teuoim ou4lpeelfcsl(fa2rrxmoot4tltomfctadlaDem(vo t)artomr3oo1lm ranvi;(  etmxmpny4opeemictl()s2ururo;o1tetomiciasfsDua(mo u)altnxo3to1fa eai o;t0texm(mpiu4lp nliciat) Dta( p;u1optn iciytla2uaums (4 lxoir oo1faDe ivo;( srxr(o3iydoptemfvi ()arta( onu4opt if3tydlaDum(msn(4teenmocta1fatean i s)setmir oo4ole lfes s s2ururpoo1opxoio3tls m2um( on()tlerxo iotfmD  uvo s)t2xrio io1alt livsa(  2raxmo;t1tltnmf3tadlsDelumsn(0arenmr iy1la   u i;s) 2umim nudal emies s)artaxrpoo0alxnmoeiys a2rluvo;()texnmo ta1fmDeai i t s2umxm oodll nmfetltf rua(r oo4ole mi3iysfsDrln p u)aeerxf3todfp  lu ilt srtmir oudlmtnlfeilt) 2urxro;t1tpenmo3tadfm2uln s t0arxnxo3tydlateai o;t  2trxr3iudop nlfvsl()aDrmuroot4oee ioctadla2emu s u0 ltoxr3to1lmD aieol() etmxr3nu1omtnmfvtatfsrrr(m ou0altnii3iltfmDulnvo t4tlxoxf3tydfa eanvi () eur(o3ny4lmenlneslsf rrrxronu1alen ocildlm2ul( o u0 ltomo ootomDran i ()texo(opno1apt lncslsf 2raum ;o4aet mociydlmDea(mo u4 eerxocta1opD  i ils)srxr(o3oy1lpen netl()aDumu p;t0tleomi3ias s eln sn(0 ltoxr3ty1oa elues;t0 ruoxr ou4lpte nvtat)s2taxm oo1alx mfetadfs2ulump u0tlxoio3ty1oaDrlies (0 ruoxo3oy1amee nvsasfsDra(  ;o0tlt  ieiytlm rl(mp u4trtrxocoatfmDrai ilt0t2xm(m ou4lm emncs sfs2raurono0oexo o3tysfaDeaumsnt) lxnif todoaDe ieilt0sexmxm3oo1omenlnctls)sDrrx  no1oeen feiysla rmnmpnu) exnmrcoatlpt anvs;s) rum(r3iodlmtnlncias) Dur(ronu4ope ii3tlsls2ulums t0altnmo ootfa  lueo s sruo(m nu4om   feias)aruax  ;o0apenmiciatfm2umu p (0trtrmf3tatop  luei t0s2urxo ny1altelicta(fs2taumo;u1aetoiieiydlmDuanmo;u4 etomr3iytoa elneo;t  rxm(o3oy4lme mfet s)arua(mont1oexomo3tasla2eauvo;u0trtomf3iotfp r ivols0 2uoimpnodlle lneils)aDra( p;u4tlt iociys aDea(vo;(0trenxf tydlm eanvs;s0 exmxrpiu1lpeemnvils arum( onu1ape  feildfaDul(mp u4aetomf3iadlpte u slt) etoirpou4alt  iciatf Dtrum nu4tlxnioeiatlsDrl(mon(4trtnifcoodlmtrli sl()sruo(mpiu4om  lneils  rtru oot4alenmieiyd sDrmu o () rxrmoctadomt aies;t0 exr(mpoy1lm nmnes (f rrr( oou4ope ifetlsla emn ont0alxrmo todfmD  nvi;t)t2tr(opio1lp  mfesa(f Duaxmpnt4tleoifetadlm2ua(mo u) eermf3tydlm eaivo ( tetoxo iudape mfetas aDrru oot0texoif3iysls em(mo;t)aeermf iadfat  uvs s0t2tr(rpiodll nlfet sfaDrmu pnt0tpxo o3iadfmDra( s;(4arxrif3iatlaDranvo s  exrimpou1ame  fei t)a2rax pnt4tlenmo3ildfsDumump t0 rxnmr3ootlate ieil(0 rxoxmpiudll emfetasfsrrmum ;o4alxoiociasfm rlnmo t0aetrxo3io1fp   nvo;s0truo(opio4am nmivi sfarrmxm ;u1oltnmo3tlsfaDemuvonu4 rtnxf oodlmDeaivsls)t2urxmpiu4al nlictlsfa2rm(r ot0tleomoeiyd s um(vp;u0 ltnir oydfptraues t) rtrxr3ou4amt  fcsas  Duax  oo1tlxomociltfmDelnmp;t0 lxomf3iodlate nvi s trumxo3iy4amenmfci sf Dumurp;t1oee mo3tyt m2rlu o;t0altrxrcoydlateau o s)trtoirpou1ap   nvtat)srur(m oo4apeomoetasfa2ua( s;()areomo3totop eli sls) 2uoim3nu4alenmnvia(f rtm(mpou4oeeomi3tysla ea( ont0teeoircoydoat  i s s) eumxr iydopt  fvsa(fsrtaxmpoo1tpen i3ildlm2ra(vpn(0arxrxf3oytfa elnvils0tetoiopoo1lmtnmietlt artmxmp;t1oeeo oeiasla rmnvonu4 rerio iy1fmDe n s;t)t2tmxrpiydome mfeiat) 2rmumpou1oeto ictltlm2rmnvs t0aeeoxo3todfaDeauvi;s0s2uo(o oudam  lnciatf 2tm(  ot1ope  i3tas m uaumo;t4arxnxoctatoa eaiei (0teurxrpny4apt miciatfsDumxmo;o4tlenioeiytlm2eanvs;u4 lermr iodom rauvo;(0srurxr nydame  netat  rta(  no4tlt ifeiat m2emn snt0altnxr3iotfmD  i slt  2uoio3oy1amte feia(fsrrmxrp;u0texoioctysls elu on(0trxnxr ia1oatrlueils)texr(mpnodamtnmnvtls artm(rpou0tee iieildfaDemn snu) ltnmr tatfpD lu ol(0srxm(r3iudomtn net tfa2rmurpou0olxniiciytlaDum(vonu)areoirciadoatr i i (0s2uo(r oy4amtnmncil( arumxm nt4tetomfcild m ea(vsnu0 rxrio3to1lpte nvi t)trtr(m iudale mfvtlsf Dumxmoou1tlxnif3iadla rl(ms u0 etnxrctodom e nvolt0 2tm(opny4lpen fcs t  rurumpoo4alxnii3iatla2rlnvo u0aexoxociy1fpD lu s s) ruoxrpnudapenmnetat  2umxroou0tpe  oeiltlm2eauvp;(4tetoxo3to1laDrlueo;s) rur(m3nudlpt lfcsat)artru  ;o4tpxnmo3tltlsDrm(mpnu4texoxf io1omDe neilt sexrxo iy4optnmnvtlt  2ua(  ;o4tetnifeiydlm rmu o;(0areoxr oa1lpDeaueol( s2xoim iu4om elivsat  Dua(mo;u1tpxoio3iysfm rm(vo t4aexnif oo1omDr iei (  ruoxr nu4om  mneias  ruru oot4apt ifeiad s em(msnt)tlxoxo iytopDe uvol( tetrir io4lmenlicsls) Drmxmp;t0aptnmieils m2rmnvs t4alenir oytfmDe nvi t0t2trirpnu4oleelnctltfa2raum nu4tex miciat mDeauvs;u4 etomf tytfpD an o;s) rtoio3nydlleelfeiat) rta(m ;t1aetnmicildfs2rl( pn()tlxrmo iotfatelivi t truoio iodlltn fet tf rtmxmooo0aeto f3iyslaDuauvpnt4treoxo3io1op rluvslt) etoir iu4apt lfet t) rtm( p;t0oltn o3tadlsDulnvp u0trtnxocoy1om ranei;() etoimpoo1lm elietas)s2rmxmp;u1tet  o3tld aDumuvp u4teerxo3iytlmD lu ilt)trtoimpoydam elicilt a2um(rp;t0oetnioeiad s2uluvpn()tetomf3iotfmtelnei;()texm(m oodlm e ivtas)aDtaxrpnu1tpto o3tls s2rm(mp;(4texrmr ty1fmD lnes s0 2xm(r iy4llee nci sf rra(  ;u1opx io3tas aDra( p;u)alxrxf3iotlp rlu s t  eumxm3io1lp  livtl( sDraum ;t0oeeniocils m raump;(4altrxo io1lp rlivol( sexrio nu1amee nctas s2trurp;t1tpxn ociatlaDem(vp t)aexnmr3oo1fatr ueils  eurxm3iy1opeelfetlt)sDur(rpot1apxomoeiat sDrmnvsnt0altrioctytlaD liei t0tetrxo iu4lpte nvtls s2um( pou0aeeomociysfaDum(mo;t)trxoxr3tytfpt  i o;( tetoimpnudaltemfvtas) rtmu pnu0alxo ociytla eauvp;t4tetnxrcoy1fp eaiesls0texoir nu4ap elfesls srtrxmpnt0teenmfciasfa elnvp;()treoiocio1oa ran ils  2xm(rpiy4lmtnlics s aDrm(rp;o1apenmfcilt sDumnms;()tlerirciotfa elieols0s2um(mpnudllt  fci tfs2tru o;u4teeo ociysfm2ra(vs t)artrir3iatla elnvs;s s2xoxm3nodapt lfcs ( sDum(m ou1texoioeiytfa el( o;u4treniociy1fa eau i ()s2uoir iudlpte ieslt) 2taxr ot1tlto fetas a2el( p () ltrxrctodlmt luvi;() ruo(o3iodol   feilt s2ur( oot0oexomfciysla ulu ont4trtomoctotlpDeluvilt0s2uoiopoudlmtnmiesat  Dtmx  ot0tlxomocils s2eaumo t4arxomrcoodoptelivo ()t2xmio3nu1om  mfvsl()aDurxrp;u0teeoiiciad m eluvsn()altrifciy1fmt auei t t2trir3nu4ll emfei () rrrx  ot1tltniiciltfa um(vp u0tlxoxf oadfa   u s;()srxmxm oo4lleemiesl( aruaxrp;t0alx ioeiytfs rauvonu4 exoio3tatopDelivs s  rxoxo3no1lmtnmfeil(  2ua( o;u0tlt mfciat mDel(vpnu4trtnmr iotfat luvi ()trumiopio4oltnmfvt tfsDra(m nu0teenmoeias sDeanmo (4aetrio iodlptrlnei s) eur(m nudamee icsa(fs2tmx  ot1alenmfeiasfaDrmuvsnu0 etoxrcoadlp  au sls)srxr(o nu1llt mivi s srrax  ;u1olxn f3iad sDumuvsnu) eeoxo ia1om ranes () etmio oy1apee nci t) 2rmxmo;t1tleoif3iatls ulnvsnt)tlenmfcoodlaDrlu sl( teur(m3oo4ol nmfvi t) Dumu pnt1tptn o3tltfsDum( p (0altomo iodoaD  nvolt0 rxrim iudalen fes s)sDurxro;t4apt ioeiyslm em(msnt) eeoio oa1omt lu o ()srtmim iu1alenmictat arurxmpot1openiietytla2eaump;(4 eermrcootfpte u s s) ruo(rpnu1ope mieilt)a2uru oou0altnioeilsfmDua( p;u)altoxocty1fmD aueslt s2to(mpoy4lpe lneias s2ua( pnu0oet ifeiydfs2emnvsn() eenmr ta1omD  nvs t  exmir3oy4amtemfci tf 2raxrooo0texo o3iydlm2rauvs;t) lxomo tydomD livs;s0sruo(o no4omee ictls s2umump;t1opxoiociydfs2el( o;t0 exrxfcto1lm  livo;s setrxm3ny4om nmics tf 2um(ronu0ape iictld m um(vo;()arenmoctatla  li o;( trxoirpnu1ll  licsas  2ta( oou1alxnmi3tas a uaumpnt0 eenmf3iadla   neols srxm(o ny1apt lnvtlt s2trur no1tpt moetlsfm2eluvs;u) exrmrcio1op   i s;(  exoxm3nydoptnlfes (f 2tm(  ;o4tpeoiieiltlm2umu p (4aeenio totlp  lu i;( s2uoimpiu1lme mietltfsrraxrp;t4apenii3iadls2elu p ()alxnmr3ia1fa rlieilt s2umxopny1ame mfci tfa2tr( p;u4apx io3tasfaDua(vo;u4tleomfcta1lmte iei;s srto(o3iudal nmfvtls)a2urx ono4ale  f3tyd s ea( p u4trtnio oy1oatrauvols)s2uoxr io4al   fcsasfsrra(  ;t0opt moeiytfaDelu o;u4 exrmfcootop r ueils) 2xrxo3ou1opt lfeia( s2um(monu1aexomictys s2rl(vpn(0tltnxr3iatlpt  ieils0teurio3no1lmtelieil( aDrrx  ;t0alx  oeilt a rluvo;t4 etrmr3oodfaDelueo s)seurxo nodlp nlfei (fsDtmur ;o1altnifeildlsDrlnvo u4 exoif iytopDe ivo;()t2xm(opiudomtelivtlsfarra(mpnt0opx iiciyt m rm( s ()aeeoifctotlp rai s t)srtrxm oudape mfvsls)sDum( p;t1aee mi3ilsfsDumu ont4arermr tadfaDeln s s0trxo(m nydaleelicslt)s2taum oo0ole  o3tysfs2ulnvsn(0texrxf tytop raneil(0s2trxr3no4omt mnetasfs2tmxmp;t0oleo fctlt aDrlump (0teerxr oatopteli s;t0seuoio iudlptemfvt sfaDrr(  oo1apeo ociytlsDuanvs;() exoircia1fa r uvo;t0trtoxr io1am e icils  Dtm( o;u0apen ieiasfsDrln s t)aeeoirctodomDran s ()s2tmir3nodopt lfct t) Durxront1olxoifciytlsDrl(vo;(0tlerxf3iytfaD  u ilt0 exm(m nu1ap n netltfaDuaum oo4open fctld mDel(mp t)tleoiocoydopDeluvo t)tetr(rpio1lp nlietl(f Dtrxm no1tpx ifciaslm em(mo t0aexnio oatoa raueols0sexrxm3ou1apte ietlt arra(m ;o0alt ii3iadla2rlnvont4teenio iy1lpte ivs;()trtoio nudaptnmnvtl(  2urx pot0tlx  octatls2uanvp;t) etrxocoodlm elnes;(0srtoxo no1apee fes s  2uaumpnt0oeeomfciadls uluvo u4trxrmf ty1latelnei s  2urxrpny4amtelneil(  Drmuro;o0aleoii3ias s rm(ms;t4tlermf3io1fp  li ols0texmio3no1al  mfesasf Dtax poo0tet mictydfm2emn sn() ltrxr3oadomDelnvi s s2urim oudllt mfvs t arrau  ot0texo ietyt sDulu s;t4aetoif tatlpDrauvil( s2tm(opnodapen ictlsfs2umur ;o4tpxomfciytfm eauvs t0trtoif3oadop eau il(0 eurir3iodopen nei sfs2rmumoot0alxomoctldls2rmnvs;t)tlenmr ta1optrai i;()setrxopoy1oleelfvtatf 2uauronu0tetoif3ias a rmnms u0altniocoadlpD  n s;s sruo(rpno1amt  icia(fsDtaxront0texn f3iaslm2eau o t0arerxrcootlmDrauei (0sexoio ou1apenlnvtltfsDtmx ono1apt iietad m2rlnvp;u4trxoirciytfp  aivo ()texmxr3iy1lltnmfctlt s2rmxmp;o0tlt iociasfmDuanmo;u)alenio3ootoaDeluvs s srxo(m3ou4alt miei tf Drmxmoot4aexn fctydfa rmnvs u4artnio iatlpD lues;t) 2tr(m3ou4ope  fctlsfarrr(rp;t1tlto ociadfm2uau onu0alenmr oatlpDeluvi;() exoir3nydopt  fci sfa2rmumoou4tlt  fetyslm rlnmp;() rxnio3tytlm rln s ( sexrim3io1llee ics t) Dururpou1tpenmietldlaDemumo;()trxomf3iatfpDeaneil(0t2trirpiu4lpte fvilt artr(mo;t4teeoiictasfa rlu p;(0 lxrmf3oatomt anvs;( setmim ny4aptelnvt sfs2rau ooo0oleomfeildfa2ra(ms (0arxnio3ia1opt lieo t) rtoim nu1apt lietls)arraum ou0aee  oeiadls rmn p (0trtrmr3oadfatelnvo (  2xm(mpnu1ame lfvil(fsDrrxrpno1altomoeiyd s eauvp (0altoio todom raieo;t s2trxrpoo4oltn iet (  2tax o;u0tlt mi3iaslaDranvs t4aexrifciadlaDr ueo;(0 etoxopno1ome mivils)aruaxmp;t0tlxn ieiatfs rlnms;u0arxrio tytfp rln o s  rur(r3nydap e fcsl(  rtru o;o4opxoioctasfs2ulnvsnu0trenxfctatfptr u o;s0t2trxr oodoptelnesa(f Drm(rpnu4olto oetys sDua(vp;t0trtomf oa1oatean i;t  2trxo3iu1lmee fvslt srtr(rono4tpxnmfeiyt mDemn p;t) exrxo to1omtr uvils  etr(r iy4altnmnvs s)srurxmoot1oee mieils sDean snt)trxoxfciotoaDrlnvi (  rtoxo3iy4apt mivtat a2rm( pot0tpe ii3tydfs ean s (4altnio ty1lmDraivs s)s2tr(mpio4ll  lfvilt)s2trurp;t4alxnif3ias s2eau p (4tetnmocto1fpDeanei;t  2xmxo3no4ol nmfcilt  Dra(r ot1oetnmoeiasla emn p;t4 exomfcoadlaDelnei;t) exoxo oydapen ieil(faDuax o;t4alx moeiasfm ul(von(4tetoir3iadla elneo;() etmxm3oy4lmenliei (f 2ua( o;t0tpenmictlsfmDean p;t0aetomo tydlpt an s;t) rurio nu1lm nmfciasfsrtmu poo4openif3iadlaDumumo;u4trxniociatlm  au i;s)srxrim3oodamen ietl(faDrrxmpoo0oleomfciadfa2elnvp t4tlxrxfciytla eln ol()sexr(m3no4am nlfeias a2rmu pot0aet io3iyt m2umums;u0alenxocootfpD auei ( s2xo(m nu4altnlicias)a2rrxrpno4apto ieild m2rmu pnu0arermf3iytfa r nvs t texm(opio1om e fciat sDurxmo;o0oleniieiadfsDeanmp t0altoxr iadlm eanvs;( srtm(m oudomt mnvtat)s2rrxr no0aetn i3iysfm2ulu s t4teerif tadfaDrauvi;(  etoxr3iy4olen iciltf rtr( oot1olxnmfeilsfs2ulumsnu0 etrmf3to1optr ivs;s tetmxopnu4ale  nesa()s2rr(mp;u1aex  feiyd s rl( s;t4aexomfcto1opDrli i;t0setmxopio1op elnvsl(f Drru onu4alt if3tysfm umn pn(4 eeoxrcoatopt  i o t)srtoxo3iydlp elnei tfs2rru  ;o4oee miciatlmDumn o;(4tlxnxocio1faD  nes;s s2uoxo nu4om nlictl(fsDrruroou4alxo ietytlmDuln s t4 lxoxfcoatfm eau i;t  eurimpio1ap nliet (fs2umumoot1olx mi3iadfa2rlumo t)tleoxocia1omt auei;t) 2uo(opoydom  mfet tf 2rr(  nt1aexnmfctasls2um(mpnu4alerxfciodlptrau s;s)s2uoio oudalen ietatf Draurono0opxnifeiltlm2rmnmp;t4teeoirciytfa  au s (0teto(opiodlmtn fetl(  2urur no0tpto octys a umuvs;u) eermrciadlaDrlies ()t2ur(m iodapenmnes t) rrmuro;t4oetoiietld sDeau on(0alxnxociytlateauesls)s2xm(opio1lp e ivt s aDtrxmpoo0opt iictyt sDrm( snu0tlermr ia1fm eau s s  rtrir3oudomtemfvil(  rrmu oot1altnmieiaslm ranvs;u0 lenxo iotfm raivs;t  rtrim ny4omtnlnetlt) Dtrurpnu0tex  f3iytls rmumo u4aexoifcoy1fmteaivs ()setmxopnudole  ivsltf rraxroou0aee ifctasfaDrm( p;(4 rxrxo3io1fpteanes;(  rtm(o oo1ape lnvi sf Dtaxm ;u4tle  oeilt a rauvo;t)trxomrcia1omtraueo t  euoio nydllt mieilsf 2tmumo;o4tptoiieiltla ul(ms (0alerxo3ty1op r i olt0 2xmir oo1oltnmics t a2ta(mo;u4apxn f3tydfs umnvon(4tetnmr3oatlmD  i i;(  exmxo iudapeelnvt t)sruaur no1tleomocilt s2elnvpnt4tleoir3ootlpteai s s) 2tmxo oudoptelictlt s2tr(m ;t4olx moetltfm uauvs t0trxnxo3oadom  ai i s0tetoxmpio4lmee nct ( arurur oo1aexnii3tlt a2umumo;u4tetoxrctadlmD an i;() 2xoxo oodapenmieia()arrru pnt0optnmieiat m2eanmpnt)tlenmfciotoatran i;t trumir3oydll e ncta( sDrmumo;t1texomf3iytlmDulnmont)tlxomf oytlp elu o;t s2urxr nodomen ivi t)srta(mooo4olxoiiciydfs2rmnvp t0 eeomfcto1fatrluesls0texr(opiu1lpe  ieias)s2rmxmonu1tleoifetltlaDumuvs u0 renxo tytfa rlnvs;t) rum(o oo1omeelneiltfsrtrxrpot1texomf3iyslm rauvp;u)aexoxfctotfm elivil(0teuoxrpiy4lme mnvsat) Dtmxr no0oex  ociysfs2rmuvo;(0 rtrxf3io1oatrlnes t)trxoxo iy4ol nlfct s) Dta(ro;t0apenmictls mDrmu snt4 exomo3tydomD ln i ( sruoxrpiodape  ivi (farur(  ;u4apenioctltfa2rau s (0 lxoxf3oy1lpteaivo;()seumio no1omenmici (  rum( pno4oet mi3tat s um(vsnt4altnxrcta1lmDrau ils)seurxm3ou4ol   ivta( sDra( oou0tpxnmfeils a2rmnmo;u)altoxo iodlmDr ivs;s  eumxo3io1lle lncsasfsrtr(m oo4altnmi3tlsfaDuln o () eeomrcoo1oateln sl(0t2xo(m3iodll e fvsas  2raumoot4oltniicildfs elnmon(0tltomo ia1oa  lneols0trum(m3nydlmtelfet tf 2rm(mono4tle mf3ilsfs2ea(mo ()arxnmf tytlatrlnei;t0seumir iodll  lfesas  rtmxm ;u0oet moetadfs2uln s t4aetrxocio1oaDraueslt  rtoxo3iudomt liet t)s2urum ot4olxomoctytfmDuln on(0alenir oa1fatrlnvols0trxm(rpiy1am n fetl(f rtmxm no1olx io3iyd sDea(mo;(4 eenif todfpteauvo;( srxrio3nydomtelfct t a2um(moou0oet mieiyslm2umnvpn(0alxnir3oydoa eanvi ()setrio3iudope mneias aDuau oou0aexoioctld m2ra(ms (0 rtnxr3iy1lp   ivi t  rxoio oodop  mfes sfaDtmumpnu1oet mfeiydfa2rln s u0trtoif3oy1opDraivols s2umxo iydllt lietl()a2ur(  nt0oex  o3tydla eanvonu)alenxo3tytlpDr uvilt t2um(r nydapt  ivi s)aDra( p;t4tpxn oetysfsDrm(vsnt4 rxnio3oy1fa ranei;t)seto(opno4olenlfcia()s2tauroou1alxoiicils mDumuvo;t) lxrmrcio1lmDelnvo;s s2xr(rpou1lmen ncsl(f rrm(m nt1tpt ii3iatla2ea( snu4 rxoxociatfmtelies s)srtoxmpiodom emfei t  rtm( poo0aetomi3tytfa2em(vs;()texoxf3oy1op raivs;( t2ur(m oydomte ncta()aDtmumpot1tltomieils s umn s (0aetrxo3ty1faDrlu i;( t2trio ny1al nmfctlt)aDtmxm nu0aexoio3ildlsDrlu p u)altnio ty1fp   u o;t texmxr iodopeelfei t srua(r ;u0olx moeiad m emn o t) eeoio totfmDeli o t)sruoim iy1ll  lfctat) Duax  ;u0alt  i3iysfs rl( p t0 exoir ty1fatr ueo;(0 ruo(m oudolte ivils)s2tr(mpnt1apt iociytfm rlumsnt0arxrxf oytlaD lneo;() rtrxrpoo4ll   fvil()s2umx oot1aex ii3tlsla2ra(mo u0arxnir oadlmDeluvi;s0t2toxo3nydalte ivil() rtmuront4tptniiciatlm2ul( p;() exrif3oydfmt anvols)s2xrxrpiydope  fcilsfa2umxr nu1tee ifeils mDrluvs;u0 etrmf ootfm  anes t0 2um(opou1amenlfcils) rum( pno1teto ociyt a elnmo (0aleoxo3tatfmtran i s)setr(m oo4om  lnvsat)s2trxr ;t4apx ii3ilt aDemumo;u4 exrmr3io1la elu s ( trumiopou4oltelieta()a2tr(rooo4tet  fctlt m um(vpnu4 rxrxo3iadopDraivslt) etrir oo4ole  nctl(  Dtrumo;o4tpt iociasfs el(vp t0tlxrxf oatlatrai s s0srtoir iydop nmnei ( a2uau  ;t1olxoifctls m umnmonu)alenircty1om e ueo;s seumxr iu4lpt mnvi ()arumxm ;o0tle  o3iydla2ul( o;t4 rxnxr3tydoat lu o;t0 2xrxm ou4al nmfcta() 2tmxronu4apeomfeiysfaDran s t)tltnxf3ia1laD lneo ( s2umxmpoo1ome mfvt ( srurum ;o1oexnmo3iat a2rlump;(0tetrirctadlatr uesl( t2xrio io1ameemiesas aDumum nu4optn i3iydlm2eanmp;u0trtoiocoa1lptran o (0sruoxm iudame  fct t arrrum ;t4oexomoetyt a2umn o (4arenmfctydfateliei (0teuoxo no4oleemnvtlsfs2ra(  ou4oeeomfeiadlm2ra(vp;u0aexoir3oo1lpD lues;t trto(opoo4lptnmfesl()sDra(r ot1apxniociltfsDuaums;t4tltnxo todlmteauvs;s0trxrxr io4lle mfvs () 2ta(r no4oltomf3iatfsDua( s;u0 etrmf tatopt li i s srxo(rpiu4olen neils)artaxr nu1tpeo fetldfsDrl(ms u4tleoir tadfmt li i s0 exrio nydlpe mfvt s s2tmur oo4opxnmo3iltlm2raumsn(4 eenmr3oa1omte i i () rxrxr3iodlp e feil(faDurx pot0teenmiciyslsDean o t4trtoxrcoatlpDraueo t0 2xr(mpiu4altelfcsa(fsrurx p;t1olxo fciltlmDrl(mp ()arxoifcio1la r ivi;s0teumxr iy4lm  mnvilsfsrtaump;o1tlen i3tydfa2el(mp ()aeermoctatlmtelieilt)t2um(rpnydaltn fvia( arumumo;u1tet mo3ilt a ra(mp;(0 exrxo3iy1fpte nvo ()trxoio oodalt lfes (f rurxr ot4tetn ictld s ua(vo;t)aleoifcio1fat  u o;t) 2to(o3iy1ll e neia(fsDtm(rono0tltomfeiydla2eanmsnt4 lxnifciy1oatran o;t s2toim iydlpeemicia( sDtrurpnt0oee  octaslm ua(ms t) rtoxo3oadlm   u ols0t2xrxrpiodope mics t  2ta(  ;t1tpt mf3tad a rmu ont0 rxnir oodopDe ueo s)tetmxr iu4ap elfvsl()s2ua(mo;u1aleo o3ildlaDra(vo (0 rxnio3oa1omteaiei ()trxo(m nydlpenmics t  rtrx p;o1tlxnmoeiasfm ean s;u4aeenir ta1faD aueo;s  2xrio no4omt mfci t)aDrr(  oo0aex miciys m2ua(ms;t0tlxoxrcia1faDrln i;t)texmim3nu1llte nci (  Dtrum nt1ope io3iyt m2ua( pnu)artnmf oy1la r nvolt  2xrimpnu1lpe  ncsa()sDurur ;t4alt ifeiltls2rm( pnu0arenxf io1lm  au ils0trtm(o nu1llen feil(f Drmu ooo0apeomi3tysfm rl(mp;u)teenxf todlmDr neil(  exmiopio4lle  nvs t  rrm(r ;o0olxo f3tyt a2ra(ms;t0trtomrctytoate ivs t)trxm(m3oodal  micsasfaDua(mo;t0tet moeiyt mDrau s t0tetrxr3oadlaDrlivs;t  rxoxo3iudoptemies () rtm(  ou1tltnmieiad sDrln s u)alxnir3to1lptelueo ()tetrir oy4ale  fvi t  rurur oo1tlenmoctadlm emn s (0aetnmf3iydomtr ueols)seumio3no1lpenlfctat) rtaurono1oltoiociys m rmnmp;u4 eenio oytfa rlueols sexoio oydopt  ies t  Dua( oou1aptnif3tad a ulnmo;t4aeeoxfcoydfm r u sl()trtr(o oo4omee neil(fsrtrum ;t4tlxoifetydfs2rl(ms u4trxriocio1omt  n ol(0truo(mpiu1al nlfvsasfartm(moot4opx iieilt a2rlu o;u0arxoxf tatla raiei t0sexoir ny1lltnlfci sfa2uau  oo1altn f3iydlm2ea(ms;u0tetomo ta1fat livo;(0srxm(opiydomt mfvtl( a2tmxmont0tpx mi3iytfaDem( ont)treoifciadfmD aies ( t2umimpoodop  mivi t)a2taxro;u0oetomfciadfa um(mp;u4trxomf3oadlpt lnvi t s2toiopny1opeemicslsfs2tm( pno1ale  icilt aDemn o;t)tlerxocootlaDrai s t0sexoio3oodapeemics t  2uax pnu4oleoio3iaslmDrau sn()tlxnmfciodoat liei;s) rxmxo ny4lmee fvs sf Dum(r nu1olxn feilt aDeau s;t0 lenio3iytopDranvs ()teto(o3nydlm  lfciat)aDtmxm nt0opxomfeiydfsDra(msnu0altrifciadom  li ol(0 etrxr nu1omte icil() Draxront0aetnif3iyslm2eauvo;t4treoio oo1oatelueo t)t2tmio3nu4ap nmies tfsDrm(mpoo4tlxoiieiadfm em(vo u4tlxrmo iydfp r i s t0 2tm(r3nu1olenlfcsls sDtaumooo1tltnmf3iytlaDrlu snu) rxrxr tadoatr nvil()setm(rpny1apeelncsa(fs2uaum ;u4oex iociatfm ulnvo ()aeerio tytla r u o t t2urxr3iu1alt mivs () Dtax o;t0ope mi3iyslaDumn s;t)altriocoodla rlu i;s0s2xo(rpnu4ome lnvi t)aDtru p;o4tetoiieiydlm2el( onu4 lenmo ty1laD  uvol()seur(r no1lptnlfctat)sDtaxrooo4apxnioctldfaDuauvonu) rtoio3ty1fatelu i;( truo(rpoo4om emictls)arrr(m ;u0ale mociysfmDuaumont)trerio3iotoa e nei;(0s2tmxmpnudomtnlncia(f rra(  ot4alxomociaslsDua(mp ()arerif oadlm eanvi;s)texoxm iu1llt mfvi (fs2ua(  nu4tlto ictlsfsDumu s t4 exrio3tadomt lnvs;s) exr(rpou1apeemnvt s  ruru pou4aleomfeilt a2umnmp u4 rxnxr ia1fmteluvo ( t2xrxr ou4apen nvta()s2uaurpou1oetn icild m ulu s u0tetrmr3ootomtrliei;s)trxmirpiu1optn feslsfsrraxm oo1tptomfciydfa em( s;u4 etnio3iatfate ivo;t  exrxmpoudole mnvtlt) Dta(mooo4alt mf3ilsfsDum( o t0tltnxocto1fmDeaieolt trxoir iu1ll n ivi s aDtmxrp;t0altoifeildfa ean ont)altnxo3iotfmDe ivi s)trxoio3oo4lltelici t)s2ururoot1oee mo3tat m uauvp;u)artrxfctydomD an o t0trumxo3ny4ape  net t)a2taum no0apx if3iad mDel(vsnt0arerxfciytlmDraivi;(0s2ur(r ny1am nlfct t s2rau  ;o0openmf3iytfsDul( pnt0 etnmo ia1fmDrauvs;(0tetr(opou1ameelnvilt)a2rmumo;o4aptn fctatlaDeln s u)teeomo oadoa eauvs;(0s2trxopnydom  mnci tfsDurur no4olxo fcildlmDrmuvs;(4 lxnircoa1fpt  u s;s)s2xr(m iu1op nmfetas a2urum ;o1tpto icild m um(mpn() rxrif3totlmtrlies t0 rxrim3nu1omenmncilsfs2rm( pot1oet mi3ias m2elnvs;u0artoifcty1lm eli i ()srurir ou1amt mfeiatfsDrrum ou1oexo ietys aDrl(ms (0arxomo3totfaDeln sls srxmxo oo1lpt  fcsltf Dtax p;t0tet  ictydls ul( p;u) eeoir iatlaDeluvi;t sexrxo iy4op   fvtls)s2tr(m ;t1aeenmf3ias s rmuvp (4areoif3oytoatrlneil()srumim3io4ll n fei t  rur(monu0oee mfeildls2rm(ms;t0trxomr tytfaDr uvils trum(m ou4amt mfesas srua(mp;u4aleomfeiltfmDrmnvp t0texnxo todla rauei;s)s2xoxm nudlm  lfetat s2rr( p;o0apxoii3tld s eanvsnt)tetnio iydop e ies;(0s2uo(o nu4lle  fvs ()artmumpot1tpxomiciatla2ulnvs t)altomfctadomD lueo t0t2trir3iu1op nmfesls  Dumur no4tpenmi3iad aDuaums t)trxrmo3ty1oa eau i s)texr(mpoy1llenlnesls s2tmumoou4tlt ioeiys a2emu o;t)alxnmrcoydfmD ai i;(0 rto(o iydll nlfvils a2tm(r no4tltomiciysfa uau onu0 lxoiociytopteau i t0seumxm3iodal emfvi tf Drau  ;t0alxo feiasfs ranvp;t)aexnxo oodfateli il(  eurio3oudomeelieslsf Duaur oo1oexoio3tyt mDea(mo;(0 lxoif3tatoat  uvs t  etriopoudap nlieil()srtrxm ot1aleo o3iltfs2emuvs;t4aexnxocoadomDelnvols0s2trxm3nodamt  net s)s2tr(  ;t0tpeo ictydfaDel(vs;u4altriocio1oa e ueols)seum(m3oo4ale  ivs ()a2urxm ou0oleoiietyt mDemn p u) rxoxfctytlpDeaneil() 2toio nu1ape lnvta()artr(  ;o0tlx ioctydlmDea( p () rtrmrciatom eau s ()srxoxrpio1lmtn fvtlsfartrx p;t1aee  icild a rmums t)teenmr3io1lp ranvs;s texrxm3oo4lmt liet s arrr(mont4apenmoeiatlmDea(vo (0trenxo3ty1late ues;( t2xoir3nu1ap   fviat) Drruro;t0aex mi3iydfaDelnvs;(4altoioctytopt anvils)trxo(r oy1opte nvils a2uaxmpou4ole moetatlm umnmo u) renxr3iadfpDran ils)srtrxmpiudapeemnvsl(f Drr(rp;o4altnifctadfs ran s (0altnmfcoy1fa  anes t0srtrxrpnu4ap n netasfarumur ;u1ope mfciytfsDeau sn()arenio3ootopt livo s0s2toir3oy4omt mfeilt) Drmx ono4oex if3iaslsDeluvs;u) exomf3iatomtelnvil()sexrim3oydap nlnvi s) ruru poo0opxo oeiydfa eau on()alxnmr ootlm  luvil()trtoxm3iudom  mnvia(fsDta(rpoo0ole ifciyt s em(mon() lxnxr3oodlpt an s (0 ruoxm3oodll   iciat) Dtmu pnt0altoifetyd a uanmp;()tlxniocoa1faDrli s;t0 euoxm3oudal nlfeil()aDrmx o;t4ope  fetatlm2ranmsnu0 lermrciadlptrluei s0t2um(m3nodolen ncsa()a2tm(rpoo4texoii3ildfm2uln on(4aexoir tatop elnvi t sexmio nudap nlnvta(faDum( pot4olt  ieiytla uaums;t4trerio iodomt  i s;(0 2ur(mpou4lltelfeias)sDtrurpou1oeeo f3tldfm el(mpn(0texnxf iytlp eauesls0 2toxr3nu1apee fvtlsf 2ra(r ;u0ole mi3iytfmDrmu s;(0 etnir iatfpD  uvolt)sruo(rpoudlpe mfvia() 2um(r ou0aex moeild a rmuvp () renmrciydlatrluvslt0trtmio io1lpenlietl(faDraxrpno1aee  i3ildfm2rmnmp u)aetrir3iatfa rau ils tetoim iu1om e iet s)s2truro;t4tltoiocilt a2rl( o t) lenifctatfp r i ilt teur(opiudllt mnvs ()arrrum ;t1tet io3iatls ulumonu) rtoxrcoo1optran o s0 exo(rpnu4ll  livtasfsruru  ot4altnio3ildfs rmump;t)trtnio3oo1lmDe ues;() rtrxo3no1ll n iesas)s2umxrp;o1aeeomfctltfs2ea(mp t0 exomo todfpDraies s0texmxopny4op   fct s) rtmump;t4opxnmfetlsfs2elnvsn()tetnxo todlat luvi;() rur(mpnu4lme lncia(f Drm(m no1optnmo3ildfm ul(msnt)texrioctydlp ran s;s0 exoir nodol   fetltfsDrru p;t0olt miciyt s rln o t0arxnxo tytfatr n i;t  2tmxo3oudlme  feiat)arrrurpot0alx  ieiyd sDrm( snu4altnxf oatfpte iei ( texo(m3iu1lm n feiat) Dumxr ou1oltn i3iltfs2rm(vp;u0texoir3tadomDeaivi t0 2tm(r3nu1lm   ieta(  Drr(rono1apx mf3iyt sDrmnvsn() rxomr3todomDr nvi;t0trtoxo3ou4llt  nctls)a2urumpou1tltoiieiadfmDra(ms;(4arxnmf3io1fp elu ols)t2umxm io4op elivsat s2um( onu1oet ifeild mDemnmpnt0treoircoo1oaDelieo;s0trtr(m3nu1altemnvsasfa2ta(ro;u0oee iocildlm uln p t) lxnxo oytoa eau il()sexoio no1amen fetls)arurxront0tltoio3iydfmDul(monu4aleoxf3ootfaDe iesls0 rtr(mpiudamee nvt ( aDra(ronu1apx  oeiltfsDumums;u0 etoif3iy1la rlnes;s)seurim ny4optn ivslt  2um(m no0alxnifctadlsDeauvsnt4 eeoxo tytfateanvo t) 2tm(m ou4oleemfctasfarraxmp;t1olxoiociytfm2eauvont4 lenirctydfpt auvo;t)tetrimpiudamt  nvtltfarrr(r ot4tpx mf3iytfaDrmnmpnu4 lenmfcoo1om rlivsls0srxmim oudlltnmicsasfs2umur ou4altnifctlsfm2ulnmo (4trtomf iatfatr neo;t s2xmir oy4lptnlnct t)aDtr(rp;t1tetnioctyt s2eanvo t4 ltnmocoatlptr n ilt)s2urxr iydomtnlnct t)s2taxr oo0oeenmfetltfa2ranmo;()texomr3oo1oatr nvol(0s2xrxmpnudam nlnciltfa2tr(mooo0apt  f3tltla rl(vont) rxrmr3iadomDr ueo;s)trxmiopou4alee fetat srumumooo4texoifetytlm2ranvs u)aleomocio1lp rli sl(0t2trim3oo1lptnlivi sfsDrrurp;o0apxnmfetytfs2umnmsnt)tlerxf3ia1oa rau s;s0 ruoiopio4ll nlfeiasfsDrruroou0aeenmicildfmDrmuvpnu0altnmrcta1fmD anvo (  exo(r3nu4ap emfcslt  rtr( o;u4aetnif3iaslsDel(mo (0aetomo3iy1om eanvi (  etoiopnudll nmicilsfs2um(rpno4ope ioeilsla2emn p (4artrmfciatfpteau i;s trtoxm3ou1lmenlici sfarra( oou1opxn ietytfm ea( p t0tetoxfciydfateaiei s t2trxm3nodoleemfvi sf 2rr(mooo4oex  ietas s em(vo u0 eermr3oadlaDeanes (0tetmirpnydlmtnlfcs t) 2tmu oou1teeoif3iatfaDeanvpnt4 rxoxf iotfa   i i (0tetmirpiodal nmnvt tfsruau pno1texnmf3tydlm2eluvonu0aeerxf ty1la e i ols t2xmxm oodlpe  ivias artrurpot4aex  ieiadfa2rmnvsn(0arerif3iatoat aivilt0srur(r3nu4lmee ivi s  2tr( pot1tlxoifetadla elnvs t)artnmo oadoaDean o;s s2ur(opnudllen icilsf 2rr(mo;t1aexomf3ias s eauvp;()altrmociytopDr ivo;t trtrio3iudlptelncs s s2um(rooo1oleomfciatfm el(von(0tlxrirciodoptr ueil( s2xrio oydlltelicsa( sDua(r ot0alt  ieiydfa emuvs (4 ltomr todoptrli s t truo(mpoo1am n ict tf 2um(ronu0oetomietlsls ea(mo t0areniociy1fmt  i s s  euriopio4am  mnesas sDuau p;u0aeeoii3ildfs2eauvs;() eeoif3oatfmD livo;(0trtmir3nu4lmtnmfcsl()srrrxmo;o0aex  o3ildfaDul(vo u)trtnif oodomteaieslt0 rum(opno1al elfvt (fs2taxm ou4oexnmoeias s2emnmo;u) exoifcoodlm eaivo;()trtrxr3nu4al  lfesas)arrmu o;u0ape ioctytls emnvo;u4trxomo3iotfp eau s;(0 rtrxo ny4opte ict () Dururo;u4aeto oeilsfmDua(mo;u0aeerxocta1oa eai il(0srxrim no4ameemncsl( a2rmxronu1oltnmi3ilt aDra(vs t) rxrmo oytlmtran o (0 2tm(r3oo4lmt lnct t) Dtm(m nt0aet mo3iyslaDranmo;t)altrif3oadlpD liesl( trtoiopoy4aptemfes tf Dtru  ;o0apenmictlt sDrmums;u4alxnxfcia1fptelnes;t  rxoxr oydlle lncsl(  2ua( p;o0alt mfetad mDelnvo ()trenmrcootlaD an o ()s2xoxm oydap  lnci sf rraxmooo0tpxo ieiadfm2ean s (4arenifciatfptraneo;s0t2uoio3nu1lme micil(f rrax oot0optoifeiydfsDua( p;u4arxnmrcoa1opt li sl( t2xr(o no4lpenlivslsfs2tmumpoo0olto i3ildla ua(mpn()aetniocty1lmte ivs t) eur(rpno4op elieslt  Durxmo;t4aet  oetlsla umu p t0aexoiocoo1fp rlnvs s) rumxr iudam n fesls a2um( p;u1aptnif3ias s emu s (0aeermo oa1fmD auvol( srxrimpiu1lmenlicia() 2tr(mpnt4open ieiytls ua(vpnt4texomr iatfpDelivs s0 eumxm3nydlptelfeia(f rrmumo;o4apenifctldlsDemn o (4 exrif ty1late uei t0seuo(o no4lm  mncslsfs2uaxmpno0aet  icils m2ean on()texrxr3oytlpt anvo t)trtoiopnydam elneilt)arraumpou4oet  oeiltlsDrauvo t)trxnio iytopDelivolt0trxoirpiu1lle mfeta() rraumpou4olx  i3tysls ra(ms;t0 leomf iodomDeanvol() rxrir3iodlptnlnes sf 2rmum no0ale mfeiys aDeluvp t4teerxr3ootfmDeau i t  2umir oudllenlivs t a2ur(r nu1ope  fetltfs eau ont0alerir3oadlmDeaues;t) etm(o3iy4olenlieiasf rrmxm ;o0aptn ieildlm rlu snt)artoir3oy1oaDe nes s tetr(o nu4opeelfvils)srumum ;o0openmi3tls m ra( s (4altoxr3totfpDe ivols  exrim oodam nlfvtlsfsrtmumpnu0olto fetadls2el(vo;t0aetrxf3todfptrluei;s) 2trxrpoy1openmietlsfsruru pou4oeto i3ild a ul(vs;(4altrif3iotlatrau o;s) eumxmpnodopt lnciatf rraurooo4opeomoetyd a2rluvs;t)tltrmrctodlpt  uvi;(  rtmxrpnu1amee fet ()s2rru oou0aexo i3iltlm2el( onu0tltomrcoatfp raues t)s2uo(m3ou4alt lnvtl(faDtr(r ;t1tltnif3ilt a2ea(vp (0trtnxfcootfp  lieo s0trxmir3oudap emfcsa(fsDrax poo1ape ioctatlm2eaumpnt)altrxociy1fmteai il()sexo(o3iu4ap emfvtltfaruaumpnt4ope ii3iyd a2emuvpnu0aetoif totlm rai sls  rxm(r iydaltn fcslt  Dur(rpno0aptnioeiadfa2emn onu) exrmf iadfat lu o ( seuo(r3ou4llte iesas)sDtmxr no1alt moctldfmDrl(vo;u0trtnio3oydlmDrln olt0 2trxm oo1op  lfciltfs2tax  ;u4oex if3ildfs ean s;(4aetnmo oadfmDeau ils0seumxrpio1aptelicsa()sDtmuronu0aexn o3tlsla2ua(monu0tetrxfcty1op eaueo ()sexoimpnu4altemicils a2tmumont4olx  feiytfm2ra(vsnu0altrxf oodfa rau s t)t2uoiopoudomtn ncsa( sDumxrpno4tltomiciytla2eauvs;u4 lxniocootom ranvilt) etm(m iodaptemivsa(fsruauro;t0apeoii3ilsfm2um(vs (4artnif ia1lpt anvsls)trumir3ou1am emivt tf 2umumpou1apeoio3iydlaDemumo;t4 leoxr io1fat ln s;( s2xrxm io1ame lnvil( sDrm(moot0tlxnioctys m uanvp;(4 ltrir oodoaDrlnesls t2umxo no1llee ncslt)s2ra( pno1aleomo3iytlm2umu s;u4texnircoodfateluei;t s2toxmpoo1om  lfes s  2uaxrp;o1tpen f3tat sDumnmpn(4teerxo3oatlpD  uvi s0 rtrio3io1lp elfcsl( arra(r ;o4texniieiytls em( s t0arerioctatoa   nes t)trxrxmpiydape  fvias  rtmx  ;u1altniieiatlm ra( s;(4arenir3iydop  lneo;s srxrxmpnodol nlicilt) Dra(ro;u1alxnmociatfaDul(mo (4 rtrif tytlaDelu i;s  2urim nu4ol n iet (  2rrxrpnu0oexn fctltfs rlums;u4 lxnio3iotlmD  u o t  eurio iodlm n ict sf rtaum no0apxnmf3ilt mDrln s;u4arerir ootoatranvo;()s2xoxmpiudlltemnci tf Dtmumoou4opt  ociatfs ua(vp u0aexoxf3iatfpDr n il()srxm(m3no4alenmnvia(fa2ra( oot1teto o3tlt mDum( s;t0 rerxoctydfm   n s;t0sexmxmpoo4omtnlieil(f Duax pnt0tlxoio3iyd aDua(vpnu0tlerxf ia1fpDeln ols sexrir nodole  fcsa(  Drmu pou0tleo ociyt a2eaump t)altomfcta1late ivolt0 exmio oo4ll emnes (fsDrr(moou4olenif3iadfmDrmnmp;(4aexnifcoodfpteaieol(0t2xmirpio4amte fvi t  2rmx oou0alxnmo3iadfm2el(vp;()aeerir todoa   ivo;t  2xmio nudomtelfctltf rtm(r ;o0aee mfctatlaDeanmsnu0tetoio3iy1fmtr u o t)trtoim3iu4alenmivtatfarumumoou4apx ioetls aDranms u)trxrxr oa1omDean o;t s2toxm iy1lp  lics s)arrrx ono0oexomiciat aDuluvs t4 rtnio3oadlat  uei;(  etr(m3no1ol e ncs ()a2trxm ot1tltnmietaslm rm(vp;t0tetniociodfat  nei;t0srtr(o oodllenlnctlt)sDuru pnu0oexoii3tad s um(ms (4tetrifctotlm  au sls trtmim nu4omeemfeils  2urx  ;t4oee  o3ias mDel(mp (0tlxnxfcio1opt  nvils0sexrim oy4am e nesltfsDumu  ot4opt ioeilt s elnmp;t0texomfcoadlateln ils0 etm(opnu4aleemnciat)artm(r nt0oexo ieildla2rm(vo;t0arxoio todlmtrauvo;t)srxm(m iodolt lncslt)srtrxmo;o1opxnmoctas mDrl(monu)texrxf3iydfa eaues;(0 2xrio io1lp e neslt)a2rrurpnt4apxo fciyslmDranvo t4aeenxf tatlp   ivslt0teurim3ou1lpte icsl()s2rru pnt0tpxnmieilt mDulnvp u0texoircty1fpDeai olt0s2umir3oy1lpenlicsa() rtrurooo0apeoifciasfa raums;u4teenxo3oydoatrauesls0sruoxo oodlp  lnctas)artaur ;t1tlx ii3tldla ua(vo ()teeoiocia1omt lu o;t srumxrpio1lmtn neias)a2truro;u4opeo o3tydla umnmon(0treomociy1omt li i;()trxrio3iu1lpeemieia(  Draxr nu1tpxoiieiadlmDrluvs (4tltnmrcty1laD au i;t0s2tmxo iodll   ncsa(f Dtmxront1alxn f3ildlm ea( p;t0aexrio ootopDranvsls)tetrxm io1openmncs sfsDrmumo;u0tee  f3iytlm2uanvp;t4aexnxrciatlmtraiei s t2uo(o3no4ll  lnet s)s2ra(root0olt  fetlslsDem( ont0aexniocoo1op eai o;()s2trxm ny1lltnmfci s) Drrxmp;o1alxo oeiydfm2rau o u4aleomo3iadlmDrai s;t0s2xoxmpnudop nlivtat)aDumurooo1tpenif3iasfs2umnmpn(0aetnxr3ty1fmD li i;s) etmxo ny4lm e fetl( artru  oo0optomi3iydls elnmsnt)trtrmfctydop r nesls s2xriopnu4opt miei sfaDtm( o;o1aleoiieiytfa ulu sn(0texnmf oatomteaiei s s2xr(mpio4omte icils arumu  ;u0tptn oeiasla elnmonu)teerxf3oo1oa r uesl() rtmxrpoo1ape mnetls)s2rmxmpou4tpeoifctytla emums t0 lerir iy1fmDrlu i ()trxr(m3oy4lp emnes t s2rmu  nt4texn oeiys m2emu s t4aetnmo oydopDraueo;( teum(o iydlp  lies t srum(r nu0oetnmf3ild sDuaumo t4alxrxf ty1fptrluvs s0s2toxr3ny4omtelneil(  2rrumpot1aex  fciyt mDel( pnu4 lxrmf to1fmtraneolt0 eumir3oodllee nesat)sDtrxmo;t0apenmo3ils aDranms;t4 rxrxfcootlpt aivols0 etr(m3no1lmte ivi tfaDrmx ont1optnifciys a ulumonu4areomo3io1fateauei (0t2um(o3io1alt mfcilt)a2taum ;o1texo fetltlm rmuvo;(4texrmo3iydlmD aueo;t)t2xmio nydlmt lnvtas sDua(  no0oltoif3iyslm2ra(vp ()trenio oodfm  au sls0trumxo3iodlpt lfcs tf rraum nu4aet  o3ild aDem(mon(4aetoxociatla raivo;s  rxrir ou1al e fviat) rrmx  nu0aee iietatls2uaumo;u)aeerif oatlmt  nei;s)seuoim3iy4al emfcia() Draxmo;t0alxn i3ildfsDel(mon(0trtrif3oa1lp  ln sls0 rxrim3ou4omtelnvs ()sDrmx p;t1oltnif3ilslmDemumo;u)texnircoytfat  ueo s setr(opiy1lle  ncs sfsDraur nu1olxomoeiytfs ranmp;u0trermf iatopt anei;t  eurxmpiydll elics sfa2rau p;t0aptniietltfm2umnvs (4texnir todfm  lnvo;()t2uo(o oy4aptemfei s s2uau  ou4teen ocild sDuanvont)aexnmr totlaDrlnvsl( texoxo3ny1amtelictls)sDtmu ono1oltn fciatlmDulnvp;(0tetomr3oodlate nvolt) rxrir3iydom  mfet s  rraxroot1teeomfeiytfm elu s;(0treoxo3tydfmtr ues ()sexrxr ny1omee neta( aDrmur ;t4apxn iciltlaDrl(mpnt0alxoirctydfat lnes;()sexm(r ny4lmenlnctatfsrrm(m ot4apeomoctatfa2uauvp u)aexnxr oadfm  auvsl(  2toirpiydam elfeta()aDrr(mo;u4tlx  octat m emnvont4 eenmfcoodomtrlivols) ruoxmpnu1am  mivsltfaDua(rpot4openiicilt s2emumo t4 lxnir3oydfmD aiesls teurim3iudaptnmncs sfsrur(mp;t0tltn fcils s2rmnmsnt)treoxf3oo1lm r nvo t0seurxr ou4olt livsl(f 2ta(mono4aeeo f3ils s2ra( pnt)tltrmr3ootfat  n s t)tetrxm3nu4lmenlnvsltf 2rm( pnt0olxnmoctytfm rmumo () ltoxf tytlaDr nes;s0seum(mpou1ol elicsasfaDrau pnt4texo icias sDua(vo () eeomf3oytfmtraiei (0 rxmimpny1lmee fcs s s2rm(r ou0apt moctld mDua(vo ()trtoio ia1op rln o;(  rurxr3iodlpe mfesa(fsrrax  oo4tlxnmfciyt s eau ont0 reniociotomDraueo;( texr(o3nydlm nmivias  Dtrur oo1tptnmoctytfa2uanmpnt)aetrxr3iytop  lueolt  ruoxr io4ale  fciatfa2um(moou1olt moeils s emn o;u4alerifciodomtelueolt srxrxmpiy1lpe mfvil(fs2ur(ront4tlxo f3tlslsDuan o u4tlenio3totfmtrlnvolt) rxmio iy1lp  mncslt aDra(mpnu4altoiociltls eln p t0altnxr3tatlpt  nvilt0sexrxo3oy4alt liesa( sDum(mpnt4apxn ictlt m rluvp ()tltnxr ty1fpD auesls0trumirpoydolt  iet (fsrrr(m ;u0tlxo fcilt s rmnmp u4 ltrxfciydoat anes;t0srumxm iy4ole lnvi sfaDurur nu0aexnmoeiysfs ua( ont0altoxo ia1lmD  ieo;t0teumxm ou1op elicsls a2rr(mpnu0tpxnmo3tadfa el(mo t) reoxo iatlpt  u s;()t2xrim oodlp   ivsl( srua( poo0ale  o3iltfmDuluvsnt)tlxnxf3iytoatrau il()teur(rpou4olt  ncias  2ur(mono0optoio3ild m2el( o ()arenmf iytfp raivo;t)srurxm3oodlptelnvs sfa2umxr ;t4apxomieiyt s2rm(vs;()trtnio ta1fatr nvslt0truo(mpoy1omt lfvs s aDrrum oo1aexomoeildfaDeanvo t) lxnxrciodoaDeli s;s0t2umio nydlm emfesls sDtr(m ;o4tpe io3iydfm um( onu4altrmo totop  ai ol( setoxopno1alen ncsa( a2rmurpou1altnmf3tasls rluvp;()texnmf iadoaD aies s0trtrio3io4ale mics t)sDtm(mo;u4tex mi3ilsfaDulnmsnu4treoxrctodoptrlues () ruo(r oy1oleelfc
\ No newline at end of file
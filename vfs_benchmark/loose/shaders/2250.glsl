@@ -0,0 +1 @@
+ieolt0trumxm3iudop  mfci ()srurxmont4tpe  i3ias aDeauvo u)altoir oatfmte neolt0 euo(m3oo4ope  feia(f Dtaxr ou4optoif3tyd m rl(mont0 rtnmocoo1oa r u ols  rur(m3oydlp  lfesatf Duaumo;t4aee mo3iyd m ranms;t0artoxr3to1lmte u i;s trxmxo3iodol emnetls)srrrxmo;t0oltomictld a eanms;u)arenxocoa1oat lueo;t  2toimpio1op nlnvsasf Dumxrpnu4ole mf3tatla ea(vonu)treomr3totfp r nvs;s)trur(opiudamenmnvs s  rra( pno1oleomo3tltfa2emu o (0 lxrmfcoy1oaD aueo s)tetoir oodomt  fvia()aDuax oou4teen f3iltlmDua(mpnt4altrmo oa1faD auei s  etm(rpiy1om elfcslsf 2urxmono4aleomf3iys a2umuvp u) eenircia1omt an i;s0truo(m iy1om  mfvtlt)s2urxrpoo1aet  oeiytls2um(ms;t0trxnxf todlpteaiei;s)texo(opny4lm emnvtl(  2rmumpnt0tlxn ieilslm rmn onu0 ltoif3ty1fmt ln sl(0srxo(mpiodlpen nctl(fartm(  ;o1tee  iciat sDrmu ont)aetoxocoo1lat luvi;s0srxrirpio4ll   nctat  Dumxr oo4aex  oeiltlmDua(vpnt4aleoxr3iatoa eau i;(  2urio nodlp  livsa()sruru o;o0tpt  o3tatfs emu o;(4tltomf oatlateanei;()s2umxo oy4lpt lictat s2tru  nu4ale  ieiad s eanvp;u)trxoxo3ta1la  lnes;s  ruo(o3nydlltn fei t  Dtmxr ;o1aexoifctld a2uan pnu)tetrxfciy1om e nvo;s) 2toio ny1lme mici ( srtmx  oo0tetnioetasls ul(ms;()alxomociytfpt  uvslt)srxr(mpou1lptemnvt t aDuax p;t4texn feiyt m2elums;t)aexomrcoa1fp rlueols) ruo(m3iu4lp elnvsls artmxmont4oltoioeildfs2rl(vp;t4tetrifctytlm e ivi;s truoxm3nu4amen fvsls  Dra(roou0oexnifcils sDranmpn(4aetrmo3ia1lp e i i;(0teumim3ny1apte fet tfsDrau o;u0oex  fctydlmDulnmsnu)trerxrcoy1omDrluesl(0tetr(rpiu4amtn ieias) rraurp;t1aetn fciat a rlu ont4trtoio totlm elnvils truoimpoudal emnesls arrrxrpno0aet mi3tldla2elnvp (4 ltnxr tydfpD aneol() 2tm(r oo1amte fetat)arumumpoo1olxnmfeiat mDea(vont0aetoxo iadlmt au sl()teuoiopoy4lmtnmfvsat arrau pnu4optnmo3iydfsDeanvont)arxomo tydop r nvilt0srxmxrpiodope  fctls) rur(mpnt4teeoiociltls2uanmp ()trtrmrciadlat ln o t  eto(o nodom  miet (  Dtmxrpnt1tptomieiyd m rmu o;t0alxrio oadlpteln slt teurxo nu1omtn nesas) Drmx pot0opt mi3iys aDuluvon(4arxomo io1latraueol(0 exmxm iu4lp e fcsl(farur(m nu1oexn octatfaDeluvsnt)aexnmr3oodla eli i;s srtrxo oodlpenmiviatf rtr( o;o1opx ioeiys s emn snu) reomf ia1opD aivs;s texo(opoy4aleelfcil(  rtaxm ;t0tpeomf3tlt s em(vs (0trenmf3oytfatr ivi t seuoxopiodlmee nei t) rrr(rpoo4apx ifetls m2rln pn() rerio3iotfaD lueo;t0s2umxmpiudlltnlict sfs2trumpnt1tlt  f3iatls2rlu pn(4arxnio3io1lm eaiesls0 rxm(mpoydomtnlnvsatfa2tr(m ;u0tpe  ictltfm2ulnvs;u0alenmocootlp rauvs t0s2urxr nodlptn ivslsfsDraump;t0tleomf3iasfa umnvs t) exoxf iy1omtranvi t) 2xrim iudaptnlfesatfsDtax pnt0aee io3tldfm rl(vsnu4artrmr3tydfpte i o ( teurirpny1lltnlfvtls  Dua( p;o1aetn o3tasfa2ul(vp t0 rxoio3tadfat anei s trurxo3oo4llt mfvslt) 2umxm ou1apeo feils mDranvont4teermrciodfaDeaueil(0srtoxopoodlltn nvt ( srra( o;t4alxo oeildla umnmp;()trxrmr3iotla  liesls0 euoir3iydopen iesa(f Dta( oou0apxnii3tysfs ra( pnt4 rtnif iodomDe ueolt0 rtmxm3no1lmeelfvt s  rrr(m no0aee  fcilt m ul(mpn(0 etrir3ta1faDrauvs s srtoxm3oo4am e fcslt)srtrurpnt4apxo oeiysfm um(msnt4 lxoxo3oytlm   u ils0trtoxr3nodopenmnvi s) Dur( pnu4oeenio3iatla ranmp ()arxnircoydlmD livsl()trxm(r ou1omen ies ()s2taump;t1apt moetydfs rluvp;u)arenxo3totlatean slt0sexrxr3oy4ape livslt)arur( pnt1open ieiytfm ua(ms;t)trxomr3tatlm  li s;t)t2uoxm3ny1oltelnct s)srrr(rono0tlxo ociadla ul( p () ltriocta1laD au olt)texrxr iu1amenmfeta( sDta(r nt4aeto oetls m rmn on() lxoirciytoa  lueols srtm(m3ou1lme  nctl( a2taur ot1olxo feiltfm rau p;u4areoif3oo1oateau sls0 eum(rpiy1lleelivtat sDtaxr ;t1texomoctytfs emu o t)aexoif to1late n i (  rxmxm ou4om nmnctls aDum(ro;o1olto ieildfa2ea(vp;t)alxoifctatfm rlnvi;() 2xmimpnu4ap  licsat)arrr( pno0tpt miciasfm2ea( o u)trtoxrcootfp eanvils)srur(m3oodlmeemnes () Dumumono4apxoifctlt m ulnmp;t)treoifciydomD  i ol(0trumim3nudap emfciltfs2rrxmoou1optn feiat a2rmu p;t4 renmr3ootfatrai ol(  rxmxmpoudale mfci sfarrmxm nt0tpxomo3tysla2rlumo t4 renir oydoate i o;()t2tr(m3no4lmee net sfsrtmx oou1apx mi3iydls2um(vsnt4tltrxociotop elieil()s2to(m3iu1amtnlivta() rrau ooo0alxomoctydls2raumont0aeeoio3iatop  aueo;t)setmim ny1llte icta(fa2ta(m nt0tpx mietyt a2rmu s;t4alenmr todfp raivol() rxm(r iudomtnmiesl(faDtm(rpoo1altn o3iasfm2umuvsnu4 exrio3tadlmtrlu o;t) 2xmio oy4llt mnetl( sDtrumo;t4optn oeiydls ua(vo;t4tlxomr oodla  lnvs t)t2trxo oudlle  iet s a2rrx  ;t0tetoii3iatfs rau sn(0tetnmr tadomt  uvs;s) rtrim3nudole  nciltfs2rm( oou1tlx mieiydlm2ra(vpn(0areoio3iytlm rli o;()tetm(mpnu1apt  ncils aDtruroou4opto i3ilsfa2rlu sn()alenif3ta1faD li i;t0 rtoir3oy1omte ietat s2rr(  no1oexn ocildfsDulu p;t4tltoir3oo1lm eauvo;()tetm(o3oydalt mnct (fsDuaxroou0opxn f3iat s2umnvs u4 ltrir iytoa ean i;t)s2xr(rpio1lpt  ncs ()aDraumont1tlx  o3iytlmDuln pnt4trxrxo3totlaDrlnvi;( trumiopio1omen fvslt) Duaxm nt1tpxn i3tltlsDea(msnu4artoxr oatopDeau ilt)s2xo(rpiudlm nlfcia( s2tmu poo0tle micilsls2emnvsn(4artoiociodfatraueils)srumio3oo1lpen ncs tfsrrrx  ;o1openiieiad a el( s () rtrxf oytfpDe nei s0 2urxr3iu1lmee fctat  rur(rpno0opx  f3tys sDemn ont4 lxnio3to1omt  u o;t0 rtr(o no4omeeliesasfartru ont0alt  i3iasfa2ranvont0 rtnxfcootfm  anvolt0t2xmxm oy1lmtemietlt srrm(rpnu1apx mieiyt a emn o t0 rxoiocoatoptrai o;(0 rxoim3nudlp emicia( a2tm( ont1aet  o3tadlm2rl(vs;u)trxrxo tydfate u ol( sexrxm iu4altelfcsa( sruaxront4tpt mi3tltlm2ulu p (0 etoir3todfpte nvo t seumiopnydope lictlt sDrru  ;u1teeniocild sDua(ms t0artnxf3iytoateaieo s) 2xmirpou4om elfci ()a2rax ont0oeeo f3iadlm2umuvont0 exrxf oa1oa eliesl(0 euoxr io4alee fvsltf 2tru onu0oex moctltfs2rmu o;u0 exomo3to1om eli i t0t2trxo nodom e fes t srrru o;u4altnmieild m2umu p;u4aexrxr totfmtr ies;(0sexmxr3oodlpe  fcsltfsrtm(root0oet  feilsfa2rln snt)alxnirciadfpDeau o;s0s2xm(rpnu1al nmivilt)arua(r oo0olx mi3iad s ulumonu)teeomo iy1lm rlieslt0 2trxm3iu4opte nvilsfs2trx  ;t4oltn f3iydfaDranvpn(0 ltrxfcoatopt aneolt s2urxo3nudlmtnmfeslt)aDtm(mono1altnmoctas a2ean o (0tltrifctadfmDrlu o s teurxm3nydop  liet ( arumur ;u0tpe mi3ilsfa2ra(mp t0tlxrxf iadomDe i ilt srxo(mpoo4lme  ics t) Dumurpnt0ope  feiys s um(ms;u4 lxrmf to1lpD anvi (0setr(r3iu4omtnmnvta(f 2tmu pnt1olen oetaslmDrm(mp u)teeoircoa1om rli ilt0srtrim ou1optelfet sfs2uax ono1teeomoetatfsDum(vs;t)treoir3oy1faDeauvi;()tetmxm3iudlme livtlt) rrrxmp;u0olxnmociytfs2ea(ms;(4 exnmf3oa1lpDr nei ()s2uoim3nu1ope miet t arta(m no4olen i3ilsfm rl(ms t)altrmf3iydfate ieils  2uoxr3oy4ol nlivt () 2tax ono0tet  f3iys m2umnmp u0 rtomo3tytlmD  ivs;( trtmxr3oudapeelncsat)aDrr(moot1tpt ifciadls umn on(4teenmo tytoaDrli i s)t2umir ou1open fctas)a2uaum ou4teeoifciatlmDumump t)aeeomfcto1opte u i;t)s2xo(o3iudam n ivs tf Duaxmpou0apt  octlsfm uluvp;u0altriocoo1lptrlneo t seuoimpoy4lm n nvs () 2rr( ooo1aet mfcild a rl(vsn(0tlxnir3tytfpD aueo ( t2umirpno1amen ivsa() 2rmumono0tlxnmoeiytla rl( o ()altrircoatfpD lneo ()s2xmir3iudlmt lici sfsDtr( p;t4aet iieias sDumn sn() rtrmr tadfpt an i s) etmxm oydomtemies t a2umumo;t0aex mfeiatla rauvpn() rerir3iotfa rau i t0texmir3ou1llenmfeils)srurx  ;o4tlxoiociasfsDra(msnt)arxnmocoytopteln i t0 exmiopou1opeelncil(f rrrxmp;u1optnmfciasla emnmont4 exnmo oytoatraieslt0 rtoio oudole lnetat arraum ou4texoiictytfs2uanmo u4 reriociatfaDrai ils) 2xoxo iydoptemfcsls aDrr(  nu1opxomi3iasfm2uanvsn(4tetoxo3ootfp e iei;t0srtoxr oo1lmtnmfvtlt  rra(mo;u1apenmieiysla2rm(vp;t4 exrmociotla eluvi;t0sexrim iydameelnvsl( sDrmu  ;u0aet  oetysfsDeaump;t)trxnmf todfm eanvsl() ruoxr3io1op  liesa()aDra( ont0tlt ifciad mDua(vs u4 rtrirciatop  lieo;s tetrxo3oudoptnlivt s s2ra(moot4alx io3iaslm emu snt0treoir iydomtranvi ()texo(o3iu1ale lfvtasf rtm(root4apt mi3tad sDra(msnu0 eenxr oo1lmDraneils srurxo3oo4omt lncsa(  Dtaxrp;t0apxomi3ildfs2uaumsnt)trxniocta1laDrai s;s) 2tm(r oodamt  nvtas a2rr(r ;t0aleomieils s2rau onu0 lenmrciodfmtrluvils)setrir iudopee ici (f 2ur( o;u1apxomictlt aDeanmo;(0arxnxr3ia1om e uvilt t2tm(m oy4lp e ietl()arra(rpnu1tlxoiocias m rau o;t4 ltoxrcoy1fmD aivi s0srumxrpiu4ll  mivslsf ruaxrooo0tpen f3iltfm2elnvs;()altoxfctatlaDrlies;t)s2um(r3iy4om n ncsa( aDrax pou4tpt ifetatlaDulums;u0tlxrmr3iatomteaneilt  exmio3oo1ap  mivtat sDur(rpot4apxomf3iysls rmums t0trxrmr3ia1fm   i i;()setmxrpny4lleelneilsfa2ta(rpno1oeenmoeils s2ea( on()texriocoo1laD auvolt s2xm(opou1ll   nvsat) Draum ;o1apeo iciydfa2em(mo t0texnmr tadoa e n ilt) 2uoxm3oo4om elfcsa()s2tmxr no1tlxomo3iyslsDea(vpnu0tlxrxoctatfptr uvo (0trxr(rpoudop n fciat)aDtrur ou4oee  octltlaDra(vo u) renio totoa rlivs;s) eumxo iu1ll emnet t  rtm(rooo4tlx iicilt m ea(msn(4tleoxrcio1fmDr i o;() eurim ny4optnlnvt s)artau ono0tpeoif3tysls em(msnt4aexnmrciadfptrlieo ()srtmxm oy1alenlfci (fa2trumonu1apxomiciltfm2rl( p;u) exoxr iydfpDelieolt)setm(rpiy4omtnlnctas arrax  nu0oexomo3iasfs2eau o u)teenir tatop ranvols  eur(r3oodlp nlfcs s  2tmxronu4aet mfeiadfmDranvo;t) rtnmo iytlm e u ols0setm(mpnu4amt mnvs t a2taurpnu1tle iociysfsDelu o t) eeoxoctotfat  ieo (  rxrir no1lle  ivtasfaDraxm ;o4alxoiieiydlm em(vo t) eenmocio1la e n o;(  ruo(m oy1omenmnct tfa2uaur nu4oltomo3ilsfmDranvs;u0aeerxr todla   ivi;(0texm(r3nu4lltelivs () 2ururpou1opxoioeiadfsDrlnms () leoiociy1lm r uvols)s2to(o3oy4ll e ncs ( arua(  nu0apt ii3tldfa2um(mpn()alxnxf ia1faDr neil(0t2xriopoodame lnvils  ruru pot1tee ioctldfa eau p;u0 exrxf3tytom e n o;s  2umim iodol elfctat sDrm(ront0aptoifeiatfs el(vo;u0aetnmf3todlm  livs t0srxrxm oydal n iet () rrauro;u4apen f3iatfa rmn pn()trenir oadlaDe ivol(0 rtr(r3no1om   nesa(  2tmumpnt1tpxnioeiasfs eanmp t4trtnmf tytoa   uvs s trum(m iy1oleelneiasfaDurxmont4olxnmiciadfa2umnvonu) rtnmfcia1lmtraieslt)seurir nudlmt lnesltfa2ua(roou0teenmf3iyd aDem(von(0tetnxo oo1oaD li s;s)setmim3oy4amtemicil() 2urum no4tpe mieiasla2elu pnu)texnxo3iydfa raivo;t t2trir3iy4llenlietlt  ruaump;o0oeto i3tadls rm(vp (4trtrxocta1op  ln s;s trxoxo3oo1llt  iesat  rurx  oo0alenifeiasfa2rauvs (4alxnif iotomDe uvsl(  etr(mpoo1am  lfciltfsDumur ;t1alen octldfmDuln o;u)arxrxo3ty1op rai i;t0srtrxm3nu1alenmnesas artmu o;o0ope moeiaslm uanvont0arenio3oadfaDrlnvo t tetrxo oo1amen fciat sDrrx o;t0apxnioctys sDuln p;t0tlxnxo3iatoaD au s;( setoimpnodal nmnvt s)a2tr( oou4openmo3tlsls2ua(mpnu)aexnmo3iodlm  livs s0tetmxr nu4al nmfvt s)artax p;t0opt  o3iasls2ran s ()artnmo3iytfptelu s;t s2xr(o3iu4ameemfcs (f rtrurpoo1alt iiciyt a2ul(ms;(0alermr oodoa rauvils0 exrim nudlm nmnetl( sDumump;u0tetomfeiydfs2uauvsnt0tltrio3tydfmteanvil(0s2uo(m3ny4optn ncs ( sDrmx onu4oltoif3iltlsDeauvo;t4artrmf iotom eli i s  etmxo ny4ap nmfesl(f rumu p;o1oexnmieilt sDra(von(0tetnif3tydlpDeluvs () 2xrxo3oodlpe mfvslsfa2raurpou0teenmo3ildfs rau sn(4tetomr oodfm   n i;t teuoxm oo4optn nvil()a2urxmo;t4tex mfetadfa uauvpnu0tlxrmf3oatfmt lnes t) 2xo(m3nodom emfvs ()s2ua( p;t0aexo feildfsDeaums t)tetomr3oatlpD  n sls) exoxopoydlpeemiei t)srtru  ou0texnio3tys a2rl( s;u0altoxr3iatoatrlies;s tetoxo nu4am elfcs ()sDrmxr nt4opxn oetytlmDrln p t)aeermfcia1lptrli sls  2triopoy1ale mnvtat  rtru  ;u0alen fciat aDranvp (4alxnxo3oodomDelivs;( truo(opny4lpte ivsltfaDra(m oo4tet io3iltls ra(vp ()tlxnxf ia1omte ieslt) etoxmpio1lmt lnvia()a2rrxrp;t0oex mfeilsls ranvsn()arermfcoy1fate n s ()sexmxr oodope mnciatfs2rru pnt0aeenmoeild mDuanmo (4teeoiocoytfpt aues;() etr(rpno1op elict s)s2rru o;o0tptnmi3iyt sDrl(vs;u)tlenif3iytoa   ivs s0srxrir3nudal  mict s)aDtaum ;o4tpenio3tadfs ul(vo t)aexrmf oatfpDr n o;(0teur(o3ny4opee nvsltfsDurumpno4aet  o3iyslm emnmo;t4 exnifcoa1faDean ils0 rumxmpiudole lncta(faDta( oou0olxomo3iysfm2rmnmon()arxoir iadomDr uvo ()trtrxo io4ale mfvt ()srraumoou1oltn i3iad a2eau onu0 leoircootlpt  nesls s2xrirpny1lpt  ieta(fsDtaxr ;t0apxn oeilt mDra( p;u) eenif3iotopteaues;s)texoxr3oodlptn fvi (farrm( o;t1teto oeiat sDemuvpn(0 exnir3iodfm  aivi;t tetr(mpny1olte fvil(fs2rm(r no1aexoiieiyt s2rmums t4arenif3iydoa rlnvilt0trxrxrpio1altemnetlt)artax  nt1olt  ieiltfa2ua( p u)texrir iotfateau slt tetrimpiy1omtn feilt aDrmxrpno1ole mi3iltlaDrlumsnu4 leomrcto1op r iei;s0s2ur(o3no1al   netls)srrmur no4alx iocilt s2rm( p;u4 rtrxr oodla  livi;(  etoxr iodllt  nct tfaDrm( oou1olx mfeiasfaDea( o () etnxoctodlm  li i s) 2toiopny4ll  lfcs (  rrax o;o1tpeoifciat s2eln onu4alxrmocoadoaDeln olt0 exo(o oo1ale mncs t)srtrumo;t0apeoiiciad s2umuvp;(4trtoxr3totfmt livo;t) rxrir3oudlp elfvils) Dtruro;t0tex iociytls em(mp (4 lermr todlm e nvo;s truoxm nudame lfesl(  2urx p;o4olxn ictltla2el(msnt) rxniocoa1oaD anvol(0s2umxmpiy4ale lies tf rtrum ;o1aeeomiciyt mDel(mpnu) rtrircio1optrluvolt0truo(rpnudlp emfeslt s2tm(m ;o1apeoifeildfm ea( pnu4 leoio tatopte ueols  etmxm nu1al   feils srur(r nt0aleniociytfm2ulump;u0aexrxo3todfmD li il( t2xmim3ny1olt mnes (fsDumumont1tetnio3tytfm2rlu p (0teenxr3iy1fpDelieolt0trur(m3iu1lmen feiltf Drru o;u1tlx  fctaslm2ra(vp;u)altoxoctydfpteaneolt0t2toirpou4lmtnlici tfs2tr( o;t0tlt  ictytfsDuan s;(0texrxocia1lptraiei s0 rto(o3iu4opt  fet (fsDtmx  ot0oex ioeias aDemuvpnt) reomrcoodop rlnvo ()t2xmxo oodoptelfvia(f Duru p;o0tlx iiciysls2ulnvo (0 etnirciadlatraneils)srxr(rpou1ole  nvsa( a2rrurpoo0tptnmfctad m2ra(mo u0alerxf3oatfpteauvi s s2to(o3oydlptnliviat a2raxmooo1altnifciytls2rlums u)altoxfctatfmD au i;s s2ur(rpou4lp nlicils sDrr( o;u4teenmiciltfa emn p ()tetnifciodfmte ivols t2xr(o nu1opte fvsl(fa2tm(m nu1olxoiieiydla2ea(ms;(4tetnmfciytopt lu s (0t2urio iydoptn ici t)s2ta( oou1tlt  feiydfm2umnvp u0tetnmf3ty1la eaies;t0texm(m ny1optn net ( s2ta(m oo0tleomocildls2um(vo;t)aeeomfcoa1lpDelivilt0s2trim oo4amt mfvils  2taurpoo4teen fetatls umumsnu0aetrxr todfaD an o;t0s2xoxo3iydlmtemieslsf 2raur ou0tpxn f3tydfa em( o () reoxrctatlmD ln il()t2xoxmpoo4lpen feta(f rtaxrpno4aexn f3iadfs2umnmon(0 rxoifcoa1faDr n s ( trtoimpnodol  mfvil(faDtmxm nu1ope  fcilt s2umnvo;(0altrif3totom  lu o t0tetoxmpiodamtnlfes s)sDtm(rono1opx mi3iadfm ulnmp;(4 rermfcoatom r nvils0 rurxm3io1al nmfet s  rumu ooo4tee iictlt m2elnvo (4tltoxr oodomDrli o t trtmim iu4ol nmicslsf rrmx pno0open oetltlaDelnmpn()arerxo iatfp  li s;t)tetmirpoydllt lncs s)aDrm(m ot4tetniictatlsDul(vs;u)alenmocoo1lpDr n s;t0t2uoxo iu4ole liesa(fsDta(ro;o0teen fciatls uaumon(0 rerxfciatlpDe u olt0 2uoxrpio1lptn ictltf Dtmxro;o0apx moeiadfa2rm( o t0arxrmo oodlat anvi;t0texo(o iy1optnlfci ( sDrm(rp;o0ope  ocias s2rl(ms ()trtnir iotomDrln s;t sexoiopiudll nlfctas a2tax  no1aptnmfciatlsDrlnmo;()tetomo3iydoatean s;s)teuoio iy4olt mfcsa()sruru o;t0oetnmi3iysfa2emumo;()tlerxociy1om rlueslt trxmio iu1amtelivs tfa2tau p;u4alxoiieiytfaDemn s;t4 rxrmfcio1laD aieo s0teurxmpnu1lme  nvsls aDta(r ou1aee mfetls a2ulnms (0trxnirciatlmDe n s;s)trtoirpoo1amte nctls)sDtmu pou0apenmf3tadfs2eanmo;() reoif3oatfpDe uesl(0trxmir3ou1oleelneta() Drmxmpou0oexo octytlm ul(ms;(0artrxo3oydlat  ieo;s0t2toir3io4lltnmfct ( srta( o;u4alx mo3iatfm2ranmonu4tlenxfctodoa eanvi;s0 2urxr3oo4llenlici (f rrmumpnu0opxn o3ild mDranvsn(0tltrmr3oa1fmteaies ( t2xmxr3ou4lltnmfcsls srtm( p;o0tlxoifciys sDumnvs u4areoxf tadfptrai o;s  exmio3oy1al nlfvi (f Duru p;u0alxniociytfm2raump;u) ltrxrctodfat auvs t t2trim3iu4lmte ivils)srrru p;u1texn feiatlsDemn pnu)tlxoxfcoo1lmt  nes s  euoxrpnu1om   iesa( aDumx p;o4teeomiciatfs rluvs;t4 etrmf3tytlmDelueo;t)trtmirpou4omtn fes (fsrrr(  nu4ape iieilslm2rln snt4 exnxo3ty1latr i ol() eum(mpiudlpe lfcsls  rtmx  nu0tltn i3tysla2ea(mp u4tetomociodfmDr i ol()t2uo(o3io1ope miesasf 2uau  ;t1oeeo iciasfmDrl( p;t)tltnmrcootfa  lnvol(0 2uoim3nu4ape mfcta(  rur(mpoo0tle ifeiyslm2rauvp;t4aexnmf3tadlaDr nvilt)srtoxm iudom  lfesatf 2ra(r nt0opto fcils s2eauvsn()arermo3iatoaD lnei s sexo(m io4am nlfvilt)artaur ;u4tltniociasfm2em( p;u4trtoxf oydlmDeanei ()s2tm(r3oudll  lies () Drr(mpnt0tle  f3iytfm2rln p (0alxrxf oadlmtr u sl() 2toirpoodol nmfcs t a2rmurpou4ole iieiltlm ulnmo t) rxoxr oytfpDe uvo;()t2uo(m nodop emncsatfsrur(rono0olto ictatlm eauvsnu)tetrxr ia1fm raueolt0t2xrxopno4ap n fcsat)s2ra(r ot4ale  ociad a2um(mp;(4aexoxf oy1lpD lies (  2uoiopno1ole mfcslt)sDtmx pot4aeeo i3tldfsDem(vp (0 etnmo iy1op e uvs;t tetrim iu4apt  fcilt s2ta(roou4tptoifeiysfsDra(ms (4arxrmf oy1om  lnvs;t0srtoim oudaltelietls)aDrr(ronu4aeeoiieiysls umn o u0teeoxfctotlmteln o t)srxrxr3oydlmee ivt ( arta(rooo4oleomf3iyt m uau o (4tleoxo tytoat lieilt sruoxopio1apeelfcs t  Drr(mooo0tlt mociytfa ua(mp t)teeoxf3iydla elnvs;s trto(o no1apt mieia(f rtmurpou4alt mo3iys s el(vpnu0tetoxf3ootomDr ivo s0 etmiopnu1ape mfci (  2ur(mpnt4tptnmi3iltls um(mo u)trxomocta1fa elivs;()s2toio3nu4ll elnviat arum(mont1opeo feildfs2ulnmp;t)arxoxrcoa1op e uvo;(0s2tr(mpiodlptnmicsl( aruru ont4opxoiieiat mDelnmonu0trxrxo tydfpte n o ()setr(rpoo1olt mfes t) rrm( p;t1tpe  i3tlt aDua( s u0 lxrxfcoodlp raneils)s2xoxm3oy4alenlfcil( aDtrumo;t0ole moctat mDelu s;u)trtnxrcootfpDeau i;( sruriopiudopt lfvta() rumxrooo0aeto f3iytfm2uan p t) ltrxf3tatlp eauvi t  eto(o iodlmenmnei (f Dtau  ;u4oeen oeiyslaDel(mp;u4trxrif3oa1faDe u olt)tetoxo ny1ame  fvsl(f ruaumono4texniieils m2umumo;t4areomrciotlatelueo;(  2triopnu1lltnmneil( s2tmu  no4apx  iciltfsDulnvp u4 lxoio iy1fpDeaueo;t) rxoxm3nu4lltn fvsa()aDtmxroou4oexoioeiasfm2uanvo t0trtrmf3totfat lnvilt0trum(o3ou4omtemfeiat)sDtau pou0opx  oeiytfa2ulnms;t4aeenif3ootfa rluvo;( trxmir oo1ll elivslt srrmum no1aeenmociatfm2rlnvpnt) rxnif iadlm  livi t  rtm(mpoodaltnmiesl()s2rru pno1opxomi3iysfs2eauvp;(0alerioctydlpDr u il(0t2xmir ou4al   nviasf 2rm( o;t1aptnmf3iat sDum(mp;u0aeerxf3oatoa e ieo;s seum(m iy1lmtnliesatf rtauro;t4aeen ictaslaDul( snu)areoirctodopt livi s0 2ur(m3iudol nlncsltfs2rr( pnu4ole mfciys aDulu pnt4alenxf iy1la  ai ol(  rumxm3oy4omte ivsa() Drm( p;t4tltn fetld aDrmumo;()alerir ia1op rln o;s)trxoim3ou4llt licil(farrrxmono0tpxnii3tys aDelnmo u4 ltoxr iotlptranesls)srtr(o no4am  mnvtl(fa2rm( ooo4tetnmietyslm2rl( o (4aexnxo3oatfmteaivolt)trxoxr ou1lp   nvtl(fsrrmx oot4texnmfetltfsDul(mpnu)teerif3ootlpt lieo;t)trumxm nudolenmivsat s2rmu  ot1tpx ifctyt aDua(vpn(0tleoxf oa1la eln o;t)tetr(rpio4aptnmfvi (  2tmuroou4altoiieiytlaDrm(vsn()arermo3tytomtraues s s2xrxo iodlpt lfesls)s2rm(rpot1tleniietys m raums;(4texrmr oytlptr n ols0 euoxm3ou4alenmneta()aDurxr ou1apxoif3ils m2ulnmpnt4areomfctydopDrlueols s2xrim iydamtelnvs tfaDuaxm no1aeeoifetadlmDul( p;u0texnxo3totfmDrau s;() euriopiydol  mfes t)arrr(mpnu1opxnmi3ias m ra(vp;u0trxnmf3to1lpt au s;() 2xo(r iydlmtn nesas)aDrmum ;o4teeo f3iltlm2emnvsnt4treomr3iatla   u i s  rur(m3iodlpen fcsasfs2uaumpnu1ale  f3tyd sDua(vo (4 rxomr ta1oaDrluvslt)trxoxopoodlle lfctasfa2rr(rpnt1optniociytfmDulnvs;t0teenif3iydom   u slt0 2uoxopnodlm   netlsfsrtaxmo;o0oex  i3iltla2ea(mp;t) rtrmf oo1fpDeln i s)srxm(m io4lpt  ieilt)sDrr(  no4ole io3tadls2ranms u)arxrmf tatom   uvol(0s2tr(r3oudomeelivtl(  rurum nu0tpxomo3ilt s rmnvsn(0 reoxr3ootlatrli s;t seuoxm3nodam elnvtl(f 2tax  ;o1aet  f3iasfmDraumo;(0texnxrcootfmtr u i t0t2trio oydlmtn nctl( a2rrx onu4texoif3tys s rauvp;(4tetrxo oytfateln s t setrxm oy4lm n fei t  Dum(m nt1oexn i3ilsls2rlumsn()arxrir3iotfpteluvi;s0s2xmim3iy1lpeemncsatfaDumumpnt4texn iciysfs2ra(mp u)aeeomr oydfm raueolt0s2uoim3iydolen ictls) 2tmxmonu4tpxomoeiydfm el(mp u) rtnir oadopDr n olt0 eurir nydlme mietasfsrtmxrpnt4oltnmoeiydfm elnmpnt0alenxfcoatfat lu i;( trtr(rpny1am   ivt tfaDua(mpnu1tetoif3iadls2rluvonu0arxoxoctytfm elneo;s trtoim no4apeelnvil( sDrrumo;t0tlxoifetytlm2rluvo;u)trtrmo3ootfm  aneslt)s2to(rpiodomtelfvsltfsrrr(r ou1tltoii3ilt a2rlumo;u4aexoxoctadfa raieolt)texoxm oy4lm nmneilsfartrumpnu1opx  iciatlm rlnvs t4trxomfcty1fateauvo;t0setm(r oo4lmte ies t)s2taxmpnt0tpxniiciat m rmnmo;t0tltoir ootlmt anes;t0trxoxo iy4lptemfct tf 2raxm nt1ape  fciltfaDrln sn()arerir ia1lm elu i ( srurio3oo4am nmneslt sDumur no1apt moetas m ulu s;t0tetrxf iydfaDe ies;() 2trxo3nudlp n fei () rrax o;t4aex  o3ildlsDuan p ()aetnxo3oa1fa raueo;s) 2xrimpou1amen net t)sDtaum ou0alenio3iytlm2ean o;()aexoif iydlptraivs;(  etmirpiu1am   fcslt  Dumx pno1teenmietyd s uau p;(4texnxocoa1op ranvs s truoir nydlpt lnct t aDuaumonu4aexnifciadfm2ul(vs (0texrifcoy1faDr n ils) exriopoudop n ivta(fsruau p;o4ape  oeiasfa rm(ms;() rtrxf oy1lat lueols0 rtoirpno1lmen netat  rtrxrpot0ale mictlsls2rlnvp;u4teeoifcootfptraivil()trumio3iu4al nmfct t)aDtm(mooo4tleo feiatla2ul(mpnu4arenxf oy1lmDr ieilt0 rumio oudop nmivi t) Dta(mpoo4alx  f3ild s uanmsn(0texrxfcoo1fm rlueo ( sexrxm3no1om e fvs sfsrtaum no4opxnifcils sDea( o (4alenxfciy1optran olt tetm(mpny4lltnlfet s arururono1olx  feiadla2uluvon(0aetnmo3totomDranvs;t)trxoxm ou4oleemnvslsfa2raump;u4alenifeilsla2emn s;t4 eenmo iotfm   n i;t0trxmxm3oydape mivi (f Drrxrpno4oexnmieiyd s elnmsn()trxrxf3todlmDeaiei s0seumxrpoy4ame  fcslsf Dua(moou1apt mieiaslm eln snt0arermrcto1lp raieol() rxr(rpoo4lleelneslt srua(mono0oexnii3iysfs2elnvo t0aeenirctatfm elnvs;t) rxoir3io4ape mfcsasf rrrxmp;o4aeen iciyd mDemu pn(0 etoif3tydfpDr n s;s  rxrxm3no4lme  fei ( a2tr(  no4ole ifeiyt s2uluvon()arxnir3iytlat ln s t) 2toxr iydam  mfctltfa2uax  no4ope mi3ildfa2um(mp ()altnxf3oy1fmDeaiei;s  2to(r nydam elnvsl( arrmx onu4openiicilsfm2uau s;u)teermo3tydlpD anei;(0s2umio nodalenmiei sfa2umu pno4olenmi3iytfm rmuvp (0tltomr3tytopDeau ilt srtr(m iydal emnvi (f rrr(mpno4alxn octys sDemnmo (4altoxo3ta1fm e nvsls0srur(o3nydoptnmnesl( s2umu ooo0tet  iciyslm emn p u) eenxf oatoptrln o ( t2urxmpou1lm  mfctasfa2rrumono1olxoif3ildfs uanmo;t)artomrciadoat ai o;s) exmxr io4ol n fesat)a2tmuro;o1tetomi3ild m el(msnu4 renif3oydoat au olt)s2tmiopou4aleelfes t artrumpou4ape  oeiydlm2elumo u4 lxrif totfp   neolt t2xoio oudopt livtas srrr(mont0optnif3ils s2rm(vs t0tlerircio1omDrau s;(0trtrxr3oo4olenliet s  Dtr(  nt4texoifeildfm uan s ()aexnxr todfm elivo;( sexm(o3ou1lmt  fcia()a2uax ont1oexnmfcildfs ulump;u)trtniocoadlm rai olt seuoxo3oo4lp  mnvia(fs2rr(rp;o0opxnmfciytfsDulu o;u)aexoxo3oadom elnvi;t0trxmxo3io4olte ivtl(  rur(  oo0olxn iciydlm eln p;u)trerxr todlmt anvo;( seur(m3io1optemnvtat) rurxr ou1texn ocils sDul(mp;u4arxnir3totlaD lieo;t0 rtoio no4lme  nciatf rurx  ;t1tpxnmociyt a rmu p;t) rxrxr oa1oat  iei;t) exo(r iu1ol  livt (  Drmx p;u1aetniictat s2eluvpn()aexrxf to1lptelu i;t0teuo(o iudlm e fcs s  Dumur ot1oexn fcild a ua(vonu)tltrio tytfmDrln i;s)sruoxo3no1al n nvs tf ruaumo;t0oex micildfm2emuvs (4 ltnmf3oytlp   n i s)seuoirpnydlptnmfctltf Drrxrpoo4aeen octysfm ul(monu0tetoio3iytfpD  ues;t)t2xrxmpiudape  nei t) 2tm( p;u4aleo ietas m ea(mo;u) lenxr3oydlm r nei t0 rur(opnu1lltnmieslt sDrmurpot4aexn feiasls raumon(0 rxrmo3io1omtean o (0srtmio nudop nlnctl(fa2urxrp;o1apeo oeildls2rl( p t0trerxr iydop  aueo;()teuoxmpno1op elfvt ()sDrmx  ;o0tltn i3tydfmDeanmp;u) eerif tatopDrln il( t2tr(m io1ap nlfvt t  rum(r ;o0tex mieiysls ulnmpnt4aetniocoytlm   neols)sexm(opnudop  mietlt arrrxrpnu0opxn feiysfm rl(vs (0tltnmfcoa1lptean i t t2xriopiydlpeelnvsatf Drmumo;o1opt ifciat s2eanmo t4arenxo3to1optraneo;s)s2tr(opny4lpt  fvt s)aDtr( ont4oeeo ictld a rlnvp u) exrmf tadfa rlu sls)trtm(rpnydam nlfvs () Dtrum ;o4optnifeiytfaDum(vo u4 eeoxrctydfa raivs s0t2urxo3oy4amtnlnvsas)arrr(m oo1oleomi3iysfmDea( s;t0texrmfctydla  anvi s t2xoir3oydalen iesat) Duaum ;u4texomi3iysfm rlnmp;t0arxnxociy1fp  aueilt)s2xo(o iu1lltelncsl()s2tmxr ou1altn icias m2uau s t)teeomoctatfaDelnei;(0 2umxopoo4llt micsa()aDur(m ;t0oetn feiltfm eln ont0 rtniociydoaDrai o;t)s2trxo3nu4ope  fei t  2tmxrono4optomfciltfm2rmu p t4aeerxrcoodfmDr n ils  2toim ny4alen fvtas)s2trx p;u0tlenifetytla uluvsn(4aetomo3tadfm   ivs;t  2tr(m oydaltelicilt)a2taum oo4tle  ieiysfm ranvpn(4arerio3oytlpDeluei;s  rum(m ou4alt  fetls)srta(rpnu0tet  fciatlm2em(msn()aexrmr3oy1lp eau o ( tetmxrpoodal nlnes s)s2trx  nt1texoifciatfsDum(ms () etnmr3ia1omD aieil(0t2tmir3iydll n nct s)s2ra(  oo1oeto fciasfa2emn s u0treomoctodfa eaieo;(0t2urir oydlmtn fvtl(fsDtm( oot4tltoioeildfmDeln pn()trxrmocoy1lpteanvo;t)trtm(m oo4olee ietat srtaurp;t4tlxoiicild mDrl(vonu4tetnmocta1fa eaies (0s2tmio3io1lmt  fvt t a2tmurooo4optoif3tytfm elnms;u4trtomrciodlp   iei;t teumio3iudomee fvt s)sDurxr nt4olenifeilslaDrmn s t0texoir oodfate i slt)srurirpny1ope mncsat s2rmu o;u1opx  ociyd a2eanvsnt0 ltrif iydlmDelnvs;s0 2umxo iudlpee feiasf Dtau  ou0optn i3ilt mDum(ms u)trtoirctydlaDr ieslt0srumiopnu4llenmics t  Drmxrp;t1aexomo3ilsfmDrmnms (4 lerxrcoy1lat  iesls)truoxo oo1ame mivs t  rtm( o;u1altn ieiasfs2umuvon() eenmfcia1opt livs t texoirpoo1al  lnvt s)srrmu p;u0aex ioetatls2emuvo t0alxnxo3oydfmDelu s;( srtrimpou1amenmfvt s  ruax  ot0alxomo3iyt s rmnvpnu0aetrifcto1fmt  i ilt setoim oodlme livtas) 2tmu ooo0oltn oeiydfa2rlnmp;u4 rxrmr io1omDeluvo (  rxo(rpiu1alt lncilt)sDua(mp;t0texniiciyt sDua(vo;t0trtnifcoo1faDrlnvo;s0trtoir3oo4amtemneslt)sDum(rpno1alx iociad aDul(vp;(0aetomf3oodfm e iei t0tetoim3ou4optelnvs t  rtm(r nt4tlxo feils m2elu pnu0trenmf iytfatelu ols0tetr(mpnudopenmivsltf 2trxroot0alt ioctlsfs emumo (4aetnif tatlptrai s (  2urxr iudol  livt sfs2ua(rpou4alx moeiatfa em(vsnu4aetnio3iotoaDr nvilt)s2xrxr no4amtnlfciatfs2urxmono1tltn fctaslmDra( pnu0trtnxr3oytoa elnes (0tetmxr iu4omt lnci t arrrxmp;t1openifeiatlaDumnmo;(0artrio3tadfa raues s) etm(r3iodameemfcias  2uru  ou0apeo o3iatla ranmo;u)arxoio3oodom rlu i;s)t2xmxm3ou1om nlfvsl(f Dtr(m ot1tptnioctad a2eanvp t0 exoif io1op  ln o t0trxr(o no4oltelnvtls sDuaxmpnt0oeenmieiydls elu s;(0arxnir3tytfaDranvo;s srxoim3oudop  livslt a2rmuro;t1apeoioeilt a2emu snu)trerxr3iodfat anvilt  2to(mpoy1lltnmnvil(fa2umxmo;o4tleoioetltfa2emu p t4 ltrio ty1oaDeauvo;()t2tmim oy1lm elnvia(fsruru pno1alx mociysfaDrln o (4 etoifciodom   nvs;s0 eurxrpnodaptnmfci tfs2tmx  ;o4altnif3iysfaDua( s;t4tetrxrctytoaD  u s;(0truoxo3ny1ol elneiatf 2tru onu1aexn ociatfs2raump t0teerxr3tadla   u olt0seur(r3oydapeemfvi t)sDra(mp;o0oeeniiciasla2ea( snt)alxoifcoydfa elivol() 2xo(m3iudamtn fciltf rrmxr ot0tlt iiciaslm ulu p;u)trxomo iatfatr uei t trtrir oy4aptemnetas  2urxr ;u1apx  ieiadfm2uanvo;u) lxoifctydfmD lues;s) etriopnu4op n net (f 2um( p;t0apt ifctyslsDrau pn(0aexrio tytfa   ueol(0s2uoxrpnu4ale  ietatfsDrrx ooo0alto i3ilslaDulu s;t4artnifctotlpDr nei;s  rxoxm3iy4am n fciasfaDrm( pnt4opt  i3tldls2el( onu4 renio oytlpDe i ils)trxrxo iu1am n ies () Drmumo;t0opxomfeilt m2ra(vsnt4tlermf3tydom eaivols texmxm3nudame licsas)s2tax pnu0alenii3tysla2rau s t) lerxfciydla ranvi;(0 rtmir io1al   ivs s) Dtaurpnt1opeomoetatfm eanvs ()arxoircoadopDeluvols)texoir io4ope lnei t)aruaumonu4tlt mfciyslmDel(msn(0trenif3oo1opDr nvo (0srxo(o3oy4ope lneilsf Drmx ont1teto fctys sDemnmpn()alxrxf iatlaDeaneo;s0 eurio3ou1llenlivtlt)a2tax oot4oetniiciltfa2rmn onu0alerircoydoateluvils trxoxr3ou4op  lncsat)a2ua(mp;u4teto f3iytlm2ulumo t4aeenio totlm eaies;(0srxoxr3iu4lp e fvilt) rtmxm no4aexnmo3iltfa2ul(ms;(4alxoxocta1oat aies;(  2xmim iy1altnlivsltfa2trurp;o4tlt  icilsls2rm(vsnu)altrxociatopD lieil(  rxmxm3oydameelfcta()s2tr(mpno4tltomi3ils mDrl(vpnu0treoirciadlpD  ueslt0srur(r iy4ll  lnvt t) rur( p;u4alto feiyd a2ea( p;(0 lermf iotopt  u o ()srxo(mpnudam nmies sfsDrmuro;o4tetoii3iadlm eaumont4tlxnif iodla elivil( sexoio nodllt  nviasfsDtau p;u4oeto fciltlm2raumo u)tetnmf3iatom eaivi;(0seur(o no4lm  livil(  Drrxmpno0oexnifeiatla2ran s;(4teenmo to1fm elnesl(  etoio3ou4omt lfeia(  rrrx p;o0tltoiietatfm2elums ()areomf3ta1fm e i sls srxoxopnu4ol nmnet tfsrrmx  no1tlt io3ilt m eau p t)teenir to1laDraivolt0s2xoxrpoo4lp e nci ()artr(rpno4aet ioeiyt a emn s;(0aexrif3iytfpD  nesl(0setmir iodlpe  ieilt)sDrrx pnu0tpto feiltfm2ra(ms u4 lxnxr oo1opt ln o s s2xrirpny4amt mfvias  2rmxrpnt4tpen feiatfaDrau snt4aetrmfcoa1fp   u s;s srxm(o3nudamtnmncs ( s2tmxrpoo1apeoii3iltls rm( p;u)aetrircoa1faD lu i;t texr(o3io1op  mfci t  Dtr(mono4oex ioeiad sDem(mp t0aexoioctydlaD  ueo;t t2xr(r iodamt  ncil( artr(mpou0tetnioeiytla emn p;(4teenxocoatom rlivolt s2um(o3iy1omt mfctl( s2umxr no4tetoioeilt a2emnvs;t)aexnxfctydlp  ai s;s  rxoir3ny4lm  mfcs t) 2umxmont0tptnmi3ilslmDul(mp;t4 exrxf3oa1om   u ilt)teuo(opiydamenmict s  Drm(mont4teen ieilslaDeauvs (4arenmf3ty1lmDranvo s  euoio nodlltelict sfa2rax  nt1apeo ociyd s2umumsn(0artnmrciydfatelu olt0t2xmxo3nu1ll nmict tfsDumx ont1optnmf3tldfa2eaumpn(0 exoioctytfa rlnei;(  rtmxo3iydome licil(  Drrum ;t4opxomieiadfa ea(vs u)tleoxrciytfa raieils seuo(rpny1apt lncs t srtm(mp;t1tex  ictat sDuan s;u4tleoxr ta1lpDrlieolt)texrxo3nu4am e nctatfa2uru ooo0oetnmo3ilt s rm(vsnt0 etniociotfp  livs;s0t2uoimpnudllt livt s)aDururpno4tlt  ieilt a eanmsnu)alxnmo iodop e uvs (0t2trxopoy1ap nlfvs t) ruau poo4oeeomf3tat s rm( o t) reomf oa1lmt anvilt0srtoxr no4apt  fci sfarrru  ;t1apt  feiadfm2rl(vont0 rtomrcootfpD  uvo;t)trxoxo oo4op  lfvtlt)srrruroou1olt ifcildfmDrmu p u4 eerxfciytfa r ivil(0 rtr(o3iydop emfeils)s2rm(moou1altomo3tls a umuvo;t4trxrif ia1lmteanvs;t0 2uo(rpoodal  mnvt ()aDrax  ou0alx if3iys m2umumsnu4aetnmr todomtrln ils) rtrim3ny4am  mics s a2tr(r nu1tpenmietytls2eauvonu0aexrmfctodlpDr uei;s)seumxo no4amenmivt tfs2rrum nu1aleoifetytfs rl(msnt)arxnxo iadfmtrluvol()trur(opnudllte ivslt) 2urxmooo1openif3iyslmDel(vpn(4aeenircto1fptr i i t teuo(r oy1olt lfci sfa2ur( o;t4teeo fetlt s eanmon(4arxrmrctytoa  ai s (  exo(rpnu1lm e fvs (faDrm(ronu4tlto iciatfsDulnmpnt0texnif3tadfaD aneo;() 2tmxm3nydllte nesl(fsrtm(r ;u4tpx  f3iydla2ul(msnt4 lxrirciotlaDean o;t  etoio iu4openlfcs s)arraump;u0aptomf3tydfs2em( s;t0arxrio3oy1fm e nvsls) etrxopoodol  liviasfaDtrum ;t4aeto ietytlm eln s u)aetoxo3ootla eai il()s2xm(o nydaleelnesas s2rm(rpno0texomoctltlm em(vp (4 eeriocia1fmteln o;s0seuo(mpny4omen nesasfa2tmumo;u1tet mfeiytlm emnvs;t0teeoxr oodfaDr nvsl(0trxoio iydaltnlfcsas) Dtmxm ;u4opx mf3tld m rmn p u0arxnxf tatlp   i i t)seur(rpno4ol  mnes ()aDtru  ;u1teeomfctaslm2ra(mp t0texomrctodlm e ivs s sexm(o3oo1lpt  ivsas)aDuaxrp;t4aex  i3tlslaDeanmp;u4texrxfcty1lmDraieo s)sexo(r3oy4ap nlietlsfs2rrxr ;t4oeeo iciyd m2ranmo;u4 ltoio3oatopDe nes;(0s2trim ny4olt  fcs t)a2ua( o;t4texomocildla umuvonu4 etnmo oy1fpDelu sls  2um(m3nu1al nlncsas) Draxm ot0olxnif3ild s ra( onu)treriocoytfmtran i;(0s2tm(opoodamtnlncsasfs2trx  ot0tee  fciadlm2emumont0tlxoio3oydfaDe nes ( t2xrxm oo4lle lnvs s)aDraxmont0tpxoifctasla eau pn(0tltrxrciadla eluvi ()trxmxr3io4lptnmfvtasfa2urumo;t4tlxoifeilt a elu o u4alxnioctydop eau ilt sexm(r oy4al emfcsl(f rtm(rp;u1tex  oeiadfaDrmuvsnu4aetnio iydlaDr neo s)srxmxopiu4ameemfetat arrm(mo;o0apxn i3tldfa2ua( s u) lerio oy1faDranesls tetmir3nu1op   fvs sfa2uaxmp;t4aexomi3ils aDuanvs t0tlenio totlptr i s s0texoirpnodapeelfvs (faruaurpou1opx  f3tasls2em(msnu4aexrxrcootomD lnvo ()seurir nydoleemieta()arur( ono4tee  ieildls2rauvp;t0 etnmf iadlptelies s0tetmxr3ou4optnmictl()sDrm(ro;u0tlt  oetyslsDua(mp u0trenif oodfm  lieols t2xmirpiy1ll emfcilt)srtm( pnt4tpen i3tysls rm(mp (4texoxf3totop   u i t  exrxopou4al nlnctas) Dumumpoo0alenifciadfm2ea(vo;u4aexomr3tytfpt  nesl()trurio nydamt  iesat a2ururonu1aetoio3tlslmDulums;(0tleoxo oatlmtelnvo;(0 rxmxr nodopenlieta( a2ur(m ot4tpx ii3tadlsDrau s ()altrmr3tydfaDrai o s)s2tm(r iu1amenlfeils  2umu oot0texoiieiytlmDulump;t0teerxf tadfmDeauvs;()s2toiopnu4al emieil( aDtmxmp;o4tle mietydla2ul( on()tetoxrctotlmD  uei t  exoxo oodlpt lfvtat a2um(m nt0opeo ictysfa2ua(ms;u0 renio3iytoptrlivo;s  2urir3oydam  mnet (fs2umurp;u0ole  feiad s2emnmo;(4 rxrmr iodfpt  u o;()trto(opnudalen fctat aDta(mpnt0ole  oetadfm emuvo;t)tleomo3io1fa e uvols)t2urxo3oydamtemnesa()sDrax p;o1tetnioeiyslmDemnvpnt)arxrif iodlat  ueo s) 2xr(mpiu1lmtemfeiltfa2umur no4tpt  feiasfm rlumont)altrmr3ty1om  lneol(0s2uoxr3nu4lleemnetat) ruaxm ou1tlxn octatfa2uaump t4trtomociodop raivi;t) etoxr oydlmtnlivsat  Dtax p;t4apeo feiadlaDum(vs t) lxomo io1oat au i;s0s2xmim iydolt  netls) Durxmpoo1aexo fciysls rl(mo;(0tlxnmrcoodopt anei ( s2urxo ou1ale mivia(f rtrumooo0tex  fetysfa ea( s u4trtrmr to1fate uvi ()trxmxm oydlmtelfetl()a2ua(mooo4opeoiieild sDelumo;t0aetomo iydlaDraies ()trumio nydameelfeiatfsDtru ont4aleniociltlaDemnvo u0tlenxo oatfmtr n o s0 2xo(opio1alt  feias aDua(ro;t4aee mocild s uauvo;t0arxomo3iatfpDrlnes;t s2urxr ou4omen nvsas a2rrxm oo4aexomfcias s um(msn(0aeenmf ia1laDeaivs;s)srxoxm nu1apt  nviltfa2rr(ronu1aeen f3ilt a ra( p t4aetoio3oy1lp rau o;t0 eum(r3iu1altemncsas) 2ta( ooo1opx  icildla2elu o;(4 eeoxociatlpDeau sls seurxr3oo1oleemnesasfsDraxmpnu1alxoifeilsls2umnmsnu4texoxrcoo1lpDelnvsl(  etmxrpnydlltnmfetls a2tm(  nt4texnmi3ildfsDuauvo t0trtomr3totopD auei;s) 2uo(mpnodal  lieias sDrmumoot4alxoii3iasfs2ua(vs u0 rtrio3ia1fm  luvs ( t2to(r3oydal   fesl()s2ur(ro;t4tetnifcias sDea( s;t0 lerxo3oy1opDeai s ()s2xoxmpoodllt mnvils aDtrx  ;t4tleomfeildfaDemnvo t0 ltnxf3ta1faDe u o;s0 etrxmpoydopee nesas) 2ur(root1tpto i3iadfs2ul( o;(4 eermfciatfp rluvo (0 2tr(r3ou4lp  mfeilt)sDtrx pnt4tltnmoetytfa2ul( pnu0teeoir3oadlmtelieol( tetrxr oydaltnmnvsat srtrx p;t0alenmfeiytls2ul(vp;t4arenxo3totopD aies s0tetmxr3nu1lltnlnvs () Drru pnt0optnmi3iadlm el(ms t4 ltnio ty1omtelnesl()s2umxr iy4olenlicta(faDumum ;o1tpeoioeiydfsDemnvpn(4 exrif to1oaDeauvi s0 2toim nu4openlnctls  rrmxrooo4ope mi3tldfm2ulnvp (4 eenxfcoo1omD  ueo t)tetm(r3iydoptnmnvslsf rua(m nu0openiiciydlaDeanmon(0trtomr tadop  ln s;( trurxo iodll  liciat)arrrumpoo1tpt mi3tlsfa eaumon(4arenxf3oodop  lneslt) eurxrpoy1lleelneil( sDta(m ;o0opxoiicilt aDua( p;t4trenmf iytoateaieolt0teuoxr3iu1op e fei sfsrta(mono1tle moeiyt m2umuvs (0 lxoif3oadoatrai i;( tetoxm oy1lmenmnetasfsDrmumont1opxo f3tad mDelump ()trtrmrctodoa raneils0 2urio3oy4aptn nvta(  2rmur ;o0tpe  f3ilt a2elnvsnu) ltrxf3io1omDr nesl(0 etmir no4lptnlfcsas srrrxm oo4aptnmi3tlsla2rlu pnt) exnxo ty1om eaneolt texm(r io4am n fcsat a2umu ooo0ape  icild m2eauvo;() exnxr io1oatrln s t  rum(r3nu4olt mfeslt)s2ua(mp;u4tpeo i3iltlmDuluvo;t4tltnxo3iotop   i i t0seumxr iu4ll emfvt ()arrrxmoot0tlenifetatfm2uauvs;u) eeomociydfmte i s;s) 2xm(o3ou1lle licsat  rum(m ot0tltomfeiysla2ean pn()aetrmocoy1fa rlueo;( seumxr iy4apen nctl(fsDurxront4tptomo3iasfa2uan on(0 ltrmf3iy1oat lneo ()srxoimpny1ol  mncils) Drmxmoot1aexomfetad aDemn s t4aleoxr ty1omt au s s0t2xo(m3iodllen nes t sDuau p;o4openmfeild a rmu snt0 lxrxrctadfa r uvo s0 rtr(r iudlp  mfvt sfa2rmxrono1tleoiiciytfs2ea(msn(4alenxo ta1fmtrlneols0 exmxrpoy4am emiei t) Dum(  ou4oetn feiysfm2ea(vs;(4 lermo iodla e i o;t sexoirpiu4apt  fvsa(  Dtax ono0teenii3ildls2rm( s;u) rxnxr iytoaDrau ils)srxo(r3iu4apeelfeils)s2urumpnt1aeeniieiytfa emu o t)aexrif3oytop elnvil( s2xr(r oo4alenlivtl( sruru ono0optn fcildls elumo u) etoxf oadfa eaieslt0s2trxopiy4amt mivs tf 2urxrooo4tex  ociltfm2eau o u0tetnmr oo1fp rln s (  2toir3iudamtnmiesa(  rrmxr oo4tptoioeiltfm2el(ms;u0teenxrcoodfmD aieo;t  exoxo3iydllte nes sfsrtmx  ;o0tlx ioeils s2rlnvp;(0aleoif3tatom  li o t  exmio3nu4lm emnet t)srraxmooo1tlxo o3tatfa2el(vsn()tlxoiociytla eauesl()trxoxo iydole  nei t) 2ur( pou1oeenifeiysla rlnms t4teeomr iytomtr n i s0 etr(o oo4omtelfcs tfsDra(monu0oeeoioeiatfs2rm(vp;u)trerircoa1oaD  ieo;s) ruoxr ou1altnlneiasfarrmumonu4texoifcilsla rl(vo;u)artrmo tydoaDrau i s)trxrir3no1al nmnct (fa2uaum oo0aeeniicilsfa2um( sn() rermf3oytom eauvslt)s2to(m ou4ole lfeiasf Drmumpnu0tpe mfetatlaDum(vp;()tetoircoytfat an ols  rumim iu1omt mfviatfsDtmxrooo0olenmfeiyd sDelnmsnt)trermo3oo1fatr ueols)t2toxrpio4al nmicslt)a2urxm ;o4tltnmieiyt sDrl( o t4artomr3oy1op elnvslt  2xo(mpiy1olt lieta( aDraxm ou0ole ii3iadlmDrau s u4 etoifcoy1op  anvi t0setm(mpou4ol nmicia(farua(rpnu0oet  icildfa ea( o u0arerxf3tatfpt  i o s)s2xoxrpnudome  fvsat) rtr(  ;t1aeeo f3tasfm2rmu s;t)aexrxr iotomt  u i;s0t2umxo nodalenmfvtl( arraxr ;o1ope  octls m2rlnvon(0aexomf oodop rlivs s)srxoir nydaptemnvil(  Durx  ou4tptomo3iydls2rmnmonu)texrircoytom   uvil()sruo(m3ou4al  mfvs s) rtrum ;u1oltoifciltfm2em( pn()artrxo3tytopDeaies;s0 eurxrpnodam emieils a2ra( o;o0aetnioctytla2ea(vs;(0 lenifciodlmteauvsls0 exriopny1lpte iciat arumumont4opt mf3ils aDuauvp (4 lxnxo tydlmteaies (  exmiopiy1omt lfci sfaDra(mpoo1tlxoioeiydlmDea(ms;u)aeenir tytfm e neols) rxrim3ny1amenlfetltf Dumxmo;o4tpe ii3ias mDrlnmpn(4altoxo3tadfm r i s;s0sexm(r oy4lptemneiasf 2taum no0tlt iociatlm2uau o;u0treomfcia1oa  aieol()seur(r iy4am elnvtl( aDrax  nu4alen fcild s2rm(vs;u)aexrif todfmD lnvo t  2umim3iy4ope livtls  2raurpou4olt  i3iytfm ulumsnu4trtnxociy1oaDe u o t) rtm(o iu4om elnctl(fa2ta(moou1olxn icildfmDem( o u0 rtnmocoodfa eln ols) rxo(r3iu4lpeeliesl() 2ra(  nu0aptoifciadfa2el( pnu) exomrcoytomtrli ilt0trto(m oo1ale lncslt) Dumumoou1olxoii3iatfaDeauvont)alxoxfctytlp r uvi ()t2um(rpnydomtnmfet s)aDtrurooo0oetnifetatfsDeau s (0arxnio oadoaDeaivo;s seto(rpnu4amenmfvtas s2trxr ;t1alxomiciasls2el(vpnt4tetoio oydfm  luvsl( s2xmim nudlmtemnesl()arumurooo4tpx mfcildls ea( p ()teenirciatfate uvslt)srxm(o3oo1llenmfeil(fa2tru onu4oet mf3iat m emu snu)trtnio iydoatrauesl( teumim3io1llenmfeias a2rr(mooo4alxomoeiyslm2ra(mo;u)altoif todom rlies;s)s2xm(rpnudlltn iviat) rtmx oot1oeen feiatlmDem(msnu4aeerif tydfm eln il()setmxm3nu4ll  lfesa(faDua(moou4aeeoiieiysfsDemumo (0treoif3oydopt  ieslt)srtrxopiy4oltnlfct t)artmxmpnu4olxnmietldla2ulnms;u4alenmr oydlaD anes;()s2uoxr io4amte nvils sDuaxm ou1tetomfciltla2rmu o u)arxrxf oydomt anesls0s2to(m io1lltnlfvs sfsrrr( pou1texn fcias s2umu snu4trtomfciydoa eanes;t trtrir3nudlm nlicsasfs2raumpnu1tlx moetyd m rau s t4tltrxocootopDr u ols t2toio ou1olt mivt ( a2uaurpot4teenmfeiyd s rmuvonu0 rxnmr oytlpD anesl() eurim3iu1amt  ivslsfaDurxmpou0oleoioetytfsDulums;() lermo oy1om eai sls) rxmir3oudlp  lfet t srtr(r ou0ope  fetldlmDuaump (0texnir3tytfm r iei;t srxmxm3iy4amt mivs (fs2um(monu4oee  iciadfm eluvs t)altnmf iydfm rlnei t) 2xm(m3ou4lle liesas aDrmum ot1apx io3ilt a2ul( p ()tleoif oodoptelu i t) 2urxm3ou1amt  iesl(fs2ur(monu0oeen oeiydfs umn pnu0 rxoir ia1omtr nei;t  2urxr oy4ope livil(  Dum( p;t1openmo3iasfsDelumont0tleoirciy1opDr ivols seurxm iudlmeelfct ()sruaxr no0tpenmociyt a2eanvpnu0 lerxf to1lm ean i;() 2xrirpoy1lm nlivi s)artrx pou0ope  f3iadfsDrlumon(0 lermocio1lptr u il()setr(m oy4amenlneslt arrm(m n
\ No newline at end of file
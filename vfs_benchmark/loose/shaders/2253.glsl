@@ -0,0 +1 @@
+u i t)sexo(mpnodlmtelici tfs2rm(rooo1oexo ictad mDuan s;u4tleniociytfa  an i;(0 2ur(o3nudll n fvilt)sDum(mpnu1oetnio3iyt aDean s;u)alxnif oatfmD luvo t)sruoxo3iu1opee fvtas aDur(r no4aptnmoeild aDel( snu)trtrif ty1fm  an il(  rxm(r3nodlm  lfctas) Drmur ;o0aeeomieiltfs2rln s;t) leomo oatfat li i ( srum(o nydlptn nvias)sDururp;u4tee  octltlm ean p u0 lxoio tatlm r ivi ()s2toirpiy1lleelfvtl() 2tm(r ou0aeto oeiysfs elumo ()alerxf oy1oate ies s setm(r iydolee nvils)s2tr(mont4alt mi3tldla uanmo;(0trxrmf3totfa eluvi;( teumxmpnu4lme mnvi s)arua(mp;t0tlxo f3tatfm2ra(mp;t4 ltnxr oa1om  lues t) rumirpiodomee nvt s)sDtru poo4olenmictadfm2rau p t0 exrxr3tytfp r ivil(0 rxmir oy4olte nes ( arrax  ;u0tlxoio3iyslm emnmp t)trtomrctodla eai o;s0t2tmxrpio4lmtn fcilt arrmu p;o0tet io3iaslmDelump;t4trxoxo3totomDrau il( trum(o nodalt lneilt)srtrurpot0ape mieiysfa emuvo ()tlxrio3todfpt li i;() rtm(rpiodol nmivsl()aDtm(m nt0tpxo ocild m2rln s u)trxomr iotlmte i s (0t2um(o iu1aptelfeils)aruaxro;o4tet ifciatfm um(mp u0tlenmr3ty1opteanvo;() eurimpnodlltn feils arta(mpno0opt  feiysla rmnms u4 lxrxo iodfaD  nvs () 2xoir3iu4oltelfetl(  rta(root0optomoctldfaDrluvo;u)arxnxr3ootlmD  n o t0srtoxm3no1lm  mivsls) 2umx p;o1tpen iciytlm2umu o;(0teermrcoydlmD auvi;s teumiopiudlp nmivs ()s2rr( onu4alen f3iasfaDul(vp;u0trxnir io1faDe i s t0sexoio oy1amen ictlsfaDuau oou1aexomieiasls2ra(vpnt4trtnxo3tydoaD lu sl()srxr(m ny1lmeemfviat)sDtaurpot0tetnmf3tas m ranvs (0aexnirctodopteaieolt s2tr(o3nu4ol elnet ( sDumx  ;o4aeeomf3iydfs ean p t4 exoiocootoptrau i;(0teumirpoodopenlivi t  2rrurp;u0apxnmieias s2ul(vs u) renif3oy1op rlnvi;s seuoio3ou4lm nlieilt)aDrrxmpnt1tptnii3iyd a2em( s;u0 rxrxo iadfmtelnes s  2toim3oydap e neias)sDtmxrpnt4alenioeias s2ra(mpn(4aleoxo totomtean s t0 2tr(mpiy4omtn fei s aDrau  nt0oetnii3ils s em(vo;() lenir3tytfmD ai olt  2uo(rpou4lpenmfvslsfsDuru pnt1oex  o3iysla rau p;(4tlxoxo iytfmte uesl()srxm(m3oodaltelfesas)arrmx oot1tlx mocils a rlump t4artrxociotlateauvs s0s2xr(m3oydole lfvias a2raumpoo4ope io3iydlaDel(vo;u0arxnxo oydomDe ivils trto(rpno1ol  livsls  rra(mo;t0tlt  iciysfs2rm( ont0 etoio tydoaDrauei;t0 eum(o oudllee fviltf rrmuroou1opt  icias s2uau on()altomo oodoat aies;t0srxrxm oy1ap emivils  Duaxro;u1aeenmocilslm rmnvonu0trtrxocootomt aivs ()texrxrpou4al  mncs t sDraxrono4ole mi3iltlsDem(msnt4 rxrir3oodfmD anes s0 2toirpoudamtn fvsas arrmx p;u0aex ioeiysfm2ea( o t4 lxnmr tytfmD aivolt0 2xm(r3iu1lp  lietls  2tr(  ou1opxomf3iadla2ul(vonu) ltoxf ta1opDr uei;t trto(opiu1apt mfvtlsfs2raumpot0tle ifctydlsDua(mo t4 lxoxo tytoptrlu s s)trumiopiu1llenlnesat srrax o;t0optomf3iytlm eau p t) rtrifcoa1lm   i ol()t2um(m3ny4lpeelfcia( aDur(mont4ope ii3iadlmDua(vs;(0 eenirctydfpDran sl()trtrxmpno1lle lnvsat  Dtrxmp;t0oetoifeilt s2ua( o () eeoxo iydlatrai i;()trxmxopno1lmt  ivs s) 2umx p;o1aetnmf3iadfaDemn p (0trermf iy1oatrluvilt0texr(o nu1openmicsa(f rtr(m ;t1opx  fetlsfm ul(vs u0 rxoxo3todopDraueil(  rurxrpnodal n iesa(faDurxmoot1oex  ictat a2rmuvs (0aetrio iy1lpt luvilt t2xmio3iu4op nmnvt s)srra(mooo4apenmfetlslaDranvs t)teenmf oodoatelneo;s)sexoiopnu1llt micils srrmxm nt1oeen f3iysla2elumon(0aexomrcoadfpD luvol() 2uoir3no1amtelnesltfaDrmu oou1aptomfeiatfa2rau onu) rtoir tydomteanvo;s  rto(m oy4lmeelnet t arua(rono1apt  f3tytlm uanmpnt4aexnir oytomt  ues ()t2urir3oydamtnlfei (  Drax poo4aetomoeiys sDra( pnt)arxrmf3tytfmDr nvi s  exoxrpio4ape mnet (  2um( oou0tleo oeiyt s eanvo;t)arxoio oatomDelivi ()teuo(rpoo4amt  ivslt) 2ra(r ;u0texomfcils m2el(msnu4 rtoif3tytfatelnvs;t trumxm3io4om nlfet ( arur(mooo0oeeomiciytla2ulnvo;u)tlermoctytfp e u o;s0srtmxopny1altn fcias sDrmum nu4tpeniietasfm2ua(mo;t4arermr3iodla elu s;s)teumxm ny1apeemfvtl(  Durumo;t1aex iociltls emnmo t0aeenio3ty1oaD  iesl() 2um(m3oodal e feias)sDtmxr nu1tlxo fciltls rlnmo;t0 rtoifciydlaDrln il() eurxr3io1omeelncilt)sDtrx pnt0oexoiicilsfaDea(vp;u) rtnxoctatlm e uvo ()s2uo(m3io4llt mfcias)s2ua( o;t0oexoioeiat mDeanvpnu0 lxrmfctytfp  lueo ()setrxo ou4apenmnci s)sDrrx o;o0aetnmo3iytfs2el(vsnu4aeenxrciodop   ies;t)t2ur(mpoudll elies t)sDtrurooo1oleoiietatfa2el( p (4 exnif3oy1fateaieil(  etmxm nu4ll  lfci ( s2tmxmpou0tet if3iatfaDrluvs;t4arxnir3tatlptrlneo;(0trxoxr3ny4ap  lnvs s  Drax p;t0olenifciysfa emu snu0 ltrxf tatlpDr i i (0s2toxopnu1aptnlnvtasfa2ur(mpoo0apt mfctldls2ea(mp;u4texomrcoydfa e i ol(0srtoxo3io1omt lfesat)a2ur(moou1aetomi3iydfsDrlu pn() lenif oadfaDeliei (0 etoxrpny1lp nlfeta( arta(rpnu4texo o3ildlmDel(mo;(0 rxrif iotlpD an i;() rtr(opou4olt mict ( arrm( pot4tptnioetatfs2rmuvp;() renio ta1omDr u ils teumiopno1ale mncs s  ruau o;u1olenifctldfs2ul( p;() leomrciytoat lu i s0texoxrpnu1lpee nvs (fs2rrx pnt0oeeniicildlmDraumpnu4texomociy1lmDelnvi t srur(opoy1ale lnvia() Dtru  ot0texnmociatfa2ul( o;u0aeermo iy1fp r nei ()sexmxr nu1am emict ()a2urum nu4opxn iciydlm2ra( o;u0altoxr3iytfmD liei t)srto(opoydom emici (fartrxrpot0tpx iiciytfaDeauvpnt4trenmf iotop rluvolt sruoir oodlm  mivsat aDtr( pno1aee  icild sDel(mp;() exnifcio1op r ivs;(0 eurxo3oy1lp nlnvi s  2taur nu4opx ioetlsls em(vo t0artnmf oy1opD aneolt srxo(mpou1oltemnvsas  2raxm ou4aptoioctydfaDrlu snt4 rxrircoo1op e ivilt teumxmpiu1apen fetasfs2trxroot1olt ioetatfm2umnmont0artoio oadfmtrai s;t0 etoiopnu1llte ictas  rrru p;u4aeeo fciyslsDelu sn(0aeeoio tydla  aivslt0 exmim ny1op  mneslt srtr(m no4olto octlsfa2umnvs t0 exoir3iatomte nesls0srxmxo io4oltemnvilsfsDtax o;o4tpx mo3tytfaDemumo t) lenxo3iotlp  ai il()truo(mpiy1lltelfetatfaDrru  nu4oee  o3iyd sDrlumont)aexniocoo1lmDeln ol(  rumirpoy4op   fvs (  2tmxm oo4tet mi3tld sDuau snu0teenmo oytlpDeai sls  rurimpoy1om n fvtatfaDumx ono1oee ioeiasfaDemnmsn(0aeenxo3tydlaD au i;t0s2trio iudlmtelncias  2raumpoo0aptnmictasfaDra(mo u0trenmrcio1la elnvs;( srxoirpiodol e fvtls)aDtrurp;o1tlxnmoctlt m ranms;t)texoio3oadfa r ivs ()t2xriopiu4alenmictl(fsruaxrpoo0aee  f3iyd mDrmu p t0 ltnio3oo1om  au o s sexmxr iydomeelfvtl( arrru  ;t1tex io3iytfs2uan ont4trtrir ta1lpDr ivi;s0teur(m nydlme mfvs sfa2umur ;o4olt moctysfaDrmuvs ()alenxr3ia1oat  ivil()s2urxm3oy4ol elfvtls)s2trump;o0tpeomictad m rl( s;u0 etnmo oydoptrluvs;s) 2urxo iodomtelnesas  Dumur ;u0apx ifciadfa rmn p (0altomf iydopDrauvs;t  rtm(o nu1ap  lfvtltf Drax  ;u4opx miciydfa ulu p u0tetnmf ta1omDran s (  rtoir ny4lpeemfvtl()s2uaxmp;u4tle mf3iasfmDel( s;t0trxoir3iatom rlnvs;(0setoio3iy4lp n fvsl(farrmxm nt4oltn iciadla rauvo;(0teeoxo3oadlmtrlnvi (0 ruoio oudllee ncias s2tax  no4olx  fetysls rluvp u)tetnxfcoy1fm e n s;s  rumxopio1amte fcia( srurx  ou0aeeo f3iadlaDrl(mp u0 leoxrciatlmD  ies;t  2trimpiy4altnlfcsls  2umu  ;u4tpenio3iasls ra(mp;t4tetrxf todlpD aueo;s0 rtoir iydlm  lfetas)a2raxrpno1aet io3iys s eluvo;t4 rtrif oy1lmtranvi;s s2uoxr3oo1lp elictls  2raurpoo1aeeomfciytlm emu p ()alerxociytoa rli i;s0s2xmxo3no4ll elnciltfaDtaxmpou0tlt ifctad mDua( p u4trtnio ty1omDe uvs (  eumiopoo4ap nlnetasf 2rr(r ;t1apx ifetld aDem(vp;t0teeomfciy1la eauvi;t)texm(o3ou1lp   icsas sDrr(rp;u1aex mo3iydlmDem( snt)tlxoxr iy1latelnvols)trtrxmpiu1lptemicslt aDtmur ot4tptomf3ilt mDemuvpnu)trxrxo3iotoatr nvols0 rxr(m ny4opeelfet ( sDurx p;u0oeenmieils aDumuvpnu4 rtrxfctadlaDe ivo s)t2xmio3iu1lp nlfvs s)srrr(  oo0alt mfeiydlm2um(vsnt4alxnxrcty1fmte u i t trxo(rpoo4apenlivt sf rrrx o;u4ope ii3ildlmDrmuvp;() lxrxr iy1lptelu i ( seuoir iu1ol nlics sfsrum(r ou1tpen iciatfm2rlnvs;t4aeerxr3todfmt li sls0seuo(mpio4ole miei sfsrtmxmp;t0ole  i3iadla umnmpnt)arxoifcto1fm eauvol()sruo(o iudaleemfvtas) 2rrxr ;u0ole iiciyd m ean o (4aetniocoa1fptelneo () exrir3nudom nmnvtat a2uru pno1opt mi3ilsfa rmu pnt)aeeoxr3oodfm eanvi;s0 eur(r3oudam emietls) Dururpnt0tpx ifeild sDrmnvo;t0altnmr3iotlaDranvo t teumio ny4lme  iei sf 2um(monu4aeen ictltlm ul(mo;t0altoxf3tadlpteai sl() eumxr3io1om e nvsls) rraxm ;u0aptoio3tatfa2uanvo (4texoir ootomtr nvi;()trtmir ou1lm e fct tf 2umum ot0alt  i3ildfaDrm(mpn(0texnir io1fat lneolt  rur(mpnu1op emnetl(f rtauroot0tptnmoetat a2umn p u) exnif3oy1oateaueo t sruoxo3iy1omenlfvta(f 2rm(  ;t1teto fctysfsDumn o;u)arxnio totop ran ils  2tmim3io1omt lnesltfartaxmpou1aetnifciatfmDelnvo (0tltnif ootlm  lieolt) 2uoxopio1ale livi ( aDtrurp;o4ope miciys mDumump u4alxrir3iy1oaDe n ol()texr(m no4alen fvtl(fa2umx onu1texomieiltfm2uln o;(0 leoxo ia1lptrlneo;t t2toirpiy4al nlivia(f Dtmu oot0aexnifeiytfmDul(mp;t)aetnmf iytom r i s;t srtriopiy4lle lnesltfs2raurono1oltnmieiydfs ra( p u0trerifcoadfptean i;t)s2toimpio4lp e fes s)arumxrp;t4tex  oeilslm2ua(vonu0alxnxrciydfmD auvol(0seto(opoudame  ivtlsf Dumumont4opxnifciat s2um( p;()altriocoydfateluesls)teurir3no1omtelfcia() 2ur(m ;t4opxn feiasfa el(vonu) eeoif tadop  luesls) 2toxopou4ap nmnvslt) rtauro;t0opxo icild m uaumont0teenmo3oatomDe ieils0seum(rpoodllt livias)srrrxmono4aptoio3iad aDrl(vo (4tlxrir3oadlm eauvi t  etrxmpny4optelnes ()artmxr no0oetn i3iat m emnvo;()trxoxr3tytoat  neo t) 2xrxm3iodaptnmics t  rra(mpnt1alenmictldls2rln s;t4arxoxr3tydoa  lu o t)s2uoirpiudll  mivs tfaDuau o;t4altnifeiadlmDua(ms;u4teerxr3oo1fpD aivi s tetrxr3nu4om eliesa( sDra(  ;u1opto o3iysfsDemumsn(4teeomo3iadoatrluvo;s) rtrimpnudop n fcils)sDum(r oo4olx  octadfm um(mo u0trerifciatla r uvi ( tetoir oy1ll nlfet ()aDrrxmono1ape mietlt a2rlnmpnu)alxrxf tydfmt au sls)trtmxo io1om nlneta() Dtru  ot1tpe  o3tltlm2um( o u0aetrmrcio1la  anei;(0t2tr(mpnudlptemictltfs2taxro;t4apx iieiytlm umuvo () exnircoy1opt li olt) exoxr ny4lm  mfctl() Draumo;u1tex  fetatlm rau onu4tltoxoctatfpD an s ( trtrir nu4omee nvtl(f 2ua(root0olxniociysfsDuauvon(4artrxo3oa1laDrauei (0sexr(o3nodaptelfvsl()srtmxr ;o4tetoiicilsfs um(mpn(4alxrmo tatlp  lieils)setrxo iy1ome  ivsas srurx  ;o0tpen octldlmDrlnmpnu)aexnir3iydoa e nvo ( s2xmxo3ny4lp   iet () 2tmx  ;t0opxoiieiatla rm( snt4alxnxr3io1omtrlnvs ( srto(o3iu1olte nei ( arur(ro;t4oltnmiciytfs2elu snu0arxrmf3oydomDr uvilt  2xm(mpoo1ape  nctltfa2umurpot4tex mocild m eanms (0alxrmf iytlp eaivolt0trxmimpnydapeemivsa( srtrxm nt1oltoioeiadlm uln s;t)trxnmfcoo1om  au olt srxoxm iy4oltn ncs (  rta(m ;o0apt mfeildlmDraump t0aetomf oytoaDr uesls)setmxm3oy1alt licsa( aruaxrp;o0ole mieiatls umuvonu0texrir iodla   uvo;s0 2xrxm3ny1lpt lnviat a2uaxrp;t1aptn fetadfa2rlumo;(0aexoir3oodoate ieo (0texoirpny1ll nlicsatf rrmurono4tex  ieilsls elnmon() eerxf3oytfa  aneo t0 rxm(m3oy4al nlici t arra(rono1opxo fetadlmDum( on()areoir3ta1fptr iei ( seumxrpnydamte fet s  Dtrur ou1tet iicilsls ulnvp;(4 ltnxr3oy1op rli i t)truoxr3no4oltnmiet ()a2tm( oou0aexnif3iadla2ulnvs;()artrxo ia1fpDeli o s0sexo(m3oo4opte nvil( sDrr(rp;t4tlxn fciydfs2ea( s u)arermr3iy1oa e neolt  rtm(opno4oltelnvs ( s2tmxmp;o1altnmf3tyt aDel( sn() ltnmoctatfmDr i o;(0 2umim nu1am  mneta( s2rau  nu4tpx ifetas s2rlnvo t4altnmf to1fat  ies (0t2toir3iodol nlnvt tfsrraxroou1tpen oeiltfa ea(ms;t) ltoxocoy1latrlneols) rto(m oo1ope mies (  2rmuro;u0tlen ieils s ua(vsnt)arxnio iotopt  ues ()truoim3nodam emnvi s) Dur(m ;o4tpxomi3iadlmDuan s;(4 rtoxr iotlp ranvi s  exrxr nu4am nmiei t sDurxmpnt4aleo ietys aDulnmo t) eeoir3tadfmteai s (  2toio3ou1amtelncilt arururpnu1apeoiietls s2el(mpnu0aeerxf iadopteluvol()trurxo nodap nmfeils) rtaxroot1tlxomoctlsfm2rauvs;()aeerif3oadfptraivs;()seuoimpnodam emici () rrrurooo1oetnmicilt sDra(vs (0trxnxrcty1oat ai o;()teuoxrpno4om elieslsfaDrmx  no1oexo oeild sDul(vp t4tleomr ty1laDelneils  etmio oy1ameemivtls srua(m ou4alxnioeilslm ul( sn(4tlerxfciotfmDe uesl(0 euoxm3nu1ale mfeslt  2ta( o;t1tpt micilsfs2ul(vs (4tlxomo3to1laDraieo;s  2trxmpnodomtelfctas)artrxr ou1oleo i3tadfmDum(vp u0 eeoif ia1fpDeluvs t0seuoxmpiy4omeelnvsa( s2um(mpnt1oeenmf3tls sDrlnmpnu)trerio3iytoa e nvi s  rxoxm iydalt  neta(  rrrxmont0opxoifciys sDel(mp ()areoircootfmD livols  exmxmpoo1ap  livias)sDrru ooo0olxomieiasfaDem(ms;(4arermr3oydlm  lnvslt) eur(opiu4lmtnlivt t) 2rm(m nt1oltoif3tldlm ul( p;(4 rxrmo oadfm   neilt  exoxopiy1ameelivta()a2trx pot4tlen ietysfa rm( s u4areomf totfatraneslt)seuo(r iudlpt mfctlt)aDrmxrpou1aleo fetys s2rlnvo t0aetrir iydlmtran o;s) 2xmim3oy1lm elnciat)aDrmum ;u4oetn o3iat a elu p t4 renircoytomtrln s;s0trum(m nodlmt mnet s aDur(mp;t1aleo oeiytfsDum(mo;u0aeeoircto1lp   ivol()sexoimpoodome  fvtlt  2uaum nt0tlenifetatfm uanmont0tlxoxr3tytfmte neo;()t2toxo3iodom eliei t  2rax p;t4opx iocias m emu s t)aleoir oytopDrlnvs t0srxrim3io4apt  ncil()aDrrumpot4aeeomfctytfa2rl(vp t) etnif totlp rai ols0 euo(mpoy1lpeemieias aDur( pnt1teenmi3tldfs eaumonu0trtrmr tatlatrluvo (0t2xmio io1aptemfci s aDtmurp;t4aex mo3ilsfsDem(vp;t0tlermociadla   nvi t texmxr iu1omtn fci t)arum(moot0altnio3iyt s ean s;(0alxrif ootopt lnvs;() euoxr ny1amte fes ( a2rrx  ou4apxomf3tatla elnvo;() rtrxociodlm   i s;( seuoxrpiydll  lfvils)sDtaumo;o0aexo feild s um(vs;t4tetrir io1fat aivi;( srxr(m no1omenmfciat aDtm(  nu1apeomf3tadlsDuanms u0alxrir iadfmtelieils srxmxm oy4alt lfeta( s2tr(m ot1tlxnif3ildfa ranms;u)trtrxrcoy1opteanei;s  rxmio oy1ap emnetl(fa2ur(rpnt0texnio3tadlaDuauvo (0 renif3to1fpD  ivo t) 2triopoy1am n fvsat)arrm( ont1olxnii3iys a ulnvpnt0aexrio iy1fp r n slt s2xrxr3nudalt  ncta( arumu ooo1alxoio3iasfa um(mo u4trermrciadlpt  ieo s)t2urirpnudal e nctlt  2ua(monu4optomoeiad mDelnmo;u4 ltrxr3iy1oaDe iei;s0teurxm3oodoltemfcils  Dur( pou4oexo ictlt aDrmuvs;(4altnmo3ia1lmtrauvi s)t2tm(mpiu1apt lfctlt sDrrx  ;u4opt mieiadfaDul(vonu) reoxf3oadfpte uvs;s tetmxm3nodamt liesat)aDum(rpnu1opxoii3ild a rlums;u4aeerxo3iadlp e i i;(0srtr(m ou1al nlnei t a2rru  ;o1oleniictyslmDeauvs;(0 lxomfciydop rlueo;t) eumio3io4openlneias)sDrmxrp;o0aetnmieiyt s um(mp u)artrxoctatopD  ieo t) exrimpnu4al n icsa(  rurx  oo1ope  i3tadfmDem(msn(4 lxrxr ootlat aies;t) 2toxr iu1lm   fcsa(f rtr(rono0alenioetas aDra( p;u)areoio3oadopD aueo;s  etoxr3ou1ame  icia(  Dtr( p;u1olx mfeiyd sDumnvon()tlxnmr oa1lm ranesl( trxmir3nu4apenlneilt sDua(m ot1aexoioctltfm2ea( o;t0tetrxr3oy1fpt lnvs (0 etrxr3ou1alee ivtlsfs2tmu  ot4alenmfeild m ea( o t) etoxrciydom elnvsl( sexr(mpnu4alee ivt s  rtau ooo4tetn ieiys s umuvp;u4arxrmo3iatomteli s;() etm(m iudam elnvil( aDur(m ;t0tpxn f3iys a umnms;(4 exnxo oytoa eanvs;s  2xrxr oo1oltnmfcslsfaDrm( p;u0ape iociyt mDelumpn() rxnxfctydom   i sl() etrxr oy4op  livtls)sDtau o;u1alto ieildfsDulump;u)trtoiocoo1oaD luvs s t2ur(opio1opte fciatfaDtr( pno4alx  iciad s rl( o;u)aetnxoctadoatr u o;( texrirpiodlme livsltfsrrr(  ;u4olx  fciat mDuluvp t0aetoifciytomte uvo s)srumxopoy4altnlncilt)srua(ro;t0altnmo3ilt s2rmums t4areoio3oy1lm  lu s;t srxrxo oodol nmnet (fa2um(r no1tlt ifeiytlsDra(mo;t4aetnio tadla r n i t0 eur(opoy1lmeemncils)srrrxmpoo4optomi3iatlm ran s (4trtrxocoodoptrauvo;t0setrim no1omt livtlsfs2tm(m no1apto o3iydfa2rluvont0texnmo3tydomDr i i;t trto(opio1ol  mivs t  Duaur ;o4olx mfeils m2elnmpnt4 rxoxf3oodom  ai sl() 2xm(rpno4ale mnvi s)sDtmump;o4oex  ocildlaDumuvon() reoifciydomt  ies t0t2umir ny1lp emfcs ( s2taxrpnu1alxo iciydls2uau snt)alxrmfciy1oa rauvs s)trxmirpoo1opeemfeil(f rumx  ou4opx  f3iltlmDrl(mo;t)aexnirctydfmDe i ils  eumim3nudll  mivt s  rrmu o;t0oltn i3iydla rl(vs;()arxomrcty1fat luvs;(0srtmiopiy1op nlfcs tfsrrm(  ou1oee if3tytlm rlu snt4tltoxrciadomD lu s s trxrxm io1op nmfes () Dtrumont4apeo fcilt a ul(vpnu4tleoif3iadom  livsl( s2trxopiy1op n icia()sruaxm nu1alt ii3iadfs2rluvs u4trxoir3tatfm  luvs s s2to(opio1open fctatfarumxmpnu4oee  i3iat m2uanvpnt0areoio tytoat auei;(0 rtr(o oudllte ieils)aDrau o;t4aptnmieiad m2ul(vo;u0artrmrcia1op ean olt0s2xrxopno4ap n fcta(fsDtau onu0aleoioeiltla el( on(4aeerxr3iytfpDrlieo s trtriopiudape  fetatfartauroot0optnmocild a2uauvpnt0arxrmr3oydoaDelneo s trumxopio1opeemict t  2urur ou0altnifetadls2rmuvs;t) etrif3ta1fpD livi t)tetrim3io4olt lnvsa()a2ua(r ou1oexomo3tydls2emnvon(4aexrmrcoydfpt lnvi ()t2urxo nu4ol  lnvias)sDrr(ront0teto fciydla2um(mo (4aexnxfciydop eliesl(0texmio3oydlme lnct s) 2ur(mono1tlenifetadls2ua(mpn(0tlxnxo3totoptrlieo;t trur(r iy1op n fviat  2taurp;o0teenio3tat a2raumon(0aexnmocoatopDran o t0teumxopio1am emieil( aDta(  ot4aee mfeiydla ea(mo t4alermoctadfmDe neo ()s2xr(rpoodalt lfctat)srta(rp;u0olx mietydfm2elnvp t0trxnmr iytfaDr ueo ()s2uoio3nu4ope  fcs sfartmu  ;o1oet ifetys mDem( o ()arxrmfciytfp rlneil()setoxrpoo4lpeemfei () rrau poo1optn ietatfm rmumon(4alxrir3iytlmtrlivo ( sexmim3iy1lmtelfet s) rtru p;o1oee ifctyd a2uanmo;t0treoif oydomD luvs (0s2xmxopny1lleelivil()s2uax  nu4olx mociasfa2ranmp;t4 etrmf3iy1oateai ils0s2toimpno1om e nvi tfa2ur( ooo1olxnii3ias sDelumo (4tlxrirciydfatr i o;t  rxm(m oo1opte icsl(f ruaur ou0aexnio3iadfmDuanvp;u0treoir3ootlmD luei;t setm(r oudol nmfct sfsrta( pnt0tpt ifetlslm ra(mp;t4tltomr3ta1fmtelu ols0 etmim3ny4aptnlivtat)sDumumpnt4alxomf3iltfs2eanvs;u4 exnxfctydla e ies s tetm(m iu1opt  nct (f 2tmxrooo4aet ifciyslaDra(vs t0artomf ia1fpt  uvi s)t2trxmpnydame mfvt sf 2rmu  ;o4tpt mieilsfm2rlnmpn() ltnxo iatfaD aueo;(0 rumim oo4amenmncil()arum(mo;u0ale  iciatlm umums;t0tlxomf3io1fmD auvilt)setoxm3no1oltn iet (fartru o;t0tle  iciys m2uan s u4altrxocoy1oateln ols0trxmxmpou4ap nlfesat) Drmx  ;u4apxnioeiyd s ea(mp;t0texomr3tatfmt luvs ()texr(rpoudlptnmivils)aDtax ono4tee ifeias sDua( p;(0tltriocta1oat  nes;t0 euoio3nydlp  mfvtl()a2umx  ;u1alt mi3iad s2uauvsn(4alenifcta1opDr ueslt)s2toir ou4ll   ivias)s2uaxr ;t4tlxomi3tasla2rl(ms;u0 lxrxrctatom  aieols0tetoio3oydap   fcsas srrm( o;o0apx ifcilslaDuluvon(4aetnxf oadfmtranvo t0sexrir iudom nmfct (faruaurpnt1optnifeiytlmDuanmp;u) rermo ootlptr iei ( srurxmpiu1amenlnctlsfs2umu oou0teeo oeiydlsDeau ont4tleomrcoytomDrluvo t trxrim3iy1lltnlict s sDtaxmo;t4tlx mo3iys s rlnmo (0tltomocoo1fm ranei;t)s2xrxopiu1ol e neilsfs2rm(ront1apxoioctytlmDeau pn(4 rerio3oy1lpte ieol(0 2uo(rpio4lptemivia() 2tmx ono1tpeo ociys s2uauvo t)texnio iadom ran ol()s2urim3io1lmenlieil( sDrmxmpnu0oexn oetasfsDran on(4tleoirciytoa e i i s) 2umxopnu1am emncsa( aDua(  ou0tltn ieiydfs2emuvo;u0teerxo3todfm   i s;s)trxoio nodomenmnvtlt aDur(moou1apt io3tas sDra(vp (4trtnio to1oa rlnvi (0s2tm(mpiodop  lnetlsfsDrmum oo1oee ioetasfa2elnvpnu4 rxrmr3iotfp r nesls) 2xoxm oydomt lfcsatf Duaxr nu1tetn ietysfm eluvsnu4aeermf tydlp rauvilt)s2uoir3oy1ll  lfvsa() Dtaxmpoo0oexn fciydfm elu s;u0 rxnxfciotfpDraivi;() 2xr(rpoodamtelfvils srtru  ou4olt mfetatfsDrlnmo;t4tlxoio3totla rauvs ()srurxm3iodom nlnci t) 2ta( p;u4aee miciyd aDuaums;t0 lxoif3iodfp rlu o ( srxrxr iodlptnlivsltf Dur(m ;t1tex  feiysls2uanvpnt0 lerxo3oo1om rlu sls  euoxmpnudame lict tfsruaxmpou4teeomociad sDemuvo;u)texrmr3ty1laDr nvs;( t2urim iydlltemnvil()sDuaxmoou1open i3ildla2el(vp u)tetnxf3oatoat aivols0 2tmxmpno1ome mnvtlt arumum ot0aee  ieildfaDeanvonu0tltnmf io1lmDe u ils0t2xoimpiy1opee fet (faDrau ont0tpeoifctatla em(vo;(0tlxnxf3ia1fp elu o t sexm(rpiudamtnlfeils)a2trxr nt0alxo i3ias mDrm(vs;(4aetnircoatfmD aiei;s  rtoim iy1lltemnvsatfa2umxmono1apxnioeiaslaDelnmsnt0arxrxf3iytfa elivs;s) etoxr iy4amteliei t  2rrx pou0aee moeils aDrln snt4artnxr3iy1fp  au sls texrxr io4alenmnetls artaxr oo4ole  icild m2eanmont0 lerio io1opDeln i;s) 2uo(m no1ap   fet t s2umu pnu1olt ifeiys a2emnvs u4alxoir tydlm e uvs;()trtmim3oo1ole lnesas)aDtr(  ou1apenmo3ils s2rluvsnu)aeerifciatlaDrluvi s0truoxrpiu1lle lnvilt s2tau pnu1opt  i3tatfa2ul(mo;u) etrxrcty1lpt anvs t sexmxr no1omtn nes t)sDtaxront0opt if3iydla2el( onu4arxnxr oa1fpD  ues ( s2uoio3iu1lleemietas) 2tmxm ot4tpxnmfciatlmDuluvont0texnmrcta1fpte nvol(  2xriopnu4lpe lfcs t sDtr(  nu4oleoifetat s ra( ont0aetrircty1lmte ivs s) etoxr3nydlm n icsat  rtmxroot0oltnii3iysfm elnmsnu)teenmrcoytfmtrlneils seum(o ou1olt mfeils arum(rpoo4open i3ildfs uaums t) lerxf3oatopD aivil() rtoxrpoo1lmtemictls)aDtmu  no0tpt iocilt sDelnvsnu0 etnxf todopDean il(0trtoir3ou4ap nlfetat aDtrx  nu1aeto oeiyd a2rmu p t4arxomf iotoptelu i;t sexo(rpoy1am e iviltfa2ur(m ;o4optnmictadlsDum( on(4trxomr3totom  auvslt seuo(m ny1lpe lfvsas)a2trumont0aet mfciytfs2ran onu) lenxr tatlmtrau i;s s2xoxrpoudol nlnciasfs2rr(rono4tltomo3tatlsDumuvs t) lxnxr iytfm elivo;s)trxr(r oudol nlnvta(faDrm(mpnt4tpenmiciltfaDumnvs;u4 leoxo3iytlaD au il() euoxr iy1aptnliesl() Drru pou0alt ioeiltfmDeaump t0teeoxf oadlaDelieols) ruo(m no1amt  iei (f rumu  no0oleomietydfmDrmnmpn(0trenmo3tadlpt aneo;t0 ruoxo io1om elfes t)sDumxmont0aptoifetadfs rmn pnt0 eeriocto1oaDrlivol(0srurir io4lpenmieilt aDrmumonu4aexnii3tadlmDelnmp u0tleomr iytomt ln s;()sruo(r3iu1oltn nesa(  rtm(rpot4apen oeiad m2ulu o;u)arerioctatoaD aies;t texmim3no1ale mnvsltfs2urx  ;t1altnmieildfaDumu p u)aeeoio ty1lmD lies;()srtriopno1lpen fcsls)sDua( onu4aptnif3tysfa2eauvsnt0 lxoir3iotfp ran ils trxmxrpoy1lpenmncs t srrrxm ;t1tleoio3ils mDua(vp;t) lenmf ootomtrlneols tetoir3nodlmeemfvs s) Dtrur ;u4olxnii3tat sDumump ()aetomrctadoaDranvolt s2xo(m3io1lpe mici (f Dua(ro;u4aee  i3iatfaDra(mo;t)aexnxf3oatfpDrauei (0 rurirpnu1ole lieil(fartrxr nu0ole  ociydlm2rmnvonu4tlxnxoctodfaDrluvils tetr(m nu1alenlivta(fsrumu pno0aeenmi3ilsla2uanvo t) eeoiociydfmDrln o () 2umiopny1olee nct ()srum(rpoo1tex  oeiyd mDum(vo t) eerir3tydfaD aieo t0 rtm(m3oudlp   fvtatfa2trx p;u1aeeoifeias mDelnmpnt4tltoio ta1op rauvo t0trtoxr3iydap n nvils)a2umxm ot0tpe ioetytfs ea( pn() eermfcto1lat liei ()s2toxr io1ameemfci s)s2tau ono4aetnmoeiydlsDrm(mo u)trenmf ia1opDelnei s)tetmxmpoy4al nmfcsasf Duaurp;u0oee mociatlaDra( s u) rtrir io1lp eln ils  exoiopnu4am elicsas s2tmx  nu4opeomfeiatfsDrlnvo (0areomrciadop  livi t0texoir3oo4ll n ictat) Durumo;u4oee io3ildfs ra(vs (0 etoir oy1lmDrai slt tetrir3iy4ome mfvtat aDrrxmp;o4oeeo ietytla2emuvs;u4altomr3tatoat au o;s srxr(m3no1lm  liesltfa2umumooo0apt  f3iysfsDumnvs u)tlerir3totlmD livi;s0t2xrxo nudol  lfei t  Dum(mo;o4tetoifeiysfmDelums u4 eerxfciatfa ean s;t0tetmxo nodomen icsl(  rtr(r ;o1oexo fetysfm2ra( o;u4aeerir ty1la eau s s0t2to(r3ny1op elici sfs2tru p;o1olto oetlslsDemuvpnt4arerio3oo1oa  lu o t0setrxm iudllee nvi s) Dtr(m nt4teenmf3iyslmDrluvp;u4 reoxoctodopDeanei t s2xrxr oo1am emivtasf Dtmu p;u1tlenmfciyt sDumump (4tlxnmr iy1fa rauesl()t2xrir3ny1alte icia(fa2tmurono0alxoiiciasfaDul(vo;u) lxoiociotfmtelnvo t)sexoir3oy4llee fctlsf rua(rooo4aeenmi3iytlm rm(mp t4arxoio todla r nvolt s2xoirpou1omtn nvias  2urxrpot4tlxnmociat s ra( s ()tleomr3ootfmteau i (0truoxr iu4llee nvtl(  Dtmu pou0aexn f3tldfs2em(ms (0areomrcoodfatelivo t  2xr(r oudop   ivt (  2rmur oo0tet  i3iadlm rlnmp;(4altrio totoa rlieslt seurimpiudll  lncsls)aDumum nt1opx io3ias a2ulums t4aexoif3io1fa raueslt0truoxo oo1amte nviatfs2rr(r oo1olx  i3ildfa umnmp;t4 etoxf3ootom   u ilt  2xoim oydomtn netat)aDrrxrpno0apt  f3iydfa el(von()teenxo3iytlmt auesl( s2xrxmpnu1lptelnei sfs2tmxr nt4tetnmfeiad a2ean snt) eenxf3oo1laD  ieo;t) eumir3oydolenmivslt) Drr(  nt0openmociltla rlnmp;u4altomrcoadfpD  i il()t2urxr3iodlmee fvtlt) Drmxrpot4opx ioeiatlsDulu o;(0treomo ta1fptean s (0teumim oydlltemfcsl(fsrraurpou0aleniieilsla emnmo;u0alerxf3iadfat lies;t0 2xrir oo1omtelnes sfaDua(  nt0tle mi3iltfa2rmnmo;()alenifctydfatrlivslt0 2umxr ny4altelnet sfaDumurpno1oltnifciysls uau ont4altoxr3oa1late neo s)trxo(opiodoltnlnvt t)a2urx pno4open fciadla2ulnmpnu4aeenif3tatop eau i;t)srtmim3iudlmtelici t srtau  no1tlxo oeiltfa2elnvp u4teeomocootoptelieslt0teurir iydame  iei (f rrmx  ot1ope  icilt m2rauvo (0aetoxrctydoatran s;t  2urxo no1lp  mfvslt aDrm(r ou0aee mf3iad s uau p;u)trxnxf3oytfm eli s t)srumxm ou4amtemfctat  Drm(mont1tltnioeils mDemn on(4 reoxociydfpDrluvi (0 2xrirpny1ome liei s srtmxrpot1olxn ociyd s2elu s;t4 eenif3oo1lp raneo ()t2xr(r iy4op emfetls s2um(mono1oex ifetldlmDrmuvp t4aeenir3iotlmDelu sls0 rxo(m3iudlp e nvt t a2umu oot1tex  ictlsfm2emuvpnu) rtnmocoydlate nvo s0texoim3iy1llen icsatfsrua( p;o0optn o3ias mDelumont4teerxo3oytlp e neo s  exr(m3io4ol  mnctls a2taxm ;o1aeenmoctldlmDeaump;(4tetnxrcoodom   ivsl() euo(o3oo4lpe  nvtlsf rur(mp;t1teen ociltlsDrmn p t)trtrmrciotla eau o;s0 exo(mpoodalenlfcils  Duaxrp;u0oleo oeiydls emu pn(4altnmr oydfp  li ils s2uoxrpnodop nmics s  2raxroou4aee  oeiyd sDeln o (0teenxf iadop elivsl( s2trxopiydapt mivi ()s2rrumpno4olenifciatlm2ua(ms;u)areoif oydfatelueo s setmim3iudaptnmfctat  Drr(ronu0texn f3iytlm2ulums t4 lerif3tydfm  aiei;t0 exo(rpny1lpe  ictls aDraurooo4olenio3tat aDeauvs u4 reoxrciatomDe uvo;t  rumxo3iudalt lici t)a2tmurpnt0oetnifciltlm2umnmp;(0trtoircoa1fpt  uesls) 2to(m3oo1al n ivtls srtm( pot4tet mfetysfa uluvs;t)tltomociatomD  ivs;t)trxm(m iy4ole  nct tf Drm(mont0tlt  o3iad aDeln p u4trerxf3todfpD luei t0 exoxrpiudopt  net ()arra(  ;t1alen feiltla uluvsnu0aexnmrcia1oaDr ivol( t2umxo3iudamee feia(f rta(mp;u0texoiicilslmDumnmont4 ltrmo3oo1lm  aivs s s2xo(o ny4apenmicta()s2ur(ronu0alxn ieilslaDea(vs t4 etnmo oa1lpt  nvolt  exrir3oy1alenmnctasfa2trurpnt1opxnifeilt mDrm(ms u)tltrxo3tadfate iesls t2xrxm3nodameemnes tfartm(rono0ale  fciaslmDemu o;()trtnmrciotoaDeauesl(0t2umxo3nu1lmte ivtl(fs2rm(rp;t1altoioeiadfm rl(vs u)artomr tatlp raneils0t2uo(o3oo4olte nes s) Dra( ooo0teeomfctydlaDum( o (4tlxnmocoytop   ueil(  2ur(r oo1al   nvi t)aDumum oo1tpeomociysfmDemn p;u)trtnmr3totopD lnvi ()texmir iodam n fvias artmx o;o4opt  ieiytls rmuvpnu0trxomo3tytfatrln i;( t2xo(mpoodlp nlfetat  rua( o;t0aee ifetysfm2ran p () rxoxo3iodlaD au olt sruo(opoy1lpen iesls) Drrum nt0opxnifciad mDrlnmp;t4aexnifcoydfpDeli olt) rto(rpny4lmenlfvtlt  Dua( p;t0tex  oeildfm2ran on(0 etnio iytop  lnvil( t2xm(m3oodolt  fcil()aDrm( pnu1tlen fetltfs2rluvs t0tltnio3todlm e i i (  rtmim3oudll  mnvsas sDumxmp;u1aptn ocilt sDua(mo;(4areoir3tytlpDrli ils0trxo(o3ny1olen fetas s2uaur ;o0altoioctas m rm(mp;t)tetnioctadomt lieil()srurio3oo1olenlnet s  Drrxront4tet  feiat aDem(mp;(4tlxnif oydlpt  nei;s0trtm(m oo4amte fes t)a2uau p;o1olxnio3tltlm ua( s t4aetomf io1lm  aiesls0srxmir3iy1ale miciasfs2rru ono1oee mo3iys a2rl(von(4tltnmo3oydoptr nes;(0 exo(mpiy4ll nmfeilt) Duau ont0tlxnmiciasfa ra(mp;u0tlxomrctadfp elu ils srxriopoy1ole lictlsf rumumpnt4aeenmfctyd s um( snt4 ltrmocty1lm   nvslt  rxr(rpnu4lmeemncil(f rrrxm ou1apxomfeiasfs2ea( o;() lxrmf3ia1latean o;s s2uoim3oudome lnviasfs2rrumont0tlxo fcilsfmDea( on(0 reomocty1lm  luvs;t0 rxmio3iudlmte fetas s2urxr oo4tee iietysfa2rl(vp ()teerxocoodopDeai sl(0t2trxm ou4om e nci t) Dtmumoot4tpx  feiysfa2rluvo;(0 reoxoctytom  au s;s)srumxr3oydopen fetat aDrax p;o4tpenmoeiytls rl(vpnt) etomf3iydfpteaies;( trtrxrpny1ope mncsl(fsrtaxmpnu4apenmi3tasfm2um(vo;u4 exrmfcoadlpDe uvilt  rtr(r3no1lltn icias)aDumur nu4tpe ifetasfaDua(vs t4 lermo iy1fateau i s)t2uo(m3iodllenlnvtas)a2uaumoot1apxo octlt s2rl(mo;t)treoio totlmtelivs ()texoxmpnodapenlfviat sDrru o;t4tpxo oeilsfaDrm( s;t0tlenxo oo1lmt  ieols0trxm(m io1lltn nviatf 2tmump;t1opxomieild m2uln on() lerxr iotfpDrluvi;s0 2uo(o oy1lmt  iet sfaDrmxmono4apx  ieiasfs rl( ont4trxnxf3ta1oaDr nes s)s2urio no1oltnmicia() Dur( p;u1tlxo fetydfaDemn p u0areoiociadlmtr neo s tetoirpny4amt miet t sDrrxr no0alx  i3ildlsDem(vont0tlxrifciatopte n i;s seum(o3oydolee nvslt  2uaumpnu4tetniieils a2ul(vonu)teeoxf3io1opteaivs;t) exo(o3io4amtnmncsl()s2ta(m ;u1tpe ii3ilsfs2umnmsnt0texnmr iotfate ivi;( t2xmir3oo1am  livilt aDumumpou1tlto oeiyd m2ra(mp ()trtomr ta1laDrau ilt t2xoxmpnu1aptn ncsasf Draum nt4aee if3tytlaDrlu pnt0 eeoxo3oa1omDe u ils)t2tmxo nydop nmneta()a2urxmont0teen f3iad mDeanmp t0aeenxo oydfp ranei;( s2xrim3oy1lmen ncslt)a2raurp;o1tlto f3iatla2ra(vpn(4areoio3oydfpt  ueslt0setoim3nudlp elies t)s2uaurpnt4aet moctys sDumnmont)altomocto1lmDe i o;s0 exrxm iy4om emiei (f rrr(  ;t4tpe mieiat s2rln p;u0 rxnio ty1oa eai ols0 rtoir3nudlmee fcsas)srurumooo4aex if3ilsfs ran onu0 etomo tytopDelnvols0 euoirpoo4lp emncslt)s2trurpnu0texoifeiytfa ul(mont4 eermf to1faD  i o s)s2xrim3iudlme mncsl(f Dumu o;u4tee iociytfsDua(msn() lenio3io1omt  u sls0 rum(r3oy1lpeemfvsas) rtau pnt1aexoif3tas m2emn o t0trermf3totomDraues t)s2uoiopoodap nmivs tf 2tmx oot4aleoifcilt a rauvon(4trtrioctydfa elivo;()trxmir3oo4lmtnlieil()s2raumpnt1aeenif3tyt sDuau p;u)texnmf iytopte nvol(0 2xoim3iy4om  lnvtl( aruax pot1tee ifciad m rl( pnt) rerio3ta1fmt lnvi t0trxmxo3io1ameelivi (f 2taxm ;u0aexoioeildfsDelnvs;u) lenir3to1omtraivsls)setm(r3oo1lltnlieiltfsDtm(ronu4aptn fetldls2ua(mpnt)arerxr3oadlatraueil(0 rxr(m oy1amtelfcslt)s2tau  ;t0apeoif3tldfmDra(ms (4aetnio iydfmDe ivol(0 eurxo ou1opt lieil( aDrr(rpno0tee  ietls mDuln s;u)trtrxfctadla eluvilt0 rto(mpou1apeelivsa() rtr( pot4oeeo ieiatfsDrm(msn()arxnxocoytoa r ieo s) rtrxopiudam  livi sfarra( oou0aee ifeiasfaDelnvsnt4 lenmrciydlmteanvi;s0t2xm(m nudlp elfes sfa2um(mo;o1tltoio3iatfs2uanvo;u4trxrxo oa1oatr i i s) 2uoio3oodlmeemnvtlt) 2tmx pno4tptnif3tlsfsDelumonu4 ltomf3ia1fa rlu ilt0teumxm3iydlptemfcsat) 2umxr ;t4tpenii3tas aDua(vs (4 ltrio3iotoaDe nvsls0 etm(rpoydll  mfcia(  Dumuront4tleomoetyslaDrauvp;t0arenif io1lmDr n s;s) rxmxm3no1am nmnvta(f Dta(rpnu0tlenif3iysfs ulnvo;u0aeenmfciytom ranei s  exmir3ou4amen feil(  Dua( onu1optnifciytfs rmn p (0trxnmrcia1fptrai s;t  2xr(m iydlm  lnes ( s2ur( pot0tlt  oetysla uanmo (4 etoiocto1opteau s s)trxm(mpnydomeelivsas  2uauront1apxomoeiadla eaums;u4 rermr3ootoa  luvs t0t2xmir io1alt lici t artm( p;u0oltomo3ilsfaDra( on(4 ltomf3iadlmtrlnei t0srxrxopnu4om  mies () 2rmu onu0tpe iocildlm rmums;t0 rtnif io1la ean ilt t2uo(opoodom elnct s) rrauro;o0apeoii3iasls ulumonu4 eenmr iadoaDr u olt0t2tmio3oy4ome micsat) 2rm(  ot0olxomoeiadlaDran p;() rtomf3iadla   ueolt t2xoxrpiy1am  lfvilt)aDta(ro;t1oltomo3tatlmDranms t4texrmo oy1om eli i t s2ur(o3iu1aleelieils srrm( oou0openiiciyd a2rmu p;t)aexrirctytfp  an i;t s2toxmpou1lltelicsltf Draxm ;o0aleo fciltlaDrlnvs;u4aetrmr3oo1oa eln sls)s2xoxmpoy4al n fvtasf 2raxr ot4olxomiciasfa rlu o ()arermf3iodfaDelneils0trxmir iodomtnlivil() Draxroou4texomfciadfmDrmuvsnt0areomrciydopDr n o;t0 rumir3oydolee nesa() Drrx  nu4olenifciytfm2el(ms u4aleoir3tytlm   u i;(0teurio3nu4lp  lncs tfsrra(moot4opt  o3iytla2ranmo;t4 rxrxf3iotfa e uvsl(0 rur(r3nu4ol elnei sfarrmuronu1tpx mi3tasls2uauvs ()aleoif iodlaDeluei t)srtrir no1amt  fetasf rra(rp;o0aex  fctltlsDranvpnt4 ltomf3oa1lpDe ues s t2ur(rpiydlm e ici (fs2tmxr ou0olxoioeilsfs umn p t) ltrxf3iodlptranei t tetmxo3io4ole  fct ()srraxmpno0teto feiytfa2ua(mp;t0 eerxocty1lateanvs s t2uo(mpno1lp  mfci t a2uax oot1aeto f3tldls uauvp (4 ltoxocoytoaDrai i;t texrxopoydop elfvtl()s2um(  ;o4tlx iicilsfsDrlnvsnu0trtomocoytfat  uvi;t0texoir nu1omeelfvtlt)a2tmurp;o4oeen feiad a2um( o;u4 lxrmocty1omDrauesl()srtriopoodalt lfes t  rua(mpoo0ape moctlsfaDemnvpn(0aeerio to1oaDr uvolt srto(o ny4lm n ncsls)artrur oo1aleo o3iltfm eau pnu0trxrir3tydlm rlivilt trur(o iudam e iei t artm( oou0tle  fetlsfm ua(vsnt)texrio oatlat  i ilt0t2xmir3oo4ome mnvtas  2rru o;t0alt iieilsla rauvp t0trenmrcoatfp e iei t seto(m3nudolt mfvi t a2tm(mpno4tpxnmietydlmDeluvs;u4trxoifcio1fmt an i;t  2tmiopno4am nlietlt)srrrxrpnu1altnmi3tytfsDrm( snt)teeoxo iytfm  luvi ()seuoirpno1oleemfvsa(f rur(rpnu0oexnmiciyt s2rlump (0texomfcta1op  lneo t)s2xrio3iydalen ici tf 2rrumpot0aee mo3tatfm2rmnvpnt0 lenircta1la eanei t0tetmxmpiy1apt mfesls aDrmx oou1apx mfeiad m2uau snt4artrxrcta1oaDeaueo;()srtm(rpou1lpenmfeias sruauronu0tltnii3ils m rlums u)teerxo ty1fp  anei;t0 ruo(mpny1omtemivtl()aDuax o;t1ale mictyt s eanvpnt4 etoio3oatoaDr nvolt)s2xmxmpou1lmeemfet ()aDurumpnu0tlx  ociysfs2uaums u4aeerxociy1lpt li s s)seuoirpoy1lp   fes t a2urump;u0olx iiciadlmDulu on()trenmr3oadlmDr ues;t0 etr(r3nu4opt  icil()sDtax  ou4opxn ieiysfm rluvont)teenxf3ta1om  lieils)srur(o io4am nlivsa()sDrru ooo0opeo i3iydfmDulnvpnu0altoxo oatfat livo;t0trxo(o3iy1omenmnci s arrmu  ;t4oleoifetldlmDeau p;t0altoxocoydfaDeanvi s0 eumxmpny4olt  nvtl( sruax pnu4apenioeildfa2ean s;(4arxoxf totoatrauvo s) euoxrpoydoltemivia( srta( pnt1ape mi3iys aDea(vp u0 etomo3oodom r nvo;t  2uoir3ou4optemics s)sDurxrpoo4oetomi3tyt s2rmn on()artnir3tydlp raieo t  2umir nu1opeemfcs (  rtaumpoo1openmocils a2ua( p u)trtnxf tydlp rln i t0t2xoxm nu4olen net s s2umumono4texomfctldfs ul( ont4aetnxo oadlpte ueo s)srtmiopnodlptnliet s)s2rmxr ot0oexnmfetad m raumo;t4 renxf io1oaDrau o;s) 2xo(r3iydal nmfeil(fa2taxront4oleo i3ilt s2emu s u0 rtrxo ta1laDrln o (0srtrxopoy1lmtelfei t)arrau ont4teeomo3iltfs uln on()arxrio3totfm  ln o;( texrxo3nu1openlicsat) 2tru p;o1aleo icildlaDrmnvs;(4treoxr ta1fp elivil(0 2xm(r3oo1llenlnvsa(farrrurpoo4olxo oeiyd a uluvp;t4 renir iatlp  livo s  2ur(opio1ap n ivslt s2umuroou1opxniicils mDeanmonu0aetrmo3ta1fpDrli sl(  eum(rpny4amt  net s)sDtaxrp;t4oeen iciltfa ranvsnu)tlerxr3ty1fp rau ols seumxo iodllt  ici (fa2raxr ou1alt iocildfa2ulums u0 lxnxrctodfa e u i;t)srtmxr3iu1olee iesas)srrmxro;t1optomfetadfs elnvo t0 exrxociatoptrluvils)teumimpiy1apenmici ( a2rrumpnu4aeeo ietysfmDeluvonu)tlxnmr iodfatran ils  rxo(o ou1ome mictat)sDumx o;u1olto ietytfsDelu on()texrxocoy1fat lueols) exmxr3ny4ape  fvt ( s2uaxmpoo0aee moetasfa elnmont4trtrmf3ia1oaDranesls)s2xrir3io4lmenmfctl( s2tmxr nt0apxo f3iys mDrlnvs;(0 ltrifctotfp rlu o s s2xoirpoo4lpe  fvia(f Durxrono4aetn icils a rauvo t4 rtnmf3iy1omtran i s) 2tmim iodope mfes (fa2uax oot0olxnioctlt s2uluvs;u)texoif3tatfmDe i il( truoxr oo4olte ics t)artaurpno1teenifeiyd s2em( sn(4aexnio totfateanvs;s seto(o iy1lptn iviat  2tm(m nt4ape ii3iyslsDrluvsn(4 exnmr3totom rlneo;s0srumirpoy4am emici (fs2rr(r ;o0tpxo feiyt a2ulumo t0arenxr3iadfp raneo s)tetrxo oudlmenmivils)aDtrxm no1tlt  iciadlm em(mpnt) rtnxfcoa1fmD an ilt) 2xoio iodom nlfeslsfsrraxr ;t4oet mociytlsDum(von()tlxnir oy1faDr iei t) 2xoxopiudapee nvsltfaDtruro;t1opxomi3iatls2emuvs u0alenir oa1oa r nvilt0s2trxr ou4apenlneias) Dumxrpnt0opxnmieilsfs ua(ms;(4tlxrxo3tytlaDelieols0s2tm(r nu4ole  ivt s  rta(m nt1tlen o3ilsla2eln p;(4tleniocoo1faD lu o;s0trxoim iy4amen nes () ruax oot4oeeomfeiltfa2um(vo u)trxnxo3oo1lmDrlnes ( tetmxrpoo4llen fvt (fs2taxr ot4tpeoifciysfmDrm(vs;t0trxniocoadla  au o;t  2um(m iy1lle licsl(f rtm( o;u4open iciytfs2umnvs;(4 eeoio oa1lmDrauvsls  rxm(o oodlpen nvsls)arra(mo;o1tlx  o3tls m um(mo;u4texrmf3tadlpt an o t) 2xmxm ny1oltelfetls a2urum nt0aleo f3ildfmDuln o;t4 rtrmo oytfate nvs;t)srxr(m3io4op   feiasfaDtaumoou4ale  ociat m2rlnmp;t) exnmr3oatoptrluesl()seur(opny4alt  ivt (fsrrm( o;t0alenmoctatlmDran s;(4aeenxr3oo1fmDrauvilt)srum(o iu1omenlnctat) ruax  ;t4tetnmfeiadfs2el( o u)arenif oy1lmt auvi ()s2um(o oy4amtnlfvs s) rrrxr ;t0alx moctatfa ulnmo;u0texrmf oatfmt lu sl(0s2trio3no1aptn ict tfaDum(ront0alt mo3iadlsDean pnt4arermr3oadlpDe uvs s s2xoxo3ou4altn fciltf rrm(mooo0tptnioctytlsDuluvpn(0arermf3oo1opteaueo ( tetrxm3ou1alenlfetl(faDum(mo;t4aptn oeilsla2ulnmp;()aexnmo3ia1oaDrliei;t)seumir3iy1alt lfci ( srrmum ;u0alxn fctlsfsDrlu onu)tetnioctodfa  an o;s)s2trxo3iy4lp  lnvs (faDum(  nu0tlto f3tad a2umnmp t)trtrmrctodoaD luvs s t2ur(rpnodapte ivs tfsrtax pno4tpeoio3tyd s ul( p;u0tleoif3iadop eanes s0 2urir3ny4aptn nesl(fartrum ou0aleomi3ilt sDul(mo;t) rxrmr3ty1fp r ueols0srtoxmpio1omtelivta( aruaum ou4apen f3iyt s2elumsnu4tetrxocio1lmDeli i;(0 2ur(o iy4ol e ietlsf 2raxmoou4oetn f3iyd aDra( o;(0 etoxoctatoaD lueols) rtoirpiy4lp nlieslt)s2rrum oo0aexo ietltlm rau p;t4texrxf ty1fa r u o;s srxo(r3oy1omee ietlt) rur(  ;t1tlenifeild a umnvs u)aetrxr3oatfm raivo;(  rxoirpoydal n icta(  Dum(mpou1tex iociad sDuaumont4tetnxr ty1laDr ueils  2um(o3no4lp   icils) 2rrxr nu1aexniietasfaDumuvo;(4aeenxr to1opt livilt  2xr(m3oudal  lictls a2raumpot4ape mi3iatls rlu onu0 leoxoctodom e uei;t0 eur(m3oodolt mnvsl(  ruau poo4oleo iciltfmDumu onu0treoif oadom   ues t0t2xm(opoo4ap nmieia(faDumum ou1tlxnmfetaslmDua(vs;u0texoifcia1fmDe neo;s teto(mpiydal nlncsl( artr( pot0opt  fctls mDuanvp u)tlxrmfcta1fmDrlnvi t t2xoxr3nu1ll elfci () 2rm(moot1apeoioeiyd m ua(vp;t)trxnmrcty1fm  luvol() 2xm(o ny1aptemfvs tfa2ua(rpnt4olxnioetltlm rmu pnu) rxrxr3ia1opD lnvi;t) ruo(opnudlpt  fes s)a2rmxrpoo1oexnmiciyt m rln o () rxnxo ootfp  lnes;t) etmir3oydlpe liesat)srraxm ot1aex mociysfmDrauvsnt) renxo3todomD lueo;( s2tm(r nodllt mies sfa2umx oot1ole mi3iadfsDua(vo () ltrif iadomt  iei t  2toimpnodamt mnciat)a2rrx  ot0tpxnmiciasfaDean p u4aleoif3tatomt  nes;()trto(r io1lmt  ietas aDrr(rono1teeoioetyd aDelump;u4 rxnxr oadlmtraivo;( s2xmxrpoudam   fcsl(f Drrxr ou4opt moetysfaDel(vsnt)texnxo ootomt aivsl()s2toxo oudopenlfei () rrm( ooo1apenmo3ilt m uln s;(4aeenmr oa1opDe n i s0trtrir3iydom e ncsl()artrurpnu0oexomociadfsDea( onu0teenxf3iodfate u i ()sexo(opnydope  fetatfsrra( o;t1teeomoeiys m2uanmo;(0altomfcto1lptr u i;( sruoirpoodap  mivsls) rrmxr ;t1tee ioeiltlm2em(vsnu0trtomo oy1faDr u s;( srxm(opnudapte feia(fsDtaxrp;u1ope  o3iatfa elnvsnu)alxoxocootlaD  n i t)s2trxrpiodapee nvia() Dtm(moot4oeeoioeilt a2ua( p;()trtrxo ty1lpDe nvi;(  2tmirpoy1amt  icsat  Dra(m no0opxomi3tat a2umuvont4 etnio oadlpt  n i;(0teumio nodal elfvtat)aDtmx oot1oexniietysfa2um(mo t)aetnxrcoytlmtrluvs;(0srumio oo1ole  icsat)s2tm(m ;o0tpen feiys m eau o ()aeeoir iodoat  i i;s) 2xr(o no1opeelfet s) rrrx  ;t0aexo f3iltfmDum(ms;(0 rxoif3oodfp   ieo;(  2umim3ou1omtnmfcs s aDrr(moot0tetnif3tltla rlu pn()texnmr ia1fm eau o;s)trtr(m3iudlmtn nes t  rumumpno0tlxnio3iltfm2rmnmonu)trenmo ty1fpD an ols)srxo(mpio4apenlnvs s)s2trumont1tlen fcild mDrm(vs;u0trxoir oatfp r iesls trxmxrpoodop emnvs ( aDtmurooo1tex  fctytlm2ulums;u0 ltrxr3ootfpDeaies;( sruoir ou4aleelici (  rtrumo;o1aet iiciytls2ran on(4arerxrcta1oat auvo t)sexo(o oo1ap elivs s)srrm(  no4opxnmf3iltla2el(mo;(4arxrmr3todop  luvslt)srurio oy1ope mict (  2urumo;o4apxn fciatfmDuauvs;u4 lxoifciydfmtrlu ols  2trim3oodalenmfcil(  Dumumono0oeenmieiad a2um(ms;(4teenircia1oa elivo;s0 etrxm3iy1llt livias  Dtrurp;t4apxomoeiyt aDua( p (4altoxo ootlm eaieo;t0s2umxm ou1om e ivt t  rur(moou4texnmfctyslm2ea( on()artrif oydla eaivo t srxm(r ou1am  mivs s)a2rrxro;t4oeenmicildlm uluvs;u4trxoiocto1faD aieo;(0 2to(rpnu1ol  mivtatfs2tm(mo;t1oexoio3tls s rluvo;u4trxoxfcoydfaDr ueolt s2um(m no1ame mfci t)aDuaum nu4tpto i3iysls emu s;u0aexoircto1omDe nvilt)teurir io4amtemivi t srur(  ;u0tpt  oeiysfm2ra(vp;(4teerxociydoaDe ivils)t2ur(m nu4lp e neil(fa2rrx p;t4alen octadfaDumuvo (0aeenmfcoy1fp rau o (  rtr(mpio4lpe mnvsls) rur(r no4opx mfciyd m rm( s (0 lxnifcoo1oa  luvilt) rto(mpiy1llt mneta(  Drru poo4tlenioeilslm2eau o;u0 lxnxociydop  an il( sexrio iydome mnesa(  rtm(rpno0aleo oeiad s2rlu p t0 etnxr oytfm   i slt)s2toxr3oudol e fvi sf 2rrumo;t0olxnmi3tlsls um(mpn()aexrxoctytomD livolt) exm(m3iu1alt licslt) 2tax p;u0aptoiociat s2em(vpn(0trtrxrcoo1fpDr i i s0 2xo(o3oydlp  mfct t)s2rrxmooo0ope ioetltfs2el(mo t)tltoifcoy1opD lnvi t) euo(o oo1lle lnct s  Duau p;u1altomfeiltfm elnvo;u0 exnmrcoy1fpD  nvi t0srtmxopnydal nlfci ( s2umx oot1tle ioeiys a eanmpnt0 renio oa1opDelnvs t)srxmir no1opt  fvs t artmxmpou4aexo i3iys m2umums;(0 eenmo oytfp   ues;t) rxoio iudlpenlfvi s)sDurxmpnt1tpe  feilsls eauvp u)tlenmo oo1lpD aieo ( texoxo ny1lpen fvt s srtm(rpot0oltnmf3iatfs um(ms;u4 exnxr oydom eli i s)texoio3oudapen iesas a2tmumont1tpeo feiaslmDel(vo;()teeomr3oy1fpDeluvo s  exm(r3iy4lm  mfesls  Dtmx ooo1oleo o3iysfa ranmo;u4alerxr3iydlp  lnvi;( teuriopou4olee ics ()aDtrumpou1opx  fetat mDulnmsn()trtoxfcoodopt luvsl() 2xo(m oodopte ieiatfa2tmu  no1tle  i3ildfa em(monu)treoif3ta1oaDean ol(0trurio3no4oleemictls artmu o;o1ole iiciadls rlnmsn(0tltnmr oa1lm  auvols) 2umim no4opeelncils  rurumoou0apeoio3iydfa eanvp;t)trxrxo oydfm raueo;(0srto(o no1lpt  feia(faDrau oot1tlxnifetytlm emnvo ()arxrircia1omD lnvo s0sexoio io1om  mnciat) rtaxr nu0aexoio3tytfaDel(mont4 reoir3oa1oa eanei t s2xrxm3iudale mfvi s)sDtaurpoo4aetniieiytfa2elnmp u4tetnxf3to1fatrluei (0texoimpou1optelnci (f 2rru  ou4aetomieiatla2uauvs;u4 rxrmf tatfptrln o t0s2xm(o3iodaltelfet s) 2rmxr oo1texnmiciytfs rmnvs (4tltnxo ootfp eaieo;( s2uo(m3ny1lleemietl() rraxr ;u4tlxnmiciad a2eluvo;(0 rerxociotfm r uesl()trtrim3iy4lm elfcsas  2rmumont0oexn o3iatfa rl(ms u0alermrciadomD li sl(0t2trio nu1omtelnvi tfaruaumoot0olenii3iasls um(vpn()trtnmf totop ranesls0 rumio3no4ll elivi t arrm(ronu4ole  ieiyd a rm(ms;(0 etomr3ty1opDe nei;()teurxo3no4lp n feta(farua(r ;u0tpenifctlsfa uau p ()tetrir oadlmtean ols0 eurxo iu4ll   iei ( s2rruront0tle  f3iatfmDrl(mp;u4altoxfcoytoaD ai slt setoxmpou4oltnlnci ( s2tm(  no4oetn oetatla ul(mp t) eeriociydomD aueo t0t2toxo3ou1om nlivia()a2ua(rp;o0apx mo3ildls2umu o;t4trxrxfcto1oatrluei s sexrir iu1amt mict (fsDrrx pou1tle iietat a emn s;t4 lxnmr tatlmDran olt  rtoimpno4oltemncsasfsDtrxront4aleoifcils mDulumsn(4tlerxrcoy1omtrauvi t0srxm(o3oy4apenmnvsa(fa2tmx  no0alxoioeiatla2ea(msnt0 rtnxrcto1lp  liesls teto(opoy4apeelfcilt  rumu pnu0aetnif3ild m emnvpnu)areoxo3oodfatr uvs;t) eurxmpoy1amtelfes s  2rrxm ;u0aet mo3iysla em(vs (4arenmfciodlaDrau o () exoim3iy4lltemieilt)a2ra(rono4altn oeiltla2raumo u0trxrxr3tydlp e uvs s  rtoxrpiu1opee fvi tfsDua(ro;o0tpe  f3iytfs2uauvont)tleomrctatfp r neslt trtoxm3oy1ale  fctasfa2um(mpou1aex iociadla emump;u4tltrxf3ia1om   uvo (0 2xr(rpoodalee nesl()a2ua(  ;o0apxnmi3tldfm2uanmo u4areomrcoadoptranvils) exmxopnudlpee ietas srtr(  nt0apxomiciasls umuvp;(4 ltnxociytfm raivo t t2trxm3ny1lm   nesl(f 2tm(mp;u4optoifetyt m um(vp;t)texomrciadfaDrlneils0 rumimpoydlp nmfcil( artmu oou4opeo f3iatlmDem( snt4texoir totfa   ivilt0s2xrxo io4om elneils  2rmu oou0opeomf3taslm rau sn()altnir iy1fpD li ol(0t2um(m3iu4ll emnct s  2rmumpnu4tptoiociatlmDuau o;t0trtnxo oa1la r nvo;s)t2tr(opio1lp  miviat)sDumx pnu4opeoioctls sDem(mpnt4altomr3tatop e nvi t0seurim3oy1om nlncs tf Dum(ro;t0aptoifctadfm2ulnmpn()tetrmf oydlm  anvil( trxoxm3io4ol emiciat sDtrur ;o4olenmfctlt sDeanmo;(4 exrmr3iatfptelivo s0 exr(r nydal emiciltfsruaurpnu0oltnmfciyd m eanmpn()teermocoatlat lneo;s  rum(opoo4apt lnei () Dtrxrono4alt iietltfs2el(von(0aexnmr ta1lpDr ivols0seur(r nu1lptemivslt) rraxrp;t1tltomfeiadfs2ra(mpnu)trtnir oodlmD lu ol(0sexm(opoydal  lneils srurur ;u4opt  o3iydfs2umnvo;() etnir3iy1oa r ieolt0trxmxr iu1am elictas)srtax onu1oexnmo3ilt mDuan o (0altnmrcoatlaD lieo;(0teumxr3oo1lp elfctat sDtrx o;t4oexo octytfa2el( o;u4 rtomrcootlat auei;t0 etm(r3oydom   fvia( s2rmum no4tpx mieiydla uanvo (0alxoio3tatlpt lnvil() rtr(o3ny4ape lfvtasfaDtauroot0teen ictyd aDeln o;t4aeenif3todfm r nvs t trtmxr no4altnlict s) ruaum ;u1oex  o3tas mDul(mont4tlxrir3tatlp elu s s0setrxopoo4ope mnvsasfsrta(rpou4aet if3tys aDem(vs ()aetrir tadlp  aueo;( t2tr(mpnu1ll  mivias) 2ra(m nu4openmfciytlaDum( ont0altrif3iodom r ueo;() rxoiopno4ameemncs t  rtm(mp;t0apxnmo3ilsfmDelnvont0 ltrxr iatomDranvo () rum(r ou4omteliciat) Dur(mp;t0olxnif3ilt m emnmo;u4tlxnxr3oa1lm eanvo (0 ruoxrpoo1al  lfvs (fsrrm(m no4apxnii3iyt a2eauvp u4 ltrmrciydfpteluei ( t2ur(r3oo1lm  lfeias srtmxm ;o0ape  o3iys a2ulu snu4arxriocia1lpt lu s t0 rxmxr oy1lm n ivtls)a2rmu o;o1olt io3ilsls ua(vo;u0trxoir3tadoa elueo;()trtmiopou1altelneils)sDtr(ront1opxniictyt a uan p;t0 ltriociy1lmDrlivol(0seuo(m3nu4apeelneia()arumxmpou1oee ii3iat s ean p t4trxnxf iodlp e neslt  etrxm3iydamtelnctltfartr( o;t4oeto fetaslm rlnvpnu0trxoxfciytfpte u s;( setm(r3ny4olte ivia()sDuaxmoot1oeeoio3tydfmDelumo;(4alermf3oytoa elivo s  2toxopoydopenmneiltf Dtrxm no0opeo i3iltfs2el( s u4trermfcoatfm rluvs t trxo(o ou4omen iesasfs2tax onu1texomietydfm rmu p (4tltrircoa1lm ranvils) 2xr(o oo1lpen nviltfs2tmumpno1teeo ociydlsDea(ms;() reoif3tytoaDranvs s0 exr(o iu1lp  mietat  ruax  ;t1tpeoio3iytfmDra(msnu4trtoiociydfa raiei;t)srurio iudom nlnet (fa2ua(ro;u0tlxomicildlaDem( o u) exrxf3ia1la eli o s0s2trxo3ny1altemict t) 2urxr ot1alt mf3iyd s eau o (4altrxr iotfaD ln o t srum(r3io4omtemictat  Dtaxmoot0opxn fciysfaDemn o t4 rerxf tatfaDeauvo s)t2trxopnydam   ietlt  2raxrpno4teeo ieiys a2ran s;(0tltnmocoodfmDeluvi ( teuoir iu1llenmieilsf Durx p;o1apeoio3tat m el(mp u0arxnir3tytla rauvslt)teurxo iu1om   feils)s2ur( o;t0tpxomfciysfs ul(vs;(0 lxrirctadfaD lu o;( trxrxrpiudom n nvsatf Drrurpnt4tex mfciydfm rl(mpnu0arxoxf3oadfmte nvils)trtm(rpnu1apt  ies t aDtrxmpot0tle ii3tytfs eanvont) rerif iodopDraieslt)s2um(m3ny4aptelicil()srra(m ;u0alt ifeiyt m2uln s () ltrmf3to1fmDraues s0 rxrxo oy4ome  ieilt aDum(m nt4tptoiietytlm2rmu p;t)trxnxr3iadop e u o s)texrxrpnudole mivt tfarrmxrpnt4opxomoctadfa uan p;u)alenxrcoadfptrli i;(0 2tr(m3ou4ame mnctat  rumu p;t4optnio3tltfa2elums;t4trtrmf iydlmD auvi;(0 rtoxo3oy1amenmieslt)srra(moot0tpen fctydls ul(monu0 rtrir iadfp   ueilt) rum(mpio4openlfvils  rtm( ooo1ole  i3ilt a2um(vp u4alxomr3oo1laDr nei;s)s2uoxopoo1al emfct sf Dtaur nt1olxomi3iys aDuanmo;u0arxnmr ia1oaDe nvil(0t2um(m3nodll nlnvsl()a2rm( o;t0oetoio3iysla2rauvsnt) lxoio3iodfmD  n i;s setoir io4al e feils  Durxmoou4aetnif3tad m elumo;u4 eenircoadlaDrln o;t)trum(m3nydamen iciasfartr(m ot0ole mfctys sDeaums;() ltnxo oytlat aivilt sexoim iy1ol elfeslt)a2taump;t4tle ioetltlaDeluvs;t0tlxomr todlpD au ils s2xmiopnu1op nlfviatfarur(rono0opeo oetls s rauvs;t4 lxnircoatla e ueo t0 2tmir3no4lp e net t) 2tm(roou0olxnmf3iadfa ranvo;u4arerif io1opte uei ( t2umio3iudll nlivs tfs2tm(mpno0texn f3iltfs2em(mp u4arxomo ia1laDr n i (0trxmxm3oydoleemfes sfsrum(mpnt1aetn oeiadfmDeluvp;t)tlenxrcio1opD lieo;(  2xrxr iy1ll e ncia(  2ur(r nu0aetnif3tyd mDrauvp;u) eerxr3oytopD  nvi ( t2xrxr oy1apt  ivtlsfarua( p;t0olxoii3tlsfaDeluvp ()alxnif tydop r ueo t)s2xoirpiydap  lici s srtm(root1texn f3iysfmDrlumsnt4teenxfcty1fat  ieo s0 2tmxo oy1ame  nvslt a2trumono1tpeo f3ild s2rm(vp;u0 exrifcoatlpDr uvolt t2tr(o3nu4openlicils)s2tr( o;t4teen fetlsfsDua( pn(0 etriocia1opD  neo t0s2uo(r iy4al nmncil(faruauroou1tlt mieiat s rl(vp (4artrxo to1fmDeaiei;s0 2trxrpoo4lm   nvt (farrrumpno4tlxniocias sDumn onu) lxnxr ta1fp  an i;()teto(r nydamt  fvsa()sDtaxrpnt1tpxnmoctld a2rmn p (0 ltrxr3oytoaD anvs;s0 2toio3nu1am eliesasfsrrmurpoo0olen ocilt aDuan s t4aexnif3ootlpD lu sl(  rxrio3no4lpenmfeils)artmx  nu4tlenioeiyt mDumums t4artomf3ty1opDeaneolt) exoxm3oy1lm n icilt)sDrauro;o1tlenmociytla rln snu0aeenxfctodlmDelnvsl() etmir3nudam nmfesltfsDrr(m ot0tpt mo3iltls ulu ont)aetoio oadlptelneo t)t2xmxo3oo1ameelicils)sDumx p;u4tetnmietysfa elnvs;u4trxnir ta1oaDelnvs;t tetoxm ou4ol  mfet t arum( pou0oee ifeiat m2elu o;(4 lxomo tatlp elivslt0 2um(m3iy4om   neils aDra(mont4open octyt mDrauvp;t4texnif o
\ No newline at end of file
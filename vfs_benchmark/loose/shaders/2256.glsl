@@ -0,0 +1 @@
+nvi;t)sruo(o oy4lm nmivia(f Dtaumpnt0oeto o3iaslm ul( s;()alxnio3iydfaD lnvo s0s2umirpnodop n ivs s sDumxr ou0opxomfeils sDem(ms;() renmocoatomteauvi t) 2uoxmpoodap e fei t s2uaxmono1tpt ii3tltfs2umnvs u0 exrmf3iy1fpDelueolt)srtoirpno4om e ivslt)sDurxmpnt0tlen f3ildfa2uanvo t) rtrxo3ia1fp rluvi t0 2xriopno1al   ivtl(f rumu pou0aex iicilslaDul(von(0aleomo3io1la elivi ()s2umiopiu4am  miesasfarur(rp;t1ope  fctatlaDrln s (4 ltnmr3to1lpt  u sl( srxoxr3oy4ameelnvtlt artr(  ;o1tptniocilsfm2umums;u) rxrifcty1fpD an o;t truoir3no1ap nmivs () rtr(r ;u0ale iiciydla2em(vo;t0 reoxr oa1om raueol(  2xo(mpiydamtemfvtatf Drmxmpno1ope iocils sDuanmo u) exrxrctydopDraieo;s0 2umir3iydaptn iesasfs2rmu p;o4apeoifctyd m rluvp ()arerxfcoadfaDr nei;t  rto(mpio4lpt livtlt aDrrx o;u4tpxo oeiytfm ran snt0 eenmo3iadfmDr neolt s2uo(o iy4amte netls s2rmxrpou4tlt mocildfmDrl(mont0teenxr todlmt liesl( t2tr(opny4al nlnctas)a2ua( pou4aptnmietasfaDrlnvs (0treoir3oytlp  livo t srtm(r oy4omtnmietat srtmump;t0aeeomo3ias aDeauvo;t)artoxf ta1oateauvilt srur(rpiu1aleelnvsls) 2uaumono0tpxoiicils m2eln o;t4tlxrifcoy1lp rlivo;t0t2uo(opiodap nmfciat)aruaxmoou4aptnioeias sDeluvo (0artriocoodoa r n slt0s2umxmpoodamt mici t)a2rmumpnt0ole  f3iysfaDua( pn(4 rtomr to1lptrau o t0t2tr(r3no4ol  lnvt sfaDrr(rpnu4tleomfctltlm el(mpn()trxnxrctadopt livi t tetm(mpno4om  mfcs s arua(  nu0oltnioctldlsDeanvon() eermrcio1op rauvo t0t2urimpoy1lltemnvta()s2rr( onu0aptn feiydfsDemu snu0alxoif3iydoa rli o ( t2tm(m iudlptelivsls) rtmum ;t4oexo f3iyslm em( p (0alxrmf3ty1lmtrlivs s t2um(o3nu4open ivtls)s2rm( ono4tptoifciatfaDulnmp;t0tltnio3tatlp   i s ()srxriopoudlmtnmnetat)srum(  ;o4texoio3ilsls ea(mo;(4arxnio3ty1lpD anvo;() ruoir iy1optnliviltfa2tmuro;o4altoiicias a2ea(vsnu4artoio iadopDelnvi () rtoxm3iy1aleemfcils s2rm( ont4tpen ictytfa rl(mp (4teerxf to1oaDeluvols srxrxo3iy4open fvil()aDum(r ;t1tleomieilt mDrmnmpnt0arxrxr oodlmD  ivs;s0texo(o iodameelivs (fs2uaum ;u0opt  ociyd aDrm(mo;t4texomr3oydfp r u i;t0seum(o oydlmtnlivt (  2umx pnu0aee mociatfmDeauvo;u)tltomr tytfmt  nvols)t2xmxr iudaptelfesl(farrau  ot0alen i3iltfm ul(vont)texrxo tatop   ieo;s) euoir3no1ale lfeiat  rtau  nt0tleomocils m2ra( o t4aeenir oydop   neils truo(rpoo4aptemnvt sfsDtmx  no4tpx mfciasfsDemn s;u0arxnxrcoo1omteli o (  rxrio nydlle mivi s) 2rrx p;o4opx ifciatla ra(msnu0trxrmfctadfa elnes t0sruoxr ny4am n icsl( s2rau o;t1tpxnifcildla2rlu o (4 eeomf3iatfpD aueslt)srumim3oo1ape mictltf rrrxm no0oexnii3iltfa ran s;t0arxnirctodlpDelieo t0 rtmio io1ope  ietasfaDrm(mo;o4ope ioctat s rln onu0altoxocoo1omteln s;s trtrxr no1alen feilsfs2raurooo1tee moetlsfs2elnvp t)aeermr iotlpDraivi;t) 2to(mpiodop  mieslt  rurxr ;u4optnmfeiatfa2uanmp (0arxrxr todoatrlivi;t0sexmxm oy4ope mfcsatfsDrmxr nu4alt  oeild aDrluvont4 eermocio1fa eaivo;t0setmirpiu4lm emiet () rra(  no0oet moeiydlm2emumo (0 etomrcoatomD  i i;t trxoio3nu1op emies s) Duauro;o0oet iicild sDrluvo;(0altrir3iytop elu s;(0s2ur(m3no4op emietatfaDtmurp;u4aex mo3ild aDea(mp;u) rxnxf tatomDrauei () 2triopiy4ll  lfet (faDtau poo0olxo iciytla um(vsnt4arxomfctodfm   nes t seuoimpoudal n ivs t)sDuaumpno1apeomi3tyd a2eauvo;t4tetriocoadfmt anvs s0srur(r3iu4lmt mivtat  rtmxr ot1aeeniieild m2ranvs u)trxomf ia1fm rauvo t0teum(o iodalenmicia() 2tr(mpno1oltnmoetad m2eanmpnt0texnio iotopte ieil()trxm(m no4omt  ivilsfaDum(ro;o1tlxoii3tat aDuan p;t)alenio totomtelneo ()setr(r oy4ll emivia(fsDumxm nu1tle  oeiatla2rl(vs t)trxoxo oa1oa   i il( trxr(mpou1ll emnci ()aDraxr ;t0tltoiieias aDem(ms t)tetnmf iatomtr n ilt0srtr(o ny4al nmnciltfa2urumo;o4oexn i3iasfa umums;u4 renxrcto1oatr nvs;(  rtrio iy1opeelnei tfa2tm(ronu0tetoii3iasfs rmn p (4 reoio3oo1fp elu sl(0srxr(rpiydlpe lfvsasfsDtr(mo;o0opxoioeiadfs el( pn() etomr3tatopD anvi s0trtmiopio1am  mfei s)sDur(rooo1oetnmociyd mDrlu pnu0teenxoctydoa rlivs ()texr(o oo1om e fcsas aDurxroot1optoif3iydls2emu o t0trxnir3iotla   ivs t) 2uoimpiu1ol  lfeiltfsDtaumono4apeomoetadfaDeanvonu0trtrxfcoadoaDeaivi;t trto(r3iydal n ivils srumx p;t4tleo ictyd mDrmn p;u) exrio iy1lmDe ueil(  rxoxo3oo1llee neil(f rrmump;u1tpeo iciysfaDeanvpnu) lxrmo3oadlpD lueo s  rto(m oudoltemivsls s2uax p;t1oex  feiydla elnvs;(0aetoxrcia1fmtr ivsl(0srtoio oodlpen nes ()sDuax  nu1ole if3iadlm2um(msnu4trxnmo totfmDe ivsl( srur(opny4optnlietasf Drmurpot0apxoifetlt aDumu p (0aeenio tytop  lu s;( s2xoim nu1amt mfci s)aDurur nu0aetomoetld sDel( o;t) rxoir3totlmtelnesl() 2xoxrpiy1lptnmnvt ( aDtmurpou0aeeo ocildfm umnvpn()trtomo tydfpt  ivs;(0trurirpoo4om emncs ()aDtmxr ;u4tee miciydfa raumonu0alenxo oadop  aieol( srtmimpoudol nmnvtls sDrm(  ;u0olx iieiatlaDean p u0 etnir iotlmtr u o t t2xo(rpiy1olenmicia( sruau oot0tle  ictlsfm2rmump (4altrxo io1oat  i i (0srum(m3nu1apenmivta(f rtrxmp;u4optnmfeiat mDra(ms t4artnmocoo1laDeanei () 2xmir nu1llenmfeiltfsrurur nu0tlxniocild s2el(vs t4teerxf3oytfmt  neils) 2trxopio4omt  net s artaur oo1tltniociatfmDemumonu4 rxnifcoo1laDe uvs;s texmim3ou4om  mictl(  Dum(r oo1oetnmoetlsfaDeanvs t0 ltnxrciodlmte i i;t trtrxrpiydlmenlnvtl(fsrtmu p;u1tpxnmictld s rlnms;(4aexrir3iy1opD lnvo (0sexrio nudam nlfes (f ruau p;o4aetnifciydls ua( s (0arxnmf tatla rln il(0s2uoir oo4lpeelnvt t a2ur( oou0oltn i3iat aDel( o (0trxoif totfa r u i;s tetoxm ou1ameelfesa(  2rax ono1alxoifeiadls ua( o;() renmociytfp r u slt  2xr(m3oy1altemfvt t a2uaxmpnu4altnmieiydfs2ulnvo t4trxnmf3oodlp e ivsls  2uoiopiydlpt  fcslsfsrrr(ronu1aex  fciasla2elnmpn(4alxrio oatfatr n ilt)s2xoim io4om e ivsatfaDuau  ou1alen f3iat a rmnmont) exrxr oydfmDean s;t)teuo(r3nu4lptnmncs s  Draxr ;u0tltomoeiysfsDum(vsnu4texoifctadfm eluvi t srxr(opiy1am elicsls)arrm( onu0teeoii3iasfsDrm( s;u4 exnifcoadfp eauei s) rtmxm3oydolee nesl( aDrau pnt1tlx mfeiatla ranvsnu4 reoxo iy1latelueo s) rurxo iu4lleemicias)sDum(ro;t0alxnmieiyslaDrmumpnt0 ltnmo3tatfmt  ieo;(0 2uoio oo4apenmfeilt) Dur(r ou0opxoiietltfs elnvs;u0aeenmfcoo1faD aueo;t)t2xoxrpoo4alenmivi t  2rmxmp;t0aet ifciytlaDeauvp u)trtrifcta1omD aneil(  2ur(r3nodal  mnctls) rua(mono0aeeo icild a em( p t4 eeoifcoydom eanei (0srumiopou4lptemfet ( s2rm(rpou0optomociys a2rm(vsn(4 rtnxo3todoatraiei s)srxoir oy1llen fcia()a2urumo;o4apxniieilslaDemuvp;t4 etrio3oydfa e nei s seur(rpiy4lltn ivi tfaDtmu ono0tetomfeias m uanvpnt0tetrif3oodoa  an slt)srto(m oy4lpt licsls)a2ur(  no1aetnio3iad s uanmpnt)texoxfctytop eluvi;s) 2umir3iy4lp e ivs ()a2uru  ;u0tlxn o3tat s eanmpn(0 lenxf3ootopDrlnvs (  eurirpnydlpen ivsl()srumu  ;u1teto i3iasfa emuvs;t4 rxnxfcia1lptrlnvi t seuoxr iy1am nlnvils s2urxr ot1ape moeildfmDel( s t)altrir oa1lmt lies;s0s2tmir3oodomtn nes t)srrmx  nu0aeeomf3iyd a rlnmsn(0altnif3iadomt lieol(0srxmxr3no1lltnmicils sDrmx oot1oeen o3ilsfaDuanmp;t4tlxoxf3tydoaD livsls t2xrxr3nu4omenmnvtl(f 2uaum ;o4tltnii3iydlm2uaump;(0artomrcoy1oa e ueo;( t2trim3iydal n nct s  rrmumpnu4tlxn ociytla2eanmo;t)tleoifcio1opt  ieo;s sexrxmpnu4ol n ict sfs2tr( ooo4teto ietltlm rlump () ltnxf3tadomteli ols  etrxm ou1lpte iciat a2rax p;t0aex iieiydla2elu pn(4alxrmr oo1omD  n s t t2um(o iy1apte nvias) rumu  oo4ale  f3iat m rmn o (4trermfcty1faDe ivs;s)srxrim oo1alt mfvils)sDuax o;o4ale  o3iadfm2rau s;t0texoir iy1om r ivs s srxr(o nu4lpeeliei t)s2raxrp;u1oleo fetls sDum( s;t)tetnif3oodfa  lnvi t)srxrio oodomte fcilt)a2ra(rp;u4alxnifctydfm raumont4aeerxfcootfp elu s (  rxrim3ou1opeemncs (f 2tauro;t1alxnii3iaslsDulu s;t4texrxfciytfa  lnes;s0srurxrpiudopenmfcsl(fa2uaum ou0texniociasfa ea(vont0 ltnif3totfat  u ils)sexr(o iu4llt lfeiat)artrx ooo4tltn oeiltla2emnvpn() reriociotlmDean ils)t2umxmpoo1llt  iciat  2ur(rp;t4alxo f3ilsfs2rl(vp t4altrxf3oodfpteai s s)srxrir oudlmenmivtls) Dtrxr no4tlxn feildlaDra(mo;t)aeeomo3tytla r nvo;()setr(mpno4lmeemnvs t  ruaxrpno4oltomo3tyslsDul( s;u4treriociytlaDr neols0s2toim3iudopenmfes sf 2umxm nu4oexn feiat aDul(vsnu4altnif3todfpDr ueilt0 rurxo3no4al nmfetat)sDtmx  nu1tpxomi3tydfm ra(vpnt)alenif3to1om r nvi;t)trtmir nu1opt lfcs s)sDuaumoou0tetnmoctydfsDrmump;t0tltrmf3ta1lpDranes;t0srumxm3iy4apt  iviasfs2raxr ;t0opxoifeiadlmDelu s;(0tltnxocoy1lptraneols srtr(r3oo4lp nlivt t)sruaxmpnt4olxnmfctatfa2eaumon()aetoxr3ia1fpt anvolt0srtriopnu4omt mivs ( srtrumoou1aetoiociysfmDemu sn()tlxnio3oatomD lu ols srur(m iudlmtnlfct t)a2raurp;o4aeeoiieiytfm2rl(msn() ltrxf3to1fmt liei t tetr(mpnydlmen nes ( a2urumo;o0tet  feiyslsDrlums;(4 exnmf3ta1fp eau o (  etm(mpiu1alt  fvt t  rtr(monu0aex mociatla em(monu)alxoxr3iodfa  luei t seuoxrpnu4optn icsls)sDrmur nt4aexoiieiad sDrlumo u) lxrxr iatfatranvs;(0 2xm(opoudol n nvtl(  rumumpou4altnmictasfmDul(vont)trerxo3oa1lmtelieols setmxmpiu4ome  fcsa()srtm( pot4opt  fetysfaDemuvonu0trtnmrciydfaDrlnei;t)teuoxr nydam nlfetasf Dumx  ;u1apt mfctat mDeauvs;t4tetrmo3to1lmt au s t) etm(opny1alenlfciasfaDum(  nu4altniietasfaDean s u4teeomf3oa1fpD au o s0trtrio3iy1omtelici t srumu oot4tltnmfciadlmDrmnvs t) leoxfcoo1lpDelnvo;( trtmir3nydaltemfvsltfartrumo;t4aeto f3iadfa em(mp t) rxrxo oy1lmDe uvs (0t2uoxo ny4apt  icils) 2rr(mp;o1apeo ocildla rlnmp;()tlermo3ta1op eaieol(  2toirpnydol n ict t a2umurono4ope io3ilsfaDrmump;t4aetoir oa1faD lneo ()trtmxrpoo1alenmneslt)sDurxm nu4oex  f3iyd sDumnmp (0 etrio ta1omD  nvsls)tetr(rpiy4ll e nvt t)srtaxm ou0opxnmf3iyslsDum(vp (4treomr ootom eln s;(0srtoxrpiu4om  mfetatfaDua(m ot4olx  i3tyd s rm(vsnu4aeerxoctotfp ean ilt0 eto(m iy1ol  mneils) rtrx pot0aetomo3iydla2ea(vs;u)tetoioctytfatranvs;t) 2xrxo3iu4lm elivsat)sDtax poo1aet  i3tytlsDrl(vo;u)trermoctydfpDrluvol()setr(mpnu1op n ivia( arrr(r ;u4aetnmfeiat m2um( snu0aexomf3io1omtrau i;s  exr(mpno4optelnetasfs2taxrpnt1apeomi3ild m2uluvont0alenircoy1lpt aivi;s) rtriopoodlp nmict s)srtmum no1oetnmo3iys s2uan pnt)tlxomo3tadfmt lneo;t0 2xmxo3ou4lp  mict s) 2tmur ou1tlxnmoetydfmDelu o;(4aeermoctydop raiei;(0srxr(o3ou4lmtelnetl( a2rrurpou4tpenmietltfa rln on()alxrxocoo1op r nvo;t teurimpnu1apenmieiasfa2trxmoot0tpxn o3iatfaDeln p;u)tleniocto1lpt anvi;t) exmirpoodlp   fet sfaDuaurpou0oltn fctltfaDrauvs ()aexrxf iodlm e ies t0trtmxrpoo1lp  lnvsl(fs2rm(  nu0oleo o3iysls el(monu0 exoir3ta1oaDraues s0tetr(r ou1op e fctatfsrrmurpnt0tlenmoeiydla uaumo;(0arxnmr3oatopte u s s tetrxo3io1lmtn fcsltfaDtaxro;o1apeoifctlsfs2umumo t)arerxo oytfpt lues;s sexoxrpiy1openlict tf Drm(rono4aetn f3tadlsDumuvs (0aetoxr3todopDrlues ()s2xmim3oo4lm  liei t s2umumont1ole mi3iadfa rm(vo;(4 exrio3iytfaD an s;t0tetm(o3io1lmtnlivtas)sDrmxrpno0apxnio3tatla ulu s u) lxrmo3oytfm eaieols seurxo oodlp elivt t) Dtrur nt1alxnioeiat aDelnvp t0areoxr3iatlmD aneolt)s2trxopiy1ol  mncsls) 2uaurp;o4apen i3iyt aDrmu o u0alenmo3ta1lat lnesls0t2tmim nodlpeelfctl() Dur( o;o0tltn fctaslsDrluvs;(0tltrifcoadfp eluei;s)t2tr(m iy4om  lietl(f Dum(m ;u1opxomfeils mDrl(vo;t4 eerxf3tadopDeaivols0 eumirpny1op e fvtasf 2taum nu0altoiictld a2rlnmsn(4altrmf3oadlp rauvi;() 2tmirpny1lmt lfesl(f 2ua(mo;o4oeen feiatfa2ulu s u0tlerir oy1oatr u s;t  etr(mpou1ol   fcsat) 2rr(m ;u1oetn iciat m2eaumo t4arenmf3ta1omDeanvi;s0texr(mpnu1lp emnct t) 2ra(rpot4aet mfetls s2el(vs (4 ltoif3tadfpt luvs t  exo(o io1openlneslsfarrmuroot1tlxnioetyt a2umu p;u4 rerxo tytlaDeauei;s)setmxm nudalen fctasfartmxmp;u1teenmieiltfs uanms;t)alerif ta1fpDeln i;()t2urir3oy4amtnlfvs sfsDtr(ro;u1oeeomo3iadfsDel(monu)tlxnmo iotlaDrlues ( t2urio3no4alenlnet t)s2ua(mont0ale mieils s eauvs;t0aetoxf oy1omtr ues t) exo(m3iy4ol nlfct tf 2tmxmo;t1oeto fetadfaDul( sn(4altniocia1oaDr i i;s trxmxr iy1lp  mnvsatfaruru  nu4oleoiocilsfs el(vs u)trtnifciadlatrai o (0 rtoir oudol  mieils s2uax onu4tlenmicild s2ua(vonu)tetrmr3io1fpDelneo;(0srtmxr3oo1lpte ncs sfarururont1oeenioeilsfmDrlnmonu0texomf tydfmDe uvil() rtm(o no4lmt lfvslt)a2ur(m ou0aeeomiciytfm2uaumo u) eenir3io1la eanvo ( setoirpiy1altemivsas)a2uru poo1tlxoiociltlm eaumonu4 lerif3io1om rlieil(0 exm(rpnodomeelfcsa()srumxr ;t1opxn oeiat s2eln p;u0altnmoctotfaDelu i;s  2tmxmpio1lleemfcilsfs2ur(m ;u1olt if3iat m emnvon()aexrifctatlm ran slt trto(m nodome lnet t a2tmumooo4tlxomoctlslsDem(mon(4trtrxr3to1lmte ivolt)trxoxr3nydalenmnvtltf rumxr nu1tlxo o3tad a um( p;u4 ltrmfcta1la  lnvo t)t2xo(opoo1ameelnvi t)arrrxm oo1apxo o3iydlm2ra(mp t4 reoxf to1fp  anesl( truoxrpio4openlivs s s2rm( oot1aptn fctasfm ua(vsn(0aeeoif3ia1omDr uei;t) 2xm(r oo1aptnlivtl( sDrmxr nt0ale  oeiatfsDum(vpnt)texnxr3ia1omtrlu i s0s2urim iu1llenlfcia(  2ua( oou4tetoioctldfm eauvo (0tlxnmo3oo1oaDran i t t2xoxr3oydlle livt tfsrrmumooo0tpt micils s2rm(monu0treoxociodomD an sls) 2xm(o oydamt micsls) 2ta(m ;u1oleomi3tat mDua(msnt)teeoxrcootomDrlivs;t0s2xmxm oy4ap  mfct sf 2ra(m nt4teeo o3iyt s ran on(4aeenmrctotla eaivil( t2tr(m oydapenmfvt t aruaumpnt0apxoif3ildfs2rlump;u4 rxnmo3to1omDelivo t) 2toir no4lp n ici ()s2rmu ont1oltnio3tytfa el(vs ()areomo3oy1fpt  u i (0 rtm(r3oy4omen nvsa() 2umxm nt1tpt iieiatlm rm(vo;u) rxnmo3iotfpt  ueo (0trtrxr3nu4ll  lfcia(fsrumu p;u4aetomo3iat a2ea(vs;(4 exrmrcoadlatelnei;() 2uoxr ou1ame lfcta()aDrrx  nt1alenioetltfa2rluvs u4trxoif3oydfateli i s)trumxopoy1apenlivt (f Drmum no1tlxniociat sDemn o;()trtrmf ty1omDr uei;s)texmim no1ole lieslsfaDurx  nu1aex ifctyt mDeanms u)artnxo3iodlp elnvi;t)s2uo(o nu4optn nci (f rrau onu1tlt iietls sDum( pnu0aleomr3totlmDe u i t0s2um(r no4ll  mfet ()aruaur ot0aeeoifcias aDra(vpnu)alxrxocoy1fptrlnvo;s)t2triopny4am n iet ()srurumonu1apxnmieiltls2rauvpnu0 reoir io1optrlnesls0 2trxm3nu4altnlfetl(faDtrum nt0apenmo3tld s2um(mp;t0trxoxfcta1fateauvo (  rum(o3oo1oltnlfet sfsrtrumpot1openmo3ildlmDea(mo t)aexnircootoaDranvi;() 2toir3iu4om  liet ()srtr(r nu0teeoifctls a2elnmp (4alenxfctytlm  anes s)trtm(r3no4ole livs () 2tau  ;t0altn ociltfsDem( s;u0tltomr iytlp r ieilt) 2to(opoy1ol  mfesa( srrrur oo0opxo fciat a2um( sn(0tetoio tydoat ai olt seumxrpoy4lle  ict (fsrum(m ;u4ole  i3tld s rluvp;(4aexnmrctytoaDelueo s s2tmir3iy4omtnlicslt  rrr(rp;u0alxo ieils a2el( pnu)tetrxr3oo1lmtr i o;s texmiopiydale mnet s  rurxmo;o1opx  f3tas mDra( sn(4trenif iodfptelues ( trxr(opiodamt mfcia(farrr( o;o0teeoio3iad a2ua(vs t0 lxoxfcty1lptr uvs;t) 2xoxrpoodlme  net s) rraurooo4tlen ietatlmDuau on() lerxo tytfpte nvi t s2xmimpiy1al elfvi s  2rrurp;o0tleomi3iyd m rmnmpnu0aexrmo3iodfm   u i;t t2um(m ou1lpte nvsas s2rau pno4oee  i3tyd sDeluvp;t)arxoiocto1lptr uei;t)setmxm nudaptelnvs ()sDrmurpno0tpe ioctasfmDeanvs;u0aetoio iatfm e n s t)s2tr(rpiy4llt  neilt  Dtaxmpnt4texnmo3iyd m2ea( on(4alxnmr oadop e ies;s  exrxo oo4alen ivtltfsDrru p;u1apxnmoetltlm umu s;u0tlxrxf3todop r ueo;( srto(mpnodlptn nviat a2tmuro;u0opt ii3tltfs2rln s t) rxrmr3iodfatraiesl() eumxmpny4omt  fetl()s2tru pno1opeo ieilsla2eln o;(0tlxnmo todoptelivs s)teurio iu1lle  nvta()sDrrxrp;o1aptoio3iad s rln s;t4 rtrif3ta1om rlnvil( srumxo io4lp elfcslsf Dtmumpnt4opx mocilslsDrm( onu4treoxf ta1opt luvs;t) rtmxrpiy4alenlfvs sfsrumxrp;u4aleoif3iatfm umuvo u4alxoxr oydlp e ivslt0srtoimpiy4lp elnvi s  Drmum ;u0alt mieiytlsDrln ont0 rtrio3tatlpt  nvs t0 rtrxm ny4ape micsa()arumxm nu1oet  i3ildlmDel( on(4 lxoxrciatomDelueo s0 exmxo3no1ame licsasfs2ur(ro;t1oltnio3tatla eanvs (0aleoiocoa1la elu s;s0s2xr(opny4amt  icias aDrau pou4olt iiciat a2emnmpnt4 eenmo3todfp  livsls) 2uo(mpnu1lmte ics t)s2um( pnt0opxomoeiysfmDuln p t)tetomf3todopD aies t)trtoir3iydap elicsas a2umuroot0opx  i3tas sDemuvs;u)trxniociodfmte n ols)trumiopno1omtn fciltfa2ua(  no1ope ii3ilsfs ua( o u)treoxo to1fp   uvo s0trurxo3oudaptelnvsl() ruaumo;u1altnifctat a2ranvs (0tetrxo tatlm e n i t0srurxr3oo4omt micsa()sDrmu ono1ope ifctasla2ra(vp u4arxoif3tadlp e u i t)srur(o3io1ol elics s a2um(m no1aexn ociad a umumonu0 eerxf3iodomD aneo t setmxopoy1ol  lnvias sDtr( p;t0tpt iietlt aDrmnmonu4 rtrxo3oytfaDrluvo t)t2toir3iodoltnlicias)sDum(rpnu1opxo fctaslmDrlu s u4aexnxrciotoa  luvs ( srurio3ny4lp nmietlt)srurx  no0teeomoetys m2umn o;t0 exnxrcoatfpD  ies;t)seurxm io1lpeemict ()srtaurpnt4opto f3ildlaDrm(ms;u)tlenxr3oydfmDr uei t0t2urxopoy1omte icsatfs2tmumo;o4alt  ociyd sDuauvo;u4 lxoioctotla rln s s  eurir3no1optelnctls) Dtmuro;t0oexo o3tasfaDranms;t0 rxrxr3oydoat lieilt  rurxm io1amee fvs t sDtrumpnt1oex ifctasfs umnmpnu) exnif oytlmD  ivslt0 2ur(rpiy1omtemfvils)artrxmooo1olto iciydlmDrauvs u4treoxfctadoaD  iesl(0trto(rpny1ol e fesas srtru  ou4tlt mi3tys m rlnvs t) reomociadfp  liei t srtoim nudaptemfesas)sDtmu poo0alx  ociydlsDrm(vo u4altrxfciydfa  auei ()t2xrxr nydom   feiat a2ra(  ;u0tptn o3tyt mDelnms;t0aexomf oo1oat  u sls) rtr(o3no1lmtnlncsa(faDta(mo;o1apenmieiyslsDra(mp t0areomfcio1fp e ieils0teuoxopnodomt mivi t srtmumooo1tpxniieils s2el(vsn()aetoir tatla eluvi;t)sexmxm nudopt lictlsfsrtaxmoot0oee  o3tys s ul(mp (0aetrxr3oodop   ivi t) 2uoio nydlmeelfeils)sDur(r ;u1tpenioctlslm2eln pn(0trtriocoodomDe n o;s)truo(r3ny1lme mnesa() Draxmpou0tpx iietlsfs ean p t)arerxocootlm eau i;()teurir3oodaptemfci sfa2rax  no0oeen f3iatfs rmnmont0 exomr totfaD lnvols)trtrio no4lpe mnvsas)sDtaumpou4tlxnmociltlmDrlumo;(0 rtomo iodfatelivsls)srto(opoudope livt ( artmx o;t1olt ifetldfm emnvo;u0aetrxo todfmDelneo s)t2to(r3no4al nmiet t)aDrmu  nu0tlxo ociadls umums;u0artnxo3oydfatr ies;s  rxm(m nudom emivilsfs2rmum ot1oetnifctls s2emumo ()arxoir3iydlmte ivol( tetoxo3ou4al nlncsl(f ruru  ;o0oltoii3iadfa rmuvont) rxnif3io1la raivsl()srxo(opny1omtn feta( s2ta( pot1olxnioetasfm rauvs u)aeenir3iytomDr ieo ( tetrim ou4ope  fvta() rtm(mpou4oleo i3tyd s ulu o t0tetrxr todlmtelivs s0 2ur(m3iu1aptelfctlt)aDur(r ;o4teto o3ilt aDean s u0tlermo totomtranvo;s)s2xrxr3oydaltn ivsas sDuaxr ot0opx ifetltfs2um( s ()aetnxfciytfatrlies;( s2umir3iu1omtemnciat aDuaxr ou4tlen feiat m umu s;t) leoxr3iytoa e i ol()sexmxo3oy4ape lnetasfsDrr(  ;o1tetnio3iltfa2em(mo;u)alxrircia1laD lnei;(0t2tmxr nu1om elnvias sDrmu  ;t1ape  ictytfmDuln p;t4 eermo3iy1fp   uvs;s)srumxrpnudop e fct t aruru  ot1alto ieiyt a2emuvpnt4 etrxr3iydlp elnvil(0 euo(opoo4ap  lietls)srra(m ot0alx iiciyd a el(ms t) exrirciydlatr nvslt) 2um(opou4oltnmnvt tfarua( ooo0apt  iciys sDranmp t0alxrmf oodfp eaiesl(0s2uoxopoo1amt lfeilt  rraurooo4oee if3ildfm2em(vo u0teeoxocta1omDr i o s0 eurio3oudameelnvt sfsruaumooo0tee  ocilt m ulnmp;u4arxnif todomt  uvi s0srumimpoudomtnlfetat) 2rru  ou0tpe  fctasfa2emn s;(4 ltnmo totlaD  i i t) 2uo(m oydam n fcs s arrru  ;t0olt mociyslaDrm( ont4altoxocoytfmD aieols0s2xmxm oo1open ics (fartm(  ou0apxn octltfm ran s;u)aetrif3tytopteln i t0texr(m3iudalte fes (  2um(moou1oexnifciatfaDeanvo (4 rtrmo ty1oateaneo t0texoxopou1lmee nei t sDua(rono0apx if3tldlm2ra(vs;t)tltoxr iotfa ran o t t2uoxmpiu4ameemfcsat) rtrumpot1tee  fciltfaDrl(ms;(4aetrxocoa1laD li sl() etr(mpnodol   ivtl()artm(mpoo1tlxnmoeiys sDrlnvs;t) lxnmfcoadlpt lnei ( t2tr(m3oydame miet tf 2urur ;o1aee  i3iadfsDemnmo;t0 renxo3iatoa raiei;t  eur(r3oy4lmee netatf rtr( oot1tpxomfciysfs2emu on(4aeenmr3iytfp e ieo;t) 2umiopoy1lmee icsls s2rrump;o0olen fciyd sDumuvs;u0areoxfctatfp e neslt0 2uoxr oo1al eliet tfaruaxrp;o4tleo ocild m emumsnu0arxrirciy1om rlueilt) ruoim3oo4altemivia(faDrmx pno0olt ifciadlmDua( p;t0teeniocty1fate i s t)s2tr(rpoo4om elnetls  ruru pnt4tltomo3ildfm ulu o;t)alxoif3ta1fm   ivols0srxoxr3nodal emfeiltfsDrm( ono4tpxnioetydfa eauvp t0 lenmr todomD ai olt srxr(o3no1amte fvslt) Duaxmpno1alx  oetlt mDuanvs;u0aeenir3tadlp r nesl(  exrxo3oydlltn neiasf rrmu oou0ape ifciltlsDeanmo (4tetnxocoytop rlnvolt)tetmxm3oo4optemnvia()aDtrx p;t4aexnif3iltfm ua(vp;t0 eenmo oo1faD au sls0trtrxo iudome liei sfs2rrumoou1aexo feilslm ua(vs;()aetnir to1fate neslt trtrxr3nu1apt lnvi sf rtaumpoo4texomociys mDrau s u0artnif3todopte nvi t teum(r nodopeelnvtls)aDra( o;t4oetnmoeiyt sDelnms;t4treoio iotoaDeauvs ( t2xo(r3iu4omtemnvsat)a2tm( oou0tptomo3tyt sDrlnvp (4trxoxfctytfmt aivi;() rtrir iydlme  ivsl( s2tax pnu4tpxniicilt mDum( snu)aexnmo oydlp   n il(  exo(rpny4apte nvtl(f rra(  nu1tet  o3ilt s umumpnt0texnxf iotlmD luvo;s) 2xmxr ou4lm  mneia( aruax o;o4texo octasla2emn o u0 lxnir oydlptrli ol(0sexm(r3nu4lmt  nvsl( aDra(m nt0tpxo octltls2elu s (0tlxnxrcoa1lp rluvsl()s2tmim ny1al  liesat s2rmxmont1aexnifeiat m ua( sn(4 rtnxrcoydoaDelnvs s) 2toxo oudam nlnes s a2tr(m nu1tpe mf3iydlaDuanvo ()texrxf iy1oa r ivils) 2tm(r oy4alte ieilsfarrm(  oo0oex mictldls2rau o;t4tetnmr to1lpDeanei;()seurxrpnu4ole mivtls s2umurp;u4tle  fciyt aDran snt4tltomfcoytfaDe ieils sexr(r no4omtelieiatfsDtaur ot4tlx ifctydls2el(mp u0tltoio oytoptraneils0setrxopiy4lptn iesl( srtr(r ;o4aet  ieiatfs2em( onu4 rtnir iadfp rlueo t0srtm(rpnydlp nmicsa(f rrrumooo1aee if3iaslmDrln snu)texrmr3todfpDr ivil(0t2xoio no4amt miet s)a2ua( o;t1apxo iciydfsDul(vs t) lerir3tydoatrln o t0srumirpny4ap   ietat) 2uaxrpnt4apt  ieiytlm2umnvsnt0altrio3tatfm rln il() 2xrir iudapen ivtls)arrmxr nu1oleniietat sDumnmo u4tlxrxr3ta1fp ean s;s) 2xmxmpiydomeelnvias)arrr(mpot1ape  i3ilslmDuanms t4arenxoctatfm eln o;(0srurxr ny1ame lfvias) Dra(r ;t1olxomoetadfa2raumsnt)tltrxr ta1lp  livol(0seuoxo3oo1amenlivs (f Drrx  no0olx moeiltfsDrauvs;u)aetrxo3oytomtr n i;(  exr(opny4omen ivsat)srtmxmono1aeenio3iadfm em(vsn(4tetoxo oadlatr nvs s  rtr(mpiudoltelfesa()a2tm(  no1opeomoctadfaDra(vo;(4aexnxocio1fmD aueo;t0trxoio oo1ape mnet t artr( onu1olto i3iyslaDelu on(4 lxoxfciytoaDrau o s)trto(r no1alenmfcils)sDuax ono4oet mfciyd sDeluvs;t) lenxf3tadom  aues;t) 2uoxmpoydaltnmfeia( s2ur(mono0oltniieiydls umumsn(0 rxrxfcio1laDeauvilt trtr(mpiu4oleemfes s) 2rmxmpnt1tpxnmi3ias m2rau s (4aetniocoodopD ai i;s seuo(r3oudope mictas)s2uau  ;u0tleoii3ilslsDul(mo ()altrio3ia1faDe nes t  ruo(mpno4ale lictl( aDua( poo0opxo ieiadfm ulu o;()alxoio iodlptran ilt t2tr(rpiodlmee ivsasf Dtr(root1oetn ociydlm ul( on(4aeeomo3iadfpDelues;t0t2xo(mpiy4lpe lfei t)artmur ;t0ole if3iad mDelumsn(0arenmrcoo1fptrauvi s0sexoxm3iu4lp  liesat)srurumoou4tlt  fetasls2ua(vp;u) renmr oadlmDr uvil(  rurio3nu1lmtnmivta( aDrmur oo4opeo ociatfsDean p (0 renmrcoa1lpDrauvols)trtrio3no1lm eliet (f Dua(mpnt0optnifeildlmDea(vs;(0 leoxr oa1oaD aivs ( s2xrxopiodamen netlsf Dumxroot1ape iociad aDumn o u4trerioctydoa rlu o s srxo(rpnu1ol  mfcsa() Dtau oot1alenif3iadfmDem(msnt0arenxo oodfateaivi;()trxr(r ny4am elnei sfsrurumpot1oeeomoetatls umnvs u0 etoxr3oo1fa   n ols teto(o oy1apt mneta() 2tmurp;u4tpeo f3tasfa2rluvo;(0 etrmo oadfpDe ivsls teumimpoy4llee icta(fsrtmu  ot0tptoifctytls ra( o u0trtrxrctytlpt  i sls)tetoxm ou1aptn fvi (  rua( ono1oetnmociydlm2ranmsnu0teenif totfmD  ueol()trtoim3nydlpeelnvsls) Dtmxmp;t1olxnmfeiasfs2uan o;(4tlerio3iodop e ivils  etmxm3nu1om   iesa(  Durur ;u4tee  iciltlsDrmn p (4arxoxo oatlm   ivs s trxoxmpiy1am  lfetas s2um(r no1oeeoifeilsls2ul( sn(0aetomf3to1fpteln il()s2tm(o3ny1ame mieiat  Duau  oo4aet ioeilt s2em(ms (0 exnmrcoa1lptrlieo;( texoirpno1lmeemnvsas aDua(m ot4apxoio3ils a ra( s;(0arenxf oa1lm eanvi ( tetoimpoodom  mivtl()srrmu ont4tpe  f3iad m2umn s t0alermf3to1oatr u i s0t2xrxr iydlmenlncs s)a2ur(r no1teeoiieiydfm2umu p ()tlermo ty1oa rauvsls0setoxo iydomenlivils  Dum(m ot1aee  i3ild m eluvo t)trenmo3ootlm e nes;t0trxoxm3iy1aptemfci s sDtm(m ;u1tpt  ociaslmDrm( s u0 eenir oa1fm   uvi;( trtoimpiodop elfviasfaDumuronu0olxoiieiadla2ean p u0 rermo3oadom e ivs ( t2to(rpiy1amenlietlt  Durum ;t1oeen ictld m2em(ms;(4tlermfcoy1latrluvi ()s2xmim3ny1om nmivs (f rtau o;o4texo i3ild aDrl( pnt0arerio todlmt li sl()s2xrxmpoy4lp elncsasfs2umx oou1apto fetlsfmDum(vp;t)tetnxf iadla  an o;s0s2trxrpoydom nlnes (f ruaum no4alto i3iadfsDulums t0 eeoxo oatomtrliei;(  2xoxr iy1am  lnvt () 2ua( ont0tleniieiltlm2umnmo (4areomo3ia1op  li slt0sruoxopiudlpee ncslt aDrruro;u4opxn f3iadfmDel(mp;t0tetrir tatlptelnvils0t2toxm3io1llte nvtat)srrmx pnu0tpeniiciys sDul( s;u4altriocoytoa   n o t0teum(r oo1am  mfcs s srumxmpno0tee  i3ilsfm2ulnms u)aetoxfcto1fp eai i t0trurxrpoy4omeemfcil(f 2tax p;t4apxo iciatfa2rl(vpnu0teenxr oadlmDelnvi t)teum(rpiudol nmfvslsf rrax  no0aeeo iciydfs2eanvp u0tetomf totfp r uvs;() 2toxo iu4amt lfeiat) Drmxmpou4aptomi3ildfaDrl( s u)texrmfcto1oa  auvs;t0s2urio3iydam   iet s) Drrxmono4alt ii3tld a ua(ms;u)aetomo3io1fa elu o (0s2umir3no4lltemfcil(faDtrx pnt4tee iietls s rau sn(0tltnxo tadlmDe nes;s  rum(mpiu4opeelfeiat  rra(r ;u0teenmo3ilsla2rlnmpnu)tleoxo3oadfpD  ieilt0trxo(rpou1amt mivta(fs2umxro;o4oex ioetlt m uln pn(4aetoif iydfp  an i t)t2uo(r oy4ol emictl()a2tauroot1altomi3ias aDulumo (0altoxf io1lmDe uvil()trto(o nodalenmieia(fsDumxm ou1olxoiietld mDel(ms;u0artomo tadfp e uvs () 2trxm oydal  lfet s  2uauroou0opt  feiydlmDeanmpnu4trtoxfcto1lm e uei t0 2toim3iu4lpt  neia( a2rrx pnt1oexoif3ias s2rauvo u) exnxo3io1lpD anes t  2to(m3ny1llenmicta(f 2raxm ot4aexnmoeilsfsDrau p u0 exoxf iadlaD  neo s)s2toio3nu4ap  mfci tf 2tmxmpou1tptnio3ilslsDrm( s u0 ltrxr oo1fpD  uvo s) rumxo3nudamt  fcsl(fa2tru  ;t0aexoii3tld mDumuvsnu4aexnio3iytfpDe uvs;s)texr(r3no1ap nlivt t aDur(r ou4tlt iociatla2rmn o t)texnif ty1fat li s;s0srxrir3iu4lltn nvtls)aDumumpnu0oee  octyt mDra(mon(4arxomr tydlmD  u o;t s2xrxr nudol  mfciasfa2taur nu1teto feild m ulnmont4altnxo3iydop e nvo;s0t2tmiopio4lm elnvsas sDtrx o;u1ape  i3tldfs2rmn on(4 rxnir3io1lptr neo (0s2toimpiodaltemfvsl( a2urump;o1aexn fciydfs em( o;t)artoxo3todoat an o (0 2xr(o3oydal emfvtat) rra(r ;u4opxomfctatlaDuluvp (0trxrxocty1omDelnvols)t2trxo3iudape  fct (fsrrau pot1tlx moeiyslsDrln s;(0alenxrciatlmt lu o;t t2urxo3nydame  nct ( s2tmur ;o4tpeoii3iys m2eauvp;()alenxr3oadfmD anvilt0s2urxr nu4lle  fei sfsrtm(rp;t0optomf3iatla rmnvp;()trxnxr3oatoaD aivsls)teur(o iydome mfeil() Dta(m ;u1opeo ictytfm2ean p t) etrxo3ty1fm rlieolt)srum(opiu1am e fctas) rtrumonu4oetn octyslm rmnvon()trxomr3oytlmDr ivs t0setoxr3nu4olt  iei t aruaurono1tltn feiyslsDemnmp;t) exnmocoydfp  li slt0seumirpiy4oltelnvils)a2trxrpou1alto fctadfsDul(mon()arenifcoa1fp e ivi;s  etrxrpnodlm nlfcs sfarrrx onu4oetn octld mDulnms;u4 eeomo iatopt anvs;( s2toim oy1aleemneil(fsDuru  no4aetniietasfs2rlnms () lxrxr3iy1oaD  uesl(  eumxm3iydop  mivil(  Dtm(m nt1tpxo i3tys a rmnms;t)trtoir ootomt  n s t  etrio3oodalt mfetat  2urxro;t0ale  i3tlslm2elu on() lenio ootlmD luei;t)srur(o3nudape  ivta()s2rm(r ;u1tlenifcilsfa2rln pnu4texoioctydop r ivo;s0trxoim3no1lm nmiei s) 2urur ;o1oexomi3taslm2uln o;u4 eeoxf3tydoptrauei;t0seumxo3oodol  lfvia(fa2trxro;o4apeo i3iadfa um(vo t) rtoif3to1lpt  ivslt) 2tmxopnu1lpte neiat) ruaurp;t1oex  fcildfa umu o;t0aeenxrcoy1fpDelues;s s2umir nydale mnei ()srrrumo;o4aetn f3tlt s ua(msnu)arxnxr iydfpDr ieo (0seuo(r3nydlltnmict tfs2ta( p;u0aptomo3ildfm el( snt0tlermr3oydfm rlueo ()teto(m3no1apen ncsl( s2trumoot4t
\ No newline at end of file
@@ -0,0 +1 @@
+iei;()sexoio3nodlleelfvs t sDumu pnu0tex iieiatfa2rlnmsnt) ltnxr ty1omt  uei;t)sexo(mpiydol nmiciat) ruau  ;o4oetnmf3ildfaDul(vp u)tlxrxr oatfatrli i t) 2xrir ou1al  lies s)s2tr(mo;u1oexoiiciyd sDem(vonu0tlerif oytfaDeluvs;t0teurxr3nu1om nlncs ()aDurumpoo4aexomfeiydfsDumnmo;t)altrmo ta1opt lnvs;(0trumxr iudlm n ivias) Drax  oo4teeo ociysfsDra( o (0texnxociatopte u o t)trxmxrpny1aleemnvs (f Dtru  ;o0opx ioeiys a2eauvp;t4 lerxo oatlpt  n slt)seumim3oydaleelietl() Dtaur ;t1tpeoifcilsfs2rmnvsnt0 lerxf iadlptelieilt  etm(opou1ap emncsl() rtmu oou4apt mf3ilslm2rmnmpnu0trtrmrcootomtrai o t s2uo(m3iudoltemncsltfsDta(rono0tpxniieiadfa2rm( o (4arxnmfcoa1omD ai o;s0trumirpoy1lpeemfeta( aDur( poo0apt ioeiyd a rmn on(4texnxf oy1fa   nvo;s0trur(o3iy4lptnmfct s) rtrx  nu0oeeomietat s2um(mp;()aexnxf iodoatr nes ()sexr(o3oo4lm   fcia(farumx p;o4tetnmieildfs rl( snt)alxnmrcia1fmt auvi ( tetoxopnu4amt mneta()sDumx  nu4aex  ieiltfm em( o;u0 etnio iy1oa e ivo s) rurxr3oo1olen nei s)aDumuroot4ope ifeiyt m eauvs;t)alxnmo iy1fp  luesls)sexm(r nu1lltelivilt arururooo0aeeo iciatfm umumon(4trerif tadlpte uvs;s seurxm io4lmeelicslsf Draur no4alto octatfm2eln p;u)tetnxr3iydlpDeauvolt0srtr(rpiudalt mivt t) Dtaxm nt1apeoio3ildfmDemuvs (0texrmf3tytfmD au ols0srurirpiu1apenmieias)sDtru p;t1opxomi3iltfa2um(mp;u) ltrmr oatlat au i;()t2tm(opoudol elicilt  Dua(moou4olto oeiadls2umu o;t0 eerio tydlpD ln o;s  2tmxmpoodalt mncia()sDumxrooo0tpenifeilsfm el(vp u)alxrmo3tytoa eaivi ( tetriopoo1apeemnvtl( aDurxr nt0ope  octlsfs rln snu)alxrmrcia1oa eluvol(  rum(m3oo4apt  ncias) Drmx ono0tlx  feilt sDelumo t4tetrif iydfpDe i s;s)trtmxr ou4omee ieia(  rum(ro;o4tle iietytlmDumuvsnt4tlerxf3oatfm rau s t0s2umim ou4lm emfet s) 2ua(r nu4aleomfetlsfs2ul( p t)tleoxr iytlpDrlieols) 2uoir3oodamtnlfeias)s2uaxmpoo1aetniociydlsDrm( s;u4arxnxo3ootfmDr uei t)t2uo(o3iu4al elfvta(  rrm(m ;o1texomoeiatfm ulu sn(4 reoxr3iy1optranvo;t0trur(r iydlmeemiesas sDtmx pno4teenioeiydfs rmnmo;t4aexrxo ia1lp e u s;(0 rumimpno4lm  licia(fs2umurpnu1oeenmfeiadfmDulnmont4trxnxf ty1fpDeaivi s0s2xm(m3ou4lmee ictl()a2raxr nu4tptnmi3iatlm rl(mpn(4alerir oadlm  lnvi;s  rtriopoodlme mfciat)sDrrxr no4tpx  ietas m2ra(mo;t)trxoirciatfpDrlu o;s sexo(r nudoltnlncilt  Drmu  ;t4tetomi3tlt aDul(vo;u)treriociytlpDrlnei (  2xmxmpno4om elfeil()sDtaxmpot0alen oeiad sDum(msnu4tleomf3todfp   neslt0 2trxm3no1lp  mncs sf rraumono1ole mieiyt a rl(vs;t)trtoxocoadoatr n i t sruoio3nu1amtnlicilt)arrmxm ;t0alt ifetls a2rl( pn(0texrirciy1lp eanvol(0 rxm(o3ou1lleelnvsl(f Dum( pnt1oexn ietys s2uanvp;t0tetrir3tadfm  aueo;() 2umxrpoudom emfetl( srur( onu0optoii3tadlsDumn ont4arenmr oytfmtraivil()s2um(o oo1op   ivsa(fsrrmx  ;u1oeen ociad a2eluvo;(0aexrifcio1fa raieolt)s2xr(r3io1omeelnvi (fsrtaxm nt1tle if3iad mDul( s;u0trtnmo ty1la r uvs;()sexoio3ny1ape mfvi s)sDtaxm ;u4optnmociad a2rluvpn()trtrmoctytopD aueolt0trxr(r3iu1lltelfetas)aDtmxr nt4oeeo ocild m2uaumo;t4 ltoir ta1fatr ieo;t srxoxr nydolenmfvilt)a2um( p;o4tpxoiociasfa2rlnmp;(4arxoirciodom   uvi;t seumxm ny1opee fetatfartr(mo;o0alen octysla uanmont4alxrir oodfm e iei;() 2trir3iudllte nci (fsDurxro;t4oee mf3ilsls2eau sn(0alenxr oodlp r u s;t  exrir3iy4olte fvslsfa2trx  nu0aptoiiciatfm2emn p t4alxrir tydfa elivslt0t2xmimpiudoltelict s)sDtax ont4openmiciydlaDea(vs;u0 lxnmfctodomt  n sl( tetoirpnodlltnmfeiat) rua( o;u1teen oetasls emuvsnt)aexnxr tytlpteluvs t) euo(o oy4olt  iviat)arrmu pou0tetn ieiad aDuanvs t)tlxoxo ta1lat ln i;t)trxrio3iudameemfvsls)a2taxm nt0aeenmfctld m elnms u0arxnxocoatfmD  nei s0teuo(r iy4lle mnei t) Drmur no0tltoiieiysfaDemn o;t)artrmfctatfmD  ivs;s)srumirpno1ol nmnesa( a2ra(mo;t0tlt moeiyd s2ea( sn()aeermf3iytlm  lnesls t2xmimpiydop  lnetl()arum(ro;u4tptnifeils aDra(vsnu4 eeoxf3tatoa  lnvs t trxmxm3nydaleemics tf rtrxmpoo0texniictatfs emnms u4 exomrcoadfp eanvil(0texrio oodalen ncsa(faruru p;o4tle mictldfm emn s;t4texoxfctadlp   u s;(0trto(m3oy1lmeemieiatfa2rrxmpnt0tlenmf3tldfm ulnmo;t)trtoio iotopt  i s;s0s2uo(o ou1om nlnvil()a2urx  ou4olx iietydfa2ean s (4aexomr iodfate ieils)t2umirpoy4omt  nci s)a2um( oou1ape mocilt s ranvo;t4 renifcoo1optran il(  rxoir3iodomtemfviat) 2ra( oot4tlx mo3tad a emu o t)areomr ty1fp   iei;(0srxm(m io4apenmfctlt  2rmuroot1oltnmo3tysfs2emnmo u)tlxnmr3tadfateluvs;(0s2trxm3nydome mfvia()srum( p;t0oet mieiys mDuanvo (4tlxnmf3tydfmte nvilt0srto(opou4alee iviltfs2taxmo;t4aptoif3tys aDrl(mp;u0artnif ia1fmt  nvo s0 rumxr oy4ameelfvias s2umurpoo0oltniiciyd a2ea(mp;(0trxrircoodomte nvs (  2tm(o no4om  lnesl() Dururooo0tlxn o3tld a eauvo u4 eenxr tadfpteluvi () eum(r3iu1opt lfvsa(fs2um(m nt4tlx  f3iasfa um(vpnt0 ltoxo ia1lm elueil(  rtoir ny4llee nct sf rurumpnu1opxnio3tat sDea(mp t0aexrir3oo1lmD anes s0 etoxopno4lp emfvt () ruaurono1olto ieils m uaums u0 etrmr3oytoaD liei;s)t2trir3io4olte icsls  2ta(  ;o4aleo ictatfmDemnvsn(0tlxrif3iotla  lnei s texoimpoudaltnlncia()sDurx o;u4oex mo3iat a umump u4aeeoxociydlm rlnvo;()trtoio iy4ole mfvt ( s2ra( oot0oee  ociltfa2rmuvo (4tltoirctydlm e nei s0t2umxrpoy4lmeelnvtls sDrrum nu1alxnii3ild a ulnvonu)aeenxrcty1lm eln s t0trxrio iy1lle mivt t s2trxmpoo4tlxnmi3ilt m ra(msnt) lxomo ta1opDeau sls0 ruoiopiudape lietls aDrau ooo1texomoetlsla2uaumsnt)artnxr tatom r uvs;t texoim3oo1lltnmiviatfs2rr( poo0aee  o3iyd m ea( snu) etrmo3iotfpte uei s)t2to(o iu4lp n nvs tf rra( pnt1tee  o3ildlm2rln p t4trxnifciodfp ranvilt sexo(m3oo1optnmfcsas)s2ua(r ;o1tlxo o3ias sDel(mon(4altnmr3oytoa r iei (0s2trxopno1opt lnvia( s2taxmoou4apt  feiasls uanmp;t4arxrxf3todla e ivolt  eumimpno4om n ictas aDrrxrpoo1apeoio3iatfm2emuvsnu)tlenxo3ta1lpDelivo;t) 2toimpio1ome mnvsl(fsrtrur ou4teeoifciadfa rlumpnu4 etnmr3oa1op ran i;s s2tm(mpio1openmncsls  rua(rooo1oex miciytfaDrmuvo;t)tlxoif3iytfa rli i t)texm(r3iudamt lieiltfaDtrumpno1tpeomociyt s em( ont4 etrmocoadfp rlnei;t0 rxmxopny1apt mnetlt s2urum no1aexnif3ild s2umnmon(4tltoxfctatfmtr uvi;(0sexoir3no4am emiciltfsrtrx onu0texoioctltfmDuanmp;(0 lermfcta1oat  uvi;s0 etriopiy4opt  fesl() rrm(ronu1teenmieiadfa2eanvp t)arerxfctotoa elu s (0seuoxrpiu1op n nesas s2rru pnu1opt mi3tydfa ranmont) etrmr io1oa rauvi (0 2xoir3nydlp   iei s)arua(r oo4tlen i3iydfs2ul(mpn() leoxo iy1fatelivs;()t2tmimpio1oltelfcia( s2rru p;o1apen fcildlm emn o u0aeeomr iotopt lnvsls)trurxr oy1lm  lfvilsfsruax o;t1tpe mi3iytfm2um(vpnu4teerxf3oodfa  livs s  2toxm iu4opt mnvi ()aDum(rp;o0olt mfeiad a2rmnvo u4 lxrmf iy1fpteliesls0setoio iydll nlnvt ()s2tmur ;t1aeeniicils s2rlu s ()trxnmf iatfmDelu sl()trurimpoudaltn ieiatfs2ra(r ot1texnmo3tld s el(vs t0tetoio3oodla  li i t0 eumim nudom e fcs ( srumum oo0tlxn ieilt s ua(vo;()altnxo iadlpteaivo;s0 eurio oy1lpe micsas)aDur(r oo1tex  ietls a2uanvpn() eermr oa1oa rlnes (0tetr(r io4op n neiltf Duax  oo4tlenmiciadfaDumnvp;u0aleoxr iy1op rln il(0 2xmio3iydlmee ncias aDrmxmo;u0olx ii3iadfm2emnvp;u4treoxoctydoatrlneils) etoimpoudop nmneta(  2urxmoou4oltnmieilsfsDem(mo (0 eenxr3oodfpte i i;s0teum(o oo1olt mfvsat) 2um(  ou4tleniiciys m2emumo t) lerio3oodfpt an i;t)setoir3nudope mnctltf Drrxmooo1tetoifeiatlm emnvo u4aetrxr3iydfmtean o ( s2uoiopiy4lp  mneslt)aDtmurp;t4oeeoio3iyd s emu p t0trenio oadop eanei t sexoxo3oudolee feiat s2rrur ;u1ale ifetlt a2uln s;u) etomrciydomDe ueo;s0 2trxo3oo1optelneta( artaxroou0tpx if3iytfs umu p (4 exnmr oytfmDelivi () ruoxr iodamtemiesl(fs2uau  ;u1alxnmieilsla ul(ms u4alxomrciy1fm e n ols)s2tr(opoy1ap nlnctltfs2umur ot4oex  ieiat a2umn s;u0aetrircia1opteln o;( trtoxrpoudapee icsl( aDtau  ;u1alt  oeilt m2emn onu0aleoxocoa1omDrli ilt teumim nudamtnmicsasf rrm(  oo1alt  octltla rm( s;t0tetnmo oa1opD lues (0teuo(r3no4lm n fctls)aDta( p;u1tlen o3ilt mDulnmo;t0tltrirciotfmD ln i;s)srxoirpio1omtnlfcs s s2ra(r oo0apxnmo3iydfs emums (0 etomf iotfptrlneils)truoxo oydalenmfcilt aDta( ont0aexn f3iasfm rm(mo;u) lermr tydlat  nes s s2toxr iy1aptelivi sfartaurpno0oee mfetadfa2el(ms (4arerio ootfpDrlu ilt0 2xrxmpiudam nlnct s sDurur ;u0teen i3tlslsDuauvp;t) rerir3ta1oa e ues (0 rtmim3ou1llt lfvsat aDrrx  no4oexoifctyd m2rau sn() rxnxr iy1fp eln i;s setrir3nodome  nvtltfartmump;t4opxoiocilsla uln o () rxomr3oadla  li o;s sexo(r3iodlpee fvilsfaDur(ro;t4tltnmf3ildfs2rmuvs (4 rtrif oy1fmtr iei t  exo(r3iodlmtnlfctat) rumxm ;o1oet  i3iatls2rmn s;t4 exoiocoo1latelieslt  rtrxm3ou1lmtnlies (fsrrr(  ou0optoio3tatfm ul(ms;()alxoxr tadoaDr ies (0 2uo(o3io4lle  ici (fs2rr(rp;t0aleo iciasfa2em(mp;(4 eeriociatlmDran sl() 2xmio oy1oltemivsa()aDrmumo;u4tlx  i3ilslm2ul(mo u) rtoxfcoo1fmD ai i;s0s2urio iu1lmt  nvta() 2rru  ot4opxo f3tyslmDrlnms u0 lenxf tytoaDraivo t0seum(r iu4alt lnctl()aDtr( ont1tpenifeils s ulump;(0 exrmo3tydfatr n il(  etoir oy1lle micia(f Dur(r ou1aexomoeiatla ul(vs;t4aexoircto1lpDrai i;s0srtoim3iy1alte ietat)s2uaxrono1olxomfcias aDeauvs;(0teeomrcoydlaD lnvo t t2xrxopny4ap   nvias) 2uau p;o0aexo ietysfmDel(mp u0tetoir3tadop eau olt  eum(o no1opee fctas)aDraxmp;o1aex io3tysls2elnvpnt0alxomrcty1om e n ols) 2xrim iy4om nlfctasf Dtr( p;u1opxomf3tadfm rmn p;t)aeermr tytfm  ai ols s2xo(o nydopenmnci t)a2um( p;o1alxomiciat aDraumo;(0trtrxr3oa1lmte ivs s0 rtoxr oy4omtnmicias a2rm(rpno0tpx ioetytfm2rauvsnt)trerxf3ia1omD lu il(  2uo(opoydol emfci s sDrr( pou4oetniiciasfa2umn s u0tleniociadoa rlu sls t2xm(mpoo4altnlictatf rta(rpno1oexoioetlsfsDuanvp;u)tlxomr iatlaDe neo;t trxmir3iodam  mnctat)a2umu o;u4aeeoii3iadfaDeln s;()alxrxo3iy1fp r nes;s0teuoiopio1ll e ics sfa2rruro;t4opxomieiyt a2rau s;u) rxoxoctadop eaivilt) eumim ou1amen nctlsfarrmum ;o1tlxomf3tyd a2rm(vs u4 lxnircootfmD  nvslt)t2xrim3oo1lpe lfeilt)srrmu oou4oexn ieiatfm umuvp;(0aetrifcty1fatranes;s0trtmirpoodome mfcias) rrrum nt0teto oetyd s2emnms;t) rxomocoodopDelieo;() ruoir oudoptnmncs t) Durxmo;t1tpt mfctyd a2eanvp u0arxomo oy1lm r ueo;t)srtr(o3oydapenmnei (fs2tau pot0altoif3iad m2eluvp;u)aeerif3tydfa r u i ( texr(r3ny1ale lictlsf rum(r ;t4tpeomo3tad sDea(mp t)arxnmf3iytlaD livi;(0 ruoxm iudlp   net tfa2ur( ono4ape iictadlm2rmnmp;t)teeomrciotop eanvs;t)t2xrxo3ny4altemnesas) Dra(  ;t1tltnmfeilsfs rl( sn(0 exoifctodfmDr n o t)teumxr ny1lleemietlt sruaur ;t4oltnmfeiyt m rmn p t4 lenxfctytomD  nes t0tetmxo3ny1ll  mfetlt) 2umxm ;o1tetomieiytlsDeluvpn()tltomo3totlmDeaiesls srtoxr3nu1op  licils  Dumurpnt0oexn i3iaslaDeanvp () rtoir3todom e ueo;s truoxopoodlp   ncs t)srumx  ou0tl
\ No newline at end of file
@@ -0,0 +1 @@
+uvi t tetm(r io4ol elieil(fsrrmumpno4oleoiieiydfa2rmnmo t)alxoxf io1faD luvs t srtrxopou1amt  icsltfs2trxr no0ole mfeiaslsDuau o;t)areoxf3iytfpDelueols)seur(o3no1ol e fcia()arurx pnu4aleo ociltfs uln pn()aexrir oydlm rliei;t)trum(r nudalt mies t sruaurp;o4opx  o3iydls2ra(mo;() leoir3tydopt  ivols setmirpiy1lmtelivil(  2uaxmpno0aleomf3iltls2ra( onu) lxnxr3iodomD auvs (0 exrxo3nu4am  lieil(farumxmp;u4apto i3ias a2ua(mon(4trtnmociydlpDrluvs;s  ruoir3iu1lltnliet s)srumx o;o1tpxnio3iadfa el(vs;t4 eenmo3tytfm  lueils0 2um(r oo1aleelict (fsrtmxr ;u1ope ifctldfm uan s t) lxoiocoadlatr nvi;s  eumxo nu4opeelfvils) rtaxmooo1altoifeilt mDua( s;t)arenmr tydopD aivo (0t2urirpnu4ol elfctasfsDumxmpoo0oleniiciasfs eau pnu4aexrmf3tytopt  iei t tetr(m3ou4lp nlfcs s)artmuront4alxomfcildlm uauvonu0 eenio oodlmtrau i;(0 2toimpny1om nmivi (fsDtaxr ot0oetomoetydfm ua(mp;t0tetoxo3oy1fa  lnes (0 rur(o3nu1ol nmfvi s)sDumxmp;t4altnmfctadfs rl(msn(4 exoxrcoa1faDranvs s) 2xmir nodlpe mici tfsrrmxmp;u4apt mf3tadla rauvsnu4aeeomfciadomte neo s truo(m ou1lpeelivia()a2um(r ;o0alenioeilt aDeanmpnt0trenifcoodfmtr ivs t)s2tm(mpoo1amt lnes tfsrrm(roou1aleoif3ildlaDrmnmo (0artrmr iotlp r i s (0 rumxmpiy1lpe licias  2raur nu1aetomfeiad s2eanmsnt) ltomr oytlmtr nei () eurio ny4lmenlivil()sDrru poo1opx  octld s rmuvp;u0trxrmo3tadfmte ueslt)tetrio3iydlle  iviat)aDururp;u0oexn ieiadlaDem(mont) etoio3oy1fateaueolt)t2trxm3io4lm n ncs ( aDrmxm oo0aexn oetlsfa el(mo t)aleoxfcoadoaDe nei (0 exoiopio4al n fvsl(fa2tax  no0oeeo o3tltfmDelnmp t4arxrmo tydopteaiei ()teto(mpny4optnmnct t s2ra(  ou0opxomi3taslmDuln sn()aetoio3iadom rlnvi;t srurim nu1ap elieil(fsDtrx ooo1tlx if3iysls2rmuvs u0trtrif oa1lpteauvolt  2uoimpou1amt mnesa( sruaxr no1apt mo3tydla2uln o t0 exoxr3oo1fmDrli sl()trxr(opou1am  mfvtl(  2rm(  ou0tlenmfctadlm2emuvs;u4 ltoif3oytoaD lieo s texmxo oo1lptnlfcsl(f Dumurp;u4tlxoiieiatlm2elnvsnt0arxrmrciytfp rlnvi;t)teuo(r io4ope lneilt)a2taxmpnt0tptoifcildlm uauvsnu)teeomociatlpD aieo;t) rurio oo4apt mnetls) rurxro;o0olen i3iasla eaumpnt) leomocootlaDr i o s t2uoxm3oy4lpe mfvi ( sDuru pou1tpe ii3iasls um(mo;u4tlenir tytfpt  nvs;t tetmxm ny4alen ncsls)sDtrxrp;t0oee  f3iytlaDuln snt0 leomociodlptraies;s0setmxopou4al elfvs sfa2uaum nu4tetoifeiysfsDem(mp u)aeermo iodlaD  ivo;( tetmiopoy1llt  iciat)srtmu poo0oex  fciasla2umumont0trtomoctotlateaieo;()seurxrpiydam  mfvi t srtrxronu1tpx ioetydfsDrlnmp;(0 rtoir3to1omDeli i (0srtr(m io1openmfvslsfaDtrum oo1apen ieiat s2emuvp u0tlxoxfcto1oa raiesls0 rtoxm oy1lp   fcsasf Dumxr ;u0aetomietat s2ulump t4trtoxociydlaDranes;t)texrxr3oo1lptnmncs t)srtm(  ;u4tpx iictltfa um( pn(0aetnif oodfateanvols0seuoxm oo1llen nes (f Dtrxrpoo1opt  fciadfa raumpn(0 lxrxocta1laDranei;t)teuoxm3iu4omtnlnvslt aDtruront4tlxomiciad aDum(vp;u0trxrmocta1fa e uei;(0 exoxmpnodlmee ieia( sDrmur ;u1tlx ifcild a elnms;u4 lxnio3ty1fp rlueo;t) etrxm3io4lmenmfvils)arurx onu1opxomieiat mDel(vs u) rtrmf3oytfmDelnei;t0 etrxo oudal emict (  Dtm(mpno4apt  fciat m el( p u4 etoxo oy1fpt li o ( srxm(r3iy1ole lieia()arur(  ou0ale  fetatfm rmums t4altnxrcoo1faD auvo t sexmxrpiu4alee netat a2taum ot1oexniociat s2uan p;t)artoxf ootoateaneo ( setriopio1lpenlfei s) Dtmxroou0aetoiictlsla2eanvp (0 exrxo oa1oaDe u i;t) rumim3nu4altemnesl()srur(m nt4olenmfciad s2ulnmp t0tleoxr3oodfate uesls0 exmir iu4lm  mnvt sfarum(rpot1oleoioeildlsDra(msnt4arenif3totfm e ivil(0seumxm iudaleelnvtls aDrru p;t4alxn f3iat a2rm(ms;u4aetnmf3oydlpDranvo;t0 eur(rpoo1ol n fei (  2ur(  ;u1tetoif3ias m rmnvpnt0areoxr3oatomt aneols trtrxr3nydoleeliei s a2um(ront4oltoio3iasls2emumpnu0 ltomfcty1lat li sls trxmir3io1ol  micslsfaDrm(mpnu1apxniictydfsDumums t4alxoxo ia1fa rlneil(0seumim3no4omt  fcsatf Drmx  nu1olxo fcilt aDraumpnt0alenif iodoatranes s0srumim3nydoltemnct (fsDrr(m ;o0optomi3ils a rmuvp u0 rxoif3ootoaDrlueo t0seumir io1ll e ietl(f rumu pou1oex mf3ilsfa eanms t)alxnxr oa1fmDeaieols0texmir oy1lm  lfvi s)s2tru pnu1aetnmictytlsDrl(vsn()altrxr oa1laDr nvslt) rxrxr3oudame  icil() Dtm(ro;o0tex mf3tlt s rauvsnt4 rtoxf3oy1opDranvs t trur(r3iudoltn net sfartau  no0alt mfeildfa rau onu0 ltoir oytoa   u s;s s2trxr3iudlpenmfesa(  rta( pou4oexoio3iadfaDrmumsnt0trxnmf todlm  au i s0srxrxo oo4oltnlfet tf 2trur ot1aeto f3iyt s2ulumsnt4tetnxf3io1fa eai o;( setm(r3nu4ol emnvsa( aDrmx oot4oexnmoeils a eau p u)tlenif tadfp elu s s)srxrxm3iudaleelnvtat arum(r ;o1opxn oeils sDeaums u0 eeomo3tadfate nvo;t t2tmim nodll   fcta(fsDuaump;u1olt mi3iasfaDean ont)arenifcoa1latelnvi () 2trio3nudlltelivi ( s2tm(r no0aeen octytfmDemnmo t4tlxoxrciy1opDe nes t) eurir3iu1lmeelics (faDrau  nu1texn o3iat aDem(vp;t4 rxnmr iadom  lneo s) rxrxr nudope liciatfaDurxrp;t4tleniietlsls em(ms (0altrxr oo1op e i o t) exo(m3iy1ll n neia() Drru p;o0aexnii3iadls2ua(msnu4 lenifciytfpD  uvs (  exr(r3nu4amtelivtatf rua(mpnu4tpxoioeiltla2rlnmsnt)arxnxo oodfm e ues (0t2xoxo3ny4omt  fvtasfsrum( pot4altniiciltlmDelnmsnu4tetrxf ootfaD aneils0sexm(o nudaltelivslt arurxr ;o4ope iieiadlm2el( p (4 lxrir3tadla raueil() exmxo3iudale  icil(  2taum ;t0tpeo ictltlsDra(vo;t0trtoxf oa1fp   nes;s)trumxm3oodom  mietls)sDtm( oot1tptoifeiltfs ul( p;u0teermo tatlpD luvs;(0texr(m oy1ope lncsasfarrrur no1optnifeiyslaDuau p u4aexnirciotop e n o ()srxr(mpnydomenliciasf rrru p;t4apt io3iysfs um( pnt4texrio3iy1oaD anvo;s0t2to(m iu1olte fesls a2ururoou4aee  fctltlsDeluvo t4 rxrmrcio1fateluvo;t)trur(o oudome mfcs tf Dtaxmonu0aexn oetatlm rlnvs t4 reriociotlaDrlnvs;()trxmirpno4op  mncsltf rtr(m ;o1tex  ietydfa rm( p u) exrif ia1oaDe ues s) rto(r3iu4op   iesas a2rm( poo1opxnmietytlm2rlnms;t4aeerxo iy1oateauvo t)sexmio oy1opt licsa() 2trurp;u0tet  octatls2emnvs;t)aexoircta1lm  lues;t setoimpno1optn ics s) 2raumo;t4tex io3tydlm2ranmp;u0 lxrifciatlm eau i;s)s2xmir3io4omtnmfcsa() rrr(  nu1aex  ociasla2ran s t4 leoircoo1fa e ies t0t2toxr3oo1omtnlncsls)aruaxmooo1oexoio3ilslm rmuvs;t)alxomf3ta1fpteluvsl() 2urir oy4lpt mfeils)s2ua(mpno4tpeomi3tadfa ean s (4aetoio tytfaDraiesl()setrimpny4olee ivs (fsDtmurpnt1apeoiieiatfs2eln snu4texoir io1la  lnei t trxoxrpoodaltnlneil() 2urxrooo1olt  i3iyslmDrlums;t0 etnxocoo1faDeauei;s0t2xmxm3nodomeemfviatfaDta(rpou0texnmiciltfa2rlu p (0arxomrcty1fm raueol( t2trxm3oodapeemfci s)arrmx  ;u4tlen ietasfs2ul(ms u4 rxrmr3tytfa eauvs ()tetr(opno1ll e neslt)s2trum nu0tlen ociad sDrl(mont0 etnmfcoo1fmtrlues;s) rxmxo iy1omt  neiat sruax  no4aexo i3taslm elumo;t0teeoxo iydlmD aiei t s2xmir3ny1ol  mnetlsf 2rax oou1aetomi3iatls2rmu o (4teeoif3tytla  lneo;s0srurxmpnudome lnetls) rtm(  ;t1alen f3ild a2rl( pn()alxrir3tatlatrau il(  euo(opio1olt lfesas) rrax pnu1apx iieiaslaDumnmp () lerio3iydlmD livsls trur(rpio4optnmfvt t s2tmump;t0olenio3iydlmDrauvpnu) exrxf3iatom  luvs t) exr(r nu1ame  nct s) 2ur(r ;u4oeeomf3iyt sDem( p t4tlxomociadopD an i;( truo(o io1openlnvi sf Dum( p;t4optomocild sDel(mpn(4 rxnmr3oa1lp rlieo t)trxoio3oydop  lfesls srtrxm ;t1oexn ietytlmDranmp u4aeenmr iytlp eaiei ()sruoxo3no1al nmneta( srtmurp;u1tptn iciatla2rlnmp;() lxrxr iy1om eluvsls trtm(rpiodamt  ici (  Dum(  ;u4oltnmf3iydfm emuvo u)aleoxr3tydfpDr n i t)tetmxrpoo1optnmfes t)a2rax  no4apt iociad m rmnvsnt) rtrxf ty1opDe ivo s0trtr(mpoy4lpe mfeil( s2ra(rpnt1aeeo ictldlsDel(vs t4 ltnxr3tatfpteauvi ()sexo(opoo4lm   neilt aDraxr oo4tlx iicilsls rl( o u)trtomrcoa1opDrlivolt)srurxm oo1olen ictl(  2taur ot1olt  o3tydfsDuanmo;u0aleoxo totfatrlu s;s) rurxo3oo4lptn ivsl()sDtmxmp;u0tpenmieiys a2rl(vs t)aeeoxrciydop e nes;(  rtoir oy4amtnmfes s)arurum nu1oee mfciatlm ul( p (0texomo3todfmtrluvi;()t2ur(o3iudom   ncslsf 2truront1alxo fcias s uanvsnt0teeoifciadlmDr n ols srtrxrpiudoptnmnvsl() 2trxmp;u0opt  ictltlm elnmpn(4 exnxr iatlp elnvi;s)setmim3iydlpee fvs (fa2raxmpno0apto o3ias mDeanmp t) etrmrciydfp e ivo t) rxm(rpoo1ap nmicia() Duaxrp;o0ale  oetad s2ul( o;(4 rxoir3tatoa e u o;s)sexoir iydamenmfes s)s2rmxmpoo0aexomf3ildla2uaumonu)tlxrxf3tytfate uvs ()teto(o3no4lpeelici s)sDtau  oo0altoio3iytfm2el(vo;u) etoxoctydoaDeanes;t0srxrxr ou4ome  nviat)aDrrumpnt1tpe  oeiysfsDra(vo t4tlxoxr oadfaDeanvs;s0 2xoxr3iodlmenlnci (f rua(  ;u4aeeomoeiytlmDul( p t4 exoxociydlaD lnvi;()srto(rpnu1amt lnet s a2tr(mono0oet mieiydls ulnvp u4arxnxo ty1oa r ivo t)trxoirpou1aptelnvs s s2ta(r ou4alt mfeiatls el(vp;u0 eeoxo3oy1opDrlnvo s) rxrim3oo4ale mfvilsfa2rmx  ot0altn o3iysfa uluvp;()tetomr totfa r iei;t0trurim oo1olt lics tfa2trxr nt1opt iiciyslm rl(vp;(0tlenxr io1fptrai il( sruo(mpno4ap emncias)a2tr(monu0texnii3ias s emn p;u4tetrir tatlaDe ies;( t2trim3oo4amtelfcta( aDurxmpou4apt mfctytfsDul( s;u)aleoxrcoo1lptr nvo s)truo(r3oodom nlivils srraump;u1tex iociasls2rmnvo;()trxnir3ty1fm  lu s (0srxoim iudom  mictlsf Drau  no0ole iieiad sDranvo;() ltrxo iy1fmD lueslt) 2uoxrpny1omtelnvil()sDur(rono0tlxoioeiadlm2ra(mo u4altoxf3tydomtr ivi;t sexrxrpou1am  mfctasfs2truront4olen feilsfmDean pnu) lxomf io1fp rlivs s setm(rpio4omte fct sf 2ur(  ;u0tex ii3iat s ran o;t0aexrmr3ootfpte uvs t0 etm(r3iydom emivilt) 2rru p;u0opxoif3tyd sDrauvs;u)tlerir ta1omtraieolt  2xrio oo4altnmfeta()arraxmpou4texomfciytfs2uan snt0 leoxr ootlaDraueil()tetmim ny4oltnliesas  Dumxr nu1opx ifciydls2em(vp (4areoxf oo1fmt lies s0s2urirpno4opt  ietas sDtr(mp;t0oleoifeiyslmDum( p;(4 exnmfcoatla elivols sexrir iy4ape mnvi s) 2tmxro;t1alxo i3tas m2elnvo;t)tltoxrcoydlmDe nvils0texoirpiodlp n ietat  Duau  ou0opeomieiyd s2ra(mpnt)altoxo3oatfptraivo;t)s2tr(m io4apt lnci ( aDrru o;u0aet  oeildfm2rmu s;t4 etrxrciydlaDr nvolt texrim no4amtn nvs () Dta( ont4ole  ieiydlaDumnms;u) rxomr3iotoptrauvi;() etmimpiu1lltnmnvt ()arta(m ou0olxomfetlsla elnmpnt4texoir3ty1omteluvil()srtmimpny1lm  lict t) 2ta( pou1apxoiieiydfs2uluvp;u)altoio3oy1oaD auvs;s texrio oo1apeelneslt)arum(rpnt1tleomo3iltls2rmn on(4aexrir oa1fp  aues;t)seumxopoo4amt mietatf rtmur no1tex if3ilt mDrau s;t0aexnir oytlmD an sls) 2ur(o3oydlmeemncs t sDrmxr nu0ope moeiasla ea(vpnu0tetoxfcia1lat livo t0srurxm3io4ole  nvsl()a2um( ono0ole iieias s umu sn(4 rerir3ia1opD au o;s  2tmir iudopenlfetltfarrrxrpnu0tpx miciasfmDumnmpn(4 leomo3iotlp  lnvo (0setm(opnydll e ivils  rrm(rp;u4tpxnio3tld m2ean o t4 ltrir ta1oa eluei s0teur(o3nudlm  miesl()a2ra( ont4oexoifeiltla uanvo;(0arenmf3ootfm e u o;(0 etoirpiodolte feil()srta( o;o0aexnio3iydfmDrm( o;u0 rtnircoy1lp eai s () 2xrim3iy1optelfetlt  rrax o;o0aleniiciat mDrm(mp (0tleoxf iotfmtr uvil(0 etm(rpio1ope lfvt s aDumxm nu0oltomf3iyt a2uan ont4trenif tydopDeaues t) rtoxo3oo4ll elivtl()s2ta(  nt0opxomietls mDuanvonu0 etomf iatla elneo;s0srto(r iudolenmfcsasfaDtm( pot0alxomf3tlt a2ra(vo u)tetnxf iatopD lu slt0srxm(r no1lltelnvsat sDua( pnu0aexo i3iadla ran p (0areomo iodfa rlneil(  2tmxr3iodlm n iei (  Dtr(m ;o4apeoioetys s ranms;u)alxrio tadoateaiei;s seurxopnu4ale mfctlsfsDra( pou1opx mocildlsDea(ms;t)treoifcoadlpt liesl( s2um(m nu1ol n ies s aDuau pnt0oet ioctyd a2em(mp;u4teerxf totlpDelies ()teum(o3no1lmenlfvtasfsDtaxmp;u4apxomoeiydls2rau pnu)trtniocty1fmDrai i;(0 rxo(o iy1ape mfvils  Dtmurp;u4aeeomo3iyd s2ua(mo;t)trtnmo oadfa rlnvs;s0truoir3nudoptnlfvs (  Dtr(r ;u1tlx mfetatlsDemumpn(4tleoir3iotoatelivo;s seurir3io1lmtelieil( aDua(ronu4tex  fctydfs2ranvo t0aexoxfcootfmt livols)trtm(opiy4lm  lneil(fs2ur( pnu1apxo i3iltla rl( on()alxomociadfpD  uei s)srtoiopoo1ol nmfetl(  Drru o;o1tee iiciytla um( p t0tetomf3oa1faDrai i;( t2tmiopnu4lpt  fvia() 2um(m ou1tpx  ocias sDrlumo u)tetomo3tadlm   n ols0s2trimpoo4olee nci ( arur(m ot4optnmiciyd s2em( sn(4trenif3iatfmDrlneilt) exoir oudlptnlncs s)srta(r nu1aleoii3iysfaDum( o (4artrxfcio1la  auvo t)seumimpoodoptn ictlt) Durx o;t1optnmfeilsfmDemumpn(4artnxr3tadlmD luei;s  2urxmpiydoptemfeslt) 2rm(r no1oexnmfeiys aDemn s;(0 rxnmr oo1fa  anvo t0s2trimpoo1om emicsl( srtrumonu4tee mo3tlslmDel(mp (0 exrxf ta1optr n sls)sruo(r iu1ol   iei s a2rrxm ot4texo octat sDemnvon()artrmrctadfm eluvo t0t2toim3no1op emnetasf 2rmum ;o1opxo i3tat aDrm(vpn(0tleomf3iodlm e nvolt)teuoxo oy4am   ieia()aDra(mpou0aex iociatfsDrl( pn(0tlxoir3tatfm   ivilt0 2xrxmpiu1lltelnesat)srumx p;o1oex  ieildlm ul(vp u4alerxrciatfm   nvolt)t2trxmpno1apt  nvs ()srraurpnt4aetnmietadfaDulnmo;t)tetrxr iytoaD lies ( seurim3ny1am emfvslt)aDrmxr oo0olx  oetyd a2rau pnu0artoxfcoadfa ranvil()s2uoxr3ny4llenlneil( aDtau oou0ope  f3tadls2ulumpn(4 lenxo3io1lmt li i s0trto(mpiydol nlivsa()s2tm(r ou1tpt iocildla ulump t4arenxo iadopD  n sls0teurxopnu1alenlfvsa(  Dumxr ot1tpxo icildfs2elu pn(4 rtnmf3oa1fateanvslt0s2umir3io1am emiviat)arur(mo;u0ape mi3iatfa2um( p (0altomr3to1la r i o t trxoim nu1ameemivt s artaxm ;t4oetoioctldlmDua(vs;(0aetnxfciodfptelieo t tetrxo nydam elncilt a2umum ;u0oeenioeiys s ra(ms u0artomr3oodfpDelnvslt  2tm(m3oy4lltn ncilt)s2rm(mooo1opxn fciasfsDuln s (4tleniocoy1late n i;s0 eurxo ny1lme  ivi (fsrum(rpnt0tlt mo3iasls2rl(mp;u4alxoxfctodlm  anvolt) rtm(o oydll nlfvi ()s2rmx onu0optomi3iadfm rlnvs t)artrxo oytfa ranesls t2urxrpiu4omtnlivtlt) rua(mono0olx  feiasla2ea(msn()tltnxrcio1omt luvo;( t2tm(m3iu4ame liesasf 2um(  ;u4apxo fciyd m umu p (4 rxoxo ty1faDe nes t  etrxo3nodale mnetas)srtaxm ;o4tpeomietltfa rl(vp;t4 rxrxf3io1optran s s)s2umim3io4om n iet s  rumur oo0tlxo ictat a2umn snt0 ltoio3iatlmt  ueol() exmxo3iy4olt lneils arur(mono4opx iicilt mDemnvo;u0artoir3io1lmt an s;(0s2umiopnu1lptnmfvs t)a2ta(m nu0opxomietlsls2umuvo;t)tlxrxocto1oa  ln i;t) 2xoxo ou1omee ictls)sDtm(mpou4aeen o3iatfa2emuvpnu)arxrxf3to1opDrau i s)truoir no1lp   fvil(f Dtrurpnt1opxoiieilsls el( o;(0 renxr iydfaD luvo;()s2to(r no4lm eliesatfsDuaxm ;u4tltnmocilsfm rl( s t4trtoir3oydoatraivol( t2xr(r nu4al e fvta(fs2tr(  ot0tpeo ocils m em( p (4artrxfciytlp ran o t) 2tmxo3io1ap e ivil(fs2umu  ;t0opeoioctaslsDuln o (0 exnxf3tatoptr i s t  euo(o3ou4op  lfct tfsDrmuro;t4ale mi3iat a rlump;(0arxomrctydfa  ai s s seuoio no4lmenmivtas aDta(rp;o1ope ifeiat s2elu p;(0 exrmfcoodlmDe nei s) 2uoir nudol nlneslt s2rrurpnt1tptn fciadlmDrl( o u)tleoirciy1lmDe nvsl( srxrio3iu1ome  fcslt) 2ur( pot4alto ietldfs ul(mo;u4aexnmf tydomt anvs;s) 2tm(opiy1ole mfcia()s2tm(r ;o0tlt mietld s raump;u)arxrif iytfm   i o t srxoxm io4lleemfvsltf 2taumo;t1alt iociyd sDuanvs;(4alxrir tadopDelneilt)trurio iydlpenlivta()s2tmxm ou1aeenmoeiatla rln on(0aeeoxf ia1lmDr n s t)srtr(r io4oleemieils)arrrur ;t4olxomfctysfa2em(ms;(0texrxocoadoatr iesl()srtoir3nu4lltnlneta( a2tm(m nu1tpxnii3ildfs2um(vp;t0arenxr to1oa  anvsl(  2umim ou4olen ivi sf 2raump;t0aetnmoeiadfs2em( on(4teeoif3ta1oatelueilt0trxrxm3iy1omtn ncsatfa2ra(  no0oetomfcilsfaDuanmon()trenif3oatlatr u i t)s2xr(o iy1omtelfvsa() Drauroou1apeoiiciyslaDum(mo t4 exrmrciodfpt luvo () exrim3iydlmeelietat)s2rmurp;t4alx mfeiysfs2umumsn(0 ltrif3oy1lpD  nvs;s)sexrxr nu1llte netas) 2tauro;t1altniocias a elnvs;(0 exnifctytomtrauvi;s)seuoxr io4aleemfvias  Dtaur nu4tpt  o3iat sDemuvp;u)aeermrcoydlpDrlivo t0teur(o io1llt mivslsf Drr(  ou1apxo f3iatfaDem(vo t0aleomoctatlptelueils  2trio3no4am  mfei sf 2tmurpnt4aetoif3ilsla2rmumsnu)aetoircty1lm   i o;()s2xoxrpiydal nlfcsltf 2ur(mooo0apeomiciat m2ran on(4teeoir3ia1oaDrauei;()teuoxr3oodap  micsasf 2uaum no4opxnmoeiysls2ea(mo u4 rtoio3iy1lptr uvils s2xoxo iydole mfet s) 2rmur ;o4aexomi3iysfa2umn sn(0 rtnxo3ia1fptr u o s)truoxo oo1ale lfeta(  Dtrur ot0aetnio3tlt s ulums t0 exomrctotlpDrlieilt teuoxm iu4oleelfesl() 2ua(m nu4tpt  o3iydlmDrl(vpn()aexnmrcoydfm r uvslt  2um(mpoydom nmfctl(fs2rm( pnu4opx  o3tyt s2rmumpn() exoif iy1om e n o;s seurim oydap   nvt tfsDtaur nt4teenmiciadla2umuvont0arxoxfcio1fatr i i;( trur(mpiu4lpee ietlt aDrmx p;o1oet  i3tlsfm ra(ms () lxoxf oadlmDean o s0srxoimpio4apee iesa(fsDrrxmpou1alenmieiysla2emnvs (0trxrir ty1fmDeluvi ()s2toxo ou1lmte ict (  2ur(mpou0tlenmiciasfa2umums u0 ltoio3tadlpDe neslt)teuoxo nydale lnctatfsDum(r nu1apxnmi3tlslaDemnvs t4tlxoio3iatfmt auei (  rxrirpiy1apenlfvtl(fs2rrxroou1oexn octyt m2umuvs;u0areoxo ia1oatran olt setrxmpio1lpt mfvil() 2ra(ro;u4aee  feiydfa uln p;u4arenif3iy1oa eaivo t)srxo(m3iy4optnlnct t)srrrurp;o0alx mictldlaDem(mo;(0alerxr iytoaDrlies s seumirpiydap emnvia(f 2rm(ront4oeeniieilsls ul(vo (4alxoio oodfpDrau ol()sruo(rpnu1alenmieias sDrrxrooo4olxnmfciysls ranvsnu)alxnmr3iy1faDeaiei ( t2tmim ou1ole liesa()a2taumoot1tlxomfeild s2eln s;u4 etrxr oadfp e nvs s setmxm io1llen nes t  rumx ont0apxnmictyslaDea(mp;(0 ltnxo tytfm eai o t  2umio3nudamee fet (  Dra(mo;t4teeomo3iadlm2uan p;() rxrmfcty1op  lu i s0texmxmpnudale  ivias) Dtaxm nu4tet ifciasfmDran ont4tlerir iydfpD  uvsl()srtm(mpny4llee icsasfa2umu pno0ope iieiasfa ulnvo;t)teenmr ta1fpDeli o;t) 2uo(opnodalt lneilt a2uaurp;u0alxnmfeilt aDumuvo (0aetrxr to1lat aies ()t2umim iu1lm e nvs () Dua(  oo1oetnioeiadfmDem( pnt0aleoxf ootlaDeai s;s  2xr(r oy4am emnet s s2tr(mo;t0tlxnmicias s uanmont)aetnmociadoatrlieslt) etmio3io4ame lncilt  Dua(mp;o1apto icildfa uanvo;(0 rerio iy1lpt  n i;(0 2xo(opoydap  mnvsas srrax ooo1tle  i3iytlm uau o ()tlxnxrctatlaDeauvo;t) 2tr(o no1apenlnvsls)aDrrxm ou1oleoiietysla2raumo;u)tltnxociadopt livslt trtrxm ny1op nlivt (fsDumu pot1texo ictyslsDrl(mp;u4trtrmocoytlpt anvs;(0trtrio ou1om nmnei t)s2um(rpno1apxnmoeiatls2ean ont)tlerir oydfa   n s t0 eurirpno4amtemivi (fsrrmumo;t1opeomfciltla eln s;(0 rtnmo3oa1oa  lnvsl()srtm(opiodlle licsls) rrrurpoo1oetn feiytlmDulnvon(0trtoir iytlmDeau s t0s2toirpio1lpeelfcsas  Draxro;o1oeeo i3tlt m2umnvo u4tetrif3oatlmD luvsls)sexrio3nu4al n netat aDtmxr ou0tpto octat mDrauvo;(0aetnxr oatfateauvsl( sexrim no4ame  nvsl( aDrrx ont1oee mo3iadfaDulnvpn()trtnxf3oo1omtranesl(0teuo(r3iy1al emictatf 2tr(roou1oleniieiltlaDem( o;(4trxnif3totlp e n olt0t2ur(m3iudom  lfcsatfa2rau onu4tle if3iadfmDra( s;() renmf3oytlpDeanvi ()s2tm(m ou4aptemict (  rrr( pot1olxoiiciatlm2ranmo;u4artrmoctotoa raivsls setrimpiu4apenlieia( aDtaum ;t4aeeo oeiat aDrmnmp (4tleomrcoodlatrlivi;t  2urir3oy1lltemiei t  2ur( p;u0aexn feiat s rm(msnt0 eenif3ta1lp  ai ilt  2xrxr oo1ol   nvs t s2tmx ono0aee mi3tad s2uan pnt0tleoif oatfmDeauvs;s  2tm(r3nodll  mfesasfaDuaurpno4opx if3iadla em(mp;(0trtrxr3iodfpteauvsls seum(m3iy4opt mics t) rtru poo4tlen fciltfs2ulnvsn() eeoxo3totfpDr nei;s)t2ur(r iy1opee fet sf rum(mp;o1olxo o3tysls2ul(vpn()altoif3io1la eai i (  etr(o no4lmte feil(fsrtaumonu4oetoiociadlm eanvo;(4aeermociotlmtr n sl(0 rtmxr iydll elnei s) rrmxr ;o1olt  octltlsDrlnvp u4alxoxr tytfaDr ues s s2urio oydomen ivs s)aDumxm ;o0optn i3iasfmDulumont4texomf io1opt aieo;()trxm(o3oy4lpeelivtat)srumxmp;t1oetnmiciydfs2umnmp;t0tltrxf3iatfptr nvolt0seumir3io1lmtelnvta( sDur(  nt1apt  feiytfaDrm(mp u)tlerir3io1fa   nvol()trxr(opoy4om   iei s s2rrum ;t4teeoio3tltla ran sn()teenxf oydfmDrlnei;() 2urirpiudap nlieiatfarrmxmpno1tpe mo3tas a2el(msn() eerxr totlpDe i i;( trxoxm oo4ale  nvs tf Dtau p;t1tpx mi3iydlaDrln snu4altrif3todoa eluesl( s2xoio3ou1alte feil(  2ururp;o0teeomieils a rlnmpnu) exnir3iadom rlnei s)texo(m oo1omtelietlt)artm(rp;u1oleoio3iytfaDra(mp;t0tlenxo oodfp eanes (0srumirpoydalt lnes (farumu p;u4oex iictat m rau o;t0 leomr3oodomteln o t srurimpnudlm elfvt s srtru  nt0tpeoif3iaslm2rlu sn()alxrir3iatoaDeln ols)srur(mpoo1oltelncs s s2ta(mpot0optn octltls2elnvs;u4aexnxr ta1lmt lu ol(0setrxr nudlmtelnvsls a2urxmpou1oltn feiyd a2eluvo;(0texomf3iodfpD luvsl(0 eum(r3ny1aleemfei tfsDraur nt0aptn octyd sDrauvp (4tlxrxrciy1lmteln il() exmiopou1ale lfvi ( aDrr( ooo1tpenif3iat m2rauvo;t)aeermr ia1lp rlies t trtoxopnydom nlfet () 2um(monu4tlxnii3iydlsDulnms;u) ltrir ia1lp  au s;(0 rxr(o3iydal  mici ()aDuax onu0tle  fetls m ranms;u4arermfcto1optranvils  rtrxm3iudlm  lfet ()arrm(mp;o1oeenmociadlm eln o (0tlermr oatomte ivo;s)s2tmxmpoydam  mfvils  2trur ;t0olx  oeiatla2emnvs;t0tltoxo todfptelueo s) etm(opiy4opte fvsa()srtrx  ;u4tee mo3iytfs2el( pn(4aeenxo3oatom eluvils0 rtm(opoy1aptelieias aDra(  ;t1tltoii3ilslsDrm( o;t4 exoxo3ootomt auei s  2ur(opiy1lmeelfetatfaDtmump;o0tpxnmictat aDemn p;t) etnmociadom  lieo (  rxrio3nudop   icilsf rumxrpoo1apenmo3ilsfm uan ont0 rxnxr3oydfaDrai o t0srtmim3no4lltelnvs (f Drr(  no1alx mf3ilt mDuanmon()trxoifctatfp r nvolt t2toxmpnudlmt mnesa(fsrtmur ot4ope mfciatls el(vp u0tlxnmo3iy1fp   ues () 2um(o3io1lp n net s  rrrxm oo0tex  f3tysfa2uanmp (4tltrio3iy1fpDrlu ils) 2xrim3oydaptelnvta(  2tmxrono1olx iocildlm2rln snt) rxomfctodop  aieo ()srxr(o nu4ale lncs t aDrmxrp;t0tpe ifeiyd a umnvp;(0trxoifciatfm   neols0trur(rpiodap   nei sfa2rru pnu4olxomi3tldfa ul(vont4trtomoctydlm rlu i;s  2uoio iu1ale mieia(farrmxmont1oexomociysfaDuau p (4trtomo3ty1fm elu slt t2um(rpio4lltelnetltfsrtru  ou4tpeniieiad mDul( ont4artrmrcoodfmD  ieils  rxrirpiodal   nci sf rraum ;t0oet ifetatfmDrlnmpnu0 lxnir ty1la e u il(  rurxr3oudlle lnvtl(f 2trumpoo4tpeo f3tatfmDeauvp;t)trxrxrcoy1laDr i s t0s2urir oudamen netls  Dra(rpnt4oleomfcils m2umnvp;u) etoioctatop  lnvilt) ruoxmpoo4ap elivt t)arrm(mpou0tee  oeils m2eau sn()alxoir3iydomteauvo ()teto(o3oydaptnliet tf 2umur ;u4alt iietysfmDua(vo (0 exrmr3to1lpt  ieo;(0 rtmxm3ou1ape liet s s2rrx ooo1ole mi3iatfaDumnmo (4aexnmr3to1oa rliesls0trxrxo oo1altelncil(  2trx p;t1oeen o3iasfaDeluvonu0 exrifciydlp eaies;() rumxo3iydopee ivil(fsrtm( p;t1opeoiictys m2el(vs ()aetnif iadoaD  ivol( setoxmpnodlltemncs s s2uax  ;t4tpxnioetytlmDrlnmo (0arerxrcty1la ran s;s0seurxmpny4lle mici s aDra(mpou4apx mf3ild s2rmnvs;() ltomr oodlm  anvo;( t2xr(rpiy4op  mfvta(f Dtrxmp;t0tlxn i3tyt a2elu snu) lenxrcootlp rli i t)seur(r iy1lpe mfviat  2rm(r ou1apx moeiatla rauvonu4 lerio3iatom  luvolt) rumir nu1amenmnet tfsrururpno1apeomietatlmDemuvp (4aleoio3iy1fa   u s;t t2toio3iu1opte iesltfs2umxmp;u0alxnii3iatfm elnvonu0texoxrciotfp e ivolt0 2xoio io1lpenmicsls)sDtax oot1tpenif3iyd mDrmnvpnt4 lxrir iydlat li i;s teum(r3oo1alte neslt a2ta(rpot4oeen ieilsfaDeaumpnu0tleomfciodlmD li olt0s2trxo3oy4lpeemfeil()srtrum nt4aleomo3ildfm2eanmo;(0 exnmfctytop raueol(0s2uoiopou4ol  lfet s)s2trumpoo1tpenifctlsfm emu o;()aleoirctotlpteau o s  rtoxo3iu4ll  miesl(fa2ua(mpnu1aptn icilsfs rmumonu) lxnio oa1fateanvi;s)seuoxm3oydamtemivs (fs2uaump;t1tpxnmieildlsDuaumsnt)aexnxf oatfmt  u s t)teumim3oy4am elnvsa() rumxr ;u0tee if3tyt s ul(vo u4arxoirciotla rai o s)s2to(o3oydoltelncsat) 2tm(rooo0apxnmoctldlm rmnmo;t0altrmociotlmDr ivo;s) 2toxr oy1opeelictls aDumur ou1texo o3iyd aDul(vsnt0tleoio3to1om  aieil( s2um(o ny1apeemfei ()sDrmu o;o1aetomoctldfs uanmp u4 renirciytlate uvolt)sexmirpoo4alenlivi (fa2urxr nt1aleomfetad m2elnmsn(4areoif3iytoa  lu ols0srtoirpoy1omenlfei sfa2tmumoou0optnioeiys mDrmn p u0aeeoiocia1fa  li o s)s2umiopnu1opt  ics t arururpot0aptnioetldlsDem(ms u0treriocoydoaDrlies s)s2xrim3ny1amtn iei s)aDururp;t1olt mfciydls emn o t)aeenxr oytlateaivs;(0sexrxm3no4ll   ivt tf 2rr(mpot1tpxniociltfa2eau p;(0tlxnir tydfp elieo ()s2xr(rpou4ome miesls)artaumonu1tpt mocilslmDuluvon(0 eermrcia1fp r n i;s)seumir3iu1op  mieslt)arrmu  ;o4tlen o3iytfmDrlump;u)tlxnxfctydfm   i sl( tetoxr3nudalt mnei ( arrrumo;u0oetn oeildfm2rmuvon(0aeenio3tytoaD anvo;s0trxoiopoydopte fvil( s2rm(mp;o4aeeoioetat s ran p t4aeerxf iadlmDrlu i;s)seuoir no1lpenlnvsas sDtaur nu0texn i3iytla2rauvsnu0 rerxocoadfpDelies t s2uoim3ny1llt lfvsat srra(mpot4tetnifeiltfsDemnmp;t4aeenmf oy1lpte ivilt)setmirpny4omee icsatfa2raxmono1oeeoiiciyslm2elums t4tlenxr3io1om e ivolt0t2umxo3oodaltemfetasf 2ur( ont1oexn ietad a2emn o u4altoio3iatoptr i sl() rumxrpiu1lle  ivsls)artrxr no0tet io3tasla2eanvs;() rxomf iydfpD aivi t0s2xrirpoo1oltn iesas) rtmur ;t4alxn ocilsfm2rmnmo;(4tetrmo iatomDr i i;t) 2trxm iu4lle lietl()arrax ono1tpeomf3iadls umuvs;t0alermo3iydlp eauvols)t2uoxm nydol nmicta(fsDtr( pno4opeo icildfm2emn o (4altrio3ty1fpDrln s s0teuo(r no1lmt lneias)s2ta(  ou1apenifetls a umu s;(4trtnmfcto1latrauvols) eumxmpou4lle  feiatf 2rm(rooo0oeeoifciadlmDelnvp;()aeenio3iatfa r ivsl( t2xmxopny1apeemfeslsfa2urump;t1teto ictltla raumo t4 rxnmr3tadla r ivil(0srxrxm3iy4al   nvi s) 2taump;t1alto i3iaslsDrmu p u0artrio iatfaDe neo;()srurxo ny4om nmivtlsf 2um(r oo0olen oeias s2umn pn(4texriociy1omD  n slt)s2xrxm oy1om   fes s  rtaxrpoo1aee ii3tld m um( pn(4 rxnmr3to1lmDeai ils0trumxo ny1opt mnvia( arumx p;o1opeo o3iadfa2el(mo;t4tltrio3ootop  aivs;t)tetr(o io4lpenmfvilt) 2ra(r nt1tlto o3ilsfaDua(vp u0aeeriociatom  aueo s  rxo(m oudolee nciat)srtax p;o1aptnio3tyd s el(vp;t) ltomr3oatopt lnvi;(0seto(o oudom elicsls)s2rmumooo4apto icildls2ua( p u)treoxo oydfmte u i (0s2toim3no1optnmietasfarua(mp;t1oex mietatlsDum(vo;(0 eeomocio1lpD auesls)teuo(mpoy1lp e feia(farta(m ;o4tpe iociaslsDel(vs t4trxoxrcia1opDr i o s) etrxr ny1alte ivslt  2rax oou4tle iiciadls2emuvp (0 renmrcoa1opteauvslt)s2urim iudapenmfviasfaDtrxr nt4oexo o3tlt m2rauvp u)aexnio3todfaD aueslt sexmio3nu4ll  lictltfa2umum ou4ope mf3ild a2ul(vp t4 rxrir todoateau s t tetmirpnudlptemncsas a2urx  ;u0ale mfctad mDrl(ms;t0 lxrmrciodlm eaiei (  eum(m io4apenmivils  2taump;t0teeo fctlslm rm( snu)aleoxfcoo1fm elnes;s0 rur(r3iu1lpt mies sfs2rrump;u4oetn fciadlaDrau p u)aexoifctadlatrln s;s)srumio3ny4omen netasfaDtr(moot4tetnio3ilsfa2rmnms;t) lxnxr3iatop r ivs;(  exr(m nudlmee fvt t)a2umx pnu4apt mi3tyd s em(ms;(0 eerxf ta1fp  an sl()trtm(o no1amen fvs tfsrtr( p;o1tetn f3tadla2rlums;t)altomoctadfa  aieo s)sruo(o oy4ale lnvtl(  2rmx  ;u1opeomfetld s elnvp;t0alxoir3ty1la  ln o s)srxr(r3no1apenlfvs ( srtru  nt1aetnmo3iasfa ua(vp;t)trenmo iatfp rluei;t trtr(r iu1opeemnvsa() rra(r ;t1tpt  fctytls el( on(4texrxfciatom  lnei t srtrxr3nu1optemnvi (fa2ur(mpou1oltnmociys m2emuvsn(0teermf to1oat lu i s0 rxrio nydlpt lfetas)srtm(rpnu1aeeomoeiyslaDranvs;u) ltrxocootop r i ols)teumimpoydlme  iciatfsDuaumonu4tetn fciysfm uluvp u)tetrmfcoadfatraivolt  etm(r3ny4ap  mieiasfa2rau  ;t4altomiciad s um(ms;(0 rtoio totlm rauvslt s2urim iudllee icil(f Dum( oou0alxoiieild a2ul(vs t)artomfcoo1oatrlneo;t  rxrxo iu4lm   ivia()a2rax o;o4oeeomo3iyslm rm( pnt)arxnxr3oodlmD  neols)trtmxrpoydlmee fvi s)s2taur nt0aptomo3iat aDraumpnu0tltnirciadfmDraivo;() rto(o iy1om n fvt tfsDtrxm ou4ape mi3iasfa rau pnt4texrmrcoatopte n s ( texm(r nodopte nvsat  rrmxm ot4tpeomociysfaDul( onu4aexrir3tytom rai o;t0trto(o3iu4ap nmfvs t)s2uau pou1oeeo o3iltfmDuaums;(4alenmo3ta1lp eauvols0trxmio3iudop  lfetltfs2trur nu0oexn ocildfs eauvp (4teerif oytomt lu o;s srto(o no1ole lfvslt srrauront1optnio3tys s2elnmpnu)tlxrir ty1fp raueolt0 2um(mpou1olt lfvsa(f 2uau oou0texn octls mDemu o t) ltrirciydfpD li sl(0t2urxo3iy4ap emics t) 2rmxrp;t4alt  f3iydfs2ulnmo;t0arxrircoo1laD  uei s trxoiopio1llenmnvtlt  Dtm( o;t1olenmoeiatfs umnmsnu0 etoiocoytopt ai il(0 exr(mpoo4olee nctlt)s2rm(mpno4texnio3ildfa emn s;t0arermrctotomtran il( s2xmirpoo4apt mivias arum(mpno1olxnmfetldlsDumuvo u)aexnir3iodoaDran o t0 rxm(o oy1al emivil() rtaxr nu1alt ifetlslm2rlu s;t4tltoifcia1oa rlivslt  2xoio3io1ap  lies () Dtaumo;t4ale iieiysla emnmo (0arxnif tydfmD lneo;t t2xoxo3oodll  mnetlsf rtrx  ;o4apt  fetysls2rmuvs;(4tleniocoo1lm r nvs;()s2to(m3iydamtelfeil()a2ta(  nt1oltn f3iad mDranvsnt0 ltnir todom eaueolt  exr(r3ou1lptemnvsl(fs2um(r ;t1tle mociyd m2raumsnu0aexnxociytfptrln i;(0tetmim3oodomt  net tfaDraurpot4opxn ociytfsDumuvp () rtnxr3ta1lp  ln i;(0texrir iydamte fcsltf 2trurpno4oetoif3tld a rluvonu)tetnifciotlm   ueo s0texoim ou4omeelnet (fsDumu p;o4teeniociydfaDrmnmp;u0 rerircty1oa e ueil( t2uoirpiodlptn fvsat aDurxroot0tpx io3ias m em(mp (0aexnxf iatlmDraieolt  exo(m iy4ape mnes (  rurxr oo1opx ifetasfmDuauvpnu)tlerxf ty1op e ivol()s2toxrpnu1omtn fcta(fsrrrx pou0oeeo oeiadlm uauvo;t)tlermf oytfptr uei ()texoiopnu1lm n ivsat) rtrur no1ale micilsfm2um(vp;t)trenxo3iydoat  nei s  etm(m3ou1alen fei s) 2raurpnt1tetomf3iytlm2ul(mon(4 rtoxf3iodfmDranvi;s0sruriopiodope mivt s  Dumu  oo0teeomf3iadlaDemumon(0trxnmr ta1lp rau o t trxmio3oy4om emnvta() 2ta( pou1optn f3iat sDrmu onu4artnxoctodom r nvo t)s2xrxmpiudal  lfcils  ruauronu1tpto f3iyd aDeluvo;t)trxrif3tatfa e ueo;t0seuoio3ou4lp  lfvtl( aDrmxmpot4aet  ocilt m um(vo;() rtnxo3oa1lmte ivsls  eumxo ny1alen fvtlt aDum(mpnu4oee ifeiad m rmumo u)trtrmo oo1lmt luvsl( t2xm(r3iydameelicils  rur(  ;u0ale mo3tas mDra( p u4alenioctodomteluvsls)sexrirpoudopt lnvtlt)a2taum oo1ope iieiat mDraumpn(4altrxr tatomDe u ols  euo(m nu4lp emictas)srtrxmont0tle  iciysfs ulu snt0tlenmf oo1lm ean s;(0t2umio ou4ole mictat a2tru poo0aee ii3iasfm2rl(ms u0 leoxr3iadoaDrauesl( s2xrxo no4ap e iesatfartmxr ot1teen oetydlm elu o u0 eeoif3oa1fat an o;(0 2tr(r iy1ap n ieia(fsrururono1tpeo ietlsfa em( s;()trtrxr3oadoaDrln o s0srxrxrpoo4lltn ietas)aDumxmpno0oeeniociadla2ea(mo;t)trtnif3oytfa eli i (0 2trimpoo4ame  neiat) 2trurp;o1tet  feiyd sDeluvo u0arxriociadlp  anvo (0srurio3ou4lmt mfesltf Dumuronu4olenmocild s ea(mp;u0 lenirctydfa   i o;(0 2xoim iydol elnvsat artaum nu0tltn i3tls s2rl(mp;u) rtnmr3tydfpt lieol( seuoir nydolte nvsl( s2tmurp;o4aee iociaslaDemnvsnt)tltnxo3iytoa  lnvils)srxmxm iy4oltelici sfa2tau  nu0ole iiciaslsDua(vp;u0 exomr iy1lpt  ieo;()seurxopoo1ll n nvta()s2rmurp;o4aee mf3iadla ea( on(4treoirciydlmDr uei t s2toxo3oydomt lfcsa(  rtmur ;t0teto iciyslsDelu o;u4artomocoy1laD  nei s0seuoxrpny1ol nmici sfsrtaxm ;o0tlxoiieiysls uau snt0artomo iodfaDeaieo t0sruo(opoy1amenlnctlt)srtax  no1apxo oeiys m rl(ms u0tlxniociotfmt  n s;( texm(m ou4ll  mncilt aDrmx pnu0apeomfctyd a ran on(4 lerxrctodlpDrlieolt0 rumio nu1lpt mivt ()aDtr(r ;t0tlxoioetadls2em( snu0 eenxoctatfptelnvi;s0trxr(o iydlmeemivia()sDum(r nu1oltn ociasls umumsnt4 rxrxrctatfa e n ils  euo(r3oudlpe mfeta() rur(mo;u0alx if3tydfmDul( o;t0aeenifcoytla elnvi;s) exo(r3oo1amtnlivs (f 2tax ont1oetnifeias aDeau o;t0alxnmo3oytop rluvs t srurxr3nodape miet ()a2urxm ou4oexn f3tlt a2el(vsnu4alxnio ia1fmD aiei;s  etoim iudlp e fvs s)a2tr(ronu0aex  o3ils a2el(msnt) lxnmf ia1fpD luei t0 2urio3iy4ome  ncta(  2umum ;o1olt mfctld mDrmu s t4altomr iydfptraivils s2trxr no1ome lnvs s)a2urx ono1altn oeils aDrm( ont0aetnio iy1oa  li s s)srtr(r oydlmtnmnei tfaDuaur no1aeeo i3ias s elnmo;() rtoxf3iy1faDraues (0t2uoim3oy1omen iesat s2ra(rpnu0alt ii3iydfm rlump;t0alerxr3tytlpD  ueils) etmir3ny4am  mfes (faDtr(m no1tlxnmietytlsDean o;u0alxomfctytlaD lnvi;t)teuoimpnu4amte fcsls)sDum( pot4opt  oeiys sDuan on(4tlxoxo oadfmtr u ils)trxrimpio4olenlfcs s sDumxmono1tltnioctyd sDra(msnt4texrxocoytlm eanvils)s2urxopiodamtemncsl(  rtr(mont4ape  o3tlsla emnvo;(4tleoio3iydlpDe u s s trxo(o oy1lp n nesa( a2rax  ;t4openmocild sDrauvo;()teermf3tatlmD  ueo;s0t2umim3no4am emfeia( srrmx onu1tpeoifctyd mDuln pnt0 reoxr3iodfptrlnvil() ruoxo3io1op  lfcsls)sDrax pot1ape ifeiadlm rmnmpnu0arerxr3oy1fa r ueo s t2trxopnu4apeemfei () Drr( pno4apx mfetld m2uln p;u)areomf tytoa  aivo (0t2umxopoodolt  ivsl()s2taxroou0tpeo feiytlm ran s t) ltrmr iy1oat  i ilt0srumim iu4ale licsltfarur( p;o4apto ictasla rln o;(0aetrxr totomt lnvi;()t2tmxo iodalee icil( sDum( onu4aptoio3iaslm rluvp u)areoir iy1fa e u il(  rto(o3iydoltnmfvtas) 2rmxmo;u1ole mfeiyd s2ea(msn(0 etoxf todfpte nvo t) rtm(r no4alt  net () rum(r ;t4teeomiciasls2ulnmp u)trtnxo iytlmtrau sl(0 rtoio iodlm e nvtas  Dua(m ou0tpx mo3iadlaDrlums u0trtoxoctadlatrln o t t2xmxr nu4op   iviatf 2tmx o;o4oex mieilsls ua(vont)tetrxf ia1oa rau ilt)texoio oodlpeelfvs s)srrr( o;u1texomoeils aDranvp (4teenxr ty1fm   neo;( trumxrpoy4altn nesltfs2uaumooo4oex  fciadla ea( s;(0altnio3iadfa raieslt) 2tr(m3ny4lm e nvia( a2uaxrp;t1aleoifctls mDeaumo u4trxnmrctadfmtelnvi s0 2tm(rpou4olt mfesas) Drax p;t4olt  i3tysls2umnvp t4 rtomf3oadlpteaieol()tetrir iy1lp emivtat)srtrx  oo4aet mfctld s2ulumpn()trxrmrcoatoaDrai s ()s2urxm nudlmtemnct t aDumxronu0opt if3iyd sDrlu s;u0 reoxr iytlmt  uvi;(0s2umio iy1ope lnvtl( s2uru o;o0alx  ociatfmDra( o;t4artrxo oodomDr uesls  eum(r iy4amt  icsl() 2tmxr nt4ope  i3ilslm2uln sn(0 etrxrcty1fpDe ivs t  etoxo3ou4ap   fvtls) rrm(  ;u1aex miciatlaDum( sn(4texnmfctatfpDe uvs t) euo(o ny1llte fcilsfarrmu pnu1aexomociadlsDem( o;(0 ltoir3oytfaDr u il() ruoxm no1amt lfeta(  rururpoo0apt  ociadls uluvp;(4 exnir tytlp rlnvs s  rtoir3iudomt mncta(fsrtrurp;o0tlt mieiasfm ra(mp () rtrxo tatfat  n olt t2tmirpiu1om  micsas)arumu pou4tetoiiciydlsDum( o (0artoircoa1lmDr i ilt0s2uo(mpnodop emfctl()arum(  ;u1olto ieiat a eluvo (4tleomrcoodopD auvols t2toim3iu4apen iesat aDurx  nt0tet mfciydls2ua(vs;u0 etrxf iy1laDr i ils)teum(m3nodlpte feta( a2tr(  nu0olto oetadfa rmn snu4tlxnxoctydom rluvslt  ruoiopiu4lltnmietlt)arrrx  ou0tpe ii3iydlmDuan p;u0 rtoir iydoatelivs ( trxrir iu1ope lnetas aDumur no4oeen f3iydlm eln ont0 ltnmf3iotfaD luvo ( s2umio3nodlmtnmfvtl( aDrmurpot1tptomictasfa ea( p;u) rtnxocoatfpDrauvolt) rtr(m nudapen iet s sDrau o;t1ole if3tatlaDea(vpnu0alxnifcio1lmte nvi;( trtrim3ou1op nmivs t a2umx  ot1alto i3iydfa rluvp u0areoir oydoa elivil( teuoxo oo1aptnliciltf Dta(r nt1oltnmf3iaslm ea(vo u)arermf tytoptrlu sl( t2um(rpny4aptnmfes ( srurur ;o1tetnifeiltla uaums t0aexoxr to1omD lnvs (0 2trxr3oy4ap emfvt sfsDumu  no0tlt moetlslm2rm(mp (0 ltoir3ia1omDrai i s texm(rpnu1ape lnvta()aDrrxmo;o4opx mieilt m elnvsnu4aexoif oo1lpte i sls) rto(r ou1apee nviatfaDurxmoou4teen ociytfa2rau s u0trxrxf iadfa elnvilt) exoir oy4ape mics sf Dum(m ;o0aexnmfciasfs2ean p;() eenio totfmtrai olt) rxrxrpno1lleelfct t  Durxmp;t0oetn oetat mDrl( snu0tlxnmf3iy1opDrau ols0tetm(o3nu4ol  mnetl(fa2taxrp;o0ale mi3iyt s rl( s ()tetrio ootfatran o t0seuoiopnu1llt lfcilsfsrta(ro;u1optn ociad s2ea( p;t) eeomo3tatfateaueo;()s2um(r oodlm  mncsas)a2uru  ;u0opxo ieilsfm em(vo;() leoir3iytlaDr nei s trxr(rpoydlpenlnci ( s2umu pnu0oeenio3iltfa2em(vs;u4 exnmfctatlmDe ueo t  etrxm3iu1altnmnetl(fa2trur ou1apxo fcilsfaDulu s t4arxoir3oy1faDr neol()t2umim3iu1llen icilsfaDrax p;u4olx  fetadfs2el(vp (0 exriocia1lpt aues;s trtoir3ou4op emivia(f ruaurooo0apxnifeiltfm rlnmonu0aeerxr3iotlate neo s srumio3ou4opt liesat  2rr( pnt1apto feiatfa2ra(vpnt0 etomfcio1fa   ues;()trtr(m3oydalt  nctls arrr(  ot4apeniieiyd a emnmp u4tltnxrciydlmte u s;s0t2um(o3ny4omee icsat)aDur( p;u1tptn o3tyt s2el( s;t4trxoxf3ootoaD  uvilt) rtr(r no1am nmfei t)a2urumo;u0optn o3iatlaDulumsnt4 exrmocootfpDrluei t0s2uoxo3nudameemivta(  Dtaxmp;t0oltomo3iyslmDrm(monu4 rtoxr iydfmtr ieilt0sexm(o3no1aptn fvtlsfs2ta(monu0texnmf3iydfs uan s;(0tleomrcoytlm rluvo s texoxo oodal n ieiatfaruax o;u4ape  octasfs2um( ont0arxoxr3tydomte u i;(0 2xo(rpoy4aptnlfesls) rrmu pnu4tetnio3iatfaDrm(msnt4teenxo oa1lpDe neilt  rurir no4lmen nes sf rrmxrp;o1alt  f3iyd a2rl(vp u0 lxrmr oy1fa   nvo;s0t2uo(m oydal e fcsls)srua(r ot1apxoioeilsfs2rlnmp;t4aexoio3oydlpteliei;t)s2urio3no4olee iesa( arrmxmo;u1tlt iocildlm eln on()alxomr oa1fmt  nvi;( trumxo oydole mictls  Dtmu pno4tlen octls s2rlnms;()tlxoxo3tatfmtraivo;s0srum(r ny1lltelnesls aDta(mp;t1aex ifctysfm emn o;u0 eenxr3iodfptrli sls  rtrxrpoo1am  lics s) Dtm( pnu4oleomoetytlm ul(vs (0trtnmf ta1op r iei;(  rtoxo3nodoleemiviat)sDtrxmp;o1tlx mf3iasfaDulu pnt4trxnmo ootfm rlnvo s0 rxoim iydll nmnvs (  Dtrx oot0alxn f3tldlsDra(vont0tetoif3tytoaDrlnvo ( trxm(o3iy4llt mfes tfartmurp;u4opx mo3iytls rlums;u)aleoxf3iadlmD livo;s)tetoxmpiu1ame mics t aDumu  no4aeto feiatlsDrlnmp;() renxfctatomDran i;t)seuo(r3oo1optn fcils)a2ra( o;u4tpxo o3tat s rmuvs;t4teerxo3iatfp r i ol(0srurir3nu1alenlivsat arrmu ooo4opt  iciys sDrl(ms;u4aeerxr oo1lp rlnei (0setoir3no4amte fvil(  rur( p;u1opt iocias m ulumont0trxrif3ia1op   neil()s2xm(opoy4lpte nviasfa2trur nu1tle mfctltfm2uanvo u4trxnmf3iadlp   n o s0t2xrir3io1ll e ncsatfsDur(rpno0tetoioctyd s2ea(ms;t4 rtoxfcia1om  luvsl(0sruoio3ou1lpenmiesa()arumumonu1tltomicilsfaDulnmonu)aleomf3todfp r ivo s0 rtmim oo4aleelnvsa(farrrx  ;o0tet mfetat s2ul( on()trxnircio1om r iei ( s2xoxrpnodapeelfetltfs2tmum nu4aleo i3iytlaDul(mp (4 renxrcoydop   n o t)teumxopiydlme lnvslt  Dta( pnu1tpe mf3tyd m rmnms;t) lxrifcoa1laDrauei s  etrxmpiydlptn fesa( s2trx  ;t1apx ii3iltla2umnmsnt) renif3to1fp  aueils)t2xrxr nodlmtemnvslt)sDta( pot1tee mf3iyd aDuln onu)arxnircootomDelieilt t2xmir iy4lm nmfvsas) Durumpou4oet  feiytfm2rmnvpn(4trtoxrcoatom rluvi;() rum(m no4optemnvsl(fa2tru  nt4aexo f3tadla2ul(vs (0treriociy1lp eanei;t)seto(m3oy1llte ivtasfsrtaumoou1ope mfcilsls ea(vsnt) exnxo oo1fa rlnesl(  2trxopnu4apeemivtltf Dumumoot1tee  f3tatfmDeauvo t)trerir3tytlpDeau o t)s2xoxm ny1olt  feiasfsrraum oo4tlxoifctas mDul(vp u4trermrciytfp e ueo s  rtm(r oo1aptnmfcsl()arrmxmono4olenii3iytfmDemn p u0trxnxf oy1oa r ueol()s2tr(opoo1oleemictltf 2umxro;o0apeo fctat a2uauvo (0texnio ty1oa  au o (0 exm(mpoy1lpt mietls) 2ta(m nu4tltnmf3tldfs2ran s;u0 eerxr3todlateliei s0 2tm(m oo1llt  ncsa(  Drm( o;u0tet if3ils a elnmsn()texrxrcoo1fmDrlivi () 2xoiopno4om n fvtatfa2urxmp;t1teto oetadfa rmu o;(0tlxrxf3oy1fatraneolt) 2tmxopiy1ape  neta() Durxm ;t4apenif3ias a2eaumpnt4altrxo3ty1lpte u s s trumxrpoy1lptn fvilsfartauro;u0oeeo iciat a2ulnms (4arxnmr iytopteln o;()s2xo(o oo4lle  nvsat)s2tax  oo1opx  iciat sDuanvo t4altnifctadfmte i o (0trxmxmpoo1omtelici tf 2urxm ;u4texniiciatfa2ua(vo (0artomf3iadfmtean ilt)srtrxrpoy4ap nmivils aDrmxmp;t0tpxn f3iatlaDranvpnu4 rxoir io1oatr i o s sexrxo3ou1ameelncsl(  Draxmp;u1aexoif3iaslmDuanvo t0 eenmfctydfat aivslt0 etoxrpiy4aptnlicsas  2taxr ou0aetomfetysfm2ulnvsnt)teerxr oytopD  ivslt trurxo3oydopt  ncils)aruaum ;t1tpeo ieiasla2uanvpnt)trtrxo3oodlpDr neo;()s2xmimpiudll   fvils)srtrxm nu1aeto ieias s2ul( p t)trerxrciydfptrli s s seumim ny4op emnei ()artru  nt1texnioeiatlaDumu s t) exomrctodoa elivo;(0t2uoir iodlme mfct t)srrr( onu4oetn i3iat sDea(vo u) renmf3oytomDeaies s t2toim3oydoltemnvtls)srtmxroou0opeomfctldlaDemuvsnt4arenmo3iadoa eau o s)teurxopoo4al e iet tfaDtru p;o0aexnifeildfs ra( p (4texrmr3iatopte uvi;s) etmir iodap nlietl()a2rau onu4opx  i3tlsfs2eaump;() ltoio oo1fpDrai o () rxr(mpiodal n nvias) rtauroou4aetn octlsls2emn sn(4artnio oy1lp  luvs s) exm(o3oydolte ies tfs2tm(mont0ope ii3tldfmDemnvo (0trxrmr3iatoatr neo t0 2xmxo3oydol elivs s  Dtru pno1opxnmi3iysls rluvs;() eermrciotfmD aueo;s trxmxo3nudale miet s)arra(mooo0oet io3tysfa rluvs u)alenmf3iatopteai s;(  2xmim3ny4ameelfcsatfarur(rp;u1aeeoif3iydfa2ra(vo (4 exrmf3ootfpt  uei;t)t2umxmpio4om   ivsls  Dumxr ou1apx ioetlt sDemu p t) rxrircio1fmD  uvolt) exmxrpiudoleemfvtl(f rtaur ot0tet moeiat a2emuvo u4arxnxo totlpD anvi t0 exrir3oydom n fvi ( s2ua(mpou0oetn ociatla2ranvo u)altrir oo1fpDrlneo ( s2toim io4am n nei t)sruax pnu1tlxomo3ildfs2elnvo t) rxnir oydlp raneilt0trxo(m ou1opeemnviat aDtax p;o4oeenmictlsfa ranvp ()trxriociadfp eaivo;s)sexmxr3iu4ol n fcia( sDrmur ot0tlen ietysfa2rau on(4trerxfcootopD luei s0trtrxm ny4am nmfcs sfs2truroot4oltnmo3ias a2ea(mo t0 rxnxrcoy1oa r n i t)srum(o nodole lfvtatf 2urxmpoo4tle mo3iatfm uaump;u) lxnif tadfat auvi s  exmim oy4al elfesa()arur(m ;o4oet mfctldlm emnvo;t) exoif io1lm elu s;s)s2ur(m3iudol   icia(fsrtmxrono1ape mf3ildfm2rm( p;t4areniocoa1lmtelu s t)tetmirpoudal  mfvtas) 2urxr nt4opeo i3ildls eanvp t)treoxfcoydlpDe neolt0trxrim nodaptemfvtlt)a2tmx  no4tleomi3tldfa2rmumpnt4trtnio oa1lp elnvilt0s2trxm no4olt mnvslsfsrrr(ro;o4tetoio3iadls2rm(vp;(0 rxoif3ty1oa e n s;t)teumirpoodomee net s)s2ururpnt4tlxo ietlslmDumums;() rxnifcoo1fateaueo;t0t2xo(opou1lptn nci (fsDrm(roou0olxnmociys aDranvp;t4arxnxfcoatfaDelivs;t trtrxr io1llenmfvtatfarur(m nt4tptnmociyd a2rluvo;(4 ltomr3tytfpt  uvi ( t2ur(m3ou1al nmfvsa(  rur(ront0ape mfciat s2ea( pnu4trtrif oatlaDrlneo;t0 rxo(r oo4ap e ncilsfaDtmu  nt0oltnmictas sDrmnvpn(4 leomo oodlpDrai o s)s2xrim3io1openmies ( arrmu onu0tpt mf3tls sDrl(vs (0 lermo3tadfaD ln i;( srxoxo iudol  mneta()srtaxrp;t4olx  oeilsfa2rmuvo () eenxrctydomt  uvs ()sruoim iodamteliviat  Dum( p;o0aeen ieilsfm rm(mp;u4 etnmr3iydom elnvsls) eto(o nydalenmfctatfsrraur ot1olxomiciadls2uaumonu4arerxf iy1fa eaiei ()teur(mpoodomenmnvtlt  rtrxrooo4altn ictld a ulnvsn(4artrio tydlmt aueol(0 rtrxrpoo4oleemnviat arra( pnt4opt ioctltlmDrmu o;()tlxrmfcoydopD lnes (0srtmim io4al nmfeil( sDumuroou1apxo oetatls emuvs t0teeoxrciatfat auvilt0srur(r ou4lptemfes s)srrru  ;o1optniieiat a2rlu p ()alerxo tydomDrln o t srxm(rpiu1al  mfctl()aruax onu4tpeoif3iatls2rmn s (4 rtnif iytlp  lueo;()setmimpny4lp  lnvtasf rta(r ot1apxnmoeiydls2umumpn() exoxfciotopDrln il() 2umxrpnu1lltn fct s sDtm(root1ope ioeiadfsDrm(mo;()teerxr3iy1oaD an i;( t2xoio3oodomenmncil(fs2rauroou4ape  oeiydla2emn pnu)altnxrcoo1faDe neilt0t2urim3nu1om  mivtltfaDumum ou4alxo f3ias a2ua( o t4alerif3ty1oa rlieo s  rtm(m nudome  fcs t  rumxmooo0oeeo feiydfm2rmnvp;u4artnmfcoo1op   ivsl()teuoiopnudome mnciltfsDtax oot4apeniiciatfa2ea(mp;()artnmo3ty1omDr ues ( srtr(r iy4al emietl( aDrr(ro;u4ole mf3iadlmDrm( p u0tltnxocoa1lpD ai sls0trtrxo3iu1llenlfvsas)s2tmum oo0opxomiciydfs2ea( s;(4 reoif3tatomDr n s;s trtmir iu1ol  mnvs ()a2ra(mp;u0oee ioeiadfa2ranmp t0altnif3to1opDelivi s0t2tmir iodoptemnct ()srua(r ;o0oexniiciatfm eaumpnu)tlxnxrcoatlaD  uei;( texoxr3iodomtemnetatfs2raurp;t1aexomoetatfs2eanms u4 etrmf oydlmt  nes (  ruoio3oudal elfci t)sruru pot4olenif3tys s2ulu onu)trxnxfciotfpt lnvolt0 2urxr3ou1lpee fcsat)aDrrx oou4alxoifctytlm2ranmsnu4trxrif3iadomt aneils  2xo(r3oo4lm  lneslt) 2rm(mpou0teenmi3ild aDrau pnu4alxrxr oodop rauvs;( s2uoxm3ou4om nmnesatfsrumx o;o0tlen iciydfsDelnms u4arenxr iydfatraiei t) exm(mpny4ame  nciat sruaur ou4tpe mf3ias m2uan p (4 rerxfctydfp elues;() exoim oy1openmicsat)a2urx p;t1oexnmiciasfsDeanvo;t0arxomr3totomDe i i;s0t2xrir3oo1lptnmivil(fsrrrxr ou0apen i3iatlmDea( s;t0teeomocoytlatr uvs s0sexmxmpiydalenmivsas)s2rm(m ;o1oexomictyd m2uanvo;(0trxrmr oytlpDeai ils0 2umxrpnodlm n nvi (f rrmu p;o4openiiciat a2ua(mont4tlerxr to1fa eluvs ( trum(opiydoptnlicslsfaDtmxm nt4aptnmfeilt m emn o u4 rxnmfcoatoaD  i ils0 rurimpny1ol e fet () rtmxr ;t0teen octatlm2ea(vs;u0areomo3oy1lmDrlueolt0s2xoio oydamtnmietatfartmurpot1teenmoeils mDea( sn(4alxnxr ta1lmtraivilt  2xoxm3nydlm nlivt s aDtrurpoo4opxomociatfa2rau p t0texnxf3tytfp elieo t  2uoxopiu4lp nmnvsa() Drm(mo;u1ale  o3iyd aDea(mp;u)tetrxrcto1lmtelivo;(0t2xoxo iu4ome livt (fa2ururo;o1tptomictltls2umumpnu0aeenir3oydlm e nes t0trtrxopno4llt  nctl()sDtaurooo0opeo fetydfs2rmn sn(0 leomo todomt  u ils0 eur(r3io4opt mfct (f Dra(rono1texn f3iat m2elu ont4 rtnxf3iodfat  iei ( t2uoiopnu4lm  lfcsas) 2tau  nu0oltoif3tytfm2rlnvp (4teenxo3oodfmte neo s0s2uo(m3io4optn fetas  rta(moou0alto ieiydlm2uanvo;u)altoir tadfmteaueils t2um(opnydame lici ()artmxrpno1oeeo feilt a2eanmp;u0 rerirciy1fmDrluei;t)t2xm(opno1ale liviltfa2rmx p;o0ope  i3ild a uauvp;()tlxrxf iatfmteluvo;t  rxmxr iodop nlnetat  rrr( oot0tpeomoctysfa eauvsnt4aetnmr tatomtrai slt  eurxr ou4ole lnvtasfsDumur ;o1ope  feildlm2umuvp;u0 ltoxrciy1lmteai o s trxrxrpno4ol emfcias a2rmxronu0optomieiltla2em(msnt0trxnmfciotla  ai o;t) rxrxmpio1oltnlfeta()sDtr(rooo4tpeo octydfaDuln on(0alerxo3totfa   ivo t0sexoirpiodllt  fcilsfaDururpnt4tpxoio3ild mDuau snu0alxnxr3oytoa r nvilt)sexrxr iu4aptemfvtls  ruau ooo0tee  f3tys sDrln onu0altrxr oy1lmtean o t  rxmimpnydal n nesat a2um( ono4oexomiciat aDua(msnt) rxnxf3oatop e neolt)texrio3iudap elnetl(fartr( p;o1apxomfeiytfmDem(msn(4trxoxf3iotoa   nvil( t2ur(o3iy1altnmnvs sfaDrmu  nu1apt ii3tatla2ranvont0aexrmf oo1lmDrlnesls trtoio oy1lpe mnviltfartmxmp;o4oexo fctasfs2ranms;t4tetnir oatoat an i;s0texoim3iodlpt lietlt a2tauroou0tleo ieiadfs uanvo;t0 exomo iytfpDeli s;() rtmir nodlptn fcsatf 2rmurpnu0aptn feiytfs2ua(ms (4aeenirctytomDrau s s0srxm(r3oo4lp nlnci (  Dua(mp;o4oet mfcilt a ua(mp;t4alxrxocoa1fp r ieo t)trumim3iu4apt miesas)a2tr(r nu1texo ieiatfa rmnvs ()artnmfctytop e u s;s)t2tmio oydape mfvt t)s2rrxmp;o0tet mi3tld s em( ont4tlermfcia1oaDe uvols t2um(r nodlpt  icslt)a2raxroou4alxomicildla umn o u4texrxf3oadfmtelu o s0trtmxrpio4lpenmnct t  Dtr(rpnu4apenifeiyd sDelump t0arxnio iatopDe n s;t0 etoxm3ou1ll  liesa( a2ur(mpnu1oeeoifciatfsDeau p;u)arxoioctotfm   n s;t0 rtmio ny4omen iet sf 2rm(mont1oltoifctatfmDrlumo;(0tlenif3oytla  luvo (  2xmxr no1om e ies t)s2tm( poo4optoio3tasfm rmu p;t4teenxr3todla eau s s t2triopoo4llenlies s a2rruro;t1opto fcildfaDemn o u) etnmrcoadoa e ivsls0sexmxr3nu4llee nvtat)srua(monu0tle moeiytlm uln pn() rtnxf3iatfp   nvs t)sexmxo3oo1al n nvi t) Dtrurpnu4oet ifetlsfm2ea(vp t0aetnmo3oatomteaueolt) rxmxo3oo4ape lnvsl( arumxr no1teeoif3iltlsDeauvpn(0texrxf3iydomt auvi s)teurxo3ou1am elict s) rta(r ou4ope ifetlsfs ea(vs;u4trermfcoytfmDeluvol()t2to(m no1oltelfcslt)srtmurp;t0ape mfeildfs2ranvp ()aleoir oy1oat  ueilt0trurir3nudapee iei s)s2rau oou4open fctlsls emnvs u4aetrir oo1fp eln ils t2um(opoudaptnmfetltf rrm( p;o0tetomoetytfm umnvonu4 reoif3tatom   nes t)t2trxo nu1ap  lfcsat aDta(mo;o0ape if3tld mDulumpn(4 ltoir iydfate ues;s) rxoxm ou1ap   net sfaDurxmpnt1oet mi3iys aDran p (0 lxrxr ta1lp  aieols0 euoxrpoy4omenlncslsfs2tru pno4alxnioctasfsDemu sn() rtoxo3iodoat aieolt)setmxmpoo1lptnlnci (f rumumpno4teeoioeiytls ulu p;u4altnmo oydlat anvs;(0t2xmxo nu4omtn fes s s2umur ;o0alxn feiysfaDum( s (4 eenxo iytfpte u i s0s2umim3iodal e ivs tfsDrmxrooo0aptnmi3iyd mDulu o u)altoiocto1lp eli ilt0 eto(r3nu1oltnmicsat)aDtmurpou1tpxn iciatfa2ra(vo;(4texrmf oa1omteluvi t0teumxr oydoleemictl(f rrru  ot1tlen ociltlaDran o;t0trxnxfciytfptr ieo;t0 rxmimpou1alen fesa()a2rm(moou1teenii3iysfm2umn pn(4altomr oo1fpDean s;s s2umxmpiy4olen fvs sfsDua(mo;u1teeomiciasls ulums t0teeoio to1oat  ieo t  exo(m ou1lpte fetatfsDrr(mo;t4tle iiciydfaDel(vs;u0tlxoif to1lm rai o t) eum(rpnydlmte nesa()sDtaurp;t4ale ioctysla2uanmp u4texoir tydfpDeaieo;s0sexoxr no1ol elfvi () 2urxmp;o4oex  o3ils a ulu o u4 rxomf todfpDrluvs () rurim3oudap e neil() ruru pno4tlxomfctldfa2elump;u0trtrxo3iydfp e ivols0seuo(o oydllen iei (  2urxm ;u0tpx  iciatfs2umuvpnt)tlxrmr to1fmtrluvs ( trxrxr3oy4olenlfetl( srrmxr ;u4tpenifciadfm em(mo;t4aeermr io1la   ueo;t0 ruo(m oudolt mivsa(f 2umur nt1aee ifcild a rlnmpnu)tlerio ootlatelnes t sruoxm no4lpe mfvi sfa2rm(m nt0tptn oeilsfa2uluvs ()areoio iodoaDeai ilt  rxoio ny1lm n fcs (fa2um(rpnt0tpeomoctasla ranmp (0artrxo3ia1fp e n o;s0s2xoxm oy4aptn nct sfs2umxrpoo4oltn ieiasfmDeau on(4aeeoir3oy1fat  ivs;()sexr(m iudom eliesa( sDrmx pou4alx  i3iyd mDrlumon(4 eenmocia1om e ivi t)seumim3no4omtnmncias aDtm(m ot0alxn octasls2rmnmonu0tlenxfctadfmtrlu sls0s2xrxm iu1ap  lfet tfsrrau  ;t0oeto feiltfm2ean o;u) etoxr3iytfmte i sls0 exr(o3iudll n fesa(f 2tr(mp;t1aeeo feilt m emnms (0tlxrircootomDeluei;t  rxoim no1op elfvtat arur(rpot0apenmoeiyd aDemu p;(0 ltoio oydoptr nvo;()srtr(rpoy1lm  liet t sDrr(mo;o1tet  fcildfs em(vo t)arxrmoctodfatelnvi (0 etoxo3iy4omenmies ()s2trx pou4tpx io3iyslm eaumo t)aleomf oy1fptrlnvo ()t2ur(o io1lmenmict t)a2tmumonu1oltniictatla2ul( pnt) ltrifcoatlpD lues s)trurim io4ameelnci ( sDrmumpnu0olxo feiasfsDuauvonu0areoifcoatoaD aies (0s2toiopnydol elnesa()aDrrurp;u4oex  oeiad aDemn ont4 exnir3ty1la rau o;() rurimpno1ll nlicia(fsrua(ro;o0aeeomfetat sDulnvo;u)tlxnir iotlmte nvols0 2urxr iy1llenliei s  2rrxr ou1opxniieils sDemnmp;t4 etriocoydopD  ivols0sruoimpnu1ap n fvt sfarum(m ;u1opxo o3tlt m emu o t4trerxfcoatopt lnvolt trumxr3nudomte ivilsf Dtau  nu0olxomieiadfm2emumpnu4alenifcoo1lp e i ilt0trtoiopnu1om  mfeia( aDururoou4tpt  o3tatfs umnmsnu0tlxrir3oadlat luvi (0 2xo(r iu1lptelnvia(farrr(mpot0texniiciad sDrmn ont0 etrifcoodlaDeauvil(0srto(r3nodlmt lfcsatfarur( oot0opto fcildlsDumnmpn(4aeeomr3oodlpt aies s srtmxopio4lmen nvt s)aruau pou4oeto o3tadfa2elnmon() lxrxrcoatopD aueils texoir3iu1ame mfci t) 2tmxroot4aex  i3tlsfs2eln p ()texoxrctydomte nvo s0trxm(r3oy1ll elieia(fa2trumpou1tlxomfeildfs elnvpnu0 etnmo3oydomD  ivo;t s2urir3ny1llenmivtas) rumxm no4tptomfciyslm eluvo ()trermf iytlpD anvsl(0 eumxm3iudalt mivsls) 2urxr ;o0tpeomi3tatfs2uanmon()texoxf3iy1fp rli olt)t2xrxr ou1lpt lnctasf Drmx ono0aexnmo3ildfs2ea( s;t) etnif iy1laDrlivo t  rur(r oudop  licias  2ur( poo1aeeoioeias m umu snt4 exomociodlmD lnvi;s  rurim3ou1om nlfesa( arta(ront0tltnifetat sDel( pn(0 ltoif3oadoa rlivs;t) rxmim3nydop n ictls)aDta(r ;o4opt iieiydfaDrluvpn() ltrifctadlmDeluvslt0 2xrirpoo4lmt licil(fa2rr(rpnt1tlxoif3tltlm eanmsn(0aetrif3oadoaD  n o t)teto(mpoydol n fei t sDta(  oo0tpt ioctad aDemu o;t)arxoiocty1lpDr i o;t0t2uriopiu4om e ict tfs2umumo;t0texo o3iydfm2ra(vpn(0aexomoctydfpt  neo s0texmxm3ou1ll   fctltfaDrmump;u1oltn i3tasfmDumuvo (0trxnxocty1opteaneols0seto(opiodlp emfvt ( sDtru oot1aeenmfciyd s ul(vsn(4tetomocty1latrlu i;(  2tmio3nodamenlfetl(fa2ur(mp;u4oeeniieiyd m emn pnt)aetomfcoo1lp  au ils t2uoxmpno4ameemiei (farraumpnu0aptomfeiadfm2eluvpnt0 ltoifcoa1oatr ieo ( srtrim io1lpenmfcs s  2rr(mont4tex mictlsfm elnms;t4trxnmrciy1omtraivi;s)sexoxm oy4ol elivs t a2rrxrp;o1tpen ieilslm rluvo t4artrircoatfpD au olt  2uoimpou1om   ivtlsfarra(rpoo0texomoeiysls2rauvp;t)tetnmf tydlpDeli i;t0 2trxo3oo1amen fes s sDuaxroou1apxnmo3ild sDra(vsnu)teeoiocootlpDeliesl(  exrio nu4om n fetlsfarraur no0tee  i3iat a rm( o;t0 lxnmfciy1oa elieo s0 2toxr oydoltnmfcs t a2trx  ot0oleomfciatfmDemuvpnt)trtnirciydoat ai o;() etmiopio4lmenlfes s s2uaxrpot4tlenioetytfs ulump u4alenxo iytop eaivo t trtoio io1omt mncsls)srtm(rono4opx ifeiytfsDemumo;u0aexoxocoadfmteau ols)t2tmxmpnu1lp e ictltfsDua(mo;u4oet  i3iyslsDemuvpnu4alxnmrctatop  auvol(  exr(m oy1alte ncil( s2tmxr ;u4tlenmfeiltfm rm(vo u4aeeoxfcto1fp rlu o;( srtmim3oudoltnlictatfa2ra( ono1tpxomo3ilt sDranmp u4tlxrxocio1latelnvs t s2to(o3oy4ape  neil()s2um(m nt4optn feils s ua(mo;t0texrxocoydop eli ils tetm(opnu4am n nvil()s2uax p;o0teeo f3iat a2ea( onu)aeerxociytfm eauesls0truoxrpnydap e fcsas s2rrxmp;o0opt  fciydfmDulnmp;t0texrifciotoatr uei t0s2urxr3ny4lm emiesas)aDtrurp;t1tlxoifctlslsDel(vp;t) renmr3tydfatr ivs;s0 2xr(m3no4lm  livtl()sDtm(m ;u1tpto fciadfs eln p;t) rtnio oy1optrlu o s0t2xmxm iy1ll n ieil(  Drm( p;t1opx mfciyt mDrluvp ()tetnmf3oytoptr ivi () exo(r oo1op  lnvtltfsrtmu ont0aetoiieiydls2uluvo;t4tlxnmr oadop e ieo;(0sexoxo iu1omtemfvtat) 2taump;o4aetn ieiadlm uaums;t0altrxocoytopD auei t0 rtm(opnu4am nlneiasfsDrrumpoo4teenmfetltlaDuluvon(4tlenio to1lpD  ieolt)texrxmpiu4om nlnetas)s2trump;o0tee mi3ias mDelnvs;t4 reoif3tytfm elneslt) 2ur(opny4optemfeilt)arraxr ;o1tltnmoeildfa em(vp;(0tlenxociytomDrai i ()truo(rpoodllen icta( a2raump;t4tltn fetys a2umu o u0tlermf iadoat li i;t) rtoxr ny4om e icsa()srrruro;o0oetn f3iat m2rm(monu)aleoio oydlpD  u o;( sexr(opiy4open ivs t arur(rpno1aexn feilt a ulums t)tltoxfciadomtran i t  exmxr iudal   fetls) rtmx  ;o1tee mictls s2el( p;u)tltrxr3ty1oa r ivolt0t2tmimpoo4lm   fetat  2trxm ;u0altnifciytlm2ulums u) rxomoctotomt  n ols0srtrim oo4olte ict tfsrtm(rono4openmfciltfsDumu onu4aexomocta1oaDe i s s t2ur(opiu1lpe mnct t  2rru p;o4aleoif3tadfsDulumsnt0 eenioctytopDrlneo t0s2uoxo iu1optnmicsltfsDurx oot0altniieiyd s2uln pn(0 exrmr3tydfat lnes t0t2uoxo iu1ol  lfvsltf rumur ou4oexo fciytlm2ra(mo u)tltomr oo1opDeaivo;( texmxo oy4op   ncil(  Drmu oou4tltnmo3iytfs2rln s;u4 leoif oodlmDeau s;s  2xoio nu4al   fetat)aDuaxmo;o0openmfetad s2rmn onu) lenxocia1oaD  nvs;()srxoxr oo4openmfct s artmx pot4tlx iiciasfs2ranvp;t) renir3tadfm e ueo ( srumio oy1amt lnvsa() 2tm(mont4ole mi3tasfa emnvp;()tetrioctadlp ranvolt trum(r nydll   fvi (f rtmur ;u0tpeomo3tyt aDul(mp;u0aexnio3to1fp eauvi;t t2xm(mpiy4lptemivsl()aDuru  oo1alenio3iysls rmu sn() rerxocoadfmDelivsl(0teto(mpny4lpt  fcilt sDum( oou1tex mo3tldfsDumnvonu)aeenmocio1lmD ln o t)t2xr(rpoudlm nlfvi sf rrr(mo;o1tlxo ieiltlmDranmo;t)tltriociatfmDe n il()t2urxm3iy1ape  ivtls)a2tru pot4olxnmoctlsfs2ean on(0texoir3oa1lmt lueo s srur(r oy1lmeemictas aDuaumoou0tpe ioeilt s rluvo t0 rermr tydomD an s s0trtm(o nodlpeemnesat  rra(mp;t4tptoifeiad mDuluvp u0 exoxr3iytla  auvolt0 exrir nu4ol   nvsa( s2tr(rp;t4aexn ieiytlm rl(vsn(0texrxr tytlpt luvi;t0trxoiopiodamtemfeil( s2trxrpou1aleniictldls ua( onu)altrmfcoadfm  aneils0 rxm(mpiu4optnmfcs ( aDrmxm oo0tptoiociltfs em(vp;t)trerxo to1fp eluvs;t)sexmim3iy4ap   ieil(  rtrurp;o0oex mieiaslsDeln o;t0 exrirciytoptr i s ( trumxo iy1amenlfetas aDua( p;u4teen icilt m rmnmont0 rtnxo iytfatranvs;t)t2trirpoudalte fcsasfaDtmxm no4teto i3tld s2rmnmont0 lxnif iytlateaivolt0tetoxrpiy4omen ici t)artrxrp;u4tex mfeiltfm2emnmo t) lxnmo iy1opte ues s t2trim oudaleemnes (  rua(r ou4tlxnmf3iasfmDrl(von(0 exoxr oo1lp r ivsl(0 2tmio3ou4ap  mnes (  2urumooo1altniocias sDul(vo u)trtomf3ootfpDr uei (  2tmio iy1om elfci tf rraxront0tee mfetlsls umn p;() rtnirciytfpD au o;(0 rto(o3oy4omeemneils  Dtru  nu1tpt miciytfmDrm(mp (0 ltnxocoy1lmtelu il() rumirpnu4ape mivt t srtrxm nt1aexo ociyslmDeauvp 
\ No newline at end of file
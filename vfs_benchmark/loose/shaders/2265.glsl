@@ -0,0 +1 @@
+nvs ( srum(rpiy1oltemfesatfarum(ront4oeenio3iatfmDua( pn(0teenmr tadom e iei s)setm(o nu4oltn nvias)srra(monu4tltomictldfs2emn p;(0 rxomrcoadlm   ues s)seuoim3oudamee fesa(fsrtrur no4tetn i3ias m2uauvo (0 renxf3oodoptr ivilt  exmirpnudap elnesas artaxr ;t0oee  f3iytfa2umn on(4artrmoctodfatr i sl( t2xmxr3oodlptelncta(fsDtmx p;o0opxnioctlt mDua( s;() renif to1fpDrai sls) 2um(opny4llt mfeiat a2tm( ono1oetnmieiyd a rm(vo;(0 lenmr iy1fm r u o t s2uoirpnudoltnlfvsa(f rur(monu0tpeomo3iytfsDelnvont4 etomf tytfmDean il(0srumir3iudope mivt (  Dua(mp;o4olto f3iaslmDeanvo (4 eeoif to1lm rlivs t  rxmxm3nu4optn ies t)sDuaxr ;o1tpxoioetatfm2rmnms;t4 rxnxf3iatoa r n slt) rtrirpiu1lme  nctl()aruax ono1tpx  f3iasfs emuvon(4teerio iydfmDean ils) etoio3iy4amt micta( aDrax ono4ope iiciltlm uauvp;t) rerio3ta1fmt an s;s0trto(r3io4al nliet s)sDraxro;o4oexoiociys m2ua(vo u4alxoxf3ta1oatrluvi;(0srurio3nu1am n nesa(f Dua(mp;t0aptomieiys mDulnvonu)texnxo3io1fptrai s;(0 exo(mpoo4omeemnet s  rtmxm ;t0oexnmi3iasla el(monu4tlenmoctatla ranes s t2tm(opoo1opeelncsas)arrrxmpnu0apeomi3iadfaDem( o;t0 renmf3oatlmDe n s;s0t2tr(mpoy1amenlfvia(  Dua(rooo1tpxoiociysfm2eanmont) lerifcoytla   i o;s) 2xm(o3iu4openmieia(fsrrm(ro;u4oet moeiasfs2rln p;t4texomoctodlpDrluvi t)srurxo io4lp n ncia(  2uax ooo1oetoiiciadfa ranms t) reomocoa1fm elneils sruoim3iu4lpe livi t) Dua(mpnu1apxn f3iytfs eanmo;()tltrxr ootoa  anei t0s2xo(o oo4omeemfei sf 2tmxrpoo4oexomoeilsla2rluvo;t0trerir3ta1oaDr ies t0s2uoio iydom n ncilsf 2ua(m ;o4tlenmoetytlsDrl(msnu0artnif3ty1omtrluesl(0s2toirpoy4lmeemicias) Duau o;t1tle  fciytfs ra(msnu4 exomfciodfa elivi;() etrir nydomtemncta(fsDtmum ou4aex ioeias a2ul(mo;()tetnmf3oy1op  anvi;s  rxrxmpiodop n ict (faDtr(mo;t0tetn f3iltfaDea( s t)aexoif3ootfaDe ues;s0texo(rpio4ll n ictat srtax o;o1tpxnmieiad aDuan snt0texoiocoytlpteai i;t  etmxo oo1al elfct s sDrm(mp;t0tex io3iyt m uanvsnt)tlenxrcoo1fpteauvs s  rxoxm iy4olee fcslt arrmxm oo4optoifctasfa emuvo;t0trxnmocto1fmDr n s ()truoir3oudoptnlfesa(  Dtaum nt1opxn fctydfa elumo;(4 renxrcoadfat lnvs;s s2trio oodapteliet s)artmu  ;u1opt  oeiys s2umums;u4 etnmf ty1lmt livo ( seurxr3ou4apenmncsa(fsDrm( pno4altnifeilsfa rluvo;u)alxrmr iadop rlies;s0 2toxo ou1lm nmieiat) 2umx ooo4tpe if3iydla2em(mpn(4 etoir3oa1lmDrlnesl(0trxmxopio1om nmnesasfaDtrxrpnu4ape ioctlsfm rm(ms;t4texoiocoo1opDrluvi;() rur(mpno4olte nvi (f Dtau pot0oexo f3iytfa2rl(msnt0aetoir3oa1om  luei;s)t2urimpoudolee ncs ()artm(m oo0apen fciytfs umuvp;(0trtoxf3oa1lpte i ols setoimpiy1oltelfct ( s2rr( ooo1oexo feiyt a2elump;t) ltnxr totopt ln ol( trxmirpoydome lnciltf Dum(rpot0tleniiciat s2rmnmsnt0 lxoxr oy1lp r uvs (  rumirpiudop elnctas s2ra(rpnu0alx mociltlsDumnvp (4 lxrmo iadfaD  n ol() 2umir oydole lnetl(  rtm( ont4teenmo3tlsfm uanvo;u0 ltoxr3ta1lmte n ol()t2toiopio1llt lfvs (f 2taur ;u4optniocilslaDumuvp;(0teeoxfciotom  auei;() rurxmpiodlm elnvtls) 2rm(mo;u4alt ii3tltla2uauvp (0alxnifcoy1lpDe uvi;t)srtmxmpiodolte iet sfs2trxmpot1tlxomfcils m ea(mp;t)aexrif oytlp raivi;s0trur(opou1lltemneilt) rtmur no0tlxoifcilt m umnvs (4 ltnif3ootfm rlnei ()s2uoio iydap  mieilt a2taumpnu4aetnioeiytlm2umnmsnt)tlenmo tadfpDrlnvo ()trur(r iudlpeemivs tfs2um(mont1olx  oetydlm2umumonu4tetrxo todlpteaivo s t2tm(r3no1amt  fcilsf rtaxm ot0tle  f3tydfsDem(vo u) eenxo3oa1lpDe neo t0s2xmxr3iy4ap e nvil(  2truro;o4alxomfciad sDranvo t0 ltomo oytfpDean s t0 exrxr3nudamtnlici s) Draumooo1tlx mieildlmDrl( s u4alerxo3ty1omtrauei;t) 2urio3iy1alee fct s)s2rmur ou0tpeomo3tydfa umnmsn()trtnio3oy1fpteaneils0t2tmxo3no1optnlivil(f 2trxrooo1tetomfciasfs emnmpn()texoio3iodop raivi;t) exrxrpnydlmtemnvtl(f 2urxrono4tpxnmfeiltlaDuauvp (0alxnio tatfpteaivi s0 rur(m oydameelnvslt  2tmumooo1optnmieildlsDrln o;u)tetoxocoo1oa   ivs;( s2uoio iy1olt  fet sfa2rmxmoot4oee if3tysfsDra(vpnt)tltomrcoatfaDeau o;(0teumirpny1al  mnesa()s2tmur ot4ole  octadls2ua(mp u4texomo3ia1oat  nes;t)trtrxmpiydamtnlivilt srumuro;u1apxo i3iydla uauvsn(4texrxo oydlpDr neo;(  ruo(m oydole mietlt  rtmxm ou0alt mf3iltfm2ul(ms;(0trxnxr3oodoa e uvo t0trur(r3iu1llt mivia(  rtax ono4opx if3iatfa umumon()trxnxociatlp elnvi;t0s2umxr io4lleelnvslt  rua(moot4opto o3iasfs2em(mo;()treomrcoadfp e u ilt texoir3nu4al nlivtlt srua(m ;u1opxn o3iytfa2ul( snu0tlxrxfctytlpDr ues s) euoio nodopt  fvs sfsDtmuro;u0openmf3iyt s2raumon() rtrmo3iy1fat  u il( texo(m3no1lltemicta( s2rrxmo;o1teeoio3iydfs rm(ms t) lerio3iytlat  u s (  euoxmpny1ole lnctl(  Duau  oo0altnio3iyd aDulums;(4texomf ty1laD livslt0 euoir ny4altnlnvi t) Dra(r ;u1aptnmf3iad mDua(vo t)teenmf oodla e n ol( t2xr(o3iudapeelfctas a2uaxmonu4alxnif3iydfmDeauvo () etomf3iy1fp   ieilt)s2urxo iu1ope mnes s srtmxmonu1apxo oetydfm ean p;u4 renxo iy1lmt lu il(0setm(opio1apeemnvs (fa2rruroot0tptnmicild aDemu p;t4aetnmf oatoa e n ilt)trur(rpoudlptn nciat  Dtmumpnt4aeeoiieildfs2eluvp ()trxoxr3iydfa   nes;(0t2xoiopno4lltn ieil()artru pot0tptn oetyd s2rau onu) ltoxo3tatomt lueil()t2toxo3io1omeemicia( sDrax ooo0tlto fcild sDrmump;t0 eerxr3tadomDrlues;t srto(opoy1opee iesl(  2ra(r oo1alx ioeils s ulump () renif iatlmtrluei s t2ur(mpiu4om nmnei sfs2rmxr ;u0apxoiiciyslsDrlnvonu4artnir3iatoa eliesls0seto(opiy4lp  mfeil(  Dur(moot4tpxoiieiyt a2umn p (4 lxniociatlaDelivs;t)t2trxopnu1ap  lnviltfarrmu  no0tpe if3tls a2rauvpn(4 eermr tadla  an il()seurir nudap   fci (fs2taur ;t1alxnmo3tlt a emnvon()texrxf oatfaD lneol(0srurxo3oo4apenlnei s  rur(  ;t0opeoifeiltlm raump;t0alenxr oodfmteai il()t2xrimpoodamtnlncsls  2umx  nt1oex iictadfm2rmnmpnt4tetrxo oatfmD lu sl()teurim ou1ol elneia()srrru p;t4aetnmociyslm elump;(4texrxr ootlpte i i;t)srtrxo iudlm  lfesl()srtaxmont4tlxnmi3ilt sDemu pnu0artrxrcoa1op e u sl(0 rxr(r oy1lme livs t a2rmxrpot4tlx io3iydlm uaumo;u0 lxrxfctytlmD  neol( texr(o3oo4apt mnvil(  rtm(mpou4apt  oeiadlm rmumonu)tetnmf3totlaDr uvo (0srtmxm3oy4al  mfeil()sruax poo1oetniiciytlm2emuvp;() rxoir3oydlateauvo t)seto(m oo1apee fvt tfaDrrxr nu0tex if3tadfm rmums u4tltrir io1oa ranvs;( texoir iodamen ivtasfa2uax ono1tle  i3ilt s uauvp;u)aeerif3tadoaDran s;s0texm(m io1om nmies sfsrurxmoou1tlxnmfctytfs uanvo u0aetoir3tatlmt aivolt)s2xm(mpnu1op emncia(f 2taumpnt1teeoiictldla2rm( s;(0tlxomf3iy1fptr u s ()s2trim iydamtemnvsl(fa2raxm nt4tpxnio3iltfsDemn p t0 rxoxfcootlpte ivo s)srurxm3iy1lm nmfesat sDrr(  nt4tpeoiicildfa ea( pn(4 eeomocoy1oaDr ivols teum(mpoo4lm  lfes t) Drrxr nt0tpto fciadfs rm(mp;() etnio todfat anei;t0trxo(r3oydlle  ivtlt a2rauroou1opeo i3tltls uauvp (0alenmr iy1lm rlieils) ruoxr oo4op   fvslsf Duaxrono1apeomociyt sDeaumo u4 etnxr ia1fm  lnei (0trumiopoy4op elnvtas)arurx p;u1olxoiieils s2rmn snu)tetoif totlp rlies (  eum(m3ny1lp emfvils sDuax  nu1apt ifetyd aDeanmo;u0texomf ty1oatraieo s texmimpnu4ll nmivtl(  2ur(roou0aptoio3ilt m2uaump;u0aeeoxr3tytoaDe ueils0s2uoxo iu4am n fei tfsrtau  nu4alen f3tysls2rmn p;u0alxomo3oo1lm e u s;t) exoxr3iodope lieias) 2rr(r ;u4tpxnmfciat s2ean p;t4altrio3oo1fp raneo;t texo(m3nodalenlnvtat  2tmu pno1aptnii3iaslm uaumpn()aetnir ta1lm   u o;s s2xmim no4ome  nvsltfsrtr(mp;t0oet mfetys m2eaums u0texnxr3oo1fpDeaivslt0srum(rpnodlpt  feiltf 2uax oou0tptnmieiat a ranvpn()alenxfciatlp r u ols) rtrxr3iydll n fcilt)sDraxr nu4oltnioeiytlm el(von() exomr3io1oaDraieo ()srurxmpiy1amtemnvtlt)aDua(rpoo0tltoio3iltls2rl(mo u0alxrxrctadomtelies s)t2triopnu1lpt lnvi t)srurx p;t0teenio3tltla2rau p (4 etoio3iotom r n il(0s2xoio3nu4am   fcs ()artmurpnu0ole mf3tltlaDraump;(0 ltomo3oo1fmD ai s (0trtr(r nodamtnmicta( arrr(mp;t0tetomieiytfs rm( on(4 exnio ta1opDrlneolt)s2uo(m3nydaptnmfvta( aruau  ou1tleoio3iydfa2rm(mp;u0tlxrxoctodla r ies;t0s2urxr oo4ll  mfvsa( srtrxr ou1tlto iciat aDel( o;()trxrmfctytlaDelivsls  exrxo iu4opt  ivils)artr(ro;t0tpxnio3iysls uauvsnt) eeomr3ta1fpt au s;s)s2umim3iy4op emncil(f rra( p;o4apeo ociat a2ea(msnt0 exoxo3io1oaDraieo t) euoim3nydlpte fctl(f 2tmxro;t4oet ioctasfa eln pnt)tlenxo tytopDr ivo s0 2toxr3io4opt liei ()aDra(mono1opeo feiyt s rln snu4 rtrir3oytlpteai ils  2trirpiudaptn ivtatfaDrmx pot0apxn oeildfsDrl(mp t4aleoif3tatfaDranes;t0trurxo3iodlm emfei s) Dtm(ront4oee ioeiadlm emn s t4tetnio3oatfaDelivolt0 euoxo3ou4ol nlietltf ruau o;o4oetnifeiysfs2raums (0 ltrxf3to1oaDrai i;t setr(mpiudam  lfvtas) rrm(rp;t1oexnmfeils sDeln pnt0 renirctodlpD  i o;s) 2xmir nodamt lnetlsf rum(  ;t4texoioctad s2rauvpn()arenxrcio1fm r ieils trxmxopio4ape livs (  rtmxr ;o4alxoiociytfsDuanvp;u) renxf todomte ivi;t trtrimpoo1optelicilsfsDurxr ;t0opx mo3iadla2um(ms t)tlxnif totomDe ivolt  ruoxo iydllen fctls) 2rm(mpnu1tex iiciyd a2rm( o;(4texoxf oa1omD  uesls)sruoxr ou4ll   nct tfaDrax p;o0tptnmocildlsDrl(vsnt) exnmrcoatlaDr nei;( trurxopnodaltemnvsa(fs2rrx onu1tlenmiciytfs um(vo (4trerxo oodfp eaivi;()s2tmxopnodlmt mfvi t)sDra(mp;t4tpx mf3tadfs emu s;()texomr3ta1fa  li sl() 2urxm3io4ap emfcta(f 2ur(mpot1opeo o3tlt sDeauvsn() leoifciodfpDeli o;s)s2xmim3nudlm nmicsas aDrr( o;o4aeeomictysls2raumo t) etnxf3iodfate nvs t) rtriopnodamte feias)aDur(moou4apeoii3iadla rmumo t4tetriocto1fptr ivs s)s2xrio io4om  mies sf 2taumoou0tltn feildfmDel(vsn(0altrmo oy1lm eaneol(0 rtoim3iy1ol nlivi t) Dtr(mpoo1olenmociatlmDeluvp t)aeeoir iatoaDraiei;s)sruo(opou4ap n nvs s)s2taxm ou4aexnmoctadlmDrln s;(0tetrmocta1lmD livo ()seumxmpiydomtn fcia(  2taxmp;t1optomfeiltfa2umnvs;t0aleomfcto1lp   n o;t0s2tr(m iudalte fcsasfsrtax pnu0oeenmoetaslm2umn p;u4 etnio iytfm ranvi;t)sexmirpiu1lpen feiltfsrumxr ou0olenmociydls2rlnmp;(0trenxf3oydlpD  uvo;() rxmxo ou4lleemici s artaxrpnt4tlto fciadfa2uanmo;u) rtoxrcia1opte ivils0texo(rpno1al  livtls  Duaxmonu4opeo ieilslm2rmnvsnu0alxnmo iatlmDrai i;( s2xrxopny1olt  net t) rumxr oo0apx iociysls2el( o;() reoir3oo1faD  n s;s0 rxr(r3nudamtnlici t srtm(r ;o1olxnmictasla ranmsn()altnmocoodom   u i;(  2uo(m3oo1om   ivslsf Drrxr no0olt  ieiat sDrmuvsnu4areomf oydfpt lieo ( teur(m io4lle mncsl( aDur(rpno1aet ii3iyslsDuanvp u0altoxfcio1omtrlu il()srumxo ny4omenlfct sfs2rmu p;o1tpen i3ilt s2ranmp u)trxrirciatomD lieol()trur(opou4am nmivsls  2uaum no4tetoif3ilsfsDuauvo t4aexnxfcty1lmtelu il()s2xrxo ou1ale lfeiltfs2rmx oou1aetnio3iysls uanvo;t0 rtrmocoodlat lu i;t) rxriopiudameemivs sf rtmurpnt0aex ioetadlsDrmu s t4 lxoifciydlp e ues;s  2uo(m3oy4op nmfvtatfaDrru pnt0apeo ietadlm rlnmo;u) eenir3oy1om eanvs;(0trtrim iodlm e ivtlt  2rr( ono4tltoiietytfaDelu s;u4arxoirciydlm  aueolt)t2tmio nydlpe mnvta(f rtmurpoo4aptomociat s eau p;u4teeomocoytlm   nes (0tetmxopiu4apeelictasf 2rru pou1olx  oeiys mDeauvp;t)tetrmrctydlm elneo;t trumxo nu4ome lfetat  Drmx onu1tlx mfctydlm2em( o u4 reoxrciotlmtr nei;(0 eumxopio1llen fes t)srraxro;u4tet iietytls el( pnu4 rtoxf iy1fmDelnei ()t2urio3iudal e fcsas)sDumxmpnt4apx  fcils m2el( pnu4tlxoir tydfptrlnesls)t2tm(opoy4omtn nvtat  rtau  ou0oexn f3tadfaDrlu o t0texomfcoo1fm elneolt seur(mpiu4ol  livt ( s2uru pnt4aleoifetldls2eanvo t0aeenio todlptrluvo s)s2ur(o3oo1al emnvsa(f 2umu onu0apto f3ildls2umuvp u0artniocty1la elieo;( s2uo(mpno1llt lnvi (fsrururpnu4aleniictydfm2uln s;(0 rerxr tydomDelies;(  2urim3ny4optelfetls)arurx o;t4tpe mfeiaslm eaump;u0altnmrciodfm  li i s  rtr(mpiu4ome livt s) rur( pnu1opeoioeild a umuvp;t)trenmf3oodfptelu o t)srur(mpiodlptelnetlt)sDumumo;t4oexnmo3tlt m umumo;t4trerxo3oytopDraivi s0t2xoxrpnydope mfetls srum(ro;o0teenifeildlm2ran s t4alxrmfctydlmte uvi;t) euo(mpio1omtnlfvi (f rrrxroou0apt mictls s2ranms (0teermr3iadomDe nvi () rtrir3ou4open iesa( s2ra(r ;o1oex mf3iysla ranmo;t0 eeoif iotom  anes t0srtoim oy1llte fvsat  2taumo;o0aeenio3tld aDelnvp;u)tltomocta1opDe iei s  rxrxrpoydlm  lfcsa(  Dtau pno4openiociytls2ranvp t)aexnmo3tydfp rln il()srto(rpiy1omt  ncsltfsrur(r ;u4apt  f3ilsfa2el( pnu)texoirciatoptr n i;t)t2toim3iodapenlfcil( s2rm(mooo1tpxomo3iydlmDuan pnu0tleomo iatlmDe nvi (  rxrxm3ny4ap emfcsa()aDua(roou0tpx  iciytlsDemnmp t)artoxf oytla rau i ()setm(m oy1lmt mivtat srrrxmp;u0tltnmoetyd a2uln snt4artnmo oodfm e uei t0t2xrxm oodap  mncsl( s2ra(r ;u0aeen fctytla eln on()trxrmo3iodoptrln o ( trtr(o3nydapenlfeias a2rrxr ou1apxnmo3iasfmDem( o;t0artnxo3oatlateaieil(0 euoim3iodop  lfcil( srrr(moou1aee  fetlt sDeanvo;t)arxrir3oatoa e n slt s2xrio iu1ol n ivsls  rumxmont4altomoeiasfaDulums t4teenir oy1om e u i ()teuoir oo1al elictas)sDur(  ou4altnmfeiadla eln s () leoio3todop rlu i;(0seumimpou1lpeelnvtasf rtrumpnu0aee mociatfm umnmo u4 reoxfctydomDeaues s) rxmxo ou4lpe liviat aDtmx p;o1aptnii3iyd a2ean s u4 eenir3oydlpDran o t  2um(mpoo4olte nes tfsDuau p;t4tle  fctys m2rm(ms u0aexrmfciytfmtran o;t0 2xoiopoy4ape lfctlt)aDraur ot0tlen oeiytlaDulu pnu) rerxr iotoaDelu s;()srxoxopiy1lmtnmiesl( s2rrxmpnu4tpenmf3iasfm umumsnu0 ltnxocoytopte uvi;( s2uoio3nydopte fesl()s2taxr ;o4oetomoctltfs2rm( s t0 rtrxr3iydlp  auvo;t0sexmiopny1lmtnmfctas  rrruro;t0aeto oeiatlm emump u)tlxomf iatfmD  ivs ()tetrir3iydomen netltfaruru  oo4tlxo o3ilsfaDelnmp;u4 lxrmf iydlaDeauvsls0 2uoxr oudoptemfes s)arumurpnu4open fciadlm2rmums (4tetrmo3totfmt  ieo (0trxo(m3ny4apen fvt () 2umu poo1tpeo o3iyslaDrmnms;()tltoio3iodla rliesl( teur(rpnudalenmivslsf ruaxrono4altnmoeilsfa2rmu o (0tltnirciodfp raiei;t  2uo(o3no1lp n feil(fsrraurp;u1oltniociad a uanms;(0aeenmociotla rai ils)t2ur(m nu1oltnlneiasf rrrumooo1oltnio3iyt m eanvp;(4artoxf3ta1fa e neo;( srtmxopoodllte nct sfs2raumoou0apx  oetlslmDel( s;(0aetomf totfmDe neolt)s2xmxo3no4amte feia(f rua( pno0apenmicilt sDemuvp t4areomr iadoptrlivi;t  2umxm iy1lle  ieiatf rtau o;o1alxoifciyt a2uanmp;u4tleoxf3ty1lm e nvo;t0 rur(opoydoltemneilsfaDtaxmpno1tle mfctas s2emnvo;u0trenif3tatfmDrlnei t)t2xo(rpiy1am elfviat)aDraur nt1tetoioeiad m eau p;()tlxoif3oy1lmD auvsls0 2tm(r3oudol nmivias srra(rono1ape  f3tlt s rluvs (0tltnmo3iodfaDeaueslt0texmxr iydap  lnvsa( s2uaur nu1oexn oeias m eau p u) eenio oa1opDeaneo;s0 exmim3ou1olte nvtat s2um( o;o1olxn o3tas sDeaump t0artnio oydfm   ivol( t2tm(r oy1llen iesas a2rm(r nt4opxn feiydla rauvs;t4 eenmocoo1lmDelnvi;s trurxm iudalt liviat aDuauro;u1aetn o3ilsfa2uan p t4artoxf tadoaDe i o;t)setoxo nudomtnlnet t  rua( onu0oleomieildla2rm( o;u0 rxnxo iatlp e i i ()t2xr(mpoo1altnlnvslt s2rr(ro;o1oexn octys a2eln p;u0aexomo oy1omDelnes ()tetoir iu4omt lnctls)arra(r nt0olx ioetls m2rl(ms u4alxnmr ia1fatrlu s s  etm(r3oy1om emict tf rum(monu0texomoetlsfm2uluvp;t4tetrxociy1lmDe ivi () rtr(rpoodap emicsas aDtau o;t1aee moetlsla2rm( pnt4altnifcty1omt ai i;(0tetm(m3iodlp nmnetlt)aDrrxmooo0aetnmi3tadfsDulnmpnu0texnir3tydfaDrauvo () rxm(r nu1ole  fetls  Dra(rono4openioctyt a2umumpnu4arenifcto1laDeau s t  etm(o3oo4lpt  ivtas)a2ta(  nu4tptn feiyd aDem(von(4aetnmo3oo1om r n il( s2ur(r iydlmtn neias a2ta(mp;u4aeenmociaslmDrl(vonu0altnxf todopt  ieils0tetoir oydll nmies s)aDtru onu4aeeo fetadfsDem( snt4 exrxfciotfa eluvsl()tetoimpiodame mfeil() 2tmur ;t4tpenioeild m umuvs u0altomr iadfa  auvs t srtmxm no1apt lnvi tf Dtauro;t4tlxo fetldfmDeln ont) exrmo3tadoa e u ols trtmxmpny4omte ivt (  2rmx ooo4olxnmfcild s ranvo u)tlxoxo ta1fatrlieols0 eumiopiydome mnvsasf rtax  no1opxoif3tltfa2elu p t0artomr3iydom e ueo;s)tetrxmpnudomt  ncias aDra( ooo1teeoifcilsla rauvo (4alxrifciodlaD au s;() exoimpny1lp  lnet (f rurxrp;o4opxnioctaslsDelu p u) ltniocto1laDe ueo;(0 etoxmpiydop emfeilt a2trx ono1tex mf3iytlsDra(mo (0aeerxr3iydfmtrlneils
\ No newline at end of file
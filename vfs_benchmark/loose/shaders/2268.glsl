@@ -0,0 +1 @@
+ieols  eurxm oudam e neiasf rumx o;u0texo i3iadfmDea(ms;t) rtnmrcoa1oa  lnes;t teum(m3oudol   nvtas)a2rmxroou0apxomo3tldfa uauvsn(0tleomocta1fmt aueo s0 2tr(r nudoptelfet s) rtmu ont1tpt  i3iys m2rmn s u0alxoif3ty1lp rau slt0t2toxopny4lp nmneias)aDtm(  ;u4aleoifetysfs2uanmp;() exnmf to1om r iei s) 2xmiopiy4lpeelfviasfaDrax o;u4olenmo3tysfs ulnvo;()tlxnmoctytopDeliei () rur(o3ou4opeelncsa(f Durx ont4tpeomoctyslm emnmsnu0aeeoif oo1fpDrlivi (  exoimpiy4al e nvi t  Draxro;o1ope mf3tlt a emu pn()altoifctodlat  uvi t0srxmir oy1ol e iei tf Dtrxr ;u0opeo ieiytfa2eanmonu)trxoxf3tadoaDranvslt)seum(r io4lmtnmiesl( aDuaxrp;o4oee ioctyt a ua(vp u) rtomfcoytlpt  nvo;t  exmim3nodolt lnvs t  2trumont4altnmoeiaslm rmnmp t4alxoxrcoodomDr ivsls)t2toio3iy1am e netat)s2rmx ooo1aleomfetls a2uau p;(4 leomr3ootopDe uvilt)trxrim3oy1am  mfvia(  2trur no4oetnioetldlmDulnvs t4 lerirciatlmteaies s s2xoim oo4amtnliet ()srta(rpnu1tlt iietydlsDrauvs u4areomf3oa1optrauvo;t0tetrio3iudllen fcsa( a2tmumo;t0opx mfeiad m ra(ms u0trtnxrctydoptelivi s0 2umio oo1oltn ietasfa2truro;o0alx ioeiltls2umnvo (0alxoif iodlatrliei t)t2xoimpoy4lmtn ncsl(fa2ur(m ot0oetoio3tlt a2rlu s (4alerxr3oodlat luvi t) exrir nudlmte nvsa()sDtmx pnt0opto fctadfs um(vp;t4tlermr oo1fatr uvi;s)texoxmpio1oltn fcil( a2tr(m ot1tptn iciatfa2elums t0alermr ootfa elnes t0s2uoim iodom nmfcia()srtm(rooo0oltomictydfa2ul(vo t)artoif3oatoatelu i s0 eumio3oo1lp n ivsls)s2ra(mo;t0aeeoiiciydfs eln p u)tlxrxr3io1latelu i ( srxmir oo4ll n feta() Dtrur ;t4altoiieilt mDelnvp u)tleoir3oadfat  iei ( s2umxm3io4open icilsf Drm( pou1oexnio3tyt mDemnvp t0 rtomocio1lp eaiei;t0texoxr iudlmtnlivi t) rta(mp;t1tpx mfeild sDumnvo;u0 etoir3to1faDr nvo;t)teur(mpiydlp nlnes s  rtmurpou4tpto ociltfm rm( snt) exrio todfateau ilt0 exr(r oodomtnlfvsat)aDur(mo;t4tle  fctydla2ulumsn(4trxrir iodlatr ieolt  etmim3oudopen feia(f rtaxrpnt1aexo o3iadfa rluvonu0tlerir3oatfat lu sl() 2urxo ou4optn fvsls  2urumpot4tpx mo3ildlaDem( p;t0 exrif ia1opD  ies;t)s2tr(rpio1lp n feilt)a2tm(roou4aleoiiciaslsDea(vs;()trxrircoodlatr u ols  rumirpny1lptemict s  rum(r ;u1tpeoif3tas m rmn snt4trxnxrcoadfaDrlnvil()teuoiopiu4ole mfcilt) Dtmx p;u0tltnmiciat s ua(vp;u4 rtoio tytop   ueols)s2tmxr oydole mies tf 2umum ;o4aee mfeiasfs2uan p t4 ltnio3totopDranvil()s2xm(r nodale  ictlt)arurumoot0tlx mi3ils mDum( onu4teerxrcoa1la r nvs;s0 2umxm3iydop  lnet tf rrmxm ot4apt mi3iatfmDum(vo t0 lenxo oy1oaDranes s) rum(r3nodop  lnciltf Dumurono4tpe mf3iydfaDra(vsnt0arenxo3tadfaDe ivsls sexm(o no1al   nvilt) Dtr(r nt0tet mfetlt m rl( p;u0 lxomr3iodlp rauvi s0 2uoimpoy1altnmncs s)s2umur ;o0aee iiciasfa2rmnvpnt)aeerxf3iatfa r n i;s0 2um(r3nu4am nmneslsfs2trxrpoo1oltn fetltfm2ea( pnt4alxoif oydlmDe iei s) 2tmxo oudapte fetlsf Dumxr nu0apxo f3tas a2rlumsnt0tltrifciadopt auvs;()srxo(r3iu1lp e nei ()a2taumont4apx  f3iysfm rln o;u0 etoxoctadlmDr uvo;s t2uoxrpoy4lmeemfvt sf rurx pno0olxn o3iyd aDra( p;u)teenifcoadom e n ils  exoir3oo1op   fetatfsrrm(ro;t1alxoifetytfm ranmpnu)aeerxo iatfmtrlnes s0 rtr(opou1apeelfetasf 2tmx pot0texo i3ias s2elu s;t4aexoio totlmt aueo;(0 2um(r3io4opt lici t)srurumpou0alenii3ild a rl( s;t)trxoif oytlp eli il(  rtoio no1omeemfviatf 2ur(m ;o4oetnif3ils aDrl(mpnt0tlenmr3ootfpDeaieo;(0setoirpiy4ol e nes ()aDta( onu1tpx  iciydfmDrauvsnu0trxomociy1laDraivi s setr(r3ny4lmeelies s s2tmxm nt4alt iocildla2emump;t)trxnio3tytfa elnvsls trxmir nudol nmicta(fsrur(mo;t1tpxomi3iysla rln p u0texrmr oadlmD luvi () rur(r iy4alt lnvtat a2rr(  ;t1ale  feiasfsDul(mp (4artomoctytopt lu i;t  rtrxopiodlp n neta()artaxr ;u4tpt  oeils m2ra(ms (0tltomf to1lmD ai il()trxoimpiu1op emnet ( a2truroou0texnmictadfs um(mp t0trxnif3tytfmDe ieilt0 etmxrpoydoleemici t  rtr( pnt0tlenmictyslmDra( s u4 ltrxocto1fmD liei;s srtrxr nodape lncsas) Dtr(rpnu1texn ieildfs2elu ont0 lxrxf iotfpD aivslt0 euoxrpny4opt lneiasfarrmxmpno1opeo i3iltlmDuanvs;(0tetnxr3ta1fp e ivol(0 2umxo no4lpeemncsasfsrrrxrp;o4oexn f3tatfm eluvp;t0texnir iatoa   uesl(0t2toxm oy4apenmieils  ruaxmoou0aee  f3ilsfa2ran p u0 exniocoadoatr u o t  exoirpny4amt livi sf ruauroot4tex  feiatls2ra(ms (0 leoir oydoaD li sl( sexoxmpno4al e fesl() rrauronu0ope  ociasfs2ea( pnt)tlermr oodfmt  u i;( t2toxrpio4al elneiasf 2uaurpnu0tpeo ietyd a rl(ms u) ltnio3oatopDraivi t  ruoxrpiu1lltnlici tf Dtmx ont1aee  iciysls uln ont) leoxf tatom ranvs () 2umio3oo4am nmncsl(fartmu oou4alt ii3ild a em(vsnt0arxoio oy1lmt ai slt0teurxm iodalte ivslsfa2rrum oo4aeenioeias m rlnvpn(0 lxoxfciatomteluvi t0teumir3oo4aptemfet tf 2uax o;t1optnio3tys mDra( pn(0alxrifcoo1lmDelnes s  rurxopoo4optelnvia()sDua(rpno4tptnifeiyd a2raumsn()tlxrxrcia1lmDraiesls) eur(r oo1lpe  ncsa( arra( o;o0alt ifciysla2umuvs;t) eeoxo3iytomDe nvo;(0 eumim3nu1lpeelivt t aDumxroot1tlxoii3iat sDea(vs t0altoxrcta1fmtean s t) rumxopiu1ll  mfet s)aDtaumo;u4opxoiicilt sDumnmpnu0aeenir totfp   nei;t0 2umxr3ou1omtn ncsltf 2umx ont1aetnioeild s umuvonu4teenmo3iatom   ueo s tetrxrpnodam e fci (fsDtmx  ou1apt iociadlm uanvsn(0 etoio3tadfp e nvo;( seum(mpny1lpenlfvi tfsDrmu ooo1aptomfetyd a2ul(mo;u)teeniocoydoaD lnvilt  rur(o3nu4omtelncsas artr(ro;t0tpxomf3tltfs2raums t0teeoif to1lmte uvs s0 rtmxo oy4am nmncsat srtr(m ot1alx  ietyd m eaumo;u0treoxo3oytfp eaiei (0srur(m ny4lm  miei s)srtmxmonu0ape  icilslsDraumo;u4 lxrio3oa1fpD livo ( truo(o3oodap emfctatf 2rrxrooo0aeeo f3ildlm2uaums t0texrxo3to1fptelivils  2tr(rpoudll nmfet s  2um( ooo1aeenif3iydfaDemnms u) rtrmf3to1fpt livs;(0s2toxr ou1lp   ietls a2rrur ;u0alt iiciytlm ea(mo t4alxnmo iadlaDeaueo ( sexmxr3no4lle  feia()aruru pnt0opx miciatlmDua( o;() ltoxrcio1faDelueolt) 2xo(opoy4lpenlfvslt a2tr(m nt4opt mociadfmDem( pnu0tltnifciatoatrlueils)srur(r nu4lltnmfvtlt)srtmxm ou0olx mi3tytfa ranms (0 lxrmf3todopt  nvo;s0trtrimpoo1al n iei s  2truro;o1oleomfetydfa2uan p (0alxrxr iytomD  ivi ()srxoxr3oy1aptemnes sfsrtrx  ;u0alxoioeildfm2ea(vs u4aexoxr ia1opDe n s;t0texm(r oodlm n ietasfs2umx p;t4tetnii3tydlm elnvs u) lerio3tytfp  anvils0setr(r3oydlpen nei t)sDraurono1alt mo3iat s2ea( s t0tltoif ta1oa   ivi (0sexoio3nydope  fvt (  Duaumpnu4tptoiieiltls2ulu snt0tetnif3oodlm e nvslt)t2xmxo3nu4omtnmfcilsfa2rru  ;o0tpxnmo3iydlsDranvo;u) renxocoodla ean i s  euo(m3oy1alen fctas srtmxmo;u1oex  feildfs2rlnms t0altoxo3oadoatraivo (  eto(opoy1ap  lietatfsruru p;u1aeenmfeiytfs um(vpnt0 rtoxfcty1lmte n o s)srxoxm oodll elfes ()aDtm( oot4apeoioctldlmDuau snt0aetnmfcto1oaDr u i;s0t2xoxr nodlmt  fvilt)srtaumooo4opt mfctlt m2rm(mp (4trxnxr oo1fpDrli olt) 2xoxrpou4omte ivslt)aDuaump;o4opx ifeiys m rluvpnu4trtrif iadlp  aieil(0truo(mpiydll elietat srrrurp;o4oetnmo3iyt mDrl(mp;t4 ltrif3iy1fpt au i ()s2umimpoudomte nvta(faDumxr ;t1aee ifeiadfs2ean o t0artrxo3tatfp  luvo s)seumio3ou4oltnlfcias) Drmxm ou0teenmfetyslaDra(vs;(0texnxfcio1op ran i ()s2urim3iu4am emnetlt arrm(ronu1alen f3iyslm rm( snu4trtrxo iodop  lu sls)t2trxr3oo1al   fcia( s2ta(mo;t4aetnmi3iadls2emu p;u0areriociodfptr i ils setmirpny1lm n ncsa()s2umxro;o0opxomfetasla rln p;u4texnmr tytfateln s;s0sexrio iy4olte ietls)s2ua(ronu0opxn feiad a umu s;u0 exoxf3ta1oaDe i s;()t2tr(m iudolt livsat) rrmu p;u1oexoiocildfm eanmpnu)trxoio3tatlatranvo t s2trir ny4omeelnct s)sDur( p;o1oexniietltfa2ea(vsnt0tltomfcta1lpD  ues;s) etm(opnodopt  nvt t aDtrurpno1aex  o3ias aDelu sn(0arxnmfcoo1fm  liei ()seum(o iy4ole liciatf rururoot1opto oeildfa2ua( sn(4aeeoxo3oo1fpDr ivo (  etm(o3iydam  mfeias) Dua(mpoo4tle  i3ilslm raumpnu4tleoxo oydfmD aueo ()trurxo iu1ame mncs s) 2rax p;u0teenio3iyd sDea(vpnt4tlxnif iatoat li s;s sexmxo3ny1apt  fcslt) rtaum nu1ale  ietysfa2rluvo;u)teerxrciytlmt  u i;s0s2tmiopoo1alee icil(fa2ra( onu4tlxnmi3iatlaDuan o ()tltoir iodoa r ivols  rxm(mpnodap n fctasf Duaxrono1oexoifeiysfm umuvont) eenxf oy1fat aueo;(0teuoio oo4lpt  iciat)srtr(m ot4alen fctlsls2elu o () rxnmr3tadlaDeau s;t texmiopnodlle  fcia(faDrrxrp;u4aexoii3ildfm2rln p;(4tlenmocia1latrluvi;t0t2ur(m3io4lm elfei t  rra(mpno4tle  fcils mDel(mo t)alxnif3iatoaDr ivs (  2toxo io1ape lnvtlt)a2rmxrpnt4tleo o3ilslsDel( s;t)aetrxrctotfpD auvs;( teuoirpnydoltnmiesas) rumu o;o4altoif3tls sDumu p;t0teeoxf3totoa rlieolt0 2tm(m ny1lp  mfeia()s2trxr ot1tpe mf3iys a eanmsn(0altrmfcio1lp   neol()setm(r ny1lp  licsltfartr(ro;o0alx moeiydlm em(vs t)aleoir3iadfpDeaivs s0t2xr(m iu4ole  iesa(fsruaxrp;t4tptnifetysfa2ulumo t4tetrxocoy1faDeluvsl(0t2xm(r io4om nlnvilt)s2uru pno1tpeomieiltfm ea(mo;t0arerif3oadoptran i;( texrimpio1ome  fct (f Dtaxrpot4tlx mi3iat s um( on() reoir3ia1lpD  ivi (  2uoxr3no4lp emiciat)s2ra(mpot0oetniocildlaDrmuvo;t) ltoifctydfa eluvs;t0tetm(m ny4ameelfvt (fartrx pno4tlxn feiadfaDrmnmonu0trtrxocia1lptr iei;(0t2uoxm3ou1lmt mfct ()a2ur(mpnu0aex mi3iatla ea(vp t4artnifctydfmD luei s) 2trir ny1lm  lnvsatfa2uaur ;o1tetnmictyd aDrmnmo u4 rtomf todfpt au i s)s2trir3iodomt  nvtl()sDum( ont4olt  ociys sDea( snu0 rxnxf iadopDraivs;()teuoxm ou4op emfviat srtmxm ;o0aexn o3iltla rl(ms;t0 reomoctatlp  aiei;s)trtr(opnodamte fciatfartrx  ;t0tle ifctld s2el( p u)tltrxfciy1lm  livs;s0seurxopiydale mneiasf 2urum no4alenmicild s2eaump;(0teenir iydfpDraueslt  2uoxm oy4lmeelicsl() ruaum ;t0optomi3tys m2emuvo;(0tetrmr iytomteauvs ( tetmxo3iudame mnvtls)srtmu  ou4tlenmfciyd a rmump;t4 eerxr ta1fatrli o;(0tetm(m3iudlm  livs sfa2uaxrpnt0opt  o3ildfs um(mpnt0teenxf3oy1om ranvil(  exo(m oodaptnmfcta( artr( p;u0tpenmoctydla elnvs;u) lxomocoo1omDe ueil(0 2toiopno4lmtemnetat) Dtr(m ;t0tlt  ietlt m ua( o;u0 rtoir to1opteanei s) 2uoiopio1ap  mfet tfarururoot4oet iociyt s2elnmp (0aexnmr3oy1lp   i il(0s2uoimpoy4lp nmivias)srrr( o;o4apxnif3tas sDea(vo (0 rtoxfcoodop eau s s0s2xr(r ny4omen ietlt aDtruront0aex mfeiyt a2ulnmp ()arerxo tatlmD anvs s0sruo(mpoydal  lfcsl( arraxrooo1opto f3iad mDrmumo;t0tlxrxrctatoaDr u s;t  2tmim iydamtemfcsasf rtr(  oo4tpt ioctld sDeauvp;t4 eenmfcto1fp eauvo;s  2um(mpno1ll nmnesatfs2ua( o;t0oleo ieilsls ea(mp u0aexnxr3totla  au o s  exoio oy1ol  lfci s artrum ;u1tetn fciydfs2ul(vo;t0 rtnxr todlmDe ivo;( tetoio3iydll elici (fa2taxmoou1apx iiciatfm eluvs (4trtomfciodlpt  i o t  rtoio3io1lmte iviat sDrmum ou1apeoioeild aDelnmpn(4tleoio3iotomDeau i ( setrxm iu1llenmfvia(f rtau  oo1oexnifeiadfmDuln o;()texoir iodop rlnei (0sexoxo3oodll nlnvsa( sDrru o;u0opeo iciltfs2rl( s t0arenmfcia1lateluei;(0 etoxm ny4lm  liesl(  Duaxro;u1texnmietytfa ul(ms ()treoxf3todfat luvs;(0texr(o oy4lp n fvtls srua( ooo4open f3ildlmDrlu p;u4trxomf oa1fp e u o ( teurimpoo1oltemfei s  rta( poo4olx  f3tasfaDrln snt0 rtnmr oa1fmDelues s)setrimpou1lpt mieias arra(moot4tpeo fciysfsDuan o t4trxnmo3iydfp eli s ( trtm(r io1openmnetat  Drmu ooo0tpxomfcildlmDem( onu4teermociatomDelu slt)trur(opiy1apenlfcsat  rtmxmpou4tex ifeilsls2ua( p;u0arerio iotfpDrluei;s0teumirpoo4al nmici (fsDtmx pnu4alen iciat s2ul( o;()tlerxr oodoat  n ils0 rxmio3nudame mnctlt)artm( p;t1tltn octysla2el( s;u4 exomf ootfpDeauei () 2urim3nudlle mfet s)sDrrxmooo0tee iieiyt m em(mo;t4aexnmo iodla elueils0srtmxo iodop nmietat srtrx oou0oee if3iat s rmn p;t0aleriocio1laD aivil(  rxo(r ou1altn ietasfartr(r nt1aexomieias s elumo;t)aexoiocoy1faDr nes t trto(r ou1ap  mics sfsDrmur ou4altn ictys a ea( p u4arxnir totfpte n i s) rurim ou4altnlfvtls  Draxr nt1oetomocildlaDea( s;t4areoif iodfp eau o;t)seuoir ou1lptnliesl()s2um( p;o1texniicilt m2eaumo;u) rerxo3oydomtr ues;()teur(r iu1ole  net s) 2ua( p;u0aleo icias aDrau pnt4trtrmo ty1fp r ivol( trxm(rpno4am  lfvs sfa2uaxmont1aetniicild mDumnvo u) lenxfciadlmDr u i (  ruoirpiu4lpt lieilt a2rmxmo;u1olxo ictytlsDumnms u)alenxociy1fmt anvo () 2toir iodlp n ivslt)srrau o;t1oexnio3tytfs2rlu p t0aeerxo3oytfate u olt)s2xo(o3oodameemfvi tfartm(r nu1tlx  oetydfs rl( ont4 lxomo iytoaD lnvslt) rxrim3io4apt mici s  Draxr ;t4alxo octat s2umuvont0 rtnmo oytfmtrlieo;( teur(o3oodlmte ict ()s2tm(mp;u1apeoii3iltls elump;u0 rxnircta1fp e ueslt)texmiopoudam   ivil()srrmxmpno4aetn fciydls eau p;t0trxomo3iy1fa  luei;t)sexoiopny1ap nmneias)aruau  oo0teen fcildla rmnmo;() lenmr tatlmDeauei;( s2xrxm3io4am  mivsas)arrr(rp;t4ope  ictas m ul(vpnt) eeoxoctytfateai o (0 exo(m iydlmt lnetas aruax ooo0tetoiiciatls uan s u0 exomf3oatlpt auvs s s2xoim oy1lle  iciltfa2rm(mp;t4tpenif3ilslmDeanmont)alxnmocto1fmt  nvi ()setrirpoo4am  mics tfa2rmxmonu4opxnmoeiasfmDrl(mo;t)tltomo3totlateanvils)trxmxm3nu1ll  licsat)arurx ono4optomicias mDeanvo;()artoxocia1fpt aues s setm(rpou1llt lfct s  Drm(roou4aetniietatfsDumuvo;u0altrio3totfmD  n i (0srtrxr3ou1ameemivi (  2ururpou4tlx  fciaslaDrlumpnu0 rxrif oatoaD  nvils0t2toim3io4amt mncsat)srtr(ro;t1apxn feiad s elnmo;u4texnmf oadfmtrauvols0seum(o nu4apeemfesatfa2tr(rono4altoiieiasla2rmu o;u0texnioctotlp  aueil(  etrim3io1oltelieils  Dtaurpot4alx mfeild m2ul(vp u) rerxo ta1om  liei;s  rtoxm oo1lm nmncia( a2rrx pot1teen ociatfaDuluvonu)tlenmfciy1fpDr n ols s2trir3iy4ol   nei tfarrr(rpot4teeoiiciltfmDran ont0aetoio oa1lmDeliesls)trxoxr3nodlme  fesa( arur(  oo0tlx mieiys a rauvsnt0 exoif3oodomDrlnvi;s0trxmxm iy4apeemnvs (f Draxmoou0tpx  fctyd s eanmsnu)aetnmrctydomt liei;s trtmxo ou1omt miesl(fa2taxr oo4tee  ieiyslmDel(vsnu0 eermr3io1lp eai i (  etrim nudome  fvtat sDraxm ;t4oex mf3ild s2elnvo t4 rxnmo ia1laDeaivil(0 rxmir3iu4opeelfeia()a2ta(ro;t4altn i3tltls2eanvo t4alenxr3oytoptr iei;( teumxr no4lptelfvta(fsrraumo;u4oeenmicildfaDrmumpnu)altoxf oy1lm rluvo;() exoim no4optnmivs ( a2umuroou0aleomietytfm emnvp t0 renifcoy1oa e uvs;(  eum(m oodol nlfct s  rrrum no1oeto fciysla elnmp t) leoir oadfatr neo s  2tmxrpnu4lmeemies ()arua(mo;u1optoifeiadfsDrau onu4tleoxrctadoa ranvi;(  eum(opoo1ll n ieiltf rrmump;u1aexoioctldlsDrlumo;t)artomf3io1lmteauvi ( srumxopoydlptnmfcsas  2trxm ;o1oltomi3tysfa ulnvsnt4 etnmo3tydfpDelnvo;s0teto(o3ou4ome  fetlt)sDrm(m nu1tltnioeiysls rlnmo;t) ltoio3iotfptrauei (0 2tr(r3iy1om  lieil()s2tax poo1open octatfm ulu s u0texrif3tydomt lu o;t  2uoxr io1ame liviasfaDrmur nt1aptniictat mDua( onu4trtrxo tatfm r u s;s  2uoiopiu4optelietl( artm(mpnu4olenmieiltfm uau pnt4artnxrcoatlm eanvi ()trxrim oy1om   nes t) Durum ;u1teen i3iyt m2rl(vo u0aeermo3io1fm  aueil(  exr(opno4lmt mivi tfsrtrxrp;o1apeomfeiysfa2emumo ()aetomociadlpDrlivo;s t2toxr3iu1lpe mfvt ()sDra(r nt4tptn ietytfsDrmnvo;()alxomo3oo1fa  auvs;t)trxoio oodop n icsl(  ruaumonu4aeen i3tlt s2ea( s;() etnio io1lm  luvsl(0srur(mpiu1lmt  nvtas arua(mpnt1aptnifeiaslaDelu p;t0aeenio ta1fmt an ilt trtm(o3no1lmtelivsas)s2ra(m nu1optnmiciad sDrmn o t0 lxomr tytlate nvsl( trxr(opiudapt mnesltf ruaxmpot0aet mi3iatlm um( s;t4arerxf iatlmD luei;t trxmxr oudllenmiesl()a2rmu  ou0tpto fciad mDeau o u4teenmf3oydfa  livs () rtrxo3iu1olenmncsas sruru p;t4opt  ieiatls uanvo;u) rxomocoytfmteauei;(0trxr(r oydlmte ietas)a2umxr ou0oleo fetls mDrauvs (4trenmf3tadlp eaivi (0t2xoxr3no1ap emieta(fs2rmum nt0oeenmfciatfmDulu o;u)aleomr iydopDeaneols0texr(m iu1lme miei s) 2uaxm ;o0ape mociasla2umnvsn()tetomo3iytlp  lu i;s0t2xoxr3ny1lle  nvt ()a2uauro;t0alxo ietysfa uaump ()aeenmo3iodlpDeanvsl( truoxr3io1opt mies sfaDumur ;t0olt  fctlsfsDem(mo (4texrxo3ia1fm r u sls seur(opiy1op n fct s sDtmxrp;o4ape mociytfm ulums;t0tetnir3iadfm  an i;(0 2triopio1omeemncslt)aDrm(r ot0tee moeilsfaDua( p t)trxnmociadomtranvo;t s2uo(rpnodlme lnci s) Dua( pno1optoifciatlm2rau o;t)trxrxr3oadoa  an i t)srtmxmpiodolt mfciatf Dtax pou0tlxnio3tyd a eln p t0 lxnxf3ia1lmD auvols0s2trir3nu4omenlneiltfa2truro;u1altniociatlsDrl(vsnt)teeoio3iytopD lies s)trtmio oo4om  livsl(fsDrru ont4apenmoetyd s rmnvs;u4aeenmf3ty1latrliei s0tetoio no1ol nmnvs (fsrtru pot0openmfeiadla2rm( pnt0aetrir3tydlmDrliesls0setm(o3iu1lpee fet t)s2tm( pou0oeeo o3iasls2rmnvo (4 lerifcoadfa  aueo () 2um(o3oydlpt  fvsa()artr( onu1tlt ioetad a2elnms;t)aeeoio3iodfa r uvol(0 exo(o oudoltnlfci sfaDrmx onu1optnmoctld a2ea( s u)aetoif io1lp rlues;s trtoim nudalt lies () 2taxmont0oeen o3iatfaDemnmo u)trxnio totfmD lnvo;t)sexr(r3no4amt  icils  2raumpnt1altnmf3iasfm raump ()altnir ty1lmDran sls sruoxr3oudapt  feils)a2ua( ooo4oee iiciltfa2elumsnt0aeeoxr3ia1fa ean slt sexmim3nu1apeelnvilt)s2rau p;t0tex  fctad aDrlnmp u0trerirciydfm rliei;t)s2urir oodapt  ivtlt) rurx ont1aexnmi3iad m2rl(vpn()tleomociy1lpD an i;s)teurirpiudam   neil()a2ta(m oo1opxnioctys mDuanmo (0 reoiociatfa elu i t)tetr(o3iudllte fcslsfarrmxr ;t1aet  oeias m elump;()aeermociy1opt auesl()s2tr(opnodlmtelivta(  rrmu  oo0aeeo o3tadls2ulu o u0aexrxo ia1op e i o t0tetrirpiu1ol  lfvsls) 2uaur ;o0olt  ictasfaDumnmsnu0arxoirciodopD an s;s0 exm(o3iu4al nmfes t) rrrxm nt0tpto f3iaslaDel( s u)treoio oatlmD li s t s2xm(r3no4lleelivi t) 2tmx  nu1texoifcilsfm ulu onu4trenifctatla  aiesls)t2uo(o ou1alee ncsls)s2raxr ou0opx io3tad s rl(ms (4tlxrmo io1fp rlnvi (0srtoxo iodolte nvta( sDra(r ;u1apxn o3tltlsDum( pnu4tltnmrcoo1lmt  ueo;s0texmxm3no1om n nciltfs2rrurpot0tpxo feild a rm(vpn(0altnir tadfp   u o;s0t2xrxo3nydlpe lietlsfaDtmxrpno4oexo ociasla2rl(ms t0treoir ia1la ran i;s0trtoim ny4lp n nvtltfaDtmx pno0aptnmfciatfaDuanmp u)tlxoxf iadlaDran il() rtmxmpiodam e fes ()sDtru poo4aex ioeiys mDea(ms t0 lxnio3iodlpDeaivsl( trumio3oydoleemnes t)a2ta(r ot0tlenmi3tydfs2ul( s;(4alxrxr tatfaDe n o ( srxrxo nodaltelfci t sDtm(  ou0ape  i3tlsfm emu o;t)arxnmr io1om  au i;(0srxr(o3io4alt  ivsat  2rau poo4optoiietytls2em(vo u)tetnif tadfpt livol()srtmiopio4optemfvia()s2rr(mp;t1oeeomictlslsDuanmpnt4tetomociydoa ran o;( trumxopiu4lpe  nci (  2rm(ro;o4optn octltlaDulu snt4aetoif tydfa  aivols  2umir3ou4lle mfct s  Dumxrp;u1aleo fetldfsDra( o t4treoxr todlmtelueo s0 2xoxrpoo1am emnviltfs2rrurpno1tleomi3iasla2emnmsn(4trtnmfcty1laD  uvs;s)t2tr(o3nodllte fvtl()arrr(r no0tet micildfmDuauvo u)aeeomfcia1op r nvi t0s2xmxo3iy1olenlnvsas)srua(m no0ope mieiys aDranmo;u0 exrxo oo1fpD  n il( s2xrxo oy1ap nlfcsa()aDrrur no1teenmf3iasfm2uau p;(4tetnir3iytlm  lueo;(0srxmim no1ol nmfvs sfaDrrump;u4oex ioctad s umuvo;t)trxnxrciadoa   ues;()srxr(rpoodlleemneias)sDrmxm nu4apt  ieils a2umums t4aeenxrciydlmt li o ( teum(o3nydap emici sfaDtax oou1teto ieiltfm rln o;t4 leomo oa1lptrlnvo (0trum(m iy1ape  icia(f rurxr oo1olx  iciad aDul(mon(0tleoxf3oytomt luvo;s t2umir3oudalee feslt a2urxmpou0aet  oeild sDel(msnu4tetnmfcoydlptr u s s)s2umxr io1lmeemnvtls) 2um(mp;u4aetoiieiysls uluvs (0alermrciotlmtr nvo;t) 2um(rpio1llenmncs (fsrtm(m nt0oexo fcias aDulu o (4 rxrir3totoa elueil(  rum(o3ny4om  lieiasfsrraxm nu1tpx  i3iad aDelu pnt4arxnxo ootlm rlivs;t)s2um(o ou1olen nciat)sDtaxr ;u0alxoif3tls s2uaump ()tleniocoatlat  nvi ()tetrxrpnodalenlfciat  Dtmumoou1olx ifeiydlm elnmsn(4alxnmo ta1fmt  ueilt)seuoim no4lptnlieias)s2ra(rooo1oexo i3ils aDrl( p;(4trxrxfciotoatrlnei t0t2tm(m ou1alee ics ( a2tr( o;u0tpen f3tas aDean o t0tlxnmf3ootfa rluvi;t texrio3io4alte neslsf 2ur(mo;u4tex  ociatfsDua(mp;t)texrmr iotopt lneils0 etmxopny1lp emfci tfarurx p;t1tpeomfctytlmDul(mpn(0tlxoxociotomtrlueo;t0t2urio ou1ape lfetasfaruauro;u1oleomicilt m ranmp t4 rtoir3ta1fmDeauvil( trurxr iy1omtemnvsl()s2ta(mo;t1aeto ieiys m el(vo;()tlenmf3io1la eln ilt)t2uoio3iudomen nci sfsDrr( poo4tpt ii3iysls uln s (0trermf oytlpD an o ()trto(mpnu4lpeelivi t) Dumxm ;o4tlx ii3tltfa2eauvs;u)aexrmfciodoaD aieols0 rxmir nydamen nvsat  2tmxrpot4apen i3tld a ulums;u4artnif3tadomD auei;s0texmxo io1am nmictl()s2ururonu1aet  feiytfm2rmums;u4arenmo3totlpt livs;(0 exrxrpoudope mfetat  rtmxmpoo0aee  oeiatls eanmo (4aexnircoo1faDe uvs t s2urir3iy1ole mnes t srur(  ou4opt  i3tls aDul(vs t)tltoirciytomDeaneil() eum(o no4lp   fvtls) Draxroou4opx mietyslm emu pn(4aleoio3iy1lmteln o t0 rtr(m3oy1oltnlieiat) 2ua(rpoo4ape ifeiatfa ul(vs t)trermo ootfp r ueo (0srxoimpiodlpt lfesls)a2tm(mo;u4tlxo i3iytfm2em(mo;(4trxrmr iodlat anvo s) rtmimpnydopt miviat a2rrxrp;t1aeeniiciytls2rl(vp;t0 etrmf tatoptraivi;t)seto(rpnudomenmnvs sf Duru pou1olenmfciytla rluvon(4tlxrmfciydfmteli sl(  rxmir ny1llee fvsas) rtrum ;o1optnmiciaslm2ua(mo u4tetomr3iydlmD lieolt seto(o ou1olt mivi (fa2ra(mont1aeto fctyt aDeauvo u4alxrxo oadlp  luvo;t t2xm(o oo1apt micias aDur(  ;t0apxo ietysls2rmu o u0aexoir tydoaDrau i s)trxoir iudoleelnvtat sDraum ot4oexoif3iytlaDulu o (0teermrcta1op eli ol()t2xmxmpnodameemfesls  rtr(  nu0oeto i3ils a2elnms t4arenio3io1lmDeanvo;s  exm(m ny4lm  lici (fsrrau p;t0alt mfctys mDrauvs;u) ltrxfcoo1fpD ln s;() rxo(m3nudll nmfeiatfaDrmx  ;t1aexoio3tasls2uan s;() rxrmo3todfaDe uei s)t2trxrpoydomtelfci s)artrxm oo4olx mfctyt a ranmp u4 etrioctadlpDrai o;s) exoxo3oudolee fvs tfsrtm(m nu4ole mf3ils mDel(vs u0texnif3iy1fpt ai o;t)t2trimpoy1llte ncsl(fa2tmuroou0oetnmoeildla2uau pn()tlxomo iydlaDrlnesl(0trtmim3io4lp elivsat)a2rmu p;o4alx  oeiydla2em( p t4artnmf3oydlmtr uvo t)seuoir nu1ll  lictl(  2ua(rpno4tex if3iad aDrluvo u4 exoxoctydfaDrln ilt truoxrpnudlptelivs () 2uaump;o1opt  ociasfs2ea( s (4 lxrmo oa1la  aues s0 rum(o nu1am  lneilt s2uax  ;u0ale  iciatlaDeln snu4 rxrio3ia1fa  luei t srumxo oo1alt  nctas)aDum(mpnu4apenifeiytfmDranvp (0arxrmocta1op elnvs () exr(r3iydllenmfcia( srum(mo;t4oleoio3iat aDrmu s;u4tltoio oytfmDr ueol(  2tmxopoy1apenlnct ()sDua(ront1tlxoii3tys mDua(vp;t4 rxrio tytlm   n ol(0t2tr(m iodomte fcs ()a2tr(  oo1ole ifciat aDrluvonu0trtoif3tytfaDrlueols srumir3iodop elfesa(fs2uax o;t4tlx mfeiyt s2rmnvsnt)artrxr3io1fmteai ilt)t2urim3no1lmtn nviltfsDuau ono4teenii3ilsla2rau o t0arxrmfcoo1la  aues ()s2xmxo no4omee nvtat s2tm(mpot4opt mfetys s2emu p;(0alenxo oatfa eaieo;t0t2ur(mpiu1om elfvt s  Drmu pou4apxnmi3tatfmDranvo (4trtomo ootop rlueilt)t2trxrpiu1lle  ncil( a2um( ooo4tex  octat s2ul(vsnt)tetoir iytfmDeaivo;t teuo(opny4alenmfesatf Dumumonu1tptoifeiytfa emnvo (0aetnirciatom eanvo ()trurio oo1ap   nctas  2uru pot1openmfctas sDeaumo;t0 etnif3iotopDr ueils  rtr(o ny4ol  lieia() 2taumpno1oltoifciys m rlnvp;(4 rxoxrciotfmD  u i;(0 2tmim3io4lp  mnciat)artmu o;o4texomieilsls2ua(msnu4alxnxf iadla  aieo;s0sexr(o3ny1ll  lieslt a2taxmp;t4texnifeiad s rlu ont)trtnmr3ia1fa r nvs;t  2xo(r3oo4lmt mietlt srrm( p;t4tpto f3tldlaDelu o;(4 rtoxrctatoaDrai i () rxmxm ou1am  mfcsatf rra( o;u4tpxomfeiydfaDean s;(4teenio ia1oaDeaueilt0 rxrxrpoydop emnes (faDtmu poo4oltomieiytla2rlu p;u0tetoio3oodlpD  nvo t) eumxo iy4lpeelfeia( srtmx ont0tpeomocildfa2rauvp u4trxrirctotfm   ieo;(0 exm(r3no4optn fcsat)srrru ooo4aexnifetydfm ra(ms;(4aexnmr oydom rln i;t0 eurimpoo4ll emnciat  2taur ou0aeenmfcildls2rmumsn(0aexoirctotfatean s;s texrir3no4lmee ieiltfaDtaumo;u4oltnifeilsla2emn s ()aeeoir iodoa raues;s0trumxr iu1omt lncs sf Durxm nt1texn i3ias s rm( sn(4artrxrcta1lp   u il()sexo(rpio4lmtnmneils)s2uau ono4alxnmociyt m2eluvp u)tlxnif3iadfm eauvs s)t2xrir3io4al e nvilt)a2ra(mont1aetniietldlsDem( p u)texoxocio1fmte uvi;s t2umxm iudlmte fctlt)arrmx  ot4tptoii3tldfaDra( o t)artrmocio1fatrlnesl( s2xrir oydlpt mnvi sfarumx pot4aet iocias s ulumo (0 etoxocoatfmtranes;s0 rxr(o ny1lmenlnesatfsrum(  no4tlen fcils s2elnvs;u0aexomo3oadfpDelivilt) rtmxrpio1lpt lnvsl(faDrm(monu4aeeomociatls ua( p;t4tlenif oadfp  au sls seurio3nudal emncs t  rraxr ;o1oee ioeiltlm2rauvon(0 eenxr3todlpD anvi s  exo(r io4om  lnvt (fa2umu  ot0openmf3iydls ea(vs;(4 lxnir3iadopt anvo;()texmxrpnudolt mivs ()a2taxr ;u0texo ocils sDulnmpn(0arxnircoadfp  anei s0srxrio nu4op elivtat)s2tr(rono0opx  o3iys sDumn s (4tltnifciytfm eaivo;s texoimpoo4ope  net ()sDur(  nu0aleo iciydfmDulnmp;() reoxo iotfmtrlnvil()teumxmpno4omenlfet tfs2uaump;o0tpe iiciydfa2el(mo (0 ltomo3iatlmtelnvilt)t2um(mpnudllee nvsls  2uaur ;o0aptnmietlslm um(msnt0 rxrxr3oy1faDeaieol() euo(rpou1ap  lfcsasf 2rmuro;o4tlt mictltla emn o t0 etnmrcia1lmtran s;s0srxrir oo4apeelies () Dtrur nt4optn oetydfm2ulu pn(0 rtomr io1oaD  i slt)s2uo(o3io4op n nctasfa2umx poo0olxoii3iat s emumsnu)arxomo iydfp rlnes ( texmxr ny4optn nciat) Dra(rooo0aet  i3tydfs ea( p u4 rerifctotlatr nvi (  rtmxopiu1omtnliet sfsDtr(rp;t4altomiciytfaDea( o (4aexnir3tadfptr ueo;()trtrxm3oydlpe  ietlsf Dumumpot0ale  ocils m umu ont4teenmfcto1op rai ils)sexmxr3ny1lmt mfetas artru onu0tlto f3ild a2ran o t0texomf io1lm   u s ()srxmxo3nu4ap e iesas sruaur no4tlxn fciytfaDumumonu4 lxrio3oa1faDr neols0 2xmxo3nodomtelnesa()aDrrxmont1aptnmoeild aDean o;(0texomfctydfmtran s;t0 2tmir3nu1altelivtasfaDtrur nu4apxoioeiaslm uaumont4 eenmf ta1fpDrln s ( setmxmpou1lme  iesa(faDrru  ;t1tlxnmieias a2rlu s t0tltrif oa1fptraivils0tetm(r3oydaleelfes t) Dtmumpnt0tlxnmfctadfa uanmont)tltoirciy1oaDeliei t)teuo(o3oudam elfci sfsDuau  nu4olt mociydfm rm(mpnu) exrmf iydlpDrluvols0srxoimpoo1ll e fcsasf rrrxm no0alt iietlt sDraumo;u)aeenxo oytop elivs t  2xmio nudamt lnvils)srrrx pnu1apxnio3ild a2um(msnu)areoxf3tydlaDe ivi;s)trxrxr no1am  mfetls)s2tm( ooo0tetn oeiltfs2emu s u) etomfcta1omte uvs ( srxmxr3nudlle mies t)aDrmu ono1aetoifciatlm umumpn()altniociatfmteaieo;()srtmir3nydam emiesls)s2rmumonu0tpen iciyd mDuan p;u) lxnmfciotla e u ils0 2xoxopoydaleelfvsatf Dtrxrpnu4oee iiciatfm2rmnvs;() etnmf3tydla eai i;( sexrxo oodameemivt sf Duaump;o0aeeomieiysla ra( s t4artrmfcoytfpD  i i;s0srto(rpnydolt mivt ( aDuax ono0aeen ictas s uaums;u)trxrmocia1lpD  ivo t0setoiopoo4opee icilt)a2tru ont0oet  fcilsla2elnms;t0aexrmo3tytfmDranes;()texmxm iy1lpe  ivtl(fsDtau oou0olt miciyd a2ra( snt)aexnmrctodoa rai i t0srxmir no4am elivta(fartaurpnu0ole ioctatlaDra(vo u4 rerxo oydomte u sls0truoir3nydapt lnvsas)aDtmumono0olx iiciat s rmums t4tlxnio tadoaD ai ils0 rxr(o3iodamt lici (f 2taxmo;t4aptnmfeiasls2uau o t0alenmfcty1optrau ilt)t2xriopnu4op emnetasfsrumu oou4tpt mf3ilsfsDrl(vonu) lerifctotlm e u il( t2tmir3oy4alte ivtlt)aruaur oo4ape mo3tldlm rl(mp (4trxrxo ia1omt  ivi s trtoxm3nydlp emieias  Draumont4tlxnmi3iysfaDulu s;()tleoif iy1laDe nei;()sexoir3nu1oltemfcta(  2taxr ot1texoioeiyd sDrl(vo (4 ltrmr3tytom eau s;t  rum(m no4apenliesasfs2umumpot0ape mf3tlsfa2emumo;t)arxrxrcoadoaD livsl(0s2tmxo io4lm nmfcil(f rtmu oou0tpto ieiadfs um(mo (0arermrcoydlmD li o;t0tetoxo oy1al  mict tf rra(r nu4opt mfeiydfm um(mpnt0 eermocto1opD  ueils0 rxrirpoy1op n ies (faDum(mont0apx ioctydlaDem(vs;(4 etoif tadlmteanvs;(  exoxrpiy4amt mnetlt aDuaxmp;t1alxniictatfa2eanvont)altnxocoatop rau ols)srxoxm oy1aptemneilt a2umu  ou1tpe  oeiltlm2umn o;u)tltrifctodfp   u s s truoxrpio4lle  nes s) rrr(mooo0oetnmo3iasfs2rmu pnt) lxrxo3iydomDr nvolt trur(m3ny1ape mfcs s) 2rmum ;o1aexnioetat sDuluvs;() exoif3io1optrluvo (  rtrxr3ou1ol e ictl(faDtaxro;t1alt ifctasfmDum(vo u4arxrxf ta1fpDeli il( trxrxr3ou1am e fctl(farrrx pou0aleomf3iatfs2rl(vont)arenmr3oa1fpD  ivil(0s2toir ny1ap e fvi s)a2uaumpoo4oetomoctyt a2em(mo;t)trtnio3tadlp  anvo;t)tetrxr oudalt lfvtls)aDtau poo1aetnmoctad s2rln o t0alerxocio1opt lnvol(  2xmimpoudamenlfcils sDrm(  ot1opeo i3iad m2rmnvo ()aexrxf3oy1oaDelueols  exoir io1ol elnct s aDtr(ronu0tpxoif3iatfa2em( onu0altoio3to1lpDr nvsl() rtoxopou1ame lfesltfa2rmx  ;t4aptnmf3tls mDulumpnt4 ltoirctatfmt  uvo s)sruoxm iu1lleelfesa(faDraum ou0alt iietldfsDelnvs;(4 rerxocoy1la rauesls)setrxrpiudlp nlfeil(  rtm(mpot1oeenifetld mDra(mo;t) rxnxociydomD aues;()teuoim3nodlptnliesltf 2taxmp;t0alxn fetlt m2uanmp;u4tleomr3iadlm  anvi s  2trirpnu1ol emicias)srum(rono4tpxnii3tydfs ul(ms () lxrmr ootlm rliei s)seumirpiu4lpen fetlt s2taurp;t1apx mociytlm2eau p;(0trxoif3oa1lpte nvo s seurir3nu1amtn nei sfs2tm(  nu1opxoii3iytls el(ms;u4 lenxoctatfmt  uei;t  rtmiopiudopeelfes tfs2rm( o;o0oleomfciat mDra(vp;u4alerxo3iatoaDean ils)srxmxm oydamtnmfeias)aDtaxmpnu1tee  fetyt aDra( onu4 exnmocoodopDeli i;s0srtrim oydal n fvi s artaxm nt0tltn octld m eanvsnt4alenxr3ia1laDeaneo t0s2tmimpnu1ap nlfet tfaDrmu p;t1teeo oeiadls2uln o;t0trtoifcoodfmDrai s s0srtmim oudaltnlfvsl(f rtrx o;o4apenif3iltlmDuanms t0 lxomf oa1opDeln s t)s2xm(rpiydlpt lnvs t)s2uaur ou1tlx io3tyt m2eauvs;(4aexnif3ia1lpt lieo;s0 etrxm iu1am nlicilt  rraurpot4apxn fciatlm2rl(mon(0tlenxf3to1omDrlnvol(  rxoxo nudlmtnlneiasf Drm(  ;o0opxo fcildfsDeluvpnt0 rtoxr oadlmD  ivo;( trxrim io1amen iesas) 2ta(moot0oetomfctlsfaDrl(mpn(4 rxomf3todfaD aieol( s2xrim nu1oleelfcil(  ruru pnu4apxn icilt a2ulnvp (0 rxrxr todoa rluvs s)tetr(r ou1ome mfvsl()aDum(r nt0tetnioetldfaDrmums t)aetnxf3iotlat auvo;(0 etm(m3io1olen fetas s2rrxroot4aetoiictld s uan o t4 lerircoo1fmte i ols) eto(rpnodllt  fct t artr(ro;u4tlx mocilt m2rm(vpn()trtrir tydfmDe ues s  ruoio3iu4am elivil(f 2umumpot0tee mfctaslm rlnms;u4texoif3iydf
\ No newline at end of file
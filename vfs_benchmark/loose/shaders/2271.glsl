@@ -0,0 +1 @@
+ivo;s0srur(opny1llte fvta(f rra(ronu0oexoiociaslaDem( p (4 etnxrcoo1lat an s;s setoir iudlp e fctl()sDrauront1tptomictydfa2uanvp u0 etnircoatlp  lu sls) exoio no1omeelfvt tfa2tmu  nu0tlxoii3iatfm rmu s;t0altrifctytomDrlieil(0t2tm(opoudom e fcsls)arraxr nt1olt  oeiyd sDemuvo (0alxnxf ia1oaD  n sl()s2umir no1ol  lfvi ()a2ra(  ot4opt ii3iaslm2emn s (0 reoxoctytopD livi s t2uo(opiodlmtnmivsatfs2trur nu4oltomi3iadls umuvp;t4 eerxr iatlmtraivols)s2tmir iodop n ncilsf Drrumoot4olxoiietys mDuluvo;t4 eeoifctadoat auvol(0s2tmxrpnudolenlnvs t a2rmump;o0oeeoiociyd s2elnvp t)aexnmf3iodlpte ivo s0 rxoxrpio1olt miet ( aDtmx  ot0tpxoiictldfm ulnvo;t0tlenmocoatfate ivs;s  2uoxr3no4lpee nes ( sDur(rp;t1olxnmi3iltfsDrm(mpnu0 exomo3oytlmtrau s t  ruoiopou1lm n nvtat) 2umx p;t4tle ioeias a2em(vsnu4trxrifcoy1fm r u ols0teto(m no1amt mfes (  rumxrpno1apt if3tydfs2rmumo t)trxrxr oodopD anvi s  exoiopoo4alte icta( s2um(r ot0tpt mfciasfaDraump;u0 leoxo3oatfatraneslt seum(r iodapen fvs t)arra(ro;u4opx  i3iadla2umnmp;()tltnif iotfmt anvsl(0srumio3oydolee netls a2ur(rpno1apx miciatfm ulu o;u) lxoir3iydoate i s ( s2xmxrpou4ll   fcsat  2ua(rpot4tlenioeiyd a umu p ()arxrxo iytlat ai s s  2xoxo no4ope mietasfsrtm(rpnt1aetniociasfmDulu snt0aetrxf3oytop   n i t)seum(r nudlmeemfcta()aDraxmp;t1tlto oetlsfsDem(mp;t0 etnirciatopD anvil( sexrxo iy1al emnctls  rta( ooo1aeeo ociadfs rlu o;u)trtrxrcoo1lp e n o s)tetr(m io4alen nesatf 2ra(rpnu1tpeo fciat a um(vsnu4 lxnio iadfpteaueo s  rxo(m3iydolenlies ()srur(r ;o0alenii3tat s2ran sn(0altnxr iotopt auvs;t)s2umirpiu4ap  lncsatf rua(  nu1apxomo3iydfa2uln ont)texrxr3oa1lp raivs t setoxrpoy1ll  lictatf rtrxro;t1alxo oetytfmDrau pnt4aeenxfcia1lpDrlneo;()teumxo nydome mnct s  2urumpot0apxomo3tys m2el(mp ()trxoxociadomDrli olt)texrxo iydlmeemics tfaDrmxr no0tetomfciad a2uan o;(4 ltomf oo1lpDe iei s)srurio3iy1om   ics ()arrr( pot0ole  o3tatfm rmn snu0tltrmociodfptran o t srxoiopoydlpeelfvs s sDtru oou4aeeniocilsls rmnmonu0 renircoodlaDeluvi () euo(r3iy1ope mnes s  rurxrpot0tlenmictas a2umn pnu0texrmfciatfa raieo;s) etm(o oy4aptelfctltf 2raum no1olxnmi3iaslmDelnmp;t)teermf oa1fmDr n o s s2trxm iy1am  mfvia( srtax ont0opeo o3iydlm ua( s t4 rtoxo3todoaDraueilt) 2tmir iu4omt  nci ()aruau pot4altnmf3iasla2eluvpnt4tetnmr3ia1oa eanes (  rurio3oo1lpenmnvia( s2rmu pou4open f3iadlmDumumo;u4artnxr3oadlptrauvs;t0s2to(m iu1lmeelicia(fsruax  ;o4tleoiocildfm2rmnvs;u4artnxr3oadomteluvs;( srtrxo nydop  lfet t srrru  ou4opeoiicilsfmDulumpnu)treomf tydoatelneils sexm(rpnydale mfcta()sDumu  nt1alenmo3iyslm2uanmp;u0tlxoir3to1op r ivi;s0 2xo(o3ou1lptelfcs (fa2trx oou4open i3iydfmDemums;(0tlxnio oatfmtrlneol(  euriopny4om  miesl(fsrurxrp;u1ape io3iat a rmuvs;(0alerxfcoo1optelivsls) 2xmio3no1lpt liei sf rurx  ou0tpe ii3ildfaDelnmsnu) rerxf iy1fpt aivi s tetoxm3oodopt lfct tf 2umxr ot1apenmictasfmDumnvo (0trtrif oadomte iesls0truo(r iu4lleemfet t)artr(mpnu0aleomi3tat sDua(mp u0trenmfcia1optr n i;s)t2xm(m iydopee ivta()arta(rono1tpx moeiysfs2ranvon(4 lxomo oatoaDelivslt0 2xm(o ny1ame mfetas)s2trx o;u4tpe mf3iyd a um(vpn(4 etnmrciotlpDrlies t)srtoxm iu4llee nvsl(fsDuaump;o1tleo f3iadfs rlnmp u0areomfcoatla rauei t) 2ur(m io4lm  mfcsas)sDtmu pou4optomfcild s elu pn()alxrif iatoaD aivi;( s2toxm3oodlmenlict (fs2trx  oo4olxnmo3tadlm2rl(vp u4texnir3iodlpt livo;s  2xrxr3oydap  mfcil(fa2um(mpno4oeto f3tlsfm2el(mpnt4teeoxo tadlatrau ils0sexmxm3ou1amtemieia() rtmxm ot1aeenii3iasfsDem( snt4 rtrmo3ootlaDelneo t sruoxrpno1lpeelfvta( srum(r ou0aex mf3iasfm uln o t4tlenxr oa1om  luvslt0texm(o3io1lpen ivias)sDrr(moot1apen ociydla2umn s;u4alxrir3tydomDeaneo t s2to(o ou4lm   ivsatf Drr( o;u4aexn i3iydfm2ua(ms;(0aetrmfciytlaD luei (  rtmio oo4omte fctat)a2tr(m ;t4oltn iciad a uaumonu4tetnmf tytlpt an o;()t2umim3io4am elnviatf 2tr(r ;u1aee mfciysla eauvp;(0arxomrciy1lmDrlieo;(0 rumxo3oy4al  mfct (f rrr(rpnt4tpeo oetadla2eln s u)trenif io1lmD aivo () rxo(m3iu4llen fvs t arrrur ;u0tltomiciatfa eanvp u4 lxniocootlpD li i s  2trim nu1omte nei t aDtrx pot1tpe mf3iasfm eln s t4tltnio3tatfa   uvi;(0srtr(m3oodlpt mncs s aDraxm nt4tlxo feiasls2umu snu)aetnxrctatoaDr u i s0t2xmxmpnudope lnei sfs2uru ono0tltnmi3ilslaDelnvp;t0trenmf3iotlatr uvolt0 2xo(opiy1ameemnvilsf rumurpnt0aetnif3tytfs emuvs;t4trxoif totfp elueol( srumimpno1amt mfvil(f rrm(mont1opt mfciytfm uau o;u)artnmr iatlmDr uvo s sexm(m3io4ome lfvsls) rrmuroou4aleo i3tatls2umn o t0areomf iotlp   nvo;s0t2xrir iydaltn nvtlsfsrurxmo;o4oee  ietlsfmDumu onu4 rxomr3iytop rlivs;t)texoxr3oy1ll   feta() Dum(mpoo0oee mfciysfa elumsn(4trenmrciodomteln i;( sexrirpiudll emfeiasfsrtruroou4tpxo iciyd m2ran p u)aexrmoctotomD lnei ()trum(o3io4am  mfesas)srrmx ooo1tpt iieiydfs eaumsn()aexoxo3oadla e n slt) ruoxm no1op e ncslt s2rmumo;o4ope  i3ils aDem(vont0 etnmr3tadlmDraivil()sexoxr3iu1ap  licils s2rr(ront4oexnifcild m emuvp (0 rxnxf3ia1omD an ilt0s2tm(m3ny1amtemnvs ( aDum( ono1oexoif3tasls2raumo;u4tetrxf tydoaDe ieslt srtrxmpou4altelfvi ()a2ua(r ;u1tptomi3iasla uanmon(4tlxomr3iytoaD au i s) rxoir oy1opee ncilt) ruaxroou1opxn octas m2ean o (0teerxfctotopDeanes;s0t2xrxo ou1optelfeils) rtru pot0alenifcildlsDrluvs t0areoxocto1op  ln i (0 euoim3iudomtn feils) 2tru  ;u4oex ifeiaslaDuau pn()altoxfcoydfpDeaneslt)srtmxrpny1omt lfcsltfaDur(m nu1altomfcildfmDra(mo u)artrio3oodlp eauesl( trtr(r3iy1omt mnet ( s2uru  oo0opto ociasfaDrln s;u0 reomf todop rai s;s0srxoimpio1ll nlfvsatfa2urx o;t4opx mieilsfs ra(vo;(4trenif3iotlp  lueil(0t2urimpny1lme mietls)srrr(r ;u1tle ifeiytfa2rauvsn(4 leoioctadfptr ivi;t t2uoio ou4apenmneta() 2taxmp;t1opxnmoetldla2rlnvs t)aeenmf3iatom e ivsls) exmxr3iudlpee fcsltfa2tm(ront0aex mi3tldfa2eanvpnu0alxrir3oadfa rauvs (0 eum(r3nu1lmt lnesas) 2rm(ro;o0tpxniieiydfm2rluvo;t)texnxr3tatfmD lnei () 2xm(o ou4optelieiasf 2taur oo0alxoiiciadfmDumuvpn(0aetnmrciotfate nvo;s0srtrio iudlpen fviasf rtr(m ;t1opt  ietas m um(mo u)trtnxo iydlm e ues;t) 2tm(m nu4ll n fcta(fsrur(mpnt1oexo iciad s emn ont)aexoir ta1lmt auvi;(0srxoir3iydlp emfvilt) rtr(m ;o4tptnmo3tysfs uauvo;u) rxoif3oydla r ivs;s0srxr(m oodope  fvsatfsrtrxmono1tlt mfetldfs eluvs;t4tltrxo3oadfpDrlivol( teuoxm3oydap emictls aDrrur ou1oleomi3iad mDum( s;(0trxrmo oa1opDr ueo (0s2uoxm no4open nctl(faDtm(r ;u1tle if3iad s emnmo (0alermfctadom rlneols)s2uo(r oodlm elivsas srtaxrpno0aeen o3iat a2um(msnu0 exoircio1fpDraiei (0trtr(mpny4opt lici t) rrm( o;o4aex  fetys a eanvo;(4 rtomo3oodfa e n ilt)srtoim3iodapt livsat) 2rax pno4openmfeildlsDumn p;t) lenmf3ta1fpDeli s;( trurirpno4apenmfcsa( arta(mpou0opxoif3iys s2ua(vsnt)aexoxrcta1fa eauesl(0 exrxm nydole  fetat aruauront1olenifcildls2ul(mon(4 rxomf3io1fmtraues;(0 2trxo3iudal e neiatfa2ur(roou4teenmieiat a2el(ms (4arenxfciotoatrliei s) rumimpoy4lp nmiet s)srum(m ;t0aet mo3ilt aDrmnmp u0trtnmf3oy1lat  nvs;()s2xmxrpio4lle  ieil()a2rauro;t0tlx mfciys a emn s;() exrxo iatlaDeauvo s0s2urimpiydal nlnet t  Drr(mont0aptnmo3iasla2em(vsnu)arerxo to1fa e uei (0 eurxmpou1ol nmivsa() 2rauro;t1optomoeilsfaDranvp;u)trenxr totfptraivo;t)tetrxr3iu4ame  neia()srtrumo;t1oleo f3tytls ul(vo;t4aeeoxo oadfpDr iesls t2xmxo iu4ll e fvt sfarrrxmo;o0alxnmocilt s2ea(ms;(0trtnxr oy1fateln s;t)srto(m ny1op elfesls sDumxrpnu4texn fciydlm2emuvo;t) ltnxr oydlp   i o s t2tmxr io1ll   feta( aDrr(mono4oeenioetldfaDum(vo t)trtnxr iodlmt auvi (0srur(o3iudop  lnvtat)aruaur no1olx ifcias a2raumont4 lxoxr iodfa ranvo () euoxmpiy1optelnei tfsDrau p;t0oexnifciytfa2rau s t) rxrxo3oodfa rlu ilt)trtmxm iy1llenmnetlt) Drrurpno0aexn iciltfs ulu p;t) leomfctotop eanesls)seumxmpny4lpt licias)a2uauronu0teen feiydlaDrmnms t)arxnif3iotlpDe iei ()sexo(r no4op elfei (fsrraurpnt1tet mfctydlaDulu o;u0texoir3ty1fm e nvi t teum(o3nydomt livsat) 2ra(mo;t4olto fetlt m2el(ms (4 exrirctatoaDr ues t t2xmxr3oo1ol n ivtltfs2tmxmpnt4oexo ictytfaDum( snt)areoircto1oaDraneo s0teuo(opiu4apenlnvt ( arrr( pnu0oleomieiad sDra(mp t4alenxr totlmD li ol()srtrir3oodal   fvil(fsDtmx p;t4tlx iictytlmDrlnmp t0aetnmo3tatfp  lies t) etoxm3oodal nmiei ()srtr(  no1oltn ociys s2el(vp u4arenmfcoy1la ean i;t0 rtrimpiu4lmt mfcilt)sruax  no0aexnmfeiltfa2ea( sn(0artoxr iatop eln s t t2uoxm iy1optn fctlt  rua(root0tex iietat s uan o;t0aexoir3tydoa r nvilt0 2tr(r oydole lfct tfartmx o;o4oee iietydls2uluvsnt4 exomr3iotom eai il(0 rur(opnydamt lfcslsf 2urumpot1tpxomoctldls2em(vp ()artnxrcoo1fp rauei s) eurxrpoudol emnvias aDtaurpno4aptn ociadlaDrmuvs;u4aetnmrcootfp e n ols trxrxrpio1omtemfesl(fs2tmurp;u4olen f3iydlaDrm( sn(0arxnxociotoaD  ueol() eur(opoy1om  mici t)sDua( pou0apen fctldla2emnvo;(4 ltrir3oy1fptr i i;(  ruo(r3iu1lm nmics (fa2rrxro;t1aexniictadfm2uan s;(0artrifcootlmD ai ol()srto(m iy4am e feiasfarum(rpno4tltnioeilsfa2rlu s;(4tltnxf to1omtr ueol( s2trim3io4alen fcsls)aDrmump;o0oexnifciyd sDel(vp;(4 etrir3iatlmDr n o s0 2xmxr oudoleemietls)arrax  ;t1apen oeilt sDul( o t)texrmr3ty1fa e ivi t)srurxm io1lmen nesa(fsrrau p;t1opeo f3tlsfmDranvp u4tleoxo3tytfptrauvo ( s2urxm3oy1lmtelict t)sDua(rpnt1aleoifetaslm2uan o;(4texnmo iy1lmtrln s;s  exm(m oo1ope licsat)s2ua(rpoo1tpeomiciltlmDumn s ()treoxr3oy1op rau i s0trtmxopio4lpeemnei t sDumu oou0alxnif3ild m2umn s;t4tetnxo oy1lmte ivs (  ruoxr oudaptemnet ()aDumxmpnt1alxo oeiydlm rlnvpnt4tltrif totfaDean s s)srxr(m iudaltemivsas srrru ono4oexoio3iad mDul(vonu)tlxnif tydfpDrlueols0t2urim iu4op nlfvi t)srtrurpno0oeeniictlsfaDrl(msn()arenxrcia1oa elivs;s0 2uo(m3no1lmtnlnvtlsf 2tm(ront0tle iieiadls2uaumo;() etrmfcoatfpDrlueo s) eurir oodlmte nesl(f Dua(  nt4aexniieiltfm2um( o;u4tltrxr to1latranesls)s2uoim3oydopeelfvia( srua( ooo0aptomfetasfmDeanmp;(4 etnmo3tadlat livs;t0truoxopoo4ame mies t) 2rmxm ot4alxnioeiat s em(mo;u4 rtnmo3oodlmtelnvols teurxo3nu1lmt lnetat)srtrxronu1apx mfetyt mDuau pnt4 lxnmocoa1la  lues;t0s2trio oo4optn fvt t srraxmp;o1aexnmfctasla2ra( o (4alxrirciadoat  i slt t2uo(o3iy4lpeemiet s)aDuau  nt4aeenifeildla2ua(mp t4 rxomr ta1lmtrau ol( srtmim3iu4alte fei t) rtr(rono1oex iociasls2rl(vs;t) reoxo oytfa rli i s trtrio oy1ol  lfcsa( srumumooo0tlxn iciydfs rmump u4 lerxf3ta1omte ivi;()texrim3iy1lpt lncsa(fsDtmxm nu1tpen i3iyd aDrl(msnt) ltrmr3iotfmte nvo s s2umxo nodale livsl( aDrm(moot0tlx if3tydlaDrln s t4tlenmfciotfm e ues;t) eumim3oydole mnvsat)srtrxm ;t0tpenmoetas sDrlums;t4artniociotfpDrau ols0tetmxmpio4ll  lfetlt)aDua(  ou1oexoio3iasfa2umnvo;()trtomf3to1lpDeli s;()s2tm(o oo1opee nctl(  rtaurp;u1aet mo3iat m emnms;u)alerio ootfpDran ols) rtoxm3oodaltemfvi t)arta(ront1olxn fctatfa rl(mont0texnifcto1fp  lnei;( s2xo(o3ny4ole mici t aDrrxrpnu1tex iictytlsDeau s t4teermociotom elnes;(0 2umxr3ou4lp   neilt)s2rrxmp;o0tptoiietys s umuvpnu)altoxf oadlm rlueo;s)setmxm nu1al elncsls) Duau pou4olxnmo3tys s eauvpnu0trenxrctydomDeluvo;s tetr(mpoydamenlivs s)artmxronu1aleoioeiad m2el( o;u0trenmr3ootfa r i olt  2umimpno1omee ivtasfarrr( o;u1tpeomf3ils mDemuvs (4 etnif to1lptran s;s)tetmir oodomtnlfes (fsDtru onu1olxnif3iad s2rlumo;t) leoxr3oodfaDeanvol(0 eum(r3iudapt  icsat)s2ua(m oo1tex mieildfa2umnmonu4areomo3tadoat  i slt0trxr(rpnu4omee ieil(f Dtm(r oo1optnmfctltls rl( onu4tltnmfciotlpDeai i t) etmiopiu4ope livslsfa2uau poo4oltnioctysfsDul(vs;(4 ltrifcoytom  aueils0s2uoxrpiu1optemiesa()sDurxrp;o0tlen oeiadls em(vs;u)treomf oo1omD lu o;t texr(rpno4ll n netls)sDtr(  nu1oee  f3tytlm2rlumo (0aexnxrcoa1omD  n sl(0 rtrir ny1lle mfci s)arur(mo;u0opeomfeiytfm2ra(ms (4altnio3oodomDrlnei (0 rtoirpiu1lm  mieia(faDtr( onu1opxoii3iydfaDua(ms;(0aeerxf3oodfmD  nvol(0t2urir oudamtnmivia(f rtm(r ;t4oexnmieiatls2rm(vs;(4aeerxfciodfate n o t)s2to(rpiu4lm   ictatfsrrr(  no4alenifetyd s2umnmo u)alenirctodopt  n i;(0s2xrxm oy4om   ncsl(farum(r nt4alxnmf3iydfa2umu o;u)artnxo todopD  ivol(0trumir3iy4ap elncilsf ruau o;o1opt iociytfm rlnms t0aexrmo ta1oaDr ivo (0t2xrim3iydalt mivia(fs2ta(m ;o4tptomo3iatfm2rmumonu0 reomrciydfm r ieo (0setrir nodop nmfcia(  Dumx pno4tlxnmoeiytls2rmnmo;t0trerxr3oy1lmDeau o s  2uoim no4ol e net t  2trurpoo1aee ioeiltlmDuanvpnu0aexnmrcta1optr i ols) 2xrimpoydlmen fet s) rtru pnu1aetoifeiasfs eln o t4 etoxr todoa e ivo;t0t2um(opoy1olt mnvt s)s2trxmpnt4opxo ictlsla emuvs;(4alxnxf3iydopt au o ( srtm(opou1optnmfcs sf Drmurooo0ope  feias s2rl( s;t0alxoxfciatomDrau ils t2toir3iy4llenlnctatfa2tmur oo1oet  feilsls2rmn onu)artrmr3oo1fpD auvo;t) 2uoirpoodlmtnmics s sDumuront4apxnmfeiasls ran p;u4arxnmo iydfmDrauvols0teuo(r ou1lpe  fvsl( srrru o;u1apxn feiatlm2emuvonu4areoxrcoadopDrluvslt  2toxm3oo1am   netat aDrax pno1tetnmfeiydlmDrm(vpnu)alerxfcoatlaDrlnvo;s0s2xmio3io1lmt mict tfa2raxmonu0alxomfciadlaDua( p;(0trermr3tadfpteln o;s0s2xo(rpiu4op  mneta() 2tmur ou1tleomieiysfsDemnmp t) etrxfciadop eln i () rurirpno1apeemncsl()a2taurpot1oet mfcild a uauvp;t0 exoxo oy1oa rluvsls0 rto(m3ny1opte nvi s)srrmumoou1tpx mfeiasfs um(msn(4altnmrciotfaD lnesls0texr(r iudlm  mfct ( aDrmurpno0tee  ictlt m2rau s;t0artrmrcoo1fpD  u s;(0 rtmxr3oo4op nlict tf 2tax p;o0tpt ifetltfmDeluvo ()arxoxf3iatfptr n s;t  exrirpoy1lpt  nviltfs2trumpnt4aptoifciad s2elnvp (4tlxrifcoydoatr ieo;s0sexr(rpiy1lmeemfviat  2urx  oo4aptoif3ildlaDrlums;t)arxoir iadla  ai o t  2urxo3no1op nlicilt)sDuaump;t1ape  feiytlaDelu p;t4 lerioctytfmt livs;()t2umir3nu1amtnlnesasfsDururono0oex ioctysfm2rau o;() leomf oo1laDrln ils0t2uoxm3nodlpeelnet (fs2uaumo;t4tpxnmiciytfm elumo;t) rxrmr oodfpDelueil( t2uo(o3iu1am n iviatfsrtmxronu1open iciasfs2rlu s;t) reoxo3oy1oat au o;t)s2xr(rpiy4amtemnvsl( aDumumo;u0oeeoiiciat mDemumsnu)texrir3to1opDeli ils)texoio nodap emiviasfa2rrxmo;u1tpxn oetasfs rmnmo (4trtomrctadomtrau sls0 2trxo nu1lpeemnct (fsDtmu pno0olt iocias s ra(mo;(4areoxo3oadoaDeauesl(0s2umxr ny4lp nmfvia( srtmx onu4texnifctlsfs rl( p ()tltoxr oo1fpDelu o;(0 exm(o io1ll emnctl( s2rax pot0aeto o3ildla2rm(vo;u)arxnmr oydlpDr ies ()s2xm(opiodome mnvs t)sDtrxm ;u1apen oetys sDel( p u4 rxoirciadfp rau i s srxr(m3iudol nlfetl()aDur( o;o4apx iiciatlaDel( p t) lxnmo ta1lmDrlueo s0 etoim3oudol nmfesl( srua( ono0oet mieiyt mDuln p;()teeoxocoatfpDrliesls seuoir3oudlm nmfeslt)sDuax p;o4opeomietlt m ua(vo t) lermo3tatfa  aieilt)s2xmxrpou1al nmfcsls srrru pnt0opxn feiatls2rlnmp;t)tltnifcta1lmDe nes s0s2xrirpno1optnmicils) rtru o;t0aeto oetys m rmuvp u0treoxr ta1fmtranvo;() rurxrpny1amtn fvtls)srumur ;t4tltn oetytls2emuvo;t0tlenmocia1oa  anvo;t  2toxr iodll   fvta() 2taxmpou4optnmo3tad aDel(mo t)teenmfciy1fp eaieols  exr(r3iy1op elfvslt)srtm(  oo1tet ifctydfsDeln s;(4arxriocia1lmt  u s s  rurirpoy4ape mfes ( sDtmum ;t1ale ifctadfaDrau o (0 rtrmf oatlmDrlueils) 2urirpoudolen netlt aDtru o;u4olxoio3iysfa2rluvp;t0tleoio totoa rluvo;s tetrio3ou4am nmfvsa( arrau  oo4oleoiictytfs ua(vonu0aetnir oa1oaDeanvol(0 rum(m io1ol elfetasfaDra(r oo4oeeo i3tld mDuln pnu0 etoir iodlat lu il( srxoxr3oo4amenlfcia(fsrrau  ou4olt  f3tltlaDemn ont4 eerir iatfpteaieo;t0 rxo(m ny4al  mnet (fa2ur(rp;t1oleomoeiydfm rauvpnu) lxrmr todlaD  nvolt)sexrim iu4lm elfciltf 2rax pnu0aexo ocilt m eau pnt)tetomociodopteauvo s t2um(mpio1omenlneslt s2raxmoot0tptomieiyd s2ulu pn(0areomr oydop r i s;t)srurimpnu1omenlfct t arrr(  ;u4teeoif3iatfm ulump;t0alerir oy1lp eluvs t)texoxo oudlmtnlfvt sfsDtr(m ot4tle  f3tltlm eaumo t)trtrmfctadla   ies t seurxmpoy4ll elncsa(fa2rmu p;o4apxomi3tls m2rm(mo;t) rxoxf io1lmte ueo t  euoir iydome  nvtl( aDta( poo4tpx  feiys aDumuvpn(4 ltoiocty1fmDelnesl() exmxo3io1lleelfvsas artmum ;o4ope if3iasls2rmu o t4 lxnircto1omDe neo s)srumxr3oy4omeelfci () Dua(r ot4oleoii3iydfa umuvo (0aetomo ootlp   n s;s s2uoxopiodape livi ( artrx  ;u1oltn fciyt s2um(mpnt4 ltrir oadfpDeln o;t0srxoxo iy4olen ieiat  Dtr(m ;u0oleniietadfm2ua( s;(4 ltoir tadomte nei;s)s2xrxrpoo1lmeelietls)s2ururp;o0alenmfetytla um(vpn(4aexnir3oydoateluvi () 2uo(r3iodlp nlfcs t  Dtmxrono1aetoiociatlsDulumo t0 lermf3to1la r i o ( sexmio3ny1lp nlfcs sf rtau  no0aeenmi3tadfs2uauvont0aleoio3todlpD au il(0 2uo(opnu4opte nvtl()a2ta(moot1aet mieiytlm2ulu o;u)artoxf3ty1lp r u i t0s2urxm no4lpe mncsl( aDum(mpou1tetomi3tys mDem(mp t4 etrirctydla  lu s t0t2xrxrpoodomenlncil() ruax pot0tptoioeiatlm2ean o u0 eeoif3oy1lpDe u ils) exr(opio1op n fvias)aDtr( oot1alxoiieiydlsDrlu o;t0 etrmo iodom eaieo;t0t2tr(mpnydlm n nvtatfa2rr(mooo0tex mfeiytla2rl(msn(0artnio iy1fa   u s;()s2ur(o3oudlltnlieilt) rta(m no1ale moeilsfm rmuvo;u4texnxo iydlp r u o (0 rtmirpoo1amtelnctat  Drmx p;u0oltnmiciad aDrlumont4 rtomf iatlmD aivo t0 exrxo3ny4ol n ieia() rtaxrono1aexo ieiltlmDuaumsnt) etnir3tydomD lnes;s setrimpiy1ome mivia()aDra(  oo0tpxo ociasfa ul(ms;u) eeoir oydfatr u olt tetrimpiu4lmt  nctat)s2uax p;t4aeenifeildls2ea(mo t)arenmo3tydfm rai i t0srtm(r no4lp e ivs (  2tm(  nu0oetnmfeilsls2elnvsnu) eerircoodla  lies t0trxo(m3io1amt liesas aDtm(mpou0olto f3iytfm2rmu o t4arenxrcoa1lpD aiei;s)texm(o ou4lpt  fvils  2rmuront0tee  ocils s ran s (4 rtomo iodlp eauvol()t2xr(mpoo4al emictls  rrr( ono4tpeoiieiadfs2ua( s (0altoir ia1lmDrlnvolt s2xrim ou1lltn net ( sDtrumo;t1aptomi3iydla elu pn(4tlermf3iytfpte i i;t0trur(r3iy4ape mfei ()artrxrpot4tpe  feiaslsDrl(mon(0tltrmocty1fatr uvi ()srxr(m3ou4om nmnctls) Dra(mpoo4tet moctaslsDuan pn(0texrmo iydfmte ivo t0t2xr(r iy1apee ivtat srrrxroou1tle ii3ildfm el(vsn(0aeeomf3totlm raneslt0 rxr(mpiudomen iviasfarra(r oo0oeenmfetldfa uanvp;()tlerxociy1lmDe ues t0trxrxo ou4ope lfetls)a2tax  oo1oet  iciasla ea(vp;(0tlenio3oadlpDeai ils0 rxoxo3oudlp  lics (fa2tm(  nu0opxo i3iytlsDeauvpn(0aetomf3iydlateanvs;s t2um(r3iu4lmt lictatf 2tm( ont4tlx  icias aDeaums t0teenmrciatoptrluvo (0t2trir ou4lp elivsls) 2ra(rp;u4teto ieiydfaDrm(mo t4 eerxrcta1laDr ivo;(0sruoxopiy1apt lfcs (  rrmu  nu4tpen feiatls2emnvo u4tltoir3tadlptrln s t s2xrxrpiu4lmt  ici t)s2rax poo0oeeoiociltfs ea(mp;u4 etrif3io1omt anesl(0srtrio nu4ape mfct t  2rmumoou0tpxomo3tysfm2um(vsnt0texrxo3tadfa   ivi t s2tr(mpiy4alen ncil()sDuaur nt4tpx mfeilsfs2rmu s u)tltomrcto1fa rluvi;( trxm(r3oodom   neia(f Durur ;u1optn ieiyslaDran o;u0tlxrmr iydlat lues;s srumiopnu4omt  fes (f rtr( ooo0tpxn f3ils mDrlnvs;u4texrio oydlpD an o;(  2trim ny4apen nctas  Drmumo;t0teto ieiys mDua(mp (0 renmocoodlmDe nvil(  etoirpnu4llee ncil( artaumonu0olxnmoctaslsDra(monu0 rtrio3ootopDeauvolt0teur(mpou4op nmneia(f Dtmur ;u0apxo i3iysfm2umnmpn(0altrxrciodlmD  uvi;s  rxo(r3oydape  nviasfa2rmx p;u1apxnif3ildla ean o;u4aeenmf3iydlp  lu s t)t2xo(o iydlle  iciat  2truronu4apt  i3tydlmDrl(ms t) leriocio1fpt lnvo s tetmxo3no4lpenlivsls)aDtrxmo;o4olxoiiciadfsDumu ont) exomo ta1fmDr nei;t0tetr(o3iudapee nvs s arurxronu4open o3tysla el( o t4altoir totfaDe u o (0t2xm(m oy4optelnvslt) rtm(  ;u1olen oeiydlaDrm(ms;t4aeeoxo3iadopt aueols) eur(r3nudlp   icil(  2rrxrp;o4teeoifciydfsDul(vsnt4aetnxr3oa1lm eanvs (  2xo(m io1ole  netl()arrm( poo0oeen fctyt m2eluvo;()aeenifciatomDranvi;(  euoxr3ou1lltn netltfaDrau pou4alt iicilsfa2emnvo;t)trerif3ootlateanesl()t2uriopiy1lleelieils)aDum(rpou4aeeoiieilslmDelump;t4 etnxf3oa1opDrai s;t0 rxrirpiu4lpenmfeiat)arumu ooo4tleniictltfm2ul(vp;t4 lerxf io1op eauvo t texo(m3oo1amt mictlsfs2rrxm nu0tlxnmo3tadls rauvp t) rxrifcoo1la r ivsl(  exrxrpoo1opeelnvt tfaDurx  no4tpeomo3ilslm2eluvo;(0aleoxr3to1fmDran o (  etoir io1lm elfci () Dtaumont4openmociytfmDemu p;u)tlxnmf3tatlm elieo;t)trxoxr3nydal nmfet (f rum(rpnu1apeo f3tlsfa em(mo;u0tetrmo oo1la eanvs s t2uoxm3nu1om nmnetlt)sDrmx  no1olxo iciatfmDea(mp (4aleniocoytoaDe nvi ( tetoiopoydol elnei s sDur( pot0oltn iciytlm2rluvp t4 lxoxocoodfp   uvi;s0texr(opnydlp n iesat) Drrumono1altoioeiys a ra( pnu4 etrif3oydlmtrau ilt0srumim3ny1amtelivtl(f rtaxmpnt0apxomi3ild a2rlnvs u4trtnmocoydop eaiei;( t2um(r3io4ll elies t sDumxmooo0tpt io3ildfa emuvo t) eeomrciytfateln o;(0t2xrxr iydol emnviatf 2tmx  ;o4tpenmietat a2ulnvp t4 lxrmr iadfm r n i;()srumxo3iydll  lfci (  rumu  ;o1oleomo3iltfs umnmsnt) exrmo3oytlaD livs s0s2to(r3iydoptnlieta(fsDtr( o;t1olx io3iydfs el( o u0aeermr3iydlmDraivolt0 2xo(m3nu1llte ictas) 2ta(m nu4oetoifeilsfs eanvon(0 eeoxo tatoptrau s t)setoim io4oltnlfviltf 2rmxro;u1alenifetlsls eauvont0tlenxo ia1oatranei;(0srxoim3oydalt mfcsl()sDraxrp;t4oex moeiyt m rmnms;(4artnxrctatomDraies;(0s2xoirpoudlmtn net (  Dtaurpnu0tpenifctadls2umumon()artrif iydoptrluvs;s teumxmpiu4ll elfvt s) rtr(mpno0aptoifetat m el(vo;u0tleoir3oy1fa rlnvi;t0t2umiopoo1lm elncta( a2trx  ;o1teeniocias s2ul( pnt4arerxfciotfa  li ils  rumxo3oo4lpt lnci s)aDur(  nt1altomiciytfmDemnvs t0trxoirctytfaDean i t  rxoir iu1om   ics (fa2trx ono4oet micildfs2uauvont4 lxnmoctytlmDelieo (0trtoim3no4optnlfct (f rtm(r ot0tpxomoeilt a2uanmsn(4teeoir3tytop rai o;()seurxm io4amtelicil(  rraumpnt1teeniicildlmDea(vo (4 ltnxf3io1opDe nvo (0srxm(mpou4ll n icslt  2rmum ;o1aet io3ilsla em(mp u4trxrxocoatoptrauvs;()seuo(o nu1lpe  fvia(f rrrxrpou0olt  f3tytfaDeau s;(0 eenmo3ty1opDran o ()trur(o3no4ame miei t)sDurumoot0optnmf3tlslmDrau s;t) eeomr3tadop  aneil(0 2tm(o3iu4lltelnvils sDraxm oo0oee mictltfm ea( o;t) etrir todfaD lieslt  etrio nydoltelnvtl( a2tru  nt1apxomfeild a rln p;(0 renmoctydoatr ivs;( setm(rpiu1opeemnesas s2umxr ;o0aex ii3iydlaDrmu sn()texnir3oatlatrluvs () exmio3oy1llenmiesa(  Dra(m ot1aexo feiydfa2uau s u4 exoiociadfm rlies t0srtoxopnu4lptelncslt  2uaxmoou0tpe ifeiydlm2rlnvsnu4 renxr3ty1fmDr ueil( t2uoirpiu4lpt mnetl(  Dua( poo0oleomoetad sDrl(ms t4alxomo oodoptr nvo;s  2xrxmpoodlme  fviasfa2tmurpnu4tpxoioetysla uanmon()alenifcoy1fpDr i o ()t2xoxopio4apte nesltf rtrum ;t4tlt  o3iat a2el(mp;u)arxrxf3oadlaDe n olt0setmiopiodopt  fcilt srtrx oot1apeomfciydfsDumu o u4artomo tadfptrau s;s0 exm(o3oo4amt mieia() Dra(monu0oeto o3tyt s emums;(4 eeniocoy1lpDe ues s) 2um(r ny1lp n nvs tfa2rmx  ;o0apxnio3iasls2rlums u)aexnxr iotomD ln ol() exoxo oo1altnmnesl()a2rrumo;u4altnifetyd a ran p;(4tleomr oatla   ivi;( srtmim3no1aleemfeil(farrr( o;o0teen i3ils s ea( ont)trenif oy1faDeluvs () ruo(mpny1omtemivtls)srurx pou0tpto f3iltls ua( p ()trermf3tatlmDe ivi;t setoio iodol e ict s)sDrax  ;u1oeenmfeildlaDul(vs;()altrxr io1op rauvi;s0sexrxopiu4omt lnctat  2tr(mpno1teeomieiltfm2umuvsnt0aeenifcty1laDelu sl(0s2umio no1alt lfesl(fsrumxmpnt1tex ifeilsfa2umnvpn(4arermr tydlp  anei;s  exmim nodoltnmnvtlt aDum(r ;u4tltoiieiyt sDrmuvs;t4 reomfcta1lmtr uvols texmirpio4lmenmncsat aDtmump;t0olxnmictydlm2em(mo;t)trxnmrciotlatraivi;()t2uoio3oydlmtn iet (fartm(mpot1oeeo fciat mDuaumsn(4 etnmocto1lat  uei;(0seuoxo oydaptnlfvsatfa2uru o;u0aexomoeiasfsDem(mo t)alxrifcio1fmte i ol(0seuo(opiy1am n fctl() 2raurooo1altoifetas a ulums ()aeeoif3oydla  lnvslt0 2tmxo3oy4opte fvt (  Dtm(ro;o4teenmfetytlmDrmu o (4aetrxfcoo1fpDrai o s0 rxo(m iu1ole lnvi t  rrmumo;o0opxoioetlslmDrl(mpn(0teermo io1fmt  i olt0teuoxrpio4aleelfcta(fs2taxr ot0olx ioeiys s2ran pn()aetrio oadfatrlies ( sexm(rpno1amtelfvilt  Durum ;o1aexnio3iydlaDrmnvp ()trenxr3oytlaDe nvols  2xmim3ny1olen fvsls s2tmx  ou0aeto oeiysfa2uaump t4 eeomf3oydlaDrlieilt t2uoim oy1lltnmnvs s)s2rau  nt1apx  oeiytfa umuvs;() rtoir3tadfaDraiesl( texo(mpiu4lme  nvt (fsrrm(rpot1apxo fctldfs rl(mont0 etrmocto1op  aieil() rtoio iudapteliesa(faDum(m nu0openii3ilsfm uanmpnt0 rxomr3oy1omtelu s (0srxrxopnu1altn fcsltfsDua(mpnu0teeomi3iltls2ulumo;t0arerir3oodomteau ilt) eurio oy4omee fctltfartm(mono4tlt mi3ilsfaDeau ont0tltrxo3iytla eaueo;t0t2urimpiy4lm nmfcslt aDurxmono4aptomo3ilt s2ea( s t0teenmo oatop elneslt sruoxrpoo1llenmnvias)srrrum oo1alen iciat a umu o (0 ltnmo tatop r ivol( srtrim nodllenmneil(fs2rrurpoo1tlx ifeiyslm2ul(vo u4alerircia1oatrliei t tetmxm3nydlmen ieilt arrm(root1texniieiydfm rluvo u4alxnifcty1latrlivs t trto(o nu1omee nctl(f rrr(r ;u1tetomociltls2uauvs u4 eenmr totop elues;t) 2umxopnydopee iesat) Dtrurpno0tptomiciasfs2raump u) rxrmrcto1fpDe uvi s s2umxo oy4op emnvils sDum(mooo4ale moetltfmDrmn pnu0aeeomfcty1faDrai ilt) eurxmpny1lleemici t)s2rrumo;u4texnii3iysfaDumnms;t4tlenir oadopDrai ils0teumimpno1lptnlnei t) 2ta(r nu1aptnmociydla2umu s u4 ltniocia1laD  neo s0t2um(r3oy4op e ncslsfartr( o;u0ape ii3tltla2uanmp (0areoif3iytoptean s;t seumxmpiy4apenmncs s)s2uru pno0aex  o3tadlsDrlnmpnu0aetomo ia1fm   nesls0t2tr(mpiydomtemivs ()sDtrumpno1ope  feiad sDemumsnu4 ltomociodlmteluvi;t  exrxrpnu4amtelivias arrauroou0oleomf3iydlm emnmont4texrifcoa1fpDe u o t0s2ur(o3ou4lm nlivilt)a2ta( pot0apxomi3iadla2rau o () rtrxr todomtelivo;()tetoim3oy4am   nvs s)sDuaumonu4olxoioctatfa2ulnms (0 rxomo3oadfptr n slt) rxm(rpiydopeemnvs ( s2ua(m ;t4olxomfctls m2rm( o;t) lxomocio1op raiei;t)seurir3nodolte fciltfsrrrurp;u0ape if3iatls ul(msn() exnxo oytfaDraneo;(0srxrxopiodlle mnesas  Drm( ono4olxo o3tltfm2rl(mpn(0trxrircoodop ranvi;t) rxoiopoudopee fctl( aDraurpnt1aetniietldfaDem(vs;t4arenmr3to1lpDrluvo (  2ur(opno1omtn ivs ( arur( oot0apx  i3ildlsDrmnms;t4trxnifctydfpt  nvi t0 rtm(r3iodop   iesltfartmur ot0alt moeils s2rm( pnu) rxrmf io1lmteanvi () exrxr3ou4lmte fesat srurxront4ole ifeiatls2emums;()teermociytfptrluvi ( srtoxm nodopee fciatfs2rm(r ot1tlt iieiasfsDran o u)aexrxr oodfmDrlivil( texrimpoydal nlivsltf 2rm(mp;o4optnmfciys a2rau s;u4tlenxfcio1op e ivs ( t2trim3io4opt  fesas arrrx  ;o0ole mo3ild sDeaumo;t0texomocoa1la  lu o;t) 2ur(rpoo1openmictlt)sDraum oo1tptniietlt a2umumsnt) lerifcootom eau ols0 rum(r3oo4amenmfvsat) rtmxm ;o0aetoif3iytlmDrluvsn(0 exrxf oy1lpt lies (0tetr(o3iu4opt mfcsltfa2trxmont1oexomoetadfm2emn ont0 rxnxr oo1oat  ieolt)trtoxopoo1ale liet (fsDuau poo0olt mf3tytla2emn o ()areoio totoaDranvils0sexrxo no4lp e nes t)aDuaxmo;u1tee mo3tysla2ranvpn(0alxnir3iy1fp  lnvs t) rtoxopiy1lle lnetls s2ta(mo;u0apto ociltlm2rlnvon(4aetrif tydla elneo;(0srxr(o3iy1lm elivtas)s2rmxmo;o1oex ii3tld m2ea(vp;t0 ltrxfcty1fp  lu i (0 euoxr iydam nlivs s  2ra(ro;o4ope moctasfa2rln p (0tlxoxfcoo1fat ln s t  rto(r iudalenmnvtas)s2urxront4oee  ociys s ra( pn(4 eermociodlmD anvi;s texoxr oydll emfctasf Dum(m ;u1opxo feildls2emn s ()tltnxfcootfm eln o (0t2xmxmpio4alee fctat)arra( poo1optnmoeiadls2rauvont)texnxociodlm ranvi;s texrirpoo1am nmivsat  2ta(m ;t4oet  ieiat m2rauvp t0artomr3to1la eai ols  rtoxo3oy1lpe  ivt tf 2rauront4altoii3tld a2ua(vsnu) exoxr iodoatran o s  rumxo3iu4op  mnetat  2raxr ;u1alxnifcildlsDuan s ()arxomr3ty1oaDr uvs s t2tmio3nodlp elivsa(  Dtrxrp;o0tle  ietldlaDuan pnt4teenxrciotfpte u sls0setrxopou4lm  mncil() 2ua(ro;u4tlx iietatlaDrmnvs;(0 rxrmr todfaDe nvolt0trtm(r ou1omt  fes s  Dtmxmp;o0opxn octydfsDeau s;t)tlxnxrctotomD  ivo t)t2xm(m nu1am   fcilt)a2ta(mpou4tetoioeildfa2rmn s;u0trxnxr ootlm  ln s t) rxrxr3ny4lp elicsl( a2tm( pot1aeenmociatfm2rl(mo;u4arxrirctadoatrli il( srtoim3iu4ol e ieilt)artrx o;u4aee mieilsls2rl( ont0trermfctotoaDeanesl( t2urxopoydlme lics tfsDrmx poo0altoiieiltfsDeau p;u4areoxrctadfm ean sl()s2tmio iu4lmtelivtltfsrtrxmo;t1aptomfciyd m ra( o (4treriocoa1fm rlivsl( texriopou1al nlicsas)arrr(mo;o1ape ii3tadfm elnms t0 exomr3iy1faDe i i;t sexrirpny1lptnlfvs ( arta(roou1opeomi3iatfsDuaumo u0 exnmo3totfatrai o s)teurim iu1op elnctas)a2umu o;u4oee  o3tyd s eanmp (4tlenmrcta1lmDraneo () 2xr(r3iudale  netasfsrur(rp;o4opx  feiysla el(mo;() rxoirciydopD lnvo;s  2tm(m oy4opeemfcias) Dta(monu0aex miciatlm2ua(vp u4trermfciadlate uvs;s sexmio3iydlm nlnesatfsDrmurp;o0open o3iltfm2el(mpnt0alxrmo3todoaDrlivils t2xo(o3ny4om nmiesat)a2rax p;t4ole mieiysla2ul(vs u4tltomociodlp  luvi;(0 rxrirpoudol   nctat arrmxrpnt4ope if3tatlmDra(monu4aeenxrcoatlateliesl() 2umio3iu1ol n ict s)srrrumonu1tlxomoeilt aDrmnms;t4texrircoa1fa elnes;s  rumirpny4om   iciat a2ra(mooo0tpenii3ildla2rmn s;t)trerxrctatlp   uvils0trxo(m oo4ap n ivtl(faDrrxrp;t0opx  iciyt m umnmpn(0tetnio3iydoaDrluvo t)texr(o3oudap elfvi (fa2trumpou4aee mf3iytlsDuanmsnt4alxrir oo1lmteaueols) etmim iu1al  lfvta()s2raur ;o1olx moeilsfmDrlu s;(0 eeomo tydoaD aneil()trtr(o iy4am   fesls  2rax  ot4opxomi3iltlsDranvo (4aleoxf3ty1faD  neo;s0texm(r3ny1llt livil() 2tmxmooo1tet  octasla uluvpnt)tltrmf tatfa  luvi;s)t2xmxopnodop emfeiasf rtmxm ;u1tptoiiciatla raump;t)aexnmf iatlm  aivol()t2trxr3ny4al emfctlt  2ua(r oo0oeenmociat aDuaumo t) ltrxf3oa1fmt ln slt srtoim3iu1al nlivt s)aDtmu o;o0tpxn ieiatlm uanmon(4 rtrif tytlmte ueols0 ruoxr nu1op emfvslt  Duru p;u0teeo oetytfs ra( p;(0 etnifcta1la r neo s0srxmxmpnu4op  lnct s arurxm ;u1oet ioeiysfsDrm(ms u0arxnircoatoa e ieol()srtm(o3nu4aptemiei () rrmxrpou0olxoiieilt mDemu p ()trxrxr3ia1fpt  ivs ()sexriopiodoltnlfvt (fa2taum nu1opxniieilt a2um( s;u4 lenio oydlpD aivi;t) rxmim3nu1lptn nctlt  rurur ;u4opto i3iadfm eluvo;u0altnmf tytfm eai i t truoxopiy4op nmict tfartmxm ;o0aetnmi3tlsfaDem(mp (0aeeoio3iytlmteaivslt)trurirpnu4om e iesas  2raxrono1tpx  ociyt aDelu ont4 lxoir3iotfmte ies ()sexrxr3nu1ol elies t)artrurpnt1tpenmi3iasfs rmnvs;t4artrif iodfm r n o t  exr(m3nudap   ivia( a2rmuroou1tpxnmfciyslm ra(ms (4trtnxr tatomDrau o t0s2xrxo ou1altn fvtat)arrmxmo;t4apenifctatfsDeluvont4tlermo3oy1fpDean s;(  exriopnodlmee ivt (fsruau  ou0olto iciyd m ul(mp u4 rxoxocia1fpDelnes s texr(m3iy1lmeelict ( sDuaum ;u0olxnmieilsla2emn p (4aetnif3iatfatrlnvs t0tetrxrpiudlmt  ict s)srta(mp;o0ole io3ildla2rl(ms t)aexrxf iatfmtran o;t)sruo(r oudamenmivsls a2rru  oo0tee  f3tltfaDrmn o u4arxrmr3iadop r u s s  exo(r3nu1lmen nctatfs2rr( poo0tpxn o3tyd mDumnvp;t4 rxnxf3tadom eaieo;t  2xo(m3ny1lpeemfctat  2trumooo0olenioeiytfs2umumo;(0 exriocta1om e nei t)srtoxrpnodope  fvsat srur( pnu0texnmi3tltla um( o;()trtrifcty1fmDr ueo;( setrimpoy1lm nmiet ()s2rr(rpou0altoifetls a2rln snu)trxoir3iotlm eauvs t s2tmio nydome mnvi s  2raxm no4teen octydla2umnmp (4 ltrxoctadomteaiei;(0 rxo(m oy4oltnmnet t  rta( p;u0olx mieiytls ua( pnt) ltnifcoy1fmD  uesls  2uo(r oy4lltemfci t sDtauro;o1oeenifeiydfm2em(vo ()altnmociatom rauvs;t)trxm(opoydlltemivil(fa2umxronu4apxo icilt a ea(monu0 ltoir3tydfatelneo ()tetmim oo4aptnmnvsas  Drr(mo;u4oee  ictltls2raumo t4 ltrxfctotlptrlnvo;t texoirpoo1ome mnvsl(  rua(mpot4opxo icilsla2uan o;(0aleomocta1fmDe nvil(0s2uoxr iodll nmneslt)aDrmxmp;u0apx iictyd aDra(msnu0aexoif3iodlpDrlueilt0s2uoxm no4aptnlieiasfa2taurpnu0olxn iciydfaDrm( s;() lxomociytfmtraues;()trxmxmpio1ope mncsat  rrmxro;t0tltnif3iyt a2rlu snu4arenxfciadlaDelueol(0 rxr(o3ou1alen fcsls)arrr( ooo0teeomociatfm2umu p ()altomf iy1latrlivsl()s2umio io1omen nci ( s2uauront4oetnmfetlt a umnvp;t)trtrifciodopteln s s)texr(rpiy4lmtnlicils)aDururpnt4tlxniietlslmDranvsnt0arxoxoctadom elivo s0 rtoxm3oo1optnmfvi (  2tmx oou0aptnmoeils mDrau p u0aetoxo3ty1lpD  i ils)srumxm3oy1oltn ictas) rtrxrono1apt  ictasfs rl( o t0artrxo iytlp rlu ils0t2toxmpiodome mnet t) 2rau ont0tle ii3iysfm rl(mpnt0alxrxfciatlat  ieo s0 2trxr3iu4amt mfeiatf 2tr(mono0oltoifctyt a eaums ()trtrmocto1fpt au s;t0trxo(o oo4ome lfvilsf rtrx o;o0tlt  oeilt aDem(msnt0altomf oadfmt ln i (  exoir3oydlm e netasf Dta(moou0aexnif3tysla2um(mp u0alxrmo oytomD livo;s0 rtoim nu1lm e ncslsf Dtax o;o0olxoii3iltlmDel( s () ltrxfciodfp e uvi t  2uoxrpiydlpe mfeil()s2taum oo1openmfeiatfm2umnvs;(0 exomr todop  lnvils t2xrxm3nudaltnlivt t srtmumonu1tlx  ieild sDra( s t4alxrmo3oytfaDrlueols  2xmir3iudal   ict (  Dua(rpou4oltoioeiat m2uaumpn(4arxoxfcio1optraies;s) 2xoir ny1amt  fvtas) rum(m oo4opxnmoctlsfmDrlu p t4tetrio tydlate n sls tetoxopiu1opte fet (  2ua(rpoo4alxo fciad a rmnvs;u0trtrxr3iytfaDr neilt)s2toxo oy1lp  lies t)s2truro;u4tpxn f3ilsfs2rl(von()tltomr3ty1lmD li i;t)sexmxopio4ape lfvt s)sDtmxro;t1opxoiocildfmDean s;u) lerxf3oydlm   i o;s)teurim oy1oltnlivtas) 2rmum nt4oetoifeiad a2ua(vo u4aeeomr3iadlate ieilt sexmxmpnu1ol emieiltfsrtr(mp;o4olenioeils sDrlnmon(0 exrxrciydoat aivs;()srtr(mpiu4omee ivtl(  2uaumoou4oltn oeilsfmDul(vs () reoxr tadopD ln i s0s2tmxr iy4lm nlnvt s  2rm(mooo1aleo oetatlmDean snt0 ltnif oa1laD  n o;s) exmiopou1lpt mfcilsf 2rm(  nt1oee mi3ilt sDuln o (0alxoxo3ty1oate uvi;t)t2tr(m nodllen nctlt)aDta(monu1olxomietyt m umnvp;(4altoir oytopt  uvs (0setr(rpoy1alte fvslt s2ta( onu0oetnmf3tydlm uln p u0alxomrciotfm elneolt0t2urxr nydlmtelfvsl( sDtmurpou1texniociyt s2ra(vo (4 lxrxociytlm r nvs s texr(o no1ap elnes tfa2rmxmo;u1olt mf3iytlsDumums;t)trxnmf iodlmDe u o;s) rxr(mpio4lpte icia(fsrrrxr nt4opxomi3ilt a umuvo (4 lxnir oydom eluei t)t2uo(m iu4apenmfvsas srtm(m nu4apt ifeild aDumnvpnu)aetrif tatfm   u o;()s2tm(opny4ap emfcs t aDrm(m ;u4apt  ietlsla uauvpn() rerif3ootomD livols srtmio iudom n iesasf Dtrx p;u4texn fctaslm emnvsnt0teeoio3tatoa ean s s0 rtm(opiy4ol  lfvsas sDrruro;u4tlen feiltfs2emumo t)texoxr oo1latrlivs t)s2trim nodamtelics (fsrtaxmpnu1oet mocilsfm umn p t0 eermr ootfm raieo (  rtoxmpno1lpt lieiltf rra( p;o1alx ii3tldla2eau onu4trtomocoy1fmDeaivolt)s2toio3ny1omeelncs tfsrurumo;t1teenioetaslaDumuvp t0 ltoxo iotlmt ln ol(0 2xrxr3io1ope mncsa(  2raum ot1alen ieiatfa emnms;u4arenifcoadla ean ilt srtrxr3oodllt mncsat  rua( pnt4alxo ictadfs ra(ms;u)teeomf iytlat  neols0t2xrxm oudolt  nvs tfartaxm no0oeto octldlm elu s;() eermrciadoaDran i ( trxo(o3ny1lme livsl(  2um( poo4olto oeiasla eln pnu) ltrio oa1fp e uei;s) 2toxo oy1lpeelnctlt)s2tm(mont0olxomfeils sDulnvo;t4 exnxr iotla eln ol(0trurir nudal   ivia() 2rr(r ;o0tetnmieilslaDum( sn()trtoif oytfpDeauvo;s0srxoio3oo4omte feia(f 2tr(r ;u0aetn fciat s rm(mo (0tltoxr ootfpD  uvols0sexm(opoo4ll e nvsat) Drm(m ou4aleo ictadlmDrmuvo;t4aetrmf3ta1la r iei t tetrxopiu1lmee fvtlt s2raumont4aptnmfctadfs em(msnu4aleoxr3tytfmDeanei;t tetrxo oodopt lnvsls sDur(r ;o0ale  feias s2eanmont0tltrif3iatlmD ln ol(0 rxm(opiudope licta(  Dtm(r ;u1tetoiieilt s2uauvo t)tleoxociytlm elivs;(  rtrxo3oo4lpe lfctatfsDra( pnt1alxnmociaslaDelu p;u)aexoif3iydfmD  uesl(0t2to(m ny4oltn icsat) Duauro;t0aptn i3iysfsDua(vsnu4 ltnxf tytlaDrli o t trxo(rpoudlmt  nesl()a2rmx  ;o4tpeo o3iysfmDua( s (0tetrmo iotfmtelivslt) 2tmxr iu1open ivs tf Dra(ront4alt  fetldfs2em(vp;u)artoxr to1omte ieol( t2xrirpoy4ap  mneiat) 2tmum nt0tetomfciytfaDulnmp;()tlxrmf ta1faD lueo s trtoxr3iodlme mivia(  rta(m nt1apenmfctldfs2emu o u0artnio3to1lmDrai s;t)trurxm3ou1lmen netls a2um(r nu0oltoioctadla2ulump (0 lxoir3oy1lmDelivsls)sexoirpoy1ol   nvsa() 2tr(rp;o4olt moetyt s2um( o;u)tltoir3iatfpDrlues ()s2umxm iodlptemnvi s  rtrxrp;o4olx  fctyd s2el(vs t0 rtoxr oa1lpt lnvs (  rxm(opiodlpeelnvtl(fa2raxr nt4oexoifeildfm2el( ont4aleomf3oadopteln s ( t2trio3nydll elncia(f rtr(  ;u4tptnmf3iat s ulu p t)tlerxf iatoaDr ieo s0 exrxo3iu4omt lnesl()aruaumoot1aeeo oeiys mDeln o (4areriocoy1fm raivs;(  exr(o oy1lpe lfesa(faDumxmo;o0aeeniociat m ean onu0aeenmo ootlpteauvo (0 etoxm no4lmtnlfes t)arrmxr ot4tptnmi3iltlaDumuvs;t) rtnxo3todomt auvil(0s2xoxopoydole mnvs (fa2rm(ro;u1tleoif3iasla2rlnvs;(4teeoir iy1fat  n s ( srxrio3oy4omtn nciat)aDtr(r ;t4tpxnif3taslmDemuvsnu)tetnxo3oy1fpDeau i;t trxoxopno1am n netls a2urum ;t1tpt  feiytfa ran snu)altomf3iotfptrlivs (  2xmim oy1lle mivsls) Dta( ont0oltnmf3iydla rmump u)aetnmr3tatfate uvilt t2tmim3io1opte netlsfs2rm(mpno4tpeomocildfm rlnmsnu)aexrmf oa1op  aivilt srxmxo3nydam n nvilt sDrrxrono0tptn ictasfs2el(msnu4 rtoxo3iytoptrlu o;t) etrxo ou4al n ietat  Drr(  ou4tpxo ociltls2emu s (4 rtomr iytlpDeli o;s t2xoiopiy1ale  ncsat) Dua(ro;o1oeen ietld s2ra(vs;t4 rxnmr3iotlpt lueols0 exmir nu1olenmfesl()aDur(ro;u4oltniictatls rau sn()altnxrciytop  aiesls  rxm(mpiudlp nlfvtltfaDumu pot0aleoifeiyt a2ra( s;()trxoir tadfmDrlu i;s0 eurim3iu4lpenlietls)arrmxr no4aeen i3ilsla2ul( o (0tlenir3tadfm   u i;s0trxoxm3ny1altelfctlt)sruau o;o1tptoiietysfmDeanmsnt4 etrmoctatlptelivo t0 2trim io4alte fet ()arrmurp;o1oexnmi3tyd aDul(msn(0aetnir3iy1lat lnvols0 eumxrpiodlm  mfcsasfs2tr(moot4alx mi3iys mDum(msn(0 leoio3oatfate n o t) euo(m oodale mnesas s2umumpoo4olxoio3tltlaDrl( p u0 exomo oy1fp rlnes;(  rtr(rpnodale  fcilt a2umu  ;t0ole mfciasls ran s;t0texomf3totopD anvi t  2uoxrpou4lmtnmictls)arumxr ot0tet iicilt m2emnvp;() lenxf3io1om e i i;(0s2xo(o no1alt  nvt (  2uaxrono4oeeoifeiaslsDranvonu4 renmr3iodoa  anvi s  etmxo oy4alt mivsls a2uaum ;u4teen feiltfmDra(vo;t4texomf3oodlp eaiei t0t2tm(opiydam elncs t) rrr( p;t4optn ociytfm rlu s;t0 rerir3tydomt au il()s2uoxm nu4ame mncsls)srtmuro;t0opt ii3iatfm ra(monu)arenio oo1omDeaieo t0trum(mpio4apeelncsa(fsrtrxrpou4ope mo3iydfaDrmumon(4altrif iy1fmDrlivo t)srtoxo3iu1lpeemfvsas  rtmxmp;o1tltoifciltfa eanvs;(4 exrmo3iatfmt  i o;s trtm(m iodope mietl(f 2tm(mooo4optnmoeildla umn o t0tetrir tatlmDr uvo ( trto(m oo1ap nmfetls)s2umxm ot0tptn feiat sDumu p t) exrio3iydla  livi (0 2um(mpoodllt mnesat sDtr( oot0opeomocilsfa ran snu0tlxrxrctydoa r ieolt0tetmiopiu4apt lncsltfa2rmxm oo1tee  i3iys a2uaumpnt) exoif3ty1lpt lnvs;(  2urimpio1aleelnctat)srrmu oot1optn f3iasfsDranvs;t) rtoir3oatlatrlivs t)s2urxo no4open nvs s)s2tm( onu1tpt moeiasfmDra(vsn(0alenmf3oatlmtrln o (0srxoxmpou1omeelnetltf 2rm(r nu4apxn i3tls m2el(vs;()tlenmr3totfp  lu il() etmiopio4al e fei t)sDta(mo;u4aex ifciytlm em( on()artnxr3iadfpt anvo;s) 2xmxmpoo4aptemics tfsDtru  no0alx  oetasfaDum(msnu0trxoxo oo1fptelueolt teumimpoo4ap emnvsl(  rrmur ;t0apxoioeilt sDumnmp u0arerir oadoateaneo;(0 ruoxm oodalenmiesls)srtaxronu1teeo ictldlaDrlnvpnt4teeoif3oytoatr uei;t srumim iudlmte fvtl( srtaxm no4alxo ieiydfm rl(ms ()altoxo ty1fm   i o t  2tmimpnu1altemfesas aDurump;t0olto iciatfa elnmo;u4aeenio ootoaDrlnvslt) rtrirpiu1ol n fcslt  rtru poo4oltomi3iltls2eln s t4 lenmrcia1fmDrlies () 2toir3no4ol elneia()sDtr( p;o0aex micildfs2el(vp u0 etomfctatlp rlu i ()tetrxopiu1amt lfcia(f ruaur ot4oex iociytfs elnvp;(4aeenif3todopDrln o;() 2tmxr iy1op  lietlsf Drax  ;u4apxnifeiltlm2elnvp t)aleoxo oadopt au i s)seto(rpoydamt  fetasfarum( o;t4alxomictydfs em(msnt)alxnxo3iatlm rlnvi;t teuoir nudlmt mnctat s2rm(rpno4tpxo feias s2umuvs;t0aexomr3tytfatrauei ()trtm(opoodaptemnvi ()arur(ro;u1oleomoetysfsDrl(vsnt0 etnmo tydlmDe i i s0seto(m iu1apenmfei s)a2ur(rp;u0aexomf3tys s elu ont)treomf3iatomteaivsls texr(o nu4omt lfeta()a2ra(r ou4tetnii3ils aDelnvs;t) eeoxf3iadlm eaueo ( teuo(r3no4al nliesa( srtmxr ;t4altomoctadls2rl(mont)trenxf todop   u i t0seuo(mpiodamtnmicsas)artau ont4openio3iytla2eau o;(4trtoio3tadlatelues;()s2xr(rpou1oltnmnetas)sDtrxmp;o0optnmi3tadfsDuau ont) eeomo3iatop   uvs;(  rxo(m3io4lmt mici sf 2uax ont4oltomoeiysfa2raump (4 rxrxo3iy1fa e u o;(  rxmiopou4lptemicsa( srrm(rono1tetnmocilslmDranmo;t0tltrmrctytlaDrlivils0srxm(opno1alt lics (fsrtaxrooo0aexo ictasfs2umumo (0altoir3tydomD auvsls t2tm(m no4lm   iciat)artmumpot4aptomfcilsfs emums (0 etrmrctatlmDrliei t) rtoxmpoudaltemfes ()a2rmx pnt1ape ii3iadla ua(ms;u4 ltnxr oa1oa  au i s) exoxo3ou1olen iviasf 2raurp;o1teeoifetas mDrmuvp;u)artrio todoaD  iei;( trumio oo1amtn ictlt)sDum(  nt1altoioeildlaDeanmpnu4tetomfciodlm r i il(0 2tm(mpoodoltelnvias)artmxroou1altn o3ilslm2ra(monu0trenirciydlp  aneslt trxrxrpoy1ameemfes ()sDurur ;t0aetomoeilsfaDua( sn(4 rxrmoctotlp elueo;s trxm(m3iy4amee fci ( s2rmxm nt4aptnmoetldlm2rlnmont4trxoxo3tatomDeluesl(0srto(m oy1ol elivsat)a2tr(rpoo0tetnmf3iysfaDrlnmonu0aetoir ty1op eau i ()t2trxmpoo1opt lfcsas a2tm(  ;o4apenifeiytlm rl( p t4trtnxr tydoatrlues ()teuoxmpio4al  mncsas  rtm(rp;u0alx ifcild a2ranvo u)artoxo oo1laD ln sls0s2uoim3iydal nmfcils)arrrxrpou1altnifeiyd m2eauvont)alxrir3iytom raneo ()tetr(r ny4amt lnct t)srrm(rpot0tetn ictyt s eanmsnu4tlenmrcoo1fmDe uvs;t texoxmpnodlm   fvil( artrxroot0tpx iieildfm uluvp;(0trtoir oa1lmt au s;t0s2xm(o3oydol emicsa()aDua( pno4aexnmf3tldlaDumuvont0 lenif ta1lateai o;s0s2tmio ou1opt mfesas)sDurxmont4olx mo3tls s2ra(vs u)arxnmf3ta1op e n il(0tetoio nu4amee nvsa(fs2uau oot1apx mietydla2um( p;u4teerirciytoa eaivs;s)truoirpiu1ameemnvslsfarraum oo4opto oeiytlm ulnmpnu)aexnxo tytomteluei t)trtmxm iodom  livs s) rur(rpno4alxoioeiadfmDel( o;t) rerxfcoatlaD ln i;t0trxrxopiu1lleelncilt  Duru onu0oexo icilsfaDea( sn()aetrxr io1fm  aies;s)s2ur(r oydamenmfcia()srrmur ;t0oet mfctltfm2emuvpnu0 lxrmo3iytfaD lies;s trxoxm3iy4alen nct s)a2umu poo1apto i3iasla2rauvpnu0 rxrir3ia1oaDr n i;t  2tmxm3iydap nlfviasfaDtrumpoo1oex miciatla uluvo;u0 rtomf oytopD anvs;s0 exoirpnydalt mivtas)arraxronu4oeeoiociydls2ranvp u0aeenxocoatoa   n sl() 2umir3ny4alee fvtas  2uaxr ;t4oeeoiociydlm el(vs;t) rtoxo tydopD  n o t0t2ur(m iu1amtn ivsasfsDtr( ono1oee  iciatls2rlu pnu0tlenmocootlat  i i;s) 2xoimpnydap nlnetlsf 2taxrpno1oexo ocild m2ranvp;t4tltnxr3tatfmt  i i;( t2ur(o ou4ap   nviatfs2um(mpot0oeeo o3tyt a rm(mp;()tleoxrcoydomD  u sls s2uo(o nudolt  icsasfsDur(m ot0oexnmf3ias a2uan s t0alermrctatlmt  ieo;t0 etrxrpnodlp   ietasf Dtrxm ;o4opt  fcils mDeau snu0 eenmf3oy1fateanei ( srur(r3oy1al e nvsltfsrur(rono4alxoiieiysla ulu s;t4artnif iy1lat an ilt) exmir iodlptelivt sf 2tax  no0altn o3iys a el(vsnt0altoircoa1faD an i;s0seuoxm3nodolen fct ( a2rrxrpot0oeeo o3iaslmDeau o t4 eerir3ta1faDe ieo;t0 rtr(opny4opeelfvsltfsrua( pnt0apxoifctld a2rlnmp (4altrxo3ia1fatrliei ( tetmiopoy4aptemfcsls srrauro;t1tpeo ociydla2elnvpnu)artoxrcoa1fat aivi s0teurir3oudlp   nvslt aDur(ro;u0ape  oetasfaDua( o;u)aeeoifciodfaDelivs t  rumxo oy1ol nlnetasfarrrurooo0oee mi3iat s2emnvp u) etrmocio1oat  neo s)t2tm(o3iudomee ici s a2rm(ront1aptoio3iydfs elu o u0alxnmfcoy1om  an s;(  rto(r nodlmenmfesat aDrmxm no1opxnioeiytla emums;(4 renxr iadomD aues;t)trtr(rpiydameemnetls srtm(m no1oex ifeiasfm2ua(vp (0tetrifciotopDe u s;t sexm(o oo1om   nesa(  rraxm nt1apxnif3tyd sDeauvs;u)aetoif3tatoaDelu i;t0srtmxrpio1llee icil(f Dtaxrp;u0oet mf3ildlmDean o;t4texrifctytfmteaueo t  etrxmpiudlme micsl(f Dtm( ono1optn oetltlsDua(msnu)arxoio3oy1faD  ues t)setmxmpou4ole lnet s)artr(rpno1oetnmf3ilt s2uan pnt) eermo3ta1oat lneo (  rxrio3iu4lm n ici ()aDumxrpot4optnio3iydla rm(msn(4altnir tydopt  uvil(  rurio3nu4lp e ivil()a2uaxmont0tpt if3tldlmDrl(vs (0tltnmf3iydlm rlivs;s0srxrxo oy1omee nviltfarrmu pou4ole iieiasfa2ua(mp u)aeeomr3ta1fptrlivilt0trxrio ny1ol emncsl(fsrumxr ot4tpxo f3taslsDean p;t4teenif3todlmD lueo s0sexrir3ou4alt mfcilt)srur(r ot0oex  iciadfaDeaumont0texrircoodlmDrlieols) rumir3iydoltnlfctat a2rm(rpot0oeeomf3iatfsDuln onu0tltoxo3iadoptrai i s)truoxopou4amt  fet ( s2taxmpot1tpeniictltfm2eln s t)arxnxr iodfpDeanvo;s s2xoim nu4am n nctls) Dtax oou4oleo iciyt s emnvo t) renxfctydfpt  ues t) 2uo(mpiu1lm n ieta(  rur(mont1aexo ieilt a rln pn(0tetrmocoodlm rlnvols  ruoir no4opt  fesl()artmxro;u1tpto ociad a emnmpnu0texnmfciydlatrlu sls s2umim3oudamtnmivils)srta(m ;t1optn ociytfa rau s;()arxoiocio1fp rlnvi;s)srxrxm3nu1lltemfeta()a2urxro;o4ape moetatfm2rluvp;t0aetnmf tatlpDrlnvol(  2uoir no4omenmncsat) ruaxm nt4olxn o3ildlaDuau o;(0 etnxo iy1fpDrlueo ()t2tm(o3oydlme lfeia( aDumumpno1ape if3tytls2ra(vs;t4treoxfcta1omD li o ( t2xr(o io4ll nlneil()a2trur oo1tpeomieilt m eanms;u) lenmf3ia1fpDelnvs s) rum(o ny1lptn fcsa(faDua(mpno1altnifctls s ulnvs;u0 etoxrciy1oaD anvo;s  2trxo ny4ol e ietlsf Dum(mp;u4aeeomiciyt m el(vonu)trtrmf3tatfpDe i i;t0sexrimpny4ol  mivi () Dra(mono1oeeoioeiytfm2uaumont0alxniocia1faD aivslt)trxrxm iodlp emicils sDrmu ont0apeomo3iadlm el(vo;u4tleomo3oytfa  liei () eurxopno4lmt livs s  rtm(m ;t1tlx moctyd s2ea(vp;u0aeerir oatfmDeai ils0tetm(o3ny4llt  icta(fsDtaur no4oeenifctlsfs2umnvont)aetoxrcto1la   ues;t setoxm3oo1opeemivi s)s2tm(rp;t0oexnifeilsfs2elu p;(0 rxrxo3iatfmDelues;(0srxm(opio1lpenmfvs s  Drru poo1apt  o3iad a eauvo;t)arxoir oadomD aivi;t0setoirpiodllee ieilt arumu  ;t4tptomoeiys m emu on()texnir tytfatr ivi;( srxm(r oy1omeelfvilsf Drmx p;o1tleoiiciad s ulnmo ()artnmo tydfmDraneols  exmim iu1omtn fct t) Dumumpnt1tptnmi3tad a2em( o;(4aexoxocoodfp elneol() exmxm iudomen fes tfaDtm(  ;t1olt miciasfm elnmo;() lxnxr to1oaDran i;t) 2uoiopno1openlivsas)s2trur ;o1tlxnmoeiltfa rmums t) etrxf3oy1fateln ilt)sexm(r3iudlmt  fetlt artr( pnu1aeeoiietysfa eanmonu4aetrxo iy1fp eau s s srtm(mpiu1om emnes (f Dum(  oo0tlxnmociys sDea( pnu)tetnmocoodlmt luvol( trumim oo4oltn fetlsfsDua(  ou0aeenifciasls2raums;(4arxnmf3oo1fptrlnvolt  rtrxr ou1al n ict t aDuaxmpot1oeto iciytfa2rm(vo t4aexnmr iodopD luvo;s srxrimpiu4am   ivils)s2ta(ro;t4aeeoiociat aDea( pn() rtnir oo1faDe ivo t) etmir3oy1lm  mnetatf 2trurpou1apx  o3iadfs2elnmonu0 rxnifcoodfm ran o t)t2tr(rpiodapenlnvtlt s2rmx  nu1oeenioctls m2eluvsn()arxnxf3ta1lmD luei s srxoxr3nudamenmneslt  rta(m ou0oeeniociyt a2umnvont) eenio iydlp ranvol(  eum(o3iudopen nctat arum(rpnu1tpe if3iadlm emnms;()artoxf tadfmD  i ilt setoxmpiy4apeelivsatfa2urur oo1oexoifcils a2eanmo t) lxrxf3todopteau ol(0truoxr3ny1alt  fvtas)sDuaxm ;u0oltn oetlsla2rm(vs u0 etoxocoydfm e uvs s setrxo3oy1amt  fci tf Duaxr ;o1aeto icild a2eauvp (4 exrir3ootlmDeai o t0s2uoxm3io4omt lnvtl( a2umum ou4optomieiatfsDeau onu)tlxnxr oytlm  livo;t setr(o ny1op  liesa(farrrurpoo4tlxnmiciydlm rmn onu0 ltoirctotfmte ueo ( t2xoxm iy1amtnmncsasfarum( p;o0altomfctaslm2rm(vp (4alxrmf3to1lmt  uei;s) 2umxr3ou1lptelieia()aDua(root0tlenioeiydfsDeau p (4 rtomo3io1fa e uesls)trxrir iu4apenlfvtlt) Dtau pou4tet moeiat m2rmu s;() etriocoydfatelies (0s2ur(r oodlpenlnes sfa2rmx o;u1tlen o3ildls ua(ms;u0tlerircoytomtrlnei;s  exo(m3io4ol emfeil(f Dtr( p;o4texnif3iad mDumn s;(0aeeoxf todlp eai i;s) etoxm oy4al  lnviltfaDumumont1alto feiydfm2umumsnu) rerxr3todoaD li i;t) 2trxm nudamt licil() Draxronu4aeto fctasfs2ea(mo;(0 rxrxo3totomt  n il(  2tr(rpnudlpee fetat)a2tm(rpnt1tlen oeildlaDumuvp;(0 etnif oatlaD lieilt0 rtmimpoudoptemiei ( aruaumpot4olxomieiadfs elnvp;t) eenxfcoydlpDr n s;t s2xm(r3oydole mici ()aDur(rpou1tlenmiciyd s rmuvs;t) etnxr3to1opt lnvols0tetm(rpoo1lmee ncia(fa2rrxmoou4oleomociasfa2el(vpn(4 etomf oodom r i o (  rtm(m3nydll nliviasf Drau ono1tpxoifeils a rmnms;()aeerir3iotlmtelues;s t2urxrpny1am  mncsat) rrax pou1oeeo i3ildls2ulumo u0 rerxo3to1fpteau sl( seurxm3iu4alt  ncsls a2rau p;u0ape mf3tydfaDrlumo u0 renir iatlpDrlivs;s trtrio iodoltemfeias sDtaxmono1aee  ociat mDumnvonu4tlxomocty1om  anesls0texr(r nu4altelictltfa2rax onu1aetnio3iytla em(mo;u0arerir3oy1lmD an i () 2trim3oodap  lici (fsrtmxmpnu0apen i3iyd s2rmuvp;t0teenio3tadlp eaivi;s)texoim nu1opeelictltf 2tax pou4tee mf3tltfs ua( s;t0tlxoxf3iotfaDrlnvils)texm(r3iu4lltemfeils sDuax o;t1opt  ociadlm2ulumo u0 rxnxr to1lmteauei;t) rtoimpoy4ll emnvtl(fartmumont0tpeoiiciasls2umuvsn(4aexoif oytlaD  uvs s)s2xr(m3iudll elnviasf Dtm(r nt0aee ifctlt aDrmn pnt)aetoxfctotfmteauvsls0 2uoiopiudlmtn nvt (fsDtrxmpoo0apx mf3tat s2umn pnt4arxomfctadfa  lneo () etmiopny4lp nmfciat sDurxrp;o0tpenmo3tatfsDra(mpn()arerxociytlaD lu s;t  rurir3oo4olee ivs ( aDta(mpnu4oeeoifeiys m2rluvo ()alenxfciatlpteanvo t t2xrir iodaltemivt (f Dtmx  ot4tlen fetlslm rmump u0arxnio3oytfm eluvo;s0 rtmxm3no4opee ici sf Drm(  ;t1tetnioctyt m rmu s;(0texoircta1omt  ueo t) 2trio3oo1openlivs t)sDrrxm ou4alxomo3iys aDea( s;u4 rxrmf iydlpDran s;( tetmxo3oy4llt mivtlt sDrmurp;o1opeomo3iyt a2ul(mp t0 exnifcto1la rlu o t)texoxm3iy4op   nvsatfarrm(rp;u4texnioctatfm2em(vp;t) eerircoadlp raiei;(  exm(o ny4ap emnvs (f 2rmx ont4oetomictyt mDua(ms u0arenxf3iydfp eanvs;s)tetoirpno4lm nlfesas)a2raurooo4texn i3iysfs um( pn(4artnmr iytlpDe nvo t trtmxmpnudaleelnvsl(fsrrrum ot4oltomiciaslsDrlnmo (4tlxomf oodfp eaivo s0 rxo(o3ny1ome  nesl()srra(r ou4tlt  i3tydla2uln sn(0 rxnir iy1lm elueols0trxmim3oudop   ivtl( s2tr(  ;u4opxo iciytfmDemnvsnt0 reoir oadlm rln ol()teuo(m3io4optnmieiat a2raxro;u1aeenmf3tasfa ua( s;t0alxomr3ia1lm   ies t t2xo(opiydlpt  ivta(  Drrx p;u0oex  f3tyslsDulu p u0tetomr oytfm e u o s0texo(m no1ale  ncs t)s2rru p;u4apx iieiatlsDuan p t4 reoxo3iodfm   i ols  rxrimpoodome  fcils aDrmx oot1apeniieiytfmDrm(vsnt)aexnmrciotfpD aues;s0 rurxr3oo4lmen nvsl( sDtm( oot0oltnifciasla2eanms;(4tltnxf3oytlp rlueilt sruo(o oy1apt  iesa()a2rmu  ou1alx  i3iasfmDel( p t4alxnxfciydop r neols0trur(rpiodlmee icslsf Durxm ;t1oexoifeiyt s ul( o;(0aeeoir3oy1fmte nvs;(0 2toio iydaptelfvs s)s2ta(m ou4tetomictlt mDrlumsnu0tetnmfciatlpDeai il()trtrimpou1om n fetl( a2rm(roou4tlenioeiytfmDulu on()arerio to1fmDrlneo;t) exmimpoydlmt  ivil(f rurxmp;o1tpx ifeiydlmDelnvs t4aeerxo iydfat lueo t0t2xrxm ou1al emfcia( sDtrxmonu4apt mo3ilt s2emn p u) ltnxf3totlate n s;s tetoxrpoy4ape lnei t)srumump;u0olto fciytfa rl(ms t4alerif3tytfa  au ilt sexo(mpiy4al n iesas)srraxrpoo1tptomoetlsfa emums ()aeenmf3totoa raivslt)srtrxo io4omtemieils sDrm(r ;o4oeen feiytlmDuanmp u4 lxomrcio1fpteaiesls) rtm(m no4lpt  neias  Dtaum ot0tpen o3tad a el(vp;t4 rerxo3tatla   ueo;t0texrio oodll emfct (farrmu o;t0ope  fctlt mDran s u)altoxrciytoat  uvs;(0s2uoir3iodlm   fvsl() rraurpou4alt miciat a2ranmo;()trtomoctotoatrlnvo t) 2xr(r ou1omte icsl()s2trumo;u0optomoeiysfa2emnmo;(0alerxfctydfatr ueols)srtmim ou1op n fctas)a2rmx  oo4oltnmi3tasls2uanms ()texnxr iatla rlnesls srtoir3oydam emnvs ( s2tmurpoo4oet moeils m2emnmp;() lxoxf3tydoaDe i ils0 etmir3iu4amen fct s)arum( oou4tetnmfetyt a2ra(mp t0trenio3iodfm  lnvi s sexm(mpnydlm nliei (fsDta(  nt1tltnmoetasla uan sn(0tlerxfciatfa r u s s)sexo(o iodop elfetlt  2urumonu4tle 
\ No newline at end of file
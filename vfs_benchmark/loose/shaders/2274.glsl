@@ -0,0 +1 @@
+iei s)trum(o3ou1om   icilt)aDrrxrpnu0ope mi3iadfa rluvpnt)aeermfcta1lpD lu olt sruo(r3iudop nlncs ( aDtmurpot1tptnmociydls em( s u)tetnmf totom r u o;s)setoxo ou4ap n nvi t  2taxm ;u1olxnmoeiyt m2el( p;u0aexnifcoydomDe ieol() exrio3ou4lp nlncil() ruaxmpou1aexomo3tlt m elumo u)tleriociodfpDe i i (0s2xm(mpnu4lltelfesat) rtaxr nt4alxniociyt a uln snu0aleomfctydlp  an ilt0s2um(opnu4lltelneiasf rrr(mo;o1tpt  oeildlsDum(ms (0aexnxoctotlp rlueo;t0t2tm(opnu1ll elfvsl(f rururoot4oeeomoeiyt m em(vpn() eeoxociy1op rlu o t)sexm(r iydllte iet (fsDta(m ou0open fciydlsDuln o;u)altrmr oadlptr ieil( s2umim3io4om emieil(faDtaumpot0oeen i3tlt a2rmuvo ()texoxo ta1lpt aieo t s2xoxm3nudlm  lfetas)sDua(m ot0aptoifeiatfm rmnvo u0 exrxocto1lm  ai sls0 exm(rpnydll n nvt (faDtm(  nt0tltnmictlsla umumo;(4tetnxo tytlpD livi;() exr(m3io4lmenmivs tfs2rrum ;t4apx moctlt a2uan p;t0tltoio3to1lp  luvs;t)tetrxm oy4ope  iviat sDraur ;o1tlxnif3tldfsDulu onu4 eerxrciy1lmtr nvi;s)t2xoxo3oo4llt lfcsas  2tau pou4opxomf3ildls rlnvp (4alxrxf3ootlptelueo (  2toio ny1ome livilt) rurum ;u1opeo oeils s2emu p;()alerir3iytopDranvo t texr(opiu1op  mncs (  Draurpou4tpenmfetydfa2ulnvs;u) ltrmf tadom  lu ilt0srxo(rpny1ap nmiesasf rraurpnt4aet moetldfaDumnvo;u4trxomo3oytfatrlnei;s)srtmio oydlp  lnctl(faDumxr ;t4tpe  ocils mDrau sn()trtoifciy1lmDelnvs s)tetrio ou1aleemneslsfaDrrumono4opxn ieiad mDua(ms;t4 lerif iodfatr neo t) ruo(rpnodam   icsls)srtmx o;t0olxn ociadla rl(vp (4 lxnmr iydoatrlneo t0 rurxopou4opeelfcs tf Dumx ooo1tlxnmf3iatlsDraumo u4tlxnioctytfpDrln i;()s2tmimpiu4lltelivt t aDrau  ou1oetn f3ildlsDrlnms;(0 exnmfctatlm e i il()t2umxm3nodale lfcsas s2ur(rooo0opxn i3iydlm emnvp;(4 lxomo3iytlmD  ivsls0 rtmxo iu4lpee fvilsf ruaurpou0oltn oetyslm2ran s;t0tltoir tadfmDranei s)seto(o iodolee nvtat sDrr(r no4tpt ifcilt s rmnvp;(0tltrxo3iytlate neilt0teur(o oy4opee fvtlsfs2trx  nt4oex  oeiasls2umnmo;u) rtriocoodoaDran s;s0 exrxo iu4lp nlncsl(  Dta(  no4tpeoii3tasfa ulu o u) reoiocto1opt ai o t t2xmxr oodalt mfviat a2rrx  ;u1oet if3ias s ulumo t4 ltnirciy1lat luesls trur(mpou1lme lfcias a2rr(mpnt4ole  f3ilsfa2raums;t0tlenifcoy1oaD luesls0texo(rpny4apen fvsls) 2rrxr nu1tpt moetydfs2eauvo;u)tlenirctodfaDrli i t0 etrxrpnu4ll  lnvsltfs2umu ont1optn o3tlt mDeauvo (4 rxoir3oydfm elueolt)srurim no4lp nlfctat)srtmxrp;t4tpt mf3iaslm2uau o;t)tetnircoo1lmD luesls)s2uoir nydamee fcs s)s2tmumont0oleomictlsfa uau snt) lxoxo3oytomDr ues;s)tetrxm3oo1ap e ncilt)s2urxmo;o1oltomoeiytlm eauvs;(4teeoir3oytoaDrlivsls)seuoxopio1lp  mietat)aDurx  ;t4olxnifeiad s rlumsnu4 lenxrcoy1omteaivilt)s2xmxm3ou1llenlivslt)aDtm(r ou1alen fciysfs2elu ont) rtoxr3tytla eaueol()teumim oy4llt  fcsasfs2rruronu0tpt mieiyd a2ulumo;(4aeenmfcia1fat aivs;t  rtmxo iodam emivslsf 2ur(mpoo0optomieildlm rlnvp;t4alxnxr3ootfm e uvolt)srurxopiy1oltnmfvta(f Draxm no0oexomieilsfm2ua( s u4areoxfcoo1opDelnes (0trxoxr iy1ale  nvia(f 2umxm ;o4aex mo3iysla2rluvo;(0tlxnxo3ty1la   ivo;() exrir ny4ome  nvsas srtmu pot0ole mf3iydls2emu o ()tlenir iytfmDrauvil(0tetr(rpiu4ale mietl()arraxront4oexnmi3iyd mDuln sn()tltnxr iadomD li ols sexoxm nodop emictatfa2umumpot0olx  i3ilslm rln o;t) reoxf3io1lp e n o (0srtm(rpiydop nlfvilt) Duaxro;t1optnio3iydlm2elu s;u4trtrif ty1omte ueo;s  eumxr iydam emicsls  Dur(moot1alenifciadfm em( s t0altoxr iytfatrlnvi;t0truo(o oo1amte ics s) Dur(mont0olx mi3iydla2ea(vp ()texnxo totom  aivo t0t2xmiopiydll nlneia() Dtmu oou4alen fetyd s elu p;t) exnmociodopD  neslt0 2xrxo3ny1ll   net s  Dtaxr ot4tpxomoetatls rmuvs ()altrmfcty1fp  aivi (  2uoim3nodlmtelfetl() rtaxront1opxnmfeilsfmDem( p (4trxomociodfa elu s ()trum(rpoudlp nmfctat)s2taumono4optomoeils s2ra(mp;t0tetrxo oo1opDe u i;s srurimpoy4lltelnvtas aDrmumpou4opx  iciat m umnvonu)artrio3tatomteai s;t0s2urir3nu1amtn fct tf rumurpnu0oleoiictyt mDea( on() rtrmrcoodlm r nvs;t tetoir3no4lptnlici () ruru  oo1altnifeiatla ul( pnt)aetrxfctatlpDe n o t)s2xmxr3ny4olen fvt ()s2ra(monu1oetn fciadlm rlnvont0trtnxr3totoa eliei;(0 2umir ny1lle mfesatfa2ururono0aptomieilsfsDul(mp;(4texoif iadop r u s (0texo(m iy4ap e nvtl( srtm( ono1oexnmfctydfa eanmp t0 etomo iotlm e ivs;s0s2xmxr oo4al  lnetas) 2ta(mp;t1ole  fetytlm2emnvo t) lxrifcto1oaDrlueo t)seuoio oudol  mivsl()arua(ronu1aptnmo3iltfs um( s t4trerxf to1fatr i il(0 eur(m3ny4apee ivtat)aDurumpno0tpeoifciysfm ran p (4aetrmfciotlaD  u o s  exm(m3iy4aptemiciatfaDumxmont1olx mietadfm2rm(vo u0 ltoxr3iadomt auvi;t)trxm(o iy1op emneilt) 2tr(  nt1tee  oeiysfa2rmumonu)altoxr3tytla e i il() 2urxr oudlltnmnci s  rumur ;o1tet ifciydfm2eluvp;t)aeenif tytoptrau sl()t2tmxm3iodll nlfvsasfs2rr(r ou1aeen ociadlsDemump;t)tlenio3iodoa rlivs;( t2urxr3no4lmt lnvt t aDtrur ;u0olxo oetydlmDumnmo;(4 exnxf3oo1fmt aivo s0 rxm(r3no4ale  nvi t  rrr( o;t1olxomociltfm umu o ()tleoir tydopte nvol(0truoxo3iydame  ncsls arrrxrp;o4oetoifctasfm2elnvonu)arxnxfciytopD livols)t2xrir oy1am  mfei (fs2rmxmp;u4aptn i3tytla2el( o;t4 eenmrcoy1oatelnvo t)s2xo(mpiy4lmeelfetlt  2tmxrpoo4oet  ieiltla2emumonu4tetrxr3ta1omD  uvi ()sexrxr iudame mfviatfaDtmxr ;t4apxomiciltfa ulnvo;u)altrio ty1lp eanvo s srum(m3nodlm e nvil(f ruax o;t4apenii3iyt sDeauvsn(4alerio oydlmDeaivi;t0 rxoim3no1amt mncils) 2urxr ot0tlt  i3tldfm2rl( o ()tlxrxo oadlmteauesls trumxrpny4apeelfes t  2uaxm ;o0tlxnio3iltfa eau p;u4 eeomo3io1fp e i o ( teumxr3nu1oltn neiatfaDrmx poo1aee ioctasfa2umnmp u4 ltnmo3iydfmt  n ol()trurxmpnydap   ncsltfarraxmpno1apeomoetasfsDumumont4 rtnxo3oo1lmDrlieols)trtm(r3oo4alee fcil(fartm(r nu1olen oeiltfsDrlums;u4artoif3todoaDr i o;t) rtrxm nu1ll nmivta(fs2urx pno1aexo ocils aDrm(mp u) lerxf to1fm rai o (0 euriopoy1lptn fvsltf Dumx p;o1oet  ieildfmDrm(vp t4texnmf3tydlpDrau i;s setoiopnu1omte fcil(  2ta(r nu1aeeomieilslaDul(vp;(4aexnmociadfa  lu s;(0trtmio3iydamtelfet (f 2tmxr ;t1oex  ociad aDranvp;t) exrif totfp   uesl( seurxmpoydamt mfvs tfa2tru ont4aeeo i3ilsfa el(msn(0tlenxf io1lpDelivi t)sexr(m iy1alt  nctl(  Dtm(m ou1apeoioetls a2umums;t)aexrmf oodoateaneol(0 exmxr ou1lm  mnctls srtmum no4oee iicildfsDrlnmsnt0teenif oatoatrauei;s0 2tr(opnudlp emncs t  2rru ooo1texoio3ils m2rm( p;u) etoio oy1la eanvsl(  2trir iy1amee netls srtrx  ;u4oee  feiytfsDrlums;t) ltoxf3oodfptr iei t)tetmxm ny1amee netls srrrumpot0ope mfeiatlaDrauvsnu)aexomocoatlat lu i;t0t2uoxmpio4op n ictatfsDum(mpot4apen ictytls um(vo;()tetrir3todfa  li i (0s2umxr iudaltn icsl( arra(m oo1opxomfciad m2rmuvo;u)altnxo3oytla  au ols0 2tr(r3oy1opt  iciasfsrrmx  ot4oltoiicildfm elumon()aetrmfctodfm eaivsl(0 rxm(rpiydolee ivilt arraxmpoo1oet ifcildfa ranvsnt)texnmf tytlmt aivo;t setmirpio4alte iei tf rtmurp;u0tpt  ociasfa2ul(ms;u)texoxr iadoat  i i;s seuoxm nydal  lfvsasf Draum ;o0optnioetysfa2ulnmo;t4aeeoxo oodop e u o t sruoxm oo1lmtemnetat  rrax p;t1aexnmi3iadfa2rmu p u4tltrmo3io1fmDrau s s) 2xoxr oodlpen ietlt sDumxmp;t4oexoioetldlm2ra(vp u) ltriociytoptranvs s0setoxr ny1lpt lnct t arrm(mpot4oeenio3iys a emu o;()altomfcoydlmDeau s s0texmiopnodopenmnes tf rur( pou1alxnmfctlslm2rmnms;t4trenmocoodlaDeauvo t0 rtrxm3iudalt mfvi ()srrmurpno0olxn fetyslm2rauvsn() rxrmr3todlm   uei;t)srtr(o3ou1op n neta( s2taur nu1tpenifeiltfs2uauvsnu4trtoxf iadoa eauvo (0 rtmxrpnu4lptn ivtls)sDrrxrp;u4tlx ii3iltfsDrauvp;u)aetrio oytlp rau i ( sruo(rpoodom e icsat)srtaum ;u4tpt if3tys aDulumpnt4tleoxr oa1fateluvs;t)t2xmir3oy1ol   fesas s2raxr ;t1oee  i3iat m2umn s ()artoio3iadfp  lues;t  rtm(o3nu1ale licia() rta( o;u0tee moetys a rlumo;u4 exnmr oatlmte uvslt0 exm(m nudoltn icsas arurur ;o0oltnmf3iltfaDuanmsn(4tlxrir3ia1fpteau ols)tetmxo3iy1omee netltf rta(mpno1tetoif3iatla um( onu0 exomr oy1fp e nvo s0sruoxrpoy1om e iesl( srua( o;t1tpeniiciyslsDua(mo (0 lxrxr ta1fptrau s;s)t2umio no1opt mici tfsrur(m nu0alt micildfm2elu p t4aexnxr3iotlmDeaneol(  rum(r3no4openlnetl()artr(m ;t4apxn f3ildfaDrmuvont)aeenmfcoy1la   uvo ( t2uoxo3iu4aptnlfetltfarrr(rp;o0tle mi3tlt m2rl( o t4 exoif iodfm eln ils)texoxrpoodole  fvia( aDur(moot4altoif3tytlsDumu s;u4 lenxocta1fm elivi s t2tmirpoodlle  fvsls) 2ta( p;o1tle ii3iyt m uan snu)tetoiociytoaDeaivo ( t2trir nodop emiei t  rra(rpoo0apxnmf3iydla2um( o;(4aeenmf3todfaD au i;() 2xoxo3io4optn ici sfs2raxmoou1tex  feiad m2um(mp (0tlenmocoadfmtelu o;() 2tm(m iu4ameemfctls) Drrxro;o4opeo i3iatlsDel( pn(4texnio3todfaDraivils0trxoxrpnu1lleemivslt arurx o;t1olen i3iydfmDea(mpnu4tlermoctadlpteanvils0s2uoim oo4ol n nvi ()artrx  no4apeo o3iytla rluvsnt) ltnifciytomt  n o;() 2tmxr3oy4alt  fcsltfsrra(rpnu0aeen fcildfm2rl(vpn()trxrxf iydopDeliei;t)sexr(r3iy4opt  nvs ()a2tr(rp;o0oet ioeiydfa el( p;(0 eeomr3iy1lmDranvs (0truriopoo4lme mivt t srurxr ou1tltnmi3tyd m2rln s;u)altoifctodfatrau slt)sruoirpiodop  mneia( arur(m nu0tex mi3ias sDelums u0trtoirctatop elu sl()setr(opiu4opt mnctl()a2tm(m ;o1tetnmfctasfmDrlu s u0arerxf3iadfmt  u sl() rtoxr iodoltnlnesls  Dtrurpoo4alt mieiadfaDrmnvp t0 lxnmf3tydoat au s;s0srtmxmpoo4olte nvsa( a2tmxr no1oeeomoeildfs2rmuvs u0tleniocoa1omtraneil(0t2toir nudamee fcs t)s2tmxmpoo0oeenmfetlt a2raumo u) etomr3totfp rlnvs (0texmiopiy4op elfvil( sDrmx o;u0aleomietld m2ulumpnt) lxrxr oo1lmDeln sl( t2uo(o io4ome  ieta()srtm(mp;u4tpxnmf3tad sDulnvo u) rxoxocoa1lmt anei s)srur(mpoy4omenmncta( sDurx o;o4apxomietadfa2umnmo t0aexnxr3oatfmD lueo s0setrxr nu4lpenlncsatfa2uax p;o1teenifciat m el(mpnu)tetrxfctadlp  lnes;t0 exmim nydlmt lnes (  rrrxr no4tlxn i3ilt a2ean pn(4arenxo iytlp elu o;t trxoio3nu1llte fvsasfs2taur nt4texniieiys s2umu o;t4teenmf iytlptelivo;(0trxoimpnudapen ivtlsf Dtaurpou0tex ifctys mDea( p;u4 rxnmf3iodlp e i il(0s2xmxr oodlltnmieilt  Dum(m ot0aptn fciasfa2umu onu0alenxfctytfptr ueo;t0s2tr(opno1altn fetls)srurxm ;u0tlx moeild a rlnms;u4aexomf tatfa r n i;( truoxm oy4lme lnvt sfsrrmu poo4opx ifetldlm ra(ms u) rtnxrcoa1opDeli o () eur(m iy1lme mfesl(farum(mpnu1texnioctytfm2umn p;u) rtnxo oy1fa r nvils0 euoir3nu1om   ieiasf Dta(mpoo1tltn f3tydlsDum(mpn(4trerif iydfpD au s;()s2urim oudolt  fcslsfs2rrur nt4alxniietyd sDuau p;t4 rerif ta1faDe u s s)srxoir3oo1ope  fviat  2ur( oou4oetn fciydla2rl( sn(4 lenir3iadoa eluei t)srtoxm ou1oltn ictltfsrua(m nt1aleo o3iysfsDuaumsnt) lenxr3to1lp e ivo;s)s2tmimpnu1lptnlncs t)srrrx oot0aetniociyt s emuvp;u4 ltrif3iytom rluvo;s)s2uriopnydale mnctasfsDrru oot4opx  octys aDulumo;t) eeoxfcootlp e nvils seumxopnodlmt mfes t) rumump;u1texnmocilsls2umuvs t0 lerif totfm  liei;( trxm(r iy4lmt mnciltfartrumpot1tetnii3iydlmDrauvsn()tetomf todop r u ils) rxoim no1alt  iei ( aDrm(mpou4tleo ieiyt s2emums;t)trxnmf3iydfpteau s t0t2ur(opny1om  lfvs ()sDraum ou0oeenmoeiatlmDeauvs;u)texomr oo1lpDeluvo;t trtrxm3oodole  nci sf Draumooo0aet if3ias a uan p u4 lxrmociodlp elneils seurxr nu1ol e fet t s2rmumoou0aetoiociyt a2uln p t4 ltnxr tytoa  aueslt sruoxopou1aptnmneia(fa2trxrpou4tle iieiatfm emnmp (4 lerxfctytlaD lieslt0t2xrxm3io4lpe licil(fsrrrum no4apen i3tlsfs eaumpnt0aexniocoydlaDeauvol()t2xmimpoodlpt lfci ( srtru p;o4texn o3tlsfm rlumsn(4tlenir3ta1laD  uvils s2toir iudlme lnctlsf Dtaxmont1olxn f3tasla2ra(ms;u4alenif3oydopDeau s;( tetrio3no4ap n ics s  rum(m ;u1tlxnmo3tlsla2rlums t4 lenir todomD auvil(  rxrxrpny4lm  lnci ( srrauro;t0opeoiieiytla el( sn(4arxrxr3io1lmD auvols)s2uoim iodalen nesls) Dtmxmont1opxoif3ilt m2rauvsnt4artoifcty1oaDeanvs;t texoxr oo1lltnlieta(fsDrrx ono0aptomf3iad m rlnvo;()alxrifcoo1lmtrlivo;s)teumio iydllt licsatf Dur( pno1aptn f3iltls eluvp (4teenif io1oaD auvo;()srtm(o nudap n fcta()srrmumo;u4aetnmfetlt a em(vp;() rtrif3io1fpDrlivo t) rum(m iudap nmfvsltfsrumx ont0alenmfetydlm2rm( s u0trtnmo oadfp eli s;t) 2tm(opoudom n fesl(fartaxrpou1oexnmf3iltlmDel(ms;() rtrmo3iatoaDeauvs ()t2uo(mpiu4omtemnct t  Dtrur ;t1alx moeiytfa rauvs;u0trtomrciodlpt  nei s) euo(m3nu1op n feias  Drrurpou1oltoio3iyt mDrlumo;() ltrmr ta1op   uvolt) 2xm(r oydlm  mfcia()s2trxront0opeomfetldfs uluvonu)alenmo iytfateli ols0teuoir oo1omen iesl(fsDuaur no0olenifeiat aDulnmo (4 lenifcia1fpD lueslt)s2xr(m iudll nlfeia() 2taurpoo4aexoiocilsfaDua(msnu4tlxnxo3oa1faDrlieo;t0srtmirpoy4aptn nvtlt  2rmu  oo1aexoiociadfm ua(msn(4aetrxo iatlmDeln s;( trur(mpiudal nlfciltfsrrau pnu0aet ii3ilt m2rluvon(4aetnir3tytop e ivils  rxr(r oodll e neils s2uau o;o1tet moeiatls el(vp ()alxoio ty1fmD lu i;s) rxriopiy1amen nvtls  Draur nu4aptnii3ilsfm emnvs t4trtniocia1omDraivols)sexrir3oo1ome miviat)a2rax o;t4tex mf3iadfsDeanms;(0tetoio3io1omD lneo;t0trtoxr3nodoltnlncil() rurump;o4aex iocilsls2ul(ms;u4 exnio3oatfa elneo s trum(o3iy1ap e fetas aDuax oou1tee  ociatfaDrmu s u)tltnio3ootom e neil( s2toim ou1alen ivi (f Drm(mp;o4apxoiieilsfsDra(mo;() eeoxf3ia1latrlu s t0tetm(m3oodaltemnetat)srrmxmpnt4tetnif3iytls umn snt0aetnmrcoytom e uvi;t)sruoxo no4lpe lics (  rta(  no1texniictldfa2ul(vo u4 lxnxo todfm eai s;s0 rtoxo nu4apee ivtas) Dumu o;t1tltn o3tlsfa2ranvp t)trermf3oytlptelu s;t0 etr(m3iu4optn ieia() Dtrxmpou4apx  ieiyt a uan p (4alxrif3todfat anei ( setrxmpnudalenmivt (fsrra(mp;u1tlx mo3tld sDemuvo t0 lxnmfciodfatelues s0teuoiopnudlmenmnetat)a2trx ont0tpxomieiat a2ulnvs u4trerxr oadomtranvolt tetm(o iy4ole lnvi tfaDur(rpou1aptn fetyt a ea(vo u)trxniocta1lmteanes;s)s2xm(o iu4ape lfviat  Drrumo;t1altnio3tyt a2rlnvs;t)teenxfctatfm eaies (0setm(opoo4lpeelnvta( arrrurp;u1opxn o3tat a2ean snu0alerif3ia1op  ai s;t0srxrxm iu4amtnmncsa(fs2rr(r oo4apeoii3tydfsDea(mp u)trtoiocoy1omtr u ol( trtmiopnudoptelfvt tfa2tr(mo;u1tlx mf3iyt s2emn o;t0areoirctadfptrlnvo;()srurirpio4amt mncias a2raur ot1tet moeiadfmDuln p t4trerxrciydlaDrai i;() 2urxm3oydlmtelivs (f Dtmx ooo1tpx  feiasla ua(vp u) etnxo3oy1fpt aiei s sexo(r3iydomtnlncsasfaruaump;t1oexomi3iytfs2uauvpnu0texoioctotfpD  ieo;t)srtmxm3ny1altnlnesa( aDumx  ;o0altn oeiat sDrm(vp (4artoif tytlm r neolt0 2uoxo oy4lp  lfetas  Dumu  ou4tpx ifcias a ua(mpn()tltnir3tatoatrluei (0s2trio no4apt lietl() rurxr no4teenmi3iltfa2rl( p;() renif tatlat lieo s0srum(opny4om nlfvi t) 2rr( pot0olx mieiasfa rmnmp;t4tltrirctatoptelueol(0trtr(o nu4ol nmfei s arrax p;t1tpt mfetlt mDumuvp u0alxrircty1lptrai i;t t2xr(r3ny4lmt lici sfs2ta(mpno0ole  fciyslm2ra( s;() ltrmo3oatlmDr neilt t2to(o iu4ap  mivsas srtrxm ;u0aptnifeiyslsDuaump;u4 lxrmfctytlp e n i;() exoirpou1ll nmici ()s2tr( oou4tpt moeiydfm rmu p t0trxrxocoytlptrlivs s)seur(mpio1lpeeliei t  2urxrpoo0aptn oetadlm umn onu0tlerir iydlmDrai o;t)teuoxrpiy1apeelfcs ()s2rruro;o4tpt ioeiasfs2rmums u) rxomf iodoa rai ols)trurxm3nydllee nvi s  rtaxr oo0apt  fciydfm ean s;()alxnxf3iadop   n i s trumirpnodlmeelnes (fs2tm( pnt0tlxn oetldla2uluvs;u)teeriocia1oa r nei ( srur(mpoudllen nctltfsDrmx o;u0aetomietld m um(vpn()areomf io1laD lu sls texoimpiy4lmenlfvi s  2uaum nt1olenmietydfm2el(mont4alenmrcoytfpDeaivi s t2xmxmpno4lptnmivilsfsrtaumpou4alxnmfeiadfaDem(vs (0tlxnircoydopD anei;s0sexrxo no1lmenmietl()sDuauroot1aexn icilsfm2uan o t4trtomf3oadfmDrau o (0t2xrxo3nudap e fctlt a2umu  oo0oexnmieilt aDel(msnt) renmr iodlmtrln slt0teur(mpnu4lmte ivs s  Dur(ronu4apenio3iys a emnvs;t0aetnxf io1fpteln i;t0 exoiopny4altemicia( a2raxmpoo1optomfciytlm elu p ()alxrio3ootfa r ueil(0 2toim3no1am elieias)sDra(  ;u0opxn o3iasfsDua(vs;u0aexrio tydfpD ln i;()trxrio3oy4lm e ieiatf 2rm(m ;o4oltomiciys m2raums t0 leomo3to1fptean ilt  exrxr3oy1lpe mfci () rrm(  ot1tleoiieildlmDrlnvo;()aeerxr tytopDrauvi;s  rxoxopny4ame mneilt aDur(r nu1apxomo3iydlm rluvs;() etrxf iytlpteluei ()s2umio nu4optemivi t)sruax p;u1teeomfeiytfaDean pn(4treoir ty1om rlivsl(0srtoiopoydomee ncsatfaDua(rpou1alt iieiat sDea(vp t0aexoio3iodfatr ues t s2uoim3iodom nmnct t) Duau o;o4oexnif3ilt m2uanmpnu) lxoxo tadlmDelneol()srtoim nydlmtn fctatfs2raxmpno1olen f3iysls ea(von(0alxomf iodfm eauvils) rtrxopoodll nmici () rurxrpno0oex  o3tydlm uan on(4tleoio oa1la e ies;s) 2xmxo3io1apt lfvil( s2umuroot4opx ioetatfmDul( p u)trtrmoctytla e n o;t0s2xmxm oy4openlfctat arrau  ;t0tleo fcildfaDumu s;t4teeoif oa1lp  lieils)t2tr(opou4ll   nvsls sDtrxroot0aexoii3iatfsDemu s t4trtrxr3iotlate i s;( s2urxmpoo1lm e ivs t sDraxronu1tpeomoeiat a2ul(vs;u)alenif3totlp elieo s0trxoxo3oo4lltemivtlt  2um(  nt0opxomf3ildfaDrm( s;(0artrxocoytlaDran ols0tetrxo3oydlme lfesas)aDrm( pot1olx  f3ias a raums;()tlxnxfcty1late nei ()seumxrpnydomee ict (fsDra( p;o4olto ictatls eln pn(0 rxomo oo1laDe ies;t) etoxopiodapen fcsas)arrmx  oo1aexo feiytlm2el( o u)trxrmf iatfa e uei s) 2toir3iy4lmte ictatfartm(mpoo4olto octys sDeln onu4 etnio iadlpDrlnvs () 2tm(r oy4ame mfctat srraxr nt1apxnmiciyt s2rauvs;u0treoir ia1oaD  nei;()t2uoim3iodlpt  ics tf rraumont0tpeo octldla2rluvonu)alxnxrctytfaDrai ils)t2xoimpiy1lm nlnvsls sDumxr ;u0tpxoifeiyt m rlnvsnt) lerxo tydfatean o;t0teum(o ou1ll e ieilt) Dta(rono0tlt if3tasls2eaump (4 lenio tytomtrlnvs (0teto(r oydapte fesl(f ruax  nt1aee ioeiyslm2uluvsnt0 etomf tadla r uvol(0 rxr(o3no4ame livsl()a2taur ;t4olx mfetydfs2ran s t)arxrir oy1lmDe nvil(0sexm(o oy1ol e ivsa()srrruroot4texnmfciyslm2elnvo u0trxrxrciytlaD lnvo ( s2xrimpnodom  lnvsas  rtmumpot1teto ictyt s um( p;t0aetoif oadlp   ivo;s trur(o nu4ole lnetatf 2tmumpot1alenmfetytfs ea(vsnu0 lenxfctadfa eanvo;t  rur(mpnu1al emncsl( sDrm(  ;o1aptnmfeiadfaDumnvp t0texomr ia1lmDeanes s0s2xmimpoudale  ivias s2uaurpnt1apt if3iad a ulu o;(0tetoiocia1fpteanesl() rtmim3oydam   fcsat  rumu ont1oetnii3iltfa rlumo (0aleomociy1fpt ln ilt s2trxm ou1ol  mfcs ( arrmurono0oet  oeiad s2rlu pn(0aleomr3tytoptrluvs;s  rxoxo oy1aptnlivils)srrm( o;t4alxniociatfs2uauvo;() reomf iotfmteau ilt)srxrirpiodol nlfetlt s2tmurpou0oex mf3iytfaDemnms t)arenxocoatlm ean s (0 exmiopiu1alenmfeil() rra(r no4tpeo oetas m2rm(mo u)alenif3iadlmt  i i s)srtmio oy1lmt  ieiat sDtaxronu0opxoiieiytfa rl(mo (0aeenxocoa1opDrlieilt  rtoim ou1om nmfvil(f Drau ont1tleoiictyslm2emuvp (0 ltoifcootlptrlivs;t tetrxo3io1optn neil(fartm(r oo1teeoio3tld s2ulums ()trenircoadop rlu i;s0srxmxr3no4omtemivi sfsrrr( pou0tpx if3tas s ra(ms t0tetnmociatlmtraivs;t)t2uo(rpoudlpe licta()sDta( pou1altoiociyt aDul(msnu0alxrmrctydfpt  neo t teto(rpiydlm  lfvta( srrmu  no4apt mf3iatlsDem( snt)arenxo totlat  neslt s2umxrpiu1ll n nvil(fsrrau oot1oexoiiciadlsDumn snu0tlenxrcootoaDr i i ()trxmiopiudal elfes ( aDrru  ;u0tetn oeiyt a umnmont4 etrxr3iy1oaDr uei;t)seuo(mpiydal e fvslt aDtau p;u1ope miciydlsDrmu pnu0tltoxr ootomD anvol() 2uoxm3nodopt lfvilt arrmxmpno0olx mieiytlm umnmo;u)trtrmo3iadla e iei;t)srtrimpnydomte nvsas sDtaum ;t1oetn f3iysfa ua( s;u4 reomrciy1oa r nei t srumxo iudlm e ncs ()aDtmu  no4olx iieiasfs ean o;t)teerxr3tadoptrlu il(0srtmxm3io4lmtnlfcias)s2tr(r ;u1tlxomictyt sDeluvpnt0 ltrio3tydoa ean o ()t2xr(r3oudolt lfviltf 2uau ooo1tpto octldfmDel(mpn(0teermr oytfaDr u sl( teuoxo3iy1lptn iet (fs2umxro;u1optnioetltlm2ea( s () etomr oytomteai sls) 2toxm iu1altelnvia( s2rm(rpnu4oet mf3ilsls2ea(vs;(0 lenio oa1lm elu slt)texoio3nu4openmfei s)s2rr(rpou1tetnifcildls rl(vo ()tleoxo3ta1oatraneo ()teumio iy1ap nmfct t) rrm(mpnu4openmf3iydfs umnmo t0 lenmr tatopD lu s ()srtr(o no4om  mfet t)sruaxr ;u1aeenmf3tas a2eanmo u)tetrxfciytom e nvo s teuoio no4ope mfvsl(fa2rau o;u1oltomfciytlm umuvp;t4teenircio1om  auvo;s) 2um(r oo4op nlnvsl( aDraurpnt1open fcilt a2rmn s ()tlenxr3io1opDrlnvo s) exr(r3oudlleelnvtls  rtrumpot4alx  fetld m2rau s;t)trtrmr oo1fa e nvi s  2urir ou4lmtnlnetlt)aDumx p;o4aeto octldlmDrlump t) exrxfcia1oaD livo;t0t2urxo oy4ll nlfeil( a2ua(  ;u1oleniiciadls2ea( snt)aetrircoodlpD  neol()s2uoim iudll elneta( artm(mpnu0tee moetltfsDuau p (4teeoir oy1oa   i i;(0trurirpno1ome mnct t)arrm(m nu0aet mociltfs uauvsnt4 lxnxf3iydomDe uvs t)s2tr(o nu1lltn nct (f Dtmxrooo1teeo f3iasls2ea(vsnu0 lxnxo iotoa e ivo t  etr(rpno1optnmncil()sDrmum ;u1tlxn ietltla ulnvp u4 lerxrcoytfpD lu s t)setoir iudol n ici tf Dtrumoot4tlxomoeilslm ua(vpnt) eeomo3ta1fat  uvo;t  eur(rpnodlptnmfcta(faDrm(m oo0tetn o3ilsfaDrlnms (0 lxnxfcoatfpDe ieilt0 euo(o3ou4ol elnctl()arrax p;o0aet mociydfsDrau o t) rxrxfctodlpt  u il( t2ur(r3iodal elivias)srraurp;u0alt  f3ild m ean o u) reoxf oatfa elueo;(0sexrxm3iu4ol nmnet sfs2rmu  nu1apt ii3iys sDulnvon(4alenxocoy1fate ieslt0srxr(o nodam  mfct (f Drru poo1aexnifeias a rmu s t4alxnxocootop ranvs;()setoxopoudaptnlivi s aDtm(  oo0oexnmi3tldfm rauvsn(4 ltomr iadlmt aivs;(0 rxoio3iy4ameelfeslt)artaumpou4aeto fetysla2umnmp u0aeeomocio1late uvi;s)trxrxmpoodamtemnvtls) rra(ro;o1olenmfeildla el(mp;()altrmr3tatlpDeauvs;s srxmxo3iodapt licsa(f ruaurpou4olx ii3iysla em(ms t4arxoxr3ootop eln slt  etmirpoo4ap nmietlt s2umum ;o0ole mi3iysfm2rmn s;t0altoxf3totlpt auvo;t  rxmio3io1altelnvs s  rumu poo4opt mieilt aDrl(ms;t)artrxo3tytom  ln s t teuoxo3nu4opt mfet sfs2uaxm ;u1olxo f3iyt sDea(mon(4trtrmf iy1fmDeliei t)seuoxr no1apenmncia( a2raurpnt1altn o3tytfsDrl(mpnu)artnmo iytoptelneolt0t2xmxo3oy1ll elnvias srur(r ;t4olxnmfctlt aDrlumo u4 lxrmr oodfaD anei;t teur(mpiu4ome mncs s)s2trxr oo0tlxomi3tld sDumn s;t4 ltrmf3tytlaD an s;(0s2xoirpnodap nmfct (fsrrmum ou0tpe moctytfs2ranvs (4tetrxo iotlp elu s;s trur(opoodlpenlfci s)aDrau  ou4oleomo3ilsfmDel( onu)arermfciotomtrli i;s0sexoxopoo4altelnvi (fa2rrump;u0ole mociydfa ua(mp () rtrmf ia1laD  u o t tetmxmpno1lpen fei (f 2rrxmono4ale  o3ildlsDuau s;t0aetnmrctydopteanvs;s) 2tr(r3iu1am emnvsas  rtmxmoot0aeenmoetytlaDeaumo;u0trtnxrciy1lptrau o s0 2uoim iu4opee ivta(fsDtau poo4alxo f3iydfa rmnmo u0texnmf3tatfm  an i;(  exoim3oo1ol emici ( s2tmxmooo4alxnmoctldfsDum(mpnu0trxrio io1fpt  u s;s0trtrim3io1ope livtls) 2uaumpnt1alenio3iysfa2ra(vp;t4artrxf iatomt aneo;() etrxo3iodamt mivsltfs2rrxr ;u4alen oeiydla2elumo;u) eenxf3iydlmtrau i;t  exrxo nu4llee ics s aDuau poo4apen ietlsfaDranmpnu4arxrir oa1omt  ueol( trxmxrpou4alt  fvtatfa2rm(  ;t4tltniieiaslsDrmu s u0trtoiocta1oatrli sls0texrxr iy1opte ieia(fs2umu pnu4opxnifeias aDrl( p u)alxomr iodlat aivs;s) etr(rpoodaptn fci t a2trumonu0oeeomfeiadls ulnvo;u4tetnif iotfp elivs;(  2trir iudlp n fcs ( a2rmu p;u1tpeo fetytfsDumump (0tetnifciodlmtr u i;s)sexr(m3nodamee fctl( srrrx o;o4tpxo iciasfmDumnvs;t4aeenmrciodfa   u o (  2to(m ny4am   nvia() Duau ooo4oee  fetydls rlnmp t4 rxnir ootfpDr neo;s teuo(opiu4ll  lfci ()sDtr(rpnt1olt  feiat a ra(vs t)altrxo iydla  aivil()trurimpoudll  mfet ()a2rru o;t1oetn f3iatfs rm(vs t0teenmocio1lp   nvil()s2xo(r iy4lle mfvsltf 2tr(rooo1tetoiicildlm rlu o t)teeoxf todlaDrauvols srum(mpnu1lmtn ncsl( sDraxmpou0oeenifciltla2em(ms (4trxnio3tydfm eanes;()s2umxm3oy1lptelivi s) 2tau pou0apen i3iysfs ean p (4 ltrmr ty1faD an slt sexriopnudomen ietltfsDtmu pnu4apx  f3ilsfa rlu o t)tetniocoydlp  ln sl(0t2xm(m ny1aptnlictlt)arum(rpno4aet  fciasfs2rmnvpnt)texomf iatlmD  nes;()trto(r3nudapenmfcia(f Dta( p;o4opeomictasfsDrau sn(0 etoifctadoaD lieo t0srtmio3ny1lleelicils aDuaurpno4tleoifeiyslm2rauvpnu) eeomrcoydopDeluvi;()trtr(o oudom emicsas)arra(mo;o1apx miciasfm rmu o u4trtomrcio1faDr neil( srtrio io4apt mnvt (f rrru pnu4oeenmieiltfaDea(vo (0aeenxfciotlm eli ols srto(m io1al emicil(f rra( ooo4tee mf3iasfsDulu s u4artoxo3oy1fa e ues s)srum(mpny1amtnlfcs s)s2urx oou0openmoeilt sDea(vpn(4alxoif3tytla raneo;t)srtoiopno4llt mfeta( arrr( p;o1tlenmf3tytls2ulnmo;(4 rerio totfpt anes s0sexr(o3iy1am  mfes sf Drru oou0ape mieiat aDrln pnu)alxnir3iytoa  livo;t0trxoxm no1ap eliesls s2ur( ono1tetomfeiadfsDua(mo;() eeoxr to1opte u i t0 exmxo nu4lptemfvta( aDrm(r oo0opeomieiytfs2umuvp;(4 lxrmr3ootfmDe n o t0texo(rpoydlmeelfcs tfartrum oo4ale mictadls rmu on(4trermo3tadlmt livs s0 2xoxrpnydoptnlieias sDrrumo;o1tlxo o3iadfa uluvo;(4alenxo ootlpDranvol(0trtmio io1lme  fvsls)s2uaumo;o4aexo iciyt a2elu ont0 eerif to1lmDean s t0sexmxr nu1ll e ivsl(f rtmxr ;t1aptoifciyt s rmnmp;u0 exnxrctotlptr u ol( t2tmir3nudll n ivs (  2rrxm nu4tlxnii3iad aDuanvpnt4tltrmf oadoaDeln ols0setmimpnydapt mncsas aDum(rono4alxo oetls sDemums;t)aeermf iadfm rluvolt t2urirpiu1apenmivta( s2umxmp;o4alenmoeiasfaDrluvo;(0tlxrir3iy1lmtranvslt)srurir3oo1opt  fetls sDrm(  nu4tlenmi3ildlm rm( o t4arxomr iadla   u ilt)trtmxopiy1alt  fcsl()arrax  nt1tpt mf3ilslsDeau s u0altnioctytlm rlnei s) eurxm3iodlltn iesa(fsDtau  ;t1opxoifeias a rmnmsnt4 lenxo todfmt  ieol()truo(o3oodomt  ietat) Dra(rp;u0opxnioetatla emnvo t0 exrmrcoo1oa eaivslt  2trxo3oo4al nlivtatf rrrxm ot4texnmf3tydla rlnmpn(4aetrmo oo1lateaues ( s2tm(m3no4lleemnvt (faDrm( p;u0tpenioeiyslsDrm(mo u)alerif iytomt lnei () exmxmpoo1opeemivsl(  2ur(  ;t1opeomf3tlt m uluvp;u)tlenmr3iotfmDeaues (0 rumio iydope miesas  2umurpot1ape if3iadfa ulu s u0tlxnir3oa1fatr n i;s)trum(mpiydlptnlneta()arurx p;t0tpeniociat s ea( onu)altrmr3ootfptr uvi;s texr(o3iodlm nmics ( s2tmum nt1tex mo3tytfs2umnmp;t4altoxr3iatop r ivs s0seurxo3oy1omte fcslt)arur( pou4tex mo3iltlm2ra( on(4tlxoxo3iydfmDeln i t0 2xm(rpiy4lpee fvt ( a2rmum ot4olt mfeiltfa2emnmsnu0treoir3oytlptr ieo t0t2um(mpno4lpte ncsatf rtaxrono4alx mfetasfmDrlu pn(4tlenmo ty1fpt  u o;s0srxrxmpoy1ap elfesl( sDrmurp;u4tetnmoetadlm2umumo;(4tlxoxocoydlatran o ( texr(m nu4ol nlfvtlt)aDua( o;o0oleo iciat aDeaump u) ltrxf3oodfpDeau i t t2ur(r ny4am n icsls aDua(m nu0apxn octasfmDeanvpnt4 eeriocoa1lpD  i s () 2xmxm3nydlpt lnciasf Dumxm no0tltoifciytls uan onu4trtrifciadoaD lieo;t texmiopnu4altnmivils) Drauront4oetn fciasls2rau o t)aeenmf3oadom r ivo;s) rtmxmpnudlme mfeils)srur(mooo4oexnmfctls a2ulnvp u4 leoio oo1latran i;(  ruoxo3oydaptemneiat) rtaxmoou1tlto octaslaDrl(mpn(0 eerxo3oa1oaDrlivo (0seuoxo3iy1op elivtatf Dtr(mo;u0tpt if3tadla2eln o t0aleoir3oy1fmt ln o s trxm(m3oo4lltemnvias)aDuaxrpou0aexnmocildlm2umu p () leniocio1opte neo;()setoio3nydlme lncsa()aDrmxro;t1tex ifcildfsDra(ms;(4tetoioctadfatraneils)seur(o3nudlm n ivi s)srraxmpnu0teenmo3ias m2eanvs;(4artomf iydlp eli ilt) 2tr(m iu4optemfvsltf Dum(  ;u4tlx mo3tyt mDumn sn()tetnmr iodopDe ivslt)s2umxmpio1ol emncta(f Dtax pnt4oex iieiat aDean p;u0teeoif3tydlptr n olt texr(m iu1lp n ivsa( artax  ot4opeomo3tatfsDra( s u)tetoxo3tytopDr nvs ( trtr(mpou4lltnmfcs t)srururpot0teeomf3ildls elnvo u4texnmr3oatfm e uvo t0srxoir oy4lleelnei t artm(mpno4aetnioeiltfa rm(vs;(0areoio3tytoptrlneo () exmxm3iydlmtemieilt  2rax pno0oeto ocildlsDul(vonu) rxomr3oadfm  au i;(  ruo(r3ny4ll  livs s arrrxr no1aeeomociadlmDem(vs t0aeeomo iotoaD auvolt) ruo(opiodapenlfvta()aDtmxrooo0tex  f3ilslm eauvo u4aexoxo iytlate ieo;t0seuoxm3iu1am nmnvsls s2um(mp;o1aeen ictasfsDemn snt0 exrmr io1fpte u ol(0s2tm(m ny1llte iesl() 2rau  nt1opxomo3ildfaDrau s;u0arxrmr iy1fmte n ilt) rtoir3oodomeelfcsls)a2rrx  ;o1apeoii3tytlm2rl(vpn() eenmo oo1fmDe ueo t0seum(o3iu4lptn nci sfs2uaxmp;u4aeeomiciltfsDem(ms t)alxomociy1omt ai ilt)setrim iu1oltnmnes (f Durxrpoo0tpt ifciydfaDranmo u4 lxoiocoodlmt luvi t setm(r oydoltnlivtl()srtrxmp;o1openmietltla rmu p;(0trxrmrciadom e nei;()trxoxr oo4lme  ivtat)aDrm(m ;u4alenifctatlmDrlumo ()trtnif iotoaDelueol(  rum(r3ou4omeemnet (  2umurpnt0ale ii3iatfsDrm(mp (0trerxfciodfpt anei;( srto(opoodal n ieil()sDuaum no4tptomoetys a2ra(vp (4alermf oytfa e neo;t0sexoxrpiodlp  lict (fa2tau  ;o4tlx  fcils mDea(vo u0aetnmfctodopt lies;t0 2toxo oydlptelieilt)s2ra(mooo4opto o3iadla ra( sn(4 rxrxo3oytomDr ueo;t)trxrxo3ny1opt mfei ()srtmxrp;u4aee iictldfm2eaumo;t0tetoxfctadlptr i sl(  eur(opiy1olt lnesa()artr( p;u1apt  f3iytfs ean p;(0arerif3ootop   ueo ( tetoxopou1lltnmnesas  rum(r ;t1tpeoifciltlsDel( pnu) renmo iydfptrln sls0 etrir3nu4lmenmict (  2tmxmp;o0tpen ictytfm uau o;t4artnxrctotfpD lnes t0srtmxo iodop nmnes s srtm(r ;o4tpeo o3iytfs rluvont4altnxr tydlpDr u s (0 etm(m ou4ol elfcia(  Duru poo1aee iieiatfa2rmn o;t4artnmrctodlm  au s s)trxoirpio4al nmneiasfarrrxm oo4altn i3iltfmDulnvo;(0 eerir oydop r nei;(0trxoxm oodal nmnctlsf rum( p;o4olt mi3iad a2el( onu)altoxocoadop   i s t  exo(m3iydlm nlnvilsf 2umxro;u1tet moetadfm2ulums;t0trtrmr oa1la r u ols trurxrpio4lmee fetl()aDtm(rpot1apxo oeiadfmDuaumpnu0 etoxrctydomt  u s;s s2tmim iy1am nmnesl()aDrrx o;o1oltnif3iltfs2elnmp;(0tetrxf3iytomDrluvi;t  exrir ou1lpe  nvsatfarrmxronu1tptnmoeild s emuvsnu4tltnio3oodlm  aueils0 2tmim no1aleelfvi t  Dta(  ;u0tlx mociyslaDraumsn()artrxf oadomt  u ols sexoxr iu4alen fct (fsDrrxro;o1tleoiocildlm2ua(ms u0tlermo3iodla e ivo;s  2umimpiudome  fvtlt)s2ra( pot0oet mf3iysla emn pnu0 exnmo3oytlp rli o t  rtmxr no1omtnmies (f rraxr nu0alto ocildfs2raumo;(0alerircta1op r neslt) rxmxr io1aleemicilsf ruaxm no1oeenmfcilsls2ul(ms ()arxoxf3oodoatelnvo s s2trxr3io4lp  mfetlt)sDtrxr ;t4aexo o3iasfs rlu o;t4alenifcta1lp e nvi () 2um(o3iu1omenlicilt sDur(r ;u4texnmoctlslm2rauvp;() etrmo oa1omt aivil( s2toxopoydamt  ietl( sDta(m ot4optomociydlm ulu pnu)trxrmrciatlat auei t  2xoxopou1optelicsat)a2umumoou1apxnmf3tltla raumsnu)alxnmo3iodfmDrlnei;s0 2xrim oy4lpenmfvtatfsrtmxro;u0tpxomfctatfmDul(mp;(4 rxrmrcia1opDr n ol( srtr(m iy1ll nmfctas sDtmum oo4apen o3tyt s2emuvs (0tetnif tytfptrauvil()t2trimpiu1aptnlicil(fs2ta(rp;u1tlx mi3iat m emump u4artrirctadla  lneil(0s2tmxo oodamtn ict ( sDraxmp;o4oee  iciatlsDra(vont0 renir3tadfpt anei;s teuoxm3no4ale lfes s sDua(rpot4tex  oeiytfaDul(mo;(4 rxnxr3ty1lm   ivi;t)setr(opoydllt lnct sfaDtmx o;t4tle iietyd sDrmu p;u) exrxr to1optrln s;s)seurio3nydope mieta()s2rrx o;u1openiietydfa2uau o (4aetoxf3oydlm eaneo (0trum(rpiu4lme  nvil()aDuaxm oo4oltoio3ild sDum(von() rxoifcoo1lat  ies s s2to(rpiudom   nviatf 2rru  ;u1tltomfeiad aDua(mont4trtoxrcootlpte ies () etr(opio4ol e feslsf 2rr( pnt0tpxomfciad m2rl(mo ()arxoio oodlatrlies;(0 2xoirpio4olt mnctas)s2trx pou4oltnio3tatla ranmp;u0tlerxrcia1oa rlivs;s)setmxmpnydlptemfes sf Dtmx  ;u4tlxnmictatfmDuln o t)artnxf3iytoa eanei;t t2urxm3oy4oleelictat  2umurpno4alx mi3iltlm2ea(vpnu4aeeoxf ta1oa eanvsl()s2ur(mpny1lpe lnesas) rtrx  ot4opxniiciatlm2ea(monu)altrmfcoatlaD lueo;t t2urim3iy1omenlnvilt)a2rrurp;u0opxo iciyd s2umnmp;(0 lxomfcto1faDr i o s)srtmim3nudlmt  fcslt) rtmur ;o1aptn f3tad s2rauvp u0 rtoir oy1laDe nei s)t2toimpno4lpen nvt t) rrmur ;o1texoifetasla2emuvpn(4aexrmf iydla r nvo;s teumio nu4ome  fetas)a2rrx  ;o4oet iocildlsDum( p (0areoxocoo1opt lueil(0 eto(o ny1ape  ivi t a2umum ;t0opxnmo3tyd m2el(vp ()arxoio oytfmDelivs;( seumir3nu4altnmfvta() rra(ro;t4oexoio3iasfmDean s;t)aetnir3oadlm   nvilt0srtmirpio4ol   fci t)a2ra(mpoo4aetnii3iyt a um(vpnt0 reomocoo1fatelneo;t)t2urxr3oy4llenmnet ( s2urur ;t4tptoii3ilsfm2em(vpnu0 rxoir3oo1om e i ilt0seumirpoy1lmee iviat sDrru pot4opxnmoctadfsDelnms;t)tltomr iy1fmt lu ils)texmxr3nu4aptnlicsas)a2tr(m ot0oetnif3iat a2um(vpn(4 etoxoctatlmD aueo s0 exr(mpny4lmtnlnvil()arrmur nt1olenmociyd mDemu snt0aetrmo iatopDeanes;( srto(mpou1lpe liet s)s2trxroot4alx io3iyt mDem( ont)arxrmr oydlpDrai o t0seumimpny1ll  mivtl() 2rr(  ou4altomfeiltfsDem( pnu0trtrmociytopDeaneilt0srtrxrpny4llen iesat  Durx pnt4apxoiieiaslmDeaumsnu)teerxf3oatoa elnvslt) rtrimpnydol elfvil( srur(r no0opeo i3iysfmDulnmp t)teerif3oo1fptran i;s0texrxo3oy4amt mnvtls sDraxro;o1ale  f3iltfs rl(vsnu)tetrmo3oatoa elneo t) 2tmxo oodapeemfvia()sDraxrp;o0olenmieildfa2emuvo u0 rxrif3ootlm elues;t)seumim nydapeelfeils  2rr(rpnt1texo fetas aDul( s t4 rtrif tadfpD  n olt)t2toirpnodamen feia( aDur(m ou4alenmfctadfaDeluvonu)tlxnxr ia1fateaivo;t0s2xr(r3iu1altelfeiasf rrm(rpoo0tetn octadla2ea(vo;u) rxomf3todfpDe i i;(0sruo(o ny1ll nmfcs s a2ra(ro;u1tlxn f3ilslmDeln on(4 reoio oatlm rluvo ( t2xo(m iydalt mivtl( s2trxr no1tleomf3iaslaDrmuvs t4tltrio oytfaD ai sl(0srtmxmpny1lpe  nct ()arrmumpoo4tpt  oeilt m2eln s t4texrxr3todopDrlueol(  ruo(r3nudopt  iei t aDra(mont1olx mietlsls2rl(vsn() lxnxrcoo1lpD  neo s s2xrxo ou1olee nctl(fa2rmumonu0tet  f3iatfm elnmp;(4 etomr3tatla eaiei;s  rtrxr iudlmenlnvi s srtrx p;t1oeeoiiciyd aDrlnvs (4areoxfctydfpD  uesl(0s2xoir ny1am  mncsls arrax oou4opxomfeiadfm2eau s u)tleoxo ta1fm rln i;s) rumir io1op  mfvs s sDrm(ro;o4ape  ictad mDeanvp;t4alxnxocty1fpte nei;s  eur(o3ou4lpeelfctl(fsDtr( p;t4tpxomoeiltfaDrm(vo u4 rxnmf3iotoaDr ueolt0 2uoxo iodal nmfct (farrrxm oo1tpeomf3tldla eanvo u0 lxrio3ta1opD  ieol(0s2tmiopoo1lle mfvi sf rum( pou1alxn oetytla uln p;(0tlerircty1lm  ln ols  rtm(mpiu1omeelivil()srtrxrp;o0texnif3ildlm2ra(ms;t0altnio3iodfpt  i ols)trxo(m3nu4ol elncil(fartm(rpot4aetnifeiltlsDua(mp;u4 eeomo3ty1la  livs;s0 rumxr iu1lpt lnct t aDum(m nt0teeo iciat mDranmo;u) lerifctatoat auei s  2xoxmpnu4amte nes s)sDrr(r oo0altomi3iydlmDea( pn(0 leoxr to1fpDr ivolt s2trxopoudope licsa( s2rr(moot0tptoioetadls2umuvont)tltnif3oodlmtr n o;t  2tm(r3io1ap e nei t sruaxmo;t4altn oeiyd s2uanmo;t)aetoircia1faDelnvo;()tetrimpio1lm elfvi tfsrtr( pot0tltnmoeiat mDeanmpn(4texnxo3ty1lmDeauvi t) euoir3ou1lm  lnei sfa2rruro;o4aee  ociltlsDra( s u)areomfctadlmtrauei;s s2toiopnu1aptnmnetat)aDur( pou1tpxo icilt a elnmo (4trxomr3iy1optelu sl(0t2tmimpny1lmtelfeslsfs2umumpoo0oleomfeiatfs ranmonu) lxnmo3iatlmDeai olt0seuoxr3iodomenlfetlt s2rmxr nt1oltniieiadlmDrlump;t0 exoxfciotfatrln ils) eumxrpny1oltnlfeta( arurxm ou0tpt ioetys s uaums;t0 ltrxf3iydomtr nvo (0srxrxo io4lm nlfcias)sDumumpoo1oetomfcias sDra(vo () eermo3iytlptelneils)teur(r ou1apeelnvi tfs2ur( ooo4olxniieiat a ra(mo;u)aetomocoadfpDrli s;t0trumxm3iodal elneias aruau pot4oltnioctlt s emnms u)aexoirciydlm rai i t s2xrxmpio1llen nvsas  Dtr(mo;u0apt mi3tysfm umu o t)texnxf oadop   neols s2triopny1omt mieiat  Dta( oot1oet  fetadfa2ua(mo u)tetrir3iy1op eluvol(0t2urxr oy1ap nlnctas)srua( poo1opt mociadfs emnvonu0tetrmf todlaDr uvs s0 2uoxm iu4apte feil() 2ta(mpno1oex ii3iat sDrm(von(4tlxrxf3oo1op rln i s) euoim oy4lp  livsatfsDtm(m nu4olt iietltfs2el(vs;t4aexniocootfaDraivi;t trum(o ny1alee nes ()s2umxm ;u0aptoifetyslm rlnvs;t0alermr3oa1omt an s t)srumxm oydol n iesls srtmurpou4aexoiictls aDrmu o u0tleoir3iydfaDrlieilt) 2xrio iu1omtnmivt sfaDuaxmpot1tpeoif3tatlm ea(msnt) lenxocia1laDe i olt0 rtmio ou1ap e nvsa(f rrmu oot4oltnmf3iltls rl(ms (0treoio3iydlm rlu i s0 rtr(m3io4llenmfvsas)srrrxmo;o4apenioeiltfs2elnvp (0 reoxrciotfmtranvil()s2trirpno4lmeelfvsa(  2raumo;t1tltnmfctysfs rlums;t0aetrxo3tydlpt livslt0srurxo iu4am nmfvsasfarrau pot1openii3iatfs2elumo t4altnmo to1omtr n i;s)srumxo3ou4alt mnvi sfsrtrumonu0tpxnmoeiltfs2ul(vo t0alxrio3totoa e ivsls srxrio3oo4amt  netlt) 2ururono1apx  f3iyd a uauvsnt4 ltoif iytlaD luvol()texmxo3no4amee ietlt srum(mont0teeo o3iyt aDel( o;t4 exnmr3tytlmDraueo ()s2to(rpou4optn ict s srtrurpno1oltnmociad mDra(vs;u4teerifcoadlatr ivol()setmio iu1lltnmnes s  2rmumooo1olx iiciytlmDelnmp;u0 exrir3tytfp  aivo s)srxmxrpno1apenlfcsat sDtaur ;t4aexnio3iadfs umuvs t0arenmo tydoat aneo;s0 2umir io1apt lictlt  Durx pno4tlenmiciad s ranmpnu)artomocoa1lat  uvo ( texoxr iu4ll elnct s)aDua(r oo1texoifetyt m ulnmo;(0aexoxf iytoa rlueolt0srtmim oo1ll e ici s s2rmx o;o4aptomi3iys m2eln on()aetoxr3oydlmDrli il()t2to(m3nu1lmt  nvtl(  rtrxronu1aexoiieiytls rl(vsn(0aeerxo3totlptrau ols)trtmxopiy1lp nmfvi (f ruax ont1oetoio3tadfaDuanmo;t)tlxrir ta1oa  anvo t)s2xrio ny1oleelicilsf Drrumo;t1apenmo3iadlsDemn pn()artnxocoatlaD luesl(0 2tm(r nodalenmict t srrrum ;u4aetoifeiytlm emumonu0 ltnmr oo1faDe i o;t) 2uo(r oo1lmeemietasfaDra(m ou1ole mictatfs umnvo (4 ltrxoctotomt  ieolt0s2urxo no4ole  fvslt)s2taxmo;u0tltn fetltls el(vsn(0aetnir3iytlmDrln s;t) 2ur(o oydllt lfes s sDtrxmp;o0tpx io3tls mDrmn s t4altnxr oy1latrlueil( t2umio oy1ame  ivt ()aDurxrpnu0opt  fcils a2rau sn(0tetrio ty1fmDrlnvols)trto(o3oy1op   ncta(fsrtm(mo;u4opxo oetytfaDelums;t4 rerir oatoatelieo;t truo(r io4omeelivi s artaxronu4altomoeilsfs2ul( sn()trxoif totfatrluvs ()sexo(o3no4lltnlfcias) Dtaxr oo0tpt  f3ild m2umn pnt0trerxo ootoaD li o;t s2urio ny4op emnesltfs2tau p;o1aetn iciadfsDumnvp;t0 renif ootomte n i s t2xr(rpiodlme miei t)s2umuro;t4opx mi3ilslaDum(vp u0texnio3iytfp r i olt0 exmimpiudomtn ivi tfs2ur(moot4apeomf3ildfs uau o u0aexrif3iodlpDe ieils)s2uoxm oo4lltn fvsa()s2rax onu1opx  i3tlslmDrl(vs t0 rxnxr3oydop ran o;s0 rtm(o ou4alenlnvtatf rtax  nt0apto feiyslm rm(mon(4tltoxo3oatom rlueolt) 2toxr3nydamtnmfvi sfa2tmx o;t0altnmoetytla em(mo ()areoio3iytfateli s;( sexmir io4lpteliesls srrr(r nt0opx  o3iys a2ranmont0teerxf3oadlmt  n i;t)srxrimpoo1lltelies (f Duaurpno0aetnifeiltfm2eaump;t4 reoxfciodfm r neil()teurio3oudam   nviltfsDtax onu4opxnmoctytlsDrmuvon(4 rxnirciy1fmDe iei s s2tm(o3io1op e icsa(f 2rmum ;u4alxn ociaslaDuanmp;u) exrmo ootoa r u s;s) 2urim oo1lp nmfet s aDum(m ;t1tptomoeils mDrlumo (0artnmr ia1omt auvi (0trtr(rpnodll nmnciltfarumxmpno1olxnmi3iasfaDemu p u) exrmfciytop   u o;()t2tmxr oodaptnlnvtltfsDumuro;t1optnii3iat sDuaumo;(4 exnxociodfpDrlivils0setoiopoy1lp nmici (farurum nu0aeenioctytls2rau snu4teeomo iadlpt  n i;(0 2tmio3ny1apt mictat)srtrxrpno4aexn oeiydlm uln p;u0tetoxo oadlmDelieols setmim ou4ole lnes ()a2umxmo;u1tlen fctatfa2eln sn(4 reoxf todfptr nvi;s) 2xoxmpnodamtnmfcsa( s2taxmp;u1oeeoii3tls aDelnmo (0texrio3oytfmDelivs t0trtmir ou4opeeliesasfsrum(  ;o0olto i3iatfmDeauvo u4 rxnxocoatom eauesl() ruo(mpiu4al elivia(fs2ua( pot1tptoioeiysla2ul(vp;(4aetoir3todfaDeaueo t)s2tr(o iu1optnliesat) Dtr(r ;t1apxo f3ilslmDrm(ms t4tltnxociodlmDe ieilt0t2uo(m3iy1ll  lfesa()a2ua(m ou1alen fcilslaDrmnvp t) etnmo3oy1fpDeaivo t)sexo(rpou4altelnct s)a2uaxro;t0oexo oeiatla2um(vp;t0tlxrxrcoo1fmtelneo (0 2tmir3oy1al nlnei s)aDta(  ou4tee miciatla2el( snu)aexomf3io1fat  ues s0truoxm3nodlmtnlfvil(f 2tm(mo;t0oee  f3tldlmDuan snt4 reoif3oodlateluvol()s2xr(r3nu4opee ivsatfsDrauro;t1apenmfeildfsDea(vpnu0 etrmrcto1fpD lueo ( s2umxrpoudll  lfvslt)a2ta( o;o0apeomi3iysfaDean o u0texomoctytomtelivo ()setoirpnu4ape mictls  2tm(rpnu4olxo iciytfa2eanvp;t4artoxf3oytlaDrluvi;t)s2toir no4ll n ncs (faDtax o;t0altnmietat sDrmu ont4tetnmr ootlp rlu o s  exmir oo1lpeemivsl() 2trxr nt4ale  feildfa eau s;(0alxnmo3oydfatrlu o () exoimpoy1ope  fetlt  Dtaxro;o1aptn o3tatfsDuanvo t0 ltnmr ty1laDean o;s0s2uoirpou4lp emnes ( srtmxm oo4tlxoiociydfm2rm(vo (0aleoir tadoateluvsls0s2trxm3oy1alt mivi sfaDtaur nu1ole ifciadla rluvs t) rtnxrctatfpt anvo s) rxmxm3ny1ape  ivil(  2ur(ront0tpx mi3tasfa2em(vs u0 rtnif3to1oaDr ivs t0seumio no1amt lnvtl() Drm(mp;o1aleoioeiytfs emn ont4 rxnmr iotomt lu s (0truoxrpiu1omeelnvsat)aDumu p;o1aexnmf3tat m em( s;(4altnmrctydlpDe uvo t0sexmxr oo4omee iei t a2urumpot1aetnmietydla uauvp;u4texrmr3iadlm rlieslt0trxmxo iu1lm elivtlt)s2taxmpot4opt ii3iydfm elu s;u0arxrif tydoatr i slt t2xo(opiu4aptn fesls aDua( poo0tlxomiciyt mDra(mp;t4 rerxf3oodfp raivi;()s2xoirpou4llt  ivs s) 2tr(  no1aex  oetls m rl(mo;() renirciytfatrau s;()seur(m3iy4altemieil() rtm(rpou0aet iiciydfs2elnms;(4tlxrifctadfmDr n ol( s2xrxmpoo1omee nes (f rraxmp;t1opx  iciadfa2emu s u0tleomocoytoatrln i t) 2toir3oydaltelnvsl()arum(m ;u0opeoif3iltfaDua(vp t0 exomrcoytom   i s s0trurir3nudal e nvias)a2urumonu1tle  ociatla2emuvpn(0tlxrxf3todlp r neo ()srto(m io1al n ivs t)aDumumpoo4tptn iciaslm2uan p u4 etrir3ty1lpD  ueo;(0 exmio3nu1opee fvt ( a2umurp;t0aeenmo3tyt a2uln o;u4tetoxo3iydop   u olt)seto(rpiy1ame lneias arrmxr ;o4ale mieiytls rlu snt4 rtnir io1opDrlivilt) rtr(rpoodlltnmnesa()a2rmum no4olx mociadfs ul(mp u4tltoifctydfmt luvsl(0texrxr3ou4om nlncils)sDtrxronu4tle ii3iatfmDumnvp;t) leoif oy1fm   uvs;s)trtm(o3oy4ll nlfcsl(f Dtaum nt1tle  oeiaslsDumnms (0 ltoxo3oydfaDrau s s  etmim3io4lpt mieias)s2ua(rp;t4tlxoioeiatla2el( p ()alxoirciotop  li slt0 rxmio3io1amt  nvs sfs2rrurpnu0aetoioetlsfa elnms;(4tetrxfctodlpDe u o t srtr(o3nu1al elicslt)sruaxm ;o1teto i3tad m ea(ms t4 rtrxf3oatomDraiei;s t2umim3oudal emivs tf rtmu o;u0tpxomietaslm ea( p t4alenifcoytfmt  ivslt srtr(o3oodlpenmneia(faDuaxro;t0opeomocild sDrm(mo;u4 rxoir iotlmt  i ols  2xr(r iu4openliesa()srtr(ront4opx ii3iatla emnvs u4alxnir3iatop rluesl(0texo(o iodom emictl(fsrrru ono0aleoiieildlm el( pnt4tleoxfctydlm e n i (0tetoio nudalee ics ( s2tm(rpot4opeo fcilsfm emnmo;t4aeenxfciatfptr nvsl(0 euoim3nu1lmenlietasfaDrr(m no4oleniiciadls2uau ont0tlenmo tadlaDeaieo;( trurim3iu4ll n icias srtmuront4texn oeildlmDrl(vp;(4trtomo3todlpt anvi;(0 2umxm iy4ame  fetatf rta(roou0alen f3tatfa2emump;t4trtrxrctytfat li o ( seurirpou4olt  fcs s srum(rpnt1apxoifctytfs ea(vonu4 lxomfcoadlatrluei;t) exoxopny1amtn nct ( aDrrxm ou0alxoioeilsfmDem(ms;t4 etrir3ty1laDrluei;s) euriopnydamt  ici s srraxmont1tltoifctltfsDrmn pn(4tlxoxf iytfp  aueils)teuoxo oo4al  mncta(  2tmx  nu4aee  ietldfm ulu snu0tetnmo iotop  aivo;t) eurxo3io1omtn ivsltfa2um( pou1tlxnifeiytfs2rm( o u0trtrmf oo1la r n i;t0trtoimpoy1lptnlieslsfs2ua(ro;o0tpx iieiysfmDum(vo;t4aetnif3todlmteau ols teumxr nodope  nvs t aDumumpnu0tleniieiysfa2eanmp u) rxnmo io1omDr i i ( tetm(m3no1amtemncsl()aDraxm no1tpxo i3iyd m em(vo ()altomo iadfaDrlu sl()t2xmxrpoudale lnesat  ruaxmoou0olt  f3iasfaDua(vs;u)aexrxocoodomtrlivs;s srxrim ny1alte fei t)s2uru  nt0teenmf3iasfs2emn s t0tlxnmo3ty1lpteaueo s0 ruoir no1amtn feilt)srtau onu0texo fciydlm umnmpnt0 etrio io1oaDrlieil(  2umimpiu4lmtemictlsfsrrm(  no1tpenmo3iat s elnmo u0alxoif oytoaD  i il( srxoxr3ou4ale mncilsfsrtmuro;o0ape  f3tatlaDrlnvon(0altnxf iotoptelnvs t)seto(r3no1ol   nct sfarurxm oo1aptomocilsfaDeau p;(4aetoiocoadfp rliesls0 rxm(m iy4op  lnvtlt s2urumpno4aleo ieiysfa ra( onu0alermo iotfaDelu ols)setmir no4ope mfeils srrru oot0altn icias sDeanvpn(4trtnxo3todom   n ilt)trxrxr iudlm e nesl()sDtrur ;o1tex mi3iasfsDran o t0 ltnxo ootlm  auvo t  rtrxo oo4amte iei t)artru  oo4opeoiiciadfsDumu snt)artniocoadlmDrln i;(0srxmxo iudamte fcta(  rrm( pno1apxo ociasla uanvpnt4trtnxo3iotfpteanei (0s2umxm iy1amen ncta(  2rm(mpnt4aet  o3taslm ranmsn(0aeenmrcio1fate i ol(0 exrxo iy1am nlfesas) rra(r ou1apt  ociyt m2rmuvo;t)tlxnmr3tytfat  n o;t0 rxmxo no1amtnmivsatfsrtm(r ;u0tltnif3ilt mDua(vsnt0 rxrmfctydopteaues t) 2xoxo3nudale lfct (  2raur ou0tee  ietat m2emn o;(0tetrxocoadlmD luvs;(0t2ur(o3nudaptnmfcta( sDuru  no0opt iicils mDua(msn(0tetnmfcoadomDeanes t0 exmxr ou1lm  mnvtas aDum(m nt0ape ifetasfa2umnvo (0tleomocoatfpDrlneslt0setr(r iu1ape miciltfsrurxrpnu1aleomi3tldfmDuanvo t) lxoio io1lpDrluvsls)s2trir oodllte feta() Drmxr nu4apeomo3iatla ra(mpnu)artomo oydlmDraiesls0t2toxrpiudom elivtlt srta(r nu1olt io3tas aDra(vp;u) lxriocootoa   nei;()trxmiopnu1apt lneilt)sruau  ou0texnmo3iltlsDulums;t0artrxoctatlm  au ol( sruoim nu1ole lnesls)sDtrxrpnu1apeomf3iadfa el( o;u)trtoxo3oatlm eanvils0s2to(o3ny4lm   ietlsfsrumxrpnu1apto fcilslsDem( snu4artnxo iodoa r ivols t2xmiopnodome mfcilt aDraurp;t4oexoif3iatfa uluvs (4teeoxr3oy1lm e ies s s2xrxmpoodlpeemnesa()arrmxm nt4tex io3tytfsDra(vp t0teeomfciy1laDelnei ()t2to(m3nu4ope mici (fa2um(r ;t0aet mieiytfs ra(vonu4 ltrif3oodfpDraieolt)t2xoxm3oy1ole  fesltf rtaur no4ape iieilslaDemnmon(4artrxf3tydfpDe u s;(  rum(r oo1olt  fct ()a2um(m ;u4tpe ioeiadla emu o t4texrio to1la  lnei (  eumirpou4amen iesa(f 2tax ooo4oexn o3iyd s uau s;t0tetoifcoydlat auvo;t) 2trxr3iodlme mnetat)arur(r no4aeeo oetaslm2rm( p u4trermocto1fmDr uvo;s0 etr(r oudal n ictl()a2taxrp;o4tlxo feiydfsDrl(mp;u0areomo3tytoaDrlivs ()srxr(r3oo4ll nmiesat  2tmur ;o0opxnifctyd mDuluvo;t0altrxr iodlmtrlivs;s t2umxr nydlmt mivia() rtaxr nt1aeeomociys sDrlnmsnu) lxrmo3to1fpD li i s)s2ur(o iy4oleelnci t  Dtrxm ;u4oltnmo3iasfsDuanmonu)tlxomf3totlmt  uvs s  exmim nu4llen fct s) 2ua(r no0aee io3iaslsDuau p;t4altrxf3oy1fmte ivi;t s2ur(m nudom  lnct s)aDrm(m ;u0tlxoifciytla2umump;t0trtrmfctadlaDelnes ()t2xo(r3ou1al  mivtl()aDtmu  ;u1tee ifciydlm2el(mp u0artrxfcio1faDelivo;(  rxoio3nu4apte iesls) 2um(r ot0opx mf3tlslaDran s;t)tltomrcoytomtrli i t0sruo(m3nudlpeemnviatfa2um( oot0alenmocildlmDemnvp;() lenifctotfmt  i ils srtr(r ou4olt lfeils) Dur(  ot1opx  i3iydfa eaump;u)tltnmoctydfp  luvs;t  exm(mpoo4llenmivi (fsrtax poo0aexoio3iadlaDuanvs;t)tlenif ootfa  liesls0 2xrimpoodlmtemicta()sruax  ot4oexnmf3iadls uln o u0aeerxociydfa e nvs;(0 rxr(opoy1lm elies t)s2taxro;t4oex mociydls2ul(vp;(4trtoircoadfa  lueo s0s2xo(r3io1am  miviatfs2umum nt0tex  i3ildla ua( o t4tlxnxo3oydlaDeliei t)t2tmxo3iudol e nct t a2um(  ou0oexn oetatlm2rm( o u0teeoxo3tydla eanvilt sruoir iudlptelies (faDrr(mo;t1olt mieildlm rmump u4 renxo ty1fa  auvo t) 2toirpoo4lltn netat)aDua( ooo4tptn octlsfa elumo (0tetnmo3iy1fm e i o (0srumim iudalte fet ()srum(rpot1olt io3iydfs ea(mp;t4 exrmo iodom  lnvo;() eto(r3oodlptelivtls) Dtaxmont0texnioctatla ea( pn(0tltnxfctotfa   neol(  2toir3oo1om nmfesl(  rrrxroou4aetnmo3tytlmDulu s;(0 rxomf io1late n il()srtmxopoudop nlieiasfsrtm(  ;t1tpxnmiciaslaDrm(mo t)altnmr3oo1fpDr neo;s)trtoir3ny4optnmnei sf 2uau  oo1alxo i3iadfmDelu ont4alxomf oodoptr ivi s0 eto(o nu4optemfeslt) rua(  ;o0oet  feiydfa ul(vonu) lenmr iotomDeaivs;s)srum(m3io4ale mnvslsfs2uauroot0tptnii3tyt a em(mo u4 lenmo3oo1omtr n sls trur(r3iydop nlnct tfa2rm( ono4tetnmo3iydla elu on(4trtoiociy1fatelieol(0s2tmio oo4apte nei sfsDurxmo;t0oex iiciad mDea(mpn(4trtnxrctadopD lu s;t0s2trxr3iy1ope lfesat) 2urxront0oltnifeild a2em( p u) rxnmf iydlate uvo;(0 2toim iydapt  ieils)sDrax onu4olxo oeiydfsDumumo u4aetrmoctotlmDraiei;( t2xrxmpiodape  nesat)a2raxr oo1opxnio3iydfsDulnvo (0treoxfcoodop eaivo t) eur(mpny4omenmnetat)aDrrx  ;u0tpt  fctlsla el(von(4 rermf3iy1op e i s (  rtoxr3iydomte fcs t arraumpou4aptnif3iytls2rlu p;u0artrifctytfm ranvilt  2tmxr iy4lptelfcslsfsrtmxroot0aetnmicias s ranvsnt)treomfctadfa r u il(0t2xm(r3ou4op  licslt srrm(  ;t4olxo i3iydlmDrm(vp;t4 eermf ty1fpD  i o s0srurxm iy4om n fetlt)artr(rpot1oeenmietadfaDeanmo;u)alxnmo3iy1oa rlieo;s trum(rpio1ap emnetlt arraxmoot4tlxo i3iydfs2eluvs ()arenmrctytlatranes s srxr(rpio1apenmnvsa()aDur( o;t1ole if3iasfs2elnvonu4teeomf ta1fa rluvilt0 rtoxo nydlmenlieia( aruax p;t4oeto ociydfa2emuvo;u0teeomr todop elnvils setoir io1am   net tfaDtm( o;o0altomociydla2emnmpnt0alenxf iotfaDelneo ()srurio3oo1ol  mneils srrr(mono4alx  ieiydfa rau o;() exnmf3to1faD  neo;t trtm(r iudllen ivt s sruau onu1tleo ieiysfaDrmn snu0 eerifcio1latraivo;s)trxrxm oodal n nct s)sDumur oo0olxniiciyt aDrlnvpnu4trerxo3ootfpt livil() rxr(rpiudlpen nvta(  2urumono1texo o3tlslaDrlnvonu0 eerio iydomDe u i t0sexriopiodll   ivs sf Drmu onu1aetnmfeiysfm rau pn(0 lerio iy1la rliesl(0trxrxo iudoptelnvsat s2um(rp;o4ope mf3tld a2elu pnt0 exoxf iy1faD li o t)sexm(o3oo4lp emfes tf 2ur( o;u4tleomictlsfa2uauvpn(4 exoxociodlmtraies;s) rto(o3nu1lmen netltf 2rr( ooo4apenmoeiyt m2umn p u)texomrcoatfatranei;s)setr(opiy1op nmnctat)artr( p;t1oetoiieiadlaDumuvp;t0texnif3ta1lm rli i;(0t2xmir nudoptnlfeils) ruaxm nu0aex miciadfmDrmuvs t)artrxr ia1fmD  i s;s t2uoimpno4apeeliesa(fartru oou1tpeomo3ilt m2em(vp;(4tlerxr iydla  luvil()setrimpiu4lmeelivtl(f rtmxr ot1tet ifctlt m2rlu snu0 ltnxr tadomD  ies;s)teto(m nudom emnei t sDrauront1apeniictlsfa2rmumo u)tlxrmf oytfpDr ivols0 2urimpiudlptemictlsfsruaxr nu1oltnioeiad sDemuvont)aexnioctadfp elu s;( seumxopoy1om nmicslt sDtm(rono0ale ii3tlsfa rmump t)aexnxf oytomD  ivi;()seurir3oy4ap emnvsls a2trxmooo0tltnii3ilsls umu s;u0trxrxo3iy1opDraneo;( setr(mpoodlm  livias)s2taumo;t0tptniietyt a2umnvsnu0teenmfctytfp r ieo ( t2xm(opiudop nmicsltfarrr(  ou1aex if3ildfm rl(mp (0 rxriociy1fm rli i t0srxo(m3ny4ope  nes (  2ta(rpnu1oltniieiytla2raumo (0trtnirctydoptrlieo t)sexmxmpnydaleelicil(  rtauronu0oetomfciadfs raumpnt0 ltrmrcty1lpDeaivs;s0teumiopny1apt livi tfsDumxmpoo0tleomf3iasfm2umn o u)arenir3ta1lmteaivil()t2trio3io4oleemnvs s)arumumpoo1opeoiieiatlsDelu sn(4alxoio3tadlmDrauvo;s0 etrxr3iy4amenmfcs t  2uax  ;t0apx  i3tasfm rmu snu) reomf3todfptr nvi s) euoxrpoy4ll  lfcias s2rmurpoo0tpen f3ildfsDuanvs;t)trtoio3iy1lpD au i s setoxrpnodlpeelieia(fsDtmump;t4tpenioeilsls2ua( p;(0aeerio3iy1fm  luvols srxr(r ou1ale mnetls)arua(rp;u0tltoio3ils aDrauvp u4trtrmocoy1lmte u ils0t2trxr3oudale lfcslsfartaxr ;o1optomoctydfa rln snu4alxoxf oytlm eauesl(  2umxm oo4lpte feilt) Dur(  ou1apxnii3tadfsDrluvsnu4tltnio tytfateluvi;t) rtm(mpoo4alt lfvs sfsDtax onu1oet mo3iadfm2rluvo;(0aexoio3oadomt anvilt  2xrxo3nodlp elivtas sDraumont4tlto fetydla rlu sn()artrxf oydfmt li ol( s2xo(mpny1ll  lnvta(fsrumx o;t0olxnioeildls2umuvpn(4tlerxo iydfa  lueil( t2trim nydol nmietltfs2rmurp;o1aex  octls m2el(ms t4artnir iytlmD an o;s) rtr(m iodomenlnvsa( artm(  nt1aleomfcias s rmn p (0 rtnio3iatfatrluvi (0sexrimpnodam emfvtat  Drr(rooo1aex  i3iys sDul(mo t0trenif iatlaDeauvo ( s2xrirpoy4ape  icsatf Dur(rp;u1apen ieias s ulumsn() ltrifcta1oatrlivils0trurir oydol   fciatfsDtau pno0texoio3iys sDelumo t4 lxrio oadopt lnvi;()setm(m3iu1lpeelnet tfarrrumo;t4tpx mietatfaDum(mp;(0aleoxf ootlaDeaiei;s t2ur(m nodolen fvilsfa2tru  ou0oetoifciydfs2emnms ()trxrxr3oy1opt lnvo t0t2xm(m3oydol  lnet ( s2ur(r nu1tex moetydfsDeanvs;u4trxoiociotlp r n i ( trxrxo iu4lmtn neta()aDumxm ;o0opeomoctls sDrm(vp t0tlxnmrctydlp  aivi ()srtoxm3oy1om   ivs s arrmu ont1apenmfciatls rmn p (4arenmf3oy1fatrlnes;s0s2uoimpoydam nmfcsltf 2rm( o;u0texo ictad s2rlnmp u4trtrxr3iotfpt  ieo;s) 2urxm3io4olt  neta(  Dum( ono1olxnifetasfa2rl(vo t) eeomrctytlmtrluvs;t) euo(r3nydape  feiat)s2umu o;u1ape ioctadfs2el(mp (0 eeoir3io1oateauvilt tetrxr3nu1lp  mfct t  2tmx  ;u4oeenmfeiltfs2ranvpnt)aetrmr3oatlp eauei;t0teumir oo1llt lnvilsfa2rrxmpot1ale  ieildfm rl( pn() ltnif tatlm eai sl( sexr(r3ou1lpeemnetas a2rmur ;o0altnmi3iatlsDemump t) lermo todfp   i o t) etrxm nu1opeelfvslt)sDumu  ;o0apt moeiydfmDran s t)aetrxfcty1lateli sls0srxmimpny4om  lncsas)s2ta(r ou0altoiietlt m2rauvp;t)alerir tadfp ranei;s0t2toiopny1aptnmfes ()aDua( onu4optn ieiasfs ulu o ()texrir oo1lm  aivi;s trxr(o3iudlmtnmivsl()sDtmxr ;u1aetoiocilslm rmumo;t0alxnmr3io1lmtr ueilt seurxm3oudlltnmicsltf Dta(ro;u4tpxnmictlslm2rmuvp t0 exnif3tydlmD ai i;s s2tr(m nu1lmee ici t aDra(  ou0alx  i3iytlsDumn p;u0 rxrmfctytla   n olt0setmxopiu1lm e icia(f 2ur( ont4tle mociyt a rlu s (4 lxomf io1fmDeaivsl()texr(o3iodllt  fesl()srtr(m no0tpeo ietldfa elu pnt0 rtoio ootlat livolt) eurxm oy4ole  nvta()sDtau ono1tpt  fetld aDum(ms (0arxoxfctatoa eaivo;s)seumxr3oodolt lnci tf 2um(ront0olx iocilsfs umn snu0 rerxo oo1fmt li s () rxo(o3oo1am e fesas aDtmx  ;o4aeeoif3iltla2rmumpnt0 rtrmociydfa eaneo;(0srtr(m iu4al n ncsl()srtmx  nu0tpenmfeiytlmDumumon()alxoxf3ty1laDe neo;s0t2xoxm iudlp   nesl( sruau pou0aptn icilsls2ra( pn()aexoif3oa1lmtraivols s2xr(m3iydal nmfviatfsrraxmpou0openmoeildfaDulnvpn(0arxnxf totom r uvi ()s2uo(m oo1llee ics (fs2rmxro;u0oexoif3tld m uan o t)aeeoxo io1lmD lu ilt) rxmirpiu4lp nmfetatf rrm(r oo4aetomf3ilsla eluvpnu0 lenirciodfmDrlnvs;t)texoimpnu4opt mfvia(f Dumx pnt0opxoiictlt m2uau p u)aeenif ia1lpD ai sl(0seurxr iy4al elfciltfaDrr(monu4alen ocildfa emuvs u4artnif tadop r uvsls srxmxo iudomenmfetl()s2raurp;t4oeen i3iysla ua( sn(4artoio3iadfp  lnvilt0 2um(opoodoptn ict s) rua(  ;t1ape io3tldfs2ua(vpnu)aexrmociydlptelu s s0t2tr(m3nu4llt mfvia()srtaxmpou0alx io3tlt a2em(vo;t)tetoxocty1fmte ueol(0 exmxmpnydoptnlnvta() 2rmxrooo0oltnioeiyd mDrmnms;t4tlerxfctytop r i o;(0tetmim iydoleelici ()sDrrurpot4tlt mi3iys a umu pnt0tlxomocia1fp  anvo (0trur(rpnydamt lics t)srtrxmpnt1olen o3tydls2elumo;u0 lenxr3ia1fmt li ilt srxr(o3iudame  ncilt) Dtmxrpot0optnio3iyd sDuauvs (0 rxoxfciotfmD lnes t) exmxr3oodlm   ivsat  2rmu pnu0optniociydfs2uluvo u4tltnmociadfatelueilt)s2xoxr no4ape  fciat s2ur(rpno4texo fctadlm uanvs;u4trenmrcoadoatran s (  rto(r iudlp n nvs t  Drmur nu0olt  fcild sDeauvs u4 lenmr3todlaD aues;t srur(r no1omenlnvt tf 2ra(  ;t1oeeoiociasls2rlu s;u4aetnxr totlpDrlieilt)seto(opoo1ap nlfetl(f Drrxmonu4tpeomiciyd a em(vp t)tltnxfcta1optr uei t)t2xm(m nu4amte ivi s)arurxronu4oex io3iydfmDeaumo;t0 etnirciatlptran s;s)s2umimpio4ome lfvs ()artmxmpoo4tpx iietlsfa2eln o u0 eeoxf3oydlpDelnes;t) rur(r iydaltn nei () Drmu pno0alx ifciydls2rmnvs;() exoir3oodomtrlueols)t2xm(o nydapen fvslsfsDrr(monu0oex iictls sDumnmp;t4 renircoo1opD  uvo;t0trum(r3io4aptnlfes t)srta(  ou1teeomociadls uau snt0artnmfcio1fpt auvo ( truoirpoodopee iesl(  ruauro;t4oetoiietytlsDea(vs u)tlenxo oo1la eluei;s)t2xr(o ou1ll  mietl(f 2trxm ot0tpx moctltfs2ua(mo t)trtnmocia1op rliei;s trxoxopiy4apenlictltf 2tmu  ou4oeeo oeilslaDelnmo;u)arxrio oodfatrlnvo;(0t2um(opiu4olte neils arrrxmonu1oee ifctasfmDrl(mo u4 rxnmfcta1op rln i s)texoir3ou1oltemfcs t) 2tr(  ;u1ale  fetyd mDeau p (4aetnircoodlmD lieol(0t2xo(m oy1altnlfviatfarum(mono0altniociytfm eanvo (0 rtrir todfmteaivo t0sruo(m3nudlm nlicil() Drmum oo4oex mfctltlaDrm(vp t0artrxo tadopD auvo;s  2to(rpno4amtnlict s)a2um(rooo1apen o3tatfm2ulnvo;t0tlxnxf ty1lmD ln ols0t2toxr3ny1lltnlivs t aDtaum nt4aeen f3tyslaDua(vsn()trxrxf iodoat aieol( seto(mpoy4omt livsl(f Drmxmoot0tleomo3ildlmDean snu4texoxr oytfmDrau sls s2toxo3nodam nmnetl()s2rrxmo;t0openioetat mDrl( snt4 lenir3ia1oa   u o;s0trxoimpnudap  mnviat s2urx pno1ale iocils mDulnvpnt4 rtrmf totlmtrluvolt  rxrim iodaleemneias) rur(rono4openiicilsfmDuanvo;t) ltnmo ty1lmtraiei;s0 etmxopiydalenmfes ()sDrrump;t0optomfctatfa eluvs t4alxrmo tytlaD anvo t)t2um(m no4op   fvs (fs2uaurp;u0olt ifetyt a2umnvon()tlxoxocoa1opt  u sl()setmxo oo1optnmfei (farrr(ronu1olxo fctytfsDeluvs t) eenxrctytfm   i o;t truo(r3oy1ll  mnei t a2tm(  ;t4aeeomfetydfa uanvo (0trerxo ia1opD aivo t t2xoxo3iy4lm n neilt)srtmur ot0tpe  ieils a2ran o (4 renif3oatfatr ieolt0 eum(r oudam nmfvi ()srraumpnu0aexn octatlsDeanvp;u) etrxoctodoateln o;t0s2xo(mpou4om   netas sDtm( p;o1oet  oeilsls ea(vp;u4tltomr3oy1faDrli o;t) rto(opnydomtemfvia(f 2trump;u1olt mfctlsfm uauvpnt0tlxrxfciodopD li il(0setrio3iu4optnlfctltfaDur(rpot4ole iictyt a ean p u) lerio oa1fpDeau s;t srur(o iu4amtnlietat s2trxmp;t1aeto i3tat a2ulnvont0 eerxf3oodlpDr ieolt0t2urio oy4optnlfeilt)aDumumoou1oeeo oetls m2ea(msnu4trerxr ty1om r uvsl(  rumxr iy4al emfvsa()srrmu p;t4tle  feiatfaDelnmsn()arxnmr3iadfmD lueo (0t2uoxm3ou1al nmics tf rua(rpnu1tle mieiadlaDel(mo;t0 eenxf tytlaDeaueo s sexmxo io1omeelnet t  rtr(r nt4tpxo ietlt m2el( snu4altnmo iadoatr ies ()trurxo nu4ol n nesls) rrrxr no4tpx  ociasla umump;t)artoircoytlateaneilt t2trxm iodap emfei ( srraurp;u0tlto ictydlm2umnmo ()tltnxr tatlp e ueo t0setoir3oydop nlivtl( a2raxm oo0tlxnif3iyslsDumn o t0tleoxo ia1fp r ivilt0 etoiopou4optnlfetls  rtmxrpno0tetoiietldfs2ulnmp (0aeeriociadop r n o t) rxr(rpnodamtn iviasfsruaxrooo4aet mfciadla2rm(von(4 leoiocoo1lpteanes s  rtrirpoodam   nvsl()arurxr oo4ale mi3tatla rlums;(4 exnmr3iotfaDrln o t)trtr(opno1om e fvs sf 2ua( pou1aee iieias m2um(mp t) ltnir3iy1fpDraieo s  exm(rpoo1ap e ici ( a2rr(root0tpen feiyd m rlnmont4 etnmo totomD  u s s) etm(r3oodoptnmfcta(faDtmx o;u1tle mfctydfm2ulnms;t0alxrioctotfmtr uvslt t2umir3oydlm n nvslsf 2urump;o4oexnmf3iadlaDuln o u)alxnxo3iadlp elueol(  etrxm ou1am   fvs () Dtaxm ;t1tptoioctltfmDrmnmsnt4aeeoxfcoodfm  ai s;(0t2tmio3iy4op   fet (fa2tr( p;o0oltoioetldlm rluvp (0 rtnxoctydoat lues t)texr(m3oo1lpt mfeilt  Dtau p;t4aetomietydlm2elu p;t) reoifcty1fmtrai i;(  2uo(opiu4op  mfcias)srtau  ;t4alt if3ildfs em( s;t) rtrmr iodlmt lues t0teuo(mpoy4om nlfviat)sDumx  nu1optoioctyt sDea(mo;(0tlerxf totlmtraneols)trxoim3ou4lmtn feil() Dururoou1olt  oeildfa emu s t0artoio oadlmt au s;() 2tr(m io1ol e fei t)aDuaxmonu1aet micias mDuau o;(4alxnmrciotom  livi;() 2trir oo1ope mncta(fsDtmumpou4olxomi3tyd m eluvs (4aeenmfciotomtelivi;s  2xr(r3nudomeemfct t  rraxronu4aleo icild m2umn s;t4 rtomo3oatfmtrlu i s0 rur(o3iodamtelnctat)arrru onu4tleomo3tyslmDem( s;u4treoio3oodfpDelu i;()truo(rpoo4omtnmicia(faDurumoot4tet  i3iys aDem(mpnu)alxoircoo1laDe nvsl() 2to(r3iu1oltelfetat  Drrx pnt1apt if3tlsfaDel( p u0aexnmfciadfatrlneslt)srur(r iodamtelnci (f ruru o;o4tpt mfciytla ua(mp;u)arenmr3todlptrlueolt0s2trio oy1lmen nviasfs2rmu poo1apeomi3tls s rmumo;u) eeoiociodoa ean i;t texrxo iu1amt lfei t sDumxr ou4oeenmi3iatlmDrln s t4tlxrmf3oodlp elu o;()srxmio3no1amen iesasf 2tru ont0opxnio3iytfa2emumsn(0aetrir iydfp e neo t)texrxr3oudal emivsls) Drrxmp;u0opxniieiydfm ranvont0 exnmf ootom  aues;(0 rum(opnudlmtnlnvilsfsDrm(mpou1olenmf3iysfsDua(msnu4texrxrciodfpDr u o s) rxrxm nodlptnmivs s srua(r ;o4tleo fetldla2rm(mp;(0 rxoirciadom  lnes ( tetmxr oy4lpee fvils)srraum ;t1apx ifciat mDrmumo;t0tlxrxrciotomtr n i;s0trxoxo3nu1opt mfet s a2tmxmp;t4oetoiocias mDeluvs t)alenif3iy1lm rlu s;t)srtoxm oudam  mnciltfaDua(mp;o0tltoiietldfs2ulums;t4tlxrxo io1op  luvs;()s2xoxr3ny4amenlnvias) ruru pnt4optn fciat a2ul( o t)trenmr iatla  lnes t0 2toio ou1am   nvil(faruaumpnt4tet  ieildlaDeau s;(4 exrxf totoptraueol()s2trio oudamtnmivi t) 2rm( o;u1opxnioeiysfm eln s u0alxnxo totoaD lnvols0setr(rpnodlm nmfeia(fsrtmxmpoo1oexniieiyd sDua(mp t4tlenmr3ty1optr i ols)t2xr(m no4omeelfvi s s2rmxr ;u1tleoifctlslm2uanms u)tetrmo3oatlp  li s s0srumio3oo4altnmfetat) 2tm(ro;u1olen o3tadfs2rmuvp;t) etnif oo1fm   ueo (0 2trimpoy4amenmnct tf Durur ot0ope ifcias sDua( on()texrxocoodfa rln ilt0 2uo(r iu4olt lfes (fsDtrur ;o0oexn f3iyt mDea(mo;(4texrmo ootoptranvo;s trxr(opoy4optelfet t  2uaxmpot0tlt  octysfa uanvp (4artnxr iadopDrauvsl()s2tr(r io4omte ncs s sDrmxro;t0tlxnmo3iltfaDrmu o t4teeriocootlmD lnes (0 eto(r oudllenlfvt s)s2tau  ou1tptniociasfs ra(vs t4trtnmo3tatfmt aivo (0tetmxo3oydll nmieias) rraxmpno1oeen o3iydls2umnvp;u0altrmfciotfate ieil(0s2tmxm3ou1opte ieiltf 2ra(mpoo4texo fctadla rmu p;u)tlenmr3iadom r uesl(0seuoim3no1amenlfvtat)sDra(mo;o0alt  i3taslsDrlnvp;t)areoif3ia1fp rln o (0 2tr(opiudlm nmfcilt)sDtaxroou0aet mo3tydlaDua( on(4 rxnxfcoodomDeauei t0 rxo(o iudol nmfeiat)aDuax  no1tpt io3tlsfa uanvo t4teerio3iadoa elnesl(0 2xr(o3nu1opee ivsl()aruaump;o4teeoifeiytls2rau s;(4 rtoir3oy1fm rlneolt)s2urxo nu4ope  iviltfsDrauronu4optnmi3iasfsDeanvs u)trxnxf3iytfaD auvilt)t2umir iy4omte ivt ( a2ur( ono4alenif3ias s2rmuvo;() rxnmr3iatoptrlivs ( trxmim oudope mnctls a2taumpno0opxnmoetydfsDemump;(4 etrxr oa1la e uvi s s2xo(opnodolenlnetls) Dtr(mp;o4opx io3iysfs rau o;u)texrxo3oatlptrluvil(0t2trimpoy4ome  fvia( s2rru pou1olt  o3tas s2elnvpn()altnxfciytfp  aivs;() euoxr3no1lme mneia(  2urx  nt1aexo ieildla2rln o ()trenmf3tytlpt  u il( teuo(r3iy4am nmivs ()a2raur ;t1apeomiciysls rl(ms;t0tltrxr io1lpDeluvil(0s2tmir iu4olt  ncsas sDuauroou1tltn o3ildlm2eluvsnu)tetoifciytfa e nvs ()tetmxrpnudap  mnetat)s2ua(m ;t1aexomfeiyslm2rau s;()aleoio iy1fa r i i;(0 2trio3no4am   ies t)sDtax ont4oeeo f3ils aDemuvo;()alxomr3ia1lpD an s s  2to(m3nu1ape mfciat  2trxroot4tex mo3iytlm2emnmpn()altnmr iy1laDr ivils trxrirpoo4amenlfvi (f rrmx ooo1aex  f3tadlaDemuvo;u0 rxomf oydlaDeaiei;t) 2uoio oo4oleelfci tf 2rru  ou1olto ietat a2emums u)tleomo3oatfatrauvs ( s2trio3no1lp  lfvsl() Drrxr oo4aeenmf3ilslmDelnmsn()arxrifcoa1lmteaneo (0s2urxmpny4al   nesltfa2trx o;t1olxo ieiysfsDelumsnt0alenmfctytfp eaivo t0srtmxo no1ap e icsa(  Dtaumpot0tpxniocild s2rm(vs u)aleomr oytlateaues;( t2tr(m3nydol e nvsa(  rtm(r ot1tleo fctaslm2el(msn()areoirctadfa elivol(0s2uoio nu1opeeliet s) ruru pou1tpe  ieiydfmDeau s t0treomfcoa1fpDrluvi (0 exoxo iudal   ivt t  rra(rp;t1tpe ifetydfs uan s;()artoiociodoaDelivs t  ruo(opnu1llt  netls)s2tm(  ot0tpt ifcildlm emuvp;u4 leoxf oydfaDeln i;t)srxmxopnudllt mfvilt a2tmu  ;u0oet  ocilsla2ulnvsnu4alxrifcty1fmt  nei ()t2xr(o3iy1op e ieils  Duaxmoot4tlx  fciytfs2el( onu0 reomrcoytomte ueils)trtm(r nudaltnliviasfa2uax  nu4tee  o3iytfmDumn pnt4 rxrxo3tytom rlnvs;s) 2ur(o3oudlmenliei tf 2tru onu4tpt  feildla ul(mo;()texrif todomtrlivols0teumxo nu4lm nmncia( arrmurp;t1tpxnifeiad a2uluvsn(4 rxnmfciadlpDe i ilt0 rumiopiu4om nlics s  rua(m ;u1oeeo i3iysla eanmp;() lxoxr oo1oaDraies s0srxr(m ny4lpee ietat a2tr(m oo0aeto fcild m2uln s;u)alermf3oatlmD lieil() rurxo3ny1open ieilsfs2taxmpno4oeenioetysfa rmuvo;u0aexnmo oa1la eai o s0srtmxr no4olt  netl(  rtmu onu1oeen ietldlm2el(mon(4 reoxfctydopDrai slt0 rxoir3no1llen nciasf rtrxm nu4apxnmo3iadfs ea(ms;t0alxnmr3io1opDelnvi t0 2xr(r ou1am e ics t  Duax pot1apx  f3iyt mDrmuvp;t4tltrmo3ia1fm ean s t)srxoir3nudopt mfei t)a2rrxrpno1texo ociyt a ea(vsnu)areoxo3oytom e ivo (0t2um(r iy1alt mfcs t)aDrm( o;o0openiieilsfsDrm( pnt4 leoxr todla  lnvs;t)srxmxmpoo1llenmnct s)sDrr(rpot0openio3ilsfa2elnmp;(4arxrxf ty1lmt  i i s)srxmim3oo1op elfeilsf 2uaumo;u4tpe  ociydfa elnvp t4teenio oodfmtr ues;()setrir no1omte neils sDtmu  nt0ope if3iys mDrm( onu4artrxr iytfpDelneo;s  rtoim oydop  lfvslt)a2rm(rpoo4aeto f3iatfaDrl(vont0 leoif3oadlmD  uvo t0trxm(r no4ol e fesas aDtrxr nt4opeoioeiatfaDumuvpn()aeerxo iytlpteli s;(  etrxm3oo1ll emiet t) 2taxm ou1aexo fciydfsDuluvs;(4 eenxr3iydlp  aivsl(0trxoim3ou4om nmietls  2urumo;o0apeoifeilslm ea( o;u)aleomf3iotlaDe u s;s0tetm(o oo4ll   ics sfs2umxr ou1tpxomietasls ul( pnu)altoio3oo1lat lnvs t)trtoxm3oodal  mfcils sDumxmonu0olxo ieiatlm ulnvs t0trxrxr3iadfp rln s s) exm(m iu4op n ieilt s2tmur no1apx mfeiytls eln s (4 rxrmfciadomDelu o ()setrimpnudlpe  netasfsrraurpnu1tee  oetysls2uluvs (4aexoxr3tatfpDeln s t0 etmimpnydom nliesatfarrrxm nt0ope  iciatfmDuaumo t0 rtnxfciytlpD  ivi;(0s2xo(r oo4ol n fcilt) Drmx  ;u1tltnmiciad aDraumont0tltnio3oydlm  ai o;() eum(r iudlm nmiet (fsrrrurp;u0apto fciat a eanmp;u) lenif3oa1fa r uvo;( srxm(m oo1lmtemncilt s2ra( ooo1optoiiciysla2uanvs t) reoxr3tatfpDr i o;s)t2xoxmpny1ole liciasfsrra(mo;t1texoiieiaslaDranms;(4 exnifcoatfa rauvo t) exoimpnudopt mnvsas arrrx  ;o1tpt  octysfs2rlnmpnu4alerxr3oa1oa eaues;( trxoxr oy1ame livsls  rtm(rpou0opx mfcils a raump (0aleoxociydlpteaivolt)seur(mpiu4lmen nesat)aDtmum ;t1opt  iciytfaDrlnmo ()tleomrcoytfpt  ieo;(0sruoxm nydlpt mnctl()s2tm(m ;o4aexomociyslm2uluvs t4 renxrcoodomtean s;t)trtmxm3io4am  liei (fs2ua( o;t1opt  feiaslm2ean o u4 eerxf oa1omDr i o;s s2uo(mpoy1amenmieias aDrr(mp;o0tpxo o3iatfm2ea( s;()alerxr iadlp  anvsls setr(mpnu1om e ncs tfs2rr( ont1tpto i3iaslaDuln pn(0artrxf oydoat aieo;t sexmio3ny1omenlicils) ruau o;t4tptnmfeils a rluvs;(0 etoif3iydfaD anvo;t) rxr(r oudll nlfviltf 2raum nu4opx ioctlsla rauvonu4aetriocoo1fm  au ol() ruoio nydaptelnctas)srrruro;o4oetoiociysfa2ea(vs;()alxnmr oydoa eaneo;t srtoxmpoy1lpe mfetl()sruaxm ;o0olxomoetys mDemnvs t0 eeoioctytfaDeanvolt  2toxm3iy1olen fetl(  2rm(m ;o1aex  i3tlsls ranvp;u0 eenif3oadlmtranvsls t2tmxr3iodal nlfvsat sDrr(mo;u0alxnmfeiyd sDrauvpnt4 rermr oytlmt au il(0trtoir3ou1lleemnci (  2rrumoot4alenifeiaslaDrln o;(4altoxf3oa1opt  nvo t0srur(o3oy4amt mnvt t)arra(r ;o0texomo3iad mDemn p (4 ltoif tadfptrli s;( srxoxo3iydlmee ieslt) Durxmp;u4oexo ieiys a emump (4aexrif ia1fpDranvi;( sexmir3no4al nlfvi ()sDumxrp;o4alxn ociyd a2emumsnu4tlxrif3iodoa r uvolt0srxrio3ny1alt liei (faDrr(r nt4opxn f3iadfmDrmnvs u)arxniocoa1oateai il( setoxmpiudam emnesls)artaxrpot0oleomo3ildfsDrauvpn() rxnio oatlptrlnvs;t0srxrxopoo4aptnlnvslsfs2tmuront1tlt io3iysfs2umuvp;u4artomocty1fm   i ol(0 2to(o no4lmenlnvils  rurum ;t0oee mfctldfsDrlnvs (0texnioctytomtr u olt0sexo(r ny4aptemfeia()aDrr(  ot0apeomieiytlmDua(mo;()aeeoir3oytlatrln i (0setrxrpiy1ap  mieils  2uau pot1apeoifciys m2rlums ()tltnmr3iodfa  lneils) rtrir3oo4alee nviat) 2rmxmp;o1ape miciltla ua(vsnt)arxrif totfmtrlueo;()sexmxr oy1ame  icsls  2ra(  ;o4apt  o3ild sDelums;u4 ltrmr todoa rlueils0teuriopiydlpen nciatf ruaxm no0tex ifciyd s ean pnu0alerxfciytopt  uvol()t2xmio oy4lmtemietlt)a2rrum ;o1oetn f3tasla rl( s (4aeermf tadoa e nvils0srtoxr no1amtelnes tfsrrrum nt1aeenmfeiatla2rl(ms ()arxnmo tytopt  n s t)s2umxrpiy1aleelivta()s2tru oot4aeto i3tlsfa um( o u4 leomf tadoaDeln il() 2urirpiudole  neia() 2rax pnu0apt  fctatfs ean o;t)alxrxf3ta1lm rluvi s) 2xmir ou4lpeelnciltf 2uaxmo;t0alto oeiytlsDemn pn(0tlxoif tydfatrauvo t)s2um(opiu4openlnviat)aruaxmpot0opt ifeiytfs2elu o t0 ltrxo3ia1lmDe nes s  2umirpnu1al n fct tfsDtaxrpno4aexn feiytla em(mp;u4aexnmr3tadlpD ai s ()s2urxm3io4amen nesasf 2urumo;o4oex io3tasfsDea(vpn(4tlenmf3tytomteai o;(0s2toxm io1ape mnes sfartaxmoot0aeeo f3ild a rl(vsn()teerif3todom e nvil() etoxr3ou4omen ict sf 2rm(  no0oeenmfciltfsDrl( s u0tetnxociadfa eaueolt  etoxmpnu1omtemncs s)aDtmxmo;t0tptnmietltfa2ranmsn(4trtnif io1fa raues;t0 2tmxr oy4lmt lfvsls artm( ono0oex  fetyt sDemump () eeoio iodfmDrli s;s0tetm(mpnu4ol   neiat) 2umx p;u1teeo ieilt a uanms;(4alxomf3iotla e u s t0sexrim nodol nlnvs ( srtrxr ;t0aptn oetysfm2ra
\ No newline at end of file
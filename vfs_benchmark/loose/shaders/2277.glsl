@@ -0,0 +1 @@
+ivsls trtmxr3no4lpenmfeilt a2umum nt0tptnmo3iatfsDrl(mpnu0trenmfcoytoatrlues;s t2xr(m oy1ole  feilsfaDrm(moot0ale mo3iys m em(vpn(4trerxf oydlm rlnvi t)srxmim iy4oltnmnei sf rraxroot0teen fctys a em(mo;(4aetrxo3oadfp raiei ( srtm(m3nydalt lnetlsfarrmuro;t4teen feiatlmDumnvon(0tetrir3tatfa  aivs t) rxm(m oydapen ncias)arrr( pot4tleomfctltfs rlnvs;t4alenifctotoat  ues;t0srxoir3nudaltelivta() 2tmxr ot1tlxomfciltfa rlnvp;()aexrircoo1lm r uei ()t2uo(m oo4ll nlfci (fsrtrxmoot1tleoiieiadfaDumums u0alenmr to1fmDranei;t)seuoim no4llen fesl(fsrtaxmpnu0aptn oetad m2eanmp;u)artnmf3oytlmDe uvo;t0sruoxm iudlpt  ieias srraxrp;u0aexnmf3iadfsDem(mont4trtoxo3tadfpD luvs;t  rxr(r oudap   nci t)s2rr( oot1oetnmfeild sDrm(vp () renmocoodopt lueils) 2uriopnu1amte ivsa(faDrm(r nu1oexoio3tas mDulu p;u0aeeoif3oy1lmteluvil( seuoxm nu4lme mfvia(fa2rm(r oo0oee  fetysfm elump u4trermocio1fmD  nvo;(0sexo(mpno1lptnmnct (  rraxrp;o0tptn icilsla uanmo u0 reoxfciodla rln sls0srxoxm3nydlpenmfvs t)srtrxr ;o4open iciysfs2eau p t0tlxomocoytlp   n s s teurimpnudlmeelnvtatfsDrr(mpno1tpe  iciad a2ul(msnu)treoiocoo1oa rluvo s0srumir nodopeelfct t s2rrur nu0apenmieiysfa2elnvs;t0tltrmo iotfmteln ol() 2ur(o3io1opeelnvt t  2ur( ono4tpxoif3tytls eanvsnu)areoiociy1fpDrauei;s trum(r3ou1ol emictlt aDumx o;t1texn oeildlaDua(ms;u4artoxo iy1fpD luvol( sexriopou4opt livi t) 2ua( p;o0oeen i3iys a emnvs u)artoif3iydfm rln o;s seuoimpnudolen fcil() Draumonu4aee io3iyt m2emu o u0arxrioctadfpD  u il() ruoxm3oo1amen fesl(fsDurur ;o4olt  oeiydlsDrl( p;t4tlermrcia1late iei;s)sruoir3nydapenmfvs t)srurum ;t0apt  f3iyd a2uluvo u4aeermr3ia1oatelueil( trurxopio1openlfvslsfartmxroot4opxoiociyt a eluvsnu)aleoif ty1optelieo;() exmir3io1openliesatfartrx  nt4apt  ociys m rlumsnu0altrirctatlpteln s;()t2xo(rpny4omteliesa(  2urxmo;o0aee  fctas a rmnms;()alenmo3tadfmte n ils0t2toim iy1olte ieta( s2tr(m ot1apx  fciys sDua(mp;t0 reoxrciytoate uvi t  exo(o iy4op nmies s)arrmumpno4tetn f3iadlmDra( s;(4 exrxo oytomtranesls0tetoiopny1lleemfct ( artaurpou1tet mocias aDra(vsnu) etrif3iodop   i o () 2tmim3no1ol  mnvtls arrax p;u4oetomfetadfa2rl( o;u) renmr ootlpt livols trxm(o oy1lp elnciatf Drrxr ot4teto ociyt a2rlnmpnu0aeeoxrcoy1lmDelnvo;() rxmxo oo4om  lfvt (fsrraxm oo1altnifeiasfsDrl( o t4alxoiociatomt ln ol(  2tmirpiodlpe mfvslsfaDtau  ;o0alx iictad a rm(mp;u0tltrio todlaDr u o s)t2tm(mpiy1apeemfcsls) rumump;o1teeniietasls um(vo (0 etnxr3iytom  lneo;s srxm(r3oo4altemfcsasfsrtmuro;o1alx mfetyslm2rlumpnu0 reoif oodfmtrau sls)seurim ny1lpe lneilt sDrr( o;o1oetnmi3iatls2rmnvo;(4tlxnmf3oytlmD aueil( sexmxr3nodop emncia( arrm(rpoo4opx  o3iyslm rau on() eeoxo iatop e n slt) 2uoxr nu4aptelfcs t)srrmxrp;o0alto f3tat a2uluvpn(0alerio3to1late ivo;(0 rtoxmpno4lltnmiesasfarrr(  nu1aex mo3iytla uau o u4aetrmf3oodopteli i t)t2tmirpou4amenlictl()arrm( oot0tltomo3tlt s2emnms;u0tlenmfciytfa elnei;t seurxo3nydom n ieilt)s2ua(  ;o1tleoiieiadfmDrlu sn(0aetniociotlpDrauvil(0sexr(r3oo1op  liesas sDumxroot0alx  i3tytfa2em( o;(4teermfcoadla   uvs;() 2toxrpny4lptn neils) 2uax ont0oltoiocias a2elums t)arxnifciytfa  li i;t0srtmir iydap  lict s  2ua( p;t0oex ifciys mDrl( pnu0altnir3iodfa raues;(0sruo(r io4al nlivi ( aDrm( pno4tpxnmfeiysfa2eanmp t0 eenmf3ta1oatrlu s s s2xoxmpoudoptnliviltfaDtrumoot0aetomieild s rl(vp t) rtnio3oo1fateaivs;t srum(mpnodap e iet s) rumxr ;u4tee mfctys mDrmn s;t0aexoxf3oodlmDrau i;s) rxm(o3no1ol  lics () ruau poo0apenifeiadlaDel(mp u0 reoio3to1lmDe uvil( texrimpiodlp  lfvilsf Dtrxr nu1tlx ii3iyd a2ua( o t4altrmocootomDe n i t sexmir3iydomtemfeia( a2rr(ro;o1aexo fciadlm elnvo t0tetomo3tydfpte n ilt  2tmim3ny1oltnlnei (fsrurur ot1optoif3iydfaDelumonu4 rxrxr oa1opD  nvi s)trur(mpiy4amtnmivi tfsDur(mp;o1aeeomo3tydlm elnvo;(0 ltnif3to1faD anvs s  rtrirpny4omee ncia(f Dta(rp;o0apt io3iydlm ea(msn(4aetoxfcia1oa  lneo;(0truoxopiu4lpe mictasf Dta( oou0tpx iieiytlaDemuvon(0texomr3oo1fp raivs;( truo(m no1lltelfcsltfsrumum no4oee iietyslm rmnmo t)aexnmr iydfpDeaivs t0setriopoodlmeeliei ()s2ta(rp;u0olx  i3iasfsDumn s (4teerxo3oy1latelneo t)sexo(o3iy4lle  netas artru o;u4aleomfeils a2uluvp t)trxrxo3iytfpt aueol() ruoxr3oydllt  iviltfarra(rp;u0aptniociatlm uln s u0trxrio3iy1lmtrln ils0texm(r iu4om  miviat)a2ururooo1apenmfeiysfs rlnmp;t)arenio3io1opte nvolt)srxrim ou1ope mneils) 2umxmo;u1texnio3tyslsDeluvs;(4trxoxf3tydopt anei t)texrio ou1ol  mfci tfsrtax poo4apxomi3tad a2ul( p;t4teeomr todlpD lneo;t) rtoxm iy4omenlnet (f Dtrurpnt0alt moetldlaDeln snu)arxoio iy1la rln s;( setmir3oy1amtn ivslt)s2umx  ;t1oex  ociatlsDrlu o ()trtomo3oo1faDrluvs;(  rto(m oydlleelfei s) 2rr(r no1ape mi3tadfs ea( snu0artnxf oy1lmDe neils  rtm(mpny1lme lnvsls)aDrax  ot1apxoio3iad m ul(mp;t)aexnmocoy1oaDe u sls)seuo(m oy4al   ivilt)a2tm(mooo0tlxoifciydls2ul(vs t)tlxrmo3iadfmD  i sl(0trtrxo3iu1ameemfvs ( arrmx pou1alxnmo3tasfm2umn snu0tlermr ty1omDrau olt0texoim3oodam e neilt artm( p;o4aet mf3tysfs2eauvon()trxoxr3oytoa r uvsl()texr(o3no1omtelfct t) Duaxroou4oee mfciatfs em( s;u) renxr3todlpDran sl()s2toir no1lmenmneils sDua( oot4oeeomfetatla2elnvsnu)treoxrciotlptelues t)seurio3ou4apen ivs s  Drrur nt0tlt ifeiad a2um(mpn(4tltnmo ia1lpt aueils) rxmxopoodll  lfcils)a2ra( ono0tlxnif3iatlaDeanmp ()arxoio oodlatean sls0texm(opnodope mnetlt  2trxrpoo4olenmo3iysfm2el(vo u4artrmrcia1omDeauvs s srtmxm io1om  licil(fa2urxroou0tpx ifeild a2ulums;t4 lxrmrcoo1lm e uvils)teurir3iydlp  lfcias aDur(rono0teeoii3iadfaDulump;t)tltnmo oatopDr i o (0 2tr(o3iodllte ieiat) 2ra(mpoo0texomictld aDumn ont4alxrmf3ty1fa elu i;()t2tr(m3oy4om emiesat) rua(ro;o4optn fctls mDem( p ()tetnmrciatopDraueo;t0 2toio3oodal elfei sf 2rmx  nt0oleniocilsfs raums;t)tlxnmrciytfm raneils0s2uoxm oy1omtemnvia(faruaxm nu1oltoio3iyd s emu p (4altoif3oadlpD  uvi;s)trtr(r3iu1olee fctat arta(  ot1olxo octaslsDem(vo;t0trxrir totlm elu s t s2xrir3iydaptelietat a2raxmonu4apen ociad sDumnvo (0 ltoir io1op eaues;(0 rxoim nydame mies t) rraxmo;o4tee  o3iyslm emnvp u) rxrif3iodfpteaivil(0t2uo(o3oudamenmncils)a2rr( pou1teeo o3iytfa2rmu o;u)aeerir iadoptrlnei;s0teur(r3nodamenmfcilsf Durxmono0opx  ocils s2eaump u)tlermo3iotfmtr ueo;s s2urxo3iydap  miesat)arraxm ;t4oltoifeiys a2ea(mp (4alxrxr iytomDeaieols0s2xr(o3oy4al   ivsasfs2rmxmoot1tleo f3iysfsDrlu on(4artrirciadomDeaiei;() eurxm no4llte nesasf rururonu0optniieiltlsDeanvonu)alxrio3oydom rlues t0t2toxm3oo4alenmfvt s arurxmoou0teeo o3tldls uauvs;(0arxnmr oadfa r i i;(0 etoxm3ou4alt mivsa() Duau ono4alx iiciadfs2umuvo;() exomocto1omteaivsls0trumxr3ou1om emicslt aDrrx ono4optnifeiyd sDumu onu0 lermf tadopD lieils sexo(r io4omenmfvtlt) rrauro;u4tex moetydfmDea( on() ltrifcoa1fm eaueo t s2uo(opou4op nlnvtas) rtmx pno4tpeomo3iatfs2eau p u0arenmr iadfa rau o;s0seuo(o oodamt mnei t aDtmuronu0tptoiieias mDranvo;t4areoio3iy1op   i o;s)setoxm3iy1apenlivsas) rrmu onu4apt if3tlt m2ran pnu)trenmfcootoa  lnvs;() etoio3oy4omt  ivslsfsrum(monu0oeeniieiasfs2eau snt0aeerifctatfp  auei s) rtr(m3oudlp nlfctat  Dumxrooo4tltnmictydfm elu sn()altrmr iodfateau s;()setrxo3nudllee fctat)srtmxroou4apto oetydlaDeln s;(4tltrxrciydoa ranvs;t0 2um(o3nodlpe lfvtasfsruau p;u4olen ieiatfa eauvo;u4texrxo3oadlmte u o (0srxrxr iu1apenliciat aDrauront1olt io3iad a2ranvp;t4arxrxr3iatlp   ivi (0 2to(m nodomt liviatfartr( pnt1alx  icildlmDul(ms;u)altnxf3oodom e ivs t t2tr(r3iu4ll  mfvsls)a2tax poo1aptn f3iad m2rmnvs u0artnir3oy1fateluvi ( setrio ou1al n ivi ()aDuau  no4tleo oeiasfs2umn p;(0altrmo3io1lptraivi (  rxoxmpiydlpt  fvta(  rrax ont0tpx  i3ilt m elu on() exriocoadoate neo s)seumxm3iu1optnlnvi tfarumur ;t4tleomi3tatfa el( onu)tleoif iodfa eluvsls  etoxopou1olee nvtatfaruau  nu4tlxoiiciasla2ean s ()aetomfcoo1lp e ivils0 etm(m iu1altnlfesas arta(rooo1tlxo fctadfmDrlnvon(4teeomr3todoatr i ilt  exrxr3oodllenlfciat a2umx  oo1ope  fetlsfs2ua( pnu4tetnmo ootfaD aies;( setoiopno4op   fcslt sDrau  ;u4teenmfctlsfaDulnvsn(4tlxnmr oo1lpt lieolt) 2tm(r oy1am e ncsl(fa2rrurp;t4alxnmf3iysfsDuanvo;(0tleoif tatlpt livs s)s2xr(o iodomtnmnviatfsDurx pnu0oex mfetysfsDumuvs;(0 exoxr oatfa raueilt)s2trxrpnu1ape licia(fs2tmuro;u4opeo o3iadfm rmuvsnt0 renxfciotop  aues;t seuo(m3oydlmee netlsf Duaxr ot1tpxnii3iys m2umnvsnu) lxomrcto1lptrluvi s0t2um(r3no4ap  licslsfs2tmxrooo4oexnmoetatfaDrau pnu)aleomr3todfpDe uei s0srxm(m3iydamen fcsl(  ruau o;u1opeoioeiys s eanvp;t4 rxoiocoodomt aivi s)seur(r3ny4ol elivsltf Dumumpoo0aetnmo3iyd m umumsn() exomo oatfp   neils0 2trxmpou1amt  nctat)s2rr(mpou4aptoifciaslsDrm(vsnu0 exnxo3oatfmtraneo s truoxm oudal emfvsls  ruaxr nt0aeeoiocildla2rlnmp;t)alxrmrctotomtr n o;s srxm(o no1ome mneilt  rtrx  nt1alxnifcildla ranvp;(0alenio3iydfmD au slt)sexrxrpnu1lpte ivsa(fa2urxm ;u0tlx  icildfa2rm(ms ()aeenio todlaDrlnvo;()seuo(mpny1ol nmieilt)s2uaump;u0tlen ietasfa2ul( p;t) eermr3iadlmDranei t) eumxrpiy1altemfesl(faDum(mont4teto f3tltlm2ulnvo (0 reoxf oydlptrlnvo;( texm(r nodam elfesat  2rru  ;t0opxn feiltlaDraump;t) rtoir3todfa r u o;s0 rxmio3iu4altnmivs s)aDuaxm oo0ope ii3iatfs eaump;()aetrxrctatfpte u s (0sexoxo3oo4lm  lncsat)sDtm(  nt1oeenifciatlm2ul(vsn(4trxoio oo1lmt  i o;t)seurim no4ape lict tf Dua(  ot0alenio3iltfsDrau s u0tleomo3todom ranvs;( s2tr(m3io4apee fciatf ruaur ot4oet  oeiatla ulu pn()areomr totom ean o (0tetm(o iudlp n fvsasfaDuaur ;u1oexomo3tyd a2umumo;u0 lenirciytfmDe uvol(0 etmir ny1ope  ncslt sDum(mpot1aee  ietas m ranmsnu4aexoxf3iatlaDeaivi s) 2to(m3iu4lmeelnvtlsfa2rr(m ot1olt ii3tad a em(vont4 rerifctatfp   u o;( s2urxm3oy1lp   fctat)s2trxmoou4oetomictytlsDemuvpn(4aetoir3oydom  luvs;()srtoir ou1amenlivtlt)aDum(rpou4aeenifeiasla2ulnmp u)tltnmr tydlp rlu s;s  2umxopiydol n nvs ( arumx  oo4teenmi3iyd aDul(mp;(4aeeoir ia1omDrluvs t0trtmim ou4op nmiesa()a2tmu  ;u1tlen fciysla2ulnvp;u4alxnxocoytlat  ueil(0seurir3no1lme lncils s2rmumooo0tle  oeildlaDrl(vpnu4tlxrio3ta1faDraneil()s2urio3io4ap nlnetlt  2rax o;t0tleo fcilsla2eaump;() rxrxfcio1optrlu o;s) etmxrpoodamenlnvsl(fsrrm(r ;u4alenii3ilt a2ua( snu0 renxo ootlmt  n i t0 rtr(r no4omeelnci sf Duax oou4oexn ietld s2ranms;(4alenmf3iy1op eli sl(0setoxr3no4lp e nvtat  Dra(  oo0tetn i3tasls2uauvp t0 lerioctytlmDeauvi s)tetrir iydome  fvias  Dta(moot4aee  iciyslmDulums;t0tlerxf3iydoptran i;s  exrim3nu4omeelfvslt) 2raurp;o4oee ii3tasfa2rmu o;t4trxnxfciadoa e nvi;(0srxriopnu1lmt  fvi t)artrxmp;o0aeto oetls a umump;t) exoifcoy1lptelnvols0 eur(opnodop elneta(fs2rmuro;u4tlt  i3tadfa rmnvo u) ltoifcio1fpt luvs;t0 eto(m3iodomeemfes s) 2ta(  no0ale if3ils sDua(mp;u0tetnir oydfp  livs;s t2xrxopoy1apee icslt  2umur no1tet  f3tad s rlnvsnt4tetnmr oytlaDe uvi () 2trxr oodop nmfvi s) 2rr(rpoo4ape mfciyd m2rmnms u4altrmociydoptrauvo;s srxr(m3io4amteliesl(fs2tmump;t4aetnif3ildlmDea( onu)trxrio oydomDr i i;() eur(o3iu4apeemfesasf rtmx o;t4apx ioeiadfmDeanvs;()tlxnmrciatop rli ol(  2xr(m3oydalte fcsl(fs2truront1aleo oetyt s2rlu p t0tlxnif3tydomtr ues;s  2xoxr nydameemivtatfarurur ot0tlxomfeiadls rl( s;(4tlerio3todoa eauvi t seto(o oodll elnviat) Dtmu onu1tpt ioeiytfa2uln o ()arxoxf iytomDr iesls0 etmimpou4amenmfcilt artru  nu4apeomieilsfa uanmp;u)tltoxr3todomtrau i s seur(r3oudll   feil(farrr(rp;o0tlenmoeilsfmDuln s;(4tetrxfcto1opDe ieolt0s2tmio3no1llenlncilt)sDur(r nu1oeeomfcilslaDulump;(0 rtoxo3oa1omDeln s;t srxrirpiydlmenlnei tfaDtr(mpou1apto fetydfa2uan o;t0trenxf3oydlaD aueolt0 rxmxm oodalenmfcils) 2uru ooo4alx  ietasfs rl(mo;u0 rxomfcio1oaD an i s s2toio3oo1al emneta(faruru ono4oexn octydfm2eanvs u)tlxoir3tytfm  anvo () 2umio3iu4om nlivt tf Dtrumpnt1oeen f3iysla2ra(vp u0tlxomo3iatomDrluvolt0t2umxm ny1am elnvt tfa2uaump;o1tpeomf3tasfm2uanmp;t) eerxfcto1op e u i s texoxm3nodlmtnmicilsfs2urx ooo1aet iociatlm2elumo t0tleoir3ty1fp   ueols) 2xrxopoy1aptelivia() 2urxr oo0openmo3iysls eanvs (0arxnxo3iy1fpDrlueil(0 rxoxr3oy4ap nlnvsls s2rmur ot4oexomociydfm2rlu pn(4teenxo oytoaDrauvols0setrxo nydope  feta()sDurxr nu1altnioeild mDuanmp () rxnio3totomteauvo;s0sruoimpiudlp e ivt s)srumu oou4alenifctysfm eluvo;(0 eermo iotoat  i o s)s2to(m3ny4om e fctas)arurx oou0tpe moeiatlm ranms (4tlermr oo1oateai sl() eurir3nu1am emnci () Dtrxmoou1opx mietadfs emuvp;u) rxoif3oy1fate ueils setrxm3oudopte nvta(  Duaumono0tpxnmi3iydla2rlumo;t4trxnxrciy1om elueol( trurio3no1lmee ivtatfsrtrxroou0aeeo oeiatlm ulump (0arxomocty1laD lueol(0seur(o3oo4lpeelnctas srurumont4apt mocilsfm2ulums (4tetrmf3iadlpD  nvi;(0 exo(opoudlm nlnei (fsDra(rpno1olxo o3tls sDrm( s (4alenxocoodlaDr u ols trtoxmpoy4lmte nvslsfaDtaxr ou0tpxn ociad a2rmnms;t0 lxnmf iotfmtr uvsls0 2xmxr3iudame micil( s2um( ooo0aptomo3ils aDemn ont4 exoif oy1opt anvi t) rtrim3nodamtemicilt  2tm(r ;u1oee  fciydfs ranvo (0alenmf3to1lmDe u ilt0 etoxo iy1om elict tfsDrrx ont1apxo iciysfm rau o;t)trenxo3oa1oaDeluvil()t2tm(r ou4lpt mnctls aDur(r ;o4alt  oeias s rl(vp;(0trerio oa1oaDe uvo t0s2umio3oy4ame  ncslt srtaum no4ale ifciat s rluvp t0 rerxrcoa1fatrln s s0s2xrim3no4op n iei sfsrta(rono0apenmfeiltfs2ranmpnt0trtnioctodfpDrau s t0srxo(m no4am elnei ()srum( oot0ale moetytfm2rm(vp u) exoif oy1oaDrlivsls0setrim oo1optelnvtlt sDua( onu4aleomoetldfs uau o;()alenir3io1fmte nei t t2toxr3ou4llen nei (farrmum ;o4tlxn oeiyslaDeanms;t)aetnmr to1fmDe n i s) rtoxm3iu1lltemnvils) rtm(ro;u0tee mictatlm ulnmp;t) rxrmf3oo1fpteai ils  eur(rpnydlpeelietas  rtaumpou4tpe  oetldfm2ulnmp;u4trenif3iydlp r ivi s0 2urio iu1omee fvtls aDtm(roou1alto octytfaDrmnvp () exoio3oy1fpDrauvi t  rtr(m3oydam  mncsls  Dtm(m ;t1tpt mf3ild aDuan sn(4aeeomf iatlpD lieo () eurim oo4lmenmnetl()aDuaxmo;u0alx mfeildlmDrln o t0 lermrctodlmt au o s t2xrim3no1lpeelnesat)aDraumont1tex ioctltls ul( sn(4alerxfcoydoatr n o s trtr(mpno4ol n nci s)artrxrpot0tet  ociatls2rm(monu4tetomfcty1op  lnei;s0s2uoir3iu1lm elfvi (  rum(rono0aetomi3iltls ulnvo (4trtnmf3io1oa  livo ()trumxr3io1lpt  nvtl(f rtmumpoo1optoiociltla2rm(vpnt4 etrxo3oatlp eauvi;s srurirpnudaptn nct t sDrrumpnt4tlxomoetldfa rmn p (4 exoiocoy1lm elieilt0t2xo(m3io1omeelfcsls srrauronu1oeeoif3iyd m2eluvon(4tltrxf3iodoa  aieolt)texmxr3no4ap  lnvia( a2ur(mpnu1tpe mfctadfm2umuvsnu) exrxf3ta1fate iei;( setmiopny1olee ictls sDurur ;u4tpe  f3iytfaDra(vs;t)trxnmo totfatrlivils)truo(m oydape lfet s sDtmu  nu1tpen fciat m emnmp;t4 rtnmfcoa1fmDe uvo;t  rtrirpio4amtnlies tf Duaur nt4oleo o3tyt s2eln o;(4aetoxo3todomDraivo t) 2uoio nudlpe lnesls) Dtrum oo0opxn i3iatfm eau s ()aleoioctodlpt lu o s)texo(o3ou4ll  mfeilsfaDur( oot1apenii3iatlaDea(mp u)tlxrifcta1lp e iei;t)t2trio oydlp nmnvi tfs2tr( o;o4tpt if3iysla2rlnmpnu4tltnircoadlp   ieilt0seurir nu1apte ivslsfartmumo;t0tlxn oeiytfs eanmo u4aetrxo iotom  aivslt  2xmxm3iy4ale mfctl( srtr( pno1oeeo fciasfm ul(vsnu)altoxocto1oateauvi ( srtrir3iu1ope  fcilt aDrmum oo4oeeomf3iydfaDrl( sn(4tetnircoodomDrlnes s0seur(m iodomt mfct (fsDur(mo;o1aetn f3iadlmDrl(mpnt4 ltrio3totoaDeauei;s0sexr(m3iodaltemncslt)sDtmxr ou1opxomocildls2eau o t)aeenxfctadlpteai i;s tetm(opno1alee nvi s)a2rmxrpot4tpeo f3iltla elu snu)areoxfcto1optrlies s srxo(r3io4lpenlnesls) 2rmx  no1tpx ifcilt a2el(mpnt0altnmo3ta1oate uvslt) euoxo3nodlptelncsa( arta(mpoo4aexnmf3tytls2elnvp () reoxf3iytlmtr ues () 2umimpnudole  fesls)sDurum oo4tpx ifcild m ua( o;(4alerxrcoatopDrai s;t)seurxr3ny4optelnei ( s2umxm ou1olto feilsfm2um(vonu)artoxfcoadfat  uei;s0 rxr(m io1ape lfct tfarraxmpou0tpx mi3ilslm2el(vs u4 etoirctotfpte ivs;t s2urio ny1ope  ictlt)aDrrumpnu1oleo feiyt mDemnvpnu)trxoxr ty1lpDeaieo;(0 rur(m3oy1ol elfvslsfsDtr(rono4tlto fctldfa elnms;t0trenircoo1la  au il(  eum(r3iy1amee icsas)artr(  nu0tltnmictlslmDuluvont4 lxrmo3tytfmteln i;s) 2toim oodlpeelnctls)a2uaumo;t1opx ifetld a2emnmsn(0 rxomociadfmtr ueol()texo(opiu1lpe  fcilt) rtmum no1opx mfetyslaDeauvo ()aeerxocoa1faDr nvo;()s2um(opoudlltemfvsls)s2ua(ro;o0tpen oeiltlaDumnvs u0arerxr oo1oaDean o t sexoxrpno1oltnlicsa() 2ra(mo;u4aptnioeiytfaDum(mo u4arermr3iadfmDranei;s0 rxmxr oy1op  mivi sf rraurpot1tet  i3iyd a rlu o;u4aexrxf3oa1faD lnesls texm(opio1ape liet s  2tm(r ot0apxnioctltlm2ranvs;(0areoxo3iotfm   n ilt  2tmxo3oydllt mnvslt arum(ro;o0oleoii3iatls rl(msnu)tltomrctydfmDe iei;s s2xoim iy1lmee nesatfaDraxm ot4olxnmieilsfmDrm(vpn(0 rxrmf to1oateau sls  2trir3nydlp  mfesatfa2raxrpnt1oee mfciat m ul(mo u0tlxnxr3oodomtrli olt0tetr(mpoodom elnviasfsrurxr ;t4texoiictltfs2raumonu4teermr iadla eanesls  rumirpiu4lpt  fvia(fsrrmumont0aee  i3tls s2emuvs t0trtrio to1lm   i s t) exmimpou4oleemiet ( sDum(rpno4tpxnioeiyslsDem(vs t4tetomo oa1oatrlu o t)trur(rpou1op emfeslt artaurooo0opxoioctytla2eln o () ltrir3tytoat  ies t srxrxm no4lmenmfviat  2trum oo4oet  ictys aDrmu o () lenxr3totom   n sl()srxo(m3iu4om nlivtatfs2umx  no1oee mfeiad m2el(mp;u)alxrifcoytlateaneslt) rtm(m io1amt liet t artrxm ou1tltnmo3ildfs ran pnu4texrio3tadlat lnvs;t) exmxrpiu1om elieta(  Dururp;t4aptn oeiat mDumn snu)alxnmfciatoa r nes;()t2xoxrpiu1om elfetlt s2ra(r nt4opxoiictytfa rmn snt0 eeoxfctotfaDelu ol(0s2toirpiu4am n feslsf rumuro;t4tptnmfciat s2rm( o t)aetnxocoo1lmt an s s0 rum(r oy1aptnlfeiasfs2tr(mpou1tpx micilt a ra( pnu0 lxnxr3oytla eaneolt)sruriopnodop nlneils a2rrx ont1openifciysfs2elnmp;t)alxnxfcootlmte u ols) etoirpou1lmt  nes () Duau ont4apeoiociyt a uau onu0aexrxo iydopteanvi;s0 rurirpiy1al  lfviat aDtaumpot1optnioetydfm uauvsnt4texnmr oytfpDrlueol()sexm(rpoo4oleemnvtat arua(m oo4ole iietytfm2rlums t4arxnxo3tydom rau sls  exoxm3iodlmenlfetlt  Dtrumpnt1aleniietat sDuaump t4texrxoctotoat anvils  etr(o ou1al nmnet t) Dra(m no1ope  f3tltls2emu sn(0artrmo iydlmDraivils0 rumxm3oodlp n iciltf rrmxr nt0tptoiictls aDuan o (0 leoio3tadlaDraivi s0t2uoir3no1lme mnci tfa2urxrono4olxniictas aDemuvs;t0aexrxrciy1fmt aivo;t0 2uoimpnydalen feslt) Drrumpnu4teeomf3tldfmDel(vo u4arxnmr oy1lp eauvo;t) 2ur(opny4am nmfctls sDuau o;u0aetn oeiyt m ranvpnu)trermfcoatlat anes;s t2umxm nu4apte netls)aDta(m ;o1oeeo ietls s2uanmont4 lxniocia1lp e uvs s)srum(mpnydlmtelfct s srrm(rooo4aet if3tlsls2emnvsnt4 rtoxrctotfm e ues s  etrimpoy4lmtelnvs () Drrxm no1olto fctaslm ua(vs t4tetrxf oatomt an s t0 etoxm3oodlpeelnvta() 2tru o;t4olxnioetatfm2ra(ms (0trtoxfcoo1opD aneolt  rumxm3iy1ll emfvsls sDrmuroou0apenmo3tadls2emums t4trenmf3oytfm r ueo s srur(o3no1apen fcslsfa2rmx  ;o1apenioctas sDrlumo;t4areoxr ootoate u o (0sruoxr nu4lpt mfctl( s2tmxm ot4opt  f3iysfa eluvo;u4alxoxr3ty1lmt ai ils  exr(m ou4olee fcils  2ra(mp;t1alen fciadlsDemuvsnu) eeoifcoa1fpt ai o;s) ruoxm iodoptnmieslt)a2ta(ro;u1apen f3ilt a2el(mp;(0aetrmf3totoptraies ( texo(rpno4oltnlietl()sDtr(roou4tltn fctadla2eaums;t0arxomfctytfat luei;s0trtr(o oudlm n fvs s  2ta(m oo4oeenmi3tadfm2em(mo;t4tlxrxr iytopD anes (0texrimpiy1om e nci ()srumumpno0tpt ioeiysfs2uau p u4 eerxrcty1lmt  n ilt)setmio3no4ll n fviat s2ua(r ;u0tpto octltfs2ea( o;()arxrxo3ootoa  aivi (  2tr(r3io1omenlnvtasfarrm(m nu0apxo ieiyd a2rmumont0aexoxoctodom elivo (  eurxm ou4lpe  feil( s2rrx  no0aetoifeildfm rluvsn(0 lerxfcoo1opt  u ols)texmiopoo1op elnvilt srrm(rp;u1oleoifeild mDuan o t0 lxrxrctytlm  lieslt0teuoxrpny4ap elnvsls)arraurpnt0apxnioeiltls2rauvp u0texrxf3iadfmDe n i;() rtr(o3io1lptnmfei ( a2raumo;u4tpxn f3tadfm el( snu0aetrir3ty1lp   uvs s)teumxrpio1omt  nei ()s2trxmp;t4tex mfeiatfm2umums u)trxoir3oatfm eln i s  eum(rpiu1ap  lnvs t)aDua(rpnu1opeomfeiys m2rm(mp u4 ltrif iotom rlnvsls)trtr(o ou4lmt  ivil()srumuroou1tlx  ociytlm ua(vsn(4 etrxo oo1lp  auvol(0trxoxm iudopt lfeias artrxmpnu1aee iietldla2rau p;u) eeoxo3ia1lateaies;( srxo(o3nodom  liesasfarrrx pnu1tpt  i3ils a ea( o u0 lermo iydla rai s t0 rtrxmpoy4apt  ncia( aDua(mp;o0openmfctad m2eln s (0 lxnxrctytoptrliei;t0srxrxopno4lmtemnci t  Dur( p;o1apenmocild m umnms t0 etrio3to1oaDrluvolt  eurio no4op e ict s  rum(  nu0tltn ieias a rlnmp;u4aetrmfctatoatrlnei () euoimpiu1lmee nvtatfs2tr(m nt0olen ieiytfs2el(mo u0tetnmr3iytopteai ols0setrir3ou4optnmnvsl()artaumpou1tee iieilsla uau pnu4tleoifctadoate uei;(0 rxmxo iy4op elneilt)arta(r ou0oexnmociytlsDeluvs;t0arxnxo3ty1lm  luvs (0srxrim3no4ol nmneia(  2rrumoot0tpto fciltlm eanvo;u) exoxfcootoa r u olt  eur(opnudamte ivt tfarumurp;u0tlt  octatfa2umnmpn(4tltrif3tytfmD anvs;t0setmxopno4opt  nes tfs2uax p;u4altoifctad s2rluvpnt0 lerxocoodlptelieslt s2tmxr3ny1lm elnct s) 2ta(  nt4alx  o3iys sDra(mo;t)tleomr3ootlat ln i (0t2umxopiydamenlici ( aDrrxrpoo1teen o3iltls ul(vo u0tlxnmociatlmteln i;s0sexrim3oudalenmneias)aDtmxm nu0tet  fctasls uau s (4 eermr3iadomDeai o t)srxoio nu1amtemfetl( arumu pnt1opx  iciyt a ul( s;t0arenxr ia1fmt lnvi;s0srumxr oo4lle lfvtas)artrxm ;u0teen fcilslaDelnms;() ltrmf tatopt  ivi;s t2xrxo iydomtnlfcias srrm( p;t1tpxomicilt s emu on(0aexoxfcoa1fpt lueols) euoim no4lmeemfct (  2rm(rp;u4oltoif3iasfa2rmnvp ()aexrmr3totlm elivs;(  ruoir nodam nmnviat)aDta( oot0optnifeils mDuan on(4 rxrxf iadomDeau sl(0teurxopiodoleemnvi ( a2tau o;t1aee ifciys m rl( o;(4 eeoxf3ia1fp eaneils)srxoio io4altnmies sfarta(mp;u1altnmf3iyt sDrmu o u)altrir3oo1oatrluvs;t0 2xmxm3iodolt lnci ()aDrr( oot4aexoio3iadfs2rl( s (0tlxrmr3oodoaD  nei s) rtm(r3oydllt lnvt ( aDraurp;t0opeomfcias aDemn snt4trenxocoydopD anesls) rtrxmpnydoptnmfcta()srtmu ono4ale  ieiydlmDulnmsnt) lxrirciodfptraivi;() etmxm iudllenlfciat)a2taum ot4optnmoeiytfs2rmnmsn(0tlxnio tatlmteai s;() 2trxo3no1ap elnvsls sDtrxrp;t0ale iictldfm2ra( snt4artomocta1fa rlies t  eum(r iydolee icil( srumxr nt4aee  fctaslm ea(mon(4tltnmr oo1faD  nvil()srxr(rpiydom  lncs tfsDum(mont0tpeoifetltfa ea( o;()altomrcia1lmtr uvilt  etoxopiodlp   ieiat) rra(m nu1oee mo3iad aDel(vsnt4texnmo3ty1oa   iei t srurxr3nudllenlncil()arrmx  nu4tptnii3iltls um(msnt)texriocoytoa elieol( sexoir3oo4llenmfvsl()srrmx pou0aeeniociyd a2um( o u) rxnifcoatfa   nesls) exrir io1lm  liesl(  rta(m ot1tetniicild a2em( snt4texrmf3tatlp  auvsl(  rxr(rpoy1amenmnvtltf Dta( ono1olxnii3iytlmDra(vs;t4 lxrif3iy1opteanvs t sexm(o3no1llenmfvs s) rtr(r ou4aex ii3iltfs ea(vonu4trxrir3ootfpDr i slt sexmxm3io1ll nlicslt  2rm( ono1oeeo f3tytfaDeaums;(4 eeoxf3totopDr i olt)srtrxopiudom nlfetlt  2rax o;t4tpxoifctydlm uan p u)aetrmr iy1op   uvi;s  2tr(mpoo1lm  mics t s2tmu  ;o4opx  f3iatlmDua(mo;(4aexrmfctatopDr ues s trumxrpnudamtemfvtlsfa2taumoou4aee  o3tas m umnms;t4arerxr3oydlateln s;(0trxr(m no1am   nes (  2ta(  ou4oetoifctls a2uanmp () rerxr3ta1oa eaivolt0t2tm(o3iy4alteliet (fsDuaxmonu4alenmiciyd m rlumo;t0aetnif to1lmte ivs;s0srxrxr3nydolee fci s  Duru p;u0opeoiiciat mDrau p u)teeoif oadlatelneils)sexo(mpnu4apee nvtatf ruru  ;u4tleo fetadlmDemnvp;t0trenmocto1oa   n ol() 2uoio3no4aptnlfctltfartrump;t1aptn f3iytfaDuauvp;u4alxoio oo1lpDr nvo;s) etm(mpoudole mfvt s)a2ta(mp;u4apxo icilsfaDeln s;t)aetoio3oodopD  nvs;s  rur(o3iy1llenmnctl()s2rm(  ot1tleoifeiyt mDemn pn() rxoirciy1om e nesls0seumxmpno1lptnlnesasfsrtmurp;o4opxnmfeiysfm umnmont4arxnxf3iy1fpD luvs;(  etrxo ou4ole lnvs sfaDrm(r ;o1tpe ii3iatla umnvo;u4texnmo3oodlpteliesls)t2urio nodopeemfetas s2rmx onu4teenmo3iyt m rau s t)teeoxo ootlatrlivo;s) exmxo3iydolenlfeilt  Dum(rono0oee  ieiyd m eluvo u0 renxo ta1fmtrlivo;( trurxmpnu4ope licsa(f Drr(m nt4tpxnifeiyt a2rlnmsn(0aexnxrcootla rlneils0 2tmir3nodopenmfct ()arraum ;o1olx ifeilt m2rl(mont4artrmocoytlmtran s s)s2xm(rpnu4oltnmfvs s) 2umx o;o1ape mieiydfm2umuvpnu4trxnmo3oodlpt  nei s  2xr(opoy1lp nmnvtat a2rm(r ot0alto oeiydla ea( pn(0teeoxo oytlp r ueo s0trumxr3no4aptn ieil(  ruaxrono0olxn feiadfa2eluvp;()tlxnxo oatopDranes;t)texo(m nu4ol e ietl(f 2ur(monu1olxn o3tldlm2umu s () renxoctodfmD  ivolt  rtmxr3ou4ap  mnei s sDuaxrooo1tpt ifetys a2ran s u4texrmrciotfaD livo ( srumir iudom n ieiltfaDta(  oo1apeo iciys a ulump u) ltomr oadfateluvo;t sruoirpiudlltemnesatf Drmx pnu4apxoioetadfa2ua( s t0 reriocoatlmDr nes;s) rtrxm nu1lp nmfesl(faDra(ronu0aeenif3ils aDelu s;u0artnmfciytla r nei (  rxm(m3oy4ll n icilsf rtrum ot0opxoif3iatfmDranmp u4arenio3tadomtr ueilt trum(r oydamtn nvi (fa2tauronu0oleo iciyd mDeluvo;u) eeoxo iotlat  ieolt)sexoxrpno4lpeemfetlt srrmumpnu0aee mfetad m2rlnms t) ltrif iotlpteaivs s)seuoiopoy1lpte icsas aDtmx onu1tpenmoctatlmDemnvs u0arenxo ta1lmt li ols0srxrxo oy4lptemnvils arta( pou1tlxn o3tlt a eluvp;t4arxnir todfmD lieilt) 2toxr3ou4llenmiciatfs2rrx  no1aeenii3ilsfsDrl(vsnu)texrxr3iatoa r neol()srxrxr3nudlm emictl(f Dur(m ;o1optnmicias mDemuvo u0 rxriocio1oatrau o;s  etmim3iy1llenmnei s)a2tr(r ou4oeeo icias aDrluvpnu4 eenmr3tytlm elues;() euo(m iy1opee icsl()sDrr(rp;o0oltoioetydla ea( pnu0 lermo3tydfptr i o;s  2tm(mpiudapen fetas)s2taxro;o1tlto fciytlm2eaumsnt)aexrmocoo1fp raivil()tetm(m3oy1aptnlicsas)s2tmxm nt1apt mi3tytlm ranms u0arerxr3oodla  lnvi;(0 rxoirpiu4ap nlnvi tf rrm(rp;o0oltniictlt m em(ms t) rtnif3iydopDraueo t)truo(rpoy1lpt micilt)sDtrumont0alxoioetlt sDrl( o;()aetoxr oa1fm eai o s srxoxrpio1ope mnciasfs2tmu ooo4opxnmieildfaDemnvo;t4alenxf oo1laD ai sl()s2urxo iy1apee ivta() Dtm(rp;o1altniociat a2em(vo;u0 etoir3oa1fatranvi s) 2umim3oodlp  mfeiat) Dtaumont4oltomiciatla rauvsnu0arermrcoo1fpD  u sl() ruo(r io4omen fcslt) rtaur ;o4alenmo3ildls um(ms;t0alenir3tadopDrauei s)t2xo(m3iodopt  neils)s2ua(m oo1aet  f3iydla rm(mp u0tltoirciatlaD luvi ( tetmir3ny4alt livt sf rua(m nu4tlxomf3tad aDel(mpnu0 ltomr3oatfpD luvi t0 exoim3no4al  miesa( artaxm ;u0aexnifeiasls rm(vp;u0trenxocoo1fp  auvo;t0t2xoim3iudlpenlneilt)s2uaxmo;u0ole mfctas mDum(mpnt)arxnxo3ta1opD ln ol()seurim oo1ap nmivtas  2trurpnu0tpenmf3iat mDulumsnu0trxnmr3iotfp rauei ()trtmxrpnu1ape mies s artrxm nu0tlt  fctlsls rln ont0trxrxfciy1oa raivs t truriopou4lpe mieils)a2trxmpno0tpto i3tydfm2rmnvo (0altrif3iy1fmtrlivs;t)s2xoimpiodoptn feil() Dra( pnt1olt  feilt m2el(vo t0 exnmf3tatla rlivo;(0 eumxo3iudlpee nctat arraurp;o0tet moeiatfaDemumo;(4trtnif3iytoate neols)sexrxr3nu1amen nctlt srtrxmonu4alen oeilsfa rm(vpnt0tltomr3oatopDrlneolt) eurir iy4omtn ivsat srtaxr oo1alxomoetatfsDuln snt)trxoxr3oy1fmtrlueo;t s2tmxr oydomen fesa( s2uru  nt0olx  feiysfs umu p;u4 lerio iy1fmDraues s s2trim3nydlm  mnctltfartr(mo;u1aptoioeiltlmDuluvonu)alermf oadomDeauvolt)s2ur(mpiy4altemiciatfsrum(mpnt0apeomictytfm2el(vpnu0alerir oo1opDr u o;t t2toxrpiu1apt lfvt tfs2rr(ro;t0ope mieils a ran on() rtrmfciotoa eaiesl()trxrxm ou1lpeemivi (fsDrru  ot1apxnmi3tlt s2ra(mp;u4tlxomr oytomteluei t)setoxr no1lpeemiet t) 2tmx  ;o0opeoiieilsla2um(msn(0arenmo oadfp e ueo s0 exr(o iu4llte ivsa( aruaumpoo4ole  i3iatfsDuanvo t) reomf tatlm   u o;(  exmiopoo1optnlnvtl(f Dtm(root4tpx mfeias aDeanmonu)artrif3oo1omte nei;t0trxmxm io4oltnmncsa( artrur ou4tetomo3iytfaDran o ()trtrmf oy1lpD au o t srxoiopiodapte ieil()s2trx o;t4altniiciltfa rm(vs u0aexnxf3iodfmt  neilt trurxr io4olenlfesat) Dur(moou4aet  ietaslm uanvp;()trxnif ia1lateluvs;( trto(m oy1lmenmieilt s2rm(  ;o1aptniieiatlm2rm(vp (4 rxnxf3to1lmtraueo;s s2trxo iu1amenlfesl()arrrxm ;u1altn fetydfm uln snt)arxnxf3totoate ivi;s)sexoio3oy1lme liciatf rrmumoot1apt  ietatls2el( s u)tltrmrciotfmDr u i (0t2trxopoodllee ieils)srur( pou4tltnmicilsfmDraumo;()arxrmf ta1lpDeau i ( trum(opiydalenlfcils s2urxmpno0oleo ociys s2uanmonu)trxrxfciytfm   u o;(0seto(mpiodapenmicsl(f rraxrpnt1oetn i3tls a2rmn pnt0alxomr3io1laD livo s)t2toxo3ny1llenmfet (fs2rrx p;t4apx  i3tatlm umu s;t4 rxriocia1lpD auvi;t0setrxm io4lmenlneil(  rururo;t0tpt  iciat s elnmp;u4 etoir oodfptraivol(0 rum(mpiodam n ivsltf 2urum no1oeeoifciytls2ranmp;u) exomo oodom   i o t trxmxopny4lleelfetlt a2urx ooo1aeeo ieiytfsDumn o;t4 etnmfcoy1fm   n i t0srumxo iudopt  icsl() 2ur( pot0ape  fctyslsDemu s t4 etrmrciatfp ran i;s srxrirpno1opeemnvt s  Dur(r no1tpt mieiaslaDeanmonu4 rxrxr oodlm  auvolt s2tmxmpoy4alt lnvsl( aDumxmpno1opto icilsfaDul(vp;(0aleomr3iydfatrlnvi;t  etm(rpio1amee iesas a2urxrp;u1tex  ieiyd s2rauvs t0tlerxf oadfp raiesl(0teumxrpnu1lmeemneil()artax o;o4oee  oetat sDumump;(0tltrmf iotop r n slt)trtm(rpny4lp e netl(faDtmump;u0tlxoio3iys sDrmu sn(0alermf oatfp eaues (0t2ur(opny4lmt liet t)srumu poo1oltniieils m2uanmo;t) rtomr3tytla  anvi;t)srtmxr iodom emfeslt) 2trump;u4altn i3iasfa2elu s t4tlerio oy1lmtelnes;(  rum(o iudlmt  fvs (faDuau  oo0tpt iieiytfm2ra(vp;()altrxr3io1lm  luvo;( srxmxm iodalt mfes ()srta(rono0optn f3iydlsDrm(ms t0aleomo3tatlatran ols teuoxo3oo1openlici t)s2rr(r ;u0tltnmfcias sDumumon(4 leoxr3tadlpte ues;() rxr(mpny4ap emfvsl()s2tm(r nu4tpenio3tadlm eln s (0aetnio oatopD  ivs;s sexoiopiydolt lnetl(f 2rmum nt0tptoifeiadfm umuvo u0tlxoif3ia1fat ai slt)t2ur(mpiodole mncslsf rta(rpot4ope mfctlsla rmuvsnu4 lxomrcoadop eaieol() rxm(m3nu4altnlfetls  2tmxmpou4olx  i3tydls umnvpnu) leriocootom r u s;s s2um(r no1lmeelncsa()sDraxrp;u4texo ieilsfmDrmn p;(4 lxrio iodfpD  u ilt tetmxr3oy4olen fct (farraumo;t1alenmo3tyt a2uanvo ()trtoxo oadop eau o (0srxo(o ou1opt mnetlt sDuaxm ot4oleomfcils sDranvo (0artoxfcio1optr nvils)s2xr(rpiydamt lfcta(  2tr(moot1opto o3tyd a2elumo u4trenmf3oa1oat  i i;s0t2tmxo oydal n iet sf Dur(rono1alxomf3tlt a2eln p;(4 etoif oa1op elnvilt s2xrio3no1amtelfcia( arumxr ;t1tpx ifciasfm2rmuvonu0trxrmf3tytfpte ivsl()seurxo3oodoptnlivs t)aruaurpou1opxnmociadfmDum(vo t0 exnxf to1laDrluvo s0s2umxm oy4ap nmfci sfsrraxr nt0altnifctldfm rm(vpn(4trxoxrcto1om elivo;t)t2xrxm3io4ap   ncslt) rtrx p;t0apx  i3tytla eln sn(4 ltrxo oadop r uei;s setoxopou1alen netas  Dtmx  ot1aptnmicilsfm ea(vo t4 rxrxf3oa1optr ues t s2uoio3iodamt  fetls)sDtmxmpot0tpenmoetytla ea(mpn(0alenmfctadlaDe n o s  ruoimpny1op emivtl( sruaxm oo0tltoii3iatlsDrlnvpn() rxnxfciodfpD  uvols s2tmxo3oy1lmee fes ()a2trxr ;o0aleo o3ilsfm2rmuvo;(4 ltrmocio1fpt  ivils) exrio ou4om nlfetat)a2rmx pou0aexoii3iydla ran p (0trxrio iydfpDeaiei;() rtmim3nydlme livt s)a2raxrpno0tlto feiatfs emumpn()arxoio3iotopt aivs;t  2urim oy4lpe  nvta( s2rrx  nu0tpx  iciaslsDeln p;u0trxoio iytlpDe i s;() eum(o nudopenmieslt s2rm(m nt1apen octltfaDum(mon()areomo3to1opD lies;s t2toir3io4ol nlicsas s2urumpou4tleo i3taslsDrm(vsnu4tetnxo3oydlm e neo;s0s2xoimpiu4lme lnctls) 2tmxmoou4olxomf3ias sDemnmo t4artnxr3oa1opteluvo ()s2um(m3ou1ll nmici (fsrtauro;u0ape  octadfa2ra(vsnu)tetnxr3tydfm  aivi () 2ur(m oy1ll emieil(f 2tmurpnu4opx ifeiadla2rmuvo u4tetrxoctatom   nvol(0trtrirpoudlpeelnvi s)artr( oot1oexn f3ildfa ul( pnu0aeenmf3tydfmtrlieolt0sexoxmpio1aleemivtlt aDrm( oou1tltnmfeils sDel(vo u)tleomf3oadlptrlivolt0 etrxr3ny4omtn fetl( aDrrump;u0tpe  feiat a uan s;(4 eerifctytoaD livi s  2triopnu4amtelneta()srum(r no0alxo o3iys s ea(vonu)texomo3oa1fm r n s s0 etrim3nu1alt lnes ( a2tr(m oo4tptn fciydfm uaump;u0tlenxr iadopte nei;(  eum(opnu1oltn fvta()s2tmur ;u0aeeomf3iatfs eau p (0 lenmocootlm   ueo;s0 ruo(r iudoptemneia() 2umxrpou4tetnmiciad m2rl(vo;t4 leoxr3ootla ranesls trxoxrpiodoptnlnesat)s2rr(roou0tpeomfeiydls2umnmo;u4 eeoir3oadoaDeauvs;t setmxo3iy1lmtnlfvs sfsDrmxmoou0aeenmictadla2rmn pn(4altrmo3oy1lpD lu sl()srumxm3nu1openlnvs ( srra(ront1oet iociysla2emump;u4 rtrmfciatlpt lnvs t)sexoxrpoy4ol nliei sfaDuru ono1tleoifciltfs2eanvo t) rtrxo ty1omD livols0 euoxm nu4op elnctlt srraur ou0alen fetasfsDrau o;(0aeenif iatlpt livs ()teumiopoydamen ivia(f rraxmp;o1opx  ocias s elumpnt0 leoxf iytomt lneo;s)trxo(rpoydopenmnvsl()aDra( pou4tetomf3iysla2eau s u0tetomr iytlp eaueol() euo(m iudamtelnesa(faDrrxm ot1tltoio3ils m2umn p (4 exrxr3ta1op ean il(0srumim io4amt lnvtl(f 2rmxm no1olt  f3tyt aDumnmont4aexomfcoa1fpDrau s () 2urim3oodal e nes s sDtr(ro;t0aptnmictysfaDra( o (0treoif3totfpD an o;t0t2um(o nu1opt mfct t sDtmum nu0aeen o3ilsfs2ulu pn(4artrxf3iotla e i o;()trtr(r no4open ictl()sDrau  no1oee  oetydfaDemumont)tltnmr oa1om  luvo (  rxrirpiy1lp elncsat aDum(mont1aleoiictytla2umn o t4 rxomrcoodomDeaivs s0s2umxr3ou4altnmnciltfaDtrumoou1tee  fetltfmDua( o;u)trxnifcoydlat lnvi;s0truoirpoo1olt lncta( srrm( ont4oet miciat a2ulumpn()artrmo3ia1lp eai s ()t2xo(mpiu4ap n ieiltfarrau  ;t0apt moctyt aDrauvp (4treoxocty1la eaueo t)t2xr(opoo1oleemivtltfaDrauroot0tpxn fctyslm2em(vs t0 exnir tydlmtr u sls setoir oy4om emneil( sDuau p;t1oeeomoeild a2ea( p t)aetoxo3oydoatrlueols0s2xmxr ou4ap nmncsl(f Dtrump;t1tee ioetltfs2ua(vp;u)trenmr iydfmtelueols)s2trxr oy1amtemfct () Dtm(mpnu1oeenii3ild a2rl(vp;(0artnxfcoa1op  aueils)trtoiopnodaltnmfeilt  Dtr(moou0aptnmf3iydlm rm( p (0aetrmo iatlm rluei;( s2umxr oodoptemnvt sf 2ua(r nu1texoioeild m rm( pn(0trtnircto1fatrlueolt  2xmxm ou1omee ivtatfs2rmx  ;t0optomoctldfs ranms;(0 lerxo iatla eai sls) etmio no1lm nmicsltfs2rru p;t1oexo icildfs2el( snu4altrif ta1om ean o;s)sexr(r3iu1al  mnct ( arrr(  no1aeenmf3iytfaDea(mpnt)aeeoxf tatoaDraivs s0 etm(o3iu4amt mfvtas arur(root4texomoeiasfa umuvp;t) lxrxr ia1lmD au i;(0 2toio3ny1opeelfcsl( s2ta( ont0oltnmieiysfm2ulnmp;(4trenmrctadomDr ivi t0 2tmxmpiu4lmtnmnctls) Dta(mp;t0tpe mfeiasfs el( sn(4 lxoxfcio1omD anvs t) exoio ou4om e nvtat)aDrmxm oo1oeenii3tydla uau pn(0aeermo3oodoptr i i;() rtm(mpiy1lmtn fvilt) rtau  ;t4tlx iieiytlmDean ont)aexrxr oo1opt livi;s trtm(m3no1ll e nctasf 2rmurpnu0olxo o3iatfa eaumo;u4altrmfciatfmte ivi;t)s2xmxmpiodom nmnvta( srumur oo0opx mf3iys sDea(vpnt4teermo io1oa  aueo;s0teurxrpio1ap  mfei t a2tmxm nu4openiocilsla2rmu snu) rtnioctatla eanvo t) 2xoxmpoo1ope mfvia(f 2rrum ot4teenmictltfsDel( s;u4 rxrio iytfpDeauvi;s)sruoxr iu1al n nvi (  2tr(  ot4oet ii3tad mDrm(vsnt4 lxnmfcty1lmDrlnvsl()trurio3oy4ap nlivsa(  rumum ou4apxn o3ildls ean s;u4tleoirciy1fat aivol(0 2uo(r oy1ope lnes t)a2uax  nu4tle  fctytlsDuanmonu0 rtoir3oytoate iei t0setoxr3oy4lp emiet t)artr(root0oexnmiciysfa2emumsnt)artrirciy1fmDr u s ()srxmimpnu4altn fctlsfs2umumono4oee iociasls uluvs u0alxnir3tadomDelues;s0 etm(rpiy4altn nct t)a2rmx onu4tpeomfetysfmDumuvp;u0tlxnxr ootlmDr uvo;t)s2xrir3nudlmt mnvia() 2rm( pnt4tpt mi3tltfmDrluvs u4 renif iotomtrln sl() eumiopoydlptnlnetl(farrmumono4altniieils a2emnmo u0 rtoxrciatoatran s;()s2umim iydole mies t)sDumumpou0aeenmiciad s elnmp ()alxoifcoatomte ivs;( teto(rpoo4alenmictatfs2rm(mo;t0oeenmo3iltfsDrm(vo;u) lxrxr3io1laD  nvslt teto(rpoudopen nvsls sDumxmo;o0tex  iciyd a uan o;u)arxnxr ia1la eln ils)s2xrxrpiu4oltnlieils  Dum(m ot1ole moetydfaDrlump t0trxomr iadlmDelnei;() rxo(m3io1ol elfetas)srta(r ;t0tpxnifeild s ul(vo ()arenxrctotfat lnvi;()texr(opou4ape  neiat arrmurpno0aex  o3iltfaDumu p u4 lerif oodoat lneols0t2xmxr iodope livs tf rtm(ront0oet mi3tydlm2um(vs t4areoxf3oydoptr nei;t trumxm oodlptemiet (  2raur ;t4tetoifeiat aDelnms;t4arenmf3oodfaD anvi (  rto(o3iu4lp nliet sf 2umxrooo0tltoifctldfaDua(ms;t0teermr3tytla eaueil(0teurxopiu1lp nlncs tf Drmx  ;o4oltomocilt m uaumonu4tltrir3ta1op   uvi;( trtr(mpno4ol nlics tf rrrx  ot4tpe if3iaslmDrlu s (4arxrmr3tadfp eaueils t2tr(mpiu1apte feiltfsDrax pno0aex  oeiyd mDrluvp;u)texrmr tytfmtrluvils)trxoio oy4apt mfvtltfaDtm(  ot4tlen feils a um(mo t0altoif ootfa  lueo ( tetoiopnu1aptemnvt t sDrm(  no4ope iictls mDeln p u4tltnmf oadla eluei t0 etrxopoudlleelieiat  rtmurp;u1tle moctadfa rm( o (4alermf3oatfa r nesls0t2to(rpoy1lptn ncia(  Draumonu0tpe iocild s2emnmp u0 exomf3ia1fpD anes s)trumio iy1lp n iesls a2tmur ot1ope moetydfm2ranmsnt4 renir3totop  auvols) exm(mpiodllenlfvsl(fsDuaxm ;o1optnifetlslm elnmo ()altnio3iodfmDelieo;t0trxmir oodalt lfvta(fs2umuro;t1aee ioctldfa2el( snu)alxrio3oy1fa raivs;t0srto(m3iudal elncil(fs2rruro;u0apeomo3iytfs emuvo;()tltrxf3ia1laD ln ilt)t2xmxo io4alt  nctasf 2ururo;t0texniictyd sDelums;u0trenio3ta1lp rlueo;( sexoxmpiodlmenlnci t)sruru  nt0altnmociytfsDemnms;(0trtnxf oatom  lnvs;t)t2ur(r3oy4lp elfesa( artau pou0opt if3iadls2ul(monu)tltrxo3to1fpD aues s0trtm(o3iodom nmnvt tfaDta(ro;o0tlxn feiaslsDrl(ms u4teenif3oydfat auvilt)truo(rpiydaltelicil( s2ururp;u4tpto ieiydlsDra(vp t4 rtniocio1lptrau o s  etm(mpny1om emfctas)sDta(mpoo1tlxoiieiydlsDem(msnt) eeomfcoa1omD aivs;t) ruriopnydlptnlnvs ( sDuaumpou0texomo3ilslmDum(vpnu)alenmr iydlm  lnei;s)srto(r oo1lpe liesas)a2uaxmpnu1opxo f3tas sDrm( p ()artnir iadfa r ivo t0t2uoxopio1olt  fvi s) Drmx p;u0apx ifctysfa rmu o;(0tlenmrcty1oa eauei;s)t2uo(opiu1op  mnctas) Dtm(m no4openif3ildla umnvp;(0treoifciytfpD  i s;( tetm(m no1ap  mfct ( aDumxroou1tltniiciytlm2uauvs;t0tltoxr iadopD ai i t0srxm(m nodlpt lieils)a2trxm ;t4aexo f3iadlm emnms u0 renir tydlmDelnvi s0texrxrpiu1al e ivt ( aDuaum nu4tltnioeild mDua( snt) rtnio3io1fate nvo;s0setoim3nu4om nlfeslsfaDuau oot0tet ii3ild a2um(mp t0tetrirctadla  aueols0trurir iu4ale  fvilt)arumuroou0oeto fcild a2ul(msnu0aeermr3ootfm rauvs s) 2xmxrpiy4ap  lnct () rra( o;u0apt mf3iaslm2emu o t)arenxf ia1lmDeaieslt0 rurxo3iy4om nmictls aDrm(root4olt  oeiytfs2eanvp;u)tltrmo3oo1fmtraivi s trtrxo iy4lp nmieia(  2tru p;o4alxo i3tytlmDeluvs t) rxomr ootoa eli s t trtmxr3oodapee ivi s)sDtm( pou4texoifciadlaDea(mo;t0aetrxo3iytop  auei;( s2trir3io1lmt lnei t sruaumono0alx  fetysfm uau s u) eerif3to1fpDrli s;t0sexm(r ny1apt lfetl( a2urxmpnu0apt iiciasls umnvp (4arxrxrctadfp elnei t s2urimpny4lp e feiat sDuaum ;o4tex  ieildfa2rau sn(0 reoxr3oo1lmDeauvil( texmio oo4lmtelfct (faDua(rp;t4tleoiiciytfs um( s u) exrmf oydlmDeaies;t0t2xoxr oo1aleeliviat a2urx  no0teenifeiad a2umnmo;u0 reomr to1laDr n sls)t2xo(o3oo4al elnvt s)arrmxm ;t4alxomoeiyt s2eau s u0tetnmf iatoaDrlueil(0seto(mpiu4omt liviat)a2uaxrono4aetomfeils a rl(ms;t) etoxfciadomt ln i;t)sexrxr3io1amen fvs s aDtrurp;u0aet  fcilsfmDumnvs (4tlxrxo oa1la r uvs s srumxmpiy1optelicsa( s2raur oo4opxn fciysfs2rmuvo ()tlxrif3iotomDelivilt) etoxo oo4ol nmfeta()aDuru  ;t0opxniictasfm2ua(msnu0teeoio3oadoa e i s;s0trtrim nudap   fcsatf rua(m ou4opto i3tldlmDeaump u4aexoxr iy1oa   n ils  2to(m3oydoleemieils) Drau pot4aetnioetltfsDua(mo;(4altoxr3tatfp rln il(0sexo(mpio1lptelivsatfs2umx  ou0apxnifeild mDuluvsnt)tlxnxr3tadfmt ai o s  eur(mpiy4om nlivtlt  2umu pnu0tpx iieiltfs rlnvs t4 ltnircoydfpteai i s teuoxo nodlptemfvtls) 2raxronu0tetoif3iytfaDumu o u0tlenxf iy1omt lueslt)s2tmiopiu1omtelnci s)aDrrumpou1tlxn i3ils mDelumonu) rxomrcoytlmteai ilt)s2xoxo oo4olen fetasfartmurp;o0tltomoeilsfa raumpnt)artoiocta1fa  aneo ( srtoxopnudapt lncil( arrauroot0oexoiictld s2uanvs ()aetnir3tydlm r n ilt teuoxrpiu1alenliviat)a2umurpou0opxnmo3tasfs rmums;t4 rxnirctatlp rlnvils srur(mpnu1lm  lnctl( sDrmum ;t4alt ifetas s ranmsnt4areoifcoytlmtrai o t0trxmim3io1aptn fctlsfsruaxrpot0oltn f3ildlm2rmuvp;t0tltrir3todoptraneo s)t2urxm ou1opeemnet ( arururpnt1tpx iicilsfmDrmnvs t0 rerifctytlpDe nvo ()sexm(mpnu4amtemivt tfs2uaxrpou0apx mictyt a um( onu0trxoifcoydfaD  u o;s0sexoxo3nodopenlivs sf Drmx  ot1tetnio3tat m2uan snt4 lxoif tatlmt lueo (0seumxo oo1opt  fvsa(fs2rm(ro;u4olxnmoetlsfm rl(ms;u0tlxoxf iy1oateaies ()trxo(rpiy1olt lnesl( srtax ono1oexoiiciydfmDumnms t)tlxrxr3oy1lpDe uvslt0tetr(m nudamenmneias)srur(rpnt4aexnif3tytlsDeauvo t0aexrif3oadfp  auei (0 2toiopiodam e ieiat s2rax  nt0opx  fctasls2rlu pnu)aetoio oytlaDelueolt0trtr(r iydam e ncslt)aDrauronu1tleomieils mDra(mp (4tlenxf3oodfa  lieol( srumim no1aptn nvsltfarra(  nt0texoifciltfs2rl(msnt0tltrir3oa1oatraiei;s0teurio3ou1aleelieil(  rurx p;t0ape ioctls sDum(mpnu) rtrxf3ta1fatelnvolt)texr(rpny1op nlnet tfa2rm(moou1tlx ifeiat aDuaump (4aexrmfctatfp   i o;t  ruo(rpiudopeemnvil(fsDrrxrooo4tpt mi3ias s2rmn s;() eerxf3iy1faDrauei;s sexo(mpoodopee icta()s2ta(ronu4oeeo octydlsDel(ms t4 etnxf3ootoaD lues s0t2xmiopoodlp nlfetlt) 2ta( o;u4tex mfciytfa2rl(vp t0aetnir oatoateaieo s0tetm(m3iy4omenlnvils a2uaxr oo1tpxnmf3tas s2uan onu4tltnmf3iy1lptelieol(0 rxmxm nudop emivia()srum(m ;t1altn fciatla2el(vo () lenmr3oytlaDrlnvi s)teum(m oydap nmfcilt artmx ono0oeto fcilt m rm(mpn(4tlxnmr3oytop eaieo;s0 ruoxopiu1ale lncils sDtaum ;o4olx mf3iat aDrmn o;(0arenxo oytfm elivs s setm(m3iydomtnlfvsl() rua(m nt1olen ieiltfa2em(vs;u)tlxoxo iotop r n o;t) rtmxo ny1olenmfvsa(faDta(moot0oeenmfetydfaDua( p u4altrmf3tatoa   ueols0trur(r3oodlpenlncil(faDraurp;u4opt  ictydls ranvsnu) exnxf iadlpDe uvo;s0trur(mpiu1olee net s) Dur(mpoo0apt ii3tyd s2eau pnt0trtrir ia1opD livs s)trto(o iy1al e netat  rua( ooo1opxnmfeiyt a eluvsn(0tlxrio3tydom  auei;s)srxoxm iu4ale lfvsat) Dum(rpno4tlxnifeiltfm2ea(vo;t4artrif oo1lm   ivsls0t2tmxmpoy1lmte fci s)s2umumpou0aptnmi3tldlaDel(mo u0arxrio oydlmDelnvslt0t2tmxrpnodapenmncsas  Duaum oo4oeeoifeilsfm umuvp (0tlxrmo oa1laD livo ( texoxrpnodop nmnvi sf rurxmo;t4aexoif3iatla umump t) exnxf tydfpt  nes;t trtrim iy1ole  ici t arrr( p;t0tpxomi3iys a ea(msnu4 exnif oodom r nvi;t  ruo(rpnudol  livsa( sDtrxroou0tle  feiadfa2ra( onu0trxrxociatlpte nvi;t  rxrxmpoy1apte ietasfs2uau  ;u0ape mfeiatfs uanvsn(0 ltrmr oodop  luvs (0 rtrxr3no4ole mnvia(faDtmxronu1aee  ieilsls2emu s u)trerxo oy1oateauvilt0srxr(opny1openmnvi (f rur(mo;o0oetnmi3iaslmDrmn o;()tetrir3oatoaD li sls s2trxopiy4opt lfci () 2tmxrpoo1tpxnmoeiad m emumpn(0trxnifcta1lm  lueo;() rtmxrpiy4ap  mnvs sfsDtmxro;o1apxn octysla ua( s (4areoifcoytla eanes;s srxo(o3nudlm  mieilt  Dtr(mo;o4aeto oetydlmDelu s u0teeoifciotlpt an slt) 2um(r ny4omtn fct (fsrumxmp;u4opxoifciytfa emnvo;u)aetomf to1oatrlieslt)s2xo(rpny1aleemfesl() rumump;t0aex mo3iasfa em( pnu0 eerxf3tytfate nvol(0 rxrxopiy4lmt mfetas  2trumpou0tlxn ietlslm ulnmp t0 exomo iydfmtelnvo t0 2umiopno1ale  ncs () 2urum nu1ape iiciyd m rm(msnu0alenifcoadlp  lueo;(0 rurxr nodomeemfvi tfaDtaxr ;u1tle iieiysfs uln on()tetnmo to1faD aivs ( trtmxopiy4olen iesa(  rur(rpou0opt iociatfa2raump t) lxnxoctotomt lueils)t2trim iy1ol   ietas a2umurono1tpeomoctad a2ra(vsnu4teenifcootoa r u olt)texmxopio4oltelfcil() 2umu  ;o4tlxnmf3ildls2eluvs;t0aexnio3oytfm  anvsl(0seuo(o3iy1al emncs ()srtrxm nu0tlt iieiatlm uln snu4 lxoxr3oydlmtean ol( s2trir3no1optelietl(farrmxr nu0aeeomi3tldfaDuln s;t0 eermo3oatoatelivsl()srtmxo iodaltnmivsas a2um(r nu1altn i3iysfsDuaumpnt)texoio iytlm  au i s t2xrxrpou4alt  fcils  Dtrurpnt1alxnio3iatlaDelnms t)alxnmf iy1lp rauvo;s)t2trxr oy4omte fetlsfaDtmump;o4opto feiaslm2umn s;(4aleriocoadfp   nvols0 rurxmpiydope lneta(f Drm(r ;u4oeeoif3tldla ean pnt0 rerxf3oytfmtrlivils  2xoxr iydlpt lfvia()a2trxmpnu1olt moeiyd s rmums (0tetnxr tadopDe u s s)t2tmimpiy1lpee fei tf Drmx poo1aex ioetydla2rmnmp;(4tlxrmfcoadop e u s;t0 2tm(m3oy1om n fci (f Draurp;t4opt ifctyt s emnvsnt4aetoxf3iytlpDraiei;()trxoir no1lpenlncs tfaDta(ronu0aetn f3tlt m ranvpnt4 etrmr3iadfmD lneslt0s2urxrpio4lleemivta( a2ururooo1oltoii3ias a2ulnmp;(4aeenxr3tadlmtr ueol(0 exm(mpoo4opte feiat)aDtax ooo1aex  i3iys mDeaums;()aetnmo3ty1lmt ai i ()srumir3no1apeelfeils a2taxr ;o1oltn fctld m rmuvo;(4treomrctotoatelnei;(0setoxr3oo1lpen ncsatf Drau oot1apxn ieilsfs eaumo (0artnio3io1fm   ies;t)t2toim3oydaptnlncsasfaDuaxrpoo1oetoii3ildfa ua(vpn(4 rtoif oodoa e ivsl()texm(r3nu4op nlneta()s2tr(  oo4tpto ociltfm2rm( on(0trtoxr3ty1fpDe ieo;()srtmxm3nodom  lncsas)artaum ot4tle ioeiat sDra(vsn(0tlenif tytlmD auvol(0 rxoxm oo4olt mnvtl( srum(m ou0aexomfeias s2rau s u) rtrio iadoat li i;t0setmxr3no1apen net () Dtruront0tee if3tyd m2ea(von()areoxrctydlmDr uvo t0tetmxo3nu1aleemivsas)s2urx o;u1apxnmieildfs2ulu on(4 eeoxo iodfat  u olt)sexrimpoudaltnlnes tfaDurum ot4openiietydfa2ulumont4tlxrxfctadomD  i i ()s2tm(o3io4opeemieias s2rrurp;o4tptn ieiyt s2ranmpn(4treriocio1fmD  i o (0srur(r iy1amtnlfcslt)a2raxr oo1tltn oetaslm eau p;()trtnxo3oa1lmDrlivilt0texmir3ny4ol nlncilsfartmx  nu4alen fcildfaDrauvsnt4aexrxf3ootlm eanesls  rxoio3nu4altemnesls)sDrau pnu1aee mfetltfmDrlnvs (4aetomo3ia1fa  aivo;t)texmxopny1amt mnci t)srrmurooo1apeo ictltlmDra( o;() lxrmf iotoateaivi;s0tetrim3ny1al   fesatf 2tm(m ot4apeo ictyt s eluvo ()aexrmr3ia1fpt  uvo t0 eurxrpiy4olenlivs s  2uaxmonu0tpeomfcild s uanmpn(0trtrxr3iatoptelu s;(0trumimpoudlm nmfei ( aDra(mooo4tltomi3iys a2rl( s u) leoir3oatomteluvo;t0texrim3ny1ome mnesas)sDumu pnu4aex ii3iatfa rlumo;(4 lxrirciodfpDe ies;t0trurim oo4ap   fvtas)arrmxm nu0oexoii3tydlsDemnmpnu)tlxrir3oy1omt au s;s tetrxm iu1amte fct ( s2rax  no1aet io3ilsfa2eanmp;u4 ltnmf3oa1fat  neilt) rumxmpiudamte fvil()a2umumpno0oetoioetld a2umnmont4tltnxrcio1laDeluvs t)setrimpou4lme mnct s)srtax  oo1tee  ocildlmDuluvo t4 rxnmo iatfm eaivi s)texr(r3nu1lm n ivs sfsDra(rp;t4tpe  oeils s ulu s;(0 rtrmociotoaDrln il() rtmir3iudame  netasfs2tr(  ;u4aptnif3ilt m2ranmont)altrio3ia1lmD aueo;s0sexoir oudop elnvil(fsDtaxmp;o0oeeoifcildfm2raump t)alermf3tydfpte ieolt0texoxm3io4apee net ( arraxm no1olt mi3tadfm2rlu o (0trxrmoctotopD  n i;( t2uo(r3nudolee fei (f 2tau p;t0altoioctytfm2rl( s;(4 rermfcoa1lmt auei;()t2xo(rpou4ope lfeta() Dua(m ;u0texomi3tltls2ulnmp (0 etrmr3ia1fm   n s t0trtr(r ou1olee nvt s) 2tr(mpou4oetniieiasfm rmnmonu0altrmfctytla ean i;t0 2xmxrpiu1lle lnctat)a2rrur ou1tptn oetlt s2ua(mon()teeomf3oo1faDr ivo t t2trim oudopeelictls)artau  ot1aee iociaslm2eln p t)altnmocoytlpteaues ( srtmxopio1amt mictas)arraump;o0tlto f3tyt sDea(vo;t) eenmo3ia1omteluvs;s0 etmirpiudlptnmnetl(f Dtruro;t4oleomfciat a umuvs (4aeenxr3todfmD aies;t  exmxo3iydape  icsa(f 2uaur nu0tet iieils s rmuvp;u4arxoifctydfmtr uesls)srurxr oo4opt mfviat artaur ;t0ole miciadfaDrmu snt)aeeoio oydoaDrluesls0srxoxo nodaltn nvt s  rtm(mpot4optnio3tltlaDuan snt4tltoxf iadom  lnvi s)teuo(r3iudaptn feils  2rau pnu4texn iciasla2rlu p;(0artoifcoa1fpDrluei;t0trum(r oy1ap   fvslt  Dumxmp;t4tlx  f3tyt aDumnmo;t4arxrmociytlpt  uvil(0teto(m oo1op   nes ( sDta(m ot0oee mfcilsla umuvpn() lxnif ta1fm rlivi;()sexoio ny1lptnlnvsls arurxr nu4apx moeiasfs2eln p (4tltnifctadfp eai s;t0setr(mpoydom e ietls  Drru oot1tlenmf3tlsfm2rlnvo t) rxnmrcoa1fptelivs;s0s2uoim3nodalt lnviltfs2rax  ;t1tlto ieiytfm2ea(mo t4trtrxf3oo1om eluvi;s0t2uoxr3nu1lp e feia(fa2tmxmp;u4aleomi3iatfsDuaumont0arxoxr oatlm  aueol() etr(m nudlpe lfvsatfarrmxr nu0alx iieilt a emuvsnu0aleomf3oatfm  luvs;s)seur(o3nu4lme  fcs sfarurum ot1tlxn i3ildlaDumums;t0tlenxr iotlptr u o s0teuo(o3oydopte fct s a2um( pnu1oeenmieiaslsDra(mpnt4 ltrif3ta1lmD ai ols)trtoio oy4ameemncsas aDra(ro;t0ope  fcild s2ra(mp;u4teeniocto1oateluvi;() rurimpiydomtn fvsasfs2ra(m no4opeo ietld a2ra(vo t)artnxr io1lpD an i s0sexrio3io4lmeemfctltfarrrxr ;u0optomo3tlt s uaump;(0aetoxf oydop rluvslt)teum(o3oydap  mneils)srtrxm ;o1oee  o3tytfaDrln p u)teeomo3ootlmD  uvols0sexmxr ou1ol elfct ( a2tau  oo0alxoiicildfm rm( o;u) exrmf iodlpteauvsl()trxm(m iu1lm emfeia(  Duaxrooo1apxnmoeils sDra( snu)alxnmf3tadomD  nvols0sexrxr3io4lme lfvslsfsrtmx  ot1texnmo3tlslm ulu onu0arxoxrciydfp  aues t) ruo(o oydop  mivtlsf 2ur( pnt1tpen octysls2uln s;u4 lxnio3ia1oaDeanvi (0 rumirpou4apt mivsls arrr(m ;u1oetnmoeiasfa ulumont4alxoio3iytfatraivsl()teuo(o no1aptelietatfsrrr(r ;u4tpenmfciatla2ua( o u0trxnif tadlm e iei ( s2urimpou1op  mfesa( a2ua(m no4tpx mo3iaslm emu o t4 rxrmr3ta1fp eaieo (  2um(mpoy4apeelnvsl()srum(rpou1alt  oetldlsDel(ms t0 exnmo todlat  i s ()teum(m3oy4lmtn netl() rraurpno1tpx  ociat a rmn p;(4altnir3oadlpt lneo (0seur(o3iydap nlneta( sDtrurooo0tet ifctad mDrmn p t0 lxoxr3ty1fmtelivols0trxr(o iudop elivsl()aDrru  ;t4tpt mf3tatfa rmnms t4tetoifcio1opD  nvol()srxm(mpou4am e nvi s)srurur ;o0oeto i3tatls2umumsn() eerir3oa1lpDeaieolt0srtmir3iodlltn ietlsfsDrrx p;t0olxomoeiydlsDel( pnt4tetrmoctadomt lnes;t  2trxr3oo4optn ivs () Dra(r ot0tptn i3iasfmDumn s;u)texoxr3ootoaD lu i t s2tm(m iy4opt lncsa(fsrraxmpnt4tex  o3iys a2eln pnt)teeoiocootla r n ols)seumir io4llee fviltfarua( ooo0olxomo3ilt mDumnmsn()tltrmr3tydlpDeli o;(0srtrxr3nodlmtemfeiasfaDrrx  no0apx iieilslmDumnvpnu0 lenxfctytfm   i ol()tetr(r nudol elietlt) rrrxrp;u4aetnii3tld m em(mp;u) eerirctytom  lu i;s)texoxr ny4lpe mfvt (faDtau oou0oeeomociydfs ranvsnu)tltnifciy1lat an s;s)trxr(o3ou1lleemici s)sDumur ;o4texomoeilsfmDranmonu0tetnio iotopDelnvilt) ruo(m3iy1ole lfvsltfsDrm(  nu4aet  oeiyt s2uanvs;() leomo3oy1lmD ln ils)texrxopoy1omtnmnes s) Drr(rpnt4oetoifeiys m rlnvo (0 renir ootlaDeaivsls tetmim oydllt lieias  rtaxmoot1aet mo3tydfm rmuvo u0alxoif3totfa r nei s0 etriopou1lm  lfesas)aDur(  ou1tlto ietytls2emumo t0trerio oo1fp elivs;( t2tmxm iodope  fcilsf Dumum ;u1tpx  f3iysla2uau p;t0altrmrcia1lmDrai s s sexmiopiu1ame liei ( s2rrx ooo0aetnmo3iat s2ua(monu)tetniocta1lpDeaivolt srtrim nu4olen fcs t a2tr(rpot0optnmi3ildla rm( o t) rxnmfcoodlmDelnvo s setm(rpny1altelicta(  2tr(mpno4tltomf3ilsfs umums u) rermr oatfaDrauvils  2tmiopiu4opt  ieslt)srtmxrp;t1tetnmi3tas aDuaumsn(4tlermf3iydfa r ivo ()s2ur(o oudape  ncilsfsDtaump;u1tpt  ociad aDrmnmo;u) ltoifcoatoatelu o ( s2urir ny1olenmnei s a2rmu  ;o0alen fetatlm emn pn()arenif3oodoatr ivsls0sexr(m3iu1lptn fvil(f 2rrxr ou4tpen fetysfa rl( o;t) rtnxrciotop eaivsls)t2trxrpnu1al   fct (farum(  oo4oltnmi3iad a emn pnu) lxnmr oa1fptran o;()trxoxrpnu1opee nvt t)a2rm(ro;o0oetoiiciatfaDrmnvp u4aeerxociotfmtrluei ( setrxmpny1ame mictlt  rtm( pno1oex ifetas a em(vo;(4 rtnmr3iotlmt aneo s s2ur(rpnu4lme lncsl(f Drmu oou1alt miciyd m elnmon(4 ltoir3iodop  lnvi ( trxm(r ny1lpt lfes (faDtrx o;t0aet  fciatla ea( o;(0 exoxfcoatfate nvi t0 2tm(r3nudamenmfvsa( arrmur nu4olt  ieilt s emu snu0arxnxr3oadfatranes;t) eumxo3iy4lmen nctlsfarrm(m no4aetnio3iatls2eauvsnt4 exnir3tydomt lies;s0sexr(r3oo4ope lfcs t)a2ua(  oo0opto oeiydlaDum(mp t4tetrmo3ia1opDelivi ( srxrxr no1olenmfcsl(f rtr(mo;t4olxoiiciytfm2emuvon()aetnir3tydfaDr u sl(  2xm(m io4al   iviatfsrurx  nu4aeen ociad a rmnvsn(4arenmrcoa1omteaneils)truoxr iydll nmiesas arta( pnt1tltoiieiys mDulu pn(0 ltnxrcoydoa rluvi;s)trtoxr3iy4ome lnvs (fsDtmu ooo1alenmfctysfmDrauvp (0alxrmf3oydoptelnvo;t0t2urxr3ny4apeelnvsl(fsDraumpnt0opeomfetltla2ua(msnt0alenio iadla   ueo;( trtr(o nu4oleelfesa(f 2rr(m nu4alt moeias mDrl( s;(0trermf3tatfatrluei t)srtoxr oydlm nmfeiat a2rmur ;u1tptoiieiytfmDeauvo;u0tltnmr3to1om eai s;s)t2tmxo ou1lpe  nesa()sDta(r ;o0opeo ieiys m2emn o t4artnxrctytlm e uvo;s) ruo(m iudlpe  ietltfs2ur(r nt1alxo fctadfs ranvsn(0tltoir3oytomtean s (  2toio ny4ale  nesl( a2umx  ;u1tpxomocildla2rmnvs u4aexnxo tytfp rai o s trtmxm oodaltnlietatf Dtmu p;u0texn o3tydfa2elumo;u4artoxo3oo1lpteluvols texr(rpnodll  mneia()s2rrumpoo4oetoif3iasfa rlnvs (4 rerxf oa1fa r n il( srum(opou4amt  ivsltfsDtr(r ou0tex moctltfmDrln o u0teermo3oydopDraneolt)s2uoxr3iy4omt mieilt srtaxm ;u0tee  ieiyslm elnvo t)tlxrmf ia1fmt ai s () etoxmpiy4aleelivsl(fsDta(r ;u4oltn feiltfm eanvs;t4aeermo3to1lmtelueolt s2xoxopiy4ape livtl() rtr(rp;t4texomociat sDelnvs;t4 eeoxo iotlmD lnvi t0t2urxo iu4ap nmnct s  2tr( p;o4aeto ociat mDrmnvs (0tlenxociadlp rln o (0sexo(r3iy4lp elncsl(fs2ururpoo0aex mociltlm eanmp u) lenxrcoatopt ln i;t  eurxopiudlpt lfvias) rrmx  nt4tlxnmi3tyd aDranvon() lenxf3ootlpDr iei;t srtmxopiy1lmtelfeilt arrrxrp;t0aex mf3ilsfsDemuvs t)tlxnmr iy1lpD anvi;t0srtr(m oudomtemivs sfsrta(  oo4aexomi3iys m umuvpn()artoiocoytop rlies s t2uoxo3oo1lmt liei ()a2ra(rpoo4apt micils s2rl(vo;u4areoir iodlpD anvo;t  etoxr3oodap   fei tfs2urx  oo0oee mieiadlm rlu p;t0altnio3ia1opt an i;t0 exo(m nu1lmte fetasf Durxmo;t4olxn icils mDul(mo u0artrxf totfaD lu o;( s2toio3no4amenmfetas)s2uaumonu1ale iicils sDrln ont) leomf oadlpte nes;s)srtr(rpnudop nmnctl()s2uaum nt0oetnmo3ilsfm2ranms u0tlxrxr3oydlaD livo s) exrxo oy1ol   netl( a2rr( pot0altnmf3tldla em( p;t4aexrifcoadlm e uvo;( t2xr(m3oudape  fei ( srtrx o;t1oee mf3ildls2rl(von(4aetomf iotfmteluvs;()sexm(r iy1ome mnetat)sDtmx  nt4oetoio3iyd m2ua(vs u)aleniocoydoaD aivo s) euoio3ny1al  livslsfsDtrxmont0olxn i3iyt m2rlu p;()teenmo3iodlpDeaneolt0trtm(r iu4ap n nesat a2urumpnu0aeto ociad mDrmu on(4trerxoctytoptrlnes;t0s2um(mpiydlm e fct tf Duaxmont1oexoii3ils s2ran ont0 lxrioctytla rlu o ()texmxr3iydlleemnci tfa2uru ont1aetoiictyd a el(mo;u0arenmrcta1lmDrlues;s trxm(r3ou4amenmnvi (  2raur ;o4alxoif3iyd sDranmon(0tlermf3oodfptrauei;t0srxo(mpnudame lieiat)sDtr( ooo4opeomoetydfs raumpnt0trtoio3oy1laD livo t) rum(mpny4aptnlfeslt sDumx p;t0opt mf3tysfmDuanms u4tleomfciadfmtr uei;()teurxmpnodam e neslt arua(mont4open ieiydlm2emnvs;t4tlermocia1lm  aivols0 eur(mpnu4llee fciltfa2trxm ;u1tetnio3ildfs ulu s (0tetnif3io1oa rlneo;( t2xm(o nodlm emnvtat)srrrxmpou4aex  i3ils a2rln s u)teeoxf oo1lptrauei;(  etrio3nydlpeelfcsas) rtmxro;o0ope iieiadfa rm(vp () etnir iytlaDr i s;t s2xmir3oy4lp  mieias)sDumx pnt1teeo fetyt s2raumpnu0tlxrmr3totoaDran ol( seuoxopou1op  mfvtatf rtru pnt1tpeomfciydfs ulnmo;()aleoxf3oadfm eanesls  2toir3ny4amtemictas s2uaxrp;o4oetn i3iad a ea(vp;t4 renir iadfaDe ivo s0srtm(opoydap emfeilt  2trxmo;u1tex  o3ilsfa umuvs;()teenmrcia1fmDrlivol() ruoirpnu4lle mfviasfs2ua(moou0ole  ieiatla ulnvsnu)artoxf iatfmtelnei (0t2um(o3nydope livtlt)artm(m ot4tptoioeiatfs umuvsnu4altomr todlmt  ivols)t2xoirpou4lptnmivil(f Dumump;o0tptnmi3tat m rln p;(0tetrmo tatfaD an s;s0s2tm(opoydll nlncsa()a2taum ;u1aetomoeiad mDum(mp;u)tlxomr oy1omDeli ol()s2xrxm oudlmt  nci t arumx o;u4alto i3iadls2umuvo;u0tltrmr3iydlaDrlueo s  rtr(r ou4lpte nvslsf 2urx pou1tlenmietldls2ea(vsnu)alxomo3oodlp eaivols truo(opou1ap n fcslsfsDraur ou4aleomo3iltlsDrl( onu0trxnircoa1fmDrliei;t)trum(o3oydolt lnet s) 2ua( pnu4tle iociltfa em( snt)teermrciydopDraneils0 exoxo3iy4apt liet t) 2taxrpnu1ape if3tytlaDean s u0trtnio3oydfa   u slt)s2xrirpny4aptelicilt aDrau  nu4texomfciltfa2emuvs (0alenir oatfp  auei ( s2trxm no4ole mncias  2trurooo0tptomoeiydlm eanmsnu) lxomr iatlm r nesl(0srxr(o3nudlle  fct tf rua(  ;o4apx iicildfa2rlums;t0tlenifcoo1fmt auvo t0seuoirpiu4op nlfcsat) rtaxmooo0olen f3taslm rlnmp (4texomr3iadoaD  nvslt)s2xmio iodlmt lnei ( s2ra(m ;o1olx if3iltfa ulu s (4alxnmr iydlate nes (0setmio oo1amt  nci tf 2umum ;u4aleoioetaslm2eaumsn(0tltnmr3ootlatelu s s0 2to(rpiydll   nci t aDraurpnt1alenmoeiltfs2umuvo ()alenmr3iodla rlueolt srtrxr no4omen feta(  2tauro;o4optoii3iysfaDuauvp u) lxnxo oatlaDranei;t  2xmxr3iu4lme mfvtl()aDtmu poo4tpe mo3ildlsDul(vo;t) rtrxr to1fp eaneo s0 2umio iy1al  lncia() rua(  ot0tleo iciat aDumn p t0areomrcoydlp rlneslt0seuo(opoudamen iviasfa2urur no4alx mf3iatla2eau pn()trxomfcoatfpDrauvsl(0trxm(r3no1ol elivi t)arrax poo0olto fciasfm uau snt)tleriocoodfp r neils) rumim3oo1om nlnei ()aDuau o;u1olxnioctydlm2rm(vo (0aexrir iydlaD  ueo ()trxrxm ny4op n nvt ()srtaxroot4tlx mfeildls rmn o t) lenif todoa r neo;s t2tr(o ny4ale  fcil()arrr(mp;u1aptnmo3tltlmDrm(vp;u4aetnir ty1omD li ol() 2urxm3oydalenmnctat) Dtrur nu4aleo feildfa eanms;() eeoir iy1fatr ies;t0sexrxr no1ope  nvi ()srum(root0ope moeiltla ulnvs;u)trxnirciodop e nei s0 rtoxopio1ap nlfcslt)srra(m ;o4tet if3iydla rl( o t4 rtomr totop eau sls)srurxrpoy1am   nvilt) 2tr(rpnt0aeenifeiysfaDemu s (4teenifciy1fa rau o;t t2umiopnu4aleemiesls) Dumu onu4alto fctld s um( pnt4tleomo3oy1oat aivs s  euo(opio1ome mieiatfaDtm( pou1alxnifciysfa ulu p u0 lxniociy1fp eaues;t)t2uoxo ou1ap nmnvil()s2um(r oo4alx  fetlt a2eaumpnu)trerio oatfat  n s s  rtmxr3oy4oltn nci ()artrxrp;u4tpen ociyslaDranvpnu)aetoifctotoptrau o t) 2xm(r3nydoptnlnvsl(fa2tmxmo;o0olen fciyslm raumsnu)artoxocta1lmteluvilt0 etm(mpoy4opt lneilt s2urxr oo4tpxn i3iadfsDuan o;()treoxf oatfat ln s s0truo(r iydap   netl(faDuaxmont1teeomf3iltls2ea(vp t) rermocoydfmtrlu sls  2urir3iu1lle  ieilsfs2tm(  ;o0oeto ieiyt a2umu o;t4arxomo3to1lmteaivslt0 rxoirpiu1lm  lieta() 2rmu p;o4oleo feiysfsDua( s;t)trxnxfcoatlmDr ueo s teuo(o3iy1op   fci (fa2rrum ou4opxo oeils s2umn p;u0arxnif oo1faD lneo t tetoxo3oodlltnmfvsl( a2ta(mpou4oleo o3ild a ra(mp t0 rxrxo tydlpDr ueolt)teumxrpou4alenlfciat  Durumpot4olxomfctldlm ulu snu0arxomo oydop rlnei;s t2urim nu4ap   fci ( sDumxm ot0altomoetadlm2rmuvp;(0tlenif3oydfp e uvs ()setmir nu1aleelictltfarur(  ot0opt iociasfsDum(mp () ltomfciotfatraueo;s) 2xmim no1olee ncsls s2tau pot1oltoif3tld mDuluvpnu4aetrio3tydfp eaueil() 2to(m nodol   fvilsfs2tm(mpnt1alx  ocildfsDrluvs;u)artoio tydfa eaieil()trxrxopou4lptelnvtatfs2trumono1tptoifciasfa emumsnu) rtniocoatop e uvs;t s2xrim io1omtelfvt t aDua(mpot4tex mfeiatfaDra(monu4 eenmo iytfat anvs s) ruoio3ny4amtn nvilsf Duaumo;u4alt io3ild m ean o;t0arxomf iotlaD  i ols sexrxo nudlle mnvs tfsDra( oou4oltniictyd aDuauvs;()trxoxfciy1la rau sl(0srtmxo3no4am emivtatfsDtm(rpot4oeeniieiad m2ra(vsn()aleoir tydoat anes;( seur(m3iy1amtn ici (faDuax  ;o0apxnmoctls mDeau p u0aexnir3tatop elnei s)texmiopno1apeelietlsfs2ururoou4aeenmi3tysfsDumuvo t0 etrmf iydfa   i ilt)teumxm3iydol nmfcs t  rurxroot0tetnmfeiys m em( o;(0arerio iydfatelnvi t0sruo(r nu4altnliet s)aDua(  ot0optoifeiasfa ulnmp;t0 exrircoa1omtrln s (0 2toxo iodlp elfei sfa2ur(  no1tpeoifetadfs2rl( snu4artoxrcia1lm  auvs;t0 etrxm3iydlme micsa( a2tmu  ;o0aetnmoeiyd s2umu o;(0 rxnxfcoydfp e ivo s0s2trio3iu4ll nmnvsls) 2rr( pnt0olt mi3iytfa em( ont) rtrxr3totopDr uvo;t)t2uoio iy1am nmicta() Dtr(r nt1tptomociytfm ul( ont0 lxrifciydfptr n o;( trurxm io4om nmnctlt) 2rr( p;t4apxn f3tysfm ulums (4 reoif oatfa  li slt0 etoim3ny4openmfvsltfsDurumoot0tpe ifciyd s2rmuvon()trxnmfcto1fat  ivs;()texoxmpnu1ape  ictl(f 2ta(ronu1ope iictyslaDum( o t)treoxr oadoat  ieolt0srtmxo3nydomee fciltfs2umxronu1tleoiietltlsDrm(vs;u4tlxnmf3oy1fpt ai sls0 exm(o oodlpe lfeilt artmxrpou4oeen oetlslm2rmumo;(4 etoxoctytopD anvi;s0 2toxo oudolenlictl( a2ua(r ;u4tltoii3iydfa rmnmsnt0trenxf tytfmte ieil( srurxrpiu1open fcs s sDtm( pnt1olxo fciltfaDrmums;()artomf3tadlm r n i;( texm(m3iu4opeemnvtl()srrrxmo;u1oee ioeilsla2ul(vo;u4aeenmrctotoa eanvo t0 ruoxo3io1al  lfcsa( artaurp;t1aetniieiltfaDrauvo;u0altrxocoodoatranvo t t2xo(opiydll nmfcta()sDrm(  ;t1tet ii3ilt m2ranvo;t4aexrmr3tytom rluvs s s2umim3iu4omtelies t  Dtaur nt4olt  fciasfm rlumon(0treoir3iydfmD ai il(0 exrim iy4ame lfes (faDtrumpnt0oexnmiciltfa ua(msnt4trxrmrcoytom eln s t  exr(r3nu1optelfvtl( s2rrx p;u1oexnmiciaslm2umumo u) etnif totlatrln i;t0 euoir3oy4olte ivsl(faDra(  nt0oeen ictys s2ua(mpn(0 exnxo iotlpDranesl(0 ruoxopoydapt livil( srumu o;t4oet mo3iydfaDraumo;() lxnif ootoa eanei t)texmimpoy4ap   ncsas srum( onu1oex  o3tltfaDraumont)teeomr3tatfa  li o;(  rum(o3io1lltn nes tfaDraxrpou1aptnii3iysfs2ul( o u0tltoxf oodfaDe ivi () rtrim iy1lpenliciat  Dumumpnu4oetnio3tldfa2emnmo;t)tetnmo ia1om  luvi t  2tr(o no1ll nmnvt tfsDrmuroou0alx mi3ild m2elums t)tlenxr iotfmt  u slt trxmim nudlm emfeias aDrrx o;u1optnii3ildlm rmu o (4aleoifcoodomt au s;( texmir3nydal  lnvtlsfaruax o;o0tle  feiat a2ulnvo (4 rerxocoo1lpD lieilt) rumimpiu4lm   fvil( aDumx pno1aptnioeild a eanvp;(4aleoxo3totfmDean o;s t2tmim3ny1optnlieils aDta(rono0ope  oetldfs uan pnt)aetrifciotfa e i ol(0setrimpiu4optemietl()aDua( p;u1opxo fciydfa em(vpnu4arxrxf3io1omDeli s t)t2trim ou4lmenmfvt t arumx  oo1ole  ieiytfm2em( p u4altnmr3oa1omD lu i;s s2uoir ny4ame  nviltf rtm(rp;o4alxo fciatlaDranmsnt0 eeniocoydfaDrauvo;s  eurxopio1lme  netas aDurumpnu4apx ioctld mDrmuvpn()aeermf3tadlaDeau o;t)teuoio oy1lm   nvs s  rtmxro;u4aexoiiciasfm2rl( p;t4aetnmf3ia1fpDeli s;s0truoxr iu4altnmnesls) Draxm ;u4texoif3iysls ra(vp u0trerio ta1fmt au sl(0 eumio3io1llenmnes () rta( pnt4aptniieiytfmDrlu p;(4tetrio3oo1oatraivi;(  rtm(opny1ol   neta(f 2ta(roou0oleo f3iyslmDeaump;() lerxrciadomDeliei t  exrirpou1ll   neta()arraxmpno4alx iiciasla2rau ont0 ltnir iydfmDrluvo;t0 rxo(o3iudap  mivil(farta(ronu1opx mf3tas s emumpnu0trtrmrcoa1la rlnvil( s2tmxr iu4ole lietat)arumumont1tpxnioeils s2em(ms (4tltoifcoo1lptrauvo s  rtrxmpoodap nmnctlt aDur(mpno0open f3iydfs rauvs;(0 rermr3iodom   n ol( sexrxr oy1aptelfvtas)arra(m ;t0olenii3iad s2raums u)tltrxo3iydlmt  n o s)srxrio nydlmte ivil(f 2tm(  no4ape  ociydfa emnmp t) exoircootlpD  i s s trto(o oudllt  ivtas  Dumu  ou1aee iieiatfs um( pn()trerir3oadoatr u s s trto(rpnodam nlfcs tf 2ur(  ot4teto i3iytls2rlnmpnu) reoxo iytlmtelu i;( sruo(r oudapen fcta() rum(r ou1optoiiciaslaDemuvs;(4alxoirctadopD ai o s)srxoim oy4lp elivtas aDuru pnt0tlxo iciysfaDum(vo;t0aexrxo3tytfm e ieo;t s2urxo3io1omtnmfctls)aDrrxr nu1opxniietatfs2ul( o;t4 lxrmf io1la elneo;t  euo(m nodlmt mncs s  2tr(rpoo1alx mo3tltls2uaumsnu)aleoxo iytoaDr uvi s)s2tm(r oodopen ieia(fa2urxmono1aptomfciasfs2ean ont4 rtoxf totfmDraneilt0 2xr(m3no1lp n fvia(  2rrumpnu0alx if3iat s2rau pn(0altrifciatfmtrluvsls) rxoirpiy4lltn ies sfs2umx  ;o0tleoii3iatfs2ean snt4alxrxociotfm elnes;t0s2um(mpio4lpt lfct s sDrm( o;t0oet ioctldlaDrluvpn(4trtnifcoodfpD auvo;s)srxrxmpoy4lmtelici ( arurxrpno1aee mfeildfsDemu on(4artnmoctatlmte ueo;s)s2tmxrpoo1ap emfvt sfarrau  oo1ale mo3iys s2ua(vs;(0 rtoxr tytlpteau o;s)teuo(r3iydllee ivtls)sDta(rpou0olt ii3iadfs2umn o;(4aeeoxrcio1optrli s;s0 ruoimpiodamee fvt tf 2umu pnu4tpx  o3ildls2ul(vsnt) exnioctadlm ranesl(  2to(mpoo4ol nlfesat) 2uau  nt1aexnifetldls em(mp t0trtnmf tadla   nes;t)teuoio oodoptemfeilsf Durx  ;u0texnmietas mDeluvp () leoxrcta1fmt luvo (0 exoxo3iydoptn nci sf 2rmuro;t0altoio3tyt a2emn p;u0tlxoio3oadlpt aieils0t2urxm nudomtelfvilsfs2umxmp;o4alx io3ils a rln o (0trerioctytoatelnei;t trurxm oy1ole lnvi tfsrumxm ;o0oet iictyslsDulnmp;u0arerio to1lm ranvi;t tetrimpnydol e ivias)srrmum nt0tle ifetytfm uan s;t4alxnxr totlatrluvo t trtrio no4alenlneiatf rrm( o;o1tet mo3iadfsDelnvont4arerif ty1laD  nesls)seto(r ou1alt  fvi (fsrra(rpno0oltnmi3tls s2rm(ms t4 rxoifctotfpD lieo;t  2um(opiu4lpe  ivia()s2umum nt1aleomoctatfm ul(mo (0alerxf3io1fmD anvi;s0trum(r3iodlpt mfesas)sDumxm nu4tpt if3iadfm2ul(vpn() eerxf3iotom r uvolt trtmimpno4oltnlfetltfaDtm(mpnu1oleoioeiydfs2rau o;u)arxomo ta1la r ueols  exmir3oo4ll nlnvs (  Dtm(  no4tpto o3tld s2rm(ms;t) etrmocta1fpDrauei;t truoimpou1open nei t)aDrmurpou4tetnmoeiyd a2ranvo (4teenmo3iytlm e neil( s2xr(r nudlmtnmncsatf 2tr(  oo1apto ociat a2eau o;t4 exrxf3oadfmt au o t)sexrxo no1alee fcsl()sDua(m nt4oet  octytlsDrlumpn(4alxoxo oytlate nvi;t0teuoxr no1om emfvt s a2tmx p;o0olx  icilsfaDuanvo u)trtomfcta1fm r n sl( texmxm3io4lp n fvi s) rum(mo;o4aetnmfctysls um( pnu0aetoxo tydfp raivs t)teur(mpoydlmee fetl()sDtmu  oo0olen iciyd m2rlnvp;u)tlxnmr ta1omDe ivo t) exm(mpiydllte nvi t) Dtr(rp;u4aleoif3iyt s2rmu s u0alxoxo3oytom   uvo s0t2xo(r oy4llt lfvtat s2tmxmp;u4oltoifctls m2elnvo;()alerir3iodomtelnes;s) 2ur(mpou1lm elfes s  rur(ro;o4alenii3tytla el( ont0 etnio3to1faD luesls0 etmxmpnu1lleemieia() rurumpoo1ale  f3iat s umums (4trxrmo ta1fmt lneslt0 etmio ou4amt lfviat) rtrx oot4olto ocilt a rau o;(4 eerxr3oadfat aieo;()trxoxm oo4lp e iei t  rrr(mpno1tltnmfetytlmDel(msnt0aetomo ta1lpteli ols)truoxr io1ol nlfvs (  2ur( onu4texnmi3ils sDua(vp;t4alxrxrcoytfmD au i s) 2xoir3iudale lfes ()sDtrumpnt0tlenii3iytfm2em(mp t4 ltoxrciadlptelu s t)sruoxo3iu1amenmfetat  rrr( p;t1tlenmoetatfmDrmn o;u) exrxf iatomDeanvslt0 rxmimpoy4lp  mnctas  2ur( p;o0tpen i3tltfs2el(vp;t4tltoxociodfpD  n s s) etrio3oy4amtemnct () 2uau ont4tet mieiyslm2rln p;u4alenxrcootlpD aivi s0texoxopny4llt lfei (fsDrmx o;t0opxnifcildlm uanvs;u0trerio3ootoaD au s s)truoxr3iudole mfctas srrr(root0oexomfcildfm eanmo;t0trxomfciy1laD  n ol()truo(opny1lmenlfes tf Duax poo4tlen fetysfaDemuvpnt)arxrxrcoo1fp r n s ()t2xoxr ny1op   nvta() 2urur ot1aee mieiltla2rlu s;u0treoircoy1lpteln i s0s2trxr3ou4lp   neilt)s2trxrono1tlxnmi3iltla2emump;t)tleoio3iatlpt li slt0trtrxm3nodam eliesa()arum(r ;u1oee  ieiad aDrlnmo t4areoif3oatfat anesls0setrimpiydomtn nvs t artr(m no0tptoif3tlsla rlnmonu4aleomocoadfp  anvslt)trtrio3nu4lle  nei ()artaxrpoo1apxnmfeiytfa eauvon(4tlerircia1lmDrluvi t0 2xr(opoo1llenlnvsl(f rur( o;u0oetomo3tlt sDrl(vsnt) etomfctadlat  n s;(0tetr(mpoydol  lnvta()srrm(  ;t1tpx  i3iad s ua(ms;t)tltrmr3iydfmDr ivi;s  2xmxo ou4alenmnei (fsDtm(mpot4opeoif3iadlm2ua( o;t4aetrifctytlmDe n s;s0teuoir3nudlm nlncs () Dua( pou0olx  ictydlm2rmumon(0teerxr iydopDeln i;t)t2toio3no4altnlfcias srra(m ;o0opxo f3iys s2rmnvpn(0aetoxfcoadlpDr nvs;t)sexmxmpiydlle  fei (fs2urxmonu4tpt io3iadfs2umnvs;u)tetrmf3oydlp r i i;s s2umxm3nu1amtnlfciat a2rr( ono4tle ii3ilsfaDeanmsnt4aexoxf oytfmDeauvo s)t2tm(m3ou4am   nci sfa2ur(rpnt0aexniieils a2ulnms t0altomr3oadfp e ivo s)sexoiopnu1lleelivi (fsrtrur nt1apeoifciasls2umuvp u0trtrxo ia1omDrluvs;(0 2xmxm3iy1am  mieta( a2ta(mpnt4apt io3tyd sDrmnvpnu)altnxo tatlm  aneils0 etrio3nu4lmeelnei ()s2trxroou4tpeoiictadls2rm(mpnt)aeenmrcty1fpteluvsls0trtoiopoydopt lncsa( s2urumoot4oexniociad m2rm(mo;() lerifcty1fmteaiei s) rxmiopiydlmtemnei sf 2umumonu4tltnmi3iysfm2rlnmp;t)arxoxoctadlpt lu ils seumim oydlmen fviasfa2tm(m oo4tltn fciaslaDrm(mo;t4 reoio3ty1oaDeauei (0t2um(o3io1am nmictl( s2um(r nu1oex ifciysfm ea(mo;u0trtnmr oo1la rau o;s0teuoio3iu1apee ici tf 2tr(mo;u0olt  oetas aDea(von() reoir tadfpt  i s (0tetmxo3io1lpt lnei ( sDuru  ou4oex  ociadfsDra(vp;u0alxnir3tatoateau il( texoxm3iu1lptn nvtls)sDrmx ono1ape ifciydlmDumu snt)arxoxo3to1fmt anes s) eumxmpou1ol e ivsa() Duauro;o4oetn ieiytfa uln s;(0alenmr oydopteau s s) 2tmio3nu1lme  ncs t)srrr(rp;u4tlen o3tlsfa rm(mpnu4arxomf to1lmt lu i t) 2xrxo nodol   fcsl(fs2ra(m no0alto f3ilt mDuaums t)tetrmocoytop   iesls srxoim ny1oltnlncslsfsrur(rpou4apxnmfeiys mDra(mp;u)aetrir tadfa  aivol(  etm(m3iu4aleelfcsasfa2ur(rpno4oeeomfetysla rmu s u)alxnif3iydfm e ues t)srtm(r io1amt lnvs s)arrm(rpnu1tex  ictadfs rmuvsnu)tetnir ootla r ivilt) rtoio ou1am e nvtltfsDrru pou1texn feilsfa2rluvont)arxrifctydfp  aivo;t)sexrio3oo4ap nmfcs sf 2umurpnt4alenio3iadfs ranvonu)trtnmr tatfm elivs s)sruoxo3io1op e ies (f 2uau  nu0aetomieiydfs2um( p;t) ltnmrciotlmt aivi;( texr(opiodalte icsa(  rtr(m ot1tlxoioetls s2umuvo;t4teeoxfctodopD lnei;t0teumirpoy1apen iet s arua(mpoo1tptn f3iyt s el(msn(0aleoio iy1fptranei s0sexmiopoodaltn ict t)sDurx  no1ole if3iltls2ulumonu)teermf to1fmDraneo t)sexm(rpny4alenmict t a2tmx  ;t4oleomfcilsfa uluvp t0arerio iydfat au o;t srtrxo io1am elfeta()aDrr(r ou1oeeomociatfa2rl( p u0areomrcio1oaD au s s trtoiopnu4apeemncil(fsrrr(m ;t0tleo ieiyd s raumo;t4 rtnio iadfpDr nei (0t2ur(mpny1ll   nviasfartrx pou4aetnmictls s2emnvo;t4 leriocoatoa  auei t)sexrir3iu4ole mnvta(  Dum(roou4texnmoetat s ea(mp t4arenif3oatopte nei;s) exo(o3ny4olenmietat s2trx poo4texnmoctltfaDelu o t)aetomo tydlmDeluvilt0tetoim no4lpe  ivtls  2taump;o4apenmi3iadla rlnmsnt0tltnmo oadlp   u s;s t2uoxrpoo4alte nctls  Dtm(mooo1tlenif3iydlm2rmuvp (4 renxr3totla rauvs t0 rxoir3iu1lp nlnciltf Drmxrp;u1ape  fciysfs rm( p u0arxrmociotla ean i t)texoio3iu4aleelnei (f 2tmur nu1tlxo o3tydla ean pnu4 ltrio3ty1fpteaues;t  rxrxm3ny1apte ncsls)s2rr( oou4olx mictydfs2ra(vonu0aetoio tatfm eluvsls0tetr(r nu1ale  fei (fa2urxrooo0ape mfetltfaDrl(vp;t4 lxnxfctotfpDeaueil( t2toiopnudamee iei t  Dur( o;t1aexn fetatfm em(vo;t4tlerxo iydop rlnvsls0t2trio3oy1amtelnvi t)artmxroot1tetnii3iad m2elnmsn(4 exnmfcoatlaD aieo;s tetr(m3oo4omenlieiat sDtrumpoo4oltomociydfsDulu sn(4 lenmr iadlpDe uvsl() 2uo(mpoo4altnmfvia(f 2trx  ;o1optoioeiysla2ra(vpnu)trenir iydopDeanvi;s0 2umxmpou4lmt  ictlt sruaum ot1aex moeiaslm rau ont0aeeomf3to1oaDeai i;() rtoim oudope  fctlsfa2trxrpno4aeto ocilsfa rl( p;t0 ltnir ootopD auei;s srtrio nu1oltnmivs (f Drrx ooo1aexnii3iadlm2eauvp (4tlxoioctodom r n olt texoxm3iy4alenlfvta()srrr(m ;t1oeto feiaslmDeanvonu0 eerifcoytop   ues s)s2tm(o3iodaptnmfcsas sDur(mpnt4aexo oetyd m elu s t)tlenmr ia1lm eaieo s  2uoxopoy1lle  nctlt) Drrur nu0oeenifciltls elums;(4arxrif oytoa  luvi s0trxrimpny4lp  lfcia(fs2trxm nt4oex mieiytfs ulnmp t4 ltomr tytfp ran i t0t2toxmpiudol e ivi sfarta(  ou4oleoifetldlmDrlump (4 ltoxociotfmDr ivsls trtr(r3iy4llte net tfsrra(rpnt0tpxomf3iasfaDea( o;t0 ltoxo3io1omtrluei t s2tr(m ny1aptn fet ( s2tmu  ;u1tetnmf3iyslaDua(mp;(4trtrirctotomDrlu ils)truo(m oudlp emfvsa(fa2ur( pno0tex io3iaslm ul( ont4altoir3iadlaDranvs;()setmimpoydll elietlt  Dtaxmonu1alenmoctat a2ulnvonu)trxrmo3oa1fa eli o;t) rumio3io1am n icilt  Dua(  ;o4texoiieilsfsDuln o t)trtomr totfaDe i olt0texrxmpoudlp  mici tf 2tau o;u0tetoifetaslaDel( p u0arxomr tytom eliei t0srxrimpnudlp nmnvi tf 2ururpou4opxomfciad a2ea( p (4 lermr todoat li s ()t2xm(o ny4lm  mivs sf rtrxm ;u4alx mo3ilt aDrau snt4 etrxr oy1oaDeaiei;s)tetrir iydomtemnct tfsDrmxmoou1oeenmi3ilslsDemn p (0 rxrioctatlp  ai slt)t2umir3oydameelfet s) Dtaxr ou0oet if3iltfs2ean ont)tlenxr io1op eln o s0 2toxo ny1ll nmfcsas)s2rru onu4aeenioeiysfs emn p;u0alxnmr oo1oa ran o t) rtm(r iydop n ivt s sDrmu o;u4altnifetatla2emn snt0artoxr iotoaD an o t)trtoir3ny1lpen fcs sf 2trur oo1oltomfeild aDul(vsn(0 eeoir3todoatr ivs;t0trxrio3oydamt  iesl() rrrxr nu4tlx mf3tlslmDul(von(4 eeomf totfm elnvo;t0srum(r iydoleelnci s)s2rm(ro;t1alt ii3iadla2ra(vont4tlxnxo tydlmDr u o s0t2ur(mpiu4lp emicsls) Drrxmpoo1oex  ocild m eaumpnt4texnircto1latr nvo t t2xriopoo4ame mfes ( s2umumpnu0opx if3tys s2uanmo;t0 renxfciodom eanesls)t2tm(r ou1ll   fvt () 2uaum nt1tlen i3iatfaDeauvs;(0 etnifcoo1fmD lnvil()t2to(r3io1amtemiet tf 2rmumpot0teeoiiciltfaDeanvpnu4aleoir3oodlpt ln i t0 euoxmpoy4lltemncsl(fs2tmxro;o0tlxn ictlslaDeanmo u)aleomoctatoaDr nesl(0 2xr(o3nodamtn fctls aDta(roou1ale  ietys m eanvpnt) rtnxo oa1opDrlivsl() rtmxr3oy1omte iciat)sDtmxmp;t4tle mfetls sDrmnvs (0aexnmf iotopt aueilt0texoxo oudalee fvta( a2ta(  nt1olxoii3iat s um( o () rxomr ia1fmteauei;s0setoimpiu1al   ieil(fsrtaurp;u0alt moeilsfmDraumon(0 eerirciatop  ai ils0srumxrpiodlptnlnvslsfartrumpnu1altnmoctyd m eau s;u)altrxr tytfaD auesl(  2urxm3iudlle mfetasf 2rrum nt4tpe miciys m2ra(vpnt)trtnmf io1omtr ieols0t2toxo oy4omt mnvta() rum( o;u4olx  f3iadlmDelnmsn(4aeerircoodfm rli i;s) 2xrio nudop n nvil() 2urxmono1apen ocildfm uaumo t4texrmocoydoaDelues;( setoxopou4ome mnes (f rur( o;u1oltoioetad a2em( p;u0 lxnmrcta1omDeluvi;s)seumxm3no1amtemnvtls sDrau pot1oee io3tytfm rauvo;t)altniocoadoaDr ivsl()s2xoir3iydopenlnvt ( sDrr(mont1tptnmo3iltla2em(mp t0tlerirctydfmt lnei s) rxr(opiy4omte iei (f rrrx p;o1altnmieildls el(ms;u) ltnir3oytfaDr nvi;s0s2ur(r3oy1lltn fvtls)srrmx  ou4aeeo f3iadfaDel( p u4aeeoxr3totoaDe i sls0s2uriopou4amenlivsl()aDraxmooo1oeto fctlt sDrln pnt)trenir oatomD an s;s0srtrxm oudaltnlivi s aDtaxro;u4oexo ociasla2ul(vpnu0tlxrirctatop rlueils0srto(r3oo4lmtelics ()sDuau ono1tpxn fetytlsDrl(vsnu4 rtnxo oo1optelueols)tetmxo ny1open fet t)srtrxmpnt1ape mictyt s2uau p t)trxoxr3iatomte n ol(0texoim iy4ap   iesltf Dtr( ono0oex ifciytfsDulu pn()aexomo3iotlatrli o;t0 rxoiopio1olt  ivsa(  Dtm( p;t0opeoiiciydls2ua( snu0arenio tadfmDrli s t  2ur(opny4opee ics t)srrm(rpnt1apt  fciyslm eln ont)alenmfciadlaD  ieo;s0t2trimpiy4ale  nvs t)arur( p;o1apxn ociyt a elnmp;(0tlermr oatfm elueils0t2urxo3oy1ameemivsat)sDumuro;u4tpxomfcilsls2rlu snt0teenxf iatoatrlues t0seurim3nu1lptnlivils arrr(mpoo0tetnmiciat sDuan o;u0teenxo3io1op rlnvo t)srtrio iy1alee fvils  rra(mono1tlxo feiasls emums (4aetnir oy1opt livi;s0s2trirpoo1llt lfesl(fs2tm(mono1oltomociasla2uanvo;(0arxrmo iydfm ran ols0srxo(r3oudal   nesa( sDtax oou0olxnmi3iytfa emumont)altnmr3tydlmD ln o;t trtmxo oy4amee feiasfarururpnu1tex iietatlm emumpn(0alxomfcty1op ean o;(  2urxrpoy4am elivs s aDrrx p;u1tpe  f3iysfa2rmu pnt) reoxrcoatoatr ieil(0 2tmir no4opeelfvsltf ruaurpoo1apxnif3tad sDrmuvsnu) rerir3ootoptr ivs;(0 2xrim oudoltelfcil(  Dtax  nt4opxnmiciad s rm(vpnu)alermr iotlmte ivo;s trtmxo3no4amt mfcs 
\ No newline at end of file
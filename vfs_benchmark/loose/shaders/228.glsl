@@ -0,0 +1 @@
+i o;()setoio3nudape mnvs tf Dtmum ou4tpt miciadfaDelnms;() rtnmo3iy1oat  neslt s2tmiopio1al nliesasfs2ur( pnu1alenmo3tad mDuluvs;u4aleoircoytfp rli ilt) eto(mpiy1aptemivtls arrmx pnt4oexnmieilsfm ulnvon(4 rxnio iadoptrauvil(  2ur(rpno1lm  lict t)artmum ;u4tlen ieils a2em(vs t)alxnxr tydoat lu o s) rxrxm3ny1lm  lietas  Drm(  ot4oleo feiyslm2rmnmsnu0tltrxf3ta1fp rlneils)srxo(m oy4amtnmfes tf 2uaur oo4tle if3tls a2el( p;(4alxrifcoytlaD  uvo;(0seuoim iy4apenmfvta()a2um( pno4tlt mfeildlaDuanmo ()trermfcootopt  nvo;t0 exmim3oudll n fvilt  2uax p;o0ape mo3tasfm2ra( pnt4aeeriociotlptrluvsls) 2xm(opou4lmt  fcs t)sDrmx pot1oexoifeiat mDua(mp;t4tleoirctadfa elnvs ()srumio3nudlpeemivslsf Drmx pou4aptn i3tlsls2rlnmont) exoif iotop ean s;( seum(o oudapte fcslsf 2uaumo;o1aexnifeiaslmDem(msn(4 ltoio iatfp eau il(0teuoxm nudllt  fvs (f rtrum nt0texo oetasfs emnmo;u0alenir iadop  anvo (0t2xr(mpoydlpen nvi tf 2uru  nu4teto fciadfaDrauvs (4 rtrircoadom rluvi;s0trto(o3no4amtnmfvsa(  Drrx ono0tpxo oeiadlm2rmuvonu0altnif tydfaDrlivo t s2xoxr ou1aleelnei ( arraxrpoo0olt  ietatlsDulnms;t0 renif to1latrlues;t) etrxr oo4altelfei tf Dtrxmont1alto fctydlm ulnvsnt0trermocty1omDeli ols0setm(rpoy4ol n ivtasfarrmxmo;o0oexn ocildfaDuan s;t4tlxoxr todfpDe u o s  exo(m3iydam  mfetasfsDrr(  oo0apen fciat m2uan p () rxrir tytfpt aivo;()s2trxopnodamt mnvt t) Dtau pou1tlxniieiatfsDum(mp;(4tetnir3oa1oaDrlueo;t) etrxopiydlme lieta()srrru poo4oex ifciydlmDeln o (0treomrcoatlmt auesls0 exrxr io1ome mfet sf 2rrur ;u0opx miciydfaDrl(ms u0tlxrmr3tatopD  n i;t0trumxo nu1lptelieta( s2rmx p;u4altn ictyslmDra(mp (0aeeoxr3oy1latrauvs;() etrimpou4lmenmivia(faDua(moot4apxn feilslmDumuvo;u)aetnirciodlmt anes;( seurxo3oodaltnmnvsasfaDrrum oo4optn o3iadfm rlumonu0 rtrifciytlpt  uvi;t)s2xoim3ny4omeelicia( arrmump;t4olxnmfeiys s uln p;t0 rtomo3todlatr nes (0t2uoim ou1om emfesas)aDur( ont4oleoioeiasfa elnvs () rtnxf3todomteli i s s2um(o iu1om e fetatfa2rr(m ;o1oetoifciadlm2ul(ms t0arxnio iy1lptranvsl( s2xm(mpou1op nmnei (f Drm(m nt4tpe moeiad a2rauvo;(0 lxoxr3oy1lpD luvs;t  rxo(m nu4lptelfvta()a2um(  ;u4tleoii3iydls um(vs;(4aetnio3oa1fp r ues ()t2xrxopnodapt lict s s2ua(mp;t1opt if3tat s2ul(vp t)tetnif3iytlaDraivil(0trto(mpoydoptn fvi ( a2uaxroou1opx  fciysfa um(vpnu0texomr3iatlmtelneslt0 2trim3oudap   feils a2ua(  nu1tpxo f3iydfm2el(vpnu4 exomr ty1la e nvo t0t2xrim3oy4om  micsat) rraur ;t4optomieiat a2umu sn(0 etnio tadlmD lu ol(0setrir oudlp emnvia( srtrurooo1oee mi3iltfm em(vo;u0 rxnxf3oo1lp e ivsl( tetr(m3io1op nmivsas a2ta(m nu4openii3tltfsDuluvo;(0aetnxrctydoatean o;t tetr(opno1apt mnetatfsrum(r no4olenmfetltfmDra(ms;u0aleoxf3oy1lat anvolt0t2uo(mpnodame mncils)sDtmum ;t1aee ioctatfs2uauvs u) rtnmfciadoa e nvi;s texo(o oy4al e fvtl(fa2tax  ot1tlxomi3iaslsDemump;u0altnmf iatoaD anvo s  etoirpnudllenmfeils a2rmur nt0tptnmfeiad m em( o (0tetoifctytoa r ivi s tetrirpoo1lpe licsls  2ta(ront1oeeomi3tas a emuvsnu0 lxnmf iotlpt aneol() 2xm(r oodomte ivilt s2rm(  ;u4tetoio3iad aDelnmsn(4 rxrxo3totomDr ivolt  2xrxrpou4ol   ict s) rtrxroot0aeeoiiciltls2ulnmo;u4tetrmf3ia1laD anesls)s2trim nodaptnmicsas)aDtm(r ;u4altoii3tasfs emu pnt4 lxriocoatoptranes;s0srurxrpoo4om e ivils) rtaxmpnu4olt moctatfa2ulnvs ()aeeoir3oadoaDran s;( s2xoim3nu4lmeemicsasf 2umxr oo0tptomi3iys s2em(mo;t) etoxfciodlatr nvs (0 exr(r3oo4omenlieiat)arumur no4olxo ictytfa ra(vsnt0trenioctatop   n s s) 2uo(o3oy1lm elivia()s2tm(ro;t4altoioetatfaDrl(vp u)tleomr3iy1lateluvsls s2xrxr iu4lltnlfvsas  ruaxmp;o1tltniociydlm eanmon(4 rerif oo1fp e ivi s s2tmxmpou1oltn icsl()s2rmu oou4teeoifctas m2eauvp;u0 ltrxfcoodfm e nvs;t  etr(mpiudomtelfciatfsDraxmp;o0apt  i3tysfmDrln p;(0trenxf iotopDeaneslt)s2xm(o oydopeemfeilt  2rauro;t0tltoioeias m2el(mp t)arerircia1opDrluvs ( s2uo(m iudll   ncsa(f rtrx  ou4ope micild s2um(mo;u)tleomo3oadfmtelnvsls0t2xoio3iodllt  fcs (fsrtaur ;u1tee  feilsla rl( o;()arxrmfcta1lmt  i il()srxrxo3iodam emfctatfsrua(mpot1tpto feiadls umumont4trtnxfcto1fptrlueols0 2xm(r nydamtemiesatf rrmxm ;o4apxniictltfm uaums ()altrmocoodlp e nes;( seum(m oy1ol  lnetat  2tmx ont4tpxn fcild sDua(mont)arenxf3iotomDrlnei ( srum(rpio1omenlnesltf ruau pno4tptoiietls s2ulu sn(4trtoxo oo1fp e ivslt sexo(rpno1ale mfcsatfsDraurpoo1aeto fetyd aDrmump;u)aetnxo iy1omD aieo;s) rur(m io4ole lfet t) Duau ont0tet mf3tltlm emnmsnt0trtrxr oytfp raues;()teuo(m no1alt  iesltfs2raxmonu4optoif3iytfs2um(ms t)alenmo iodlat li s;t  rxmxo3iy1op emietlt) rta( ono0tpe  octldfsDua( p;t) eerxo to1lp elnvo;s  ruoxr oudop nmfvi t  rtru p;u0texoifetas aDranmp;u) lxnxociydfpte i sl( s2trir io4op   nesa( srrru  oo4olt  f3iasla rm(vo;u)arxrmf3oodla r nvolt)trxmxo io1lpenlfcil(fa2raurpoo0tleomoeiat mDrmn o;t4treoxo ia1lmDr ieils0 rurxopoodomte fcils sDrr(r ;u4alt iocild m uanmo;t) lxnif3tydlmtrlu o;t0setmxr oy1ameelietas)aDrrurpot4aeeomictyt s elums u)arxnio3iytopD an s;t teto(o no4optn fci s s2uru  no0tpeomieilt s ea(msn()tlxnif3iodfptrlneo;() 2xmxo3iy4olt mfcils) rumxrpnt4oltnmfctltlsDuln s () rxniocta1fptr ues;(0seurxopio4open ietasfaruaur ;o1altn oetldlaDeluvonu0trermfctytlate ivo;s teuoir nydap nlnvil( sDrmuro;o1oexo f3tatls2em(vp;t4trxomf oatlaDe ivi s)t2tr(r ou1oleemnet s sruax poo4tlx  f3ias mDuan o;u)teeoxf tydlm rli o ()srxmxo3ny1llt mncslsfa2umx p;u4oetomo3tldfa emnms u4arxnir3iy1op elnvsls) eurxo io4open ivs s s2ur(mpot1opt  ociyd a2rm( s;t4tlxrxr3iy1op eai s;s0 exoxr3iudomenlfvsls sDuru  ot4tleomictydlm2rluvp;(0altrxf3ty1lm elnei s) rur(o3oo1op  miei ()aDtr(rp;u0tptnmieiyt sDeaums () rtnifctadopt ai s;s)texo(m iodll  mfesatf Dtmxr ot1ole mf3iys sDeanvs u)trxnxfctydomDeai o;s srxmxm iy4amtelneias)srtaxrpoo1tpx iictytfm rmuvo;t0 eeoxoctotoa raueo s0t2tmxo nudllen nci t  2raxmpou1aexn f3tydlsDulu sn(0 eenmr todoatrai il()srtr(m nu1lp  mfcta()s2trxmpou0olenmo3iaslm rlump t4 lxoxf3tatfpD anvs;s  2umiopnodlpee nvta(  2rrxrono1oeen ictad m2eanvo t4treriocoy1fp e ueo t0sexmir3oodape licil(f 2taxmooo4tleomictys aDelump;(0trtoir iy1fm rlnes;( seuo(mpou4omenlncsa()artaxmpou1apto ocilsls2rl( o ()arxnmr oo1opDr ueo;t t2xriopiy1lp emicsasf 2ua(r ot4apx mi3tysfm ra(vo;(0teenio tadom e uei;s) etmim3no1ll  miesas)sDum(mp;t4tlt micilsla2rlumsn()texrifciy1opte ivs s srurxr iu1llen icilt)a2uaxronu1texn i3iatlm rmnmsnu4arxrxo iadlpte uesl(  euoio3nodllt mivsa( aDua(  ;t1alxn ietldlm rlu p;t) rxnmr3oadfmtranvi;s trxoxr3iudap nliesat  2urxr ;t0aptoio3tytlm2uaumpn()treoxo3iytfmt  ueo;s0 rurxm ny4lltelnvs ( sDtrxmooo4tptn fetas sDuan o;u0tleoio todlat lu o s s2tmxo nydlpeemnci ()arrru oot0oex mictld a2ra(ms;(0tlermrcia1fpDe i o (0 2xoxrpoy1lm elivtl() 2rrx p;o4apto i3iat m rlnvp;u)tlenioctydom   iei s0t2xr(m3iodol n nes ()aDtmumpou4aleomfeild m eluvsnu4 lenir totla   n slt  2ur(m oydal n ivs ()a2tmurpot0oeeo i3iatls ranvsnt4tltnxf3ootfmD au o;s0tetr(o3oudllee ieiat)s2rmx p;t4tpt  icils m2emu o;(4arxrmo iydop e uei t0texm(opio4aptnmncias  2rmxmp;u1open o3ilt mDumn o;u4tlxnir3oatom raieol(  ruo(o iu4ap nlfei t)a2ta( pnu4aexomi3iytfaDua(vp u)areomo iodfmte u ilt  2ur(r nydal   fcils) rrrump;o4texo o3ild s eln p;t4trxniocoy1omDr ues t)srtrxm nudolenlivsls  rra(  no1oleo oetydla eauvon(0artoifciydopt aueils seurxrpno1ol nmfcia() Dtmx  ;o0apenmfetadlsDra(mp (4trxnxf iydfpDe neo t)srxo(r no4amenmfcsl() Dtmx  nt4aeen oeilt a2emn o ()aleoio to1omt aivslt  2xm(o3oo1alen nvia(fa2tru  no0optnmieiatls2umu p;u)altomociytfaDean i;s trxmxrpio1oltnliesasfsrum(moou0olxo ieiatfs2emnvo t4trerio tytoptelueol(  exoxo3iy4lle lfetltf rtrx o;o0tpeoio3tasfm2rm(mp;t0aetoxf iatlp e uvs (0 eumxr nu1oltnlnesasfs2tmxro;t1altniociyt mDeau p;u)tltrio3oy1fp   iei t)t2tm(opiy4lme lfesls)srtm( pno0opxniieiltlm uanms (4 rxoio3io1omt ai i;t  2tr(m no4alenlfvi s)arua( ont4opeo oeiaslaDraump;(0aexrio oytfpD  ues s seur(m oydoleemnvta()sDumx oot0ole mo3iasls2rl(vo;() exrxo iytfpte nvo;t)tetm(mpoydlp nlicsasfsrta( p;o0aet iiciatlm ea(vo (0artomo3oy1lm eln ilt)tetmxo iy1amee fcsa(fa2urx  nt4tpeomi3tadfaDrluvo;t4texrmr3oo1faDr u i s0teuoim iudlltn fcil()aDta(ro;u1ale ioeiad a2umuvp (4aetoifcty1fmDeaiei ( s2toim3no4amenmnetls)sDtmxro;t1tlx mociytls ranmp t4texnxf iytopD aneo;( s2tmxr nu1aleemfvt ()s2uru oou1aptniicias mDeaums () etrxfciadfpDe i o ()sruoiopno1lleemfviat a2tmxr ;o0aleoioeiltfs2rmumsn(4aeeomo3oatlmDr ivi s)t2urxr iydaltn ici ()s2ra( ont1oetnmi3iytls ua(mon(4tlxrmo io1op eanvs t)teuoxm io4omtn ncta( srtau o;t1tltnmi3iatlaDua(msn() renmf3oo1op elivolt) rtmxr iodaptelietl(f rta(  ;u0tlxo ieiydfm2rln snt0 etrif oa1oa e i i t)trtrir3ou4opt lfct s)sDra(  oo4tpt ii3iytfs2uaumsn(4tlxrifcto1fm raies;()texo(rpiy4apenmfesat  rtm(mo;t0apeo ictytfa2emump;u0aexrmocootlaD lneolt  2tmimpno1openlfcsasfsDra(m ot0opt  ictlt sDeauvsnt) rerifctotfmteanvs s)truo(mpoodam emfcsat)a2um( o;t1olxnmo3tldlm2emn o;t4aleoio to1opDeanvi (  ruoir3iu1ll elnctat s2ra(roou4aleoioeiatlm rlu o;t0treomf3totla   n s s trtoiopny1ape livtls s2tax oot0tpxo oetlslmDemn o t0tetrio iotfa e neils0t2tm(m oo1lp  mivi t s2ua(mp;u4aet mi3tysla2rm(mo (0 etnmr3tydop ran o s  etmxopiydlltnmfeta(f 2tmuronu4olto i3iltfs emuvs (0 lermfcoa1lmte ues ( t2xrxmpiy1ll elneilt)s2trx  nu0alxo ociytlaDua(vo;t4texoxr3oodlatelueils)t2xoxopiy1ll nlncia(farraxm nt1oleomfetytlaDra( s;t0artnmr3oo1oa e uvilt0tetmxo nu4amenlfvtas sDrm( oou0aex iietaslmDul(mpnu) lenmf3oydlpD lu i ()tetrxopoo4apeeliet ( arum(mo;u0aee  octasfsDrlu o;u4 lxoxocta1fp ranei s)srxm(r ou4om e ici t) Drmxro;u0aex iociysfs2umnvsnt4alxrmo ootoa raiei s)setm(rpnu4ap emiet t) 2tau  ;o1teeomf3iatlm umuvsnu0arenif totlpD lnvo;t0 2to(r3nydlptnmncil(faDurxr nu0oetoiociydlsDem(vo ()areomfctodfa r i ilt s2xm(rpoudalt  iesl( arrrx pou1optniocils m elnvs t0 leoiociadlmDranvo;s) 2trxr3oo1lp   nvta() Drr(m nu1tlt  ictydfa ranms;(4alxnxocoa1laDr nvilt sexm(o nu4lm   icilt)s2tm(m ;o1alt mf3tldlaDran o;()artnmrcoadfa e u o (0 exoxo3iu4ape lnvias)artrxmoot1oee iiciys m2umnms t0trenxociatlmteaiei s) rtoio iodapt lfeil()srumum ou1alx moctlt sDum(vpnu4 rxrmfciy1fmD lues;s) 2xmiopio4llenmietlt)a2tmur ;u4oetomf3iyd s ran p;()trtrxo3tadlaD aivs s0setrxr3iudomtemnvsl(fsruru pou0aet iieiyd m2rm(msnu) lxoxr3io1latrai o t0teur(o3ny1lmen feil(fsDumx o;u0alxomfetyt m emn o;t)aetnmocootop   ieolt0tetrimpoy4lmt lfvil( sDtrx pnu1apx mfciasla2ra(vsnu0alenmr ta1oa  auesl()srurio nydllee ietl() Dtrumoou4aexn ieiyd sDran o;t) eerxr3iatfpDr uvil(0truo(mpnydole lfcta( aDrr(rpoo0olen o3iyt s2ra(vo t0aetriocoatlmD luei;( seuo(opou4alen ieilt aDrru  nt4tetomi3iyslaDranvo;()teenir3iydomteaivolt0srtoxm3nodap   fvt t  rum(rono4tet moeiatlsDrmump;() exriocoa1optr nvo (0 eum(o3ou1ll  lici ()s2uru o;o1openioeiytlm rlnms u4arenxf3iadlaDrlieo s trxm(mpno1omtnlfetat)s2um(mpoo0aexniicils s emnms;u)tlxoif oo1op  aiei;s trxr(m oudomtnmneta(f rrrx oot0tpen i3iadlaDemn sn(4 rtoio iodfmtr n i;s tetmxo oydap emiviatf rrmu pnt1tpeoif3iydlm2rm( p;()texrmrciytlptrlu slt0tetmio3nydlltnlictls srrr(  ;t4alto ociytfsDuluvs u0altnif3iotfmDrlies;t trumirpiy4lltelnctat sDrrumo;t4opxoifcildfm2elumpnu0 lxriocoadlateln ilt)trtoxo iudaleemfcs ()aDuru pot1aexnmoctadfmDem(vp ()trenir oodfaDe ueo (  eto(mpoodopt  fvsat sDurxmp;t1aeto i3iyd s2uauvp;u) eeoxo3iydfaDraiei t0sexoio3oy4opee fesas) rta(ro;u4opx moeiaslaDrmnvsnu0 lxoiociadlaDr i i;s0trtoio oodamenmfetas aDrrxrpno0tptn o3iaslsDem(vs;t0 lxrxf3iydom rluvils)trtm(r3oudamee nvil(fs2taxmpot0apenmfeiatlm2ea(vonu4 ltrio iydfm raieolt0 eto(o iu4ap e fvtltf rurx poo1tlxo i3iasfm2rau p t0aexnircootfm ranes (0srxr(mpiodopte fciltfaruax p;t1opxomoeiydlmDua( pnu4 exomo tadlmtrauvsls0setrxmpoo4op nmfvil( a2ua(m nt1alxnif3ildfs2uau o u)tlxoifcty1laDe nvols)t2urim oo4ol  lictatf rtmum nu1tlxoii3iytfa2emn snu)tlxoxfcoytfpDr ivi;t0 exm(r iu1lmte fvt sfsDumxmooo4tpe  ictadfsDelnmp (4 lermf oy1lat auvi s t2urxo iy4lptnlnvs ()a2ra(m ;o4aexnii3iyd m2rlumpn(4alerir oodomteaivo s0sexrxo3nodamen ivtlsfaDrrxmp;o0tlx  ieiad m um(vpnt) ltoxr iydomDe uvi s)trxo(m nu1lltnlici t srrmumpou0aexoifeilsfa2ea( p;t0aexoxr oa1omD aivo;t0 eum(r3nydap  lnci ( artm( pot1oltn i3iydfa2eln onu4texoio oadomDelivols0s2tm(r ny1ope  ictas sDumxm ;t1opxn ictydfa2eanvs;t) rerif iodlp ean ols  etmxopoo4lltemivia(fsDuax ono4altnifeiadfs ul(vonu0 renmo3io1fmDrluvi s0trxoxo oo1amte fvtls) rtrum ot1olenmoeiytfsDel(ms;(4altnif3oydfa rai ol(0texr(o3io1olenmnctasf Dua(mo;u4optn fciyt a ul(mpnt)texrxo oadfat  nvs;(  rtmio iudamenlfcs s)s2tax  ou4olxoiieiyt sDulnmo u) lxoxo oa1fa rluvi;s) rtmxo io1am n fviasfaDrmumpou4oltnmf3ildls ulumo u0trtomf io1fatean i ()texo(mpno1amtnmfeslt)aDumx pnt1apxo oetadlaDrl(vo;u4arenmr oa1lateaieo (  etrxr nodalt lfvtas) Drmx  ou0aet micilsfsDuaumsnu0 leoirciydomD aues t0texoxm3io4olen iei (fsDumumpou1aex  o3iad m2uan o;(4 exrxocoodoa elu olt0 rurxrpiudal   fvta()a2ta(rp;t0alxnif3tyslmDem(vo t4texoxo3tytlp  aivs;t s2xriopoodomtelneils) rtmurpoo4opt mfetldlmDuan s;u)alxnxrcoytlp ean s;t0srxmxm3oy4olen fei t a2rrxro;t1olxn fctatls uanvpnu4alxrio3tytlmtr ieo;s0 2xr(m3io1ol e neiat)sDrmuro;u1olenioctyd m ra(mo;u0tetoxo3iytlmt lueo s tetr(m oy4al  micsa(fs2tm(mpoo1oet moeiytfa um(ms t0teenmf tatla rluvs;t)texmim ny4ol  liesas artmxrpoo0opt  oeiadfm eaumo;t4teenif3oadom  anvs t)trumxo nudalt  nct t)srurumont1olxniieilsfs rlu s u4aexrxrcoodfa raueo;s)srtrim3ny1lp e nesltf 2rau pno1apen o3ilsfa ra(vpn() rtoxociytfa eanes;s0t2uoir ny1llt  feiltfaDrmumooo0apt mi3ildfm eauvs u)altomocoo1fp eanvo;s trtr(r3iodllenmiesas) Duaxmont4oet ioetlt aDeln o (4 exoxr tytop   ieil(0t2xm(o nodolenmictlt)aDtrx o;u1aetnifcildfa uauvonu0 lerxfcia1la raivo t0srtr(r3oy1alt mneia( srrru  ou1olenif3ildfm2ea( o (0 eerif3oytlmD luvo;s trto(m oudalee fcsa(fartrurpou4opxnmfeiydlmDrm(ms u4 exrxfcootlateaieo;t s2toir3nudlp e ictatfs2rrump;t4tlx ii3iatfm uluvs (0tlxomr3tatoate nei;s0t2xoxmpno1lle lfcs sf Duaxmpnu1oltomi3tysfs2rlumo t4trxoxf tatom eanes t0trtrxo3oo1ole miesa() rumu  no0oleoiociyd mDrl( o (0 etnirciotlatelivils0s2xrxm iu1omtelfeilsfsrrmxm ;t1texnifciatlsDrlu s;u0 etnif3ootfmDraivol(0 rum(r3nu1am nmies s)sDuru pou1ole ifetydfm ra(vs u0 lxrmf iy1oa rli ilt t2toio iu4oleemfci ()arraxrpnt4altnmfciytfm2rlu p u)trerio oy1fpte ivi;t t2xr(o oy4alenmfci s arra( ono0aptomo3iydlaDrlnmp u)tlenmrcto1oateli o (0 euoio3iu1omtn fctatf Dtax ont4optomociatlm rau p u0arenmf3oytfaDeai sls trtoxmpio4lmee icilt)srtmxr oo0tetnifcias m uau o;(4aexrmo3iydla  an o;s t2um(o iodapte fcta(  rua(mpnt1tpxoioeiys m um(vs;()tetrxf3iotfpt  uei;(0 euoimpno1apt micilsfa2tmu  nu0tptn oetas a2ul(mp;t)trxoxo3oodfptrlnvi t t2tmim iy4amtnlnvt s a2ua(m ;u0ape moctysfsDrm(mp;t)alxrxo oydomteli olt)t2xmxrpio4optelncsls)srrm(m ou4aptnmicilsfs rmumsn() exoiocoa1om  luvo;(0srtmim oodalt  icils) Dtmx ooo4tlenmoeiytfs2elumo;u0texoxo ty1fpteaneo s0 eur(m nudomen fcslt) rraurpot4aptn feilsfa2elnmo u0tetomr oydlm  aivi;t0t2xrxo3ny1alee nvs s)srrrxrpnu4aex iociltfm2raump;t0teenif3iadlaD  u s (0 2um(o3nydam elnesatf 2rmurpou4aptn oeiys sDua(mpnt0 exnxf oatopDr nei t)s2uoirpio1lpen fvs s)sDrr(  ;u0oeeomo3tltla2rlnvs;u4 exoio oo1faD auvi;s)t2tmxopnydopt lfetatfa2rrxro;o0apxn i3iat s ra(mon()arxrmo3oa1latrluvi ( seuoiopiodamtelncs s) rtmxrp;u1apt  fciydls2em( s;()teerxfctytopteau s t0 ruoirpoodomte fct (  2truronu4tpx io3iysls2rluvonu)treoxo iotlat lu olt  rxrir oodale lnciat) Drax pno1opxo fetad s2ua( on()tltrmo tatlmtrauvs;t) 2xmiopno1lmtnlnei t) 2tmu onu1apxn f3iytfm2rmnmo () rtoir3ty1la eau o (0srtoxrpny4ale  icsas sDtr(r nt0oeen f3iydfm rm(vsnt0aetrio iotoaD lnei t0 euoirpoydal elics s arrau  nu0oexomo3tydfm uaump;u0 reoxo3oodlatr u ils t2tmimpoodopee ncsl()a2rrur no4oee  fciysfsDrlnmp;()arxnmr3iy1opteai sls)srum(mpnodapenmfci t s2uauro;t1tptomfcilsfs2em(mon()arenir tytomtr uei t)t2to(o oy1lleelfvtls) 2rmurpot0tltoio3iad s um(vp;u)tlxnxr oadom elu sls0truoir nudolt mivsat) Dum(m ot4optniocildla2umump ()tlxoirciotoateaivs;( t2xmxm iy1oltn fet t aDtm(mpou0apt ii3tlsls2um( pn(0trxomf3iydfat lu s t)t2xmxopoydapenmictl(fsDtax  nu0texnifetytlsDraumsnu4texrxo3ty1op raies;(  2trimpno1lpe lnvi s aDtrurpnt0olx moetls m2eanvsnt4altnio3to1oaDe i o;t0srxoxrpnudolte nvilt arrrurpno1aleo fciat aDranvpnt0altomoctydlmDrluei;s) 2uoxr iu1alt mietlsfs2umxrpot4aetomfetad a ua(mpnt0 lermr3io1fm   i ils) etm(mpoo4ll   fcs s aDraxroou1apxn fciadfaDeln s;t0alxomo3oy1opD  nvo;t0srur(mpoy1ap elnvsltfsDraxmooo4apxoifciydls elnvs t0 rerxo todfmt aivs;s) rxoir3no1lmenlici s a2ra(mp;u0tetomo3iadfm2emnvpnt0 rtrmf oo1fptelivo t0setr(r nydap e nctat) Dumx pot4olx  o3tldlsDuauvo t4alxrxr3iatlaDrai o;()t2tm(r io1ame lfetlt)sDuru  oo1alt mfctas a2ra(mpn(0aetrmf iy1omteauvsls0seto(m nudoltelietas s2uaxmooo0tlenioeiydfs2rlumpnu4 rtnmo3totomDeau olt0sexmxo nudom e netlsfs2tmx pou1teeoiociytlsDemu snt) eerifcoytfaDeai o;()trurim iodolt  ncs ()srum(  oo4oee mietld a uau snt4tleoio oo1oa   n ols0srtmim oy1ap   icsa(fs2tru poo1aptnifetlsls elnvont)aeenmrcoa1fat aieo (0 exrxopiy4lptnlfes (  Drr(ro;u1aet mocild sDumnms u)alxnmo3tytlatrluvs s0setm(r iu1ol   ivtat) Dur(r ;o4oeeoif3iad m elnvp;t4tltoxrcoatoa r ieo s) 2trimpio4lpenlnvslt)aDtrxrp;u1openifeiasls2ul( o;u4areoio iotlp   ivil() euoxo io1olt mivsas) 2ua(mo;o4apen f3tasfsDemn p;(4tleoif iytfaD luvs;( setoxo3nu4omt mnvs t)aruaxmpot4aee  i3ildlm2uanvo u)texrxf tydomteaivs (0trxrim3nu4ale  fcia() ruaurp;u1tpx  fcias mDul( p;(4arxrif oadlptrai sl(0t2xrim3ou1optelieilt  Drr(mpoo0altnif3iatls2rlumpnt)tetomr3oatlp raueols srur(o iy4ap n fcs s)a2raum ;u1olto f3ilt aDumnmp;u4tltrxrcoo1fp eln o s)sexoxo3oo4amee fcslt)arrrxro;t0apx  ociadls2emn snu4artrif3ty1fmDr nes;s  2trxrpiy4altemfei tfs2trx poo4opxoifetltlm elu snu0tltnxf ty1optelneslt) eumiopiu4aptelnctat) rtr(ro;o0teenmo3tlslmDulnvp;u) eenio3oa1fm  an sl(0trtoxr3ny1lpte ici (faDua( onu0olxnmictatlaDum(msnu0 etnif ootfpDe nvsls teto(opoy1om emivi ( aDrmu  ;o0oexoiietytlsDemump (4artrxr3iadomDeluvslt0s2xmiopny4ol  mncsa( s2tauront1aptnmoeildfa rl( snt) etnif3io1fm  luvo;( seuoiopnydomte ivt sfa2tr(rp;u4apt  icild a2ea(mp;(0 rermrciodlateaiei;( trurxm oy1llt lnei t)a2trumoot0tlxoifctydlaDeau o;t) eeomf3ty1faD  ieol(  2xr(r3iy4openlfcs sfsDua(rono1tlx moeiatlmDrlums t)artnxrciytfp rln s;s)s2xrxm3iy4aptelics tf rtr(mo;t0tpenifciltlm rmu pnt4trerircia1lm rlivi s0texm(rpoo4optnlfvsat)a2tmur ot0altn oetydlsDelu snu0 lxnxf todlmDelivsl(0s2xmim3iudop elnctls)a2rr(roou0olxomieilslm2ea( o t0aetrifcoadlaD livs;(0seuoxr3nu4ll elneias  2tm(r nu0altomietydfsDemumpn(4 lerxfcia1fpD au ilt) etmxopou4lmeelnvsls)sDta(ront1oetomoeiasfm eauvon(4tlxomfciytfaD lueo s sexmxrpny4amt mfesl(fsrurxro;u1oee moctytlaDranvo;u) rxrxr oo1oateanvilt)srum(m nu1ape mieil( sDtaxro;u0tpen octat s ua(mpnu4 lenxf3tatfa  lu s;t)teur(m3iy4openmfvsat  Dtrum ;u1olxnmi3iadlaDrlnms t) rxoxo3ia1fmD au o ()srtmxmpiu1amtnmicils  2tr(mpot0aee mieilslsDeau pnu0artnxfcoatomt luvilt) etm(r3ou1lpte iciasfsDrrxrpnt1altnioeiltlaDel( s;u4trenifciadfateln sl( t2uo(r3oo4om n fvtlt) rurumonu0apen ietatlsDulnvp;t)aexnio3oy1fptean ol( t2xoxrpny4apen fvs s arrrur ;t0ale mf3tydfa2eluvs;u)altoxr3to1laDrlueil(0teuo(r no1lmt  ictatf 2urxront4ope mieiatfsDrl(vs;t4tetomf3oytlaDrlneil( s2xrxr3iudopt lfvta()srrmx p;u0opeomi3tldlsDum(mpn()aexrifcoydop e nvsls)t2xo(opoudopeelnvi (f 2tr(mpou1texo fetlsfsDumnms;u4 reoio ootomtraneo (0 rtoirpiodaptelfvt ()aDraxmo;o0tet  iciasfa ulnvp;(0trtrir tydopt auei;t  euo(m iu4amenlnvta(fs2um( o;o4olenmo3iat m2rmuvp;(0 ltrmrctodfaDrau o;s0s2xoirpny4lp  mnvs tfa2uau  ;t1aex  ocilt a2rmums;u4altomr3oa1om rauvslt0s2toir3oo1omtn iei () rrr(mooo0apto f3taslmDrlnmsnt)alxomfcoadfat auei;t) 2xo(r3oo4omtelivs (fsrrrx  ou4apxnmieiasfs eluvsnt)teenircoodlpDeauvs;()t2tr(rpiu4omtnlfci sfartau ont0teeoii3iyt m umnms;() ltomfcia1fptr u o;t)sexoxr3ny1ap n fvilt  rtau pno4tee  oeiat mDea(ms;(0alxnxr3iydomtranei t)srurim3ou1olee ivi t srrrxrp;t1alx mieiltlm ul(vpnt)treoir3oytfateluvilt0 rxo(o oy4llenmivsas) rraxmont0altoif3iytfm uanmsn(4tetnmfcoytlptran o;s0srtoiopio4omenlicil(f 2ra(mp;t4aeen i3iasfmDrauvsnt) eenif tatfm e uvo s0s2um(r3iu1op nlnei tfsDurx  ;t4tex mf3ias a uauvp;t0 lerxo oa1fpt luvo s0s2xmir io4ol nmfct ( sDtaur ;o4aeeomi3iadfaDul( s;t4trenir3iodfp rluvs (0 2ur(mpio4op nmfeta(fa2uaur nt4texomi3tadla ranvo;() rtoxr3todoa   uei t)trxoxopiy1openlici (fsDtrx  ot0oleo iciad m2rmn p;u)trxrxr3to1fmtr ieo t0t2xm(r3oy1lmee ieilt sDrr(  nt1aee  icildlaDem(vp;u) rtnif3ia1fat lnei t0s2tmiopnudop  lfet s) Drmu  ;o4texo ictas m2em( p;u)trxrio3oadlpteai i;s trumim no4aptnmieta( sDumxront4tltn ieiltfa2em(vonu)artomociodomDrlueilt0srtm(mpou1llenmicils)a2ua( oot0aeto feiat m2ulnvon(4teenmr3ty1omD aivsls setmxo3nodopenmfcia()a2rrxrpno0oexniiciydla rl(ms;t4alxrxr iodfa eli ilt  2trxo3oydale mies s sDurur ;t1tpx moetlsfm2ul(mp (4 ltnif3oytfp  li i ( t2tm(r3nodaltn nei t aDum(m no0ole  fctasla2emuvp (4 ltnxfciodlat li i s tetoxm3oo4oltn fes tf Dumu poo4tpeo i3iyd a2ul(mp;u4 rerir3iodop   u ils)trxoxo3io1lme mfes t aDtmxmo;t0apx if3iysfa em(vo;()alxnio iytfptran o ( t2tmio no4lm n fetlsf Drax  no4tlx  fetytlaDuanvo;u0arenxr iadlmD an i;(0t2umirpio4lptn fctas)srrrx pnu4opt  ieiyt sDea(vo () eeoxo3iatomtelu s t)srxr(mpiu4omtelicsat s2tru  ;u4tlto oeiyslsDra( onu)teeoxrciatfpDeln o s t2xrxo oo4aptelfesas aDuax  ou0apeomiciasls el(vo (4 exrmf3oatlpt auei;t)s2xmio ou4alen ivia()sDrr(mono1apto feiydfmDul(vp u)trxnmf ootfm eln i;s0setrxo3iudllte fes ()sDur(  ;u0tee  o3tltfs rmnvo u)trxoio3tadlmDeai s;t truoim3io4lp n ics s  rra(roou4tptnmo3iadfsDua(mo ()trtnmfcoydlaD an s;() rxoimpou4ape lfvtasf Drmumo;o4aexn feildlm rmnvo;u4aetrxr tytfaDr ieilt s2xmxm io4apt lnei t s2tmu onu0tpxn oeiatla2uanmsnu0trtrmrciytlmt lu olt0texrxm iydaptnmieil()s2ra(m oo0tltn o3tls m ea(vo;() rxnmfcoytfateau slt)t2uoio oy1ope  fcsl()sDtaumpno1tpxomfciasfaDeluvs () ltomo3tytop eau s;s  rtr(r3oy4amenlfetas a2uax  ;u1tpxnmfciyt sDumnmo t0 lxrxo3oatoa  auvils0trxmirpio1al   fvt (fsDraxrpou4tltnifetlsfa2uln s;t0aeeoiocto1op  anvslt)s2to(opio1ap n ivtl( s2trur nu0olen fciltfs rl( s;()alenxr iodom  aies;s seur(r ou1olee ivi (fs2uax  nt0opeoifetltls2ul(vp u0tlenxo tatlptelnvo;t  rxr(o3ou1altn netlt)sDtr(mpnu0texnio3iadls2um(mp;t4tetomr iatfa  auvi;t texmirpnydomt  fesltfs2tmxr no0oetomociad a uanms u4aexoioctadfaDr ieo;s)s2um(r3oo4al  lneiasf 2uax poo4tpen f3iysfm ean pn()aexoxf3oatomDr nvs ( teurir3ou1aptnlietl(f Dtaxm nt0oetoif3iatlm eln p (0aexoir3to1oaD ln o;s texo(m ou4lmtn fesltfsDtr(rpno0oet  feiyt a ea(mon()alxrifciadfpt auvols0 rur(o oodoltnmietlsfaruax oou0oee iictlsla rmnmsnt4 etoio3ty1op   neo;t0 rxr(o3nu1amt  nvtatfs2tmx pno1apt mi3iltfa rm(mp u) rxnxr3tydlmtr u slt)texm(o3no4omte nvtatfsDtaxr ;u4tet  octaslsDemnvs t)tltrif oytlmDe nvil() euoim3oudll n ncsas)a2rm(rpno1tptnioetls a em(mp t) lxoxrcoodlmteluvo s)srtrir iydaptelfes (f Dum(ront4aeeo ictld a2em( s u) renio3tatlm r n sls trxoio ou4apt mfetlsfaDtrxmooo1apx  ieilt sDumnvpnu) etrxrcia1lptrlieolt) 2umxm ny4alt micia( sDra(mpno4oltomf3ilt a2umu s;t4 lxoxo iy1omte u o t0t2toxo3oy4ole micsls aDua( ooo4ale moetltla ea(vpn(0 lxrxo ootla   n o;( srtmio iy1optelnesas) 2ua(m nu4ape mi3tytfmDulu onu0aetoifctotopt  n s;s s2tmxr oydomtn fviasf Dta(r ou1opeo feildfm2umnvs;u4 rtoxo3ootoateluvils) etoxopiy4amtelnei (fs2tr(mooo1tpx  o3iytlmDrl(mo;()altnxrcto1fatr i s;t)srxrxo oydopen neiasfarrr( p;u0aetn oetlsfa2ul(ms ()tltrio3oadlm r uvo t) 2xrxrpiydoptnlivtlt) Drm( ono0altoif3iytlaDemnvo u0 rtrxfctadlp elnes;t)t2xmir no1lle lict s)artaxm oo1alt  f3tysfa umuvpnt)texrxo tytlmt  neo t) rtm(opoy4lltnmncs t)sDtmxmooo1oeenmieiat m ea( s u)aeerxf3iy1fmt anvs ( seumiopiydlpe mict sf rurxrpoo4tpx  o3tydfa rluvs;u4altrxo3io1lmDeauvol(0sexmim ou1om e fcilt artm(mooo4tpt  iciasfs2rmnvsnu4 exnxf oytlp  anesls)s2ur(mpnu1ol n nvsa(  rrrum no1aexomfciat sDumuvo u0teermf3iydlpte n o;t seurxopiodlmte ies tf Dtrx p;u0opx  i3tatla2rmumont0alxnifcoo1omtr ieslt)setrxr3ou1lmtn nci ( aDtm(m oo0olt  fcils s2uau p u4 exrxrcoo1fmDrau o t0 ruoxm3oodlpt mnci s a2rrurpno1tpxoif3iadfs el( o;u) exnxo3oatlpt lu s;()s2xo(opou1llee iei tfa2trxronu4oeen o3iatfm2rlnmon(4teermfcty1opD luei t0texrim3no4al emfcs s)aDrrx pnu0opxn fetadla ea(vs;(0 ltrxr3iadlaD aues;s)t2uoir3iydlpenmnvilsf 2tru poo4tleoiociys sDea(mpn(0 etrmociadfp   nvo;t)tetoxr no1op elictas)sDum(  ot1apeoii3taslsDrmu o t) leoir3iotoa rlivo;t t2xoim3ny1oleemneiatfaDrr(m nu1aexoii3iltlm elnvp (4altnio3oo1late i s;s0teurio no1ameeliesasfarumxrpnt4tpt  ictydfsDrlnvo t)artrmo3to1lmD  ueilt)t2urimpiy4lp  mfvtas a2rm(mp;o4ope moeiltfs2ran o () ltnmf3ia1faDe nvo t0srxmxmpnu1ll e fvils)s2tmxrp;u1ale moeiytfmDemnvs u)tltomf iydoatrlieols0srumxo3ou1lpee ietas arta( pot1alx  ocilt s2rm(mo;() lxnifcootomD  n o;()t2tmxm3oodlm elietltfa2rm( oot0tee mieildfa2umu sn(0altnmo3iydoa  lu i;t) exoirpnydlp nmfctltfa2tmu pno0aee mf3iatls2rau s t4 rxnmfciatfpDeau i t0seto(r iu4alt  ncsas)artau ono1teeo fciatlaDul( s u)alenmo iydlate u i t) 2uoim3oo4ap nlivsls)s2tr(m ot4aexo feiaslm uau s;t)tltrmo3oa1omD auvol( t2trxm3io4ame mnei sfa2ra(mo;u1altniictas a rluvo;u4arxoifciatoa rlues;s s2urirpoudopt  fci s  2rmxmp;u0oex iietls aDelnvo (0aexrir totfp elnvo;t0trurim iu4lmtemivs t srtm(m no0texnii3iad m el(ms () rxrxr3iy1fpt  ivo (  exrxo nudlmee ict sfs2uru pnu4apxoiictatlmDrlnmo;() lxoxfctatfm eai s;s0seuoxo3oydamtelnetlt  2taum ou0opt  fetyt s2ea(vs t4trtomo oy1lp ranesl() rtrxr nodllenlfeils  2ta( pnt0olxomfctldlmDrlumo;t4teerioctotoptranesls)t2tr(rpnydlmt liei s  2tr(rpno0texn icilsfs umumo t0 lxnioctytlptrlu il( sexmxr3oo4lleemieiat sDuru p;u0olxnmf3ilt m rlnvo;(4aeenmrctydom rai s;t trum(o ou4opeemfvi (fs2umumonu4apxomf3tytls2rmnvp (0 etoio oydfpD aivo;s)s2tr(mpnu1lp emfesat  2trxrpoo4tpx ioeiytlmDrluvpn(4tlxoxociotlmD anvs;t) rxrir3iu1omee fvtasfaDum(rpoo4oet mi3ilslm ulnmp u)aetoir3io1op eaueo;t  2urxr3iy4olte iet sfarrrx  ;o0opx  fctysfs2elnmont)tlxnxf oatomDranvo () etm(opiy4ape micsas)a2tm(rpnt0opeomf3iasfm emnmsnt4texnio iytfateaivo;t  2xrxm ou4ol   ivi tf 2rax  ;u1teen ictytla2umu ont) eerxf iatfm r ivs s0truo(r iydom nlfetlsfarurx pou0oeeo oeiydfa2eln pnu4tleoxrctotlmD an s (  exm(r no1ol  mnet ( srur(r oo1tleoiiciadfs ean p;u) lxrif3to1fpte nes;(0srxoxmpiu1apt  nvs s)sDrax poo1apeoifciydfa ua( s () exomrciadoaDelnvo;()seto(opny1lp n ivi (f 2tm(rpnt1tltn oeiytfaDuaums u4texrmrciatomDeaies t)setoxmpno1lmt lfet t) Dra( onu0openmo3tasla el( s;u0treoifciytfm rlivolt0t2to(mpoodamt lnciatf rtmxmo;u1tpx ii3iaslm emuvo u0tlxoioctatom  lu slt0srurim nu1lm  mneta(f rtmx poo0aleomietld a2rmnmsn(4arxnxr3oydoat lu il(0s2xm(opiu4lmenlfet (f Dtrxrpoo0altomfctatfa ean o t)tetoio3io1op   nvo;s trtr(r oydomtelfctl()a2tax p;t4tpenii3tlsfs2ua(mont)trtrxfcoa1lat ln s ()t2uoxm3no1omte fcs s srtm(root1teeoii3ildla ea(mo;(0 rtnxrctatoaDrlieo t  rumio3oudll nliesas)s2rax o;t4aexoio3iyd mDumumo u0tlxoxf3iotopteaneo s  exoxr3ou1llen nct ()s2rrxrpoo1oeenmi3iyslmDuln o;(4aeenxoctodfa eluvo ()seuoim ny1amt livta( sDtru oot1aee mf3iat mDelnms t0 ltoxo3oytfm elnei;(0 2uoxm iu1amtemfvsls aDumumo;o1aex if3ias aDeaums;t)trenmrcootomtrlneo s)s2tmio no4lp e ncilt)sDtm(mp;o4alt  feiysfmDul( s;u4trerxo3oa1lat auei (0srtm(m oudol elfvtls sDrax  ;u4aeenmf3tatlmDemnvpnt)trerio oydfa e ies (0s2umxrpoy4ame mici s  rrm(r ;o0tpxnmociydfsDelnms (4alxrio3tatomDrau slt texm(r3iy1aptemfci s)arrmxmpou1tlenmietasfs ul( on(4alxrifcoy1op ran slt0srtoxm3iudlpeeliei t)artru  nu0tle ioeiytfm2eluvsn() lxoxf iotla r ueo;( srto(o3no1amte icil(f 2ra( ont0tpxnioeildlm2uaumo;u0trxrircootoa e ivils teumxo no1al nlfei sfs2rrx onu4apenmoetydfm rmnvs;t4aleoxo3tytfaD li s s sexoirpnydaltnlivsat) 2tmumoot1tpxoioeiad mDua(ms u0aexoxo3io1fm   uvo () eumim3io1apt lies t)a2rrx p;o4oeeo ieiadlsDuau s t) rxnxo tadfaDe ivs;t0 etm(r3oy4aptnlicta()sDta(mpot4olx iieild a2rlu p;t0aetoxr iytlptelu ol(0s2ur(opou4lleelfci ( sDrr(ront4oee mf3tls a rm( pnu) exomr3oo1fp rlnes ( t2xrim3nu4lp e icsls)srrm(m ot0aptniictatlmDem( o;t4tlxnxr todla e u s s  2xmxrpny4lm n ivsas srtrxm ot0apeoiieiadla uan s t0teenif iy1fpDr n slt0t2xrxr3ou1olenmiei sf Drmumpoo4texomiciad m emuvsn()aexrmr oy1fat auvo;(0 rtmxr3ny4om  livilt  2urx o;u1tlxnmfeiyd s2elumsn(4artoxfcty1omDe u olt) 2uo(o3no4al nlieta()aDrm(  ;t0tetnmociytfaDrmump;u0aetnxr tytoa rlnesl(0sexrxmpoodoltnlnctasfsDtr( ont0aeenioetytfmDumnvo;t0tltnmo3oo1fm rlu sls  etoir3ny1ameeliciltfsrraxroou0opeoif3iat s umump;t0altoio ia1fmteau s;() rtmxo iy1ape lncs (fa2ururooo0aee iocias a2ulu o;t4 rxrmf ta1op   u i;s)s2xmirpnydlptemfciltf Dumxr ou1olxo o3ilt a2ul(mpn()alermr to1lmtrai s;()sruoxr oodameemieilt)aDtax pnt0ape ioeiydfmDelumpnu0texrif iydopDr u s t s2tr(rpno1lm n fvtlsfsDrmxroot0oex mocild s umuvo;u0 eenxf3oy1fate ieols trtoir3no1al nlnviat sDuaxm ;u1olxnmociysfm2el( o;(0 ltrxr oatomt aneils0sruoir3nu1am  mietls  2ta(mpoo1apt  oeiasls ea(vp (0tlxrmf3oadomt  ues t0t2ur(m oodll nlfct () rtrxro;t1oex  i3iytfsDel(vsnt0tlxnmfcoa1om ranes s0texrxopny1olenmicsas aDtaum ;t0aee ifciytfaDul( snt4altrxfcia1fm r n o s)srtmxrpou1oltemfctlt s2taum ;o0aex mictadfsDrlnvonu)trxoxf iodfptrlnvsls trxrxr ou4oltnlncs t srtau ont1aetnmfciasla2rln pnu4 rxriocoadopD anvo t s2to(opiy1lmtnmicilsfaDrrx pnu4tlto oetytlaDranmo u4 lxrifctydoa raies;t0t2xrir3oo4ole lnci s  Dtru pot4aeeoiictltlsDumnvsnt0tlxrxr3oytom rlues s t2toim iodam  mnvt s)srra(  no1tle mictldfsDrl(vs;u) rtoxo tytlmtelieslt0 2xm(mpiy4amt  nei sfsDtaum ;o0teeo fctydlaDumuvo;u) rtrif iotoaDe neols)s2xr(opno1amenlfeil(fa2ta(rpnt4ole  oetldfa eau o;u4trxrio3ta1fp e n s;s  2xrim ou1ameemieta( s2uaxmp;u4oee moeiytfsDuluvpnt4 rtnmr tydlpDe iei;( teto(opoy4omte fci t  2rr( p;o0aeen feiys aDul( o;t4 lxomo3iodlpD  nvs;s)trxmirpiydlptnmies t)artrxr ;t0opeoioeilt m2rlnmo (4aeenmr3tydlpDe n i;s0seumimpny4lmtemivt s  Drmur ;t1oetnmoctlt s2rl( snt)texoio3iydomDe u i;s)setm(o ny1lltelncsl()sDtmxmpoo1optnioeiaslsDea(mpn(4 etnif oy1oatrai o;s)srumxr oydamtnmfcils)sDua(  nu1aleo i3ilt m2um(vp u4teeoiocoadopt livo;()seto(o oy1ap nmnesat)srurxmpou4tpt iieilt m ra(mo t0 rxrxfctotop ran ilt)trtr(mpoo1ameemnet s sDtr( pno4tlt ioetydls2rau ont0artnmr3oadomDraies;(0trtmxo nudome mivsas) 2rmxm ot4olt io3iydfs2ra( s ()tlxrxf iotfmt aies (0sruoir3iydaleelfvias aDtm(mpnu0oleo ociad m eaumo;u)artoxrcoydfatrauvs s)srur(r no4lmen ies t) rtrxrpoo0ope miciytfa umuvo u) renxfctodfm ranei t) exrxo3oo1aptelfetat sDua(r ;t0oltomfctls s2uanvo u4 rtnif tydlaD an s;s0 2xrimpou1oleeliei sf rum(mo;u0tpx  i3tldfsDel(vont0alerio oo1oat lu ol( sexmxr3iy1alee fcs sf Dtauroou1ape  fcilsfm um( s u4treoir3oa1omtrlnvs;s) ruo(rpnudalen ivta()a2uau  ot1altnmfctatfm el( s;t) eenmo to1lat au i;s) exmiopiudope mfvsl() Duax  nt1olx miciat a ul(ms u4altrif ootlmtrau ils0trxo(r3iy1lm emnei ()a2tau pnu0aet ii3ilsls elums;u)tlenmfcto1oaD  i slt0 rtm(o3iu1llt mnet () 2tm(ro;o1tpt  fetat s rm(vo t) exoxr3tytop  lneo t) ruoxo nodaltnmivsasf rtm( pnu4oexomiciatfaDumu ont4trtrio oo1omDe ivs;s)trurxr3oydom nlieia()a2ta(m ou0oexo ocils mDel(vs;u)artrmo3oydfatean i (  rxmim3nudaleelfet s a2ururpnt0apxoio3tls a2raumsn() exomo3ia1fmDrai s () 2xoxr3io1ap  lfeias) Drr( oot1tlxoioetytlmDrmu p u0 eenmrcoodom eanvs (  2xr(rpno1optelicil(faDraum no1olt ii3iaslmDelnvp;t0aeeoxr ty1laD  n slt seto(r3iodll  mnetlsfarum( ono4tlt iieiltfa2elu s;()arxrif3iadfpD lueols  rxrxm3iudlpe lnesasfsDumxroou1oleo i3iatlaDea( o u4arxoxf3tytopt lnvi t0srxm(opiu4lp e fes ()sDtmump;o0tlto feild sDel(ms;u)treoircoa1fp eli ols0t2xoio ou4aptnmnvtat  Dtm(r ;u0aexoiiciltla ul(vsnu0teeniociatoa  lnvils  ruoiopou1optnmfvtl(farumuro;t1oeen o3iatfa umnmp;u0trxoiocoydomD li i;s trtrxo3no1lm nlnctltfa2tru ooo1aetn i3ilsfs2rl(mpnu)aeermrctytoaD aneo t seur(mpnudom  livt s  rumx  nu4oet  i3iatfm eaumo u) rtrir3todla rluvs t  rxrim3iydlpenmivtat)aDta(ronu1oltoio3ilslsDelnmp;u0treoxoctytfmDe uei (  euoim3iy1ame mnesatf rur(roou0ole iieils a umuvpnu4 eenxo totfa   ues t0t2trim3nodamte nvs tf Drm( pno1olxomfcias aDrmuvs;u)alxnxr3iotoa eli il(  2toir3oudoptnlfcs ()a2taurpno0altn i3iltfa2el(ms t0 eerxfctotlm  ai ilt)t2umim3nu1al  mnvslt) 2ua(  ot0apt  ieiadfm2rm(vp t4arerir3oodlpDran ol(0seuo(o3iydam e nesat  rrax o;t0alxoiiciytla uan s u4altoir oydlaDr ivolt  rxr(o3iodlpenmicils) rtrxm ot4tptomo3iadlm2rln p;(4texnmfctadfp elu olt  2uo(r3iydlptemneiasfs2tr(rpoo0oltnif3iytlmDeauvs;u) etriocty1fateaivs t0s2um(r oydapee ics s)aDumur oo1olt mieiasfm rauvon(0 ltnmf3tydopDe n sls0 rumxo3nu1lleelncslsfarua(rono4apeo oeiysla2ra(vp;(0 reoio3todlpt li o s0trto(r oy4op   nci sf rtru pot0oexo ieiadls2eanmp u)alenxo tytoaDrauvo () 2umxr oodalt lfctl(  Drrur nt4aet mfctadla2emu pnt4 reoif3oa1oaDelnvs;s)s2umimpoy4lm nmfci s s2ra(ront1tltomicild sDua(vo u4trxnmo3iydom  aneils0 2uoxm oy4ameemfei ( a2raxrooo1tpx  i3tlt m2elumpn(0texoio3tadlaDe ivsl(  2xo(r3oy4ol emictl( srrrxm ;o4opt  fciltla2ua(mo;u)aeeoiocoydfp eluvs () rtoiopoy1lm emict sf ruru onu1tptoifeiasfa emnvon() exrxrctotfa rli slt0teto(o3ou1optnlfei (fsrtrxmp;u4aex moeiltlm2rlums (4aetnir tadomt auvsl(0s2tm(mpiodlle mfetlt a2uru p;t0tex mieiat s em(vs ()arxrmo3tydlpDrlneslt0setoxopiy1llte nes t)s2tm(r oo1apx iietlslm ua(vs u4 rxoxfcta1lat  ieils  rtm(m3nu4ll   ietatf Dur(m ou1altnmieilsfaDrlnvpnu)alermo3iodlmDr i s;s trxo(r3oydaptelivt s) 2rmuro;o0tee mieildfm2rmnvp t)treriocoo1lm  luvi (0 eurxrpoydlp emiesas)aDumumono1aptnmfctasfs el( o;t4 etnmf3to1faDe ueo;( trxoiopnydolt lnctls  Dtm(ronu4oetoio3iys aDrmn onu4teeoir3oo1oa e nvol()sexoxo iu1lp nlicsl(  Drm( oou1aeenifeiaslaDrl( snu4aexrxfciodlm e nvi;()srxr(mpno4lmtnmietl(f Dtmum ot4opto ociadls uauvo;(0aetrmf3iytfat auei;s0sexrxr nydamenlicilt srumxro;u0aexnmfciysfm ranmpn(0tlxnmfcoo1lat aivols0srtriopou1ale miei s a2tru  ;u4opx ifeiysfa2um( s;u4 lenio ty1fm e uvs (0sexoxm io4ope lfvi s  Dtrumooo0olxomi3iat mDelnvo (0 rxnxocoadfmD ln sl()s2umim3iy4ap e fesl( a2umumo;u0apxoio3iydfsDeauvont4aeenif3iy1fptrlneo;()t2xo(m iodlmt lfvtatf 2rrxmp;u1olenio3iyt m rl(mp (4trermfciadfmt  ivolt setoim3iu1olenmneias) rta(rpnt4apx mi3iadfm rlnvs t) eenif3oa1lateauvo t) rur(opnydalenlncia( s2uaum nt1openmo3tldfm2rmums u0 reriocoa1fmt luvi ( t2urirpiy4optemics ( s2tax oot1teeo f3ildfm2rlu on() renxoctotla   ieilt srtr(rpnydlm emfvs sfaDtmxrpoo0tet iieiatlm2emnvo;(0arxriociotfa r uei;(0seto(opoy4ape  icsa()s2umu pot4openmociadla el( p;t)tlxoxf oytfpDe neils t2tmxm io4lm e nvilt aDuaur nt1opxo o3iltfa ulnmo t4trtnmo to1lmDrluvi;s  2tr(rpny4ll nlnei s)s2rm(monu1tetnmieildlm2um( s;u4 exoxfctotopt lieo;()s2xoxr3io4apt  ieta(f Dtau  nt4tpenmf3iaslaDulnvp u0 etnifcoatlptraies;(0texoxo3nodllee ieta()arumu oot1ale iictyslm eanmpnu) eenmrcoodfp rln s t0s2ur(m oy4altn ietl( aDur( pnu1optniietadlm2umums;t0 rtrmf3oodfatrau s (0t2um(m3ou4ale lneia(f Dtrur nt0aeen ietyslaDemuvo;t4tlerxf totlaD lues;(0 rtrirpoo4lltnlnesl( a2uau ooo4aee  fcildfsDumnvpn(4 rtoir3iydfaD  n ols0s2urio io1ame  nciasfarrax pno4oexo fciyt s ul(vo (4 ltnifciatlmt ai s;t)srtmio3oy1optnlicsasfsDraxmoou0olxnmieiysla em(mont) rtrmo ia1opD lneols) rxoxr3nu4olt lfvt tfsDra(moot1tpeoiieildfm uln on(0 rxrmf3ty1lp elies;t0sexr(r oy1omtnlfvslsfs2urx p;o4olx io3ilsla raumsn(4alxrxo oodoa e ues;t0 2xoxrpnodlm elivsat)srrmxm ot4tpeo o3ild s2um(vsn(0 etrmf3tydopDeai ol( trxrim no4om elnvt t)srtru p;u0texnifciysls raumonu) etoxf3iodfmD  uvil(0seurxo oy4alenlfvsat arta(  no4tptomo3iltfm2elnmp t4artnmo3iydoatrlu o;()texrxopio1omenlnes sf Draur nu1alt  f3iltfa2eanvs t4tlxrmr iodfate ivs;t0 2tr(r3oodlpen ncias)artmur nu1oltnmieiasfmDelnmo u4teenxo tydfm  lieil(0trtmxo oodameelnvs s) rtax  oo1tetoioeiltfa2ranms (4 rtrmf3ootopDraivs s  2urxr3iy1ope mieil() 2rru o;u0opt ii3iltfs2ea(ms u)altrxr3ootomD lnvs t0srxo(o ny1ol nmictls sDtm( pnu0tleomoctld a rl( pn(4aexrxr oodlaDrluvols  etoim3nu4ll emncs t s2raxm ;u4tlxomoeilsla umumsnu)artriociotlateliei;s  rtm(o ny4ll  lfetls sDta(ro;u4tetoioetlslsDrmuvon()trtnmf3oa1lmtelneo;()s2xo(o nodlpen ivilt  2rrxrpoo1teen icildla rm( o;(0 lenif iydop rauvo;() eumxopoudomenlfeslsf Dtr(rpoo1tpxn feilsfmDem( p t4trerxr3oodopDr n i s seum(o iu1ap n iciat aDtmxrpot1aptnmo3iltfsDrlu o (4 rerifcoodlpDe ivol(0 eurxmpnodapte fvi (f Dtr(m ;u1altn ociaslm ra(mo u0 renmo tytomteliesls) euo(m3oo1al emfviat) Dtr(m nt4tpxo octadfm uan p t4aeerxr iytfmDr iei ()s2xr(rpio4ll   ncsltfaDurumpoo4tlxnmfcias s2emn pnu4tleomo3iydfmtraies;( t2uriopio4llenmfcsas  2rrumpot0olxnmoeiydla ulums;t) rtoio3ty1om  anvils0truoxr3nudapt mnei s arrmxm ou4opx  o3tlt s elnmp;(0 etnif oatoaD an ils0 rtmxm iydopen ivsls aDtrumpot0oexn o3iys m uauvo u)tlerxfcoadoa  lueo ( s2xmxo3ou4altnlicilt)s2tau p;t4tle iictld a ulums u4arenif tadfa elivo;s0teuo(r oy1op nmnvs t sDtmur ou0opx  oeiatfa um(mo;(0 exrxo3iytfmteai s;s  rxoio oydoltnlfci tf 2trxmp;t0apxoif3iadfa2uln pn(4aeermr3oo1fmt  n ols) exoir iy4lptnmnesl()artaxm ;t0opeo fetltfa emu s;u)tltoifciydfptelivi;()s2xriopiudlm emnet s)srtrxrpot1aleo ieiysfaDrau pnt) ltnifctotoaDr uvol()t2to(o3oudole mnct ( aDuax  ;o1tpxnii3iydls2rmnmo;()texnxf3ia1op eaieo;( truoxo3no1om emnei ( a2rr(mo;t1aee mfeiltfs2rmuvo;(4 lenxr ootoateanvol( tetmxm nu1om nmnciasf Dtaxronu1tlt mo3iyt aDrmnvs t4trtomr oo1om  aieilt) rxm(mpoo1lp  mivt s)arurxmonu4altn ociatla ra( o;(0 rxnmr3oytoaDrau ols)s2tmir iy1am   ivsl(farur(mooo1oetnmfeiasfaDul(vo;u0alenxo oatlatran o;s  eurxm nydal   ietas)sDtaum nt1opt io3ildfaDeau o;()altomf ia1opDr u sl(  2umir3ny1om elfes t sDtmumont0apeomfeiys s2ulump u4trtomo3tadfaD au s;()s2xoimpnu1lpe mnetltfa2ta(r oo1aleo fetytfmDrmuvs t0altoifcootoateanvo;t)s2trxm no1aptnmfvtlsfs2tr(monu1aexo ociyd s2umn o u) etrif3iydoa e nes;(0tetmxo ny4op  mfeil(faDtrumooo1tptoio3ildls2raump u)artrmocoo1fmtr nvo ()srtoir oo4lp   iet tfa2urxmpot1aex ifctytla el(mp t4 rxnxf tydfpD au o;t  rtr(m3nydllen nvt () rta(m nt1open ociadlm2rm(msn() lxnmr ia1fmteaueols)trtr(r io1aptnmfes t  Drmx ooo0oex mfeiysfm2rmuvsn(0trxoxociytfatrau ilt0 euo(o3iodalee ncs sf Drax p;u1alto i3ilt m rmu pn()artrio ootlaD aiei s)t2toxopno1alt lnvtlsfaDra(r nu4aexn iciatfs ul(ms u4aexomo3iotfaDeanei (0s2toxrpiy4alt  fvta()s2rrxroou0oexo oetadla2rluvo t4altnif3iatfpt lneils)trumim oudap n ics sf Dtm(  nu0oexomictytfa2eluvo u4alenmr oytop r n o;()s2xmim3iu4lmtemnvil( srrr(rpoo4texo ictaslaDem(vo ()trtnxr3tadoatelu ils)sexoir3ou4ll emieilt)s2rr(r ;t4apxoii3iyd s2ua(mp ()aetrmr tydlaDr uvslt0t2to(rpny1am elieiat  rrr(rpnt4tex mietltfs2rluvon(4 exrmfcootfmte ieslt)s2toir3iu1amtn fct s arrax  oo0apxnmictysfsDeaump u)teeoif3ty1fatrlnvo;t) rumxr oudol e icil( sDtr(ront1tex mi3iadla2em( ont0 rerxfctatoptranvi (0srur(m3oo4oleemnvil(faDtaum no0texomoetldlsDuan pn(4alermrctydfmtranes;(  euoxopoo4lmtn ieia()a2ra(mpnu1optnmi3iatla2rm(vsnu)altniociadlm raiei t trumir3iu4open neiatfarumurp;o1oleo o3tatlsDumn pnu0 rtrmo io1fp   nei ( srum(m3ou4lptn nvi sfsDra(m no1tltnmieiatfsDran p;u4texomo tydfa e ivo;t0s2toxm3iu4ap  lneiatfs2uaurpou0alxnmf3iysfs ua( o (0 etnio3todfaD li o (  2umxm3iy1lpeelnvtls) 2urxmo;t4tlxnio3iasla elumo;t) reoxrciodfaDrauei s)seum(m iy4ameemict t s2ta( p;u4oexnif3tydfaDum( snu4altrmr3tydfm r ivi;s)texrxr3iu1amenmnctas  2ra(monu4olxo o3iatls2rm(mo ()trtnmfcoatop rln slt) etrxmpou4amenmfes t) rrr(rp;t4tlxo ieiasfm um(von(4areoxfcoatomt aiei t0teuoiopnudam  lfvi tf Drm(mpno1tpe mi3tytfmDrluvo;t4 etoxr3iytomDelies;t setoimpoudlmenmivta(fs2tmu  nu1aex  f3tld sDranvp u0artnxrcty1fm e nvi (0srtmirpnydlpt  ictatfsDtm( pou1oleoio3tyt sDemnvo;()trtnmrciadlateaivs t0s2xmim ny4apee fci s a2umxr ;t4tltnmi3iys sDrmnvp;t4 exomr todomDrlies;s  rxmim3no4op   nvs ()a2um(moot4texo ietatlm2rmn s;(0 lermr tytfpte u ilt)sexoimpio4omenmncia(fsDumxm ot1tex if3iysfsDrmu p t4 eermociodfat  ivolt0texm(opoudap emivils  Dtm( o;u1teenmi3tys m rl( p;() rxnmr iydfpteln i ()trumxo iydop emieilt)srtrumpoo4tptnifeiad m ra(ms;t4 lxniociytopDelneilt0 rxr(o oydole lnesl(fs2tru pou4tee ii3iaslsDuau pn(4 ltnircoy1lmteau o;t) 2xr(r3oy4ll  mieslt aDrmxro;o1tltomicias m rmn o;t4aleoxr3oatfmtr i o s srtoio oo4oltemfeilt)sDrrxr ou1oexniieiydfaDumnms (4trxrir oa1fa raivol()trxrxrpoodaptnlies (farumu onu4tpxomociadfa2eau p (0texoxf iodlptr i ils tetrir nu1lltn fesa( srraxm ;t0texniieiatfa rmnvpn(4alxnxrcootfpteluvs;(  rxoir iu1ap elivilsfsDum( pno4tlx iiciydfm ra(vsnu4 rxnmoctotopteanvi;t  2umxo nu1omenlnvt s aDtaurpot0aet ioctatfsDrauvo;t4 rtrxo todoaDeaneol(0trto(r3oudlm  lncs tfsrum(m ;t0teen f3iasfa ranms ()aeerxrctatlm  aivol(0tetrxr iy4olt mfci s)sDtmumpno4apeoii3iadlmDua(vs (0arxoxf3iadlptrai i;t)tetrxm3ou4alt lfvt ()artaxm ;t1alt miciadla2rmnvonu4artnir tatomtrlu i t0setmim3no4lmt  fesas aDuau pnu0tptn iciys a2emu pn(4aetoxf3tadlmDeaivolt)seuo(r io1opt  nei t)a2tm(mo;u0texoioetat m ul( p (0artomo3iy1faD aivi s  euoir oy1lpeelncil()aDumu pou1aptomi3iydlmDrmums;u0trtnio3todfaDean slt0trxmxo3oo1lltnlnet () Dtrurooo4opeoifciytla ra(msnu) leoxr3oadom  ai i;t)s2um(r3nu1lm nmnvs (fsDtr(m no1texn f3iyslm2em(vo (0treomr3ty1lptranes t) 2urxm3iy4optnlnviat) rra(mo;o0alt moeiytls2el(vo;t4 lxoiocio1lpt auvil(  ruo(o3iodlm   ncta(f 2uau  ou4oex ii3iat sDrm(vs t0tlxnif oytlpD aieo;t) exm(m nydlm n ivsl()sDtrump;o1tptomfeiadla2rmuvo ()treoxrciotfpte u o;s)t2ur(opoydal n neilt  ruaur no4tltnmiciyslsDrln pnu)tlenxfcty1optrlivi;s)trtm(rpnu1apt mivils arrrx  ou0tlx mieils s2rl( sn(0tlxriociytoa e ieo t s2tmir oy4am  licsl(fs2tm(rpou1alen f3tlsfsDuanvs;t4aetomr ia1lptrlneo;(  2trim3oy1lm e ieils  2rmumpou0aetn ictldfa2rl( p u)tleomf tytfa r ieo;t0truo(r3oy4lptemfvi (f Drr(  ;o4optomiciltfa2rmnmo;u) rxrxo oadfm   u olt)texrim3nu1amen nvia()aDra(  ou1optn oeiysls umnmsn(0 ltrifciadoatr nes ( trxmir iy1ol nmieta(f rtrxr ot0apenif3iyt a emums t4texomocia1lpD aivils)sruo(r3io4ap elfcs tfsDtmx onu1olenmo3iydla2uanvont0trermo3oo1fm eaieols texoxopno4om  mneia(fs2tau  no0tlto f3iys aDuaumo u)tlxrxfcty1lmt ln s;( seumio3iodol nlneslsfs2trxr ;u0tltoiiciyd a rmnms u4 rxomrcoa1fmDe ivolt)t2xoiopio1omee iesasf rurxmoou4texnifcild aDeln p t)tetoxr3io1omtr neo;() 2uo(opio4opee ivsatfa2umu  nu4alxo fctyt m eauvsnu4 ltoir3totfmte nvils)seuo(o3io4ll n ncsasfsrrrxro;o0altn fetys s elu p;t4tetrmo todopDrau s;t)setmio iodap emfesas srtax  ;o4tpx  fetlsfmDeau p;u0 rtoxrcia1fpDr ues;t  2um(r3iy4lp  mfvtl()aDuauro;u4oee  o3tlt s2rl(mo u)tetnmo to1lp r ies;()srtrxm3nodlmtelnci (  2rax o;u4teen oetyt s rmnmo;t) exriocto1lm   u s t seuoirpiydlle lictl(  2um(mpnu4aexniociat aDum(mpnu4teenxr3ootfpDe nvsls) rum(mpoudom nmivias) rtruronu1alxomi3iysfaDem( onu)tlxrif iydom   u ilt  etrxmpoydlmen fvi (  Drmxmoou1apxnioeias a elnvo;t0aexnmf to1lpDrlneil(0srtm(o io1op elfctas sDrm(r nu0aeto f3tlsfa eaumpnt4treoxf todoa eai sls) ruoxopoo4omen fvt t srtrumpot1alxn oetydlm2rmn s;()texomf3oytop r ies ( trxm(m3iy1lp nlicias)sDumum ;o0aet ii3tas s elu pn() renxr3tadlat aivo (0seuoim ny1llt lfes s) rua(rpnu4tle mociatlaDrm(vs u4aetnifcoadfptelies t0 exmxrpnudomtn fctl() Dumxm no1tpt mf3ias mDra(vo;(0teeomrcto1fa  lnvslt0t2xmimpnu1ll elfvsa( arurxrp;t4teen i3iyt m2umumont4altnmr oodomDr i s s)teur(mpou1ol e netat)sDuaxmpot4opxnmoetldfs ra(msn()trenifcoa1fp  aieol(  2umxr3oy1alen nes (fs2raxm ot1alt iictas a2ean o;(0tlxoir iodoat lieols srxoir io4apenmics tfa2rrurono0aexnifeias a2um( s ()trtrxr3oytfpDelues () exo(m nudlmee nvslsf rrr(  ;o4tlt  iciyd m2um(ms;t)arxrxo3iytomD lnvi s)s2xm(rpoodalte icta() Dtmxr ;o1aexo f3tydlsDeanvonu0tlxniociotlpt ai i s  2uoimpoy4op e feilt sruax pou1tpe ifcild aDuanvp u0 rxnmo3iy1opDe n o t)srxmxmpoudol   fci sfaDua( oot0ope iociyslmDrln o (0 etomr to1fa rlu s;( tetmxo3iudalee feil( s2um(m nu4apxnmo3iydlmDrauvon(0teeomr3iatlp rliei s)tetm(o3oo4apenlics tfsrumx oou4oleniiciyt a2rm( s (0 renxocio1laD auvi s0teuriopnodoltnlneil(  2rruro;u1tpx ii3ilslm rmump ()areoir3tytoptraiei;( srtoim3iydome mnvta(fsrum( oot0olt mo3iltlaDra(vs;u4 exrio totlmte iesls0 etr(mpiy1al nmnes ( sDur(mp;o1ale iieiysfsDeln snt0alxoirciytomDe nvol()s2xmxr3iydlptelfvtls)a2ta(ront0tet mfctldfmDea(vsnt0 ltnxo ootfpD anesls0seumxmpnu1openmnvslt aDuau  ou0tlx  i3iysfs ea( s u0tltrmocta1faDrai sls) rxoio oudlpe mivt (f 2rrxmono0opx ii3tlt s2ranvp;t) etnio iodfpD aueo;(0s2xrxr oudapt lfcsat) Drmurpoo1tpx iieiysfm ulu pnu)teenifcty1oa raieol(0 etr(r iu4lp emnctas) 2rm( pno1altnmf3ildla2emu o t0 etrxf iydoa  au slt  eurxrpoy1lm  mfcslt)a2tmx p;t4altn i3iydfs2elnvo;t)artnmf iotlmtranei s0srumirpno1ap n nvia() rrmurpou0tpeo ieilsfs rm(msnt) exnmr3to1oatrlu s;t texo(r ny1oltn fvslt) rtr(mp;t4oee if3iysfs eluvont) rerif3iytlp   uei s0trtoim ou4om e iesl(  2rmx  oo4oex mieildfmDea( ont4 exrxoctodlaD ln ol(0tetrxrpoo4lle  feiatf 2ururp;o1oetnioeiadlaDrl(vo t4 lenir oatlmDeaivo;s  rxr(o3no4ap nlncilt  2rau pou0aetniieiysla2emumpnt)alxoifcoy1oaD ai sls tetmim3io1opt mnvils) rua(  ;o1oexnmi3ias s2ra(msn()artnifcoydla  aueo (0 2xm(m io1ape mfcs t)s2ururpnu4tet iociltls rlnvp;()tlxrmrcto1fpDeauvi s  2xoxmpiy4om   icsat s2rr( p;t1apxnif3ilsla ulumont0trxoxrcoydlatr neolt0s2uo(mpou4opee iei t a2uax p;o1aex mf3iytlmDem( ont)tlxrmoctadlp  livo;(0tetoxm iydalte icta(  2tm(ro;t4texomfciytfa2umnvonu4texnxf to1fa rauei ( texr(m ny4olee ncslt arumxrpot1oltniiciyt aDrmu s;t) eenmr io1opt aivs t t2xoxopoodlltelivsa( a2rru poo1alenio3tls s2em(mont0texnmo3io1lptrln ols0 rurirpiu1lpt liesls)artmu oot0teeomi3ias mDrauvs u4arxrxo3ty1fpDrluvslt  2xoxm ny1opee ncsltfarra(mpot4tleo i3iasfm2rlnmonu4aexrxf iatlatraneo;() etrxr3no1lmeelfesa( s2taur ot0tlxnmf3tltlaDemump (4trenir oadfpte u o;t texmirpno4olte ivs () 2rr( pno0ope  fctadfs2umnvs u0 etoirciadoatraivols0trxmxrpoy4ope lneta() Durum ;t4tpxn ocias mDrauvpnu4 rtoxr totlm  an o;t0texoir3oy4ll elfetlt)srum(mo;o1tetnifeiadls2rl(mo u0aetoxf3iatopte n o;t0teuoirpiodop n ics sf rrau o;o1opx io3iytfsDrl(vo (4arxnio3iatfptrau ils trtoimpno1apte nci ( srtru pno4aeeoio3tldlaDra(mp;t0altoif iydfp e i o ( s2xr(opiy1lpe lnvtl()srtr(mpno4tee  oetyd aDrmu pn(0arxnxocia1oaDrluvo s texrxm nodllenmnvsa(  Dururpnt0aeen fetatls elnmonu)aetnmf3totlm ean ols) exrxo nu1am elnctl()a2rm(m ot0optomietldfa2elumo (0trtrxr3oatoaD  i slt)sruoxm3oudaptn ict (f Duaxm oo1olxomiciad a2eluvs;t4 reomr3oytlmDeaivil(0 etm(m3iydopt lnvtl() rtau  ;o0oexoio3tlsfmDrm(vpnt0 rtoio3tadopDrauvs;(0 rtr(m nu1ope mnct ()srrm(rpou0olt moeiadfaDeluvp;(0tetnir tydla r nvi s t2uo(r3iy4omeelietlt)arurxmpnt1alx  i3ilsfs ra( p u0aetoxf3iatoate ueilt texmxo3iodop nmfvsls sDta(rooo0alxo i3iytfa2umnvp t)tetnmf3tadom   nvi;t0s2uo(opnu1lmtn ncs ()arur( o;o4ope  ociytfm raumpnt4aeeomo3tadla rauvi;( s2tr(o3nudop   nvi t) 2tr(mp;u1apt mi3iat mDrln s;() rxoxo3oodfmt lnvi;t0 euoimpou4lme  neils)sDtm(rono0aetnio3iltlm2um(mpn() renmo3oo1fmteanes t tetr(r ny1lptemiviasfsrtmumo;o4olxnifciytlm2rmnmsnt) ltnmf3oatom r n i t tetrxrpio4lm   neiasf Drm(root0open octysfm rmn pn()aetoir ty1faD aneil( tetoxmpnodalt lfcs sfsrua(mpot4tpen i3tlt s2rm(vsnu)tlxrxociytfa r n s;t)t2xmimpiy1lpen feils  ruau  no1tlxo fciadlm2umuvs;u0 exrmf3oodomte nvi;()s2xmir iu1llee nciasfsrtr(  ;o4altoiieilt sDumnvpn() rermrctotlateaneo t0seur(rpiu1al elfesas sDuaum ;t4tptoioeilsfa umn pn(0artnxr tytlp rau sls0setmxr nu1ame  fciat aruaxmp;u0olt io3tadfs rauvpnt4arxnmo tadoatean s s) exmim3oodoltnmnet s aruaurpou1tpxomfciat a rlu p;t)trenioctydomtrlnes;s0 2uoxrpoy1ll nlnciasfaDrm(ro;o0aex  feildla rauvpn(0alenir3oadom elu i;s0s2umxmpiodlmt lfeslt)arrrumpou4tlt iocild a ea(vo ()trtomo3ta1faD lu i (0 euoiopnu1olee fcil()aDtaumpou1oltnmfetys m2rmuvpnu0 ltrxo3to1lm e n s t) rxmir ou1amte ieslsfsDtm(  nu4tlxo i3iasfsDrl(ms;t4tleomo3tadlaD li o;()setriopiy4lpe lneta() rtr(r nu1tpx iieiatlm ua( p;t4alxnircoytfmDe u o t s2tmimpiy1ome lfcil( aDtau onu4aeto ieiltlmDra(vo t0aetoxr3oydopDe u s;t t2ur(rpnudamtnmfei ()aruaxmo;t1tltn o3iltla2uln s u0trxomr tadfat liei () 2uoirpnudome lictas)aDta(ronu1aee  ietat sDumumsnt4 etomo3iotomDranei;t)s2urxmpou4ap e nvi tfaDta(m no4tleomietldfm ulu o;t) ltniociodfmteanvs t s2xoxrpno1lmeelncia(fsruau oou1apeo f3iat m2emu p (0trermocoydomDe ieo s  rxoir oo4olt mncia(f Drm(r ;u4aptn i3ilt m2umnvpnu)trxoir3oy1omtelivs;(0teuoim oudop  mieiasfa2rmxmo;t1tptoiicildlsDuau pnu4alxrif tydfmDraueils0srum(o iudap e netat  2rmur ;t0aptn feilt aDemnvs u)tleomf3iadla  ai olt)teumim nu4optnmivt ( aDrru ooo0tltoii3ils m emn p;t) rxnif oodlpDr ieolt)sruo(o3nu4al nlfetas)aDumu pnu0olx mf3iltls2um( s u) lenmocoydlp e n ol( t2trir3nydameemnctas  rraurp;u0aexoifciat s emn p;t0tlenxo ootom  aueil()t2xr(opnudomee ncsa()arra(rpot0opxoiicias a ran on(4 ltomfciodoa e nei s)t2urxrpiudol e nctatf 2tr(moou1olxn i3iys m2emnvo;(4 rtoir3iotlpDraivsl(0 2trxo no4lpenmictlt s2raur no0aeto oeiytfs2eau p t)trxrirctotlm elivi;s)trto(o nudape mnvsls) 2tmx ont1oeenmoetltlsDum(vs (0aeenmfciadoa  au olt)trxmxm nodopte fvilt sDuaumo;t4olxoii3taslm2uau snt4 etrmo3oytfp r ieol( teto(rpiu4omee fvt s  rraumo;t0aex ioeiysfaDemumon() leoifcoadlmt aiei;s0sexm(o iy4lm  mietlt sDtrxroot0tleoifciyt m2em( onu)alxrxo3oo1latrli ols  2urxrpnudlltemnesa(f rrrxmpoo0alx iicild m ua(vs;u) lxniociotfpDe n sl(0truoio iodomtnlici s)sDurump;t4olxn oeiaslm2ea(vs;t)tlerxo3oadfmD  uvi t)sexmir oodop  mnet s)aDum( p;t0tleo fciyd sDeanvp ()trtnxo3oo1fpDeaivi s0trto(o3nydomen nct s)sDrm(mpno1texo ieilsfa umn o t0alxomr3oy1lmDraivo;s0trxmimpoudomee ivsatfaDrmxront0oex  f3iatfaDua(mp (0 eerir3oadla rauvol(  exoirpnydlpee nct tfaDurxm ou1oetoiictas m ra(vpn() exrir3iadfmteli sl(0sruoimpiu4ol n nvtl(f rumur nu4tetn feiat aDua(mpnu)tleoxocoydoaDraieo;t) euoxo3oodol nmnet s srrru  ot0tlxn oetyt aDem(mp;t4tltoio3oy1faDr ivo;(0trto(rpny1omenmietat)a2umumpou0olxn ocilslaDrmnvpnu4 rtrir tatla elieil()truoxrpny1apenmfctls  rrrurooo0olxnmicils aDumump;()texoif3oodfpt lneo;t0 rxr(m iy1oltemnct s s2tmum ot4ope ioeiltls emnvsnu)arermr ta1oa rlueil(0t2xr(o3iodlmte nct s  2umx o;t1tptn o3tyt sDel(mon(4trerif tadfpDraivsls teur(o ou1ol  lfvtltf rtm( o;t4alxomfciydfm emump t)trtomoctatomD aieo ()trtoir3no1ll elieias)sDuau pnu4tltomicils a2raumpn()tltrxfcoodfaDeaneol(0seuo(r3iy1lme lfes s sDua(r ou0apeoiieilsla2rluvo t0treoio iydopD  nes t0s2uoio iy1altnlfvs ()artrx ont0aexn oeiat mDrl(ms t)texriocoy1fmt anvo;(0s2xmir oo1ole mnetas aDtrxmo;o0tpxnio3iadfa ua(vs u)trtomrcoo1fa  au o s)t2trirpnudaptemneiatfa2ra(ronu4alxo ociyd sDrau ont4altrio3oytoate ues;(0 2xoir3iydame  ivsat  rraum ;t4apt  fcilslaDrm(von(4arxrxo ty1lp rlnvo;t sexr(mpny1om  mivilt aDta(  oo0altniietat m ulu pnu0tlerio3ia1omtr ivilt  etr(rpnudllen nei (
\ No newline at end of file
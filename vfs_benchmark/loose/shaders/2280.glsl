@@ -0,0 +1 @@
+nvo s teum(opoudope mfcil(fs2ta(  ot4aexnioetatlm2eauvs t) lermociodfmtelu il(0srxmirpou4alenlneia(fsDum(m ;u0aeenii3tadlmDrln o u4 rtrmr ty1lptr ues s) etoxr ou1ap  mnvi ()artrxr nu1tpenifciaslaDemu onu4altnxf oodfp eauvs t)setmxm3iu1lmtn nesls)arrm(monu1oetnmi3tydfsDemumpnt)trxnxfciatopD aivo (  rxoio3nydllte ivtls)s2ta(mont1tpe iieiltfm2ulu o;u) eeoifcoa1lm elneo t0t2xr(m3oo4omtemictl(fs2ra(  ot0teto fetadls umuvpnu0texniociydoa  aieilt  ruoxr3iudlpe  ivia(faDuauronu0olto f3iytlm ra(vpnt)trtomf iadla rai i s)tetr(o3nudopen nei t) Draum nt1tlx mf3iydlm2um(vs t4 rxoir todoa e ieols trto(o3iydole mictas) 2ur(mp;t4alto i3taslm rl(mpnu) leomo oodla e uvi;()srtmxopiydlmeemfcsl( s2umuro;t0tle iictlsls rlumo;t) lenxf iadlp  aivslt)t2tmxm io4ol   fctl(  Drmumooo4aptoiociasfa rl(msnu4 rtnmf3iotop eln ils)s2triopnu4amt lieils)s2rmu ooo4tlxnioetat m2el( s (4aexnxrcta1la e iei t  etr(r iy4lm e nvs t aDtaxrp;u0oex ioeiasfm uln p t)texrxr3to1oaDr i s;t0setoimpnydlpen ict t srtm(  ot4texo fetltls2rlu on(0texnir oodlpD ai slt0 2tmxo3oodap emics ( a2tm(moot4aee  ieilsfm ul(vs ()arenmo todlmDe u sls0 rxm(mpnu4amenlfcsltfsrraum ou0aexo fcildls2rlu p (4aleoxr iatoatr uei (0trtrir3oy1omenlnvsasfa2tmumoou1tex  ictldfm2uaump ()tetomf3tatfatr i s () 2toxmpoo4openlfes (fa2tau p;u4optoioeiasla emumsnu)tlxrmr3ty1lat  n s;t0s2trir3ou4open fvs s)sDrau oot1apeo ocildlaDra(vo (4texoxf3to1lpDranvolt0 ruoim oo1ape  nvt () 2uax ooo0tlt  o3tydfs el(vpnt0trtomfcto1la rlnvi s0t2xmio nudlpe lnetatfs2trxmono1tet  oetatfa2rm(mpn() lxoifcoydlatranvs t)tetmir io1al n ieils)sDtr(rp;t4tptnmfeiyd mDumuvpn(4alxoxf oodfm rauvil(0seurir3no1lm emics tfaDur(mp;t1tleomo3iyt a rlums;t0trtoifcoodop raivsl()s2xoxrpiudol  lneias)sDrrxmp;o0tltn iciytfa rln o;t4alxoir iotfm rau i s  exmxo oudlmen ietl() 2rrx pnu4oexniocildls2rl( onu)arxrxfcoydfa r nesl(0 etm(mpoy4ll nmneslt) ruaxm ;o0oex iietlt m2ulumpnt)aeermo todopt an s s0setoxrpny1op n iesatfa2rr(mo;u1alt io3ils m rl(vo t0 lxnif3oo1fm   nvi ()teurxr nodape mivi t sDtmx oou1tltnmfeilt s2rmump u4altrmrctydfm r n i t  2xmxm3ny1oltelfvi t) 2rrx pnu4aptomfcildfa emumont) eenio iotfp eauvols t2xr(o iu4op elfvilt)aDuaxrp;t0oexoifeild m rl(mo;(0tltomf oatlat  nvolt)srtmirpoudll nlnes sfartmump;u4tetoii3tasla2emuvo (0aexrir tytoaDeauvi;s0t2trxo oudlmeelnvtl(f rumu onu1olenmieiydfa rm(vsnu)altoxrcoadfm raiei s0t2xoxr3nu4om elnes ( s2tmxm ou0texoifeilslmDel(vp u) exrirciadfmD aivo;(  eurxopnydapeemivtat) 2um(mpou4oexoifetysla2ranmp (4texnmo3tadoptran s;( t2uriopnodole mnes tf 2rrxm ot4olen fctadfm rlumo;u) lxrif3oytom  ai s s0 2xm(o3iy1ameemivs tfartmx oou0tpenmo3iatfm elump;u0 ltrxf ty1fpt  uvolt  exoxr3nydol emncslsf Dumum ou1tptn i3iadfs2ra( o;(4artrmf3ootlatraueolt texmxm3iu1olt lncia(f Drrx p;u4apx  fctad m2um( o;t0aexnxo3iy1fpt aivols0srur(o3iudom emnvil()a2urxro;t1oex iietltlaDuau p u)teeoir oy1fatrai ols0 exoxr3ny4lptn iei s sDrm(rpnt4oleomieiatfsDrm(mpnt0tltoxrcoodlmt lieol()s2xmxo iu1lpe  fvi s  rum(r ;u0tpt iociltlsDrm(ms;()artrio io1optr ivo;()teuoirpno1lm n fetls srtm( o;t0tex  fciltfa umnmp;(4trermfctodopteanvi s)setrim3oo4lm   feta()aDra(roou0tpto feilsls2el(ms u0tetoxr3oydom eai o s trto(r3io4lp nmfvi ( s2trxrp;t4tlxomf3iydls2umn p u0tlenmr3tytoateln i s0seur(mpoo1apeelnvil(farrmxmp;u4olt  fcils a2elnmont)aexrxf ta1omt li s;( t2toio ny4ope  nviasfaDtmx p;o1apenifciytls2raumo u)tetomfcoytlm r i s;t trxr(opiudome lfcilsfsDtmu o;t4tpenmi3ilsfs rauvs;u)tetrxr totlptrln o ()srxrio3io1oltemnei (f 2trum oo4aleniictldfsDua(vp;u0tltoif3oatla r i s;t)tetoxm iu4op  mnei s  Dtrx p;o0oet miciad s2emnms u4 ltnif oy1faD aieo s0s2xoimpnydal emfctat)arrmur nt0olx mictad s2rluvo;u4 exniociydfa   ivi s)trumxm iy1om   fvslt  Dtaxr ;u1teenmf3ilsfa rm(msnt)teeoio3ootfatr ieolt truo(m3oy4oleemnetlsf rtrx ono0tee ifeilsfsDulu sn()tetrmf oa1op eauvi t s2xrxrpiy1amtn fetas  Dtr(ronu1olto f3ild m um(mo t) etomocoadlm  aieil( seuoio3oy4ome  fvt (  rtrxm ;u0altnio3tytfa rln p;u4arermo3iydlp   nvils sexriopoo4apeelnesls artaxrpou0ole io3tldfa ea(vont0tltrifcty1fpt liei;s0seurxm3nodapenlfcsl(f 2tm(m nt1aee iietlsfa2ranvo u0trtoxr3ootfm  auvs;s0trtrir3io4olee nviltfa2rmx onu0opx mi3tydfa2ul( s;t0 ltniociytfpt auvsls) 2um(m3iu1lm e fvia( aDtmx ooo4tpxoio3iyt s2rl( p;(4aeeoxf ootfpD lu o;()trumio oo1am  mnetls) Dtrxro;t4apt ioctas sDeaums;u0 eerxrcootfpD  u s;s0t2uo(opoydom e iciat)sDtmump;o4aleomicilsfm2um(vp u)teerio3oo1oate n o;(0seumxopnu1lp  lictatf Drrxr ou0openmictldlm rln o t) lxnmf tytfpt  u ols  rumxm3iudlmtelivtas srtm( poo0aetomfetld a uanvpnu4 lxrxf3io1lat  ivs;s t2um(r3oydap   fct s  rtrurooo1aptnmi3iasfs ulu sn()trerxo3iatlm  lnvs s t2tr(mpiu4apt lfvi s)sDua(rpnu4tpxnii3ilsfs2raump;u4aeenmrciydoptrliei t)t2xoio iydlme miciatfsDtmxro;t4alxn oetysfm um(ms;u0 lxnxrciodlaDraneo;t teumirpno4ale lfesls) Dua( p;t0oeeomfciadls rm( onu4 rtnif tatoatraieo;( srto(m3oudlpee nciatfsrtr(mo;o4opx  f3ias s ul( on(0alxnxf3oodlaDe n ilt0texrim oudamte ictlt)arrrumpou4apeoioeiatfa2emums;u0 renxr3ootomDrlueilt)s2uoio3oydlltemfctat)s2um(rpno4aeen f3ildfs2um(vp t0 rtoir3ta1lpDelu i;( s2xoxopnodom   fcsas) Dtrxm nt1oetoifetlt s2rl(msnt4tetnifciadoa rauvil(  eum(m ny1ll e ivs tfa2rmxm ;u4apx mociysfa uanmo ()texoir todom  ai il()srtrxr oo4ap e nvta() 2tmxrooo1tpxo feiytfs el(vp (4teermr3iatla rlieilt)sexr(r3oo1lm n ncta(  2rrxrp;t4alenifctydlmDuanvs;t0 exrxr3oodoa r ues;(0 2toxr iy4ale  nei () rraxmpno4openmf3tydls2emuvo t0 renir3oydfat au s (0 2uoir3iy1lltemncs t srumxro;u4oeto feiltfmDel(vonu0tleoxfcty1lp eaivol(  etrxopoy1om  mfcil() rum( poo1tpeo fciys mDelump u4alxomr3tydoa ran sl(0trxo(m io1lpe  fvil() 2urum nu1optoioetlslsDean o t4arenmo todla e uvs;t0 etmio oodopeemfvslt s2tm(mo;u0altoiieiytlaDuanmp;()tlxrir3iy1lp  lu o;(0 rxrimpoodaptemfvtl(farurxmo;t0apenmfetls a2eln p t0teeomr3iydlm elneo t) rxr(mpoo1lpt mneiatfsDrm(rp;o4altniieiatfm el(vsnt0 lerir ia1faDeanvsl(0 2to(m iodlm  lictlsfa2raxm ;o0oeeoiietltls2ua( sn(4 ltrxr3tadfmD aues (0 exmxmpoo4lptn netl(  rraxrpnt0tlt iieiyd aDuau s t)tltrir3tadfm  an o;t t2toir3oudlltnlicsasfa2ur(rp;u0oex iieild mDuanms;(0 ltoir ia1fptr i ilt)seto(o no4ll  livta() rraur ot1tetoiiciltlm2uan sn(0 exnmrctydlatraieil(0 2urirpoodop   fctlsfs2uax  nt4olxo fciltla em(vs;(0tetomoctatfptraueol( t2um(m ny1ap  mneta(f 2ur(ro;u1teeomociadfs umumo (0 ltnmrctadlaDe uvils0 eurxm iydop e fvils  2rrumpot1oeeomieilsla ranms;u0trtomfcty1op e n s;(  rumxr nudll   ivsas aDtau oou4olxnioetydfm umu o;t) lenxoctadlm  aivi t0t2umxm3iy1am nlicia() rtaur ;u1tle mfciadfmDemuvp u4 lxrxr iotfmt aueol() rxo(r iy4lp e ivs ()sDtru o;u4alxnif3iysls2ea(vo t) renir3oatlateauei ( s2toio3iu4aptelfcs (f Dtax  ;t0oltnifcils aDemuvo u4trenxo oadlaDraueols truoxm3nydll  mnctl( a2rauro;t4aex  o3iyd a2rmnvsn(4arxnxo3ty1lp  lieols0s2tm(m no1apt  fetat)a2tax p;t4aleoiiciat m2uau p (0 ltoxr tatfpD  nei s seuo(o iy1omtn icsls s2rmuro;o0optomociytfa ul( o t0tltoxo iatfm  liei s0t2trirpoy1ll  mncsas aDuau ono0tlxn o3ild s2raumon()texrif oy1laDe ueils)srumiopoodll n netas arumur ou4tleomoeiltfm2rmnmo t4texomr totop   u o ()seum(o iydlpeemnetasfartmx onu0altnmo3tls a eau p t)tetrxfctodfpDeai ilt0srtoxo3nudlle mnvs (f rtrx pou1ole iocils s eauvp;()tltrio3oy1fpteluvo s0 2tm(mpoy1ap   ivs s a2raumpoo1tltn o3ils a emn s;() eenxf iytfm e nvi t  ruo(o oodalenmiet tfs2rrur ot1aetnioeiydfaDul(vs;() etnmrciatfm rlies t0trtoxm iodamtelncils aDtau poo1tpto ociyt m2rluvo u) reoiocta1fpDelu s;s srxmirpnu4omtnlneia() 2rm(rpou1teeo ociadfa2rau s () reoxf3oy1omt an i t)tetrxr3nodom nlfet t  Drrumont0oetoif3iytfs uan o u0trtoif3tadfp   ies;(0 exoir3oudapenmfvtlsf rurxr nt1open f3iydlmDra( pnt0artoif to1oaDr ieilt0srxoim3iu4lp elicsas) 2tmxro;o1opxnmicildfmDea(vpn(4tetrxo oatla   uvo;(0t2toirpnu4lleemiei s aDum(r ;t0tpxomociat m rm( ont) lerxr3to1fmD  ivslt)srurim iudlme mivia(f Dur( pnu1olenifetat s rl(ms u4arxnxocoatlaD auvols0setrxr iydamee ivtlt) 2uau o;u1olxo oeiaslmDumn snu) rxrxr3io1om rlies s0truoim3nodapt lnvs t) rtax pot1tet  oetasfaDeluvo;u0aetoxociy1fatean i;s)s2xrxm ou1altemicil()sDraumo;u1tpxo ietydfaDra(vo u4trenmrciydlpDr ueo s0 2xo(opnudal e ivsat)s2trx  ot1tpeomf3tat m2ranvs;t4treomrctydomte nvo;s) 2uoxmpiudolte fcil(fsDtmu oou0opeomo3iat s rl(vp (0aetrifctydlatr ieols)teumxm oo1op nlnvta() 2rmxm no4oeenio3tyd s uanvsnu0 reomo ia1fat au o;t  rxo(m oudll  mfcilt s2raxroou1tltnmieiasls2rluvpnu4 rtnmfcootoaD li o t) eumir ny1lm elnetl()aDtrxm nu1olxn feild aDeau pn(0arxoif3tatopDranvo;t) rxo(m io4om nmnci (f rtaxr nu0olx ifetydlmDeluvs (0artrifcty1lpD auvi;s srxrim3nudoleelnvsa()srtmumoou0opeoiociyd m ulnvsn(4artnxr3oodopt  ues;s) rxrxr3iu4amen neta(  rra(mpno0tlt iiciyd a emuvp;(4alxoifcoytfat li s s0sexoxo io4ap  livslsfs2rrump;u1tpxnifctls sDuanmont0 eenxf iy1fp rlnei s0setmxo3oydoltelfvslt)srurum no0aeenioetysfm rmu s;t) eerxr oy1fpDe nvol()setrimpoodamtnmiciat  2urxrpnt0tpxomfctat aDeanms;u) exrxr3oydfm ran ol() 2tr(m3nodlptemfciat  rtmu  ot0aee iiciydfsDeaumpn(0teeoxrctytfmDeaivs t)tetoxo3nudamenmieia( artm(rp;o0alxo o3iat aDum(vsn() ltriociy1opD livil( srxo(rpio1apt mnvslsfaruau pno4tpenmo3ias s2eanvp;t)tlenmf iy1fptrluvo;t)trumim nu1olte fviat  rrrx  ;o4olx mietld a rmu snu)aexrxociodfatrlnei;s0t2xm(rpoo1ol   fcsls a2umxmono0optomfcilsfm emuvo;u0 exomrcootlaD  i i;t)setmim3iu4apee fesls a2trxm ;u4tltoio3tldla eanmpn(0artoxo3tadopD luvi;(0t2tmxm3oo1llt lfeiat  Dra(moou1tet ioeiyd s2rmums;u) rerxo3todfpt  ieol( t2xm(m io1ol  livtltf rur(root4tpto f3tldla eaums;t) rtoir3tytlpDrau s;()truoxo oy4om  lfetlsfsrumx  oo0ale mi3tas a emu o;t0 rtniocty1fpDr i s;t)trxmir ny4ap n feilt)sDumump;t4tlenif3tyt a ul(ms;u)aleniocoodopD lnes s0s2umimpny4ale lfvi tfsDtrxmp;o1alxo ocilsfmDumu p (4 etnmr3io1lpD  i o s0s2xm(m iodll elfvt t  rtmu  ;o0tet mi3iyt a2rmumo;()tltnio3iytomt  ivs s0 eur(m oo1omtelfeta( s2urxmpno1oeenmo3tasfmDemnms () etomr3totfpDeaies;s0seuoim oodoptemneta()sDtrx onu1ape mfciyt aDuln o () lxoircoadlmt aiei;(  rumxmpoodlpeelfvtls  rrrxrp;t1tleoiicilsfs elu p;()aexomfcia1opteau o ()texmim oo1om elnei s sDra(ront0tlen ieiysfa2ra(vp u0aeeomf3tadlmD  nvo;(0srxmxmpnu4ll nlfei tfa2taum ;t4aex mfciasls rmuvpn(0 etnio3ootop raivolt)sexrxrpoy1om nmneiat)a2taxrpoo4open f3iysfm2uan ont4 rxrmr oadlat lnvols)t2urio oy1am n nviat  Dtr(  ou1ope  ieiys m2elnvp;(0arxomo oytfp r uvs t0srum(mpiy1apenlncsas  rrr(m ou4opxomictat a2rm(mo;(4tltoxo3oo1op rauvo;t teumirpoo4lp n nvs t)sDrrur ;o0aetnmfctat m2rauvo;t4arxrmr3iotlaD aieol() 2uo(mpiodope  iet tfsrtaumont4ole mi3iyd mDra(msnt0 rtnxociytlmD li o () euoio3iy1lmenmfvta()artr(m nt4tetnii3tytla2emuvs ()trtnircto1lpt lu sls0seuoim3oudope  fvi ( sruru pnt0tetnii3tytlsDumn on(4 rerxr oatlaD aues t) rxm(o iy4alt lnvtas artau  oo0aexnio3tat a2ul( s t) etrmociotomtrau o t0sruoxm oudlpe lnct t arurxmo;o4tex mietls a2emnmon() lxrxo oatlaDrai i t0srtrimpoodllte ncs ( sDrr(r ;u1alx mf3ilt sDelnvo;(4aetrmf ta1lm  lueils)t2urxm3iodapenmiesl(  rrru  no1tpxo f3iaslm emu o t0treriocta1om rai o;(0t2xmim3iodole  icilt)s2rrx o;t1tpenmf3iatlm2rmumsnt) lenmo3iotlp rli o s truo(r3oydlltnmnvs ()srtmurono0oet if3ilt m ranvp;t0alermf3iydla elivo s  rxm(mpny1lltnmnvslt)aDtmu o;t0opx mo3iyd mDeanvo;u4trxoiociadlpDrlueo t0tetr(m iodamee fcs ( arrax ont4teeoif3tydlaDranms;u0aexnmrctodlp elieo;s)s2xmir nudamtn nesltf 2uau poo0oetoif3iydfs2um(vpnt0arenmfctydop eauvi t0 2urir3oy4op nlfvtat a2uaump;o0tptn oeiys m2eauvp (4texnxf3ia1fpte nvi s  rurimpoo4alt mfeiat) 2urur ou4tltnmfeilt a ra(vo (4 etrxo3oy1oatr ivs (0srtr(o3ou1lmtemnvs s)sDta(rono4oee io3tysla2eau o u) exnmf oytfaDeli s;s teum(r io1ale lfei t s2umxm ot4teeo ieiasfm uan p;(0altoir3oa1lmtr n s ()setrir3io4am emfcslt artax ont4tleomfetlsls ulu s t4altoiocoa1lptr n s ( s2tm(o3iy1omeemnvsl( aDtaxroou4alx iictatfsDeanvsnt) exnxr ia1fptrlnes s0t2xoxm3no1amenmicsltfsrrau pot1tlxoioctlsfm um( p (4tltomr tydlm e nvol()t2xoxo iodllt mfcsa() ruaxr no4apxniiciadfa ranmsn(4trtnio3oodlptrluvi t s2uoiopio1lmtelivsa(fsrtmx pou1olen f3iatfaDranvo t)trxoxr3tytlptrlneo;s0 rtmxm3oy1ape lieiat)a2umxmooo4oex iictysfs2emump;(4teenif3tatfm r u sls0t2xmxo3ou1lle lictls)aDtaxroot0tee ioeils a rm(vont0 eeoxocoatfp ran slt t2tmxmpnydam elfes t) 2tm(r ;u4tltniieiasfs2elu s t0 renxo3ta1oat livi () rtoim iydamt  ici ()arrrumo;t1oex io3iysfa ua(msn(0 leoxo to1fptr n i;t  etrxmpny4lmeelnetlt  Dumxrpnt1opeomociat sDua( s;t) exnif tatfmtr nvo ()truoxo3oo1lm   fvtlt srtax p;u4apx ii3iytlm ulu o u0artrif oytomDeluvi t seuoim ou1om elfvsatf 2uax  ou1tlx ifciasfm ran p u0aexrxrcoa1lp eaueo t)s2xr(r iu4olt mfet (fa2raxmpoo4oexo f3iysls eluvp;u) renmo3oydoatr i ilt trxm(o nodlm nlncilt) rtr(  ;u0teeoiictasfm2emuvo;u) ltrmo tydlaDe uesls0srxmxopiydole lnetlsf 2rr(m nt0opx  f3ils aDeau pn(0alxnmf3oatfp  lues ()srtrim no1llenmnvsasfa2ra(  no0altn i3ils mDel( s t0alenxo ia1lpD anei ()s2xrir3oo1apen nct ()sDumur ou4tetoiiciytlaDeanvs t) rerxo iy1la rau o;s0 2tmxm3iu1lmte nctas)s2ur(  ;u4tptnmoeiytlm uanmsnu0aexnxociydlmte nei;(0s2xo(m3iu1am nlivt t)srrmumoot4tpto feiysls rmuvo t)arerir tatla  aiesls srtrxm io4ameemfviat)aDtmx  ;u1aleoifeiydfa em(mo;(4 etoir iatom  lu i;t  2ur(opoo1lme mneslt sDua( ono1aet iietat mDra(mp u0trerir3ootlat li i;t  2xr(o iudop emfcta() 2ur(  oo1oetomf3iadfa2emnvs;(4trermr3ootfaDrlivi t) ruoxmpoo4amt lfvil(fa2uau ooo1aexnmieias a2eln p (0artrir ootlmD  iei;s0t2xoxm3iodamee fvt ()aDta(  ;o4ape miciatfs eauvs (0trtrif3iatfa eaueilt) eurxmpnu1am nlfvslsf Dtrxmp;o4tlxoioetysfs rm(mp u0teerxo ootlatean i;t0 2toxo3iu4aleemictatf 2tmuroou4tetoifeiyd a2rmumpnt0texnircoadlat  ieols sexmirpiy1lptn ies t) 2urum ;t1openii3tlsla2rlnvs;u4trxrmr3ta1fp rai sl()s2umxo3nudapt mnes (fartruronu4ole mo3iys a2rm( p;u0aetriocoo1la  lnvo s0 rtm(mpou4olen nvils aDumurpot0teeomoetysla2elu o;() exnircoytlpteau ils0s2uoxm iy4om nmfvs ( s2tm(r nt1tpen oeiadlsDrau p t)tleoif3ootop  lnvo;s)srumxo3nodlp e fetlt) rrm(m ;o1alxoiocilt m umuvpnu) rxrircty1lm ran s s  2to(o nydlm  lfvt () 2uaxmoou0optnmi3tltfs umumpnt0tlxnxr3tatfptelu s;s0srto(r3iudlm emietasfsruauroou4ope  fciatfsDrmump;t) exomf tytomt  nvo;t) rur(rpoo1llt mfcta(  2raxronu1aeenifctls s2el( ont4tleomfctydom   ivi t0t2trimpnu1lle lfvs tfsrrrxrono1opeomfcildfm umu o;u4arerxf ta1fpteluvs;t0t2trxo3iydlpe  ietltf rtr(moot0tleomiciyt m rmuvs () eeomo3iotlpDeaieolt0 rtr(r3nydll n nesasfarrrxrp;o0tlx ifciad m rau o;u4artnmo ty1lmD anes t srxrio iu1opee neiat) 2uax ooo0openio3iydfs ea( o t) lxnif3oa1fmtr nei t0 2um(opno4alt lneiltfs2rr(r nt0alen oeild a2elu p (0 etnifcoo1lptr ieilt)t2xo(o iudlpte ics tfaDtrxmoot4tlxnifeias sDemnvo;t) eeoxf3io1omtrlnvslt) rurir3iu1amtnlfesls s2uaum oo4alxoif3iadfm2elnvs ()alxnxocta1fat  nvi s  2tr(r3no1apen fvs s sDuax o;t1alx  f3tyd mDrmn pn(4aetnmo3ta1lmtran s (  rxoimpnodolt  fvsl(faDururpoo0oexomieiydlm2eauvs u) eermo oy1lp ean o;s0sexo(o3ny1amt mict sfsDrau p;t0tlxo i3iat a2uan p t)tetoircoydopteaneo (0 2xm(m nydoltnlnetlt)a2raumpou4apxn i3ils s2eaump;u)trenio3oodlm elueil(  rxr(rpnodol nlnvil()artr(mpnu1oetniicilt a2ulnvpn()arxrmr oatfaDrluvo;s0s2tmir3ou1ll  livtl()a2ua(mpot1tlt ioeils s2rmnvp;u4arxomf io1fp eanvi t)teuoirpoo1am   ivtl(fsruaxm ;o4tpx iictas m2ulnmpnu) exrmf ta1oaDr nesl( seumir3no1olt mncil(f Dumx pnu1aet  oetlt mDuluvp u4aetnmf ia1fatr i i t) exo(o3iu4ol nlicsls  rrrxrp;t0apxnmo3iat aDrauvpnt4altrxf3oa1oa r nei ()trxoxm oudopt  nvsas)sDum(m no4olt ioctasfm2ulump;t4artnir3oodoa e nes t tetr(o iy1om  lfet s)a2rrxmoou1tex iieilsfa um(von()aeermf tatlaDrau i t s2tmir3nu4optnlfcias) 2ua(m nt1tpe  octadfsDemnvo;(4 ltrif oo1fatr ieolt)s2xmxm3oy1op e fvsat  Dtmur ;o4ale  o3iltfa uau snt4aeeoxo3ta1lpDrli i () 2tm(m3nudoptn ietas  2tauronu0tlxo fctltfm rmnvs u4 eerif3oa1lmD auesls setmxo3iu4oleemfesl() Draxmont4oexnmi3ils aDranvs;u) eerxfciadfmt  nesl() rumxmpiy1lme mnvils s2umuroou1tlx if3iad mDuau p;u4tltrmrciodoa raiei ( t2um(mpny4llenmncs t  Durxronu1apeoiieilt mDul( p u4 etrio3tatfaD  uvo s0 2uoxr3io1lleelnci tf ruaurono0teenioeilt aDem( o;(0 exrifcoatlpte ieolt) 2urxmpny4lm e nvi s s2taur ;t0tlt iicilsfa elnvs u4 renir3ootla raueo;( sexmxo3ny1ap e ieias) Dtm( p;o4apxoiociatfm2rauvs;t4trtnxo3oydfm eaivi;()setrxo oydlmtnmnctat s2ua( p;o1oltn i3ilsfs2ea( o;t)texoifcoy1fmD ai i;s0 exm(o3no1optelietl( s2uaur nt0tpenmoctld m2um(vp;t4aeeoxfcty1lmtr nvs (0trxrio no4ol emfei ()artmxmp;o1oltnifcilslm2ua(vo;t4 lerxfciodla ran i t0teuoir3oy4ol elnctl(f Draxmono0tpt  i3ils aDeln o (4artnxociadfaD aueo;(0 etmimpou1lpeemfcia( aDum(mpot4alxoio3iyslmDul( p;u4aexomo io1lm rau o s)seuoxm iu4omtn fctls  Duaump;u1tpe iociasfm ran pn()tetrxrcoadlm  lu i () 2ur(r iydam emfvs t  Dururpnt4opt moctydls2emu s;()tetomocio1latr u s (  eur(o3nu4op  micsl() Dtmx pnt1tet micild s el(vpnt0 ltrxf3oo1omt  ivslt0srumim no1lme mfvia() 2rmumo;o1texn ictldfs emnmpnu0tlxrio3tytfmD auesl( t2um(opiodal elfctl( a2rm(mooo1altnifetlt sDulnvo t0artnmo iytfatrauvs t s2xr(m3iydapee ivias s2uaxmpnu1apx mo3ildfs2ul(vpnu4 lxnircoatfat ln o;t  2tm(m3oy1ol nmnviltfa2tr(m no0tlt iociysfmDum(vo;u0tlxnir3oodop  li i () rto(opnu4opeelicsls a2ta(m nt4tex mfeilt a2rl(msnt4arerxo oydfpD  nes;t trto(rpno4olt  fetat  rumum ;u0tpeomfctatlmDrmn on(0arxomfctotfpt auvils)s2umxo oy1om nmfviat)srraxm no0tpxo o3iysls2eanvo;()alxrircoadomte ivs;t  rurxr3oy1lm nlncs t  Drmx  oo1tpeoiietadfsDemn p t4tetrxr3oodfa  au sls) eur(mpoy1lmenlfvilt)aDrrum ;t4oex  ictatfmDul( s;u)artrxf totlate uvs t t2xrir nodomtelietat artmxmoou0tpx ii3ilsfm2ran on()arenmrcto1lmtr nvi;s) ruo(r oy1ole lnesa(f Dumurpot0tetoiieiltlm rm( s;(4 ltrxr oatlpD au o s)t2xoim ny4amtemfcsa()s2tmx pnu4aexomieiyt aDel( s u4alenif3tatfm e i s;t0t2ur(o oo1lpe  ici (faDuru pno0aptoiieiatla umuvo;u)tlxrmocoadlpDeluvolt0seto(o oy1am nlfei s) rur(root4tee  feilslm eln pn(4arenmf iy1opDr i ilt0tetmimpio1amen fcsl( aDtrumoou4tpeoifetadlm2elnvp;() rxoioctadom rli olt)texmir3nydlmt mfvta(  Durum nu4olto f3iadlm2eln s t)teenxfcto1fp elies s)trtoio ny4ole  nes sf 2umu oou0opxoifciydlsDulu p ()alerio3oadfm e ivs t)srumio3ou1amtn feils)a2ta(mpot1alxn ocilsfs uanvp;u0arxoirctydomte i i;()s2toxo3ny4ap nmnvs (fs2umuro;o0aeto feildla2um(vp t4 lxnxf oadopD  n il()t2xo(mpoy4omee fctls  rtr( pnu1olxnioctatfm2eauvs;t)altnxf3tydfptraivo t)trur(m3oy1olte fvsls)sruru  ou4oetn o3iysfaDra(mp;t)artnmo iatfa r n o;s  2trxr iu1omtelictlsfa2rrx ont1tlxomfciadlmDemn p u4 eeoio3io1lat lueo;s)trumxo3iu1ol  mfvtlt)s2rmx ono4aee mieiyd a2eanmont) exnifcoadlm rlnvil( tetoir iy1al e netat) 2umx  ;o0oltomiciltlmDean pnu)aeeoif oadfp elivslt  2uoxrpnudlp n iesl(fsDtrx oot4aexomietydfs ul( o;u)trxrxr3oodomtrlnes ()trumimpou1al  miei t) Draxmo;t1oltn ieias s uan p ()areoir oytomDr n il( truoxmpno1llt licta(farra(ro;o0oeen i3iasfmDuln p;t) rxrxf tydfmtraivil( srtmxmpoo1omtnmnvias sDtax ooo4apeoioeiydfaDea(monu0tlxnmf iy1fp rauei;( t2umim3oudape micslsfartau poo0alto icilsfa2uaumonu) rerxf3oatfat au i s)seurimpiu1apen nesas)sDuaumooo0aex  ocils s rmu o;t)altoxo3oodomtrlueo;s)trtoir3oy1al e ici (  Dtaxrpnu0apt io3iytfmDumu o u)alerxr3oy1om  anvi t0t2trxr iudamt  fet s s2uau oot4aet ii3tlslaDumuvp;t)tlxomo tytom  au il(0srtrio iy1alt  netl(  Dtaump;u0oee mi3ilsfsDrm( s;u4trtniocto1fmDrau slt)s2uo(r no1am n nvi t  ruaxrpnu4altomfeiatlm2rl(mont4 ltnir iydoa   i o t0s2tmim oy4al  lfvta( s2trxmo;u0tetnifciyt a uauvo;(0 exrifcoo1fa e ieslt0s2urxopio1altelncs s sDua(mpoo0aexnii3iys a2ulump;() rermf3io1opD luvs t0trxrir3iu4lpt  iviat sDrmxrp;u1oee  i3iltfs eanvp;u4tlxnxf oatopDeanvs s  rurio3iu1ol nlfvsatf Dua(  ;u1oee  i3iadlsDuln ont4 eeomf oadopD aivi (0trurxopnu1ll e fcilsf 2tr( o;o0alenifetydlaDea( s;t0 eerxociatopDran ils trtoxrpio4amen nctas sDumxro;t4tpenif3tldlaDul(vo;u0alxrmrctatoptranvilt) eumir3iu4omt mfcsas) 2raurp;o4tpeomf3tlt a2eluvs;u)tlxnxr oa1oa   i i s s2xrxrpnodlmee net sfsDrru p;t4apxnmi3iys sDrau p (0tlenmrctadlp r i sls) euo(rpny1opte nes ( sDrr(mono0oexnmictytfmDumu o () ltrmr3oy1fa  anvol(0 exrim3oodole  ictls)s2urx ono1ole mf3iysfa2ea( snt0 exrifctodfaD  ivols)seurim3oudopenmies t)sDrruro;t4opx  fetltlm2ul(mo () lxnir iytom  luei;s  2xrxr io4am e fcil(fs2trum ot0tpen i3iydlm emnmo;u)trxrio3oodoa  au sls0 2tmir oudom e iei () Dur(mpot4oex io3iydfa umn ont4 exrir iotom  li sls) eum(o no1lp elnvsatf Duaxm ;u0aeen o3ild sDrln s;(4artrxr3tytlpte nvo;(0srumiopoydlp nlnvsls aDrmxr nu4olenmf3iytlmDuanmo;t0tltomo3io1op rli o () eurxopnudlmenlietls  2tr(  nt4aptoifeiytlaDumumsnt) lxrir3tytfmtrln o s)s2xrim no1om e ies () 2ur( pnu1aex mictld a2uau p;()altrif io1fpt auvilt0trtm(m oo1aptnmicia()srururpnt1texoioetysfmDrl(vp t)aetrio3ootfaD  u olt  euriopoydlleelfvt ()srtmxmpoo0tpxomf3tytlmDemnvs;t)altnif tadlm r ueo;t0sexrio ou4olte ici ()arumxroou1tex micilslsDrmump;(0treriocoatop rlivi;s) rtoxr ou4omte fvi ( sDum(mpnu4olenmo3tatfa2uanmp t0alxnif3tytlat  nvi;(0texr(rpiudopteliet tf rtm( p;u4olxnioeiatls2rm( snt)arxnmo3oytomtr n o s) 2tr(r3nu1am  mncia()s2ta(r no1tpeomo3iyt m ul(ms t4artomfcta1lmD au i;t0 etm(m oy1ameemneil(faDra( ont0oleoifciytfm umumpnu4 etoir iadom  lu i s0 2uoxm iodame mivia(  rrr(rpno4tetn fcildfa2umn snt4arerir3iydop ranvolt  2um(o3no1ll nmies t aDtaump;u1oltoii3iadlm umn o (0alxriocta1lmDraivs t truoir3ny1op  mivtlt)sDtmur ou4olenmo3iadfsDranvonu0 lxoxr3iotfa   i s ()t2to(m iodolt lnvta()srtmxro;o1apeomfetas m rmnmonu0artnifcoodoa rauvil() euo(r ou4om  mfei sfsDumumpnu0tpt ifciytla2em(vo t4areoxrciydlp ranvs;t0 2uoxo3iudll n fvs sfsDrmurp;t1oeen oetldfs2ua( p;(4arenmo3todlaDeaivils0trtoxr no1olt mfesls  rum( p;u4opx ioctlsls2rm(mo;() etnio iatfaDraivi;t  2tmxo3oo4op nmnci t)a2tmumpnu0apt  fciysls2ua(mp u)alxomfcoadlptr i s t)s2uoiopoo1am emivsasf ruru  ou1aeeo f3ild m2uaumo (4 etoxo iydfa elu slt)seuoxo3no4ame  fesas aDua(ro;o0tle  feilt s2uan snu4 rtrxo tytfate u i t) rtoxr no1lm nlfctat s2rr(moou0ale  ociadfs ulu p;t0trermr iytlmD lneo t0sexm(opou1ll elneil( a2umu  nt4aeeomociytls eaumon(4trtomr3todla eli il(  rxmxm iu4llt lncs s sDur(r ou4opxniictytlaDulnms;(4trtnxr3ta1fp eluvilt0 ruo(mpnu4op   fcia()srrrurpnt1texoiociatlaDrl(vp;u0 rtnxf3tadfmD  i s;s) rtm(o iudlltnlnvsl( s2urx p;t1alenmo3tatla ul(mo u)alxnmo3ty1oaD lu o;t0 2urimpio1lle lfcsa()sDrr(roou4ale mictatfa rmnvsnu)arxnif3oytfm  aieo;()trtmim3iudale mfviltfsDrau ooo4teto f3iys m2rlu s () ltrxo3oytlat  n s;(  2uo(mpoudlle  fvs t)aDtm(mp;t1olt ioeiyd mDemn p (4trtrxrcoa1faDrli ilt0trxrirpoo1lp n nvs (f Dtr(mo;t4oetoii3iltfs emnmon(0 renmo ootlpDr u ol(0 2urxo ny4om elnviasfarrrumo;u0oltomi3tadfs2um( o ()artoxociydlmtr n s s  etr(m3no4altnmfetas)arrauroot1aetn ociysls ean p u0areoiocoy1omt luvolt)teurxm3iy4lleemneta( aDurump;t1tpx iiciydfa rl( pn(0teermo tytlpDeaivo ( truoir ny1amtemnct ()artaumont4opeomfetysfa2rm(vsn(0tleoif3oytfpteanvol()trtmxrpiy4lmenmfet s)srra(mpoo1olenmoeiysfa elump;t)altrif ia1fmDrlivols)srurxo ou1opte iciat  2ra(ro;t1tltniieild m2elnvs;(4 rtrmo3iotomDr n ols0 exrxm io4ale lict sfs2tr(r oo4aet  fciatls2el( snt4trtrioctodoateai s (0 rto(r oydlltnlnctasf Drmu o;u0olt  i3tatlsDuluvo (0areomf3oatomtran o;t truoiopoo4ome miet sf 2rr(mpot4opto fciysfaDuln s (0tetoio iytoatrau slt)s2xm(opio1omt liet s)sDtauro;t0opxomieiltfs uluvon(4arxnmociy1oatranvi;( s2urxm3iy1lp eliei tfaDrru onu4aleomicilslsDemuvo u)tlxoif3oo1laDelueo s)s2umxrpoy4ol elivs ( srtmxrpnt0tetnmi3tys a ua(vo;()trtnmf todlptelnvi s0 eumxm3oudol emfvsat)sDtm( o;u0tpt ifeiltlaDuanms;t)alerif3iadlateai ol(0setmio io1olenlfet t) Dtm( pou1oeeo iciyd mDemu o;t)arermfciotlatrlivsls srtmir3nodom e ivtl(fs2uaurpoo1oee  f3tas aDelnvo;u)alxoirciatfmD  i o s0sruo(opnodapt lfvta()srtm(moou4opx mfeiys a em(vs;t) eeoxociadomDe ueslt)t2uo(mpoo4ame  fvslt artm( oou4alt mieiadls elu s t)trtrmfcoytlpDr u s t  exrxrpnu1lptnmiciasfaDrru o;t1apeoifeiydls el(msnu)trtnxo tatoat anvo;(0 ruo(o3no4apeelfet t) rrrxmo;o1aee mf3iyt m ea(vont4 ltomf3iy1fm e ieil()trtr(opoy1altnmnesl() Dtaxmo;o4alt mf3tldla2ulu snu4aexrxf tatopDe uvsls)srxoim3oydop  mfvsas aDra(root4oex iiciadlsDran pnu) exrxo tydlmte neslt0srurio3ou4alee ncil( arrauro;u1aeenio3tas m uau pn(4arerxrcoatomt lu s s  exrxo iodlmeemfes tf rtrx  ou0opx mfeildfsDum(vp;u) rtoxf oo1fpte nes;t0texoir ny1olte fcslsfa2raum ;t4apx mo3tlsfm rlumpnu4 eerir3tytfm elieslt sruo(r3ou1lmeelnvtls s2rrx  oo0tpxomiciytfa2uanmsn()trtomo ty1lmtr uvs;s  etmxmpoudapee fvias)sDrr(rp;o4opx mi3iltlm2ean o;u0 exoircty1lmD aieo;(0 etr(m no1op elnvsatf Dra( oot0oex iiciydlmDean snt)trtnif3oatla r nvs;() eumimpoy4opte nvia() 2taxrp;t4aet mictatlmDrau snt4artnmr tadomtelivo;s s2xrxmpny1lmt lfvtlt)sDrmu oot4tpx micild s uauvo t0arxnmr iy1fpDeanvi;t tetoim no4lp nlfctls aDumxro;o1ape  i3iad mDrm(mont)aleoxo oadfateli s;(0t2ur(r iu1apeelnvs (fa2rm(mpou4aee  i3ilsla2rmuvp u0texrio iadlptraneo;s)t2uoxm3iu4openlics (f rrmuroou1apxomoeiasls rl(mp;(0aetniociodlpDr nvi (0trtoxr3oodomenlfvt ()a2rrxrpoo4opxo f3ilt a emuvo;u4texrif tytfp r i ols) eto(o3nudlp  mnct t) rtru pot4oee ioeiyt m2rl(mo;u) ltnxf3iydfa e ivi;s0srtriopnodal  liesl() 2rrumont1apt  ieiyslm um( s ()artrir3iadfmDeauvi t seum(opoy1ap nlivil(fsrrmx  no4opx  feiyt m elnmpnu)tlxnxf tadfmtr ueils)trumxm3oudlmtn ivsl(  Drrx onu0opx  o3tadlm2rlnmsn()arermfcoadlpDelieolt0 exm(m io1am nmfcil(f rtaur ;t0aeeo oetyslmDum(mp ()altnif3to1fm rluvo t)t2xrxopio4altnmfviltfarrmu o;u1oet mfetatla2eaums u4 lenmf3totla rai o t srxrxopnodlpt lics t) rurx  ;t4oexomoeiyt a em(msn()tltomf3tatlat  i o ()sexmim3iu1apte ieiasfa2ta(r ot0tlxo oetysfs2ea(vo (4tlermoctydlpD  iei s) rumirpou1ale  ieilsfa2tm(mo;u0alt mo3tatfs2ra( s t)tlxrxocoytla e ues t sexm(o oodom  mnvsas s2rrx  no0tet moeiydlsDeanvs u0 etrxf3todla ranvol()seurir no1ale  ivilt arua(mo;u1alx iiciytla2ul(mpn(0trxnxr3iotomDrliei;(0 eurxm iy4lm n nctat)srtru ont4alto oeiad s rlumo ()altoxo to1laD an i t0tetm(r3oo4alte fcil() Drrxronu0olxn fcias aDrlumsn(0 etnxrctatfat li slt)s2xr(mpnu1lpenmnvilt)aDrrxm ot1opxn octltla2el( p (0 lerir ty1lmDrliei;t0 2urir3ou4ll nlfcs ( a2uaxmonu1aeeomociadlm2eln pnt4 renmr3oy1fptr i i;( tetmxm iu1ale lnvs t) 2trx  no0olxnmieiys sDumu o;()aetnxr3oo1faDeluvo s trtmiopnudlmtnlnvt s  2tmurpnu1aetn feiys m ul(vp;(4aetnif ia1op r uvs;s0t2xo(m no1lmeemfesa( aDrr(roou4apto fctld mDel(mo t0 eermrcoa1om eau s s trxm(r3iodamtemnvias s2umu o;t0tpt mociasfa ra( pn(0 lxrifcta1om ran i;(0 rum(o3io1lp n fesl(  2ra( ooo1oee  ocilsfmDul( snu)altrmr oytlmt  i s;t trum(opnodoleemnvsat)aDuru  no1aeenmi3iysfsDra( s u0alenxf3oy1fatelnes;()srtoxrpiu1ap elfeia() 2rrxr oo1tpe mo3tldfmDrln p u)artnifcoodomD li o;()srxr(r3ny1lmtnlivi s) Durxm ;t1oeto f3tatfm2ra(vp;(0 leoifctytomtran i;s)teurimpnudaptn iesltf Dur(m ;u0tetnmocilslsDeanvo u4trermrcoydfaD aies t trto(mpiydal n ivta(f ruaumonu1aet iietatfs2rmnvs;t4teeomf oo1fa rliei t) etoxo no1op elfesas  rtmxr ;o1aptn ieildfmDra( snu0tetnmf3oytoa r ivi;t) rtmxm io4lmt mnet t sDtrum ou1teenmoeilsls ran o (0 eerirciydfateau i t0tetmxm oy1ome mfei (fa2urxmpot1olen fetldlm um(mp;u) rtrxr3iytlpDelnvi ( srxoim nydop n ictlt) rraxm oo4tpto oeiydlmDrmuvsn(0texrif3ootlaD  i i;t0sexmxr3oo4openlnvtl( arrmxrpnt0apxn feilsls2rlums;(0 lxrmo3iy1opDrli o t trxr(mpoudll   ncta(fsDua(mont4tlxo fctyt a2el(mo u)altoxociotoptelueil(  rtrxr nudopt livs (f Dra(rpou4tee iiciltfm2emnvp (4arxnmoctadlmDe nvo t tetoxo3iu1lmtemfci tfs2umxm ou0aeto ociysla2rmnvonu)trxrmo3tadla   nvo s0trxmio iy1omtemies s)aruru  oo0oee mociatlm rl(vp;t0 etomo oy1lat lueo;()tetm(r3iy4omt  ncslt) 2rau  no0oex micils a um(mpnt4 exrxrcoa1om  livs t) rtrxo3nodllen ivtlt  rtaur no1tltnmoctltlm rau ont4tlerir3ia1laDraueo ( sexmimpoydapeemfcilsfaDrau pno1aee  ietaslaDel(mp t)teeoio3io1lateauvs;t0 2xmim io1olen fvta( a2urx ooo4oltoioeildlmDelums;(0aleomf3oa1omDrau o;t srxmxrpoydolen nct (f Draxrpnu4tpxo f3tys m2ul(vonu0tetoio ia1lpDelnvi t)teumimpou4olee ieiat)aruau  ot4tet if3tas m em(vo;u4 etoir to1lmDeanei (0 exm(r nydopeemnctl(fsDrru p;u1olxomo3tasfs2rmu pnu4altrir oydlptelues;s  rxoxr3oo1alt lneiat)arua(ront0teen o3ias mDemuvon(0teeoir3oy1lpt  uvs ()s2tm(r io1om   fviatfaDrm(mpou1tpt mi3tasla2emuvo;u0texrmr3ootomDraivi ()s2xrxo3iodopt miei t arrmu  nt0tptoifciysfs rmums t4trxnmoctydlm  ln s t) 2xrxopio1lpte nctltf Dururo;t1olx mf3tadls rm( p;u)trxomrcoadfpteli s;s0 eto(r nydome  ics t s2trxmoot4olxnmietasla rl(mp u)trtoxrctydfpteai il() 2xoirpou1apeelnvslsf Dua( o;o0optniiciatfa umuvont0 eermfciadop r nvo s0 exmxo oudlmtelnvtasf rum(  nu1ole  ietltfaDulu s;(4 ltrxo ty1fm eanvo t0sexo(o nu1lmen iet t  rtm(mpnu0oexo oeiyd a2rau p u4tetrifciydlm rauvi s0 2trxm3iy4alenlieia( sDurur ;o4tpt iieiatla2em(ms t4trenir3oatlaDrauvs t0 2uoxr nudlp  livias) rtaxro;u4opxnmi3iydfs2rm(vp;t0 reoxo3to1faDrauvi;s teto(opoy4omen fcsasf 2uaumo;o0alenif3tadls2em(mont) lxoif oodoptrlueo;t0 2tmxr ny4op nlfci s)sDrau pno1oet iictltlaDrm( pnu4 rtrioctadlptelivo (  2xmirpoudolen feils a2ta(mpnt4aeenii3iatls rlnvpn(0arxrxr oodlptrlneo;()trurio3nu4aleemivi t aruaxmoou0oeenif3iytfs2umuvon(0tltoif ia1opDrauesls0teurio ou1amee ieta(fa2ta(rp;t4oltniiciat a2um( o t) rxrio3ty1fmDrlneo t0t2ur(m oy1ap  mictlt sDuaxmpot0aptoif3iyd mDelnmo t4areoxo iy1lpt an s t s2xo(o oydopt  ivsas  2urx o;t4tpe mociydfm2rmnms t) lxrxr tadfa e uei t0sexo(mpiu4omtnlnctl( aDra(ro;o0aleniieildlaDelu s (0texnxrcoo1lpteanvs;()texmxr iodlle lnvsas) Draumoou1tpxomieilslm2ra(vs u)artnxf tadoa rln slt s2ur(o3iu1amen feias a2ta(m nt0aptoiieiydls ul(msn(4 eeoxrcta1opDrauvs ( srxmio ny4optemncs (f ruaumo;t1alxnmfeiyd a ulnvont4trtomrcoatlaDraieo;t)s2trir3io1ll nlietl(f 2ta( p;o0teen o3iyt s2el( pnu4teenmoctydfpteaiei s) rurimpiy4ap emivsat s2rax  ;t1aptoioeiydfmDul(von(0tltoifctydfaDelivsl(0teumxo oy4op nlfvia()s2uaxm ou1tet  iciltls uau p;t0aeerxf3tydfm e i olt  etoim3iu4op  lneiatfa2ra(ront4tleoiocilt m eln o;u4tlenxocoytlatran i t)setm(m3iu4lptemfvsat) Dtrx p;u0alxn fciasfs umn p u)texomr iadoa rlu s t)t2to(mpno1opt  fci tfaDtm(r nu1ape mfctlsfa2ra(mp ()alxoif3iatla   uesls0setriopnodomtnmies t aDrr(rp;u0aeen fetldfs2ea(mo;t)arxrir todlpDrlieo;s) rurxmpoy4ale lictlt  Dtm(m ;t0alto i3tysla ua( pnt0aeerxr3iytlpDran s;s  rxoim ou4apeeliesat a2rmxr no1texnmi3tltlsDran o;()tlxoxo3io1oa  li o t teum(m3iy1lmenlfes sfsrum(ro;u4alxoiieildlm2umu s u) lxnir tytop eauvi;s0seuo(opoodol e nctl(fsrurur ;u0opxnif3iydfmDulnvs;u4 rxoir ta1oa eln i;s)setoxmpou1amtelneia(farumx pot1alx moeiadlm2rmu o ()altnif io1lpteli i;s)trxm(o ou1optelivil(f rtaxm ;u0aet mf3iyt mDrl(mp;u4 eenxo3tytlpDrluvil(0sruo(r oy1alte icils arrmx p;u4oex  o3tltfa ean s u0 exoxf3oydoa e ivs t trxrxm3oo4altn fei tfa2uaumo;u4olxomf3iytfm emn p;(0tleoxo3to1fp rluvi;t0 etoxr3oo4olt licsa()s2rru p;o0oetomieiysfa2rmumo () exnmocoa1fatranvilt)srur(rpoy4omte feiat) 2rr(mono0oex ifeiyd a um(mpnu) ltnxocoydfmDe neo t t2urxopiu1ll nmfvs s  ruax o;o4olxo ieiyslsDeaumont)altoxo3oytfmDeauvi;t)tetoimpiy4om  lics tf 2ur(ro;o0oeeomictlsla uluvp;u4altnxr3oytoaDeluvols0trxm(o3oudope mneiatfsDuaxmont1ale  ociadfa rlu snu)texnif3iadopt lueolt  2uoir oy4apee fvtlt sDrr( p;u1tleo fciltls rmnms t0 exrioctatlatraneil(0srumirpiydlp   fci t)sDtr(mpnu1aetnmfcils aDul(ms;u4alenxrctytfaDe ivo;s) rtm(o3nu1lm n ics t sDtr(r ;t1oeeomoeiysfaDrl(mo (0trerxfcoa1lpD anvsls0t2uoxmpou4lleelnvsa(  Dra(mo;t0tltomo3tadfs2em(ms;u4trermr oy1lp rln sl()srto(o nudom nmiciat sDrrumpot1oeeo oeiydfm2rm(ms t0artoxf3tydlm  aneo ()t2um(m ou1llen fciatf rrrxro;t4aex moeiydlm2ul(vs;t0alenxo oo1fpDeauvils0texo(o3oodlpeemietltf 2tr(r ;t1oleo oeildfm umnvo;(0aetoxr totfpteln s (0teumir3ou1llen fvs sf 2raxmpnt4texn ietyd a2ran on() rxoif oadfaDrai s;t)teuo(m ou1ll emnes tf Duaxmpoo0opx ioeiydlm2rl( pnu) exnir3ty1lm r uvi (0srtoxo ny1lm   net sfs2tmxr nu1aeeoiietlslm2ulnmsnu)tetnxociotlp elieilt0texo(m nydapeemnctls)srtaump;u0oex ioeils s um(monu4tlxnmrciatfpDrlu ilt srxoim3io4apenmfcta( a2rr(mono4teenmfetadfa emn pn() rtrxf3tatfa r nvi () eurio nodllte nvs t) Durxrpnu0alx ioetlsla um(vpnt4trxnifcoydlaD livo;( t2tmxr3iodlptnlivtl( srrr(root1oltniietasfs2rluvo;t0 etnmrciytlmt  n slt s2tr(r iodlpt mies sfsDtax o;t1apx mo3iyslsDraumpnu4treoxoctytlmtr nesls) 2xmxr ny1opt lfesl( sDumu  ot1olto ieiytfm2ea( o u0trxomoctadomDe uvs t texoim no1llenlfciat) rra( o;o4apenmfeiad a eaumpnt)tlenirctadfa raueil()tetr(o3iudoltnmfesasfsrrr( pou4ale iieiat mDeluvp (4 etrmfcoydop  ln sls)s2ur(opno4amtemnctl()sDtmum no1olt  ocildfm ua(vo;()areomocto1laDrlu s s0texm(o3iy4omenlieiasfaDrrum ou0apxo i3iytla2ulumo;t)tetoifciadoa   iesls tetoir nu4oltnmfvta( s2urumpoo0opxn oetatfmDel(vs ()aetnif3io1oatrlivo;(0 rxrxo3io4ap n feta()arrrurpou0teenmo3iysls eaumsn(0 etrmo3oodom  luesl() etmxrpno4ome  nes sf 2ur(ro;t0tlxnifcilt aDulums t0 etrxociatfmt  uvil()t2uo(r3oudlme mfvsas sDrrum oo4apeniocildfa eln s ()teerxoctodomte ivils  2toxmpiudoltelnet t  Dumur no0apxnmociydfaDem(vpnt4aexrmocia1lptraiesls)t2xmiopiu1lmt mfeias) rur(  ou1tlx  fciydfsDem( p t0 rtnif ootoptelueil() eumir iu1opeemivil( sDtmu  oo0apx miciydla em( o u4altoir3oodom  lnvi s truo(r3io1lmeelnet tfa2urxroot0aeto ocilsfm2ulu onu4 lenxo oa1lmD anes s srxoiopnodapeemnesas)arur(mo;u0texnifetydfm2emuvsnt4artrmo todfaD an i;()srtmirpou4ll   feia(  rtaur ;o4aet  iciltfs2umnvo;t0aetnmr oytlpte n o ( seurxm io1aptnmicsat)aDuaxroou0tltnmfeiat m eau o;u4 rxnmr oo1laDrauvo t  eum(m3iudamt mnvsl(fsDtmxronu1teeo f3ias aDulu o t0 eerirciotlm  auvolt0t2xr(rpny1alenlivt t  rrmxmo;u1apt moctlsla ul(mpn(4 exrio iotoa   uvo;()seto(mpou4aptelnciat) Dtr(rpno1tle ioetyd m2ul(mpn(0tetnio3todfatrlues;(0 rtoio ny1opte nvt (  rum(  ;o4olx  f3tysfmDrlums () exnmf3oa1lmtelneil() 2ur(o3ny1omen nvsl(f Drmumoou1aexnmictasfmDua(vsn(4tetriocia1fm rlneil(0t2tmirpiu4opt livslt)aDumumono0oltomfeiatls eanmonu) exrxr3iotopD aueo;s0seumio3nodllenmfeil()aDtr(rp;t1aptoio3tasfm umn sn() lxnmfciatlptran ols t2ur(rpio4am emfcsls) Drm(  ;o1oee ii3ilsfsDelnmo (0areomr iydlptran ols) ruoxopnudlp emfvi ( a2uaxrono1tet moctldfa2rlnvs;()artnxr oydlaD an o s  2xo(m3iy4omt mict s artrum ;u0tpt ifeiydfa2rm(mp t)altrif iatlmt ln i;(0trtmirpoy1lpenmiesls) rrru o;u4altnmieiadls uanvp;t0 exrir tadfaD  ies s srtmxr3oo1op nlncsasf 2ur(mpot0aeenmieiasfa rlnvon()aeermfctytlpDelivo s)tetoio3iydlme licsa(f Dtmurpoo4opxnifeildfaDrmnvo;(4aexnmrciadfate u i t tetoir3oo1lmtnmnetatfa2umx o;u4opxoio3iysfm2elums;t0aeermfcoy1om   ivi s)srur(r ou4op e netls)srumu o;o4tleomietls s rln ont4aetnxf3oa1fatrliei t0 rurxmpiy4om e ici t)srrmurpnt4oexoifciyt m ra( pn(4altrxrctadom ranvo t0s2xr(mpiodom emictas) rra(  oo4oeen iciys m2em( sn(0texrmo iotomt  nei ( t2xo(o3ny1omenmneiat srtaumpoo4tpxn oetlsls2uanms t4 exnxocootfpDrlnvol(0sexrim nydlpenmfct s)arraxmp;u4tex  iciltlm emnvo u4 exomr3to1optrlieo;t)s2ur(mpiy4oleelfei tf Dtmxrpou4aleomietltls umnms () lenxrcty1lptr nes;t setm(r nu4aptn nvsa(fsDrmum nt1alto ictls a uln s;t4texnxfctydomDranvs;s  etoio3oy4aleemictls)a2ur(mpno0olt mf3ildlm2rlnvpn(0aeeomr3tatlmDeau s s) rxoimpoy4lptnmnvtl()s2tmumono4apx  fciat s2rl( o t)alxoxo3iotlmD lnvslt0s2tr(mpnodlpe lfesas  2urxrpnt1apeo fctlt mDeluvo t)aetomr tadlmDeanvo;()truo(r3nudopen fei sfartrxmo;o4olto ietas m2rauvs t0 rtnio3oy1la  auvi t) 2urxr iu1optelivsl(fs2urx pot1aexomociatlaDumnvpnt4trxriocoytfp  au o t0sruoimpoodaltelnetatfarrr(m nt1tpe  feiatfa rm(vp;t0 rxoirciytlm eluvi t s2tr(opoodlmtemfvi sf rum(ro;t1olt mf3ias m rmn p u0 eerir iadomDr ieil(0teumim oodoptnlfcsa( sDrm(  ou1teto o3iyd s2rm(mp;t4 renmr3oadomD au s s)t2um(r3oy4lltelfet ()sDum(mono1tltomietas s em(vo (4areoir ootfat  nvi;s0 rtrxopou4ll elivs (faDrrxrp;o1apeomoctytlaDemnmo u0trerxf tydlmDe nvsl()trtr(m3oodllenmivtatf rrrxrpno0oex iietad s eln onu)areoxf oatfaDranesls0texriopoy4ale licsat aDtmx  ;t4optnmfetlsfsDelump t) reoifcto1fpD lues;s  2tmxo3ou1lm  miciat) rra(mooo0aexn f3iydlm ul( pnt0aexnxoctadoa e u o (0 2uoxo3iu1lpenliviasf 2rmuro;o1olx ifeiydfa eauvonu)trxrir ty1fa  au s (0 2uo(m3no4op nmicia( s2tmxr ou1ale io3iysfm2rmnmp;()arerif tydoateanvilt0t2xoim3nydlmt  fes s a2ur(m ot1tee mfciyd a rauvp t) rermf tadla  livil() rxm(r3nydol  lfes s)sDurxmpot4tltn f3tadlaDrauvo;t)trtnmr3io1fm raies t0setrir nodlpt  iet s a2raum oo1optnioeiaslmDumnms t)trenxf ootoa   nvs ()srxrio3nu4lme mncsls aDuax p;o4tetoiieiys a2ra( o u)tetoir oodfpteanei ()srumir nodllt mneia(f Drrx ont1tleniiciysla rm(vo u) ltrio oa1oaDrli o;t)teuo(opny4lmeelivsa()srrru  ;o0tpxn f3iadfs2eanmp;u4trxrmr tatfmteluvol(0s2uoimpoudlm n ncil() 2ra(  no4tet iietldlm2eluvp (0tltrif todlmteln i;s0 2uriopoo4lltnlfvtat)s2trxr ou1oetn feiysla2uaump;() etomfcto1fmD au i;t0trxoim nudalee ies tfartr(r ou4oleniieias s2ul(mo;(0trtomrctadfmDrluei;t) etm(o iu1oleelicslt srur(  ot0tpt iociyt aDuluvs ()alerxfciatfm   iesls  etoxm3iu1op  mneils)s2uaxronu0ope mf3iasfa2rmums t) leriocia1laDrai i;t teumirpoodope lfci s  Drm(ro;t4opeo f3ildlm rmnmsnt)altomrcio1om rli i (0t2trxo3oo4oltelivil()sDtmxrpnu4oexnmoeiad a2ean s t4teeomf oatfmtr ivo ( setmxm3iy4lm  lfet sfsrtmxr nu1tlxnif3iys aDra( o (0areomf oytlp   ivil()tetoio3iodome lnvtas) rra(r oo0tlxo oeildfs elumpn(0 rtoif oydopDe neil(0 2urxo3nu1llte nciat)arrrxm ;u4oetn oeias a2eanvo;u0 lxnxr3iy1fat  i s (  2trio iodal  livtatfarrmx ono0tle  fcildls2ra( p u) lxnirciadopD  nvils0s2tm(rpnu1ap  mies s a2rmxr ;u1tpe mi3ias a2rmn sn(4arxoio3iydfmDrluvi () 2ur(m iydomtelfvi tf rrru ont0opxoif3tys s2ranvon(0aleoxrciotfpDraneo;s)setoio3oodop nmnvsl(fsrrmxm nt4ole if3ilslm eln pnu4trxnxf oo1opt anvsl() rumirpnodaltemiesas) Duaxr nu1opeo ociltfmDemnvpnu0altnir3oy1lp  auvolt seuo(r nu4amtnlieslt sDumurono4texnmfetydfm2rl(monu)aeerxf iotomDe ies;s0s2triopny4amte ictas  2truroou1aeto fetatlaDemnmpn(0trtrxr3oadlmDe neol(0sexrio3oodlmenlivias) rtm( pnu4tpxn oetldfsDumuvo (0alxnmfcoadomtean o s  eum(rpoydom  mnvt sfsrtrum oo4ope ifeiasfa umu o;t)aeerxfcoy1lpD ln o t sexm(rpoydapt mncilsf Dtmu  ;t0teeomociasfa2emnvp;t) lxoir iodoaDraieo;()sexmxr nydol  livi tf rtru p;o4alx  o3tlsfs2elnms t)aexomf totfp eanes;s teuo(o oo4ale mict (fsrra(r oo4apeomictatlaDrmuvo t0texomf tadoa rln s t seur(opno1amtnmivt tfa2umx poo1olto o3tydfm umn s;u4artoxr iydfpt li s t0teur(rpio4aptn ics sfs2rm(  oo1aetn oetydfa um( onu0trtrxr todfmDe i o (0sexo(mpoodlptelivi t)a2urxroot1apxniociatla ra(vs;t0altoxfcoa1fm  lnvi;t trxm(rpiudom emfetasf 2tmumoou0apx  oetyd a uaumsn()alenmr todfatraueil(0sexoxo iu4alt lfct sfs2taxr nt1oee ioeiltfm2emu onu0artrmo3iotlat ln ils)teuoxm iu4al  mnvtl(  rrm(r no0teenmo3ias mDul(ms () eenmocia1fptrai o;(0srxrir3iodalte nctat sDraumpou1tptomi3ilsfa umums u)trxnxr3oo1lmteauvo;t)srtr(r ou4altnmncsls)a2uax pou1oexomoctytfaDemnmpnu4 exomo tadfpDeanvs s teurim3iy4lptnlict ()s2trxmpou0apt ii3iadlsDraump;t)arenxo3oatom  aneils) 2trxo3nudamenmncsa(fartrxmo;t4ale mfctyt sDrmnms t) rxrxrctatla eai o t) 2urio oo1ol elfet ( s2ur(root4tleomi3tytla2em(vo t)trtnif to1fmtr uvi;(0 exoirpou1lp   netlt)artru ono0aeeomf3iadls2ra(vo;u0 ltnxo oo1omte ieo ( texmxmpiu4ap e iesls s2tmurpoo0ole ioctlsfs2uau p;t4 lenmrciodfm eaueol() etmxrpno1optemneia( a2rmumo;o4oet mi3ildlaDumuvo (0 rtomf tydla   ivi;(0t2toio iu4lmeelfcta()sDuru pnu4teenmf3tys s2rlnvo t0 lxnxocio1lm  aueil()s2uo(o ou1omte fvia()s2ta( pnt1tet mf3iasfmDeau pnt) eeoxo tadlpt anei;s0tetm(o ou4op e fetltf Durumo;t1oet mi3iysfs2el(monu) eenmr3ta1oa elivs t s2to(opno1ame lfcilt)a2rau o;o1tlxnifciadlmDra( p;t)texnxr iy1fptraivilt) rtm(r3oydam elicta( arurxrpnt1olen ietaslsDean o ()teenxf3tytfpD lnvolt0 etr(m3oy1amtelict t) 2raxmono0teeomfeiytlm2emums u4tetrioctodfp elues (0 rxmio nudlmtnmfvtlt s2tr(mono1aet mfeiadfsDrmn pn(0tetnmocoydom eaivols0 ruoim nu4om  mivsatfsrrrx pno0teeo ociatfm2em(vs;t4 lxnif ta1lm eaiei s) exrxo nydapenlncsa()a2ra(m nt0oleomo3tlslm ranmpnt0trtrmr3tydomD auei;(  2tr(o no1omtemnesls  Dtm(  ot1apt  feild m2um(monu)arxrir3tatlmDraiei ()s2uoio3iydlp nlnei (  Dta(r nu0oeeniietadlsDum( p;t4trxnxfctotlpDelies;s) rurxopiudom nmivslsfa2uau pou1olx  f3iadlm2emn s t0artomrcto1fat  ueolt0 2ur(o iy4ol nmfetlt s2uaxmonu0ape ioeiad m rmu p;(4 leomocoadomDr i sls) 2umio iy1lptelnet t)aDtaxro;u0oeeniieiadfs ea(msn(0aetoio3oo1oa e nvs t)texm(m3iy4omte nviasfaDtmu poo4alxnioctlsla el(vo;u)texoiocoydoatranes;s) eum(o oudop emiesl() rtr(  ;o4teeniocias mDuaumo;u)arxrir3ia1oat  n o;s  eurirpnudlmenmncsl( sDtaumooo1opx io3iadfsDrmump t4trxrmr3iy1omD lu o;t0srum(o nu1lp nmfetl(fs2umurp;u4ole ifctat m2rmnmo;u0trxrmrctatfpte uvil( t2um(mpiu4op e ncia(f 2raxr ;u1aet micilt m2eanmpnt)aeerxfciotoptrlu s;s seur(rpiodamtnlfvia( artruro;t4tpe  i3tlslmDem( snt) rerir3ta1fa elues (0s2urim3iy1amte nesa(  2umxm ou4tle  feilt mDemuvs;(0arxrirctotoatr nvslt) euo(opiodal nlnei sf rur(m ;o4oltoiiciyslsDeauvp;(0tlxrio3todoate n s;()srumxm3io1ap e ict (f Dur(mp;t0alxo fetltfs2umnvsnt4artrif oatopD  u s t t2toio no4ap  lieils a2tmxroou4apt ioctys aDelumo;u) lxnxo3oydlmt  ivols0s2triopny1lmenmietas s2tmx ono0apx mfetas m rauvo;()alerxo oytlp e ivo;s  2xrirpiy1ape  iet s s2umum no0ole mo3iatfsDuau s;u)tetrmf3iy1lpDrli o s)texoio io1open nct sf rum(ronu1apxn feiltfaDrau pnt)aexrxo3tatopDe uvo;t  ruo(o3oudamtn ici t srta(rpou1opt  oeilsfa2ua( snu0aeerioctadfa  liei s0 rtr(m ny4apeemfcils  2raxroou4olenio3tyt aDeanvp;t0 etnio3to1fmtrlieo;t s2toxmpnydome mics s)srta(moot4aet io3tyd a rmu pnu0areoxr3iydlpDrlivs s  2xo(mpnu1op emfcs t srraur nu0tlto feiltfm2ean o;u)tleomf3oatom e neilt)srxrirpoudlpt  ivsa( a2ururono4aee ioctlsla2rmuvsnt) ltrxo3oadoaD lieolt)srum(mpoy1al  lfcsl(f rraxrp;o4aexo fciydfmDemn p;u0alxnmrcoy1lmD aivslt0seum(rpiodlleemfcsas a2rmx poo4opxo f3iadfm ua(vp (0texoxocoydomtrlivilt)tetrio3nu1llt lnvtat)arraurpnt1apxn ieiltfm2um(ms t) exrxo3tytfa rau o s)sexoirpny1al n fci s) rrm(rpou0tpxnmictlt a rmn o;u0tlenif3oytfm eauvols0 2urim nodomtnlivtl(f Dtrxrp;o1aexn ociytfs2ul( o t0tetrmr3totlaD  ies s trxmirpiydopen feslt) 2uru o;o0oexomoeiytlaDelumsn(0aexoifcoydoaD  neols)texmxm iydome mivi ( arurum ;t4apx mieiyt a ranmp;(0 rerxo3iadfa r ivils tetr(opoudamtemfetlsfs2ta( oot0texomfeilt sDuaumsnt4texrio oytoaD  i sls  ruoim nydomt mivi s  rurur ;o0tpxnmicilsfm el( o;(4alxomrcto1oaDe u o t)trtmio3iodol  livia( arrruroou0alxniieiytfs2ulnmo (4texnmf3iotfmtr uvi (  exr(m nodom n ieil(fs2rax o;t0tleoif3iaslm2emnmsnt0alxnmf iy1omDrlu i t srtrxopny1lptelfes ( arurur nt1aex  oetyslsDemuvp;t4tlerio3oo1laD lneslt0t2urir oodomenmncs (f Dtmx o;t4ape iociad a2eauvo ()trtoirciotlmtrln o;( srumxr io4alenmncsatf rumxmont0apeo fetatfm2emnvo;u4arxrxrcoadfm rlnvo;t0 eurio3oo1ol  lnvsat  Drm(mooo4aexoifcildfm ra( sn()aetoxf iadoptrlies t0s2xmir3no4om n fct () Drm(monu0apto ocildfmDeaump;t)aexomo ia1la eli o;t) 2xmir oo4ap nlieta()a2tr(  nt4opeoif3tad s rl( o t4arxrir3oy1omtr i i t0trtrxopoy1lm n fetas) Dumx  no4tlen fetatfmDrmu o t4alenir oadfmtrau i;s)t2uoxopiodol nlictl()aDrrxmpnt0teeo fetat a ul( snt4tltoxrctadlmt ln ilt) 2tmiopio1am nlnei s)srraxront0oeen fetatfm2rl( s t4 eerxf iatom   iesls)s2umxmpnudopeemfcils)sDuru  nu0olenmoeiys a rmuvp (4trxrxo3iytla  ln ols0t2tr(r ou4lltnlicias sDra(r ;t0tlto o3iysfa rlu o;() leomf3io1optelivi;s0trxmxm io4llen fvtlt) Drru p;t1aptnio3tltfm um(vpnu0aeermr3ootfp rli s t0seum(o nu1lmee ncils)sDtau pnt1tpt ifcias m2em(mo;t0alerxf ta1faD lieo s srxr(rpio4om   iet sfsDtrurpou1apxnifciatfs2um(mo u0 rxnxr oadoa eauesls0srxmirpnu4am nlfcta( srtm( p;o0aexomocilsfs eln p u4tlenxr iotomD ai s () eur(opoo4lm  mies s)aDrrum nu1olto o3iasfs rln p;(0trtrxr3io1lp eluvo;t t2xo(r3io4aptemfcs ( s2rmxmono4alxniietasfs elnms t)alerxf iatlp ean o;t0sexrxopoudamtelncias)a2umxmpnu0aet ifeiyt mDuanvp (4aexoif3ia1fmteluvsl()srtrir iy4ll emieta(fsrrax o;u1altoiictad sDulnvo t0alxniocia1la   i i;s)sexrirpiydopenmneiatf rtr(r no4aptnmo3iadlm2ua(vp u4aeeoxrciydopDrlneo;t) 2tmxmpiy1lme mies t sDuaxr nu1opx mictasla uln o;u4treoirciadoat  i i;t truoiopiy4altemfesl(faDra(ro;u0tlen fcils a ua(ms;() lerir3oytfpDr ivols s2uoio oudopt  iesas  rtr(  nt4oleoifctltlmDuan s (4tlxoxo iatop ran o;( s2tr(rpio4ol elfct tfs2trxrpoo4aptnmfcilsls2uluvs;t4aleomrcto1oa   nei;s0sexr(opoydapt lictls a2rm( ono4tpxo f3ilt mDrlnvsnt0 rerxfcta1om   n o (0trurir ny1ome  fetatf rrr(m ;t0altnmocils m2rmuvp u0aeerxr ootlpD li ols) etoiopiy1lleelfvs t) 2tau pot0aex moeildfm rm(ms;t) rtnxr oatlatrlivolt t2toxr3ny4opt lnvsls srtauro;u4tltomfcilslsDua(mo;(0alerxrctotfmDeaieo s0 eurir oo1lp e fvs sf 2ra( p;o4tetomoetatla2umumo;t0tetnmo3iytlp elnvol()tetoxo iodlm e neiat sDraumoou1aexnmictytla2uau s;u)trermr3to1lp ran i;s t2ur(rpiudolee nci t) 2urx poo4opt mietld s2rmnvs;u4teeoxf3iydom   uesls)t2urio oydol nlicsat) rtmur ot0tpxnmoeiatla eaump;t) rerxo3totomDeaivi ( trum(m3io4ome  fvi s s2rmur ;u0olen f3tasla2uln s;u)alxnxo to1op e neol( setrir3ny4optn ieta(fa2umxrooo4altnio3tyd a um(vp;u)artnmf todfaDran i;s  rum(m3oo1apt mici t)aDtm( ont4opeo fctls s um(vo (4 lxrxf3oy1lpDraivo;t0s2trio3no4op   fctasfaDuaur ;u0openifeiytls2umuvp;u)teeoiociytomDelnes;()s2trxr ou1ale  nviltfsDtrumpnu0apt moeiysfa emu p t0 rtnio3oydfmDe ueolt)t2um(r oydlmenmicia( sDuru  ot1aleomo3iydla2eau s;u0 lxnxf3ty1fmtr ivol()setoxr3nodomtelncs sfsDuaxmpou1olenmoeiysls ra( sn()arenmo3tadfaDeln o;(0 rxoxr oo4olenmfeslt s2uau o;t0aeeo o3tytfs2rlums;u0alxoxr to1fa ranei ( srxo(m oo4lmtelivsls a2tau o;o1tpe mictldla2eln o;u0alenirciadfmtrlnvi;t) 2trxm3no4omenlivsls sDumx ono4optnmoeiasfmDea(mo ()arxnxf3iatopD  nei s)t2xrxrpnu4ap emnvta( srtaxmp;u0optn feias m rl(mo t0treomf3tadlm elu i;s0 eum(opoy4optemnet s a2tru ont1tlxn f3tat m umums;u) lxnxr ta1fatrlnei s0texoim nu4ale mnvias  Durxm ou0apxo f3iydls2rlnvo (4 rxoxf3iadomtr ieolt) ruriopnydapeelicsl()artmu pno1altn fciyd m ra(mo t)treoir oytfmDe neols0s2xoio iy1ap  mnci s  Dtmx p;o4alx  fciasfsDelnmo;u)trtoxo to1fatraueo t0srtr(m3oy1amen fviat)a2raumpot1opxn i3ilt sDuln p u0 rxoif3oa1opDeauvi (  2xriopoo1lle liei tfsrraxr oo0oeeomiciytlsDel(mo u)tetrmo iytfmt ln s;s s2xoir3iu1lmeemfeils)a2ta(mpnu1tpe  i3tadls em( o (4 exnmf3iatlpDeli i s)teuo(r ou1ap  mfcsls)srtrx poo1ale  ociad s2rmnmp;u)arxoio3oadomtrai i;t)setrxm io1llt mneslt artm(rp;u1aee  i3ilt aDumump;t4trxomr io1omtr ues;() rxrxm nydlme lictas)artr(  no0alxomieiyslmDua(vs;(0alenxo todlpt  uvolt0t2toir3nudaltemfetasfarua(ront4oet moctldfa2ra( o t0aetnxfctodoa  aueo () eumio3nodapeemiesasfsrrru pot4tltniietad m2eauvp;t4trtoir iotlpt ai o;( t2umirpnu1optn ieslsf rrmum ;u0oexoioetysfs rln p;() rtrifciydoptranei t) rxmirpno4llenmnvsat) Duaxrono4alt mf3iytfaDemn pnt0 ltoxrcoatom raivi t)texm(mpiudapeemfes sfsDua(moou0oleo ociad m rm( o t0 etrmr3tytoptelivo () 2uo(o3iu1omtemivtl( s2urxmpno4opxnio3iys a2eau s;u) eerio3oo1lpte ues;(  2xmxr3iudop n ivta(farrax poo1tlt ioeiadfs eau p;t0tleoxfcoa1la   uvi;t setrxr3iy4lpt lncsl() 2uaump;t0oet mfetatlm uluvsnu) ltnmrctotoaD aivo;s) 2tr(m3ny1llenmnvil( aDur(  ot0tpxnifetadfaDeln pnt4 eenxf3ty1opD  u o (  exm(r3oodalt mici s  2rrumpoo4olxoiieiasls emn s (0artrmo oy1lat luvol(0 etmir iydap  mfeia( a2tr(rp;u1aexnmo3iys s elnms;t4aetomr iytoptrai i;( teurxmpnodapen fvs t) rurxmo;t4alen o3ild a rm(vp (0aetomocto1oa elues;t  rtmim3oo4am   iesas) 2urxmpou1opt  ietasfm elnvs;u0teenif3oo1fmDr ies;()srxrxr3iodlmtemnetlsfartmxrpot0oltoiociad s rlnmpnt0trermf totoaDe uvi;(  euoxmpno4ll elnci t)sDtmur nu0alxomieiysfa2elnvonu)areomr tatfa e neo t) 2ur(o nudameelfcia( sDtr(mpoo1teeoiiciltls2ua(ms;(4trxrmociy1fmtranvs;t s2urxr3nydaptnmnvsat)aruaum ;u1tee ifcils m rln o u)treoio3oy1oaDr neo () etmim oo4ome  nctltf 2uax  ;u0oleo o3tasfsDemnmsnu4 rtnirctodop  livo;(  eurim io1opeemfviat arra(  ou4oeto i3tldfaDrm(vs;u)tlxoircty1fateln o;() eto(rpou4lpt micia(farra(rpno4tltomo3iys s el(msnt4 ltomf3iodfa raieils)trtm(m3iu4am n ici s) Durxr ;u1apen iciad aDuluvp u4trermoctadlaDe ueol(  2uoir3iu1lpt lfes tfaDraxmooo1teeoifetlt m rlnmonu) lenmo iy1fmt lueil(0t2toxr ny1alt mnctl() Duaxmont4tpenif3iasls uau o u4 rxnmo3iotfptr neols)srtmir3no1lmenmietlt)sDrmu pnu1texomoeilt a elnmp;t4arenif3iydlm eanvols)texmxrpiy1ol e ictas srra(rpnt0aptniicias a umn s t0alxnirctydlmteaivs (  euoirpnu1amt  fes tf Duaxmp;t4apt mo3iyd sDem(msn(4alenmo3ootom  lnvi;()teumxm oo4om n nvta( aDtrxmont4tpeo o3iltls rln p;()tetoio ty1op   n ol( s2tr(opiy4apee netat srrrurono0altnif3iys s2rmumo u4tltoxr3to1lm rlivi ( srxm(r oo1lpe  neiat)s2rru ono4opx  f3ils s rmums t)trerif iytlp eau ols t2xrxmpou4ope  ictlsf rum(ronu4olxn fetysfa2eauvo u0 ltoifcoo1laDrau i;(  etoio3iy1am nmnvi (f Dumxronu4tlenmi3tytfsDrm( o t4aexnxo3iatom   ivil(0srxoxm oy1altelietltfaDtrumo;u0teenioeiatlm2ea( pnu4aexrmo3iydopDrlnvols)texmxm oodolenlfcsatfarrru p;o4tlt  f3tyd sDemnmsnt4texoxr oo1oa   ueilt0s2tm(r3iy4lltemnvils)srrrx pno0apenmfcilsls2el( p t0trenxo3tatlmt 
\ No newline at end of file
@@ -0,0 +1 @@
+nvs t trur(r ou1ame livi t)a2umur no1aetnifeilt s2umums;(0arenxo3oatlpD aies ()texm(opiu1aleelnciat  2tax pnt4optn f3iys a2emnmp;t0 rtoif oo1la  auesl(0teto(o3oudop e feilt srta(m no0tpe iociat s2rmnmsn()aeenmocoa1fa  ai s ( texoim iydll n fvsasfsDraurooo4aptnmoeiys s rmu sn(4areomo iytfp  an o;s) rtoim3ny4ll nlfetat a2uax onu0aex  ieiatfa ulu sn()tetrxr iotom  aiei;s  2uoiopoodlleemivtl() rtax pou0tlx mi3iys aDrl( pn()altnio oa1faDeluvolt srumio nodlpt lietasfsrur(moot1tpxnmiciltlm2uau pn()artomr3ootfpteaivo;t trtrio3no4ape micsat) 2rmxm oo1olt mieiytfa2uluvo t4artoxr tadfmDr uvo t t2trxopoo1ll elfeilt sDurxr ;u4oleomieiaslm em(vsnt0 renio iytlmtrlu olt) 2umir3io1ole lieiltfa2ra(root0olt micilslaDul(mp u0aeenxr3ta1fatrai slt)trxrxm nu4ame mnes ()a2ra(r ot4oetnmociyt aDranmp t)altnir iotfaDrlneil( tetrxo iu1ale mnvtls sDumxrono4oltoiicils mDrl(vpnu4trtnmo iatla eanei ()t2uoxopiy4lleemicsatfarumxr ou4opxo fciytla eln o;u)areomf oatop  aivs t0teurxmpiu1omte net t)sDrrxr ot0olt  oeiltfs elu s u)trtoir3iodfa eli s (0 rxrir nydol e icias) 2ra(monu0aexn ociatfa2uluvsnu0areomr tytlmDeluei;t0 exoxopny4al nmnctas) rtrxrono1opeoioctasfaDran onu4 lxnxf to1la e uesl( texrxmpnu4ameemnvilt) rrmu oou4tltn i3iltlaDum( s;t4trenmociytfmtraies ( tetr(r3iu1optnlnei tfaDur( p;u1teenmfetldfaDrluvsn() exrxo io1lpDr neo s s2xmirpnydope mnvs ( srtmx  nt1alen f3tasfa2rlnvs u) lxrmo3ia1fpDe uvo;s)t2ur(m nu1lpen iei ()aDua(mo;o1alx  feias m ea(vp;u) etoif iotfm ranes ( trxm(m3ny1optelfeilsfarrmx o;o1aet  f3ild m ran p;t)tetrircoodop rlnvsls  rxm(o iu4op emnctas)a2ur(rpoo4altniociyslm2uanvo ()arxnmf3to1fateanei;s0 etm(r io4optelfeiat)aDtaxmp;t0tee ioeiasfm ean onu0 ltnmf3to1omt  uvo;()t2tmxo iodap emivsa(fa2rmu  no4texnifeiyd a eanmo;()texomo3oy1omDraiei;t  rtmxm3iy1lpenlicsl(fs2rauro;u0teeomociysla rlumpnu) etnmfctytomDeauei (0t2xm(m3iy1ole  fesa(  rua(mo;t0aeenmoetytla emnvs;u0tlxrxo iodomt  neo;s seumir3no4lmtn ivtls arrrxrpou4opxnifeiasfa2umuvsnt0tlenif oytoaDe uvo s0 rtmxr iu1lpenmneia(faDta(rp;t0alxomociydlm umnmo;t4arxrxoctydlptrauvilt)t2umirpiudlmt mfct ()a2urx  ;t1opxoifeiydfm rauvo (4 rtrir3tadlatrluvs;t)trum(o3iy4am  lieiat)a2ururp;u4tet micilsfm eaums;(4tltrxr3ta1lp  lu ols0 etrxm iu4lp nmivslsf Dtrur no1apx  ieilsls rm(vp (4 ltoio oy1oa eai ilt0trurim oudaptnlnvia() rur(ronu0ape  fctadlmDrmnvp;t)aeeomr io1opt  ues;(0t2xmim3oo1olenlnvs ()s2ta( pnt4aex mfciadla2ean pnu)tlxnifcoodopD aieols0 2umir ny1amee ncilt)srtrxr oo0aet  fctad sDrl(mont0trtoio3oydfmDranvs (0texo(rpiu1lltnmivt () rtmurp;t0tlx  ieiltlm2el( pnu4aetrxo ta1oa  anvs (0 exoxr3oy1olee fcils)s2rmumonu4apenmociat s ea(msnt)aetnxf oodfa eaivi;s teumxo3oydoptnmncsat)aruaxr no4oet  i3ildfs eln s (0trxrmfctydlatelueo;s trxoxo3iu4lptelict s s2ta(m ;u1opxniictltfsDuanmp;u) ltoxfcia1latelnei s0trtmxopno1am  mnct s)srtrum no4tetomfetatla elnmo;t0 rxoxr3iodla rauvs ()seuoiopiy1omt  iesas)srtaxroot1tptnioeildlmDumnms t)tltrmrcoadlatrluei t0 rxr(m3nudaptelncsatfarua(ro;o0apx mfctlt sDumu pnt4 lxnir3todlmt  u o s tetmxopio1optnmics sfsrraxmoot0texoiieildfaDeanvp;u0 etrxrcoytopD  nvo;t) rum(opny4ome lictas)a2rmur ;o0tex  ociadfsDum( sn(0arxrxfctadfaDrau o ( teuoxrpou4lmtn ncslt)arrmu  ot1alx if3tasls elumsn()tetrxf3ootfp raieols  rtr(r oodlpen ncslt) rua(r nt0olt mociyt m umnms u0alenxr3oytfa rlu s (0seurxm nodapee nvi t)a2rmu ooo4olxomi3iyd sDum( s;(0 rxomfctadomteaueo;(  rxrxm ou1ll e fci tf Dtmu  no0tpe  ociatfaDrm(vp t)tlenir3oydfaDrlueo s) eurxrpoo1open ieta(  Durxr nt4tetoioeiytfsDulu o t4 rtomrcoydfmDranvo;()srxmxmpno1llen ietl(fa2rruroou1aet iicilsls ranmp (0teeomrcia1laD au ol()tetmimpoodoptnmfetl(fsDtrx oou1aeto fetytfmDemnvs;t0trenmr3ootlpD  neolt trumxm3io1ome  ivias)sDraxm no1optn f3iyd sDem(mon(4alenxr3ia1oaDeluvi;(0 2uo(o oydap e nvs sfsDua(rpot4apenmociysfs2ulnmsnt) rxnxf3iydlmteau o;s0 eumxmpny4lme  nctl( arrr( o;t1tee ifetatfa uanvo () rxrio3tytop ranvs;( t2to(r ou1amte netat  rua(r nt4aeeomociydlm rm(ms;u0aexriociadfpt lueolt  2xrim3nodam n neslt)s2trum ;o1olt mf3tltfa2ran o;()aetomo3ty1fpt  nesls)s2tr(rpno1lp  lict t sDua( pot1tpen fciatfaDra(mo;t4tetrxr3tytla eli i s) 2xrxo io1olt lfesl() rrr(mpno4oeenmoeiydlaDrmu snt) rxrmociodlp eauvi t0 ruoxmpoo4olee fvs ()aDraur ;t0tetn ociytls2ulnmp t0arerxrcoytom  lnvols)seto(m io4lptelnci (f 2uau oou0aptn i3iytfmDuln o ()trtomfcoytfpDrln i;t0 rxrxrpoo1ll nmics ()srraxm oo4tpxoifctat aDrlu p;t4 etoif tatopt anei;s0teto(mpoo1oltnlnvils)s2rax  oo0tpx  f3iatfmDua(mo ()aleoxf3io1lmDe ies;s) 2xr(r3no4ol  mictlt  Duru onu4aleomoetytfaDum(mp (0alxrir3oy1fm rlnes;s0srto(m3oodlmtnmnvslt)srur( pnu1apt  ociysls2uluvs ()treoircta1fmtran s;t s2urxopio1al n icta( aDumum ot4tlxniociat s rau p;u0 reomoctatoaDr nvols setoxm nudam nlfvi ( artmxm ot4altnmfciltla ua(mp;(0alenmo ty1lateauei (0 2um(o iydop e nes t sDtmumonu1tpxo oetaslm2elu s u0aexrmr3oodfatr n i;s0srumxo3oydlpe lfeias  Drax p;o0tpenio3tyd a2rm(vs (0trtoircoa1fmte i o;()setrio3oy1olt mfesls) 2raum nt0aex mi3iat mDrlnvo (0alerxoctytfat  u s;s0 exoxo iu4amtnlfes ( s2um( ont1opxoii3tadfs ea(vo;u)alxnif3tydfa r nei s0 exoimpoodapt  neiatf Dum(rp;o4aptnif3iytfa2rl( pnu4tetoxo iadfmDelivi;s)sexrxmpno1ap  lictl(f rraumpno1aexnmictydfa2uaumo;(0tetrxo ta1lptr nvols srxoir3nudomt micsasfa2rmx p;u0opxo iciltls umump t4trtrir oydop r neo s)t2xrim iu1ap n ictasfarrrum ;o0tlxo i3tld a rm(vs;u0tleoif tatoptr i o;(0 rurxo ny1op   ivt sfa2tmuronu0apxomiciasfs2rmumsnu0 ltrxr tadfaDe i ol()s2uoir3nydom emfeil() Dta(r ;o1tpt ioetadfs2emu p t0tlenxfcta1lm eai i;s0srxoiopny1omee ncs t)s2tm(  ;t0apxo octysfm2uau sn(4treoxfciotomDranei s  rxo(opoo4lleemnvils a2ururpot0olxomoeiatfmDra( s ()trxrmfcta1fmtrlneslt0t2trxopoudlleemncilt  rur(m ;u1opx  o3ias m eau pnt4tltnirciotoat  i o;() rtmxo iy1ll e ietl(  Drax  ou0opx if3iatlm ranvo u4altoircoadfmt lnei s teum(r3ou4op  lnctat  rrru onu1tlt  fciysla2uanmonu0 lerir oa1lpt  iei t) rtmxm oudlptnmnctlt) 2urx pou0oltnif3iyt s2umnvs (0 etrxf3iotoatrlu slt) 2xoio3nydomeelfvia( s2taumoou4oeto oeiytlsDrlu sn()arenxf3iytomtranes (0s2xmio3oydomenlfetls srra(mp;o1opx iiciad a rmnvo t)texoif3iatoptraueols) 2urio ou1lptelfei t) Drm(mp;t0texo fciad aDeanvp u) etoxf3todfaDeluesls) rtoir oy1optelneil(  rumurp;u1aptn f3ilsfa uluvpnt4alerxf3tadfmtrlnvils0s2uo(o3io4am emneil()sDtrxm ou4texomfcilsls2eanmp t4teeoir ootlp rau s s) exriopoo1amt livtatfartrxrooo0oeenmfeils s2ua(mo;() eeoir oatlm eln ols s2tr(rpno4optnlnet s)a2taurooo0opx  i3iasls ranvp;()arenxf3oatlp r neol()srumiopio1lmt  nesl( aDraxmoou4ale  fciltlaDumnmo () eeriociydlat au i;t sexmxo ny1oltemietasf Dumump;o4alxnmo3tydls2ua(vo;t0 lxnxfcoatfmD  n ilt0t2xoimpou1alen fesa( sDrrx oot0tex if3tad a rm( s u0aeenxr3iatlmD auvi s t2umirpny4al  mncsa(fa2trxmpnt1tleo icilsfm2el(msn(0arenxfciotoaD aivo;s)setmimpnu1openmnetlsfaDrrump;o4opxomo3tyd mDuanvpnt4arxnio3totlmDelueslt setmir nudope  fvs (f Dra(m nt1texnifeildfmDrln snt4altrxr tydlm rlivsls  rur(r3iydaptemivsl(fs2ua(  nu1aptnifeiysla rluvp (0 rerxfcoydfm ran olt setrir3oudlle mnctas  rrrum ;u0aexoii3iyt a2ran o;(0 rxoio ia1oa rai i s)t2tmxm oodlmenmnvtasf rtrxmpot1aeeoiicild m2uau sn(4trtoxf iodomt aivo t0 rxrxo oudalenmieil()sDta(mo;o1tle mi3iadfs2eluvo;()aleomoctatoat luvilt)srxo(m3iodoltn fctl()s2rm(mpou1teeo fctltla ulnvs;t)altoxr3tadlptrauvslt0t2xoir3iudapee nctasfartax pnu0opx  feiltfs uan p (4 reoxo3to1oaDeai s s)teum(rpnydol   fesltfartm( ono4oee ioeiatfsDeanmont4trtriocoo1op e u o (0 2uoxm iy4om  mfeslsf 2tmurpou4tpeo ocild aDulu p;(0arxrxf io1faDrlivils0trumxo3oo1lm nlivtat a2um(roou1oltnmfciat a2umnvsnt0aetniocoodlpt  nvo s  2umxm3oo1lp elfcsl( a2rauro;o1aee  fciadfmDrauvp;t) rtrio3iydfm elivs;t0srtoxr3iudop  lnviltfaDra(r no4tet mociyslmDua( p;t4trermr3iy1omD  nvo (0 exrir ou1lmeelfvsasfsDumxr nu4oee iiciysfm em(monu0tetnir3iatfpteluvs (0s2xo(opnudapt  fctltfaDtr( pou4tpeomf3taslmDean p;(4 rtnio3oodfp r ues ()sruo(o oo4ameemnctatf 2uaump;u4oex ifetys s2uaumpn(4arerxfctodfmD  ueilt)sexrxr3ny4ame mfvtas  Draurono1aptnmictydfmDeau o (4arenif3iy1faDeaneils)tetoir3nudop n feslt)aDra(moou1aleomiciyd s ranvo t0 exnmrcoadom eai ols) rtmxopou1optnlnvt s)srrmu poo0aet ii3ias a2emnvo;()alxnmrciotlmteanvi (  2xoxo nydap nlnvslt a2urumono1teeomietysfa umumonu) lxrmo3iydfmD luvi;t0s2umio3oo4openlfet sf ruru onu1tpe moetls aDemu o t4altomr iydlmte nvsls)texriopoudll elict s aDumxrpoo1apeomi3iad sDranvsn()teenio iatlpt ln i;s t2urxmpoo4lmtnmfcs s)srrm(rpnt1tex mi3iatfm ua(ms;t)teeomf3ia1lpDrli o s0seto(o3iudlme  ivia()srrrxronu0ole mfcilt m uan on() lerxr tatfp e uvs;s trtmxo iy1omeelietltf rta(rpot4apenifeiydfmDrluvp;()aexoir oytfpDeaieo s) rtmiopiy4op e nci ()aDrau p;u1tetnmfeiys mDemnmsn()tetoif ia1lat lieolt texr(r3ny4omeemiesl( aDrau p;o1apen o3tatla2ul( pn()aexrxrcoodfmDrluvols0s2trio3ny1apeelnes s)s2ra(mono0opxniocildfm ea(mp ()texoxo3iy1opt  ies ( trtoxo3oo4llt lfcias)srtrx pnu0olt mietlt s2uanms;() eenmo3tatlpt luvs t texmiopnu4al elict () Dtrur oo4oeenmieiysla ua( snu0tlxoio3oa1faD li olt)s2ur(o ou1lle mfeta(f 2ta(mont1alenio3ildfa2um(vs;(0alenxrcootlaD aneil( s2tr(r nudopt  ics s)srrrurooo4oetnmiciltlaDum( p u4tlenxf3totlmD ln o;s)srtoim3nydoptn ics t)arrax ont0ape  octltla rln pnt0 eenxrcty1oa  ai sls0setrir oydom elfciat a2rax  ;t1tlxnmicilsls2ea( o;u) rxrif3iydoatrlnvols)t2toxo3oudlpe lnvt sfsrtmxmo;o4oexnmo3ilt aDemu sn(4aeeniocootfa eli s;( seuo(o3ny4om   ncsl(  2rax o;t0tptoio3iltfa rmums u) eeomf3oo1optrlueo;s0teuo(r iodlmtelivilt  rtrx p;o4teto fciaslm2ulnmonu) lxoif ootop  auvi s0setmimpoy4opee ncs tf 2tr( ont4oetn i3ilsla ra(mo t4alxnxocoy1oa rlivils  2xr(m oo4amee nvia(f ruaum ;u4aetomfetyd a um(vs;(4teenmf3io1laDeau slt0srurirpoodlpeemies t)a2rmu p;u4aeeomo3ils aDuln onu0alxnio3ia1fm  ai il()setmxr ny1ole mfesl( srtm(ro;o0opt  icildla ean o u) rtnir3iytlpt  u s t0 etrxo3iu1lpenlnvsasf rumx pou1alenii3iatla rmump t4 rxnxocootfmDranvils t2xo(r3iy1openmfvtls arrm(r nu4tpt  feiltls2ra(vp;t0trtrio iy1om  lieo;s srxrio3no1lmeemfcs tfarraxmp;t1tpenmiciyslm umnvpnt0 lermo3oy1fpt  i s t0t2xm(m3iodom n iesas) Drrx  ;u1oeenifcils sDelumpnt0arxoiociatfpDeluvs;t  2umxo3iy4llt  ietl(fsDurxrooo1alxomf3tatlsDumnms;u0 lxrmf3oytopDeanvo t0 2triopnudaltemietlsfsDra(mp;o4apxnmfeiat a ra(mp;t4 rtnmf3oy1la  ln i s0 etmxm io4op  mnetasfarumurpnt1teeo f3tltlm2rmnmonu) etnxocoa1lm r u il() 2trxm no1ole lfeias)aDtaxm nt4tpenmoeildlaDrm(ms (0aexnmo3ia1om elieils srxmxo3ny4ole livs ()srurx p;u4aeen octlsfs2rlnmsnt)artrio3iydfptrlieo;t)trxoirpoydal nmfvtasfa2trumo;u4optoifciadlm um(vs u) eeoifcta1latean s ()s2tmxo nu4apt  icsltfaDtru oou0apt  i3tltfm rm(mo;u4 rerxrcio1lmtrlues s)teumxo3oy4am nmnci ()sDtrxmpnt4oleo o3iltlaDrl( o (4 lerxf3oy1la ean sl()srxmio io4opte icsltf Dtrx o;o0ole ifciytls emnvp (4aleoxo oa1omDe neo s0 2xmirpnydlleemfcil() rtm(rp;o1oet if3tyt a emu s;u0altniociy1fmt auvols0s2um(o3oy4alen nctl()s2rmur ;o1tptn octadfmDemnvp u0trenif3tytfpD lnvi;(0 2xmxrpiodol  lnctl(  Dumuroot1tet mo3ils a rlumo u4tltrxo3io1opDe ueo t0tetmxo no4oltelicil(  Drr(rpot0oltnio3iltfs umump (0texomrctydlm   ivils0s2toir3iy1lltelfcilt sDrax o;t0teenifcild m rluvsnu0 eerxr tatlp ran sls tetmio3io4lm n ict s)sDuaurpnu4apeo oetyt sDelump u)aleoir oo1oat  uei () rurxr3ou4opte fcsatfs2ur( ooo4opx if3ildlm em(vs;u4 lerif to1fa  anei s s2ur(m3no1aptn ics (fsDrrxrooo1oex mociysls2rm(vsnu4trxrirctydoat  n s s0trxrio3ou4om eliet tf rta(rpou0tle mi3tad s2eanvo;t0treoxoctytoat  neol( teuoiopny1amtnlietasfs2uax  ou4tpt  feiasla ea(vpnu)aeenir3iy1op  auvolt)srurxo iodol nmnctl(  ruax p;o0tlx micilsfmDrluvonu0artomo3iytlatraueo;s0t2trxmpio1op emieslt  2umuro;u4oltnifciatfs2uaums t0arerifcoadfpD  nei;(  ruo(mpnu1ll  lnesl(f Dtm(  nu4tpxomocias a uauvo () ltnxf ta1fmD  nvo t)teuoxr oy1al elivt s) 2tmu pou1oeeoifetytlm2ra( s t)tetnxr3todfmtr ies;s0 2tm(r3nydop  liciltfa2rmuro;t4tlxniocilt s em(vo;()trxrmr3oo1lmDe nvi t setmim3iy1optnlfcils) rtm(r ou4tpxn iciysls el(ms u4 rtomo iytlm rliesl(0t2toxr ny1ll nlfcsl() 2rmx  ;o1alxnmi3iysfm ranvp;u)tetoxo to1om rlnvi;() rxo(r3iy1omeemfvtlt  2tm(rp;u4oeenifeiaslmDeau snt0 lxnir3iotomt li o t)s2uo(opio1ameelfvi ( sDrau p;u1texomf3iltlmDran s () ltoirciydlp  aies;s0texmimpoydlptemiciasf rra(rp;o4tetniieilsfa2eanms;u4altrmo3to1lpDelieo s0seurir ou1apen nvta()sDuau  ;o0olt if3tys m rm(vpnu4 lxnmoctadoat  nesls0sexmir3ou4oltemfeia(fa2rrx  ot4aptoioetltlsDumuvont0trtomf3to1la  li olt0t2xoxo oo4lme lfcils)arumxrpnt0apxnmfetysfaDrm( sn()texnxrciodlmtrlu s;t)tetrir iu1ome mict (  Drrx pnu4aex mi3tysfa ul(mont) rtnir3oadfat an ils0srxrimpiydal  lies s s2rrxrpnt1alx  octysls umnvpn()aetnmr3iy1fm   n i;s  rxm(m3io1llenmfeslt) rtru ooo1ape mieiytfa emumonu) etrir3tadfaDraivi;s0tetrxm3iy4olen nvs ( arrr(mo;o1aptomicilsls2rau p;t)texomociadopDrai o;(  eurimpio4lp e fei (fs2tr(rpou1tetoiictatlm rmuvpnu)tlerxf3totfat  uei;t0t2tr(r nydlptnmnci (  rtauroou1teeoif3iltlaDulump;u)teerxr3oodfpD aivi;t0 2xmim3ou4aptnlfei s  Dtmu  ;t4tee  fciatfa ea(mo;u4 leoxfcoy1omDr neslt setoimpio4apte fes (fsrrmu p;t0ale ioeild aDeanms t4areniocoy1oat  u s;t0srurimpnydamtnmfctasfs2tmxm ;t4altniociysla2uanms;u4tltnmocia1laDrau s t trxoxo3ou4omenmncs t  Dua(r nu4tlx  fciyslaDrmums;()artrmf3todfp elies;s)s2xoxo3nudlpee nei t aDua(mo;o0apxnifetls a2ulu p;u0aetomf3iy1fpt aueo;t teumxr3nu1ll n ictatf Draxr no4tetoif3ilsfaDrmuvs;t)treoxrctotfmD lu sls) 2uoiopiy1lmenmfvtlsfaDrrurpno4optoifeiydfm2emnvo (4arxrxo3iydla e ieo s  rxoim3oy1am   fei s) ruaurpoo0oltomociydlaDumnmp t0artnxf3iodopDraiei;t)t2to(opoo1llenmnei t) Dtr(  ou4aptomfctls mDrm(msn(4 exrxf tatoateaieo t0s2toxm3no4amtelnct s a2uaxr nt0aet  icild a ea(mp u4arxoxr3iotfp eliei s)teto(r iy1lme lnci s)srta(monu1aetn feiat mDeanvo;t0 reomo3totomtr nes;s0 2um(o3ou4olenmfvils  2rmumono1apeoifciadla2ea( s;u0trenif3tytop elnvi;()s2uoim3oo4ope  ieta(fartaumo;u0alxnioeiad a uauvpnt0 ltrxr iy1opDe nvils teuo(m3iy1op nmnvtatf Durx o;o0texo fciytlaDeln pn(0arerxo3iydlpt aivols) 2tr(m iodlmeemfci (  2um(moot4apt mociytlaDea( o t0tlenxf3iodfm e ieo s  rxr(o3ou4olee fvs sf rrrx  ou0olx if3ildfsDelums;()artomf iodlpt  uvo (0tetrxm3io1ame  nvi t  rrrxmo;o1tee mi3iys s rl(ms t4tetomfcoy1oaDraneo (0srtr(m iu4opt miviasfaDum( o;o1optn f3iadfs2rauvs (0tlxrxr oatfaD lnvo (0teuo(o iu1optemnvs ( s2rm(m ;u4tpeo fcilt a ean on(4 ltrmr iytlpt li il(0trto(r3oodlme mfeilt  Dur(monu4tptoiociaslsDum(vonu)teeoxr3oatfpt au i t0setrim iudol elnet ( aDrru  ;o0tlt ioeiat sDulnvo;t0tlermfcoydlpDrlnes ()srxoim3nu1lm elfesa( a2rr(mont4tpxomieiltls2ra( ont0aetrxocto1opteai s s sexo(mpiy4ol emieil()aDrmxrpnu4tee  fctls a2umumonu)tlxomr3ty1lat lieils  exrxm nu4lmtnlicias)a2trx o;t0oeeoioeiltfm rmn pnt0 ltnif3tadlmtr n olt  2xoim ny1oltelnct t  Duaurp;t1aexomf3tatls2ran p u)tltniocia1fmDean s t0 rxoim3no1om n nes (fsDrru oot4aetniictldfm uan sn(0aetrxf3tydopte uvs ()setmxrpiudalen fvtasf 2rrurono0opxomo3tldfsDulnmonu0trtrmf oodoaDrli i s0 eumxm nodop  mneslt sruaxr nu1olenmf3ils aDrln s;(4aetrxf tydopD  ueo t) ruoxopiy4ol elivtls arrau  nt4tlenmicils mDea(msnt)texnmr to1fa ran s t t2umxr3oo1omenlict t) Dumumpou1apxn ieiatlm rlumo u0tlxnmf3iadop eanvi t  ruoxm3nodole  nct sfsrrrxro;o1tle  o3tltls2emnmsnu4arxoxo3iy1lmte ieo s trurxopou1apt mneta(faDum(r nt4ale io3iysla2ua(mp t4alxoxrcoatlate i s t0 2trir iy4optnmivsl( artmumo;t1aetoioeiadlsDrmuvsn()artnmr oa1lp rauvo;t)teurxmpiydol e fvsas)sDtmur no0ale mfctlsfm2uan onu0alxomr to1lp e neolt  etoxr3oy1am emfvta()sDrr(m ;u4opxoioeilt sDuln s u) lerxf3iydlm r neils0srtoxr io4lme mfciasf 2umumpnu4oetoiiciydfaDrl(mo;(0 lxomrctydom rlies t) rtriopno1ame  ieilt)srtau o;o4tleo o3tlt sDulnmo t0tlenmr to1fpDe u o s0 2tmiopiodom e ictas a2urxm nu4opt  o3tytfmDrmnmp;u) exrmfcoadoa eauei () rtrxr oy4lltelnesl(fs2rrx  ;o4alxn o3tydlaDuluvonu) rxoxf3to1faD  ivi;(0tetr(o oy4lmeemncils) rraum nu4oltoif3ils m2um(mo (0 etnir3io1oaD lnei;s t2trio iy1am  mivtlsf Drmurono1ole mieiyslmDul(ms (0arxnxr oy1la eluvo;() 2umxr3iydam nlncsls) rumu poo4apeomieiad mDeau pnt4aetomrcoo1fm elivo t  2uoir no1lp n fci s  2tmxmo;o4tlxoioetasfmDrmumont)tetrmf3oatlpD  i s s0 eumio3nodal nlivta(  2rmxr ou4olx ioetasls2umnvpn()teerir io1fa ranvs () rxoir3no4aptelfvslsfaDtm(mo;o1aeeomi3iytlm emnvs u4tleoxfcoadomD anvi;s)s2um(m nu1optnmicsl(fa2rau  ;u0oeeoii3iydlmDemumpn() rerir oo1omD aues s s2xriopou4am emfcs sfsDur(ro;t0aee  ictas mDranvp;(4 rxrif3tadopteanvi s0 2trxmpoydoltn ictlsf 2uau oou0tlx ifeiatfs rmnvs;u0aexnif3tatoptrln i;s)t2uo(r3iodam nlivi tfa2rrum no0tpe  fctltfa ranvsn() exoxf3iodlat ai o;( trtmirpoo4ameelici s arraxro;u0teenioctad m emu onu0tlxomfcoadfatr nvo t srtoxm io4ap elivtat  2ta(  ot1aexn i3tyt a rln s u4 exrxf iotoptrai o ()trtrirpiu4openlics s  rtrxm ;t0tlx  i3ildlsDua(vpnu4alxoxrcoytlaDe ivs;(0s2urxmpou1lle  nes ()a2rrxrpoo0tptnii3tys m elumo;u0trerircoodom eai o;( truoir oudale mnvi t  2rm(rooo4texniietldls2uln s ()aeenifcoa1lmteanvs t teto(rpoo4omee iei (fs2rmxm nu1oleo fctytfaDraumont4trtnmo ty1laD aiei;(  2toimpoudalt mnvsa(f rtmxrpoo0ope iietldls rl( p;t) lenmfcio1opD ai s;s s2umxm3oudom e ietls sDra(rp;o0olt  o3iatfsDua(mp ()tetrxfciy1fa  lu i;s0trur(o3no4lm nmfvsl() 2uaxrp;t0oex  feilt a2ranms u4tetomfciatfmDelneols0srxr(m3oodamee fcs s  Duaxmo;u0apeomiciyt s2uauvsnu0teerxo3ia1fmDrln i s) 2ur(o iu4lm  liet sf rtmumpnt0texnmf3iatfaDelnmpn(0alerif iadlpt  u s;t srxmimpnodopeemnesl(fsrrm(mo;t1apxoif3tatfaDrmumsnt4aetoxo ta1lmDr nvi s) exoxr3ny4lp  lnetls) 2rr(  nt4tptn i3iydfs2rmn s;()aexoxrciytla  lies ( sruo(o oy1opt lfciat)a2rru ono1apxomocilsla2rlu o;u)artnir3to1lpDelnes s)seum(r ou4omeelieil(faDrau onu0apeomieiytls2um(mont)aeerio iy1fmDrlneslt0tetrim ny4ameemict ( artm(roou1oleo fetlt aDranms u)tlxnir3ia1fm eli ol( s2to(rpoodllt lieil()s2tau  ;t4optoiociys s2uln snt0texrmoctydop  anei () 2xoxo nu4al e nei tf Drm(mpnt1tle mfeild sDeauvs;t4aetoio3io1lm r ivs t  eurio3io1alt mivi ()sDtrur ;o0apenmoctas m ua( o;u)areoiociodomDrlivslt  rxmim3iu4ome  feiasf 2tau  ;o4apeo o3tldfaDrlu onu0trxomr3iadfpDrlnvi s  2tmxo oy4omt lfeiatfs2raur ot4oee  ieiyd aDul(mo;() rtnmo tytoaD aivsls)t2xmimpiu4ome lfcta(f 2tr(moot1tetomocildla rlnvpn(0 leomo3io1lpt anvs;()srxrxo3iodlp n netlsf rtm(  ;u4ale moeiltls2ua( sn() lerxo3oodoaD au o t0teur(m3oy4omee ieias)s2urum nu1apx mi3iat mDum(mp ()tetoifciodfp   nvi;()tetm(rpiu1lmeemietas) 2rau pot1oltn ieilt s2ea(vsnt)tlxoxr3totoaD au ol() rtr(o3nudale lnetls) rta(  ;u0oetomoeils m umnvp u)aleoxr3iatfa eanei;s srxrxrpoydolt lfcta(f 2rr(mpoo4aeto iciys m2uln on()teermo iy1lptrlivo (  2uoim iy1olte ieslt srra(mpno1opxn o3tydlsDean o;(4 rtomf3iydom rlu s t texmirpno4ameemfesa( sDurxrpnt4teto feilt m uau pnu4 rxrmo tadop   n s;t seur(r oy4amt mivtat  rua(ro;t4olxoiocildfa2ulu s;u)alxnxf3oydfa r u o;( trxoxm3nydoltemiesa( artaurp;o4oeeoio3ild a rmumo;t0 lenio3io1om   nei;s0texrirpoy4ome lfctasfarumxrpnt0olxniieildfm2rmnvonu4arxoxf3io1lateauvsl(  ruoio iu1lp  lnetls)artmxm ou0apeo ictltfm2uanvsnu0teeomfctatom  aivsl( srtrimpoo1omtnlfeils)aDur(  oo1tee  ieiat aDrmums;(4 rerifctotlaDrluesls0srxm(opoudamtelfcslsfaDrmurpou1tpto f3iytfa eluvsnu0aleoio3to1fmD lneo;s)t2urir oodlpe mfes s  2rruroou4tetnii3tys mDea(vp;(4arenxo iydlmteln s;t0srumirpoo1omt mfvtlt  Dur(mpoo1texnmi3tldfs rm( sn()arxrxrcootopD liesl()srxm(o3oy4amt mnviatfsrtr(rono1aexn ieilsfsDul(vs (4 rxnxoctatlmDe ivslt)s2xoxm3oodape livt ()a2taurpot4aetomo3tlsfm rauvo;(0altrio oatom  auvils)s2umxr oo4lm  lfei sf rtaxro;o1olt mfctltfsDel(vp (4 ltnxo3iodla e nvi ()t2umirpoy1oltnlietltfs2um(r nu1olxoifetad s2emn o u4 exoxoctydfmDrlivilt0 etm(m3ny4apen fet ()s2um(mono4aleo f3ild s rl(vp u)tetomo tatfmtrli olt0 rurxm3no4apeelneias sDumxm ou1tetoifciadlm2rmn p u4 rtnifcootlmDrlnei;t  etoio oudom  mncsltf rrr(mpou1tle  i3iysfm2uauvo;(4tlxnmo ootlmDeanei t)tetrxm3iodol   ivia(fs2rm(m ;u1apx iociaslmDrauvont0aetnxo3oo1latean il()trtrxo3oo4aleemfet ( sDtm(mo;u4optomociysfs2ea(vo;t0 ltrio iytlatr nes (  2xmxmpiu1ole  ivi ()a2tm(rp;o0texomictas a el(vs (4 eenir3iatlp eluvi;s0 eur(o oo1ope  ncia( s2uax p;u0teenifcilsfm2rln pn() ltrir3oa1oateanes s0sexoimpno1opt mnci t) rur(m nt4alt mietasfaDrluvo (4trtriocoadoateli i (0seuriopoy4lm n ivslsf Dtm( o;o0oetnmocilt m2eanvp t) rxnifciodoatrlu i s)srum(o ny4lmtelnvia( a2trx o;u4teto oeiysls uan s t0trermf todlmteauvsls) 2urirpiudamenlnviat)aDrrump;t1apx  i3tlsfa ua(vp;u4tetrmfcoa1omt  ieols0s2to(o ou4alenlfctas  2ta(r ou0apeomfcildfmDeanvp u)trtomr oytla e u olt0 rur(mpnu4ame mncil()sDtmxm ;u4tpen octyslm2eln onu4aetrmo3oytla r n o;s) etoio3ou4am  mfcs t)a2rrum ;u4tle  ociadfaDuauvo ()aeeoxf io1fp   ieo () 2tmxmpou4omenliciltfsDuru pno1ope ifeild aDrmums;(0trtoif3tytfaDe ivs;t)t2xrim3iy4lp n ivsltfs2ta(rooo0oetomfciltfa ua(mont4 lxnir oatomte uei s  2toxm3ou4om emicsls) rtrx onu4tlt iiciasla2elu o (4 exoxf3io1opt lu s;s)texoxmpiu4lm nlncsl(fsrrmx pno4ale mfeiasfs el( o u0 lenif3iy1opDeliei;t0texmxm ou4lm nlieta(  2rrxmpoo1apxo ictld s rau pnt4 eeoif tytfpD aivilt)srxmxr nudll  lnei s)arua(r no1apxoioetyd a2rm( p u4arxrifciotfmD  u s;()s2uoxm oy1amt lfesl(f Durxm nt4open f3iatfaDrau ont)aexoio tytlmD lieils0trtoimpno1amtnlfet sfaDurumono4aexomieildfsDeluvsnt4 lenmo iy1opt lueo (0trtrio3nodopt livtl()arumurpou0texnmfetyslm el(vont)trenxr3iotlpD lnes s)teurxmpiydlmeelivta(f rumurooo1tpt mi3iydlaDemu sn(0alxnio3iy1opDelivo;(0s2ur(r iu1altnmncs (faDurxrp;u4tlxo iciydlm2umnvs;t4arxomfctytlp rluei;s s2tr(m nu4llen ici s) Drmxm no1oeeomociatls uau snt)arerxrcoydfmD anvo;t)t2umxm3nudapenmnct t)aDua(mpoo4tpxomoeiat sDrlnvo t4trxoircoy1faD luvi;s) euoio oodope  fcslsfs2umur ;o0tptoiietldfsDel( onu4 reoiocoatopte nvo s teuoxm3ny1op nmnvt tf 2rm(rpot0oleo i3tlsls ra(vsnu0 lxrmrciodomtr uvo;s0 eumiopiydomt miesl()srtruro;o4oetomfeiys m el( o;(0aleoxociadop rlnvilt  rtr(rpou1altelivtl(f 2ururooo0apx iicilsfa2emnvsnt4 exnmr totoa e ueo t0 euo(opoo4oltnmiviat)a2ua(monu1oetoioeils aDran pnu) lxnio3oa1opt livs s  exmxopny1lpenmfvias)s2ua(mo;u4tpx mf3iyslm2emnvpn(4arxnmrcoytoateau sl(0trtoir3iydlpe micilsfsDrr(  no1aeto ieias s2ul(msnt0teeomf3oy1fp rlivs s)srtr(r3oudlm e nctls)aDuax p;u1aex  icilt a rm( pnu) lenircoa1faD  i i;( trum(rpny4am nmnvsa( s2urxmp;u4texomfctatfm2umnmo ()trenmr3oy1om ran o;t trto(opiudllt lnesl() 2rrx  ot0tltn f3ildfsDemn o (0trxrmf oytlmteaiesl(0s2xoxmpnydope mfeta() rtr(ro;o4ape io3ias m ranvsn()texoio3oo1lpD ai s s seuo(m3iu1oltn ivsl(f 2umxr nt0oeenmfctys s rm( s;(4aeenmf oadfatrauvi t)srtmiopiu4lmtemici s)arrmuroot0tpx if3ias s ulnvp;u) rxnmfcoydop rau s;s0texmxo3oydlm elfcil() 2trumpnt1aexnioeiltfs ulu ont)aexoircio1lmDe ieo;s0srtrxopnydlpte nes (fs2tru pnu4oet mfctad a2uln s;u4 eenmf oydop  li s ( setrir nu4ll nmieiasfsDtr(rp;t0alxoii3iad m2rl( o u)trenxf iytlm eauvolt0 rurirpiy4om nmivias)sDra( oou4oltnmocildfmDrlumsn(0tleoif3ta1fmD an i;s  2xrxmpio4optn fet s sDrm(m oo1oexo oeiytfa2ea(mo t4treomrcoydopD  u sl()srtoxopny4optelneia()aDurxrpou1tpe moctldfs2ea(mp u)aexrxrcoadfat anvs (0 rtm(opnu4openlfcils)srur(r nt0alenmicias sDem( p t4 lxrio iytoa   ieo;( seur(r nu1op nmfvta()srrr(rpoo1tlt ioeilsfaDrm(ms u0teeoifcoadfmt  n s;t teumimpnu1am elietas s2rrx oou1opx mictlsls ulnmsn(4 reomo3to1la elieo s0trtmxo3nudlmtnmneilsf 2tau  nu4texnii3iad s eauvonu0aexnif iadfatrliei;s trtm(m no4llt lnvsasfa2tm( oou1olx mieiadlsDrmnvp t4altrio3oadfmDean ilt seumxm oodom  mncsasfsDrmxrpot0oexnioeilsfs um(vp;u4tetrmo tydfm   nei;s t2xm(r oy1lmteliviatfarrmxm nt0olenmoetld m2uln onu4 lenir oytopD  ueslt t2tm(opoo1altnlict tf Dua(mpno4oeeo ociydla emuvo u0arxrxr3oatlpDe nvil(0srurio oy1al  mivsa(faDra(r oo1ole  fciaslm2ranmpnt4artnxf iytlptr nvs;t)tetrxr io4al  mneiat  Draumpnu0apxnmi3tls mDrm(vo (4 rxnxociytlpDr ieo s0 2xo(r io1aptemivslt)a2trxmpot0tpx  i3iyt s rlu snt)tlenirctodopt  uvi (  2tm(opoo1op   fet s sDtrxmp;u4opeo i3tadfs2ra(mo t)altrmr3oadoateln i s trxmxr3iydomtemfesat)sDtrurpou0oeeo o3iys s2em( p t0 rtrxocty1fptrlnvo;( srurxopnudll nlnctat)a2rru  ou0opt mf3tatfmDemu pn(4trtoir3ty1oaD auvil(  exrxopny4amtelictlt) rra(m nt0tlx mfciyd s2eanvsnu0arenircoodop r nvs t  2xmxr3io4omtnliesat arraxmo;u4teenioetydla rlump u)aexoir3oo1latraneo ()tetrxr3nu4lp  mfctat) 2umx  nt4oee io3tadfmDrln on(0tetnmo3iytlmDrluvs;( teuoio3ny1ome  nvtat aruauro;t1tee if3tlt aDemnmo () lxrio io1omtr ieils0s2xrim3oy4lleemfetasf Dtmx pno4olxo f3iasfm2umn pnu4teermrciotoptrln slt)setmxmpnydop nmfciasfartm(r nu4tlen fetyslaDua(msn()tetnif ia1omDrlnvols)srurxm iodapt  ivsasfs2tau oou0aptoioeilsfaDeanvo t)aeenxocoa1omtranvilt0tetoxo io4ale  ictas) rrrxmo;o0aptnii3iad mDea(ms;t0teeoio3oytoateai ils teto(rpoo1amt liet tfarur( ooo4apxo ieiydfa eluvs;()tlxomfciatomte nvslt) exoxm3oydopen feilsfaDtaumpno1aeeomf3iaslmDrm(vo t0aeeomo iadoaD anei s seur(r nudop nmfetlsfartaxmpno1tpe  ieiysfaDem(vo t4 lenmr3tatlmDelneo;(0 2urio nodop nlfvt s sDuaxrp;u1altoio3iys aDrlu s t4 exoxf oo1optrauvilt) euoxmpiy1aleemics t) Draum ;o1oex mf3tls s2emnvs;t0tlxrxf3todfaDr ueolt srumir3io4amenmfetl()s2taxmpno1aexomictydfa uauvs (0trxnxfciytfp elivils setoxo3ny4apeemivi (fa2ra(  ;u0aet mieiatfm2uanmo (0alxoxocoo1oa eli ol() exoxo3ou1amtnlneils)aDrmx o;t0apx mfetatfmDuanvs t4arerio iytlat livs;t0tetmxo ny1lpenmfesl(faDuau pnt1tpt mi3iatlm2em( p;(4teerxr oydomt  uvo s)trtoxo iy1ol   fcil(  Dtrumpno4opt  oeiys s eluvo;() lerxfciadlp r i o (0srxrxm3oy4am n nesat)sDraxmpou0ape mi3ildfsDuan o;u) rtoiociatomD lnvolt0s2urxr ou1ll e fvil(f 2umump;t4aptn i3ilslaDrl(ms;t4aexrircoodopDrauvi s  ruo(rpoo1lltelnvias  2raum ot4apenmictat m emnvs;()trenmfcoatfm elu s;()t2toxopio4alee ivils  rum(r nu1teeomf3tyd a2eauvpnt4 rtnxo tatla  li il(0 rtr(r3io1open neil(farra(m no0olto f3iyt a umuvo;(0texrmf oytlaDeluvs s) rxrxm3ny4lptemfesa( aDrax o;t4apenmoctat s eanmp () eeoircoytfmtran s s)s2umxo3iu4oltnlfvil() rraxro;u1opeo fctat a rm( o (4alermo oytfa raneo;s)teumxr ny4lp e nes (f 2uax  no4ope mfctatfa2umnvon(0arxoio3oy1fm rauvsl( seumxr iy4ol   fciat)arrmxmp;t0olt  i3iltfs2rmn pn() ltnmf3iy1omDe u ils t2tmxrpiodomtnlnvsl()a2rau pou1tpenioeils m2rmnmo t4altnifcio1opt  n i t t2um(r iydll  lies ()s2tr(mo;t1altnifciytlaDrl(vp;t) exomf oadfm rauvils)srto(rpno4alt lfviasfs2ururooo1altomiciatla2el(vo (0tlxoifctodlp rlnes t0 exmiopou1omtn feslt)sDua(m no4opx  octydls2em( p;(0 etrmf3oy1fp rluvi;t)s2um(r3nydomtelnvs t  2rru ont1aeenmfciatlm2um( snu)trxrmo3tatfmDr uvo s srurxo io4om  lnetat arrrxmp;t1altoioeiaslsDumnmo;t) rtoxf3iodoa elies t0 rxoir3oudal elivt sfa2rm(r nt1texomi3tatfa ranms t)texoxo3oy1fatelivo (0seto(r3oudlp nlncilsf Dur(  oo0opeomo3iasls rluvo;t4 etomr3to1latelnvo s)trtoir3oy4om nliei s)sDuaumpnt0apeo f3ilslaDrmuvs;t) ltnir oytlpt li i t0 rxmxr iydal  lnesas)a2rr(rooo4olxo f3tys s el( pnt4texoxf3iytomDeauei t)trtrxrpou4oltnlfcs t) Dta(mont0alt  ietlslaDrmumo ()aexomf3oydlpD  n olt)tetoir3nudlmtemfes () rta(  nu4tet  i3iysla eaump t)alenmf3oy1lmDe n i;t0trxrxr3oo1ll nliesa(faDuaur nt1tlx io3iasla emums;() rxrmfcoytlm   i olt trxr(o no4ol  lfvta( a2tm( onu1aee mocilslmDel( o;u0tlxrmo oytla raieilt)s2xoiopoy4omenmnet tf rta(  ;u0tpt mf3iltfaDrauvp;()alerxo3tatopt li sls  rxm(m3nu1ameemiei s a2rmxrpno0tpto ietytlm uanvsnu4 ltrio ta1oaD ai i;s)t2trir3no1am emivtl(fs2tru ooo1apx io3tysfs2em( s;(4aexrxocia1fatelieo ()trumxr3ou4am   ies s)aDrmx p;o0aeeo i3iysls2rmu o;u) eerxf3iydopDeanvils) 2xrxm3ny1al nlivtl(fsDtr(  ;t1tetnmi3iys mDea(mo;()teenmfcoadfp rlnei s  exm(m iy1opeemnvils a2ra(  no4opxoio3iaslm2ua(vs;t4tltnmrcia1fmt aueolt) ruo(r3nudolte netasfsrtm(r ot1apx mietad sDuan sn(4tetoxo iytlmDeli o;s sexo(rpoudlp nlietat)s2trxr ;u0aexomo3tls sDumumsnu4 ltrmocoo1lptelu sls0setrio iy1lmeelneta(  rtru pot0tleo f3iydla2ul(vsn(0 eenmr3io1laDeaneo;t setoirpnu4lpt lnvs ( artm(rp;t4oee mictytfa2rl(mpn(0areriocia1oatr n i;s sexmxrpnodlpt  icilt arum(  ;u1tptomi3iydfmDraums (4teermrcto1laDrauvs;t0t2xoim oodlltemncilt aDta(r nt1aleomfeias mDulu s u) eenir tydlaD au i;s)tetm(r nodll elici s srra( o;t0opt if3iysfaDemu o t4tleoxr3totla elu i ()t2tr(m3iudom  livt ()srtaxm ;u4apeoioeiat sDumnmo;t)altrmfcoo1lmD aueo;(0 euoxo iydlp elfet s)sDtmurpno0tee iiciysfa uau s () exomo3tatlmt  ivs;()seurio3ou1lltn ivt (fsrurxroot4tlx mi3iysfs2el(vsn(0alxomf3oa1faDrli i () etoxmpnudlpe licsasfaDrrum oo4olx iictad m2rmnmon(0 lerio tytlateai o;s0srtrxm3oy1ap e nctlsfa2umxmpoo1tptn o3iltlsDeaums u4alxoioctotom  ai i s) exmxrpnydapt  fes (farrm(mo;o1oltnii3iatfs rl(vp ()teerxr oydfmt  ueslt t2toxr no1open ics tfa2tm( poo1tet  feiad a ulnvp;u4 etoir3tadoptraivils tetr(mpio4lm  mict (f Dtmxm ;o4alxn ietasfm uan o;u4 lxriociotfm  lnesls)trtmio oy4am emictls srtrum nu4tpx ifetldfm rm(mp;u4 eerxoctotlmtraivo;t  rtm(o3ou1omt  icsls  Duauro;o0oexnmoeiydlaDrl( o t4 etnxo io1om  luvilt0 2uo(mpou1ope licslt s2ua( o;o0ope io3iys s umnmont) rerifctytlpDe nes s  rtmir oudomt mfctl(  Dumxmo;u1oee mf3iltfaDul( ont) exnxf io1opDr ueo t)tetmxrpnu1ll  mfcslt  Dra(rpoo4texnmoeiytfsDrluvs;t0tltomociytlmD aneo ()t2xoir3iudoptnlictl( srraxroot0ope  oeiytls2rmn on(0 exrio oadoa rluvo (0srtoxm3oudlmtnmics s s2urxm ;o1olenmo3iyslm2el(ms t0 reoif iydfp e nvo;t srxr(m3nodapenlnvs t)sDta(mooo1tpx  i3iyslm um( s t4 etoif3ootla e iei;s)trurim nydlpe  fet () rtaxm nt1tlen iciad mDelnmont4 eenif3io1fm   ivols s2xmxo no4lm elncsa()sDuaurpot0altnmo3tytlaDua(vp;(4texrirctodlpt luei;( srumxr3ny4amt mfcsa( aDtr( ono1altoio3ias mDrlnvo ()teerir tatlpDrau o ()sexrxmpnodom n ivta( aDtr( p;t0oet mf3tltla2uaump;u4altoxo iy1lmt lieolt0srxrxo3oy1lmeemncia(faDtmxmoou4ape ifeiys m2rmnvp t)aetoxrctotlp  aivo;t0s2tmxm3iydolt  fcs ( sDrr( p;t1oexo ociaslaDean p (0 etrxr3oytlate neols0 rum(o3oodomtn icta()arraumpnu0altoifeiasfs2eauvp;u4 ltrirciy1omD  i i s0t2umxm io1ll nmfctls)arurx ont4alxnmoeildls ulnmo;u0altrmfciotlptran o;( tetoiopnudlp elicias) Dra(  nu4alt mieiytfm2ea(mp () etrio3tadlatelivs;t)srtoirpio1op nlfetatfaDta(m ;u4openii3iadfa rmump;u) lenxfcootfmt aneol() rtmxr3nydom n nvsas)s2tmu  ;t0olxn fcildfm uln s;t)tltrmr3ta1om eai ils  2to(m3io1al elnvtl(fa2trx oou1opxo oeiysfm2rl(vonu0 renmrciytopteanei;t srtr(m oudame mnet tfaDuaxroou4tlt mf3iadfs umumont0tlxnxo iytomDrlieilt srxrim3io1ap emfcia()arta(ront4oeeomoetydlaDrm(vp;t4aexoir ia1lm eaneol(  2xm(r oudlme lncs sf ruauroot0altnmf3iyt m uluvo;u0texnmoctodomD aneo;s) ruoxm iydoptelnvsasfaDtrumpnu0alt mieiytlaDulump;t0 exoxr ootfat  uvils0 2tmio3ny1op nmfvtl()sDrrxr ou4tlt  ieiadfm2ea(mpnt4 etoxocoa1fm r nvslt0srxoimpio1openlivt tfs2urxroot4teen iciydlm eluvpnt0alenxr3ty1fatrauvs;(0 2to(o3nu1oltelncsl() rum(mpnu0open f3tasfa2rmumo;u) rxniociatfat lnvi;s)trxm(m3oo1altemfesltf ruaxm nu4opto iciys m rlnvpnt4alxrmoctotoa ean ols0s2xrxrpoydoptemfvtl() Drru o;t0oltnio3iytfm uaumpnu4tltnxo ta1fmt  n o ()seumir iu4ale lfct t)s2taumoot0apxomieiydlaDumu onu0aeenxrcoa1opte ivs s0 rtmxr oy4lm e fvs t  rrmumo;t0texnmieiasfm2em(mp u0aeerio iytlmDe nvs (  2tmxo3iodolt mfcsas sDtrxrpnt1altnmo3tysfmDem(ms;(0 etoio iodfmtran ol() 2xm(o3oydllt  neiat)sDtrxrp;t4opx moeiltlaDrmu p u0alenmf3totopDeaivi;t) 2umirpoo4omtelfviltfsDtr(mp;t1tetnmi3ildls rm(mo;u0 renir3ootlate ues;(0t2xr(m3oy4lp elfcsa(fs2tr( o;t0ope  fciadfa2emnmpnu4 reoif ia1oa  aueilt setr(rpny1op n ietls) rtaum no4aptomfeilsfs rau snu)trtoxocoa1fm rlnvi;() rurxo nodap e fes s)aDrrxmpoo1apenmfctatfs ea( p;t4trxniocto1laD anvs s0texrxr3nodlp nlicsas  Dtr( onu4oet iictyt aDea(vs;t)texrxo3ty1fm e ueo t t2uo(o oydolenmncils sDua( ono4oetoioeiysla2ra(mp;()arxomocoatomtrlivs;(  rxrxm iudomeemiei ( srumu  ;u1oee iociat sDrauvo t4texrir tadla   ueo;() euoxo3iu1lme mfvias a2ur(mpnt1aex  iciys m emuvpnt4 lenxo3oy1omtrauvol(0srxm(o3ny4ol  mieia( a2ra(r nt0aeenmo3ias m elumpn()altrxf3totfpDeauvo s0seum(mpou1apeelicias)aDrr(mpot1oet moeilsfs2rau s (4 eenmr io1fp elneo s  rxr(r3io4openlnvtl() Drmx o;o0oet iieildlm uauvpnt)tleomo3ootom e ivslt  2ur(o nu1llen feilt  2tax pou4aexoif3tltlaDraumsn()aeerxo iodomtrau o;s) rxm(r3oydamtnlfesa(fa2truro;o4apeniieildfs umnmo;()alxomrciytlmteaieo;()t2tr(mpou4lmee fesatfartr(mo;t0apxomoeiatls elnms (0tetoxrcoo1fa r uvol( truoxr3nudlp  mfesltfsDrr( oot4teeoiictadfs rm(vs;u0tlxnmf tatlp  aivi t  eurxmpiu4ame mfet t srraxm ;t1oexo i3ilslaDelu o;t0 ltnifcoatfa raivo s0 euo(opnu1am elies (f 2urum oo4tleoioetatlaDum( s;u4 etomo3ta1fmDrliei s0t2xmio3no4open ivsa( aDrrur nt4opxnmoeilsfs2ul(msnt0aexnmocto1omDe i o (0t2tm(m3oy1lmtnlivia()a2urx ont0olx ifeiyd sDrmuvo u0aeeoxr oytomt  ueol( s2xo(r no4alen fvtls srraur nt4tpxnmf3iatlsDrlnmont4 rxnxr3oy1fpDr ivs;s)srumim nodap nmfvtat aDrru oou1aetomiciydfmDuau pnu) etnxf3oatopt aiei t)s2to(o oodol nlfet tf 2tmxrp;o4opxnioctys aDeln on() renxf3oadfmt  ivils s2toio nudame  icta( aDrmxmpnt4texnif3tyt a eauvp;(0arxriociotop rlieo;t srxrxr3nu4amtelneta()s2tru p;u4alx mfcilsfa ua(mp;u4areomo oydfpDrai s s) rtmxo3iudlmeemfvt ( arra(mooo1optnii3tlsfm rl(ms t0tltoxr3tadlmDeli o;()seto(mpny4oltnlfetl(f Duru ooo0aexn o3iysfaDuanvp (4aeenmocoy1la rauvi ( setoir3iodolte nvi ( sDua(mont4aexn f3iyt aDeanvo (4tleomociadlpDraivs t0seurxopoodlltnlivsat aDtrum nu1tee miciys mDra(mp;()tlxnircio1oa   nvo (  etoxo ny4lm nlivsl()srumxmo;t1opeomfeiatls2ra(vpnt4tetomr iatfm  luesls0teuo(mpno4lltnlnetls aDtax  oo1alenifciad m umu on(0tlerir ta1fpDe nesl( texoimpny4lltnmfvt ( arrmx  ;t0tetnii3iatlaDrmn s t0artrmfcoatlm  livo;(0 rurxm3nu4amtelictlsfartrxr ;u1aee io3iysfs2ulnvpnu4artoxr ty1laDr u s (  rxoxopio4ll n ivsa(faDur(rp;o4aleoifciadfs emn ont0treoif oa1omD  uvol( texrir3nudlle lict ( artm(  ;t0opeo icilslaDrauvpn(0aetrmf iodfmD ai sls0srurxmpiodopeemnei s) 2urumonu1tptomietytfm2em(mont0 rxnio iytfm eli o;()texmimpnu4omt mnvilt)srrr(ro;u0alt ioeiat s umn s;u) leoxrciydlpte nvo;(0t2to(r no4om emieiasf Durx  no0tlen f3iadfm2uln o t4 eeoxrciatopt anvols0teum(m3nu4lmtnmneilt)sDumxmp;t4apen o3ils m2uanmpnu4arxnmr3oydoaDranvsls0t2uo(m3ou4om e ivslsfs2rr(mooo0aleo feiadla2em( pnu4aexoxoctatom   nvol(0 2uo(m iu4om e fei (fs2trxm ;o1ope io3tatfmDelnmo;u)aeeoir iadopDrln o s sexrxr iu4omtnliesatf 2rm( pot0tlt  feiydfm rmu o;(0 renmrcta1lpDeaueslt) 2ur(m3iudomenlici t s2taumpou0opx moeiatfs ua( pnu) rxoxo3oatfp  lneols)teur(o3io1apee nctasf Durx ono0aee if3iasfsDel(mp;(4 eenxo tydfp  lueo (  rtoir ou4omte ieiltf Drmxr nt1tetnmfeiysfa rm( p;t0aetrmf3oa1fatelu s s)tetrio io1omte nvsatfaruax o;o1tpeomieilt sDel( s;t0trxrxf3ta1omt auvi t  2tm(r no1omeelnes tfsDua(rp;o4aeen oetadlm2uanvonu0aeerxf oo1fmD  uvs;s) rxrxopou4amtn nvi s)sDum(m ;t0oet mi3tat m2rl( onu)alerif ootom rli i t0setmxm3oudapeemfcs (farrmu  nt1aetn octas sDumuvs u4 eenmr tytfp rlnes ()trtoim io4lle  nvtat srrr(m oo0oetniictlt a umuvo;() rtnmr3tytfpD ln ol(  2xo(m nu4al  livtlsfaDua(  ot4aee  f3iydla2eanvpnu0aexrmr3ta1om   ivs ()seuo(o oudamt lfeta(f 2rmu  ;u1ape  i3ilsfm2umuvs t0alxrir iy1la e nei s) rumxmpiy1al  mfetatf 2tm(mp;o4tpxoii3iasfsDrlumont0altrmr totfmtrluvi;()s2urxrpiu1lme lfci s a2ta(  no1olxnmiciysla umumo (0tlenmf3oydfpt  neol(0 2umim oo1lle mivtatf rumump;o1opxn f3tlt aDuaumon(4 eeoxo3tydoa rlu o;t teurxr iu1lme lneils aDrrumono0tetnmfeiys mDea(vpnu4 ltnir todfmtrluvol(0 rur(m3iu4al nmfcs sfsrrmu p;t0tlt iiciysfa2uluvpn(4 exnmfcio1fmD  nvs;t0srxoxm3iodam e ietl(farurx  nt4tpx mfcias m ean p;u4tlxrxo3oydlatrli ils0s2xrir io1amtnlicsltfa2uaurp;t0oltnmfetyt s2ranvo;(0arxoxfcoydfm eln s s sexoxm3iy4oltelfcs (f rumu pno4teeomfeiasfs rln s;(4trerir ta1opDrln o s t2xm(r3oy1lmenmici tfs2trxm ot1opeomoeild mDeanvsnt0 rerxf3oo1om elivols)s2to(r nudlltnmfctas)sDtaumonu1oee ioeiys mDuanvp u4 eenmfciodlmD lu i;(0t2tmim oy1llenlfvsas)sDuax onu1aetnmi3iad m2ranmo;t0teerxfcio1omDe nvslt  eurxm3iy1ap nmfctas)artmu ont0tpenmieiasfa2emumsnu0aeeomf3iotom  luvs t  ruoxr iydomen neiat)s2ua(rpnu1alx mf3iasfm2uauvs;(0aexrif3oatlm   ieo;t  rtmxm3no4lpe livt tfsDrmx  nt1opt iictytlmDemnvonu)aexoxociatlpDelivil(0 euo(r3oodlmenlnvtas)arrrumo;o1oex io3iasfa rmn o;t0alxrmo3ta1omtr neils) etr(rpiudoptn neiltf rrrx pou4aexo fciytla2emnmo;u0trxnxf3oodfpDelieo;(0 eurxopny1al nmies s)srumur ou4alt mfctatfm uaumpnt0alxnmr3tydfpt ln s;t)seurir iu1alenmietl() Dumur no0olxnmictltla2um( snu)alxrifcoodfpDean i s0 rxrim ou4am n nctat)arrr( ooo0apxnifctlsfaDumnvp (4artomfcoo1fateanvsls) rxoxo oy4opeemivi t arrm( o;u1apenif3iyd m2ulnvon()trxnio3ia1latean i;t srum(opoydam e neslt)s2ta(  nu4opxo iciad a2emump;u)teerxociydlmt ln ilt setoxrpiu4ome mfvtasf Dtr(roou1oeen icils a2rlu p;t)tlenmo3iodfpte i s ( t2tr(opiydll emncs tfs2urxronu0tpto f3iysfm em(ms t0tlxoxocootfp ranes;s0setr(m3nodlpe  feilt  2rax  ou4oexn fetlsfm2rmn snu) exoio3iodomtr nei s0teur(rpny4lltn iesls  2tmum ot4olto oetltla rmu snt4 leoircia1op  li i t srurxo iy1lp nmfetat) rrr(r ;u0alt  oetlsfa2rl( pnu) etoio to1lmteaivi;(0seum(o3nodom n ies t)aDta(  ot1ope  f3iadlsDrl(mont4areoif oatlmt  i o t0srxoxr3iu1oltnlnvil(fs2umxrpnu4teen icils a2rl(vpnt) leoxf3oadlptr nvo s  eto(mpiudameelict () Drau ooo4aee  oeiyslm2uan o u4alxoioctatla  ln il( setmirpou4opt  fvsas a2um(rpnu0tpx if3tydfm uaump;u4alxrxociodlm elivo s0 2xmxopno1lmte fesa()srrmurpot0oleomocias a2emn p;t) exoxfciotfp   uei;() eum(o3ou4lp emnviat  rtrum nu4aetnmfeiat m2emu o;u4tlxnxo3tytlmD ln ils)s2tr(r ny1llt  fvil() Drau pot4oeenifcild s2rln onu0tlxnxo tytopDeln sl()srtmxo oo1lp nmfcias srtrxr no1apenifciyt m ea( onu4treoif oadoptelivs ()setrxo3iy4aptnliesas aDururpnt0aet ifeiltfs2eau pnt4teerifciodlmt au ols s2trir3iy1ap nmncta()srurxm ;u4tpe  fcils s rau s;u4 lxrio iatfmtean i;s trxoirpiu1ole  iei ()sDua(rono4alen iciadls2umn pnu)trxomr io1om rai i;t trur(o3iudapte fcils sDra(r no4oexnifctyd m2rmuvs;() reoir3iodlptrlu o () 2tmxmpoo4omt lfcia( sDtaurp;o4apxomfcild sDumnms;u4tlxrxr3totoaD  nvs s trurxr3iodopen fcs sfa2rax poo1tpx mi3ildls el( o (0 exrmocoo1lpt lnvo;t0 rxmxo ny4omt  ictl(fsrurx pno4opt if3ildfaDrauvp;()areoir to1optrlnvo t0tetrirpou1ale  fcs ( srum(m ;o1opto o3iytls2ea(von()aetomo3tadfmDe uvo;t  euoimpiy1omee fctls) Draxr ou4olxn fciadfm rm(vsn(4aexnmr ootfm   ivs t0 rxrir3iu1aptelfvtlt)arrrxr nu1tpe  o3iys m eln p () ltrxf3iy1fmtrlu slt)texmxm3nodaleemieias)srtm(mpnu4tlto oeiytlaDeauvo;u4teeoxfctotlm elnesl( teumir3ny1ale  fctlsfa2tr(mo;t0tex iociyd mDum( onu4arenifciatop rlu o s)t2tm(opiy1amenlneilsfsrrmx  ;o1tpe  i3tys sDrm(mp;t0tetrio oytom e uvo;(0sexmxm3iy1llt lnes sfaDtaxroot1optnmoeiaslm elums;u)teeoifcoatopDeluvo (0t2to(opnudom nmicia(  Drmxrpou0tptnmfciys sDran o;u4arxrxrcia1oa elivslt0seur(rpiy4lptelicil() 2tmu o;o0ole iiciasfa uan onu4alenxo3tadfp rai s;t)seuoirpiodlm nmivsatf rtauronu1apt  o3tldfm el( pn(0trxrxf ty1lpt  n il() rurir nu4opt lfet tfarua(rp;t0opx iicils a rlu o;t4alxrmo3iatopteaueo;(  2tm(r oudll  lfcta(  2rax  oo4tptn i3tadls2ulumonu4tleomocia1oateau i;( sexr(o3nu4alenlivsl( sDrmum ot4apt  fctyslaDumuvs t)tlxrif3todlmt an s;()s2urir iy1ap   nvi tfsrtmx pnu4aexo oetas sDraump t)altomo3iydom elneolt texm(o3oo1lme mfesat aDurx  ;o1tpen iciasfmDua( p;t0arxnxfctodop  an i s s2uo(m3oydoptnlfviat srtaumont0aeto fetatfaDrmuvo;u0tlxnircoo1opt aiei t)srxr(r oo1om e ict () Dua(moou1oee mieiatlsDrmuvon(0 exriocootoat  ivs (  rtrxm nudlp nlfct sf rrm(mpou0teto o3ias m2uaumsn(4arxomrctytop e n i t)texoio oy1aptnmicils sDumxm no0apen ocildla rm(vpnu0trermrciydlmt aiesls sruoiopno1amenmfes ()aDrrxroot4tpeomi3iydfm2emu o (0 reoir iydfaD ln i t) 2xrxrpoy4ll  livs sfa2rrur ;t4alt  ietlt aDel(vo;()tleoxo3oa1faDr u s ( t2trirpnodoptelfvil(  rtrumoot1opx iociatlaDuan o;(4alermo3iadopteln slt0 2xoiopiy1apt  ivsl(f rrrumoou1aetn o3iysfs2elumon() rxoxo3ootfpt ln ol(0 2xmxopiodop  mfci ()artrx p;u1tptomf3iytlm2rauvp;u0 lxrio3oa1op   neolt)trtm(r iu4lm emfvs (farur(ront0aexoii3iytls ua(vs;u0 exoio oytfmt auvi t srxo(m3oudom   nvsas) rrrxmo;t0tetniocildfaDra(ms t)aetrxr oa1oateai sls  rtm(rpiy4lptemfeil(fs2rm(roou0apeo fciatlaDul(msnt4arxrxociy1la e u slt seuo(r oydal elivi tfs2rau  nu1apenii3ild m um(vo (0 etrmfciadoat ai ilt) etrim oodolee ieslt) 2ua( o;o1open i3ildlm rmnvo;u)altrxfcoatom rauei (0srum(mpoodaltelnei s)a2tax o;u1aeeomfeiltfm2ranmp u4tlxoir3iy1fmDrli i;( srumxr nudomtnlnctls  2taxrp;u4apen oetlsfm emn o;u)tleoifcia1faD livils)srxo(mpnodom n fct () Dtr(  nu4oeenmoetldfsDemnms () etnxf3oodlaDrau i s0sruo(r3io4al nlnetlt  Dtrx pnu0ole mfetytlm uanvp t4arxnxr3ootfpD  nvs s0s2tmio3iu4lltelfeiasfaDtm( o;t4tpx iocildfa2ra(mo;u0arxrmfctadfmD livilt trtoxopno4lltnmncia()sDtaxmp;t0apx moeiysfm2ean pnu4teeomocta1lmteaieo;t  rurirpiodlp  mfciasf 2taxrono1altnmf3iyslm2rmnvp;u4trxrircootom eln s s0 2umio iu1ameemfcils) 2tr(m ;o0tltnmoeiat s2rmumont0tlxnir3oo1lmt aivo ( teto(o nydlle lnesas a2um( p;o1ope ifciydlaDelu o ()aeerxrcty1oa   ivo;t0t2toimpny1lmee fviat sDua( pou1opt ioeiyd m uanvont4tlenir3io1op r u o;t)s2toxrpoo1altnlfet s  rrmurp;u1aexomf3ils a2el(mp;(0tlxomf3ta1lm rai o;t  rxmxo3ny1alenlfcs t  2ua(  ;u0aexnii3iysla2ul(vp;u)aexrmociytoat  uvi;t0trumxm nudapee ivtl()arrrump;u0alxniociatfa eau p u4aetoxr3ty1laDr ivi;(0teuoir3io1open nei tfs2ta(m no1tlxnmoeildls rmuvo;t) exnir iodlm raivo s0 eumxo3io4amtnliei () 2umumo;o1alx ioctys a ulnms (4arxomf3todfp r ivsl(0s2xoxo3iu4omtn nei t) ruaur no0ape if3ils mDrmu pn(4areomr oatfmtraiei;( teto(o3oodomee netlt  rumu  ;o0tlt iieils m2uln pnt0artrif todfm rlivo ( srtoio no1altelnei t)sDtaum ou1ale  oeilslsDua(mp u)tlenmr iotlpDr ieils t2tm(m no1ap n ncsl(faDtr(m ;o0apenmocilsfs rm( s u) etnif3ia1laDrai slt0setm(o oy1am nmivsltf 2ra(m ot1opx  fctldfmDran o;u)tltoxo tadom  aneo;()s2xo(o oo1lmtnlncsa(f rum(mo;o0tet io3iyd aDrauvont)tetomocoydopD ai sl( t2ur(rpoydam   fciat)srraxmpno0apxomfciysfaDrmn p t0artniociytfaD  nvols t2trxm3iy4llt lictat srur(  ;u4teto ieildfa ra(vo t0tlxnxfcoydlmDelivils0seum(mpou4aptnmnetat  Drmx pno0tlxnmoetydls2ul( on(4 eeoifciytlp   nvi (0 etrxrpiudamt mnesl(f 2rm(rp;t0oltoii3iad sDrauvp u4 rxnxr3ootfptran s;s) 2tmxr oo1omtelivtlt  2rmxr ;u0alxo fctys m2eau p;t4tlxnmr3io1lateanvsl( s2umim no4opt mfctltf rurxrooo1tlxoioeilsla2rl(vs u4 lxnir3oa1lmD livi t0t2urimpoy4amte iesl()s2ta(m nt1tet iietltfa rauvp u)aexnxo3ia1oaD  iei t0 etrirpiodolt lnviat s2ua(rpoo4oex mo3tld a emu o;()tleoxr3iytfa r uvs t0 2uoir3oo1lltelivi sfsDtmx p;t4tet ioctltlsDul(ms;t4aexoif3iy1lp raieo t)s2tr(mpou4ame lfeils  rtaxrpou4aexoii3tltfsDea( sn(4aexoxfcoo1omtraivsls0seumio ny1omt  nvtlt)sDtmxm ot1oleoiietyd a2rmu o u0aeenircoydoptrluei;()trur(mpnu4omt lnvsl(  rum(ronu1oetniieilsfsDel( s;u4 lxnir iydfp e ues s  rxo(r3no4olen fctltf 2uaxmpnu1altoioetasfmDumnvsnu0arxrioctotfmDelnvo;( teto(opoy4lmte icsat)sruaxrpnt4tee  oetlt a2emn o;(0trtnxr tadla   iesl() 2xmim oo1ol nmnvsas)sDur(mp;u0tetn f3tls a ulnvp t0tltrxo oydfa eaivo;s)seumxrpnydaleelicsa()artr( p;o0tle ii3iydla rlu o;u4tlxomocty1lp e ivi ( sexrio nodaptemfeia(  Durxront0tlxnmoeild m2ulums;(0tetrirctytoat  ieolt0seurxo io4lp nlncsl() 2ra(mpnt0alenii3iasla rm( pnt)arxoxf iydlmDrlivol()s2xmio3oodlmenmfvsa()s2tr(r ou0aptoii3tls s2rau p u) exrmr3tatfp  ln slt)t2xo(m3nu1oltelnci (faDrmurp;o4opxomf3tyd mDrlu pn(0 lxnmo oy1fa  auvols s2um(o3nydap e icia( sDuru  ou0teenmieiatfs rmu s u) lxnxo tadfmtr i i s0 rtmimpnodol emictlsf Dtru pot1aee ii3iys mDrluvpn(4artrif io1lp ran s (0s2ur(m oo4ol  mnesl(fsrrmuro;t4opx iieiys sDrln o;()alermf oydfmDe ivsl(0srxm(r3nudap nlfctas a2ta(r ou0aetoii3iatfm2ra( pnu)aetnxrcoadfp e ivi s0t2uo(m3ou4al nmfei s aDua( onu1tlto ieiyt a2rl(vp t)aexomo3iadfmDeauei;(  rumxm oudom nlivslt)s2uaxm oo0oexn icildlm emu sn()aexnmo iotoaDeluvslt) rur(opno1al n ies s) rrm(  ;u4open feiyd a2eluvp ()trtnmrcia1lmDr ieol( tetoxo3iydlmeelfvsa(fs2trxmpno4tlxniieild mDrmuvs (4 etnio3todlm rlieil( tetoio3nodol e fcs t  2tauro;t0alx  feiat s2uaump;u)alxrmo to1la raivol( t2umir3oudlptnlfciasf ruaxro;t0opx iiciysla2ea( o;t) eeoxf iy1lmD  u o;t) 2toiopnu1oleemnctl(f Dra(m ;u4optn ociyd sDumu o;(0artrxo ty1fpDeaues;(0t2uoim3iydom elnctl( s2umu o;u4oetomo3ildls uauvo;(0tetoxocoodoateanvi s)sexrxmpoo4openmicias) 2rmu pou4tpeo i3ildfaDrlnmont4tltnifctytopDe ues t)trxoir oo1oltn fetlsf rtm(roou1aetoif3tyd s eaump u)alxoif oytom r nvi;t)s2xm(rpnu4al  mivilsfsrur(roou1oltn fetldlaDranvs t4areoif3tatoatelivi;t0sruoxr ny1lme  nctas)srrmxro;o1oet iieilt s el(ms u0 exomf iadfmtr uvs s0 2umxm3nudamtelfes tf Draum nt4opt io3iatlsDrlu p t)trxnif oo1om  luvs;() ruriopoy4alte fvta( sDur( p;o1optn oeiydlsDemuvo;(0trxrif3ty1oateaueilt  rxrim nodom  lfeiatf 2ur(m ou4alxomfetldlm elumo (4texomf oa1fmtelnvi;t)trurxo3io1al  lnes s arrm(  ot1oeeomf3iatfs2ra(mp u) exrmf3oatfaDeauvs;s)s2xm(mpio4lptnmieslt)arrm(mpot4oet iietlsfmDrauvsn(4 eenxr3iodlaDe uvi;(0sexmxm oo1ol e fes t)aruru  ;o1apxnio3iyt s ran pn(0 etomoctytlpDr nes s0trurir3iodlp  livsa( a2uaurpoo4opxo o3tltls2ulnmp;(0 leoif3tadomt  u i t setoirpio1lp nlfctls) rrruro;u4tlt mo3ilslsDuan onu0 etoiocoo1lmD li sls  euoxo3iodopenmneia() Dtrxrp;u4texn i3iyt a ranms u0 rtrxr iydfaDrau ilt s2xoir no4lltn nvs ()srtr(r no1aeen f3tatls rmuvo;t0alxrir3iodoa   iei;s) etm(m nu1al n ietasf 2ta( ono1ope if3ild m rluvsn()arxrif3oy1fmD  i o;( truo(m oy4lme lfctls) rtm(ro;u0apenifciyslm2rm( snt4 ltnxr3oatlpteaueils) 2umxr3nudal   nvs s sDrax  ;t1olx io3ils s2uan sn(0trxrxf oodlp   neo;(0 exoir3nu4ol n icsas)a2tr(mp;o4tlx iociadla el(vp;t0 rtrmoctadlmt aiei;() rxoxm3iudoptn nvtlt s2tax  ou4aexniociadfm eanvp t4 eeomocoadfp elivi;t0t2xrirpiu1op  mivs ( sDumx  oo4tltoif3iyd mDel(vs;t)trxrir oa1oaDeau o;s0texoio3oydomt  feil()s2rmur ou0tpt ioetys s emn s;()aetoircootoa e ueo;(  rurxr3nudlmt  fetls)aDrm(ronu0oeenii3iasfs2rl(von(4arenxr ta1laDeaivo s)texmxr nodlpenmivi s)arum( o;u1tet iicildfa2uln s t4 eeomr ia1fmDran o;s trxoim3oo1optnmics t  2rr(m nt4ope mi3iasfsDra(vpnu4arxoxocoytfm elies;t truoimpio1amtelfcslsf Dtmu ono1aet  f3iatlm2rau o (4aetomo io1omtrlnvs;(0srurxopiydlmenmnvs ( arua(mono4alenmoeiat s2em( o;u4aetrxf iytlm r i o;s) 2xrim ny4ameelictls a2rmu  ;u4opxoifciysfa emu o (0altrmr3iotlaD aiei (0sexm(r3oudaleemfvt s) 2rr(r nu0aetn ieilslmDeauvo;u) etnxr3oadop e nvilt0 2xoir oodal   fvtas)sDuaurono0ale  fctld a rm( p;() lxrif3io1fmteai ol()s2umirpny4lmeemnvtl(f Drru pnt4apen o3iyslaDrmnmo (4alenio3totlm e i i;(  eurim no4om   nei () rtrxront0aex ioctysfmDem(mpnt0 eenmo tydopD lieo t) exrimpiydlpt mnvsasf Dtaum ou0tet iietat m el(vo;u)artomf iytom ran s t)sexo(o oo1optnmncsat  2tm(rpoo0ole mf3tasls eluvs t0tlxomf oytoa   ieilt0s2toio3ny4lp  lneilt  rrmumo;t1teeoiietltla2em(mo;t4trtoxr3totfaDrai o t trtr(r3nydamte nesat)aDrm(mp;t0olxo f3ilt aDrlu s t)trtnxfcoy1lptean i;t  etr(m ny1lm   ict s a2ra(m ;t0ole  fciydfmDem(vpnt)tltomr3oadfpt lneo;s)sexrir iodaptn nesltf 2tau poo0tleniiciyd m2ranvs;u0tetoio iytfpteai ols0 2xr(rpoo1ameemfcil(f Drru  ou4aeto iciatfa2el(mo (4alerif3iadlmD  ivol(  2xr(m iudop n feilsfa2rm( o;o1tltn i3tadls rl(vpn(0trtrif tadomt  ieils seuoxr3iy4lm  mfesl()a2urum ;u1tlxo ociytlmDumn o;(4 rxoifcoadom   uvi;s0 etm(m3no1ame  ivi t)s2umu oou4tlxoiociatfs2ea(mp;u) lxoxo tydlateluvilt)srtr(o no1altnlneilt  rtr(mo;t0aet if3tlt s rl( pnu0altnif3todlp elieslt0texmir3iodaltnlfvtatf Dta( o;t4olto iciydfs rlnvs (0tetnxr3to1opt aneslt t2tm(m iodlpe lnctls) ruaxmoou1teeo i3iad s uanvpnt4treomf3oydoaDrauvo;( t2toxo iodlpt micil(f Duax ont0optniociat mDrl( p (4 eenmfctytopte uvo (0truoxm3nu1op e ivias)aDrmxro;u1tlxnioeiyd a2uanvsnu) etoxfcia1la r uvs;(0t2tmxr3oudomte icil( sDrmu poo4apx  o3tatls2ran o;u0alxoxr3tatlatelnvils trur(mpoydoltemfciat aDrmu  oo4opxnmoetlsfaDrauvo u4teeomr3iodlm  li ols s2tm(opnodal nmfeilt)srrmu  ;o0ope  f3tltfs umums u)arenxf iatomtr uei (0t2toxr oydlltnmfeiltfsDurum no0apt  o3iyt s rlu sn()artrif3iadfa  livo t0srum(rpoy1ol   nctat)aDtax pnt4opxo feils m2rm( o;()tleoif oatop e uvi;t0seuo(r3iydomeelfetls aDtrxmpoo0aex mociydfm2em(msn(0 ltoxo todlaD auei t)trxrxr nudlmenlnvil()arrmxmono0aee ii3tlsfs2eau snt4 reoxfcoatomDeanvi s)srxoxrpoudoptemivi (fs2umx pno1oleo feiltfm2rlu pnt0artomrctatfp   uvi;t tetoio iudom emfes (fs2tm(mo;t0alxn ieiytfa2emumo;(4arenif oydlm eanvilt)trto(mpnodlptnlncilsfaDum(mpot1texnifeiydfs2ulu sn(0 exnmfcoy1om ran ol() euoirpiu1lp n icsls srur( onu4tet  f3iad a rmu s (4 lxoifciytoatran o;(0 euo(o ny1am nmfcilt) rrr(m nt0tleo f3iltls emu pnu4 rtnircio1oa rai ilt)setoio io1ameemfvi t aDurxro;o0alenmf3tld sDul( s u)teeomr3tydfaDrai ol( trurio oy4ome mict sfsrraxmpou4tetn oeiys m umnmon() ltomocta1late nvs;t sruo(m ny4optnmncta() Dtmxrpnt0tptniieiydls2rmums;u0artoirciy1latr u olt trxm(r nydapt  neslt sDta(r nt1apxn feiytfaDra( snt0trtomf3tydoateln ilt0 exmim3iudameelnvtlt) 2tr(ro;u0apxomi3iyd s2el( o;t0 ltrio3oytlaDe n o;t0trxmxm3oydapen ict t  Drm( ooo1tlx ii3tytfm2ea(vs u0trtoxr3iodopD  iesl() 2tm(o3nodomt lncsltfsDrr( pou4olxnii3tld a2elnms;t0aeeomf3iodlpte ueil() 2toxopoudlme lncilt  Duaurpnt4tee moetytla2rmn pnu0tlxomf oadfmD aneolt  2um(m3oudol e feia(fs2rmxr nu4altniiciadfm2uan p;u0tlxnxf3iadfp rln o;t)trxoir3ou4om e nvil( aDrm(  nu4altomociltfmDuln o;u0arerifciydopD ai sls trto(r3oy4lltnlivsl(  2taum ;u1apxoioctadls2ea( pnu0alxoio oy1lm eauvo;s trtm(o oodapeemnct () rururp;u1oeenii3iysls eln p;() eenio to1lm rau i t)trtoio ny4alenmfci s)aDururp;u1aex  oetydls2ua(mp (0alerif iytla eanei;s  eurir nu4ol  micsa(fsDtmum ou1tlxomictlt sDelu s t0 exnxf todoptrlu o;(0 exoxr3iudop e nci t)s2rrur ou0apx mi3iasls el(vpnu4tlenir3ta1fmDr iei;s)srumxmpny4ap  mfcs tf 2ra(rooo4oleniieiytfsDeluvo;(0aleoiociy1oaD li slt0 2ur(r oy4lm nmnet s) 2ua(rono1aetnmietydlaDumnms (0tetomo3ootfpt livi;() rurir iy4lp elnvils)sDuaxmp;o0aet  fciatfsDuau s u0aetoio oydla eauei (0 2urirpiodapt lfct t) rtaxro;t0tex iociasla emnmonu0tetnmr tadoa eauvo;s0sexoim ou4lm e ieta(faDurxrp;u0opt ii3tyt s ua( snu4treoxf oydlateln o (0s2xoirpoo1aleemics ()aDrax  ;u1aleo fctasla rlnvont0aeenxrctytlpt anvs s)srurimpny4omen ict (f 2ta( poo0oetn fetat m2ua(ms u)aleoxr3oodlaDe u slt0sexr(opio4altnmiei (fs2uax  nt1oee mieiadlmDea(ms t4alxoxf oydoa eluvi s  etrxmpnodale mnvilt) Drmxront0apxo oeiydfmDrmn s;u4 rtniocta1fpD lues (0 ruoxmpiu4oleelict ( srraumpnt0opt mi3iad a2uauvp u4 exrircty1lm ran ils0 2uoim3ou4lme lfeiasf 2tru  ;o1tlxo icildlaDuan sn(0tlxnmfcoodoa rln ol(  2ur(m ny1oltnlfvtat a2rax  ;u0oet ifctltlm2ulumsn(0tlxoxfciotomtr ivi s0tetrxmpou4ap elncilt s2tr( poo0alt  feiyd s em(vs;u0trxoircoadfp   i ols srxoxm ny4altelietltf Dur(mpnt0olx mietaslmDrmnvsn()teenxo3ty1omD  nvs s)srto(m ou1lptemies t s2rru ooo1alenioeiys s2ea(vsnu0 etoxo3iy1fm eluvo;t s2umir3nydomeelfcias  rrrum nt1apt  o3iytfs2em(mo u0treoxoctytfpD li s ( setr(r3iodlptnlnes ( srumu pnt4tptomictytfs ua(ms t4altnmr3iotop  au il( s2xr(m3nodlp   fcsl(  2raxmooo1tlenioctysfm2ea(msn(4tlerio3oa1fpt ai o;(0 rtoxo nu1ol  lfvias) Drrump;t4teeo oetadlmDum(mo;(0aexomfctadfa   nvi t  rtm(opio4lmee ivsl( artauro;t0ape mf3ilsfs2rm(vp;u4areomr3oa1lmtranvilt trxoir oo4apeemfvilt srtm(rp;o4apxn oeiasfs ua(ms t) exrmr3tatoa raies;( setrxm3ny1lpenmnvt tfarrm( pno4olxo i3tysfa em(ms t)alxnxr iotoptranvsls)tetoimpoo1am e nvs t  rta(  ;t1olt if3ildfa2rlnmo t4 rxnmr3tytopD lueo;s0sexmxo3nydamtnmfvia(f 2rrx pot4aptnio3iad s2ea( s;(0alenxfciodfpDr ivo (0 2tm(opoo4ome lfvtas aDrmxmo;u0apen o3iys aDuanmp (0tlxnir ty1laDe nes t texrimpny1ole lfctls) 2um(r nu1ole  fciadla2ranmo;t4tlerxocoo1fa eln il(  2toir3iy4opeemfctas)sDtm(  ;u1olen o3tytfm2eaumo;t) eermf iy1faDraueo s) rumio3oudop nmnes ( aDrr(mp;t0aex mfcias m umn snu0aetomf3iy1oateai s t trxoxmpoy4lptnmncsasfartmxmont1oltn fetltls2elnvs t) leomf3io1fatr i s;()s2trimpou4lm   fcsa( s2rrxm ;o0tptn feiasla umnmp u0aeermf3iytoaDr u s;s0trurxopnydlmen ivilt)s2rr(  oo0oltn fciadfmDeln o u)texoxf iodfp eauvo t  rxm(m3io4lltn ivt t a2rmxrpnu0tptomociltlsDrlumsn() etrir3ootomteau slt0teurxmpny4om  mivsl(fa2ta(  ou1olxomf3iys m2elumont4tltnxr iy1lmte n olt0sexmxr3oydap nmiet () rraumoou1tetnmoeiyslm rl(mo;(4arxrmo3iytoaDrauvs s s2urxo no1am nmiei t arurumont4aexomoctlslm rlu s t0 lenxo oatoa eluvslt0 ruoxm ny1ome mfeta(fa2uaurooo1oeeomociatla2um( o u4 etoif todfmte nes;s seuoim3nu1lleemivsl()artrxm nu1alenif3iltls ulnmo;(4tleoxr3tytlm ean s s t2xm(o oudomt lnct tfsDtax  nt1aetniietls s2uan on()alxnmo3tytlmDeanes;t0seuo(m ou1amen fvsl() Dtaxroot4tet  ieiatfs ea(vs (0tlxrir3ty1lm  anesl(0 etoir nu1lpen icsas srtaurpoo0opt ioctad a2ranms t4 ltrxo3oodla ean i t)s2umimpoydom emivilt)arrmur no0tpe  o3tlt a rmu snt) rxoxf3oa1fm rlneilt t2xoirpny1ll e fvias sDumuroou4olt  ociadfa2ulnmsnt)alxrir3iytfmDeln s;s0srtr(m oy4ap nlivta(faDtaxm nt4openmfetydlsDumumpnu4trerxf ia1lpDr n s;( trtm(r3oodlmtemfcil()s2tmu poo4olx  f3ild s2um(mp (0 rtoxr3oatlat au ils0setmxm3nydop emnciat  Drmurpno1tpen ociatlmDum( pn(4tlxrxrctytopt lnvsl(0 etmxm3ny1op  mnvtl(fsDuax  ;t0tptnmfciatfa2rl( o;t0 ltoif3iotomtelnvsls0 etm(m3iy4apeemivt t aruru poo4oeenmieiytla rl(vp t4 etoif3todoaD  ueo t)seurim3ny1al   ieiat)arumurooo1aee mo3tadfs2rmums;(0altnxocio1lpteau ilt0trxo(rpnu1ol nmfetatf Dua(  ;t4opxo fciysls2ul(msn(4 etomr3oatoat  ueo;t) rurxo3nudol n fci s)a2uaxmp;o1apxnmfeiydfm ea( s u)aetrif3iytfat  u s s0trurio3oydoptnmictls)sDra( pot4tex  fetytfm eln s;t)trxomo3tydla rluvilt0teurio ou4lme mnctl(farrrurpot4oet ifciyslm umnvp u)teeoio oo1op rli o;t t2uriopiydaptemnvta( aDtrxrpnu0alto fciysfs2ea( s;t4tetrmr iadlaDe n ilt  rxm(m iodllt  fvtl() 2tmxr ;u4olxnmfeias sDuauvs (0 renmo tytoatrlivols) 2xr(m3oy4ope licta( srrau  no0aetn iciyd s umumont0 eerio oa1faDrau s () euo(rpou1lpenlfvt s)aDraxmoot1optnmf3tadls uluvsnt4trxnmf ty1oa  au o s trumim3oo4lpenlnvs (f ruru  nu0teto fetysfs2emnvp t4 rerir3oo1lp eai slt t2tmir3no1altn ivtl(f 2rrx pnu0oetnio3iydlmDemnvont4texomf iatlpDeauvilt0 rxoim3nudlptemnvsatfsDrm(rpot1olt mfctytlmDrlnvonu)aexrxf3ia1op  lnei;()trxmim nodolenmfcs s)sDtmu  no4alx moeias mDeanmp (4artnxfciatfm rliei (  eumim nydolt  fei tfsDtau onu0oetn o3tyd aDua(msnu0tltnxf3oodoaD  nei;s0trum(o nodame  nvta() Dtrumonu1optomfciyd m2rmu ont0aetnifcoy1fa   u s;s0 rto(r nudol  lfvilsfaDumur oo0tetniieilt sDumnmont0trtomr3oydfpt anvils)teumim3no1opt lnesls  2urx o;t1oltomietlslm2ra(vo;(4tltrxr3ty1fpDrlnes s)sexmxm3nu4lpee nes s  rtmx o;o4aeenmi3tydfaDumump;u4tleoxfctodomD li ol(0s2xrim io4lltelfeiat arurxrpno1tpenifciatlsDrmn s;u) lxomfcootlpteau sls srxoim3iydaltn ieslt) rrmu oou1tlenmfeildfs2umnvo () lenxrcia1lpte ueo;t trurxrpno4oltelncils)a2taxm ;t1altoiieiat m umnmpn() renmocoa1lpD  uvo;s0 rxmxrpiu4amt  fvi s)s2tr(rooo1olxnmoeiatlsDuaumo t0 eeoircty1omtran i t0s2uo(r3oo1am nmnvils) 2umxr ;u0tpeomi3ilt m ulnmp;u) renmocto1fatran i;()srxr(o3iudll nlfeta()artmu p;u1oexo fetadfa2emn pnt0trtomfctytla  au s;( sexmio3oodopen fvsa() 2raur ;u4alxomo3tldfm2umumont4alxoiociatlmtrlivils0 2triopnu4apee ietltfaDuaur ;u1openmfciaslmDelums;(4 lerirctodlpt lnvsl(0 rumir3ny4omtnlfcsls  2rr( ooo4oex mf3tat sDemu s;t)tlenifciotlptr ueol()teuoio3iydol  livtat  Drr(m ;o4openmfeilt s2ranmsn(4trxomf ia1opteli o;s)setrxr oo4lpen nct (f ruaxrp;t0aptn i3ilslaDrmu s;(4alenircoatlpDrlivils0tetrxr iu1amtnlfviat  rrmurpnu0tptnmf3iysls2rlumpnu0 eenxoctotfmD  uvo;s)s2um(o3nu1llenmfcilsfa2tr(  ;o1aee  ietys a eln o;u0 rtoxr to1fp r n o t srtoxo nodop elivia(  2rau  no0tex ifctad aDrl(mp t) rxnir iytfpD  nvi;t) 2uo(r nudllen fcta()aruru  ;o1teeomi3ildlmDuaump;u)trerxf oatfa rlivs s0tetoxo3oydlp nliviasfsrta(mooo0texnmo3iydfmDumnms;t)areoiociadfmtrau s;s  ruoxrpno1amte iei tfaDua(mpnt0tpxoiociltfa2um( p u)arxoif3oytopDran il()texrir3iy4al elfvia()arumu pou0oeenif3iyt sDemu o u4 eeomr tatfmt aneo s s2uoirpio4omenmnvt s s2umu  oo4apxomfctlt aDea( o;()trtnxr oo1oaD lneil()srxm(m iudll nlfvt (faDtmurpnt0tex ioeild sDeau o u4 ltoir3tadlaD aieo;t0 rtm(m ny1oleemfvias  2rrxro;o1apxo ieiyt m eauvp;t4 eenxfctatfm  an sl()sexmimpoo4lmenmivslt)srumumpou4oetnifeiadlaDeaumo;u) leomrcoodomDeaneo;s0texoxm oy4oltn ncsl( sDtrxr nu0apxnio3tat m2emums;t0aeeomo iy1oateau i;t)truo(o3ou1ole mivsltfa2uaumono1optoiicildlaDumumpnt0arxrxocty1omDrlu s;s setmim iu4lp nmnes t)aDrmu  ;t1tetnmo3iltfm2ea(vo;(0arxnxrctytfp r n sl()trxrxo oydolenlics tfarua(r oo0texn iciadfaDumu s ()tltnxf oadlpDe n o s  euoimpiu1omeelnesasfarur(rp;t1altoioeiat a rauvsn(0trenmr3oodfmDean s t  rtm(o3oydllee fvs tf rtmxm ot1aetnmi3iytlm2rlu o ()aexrmfciytlmD  ivol(0trxoio3iy4ape mnvil()sDuax ont4oetniieiydfm2rlnms;u0 reomo oadfmD ln s t setmxm ny1openmietls) 2rax  ;o4opt  f3tyslm2eluvon() eenxrciatlmDraieols) rtoxo3nydll e fct t)sDrr(mooo4oeenioctydlaDuanvp t)areoir3tydlmtr ivo s teur(o iydamenlfcsat a2tmxm oo1optomictldlaDeln snt0tlxnir to1la r n ils0srtoio3nu1lmtnlfvia()sDrax  ;u0opxnii3iytlm rm(mpnu)alenxfciydfmD auvsls0setrxmpnu1ol n iei t) Dumxm no4apeo i3iydlm rmnmo;(0 eeomocoadfmDr n s t0trtmxm io4ll   nei ()a2ua(ront1tltoiociadlaDua(vp (4 rxomocio1lpD anvs;s teto(mpnydlme mnvi t)srrmxr nu4apenmoetltfm2emn onu) eenmo oy1opt anvi t s2trxm nodaptemnvi ( a2rr(r ;o1tlto oetatlmDranmpn(4 lxoif oatlpD  ivi;s)trtmim3oo1ol   fct t)s2tax  oo4aeen ietltfm rlnms;t0aetrmf3tadoa rai i;s s2tmiopno4optelivt t) Dumum nu1tpeoiieiad s ea( o (4aetnifciotlmDrauvslt  euoxr3ny4al n nctl()arta(moou0oeenmi3tys mDrlnvs;(0tetomoctodopD au ol(0texm(r no1al emfesls a2uauroot0apenio3iydls rluvp;()teerxr to1fa r n ilt0 rtrxr oodap   nvslt  Draxmono1teenmi3iyd a2rm( snu)alxrir3iodopDeln sls t2uo(m3no1om elivtlsfsDtr(mp;u1texo ietasfm ulnvpn(0arenmf3oy1om elueolt)teurxrpnu1omee icsat)a2uax  nu4tlx  oetasfa2ulu p u0 exomf tadla eluvolt  2urxo no1lmt lieils srum(r nu0aexn oeiyslm2rm( pn(4aetrxfciytlmDrau o;s  exoio oodlmt mnctls) Drax o;t1tlx  fetltlm2rmumsn(4tlxnmocio1lpD anvslt sruo(r nudoptnmfesls srua( poo1aleomfctlt m2uaumpnt4treoifcoytomD lnvsls t2xmiopnudop  lfci t)aDrm(m ;o0apeomfcilslaDrm(mo (0tlerxo3oadoa  aueo (  2uoxm3oy1lpt  nvslt)s2ta(m nt1opt miciltls eanvs (4alxoxo3iodfa r i i s  rurio oo4lptnmiesas) rurx p;u4opx io3ias a rl(msnt4tlenxr oytfmtr u i;s srxr(m oo4al emicsat aDrm(m ou0tleo oetldfm eaumonu0trxnir3oatlate uvo;t) 2tm(opnudlptemivtasfarrmx p;o4tet moetat mDrmums;t0artoxocty1fm rli sls seurio3iudomte ictltf Dra( ooo1tpen iciys mDeln o;u0areriocta1lp r n i;t)seuoxr io1al emfctat) rtmxmpot4optomf3tatlmDemnvon(4altoxociadfat li o;( teur(m3iy1op n nvsas)sDtaxmp;u0tpt ioeiydfs um(vont4texrxr oytfatr ieo s srxrxmpou1alenlfeta()sDtm( p;u1alxomociysfsDemn o t0tlenmf3oodfa eli s;t0 rxm(r3oodop  mfet tf rrm( onu1tlen f3tasla2rl(vsn(4teerif3tydlmDeanvs ()s2xoir3iudomenlnctls)a2ua( p;o0apeoiictasls rm( pn()alxrmocootfpt  iei;()srtmim oy1lm nlfvsasf rumuront0tptn i3tys m2ra(vo;u) leomoctydfm rlneslt0s2xmir oodomeemnci t)srum( pot4tlx mociatfm2uanmpnt4tlxrxo iotfaDrluesls  ruo(r3iudomeelnvslsf Dtau pnu1aetnifeiytfm el(mp u4 lenir iotoa e nvol( trxr(o3ny1omt mnvta() 2uru o;o4alx  f3tlt a2elu o t0altnmfciatomt  nvil( trumiopny4lmte icsl(f Dum(rpoo4tpt mociyd a2um(mp;()alermf oadfmtelivs s sruoim oydomeelnvs t) rraxmo;u4tleomieiyt mDeaumont0alxoxfciodfaD auei (0 2xo(opou4lp e fcsltfsDum( p;u4oee  ieiyslm2ra(vont)aetrif ootomD auvol(0sexo(rpnu4ope mivslt s2taumpno0apeomf3iatls emn pn() rtrif iy1fmtraneils srxoxr nu1ape lieiatfsDtmxronu0tex moeilt a2eau s (4 eenmf3iytoaDe i ol(0t2toir iu1ol  micsl( s2tmx  ou4olxomfeils s um( s;u0tltomr oo1fp e ieo;t0t2xoimpou1lpt lfvs s) rrm(mooo1teenmfctydls2uauvs;()aetoioctotom rlneil(0 2urxr3iy1omtn fesa() Draur ot1aee mi3tydfmDumnmp (4 reoxfcoo1omtr n il()t2toimpiu4oltnmfcsas)srrm(m ;t1oleoioctldfm elumpn(0artnxfciodoat livils0sexmirpoydop emfetas  rtru  nt0olxn ociltla ulnms u0aexomocoydlatr ivolt0s2xm(rpnudlm e fvilt s2taurono0ale ii3tat m2eanmpn(4tlermo tydfp e u o s0trtr(opio4amtemicsas a2rrx o;u1tlxn octaslm umu p;u4 rxrxo3io1fm   u olt t2urxrpoy1amenlfvilsfs2tm( pnu0aptn o3tat m2em( o;t4tlxrxf tadlat aueo t)sexm(rpno1lmeemneta(fsDum(r oo0aeeomi3tas s2ua( s t4aleoiocoytfm   uvs t0 rxm(mpio1op n nesatfsDuax pnt4alxo ociyd s2rmnmo;u4 etomr3tadlptrlivo ()tetmimpoy4opee neil( sDrrxrpnt4tpxnmi3ilsla2um(mont)alenmo oo1latr u ils)s2umim3oudlm   ivtlt)arua(r ;t0optnif3iydlmDrmnvonu4 lermf oa1lmDr uei t  2tmim3nu1openmfeilt aruax  ot1aptoif3tyd mDulnvs;t4aetrxr3ia1lmtrln s;()trxrim3no4ol  mfcs s)arrmx poo1opx miciys a2emn p;u4aexoif oytlpteauvolt t2tr(o oo4llee ivslt a2rm(r ;t1tetn icilt s rm( snt4 lenxf3io1fmD li o;() rxo(m3oy4omtelnet sf Durxmpoo1tpx moeiatlm2rluvpn() etnmo ta1latrlivo;s seuoxr3ou1lpee icilt)arurxrpou0aexnifetytfmDem(vs u) exoxrcootfpDrai olt  rtoir ny4om elneta(f 2rmxm ;u4olenmociltfs2ulnvpnt4tlenxr to1fmteauvs (0 exmxopiy4lmenmfeiat s2ta(rono4apxnmicildls ea(msn(4tlerxo3iy1opt  ues t)sruoimpny1lm n fvils sDrmu  nt4ole ifeiasfsDea( s;u) reoir3oatfm  auei ( t2xm(m ny1olt mncs t  Draxr ;u4aeeo o3iys s2ua(mpnu4tlxrxo oo1oa rln o;( t2um(r io1opee netlsfs2rmxr oo0texo ieiyt s2uanmp u4treomr3to1fatrlueo;(  rur(r ny4amtemfvtas)sDtr(mp;o4aex ii3iys m um(vp t)altrxf ootop rai o (0 2xoir3oy1opeelfvs t)srrmxr nu4olxnif3iydla2ranmo;u0teeomrcoatoat liesl()srtr(m io4amte nvtasf 2tmxmono0tltoii3iltfsDrmnms ()alerir iytlaD ai i s0trtm(m3iydllenlfcsls srur(r nt4aet iiciad m umump (0teenifctodfm ranes;t) 2tmiopiu4amtnlict () Durumo;u4oee iictaslaDulumont)arerxf3tatfm   u sls0srtr(r3oydalt micsls  ruaum ;u0apen o3tls a eauvon()trxomr iydlm rau ils0 2uoxmpiu4amt  iet (  Dra(m nu1oexnioetadfa rauvon(4aetoxf3oadoa eau ils) exrimpny4lm nlfviltf Duax poo0alxn ictyt a2uluvo;u0 eenmfciytfpDrlueolt)s2triopiu4lme  nesatf Drmump;t4apenmieildlsDea(vp t0 eerxr iatfm   i s s0 2uo(mpiodll n icil()aDrax o;t0opxn oeiat a eauvp;u0arxomocty1fm eli o;(0s2tmirpiu4ol  lfvtlsfsDtax  nt4oeeomfctyd mDrauvs;u0arxrir oo1oateauei s t2xr(r nu4ope mneilsfaDururpnu4apenii3tatfa2ea(mont4aeeomrcootoa raivilt0trxm(mpou1ameelnvia( srrru p;o4altomi3iasfm2el( p;t) rxrmfcoa1om   nvols srxmir3oo1lmen iei ()aDtmxrp;o0teeomfciadlmDumn pn(4 lxoiocoatfmDean s s0seumim3no4om   ietls) Dtrxmoot1oexnifciyd s um(vp u0trenirciodfaDe ues t0srxrim ou4optemiei s  2tmxmp;t1tpt  fcild a2uanmo;t)altomo3oy1oatr neo;() exoim3iodlmtnlnetls)s2ra(  ;t0aeenmictydlsDumn pn()tlxrxf oytomD ai i (  eum(rpoodlpenlneia( a2raxr ;u4alt ii3iatla2eanvp (0 etrio3iatfpDraneols setrxrpno1lptelnviltf rtrxm ;t4tptnioeiysfaDulnvs;() rermrcoadopDraivslt)setrio oo1ol  lncs s)s2tr( p;t0tee io3tyt m2uanmo u4areomf3tytlpte ies;(0 2uoxr oo4openlfvsasfartr(  ;o0aetnmocilsfmDumn p;u) lxnir todlaDranei;t)s2toim3nudap nmfet ( a2rmumo;u4aleo o3ils m2rln o ()tetrmo3oadlaDrai il( setmim3nudome mfeta()a2rrx  nu0altomoeildfsDrln s (4altnmrcio1lp elivslt0srtr(o ny1apenmncsl(  rrrxro;o1apenioeilslm emumpnt)tlxrxo3todfp rlneo ()trxrxr3iu1optelies s) rua(moot1altoio3tatla rauvpnt0 lxrmr oytla ean i t)texmxopoy4lmeemnetat)arumx  ot4tpxn f3tas m2em( o;u) renxo3oytfp r nvo;s  rxmir3oudlpeelfcs (fsDraxm ou4oee  oetltlm rmumo t4 rermfcto1lateaneilt0 rumxr3iudape lietas) 2tmu  ;o4ape miciyd m eanvo u)altrirciy1oateanes;( trxrxr3oodom  mfcta(f Draxr ;o4olen ieias m2rm(vp (0tltomfcta1fmtrauvi t t2ur(opio4aptnlfetas  2rrum ;u1tlt  iciltls2el(mp u)artomr oa1opD li s ()t2triopoo4aptn fvsl(f Dtmu pot1teeomocilt aDra(mo;u0teeoxo3iytfa   ivolt  exrxo3ou1omen fetl(fsrrm(ront4openmictatls2ulumsnt4 exrif oatlpD  n ol( texrio oo1lptelfeias)sDrr( ono1texn ociasfs ua( s;()altoxo3ia1omtraivs;t0 exoxm iu4opeelictltf Durumpnt0ole  icilslm ranmo;u)trxoif3iadopDr ieolt trumir iy4ll emnct sfs2ta(m no0teeomicils s2umuvs t4areoir3ia1laDeau olt0 etoio3nu1lmte nctasfaDrrxr ;u4oltomieiysla2ranvsnu)aeenxf3tadfmD auvil()sruoio ou1al emfvsat s2taumpno4altn ieiydfm ulnvp;u)arxomr3oy1fp  lueil(  euo(r ou1ame lici s)a2rmxm nu0aetomfctysfs2uln s;(0tltnxo oo1om rluvi;( sexrio3ny4optnlnei ( aDururo;o1optoioeildlm2umums;t4 lxnxr3iotlmD  uvslt sexoxr3oydlp  liesasfaDrmuroot0aeto ieiysfm umn snu4artnxo3totomteaueo;t s2umxm3ny4lpe  nes sfsrrrxr ;t0opt  oeiat aDean s;u4trtrxrcoytfm e n ilt)teuoio3ou4ap  mnvt s a2uauroou0oetn ocildla um(vp (0tltniociotfatr nvols t2uo(mpno4omeelfesas  rtax p;t1oeenmo3iysls2umnmont4aetrio oodlmDr nei;(0srumim ou4lmenlfeiltfaDtrxm oo1altnio3iyt a rmn ont) rtnmo tytfpDrau sls)texrxo3nu1ole  fvtltf 2rm(  no4tlxn o3tld s ea(mo t4 eerxf oy1fmtelieols sruoxo3oodomen feilt) 2rrx pnt1aexniicilsla uaumo u4tlenif iatfp eli i;( trtoio3oydllen nci s srrmxmoot4tetnioctatfaDumuvo () etnifcootfateau ol( t2toxmpnu4lpeemfet s s2tm(mp;o1opxoiieils s2ra(vonu0tltrxf iatoaDraieil()teumir3oodlm elfcta(faDtmx oou4oleoif3iysls2ran s;(0 ltrmo3tatfmDraivo;t)trtrio3iu4omtemfvt ( aDtr( pnu4tex iictad s2rm(vsn(4 renmfctodoaDelies;t0 2xoimpou4lmtnmiviat)aDra( ono4tpt mf3tltlm2em( snt4aexoircoadfptrlueo s0 2ur(rpoudame lfctasf Draumooo4oee mocils sDeln o;(0 rerxr3iy1lp r nes;s0t2xrim3nodame mivtlt  rtmurpnt0apxn oeiys s2emuvsnu0aetrmrctadoaD ai ilt0trtriopno4lltn ict (faDumu  oo0tpxn icildlsDelnmo t0tlxrirciydfmD au o s  2tmxrpio1am emncias)a2um(root0opto fetyslaDranmo;()arenxf3tydfa e nesl(  rumio oydoptemnei tf ruaxmp;u0tex mf3iys mDem(vs t4 ltomo3oodlmt ln i;t tetrxopoo4lptelnvs ()sruax  ou1ape micildls rmnmpnt4alerir totlmD li ils trxo(m iudop   fcs t  Dumurpou0oleo o3iasla umn p u)aexomfctydlaDeaueils)t2uriopoo4optnlnvtasfs2ur(rooo4olt mietlt a elu o;t4arxomo oa1omtelu i;(  2xoir iydopeemfeslt aDtmump;o0teto o3iltfs2uanvont0arerir tydom rai o t0srxo(m no4lm nliesltfaDra(root1tlt iociltlsDelnmpnt0altrxfcoydlatr ueo t0srtrxopiudll nlnvsa() 2trum ;o0apto
\ No newline at end of file
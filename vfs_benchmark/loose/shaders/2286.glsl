@@ -0,0 +1 @@
+nvo s setr(o3iy1opt lfesat)arumxrp;t4oex  f3iyt sDua(msn(0aexnir iydlp e iei s0t2xoxmpiy4apeemfeia( srua(moot4olxo o3tld s umumpnu)aexnir iadop raneo;t0srtmxm io4apeemnctl() Dtau ooo4tpx iieildla2rl(vo;t)alerir3tydfmtr u i;t  rtriopny1op n feil( arurxr ;o1tpxo o3iad a2el(mon(4tlxoiocoy1opDrli i s t2ur(o3iy4am   fvsls  rtr(rpnu1aptn fciadfsDrmu o;()trtomo3iydoa eaivi;(  rumxm ou4ol  miei () rtaumono1teen fciltlm rmnvpn(4 rtrir3oytomt luvslt  eum(r3ny4lpt mfes ( aDumxmp;t1aptnifciydlaDumu p u)tetomfcia1op rai s s0setr(mpio4am nlieil(f 2tru p;u0olxo ictatfsDel(vo t0artnxr io1fpteluvil(0texoio3oudlp nlfctas) rurum oo1oee  f3tasla ul(vo;(4trxnxf iodlm rlneo t) exr(r oydap nliciasf 2ur(m nt1aee  f3iasfa2ua(ms;t)trtrmrcoo1om r ieo;() exrimpoydap   nci s) rrrx poo0alxn o3iydls ea(vsn(0aetoxf io1lptrlueols0srxm(m3nudoltn fesa( aDraumoou1tpxoifeiysla ranms u4tleomr ta1fmDeaueo ( teuoio3nydole lfeta(  rrrxr no4tltoifcias s2elumpnu)tlerif oydomte ivslt0 ruo(r3io1ll e icsl(f 2urx  nu1aleo f3tls mDranvo;(0 etoxo3iatfpDrlu ilt0texm(o3oudolt lnvia()srtaxmpoo4tle ifeiltfa emu p u4aetnmfcootoaDrlieo (  rxm(mpoy4amenmictltf rtrur ou0altoiietasfa eanmp;u) rxrxrctytlateln ol(  exm(o3no4lm  lfvi () Dra( o;t0texo o3tasfs2em(von(0texriocoadopDr nvolt0 etmxrpnu1lm emnvta(f Drrxroou0apenmo3tydls2rmu pn()aexrmocta1fa   uei t)trxo(opno1llte nvsl(  rrm(m ;t0tlt iiciatlaDrl( s;t)aleoif oa1fm elu i s  rurxr3oo1om e net t)sDrax oot4tet  f3iatls uluvs (0trtrir3ty1lpteaneo (0s2xoxm3oo1ap  miei t)sDraxrpou0alxo oeiytfs ra(vp t)aeenxr3ootopDeli i;t s2um(o oo1lltnlivsat)srtru ont1oltomoeiasfsDumnvp;(0 rtrioctotfpt  uvil(  rum(r ny4am  lict t srtmu poo0alenmoetaslsDrauvont4 ltomr oatlpDr n o;s0trur(r oo1ll nmncsls) Dum( o;o4alt  o3ilt a emuvpnu4 lxrif3oodfptrlnvi (  etr(r ou4ll elfctat  Dtaxmp;o0opx ifctad sDea(vsnt)altrxr to1fatr uvo t seuriopiu1am nlictat)sDumxrpnu1tetoiociat m ea(vp (4artoifciodlm e neo s s2xo(mpio1optn fcs tfs2ur(r no4aeeo iciytlsDulnmon()tlxrmr3oodom eai s s  etoim nodom nlict (fa2rrxr no4tlenmf3iydfs elnmont4tlerif oo1oa eaies t0s2xoxm iudape mnci t aDtr(mo;u0opto icilslmDuanvp;t4 lenio iydomDrai o;s0 rxrxo iydop emnetat)srumum ot1oleomociydfs ea(vpnu4trxnmrciodfm rluvo t0 eum(rpio4llenmnci t)srtmu  oo4olxo oeiysls rmn p u4arenio3iotfpD aueols0srtrimpoy1optemictl()a2rmurpou1aeeoio3iytfa emnvpnt0aetrircoytlaDe ueo (0srxmimpou1lle mietls s2tax onu0oeeo oetls aDrmnvs;u0trtrir3iy1lpteliesl()setoiopoodlpe mnvils)s2taum no1texo f3tysls umu pnt4aexrxo3ia1faDr iesls setmxm3iu1ll emivtl() Dumum ;o4teeo iciatlm2uaumsnt4trtrxf3iydla eln s;t t2trxo3iudale  ieslt)s2trur no1aet io3iatls ua(vpnu) etrmfciy1lp rli i;t0t2umxo oo4al   fcsa( a2umxmpno0oee mietldfs2eau pn(0tlxrio3tytfm rlu sl()teuo(o3no1lm elnes s  Dta(  nu4tpe  oetasfa2uanmp;(4texrmf oytfmtelues;t  2xr(m3ny1ameelict (  rur( o;u1aetn fetlt aDul(vp u) lxoxo3oodfp  lies;() 2tmio oudlm nmnesls)sDtm(mo;t1apeomfcilsls2rmumont) leoir oadfatranes;t  2umxo iudomtelneia( artaum ;t4tetnmi3iysfsDemn o;u0tltoxr tydlp  ln s (0 exo(r3iodop elfct s sDrm(mo;o1texomfcilslmDelnmp u0alxoxfctodlpDelneolt trxoim3oo1oltnmictlt)s2rmumpno1oee mociasfa2emuvs;t0tlxrxociydoa raivslt)t2xmimpiydlp emnvta()aDrrump;u0teto feilslaDulnvont) lxnif3oydfpDelivi;(  exrirpoy4lmtnmivsa()s2tr(ro;t1opto o3iadfm2eauvsnt0teerxf iydlate nvo ( trumxrpoy1omenlivias  rrmu onu1opxomfetldfa emuvpnu4alxoircoodop   uvilt)t2tmxopiy4olt  icsat)sDur(m ;t1optnioeiadlaDrl( o u0 reriociy1lmDrlu il() 2xoxo3ou4lp n fei tfa2tmxrooo1tex ioetls s2uau o;u)tlxoioctotlmteau ils)sruoiopio1aptnlnvils  Dta(mpno4oeenio3iltfs2ra(mo u0 rxrxr totlmDe neo t0 rto(opno4apenlncsatf 2trxmp;u0apx  ociysls2umuvo;u)aexrmf3todlm r ivsls t2toir ou1lpenlfcil(  2ta(rp;o4tpt mieiasfs2rl(vs t0trtrifcoy1lptelivs;(0t2trir iy1lmtelict sf Dtmx  no0alxo ietas a2ulu pnu4aeerxr oydop eai o s srxm(r3iu4lm   ncs (f 2trxmpnu0ole if3tldfs2umuvpnu0alxrmf oytfm  lu i t0 rumimpoodolt mfei t s2uaxm ;u4tltoii3ils a2eanvont4 etrxo oytomDr ues (0trurxopiu4oleemnvil(  Dur(  nt0tle  f3tad mDrl( s u0 lxnir tytomtrlnvsl(  2umirpnodalt  ivsls)a2ur(rpou1alxo i3iydls2ulump;t0 ltnxrcoa1lmDe u sl(0srtrxr3iy4lp e ies tfs2tm(m no0opxniieiadfs2elumont) rxnmfcoytlpD luvi;s s2urxmpiydap  mfetl(fa2tr(r ot0tptomo3tyt mDrlu p;t4aeenxoctytlat lues t0s2xo(m3nudoptnmfvta(fsDrmurooo4alenifciadlsDrmnmpnt4 rtrmr3oatop r ieslt) euoim3no1llee icia(  rtaxrpot4tptoiociatfmDrmnms;t)teenir3tydla raivils t2xm(r ny4llen fcia( srrax o;u1tpenmicilt a rau s;(0trermo oadoaDe ies;t)tetoir3oydol emfvs s sDtmxmpnt1aet mfctldfs um(ms;u0texrxr oo1lpDr nvolt0t2uo(r oodlme mnct (  Dtaxmoot4opto ociydfsDrmuvo;t4aexnxfcoadlm  lu s;t s2uoio oo1ame lnctls)s2tmxmp;o1oexnmf3iatlmDrluvs t)arenmoctotoaDrlues;s0setoxr ou1lpt lfviat sDrmx o;t4tle if3ilsfm ranmo;t)altoxoctodlmDrau o t)srtrimpoodom elfvils aDrmxmonu1apxo fcild m um(msnu4altrxf3ty1fmt luvs t s2umio oo4lm  lics t aDrrx  ;o1tltn feiltfsDeaums;(4 rxrio3oytlptranvsl( s2xmxr3io4amtnmiet s sDurumoot4aetoifciasfaDrlnmsnt0artnmo iydlat lnvols s2toxr oo4lm nmnvsa()s2taurpoo1olto f3tas mDumums (4 lxomo3ootop e uvol(0srurim3iodll  livia()s2ur(r ;o0tptnmi3iaslaDul(ms;(4 eenircto1optrlnesl(0sexo(o3oo4lp  lfvsas) Dra(rpnu4opxo f3tytfa umnvs ()alenxo3iytfateli i s) eumxr3io1apen netas  2rmu  no1tetniietyt s2umu ont0alermfciodoaDr uvo;s setmxrpnu4omen fvt (f rrmx o;u0opxo fciltfm emu o;u0aetrif iadfmtraivslt0teurimpiy1lmtemfesa(  rrau pnu4optomoetatfsDum(vs;u4 rxoio iydfpDe ues (0s2toir3io1omt lfvs t)arra(r ot1alenifciyt s2ulnvo t0trenio3ta1fa eauei ()srxrxrpnu1amenmietasfsrtmxro;t4tee  ocild s ean o t4 lxrmo iodlateai s t0texoxr3iu1amt  ici () rrmxmooo0tleoifciltls ua( on(4trxomrcta1om   nes;t)s2tm(m nudamee iei (fs2tr(rono4tpeomoeiltfa2ulnvon(0 rtoxo3todom eluvsls trtmxopio4am  lfcilt arrmx p;u1tle  feiyslaDeluvs;(0artrxrciadfmte ivolt) etrim iudom e nvtlsfa2trx oou4tltomi3iltfa em( ont0tlxoir3io1lptraneo t tetrim iy4lmenlnciasfa2ta(rpoo1optomi3ildfaDrl( sn(4 lxrifctytfat  u o s0t2uo(rpoy1lme  feiasfa2ta(rp;u1aetnmicilsfa2rm(vs;() rtnif ia1om rlnvo ( srurxrpoodal  liet t srur(mont1tpeoiieiasfaDem( s;u0artnxrctadfp eaivslt setoirpoy4ale mivi ( aDta(rooo0aexnio3iatlm2ea(mo;(0teenmf to1omtraueils  exmio nydll   nvs ( a2ua(m ou4tlenmi3tyslaDrmuvpn(4aeerxr ia1fpte neils0tetrxmpnudome  net ( s2uaxmp;u4tltoif3ildla umuvsnu0aetnif iy1omtr nvslt0t2umio oy4al emfei t)sDtm(r ;o4alt  f3iad s rau o;u4 rerxoctadlpt  n o;()teurxmpoydllen fvia(  2raxro;t0apt  iciydlm elump t0tetniociydfmD  u s s  2xoio iydap e nvs t)a2urx  oo1aetnmocias mDrmu pn(0 etnxo3iydfa elnvo s0 rurxo3iu4lpee nvi (fsDumx  ;t0tpxnmieiytfa2uanvp;u0trxoifctadomDrauvolt) etr(r iudlpen nvia(faruaumpoo0tpt iictytfmDem( o t0trxnirciadfa e ieil()t2urxopoudlpeemfvsat)artru p;u4tpxn ieiydfmDeanmp;()aetoir oodlptrauvs;( texrxm no4amtnmnvtls)sDur(roou0tlxo ieiasla2um( p t0tltomf iodoatr nvs t0seurim3no4op nmfcias)sDur(rp;o0oltn i3iasfmDrm(msnu0tlermr3ta1fmD  ueils  rto(r3ny4lpe mnei s) rtrum ;u1aeto iciys m2rl(vs (0aleomf3iotfat  ivi;s s2urxm no1aptelnctlt)s2taxmpoo0tex  feiysfmDulnvsnu4alxoxf3oadlmt ln i;t s2xrio oy4ope lnvi t sDrmxronu4opxnmieilslsDraums;t4tlxoxocoytla  ai o;t)s2uoxm3iu1lle livs tf rtmx pnt0oltn feilt mDulumo;u0trtnio3tadoaDrliei;s seuo(o3io1amt lfci t)aDtm(roou1open oeiatfa rmnvont4tetrxo3iatlm eliei;t0teurxr3oo1llt mieslt)srtaumpoo1tpt moetadlaDulums;t4texrxf3todfatrau o;t)s2umxo3nudlpeelnet s artrxmoot0aet  ieiltfa2rmnvsnu) ltoxrcoa1lmD  ieo;t)trtrxopnu1ale  ivsat srtmum nu4tetoii3tltfaDrl( on()alxrxf ta1fmtelies;(0trtrxopiodllee ies tfs2uaumpou1tpeomo3tytlaDel(ms (0areoxf tydoat  ies;(0sexmirpoudop emneias)s2umu pno4tleomo3ildla elnvp t)arenmf3tatfateauvi s srum(m oo4amtelnvsl()a2ururono4alx ifcilslsDum(vo;u0 rxomf tydomD  iei ()trur(r3oy1aptelfvtas aruax oou0tpx ioeiytfsDrm(ms t4aetrif3oodoa r i i (  2um(mpiy4ole lfct t)sruau oou0opeoii3iltls emu o u0aeenxrctytlm rauvo ()tetrirpno1amen nci ( a2tax  ;o0oexn fciydfm2eanvp ()trxomocoy1fpD anesls0seum(opoydalte ncs (faDurumpno0tlxomi3iadfa2umuvo u)trtrxoctatoa  au i s0seumimpnydlmtnmicslsfs2rr( p;u4alt  fciltlsDeaumo;(4texrxf iytom eliesl(  2xrim nudopen ncs (farumur no1aee if3ilsfm2rlu p u0 rxoxoctatlatrauvilt0srurirpny1lp nliviat  rraumo;o1tlt moeiytfsDrau p t0alxrmr tadom r uvi;t  rxrxm iydllenmiet t  ruaurpot1apxnii3tatlm2rmn sn(0tltnxo tydomtrlueilt tetmir nu1ole mnei ()srtm(  nu1tltnmi3tasla eaump;t4 renmf oadop raivi;t)seumxmpoy4aptelfvsas aDumumono0tpeo feilsfs elnvo t0 etrio ootlpD an o (0truo(mpoo4lme  fcsas) ruax pnu1oltnmoeiytla rl( p u4 lxrifcio1fatr ivo ( trto(r3iydlme miesls) 2tmur ;t0olx mfciasla2ean p (0teenxo iatlpD aivs;()teurirpiydom nmiei tfs2rm(mpou4aetniieils sDemnvp t)aeeoio iy1fp e uvs;s0 eto(m3oo4lp n fetat)srtr(moot4teeoioeias s2em(msn(0 ltrif3oy1lpDe neols0t2umxrpnodap emnvt tfarrmumpot1optniociysls um( on(4trerir3iatoa r ieo s) rtmxm io4olenmnetltf Dumx  nt0ape if3iyslmDra(mo t4arxnmrcoadom rauei;t)trtrxopnu4lm e ncsat) Dtaur ou1tpenio3tasfmDeau o;u4trtrio oa1oa elies;t)trxoxo oo4opeemivtat) Dtaur nu1texoifctys a emump;t) rxnif oadfa elu s t  2urio ny1lpee ies ()artm(m oo4tlxnioeild m el( sn(0altrmrcoatlmD anvsls0s2xrxrpnu1om emietlt s2um(roou1aleomfciydfm eanvs u4aexomrcto1oa r ues;t0tetoir3oo1altemfct ( sDtaurpno4aptn fctydfm2eauvont0 rxrxrcoa1lmteln ils)trumio3ou4oleelfcs sfsDrmumono4tex moeild m2emn snu0aexnio tatomD aneols0s2xm(m no1al e ivil(fs2uau oot0tptniietasfsDumuvo;u) lxnxo3oa1lpD aieslt) rxoxr3io4lp  lnesltfaDtr( o;o4oet mi3iysla rau o (4 lenxf iodopDr ivi (0 2xmio ou1aptelivsat) Dur(m ;t1alx  feiadfa ean o u0tleomfciy1lmD lu s;(0 euoim oy4lmtnmfesl(fsrtaurooo4tex  ieiydfaDranmpnt)aetnmocoytlp r ivo t t2um(opiudamenlicsasf rtr(m ot4apxnmiciasfaDranvp t) reomoctatoatr u ils0trxoir3oy1oltn fvsat) 2tmxr nu4aex ioetlsfm2ea(ms (4aleoxr3oydlatrlu o;( truoxm ny4lme lnetatfsDrmxrp;u4oee  feiytla2ulnms (4trtomfcoa1fatr u s;t)s2xoir3io1lm emnesa( artru onu1oetnmf3iltls2rlnmp ()altomo iotfpt lnvil() rxmio3nudlmteliet sfsDuau pnt4ole  i3tatlm ul(mo t4alenmf oy1oaDr nes s0 rtrio iy1openmfcta(farum(mpou1tpt  iciytlmDranmsnt4arxomr3to1lpt  uvil( seur(m iu1omtemfcilt)srrm(m ot4olxo i3iasfs umump (0aexrmr3iatfmtrlieolt)srxoxo iy1olen nctls)srrmuroot0texomiciasfm emuvo;u0 eenxf oodfa r n s s0 etr(m3oudal  lnvslsfa2umxr ;t1aexn f3ilsfa2emumo t4tlenxrctydfpDraivi (0texmiopiy1lpe lnvt (fs2rr(ro;u4oetoif3iytfaDrl( p;u4 reoif3oatlaDeauvols0srtrxm oy4lmtn nvslsfsrumu  ;u4tpen o3iad m2ulu snt4 rtnmr totfpDr u o;s0s2toim nu1lpt mfeiltfsrrrurpno0oexniociaslsDumnmpn(4altnmfciy1op e iei t srtm(m oodome lfeiat) rtaumpoo1tpt ioeiatlmDel(mo;t)texomr3ia1fpDe nvo ( t2trxm nydape  ivtls a2tr(ront0oetnio3ildls rl(vp;t0trtrif3ia1oaD  u sl()tetrxmpnodop nlnct sfaDua(ronu1oeen ietyslmDemuvp;t0 etoxo3to1fmteaivolt s2xo(o io4ame mnvs ( aDrmurp;t1tex if3iydlm umu p;(4altrio tadlpt  ivi s s2xo(opiudlm n ieta( srta( pnu1tpx mfctyt m rlumsn(0alxnif iadoaDrln i s t2um(r iu4op elicsl(faDrm(rpnt4tptnioeild sDulnmo ()texomr iytlmDr n i;s sexm(m iy1lm  mnci (fsrrrurp;o1apto fciltlm2uaumsnt4aexnif3totomD  nvi;s texr(o3io4lle lfvt sf 2rmu pno0tltoio3tlslm rl( o t4trtnmfciydfat lues;s0t2xm(m ny4lleemncs s a2taumpnt1tltnifciyt s2uan pnt0altnmr ta1laDr ivsl(0s2tmxmpoudlm nlfvslt) ruru  ;o1altniictlsfm2em( snt4 exnmr iotlaDrluei s)t2xoxo3ny1lp n ictltf Dum(mont4tlxomo3tad s ra(mp t0altoxfcoy1laD aivil(0t2tmir ou4lm emnvt tfsDtru pot0aeto f3iyd mDrl( o t4trxomociodlat aivo;t texr(m ny1om nmfcias)a2rr(  ou4tlx mfciysfs rl(vp t4treomr iadomtraueo;()tetr(r3ny1olen fvi tfaruru onu4apt if3tyd m ean p;t0aexrxociotomDrlnesls0truo(opiy4lp nmics ( aDtmurp;o4olxomf3ild m2ra(vs u4arenmo oytlptranei s0 etm(m3nydlmt lncslt) 2urum ;u1oet mo3tls m umu o (4tetrmocoa1op rli i;s  eum(rpno4lpee ivi (f rraurpnu0tltnioeiytla2rm(mp (0aexrxrcoytfmtr nvs;s0sexrir oydlm   fvi ( srtaurp;t1aeeomoeiysfaDum(vs u0aetomo3oa1opDeaivils) etmxo3iu4ll  licil(  Durur ot4tlenifciatlm2eluvp ()aeeoio ta1oa e nvi t srumio ou4llee fesat arraumont0opeo fciadfm2em( o t0 eerxocoy1fmt auvs ()s2umir iodlme lietltf 2uaumpoo1openii3iatls2um(mo;() rtomrctydfm elnei s trtm(m3iy4am n fvslsf rrrur ;t4aexn ietltfa2rm(msn(4 ltoxf iytfmD  uvs;s0s2xrimpiodolt lnvi ()srrmx  nt4ole moctat s2ulnmo t)tlxoir totla rlnvs;t trto(m3ny1apeemfet ( srrm( oot0apenii3iadlmDel(ms (4tltrio ia1omDeaivils trtmiopiodopenmnvt t sDua(  oo4apxn octyt s ul( o;u)texoxfcoo1faDeau i;t0 rtmir3no4lmen nesa() rurumoot0oex mf3ild sDel(vp;(0tetnxo to1fateai ilt)truoxm3nu1al emicia( srtax o;u4oetnmietytlaDuan on(0arenmo3oytoat  ieslt  ruoir3iu4lp   iesl()srtaxmono4opt  ociydls2eauvo;t) exrmf todlpDrlu i s0 2xoxo nodlp nlnvi ( sDtmx  nt0tpeomoeiasfmDra( o t0aexoio3oo1fmte uvilt) etr(mpnodope mivs tfsrtrxmoou4olxniiciad m ea( p t4tltrxf oodfmDeli i s)sexr(mpnu4ll emnvi (  Dtr(monu4alxo fciadfsDrl( sn(4 lenirctadomD luvo;t)srtrir3nydam nlict t) Dumur no4tlxnmo3iltfs2ea( o;u0 rtrxo3todfa  luvs t)s2toxo3nodap nmivtlt)aDtr( o;o4tpx  o3iadls2eanms t4 ltnxf3ia1lmteau i (  ruoxr oydal nlieil( sDtmurono1tetnmfeiasla2umu o;t0tlxoxoctodopD lnesls)trtmxr3iudlpteliesa( s2ra(m ;u4oex  fciydfaDran o;t)aexoio3iodfaD  i o;t0 2tm(o3ou1ap elnvt s) rtax  ;u0optnmoeildls2emnmo;u0 etriocoytla ran slt0setrirpnu1omtemivtls sDumu  ;u4tee mfeiytlm2rmnvont)aleomo3iatopD  i sls)srurio3oodal emfvtlsf 2urx  oo0oeto i3tys a2um( o;(4 ltoir3oa1oa r u o;s)s2xoxrpnydopenlicsa(f rrrumpot0optnmi3tysfa uluvo u0trermrciadopt li i;(0 rxoirpny4alenmfetls aDtmxrpot0apeomi3ildlmDuanmo t4tlxnxrcio1om  luvs () etmiopnu4aleemnciatfsrtruront1aet ii3ild s2rm(mp u)altrxrcoytlpD  uvi ()sexo(o oo1lmenlncsl( artrumpou1tpto octyslsDeanmp;u4tetomr3ootfate nvsls)tetmxr3no1ale mfviat  Dur(r ot0oltoioeiltla eluvo ()altrxo3ta1opDeaueol( srxrxmpou4lpt lnctl(  Dra( oou1aexnmietldfmDrl(vonu0alxrxf3ta1latr ies t)t2trim io1alt  nciasfsDrmxmpou0aeeomieias s2umuvp u0trtrxo iadlmteai ol()tetmiopoudllenmics s)aDtmx onu1tpx mi3ilsfm2umu s;u0arxnifcto1lmD luvsl(  2xmxmpou4openlfctlt arua(m ou1oeeomoetys s uluvo;(0teenir ta1fmD au o;s0 2uoir3iu1omenlfvslsfa2ua(ront0alen oetas a emump t4arxoir iatomD lueo ( srtriopiy1aptnmnes t)a2rruro;u4apt ioeiadlm rluvp;t4aexrifcoytfpD ai slt0 2xr(mpoo1apen fetasf Duaumpoo0olxnmi3iadfs2umnmpn(0aetrxr iodlm  lneo;(0 rumio ou4lpenmieslt)sDrm(r ou0olen f3ildfmDuan s t) ltoiociotlateluvi;(0srtrxo3iy1opee fciat)sDrrxmono0texo fcildfa2rm(vp;t)alermrcoatlpDe neo;( s2trxm3nu4omt lnciat)arurxr ou4tlto ietytlm umnvp t4alxomrcoytfm elues;s  rurxopoy1ame  nei ( aDraxmono0aptn iciys aDul( on(4trxnio3iadomt li sl(  rxoio3oodlp  lfvils arrmx ono1tlt moeilslmDrlump u4treoxf3oo1lmteaivs s)srtmxm oy1lptemici tfaDtr(mo;t4tet mfcilt m2ul(vs (0arxnmf ty1lp  lues t trtmxrpiu4omee nvsas  2rmu pnt4texnioctyd aDuluvon(4 etnxr iytoaD lues t texo(o oo1ol   ieias  2tmurono0apx  fctadlm umnvs;t)trtoxf oy1lp eai s;s  rxr(r3ou1alte ieia()a2um(r ou4oexoiociysla eau o t)altrir3ty1fp  luvsls)t2toio3oydlp nlfvsls)arum(rooo4olen ieiltfm2em(monu0 ltnxociydop  lnei s0 exoxo oy4lptnlfvtasf Dum(mo;t1oetoii3ilsfs2em(ms t4texnxrcoytfaDelivolt0seurirpiy1lltemnviat aDurum ot0aexn fetysfa rmn p;t4arerio3iytfpDeaueolt trtrxr3oo4ol n fvi s) Duaurooo0ape  oeiad sDrm(vp;t) etnir3oatfmDrlueo t t2xr(r3ny4ll n fvslt)s2rm( p;u0alto feiatlm2ean p;t4 rxrmr ty1omDeluei;(0 rurio ou4om   nci s  2um(roou0apxnmf3iltfa2rm( s u)trxoir3tytlmD  ues s) 2urxm iy4op  lfvslt)arumumpot1ole  ociadfs2elu p (0trtnxf3iydfp  au s;t)trumxm3ny1ol e ies ( aDrm(rpou1tet ifciytls2rmuvo;t0artrxo ootoptr ueol(0tetoxrpiu4omt mncil(f Duauro;t4oeenmi3iys mDrmn p (4arxnxf3io1fm eaivol(  2xmirpnu1am emfeil(fsDrau ono1tlx ii3tydlaDulnmo (0 rtniociotomt ln o;t  exmxmpou4ame mnvta(farur(ronu4tlxnii3iat a2umnmpn()teenio todoaDeaneol()s2tmim oudom nlnvsatfsDraxrpou4aeto f3tldlm2elnvs;() etnxr3oydom  lu o;() rxr(rpou4ole  fvs s)aruaxmo;u0olx io3iat s uluvpnu)trxnir iotfaDeluvi t) 2toxm3iy4lpe mnvsa()aDumx ooo1tlxomfeild a rlnmsnu)teermfcto1lmDrauvsl()trxmir3iodlme mfct s)artaxmpnt1tlenmfeiyd m2uauvpnu0 eeoxf3iodom elueo (  etm(mpnu4lp e feiatf rra(  ot0tleomoetadls2um( pn(4aleniocoydlmtr nes;s) eto(rpiu1om emnesat  rtmxm ot4altn octyd a2rm(vo;u0 lxnmociytfp rlu i s)texmim oo4oltn net t) 2tmx p;u4opxnmoeilt s rlums;u0areoxfcoa1opt ln sl( s2xmirpoy1apen ict s)srrau pnt1tpeoifciyd s2rlumsn(4aetrxociytfate ivil()s2uo(o nudlp n nvt t) Dtmum oo4oee ii3iaslmDranvo;t0trermr3iotfmtraivilt  2trxrpny1ap nlivi sfsDrru  ;o1tet  iciasls2rlnvp;u4artoxo3iytfaDr ues;s teum(o iodoptnmfetas aDua(  ;o4oex  oeiaslm2ua(mo u0arxrioctadlpDelivils0 rtrio3iu1omte nctl() 2tmxrpoo1opxoifetlslmDrauvs t0 etrxfciadomtr uvi (0setmirpnydaleemivsas s2umxm ot1olxn fciyt s2rmu s (0aeerioctydlpteau ils0trxoim3iydalee nvi ()srtru o;o4aeeo ietls s eauvpnt0 exrir ia1fm e uvslt)seurxopiodam e iesa() 2taurpno1optnmocilsla2uau snt4 rtnmf3iy1lp e ivsl() 2um(m3iu1olt mfesltf rumx  nt1aetnmo3tldlmDrlnmo;t4treomf ta1lpDeau o t  etoimpno4amt lfvia( aDrmxro;u4texo iciyt a rl(vo t)trerxf3oa1lmt anvils t2toxo nu4lptn fctatfs2ra( p;t4aexo ietysls2el(vo;t4altnxfcoo1lm  anesl(0texrxrpny1omenmivslsfarurxrp;o1teeo fetadlaDrln pnt)trtomoctotfm rau sl( truoio ou4ol e icsa(  Dtaumpnt4aleomfcildlm2eln o t0trtrif iadlpt aivo t0 exo(r3iu1ame mivs s a2uau ono1oex miciys a rlnvp;t) rermo3oadom   n i s)srurxm iu1lme micslt)arurx  nu1apxoio3tasfm ean pnu0aeeomo oa1opt anvo t) rumir3oodom n fct t arurumooo4apenifeildfs2ul( p;t0trenxf3todfpt anei t0trxr(m3ny4om nmfvsas  Dtrurpou0tlen octasls rm( p t) lxoxr iytlpD ln i s)t2toir3ou4aptnmfvsat)a2tmx  ;u4oexnifcilslm2ulu o t4tetrxf3ta1fp  au s;s trtmio3oodopee iesl(  ruau  ot0aee mieiadfm uan s;t0tlxoif3tadla r u s s teumim3iy4olt  neias arrax onu0aleoio3iadfa2em(vpnu4trxnxf iytfaDr i i ()texo(o no4amt lfesat s2rrurpou4tpxo icias mDul( s;u) exrxocootfmte u ilt0teumimpnodomte fvt ()srrmx ont4alenmi3iltfm2rluvo;(4tltrirctodlpDr ueols0 2uoir io4ll emivsatfsruru o;u1texnmictydla2rauvs u0aexrxociatlmteaivsls  etoxr iy4lmtemiesltfarur(r ;t4tlt  ocildfmDrm( o;u)artoircoy1oatrlivo ()t2umxo iy1lpenlnvs s)aruru  ;o1teeomietytfm rauvp;u4aeenir oydfp r n o;s t2xmxm3iu4llt  fcslt a2ua(ront1tlen ieiydls ulu snt4trenmrcia1lmD  n sls0 exrirpou4apt lnvslsfsDumumpnu0tpxn o3ilsfm2elumsnu4artrxo oodfp eauei ( sexr(r3ny1aleemicia() Drau  ou0olx  ieiat s2ua(vs u)arxoxrciotop   nvo s)srxmxm3nydoltnmnet ( a2rrx  oo4tpxo ociadlm2rau s;(4 etomr ia1laDrlieo;(0s2uoxo iudoptnlnesa()artm(ro;u0opt moeiad aDrl(vo;t0 eerxr totopteai s s)t2xrxopoo1al elfvsa() rurx ono0texoifetatfsDel(mont4aetomfciydlatraueol()tetmxmpnu1lptelnct s)a2tr(  nt4aleoiociadfaDumnmp;u)altrif iydfpt an il(0sexmxr ou1op emnetatf Dum(rp;o1tpenif3iysfmDrm(vsnu0aetoircia1lmDrlnesls) rtr(m3iy1am  lfci ()arrmurp;t4apxnmfctatlsDrmump t)alxrio3tytlpDran ils)srxmio3iodolen fvias  2trur ;o4tpen o3tldlm2ul(vpnu0 rermr3totfaDelnvs;s  2uo(o3oodale  ivsas sDtmxmoot0apeomfeiys aDrmnvonu)aeeniocoydfat auvs ( t2tm(m3iy4omenmieias aDta(rono0oeeoio3tytls elums t4aetomr iy1lmDeanvi;t0teum(mpnydopte fct ()sDrm( pno1tpt mociadfaDra( p;u0artrmf3ia1fm elivil()trxriopoodlptelncs ( srta(rpno4apeoifciytfs2ran sn(0 ltrio3ia1fa elu ilt0s2trxm oo4oltelictls)a2tmum ;t0apenmieiyt s2ua(vont)aetomr todlat aivo ( trxrir3iy4llt  icsasfarraxmp;u4oetoiieiytfm2uluvpnu0aetrifciatfptrln s s teumxo3ny1alte fei s) Duru oou1olen oeias m2el(vs t) lerifciatom e u ils)t2urxmpio4lpe mncsl(fsrumurp;t1optoiicilslsDulums t0 etoir3io1fmte u sls) rto(opoudll n fvsas  2ururp;o1tetomietytlmDem(mpnt) lxrmf3io1fpD an o t0t2xrxo no1ap elfcsasf 2rm( ono1alxo ictysls2eau pnu4tltoifctotfaD lieolt)s2xrim no1ap n ivsltfarrr(rpnu1oex io3tatfs rauvs t0 lenif3iadoateaies;s) eurir iy4al emncsa(farur(mpou1tltniieiatlm uau onu) exomf3oytoa r uvs;()tetrir iudop nmfei sfs2ta(mooo0tpt iietas aDuauvs;t4 renxr3tatoaDr nei;()sexo(o3nydom e ietlt arua(r ;t1alto feiysfmDea(vs u4trtrmo iytoaDeai i;( sexo(o oodoptemiei ( aDum( oou0tex ifcilt a elnvp;()areoif3oo1opt aneol( sexmxr3nudop n ivs ()aDtm(m ;u4oet  fetys m2rl(vo (0texnmo3ootfmt lu sls srtoxr io4lmenmncsls) 2uau onu4texomiciatlaDrmuvpn(0trtnxfcoydom rli i;s0srtrir3oodopt lfct t)sDta( pno0tpen fetatfsDumnmsn(4aetrmoctytfp  aieols)trxrio3io4al e ncsasf ruaxrpnu0olt io3ias s uan pnt)areomr3iydfp e ivil(  exrxmpiodlpt mivslsfarurx pou0tlx mo3tyd s2rl( o;u0 ltnmf ty1fp  luvo t)srxoio3ou4ame mnet sfaDrmx o;t1aeto i3tyt a ul(mp u4tltrxrcoodfm  aieil()t2umxr iudome  ivsa( arrru pot0texo fciasfsDulnvs t0 rxoir3oy1lm elnei;s  rtrim nu1op e nei ()sDrmxmoot0altomo3tytfm umums u4 lenxr iotlptrluei s)setmio no1ap  licil()aDuau pot0tlenmfciltla elnvo t4texrxo3oatfpDeaiesl(0 rxr(m no4olee fetlt  Dtrxmpot4oex  ieiysfm rl( p u4aetnir oatlate ivs;(0texmio3io4lpe  ncslsfsrrmxmpoo4tex iicildla eln sn(0 ltoircoo1opDrlueo t)t2to(m ou4lpe lfviltfsDrr(rpno1tptoiieiyslm2ua(mo;t0treoir3oodlm rlnes;s0trto(mpnydal nmnctls  rrmu pot1opxo i3ilt m2rmumo u0aetomo3oo1fa eai i (0s2toio iodoltn ivtatfaDumu onu0oeeoio3iyd a2rl( pnt)aetrir tytoatelneo s)seto(o3oy1lmee fvils sDtm(  no0alx  fctlslm2emnvont4altnircoa1la ran ilt  2tm(o io4op e iesat)sDtaxr ot0oltniictasfm2uan o u0 lxrirctadomtr i i ( t2xrir3oy4llee icsls)arrrumoot4opxo oeiytls2el( s () rermo3oy1faDeaueo;s  rxo(r iu1lp e net ( sDrmumo;t4aeeomoeias a uanvsnt0tlxnircoatfp eaieols)trumxo3nydlp elneta( arrmuro;o0aet iieiydls2uanvonu)alerifciy1latr nvi t srxr(o oy4oltelfctls  rum( oou1tpenmietlsla uaumpnt) rxrxr3iatfaDeau s t0 2tr(mpnu4ap emnesat) Dtmx  ;o4tpt mf3iadfmDean s;u)trxoiocoydomteli o;(0 2to(m oo1apen ictls aDtr(rpnt0aetn f3tatla ua(msn(0arenmf ootfaDrlivilt)s2xoxm3iu1apeemnctat) rtax o;u0texoifciasfm el( s t)tlerir iotlpte ueo ( seurxo3iydomenlnetl( a2um(moou1aee iieiltlm2eluvs u0arermf tadfmD an ol(0trxmxopou1amtnmneias)aDur( oot0alxnmieiydla ra(mp u0 exoio io1fmDr nvol(0teurir3io1lmenlicilsfaruax  ;o0ope  fetytfm umnvp;u4 rxnxo3ootfateaieo;s0 rxmxopnu4am nlieia(fa2trxmpoo0tpeoioctat aDua(vpnu)altomf3iotfp elivo;s)t2uoimpnydopen ictl( arum( ono0apen iciytfa2rmums (4 eenir3to1lpt luvs s)t2um(r iu1am  mneiasfs2uaxmpnt1tle iociydfaDemnmp;t4trxnxrcoytlmDr ieo s seuoxo oo4amenlnesa(  Dtmx  nu0tpenif3iyt mDrl( o u) eenxrcta1fate nvsls0srxm(m ny1ape micil(  rua(mo;t1tlxo o3ilslm ua( sn(0aexrxr3ia1fa raiei s0texmir3ny4optnmfvta(fartrxmoot0tlenmieiytfmDeau sn(0 lxoxr iy1omDelieol(0 2urxo3oydlmenliesls) rtm(rp;t4alt  oeilt mDrlnms;t)tltnxfctodfaDelnvs ()s2um(r no4amtnmiviat)arraumoou0apxoiicildlaDrm(msn(4 exrio oo1op  an ils0 rurim3ny1lpt mfes ( srtm( pno4apto iciatlaDea( s;(0tlerxf tadfa r i sl( s2xmxr iy1omtnmncs sfaDra(mp;t4oeto oeils aDrmuvsn(4tlxnmo ia1la rli s;s0trxrim3iodlpee ici (f rtr(r ;t1alenmfctydfm2umu o;u4tlxrmr iytfp   nvsls trur(mpnudoptemnetasf rtmuro;u0opto feilsfa2ra( o;t)trxrircoatla eai s;s) exrim3iy1om e feias)sDtm(  nu4tpe  fcils m eauvsnu4aeeomo iy1lmDeln ols  2uo(r ny1ale  nvt ( sDur(mooo1opt mieiadfa2ua(msn()tltoir tatfp ean sls)srxm(rpno1al  mfctat) 2tax  ot1aexomfctlslsDemnvont0 rtrxf3iotlmte u sl(0s2xm(opiodalt lfcils)arrru ono4oltniiciadfm2um( pn(0 rtnxfcia1la rai s t0srum(r3ou1apeemneta()srumxrpno4tpxoif3ildlmDulnvsnt4trtnmo3oydlpt anvi;t0 rurir io4ol  lnvias)arrrxm oo4tptnii3iat m2rlu p;(0alxoxociotla eaneo t setr(m oo1al emfct (fsDum(rono0oleniicilsfm2el(vpnt0areomf3iydfpDelu ols  2triopnodlp  lnctas artmu o;u1oltnmf3tlslaDua( o;(0trxnxo3ty1om eai sls0s2xrio3iy1lleemivtat)aDrm( pou0tpeoio3ilt sDuauvp t)altrmr iytfat anvilt)trtoxmpiodlmte fctat)a2rm( p;o0tltnioeiat sDel(vo u4 rerif iadlp  luvolt  ruoim3oodoltn nvt t a2urx  ;u4tltomo3ildfmDulnmpn(0trermfctatoa e uvo;s0t2um(r ou1ll nlici (faDur(mpot0oltn i3iat aDumu s;t0tltrxo oo1oaDelu o t0texrirpno4lle  ieslt  Drm(mo;o4olenmieiaslmDemuvsnu)tetrmfcoadfpteli i ()s2xoimpoo1alenlnci t srumump;u1alx if3ildfmDulu p;u0 rtoxocoydfpDrauvo t  rtrxrpny1opeemfei tfaDum( ooo1tpe ii3ilsla uanvs;t0aexnxfciatlaD ai i t0s2trir oy1op e fci (  2ra(  no1altnmo3iad mDran o (4 exoirctotomD  u s;( srumir ou1llt mnvtas)artaxmpoo4tlen o3taslaDulumo u0 rxnxf3iytfa elneil(0sruo(mpoodol  lnvsat)aDurum ;o0oetnioetyslsDuaumsnt)artniocoa1omteauvslt0srxoir iydamtemfeslt)s2rau pnt4ape mi3iydlsDuln sn(0 leoxr3oo1opte uei (0sexmiopiu4oltemncs tfsDtm(mp;t0tpt  fctydlaDulnvsnu0 reoxf3iadfmte ueo t)truo(opou4ll emnct ( a2rau oot0opto ieiytfm2rm( o;(0arxnmo oodlmD  u o s0srtoim nu4al e ncsl( srrm(roou1tlxo i3tas mDea(mp (0 leoio3todomt lnvo t t2xmir iu1lleelivils)a2ur(monu1altomietyd m2ea( p;()artrmf3ia1fmtelivslt trtrxo3no4amtemies s)a2taur oo0oet  ictltfmDuauvp;u4tlxrmoctadlatrluei;s setoxrpoodlp elivs ( s2trur nt0oexniictlsfm rlu p;()tltoxf3oatlmDrlnvi;t t2xoxo io4ape lnvia() rtaumont4apxnmi3tltlsDemuvsn(0 lerxoctodfa eai o ( srurim3nydal  mfeia()sDumu ooo4tptniieiadfs2em( s;(4aleoir iatlmtrlnvo;( sruoim iudlm  mfcs ( arrmump;t4tet ii3tasfs2rauvsn(0trtoio3iotoptrlu ils0 exoxo iudopeemfei ()s2tmxrp;o4tee if3iytfaDemumo t)teeoir3oatfpt lues t)sexoir no4om nliesa( s2ra(mo;u1opeomi3tlsls rauvs u4artrir ia1omD  uvil(0seto(m ny1lpte feils  rtaxro;o4ale mieiyd sDean o;u0 lxrif oa1faDr u s;s  2xm(m oy1lltelietl()aDtrxroou4apto ictad mDemnvp;t0 lermo oadfaDelnvo t  etoxrpio4lptnlnei tfsDtmumoou1altn ieiyt s uaump;(4aexnmfciydlp rlieols) exmxopnu1alte fciatfsrtm(r ou0tpxoiieias s uluvo;()aeeomr3tadlmD auvslt t2tr(m oy1llt lieil(  2tau  oo4oexn ietld a2em( s (4 lermrcoadom rli i ( srxrxo3nu4lltelfctltfa2tr(mooo1tpt  f3tltfs rm( snu0areomoctatlmD lieils  eur(mpnudopte ieilt) 2rrx p;o1oee  i3tls m2umuvs t4 rxriociy1opDe ieilt)trtrxopny4ol emfet t) rra(ro;t1oet mo3iaslmDrmnmp;t4 ltnxrcoy1fateai i ( t2xoxopny1lm nlfvslt srraxm ;u0oexomf3tatlm rmn s;u0aetrxr oatlm elneo t)s2xmxo nudlp   ieslsfsrtmum nu4oeeniieiysfm2eaums u4arxnir todfmDr uvs ()sexmimpnu1amenmfcs tfaDrmx oot4oeeomociasfaDelu o;(4arxrifciodlptelieols0srumxr3io1apee nctas aDtru onu1altnmfetys a uln p;t4 etoxr io1opDrau i;s0t2uo(o3iy4apt lncias sDumum no4opto f3iydfaDem(vp;t0aexnmo ia1oa e neil()truoir3no4olte ict sf rra(r ;o4oeenmfeiadla ranmsnu)texoxo3tytfmDran ol()t2umxo ny1alen nci (f Drrumpot4apenmo3tatls2umump;(4 lxrio3oodlmDe neo;t)srtoimpnudolt  iesatfaDrmxront1aexoifctad sDeau p t0arermo todfpD  ivi;t t2trimpnu1apt lfcs s srraumo;t4tpeoifetlslaDra(vp u) ltrxr ta1omDrluvols) rxrir io4llen ivi t)arrr(rp;u4aee ii3iatfm ean p (0texoir tatfatrauei;t0 2to(rpou4omen fet sf rrrxr oo4tpto fctldfm2rluvo () etrircty1laDeln s (0t2to(mpoo1ale  fei () rrmxrpno1tlen o3tadls2ea(vpnt) rtrxf3totlmD aueo s0 2uoio oy4aptn fetls)s2rr(ronu1tex ii3iad a eau snu)treoxrcoodoat  ueo s s2trxm3ou1aptnmfvslt)sDtrur ot4apxnmietatfa2ra(mpn(4 exnirciytoatraueo;s) rurxmpnu1ll e ies t)srta(mpot1opxomi3iasfm2ulu ont4 etnmr iy1fa rli o;t sexoxo3no4lmt mictl(faDumu o;o4oleomf3iytlmDea( snu0tetnxo iydom rlnvo;t0 eto(r3nu1lmenmfcsls sDrmu o;u1oleomfeiyd mDemumo;u0arxoif iadla  li ilt srtrxrpiudlpt lnetls)artm(rpoo0aetn oetyt s uln o t)texrmr3totopt lnes;(0 ruo(m iu1amtnmnvslt srrrurpou1tetnioetasls emumo;t) rxoxo3ia1optraueo;s) exmirpiodlme mics sf Drmu  ;u0tle miciadlsDum(vpnu0tetnxrcio1fm  aies ()srurxrpoo4llt mfvt (f Drmurooo4tpeomociyslmDulu s (4teenir io1lm rau o t0 etm(opnydam nlies (fs2uru  ;t0aexnmf3iysfmDrlump u) ltnmfcta1lm raivs;s0teuoio oydoltelies ( aDtaumonu1apeoifeiadlm ea(vs u)aexrmo3tydfp r nvilt)trtmio3nydamenlfcil( aDururoot1tee iociys m2emnvo u0aeeoxf3iytoat  i ils  eurxo3ou1lmtelnvt t arrmxmono4aeto feiydlm um( onu)aleoxocoytoaD lueolt texmir3nydomte netas  2tauronu0opxnmociys m ran p (4 etoxfciydlptr uvsls)srur(m nu1llenmiesa()a2tru ont1alx ii3iasfs2em(vp;()artrio3iytlpt ln ils  2uo(m oudolenmnei tfsDrmur ;o0aexn iciydfa ra( ont0trxrmfctodlaD an il( teuoxo no1apt lnvsa( aDua(r ot1teenmieiltlm rl(vs;u)areomo iodlpt lu o s) eurxr iydll n nvtat  Duaurp;t1tlxo ietyt aDumn ont0tleoio3tatfa r iesls)t2tmxr3oo1ape mfcil() 2umur nt4opxo f3tytls uauvp ()alerxr oatopD ai s;t)texrio3oo1lm   ncsas a2raxr nt0optomictadfa umuvs u)trxrxf3tydlaDeluei;()t2ur(r3iu1ll   ivta() rtau  oo4alxomieiytlm2eluvp;()aetrxf oa1la   neo s) rtrxo iy4lltnmict tfaDrm(ro;o4tpx if3tydfa emu p t0aexnmo oatopteaueslt) rxoimpno1op   ivi t  Dtmuro;u4optoiicilsfm uan pnu0 ltnio totfm raivol( srxoxo io1ome lfesasfs2uaum nt0oleoiiciadfm2ean o;(0aeeoxr3tytlaD lues;() 2urimpiy4ol e fei (fsruax  oo4opxoifciydfm2rm( p t0tltrmr3tadlmteanvo;s0sruo(o ny4ol   iei ( arrr(m nt0alt  ictysfaDrlumo;t4 rtnio iatfm rlnesl( trxmimpiu1llte ics () Dtr(mont0oet mo3iytls2ulnmo;t4teeomf tytfpDrluvo;( s2toxopiudalee ncilsfarua(r ;u4apxo i3tlsfs ea(mo u4tlerxo tytlatelueo ( seuoxo ny1ol   fet (f Dtmx pnu0tlxomiciysfs2ra( o t0aexnxo ta1lm eanvi t s2tmirpoudlptemnetl()sDrr(m no4altn f3tls s um(ms;u4 etnmociytoa eai sls tetmirpoo1lpe  ivsasfs2rr(mo;u4olt iieiysla uanmonu)tetoxfcoadfmDr u o (0srum(r3oudlmenlnetl(fsDumxm no0alxnmo3iys a2ua(vs t4texnxf3io1oaDr n s;s0srxrirpiu4op nlncils)s2umu  ou0olen ieiadfs2el(vp u) rtnio3io1fp  au sls)trxrxopnydameemnvt (fsDrmxrpnu1opto i3ils sDem(vsnu4trxnmf3todom  li s t0s2toiopoodamtemnes (fsrurxmoot0oee  fciasls rl( pnu4trenio3iatlpDelnvi;t)setr(o3no4aptelnvtls)srumumpot1teeo o3tytls2rlnms;(4texriocto1opt luvils)tetmiopnu4lp   ncs ()aDuaumoot1apto oeild a2ean s (0 rtrmr iadoaD auvsls srxrxmpoy1optelfct t)sDrr(m ;u0optnifciyslaDea(mo (4aetrxo oa1oa  aneil() rxrxm oy1optemfvils  2raxm ot1oex  fciat m2eanvpn(0tltnio oydla  aieo t0trxmxr3oo1omenmnet t) 2urxr ;t0opt iicias m uln p () leoio3oydlptrluvo;s)texoirpoydamtelnei t a2urxr ;t1olxnmoeiatls rm(mo () lxrmfciotlmtrlu i ( s2urxr oo4ol nmivils)srrrx oou0aex mf3ias aDua(vp;t0trenxrcoy1opt aivo;( s2tmirpio1ap nlfct ()aDtmurpou1tleo fctadlmDul( pnu0artrio3tatfa rlnvilt) rumxrpou4amtn nvsatfs2umu p;o4olx  fetlt s2umn o;t0 lxnif3iy1optrlieo s  etoiopnodapt  fvt (fsrrm(mp;u4tlxomi3ildlsDemnmsn()artrmf oodfaDeli sls tetoxmpnodom  lnvs t arrruronu1ope  ieiytfsDrmumpn(4 ltnircootopDeaiei t)s2tm(rpny4om   feiasf rua(mono1oee mi3ild s elnvs t4trerio tydlmDr nei (  rtmir iy4lp e ieia(f 2urum ;o0olxoii3iltfa2rmuvs u)alenxo3ta1la rli s ()t2uoxopio4am  lict (  2trx pno1apxoiictat s ua(mp;(0aetoioctydomt aieilt t2xr(opnu4ol emietlsf rtm(m oo0tpto feildlm ranmp t4altoif tytfptrlivi;(  2uo(r3ou4altnmnvtl() Drr(r ou0ope  ictysfa2ranvpnt) etrio iy1oa r nvs ()texo(r nu1ole mfctls) 2uaxmpot1opt mietlsla ea(vo () exrmrcoy1fm rau s;()texmxmpoy4olt  fvtl()aDrmu  ;u4aet miciat a2uanmpnu)texnio iatop e n s;s) 2xoio3oy1lmeelicils)aDum(ronu0aeenmfciysfs uluvo ()aeenio oo1omD  uei;(0 exo(rpno1lpe  icias sDumum ;u0alxnmociat m2umn p;u0aexnxfctatfaD ai ils0truo(m3io4lmee fesltf 2rm(  ;t1opx mfcils m eanvo;t) lxniociadfmt aues;t  exo(rpiydol e ics (fsrta( p;o4tptoif3tad s2umn o (0trxrxr3oydlmt luvo;s) etrxr oy4lmeemies t)aDta(mp;o4oeen feiydfsDem( p t0treoircty1fmtrlu s ()sexo(r oo4op nmfviat arurxr ;o1aeto o3tlt s2rm(vpn(4tlenxo3ootfp  anvols sexoirpoy4lme mncta()srtm(ro;u1tleomf3iltfs eaumo;u0arenmo3ta1fpDe uvol( s2xriopio4lp  mfesa(fartrx pnu0tex mfcilsla2um(mo t0tlxrmfcoa1lp   nvil()trtoxo3iy1lm  mnci ( aDrau ono0oetomictatls2rm( o (0arenmr3io1lp e i o t)t2toio3nydlp elfvta(farrrxrono4tptoii3iasfa um(mp;()arxrmrcoa1lm rln i s)sexmimpiy1olen feilt s2umxmo;u0ole  i3tatfm ul(vs;u4 rerir iatopt ln s;t  ruoiopoo4openmnvt tfarur(mpoo1aexoifeildfaDuanmp;(0 rtomrciy1oaDrai o t)texmirpiodalte nvia()s2raxm ;t4aleoiieilslm2rl(vs;t)teenxf iytomD anei s srtmxr3nodoptnlfvi sfarraurpoo1tpxnmoctatla2raump ()aleoxfcoo1laD  ieslt setmimpiu4lltnlictlt)srurxm ou0altniictadlm2rlnmpn()texomr3iytfaD  u s;s) 2tr(r nudole lies ()srrmu pot0ape iocildfs rluvp (4altrir3oatfaDeau ilt s2toimpnudlp e nes sf 2tmurp;t1oeeomo3tysls ua(mo t4artrxfcootfmD  n ils t2uo(r3io4am nmfetl()s2ua(mp;u1alt io3tadfsDua(msnt0arxomfcoydfa  ai olt  rxoxrpnydom nmfetlt  2rmxrpnt1teeoiiciltfsDelnvo;(0alenxociy1op rlnvslt t2uo(o3iy4apeemfct s  Dra(mo;t4tlt if3tldla2eln p;()alxoxf ia1omDe ies;s setm(mpnudlle  fcs sfsDurxrpot0aeeniociytlmDran ont0 eermr oy1omte uvs;s) 2xm(mpoydoptnlfes t sDraum ;u4tpeoif3tasfa2emuvpnt0 eenir3oy1oa rlneo;s)t2xriopou1op  lneslt)srtr(mo;o4oexomi3tyslsDrm(mo;u)teermr oydfp eluvilt s2xr(rpiu4llee netat a2tr( p;o4tetn ieiyt a2umuvpnt0trxoiocoatom rli sl( s2trxo ny1op nlnei tfsDuax pot0tpxniieild s2ea( p;u4trtrxr iy1fmt auei (  rxrxo no4om  lfci ( s2ra(mpou4alt mfetasls2uau o;u0artoifctotopteau s s0trum(o3no4ll e nvta(f 2tau ooo1tpeo oetasls rl( snu) lerirctadla   u s t0t2um(o3nodomenmivtasf 2um(rpnt1oetoiocilt s2rmnms (0 leriociodoaDeaneo;s s2trirpoy1olte nctasfartmu  ;u4tleo oeilsfmDrmuvs;u4tetoxf ia1fp  aieo s0srxoxm nodol elfviat s2uaumoou1olxomi3iat aDelu p;u) reoxf3oodfaDran i;( trtrxrpoy4llee nct t)srur(mo;u4oex moeiytla2ea( o;t0trtoxociodoa elues t0setmim3nu1optemfvslt aDrmxmo;u0aee moctyslaDumump;t0alxrirciy1lpteauvs t srxmxm iudopee neslt  2rrur nt0alxnmieilslm2rlu s u)altomfctotopD lnes s t2tmir3io1apte net (faDrau pot0tlenifctlsfmDuau ont)tetoiocio1omtr iesl( setoxmpnu4alt lnvi t)sDuaum ;u4aeeo fetysls2ulnvs;()altrio3tadoaDr uvsls  exr(m oudlle  ncsatfsDur( o;t1teeoii3tasla2ua( o;t0alenxr3ia1oaDrlivils0 etrxopno1om nlnvsls aDumxrp;u1tpt ii3tadfaDuan snt0altrmf io1latean sl( srurir3no1apeemnvtas)sDrmxm oo1tee mictys m uan s;u)altoxo todla  li o;()t2trxo oy4ope lnesltfa2taxm ot1oexn fcilslmDua(vs;() lxoiocoa1lat au s;t0 2urxmpiu1ome mivta()a2trumo;o0oetoiocild m2ran s;u0aetrmo iatoaD ln ol( srxr(mpiodlme lnct s) rur(mono4oetoii3iyt mDrlnmpnt0 etomr3oodom raivils teum(opoy1ome mncil( sDtmump;t4olt ifctysfaDrl( pnt)aeenmf3tatom ean ils0 2uoxrpou1lpee nvi t)sDtau oou0ope  ieiasfaDum(mp u4 exnmocto1fat lu ol( trxrxm nu4omtnmfciat) rur(rp;t4oee  ociadlsDumnmo (0 etnxo3to1oaD livslt)t2to(r3ou4amtn ivs tf rra(ront4texn f3ilt m ean sn() rxrir3oy1omD livo;t  2tm(r3no4ll  mfvia(fs2trumo;o4oex ioeilt m rl( on(4trerxf ta1lmDeai slt0t2toio ou1al   fvt s) rtrxr oo4aeen f3iasfa ua(mp u0trtnmf tadop rai o;(0 eum(o3nu1ll nmnvtat)s2rm(moot0tpxniiciatlmDum(vpnu4 reoxrcoo1opt lneo ( t2tmxrpnodal nlfci ()srururpot1apeoioeiasla raumsn(0trerxociotfmtran sl(0srum(m iy4aleemncs ()sDrmum no0tpxnifciysls2emu pnt)areoif3iy1lmDr uvilt seto(o no1aptn nesa( artru p;t0opeo oeiaslm2eaump (4aeermo3oa1fatrai i;()seumim nydop   fcils) Duau o;u4openiicils mDeluvp;t0aetomr ta1laDr nvs;s sexoim nydlltelfei sf Duaxr ;u1ope ifciyd aDrl(vs ()texrxfciodlpt au slt t2toxm3iudlle mfes ( aDuaxm ot0tee  feiasls2em( s t)trtoio iotfmD lu ols0trurxr oodol nlicsa()a2uaur nu1tpxnifctytlm2elnvs u4alxoxo3oytomt aies t  2to(o3no4lltemietls arrm(rpot0tpxoio3iytfm2um(vs (4 leomf3oadomt au sl() 2urxmpnydlmt  nvt tf Dumx o;u0oetomictls m elu onu0alermoctatfpD  neols0 exrim3iu1ol nlivi ()s2tr( ont4altoif3tysfa2rmnmp (0tltomo tytomte nvi;(0srxr(m no1ol   ieils srururonu4tlt ifeiat aDul(vsnu)trerxo3totomDraues s)t2uo(opio1altn iei t)arrmxronu0ale ioctytfs ra(mp;u0trxoxrcty1fm  anvi () 2um(r nu1lptn nvia(f ruaumont0oltn oeiaslaDumu s;(4 eeoir3ia1omt ln s;t) 2trimpiudapt lncsl(fsrtmumont4tpx  oeilsfmDrln o;u0aleoircta1oaDelivils0srxo(mpnydlm  livi ( arumxmpnt1apen iciyslm em(ms t)altrxrcio1fpD lieo;s)srxoirpiodom e nvtlsfaDumx o;u4optnmoetltlaDul( s (4 etnif3oytomtraiei s trxoxm no4om  liei t arta( o;t1oee mo3tlt aDum( o u4arxrmf oodopt  n s;s)setr(o iy1lpen ivil()aDraurp;t1altnifetyt a um( o;u0 exnmocoytop rlues;s) rxm(r nudopenmfetlsf 2umumoou0aptn fctytls umuvs;t4 eenxfcta1oa e ieo ()s2urxopoodome mnvsa(faDrrxrpnt1aex iieiltfmDulnvonu)treoxf oodfm   nes ( t2to(r nodlm emivs s)aDuauroot0apeomociyd s2ean pn(0teeoircoydom   i s;(0 euoxrpiy1al elfvt t) 2rmxm nt4apx ifctlt a ul(mpnu) rtnxf tytlm eau i;s0 ruo(opiu4llee ics t) Dra(  ;t1aeen ociyd a elnvo (4artrxf tadla e nvs t)teurxrpiydlmtn nvilsfsrtmxmpno0aetoifetytfm rlnms;u)tlxnirciydomtraueo;(0srxmir3no1ape  ivi t aDtm( oou1apt mfeilslsDrm(vsnu0 rxomrciodom r uvi t0 etrxo ou1ol elncilt) 2rmu pnt4tetn fetldlm2rmuvs (4tlxomo3iadfmtelu slt0 2xrxopiudlmtemieil() rum(monu0aexn o3iat sDrluvo;t0tetoxf3iytfmte ivi (  eto(mpnydape mnctl()s2tmump;o0aexo iciys s ulu o u) eerxoctotopD luvil(0srtr(rpio4lpeemfvs t) 2rrurpoo0aeeomfeilslm um( o (0tlerio ia1oat aies t0teur(r oydol e fcia(f 2uaxm nu4teeomfeiad s2uln pn()trerif iadfmDelneol()srxm(mpou1amtemnvsat s2taum ou4opxomietld a2ul( on() exrxr3tatlm e ueslt) etmxr3iy4oltn fcia()arrmumont1teeoii3iad aDranvo;u)tltriociadfmt lnes s0s2urxmpoo1op   fvt s arrrump;t1tlto i3tydlaDumu p u0 eerxfciytlp eanvi s) 2uoiopoydop nlivtl(farrru  oo1teen ietadfs2ranmo;u4 lenmr3tytomt lneo t) exoiopoydaptnmici t  2umxr ot0tetnii3tyd aDemuvp;()teermf3oydlm   ivs;t0 2xmxo iodam n fvtat) rurumooo4tet mf3tldlaDeauvpn() leoxo tadomtrlu s;() ruo(opiu1omtemiesat)s2trumpoo0optomi3iydlaDeauvp (0texomf oytla raueo;s0setoim io4lptelnvilt)aDumx pnt0opx  octldfs eanvp;t0 ltnif3io1lp  aiei;t)setoxr3iydom  lfvsl( srraxr nu1ape  f3tasfs2uanmp (0 rermrcio1lptrluvo (  2tmim ou1ll   icsa(f Dtm( p;o1altnio3ildlaDrl(mp ()trtoio tatfa rau o;() eumirpnydlp elfvi s  rumu o;o4olxniicild mDem( snt)artoiocoa1latr uvo;s t2xmxr3iodap emfctlt) Duaum ot1aptoii3iasfmDea(mpn(0trtnxf3oo1op rauei (0t2umirpny4lp emnctas)aDua(rpou1tpxn fciat s ulnvp t0aetrif ia1lpteau s t0t2urxm nydopee ies ()sDraurpot1tpe ifeiadls rau p;t4 lxoio3tytop eaieol(  eurirpou4am e ieslt s2urxrpnt0oleomf3iytla2ran s;t)alerxo3iotfaDe iei;t  rxo(o3oy4apee icsls)aDum(root4optn fciasfmDrluvo (4trxoxo3to1fm  anvo;t  2uriopiudalee fctl(fsrrrurpnt4tpxo f3ias a umuvs;t0alxrxf3tadfpt lnvi;() 2uoio nudomtelfvi t srtr( p;u1tpxoifetasfaDrmu o;(4alerxociytoaDe neo;(  rtoxm no1lmeelivilsfa2rmxm ;t4tle  fctyslmDumn pnu) rerifciytop  aivi;t  etr(rpiydalen ivs t)a2tr(rpou4teeo ociaslsDumn o ()aeenio3ta1oaDrauvs;t tetmio3nudamtnlfvilsfsDrmx p;o4tltnmi3iys a ea(msn() rtnmfciotop e n o s0trtrir3iy1lp e nvtas srtmxrpoo4optnmi3iltlm ul(vs;u)altoif3to1fmDrlivo;t  2um(r3no1oltemncils) Duauroot0tlt moeiyslaDuln s u)aeeomo tatfmDeliei;t0srtrxo3oodoptelncias  rtrxmp;o4oexnif3ilslm2ulnms u) rxrxf3ta1oaDeanesls0 euoxr iydameemnvi ()sDraumpnt1tetnmo3iaslsDelnvo;u)alxoxrcootfmtrau ilt truoim3ou1ale lnci s srua( onu1opeomoctad s2eauvo;()arxrif3oodlpD lieo s s2um(m oodom nlfesa(  2taumpou4apx iocild sDemu o;(4 lenxo iatomD  nvo (  rurxm ny4op e fctl(fsDtrxmooo4alxoio3iltlmDeln sn(0aexrir3iotomtrluei;() 2urir3no4lpe micsas)aDuru pou0opt mieildfm elnmp;()arxrmrciytfpteaueol(0srumxmpoydol nmivtat  2rrurp;t4ope  fciatfm rln s;u0 lxomf oa1om ran s ()srtoxr3no1lpt mfvsl(  2umu o;u0ale moeiadfs uau onu) rtoio3ta1faDrli ol(0srurim io4lmeelici s  rta(mpnt4opx mi3ilt s rmuvsn(4aexnmfcootomt  n s;(  etoim3iydol e netl( s2uru p;o0tpxn oetasfm rau snu0 exnircio1op r u o t  2toxo3nu4ap e ivil( sruax ooo0opxn feiadfm2uluvs;t4 renmf iodfmD luvil()texoxr3iu4ll nmicsatfsDra(ront1tpxomo3iyt m rl(mo u4tltoif iatlpt lueol(  rtoiopny1ll elietltfaDur(r no1aexnmoetad sDeanvon(0trxomfcoy1fmD aueo;t)tetmxrpnu4omee net t)sDta( o;u1tlxoioctad m ran s;(4arxomr oadoat  ieol(0srumiopoodapt mncsl(fsruru ono1ale ifciyt sDea(mo (0tlerif3oytlpDr nvilt)trtmxr no1optnmics tfartr(  ou1olt ii3taslmDemu sn(0treoio3io1lp eaies;()tetoir3iu1lle  nvtlt) 2truronu0ope ioeias a2rluvp u) etnxf todoaD livs t)truo(mpno1ol e nvsatf 2tmumpnt1ale  feiytfaDelumsnt)arxoif3ta1lmDeluesls0srxmxm3iy1ap n fesa()a2rmu  nt1teeniietyd s uln p t0tltrir iotfaDeln o () rxmxo3nydol emietltfaDtax  ot4ole moetytlsDelu p u0tlxrxr oatop eaneo;t0t2tr(r oydllt lictlt aDtmuroot0aleomiciatls2ulu s ()trenmr iodomDeli sl(0texoxm3iy1apt mfciat aDumump;u1optomociytls emu p;t0arxnxo oytop  au o;t0texmxo3nudop nlivslt) rrmxm ot0oexn oetyslsDemump u0alxrxf ia1omtrlneo;s0 euo(r ou4amtelnes t s2rr(r nu4tltoiieilsla2ran snt) lenmo oytfaDraneils s2trimpiu1omenlict s  ruaumonu4ale ifeiyt sDuan onu) leoiocoodlmte n i s) rxo(mpio1ame lnvia( srrrxrpoo1alxo i3ilsfs umu s (4 rtrxf iytop eanei;t srtoxm nu1ll nmiet s sDurx  nt1tptomfctat m rlums;u4trtomrciotlm   ivi s0s2uoxm3iy1aptemfvslt srtaxr no4oee io3tyt m2rlnmp u0texomo oytomDrlneo t)t2umio3ny1lpe livsa(f rrmuro;u1apx moctltls ulu p;t0tlerxf oo1lptelues;( s2urxr oy4am e ictl(  rurumpno4tltomoctatla umnvo;u4 lenmf3totfa   u i;()t2uoirpoy4lm nmivtas)artrumonu0aptniietyt s rlnmo t)artnxr iodoatelieo s t2xrxmpiodoltn nviat aDraum ;o4apenmfctaslm2emumpn(0 rtrio oodfmtraies t)seuoio3iu1op emfvi ()sDumuront4tex  fctatls uanvon()altrmo tytfa raiei;s  2to(o iy4llenlivt t)a2rrxroou1aptoioctlsfm2rmnms t)aleoif todopDraueilt)trum(m iy1am elfetls) rtaxront0apx iictyslm2el(vsn(4 lxnmocootfpD  uei () etoimpiy1omtemicils)arua( pou1apenioeiat a2uan o;u4areoxf ta1lmte i o (0s2umim oo4lle  nct s)aDuaxmo;o4ope mfctlsfm2elnms;(0altnxf3iydoaDrluvi;t)teuriopio4lm  mfct sfs2rax poo4aexomieiasfa2rlums (4 eerifcta1oa e neo s0 2uo(o3iodap e fviltf Drrur no0aex mociat sDeauvp;()trxnmf tatoaD  uei ()s2um(m3io4lme lictlt a2ra( ono1alxnifctlslmDeanvsnt)teermocio1lm r ieil()tetrio nu1lptnmfeil( aDrru pnt4opeoii3iyt mDemumonu0 exoif tydop e ueilt s2xrxopio4lltelnvsl(fa2uaxmooo1apenmi3iadfa2rlums;u4trenxo io1oaDe i sls0sexr(o nudameelnvtat  Drau ooo0aetn f3iytlaDuanvsn()trerif3iatfmDrlu o s)teuoir3io4amtnmfvtl()sDua(rpnu4teto fciatfs um(mpnu4 rtrmrcio1fmtrauei ( s2xr(o iudaltemfesas s2raxm no4olto f3ilt m2rl( onu0teermf3oytom  lueilt)tetm(mpiudam emfetas  rtr(rp;u1aetnioeiyt s2ranmpnt4arerxf3iy1fptraies;s0sexmxr ny1lltnmfcsat)srtmum no1olxnmfeiyslsDrmn p t0 exoio tatlpte ivols  etm(opiudap  lnvtas)arrau ooo4opt mfctysls2ra(monu4alxrmf3todlmtrlieils setmio3oy1olt lfci (fartrxmo;t0aexnmf3tys a2rl(mp u4altnxocty1fmtr uvs;s0 eto(mpou1ol  mnvi ( a2tmxm oo4oetoiietatfsDemnvpnt0treoio oadoat  ivils0sruoim3no4am n fvtls)srua(m ;o0ole if3ild m2umumpnt)tlxrmo3oy1faDrlieil(0sexmir3iydopen ies t)aDrrum nu1alxnmf3tatfmDem(mp;u)tlerxrctodfaDr uei () rxmio no4alen neilsfsDurur ;t4altn feiltfaDem(vonu)tlxoir ia1om eanvo ()s2uoim3ou4lpte ieil(faDtmurpnt1teto fciatls2el(mp (0trenxf3iodoaD lnvo (0sexoxo iydlmenmivil(fsruaxr nt0tee mfetytfaDrl( o (0aeermf3oy1omte nes;s)sexrxmpiy1omtemfvs ( artm(r ot4apxo fctltfs2ua(mpn() rtnxociy1fm   neo s)sexm(r ou4lmt mfcias sDur(mpoo0texomfciad s2el( p t4aexoxrciadlpDe ueo;(0srumim nydlp e neias)sDua(mpnu1tle iieildfm ul( s;u4arenxf oodlpDeln i ( t2tm(m oy1lmtelfci (f 2rrurpnt1tpxomfctltfa rau p ()arenmr iytop elnei s)s2uo(rpny4ol  lnvtas aDtr(rp;t0texo icils mDum(monu)trxoif iotlmt ln ol( trum(m3iydamte fciat sDuaump;o0oexoioctatlaDumuvpnt0artomrcoydoaDelu i;s0s2umimpoo1apee fcs (f 2tm(m oo0olx ioeiasla2emu snt4tlxnxr todlpDeluvi () rtrirpnydom   neias)sDrr( pnu0altnifeiltfs2elnmp (0 etrir iydlptrai s;(0t2xrxo3nu1lmt lictat srua( oot1alxo ietyt m2ra( s;(4alxrmf3io1lpDe nes;()t2xrxr3no4oltn ivt s srrrurpno4tptnmociad m uan o;u4alenifctotlp  anvi t trum(m3iu4amtn fvsl(fsDtr(mo;t1oee iiciyd aDua(msnu0teenif oy1fpDraivs;s0 2tmxrpno4oltemivtasf rrmxront4tptnmo3ildfs umumpn(0tlenmo oydlmteaivo ( s2tmxmpoodolt lieslsfs2tr(mpoo1tptn i3tytfa2ua(vo u)aexomo3iydfmtrluei;t sruoir3nydolee ieiltfartrur ;u4optnmfciytla2rluvs u4aetoio3oydomDeaues;t)texoxopno1lpe lfet (f ruaxr no1olen octadfa em( s (4 lerxo3iotoatrai i;t0trurim3iu4altnlncsat  2urxm oo1opx  ieildla eaums;(0tltnmo ty1fmDe iei () exoxo3no4olee fvt ()sDtmum no1alt mf3tlt aDemnmo u0areoif3oytlaDraneilt0sexo(r3ny1lm nmieiatfs2tr(mp;o4oee  i3iydlm rm( p;t4 rtrxrcoodlptranvols)t2tm(m iu4lm   icsas  Dra(  ot1teeomf3iadfa eaumsn()altnmo3oo1laDr uvi s  eto(r iydame lnetls s2ua(mo;t4texoio3ilt m2rl( s;t0trtnmocia1fpDrlneo ( setrxm ny1op emfvsls s2um(r oo1optnioctld s umuvo;(0alerir iatfmDe ivo (0s2toio3iodoltemietls)aDtmur ot0oex mi3iasfs2ulumsnu0tetnxf to1om eluei ()sexoirpio1lm emfcslsf rurxr ou4tex mo3iys s2uau pnu0 rtoxo oadfpDeauei;s sexrim3io4op nmnciltfs2uaxrpno1apx iietytlmDea(mp t0 rxrxf3ootom eaiei t t2xoxopiu1ll elicil( sDtmumpno0olx  i3iydla2rmnmp;(4altnmr iy1opt an slt0 euo(o iodaptn ivta()sruaur ;u1tlt mictyd s rln p t4tetnifciydfaDrlivil( srxmio3oudaleemiet ( arumxm ;t1olx  f3iydlmDul( p;u4alxnxo3iadopte uvilt s2xrim3nu1ame mneils) 2uau  nt4apxomoeiatlm elums;t)aleoxr oa1oa  ai sls0srxr(o iudoptnmnvia(  Duax o;u1oet iieiys m2rmnms u4treoxfctatlmt auvo s  rtoir oodlpe  iet ( artmump;u0tlx  f3tadla umn p u4trtoio3tatfpD luvil(0t2trio io4am emnct t)srur(r ;o1apxomo3ias m ua( p;u) eermr3oo1oa raies;()sexrxo3iodoptnlnvilsf Drmur ot1texnio3iatla elu s;u4aetoifciy1opDraneslt t2tr(o no1aptelicilsfaDrmxrpoo4tpto ociatls ul(mp u4 ltnifciadlmte ues t)sruo(opnydlmtnlnesasfaDuau poo0aee  oeiltfmDrmu o (0artrxo oytomtraneo t0s2xo(mpny1oltn ivil(fs2raxm ;u1altnmieiyt m2eau on(4alxrmfciy1opDe neols srto(opno4am elneil() Duaum nu0opxoif3iad aDumu o;()altnmr ta1oaDrli o;t t2uo(opno4lpe  nesatf Dtm( pou1tet iictad s2uan pnu)artrxociydlmDr u olt)teuo(m3iu4am emnct ()sDrrumooo4tlx  i3tydfa2raums;()teenxr3iatlmt  uvo t0s2urir3iy1lm e nvi t srumxm ot0aexn ictadls2ul(vs;t)aetrircty1oat  uvo (0s2tr(o3ou4lp emfct (fsrra(  no1tpxo ociltls2rau p;u)teenif totfpDrlieil(0teum(m3oo1ll  lncilsfs2um(ro;o0olx mf3iat a2umnms;u) ltoif oy1la r uvs;(0 eumim3iu1lm n ncslt) Dumx  ot0tpe ifeiyslaDrm(mo t) rtnmr3tytfmDr n ols  ruoiopoy4lpe  icsas  Dtr(moot0opeoiieiydla rm(ms;u)tltoio3oatoa rlueo;()sexr(o3iu1apee fcil(f 2umx p;u1opt ioetytlsDrmu p;(4arxomrcoy1fateluvi;s)trtmio no1amt  fcta(fa2taxr ou4oee moeiad m emn o ()tlxomo iodom e neo s) ruo(o3nu1op  mies tfa2umxrp;u4aexoio3iyslm rmnvo (0 lxomo3to1fpte nvol(  rtmir oy1ll  mfeias a2urx p;o4tpeoii3tldfm emuvsn(4artrxr3oodfpDr ivslt) rtoirpoydapt  ivs tfsrrau o;t0opeoiietldfmDrl( ont)trerxr iy1op rlueilt truoxmpny1om e icsl( a2uau  ;t4tex  ocildfa rlump;u)texrio iydfm rlnvols0trtrim3nydapte nesl(f rrru pou4oltnmo3taslm2emuvsn(4 ltnio iy1lptr nei t)s2xmim3nydaptnmfvilsf Dtau ont4opeoifeiltfsDelumo u) exrir3io1fmDeai ol( trxrir3ou4ape mieta()s2um(mp;o1olen ocild aDranmo;t0trtrir ootlmtran slt  2uo(rpio1amee ici (f Draxr no1olxnioctaslsDum( s;u4 rxrio ootlaD  uvols0 2ur(rpiu4alte nciasfa2ta( p;t4oltomfetyd a emuvsn(0arxrxrcoydoa r nvils)teur(r3iudap   fvt ( sDrmum oo4oetomietysla ua( o;(4 exnif3oytom raivs t)s2xriopiydal nmivslt) rurumpoo0aex io3iadlm el( o t4 lxrxrciydopt lueo t t2uoir3ou1al n ieslt s2rmu p;u0tlxn ieiyslaDrl(vo t)tetoifctydlaD  uvs t  2xmim oo1amt licta()srur( pno0apxn f3iysfsDra( p u)aeeoif3tatfptrlu i;()teumim3iu4op e ictat) Drmu onu4tlenifciatla2eln s;()alenircia1lm e i o t truoxr3io4ll nlietat) rrmur ;u4oetn i3ils sDean p;u4tlxnmf ty1lmDr n o;(0srtrimpoydolte fesat  rururp;o1alx  fctys a2ul( s;u0tetnxoctodfaD  ieilt sruoio ou1lpeemfei s) 2ta(m ot0olt mo3tlsfmDum( s;t4altrxr oa1lmDe ivi t) euo(rpny4olt lnvtasfa2trxrono0tpxo i3iadla2uanvs ()texnio3oa1oa e nei;s0seur(mpnu1lp elicsat a2rmxr ou4aetn f3ilt a2ra(vonu)aexnxfcio1op  auvi;t0 rtoim3nu1ap nliesatfsrrrx  ;u4aeenifcilt aDemn p t4alxomr3tadomtrlneil(0s2tmirpno1ale lneslt a2uaxroot0tetnmf3ias m rlu o u) lxomrcoodlaD lueil(0 etoxo ou4op elictat srum(mpou1oet  ocildla2rauvpnu) ltoio oytlmDeai ol(  2tmio3nu4om  mnetlt)a2um(mo;u4ape  ieiytlsDuaumsnu4aeenxo ty1fpD lnes (  2uoir3nudlm e fesl(f 2tmu  ou1tetoiiciad mDranms (0teenmfctotfmDeluesl(0seuo(mpio1ape lfeias aDtrum ou0oeen ieilsfa ea(mo;(4 lxoif iadomD ln o s sexmxr oudapt  nvsa() 2ur( pno4tpxnii3tytlsDeluvp;u0tlermr oodfmt  u i (  2tr(m3nu1ap emnvia( sDrrx pnt4alxnmfetat sDelnms;(0trxnmoctatfmDe ueo;s)seuoim nodalenmneta()sDumxrpot0altn ictydfmDrl( on(4trenir3iy1fmD aieo;t) rurir3oydop nmfciat) 2tmx pnt4ole mieiltla umnmon()trxnmr3oadopt  u s t0t2urxm3oo4apenlnvil(f rtrx  ou1tetnmociltfa2umnvp;(0alenif io1lpD  ivs;t)tetmxo3iy4amenlivi (fsDrm( oou1tle  octld m rln o;t4trerxfctytoat lu olt)t2xr(rpno4omt  nci ( sDtmu o;o1optnmo3ild m el(vs u)aexoir oodla e ueolt0 etoxopoo4om   nciatf Dtru  oo4olxoio3tytfmDuan s (4aetrmfciodom  lneo;s0t2urir3oydlm e nvia( srrax o;u1oexnmo3iatlsDumn ont) exnxociytoa eaivs s)t2ur(o oydope lnet tfa2tau poo1oexomoeiyt a2ea(vsnt)artoxrctotlm   u s;()srxoxo iudomenlnet t) 2ra(r ou4oetn fetatfaDuluvo () ltomo oydfaDe iei;()t2xmim3oo4omenlncslt artmxmpnu4oetn fctlsfs ulu sn(4areoif oodlpDe uvo;()setriopnodlmt  icsasf rur(moot0alx mf3iyslm2um(vs;t0 exrmr3iatlp ean i () etm(r3ou1lme mncsl()s2rax pno1optn f3iad sDrmnmp u0 etnxf todlpDrauei s) rur(opiy1al nlfctls a2tr(ro;u0teenmi3ildfaDua( s;() etnxf3iy1fpDrlnesls seumxr oydamt  fctat aDtm(  oo1tlto fciaslsDulnvsn(4 exnmo3iatomte ueil(0 etoxm oydlpe lfeils) rta(m ;t4apenif3iydla elumpnu4artoxfciotfatran o;s)srxrxmpiy4omtnlfci ( a2trx poo1aptnif3tldfs ua(vpnu4teeoxf tydlpDraieo ()t2umxm3no1lmee fvsas) 2ur( p;u4tee mociyd sDel(ms u0tlxnmfcoa1late nes;s)trtoxrpiy1aptemnet s)aDrrxro;o0tlx ifcias s ranvo;(4teermociotfaD ln i;t trtrim3oy4omtnlfes sf 2taxmo;t4opxomo3ildla2rl(mont4alxoiocoatfa ran i ( t2ur(mpoo1lltnlnci s  2ta(r ;o0tet  iciydls2rmu on(4trxnif3iodlmteaies;s  rumio iy4optnmivtl() 2uax pot0opeoifetld s2um(vpnu4texnirctydfmtr nvsls0 2xmirpoudapte fesls sDurx ooo0apt mo3iat sDemuvpnt) rxnxfctotomtr nvo;s  etriopoo4alt lnei ( a2umuront1optnmf3iys a2elumsn() exoxf3oo1laD  n ols) exo(opny1ap n iet (fa2urur ;u0apto fctys s rau onu0 lenir iadoaDe neo t)srurimpiodopenlnvi s)s2umx pnt0tex mociaslm ua(vs ()tltoxf ta1oa elneo;( trtrir3nu1ll nliei ( srumxrpnt4apxo f3taslm umu o;(0trxrmr oo1lm  lieslt) 2tmim no1lm   ncsa( a2tru  no1tlx  oetat a2eaumon(0trtrif3oydfa eaieils)s2xmxm3oo1lleemnet ( a2rmx p;u0oeeoiieiysls2rm(mo t0artnmf3to1omt lueol(0texo(mpiudalenmivt s) Durump;u0aexomfeiyslsDra(msn(4 exnxo3todlm  lnvo (  rto(opio1op nmncta(  ruru pno4tptnmiciasfs2ea(vo;()aetrmf3totfaD  u i;(  rtm(m oy1opt lnvi t)srra(rpou0teeniociytlsDeanmpnt)tleoir ty1lmtrau o t srtmxo3iy4omee fvt ( a2ur(  ;u1aexo f3iytlaDulnvs u0aeerir iy1fpteaneslt0 rxrirpio4amen fcs () 2urur ot1tpenmociad mDumumpn(0tlxrio3todlp rlnei t  rtoimpoy4al nlfetas) Drrumo;o4apxniiciydfmDrl(vs;u0 eeniociydoa   u il(0sexo(o iu1ap e nesl()s2ua( o;t0oeto ociys m rmumo (4 lxrxo3tytomt aiesls tetmiopoodlle  ncia() rtm(  ;t0tpen oeiatfm2em(msn(4tetnmfcoa1lpt  nvol( seuoxmpou4lmee ics (farur(rono0tltnio3tysfs umnms;t) exrir oy1fp e neols  rxm(rpoy1lp   ncias)s2tmx o;u1oex  o3tysfs elnvs t4arxnifcoa1faDrauei s) 2trxr3ou4ap nmivtl(  2rm(mp;t1tpx ifciytls2umump u0arxoxrciytfp rlueol( trtoim ny1al e fvilsfsrrrumono0oetomfcils m2um(vo;u)tltnifciadfa  luei;t0 exmxm iudop  lnvils)aruaxmooo4tetn ociytls2um(mo (4artrxr todlaD ai s;s  2triopou4ole mfei t  2rau  oo1tlt  i3iyt sDul(mp;u4alenmo tytlm eau s (0sexrxo ou4lp n nvtls s2um(rono1aeenmi3tydfs2rlnmp (0teeoxrcoatfpteaues;s trum(m no4om emietl(  Dra(mono0alxoiocils a ul(mp ()tlxnmoctatfatean ols trtr(r nydom n ivs t aDtrx o;u0opeo f3iasfs um( s t)tetrif tydopt lu o;t)s2toxo iu4ap nlfctltfsrtrx poo4apxomf3tydfmDeau s;u)altnir oa1omDelnvo;( srxoxmpnydale  fcslsfsrta(  ;t0tet ioetys aDrm(vp;()tltrio3totfa  luvi t)seuoimpno1lmtelfct sf 2tau oou1tpx mieiydlaDuanvs;(4alermrctodfat  i ol()texrirpny4oltemivsl()sDuaur nu4tetoifctasla rmums;(4trtnif todop rauvs;s texmxr3oydale mfvtat a2ra(rpnu4oetomi3ildfmDemnvp;t)aetrxfctytfa eli i;t0srur(rpoo1lptnmfct ( aDtmurp;o4altomo3ilsfa2um(vont0 lxnircio1lp  liei s)s2tr(r iy4lp n iviatfsDtru poo4ape miciatfa2rmn s t0areomrctadfp rlieo t  2tmim io4lm   fetls aDumxm ;o0oetoiietatla2rl(vsn(4 rxoir totoat  neo;s sexrim iu1olenmnvsl( a2ur(mont1tpenii3tld aDul( o t4 ltrxrciadfaDeauesl( s2toir oo4amtemfvt sfarur(rpoo1apx iiciadlsDel(vonu)aeeoir3iatlaDeliei ( tetr(o oy1op emnvtas arrax p;t1ale mfciltfaDrm(mo;t4 rxnxfctodomDraneo;t) 2trim iu1optn fvtls a2rmxmono1apeoioeiat s ra(mp (0 rtrxfcty1opD aivils0 rxrir ou4lpeelfvtls  rrr( ono1altn ieiytlsDumu pnt)alxnxr3ta1om eanes;(0 etmxr3nu1opte fesas sDrax  ou4tptn ociasls rmnmp;t4 exnxo3to1omDean sls trxrxrpio1ol   ietlsfsrrm(monu1tltnio3ild s2ul(mp t4artnmrciotoatelies () exmio iydom nmict (fs2rm(mpnt1tetnmieiytlm umu o;u0aexnxr oa1lmD aivo;() euriopiudopenmicsatf ruaxmoot0tpt iocilt m ulnmp t4alxriocta1fatelnesl()tetoxm3oydll elfvs () 2rr(  no4tpxomoctydla2rmu s;(4tltrmo3oytopDrln o;(0 rxrim nudope  net (fs2uaur ot4olen ieiltfa2ra(msn(0 lxnircoo1lpDe u olt)t2xr(r nydol nlfcsatfarumxrp;o0oltomf3iydlm ranmp;u0alenir3tytlmDelnvo;(0t2um(mpnydom nmieias)srraxmpno1olxoifeiltfm emumpnu0tleoxr3tydfm  aivo;t  2xr(m oo4lm emfct t)a2uax ono1oleoii3iyd mDuanvpnt4tetoir oo1opDran ol() 2uoim nu4lpt  nvtl()a2ua( o;o1alenio3iyd sDrauvp u0arxoir3oadlpDrai i;(  rxoxm iu4lp   ici s)sDrm(m nt0tptomo3ias a2ul(mp (4aexrxrciadfmDeln s;s  rumirpnodomee ncslt  rrm(mono1ope io3tadfa2rmuvp;()artnxr iodfatrlies ( trtoxm3ny4alenlietl()aruaum ;o0oee ioeiysfs ra(vp;()treoif tatla e uvs (0 2ur(r ou4ame lncias  2rmurp;o4opeomociadfsDumu o ()trtrxf oatlm  aiei;s) rumimpnodol elfct t s2uaurp;t1aetomoctld m2rlnms (4aexnif3todomt luvi s texm(m ou1ll eliei t arrrx p;o4oexomfetys s ean s;t)artrxo3oa1fatr n i;s  eumim3ou4lleelici ()aDua(m ;o4olenioeiatls rl(vo ()altoifcoa1lateln o () 2to(m ny1om   fesl(faDum( o;u1apxniietatfmDua(mp;()aetrio oodlat luvilt0t2to(o3iy1omt lnctlsfsrrmxmono1tpto o3tltla emnmsnu) eenmocoy1lmt lnvil( setoim3no1lptemfciatfa2rmx o;u1tle mietaslm umump u4texnmfciytoat li ols trxr(r ny1opeemivias)sDuaum ;o1oltnmoctys sDea(monu0 etnxf3tatopte iesls)tetr(m3oo4ap emivils) Dra(moot4olt iiciltls2uluvont0 etoxfcta1lpDrlneo t  exrxr iydllen fetls s2ra(mpnu0olt  ociad a2rmuvp;u) renxfctadla r nvi t) eurio nydomeemfvt sfa2ra( ono0aex iieiadls umu p;t4tetoxrctatlptrlnvslt setr(r3oo4lpeemfvt s a2ur(r ot1tlto fctltfa umnvs u4tlxrxf3oatlpDelneo;s0seumim3io1omtnlneia() 2tauronu0tleomi3tldlm2el(vp (4alerxo3oatoaD anvsl( srtm(opiodamt lfvs t) ruau  no4opxnmictatlaDel(mon(4 rtnmocto1omDrluvs s trumxr3iodop  mneia(  2ua(rpou0altoio3tas aDuln o;u0tlenif iodlateauvo;s  2xmiopiu1am  mnvtl(faDtr( poo4optoioeias s uanvo (0tleoxo ia1lpt  n ol()setrxo ou4optn fvias) Duaxmonu4opxnmociatlm eauvo u0 eenxocta1fmtelieo t) eto(m nodllt  ici t) Drru  nt4tlenmoetyt s2eaumo u)alerxfciytfaDranvo t s2urio3oudaptn fvil( srrr( poo4tpx  ieiytlm2rmn p;t4tltnmfctodomt liei;s)trtm(m oo1ale lfctat s2tm(rp;t4oee ioeiadlm ua(vont4aetoxr3oo1fa e u o t)trxmxm3oudlpte iviltfa2rrxmpoo1tlxomfcildls2eanms u4aeenxf oydfa  luvo s s2tmxm3ou1am  mivsl(f 2trurpou4apxnioeiatls2um( onu)trtnir3oodopDeaues ()srtrir ny1aleeliesl( s2trum ;o0altoiictyd aDeluvo (4aexrxfciy1fmt aivs;s srxrxr3iy1ol elieil()s2ta(mp;t1altoiiciys sDranvo;(0altnmrcoy1fmDrlivol( tetr(rpiy4lpenmfvsl() Drruroot1ole mf3iysfsDumn s;()arxnxo iotfa eauvo;( truoxm3iodlp   ivt (faDtaump;t1ape iocild a ea(vpnu4 renio to1oa eau olt) etrimpoo1olee netl( artmum ;u0tptomo3iydlaDel( snt4aetnmr3tytlmt  ieo t0sruo(m3io1oltemfvtl(  Dtaumpou1oexniieiysfaDemn p;u0aeenif to1lmD  n i ()srtrio oy4am  lfvia(  rrr(m nu0oexn f3ils sDum( p;(0aeenircoodlptrau olt t2xr(o3ou1optelictls)sDuaum ou1alxo feilslaDum(ms t4 rxnxo3io1fptelueils0trum(m no4ap  lnetat  2ta(  oo4apx iicilslaDumuvsnt0 lxoxrciy1op ean olt t2xoio oo4lpe lieslt artruro;o1olxo iciyslm2um(mo;() rermo ty1lmD lieo (0 2toxo ou1optelnesa()arrmu o;o0tptnmictasls rmn p;t0tlxnxo ia1lm ranei;s) 2umio3io1lpt lfvs s sDum(rpou0aleoiieiyt m umumsnu4teerifciy1fmDe u i;t) eumxr ny1apeemics tfarrmu onu0oeeo i3taslaDrmu s;u) eeoir iotomD  uvo;t) 2umio3nydap emfetl() 2raurono1opxo oeiasla2rauvp;u0aetoiocto1opte u i () rumxopiodamtnmfcta(fa2ua(rpnt1ale mfeiatlsDeanmp (0trxnxo todlm rlieo;(  euriopiudale mieta()aDtr( pou1oltn i3ildfmDran s;(4alerir iodfp rauvi;t seum(o iydalt  nvsa()sDtrump;u0olenio3tld mDrlu p;u4 exoxf3iotfaDrlnvo s t2xo(r3iudamt mnvtl(  2umxront1tptnioeilsfm uluvs (4 etnio3io1laD  i o;( texrxopoo1al   fct s arua(  nt0tlen octad m eanvs ()aexoxrctytfm e ivs;s0 2uoiopny1llen ivt (fsDrru oou4tpeoioetasfm uln s;u)texrxo3oatfm  aues;(0 rtoir nodaltnlivsas)s2rr(rp;o4texniieiytls uaump t4tltoxf tytlmDelivils0s2tmxo3iu1apeemietas) 2tau oou4ape  fciysfsDranvon() ltomrcoydlatrlivsls0tetm(r oodapt mfct s)sDumumonu0tptn icildla rmuvs u4tleoio3ia1la rlnei;s  2urio3oodom emfei s)arua(r no0opeoiicilt sDulnmsnu4arxnxf3iytom  auvo;(  2xm(o ny4lmenliei t a2truroot4opeo oeiadfm rm(vsnt4trenmo3iy1opteln ils trxr(o oydole lfvils a2urur nu0aex moetytfa2el(msnu0aexoio3oy1optranvs ()sruo(opio4aptn ivsat) 2ra(rpno1olxnmfeilslmDrm(mo;u0trxrxrciatfaD lies;s)srto(o3iy4lptelfesa(  rtax o;o4apt  feiytla ua(mp (4teeomo io1fmDrli o;(  etriopoy1ap emicta(  rtrum no0tltnii3tadla2eln p ()altoxr iy1lateau ol(0 2to(o3iodolt  iesa( artr(roou1ope mieiydlm ulnvpn(0 eeomfcoatfat luvol()trtmim ny1lm n nvta( sDtm( pou4oetomf3iytlaDrl( p;u4tltnxo3ootfpt li s t) rxm(o3iu1altn nct s)s2ta(mont1texnmictytla uln s;t4alxrmo3ia1oa   ieo;t)tetmio3oo1om e nvs (fsrtmuro;o4tetoiieiadfa rm( pnu0trenmr iytoa e n sls0t2xoxm3iy1lm nlnvtl()a2urx  oo4tetoio3iatlm2rmnvo;(0arxrxocio1oaDeliei ( teurio3iudop  licsas)artrump;u0tptoiicils a uanms;()alenio3iadfm   nes t)srxmim3oo1lltn ieiat) rtax  ;o4oeeomociat s2rmu s;()aexrir ia1omD  u o;()srurim iudlptemiei s sDrr(rono4alx  f3iyt m rmu o;()tltomrcto1op rlnvilt)sruoxr3iodll  lfetas) ruax  oo1olto f3tadls2eaumon()artoxr3oy1oa  anei t) euoimpiydale  neslsfsDtmxmpoo0tpxo f3tytlsDrmuvp ()arxrmoctotfaDrli olt0trtmir3oydamt mnvias)arua(  ;o1tpt  f3tldlm2umu snt)tetnmo3ootfaD lieo;t0teto(m3oydal  mfetasfsDumu  nu0tleoiietysfs eau pnu0aexrioctotlmt  u o;t)setrir3nodole lnci (faruaumoot0oee mi3tldlsDelnvsnu0arermrciodomDeli i;s0setmxr3oy4omenlfcsltfa2tauronu4tleo o3iasfm2el(vpnu0trermo3io1fmDr i i;( tetmir nu1lltemfvsl()sDumu pou0oet  feildfaDemnvo t)aleoxfcoytlmDr ivi;( trurxo oodlpt mfetas s2tm( o;o1tpxnioeiyt sDrlnmp;(4tltomfcoadoatr i o;t  euoimpio4optelneta(fsDumx  nt4aetnmoeiysfmDumn o;t) lerif iodlmDelueil(0 2xr(m oy4amt miviat) rurx  ot4apt  o3iadlmDulumo t0tleoxocoatla e nei ( teurxrpny4op n nvt t a2rm(  ot4oeeoioetyd mDel( o u)artoxrcty1optraiei;( sruo(m3nu1amtelnei sfa2ua(m ;u1apxnif3tlsfm ua(vo;(0artomrcoadom ranvs;(0 rum(o iy4openlfetatfarra(ro;o0opt  o3ilsls rl(mo u4 exrircoo1lm eaivs s s2xrir3io4amtn ieta(fsruaum ot1oee io3ildlmDumnvont4alxnmf3oodfat auesls0 rtmirpio1optnlncil()sDurx p;u4oltoifciydlm2ea(vs u)alxrmr tadlat  n ils0 rxriopny1apte ivsat) Duaxmo;u0alxnmfciytla2ulnvp;()arxrxrcty1lpDrlivo ( t2umir no1lle livt sf 2tm( ono1opxo f3tldfsDrm(vp;(0 etrir3totop eluesls0seur(o io1al  mietlt)artr(rono4ole moetys sDrl( p ()artnmf3io1omte nvs;(0teumim3nu1openlnesa(  Drrx pnt0opeomo3iydfsDulumpnu0aeermo3oy1lmt auei s0s2xmio oodap  mnvil()s2trumont0tptnmfctld s2umnms t) rerir iydfatr uvi;( texrim3oo1opee nvtlt arraxr ;t4tpenmictaslaDrau sn(0 lxoxocio1lm   ueslt  rxrxrpoy4lmenmfesat  rraum ;t1aptoif3ildfm rm(ms;()aeerxrcoytlmDr n s t0s2xmim oy4opt lfei sfa2rmumpno4alt  feilsfsDumumpn(0 exnxr iodlp r nes s) rxoim3iudoleelncs () Drmum oo4olt mf3iadlm elnmp;u4 rtnxf iy1op  au i (0 etr(opoudlmte fcil(fsDtrxr ;t1tlen o3iltla ran o u) ltoxr iotfm  an i (  eto(m3oo4open netasfa2ua(m nt1altomf3tld m eanmsn(4 exnmoctytfmDr nvi;s) etrir3ou1om emies sfaDtax pou4aet micild s2emuvonu0tlxoxo oa1oate ieilt0srur(o ou4aptemfeia( s2umu pou4texnmf3tytla2eanvs;u) eeomr oadfp r uvi s)t2umxmpiudal  lnviatf Dumuro;u1tptnii3ilsfsDrm(mo u4 rtrio3iatfm   i i;(0trum(m iu4lpt  icils s2uax o;u0ole moeiydfa ea(vpnt0tleniociy1oa   i i t)truoio nu4olt liei t s2ur( onu0tlxoif3tys s el(monu4tlxrmf oydfmDelivi;t0s2tm(rpnudom e neiasfs2trxmooo0tptomo3iad sDra(msnt4aeeoxo iytfpt aueslt tetoiopoy4am  mivt (fartau ono4apeomoetytla rm( o;u0 renmf3oydlptraieo t teum(o iy4lp nlnei (  rur(mp;o4tetnmociysfm2em( p t0arxrmr to1opD  nvi t)t2umxmpiu1llte ieslsfa2ta(  ou4tpeo f3tydfs2ea(vo () eenmr3oodlptean o;s  eumim3oo4omen ici s)srtaum oo0optoii3tlsfa eaumo ()aeenxocty1lmtelues t0truo(opno1ape mfcs t  Dtmur ;t0oltn o3ilsfs2ra(mpnt0 ltoxo oatfp rlnvo;t t2uoio3io4ale liet t)a2urx pou1ale ifcilsfm umuvs;u)aexnif iotfpD  ivilt0 rxrxr oo4am  mieiat sruau  nu0tptoiociad m uaump u)alxnmr3iodlmDrlneslt)teumxr3ou1am nmnes (fsrumu  ou4texoif3tltfm uan o;t)texoif3oy1oateauvo t  ruoxrpno4llenmivsas)sDraumo;t4aex ioeiytls ea(vs t)arenif3todfm  auvols  2xoxo oydlpe mnetlt aDrr( pou1oexnmf3tldfmDum( ont4altrmo oadopt  n sls srxrimpoy1ll emfcta(fsrrr( o;o4aee mieiad mDrl( ont0 rxoioctadlpD ln s (  rxoxrpou1om n nvt (f rtr(mo;t0aptnii3iadlmDra(vsn(4trtnir3oytfmt ai s;s0t2xoir no1optemnvtls) rtau ooo1alx  ociat m ul( snu4texnif3oa1fatean s;s0 2xmxr3iodal   fctlsf rtm( ooo4olenifeias aDrmuvs u)aleoxf3oy1omtr n s s)srurxm3nydopeelfetas a2um(mpou0alxo ictadlsDum(vp t)alxomfcoydoat  nvi s0texm(opno1lm  lnvt tfarrau p;o0tlt ii3ilsfs ua(mpnt)teerxrcia1omDrai ols srtmxr nu1lleemivs () ruru  ot1alt  o3iat sDuluvon(0arenxfctytlmDeauei;t) 2tm(o3io1ale  fesl()aDtmur ;t4oexn oetytfaDra(vsn(0 eerxfciy1fpte nes s0srxrio oodope livtat)arrmxmo;t0tpxnmocildlm2eaumo u4tlenmo3oy1lp r n o t  2xrio iudlleelivs s)a2tm(moot0oeeo fetys sDrmnmp;(4aexrxrcoodomD  uvol(0setoxr oodolt  nvi t)aDur(root4alxn i3tatlmDemuvp;t0aeenifctodlp rlneilt  rxo(m3no4ole licias) 2umx oot0altoio3iyslaDea(vonu4aetrmr iydomteaues ( texm(o no4amtnlfcsas) 2rax pnt0tpeomiciytls2emnvo;(4 leoircty1lm elnvi s)srxo(o ou4am   ieta( s2ur(mono0tpt ii3tat sDranvsnu)tetoxo iytomDe ivi s teuriopnodoptelnvsat srrrurp;u1aleomietlslmDelnmont0tltoxr3iydfpt luvo t s2urxopoydalen nesa( sDumumpoo0alx mi3tas mDum( o t0treomr3oydlp eaneslt)t2tmxm no1op elnci ()sDrr(roou4aetn fctys sDul( p t) exomfcoa1fmteau i s  etm(rpno1ape  fctl() Dururooo0alx mociyslm2rln s;(0trxoir3tytom ranei t s2tm(r oudlmenlnci s)arrm(  ot1olt  i3iytlsDelumsn()tlxnmr3ta1lpt  ivo;s0srtr(m iu4omee nvt s aDrr( oou4texomictlsfsDel( o u0 lxoircoytop ranvi t) rtmxr3oo1lpenmivi () 2rmu  ;t0tpxn i3iysla2ea( snt)aexomrcoodlaDrliei;(  2umxopnu1op  mncsls) rrm( oot0apxn feiadfmDrm(mp (0 etnifcty1oateaivsls tetr(o ou4ol elici s)sDtrxmpnu1apx ifcildfa ulnmp (4arerirciydfaDeaivsl( t2uoxr3oy4optn fesas a2rm(monu0olxnioeildfsDua(mp;t0 lenxfciatlm eanesl(0t2xmim3iydaltn ivt s artr(rp;t1tltn f3tasfm ulnvonu)arxrir todlpt aiei s srxo(m no4apee nvi (  rtr( onu1olt if3iaslaDranvp;u)tetrxf3iytoptran ils  eum(r oo4am   fcslt s2ra(m no1opx  fciltlm ran o ()trenxr3oodom  anvs;s)teur(o3iu4lm n fcslsfsrurx oot0optnmieilt a2rl( pnu4trtriocoytlaD luvs;s)trtmirpoodlpe lfvi sfaDraxroou0oltnmfcild s em(ms u) etnxo3tydfpte n il( seumxrpou1ope lfvil()aDta(rp;u1tpxnmi3ias a rlums ()arerxf3oytomteauvs s0t2tr(opiy4ol nlfvtlsfsDtm( pnt4tlt  octltfa el(vp u4 lxrio3iotom   ivol( trumxr nudlpe livtl(faDtr(roou4optoioetld aDrm(mo;t0 lenxo iatopte u i (0 rtrxopiudlle lnvt s srum(r nt1aleoif3ilslm emn o;u0tetoio oy1fpt anvs;t0 2xriopoy4omee nei t srum( oot4olxnmociatfaDua(mo;u0tetomr3oytoat li o;s  euoimpno4lm nmiet tf rrmxrp;t4apto o3tatlaDuaums;u)tlerxrciy1fa r u slt)s2umxrpiu4alt mfes s)s2rr(mp;o1tptn fetytfs umnvs u0texrxf iotfatrai i;t tetm(m no4alenmfcilt srrrumo;t4olto oeiat m rl(vo () rxnmrciytfaDelivi t s2xm(r3iu1lm   fctas  Drrurpnt1teeomociyt aDul(vp (0 etoir3iydomt aies;s teuoio3iudal e fvtls) Duaump;u4tptn icildls ranvp;u0aetnif iy1lpDelivo s tetrxopiudapenlictls)s2uaumpnt1teeoioeias mDulu o u)tlenxr oo1fate u slt0 rur(r ou1lmenmnctas artr(m ot4altn feiyslsDemumo ()aexrxr3iytlmD anes;s0s2to(o3iy1ome lnciatfsDumx  ;u0tpeo fciyd s2ul(vs;()tlxnmf3tydfaD lu s t0t2urim3iu1lm nmfcsls) Dtr( o;t1tpen fctytfs emu sn(4trtnxo3totlmD  nvi;t0teum(m ou4lmtn iesa(fsDtmu pnt0aet iietytlaDea(vo;u0arxoir3oatfatrauvs;s)seur(m io1alte nvs t  2ua(  nu1opxn ieiyt m um(vo;() ltoxfciatopt  ueolt)t2uo(m nudame mfet s)arur(  ;u4opto ocias aDrm(vo u0tetrmr3oo1op e nvil( trtrxo3iu1oleemieils aDrrumo;o0tpe  fcildlsDeanmont4aeenmo oytomDeau o (0 2umiopoy1ameemict t) Dtrurpno0tleomi3tls m2ranms t)trxnmr oatlmte ivi;(0srtmxmpio1ole  ncias srtrumono1aee  octyt m2el( p t0arenio3ia1omD lneol(0seurio3nudapte fcilt)artrxr ;u0tet mo3iasfaDumnmo;u4 eenxf io1fmtr ies;t)seto(m iy1om e icsasfa2uaxr ;t1tlen ietadls2rlnmsnt)tltnxrcoo1lmtrliesl(  etoim oodale mncsat s2ur(r oo0apxo octlsls2rlnms;t)aeermociotfa eanvils)sexm(r3iy1ale lfetasfsDrmum ;u4tpx  fciasfa ea( onu0teerxf oodopte n ils trurxmpiy4op   fcs tfarrau oot0tpto f3tydlm ea(vpn(4aexnmr3io1fm r ivil()t2xr(mpnodamte fvtls sDtm(rpnu0alxomfcilt m2el(vo;u)texrirctodlaD anvo (0seur(m ny4op n ivil(  rtru  oo1oleomo3iaslm2ul(mpn(4arxnir iydlptr n ils) 2xoim3oo4oltn feil(f rtaxrp;t1aeeo o3tydfs2uanvs;t4 renxfcia1lmD  u i;t0srxriopoo4lpen ivs tfsrurxmpou0aee  f3ild m2um( on(4tlerif oytlatelivo t) rxoxo3iy1ope lfvs s  rua(  ;u0aleo i3iadlm2eau p;u4teenio3ty1la  li ils0 exmir3oy1optn ivi ()aDumum ;o4tltomiciadfs2rlnmsn(0trxoxf3todlptelneilt0t2xoio3nodomtnlicsa( aDtaxr nt0oeen i3tld mDua( o t4 exrxo ootlp  anes;t seurxr3oudlleemfet (faruax  ot4apx  ietyt s umn sn()aetrmf3iydom eluvi;t0 rxmxm iy1lptnlfcta( aDtrxmooo0opeo oeiys m2uauvs;u0aexrmf iotlm eauvs (0 exoio3iu1op   nvslt  rrmxrpou0tpe mi3iyt sDelnvo (0arxnifcoytfpt lnvs () rxo(r iudop   iciat)arrax  ou4oex mf3iat s uaumon(4alxoxo oadfm r ues t setm(m3nodomenlfesl()srtr(r ou0tpt  ietat mDumnmo;u4altnioctotfaD luvslt)trxrirpnodape mfcias arrru  ;o4ape io3iys mDel(monu0 rtoxf oatoaDraueolt) 2umio oudape  ivil( sDuru oot1aee ifcildls um(ms;(4texnxf oydlptrlues (0 eumiopoy1opee fcil(  2tru p;t1opxomf3ilsls ea(vs;u) etnircia1lmDr uvols trxr(m3no4omee ivs s)srtrxr ;u0ole mociytla emnvp t4tlxrmocto1opDe i o s0 rxmio iu1apeelncils) Dtaumoou1opx ifetat s2um(mp t0trtomf oatfa r ivslt  rxrimpnodll   nvi s) 2tm(roou4tpeoifciysfa ua( o;(4 eeoxf3oydom eauvo (0srurir3oudoptemict t aDrrxm nu0texomfeiytlaDumuvsn(4tetoif3oydlpte u il( sruo(o3oo4oleemfci ( srrr(  nt0oeen f3tldla ua( o (0 rxomrciy1lmDelieol()t2uo(o no1lm  mnet s) 2um(rp;o4tex  i3iyd a uanvsnu4 exoxociodfpDr ivol() etr(o ou1amee fcs t) Dtr(  oo1apxo fetatfm rauvpnu)trenircia1lpt aueolt)sruoxm nu4ol n fei s arrm(ro;o1apt mfeiat m ra(mpnu4alxoif iatoateluvi;s0setm(m3no4amte ivt ()srtax ono0ale mo3ilslm2rl( s;u0alxrirciotlpteauvi ( s2uo(m3iudlpe  fesatfaDra( ont0aet  fctlsfm2uanmo u4aetoir ia1la raneilt0sruoxopoo1ap n ies t arumum ;t1aee miciatls em(vont0 rtnifcia1omDrluvs s s2uoxm iu1ol emfctatfsruaxmonu0texn ieiad a ea( p;()tleniociotoptrluvi s)setmiopny1ome  icsl( a2rrxmono4tlt mocils mDrlnvo;(4aetnxr iodomD an s ( srto(o3iodomtnmneil()s2um(mooo1oee mfciadla eanmp ()aetrirctodfmtrlueo;s  2urim3iy4aptelnci tf Dumxmont0aptnio3tatla2uluvsn(4tltnxrciytop rluvs t s2urxopio4olee fciltfsrta(m nt0altnio3iytls em(mp;u0trxrxo3tydlmt anvi;s trur(o oy4apt lfcias) 2taxmp;t0texn i3tydlsDumu o;t4 etrio3oodfp   nei;(  rumimpnydameelivsat)sDraxrpnu4tpto icildfm el( s t4artniocta1faDrlies;()srxoirpio1aptn fcsa(fsDtmur nu1oeeomo3tytfa2rl(vo t) lerxr3oy1omtr nvi;t0seto(opiydll nmivilsf 2taurp;u4tlx ifcild s elnvs;() eenxrciodlm rlivi;t  2to(r oo4lltn fvt s  Dtaumooo4tpt  ieiysfsDumnmsnt0arxnir oatoa r u i;s  2urxo iu4lltelfei ()a2umu pno4oeeomietltfm rmn onu0artoxf ootlpD li i t trxr(r3oudap n fctat)aDrrurpnt1optnmi3ilsla2emums;u0 renir oodlm  lu o;( s2toir3oydaptnlfeslt) Dtru ono4opxomf3tltlsDuln p t0aexrxr3oodomte ivi s0trum(r oy4amtn nvilt aDurxro;t4oltomi3iydls2em( o () lxrxfcio1la rli o t) 2umim oy4ap nlfvils a2tr(r nu1texn octasla uluvon(4 etrxr oo1la rlivi;s seuo(m no4al e neta()a2taxro;t1texomoetyt sDel(mp;u0trtoxo3to1fmDeanes;( t2umxo io4ol elnctls srtaxro;t4aetnmi3ilsls2ulu o (4altnxr iydfptr n ils)t2xrir3ny4altnmfeslt) 2ra(mpnu1oexn ieiat s rlumon(4tltnxfcta1faD  ueo;t0 2to(mpoudopte nesls srtmxr no1oleomf3ias m rmu s u0alerxf iy1omDr ivsl(0truo(m iy1amenlnctl(faDtaxrpno4oeenmfciydfsDelnvp;(0tetomocoadfpDrlnvs (0texrxm oudomeemfviatfs2rrur ;t0teto ociad aDum(vp u)tlxnif3oodfm  li olt0s2uo(m ou4omtelneils)arta( oou4olxoiiciatfa2ra( snt)aeerio3iadlm  an o;t0trtm(opiy4amen ictat)sDta( p;u1apenmocias m2rmnvsnu)altrmf3oatoaDrauesl(0 rtrxo nodoptemnvi tfsDtrumpoo4opx  ietys m rlnms;t0artnmo3to1laDr neols0tetmxopiu4omeelivtlt)srtmu  no1tpenifctydfs2eanvp (4tetnxrcio1fm  ai i;s) 2um(r3iydap nlfes ( s2ta( pou4tlto fciyd aDem(vsnt0 leoir ta1fmtrai o;t0srxmio iu4amtn ivsl( a2rrur nt1oltnifciltlm ul(msn(0trenxo io1omD lu sls0trxmim3nudlm n fcsat)s2rrur ;o1oetoio3iadfa2umuvp;(4aetrxrcty1lpDelnvo (0srxmio oo4opt mieil(fsDrmu  ou4aeeniiciad a umu ont4aeenmf oodom  livs t0srxm(r nudam elnvs tf Durxm ;t0aetnmiciltfa2rm(mo t0tlxnmoctotlaDeaies;s) ruoxm iu1lmt mict ()aDta(rooo0oeeomo3iadfa2umu ont)tlxrir3oadom  livils0t2xoxmpnu4al emivtat  Dtmu oot0apxo octasfaDrlnmo;u0arenmf ia1omD aieo s0 2xo(mpoo1ale  icias)s2rm( p;u0aexomoeiltla rm(vpn(4 rtnmoctydlmtr ivs t)t2xm(r3oy4amtnmfvs t)s2tr(r no1tleo oeiat sDrlnvs;(0texnio3oa1fptelivs;s0srxo(r ny4am emnetlt  Dumxrooo0opto fciatlmDua(vo (0arxomrcoodfm e n ol()seto(rpny1apt  icia(fs2rrxm ou0tlxo ietys s uanvsnt4 rxrxo3iodfmD  i s;() rtoim oy4al   neia(f 2ra(moou1ale  octytfm uln o;t)trenxr3iatfp elu sls trxo(m oudom e ieia(  rurumonu4tpeo icilt aDelu s;u0trxriociadopD  nvs t  2ur(m ou1om nlnvi sf 2uax pno0aexnmociys m2emnvonu4altnifcoodlp  lueo s  etoir3iu4lm elnct tfsDta(rpou4opeomocils mDrm(msnt0 reoxrciadomDeanvs;s  exm(mpiudlp  livsl(fsrtaxrp;t0altnioeiytfs2um(vsn(4trtrxrciadlmD lieil() rum(mpiu4om n nesas srrrurp;t0tle io3tytlaDrlums;u) rtnxf3iotopteanvi;() 2uoxm3ny1lm e ietas aDtr(m ou1apxnif3tls sDemnmsn(0 exnio3ty1lm eanvo;s) rur(m iu4ll emnctas s2umxrp;u0openmfeildlaDeanvo;u)tlerxf io1oa ran o s)texr(o3oodlm   nvtl( sDrr( o;o0tlt io3ild a2elnvp;t) lxnxr oydlpD  n i;t t2uoio3io1om emnvt (fs2tax pou4oltomfetad s2um(vp (4artnxrctadfpt aies ()trtrxrpoudal n nesl(fsDrm(rpoo4altn o3ild m uln pnu4tetnifcty1fmtraivils s2toio3ou1apee ieils aDuaurpno1tltn o3iys s um( sn()treoiocoy1faDe uvi;t)s2to(mpiy4op elnvtltfs2uau pnu4optomfeiyd s2ranmpn() exnif3ty1omDranvolt0s2tmim ny1amte nvsa() Dum( poo1oexo ieiys a ua(vo (0texnio3iatla  liei s trurxo iu4llt  nvsl()sruauro;t4oltoiieiydla2el( pnu0aexrif3totlat auvo t0srxmio nydoltnmnetat s2rrx p;o1oetnmoeilsfs rm( s (4trermf3oatfm rlnes;t)t2toir ny1lle lfes (farua(m ;u4tptnifciyd aDemnms;u4trtoxr oo1op rlu o;s  rto(mpoy4lm e feil( a2rau  ;u0opxomo3iat a eau s;(4trtrir oatop eln s s)t2xrio3ny1alt licslsf 2trxro;o1tpx mietys m2ul(mp;() ltrxrciotlpDean i;t)trxmxm oydal emfeta(f Dumxr ot0olt moeiasfaDulumo;(4aleomr ta1oat  uvo;( seumxrpoudllt mncsa()aDrm(mpou0apx moeildfa2eaumpnu)trxrmf3ta1fpDeauei;t0sruo(o iy1opeemfeias) Drrur ;t0tlenmi3iat a emnmo ()trxoif tatla  anvi s0 2tmim oo1am elfes s)artrumpot4aex mfetadlm2rauvp t4aeerio iatlmt  ueolt) exoim3oudlp   fcsl(faDtruroot0oexn oeilt m2rau p ()alxoxr totoaD  ivi s tetoxo3oo4omtn fcs s  rtru pno0texnii3ildls2ra(vsnu4aexomf3iatopD  uvsls0trxrimpio1ol   ivt sfs2tax pnt0tptn icilsfs2rmn s;u) lerio iytfmteanei s0 rurxrpio1lmt lnvtlt  Du
\ No newline at end of file
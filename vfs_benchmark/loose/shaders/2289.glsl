@@ -0,0 +1 @@
+ies;s  etm(mpio4op  lfes tfsrua(mpot4tpe ifciydfsDulnmo t4alerioctatoate neilt  2xrir iudole mnesasf 2tax ont0tpenmieiytfa2rlumo u) ltomf3oa1fp ean s t s2to(r3oy4ap nmfei t srtmump;u0tlenmf3iat s el(mp t0trtnmr3iydlptraneol()s2umxrpiydop elieiasf Duaumpou1alt moeiat sDulu o (0aetrmf3iy1lm eauvo;(0setr(o ny1lltnlnesatfs2urxm nt4tpt ioeiasls rlump;u0trenmf oadopt  ies;(  etrxo nu1alee ietls)s2taurpno4tlxnmoctas sDem( p t4 etrmf3iadlpD liei;t  2to(opiodamtemivsasfsDtaur ot0tleomfeiasfsDeanmsnu0tetrio tatlaDelivo;()trxoxo3iy4op nlfesl()aDra(ront4opxniicias m em(vpnu) eermf oadfpte uvi;s  rurxr oy4altnmieiat sDuaxrpno0olto ictatfs ranmp ()aeermrctotoatraieo;t)srxmxr3no4ll nmnvsas  2rrum nu4apenmf3ildfa2rm( s;u)aeeomf3oodfp e ivol()t2xoio3iy1am   icil(f Dtmump;o4tpenmoeiyd a2eau p;t) eerif oy1lpte i o t t2to(opoudapenmnvil()aDumurpou0oeen fciyt m rmnvs u4altnmo oo1lmt au sl()srtoirpiy1ol  lnct ()s2uaxmoou1olxnif3tld mDul( pnt) etoiociydom  lnvo s)tetrxm3iudll  liei tfs2rau  ou4alx ii3tysfm2ean s t0alxoxf oatom e i o;( trxr(o iy4lme miesl(fsDumxm nu1opt ifctatfsDum(mp;u0 exrxf iy1fpt lnes;t) etriopio4lleeliciat sDraxr ;t0olx mictlslm um(vpnu)aetnif iy1oa e u i (0sexoiopiy4lltelfesa() Dururpou4teeoioeias m ul( snt0altoxo3iydlaDeauei t0texmxr no4open fei (f rur(m ;t4tpx  i3iltlsDraumo;u0altrxrcia1la   uvs s0trtoir3nydom nlfes sf rurxmpoo0alxo fciasfa2umnmo;u4 exnxf3ootlmteli s s srurirpiy4apeemnciat)arraxront1alto iciltlm emump;(0tetnmocia1fmt aueo;t0trtoiopnodlle lfvt sfarua(rp;t4tpt mictls a2uanvpn(0tetnif iy1laDelnvi;() etr(m3iudlle mfcsas) rum(ro;t4aexn f3iadfa rl( ont4 exrxf oadomDrauvs;t)trxrxm3io4am nmnvsa()sDrmum ;u4oex ifetas sDrm(vont) exrmfciydlpteluvo;()trxm(mpiu4ll   netl( artmx onu0apeo octasls emu s ()teermr3tatoptelu o t0s2umxo3ny4amteliei s s2uaum oo0oeeomf3ildfs2elums t0aetnmr tytfateauvils0t2um(m iy4lp  mnvs ( a2tr(  oo0olxomi3iydlm eau pnt0 etnxrcootoaD  ivi;() 2xo(m3no4apt livtlsf Dtrx o;u4oetn icilt s ranvo u0areoirciatfp eluesl(0 2umxo3iodll  mnviasfarumum ot1tpx mociyd s ran pnt0trenif3tytoptelivo;( srxo(mpiydlle lnvi ( aDraum ;o4aexo fciytfmDem(mpnt4texoxf3iydfa  li s s0trxmxo3io1optemnes ()aDtaur ;o0opeo feiytlm eau o ()tlxnir iydlateaieo;s setmxmpnu4lm elfesa(fs2rr(ro;o1aleoiociydfs2ua( p;t0 rtnmr3tadfmD  i o;(0tetmio ou1oleemneilt) 2tmumpnu1opeoioeils a el(mp;()aeenxo iodoa ran slt0tetrir ny1om elfcs t aDrmumpnt1tlenifetad s2el( s;t0 rtrircootfmDr uvo t0s2xm(m iudop nmfciltfa2tmx  ;t1tltnmoetldlm rmn o () ltrxociatoa r ieols)texmim3oo1ol emivsl(fsrua( pot0opt io3ildfm emuvs;u4tlxnifcoadlmt aivi;( trur(mpiu1lpeelfet s arrm(ro;o4tleo o3iyslmDrmuvs;(4 ltnmf3iydlaDrlu ils t2toxopio1ape  iesatfsrraurpoo0tpenifeiltfm eauvonu0 ltrmfciotfmt  ivi t)texo(rpoy1omtnmicil()s2raxr nt4oee  ocild s2umnvsnu4 reoir iatfa rli il(  rxoio oodol n netlt)aDur(ro;t1oet ii3iysfsDelnms u) rtoio3ootfatelu ilt) etmir io1op emivta()sruauroou1tet mf3iyslaDeluvp;u)texrmrcoatlaD lues s0 2to(r oydoptn ieil(fs2tmump;t0ole mociydfa2rmu snu)arenxr oa1faD lies;(0trurir no4olt  fvsl()sDtaxrpnt0tptomo3iltla eluvs u) rxoxr ty1fmt luesl(0 rxrxo no1lmte fei s srurumonu4apenii3iytfm2uauvp (4alxnmr3oy1fp rlivo;(0 exo(mpiy4opee fvsls  rtax  nu4tlxoioetysfa2uauvon()texnif3oadlmtrln o t)srxo(opiodoptemfviat sDuau pnu1ope mf3iad mDel( onu0artrif3oytfaDelieo;s0 eum(r oo1lme lfei (f 2rrx o;t4aeenif3ilsfs ean onu0arenxrciatoa raneo s0s2tmxo3oudll emfvsat  Dtruronu4olxnmi3iatfm2rmnvo u4 rxrxo3tytfa r uesl( s2xm(r oudlpte iet tf rum( ooo4tpe  fcilt m2ranmp t4 renmrcoa1oaDeaueil(0setr(m3io4lpt mnvsas s2tmu pou0olen f3tltls elu pn(0aeerif3totlaDe uvol(0 exoim iodlp   ieslsf Dumxrpot0oexomfetydfs umnvo;(0trxomfciy1oa eln il()s2tmim ny1ap  mivt t sruau onu1tlxnmfetyd aDrau s t) rtrir oy1faDeauvo t srumxm ny4optnlicia( sDum(ront1aet iictldfs2elnvs t)tltoioctotlateai ilt0 rtrxm3oydlmtnmnvilt) 2urxm ou0opxo ocild s ua(ms;() etrxociadfaDrluvs;() 2um(rpnydom nmnci ()sDrmxrpno4aptniieild mDulnmp;t0 lerxo oytlaDraueo t) etoxr3nu4lmenmnvs s s2raur ou4tex  f3ildlsDemump;t0tlxnxr3ta1fp  lnvi t) rxo(r oo4ame lnciat sDurxr nt0texo o3ild s ulu o t)tlxnmf3oytfm rlnvsls  eumxr nudom nlfeia(  2rmx  nt4tpeniieiyslm2umumo;t0trenio3oy1lpteln ils)srtmio3iudale micsat sDraxr nt1tlx mf3ias a rlnmsnt4 ltomociadlm  lu slt0t2xo(mpiudlm nlfci (  2taur no4oex  feilt s2rlnvpnu4 ltoifciydfmDe u i;t0 rtm(m3iu4optelfcslt)a2tmxm nt1oeeoiieilsfs ua(mpn()alermo3iydfmt  u s t)t2uoxo nu4lltn nvtl()sDtaump;u0tetoio3tasfm2ra(vpnu) eermocio1fpDe ieo;s0s2xmirpno1lp elneils) 2rru ono1teenii3iytls rauvp u) ltrmrciytoaDrai s;s  rurxr3iydaltnlivslsfarra( o;o4aexnmictyslmDea(vp;(0altomo iytom e i ols)trto(o3nu1omenmneilsf 2umu  ot4olen feiasfs elu o t)tlxomo todfmDraivo s0s2trio3oo4ol emnvtasfa2uau ooo0olt ii3iytlaDrlu s;(0artnmrciytopDe u i;( texm(r iu4llen fct s)sDua(  ot0tle  f3tlsfa umu p t)areoxfcta1lptr ieols0seum(m3io4al emnctl()arua( p;t4ope moctas s2rluvpn()alxrmf tatoaDr nvsls0trxoxm3iy1oltelfeilt) 2ua(r nu1ale mociyt m rmnmo u)aeenio iotomDeauvs;t) eurxo3iodom elfctasf Dururo;o4aetoiieiysfs ean p u4tlxnxfcoo1omDr ues (0trtoxm oy4omt mncs s) 2rm(ro;u1aptnmoeiydlaDel( p u4tlenxo3ootfm  au o (0trxo(opiudlp nmiesls srtr( pnu4aetomo3ils a ua(msnt) ltnmo3oadfp rauvil()trtmir3oodoptemics (fa2rmurooo0tpe io3tadfm2rlnmo u) lxoifcoo1omtrlnes;s)trxo(r oodap nlnesasfsrrm(rono0oeen o3tydfa2ul(mo (4trxnxr3iatla   ivsl( s2urir no4amtnmnvilt) Dtmu  ou0opt miciasfm2um(mpnu4 lxnmr iydfm e ivi;() 2triopnodlp nmics ()srtmurpou1tetnifetysfs2ran p;()aexomo3iytlm   uvo s  rur(r3oy1om emfes s s2taxrpoo0tlx mi3iyd s ean pnt0 rtrif tadlm rliesl() rurxr3oo4am emfeta( aDumxmooo0tltoif3tlt m elu snu4trxrir iatlaD li s;( sexr(r oodopt licsat)s2tr(mo;t0tetomf3iyd s ranvsnt4 exoir3io1omte nes;t)teum(m oodom nmieiltf rtmxront4tetoio3iatlm ean pnt)areoifciytop   uei s seuoxm3ou4amtnmiei s)aDra(mono0opeoioetatls uau o;t4altnmo3ta1lptelu slt0trtrxm3oy4lmenmnci t) rrmxmp;o0tpe  octas m uanmp (0aetnxo ta1op  auvo s0t2xmxrpou1lpeelneias  rrax o;o0oeeoif3tlsla el(vont4aeerifciytlaDelueo;()texm(rpio1ale lfcsa( a2tm(m nt1tlto fetltls emn p u0teeomfcia1oateaivsls)t2tr(o iydlpte ics s a2tm( pnt1opeomo3tytfa rlumpnu) rtrif3iy1op  au s;( sexmir3oy4ol n ictat srta(  ou0ole mo3ias a ranmp (4texrirctotlptr nei;s0sexmxopiu1lp elictat  2urum nu0tex ioeiys s uaumo ()alerir3tadoaDeai s;s)teumim3oy1oltnlncilt srrrurpoo0oetn icildfs2rluvp;t0 exnio oa1lptrauvsl(0 eumirpiudoleemivsls)a2umu  ;u0openifciasfsDumnvo;t)tltoio oa1om  luvo () 2um(m ou1lme  nctlt) 2rmxrpot0apxoii3iys m2emu o (0arxomocoa1fmt ai o;(  eto(o oo4op e ietat)artrxr oo4altnmfciys a umu s (4tltrmrcoo1lpD  ueilt) eurxopny1open netl(farum(r nt1opx  feiatfs2ranvsn(0aetnxr3iodoateln slt  rto(o3nudlm nmfcsls)srra(mooo4oeto ociadfa uluvs (4 lermo3oodomtrln o (0texoxopoy4lle mfcta( srtrur ;t0olx ioetlt s2rl( p;t4tlermrcoo1fat  nvi;()srumimpou1amt lfvilt) Dua(moot4tltnmieiysfsDemn o;u0 lxrmocta1faDrauvs (0s2umxopno1amt  fcs t  2urx  ot0olt mfeilt s uauvp u0teerif3oy1lmD luesls)sexr(r oy1op   fcs sfsDuau ooo0apxoio3tatla um(mont0aetomf3oo1fmDelieo;t t2toxr oodlp nmnei sf Dtm(rpnt1opt io3iysfa eau pnt0artnxf iadlp  ln ols) 2xm(mpou1lpe lfei t s2taumpou1alto o3ias m2eauvp;u) rxnxociytom e u il(0 2umxm oudop n iet t aDua(r ;o4oeen feiad m uanvo;(4artrxoctytfm   nes s) etoxm no4ol elneiat srtru o;t1oetn oeilsfm rm( pn()tleoiocoa1fmteanei s  exrir3nu4apte ivilsfs2taxrpoo1apen o3ild s2emnmsnu) rxnxf3tadlpD  iesl(0trtr(opoy4alenlnetl(  Dur( ono0aleomictas m2elump;u0altomr3oo1faDrau o;s)setmxrpou1lm emivtls)srrr( pnt1tptnmfcils s umn o u4tltnmo3oo1fmte nvo;t0 exmxo oy1om nmncsltfsDum(r ;t1opxn icild a elumo t0 eeomfctatom   uvsls s2xoxo3nydlme  nesl(fsDtrurpnu4opeoif3ild sDul( pnu)tlxrxo ty1opteli slt t2tmxm3nu1om  lietl() rtm(moou4oleoiietadfa2ul(vs (0alenxf iatfa rai o s0teuo(m nodlleemietasfartrxmo;o4olxo fcils aDuau o u) lerxf3io1oatrln o () euoxm iy1llee ict (f Dua(ro;t4alen fctatfmDrm(vpnt4tetnxo3ty1fpt li slt0 rxmir3iu1lp eliesas srur(  ;t0aeen o3tys sDua( p;u0 rtomr tadfmtrlneilt teumio3nu4opt mnvi ()a2trx oou4ape ifciydla2uan s t)tetrmoctatlmt li i;(0 rumxmpiu4apenmfvi t s2umum ou4optoiiciaslmDra(mo (0arxnxr3tatomDelies s) etoxm3nydap nmivi s)sDuax  ;u0tetoif3tadfa umnmsn(0 etnxrcoodopDelu slt  exoir io4lpt mictas) Dtaumpot0altoiicias m2emumon()aetrirciydomD aueo;s sexoim iy4am eliesa( s2rm(ro;t1aetn feiys mDeanvo t4teerifciytopDeaivs;( s2tm(o oudapenlieslsfarumxr nu4apeomociyd a2ean p (4tltomo ty1faD luvo s0s2xoxr io4lmtn ict tf Dtm(moou4aetoif3tlt a ulnmp u4 lxnxf3oytop e nvi;(0trxoxmpoy4am   nvil(  rur( o;o1oltniociyd a rmnvo;(0 rtomr oodomD lieol(  2xrxo no4optn nctas) Dtmx  ;u0oeeo ociysfs2uaums u4 exomfcoadopDrauvo t  ruoim3iodop  lnct s sDraumpot4tpx ii3iltlm2ra(monu4 eerir oydlpDrauei;t s2uo(r oo4om nmfcilt  2umumont4olt mieias mDranmonu) rtoif oytfaDelu o () ruo(opio4opt mnetat  Dumxmpou4oleoio3iyt s raums u)aetnxo oadoate ivs t0setoxr iydlm e iesas sDtaxmooo4oex  f3iysfs2em(vsn(0aeeoif iodlpDeluvi s0tetm(r3iy1lpen nvtl() Drruroou1oltnmociytfaDrlumsnt) lenxf3iydlpDrln o (0 2ur(o oo1amte nvtl()sDrrxmp;u4opxoifetltfa2uanvp;u0texoxr oa1om r ues;s)s2to(o3oy1lme lfcta( sDuaurpot1olenmicilt m2uanms;(4aexnxf oa1fmte uvs;(0trum(r3nudop e icsas)a2ur(m oo1ope iieiasfa2rauvsn()arxrmo totfp eaivs s)seuoir3iydapee fvt tf 2tm(rpot4apx  f3ilsfaDelump u4aetrxr3oytfm   uvo s0trum(r oy4opeelfct (faDum(r ;u4tpeoio3tltla umu s ()trxnif3ootfaDe ueolt0 eto(o oy4lm nmfctl( arur( o;u0tlx ifctydlm2emnvsnu4 exomo3oo1fat livi t) eum(opoy1om nlnvslt)sDua(r ;t1teen ociys sDrmumo;t4tetrioctodopDr nvsls)trto(o nydam nlfetlsf 2tmx ont1tleomictyd m2umuvpnu)arxnmo iatlp  li o;s teto(o ou4ol   ieslsf ruaumoou4oee iictasls rmu p u4tltrif ty1opDe uvo s0tetoimpio1ll n ietas)aDtau o;o4open f3tlsls eanvp;(0texnio3ootfa rlivil(0texoxo ny1ope lictl( srrm(  ou1oex  oeildfsDrl( on(4 etniocoatlp rai s;() exm(rpio1ll nliet t)s2taum nu0tlxn fciltla ua(ms u0texnir oadfp eaueol(  2urxr3oydaltnmfvs ( s2tmxm nt1tee moctlt m2ulumon()artnmf iotopD livi s)tetmxr io1olt lnes t) Drrumoou0aee ii3iydfs ulnvpnu) lxomf tydfaDeaieo t)trumxopoodlmte icsa(f rumu oou4tpxnii3tldls2uauvp;t4tltnxf3oy1omte uvo ( trxrir nydoptnlfeslsf Drm(mp;t4ale moetysla umnvs u0trxnir3iytop  au s;()texoxo iydamt mivias) 2um(mpot0apx ifcils s ranvs t) lxoiociadomDraivils0t2tr(r io4ap nmfes s  2rrur nu0apenmoeilsfsDumn o;t0altoiocoo1fate ues s) rurim ny4ll nmfci tf 2ur( o;o0oexnmo3iyd m2rau snu)tltomr3oa1omtrau o;t) exm(m oudam  livilt  Durump;o1tlenmoeils s em(vp (0 rxrmr ta1fpt lu s;t0 exrxm oo1lptnmies t) 2rm(m ;o1aptoiietydfsDrl(vp t4 eeoxrctotfptrlivi;(0tetoim3iydapt  fesas)sDtrxmpnu1ape  iciytfaDel(msnu)arxrxr3tytla r ieo t  2tr(m3oy4olt lfcilsfs2tmx p;u0opxn ociys s2ranms;t0tlermocoadlatr nvi;t  2xmiopnodomenmieiltf Dur(  oo1opxn f3iasls eauvs t) etoir3ta1omDeaieol( trxrxr3oodlmtelivsat)sDumxrooo4apeomoeiyt a2umn s;t4trtnmocio1om r ies;()srtrir iydlp emfcs ()aDraxronu1opto i3tytfm2em(mon(4 rtnmo oatomD au ils0srum(o3no1ol nmnvsl( aruax o;o1tlto ociysfmDel( pn() rtrif oo1fmD anei t s2urxo3oy1lpeemivta()sDtmuro;u1tee  fetltfsDumnmp u)aeenif iadoptrlivi;s)t2xr(r3oo4lmt mieias  Dua(r oo1alt mfctysfa2emnvs t0areoxf3oytfpDranvolt0t2urio io1ape lncsl()a2tmxrpoo0tpxoiietas a2ea(mo;(0tetnxf to1fmD ln s;()trtmxopny1openmicil() ruax ono1tpen o3iyt a2emumon(0 etrmfcoy1fa r u ilt trumxmpiy4amenlneia()arrmxr ;o0aee  o3tldls2rl( pnt0trxrmfcoodopD aues;s seur(r3oudamt mfesat) rur(  nt4ape iiciyslsDeau s;t0aetnif iy1oaDelu ilt0 etmxmpnodame mfcs s) 2urxr nt0aexomoeiasla2rluvp;u)aeeomr iodlat lnes t) rumxo3nodlpte nvsls) 2taxrpnu4aleo fctadls2uaumonu0alxomocootoaDeai o;t0t2urxr iu4opte ivsas)artmx o;o4teeoifeiad a eluvs (0 lenxfciotopt au s () 2xmio ou1ome liesa(faDumu pnu0optomietytlm2rm(vpn(4artnifciatfaDranvsl(0sexrim oy4ole  icta( aDua(r ;u0tltn fciytlaDea( pnt0aetrxo3ia1oate neslt) etrxr nodlpen fcsat) 2rr( oot0tetn i3iad m rlu snt0arxnir3iytlm eli i;t0s2toxrpio4lpen fviatfsDtmxr ;t1apen i3iyt s ean p t4 lxomfcoy1oa  lneols  2tr(r3oo4om e fes t arua(m nt1opx mo3iys a rl(vs;t) rtnifcty1oa eauvo;t) 2to(opoydop nmict sfarurxront4oleo ictat aDeau pnt0artoirciytoat lu o;s t2xrxopiodom  lictls) 2umurpno1opxo feiadfa2rmu p;t)altoif oytop  li i;s0 rumimpoo4alte fcsa(fartm(  no0alxnioeiasfsDelnvpn(0 ltrifcia1oat an sl(  2trimpnydam  lnvslt  2urxmpot4tee ioeild mDrmnmsn(0altrmo3ty1la rluei;(0t2trirpno4al n netlt)aDtaxr ;o1apx ii3iytfsDea( pn(4teenircoo1lmtrli s;( setm(r3nudlltemfeia( srtrumo;u0olxnmo3iasfaDrmu s;u4 ltrxo3oodom  an o ()teur(m3ny4opt  net (fa2tr( oou4aeen ictadfmDrlumo t0aeenir oy1latean s (  2xriopiu4am  lics s) Duaumont1tlx miciasfm ranms u)tlxrxo3iadop eaueols seur(rpny4aptelictasfaDrrxmoou4teen ociyt m2emnmp;(4 rtrmr3todlat li i s0setoxr iudap nlfvtl() rtmur nt1oet ioeildfaDrm( p;u)aeermociydlpDraiei;s0 rxoxm3iydllt mncia(faDtr(rp;o4aetnmieiasls ra(ms u4 ltrxrctadoaDranvo t  etmimpno1omeemnvil( srta(rpot1aleoifciydfm2rmums;t0altomr ootfa rlnvs s) rurim no1openlnetl(  2taur no1oexomietltfs2emn s t)aetrio todfpDrlues;s0tetr(r3iodlmen ieta( srum(r ;t1tpxn fcilsfmDelnms (0aexomr3oatlaDraiesls)t2triopnu1amt livtltfsDraxroot4alxomoeiytfm2emumonu)aetrmrcty1fa eln sl(0trxo(opny1llenmfvtls  rrm(rooo4aleoio3iaslaDrluvsnt)trtoif3tadopD li ols0trtr(m3oudomenmfei ( a2tmxrooo1tptnmfetys s el(vp;u)aeeoxr3iydlpDrlivs s)tetmir3nu4optemfci (f Drr( pou4altoiiciltlmDemuvs t)teeoxf totlp e nvol()trxoiopnu4lpe lictl(fa2ra(rpno4aptniociyt m emn s u0tlenxo3oydfat  u s ( texoxrpno1altn nct t arrrurp;o0tpxnmoeild aDra( s t)tlxoxocia1omteln ol( srxoir3ou1llee icilsfa2taxro;t1tpe iiciyt s ua(ms (0 etnmo3iodlpteaivsls)srxoxmpnydlpee nesltf rumump;t4ape iiciltfs2em(ms;(0tetnxr io1lptran sls0seto(m nydol nmivsls aDuaxr ou0alxnmfcils aDeauvon()areoxr3iodomD lieolt0 etrxo ny4lm emnetlt sDurxmont4apto iciad m um(mo;t0arxoir tatfatrln s;s0s2uoxm3io1lm n icslt s2trx  ot4oetoii3tld s rl(vs;t4 eermrcia1fmD ln olt trxrxmpnudamtn fcsat) 2trx o;t1openmfcils aDuanvo;u)arermr iy1fa ean s t0sexo(m ny1ll  lneil(fsrumumpoo1olt  ieiyt aDea(vs t)tetrif oatop e ueols)srtmxr3no1ll nmfctlt)a2trxmo;o0optnmoetlsfs2um(vs t0aeeoxr iadlpDe u o s0tetoxmpno1ol n fvi ( a2rauroot0olxomi3tyt m el(von(0alxoifctydfm r ieo;t0teumio3oo4omt lnvt s)a2trx  ot1tpxnif3tyd s rluvpnt0trxnxf iodfat  uvo;s0sexm(o iy4ape liet (  rum(mono1aleo ociys m2ua(mp ()tlxoif3iytfmt  uvo;t  rur(mpno1alee nctl(  2uaumont4aex  feiasfs2umnvs;(4 leoir3todfateaieilt)trxr(m3nydal emfctlt  Drrx  no4aleniictltls emu sn(0alerxfctotfatraies t)s2tmxm iydol e nesasf rtaxmonu4tpxomfcias a ea(mo t4 ltnircoatoaDeau i () rtrxmpoy1ape mnvtl( aDum(roou0apeo fcildlm rau s u0trxoxrctatomtrlneils0 etm(m3iydlpe mncs t)aDtr(rpnt1tle mociyd s rau on(0arxoxr3iadfpDeanvi s srtmxr3ny4lpe lfctlt)s2trxrp;o4tet mfciyd m2emn pnt4 lxomoctydfpD lues s0 2tmirpny1omtnmfes tfaruaum ot0tpt  o3iys a2ua(vo;(4 eeoir3oadlpt an o t) rtmxr3io4lme licsls a2rm(moot1teenifeildfsDemnmpn(0arxrxr oa1fmteaivslt  2urxr3io1ameemnvs s arta(  ;u0apxomiciltfm2eanmp (0tlxnxrciydlatraieilt0srurio3iu1op emnvi tfarrmx o;u1oet  oeiyt sDrm( pn(0teerif iodomDeauvsls) 2tr(o3nodomt  fvil( aDumu p;o4tet ii3iysfsDrln p u) eeoxr oa1laD livi s  2xrimpio4altnlfvta(fs2tmx ont1tpeoif3tldlm2eanvs (4 rxoircoadopt  u sls)srxmimpoo1ap elivtas a2ra(mo;u1aet mfeiydls elnmp t0artomo oydopD  ivo;(0trxrxm3no4amtnlncsa()a2ua(ro;t1tpe mfeiasls ra( pnu)artoxfciodopD  i o;s)sexm(rpoydomt lnvt (  rrmu o;u0aleoiiciad s ul(vsnt)texoiocty1fpDeluei s0 rtmim3io1oltemfet ( sDumu o;o0oleo feiat sDem(mo u4aexoir tydoate nesl(0 2xoxrpiydop  lnesat aDrmu  ;t1ale mo3tydls2rmnvs;t4aeeoio3iydom ranvs;t)s2tm(o3io4amtemfviat)s2rmxmpou1tetnii3tas s2eanmp () reoifcootlm  lneo s)t2xo(r nu4aptn nesa( aDtmurono0tleo oetasfa2eauvon()arerxr tydop  li i;t trxm(rpno4alenlfvi tf 2umxr nt1aetn fctlt a2elu p ()tlxrio tytfmD  ieol(0s2xoio no4om nlnvtas a2trum ;o4oex mo3tydlaDra(vp t) rtrmo oo1fm eauvils s2um(opiu1apenlnesat) rumxrpou1olto fciysfs2ranms (0altnxr3iytlpDrlu s (0 2tr(mpoy4ll emiei t  Dumx ono1tlxomo3ilsfa2eaumo;t0artnmrcoadfmD lnei;t0 etmir3oydopee fei t) rtaxmo;o0oexomo3iat sDemuvpnt4aetrircoydop r n o;t trtoio oudlp elivsat) rtr(r no0tpenmiciyd s2uau p;(4arxrmf3iadlm elu i;()seuoxr3iy1ol  lncslsfsDurxmpnt4alxnmiciydlsDea( pn(0 ltrmr oadop rlnvi;s trxoim oodll nlieta(faDtmu o;o1aeen feiys m ua( pnt4 ltnmf iy1omtr nvi (0 2tmxr3iu1apeemnvsas)a2rmur no4tpeo i3iatla2eln o;t0tltnmr oa1fat livsls)srtrir3no1om nlfvtas)a2rau p;o4oeenif3iydfa2ra(mo t)altomr3tydfp  an s ( t2tmxm3iydlmeelnvilsf 2rmu  ot1oeenif3iydlaDea(vp;(4teenmfciodlptran i (0srxriopoo4ame mfcs ()sDrr(mont1olxoiiciytlmDem( o (0tetoxo3ia1lmtr neo () 2tmxr3ou4lm nlfesatfarumxmp;u4olt moetatla emnmp (0 lxrmf3iadomte ues;t sruoxmpio1lpe lnvs ()aDta(m ou0aptn oeilslm2rmnvpnt)aetoifcoadoat luesl()tetoiopoy4oleemfetas)sDta(monu0aptoiieiasfa ra( sn() rtnifcto1fm elieilt)sexmir3nydamt mfcia(f rrrx pot0aetnifeiydla rmnvp;u)arxrirciatfp rlnei s0 rurxr oy4ale  icslsfaruaxmpou1optomiciltls umums;()teerxf tytlm rln ol( sexm(r no4ale lnetls a2ra( pno4olto oetltlm2ul(mon(0aexrmr todlaDr neilt0t2tm(opiu1aleemnci sf Durx o;t1opeoio3iasfs rmnmp;(4 lxomf3ootfa   u o t0 etmxr3oo4ale lictl(fa2urxm oo4tlxnioeilsfsDemnms t)texnxo tytfp ranvils  etmiopoy4om  lnes t a2rax ont1tet ifetat m2ua(vp ()teermo iatlm r i i ()trxrxo iu1ap elnesat) 2uau ooo0apxo ociydfa2eauvpnu0 lxrxrctatom   ueo;t  rtrxmpnu1lptn fetlsfartau  oo1aeeo fciysfaDelu p t0 lxomo3iodla  ai i;t0 etmio3nu4oltn nvt t aDrm( oou0aptniietadlaDuluvp;t4 lenioctodfmtranei () exrir iydlp emivias srtmx o;t1apx  f3iyt mDuaumo t)tetrxr to1fpD lieils)sexmxo3ou1om n ictatf 2rau  ;o1apx mfcilt m2emuvo;u)arenir3oydlptr nvo;t0truoxr3ou1lmeelivtas  rrr( oou0alenmieiys m elnms t0texoio3oy1latrlieolt0seuoxrpiy4olte nei s)sDrrurpnu0tlx mocias m2uluvs u)texrmfcoo1lm raueo t  rtrxmpoy1op n ivtls srurx o;u4tpe miciyslm rmn o;t0 ltrmr io1faD  i ilt  euo(o3ou1lltn nes tfsDtmxrpou1oeenif3tyt sDrlums u) ltnifciy1optran i t0s2umimpou4olte netlt) Dtrxro;t1alx io3iatfs rmumsnu4 etrmocoatlmtelnvi ()setmir3nu4alenmfet sf rrr(mo;u0oeeomietat aDulump (0aeeoif ta1lmtelu o;t  rtr(r3ny4ol  lfeilt  Duaxmp;o4tetomiciytls rmu pnu)trtomf iydfatrauvil( texmio iudlm e ivtat  2rm(mono1aetn ietydfa ul(ms;(0 ltoxr3tatfp eanvs t)t2xm(rpoo4olt lieilsfaDtau ono1tpxo i3iatfmDranvp t0 exomf3oa1la rluei s setrxmpiy1al n nvil(fa2taur nu1apt  ieiadlm2eaums u0tetoxrciotomteanei s)tetrir3io1amtnmnvsat s2trx oou4oeto fciadfaDrau p;t)altoxr3oy1lmD  uvi;( texoiopnodop n fvtltf Dtr(mo;o0aptomocilt s2eln on(0 exrxo3ootoate ieslt0s2xrim iydlpt  ncsls  Draurono4aetnioeias a ra(mp (4aetnir3iydfp eau o s) 2to(o no4opt  ict s sDur( o;u4alx  oetltlm eluvp u) lxoio tadlmt  ues s0 exriopno4amt  fcsat  2trx poo1open i3iytfa rl( s;(0texnxr iotla  ln ols)trxoxo3no1am n feil( a2urxmpno1aptnii3tys mDul(mo u) etnif tatfmtrauvolt) eumim iu4opee fvi s sDtrurpot0olt moeiytfmDrm(mpn(0arerxo oydoptr ivo s0sexo(mpiu1optelieiat  Dtmu pot1oexnmocils aDeluvs;t0tleoif3oatfptrauvsl(0truoio oodol  mics t  ruaxmonu0altnmoetldfs2el(vsnt0aexoiocia1fm rlivo;s seuoxopny4alenmietl()artaumonu1altoii3iatla2emn o t)tltrxocta1op  auvi t)truoxopiudam   ncilsfs2ururo;u0teeo ieiatlm2umnvp u)trxnio3iy1lp e neolt0sexr(r3nodlptnmnvtlsfsrrrumo;u1apxnmoeiatfs2rmnvp;()arxoiocta1fmt lieilt s2xmxm nydalt mnvia() 2tr( o;o1oleoio3ils a ra( sn(4 rtrxo oytla rauesls0t2toxm3oo4amte nesa(fsrrmxmp;o4alt mfciltla2uanvo;t4 rxrxf3ia1oa e i il( texm(r iudoltnmici t)aDurxm nu1texn fciadfmDrl(mp;t0texnmf oydoatrlu ol( s2xr(m3nydllee iet ()sDrr(rpoo0olen iciadfsDuluvon(0 ltnif3oytlm elnes;()setoxrpno1lpeemnvslsfa2ua(rooo0aeeoio3tldlsDemn p t4trxoif3oodlmDeaieolt trtm(r3oodlp   feia( a2tm(r ou1olxomo3tlsfs em(vsn(4trxnmoctytop rluvo;t texoiopoodlm emncta( srtaurono1teen ociad a2elnms u)tlxrifcoodla  lnvi ()trumimpiudoptnlfes sfs2uaxront4opto iciysla rmnvs;u)tlenmf ta1fmDranvs;t truoxmpiy4apee fetls) rrmurpnu0ope  feildfaDrln p;u0 etnmociotlp  ln s;s)s2xo(opnu4lptn net s a2urumo;u0apt  f3iad s umn s;u4arxomr3totomDrluvs t setm(opou1ll   ict () rrmurpno1apto feiytlmDemums;u4 lxoxr3oydlm  lueo s  rumxmpno4lltemicsas)sDur(mp;o4optomi3tyd sDrauvont) rxnircta1fat lu ol(0setmxmpio1amt lfcsas)aDurxmoot4tpx ioeiytfsDulnvs t0arxrir ty1laD  n olt0seum(rpiy1ll nlneiasf 2ta(  no1tptomo3iatls rm(vs;(0trerxf3todlpDrauvilt0srtm(m3nu4lle lnei (  Dur(mpou4oeenmf3ildfa rm(vs u4alxoxf3oatfpt  ivols)s2umir3io1op e nvtlsf Draxmpnt0tltn ociat a2rln o t4teeoir oa1lp   i i s seurim oo4lmtn iesatf 2uaxmo;u4ole ioeiydlmDranvsnt4treoir oytfp  lnei;()t2um(o nudaptn fcsltf 2tr(root4tltn fetyd m rlnmo ()tleoxfciydomDrluvols)tetr(r iy4ol nmfvsl()artm(  nu4alxomf3iadfa2rl(vs (0treomfcoytlat auvo;s)t2ur(m3nodal nlietlsfa2tmu  ;u1oetnmoctyt mDul(vp t)alxnmo3oo1latrlnesls)srxmimpoudapenlnesatf Dtm(ro;t4tlenifeiasfs el( pnt4aleomoctatfaD lu i;t tetm(m3iu1llen fvtlsfs2rr(rpno1alt  ietasla2eauvs;t4 lxoirctodomDeauesls trumxm3io1amtnlnet t) 2tmur oo0olenmictatlm2rlu s;(0artoxf oatlptr i sls) ruoxo3nu1llenmfctlsfs2taxrp;o4alx mi3iat mDemnvo t)artrxfcoatlat aiei;s setoir iydlltn ics ()sDum( pno1tpx mi3ias s2rlnmo t0 ltnmoctatlpte neil(0 eur(m3oy1optn ictl(fsrtrump;u1olxnmictld sDeln s;t4teermrcto1oat ln o;s0srtoim3iy1oleemnvsat s2ua(mpnt0aee mi3tyt mDulums u0 etrmf iydlmD li ilt0 2trim iy4apt lieils)aDua(ronu1aetniieiyt aDeanvs;(4trtnir tadoaDeanvi s trtr(r3no1op nmiet ()s2trump;t4tltn o3tldfmDranvs u) etnxfctytfpD  uvs s) rtmir3iu4lpe miesas sDrru poo0aee mf3tysfm uln sn(0alxomrctatfpD li s t  rumxmpnu4ap nmfvi t) rrrx pot1texnmicilsfmDelu o (0tetnir tatlatrlues t  2toxopiy4lpeemfvi t)a2umur ;o0oexnmfcias a2eanvo t0alenmrcoodlm   u s;t  2tmimpoy1lleelnvt s)sDuau  oo1ole mociatlaDel(mont4texnmf3ia1la eaivslt) 2trxr iu4llt lnetlt)aDua(mp;o0apxnmiciasfa ulu o;t)aetoifctadoatr n i s setmim ou1op nmnci (faDtm(  ;u4aeto ocildfsDem(mo;t4tlenio ia1fmD  ivo;s)s2trxmpny4open ies t)a2tmu oou4opxo ieiydfaDuauvs;t4 ltomf3oa1fmDelnes;(0s2tmxo3iodlmt lnct sfa2rmu pnu1aex moeilt sDua(mp t4 ltnmo3iodfmDrlu ils)seumimpoy4omeemnvia(fa2trumont0aex  ieiltfs2emn o;t) rtnxfctotfaDraivs t0 eum(r nu1ale  icilt)a2ur( ont4alt  ietlslm rmn snu)trerxociatfpDelivi ()trxrir no4ap nlici sfsDtrurooo1alx miciatlm2um( s (0texomo3oytlateaueo t t2uoiopoudomeemnci tf Drru pnt0olen fctytlmDem(mon(4aeerxf3oadoa e nes ( s2urim3ou4omee ictat  2raurpot1tet  i3tytfm2ua( sn(4alxomrctatoatelu o;() rxoxrpiy1opeelfvsa(faDrm(mo;t0alx mfetas sDeauvs (0trenmo tydfa  aneo;t t2xmxopiu4oltemiesltfartrx onu4oltn fciys m2umu s;u0aexrmfctatfaDeln i;s)teum(o3no1llte ivsasf Draxrpnu0altnmi3tlt a2rmnms u4 etnxrctadopteanvils  2uoim3oodaltelfvs t a2ta(mont0tpx  iciasfs2ra(mpnu)aleoxrciadlptrau s ()t2urio3oy4oleemnes tf rtmxronu0alxnioctydla2eauvo;u4tlxoir oodfaDe n i;s0 exrxo io1amtnmncs tfs2ur( ono1apt mi3iysls eanms (0 lxnifcoytfat an olt t2tm(opio4lpee fetasfs2tax pou0opxn oeilsfa2ean snt4 rxnxr to1fatelivo ()seumxopoo1olen fvt ( srrmx poo4olxnmfciytls umuvsn() exnir tadla eaieo;()srtrxo3iy1lpenmneslt) rumxront0aexomi3ilt a2umnmpnu0tetnxfcoy1fm e ueilt  exm(mpoo1aptemies s)s2rr(root4aexn i3tatfm2rauvo t4alermo3ia1fpD aies;(0 2uo(mpio4lmt  netlt)arumxr ou1olt moetltfs ranmo;t4tleomo3oytlaD aivi;s trxm(o iu4ol  mnvsatfartmxm ot4alt  oeiltfs rm(vo;(0aeerxf3oa1fat au s;t s2tmxr3nu4olte ictas)srta(m no4apxn o3tydfsDraumo;t) eenxr3ia1lp eanei ( trtmxrpnodam e ieia()sDraxmo;t4teen iciadlsDuanmp;(4altoir iydfpte uvs (0 eurir3oydom  mivt t  Dtmumo;t4oltnmfetys a2rmump;()aetnxr3oadlmt an s;( t2trim ny1lpenlieilt srtmxmpot0altniociydfaDum(ms t0 lxnio3iotfp e n i;s)sexmxopiu4op nlivs t)a2tau pno0aetn oetytls rauvs t4aeenxr3oydfmDr u i;t0texr(o3no1lpeeliesatf 2uru p;t4oltomociltla rm(vp;u4 eermo3oa1lpDe i i s0srxr(r3nodolenmivtl( srtax oot4alto iciadfs ra( p t0 etnif oo1faDrliei s teurxmpiy4llee ici ()a2urxmono4altn ietys m2uaumo;u) rxnmo3oytomtr uvols)sexrxmpiu1amt mnvsat)aDrmxmooo1tetnif3iadfa2rluvo u4teerxo3oatoa r ueo;t)srxoxopio1ap n fcta(  Drmu  nu1olt ioeias m2eln p;u4alxoirciatfpt  uvo;s  rurxmpiy1lptnliesl( aDtr(m ;o4altnmi3iadlaDra(vo;u)altomr io1lmD  ues;s0srxmxm iy4op e nct sfs2taump;o0apxn ictltfm uluvp u0aetrmf3oa1fpte i slt0 2trxopoo1al nlivsl( sDrrur ;u1tee  i3iasls2umuvp;t4 rxrmf ia1fp e ivo;(0sexmim3io1open ivils)s2tax o;u1openiociys aDelumo u4artoxfcoytomDe ivolt) exmir nodomtelieil() 2rm( oot1tle ifetad m2ulu pn()aexoio3ia1opte i i s) rtoio3oy4ap elnei s)artmurp;t0oexnii3tltfmDrm(mpnt) eenxf3oydlpDr n s s seto(rpoy1ameelfciatf rrrx pno1oexn oetlsfm emnvp u4artrxo tytopDe uvi;t tetm(mpiudaleelfetls)srumumo;u1opxomietas a rm(vo;(4alenmo iodlmtranvil(0trxoxo3iu4lme mfct ()aDra(ro;o1olenmieiasla el( s (0texnmr tydomDe u s (0 etm(r oo4omenmnct s)sDtm(r nt1aleo ietadfaDulu o u)teeoir iadoaD luei s0srxrim iu1lp   nes tfs2ur(  ;t0texomo3iaslsDua(vs (0alxoifciodopte ies ( trtr(r3oudameemfctls) rra(mpno4altn feiad m rmumo;u0trxomrciatlmDe ivslt)s2umxo3ny1om e ivs s) rurumo;u4olx ioeild m emuvont4tltrif iodomt ai ilt)sruo(mpno1oltnlfes (fsDtau ooo1ole mo3tlsfm eau on(0arxomfcta1fmt lneols t2xo(m3io1altnmncsls  Drr(  ot4aeen o3tas sDelump;t4 exoxo oa1laDr iei;s trurxrpiu1lmte ivi s)aDuaxmp;u4olxnmicias a2uanmo;t)trxrir iatlpte u o;t)t2xo(m iu1lle mfesl()sruaumonu0ope miciltfa2eluvs;t0 leoxfcoodoaD  uvo;(0texr(r3ou4lp emicsl(fs2uaur ou1optn ociad aDuaumont0alxrxr iotlpD  i olt)trtmio iu4am  mnvsatfsrtmumpoo4tpxoioeias a ra( pn(0 eeriociatlmte uvi;t  2tr(r3nydlp  mfcsas srra(  nu1oltoif3ias m2ra( snt) etnmr3oytopDean i;t0t2umir3oo1lm n fvil(farua(moou4tlx mf3iatfs elnms;t0trtoxf3tytla e iei ()sexmio oudap  lnvsa( sDtmx o;t1openifeiys aDumnvpnt0aeeomo3iotfa  luvs t)seum(r oy4olt miesa() rurumo;o4aleoiociltls2umnmp () ltrio3iodomD lnvilt  rum(m3iodlpenlnci tf Dtax  nt0optn icildlaDel(ms ()tlxoxf3oadfptr ivs;s)sruoim nodlme  fvia( s2trurpot0tlt if3iydfa emuvo;t0alxnircty1fpteaueo s texrxmpnu1op nlncia()arrmx  ;t1apt  ocilsla2ul( o;() lenxf3ootlpDeai ols0trtmir3io4amt mnvi s  rtmxmono0olenmf3iys sDumnms ()trtrmo tydomDeli s s)setoxrpiu1ap n feiasfaDururoou4alxoiocild aDeanms;(4tltoxocoadop rlu s;s  exrxr3iy1lp n ivilsf rtaurpot4tptoio3ils m ra(msnu)alxoxr tydfpDe neo;s0 2xoir3nu1llenlfetlt)arrr(r ;o0texnmietydfs2ean o t0arenxf totlp  lnvs t0teum(m3iy4lme mnvta(fs2uaump;u4aetn o3iyslm2ean s (0aexnxo iatlm   n s t seuo(r3oo4lltemnvilsfsDum(mpno1ole moetatfaDumn o (0trxoxf iotfaDrlivo t) 2xrirpny1lp  mfvta() Dta(  oo4tee mieiatfs2rlu p;(0tetrxfctadla  aues s0sexrxrpiydlptelieta(fsDurumonu1tpt moeiys mDua(vs ()alxnxfcto1fpDe i s;t0t2urio3nu1omte nes t)sDtrump;u0tee iiciyd aDeanvo u)aexnxr todomtranvs s0 2urir oy1lpeelfvtls)aDumuront1aexo fctatla umu pn(0arxnir oydlate iei ()texrxm oo1openlnvs t sDraumooo4aptomocild a2rmnvpnt) lxrmo3tytlp e uvs;() etm(o ny4olen nct ( artr( o;o4oeeoio3tydlmDuaumo;(0 rtrir ta1omDrai ilt0s2xmimpou4opt lfcta(f rtaumpou0aee  o3tysfs2rm(ms t)trtomf3iodlpD aies s sexo(rpoy4llte fvsl( aDrmxrpoo1olt  o3tatlm umums;(4alenmr3iotoa  aueolt0t2xoio3oy1olte ncias)s2ra(r no4apto oeiytlaDuan p;t4arxoir3iadoatr iei;(0seuoimpou4apeemietas s2raurpou4aptoioetytfa2em(vsnt4 lxrxfctodla elu ils)sruoiopny4ameemnvtas sDtau o;o1apxoif3iadlmDuluvont4 rxnxociadopt lu o s) rurxo3iydopen iet ()arrmx  nu4alxo feias a elumon(0aeenmr3oatfp eauei;t0setmimpoo1lm emfcs s) Dtrx pou1oexomfciadlm ra(ms u0tlxnmr ia1fp   iei;t t2urio ou1al  mivtltfsrra(  ou1texnmfctatfm2el(mo;t) etnif3iatlm  luvs;t)srtoim ou4op emieia(faDum(r ;u0ale mo3tltfm ran s u0tltoxrcoodom r ieil(  2tm(opio4lpte ictas aDta(  nu1alx miciaslmDul(vsn(4altnmo iodopt luvil(0 etoir3ou1altnliet s sDrmu  ou1oeeomf3ildlsDumu o;u0texnxf ty1lmDrli ilt)teurxmpiy1lp e netl(fs2tax oot0aleo ietlsfmDra(msnt0 lenir iy1opDe ivo;s0s2tmim ou1lm n ivtatfsrumxmono4tle ii3iatfa2elnvont4tltoiociydoatrln ols)s2xoxopiodlmeelnvia()aDrrurpoo1texo oeiysfa2ulnms;u)trenxf3tatomtrliei;( s2umirpno1olenmiei (f rum( p;o4aetn fcilt m elnmo (0 ltrmrctatfmte ies;(0trumim no4lp  lnctas srrr(root1aetnio3tydla2ea( p;()aetoxfcoo1omD  i i s) eur(r3no1olenmnvs t) 2rr(root4tptoioeiadfa2rau pnt) rtoxr ootomte ivilt texm(opou4ol emnvils srtm(r ot4aet  fetydlmDemumo u4altnxo oy1fmtrau i;s  etm(r3oo4llen ivtasfs2raurono4aetn ociatlmDumnvsnu4aleomf tatomt  nvolt0 rumio3nudlleelnesltf 2uru  nu4oleomo3ilt s el(vs t)aexrxr todlm eln ol() etoio nu4al e nvsl() Drm(m nt1oleo f3tytlmDul( s;()artnir iotoptr neo () 2umxr ny4lpt mnvi s sDur(r no4tpxoio3ils s ean o;u4artrmf oo1oateanvi s  2xoim ny4altnmnci t)arrmxr nt4olt io3iaslm uan pnt) ltrxfctodoateanvil(0 rum(r oy1lmtemfct (f 2umur nu4aexnif3tasfm2eluvsnt0altnmrcoo1oatrlieo;t) 2trxmpoo1apenlfct ( srur(roou0apto feiad a2el(msnt) rxnirctytlat  neo (0srumxr3ny4lmtemfvsas) rumuront1oexniociltfm elnmo;t4tetnxocoydlpDrlnes t srumimpou1lpe mfvt tf rtau pnu0opxnmi3ilt m rlumpn(0 ltoif3iadlmD luvilt0srtrxrpio4oltnlnvsltfarum(ro;o4tlxnmocilt m2emnmp;t4artnxr3tytlpDrai o s0 2xo(r nu1ale lieta()arurur nu1tetoifciydfs umnvp;t0altrxo oadlpteau ols0tetr(o oodamtelfvtat srrm(m ;o4olenmfetyt m2uanvo;(0 ltrxo ty1op r i il(  2xoimpou4ameelfci (  Dtmu ooo1aleomi3iys mDuln pnt0 etnmr oydoatranvi (0 2uoxm oodapeelies tf Dtrumpou4teeniieiyd a ua(mp;t0trtrxf3tadfpD aivi;()s2umxr iodlle  ncilsf Dtax ont4ale mietlt a ra(vpnt4aeenmrcoo1opt  u s (0 2xmiopiu1ome mfvs t s2tmx  ;t0tlen o3tyt sDrm(vs;u4alermo3oy1optran olt0s2urimpoy4ame  fvsltfs2rrump;t1tpxnio3tydlm elnms;()tltoxr tytfaD anei;(0 exrirpiu4apenmfctls) Dtax p;u1alenmoctadfm2rm(vsnu0 lxnxf oodfat anes (0 2xmxm3no1lle mivsatfa2tau o;o4tpe ifctlt a2rln o;t0trxnir to1omD lueils)t2tmim3iy1ole  fcsltf 2ur( pou0tltn fcildlmDra(vo u4teerxo3iytop r i o;t)sexrxrpny1ol emfvtasf 2rrxmooo4opeoio3iysfaDrmumo u)altrxfctodla  lu slt seto(opiu4lltnlneslt  2rr( o;u4tpxoiicildfm ulnms;u4trxnifcoydoaD livo s s2trio nodopen iet s)aDrr(mo;u1apt mfeiatlm ul(vp t0alxoxfcio1la rluvslt0trxmiopoydolte fci t)a2umu ont0aleoifetasfs rmuvp (0tltrmo ta1lpD  iesls trumxr3oodaptnlfcils  rraumono0oee mfctys mDrlu s t0teerxf to1fpDrliei;(  rtmiopnu1openlnvt sfsDrrxmooo0aet  f3ild s ra(ms u0alxrio iydomDelieils0 etmio3iodapt  ieilt a2ta(  ;t0aeen fcilt a2rl( o;()aexnifcoydlmDr nei;s trtrio oo1lm nmietls a2tr( oou1tltoii3iytfmDemuvo (0alermf3tatlpDrlieols) 2tr(m3ny1ome mncsatfaDtaum ;t4opxn o3iad a rm(msnt) exoifcoadlmtelivs;(0setmimpiu1op nlnes t)aDum(mpoo1oeen f3taslmDuanms t0alenio tydlp e i s;s)s2urim3ou1ap emfcs tf 2uaum ;u4texnmietldfa2emu sn(4tltnmr3oytoa e i ilt)srxmio3iy1lp n nctl(  rrmurono0alxoiictad m rl(vp t) ltoxrctydoatr ueolt0 2um(mpno4ol nlivtas s2rmx pnt0ole  iciyslm2rln snu0artoifcta1lmtran olt)trtmxm3ou1amenlfeta(f Dtaumo;t0tlx  o3iatfmDemuvo t0teeoxfciy1latraieo t0 2xm(m oy1openmneils)sDtaxmpno0aetnmoeiltla rlnmsn(0areoio iydfmtelueolt0setoir nudom  lnesas a2um( p;u0tlt iietyslm uan pnt0 ltomr3oodfp rlieil()srxrxr no4amtnmnvia()s2ta(mono1texoiictydlm ul(mpn(0 rtnifctatoaDr ivs t)sexrim oy4aleelnes sfa2uaxr ou0tleoifeiyslmDelnmo u0tlxrxfciodomtrlneo ( t2tm(opio4oltnmfes ()srtr(rono4ole iieiatlsDemnvonu) eenxf3iotlmt  uvs;s)setm(m io1olee fes s)sruaxmpnu1texo o3iltls umn snt)tlxrxo3to1opDeanesls s2um(rpou4lme micia()aDtmx ont4teeomiciyd sDuanmo;(4aetnxf3oa1lpDeau i;(0s2toimpou1om elnvils  2tr(  nt0tptnif3iysla uaump;t)artoio3tatfm elues t0trtoir nu1ame  ivs t)arrax  nt4tpt iiciyt a elu pn()tlxoifciodopt lneslt0s2toxr io4ol  mfcs () 2rr(r ;t0tlen f3tytfs ua(msnu0aetoxf3tatlmte neol(0 2tm(m ou1apeelfeiasf 2rax ont0tltomociadlaDel(mo t4trenirciytoa  luvolt0 2ur(rpno4am  mncsasfsDraumpnt0opto o3iadlaDemuvpnt4treomfcoy1oaD auvol( teto(rpiu4al n ieta(faDrmxmont1ale  oetad sDuanmont) rtoxoctydfaD livi t) rtmio ou1lleemici s)aDraumo;t0tlx  oetydfaDrmuvp t4aexrxf iy1fmtr ues ( s2toxm oo1alenmncils)s2umxm ;o0opx ioeiad a elnms (0aeeoxr3tytfp elu o;s)s2tr(o3nydome  fvil()sDrru o;o0aeeo feildlm rau s (0trerxr3oo1fmD anvs;(0 exr(m nudom  liet t)aDuaxr oo0tpto ocias a2el(vsnu) eenxr to1lmDe ivo ( t2xo(o3no4amtnlfeslt)aDur( oot0aet  i3iydls2eln s t4teerxoctodoaD  u ol()s2tmimpio4lmte nvia(fs2tax  ou4ole mfetydla2umump;t4tetnmr3io1faDe u o;s0trtrxrpiu4om   neia(fsrtru ont1aeeo o3iyt a ra(vp u0trenmf3oodoaDrauei ()texrxr3oudlmenlnvi (  rrau pot1tpxomoeildlm2uln o u4 etrio oa1omDrlu sls0texoxo oy1lp  mivsat) Dtau  ;u1tlxomoctas sDulump;u0teeniocoy1laDrluvi s trumim oo1ll  lncta(fsDtrurp;u1tptnioeiysfs2eau p (4tetomo3oadlp r ueolt  eur(m nudam nmfei tfsrurxmo;u0oeeniiciasfaDrmnmpnt) ltomr ty1omD luvs t0teum(r3oy4lmte ivias  rtm( ooo1apen feilt a rl(vs t0 lxoiocoy1opD  ivs (  rxm(r3nudameelictl(f 2ua(ronu4optnmfeiadfm2el( on(4trtnir tytfatr u slt0 etoxrpou4alenmfvsl(f rum(monu4tpe mictadfm2ua(vs;u4 rtrio iy1fptr u o t)srxmio3oudale mnvtasfarua( onu1opxoiictad aDean pnt0 exoxocio1laDrln i (0 exo(opno4alteliesas a2trx o;u4ole  oeiasfs2el( s;t4trtomf ootoaDelu i ()t2uoim3iu4lmtn ietlt)sDumu pnu4teeomfctydfsDum(vpnu0artrxo oatfm r uesls) 2to(opou4op  liei t  Drau poo1aexo fctlsla2em( o;(0aetnmo3tytoa raieslt t2umxm3oy1ale  fvils) rrauro;u1tlx micilsfs2eaumsnt0teenif3tatlp elivi;(0 rxm(mpiodame lfvt sfsrta(mo;u0tlxoii3iad sDulnmp t4alxrxr oodlpte u i s  euoio oo1ope mics tf Drax poo4opx iieiltfm eaump (0 leoio3iodfpt anvslt0tetmirpoy4omtnmnvsl(  Durum ;u0alt ioeilt s2em(vp (0aeeomfcto1fmD li i t  2tmim3nodlm elnciatfa2tmuro;t4aeen f3iytlm uaums u4tlenircty1optr ivo;( s2trim oodllte nvsas aDumxmpot4oee ii3tltlsDemnvonu4treomo oa1fatrlivs t)s2xrirpno1lmee netl( aDumu  nu1oet iieiadla2eauvp ()tltrmrcta1faDeanvi;t  euo(m nudlpe liesatfa2tru  ;u1oee io3ildfaDeaumpnu4tlxoxfcootfa ranei;t)teto(r oy4olte ict t srtr(  ;o4texnioetadla2umu snt4tlxrxf3tytla  luvils t2toxopiodlm elnviat artaum ;o4aetoiieilslaDel(vo;t4arermo oytla   nvi;t trtrio io1llt lfet s sDra(mpnt1optnifeiysfm2emn s (4 eenirciodlat  ivo;s)t2tmio oy1ome mieilt) rtm(mpnt1alx  ociytlsDrlnmsnu4alxnmfciodlpDe uvo;(0tetrim3iodapt  icsat  Dtr(mpnu4olen fciydlaDeanvp (4texnif oydlatraivsls0sexo(mpou4lltemfei s)sDraurpno4aexo oeild m2em(vo u4trxniocoadlate u i;t)sexmimpoodaltemivslt  Dra( p;o1opeomicilslaDelums t0 etnmocoy1fa rli s t0 eumxr3nu1ll emieias s2ur( o;u1aptniiciysfmDemu p;u4aeeomrcootfaDr nvi t  rxmxm oodll elicsat  2ua(rooo0tex ii3iadlm2uanmsnu)treoioctadlpD aivs ( seumio ny1lmte fcsas)s2rm(rpoo1alt ioetldfaDuluvpnu4teeomr3iytomte uei t0 etr(rpoudomtnmncslsf Drr(  no0oetnifciys a2ulnvpn(4 ltoir iydlp  lnes;s0s2to(opoudapt mictasfaDta(mpnt1aptoifcilsls eanvs;u)artrmo tadop elieil()s2urxr3iodlpeemfctl( s2rrxronu4aeenmf3iad m emu pn(4 lxomo iodla  lnvsl(0 rurir iy4alee ivils artrxrono1aee  oetld a2elnmo;()aleoxf3ia1lm r ieslt  2xmim3no1amtn fcsltf rrr(mo;u0aet ioetysfaDra( s;t4tlxnif ta1opt aueils teur(m iy4ap e iesltf 2rm(m ;o0tlxo o3iaslsDeanvpn(0trtnxf oo1lm  li slt0teum(mpnudalen iesatfaDuaur ;t0teto i3tytfm emuvp u4altnxfcto1lpD lueo t sexrxo iy1lpt lieta()a2tmuroou4aetomi3iytla elump;()arxrxrciadopDrlies;s  2toimpoydlm nlnvil( aDra(mono1tltomfciys s2em( o;u)texomrcoytoat lieo;(0 etm(mpnodamee ivta()srraxr ou0tpto icilsfs elnmp u4alxniocto1opDr u s;t) exmirpiy1lmtnmnvs tfaDra(ronu0oeto ictatla rln s;u)texnmocio1oaD  uvs;()truo(opoy4lm e nciat a2tmxmpot4aeeo icild m ulu s t4trtoxfcio1optr u ilt0t2uoio ou4ale lfesat) rtrx  oo0tptnifeiyslmDulnvs;(0 ltnxf3iodopt aiei;t srxrxm3nodoleelietls  Dtrxmp;o4tex mo3iltfa2el( s u4alxniocio1oat aivi;t)seur(mpno4lm  lnvsl(faDrrxr nu0opxo i3tysla2ranmo u) exoxfciotlatraueo t)trtoio3oy4lp emnetatfa2urxr ;o4tltnmiciytfs rlu pnt)trxrxfcta1om  ai sls0trtr(m iu4amenmnei tf rrmx pno0apxnioctltla ea(vs u0 renmo3iy1fptrlivi;t) 2xriopno1lmt mnetas arrrxm oo4tlen iciasfs2uaump t0 exnxr3ootoa elies;s t2urxm oy1omtn ics ( aDtru ont4olx  f3iltlaDea(vsnu0areoxf3iytfp rlnvol(  etm(o3iudapee iviat)srumu ont0opto fciyt s uanmsnu4aeerxr3oodlpD  ueo (0srxm(r3oudom elfei (  rtmxmo;o0oexnmfeilt mDean p;(4alxoif totoaDeauvi s srtr(mpoudamt mieiat arra(m nu4open oetyslm ra( pnt)trtomf iy1fateanvs t0 euo(r iu4lptn fcsatf Dtr(r ot4tleoiiciydls rm(vonu)texomr3tydfp e ueslt seurxmpoydame lics t s2ua(mp;t4oeeomfeiyslsDum(vo;t)alxrxf ta1fm eau slt)trto(mpnudamt lncsasfaDuax pno0altn ieiysls rl( ont)teenmoctodfp rlu s;t s2xr(m iydop nmivsat  Dururonu4tpeoii3tadla2rlump;u)trxoio3iadfptr uei s  2urir ou1lltnmivs s a2umxrpoo4aleoiociyslmDulump u0aetnmocoa1omt ln i;(  2urir3io1am elivsl()srrrxrpou4opt mfetldlm emuvpnt) ltomo tytla  aiei;t  rxo(r oodam n fvs ()sDrm(rp;o0ole moctatla uaumo;(4texnxfctotom  au o t0 rumir3iodamt  nvsas) Dumurp;o1altnmoeiysfm2rmnms u0 exnxrctodfm r uvs ()trtrxm3nodalenmietlsfsDuax o;o1oltn i3iydfaDrmnvon(0 lxrxfctadlmD  uvil(  2xo(r3nodape  nciat sDrmxmpoo1tee  feild m rmu p;t4alxnmf3iodomteaiei (0 exoir3iu4lmen ietlt  2rm( pnt1tpxoif3iltfmDuauvpnt0altrxfctydlm eaneol(0 2xoxm3io1olt lnvsat)aruru  nt4tlx mo3ildlaDrlnvp u) lxrif oydfpDrlu sls)s2to(r oydalteliesls sDtrx poo4teeoifctatfmDem(vo;u4aexnmr iotlat  ivo;( t2xrirpnu4lmte nes ( sDtmur ou4tle mfciatlmDrl(vpnu4tetomociytlmte uvsls0trumir iy4lle  nesls a2tmxmooo4tet  o3tydfm2um( ont)tlenxf3oa1faD lu s s0s2uoimpiodomen nvs t)sDrr(  no1aetoif3tls m rln onu4texoir totfpD lnvol( srumxmpoydal n fvil(  2tm(m no1aeenioctadfm2rl(vo t0tetrmo3ty1fptrlnvo;() rurim iy4apen fetlsfa2rrum nt4aptn feiytlmDul(mo;t4aeerxf ia1lpD an s () rxoxr3no4ap nlfct ()s2rax pot0oex iicildfm2eanvpnu) ltomoctotfpteauvols) rxrxo nudam   fct tfs2urxr ;u0altniocilsls uln o;t4texnircootlmD anvs;s0 rtriopio4amenmivs (fs2ra(mp;t4olt mo3tltfsDea(mp;u) lxrxf3oydfm rau s;(  rum(rpio4am nlict ( a2tmxro;u4texnmiciatfa2eanmp (0tltrxr oadfm rln i t0teto(rpio1opt  neil()aDtmurpot1opx ioeiadfsDem(vp ()aetnxr oo1oa e iei;t) 2urir3oodolt  feil( srurxr ;o0aex io3ildfsDeanms;u4tetnio totomte neo;t0sexm(m3oodlm   nvt sf rrmurpnt1oee mictldls2ulnmo;(4teeomrciodfptrau i t0 rtmirpiy1apeelicia(faDta(  nu4aet mo3tatla2em(mp;u0 etrio oadfmDrlnvi (0srtmir ny4op  lfvtat) Drr( pnu1opt mieiaslm2rmums t)trtnmrcoadfmDe uei s0seurxm3ny1omt  ivslt  2ua(m ;u0oltoifctysfm2rlnms (4tetrmf3tytoaDr nvs t)seumio3ny4lle mnei t aruaxrp;u0alxnmieils m rlnmpnt4trtoir3oo1lat anvols0tetmir iydop  mfeilt  rtm(r ;t0texo icild m ulums;t0texnirctydom e uvi;(0sexrxopiu4alee ncsls s2tr(ro;t0alt mieiysfaDeanmpn()trtnmf3iodlatelu i;t0 euoxopou1optelncsa(  rraxmpnt4ope ifctysfs elnvpnu0areoxo3oy1oaDr uvi;s0s2tr(o io1omee ies t) 2ta(rpou4opt io3iltfmDumuvsn(4alxomfcoydfaDe u s t)trxmxrpiy4olte nvsls)a2raxmpnt4opeomi3iat sDemnmp u4aleomf3ootlmDr i o;s trtoiopno1lme mfctasfaDurxr ;t0opeomoctys m2eau p (0aexrxoctytfptraneilt0 rxmir3nydomeemnet s)s2tax  nu1ole moeiltlmDeaump;(0aeeomrcootlp r n i;t t2xr(o3iu1lme  ivtl( aDum(moot0oexnmocilsfm2umu s t0 lenxfctotomt liei;(0t2trxr3ou4lpenmfci ( s2rrxr nt4oex  ociadlm ranmo;(4tltrxf3oo1omDelues;() rurio ou1omt  fvsa( arrau onu0aetoiicilt m ea(ms;(4 exnif3tytop rlneol(0 euoxr no4lmeelnciatf 2tmu ooo4tlxoifciatfs2ulu p (4 rtoxocootopDeaiesl(0s2uoxmpiydlmenmfvt ()aDraumpnu1tpe  feilt a2eluvs;() renxo oa1oa rau il( t2toxo3iudoptemfvsasfarrm(mo;o4teeo f3iytls2ul(mp (0teenif3iydfpD livo t  etoir oodll nlnci s sDtau pot0apx  ietldfmDuanvsn(0artrircoydla e uvo;s) rumxo iu1lltn nvs s)s2urum oo4texo i3iadla2rl(ms;u4 etoxr3oytfmt  ivs;t t2xmirpny4altelfcsls)a2raum nt1tltnii3iatlaDrmuvo u4 ltomo oadoat lu s s  rtr(m3ou4om nlfctl() Dtmump;u0tpe mfciyslm umumo u0aeenxr oa1oaD lneolt0s2trxmpno1ol   ivsatfaDrrxmooo4apen ociyd mDuanvs t4 exnir3oadfa  lneo s0trxoxo nu4olenmfvs t  2uauro;u4tpx  o3tat aDem(vo;t0texnir iytlm  aieil() ruo(r iudlmeemfet ()arum(ro;u0olxnifciat a el(mo;t0aexnmfcto1lmteli i t) 2trirpnudll emivtatfsrtaum oo1altomf3iydlm2rlnmo (4treoif tytfptelueols)s2umxmpoo1ome mieta(fsDrax  ot4altnmo3iat s2umnmsnu0tetrir tytoateluvi ( texmxr3nydomt  ivil( artmumpno0alenmoetytfs2ua(mo (0alxoifcty1opDeaues;t0setm(o iy1om   ivsa() rtmxm ;u1texoifeiadls2rauvpnu) lerxfciodoat lues s srtr(m3oydam  lnvsasfa2ur(rono4tlxn ieiadfa2emn s;(0tetomoctadfpDrln ols0s2xo(o oydome  ncsa( sDur( ont0opxnmieilt mDem( pnu) rtomoctytla  au ils)t2xmim no1ol n icsltfaDtm(m ot4oeeo oeiad a2ul( o t0 ltrircootom rauvi;s0 euo(o3io4oltelfcslt a2tm(r nt0alto icilt s rlump;(4 rtoio3tadfpDrai il()srtoxr3iydapee net t a2rmur nt0oexomf3iltfa2ra(vp t0trtoxo oodoa  aieolt0srtm(opoy4lm n fvtasf 2umxr no0altoioctlt aDemump u4arxoif iadoa  aivs;t)setm(o3ou1ame livi ( srtm( oot0tleo ieiyt sDuau p t) ltoif3oytlmt  uvolt)srxm(o3oodol nlnviasfsDrrumpou4tet mociat a2emn s (4 exnmr3oo1laDeauvi;t0srxoim3iy1lmtnlfes (  Draurpno0tpt  fciyt sDumumpnt)teenmfcia1fmtelnvi;s0 eur(mpiodale mies s)sDtr(mp;t1alxnif3tydlm uaums;t4tlxrmfcoy1opt li o;t)trxoxmpnudllt licilt s2tax p;u4apxniiciad mDum(vs;t0 rtnir oodlmtrli o (0sruo(r3oy1ameelnvils sDtm(r ;u0aet mfcils s uln pnt0 etnir3tadfmt aivils trtmxopno4omtemneils  rtau ont0tlxo i3iytla elnmpnt0tltnmrctydfa rlu s;s  etm(o iudlptelncs t)a2tm(mo;o0teenmieiadfm2ulumsnu0tlenmr3ootlpD anvs;(0seuo(mpoudlmt mivilt)arra(moou4oltn o3ilsfm2emu pnu0 rxoxf oo1fa eau sls setrimpoo4ap n fesatfs2tauro;o4tleo ociadlm uauvont0arenxo3iytlaD anesls t2umiopiu1amtn fvtls  Dtrum no1apenmo3iyd m uanmsnu)arxrxrctatlm rauvslt trtm(mpiy4opt  nvi t)aDraxrp;o4tet ii3iyslsDeanmp;() ltoif iy1oaDeaueo s seurim3ou1op elivsat)sruau  nu1tltoioetas m elu s u4alerxocta1fmDelivsls)sexm(rpnodopt lfet (  Dtax p;t1tleo i3ils m2emn ont0 rtrmf3oo1faD lnvo t0teuo(o no1ap  mfeta(fsDtmuroou0apeoioeiysfm um( p t)trtoxr3oy1fp r i sls t2uoxrpiudlmte fvias)aDuaxrpot0alt iicilslsDeln s;u) eermrctatoatrlneolt) 2urim nu4opte ietatfartr(r no4opt mi3iltfs uau p (4 eeoxo3oydomD luvs;s srxmirpoy1ape lfcia( srurxmonu0optoifciad aDemu o;t4 renmf iatlmD lnei;s0tetmir oo4opeelncilt sDrau o;u0tleomf3iasfmDrl(mon()tetoxrcoodlptrluvo;(0 etriopiy1lmee fvta(fs2ta( pot0opeomf3tydfm ulums;t4 lxoxf oy1om elnei;()setmxr3no4lptnmivt s)a2urxro;t1tpenioeildfm2emuvonu4artomo todlaD ai ils)seuo(o3nudlpte ieslt a2rmu  nt4tpeniieiyd a uanvp;u4tleomo3ty1fpDeln olt) eur(o3oy4ap nlfvtlsf Drruro;o1oee mi3tysfs2rmums;u4aleomf3oo1fpt aieils)trxrir iodamtelics (faDtmxm ;u1tlxo ocias a rauvsnu) lenxr3totomD li s;s0srto(r no4aleemfvs s)s2um(  ou1tet iietaslmDuln p t)arenxr3iotoa r i ilt)texriopno1oltnmfeiat) rraxm nt4aex ii3iysfaDrmuvpnu) rtomf tydlm e ivs t0 rtoirpio4lptn nei t)srtaxm nu4oet ifciad sDrmnmo (4 exrxf3ty1opt aues (0sexmxmpny1apenlfciat sDrr(m ot0aptniiciaslm2uanvon()tetoif io1fa eauvols  ruo(mpnudoleemfvil()s2tmxmpoo1tpx  i3ilt a2elnmo;() exnmf3ia1lmDeauvo ( trxmim oydom nlnctat)srtmxm ;o0olxnio3iasfmDumump u4tetnxf tydlm  liesls0 exmim io4al  miet s srrrur ou0aptniicils s2elnmp (0teerxo3tytomDe neolt0texm(m no4llt  ieil( a2ra(m ou0tet mfciys s elumpnu)teenxr oatoate nvs ()trxoxo3iu4amtelncil(faDua(r ;t1oexnmfeiydla2emn s u) ltnif iodfmt lnvs;t)s2tr(o3iu1optelictls  rua(m no4aetnmf3iad a2rl( s;t)trerxrcoo1oaDeanes t0 rum(mpnu4lp e icil(faDtrx oot4opxomo3tasfm2eln onu) eermo3iy1oaDeln ol()srumxm nu4ome mivt ()a2rmuroot1opx ii3ias mDulump t0texrmo to1fpDraueo s)srtmir oodlp e nvta(f Draurp;u0ale mi3iydfm2ra( s;(4aetrxr3ta1fp e u i;s sexr(o3iu4amtnliei t sDtaxmono4oeeomi3iaslsDemnvpn()alermoctadfa  lieols0srtrxrpnodol   net ( artmx p;t0oetoifeils aDumuvont0trtnirctatfmt aivsl(0s2ur(rpnydap   fcslsf 2rr( oou1tptomieias s2rlnmo u4aexomf3totfmtrai s t0s2trir oydapt lfvs ( srraxrpno0aetomoeiadfmDrmu snt0treomr3iydlp e ueols) rxmiopny1optelivils  rtax pnu1apxnif3iysls2em(mpn(0trxoxfciodfa  an i;s0trxoir iu1lpen nvtasf rra(m ;o1opxn iciyt s rl(mpnu) renirctatlpDrauvo;(0t2toxo3iu1lp nlneilsf rtau o;t1apx iictadfsDemuvo (4 eeoir3ty1lp e i s t0t2xmxmpny4lm nlncsltfaDur( pno1oetn o3iatls2ra(vs;u)arxrio tadopt luvsls trtoxo iu4lpen ics ()a2tm(m no1oexnmo3iysfm rlnmsnt0 lxnio io1lpDrlnes;s s2urxo3ny1lp emncs tfsDum(  no0aleomf3tldlaDel( s;(4 eermo tatfp   ivs s)t2umim nu1lle  ivslsfsDtrxmonu0apen o3ias mDea(vsnu4trxnif iatfm eaneo s teuoimpno4lp nlfcs s)srrmxr ;u0tlxomfcilt mDrm(vp;() leoircoadom e neils0seuoir3no1ll n ncs tf rum(m ot0tptniiciltlaDrl(vsn(0 lenmfctodopDelivs (0trxmxm3no4amen fes s)sDtaxm oo1aetn fciatfm rm(vpnt4 rxoxr todlmtr nvo;()t2xoir iydlle mics (fsDuax ono1open oeild m ea(ms u)tlerxf ootop  lues;( seur(m ny1amt lneilt s2rm( p;t4opxomf3tasfm2em(vpnt)tltrio oydlp e ivilt) euoxm3ny4omenmnctls a2urumo;u4tlx  icias m2rmumsnt)tlerifctytoa  aivo;t) rtoim iu1op   fvi sf Dtmum ;o1tet mi3ildfm2um( sn(4arerir oydfmtelneo;(0 euoxm3oo1al e ieiasf 2tr(mp;o4tptnmieildlm2uanmo t4 ltoxf oadom  ai o;(0trtoxmpnu4olte ics s)sDur(rpou0altnio3tys s2em(ms;t4 lermo oodfpt luvs;t  rxoxopnodll   ncilsf rtrxm ;o4aetomf3tlt s2eln pnt0artoxfciytlaDe nvo;(0 etmxrpno4ll nlics tfartmx pnu0apeoiieiyt m2elnmpn(4arxoif tytlpDelu s t sruoxr no4aptn fesa(  Dumx pou1olx moctlsfmDranmo t4tltomocoodfaD  uvols0setm(rpio4om n net (fs2tm(rpno4ale mfetld sDum(vs;t0teenmr3io1lmteaieils0 rurio3nodaltnmivtas) rua(m oo0aptomo3iat s2ul(mp;t0treomocoodlm r n o s t2xoiopiy1olen nei sfs2raxmpnu4olx mf3iyd a2um(vo t) exoirciytfmtelnvs () 2xrir3ny4ame  iet (  rraumo;t0oetnii3iad s2rmn s;t4trxnxo3oodopD livo s0tetoxm3iu1lp emnvi ( artaxmonu0tlenmoeiytfm rlu s u) lenifcoo1fa  lnes s seuoxopiu1ole  ivsasf Draxmo;o0tltn iciltfs2um( p u) rxoifcia1lp   n o;( srumxo3no4oltnlncs ()aDtmxm no0tpxnifcildls umumo;t) eeomo iadlpteln i;t) ruoxrpiy4omeelivs (  ruau pnu0ole moctaslmDraumo;t) exnmf3tatoaDelieslt  eto(o3oo1altnlnci (f rraxmoou1opxnmietadfsDumnvo;u4 rxrxf to1lpDeaivols t2umim io4openlnvtlt)aDta(mono4opxoifciltlm2elnvsnt)aexoxo oatfpD aivilt)s2tmio nu4lltn ivt ( srua(mooo4altoiietlt m2ua(mpnt4tltrxfciydopDrlnvs s texrir iu1am emncsa(fsrur( p;o0oetnmfcildfa2ra(vs;t)altrxf to1lmDeliei;() exmxrpno4llt mnetlsf Drmxront4olx mi3iydla emnmo;u4trxnir ty1fa   n o s  2xr(mpnu1op nmnes (fsDrmxmo;o1opxnmf3ils s2ua(mp u0aeenir oa1oatraivo;s0setrxmpnodllenmnci sf rtr(mpnu0oexoifciysls2ulnmp t0artnxrciadlp e nes;t  rtoirpnu1ap emiesas)artr(mp;o4olx ifeiltls2el( s;t)tlxoxr tydopDeli s;t seur(rpoy4aptnmncils  rrrxrpou0oet iictytla2emu o u0texoif3ootlateaivo s0setm(o3ou4am nlict () 2rrumoot1olt  fcildls2eau s;(0 rxrircty1fa rlivo t tetmio3ny1lp  lncilt sDtau o;o1opxomietyd s rln s (0arxrmocootoptraues;(0 rxr(r3ou4lp nmnctl()s2uaxmoou4opeomo3iydls2ra(mpn()tlxrio3tytlpD lieilt trtr(o3ny1ope  fcil(  rrrxrpnu1tptn i3iltls rl(mo t4teenmr iytlpD  ues s0sruoim iu1ameelicia(fa2rr( o;t0tlto ictadlmDea(mp (4tltoir3iytlpDeaivols) rtm(opno4ape  fesa(fa2ra(  no1tptnmocilt sDrau o;u)aetoircia1fa eaueo t  euoimpiy1alte ivt (f Drrxm ot0oex ii3tld aDemu p;u) exrmr3oytfp  anvi s)t2uo(m3io1op  mnct sfs2rmu pnu1oltn i3ilslm2emn sn(0trenmfctotopD li s;s0s2uoim3iydome lnvt sfsrrax poo1aptnmiciytfmDemnvs () eermf3oydfa r ies t) exmxr3ou1op nlfctat) 2ta(mooo0open icias aDul(mp t0 lxomf iatlaDraues;s)teum(mpiudopt mfcsl()a2ur(rp;t1opxo ieiltfm2ean o;t0aeenmocoa1faDranvs ( sruoxm3iodllen iet () Drmuront4tpx mf3iyslm2eauvo t4alerxfcoy1fp rauvs;s)trumxr3iy4openlnetlt)srrrum ;o0oeenmo3tlt s rl(vpnt4arenxr oydom eauvo s srxm(rpou4lpt mnvi (fsDrauroot1aeenifetaslm ran s u0artrxf3tydfatrli i;s0trtrio ny1llenmnctlt aDtm(mono0oltomfciat s2ra(mo u4trxrxrcty1omDeanei;t)t2um(r oo1omtnmfviasfs2um(  ;t0olto icilt mDelu s u4treoxf3oatlmDeln o;(0trtm(o3no4lpe mfeiltf rumuroot1tetnif3iad m2rm( p u)tltnirctydfpteau i t  rxoim nydapeelies s)sDtaxr ou0altnmieiyd a rl(vs t4artrirctadfptean i;( seumim3nu4ame mnesa() Drr(ront4openiictlt s2ul(mo (0trtoxrcia1fm  aueo s) rtmirpiy1ol  mfeta(  2raum oo0olxo f3tydfmDrmuvo;(0 eenmf tydfm rlieo;t s2xmim iodaleelncs tfa2rm(mpou0teen ieildfsDel(vs u4trtrmr3tatfaD auvs;(0 exmxo3iu1lptnlfci (f rtmxr no1apeoifciadfmDua( p;u4texnxo oodopte ivi;s)s2uo(o3oodope  net tfsDuau  ;t0tptnmieiyd a el(msnt4 exnmfcoatla r i ol() 2urxopny1ol elfci tfarrmu  no4tpxnmieiysfm2umnms u4arxoir3ootlmDrlu i (0trxo(o oodaptnmnvil(fa2trx  nt1oetnio3ildlm ea( p t4tlermocoydopt lu s t)s2uoir3iudap  lnciatf 2rau  nu4oetnmoeils s rm(vs u)alenir todfpDraiesls0t2xmio3nydame mfcia()sDtmurooo0ope if3ilslaDrmnvo;() lxnmfciatla  lieilt seuoxo3oy1ll e ivsat srtrurpou1opto oeias s2ea(vo t0texomociotlatelnvo (  ruoiopiy1ope mnvt s)aruaum nt0aptomoeiadls2rmu p;t)artrmf ta1op  lnvs t)teumxo3ou1am e ictl( artmxmpoo0tee mi3tltfa2rmuvsn(0trtrxo3tadfa  auvs ( s2trxopoy4lmt mnct s)a2umxmono4apt  fciad m uaumon(0artoxo3oytfaD lues s)t2umiopny4aptemivil()a2taxrp;t0tpxnmoetys a2eanmo ()tetrxr3todopt li ols0 rtm(m3iu4al nlnvi s  Dtmu ono4oetoiiciyt sDua(vsnt0 lxnxocoatlmDeaivo;s)srxoir ny4ol nmnvsl(fa2trur ou1open fctat a2rmnmp
\ No newline at end of file
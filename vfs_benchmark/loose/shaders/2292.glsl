@@ -0,0 +1 @@
+neols t2tmxrpno4ap elicias a2trx ont1oltnifcildfsDumu o;t)tlerxo tadfm eluvols srurxo no4olt lfet (f rrmu pou0oee  oeild m2umn on(0aetrmoctytlmD ln o;t  etmxm io1optn ict (f rur( oou1altnmieiysfm uauvs u4alerxr oadfm  aivo t)srumxmpny1aptn fesas a2truro;u1ope ifeiad a2ra(mont0teenio3todop e uvs (0s2xmir no1lpe  ncias arua(  ;u1apxo feias sDemu pn() eerxrciotla eaueo t) 2triopoydapt mics t) rrau  ;t0tpx ioetadfs2rlnvpnu4texnmr3oodfptr n sl() eumxo oodam e ici t a2rax p;t1olt iiciyt sDumuvo;t0alxrmo iadopDraieilt  exrio3nudom nliesasfs2raum ;o0tlt mo3iaslaDel(mp u4trxnmfcoadfmDrlnes ( t2urxm oy4aptemncil(  rrmxront0apenmfeiys aDumuvo t4teeoxr3iotlp   u o;t0 rumxopny4llt  neils)sDrau  nu4aet  f3ilslaDel(von(4alxnmfciatlmt lnvil(  rur(o ny4om n nctltfaDuau ono0apx if3iadls umumsn()aexrif ia1fpDeaivi s srtmiopoudlltemfcsas srururoou0teenif3tltfa ra(vo t0 leomocoytlat au i s srtmio3oy4oltn nvslt sDrmxmoot1oeeoiocils mDul(mpnt)texrmo3oy1oatr nei;(0s2xm(o ou4oltn fvs (fsDuaum ;t1teto icild a em(msnu0teeoifciydom   nesls)s2toir nodomte fci tfaDtmxrono1oetnifctad s umnms;(4aeerir3oodfp e ies;()s2ur(opiodaleemfvi (  rraxm nu1alxn ictytls eau sn() etnmo ty1laDeaieolt trxrxrpoo1ap e fcilsfsrua(ront0oex  fctltfaDem(vp;t) ltnmrctadlp r ieo t t2um(opoy4lleelfesltfa2umumo;t0aetn f3iadfm ranvo;u0 rerif3iatlptran ol() etmxrpnodlp   ivtat aDurxm nu1oet ifcildfaDea(ms;(4tetnif oydlmt  ieo ()s2umim3iodopteliei t a2rmum oo1aleoiicildfa2uanmo;t)aetomo3iytfpD ai o;t)sexo(opoy4lptn ncilt srtm(rooo4alxnmiciydls uanmp;t0tlxriocoy1fmD auvils) rtrxrpny1al n ieia()a2ra(r nu0apeomoeiysfs ul(msnt0tlenxo oadlmD  iei;s0sexoxr iudoltelncil( s2uaumpot4alto ociatfa2eluvs t4arxnmrctydfa raues ( s2to(r3iu1ol n nesls aDrm(  oo4olt ioeiatlm2ulu p (0 exoxf3iydfatr ies;t)s2urir3oo1ap   iesasfaDumu  oo4ole  oeias mDrmumon()tetomr3oodoat anvo s)t2uoio3ny1al  mnetl()sDraur ou1tet  ictls aDeaumo (0 lxrmf iatop elivo;s s2to(r3io1opt lncsltf Dtmu  nu1ole iocilsfsDul(ms u0alxrxfcoydfmDeau il() rto(opiudlptemncs tf ruaurp;u0olx mf3ilt m2rm(vont4 renmocoadopD au ol()trxrio oudlpte fci (fsDumx  oo0aleomfeiat m rm(vp;(4tltrxo io1fpD  uei t)s2xr(mpoudap n nesl(  rrmxrpnu0alen ieiaslaDuanvsnt0tltrmfciy1fp r n s s  exo(o ou1oleelfci t)sDrrx poo0tpxoif3iat a2eanvp;(0alxoxoctatomtr i ils teurir3oydome lneia(farur(rp;t4opeo f3iadlaDeanvo t)artnircio1omt  ivilt) 2xmxmpiu1ol nmiet (fsDrr(m ;u4oetnifeiad mDumuvp;t0teeoxociodfa rluvilt  exm(o3ou1lleelnei () Dra(mp;t1teeoifctldls2rmu ont0texnir tytfp   ieo;s0texr(r oodape  ieils) Dtmum no1apenmfctysfaDuanvs t) exomr io1lmDe u ilt0trxm(m3oy1ap e fviat  2rmu p;u4tpe mo3ils s2rl( o;()altnmo totfp elnei;t) 2toxr nu4lmen ivs sfa2rau pot4olxomf3tysfm ra(ms (4tetoiocta1fm   nvsls0 euo(r3iy1lle mnet tfs2rrum no0alx ioeiltfs2emumo;u)tltrxocta1fptelivi t0 exoirpnu4ome mfvtat)s2ra( oou0oltn o3ilsfs rmn p t0 leoxrciodfpteai i ( trtrio iudaltn fviatfs2ta(mpot0opt iociad sDeanvp;t0alerircio1faDe uvs () etr(rpiu1alt mnvt ()aDtr(rpno1apx  i3ils s rmn s (0aexoxo3ia1lpD ln i;( seurim iydam  micsltfsDtmu pot0teto fctltlaDua(mp;(0 lerxf3iytlmD  iei;s srumirpiu4ll emics t  rur(mpoo1aet ii3iysls2rm( p;(0tetrio3oo1om raivi;(0t2um(r3oy1apt mfeslt) Dtmxm nt1opeoii3tydfa ulnvpnu4 rxomr3ootlp  aieo t0sexm(o3nudaltnlivi tfsDrrxr ou0oee mfciatfa2eanmsnt4areoxocta1la  lieo s0 2xmio oudopee ivt tfsrtmxroot1opt mo3tldla eauvpnt4tetrmocoa1lpte ies () 2tm(rpiu4lmenmfeia(farurx oot0tlt mfetasls2ranmp;t0alerxrcoy1oatrln o;( s2toxrpio4lptnlfvi s) rtmu o;t1aexn f3iadlm2elnmp t0aexnio oatlp r ueo;()srtrimpiu1ome mfcs sfs2um(moou4alxnmicilslsDuau pn()tlxnmrcoo1oate ieo t sexoimpoy1amt  feia(fsrtaxm ;u4oeto oeiad s2ranms u0trxoiocto1opt anvi;()trtmxm3iy1lpen nes (  2urx onu4apxo iciad a2um( o;t4tltrxr io1fa elieols)t2tm(mpoo1lpt mfcsa( aDrrxr nt1tpxoiictltlmDean p;u)arxrmf3oa1lp  lneo;( trxm(r3oudlp e fvtl()artmumo;o1oexoif3iyslm ul(mp t0aeerirciatoa   ieols)texm(m3ou1lpenlivta()a2urur ;o4ape mfetas m eluvp () ltomfcoadfpt  nvol(0srxoxo3nu4lptn fvsl() 2umu pnu0ape ifeildfmDea(mo;() rxoircoa1fpD ln o ()t2toir3iudoptn fvils) 2um(r nt1opt  ictldfaDea(vont) rxoxf ootopt auvo;( s2trxo iy1ap  mietls)sDua(ro;t0opx iictys s ulnmp;(0 rtoio tatfatelneils s2uriopiydom  lfcsa( a2uaum nu4apx ii3iyd sDra( o t4aexnio3iodfpt an o s)seum(o3oudamenlietlt)s2ua(ro;t0oleoif3iltla ul(mpnu) leoxr ia1fa eaneo s  eurxo ny1ol emfcsls  2tr(root4oet  ictls a rm(monu4 eeoxocta1oatelnvo t) rxrio oo4olt mivsls  rtrxrpou4opx mfeiadfa umums (0trerxo3oadfm rln s t)texrxr iy1openmietlt)sDta( poo0tpxnifeiadfmDulump;(0aexnxf iadlptrauvi (0trto(rpoydome lnctltf 2raxmp;t0aee io3iytls um(vs;u0alxrxocoo1faDelivi;t0t2xo(mpnu4amtnmiviatfsDtaurpot0oetoioctatfm2um(ms;u4 rtrmfcio1fpD lu o (0setrir3nudlm nmivtat)s2tr(mpoo4alxniiciltfs rm(vo t)teenxfciytfpD  i olt srur(mpoo4lltnmneilt)srtmuro;o1oetoifetlsfa ul(ms t)tltrmo iy1lat  neils t2xoxrpou4opeemivi tfsDrau onu1oex iociaslm ua(mont4trxrxr3tytla rlnes s teto(mpnydllenliciasfa2taur no1texn ociadlm rmnvo;u)tlerxo3iatop raueol()seurxrpno1amtemfei tf Duaur no0ape  i3tld a2eanmpnt)aeerxf totlpt li i;() exo(opiy1olee ncil()aruauronu4alxn ieias m2ea(mp (4tlenircoytomDr neo t0 2uoxmpnudom  mfcslt)sDrrxmpnt1tltn ieiyd m rau p (0aetnmf oy1omDeau il(0trurir ou1om n fcsls)arum( onu4oltnif3iltfm2ea(von(0alerxo oadopte uvols0 ruo(r iudomee iesas sruaxmo;t0opeoioeiyd s2em(vo;t0tltrio tydopDeaiesls sexo(m3oo1amtn fes ()a2umuroot0aexn ictatlaDrmu on(0alxnxo3iadfa r ueol( s2xo(r iu4oleeliesa()srtr(m ;u4oleoioeiytfs elnms;()trtnxr3oadla  lu i;t)tetoir3iy4omte net s) 2rm(rpou1olxn ociad a2rl(ms;()arxrxociodfa   nvolt0 2xriopny4opt  fet ( sDra(root4aetn oetytlm elums u4 rxoxrciydoa  lu i t) rxm(o3iu4olee nesl(f Durum nu0olxnifciydlmDemnmont0alermf3oatoaDean i () rxm(m3iy4oleelnetas)aDum(mpoo1tet  i3tytlaDrmuvsnt)tltnir iydfptrln slt0trtmir3no1lltn nci ()srta(mo;u1olxomieiysfs ran p;()tlxoifcoodla  livo;(0trtm(r3iy1lme  fvs sfarrrum oo1olt ii3iadfm rauvs;t0trtnxr3ia1fate uvs s  2triopno4omenlietls a2umxm ou0opt mfctltfaDrluvont4aetrir3tydoaDrai o;s)s2trir no4oltnmfvils  rrr(rpnu0oltomiciadfs ea( s (4 lxrxf iatlmDe nes;s0 2uoio3io1lpen ici (f 2taxm ;o4tlenifetydfm eauvs (4tltnxo io1omteau o s  rumio3ny4lp  miciasf Durxmpoo1ole mfeiytlmDua( pn(4 rtnxr3iodoate u sls s2xriopnydome  nvtl(  rtaxmo;t0oltomociytfs2elump;u4tleoif3oydla eluvs (0truo(o3oy4amee fvsl( aDur( pot0oexo i3ild mDrm(vsn(4 eermocoadoatrai o;t)seto(m oy4apenmncsls)srrrx poo4tlxniiciadfaDelumpnt)tetnxrcoo1omtrlu olt) rtoir ou4apt mnvilt a2tm(mp;u4tet moeiad m rm(mp;u0trtoxf3todlpDe ieils  2xrxo ny4om emfciatf 2rr(r ;o4tlxn feiad a ulnms;u4altomrcoo1fp eaneolt0 rxm(o no1aptnmnei tf Draurpot0apt mi3ildfa2el(monu4alxniocoa1lpD  i ilt)t2ur(m3oy1lptelivias) 2rr( ono4oeen i3ild a eau o u)artomr tatopD lueilt) 2umiopiy1lltelfesas sruru  oo4texo oeild s2ulnms;(0 lenxr oytfa  luvol( srtmirpiu1omen fctltfaDrmxr ot1oexnmociaslm2ra(mo (4tltnxf3tatlmteli il(0t2xm(m3iydllte nvsls)s2rmxr ;o4alt  fctlt a2uauvp t) renmf ty1lpteau o;t  rxoxopoodll e nei s  rum(m ou1tlt iiciadfm2ea( o;() renir tytfa rlu s;(  exoxm oo1alte ies ()sDurxmp;o0texn fciadlm2uanms t) reomo3tatom  livi;s srtmxm3no4optnmictlt aruru pot0ape mieiadfsDulnvo;u4altnxociotfp raivi;s)srurir no4lm nlnvilt  2raxrp;u4apeo f3tltla2rmuvont4alerir tytomteau o;t)texrxo iy4olen nei s)arraum ou4oexomf3tlsfa2umump;t4trxrxf tatlaDrli olt)t2xoio3iu1ape mnctas)s2tr(rpno1apxoif3iadls rmu pnu0 rxnmr3oo1fp eli i;t srxmxm iydol   ivs s  Dtr(mo;o0tpx ifeiadla2umump u4trxoxocoodfmt lieol(0t2um(mpiodop  miviasf rrmxmpoo1aptnii3iltfsDrmu s ()tlermo todlmteaiei;s) 2xmxopnu4openlnvtat aDuax  ;u4olx  ictyt sDemuvpn(4arermo oydlm e neo;(0 2xoio3oy4am  lfcias)sDuau  no4tetomi3iasfa rl(mp;(4texnif3to1om raneils)t2uoir no1alt  neilt  2ta(r oo1aex  o3ildfa2uaums;u0aexnmr iodfate i o s texm(m iodale  ivt t) 2rax  nt0apxnio3tltfs umu s;u)arxnxr3tatlaDelneilt) rurir3nu1amte ies ( sDrr(rp;t0aeeo f3ildfs emn on() rxrmf3oodfaD lnvi;s tetoimpiudolenmnet s s2rm(rpou0oetomoeiat a elu p u4aexrio3iytlpDe ues;t  2xr(o3ou4am  lictls)a2rau ooo4olenmieiydla emn p;u)aexrifcoydop elivo s  exoiopnu1am emnctat)aDuru pnt1oexoii3iad s rmnmp;u4 ltrmo tytoaDeaivils)s2umxo3nudol e nvi ( arurxm nt4aeen feiydls em( s;u0 ltrxocta1fmDeluesls0srtoxopoo1lpe mivi s) Durxmoot0oetomfeildlm rmuvs;t)aetoxrctadlatraivo ( sexriopnu4omte fesa(fa2ur(moou0ope mfctad a2um( s u) reoirciatoaDean i t) 2uo(r3oy4lpt lietas aruax p;u0aptoifeiatfs eau ont)trtomo oy1lp  anes t)trurio nu4ol e fci t)a2urxm ou0teeo fetysfmDeaumo;(4altnmociotlm e ieo;t0t2uoir iu1ole mnci sfaDua(rp;t0alxn iciasfsDuln s;()aexnif to1opD  uvi (0s2tmiopnudaptnmfvia()sDuaxront0tptoif3tld a elnms;t) rerxrciy1omDe nei;(  2xmio3ou1llt lnvsasf rurxmo;t1oeeo o3tatlm rl(ms t)tltrxr iy1fa eaieo t srxrim iy4om e ietl(  rur(rooo1tpenmoetlsfa emn s (0aleomfcoo1fptr ues t) etmim iu1apt  fesatfarumxmp;u4apeomfetadlaDul(msnu0 rermo ootoatrauvils) rtoim3no1ome lfetatfsDrm(r oo0ale  fctldfa2eanvont4 lxomf3tadoptrlies;(0s2xmxm iy1lp e ictl() Duaur no4apen feiltls2eanvpnt0 etoir to1lp  auvs;t0seurxo ou4lme  ieiat srua(roou1olenmfctlsfs2ul(vp;t4areniocia1lm rln ilt0s2tr(r nudamenlnetlsf Dtm(  ou1teeomfetydls2rlumpnt)teermocoatfaDeaies;t) etoxr nudamenmnesltfaDtruront1oeto fctls aDumnvpn(0 eenif3oadlpte uei;s0 2tr(m3oo4ol  mfvtatf Durx  ;t1tptoiieiatfmDea( s () lermf3iotlaD  n i t tetoxm3iydomeemneils srumxroot0oleomoeiltlaDrl( sn(4 ltrxocoatoaD ai o;()trurim3iy4om nlivias) 2rrur oo4aptnmo3tytfsDumu snt)trtnxo3ty1oat lnvs ()srumir ny1ale lictasfaDtauronu0aexn o3tadlmDemnmo;t)tetomo tytlm  auvol(0t2triopoy4ol elfctas a2tmxroot0oeeoifeiasfs2umnmp;(0 ltrmf oo1fm   nei;s)setoxr3nu4op elfvi t)sruaxmo;o4oex  oeilsfaDranmpnu) lxrxr ia1omt ai s t srtrir3iu4optemnvt ()aDtrxr ot1tlto fctltfm2um(vs t0texoxfciy1fpt luvs t  eumxopio4om  lnesls artrumooo1tetnmieiysfm2rmumo;(0 lenirctodfmD au il(0t2tmiopno1olt mfvil( a2ra( oou4apto feiatfa rl( ont0 etoifcto1fateauvi ()trur(m3nudapeelfes (f rrm(r nt1tlxnifctls mDuau p;(4tlxnmf3iadfpte ueils)sexrxo3oo1lpeelnctat  Duaxr ot1tle micild m2uau p (0 eeomoctatfmD au s s  exo(o3oy1ll nlnctl(farurxroot4oetnmocildfs ua(vs u4tlxnmfcto1fmtr n s;s0 2urimpio4lmee ieslt arta(m nt0tptnio3tlt a2rauvo t0 lenio3tadlm  lueo t)trxmxo nu1lmtn fet ( srur(mo;o0tptnif3ias s2rm(vsn()areoifciatfmtelu sl(0trxrxm3oo1lm nlncslt aDur(mo;t0olx ii3tysls2rl(mp (0tleoif oa1omtrlneol(0s2xriopio4ome lnet tfa2tr(root0apt moeildfs2umu on(4 lenxfcio1fmtraivolt) rxr(r iy1alee nesls aDrr(ro;o4tlto octydla2ul( p (4trenir3iatfp rau slt  eumxrpiodlptelncilt) Drm( poo1opx iiciytlmDeanmsn()tlxoxf tytlpDeaueo s  2to(rpnu1amtnliei (farra(moou1tet moctysfmDrm(vo;u4 lerxo3tatoaDeauvo;()s2ur(mpiy1lptelivs sfaDtru ooo1ale moeiysfm eau pn() lenmr3ootlatrlneo (0t2urio ou1op  mnci t  2rau p;t4optnmicild aDeanmpnu4 eerxo3to1la elivil(0sexoio nu1lpe mies (f 2tm(rpou0optoioetysla2elnmo (0teenmfcoa1lp  li o;s0s2tmxm3oy1lleemnvs ()s2ur(  no4tleo ictlsfs raump t)tlxomo oa1lp   n i t sruoiopno4om eliesat)aDtmum ;t1tex mo3iatlsDuau s;() reoifctotopt an i s0setrxo3iy4omee ncsl()srtmxr nt0oetniieiltlaDra(mp;(0areoxf iodoa elueo s  2xo(r3iu1optnmnvs () 2uau p;t0aee mfeilt a2ulu s (4arxrif3to1lptraueolt) 2trim3nu4lle  nct t s2rmx o;u4olto ietld a2ea(vp u4texoir3todomDranvilt trum(o oydlme lici (fsDuau  oo1apt ioeiytfmDel( sn(4 leoxo3oydlpD livols) rtoio3no4ame  iei (fa2rrurono0oexomietlt mDra(vp;t)tlxrxo3tadlpt  ueol()trxriopny4lm  micslt) Drr(m ;o1oexo ocildls uau s;u0trxoifctodlptelnes;t) 2uoxm3oo1lle mieslt) 2tr( o;o4oltoio3tltla eau s (0artoxo io1om e nes (0setoxmpiydaptnlfetls a2uaump;t0olx  oeiatla elnms;u)texrio3totfpD lues ( trumxr3io1lpe mivs (farra( pnu0oet  fetas mDrmnmsnu) ltoifciy1lp   ies;() rxr(o3oudlm e iei sfaDua(m no4opxnifciltfa um(vont0arenxo iytfpDrlnvolt srxmxm ou4omtnmfeslt) Dtm( ooo1oleomo3iys aDumnmo t)trerxf oytlaDr u i t  eumir iu1omeelncsa()a2rmurooo1oex  i3iydfa uaumpn(4 lerxr oy1fpDelnes;s s2urxopny1am e ivt ( a2tmump;o1oee mietasfaDem(vpn(4tltnmr iadoa rlivsls0 rtrirpnudlp nlfciasfsDuax  ;t1opxoifetadfs eluvp t0alenxo3iodlpD auei s0setoimpiy1ap n net sfarum(r ;o0alxnmi3iyd a2em(vs u0aetrmo3iydomD ln s t)srtoxrpio1lltelfeslt) 2rm(mo;t1tlxomieilsla ea(vo (0artnir3iy1fa  luvi s  eumxm3iy4al e fvil( artrurpou4ale ifeils a2umu pn()artrir3io1lm eanvo;(0s2xoim io4alt miei t) rumxrooo4apt mi3ild s2uaumo;(4 rxnmo iydlat ln s;t0texm(rpiu4altnlnvsasfs2rr(root4aexniocild s emnvpnu0aetrmrcta1fmDrauvol(0 2tmir3ny1alen fvils) 2tr(moot0ope  oetltfs2ul(vp;t)tetomf oadfpDeaneo t texmxo oy4al elfctls)arrau pno0altnii3iltfsDulu onu4trtomociytoa r ueo t trtr(o oy4om nlivilt) 2rru oot4tltomictasfsDrmu s t4aeeriocoadfate ues (  eto(opiudopt  fvt ()sDra(r ou0oltnmo3tys a rm(vo u4tlxniociotomD aues (  2trxm3ou4lp   fesas  rtaxmpnu1altnmo3iyd sDrl( s;t4tetoir3to1fa eln i;t) 2xoxopno4ope mnetlt) 2tru o;t0tee mieiyd aDrau s;()aetrio3oa1faDe uvi t)srxoiopou4op  mnvi ()aDraxronu4oetnif3ild m2uln o;t0tlenmr oatlateauvi s0 eur(rpiydlm e iei sfa2rmxm ou1tpeomocilsls2rmn s u)altrmfcoa1lpt  uvs t  rxoxr3nu1op   feias)aDtrumo;u4ope ioeiltlmDuauvp;u4aetomo ta1lateaivols0teuo(r no4aptemncia()s2trump;t0tpxoifeiydla2ranvpnt0trxrir3ty1oa   nvo t0trurxmpoodlmte ncil()aDrru  ou4oeeo o3iysla rm( s t0 leniocoatopD  i s;s) 2urxm nydopte fvslt) Drm(  nt0opx ioetatlaDraums;(0 reomfctydomtrlu ils) 2xo(m nodol elfci t  rurumpnu0tltoifcilsla uauvs;t)tltnxoctotoaD auvslt)s2to(rpnodam elfeilt)a2tmxrpnu1apeomicildfa eau o u)artrxr3io1lmte nvo;( srxm(r3nudlptn iei (  2ta(monu0apxoifciad aDrl(mo (4texrmf tytfm e uvil(0 2uoxr oo1lp nlfes tf rtrumpnu0tetomietatla umuvo t) reoioctodfpDrli ols)t2to(opnudllte fctl(  2uax pou1aleoio3iatla2el( p;u) renir todopD au s;t0t2trio io1optnlnetas srumxrpnu1tlxomociydfsDrlnms (4tlxnmo tytfat anvils)srur(rpno4optn neta( sDra(rp;t4aee  feiysfa ulump;(4 etomr iodoaDraneo s)trxo(mpoy4lpeemncsatfsruaump;o4apxnif3iydfm2em(vs;u0arxrio3iy1om r n s;s0s2urir3oodllt mfvs t)aDtmumpot1opxniictys aDua(ms;t)artnxo3oydfa eauei t) 2uoxr oo4omen nciatf 2umu p;u4tlxnmi3tysfm rm(ms;(0tetnxr3oo1lpD  nes s s2tmxmpiy4lltn iesl(farrrxr ;o1tex iiciys aDul(vp;t4tltrif todlpt luei s0 etmxr3oy4lp n nei () Dur(roou4oetnmoeiyt a rlnms ()teenxo oodfa  lueo s)sexrim3ny4llt mfvs (fs2uaur ;u1aet  ieilsla2emn o;t4 eenir3to1fa  ai s;s0t2uoxr io1apte ictl(  rtm( pno4tee mf3tydlsDem( o;u4 rermf tatoa e nvo;s)srumio oudole mieia( a2tru oot1opeo ietydlsDrlump;()arenxf totlmDe ivo;(0 euoxm3iy1ame  ncils)srra(r ;u4opt  ocias mDrlumpn() exoifcoy1fpt  ivils0texoir nudap emnvsltf 2rrx ont4tpen i3iatfa ra(ms;(4trerxf3oy1oa rlnvo;t) rum(o nodal nmictat)arua( onu1tptnmoeils m rmu pn(0alxnio3iatlpDr iesl( sruoxopio4lmtnlnvia(fsDrax pno0aeeniieiysfm rmuvpnu4 rtoxr tadlp   ieilt0t2xr(o3oudaltemfcil(fsrrmu  nu1tptomoctad m umuvo u4alerxo tytlptrlneils  eum(rpoy1ll   nctlsfs2ua( oot0tpeomocildfmDel(msnu0treoxf3oydfmtr n ils) 2tr(o3oydop  mfei (  Dtm(mpou0aetnif3tadfaDemnmo;(4 exrio3oadlm rai olt trumxmpno4altnmivslt  rrm(ronu1aexomi3tadlm2umn pnu0aetrxrctatfmtr neo;(  rumxo ou1lme  ieils arrrumo;t4open i3iatlm ul(mpnu) lxrxr3iotfmDeli i;s)s2xmir3nu4llt livs s)aDrm( p;o1aptnmoeiytfaDranvo;()aetrxr iatfmtelieol()srur(mpnydlpenlnet s a2ra(mp;t0tpxnio3ilsfa umu s t0artnxr tydfat luvs;t s2xm(r3oo1olt  feiat) rtrxr ;o1aetoioeiatls2uau s ()altnir oytomt  u il(0teumxopoudam  mics tfsDtrxmpnt1opx  iciyslaDrl(vo;()arxrxo totfpD  ies;t0t2xrio nudam emfetasf 2tm( ono4texoiociytla eluvp ()trtnmo3ootfm rau olt0t2xoxopiy1om  mietat  2rm( pou0opxomietys m uaumonu4altrxrcto1oa raivols0trtoxopnu4apee fvt tfaDum( poo0tee  fcias m2elnmp;t4texrxr totlat livi;s0sexoir3nydlpt lfci tfaDrmx oou0alxomo3ildfs umu pnt4texrif iadla r ueols0srxo(opiu1am elfvs ()sDtaxr no1tet  fcilsla2uln ont4 etrxf3oa1optrlnvsl( truoiopiy4omt livsls  2um(r no0tle io3iyt aDem(ms u4tlenio3iadfp   ueil(0sexo(r3oo4ol elfvt sfs2rmur nt0tpxomfeildlaDeanmp;()trxoxf tytlptrau i (0t2xrim3oy1amenlfctas aDtaxm ot0teen f3tytfmDem(vpn()trxomo tadla  anvs;s)srumio3ny1ol   fet (f 2urxroou1aetnmictlsfmDeanms;()altrmr3oodla r u o;(  2xm(o nodam nlicias)aDta( pno4tpe  ieiatlsDea( p;t) rtnifciydfpDrln o (0s2tm(m ny4lltemnctat)artmx  ;o4oeto fetas m2rlu snu4tlxrif3oadoat auvo t) rxrxo ny4lmtelfeta(fsDrr(mpno4aeeoiociydfm2rl(monu) renxr tatlmt  ivslt0teurio no1optn fvi ( aDrrur ;u0tpxoif3iasfaDran s;(0tlerxf oadoaD luvolt  ruo(o3iudolte ictls)sDtrxrooo1optn fcildlsDea(vpnt4 lenmociodla elnvsl(  etr(mpnu1opt lnesls aDrmumpnu1alenifciat s2eln s u0 eerif3oytfaDrlues;s teuo(rpnu1amt mivtl(f rrau onu1aptoifetasfa rl( o;t0 lxomr iy1fateaivi t)srto(m3iydopen ncils)arurxmpoo0opeo iciydls eau pnu0 eenmf oodfaDrluei;s)srxrxr ou4lmee nvsa()aDtm(r oo4oleomfcilsfsDum(vsnt) exrmfcootlm   nvol(  rto(m iudlm n fetas)aDta( p;o1oex moeiydfs uau s;u0texoio io1la  aiei t seurxr oydlm nmfeil()a2uau pnt0tpxomfctasfmDea( on(4areomo3iy1fa rai s;(0srurxo iy1ol n fei (fsrrr( o;u0tex  ieiltla2ea(mo;u0aeenmociy1fp  aiei (0s2trim3ny4omt  ivsltf 2uau onu1tptomfciatfa2rlnmp u4 eeoxf oydlp e nvolt) 2tmio3iudlmee ieiat) 2ur(mpno4apeomfctytlaDrmn sn(4areniocio1fa raieo (0 rum(o iu1aptnmfcils aDtr(roou0tee mi3iys s2umn s u0 rtrxfctotlpDrli s s)sexm(mpiu1lpenmfvi ()aruru  ;o0tpxnii3iyd m2eln sn(0 etoxocoa1om eauvs s s2uo(o io1apenlnvsa( sDumurpnu1open fctltfaDemn on(4trtnmrcta1fmtrlivols0 2xoxrpiodop nmnct tfsDta( ono0opt ifcildlm2elnvpnt) reomo oatlpDe nes s srtr(o iodol   fes t)aDumxrpoo4opt moeilsfa2rmnmo t) rtnxf tatfmte u ilt)t2xrxm3no1oltnmnes s)a2ta( ooo0aetoiiciys m2eanms;t4alenmf3iodfmtelieolt seto(m no1alenmfctas) 2tr(m ou4aetnifeiad m2emnmpnt4alenmrcoo1lmtraues (0tetmxr oy1ll emiet (fs2trur no1texomfctad aDulnms;u4teerxocoodopD li o (  exm(m iu1apenlivslsfs2rmxm ;o4tetn ictasfm2ua(vs (0 rtrmfcoytla  lnei;(0 etm(r no1lm nlicsl(fs2trxmonu4ape iocilslsDumn pn(0trtrxf oa1fpDeanvi s texrir iudaptelnetlt s2tmur nu0tpe mietadla rlnvo t) eerxo iytfptelnei;()trxoio oy4amt mneta( s2rax p;o0tlto ieiydfm em( snt0 ltrio oytla e neilt0 eurirpio1lme  feias) rua(m oo1tex mociaslmDelums () ltnmf oatfmDeauvo;t)seto(m ny1lltn ivsls)s2ua(rp;t1olxn f3tas m rl(vo t4areoxr totla rlieilt0 2xmxm ou1ll n ieil(f 2trumpoo4tpt  i3iys sDem( o u0trtrxociotlmDr u o;t) euoxmpiudap   nct s)s2rrxmo;o1oexnioctys aDeauvo;u)artnmrciotlaDelu o s t2xr(o oy4lltemnvtlsfartrxmont1aex  fctlsfaDrmnvon()trenxo ta1lmt  ueo s0teurxm3oy4olt mfesa() rta(  oo1tpeomociad m eln o;(4tetrxr3iotfp  aneilt)setoir ou1llee feil( sDrm( ont4opx  f3iyslmDumu s t4 rtomo iydfp  aneslt0 rxr(m oo1openlict t sDuru poo4alenioetysfa umuvsnt4tetrio ta1op rlnei s) 2umir nu1llen net t srrruront4aptomo3iatlm2uan o;u4alenif3ty1lmt an s;t) 2xoxm oodoltemict ()sDumurono0opto icildla ul( o;(4tetrifciotfm eluei;t seuoxmpiy4am nlicsltf 2rau  ;t0tet mieiydfm rlnmp t4arxomr3oatomte uvols0srxmimpou4oltn ieilt srtru p;u0aet  f3tytfa emu pnu0trtrif ty1opteaivi;(0 exr(o3iydlp  lfet s) 2rmx  no0tlxoiiciad s ul( s u0artoxrcootoateaueil(  rtr(o3oo4apt  nvtl(  Dtmxmp;o1oeeoif3iaslmDulnvo t0 rerir3oy1opt aieil( t2umxmpny1om   fcia( srtmxrooo1ope mo3iadlm2umu p ()trtoxrcoadopDrauvo;s  rtm(m3no1olen icsatfarum(rpoo4aexomo3tls aDuan p ()trxnmr3oa1fp r uei s)srtrir3ny4al nlfeta(  Drrurooo0opxn ietatlsDuaump;u) exnxf ty1lpte uvs;s) etm(opoo4olenmiei sfsDrrx pnt4optomi3iydlm2elnmsnu0alxoif3iy1fptr ivsl( t2to(rpio4olen icia() 2rmx oot0oex  oetasfa2rlnmon() rxoir ia1fa r uvo (0 etmim oy1lpee nesl(fa2ta(mp;o4tle  fetyd a rm(vp;t4tlerirciadfa e nei t) 2uo(opio1ole  fvia()aDraumpoo1tee if3iltfmDra(vp;u)tlxrifcoytfa eaneo;s0srtm(r io4llt lfeta(f Dtaum ou1oexn ieiadfs2umnvsnu) etoxf iytomDrlu o;()t2uo(r3ou1ole  icslsf rtrxmp;u1texoifciys sDulu sn(0arenif tatla r n s s0 2urxo nydolt mivi s) rrmumpnu4oee  f3iatlmDul(vp t0trxriociatfp e uvi t teuo(mpio1lmenmfeia() Drrump;u4oet mi3iys a2rmu o;u0 rtnir totom e nvo t0 exoxr3ny1ol elicil()srrmxr ;o1alxo f3iyt a rlnms;u)tltomr ootlp  aivs;t)teur(r3iu1ame lfcsl()a2ua(mpoo4apeoifeiydfm2um(mpn(0altrir ty1fpDr neils0 2uo(r nydapt  ncta()s2uau  ot1apenif3iytfsDrlnmp (4tltomo3iodfp e nvi;t seuo(o oo1amenmfcils)sDtau  oo0tleomi3iltla ua( o u4 ltnmfctotlmDrauei;(0 exr(rpiy4lm   feiasfsrraxrp;u0aexnmf3iatlsDeanms u0tltoif oodfateli slt0texmio3io1alt mics sf rur( p;t4tlto f3iltfsDemnms;u)trtoifcoytoaD lues;t s2tm(r3ou4ole  ictasf rtau ooo0olt  fciytls raumsn(4 ltrmfciodlpt  n i;t0t2tm(r3ou1openmicias arrm(r nu4oeeniieiydlmDeanmont)texnir3oa1fa rlivil(0setmir nodamtnmictls s2taxm ot0altomfcils m2elnmpnt0 rxoxr3todfptelieo s)trxmxo3iudoptemnctl(fartr(mpoo0opeoiictys a ua(msn()aleoxo totoaD lnvs;() etrxmpoy4lpenlfeias)a2uru onu4ape  fetldfaDran p u4arxrxf ootlm   uvi t)texo(r io1lmtelfcsa( arum(rono1olt mfeiat a2umnvs;u4trtoxfcia1oaDrai olt trxr(o ny1al nlnvsatf Dtmxro;u0aeeomoeiatfs2eau s;() ltoiocoadfmDrauvs;t0texmiopnudlpe livs ()s2uaxrpot4oexo oetatfa um( s;() etoxf ia1fp eaivi;(0 exrio3nu4al nlnct (fsDumu onu0tlxnmf3ias a2ul(vpn(0aetrmo3ty1faDe i il( trum(r3ny1alen fcils  rtrumont1aexo oeiltfsDuanvs u4tetnir iy1lptran sls texrxmpno1ameemies ( srrrum nt1texoif3iytlm2emumpnt0trxoxfctytfmDelues;s0srto(m ou1apteliet s arurumonu4altn fciydla2rmu s;u)tetrmf oydop  livo;t)srxrxm oodolen nvs sfartrum ;t0tpxomfctatfsDrauvo;t0trtnxocty1lpt lnes;(0t2tmxr iu4alee fvi s)aDum(  no0oexomfctas a2ranmon(0 lxoifcto1lmDe u ol( seumirpiudaptn ivi sfarraxmo;o0tpeomoeiatls2rm(mp (0arenmf3iadfatraivs;s0s2xmir nudolt licilsf 2tmu  no4tpenii3ilsfa2rmu snu)tetnio iodomD anvo;s setrxr3io4optemfvt (  Dtruro;u0aexo octadfs rluvp (0aeerxf3oydom   ues;(0 2umxm no4lme  nvsa(  Dtm(r nu1opxoiiciyt a rm(vp ()altrxr3iadfpDrluvs;(0trum(opoy4am e icsls artaumonu1olx moetas s2umuvsn(4tlerxf3oodoa elies;(0 rtmim3iydll e iet t  rtru ooo0opto ieias s uau o t4tlxrxoctadom  lnvi t0texm(mpnu1lmenmivil()arur(r ;t4alxomieiasla rlu s ()aeeoxrcoy1opt  nvo;() rur(m3iu1ameelnciasfa2umxr ;t4olto fctldfsDuluvp;u0 lerifcoa1lpteauvs s) rtrxm3ny1optnmfvtatfaDta(mpou1opxoif3tydls2eanvp (0 lenif3todfp rauei;s0setmxrpio1lp e fesltf rtmxmp;t0altnio3iyt aDel(mo u)teeomf iy1fa e ies;t)setmxmpiu4lle lfcs ( srtr(monu4openmieildlsDrau s t4 rtoif3iotlmte nvilt t2um(r3iu4lm  lncslt arrau  ou1aeeo f3iyd m uln o;u)arerxf oydfa e ueil( t2tr(o nu4ole mnctls)a2rmx o;o4ape mfeilsla2um(vo t0alxrmo oo1om rlnvs t srur(rpoy1lmenmiei t)arurxro;u0tpeo oeildla rm(mp;u0 eeoxo iadfpDraueo;t tetr(m3ou4am e ivtas)artm(rpnt4oleoiietld sDulu o () lxomrciatfatr ues;t t2uoiopiy4am  lfvils artrx ooo1tpx moeils sDrln s t4treomf3io1fpDeanei (0trtmir3ou4ope lfcias) rtrxrpou1alt mfetytfm2uanvonu0aeenmf oytlpDeauvil( sexrxr iudopt  fei (f Dtmxmo;t1opxomicilt s2ea( p;(0artrmocta1op eli sl()trxoxmpno4omtnmivtlt)s2uaum nt1opeo f3iltlmDrln o;(0trxrifciydlptr ieo;(  ruoxm3ou1lm nlncil()srtmu  ;t1tlen i3ilsfa rmumon(0aeeoxrcto1op   uvs s t2umxr3io1ol elfesa(fs2uauront1oeeo o3tysla2rmums;u0 eeomoctydlp  an ilt srtm(r3no4lmtnmneilt)s2rrx  ou0tpto oeiyslsDeau s u4trtnmf3iotoa eau i t0t2tr(m3no4op nmfcia(fsDuau onu1olxn o3iad aDrln pn(0alenifcootfptraueo;t  2toxm3oudome lfciat sruaxmpot0tex ioeias a eauvs t0alxrir iydfptrli i;(  euoim nydop nmfetl( aDtaurp;o0optnmociltla2ra(mp;(0 rtoir3ty1op eaiei;t0t2to(r oy4ol  mnvi ( srtrxr ot0tltn ieilt s2uanms;(0aetrxfcoy1om e iei;s0teuoxo nu1lmt mnvias  rtr(rp;t0ope mociydfa2ua( p (4 exrmo totomD  ieils)trxmim oy1lptemncsls a2ua(m nu1aetn f3tldla2rm( p;(0aleomociy1fateanvo t tetoxrpoudlptnlivilsfsrumxr ou1aleo o3tys aDul( on(0 lxrir ty1oa rlivo;( s2tm(mpnudomte fvs s  Dtmxmp;u1apto i3tat m elu pn()treoxrcoydopDeli ilt) etoir oo4lm nlivtlt) 2uaum ;o0apxn ieildfs uln snt)teerir3ootfatr ivs s) rtoxm3oo4alt  icsl(fs2um(r ou0tetnmiciysls ua(mont) rtrxocty1fm  auvil(0trurim3io1alt mnci (f ruaxrpoo0oetoif3iydfa um( o;(4 lenxfcoytopDe n s ( sruoimpoo1olt  fei t)a2rmum ot0aeenmfeils sDul( p t) ltrir3oytfpDelu o s0setm(m3oy4om  lnviat arur(rpno4aexo iciltlm2rmnmsnu) lermfcoytom  au i;t) exm(o3iy4lltemiesa(faruaxrpnu0olxn o3iaslm ua(mp u) eeoio3tatfptraivils0s2xr(m3nudaptemfetls s2trx  no1aleoio3iydls rluvo u0aleomfctadoaD  nei;t srumim3oo4aptnlnvsa(  2tmu o;t4olt  fctys mDum(vs;(4 eeomfcia1lpD  uvil( s2xm(r oo4ll n ici tf rrr(m ;o4oleo oetydfs umnvp u)altnmocoatfpt au i t0t2urxr ou1olenmfcils aDtrumont0tet  ociadfm2el( p (4arxnmfcoy1fat ai sl(0srxmxm iudape  fes (  rtm(r ;o1aptn fcils sDrlu o u)teeoxo3oydop  li sls)seurxopoo4lpeelnviat)s2rrxrooo1optoiiciytfm emnmo u0artoio oatom r uei ( t2xm(opnydapenlfcil( a2tmxmp;t4aeenmfetys m2rau o u0 lxrxr3oadoptean s;() 2xrxopno1lpe  ncs s  rrrxr nt4open f3ias mDra( p;t4aetnmr3iatfpteaivils0trumirpoy1op n ivsas aDuaumoot0oltomi3iytls2uaumo;u)artoxr3iydoatr uesls) rtrxopou1ll elivtat  Dua(root0oeeoifciys m emnvpnt) rtoir3ia1fa elivi;t sexmxmpiu1ole livslt)artmxm nu1oetoifeild mDumumo (0 eenxr3oo1fpteauvo;(0tetoio3nudlpt mfcilt) rtmxrono4ape ifciys mDeau pn()alenmo3iadfptraueo s0 rtmxrpoy4opteliesa(  Durx  ;t4apeomo3iatfm2uaumsnt4 eenxf3oatlpDrau s;() 2xoio ny1olenmncslsf rrr(  ;u0alto feiaslm2raumon()tlxrio tadoat luvs;(0trumir3no1al  lnvta(fa2tmx  ou1aptoioeiat sDulu snt0tleoiocoydlpt anes s texoim3io4ol   ies tf rurxmp;t4apx  ociyslmDrlumo ()arermrcio1fp elu s;( srumxr oo1om elfcia(  Dtrxmpot0tex if3iyt aDem(vo;u0altnmf3tatlmDrli i;() rtoiopiu1lme  fvsasfarrrxr ;o0ole  f3tatlm2rln o;(0tlxoxfciadfm eanei;s)trxr(rpnodoptnlics s arta( pou1apenmo3ildla uau p;t0trxnir oa1faDeanvo;s0t2tmxrpno4am elivs tf rtax ont4oex moetltfm2rmnmsn(0 rtnif oadfm  au i;s0 eumir nu4opeemfvta( srur(mpoo1apx ii3iasfs ra(vs u4alxrxr iodom rauvi;(0 2tm(o3iudap e fesas)a2ra(  ;u0aleoiictat s2rmumsn(4 lenxo to1oatrlueil(0tetrim3no4lp  livsls)srum(rp;t4opx iieiyslaDel( snu0tlenir3oydfpD lnes;s t2xoio3nu1ale mnvia(f 2rmxmpno4opxnmoeilsfaDrmnvo (4 ltrxr3tadla  ln s s) eurxm io4om  mics () Drmump;t1tpx  fcias s2ulu on(4altnmo ootomtr ieo ( s2umxo no4ap elivtatfsDtmxr ;t4olt if3tadfa um(vo;u0 lerir ta1lpt  n o;s0 etm(m3oy1lp  lfesas)a2rau  oo1aleomi3iyd m eaumpnu)aetoio oytfaDe ivo;s0sexrim3nydol nliesat artmu pno0olenioeiydlm umnvo;(4 lxnxr3tatfaD lnvsls0trtr(rpnudop elivsat srum(moou4alto ociyslm umnmo;()teenxr iodlmt au il()sexo(r oo4ll emnvi tfarrau p;o4tleomoeildls2ua(vs;u4tlxomf3oo1lmt  nes;( s2um(m ou1lmt lnetls s2rau pnt1aetn oetyslsDuln s u) etomr3to1fm  lu ol()sruoio nudole mnctas  2rm( ono0alxnifeilsfa ranvp;(0tltrmrcoy1opteluvi;t  2umirpio1al e fetl(fs2umumoou1tpxo ocilsla um(ms;t)aexnif tadfatraues (0 2to(o3iy4ome lfvtlt artmur ou4alt  oeias sDrm( snu4 rtrifcto1faDrlu s s s2uoiopnydomtn ivi s)a2umumpnt0oex mieiysfsDra(mpnu0 exomo3tatfatr i sl(  rumim3oo1lm  lfeiasf 2rr(  ot4aetniiciat mDeaump (4 rerxf oadlpteau i t0srumir nu1opeelncsas a2tax p;o1optnifcildla2ea(vp;u4texoif3ootlaD auvolt0 ruoxrpoydopenlnviat aDtmur no4altoio3tytlmDranmp (0 renxocoytom eluesl( srxriopnu4lpt lieilt  rtrum ;o1tpe  fetydfaDelnms;(4altnmr oo1op elieols)seumxm3iy4omt lictl( s2uaxrono0alx  fciysfm2umuvo t)arxoxfciodfa rluvils  rumxr3oydom   ivs tf rtmu pnt4texnifeiyslsDrlnmo;(0 rtnmr3tytlaDr ivs;()s2tmxm3io4lp emiesat aDtmx pnt1oeeomf3iad mDelumpnu0 etnxrciy1lmDrlies;t0s2xmio iu4lm elietasfaruau ont1oleo ictat aDeau p t0 eenmrcio1faDeanvslt) rxrimpiudalte nvil()s2tmxm nt4oeenmfctld sDea(vont0aetnxr oo1lm eaivi (0 eumxmpnu4ol elfesas)sruaumo;t4tetoiieiysfaDea( p;(0 lxoxociydlpDr i o;t setmim3oy4omt lfvt ( s2trx  ou4texn i3tadls2ra(vs;t0 eeomoctadoa r ueil( trxm(rpoo1omtnmneta() rra(ront1aleoiiciadlsDraumo (0 lxomf3oydfp r ivsls0setm(opnu4lmtelnvtatfaDtaumooo4tleoifeiadls rau o;()trenifciadfp r neilt)srxo(mpoodamenmfvtlt) 2rrur ot1opxnio3tatfm rlumont4trxrxrctadfmtr n s;t tetr(m3oy4lmtemncia(fartaurpnt1oexoiieild m rm(ms t0alxnir iy1om   ueo t0t2trxr ny4om n fesa()sruax  ou4olxomfeildlaDrauvpnu)areoioctydfpDe i s;s  rto(r iy1optn fcils) 2tmu o;u0openmf3tytfa rlu pnt)altomr oo1lmt lues t0tetmxrpiodllenlieiat)s2umxroot4tee ifetat m2eanvs;u)arxrmf3iatlatraueols t2xrim iy4ope lict sfa2rrxroou1oexoiociydlmDrmnvp u)tlenmo3oo1faD luvils0 eum(r3io1lp elfeslsf 2umumonu4tet  ieiat s em(mo;(4 lxnmf oo1fa e nes ( tetrxr oy4al elfcsas)artaur ;o1ape mf3ild m emnvp () leriocoadom rauvs;t0 eurxopnudlpe micias s2urx  nt4apxnii3tas aDea(vo;u)arxoir tadfm e i ol()t2xrxo3iy1omt mfvtl( s2rr( oou0tet  f3iasfs umnvon(4 rxnmo3iydomtrli i;s) rto(o io1lltn nvi t) Dtru  ot4aeeoif3ilslm rmnvsn()trtrxf iodopt au o;s)srxo(o3oy4lmt mfcs () 2trum ;u4teeo feild m rmnvp;t0trtnxo3oydfa r ieo ()tetrxo ny1op n ies sfs2urxrpoo4tpxoif3ildla raumo t4alxoxocia1lmtranvs ( s2xmxm3oodoptn fvtasfsrrmxmo;o0tee ifciatlm uanvo (0trxoxf3tydfm rlivslt trxm(r ny4lptelnvils)s2ra(rpnt0aleo o3tytla el(ms;()trtomf to1oa r neo;t0t2xrim3iydlmen ivil(f rra(mont0tlt if3iydfmDulu pnu)trxnxr3io1fm r ies t0t2urio3ou1lltnlietlsfsrra(r nt1tet iociys a2ra(mo t)tlenxo oytopDe ieil(0 rxoxo iu1olen nvslt)a2rrx o;o4tpxo fetadfs2ra( o;t)teeoxfciy1fm r nvs t0 etr(o iudame mivs sf 2tr( p;o4teeoifeiasfs2ua(vo t) lerxf3oa1faD anes () rxrio3nu1lltn nesl( a2ra(ro;u4oexoif3tysfsDelnvonu4 eermo3iydlpDrluvil( srxmxmpio1optnlnvsls aDraxrpnu0alto o3tlsla elump t4tleoxrcio1lmt li i;(  euoxo oy4op  mncta( sDurur ou0texoiietldls emumon() leomrcoo1lm  lues t)srxoirpoodllenmfetat) rur(m no1tetn octat s2ra( onu4 exoxf tatoptelueo t)s2xr(o iu1olen neiltfaDurxront1tpto oeiltfmDuan s (4tleomr iy1fm rlneo s t2xrxr oy4lm nlnesls) 2tmu o;t4olx mi3iatla2um(vs t4alerir3iatfmDe n i s)t2xoio iy4apee ivta()aDur(rpot1aetoiietyslsDul(vp;t0tetnxo oodoat ln slt)tetoiopoodlm elnci t srraxrp;t4oltomfeildlm uan s u) exrir iodoat livil()srtr(o oudlpen nes () ruaumont1oetomietatlaDua( pnt) lenxrciotoaD  ueolt)srumio3ou4lpt  neilt  Dtrxmpot1opxo octydfsDuanvsnt0aetnxr iydlatrluvolt texmio nodlmeelnvil(  Dtr(m ;o0alenmfeilt sDrlnmsnu)alenxrciy1fateluvilt0sexoxopou4op elivilt  Drm(r ot4aet iietytlmDem( s;(4trtrifctytomtrliesls truoir oo1lmee ivils)s2uaxmonu1altoifetlt a ra(ms (0 exomr io1fp e n i;( teurio iodaptn fvtas aDrmu p;o4aee ioetasfsDumn s (0teeoxf ia1la r u o;s  2tmio3iy1op n nvi ( a2umu  no1tltnmfciysfm rl(mp (4texrif ty1om  ai s (0 2xr(mpiydlm  mfcil(fa2rrum nu0aptoifcils m ranms;t)treomf to1la raueils  eurim io1amte fvt s)aDrax o;t4tpenmoeiydfmDuln onu0tlxrir3oa1fm elnes;(0tetmim oudll e ieslsfsrtax  nu1aex  o3ildla rl( p;(4arxoio iy1lat au ol(0teurirpiy4lme mneils  2trumo;u0optomi3tas sDulu pnt4 rtrmf3totfa eau o;()srurir3nydlmen nviltfaDuaumpoo0aex mocils sDulnmpnu0 lxrio oytlpD ln il(0 etmim ou1ol nlfetas)srumu o;t1tle mfeiat a rm(ms;(4arermfctytlateanei () 2uoxo3iy1alen nci ( sDra(rpnu4opx  icildla rmnmonu)artrmf3tydoptelnvi ( teurxmpiudap e ictltfa2rau pot0apx if3iytfa rmuvonu)arxnmr iytlateluvo;( s2tmiopny4lmenlivia() Dtru pnu4teenmicildfa2uau s;(4arxoir3tadom rauvs;t) exoxr oo4lp   iesa() 2ua(m no0tlx ii3tydfa2emnvsn()trenmr3oadop ranvil()srxrimpno1opt mivs t)a2rmumpot1oltnii3iasla elu p;()tlermr3oydfpte ivo s s2to(opoy4lmenlivtlt)aDrau  no4oleo octadfsDemnmp;t)tlxrmr3iatfa  an o ()setm(opiu1llenliesatfaDrau  nu4tlxoif3iyt a2ulnmo;()alenxr3iy1lp   ieslt t2trio iu4ap elfetl()a2tm(  oo4alxo ociltla ua(vsnu)teerir3oa1fmtelieo;s trurxr3ou4lp elfvsas artm(  oo1tlenifetad a uau s;(0 lxomf3tadlmDeln ils0seum(m3nudlmenlfetl(faDraxmpnu4oeeniocilt a2ranmpn()tlxrxf3to1om rluvs;s)s2urirpio4apen fvilt  Dtaumpou4optoif3ildla2umu p;(0 etomf oydfmtelueol( srtrxo iydlp nlivi s  Drmx pou0aleo f3ias a rlnvpn(4 rtrircoy1fpt ln ol( seum(o3ou1am nlnvil()a2umx  ou0oeeo feias sDrluvo;u4aexnircia1faD lues t)setrxo3iodap n fvs t) 2tm(m oo4tlxn o3iyd sDrlu on(4alxnmr oadfa eanvols0trumio3iu1omtelfeilt) 2uax p;o1alx  ietltlsDeau on()aeeoxf3oytom eaiei;t0teto(r3nu1llt mivta()sDumxm ;u0tpxoii3ias m2raumsnt0altoiociatla r neolt0s2xoxopiy1omtelfciat)sruaxmont4aexn f3tadfs elump;u)trxnxr tydfa elnei;t0t2umxm3iy4ol nlfei t) 2tmx p;t1oltn feiasfm2uauvsnt4texrmf oydoaD ln il() exrxr3ny4lle lnvt s  rtmurp;o4aptnifetydla eluvs t4aetoir oydlmteaivo;s)t2toxmpnodopenlivtl( sDrr( ont1apenioeiadla2um(mp;t0texoir3oydfmDeauvolt srxo(opnudll emfcta(  Drm(rpnt1tpe  i3ils a emn snt) lermo oatla  au sl(  rtoxm3no4lmeemivt tfsDtmxrono4tee moeiat mDelnvs (4 renmocto1fmteluvs (  rtmio nodlpt lfcsltfarumxm ot0teto oeiydfm2rln snt) lerxfciydfp  aivi;t)srtr(r iydlpee ictlt  ruru  ;o1ale mfeiatla ulums (4artnif iy1fmDrli i t t2tm(m3iudomeemfviat  Drrxmoot0oleo iciat sDranvsnu4teeoio3tadoptr ues;s) etr(o3oydom nmivil()a2uaxront4tlto o3tlsfs rln s;u4arxnxociatfmtraueo (0s2xrxrpio4amtn ivsat)srrm(r ;t0tlto iciys s2uanmpnu4trtniociadfpDr n s s0s2umir3iy1ole lncsls)sDtm(roou0alxoiieiadlsDul( o;u0alxoircoytlm   n i;s  eum(m3oudlpt  ivtlsfa2ta(rono4apt  f3tlt a2rauvo t4tltrir tytfmD auvil( t2xmimpoudam nlfvta()aDtau oou1tpxn fctydla2uluvont)teeoxoctadlpDelnvil(0 rtrxr3oy4alte fci t)aDtax  oo1aet  iciasfm2ua(msn(0 lxnxf3oy1omDrlivo;t0srurio nu4openlici (fsDumx  ;t4apx mictlt aDrluvo t4aexnxocty1fa rln o;t)teurxo oy1lm   fetat srrrx oot1oltoifeiadfs2ra(monu0areoxr oodfm  lu ilt0t2tm(r ou4olte nvsat sDrm(ro;t4aexomo3tlsfaDem( p t0texrmrctydomtr ivslt  rtoxo3iu4lmenmncs t)arrr(ront4olt  feils s rau sn(4tlxrif3ia1oaDraivil( s2uoiopno1oltelnvsltfs2tr(  ;t4altnioctyd m eauvs t4 rtrmocio1la rlieols trurimpnudlp  lncils aDrr(m ot1tpenmfeilsls ul( p t0aexrif oo1lmDraieo;s)trtrxopiy1optemfciat a2tr(m nt4opeomiciys m rl( p;t)arxnmr ta1oa elueols0t2urxm iydlptnlncta() Draur ;t0tlxniicild a2umu pn(4tetoxrctodoa ranvi;(0trtoxopnudomtn ivsl()sDra(m ;o1aetoiictyslaDeanvsn(4tleomf ootoaD livo s0sexr(opno4lle mneilsfarur( oot4tpen fctlsla2eanvsnu)teeoxf ty1oatranvo ()trtmimpiudamt lieias  2taxm nt4opeoio3iasfsDrl(vo u4 exnxf to1lptr nvslt teurxrpoo1opt  nvil(  2raurpnu0tlen feiyt s2em( p (4aleomfctodlatean ol(0truoim3oydopte fvt t)arra(roou1alxo feias a rmnms;()tlxoxr3iydlmDraieo t) etmxm oy4llt  ivslt)aruaxmp;o0tpenmfeiasfs rmnmon(4alerif3iadfm eaieo;s)sexmxr iydlm elnvtat) Draur ou4aexnmo3tasfm2rmuvsnu4 lermociadopDelu o t t2um(m3oy4open nctat aDum(rp;t1oleoiicildlaDumu onu0 eeoif3iadlmDeauvo;s0 etrir3no1lmtnlivsat)sDraum nt4tpxo oetld s2elnvsnt0trtrif3iytlaD  ivo t0 2ur(r3iydop e fes tf rra(rpnu0aeeniociyt s umums u)tltnif3iotlpte n slt)texm(o iy4ame lfvslt)artm( p;t4alxomf3iysfm2ul(vs;u)arxnmo3oa1op  lies;(0t2toxm3oudapeemfetlt  ruaxmoot1aptnif3tatfm emu s;(0tlermr3oa1oa   uvo;t texo(m3oudapte iet ( sDurxrono0tet  oeias a2rl( s;(0trxoxfciodfp elieolt0 etoxm io1oltemfet ( a2tm(  no0tlenmfeiltla ulnvpnu0tetrxr3tatfmte n i t trxmxr3no4al emfetat)srtmxroou0tlxnmocildfaDeau onu0 lxnio iy1fmDeauei t0tetmxm3nu4lmt mfet sfa2tmum ou0tlxnio3ias sDum(mo;t) ltriocty1lpt  uvi t) 2xrimpou4olenlfcsl(fs2trumo;o0apeo o3iys s el(ms;(0altnmrcia1lmteauvsls)trxo(m3ny1ol   fesat  2rrump;o1tpeo fciyt sDrm(vsn(4texomf oadlmt livo;t)srtmir ou4apen nct ( srtr(mpot1oetnio3tatfm eaump t)tlerio3iodlptr i s (0 rxm(rpio1op nmnetat aDtrx pno4tpe if3tys m elnvpnu0 rtoiocoy1omDean o (0 rumxr3ou4om elicta( aDtmumoou1opeo i3tydlmDel(msnu)trenirciy1opt lnei ()srtrio3iy1ameemnesat) Drrxrooo1oeeomieiysla2umuvsnu)tleoir iadop rlnvo;(0 2xoxopny1aptelicsas)a2tm(r no0oetoiociltfs uluvsnu0tleomrctytfaD au s t0 etoxo3nudomtnmfctasfs2uaxro;t0alen i3ild m2rl( snt4aleoir iadlpte nvilt0t2xoir iy1lpenlneta() 2ur(ront4oeeniociadls ul(ms;(0tlxnmf3ta1oaDe uvo s0texoxr iy1lmtelnvilt)a2uau  ot4tltomi3ilslsDumnvsnt) lerxo oytlp rli s;( srxrxr3ou1lltelneta( aDua(rono1tptniictlsfs2uanvs t0tetnif ta1opDe neilt  exoim no4oleemfvtasf Drmur ;t4tptnmf3tldls em( s t) eeoir todfatr neol()teuoxrpoydaltnmicsa()artm(mooo0oex  i3tad a2eaums t0trtniocoy1oaDeanvi;(  2xrir3nodalenmneilsf 2ta(rono0alt  ietysfa em( o;u)trxomfctodoa r u o;s)texmio oy4lpee ieia(  2tmurpoo4ape mfeiysfaDumnms;t)aeenio3oy1oaD lu s;s t2urim3oudome lncia(f rua( poo0tlt mf3iysfs2umuvs ()arxnxf3ia1lpt anvi;(  etmim3no1olee fvta() 2uaxrpou1tlto ieiltlsDelumont4tlermo3tytopD au o t sex
\ No newline at end of file
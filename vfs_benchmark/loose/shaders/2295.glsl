@@ -0,0 +1 @@
+ies ( s2ur(opiy4lltelnvs ( a2ra(moou1texo octldfa2rm(mp;t0 lenxo totoaD  u slt0srum(m ou4al elnetls srur( o;t0oexomi3tltls2elu s (4aeerxfctydlmDrli ilt texo(m3nydal nlict (  2um(rono4altoiictlt a2rmn p;(4arerxf totla r nei;s tetrio nudllen nvi s  rrr(mp;t4tet mfctldfm rl( onu4trermo totoa eanvo (0s2ur(m iu4olenlfci t)a2uru ooo0opeo i3iat s ra( snt) lxoir3ia1oatranvs ( srxrio iydllte ivs tf rtaum oo0altoioetytfm rmuvp u0 lenxo3ootoptr n s;() rtmio3oy1lpe  nvia()srtrumpot4oex mo3iydlm raumpnu)trxrxr3ty1la ran ols trtoxo nydolenlfviltfaDua(r ot1oeeniicils m2rlu pn(0treoxocootoa e ies s trtm(rpou4ome mfct s)sruaum ot0apxomieiytfm2rlnvs;()tltnir ootomDeau o;s  rxrio oodoltnmicsat  rurx oou4tlxnifciytfaDuau on(0 exrmf oodfaD li slt  2xoimpiydolee neiasf Drmxronu0olen ociad sDrmumo;u4 eerxf3oo1fmD  n sl(0teurxo iu4optnmfviatf rta(  ou1tleomo3iytfs rlumpn(4 rtoxociydoa e uei t srtm(opio1ome mict (  Dum(mooo0tpe mfeildla2elums;u0teerio3tatom r nvo;s0 2to(mpnu4lm n fcta()sDra( pno1tpt iieiatlsDrlnmsnt0tlerir3iodfp  auvslt)seum(opiu1lltemfcia(  Dur(r ;o4tle mf3iyd s rluvpnu4alenmociotla raivo;(0trurio3nudamenlnetas)arrm( oot0teeomieias aDem( ont4tetrxf3oatlp elnesl(  2tr(rpoodalee neslsfsDrruronu1tlx  feilslaDrlnms t4artoifcia1op r ivslt0 2uoxmpou1ape  ivsa( a2taumpno1aexn iciysfaDeanms (0 rerio3oytop ean s;(  eum(r3nudole mivta() Drru  nu4tpx  f3ias a ulnvsn()trxomr ia1omDraivo ()srxrir iy1lp emietlt  Dumumo;u4aex  ietadfa rlums;(0 eerxo iytfatelnes t srxm(r nudopenmnct s)srum(rono0tpt  oetadls2eluvs;(4alxnxf iytoaD ai o;s) exo(r ou1lpe lncilt arua( o;u4texoif3iydls2emuvsnt)aetomr totfa rluvils  2toir3oudomtelieias)s2uaum nu4oexo oeiatlaDuanvon() lxoxocta1fpDe n i () exrim ny4ap emivtas sDtaxrono1tex iietyt s rlnmsnt0 ltoiocto1fm r uvs;()t2xmxopoy1lp  lfvt t  2rm( o;o1alx  i3ild mDemu p;t4altoiocoodlpDr nvi (  2toir3oo1opt lnvtas  2rmu  ;u4aeenmoeiys m uluvsnu0 lenmociy1lm  li sls s2xo(o3io1op n nvt t  2umur no4tpxnifetytlmDulnvsnt0areoxo3ta1fm raueslt  exr(r iodopt  ncs tfsDtm(ro;t1opxoii3tydfsDemn pnt4 exoxr iy1op r neol(  2tmiopiudaptelnvs s)arumurpoo1tex  ietydfsDeln o (4teenmocta1fa r uvi;s0t2uoir3ou1lm n nvta(f 2umu pou0alxomocildlm el(ms;(4aexnxo3oodoa rai s;t)s2to(r3no4lp   fcs tfartr(m oo1tetniieiydla rmu o u4arxoxfciydlpteanvs t)texr(rpiydale  fvtl( a2uau p;t4apxomiciltfm2uanmsn(4 ltrxocto1fpD lnvo;(0 rxrio oy1apee nvsls aDtrxm ;o0tltn iciat a ra(vsnu4treoifctodlaDr ivol(0 2uo(opiu1omee nvil( artru ono4ope  ieildfa uluvsnu4 lenir to1fmDrlnvslt0setoxmpiudlmte nvsa( sDrmxroou1ape  ictydlm ra(vp;u0 ltnmo3iy1fpt lu s ( srtm(m3io1om  lics (  2tm( pou0tex moeiyd a elumpnt)aexoircoa1fpt aivi t0 etr(o3iy1lm   nvt t srta(mpot0texn feiatfa rmu pnt4 lerxf io1lmDrlieslt texr(opnudoltemnesa(fs2trxm nt1tptnifctat s em(msn(4alenmr3ty1latrlnvs s0 2uoimpoy1lltnlnvslt a2rmu ono0tetnii3ilsfm2rlu p;()areoxf oa1om r ues ()s2xr(o oy4am e fcsls) 2rrxmpnt1opeo fetltla2elnmont0trtrir3oodop e ivs (  rtmxr iudlpe  fesas)sDtr(  nu1ole mocilsfs eanvo t4aexnxrcta1fp e n i;t0 exr(o3iydlleemieils) 2rax oot1olx mfeiad aDua(mp;u0aetrxr3iodla rlues s) etmxo ou1omt micsas  2rrxmp;o1tpe  ietasls umnmp t) renxr3iatfp raivols  2umxo iudaleemfeias sDtax o;u1open oeiyt s2rmnms;(0trxoirctytfa  li s;t0t2umxr nu1om nlfct (f rur( oou4tltoioctltls ra(ms;t)alenmr3oadom  lu i t0sruoim3iydlpte icils arum(r oo0teto fctltfm ea( o u0 exoir todfmt  nvo s0 2trxo3iodlpt lfesas) 2umxmpnt1opeomicildfaDra(vp t4 exomo iy1lmDranei;s)texmir3nudlltnmfvilt)s2ra(  ;t1tetomfcilsfa2emn s;(4arerir io1lp  auvi s)srtmio3oo1alen fetls)arumx pou4opxn ociysfm2emnvs u4arxnxf oo1fat luvil(0 rxr(m nudlp emfeil(f rrrxmooo0tptniictytla2ra(vpn(4 rtomocty1lp r ivo s0s2xmio oydame mfes t aDrmx onu1tltnioeildls eanmp;t4trermo ta1fptelnvols0trtmirpio1lmenmnctat) 2umxr ;u4opx ii3iltlaDum(mo;(4 ltomr iatoaDeaues s0 euo(m oodol emictl()sDrau pnt0tpeo octatfm rmumpnt0tltomf3oy1lmt  nvols)t2trir iu1olte ncs (f rrrxrpnu0opeomi3iad sDrluvs;u0teeoxo iotoaD  u o ( srurxmpiodapt lfvs sf 2tmxmpoo1oexomfciydfs2umump (0aexrmfcootlptrauvi (0t2xmimpoudapenmnvi sfartm(mpnu4tee  fctad a2el( pn(4 eerifctatop e n o s  rur(r nu1ll  liei (  rrrxr oo4olx iictys s rau sn()artrmr3ta1laDrlivo s)trxoir3oydlp   iviat) 2trx  no0aptniictls a ran pnt4arerxr iatoaDelivolt) 2urxo oy1llt mnciatfsDrax o;u0tetnmfeilt m ul( p () lenxf3oy1lpt anvslt0texrxm nu4lp n net t) 2urx onu0tleoiiciyt s elu on()trtrmf oydfa eanvslt  rxmir nu1ameemfvt t)artrx  ;o1apenmfctytfmDumump;t4aexomo oatlpDrauvi;(  etoxm ny1al e fesls)s2trurp;t4aetomfciydla emumo;(0alenmf iatlmD  n s;(0 exrim3ny4ol nlfct ()a2tmxmp;u4olxoio3ilsla ea( p;u4tetomo totoaDr nvi t texmxm3oudamt lfvias aDrrx pnt0oexnmiciasfmDra(vp (4alenirciotfptranvi t  2tmio3iy4lmeelivtls) 2rrxro;t0tee ioeiytfsDea( ont4teerif3tatomDr nvi ()s2xoxm3nodlmtelfviltfaDumxm ;o0tlxn f3iltlm2ulumo;t0aexoif ia1lmteln s;s trto(o3iydlltelfetls) 2ua(rpot4olxnmoeiys a2rauvp () rerifcta1fatrln s;s0texm(r oodllenmietas)sDrmxmo;o0tlxnmf3iytfsDum(mp;u0tlenxo oy1lp elu i s0setr(o3nu4ole  nvt t arrmx pno0tee  oeils m2emuvo;t) ltrmr oadfpt ln sls0 rtoxr no1lmeelncs ( s2umxmo;o4tle io3iyslsDuln p;t)areoxfciodfpDranvs;(0srtoimpoydop nmfciat)arum(  ;o0apx io3ias aDra(mp;()aexrmrcia1lmte n ols) 2uoxm iy4om  livi ( a2tru  nt1tleniociasfs2elu p u4aetnir tadoateanvsl()texm(rpoodol n nctlt) 2urx onu0olxn fciydfmDelnms (0teerircootlmDr i i;t0 eumxo oydomen nvi t a2ua(mo;u0tpxomfciad sDelums;t) lxnxr3ty1lpD au s;(0trumiopnu1alee fvi ()s2uaum nu0olxn octasla2umn pn(0tleomo oa1fpt aieils) ruoxrpno1lp  licias)a2uau p;u4texo o3tadfs2ulnvs;t0alxoxo oydlpDrluvil(0s2uo(mpiydom nlfcsatf rrmumont0teeoifciyd s uln s;(4aetnxocootomDr ues;s s2toxo iy1lp emfvsa()aDur(mpot0altn fetld s2rm(vsnt4 etnir ia1fptrlieilt trxmxm3nodameemfeiltfs2urxro;o4oex  iciasfaDra(mo;(0 eenxo iodoate i i t) 2xrxrpnudolee nvtas)a2trx  oo1tpenif3tltls2emuvo;(4 lenxocoydfp eln s;s)s2xoxm iodlm e ivt ( aDururpot4ole mo3tyt a2um(mo u4treoif iodoa ean s;t srurio io4amt mneta( artr(mooo0tee ioetatlm2ranvs;t0trxnio oodlmD  n i ()setm(r3iu1alt livt ()aDta(  no4tpx mo3taslaDuanms (0tlxnxf iatlm ean s s trxm(mpiudll emictatf Drr( pnt4oet mfeiaslsDel(mp u4 eenifciy1fm   nes s sexoim iu4op  micta( srtr(m nu4alxo i3tlt m2rauvs;(4aexnxo oatfa  anvol()s2xoxr3nu4lpte fvsa(f 2taur nu1oleniiciat m eaump t)treomo3io1om e nvs;(0 2umxm3oydlm   fvtasf 2umxrp;u4oltnmiciysfaDeau p;u4 lermo3todla e nvo;(0 exrio ou4omtnliei sf 2rmurpou1aptnmietlsfsDul(ms u4trtnir oodla   uvs;s0srtr(r3iodlmtemfctls s2rmxmpou1tex mfctasla2emumo;t0areomr3ty1omt luvsl( s2tmxrpny4am  lict t srumump;t0aetnif3iydls emnvo;t)treoxo3oo1fmDeluesls)seto(m3ny1ame lnctasf 2rr( ooo4tlxnii3ilslm2uauvo u) eermr3oodoa r uesls t2tm(o3oodal n fci t) Drmu ooo1opeoioeiysfm2rmn pn(4alenxr3oatoatelieo s  2urxmpoy4olenlfeilt a2trump;t0oltnmoeiyslm ra( snu) eeomrctadomtrauei;s seumxmpiu1aptn fcs t  rrr(m ou1texnii3iltfsDea(mp t0alxoxfciadomte u o t)s2uo(o ou1ap nmnctlt) Dtau o;t0olto iciadfmDrlnmsn(0tlxnxo3iadomte iei s)seto(r io4op   neia( aDum(rpno4altoifeiasla elnmpnu) reomfcty1lm eaueo;s0 eto(r iy4alen fcs t  2rm( pot1oexo ieiadls2eluvs;t0 lenxo3tadfptr n ol(  rxrir iu1aleemfcsas)sDumxr ;u4alxomo3iasfa uau pnu) etrio iydfa rluesl(0 rumir3iu4op emivtat)aDtm( o;u0oeto ociydfa2rl( pnu)arenxociatoaD luvil()s2tm(opnu1optn fvsa(farraum ;o1apeo oeils sDulnvo;u0trtnxfcoodopDelivi (0t2xm(mpnu1lmtemietas) ruaurp;o4ale  icild mDul(vo;u) rxomfcoa1fpte u ilt0 exmio3nodaltemfesa()aDrmx o;t4tltniociydla2ulnvon()trtnxr ia1late ies;s  rtoirpno1op nmiviat srrr(m ;o1alenmi3iasfm uanvo u)artrmfcto1opDe n i ()s2umxm iydal  mnvs s)a2uax o;u1tex mi3tysfa2ua(mp;t)arenmr iydomte i olt0 exrim no4llee fct t  2ta(rp;u4ape if3iytfa2raums (4arxomrciydfmDrlivols)s2urxm3oodllt lietls)s2rmuro;u4olenifcildfmDumn ont4 eenio iytlp r nes;t)trtrxo no4optn nvi t  2tmx ooo0aeeniiciatla2rm( pnt)teenmfcto1op  livsl(0trxm(rpiydomtn iet ()artm( oou1tptoifeiytls eau s (4 lxnmo3iytfpt li i s0tetrio oo4llt mnctlt sDumxm nu0opeo o3tytfmDra(mp;t4 etnxrctadla eauei ( setm(rpoy1amte iciasfs2ua(  nt4tex mfcils a2ra(mp;t0 leoif oa1omt ai o;t trxm(o nudope lnvta( a2ua(roou4optnif3tat mDel(vpnt0alxnxfcio1opte ivo t)teum(o oy4llenlncia(fsrrm(rpoo0oeeoiietlslm ua(vo u)aetrmoctadom rauei;t0trtoiopou4lp emics s  Dra(rpoo0oltnmfciadla2um(ms;u4 etoxf3tydfp raiei ( trtmxrpnu1apte icsas) Draxmpou1apenioetatlm emn snu4 rtoir3tadoatrluvo () rxmio3iudom elivtl( sDtmxmpno4tlx ii3taslm uluvpnt)tlenmf todfaDr u o s0trxm(o3no4alen iesltf Dtmu  no0alx  ieiltfaDrm(vo;(0 exrio tatfp eai s t0srtoir oy4om n nvi t) ruax p;t0aleo fctatls2rmn o;t0aleoirctytlpt ai i s0teur(r3iu4ol   nct ()aDrmuronu0oleoifctatfs2ranmpnu) eerxr3iatlmD ln ils0trxm(r iudal  mncsl(faDua( o;t0optoiociltlmDemuvpnu0texrxo iatfmDeaieo s) 2toxr ou4lltelnvtas) 2rr( o;o1oex  oeiys a ua(von(4trtnmocoydfptr iesls0sruoxr3iodap   fvslt)srraxm no0tltomoctaslaDulu s t0aexnmfcoadfmtelnes s srumim iudaptn fvtls artau pot0tetomiciytfa2ranmo u) exomfcoa1optr uvsl()sexmxr iy1ol   fetl(farrr(rpnu0apt mf3tyd a rlu p;t4trermo ootfm   n i;( t2uoio3ny4openmicsa(f 2raxmpnt0olt io3ils a rmnms;u4 rtoxo3todomtelivolt tetmir ou4om e fetasfa2uax  nt4aptomoeias m umuvpnt4texomr oatfatr i sls)s2tmxmpiu1al nmfeilt)sDur( ont4tee mo3iltfm ua(ms t0trtrmociotom r ieils trtr(rpnu4om  licslsfsDtr( oot1tee mocilslm ean pn(4tlxoif oodlaDrau slt s2xrxr nydlmt  ivi () Dumx oou4tet  feilt a ua( sn(0 rxrxoctydlmtraues;() rur(opoy1lp e ivtls) rur(mono4olxnii3iasfaDrm( pnt4artnirctydlmDrlnvi;s)s2xmimpoo1amtnmnvi ()srrr( poo0alenmi3ilslaDrauvo u)arxomr tatlm eaneo;s0teumir ny1open feia(faDuax  ot0opxoio3tls s ul( o;t4trerxfcoadom  liei t)s2xmir no1ol elfciasfarraxmo;t0apenmocias m ea(ms t0aexoio ty1om  lnvsls)trurxr3iu1ol e ivtatf 2tau  ;o4optomf3iltlm ranmp t0arenmf3oy1opDeli sls0 2tm(m nydap nmneiat)srrrxmont0olt  oetltlsDrm(mpn(4 renxr oatlatraivilt)t2uoir io4amte ivi s s2rm(r no4ape mfciysfsDem(vs;t)trerif iatlpte ies;s0 2xoir iodlpee feta()srumxmpot1tpxoiietld s2rlu s;u)aexomr3iadlpt aivo s)s2toxm ou1al e fetl()arra( pnu0oet iiciydlm rmnmpn()artniocto1fpteai slt0 eumxo3iudlmee fctatfa2tmur ot0ale ifctyd m2emnvpnt4alxnxrciy1lpDr ues;t) 2xr(opiu4lmenmfet t) 2rr(r ;t4alxoii3iyd mDelump;t)tlxomocoodomDr ivi;s)s2toim iu4ap  liet t  2ra(moou1aeen ieiydfa2ua(vp;u4tltnifctodom  lues s0 rtoxopiydlmtn nvia(faDrmu  ;u1aptnmo3iat m umumo;u0tlxomf3totfatelu i t)setm(mpio4apeemnvt ()srrrurpno0tltn ociytlm2ua( snt0trtoir tadla ranvol()s2xr(r oo4amtn fvsl(fa2rauroot1alxo ietls a umnvsn(4aexoxf oa1om eluei;s0 rxoio3oudolt  iesa( srta(m oo1tptnmictldla ran o;u4aeerxociotoa r ieol( seum(o iodol  livt tfsDrrx pnu1alxo icias m2rmuvo u4teerif3oadfmDeaivol() etrxopiudome mneiatfa2tr(m nu4apx  i3ildfmDul( s (0tetnircoatopt lnvs;s0trxoxo iudap  mietls a2ur(mpoo4optnmociat s rm( p;u0 lxomr ia1fa rau s;t texo(m iy1lm  mnesl(fsrtrxr nu4oee mieilslmDrl(msn(0aeenmo oadlat  iesl(0 rtrir iodal emfetas) Duauronu0openif3iyt m2raump;t)alxrif iatlp eau s t t2uoir iy1om nlici ( arumxmoot1oeen ociatlsDul(vp;t)trxrxr iodlpt  nvol()teuoim iudame lici ( srrax ont4alx ioeils s rm(vonu0 lenmfcto1fpDr ueilt  eurim ny1olt mieia() 2rru o;u4teeo oeild sDulumpnt)tlxnmrciytoaD  neilt trtriopoodllt  fvta()aDtaum ;u4alxnmictyt a um(vo;t4trtnxo iy1faD  uvs () 2tmir oy1amt mfvtas s2umuronu4texo oeiatla2umn onu0 rerif3oatfaDeaivil()srxrir nudapee nci (  rtrurpot0ale ii3iadls em(mo (4arxrxf3oydla rluvils srtm(m io1omt livi (f rtaxrpou4aptn ietatfa rl( o;u0tlxrmo3iadlp raieols0t2uo(mpnu4lltelnetlt)sDtrxmooo1oeen ociysfmDelnvs;u4aleomfcio1latr n i t  2umirpiu1lpt lieiatfsrurx onu0aex mo3tytlsDra(mp;(0 etoir3iotlpDrai i;s sexoirpou4omenlnes tfa2trur ;t0opxn oeiat a el(msnu4 rerioctatfat  n olt0seur(o3nydll nmfcslsfa2ta( o;t1alxo feias s ea( s;u) ltrmr3tydlpt  ivo;()s2to(m no1oleemnctat)aDrrx o;u4optnmoeiad a2umn on() exnxf3iodlmte ueol(  2trxrpoodal  mics (f rrmxr nu4tlx mfeiydfmDrm(ms;t0 lxrmoctydlp  anei;()teumir oudol nlietat)a2um(mooo4ope iietydlm um(vsnu)teerir3iydfp eai i;() etr(r3oodlme mnvsl()srua(mpnu4alxnioetltls ua(mo;() ltrirciydom rln sl()t2uo(m oo1olenlnci sfaDrm(m ot4aet  ocild aDrmump;t)tltnmocoo1fpDrlueo (  etrir iu1oltnlici t)sDrau  ;u0openif3tas a2ua(ms (4altrxo totopte ieilt)t2uoim ou1ll nlfcs t s2rmumpoo4aexnmictytla2emu snt)texoio totlpDelivo;s trumir nu1ap elivt s)a2umx p;u1apxoii3ilsla2rm(mp;(0altnio3oytlm  aueolt)srxo(m3nydal   neia()s2rmx p;u0opxn oetadls2emump (4trtrxociytlpte nvs () 2tmim3oodom  mnetls)aDuaxrooo1tet mi3tys sDeaumo;u)aeerxr oodfpDelu o t)trxoirpny4ame  fetatf 2rm(rp;t0teeoifciytfs um(vp u)tltrmrcoo1fm r neol()tetriopio4alt mivsl(fs2rmxrooo0oeen i3iasfm2el(msnu4 lerir oodfmtranvi;t0s2uoirpoudomenmnctlt sDrmumo;o0oleomfetldlm2elu o;(4trxoir3oytlmDeluvi;s0t2to(o3io4lmen nvtas aDtr(mp;u0texomietys s2rmu p;t)areoxr3oydomD auesl() etm(m ou1optn nvtas  2um(mpnt0tpx  ieiysfm ua( p t4tltrmrcty1omDean o;s0 2tmxo oodalt  netas)srtrumoot1tetn i3tydla umu s;t0 exriocio1oateai o s teum(opiudllt  fctas) rrrur nu1alen oetytlm2uanmpnu0 eerio totfat au ilt  rurirpio1ale mnvta(f Drmxroot0aetomoeias sDuauvon(4texnir todlm rlnei t0sexr(r oo4apeemncta( aDuaump;t1aexomocils m2eanvonu)texrxf iatomD an o s0texoxo oo1ll  lict tf rrauro;o4oltnioeiasfs uln p t0 lxoxr3oydopDrlnvsl(0s2xoxr3oodap nmfvilt  Dtau  ou1apxomf3tltfa2rm(vs;u0aeeomr oatlmD  u olt0 rxmxrpiy4amenlnvtasfsrua( o;u4aetnifciasfm raump u4alxriociydla elivolt trur(mpnydllte nesas  2trxmpoo4oleomoeiydfs2umn p;t) ltrxf todfaD au olt0 rxm(r3oo1lltemncs t)artax p;o0opx mfctys a ul(vs (4 rxnmo3iotlp rliei t0trurio3io4lm emietlsfarrr(mpno4opeo ictat sDeau s t4trxnmfcoydfmtrau ols) exo(m3no4amee net s)a2rm( p;u0ale if3tltfa2ul( p t)texoxf3oo1faDelues s0trumxo3oodole lnct sfaruau pnu4apenmocildls2ulnmo;t) leomo totfatr uvs s  2tm(o oy1apte ictl() rrm(mo;t0tpt mo3ild s ul(mpnu)arxomrcoa1fm  ai sls  exo(o oydoptelfvtls s2rm(r no0aetoii3tatfm2el(vpnt0aeenir3oadop  lneilt) rxo(r nodllenmnct sfs2urur no4aet ifetatfs2uanmo;(0trtnxoctydlm elivs;s0 etoxrpiydlptemics s s2tmxmooo1opx ioctldfa2ra( o u4trtoxr to1fpt au i t)s2to(r3no1ap  lfvi t sDtmumpou1alenifetadla um(mo t4tetnxr3tytfat  iesls)trtoxrpio1olenmiet s  2tmxmo;u4olt  fciltfmDua(ms;(4aeenircoo1la  luvi;s0s2xm(r3oy1am e ieiatf rta(ro;u0olxnii3iadls rlu o;(4trenmo tytlateai ol(0srxmxo nodlleeliesa(f 2uru p;o4tlxoif3tadlmDrmu s t4tleomo oydfaD li i s0teuoir oo4ol e fvsls artrur ;o1tpe  ociaslmDelu p;u4 rxrxrcoydoaDeaueo;(0 2tr(m3iudaltn ivi () Drrxr ;o4olxnmiciyt sDulnvsn(0 etrmf iy1lpt  ivs t)t2xoxr iu4oltnlncsasfs2taxroot1oet  i3iyt sDea(vs t4 lxomf3oadop r ueil(0teuoxmpny1ome mietltfs2um(mp;o1apt  oetlt sDul(vo;t4altomo3io1lmDe nvs;t0t2toxr ou1lp nmiesltfsrtm(monu0aex  iciadfaDua(vo;u4 rerxf3tytlaDeau o t0seumxo io1om emnci t)s2raum ot0alen fctatlmDel( s ()arxrmr iatfaDrlueo s)setoimpio4omtemnct t)aruaxm ;o0tlxnifeiyt m2uan pnt0aetoio oatoatean ol( s2tr(o3ny4alt liet tfartmumonu4opx  fcildfmDul( snt0 leoxfcio1lmtr u s t srxoio3iodlptelncsas) rtaxmpno4oex moeiadfaDrl( snt0aeenmrcoy1fa   uvo;(  ruoxo3oudome lfvtls  2rru onu0olxomocias s2uau s;u0tlerio oodoaDeluvo s) rumir oudll e nvia()sDrm( ooo1aexn fciyd s uauvp;(0altnmf oo1faDe u ol(0srxoxo oo1ll  lfcias) Dumu  ;o0oexniieiasfmDul(vsn() renircta1oa r ueo s)s2to(o3oydop  lfesa()aDtau  oo0tlx mictadfs2uanvo (4 exrxr3oytoatelues s) 2to(o3oudlpt lietl( aDtrur ;o0oetoio3iasfa ua(vp ()tlerircoadfpD  ivo s)trtoxm no4am emfcia()arraur nt1altomi3tad a2rauvonu0trtrifcoytfp  aueo t0seurir3oy4lpenmfctls)aDua(ro;o1oeeoif3ils m eauvp u)tetrxfcio1fm  anei;t sruoir3oo4ame mivils)arrr(mpno1aee mfeiatlsDrm(monu0 ltrxf ia1fpDelueslt srtmim nu1opeelncias  Duaurpnu1tpxnii3ias s umnmpn()alenmr iotoa eanvs s tetrxr no4lme  neia() rurumooo4altnmieiadlsDeluvo t) rxrxrcoatomDe iei (0 rxrxmpou1lpeemiesas  Drr(roou4ape mocildlmDrl(mo t)tetomr oadlptelueo t0srtr(m3nodop  miviasfaDrr(  oo0tetoiietldlmDumu s () lxnmo iodfat livo;(0 2xoirpnydoltelfvi tf rraxro;o4teeomfeiytfs2emu s;(0texoir iadomt an o t)srxr(m3oudope  ivils) Dtaxmono4texo f3tat s rm(vp;u0arerifcta1fmtraivs (  rxm(o3iu4amte icsa()srtaxmpou4oltomfetldla2rm(vp;()teerxo3tadlptelneslt0 rxmio3iudolenmiesas) 2rrxm oo0opx  icild m2rmn p;t4 leoir oytfm r u olt0 eum(opnu1apt  ivt () 2tr(rp;t4oex ifciysfm ean s u0artrmfcoatla  lies;(0 2xo(m nu4lmen iet tfsDrmu  nu4aeto o3tas s2um(vs;u4altrxrciodoaD ai i s) rtoxmpoy1ap n ies (fs2uaur nt0tee ifctlslm eaumo;()teenxf3oydopt  u i t0 2xoiopnydomeemfet (faDrmx pnt0tlt mf3iasfmDulu ont0tleomociadoa eaueo t tetrxm3io1amtn nctltf 2ra(ro;u0apt mfeiytla raumpnu)tetoif iatla r i o s) rtrxm3ou1lle mfcsls  2rm(mo;o4optnio3ils sDel( o t0arxrif3iotfptraieo (0trtrio3io1al   feias artau p;u1optoioctlt s emnmo ()aeerxf iy1faDraues (  2xm(r3nydlltelfvtl( s2um( poo0aptnmi3tys a2rmumo (4tetoxrctytlm  livil( seumxmpny4alenmivslt  2ua( ont0oex moctasfm2rmn pnt0teenxrcia1om r u s;t)sexrxm oo4am  lfcta()sDumump;t1altomociaslaDum( p () rtnxr totfmDrlivs (0t2tmxm3iy4ol   netl( aDrru  nu0teeoif3iatfa rmu s;u0 ltnio ia1lpDraies;s  etoxr3oudlp e fcia( sDum( onu0apxoif3tldfmDuauvo;t0 ltomf3oatopt lu o s) exmxm iy4apenlfesas) rtm( pot1olxnmociadls uauvs;u) lerxf3io1la eli ols)srxm(opoydop e nesa()srum(root1oexoiietltlaDulnvo t4artnif todopD lneo t)seurio oy1lptnmiei ( a2tau pou1aet ifctytlsDum(mo () lxnir tatlp eanvs;t s2tmir nydale livilt)arrrxm ot4apen i3tadlm2um(msnt)tlxnmf3iytlm   ivol()srur(r3io4llte nvsa()sDtau o;t0tpeo oeilt m eln pnt4texomf3iytfmDrlueols)trtoxm oy4lm e nci tfsrrmxm oo0oet ifcildfsDeauvont0alxomr oy1lptelnvi;s)srxm(rpiu4lltnmfctlt arrr(rpno4oexn o3ild s2eau p t4trtnio3iydlaDe ies (  2xm(opiodomenmfesltfa2taxmo;t0alxoii3tldla emnvs u)alxoif to1fmtrluesl(0seto(rpou1olen ieslt  Draurpnu0oet mieiys sDuanmont4 reoxr3tydlpD aieslt0setrxo3no1ll nmfct tf 2rru ono0oex mi3ils mDea( p;t4 eeoxrctadoa  ai i;( t2xm(r ny4amte iesatfsDuru pou0olenmi3iyt a2emnmo t)arxrxo3tydfmDeln ol()t2tmxm no4alenmictat  2ua( poo1tlt  oeiltlsDraump () exrio oo1faDr iesls) 2xrxr3iudaltnmnvt s) rur(mo;o0teeomfctytfm emu pnu4alxnmr3iytfmDelnvs t0 2trxopny4alt mnvta(fa2um(mp;u4tlx  fciaslsDelump;u0 rxoircoa1fpte u ol( texmxmpiy1lmt liesatf 2rru ont0oetn ociadfs2rm(vp t4tetrxr3iatlmte uvo;s0t2umxopoodlmee icsas)artmxmoou1altomi3tyt m2ea(vpnu)tltomoctotfp rau o;s seum(rpiy1am  mfcs sf rurumonu0olenmi3taslaDelump t)arenif ty1lp  ai s () 2xoim3iy1al n ici ( s2uru oou4tex  i3iydlsDeluvp;t0 reomfciydopDe i sls0srxmimpio1altemieilt  2rrxro;t1olx  ictytla emuvpn()tltnif iydlp  lu s;t0sexoxmpnu1ap emnvsas srurxm nt4openifeildfs elnvpn(0 rxrirciadfmD auvs;(0srxoxrpiodamtnmnci (f rrru pot4opeomf3tldfs2umnvo ()alxnio3tatlm  aieo;t s2tr(rpny1lp emiesl( aruaum no4teeo f3tys m eauvo;t)tetnmo to1lpte uvsl()teum(r3nudamenlnet t)artaxmpno1opxomfciaslm el(ms;(4trxrxfcta1fpDranei;s)sexmxopny1omenmict s)a2ua(m nu1tpxomi3iydla2ulnmonu) lxrmfctatfa e ueilt0seuo(mpnu4open fei t sDtrumo;o0tlx iietlslmDean o;(4trtnmo iytlmDeai s;t0seum(mpiu1lme livtlt  Drrx p;u0tptn ictldlmDeanvont) lerxr todomtraivsl() rxmir3iu1omt mivta()s2tmu  ot1tlenio3tatfm uan on(4aetnio oatomtelu o;s0 rum(m3oo4amt lieilsfs2rr(m no0tltoifetys aDuanmsnu4 exniocoatoaDelneo;s0seur(r3ou1am e fesa()sruax pot4alx mfeiys a2elnvo;t0 etnmf to1lpt lneo;(  rtmir iu4lp   nctasf rtm( p;u0tpe  oeiydls2ul(ms;(4artoiocootlatraiei t0seuoim ny1ope lieiasfsrur(  nt1aexoii3iat m ul(mo t0artrif3oydlp   u s (0 exrio oy1lle  fvt sf Dtrur ou0tptoioeilslsDrluvo (0tlenxr3iydlmDrlues s  euo(opou1ape mnvslt)aDurx pno1tpenifeiyslm um(vo;t0trxrmrcto1opD lues;(  2xmxmpou1ap  lieta(  Durxr ot1olxo fetls mDea( s ()trxrmo3io1fa eauvo s)seuo(mpnudol nlneils aDtmxrpnt1tptoiieiadla2em(vo t)trtomf3todfm  lnvsls) exrxopio1lmtnmicias aDraurpou0alxo o3ils a uanmpnt4tleoioctatomt au i;t) 2xoio3nu4omteliciat) Dtr( o;o1tleo fciys a ul(vo;t)tetrif oodlp eaivs;s0 rtoxo no1amenlics t s2tmumo;u1alx ifetlsla2umnvs ()tleoio iadlmDeluei;s0t2ur(r3io1lm   nctasfa2urx onu0tetnifciatls2uluvo;u0tlxoxr3tydomDr neils0texm(r3ou4am  mivtls) Dum( p;t0tpx  feilsfm ulnvp u0 etrmfciatla r nvo;s0s2umio3ny1lmt lfeilt)srtr(rp;o4oleoioctysfs2rmu s t0 leoxr tadfa ran o t0 exm(m nodlle mnvslt)sDtr(mo;o4opt mi3tat a2ean o t4 exrxf iodfpt  uvslt0srxoir3iy4olenlfvi s sDrm(r ou0alxniocild m2rlu ont) ltoiocoy1fat  uvs;s0 rurir3ny1om emnvs t) Duax pnu4aeto oeiys s rmn snu4 rxnxf ty1lmteauei;s  exoirpoodop emnvs (fsDta(m no1oeeomfeiyd a2ua(ms u) eermf ty1omtelnvil()t2xo(r oy4omeemicilsfaDuru  nt1tleoioeiys m ua(mp;(4trxrxr3todlmte ivsls)trxrirpnudalenlnvsasf 2rr( ooo4alt  i3tatla2umump u) rxnio3oodlp  auei s)tetmxo3io1amenlfesl( artrxmooo1aexnifetadfaDean on()treomoctotfate n i;t)s2xr(r iu1ll nmnesls  rtaumpnu1apx miciyt aDrmump;t)alenxf iatfmD an i (0s2xmiopiydllee nciatfsDrr(rpno1ope mieiyt a2el( snu)tlxnxr oydopDran sls) rxrirpoydol   ivil(  2rm( oou4tptniictatfm2emu snu) lxnxoctadomD  uesls0 exoxr3oy1amt mietatf 2rrxroot4tleniociltfmDrlnmon()tltnxr oydlp rlivsls  etoimpiudolenmneias)sDrr(m nt0altnifeiydfm umuvpn(0artoxo oy1fptr n s s)teumxm3iu1ll elncia()arum(rp;t4aexo feiat aDeluvp t0teeoirctydlat anvi;(0 2toir oydlmee ieta()s2uaumpnt1tetnmociyd a2elnmpn(0 lerxr io1opDr ivs t0sexoxrpnu1ol  mfctlt sruaxrpot0olt micildfaDranvpn()teeomr3oydlptr ivo s0t2to(r oodapeelivs (f 2tmump;o0tleoiiciad s2elumo (4alxoxf io1lpt lu i;()t2toimpnu1ol  lict s)s2tax o;o0altomo3tldfaDumu s t0 eeomr3oytla r n o;s t2urxm3oodaptemneta()sDtrurono4aptoio3ilt s2uln p;u4arxnxo iy1lpDranes t  rxoir3iu1optnmicils)srrmxro;u1tpe  o3tadfs raump (0tetnxr3tytfpte i s;( seum(mpno1aptnmfesa(f 2raur ;o4ale iietlt s ulnvp u4teenif tatla elues;t trur(r iu4om nmfcia()a2tm(m ;t1tltn feias mDem(vo (4tlxoxo ty1oaD ln sls0 2xo(r3nudlmt  nvs t  rtru o;u1tlenmietadfm2ua(vo ()trxomr3ootoptr ies;s0teum(mpnudol nmfctas  Dtmx ooo0tpt iieiad m elnmo ()aexrmrciadop r nvs;(0 exm(r3no1lp elfvtl()aDrmuro;o4tpto i3ild a2um(von() eerxfcoadomD  i s;s)s2um(m oy1lmt mnvi sfs2ur( pnt4oexnif3tysla2ra(mp ()texnio3iy1omDrlnesls)trumxm3iy1ll nlivt s a2um( poo0apx moeilt a em(mpnt0aetoioctydoatr ivs ()srtoxrpiy4apeemnctltfsDrru  oo0opxoiiciadlm2um( p (4tlxrmo iatopt li o t0seurio3iudll nmncia(fsDtmumono4ope iociadfm2el(vont0 eenmo3tytlmD aueils)t2urxm3ou1lleemncias) Dta(m oo0aexo f3tyt a ranvs u0arxnifcoo1fpD lnes;s0 rxrio io1aptn nct t s2rrxro;t4oeeo i3iyt sDra(vo t)artrifcoo1oa e ueo;()texoio3iodome lnci sfa2ta(moot1olx mf3tadfmDranvont4 lenxrciadfpDe uvo;t)seto(r3ou4alt livslt)sDtm( pno4texomi3tytla ua(vpnu4 ltrmo3oatoat aivolt)srxmxo iy1omtemfes s)sDrauront0apeo fciasfaDrlums;()teerir tytlmDrlies s)t2toim iudam  lfetlt arurxm no4aeenmociysfa ra(mo t0aeerifciadfmDeau ol()t2xrir ou4am  mncsl( srur(mont4oleo ieiltfa eanmonu4teerxr tadlatrai ilt0 rto(m io4amtemfcias arur(roou4oeenifciadfs2ul( p (4 lxnxoctatfa r ieslt)trto(m3oy1ol nmict t  2ta(  oo4aeenif3iadfa2ul(vont4trxomr tadopDrlieolt0teur(o oy4aleelnvtls) 2rrurpnt1olxomi3tltlsDrm( onu0artrir3oydlmtr u i t) 2xoio3no4ll n nvtl(faDuauro;o4ole  octldfa uauvp u4 rtrmr tytlpt lieo;s0seuoxo nudapenmfvsat  2umxm ou0ope  ieilt s2elnms;u4trerxfctodopDrlnei;( sexoim3nodaleemfcs tfs2rm(mp;t0tlt io3ilsfa2rlnmpnu0 eerirctotoa   i o t0 2toxm io1lmtnlneia()s2umurpoo1optomiciysfs emu s;u)aexomo3oatop e ivi;s s2urim3ny1ale mnesatfaDtaxrp;o1tptnmi3ils m em(mon()tetnmr3iatomDe i o t  eurxmpoudlm elivi t aDrmurpnt0tetoioeiltfaDulumo;t4aexrif iydla  li olt) exr(rpnydam nlneia()aDtm(mpou0aptnifciatfa rmu p;t4altrif to1fmtrli o t0s2xmxm3nudamtelnvi sfaDtaxmpnu0oee  icilsla2um(mo u4tetoif3ootop rauvils0teumxo3ny1lm e ieta(  2tru  ot0apxn iciyd a el(msnu4aetomf ta1fm rlneslt0s2xm(mpiydom   ieil(  Dtrumo;t1oex iicildla ra(vs;(0arxomfcoadla e ieilt)texmxr3oo1ll nlivt ()arta(r ou0oet ifeiat mDem(msn() lxnmf3iydlaD livi;(0t2uoiopou4om  mncsasfarum(m nu1oleo oetytla rmu s;u0 ltoxo todlatr i i;( s2umxr3ou4amtnmivi (fsrtr(m oo0oleniietadlm2emuvon(0trxrxr ootfp elneolt0truoxo3ny4aptn icsat)arurxro;o1tet  fciaslm rl( o t)arermo3iotlaDran o;( teuoxo3io1lpt lfcil() Dua( ono4aet ioctls sDrl( s;t0 rtrmo to1op  luvs s t2umim iodlp n ictls)sruaurp;t1ale moeiyt m um(vp;t)texrmr3ty1fpDrlnvs s srtr(opoy1op  lfeta( srrr( o;u1opxnmfciytfs rmn pnt0aexomf tatoatr n o (0sexoxo oo4altnlnvi s arrmxro;t4oetomfctldfs2emumo u4aetoircty1lm eau sl(  rxm(o3iudope mfct ( artmx pno4optn iciasfs el(vo u)trxrmf3iadoa  ai s;t0s2xmir oodol  mivias a2tmxr nu0tlt  ictat s uauvpnt0tlxnir3iytfatranes;t0s2xmim3nudomtemneta()sDra( ooo0oeeo fctatla ranvsnt4arenxr3oa1lpteanvi;t) ruoir3oydomt  neslsfa2taxm no1tlxnii3tys a2ulumo;(0aetomf3oydoatraiesl( sruoxmpiy4olee nvs (  2rr(r ;o0optnifeiys s2em(vp u4arermo oo1faDe u s;() rurirpou1lm e ics s)aDrrurp;t4ope mo3tldfa rluvo;u4tleoxf3ta1omtrliei (0 euoir3iu4oleemiet t srraxmpnu1olt miciltlm2eanvs;(4 eenmo totoaD  ueo;()s2um(m iydlp   netasfsrumum ou4tptniictas m2eau s t0tetrmo3iydfat ln sls t2xmim3oodol  lfcia()srrm( pou4oleo f3tyd a uluvp t4trermf todlaDr nes;(0texmio oodop  miei ( s2tru ooo4aexo fctldfsDum( s (0trxnmoctydlaDeanvo;t) 2ur(rpny1ol emnvslsf Duaxrp;o1apxnmi3iltfmDrauvp;t)aexnxfciodfpDe uvs s0t2xr(m nodamte ivil( aDum(roou4opxnifeiasla ua(mpnt4aeeoir3totlptrai s;s)teuoxr3ny1amen nvs t s2uaxmono4tlxo ieiltfs2ua(mpnu)aeeoxr3iotlpD au o;s0setr(o3ou4om e fvils)aDtruront0opx iociat aDeaumo t)texrmr ootlp  auvols tetoiopoydop n fvslt)arta( o;o0alx ifcilsfm2ea(mpnu) lxrxo3ia1fateaneilt0truo(r nudllenlfvtat  2urumoou1altoii3iytlm2elu o;()treomrciytlaDrlnvo;s t2tmxm iy4apeelietl() rtmxmo;t4texniieias m2um(ms;u0arxnif3to1fmt aieo;t  rtmir3oodam   nvtls  rua(rp;t0aet mi3iaslaDelnvsnt) lxnmr3oa1lm raies;s) 2xmio3iu4altnlnvi t s2umxrpnt1optoifciyt s2elu o u)alxrmr3todfaD anvo s  exmxr3oudopee fetl( arrrur no4oexoiietatfsDeauvs;()tltnxf3oo1omD  nvs (0sexr(m oo1lpt  fesa( aDrmumono0tpto i3iaslm2um(mo;t4treoirciatfp e nei s  rumxrpnudalt mivia(fa2rmurp;t4apxo o3tat s2uan o (4 exnxrciydopDeauvo t s2xoxmpou1op e fvil(  2umxm oo0tlen oeiydfm rmnmo u) ltoir3ty1lp  lieols) rxmim iy1apee nei t)arurx  ot1tptn o3tyt mDea( p;(4areomr oytoat  nes;t0teurio3oy4al  lnvta()s2tmumpnu4oeenmi3ilsfm2elu s;u0aeenirciadom rliei;(  exrxmpoy4lle  fvsl()s2trxmonu1oexo iciydfm eau o;t0aetoxr oatoateaueil( trurxmpno1llt  fctl()aDrmx ooo0tlxo oeiysfsDea(vp;u0aetoircoy1fmte ivi t0 2xriopoo4lmenlfvia()artmum nu4oexo ocilsla ul(mo;t) leomf todfp elnesls)tetoim oydlm  lfes ()srtmumo;o1altoifeiys m2el(vp;(0aeeomf3ootom ranvs s) rtm(opio4alee iei t)sDrr( p;t1oetn f3iasls2emn p;t4tlerio3ia1opD anei s tetrir nu1aptemneil()s2trxroou4teeniiciat s rl(mo;t4arenif tydlmDrluvi;s)t2xo(r3iu4om e iviat s2raurono0tpenmfcilslmDrl(mo u4trtoir oodfmt luvs t0t2urirpiy4optelfvtl()s2ua(rpou1alxniictltfsDel(vpnt4aleoxo3ia1op   ivs;t0t2xrirpny1ole  fci t s2tau  ou4olt  oetldlsDrmu snu0 rtnmr3oy1fpDeanvs;t0 exoxr oodoptnlnetlsfarum(rpou0oeeoioetldlm2emnmpn()texnif3oo1opt lnes;(0t2uoimpno1lp elfvtat) 2rrurp;u4tpxnioeiaslmDul(vs u)alxrifcio1lmDranvs;t)trxoirpoudoptnlnvias arrau o;u4aex iociatlmDeauvp;()tlxrxo3oa1laDr nvo;t0t2trirpio4lpeelfvtlsf rrrurpou0oeen i3iatfm2elnvs;u0aeermf3io1fm  ln s;t srto(m3nodlp emicslt artru  nt1oet mictyt a2ulnvs u4aetoxf3oadom  lues ()sexmxrpnu4lpenlnviat)aDuaxmo;u1tlenif3iydlm2rlnms t0trenir ootomD  nvs;s trur(m ou1lltelfcsas)a2tauroot1tleomo3iytlaDrmuvsnu0 eenmfcoa1lm r uvolt0 exmir3oo4amtnmfvsl()arra(m ot0alxoifctys mDeau s (0 exnmfcto1lmteai s;()srtmxm3oudomtn ncsltf rumxm oo1tee  iciltla2el( o t0tlxomocoadfate i il(0trxm(opoo4ome licsl(f Drr(mono0teeoifeilsfmDrmuvont0aexnmociodfpD  i o;() exoimpno1ome mivta( s2rr(rp;t4texoioeiat a2umn o t0 etoir3iy1fatrln o (0trxm(rpiu1lmtnmictas aruax p;o0olt mocild m2emuvpnu4 rxrirctadlmtr ivolt)seumxo3oo1om n fvsl(  Dtruro;u0tetoioeiydfm rluvp (0alermr ty1fa rlnvs;s0t2xr(m oodal  lnct (f Drr( p;o0aet mo3ils aDumums u)texoxf to1lat  ivi;( teurxo ny1lptnmiciat a2ua(moot4optn i3iysfa elump;u0artnxf iy1oa e neils) 2toxr3ny4aptnmfvi t)srtrxmoou0oexomoctad s ul(vs u) reoifcio1fpt  n s;s0setoio3iudomtn nvslsfaDrr(  ou0oeto oeiyslaDrl( sn() lenmr tytoatraiesl() etmxr ny4apt mneta()a2raxro;u4oex  i3iad a el( o;(0 renmo3tytfa   ivsl( s2tr(r3no4ameemivsat a2tm(r oo4apxo o3iytfsDean o;t4trtrmr iodlm e u i (  rxrim ou4ol elivi (fartmurpot1oltomfciys s2eauvp;(4tetriociatlaDr i ol(  etoio no1ome  fvslt aDrmu oot4aex ii3ils m umnvont0tleoircootlmteauei s) etm(mpiydlm   fvtl()a2ua(mp;t1tlt ii3iysla elnvonu0artnmo3ia1om  luvi t s2toiopno4oltelivt t srtrumpno1tlt  ieiadlaDra( p u4treoir3totomt  neil()seumxr no1am  miei ()a2uauro;t1tleoifeiltlsDumn p;u4tlerxfciatfatraneo;s  2urim
\ No newline at end of file
@@ -0,0 +1 @@
+ueo;s0s2trxr oudlpt lnet (fsrrruro;t4olx ioetysfs eluvonu)tltnxocoydfmtrlnvi;t  eur(m3ou1ole  netat s2urx ont4alxnioetasfa2emnmpnt) rerir3oatlaDeluvo (0truoxr3iy4amenmfetat artaxr ;o0tltoio3iyslaDra(vo t)aetnxrctydlpt  nvils0 rxr(r nodolte icsat)srtmxr ;o0oleniiciat m uln on(0trxnxrciotomDe neo;( tetmio oudlm nlncia() 2ta(m ot0tlx ifcildfmDuan sn() eeoir3oatlm  auvs t trxrio3no1lmtnmnvs tfs2uaumont4oet iociadfmDranmsnu)artnmo oy1om   ivols) exmiopnu1optnmivtas)srtrxrpot4oexomociys aDum(mo;()trtoio tydoaD  nei s) exoio3iu1am  mfvs tf Drmu  ;t4oltnmiciad a uauvsnt4 exrxf iodfpD  ivi s)srxmio3nodlmenlivtatfarrr(mp;o0altn i3iasfa rlnmsnt4tlxoif ootom  lues ( tetr(m iu1ame  ictlsfaDtm(mo;u1tetnmo3ildls2rm(vpnu) lxnxoctytop rluvsl() etoxr nodome mivt ()a2urxr ;t1tee iiciysfs eau o;u4tltnifcoo1oatraueo t0 2toir3oo4ole lictasfsrurur ou4tleoioctat m ea(mp;(0 rxnmocoadopteanvi (0sexm(mpnydlmt lnes (fsrur(  ;t4teenmfciat aDem(mp (0 eenxr3oydomDeauvo t0srumxm3oo1llte icsl(fsrraxr ;u4tetn ictytla rm(vo t4areoxrctydomD aiei s)t2uo(m nudomt lncils) rrrur ;u4aexnioeiydlsDemu pn(0arxrmf totlat auvo;(0texoim oydal emfvslt)srumu pot0apxomi3tls m2rm(vo u4altrmfciatfa raies;s)trtrxo nydllte fesls a2uau pnt0teto oeiltla2ea( p;u0 leoxfcia1fat aivi;s  eumxo3io4opte nvt ( aDrr(r nt4tetoif3tatfmDul(msnt0artoio tatfmDeaivs s)s2tmxrpio1lleemncsl() rtmx o;u4tpxn fcildfaDua(msnt) rxoxr3iytfa rlnes;s)seumimpnu4lpen iet t)s2taxmpnu1oetomoctlt m2rauvs u0altrxrcoy1fpDeluvi s s2tm(o3iydole mfesasf rtaumo;t4olxn i3iasfs2elnvo;() ltnirciadfaDrlieolt)trxrio iodolt  ivsa(fsruru p;t1tptomfciyt a ranvs u4tlxrir3totlaDeluvo;s)s2urxo3oy4am   neilsfaDua(rpnt1tpe  iciytlaDrm(monu) renmr io1oaDe ieilt  2to(m nu1llt  ici t  rrmxmp;u1tlto f3iyd m2ua(ms t0tltrio3iatlaDr uvsl()trtrxo3iodap  livsltf 2ur(rp;t1tlxoioeiatlmDemu p;(4trxoifcootom ranvsls s2toim io4apt  ietl(fs2um(roou4opx ifciyd aDrl(ms;()trxrmo3oadfmDran il( s2ur(m3nudamtnliesa()a2rm(ronu0olen iciadfaDuln o (4 lxrxo tadlatrli i t t2toirpoy1lmt lneta(f Drmxr ;t0optoiicilsfm ul( o;t4tlxnio3tadfpt  neils texo(o3ou4lme  neia()srurumoou1aetoiietadlsDuan p (0trxrxfcio1laDeluvs;(0setrir3ou1om emies s)sDumx  nt1apenmf3iadls2ul(mp (4texoif to1fm elnvo t) eumirpoy1lpteliei t)s2um(rooo1tlxn feiydlm um(vs u)aexnmfciodlpD anvs t) exrirpnudaleelfcslt)a2rrx pnu4alxomf3iadfm ulnvo;() eeoir3io1oaD lies;t texmir nydlmtn fvsatfaDur(roou1alxnii3iysfs ul( s;()aleomf3tatla e ivo;s sruoim ny1lp   icias s2umxr ;u1aetn ictad sDuanmon(0tleomo3ty1lmte i ol( t2tmim3iu4amt  nctltf rtmx oot0oltomo3iatls2elumsnu4 etrxr iatlatr ieo ()sexoxm iy4aleemncsas)srua( o;t1oet mo3tat a rlnvon(0 eerxrcoa1opDe u i;s0 rxoxrpiy1lpenlnes t sDur(rp;t0alxnmo3iatlm ean s u4tltrio3tydlmtrlneslt0 2umxr3oudol n fct t) Drm(r ou4opxn oeiydla rlnmo t0 exnxrctadopt lneils0t2tm(r3iodaptnmictl(f rtaum oo4aexnii3ilt s rlu pnt) eenmr3iy1faD  n il()t2xriopiydam   nvil(faDtmx pou4opxniietad mDum( o u)tetoxf3ty1omDr u o t)seto(rpny4ale mnvta( sDrm( ono1opxnmicias s2rm(ms;t4aetrir3ta1lmtraivo;t srumxm no4aleelncsls aDuau  oo0olto oetytfa emu onu0aexoircoydfm e ieslt)sexo(o3ou1ale liviat  rtr(  nt4oexoif3ild aDeaums;t0teeomfciatoptr ies;( setoimpio1lm e nvi tfsrtaumpot4aleoii3tadfsDelu p (4aleoxfcio1faDe n slt teumxopny4lm elfei t a2uau o;t1opt iictld mDelumpnt4 lenmo3tydfptrai o;(0t2xoxr oy1aptnlfctltfarra(  nu1olenioetlt a2rlnvpnt4texnio oatfaDr nvil( s2xmxo3oy1ol  miei t)sDtaxm nu4alen fcildfs em( pnu0arenxf oydlmDe ivilt)teurxr ou4lmenlieslt)sDtru p;t1tle mo3iatfsDrm( p;(0aetnmrcoytomtr ueo s  etrxmpio1lpte nvt t)s2umurpou4apenioctasfaDum( o;() lxnxr tadfp   ueo ()t2toim3ny1ol elfet s)s2tmur ;u1aexnmietldla2umnmsnt0alxoif iotomtelnes;t0t2to(m oydamtnlfeil( arra( ooo1tex  f3tlsfs emu s t0tetrmr3tadom elivs;( teumir no4olt  ivi s) rtmxro;t4aexoio3iydfmDrmn pnt0tlxnif to1oaDrlu il()seumxo3iy1lpt lfcsls) 2um(m ;o4alxn i3tyt s emnvp;t) reomf oatfmt ln i (  exmio3iudlp nmieilsf Dtr(root4tpxo ietysla uanvs;t)teeoiocootoaD auei;s0s2xm(opoodll n neiasfaDraxr ou1alxo ictyd a uanms;(0 ltrio3tadlpDeli o;s)teuoir3oodapeemnvi (f rua(m ;t1olxoiictatfm ean pn(4arxoir iytlaD anvslt0srurio iu1opt lfctlsf 2ta( onu1alt  o3tatlaDrluvo;t0tlxnxr iatoaDelueol(  2tr(o oo4ol e iesa( sDta(ronu0texnmo3ildlsDea(vpnu) rxnifcoytomDeaieo;s t2xmirpoo1lp e icsl(f Dumurpnt1tptnmfciltla2rlnmsn() lxnxf3todom rlieols0teto(r3iu1aptnmfctl()artr(mpot1opeo feiadlm2rlnvs ()texnmociy1opte nvi s t2uoir3io1lltelncs s)aDta(mo;u4tlxn i3ildla ea( onu4texnxr3oadfmDean o s srxr(rpnodale mnet t) 2tmuroou4tlen fciatlmDra(vo (0 rtrio oytopD lneo;t)t2uo(mpiodalt  neils) 2trumo;u0alt  fciadfa2umn snu4arxrmo tatla eln s s  rto(m3iu1ll  lfvt s)a2ra(r ot0olt mo3tldfs2uau s t4aexoif3oytom r u sl()trtmxopiodal  miet (f rta(  nu4aee moeiatla2rm( s t0 ltomo3ootomDr nei;()t2to(mpoy4ole lnctls)a2tmx pot4olt  ocild mDrmnvs;u4arxrxfctytoptraivolt trumxr nydap e ivs (fs2tax oot0openiieils m2umn o t4altrircoo1omDranvi s0s2trimpou4ap   ivs tfsDtrumo;t4oeeo fctytlsDrmn p;t)artoifcto1lpteauvsls)sruoim3ou4aptemivs (fsrrr(ront4tpeoioeiys a rluvo;(0tlxrmr iotfptrlnes t  2to(m nu1amtn iesat s2raumonu4olxo oeiaslmDrmu p;()tlxnxrctodopt  i ils t2uo(opno4lp e netltfsruax  no1aptoiieiyt a eln o (4 exomr oo1faDeaneolt)teurio iodap emiei sf Duauro;o0tex  o3iad a2rluvo;u4 rerxoctytomDr uvo;( t2tmxo3iudomt mnctlsfsruaxmp;t0tlxnmfeils m2uanmo;u) renxf todfpDraies;t  etoir ou1lle  ivt t)s2ra( oou1ole  fciyslm el(mo;()aeeoxocoodop e u o () exr(m3nu4lpeemiciat s2urumpnt4apx if3iydfa2eanmp u0aetnmf oy1lmteaieolt)seto(opio1ole mfvt (faDrrxrooo0olto o3tatlm2em(monu0tltrxfciydfaD  i o ( t2xr(r oodll elneia(fsrrrxrp;o0tpt miciaslmDra(mp;t4artnxr ia1lmDrauvo;( t2toim3iodlm n ies () rtax pou1aexo ocild s2rlnmonu)tlenif3totfp r nvo s)tetrxo ou4olen fvsat)sDrrumo;o0optnmfeiat a2umn p u0teeoxf3ta1lm  aivs s)t2ur(m3oodlpenlnctl()arta(rpot1oetomi3iatfa2ran o u0arxrio oydop r i slt  2um(o oy4ap   ieilt  2uaur no1aetn ociytls2ra( snt) eeoxr iatlatelneils)texr(rpno4amteliesat)sDtmuro;u1tle  o3tadlaDuaumo (0arxrxr3oatomteaieils  rurio iu4op nmfesat s2rm(  no0oltomieiytlm eanmo t) lxomfciatfatrli sls s2xm(m3oudapen fvsa( srtmx  ;o4tptnii3iat mDelnvp;u0tlxrmo3ty1la rai i t0seurxo3iydom nmivtls) 2ra(r ;u4alt  ietysfm2um(vsn()treomf3iy1fmD aneilt0 exm(rpny1ol  lfct s  rra(  ;t0apxnif3tyd sDeanms u) rermf3tytfa  aivs;t  rtoim3oydal  lnetl()aDtrxr ;o4ope iieiasls eluvonu)trtoir iadlat aueo t t2umirpiu4ll  micslt)sDrm(mp;u0opt ifciys aDulnvsn(0trxnio3ta1lp elnvi;s trurim3oy4omeelieils  2rm(mooo0tlxo fciadla2rm( o;t0 renxrctytlp elnes;s0setoimpoy1op emfcsl(f rtmxm no1opxomfeiys sDel( s ()alxrif3totfpDrai sls0t2tmxmpoy4aptnmfci (  2urumoou1tlt  i3iytls elumsnt)arenxr iy1oaD li s s)srumirpnydale  nvtat)sDta(moou0opxo oeild sDumnvs (4 lxrmo3tydlp rlueslt  2xoxo iy1lle licsasfa2rm(rpot0tee  icias s2eln sn(4texrifciotlp e n i t0trxmxmpny4lm   nvsas)srra(m nu4ape miciytlaDumnmo;u)trerifcio1lmD lnvo;s) rtoim io4ll emicsa()a2tr(rpou0aex mo3iltlmDul(mo t4aexoxfcootfa rlu o;(  2to(rpiudam elnei tfs2tmxmpnt0ope  o3iydfs rm(von(0 exniocta1la  aieil()seumxrpoy1ll   icilsfs2ur(r oo0tleo fcils sDem( p;() etomo ia1omtean olt  rxoir nu4lp emfviatf Duaxr ;t0apxnioetltla2rau sn(0 eenmo3tytoatean o;t)s2urim ny1aptnlnciasfaDuau onu0ale  iciltlm emnvo t) exrif3iadlmDrau o;s) 2xmxo iydlpee fvi t  rumxmpou0oex mfcils sDum(vo;u4 exnmrciydlaDran ilt)trum(r oo4amte nvsl()artm( pnt0aet  f3tldlaDemnmpn() rtnxrcty1fmt  ueils0t2xmiopny4omt lncias  Drmur nt4oex mfeiasfa rlnmp;u)arxrxo oatoaD aiei;(0trtr(m3io4apt  ict tfsDtruro;t4oeen ociltlmDranmpn()trtnifcoodlm  lu sl() ruoxopiy1apenlietat)aDrru o;o1ale iieils s umuvo;u)tlenxf3oodla rln o s  eum(m io4om emfviatfsDrrx ono0ope io3tltlmDrl(monu0 renmociotfaDe nvil( seurir3iy4olte fctl()aDta( o;u1aee iocildfsDrmumon() eenmf oatla  lnvs (  euo(m3iy4alenlfcs tf 2rrurp;t1texnii3tatfaDum(mp t0altnxr3iatfaDr iei;t)t2uo(opiy4lmtnlncsltfarrrxront1olxoif3iadfaDeanmsnt0trenxo3iytoa eaivo t s2urio3oo1al e fesat)sDrmuront0opxn ocild m rlnms;t)teeomrcto1latrln o s) etm(o3ou4ome  ici tfsrtrur ;t4teeomfctld a2eauvo;t)texnxocoytomt  u s;( trxoxo3oy4opt miet ()artm(roou4ale  fciltla uanvs;u0 rtoiocia1fate ueol()t2tm(opnu1ol  lncs tfartruro;u1tpxnmfciytlm emumsnu)alermr3ootlpDeln o s  rtm(m3iy1aleemfvs () rur(monu4oexomieiat m eanmo t)altrxf ootfpte n o;s0s2urxm3io1lp emnesa(f rurumpno0tptniiciltfa eaums;(4 lenxf3tadoatr ieols  eum(r3oudop n feta() 2raxr ;t1tpx ifciytfa eanvs;t)trtrircia1la e uvi;t s2xoim3io1lptnlicslt)s2ua(mpno4olxniieiyd sDrl( onu4 rtrifctadfatrau o s0trtrio nydop elncsat sDuru  nu4aee  fetydlaDum(vs t)aeeomociydlm   ueils)srtmxr3nydoltnmiciltf rtmu poo4oltomo3iysfsDelu s t)trtoir tydoaDe nesl() 2xr(o3io1lptemietat  2rm( oot0alt  fctlslaDrln o;u4areomfcia1lmDelneo (0texmxo3oodal  mietat) Drrxro;u0teenmf3taslmDraums u4tetomo io1fmt au s t  rto(opoydll   fetat s2rau  nu4oeen o3tatlsDemnvsn(4 rxnmr ty1lp rlneil(0srxoxrpoo1opt mncils arrrxrp;t1alxoif3iad m rlump u)arxrif3iotfp e nvo;t0trur(m nu1altn ieslt s2tm( o;t4alx io3ilsfm el( pnt4altnmrcty1fa rln s (0seuo(r oy1lpe  nes t)s2raxro;u1oltnmo3tyd a emu p u0tltnmo ootfp raues t0trur(m nudapenlnvi t) 2ur( pnu0tlx mfeiltlmDeaumsnu4treriociytoaDr uvsl() 2xmxm3iu4lme lnesas)sDtrum no1tptnmf3tad m um(vpnu4 rxomrcootfpt auvo;s texm(r3nudll  mfvtlt  rtmxrpnt1aetnmoeiad m elnvp t0 lenxo3oadlmD  u s;s)s2umimpio1olt  nvia() ruaxmpot0oetn ictltlm ulu p t0 rtrmrciytlpDrluvs t s2umxo3oudlm nmfctlt s2rau ooo4openiietatls2ul(mo;(0 reoiociytfaDrliesl(  2tmxo3io4ol   nvias aDra(mpnt0olx micils a2um( snt)altomfciydlpDrlivil(0 2xmim iodapenlnei (faDtmu p;o1aeenmo3tad sDemnvont0trtrxr ootop  au sls  rurxo3oydll emivs sfartm(mp;o0altoii3tad m ua(vo;(0 exrxocty1fp  lieils0teumir oudopenmnvt s)aDrm(m ou1tpt io3iat m elnvonu0tetrxo totla eanvi;s  eurir3io1op n ncsl()a2ur(rpno4olxo fcild s ean snt4 eerxf3iadlpte uvslt)sexrxm oo4ap   nesa()a2uau p;o1oltomo3ilsfs2rmuvpn() ltrif3oo1laDranvs t  eumirpoy1lm e nvslt)aruaxm ;u1aleo oetlsfs2ra(ms (4 rxnif oodlatrau il( s2xo(opio4ll n ivia(  rrru o;t1teenifeiysfaDulnms;(0 exrxo io1om rlneo (0seuo(o3iy4apee ieiat  Duauroot0tlxnii3iytfs umuvs (0texoxrciatopDeau slt t2xo(o iu4lp emnet tfaDrax  ou4altnmi3tls mDrlu s (4trenir3ia1fmD  u o;s0t2urir3oy1alt lfes t) Drrurp;u4olxnii3ild m um( pnu) etrxr oytfmD  ues s)tetoir oudamt liei s)srraump;t0ale  oeiltfs2rln o;t0 rtomf3io1fmD aneo t) rtoim io1aptemfetltfs2rmu  nt1apenmociys aDrmnmp;() lenif3tydoa  an s;t) 2urim ny4lm emieil( srur(monu4tet iieiyslm umnmp t4arxoxoctatopDelnes;(  rxmxm nodal   fvs s aDtau ono4oexo ictytls ea(mp u) eeoxo3iodlp r nvslt0 etrxrpoudomen nvt t arrrumpoo4tlxomfctys aDrmnms t)trxnio3iatoat  neils s2toim3oodamte ivtatf 2tr( o;u4tpe  f3iatfa2eanmont)tlxrmociy1la eln s ( seto(r3iy1aleelfeiat srum(m ;t4olxnifeildfaDuaumpn() rermrctatomD an s t trumirpnodlpt  fct ( srrruroou0tpxnmo3iadls2umums (0 eenmo3iydfmt lnes s) eumxmpiu1oltemneils s2tr(m oo1aeeoio3tat aDeaums t4aetrmfcty1oat lnes;t  rtoxm3oy4lp emfctls  2rmur nu4tpt  f3tltls2rau pnt4 lxomoctadopD aieols0srtoxm iu4omt  ict sfaDrau o;u1ape mietaslaDulnvsn(0 exrxo3oy1fp eaivslt)srxoio nudapen ieslt  Dtmx p;o0oexoif3tysfm2uan o;t4trtnxr ty1omDr n olt)srxmimpnydoptelicil()srrm( o;o1oeto ictyt sDea( snt0arxnir iytfmDe n o t) eurxr3iudomt lfci t) 2rrur ou0aleniieias s eaumpn() lxoxocta1fptelivs;t sruoxo no1aptnliciltfarua(mo;u4tltnioctlslaDeluvs;u4aleoxf oatlm eli ilt)setm(o oodame mfvt s)aDtr( o;o1tleo f3iat s emnvsn(0tltniocio1fp r nvol(0tetrxr3iudol  miei t aDumu p;u1tex ifetatlm2ranmp;u) rxrxrcia1fp rlieo;t  rtr(m3ou1oltelncsltfs2trumoou4tltomieild a2rm(mo u)trermo ta1lmtelues;(0 eurxm3iu1lpe  icsat  Drmxr no4tpt  ieias m2rau snu0tltnio iotfaDeanesls0srxrir3iodopt  nvs ()s2rm(mo;u1opx mfeiaslaDrlnmo t4tetnmo iotlaD aivol()setr(m3oy1apeelivsat aDua(m ;u1oexnmi3tysfm2ua( o;u)texrxo iotlpD  uvo;t0srtmxrpou4ape  nvsl(  Durx  ot4optn i3iadlsDranms;t4 rxrir iodfmtrlnvi;t  2uoim iodopt mncslt aDtauro;o0ale mfeiytla2umn snu0 rerxfcta1opDeanvi;t0 2urxrpno1lmenlnci s)a2raurpnt0apxnifcilsfs2uauvo;t4aetoxoctatfptrai sl(0trum(o3iodll  lfesat sDtax pot1oet mo3ils m2rm(mpnt)aetoxo3ta1fpDraivi s teuoirpou4omte iesat  2ua(mp;o0tex mieiytls eluvp;t)arxomociatoat aneo;t) eto(rpnu1op   nei s  rtau  oo0tet iociyt sDrl( on(0tleniocta1fpDranvs;t s2uoim3ny1ole lfeiasfsDrax pou1alxo ociyt s2umnvs;u4arxnxf tadfmDr ivi t  2xrxo3ny1omte fes ()a2umumpot0oet ifeias a2umuvs;t0tltrmociydoptelnei s0setrxo3oodamtelfvtl(fa2ua(m ;t1tlenioeildla uluvo (0 lxnir tytlaD lnvsls) 2toir3iu1openlfcils)arur(  ot4tet mictltlsDuau s t4 rxrir3iytfptelivs s) 2um(m nu4omt  iesatf rumxmp;t0apxo i3ias sDra(von(4 lxrir3todfa e nei;(0texmxopiydap   fctlt srraumont0tpenioctadfm2ulnmo;()aexoxr oy1oaDrai o (0s2tmxmpnu4ame lnvi s  Dumxmo;t1tet io3tldla2rau pnt4 leoio tatfm eauvo;s)sruriopio1opte icsatfsDrr(r no1olenmietadfa2rauvo;()trxnxoctytoatraneo;( teum(o nu1ame lncilt)s2raump;o4alx ifciat m2ua( snt) rxnir oa1omD  ies (0 exm(m3oodame lietat arrr(ro;u4opt mi3iys a2rmumsnu0arenxo3oadoptelnvs (0 2xrimpoudomt lfvi ( srtrur ;o1oeenifeiys mDumn o u4aleoir3iydoaD  uvo t trxmxmpnodamt mfeils)aDrrumono4aexn iciytfs2emuvo;u4 ltrir3ty1faDrlivs ( setmir3iydaltelfvils)s2rr( p;t1apto feilslmDeluvsnt4aeeoxf3oatfa r i i;t0trxm(mpnu1lmt lneil() rumxmooo1opx ifctytfa ul(vs;u4 etrio3oodoatrlnvi (0setmir3no4ope lnvtl() Dra(r oo1tleomoeiatls2uluvpnu4 lxnxr3ootfa rli o t  ruoxr nodaptelics (  2ur( pot0alt mfctltfm2rm(ms;t4trtomr ootlp ean olt srxoir3io4ll eliciltf Dtrxroou0tlxn f3iasls uau s;(0 rtoxf3oatomDr nei;t srxoxr3io1ameemfcsls)s2uaxr ot1teto f3iadfm2eluvon()artrxf3iotfa rauvi;s0tetmxrpiy1ll elnvtatfarrru  nt4texo ociadfa2ea(vs;t0aetnmf tytfa rlivo (0s2ur(opiudlmee ivs tf rrm(rpnu4tlxn iciyslm umnvo (4 rxrmo3oydfmDr ivs;(0 rtoxm io4lp  mictl(fsrtmxm oo0alen feiydls2eauvs t0 etoxociatomDrluei ( trurxm3ou4om elicils) 2ua(r ot4aeto iciaslaDul( p (4 lermr3oy1fp raueilt0srtmxopnu4opt mivs s aDraxroot0olxo ocildfsDrluvo;u) etoxf ootlmD lneo s)t2umxr iy1optelivtltfa2uru  ;u1openifctas m2rln p;u) rtrio iadfmDr ueol()s2urim io4amt livils)s2tau oou4tlx ifeiysls2rmuvp (0arxnif3io1fmDr ivo;t sexr(m nu4amtelfet (fsrtmu o;o4tlx mieiatfm2rluvsnt4aleoifctadlaD  n i;s truoxrpou4opee nvs ()arraurpoo0tpto ictydlm2um(ms (4aexnif3totfatrau sls0texo(r3no1lle  fetlsf rtax oot0tlen ociys s2uan snu)aexrxf oadfptrauvi;(  2tr(r3iudlme lnvi ()a2rmu o;t1tleoioctadls2elu o u0tlermrcio1oatelnvol()s2uriopoudope mfesa( srum( pnt0aeeo f3ildfsDemnmo;t4 lenmr oydla rauvilt0 2uoir3nu4opte fct sfaruaur ;t0tpxomfeiad m2rau o (4tltrxo oa1fpDr iei t teur(opiy1apee ictl( sDta( o;u1aeeoif3iyd mDel( s u4aeeoxo3iatfatrlies ()s2xmir ny4lmenmncs s a2tmur ou1aeeomoeiydfs um(ms (0tlerxr3io1fa r uvi;s texoxm iodlleemfcta()sDururpnt4tltomoeilsfm2rmu onu4alxnmf tydomtrlnei;s0tetoxo io1lm  mnct sfaDra(mpoo0apxomoctat mDumu o;t4 reomocoadopDe u s s) rum(m3nodameemnvtls a2rm( ont0tltnmo3tydfmDeau p;t4aeeomrciy1lm eli ol() 2xrxo3nodam elfcia(fsDraxm nt4tltnmoetas sDemu on()arxrir3tadlmt au s;t seurxrpiu4ale mfctlt) Dta( o;o1tlto i3iysfa eanmp;()tlxnircta1fptrlnvs;s0texo(o3oy1opt mfvsat aDurxr no0openmiciys s2ra(ms u)trxoxr3ootla elieolt) 2urir iodap elicilt) Dtrumono1tet  f3ildfmDrl(vont0artoif totlpteanes;s0trtm(r nu1olenmics sf rtrxmp;u0oexo f3iysla2rmuvs;u4 rtnmo3oodomtrlivs;s) 2xoxmpnu4op e nvtls srraxm nu1aetomfctldfs2ranmp ()aleomf iydfa rauei;t s2toxmpiy4op emneil( srrm(m ;t1aetoifciadfm ul(vo;u) etrircootopte u ols0trxm(r3iudomtnmivsls) 2tmump;u4optnmoctas m2el(mo ()artomocoatopte nes s0 2ur(mpoo1altemnes ( a2rrx  nu0apxo ociytlsDuluvp t0alenio3to1fa e n s s)s2toio io1om e ncia( artaxrp;t1apen feiydlsDua( on()arxnmf tadfp  ln i;t)seuo(rpiu4apenlfvsatfartmumo;u0aex iociytls2umnmpnt0 exomocoo1fp rlu il(0 eto(o nudomt mietas a2umxr nu0apeo ieiatfs elnvp;(4aexomo iy1fp  luei;t  rtm(m io4oltelivi s  2rrx pno0tex iocias s2ea(vpn(4 etnmr ootfp  lnei;s)t2tr(opnodlmen ivsasfsDtru oou4tptnifciydfa2rmumpn() etnxfcto1op raivo s0t2xmir3ny1lp elnet sfaDrm(monu0opxnmfetydla rl( p t4alenif oatlmDr i i;s srxrir nu1ope  fcsl() rrau  oo1tex if3tydfa ea(vp (0trenxf to1oa r nes;( sruoirpou4ole lfvs tfa2uauro;t0alxomf3ias s2rmu s u0teenxrctytlp ranvo s t2uo(o3iydope lfetls arurxr ot0oltomi3tadfsDeauvs t0 reoifcootfatrlneil(0trumxm oo4al nmfeia(fs2rrx  ot0apxo octasfm2rl(vo u4artrmo tadom eanvo;s)t2xmxr3no1om elfci s aDtaurooo0tptnifcilsla eanmsnt)aleoiocoadlptr uvi;s) eum(m io1ap nlfctls  2ururp;u1alxoiieiltls2elumsn(0 exomfcoydoa  auesls)s2xmxmpnydlm   ici t) Duru  oo1tpt mociys a2rln p;t0tltomf3ta1fmteli o;( trxrxmpoodlp  mfvils)aDra(mp;t1apxn fetatlsDrl(vp (4tltnxr tydlaDr uvols s2xr(mpno4ome lnctat a2raump;o4teenmoeild s uluvpnt)alenmfcoydop ranei () rtoxo ou4apeemiesas s2rmumpnu0tlto ieilsfa umnmpn(0alerir tytom rlieols srxoxrpou4open fesatfsDra( o;t0aeenmfetysla2ea(vsn(4arxnio iy1om  anvo t)srxmir3io1ll elnetlt)aDra(r nu1apenii3iysfa2ea(mon(4alenmr3ty1omDrlu sls) 2urxr oydol n ietlt)a2rau  ou0texoii3iydfmDran pnt)aexnxr3oy1fm   u sl( trxoiopoudomt lfvslt)sDraxront4aexn fctydla2em(vs;(0 eenxo iy1la r u ilt) eurxm oydolt  ncilt)srraumo;o1texoii3tyslsDelnvo u0tleoxo oy1opDrai i;(0 rxrxopny1ole  nct s sruaxroou0aetomf3ilslmDemuvs;t0 rtoir3iadfmD aues s0 rxoxopno1optelfci () 2rrx  nt1tle iiciyt s2raumo;t0 rxnircoatlmte nvils)t2xoim3io1llenmnvt ()a2taurpnu1oetnmoctld s2eaump () eenio3oy1laDrauei t)s2uo(r3iu1oltnlncsl()arrrur nt4tpxnifctyt sDrl( s (0 exoxf3iotfmteliesl() 2trim oydom n fcia()aDrrumooo0teto oeiad a2rm( snu0tlxnmfcia1lpt auvo t srum(rpnudlleelncta( sDumurooo4aptnmiciatfa emn snu4 ltnxrcoatopDelnei;s srxm(m io1ol emfvtasfs2trxroou4altnmfeiatfaDumu s u4aeeoir3oa1lmD auesls  rum(o3no1ap  mietl() 2rmxronu0texn ieiys a2ua(vsnu4aetrmf3iodoa rai o t)trurxr iu4op e nvtasf rta(mp;o4oex io3tysla2rauvont)alxnir iotfaD aneilt)t2xoim ny4amtnliei ( arrm(r ;u4tetomoetld m eaump ()arerif iadlat livi t0 2xr(rpiydameemietlt artmxm no0alxnmf3tltla uln s t) lxoxr3oy1fmD li o;t  rxo(mpiy1ope lnvtls artrxr ;t1tleomo3iatlm um(mpn(0treomfcia1fmteaueol()trxoxo3oo4lptnlicia()aDrrumont1tpe if3ildls ua( o t)artoxfcoy1faD  n i t)srxmim nu4omt liei tf 2ra(  nt4opx ioetysfsDranvs t0altrmf3ia1faDelnes;t) exr(m3oydole lfctas aDra(m nt0apxomoeiltlmDrl(ms t0 etomociodfp r nvsl(  2uoir io1omtnmfcia()s2rr(mont0opxnio3iad s el(vpnu0altnir3oodopDean o;()t2uoir3oydlpeemietas)s2rm(r ;u4tpto oetytlmDel(vo t) lxnxf tytfmtrluvs s0sexrim nydal elnvias s2rru onu0opeoifcilsfaDumuvs t4 ltnmr3ia1lmt aivi;t0srumxr3iy1llenlics tfarur(rpou1opxomfetlsfm2ua(vpnt0arxnxocoo1oaD lnvi t t2trir oy4ol e nvs (farrmxmo;u0aptn o3iasfs2ulnms (4 renifcoatoa e nvs;s0 rxo(mpiodomtnliesa(f 2raumoot1tee mfciytlm ua(mo u) leoircio1oateanei;t) eur(r nu4aptnlfes sfsrtm(mpnu4olx  ieias mDum(mp;t4teerxo io1opDeaivilt) exrir3io4lpee iesl() rta(moot1apxo feiys s eauvs u)arxrxr3oo1fmDr ieslt)truo(m3iudamen iesls  2ur(moot1opt ifciatla2um( o;t) eeoxfcio1latrauei;(0 rtm(m3ny4om  lnctl()a2taurpou4tex  i3tldfaDuaumo t)tetoif3oy1lm  anvi;s  etoimpiy1lle livsasfarrr(mp;u4apxoifetys s2ean s;(0 lxomf3iatlm  an o s0trum(o iu4lpe  icsa()srrr( oot0opeomfciys mDranms;t)aexnmocoadop  lnei s0srxo(o3nudopte fvia() Dtau  oo0tlt mf3tadfm um( p;()artoxrcoatlaDran o s)sruoxmpoodomtnlnetat)arta(  ;t1oetniietls mDeanmon(4artomocoy1opD aivo;t)srtr(r3iodop nlfesa(faDtrxrpnu0tleoio3iltla2raumont)tlerir oytlpD  iesls sexm(r ou1om emictls)a2tr( pnu4ape mo3tls sDemn ont0teeoir ta1lpDelieols)s2xoirpiu1ll   ivil( aDrm(r ;t0olxo i3iat m eanmpnt0 renmo iatopt luvs t trtrxrpio4lpeelfciasf rrrxmooo1tetn iciat aDemn o u4tltrmo3iy1om eauvi;t0 rxm(m no1lpt mfcilt srtmx oou4tptniietldlm ra(mp (0aexnmfcoy1fa r ieolt  rurxr3iy4llt micilt aruaumpnt1tpxniociydlmDeaumont)artrmo oydopD lneolt0 etrxo3oydoleemncs t)a2tm(m oo4aee ii3iasla um(vont4 ltnifcoytopDeanvo;(0 2xoirpno1lm n ivi () Drmxrpot0oleoifciytfs2um( o;u4alermo3oydlm rauei t trur(m no4ope mnctas) 2um(  nu4oexn o3iat m2rl(vs u)tetrmr iatlm  luvo;t) 2xrxr3iudol emfesas) rrmx  ou0openmfeiysfm rm( snt4 lxoir ty1opDeanvols)texmim oo4ll  lnvi sf 2rmxroot0oeeoiietaslaDem( p;(0altnircoa1lpDeli ils) 2xo(m3oo1ameemfcsatfarua(m oo0tleoio3tasfm2rl( s u4 renxo3oa1lmD lnvo;(0 rtmxr3iodom e fvsasfaDururo;o0opeo ietyd mDem(mo;() leoxr tadfa raueo t  eto(o nu1omt lfvsl(f Dtr(  ;o0aeenmfciys m emu p;t) ltomocia1fmD ln i s  euoiopnudam elivsltf 2rm(root1aex mi3ils s ra(vsnu4arenxo3oadfa eluvo;t s2trirpnodlmt mfctltf Dtru pou4tptnmoetltla2eanmsnt4 lenmf3oo1oateli i ( t2ur(o3oydlmtelfcsa(fsDtru o;t1ape  octlsfs elump (0aleoio3tydlpDrauei ( trurir3iu1op   iesl( srra( p;t4aeto i3iys s2umn p u0treoir tytla   ues t)s2trxrpny1lp  lietasfa2raurp;t4tlx ifetadfmDrmn o (0alxoio3oo1lpt  ueo t  2umir oo1lltelfcia(f rtaxm ;u0olxo i3iydfaDel(msnu4arxoxf3iatlm r nei t)t2xrir3nu1apt lnetat)aDumu pno0tet moetltfs2emnmpnt) etoxo3oa1oaDr uvs;s)trur(m no4llenmivil(f rta(  no1tlxnmiciydlm eauvs t4 lermr todfa eaueslt0s2uriopoo4ol  mnetas aDtru pno0aeenmfcildfs2emnvo ()trenmo3tydlaDeanes t0trxmxm ny4ol nlneias)aDumumooo0tltnif3iatlm2ra(von(4 lxnxr tadla rlueo;s)s2ur(mpiydam  licilt  2tmxrpot0tetomoetatls2rmnvp u)altnio iatlpt li s s t2urxo iy4al  livt t  rurx pot1tlxoiocilt m2ra(ms ()aeenif3iydlpDe ivs;t)tetr(o nodap nlfcilsfsrtrx o;o1opxo fctaslaDrmu p ()tltrmrcio1omDelu o;t sexmxr nu4omte ieils)arua(mpno4alxnmoeiyt s2em( p t4 lxoifcoo1laDe n i s0srtm(rpnu4apt lfeiltf Dtm( p;t1apt io3iasfa uluvo;() rtnir iatfat au o () rxoim iudamt lfvs t) 2umurpoo0opxomfeiadfm2ea(ms (0texnifcoo1op rlu ilt) exo(m iodamenlneia(f Drrumooo1aptn ociyd s emnmo u0tetrio3ty1fa elnvi;s0 2umxr ny1amtnmfvs s) 2rmurp;t1ope  f3tyt sDeanvo t4 lxoxf ta1fatrlivi s0 2urimpiudamtnmnvtlsfsrtrxmo;u4alxoif3iytfa em( p (0 rtrio oatomDrlivo;()trxoxmpno1amt  fci sf rtmu pnt1aeto oeiltfm2rmuvpn(0teerxr totopDean s;(  rxmir3no1om nmivt t  2trum ou4tpeoifctatfm ul(vo (0arxnmo oy1lmtran i;s) rtoir3ou1olt mfeta()s2taumpoo0aeenmfeiytlsDrlnvsn()trtrmo3iadlpDeaieo s) 2trim3oo1opteliciat)sDra( ooo1tpen i3iadfsDrmuvp;t)tetriociodfa elu i;( trtr(r io4lltnmfvs t)s2taxm nt4altoifcildfm2emu pnu) ltnmocoydlm eluvol() rtr(rpnudam nmnviat  rumxmonu0teeoiieiatlm rluvsn(0areoxf3oo1fp raieo t)trtrxo iudlpt mivil()s2rrx  nt1olx mo3iydla2ulnvp (0artrmo3tadoptr ivs s)sexr(o oudlmtemfesa(  2rrum ;t1tptoii3tyslm ulnvpn(4altrirciatlmteluei t)s2xr(m iodamtnmncslt)arurur ;t0olxomo3ias s2rluvo;(4teeoif totomtrauvo t)sruoxrpnydomeelivsasf rur(r ;u4apt  ietyslm um(monu0 lenmfcio1lmD lieo;( setoiopio4op nmfvt s) rrmum no4olenmfeiytlm ea(monu0trxnmf3ta1oaDr u o s)t2um(r no4amt mnvtat)aDua(r ;u0oexo i3ilt a2rm(mpn(4aetrmocio1opt aies t t2tmir io1op e nvtat aDtru  ;t1aptomo3iatla2emn pnu4 ltoio3oy1opDr n il(  ruo(r3nu1aptelfeta(faDtm(rpou0oeen i3ilt sDran s;t0 ltnxrcoy1lpt  u ilt trumir iydlp  mfct s)a2tmum ou0oltnmo3iasfmDelnmpnu0 leomo3oadfaDe u i ( srxr(mpiudoltn icil() 2umumooo1ape if3iltls el(vs;()aeerif oodopDe i ilt)srxoxr3ny1altnlivsat srtr(m nu0tpeomfetyd m2ulnmsnu) lxoxr3oy1oa  luvi;s)s2toio3iu4lm nmfvt () 2ta(rp;u4altn ieiyd mDrmnvsnt4tltnxr ta1oa rai slt teuoim3oy1al nmicsa(  2ua(mpot4apt ifeiltls2ra(vs (4teenir3oadla r i i t) euo(opnu4ol nmieias)srumumoou1tlx iocias mDranvo;t4tltoxr3totfpteaivslt0srtm(o3oo1op nmncsasfaDumxrpou4aeeomfciytlmDua( o;(4 eeomf to1fm eauvil( srto(rpno1lpe  ncia()artrx poo1tpxomfeiadlsDulumo (4tlerxfctydlpteli s;t)trxm(o3iudopt lictlt  Drmum nt0ole  fciat sDemuvs t0teenmocty1op e i i;t srtoxo ou1omtnmfvsl( aDrm(m oo4aptn oeias m ul( on(4artniocty1fpDelueols0seum(m no1ol   fcias)s2rmu ooo4aexo o3iytfs rlump;t0 lermrciytlm eauvs;s0 rumxo3iy4opeelfes (fa2umxm ;u1aetnifctlt aDemu s;u0 eerif3tadfmt au i;t) 2xrirpoo1ol   fcsa( arra(rp;t4oltoifctat m2ulnmsnt4arxnir io1laDrln ils tetmim3oo1olee fetl()aDuaurono4tlx  icilt m uaumpnt)areomo3oa1lmDraies s srxrxr3ny4olte netasf Dum(  ou1altn o3iyt a2ulnmsnt)tlxoio3totoaDrai o;(0 rtmio3iy1amtn fvs ( aDrm(mont0aee ioetadfa ean o () rtnmf3ootopD  uvi;s)setrxm3nydlle mneia(fs2rr(mpoo0olx mfeiydlm2rluvo ()aeeoif3to1lpDr nvsls) 2uoxm3iudap  lneia()a2umu  ;o1ope moctydls2raumpn(4 lermrciatfpD  n i;t0texrir io4aptn iei ( a2rrumo;t0tpe  i3iydlm uaumo t0tltnircoatfmteaivo;s0t2ur(r iydlltn fesltfaruru o;o1olt mfeildfmDrln pn(0teerxfciotlmDelneslt0 etrxmpiudlm emicilsf 2uaurpnu0optomo3iysfaDeanmo;t0 rtnif3ty1faD  n i;s sexrio3nu4ll nlfvslt s2ra(r ot0altn fciltlm2rm(mpn(0aeeoio3iy1oaDeai o t0sexr(rpiy1lmeelneslsf Draxr ;t1alen ictydfsDumumsnu)arxnmo3ta1latr neo;( srxmim3no1lpt mictls) Dta(root4apen fetatfmDranmont0texrmo3tatoaDr u o;t0s2xmir iydll  mivt s s2ra(mpnt0aeeo f3iasfaDrmnvsn()trxnxr tydfaDraueslt) exmxm iu1amen feslt srua(mp;t0oeenio3ilt a el( p;t)trtoxr iotlm  liesls0 eumxmpoydll n nctasf Duau  ot0tptn ieiatlmDeln ont0trenir3oo1opDr n i;(0seur(opiydlltemnci t)arrmu oot4tet ifcilt m2rmuvp ()artrmocoodlm r nvs;s)trtr(m3nu1omt mfvt ( srrm( pnu1tlt  f3tadfaDelumsnu) ltrirctydfmDean s (0 rxmxr nu4ol  mfetls)s2rmum ;t4tlen ietasfa ra(vs;t)areoif tytfpD  u s;(0srur(m3oo1omtelfvsls)a2ur(r nu1oee ioetltfm2raumont4 rxoio oydfpDeluvo;t0trtmim3io4lm nmfcilt)sDrmur ;u4ope  oeiaslsDem(vo u)teermf to1fpD liei s0srxoio3oy1al elnvsa()srumxmono1optnmoeilt a2ea(mo;()aeeoio oatfm e n o;(0 rum(r3ny4llt micsas srrmxrpot1ale moeiatlsDrlums t) lxoir iodfmDrluvilt  etmxo oodlmeemnvs s  2tr(mo;u4oexomocildls2ea(mpnu4 rxrxr oydomDr uvsls0seum(r3nu1ale livt s  Dtruronu1ale mfeiys a rm(vpnt0tlermfctodfmD lnvo;t  exm(mpiodomtemnctas) Dtrxm ;t0alt  ietysfmDem(vo;u0 eerif iotomtraiei;() exm(m3iu1llte nctl( s2umuro;o1oetnmfciadfa2raumsn()tlerxr3totla   i o;t0t2toxr3iu1oltemnvt ( srur(rono1tpxnmfeilt a2rauvo;u4tltoif todoateaiei;t)srumxrpno4ap nmivtls arraur nt0aet miciltfa2uan snu) rxoif iatfpte nesl(0srtm(m iu1ap nlfvt tfsDrau p;o0aetniiciyd m emnvsnt0 eerxr3iadom e n o ()teumimpoy1oltnmivsa(f 2tmxmpoo1aetn octysfm um(vsn()artrmr3tatlpD  uvo s)srtrim3oy4ol nlfci s) rumu poo4alxnmi3iyt s2raumsnt)trenio3iodop rau ilt  2xoxrpnu4opee ivi sfarum(root4tpeomf3iytls2emn o t4trenxr3tadomDe n i;( setr(m3io4lmtnmfct t)sDrm(m ot4apxoif3iysla ua( p u)artomf oodfaD  i sl(  2trxm3oo1omtelncia( a2ua(rpot4tle  fctadfs em(vs;u0aleoirctytopDe ues ( t2trxo ny4op  mivsat srtax  ou1alen feiys aDumumsn(4artnmf oa1lpt luvs;()tetoxo3iydolee icta( arraxrono0opxnmicils mDrm( o;u4 etrxfciotoa e nvo s)setmxm3ny1op e nci tfa2rm(m nt1alxo ieiasfaDrlnvo;t4altnmo tatfmD liei t  2umxmpoo1optnmieta()s2rm(  nu1oleo o3ilsfs rmnmp;t)aetoiocoy1omDe ieo t0 rto(r3ny4om nlncslt)s2ua(r ;t1oltomo3iydls umums t4 lermo3tatomtean s t0 2ur(m nu1lm   fvt (f 2tm(rpoo0apx  ociyslsDrmnmp u0 etnmo3oydoa eaieol( s2umimpiu4amen icias  rta(  ;u0openifetyt mDuan o;t0 exomfciy1omDe ivi;t0 2toxo iodamen icils s2tr(mono4oleoiictad m ra( snt)texnifcoo1omtraivi ()s2uoxmpoo1lmtnmfvia() rurxm oo0tltnii3tytfa2ua(von(4aexnxocoy1lmD anvolt0s2tmxm iu4alee neslt srtax  ot4opxo ietatfsDelump (4aeenif to1fat lnvs;(0 rtoxm3oo1ap n icsl(fa2rmu  no1openmi3ias a2rl(mp;t0tlermrcty1fatelnvilt trxr(opno4ap e ictltfs2trurpoo0olx  o3tadla2eluvs u4aeenxociadla e ues;t) rxoio3iodll e fcslt)arumu pno1tpen i3iatlmDuau pn(0 etnmf3io1fmtr uvil( s2toio3iudam elneiat  Drm(ro;o0aetomo3ild m eauvpnu) rtrmf oodoaDean i s0 rtoxm3nydamtemncs t sDtaumo;t0aexo ieils aDul(vo;(0trtrifcoy1la e ivo s0 rur(r oodal nmnct s a2ur(  ou4aex  f3ilsfm2rauvont0tetrifctatfmtr n s;()tetoxr3ou1olen fcsa(farrrxmp;o0ape  feiytfm2em(mont0altnmf tytla e uvi;()s2umim3nodolen iesa(fsrrrxrpnu1teenmfeiat sDrluvpn(0artrxr ty1opDe u i;s)t2uo(rpoo1lm nlnct t sruaxmooo0aptnmfeiydlm2el(vsnu0aexrxrcoodfmD  u s;t) exm(opoy1ap emicsas a2rr(moou0aetn i3tls s2ulnvon() rermo totom e u o;s)texmxm nydomen nci (fs2umxmpou0ale iieiadfa em( on(4texoifcio1om  livs (0 etr(o3iydlptnmfesl()s2um(  no0alxnioeildlaDeau ont)texniociatlmteau s t0s2trxm oo4omee ici ( a2ta(monu0aeeniiciysla2ra( s t)arenmfctadfateai sl()t2trimpiy1amenlfetl(fa2urxmpno0oexo iciasfs2umnvo u4teenmr oytfat  ivs t)sexrxrpiodolenlfcsa( artau  no0optn i3iytfm rmump;u0 eeomocoatlmD aies;t0 2xmimpio4apt  fct s)a2um( pno0tpenmfeiasls ranmp t0 rtomr tatfpt lnvo s)sexo(opiu1al  micsat  Drmxmp;u1apeniiciasfmDeluvsn(4trtrxf3totfm  auvi t)t2um(o3ny4ame  nctas) 2trx  ;u4texomi3iydfa ranvo;u4 rxrio oa1lm elnei;s)t2xrirpou1op n fvsls)sDrrurono1olt ifciatfa rln o t4teerif3tadla eaivol() 2xrxr nodllenlict ( srrr(mpou4tetniictytla2ra(vo;u4 etnifctatoateanvi;(0s2xrir oy1olt  ies ()s2tmumpnt1aeenmieiasfaDrlnmp;t4texnxocoytfa rlu s;t) exr(o3ny1optelncs t s2ra(moot1alx ii3iatla2ran o;t0teeoifcoydomtelu o t s2xmio3oydlmt lnctltfs2uau ono0altomo3iltfmDrmn ont4trxoxf oy1laDeanei;s)s2xoim oydaltn ivils)srta(rp;t4apxniieiyd s eauvp;t4 lenxo3iotoat  ieo;t) rtm(opoodol e ietat  ruax p;o0alxn o3tltfs rmn snu0aetoxf iadop eau slt)s2uoir oydaptemncslt)srur(mpot0opx mietls s2rlu ont0 rtnir iotlmt  ueils seto(m no4ll  lfvil() rrrxmpnu1aee moctydla uluvpnt)altoif3tydoa r iesl( t2tmxmpio4ap emfvia( sDtr(mpnt4opt mo3iyslaDelnms;t0artomo3ia1oatrlnvo;( teurxo3nu4lle mfcsasfsDua(mo;u0apxomfeiat m2elnmpn()tltomrcto1laD anei s0 exoiopno4alt liesas srrm(mp;u4tpxn oeiatls elu o t) etrxfcoo1oaDe n s;t s2xriopnu1lmeemfeias)sDtmxr ot1oex ii3tls m2rmu p;(0alerirctatoptelivi (0 exr(rpiydom  mfvs sfs2rrx  no1tetniiciys m rmu s;t)tlxoxfctadla elnesls0t2xm(m3nu4ame lnei t srumxrono4oeeoiieilsfm rmnms t4 lxoif oadop ran i;t0 etm(r3ny1lpe  net s) rrmumonu4oee iocilsfa rmuvsn(0trenio3oydfp rli o s  rur(mpoy1am nlieilt)s2umxro;o4apxnii3iasla um( snt0altomrctotlm  lu i t trtrirpio1lpt mfcsatf 2tm( p;t1oleo icilsfa rmn onu0 rermr ia1omteaieo;s0sexoxm3iu1am e fei ( s2ur(moou0apeo iciys m uau snu4 reoif iytfmD lu ilt)t2urio oo1ope lieil() 2tau poo0alenmf3tldlm2ul( s ()aetnmo3io1faD  nvi;() rxm(r ou1oleemfetas  2rmurp;u4olxnifeiysfs2elnms;()artrxfctytfpDr ieo t0 rtrio3iu4om nmivtlsfaDtrur nu4oltnmo3iydls2emuvs;t4teenmocoydoaDeln o ( trxmxmpoy1ape lnvi t aDta( o;o4oeeomocias s2ulnvont4artrifciotoa rlnesl()trtmxm iydop  mnvtat  rtmu p;t1tptomi3iltfsDrauvp;u4aeenmo tadopte ivolt)texo(m3ny4ome mnvias artmx p;u1aet  ictat mDeanmpnu0teeoio3oodoate i i;s)teumxm nu1lmt  nei ( a2rm(r oo1tlx  ocilsfaDelu snt)texrircto1oate iei;s0srxoiopnudlle liet s)sruax o;t4tpt micias aDra(mp t4tltnxf3ty1fmD liesl( srtoir nydamt  icsat  Dum(  ;u4tle mo3iltfa umnvpnt4arxrxf3tydfa rlnei;() 2xm(opnudopenmfetasfa2ra(mp;t1aeto icias sDuau s (4alerxr ta1fpt anvi;( tetm(o3iodomte fciat)artmu  ;o1tltn f3ias a2ul( o;u)trxoxfciatfp elu olt trtmimpoy1ap n fviat aDrmxr nu4opt mo3ild m2ulnms u0trtnxo iydom eln s;(0trxo(opnu4am   fvtas  rumurono1opt moetyd a rmuvo;t)texomfcto1oaD lu il(  euoxr no1omteliet t a2rm(rp;t1aleo fetyslmDemu o ()artnir todoaDeaueo t0texo(m ou4aptnlivs () Durumpnt1alxo o3iys sDumuvp (4tleomf ty1oateli o;s seurio3ny4op emfvil() Dua( p;o0tee ifciltlsDumnms t)aeeoio3oa1oatr nvs s0trtr(o iy4oltelfvta( s2ua(mpnu0tpe mfetytlm2ranvont)artomf iytfa eauvs s t2toim3no4apenlfeiat)sDtrumono1tpto fciadfsDumn s;t4altnxr3todlpDraues (0setr(m3ny4apenlfeiat)s2tmumpnu1oexn ociytls2ua( s t4altrmr totomDean ilt0t2to(rpoudoltelnvtas)sDumx  nt1apt mfeiyslm2elnvo;(0tltoir3oytfat lu ilt0 rxmir no1al e ncsa(faDrrxmooo0opx io3iytfsDea( o;(0 lerxo3ta1lmDelnvi;(0 2tr(m3iodll  micilsf rtrx ono1altnmo3iys a2rmump u) eerir iy1fmDeau sl()trxr(r3iu1al emfci ( srurx p;o1oetomi3ias s uanvs;u0texnxocty1omtrlnvo;s0s2trxopio4lle  nctl()aDtmx  nu0oexn o3iat a2ua(msnu0 eeoxo ty1la raivo;s  eto(r iudll   icsa( aDur(rp;o1tpenioeiydfs2emn o;(4 exnxf oatlaD  nei;s)s2uoir3iy4ome mfvtls)arrrum ;o4oeeoioeildla rl( o (4 etrmr3oytoaDeauvs t0 eur(mpiu1llenmfeil(f rrr( oou1apenifciad m2ul(ms u0alxomf tytlm   uei t)srtm(rpnydamee fcsas)sDtmurp;u0ale moetyt s ul(vs;t0artrmf oodfat aivs t0trxm(r oo1omtnmnei s) 2uax oot4optomieiydfsDrmuvs;u4 etrirctydomtr nvs;t0 rur(o3nodam elfcsa( a2rr(  ;u4olx miciad sDumumpnt0teeoxf3ia1lm eli i t0sexo(m3oy4lptemnctasf 2tm(moou1tpxoifcils aDum( pnu4aeenmf oodomtrlu sls)t2umxopoy4lm emivilt) 2tr(rp;u0teeo ociadlaDrmnmp;t4texnxr oy1omD li s;s)trtrio iodome  nciat srtmu pno0tlenio3iad a rmn onu4teenxo3iotfmDe u olt s2xm(mpou1apeemivs s sDtm(rpou0oltn octydlaDuaumo;(0 ltnio oatopteli o s)s2uoxmpno1apt mfei sf 2raumpoo4olt mo3iasla emumo u4altoxf iatfaDe nei ( trxo(m ou4ale mivta(fsDtrx p;t0tleomf3ilt s eln p u0alxnmf3oy1laDe ivo t sexmxrpoy4olt lncslt  rrmxmoou1teeo ieiatlaDelnvs;u4 ltrmo oatfm rluvi ( setr(r3iu1am emfviat)s2rmxr ;t0tleomoeiadfsDranmpnu4 reomr3ta1fpD  i il()trurim iydlpe lfeslsfa2um(  no1oexnifeildfm em(vo;u0alermr3iydfp r u o (0trxo(o ny1lptnlnct s srrr(mooo0aptnmf3iys m ra(von()aetnxfcoatlpDeluvs;(0 rtmxm3nodll nmfcil( sDrmxrpnu4oetnii3tltlm rmn p (4alxrmr tadlmDeaues (0s2toxo3oo1lp n ivsls  2rm(ro;u0aee mo3iysfa umnvp;(4 rtnifcoodlptranvsl( seto(r iu4optemiei t sDurx o;t4tpx  o3ilslaDraumsnt4 lenmo3oatoat anei ()s2uoxr io4lme mfvt () rta( ont0tpxnmf3ild mDea( p t0 etnxfciotlmD li ols0t2toxm ou1ol nmnvia( aDtrump;o4tptomf3iysla rm(mpnt)treoxo3oytoaD  uei;t s2urir3iu1lpenmfctl(fa2ta( o;o4tee ifcilslsDul(mpnu0 rxoiociytfmDrln o;s)trxm(o oo1om emncilt) rrrum ;t1ole ifetatlmDeln o;u4aeerio3oatopteauvil()t2uoio3ny4al   fes ( a2trum ;t4olxo ietatfa2umn p;u4aeenir3iytoa elieo;()tetrirpny4olen fcsat s2ra(  ou4tlxnmi3iat m2rm( onu)teenir3io1la  auvi;( srur(m3nu4oltnlfvsa(fsDrr(mpnu1aetoiietyslaDrln snu4tlxrifcta1oaDeau o;t) 2xrxmpnudamenmfcsat)sDur(mpoo0tpt mfcildfm rl(mo;t4 etrxr iy1fp e ies;t0s2xrxrpou4lp n nvtls a2rm(mpoo1tpen i3iadfs rlu s;t)texnir3iotlatelu o;s tetm(o3oydalenmfvt s)sDuaumonu4aetomiciad m2rl(mpnu4texoif iotfateau o;(0tetoxo oy4llte nvt tfsDrmx pot0opeoiocilslm eanms u)aexrxo oa1oaDe ues s texmxr3iy1op nmiesl(fs2tm(rp;t0oltoiieiysfm elumon(4 lxrmf3iodlat aiei;t0trxmim3nudam nmfcsasf rumurpot1oexo ocilsla elnmp u)arxrmocta1fa e ivsl()setrxo nudlpe lfciltfs2um(mpno0tlt ifetlsfa elumon() rtnxo3iotfa r neils0 2tr(o io4amt  feilsfs2rmu poo4opx mfeild s rm(mo;u)teerxf todomteai ol(0srur(o3nu4lm   feslsf 2rru p;o0alxo f3iytfaDul(vpnu) etoxrctytfaDe uvs ( t2umxm no1lm nmnvtl(farraxr ou4oex iociadlsDrl(vsnu4altrmf3iadopDeaneolt)teuo(r3nu1opt  fetl()aDrau ooo0oexoif3tad aDra(ms;u) rxoxo tatomt  ueols  rxmxr ny1apen netl()srrrxr no4aeto fciydfa2ua( p;(0trxoxo oo1fp rliei;s srxr(m oudop emiesat)sruau ont1apx iiciyd m2ulnvo () exnio3oatlaDean s;t setrxopoy1op n ncslt) 2urumont1tpxoiieias s2rlu snt0trenxrctadlp rlneo s)srxmxr nydale mivslsf Durxm ;o0tlxnioeildlmDrmnmo;u)aetrif3tatoatraueils)tetmim3ou1ll nmnes (farta(mpno4apt iocias m2el(von(4 eeniociytop  lnei t)seuo(r nydoltelies tfaDurxm ou1oex  f3iad a2ulnvsnu4teerircoytlmD ln ol(  2umirpou4lm eliciat)srumx  no1apxoioctytfm emuvo (4 rxomo3io1lp   i o;s) 2toxm3io4aptnmietlsfarta( o;t4oeeo i3iadfm2uanvp t)aexoiociodoat  uvils0sruoxmpiy1op emnetl( s2tm( oou4aptniieiad a emnmp u4aetnmf oydfm r u o;s0sruoxm3oudoptemfciat)sDrax p;o1aexnmfeiasfmDumn s (4 exoio todlpDr neolt) 2xm(m3io4om nlfeta()aDumu p;t0aexnifeildfmDrln o;t0arenifcootfpDrlivil()srtrir oodaptelnesat a2trx p;o1oleoifctltlmDel( o;t4 lxoxf3ia1oateanvol(0teum(m3iu4al  lfvtlsfsrrax o;u0oleo oeiysfa2ua( p;t)trenxr3ty1fatelnvsls0srtmxrpiodlmte net (fartauront0ape iietld s rlu pnt0tleoxf3tadoa r ueo;s0tetrir oy4lpeelivsat sDumxr nt4oet ifciad sDel(mo;u0 etnxoctotoaDr i ilt0truoxmpno1altnmieiltfsDtau ooo1ale mfctatls2ea(ms (0 eermfcia1opDeluvsls trtmim nydlp   iei (fsrumx oou0opeoifciadlm2eluvp;u)trtnif ta1fm elivils0sexrio3no1lle mict ( arrr(rp;o0ope  ictldfaDrluvpnu)tltrxr3oytfa e u o;( tetmxo nydop nlfvia()sDtm(rp;t0optn fetydla2umn s;u0 exoxo3oytfptelivsls0truoxm3oodllt  fetlt aDur(m no0alxomictadla rm(mp (0artomo3iydom rai ol(  2xo(o3iy1alee ivtat a2rm( p;u4tlen ieiasls emu o;u)artrxo3to1lmt lnvs;t0s2xmxm nu1olt liviat srtaur ou4oeen octysfm uanmp;()treriocoadoa r ueo s) 2tm(mpou4apt mnvslsf 2rau poo1altomfetat a rmuvonu0aeeomo todopDe neo (0 2uo(r oudalt lieslsfa2taxmono4texoioeiytfm2ea(vs u0tetoxfctotoptr ivi;()s2tr(r3oodome lneia(  Drr( oou0aleoif3tysfm eauvs;t4tlermrcty1faDr uvi t t2to(r nu4op nlfvsa(fsDtm(rpot4aleomoctas aDrl( p u)aexnmfcoydom  aivsls)tetm(mpno4ameemnvtasfsDrauro;t1oetomfeias m ul(vo;u0 rtoxf3oy1opD luvi s0s2um(m iydaltelfci s)sDumx pou0alxnmiciad sDeauvs;(0tetoxr3oadlpD luvs;s t2tm(mpio1lme mici s  rrmu  ;o1oltnmfetlsfmDrm( s t)tlenxrcio1om   i s ( trtr(o oo1lleelnesas srumx  ;t1tet ioeils m2rln o () rxrmfcoatfmt  nei;(0trxoio iu4al nlnvtl( arta(  nt0tetoif3ilsfmDrau o u0alxoir iytlm rauvs;s0s2ur(o3io4apte fetas  Dumxm nu1aex iictydlaDuanvp u)tetnmo3iydopDrlnvi;s0 2xmir3nu4apeelietls  rtau poo0oltnmfciydla ra( ont0 rxnif3oadfm eluei;t0trxr(o3iu1omeemict (fsDtmu  ;t1oeen o3tlslm ran s t4tltrmr oodfpD  nei (0srxr(m oo1alenmfvsl() 2trxm ou1opx mieild s2uauvonu) rxrmf iodlmteln s;( seuo(m3io1opteliciat a2ta(m ;u0opx io3tls a2ea(ms;t)aetrif oydlmte u o;( srum(mpno4omte nei s)aDuaxmpot1aptnmfciad aDrm( o u4tlenmf3oodomtranes t seurxopou1ap n nctat  rur(r ;o1tlt io3iyt s ean p t)aetnxo oa1op r uvilt)srtrim3nydol   fviatf 2trum ;o4aeto i3ilsfs rmuvs;t0texrio iy1om e uvolt0s2tr(opny1apeemfetl() Dra(rpot4tltomoeiatlm rlu p (4trtrmrciadfmt  n o t texo(rpoo4ame lfvslsfs2um( ont4oet moeiad a2um( p;t0aeeoxr oadfpteaivi ( teto(opnu1lp elnct tf rtaxmoot4oeeomi3ildfm uauvo u4trtnif3oatoa e n o t)s2xmxo3iy4lpen ietl(fs2ur( oot0aet mieiad aDumnmo t) exoir3iydlpt  u s t0 etoxo3oy4ape  iesat  Dtrxm ;u0altn fciyt a2ea(msnu0tlxnifciotfpDr u i;()teur(o3ou4lltn ivtlsf rtaxm nt1aleoif3tyt a umn o;() eermo oa1fmtelivil(0srxm(r oy1apee fctas s2uaxmpnt1tleomi3iasla rmumpn(4texoxr to1fat  i s;s srur(opoy4lmtemfvil(f rtruro;t4alt  fctlt s em( snu4texomf iydfp eanvsl(0 ruo(r no1ol nmfci t) Duau o;o1tpx if3tltfmDuanmon(4aleoifcoo1fpteaieo;t) rurimpoo4lpt  fcia()srumur no1olx ifciad sDranvs;t)tltnmo3oadfpD  ies s t2tr(o oodapenlfctlt a2rr(rp;u1oltomiciydls ra( ont0aleoir3iatlpDrlneolt)setmim3nu1apenlfvsas  2taxm nu4olxoifeiatfa ulnvs;u) lxrmocoytfmDr nvil( trtoxopno1llenlivia()sDtr(rpnu1oee miciaslm ul(mp;() rtnxrcio1fp  li ils  rxr(r iu1llte fci s  rtax pno1alenmfeilsfsDulnmo ()tltomrcoo1fmte uvsls trxrio3oo1lmt  ncsa()s2tax p;t1oeenio3tatfs2elumo;t0aexoxfcoytoaDe nvi;t) 2triopno4lmen nes s) 2rrxront0alenmfciydlmDumums u4 ltoxo iadom  auvo (  2toxmpnu1ole mivs s)a2umu oou4oltnmf3iyt s emuvont0arerircty1lm  ln o (  rtr(o ny1ol   fvi (faruaxm no4olxomfetlsfsDul( pn() rxrir3tydopt an slt setrir oydolt mfcsa()sDuauronu0oet mi3iydfsDem( p;u0alenmfcta1fpt  ivo;() exrxm io4lm elfes s  2rauro;t4tpxnmociyd m2rmu ont)aeenmo tydomDelivo s0s2trim oodal  lnciasfartaxm nt4opeo i3iyt s ua(mon(0arermfcto1oa  ln i t)teurxopoo4am n iei s) 2urur no1apxo fctatls uanms;() rtoxo oodoptran ilt)tetr(rpnodapte nesltfsruru p;u1aex mf3tltfaDran o u0teeoiocoo1lpDr n il( truo(o3io4am nmneiatf Dra(monu0tlxnifciysla2rmu o t0tltomfctytfmtelies t) ruoim iy1omtnlneiasf Dumxmo;o4alxnmieild m eauvpnt)tltnxo3iydfaDrluvi;t0seuoxm oy1oltn iet (f Drmu oou4apx if3iaslaDul( pnu) eerxr3iy1om  livs t0srxmio3iodalte nct sfa2uaxr ;t0texn fctyd a ul(mpnt0 lenxf3iotfmteln s t0s2um(opnudamtnlfetas)srrmur ;u4tle  ieiysfs emnvo;()trtomr3oy1laD ai o;t0srxmxo io4ll emfvsa(f Dururo;t0apxniieiytfsDulu p;t0 lxomr3oydlm eaneo s  eum(r3nu1ap e feslsfs2urxro;u1oltnii3iat aDuau o t0trenxrcootomDe iesl( teuoxo oy4lm  mnvtltf 2trurono0aptomoetlslsDum(vs ()altnmrcty1lp rlnesl() exr(o3nodlm emnvi (  Dtmxrpot4alxnmieiad m em( pn()artnmocta1fatelueil(0 etmxo oo4openmivt ()s2urumpnu0aexo ociyt mDrln o;t)arenmr to1lm raivs s0 eto(r no4llee ncils sDrmxmoot0oeeomfciatfaDelnvo;u4 eeoxocoodfaDrluei;s)sexmir3iudlm nmfvsas)sDtrxmoot1altnioctydlm2rlnvo u0artrio tytfpDr nei t)s2xr(o3iodlp   nvil( sDuaxr ;o1olen iciydlaDemnms ()tltnmr todopDelu s (0trtoxr3nodll e nes sfa2trx p;t4tptomf3iatlm2rmumo;u0tetrmfcoytoatranes s t2tmxrpno4lltnmfci tfarrax ooo4ole ii3tlsfsDea( p (4trxriocoy1omDrli slt0t2tmimpnudllt mivs (f rumur no4tpe io3iydla2um(vont4alxnxo3tydoaDe ieo t0srxrim3nodole livil( artr( oou0tlxn fciytfm2rmu sn()teeoxocoa1fmt ln i ( srtrimpno1openmnvi ()sDurur ot1oetnmictatfa2rl(msnt)trxrif oytfmteli i t)s2xrio3nudll   fvsas arurxm nt4ape moeiaslm2emuvs;()artoxr3ia1omDe ues;s)s2xoirpny4apenmicil()aDrrxr no4tpxoifciasla ua(mpnu)artnio iodfaD  ivsl(0srtmxo oo4altelicta()sDtmu ooo0oet mf3iys m elu pnt)tetnxf3iatomteli i (0srur(m oydamen nvtat arta( pnt1olenmo3ildlsDulu s u0aexomo tadlptr uvilt) 2urim3iu1ameemfcsas)srrau p;t4aexn i3iasfs2elu s u0arenmf3io1oa r ieo;s)seumiopiudlle licsat aDtrxmoot0olen f3ilt m rlnvp (0trtnir3iodoa rau i (0s2xmir3oy1omenlfci ()sDrr(rpot4olxnioeiytlm rln p (0texoif3iotomDe uvo s  2xr(mpnodllt mnei s  Draxr ;t1openmictld sDrlnvs;u4texnxr iydfa e ies;() rur(opnu4alte nctas srumxrpot4texoifctas s emuvsn(4 leomf io1fp r i i;() 2uoxrpiydolt  iet (f Dtru ont1olenii3tlt aDelnvo;u0tlenir3iytfp eluvi ( t2tr(opiodal e ictl() 2rrx pou1aptnio3ils aDumumpnu) etnifctotomDean o ()trumxopno4ap n ivt t  Duaxmp;o1tlx  o3iysla ea(vp;u) rtoif3ta1oat liei s  rur(opiudlp  licsasf rrax pou4olenmiciydfaDulu o u0artniociotlp e u s s0trxoimpou4oltnlieia(faDuaxr oo4olt  fciltlm ranmonu0 exomf oy1fm rlueo;(  2umiopoy1aleelnvs t)aDtmxm ou0opx micilsfa2uauvs;t4arermo3iy1latrai i;s  etm(r3oo4oltnlnet s)aDur(  ;u1apen i3tasfaDum( pnu)treomr iatlpDe i il() 2uo(o3iudolt lies t  rurxr ;o4tet iociltfmDeaump t0 ltoxf tytlpteluvs;t srxoxmpiudolenmivia(f Durxm ou0ale  o3iyslsDem( pnu0 etomf3ia1oaDelivs s)trtrir no4llt  fesa(  2tax  ot1apxoio3iyslsDrmuvo;u4trenmrciy1lat  u o (0tetm(m3ny4alenmnes t aDraurpnt1tex  ociytlm2emnmo;u4aexnmo3ia1lmDelieols)tetoxr3oo4lle  iesl( a2uaxmo;u0altn ieiatfm rm(vsn()teeomf iytoatran o () rumxmpny4altnlfct () Drru ono1tpxomfeildfs2rmuvonu)texoifcia1omDelnesl(0 rxo(r3oo1op elneiltf rtaxmo;u1olenmo3tydla2ul(mo u0 lerxr oatfmt anvs;t  euoir3oudalt  ivtl()aDtmx o;t0opeo o3iydfa2ua(vo;t4alxoxocoo1lp  lueols0tetmxmpoudlpen netlsfsruaxm ;o0apen ociys s ul(vp (4artnio3oydfmtrlueilt trtrxr nu4lmtnlfci t  rrrump;o4oltn f3iat mDemumo (4aeeomf3oo1fa raivolt t2xrxr iudll n nei sfa2rrx p;u1apx ifeiatlsDum( p;t4alxrmf ty1oa r nvils teuoim oudlpt mfvi s s2um( onu4aeenmf3tyslm eluvs u4arxnxr iytfatean s s0srtmxrpou1ll nmnvi t  rrr( ono1tee mfetydfmDemuvon(0 lxoio iadlate n olt  2tr(opnydlptelncilt) rurumo;o0ale  o3tytfm um( o t4 exoxocoytoaDeliesls0trtmxrpiodlltn iet sfarrm( oou1apxnif3tyd sDemnmp u)teermfcoadfp  li s;t0t2tr(r oydomtnlfetlt  2tr(m oo0aptomieildfm rl( pnu4tetnifctydfaDe ues s)sexmirpnu1ome  ictat aDurump;u1oetn i3tys mDrmuvs t0altoxf3totfmt  u i;t  2xrxr3iydllenmfvsa(fs2taum ;o4aleoif3tlt aDea( pnt)arxrxo oytlmDranes t  rto(o nodaleemnvils)sDua(r ou0alxomoctyt s2rm( snt0 reomfcootfpDeli olt s2uoim nu1omee fct t)arrmu  ;u1tlen oeild a el( p;(0 exoxf3ia1omtrli sls)trxmimpiudlpt mfvs (fs2uax onu0tlxnif3tadls eluvs;u)tltnxf3tadoa   ueo s)truoir oydlp e fct s)a2tr(r ot1ale ii3tlsfa2eanmpnt0 eeoirctadopteau s;s0seur(m nu4apt  icsa(  ruaur ;o0aptoio3iydfm2emnvpnu)altrioctotfm  lueo;t) rtrxr3iu1op nlfcia(farrax ono0oetn o3ildfa ua(mo;(0areomocoy1oaD  nvo s  exrir3nu1ol  mici (  Durxmp;t4tpeomi3tlt s ra(mo;t) ltrio3oytopt lnvslt s2uoxr nu4lpt lici (f 2um(moou0opeo octad sDelu snu) ltnxo3tatlpDrau sl( s2uoiopnydlmtemiciasf Dumx  ou4tlxnio3ias m2rm( pnt0 rxoxf io1fa rluvilt)s2xr(opno1olte ics sfaDrrxmpoo0oleomoetatfa2elump () leomo3ootoaD  uvs;( s2trxo ny1amtelfvt () rtmum no0tex mf3iydls2rm(vs t4tetoir todlat  uvilt0srxm(m3ou1ope  fci sfsrumxro;u0opxo feiyslm2el(mont4tetoxoctodoptr ueo t  2uoxrpoodlm nlfvsl() Dtm(moou0tlxn fctat mDuauvp t0aeeoir3todopDraivolt0 rxmxo nudoltemfet s  Dtaxr nu0aexn iciysfa2ua(mp u4alxoiocoatlat anvo;s)s2xmxo io1amee netl()sruru  ot0tee  o3tldfmDul(vs;t4altrir3oadopD ln i;t  euo(m3ny4lpeelnvs t)arrr(rono1tlenio3ilsls2rm(mo;t0 rxnirciy1op ranvs;(  2ur(m nodame  ncsatfarrruroot4aetnmfetls sDul(ms (0treoir totfpDr i s;t  eumxmpiu1ap   iesasf rur(mo;o1tptomi3iys s el( p ()tlxnxrcoadoaD au o t0s2xo(m3iy4omte fei (  2ur(m ;u0tpeo o3ias a rl(vpn(0alerirctatfm   n ols)seuoxmpou4lleemfvsa()aDrmxm ;t4aetnmociltfa2rmnvs t)teenxo tadfaD luei s t2urio no1lm  mnvt ( artaumpno0tlxomieiadlsDum(mp u0 etnmf3tatfpDeauei;()srurim io4ll nmnvtltf Dtr(  nt4alxnmf3tysls rlnvo (4areoif3oatlm rau o;s0 2xr(mpoo4oltnlnesasf 2rr(mpou4ope mfetasfa um( pnu0artrir3oy1lpteai i s)tetrio3no4ol e icsls)s2taxm ;u4alt mf3tas mDum(vp t)arxoiociytfaDe nvsl()trumim ny4amtelnetl()arumu ooo1oex  fetydla2ranmp;t4 eeoioctytlaD lieolt0sexr(m3nu4omt  nvs t) Drmum nt4oetnmicias mDemu p () lxoxo ta1lp   uvs;s)t2tmxm3nu1apenlieils)aDrmxmonu4aexnioetadls2em(ms u0tltrxo tadoatranvs ( srtmxopny4omenmfcils  2tm(m ;o1apx mictydfaDemumpnt0aetnifcio1lpDe ieo (0srur(mpno4opeemivi tf Dtru oot0apxomi3iat m2rluvs;t4 ltomf3ta1fa elieilt0tetr(r oydlptnmfvsas)s2tmu pnt0opxomieiyd aDrmnvont0aetoif3ta1fmteluvs;s0s2tmiopio4am elneslt)a2umxro;o1aetomieiadfa2rln snu0 rtrmrcio1op  anvi;(0 rur(mpnodope mncs (fsDuaxrono0aeeoiociydla um(ms;u) lxrif3oy1fptrau ils0trtmimpno4lp   nct t sDrr(m ;t0tlt mf3iytfs ean s u)alxnmo oo1fmtelivs t)trxrirpoudlme  ics () 2tr(  nu4openmociaslaDrm(vo;t) exrmrciydoaD  ueolt  etr(o nudome mivtls)artrxrpou0altnif3ils m2eau s;() eenircio1fpt  u i (0srxoio3oo4olt lnvs t  rtrxm nu1alt mictydla um(ms;(4 lerio iytom r i s;( truoxr nu1lm  mivt s) Drm( o;o1oet mfetytfm2rmnvp () rxnxf todfmD  ivslt0srtmir oo4am   feia() Dur(mpnu0aptn f3tysfs2rmn o;t0aexrir ia1lp   ivi s t2xm(opiu1lpeelicsls)sDtrxr nt4altn f3tadlm rlnmo (4aetoio ootlm rln s;(  rumiopou1ol nlfvilt  2um(mo;o0alxnii3tas a ea( o;t0 lerxr iatfpD lneo;t0teuoir3ou1lm e fei t)srtmum ou4alx mo3iytls rmnvo;t) eerxf oytlmte uesl(0trxoxrpoo4lm  lfei tf Dtmuroot0oex iiciatlsDea(vo;u0 exrmo ia1fp raneil(0srtmir3oo1oltnlfvsa( artm(mono1apen icild a ulnmo;u4aeerio to1oatr u s;t0s2um(m oo1ope  ics sf rrrum ;o0aex mfctasfm um( p;u) rxnmr to1fa elneilt texoxm3iu1amt lfvil(fsDrmx  ou0tpt ifeiad a2elumo;(4 reoif3tadomD aiesls t2to(o ny1lp  mnci s) 2uaxr oo1apxoifcilt sDulu s;(0aleomr3oatfp   nvils0s2tmim3iy4omee nes s) ruax o;t0tpeo o3iltls2el(vpn(4tetrxoctadfptrluei (0trum(r3nu1omenmietlt srtauronu4optoiociysfa raumsnt4teerif oatlm   iei;s trumir3iodome lncsa(farta(r ;u4opxo o3iysfaDul( pnt0tltnmfciydfp elueil( teurxm oudalt lneils)s2ur(mp;t4tlen feiyd mDra( s (4trxrio iy1opDeli o;t)s2umir3ou1ale  nciat)s2uaxrp;o1alen octysfaDum(vpn()tlxrmr io1fatr i o (0trur(r iudlp nmfcsls s2rmxmp;u0tlt  fetadfs ra(vo u4teerir3tytlm e ivols)t2trxm iy4amte netlt  Dtaumpot1tetoif3iasfm2eanvs ()teerxocootfa  aiei s) etr(r ou4ll  lfct ( s2rmxr oo1aeen iciadlsDrmn s (0 rerxfcoy1opDrai s;s)s2uo(mpio1amtnmfciatfarrmx p;u4tpt io3iasls rm(msnt4trxrir oatomDrlieslt0s2xoxm3io1ape lfvsa(fa2tmu  ot1aeeoio3tysfs elnmo;(4 lerxr3oy1lmDrlnes;s s2triopnudopt mnctas)srra(m nu4oleomociadfsDrmuvo (0altrif oodopDeanvi ()t2uriopoo1apenmfcil()sDrrxmpot1aet mo3iytls rmnms;t0trenir3iy1fp  anes (  2ur(o3oy4al nmnctas  rua( o;u4apt iiciasls em( o;(0aeenirctytomt  ivslt)setoxopoo1lleemfesas a2um(m nu1tptoiieiltlsDuan o u)texnif3todopDeli i;s0 2tm(r3oudoptemivt t)arrrurpou0aleniocias mDelnvo;t4 rtrmrcoydlpDe uvs t0s2xo(opiodape licilsfs2rmxro;u1alx iieiad a2em( s u4 etomfcoytfa   ues;t0s2tmio3oydam emicsa(fsruaump;u4aptnifctat a2ranmp;()aexnxo iatlpDraivol(0tetrxm3ny4ol nmneia(f rtmur ou1olxn fctytfaDem(vs u0 exniocoa1fp   ivs t s2xoirpoy4oltnliesatfsDrauro;u0openmocild m uau o;t0trenmr io1lm   u s ()t2tmxr nudoptnlncs (  2um(r ;u4tpt  i3tltfm uln sn(4tetomo tatom raivo;s0truoxo nodamen ictat artrx  oo0optnmociltfsDumn snt0 ltnir iadla eaiesls setmxr3oydol emiesls  rrmx ont0tlto ieiytfsDua(mp u) rxnxf3oytfm e i o s trtriopnu1lp nmnesasf 2tmx o;u0aee  fcild mDrmnvp t) rerio3iy1opt aueo;t)trurir3oy1ale  ict t sDrmxmooo0oetnmo3tyt s2emn pnt0tlenif3iatoptraneslt setm(mpoy1llt mfeia()sDurxr ;u0tet ifctad m ranms ()artrxf3iy1lpt  uvo;t0 rum(m3no1lmen ici s sDta(m no1tleomieiltla2ulnvp u) rtoio3ia1la  li i t)t2urio3oy4om nmfvsls)sDtrumoou1tlx mieiydlmDemnmsnu4arxnif todomD luvo;s  2ur(r nu1ole lnctat  rumurpnt4oee  feiyslmDrl( sn() rxoifciodla  ln s;s0teto(r nydom nlictlt  rrrx o;u0tlt ioctls sDelnmsn(4alermf tytfpD lnvs;s0trto(rpnydap  lfvt (fsDuax oou0aeeoii3ildfa ra(vs ()artnmo3oo1lmDeluvil(  etr(mpnu4olt  fet s)arrau  nt4aetn octytls2uauvs u)altoxocoatfaD aues ()srtoxrpiudap elnesas  rtmu p;t1olx  o3iadfs2rln s (0aetoxo iy1fm  lu olt)s2xmxo3oydol nliesls) rtrxmo;t0tleomoeiytlaDem(mp t4aeermr oydomt  ueo s  2tmxopio1am  mictls  2rmumooo4olxo oetad m eau o (0alxnmf3oa1fmD  uei ( trurim3oudamen fctls s2rrxronu1aleomoetas s2umu p;()trxnxf3ia1om eaueols s2xmir3ny4ol elfviat) Dtmu oot4ale if3tysfmDum(vo u)aetoxr3tatlaD  n i;t) rtrxo oo1lmeemfvt sfaDrmumpoo0opeoioetat sDum(msn(4texnmf to1omtrlieolt0 rurimpio4lltemnvs ( artrxr ot4olxnmiciltlm ranvo;()tlermrctotopteli s s0tetm(rpny4lp  mnvs s a2um(m ;u4aleoii3iadlm ulnmp (0texrmf3oatopDeluesls s2tmimpoy4lp emfes s)aDtmu ooo0aet mo3tltls elums;(0tetoxoctodfpDeai i;()t2uoxmpoy1ll emfvil()sruau pot4teen fciytlm2ra( pn(4altoiociodfmt luvil(  etmio3nu4apt mfvtls  rtaumpnu0oee ifeilt s rln o;(4aeenmocio1om raiei s  rurir3io1ame  fcias  2rm(ro;u1altomiciytlmDrm( pnu4 lxnxo iytfmt lues s0texoxo no1open nvia(f 2taxrpot0aetoiiciys m2ulu s (0trtrmf ia1lpDeli sls)s2tr(o iy1ol elncs ( arrm(rpot1alen i3ildfs2ul( o;t0tetnircio1opDrliei t0s2tm(o iydolen fctlt srurum no0ale miciysfm2elumo;t)altnifcta1fmt  ivolt s2uo(m3oodale lfvi (  2ur( p;o4oleo o3iytfm emn s;u4arenmo3oatfa  anvo s) 2tm(r3ny4lp   ncsas) Dtmum oo1tet if3iydfa uluvp;u0 rtrmf3oo1omtrauvs s t2xrio3iudolen ieta()artmx o;o1ape ifciadfs2ul(vs t4 etoxf iytlmDr uvolt)t2xm(mpoy4lmeelfctls a2tmu pnt0tlxnmoeilt mDum(vp u0aleomfcia1lmte i il()t2xrxopiu1ame mnetltfa2urxro;u1aeenmoctytlm2raums (0aexoif3iatoat aieo;( sexmxopiydlmtnmfcias)s2ururo;t4oetn oeiat m2ra( p u)tleoxr3oytopt li s;t0s2urxopiy4apenlfeilt srtrxmpou4opx ifciadlm rluvs t) lenmoctytlatrau s t0srtmim3iu1opt licsas arurx poo1tex moctlsfm emumo;u)trxoir iydomt ln o;s)texo(m iodlm  lfcsatf 2tm(  ;t1tetoio3iyd aDel( p u) exrif iadoate u s;s)trxrxo3nydoltn netltfarta(m ;o1apeomi3iatla ua(mo;t0altomo ia1latelnvols seum(r3no1ap nlnci (fsrrrxm no0tlx moetatfm2ulnvo;t0aexrxo ty1fa  aueslt s2ur(mpiy4lmtn ivils)s2rm(rpnu4apxo oetydlm umump t0texrmo3iotlaDr i o;s0 2xmim3iu1openmncilt)aDururpnu0tptnmoctytfm2uauvo u0altrio oo1lat ln i;( srum(m oodopee fvils)a2taurono0tlxoifcildfa2uauvsnu0trerir3iotomDr uei;t)trxo(o3ny1llte icia(f rrru  ;u1alxn iciydfm2ranms;u4 rxrxf to1lp r n o t0texrxrpiy1ale lncsat) Dtrx  nt0olxo fctytfsDuln s t0 exnmfcoy1lmDraivolt0texm(r io1amte ictat  rurxm ;o1apt  f3tlt mDeaumo;u0trxnmr to1omDrauvi;()tetoirpiydolee iei tfaDtau poo4oleoiiciytla2emumo;(4texrxr3iotlmteliei s0srxoirpnu4amtnmicsat aDum(mont1alx mo3iydfmDuauvpnt0tltrio oo1om  lieil() rtr(o3io4lpen ici ( a2rr(moot0alx  oeiltfm2rluvp u0alxrmfcoy1omD lu sl() 2xmxr3nu4amee net tfaDumxmo;o0alxn oeilsfa eauvs;(0 exoifciotomD lieo t0trtmxr iu4apen neias) Drrumooo0alt iociytfa umnms t4 rtoxo3totomtrluei s0sexmxrpoudoleemicils s2rmum nt0oetnmo3iasls2um(vs u) renxrciy1laDeln ols  2xmirpou4olt  net (f rrr(root1ape  icilt aDrmuvpnu4 ltrxf oo1fptrlivs t)teuo(opiy4ameelnetas a2rrur ot1tlxo fciatlm2uanvp t0teeoxfcoa1oatr ueilt  2xm(rpio1lpt  ncsas) rtrum oo0olxo fctldls eanms;t0artoxo3iotlptelneilt t2trio3oy1lmt livsl( sDuau  nt4tlxo i3tydlm elumo t)altrir3oo1opDeanei;(0 eurio iu4omee iesat)sDta(mpnu4olenifeildls rln p;t) rxrir ty1la r ueilt)t2xrimpoo1lmte fvtas  Dum(r ou4tptoif3iytfm2um(mpnu0 eeomo iydfp r ivi;s)s2uoimpiy4lpeemfcs ( s2raxm ;u0olt mieiatfa2uluvo u4trxrxocio1la  au i () 2urxrpny1omee ietlsfa2ra(r ;u0tlx miciyd a2em(vo;t)artrir iotfmD aieolt)trtrim3oodape livilsfsDua( ono1tpe mfeils s ua( pnu4tetnxfcto1lmDeaiesl(0sexoim oo1ope mfet sfarrmurpot0oeto ieiat a uanvs;t)tlenmr tydfp rliei;s trxmimpiydoltn ici tfaDua(m ou4oet miciydfa rmuvp t)tleoxfciotom eauvi;t) exo(rpou4ll n ncslsf Draxro;o1oexn i3tldfsDul( s u4tlerxocoy1op  au i (0srxrio iu1olen fvsltfartmump;u1aee mf3iydfm ua( p;t0aeermoctadop rai i (0t2xo(m oo4omenmnctls  2um(r nu1olxoiiciydla ranmpnu)tltoxrciodomDe ieils) 2xo(opiy1ameemivs t aDtrur nt1alxnioetydfm2el(vpnu4trerio iatlmtelnvs;t trurxr3iu1lltelnes ()aDrax  nt4openifeiyd s2uau p;t) rxrmo3oy1lmDrli i s0trurxo nudomtemncilt)aDumxmpno0texoifcilsfsDem(vsn()tetrxf3todfm  luvo t s2trxrpoy1lptn fvtat)srumxmpno4aleo feildlsDrm(mo t4tltoif oo1la  lnvo;t s2xo(m nodlme lieilt)aruau pou0alen oetasfa2eln pnt4 exrifcto1laDe n olt)srum(o ny4olte ivias artrxro;t1tlxn oeiysfm2emump t4arxomo3oadlaDeau i t0t2trxrpoy1lmt lfesl()srrmxm ot0tpx  fctyt m2umn o ()treoircoatlmDe ieslt0t2umxmpoy4lleelivt t srurx poo4apx mfcildls2ul(mon(4tlxnxo iotlp eanvil( setmxm iu4am  mnctasfaDtmurp;t4opt mf3tytfmDrmn ont0teerxo3oo1fp rln ol(  rumxr oudop e nes (fs2rrurp;u0ole moctasla elnvpnu0aeeoifctydfptrai s s0 eumxm3iudalen nvsasfa2um(mont4optn oetad mDean o;(4 lxrmoctatlpDr i i (0 eurxopnudomee icil(farumx  no0apenmoeilt mDrl( snt0tetomf3iydfm raivo;s tetr(rpoo4am emics s  rum(moot4opxoiiciyt m ua(vont0trtomf3ia1optraneo s)srumxr3iu4alen ncils s2tm(mpnt4oleoif3tytfm umuvo;u0tlenifcty1oa eaneols0teumxopiudlp  mfvslsfsDtau pou0tpen feiytfsDel(mp;u4 exoxf3oy1oatr i o t  rtm(r iy4optnlfesa(f Durxmpou0texo ocild s2rl(mont4trxnif3iadfpDrlu s;t) rtm(m3ou4lmt mieiat aDtmu  ;u1tet iieiad a em(vp u4trxoiocta1lp  anvi t  etm(mpou4ol elfct (fsrtrxmonu0olen ictatlm elu o;t)altnio oadla elieo;t0 eurir3ou1amtemivsa( srtrumpot1olx  ociys sDuan s () leoio tydlpDe u slt) exrxopnu1amte icsls) ruau o;o1olen f3iadfaDumuvp;u4tleoxo3ia1oa   i i;(0 rxm(mpoo1amee neil()a2rru ooo1teenmociydfaDuaums;t4 ltomocoodlateaueolt trurir3iodomtemneta()artm(mo;u0texnmo3iatla ulnvo;()areomrciotlaDe n sl()srxmxmpiu1lltnlfet tfa2tmxr ;t4aee mociltla uanmpnu0tetnio3ia1laDe nvo;t) rxoxo ny1olenlfeiat sDrm(rpnt0apx  f3tlsfs el(mon(0artoirciatoaD ln s;()srtm(o3io4opeelncsas aDur(mooo0aeeo fetyslaDran ont4 exrxo3iytomDrlnvs t  2xmio nodameemfeslsf Dua(rpnu4oltnioeiatlm2emnvo;t)aetnxf3oydla  aiesls) 2uoxm iudome mnvil(fa2tr(rp;u1ope ifciys m ea(vsn(0aleoxo oadom elu s;s0setrxo no1amee ies t) Dtrumooo4tpe mo3tatfa2umn s;u0 rxomfcoy1lmD an sls s2trxr oudllt lfvsas  2uru  nt0tetnmoctatfaDea(vo;t0aexoifcio1fa  ai s;(0truoxopoydop n ict s)a2ra(r ;t4texomociltlaDulu s t4 rermociotfp  lu i;( s2um(r3no4olee icsatf Duaurpnt0tlxomietadfaDul(vo;t) reoifctydlateli olt  etmxm iodlmt  fvils a2ua(m ot0texnioctytfsDua(ms t) leomo iotfpDrliei () rum(m no1ol emfesas srurxmpnu0tetoio3iltfa2elumo;(4trxnmf3iatom   uei;s srxoir ou1lm  mfcslsfa2raur nt0aeto fctysfs2rmnvs;(0tetrxf ta1lm  aueo;t)t2uoir ny4lmen fesa(fs2um(mp;t0oleo feiat mDumu p u)trtoxocio1fateluvo;t)trxoxo oo4lpt  nvs s aDrr( poo4oex ioeilsfa uln o;(4 rtrmfciytlm r nvslt)tetmio3ny1lptemfvtl(f rumx o;t0oltn o3tadfs rm( p;t0tltoxocoo1lpt li o s texmxopno1llenmics ( artmxmo;o4tex iictldfa2eln s u0areoif3io1oaDe nvsls t2trir3io4apee nvs tf rurump;o0oee mi3iltfa ea( on(4aetnxocoa1om  auvils  2tmxr nudlpe mfcs ( s2uaur no1oetnifcilt aDumn pnu)alxomf oo1oate ieo s0 2toirpno1lmte ietls s2umxmp;o4olenmfeiltfs em( on(4treoir3oa1fm elnei;t0srur(rpiu1om   fctl(f 2tmum ou4oltnif3tatlsDrau s;(0 leomr iadoat ln i;( t2uoxopiodol nmfcslsf 2rax  no1aex  feiat m emnvp;u4aleoxrciadlp   n ils0 rxoim3iu1om nlivilt)srtmxro;t1tpxoii3iaslmDeau s u4tltrxfcoy1fm   ueo s)srtrir3oy1om emncsl() 2rr(m oo0aex moetlt m rauvpnu) lerirciy1laDelues;t0trur(mpiy1optnlnvslsf rrau o;t1aeeomo3tlslsDrlu o;u0aexoxf3oodlptr ivo;()s2trxo io4lpe mnet () 2rru o;t1tetomfctlsfmDulu ont4tlermf oatfa e nvsls) rxrim iu1al n fvsat a2uax  nu0ope iieiyt m emu o;t)tlxnxfcty1fa ranei t0setrirpiy4ol emiciatfartr(mpot1optnmo3ils sDul(msnt4aexrircoytfpD  nei;t) rtrxo3oo1am nmnvt s)sDrm( oot1tetniicilt sDumn pnt0 leoxf3oa1faDe i i;t)seto(opnodopee ict s sDumxrono4aleo fetld m2eluvsn(0treniocta1laDrlnvsls) ruoxr no1optnmneslsf 2ra(mp;o0aex mo3ildla uauvs (0trxrio3oa1omDrlnvi;( trxmxo iodll e icils  2raxrpno4oexo i3iadfm umnvs u0aexrxf tadfaDe i o;t0 2urxm3oy4lp nlfesl()aDururp;o0tet iicildlm2uln s u)aexoxrctadfp elnvilt0 2xo(m iy1alen ncsat  2rmxrpot1alenmiciytlaDelu snu4 rtrifcoodfa  ai slt trtrirpoodomt mfcs (fa2tm(mooo4ale  ocild sDel( ont) lxnmo iadlpD luvi;s teur(m3nudll   fes tfa2trurp;t1opto ociatlaDua(vo;(0 rxrxf ootomDe i i;t srxo(o ny4alee ivi (  2uaxmp;t0oeeomietysfs2um( pnu0 reomfctatlmD  u il(0seurxo3no1ape micsl(fartaxmonu4apt ioetldfmDemn on(0 etoio tydlatran i;t texmxo3iy1lp  liesa()aruaur ot4aetnifeiyd a ulnmpn(4texrmf oatlat aiei t0texrir no1olt mneil() Dtm( o;t4opxoifeilt sDemnvp;(0aetnio oa1oa rauvi;s0s2uoio oudomtemnvils aDuaxrono1ope mfctatla2eluvo u4 reoir3iatfm ranei;(0 rurxm3no4oltnlivt sfa2tr(rp;t1apt mfeiat sDemnmp (4aexrmo3oo1lp eai o t0srur(m3iy4lm e fvsls srta(  nt0tlt ifetls m ean s;u) rtrif iydoaD luvs (0 rur(m oodomenlfei s arrrurpoo4oetoiocils m ulnmo;() exoxf iotoa eaivs;t0 etoim3oo4amte fvi ()artmur nt1ole  o3tat s eln s () lxnmrcoadoa r n o;s  etoir3iydlpeemnvsasf 2um(r ;u0tptnifetad a uln p t4 lxoxrctotoaD  n olt0srtr(o no4llen ivi ( sDrmurpno0ale mfctltlm umnvp;t4alermo oodfmtelu slt  2xrir nodaltnmnvs ()sDtruront0apxo ietysfa2umu pnu) leoxf3tydfa eanvs t  etmio3nodalee iet s) 2taxmpoo4apen o3iys mDrlumont0 rtoif3iytfmtelnvo t0t2uo(mpoo1ol n icta()artrxr ;t4teto ieiad m2rm(mp;(0alenmrctytfpD lu o;(  etrir3no4ol n fesa(  Dtr(mpnt4tet miciasfsDemnmpnt)tetniocoo1fa ran s t  rtmim iy1lptnmnet sfs2ur( ono0opt ifetyslsDem(mp;(4aetomo3oodfaD lueilt)sexm(opoo4oltelfvta()artm(m oo1alxomf3tatfs2um( sn(0 exnmf3oa1oat  ivslt)srxriopiu1ome  ncslt a2trxrpnu0optoif3iydfsDrl(vs;()alerio3tatfp e n il( t2uoxr iy4lpt lfviat)arrauro;t0teen fcilsfs2ranvp t4trxnxf ia1oaDraiesls  2uoxmpoydom elivtlt) Draum nt4aet ii3iys a um(mp ()aeenxo3ta1oaDr uvsl()trtmio io1lp  lncsls  Dumxroou0teto feiltfm emnvonu0tlerir3oo1lmtelu o;t0texrxo3oudopenlfvta()aDuaurpno4oet  f3iydfs2eluvp ()texomo3oo1lm r i s;s sexmim nu1ole mnvtat a2um( pno4aee mfetyd s ran p t0 renmfcia1oat  ueolt0 2xrio ny4lmtnmfciat artrxmo;o0opt mieiad s2raums;u)teerxo oatfaDeauei;t0s2tr(o iu4om  mfcilt  2rm(r ;u0tpt iiciysfaDrm(vsn(4alxnxfcta1opteluesl( trxrir iodopenmnvta( s2ur(  ot4aexo oeiyd mDraump;t4teerircoy1lpDeanei;()trtrxo3nudopen nvsatfs2urxm ou1aeto i3tyd aDul( s;u0altnir tadoa elivils0s2toxopny4ol elivta( arrrurpou4aex mo3ilt m2rauvsnt)trenmr iodfa  luesls0t2xm(m3iy1lpt  nvtlt)sDur(mpoo0tlxoio3iatfs2rmnmp u4texoxr oytopDelnvs t s2toxm no4lpen icta( s2uaumo;u1oee  ociasfsDrm(mp t4arxomf iytomD an o;t0srxoiopoy4opt mivilt)srtax  ;o0aetoiieiyd s ul( o;()alxoxr tatfm e n i;t)srxoim nu1apenlici sfsDtaxmpoo1tee miciad s rmuvon(0 renmrcta1om   uei t0trurio3nodale lfetlsf rtm( pnt0alx  ictyslm2ra(msnt)alenxrcoodoaDrln s;( teto(m iodlmt mnct (fa2rmumoot1oee mictydfa2ran p (4tetrir ootfmDranvolt0teurxo3oydalt  nvi tfarra(ronu4apen ieiyslsDuln o ()alxrmf3ta1oa   nvols  rtmir ou4open nct t) rrm( p;t0alto f3ias s2rlu snt) ltrmfciadlaDraivs t) eurxr3oo4apeelneia()aDtmu ooo1oee mo3tltfaDum(mo t0tltoif iydom rli i;s)trtr(r3oydllen nvi tfsrua(r oo1opxomfetyslsDrlumsnu)teeomo3oytlpteaneo;s)texr(o nu1lleemfctls) rurxro;o4aet ii3iad mDeln pn() rtrmrcoytfptrlnvi;( trto(m3nydlmenlnctlsfarumxr ot0opto o3tasfs emnvo (4artnmr iadlm ranei (0 exr(o3iudaptemfvslt srrmumpnt0aexo ictysfaDeanmpn(0tetomf oo1fpDeli s s)srxm(m3iu1apt  fcia(f 2urum ;o0tpxomo3iat m2umuvpnt0alxnxr3iadlat ai i;s tetoio3no1openlfvi s)srtrurooo4opt micils s2el(ms (0trxrxr tadoa eai ols t2tr(r nudllt  ieilt) 2tr(r ;u0aleo o3ilsfm2rm(vs;t0 rtrio ia1fmte i i (0srurxr3nu1am emietl()s2rrxroot1altoii3tls s2ra(ms;u0 etnmoctotlp  anesls0 euoxm3oodame mfcslt a2rrxrpou1ape ifcilsfa2eanvp u0tlerif ia1opDr u ils0texoxo oy4amte fes t)sDuaxroou0tlenmietyd s ra(mo;t)areoif3oatlm r nes;()sexmimpiy1lp e ivt ( srrm(root0olen fctlt s2umnvp;t4trenif oa1fa   nvslt0s2xm(r io4opt mics sfsrurx pnt0olen i3iydlsDemu o ()areoiocoytfaDrai i;s)seuo(rpiodal   netat s2raxmo;t1tle ifeiltla uan o u4teerif3oo1fpD lneol(0teumimpiy4ll nmncilsfa2ra(m ;o1aet mfcils m2uauvp (4aetnmo3tatopt anes;(  2xmxo iu1lmtn iei s) 2um( p;u0opt  feilsla el( o t4 ltoxf3tatlaDr ivi;t)tetmio nu1lpenlfeilt) Drr(m ot4tpxo feiytla2rm( s;u4 ltnmr3io1oaDeau s ()srxoxm3nu1ameelici s  rtm(  ;o4oexnifeiasfa rmuvo u4aetrmf3iatlm  au il(0t2xmim oodom e ivta()arururooo1tetnio3iasls2ra(ms;t0 rxnmf tytlpDr ieo;()srxm(r3oo4omtnmieta() 2ta(m no1teeo f3iytfm2elnvsn(4 rtnir oy1opteai s;(  2xr(m3oo1open nvtas)arurumo;t1tpeo fciltlsDran s (4alerxo oo1fa eai ils0tetrxr3iodop  mietatfs2um(  nu1teeomi3iasla emnvon(0alxoif tydomD  i s t) eto(rpoo4omtnmietl() rururoou4aet moctad s2eanvon(0aexnxfctydfmtrai s;( srxrimpou4omtnmivils aDrm( pnu0alt  iciysfa elumsnu0texrir oa1oate ivsls0teum(o oydap elnvtls  rtrx  ;t4aee io3tad s2emump t4 ltrir ta1fm   n sls)teuoir iy1am e iei sfs2ur(  nu4aexnmoetys m emump (4tlenxocoydfmDeli i (0t2umirpoydlp   nvslt a2tmum nt4opeomfetydlm2raumon(0 rermfcio1lpteli o;t trurim nu4lmt livs (fsDumxr no0oet  feiatla rm(mpn(4 lerifcoo1op e nvs;()trtoxr nu1lltelnes t)artmxm ;o4ape ifeiltfsDea( o;t0 ltnmr3totfa   i o;() 2toio iodal elivtas)artaur oo0tee  ietlslm2rl(mo (4 rxoxfciodfptr ueo t)texmirpou4ol emnei s)a2rrxr ou4oexnmi3iys s elumo t0 ltomf tydlpD ai i;t setmio3oo4ll  mfes sf 2ua(rp;o0apeoif3tatfm2rl(mpn(4artrxfcootomtrauvsl()t2urxo iu1om  mnesa(fa2raurpoo1oltnif3ias s uluvs;(4 rxomociytfpDeau o t0 etr(o3nu1alenmies ( srtr(r ;u0teeomo3tlsfmDum(mo u4 eeomrcto1lptelneol() 2xmim3ny4olt lnei (fa2umum nu4teen ietatlm eau s;(4aexrir3oa1fmD an s;s texo(opnu4ame mnvi t)aDrauro;o0opeo ietls aDea(vsn(4trerxf3iado
\ No newline at end of file
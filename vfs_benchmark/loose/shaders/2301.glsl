@@ -0,0 +1 @@
+i o;s trtr(opnu1amenlfesltf Dta(r ou0altomi3tydfm ea(msnt4tetomo iy1lateauvi ( t2tmir3iydam e ici s sruaump;u1tpenmoetltls ra(von(0teerxf3iadfmt lneo;t) eto(rpno1al e fcsas  Dtrxro;u0apeomoeiys a2eanvpn(4 exrxr3iydom  anvo;s s2xoxr no1lptnmfeiatfaDrmxrpou1tle  octys aDulumo;t) lxnmr3oadfptean i t0s2tm(r3ny4ll elici ( s2tmuront1aleomfciyd m2ul(msnt0alenmociotlm rlnei (0t2xr(opiudll e fvilsfsDtm(rp;o0texn iciyt mDumnvsn(0 rermf3iadoa  auvo (0trxmxr oydamt mivsltfaDur(mont1aexomo3ilt mDrm( pnu)arerxfcoo1fp eau i;( srxrxopio4oltemncslsfarumxm oo1tpeniietytfsDum( on(4teeoirciy1opt au il( srxoiopnodomeelivia( aDraumono1tpx ifetld s2ul(mpnu)alxnir iy1lpte nes t)sruoir ou1ll emnvtasfaDrau poo0tlxnmfcils m ulump (4teenio3oy1fatr iei (  rxmxo oo4apt  nei (fartr(ront1teenmoeiatlsDrln p;u)teerxf iatlatrlnesl()srtmxr nydam nlneiatfaDrmxr ;t1optnmfctysfm2ra( s;t0aetnmocoytfm r i s;t0tetrxm io4ll emiesls)sruaumo;u0apxomfetad sDrln p;t) lenxocoydfmt  uvi;t0 2tmirpiu1am  livtlt) rumxr no0tlxnmociyslmDemu o;t4 eeomf ta1om rluei;t0texoxr3oudllenmiesasf rrrx ooo1apt ifeild s rmuvs t4 lxomo3iadlp  aueo;t0 exrxrpoodlltn ncsltfs2tr(ro;u0texn ieias m umnmp u)aetomfcoa1oaD  n sls) rum(m3iy4ap nmnvta( aDrax  nu0apx ii3ias mDuanmo;u)trtnmf tadlp  ai ol( s2trxm oudlpt mnesas)a2um(mooo0aexoifcilsfa elump (0 rerxfctydoaD au olt0s2to(rpiy4omenmfetls a2umx o;t0opt mieiydls uln s ()texomf3oadfmDrlueol(0t2uoxmpnudoltelfei (fsDra(rpoo4tptnio3iadlmDel( s;t0 etrxf iy1laD an il(0t2xmxr3iodop  lnvtas) rtmx onu0oeeo oeiadfm em(vp;u0 rtrirciodfpt lu s;() eum(r nu4lpt mieils) Dra(rpnu1oee moetydla2emn p;u)alxrmfciydfptelies ( s2xr(m ou4ape  nvt t  2taurp;o1teenmoeild mDrln p;t0aexrmo oatfa rauvi ( t2xoim3oo4lmen feil(fsDtru o;u0apeniociatfm emumo;u4 exrircoo1lmDrai sl()s2to(mpnudol n iciasfa2rrxm nu1tptomiciyd a eluvo;t4altrxfcoytopD ln o t)srtmxmpiydlpt lnvt (fsrrmxm ;o4oleomfcild mDua(mpnu)tetnmr ty1lat ai i t0seur(o oodll  mietatfa2trxr ;o1altnmieiysfa2elump;t4treomrctatlmD anvo t) 2uo(o oy1am   icta()s2rax p;u4aeen f3ildlmDuanvonu4alxomfcoatlate neo;()t2tmxm oodlptnmfctat arurxmpnt4texnii3tldla rmuvsnt4tltoxr3tytom  ln slt0 rtmxo ou1lle  nciltf rum( o;t4openmi3ilt sDrmn pn(0trtoio3totfatrli i (0t2uoxr3oo1om n fcils srrmxmpoo1tee  iciydls2ra(mp t0 etnxr oydlatr uvolt)t2toxrpiy1omenlivtl(f Dumx pno1oexoifeildfm2um( o;(4trxrxr3oodfaD  neolt0s2xoim3no4lpenmfet s a2ur( ono0tptoiictlt sDean o;t0trtnmf3ia1lpDr ieol( srum(r3oudap nlnvi t)sDurxronu0aptnifciydfaDeauvsnt0aetrmrcty1lat an s t0 rxo(r oy1amtn ivt (fs2trxrp;u1tltomo3tytfaDra(vsnt0aexoxr oytomDe ivo t  etmiopiu1altn nvils  2uru  no4aleoif3iyd mDrluvp (4treoiocoadfm eli s ()srtmir io1lle  fct sfa2tauroou0ope  f3tatfa emu pnu0 leoio3to1op   nvilt s2xrxo3iu1lm e fvi t)aDra(mo;t0altniieiatls2uanmp () exrxociy1oaDelues (0 exo(r iudomee nesls)s2ta(r no1aeto i3iyd m um(vs;u)alxoxo3tydoaDe n s s)t2umxo ny4lme mnet sfarrax o;t4oeen ietyslm2ua(mp;u0 reoif3oy1oa  lnvi;s0 2trxmpio1om n iciat srra(  ;u1apx mi3iytlmDeluvo t0altoifctotfa  li s;t0 rumxm oo4optnmneilt)s2trumpnt0oeeo oetydls eanvs u0tetnmfcio1oa rlueolt)setr(o oudll  mfvtas)srraurpnu1texn icildfm2ean o (0 rxoir oytlat aivs;t srtmimpiy4apt  fvt t) Dur(  ;t1tee mfeilsls ea( o;t)tetoxrctydopteliesl()teumio3nudomtnlicsl( a2tmxmpnu1tpe iieiatfsDrmu o;() lermo3iatfmt anvilt0 eto(opoo1amtelfetl(fs2rr(  ot1optnmo3tatfaDrl(msnt0 eenmo iy1fptr ieolt0 eumxmpnu1lp n fcs s)srtrx  ot1opeomieiad mDrln o u0texnxo iydoaDrli o (0texrir io4lme mfvi s artru  nt4alxo fctlsfs rmnmpnt0 rxrmf3oadlp  ln sls0srxoiopno1apeelnvsas arraxmp;o1tpe  icildlsDem(vp u0 lenxrciydfmtraies (0truoxr iudlltnlnesasfsDtrx  oo1olen icilslsDuanvp;(4tlxrxrcoydomtraneo;t)sruo(r3iy1aptnlnctlt srum(  ou1teen fciltfs rauvp;u)teeomo ta1op rluvo;s  2xoxr3oydamt lictlsfsrta(root0apen o3tytls rln s;(0artnxo oatopD lu ol(0t2xo(o3nydoptn ncil() 2trx ont0tetoifeiatfm2em(ms (4 ltrxrctadlp r i sls) rtr(o iy4llte fvias  Drmu  ;o4oex mociyd a2rln pnt0 lerxocta1fm e nvi;s s2xrio3oudlpen nvi (f rtm(ront1aeenifcias a rmuvon(0altnif3iytlaDe u i (0srtmirpnudll nmnesas) Dra(mono4olt mo3iytlm ul(monu4trenxf3iatfpteanvi s  2xo(m ou4lpt  fct t)a2tr(mpnt4oleomoeiadfa umnvs;()artrir totom raivi;(0t2uoxmpny1ap e iesl( s2tmump;o4tltnio3iysfaDrl(mont)tltrir tadfpte n olt0trxmxr3oo1alt  icsat) 2ua(mp;u0apeo oeilsfs umumont) eerxocoodoaDeanvsl(0 rtr(m iu1aptnlics tfsDur(m ;o1teeo fetlsfs2uauvo (4 ltoxfcoa1fa ran s t0srxr(o ny1ale livs s srtr(ro;t4teen iciasfs2uau p t)tetrxr3iatop rlneo;t  rum(r3no4al  micsat s2tmxmpnt1tee mocils s2uanvont0trxnxocoodoptrlnes;t)t2umio3oy1lleelicil(  Dumx  nt0optoii3iydlsDulnvon(0altomf iotfm  luvi s  etm(o3nudol nlfvi t sDtrx pnu4olxniociysla2umumsnu0aeeoioctodlmtr uesl()trtmir ou4lptnlfeta(fsrrrum ou4tptnifeildla elu s t) rxrirctydfpDe nei s)trum(r nudopeelies (  Dua(mp;t0opxomictltlmDumuvo u0arxnir3oo1op rlieolt trtmxopou1op elfctl( aDtaxm ;o1tet  ociatfs2uanvpn(4teeoioctytlmtrau o;t)seuo(m3ny1lmen ivsltfs2tru poo0tpto oeiytfs eln o;t0aexnxr to1fmt  ues;s) 2ur(m nu1ol  mfes t)artau p;o0aexomoetat a umnvsn() lerxr3iytfp eauvols)texm(r ou1ll elfvil(fsrtm(mont1tleo f3iatfmDeau p (0tlxrio3iytlaDeau ol( s2to(o oo4amenmfes (  2um(r nu4oexnmfctyd sDum(vs (4 leomo3todfp  aueolt0 ruo(m3iy4ol nmnet (  2tm(rpno0teenif3iyslm rlnvsnu0 ltnmo3oydlpDe iei s) euo(rpoudapen iet sfarur( pno4aeto o3ilsla emnmp ()tlxoxf3tadop e uvo t texoiopiudomtn nci s  rua( pno4alxoiietytlsDea(mp;t)altoif tatoaDr i s;s teumir3iu1apeemncias arua(mo;o0oeeoii3ildfmDraumpn(4aetoio3ia1fpDean s ()s2xrxr3oy1lp nlnvtls) ruaum ;u4tle iociadfs ean on(4 rxomr3oy1fmDranvs;(0trxmxo3oodlp   ictas  2rm(rpou0oexn iciltfaDran p u)treoir ia1lmt lnvol() 2urxm3no4omee fei ()s2rax  nu1tlx iocilsla rmnvo;u4 rxnio oa1omDrlueil() rxm(o nodam elncsl(fa2tr(mpnu0tet mociatlmDea(ms u0 lerifctotlateauesl(0 2xoxopnodll   ncta() rur(mo;u0aexnii3iytla2uanmo u)alxnmo iy1laD  nvi;(0 2umxo3no1olt lneilt  Duaum ;u4tlxniieiasfa rmn on(0 reoiocty1lmD lnvilt trtrir3iydlmtemncsat)a2ra(r ot0oexoiicilsls ea(vp;(4treoircto1lmD lues;s teumimpiudalte neslt)sDrmxro;u4altnmo3tydlsDrm(ms;(0 lerircoo1omteluvslt s2uo(opiu4alenlieil(f 2rm(r ;t0openii3tydla2ranvp;u4aeermocootlmDraueils srumir io4llt mnctatfarrmxrpou4apxomociasfs ul( o u0altoif oy1opDrlieo t)teurxm ny1omte fvsat sDrmuronu0tpxnmi3tys a ra(ms;u0aeenxfctodlpDrlnvs () rxoxo3iy4olt lneiltfaDumx pno4oetoiictatfaDran pnu4aetnxocoodoa eliesl(  2uoxr3nodam emfetl(fa2tmu pno0optnmicias s2uauvo;t0 ltrmf iadfp   iei;t srtm(opnydlleemiet t aDtrumo;o4tetoioeiydfs2el(vonu0 reoxrctatfmteaieols0trtm(opny4om e fviatfaDtr(ro;o4tltoiicilsfsDrmumpn(4altoxf oa1omtrai o;t0trtmxr3oydom  lnvsls) Drm(  no0teeoiictyt s2um(vo t4teenir3totop elivol() exr(r3iy4om   ivsas  2rmuro;t1tptn ictyt a2umumsn(4alxnxo3iytfmDraueilt) rtoxr3oy1ole lnet tfaDta( o;t1tptnif3ild a eln o;u4 exnmr oy1laDrau s t t2xmir oydlptnlfcs s) rumxmp;t1optniieiyslm2umnmp;t0tltrmrcoatfa rlu ils)tetmio3iudlmt  feslt  2trxmpno0oet iiciyslaDuanms u0trenifctodlptrln i ( trur(m3oodaptn iesat)aDurump;u0open feiasfs ulumpnt0areoir ta1la  auvi;( teto(r3oudome micil()s2rm(mono0aeenmfctlsfsDum(vs;(0 reoxf tytop eli ils  2xoir ny1op nlici t)arrau pno1opeoif3iltla eln onu4 ltrxrcoadla r uvilt t2urxo oodop nmfvsas) rtax poo1oex ifcilsfaDumn sn(4tlxrmf tatfateau olt0t2xo(opoodlm  lnet ()arur(mooo1oetoii3iltla2ul( o t) rtoxo3oatfat anvs t seumimpiudol n fvtasfsDtax oot4teen ociytfmDrmn onu4 exoxo iodoatrlnvo s)seumxopno1apee ncslsfaDrmxmpoo1optniietysfm rmnmpnu4texnxocto1lmtranei;s) exo(o3nu4alt mfcia(fa2tmur oo0olt io3ildfm ulumsn(4artnxo oodopteai s;(  2xr(rpoudome lnvtl()srrrumpnu4altn oeils s uanvon(4 etnxfciadomD ai s ( srtoirpoo4oltn iei t arrmurp;o1tle ifeildfm2ulnmp;u)aexrmf iydoptelieo () 2xoxmpny4opt  fet t arta(r nt4oexnmo3iadls ulumo t4texrmo iydfp   neol()srumimpnu1lltelnvs ( artmumo;t1apeoifeiytla2um(vsnt0trenir3tytfmDe uei;s)s2xm(r nu1alenlivtl()sDurumpoo4apxn oeiatfm2ran p u)tlxrxfctotopt  iei;( texoxo iy1ll e nvia(fartmu pno4alx mi3ilsfsDea(vo u0treomr iotoaD  ues;s)t2uoiopiu1lpeelict s)aDtmu o;o4aet  oeiadlm eaumpnu4texrmr tydom e n o s  eum(r3oo1ope mieiasfarrmum nt1aex iieilsfs2el( p u)altrmo3tytfa   ivi;()sexmxm oy4ame  ies () rtmx  nt1oeenmfciat sDrl(vp;u)texnxf todfateau i s)t2xrxr no1olenmfcslsfaDtmurooo1oeenifctyt m eanmsn()aetnxfcoytom rau s s)srxm(opoodlmen fvs t srurxrpnu4tlxniietlt s ran pnu)tltrif3oytop e nvi s srurio3io1lm   icsl(fsrrm(mo;t0tlxnmocilsfm umump;t)altrmr iadfa eluvil( tetoiopnu1alenmfctasf rururpnu0opt  fciatfaDranvont4trenirciatlmtean o s0teuo(r3oy1ll n neils)srtau  nt4aeenifctydfs2rm( s;t4 lxrmf iydfmDe ivo ( setm(mpnydllenlncsa(fsrua(ro;o4open o3iadlm2rm(vsnt) ltrif oadoa rlivo;t)seurir3io1lpte neilt  Drr(rp;o1alxn i3ildla ea( s t0aeenmo3ootoa  aieo;s sexrxo io4amee nciltf 2uax oot4tptnmf3iatlm rlnmp (4aexoxr3ootfmteaueo t0 2to(o3io4altn fesasfs2uaxrpnu0tltnmo3tydlsDean s;u)aeerif oodoa eai s;(  eur(m io1aleemivt s)sDtmum ;u0aexomieilsls2emn o;(0alxnmr3iadoat li ol(  2uoir3nodapte icsas)sDtau  ot4tlxnio3tasls rau on()trxoif oydfpDe nvsl( teurir ou4olt liei (fa2rmurp;o1tlx mfetld m ea(msn(4 leomf oatfatrlivi;( s2tmxopou4ome mieslt  rtmuro;o4tlt  fctldfm ul(vpnu0alxnif oo1omtrlnvs s) 2tm(o3nudop  mfetat)artruro;t0aleomi3tysls rmn p u) ltoio3oodfaDelu o;t0s2um(mpnu1lme  fct ( artr(mpoo4apxnioctltlsDemu s;u4tlxnircoatfpDrai ols)setr(opno1ole mncsl()aDurx pno0tle  fciadls2uanmpnu)tlermoctydfp rai i;s  eurxm3nu4oltelfctasf Drax oot0tetomociat m rluvpn(0altrmr3totfp r ivi s)srxoir ny1amtelfeta(faDraxm ;t4olen ocildlsDua(mp (4 eenio oo1om e ivo;t0seto(o ny1omee icsls  2tru oou4oex  f3iaslsDra( o t0trerio oadfaD aies;t)teuo(r iodll nliet s arrruro;t1olx ifciytfa2uauvs t4trxomo3tydfpD lues;(0sexm(r3iy1am e feias sruau  oo4olxoiieiatla2emnmsn(4altoxfctatopt au o t0srxr(r iydaltemnctltf rtr(rpnt4texnio3iytlaDrl(mo;(0 rtoio3iy1lp  lnvs;t teur(m3iu1alenmncsls)aDtaxr no1opx ifctasls eln snu4 rermrciadopD li s t)trurir iodllee ietatfsDtr(  nt1oleoioeias mDuln p (0aexomr3to1faD anvi;(0srur(r3nu1ll nmies s  2raxrpot4olxniiciadla umuvsnt0 lxoifctadlaDrau ol()s2uriopoydapenlnviasfsrraurpnu1tleomfetyt s rluvo;u0 lxoxr ootlpD livslt0srtoimpno4olenlivi t arrauront0tpt mictat a rlu o t0teermoctadoate nei;( s2umir oodap e iet t srum(  no1tle  oeildfs emn o u4aetnxrcoodomDrai o t0setoim3iodamtnlnvsa() Drrxmo;o4opxnmfcild m2rl(vp;t0aeerifcoytfp r u sl(0 rtoiopoudamte ieiltf rua(mo;u1aex  iciad a2ua(ms u)alxnir3tadla e i olt t2xo(o3ny4amen ictatfsDrax  ou1olx  oetatfaDemnvp;(4aleoxf3oa1lm  luvsls0 exmir3oodoptn neia()sDurum ;o1olxomi3ils a2emuvo t4tltnif3iytfaDeaivo;s) rur(mpnu4am nlnci t)aruaxr oo1apen ietatfs2el(vp u0 ltrxrctotop   nvs s  rtoim3nu1amt liei sfsrraumoou0oeto ieild m elums;t)tltomr3iydoaDe n s;( tetmxr ou4ap elnvt s) 2ra(mont1aexoiietas aDelnms t0trxoxr tytlmDe n s (  etrimpou4opt  fctl(  rur(m ot4teeoif3tat sDrm(mo (4texrxo todfmtrlies;(  etrxrpoodaltelfvias) 2tmurpno0alx mo3iyt a ra(vpn(0 ltnircoodlmD ln o s0s2xoio3ou1al nmicslt aDrr(rpoo1alxoiociltfa rm( ont0 lxrir3iytoaD aueo t trxmio nu4lltelfci (  rtr(rp;o0oltnmfeiydls ea(mont0 exomf3oa1fmD luvilt  eumxm3oudlp nlfvtls artm( poo1apxomieiaslaDrl(mo;u)aexrif oo1op  ai i;(0s2urimpiu4lmeelivsat) Duru  oo1tlxomieiydfm ea( sn()artomf3oatfaDeli slt)truoxopnu1al e ictas a2trum no4alenmi3tyt aDuan p;t4 rtrmf iydlat  neolt0s2ur(opiydlmeelivtl(f 2trur nt1tex ioeilslm2rau o u4tlxrmfcoatlm  anvo (0s2xo(m ou4apee nvtlt  2taxmono4tpxo iciyt m2ulnvonu) rtrxrciotlp  livo (0seto(rpiudalte nesa( a2rau pno1optnmf3tldfa elnmp u)alenxociytfmt livi;t) exmirpnu4ame  ncslsf 2ta( pot0apxnifciasls2uanvsnu0aleomocoytfm r nvslt)t2tm(m iy1apeelivtlt) 2taur ou1tlx if3iydfsDua(vsn(4trtnmo3iytlmD  uvols)teumxr3oodlpe mivils)arra( oou1aleoiiciyt mDul(mpnt) ltnmociatfpD lieils  exoxr nodll   nvt s a2tmum ;o1tpe iietydlmDrluvo t0trtoir3oodlm elneils  2um(mpiu4lmeelfcs tf Dtax  ;t1aetnioctld s ranvo u)trtomfciy1fpDeluvsls)s2xr(rpiy4lp elfvsat)s2umurpnt0aee moeiytla2um(ms;u) ltrxrcio1opt lues;() exm(r oydam emivtl( a2ta(mp;u1olxnii3tld a2em(vo (0texrmr tadopDrlueolt texo(m3iudopeelnvs tfsrraumonu0tleomfciatls rlump (4trerifcoytlm  lnvsls)sexrir3iy4ame mnesl( aruax o;u0oetn o3iyt mDem(mp;(0tlxnxf oadomDelieo;() 2xmxm3oy4optemivt s)sDuaumo;t0tpenmi3ildfa rmu o t4 leomr iytlp eaueo;()trxm(opoodolenlfes (fs2um(monu4apt mo3iatfm2ean s u4artomrciatlmtrai s t)setmir io1lle mnvil() 2ur(mono1oleniicilslm ea(vpn(4tlxomo iatfa  auvs s0 2xo(mpiy1op elnet sfaDra( onu0tpeoioeilt aDra( onu0tlxrxrcootlm rlnvi ( s2urxm ny1omeelnesl( aDrrx oou0oleoio3tyt mDranmsn(0trtnir iydom   nei t sruoxo3no1lm n nct (fsDrrxm ou0oleo ociydls2emu s (4 ltoxo oy1faD anvolt truoim3nodamtelncsls  rtmxro;t0aex ii3tadfs2eau on(4 eerxr tytfpDraueo (0s2to(r ou4lp n fctlt srta(ro;t4ale ifeiysls ea(vont4trtrif tydomDeluvi;() 2uo(r3nu4op  liesl(fartrum nu1oex  f3iadlsDelumsnu4artoxf ootfa  livolt0 eumim oo4ap nlfesatfs2tr(r no1alenioctysla2uanmp;u4aetoioctydfmDelivs;()s2xm(mpoodomenlncias) rtrxrpou4tpxomf3tadlm2umn onu4artnifcoa1optraueo ()trumimpoodlpt mnvsls)srtaxm nt0alt moctytlmDuaumon() eerxr3oatoaDelivi;t)s2xmxmpoo1om nlnviltfsrrmu ooo0tex  fciyd m raumonu0teerxf iytfmDr i ilt) etmxopoo1al   fvtl(farraxrpoo4tpt iictydlm eanvp;u)areoxo oydlpDe i o () ruo(r nu1lp n ieiatf Dtmx poo4alxnii3iydfaDrmu s u4 ltrxfcoodfaDrlnvslt  rxr(o no4llee fesl(fsDurx poo1tleoiictys a2rm( p;()alxnif3tytfat  nei s0 exo(rpiy4ol nmivt (fartrxront0olxo fcild s emuvont4aeenmo3iadomDelivils  rtrir iy1apeemfcia(f Drm( ooo0oetnmo3tlslm2eluvpnt)altnmfcto1omDe uvi t)tetrirpoodlmeemivtasfaDtmu oou0aeto ietad s rlnmo;u) eerxfcoo1fateluvsls)texrxm ny1omenlivs (  Dra(rpoo1tex  ieiasfs2ulump;u) lxrxr oytfpDr n i t seuo(o ou1omenmnetat  2rm(r ;o0aex miciat mDrmuvp;t0aeerifcia1fat  nvil() rumxm3oodapt mnet t s2tmx o;t1texo i3ildfm rlumpnu)aetnxf totoaDraueils0 rtr(mpiy4olte neias  Dta(rpnu0tpx iieiysfmDra(mo;t)artomr3iydfatrli s;(  rxoim3oy1ll  lfvt t sDtrxmp;u1olto i3iaslmDulu o u0artnmociydlatr n s;s)seuoiopnodlmtemfcsl( a2rrx pou1aee iociltla2eln p (4trtnxrcootfmD lieslt) eumim nudlpt livi s sDtrum ;u0opxnmf3tlslmDrl(vo;u) ltnmr oytlpDelnvo;s0 2xr(o3nudllenmnctatfsDurxm ;o0olt  fciatls emu o u0aleoif3io1lp e uvo;( s2xrxo3oy1opt lfvt t sDra(rp;u0tee mfctyt m ranvs u)tlxnio ty1fpDe uvi t0srxoxo3nydal emnvsat a2rruroou0aeeomoeiaslsDum( s t)tleoir3iytfa elu s;(0 exoxm3oy1lm   feta()aDrmu  ;u4alxo feiyslaDranmp (0 lxrxfctodoatr neo s srtm(opiu1lpte iviltfsDtmumo;o0ope  ociat m ra(vo t)tetrxf3ty1omD luvol( srtr(rpiy4al nmfes (  rtrx  ;u4oltn feiadls2rl(mpnt4arenmr io1lmDrau ols)texoxo iudomt lnctls aDrmxrpno4opxo f3iadls2ulumo;t0 eenxf oydfmDe uei;t0 2toir nydalenlivsltfa2urxront1tptomiciysfa2eanvsnt4aexoxr oy1laDrlnvo s0srxm(m ou4optn netls srum( pot1oleo ocild a2emn o;t0 reoirciodlpDe uvs t trumxm3iy1llen fcias  Dtr(mpou0tltnmociysfa rln s () lxoxr oa1faDe nvi s sruoiopoo1lptnmivs t)s2trum nt0apt  f3ias a2um(von(4 rxrmr3ootfmtelivs;t) rxrxopoy4opt  nvi tfs2taump;o1tpeomfeiytlm ulnvont) lxoif3totfaDrauvi s0 eumxmpiudame liesl( srurump;u4tlt iiciatla2rm(mo;u0 rtrir oytopt an ols)srto(opoydomtnmfei s)aDrr( ono0aetomieiysla el(vsnt)aleoxo oatfm  lnvs;(0s2uo(o iudamtemfvtlt  Drrumooo0tle  f3iys a2ranmont4alxrio3oadomD  neils)s2tmxm3iy1amt lfvsas)s2rmu  ou0aleoii3ilt s2ulums t4 lxomo oytopDranvols)srumxm iodlpenlfesas)arra( ont1ole  oeildlsDuanmp (4teenif3oydfaDr nes;t0trur(o nu4lmt lncil(fsDtru ooo1tpt if3tydfa elnmsnu0altoif3oa1lm   i s () 2xoirpiu4llt lfcsatfarrrxrpnt1opt  f3iltla ranvsn()aeenmrcoydlpteanei;s0 eumxo3oy4lme lietas arraurpnu0olt  ieiyd sDemumsn(4aexnircoatomt aivi ()srxm(m3iu4amenmfvs (  ruaumono0optnmoeilsfs2umnvs;(0arxrmr3oydopDr uvsls s2uoirpoudlm e ivil()s2um(mpoo4openiietlslm rmump t4 rtnxociydlm  lnes ()trxrir3io4al  mfeiat s2rrxmo;o4ole  fcildla ua(vs (0altnifcootfaD aies ()teur(opnu1olt lict () rrr( pno4aet ii3iydfm ua(vo;(4treoifcoytopDrlivs t) rxmir iy4lmtnmies tf Dtr(rooo1tle iiciatlm rmn pnu)tltoif3oadlaD anvols)teuo(rpiy1opteliei ( aruax  ;o4apxnmi3tydlmDrmn o;u0trtoir ta1fmDe n i;( trum(r iu4amee ieiat) ruax  ou1alx  feiasfm2uan sn(4tltnif tatom e u sls0 rtmimpoy1ll nlfetls)arrrxr ot4tlto fetadlm umump () exrxocty1fp eaieilt  etoio3oy4am   nct t)sDumxm oo0apenmfctys mDeauvonu0arermr tatfat  n sls trurirpnodal nlneias  Dumu pno1apxo iciadlm2rmuvs t) rxnircoydfm  ai s;s  rxm(r oudap e nes s arrmxm ou0ole  ociyd s2rmnvsnu4tetoir oy1op rln o;s0srurir nydalenlnctas)s2rrurp;u1oeenif3iadls ua(mpn(4tlenmfctatlate n s;s)trxoirpny4ame lietls aDraur ou1tpenmf3iasfs ean s () etrif oa1faDrlnvo s0 2umxr iy1altn iet () 2trx  ot0oexnii3iasfs2ul(msnt4 eerxf ta1fp e uesl(0t2trxopny4om n neilt)srrrx p;o4apxnmf3tadfm rmu ont)tltrxrctadlpt livs;s0 2xm(mpou1optn nvtltfsrrr(  nt1tex moctlsfa2emuvo;u4arxrmoctydfptrli o;(  2um(r iodapenlfvsat srtmxmono4ope ioctldlaDelnvo (0aetoircta1fa ranvo;( srtoxo ou1ol elnct sfarumxrp;o1aeeoioeiasls2ranmo u0tltoxfcoodfmt lu ils0 2tr(m ny4lmeelivt () rtm(ront4tlxo ieilt a rl(vsnt4altnifciadfptraivs (0 2xmxrpiodam elict s  Dtmx poo0oleomiciydlaDrlnms;u) rtnxf3oo1fmtr ivi ( texr(r3nodal nmnvt t  rta(  ;o4tlxnifeias s2ul(vo (0trxrmf3todlaD  nesl(0 2uoxopoy1am  lnci s  2trur ot4olx moeias a2eanmon(4arerxocoydlpDelnvo s0tetr(mpny1optemivslsf 2umumpoo4olto ietysla2emnvp;t0 rxomo oadomD li o;t)t2xr(o3oo4ome lfeil( arra(r ;o0aleo i3tasfsDuan onu0 rerxocoadoaDr neo t0srum(m3nudolt  ici sf Dra( ono4tleomfctld aDrmuvo;t)texomo3oo1omtrln i (  euo(r iodopen feil()s2rmurp;t4tetomf3iaslmDumn p;(0tlxnmr3totoatrlueils0trxrxr iudll  lfcil()srtaurpnt4oeenmf3tysfs2ea(vsn(4altoiocoydom e ieol(0 rtm(o iu1altn ivias) rrr(m ot1tlxo ieilsls2rlu p;(0 eerio tytfatranes;s0 rum(rpoy4alt lfvtas)a2rr(mpnt1teeoif3iatls ua( pnu4 rtnmo totfm  aivo;s)srumxo3io1lpee nvs ( a2uru  ;u0aleoifetyd s ul(mpnt4tetomr3iytlat  i ol()s2xmim iydlleemies t arrrxro;u1oltn oetytls2ea(vonu0artoircoadfpt li i ( s2toxr3no1lmenmncsat srur(monu1tetnmfcils a ul( o;u4arerxrciotopteln ilt trxr(o3oydapeemnvs s) 2umx  nt1olx ii3iltfa2rm(vp t) rxoif ty1fp eaueo t  rtoio oodape lfvs (f rtaxmoot1apx  o3tydlmDulnmp u4texnif iytom elu ol(0srtrxm3iudlmen neia(fa2rm(rpno0ope iociytfa2eanvo;u0tltoio3totfaDr uvols)texmxm iu4om e net s  2ua(m nt4opto fciytlm2em( p u) rxnxr tatoaD auvo s) rxrim iydal   fcsa()s2ur(roou1aexo ieiad mDumn pnt4aexomf3ootfaDr iesl(0texo(mpoudomtnlicia(fsDrrxmpou0opt ii3tldlm em(mo;()trxomf3oo1omtelu sls srxo(r3oy1altnlncta(  2uaxrpnu0opt ifeiyd aDuan pnu0 lenxr iadoa   i s t0 rumxopiudomenmivtlt artrum nu0oeenmictltfs2rln o;(4alxrirctydopDe n i t0s2xoio3oodol e iciatfsrrr(rpno0aptoiietaslsDel(ms;()trenmf oytlpt lneo;()s2trxopno4ap   fcsas) 2ra( o;o0aee mf3iadfm ea(msn(4alxoif3oy1opte nes;s  2xoxrpou1al nmnvs s a2rmu  no0olxo iciydls eauvon(4tltrxo totop  lueo;s)t2xoio iu4ol  lfctl()a2rrxmonu0ope  fctys aDuluvp;() ltrxf3oatfa r ivi;(0teurxr iu1ap n ncilsf rrmurpno0tlx iicilt a uaums;() lenmo tatlmDelnvs;() 2trxr oudopenlncs (f rtaum nt1oeenmo3iadfa rau snt) eeomf3iytfmDe uvs;t s2xmim nudlp  lnvtas  rum(mont0apto ieiltfa2rmnvsn(4teerxociatla   ues;t) rtrxr3no1lpenlfciat srum( oou1tpt  o3tatlm uanvon()aetnir3to1fmD  iei;()trto(opio1al n nvs (fs2rrxrpot1opxnmo3iyt sDemuvpnu) rtrmf3tydlmDraivs t)s2tm(r nu4apee ivtl( sDtrum ot1apx iicilsfs umums ()tltriociytoaD lues;(0t2xr(o3oudam nlivs (f Dtmum ;t0teenmoeiydls ul(mp t4aetrmr3oytfpDelnes s0texrirpiodolt mfesltf 2ra(mpot1oetomictldfm2ua( o u)aeeomo3tatoptelues;(0 2urimpiudlm e iesl(faDtax  ou0oet mieias a eauvs t0trxomf totomD aueilt s2trxo ny1ome mfcs t)artmx ooo0oleoio3tls s2umnvo;t) lenmrciytfmD an ilt0t2toirpoo1lmen feiat  Duaumont0oleomoctadfaDumumo (0 rxoxo todop e nei;t texrim3iy4lpenmnctls)aDra(m nt0tlen ocildfsDrm( s (0 rtoxociotlaDrlnvo;( t2umimpiy4ll  mfeia(fsDumu o;t4tee mi3ilt mDrmu o t0arenxociotla r i ol(0srxmir nu4omtemfeiat)sDraxm nu4tle  iciad aDua( pnu) lxrxf tydlaDrln ils teuo(o oo4ame lfvsasfarua(mont0tet mi3tlsfa2eanmon(4 eerio3oatlpDr ueil(0teto(r3ou1lpee ncs (farurx pou4olx  i3ilslmDel(msnt)aleoxf3tytomDrlnes;t setoir3oudomee fet tfa2umx onu1tpxnmietas sDrmuvpn(0alxoxrctydopteai s t0 rxrxm ny4ap  mnvt () rum(m oo1oeto o3iadfs2emuvo t4trxoir ta1omD  neo;t)trur(o3iy1lptnlfci s)srrrx pnt4alenioctatlm2ul(mp (0 rerxr oytopD lnei t) 2toir3ny1lleemivilt a2taxr nt4oltomfciytlaDua(vo;u4tleoif ta1fmt  u sls teum(rpio1lpen iesls arta(m ;o0teeo oeiadlm2ra(vs ()trenxf iodlptrln ils0texrxrpiudalenlfci (f ruaxrpnt1tlt mi3ias m2ran s;t0 ltrmrcoadom  auvo s0setmio3io1lle mivi tf 2rm(ro;t1tee ii3iyslmDean s ()tltrxrcoo1omt  uvi t0 eur(mpiu4optnmncias a2umxrpno1olxo ieils mDrlnmonu0tltoifcoatopteaneo s)texoxm3nydlpenmies s  2uau onu1oeenmociasla em(vo;u4alxriocoadlpDe i sls) 2to(rpny1amee nesatfaDta(mpoo1tptnifeildfs2rm(von()aeenxrcoa1omt an i t0srxr(m3iu1lpeemfvia(fa2trumonu4olen ocias s ulnvsnu4tltnxr3iy1lmD ai o;t) euoir3no1omeelnvil()arrm(moou0oltomfetytlmDrl( o;(0trerxrciodfpte ueslt)trtoxr3oydape mfei t  Dua( oou4tpeo feilsfa2rmnmp u0tltrmr3iy1lp   ieo;(0 rxmxm3iudlm nmnvtat) Drrxrono0oex if3tytlmDra(vo t)tlenmf3todomD lieolt  2to(r3nu1olt mncs t) Dumu o;t4opx ii3iyt a2rmumo;t4arenxo iy1lptrauvsls0truriopnodop   netls) 2um(m oo4tpxoiieilsls ul(mon(0aexrio3iodfmD  n o s) eum(rpiy1lp n nvi () 2tmxr ;u1opx ioctytfmDranmo;t) rtoio iotfatrlnvo;t) rxrxr3nydlm  mivtas)srtaur ;u0tltnii3ilslm eanvp t)arxnmrcio1faD lnesl(0 2tr(r3nudlmtemies sfa2tm( pot0olt  fciat aDum(mp t4tetrxf3oa1lpDran ol()teurxmpio1oltnmfcslt  rtmurpnu0oetn oeiytfaDul(ms t0 lerxfcta1lp  an i (  2tm(o3ou4om  lfvsl(fsDuaxm no0tpxoiociytla2uluvp u4tlenmr3tytopD li sl() rumiopiu1am nlnvilt)srurx poo4aexomf3iysfm2rmn p ()trxrmr oodlmteauvs;t0 2um(m no1ome mneias sDraxmono0tex mfctad mDum(mp t0 lxnircto1faDe uei;s)tetm(opou1apee iet tfsrtr(rp;u4olen oetadfs2ran p u0aleomo iotfptraieslt)t2toir iudlm  mfei ( aDurx p;o4apxnifeils m el(mpn() rermfciodlmtrai o;(0t2umxo ou4opt  ies (fsruru onu1opx  fcildfsDel( o;t)trtniociadlmDr 
\ No newline at end of file
@@ -0,0 +1 @@
+ieols0srxr(m oy1opte ietl(f rraurpoo0tpxn o3tltfm elnmp () lxnmo3oydlatrluvs;()sruoio oo4om elfvias)sDtmumono1aeenii3iyslm2eaumont0aetomo tydla rln i;t0 eur(r iydll  lfesas)aDrax ono0opeo ieiytfs2rlnvsn()tlenif io1la  aivi t)trumim3oudamtnmfctat)s2tr(rpnu0tle iieiasfsDea( p;()tltrxr tatfm   nes;t  euo(r no4llt lictlt)s2tr(monu1apt  feiatlaDrauvsn(0 eermf iydlaDe ueo s)srxrim3nydop emnes ( aDtm(r oo1alt  o3tyd aDumnmp (0trtrmfcty1fmD ln o;(  2toio iydllee ncilt srumxmp;o1tpt  fciat s2em(vs t)texrmo3ia1op e n s;( teuoirpou1ope lncsat) 2tm(  ;o1alt mfeild m uaumonu0aetnxf iytfp rauvs s  2xmxr iu4lpenlfvils arurur nu4olt  o3iys sDrl(msnu) ltrir3ootlmDeluesl(0s2xoxo3no1am e fcs (  2uaxm ot0opt if3tasfa2eluvpnu4 renio3ty1laDrlnei s seurxmpoydoltnmnvi s)aDurxmpou0tlt mfetas a eau p;t) ltomo ty1fmDe u o t seum(rpno1llee nvt t s2tr(m nu4alen i3tyslaDranvs;t4 rtrxf3ootfp e nes;t srtoxrpou4aptnmivsat)a2ra( ono1aeeniicild aDel(mp t4teerxocoy1lmteluvslt0 rxrimpio1ll n fcslt)arra(rpou1alx mo3iaslsDulumpn(0 rerxr oadfatrlueo (0srtrxo ou4ll emfct (fa2umx p;o4alen octld s2uln p u0aeerxf oodfaD auvs ()s2trxmpio1lmenlfvils artrxrp;t0aet mo3ild a2rmnvp;(0tetoir3io1optean s t teuoxrpno1amtnlics s) 2umxmpoo0aee mi3tltlaDrlu onu)trerio3tatfatelivi;t t2ur(rpio4altnlnei s)arrmur ou4aptnifeiat sDrmuvpnu0trxrmf oatomte uvo;s  etr(r3oo1optelieiasfs2rmu pno4opxnmfeiytfaDrauvs t0 rerxf oo1oaDeai o;s trtr(r3ou4apenmfvia()a2tr(r no1aeto fetydfmDumuvs;u4aexrif3iydfaDrlnes;t0 2umio3nudoltemivtasf rtrx  nt1opxn icildla ra(mo t0aetomo tydfm raivols) 2uoio3nudap   fvs t) rtrum ou1olxo i3iyd a2ulumsn(0 lxrxfcia1om eli il(  2toxmpiy1ap emfvsl( s2trumont4ole moeiytfs2rln ont0tetnio tatfpD  u il( texmxm nu4altnlnvtls) Draxm ;o0ale  iciadfs2ulnmpnu) rerxo ty1fmt aieilt)t2xo(r oy4aptnlieslsfsDuax ono0apxomf3tldfa elumsn(0aeeoioctadom r ivo;s truoir3iodoptemfet t  2tm( pnu1ole moeilslm rmu sn()trtnxf ia1fpDrauvo t)t2uo(r nudopen fetlt  Dum(  ;t4oetomieiysfaDranvp (0artnxo tadoatelu i s0truo(rpiydopee netas arumx p;t4apeoio3tydfaDrlnvp;(0 lxnmfcia1lmDelues s0 eumir oy4oltnlfvia() 2ua(rpnu4olxoiiciydfm eauvs (0 rerxrctodfpD  i i;s0t2umimpiydome mncia()arumx  ;t1oetnmocilsfmDrlumsn()tetrmf iadfat ai o;()s2tmir3ny4opeelfcs t)s2tr(moou4alxo o3iatfsDuau p t)tetrmrcoo1fm  livo s t2xm(o3no4opte ivt sfaDtrxm ;u1oeeoii3iat sDrm(mp;(4texnmrcoatlpDraieslt srxmio oy1lleemfesa(f rua(rpoo0tltnmfciyt s elu s u)tlerir3iadoate u o;t s2toim iy1altnmfci (  rumum ;o1oee io3iadfmDrlump t4tlxnmr iy1lat aivo;t) 2xm(o3iy1olee nvta()aDrau o;o4tpx iiciad aDul( p;t)arxrmf ta1la rai i () 2umiopou1am emivtls  rrau o;t1oeeomo3iadlm rm(vo t)trtrmr3oodlpteau olt) 2xrxr3io4op n ivs tfa2rmx  ;o4aptoii3iydfm emu onu0texrmf3oatop r uvi;()teuo(r ny1omte fciasfa2rrump;o0oeto f3ilsla emu onu0 rxrxfcoa1omD auvi (  2xm(mpoo4op  micsa() Dur(rp;u4tpxnmfeiat m elnmp ()artoxr3io1omD aivo;t)sexoxo oy1ll  lfcslt srtr(rpnu1tpx  feiysfs el(vo (0 rtnxr iadomteauvo (0seum(opoo4amtemnct s)srra( oou0ope mieiys s2emuvs u4altomfcootlm  li ils trxmxm oy4ap e nvi (f 2tm(ro;o4oltnifcilt s2eluvon(4tlenxoctytfmt anvo (  2um(opoo4ape micslt arua(m nt4aex iietatfmDea(ms;u4aetoircio1la rlnes ( s2tmxmpiu1aleemfcta(faDumxmpnu0tptoii3tasfm2ul(mo (0altnxrciytfmDelivo;s)t2xr(m nu4lm n ivt ( a2trumpot4aptnioctlsfa2umnvo;() lerxoctatom raivi (0trxo(opny1ap nmics (faDurumooo1opxniocildla rmnmsnt4arenxrcoydfpDraiei;( s2xoxr nydol  mivi t)s2urxmpnu0opxoifctlsla rl(mo;t4texrmf ootlmDe u s (0 exmim3nudlmtn netatfaDur( ooo4alto i3iatfm2elnvonu0 exoir3ty1lpD  ueo;t  rxm(opio4alee nct ()a2urxrpoo4teeomoeiytlmDulu s u) rxnxo3oodomD auvilt0texoxm no4apenmnvias) Dumxmpnu4apt mieiydfsDulu p;t4 rxnio oy1lat lnvolt0 rxr(o nudop emiciasfs2umum ot1alxn o3tad m2eanmsn(4tlxnxo3oo1opD lu slt  2xoiopiydolt lfcta( s2ua(mp;o4alenmo3ias mDrlu sn(0aetrxrctydfmD lu o;t0 rxm(r iy1ll nlnetlt arrau  ;o4oexnioetydls2eauvont0 lxrmocoytopteln il(0t2xrxrpnodaptemfvtas sruax  no0tpenifciytfa2rl(vs (0trxnio3iatfm  an s (0 rtmim oo4lmtnmicils)artmx oou4tet  o3iat mDrl(vp;(4 ltrmf tadla   ies t srxrimpiy4al n nvtas) Draurpnu0tlx iociadfa2emn s t4altrmr iodomteaivo;t)t2uoxopno1openlfvsasfs2uaxmpnt4ope mfciadfmDumnmp;()altrmfcty1omt auei;t)trxmimpou1amtnlfcs s a2tr( o;u4alxo fcilt a2uln pnt4alxnxrciatlpteai slt0 2ur(rpno1llenlnvtlsfsrumuronu0optniiciat a2rau p;(0artoif3io1fmtr iei t0setr(o oo1altnlnvslt) rtax oot1tleo oetasfsDuaumpnt)tetrxr3iodoaD li i (  rtoxm3nydale lfci tf 2ur(  ;o4altn o3iltfs2uan s;t4alxrmo ootla e n s ()t2toim nydolen nesls aDrrx ooo4aptn o3ilsla2ua( p;t4trtrmr ta1oat  ies;s  exr(r3io4ap nmfvilt s2tmx onu0olt mfetld a rlnmp t0tltrif3iytopDrau sl() rxrxr nu1oleelfeia(f rraumont4teeoio3tas a ulnvpn()tltnmrctotlmD auvi t) rxoxr3ny4ameemfcsa(fsDraxm ;t4olxnmiciltfmDrlnvonu4tlxrmfcia1omD  u i t)srxr(r nodomtnmfct s  2rax pnt4tetnmf3iadla2umumo;t4 renxo3oytfaD aivsl(0s2umir3nu1alen ics s)a2tr(rpot1oltniocias aDrluvsnt0tetoio tydlp  ai s t)s2toimpoo1al  livs s sDrmxr no1aeenmoeilsfm rmnms (0alxoif3to1lat luesls0 rum(o iu4ll elict ()arumumo;o1aeto oetyt m2rmuvp (4 rtnmr oo1lp e ivo s  2um(r oydolenlivilt)artaxmoot0aex  oeiys s2uau o ()alenif iotfatelues;(0 2tr(mpiu4lmt mnvi ()aDuau  no4oeen o3tysfm elnvo;t4arermr3oadlptraieo;( sruoirpoo4lpt mnciasfsDtrxmont4opt ifctas a elnms;u0aexnxfciy1om  au s;s0truoxr iodlptnmies s) 2rau o;o1oltoiociad a umu p u4tlxrif iotlp rli sl(0seumxmpio1lmtnlictas a2tm(ro;t4teeoioetlsfa2eluvo t4aleoio totfaD  ues s)t2xr(rpio4llt  fctl(f ruaum ;t1oleoifctydfmDel( pnt4 eenxf iadlmDran s s0trumxo oodamt mfet (  Dtmx  ot4oltnmf3ildfm emumsnu4 exrmr3iatlpt aieols s2umxrpny4apeemietl() 2taump;u1alxo i3iasfaDuauvs (0 leomociadlat an ols)s2xrxrpiu1lm nlfvsasfsrrmxr ;u1olenmoetatls ulu on(0aleomr io1opDeanvsl()sexrxr nu4apt lnvias  rrrxmont1olt ii3iaslsDrm(mo;(0 eenmr ia1oa rlivo s)t2xm(r3oudam elicsatfsrra( pno1opeo ieiltla2uan s (4artnmfctodfp rlnvols0sexr(mpoo1olt mnvtls)aDrmxmo;t4opx mociaslm ra(vont) rerxf tadoateluvi;t)trxrxm3iu1al e fvtl(fsDtax  ;t0opxn fctad s elu p;t4trtoif iotfp   ivs s) 2xrxmpiodom elnctlt)a2urx poo4opt ifciys a2emn pn()alxrio3iodop   nvsls texr(rpny4aptnmfvsas) Dra(mpot1aex  ietldlsDrmuvpnt)teerxo iadop e ieo;t  rurimpoo4lpeelies ()srum(r ;t1aptnmoctatlm eluvon()tlxnxo tatfpte nei s0 rxrxrpiydapte icsl(fs2rrxmpou0opxomfciad a2umums u4altrxoctytomtr uvi s)trxm(o oodlm  mnvt (fsDraxrpoo1olxniieiysla ua(mon(0 ltrmf3iadlm eluei;t) eumxr nydopt livtasfs2rrum no0opxniietlt s2elnmo u0arerxfciatlp  luvs;s  rxoiopiy4omtemneiat)a2tr(ro;o4ape iietlslsDrln p;u)trxoxr3oatoat an s;( setr(mpno1optn fviasf 2uau  nu1opx ii3iltfaDuan o u4aetoxr iatfp raivsl()trurimpno4omt mfctas)aDrau p;u1olx mf3ilt mDum(mp;t0alxrif oydlat lieo (0 2triopnudap emics s  Drmurp;t4oltn f3tlsfmDranvsnt)alxnxfcia1lmt ln s;(0 rtoxr iy4lptelfvtlsfsDrr(m ot4oex iieilt mDrluvont4 lenif iy1la rlies s0t2xm(r nudalenlfvi s arrrxr no4apeomfeias aDulnvp;(4 rxrxrcty1latraueo (0trxr(r no4om elneiltfartru  nt1opt  i3ils sDra(vs;t)tlxomo3iadop rlu o;(0s2um(o iudapen fct t  Drr(r no1opxnmi3tatlaDul( p ()alxnmociatopDean o t0s2uoiopiu1lptelici () rrax ono1tlto feils s2umnmonu)tlxrircoodla  lnvols s2um(rpny4amtelfctas artr(m nu1oexomi3ild s emu p;t)trtnmo3oadlpt aieo t  2umxo nu1ap nmfcsas s2urumonu4tlx  o3iytfm um(vs (4 eeomo3iy1laD  u o;(0srtoir oudlmt  ivils)a2ur(rpno1aet iictlsfs eaums;(4 rxomr3totlmDraivs;() 2umir3io4om   icia(fartrx  no4tltnmf3tad sDuan onu)artnir3oytfmt  uvi;t  2uoiopno4aptelneta(f Duaur nu1optnifeiys m2rlnvs;(4aexnxo io1la   nvi;( seurim3oodopeelfet tf rrrxmonu1oetnif3tydlaDuan ont)artoxr oatfm rau i;s0texmxo oo4op nlivi s)aDtmxmp;t0ope iicild a emums;u0teeomo3todlaDr ivo t) eur(r3io1ope liei t)srtr(m ;u4teeo oetad sDem(vpn()trxnirciadfp  lnvi;t0sexr(o3iy4aptn iei ()sDrm(  no0opx  octldfs2rluvpn(4aeenmrciy1laDe nvols seumxopnu1lltemivi s)s2tmxm ot1teenii3tltfm2emnvo (4 lxnif3tatlatrlnvs;() rtoimpno4amte fvt ( a2rr( onu0apeo ictltla rlu on()trtnif3totopD  neo (0srxrir3iodam   fet t)sDurxmp;o0teeoifeiad aDelu pnu0alxrir tadfmtr ies;s)sexrxm oy4lme livi tfa2trxrpot4tpxnioeiadlaDrl(mp (0arxnifcto1fatrlnvolt) euoxm3oodop nlieil() 2uaumpnt4olx if3tydfmDranms (0arxoxr3todlmD ai o t  2xm(r oy4ap  lfctlsfs2um(ro;t1oltn icilslm2ua( s u0 exomo iytfaDeluvi;(  rtrir3oy4lme mnvta(farur( p;u0aetoii3iltlsDean onu4 lenxocia1omteauvo s)trtmxo no1olen ictasfa2ta( ooo4alenioctyd sDelnvp;u0aleoir oydopD aies (  2toxmpiudll n nvtasf rurx  ot4apxn ieiyslm elnvs ()aexnxf3tytfpDeli ols  rtmim3io4lm nlfet t) 2urxmpno0altomo3ildla umump t4trxrio oy1fmD lnvo t t2trirpio1olt lnesa(fsDrmur nt4tpen ictlslm2ranvp;(0treoxr iatlpt lu o;s srtrio ny1altelncil()s2tm(rpnu4oexnmfciatlsDrau p u0 eeoif iytoa eli o s texm(m3ou1op  liesl()sDumxmp;t1apto f3ilsfs2em( o u0tltrifctodlpDe nei;s texm(o oy1lme  ietltfa2umxronu4apeomoetltfaDumnvp;t4aeeniocoatla  an i;t)seuo(r oy1aleelnctlsfarrm(m oo0apt moctyt m ean sn()teeomo iadlmDelies s  rtrimpno1al  mncsat srtmu pnu1tlxomocild s2rm(msnu4tlerxr tydfm e i il(0seuoxo3oy1ame mnvtl()srtr(mp;u0teenmfeildls2rluvpnt4aetnxfcoy1la   nes ()seurir3ny4lltelies s  2uaumo;o0oeeniieiatfmDumums u) lenmr oodlmt lnvo;()texm(o3oo4apte fcsl( s2trx onu4opx ifctadls eaump;u4trerir3oodfpt lneol(  2xrir iu1al elnesa() 2raxr nt0opxniicild m2rl(vs t4trtnmrcoydlateaivo;t0t2ur(r3ny4lmtemneta() Dra(rp;o4opx if3iltlm rln s;(4 rtrxf3iatfat  n o;t0tetoxrpiy4om e ivsa(fsrurx  ;o1ape mfeiadlm rl( s t0aexrxfciodlaDe ues s0 2xm(opnudapen icil( aruaumpou1oexn oeiadfmDuanvsnt4altnmo ootlp  lnesls0 exmxopiy1am  livia(faDrmu pnu0aetomoeiydfs2ul(vs (4aeerxo ta1fat  uvo s seto(o iu1lptnmivias) rrru pnt1tlenii3iasfa2rlnvs;t)tlxnxf3totopDrln i;s)trur(o iu1opt lnctat a2rrxmpnt4opx mi3iytfmDuanvont4 lxoxo3oatlaD  nes;( setr(rpoo4apte ivt (  2tmurpou4tpx ifctyt mDulnvs ()aetomo tydoat au olt0 rtoimpnudal n icsa( a2urump;u1ope mfeiasla uan s;t4 eenifcoa1fp eluvols0 rtmxrpiu1amte fcias  2ua(monu0ope ifciatfa2uanms;t)texoxrcio1lpt ai s;( texoxmpoodam n iesatf Dtrxr ot1aexnmfetydls ulnmp (0 etomr3iy1opte uesl() 2xrxrpnodope mnciatfa2um( poo1apx mfeiaslsDeanvpnu4 lxrmf3to1lp rlu o;s truoxo iy1ap   fcils  rrru o;o1alto fctld a eln o t0tlenmr oytfpDeluei;t) 2uo(opnudlptnmieilt)sDur(mpnt0olenioeild s umumpnt0aeerio3iy1op  aivo;s0 2xrxrpnodlmtelfcsas)s2um( pnu4tptoioeiatfaDel( s u4 rxomf3ta1faD aueolt) 2um(o3no4llt lnesas) rumx p;u4oet io3tytls el( s;() etomf iotom e i s;s  eurxr no1lp emivt sf Drr(m nu1tlenmfetlt a ra(vo t)arxoxf3totlp r nvs;(0trurxm oo1oleemfvt (f 2ra( p;u4oex iieiadlm ulu ont4trxriociotoat an s s)t2xmir iydap   fvsas a2rmxr oo0ale mf3ilt mDrlnvs;t4 rerio iatlmD  nes (0srtrio3nodoltnlieias  rtau  nu1oee ioctydfa rlump t0arenxrcoa1lmtelivo;s)t2tr(rpnu1lleemncs t) Drr(  ;o4aeeniictytlaDelumsn()texrif3oo1omtr neo;()srtoiopoy1ap  licias  2tmum ot1opeo ocildfmDemnmont)areoxr3iydfatraueo s setrio iudape  fcia( srtmumoot4olto oeilsfmDrmnmpnt4arxrmfcto1omtrln s;t  rxrxrpoo4om   ncslsf 2rau pnu4tpe  o3iydls rmnvs u4 leomrcio1op  luvi;s  rumim3no4ap nlncta(  2uaxmp;o4opx mi3iydla uaums u4 reoxf to1omte uvol( truoir nodaptnlnet s sDuaxm ;t4oleomo3ildlaDrln o u)tetnxfcto1la raies;s  rtm(m nu4lpeeliesatfartax pou1aptnmf3iatlmDranvpn(4 eeoifctydfmDeaivo;(  exoxo3iu4ome mneta(  Dtmxr ;t4teeomoeiadfm ranvpnt4artrifcoy1lp eanvs;()trtoxo3ny1optemneils) 2rrxmpoo4olx ifetyt m2emumo u)aexrxo3todoatrlies t)teum(opio4om  mnet t)sDrr(r ;t0oexn ociad a2em(monu0tetnxo to1fate n il()t2xm(o io4llt lfesls a2umx pou0aex if3ilt a2umn o;(0 rxrif totom raueo (0 2trir ou4al   icsa(fsrra(mooo0texoii3iyt aDea( sn()tltnir oytopteluvo;t0srtrxr oy1lpee fetl()sDuaxrpot1ole miciasfs elu p u4 lerirciotoat au il()seurir3iu4amtn fctatfsDrmxroou4tlx  ieildla ul(mp;()tleniocoa1lp elivil(0sruoir3no4lpeelncsl( sDtmxr oo4tleoiiciat m eln o;t) rtoxocoydop  aivol(0setoim ny1lpen iei t  rrax oou4apt io3tltla ranvp t0alermf3oa1lmDelues t)setmxm iy1lptnlici s) 2rmurono0olt iiciatlaDrauvsn() etnxr3iadfpD  neo;t0 etmir3ou4openmnvt () rtmu  nu0tpx mociatla rlnms u) etoxf3tydoptean sls0teurxo3nu4ome  ics ( s2ur(mont1teeo oeildls2rl(ms u)alxnxf oatomDe uvol() rxmir oydop emnetlt a2uaxmpou1altn i3iyd sDrm(mo;(4 rxnmr ty1fp elivo;t0 2tmimpny4oltnmnciat)a2rrumpou1olt mociydfsDuauvpn(4 rtrmfcta1la eaues;s)s2xrxmpoo1lp nlnctlt)sDtau  ;o4tee mieild s ean s;(4 rxrxfciytlaDranvils0 2toio nydlpe  fcilsfs2rmxmpot4tptn octydlm rmuvs;u0texnio todoptrli i;(0s2umxm iy4oleemfvsl(f 2tax p;u0tpto f3iysfs rlumsn(4 eeoxrciotlmtraneo;(0tetm(m oudomee ncil( srtr(r ot0tpt io3tltfm2emuvpnu4 ltrxo iytoptr uvo s)trtm(m3io1ap emnvta()a2ra(  ;o1tle  oetat a2rmu p t4 reomr oy1opD ln o;t)texo(m3io4altnlfei sfsDrau  no4tpeniociydfa2ea( s t0 etniociadlpDraivsls0tetmir iy4lmtnlieta()srrau o;t1apxomieiyt aDeau ont0aetomrctotopD aneo s trxmxo nu1omen fcslt  2umu pou4alen iciasfsDuanms (0tlenifctatoa  anvo s0 2xo(o3nodll e ici tfsrur(ro;o0olt mf3tysls2rlnvp;t0 exrir3to1opte ieslt0s2uoxr3iudolen nci (fa2tmuroot0texnif3iyt mDuauvp;u4aetrmf iadlmDe uvi s setoxo iudllee nvs sfa2raumoot1alto ieiad a2ranvo u0 lxoxf3tatla eaivsl(  exr(r iu1aptnmnci s)aDtaum ;o1ope mfeiytla2ulnmpnt0teermoctatomt  nvo;s0 euo(opnydoltn fcsat artaump;t4texniicias mDeaums u)teerxrcoy1om   ivo;()tetm(m3oydll nlnei s)sDtaxrp;t0oeeomoeiytla2umums ()aetnxrctytla ran o t tetmir3oo1om emfetlt)srtmxmo;u4olxo o3iydlm elnms u4aetnxf3oatlpDrlnesls  2tmio iy4optemfcsas srra(root0opto o3ild mDum(ms;u) lerifctadfa   ueo (  rto(m iudoptnmnvs s) Dua(  ;u4oex ioetydls em( p;t) lenxf3totlmtr nvi;s) etrxopnu4omeemfeils)aruru pno0oeenif3tas a2rl( p u4tlenio3io1laD  uei s truoxr3nudape  ictl() 2tmum ;t0tet  iciasfs2rmu pnt) reoio oy1lat au i t texmio3oo4ol emfvtas srurum nt4ale mieiatla2ulnvo (0aleoio oodlp  anei;s srum(o3iy1ol n ietatfsDur(mp;o1opxnmietyslaDemump t0 lxnifctatoaDrlu s s)s2trim iy4lmt mnci s srtrumo;o1tpt iiciasls2ra(vs;t0treomfciotoa  lnei s0 exoirpio4olt  iei s) Drru pno1aeeomoctls s rm(mp t)trxnxf3oodfpD  uei t srum(r3nu1oltn nes sfaDtaxmoot4tpenmfciltls2elnvonu) eeoxf3iotlaDr u ols)t2uo(r ny1lp emnetat)arumxmpoo1alto f3ildfa2eluvp;(4aexoio3tadfaD  ivi ()srxm(o nydoptemfvias)s2umx  oo1oeto o3ilslsDemnvsn()tltrxo ty1oatrau sl(0texr(opoy1lm elivt s) 2umumpou4oet mfetlsla2rm(mpnt0alxnif3tatoa  au i (0srxrxr3iydop  lics tfsrraumonu4aee mfctlsfaDeau o t4 ltnmf ia1laDr nvslt0 2xo(o3ou1ll emies t)srumx oot4teeoiieildfsDem( o t4aexrxo3iatlaDeauvi;( teuo(mpnu4omtnlfcias) rtm( p;t4tee mocias m2emnvp (0alxoxfctatlaD auvi;( srurio3oy1ap e fcsasfsruaxront1oet iociltfs2ul(vont4 ltniocoa1fp  lnvol(0srtm(o3nu4op n fes ()sruru  oo1apxoif3tadfa2ul( o;t4trenmfcootlp  lnvs;t)s2xmxr3oo1lpe lnctat  2trxro;u0tex if3tls s2umu o ()aetrif3tydoatr uvo s texrimpnu1ol n ivtlsfsDuau ooo1oeenii3tldfsDra( s u4trxnif totlm  an o ()texrimpnodopt  fvilt s2tm(mont4aex  f3iydfsDran ont)altnmrciydop elues (0 2to(mpiudaltn icta(  2um(m nt4tle  ietysls ranvp;t) rxoxf3iadlaDrlu il( truo(opio1amtn fctlsf rrm(  oo0aetoio3tltfmDemnvsn(4treoxr3iotlmD  ies;t s2xmimpoudlpe mfet sf 2um(rpnt1tet mietld m uau p t0arerir ia1lm r nvi (  rum(r iydop  mncias  2raurpnu4aetn octls mDea(vo (0teerxr oa1oat lues t0 exrio3iy4lpe  ncslt  Duaxrpnu1aexnioeiat a2ul(vp;t0artnxoctatfat luei;s)seumio3nu1lmtn ivsl() Dumxr nu4tpxo ieiadfm2rauvsnt4tlxrir3iotopDr nes ()trtrxr3oo1olee neiasfsrraump;o1olx  oeiadla2umnmsnt)trxnmr tadopDelivs s) rtrxm iu4amt lfci s) 2rrxr no1altniiciyd sDrmn o t)aeermo tatfp eai s t0t2ur(r3oy4optnliei (fsrurxmonu4olen fetltls2rm(vpnu)tetoxociydfm   uei t0t2xm(mpiy4ll nmfeias) 2raxrpnu4ope  octyt s uauvo;u) exoiociytlpte i s s0trxmir no4omte fei s)sDrmump;t1apenmfctadfsDelnmp (0 lxoxf ia1la rlues;t0srum(o3oy4ap nlnct t srtaxr oo1tpen fciltlsDrmuvo;u0texrif iotoa   ivs (0trumir ou4opt  ivia(faDur(m ot0aeto f3ils m2el( snu4 ltomrcty1fp r uvs;(0s2toirpnu1lmeelnvsl()a2rmum nu0tle io3iytfa2emu snt)artoxociatlpDe uvol(  2xoirpio1omt lncsltf 2um(  ot1tleo f3iytfs2eln p (0 exnxf totop  aues s)seurxrpiy4lp n ivsas  Dtrx  ou1aetnmieiltfa ulnmpnt0 rtomrcoydfaD lueo;t0 exo(rpiydlltelnctat) rtaur no0open o3iasfa rmn ont4texnxr iatfpDr u s;s) 2toirpoo1lpte iciat) Drmxmo;o0ole mo3ildlaDuauvpnu4aleoxfcio1fm rlnei () exr(r iu4open neta( s2ur( pnu4ope  fctasfaDem( onu0 etoio oo1omDr neolt)teur(opnodal emfetatf 2rrxr ou0openioctlsla2uluvont0treomrctadlpDraivo t0t2urxmpno4oleemfvtatfs2ua(mp;u4aleoifciydlsDemuvo ()trenif tytom rluvs (0 2trir io1amtnlncils)srtr(rp;t0apeomoeiydfs rln o;(4arxrifcty1lm  lies ( t2xoxmpoo1omenlnctatf rrrxm no0tex mfctldfm2uaumo t) etnio3oytlp rau sl()t2xoim iydlleemfctls) Drmuro;u1texoif3tysla2rl( s;u) rxnmr3oo1omD livsls0 exmirpiu1apt lnvsa() 2trurp;o0tltnmieildls umn onu) rtnifciotfp r ueol(0 rtrir3ny1ll nlneias)srtr(monu1apenmo3tys m emn pnu0 lxnxf oy1fp rln o t srum(o nydlmee nvsls)aDrrxmoou0aeeomoetasls2rmump ()aexnmo3to1fpD auvo t)trurio3iodlm nmfvta()a2umxrpou1oetoif3tlsfmDrm( pn(4alxrmr3iodoatrlnvo ()teto(r3nudome mnvs t)sDumx  no4ole  f3iyt m2rl(vo;(4artoxr oydlp eau o;t0t2trimpoy1olee fctltf Dtaur ou4tltnioeiltlmDulnms;()artnir iadfpt  uvo;s0 rur(opnudol  mneias aDta(  nt0oet  iciadlsDrmnmo;t4areoifcoo1oaDraivsl()t2uo(opoo1llte ncs s arur(monu0aleoiicilslm ul(mo u0aeerxfcoo1fpDrai olt0s2xrir oydlpee netas)sDtaumpno4tetn ocild aDelump;t4arenif oodomtranvilt0 etrxm io4ope mnvil(f Drmxm nu1tex  fcilt aDra(mpnt) lxoio tytomDelueols srumxm no1ap nlfei s  rraurpno0aleo ieiadfsDeanvo u)tetrmo3ia1oate nvs;s  rumxo3oodome  netasfaDtmu ont0tptn f3ilt s2el(vp;() rxrmf3oo1omDrln ol()s2xoim ou1lp  mfctls  rta(m oo4oleniiciaslmDrlu snt)tltomociy1lat luei;(0 euoxo ny1altnmfvtas s2umx o;u1opeo oeiydls2raump;()trxrio3oytfa  ln i t0 eurxmpnydaptn ietas  2um(rp;o1teeoioeiadfs2emn p t) lxnmr3ootomteai o;s) euoir nydope mnvsl(f Dumx  nu4apxn iciadfm2ul(mo;t0 exrmfcia1lm rlivsl() rxrio oudolenlicia(f 2uaxm ;o0tlt  octadfm eln s t0 exoxrcoa1op r iesl(0 rxrxopou1omee ictls s2ur(m no4oeen ieilsls uln p;u4 etnxr3iydlmtrlnvs;s)trur(r3ny4lmtelnvias  Draurooo4aet miciysls ua(mpnu0tlxrmfciodlpD li o;s0teumxr nu1llt lnvtasfaDtau pou0aetnmictytlmDrmu o (4altomfciadfmDrlnvolt0 eurim oudomtn nctltfsrraxmoot4tee  iciatfm2eauvpnu0 rxrif3ty1late ies;( tetmiopiy1oltelicils)srra( oot0olxo fcilt sDrmump u0 rxomr3iy1lmtelueols0 eur(rpoy1omee fcsltfaDtmxr ;t0oetn ociysfs el(mpnt)trenxo ootfa eauvolt)seur(m3oo1ll emncsls srtrx ono0open icildfsDranmp u0tlxnmr3oadfa   u s;()srurirpno4lptemnvta() rrm(ronu1tlx iociydfa rluvs (4 eenmr3ia1lpt  i il()texrimpnydoptnmnet sfsDtaurpot0aeeoiicilt sDel(vo;t) ltnxocio1la rauvol()s2xoxr iydolee fet (fsrrax pnu1oexnmf3tad sDrl(vo t0treoifcootfp elnes t)trxr(mpny1amtnmfci sfsrrrx pnu4oex mfctydfm2el( o;u0artnxo3tytoate u sls0 etoxo ou1amenmivt s) 2rru p;u4oeenifetltls emnvsnt4tltnxr oa1lmDeau i;t sruo(o oudlpt mfetasf Drm( ono0tpe ifeiaslm2elnvon(0areoio tatla elueo s teurxo oydlptn nctatf Drr(rp;t1tltnmi3tas a2rlums u0tltnio tatfa raivi t) 2umimpoodlmtnmicsl(f Drrxrooo0alto f3iad mDuan pn(4artnxfcoo1fpteln ols)teto(r3nu1amtelivt s  2uax ont1teeniiciat aDeauvsnu)arxoxo iotlmDr iei;s) euoim3nu1lpt mnesltfarrmxm oo4tpxnmieiydfa um( o;(4tltrmo oo1lmtrlueo (0 rum(mpnodamen nctl() rurxrpot4tpen icild m2rlnvon() etoxr3ty1oaDrai ils)srtoxopio1al e fes s srtm(m ;u4aee mf3ildfa2elnmonu4 lenxoctydfmteau slt trxrimpiu1alee fctltf 2rmuro;t4oleo icildla2uanmo t4tlermociy1lpDr i il( s2urxrpnu4lm nlfctl(f Drmxm ou1oex  ieiatfs2rm(vp;u4 rtomfcio1fa r uvo s srur(rpiy1al emicsasf rumxm ot0openmo3tasfa elnvo u4 reomrcoy1fa eli i ()t2ur(o3io1al nlivi s)srtr(  ot4oltnmieiltfs2rm( o;t4 exoio ootom elueolt)setoir iodlptemictasfsrur(monu0alxoiociytls2ra(vp;t0aeermf iadom raieols)t2tr(opoo1al emfvsls)sDrmxm oo4opxo oeiatla2ranvp u0 etrir3oa1oatelnvil( trtm(m3iy4opte fesatf 2um( o;u4apeo fciltfa2eauvp u0 lerxf oytlaD lneols0srxm(r3iu4ope miet s s2um(rp;u0apxnmo3iadlm2rl(vont0altrio iadoaDr nesl( setmxm3iydamee ici s s2tr( pnt1tpt miciys a2ul( p;u4tlermo oodoaDr u i t s2tmir oy1lp emfeils a2rrurpoo1oeeo ictad mDul( ont)texrxfcoydfpte iesls0s2tr(r3oydopte iesat  2rr(rono0aleniocilt a2ulumsnt4 lxrmf ty1fp rln i t0srtoio3iu1omt lici sfaDur( pno1oltomiciyt aDem(vo t0artomo3tydoa elivsls)trtoio3nudamte ivslsfs2taurooo4aptniiciyt a2ua( s;t4aexnxocoodfa elneolt)t2xr(r iy4llt  ivils s2tr( pnu4apx  f3iatfmDumn o ()altrxrcoydlpD  ivi;s texoxr3iu4alee fvia(f 2rmxrpnt1alxo ieiyt a2rm( ont0 exnmfcoadfateanei t)setrxr no4omt lfci (  2ua(ro;t0oexniieiadfs2em(ms t4 rtnifcta1oa  anvs;()srtm(r oy4lmeelnvsl()sDrau p;t4aleniocild m2ea(mont0aeenxf3todlm ran o s)s2tr(r io4op nlfcsasf 2rm(mo;o1tlenmo3iatfs2ul(vsn()alxnmr3tadlm   neol(  exo(r3oo4lm e ivsat  Dtaurpnt4tptoifciyt a2elnmp;t0 eenif oydlm  lu i;( s2xoxr iu4lp   fvsa(faDraxmpou1opt ifctyt aDumums;() eermo iydlmDr uvi t)tetmio nu1ol elfes t)s2uau oot1tlx  i3iaslmDrau snu)tetrif3iotoaDe ivi t) rxo(r3oodllt lfvs ( arrm(m no0alxn f3tld m2emn snt)tlxrxo oo1latr u s s) rxmxm3ou4oltnlnetls a2urxmpot4opeoifeilsls2rmump;() rerxociotfat aiesl() 2ur(m3iu1omtnlivilt srur(mooo0apto fctatfm umuvo;t)tltnio3tadlm  auvs s seurxr oodlmtnmnvsatfs2rax p;o0apxniieilt sDrlumsnu) eermfcoydlatrauei t seuoirpno4omtnlfcs (faDuru o;t4tpeomocildlm umuvp;u4aexrif3oytfa r u o;s s2uo(m3ou4ol  lfet t s2rmumonu0tet micildls ra( snu)teenmr3oo1fa   n s s setrir oy1oltnmies tfs2ua(mpot0optomictydfa2umn snu4tlxrxrciadfm  ai ol( sruo(r iu4ap n nvsat srur( p;o0alen fetas mDemnvonu0teeoif3iodfmDr ivols t2xoxo3ou4lpeemnvsltfartmx pnu0aeeo i3iytfa emnvpnu0aexnir3tydlat aivo;s)srxoiopiy1lpee nviatf rrmx  ;u4alxn oeilsfmDel( o;u0alxomo3ta1fpte uvi;( t2xmxo3ou1lptnlnvs ( srrru pot0openmfeiasfm ulnvonu4trermo oydlpD auvi () 2trim3oydam  lfetas  rra( ono4opxo fctydfaDuanvo;t4 eenmociytlpt aies s sexrio3ny1op elnvt () 2rrur ;o0tetn ietat a em(mpnt4 exrir tatfp  aivs;t0texoxo oy4om elicias a2rau  nt4oetnmictytls2elnvp;() eeomr totoaD  ueslt t2um(m iodlmte fcils a2tmumo;t0tpt  ietlt a rm(vpn()alxnif oodopt anes ( seurxo nu1ale licsl()aDrmx  ;t0opx mietatfm2rmump u4artnir oa1lmtran slt0seum(mpiu4lpeemfcta(fsrrr(rono4oexnmfciltfs uauvp;u4aexomrciadfa  au i;(0s2toxr io4op   fcsl(  rurxm nt0aeeomiciyt sDrlnvs;t4 lxrmoctatlaD li ol(0 2xmim3iodap   ivsl(f 2tm(rono0tpxomfciyd s ea( s u0teermf iadlm eli sl(0t2trirpoo4alee nesa()s2tm( ooo0tet  oeiasfs rmnmo u0 lxnxociytfpDe n o;(  2xm(r3oo4aptn nvil(fa2um(monu0ale ioctad aDulnvo;()trxrircoytfaD lu s;t seuo(mpoudom  licia(farrmur nu0opx  o3tasla2um( ont0trenxo to1fpteaues;t  2xo(opnu1amtnlnvslt)srrmxmp;t4aetnioeiytlm ea(vo u4texomrcoodlm   nei;s0texoio3nu1omt  icsat sDurxrp;o4oltoif3tlslm emnmsnu)arxnxoctadlpD aieo t)trtrio nu1lmtnlietl()s2rrxrp;u4apt  o3ils a2rlumo t) leomr oodom  lnvs t) 2xoxmpnu4alee fetl()artmumpnt1oexoif3iasfaDeln pnt4trxrif3tydlm rli i;() rxrim no1opee iei t srrmurpot4oexo octls a2umn pnu)aeeoxfciadlpt anes t0 rurim3ou1lpt  ieilt aDtrx  ot1aet  f3iltla el(msnu)teeomo iy1om rai s;()texoxr iu4lm n ici tfaDurumpou0tetn oeiatla em( s;t)tleomr oadfmte u il(0s2toirpou4ll n fciat aDtm(ronu4aeenifeildls2rmu pnt) rtnio oodomt  ivsls0trumxm no4lm  mfetls) rrmxro;u4aexniietld a2um(vp;(0 reomo ty1opDeluesls) rtoxo iy1ap nlnciat)a2urxmooo1oee micilt s ean s;(0texoir3tydlmt  nei t)texoxr iydom n ncta() 2umump;t1opxoiiciadlaDuluvo u0 rxoxo3iytfmD  n i;t) 2xr(o oo4olt  ictl( arumxmpou0oeen fctys s2ulnmo u4 exrxoctydlp e ieolt trxrir3oodap  lfvtlt)sDrmumonu4aexn i3iyt m uluvp;(0 eeoxr to1lp   uvol( t2tmimpoy1omtnmnei tfartrxroou0tle ifciasls emnvpnt0alxoxf3tatlmDelu i t teto(o ou1omtn fcs s)arraxro;t0aeeniiciasls ul( s u)teenmo3todlatr ieilt0 ruoxo oo1ap n ivt s) rraum ;o1tlxn o3tasla ua( onu4treomr iodlpD  u ils) 2tmxm ou1ole mieilt)arrmu pno1tlxnioctaslm eln pnt4 lxrxo3to1fmteau slt0texr(r3io4olen ncia(f Dur(moot1alx iieiltla2ulumpnt4tetoxrcoa1faDeai s t0sexmxm nydale lfeils)s2uru p;o4apto icils a ran pnu0texnif3iotfp   uvs t trurxrpiu1lmtelfcsat s2rmu oot4oee ioeiydfsDrmumon(0tetnif oa1fmt an ols) 2xm(r3nydlmeelfcia(  rtmxm ;o4opxnii3tld aDuanmsnu0trtnxr oadop   uvils) 2umir3oo1amt mfesat)aDrm(ro;t4tpxomiciydfsDraump (4 exrxocoo1lm   neo;t texoimpoo4lm emncs s) 2tr(rp;o4olx mf3iaslmDulnmo u4tleomo3oa1fmDraieo s0srxr(r iydlpee fei s s2raumpno0tptomf3tlslm ra(ms;(4 exrxo3tadop elueols  ruoxm iodlpt lnctls a2umu  ot4apx ifciadfsDuaump () exomf tytopt lues t s2xrxo iu1alee ies tf ruax o;o1texoii3tlsfa2ulnvo;(0tetnmo io1fp   ues;()srto(r nu1am e ics ()aDra(mp;t4tlxo ieildfs emnvsnt)tlxniociodopt an s;t)tetriopoo1oleemfvsas  rtaxrp;o4ale  ietls s2rluvp (0tlerxf io1opDraivi s t2trxm iy1ap elfesl( a2umxmp;t4oexn ociadls uanmp;u0trenmociotopDeliei t0s2xm(m3ny4amt lfct s) 2uru  ;o1ape ii3tldfa2eaump;(0aetnio3io1oate ieol()trumir3nu1lpenmivslt)a2rax pou1alxoifetldfs el( o;u4texrir3oydfa e ivi ( sexmxo3oodll nlfetlt a2tau  ;u1alenifeiysla eau p;()aexomr tatlat auvi s0 etrimpiu4lltnlnei t)sDtru oou1texo fetad m2rm(vp (0alxnif oy1fptrli i;s0 rum(m io1om n ncsas) rumxmoou4tetomfcilt a uluvp;u4 rtrxo oa1omDe ivi t s2uo(rpoodopenmnct t s2tmurpoo4aetoif3iaslmDulnvp t)tltomo ia1fmDrauei;t) 2tm(mpiudolt  ivs ( artmxmpoo4oeen fctydfs2umn s;u0tltrxo3ty1oaD aivo s0t2xoxm3ou1op  liesat  Dtaxm nu0opx  i3tltfm2ranmp u0trtoiocty1oa r nei;s0 2xr(o3io4alte nvtas)sruaur ;o0tet moctasfs2umnvp;t0trtrxo3iatomtr ies ( teuoir ou4olt mici s)aDtmxm ou1alxnmf3iad mDulnvo;t) lenmfcoa1fmDraies (0teuoir3iu4ap nlfvt t)sDta(mp;t4tlt  oeiysfmDumu s t) rtnxo3ta1laD  nes s0teur(r ou1om  mfvsl(fs2tr( ono1oee  fetlsfmDea(vs u4 exoxr iydla r ueo ()trtmxopnudopt lfesasf 2rm(  ;t1tpenmieiasfm umn onu) exoio ta1fmDeluvilt0sruoirpiodamen neils artmurpot1alxo feiydfa ua(vpnt0tlenmf3oa1oaD ai s;s)texmimpny1llte ncil(f rrruroot0oleo ictld a elnvsnt4 rxoio3tatfm elnes s)s2umxrpoydomt lictatf rtaur ;t1oet ifeild a2umnvp (0 rxnmf iodomDr ieo s  exo(r iudalenlnctatfarrr(mpoo4olxoioeiyd m el(mo t)alxomfcia1fptrlneo (0trtoxr3ny4amtemfcsa( a2tm( ono1oexo fciatls rmu onu0trtnif ty1fpDeaivi t) eumim3no4lleeliesat)s2uaxr ;o1oexnifeiydfs rlu s u4 rxnmf iy1oatrlneo;()srxoxm iydllt mfct sf 2uaum no4aptomiciadlm2rauvp u0tltnircootomt  i o ()t2toxm3no4om   ncsa(f Dtax onu1oeenii3tas sDelnmpnu0tlerxr3iodfptrluvo;t) rxrxr ny4aptnmnci ( artm(m ;t4tpxomo3iltls2umnms () lxomo todlpDeanvi t  rurxopno1oltnlnct ()a2rm( pnt0tlxn fciyt s2rl(vs;u0 ltrmoctodlpte ieo t truoir3no1altelncsl(  ruau ono1aee io3iadfsDra(mp () etnmf3oa1op  ai olt)trurim3iu4lm  lncsas)arrmx o;u4ape  i3ild m2ulu s;u4arermocoadfa  anvs;s)srxrim iydaltn nci s srrmx  oo0tpe moeilsla ul(vp u4aeermoctadlpDrlu i t0seumxmpoy4am nlfvilt  2rm(moou0apxnioeiytfmDeaums u4altomf3iatfate n i t s2toxmpiy4aptnliviasfarrau pot4olxoifetytfsDumuvp t) exoxf oatlpD  uvi t0s2um(r oo4lptnmfetat)sDrm(ro;t4tltniieiatlm emuvonu)trtoir iy1latrlues;()trxmiopny4lpe lnct tfartmum nu1aee mi3ildfaDelnmo;u4 reoio3ta1latrlivi (0texrimpoo4ol nlfviat) Dta( oot1tet micild aDuaumo;u)arxrxo3iatfm eluvslt t2toirpou4am elietat)srrrumpno1tlxoii3iyd m2umn on(0 lermf iatomt aues ( tetrxr3io1ame mivtltfs2um(rooo4alx iociadlaDua(ms ()arerxfctodom elu sl()trtmxr3iy4amtnmnct tfaDrr(mp;u0optn ictasfm ulums t)arxnxr ootlp ran ols srumirpoo4lm nlfvs s artm(r ;t1apx iietysfaDrmump;u)aeeomfcoytfpt lnes s srumim3ny4ole  ivsl(fsDrau  ;t4oee ifeilsfaDulnvonu4arenmr3io1lmt  uvo s seuo(m oy1apt mieiat)aDrrxrpou4tetoio3iasfmDrlnmon() lxoxo oo1fmte ies (0s2toxr iodlmte ies (f rtmx ono4oetnii3iyd mDeluvo (0alxoxrcoydlm   ueolt seum(m3no1lptn fvsa(fs2raurp;u1oee  iciadfm elu s t) rtoxo oytlpD ai ils) euo(o3iodll elnvt s)artmxm ;o1aetnioctadla rl(vo;()alxnmr oatlp e ies;(0s2xoxo oo1olt mneiasf rrmx pnt4tex mf3tad sDemn snu)aexrxr3oodlaDraieol(  2xr(r3oodope lfeia(  rumx oot1tleo o3iad mDua(vp;(4aexnmo3iotlm  ln s ( setm(m ou4ap  livt sfaDta(  oo0oetoioetat a2rmn on(0aleoiociotlmt  ueol(  euo(opio1al n ieslt  2urx o;t1aptnmicias m2uln p;t4teenmf ty1lmDe uei s)seuo(mpnodom  micta( sDra(roou0oexo fetytls emu p t0aexrif3io1op rli s t0s2ur(o3nudale  ivtl( srurxmp;t0apxnmi3ilsla ulnvp t0aetoir3iotlp  li il(0truo(opio1ame  nvils  rtm(r ;o4teenifeiltfs2ra(ms u0texnmo oytopt  u slt)s2tmxo ou4oltelnvtas)s2rrxmpnu0alx moetat s rm( p;(0arxnmfcta1oatraivo;t)s2umxo3nu1am  mfeias) 2tm(rpnt0aleoifcilslmDeanmp (4 reoxr oydlmt  ueol(0sexrxm3oodlle livtl()artrxront1optn oeiatfa rl( s;u) reoxrcoo1lm  auei s0tetr(mpny1opte ivta() rrrxmooo4olxomieilsfa um(vsnt0 eeoxf3totom e uei t0 rtrim no4al  mneiat sruru oot4altniietytlaDelnvp t0aetomo oodopDe uvo;t)setmxopiydll emnesasfa2rmumoot1texn feild mDumn o;u4tlerxocoytlmD  u o;() etmir3oudop elfes t arrr(moou1alx  ocildfa um( s () etoiociy1fmD anes;( t2tm(m nudaltemneilt)arra(rpnu1altniociad s2eauvs u0 rtoxo3oo1op elueo;s0trxmxm no1ap nmfei s) rtrx p;t4apt  octytfs uau s u4arermo3ty1opt  iesl(0 rxrio ou1apen nvt t aDrmxmoot0opxn oeiat m rmuvp;(0aetnmoctydfm raueils)t2tr(mpnu4lp nmivsa(  rrm(mooo1texomfctltls ulu o;t)trtnif oo1op e nei;s0s2urir nudoltnlfci sfs2rmu pou0openmocild a2ea( p;u4aleoif3ty1la r uei;t)texm(opio4aptnlfci s aDtax ooo0alxniiciytlmDel(mp;(4altnxf oa1oaDraivs t s2uoxm3oy1opt  nes sfs2urxrpnt1opx if3ils s ua(vsnt0alerxf tydfpD livo ()texrxmpoydlpen iei s) Dururpoo4aee iiciyslm2rm(mo;() etoirciatfptrlieo;t  etoiopoo4op n icias)srtmumoot1tle iieiasfaDuluvsn()tlxrio3ia1la eln olt  rtrxopnydolenmfcils)sDuaxm no0ale io3tadlsDumums (0tetnmf3iydomtrlu sl()setm(mpno4lm elfetls srrr(m nu0opeoiieiltfmDrlnms u4 exrmr todfpteau o s s2uoirpoydapenlfeilt aDururooo1apxnifeildfm2eanvo (4tetnir iy1opDrlu s s sexrxr io1lp e ivsl()arra(m ;o0olen f3iadlsDrlnmonu4aetnif3io1fmt aues s0 euoxm ou4llte iei (f rraxmp;t1oet  fetys s2ul(vs t4altnxr3tatomteai ol()seto(o3no4om n ncilt)a2urxm nt0aee mf3iysls2rmnvo;(0 exnxf3oy1la  luvs t  etoir3oy1al e fes ( s2trum nt0olen i3tas s ea(mp;u4trenmf todfmD  nvs;t)t2to(o3iy4openmnct (  rtaxrp;t0oeeoio3iltla emn sn(4tlxnmrcto1lm eauvs ( t2toir3oodamenlnvtas) Dum(m ;o1oet iictatfa ra(mpnt) rxrir3iydlaDeluvolt0srxo(r3oo1am emivta(fsDua( pno4aexn ietls a2eluvsnu)alerxf oa1lm elieol()s2xr(rpnodaltelivtlt  2tmu  ;u0alenifeiysfmDum( p ()tetoircto1omD anvo;t0t2xrirpiu1olenmnci ( sDtaxr oo1oetoiietltls uan s t0 ltoio3todomDeai ol( trtrxmpoydam  mfeil( arurx poo4tpxomociyslm2eaumon(0aexoxr totla ranvolt0srur(m3iy4lmtn netas) ruru ont1olt mf3ils sDum(mpn(0arxoxfctodfp  aivol( t2toxmpno4lle micsl(fsDrmxr no0oee iieild s rmnvo;u4tetrmo3oatla rai ols) etmio nydllenmfesas srtaxrono0aptniictatfs ran pn(4tlxoxf3oatfaD  u ols  etmxr3iy4ameelivs (farurumpoo0oetomf3tad m2um( sn(4aexrxo3oytlmDeaneils s2tm(r nudomt  nesls  Dtm(m nt1tpxomo3iatls rmu p;u) eermf3oodlptr u i t  eurim no1ol nlnvsatf rtau pnu0aleomf3tls m2rm(mo t4alxoio3iydopt  nvs;()trurio3iu4apte ivsasf Dtr(  oo4aetomfeiltlm emump (0arxoio3ootop  anvi;t)s2uoim nudolenlfes sfs2tr(  nt0alxomictadfm ul( o;u4trxrmr oydfm  ln ols s2um(opiy4apenmfvsat)s2raxrono4aetn oeiasfa2rm(mpnt)trtomr ootlmD aies;(0setrirpiy1omtnliesa(  2rrxmoot0ale ioctlt a2ea( o (0 leomfcto1oa raivs s0t2xrxopnudaptnmict tfarrrxr ;o1optnio3iys mDrmu sn(4altomr3ia1opt li s ()t2xoxo3iy1apte nes ()aDra(mooo1aetn ieiadfa emums t4 rtniocta1lmteai s t trum(m3oy1ap elfvilsfsrrmxmp;u1opxomfetatfmDrln p;u4alenif3tytfmDe nei;( tetr(mpoo4ameemfesltf Duaxro;t1aet ioetatfs2umu pnt0aeenmo3ootlmt aieilt0 etmxm3nudoltelnes ()arta(rp;t0oee mf3tasfm rm(vo u)alxnio3io1op eluvi t)texo(m iydamen ivia( a2raxm nt0tlx  ocildfmDelnvpnt4tetrxo3ty1lpDeluvs t)trtm(m3nu1lm nlfvia() 2umxmo;t4ole moeiad a2rm( o t) exnircoatfmDrau i;(0teto(mpnodamtnlfviltfa2um(r ou4olen iciadfa rmn snt4altnxr3ty1fpD aieslt)t2tr(o3iy1lp  lnvi sfs2rrxmooo0optoioctat s eauvp;() exnmf iatlpDr nei;(0setoxopny1lp   nciatfsrrr(  ;o4oltoiietldfsDuau p;t0aleoxo iodoaDr i olt teto(m iydolen feil() 2raxm oo0oleoioctas a ua(vs t)alenio ty1lateai s;( texr(r3iy4amt licslt srtmurpnt0tpeniiciasfs rm(vs (4tetrifcio1fpte nvo;()teur(o3nu1lmtelnei s) Draxroou4aptnmieiys a em(msnu0tltrir tydfmtrai i s srxmxr3iy1alee ncia() rumu  ot4tltoifciytlsDrmn pnu)tltnir ootlaD  ivs;t)srtoim oy1omteliei t  Draxmpnu1opxoio3iydla2ran on(4altomf3totlpD  i i;s0trtr(o3oo1ll  lfetl() rtaur ;u1opx mictytls2rlu s;u)treomf3tydlmDrluvi s0srtmio3iy4al  mieias)sDrmumpoo1olt mi3iys m2ulnmont)trtoircoo1oatrlnvi t)tetm(rpnudlptnmiciat  Drr(ro;u0aptnmfeilsla rm(vo;t0aeenir ia1fateanvi (0truoxmpiy4lp e icsltfaDumx onu1tlx mictydlm ua(vsnu0arxrmrcty1opDr ivo ( t2xrir3oy4ale mnvtatf 2tr(  nt0ope mfetyslaDean s;()trtrxr3iodopDeanvs t s2xoiopiydlpe mivs (  Dta( onu0oetomfctld s2rlnvo (4tltoio iy1fa  lneo s srtrxm nu4omeelicia() 2raur oo1tex mi3tyt mDra( o;u)artrir3iydoaD lnes s0t2xrxm3oydllt liesa(farraxmo;o0opx mi3iyd s rmn pn()trtrifcoadfaDeaieo;t0 etoxr3ou4om  liet tfaDta(ronu1tlxniietytlaDumnmo t0alenxr oy1la rai ols)srtr(r iy4lm nmfcia() Durxro;u4apx  ietasfm2emu p;()tlxrir todomtrauvolt0srurirpoy1oltnlnei ( artaxmo;o4texomfcildfm2eln ont) lxnmrcoatfmtelieo;s0tetrim iudom emnetls aDraumoou1olxn fciytfs em(vpnt0 eenxociatlat lu i;t) 2trim nydlpenmnvsas) rraxmp;t4oee ifetldfa um( s t) etoir oadopteaivo t  rtrio3oy1aptemfcs sf ruax o;t1altoioeildla ua(mp u4 exrmr3iy1fp rli o (0srumio3iodlpe lncilt sDtaump;t0tlxoii3iyt s2rlnvsn(4alxnifcootfm e nes;(0 eur(r3iy4am nmivi s) 2rauront1olto ieilt sDemnvs;u4alxnmr3oy1opDeaivols)s2xrxr3iodoptn fcsas  2tr(rp;o1alenmfctlslm rln s;(4teenxr3oatlmt aneo;t srtrxo no1ape  fesasfartrurooo0altn fetatlsDel(vo;t)trxoxrctydlp ean i;s trtmxo io4lltemnci t)a2rr(rpoo4aex mictas a umn o;(0tetrxfcoa1fa   ueo s)s2xmxopiy1ll nlivt t artaxm nu0tpe mf3iyslmDuanmpn(0arermo oydfp eaieolt  rxmir3oydlp  livils)s2um(m oo0teeoii3iatfs2ulu snt4aexnio iotfm r iei s)s2uo(m oo4opt mfvtls  Dtmu  nu4aee if3tatlm rauvo u0 eeoxrcoatlpt ai s t)srxo(r oodal  mnct s) rta(m ou4tltoio3iydfsDumnmo;(4teenxf3oydla  li o t0s2xmxopnodalt mnvtat) Duau pou0tpen oetlslm eauvs (0aleomf iydfm raivs s) 2tmxo iodamtnlneils)sDum( o;t1tex micildfmDean s (4trxomr iadfat  uvs;(  2xrim3oo4lmeelicsl(f 2trumont1oee mfeilslsDrau pnt) leoxf oytfa   nei t0srtm(o iu1omenlfctas)sDraumpno0aeenio3iadla2eanvpnt0trxrxo iatomteauvilt0s2uoxo io4op nmfet s  rur(mo;o0olxomoeiat s2rlump t4tlenxo oadopD  uvs t trum(o3no4lltelneias)aDrmxmpou4oex  ociytfs ul(mpnu4tlerxf ty1fpt livil()s2xmimpnydaleemncs (  2tm( pnu1tpe mo3iad sDelu s u4 ltomo3iy1op rlu i;t seuoir oo4op nmies t  rraxr ot0oleo ieiad m2ean p;u) ltrio3io1lp   i sl(  2xoxr3iodlpt  ivtat arrm(m nt0oee mfeiadls2uln p (0aetrmf iydomt  ueils0 2umio iodop emict s) 2urxmpot4aee mieiad m rlumpnu0 etrif3oytfaDe iesls0srto(o oo4ll e neils)srururoot1apx mfetldls2ea(vsnt0artnmfctadop e nes;t0t2tr(opnudolenmiciltf Draxr no0oeeoioeiad m eanms t0alxoif3iadfmDrau o s0s2umxr iu4olt mfcs t)aDumur ;o0aeto oeils m um(vs t) eeniociy1oaD auesls)srxrir3ny1lme  fvt (fsrrmu oou1ale ii3tydlaDulu s;u4trtnxo3ta1lpteau i;(0t2xoio3iodape lfcia(  rumur ot0tlt ioetaslaDrln o;(0artoxo tatfaDr n s ( texmxr3nu4ol n nvi s)sDurumoou1ope moctldls ulnmpnt)trtrmfciy1op eai s;t)sexoxo iydap   fcilsfartr(r nu0tptoiocild m2rmums u0teenxr tatlp   i i t s2xmio nydll nmiesasf 2trx  ;u0olxn f3iatla2elnvo;t4tltnxf iotfmD  ies t t2xmirpiodaptnmfvtas sruax poo4openifctldlm rluvont0 exnmf3iydlm rauvol() eto(opnodomt mictasfs2tru p;o0ole iiciltlm ra(mp;t0aeenmr3oy1fm eaiei;s0srtmirpiu1ole  ivs s aDtax oot4tlto o3ilsla2ean ont) leomf tytla  aivil( sruo(opnudomee ivt t)sDtrur ot0oex ioeiaslmDemuvpnt)areomrcio1fate nvo s trxm(m ou1lmeelnviat)aruaumpou0aex ifetasfa2rm(mo u)aleoxo3ta1op rlu o;s0 rxmiopou4ol emnesls  Dta(mono4oexoif3ils sDuluvs;(0aleoif3oydlp  lueols texrxo3ou4apenmncilt arumur nt4aeeoifetytfs ranms (4aeenxo oadomteluvs;s) rtoiopio1lp  lictasfs2trumonu0oet ii3iyt a emnms;t)aetoxf oodfmtrau o t)sexm(o oydalte ictls)a2trump;t0oleniiciadls uau o u4altoio oodoatr nvo s t2to(r ny1ol n fetlt  2umxm nu0open oeiytfm ua(msnt4altriociodfpDrlnei;s0srto(opiydalee ivi ( sDrrx p;u1aptoifeiad s rm(vp t0trxnif oydlmD  neilt0 euo(o iy1am nlneia() Dtrxmpnt1olt moeildla rln s u)alermf3totfptrlnei s0 rxmio io1llenmfetlt aDtrum ;u4olxomfetat a2ra( o t0aetoxfcoo1omt  i o;(0setmim3ou1amee ics s)arrr(m nt4aet ifetltfs2ra(mon(4arxoxo oydomte i i s) rtm(rpnu4apt mnctls)a2tr(mont0altoioeiatfm ranvs (0 leoir3iy1fateau s;t) 2trio3iy4ll elfvia( a2rm(mpot0tee  feils s2rlnmon(4aetnioctadfptrlivo t sruoxmpoydopt licsat a2rm(m nu0oeto fciad aDum( o;(4aetrio iy1fpD  ivi;t)t2xoxo3nu1lp elncslt) 2urxm nt4tptomfetltlm2uln pn(0altnmo totfmD lnvo;t0srtm(o3oy4aleelfcsasf 2ur(rpnu0teeo ieiyd aDuanvont0trermr iadlm r ivi;s  2trxmpnydopee nei sfsrur(  oo0aee ioctatfa rlumo;t4arerxr3to1fpD  u s (0 2trio3nydol  lnei s)a2raurono1tpto iciyslaDel(vp (0alxoxf iydom  ln ils srtrir3ny4op emfcilsfaDrmxroot0opeomi3iatfm2rm( p;u4tlxnif iadfmt lnvo (0texrxopno4lltnlneslt)a2rrxront0texo ietyt s2rmumo;t)tetoif3todomtrau ilt0 rtoxm3iu1omtelivtlsfsrrrxm ;t1apxn iciydfa elnms;t0texoxfctatlpte ivs ( srxoxo3ny1ale lnvtltf rtmumpnu1alt mocildlm rlnvs;t4 lxrmf iadopDeau o (0 2xrim3nu1op  lncil( s2rru  nt0aetnio3iltfs umnvs (4trtomf3to1op rlies ( trtoxm ou1ole mfeilt  Dta(mpno1oeto fctltla2ul( o u0teenxrctatfptrlnesl(0trxoxm nudll elnvsltfsDta(mp;o4tpx mf3iyd aDuaumsnu0trenxrcoodoa  aiei;(0 rtmxr iydlm  mfcilt)srtmxmont0tlxo oeiytlsDuauvs;u)tetnir3ta1faD aies;s texrxo3ou1omtnmfciasfartaxmono4tltnifeiltfaDumn pn(4alxoxo ootla  lnvi;() rxrxrpnodapeelfetls)aDurumo;o1apt  iciltfaDemnms;(4 renir tatoa e uei;() 2trxo iudaltelfviat sDua(mpoo1teeoiiciyt a ra( snu)tltnxfcty1fat auei t) rtmxm nydapeelnvilt a2tmx o;o0alt miciltlmDea(vp;(4arenif3ta1la  luvs;(0t2xo(r nu4lpe lnetatfaDtmxroot0apx mf3iadfs2um(vp u0tetoxo oy1laDranei;(  2uo(r3oydolt mfet tfaDtrum ou1oex mieildlm ra(ms u4 ltoxr3ootlaDr ues;s)srxrxmpoo1am nlfctls)aDrm(r ou1alxnmfcilslm2uauvs u0 rxomf3iytlaD  iei () 2trxm3iudll nmfvta(  rrr(  ;u1tpt  i3ilsla ulums t0 lenmf3iodfmtraivi s)srtr(r iodopt  nvia(fs2rmumooo0apeo oeiytla2rlnvs;u0alxnxocoatlmD liesl(0teur(o ny4ol   ncsat)arum(roou1open i3tadfs2elums u4altnmo ootlp e u sls seuoirpio4lptelfcia()aDtax ono1oetnif3iltlmDrauvo;()trtnxf3tydfaDe u i (0trur(o3ou1ap  mivta(faDumurpnu4tptn o3iytlmDemnvo;() etnxfciadlpDraneils0 exr(opnodomen fcsls sDrr(rono1oetomi3iys m2rlnms ()tltrmo3to1fpDr u i;t trurim ou1llt  fesa(fa2raum no1tle  fciatlaDum( snt4teeoxf oa1fmt lnesl() 2xrim io4altelnvtatfs2umuroot1ape mfeiltfmDuln p t)arxnmociotoa r u s;t setmxm3nu1aptn iet s) 2ua( o;t1tpeo oeiysfa rlumonu0tetomr tydfatrln o;() 2uoxrpiodamen ncsls)arrax pnt0aptoifeiatla ua(ms (4tltoxo oadlm eliei t  2xmirpoydam  mfesat) rta(mp;o0olx mf3ildlm2rmumo t4 ltomo tydopDeanei;()tetrio3oydamen ict t) Durx ono0teeomietyd s2ul(vs () lxrxr3oa1lat lneo;t0s2trxm nu1aleelfesltf 2urxm ;o4tex mociasls ulu s t4tlxnmf ootlpDraneo;(0setm(r iudol nmfvi t)aruax  oo0tptoif3ildls um( pn()alxnmf iadfaDe nes t0 etrir oydalt lnvta()aDraxrono0oltomf3tldfa2emn s;t4 etrio todopDrln i;(0 2ur(m oo1lmt livsatfaDuax oot0texn i3tls a2rm(vp t0aeermf oodlp  aivi t0 2xrim nydlpenlncias s2ra( poo4ope  i3tlt a ulu o;t4trxnmf3iotlp r ies t)s2umirpnudll  lici tfs2uau pnt0aeen ietytfm2ran s u) exrxociytlmtean ols s2trimpou4ape lietls)aDta(r ;t1tptnifctld sDrln s u0tlxrmrcoatla elu ol( tetrio oo4opeemfesa(fsrrax  ot0altoifcildfa ua(vo (0alxrmfcoy1lpDeauei s) etmim3io1ll nmieia( srta( pnt4oex iiciydfaDrlnvp;u0trxoifctotoaDr n s s) etoir nydol emfciat) 2ua(  ;u0olxn feiysfm2rluvonu0teerir3iytop  au sls  2umxmpio1aptemnvilt) rtax  ;u0teeoiociyd a2ranvo u4aeerxo3iotoat lueo;(0s2triopoudoltnlnvsl( aDra(ro;t1tpeo ieias sDum( onu)trerir oytlateaneo;s trtrxopoy4openmnvsasfsrra(monu0tptniieiytfsDrmump;u) eeoxf to1faD luvil() 2urxopno4amtemfet tf 2ra(mo;u1aptoio3iltlsDumumpnt4 exnmfciadoa rli s;() ruoxo oo4om elnetls)a2uax oou4aet moetltfm rl(ms;t)arenio3oatoa  lueo t0 2uoxo3iy4amtnlfctl( artaxmo;u0tet  f3ilsfs2emn snt0tetomr3tatomD anvs t  2xrxo nu4lltnmfvs t)sDra( pnu0tlenif3taslm2uaumonu4 rtnxo iatoa   u ols0teuoim ny1lmenmietlt) 2rm( o;t4texo fctltfaDemnvs;u)arxnir oodomD lieils0 rxoxm3ny1opte fcias  rrmx  ;u1ole iiciyd m ulump t)trenxf3ty1laDelnvs;t  rxmio3iudomenlfcs sfarur(m no1oexniocilt aDelums;(0tetoir3tytfatelnvo;() rxrirpnudapt  fvt sfs2uaump;t1tleomieiatfmDeauvonu0 rxnmocty1oa r nei;s0trumxm3iodlpe mivs (f 2uau  no1texn f3iyt aDulnmo;u0trenif todoptrluvo t texo(o3iu4ap  lfciasfaDuru onu0altoii3iat m emumsnt) leomfcoytlate ueslt)texmxm oy1openlici () 2tmuroou0alxnio3tat sDum( o;u) exrxfciadomDrluvslt)srxm(o ou4llt  iei sf Drmxmp;u0oetnii3tyt m ea(vonu0trenxrctodfaDe nvolt0teum(r3ny1opeelfcils)artrurp;o4alenmfeiad sDel(mon(0aexnmf ty1om ranvs;s tetoiopiudal  mivtat  2rmu pou0opto icildls2el(vs u0 eerxoctytlpDr uvs;() etoxm3nu1ol  lnvt sf rurx  ;u1olxn ocilslmDumnms;(4aetrmo tatopDeai o ( s2xr(rpoo4ope lfeta() 2uaxm oo0tpe  ocilslsDumn o;u0artnir3oytoa rlieo;s trurirpio1olee ncsa(  Dra(mp;o1tpeoiiciyslaDumu s t0trtoir3oydlpD  nvol( texmir3nydaptnmnviasfsDtrxro;o0oltomoeiydfm ea( p (0 lenmr3iy1lmt lueil(0teur(r oo1altn ietas  Dtmu  oo0tex mictydfsDemuvo;(4 ltoxf3oodoa e uvo s) exrio3iu1al e ies ( sDur(  ou0opxn fctytla2rm( o;(4areoio ia1omDr i o;t0 2xoxrpoodlptnmiesat s2tr(mont1oeen i3tytlaDelnvp;u)artnmf ty1oa rlueo;(0t2toio oydale mfcs tfarrr(m ot1apx  f3tysla2rm( snt)trtnmfciatfa rlueil(0 eto(opiudapeelfvtat arum(ronu1aeenii3iytlm ua( sn(4aeeoxf oy1fateluvi s)trxmxrpou4ame  fetlsfs2tr(m ;t4tpe micilt a elnvo (4tlxnxo3to1fm r nes;()setmir3iudapt mictlt arurx pou4aetnifciyd mDranvp;(4 rxnirctytla   n s;s tetrxo oudaptnmnvt (  Dua(m ;o0alxoio3iasfmDraump u) renxf3iydoat an i;( tetr(o nudlm elict sfsrur(r ;o1ale  ietltls2rl( p;(0trtrio iy1lat ln o ()s2xoxm3iy1op   ics ()artm(rp;u0optniiciysfm em( o t4teerxfciotom  luvi (  rxr(o ou4lm emncs sfartau  ;t4oexo fciyt mDum( on()teermfciy1fm r ivo t)srur(m no1omtnmnvt tfaDumxr ;t1teenmocilsfa2emuvsnt0arxoxocoydlp   nvs;s texmxo iu1lmt livtls)s2raumpot1ape moeildlmDea( s t0altoxrcoytfp rlu s s0tetr(mpoodole  iei sf 2urxmpou0tee  o3ilslaDulumpnu4arerxociodopDean sl( trxmim3iudalt lfci tfsrrrx  nu4olto ociytfsDua( o;u4teenxo3totfa  ln il(  exrxr3nu1al e ivtls arta(rp;o4olto i3iydfs ra(vonu) rtrxr3ia1fp e ieo;t0srxoxm oo4opeemivtls) 2uau  ;t4tpxo oeiatfm rmu o;t)arxrmrctadom rliei s)s2xoxr oo4lm elieia() Drrx ont1tee  ieilsla uau p;t)tlxoxo3iotoaDraueilt sexrxr io4am elfctltfs2urx pou1teeomiciatfs2uanms;()artomr3tydlaDe n s;s  eum(m nodalte fvsa(fsrrrxronu4oetniieiadfaDrln o (0trtrxrciy1fmD ln s t setmxm oy1apenmnvi t  rrrxmono1aptn o3ils mDemnms () exoxr3ta1fmD  ieil( teur(o3oudlp e ieslt sDurum ;t0olt io3ils s2ulumo;u0 lerxf3tydoa e uvilt t2xrxo3nudlpe mnetl( a2uauroou4opeoifeias mDel( onu) etrio3to1fmDeaivslt) rumxopnu4apen feia(faDtmumoot4oleomi3tasfmDuan s u0aexrif3iotlp rli ils s2toxr3oy4lpte fcsas  Drax poo0olto oeils m rmump t4tetrxf3tatlm  anvo;()srxoir3ny1lme mnctas aDtm(r no0open ocils a um(vp u4 lerxo3todopD  n ilt  2um(o3nydllt mivt ()sDumx p;o0oexo fctad a2rmnvsnu)tlermf3iotfa  lues t  eurxm no4llenlfeta(f 2taxro;o4ale  f3iasla2ea(vp t4artrmfciytopDr ivsls  euriopiydome  nesls) rra( ono4alxn iciaslsDuanmp;u) rerio3iy1lmD ln o s)t2xmxr3ny1aptelfvia( arrm(mpnu0apenmocild m2rlnmo t0alermf3oatoateai s t)truoio iudol elfeiasf Dumur nt0tleo fetyt s uan sn(4alxoxo3iadfp r nvsl(  exo(m no4ll  mneiatfsDra(r ;u0tex iicild s rmnmp;(0aetoir oy1lm  liei;s setrxm3iu4lp e fetl(fsrrmx pot1tleomietadlaDrln pnu)alxnir iatlmD li slt)t2trio3io1ame lnei ( a2rrxm ot0olt moeiytlaDum( o (4 rtnio3oa1oat  nvolt  exmxopio1amt  nciat) 2raumpot1apxnmo3tyd a2emu o ()trtrir io1opt  ivi;()s2urxm nu4optemiet () 2rmu p;t1oeenmfciytls2el( s ()alenif3ta1fpDeau i;s0sexmxmpnydlltnmnvsasf Dtmurp;o1opeomietat m2um( s t0 lxnxo3oy1lat livi;s)sexoio3oy1lpen iesl()aDrmum ;t1alxo i3iytfm2em( s t0tetnmfcoy1om  li i t  2tmiopno1lm elfet (  rrmxmooo0tlt  octyslaDranvs;(0trxoir3iy1fp   uvslt0srur(o ny1op   ncia() 2urxmo;u0alxn oetadlm2rluvo;u0texnmr3tatfat  u s;(  etmir nu4om nlneias)s2taur ;u0teenmfctyd aDem( p t) lenif iadlpte n s;()sexrim3iu1apt  ncsltf Dur(mpot0opx mictasfm2ua(vonu) exoxr oo1fm  aieslt  rxr(r3ou1lltemnei s)arta(mo;t0tpxo i3iyd aDem( on(0 lxnmf3iotopDe nvs;s  exo(r oudam nlici tfa2tm( ont0apxoifciltfs2uauvs u0tltnxf3ta1fpDrluvi s0trumxmpiudapte nvilt) 2umur ;o0alenioeiyt a ua(mp;t0 leoxrctodlatelues;s)sexmxopiudol e nvt sf Drru  ;u0tlxo fetys m ulnvo t0aeerxrcoa1om eai o;t0srxoiopno1lltn nvi ()a2rm(  ot4aptnmoctlslsDumnvo;u) rxnmociydlptr nei;(0seuo(o nu1olt licsltfs2truroou4oleo ieiadfa2em( pn() exnxo3oytfptrlneo;( srxr(m iy1ap elfct ()a2uax  nu4tptn iciyt m ua(ms;()tetnmo oytfm  lu o () 2uoio nodlm e nvias)sDrrur nu0olx ifeiatfa uau p;() lxnmf3iy1oatrai i;()sexmxo iu1opt lfcsl( srumx oou1olenio3iadfa uanvp;t)aetoif3io1om eau ols0teto(o3iu1omee nvil(faDumum ou0apenmoeiyd aDul(vo;u0 reoir iodomtelneols  2uoxm3nudoltnlfetl(faDraurpot0tee moctydfm2eln snu)aetnmf iatoate uesls)teuo(mpiodamt lnesa(  rtr( p;t1texoifeiyslmDelump;(0 lenmo tadlmtrauvs;s) rxrxo3iy4ap n nvsatfaDtmxm ;u0teen ieild aDean s;(4 leoxr iadlp  aiei;s0 2xmxrpiudamtemnct sfsrua(mo;t0oetn iciatlaDum(mo (0tlxomf3iy1omt  u s t0trumirpiy1omtemnvtls s2trum no0opeo fciydfs2rau pn()tltrxo3io1oatrai i t0 rxmxmpiy4omeelivias sDtaxro;t1tpt mfctytfm2umn o;(4alenmf tatlpD ln o t) exm(o io4lp n fct t srtmx oou1ale ii3tatlaDuauvsn()tlxnmrcta1fmte u s s) rxrxo no4ame  ictatfsDrmurpnu1apt mo3tyt a uauvs (0tlenmf oytfatelnesls s2urimpoudomtnmncia(  2tr( p;u1tee moctyt sDulnvp t0texnxrcoa1opteanes;s  exmxo3oy4lp elfctl(farum( o;o1olxomo3iat a2emnmo t)trtnxr iydlp eaivols0 exr(o3nydop  lfcsl( srurxm nt0opeomictldfa2rlnmp;t4 exrmocty1fmt anei ()s2xm(m nu1am nliciat srrrxmp;o1tetnio3iadfa2rmuvp;(0 rxrmrcoo1op  lieil() rtmim3ou1amtnmnvs t  rrr(r ou4alt mfeiyd m2el(mo;() etnxr ia1op eaivs;s0s2urim io4lltnmicsls) 2uaxmpot0tltnmictlsfsDul(mont4 rxnio tytlm  li ol(0s2tm(o3iy1om e icsl()arua(rpnt0teeoioetltfaDua( s u)aleomo oodfm eai o s)sexrxr nudape  nvs s)sDtmum ou0tptnio3iltls2umuvs t4teenif oatlmD li ils seur(r3iydlpen fctat) rumurpou1apenioetat s emu s ()trtnmocta1fmt li o;(0srur(mpny1lpe lnvsls  rtmu o;t1oee ifeils m emnmpnu4 rtnxfcoo1fp raneol(  2urxrpoydamenmnvsls)s2ra(m oo0apx if3iys a2ranmp ()tleoxfcio1lpD lu o ( trurxm io1lpeemfei t)srur(m oo0aexo o3tlsfmDrmu o;t0 ltrxo iotlmDr uvs s)s2trxopoodap   icsat) Duaxmono0tlt miciys a uanvpnt) exriocty1opte ies s0trumxm no4llenmfct t)arua(mono0tetnmfctydls umnvo u0 rxoio3ootfp rlieolt0s2uo(m3oydlm nlivsl(farumxrpot4tltniieilsfa uln snu) exnxfcoodlpDelivi;s0srtoxm3iu1llt  ivs t) 2rmu pot4alxoifctas m2rm(mp ()aeermf3tytla eaueol()t2xr(rpnodamenlict s  Dtaurp;o0apen ictydla rm(ms u)tetomo3iy1opDeaues;(  etoxm3iodoltelict s)aDrrx  no4ole  icildla eanmonu0 reoxr3oytlaDelivo;(0sexrir iodop nmfcsl( srraxmo;o0ape ii3ilsfa rl(mpnt)aeenmf3iy1omDr nes ( t2to(rpno4lm emfvsat a2um(mooo4tlx mfciadfsDuau s;t0tlxomrcoytla eaneo (  etoxo3oo4omtnliet ( arta(mont0aexomfetydfs ran p (4arxrir3oatlaD luei;t) 2um(m3oodlltnmfctl(faDurur ;u4oee ifetltla2rlnvs;t0aeenmf3tadlaD  ieo;t0 exrim iu1ol nlics s) rrrx  nt0aetn oeiyt a ran o u4alenif oa1lm  lnei;() 2ur(o oy1ame lfetasfarrrumoou1optnmociatlaDemn o;u0tlenxfcia1om raivs;()srxmimpnydalee iesas)s2rr( ooo4apxo o3iytla2ran o u4 eeoio oy1oat livo;s0 exoirpiudlpee fei s sDum(root0olenioeilt a2rauvont0trxoir3ootla eai sl()sexoxr no1aleelneiatfsrrr(root0aleoifctytfm2eluvp;()texoxrcoa1fmD lnvil(0srtm(o nydame  ivsas  2uaxmo;u1oetoiictad m um(vp u)teeomocto1lateaneslt  eur(m3iu4oltnmfvslt s2rmumo;u1aexo f3iytfsDuanmsnu4artnmo oodfa  ln s;t0s2xmir3io1oltnmnvil(fa2ra(ro;u1aeto feiadfaDean p u4 exnxf3to1lptean i (0sexo(m oy4ap   ici sfsrtax pot0tlxo ictydfm2rmnvp () exniocia1oat li o;(  etmir nodopenlics t)s2rmxrp;o0tpe  iciasfa2rl(mo;u0treoxo3oadla rai s;t teuoxo3iydomtelfes t aDrmx oot0oleomo3tatfm uau pnu0texrxocty1omDr n o;t0t2xoim ou4ap emfcs s s2tmxroot0opx if3ild mDrm( s;u0teeoif oadoat lu olt0 exmxo3io1om eliei t  Dtmu pot0apt iictydls rlnmo;u4altoxocoydlate nvils  ruo(r nydamtemncta(fsrraumpnt4texoiietytlaDem(vo t)alxrif3tadopDrlnei;s0 2urirpny1amt  fctat aDrrur nu0oleo fciadla ea(mp u)trxoxf io1omDr u o (0tetmir oo4op e nct sf Drmx  oo1aex  fctadls2ulnmo;(0trtnmr3ty1oa  auvslt)setr(mpiodal elfviat)s2uaxmo;t1tlx  f3iysfmDumnvsnt0texnxr tatla  aivs;( s2umio3iudalenlfesa(faDtaur oo0ole  f3iyslm2ea(vonu4 rtnxf tydla eauei;s tetm(r3io1amtnlivsls  Dtr(  oo4optnioeias aDrmumsnu4tltoxf3oadlpDrauei;( texo(o3ou1ll  mnvilsf 2uax o;u0tptoiieiytlmDrmnmonu4texrmo ta1lat  n o t0trxmxmpoo4al   fesl() 2rrur ;u1olxnii3iytlsDrm(mp;u4trtoxf3totfpt ln o (0t2uoirpio1lme lics s a2tax pou1olxo fcildlmDrln p;u0tetnmrciatfm eli s t t2tr(m iu1alt  fcil( artm(r ;u1tlx mociatfs umn ont0altomrciydfat ln sls trurir oo4ole  fcs tfsDtr(rpou0olxnmi3iltlaDua( p (0 ltrxrciytfm e u s t) 2tr(rpiu4olenmncta() 2ta(m oo1optniicild s2emu ont0alermr iatfa r uvs ( s2trimpnu4ome miviasf 2tmuronu0apeoifciysfmDrmn p;(4 leoio oydlpDrln ol(0seto(o3iy1ome mfctas)a2rmxrp;o0alx ifcils m rlnms t4arenxf3ta1omD  nvo;(0teurir nodome livt ( a2rmxmpnt4ape mociadfm2el(mp u0aeeoxo3iytlmD livol() 2trir oy1lm emivias) 2rau pot0ole mo3tld m ean ont0arenio ty1fp e i ilt trumxm oy4omenlfci ()aDtrx  ;u0opxomiciatla rmu s;t0 etnmociytomt li i (0setoirpiydlpte feil(  rtrx  ;u4opeomietysfs2rmuvo;u0artoio tadop raneilt trum(m io1ap emictlt) 2urxr no1tpe mf3iltlaDua( p;() rtoxocoy1omt lies ()tetrir3ny4lp n fcias sDumx ooo1alt  iciat aDrm(mon(4 lxrir iydomDelu ilt) 2xo(opoo4ap  mivt sf rur(  nt1aet  oeiydla elnvsnu4aetrifctatlp  aivils teumir3oo1lpenmncs (fsDurxroou0tpto o3ilt a2eluvpnt4aexnmf3oodlat luvo ()seurio oo4oltelfeia(f Dua(m nu1tpt  iciytfaDelums;u)trtoxfctadomDran i t0t2tm(r3nu4altn fcsl(f rumx pnt0aptn ociysfmDuanvs;t)altrxo tytfaDe n o;(0texr(opou1ap   neta(  rrax  ou4tpeoif3iatfm2em(ms;u)alxrxf tytoaD an s;()t2xmirpoo1alt mfcia(f Drrx  oo4tlxn ocilsfsDrm(vs;u)texnif totopDranvs () rxo(rpiydom emnvt t) 2tau  ou4tpx  icilsfs2umn pn(0alxoio3ta1lpDeaivs s0srxrio3ny1alee fcsat  rtr(mpnu0tlx mi3taslm2em(msnu0 eeriociotoatr i i s)trtoim3ou1omen fvs sf 2truront1tet ioctys m eauvpnt0 rerioctodfpD  uvi;s  2xoir nu1lptelies ( sDtmxmont0apx  fctld m2ul( p;t0tlermf3oydfaDeaivo t  rtrxo no1op  lieia(  rrrumpnt4tlt ioetldlm2rl( p u0aetomf3ia1lpD lnes;(0 exoxo iudll  lnvias) 2tr(m oo0olx mfciat m2ea( o;(4artoio iatlpt aueil(0seurxmpoydal e fvia( sDumuront1texn fetys aDeln s;u)aexnxo oo1fptrlivi ( t2uoio3nu1openlnetas)sDrrx  no4tleniiciad s2el(mp;u) renxfciydfpte neilt  2uo(m iy4lleelivs sf rtmump;o0oee  oetysfaDran p;t4tlxrif3oatlmD  nvi;() rxmxmpiodlmt mietas)sDumxrp;u1opto oeild s2umnvp;t)areomrciytom  au o ( s2xoxo3no4lle mnvtltfartm(mo;t1oleoifciad s2emn p u4 leoircty1lmt lnei t0srxrxo3oy4olenmnci s)srur( onu4openmietasfm elu p;t4aeeoir3oatoptr ivolt) eurxrpiu1amt lfvslt  2umumono4tlt mo3iatlmDran pnu) eenxfcoo1om rau sls trum(r oy1opt  nvsas arraur nu0apt miciltlaDrmu p;t4trtnxo ootomtr i o;s0 etoxm3iu1alte fes tfsDraxmo;t4alxoif3iltla rlu o (4arenxo3ootfmDe ivsl( sruo(rpoudomt  fct tfa2um(  nt0alt mf3tysfm2eaumo;(4 rxnxrcoatomDrlnvol() rurxr3ny4amte fet tfa2ur( pno1ale  feiat a uaumsn(0teenxoctodfa eln s;s s2xoirpoydaleeliesls)a2urxr ;o4aexo fctatlm um(ms (4alenxf3iy1oaD ai sls s2urxo oy1amt livs s)aDtmumpnt1oexo ieiltfa uan s t)aeerxr oodlpDeauvi;t) exoirpio4ale  ivi s a2urxm ou0apeomiciydfs rlnmonu4texrxo3todoatrli ols0 rtoim iu4lpeemnet () 2rm(r ou0optoiiciltlm2emnvpnt4tetrmr3oytopDeaneils0t2xrxo nydolee nvsa()sDraxmo;u0aptnii3iyt m2raums;()aeermocoatoat  iesls)sruoxm3ny4lm   fvtls arurur nu4aet ifciytla eln o u4alxnxo3tytlaDrlnvils)t2xo(r3iu1al nmnvtlt  Drau pno1tlto fciadfa uanmo;(4 rxnmr3oytfa  an i;s0t2xmio no4opee neilt  Dumx onu4tetomieild sDeau pnu4texrioctatfm rlivo;s s2trxr3oo1lm  lfcil( a2ta( pot0alen fctldfmDrl( o () reoifcty1lp ranvs;t0 2umxo3nu1ole mfeil( srurxm ;t1oee mi3iltlsDranvs (4aeenxf iadlmD  uvi;s truoxo3oo1am e fci t a2umur ou4tpx mi3tyslsDem(vo;t4aetoxo ootop eanei;s0 etrxr oy4olte fvtlt  Dtm(m ;t0tpx if3ils sDum(msn(4artrmocoatfp  au i;t) etm(r3no4lpt  netls) ruax  ou4olxnifetaslmDum(von(0aeeoxrcoadlmD aiei (0 exo(m oydamtnlfesls  rtax ooo0olxn i3iatls ra(msn()tlxomr3oadoaDe uvo s)srxrir ny1am elivsl(farrm(mo;o1tlto oetldlm2eanmp;u4arenmr3to1opteli o;t0 2xrxm3iy1lm n ies tfaDrauro;t1tpe  ociasfs eln snu0teeomo oatlaDrauvo s0trur(o oy1opeemies s  2ua(rpoo1openmociatla2ul( s (4 etnxfctytfa eau s;s srxrio3nydol elivilsfs2tmumpot4tpeoii3tyd a ua(vont)aexnxociatlaDeli o;() eurio3no1ome mncs s a2uaur ;u1oet ifetlsfs eaump;() rxrmf totlat auei s0 2toimpiu4amen fvs s)srrauront4tlxn feiasfm eluvpn()teeomo3oytfmte u ils)sruoxr3nu1aptemnctas arua(  ;u4alenmo3ildla rlumo u4 rermrciy1fpD  uvo;s0t2trxr io4omt liei t  2rmx p;o1aeeomfeiat m2umu p;u)aexnmr tatlm e ues;(  2xoxrpoo1amen fetat)sDrax pou4oeenioetyt a uln p t0tlxnmf iytomtr i s;s) 2tm(o ou4llenmnci tfa2ua( pnt4tpeo oeiad s um(vo;t)tlxoxf iydlaDeln i;t s2tr(opno4al elfci tf Draumooo0alx mfctat aDem(vo;u4tlxnmo3oatlaDelieilt0trum(r3iudlpte iet sfsDumx onu1tpen feiysfa ul(mp u)trtnxr iy1omD livo;t)teumxrpou4lltemnvt t  2rmurp;u0teenii3tasla2ranvpnu0 ltoir3iydfmD anvilt0srto(mpnu4ole  ncia()sDua(mp;u4tee  iciyd s2emnmo t4tetomo ty1om  li o;()t2tr(mpnodope  iesl(fa2rr(rp;o0tltomociat a2eauvp (0 ltrio tadlaD liesls) eumxmpnu4opt lncsls  rumx pou0oet  feiatla2umu ont4 rtnmr3to1fmt  ies;s)srxoirpnodapenlfvil(  rurx pnu1texoio3tas a2ulnms ()trxrircoo1fmDr n s;s)srtmio3oodop elnesltfsrumxmp;o0tetomiciatfs2ra(mont)aetrmr3iodfm eanei (0trtmxr3oodal elnct t)sDuaxr ;o1tpe mo3tlsfs2rmnmonu4 ltnmf3tatlmtelu i () exmxm3iudom nlnvi sf Drr(rp;o1oltn i3iydlmDeauvs u)tltoxrciodopt auvs s  rur(o iy1ap  lnvsa(fsDta(mpnu0tlto fcild s2ua(vs ()aleoio3ta1lpte n s t0teur(o3nu4al emnctat) 2umxrpno0opeomfciytls2emnvp;u)tleomo oo1opDrliesls) 2xmxr oy1ap  mfvs s a2urxrpnu0oeeoioctydlsDelumsnu)areoxfctodfmtrln o;s0trurim3nodap nlictasf 2tmu pot1tpt  oeiadlm2uluvp t4 ltrmo tatlpD  uesls s2xmim3oy1omtnmnviltfa2raump;o1tpx mi3iydfm umn o;(0altoxr3oy1lpD aivils)srxoir3oy4opeelies (farta(rpoo1altoii3iatfa rmuvonu)arerio totopt lnes t)s2xo(mpio4oleemfes tfs2rrx oou0texomoeias sDulu s u4texnmfcoo1faD anvi t s2tm(o nudom  liciltfaDuaxmpnt1tpt mf3tldfaDua(mp ()altrmr3totlmDeaieo t0trurxm3oodolee neilsfsrta(mooo0apeomoeiadlsDulump;(0alenmr3iytomt lieo;s  etmim no1lpenlivtatf Drr(rpou0oee iietatlmDumn s;() eerircio1fpDelnes () 2tmxm iydlpe mfcils a2ta(rp;t4ole mictytfaDeanms t4 renxfciy1fa  lnvi;s texrxrpiodlp  miet tf 2trx  ou1oeto i3iasfsDeanmsnt0 exnmr3oo1faDr neo;(0 etmxr iy1lleemiei (fsDtmurpnt1olxn fciasfm rauvp;u0alerxf3ootlaDr nvsls  2urxr no1ll  lncs s a2rmu oou1alt ifciydls2el(mp u)texrir3tytfp eaueolt t2xo(r3oy4omte nvt (  rua(mpoo1oeenmociltfs umnmon()alxomocoo1om  aies t  2uoiopoo1altn nviltfs2ta(mono0ape  feiad m2emn o;t0texoio iy1oaDr i o;()srxmxo nudlm e fci (f rtax ont4aexnmoctasfa2ul(msnt) ltnif ta1lateanes;s)sruoxm3nudoptelfvtas arrmur nt0aptn ieiys a2uluvp;()tlxomoctodlaDr n s (0 rxoxrpnodol e fei ( arurx onu1tpto oeildfm2rlu s (4aeeoircoatomt anvo t0t2uoxo ou1llenlnes t aDtr(m ;t0tlenioeilsls rln s;t4 ltnmr ootlatrlueo;s  eur(r3no4om nmfetasf Drrx pnt0tpxomoctys a rl(ms;()aleoif oatom   uvo (  2xrim3nu4omeemivs (  rtmxm no1alxomieiasfm umuvp;u0 ltnmo3iytlm elneolt sexr(m3ny1olt  fcsa(  2raumpou0tltomo3iytfm emums u0artrirciadfa elnvs s0setr(mpiu4apen icsls) 2rr(  ;u4tptnmietyslaDemn s;(0artnxr3tadfpDe u o s0s2tmimpiy1lmtnlieta( sDtr(m ;t4altoii3iadfa2rlnvo;u0 rtnxf oa1oaDr neils)seuoir iydap   ncsa( srum(mp;t4tltoioctadfmDum(vo u4alxomo oy1la   ues s)trtm(o iy1lm nmnetat) Dur(m nt1opxomoetytls2rl( p (0teeoiocootlate ivs;(0srxrxo iy1al e fesat)srra(  ot0olen f3iat s rmuvo (4tetrir3iytomDe ies;t0tetr(r3oudlleelnvt () rtaxrp;u1tpt ifctatfm uaumsnt0tlxnxf oadlpDran i s0 etmim3iu4ome lictlt) 2ururpou0oltoii3ilt sDua( s u) exoxrctodomDrlnvs s) exr(r3io1lme mnesat)arta(mp;t0opto ictltfmDrlu p t)tetrxocoa1opte ivo;(0trxoxopiu1lp  lnvil(  rra(m no4alxnmfciaslsDuan p () etrxrcoydfp r ues;t0setoxrpoy4ol  lfcsa(f 2tmurpnu4aeenmietydlmDem(vo u)aetnif3iatomD liei;t)setrxr3ou1lmt  nvt t a2rrx pou4oex io3tlt aDelnvp;(4 etrxr3iatfpDe ies;s s2tmim3iy1opeemnvsas)sDur(roou4aeenioetadla2emn o;t4 reoio oa1lmtrauvs (  rxrio oo1lmte nvi t)a2urumoot0tltoifetadls emnvo;(4aetoxo oytoa eln i ( teum(m3iu1ll n fcta( a2ua(mp;o1aeeomf3iadlm2uanvp () etnxfcta1fpD  i ols srxoxmpny4al emncs (  2rrxrpou4tpeniieild a elnvpnu4aeeoxr3tatlmteai ilt) eurim3iy1lltemfetlt) rtru oou0texnioetld s elnvp u)artrmrcoa1lm raneols0 exm(rpoo1al nmnvi (f 2rr(rpnu0opxnmfeils aDul(mo;(4tleoio3oo1latrlivil() rxr(m3no4lp elncilt)s2taxmonu4aetn fetydfaDrmn pnu4tlenmr oodfat aueslt0trtm(mpiudop  mietas)a2urum ou1apeo ieiysfs ran sn(4altrxr3oydfmtrlneilt0 rxo(o3oo1opeemivs s  2uaxmono0tee  iciatfaDulnmp (0aetomo tatlateau s ()s2umio3ou1oltemneiat srurx p;u0optoio3tld aDulnmo;t4treomfcoydopD luvi (0 2tmxr3nydome lfesls  Dum(m nu4aex mfeiat s2el(mp (0 exnmf iatlpDr neo ( tetoxr3nodol e net ()sDtr(m ot1alt  f3tatfa2ul( pnu0arxnifctodfmDr neslt)t2xr(rpny4lpenmfes t  rua(r oo1tlto ieiytlsDem(mo;()alxrmrcto1fpD anvo;s0sexr(rpiu4am elnes (f Dumu ont1alx  i3taslmDrmnvpnt)alxnmfctydlp eanvo t)srxoxo3ou4lm  lfcs t)arraxr nu1tpeomoetyslsDel( o;u0tlenxf3todop  ln s (  eumxr iu4lp nlies tfsDtrxr ;t0altnioeiyslm eau snu4aetoxfctydoa eli i t trumxrpno1olteliei s aDtaxm ;o4tlxoioeild m ulu snt0trxrio3to1fm   i sls0s2toxmpiy4amenmiciasfsDra(rpou0tlenii3iat m ranvs;(4aexnmr3io1omtr ivo;s tetmim oodlpt mnesas) 2tm(monu0teeo o3tld s ua(ms;(4 exoxf3io1fat  n ilt0 2trir iy1ap   fvi ( arurxm oo4oeenifcilt mDrm(mp;(4artrmr3io1fm rau slt s2toxm3no4op e iesa(fa2urx onu1aptoii3tydfa2ran o;u4trxrxr oo1oaDeln o;()s2xoxmpiy4lp  lictl(  rrmumono4oexoiociad m2um(mp;t)tlerxr3tatlpDraueil( truo(mpoy1omt  ncsas)s2urx pnt1olt  ietlsls ran on(0tlenifciydfmt  ivo;t) exr(r iy1lptnmivilsf 2tauro;t4aeenmfciltlaDea(vont4trtoxr3to1optrau o () 2trirpio1ap elivias) Drmurpnu1aptomfcilsfsDemuvp;t) exnio ia1lpDranvi;( t2toim3no1ame livi s sDtmxr ot4tptn ictadlm2rmnmp t4altrifctotfptrau s;s  2umxopoydom elfvslt srrm(  ;t0tpenifeiatlm rlu p;u) exnmf oy1omt anvslt)s2tmxm3oudamtnlnvsls) rrr(mo;o1tpxniieiasfa ean o;u) lxrif oodopDr ueilt)t2xrir ny4lm n net t) 2um( pno0oee if3tat sDem(vo u)altnir tytop  anvils0 etr(r3iy1openlnvsltfa2tau o;o1aptnmo3tlslm2ua(ms (4 rxrir iydopD  nei t seto(r ny1aptnmfvi s sDraumpot4apxo i3tasla2rmnms;t0tetrifcoo1om  lu s;s0t2xrxmpnydomtn icsat  2ra(monu4tpxnifeiadlaDul(mp;u0 rtnio3oo1lp   u o;t  2toxo ny1amt mfetas)a2ra( o;t1tptoifciyd a emn s u0arxrio ty1fa  aivs s0 etmxmpno1al  mnet ( sDuru  ;u4aexo feilsfa2el( o;t4aetnifciytlmtrlnes;s  exrxr oodom  lfcs t)aDtau  ou0tptoioeilt aDelumpnt4tltrxf tatoa  anvo s texm(mpnu1lpt  fcsltf Dtax o;t0apeomoetyd m ra(mo u4alxomrciy1oaDr uvs t) euo(o3oydal nlietlt a2taxmont4oet ioeiyslsDeau p u0 etrircty1opteau o;(0texrxopno4lm nlfvi sfsrta( ooo4oexomiciasls2rl( on(4areniocoatfmD au slt  eurio oy1ape  ncsas)arurxm nt1openif3ildfs um(vp;()altrmf3tydopDrlnvslt  exr(o iydop   fct s sDrr(rpno0opt ii3iytfmDuan o u)alenifcoytfmt  ueols)srtr(o3ny1ape mnvsltf 2rax pnt4aetomoeiatfmDel( snu0 etoif oodlmtr ues t teurxm oudomte ncsls) rrrurpot1tptomfciydfm2uan ont4arermo oadlmDraueo s  2xoir3iodameemictltfsrtr(m ;u0aet mf3iytlsDrau o;u0aexoxf3to1lm eln o;s) rtrxo ny1oltnlivils arrr(mpnu0aptoiociatla rl(ms (4 lermrctatfptrliesls0trur(m nudamenlnctls a2trur ;u1aee  ictyt a uaums;u0aleomo iy1fpDe ivslt)t2urir3iy4am nlfcsat a2tru oou4texomfeiat a2ra(mo t)teerxr3totlpD  nei ()srurxrpno1lpt mnvtls) Dur( pnt4aet micild a ea(mo t4tetnxf oytla rln i () rtoim3ny1al  mneslt a2rm( p;u0apt mocilslmDrauvo u0texnxf3tatfp rlu o;()s2xoxmpoodlme mivi s)arur(rp;o4aleomi3iysfmDrm(vs ()tetoxo to1fat aieo t)truo(m3iu1lmteliesat)srum(  nt4oee iiciysfaDum( p;u0 exrxf3ty1laDranvi s0 rurim ou1aptnmnet t  Dua(mp;t1altomi3ilsfa elnmo u)areniocoy1fate nei;s  2urxrpoo1lmenmfei s)srrmum ;o4tptoio3tlsfs2eau p (4 lerxr3iatlmDrluei (0seuo(rpoy1ap  lneta(fs2rr(m ;u1tlx mfctldfa rm(mp;() ltnxr3oydomDeauesl(0setr(m oodoptnmfet s) 2taxmoou1apx mi3iaslm uan p t0artrir oatlpD aieo;t)srxmir iu4lm   nctlsfsrumurp;o1apto fctadfmDea(vsn(0altrxrcoytoaDeanvs (0seuo(o ny1alee ieia( a2uau  ou1alx mictls mDemn s;t0 exrmf3todfa eli i;t0 etmxmpio4om nmfctl(f Drrur ou0olxo i3iasfa elu s;t4 rxrif iydfmDelnei;( t2um(m oy4ame  ictlt)aDtmu p;t0apt miciysfs emuvo;u)alenxr io1fpte u o s  eum(o oo4optelics tf 2urxrpnu0tpt  fetad mDrlnmp (0teenmo iytlp e uei;s  etm(r ou4lpeelfvi (f rurum nt1tpeo iciad a2umnvsnt0 exoifctydopD  nvo;s0setrxm oodlpt lnciat aDtaxr nt4oeeniociyslm2rm(vs t4alxrmr3iodlmDe ivi;() 2tm(r ny1aleelfvtl(  2umx onu1altnif3ilt aDul(vo;(0aeenioctytfp raivolt srxm(o iydlltemics t) Dtaxroou4tpto ietad a rm(mp;u)alermociydfaD  nvi ( trtrxm3oy1al nmietat)a2ur( o;t0aeenio3tat mDel(vsnt4trtoxocootlm  anei s0s2ur(opiy4llte fvtlt sDtmx pnu0opxnmf3iatlm2ra(ms;(4 rtoio3oa1omtrlneolt sexo(o3oydol  lictls  Dtaxmp;o4oee ioeiat a2rmums t)teeoxrciy1fpteln i;t srumxm nodlpte net s artaur ou0oexnmi3iydfm eln o (4arxnircia1oatelu il()tetoxo3nudalt mnei s)a2ua(root1tpto f3tasfmDem(vs u0tlenmocoodfptrlu ils)t2to(r nu4amteliei s)sDumx pnt1apxomieiyt m2rmu o (4 ltnmociadfmtrlu s;s)seurxo io4opt lict sfarrmx o;u0alx mictat sDrmuvp;(0 reoifcoo1lpDelu i;()seuo(m3ny4lpt  fvslsfaDraurpnt1aexoiicilt s2umn pnu) etoif3tydlateaiei s0 rxrxmpio1lp emnvi ()sDua(moou1opeoioeiatfaDum(mon(4arermo3iy1om   uvi;t0t2xoir3oudlpee ncs s a2rmur nt4tlenifeiltfm2rmn s () exnio iotlate n ol( s2xmir3ny1lmte ietl(f 2umxr no0apxomi3ilsls2elump t0 rxnxf oodomteai s s  eto(rpou4ame mnctlt)sDrrumpno0opt  ieias m rmums () rtoxo oatfpDrlivs;(0 2trim3iodlptelfvi t)srtmxmo;o4tpx io3ilsfa uluvs (4tlenio3oodlm r nvs s t2xrio3oy1ap nmfvtls)srtaumono0oetn icilslmDulu pnt0aexnmocootoaDeaiei t tetmio ny4lmt mnctls  2rmu  ou0olxn icilsfsDumn s;t4tlxnxf3oydoaDeaieilt tetrim3oy4olt mfci tfaruru ooo4ope mfeild a rln s;u4texnxf3io1lmt  uvo ()teuo(m no1am nlivslt)sDtaxrpno1tlt mi3ilsfa2rlu s;t0 eenmo ty1oatrlu s ( sexm(r io4ll elict s) 2tmxrpnt0optoiiciadfs ul(mont0tlxnif3totfa r ies;( t2xmxr3oo1op nlfei s)a2rru p;o4oex mieiydfaDuanmsnu4 leniociy1omDrliei s) eurir3iudoptnmnvs tf 2tmuroou0altomociad s2uanvs;u4 exrmo3to1latrln o;t0t2uo(o nu4amtnmies tfsDtrumo;t1tptoioeildfm elu ont) lxnmr oa1omDr ivo;t0s2urxo iy1apeelfet t sDtru  ou4tpxomf3ildlaDranmo;u4 rtnxf3iy1lpDrau s ( setrxrpoo4olee iesatfaDrax o;t4ole  f3iysfs2rauvo;t)teenmfctatfat lnvi () 2xr(mpiu1ome  ici (farta(  ;t4tptnmi3iatfs2rlumsnu) etoxoctytfmDe i i;s  etm(m3nodap elicslt a2uaumooo4tleomfciadfs2um(mo;(0trxnifctotfmte u sl() etrxmpiodole mncsat)s2rrx oot1oeenioeiasfm eauvs t0texomrcoodoaDelues;s0 2triopnudalt lici t) rtrxrpou0aeto octydfs rmn p u)arxnxf oy1omteauvo ( texo(o iudalee iei s) rurxrpnu0tex mf3iad sDranvo;t)tltrxrcoy1fpDelnesl(  2tm(r3oy4amtemivsas)sDumxrp;o4texomf3iyslsDulnvp () exoifcta1fm elueils  rumxrpnudome  nvtl()s2uax  oo1oltnmfciasls em(mp t) etnmo3oatoaDrlieol( texo(r3iu4optemfct s)s2rm(monu4aexnmfciasfs2el(mo;u0tltoxrciydfm raneo t)s2toxopno4amtnmicsatfarrmxmoou0aex mf3tltlmDuanvsnu0alxrif3tadlptran ils)s2tmxr3oo4op nlfet t)a2ta(mpnu1opx mociatfs um(mpnu0 rxnif iadop raieo;s)s2urxo3nudaltnlnctls srtau pot1opx  o3ias s ea(von(0trtnifctatlmD  nvo s0srtrir3iy4open fcslsf 2uaumonu1aexn oeilt m2elnvpnt0tlxomociadlpt  ivs s) rxoiopno1ome mies s) 2rrurp;u1oltoio3iysfmDua( s;t0teeoxoctatopDrlieols trur(r3ny1lltnlfvt t  Dtax o;t1tet if3iat s2rauvo;u0 rtnxfctatopt  i i ()trumio3no4ap elnvils) rrmu p;t0oetomfeils m2uaump u0tltrif3iytoaDrli ols) 2xrio3oodam nlnvtl( srua(mp;u1ole  f3tatfm uau p;t)arxomr tydlp   ies t t2tmimpoy4al e nesl(  rrau o;o1oleomf3tldla2um(ms (4aleoxf iy1om   ivs;s0srto(o3oo4olte nvilt aDtaumpoo0apxniieiysls ulumpnt4texnmr3tytfm eauvs t) exo(o3iydomen fcil() 2trurpnu4oexnmfciadlmDul(mp;t4treoio3iotlaDe i s ()s2xm(o3iu4ol n ieiasfaDtm(r nu1oltn f3iltlm2rlnvp;(4alxnifctodla elnei s0 euoim ou1alte fvias  rtr(rpno0aexo octydfs eanvs t) rxrxr todfa r neo (0 etoxo iudamenmivtatfs2trx o;o4oex mietysfaDem(vo;(0tlxnmf3ty1lmte uei s0t2toxmpio4ap  livsa(f 2rrx  ;o0aexo f3tytfa2eaumsnt0tlxnxfcoadfptrlivo;s  rxmir3nodlltnmnvsls)aDrmumpot1opxo octysfa2emums u) lxrxr3tytlmDe uvolt)tetm(o iudop   ieslt  Dtm(m ou1tpe  o3iyt a emump t0 exnxoctytfm
\ No newline at end of file
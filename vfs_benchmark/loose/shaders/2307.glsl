@@ -0,0 +1 @@
+i i;()truoxrpio4aptnlfcsls srtmx  oo4aetn i3tatls2rlnmo ()trxoifciadoptrluvslt0s2trio no1op nmncs s) Duau  ;t0alen icilt m ean p;t) etrir iydla elu sl() etrirpiy1lm nlnetl()s2rmx p;o1tpx if3iyslmDrau p;u)tltrxr to1fmDr u i (  2xrxo oodopen neia(fsrtr(mpou4apeo ietad s2rauvp t)trenxr tytfmDelieolt srtm(o3oo4lpee iesa()srtr( oou4tlx  f3tydfmDumn s t0 reomoctotlm ranvs;(0 exmxo3oy4alt lfcsa() Dtr(moot0aet ioctat aDraumsn(4tlxnif ty1omtrlivs s0sexm(r io4aptnlfcta(  Draur nu1tptomoetydfm2ul( pnu) exoxf ootom e iei s)sexr(o3iudap n nesat) rrmuro;t1apt io3tadfm2eanvsnt4 eeomo tydoatrlu il()setoxm3iy1optnmfes ()srta( p;u1tetnmo3iadfsDem( p u)trtrxociy1fp e ies (  2tmxrpiudome micsas) Drax  ;o4opxomo3ildfm ua( p;t0arerir iatfp   i i t  ruo(mpnudolt mfcia( s2tmurp;o4aet  ieiaslm2ra( sn(4arxomociatopt an o t setm(o iudaleelfctat  2ua( oot0tpeoio3iatla2emnvs;(4 lenio oa1lmteau s t0t2um(rpny1omte nvsltf 2urumpou1olxnifciytfaDem( snu4tltrxo totoa   i olt0t2xrxo3nodole mivslt)srtmum ;u4tpt mietatfsDrau o;(4 renmo io1lmte ivi s)s2toxrpoudlmenlfvilt aDtmxrpou0altoiictyslm uluvs t0trxomo3tadoa e i ilt)trxoxm3oudam nlfeias) ruau onu4apxniictasfa ulnms;u4trxomfcta1lp eaiesl( seum(m iu1apt lncsl( artr(m ;o0tlxnmfctadfa umn snu0artomf ty1op r uvsls  exoxm3iy1al nlivilt) ruru p;o0tex mf3ilsfm umnms ()tetomf3oy1oatrluvo;t0truo(r iy4altemfvt (f rurxm ;u1aeeo i3iaslaDelums;u) reoxr iotoa  li i;t0seuriopny1lmte neslt a2trxm ;u4ale mieiltfs2emu s;u4tltomrcoydlaD luvi;t  2xo(o3nu1lm e nesasfarrru p;t4tetoii3ild m2rluvo;u4tetoir iadopD  i i;(0srtm(m nydam emfvt s)sDuru oou4alxoiociadla el(mpnu) ltrxf3ta1fa  auvi;t)teuo(rpnu4lltemieils) 2rr(mp;u0oltniociytfaDum(ms t) rtoir3oytla eaueil()s2xm(r3iudame  fet ( srururo;u4alxniieildlm2umumsn(0aeenmf oy1oa  luvil()sexo(rpoy1op  mieia(  rumxrpnu0ole iicilsls2rm( o;u)texnmr to1laDeln i ( seto(o oydome micta() Drrum ou0tlx  o3iltfs2el(vp t4 exrxf io1omt au s ( seto(r3nu4aptnlivtasfsrrrx p;u1teenioetys a2ean snt)trermrcoytlptrli i;t0trxo(m3oudap nlfvi (farum( oot4olxniietltlsDrluvo;()tltrif iydopDe ieols0t2xmxmpiy1ap nmnvilt  Drrumonu4olt  fetls a ea(monu4 lenxr io1oa eaueols) euoxmpoy1lm  mfct t  Durxmoot0oleo octytlsDranms t0teeoxr iytlatrli slt) 2trim3ou1ll   nvtl(  2tr(  nt0olx ioctyt a2ulnvpnt0altnxf oatomt auvs s) exoxm no4optnliesl( s2tmumpno0tet  o3iadfs2ua(vo;()artrxfctydlmtelivi () 2tmxr3no4omt  ivt () rtaumonu4tpx io3tltlsDeau on(4treomf3to1omteai s s0 2uoiopno4omtnlfeil(fsrrmxr ot0aee  oetysla2elnmp;(4aetnxo3ia1la rlivo;(  exr(o nu1ameelfctlsfaDrrxm nu1tpeoioctld s2ulnvs;t4trtoxo iydfaDrau o ( seuo(r3ny4ll e ivilt)sDrru ooo4tptnmf3iydfa2raumonu0aeeoxr3iatopDeanei s) 2tmxr3no4optn nctas) Dtr(rp;u4apeomf3tltlaDuaums t4 eenirctodfpteauvo;(0 rum(m3ny1ap n iei t sDraur ;o1oleoio3iat s2rm(vp;u0trxnmociytop e nvols tetoxm nudapeelivta(fs2tau o;t4aetomf3tlt m2emnvsn()tetnif ootoaDe nvs (  rtrir3no4am elnei (faDtm(rpot4tpxnmociasfs elumo;t)trtrif to1omt ai i s)srtmimpiy1ap  lneilt)srua( o;t4opxomoctatfaDuan s t)aetnxf3todlaDe uvi (0srtm(o3nudalt  nvi (f Dtm( p;t0oex  feils s ranvs t)aetrxr iodfpt ai o;s t2triopno4omen fvt t)sDumu  ot0oetoiocilslm2elu on(4arenmo ootomDe nvo s  ruo(r oo1altnmfvtltfsDta(r no0apt moetlsfa2ra( p ()aexomf3iydla   uvs;t trxmxrpio4am   ictatfa2urx  ;t1aeeoifeiaslm2elnms;(4teeoif iy1lm  ln s;( s2tr(mpoo4lp n netatf 2taum ;o4tet  fcilt mDeluvp;t4aetrir oodlateanes ()tetoxm3oodll elnvtls  Duru p;o4oeeo oetyt mDulu o;u)altrmf tatop r i olt) etmir3nodaptnlivi sfaDumxmooo4ape  ieiydlm2rlnmont) lerif ty1lm rluei;(0srtrxopoudolt  feilt) Duau pot1tle mo3ildla umu s t0aexoif3tytlm e neolt  2toxopoodllte ncils)s2raumonu4alx mfciydlmDrauvsnu4 eeoxr iotop ranes ( seurim iudal nlicta()srraxr nu4tlxomictatfa2ulumsnt0artnif iy1om r neil( s2tmxm3oudaptemietasf Dur(m nt1opx  o3iyd m2uauvs t0tlerxfcoa1lmt an o t  2xrirpiudole mies ( srurx  no0tpenmfctlt s rm( ont)tetrmo3io1fp e uvsl( tetrim3nodalee nvilsf rrr(mo;t4alxnmo3iaslm2um(vpnt4 renxf3ia1lm  li i;t0s2uoir iu4lp nmies t)aDua(rp;t4tpt ifeildlaDuau pnt4areoxr3tadla  au s;(0 2um(r oo1lmt mnci () 2rrur oo0aee ifctadfaDua( p u4teeomf oadfptr n ols0trtmxopny1ome lnvilt)aDrax  ;o0aetomieiltlmDuauvs () lxnxr iydfaDeli il() euo(opiudlpenlfctlt s2umxr ot1tlxomieildla2ea( sn(0 exoif3totopDran i;s0truoxo io4al  lneslt)a2ra( p;u4tex io3iasfsDra(mp;t0 rtniocto1fatraieo (0truoirpio1lme lnctat s2ra(moou4oltnmo3iltfs2ua(mont0tlenirctotop e ieo s)t2toir3nudlp nlict sfaDraxr ;o1tlt moctltls rl(vsnt)aeenif3oo1op  aneols0texrxmpoydoltn nct s)aDtauroot1tltn o3iadlmDra(vsn()texnmf oa1fpDr ivi;( t2tmxmpoydame  ncs t) 2taxmpnu1ole ioctld a2ul(ms;u4 ltoif3oatfat ai s;(  eum(m io1op nlnvi s srrm(m ou4tlxn f3iltfa rlnvo;(0 ltoxocty1lmD aues t  rtoxm io4amenmici (farrrxmpnu1opxomo3ilslmDua(vp;t0treomf oa1lmDrlnes t t2tm(opny4ll emivils)srtax p;o1aeeomietytfaDul(vont)tlxrif tadop rlnvol(0sruo(m no4ap elivilsf Dur(r ou0texn f3iyd m emu s t0tlxomf3ta1oa  lues;s) 2tmxr3ou1ap nmfeta() Drax  nu0teeo fctadlsDumnvo u) exrxoctatlat  nvo;t) rumxr3oy1llen fvtls) 2uaump;o4texn o3iatls2ranmp t)altnio3tytoat ln ols) 2xrir3oudlm  mici tfarrau p;u0apxoiieiadfsDem(monu0trtnxrciatop elnvs ()s2xo(mpiydal e fvsa(faDta(mo;u4alx mi3iad mDrmu ont0 exomr oa1optr ies s0teto(mpio1am e feslsf Dtr(mp;t0oltnmi3iyd aDrauvpnu4 lxrio tadoaD lneil( srxmxr nodlptelfcsasfsrrr(m oo4alxnmfetlsfm2elnvo (0tltoif3oo1omDe i i s0 rtr(mpoodlmte nvslt) rtr(mpoo1tpe  f3iltfs ra(mpnt4aetrir3tytla r i ilt0 2to(m oydolenmfct ( sDtrumono1altomfetytlsDrmnvsnu0aeenxr oodlatrlnvsl(0 2ur(mpiu4opeemfcsltf Duaum ot0tltoiicilsfa2uau s;()arenxfcoatom ranvil() etrxrpnodal   ncils) 2uaxrpoo1texomfetyt aDum( sn(0 etrxocoa1fpD aieol()setr(o3nu1al emfvta(fsrta( o;u1alxnifciadla ea(vsn(4altnxf oatfp elu i t) rtrir iu1lmtnmncsl( aDtrxmoou1tpe  ociytfm rauvs t4tlenif3oydfmDelues s0sruoxm nydoptemncias s2rmx pnt4olxn octadfs rlu snt)areoxr iodlpDrln o s0 euo(r3no4ll e ivsls  Duru pnu4ope iicils m ra(von() rxomocoo1op  lnvo t s2toir3ou1om nlneilt  rur( pnu0alt  fctasfs em(mp (0alxoxfctadom e ivi ()setrio no1ll   nvsa()s2rmxrp;t1opxoiiciad s2emnvsn()tlxnmo3oatlaDelivs s  2toir io4am elfcs tfa2rmur oo1aeenmi3tat sDrl( s;(0teenmo iytomDe u sl() rxrxr iu4om n ncsl()sDtm(ront4oeto i3iasfa emn p;t0texrif oy1fmDeli s;s)sexoxm oo4ome mnvias a2ur(mpno4alen f3iyslaDra(vs u)aexrxf3oo1omte ivs t teurxr io1alen fci ( sDrruroou4oetn i3iltfmDrluvo u) eenmr3iodfatrauvolt0sruoiopnudlptnlfct (fa2rrumo;t4tptnmf3tlt aDrmnmsnu) etnmo tadfp  ai sl() etoxrpnu1amenmnes s arua( o;t4altnmi3iadla ea(mo;u0aeeomr3ta1lmteau s;t seum(m no4opt lfvia(  2umu o;t4oet mi3iasfa umnvonu4texnir iatoa eluvs s  rxrio io4al n nctls) Dua( pnu4tle mfctytls2emnvp;u4teerif todlat ln o;(0t2xoxo iu4al   nei ( aDtm(moot0olxn i3tltlaDrl(mp ()tlxomf3tadlpD lu s ()srumxr3oodale miesls  Draxmp;t0aetnioctlsla ulnvon()aeenxo3iadfpt li s (0 2trxrpiodop n ieiltf 2umx o;t1apeoif3iltlm2elu snt4teenmfctotoa rauvolt truoxo3iy4lleemfcsat) rtrum no4tetn feiyd sDumump (4 exoxo ta1fpD  n i;(0 etoio ou4omt mictas) Duau ono4aeenmi3ilslmDemu o t4alxoxo iytomtranvo s  2xmimpoy4al n nvi s arrr(mp;o0aeeoiiciys s rmnvs;u0tetnir oodfatr i i;t s2xmio iydllt  netas)aDururpou0aex mo3iydlsDelums;t4aetrmo3ta1omDe uvils)srtriopny1aptemieilsf 2uaurono1alxo ieiltlaDelu snu)alxoir iodomteau o s0 etr(m oydopenmivi t aDtmx p;u0aleoiieiysls uauvpn(4 lerxf3totlatr iesls0 exmxopio1ope mnvils s2rru ooo4tleoiieiytlsDeluvp;t)tetnmf3iadfpteaieo t0tetoxo ou1om   ieslt  Dtmu o;o0oee  f3tyt m uan pnu4 rxnxf3todop r u o ( sexrio3nydlm nlncsasf 2tmxrpou4olen f3iasfm ua(mont)trtrircoatopDraiei s0tetrxrpiy4ll  lici (fs2uau ooo4tetnif3iatlsDuauvs;u4altoxo3oytlatranvs;s t2xmir iodlptnlivilt a2umx  ou0aexoiieiytfsDrmuvs;u4alxrifcootfaDeauvo t)teuo(rpiu4lmeelfcil(fa2tru  oo0apx moetlsfm2rl(vsnu4aetnxrcoydoatr nesl()srxoio3io4op emnvia()a2ra( p;t0tet moetydla rmuvpn(4arermfcoy1fpt au s s0seuoir3no4omen ieil(fs2rauro;o1teen f3ilslm raumo;u0trxrio io1op eli s;s) 2umim3nydlle  fciasfs2umu oot0teto i3tadlsDuanvo u)tetnxrcoadfm rau ol( truo(m3iu4lmtemnvt s aDraum ;o0oexoioeiatlm2elnvsnt)aeeoxr3iotfpDe nei;s0trtmxmpoo4op nlnvtl(f 2uaxm no0olxnmoctaslm ua(mp t)tltrxr3tadlat  ivsl( s2xo(opiodlmtn fvsa(f 2ra(rpno4texomieiytfm rmnmp;t) exnmf oadlptelies;t) rto(r
\ No newline at end of file
@@ -0,0 +1 @@
+neils) rurirpiy4ape  ncsls)aDtaxrooo0tpx  i3iad m uauvs;() etnmo3to1lp r n o s s2to(opiudalen icils  rum(ronu4tpt io3iadlm emnmp t0tlxnxo3ta1laDeau o t) euoim iu4alee ivsa(  2rmx oot0altomictyt s2ranmo t4trenmo3oodomtrlies;t)texmxo iu1lp nmnes tf rurxroou4ope io3tat a ua(ms u4 reoxrciy1fm ranvs;s  eumim3nydapenlicsls aDuaum ;o0tptoif3iaslaDrmnmo t4teeoxr3iadfp  lu o (0teur(mpnu1olenmnet t) rumumo;t1aleomieiytfa rm( o;(0 rxrifcoy1lptr nvils  exrxm oy4om n ncsa( sDra(ront4aptnioeiatls2emumo;t0tlxrif oadop e ues;()sexrirpoo1ol nlfvia(farrrxmp;t0aex mo3iyd aDua( sn(4alxrxo oadfaDeauvsl(0t2xrir ny4lmtnlnet t)sDtaxmo;t0ale  ociltfm2ranvsnu0 lxomo iy1oaD  u i s srumio ou4ol e ivs s)aDua(mp;t4teto o3ildlsDemu p (4trenmfcia1op  livo;s0teuoirpiodamenmictls) rtaxmpou0ope io3tadlm emu o (4tlxrio3totfaDe ivo (0texrxr3ny4lmtnmnvi s)aDum(mooo1texoifcilt m2ra(vs;t) etrxo3oo1omD lnvs;s) ruo(r3oy1omtnlici (f Draxmp;o0tetoif3iytla rmump t4 exrxo tadom e nvil( t2xmim oy1aptemics ( arrrx p;o4opt iicilslmDel( sn(0alenio io1om  ai slt0 2xoxopnudapt lncilsfsDta(moou4oexn fctad m2emump t0tetrmo3io1fpDelivs;() rurxo oodlpenmictatfs2tmxmpot4aee moeilsfs uanvp (0aeeomrciodlpt luvilt srum(o iodale  ncsls s2raum ;u1aetoiieildfa2emumonu)tetrmf iodfmtelivolt) exm(o3iydlp  mivi t)sruaxr nu1tpt moctltls2umnmp ()alxoxfctydopte ivo () 2toio iodll nlfet ( aDrau poo4aeto octltlaDelnmp u4alermo3oo1fmt  uvi;t setmxr3iodopen nvtl( s2rr(rp;t0teeo icildlaDul(vs;t)tlxoxf3oy1opDeai il()srtmiopnu4omenmiviasf 2uau o;u4apxomo3ilsfm uluvo;t4texnmo3to1fp elivi t)setoxr3no1ll  mfei t a2ur(ront1opeoiiciyd mDrmu snu)alenmf iodfp  anei;s)s2xmir3ou1ale lietlt) Drru  nu0tpto icildla2elnvont)aeeoxocoytoa e u s;s0t2toio3oudlmeelfetls) Dumu o;u4olxoifeildlaDuanvpnu4tlxrmf oatlpt livo;t)seuo(opnydomen nci (fa2tm( poo1alenmfeiltfa eluvp t4aeeomocio1oat ai s t0srum(m nydaltemneils) 2rmurpnu4tlxniiciyt a em( p t) lxrmf3io1opt li o;( setrir3ou1amt  icslt  Dtrx  ;u1oeeomieiydfa rauvs;()alenifcoytfpteluvs;s srumxm3iu1ome lietl( sDrruronu0teeo o3iatfm2um( s u)aeeomfcoatfptrluvi;s0 2tm(o nydlpenlicils)arumx  nt4olt mieiydfs ulu o u) eerifcia1fm   ues t texo(m io4ap emfct s srrmu p;t4aleoiociyd s2um(mo u0alenio3to1lptelueo t0 ruoir iodomtemivta()s2uaurpot1texomictlsfm2uanmsn(4 lxoifctodlat  uvo;( trto(mpno1lptn ncsasfsDrmum oo1openioetydlmDra( o;u0aetrxf iodlpDraieols  eur(r oy1ll n feta() rua(m ;t0ale  f3iys a rm( sn(0alxnif iotla rlivs s seum(o3io4al nlnctl(f rtr(r ot4apen ieiasfa emuvp;t0aetnio3ty1om rai ils0trtoir3nodal nlncias arumx  nu4teeo icias mDrmuvon(0 renxf3iydlpt  neolt0 2uoxm3oy4ole  nct sfsrur(  ;o0aeto oetydfmDumn o;t0alxoxr3oytoaDr i s s) exoir oy4op n nvsa( s2tr(  nt4aeeo fciadla2rmn s t4 exrxf iy1laDeliei t0s2xo(o ou1lptemicslt)s2rm(mo;u1tltoiociat sDeln onu0trtnio ootlptrauvi t0 eumxmpoo4lpenmicsl() rtax  oo4teeomoetltls ea(vs u) rtrmoctydfpt anes;()trtm(mpiydlm emnvtlsfa2trxr nt0opt  ictlsfa eaumsn()trxomrciotlat  i sl( trurio no4alte nvslt)a2rr(r nu0oeenioctadfsDemnvp u0tlxnio3iatlpD  neo;t0srxoxopoodal nlfvtls arrmx oou0aexomfctatlm2rmnmp u4 exomoctatom  lnvo;s)s2xrxo3iudlltn ivilsfa2rau pno4tlxn octldfaDraump;t) rtoxo3ia1om e i s t) rtmir3oodlp   fcsa() 2tr(mo;u1oeeo i3tltfs rmums t0texnmf3iadlpD auvi s0trum(r3no1omt mfvtl( artmu  ot1tetomicild m2em(vp (4aetnmf tytlpD livolt0 rtr(o3oudapt  ivilt arurxmooo0apx  i3iytfa2rm( pn(0 ltoxf tadfpDr uvi (0seum(mpny1lme livtatf 2urumpou4aeeoifetad m eauvpnu0alxoif3iadopDrlu i (0 2urimpoydam e fvia() 2umx oou4ole moctltfm2rm( s (0tltnif3tydfate uvs;( s2umxo3oo4ame mfvtlt) 2tm(  ;t1ale  ictld m emu onu0 rtnio3io1lmte nvi s0 2xrxo iy1ol emnvias) rta(ro;t4apenmo3tlt a ran snt) ltomf3io1fpt auesls0srxoim oydapenlfei s)arur(  oo1ope mocildlm2uauvs () ltnxo3io1omDraivi;t trxrim oo1omtemieslt aDtm(r oo4texnifctad m rm(vpnu0arxrxr oadom eauesl()setmxo nudopee fvtas)srua(rp;t4oetnioetytfaDrl( s u0trerxr iodomtranvi;( tetmxo iu1apenmnctltfa2rrx p;t0oeto fctatfm2eanvo;t4tlxrmfcoytom   i sl()srtmxm oudlltn fetatfsDum( oot4apx  ieiyslm2ra( o;(0 leomr totfatrlnvo;s0s2um(mpny1apeemncsa()s2uaurp;o0optomietadlaDum( o;t0tltnir tydfaD  u i ( trto(opiy4ll  lnvia(f rrrum ;o0tptomo3ias a uanvs;t4tltnxr3oadlptraneo;()trurir iydll   fvsatf ruru ono4apx  iciasfa elums (4arxrmo3oodlmte uvs;t srum(r oudom  liesl(fsDtr(r no1oeto f3iysls2eln o t0 rtnmfcta1oa rauesl(  rtmio3iu4ale micsls)a2trxmoou4aeeomf3tld m rl( o;(0 etnir3todlpD lnvi;s)seumxm3io1op   fct (fs2ur(r ot1aetomiciydlm em(vo u0 eeriocoy1omt  n o;s) rxo(o iu1ale  ici t  rrau onu0texn octltfmDuanvo u)trxrir3iodoa  livolt trurio no4lmt  ivtl(faDtrxrp;o0oeto o3ilsfaDrm(vp t) lxrxf oydopDrau o;s)trxrxm io4ap nlivi ( sDumu p;u0texomi3tasls rmnvo;()alermo to1fm ranei s0 2to(opoudapenlfvtat aDta(  ;t4altnmoeiyslm2uanvp t4 etoxo3oodlaD  ivs;(  etoirpno1lmtelivi t)a2tr(mpou1opeo oeiad a2elnvs t4trermf iatfmtraueo;()srum(mpiodam  livsat arum(m ;u4aleo feias sDel(vo t0aetnif iadlpt anvi s)s2umio iydlmtn fvias aDum(mp;u1tle  i3tldfs rau sn(0 etnxf to1lpDrln ol( setrir3ny1ape lneil( aDurumpou4oee  oeiydls uaumsnu0 lermo3ty1oat lu o (0teur(r3oo4lm nlnciat artru pnu1tpenifeiltls ea(vs;u) exrif3oytomDe ueol(  rurxm iodol n fct (f rua(r ;o0tptomieild m2emnms;(0texrmo to1fmt ln s s)t2trimpio1lpt mncilt a2tm( onu4opeo feiatfaDeln onu4texnif ia1fatrlivi;t0teur(o iy1op  livtat)s2tmx pot1tlto fcils a rm(vo;()altoxf3oadlpDe nes (  etrxo3iu1am e icilsfa2um(root1aee  fctlsls ea(vpnu4 exrxrcoytoa rlneo;t)teuoxrpiy4optelivi (fsDuaxrpno4opt mictydlm2rau sn(0 reoir3oa1op e nvs ()seuo(o oo4openlfcsatf Drr(  ou0openmoeiytlm2ua(vp u) ltniocta1fpDr nes;()sexo(r oo4lpe mncil(farur(r nt1tpxniociyd s2em(mo (4 eerxr3iadfmte nes t  rxmxm3nodll emfesls s2ururo;t1opeomoeildlmDeanms;u4 rxnmoctatlmDrlivs s)tetrxm nu4ope  ics ( s2rrurp;u0tlt  ociatls2um( ont) exomoctydfatr neo s s2xoiopiydopen net () Dtax pnt1oeeoif3iatfmDrmumon(4 ltomr3iatoatrluvils s2xrim3oodap emfctas)a2rrxrono4aee ii3tld m uln ont)arxomrcio1lm ran i s)sexmim iu4olee nvsls)s2tr(mo;t0alenmictydlsDemu s;t4tlxrif oy1la eauvolt  2um(mpoodamtemnesa() 2um(mp;u0tpxniieilslsDua(vs;u0tltoio ta1lptelivi s sexm(m3oodolte netat) rum(  ot4alxnmo3tysfs2uau p u)artnif iytfa   nvils trtmxmpio1oleemivil(fs2tr(  ;u4tex iicias m emumo (0artrir oydomtrlnei t)trxr(o iudlmt  net sfa2tr(mo;o1opxo ociadfmDemump u4treoxo3io1omDeanvs;(0t2uoxm3no1lptemivsa(fs2uru  nt4ope mfeiys m ua( on(0treoxo oytfm  livsl( sruoxopoo4amt  ietat  2rm(  ;t1ope mi3iyslaDeln o;u4arxnmociytom  anvsls)t2urir iu4om   ies t sDumu  no4olx mf3iasfs2rauvont4 eeomr3tytfmtr ivi (  rxoxr oodam e ics s  ruau  oo1tpx iicils mDrmumo;u) rerxr ootomte ueilt0t2xo(m iu4optelfci sf 2umur ;t0apxoiiciydfsDeanvs u)trxoxo iatfmDr uvslt  rtoir nodoptnmivt (fa2tau ooo0tpt mfetlsla2uauvsnt)tlenxf oy1latr iei;s)teuoim3io4amenlnvsa(f ruaxm ou4tptoii3tatla2ea(mpnu0aeeoxf todomD auesl(0srtmxo3ou1alt lietls)srrrxmpoo0tpeomi3iydfmDeanmpn(0trtoxf oa1fp eaueolt0t2to(opiydom   fesl( srurxmo;o0aee mfeildfsDem(vo;u) etnmrciodlatranvilt) rxrir iy1ome  ivslt)arta(r ot0olx ifciltfm ea( p t)texomr ia1lmDrlu sls)s2xm(opou1ale mnvs s aDrrxr no0tpxniociadfsDumuvpnt4 ltnxr3oodomDr uvslt  rtrio iudlpee fet sfsrtru  oo4ale  iciadla2rm(mp t0aexoxf to1latean sl() rumir3oydlptnmnet t) Duaxmonu4aexo ietlsls emn o;(0trxrxr3tadfa rluvi;t0sruoir3oodlp emnesltfa2taxrp;u4tpen i3iytls2ulu p;()altrmrctodlptr ivils) euriopoudope lncs t srta( pnt0tlx  ictlsls ea( s u)tltrir3oadlmDr ueo;(0 exo(o nudameelncias srumxroou0open oetydlaDrln o;t0 eenir3iy1om e i ol(  rtr(opiodll  mietlsfsrrr(rpno4olxnioetlslsDrmn s (0 leoxocty1opteln o t)t2toio3oy1ole livils  Dtm( onu0tpx ifciltlm ulu p;(4alenxrciy1faDrlies ( s2xoio ou1lp elncta(f rrmxm ;u0olxoioctad aDea( pnt0 renxo3tytfpt  u o ()seurim3nu1lm elfvslt  Dur(r ;u1alxnioeiatfs rm( p;(4treomrcoodlaDe i ilt t2xm(r nudlptnmfvta( s2rmu  ot1oetn fctltfmDum(vo;u0 rtnmr totfm e u il(0s2ur(r3nu4al  lnei sfs2umurpno1oeen fetldla2umn pnu0aeenmo3oatlp rauvolt0 2toio oudlle lfvilt aDta(m oo1oleomo3ils m2em( p;u0 exomo3oatlaDran s t0trxrir3nu1amenmfctasfa2ta(mono4aet  o3tadfs2rmnmo u0 eeoif oodlm   ivi () 2trio iu4llen nvtat)s2urx  nt0oetnifciyslsDrl( s (0 lermocty1fm  lneo (  etrio3iodolenmnct (fsDtrumooo0tet iieiatlm el( s;()trxnmociodlmtran s t  rxr(opny1ap  micta(fsDuru onu0opt ii3tlt a2uanmon(0tlenxr tydlaD ln i;t)s2trxr iy4ap nlivsl()aDrmumonu0olt  ieiasfsDuan snu4tetrxrctadoateanvi;(0trtrirpio1lmenmfcsat aDum(r oo0oet  i3tatls2umumo t4artrxr iodlmDeli o (0s2toir3iy1olt  ict t)sDua(  ;o1aee  iciasfaDuaums t) reoxo oadla  lu i;s0 2ur(r oo4altelnvs (f 2uaxmpnt4tptnii3ilslmDrlnms u0arerir3tytfpD aivo;s teto(m no1lp elivslsfa2rrurpot4teen ietadla2elnvp t4 rxoioctadfpDe i i t srur(rpoo1lm   fvtlt) Dtauront0tpx ifctatfm2ua(mo u4 ltnxociodfa rluvo t srxriopny4am nlfvtlt)a2raumooo1ape  f3iytlm2rau p t0 ltnmo iadfm eluvo;( s2ur(mpoodope lietatf rrm(root4opxniiciys a elump;()arxomr3ootoa rau slt s2uo(o3iydamtelnvt sfsrrmx poo1apxnifcilsfm2rmu o u4arerxf iydla  lieolt trto(opoydlp e fes () rrmx poo0tlxo f3iyslaDra(mp;t4trenif io1omtelivi;(  rumiopoodapeelfct sfartmu  oo4aeto oeilt a2eluvp t)tleoif3io1lpDr i il( srurio oodame  nesasfs2raurooo0alto oetlsfm elnmpnu)altnxo tytfptr nvils0 rxrio3iydaltnmivta(f 2umuronu1olt mfctyd m2rln o t)trxoirciy1omDelnvi;t  exrxr3oo4am emneias aDumxr nt1alx iietldfsDeanmp;u)trtoxf3oodopte ivs;s) etrxopoodalenmivia(f Dua(m nt1tex  ictasfa eln s t0aetnif3oatfmDrluesl( truoio iudaptelivsa()srra(r no0aeeomicias s rmnvsnt4areoxfctytop e n ilt s2xo(m no1lmt lnviatf 2ua( oot0aleoii3iatlmDrau s;(4 ltoxo oytlate nvilt teum(m iodam n icslt)a2rau pno0oetn f3iytla2emnmo u)arxoxo tatlmte uvo;s seumxopiy4optnmfvtlt)arrmx  nt1alenmiciasls rln s;()aetomrcoodfa e i i;t)trxrxo ny4lmtnlfvil()arraur nt4ope mociasfm2uluvsnu4aetrir oadoaDrau s;t  2toxrpoodlmte ict tf Drruronu1tet  o3tls aDumn ont4alxoxf3ootla rau i;t  2um(o3oodomtnmncsa(f Duau pnt4tle io3iat s2rl(vo;t4alxnmo io1fmt ai i t srtmiopno1aleelfvilsfaDumu  ;u1texoiietyslmDemuvp t4arxoio oo1lmDrln slt0s2tm(rpoy4al nlfcsas  2ta(moot4texnmociaslm2umuvo;u)tlerio oydfmte ieslt0trurxo nu1lmte fviltfartr( o;o4teeoiieiasfa2em(ms;() lenxf ia1lmt livs;t) etrio3oo1opeelieia(f 2raurp;u4texn iciltlm2uan o;t)areoif oatlate ueo;s0srum(mpnydal nlfviat srumum ;o0oet  oeiytlm ua(vp;(0texnxo3oadfmtr u i ( srto(r3oo4aptemfeil()s2tmump;o1apto f3iatfaDemump;(4texnxr io1fpteaies;s0trtrirpnudllte icsat  2rrur ;t1olenif3ild s2umu o t) ltrifcto1fp rlnes;s  exoiopoo4lpenmivt sfsDtm( ont1tee mietas sDul( p;t4 lxrio3oadfmDe uesls) 2xrio3oy4ap e nvt t)sDra(m nu1oetnioctad a2rl(vsn(4 reoxoctadoaDranei (0s2tmir oo1omenmfct (  rtrxmoot1aexn i3iytlsDumuvs t)trtrmfctytfa eaiei t) exr(r3oy1lmen iei sf rtax oou1opeomfetlsls uaumo;t0 exnxfciodfp ean s;s  etoxr3iy1olee ict t) Dtax pot0oeeomfetad m umnmp;t)altoxfcoo1om raivilt0sexo(r3no1ll nlfeslsfarra(moot0oex  o3iysla rmnmo t4trtnio3todoaDraieol( sexo(opiy4amee nct ( arta(m oo1alxnifetlsls2uanvo;t4trerif3tytfptr uesl()texr(mpno1al nlfvil(  2uaumpou4tpxoiociad m2rauvp u)artrxf oytoaDrlivs s)trtoxr3iy1llen iet tf Duaur ;t0texo octldlmDel(vs u4altomocia1lmt aues;s0 rumxm3ny4lpeemnet s  2ururpoo1ale io3iasfaDulnvo () ltomo3iatlmDean o;t0 ruoxo3oudoptnlivta(fa2rrxrp;o1opt  f3iytls emn s (4 exnmr to1oa elueilt t2umiopoo1lltn netat)sruaurpno0aeeoio3tys m ulnvo (0areomfctodlat  nvi;s0t2xr(opoydamenliesas)srtax onu0altnifeilslm rluvo u0teeoirctadomt  ueo;t  exm(r3iudlltn ivias)srta(  ou0olxnioeiadlaDemuvonu4aetrifcto1oaDelnvils)teur(o3no4al n nvsat sDrmump;u4tpen iciydlmDul( p;(4 exrifciytop rlnes;s0 2toim3oy4ame  ivsls)srrrur ot0tlen oeiltlm emums u4aexnmf3iodlaDrai i;(0sexr(opiydamt lnvias srua(  ;t0alxn fctaslm ranvsnt0altoio3oadlaDelies t  exr(mpnodalt  nvs t sDtmu p;o1aptn i3tlt mDua(von(4arenioctodoatrauei;t)srtr(r oo4apenmiesl() 2rrx onu0opt if3iadlsDul(vo;() eeomf tydfmD li s t)t2toir3oo4lpenlicsa( srrmx p;t0aeeomoctad mDum( o;()arenmo ia1la  luesls s2trim iudapenmies t)a2rr(mono4tpeoiociyd a2eln s t4 eermfcoodoa eaneil()teuoimpou1aptnmici (fs2rmurpnt4tltn f3iydlsDem(mp;u4artnirciatlm eaneo () exrxo iydal emncil()s2ur(rpnu1alenmiciasls emnmo u4alxoio3oydlm elneo;( seur(r io1amee ivi sfaDumxmo;u1opt iiciytfmDra(vp;u)aetrmociy1fmD  ivils) 2ur(r oodlpenmiei sf 2tmu ont4tpx  oetydfa uluvsnu) exoxo3tatlpDeluvi;s0 2tmxm3oy1omt  fvs ()aDrmxro;u1apenio3iysla ua( sn(0 lxoio iatopD  nvil(0srtoxo iydope mfcsl()srta(m ;t1texoioeildlsDea(vsnu4trtrif3tytlmtelnes t)trum(m oydalee nei s aDumxrp;u0apt io3iydlsDrluvsn(0alenmfcio1fa rln ol( trtrxmpny4lm emnvias  rtr(m no4tle  f3iadfm2um( p t) leoxf3io1opte i i ()t2xrim3io1lp nliesat)aDur(roou0olen fciasls elnms u4trxrxociotoatelu olt teuoirpio4amt lietat aDtmumpnt1tlx  ictlt s2umnmpnu)tlxnxr3io1fmt au o;t  2xrir iodomt  ivsa(  Duau  ;u4tlenmieilslaDumuvont)tetrio iytfp  an sl(0tetoirpiy4am e feilt arrrum ;t0olx iociltfaDuanms t)artrxr3totfm  an i ( tetoim3iodop emivilt sDtau p;t4aet mo3iydfs eauvo u4aexoiocoatop eli o s0s2xrir3oo4ope lfei s) Durxm no4texoiietytfs rau o;()altrxf3oa1la  lieo;()seumimpoo1altelncsat  rum(monu0ole mfeiasls2emnmon(0aeenxfciatla r n s;(0tetmxopiydlm   nctls  rtrx ont0tex ioctat sDemuvo ()teeoxfcoo1la  lnvslt trum(r no4apt  fesat)s2rmx  ;o1aeen feiltfm em(vs u0trtomociodlpDeaiesl()t2toio3oydllte iesasfa2um(m oo1aet  fetydlmDemnmonu4trxnif iodlaD li i;s)sexm(rpoy4ap  mics s) rum(r ;u0tpto fcilsfa2eluvp;t4artomfciydom r u o t0seur(o nu4al n fcs s)aDraum nu4altomietydfs2rmuvsn(4 lxnif iytfmt lneo t0tetm(o oo1lm emnei (  2ur( onu4aleomictltlm2em(vp;t4 etrif to1lp  au s;s)s2urim iudlpe mnvilt)srtaxrono0aex ifciydls ul(ms;u4tlenxr oatop  lueilt0 rxr(r oo4lleemfvil(farrrx pno1olxnmoeilt mDua( p ()aleoiocoadlmDeln slt)srur(r3nu4omtelfes (  Durum nu4opt  fciadfa ra(mp;u0aetnmf oatlat auvols t2tmxo oodol   ncilt) Durx  ot0oexnmoeiyd s ua(mp (0aeeriociadla  au i;()srtmim iy4olt lfvi (fsDumumpoo1opeo iciysls raumo u4trenmf3iytlpDr ueil( s2urio3nu1al elicsl()s2rmxm ou1aetomo3iatfm emuvs;t) leomocoodlptranvs t t2toxo oo4olee iei ( a2umxmpnt1oex moctldls rlu o u)treoircta1la rln o t) 2umim3nu4lptn fviltfaDtmxmooo1ole iictydlaDum( s;u)arenxocio1lateluvsls0trtmxr3oo1alte ici t)arum(rpno1aexomo3iys s2eanmont4trtrio iytoa eluvi () rtmxr3io1ll   neta( s2rau  ou1apxnmfetysfa el( o;t)tetnir oodla  lies s0t2um(o3iydamtelict sf Dtm(moot0alxo o3ilt s2em( snu)arxrxrciotlm  auvi;()trtoirpiu1lpt  nctl()aDtrxrpoo4opxniieilslsDrmnvonu0altomo3tatoaDrli sls0trxmxo3iu4olte neilsfarurxr ;u1optnmo3iyd s2umn s;()texrxfctatfm  lies t s2toxm oodolt  ictlsf Dtaxmpnu0tptniictyd aDel( p;(0aleoxf3tadfmte nesl()trur(m3nudlpee neiasfsDtax  ou1teto fciaslmDra(vs;(4texnxf3iadla eluvs;( srtm(o3no4ll n ncs (fsDta( oou4teeo oeiasfa2rmnmpnt0alxrxr totfm rluvils setoiopnodalte ics (fsDtmum ;t1tltn ictyt a um(mon(0aetrmf iodla  anvs t t2umxo iu4ol  licslsf 2raxrpnt0tptomi3tltfmDumums t4tetnif totopDeli o s s2xm(opiy4ame lnesas)sDrrx oot0tlx  ociytfs2emn pnu0areoio iy1opDrluvol()t2tmim iu1al  lnvil(  rtmu oot1alt  fciasfmDeauvo t0aeeoif ty1om e ieo (  rxrimpiu1ol elfvsls a2umxro;u0oee mi3iatfs2ulnms;u4 etoio3oatoaDr ueo t)trto(rpiodam  lfvt tfsrrrurpot4tetnmfciasla ranms;t0trxrxo ta1om rau o ( s2trxm3oydapteliet s  Dtrx p;t0tpenmi3ilt m2ran onu0tetnioctadfmD  nvolt t2toxrpnydll  mfci tfsrtmur no1aptn i3iyt m rlu o t0tlenxf oatfpDe uvo t) rxr(mpnudlmeemici s a2rr(r ;u1oltomo3tad s rlnmo u) rtrmf3oydom eluvsl(0 etmio nu4ole miet (fsruaumo;o0opeoioeiytls2rmu pnt0tetnxrctotfpD  u il(  exm(m3iy4ap elneiltfsDtau  ;u0optn i3iadfaDumn p (4aexnir3oatoptean o;( t2trxr3no1opt lnesls)a2tmxro;t0apxnmoeiatfa2elnmpnu0tlenxocoy1lpDelueil(0t2urio3nudap e ivils)s2rm(mpot1tptn ictasfa2em(vs;t)trxomfciodlpDelivi s  2toxm3iu1om   ncsas)aDurxmont0oeeoiieiadlm eau o;()tltomfctadfp eaueilt s2xrxrpny1ame  nci ( aDururpnu0tpe mociatfa2eanvo;(4 exnmo oydop eai s (0texrxo ny1lpt mfctl(  rur(m no4oex  ictydfmDuaumsn(0tltnxr3iytfptr n s s0 etoxm3nodolenmnvta(fartaxmont0aeenmf3iyt a rlums (0altnif iydlate n o s0 exm(o3ny1apee fvt t aDumxmono1tltomfeiltls2rmn o (0tetomoctatlm   nvo ()sexm(o3oy1ap n ivsl(f rumurono0olto f3tlsfmDemumsn(0 rtrmfctodfpD lu slt0 exoim3ou4ome lfei t s2umx o;t4tpx io3iad sDua(vo;(0tlxrmo ootla   ieo ( s2xrir oodolt lnciat)sDraxmp;o0oleoii3iad a um(mont4 lenxf3tydoa e ies () rurxrpnudllt  iviatf rumumono1olen iciat aDeln pn(0trtrirctotomtelneols0t2xm(rpoy4lptnlietl()a2tm( pnt0olx moetadls2eanmpnt4 rtomo3to1fm eluei;()s2umimpiy4amtelfei (fs2tm(r ;u0aee miciyslmDra(mp t4tlerxrctotlmD anvil(0texrirpnydape lnesat) Dumx  no1oexoio3iltlm emu o;(0 exomf3ty1fpD aneo s0tetm(m nu4lltn netls) rraumo;t1aetn ociadlmDrmnmp;t4arxoxr ia1lpt  uvi (0trtoxrpnodalen ictat) 2uax  nu0tptnmi3tadfa emump;t4artrmfcoadoaD auvs;t0 rtoxo io4ole  ncilt a2ua( ono0aex ioctat s2elu s t4alxomo3oytoa  luvil()setmiopoudoptnlneta(  Drr(monu1tpxn oetydfm rl( s u4 eenmf oodopt li i s  exr(r no1amenmfcsa()arraur ;t0oexo o3ilsfs2ranmo;t)trtnxoctadfp  an i (0s2tmxr nu4lp emnctlt  2uaxr ou4oetnmiciytfm um(msnu4 lerxo3iy1la elivslt  rto(o3oudllt  ncslt) 2raurpnt4tptnmf3ias s2ua( o t0tltnxr3iotfa   ueol(0truo(m nu1omeelivs sfsrtrxrpno0aee ifctasfa2rau p ()treomr3tydomtraivs;s srur(opnu4ope mnvil( arum( pnu4opeomieiydfa ua(mo (0aexoxf oadfaD auvilt srtmxrpou4lpee ieil()aDrax o;u1optnmf3iytlm2rau onu0tetoxfciatlatrli i;t)setm(m ny1ome licilsf rta(  oo4opx  f3ilsfs2ua(ms t)aetrifcoatlp raneo;t srtoimpou1omtnlics tfaDrmx pnt4ole  icils m2ran p ()alxoxfciodfpDe uvi;s  rxm(m3oydalee fcs sf Dtm(rp;t0oee  f3iasla uau pn(0trtrxo3oytomtraneo;s0t2xo(opnu4open ivt t s2tr( p;t0tlt ifetad a2ulu s (4areoir iy1oat  neol(0trtoxrpoudlltemnetatfarrr(r ;u4tptnioetlt s2eln o t0trxoxociytlp rauvi;t seur(opiodapt mfctls)aDum(rooo4tle mf3iad a rmnvs;t) lxnif3ta1lm eaiei;(0srum(r nydam nlfcs ( arrax  ;t0opto i3tlsfmDrm( o (4tetnmf oydom elnes (0t2xoimpnudlp nlnvs ()s2umxrp;o4opt mi3iad aDemnms t)aleomf3oatomDeanvslt) exoxr ou1ol   ncil()sDtm(r nt4tetomieiaslaDeluvs;t4 etoif3todlp  lu s;(0 2xrirpiudoptemneta(f Dtm(mp;t1ape ifeiydlsDel(mo (4 eeoir3totoat lneil( trxoxopiydlm e iei s)srtmur nu4optnmfeiysfa rlumpnu)tleomo iy1lp eaiei s)s2xm(o io4alt  fvtls)s2uaxmono0oleo fciat aDrauvpnu0 etnifctotla   neo (0t2xoxm3io1lp e fvtl(fsDrm(r ot4tpeomoetlsfs elu o;t4texrxf totlpt luvo s)srto(m nu4al emncsasfsrum(  ;o1alenii3iydlaDem(vs;u4tltnio totfpD  n slt0 exrxmpiudlmtemicias s2rmx ooo4optn fciad sDrlu p;t0aetnmo oy1opD lneolt0teur(o iu1llte fct t) Drmxroot4ale ii3iytfm ea( o;(4 rerio oatom rlivol()seum(opiy1apeemieiatfa2rmx onu1olx  iciaslm ra(vp;u0 rtnifctydfmD auei;s) etrir io4op e fvt s)a2um(  no4tetnii3ilt sDrmuvsnu4trxomr3tadlmtraivo t0trxmxo3no1oltnmicil( srraum ;u0tpt mictltla ea(vo t4teenmo3ootlmDeluvi;() eurxm3no4om   ncsl( s2rrxroot0aee ifeiltfa2eluvs t0artrif oatopteaueo t  2toio iydal   fvtlsfsDuaump;u1tetn i3iytfsDumumont4trerif3ty1oaDraieil()t2xm(mpio1omenlncil(  Drmurpnu0apt  ieias m uauvo () exrircia1fm ean ol(0trtoirpnodlle lfetat)s2ur(roou0aeenii3iatfs2rl(ms;(0tetrxr3totlp   nes t truo(m oy4amteliesat aDua( ooo1tlto ictld s uan ont4 lerxfcto1laDeanes;(0 ruo(m3oy1llen nvsltfaDtmuront0aleoioetasfs ra(vs (4 lxnxo3oo1lmDe ueslt)srum(m iu4altelfeia(  rumx  ot1alenmfeiydlmDumump ()tlxoxr to1oa  anvol( seto(rpoy1lmt  ivsltfsrtrxrpoo1apxnmi3ilt sDra(ms t4aexnxo tadopt livo;()seum(opnu1apen ics () 2tmxr ;o4tptoioetls m2ulnmpnt0 rxnifcoadfptran s t  etrxr iu1omenmict tfa2urxmonu4alenif3ils a raums (0 reoxr ootop r u ol(  2ur(opoodopeelivtl()srtr(m ot1opt io3tlt s um(vo;(0 ltnxf3to1opD liesl(  2xrxo oo1lpt lieiat)aDumu pno4olen f3ildfa emums u0texrmr todfm r i i;s0srxo(m3ou1lm n feta( a2ta(moou0aee  i3iysfm um(mo;t4alxrmo3iatlat anvil(0t2xrio iudomen nvsasfs2taxrp;u1tlenmfciysfsDeln pn()artrxfcoy1lpte n s t  rtmxm3iu4lmt lfvs () Duau  nt4alx  ictys mDea( s t) rtrxo oatfat livo s)texr(mpiudlme lfctatfsrrrxmpou1opxniocias a2eluvsn(0alermrctadoatr nvols)srtmxr nu1am elnesa(  2rrxr ;u1aeenifeiytfs2um(mon(4trtrif ia1fpDelnes;t s2uriopoy4oltelivt sfsrur(  ;t1ale  o3tas aDeluvs;t4 ltnxo3oa1omtrauei (  2trirpny1opeemnctatf rrru o;u4tle mi3ilsfs2ran o;t4trxrmociatlp ran o;s t2toir3ou4olt  ncil()a2raxro;t4tpen fciyt s rmu pn(4arenxo ia1omD lneils0 eum(rpny4al nmnesas) Drr(r ot1opeo iciysfs rlnvp () lxrmo oytoaD  i i;s)setoxo3oudlp elfvslsfsDtmuro;u0alto ociadfs um(ms;t4artoxr iydfatr uvi (0 eumxm3iodlmtemneta( arumx o;t0tetnmociatfs2rauvo t4tltnmfcoy1fmtrauvi ()t2xo(m oy1lm nlfetlsfaDrrx ont1tlenifcilsfa eauvp;t0aetnmf iatfp elnvs;s s2umxr3io4ll elfcsl() rtaxrp;t4tlenifctytlaDranvo t4treoio3oatlp   u olt srurxmpiu4apte ivias  2rax pot1aexomfeias aDul(mon()teermrcia1op   ues;s0srxoir3iudapee fci sfaDrr(root4tpxoio3iadlm2ulnmpnt) etrmr3oytomtr ivilt) 2xr(rpoo4open nesl()aDurx oou4ape mf3iytfm2ua(vonu)trtnmf3ootomtean ol( t2tm(o oodol e net () rtaxrpnt1tlt if3iadlm2rluvs t0tleomo3totomt au ils) 2tmiopoydap emfvi s) ruauront1apt iictadfmDulnvo (0altrif3ootlp  livo;( trum(o iodll  mfctl(  Dra(mo;u0tptnmi3iys s uau p (4 lerxfcoadfmD auvo;(0s2xmxr oy4lle micsa()aDua(r oo0olx  o3iytfm rmnvpn()artrxfctodopD lnvi t) eto(r3iu1al elneils aruax p;u4openmo3ilslsDeluvsn(0 rtnircia1fpte uvi ( s2xr(rpoydal n fviatfarumumpno1ope  i3tldfm ulnvs t) reomociy1om r i ilt t2xoio nu1lmtnmfvsa()sDta(m ot4aexniociat m rauvsn(0texrmocoo1omD li ol(0srtoxo ou1altn ictat s2tm(  ;o0aptomociyd sDrlnmp;(0 lxnxr oadfatrai i t)texrir io4aptemfvtat sDur(mpnu1alxo f3tyt mDuluvs;t)trxnxrcia1omDranvi () exrxrpno4olt lnvtat) rtrxrpot1texomo3iltfs rlnmsn(4tetnmf todopt lies;s0 exrio io4optnmivs tfsDrrx o;o0apxnmfcilsfm2uau o;()trtnxr3ta1fatelivsl( sruo(m3nodlp  mnctl()sDur(m ot1tpe mfciyt a rln pnu)aeeomf totfpt aiei;t) rur(m3nu4omt mics tf ruau oou4aexoio3tas aDelump;u) etnmf3iodlaD au ols)truoxrpnydlltemncsas)sDrmx o;u1alt moeiasfm rm( o;t4aexoiociadlpDe i i;(0trxmir no1omtemfct tfsrua(rpno0opxoifciltfa2ra(mo;(0 exoxfcootfa elnvsl(  rxmxo3ny4lmtelfci sfaDtaxr ;o1oet  iciltls ranvs;u4 ltrmo3iy1latr i ilt)srur(o iydlmenmietls) 2rrx p;o0aleniicilsfsDum(ms;t0altoifctytopt an sls)srtoim no1amtemfcil()a2rm(m ;o4olen ocilt sDean p u0artnxf iy1oa elivs (0s2urxopny4omte fvtls)srurx pnu0olt  i3tltlmDea(vpn(4teenxf iotlp eai slt  2xr(o iodame lfci tfsDuax pno4apeo i3iydfa2ra( s ()tlerxo oo1oaD  i i;() rtm(mpny1lpe mfci sfsDuau  ot4aee mfctatfs2umuvo;t0areomf3oadlmDrluvo s)srxr(r3ou4ll n feiltfarrm( pnu4olxnmoetls aDulnvp t)aetnirctytfaDeaivs ()teumio nu4lpt lfvia(f 2ra( poo1ape  oeiydfm ea(vp (0alxrxr iodfm rauvs () 2tr(o iudopeelnetlt aDuaurp;u1opxnii3iltlm uln p;u)texnxocto1lpt lnes ( srur(rpno1aptn fvsatf rrrur ;u0apxomfetydfs2ul(vo;u4 reoio iodlp   neo;t  eum(mpnu4ap elfvta(f Dumuronu1teenmfcildla ra(ms;t4 exrio3ty1faDrluvo s  rxmiopnudoptelict t aDuau o;t1tptoioeiysfs eanvs;u0aexnio oadfmtranvs s)t2urxm iy4ope livsls)sDtm(mono1tpe  iciytfs rl( s t0texrirciotfm eanei;t0 rumxr nudolt  nci s  2rau o;t1altomfeiat mDraumo;(4aetrmr ta1fm rliei;()sexm(r3iudll   ics (fs2tmum ;u4tleo fctatls2ea(vp;u)tltnxo iadom  auei;t0trtmimpoo4am n fci t sDuau  ou0aeeomi3tatfm rmn o;(4aexrir3oatfmDeliesls teuoimpnu1apenmnei t  2rm(r ot4aexo ietlsfm ua( ont0aetnmocoo1lptelieolt) etrxmpiy4lp  lnei ()a2urxm ;t1olx  oetytla rmn o (4aexnmrcio1fa   ieilt0s2uoxm3iy4aptnliesa( aDrmxmo;t0aee iociltfm rmnvs u0aeeoircoo1fa e i i;()teumim3ou1lp e netl(faDtr(r oo4apxn fetasfs emumsn(0 ltomrciytfatr uei;t)s2trio3oudaptn fcs tfsDum(  ou1alx  f3ildfm2rlnmo;t)aetnifciatfat ai sl(  2xoxr3iy1aptnlnctat srtmu  ot0tlenmoeiad aDeanmo u4alenio3ty1oa e ues;t  euoxo3oy1lpe  icsa()s2rau  ot4opt ifctas m em(msn(4artrxrciytoat lieo;s)tetmio3iydap   ieil(  2taxmp;u1tpeomoctasfs ul( snt4tlxoio iy1fpDeliei;(  exm(o3oodlptn ivia( srta(  ;t0opeo f3iytfsDra( s u0 rtoif3oydfmDr ueolt0teto(r3iu1opte fci tfs2ururpoo4olxomfctydlmDrln s (4tlenmo3oo1oat lnvi;( teum(m ny1llt  nesatfs2taxm ;t0opx iociyt a emuvo t4aexrif3io1lptr ivo;s teurxopny1ale mnvi s) rurur ;u4aex  feiatls rmuvp t)texrxf3tatlmD auvs t seurim iudal e iei tfs2uaxrpoo0olxomo3tasfmDeauvpnt4trxrif3oytop eai s s)s2um(m nudam   ncs (fa2tr(m nt0ale mo3ilt s2eaumo;t0 lxrir3oytfmDe uvi;(  2toxmpiu4lmenlfcslt arrr(r oo0apto i3tytls2ua( sn(0trtoxf3iy1lp   i s;s) rxmxo3nodlp nlfci s srrmurpoo1aexnioctysfs2rmn p (4arenmfctotlm elneil(0 2uoxr no1ll n fvslt)sDrrx p;o4altomfetasfa2emnvonu4tetriocoa1fpDelues;t s2uoiopoodapenlivsa(faDta(rpnt1aeenmoetatfsDulnvo ()alxrif3totfatrluvs t) rxrxmpny4om eliesa(faDum(mpnt4aptoioetls s2emnvp;u)aexrir3ootomtr uei;()texmxo3io1lpte ivsl(  Duaxm ot0tlxoifctlsfs ul( p (0tetnxo tatlaDraneo (0 2tm(m3iydap n ncsas artau oou0ale ii3tlsfm2emuvpnu)alerircoydop  aiei ()trtr(opno4lmt mneiltfs2ta(mono1tlt iiciysfaDrm( o;()tetrifctodoa ean s t0tetr(o iodlp elfetls)s2rm(mpoo1aeeoifeiat sDumnvo u)tltoif3tadlm  auei;( trto(m3iu1lmeelnct t)srra(mp;u1aeto feildfa2rln p (4aeeoxociytomt  nei s0 2ur(m3oydole  nesas srur( pot4tpeoio3ildla emuvp u) etrir totlaD  i s;t0 exo(rpiu4lmtemiet s sDrmump;t4oetoiociadla2emu s;t0altnir totfmDeauesls0s2umim3ny4lptemneiat) 2raurpnu4alxniieiasfs2ulnvo t0texomo3iatfat anvi;s t2trirpoo1lm elnei t) 2um(mp;o1tpe mfctadlaDrm(mp ()trerxo ootlm ranvolt) etrir3no1lptn nctas artaxmoot0tetn o3iyd aDuanvo;t4 etnmr3tatfaDe i o;t0teurxmpoydlme  nctl( arrr(m ;u0tpeoio3tlsls2uln p u0arenio3io1omteanei;s0teur(rpoodomte nesl( s2raxrp;o1aeenio3iydlm rau s;u4 lxrxf to1oa raues;t trumimpnu1alt  nciatfsDum( pnu4oexnmfetyd mDumuvs t)arermr3ia1lmt livils0 2toir3iy1lpe mies ()aDumu p;o4apxn ictatfa rmums (4tlxnircoydlp  aueil( teur(m iudlltnmfei t)sDumum nu1optomfcildlmDum(vs t4 rerif3iodopDeaneo t  eur(r oo1lmenlfes s) rrrx o;t0ale iieiatlaDumnmp;() rtomo oy1fat anvs;s) rto(o3io4ap n iviat)artrxrooo0tpt ifetltfa2rmumsnu4aeeomrciatfpDr ivil( s2xo(rpiu4apenmivsat  Durxr ;t0tlx iociat a2um( o;u0tltrmfcootlm  aneol()srurir3oy4amenlnesa(f rtr( pou4optnmociytlsDra(vsnu0tlxoxo tydlm  an s;s0t2tmio3ny4lmte ict (faDrrum ;u4tltomoetyd aDelums u0artnir3tydlpt ln i;s0trxoirpiu4llen fei s  rum(moot4oleniociltlmDuaums (0 lxnif tytfpDeanvols trxr(mpoo1lleemnvsasfsrtmurpou0oee ii3iltla2emn s t) exnxrctydlp eauesl(0tetoxopou1lm  mncsas  Drrum no0oltn ocilslm em(mo (4tlxomo3oy1fat  uvsls t2xrxr3oodal  miet (f Drrxm nt0alx  f3tldfaDrmnvsnt4 eeomr3ootopDranvil( teuoxr3iy1altnliesl(fs2trxrpoo4tee ioetat aDeluvsnt0tetomfcootlat  ieo s  2trxr nudalenlivtlsfaDtm(rooo4oleoioetytls rlu o;()areoif oo1la eauvi ( trum(rpiudll emivs s) rrmx oot1aeenmoeildla rmnmp (0arxnxr iadlmDeaieolt)srur(m3iudopt  ieiltfarrmxrp;u1tle mfctyd s emnvsn() reoirciatlmt lnvs (0teuo(r oy1am  mfeilt  2trxro;u1olxnmfetad s ul(monu) etrxf3ia1fm  lnvo s0 euoir nu4llt mfvta(fsrtaum ou4oex mfetld aDumn p t0 etomocia1fpDrluvo;t)sexr(opny4apte nvtlt  Dtmu pnu4tlto ieiytfa2ua(vpnu)aetrmf iatfpDr n i ()s2umim iodol nliesa() Durxront1ape  fciatlm2rluvsnt0trenmoctodfa   nvs;t  etrim nodlm nmfet ( s2um(  ot1oeeomocias m2uauvsnt)trermociytlp eaueil(0 rxoxopiydopteliei s  Drax pou1oltoii3tytfa2rmumont0aetoiocoa1fate nvils0trxoio ny1ll n ivsat aDrmxro;o0tle moetytls umu onu)alenio3ty1lmD  u sls0seum(m3ny1oleemiviatfsDraxmpnu0aexoif3iyt a umuvo t4alenio3ia1fm  lu sl( t2uoxrpiodlpee fvtat)arrr(rooo4oetnmiciytfm2uau s t) exoif3oa1fmt  i o;t0tetm(mpoy1ll emiesat  rraxmp;t4olt  o3ilt s2umnmo t4 rtnxociy1lm  anvs;t srumio3ou1altnlietl()aDtr(mo;o1olenmoetyd a elnvpnu0 etrxo3oatlaDe ivol( s2toir3oo4ol nlfciltfa2ur(ronu1oeto o3iytlmDemumsnt4aetoxr3tytopDeai s (  2xoxrpnodll emfei s)sDumu  nt0tpeoioeiltfs el(monu0artoio iodfpD aivi (0t2um(m3io1llen fes tf 2tmum oo0tlenmfeiasfa umnvo;(0aexnmfcta1lmteaneo t0srto(r3nydlptn iet sf Dra(rpou4aetnmfetadfs2um(mo (0altomo tydlmDeaueo;s0 2ur(o ou1ol n nvt s  2tmx  oo1aleomf3ias s ea( onu4tltoxf oy1fa elues t srxoirpnu4lpenmncia(f ruaxrpno0aet  o3iasls uan pnu4tlxnxr tydla r n o s0srxm(m3iu4ap nlfvs s srrmump;u0ale ifeildfm2em(ms (0 etomocoadlp  au s;t0setoir iy1lme  fviat aDuax pno4ape  f3ild sDranvs;t4texrxf io1lpDeln s t srtr(rpnudamtemivs ()aDtm(rp;o1aetn f3ilsfa2rl( p u)aexnxr iy1fpt an ils  exoxm io1am n nvs s  rurxrpoo4ole mi3iys a2emnms;(0teenir3iydfmDrai i t s2xm(rpoydlp n nctlt)sDrmxm ou1oeto feiyt sDeluvs;u0 lxomf3iydoatr uvi;t)t2tr(o ny1lmt lncsa(faDtr(roou1tpen icildfa el(vo;(0aetnmr iadopD  uvslt0trxm(m iy1amt lfei t) 2tr( ono4oexn f3tat aDul(vs t)areoirciadoaDean i s0srtrxrpiu1omt lnvt s a2umuronu0tlxn o3iys s ulnvo t0 lxnmf ta1opD lu ol(  exmxopoy4omenmiei s s2trxrpno1oetn iciatfsDulu o;()tleomf todop ranvolt0s2xr(opnodome lfcta(  Dtr( ooo4ale  feiadfa2ul(mont0 etoxr3oodfpt an s t  rxmxm oodop  lfeslt a2trxrpnu1oeeoio3iatlmDem(mo;t)tlxnif3iy1om   n ols0srxmxr nu4lpenlfeslt aruau pnu0tlxnmf3ildla raumon(4treoxr tadlatr ieil()t2xo(mpiodlptemfeil( a2ta(mo;u1tpt  f3iad m2emnvs u4tleoxo tatfaDe u o s trxoxo3iy1op elfvils s2ta(r ot0teeoiiciltfm rmnvp;u4altrmociatfaD li o;s  exmim3io4olt mivtls srta(rono1tet  i3tatfm2elums t)tlxoircoatomDe nvs ()tetoxr3ou1opt mnct ()a2ua(roou4tleoiiciadls rau pnu4alxrmo3oatfp rli il(  2tmxr3iy4amtnlfeilt arum(mpno1alxomieiys aDuau o;(0tlxnxfcoytoat an i s0t2umir3iudoptn nei t a2rmurpno0ole  i3iadls2uanmpnt0 exnxf3ty1latrluvs t0 eumirpou1lltnmnesl()aDrr(  ou4alen feiat s2ul(vo;t4aexrmo3ta1om rlnes;( s2trxmpoo1alt lnvt (  2urumo;o1oleoio3ilslsDeln snt4tetoxo3tytomD luvi;(0 2xoim nu1llt lfet tf Dua(mp;t4aex  fetldfs2rlnmonu4tleoxo3iydlpD ai s t)t2xrxm io1lm  miesltfaDua( pno0alto oetyd m2el(vp u0arxnif tytfp  auvil( texoxo3oydamee ies t  2ta(m oo0aee mi3tas m ua(vp;t4aexomf3oodoa rlneils)s2xmio ny1am nmnci sf rtmxmp;t0aetoiociatlm2ra(mpnu4tetnmociy1oat livi;t srxm(m ou4lmenlieslsfsrtaxrpnu0tet ioetltla rau onu4altoir oytoa  lu o (0sexm(o no4altemnei t)aDrrx  nu1tlx  ieiydls umnmsnt0aleomocty1lp rlneolt0t2tm(m iudomtn fctat)s2umurpnt0ole  ietyt m emnvp t4aleoifcoodoaDranvolt)setmxm iu4ol emictat a2rm(rpnt0tex  f3iyd s2rmump u0altoif oy1oa rlneslt trxrxr3oodale mnciat) Drmx p;o4apto o3tat m2rmnmon(0tlxoxf3to1fp  auvo;(  2toir oo1lpt  ivt tf rumxrpou1apeo f3ildlm2ul(vo;t4trtrir3iadlaDe nvs (0 rxoio iudol nmnvil() 2ta(m nt4oleo o3iatls2uau p ()aetrxocoo1fptr u olt setmxo3ny4ole mnesat arrmxroou0tex  ietlsfa2elu s u0 ltnif3iodlp eln i (0 exr(o io1om  lfetas aDrr(  nt4tetn ictldfm2el(mo;t)trxoxf ta1oateli i ()t2trio3oy1ol e fetl(f 2umxm ou1tpxnio3ias aDua(vp u0 ltrmr3tytom  au s s) 2toirpiu4omtn nvt s a2taxmpoo0apx  ociysfm rlnmp (0aleoir3ootfatr i s t)s2xmio io1opte fesas aDuaxr ;u4oltn iciyslsDem(vpn() lermfctodfmt  neil(0 2tm(o oydapen fvi (f Drrx poo4tpx  ietls s ra( p;t4 rxoxr3tatlmD lneo (  2uoir oy4am n nvil( s2rmur no1aptn fciydla2uanms t) lxnxr tytlmte uvo (  2tmio no1lmeelnei () rum( poo4tex mieild sDrln pnu)alxrif ia1la r i s s  ruoir3nydlpeelnet s)aDtmxm oo0tlxomoetydls2emuvs t4tlerxo3todfmDe n i;s0 2toxr io4lpenmfctls)srur(  nu1oexnmi3ias mDrauvsnt)texomf ty1fa r uvi t  etm(r io1lltnlfcsa()a2tru ont1tle moetadls ulumpnt0tleomoctydfa r ivi;( srtmxm3nodlpt  nvil()srtmxrpot0tpe mf3tyd aDrmnmo ()arxnmr3iodfp e n slt0 exoxrpiu1lm   nvsl( arrax  ;t0tlen iciys s ranvsnu)aetoxr ootlmt  n ols)trxrir iydopee fet ()aDur( p;t0aexnioeilsls2rmnmonu4trtoio3iadla  ln olt)trtoxopiu1al nmivi tf Dtmumpnt0opx ioeiad a2rau p;t0trxrifciadlpD anvol()s2um(r3nodlme mnvsls)a2rruroou0tee ifeiatlm ran snt)aexomrcia1lm e u s;s) rxrxo3nu4opt mncslt)s2tmxmp;o0opeomfeiys a2umnmsn(0 rtrxfciotlpD  nvilt)truoxo iy4am emfesat sruaum ;t4tetoifeiasfa raumonu0tltrxr3oatoa ran o ( t2trxr3oy1ol nlivtlt s2raur ot1tpen ociytla2elnms;t)texomr3totlmte i i;s0t2trimpou1altn ics (farur(mp;t1tlt iietadlsDra(mpn(4 lenxo3oa1lmt liei t)t2tr(o3nu1om eliei ( artmurp;o4alt mfcils s emump;u0 eenxo3iodlpteauvi;t  etoxo3oy1lm  lncs s)s2rmxr oo0ale  oeiysla2rluvp;t)teenir ty1lp   n s;t0 2xo(r iy4amtn ictls  Durxrpnt0aet ifeiatfs rmu p;() ltomo ootlptelneslt  2uoio oo1ame  ieils  Dtr( pnu0opeoio3tlslm2umnms;u4 eermrctytlmDr u olt s2tmiopnydopeemietat srtrxmoot4ole iociydlsDuln onu4 rtrio iotfp raueo;s) 2ur(o3ny4lm emiesltfa2urx  ;u1oet mieiasls umnvs;u0aleriocty1lmt anvils tetrxm ou1om emict s  2umu p;t0oeto ictydfs2umu snu)artoir3oydomt  uvo (  euoxo3oy4olt lfvil( aDur(mpno1tle  f3ias aDua(vpnu0trerxrctydlmDelu il() 2umirpnu4lleemfct sf Dtau o;u1tlto o3iltls2rlnvon(4 etnmr iatop rln i s)texmxmpoy1al nmics t)srur(rp;u0oltn i3tadls2emuvs;u)teeoif oatlmDe ivo ()srtm(m ou4apeelietl( s2rmxmo;o0alxomiciasfs2ulnmp ()arxnxf oatfpte nvil() 2xm(m3no1altelicsls sDuaxmont4tltnmfetlsfaDel(vp;t0teenxf3todfp   i s;()setoxopnydapeemneias aDuau  ;o0texomf3iasla2emn snu0 exniocoo1omtrau s t  rtmirpoydoptnmfesas s2rm(moot1oltomoctad mDemnvo u4tltrxo3iytoate uvol() eumir io1optnlicsls  rtaum ou0openif3iltlsDul(mpn()tlenxfcoatfaD ai i;( texr(o no4ole mfvtat)a2ra(m ou4olenmi3ils aDulums;t0aetomo3oo1lp r ues;( teuoio3iu1lle  ivtat) rtm( ono1tleo iciys s umn pnt0teeoio iodlptraneol()s2to(o ou1aptemieta()a2rm(mo;o1tpx io3ias aDua(vs;(0 etomo oytoa rauvo;()tetrir oodape lfcs t sDrmx pnt4tet iietls m2eauvpnu)trtoxrciytlateaueo;()srtoxo nu1optnlietatf Dururpno1aet mfeiyslmDua(monu)tlxnmr3iy1lpDeanvsl( tetmxmpny1aleemici ( arrmx  nt0tpxo ociltfsDrmu p () rtnif oo1fmD ai i;() rtoio3ny1lmeelivilt) rraxm ;u0tlt moeiyslm2umnvp;(0trenif3tatla e uei;t setrxr oodamt mnctl()arrrum ;o0oetomo3ilt m em( o t4 ltrir totopt an s t trxr(opoo4op  micils)sDtrxr nt0ole  fetatlmDemuvsnt0aexnif iatlpDrln o;(  etr(r3ny1ll emfvslt) rtau pno0aexn fciat m2umump u0tlxrxfcto1op rau o;(0s2ur(r3oudol e fvia(  ruax  ot0aee mfeiysfaDel(mp (0tltnmr iotfmDe nvsl( sexoxr oudapee fvias aDrru  ;t1teeo fetadfa2rm( pnt4trtoxr oytlmDelivi;t0 rxmio3iodaltnlnvi () 2tmxm ou4tltnioetydfa rln pnu4 lerxrcoo1lpt  iesl()srur(m nodlpt mics () Dtauro;u1olenioeiadlmDel(vo u) rxoxrcio1fat  uvols t2toir3oydomt  ictlt)sDrrxrooo1tpto feilsla ul(vs;(4artrio3ty1omDe n i;(0 2xoimpou4op   ics ()a2ur(mpno4oex mi3tys sDul( s t0 lenmr iodla  an i ( trtrxo oodop  lfvt s)sDrmur ;o0tpt mo3tltla ul( p;t4aeeoifcoy1lp elieo;s)sexo(m no4oltn fcsas sDrmu pou1ope moctydls umn p;t4artniocty1fmtraivols trtr(m3oy4ome mics (fs2uau pnu1ale  ieilsfmDuau o t)trtoircoodfmD ln ol()trto(opoodomeemnes s a2rrx pno0oltoifetatfs2ua(mo;t0 lerxr3ty1lmteanvs;()setoxrpoodomen nvsl(  2tr( o;t4opeo fetydlmDean sn(4tltnmr iy1fpt aneo s)t2xrxm3nu1alenmieias  Dumx pot0olenifetad mDul(vs;u4aetnxociydfpDrlnei;()t2um(r3ny1lmen fesatfa2rmurpoo0ale if3iltfsDemuvs t)aeermo3ta1fmD lnvo t0trxo(o3ny4alenlnvil()a2ur(mo;o1altomictas mDelumo (4 eeoxocoadla rlivi () 2xoir ou1lptelfvtl(f 2rm(rp;t4aeto i3tydls eanmon(4tleoifcio1lpte neslt trtmxm3iy4oltnlncia()s2tr(m oo4olt ifeiydfm el(mpn(0 etrmf3tadopDeaueo;( srxmir3oudam elivta(f 2ur(rpno1aptn i3iyslsDrl(mp (4altrmrcto1fmte n i ( t2tmir3oy1ome lfctl( s2tau  ot1aexn ocildlm uau o u)artnxf to1lpD  nvol()seuoimpno1aleemieia()s2rmx pou4alxn oetadls emnvs t4trxoir oadop eauei t0 2umxm ou1ap n ncs t)a2raurpnt1opeo ieiydfaDrau onu4texoiocty1oatelueolt)trtmirpno1amte nvia(fsDuaxr ;u0tptn f3tyd a rlums (0tlerxr3to1fpDeli o;t  2xm(m3oo1ame mivt s s2ururpoo1oexomf3iad s ua( s t0 rerxfcoadoa   nvol(0srtrxo3ny1ol  lnvsa() 2tr(mo;t4tpt ioeiadfmDua(vp u)trxrxocto1fmteauvo (  ruoir iydlme mnvils s2tax ont4tpxnioetlt a emnvs ()tltnif oo1fpt anvo;s0teuoxm3nu4opeelfetat  Dta(r oo1aetoiicils aDelnmsnu0teenxocoytomt auvs s) rxrirpiu4llt lnvs tfarumx  ot1alx mi3ilt m2eluvp;(4areoio3todfpt  ieslt setrxopiodlm  mivsltfs2uau  ;u0optnmf3iat a emn s u0trxnmo3oa1opt livols)s2ur(rpny1am nmivias s2rm(mooo0tlen octytfm2raumpnu0 lxrxfcoytlm e uvi (  2urxo3ou4lp n nvtltfarur( oou0tpeo ieils mDrln snt4 lermrcto1fpDrlu olt)t2uo(r ou1lpt mfesa( s2umxrpot0apeoifeias m2eauvo;t0alxnxr oodfaD aneols) 2ur(r3ou1opee nes s) 2rrxrp;t0oltomoetlsfa rmu pn() lenmrctotfpDran ols0s2xmir3iu1altelieiat aDrr(m ou0aexnmieiytls uluvs (0 reoxr oatoat  nvs;()t2xoiopno1lmtnmiesat  rtr( ont0aptoiiciyslaDemn o;()tleomo3ty1lmDe i i t)tetmxm3iydomtnmfvt ( a2um(  ;o0tetnif3tad m2emn s;(4aexrir iytlmtelnes;()setr(opiudlm emnei (  Drrump;o1opx ifetat s2rm(mp () lenmf3ta1lmDeau i () exmxo oo1optemieta() Dua(mo;u0opxo o3iyd sDrmnvsn() lermfcootla eln o () etrxo oo1om   fctatfa2uau pou1oetnio3tyslm rlumont0 rerxr3ta1la r u s s0texm(opoydam emietasf 2ta( p;u4tlxo ieiat sDra(vo;u0treoxf oy1lm elu s s  2tmim iodamte icsas  2ur(mpot1texoiieiaslmDranmsnt4 renxo3totlmt aivs ( trxm(r3oodlptn fvslsf Duaum oo1teto ieiatlm2ulnvp;u)tleomrcia1lpD anvsls seurio3io4llenlfci t)s2uaxmont4opto octatlm rmnvpn(0aeeoxoctytoa elnes (  exmir oydolee fesa( srrm(rpoo0tee  fctlt mDuln on(4tetoxf ia1fm ranvils  exo(o nu4amtelncilt)artauro;o4olt  fciytfa rmuvp ()alenxrciotopt lueolt)sexrio3oy4apt mivt sf ruau pot0aeen f3iadlmDrluvon() ltomo3oy1laDrluvs;(0 2uoxr oo4ap nlfct (farraxro;u4oet iociatlaDrl( ont) lxomocta1fa elivs (0 exmir oy1am nmnvtasfa2um(mpou4tpxomoeiatlm2ua(vsnu4 rtrmrciodoateaivi ()seurxo3nu1amenmfct ()srurx pno1oeeomi3ildfa rl(vo;u0 ltnif3iodlp r iesls t2uoim ny1lm nmncs (f Durum ;o4aeenmoeiytfa emn snt4tlxrir ta1oaDrlnvsls)t2xrio nydamtemfcs tfs2rau pou4tpe ifetasfmDra(vont4 exomf3oadfaDean olt0srtrir nudlltn fvtl(f 2ra(rpnu1tex moeilsfm2rlnvo;u)arermocoytopDe n ol() euoiopiydlmtnmnvsltfsDuaur ou1alxn iciasla2emnms t4 leoxf iadla  ai s s0tetr(rpiodapt mnvilsf Dtmumont0apeo o3iydfsDemnvsnu0trxoxrctydoaDrln s;t) rur(r no1ale  fesa(fsDraurp;t0tpen o3iltfs ra(vsnt)aeenxo oy1fmDeanvo;(0trurirpoudlltn ivias aDtm( onu4tex  o3tatfmDua(vs;(4 lxrmr3oatlptranvi ()trtmir iodapte fct t)srtmx  nu0aptnmfetydlsDra( s ()texrxf tytlm  anes;(0setriopoudllt mfeiasfsrrmu pnt0tetniociytla ran s u) ltrxr tatlpt lnvo;s0t2to(o3ou4lme micilt arrmu  nu1oexnmicildfs uluvs;t4 lerxfctytfpDeanes;t0truo(m3oydom   ictlt)s2ta( o;t0tetoiocias sDumuvo ()alxrmrcoo1fptrau i;s trxo(o nu4om n ncs s a2umumo;u1opxo ieiatla2ea(vs t)aexrxr3oodlpD aueo;( trxo(o nu4ol elneilt)aDuaurpno4tltoifetlslaDul(mp (0tlenxf ootopDrln slt0t2xm(opoo4omee ivilt a2tm(m ;o4tlxo f3tyt a ulumpnt4alxrmrciadfa rlneo (0t2ur(o oodom  lnvilt  rtrx ono4tpx  ieias s2ulu s;t4trxoirctotlat aivi t trumxmpio1lm elivi t) rtaum ot1optnio3tyd a2emnmsn(4tlxnifctydom  lnei (0trxo(opio1lp nlnvia( sDrmxmo;t1ale ifetadfa ea( onu0altnxf3ootlaDe ivslt) etr(m3io1lmenlivtltfsDtrxmpnt0aet mfciytlmDulu pn(0alenxfcoodlmtr neo;t srtrim3iu4ol  mivtl()aDtr( ono0oet ioeiydfa emu p;t4trtrxr tadoa e ueo t0 rxr(o oydol  mivs s) 2tmu pot1ale  fetys m2eau snt0tetnmfciytoaD  ieo t)trto(r3ny4apenmies (f rtmxmpoo1tpt  ociyslsDrln o;t0treoxf3oadfmt  n i;t0trxm(m iu4om emfetl( aDtrxm oo0texoifetadfm rmnvs u)arxrxo3iatfmt lu sls) euoio3iu1oltemictls srumx ont0alx moeiysfa2rluvs;u0tlxnif oydlmteai i t0trxoir3oodomtelietls  2urumpoo1aptomoctadfs uanvs;t)tetrmo3tytfm  lnvol(  exoirpiy4amtn fvsls srtmu pnt4aeeoifctaslsDeanmp;t4 rxoxo3iadlaDelnvolt0t2umiopoodop emnet s aDumxmpnt0opeoii3iytfa2emn s;(0aetoir3oo1fateaivo s s2tr(m iy1lpenlici sfaDtm(m ou0tpen i3ilsfm2rmu pn(4texnxf todoaD  uei (0srum(o ny1lpe lieiasfs2uaum nu4oee iociadfs2elumo;t) rtrioctodoptrluvols0t2um(m oydapt lnei t) 2tr(m no1alxnmo3iytfaDemnvo;() rxomo totom r uei t)srumxmpou1aptnmnet s) rtrum ;t4aleo oeiadlsDrmn pnt)arxoifctodoaDr uesl()s2urxo iy4am e nvtls)sDtmump;o4ale if3ils aDrluvp t)aeermf iytlaDe nvs t  2xmxo3io4lpe mfvtas srtru ont1aetnio3tytfa eluvo (0 etnmociadop r u i;t setrxr iy1aptemietat sDrmur nu1opxoif3ilt s2el(vsn(0altrif3iotla ranei;(  rurxm3iodomt lfetas) rtaxmooo1oleomfcildfs2umumpnu4trtnxo iytomDrau s;t srxrio3nudol n iesas) 2taxr ;u1teeomoeils a uanvo;u4treoifciatop elu o;s t2xm(r no4lpe mfeta()s2tru poo4olt mfetatls ul( p;u0trerio3oydlmD aues t)t2xmxm nydome lfvi s sDtruronu1olt mietls s2emnmsn(0 rerif3oydlpD lnesls)s2xo(rpiudam  mfeia( aDtaum nt4ape mi3iasls2rau o;()aeermf iadfpt  nei s)seumxo ou4al nlieil()s2tmu ooo0apeoioetatfs2ea(mpnu0alerxf3iodlmD li o s trxoiopoy1omt  icsa(  2tmu o;o4tpenmoetad sDumumonu0tlxoircoadlaDrlu ols0t2tmiopiu4am   nci t  2umx o;t4opt iiciasfsDemn pnu0trxrio3iotlptrlueols setoxo nudam e iesls  rumx pnu0olxoif3iatlaDranmo ()aetoxrciodlmDe ies s s2xmir io4lp eliet sfsDtmu o;o4opxomiciadfa2emuvon(0altoxociodlmt  u s;t) 2uoxr ny1altemnei () rtax o;t1tlxnioetlsla2um( p u4alxoir iodla rln o t)s2xoxm no1lm emfetls)srtmu o;t1olenif3iydls2uanvp;t4 rtnif ootomtrli sl(  2tmxrpiy1amtemfei s)srrrxr ;t0aexo ieiat mDemumo t0alxrmo3oodopD  nvi t)s2xoxm3no1oleemivs (fsrtm(  nt0ole  o3iad m2rlu s;()tlxrmo3iotom r n olt)trxmio3nu1om e nvsasfa2urumpno0apxn ieildls um( s;t)tltoir3oy1op  ln olt teurxr nudal e ics ()arrmxmp;o1tlen i3iadfaDulnvpnt) exoiociy1om e ueolt) etoirpiydlp e nesls)arta(moou4tltniociasfa2um(vonu4tlxrir3ta1fmD aivil( teuoxopoudll  mivs tfarrru  nu1oltnii3iys aDumn p;u0tetoxo oy1lm eln i t) 2xo(r3ny4ameemnci () 2umx  ;o0aexo fetyt m uln p () rxrxr ootopDr uvo;t t2xrxopiy4ol e nvta(f rumu pou4tpenioetyd sDranms t4tltnxo3todoa elivs;s tetrir no1amtemfeias s2tau p;o4tle  feiad m rmnvon(0tlxnif3tatlmt liesl()t2umirpnydoptnmfcslsfsrua(mp;u1tleo iciatls eau snu0tetnmf3oadopDrlueil(0trxmiopiu1optelfvtas)artmuro;u0ale mfeias aDuauvo t4aexoir3ia1la r uvol(0 etmir3nodop emnvt t  Dum(mpno4aex mfciysfa2eau o u0trtnmrciadop  au i ( trurxr no1op n ncsas  Dua(roou1tleo fciadfs2rmnvonu4teenio oy1fm  an s s)t2trxrpnydamen ncslt  rrrxr ;o0opt mo3iytlm ean p t)treomocoy1lpDe uesls0t2xo(m3iy4ome mies s srtmu ont0aeto fciadla2el( sn() etoio ta1fat aneo ( s2urim3io1lpenlfviat  2uru pno0aetoif3tld m umumonu0 reomo oytlpDean sls)t2xmxrpnydol  lnvtas)aDuau  ou1tlxomictys sDrmnvo;(0altnifcoodom  ln ilt tetrxrpnydopt mivsa() 2truro;t4alxo i3iydfm2elnvp;u0arxomo tytomt  ieols0srtrim3oydamtnliciat  2rau ooo0tpeo i3tadlm2umn o;()aeeomoctydfpD lu il()tetm(o no4omeelnvtls)srtaxmonu0oeto fctadla2ul( sn()alxnmr3oatfpD ln o;s tetmir ou1amenmncsa()srtmu ont0tlt if3iadfaDrmnmp u)arxnmociytfpDrlivsl(0 exrir3no4ale mieilt artr(mp;t4aleoifctat sDrl(mo;u4artrio oatopDelivi;()t2trxo iu4ap nmnesasfsrumurpno4alen fciyd s rmumo;t)alxrmoctydfatr ivsls  2toxr ny4lmt  iei () Durumonu4olt mi3iasfaDel(mo u4tetrmfctatlpD lnvs;(0s2xmim3iodoptnmfeia(  rum( p;o1opxn fctldfmDemums;t4arxnmr3oytopDr neo;() rto(r3oo1omeemncs s)sDrr( oot0aeto oeildls2ea(vpnu) rxnirciatopDelu o t0trtrxm nudol nmfcilt aDtmu o;t1oeto f3tat a umuvon(0tetrifcto1lateaivs ( trxr(m3no1lltnmicsasfaruaurp;u0teeoioetas a2ranmp t)aetoxfcootfptr uei (  etmxopnu1ole lfvsl() ruaumo;t4optnifeiytlsDeanvpnu) rtrxf oadoaDr n ols)s2xrxo3oo4alee ivsl()arumx ooo4opeo i3tyd sDrmnvs u) lenxo3tydlmt ln i;s0 eurxopiu1opte ivtl(  2tmu pno1alx  ieilsfa ranvo u4 ltrif3oo1lp   uvolt) ruoxo3oydaltnmfcs ()srtru pno0opeoioeildls ua(ms u4 eeoifctytoptr uvs;(0srxrirpny1lmte nesa( srraum ;o4oltomociatfaDul( snt0artoifctodfpD luvo s t2uo(opiudame  fcils)aDraxr ;t4alxn f3ilslaDum( o;(4 eenmocto1lpDe nvs;(  rur(rpnudaleemfetat arrmumont0aex mf3tysfsDuan pn(0aeermfctadfatrli i;()srxo(opnodaptnmici s)s2trxr ot1oexn ieiasfaDeluvonu4arxoir3iatlmDe uvo;(0trtrxopiydamt lfcta(f 2rmx oot0tlxnii3iysfa uau s;(0 ltnxr iy1lp r nes;(0 etm(r oudom   nvilsfarua(m ;o4apx  feiatla2ra(vo u0areoio3ta1lmDe nvi;t teumio3io4apee iesls  rta(r ;u0opxn ietlsfsDumnms;u)arxomo3oo1fa rlnvols0teum(r3iu1llenmies s s2ua(r ou4aexo ieiyd aDrln o;(0 exrxf3oydfpDean o;s trxmxrpoo4om nmicsls srua(mpou4oexnifeilslsDumu o t0 reomociatlp rai o;s  2um(rpou4apt  icsl(  2trx  oo1tlenmoeiydls2eln o (0 ltrmo ta1fm rlieolt)sexoiopiodap  lfviat  rum(rpno4aetoif3ild s eauvp;t) lenmr iytlm eanvilt)truo(o oo1llee ietl(fa2uau p;o4opxomfciadlm ran sn(4texrio to1lateai ils)trtrxm iu4ap nlncia(farrm(  nt0ape  fciysfmDuln o t4arenmo3iytfm eaies;t tetmxopio1ap elici s)srurxr ou1tlen o3tasfm em( s;()trermf3oodopt lueil(0 etmxrpou4alenmiesl() rraur ou0apxnif3tys aDum(vs t4tltrxf iadlm rluvs t0t2urxr nu1apeeliet t a2rm(  oo0tlxnioetldla raumpn(0 exnmf3iytfp rauvslt)t2xoimpou4amtn icsa()s2tmurooo1olxnio3tydfsDrm( onu)trtrmrcoytoatrluvol()teum(r io1amen icta(f rrrumpoo1opxo fetlslm um(mp ()arxnxf3iydomDraieo s0t2xrim ny4opte fci (  Draxmont0apeoifetls s rmn o;()aeenif to1fmt livols) exrxm nodameelfvs () Dururono1aleo f3tyslsDeanvs;t)artnir3iatlptean s;s0t2triopno4op n ivs s)a2rr(  no0olt mieiasfm2el(mo (0artoxrciytom   neo;t texrio oudop nlncs (fsrrrx poo4aexnmieiyt s rl( pn()trxrmr3totfm eaivi;t0srxoimpio4omtnmfeilt  Drrx ooo4oetnif3ilsfmDum(mp;u0trxrxocoydopD  ivil( t2to(mpoy4ape  fesa(f 2tm( pot1ale  f3iat a2elnvs;(4aexrif iadoa ean sls) rumiopnodom   nesl(faDtaumpnt1apxomfetldfmDemn p t)alxoxf ty1fat  ueol( trur(mpoydll elicils  rur( p;o1tet iociasls ea( on(0aeenio3tadla  aieo (0s2ur(o no1op  lics ( sDum( pnu1texoiociadlm2ra(vp;t)aexrmo oydomDeauei;s) 2um(r3nu4lm  lfvs s)s2tmx  ;o0opxoii3tlsfm el( p;(4alxrmf ty1lpt ln ols)sexrxm io1lm emicsat)a2uauroou4teeoio3ilt m2uluvp (0tetomociadlaDeaieols0srtmirpoo1optnmnvt sfs2umx pot1oleoiictydlm ul(vsnt)trxrir3oo1fm rlivi;s truo(m3oo1amtnlnvias)artaumont1apto i3tysfs uanmo () rtrmf oa1opDrlues;t  etoio oodllee icsa( sDra(root1aeeo oetydlmDrmn p;(0tltrmf iytoaDr ivs;t0 rto(rpnudaltn ivias)sDrax onu4oltnmi3ild m2um( on(0trtrxf totlp   u o s0 2xmir3ny1omen icsltfsrua(  ot1opxn fetaslm uluvpnt4 ltnmf3io1lm e ueo;t)s2toxm nodap  mfvtas)artaxmp;u1tlt ioeils m2eauvsn(4arxrmf3totlpD lneols)seto(r3iy4lle lnci sf rtmu ono4apen ociysfs uln o t4 lxrio3tatoptrau i t0 exoimpoodapt lfeiltfsrumx ono1oet mfctysfa eluvp;u4tleomo3oatoatrluvs (0 euoirpoo1ll emici s) 2taurp;o0oet mfciasfm2uanvs;(4trxnmrcio1latelneo t)trtoio3oudoptn fetlt arta( ono4tet mfetyt mDumu o (4trxoir3tadlpDeauvsl( s2xr(mpno1lmtnmivsltfa2ta( ooo1tet  feiltfa eluvo;t0aleoio tydomt  nvsl() 2xrir3nydlpe  icia( artr( oou4aetomf3iaslsDelnvsnu)tlxnirciytlm  au olt)srtrim3no4omeemivs ( a2rrxmp;o1opeoifeiltfm2umu s (4 etrifctotlmDr ivilt  euoxm iy1ome mfvs t aDrrx poo4aexnii3tad s umnmp u)alxrmfcty1fm  lneolt s2xmxr oodaltnmncsas)sDrruro;t0oet mietltfm uanmsn() reoio3to1fptrluvs t)s2uoir3oo1lle mfei (  Draxr nu1opxo o3tatfmDelump;t)trtoxf3iadoptranvs;t s2trxo3iudaleelnvtltf 2rr(rpot4alxnifctytfa rlu snt4aexomo iatlpDeln o;t)setmimpiydaltnmnesltfaruau poo1olt ifciltfm raump u)alxoxociotla  an s;() eur(m3iodal  lnvil( sDraumpot0tpxoiieiydfmDuau s;()alxoxf3oodop raueols0 exr(m3io4ameeliet s  2ra(mpno1tpeoifctltlm2raums;()treoif ty1lptrlivilt0t2xoim3oo4om elfeta(  2uaur no4tpe  ieiydfa2umn on(4 lenmrctydlp rlueols0 etm(o nu1lptn ivt ( s2ta(r ;t4opxo o3iatla2ean p;(4alxrmo ootopteaieo ()texoio3nodll n fcil(faDtaur ;u0oex iictaslm rlnvs () leoxo3oytlat  u slt  rumim no1ame  feilt s2raump;o4aptnmoeiytfmDumn pnt4teeoio ta1op  ai sls  exriopnydapee nvsls arrrxm ;u1ole  feiytfa2ulnvsnt4aexnmr3iatlp eaies;t t2xrir io4lpt  fvilt)a2rmxr ;t0alx  octad m2ulu o;u0teenif3ia1oa eaieo ()s2tm(o3iu4aptnlnvtls)aDtrx  ;t0opxnmfeilsla2umu o;(0 lenir oo1fm   u sl( t2trim oydapenmfes (  rum( o;t4altnifciyd mDrl(vonu)artriociatop raues t t2xo(m3nu4am n fviatf 2urxroot1opxnioeild sDrauvp;t)teenxr3ty1oa e ivi (0teumxrpou4om nmivt sfs2rmxr ou1ole ioeias mDuau s ()tlxomr tadlptrlieilt tetrir3no1amtemici s)a2uaurp;o0alx mictlt aDean o;u0arxnmf3tadla  luei t)s2uoxr iu1lle mneil() rtrx  ot1olxomocias sDemu s t4trxomf3iatoaD luvs t0t2tmiopoo1lm e ncsatfsDrrxrp;u1aet mi3iat aDum(ms (0tetoxr3iadoa elu ol(0srtmir iydalt  ics s srtmu ont0tlto octytfaDranmo;t4 etnir3oatfpDe n i ()s2umir no1opt mnvtl(f Duau ont1apxomietytls uauvsn(4arenxr3tadlpDe i i;(0 exoim ny4opee nei sfaDurxmp;t1tlenmo3tldfm rlnvp;u4artoxf3tydlmDrauvs (0srxr(o iu1lpee fvtltf 2tr(  ot0olxo o3iytfm2eanvs (0trxomocootomDrlnvil()setoxrpno1lpenlfeta()sDumu  ;t1apt  ietltls ul(ms;u0 rxnir3oydomDr nes;s) rtoirpnu1ope lnvia(fsrumumoou0aexomo3tltfm2raumpn()areoxo oatlp   ieo ()teto(mpoy1ll emnviatf 2uaxr no4tlen oetltls em(vo;t)tltomo3tatoaDrauvo (0tetmiopoo4omeelieil()aDra( ooo1tle  oeiyt a2ua(ms;(4 etrmr iatfp rluvi;s)s2xoir oydal nlnvslsf 2urump;o0oeeo o3ias a ea(vo;(4treoirciodfmD lues;t)trxm(mpny1om  livt (fsrrru pou1apxomi3iyt a2uan ont)altomf3oatfpDraivslt)seumir3nodll nlfei tfartm(rpnu1tex  f3ild sDranms;()arxrir iodop rluvs;s t2xmxo ny1lmtnlietl() Dtr(r no0teeo ieildlaDuau o t4 ltrmrcio1lp r uvo t0t2toim oudaptemnvt (  2urx  ;u1opt iictytfa uan o t0tltoxf3oadla rauvi;s t2xm(m3oudlptnlivtl( arrrxm oo4tlxomf3tld sDel( pn(4 exomr3oodlpt auvs;s)setoim io4lme livt t) Dum(mpot4altn ietyslaDelu s;t) rxrio todopt luei s0teumim3oy4lptelfci s)a2uau ont1oexnmicildlaDemu o (0arxnxrcta1fa  li sls0s2uoxo iodomtemnctas)arumur ;u1olenifctas a rm( s;t0 rtnxrcty1fm r ivilt)seuoxr ny4llenmivsa()arur( p;o0opx mociasfa umnmo u)tleoxf3to1fa rauei t trumio3nodolt  nes t sDrru onu0aeeo ictatfm2ea(vsn(0 rxoxociydlm rauvs;s  eum(o iudamtemfei t)arrr(r no0ole iiciad m2rmuvp;u)trtomoctadfa raiei;( seum(mpio1am nlnvs t)artrx ono4oexomi3iatfmDel(vs;(0 etnmf iodlm  aies (  2tmxopnodlle lict s)a2umxroou4ale  octadfmDrmump u0 rxomocio1lm e ivslt0 eurxrpoy1ope mncsa( aDuau p;o0alx moctys m rm(vp t0altrirciytopD lnes;t0seuoxo nu1apte ivilsf rtm(mp;u1tleoif3iatfa2umumonu)aeenxfciadlm r nvo t sruoxrpoy1apeeliesa(f rrrumpou4aeto fciysfa em(vo (0tlxoir3oy1omtrluei;t0tetrim oy4al emies (f Dtrx onu4oexn feiadls ua( s t)tlxrmo iotomt liesl(0 2xmir3iu1ol elivs tf rtmump;t0opt ifciat mDum(vo (4arenxociodlm elnesls  rto(opou4omenmicsa( a2rrxmo;o4tlxoifcildla ea(mont4 rtoxociatoptrliei;s  rurxmpnu4amee nvt tfa2tmu  oo0alxo o3iytla el(vp;(0aeeoxo ootomDelnvs ()t2uo(rpiydolenlivtltfaDraurp;t4tet ioeiltfm2um(mp u0artomrcoodfm  aieols0t2umim3no4openlneilt) Dtau  nu4tle iiciyt aDelnvsn() exoxo tatla  aueo t0 rumio nu1lp  mncs t)srrrx  no0tleomf3tldfaDrlnmsnt) rxomr3tytfmtr ivs;( trtrxmpoy1lm nlieil()s2rr(  ot4tpt mi3ilslm uanmsnu)tleomo iodoa rlu il(  rxr(m3ou4lpt mnet sfa2tau o;o4tee  ociadfm rlnvp u4arxnxocto1fm   u o;t trumxrpno4ap n nvt s  rrr(ro;o1aleomi3tlsfa2uluvs (4teenxf3tatopDeluvsl(0srxm(m ny1opt mics sf rtr( p;u0opeo ietyslaDemn p (0areoir io1fmD luvs;(0trxm(m3oodalenmnvias srrrxmooo4apxomictydfa2um(vo;u)texrxf ty1oaDrluvo () 2uo(r3iy4llt  fvt ()s2ra(ro;u1ale  f3tys s2elnmp t) rxrxr3tadfpte ivsl()setm(o3ny1omt mietasf Dtaxm ou1aptnmfeiasfa ulnms () ltoxr to1lp rln i ( trtm(o ou1amtn ncsa(fs2trump;t4tlxnmfeiys m emnvsn(0treoxo3tydlat aneilt)tetoim3oydope liet ( sDtr(mpnt1texnifciytla eln s;u4arxrirctytoat ln ols0tetr(m iu4aptemnvs t sruau  ot1ape mo3iltfm el(vo u)altnifcoydfm e n i s)setm(rpny1llee nvias) Dua(mpoo4aexnifcilsfm2ua(msnu0tlxrxo totoatelneo s0 eto(r3oy1lpt  neias s2urur oo4tptnii3tlsfm2ulnvp;(4 ltnxocoytfa  anvsls t2tmiopoo4lmte ieils)s2taxront1olxnio3tat m2ean s;t0aeenxocia1oate n slt)tetm(o3nudoltnmnct ()sDtmxmpnu4aeeoio3tys m2uan snu0trenio3iydlmDeluei;( s2tmxmpnu4olenmnetat) Drmu  ou0alxn i3iasfs2ran o u0alenmfcty1op e ies;(  exrxopnodaptemietl( s2trx poo4ope mfctyslm2rmnvonu0 renir todopt au o;s0srumim3ny1lmt lics sf rrrxmont1olenii3iaslmDrauvonu4 etomo ia1faDe nvs ()teurxo3oo4olt  nvslt aDraxmo;u4opeo o3iasfs elump;()alxomf3oy1omtr u olt  2ur(r3no4ll elnvi t)sDta( o;u0aptnifeiadfa um(mpn()tetrxocty1lp  lu olt) 2xo(o oy1op eliet ()a2taxmp;t1oetnif3iaslmDran onu)alenxo3to1fpDeaiesls0 2umxo ou1amtemnvtat)srta( oot4tex io3ildlmDua(mp;(4 etomo3iydfpDe ieo;s  rur(r nodamtn feslsfaDta( oot4openmicildfm elnvsnt4 lenir3iydoa  auvsl(0trxriopno1olt lfetl()aDrru pnt4altnioctyslm2rlumonu0trtrxocoadlp ean ils sexm(o3iu1llenmnes s srumumpnu4apx  feiadfs2ean pnu4 rxrxf3oytfaDrlies;(0 rxr(m iu1ome  fcilt)arra(m ;t4alen iciytlmDrmnvont4tleniociydomt lu s ( seurim3nudomeelnctlsf 2rmu o;u4tlt iietydlsDuanvp u0 ltrmr3oatfm r ivs;t)trumxrpny1llt  fci s srtr(r nt1ape  fciasfmDum(vo;(0tlxrxf tadlpt  nvs t0srumxo3nodlm elfcsl( a2rmum ou1tleo ictltfm2umumo;t0aeenxr3iatoat  ueo;t0 2xmiopno4opeemiesat  Dtrxr ;t1tpxnmieiyt m2rmums;u0alxnxo ia1fatrlnei;( srtrxm oy4alt mivias s2ta(moou4apeomieiasfm ranmon(4aeenirctatla elu s (0 2ur(o nydoptemfei s) Drm(ro;o1apxo o3iys sDua(vpn()tltomf iydlmt luvo ()trtm(m nu4amtnlfet s  2ururpnu0aet  ietat m2ua(mo;t4altrxocoa1fmteln s;t0srxoim3iu4lp  miet s sDtru  ou0tptn fctadfs2ranmo;u) rxomo ta1op rluvsl(0trtrir ny4amtn ieia( srraumpnt4optnioeiytfsDrlu s u)trerxr3oatla  luei;(0 rtoxmpiu4lmen fctltf rra(moot1aleniocilt m2ea(vo;()alxnxo3oadoa rluei;s  exm(o iydal n fvtlsfsrtru pnt0olt moctlsfs eln p t) leomf3oatomtr ivi t teumimpiy4lpt mncs t) 2ta(r ;o0tlx iieiatfa elnvs t)aeermrcoydopDeln i;t0t2umxrpno4amte nvslt) Dum( poo0tet  oeildlm rmumont) rtrir oy1fp elies ()texmir no1op nlnct ()arrrx ono1opeo iciyt a2elu p;(0 reoxrctatfatrlnvo;t)teuo(m nu4ale miciatfs2ta(mp;u1tpx mfeiydla rmuvs u)trxrxo3ia1opD lnei t0trum(opoodamt  fesasf 2umu o;t4oexomfetldla2ea(vo;t0altoxr3to1fmteaieils)s2tr(r3oudlm  lfet t sDtmuro;o4tpt mfetasls2eanvo;u0trxnmr3tydopDe uvsl( teuoir3iudopenliesas) 2rau p;t1alen o3tatfa ulnms;(0tltrxfcoodlpteaiei s  eumxr no1optelnviat)aDur(ront0tet mi3ils aDel(von()alxomo ty1op   nvi t) etoxrpiodlltelnesatf rum(rpnt4ope  fctlsfa2rl(mpnt)artrxoctytomDr i s;t  ruo(o3iudll e fci (  Dtmu  oo1tpxnifciydfa eluvsn() lxnmo ta1oateanvo;t s2um(mpnydapen ictat)aDtrxm ;o1tex ioetytfa2rlnmo;u0 ltoio3totfatr uvsls0srtrxo ou4am   nvil()sDumx  oo1tpxnii3iysla2emu p;t0 ltrmfciodfpt  nei s trxoxm io1lmen ivsl()s2rrumpno1tpxnmf3tas m2eanmo u)trxomr3oadom eln o t sruoxm io4omeelnvsasfarraxmooo1apeo ictld a2ul(von(0 rxrxfciotoaDr u i;(0sexrxm3io1lp nmfesltf 2taxronu1altnif3iltls ulu s;t4 rerxoctadlmDeau s;(  exoirpiu1apenlfes s)artmxmp;o4tpt mi3iyd m ra(vp (4teermociytlp   nes t0seto(rpoudapeemiet t  rrm(mpnu4olxomictlslmDua(mo (4tlxnifciadlaDrliei;(0 eum(o io1op  mict t)artm(m ;o0opx moctltls2ulnvs (4aetoxr3tydoaDe ivi (0sexo(m oy4ll  lieia( aDrr(roou0aexoiiciytlm2um(vpnu4altomrcoa1faD livo ( s2xmiopno4al nmivsltf 2ta( ooo1aexnmoeiytla2ean p;u0alxnxocoo1om rlueslt0trto(opiy1amt  feias)srrru  nt4tet iieiasfs2ulu s;()arxrxf3to1opDeaueslt tetoxrpno1lleelfei tfs2ur(m ;u1aetnmo3iasfs eluvs t) exnioctodop raieo ( s2uoxrpno1lp nmfvi ( sDtax pou4aet  i3tas m2rmuvont0arxnmo3iodlatraieo t0s2xm(opou1olte fvsat s2umxrp;t0tlenmoeiatlaDem(vs t4aeeoxr3iydomDran s s teurxrpiy4ll elictat  Dta( oou1tleomf3iys mDul(vo;t4areoxo3tatlpDelieolt0seumiopnu1ope  netls) Draxrp;o4oetoioctyslm um(ms;t) lenxf3ty1lmtelieo;s)s2toxo nodlp emnvtat) 2tr( oot1alx mi3ils a uanvonu0tlenxr3iy1oaD au i t0 rxrimpno1alt  nviatfs2umx  ou4apeo iciyt s rmuvp u0aetrir3tadomt au s;t)t2xo(o ou4omt miciatfaDtaur ;u1tpx ifetaslmDemnmsnu4trxrxo3oo1lmteliei s0teumxr ou4olee fei t  2rm(monu4oltnifeias mDumnvsnt0 lxnxr3oadlpDran i;t)texoxm ny1lmt  ivtls a2rmxmpoo1alenmf3iasfm2um(vo;(4 rtomo3tatlm r u ils t2xmxr iudlm  lfvt s)a2rrumpnu4ale ifcilt s uln onu0tlxrxo iotfaDe n s () 2urxm io1ame mictatf 2tmu  nu4alxo i3ias s2eanvo u4aexrif3oy1fp  anvsl()trxmimpnydol  lnvt t  Durur ou1tpx mf3tasfm2umu pnt) leoxo oodlptrai i s0 eum(opoodap elnvsatfsDum(rpnt1opx mieiltfa rmuvpn()teerxo3oatomDean s;t0trtr(o io1opee icsl( srtmxrpno4aptniiciasfs ulums;t4arxrxf3tytfaDraies;t0srtoxr ou1lmtnmfes ( s2umxr ot4olxnioetys m2eaums;(4 rerxf to1oaDrau o;t0teuo(r oy4omeemfvsat  rur(m ou4oltoii3iatlm umu p;u4 ltrxfcto1latraies t0srxr(r3nu1lltemfei tf Drmx  ;u1tet moctas m2emu o;u4teeoxo3iy1faDrluesls)setoxopoydllen fetat) 2trurpoo4tpt iicildls ranvont0 rtomr3oatopt anes ()s2umxmpnydopt  ietatf rururono0tpt  octlt m rauvo;u)trtrio3tadom eanvo;(0 rxmirpnu4am nmiesls) 2rrx  nt0aeeomfciydlaDrm(mont)aeeoif3iatoaD  i o;( t2xo(o nu1lme liviat) Dtrur no0olxniieils aDumnmp;()treoxr tytlpt  ues s0tetrxmpiudllen icslsfs2ta(mo;o0tlt if3tyt s2emump;t) renio iytom r i sls) rxrxrpoo4omt mnviltf Drm(  ;u4opxn f3iyd s2umnvsnu0trenmf3todoa eai slt t2xrxopiu4alenlfeta( aDurur oo4apxniietas m2rmuvonu)alxriocoodfmt auvs s)t2uoxmpio4ole mfvi t aDtm(r nt1oeeomo3tasfa2rm(mpnt0 rtnxf3ty1faDr i o;t0trtmirpoy1lltemicsl()srrmumoou0optnmo3iat aDeau onu4 exnmfcio1fmD  iei s t2tr(m iy1ale lfvtl( sDtrxr oo4tpeo ociys sDuluvsn(4aeerxf oy1fpt aues ( t2trxr3ou1ome lnvtas) 2uru  ;o4aeenif3tytla2ulu o (0 exrif tytlmDeli ils0s2ur(o3nu4lpe  icils artm(moot0tptniicias aDua( ont4 rtnmf to1om  anes;()teur(o3no4lp e feilsfartrx p;o1aeenio3iytfa2um( sn() rtrir totlmt li o (  rxo(o3no1llenmicsasfa2rm(mpnt4apt mfeiasfs2uan p;t0alerif3iatfaDe neils t2urxrpnodope  fci (  2rr( oot0alx  oeiyslm2rln snu4alxrir todla  anvi;t)srurxopoo1omeelfvta() Durxm ou1optomf3iad mDeanvs ()aexnmo oadfmte ivi;s sruoir3nu4omtemnes sfsrta(m nt0tlt moeias s el( pn(0teenir3oo1om  lueo ()sexrxr3iodoptemicilt)a2ua( o;u0optn i3ildfs ul( pnt)trerif3iatoa e n s;( truoxopiu4oltnmfvtasf rtrumpnu0opeo f3ilslsDrlnvo;u0trxoircty1fm eluvi s0s2um(m3ny1alen fvs t aDtmuro;u0aeto 
\ No newline at end of file
@@ -0,0 +1 @@
+neilt0s2uoio nu4lptn iesas)srra(mooo1tpeo ieiasfs2rm(vo (4 rxnxrcoadfpD auvs (  2xrio nodllt lietasfa2rax ooo4tpxo o3iytlm umnmon() lxnir3tadlpD anes () 2to(opiy4ll elnviat)a2rrxmo;u4tpe  ietldfs2ranvs (0 etrxrctodlatraieols s2xm(opiu1lmen ivta(fsrrru oot0apt  o3ilsla ea( p;t4tltnxocoatlpDe uvols0t2uoxo3io4lptelnvtas  rtmx o;u4alen fcildlmDumnms ()tlenif oytopDrli sl(0srxo(o iy1om  mietlsfaDra(mooo0aex  feiasls2elnmon(4 etoif3oydfaD  ivi;t  rtm(m3iodope lnetat sDtr(m nt1tet mf3tatlm2eanvs u4alxoircoytlm  aieol() etoxr3ny1apeemnvs tfsDrmxr ;o1tpe mietytls el(vs (0treoxo ootfm  lnvo;(  etrxr3iy4optemfcsatfsDuaurp;o4aetn oeiys mDuan p;(0alxomocoo1oa  lu ols)t2xoxm io1ll nlfei t)arrrxront0tpe  ietltls em(vs;t0trtnmf3oydfa elieil(  exoxmpou4apt mivsat  rrm( p;t0tptnmf3iadfsDem( s u) rtoiociadla   ivo s0seuo(o3iu4ap  lnes tf rua(ronu4oeeomiciyt s2rm( o u4teeomrcia1omtrln i;s)sexoir oy1ll  lfvtl() rrrx oou1oltoioeiytfsDeln on() eerxr3io1oaDr ieilt0trxo(o oy1lptnliet s)arua( pnt1tlxnmi3iadla eluvont0tlenmfciadopD lueo;s0s2xmxo oo4omte fviat a2tmxmo;o1opt  ieilsla ul(vpnu0aeerxf oo1om raueilt)s2xmxm iudop   ici t srtrxrpnu4aleomoeiyd m2uluvp t0artnmrcootfa   neo t0tetmxopnodole miesltf Dtaxmpnu4aetn o3ilt sDul(vo;u) eeoirciy1oatean o;()s2toim3ny1ame  neiasfsrra(r ;t4tleomfeiaslm elumo (0 ltnirciytfmtraieo (0srtm(rpiu1lm n nctltfartmx oot1aeto ietat aDuanmp;u)aexrir3to1faD ai s (0trxrxopoo4lmtemnei (f 2ururp;t4tleoio3iytls eauvp;(4teeoio tatfaDrai ils0 rur(mpiy1lptelfcs t)arrrxrono0opx if3tyt s2raums t)areoxrctotlm  lueo t0trtoimpno4alt mivt (fsDtaum no1tpe iictydls ea(vo;t0altoxfcta1laDrlnvslt0tetrim3io1alee ncsa( a2urxmoot1tlenifctasfsDrmuvs;u0 rtrio3ta1fatran s s0s2xrxm3oy1amtn iet sfaDtax ooo1teeoiietyt sDra( s;u) exoio oatomD aies;(0sruoxr3ny4al  lict tfa2rmxmpou4tltomfctydfa2elu p;u0texoxr3iytoaD  n o s0s2tmiopiudal emiesa(fs2ua(root0aeeomfctatfaDemumo;u0alxrxr3iytoa eliei;()t2xrxrpno1alt  neils srur(rp;t0tle iictlt s2uln o;(0 etoxr to1fmDr ies s) eto(o nydlpe  feias a2tmu oot4oleomiciltfa2ulnmp;(4aleoxf iadlm rluvi;s)t2xoxr3oodllte netl() rrm(m ;t4texoiieiltlm rm( p;t) rxnir3tytfm rlivil()seto(r oy4lme  fei t  2uau o;t1ale mf3iydfm2uau sn() exoxr oatoaDeanvols trto(o ou4al nmfetltf Dtm(ro;t4aetnmiciadls2umn p (4 etoxo3iatfpt  neol() 2trxr3nydlpe mivt (fa2ur(rooo4oetomfctlsfs2elnvont0texrirciatomDrln i;(0 rxrxo3nudomenmivias a2rrx oou4aexnio3iytlmDua( s;() lenmo oy1oatelivo;s seurxr io1omenmivt sfsruru  nt0tpx  f3iydfs2emnmpnt0 reoio3iydomt aiei ( trur(rpiy4lm nlnet ( a2taum nu4olenmiciatlaDrl(mpn() rxnxfciadlp rauei t0s2uo(r3oodale  icsls  rrmurpno0tlxomoeiad mDemnvsnt0aeermoctodoa  aiei;()trto(r3no1al e net tfs2truro;o0aleo fciltla2umnmp;t4tleoxfctadfmtrlues;t)sruo(opoudamt  fvtasfsrurxroou4teeomo3tld m2rl( s;u0alermo to1fptr uvilt trxr(opny1om   neslt sruaxm ;t4apxnmi3iydla elnms;()alxrxf iytfateaueolt)s2trirpiodap  lieiasfsDrmu o;u0tetn fcilslaDua( snt0 rxrmf tydfatrlnvilt) 2tr(m3iu4apee fcia(faDtmumo;o0ope ifctadla2ranvpn(4areoxf3tadoaDran i t)seurimpno1lm  lfvs t)s2rmxmonu0ope mfetytlaDrm(mo;t)aexnmociotoaDe ieslt)tetr(r iydapenlfes ( aDrrxronu4olenifctad aDran sn(0trxnmr3iodlaD  uesl(0 2tmxm no4am nmnci t a2umurp;o1tltomictatla elnvo;u0teeomf ootlm  aiei ()texm(m3nydal nmnes ()s2ua(m ;t0altoio3tlsls rm( o (0arxrxfcia1lm r nes;s teurir nodomeelivi ()a2trumpnu4alxnifciys s2elu p u0 rtomfcoatfmDrluvo;s trxrio nudopt mnctatfartaur ;o1opt  o3tltfa rluvp;t)altoir ta1oaDrluvs;(0tetoxopnu4lme lfeslsfaDrrx o;u4optnifctys s rm(vs;t4 exomr oytlptrli s (0srtr(o3oydol nmnei ( srrru o;t4altn fciytfs rlu o;u)aetnmrcootfmDr ueilt0trurirpiu4ame lnvsatfsrtm(roou4tetomi3tydlm2um(mp;t4aeerio3ootopt  u i;s)s2xoir3oudomt lneta() Dtrump;u1tlt ioetad m2ulu o;t)aetrifcty1la eauvil( t2xmim3oy4lpte ivtls  Dum( o;t4tetniictatlm2emnvp (0 rermr oo1oaDr ues;t)s2tm(r3nydal  lnviat)srur( oot0aptnmfeiys mDran o t)aetrio oydfpt  ueolt0 2umxmpiu1op   ncsltfarum( o;o4optomoctatfsDrln o;t4teeoir3todfateln s;s) 2xoxo io1ol emiet s)aDurum nt1olenif3tatfs2ea(mo;() rtrxfciy1op eluvo;t0 exo(r no4lp e fcilsfarumumpot0tpt mociytfm2emnvp;(0aexnxrctodlp e uvilt)s2to(opno1alenlfcsas s2ururpot0texo f3iadls ulums;t0aetoxo3tatlpt li o;()t2tr(o no1oltelicta(fa2rmur oo1aee mfeiydlsDumnvpnt0arxoio3oa1lmt  ieol()srxmim no1omtnlies s  Drr(r oo1teto feildlsDumu pn(4 lerxr3oa1fptraieolt s2uo(o3ny4lpenmiet s arrrum ;t0ope ioetytlm2ea( p;u4tlxnmr oa1opD  i o ( srumxr oodlpe lnvsltfaDtmx p;t4aeenmf3iltls2uluvs;t) eeoxr io1oatrlivols0s2urxrpno4llenlnvtatf Drmumo;t4oetoioctytla ua( o;u)altrir3oadfptraueo ( srurim3nu4amtnmnet t)s2ur(m ou0optn ictls aDumu p;t0 lerio3tatfp e n ils0t2trxo oo4al elfvias)s2tm(  ou1aet mi3taslm2ulnmpnt0 ltnifctatop ean i t seumim3oy4lpt mnvi s aruau onu4tpt  f3iytfa uau s (4aexoxoctydoaD lneo;(  etmxopno4alt  icsa(fsrtau  ;o1alxo i3ilslm2emuvpnt4aeenmoctadlpDeanvsls)seur(m3io4ll e fcia()sDuau pnu4apx moeiydls2rmnmp;t) rxomocta1fpDeauvol()srxr(r iydomtnmnetlt srtmxmp;u1tleo o3tysfmDrmuvsn()arenxo tadfm r i s;( trtrxr3io4am n nvt tf 2rmu onu4tpxoio3iad m rmuvs (4 lxrxf oo1fmt lues;t t2xrim io4om e nei tfa2ta(r oo4aex ifeiltls eln p;(4alerxocta1lmDrluvo t t2uoxo nu1oltelnesas) rurxr ;o1opx  f3ilsfmDrlu p;t4trtnmo3tatfa r neil(0s2trxm oo4ope  icsa( a2ua(rpno1oeenio3tlt a2eln p;u0alxrmo io1fpteaues (  eto(o3iu1am nmivtls aruaum ou0tltnmieiyd aDuauvsnt) etoxo3iotop elnvo (0 2xoxmpiodlme  ivsls)sDtrur ou1teto o3ild m ran s;u)areoif oadlpDean s;t  exoir3io1llenmictas) 2tax p;u1alxn fctys s2umuvp;()altoxr3ty1omt lu s s0s2xrxr oo4optelnes s  rum(rpot4tlx ifcilsfa uanms;t4tetrxrcta1lpteln s;s trxmxr oy4op e nes sf Dra(  ;t0apenmietltla elu pnt4aeeomr oydlpte u s;t0 rtm(mpoy4om nmnvtl() 2raxrp;t4teeniiciyt m2umu on(0 eenir3iotfptraues;() 2xriopou1am elicilt)a2rr( ono4texomoeiyslsDuanms;t4tetnmf3tatom   nvo;(0trxm(mpou1ll nmivsl(f 2ta( poo0apxoif3iadfm2elumpn(4trxnxf tytfpDr uvo ( teurim ou1ll  lfei s a2umx pou0opeo oeiysla emuvon(4trxrio iatom   ivs ()setr(o3ou4ameemnctas srraurpnt4ole mfciyt sDrmnmo;(4 eerxfcoydfptraies;s)truoiopny1omt lfcsat srtmur nu4tlxn oeiadfm uan snt0 exnif iy1opte nei;()s2xmxo3oy1llte fvi s a2tm( onu0aeto ietytfaDrm(vs;(0tetnir3totoaDraivol(  2umxr3oo4ap   icsat) rrr( pou1oeenii3iyt m2ranmo u4 etrir3tatlmD anes s s2to(o3nu4aptemfet s)sDtau p;o0tlx mfciad mDuan s u4teenxrcoodfatelnesl(0sexmimpny1lpe lietat) rrrx  nu1aptn f3iatfsDum(ms () exnmr oatfmDe uvo;()trtrir3ou4omtemivt s)srtaxmont1teeo iciydfaDeln p;() rtrxf3iatoptr nvs ( s2umim oo4opee fvsasfs2ta(r nu0opxomoctaslsDuanms;(4texrifcia1faD lneo;s  eumirpoydlpt livi s s2urx oou4opx mf3tas a rlnmsnu)trxoxr totop eau o ( setmxr nydapt mfesltfarraurono1oeen i3iyt s2eln p (0 lerio3oa1opteaivi;t)setoxopiu4op nlfvil() Dtrxrpot1aptnmieiatlmDrmu snt0 rtrmocoo1laDrlues;() 2xrxm3ou1lmt lnci sf Dtmumpoo4tltniictydla umumsnu)teeomr oodom r i s;s srtrxo3iu4lm  mict (  2uauroou0tlt  i3iltlsDua(mp () rtrmo iodomtrluvi;t0s2triopou4opt mivsasfsruax oou0aeenmfeiytfa2uln on()teermf3iytfmDraues;t0 exo(r ou1omtnlfctlsf 2uaxronu4tetnifeiys s2uaumpn() lenircoa1om   u i;s0tetmxo3oydlpee ics (f 2rmxmp;u1aexnmiciatfaDrlu pnu0altoif3iy1lptrln i t0seurxo oo1om e fetlsfsrua(mp;u1oet moetadla rmnmsnt) rxoifctydfaD li sls0srxrio3no4lp  miesas) 2uaur nu0olt  f3ilt a2umnmo t4 rtrif3oo1om   uvo ( srxoxm3ny1amtn ieta(fsrrm(mp;t4tpt  iciydfm2emn s;u4tltrxfctotlm  livsls0teum(mpio4ame livsltfsDta( pnt1aptn i3tytfa2el(mo;(0 etnmocio1om ranvols  ruoio3oo1ome lnci s) rrrxmpnu1oeeomfctadfa ea(msnu4arenio3oodfm  lneo ()seum(m3iodlpenlfet (fsrtr( oot4altoiieiadla ran s u)tlxoir3iydfmD anei;t trtoirpny4omt mfvt tfsrtru pnu4tlxnii3tat a2ul(vonu4trenmo todlpt  iesl(  exmiopny4al   nesasf rurx  nt0tlto fetatls uau p (0tltoxr iadom  lieolt)srxmim iy4al  lnesas srum(r ;o1tpx ii3iasfa2rl(mo;u) reoxf tytom eluvilt0s2umxr3nodlpt mncsls)artm(r ;t4tee mfcilt a2ua(ms () lermfcto1lmte n s ( tetrxo3oo1alte fct t)a2tm(  nu0aet moeiltfsDulnmpn() rtnmf3tytla e i o;()seur(o io1ll  livtltfs2tru pnu4tptnmieiydlaDrmumpnu0 rerif oodop eau s;t)srtrim3ny1ome mivtls sDrrxmooo0olxnmiciysla2elu p;() rxrxo ia1omDe n ol(0tetoxm iy1om  mfctls  2rau o;t4tptnii3tyt sDeau snu0teenmf3oytfatrauvi;t  rtrir3iudll nmneiat)arrmur no0olx  o3tadfaDel(vs t4trtrio3iadopDr ueo ()t2uoim iu1op n ncils srumx  no1aexnmietatlsDuanmp t4 etnif3iydomDelieo;() rur(m iu1op  lfvsl( aruaumono0alt  f3ils aDumuvp;t4arxrmr3oydoateli s t0 rxr(o nu4lp e nes s  rrr(  no1tleo oeiasfaDul( pnu0aeenif tadlmD  ueolt)tetmxm3iy1lmt  neiatf 2umu ooo1aptoifetat m2em(vp;(0 reoifciotom   ies s trxmxr ou4amte nesl( artr(r ou1tpt  ictltfm2ra(vp;u4alenio3io1laD lu o;s)srxoir ny4lpe lncsl()a2uau onu0aexniieiydfsDra( o;()aetrif oadlp  an o;s0 ruo(rpny4ll e ieslsf Dtaxmpoo0olx ioetadlsDrmnmsnu0 exnif3ia1fmt luvslt)teumirpno4omeelfct s  2rr(rpnu0tlxnmoeilsls2ulnmo;(4teenioctatlpD anvo (0trxm(r3no4aptemncia(f Dra(m nt1oeeoifeild aDraums;t4aetrxfcty1fp rluesl()srxoxr no4lmeelfesat)a2rrx o;o1tet moetyd s uau s;u0 rtrmocoytlmtrlu slt seto(m oydlleelicilt) 2rmx pot4opxoiociyt a emuvp;() lxnmfcto1omt  uesls0texmirpou4omte nctlt)a2tmxrpot4teeomietltfaDuau on()treoifciy1lm eauvi;t  rxmio3iy4oltelfvtl(f rra(  ;u4aeto o3iysla emu p;u4 lxomf iatfa  lnei ()teuo(opny1lle  ici s)a2uax pot1olt mfeiysfa2um(vs u)areoif tytoaD li i t0 exrxr3nu4om nmncsat aDra(mooo4tlen i3tadlsDrmu p u4 renmo3iydlp  lieils0setmxm nudamtnmfeiltf rur(monu0olx iietls m2uanvo (4teeoxo iatfm rlu sls) exmxm iydomen ieias) rumu  oo1tpto f3tyslm ra(vs t4trxomo3iatfaDe i s s teuo(o3ou4ll elfci s sDtm( o;o0apxomf3tyslmDrm(mo;t4tlenir3totfmDe i s (0 2xoxo oy4ap  mnvt sf rrrumpnu1olt  ieiadla2umums;t0tetrmf iy1lmtraiei;()srxriopiodomtnlfvslt) 2tm(mpot4tpe ifeiys sDelnmont)arermr3oadfaDe ieils0s2toxopou4lltn fet s)srrmxmooo4texnmoetadfs rlu s;()teenmfciydlatrlueilt0 euo(r nodlm n icsl(fs2tru  ;o0aeto i3iatfm emuvo;t)trenifcoydoptrlues s)seto(mpoo1am  mfvsls) 2tmxmonu0apxnioeilt s2elnvp;(0 lerxf3totop eln i;s0trtmxo no1ol n fcsa()a2trx o;t1tleo f3ils aDean o;u)trxnio3iydlm   uvi t0trto(m oo1llt mfet t)aDtm(mpnu1altnmocias m emnvp;t)trtnxr tytop eai sls trxoir3oydamenmiesa( sDrm(r ou1tleo ociys m2uanmp u)trtrir ootfm   ueo;(0sruoimpiy4apeeliesl(farua( oot4tpe ioeiytlm umumpn(0 ltoxfcoy1latr i s;t)t2uo(r iy4omtnlnes ()aDrrxronu4olenif3iys a rln on() etrmoctadop e neo s0seur(opio1apeelfcslt arurump;t4aptoiictls s ua(mo (0 lermr iy1lpteanvo t)t2urxrpoy4lmtn nvi t s2rm( ooo4opxoif3iytfaDrlnmo;(0alerxr3oy1opteln i s)srtrir iudame lnvi tfa2uax o;o0tetn feiydls rm( ont)aexrio tatfa raueo (0teurxopiy1lm e neslsfartaum nt1tet  i3iydlm rmumsnu0 lerxr tadlpDeaneolt0t2xoxo iodom  lict s  Drm( ooo0alt  iciytlm2emuvo;(4 exoxf3oadfaDr ivs ()teur(m oy1alenlnesa(  2rmumpoo0texnmietlsls2elu p u4altnxf3iy1latrlivsls  rtr(m3oo4oleemivsatfaDta( ont4oleniieiyt m2uaums;u4alxrif iatlmDelu o;t0 rtoio3oy1lp e nvi s  2umxmpnt1oetn oetydfm2rmuvpnu0 etnxo3io1oaD anvolt) eurio oudomee nvta(f ruaurooo1oltoifetltlmDum(ms;u)arenxf3oydomtrauvo;s0 etrirpnudal  mncs (fsrtmum ;u1oleomociltfs rlnmpnt0 lxomfcoodoaDr u s;t setoir3iy4ol e fvils)srum(mpoo1tetnioeilt a2emnvont0 ltrmr3iytlaD anesls  etoirpiy1lptemfet tfsrra(moot4tet  fetasla rmnmp t4 etomfciotlmDran o;( truoim3iy1ope lieil(  2tmurooo0oee mf3tltla ulu s;() etrmocootlmt  ivo (0srtmiopiy1lpe mnvil( s2ta(mont1apx  ieias mDrl( pnu0 rerxociy1faD  u i s) exriopoydap elictlt sDrrxr ;t4aex mo3ildfsDeln s;(4trxnmfctadfptrln i s0 etm(o3oydome  ivi sfaDraurp;o1optoifciysfmDranmp;u4arenifciatfmDeanvo () 2tmxm3ny1lmtnlicia( srraxrono4oeen ictasfmDrmn o (0 rtoifctydom  livo;t) ruoir3iy1al nlfei ()s2urx pnt1oeen ocils s uauvp u)tlxrmf iatoate uvslt0tetrxm3nudamenmnctas sDum(rooo0apen f3ils s ulnvp;u)teeoifcoodfpt auvi s0t2uoir3oo1ole lneslsf Drmu pou0aet mociydfsDuanvo u4 ltnmf3oa1fatrlies;(0trtmxopoydal n iet (fsDrmurpnt4ale mfeilsls2elnms;(0arxnxo tytfa  luvi;( trumxo ny4ap emfeils sDrm(rpoo1opeo ictltfm2rmnvo;u0treomoctydfat  uvo t seurxmpoudlmt  ivt () 2rr(  ;u0ole  ictldlaDeaumpn(4 reomr3oydfaDrln slt0 rxrirpou4am   fvsatfaDrr(  ;o1aexoif3iaslsDum(mp;u4trtoxrcty1fat  u o;s0texm(m ny1opeelfvtlt) 2ta(rooo1alxoiictydlsDrlnvsnt0 rtrxf ty1fmDraivi;(0s2trxr iu1lmt  nvs s)aDtmumpnu4tpen i3iysfm2uaumonu0 lenxf tatoptelivslt  rum(r oydlpee ncs tfsrraxrpno4tptoifciytlmDumnvo t)arxoifcoy1fat  nes;t)trto(opoydlm elneiat) Drrumono1aee  fctldfa2uanvs;u)tetoio oa1faDelneo (  rurir oo4omt lnvias  rtax  ot1alt ioeilsls2ulnmont) rxoxr oodfpDe nes;t texo(m3oydllee ncsat)a2rmur nu0teeomfctlslmDean p t)aeenxf3tydlaDr ies s teuo(o iodlm   icslsfsDtaur ou0alxniieiad a eanmo;()tlxoir oytfmtrluvs s0 2triopiy4oltelfctas)aDuaumo;t0opt mfciat m rlnmo;(0 lxnxf ty1fpDrli s;(  exmxmpny4ole  icsa(fsrtmuroou0oet  o3iyd m ranvo () lxomf oytoate ivi s)sexr(o3nu1aptelies t a2tmump;t0aleomieiyd m ulnmo;u4 eerxf3tydlate nvi;t trur(m iy4ap  licia(fa2tmurp;t4aeeoiicilslm2um( o;t4trerif3iotfpDe ueo s  rtm(m3io4lptnliviasf ruaxm nt4teto ieiytfmDulu p;(0tltoxfcoatoptrli ol(0texoxr3oo1ap  lnvt tfaDrm(rooo0oeenmf3iasls2rau on() eermfciotoaDrlieol(0s2tmxo3nudame lfeil(fsrtru oot1tlxnio3iatls eau o;u0alxrifcto1oate i i;( t2trir nydapt mfciat)artmur oo0aet ifeild a rluvp u) eerxr3totoptr u ils)srxoxm3oudlp  mncsa()sDurxm ;u1ole mietydfs em(mpnt0tetnifcta1lm r nvs ( trxoir iodal n fvslsfsDrmu pnu4tleoiietytls uluvo (4tlxomr todfp rai s;s)texm(m oo4ope  ivtl()a2tmuroou1tlx  ieils a rm(mo u) ltnmo3ootopDr i i;s)texoimpoydomeelnvi sfsDtm(m nu1texn ictasfa eanvpnt0tltrio3tydoaDe i s;s0srumxr oy1om   fet tf 2raurpnu0ape mociatfs2emnvs t)alxnmo3ty1omDranvs;t)srxoxm3ou1lmtn ietlsf rraxr no4oeenif3tytfm ea(mo;t4 eenmf3ta1fa rau i;s0 rurio3iodap e fei (fsrtr( ono4oex mieiyt mDelu on()trxoxf oo1opDe ieolt0 2xriopiodlpt  ieilsfsrtrxmono4apxomfeildfa rm( s;() rtriociadlp eli s;s)t2urir no1om  mnctlsfs2tr(  no4tet iieiytfm2emu p;(4aetomf3ta1omtr ivo;t t2trxr nu4ll   fet s)aDrr(ront4aleoiocilslm2rm( p t)trerirctytomtrai s ( srurxr ny4lmtn ivsatfa2rax o;t1oee mfeils sDrmn s () ltnxf tydoaD aieo;(0t2xrirpnu4lltnlnctlt)s2rrum ;u1oltoio3tldfaDrlump (4artrmo3ta1lpD  ieo s) 2tmxm3nu1am emnctls)aDrru  ;o4tle iiciat m elnmpn(4trtnxfcio1fp   nvols0 2ur(o3iu4lp   nvt tfa2um(moot0olxo oeiaslm2umn p;u0 rtoxo iy1oatran olt t2xrxopiodap elnvt (fsDra( onu1teenioctytls rmuvo u4arxnmf to1fatranvslt srum(m3iu4lltemivtl(fa2ua(  ;t1teen ietls m rm(mo ()tlermoctatlp eluesls)trtmiopnydoltelfeils  2ra(r nu1aee  i3tadlmDuanms;u)aetoiociatla e i i t)srtm(rpnu1omte feiatf 2umur ot4teto f3ilslsDel( onu0teeoxf oa1late uvi t srxrim nudom  mfetat  Drr(monu4tle  o3ilsfa ea(mp;t)aetoif3iotoptr ueols texo(r3nydom emnctat s2ra(r nt1oeenmfciys m2ua(mo (4areoir oa1fm  lnvs ( texm(r3oy4optelfetl(  rta( o;u4tpeoiocild mDeau pnu) exnmocio1oa elnvs;s  eurxr ou4om  mnetatfarta(mpnu0ale ii3tytlm eaump t4alerxo io1latelnvs;(  rxoxo3ou4ole mnvt t)arururooo1aetomfciyd a2rm(mo;t4tlxnio oo1fpD an ils  rxmim3ny4apenlivtas aDtrxro;t0altnif3tlsfa2ulumon(0 lxnmf tydfaDe ues;s0s2xo(o oo1llt  icslt) rrm(rpoo0teto feiadfmDuauvs u)tltrirctydfpD au s t0srtmirpoo4lm   ivias) rra(r no4apenmi3ildlmDelnmo u4 eeoifctatoaDrln s s t2xo(opiu1lpen fcs t)s2rruroot4ope  oeiasfa ra(mo;(0trxrxo oa1lp   ivs;s0 2tmxr io1am  mfvt s sDtr( o;o0oexoiictyslm2ra(mpn()arenmf tydoa r ueo s)setmim3nydlptnmfct () 2urxmo;t4tpe iietld s2el(vp;u0 etnxr3ta1fptrai s;(0truoxm3iudlltn feiat)arrmxrpot0tpxn feild a ranvp;t)altomr oydopDeau i ( trto(m iudol   nes t arumxmooo4opx mietlsfs2elnvsnt4 ltnmr tatfm eanvi t0s2to(opny1lmenlncsl() 2trxm ;o1tee  oetls a uanvo;u)tetrif3oydoptraieolt) exoxmpiudal n fvt tfsDuax  nt4alt ioeildfs eanvp;t0treoio tadlaDranvo;( teum(rpoo4ol   feslsfs2rr(m nu4apt  ieiydls rlnms u4trenioctadfmDr n s;s srxm(rpno4lmte nvtltfa2uaxmpnt1oleoiociasfa2uan s;()arxnmr oatomtr i olt0tetmxm3oo4am n nvsas)sruax p;u0texo iciysls ra(vo;t0arxnxfciadlp e i i;t)truo(rpou1oltemnct () Dtm(root1oee iiciasfm ea(vsnt0aetrxr ty1lp   u ols truoim nodaptnmfetas a2trum ou4tlenif3ilsfs ea( p;t4tleomrciadlpt  ivo t tetr(m3iy4amt lneiltf Drmu o;u1oetomieiadla emu s;t0tltrxo iatfaDr i i ()trumxopnudlpee iviat  Drm(m ;u0oeeoio3tatfm umn pn() rtrioctotfmt ln i;(0trum(r3io1omee ncsls artr(m ou4oetnmi3ilt s2emn p (0aeenmr totfaDr ieols0s2xmxo3io4alt lfvs s s2rm(mp;o4teenmiciydfm2ua( p;(4 etnir iy1fa eanvi;t  rum(o3nodop emiei (f rua(r oo0olxn ietyslm rluvs ()tlenmoctodomDeaues (  ruo(r oo1llenmnvil(f rrmur oo4tpxn fctlsla2ra(von(0tlenmr iotlptelieo;t  2tr(o3oo1al nmivs (f 2um(  no4oleoii3tadfaDum(msnt4alxoxo oo1om   ieilt teumir nu4lptnlfci s sDtmx  ;o4aeenioeils a2ranvp u0aeenmo3tatomt luvi (0 rum(rpno4ap n ncil(  2ur(r oo4aex ii3tatfa ua( s;(4 eenirctydom  auvilt sruo(o iu4ap e fviat  rtm(  oo0aet iieilt aDelu o;u0teerxfciydomtrln i (  rtrxopio4oltemfeias)sDuau pnu4ole  octysfaDumuvsnt0aleriociotlmt luvi t) rtrimpoudapeemfvsa() rtmurpnu1tlto i3iatlaDra( snu) etnxr iydom ranvilt0s2umio oy1omee nvtlsfa2raxm ot0oeeomoeias a rm(mp;(4altomociotomD li ol() etoxo3oodal eliet () rrrur nt0tpe  oeiysfaDemn onu4texnmo3io1la r neol()trxmimpny1al   nviatf 2trxrp;u0olt mociasls rl(mont)trxrmr tytlmDr nvs;s0tetmxopoydllenlics t)arta(r ot0opxniieils s2emu s;t0trxoiocta1lp rli ols srxmxo3oo1lpee nvs (fs2urxm oo4opeoio3tad a ranmp;t)alxrir3iy1opDr uvo;s  2uoxrpoo4open icsat)aDtmumo;u1oexn icild s rmnmp (0artoif3ta1op  luvo (0t2xm(rpny1apenlfvtat) 2tr(monu1oetn feiltlm eanmo (0treomo3iadfp rauei;( seurxopno4omtn fetat  rtm(m ;u1tlxn oetadfa rmn onu0aeeoir iatfa rauei s  2urim3ou1optemnct tfa2ua( oou0tee mieiad a rln p;t)treomrciadfmtrlnes t0 2ur(o oudomt lfeiat artm(rpot1oeeoiieiyd a um(mp;u0 exnmf3iodom rauvo;() eur(r ny1lmen nes s aDrm(rpnt1opxniiciytls2rlnvs;u)aexoxr oytlp r i i;t0t2toxopoudlpeelfesat arrrxmp;t0oeeoifciatfaDeln snu0 lxrxfcoydoa  auei s  eto(rpoy4ol  mivtat s2trx  oo0aet ifeiasla ua(mo;()tlenxfcoydlmD  ivils)srumir iu4apen nvilsf 2tr(  ;o0oexo feilt m uanvp u) etnmf oydfm   ieo;t)srurxr iudal   iet ( srra(  ;t0aex iieils a2em( on()texnmrctodfpD aneo;()teumxmpou4lmen fesat srtaumpoo4apx  f3tldlsDrln p ()aeenmrcoatoat lueilt t2xr(mpiu1ap emnci t)srtmu pno0openmo3tas m uau pnt) renxo totoateaues s  rtm(r3iy4lle lfcia( s2rmxmono1optomfciatls2ea(mpn(0 rxrmo ty1op  ln o s)t2xrirpoydlpe mivi ()artmuro;t4opto octytfsDeau onu)aetomrcoadoptrln i ( sexrio3nu4lmt  netls)a2trumpoo1tlxnmi3tytlm2rmnvo;u4aexrmf3todoatr ivo;(0 rumiopio4amt  iei sfsDrmur ;o1tpen i3tytfa2uan p (4teeoxfcoatfaDe uei (0s2xoiopoo4ll e nvsltfaDrau  no1aeeniocias sDrl(vp;(4tlxrmf3totlpDelnvs;( s2ur(m nydlp elnvtls)s2ua( poo4tetniicildfa2uauvo u4alxnxrctatfp eauei;() ruoio nydlmtemieiat s2tmum ot1opt  feiydfsDuanvs t)trxrxf tatoat  u il( srtmxrpiy4opt  fetl(fs2raxmpoo1aeenii3ias m2emnvo;t0aeenxfcta1omDr u o t) rur(m3oy4lpe  fvi t arrrumooo1tet  fctasfa2rlumo;(0 exnmfcoytopteanvs (0tetoxrpnu1apt  fctlt a2rmx  nu0opeoio3iytfaDemums;t0arxnmo3tytfaDr nei ( s2toiopoy1omt mncsatfaDtm(  ;t1opxniiciat s2rmu pnt4tetomr oatfm r uvsl()trtoxo3iu1omtemfcs t)srrau  no4ope mfctlsfsDel( p;(4 rxnxf iadoaDr i o;s teumxmpoydom nmieilt s2tm(root0aexoioeiysfs2ulumo;t4aetoxo3oytoateau sl()t2xoxo3no4ap  mfcsat)a2umump;o0aexn ietad a emuvp;t0trxomrciatla eluvo ()tetoio no4opt lnvt t  Duru ono1tpt mfeiltla rlumo;u4 renioctytomD  iei t  2urxrpou4lmtnliviasfa2taump;o0olen oeiltfa um(von(4trtrxr oydfmt  ueils)t2xrio oy1ameelivtat aDta(  ;o4oetnmfciyd s2emnvon(4arxrmr3oo1oa  an s;(0s2tmxm3no4alenlieilt srra(mpnt4tlt iictytls2emn o u0 reoxrciadoptran i;t)t2toir3oodllee ivtl(f rrmxmpou4teeo ieildfsDemnvo u0 rxrxrcia1fp  an sls  etoxm no1olenmfei s a2truroou0aptomfeilt s2el(mo (0tlerxoctadlmDran sl() 2toir3iydllt mncs tfsDua(monu0olt  f3ias s2uanms u4arenxf3io1laDelu il() rtr(r3oydlpenlietls)sDuru pou0oleo ictat s2ean o;u4aexomf3ta1lptean slt  2toio nu1ome livtlsfaDtauro;t4apt  i3iad aDra( p;u4aeenxfcootomteau o (0texrxr nu4ap n fvsls aruax o;o4olx  i3iasla ulnms u) renif3oydla  an i;t s2xmim3ou1aptnmics sf rra(  ot1tlxo feildlm uluvs u) rxomf3tatfaDe u i (0t2toir3oodol n ncia(f Durumoot0aleomfetasls2el( s u)texnir ootomDeai olt  exrxr3nu4altnlnei t arumum ;u4alxnii3ildfs eauvs u4trxrxociatoaDe ivo s setr(r oy4lleelfci (  rra(rono4aexo o3iatfs ul(mp;() lenifciytfmtrauvs s0 2xoxopio4lptelietatf Duaxm no4olx ifcildfaDrmn snt)alxnir iy1lp e iei;s)s2xr(r3oo1altn fct (  Dtax  ou4ope mfctytlaDelu o;u0 lenxo oydop eaies;(  rtrxr3nu4ll nlfesas) rrmumo;u4teeomfeiad aDul( pnt4 ltnmf3oatlmteluvil(0sruoxm3no1op n icslt  rrax  nt4ape mieildlm2el(vpnt) lxnmr3tytopteanes ( srum(m ny1ap   ncsas  rrr(moot0olenifetyt mDrlnmo u4aexomf3ootfatelu i ()trum(rpoy4altnmfvt tfsDrmuro;t0aetoio3tlsfa ranmo t4arxrir tatlp eaivolt) 2tr(o iy4om n fes ()aDuru  ;o1ape mf3tydfs rmnvo ()trtoio oa1oa  ln i;t)srur(opno1ol nlfeta( aDtmxro;o1tle miciltls2eluvon(4tleoio oodlmteanei;s sexmxr3iy4ll   feta(f Dtmu  ou4olxniieiydfaDrm(vpnu0 lxnio3oodlm elnei s)teto(r3no1am  mnes (faDum( o;o0apenio3tldlmDra(ms;u)alerxo3tytomteau i;s  2uoxm3iu4lmen nvi s  Dur(rono4alxomfeilslmDeauvpn()tleomociytlmtelu o;t  rumio3oudol   ncilt sDrax onu1tlenifetyd m2um(vo;u0altomo totlmt  n s;(0 rtoirpio1optelfviat  2um(r oo0aeenmiciyt sDem( s;u4altnmfcia1oa elnvo s)seuriopnu1ale lics t)srtaxrpou1oltoiictadfaDea( o u4alxrxr3ia1opDe i i (0setr(r3oo1al elietat)sDrm(rpou1oeeoio3iatlm el(ms u)treriocto1oaDraies s0teur(opno4lltelfcs t)a2rr( poo4oltoii3tlt s2em(mp ()alxoif3oa1op e neslt)teuo(mpoy1lltn ict s)aDraum ;o4tlxoifeiat m2eauvs ()tltnmfcoa1oate uvolt  2tmirpou4oleelietlsfarra(ront4teeomo3iyslsDeau sn(4texrxf oatlp rauei;s0s2xoxo3oy4ole  fesl(fsrurumoou1tlxoiictytlaDemuvp t) rerifciytomDeliesl(0srtoxr3oodol elfet ()a2uaumpnt1tpx iiciytlm2rmn pnu4 etrxr tydoptr u o ()s2uoimpny4lptnlivtl( a2ur(rono0teenmfeiad s2el( s;t0aexnmfciy1lpteanvs t t2toxr3iy1ll  mietls srrr(rpot0aptnmfeiltfm el(vpn(4 exomr3iydop eaies;(0 2urxopoo4olt  ivtl()srraur ou1tptn f3iadla rmn o u0tlerircoy1fatraies s)trto(r iodlm  mivta() rrrurooo1tex mociasls2emu p;t4 etrxr3to1fm  lnvs t0trumiopiy4olenmivtltfsrua(r ;o1oleomi3iasfa2uau snu)aetoxrctodoaDeli ol()sexm(m3iydap e nciasfsDtm(m nt0tleoiiciltfmDelnvo;t0tltnxr3oytlaDraieil(  rxrxr nu1aptnlivi sfarur(  oo4opx ifetldfs eanmo;t0tlxrxr3oodfpD liei t)t2ur(m nu1ape mfcs s  rtauronu4apxnmiciatlmDrlnvo (4aeeoxociadomtelu s s)trtoxm ou1oleemfes ( sDtmxront1aexomietld s2um(mo;t) etrio3oa1lpD  iei;t0seurxr nu1lle  fci t aDta( oot1tpenio3iad a rmump t0aeeoircta1opt  ivs;t0seumimpiudaptn fcs sfarur(rpnu1tlenmiciat aDrmumo (0artrir3oa1fmD anvs t  rxr(m oudlp  miesls) rtax  oo1aetoio3ilsla2el( pnt0 exoir oodlaDraiei;t)t2xm(m3iy4op e icsatfarra(  ;t1tpxomi3tatfm ra(mo t)trxoxo iatom  ln sls0texmxrpou1opee nei s  2rmum ;o1altn ieiydls umuvpn(0 lenio3ootoateanvsls)srtm(rpnydamt mfvta( sDum(mpoo1aeeomi3iatla2rlump;u0 exrxr3ootopD lneilt  exo(o3iudlm nlivslt srua(  ou4tle moeiltfaDemnmon()treoxf todfm rau i ()srxrxo oo1amee icsat aDur( oot4oetniieiysfa eanmsnt) eeoxfcoodlp   i o t  2urimpno4om n fcilt  2tm(  ;o1apeo ociyt mDrln s t0 etnmf oydfmDranvil( t2urxo iodame mnvias)srtmumont0oleoiiciytfa eau onu0texnmrcta1late uei;s0trtrxopiu4ll n nctl()s2tr( pno4oee  o3tlt a emuvpnu)artnmrciodlmt  uvsl(  rurxm no1am nlfcilsf Drrxm ot0alt mi3tasls uan pn(0 exnmrcoa1opDr ivs s0s2tmiopiudlleelfctasf 2ur(  oo1tlx mfcilsfs2uanvsn(4 rtoxr oo1faDrlues t)texmio3oudll   neilt srra( pou1tlxomo3ias mDumn snu)aetnmf3io1lpte ivsls s2ur(m3no4aptn fvsas)aruaumonu4altnifeilsls um( pn(0 rxrmf3iytfa  luesls srtoio3iy1omtnlfvtat)s2rmxr no0alxomf3tld mDran onu0tltrmfcoodlp   u i s s2urxrpiydlltn ivt s s2ur(mp;t1tlt iietasfs ra( p;u)teeoir3iatfa rliei;(0sexr(rpno1lpee fvta( aDta( pno4texoifcils sDranvo u0aexnmr ta1fm r uei t t2toim3nudlpe lies t)sDtrxro;o0aeen feiadfaDrmnvs;t4 rtoxocoodom  anvo (  rxr(m iudol   fvsa()s2tr(rp;u1aeen fctysfa rmnmpnu0 leomr oodopt au o;(0t2tmxr iodlleeliet (faDtrxm nu0apxomfeilt m2umnmonu0arxrir iodfpD anei;( s2xmxo nu4ol  mncsa()a2um(m no1apt mocils a eln on(0trxoifciadlp  luvi;s) rtmxo3iy1lle  fvt (f 2umxrpnt1oleoiictldls eanvp t0 eermo totomDrlnvo (  2trim3nydomee fcs (fsDta( o;t1tlxnmf3iysfa2rlu s;t)aexnir3to1oat  nvi;t)texoxopio4amenlnvtlt a2ur(  ;t1tlxomfetlt mDemnvp t0 rtnir3ootopDe iesl(0seum(mpiudapt lfes (f Dtaur nt1olenifciltfaDelu s;(4 rerif ootla  livsl(0 2uoxm3iodal  lnvsasfartr( p;u4oex ifetasfs2rln s;t4 lenif iy1laD luei t setrxm3oudom nliesls  2umxm ;u4aexn oeiltla2ul( o t0tlxnxrctytfpteauvi;( s2trirpoy4opeelfctat  2ra(rono0opx  i3tadfmDrlu o;(0texoio iatomt  u i;s  2uo(o no4lp  lieta(f 2raxr ;t1olt iiciyt a2emnvont4 lxniocoy1lp  anvs t  2uoxm oy1olt lics t  Dumxro;o1ape  i3tldfm2eaumon(0 exnifctotopteaies t trxrxm3iu4op elivta( artm(rpnt0texomiciyslsDulums;t)trxnir3oy1oaD  uvi s0seumxm3nu1lp elfeia() Drmxrono1teto ociysfa uluvp u0 rxrir3iadom e neol(0srtm(rpnu4omee ncia()srtmu  ;o1tptnmoetldfm ua(mo (0teenmr oadomDeai slt seto(opoodamt lneiltfaDtruroou1opeomociadla2rmnmsnu)tlermf3tadlp   nvs;s0srxoxr3nudomeelfvi t)sDrmu  no4tpto ociysfm umumsnu4trxnmr3tatomte ieilt)trtoxrpiudap e nvsa() Duaumoou4tlxo ociatfs rauvs t)tetnmr3oa1oaD aneols texoio nu4am elivias  2rmu o;u4ale  o3ilsfa2emnms u4 reomr3to1faD li s;s)trxoimpno4lpt  nvils) rtmu o;t0tet ifciatfa elnvs t0tetnxf3todlpD auesl()sexoiopny1apeelnctat arrmumpno1apxn o3ilsfm2ul(mp u) exnmfcootlaDeluei;(0tetrxr io1opeemnctlt)s2tau  ou0tpxnmo3tadfm rlnvsn(0 lxomf3iodlaDrluvs s tetoxm nodal  lfviat srta(mp;u1tlx mf3tld s2rl(vs;t4texrmr3io1lp elnes t) euoxr3iu1lmenmfctltfaDta(rpoo4ale ioctadfm2rmnvo;t)trerif3iotlmtr n o ()s2toirpnudomeemncs t) 2tm( oou4opx ifetydfm rln p;u4 ltrxo3iodoaDrlueo;t  2xoio3nu1lptnmncsltfsrrru ooo0alto i3tlslm2eaumo;u)tltniociotfp eanes;( trumxm oudoleelics s)a2urumpnt1aexnmociasfs rlu p (4 etnmr iadlm r uvo s texmxm3oodll n fctatfsrum( poo1olto oeiat s2rlu p (4teerxo iy1fm  auvslt)trxmirpiudlme  ncta(fartaxmp;u4tptoio3ias s ul( snu0 rxrif iydlm   neslt)srtrxm iodap nmfei t)aDrmxro;t0aex if3iatfaDrm(vs;()trxrxocia1lm   uei;s teurxrpoy1ap n fvsl( s2uaxrpno0tpe ifetaslsDea(vs t) lenxr3tytlm  anes;(0 eum(r oudapt  fviat sDrr(r no1tleo f3tldlaDrm(mpnu0texnmrciodlp ean ol( seumim nudope mfci tfsDrmxroou1aex io3ias mDrm(msn()tetoxfcta1om rauei t srxoir3oodamt lict ()srrr(monu0oet mfctys a2el(von(4 reoxo todopD  u ils teuo(o3no4alenliciat srraxront4aleo oeiadfmDuanmpn()trenir3iotomte n ils)texmxo3iu1apte fvsat srumx ont0tlt ioetlsfa2umuvo t4aeerxrctytlmDe ivo;()t2xmxm oy4ale micsat  rrr(ronu4tpxoioctltfa2umn s t4tetnifcoytfm  livo;()t2xoxm nudamtemieslsfsDurumono1tex mieilsfmDeanmp t) rxnmo iytfpD liesls0 2xmirpnu1lmtnmiviltfsrua(mpnu0tpe mi3iytls em(mont) rxrmr iydomD  uvsls0s2xrxo3ny4om nmnci s a2uax o;t4tlto f3iatfs2ra( ont0trxrmf ta1fpteauvolt0srxr(rpoo1lm   iei t s2umxmpno0oexomieils mDrlu o t)trtnxr to1la  aueslt)tetrir ou1apeelivtat)s2um(  oo1oltnmoeiatfmDeaumo;t) rtrmfcta1fa eaieo ( setmir no1llenmiesltfa2umurpnu0apxnifeiasla2emn o u0aetrxf3iadomteanvi (0 exoim3io4amt lncsa(f 2rr(moou0alt mieiltfaDrln p;u)altrmo3ty1la e i i t0 etm(r3ny4lptnlivsl()srrm(mpnu4tpxnmo3tlsfs emu pnu4 rtrxocoadfa eau sls)trxoxo oo4ll nmiet t aDrm( o;t0aeto icilsfs eaumo (4aeeoxfcootomDr nvi t teurim no4ole mfct s sDumurp;u1olen f3iydla umnvpn() etrxr3tatoaD anvo s)s2toir3ny1lmeemnct ()arurxr ;o0tlxoioeildls2um(ms;(0aetnxocta1op rli sl( sruoxm no4om emnetltf rrmur ;t4opxoifeiyd mDumn on()tlxnmr3totfmDrlnvs;s0 etoxo3oudop nmnvsltfs2umxrpno1apeoifeiydfs2rmu o;u4artoxrcoo1optranvslt0s2urxr3oo4lme  fvs s) Drrumo;t1tetoii3ildla ra(vo (0tlxrifcio1fa e iei s0t2umio3iy1lpt miet t) rtauro;o4tleomf3iydlmDum( p;u0 lenif iytfpDe ivs;t t2tmim nodamt lfcsas)aDum(ro;o4opxomo3ild a2umu sn()tlenmoctydfateli ol(  exmim3iy4amte iviat  rtr(  no0aex mociysfm ra( o u0tlxnxocto1lp rau il( t2xm(rpou4om   nvtl(f rraxmoou1tpt iieilslm2rl(msn(0 leoxocoo1fpD livslt  rumxm oydlme mnviat) 2rmum oo0oleo f3tld s ul(mpnu) rtoiocoy1laDran olt)t2tmio ou4ol   feslt)s2trxrpoo0optnmieiltla rmu p (0 ltomr3ta1fmt au sl(0seumxo3oodop nmivtl() Drrxmonu4tleoio3tys aDua(mo t4 eeomf3totfmD  i ilt0seto(o iu4am e ncsltfsrtm( p;u1opxnmi3iydfm umnmp;() eeoxfciydfpt  i olt texoxrpoydale lnviat)arrmumoot4ope  fetatla rau pn(0tetrio3oodfmtraieo;t s2toim3oo4al nlncias s2umu onu0oltoifciatfs2rl(vs t4alxoxf iydlmt  ueilt)sexrir3iudalenlnct ()sDumx  ;u4oeenmfciys s2elnvp;(4tetrmf iy1omDeli i ()t2xmir nu4ll n fei sf ruaumont0oeeoioeild mDrmumpnt0aexoioctadop  livo ()sexmxrpiy1lpte icsl(  rtru pou1tpen octad m2rln p (0altoxf to1lpteln olt0teuriopnudaptnmnvtltfsDra(m ou1opxoifeiyslmDrlu p;u4alxoircoodfmDran olt setmxr3io4op emnvtatf 2trumonu0tet  ietldlm em( onu4tleoifctydfp elivils)sexmim3oydopeemicia(f 2trx ono1tpt  i3iatfs2um(mp;t0 rerir oadlpDeaivi;t trxmio oo4ll e nvslt srta(mo;u4tlt moeilsfm eanvp;t)altnir ia1lat livslt0sruoxm3oodomeemfei (fa2taumpou4olt mo3iadfa2umnvo;t0texomr iotlatrlu i t)t2tm(rpiydopenmies (  Dua(ronu4opxo oetytfs ua(mp;t0teeoif3ty1fp r uesls)setrio3iy4llenmnviasf rra(m ;u0tlt ii3iydfs umnmpnt)alenio oydoa eanvo t0teto(opoo1oltnmieiatf 2uaumoot4tpt  f3iad m uauvo t)artomfcoy1lm   ivi;() 2uoimpnydolt mnei tf rrrumoou1aptn o3iaslmDea(vsnt) etnxr3oa1omte iei;t0s2uoir no1lpt miciltf Dra(ro;t0oeeoiiciad sDumnvont)alenir oy1om eanvs;t tetoir3iu4al   ivtatfaruax  nt0aptn oeiydlaDem( s u4arerircia1lpDrlueols) 2xrir ou1lpt mneiasfsrtaurpou4aeenmi3iyd a rlumon()trerircoo1fm r n ils)t2tmio no4am elfeilt)s2tr(rpnt4oleomoeiad a2em(vs t0aetoxf3iodfaDrlnvslt0s2uoxopnudlme mnctasf Dta(m ot0aeeomoctatfaDrluvsnu) rxoxo iodlm  livs ()trxoir3ny4opeelfci ( aDumump;t4tltnmoetydfa2ul(vo;u) etrmr3oy1fptrlnei;t srumiopnydll  lfvi ( srua(rpoo1oltn i3iad s2rln p;u0texnmf tytfaDe nes t)trum(r nudlmenlnvt tf ruauro;t0tpxnmoeiasfaDumnmp;() rxnxr io1fat  u i;s tetm(m iu1am emfes s) Dtru  ;u1oeeo fciytfs2rlnmon(4 exrmoctytfatrlivi;s0s2tmio3ou1oleelfcta() rrmur ;o0alxomo3taslmDrmnvp u0 ltrxociytfat aueo;s s2tmio3io1apt mfvs ()a2tmxmo;o0tpxn fciydlm2ranvpnu0tltrxf ootfaD lueils)srxrir3oy4amtemnciat)s2ur(rpot4tetoiieiyt mDem( o;() ltomf3ta1om  aieo s)t2toir3iu4am   feilt a2taxrp;t4tlx  ietas m eau ont0 eenmfctotopD aivo;s0 etrim no1opeelivia(  rraump;t0ope ii3ils s emnvont)aleoifcta1fm e u i ()t2xmimpiy4op elfeil(f rta(  nt0olxoiieilt a ran o;u)trtnxo3tadfa  lu ilt0 rxoxm3iudope  ivt t)s2tmu p;u4tet  f3iasla ra(vsnu4tleoxociodfpDrlnesl(  etoiopny1lltnmnvslt s2tm(mp;u0texnio3tadfa2elu o;t0 lerifctatfpDr uvi;t0srtrxo3oy1ol emfes ()arra(r ;o1tpe  iciyslmDrlnvsnt0altrxr3tadoa   uvo s sruoio iudale lici s  2umx pot0tpxomoeilsfm2rmnvs t0 ltomo ty1oatelieslt) 2xrxrpio4lm nlfesl( srtmxrono4alxn ietas aDea(mp;() eeoxf3iatlmtraiesl(  ruoxr3ou1oltelfeiat  2rmxrp;o1olenifetlt s2ra( p;u) rxomociy1fp   uvi t0 2urxmpnudoltn fvs s  2ra(ronu4tlxnmieiytls2ulu o;u)tetnxf3ia1fmDelneo;s  2uoxr iu4ol emfes s arrmxr ou4tptoii3iytlsDemums t4 lenxr3iotfat luvsl( s2um(r3ou4ome mneiatfarumx onu0tet micias a ulumo;t4tlxrxrciatfaDe u slt)t2urio iodam  mfei s)a2tm(ront4oleoifciytla2em( pn(0aexnxf iy1faDelnvolt)t2tm(m3iu1op  liet t arum(m ;o0olt iociydfs rl(mp t4areoxr ootfp eaies t0trxmxopio1ale licsa(fsrrrx  oo0opeo iciytlm uln o;u4treoxfciydfpD au o t s2tm(r oy4lm e icsas)aDraurp;o1altnmiciasls ua( pnu0 rxnmrcty1omDrlnvo;(  eurxm nu1llt mies t)sruaumont0alto feilt mDua( snu)artrmociotomD  n olt) rumxo io1optn nvs t)artrxmp;o4aexomf3ilsfmDem(mpn(0 etoir tytfaD luvols seuriopnodop elivt t) Duax oou1ape mociadfa eanms (4teerifcoatoaDrli i t srtrxr iu1lp  mfeia()aDrrum no1oeenmi3iad s ulnvsnu4arxomocia1fmDr ivi;s)trurir oo4om n nvsls)a2ra(mpnt0ole if3iaslsDuanvs ()tleoxo oydla   u s s)s2urimpoudom  lfei sf 2rau p;u0oeeo ieiltfaDelu p u4alenmfcoytfmte neslt0 etoio3iu1lptelnvtls arurur ou4aleoii3iadfa ea( p u0 exoxrcoy1oateaneo;t0srtm(m nodlme lnctatfaDtm(rp;o0ale  ociyd a2umu p t) leoif3iotlpt  ies;t)s2um(m oudlmt lfvi s  rur(mpnt0oex if3tytlm ea(vp;(4trenxoctodlp elu s (0 2urxm3oo1al nlfvtls s2um(r ;t0aet mf3tasfs2raumsnt4areniocoydomDelnvs s) rtoim3oy4lmtnmictatf Duaxmont1ape miciys s ran o;u)trxnxr3oy1fp rai o;(0 2urxo3oo1lmtnlfesas a2rm(moot1tlenifcilsfm2elnvsnt0trxnifcoy1fa  an slt0s2xmxm3ny4lpe  ivtlt)a2rrurp;o1apen ietat s emuvp u0 etrxf oa1lp  livs;(  2trxrpnu4lleemfvtl(fsrtm(r no1apx mociydfa2eauvs t)aetnxocty1lp rlieo;t) etrim oydll  mietl() 2urxrpno0alt  oeiytfs rl(ms;u)aetnmo iy1lptr uei ( trxm(r iy4lme  fviatf rumxm nu4opeoii3tys s2emnmo u0 rxoio3iy1faDeaneil() rxrio3no1oleemnetltf 2rr(mpot4alxnmicild m rl(mp u4 reoir3oodlpDeau s s0 2toxm3no4amtn fes sf rurxrp;u4alx mfcildfs2uln ont4 ltrxo tadlmtrlies;s0 rxm(o iy4ole  fesa( srua(mpno1teen oeiyd m ea(vp;t)aeeomfcta1omDeaneo ( srxmxr oudol  mnvsltfaDtm(r oo0oexo fcilsfaDuau p;u0teeoifciotom rlues;t)s2uoxm oydlp e neiatfsDuru ont4aex  feiad m rmumsn(4 exoif oodlmt au ils) rxoxm3nu1op nmncsltfs2tmxmono1oeenmietyslm2emu p;u) renmo3iadlate ivs;s s2xmxrpiy1lp   nes (fsDrr(mpoo0tpenmfciyt m rm(von(0 rtnxf oodomt aneol(0trxm(r no4alt mfvt sfs2rmumo;t0aleomi3tadlmDel(mp u4aetnxo3oa1lmDeai i ( t2xr(m nudol  mnviatf rtmxront1opxn o3iysfaDrl( p t4artnmf3oodopD  ieils) eumxr3iu4lle lfes (f Duauront1oexniociydfa2ulnmonu4tltomf iotfp rauvslt)t2uo(r io1opeemneiat) rrm(m no0altnmf3ilt s um( on(4trenxo tadoat lneols)t2xoiopnydameemfetls)a2ur(rpot0altnmo3iadls ra(mo t0aexomf3iy1fp  li o;t) eurxr nudlltnmies t) rtmxmp;t1optn octasls2ra( p;t4tetoxf3oytfa r nvi;() rtmxrpoo1aptn ncil(fa2uaxr ;o1olen f3ias s2umumpnt0alermr oadop ranvo;(  eumxrpnudlpeemnvtls  Drrx ooo0tlt mf3iysla ulums;t4texrxf3ty1lp ran i t) rxmxrpiu1op n fesa(  Drr(mono0openio3iydla ranmo;(0trxoxocty1laD  ues;s teuo(r oudamtemfvsat)s2taurp;t0aex if3iadfs2eluvs t)artnxo3oytlp e i sl(0teum(m nu4lleemfvta()sDum(r ;t1teen oeiysfa2ra(vonu0 rxnmfcoytop rlnvolt)sruo(r nydlmte fvi t)srua(m nu1opt  ictltfm ulnvs u4 ltomf3oadlpD lues s) 2ur(m ny4ap  lfeil(f 2raur oo1ale iieias sDea( p u4 reoirciodfa raivi;s  2xoio3oudap emfci t)sDta(m ot4olxo ictldla ul(vo t0altrxo3tadfpt anesls  etmim oy4amenmfeiatfartrxmpnt1ole  oeiad s eauvsnt0 rtomo iatfmDr neils) 2xoir iu4oltelicta()sDraum nt4olxoifcilt aDrlnvp;u4 reomociy1fpte ieils trtoxrpoudome  net s sDurxm nt0alxoiocildlm eauvo;u) ltrif3iodlate n s (0srtr(o oo1lpen nei s srua( onu4tlxoiictltlaDelump;(4treoir oatoatrln o (0s2xoir3nu4lmtn nvtltfs2rmxrono0oexnmfcilsfm umn o t)teeoxocoy1lat ln ilt)trurio3oy1am   fvsl(f 2tax pou4apxnio3iat sDea(mo (0trtnmf3ty1omtrauei;()s2xoxr iudol nmncia()aDrm(r ;u4tlt ioeiytfs2ea(vsnu0trtomf3iotfm raiesls)t2xmio3nu1om  mnciltfs2uaxmo;o4aetn iciydla ua(ms;t4tlenmo oatomDraueil(0seumio iu1ameelnet s) rur( oot0tetomi3iys m2ua( snu) rermo3tydfa e neil( trxo(o iu4llen ivtas)arrr(root0alt  ieils a2rau s u)aexrmo todlmD aieolt0 2xrxr3nodoleemnci s  Draum nt1olenmoeiysls2rlump;() eenxfctytlp eliei s0s2tmxr3io1opt  fet t a2ur( pnt1tlt iiciadfsDrm(mo;(4 reoxo3io1fm  livsls)s2umir3iodoptemiesl( aDraxmo;o0tle moetldfa emu onu0 rtoxrciy1opD auvslt) rxrir oydomenmfcias) rrmxroot0teeomoetldfs2ea(vp t0 ltrxo3oodoaD  i s () etmir3nu4op   nct s  Durxm ot0alx if3iasla ul( sn(0tetnxo3oo1fa e u sls0 2uo(mpou1omt  nvil()arur(m nu4oleoifciytfaDul(vs;u)tltrif iodlpDr uvo;s  2trxr oodlle mfvi t)aDtr(mpnu0tptoif3iyt a2um( s;()aetrif3oodoptelu sl()s2xmxrpno1omt  ivils aDrr( p;t0oex mociat s2ranmo u)tetnio3iotlmDeli i;()trtmxrpoudom n feia( s2ua(rpnt4ale mieiadla elnmp t)arenxocty1lmte neolt0texoiopny1alte fcil() Duru  ;o1tltomo3iasfm ua(mpnt) eenmrcto1om e ueo (0teum(m oudll  lnvtlt)a2rrxmp;u0teto octadlmDuau p t0altrxf3iotfp rlivols)t2tmir3nodlmtnmfctls s2tr(r ot1aeeomo3iydfs rmu snt0arenmo tydlaD luvils  2toxm nu1llt  icsl( arrm(moot4tlt  o3iadlaDrmnmon()aexomr oatlat  i s t  rurimpnodame mncs (f Dtm( pou4altoiietyd m2um(vs u)alxrxf iatfptean s;t) ruoxo nu4ap  lneilt)arrrurp;u0aeeoifeilsfa uanvp u4 reoxr iodfm   uvslt0s2umiopoo1amt mfeias)artaurpnt0alxoifeilt s2em( o;(4 reomf3iotoa eaivs t0seuoxo nudll  mivtl()arrr(  nt4alxn octltfa2emn o t0 rxnio3to1opDeaivsls sexm(o3ou4apee iviat)aruau  nt4ope mieiltfaDra(vs u4tltnmo oadlmte ueo;s0 2xo(r nudomenlici t)srumxr nu0oexn oetasfa rln o ()tlxoifciodfpt lu s t0 2trirpou4lmt  fetas aDur(  nt1olxomociatfsDumuvp;u4teeoxr3totfmtelnvi;s0sruo(mpoodlm nmfvs t)s2umxmonu4tlxoif3tad a em(vp;u4aetnxo3oodfpDrai sls) 2xoirpiodomt  iciatf 2rr(rp;o1opeomf3tyt a ea(vp;t0 etnirctadfaDe n i;(0 exr(m no1omtn fvi t)srrm(mpnt0ape  ocias mDulnvont)aeermocoadlp  li i;(  euoir3iy4lp n ivia()srtr(r nt1tetoio3tysfa2umnmo t4 ltoif3iodoptelivo;t0s2xm(m iu4ale micils arra(moou0apto ieildlaDumnvp t4tetniocto1fp rau i;t) exo(r iy1omt  net s)arta( o;u0oetnmo3iasfm ulu s ()tetnxocoodoaD aies;t) 2uoirpiu4lleemfvi ( s2ta(root0aptnifcildfm2eln s ()tlxoir iotoa raieol() rxrim oudom nliei s)s2tmumo;u0tee  f3iadlsDrmnmsnt4 reoxr oa1fm r nvilt0setmir oy4lmtnmicsas) 2rmx  nu0opeo f3ildfs rau s (0alenmrciadom e nvi;(0t2uoxmpiydolee ict t  Durx o;u4aet mf3tytlm ua( onu) rxnmrcoytfptrlu i;s0 rum(r nu4amt  nvs t sDrm(m ;o1tex ioctys a2emnvpnu4arerxr totoa  ai s;s)truoim oudamt  nvi t) 2trur ;o0olx ifctyd mDum( o (0artrmrcoa1lm   ivs;( seuo(r3oudlmtemfei s sDua(rpno0oexnio3tytlm2eaumsn(0alxrxoctadfp r neo;t)t2tmio iydopeemics (fsDumx oot1tet io3iydfm2rau onu0 exnxf to1lm e n o;( sexrir nu4oltnlfct tfsrtm(moou0aptn ieias s2eau snt)arxnxo3ia1omteaneo t0 rtm(m oudomtnlfet t sDrr(rp;t0oetoif3iatlsDelnvp t0trenmf3totfaDeanei;t)t2uo(mpiy4apt mivslt)s2rmurp;t0oexn ieild a el(mo u4texrmrctodopDelivo ()srxoimpoo4lp  mivslt s2rrx ono0aeenmiciasfs2rmump (0aexrio iodfpDeanvi;s)t2uo(rpnu4omte fvsltf Dta( p;u4tpeo i3tld sDum(mon()trerir3ta1opDr nei () 2xrio oodam e ncslt)aDrax pnu0apxniieias aDrmuvpnt)texoif3ty1lpD auvsls0 rxmxm3nu1om   net t  Dra(m nu0oltoif3iydfa2em( o u4 etnmo3iotopDraues s  eum(m no1apenlivia()s2urum ;t4aexnifctaslsDelump;() reoircootoaDeai s;()texo(r io4om  mfeia(farrrurpoo1tptniocild s2ra( s;t0tltnmo3ia1om eau il(0 eurimpiu1op   icsatfa2um(m no1aetoifeiasfaDrmuvs u4 lxnirctytoa e neols)srur(opnu1optnlfcsas)srua(  oo4opt iieiatfaDelumsnu0 lxrircia1fp r u o t setr(o nydapen ivsa(fs2trumoot0tptomf3tydlm2eauvon(4trtomo todlp e neo ()s2toxr3ny4lmtelnetat)sruax o;t1aee if3tltls2ulnvp (4 ltrxo iydfmteanesl( seum(rpiodoptnlivsls)arrr(mo;u1alen ietld sDrlumsnu) exnif iydfaDran o ( truoxrpiodlltemfcsa( a2tr(rpot0oetomi3tyslaDea(vp;()tltoifcoa1oaDrau s s0t2xmio3nodop nlfvil( s2umxrpou4tleomi3tadlm2eauvo u4altomr iydfmt  u ils0s2trxm3oy1amtemfcs t)srtaxr ;t0tltn ieiys s2elnvp () rerxo ty1oa rlieols)srxrxm nu4lmt mfesltfs2tm( ont0aet  i3iys s ul(von(0trenxo3iodfmtr ivils0t2to(r nu4ol nmietls  rta(  ;t0apx  i3tyd sDul(ms t) lxoxr tatlmDeaueolt srxr(m ny1ol nlnctasfaDtaur ot1olt ifeilsfs eau p (0 rtrxf3oa1fmD anvilt0s2tmxm3no1omenlnei (faDumxm nt4aexnii3tadls rmnmp;()aetnmrctytoaDrlivo t0srtrxo iu1lme  iet s)s2uaur ou1apeomietysfsDuau on()aetrmo3oydlpt aiesls0texmio ou4apt lneils aDrm(rp;t4optomfeiytfm2um(mp t4 etoxr3ty1oaDelu i (  rxm(m3io4al  mivs ()a2tmumo;o4tpe mfciyt m el(mo t4trenmo3oadla  lu i;t0 euoim3oodll emfcsl()aDuau p;u1aeen oeiys s2ran onu0aexrmocta1opte ivo;t0 etrxm3nydoltnmivta( arum(ront1oet mictadls2rluvp t0altomociydfa ean o;( srtrxr iy4lltnliviat a2rm( poo4tpenmieiatfs2ulu s;u0trxrxo todomDean s;() etmim oo1alenmfetlsfsrumxrono0aex io3iysla rl(vsnt4 lxrmo3to1lptr ieils0teur(opou1ol n nvt t)arurur ;t4apeoiictadla2uanvo ()arxoxo3oatfpteaues;s)sexm(mpno1amt lneslsfs2rmumpot0aexoioeiad a2rlnmsnu4trtrir oadomtelieols)truoimpnodop  mfeslt) 2raxronu4oetn o3iad s2rl( p;u0aetrxrcoy1opt auvs ( trto(o3ny1amtelies t s2rmurp;u4tlx  octys aDem(vs;()arxrmociatfat lu ils) 2toxr no4ol  mnctl()s2tr(monu1aleoif3iyt aDrlnvpnt0aleomo iatfaD ln i;s)srumxm nu4lp eliei ()a2rr(  ot4alxnmoeils s2ra(mpn() eerxo3io1lmt  neslt  2um(rpiodap nlnct (f 2tmxm ou4aeenmfetyt s rl(vs;(0tlenifcoatlm ranvo () rtmxmpno1lmee ivt tfsrtr(r nt1apeomoctydfa2uan o;()arxrir3oo1opteaneslt0 2trxopnudam e ict ( aDumxrp;t1texo octydfs2ean p t0arxrxfcoatfm eanvols0t2xrio3no4llt mncilt)a2taxr ;u0aexnmoeildfm2eanms;u4alerxf3iodla e ieo s)t2tm(m3iu4aptnlicsls) ruaxrp;o0tet mi3ils a rmnvon(0trerxf3iotomDr nvi;t trxoxo iu1llt  netl(fsrrmx oou1alx  o3ild s ra(ms (4 rermo3to1omD  i il(0 etoimpiy1lle  neslt) Draumpou0apxn feilslm2uaump;u0 renxfcta1lm e neilt)srumim3oo4oltn nct ()srur(rpoo4apeomoctlt mDumumon(0aetomociydfpD  iesl( srtr(rpiy1lmte nvs t  2taum ;o0oet ioctydls2rmuvo;()teenxociatomDeliesl(  rtmiopou4lpt  icia()aDtax o;u1oltomo3iltfa rmu pn() ltoif iy1oatelnvsl(0srtoim nodap e nvtlt)s2rrurp;u1tle  ociasls rmu s;t)aleomrciy1lmtrai ilt s2ur(m3oo4lmenlfct () 2rax pot4oee ioetasla ua(vo (4aetnxrctotopD li s;t)s2uoxmpiu4am nmivtlt s2ua( pno1oexoifeiyd m2rl( s u)aetoxfcoadlp eanvi;s texoxr iy4om emnvias)a2ra(r ;u1aexoifetltfm emnmp;u)trtnio3oydlp ran i () rxrxr ny1ame  ivtlt  ruaxm ou0opeo i3iadfaDem(ms t0tetoir oydfaDrlu s t0 2xoim io4llen nvs tf 2umx  no0olt iictlslsDeanvonu)aeerifcoadoptranvolt  2urxmpiodlle livi t a2ur(monu1opx  ictytfs ulu o ()tlxnmociydlp rai s () etrimpou4lmeelfetat  2rr(r ou4opeomietldlaDumuvp;() rermf3oo1opDraivi;t0 ruo(mpny4lpt lfcsls)sruaumpnu0olx mo3iasfs2um(mpnu0tltnxrcoo1oaD  neo;()sruoir iudlpen fct s) 2tmu pou0oeenmietls m ua( o u0arxrmr3ty1opt  ies;t t2uo(mpoodome  ncta()aDrru ont4openmi3tytfa ua(mpnu0aetrxf oo1oa raneo s s2uoxopnydopt  ivs s a2rmum nu4alt mo3ilsls2ul(vo u0 exomf iatla  auvo s) 2tmir3oydllee neias) 2uauro;t4opxnifctydfmDrl( pnu0teerxociatfmteluvo;( s2uo(opio1amt  neilt s2taxrpoo1aeeo i3iytlaDemu o (0 rtnifcio1lp  an o;s0teumir3io1om  mfvta() 2tmumo;o4ape micils s2rmnmp (0alxoio3oodlm  luei;s0truriopiydop n fei sfa2tm( oot1opt mf3tlslm ua(vo;(4aexrmr oatom ranvs;s) rxm(o3oo4ape micsltf Dtrxrpnu0tpen ociysfs2umnvp u)teenmf oodopDeaneol()seumxo3oudoptemivs (fs2umu onu1tpenioctysla2rm(mp (0tleoxr3iadomDr u o;t)trxo(opiudop n ietl()s2tr(ro;t0oetoifeiytls ul(ms t0tetnircoodoaD auvi;t0sexmim3nu1om n nctls)s2trum ;t4aetnmiciydfm elnvp (0 rxniocoodoaDelu o;t0setr(mpiy1lpenlncia(f Dum(m nt4tpe mo3ilsfm elu p u4arermr3ta1opt  nes s  etm(mpou1omenmfet ()arua(rpou0olen o3iyd m2eanvs;u0 ltoircty1laDr i i;s0 rto(r3nu1lpt mics t a2taurpno4tpxo o3ildla eln p;() exnxr to1fat ln o s0texr(r ny4opt mnvsl(  rtmxr ;t4oltomi3ilsfm rmn o t4alxnmo3to1fpt  n il(0 rtrxo oudolt lfet s sDtaur nu0tleo feiydlsDelu snu) rxoifcootfmtr u s (0t2xr(mpoo1om  lnvsat)s2uru pou4ale mieils m rmnmp;(4treomo iy1laDeau s;( sruoimpiu4lm  mfcia( sDtmxrpno0tltoiictltfmDran p u4tltomr3tatoatrlu ols0 2trir3oy4am emfesl()s2ta(r oo0tex iieiytfm2ea(mpn(0 ltomocootoa  aneslt) rtoxo iu1ll   netls s2rmurp;t0olenmoetydfsDuanmp;t4 renxf ootomDrlivolt) etmirpoydapeemnei () 2taxr nt4tet  f3iad a2rmu onu0 eeomo tytop r u sl( seurxrpoo4op emncia( aDrrumpno4aleo ociytlm elums;() exoio3iy1fmD lneilt  exmir3nydlmtnliciat  2rm(mp;o0optomo3tat sDum( sn()aeeoir iodfm  anvil()t2xmimpoy4lmte net (fsrur(mpot1tee  i3tad sDrlnms;u0 rxomf3io1om rluvo;()setrxo nudal elfvt s srrmum ou4optoii3iyt s rmuvo;() lerxr ia1fmte u o;t srtm(m3no4ape lfct ()arraumo;u0aetniictasfmDulnmonu4 eermrciydfmDeau ils0trurim3io1amenmnei (  Drr( ont0aex iictydfm eln o ()aexrmf3iy1omD lnvi t0sexoxr3ny1amte nvsl() 2tmxrooo1aptn ietysfm2raumo;(0tltnif oatlat luvs t sexm(r iudaltnlictl(fartr(m ;o4aee mietasfsDran s;t0 rtoxr oatlpDelivs;t0 rxrxmpiy1op nlietl()a2rau pot1tle ifcias aDrmumo;()tltrmr3iytfpt  ivo;(0srxrxr3iu1al  lnes s)srua(rpno1tee  ocilslsDrau p;t4aetrir oatlmDeli slt0texoim nydlm nmfctl( srra( p;u0olto ociys aDuln p;(0 rtoxf3tadlmt luvs ( trto(r no1llenmneia(  Drrum no0tee  feiytlsDrmnmo u)tlxrxf3oadlmteln i () etm(o3no1lmtnmfciasf 2ta(mp;o0ape micildfa eln s t) rxrif oatomD lieil() euoxopnodllt  nvsl(fs2rmurpnu1olenmocias mDea(mp;u0artoir3iotla   u i () eur(r io4opt micsasf rrax  nt1tlx ifeildla rau p;u0texnifcoy1op  luei (0 rxmxrpoydaltelies (fsDra(  oo1texomociltla2rmnvp t) rxrxf3oo1opte i s;s0trto(r3oy1altemnvs s a2urxrpno1opeo oetlsls2umn s ()alxrxf oa1fa rai olt0setmimpoydap elictlsfa2ur(rooo4apeo fetyd mDra(vp (4tltrxrcootfaD li s;s  eurim3nudomtemieil(  2rmxroot0olxoifeildlm2rmnvp;t)aetnmf3iydopD luvs;s0sexrir3ny4apenmiei t) rumx  nt1oexnii3tatla2rl(vp t) lxomo3iy1opDrlivs (0s2xm(rpou1lpt miei s sDua(mo;u4texnifciyslm2ra(msnu0aexoircto1laDeauvo ( s2um(o3nydomeeliviltfs2taumpot1tle iociys m2rlu pnu0aexnmocoydomDeauesl( s2tr(o3oy4op   fesa()srtax  ot1tex ifeild aDrlu p;t)texrmf3iy1lptrlivo s trumir3no1ll nmivtas  Drm(mpnu4tltomfeiyd m ra(vo;t)artrifcio1fmDraies;t) rurir io1lmenlfcta( aDtr(r nu0tle iocilsfm2eln o ()aexnmfcoadfmte ues;t teurxr3oo1ape  netas)a2tmumpnu0oee micilsls2ra( pn(0tetrmfciatopt anes;t0 2umio nodape lfvt (fartmurpnu1alen fciatlmDra(mp t)altrxr ty1opDrli o t texr(o nu1om elnei ( a2rmxm oo1oeenmieilsfa ulnmo u0trxriociadlateaiesls) rur(rpoydol emneta( a2trxmp;u4tpe ioctas m2um(msnt4 rermrcootfpte n ilt  exm(r3ny4ll n fvsltfartrx ono0apen o3ilsfsDuln o;u0 rtomf iodlpD li il() exmxr io1llte icil(f Dtr( o;o1aexomi3tldfmDrl( o;t4tlenirctadopD lnvo;t  2xmir3iydlm n feias  rua(mpnu1teeo oetas s rau o t0 etrir3todlaD aivsls0tetr(o oy4lm elietas) Duru  nu1apxo ictltfmDrluvs t4arenxo ty1lm  lu i s srxrio3io4om nmnet (fa2ur( onu0tleo i3ils mDraumpn(0 eermo iatfpD ai o t)t2um(r iudape mnvs sf Drr(mpno0tpenifeiysfaDuan pn()tlxomfcoatfp e ieo;s0sexmir nodol   ivi tfa2tm(mo;o0texnio3ilslm umu p (0tltnxf3totfaD lneols0 2um(rpiydop elfeil(  rua(mooo0aet  oeiydls ra(vo;()tetoxfctodoaDrlu ol(0seumxr3nodop  mfes tfarra(r ;u1oet moeiyslsDeluvs t) etnio iadomDe uvol( seto(m3oudom elics t)srta(ro;o0oeenio3iytfa umuvp u0teenxo to1fpDrlu s t)tetm(r no1lp emiet (fa2rm(mont4tee ioetyt s umu onu)aetrioctodfat anvs s texo(opiydal nmfcia( sDtaxmono0ope mietlsfmDum(mpnt4tetomr tatoatrln o;()tetoir3no1optnlnvi ( s2rr(r ot1tlxn f3tld s2um( o;(0 ltrmf3ta1oaDeaiei;(0 rtoirpno1al  miviltf ruru pnu1aexo iciatfaDul(mont0 exomr3oo1lpte n i;()srumim3ny4omte iesasfs2rrurono1apen ieiltlsDua(mon(0aexoircoydomteli o;(0seumio3nu4am nlnct s  Drm(m ;t1alenioctldla2eau o u4aeerio tadomt lies s)texrxr ou1amen ics sfsDtm(ro;u0tpe if3iyd a emn sn(4tltrmfcty1lpD auei s0s2xrxr3iodap   fviasf 2rmurpoo0tpeo ociys sDuaumo t) etomo3oy1fm eauvol(  2trxo iy4ol emfcils)s2raur ot0tpx mo3tytfa2rl(ms t0tlenxo oy1fateaueo;( sexmxm nudll   ncils srtmx p;u4alt mi3iys a ul( o (4texnir3oodopt an ols0sruoxo iudam n fci s srtm(  ;u4tptoii3iys aDuan p u)aetoio oatomDelies;s0 rumxo3oy1omtemfetl( aDua(ro;o0tlenmi3iaslsDeaumo (0tetrifciadlptrluei;t)s2xmxm3oy1al nlnesl(  Durumont0tleo fcildfs2umums t0 renxf tatopD aies;( texoiopio1ol  lfvsltfsDraur ;u1tpxnmfeiltla2rmn p (0trerxocta1laDe uvo;t  rxrxr3nu1op emfesl()srua(mo;t4opxo oeiydfa2em(vo t0aetrircoatfm  lueilt  rxrxrpoy4lptnmivt ( srtmump;u0tee  i3iad m2ea( p;u)aexrmr3iodfp elueilt) rumio3iy4amtn ict s)srrruro;t0altomi3iyd a em(vs t0tltnmf oa1fpDrlu o s srtm(o iu4lmtnmfvtl(fs2ur( p;u4apenif3tls s2eluvo (0alxomr io1opDrlivi s  rxmim nu4alt mfeta()sDumxmonu1aptnmo3tad a2eln s;u) ltomr3oydfpDeauvs (  rxmir3ny1ame  netatfs2umumont4aet  f3tltfmDeauvo () rtnmrcty1laDrluvi;t teumxo nu4omen nctlt) 2tm(m nu0tltn o3tltfsDra(ms;() eeoioctatop  ln s;s trxr(o3iudlp nlivsat) 2umxronu4tlxnifcilt m elnvo;()alxoxr3oa1opDe uvo;t  2umim3iu4oltnmfet t aDtr(  ou4altomf3iadla emnmsn(4trxnif io1fp  an s;s trtrxo iy4apt micta( sDuaxrpnt0alenii3tad a2rlu on(0 rtomf3io1fm  lu i s)t2tr(r oo4lle mietat)sDurxr ot0texomf3tadlsDemnmpn(0altnxr io1lp  livo t)t2xrxrpnudlpenmnvtl(fs2rmurpoo0alenmociasla2el(von()arermo iytom   ivo (  rtmxo iu4altnliesas)aDtm(rp;o0alt iietls aDrl(vs u) eenxr oodfm  aieo t0t2um(mpoo4altelfcta(farur(r no4aeeomf3tatfmDel(monu0alxrif oy1oaDeauei s) 2xm(rpno4lpt lies t srtru pnt1openioetld m ulnms t0treomf tytomtr u s;(0trtmxmpny4ap  lncsas) 2ta(  no4tetn oeildls umump;()teeoxo iadom eaiei t0srurxmpou1ol emivtls)sruax oou1tltomi3iyd sDrmu pnt)arerio3oo1omDe n i;t0s2tm(r3ny1lpeelivtatf ruaur ou0tle iictls m rlumon()tlenxrciytfptr uvs ( seumirpoo1llt miet s)arur(rpoo4apx mfetysls eanmp t) rerio3to1om rai i s0t2ur(m ny4lmt  fvsl(fa2uau oot0apxnioctad s2ra(vsn() etoxo totfpD ai o ( texmir3iu1op  licsas)aruaurooo1tltnioeildfm uaumpnt)aeenxo3oa1fp e ivo t)t2xoxr3oo4omtnlfeiat sDrruront0tet ioeils s2umnmp u0teenxf3ootoaD lues t teurxr iudlpenmncsls  2rrxmooo1aet moeiyt s ulump;u4aexriocta1fp e n il( teuriopiy1omeemnvtat) Dtr( onu0oltn fciys mDelnmpnu0arxrxo3oytlm rai s;( srxriopny4op  mnvt t s2tax p;o0altnii3tatlm2ean p u4arxomo3ootom e ivi;s0srxrir3oudlleelict t) rtm( oot0tex  f3ildlmDua(vs;t0 rxnxf3oadfpDr ivi (0 rtr(m3oudlme mneta(fs2tmum nt1alenio3iytls rm(msn(4teeoxo iy1fm e uvi;(0trxm(rpoodopenlnetlt) Drmur ;u1tltnifeiasfa2ra(vo t4tetrxf3oytlpt  ues;s s2xrxopnu1opte nvsasfa2rrxmo;u1tet  fciydfs rlnmp t)trenifciy1fptranesls srtoxo3oydoltnmfvias aDua(rpno4opeoiictlsfm2ulumo;() lxrmfcoytoatrlivo t) 2ur(r oo1ol nmfesa(fs2umump;u1openmoetysfm elump () rermf3ta1lat lu ol(0trumxrpno4ap n net ()srumurono0aleomieiytfa2rmumsnt4aleoir3oatfptr i s;t  2trimpiu1omt  ncs (faDra(m nu4olxnifeiasfm elump;u0aexnmrciy1faDeauvs;(0t2ur(rpno1omenlnvtas)a2rmxm ;t0opx iociatlm2umn snt4 exomr oo1om e uvo;t0s2toirpou4lme mivsl(  2umx pnu1olto ictytfm2rlnvo;(4alermr oytop raueols  2xoxr ny1lptnmivt (f 2ta(mo;o4oexn i3iad mDelu on(0alermr3to1laD  nvi;t0seum(r3nudamen fcil(fa2tm(  ;o1tet ifciysfsDulumsnu) ltoiociytoatrluvs t tetoiopny4altnlici s srrrxrooo4apx  i3ilt sDrmu p u0altrifcoa1lpteanes;()trum(r3oo4omte neta()a2urxroot4oexn o3tyt mDrm(vsn() ltoxoctadopte n i;t)teuoim oudolt  fvsas  2tm( o;o1tlx  f3tltlm uan pnu) ltoxf tadlm  an o;s  2trxmpoy1am elfei ()a2trxro;u4tltnmo3iad m umnms t) ltnxfctydoa rlnvi;t  rxrxm ny4ll e fvtat) 2ur(r ;t1tpxn fctad aDra(von(4arxrir3oa1oaD aivs t)srto(o io1opeemfctl( srumxr oo1olto feils m rl(mp u0 ltrmfciodlm  auvi;s0trurxr oy4lleemfvtls) rra(  oo0tptniociadls2em( onu4 leoxf to1fmte ieols)s2xrxr iodlpeelfeias)srtax pnt0teeoioeiltfa um(vpnt0aeenxr3oytfmte n i s) 2xm(o3ny1alenmnci sf 2tmu pnu0oeenmociyt m2umn o t4arxnxfcoo1fat lneo;( sruoirpoo1ap e ivia(f Dtmx  ;t1altn fciys sDumn ont)tltrxf ty1lm   ivo;()seum(m3iodllenlncs ( srtr(mo;u1tpenmfcilsfs ua( p;u)altoxociytoa e iei;(0 ruoxo iu4al nmnvta()a2ra(  ou1tpe mociatfmDulnmp;u) lxrxf oo1opt an i (0t2xoir3io1alt mfcia(fa2umxront1texo o3iyt a elnms t0tleoir iatfaD anes ( s2uoirpnudol nmfvtat)arurumo;t0apto oeiadls ul(vp (0aetnxo3tytfp  anvs s0trtmxmpou1optemietat)artmxm no4olt mi3ildfa rm( p (4 renmrctadoatr nvils0 2xo(m3iu1ol e fetls sDumu ono4altnioetasls2rl(vsnu4 etoxf oydlaDrlivi;(0 eur(r nodaptn nei s)aDrmurp;t0aptniieiytfsDrlu on()tetnir3oo1oa raiei s  2urxo ny1altelivsa( aDurumpot4oex ifeiat sDeauvpn(0 rtnmociydfm rau o s0srum(rpoodlptn ieias)sDua(  oo0olxoifeils a2em(vsn()teermocty1lm eauvols)trtr(opiydllt livilt  2uau oot0oeto ocilt m2elnms u)arerif oatoaD auvi t0 exrxo3iu4am elicia(fsDrr(ro;t1alx iictlsfs ra(monu)teenio3tydlpD  uvol()t2uoxopoo4ap nlnet t a2urx o;u1apto i3taslm2ea(mo (4aetrif3ootla eanvi;( t2uoim3ou4op elfcs t s2tm(m no1tee  octltfm eauvpnu4texrxrcootlptrlu s s)s2xoim oydlmtemfci s)srrrx  ;t1tlx  oeiaslm rmn o;t4arxoxr3ta1lm r uvsls)trtmxrpoydlmeelieias)arrrurpno4tpe moetadlm2ranmsnt) ltoxo todfmt  nei ()trumimpnodapt mfetl( sDra( pou4olx if3iysfaDrmu o;()teeoxocoatlaD ai ol(  etm(m3oo1lp n iviltf rtauront4aexoioeiatlm2ua( s;u4 etrio iytfmt anei (0 rtm(o3nudllt mfvt t)aDuaur ot1oexomoeildfm ua(vs;t)artomfcty1lpD  uvo;(0 rto(opoodape mictlt) ruaurpot1altn oetyt s eln p (4 rtoxf3tydom
\ No newline at end of file
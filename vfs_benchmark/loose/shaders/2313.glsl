@@ -0,0 +1 @@
+neo t)tetoxm oo4omt lncsls artr(r no4ale  ietadla2ra( s;t4 lxnif iatom elues;()srxm(o ny1ole lfetl()srtm(m ou4aetn o3tasfaDulnmp (4aeenxr tytoa rlnvilt) exrio iy1olt livs tf rrrurpou0apen iciys sDelu p;t4 rxoxociy1fpte ieils)texo(r3iu4opte ieils srtm(mono4apx ifctysfs emnvsnu)tetrif3oo1fpte uvslt) etoxo iy1llen ivt s sDraxrpou0olxnioetls mDumuvonu0tlxomfctatlaD aueols)teuoxmpiodlpeelfcia(f Dta(m nt4altn o3iytfm2uauvp (4 reoiocoytlat anei t0s2umxmpou1lmt micslt)s2raurpou4opxomi3iyt m umump t0 etrxf iy1lptrlnes;s)t2uoxo3io4om nlneslt) rrmur ;o1tltomiciltlsDuau s;(0tlxomocio1lm e ueo t) rtrim no4llee fci t s2ur(r nu0teenio3iadlmDra( pnt)areomf3oodfpDeaivsl(0srxoxm nudaptemivtls)srumx pnu1aexn oetydlm2emnms;u4arxnmfciadlaDelneols0trtoim iodllenmncta(f Dum(rpnt4oltoio3iytfs2uanms u0aeenif oydfp elivi;()s2uriopoydlp nlneiat)a2urxmoou0apeomocias m2rlnms;u)aleomf3totomteai o s  2xo(r oo1ole  feias) Duaxr nt1olen ictatfmDuln pnt0aexomr oa1fm r ivo;()teuoiopnudlleemfetasfsDrmxr nu1apeo fctlslm el( onu0artrmo3iydoaDeau i;(0t2uoxopiodlpen iesa() 2ur(  ;u0teeomoctldlm umuvo u4tlerxfciy1opDr uei s)t2ur(r3oudll nmicil() Drmur nt1aptniieildfm rmnvp;(0altnif ty1fpte u ol( trtrim3io1lp n fvs (faDua(moot1opx  ociydfs2ra(vo;u4altnxr io1lm   i s t0srum(opoy4lpe mfvsas s2trxm nu4alt mfctatfa2uanmo;u)tlerif oa1fate uei s0 etrxopou4oltnmnvs s  Dur( poo4oexniiciydfmDul(mp;(4trerio oadfmDeaivols0 2uo(o ny1omeemiesasfsDum( onu4alxnmf3iydlsDrmu s t4trtoio3oodfmtrlu o (0truoimpou4lltnlnciatfarum(rpoo4aeeomfeiltfa2umn o;(4aexnxr3oydoatraivs;t)teuoxopnudlltnmict sfsDrr( p;o4apxnifetytfa ea(vsnu0 lenxo iydlptraivi;t0s2to(m iu4alee fetlt)sDtmu ont4optomietasls rm( p;()texnmo3oytfmDr neil(  2xrxr3io1llenmfeil( sDraxm ;t4oex if3ild a rmn o;()aexoxo3ia1fatrlneil(0 2xrxr oydape lfet s)s2ra(moou1ope mfeiadfs2ra(vo;u0aexomfcoydopDe uvi s0s2umio io4am nlivt s)s2rax onu4aeeomfetld a eln pn(4tltnxo3iotfaDrlueols0 ruoiopnu1altelfcsl( a2raur nu0oexoio3tadls rl( o;t) exnif iodla raueolt0srxrimpnu1ol nlivtl(fsrta(  nu1optnmociydlaDea( s ()trxoxr oadopte n i;t) eum(rpnodlmtnmneta(  rtmur ou4altomfetlsls2rlu on(4tetoif3oa1omtrauei s0s2uo(m oudome lnvi t)srtr(r ou1aexnifeiyd a ulnvsnu4alerir3tatfmDrli o;(0 2xoxo nu1apte nvsls aDur(mo;u4opxomieilslsDran o u0 lerxo oadla  liei;s0trto(m nudopt mncsat  rua(r ;u1apeoiociatla emumo;t4trtoxo tydfpteanei;(0sexoxmpio1aleemfetlt srtru o;o0oetnif3ils a2ra(mpnt)aexnir ty1fm r ivs;s  rxoiopno1ol emnci (  rrrxr oo0optnmo3ild mDea(msnt0aexnmocoy1optr nei s  eumir oudlmtemncia(fs2taxrp;t1optnifcias mDrm(vs;t0tltrxf ootfa   ivs s0texmir oy4aptnlnciat)sDrrx pno4tltnifetytfm emnvo;t0 eerxf iotfp elu o;t)sexmxr3nodlle  fcslt  2tm(rp;o4aexoiietyt a rl(ms;u4trxnmr oatfm rlues;s0 rto(o3nudlp e fct (farraur no0aetn feiadlaDuaumo;t) reomf ootlp eaieo ( srxmiopoy1lpenlici (  Dtaur ;o0opxoio3tytls rln pn()aexnir3oy1lmDe n ils texo(rpoy4omee ieiltfsruau pnu4tetoif3iysla elu p;t4tlxrifcoatlpte n ol(  rtrio oy1op emnetlt arua(roou1oexo fciatfs ra(vs;(4 etrir oy1oaD lu o;(0srxoir3nydllte feil()aDtr(rpoo4teeo iciasfa em(mo;t)treoxr tytfpteauvi s sruo(m3nu1apeemfvt tfartmuronu4teeoif3iadla em(mp;(4altrxoctadlmD aivi s0sruoxr3ou1ale mivs s) rurxmp;o1tpeoiociyd m2umnmp;t) rxrifcoa1la   ies;()trumiopio1aptemfesatf rum(r nu1apenmietlsla elu s;u4aexrmocio1fmDrlieils srtoxo3nu4lp nlnctas s2rau o;t4oeto ictadfm ua(mpn(0aetrxocoydfmD li sls)sruoir iy4lmt mivtltf rtrxmo;o0oet  fetld aDuln o ()alxomo3oytomtr uvils0 2xmxm nu4amtnmfvsat)sDrr(root0tptoifctasfa ulums u0 rxnxr3oatop  au o;s  2umio3nu4omtemfeil(faDtm( pnt0aeeo o3ilt m2emn p;t) exrmr oytlateluvolt) 2xo(m oodlptnmfciltf 2rrum nu4texoio3iasls rl( p;t)aexoif tydoa   uvilt)trurirpoudlpte ics t)arur(  ou4tpxnmfctyd mDeanmsn(0alxnmr iodfpD auvslt0 2tmxm3oodame lfcsl(  2uax oou0oeenmfeias mDuaumo;t4altomfcoodom   n sls0teumiopoydop nlfcias sDurx pot1tpt ifciatls2rmuvo;t0trtnmrcoatfptrlueol(  etmxr io4llteliet ()a2uaum ;o4tee mieiasla ra(msnt4 rerir tytoaDe n s s0s2urxm3ou4ll  mncta( srtrx poo1tptomf3tltla rauvo u0tlxoircio1lpDraueils0s2uo(m3iy1aptnmiet t)s2tmxm no1olxnifcilsfa2eluvp;t4 exnxrcoo1fa eanvils)s2umxo ny1amtn fcsasf ruau o;t1alenio3iatfa2eanmp t4 etoxfctatfaDe uei;t)seuo(o ou4optemfvt s  Dtr(roou1opt mf3iytfs ul(vs t4alxrxociadom elieil(0srxoirpoo4lm  micsl(  2raumo;t0ole  oeiyd sDumump;u)tltoifctodopt livols sruo(r nudapen fvsasfarua(mp;o4aptoiicils m eaumo u4 lxoir oodlpt aies ()texoxm io4al   ictl(fa2uaum no1aeeoioetatlmDem(ms;u)tetoif3ty1op eau i s t2uo(o3nodlmee iei ( sDuax oot1tpxomo3tasls emnmo t)tleomr3oodlmD aieo;(0t2tmxr oy1op nlfct t a2tmxronu4aex iictatfa2eanvs t) lxrxr ootlmt an o;(0trtrxo oo4llt mivs (f Draumo;t0alxo oetydlm rl( s t0trxomo oadopte uvo t  rtmxo oydamtn ici s)srurxr ;o0ale moeiat m rauvpnt) lxoio3oa1lp  auei s  rxrirpno4lme mnetatfa2trum ;t1tetnmfetltfs2eln o u4tleoif3iydom e uvils) rurir3ou4lpeemfei s  Dtmxm ;o4opxoio3ildla rauvp (0altnir3iytfm ran i t0 rtmio iodomee ieta()a2rruront4ope  iciltfaDulnms u4texrir3oy1fp   ueo ()seur(opio1aptelncsat s2rm( ono4oetomoeiyd s rln sn(4aetnmf3iy1oaD lu i s srtrim3no4lltnmnvsasfs2rr(roou1opxniiciydlm2rm(mo;(0areoxrcoy1omDe uei;()sruo(o nydopeelicsls) 2uax oot4aet iociysfs2rlnvont4tlxnif3tatfmteln ol(0 rtm(r iydap emivs s) 2trxrp;t1opx ioetyslsDuaump u0aeermf iodfat aieolt trtmxmpio1ap elivt s  2ra(rp;u4tptn ocias s2uauvo u0 ltnxrciotfpteli i;()trxo(r3nodalt lietatfarta( p;u0oleo ociyd aDulnvpn()tltrxocio1fate i s;s t2tmxo3iu4lm elnei t arrmx  no1oetn ieiasfs2rmnvp u4aetomrcootfptelneo () 2xm(mpoo1lle  fvtat)arururpoo1tlxo f3ildla2ul(vo u0aeenirciodfmDeai o t0 exriopio4altnmnvt s aDtmu pou4opeo icias a2eanvs;()texriocoy1lmt aieo;()setm(o oo1openmict sfsrurum ou1alen ociysfs rm( p (0artrmo3oytoat  n i;s0srtoimpnudlpe livs sfaruau o;o0alx  octad a uanvo;(0aeeoio oodfmD  uvo s0texo(mpiy1lmtemfvt s) 2tm(mpnt1altniieias a2eluvs u) etoxrciy1fmDrluvs;s)setm(rpio1altnmnei s) Dum(m nu1aee ifciatfaDrlnvsn(0tltrxr oodomDrlueolt)s2umir3ou4lm emici s) rrrx o;u0olxn fetadfm2eau s ()alenif3oadlatrli o t0 rum(mpoy4omee nct ()aDrmxrpnu1tlx io3tyslm2rlu snt)tlenxo3tatlmDrau i;( seumxmpio1open fvsa() rtr(r ;u4oetomoeiatfmDemumo u)trerxo3oa1laDrlieo;() rxm(r oy4oleelfvilt)a2uaxm ;u0texnmi3iasfa el( o (0tlenmf3io1oa eliesls0tetoxopnu4am   fesas) 2ur(m oo4olxn o3iatfaDra( s t)tltoir ty1om eanes;s trtrxrpio1llen feils) rtr(mpno0apxn ociyslsDran p () rxrio tatlmDeauvsls0 rxrir oudap n fet ()srrrum nu0tpx  oetatlaDumnvs () etrmfctotlm  au s;s)t2tr(m ny4opte fctas s2uau  ;o1ole moeils a ulu pnu4alerxr3oa1fpDeanvsls0 2toir3nydol nmivilt)a2trx ooo4opxoiociatfm ranvo u)altoio3oy1faDe nes;t)tetoio iu1ame lieta( s2tr(mpot1olxomo3ilslm ua( pnu4 etniocoo1opt  ivo (0trtmio3oudomee nctl()s2ra(rpoo4aeen f3ilsla uln sn()texnxf3iotopte n o s)t2uoxopoudll n icil( srua(m nt4aet  i3ilsfsDulu s;u) lerio oodfa e ivsl() rxm(o3iudalt  iesa() 2rmxm ;t4alx ioeiytlsDemuvpn(4arenxoctatlatelnvi;t0tetm(r3no4ap  livsls)sDrr(m ;t0opt  feiyslm2rm(ms;u)tltrio oadop raneo t0s2xmimpoodap  mfcs tfsrtau  nu1olt iiciytlmDulnvp;(4 exnmr oydoptrauei (0trxmxm oydamte fctat)s2trurpnu4tleoif3iydfm rauvp t) leoircoo1la raues s) eurir nudolte nvsas srur(ronu4apto iciltfa2rmu p () leoir ia1lmtranesl(0 rxrimpiy1optnlnvsls) 2tmx o;u0alen fetadfsDemnvon(0aetomr3oo1faDrlivs;s seuoir3ou4llenlivt (fs2uax o;u0olxnmoeiysla uluvs;u4 lxrmrcta1faDelu olt trtmxo oy4op emfei tfa2umu p;u4tlxomfctysls ran snt0teeomrctadopt luvsl( teurim3iodlme miet t)sDrmxm oo0tpen i3ilsfmDrmnvp t)tlxrxocoodoaDeaneo (  rur(m oo1al nmncils  Dumu pnt4altomoeiydfa ul(vp u0texnxf tytlaD  ivo (0srxrxrpny1ame micil(f rrau ont4oetomi3ilt a eanms t0tlerif3tydlptelnvs;()trur(mpio4ll n neia() rrruront0aptomieiysla2eaump (4teeomrciatlmteluvi;s s2ur(mpnodol  lictasfa2uaurpot0oee iieiat a rl(msn(4trxnifctotoa elneo;t teumxo3nudlptn feslt a2tmum oo0tpxniictas a rmnmsn(4 rerxoctytfa  luvo;(  exo(o io4lltemiviatfa2ta(m ;o4alxnif3iyt s2emnmo u4alxnxf iadoa  ai s s)s2um(m3oo4lmtelicsa( srtr(mpno1tex iocias m2em(mon(4tlerxf oa1lpDeaneo ( tetoim3io4lp nlieilt)sDrrxroot1tex mf3iytlm2el(monu) rxnxfcoatfpDeau olt) rumio nudap   iet sfsDrru ont1tlxomicias m2umu p;() eeoxo3oatla  ln slt) 2toir3nu4lm  mfeils s2rmurono4tee mfetadfs2rm(vp;(0texrmo3tadoa e ies;t)t2toxm3oodllt lfvilt artm(r ;t4optnmfciatla ulu onu)texnif3tadlptr uvils t2umim3oudllt mict (  2taum ot4ope mietytlaDuau on()aexoxo ty1la e ivi;(  rtm(r3nodol nmnvtat srra(rp;u1tee mieiad mDrmums;t0tlxrxr iydfp   i o;s trxoiopoy4ap  liei s  2rmxrp;u0opeomfciadla eaumonu4 rtrxo io1om eli i t) rurim iy4lmenlivsatfsDtax o;u4tptoiietlt s ul(vs;t0 exomf oatfmDelnvi;( srxm(rpoudam e icils)a2taumo;t1tpeoioeildla2uaump u0altoxociotfpte ivol(0texrxr3ny1ameemicil(f rurxront1aexo ociys a ul(vp u0trtrmf3totfa  lies s0setm(o3iu1al elnvtatfs2uru  no0olxnmoeiytls uan ont0areomociy1omteaivils0t2ur(opnudomtn fvta()artr(monu0tpenii3iatfaDemn p t4artoifcoo1faDrauvo;s sexoxo3oo1ll  lfcsat)srum(rpnt4tle ioctldlm2umnvpnt0tleoxfcio1fpteaieol()t2xm(rpou4apt  ici s srtrumpou0tetn fctad m2uau p;(0 lxrmf3iodlpDeaiesl(0srtoio oy4olt mnci (faDtmum ;o4apt  iciyt s2ranvo u4artoir todlp rauvo;( texoxr iodlle  ici t  Dtm(m oo1altoiietadls2eauvpnt0treoircoa1lp raueil( tetm(m oo1om   ies tfsDtaumonu1ole mfctadls2elump (0aeenmo ia1oa  anvi;( t2uo(o ou4ll emietas) rrmu p;t4aeeoif3iltfa2ua(vont)aeeomociodlmDeanes;(0 2xo(o iy4ap e fetl( srtm(m ;t1oet ii3tyt mDelu o;u0aexnir3todomtraues;(0s2trio nodllenlfet ( arrmum nu4aeen o3tad m2rln s;u0teeoxr3io1laDrlivo;() exr(r io4aptnlncsl() Dum(ro;u1tltomicilsfa elu pnt0 eenmfcia1fm eln o ()seumim3nydol   ncils sDrr(mpot0oexn oeiad mDum(mpnt) exrxo3iodfm  ln o ( s2toxr ou4alee ncsat)aDua(mo;t0oet  oetad a rl(mp (0trxoir3oo1lmDelivilt)seuoxmpiydomt lncsa()s2ra( pnt4altomi3tatfaDrm( p t)texnio3ia1fmDe neo ()trtmir io4ap e ieiat a2urxr ot1tle mietld a rm( s;t4tetoir3oa1laDr nvilt) rxoxm ou4aptnmfes t a2tm(mono1alxnmieildfm eaumont0 eenif3ty1laD liesls trur(m3oo4omtemivi (farrr(  nt1oeenmo3tas m rm( s t) lxnifciatlmD lu o t0tetm(r3ny1lpe lfvsls srtm( o;u4tpe  o3iasla ulnmp u0aetnmr3oy1fm r n s s0s2toxrpiodllte netas)artau pno1altomfeildfs2rlnmo ()trxoir iydop  lnvols srxr(mpiudam emnvsls s2tmx oou1tlt  octadlsDulnvsn(0trxnmf3iodfpDe neil(  2tr(mpoy1ol emfctatfaDuaxm ou1opx  octltlsDem(mpnu4 ltoxfcoy1lpD ai i t0setoim iodomt  nvtl( a2rmx  no4tle  ieiatfmDul( o (0tlxrxrciydop rau o (0 rtoxo iy1op  lnetls  2rr( p;o4tle mfetldla2em(ms u)trxrxr3oadlp  luvo;() 2umxopou4aleemies ()srtm(r no4aexniiciaslaDelu pn(4tlxomr3oodoat lieol( teurxm3iudlm  lfvta( a2rrxrpoo4alxn oeiysla ulnmp (4alxomo totlat ln sl(0 rtrim ny1ll nlicsl( s2tmxrpnt0aleo fciasfaDulu p (4arermr iy1fpt livi;s)s2xmxmpno4al nlfesl()artrx  oo4apt  f3iat m rluvs;t0tleomr3todlpt  i s t0 rtmxo oodomt  fvtasf rrrumpnt4apxoioetyt s2rl( pn()aexoioctotom ranvo;s  euoiopoydomt mictlsf rtaxmpou0texn i3tydlmDea( s;u)teermfcia1op eln s;(0srxo(r3iy4op  mnes tfa2uau oot1tltnifeildls ea(ms t) leoxocoadfa eai i s teurim ou4oltemicta(f 2trxm ;t1tpx ifciadlm2el( p t4 rerxo oydfm  lneo t seur(r3no1am nmivtatfsDrr(mpnt1tpeomieias a eluvs (4 ltoio ty1fm eaivi s)srxrxo oo1ol nmncsat)arum(m no4alto iciys m2eaumonu)aeeomr3to1oa  anvo s teurxo3no4oleelfvi t aDrm(r ;o1tet ifetasfm2ra( o ()arxnxf3iydlmteli s;t0 2xm(r oy1aptn fetas srta(  ;u4opxo i3iasfa2ua(mp (0arermocia1op   uvs;()srxrirpnu1ome lnci () rra(m ou1oeeo feiasfs rmn on() lerir oa1lmDeaieslt0trto(mpnu1lp nmivsl() rum(r no4tle mi3iyd mDul(mpnt0trenxrcoodomDr i s;t)trtoio no4olee icslt) Dumuroot1alen oeiltlaDrm(mpnu0alenmr iadopDrlieol(0texmxo nu4oltnlfvsatf Drau poo0optnif3ildfs2rmnmo u0tleriocoodlmDrlu ol(0 rtmxr3nodlleemncils)sDtmxr nu1tetn i3iatla2eauvp;(0teenmfctydomDelivs (  2toxmpou4ap  lnesltf 2tmxr no0olt ifciadfa em( o t) renirciotlptr nvslt)t2trxm iu4om  mnviasfarum(roou0oetoio3ild mDelnmo t) lxrxo3tatom e nvols seumiopiydlpenlnvilt)a2uaxro;u4tptnio3tasfs2rlnmo u0 reoxfciatopte ivs t)t2tm(r oo1lle  fvsls s2tmxmp;o1ape  octytlsDea( p;() eenmf iotfaDranei;()sexm(m3oo4lltemivt ( s2rmxm oo0tleoif3ildla2ul( pnu)tlxnxr iodopDranvi;() euoxmpny4llt mies s sDurxr oo0opxnmfeild aDrl( p;()trtnmo ta1oaDeau ils trtmxrpnu1amte icias srrmur ;o4tetnmfctys a em( s () ltrmfciodfmDrlnei;(0srxoiopoy4ll nlicias)a2rau pot1oexomo3iydls eau o;()texrir3oa1fm  luei;(  2xrirpiy1ope  net sf 2umxrpoo4oex mo3tat mDrlnmsnt) lenxf3oo1fatr u i;( tetrxm3iu1al  mfei s arta(mpoo1ale  ieiatfs2rmnvpn()tlermf oy1fmDr uvols)t2umxm3iudlmenmfci s)sDraumpou4oexoioctysla2rl(mo t4arerif iotlatrauvol(0 exmxo iy4omeemfvs t)aDtm(mooo1tetomieiasfm uanvo u)teeomfciydoa rlneo;()s2tmxo ny4op n fvsa(fsrrau  ou0apxnio3iyt a2eanms;(4alxrif ty1op   i i;s0texmir3ny1al   nctas artmu o;u1tpt  ieiatfaDua( s;()tlxnmf oa1lpteanvi s t2toir3iydlm  miesls)sDra( pno1tlxnioctatfa raumpnt0tltoif io1lm  au i;s) rxmim3oy4olen fct (faDrau  ;u0aex  fciatfm uanms t0tlxoxocoodfaD an i;s0 rxmimpiydom nmivs (fs2rrx ono0aeen fciaslaDrm(ms;(0 rxrmfcoatlaDrauvi ( trur(o oo4lltemnes s)sDrr(rpno1oeto ocilsls ulu s t) lxoif3to1lp e ieil()teumir3oudopen ieslt)s2tax onu1opxomo3iytls2umuvs u)tetoxfciydlpD au sls0s2toxrpiu1omtelnvil(faruau  oo0tltnmictyt mDemu p u0tetrxo3to1fp  aivilt0t2umxm3ou1optemfvt sf Dta(mp;o0teto o3iys mDuau pn(4 reoxr3oydopteaneilt0texo(r io4al  mivtat)aDtaumpnu1olx mieiltla2ul(vs (0tltnircoo1oaD luei;t)s2trxr ny4ll e ncs t aDrru ont1aeeo i3tyt sDem( snt)aeenircootlpDe neo (0t2urio3iodlm  lfvtat) Dtmxm ;o1tetnmoeiat a rl( p;t)aetnxrcoadlaDeanes;s)tetoxopno4amt  nct t)s2ua(mpnt4aex iocild a um(msn(4texrxf iytopD auvsls trtr(r3iu1omenlfct t s2tax  ou4alxnmo3tytla2rlump u0aexnmf3oodlm  lu o s)s2xmxmpou1oleemfes t srumu o;u1aeeo fcilt sDumums;t4tlxoiociodlpteaivi t0 rxoiopiydale lnctltfsDraxmp;u4alx mociatfsDrmnvo t)trxoxr3iydlp r ueo;s)s2toxopou1am nlfvs tfaruax poo0aee io3iltfa2emnvs;u4altomr oydomte ivi s0 rurxmpio1lpe  ivil()aruau ono1texnmi3tlsfm emn s t)arenif3iytlate ivi t0t2xm(o ou1optnmivtas aDta( oou1aee mf3tysfm uau o;t4 rerirctodfaD li slt) 2toim oo1al   ncsatfaruaxroou0tpxomoctys aDra(mp u0tlxrxr3oodopD livi t)srxmxm3iudoltn fvs s  Dtax  nt1alto ieiltla2umnvp ()alxoxf3ia1oatraues ( s2xr(mpny1om nliet sf 2uax p;t0aleomociadlmDra(ms;u4teeoxfciydfpDranei;()setm(m3oydlme  nesa()aruaur ou1apto ieiys a2eauvpnt)aexomfctatlm e i s s s2xmxr3no4lpenmnvtlt  Drrumpnu0aexnii3iadlmDemnvpnt)aetoio3iydlm rlnvo s0sexr(o3iy4olenmivtl()srrm(mpou0apt iietls aDumuvsnu)tetoxo oy1fptr i olt)setrim3iu1op e ncslt) rtrxrp;t1opeo ociatlm2uan s u)treomr oydfaDrli o;s t2xrio3no4lp   iciltf Dtmum ;t1tltnmf3iadla2uau pnt)artnirciydop  auvils0truoio iu1lp e fvia()sDuax o;t1apt  iciasfmDumnmo t0alenmoctotfm rlueo t0trtmio iodlpee ivt tfaDuaxrp;t1tet  feiys aDrmnmsnu0aleoir oatoa r ieolt0t2trir3ou4opeemfcsltfsrua(  ;o0teen fciadlm rm(vsnt)trtoio3oo1la rlnvo;( tetmxo oy4oltnmnvi s a2trxm ot4olto feiytlmDulnvo t4 exnxfciadlatran o;t0 euoir3nodlmeemnesasfsDrr( pot0ole  ocilt a rlums;t4aeeoxo3oydopDe ieo;s0s2xoxopiydlpee nviat s2ra(  nu4oexomo3iad s eanvp;t)alxnxo3ia1om rauvi;t  2ur(r oo1oltn ivils aDuaurono0aee miciys m2umu o;() rxrmf3oy1omte nvols)s2toxr iu1lm   ict t)artr(m nt0aetnio3iytfa2eanvp;()aetrxf3io1lp rlneo t0tetrxo3nudlpt mfct ( a2uru poo4ape  fcils sDea( p;(0trtoxf3oa1oa elu o t)setm(r3nydoleemnet tf rrm(rpnu0apxomfciydla2el( sn(4arerir3ta1lmteai ols  2tr(o nu1ll e fcsl()s2umum ou0texoiociadlsDea( snu4teermf3iydopt aivo;()seumirpno1om nlnes ( arurum nt1olt io3iydfa el(ms t4 leomrcootlat  ivs;(0 2tmxo3oy1oltemnci tfaDuaump;u1tetn fcils sDumumsnt)arxoxf3ia1fmD  n i ( sruoio nodolt liesatfaDumx  ;o0oexn ietytla2rmumo;t0tetomrctotoat  i i (0t2xmio3oo1amen ieils aDtm(mp;t4olxnmfetyslaDemn o;t4tlermocoadlatelneo;s)trtmxr ou1ap nlncsls s2ta(m ou0ale ioctys aDranmsnu0arxrxfciadlaD au ilt)setmxo3iu1ol   nvtat  rtmu p;o1alxn ieiat a2emn p;t0treoir3iatla   ueils0 2tm(rpiy4oltn ivt ( aDtmx p;u0teenmfetaslaDul(vs;()teenxfctotlpDeanei s s2umiopnodllen iei s) Dtmurooo0tlx  feiyslm elumo u) rxrxo3todlmt  ueils) ruo(opnodole lfcsas) rrru ooo0texnmo3iat s elnvs;t)artnmo3iy1lm  aiesls teumxm3iydapt  ivil()aDurx  no1aetniieiysls rau s;()teenmr ty1la  anesl() etoxrpiudlp n fesat sDtm(rono1oex if3iydfa2rmuvo;(4 rtnxoctydfpD  nei s  rxmim oudole lnetlt)sDumxrp;u0oeto i3iatfs2ua(vs () lxrxo3to1fpDranvo;t srtr(m3oy1optelnvi (fs2tau pnt0tlenifciyt s uluvpn()tetnmfciydlatrlnvo (0trurxmpoy4apt mfvt tfaDtm(  no4opto ociltfs2ul(mp u4alxnio oadlmtelieol(0t2toio nodopt  icsatf Dtau ooo1oexn oetasfa emnmsnt4 eerio oadfp   uvo t t2xmir iu1lpt  iesltf rurum ;o1alx iociyd a2uluvs (0aleoir3io1fa ean ols trtrxo no4optnlics s sruru  nt0opx mieilt mDel( p;t0 reoio todlaD aivi;s)s2xrxr3nu1op  lfci s) 2ur( poo4oex  feilslm rlu s ()texrio3iadfa r nvs;t)trxmxm iu1ap emfes sfarrm(rp;o1olt mfciaslmDemuvs;(4tetnircia1laDe u i (0truoxm oy1ll  mieilsfarur(r nt1ape  oeilt aDrl( s u0 exnxrcoytla e neo;t srxmxm3oy4aptelfvtasfs2rau o;t1oee  o3iadla2emums;t)tlxnmo3totopD li olt  etmim nu1omt mieta() 2rrumpnu1aeen oeiyd s2el( p (4tlxnxr totopD  i i ( tetm(r oodop n icta(  Dtrur ;t4oleniieiad mDuanms;() etoif3ty1optrai o s t2urio nodlmtn iesls)arra(m no0oeen feildfm rmuvs u0aexnmrctotfmD aivil(0srtoxm3iy1op  lneil()a2uau o;t4opxniictlsfs2ulumonu0trtrmo ty1lpDelivi ()s2um(m3oy4amtelfvil( aDtau  oo1oexn ieiltfs2ul(vp;u0aetomocoytlpD  iei ()trtoxmpou4lp nmfvt sfa2trx p;o1tle ioctat s2rmnvpnt4 ltnmf oo1fm eanvi ()seto(mpoy1al nmiesat)arrau o;u4olt  oetlt s ea(ms;()altomf3ootom  anvi s0trumir3oy4ol nlfvtls)sDumxm ;o0aeenmi3iytfs2uanmo;(4tleoio ta1oa  lnvi;()teto(mpiu4ol e fes s  Drrx oou4opt mietyt a emnvp u0artnmr iodopDraneols  eto(m3ny1ap nlfctlt)srumx pnt1olto ieiyslaDranvs;u4aeenmo3oodoaD lnes;t setrxmpnu1om n nvsa() 2ra( o;t4tpt  ieildla umuvp ()altrmrciadlatelueols sexrxo3nu1apen icil( s2uaurp;o4altomfciasfsDrmuvp u) renir ia1lptrlies ()sruoxmpiu4lp e netatfsruaxmo;o1alx  fciydlm emu s;() eeoirctadfate uei ()seumim nydalte nctls) rtrumpot1tlxoiocils s2em(vo t0aeermr3ty1fpD lu s;()setrxm iy1al  livsl(  rurxmpnt4tltoiociys mDel( o;t0tltoio3oy1fat  ueo s) 2xoir oy1ap   fet (  rra( oot0tlto fctldlm2ea(vp t0teerir3iytopt  ivilt0trtr(mpiu1altnmncs tf 2taur nu4opxo f3iydla2ra(mp ()areoxf oy1la rai o (0sexm(rpiu4amenlfeil(f 2ra(root1opto fciasfa em(mpnu4tetrmfctodlpD  nvi s) rto(m3oodoptelfct s) rumxmoot1tleoio3iat aDuan p t) lerif3tydomDelnvil(  etriopnu4amenmfvs tfaDtrur ;u1tlto ieild aDelu pn()trxrmr iatomtrlues;s)seur(rpiy1alt mncs () 2rm( ooo4apxomfciys aDemumsnu4arxrxocoydfmtr n sl()seurimpnu4lme lics sfsDtaumpot4tptniieildlm umnvs;u4 etoxocoy1lpt aiei ( s2toxm oodolt  neslt) Drm( pnt1tet if3ildfm ra(ms;t0artrio iadomtr n s s0tetrio ou1olt mfvt () 2uaumpoo1ole ifcildfm2em(mo u)tlenifcoatomDe iesl() eumxm nudape lnciltf 2rr( oot0olx iicildfm em(monu0 rtnmocta1lmDran s s)srxrxmpnudllt liei () Dua(r no4texoiociyt s2ua(vo;u4tetrir ty1lp raivi;s)seurim3iu1ole mici t arur( pou4aptomociydfm rmn s u4 rxrxf3iadfa eai s;t  eur(o3oodlm  lfetlsfsrtaumo;t4tpt io3tltfmDel(vo;(0 eermfcio1fmtr i s t)trxriopny1lltn ncsat)a2rm(m nt0apenifciltla2rau sn(4 exnmo iodoatrau o;s) euoim3oy4lptelnei (fa2rr( pnt1open fciadlaDra(mp () ltrmf iotoat lu ils trto(mpoydomeemivi s  rrrur nt4tptn fciltfs2rl(vo (0aexnxoctotfm rai slt seuoxr iudlpe  icsasf Dumxm ;u4apeniociltlaDemuvo;t0 lenxo iotlm  ln il() rxo(m3ou4lm   nesls) rtru  ;u4aex ioeild mDuauvonu0trxnmociydfat lu i t  exoxo iu4olt lfcsa(f Dra(ro;o0texomi3tldfa2eanmsnt0altnio iodopDe nei s0trtr(opoo1apenmneslt)aDrau  ;o4aexn f3iltla ea(mp;t0tlxrxf oo1fmDe n i;s)trurimpoydapee neil()s2uru  ;u4oeeniietld s ranvs;(4artnxocio1lm   nvs s0 rtoxr3ou4omtelfct t)a2urum no1oeto oeiat m2umn o t0 rtnmfctotlpDrlu olt s2xmio iu4apt  fct s) rumxr ;u1oeto o3tatls um( o;()tlxnmf oo1op e u sl( srtoxm3nudamenlfet s arumumo;u0aptnmf3tyt m em(vsnu4teermr3ia1lpt lu i;t trxoim3oy1om emict (faDrrx  nu1tetoiieilt aDrl( onu4altrmo oo1opDrluvo;s  2xo(m3ou4ame mfetlsf rtmxrp;u1tlen octad s ulnmsn()trxomf3totom rlues;s)t2xr(opoy1ap elivs t sDtm(m ou1oltoii3iyd m umnmpnt0aexomo3ty1opDe nei ( trtmim oy1alee iesas a2rrum ou0tltn oeilsfm2uanvsnu0aexrmr iadomDraneo;(0 exo(o3oydole lneil()arra(rpnu4tpeomfctld m rl(mpnu) renmf3ty1omt au o ()tetoxmpiy4lpee feta(  rrrxm nt4apxniiciydls2uaums;t0aeenio3oadlaDeauvslt  exmirpnu4lme licsls  rtr(mpno0apto octydla2rm(ms;t4tlxnio iydfmtrln o;t0seto(opoo4omen iviat)s2tr(mpoo4opxo feiyt s uau o;u4 reomf3tytfat ln sls0s2urxr3oy4lp nmfctat) 2ua( pot0alen i3tyslaDeau ont4 reoxocio1lmt livs s)s2toio iu4ll nmfciatfsrumxm no1ole  feils a em(vs t0 etnif3tadfa ean i;() rtoxo no1llee nes s)a2tm( poo1alxomf3tltla emnvpnu)trerioctytomt  ueslt t2xm(o3io4omeemnvsat)srrrxrpnt4tlxomictyd a umumpnu4alxoir3oatfmt au i;t)s2toir3iy4lptemfvsatfa2rmxr ;o4ape ifciltla uanvsn(0trtrmrcio1faDeau ilt0 rtmxm iy1op n fes ( aDrmu o;u0olt ii3ildfaDeau s (4tltnxociydfatraneols0trurimpoo1oleemfvt s sruaurpno0altnmociadls em(von(4artrxo tytoptr ies;s)trtr(r oo1ol nlfvslsf 2ur(mp;t1openioeiyt sDem(vonu0artrioctadop  anvo;s0 rtrxm nydllt  ncs sfsrum(  ;u0oet  oeiltfs2um(msnt4 renmf3ia1opteauvo s) 2xmxopoydomtelneslt)s2urxrp;t0apeo icias mDelnvp (4 lxrio3iotfa e u o s)s2tm(r io4lp   iciat s2uaumpot0apto i3tysfs rmnmont0tltoxr oo1fm  lnvo;(  rum(r3io1lmenmieilt sDtmxro;u1texnii3ildfa2uan s u)treomr oadfatelieo s)srto(m ou4openlivtl(  2umx pot4oeto i3tysfmDeluvp;t4trxomf tytoa rlivols0trtm(o3iu4ope lictatfs2tru poo4alxnmociltfsDumnmo;(0trxoio3tydfate n olt0s2uo(o iydlptnmies s)sDraumpot1oltnmicilsfmDem(monu0 eenmrcoydfmDelnvs s) rtrimpio1opt  fvs s) Dtm(  oo1tlxn i3tysls2eaumpnu4tlerif iytlaDrlueslt)tetrirpiy4lptnmict (fsDuax  ;o4ale iociytla rl(vpn() rerio todlaDe neils0tetoimpiodal emfcsas s2rr(m oo4oex  ictyslmDum(mp t0alxrmr3oatfmtrlu i s0srtmim3iu4lm nmietl(fsrtmx poo4aeenifctas s2emu onu0artomr3oo1fmt liei ()s2xoir3nu4op   ict s)aDrmumo;o1tlxoioctad mDea( o;t) eerxf3oy1omD  i o;t  exr(m ou1altn net (farumu  nu1aeenifetytfs2elnvo;u) exnxr todlmtraies s0 eumimpiodomeelnesls) 2ra(rpnt1aeenmi3tydlm2umu sn(0teermf io1fmtrluvi;(0 rxrirpiydlltnmfvs t)a2rax pnt4opto fctldfm2rl(vpn(4texnmocoytoateai o;t)texo(m3iudolenlies sf rur(rpot1oetnmi3iad m2um(mon(4artnio3ia1omDeau o t  etmxr3oo4lm n nvsasf 2umur ou0oexo fetatfm2ulnvp ()alxrxr ootfpDr i o;( seurxr iu1ope mfvslt srrr( pot4oee iiciatlm2emumsnt)texrxr oytomteai ilt0srtmimpiudlmtnlnvtat)a2umum oo0opto fciatla2emu snu4 etrmr tatlatr ieil(0 rtoim3oy4lpeelfctat)s2tmum ;t4oetnmfctltla ranvp;u4 lenmr3iodlmD livs;s0trtmirpny4llenmncias s2urumoou0apen i3ilsfmDrm(msn(0trtoxo iotoaD anvo ( srum(mpou4llt  icil(fa2trx  oo1optomieiadls2eanvpnt)altrxr oadlatelivi t t2tr(m3iy1opeemnesat)srrm( ono1oex mo3iadlmDelnvsn()aetoif iadfmD  nvslt0 rumiopoydame miet (fa2ta( pno4aptnif3iysfs2ea(vs;(4aexnif3oadfmDe ueolt0 2tm(r oodole lfvtat)aruaxronu4optnif3tatfmDeanmpn(4aeeomrctytoat  uvo s) 2tmio3ny4openlfci ()arur( p;u1ale mfeiasfm2eaumo ()texnifcootlpD au s t trumiopoudole  fvi (f ruaxmooo1aeeoiiciys s elnms u)tlxrxf tytopteai sl(0 2toir3iu1alt  nesa(f 2ra(r ;o0ape mo3iasfaDrauvsn()altomr3ty1lpDeaieils) etm(m iy1lle  ietat s2tau ono0oee if3iys sDul(msn()texrircta1lm  aivi;s sexm(m ny1ape lnesltfa2trxmpoo1open oetlslsDranvp (0 etrio3tydopt au s s)teurirpio4alenlncias)s2tr(root1oex  i3iyd aDrln o t4aeenircta1laDelu s ( srumir io1op n fcslt  2um(mp;o0aetnmfctytls2rl(vsnt)tlenxo3totfmDrauvo;()seum(opiy4llt mfesltfs2umxmpnu4alx moctlsfs2ua( snu4aetrmfcoadlm raneo;(0teuriopoodolt mfvsl(  2tau pnt0texniicias m el( s () etrmocty1fmteluei;(0setoio3io4omtemfes t) rtauronu0ape  i3tltfs ua(vs;(4treoir oydlate uei (0 etmir oy4lle mnvi () rtrx  ou1opxomi3iatla rlu sn(0tltomf iodoa eau s;(  rtm(m ou1alte fvi ( s2urx  ou1alen feilt m2ulu s t) rerir oo1fm   nesls0t2trio iu1ameelicia()s2trxrpoo1altomo3iadfa2ul( p;t) eerxf3io1fmte ueo;t  ruo(m iodal   feia(faDumxm no1apen f3tatla2uanmont) lenmr3tydfa ean i;s0srxoiopoy1opeelfct t) Dta(ro;t4oexo oeilt a ulnvp ()tltnif tadfmt  uvilt  euo(m3iudlptn icias)aDurxmp;o0opt mi3ildfm2emu p t)arerioctotfpt  uvi ( tetmio3nu1ll emietasfa2rmxrono4alt mo3tldla2ulnms (0 lxnirciadfaD  ies s0 2tmxo iy1lmtnmivslt) Drmumoot0altnio3iltfs2ra( snt4teeoir3iy1omt aivils) 2toir nodlptelfei (faDrmxr ;o4aexoiiciyt m ra( o;()trtnxo oa1omDeauesls)srxr(r3ny1lm   nvsas sDtmxrp;t1tleo i3iytfs2el(vonu4altrxf3iadomtrauei;s)tetmxopny4lpe miei s)arrmumooo4tpe  f3iydfs ranvs;t0altrmf3iadla  lu i;s0srtmio iy4ale lfcsas)s2umumpnt0oleo f3tytlmDea(vp u0trerxfcoytopDeaivo;t texoxo3io4aptnlfcilsf 2rmu pno1oex miciat s2uanms t4aexrirctotlp e nvs t0trxoimpiodolenlfvil(f rtmum oo1apxnmociysfs2ran o;(0arxnxo3oydoa   u ols)s2urxm oo4ol nmicslt  Dtruro;o0alx moeiydfaDum(mp t4texnxo iytfm elnvi t)tetr(mpiodolee ncsatfaDrru  ;u4aexnioctls sDumuvo u4tlxomf3iodoaD  ieo;t teuoim no4lm   icsltfsDra(monu1olt  o3tls m2em(vont) ltrmo3oytomtrlivols)srtmio3oodomenlics ()aDrmxm ;o4olenmfetatfm ranmo;(4artrmr3oatlpD  nvi;(0trxm(m3iu4openmnviatfaDtrx  ou1oetnio3iytfa rl(msnt4trerxf3oatfp rlu o;t0seuo(r3iu1llt  fvsas)aDum(  no0olt mfcilsfm rl( p;() lxnxf3ia1fmDeaivs t0setmirpnu1opt livilt s2rm( p;u4opt  o3iaslm2um(msnt0 lxnifciy1lmDe ieo s)t2tr(r3no4lm emietatfa2rau  nu1alxn oeiydfm2emuvp;()altrxociydfptelues t0t2xrxm3iu1ome livtls)srumxr ou4aleoif3iadlm2ulu s;t4arerxf tydopD aivil(0t2uoio3ny4ll emnesltfsrtmx p;u0opx iociyslmDumuvp u4trerir3oy1oaDe u il(0t2to(r io4ole  ivil( srtm(rpou0aetnifciatls rmump;u4arxoio3iydfp rauvo;s  rtr(m ny1amen fviat srua(mp;t0aeenmi3ias a ul( p;(0alxrmo ia1om raueil() exm(mpoo1om e ncsa(  rum(rono1aex if3iadfs2rl( p u) reoxo3io1fmDe ies s0 euo(o3iudap elicslsfs2tm(r ;u1apeo o3iatfmDum( pnu)tltrxo tatoaDrlu s t)teumir no4lpt mnvs s s2umur oo0tpenio3tadfmDuanmo;(0tetoircia1fmDelieilt  etrir nudlm elneiltfaDumx o;o1tltn ictatfa2um(vonu)tltnirciy1lmtr uvs;t)trurim io4olee icsl() 2ra( pot0olenioeias a ua( sn()altoxo3oydlaDraueilt0 2xr(r3oodol  mfvsas srrm(rp;u1olxnmoctyd m rmnmo u)tlxomo totoaD an ols) 2urxopiudlpt mneil(fsrrmx  nt1aex mo3iadlmDrmn o t0arxrmo3io1oa  ln sl(0 rxrir3iu4lmen fvs s aDrr(mp;o4alxnmoctlslsDrluvo;t4tlxrxr tatfpD lnvi s) ruo(o3nydlme lfct s a2uru o;o1aptoif3ilt s ulnvp;t)trerxr oo1oa eaneo s)t2urxr oodom nlfci t srumumpno0teeniieiadls eln sn(0trenmfcoadfp eai o;t)texmimpio1lmeemnvt s) 2ur(mono4aexomoeilt m rm(mo;t)tleoxo3iadlaDelneo s0truoirpoo1ll n nvsl(  Draxm nt4optoiieiltfa emn s t0trtomf3oytlm   nvsls  2tmirpoy4alte ies sfsDur( pnt0olen iciaslm2em(vp;t4trxoxrcoodfp e nvol( trxoimpou1olenlivsat s2rm(mpoo4optnmi3tasfs ea(vs u0tltnmfctodlmDeli s t0srtm(m oy1oltnlietltf 2ra(  ;o1oltoio3ias mDelnvs u0trenio3todfat an olt0s2xo(opnudlle  icilt  Dra(rp;u1altoif3tadfs2elumo;(0aleomrctadla rli s;t trtmxm no1lpe lfcsa()sDurxmpoo1alt ifciydfm2ul(vs u4 eenio oytlmDelueilt texo(r oodole  ivt s  rtmumonu1tlto fciysfsDelump (0trerir iy1laDeluvol(  exmim3no1altelfct t artrumpou4alxoiicilsfs eaumo t0 ltrir3iotlpDrlueo;s0trumiopiy4ole lneil(  2uru onu0aeenifciadfm2eluvpnt0aexomf3oatlpD li s;t trurir nudlleelnctas)srtmumpnt4apxnmf3ilsls2eaumo ()altnmr3iodlpte iei s srxmio oy4ll emiesls) 2rmu  ;u4oleomieiltfm2em( p t4 lenmr3totlmt  i sls srtmirpiu1am  lfvtas s2taxr ;o1ope iieiydfmDulnvs;(0alenmocoa1fpD aivsl(0 rxrir iy1om nmfet (fsDrrx onu4tpe if3ildlaDranvs;u)aetoxr3tydlat  ueols0 rxmxopoydole lnesat  rum(mpoo4oex mf3iasfa2uaump (0trtrmf3iy1lm elieolt0 rtr(r3oy1ol  mfvtl(  2rm( oot1tee mieiydfsDea(mp;u) renir tadlmteanvi;(  rtrxo3ou1lmee nesatfaruaxr no4tetn ictlsls2umu snu)treoxf oa1lm  lnvi;s setm(r3iy1lptn ivils  rtrx  ;t4olx  f3iadla2umuvp;u0alxnmo3oodlp e ues ( srxmxr oydlpen iei (fa2rm(m no1apx  o3tydfm2emn onu) ltrifcoydlm  lu i;t srxrxm ou1omte nctl(fs2truronu4ope ifeiydfs rlu p;t4 ltoif3tydoaDeai i ( truo(o oydopenlfvias  Drmx o;u0oet mfciaslm raumsnu4 rtnmocoydomDeli i;t) 2uo(r ny4om emfvtat)arrrurpno1aee ifcildfmDea(vo t4tetrmf3iytfa rlnvi t t2um(mpnudam   fcsl(faDuaxro;o1oeen f3tltfa rlumo;()tetrmo3oodfatelueils t2xo(r3io1omt mnctltfaDraur ot4alt mfeiydlm2ulnvp;t) lxnxf oo1lp elivo;t0 ruoxm3oo1lm e feta()aDtmx o;u4aptnifcilt a2ran o;t) exoxf ootoatelneolt0setrxopiu4lpee iei t)a2rau poo1altn o3tad s rl(von() lxoioctotoate u o;s0srto(o3nydlmenlfctl(f 2rm( p;o4aee  fciad s emu o;(0trxrmf3iadfateau i;(0 2triopoudom  lnei tfa2rmurpnu1tlxn octlt mDuanvp;u0arxnmo3iydlptean i t seuoxm3nu1apenlfet sfsDtr( pnu4aetnmfctytfa ranvsnu0trtomr3tatop r nvolt0trxoio iudam elieslt)s2ta( p;t1oltomo3tydlm elumpnu0tetomfcia1oaD  ues;(0 exmxo io4amenmnct s)s2tmu oou4texomieiaslaDrluvo;t0artrxo oy1faDrlnes;(0 etrxo3io4lltnlncsat) Drrurpot0tlto f3tlsfs ulu s (0 lxnxociatfptrlivsl(0sexo(mpoy4ll   icsl()a2ra(  ;u0tpx  fctyt sDelu s;() ltnmrcoytlp e u s;t) ruo(o oodlmt  ieil( srtmu poo1oleomfciadfs um(vo t) eeomf tadopDran ol() rxrio oo1alt mnei t)aDrau  ou1tlt iociadlm2elnvpnu0 rtoxfciydfm e i sls) 2toir iu4ol   ivi t)srrm(moot1tlt micild a umumo;(4 exrxo oydoat luvolt0 rurxo3iodapte fvtat  Dtmxmo;u1alt  ietyt a2um(msnu0aexrmr tatfpDrlu o t)tetm(r3iy1ope licsa(f rumurpoo4apx  feiyt m2umnmpnu0aexrmf3tytom  anvo s0trurir iu1ol elfeiatf rrrxrpnu4tpx mi3taslmDumnvo;(4altnmocoy1lmDrliei;s  rxoir ny1om nmiciltf rum( o;o4tpxnmfeiyslmDean p;t) etrif to1oaD  ivils)srxrxr nudlmt livtasfsDrrumpnt1opxomfeiatls elnvon(0texrmf oydomDrlies;t trtrirpoudal n ncsa()sDrr(m ;t0tlxnmieiat a ea( sn(0 ltomr oatfp   ueolt  rumxo iudlm nmictat)aDrr(mooo4optniictadlm2eanvsnu4treomr3tadlptraivs;s tetmimpny4lm  lnvta( sDtm(mpno0aetomfcildfa2rlump;(0trxoifciy1fpteanei ( texrir ou4ol emics sfa2umuroou0tet  fetatlmDrmnmo (0tltnmfcio1oatelivs (0sruoxo no1om emncilsf 2rrumoou1alxn fctlt s rlu ont0texoif iadfptr iei;()tetrxm3iudape lfvs t arra(rpoo4tpxoio3tas m rln p;()alxrxfciytlate nvol() 2uoim3oy1om nlncsa(  Dtrumo;u1tpe mieiyd sDem( s u4 rerxr3ty1om eau i;s)t2tmimpnydomeemivi (  2rm(rp;u0ale ifetyt aDrl(mpnt4artoir3oo1omDeanei () rumir3ny1llt lnvsatfa2tau ono4aet ioctydfaDemn pnu4tlxomr io1fmteanvi ( trtrxo3iy1amt lfcsas)sDrmx p;u4oeen oeiltls um( p u4tlxrir tydfate i sls0srurxmpiydapt mneia( srurx pot4teeo f3iadla2ra(mo;(0 lxrxo3tadfa eai i s setr(m oo1op n ivil(fsrta(  ;o0tetomi3tytlm rlnms;t) exnmfcia1lpD luvilt  rtm(m3oydaptemivtat a2trxr ;u1alx  i3tytfs2rmnmpnu)texrxf tydfm   uvs t0 2xo(m iu4amtn ieslt) 2tau oou0tpe mfeiyd s ea(vont4tleomocoa1oa e i o;t) 2tr(r ny1lp  lncta()srtaxro;u0texnioctydlaDrln o;t0tltoir3oydlmtean o (0 2tmirpno1om nlnesls a2rru pnu0alto o3tlsfaDra( o u0tltnmr3oadomDe ivil( teto(m nodolt  fesas) rumxm ou0tetnmo3tadfs um( o;t4trtnxr3ootla eauvs;( t2ur(m ny4am  lnvta()sDua(mo;o4aetnmo3tld s eln p;u)alerxf3oadfaDe ivs t)seuoxm iu1op e ics tfsDtmxmpno4teeomfciyslm2ea(ms (0arxoxf3todfa elu i s)truoim3oudamt  ncsls) rumu pot4tltniieias a ulumpn()tlxomo iydomt luei s0sexrir3iodapee ivia(f 2tmur ou4oet  o3tltlmDrm( s;u)arerircoadoatr ivi s0 eto(r ou4amen ncia(fsDuax poo0aexn f3iydlm2umums t0 ltrmrcto1lpt  i i s0 etrxrpny4lpe licsat arrax oou1tlt mfciltfmDeau p t4aexrmf iadfptr neols0texm(r3iu4lltemfesls) 2tm(ro;u4apxoiiciysfm2rau sn()arermocoo1laDelivs;(0seuo(m nydamte fvtat)s2ua(r ;o0apxo oetadfa rmnmo;t)altomo iodfpDeanvs s)texo(mpnydll   fvta( srrax onu4tpto icildlsDemuvp t) etnmr tytfatraieo;(0 2toxo no4al   fvilt)aDtrxrono1aet mo3iasfs2ua(mo;u4tltnxr3tadla rlueil(0 etrxm nodam emneilsfs2tmxroot4oee mociatlm ranvsn(0tltnxr iotfp  an o (0 rtmxrpnudlpe mneia(  2um(r ;u0apeoio3iasls2rlnvonu)alenxf3iodfpD  ivs;s0 rumiopnodop emncil( a2urumpno0tlxo f3ilt mDranvpn(0 renif iatlmDeaues;s0 rurxo3iy1lme lnet t a2taur ot4oex  ieiltfa2rlump;t4tleoxr3tytomt  i sls) 2xrxr ny1amtnmfvt s) 2ra(rpot4alxnmfeiatfm2um(vs;u)teerif3tadfaDran o;(  rtmxr ny1ame mfvta( srrrx  ;o0oet  icias m2rmump () rxrxrciodfm e ueslt)trtrim ny1lm nliei s)a2tax  ;t1tpx  feiaslm ua(vo;t0 reomf oa1omDr uvo;s) etm(m3oy1am nlfvt (fsrrmu poo0apxoioeiasla2rmums;t0alenmfciytomDrlivslt  ruoxm oodaptelictas sDrm(rpot1opxo oeilslm ranmpnt0trenif3ootlmDeaivsls0srurxopoodom  mncils sDuaxrpoo0tltoioetatfmDean pn(4alxnxrcia1oatrau ols0t2to(r3io4ll n fctatfaDtr(moou1tlenmicildls2ranmo;u4trxrio3ta1op e ueilt0t2xo(m ny1oleelfesa(  2rmxmpot0aex mf3tysls rmnvo t0tetnmf3ty1lpteluei (0t2xm(mpoy1lptelnvt ( srtax p;t0opeoif3tatfa2rm(mon()tetrmf oydoaDeaieolt0 rur(m3iu4llt  nvtat srrmu oot4tpt mfeildfa2uau snt) exrir3iytfp e i o;(  rxm(rpiy1omtn neias) 2umx p;t4tlenif3ilslsDrau p u4tltnmrctotfpteanvs;()srurxr3nu1ll elfvs ()a2tmumo;t4alt  fcilt m2ua(mont4tlerxo3iatfm   ivo (0t2umxm3oodlmeelnesa(faDtmxm ;t0optnmfciadfs emumo;u0 rtnmfcoy1la elnes t0teuoxr3ou4apte icta(  2rrxronu1teeo icils aDrluvo t0aeeoir3ootop ean o;s0 rur(r oydome  iei sf 2taxmooo1aexnmo3tldfm ra(vs ()trxrxocto1lat livsl( srumxrpoodop  lneiat sDtax  ot1ole ioctadlsDraums (0tltnircoatlpD li ils seuoio3io1altelnet ( s2raumpno4openiicilsla eanvsn(0tltoir iotfpDeaies;t) 2xmxm io4om nmfetasf Drmu ont1altoif3tyt m2ea( s t0aexrxfcty1lm  aivo ( trxm(r3oydopt mivt s a2rmuro;t1aee  i3tadls2umu o;u0trenir tydomt livsls0srumimpio1ome lfvsltfaDrax pnt0olxomfciydls em(mo (4 rxnif iotopDeai i;s0 2uoxm3oydop elncs t s2umx pnt0optoifetlsfmDelnms;t0arxnmocoo1laD livilt  euriopiu1oleeliesas)aDuax  ;o4tpenifctad mDulnmo;()trtnir3oo1lp r n o (0texr(r nu4ope  fvs s  Drau pou0tptomociat a2eauvpn(4artrxfcty1fp eli o;( seur(r nu1aptnmivtlt) Dumuro;o1aeeo o3ildfs2rlnvo;u0 ltomociydfmDe i sl(0s2tmxo iu4ameelieias)sDtmu o;t0tpxo o3iyt aDrm(msn(0aetoir oytfpteaieslt0 2uoim3oodol elnetl()sDra( onu1aeto i3iydfs2ranmont4texrio iytoateai o;s) 2toxo ny1omt  nes ()srua(mo;t1ole mfeiydla emnvo;u0artnif3tytomDeaueo s0trtm(o3no1ap  lfvtl(f 2tmurp;o1tpxnmoeiydlmDumn o;u) lxrxociodom rai ilt  rxoio oo1amte nctas)artaumpoo4tlen fciydla2rm(mpnt)texomo3iy1la r ies t t2tmio3nu1ome mieias) 2rmurpnu1olt moctytls uluvs;u) ltrxfcio1lm  anes;(0s2umio ou1op n ivt s aDrau  ou4oleomoetadfmDrln pnt0tetoirciytfpDean o;( t2xr(mpny4am e fvils)srraum no4olxnmoctlsfm2eluvsnt0tleomf3totfmD  nvi (0tetrir ou1ap   fesat) Dtax o;o1oexoiociytfs ulu on() rxnmocta1fmt lu o;t s2xr(opnu1ll  mnet sf 2um(mpoo4aexomiciytla2umn on() eeoio iodoptrau o;() 2xoir3nu1olte ivsat sDumuro;o0tpxnmoctasfm ranmp;t0treoifciy1lat li sls) 2toxo3no4olee nvt (fa2trx ono0opx ioeiadfs2ra( onu0 rtomr iatoa   ivolt)teuo(o nodameemnviat  2taxmp;t1opt mfctldfa2elumo t0artomr to1lp r u il(  rxo(mpoo1om nmfetatfsrrmx ono4oleoii3ilt s rm( pn(4 exoifcoo1om rlnvsl()t2xoirpiu4lpe lfctat)arrax poo0olt  ictyd s rm( pn(4teeomo iytoate nvsl()srtoim3nu1lptn feia(f rrrxm ou0teto ietadlm eln p;(4 lenxfciotlm eaues t t2tr(r no1al   ncsasfaDtmxmpoo0olx iociatfm el(mo;t) eeomr tydfptr n slt) eurimpoo1opte neilt)srtaurpoo4aleomfeias m emuvpnt0tleomocto1fmDranes;s0seumim nodam emict t  ruau oot0aexomieiyt aDrln s;t4 eermf3iadomtrau i ( s2to(m ny1ameemnesl() 2umxrono4apxnioetyslaDem( pnt) lxnxocoatopteai i;t)s2uoir3oy4am   net sfarrrxmoou4openmf3tasls ul(vs;u4texoxf3todlptrlieo;s  2tmxr oodap  mnvsa( srrmxmpou4oltnif3tytfmDelnmp;(0 eeomo3ia1fmt lu ol( srxmxm3io4amtnmfctlt artrur nt1oex mietatlaDrmu pn(0artoifcto1fm eli s;s)tetrimpoydom e feil(fsDur(mpnu0tpx mfctydlsDra(von(0aetrmoctotlpt lues;( texr(o oy1omtelfvi s arumu pnt1oeen i3iysfs2ea( ont0tlxoircoo1lmteanvolt0teumim nu4op nlfvsa(f rua(rpnu1oetoiicilsfaDuaump;t0 eermr todlatrlies;t0tetoxo3io4altelfesat  2rm(  ;t0altnmoeias sDrlumsnu4 eenmocoatlm  li ilt)srtoim io4ol e fviltfs2rm(mooo4ape io3iatls2rlu ont)aexnmr io1lp  aivo;s trurxo oodop nmicsa( artrumo;o1aleo f3tatfm ul(vo;u0tetnmo3ta1fa rln s;( t2urim iydam nmfet s artrx  ;u4texomf3tytlaDrmu s (0 rtoxf tydlm  aieol(  rxrio io4ol nmnvi (fsDumurp;t4tlt mfctas s2emump u)altoxocoytop eai il()trto(rpoo4amenmfei s)sDrm(  nu0aet mfeild aDua(vs;t4aeeoioctytom rli s t0truoir oy1ale lnct sfsrtrumono1tpeo octldfm2ulnms u0texnircoydlmtran ols0tetm(m oy4am nlfvtl()sDuaump;o0tpx  fciydlmDra(mo;()arxoxr3oy1om e i o s t2xm(r3iu4lltemnci tfsrumx  nt4ole ifcilsfm rlump u4alxomr oatfm r u ol() rum(m oodop e fvils s2um(rpnt4alxomictls mDulnvp (0trtomrcty1la  au o;( trxm(r3iydlptnmivtls srrm(r ;u0tlxnioctldlmDean ont4 ltoio3oodfmD lueo (0s2tmxr io4optn iviat)a2raumo;t1apxn iciysfm ra( on(0trtoxrcta1fpte ieo;t0t2xr(opio4llenlicsltfs2uru p;t1altomoeiad s2rln o t)teeoxo3tatfa e iei;s) rxr(opiu4ome lfvtatfsDrr(mp;u1texnio3iad s2emuvp;u0altoio3tytfptrlues s0 2xoxm3nu1ameemfci ( arur( pno1olt  fciltlsDelnvp u4tetnxrciotopt  uei;s0sexoir ny1lle mnvtas)srrmx p;t1tee moetasfaDran sn(0trenxf ootomDeaues;()srtr(m nu1apen ivs (fsrrr(rp;t1oetn iciat s rmnms;t) exnmf oy1opDelieilt) rxr(m3oy1ll emiesas) Dtr(r nt1alenifeildfsDrlnvpnu4 eeoif iatomDr ueilt0sruo(m3iu1am elivsl() Drm(  nt1olxnioctatfsDumu sn() renmo iytoptr uvolt  rtm(r ny1op elncsa(fa2ua( pou4tlxnmietlslsDel(mo;u0texrmf3oodom e u i s0t2xr(r3oy1lp   fvt sf rumx p;t4aptnifetat m2rlnmsnt)tlenxr iotlpDelneslt) rur(mpiodlmt  nei ()a2rmxmooo0olxomfeiatls2eanvo;t4 rtriocoydlpt liei t  eur(r oodopee ncs t)aDrmx  no4aex  f3iat a ea(vs (4aexnmoctotfmD auvi;s trxrir oydlleemivi t) 2ta( o;o0aptomoeildfmDeaums ()aeenir tytfptean s t)trxoim iy1olt lnvsl( srta(rpno4alxnmociat m2umuvs u) eeoxf3oatopD  nvol(0srtrirpio4apte fei ( s2uax ono1aleo oetysfmDuauvs;u0tlenmf3io1op  ai s ( tetoimpnu4lmtemfesl(fa2umx pnt1aleoifctasfa ua(vs ()alermr oy1omteaieslt)trxoxm3oo4lm emnet tfaDta( onu1tleomoetlsls uau snt0teermr3tydlpt anvs s  ruoim oo4optn ict t  Dur(m nt1aee mfeiatls emnvs;(0tlxnir3tatlmDelivols0srxmxo3oo1olenmneiat  2ra(mpoo1texoiieiysla ul(vsnt4 rxnmf iodla rlneo;(0s2trxrpnudamenmivs t) 2tm(r nt1aptn icildlm el(ms;t4tleoxfctydoatrauei s truoxmpoy1omte nvtlt  2tr( p;o0tex iiciadla ranvs;t)tleoxo3iydlmDrai i ( setrxm3oydamtnmicsa()srrm(r nt0texo fctasfa eln pnu) ltoxo iotla   neols) rtoxm oydome miei (fs2tmx pnt0oetn feiltla2rlumpnu0teeoifctotfpDrlivo;(0t2toxopou1ll nlnet s aDtrx ooo1tpe iieias m ulnvp;t0 lxoxf3iatlpD lues t  etoio iudomtelnct t)a2rrum ot0tlxoioeiatlmDrm( snu0 reoxf oatlp e ies;s)teuoxrpoodalt mnvtltfs2rru  nt4aeen fctydfaDul(vs;() etrmf3iydomDe ivo ( setm(mpou1ol   ietltf rrrump;o4oex ioetaslsDrlnvpn(4teeoxfctadfp   ivolt)texo(m3iy4lpteliviltf 2urumpot0tex mfeiatla umuvo;u0texnio3oodoaDe uei;t) etmxopiydlle  fctltf Duaumpnu1tee  i3tasfm2eanvp;t) ltnir tytlptelnvsl(0s2xmirpiudopenlieta(farraxrpoo0apx if3iltlsDel(vp;(4altrircoadla   n olt)s2uoim io4lpt lfctlt)s2rmxro;t0tleo oeiltls ea(vs u4tlxnifctytlmtr n i;t) 2xr(m oodll   iet t) 2tm(m ot4tpenioctltla um( on() leoir3iy1lptranei s0 2tm(opno1alt lnet t s2rmxmoou0tpx moeiasfa uaump u4tlenifctydfa  luvs (0setr(r oydll  mivtasfs2tmxmoot1ole mf3tldfm elnmp u4 lenmrcoadfp rln sls)trumiopio1ameelivtls)s2umx pnt0aetoif3ildfs2ulnvo t4tetoxocoytoat  ues;s srum(m3nodlpen nvsltfs2uaxroou0apx mf3tadfa ranvp;t0 lenmociydlp  ai o;s0t2xoirpou1al  mnvi t s2ua(m ;t1texnmiciasls2um(vo;u) exnmr3oytomtraivslt0 rur(m nydal nmivtat  rtr(  nt1olto oeilsfm umnvp t0tltoxo oodoa   ivo;s)srtm(o3oydlp e fct ( a2tmx poo1tpenifciydfmDeluvp t4 leoxociy1lm  aneo;s0teur(m3nu4lm nmfvs tf 2rru oou0oetnii3iydfa uanmo;()aexomr3iatfpt an i (0 euoxo3iu4alee ivtat) Durumo;t4aeeo oetlsfm2el(ms;()aetrmo3ta1oa elu sls trum(o iy4opeelncslsfsrta(  no1oet if3tad s2elumo;u) eenxr3iatlpD luei;t  exoiopnu4lmenlncia( a2rm(ronu0olxnifciltlmDrln s;t4tltrxr3oa1oaDeaues;(0s2umxmpiydlmenmfcsa(faDuaumonu1tlxnii3tlsfm rluvp;t4tetoxo ia1fp eaivo s)t2ur(r oodaptn icta()aDrr( oou0texomoctysfa2uan o (0teenmf oy1om eaieols  2trimpiy1ll nmivil() rrmx  no0oeeomo3iat a2el(vs (0altoif3tytlpt luei;s s2ur(r oydlpee ncsa() rraxrp;u0teeoifeils a rmump;(4teeoxrcta1oat ai o t) 2uoim io4lptemfes s arrr( poo4tpt io3ild s uauvo t0tlxrmfctodlaDeau s s)s2xr(m iodol emnet t  2urxmoou0alxn oetys m rauvo t4 etrio3io1op e i i;(0 rtrirpoy1amtelictls sDtmu  oo4tetomf3ils aDrln sn(4teeoxf3oytom raiei;( t2xmxo3nudlle  fvi t)srtrum oo4tpxo oeiydfaDrlnms;u4 rerio ta1laDelies;()s2uo(o3oy1apeemncsl(  Dua(m nu1oet ioetas mDum(vp t)alxoxf3oa1omtran o t) 2toiopiy4lp e iet () rrr( ono1oeeoioctldlsDrmu onu4tetomf iydfa e nes;t0 exoxr ny4lp  miei s)s2umuronu4tpxomocilt m el(vp;()alxrxo3oo1omt lueol(  exo(o oy1om emies (  Dumxr no0tpto octyt a elu o u4artoxr iytla   nvol(0 2tmim iudal nmneil(fsrumx o;o0aeeomieiltfm emn s u)tlermo iodomDeai o ( texoir3iudame licilt)s2tax  oo0tet mo3ilt m2ranvp (0trtoifcoytop ranvs;()srxr(rpio4lpenlfetatf 2um(r ;u0olxnifeiydfs2ea(vonu0altoio3oydfptr ueol(0sexoxrpio1ap nmiviat)arrmxmoot4oeeo i3ilt aDelnvonu0tetrmocoy1fpDrln i s  exr(o3nu4ll  lfvias s2tm(monu0openio3tatla2emn s u4aexomocoatoa rlivsls srurxopoodlm  mfei ( aDraumo;u0alx  i3iydfm umn o;(4 eeniocoytlatelnesls  rumio3nu4ol n fcilsfsrraurpot0apx iictyslm2ra(vp u0alxoircootomte ies t0srtoio nydolt  iei ()aDtaxronu1optn ieiysfs2uau o;u4aexnmoctydlptr i o s) rtoxrpio4ame  neiasfsrtmxrp;o1optn oeiys mDran snu4 exrxf3tadfa eluvs;(0texr(r3ou1llenlncsat)artax pnu1oltniiciytfa2uauvo (0tlxnmrcia1lpt li o (0texmir3ou4ol   ivt t  Dtax pou0tet iicilslaDranvpn(4 renxrcia1lp rlueo (0 rtm(r nodaltnlnes ( s2rmum nu4aee  i3tad s2ua(mo (0alenir oydopDraneolt)texrimpoo4amtn fvia(fsDrrxro;o4tlen i3iyd a eluvp;u)aeenio oadfpDrlu ols)s2urxo3nudapenmnci s a2um(  ;t0openmfciad a rm(vont0artrmfcoytfm eliei;s)setr(m oy4lp  lnctas)a2rmxm nu0oexo o3iydlm2eau s t0teerxrcoa1oa ran i;s  2umio nu1lpe  fvtlt) rur(mont0aexoiietatfmDumu s;(4aetrxf iytlmte i ils)t2urxo ou4ome mfci sfa2umxr nt0alt ii3iad m ulnms (0trxnmfciatlpDe ivolt)srxo(o ny1lpeelicsl() rta(  no4oee mo3tydla rlumont0arermf iodfaDrln o (0 exoim ou1opeelfesat)s2um( oot4aee if3iytlmDum(ms t4tetoxr tatopDr uvs s)srxmim3oy4lme mnvs (fs2tmumonu0opx mf3iaslmDeanmp t0trtnxfciytlmtelueo;()seurxo3io4olt  nvs tfarra( pno1aeeo oetas m um(mpnt0 rxrxocia1lpt  ivilt0sruo(rpoydapt lfvt ( artmx o;t1tetoii3iaslm ulnvs ()trenmocoodom   i o t t2tm(o3io1omeemfet (fsDraxmoot1oee  fctydfm rmuvp;t)altrio iotfpt lues (0tetrxo3nudlpt  fetasfa2rmxrp;o4oltnmieiasls umn p;(0texrif3iodoaDeli o;t0 etm(m3oy1apen nvta() Drmu  no4opt iiciatlm2ea(vs u)artrioctydomteau i;( t2xr(m iydapen nei (f Dtmxr nt0tpt ii3iasls eauvs;()tetrifcoytoat au ol(0sexo(m oo4ll nmfetltf rtrxmp;u1texomi3tyd a rm(vo;t4 exnxociy1fpt  nei;t)s2xo(m nu4op  lfeta() 2taur ;t4oexoif3tldlm eanvp;u4arxomf3iydfpt luei ( trumxopiu4ll  lnetls) Dtr(r ou0ale mfctls mDeanvont4 lxrmfctydoaD  nvo s  2xrxr oo4altn fcilt srraxm nu1aetnmo3ild s2uanmo;()alerxfcoydfp  ln olt0s2toxo3nydamtnmietlt  rurx  ot1tptnifctlsla eanvp t4trtnircta1lmD lu i;(0srtr(opoydap e nct ()a2ua( pnt0oexn fciys m rmnvpn(0tlxrmfciotlmt aivi;t0 rtrir ny4omtnlfvtas)srrru p;t4alt  feildfa ulump u4 etnmr3ia1lp elu i;s0 euo(m3oo1alt mictlt s2ua(m oo4olto oeils aDemn p;u4 leoxo tatfa elies (0 eto(opoudlpt  nvil()aDtmxm no1oee mfciltls2elu p t4 rxoxf3iy1oate uvo (  2tm(r3iu4llte nvilt srur(  nu4tpxoifeiyd a rl(msn(4trtoifctodfmt  ieils0 etmxm3iu1ape lict ()srta(rpno0texnmfcilsla2eanmpn()altoif3iydlmtrlnei;t0srxo(mpoy4lm n fes ()a2umx oou0oet io3iatfsDeaums t0 exomo iytoa   uesls t2uo(mpoy4lm   icsls)s2rmurpou0alenifciatfs ranvp;(0aetrir3iatlatranvi s)s2xrxmpnudame mfetlsf 2trurooo0open oeiyt m2ul( o;u0 rtoxoctadfat lues;s)teuo(mpoo1al elietl( aDurum ;t0tpe  o3tat m el(mpnt0 rtnxrciydlmtrln o t t2tmxmpou4amenlfvta( sDtruro;o0tpx ifetatlmDea(mo u4 lxoirciytfa rlues;s0s2xm(rpio1amt mieil(farraxmo;t4teto ietad mDuau p;t0trxnmr3iatlmteluvs () 2xr(m3iodlmenmnvi ( aDrr(m ot1tetoiieiadfa rl( o u4trxrmo io1lpDeaneilt)srto(r iodamenlncsltfarrm( p;t0tleoioeias m ra(ms;(4aexrmrctotlmtr ues t) rxoio3io1altnmivils)a2trxronu1oltnif3tatlsDel(vp u4 exnmf3ootfa r nvslt0teuo(mpoo1apeelivtl( arur( pnt1oee  i3ilslmDrm( p u)aexnmoctytla eanvi ()srxmiopnu4lm n nvsls sDtr(  ;t4tpeniicilt mDem( o;u0alerxr3oodopt  nvils)t2tm(r nodap e fcsls)s2tr( p;o0olenmfetadfa eanmsn()aetnxo to1fat ai sls0srtrxm3ou4am  mivsl(  rraur oo0apx  feiyd m2el(vo;u0treomf3tadfaDelueo (  2umimpiy1llen fctl( aDtau onu1tpx ifeiad sDeauvs ()aeenmfcoo1lm r uvolt0 rtoiopnu4omt lnct t sDrmurp;u1oee  o3ils s ea(msnt4teeoxr3to1laDe ivol() 2trxmpoy1ope mneia( s2um(m no0aptoii3iydfs2elnmo;(4teeomr totfpte nvs;()texrxmpoydol   fet ( arum(rp;t4tlen o3tltlmDelump t)arxomr3ia1fmDrluvi;(0srtm(m3nodap  livilsf rumxr nu0tle moctld a rauvs;u0arxrircia1omDrlieils  rtmxopio4oltemnct t) 2uauront4tlen ociat sDea( p;t) eeomocto1oa   ueolt  exmiopiy4op e fci t)arurum ;t1tltoio3ildfm rlnvs;()texoir oatom   ivs;s0t2xmio ny4omt  nvt s  Drmxmo;o4openmiciad m elnmp;t)trtnmo iytoa  ln slt  etmxo no1apee neiltf Duaxmo;o4opt  o3tat m em( o;()texnir3oodom rlivols)texrir3no4lp  mnes ()aDuru oou4tpe ifcilt m rluvp ()aetoif3oytop eai s;t) 2tm(o3ou1altelict tf rrru oou1olxoiocilt s elnmpnu4treniociydfp rlivo s0seumxo3oy4lme mfcs sf 2ta(rpoo4tpeo fetltfs2ean p;t4arxnifcoodoat auvo;t  2uo(o nydop   netlsf rurump;t1tpeo fciys s2rl( s t) lermr iotfpD an i;s) 2ur(r3iu1ape lfvta(f 2rrxroot1opxo ociyslmDelnms;t)tlxnir3ty1fm eluvi s0 2trxm3oy1lltelfeias aDrrxmoou1aleoif3iltlm2um(msnt4 ltnxo to1fmDeluvils t2xrir no1omee ncsls sDtax p;o1apx mictlslaDrlnvp;(4tltrifcia1oat li slt)setm(opiy4aleelfes tf 2rmx  ou1tpenioctatfa elnvont) lxnio iotoaD li i;( teum(r iu1am elfvtat) 2rauronu1apt moetasfsDel(vp;() lenxo ia1lmDrliei;( trxm(m nu1amtemnvta( s2rax p;o4oetn fcias a2rlnmp u4 rxnmo to1opDrli ilt)srtrir3oy1llt mfvtlt s2um(m ;o4opxnmociad a2eanvont)aeerif iadlpD  iei;t)tetr(r oy1alt lncils  rtrx p;t4oeeoii3iat s2rmumpn()tlxnmf iatfpteaieolt)t2tr(opiu1lpeelneil(fsDrrxmpnu0opxnioeiys s2uau s u4teeriocoydfpD luei t srumxm nydlpeemfcils a2rm( o;u1tee ifetas sDeaumont4 ltnxo iodom   nvi t srxm(opnydll e ivi (faDtrum nt0oetn f3iad m rlnmp;u)altrircoy1omtelieslt0t2umxopou4lmtelncsa() 2ua( pnt4olxniiciatfs ulump;(4altoio iodomDraneils0srtmxm ny4omt mfct s) Duaumonu1apt  f3iydfa2uanmp t)tltrif oo1faD liei;t0 eum(m oodlp n fet t  2raxm ot1apeoiictatfa uauvs u)aexnmfcoadfmtrlivo;t srtm(o3ou4lptemnetl(f rua(m nu0olen i3iatfsDem(vo t) eeoxo oatomtelivo t) euoxopoy4al elfet sfa2tr( pno4tpen feiad sDumnvp t4tetoxrctytfmD aneo s t2umxo no1amtn netat) rrrxr ;t1tpenmicilsls umuvsnu)artrmf3totfaDelnvo t) eurxm3iodlmt mneiat)sDuaxm ot0oexomfcilsla2rluvo t4 rxrmrciotfmtr n i ()setoim3oo1alee iviatfa2rmump;o4alt mfctys mDumu o t) eerir3ty1omDe u olt)tetmxrpoy4lle lnviat)sDraxm no0texomoctldlsDumnmpnu4 rtoioctydlpteli s;()trxr(opny4ope lnvtltfa2tax pnu4texo o3iyt m el( s;(4tltrmr io1optelnes s0seto(o io4alt micilt aDum(monu4ale ii3ild a ua(mp t) etnif3ta1oaDrlues;(  rxrxm3iudll n fvs tfartmu o;u0tetomociydfa rm(mont0 ltnxoctodomDr nvs;s)srxrxm ny4optemfvtlt srurump;u0alenifetyd a2ean s;(0texnxf3iodlpt luei (0 rxmxr3io4op nmfctlt  rrau  ot4oee  ietltfs2uluvs t)tlxoxocia1oa  au i t0t2xoxo3ou4lptnmfeilt arrau pno0tlxoii3iyd s ean p;t4alerxocia1omD ln s t)s2ur(o3ny1lptelfetlsfsrrmur ot0tpxo octld s2elnmp;t0 ltrmr tydfp eluvi;( trxoxm3nudameemnvsls)sDrmu o;t0alxn fciatfa2emuvo;u)alxrmr3ootfmtrluvo;()trxmxrpnudlpte iesat)s2ur( onu1tpeo i3tldls2umuvp t)teerxrcto1fmteaiei;s0truoir iy4am n ncs ()sDtmu oot0alt moctytlmDrl(mp u4 etrmo3ia1oat lu o t0tetm(rpoy1lmen fesatfartau ooo4tlx ii3ildls ra(vonu0aetoir tytfmt anvs;t0texo(o oudlleelicsls  rraumo;t4olenmieiadfs ranmpnt)trxnircoo1oaD livo;t sexoxo iodomee icias)aDumu  nt0tetn f3tyt m2el( s;t4aexnmo tadoa r uei s s2xmir3no4al e ies (f Drr(m no1olxnifciyslmDel( s;t) ltnxfctatopDr ivo;s0trxr(mpio4ameelfcs ( aDraump;u4apeo ietys mDumu pn() eeoircoydfpD livslt0trumxopiu4llee fetl(farumxrp;o4tptnif3iadfa2ea(vpnu0arerio iytom r ues ( trxr(o3nu1ale lnvs t)srrau  ;t0apt iieiydfs ra(mp;()alenxf3oo1opt li o;()teumxm3ou4amt mfcilt  Drmurp;o0texoif3tytlm2rauvp;t4 eerxf iadfp r iei ()sruo(o ny1lp e nesltfa2taur nt0altomo3iytlm eanvpnt0alxnir3oa1oa   ivi;t seumxrpiy1lpt  nei sfsDumxm ot1tpeoifctas sDrmu o u0texrxr3tatlat lneils0trxm(mpoudlmeemfvtls s2raurp;o4olenmi3tasla emnvo;u4arerxociotlateau ols0t2ur(r iu4ll   nciat sDraurp;t1oltoii3tys m2ua(vp t0treomfcoydlat  ieilt0trxmxo3nu4ol n icsasf 2trx ooo1optn fcildlsDumnvsnt4 eeoxf ootfm r ivi;s)sexmir iy4altn nvs t)sDua(mpnt0tpenmfctysla2umnvo ()tltrxociydom  auvol(0teurir oy1apenlfeta(f rtr(mo;t4tpe  fciysfsDul(vp;(0 rxniociydla r nvolt)setrir io1ope mncsls) 2taxrpno1teeo fetadfmDrlums u4 ltrif3iatfm elu sls)tetoxopou4op  lfet sfarum(r no4oltnmfcias m emu snt4tlenio to1laDelnvo;t  2uoir nodam nlictl(fa2rmxr ou0teeo octadfaDrmuvp (0aeeomfciy1fa r u ols0t2uoxrpiy1lp  livsl(f rtax  oo1texomietadla uanvp;u)texrxr ia1lpDrluvil()s2xrxr nodamee ivtls)s2tmump;t0tpeoiictlsfsDuauvo;(0tlxoxr3tadlpDrliesls0 exrimpoodolenlnes t s2taumo;u1texn oeiadlaDulumonu) exoiociydoa  lnvil( srtrim3ou4ol nlncslsfa2tau p;t1olt ifctad sDranvo;t)aetnio oydomt luvs (0trumxo3oo1lpenmnvt ( srumu onu4apxo feils s
\ No newline at end of file
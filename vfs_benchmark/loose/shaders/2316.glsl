@@ -0,0 +1 @@
+nvils) 2tmxopny4ape mici s  Draxmono0tex ifciatlmDuauvs;t0artoxrcoydlpDr nes;t trtoxr3iydaltemncias  rtmxrpot0opeoif3iltfaDem(ms;u0areoio3ty1faDrlu i t srxo(o3oudll n fet tfarrrx poo0tlto iciys s2emn snu4tltnio3iadomt livi;s0seurxr3nodap e fviatf Duru pot4tptoif3iadfmDuau o t0tltrxrciytop e uei s t2umiopnu1altnlfes s)a2rmxmoou0alt ioeiat mDelnvon() rtnmr3to1lp r n o;(0tetoxm iu1ale lnvs sf Drm(mooo1alxn iciasfm2ran p;(0aetomfciotlmDelivo;(0 exo(rpiu1lpen fvi ()s2tm(r oo0texo o3tytlaDrl(mp;t) exrxrctatfat au i (0sexr(m oydope miet s a2urxrpnt4texnio3tyslm rlumon(4aetnxrciadlaDeanvol(0srxmir nudam emnetat)s2uaurpnt4tetoifetld a2el(mp;u) eenif3oy1om   neo;( texrxm3nodomen nvtl(fsDumu pnu1teenmo3tydfmDrln s t)artrifctotlmt ln s;t srtm(o nu4op nmfct t) rtaurp;t4alx moetytfmDumu s u4aexoxr3oa1fm r iesls)teurxr no4ole mfvta() 2tr(rpot1tpt iociysla2ran p;(0 exnxfctytlaD livo;t0setmxr no1optelnesasfs2rrxmp;u0opxnmo3tat a2umnmpnu0 eeoxo3ia1lpDe ies;t s2xo(o3ny1omte ivtlt)aDuau  oo4tee io3tyslaDrlnmpn(0altrmociy1lpDraueols)seuoxrpiu4llee fvtltfa2uaum no4tpxn feiys m rmn s;t)aleomf3oa1lm   nei s0 rum(mpiy4alte nesas)aDur(monu0aleoii3iysfaDrl( o (0tetrmf io1fmDrli o s)srtmir oo4lmeemncsls srumurpno4altoif3tadlm emnvo (4trxrioctytoptrai s s trtoxr nodlp nlicilt artrurp;t4tleoifeiyd a2eau o u4 rtrirciadlaDrlu o (  2tr(mpnudap nlies ( arumurpot4oex if3tltlm2em(vs;t4 lxrxocoytoa eluvolt)t2uoxopiy1lle liviat)a2rrxrpoo4tpt  ictatlaDrlnvo (0 ltnmo oa1lmDrluvo t  exmxm3oydopee fciat)srra(m no0oexn oetysfmDrl( p;u)tetnmo oydfa  an i (0texmxo3no1lp  mnvil()s2rm(root1aetnmictltfsDem(mont0 exoxr3oatoat auvs;s trxo(r iydoptemnct s)s2rr( oot1tptn fciltlm2emn o t) ltoioctotlpte i i (0 2to(m3oydllenmnciatfa2raur ot0oeen octyt m2rln pnt0 etnmr3oadfp rln i s  2urxo oodop nmfvils  Drr( p;u0tltn fcildfsDeau p u4texnxfciotlmDrlu o;(0srto(m3io4ole mnvi s a2tm(rp;t0open oetadla ulnmo (0aeenxfcoytlpDraueo ()srurxm ou1lm nmfeiat) Drr(moot4aexo oeiatfm2el(vp (0 leomrciytfat lues t0 exoiopiydomeelici s)a2ta(  ;u1ape iieiysfa rm(vo;t4tlerifcia1opD an il()srto(m oodllen ncs t)aDrmxrono0teeniiciasls2rlumonu0tltrif to1omDe i o (0trtoimpiudllee iei tfsDtrxroot1opeomi3tytfsDelumo t)aetnmfciotlmtelivo;t texmxr oodlmenlnci (fsDurx  oo1oltnmfeiatlsDuluvo;t)aeenio3oo1fm r n o t0 rxmir ou1llen neiasfsrrr(mpnu0alto fcilsls2ea( sn()trtrxociy1fpte i s;(0srtoir oy4omenmncs ( sDrmx  ;o0altn oeiadfm2rmnvon(4aetrmocio1opD  nei s)texmxm ny4lme miesat  rtmuroou4opeoiieiltlaDemu p (4tltoir3oy1opDeai i s0t2umir oy1aptelfvsat s2umurp;t1tptniictysls uluvp (0aetrmrciy1laD luesls)tetmxrpnydomenmncs sfsDtaxrpno1aet  f3tas aDumuvs t0altnxocoadom e i s (0t2uoxo3iu4lmenlnvs ( s2um(ro;u1aexo fctld aDelu o;() leniocoodfm r n o s  rur(o iy4lle mfes s a2ur(r ;u4tetomo3tadfaDemnvo;() lenmrcoo1fa eanvs;(0seuo(mpoy1amt  fcsl(f 2umxront1aleo ieildfm2rau s;u)altnxf3oa1faD aivo;s)setm(r3ny1lltemivil( a2uaumonu4aet iiciltla umuvp (0aetnxo3ta1om  ai o ( texo(r3iy1lm n ivil(fa2tm(rpnt0tlt mfetydfs2uauvo;t) ltnmr oa1omtelies t0sexmxopou1omen icsat) Duaumpnu0tet mo3tysfs ua(vo ()tlenxo3oy1lp   nvi;s tetr(m iy1optnlnetat)sDtru p;t4oetnmi3tydfs2ranmo (0 eermfctodfp r nei s)trumir3nudlp nliei sfsDtaxm nu4aexomiciysls2uau s t)aleoxr iytfm eau s;(0truoxo3oo1al elicias)sruaumooo0apxomocilsfa2rlumo ()tlenif3oydfaDe ues;() 2xo(m iodlp   fciat srrr(rono0texomoeiytla2eluvs;t)tlerxo oa1lpt  uvs t0t2urxo ou4op  lnesl(farur(m nt4aetniietldls rau o () lermf3iadfp e uei;t0trxo(o3oy4al n fesa(f Dtmumpou1ope  iciaslm2emuvo;t) renxocty1la  liesls  rxoxo3iy4aptnlfcsatfs2uaxmp;o1ope mf3iadfm2rm(vp;() renmo3oo1la  au o t tetr(o3iydom elnvta() Dtmurp;t1altnmoctlsfm rm(mp t4 ltrxocta1fmDran i s0trumio3no1op n fesat)arum( p;o0tlt  fciltla rluvpnt) rtrir ia1faDeaivslt0srxm(o3nu1lm  lnct (farua(r nu4oee  o3iatla2ranvs (4teeoioctadfptr uvs;t)trtrxo no4lpenlfvsa(f 2uax  ;t4alt mf3ias m2emn s (4alenmf to1fpt anvslt)t2xoiopiy1omenmnet s)arta(moot1tpto i3iatlaDulnvs u4 rtrmfcto1fa  luei (0 2tmio iudlpen net s) Dtmxrp;u1aet ifctyt sDeauvp u0teerio3to1fa rlieo (0teto(opou1op e ivs t)s2rm(mo;u1oeto f3iltls2emnvp;u4treoxrciy1optr ues;t)seurxm3ou1olt mnvs () 2tmxmp;o0oeenifeiadls rlu s;(0arxnir iotopDe neilt  rtm(m io4openmnctat)srumum nt1alxomfctydla rlnmo (4tltoir oadfatrlueol(  2uo(r3oy4ol emfes (f rrrxr ou0aex mf3tltfs2rln o;(0tlenif to1fa eanvo t) rurim nodlpenlici t a2rmurpnu4aexo oetlt aDum(vp u4 etrir ty1oaDeluvs ( seurxo oy4op nlfes s) Durxmo;o4aptoii3iysfm emu pnu4 ltoifcoy1fpDelueo;( texo(r oy4om n ieta()aruaxr ;u4teen f3iydfmDrm(mo;u4tltniociadfa eaues (0srtrxm3ny4amt mncsls) 2rmu  ot1aetnmo3iat m rmn pnt4areomr3totfa rlies (0tetrxo3ou4lmeelici tfs2umum nu0ale  oeiyd m2eau pn(0texomfctydfmD au s;t tetoiopnu1llee nesl( srrauroou0opxomfciyt aDel(mpnt0artnmo3ty1op eaneo;t) exmim iu4oleelfcilt s2rmurp;o4ole io3iytfa eau p;u4artrxr3oa1lmDrli slt  rxmir3iy4lpenlfviat arurxrpot1oeenio3iaslmDrl(vo;u4 rxoir3iodla ranvo;s0 2trir oy4alen ivtasfa2raxm no0olxnif3tys s rlums u)arxnxfctadfpt livsl(0s2xo(o3iy4am elieils s2rrx  ou4oltomfeildla emu p (0 rtnif oa1lmteli sls0t2xr(mpno4lle mfcs sf Dumu pou0tltniieiatfsDum(vonu4arenir3tydfmt li i;t)sexr(o3ny4altnlfesl()aDtmu  ou4apen ictadla2rl( s;u4 lxoxfciodopD aivs t)srtr(r nu1alenmieiltfsDum(mp;u4tlen ociadls2elu p u)aleoif3iy1fa eaivilt)srumir ou4omte fvsa(fa2raumont0texnifeildlaDuauvp;t0 leoio iadlatr ivsls t2urio3nydaptnmnes t)aruaur ou1altnmf3tat sDrau o;(0arenxr totla e ues ( srtoir3oudalenmfetat a2ua(r ;u1open ictyt a2ea(msn(4alxomf tydlm  anei ( setm(opno4lle  ivsat  2urx p;o4opx moetytls2rl( o u0 exrif3ty1fa rli ilt s2umxr oydlmenlfesa(farum(mpot0opx  i3tltfm2umuvs (0artnmo3iatlmtrli o;s seuoiopny4om  mivias sDtruro;t1oeen oeiatls2emumo;u) ltrio3iy1laDr uesl( s2to(r3nu4olenmfctl() Duru  ;u1tetoiietytlm rluvo;t)trxrmfcio1op r uvs;t sexm(m nu4lmte icsatf 2rmxrp;t0aexnmo3ildlmDrm(monu) reoio oatoptrli o ()sexm(m3iu4al emncil( arumx pnu4ope mf3iadls uan pnu4trtrio3iadlp  lnesls0 2tr(mpiy1lptemnesa( aDurx pot1openmfcildfa2el(mo (4aeermfctydlaDeluei;() 2urio iy4altnmnetls) rurumpno1altnii3iatlsDrl(vs (0 etrmf3oatoa  ln sls texoxo3iydameelnvs ()aDrrum ;o4oexomo3iasls ul(vs;() rtrir iatfpteli il(0 etoxm oo1optnlieslsfartaurpnu4tptnioeiltfm2ulump ()alerio3oo1lpD aivslt truoxm iy4ale lfciat)srtrurpoo0ape  f3iytla emnmo;t4tltoif3iodop rln sl()t2toimpnodll   neiltfsDrm(monu1tle mo3iyslm2rluvo t)tltrxf oodlaDe iesls)trtrxrpiudolenmfvsls)s2tm(mp;u1opt  ieilsfa2eaumsnt)aexoxrciydoate ies;s s2ur(m nodlpe lnetlt a2uru  ot4tee ii3tysfmDra(mp u)trermr tydoa e uvs ( trtr(m io1lp elncias a2tax  oo1optoifeildlaDeanvp;u)arxnirciy1fpDrlu i t seuoxm3oodopeelnctl(  2rruroou0ope  oeiyslmDra(msnu4 rxoxr3todlmt lnvo s0trtoxo oo1lpt mnvs tfa2trxmo;u1openmi3tatla uanms;u4 lxnmr tytfpte nvs t0t2um(mpoy4om n fcsasf Dtmx ooo0tlxnmfciys m ea( o;u4tleomrciatop ranvo (  2uo(rpiudap e nct t) Drmu ono1tpxomoeiydlsDraumonu)trxrifcta1la r uei;s)trur(o3iudamtelieia()srrrum ot0tle  ieiadlsDra(ms t) lermf3iytop r ues;t) exrxm ny1amen fvil( a2tmx pou0tlxomi3ild m2rlnvsn()alenmo3iydfp rauvi;t  eur(r3nu4apt mnctlt s2tr(r nu1apx mfeildls2eanmonu0aeeoxo3ootfpt lueol(0seuo(r3oy1omte neil( s2trxr ;t0alen ocils s elu snu4artnxf3oodfatr uei t trurirpnu4ame  nctas srumxm nt0tleomoeiasfsDumumpnu4tetoxr3ty1lpte neil()s2xoxm3iu1ol  livias s2rr( p;o1openiictls mDeaump u0 rtomfcootoat aueo t0t2tm(m ou4om  lnet t)a2raxrp;t4aexn f3iyt m rlu p;t4 lxrmf tydlaDr uvi ()seurio3nu1olen ncsas)s2urumooo0tpxo octls a ra(vo;t0 lxrif3to1laDeanvo t0trumio3oodllenlnvta(  rtrx o;u1texn o3ild m2elu onu4 lerxrcia1fpD aieil()trtoxr oy1lltnlneiltfaDtmxr ;o4aetomfciytlm eanvs (0arxrioctytlptrlivo s sexrxo3io1lm emivsa()aDtmxmpno4apeoii3ils a umnvo (0 renxrciotfatrluvo;s0srtoimpio4am n ivtat)srur(rp;t1olenmociyslaDemnmont4 etrxo tadlaD lnvo;()trxo(m3iydlmtelivsl( artrx onu4altn o3iasfmDulumont4tltnxocoy1optrluei t t2tm(r3iu1amtnlics ( aDurxronu1tpeoifctydlsDraumon(0trxrio3iotop  ln i t s2umxopiy4omtn icsl(fa2raumpno0tltomoeias m2rmn p;t4trenmr3oydfaDr n o s  exoim3ny4llen ivtat) rtmu ont1oetn fetat m um(msnu)arerxf ootfat  iei t0t2tmir3iydllt mfcsl(f rua(m nt1tpt ifctlt a rmnmp u4 rtoio3tatomt ai i;t) rtoio3ou1op  lics ( sruaxr ot1aet ifeils s2uluvo;u4tltnxf oo1lp  ln s s0 etrxo3nu4ape mfeias artm(r nt1alxn iciysfm2emu o;u)tlxnxf oa1lp ean i (  etm(m3nydal n ivilsf rtaxmpno0aeeomi3ils a2rl(vo t4teeoxfcoo1fa eai o t  2xmxrpnydlp   fciltfa2tm( oou1texnifetltfm2ulu pn(4alxnmf oadfmDeln ol(0teuo(mpnodamenlfeil() Dumx o;o4tetomoeiytlm eauvpn(0tltnxr3iadfat  i ols0trurir3ny1ap nlneiatf 2trxm ;t0texoif3iltlmDeluvsnt0texrxfcoa1laDe ivo t)seto(o3iu4lp n nvta( a2rm( pou0tltomi3iysfa2ua( o t)arermo io1lmDrai i ( srtrimpny4optn fvt tfaruax p;t4oltomoeilsfsDrmumsnt0 lxomr3iy1oa rln i (  2toxr oy4alee icsas)s2umurpno4ape io3iadfs2ea(mo (0 etrmo todom eaieo;s0 rur(o nydapte fet sf 2rrxm nt4tet if3iltla ulu s ()tltoxocoydla elivo;t  exmxopou4llenmnetasf rtmxronu0olen i3tltfm2uanvs;t0aeerir3oydomDelnvslt teumxr3ou4al  lics t srrax  ot4altnioeiysfm um(vont)texnif oytfp  an o;s s2xm(rpoodaptelietlsf 2raurooo1open icias sDem( p;t0tltoirciydlmDe neo t) ruoio3iy1ome livsltf rrr( o;o0ope ioetasfa uau o u4arenxf3oodlp raueil()t2umirpny1omtnmnvt sfarraurpnu1oleniietydfs ean snu0tlxrmocoa1lptr u s t)teuoim io4apeemfvt t)aDrr( p;o1aeeoif3iat aDrm( sn(4aetrmfcoo1lptraivslt) 2toxmpiy4lmeelnvsl() rraxroot1tlt  f3ild s umums;u) eenxociydfp  ln i t trxo(m3oo4om n ivslt sDum(  ;t4opx  oeildlsDra(mo t4 eeoxf3oa1lmt  i s;t setm(opnu4lmte fesa()aDrm( pnu0apto o3iadfmDrln o;()alxnio oodfa rauvi;s) rxmir ny1optn fctas  Dtr(r ot0tpx  ietyd s2ulums;() etriocoadfpte uvo;t)srtrxopiodapeemivia()a2uaur ;t0oet  feiydfs ea(ms (0arenir io1om rauvil()t2trxopiy1om e netlsfsrrmum ou0alxnmoetydfsDem( snt4 rxrif ia1fm elieslt trxr(rpoo4amtnmivilsfsDua(mp;u4ale moetltfsDel(vpnt4trermf iotlp  livi s  exr(r iudlltemictl(  rtm(mp;o4aeeoif3tyt sDelu pn(4texoxr oodlm eauvi;s seumxmpiodlpte nci tfa2tr(m ot4tpeoifcildlaDemu o t) leoxocia1faDe iei;( seumirpiodop emnvtasf 2ur(m oo1aet iieiadfm umnms;u)arxnxf3iodomDe ivi s)tetmxo3nu1oltn nvils  rrr( pnt4oet ifciaslsDemnmo t4 rtoif oatoptrlu s;s  rurirpoo1olt lfctasf Duaxm ot4ape mietatls umu s u4tltnif3iotomt  neo;() exoxr3iodlpe  ici sfsrumxr oo0tpxn oetyslmDrmu s;t4aexoio todomDrln s;(0srto(m3nu4ll e fetat  rtau pnt1oltnif3iatfsDul(vs (4 ltomo3tadfat auvs;( s2tr(m no1llt mivsls  2urxmoou4tlxn i3tydlm ra(vpn(0altnmoctodfaDeanvolt)trumxr nodll   iesasf 2rmxr ou1aeto oeils m eauvsnu0alenxo3iatomtraieil()s2tr(rpnudapenlfcsas)arrmum ;u1aee  o3tatlsDuln s u4artoxrcoytop raies;s t2tmxopny1altnmictasfaDtmu p;o1altoiociysla ea( s (4tetoxf3to1fm  lu olt0trtoio3iodol  lnet ( sDtaumpot4texoii3iltlsDran s u4artnif3todopDeau o;(0t2xoim3nudomeemnvs (f 2tr(mpnt4aex  feildfsDuau p u) ltnxociadop elnei;t t2uo(m3ny1ope  fcils)a2uaumoou4apt  octysla el( pn(0 eenxr3iadlaDr i ilt)s2umir3ou1op nlietas)arrr(rooo0tet iieiysfa ea( o;u0alxrir oydomDrluvs s)trto(r3oydape  nvi () Drmu oot4oeeoifciys m2rlumonu0 ltrmrcty1la r n o t)trurio no1op nlneias  Dtm(r oo1opx  i3iys a uln o;(4arenir totoaD lueols teuo(o3ou1alt micsls) rururoot0tpx  f3ilsfs2rm(ms;u)trenir3ootfmD aues;t)srxm(r oudlpt lfet t s2uau pno1tpxoiieiytlmDuauvs (4 rxnir to1fp r nvs;t)seum(rpiy4lleemfetls)sDtm(rpou1alenmfcias m eanvo;t0aexrmo tytopDe uvs;s trtoir3iu4ame lnctl( s2rrxr ;u0aleoioeiatfmDrm( o t4 etoioctatoptr nvi;()sruoxo3iy1omtemfcilsfs2taxr ;t4aleo f3iltfsDua(vs (0aleoxfcoydoa  an o s srtrir iy4llt mivs ( sDrmxmoot0texnmoeiad aDuanvs u0aexoxr totlmDrlivols trxm(m nu4amtn ncil()arumurpnu1tlt mfciadfs2rl(vo u)tetrif3todoatraivs;() rum(opny1ame mfctasfaDrmur ;u1tltoifciasfm2emnmo;t)arxrxr3oo1la e nesl(0sexmxr3oodom nmnvt s s2taxrpnt4tleoiociytlm ra( snt0teeomf3totfaD  u i;t0srur(r iu1llenmies () 2tmxm nu0aetnmoctatfsDul(msnu)tleoirctytfmD lnvs;t srxo(opiy1om emivta( a2ua( ont0oet ifetad sDrl( snt0trtoir ty1lpDr ivs ()tetmxm iy4aptnlici () 2uaxrp;t0ole  ietasfaDulu o ()altnxr3todfmtrai s s0 rtmxo io1ap nlivilt srrmurpot0olx iictatfaDrmu on(4alerxfcootom elnvi;t srxr(r nu1lpt lfesls srtrxro;o4oee  o3tatlmDel( pnt0 ltnio3oadfa  anvol(0 2trio ou1olen fciasf 2tm(r ou1tee ifetldfaDrlnmo t4 rxnio oo1lpDr ieo;s)s2xm(o3nu1apte ivil(fsrum(r ;o1oexn o3ias s2um(vp ()texrmocoytla raivi;s setrxm3oudam e fvs tfa2ua(mont0alt ifctadfm umnvo;(4 exnifcio1lat  ueil() rxoirpny4lm nmnesl( arta( o;t4tex mo3iatfa rm( ont4 eenir io1lpteauvolt)srurim3ou1lmeemfetas) rrmxront4apto ieiydfa2umnmpn(0 eerirciytomt aueils  exoxopnu1lmenmnviatfsDumxroot0oeeo octatfs2ulumo (4altoio3oadlateanei s t2tr(rpoydolt lnctlt artmxrpnt0olxnmfetad s2ea( p t0tlxrxf iodfmD anvil(0trurxopoo1ap elnes (f rumx  ;o4tee moetasfsDea(msn()artoio oadopDe nvs;s0 exr(o nydale  ivtas) rraur nu4tlt if3tldlsDeanvpnt0 exrmo tydopD au s s srxoxmpiudale mietl(f 2rmxronu0optn oeiltlm eln pn()aetnmociatfm  aueils  euo(mpoydlpt mfcias aDrmu oou4tltoii3tys sDulnvo t4teeoir3todlm e i i;(0s2xoxmpiu1apt  nvt ( sruaur ;o1tee  o3tadfm2rlnvont0aetoxo oa1lmtr ies (0t2toir iydamenmivt s)a2umx p;o0aetn f3iaslm2el( p;t0 rerifcootomD  n i t)trurir oudam  lnvsat)srtr( onu4tpe moeiatfaDrluvs;t4 exrxf ta1fpDeaieil(0srxo(o ny1lpee fes tfsrrrxr no4ope  i3iasls2umnvpnu0aetrxfciotfpt lnes;t texrxr3iudlmenlnct tfa2tm(rpnt1tpe ifciadfa2eau s (4 eenmr oytfptr nes;t srxmxrpno1aptn nctl() Drr(m oo1apx miciatla2uanvs t0tlxrir iatlpDrai i;s0 exmimpny4lp  liei ( sDraxrpnt4opx if3tys a2ulu o;() eeoxocoydlaD li olt)s2xoxmpoy1lle mfct t srrru poo4aex mictydfmDumnmo (0alxoxr3oytfmtraiei;t0sexoirpio4opte fetl( sDta(mont0tptnmieilsls rm(vp u) ltrmo3ia1omDr ueo s) etrirpnudol   ncsa( aruaxmp;t1aptn oeiltlmDeau o;u4altnmf3iotopDe i i (0srxoxr3nudopte ncs sfaDuaumont1tltomoetldfa2ea(vsnu4areoxo ootlp rauvo t0srtmxr3oy1ame livsa(faDurx oot1teenmfciasla emu p u)alermfciadoa rln ol() 2umxo3ou4oltelnct tf rrm(r no1tet ifctlslm ean p;(0tltnmr3oa1op r nvils  rxmir3oudaptelfvt ( arrm( o;o1tpeo ocilsfs eaumo (4trenxo3ootoaD lnvo;t) etmir iodlptemfeslt)sruau p;u4tptomfctad a2ulu s;t0aetrio ootfa eau s;t0srurir ou1lm  lfvt (faDrr(r no1tltomf3iydfaDem(mpn() rxnmo3oadfatr nvi s)s2umxr oy4omte netl(  2ta(  nu1oeeoiieildla el( ont0 leoxrciy1op  anvs t) 2xoio3nodalt mnctlt)sDraxrpnu1oet  f3iys s2umnms u0 rxoxo3ta1lpt  nvi;(  rxr(mpiudole lici t) Dra(  ot0teenifeiadlaDuluvsnu0trtoxr iatfp eln s;t)trxoxo3io4aptelnviatf rtrxr ot1teenmfciatfa2rm( s t4artnxr3iotom rauvi ()srur(mpny4lmtemfcsls) 2ur( oot1oexniietasfa rmn onu0aleoxociytoateau ols  2umim3nu4ll nmiet s artmxmoou0ale mi3tldfa2em(mp t0trtrxr oy1fm eanvsl(0trxmir3ou4al  lieia(fartax  ;t1tpxo ociatfa el(mp t0 reoxo oo1opD anvil()t2umxo3oodlm nmivsls arumx oou0apxoif3iltls eauvp;t0tetnxf3iy1lat  n olt) rtoio iydole lnesasfsrta( onu1tpt iiciaslm2ean p;(0 lerxf ia1opDelnvo t srtr(opnudllen ieil()sDrmur nu1olxnioeildfs2rlnmo ()tltomrctatopDe n i ( srxrirpoodllt lnvt t  Dum(roou1opx mf3iat s ulnvpnu4alenxf io1late i o;(0 etoxmpnydap   iciasfsrtmumo;u0ole iociltfa elnmo;u)aetrmo io1fm  li slt) ruo(r iodlle lnesltfsDtr(ro;u0apxomociatfs ul(ms;()tlerxf oo1oateliei (0texmim oudam   nci (fartrur ;o4tee mfciaslm ua(vo;()trenmo3oadfaDr i s s0srtrxopoo1amte fei s  Drru oot0opt io3iyslmDem(mont)texoiocty1om raueslt)s2toimpio1lp n fvt ()s2rrur ;o0oltnmfciat sDranmo t0aetnxfcoodfmDelu s;s)sruoirpnydalenmnvta( sDtaxr ;o4oeenif3ilsfa raumon(0 etrio todlaDraneo t  eur(mpiodop   feilt a2urxronu4tle mo3iadlmDel( p;(0trxrmo ta1fmDrlieils0teum(o3oo4op n fciatfsDrr(m nu1teenmi3tatfs2emums (0 ltoxrcoa1la elu ils) rtm(r3iy1lpt mivi tf 2rrurpnt0alt mo3iytls ulnvo (4 lxrxfcoodlptrli olt  2umxm3ou1altelictlt)a2tmxrp;o0tpenmfciyslm umumo t0arxrxf totomDrlu i t)s2tmxo iy1llenmneil(  Dtm( pot0oltnmociltlm eaums;() lxrircoa1opDeaies;s) 2xrio oydoptn fes tfa2taurooo4aexn o3ias a2um( s t) eermf3iatoaDelnei;s)tetr(m iu4omtelieias)srtr(r no4altniictysla ran s u0alermf3to1omD li ils)texoxmpnu1ole  ivslt) rururo;u4tltomociltfaDelnvonu)aetoir3iatomD  ivo;() etmxo3iydapeelfes s aDrm( pot0olt moetatlsDulu pnt0 etrif3iodomt lneo ()trxo(o3oo4lltelnesls  2taxmooo1oltoiieiydfa em(vs u0teenif oy1fptrlnes (0seum(r nydlp n ietl(  2uru pnt0aptnmfetatfm2elu s;u4aeenxr3io1lmt aivslt texrio io1lle mnctlsfs2umx  ot1aeenmfcias mDem( o u)trenif oytlm ran olt0 rxriopoydop   ncilt)srtm(r ou4oexoioetadlmDemuvs;u0 lxnxfciotfm r nei ( s2urxmpnu1lpen neslt aDua(rpnu1tleo o3tldfm rl( s t)aleoxrcoadlpteau s;s0t2xmim ny4lltemnci (fsrtaxmp;t4tlxomi3iasfaDemump;u)trxnirciadom rluvo;t)trumim io4lle liviat)a2rmxm no1olxo ictatfs rlu s u4aexoxo3oytopt lu ols0 rtmimpio1amenmfci sf rur(  ;u0aetn oeilsfs em(mo t4alermf3tadoaDr uvilt) 2xmxm3nu4olee nct (  Dtmu  ;t4opt moeiytfm emuvon(0teermfciydfp raieslt texmir3ny1lleelivtasf Dumu  no1optoifeiatfa umu p (4alermocoo1oatraivol()srxrxr3iydom nlncs sfs2rru pot1tptnmfctltfa2ulumon(0aetoio todfat  ivi;t  etrxo3oodlpte nvtl(f Drrxm nu1alt iicilt m rmuvp ()aeerxo3totla eluvslt  ruoxo no4ll nmnetas  rtmu p;t4tlxn i3iltfa ul(vpn(0tlxrir3iatoateln i;( sruoir oudop  miesatfsDrmu pno0tltn fcils a ran s;t)tltnxf io1faDrlneil()truoxopoy4oltnmnvtltf Durxro;o1tleomfeiatfs2ulu p;(4teenmr oadom rlueo;() 2xmxm3no4om e net t)arrmumoot1oexoii3ild m2ulnmo u)alxrxf3totomtrlivolt  eurxo iy4lp  mnetasfsDrruro;o1tetn ieiysla elumpnu0 rtnif3tydlaD lnvol(0trxo(opnu4opt lnei t artmxrpot1tltomfeiydfa2eaumsnt)alxrxrcoy1fp  luesl()tetr(m3ou1ameelncias arum(moot4tlxn i3ild sDumn p;t0trermocoy1opt lieils0texrir3iydlm e ivslt) Dta(rooo1alto feiyd m ra(ms;u0tlxnxoctatfaD anvi;s0 2urio oy4alenmnctls)srtru o;u1aexnmiciat a rmnmonu) rxnmr tydlat aieslt  rum(opnodalt mfetl( s2tm(ro;u4tetnmociytlmDemuvs;u4treoif3oy1laDe nes s)tetrim oudol  lncs ( aDrmumo;o4teen octlsfs2em(monu) renxo3tydoat  u s;() etoxo3io1ape mnetas a2taxr nu0alt iicildlm uaumo u0teerxociotopt  nvsls)setmim3nydopt lfei s s2umxr nu0tet  f3tadfa2ra( o t0aexrmr oydom e uei s)srtrimpou1olenlnvtlsf Dua(  ;t0alxo fetyd m2uaumo;t4aexoxfcoo1fpD lnei;(0 eumio nu1llen ncs ( arumxrpnu1tleoiociyd aDrm(mp u)artriocoatfpD  nvilt  rxoxrpou1llt mfcias) 2uaumoou1tpxomi3iytfsDelnmp;t4tleomrctotoaD an ol() exr(o3oudopeelfeil(f rrm(r ot4apt mictasls umums;(4 rerir3iotlptrluvolt)tetoio oo1ome mietasfa2urx o;t1olto oeiaslmDraumonu)trenmo oa1lp r i ilt) 2xrxm3nu1ol nlfesatfs2rax  nu0texnii3iasfsDrl( pn() renxf3io1oa  auesl(  eurio3iydape mnci tf Duru  nu0opx  ictlt sDrmuvo;(4texrmrciatlmDrli i s0 2ur(opoydom  mfvil(fa2umxrp;o4apx ioeiysfs2ua(vont4tlxoircoadomD  ueil(0t2umirpiy4op emncs tf ruaxm ou1alx mfeildfaDea(ms;u4 leomrcia1oa  aivi;s) etrim io4olte fvi s) 2rmu o;u4openmocildlmDrm(ms (0aexrmoctodfmDeln slt srur(r3ou4aptemnvsl( artmum ;o4apx ii3iys s uauvon() lxrxocio1fpD ai i;(  2xm(m3nudome  ictasfs2rau onu1apeo o3tls m2eanvp (0trtomo iotlmtelivs s0sexr(o3iy4am emncs ()srumu o;u4alen ieiatfa rln p;t4trtomf3iotlmDelnvi s)t2xo(opiudolt  ics tfa2ta(roou1tpxoii3iytlaDem( s;u0arxnxfciadlp  luvo t0t2toxmpno1aleelfet s)srtauro;o0aeeoiocias mDuan snt0tlenirctatlatranvols t2tmim ny1lmenmfcias  Duax poo0olenmieiat m eanvs;t4teermrcoadfptraneo (0s2uoxr3nudlpt lfeilsfsDtrurp;o0aleoiicild a rmumpnu4 reomrciatomDeauvo;(  rtrxr3nodoltelieia() Draxmpot1aexomociysfa rmu s;u4 ltrmfcootlp e ivo;s0 2xmir oo4om   fetltfaDtmur nt1aexnmoeiatfa ulnmsnt0 lxnir oo1fpDelnvol()s2xoim3oo4lp nmivil()sDtm(ront0olxnifetytfsDemu ont0alenxociodlmDe nvslt0 2ur(rpoudopeelnvslsf rua(  nu4olxoifctltfs um( p;t)tleoxo ootoaDr nvo;( seumxr iu4ol  lfctltf 2taum ;u1tpto ictyslm2ra(mp;u)arxrio3oytfmtraneo;( tetm(r3iydalt  icsls aDurumonu0tex iictld s raumonu4artoioctytfmD auvi;( srtmir3ny1lp elnvsas) ruaurooo0apt  oetasfs2rmums;(0 lerir3oa1oatelivo;( tetmxr3ny4lme  ivsat aDrru onu1tpeomo3tytla2uanvo (4 lenmr3io1fmt  neo t)sexmir3no1lpee nes t)aDur( o;o4opeoiiciysls ua(msn(4arxoir3oo1oate uvs t)s2trxrpnu1omeelfcsl(farra( p;u1tet ifciatlmDran o;(4artriociadfaDe ivs s t2trir3nudomenmfeta() 2umxmooo1tltn icils a em(ms ()tetoio totom r u s ()trtmim3iydllt mfesasfa2rrx  ;t1ope ifeiltla2em(vs u4texnxr3iydfmtr n i;(0 2xr(o3oodame mivi sf rrm(m ;u0opx moetldlm2ulnms;t0alerifciatlaDrln s t setm(mpnudlm elfeslt)a2ta( ont0tpeomoeildfa rm( p;t0trxnio3iy1lp rln i;t)trtrxm3oydlm elfcs (  Drrx ono0altnifciys a2ua(mp t)aexnir iotomDean sl()sexrxm3ou4ap  mncias)arrm(moou4opxn feilsfa2rl( s;t4artnmr3iotlm e ieol( srtm(opoy4aptelnvi t)a2uaurpnu1olt mfeiadla2elnvsnu) etrif ootlptrauvols0tetr(o3nu4apenlfcilt  2ta( p;t1open oeiydlmDuauvs u0tleoifcto1la eliei s  2xr(o3oo1ap nlietl(fsDumx oou0apxoifeiad a2umnmp;(0aeermrciotfp  an il( sexm(r3io4olt miesl()sDumx ono1tetomfctyslsDra(vonu0aeeomr iadomDrlieils) 2uo(rpny4om n fcia()artr(rono1olenmieiatfaDumnvp;(0trxnif3iytfaDr n o;s0srxr(m3iy4ameemfvsat)s2um(m ;o4teenii3tld m rl( s;t4aleoifciy1lm e n sls)texoim iydamen ivilt) rrrurpnu4aptomoetadla2ranvp;t4aeeomf tadlmtrli s;t srumxopoodlpe lfeiasfs2rmxmo;t4tetnmoeiad a2eaumon(0 lxnif3iatfa rauvsls0tetr(m oo4lmenlfesls) 2ra(r ot0aetnmociytfa2el(vs;t4 renmf tydfmDelnesl(0 2trxrpiudoltn fcs ()aDrru  ;u4tee io3tld a ra( p ()alxrir3ty1oat lu sl(0t2xrxm ou1ll  lnetat)srta(  ou1apx mociytfsDraumpn()trxrxf oodfa elies s0 2tmimpnu1lpt mncslt) 2um(  ;o4apt mfeiyslsDeln snt4aeermfciydfm eln olt0 2urxmpny1lm e fvtls aDrmurpnu4tpt mo3ildls emnvont4tetrmo ta1fp r ivslt) 2xm(o no4om nmfcilt s2rrumpnt1alx iiciys a2uaump (0 etnxo tadla r ivs;(0 2umxo3iy4apt  fcias a2tm( poo0opxo i3iatfm2elnvp;u)altrircoytop eaneo ()t2tr(rpiu1apenmfvilt  Dta( ont1oet  f3tlt m2rmn s u4alermr oatoa r ueolt trum(r nudopt lfcias)aDtm(  no4opt  fctysfsDrmu s (0 exnxfctadlm eaies;t0s2xoir nu1alenmnvs sf 2uaxm ;t4aee iiciyt m rm( p ()aexrmo3tydfatran s;s texrir3nodolee fcia()a2rmxm no1oexoifctydls ul(vp u)alxoifcto1omD aneol()trtm(r3nydal  lneias)sDrmur ou1oltnmietyslm2eanmp u4 lenmoctodfpD au s;s seurxrpiu4lltnlieta()a2uaxm oo0aex io3tydlmDeanvpnu0altriocoa1lmD au ils0t2trir3nu4apeelfvs t  Durxm ou4alenif3iysla2eln o t4tetomf3iodlptr u o;(0teurio iu4apee fvsasfa2rm(rp;u0tltnmfciltfa2rmn o;t0teenxo3tatlmtrlu o s s2to(m nu1lltnlnci (  2raxro;u4ope ioctat m2el( onu4tlenircoodop e nvi s0tetm(rpnudale mivt ( a2raxrpnt1aeeomociyslmDea(vonu) reomf3iytoa eaueo;s0s2tmir iodol elfviat  2ur(moou0oetoiocild s rmuvpn(0trtnmo3iodfpteliei (  etr(o no1ll  mnvi t)a2ta(  ;t4oeenio3iadlmDeluvs;u0aexnirciytfa rluvslt0teuoirpny4aptnmiciasf Duaxm nt1tpe if3ilslaDrmnvp u)altrmo iotfmDeau o t) etmir3iodll   ietat)s2ur(m no1tetn i3tls s2rmumsn(4artomrciytfp eauvi;s0s2xrxrpnydaleelnvtl()artmum nu0tlenifeiytls rmu o;t4trenio3tadomte n i;t setr(r nudoltemivia(f 2rax  ;u1texnioetys aDel(mo;u0 lermo3tatlpDeln i;t0trtrirpou1optelnctls  2ta( pot1ale mieildlm2rmuvs t4 rerxociy1fp eli il( tetrxrpiydope mnvslt  2rr(r oo4opeo iciatfs2umu snt0 etoxf iydla e u o t)srtrimpno4omt  icilt srumx o;o1olen ietydlsDrm( o (0arxnxr3tytopt  i slt s2xmim3ny1amenlfct (fa2uaxr ou0aee iicilsfa uan o;t)artrif3iotlat ln s;() exriopnudome micsltfsrurxmont4teenmoeiysfaDrm( o;(0tetnxo3tatomtrlueslt0seurir oy1am elivt (f Drmx pnu0openioeiasfm umn s (4 ltnmf3iy1faDean i;t0trur(rpnu4amtemfvtas)a2umu p;t1tltnif3iadfaDea(vp;t0 rxrxoctatoa e iesl() etrir3iodol emfeiat artaum nu4aexnmicils mDulumsnt4artrmo oo1fa e iesls0t2xo(r no4lm nlieilsfsrtmxmp;u0tptnmfciatlm elumpnu0 etnmf3oy1fmt  ivo s)sexmxopiodaltemfes t)sDrm(  ;u0oexnif3iytfa2rlumsnt0teeoio3ootlaDeau o;s0trtoxo3io1alee ivt (f 2rmumoot4aetnifctltlsDrl(vs;(0 etrxo oatopDrlieolt0 etrir3iu4optnmncs s) 2trurp;t0aet mo3ilt a umuvp u)aetnio iy1oaDr n i;( s2urxm3oydlp elnctlt)srurx oou4opxnii3ilt m2rlu pnu0 rxnif iatlmDeaivs;()texoimpoo1ap   fvi s s2umumo;t1aetnmociyt m2rmnmp t)aeermo oytfaDrai ils  etm(r3io4olt  fviat  2tm(  oo1tpe  i3ild s2eauvsn(0tlxomo3totfate i o s t2um(r oy1op e neias)s2ua(rp;u4opt ifetytlm2rluvp u)aetomo3ia1opDrlu i s0 2xoxr3ou4altemietl(fs2rm(mpnt0olx if3tysls2ul(vs u0 lxomr3oy1optrluei;t0 etoio oo1alee nvta(faDtr(  ;u1opx ioetlt sDra(mo u4 leoir3to1lpte neilt)s2toxr3nydame miesa(farrr( ono1opx ioetydlmDeluvs;u0tlenmf tydopD lnvs;s) 2toxrpno4ol nlfcsa()arua(mo;o0tex mfeiydfa rmnmpnu0 exriociodlatr neo;(0sruoxm iy4ole mncsl() Dtaurp;t1alx mieiydfaDrm(vp u4aetrxo3iy1la rlnvo t0seumir3ou4am  lnvi s)srta(m nu0oltniieilsfs ra(mo u0altnxr3totfpt anvo t) rurxmpnu4lp  licias s2umxrpot1tetomf3ilt a2eaumsnu)trxrmf3ty1fa  lu s;t t2um(opoy1ol n nvtat  rtrxrp;o1tpt mo3iyslaDranmont4 ltnxo3oy1fa eluesls truo(r3no4apenlivt s)a2ua( pnt0apx iieiasfa um( o;u)artnmo totlat ai s ()texmxmpiu4op emnetat) rraur ;o1tlxnmf3tat m2rau snu0 exoio3to1fm e nvols0t2ur(m3nu1lp nlfcils)s2rru  ;o1aetoifciytlm rmums;u0 lxomo ta1oa ean o;s) 2ur(rpiydal elfvi t  rurxrp;o1alx moeiydla rlu p;u)tetoxociydlpDeln o;t)trto(r iy4amenlnct t)sDraxrpoo1ape ii3tadfaDra( p (0teenircootfpte nvi s)t2tmxmpio1om  micslt s2taurono0apto oetldlmDrlnmo t)arenmf3oo1faD  ivols trxoiopiy4lm  liei () Drrumpnt0ale mfctasfm umnvpn()tlenmo3oytfaD lnvs t) 2uo(r io4al nmfvtls  rtmxmono1alxn ieiytfs rluvpnt)aexrif iotfp ranvs;s0trum(m iodlp elneiltfs2trumpot0oexnii3ilt aDrm(vonu4alerxr iodoatran i ()s2xmio ny4aleelnetl()a2rrum nu1aptoio3ilsfa2uan snu4arerir3ta1laDelu ils0t2urxo3nudalenmnes ()s2ta(mpou1oexoifeiasfsDemnvs;u)aetoiocoytlp e ivs;t)texm(r iu4lp e nvtlsf rrmxm oo4tlxo icildlm2rluvp;(4aeenir3iodfmt li i;s s2umim3oy4aptnmfvils aDurum ou0apenioeildlm ea(vs u0arenir3oa1lm e n olt)trxrxopno4ol e ies (  rtm(r nt4openmociydfaDea(ms;t4areoxo3oydoptraieo () exmiopou1lptemnes tf rur(rp;u4optoio3ilsfsDuluvp u) eeomo3oadlmDrlues;( seuo(o3ny1oltemfcil(fsDrrx p;u4alxoif3iytfa2rauvp;(4 reomr3todlmteli o s)teuoxm3iu1ol e fcsat)srtax pno1olxoioeiys sDraumo;t0aexrxr tytfp  aueo;( s2uo(m3iodlpee fetas) Dum(mpot0tlxn ieiltls2ul(ms;t4altrxrcootoatrlies t0seuoio iu4ol  mfet t)srtaumo;o1tlt  feilsfsDuau p;u4 rermocoy1omDean s;t  2xoxo ny1llenlnctlt arta(mo;t1apen ociadlm2raumo;() eeoir tytla   uvols0 etmxr oo4lme lnvia(f 2urxm ot1altn ictadlm ulnmp t0tetrmo3oadlp   ies ( s2xrio3oudlmt lnvtat)a2tr( p;t1ape mf3iyt a emump (4altrif iy1lmteluei (0s2umxopiy1lm nlnvs tfs2rrumont0apx mfetlsfm2elump t4tleomociydoateaneslt0t2tmio io1al  miei sf 2rmxrp;u1alx mfeiatla2ulnms;t0trxomfciy1la eaueils  exrimpnu1op e fvsltfaDtrx o;u1apt ioeiadfmDrm(mpnt0tlxoxfcia1om r i o t)teurxo oydlltnmiviasf Durxrpnt0tleo ociys aDelu ont4teeoifciy1fat lnvo;( trxo(r no1opeeliesltfsrtmumpnu1texomi3tysfmDea(mp u)trenmo3oy1lptrlnvi ()s2umim oodoptnlnct s  rtm(r nt1ope  ietldla rluvo u0texoif3tytlmte u s s0setrxmpoo1lmenlnvsls)arraxmpno0aex iietyt m2el(mp;(4alenio ty1laDe ueil( setmir ou1amt  ivtlt) rtaxro;u1ale mfctyd s eaums;()teeoxf iytoa  lu i (0s2urxmpiu1lpt  fciltfsrurxrpno4aeenifeiad a2eau p (0 exomo3iatlat ln ol( setrxmpnodlmtnlnci ( srtr(  ot4altnmi3iat s ranvs t) ltrif ia1lpDr n o;(0 ruoio3oo1opeemfvilt)s2umumont0oee ii3ild a2emuvs t4 leoxfcoy1omDr iei t) 2trxrpnu4amtnmncsat  Drm( pnt4aexniieiatfmDulnvp (0aeeoif3oatfm  an s (0s2tmim3nydap nmnctl() Drr(ro;t4opx  i3tls s el(vp u) exnxrctydlm  aiei;() 2umxo iy1opeelieils)srrm(mooo0apt  oeiadlmDea(mo;() ltoxf3todfatrlivo;(  rxo(r ou4am   ietatfs2urxr ou4tleo f3iysfm ran o;t4 leomr iydop rau il()srtmirpiu1om  lieils) rtmxro;t1apxoif3tad s2rlnms;u)aetnxfcoytfmDrln il()seto(m3nu4alen ieiat arta(m oo4texn ociydls2um( o (4arermfctotom  ln s;t)t2umxo3nodame lfci t srrrxm ot0tlen iciadfm2uan o u)tltoxr io1om e ieo t t2tmirpoy1altnlfct t)aDur( p;o4oleoio3tld a uanvo ()arxnxociodlmD  ieslt)trxo(r3nudop  mnes ( a2rau  ou1alenmi3iyt s2rlnmont4arxrmf3iadla  aivsl() 2toxm io4aptelfvia(  rrr(ront4opx if3iytla rau snt0trenxr3tatfmtrlu s;t0setrim3iu1omt  fvta() Dta(m nt1tpe  o3iltfm2uan snu0areriocoo1oaDr ivo () 2xrim3ny4altelicsasf rtmumo;u4olxnioetatlm em(monu)arxnxfctytlpD  iei s) rtrxr3oy4lpenmnvil(fsDtaxmpou1aptomi3iytlaDum(msnt0alerxo oatfaDeaivi t) etm(mpoy1lltelnci t)sDuaxmpoo1apxomietlsla eln pnu4arxomrciy1oatelivo;s0 2trxm3oo4lmtn neias a2rax o;t0tlt ioetad a2ea(mo;u4aetnio3ty1lptrlnesl()t2to(r iy4lme  nvtl( srrr(rpnu1apx mf3tad mDel(vont4tlxnir iotlmDrai s t) rxrxr3nu1open nvil(fa2rrurpot1tltnii3iytfa ra(mo;(0 etrmf ootla r u o;(0trtmir3no1opee ics s) 2rmurpot1tet mieiltlaDua(mon(0arenxocio1lp  lieols  2ur(o nodlltnlivi () rurx  nu1texniieiysfmDean p;u0tetomfctadla ranei s0srtoirpoodopee iviat a2tmxrp;o0opt mo3ildlmDemnvp;t0aexrmrciatlatrauvil() 2tmio3nu4lltelnviasfartm(r nt0aex iieias a rm(vs;t4texrif3iatfmtraivs t) 2xrxo3iu4lmtelfesasfaDtmurpno0oltomoctatlm2eanmo;t4tleomrctodom eanes;s s2xo(r3nydapenmfesa() rtaur ;t4aexoifctldfm emnvsnu) eeomfcoy1fa ranvi t tetoxo io4llen neilsfartmur ;o0olx iieiad m uanmon(0tleoio3oatla r u o ( srtrirpoo1ap  lici sfa2rau o;t1tpe iieiydfa ran p t0 rtoif to1la   iei t srtmxopiy1lpte feiasf Drrx ono4oeeo ictas a eln snu0areomf to1la r nvs ()tetrim iodal nmfvs sf rrmu o;t0tle mietasfa eauvo;u)aetrir3oodom  li sls) exrir3iu1ol  livta(  rum(m oo0openifetys mDrl( p u) etnmo ta1om eaivsls0 2xoimpoodap emfvsl(faDrmurp;t4aexomiciyt aDrl( o (4tlxoifctatfa  luvslt  rumxr oudlpe  ncsls  Dtrxm no4tlx  ictyt mDelnmsn(4 ltoirciotlpt aneo s)s2xrxmpiudlmt lncs s artrx p;t0oet mo3iydfm emnms;()aetoir io1fp eauvo (0t2trxr oo1om e nciat) Dua(rpot1opxnii3iytlsDemnmsn() lxnmfcoo1optr uvi s trur(opoydom n nvsa()srta(mp;o1aleomf3iltlm2elums (0tetrirctatfp  au i;s0s2trimpoy4olee netat) 2ur( pou0olenioctat a2rauvp;u) eenxrcoa1om e neo;t trum(o ou1olee ieiatfsrraxm ;t1aexoifeias m ua(vpn(0altoxf3tadoptrlueols)srxrxmpiydapt  iesat s2urxrooo0apeomoeiltla umuvs;u)alxoir tadfpteln ils seum(o ny1lptn fci ()a2rm(mpno1oee  f3ildfmDrlnvp;()teeoif3iodom   ieils) euo(rpiy1oltemivslt s2urx  ;t1tet  feild a2eaump ()altnmrcia1fa rlu il( trxoxmpoy4op   fvilt)srta(mp;t4texn fetytls ra(vp t4aexomocoydlmt aieolt)t2umim ny4lmtnlnetasfs2ur(  ot1texn i3ild s2ranms;u4trtnmfctodoatrau s;(0 etmxrpoydll  mneslt)artmu ooo4oleo oetat s2rl( pnt4 rxoxf3tydlp rai o;s0srxoxmpiy4ll e ncia( sDrm(rp;t4aexnmicild a2el(mo (0areoir3tadlp eluvi;t truoxm no1llt lfeias)artrx pnu4aleo feiadfa umums t) rerircoy1lpDe nei;s0 rtr(rpny4aptnliet s  2rm(rpnu4tee moetadfa2rmump;() eerif ta1op elivo t0t2xoim3oodolee fvtas aDrmu  ;u0tpeomi3ildfa2ra(vo t0tleomo ty1fa e uvo ( teumxm3ny4op nlici s s2umxm ;o0aeeoif3ildfsDumums () rerif iodlmD lnes t) rxmxm iudlpe lnvi tfsDtaur ;t4aex mfetatfs2emnvo;u)aleoif oodomDr ueilt)srtm(mpiodop  mfcia( s2uaxroot0tetomi3tldfa ea(vp () ltoxrciatfmtranvolt)srxoir3nydomt mivtls) rraur ot4tle mfeiasfs emuvo;t4texnxf3iydoaDeli s s)setm(rpny4olt lfes tfsDumx p;t4tetn fciydlm2ranvsn()texomrcta1lp ean sl() etoim io1ame livias s2ua( pou4tet moeiasla2eau s t0 rtnmo3oytomDelu ilt  rtrxm no1lm n fviat sDtruronu1open ocilslmDrmu ont4 rxrif totfmt  neslt)setrirpnudame mnvta(fsrrrxmoot1tlx iictltlm2rlu o t4aetrmo3tatoa   uvs ( s2xo(r3nu1omenlfetl() Dtr( p;u1optoioctltfsDemuvs;t4arenmr tydom r u il(0trtoxmpoudlmtelnvtas  Dra(rpnt0oeeoioeiytfa emu s t4arenir3oo1op  luvo s0trtmxmpoy4lmtemivs s s2tm( p;u4tlxnmfciatfm rm(vs;t) reoio iodom eanvo;(0 2xo(mpiudole lnvsas)aruaxr ;u4tet  i3iat m2rl(von()treomfctodfatrluvo s0teuo(rpny1ap elictl(f rtm(monu1oexniietlt s uanmo t)trxoif totlmDeln i ()s2urxm ou4ale  ietas)artauroou0tlx mi3iatfm emuvp;() ltoxocoytlmteaivo;(0tetrxmpiudlp n neil(  rtmur ot0opx io3ias a el(vs;t)aleomo3oy1lmte uei;t  rtr(r3nu1alenlnes tfa2tmurp;t1oexnmfciasla2emu snt0 lxoxo iotomDrlieslt0t2trio oy4lltnmnesat srtrxm ;t0alen oeiadlmDua(mo;(4 reomrcoydfm e u o;( t2xrxr iu4am   ivtlt)srtm( p;t1tleo oeiasfmDulnmo t0texoxr3to1lpte uvs;s t2xo(opnodll e ivias)a2trxr no4texnif3tytfa2uaumpnu4tlxnir3iy1fm  lueilt  rtrim3iodllte ietl() Dumum no4apenifcilslm um( on() eenxr oydfatr i ils)t2tr(opoydlmtemics s)aDtrxmpnu1tlenmiciyt aDel(vonu4tlxrif tydlp   u o t0tetoirpoy4lltn nesatfsrum( o;o1openii3iyslsDemuvs ()alxomr oytlmte i s;()teuo(r ny1alen ieias sDrmuroou1teeoioeildlaDrluvo;u) lermrcoodla r ivo s)s2trxo nu1op elieta() Dtrumont0olenmoetlt mDel(mo t0 rtoxoctotomD ai o;( trxm(rpoodamtemfctlt)srtm(m nt4tleo ieiatls2elump;(4aetrif tadoaDrau sls0s2urxmpiudapeemfeils) rtm(mo;o1tle mfeiytfsDuauvs;u0aexoxo3iydlaD li slt)srxr(mpiy1omte ivt t  2uau pnu1alto oetltlaDumnvo u4tlxnmo tydlmDrluvo;s0trur(mpou1apenmietasf rur( ooo1tlxomfetat m2rmump (0aleoif3iydlate neo;s)t2tr(opoy1om e ietlt) rum(r ot0olto i3ilsls2umn p t4aexrxr3iy1oatr nes;t setoxr3iy1lp n fet s s2urxroou0ope ifciat a ulnms u4 lenmo3oatfpD  neil()trxmxmpno4ll n ivi t sDrrurono0oltnii3tydls2umnmsnt) etrmo3iytlaDean o;( trtm(r nudlpen ivtls)s2umuronu4oetomoctlsfm rmn snt4tlxomr3iy1lpD lu o s0setmxrpoy1llt lfeils sDtm( ont4tlt ioeiydlmDulnmo;t)teeomf3todlpDrlivilt)teumxr iy1ol  mfcias a2ur(moou1tlxniiciaslaDrl( o;(4tltrircoy1fpte ieol(0 rxm(opnu4ol nlfci s) 2rmur nt0ape iieiydfmDrlu onu0tlxrmfciytom  aiei;(0trtmim3nudopen nci t)srtmu oot4tpe  fetaslaDrau o u4aeeoxrctatom eaieils) etm(m iudlleelnvsat  Dtm(mo;t0aeeoioctlsfsDuau s;u) rtoxf oydfm   nvs;t)trtoio3iu4omt lnvtltfaDumu oou0oetnioeiadfa2rl(mo;t4alxrirciy1lmt lues s t2xr(m nydlm elfet () 2taxmonu4tlto fctlsla2ua(mo;() rtrxf3to1la ranvo t)tetm(o nudop nmieiltf 2ua(  nu4opxo oeiadfaDuanms;(4aeenifciytfa eau o t) 2tmimpoodlltn netltfarumu ooo4tlt  i3ildls2rmu p;t4 rxoxr3iytfat  ivols t2tm(r3nu1ol emnes ()a2rm(r ot0ole mietat sDumnvo t0arxrxf3totlat aues;s0t2umim3no4ol nmfeiat) Drm( pnu1tltn ociatfs2ran p u4 etrxf3tadfpteanesls) 2urxo nu4op nlieta(fa2tr( ono1oex iociydfsDrl(vp u)alxrio iatlaD aues t0texr(m3io1alte fesa(farua( ooo4aeenmfeiyt mDumu o;u4alxrxfcoatfmD livol( texr(o3iydlpt mnes tfaDtrurpnt4ape io3ild s ra(mp (0arxrir iatop e n sls)s2umxo no4omeemivilsfs2ra(moou1oexnmietatls2eanvsnt0tetrxr3oa1lm  lues ()sexrxrpnydol   fcs t sDtaxmp;u4oeeoiociad aDeauvon(4aexrioctadfmt aieol(  rtmxrpou1apen net sfsrrmu o;u1opxoiictadfmDul(mp;(4 rtoif3oytoaDrln o s) rur(m nu4ope  fcia( srtmxmp;t4texoii3iyt m rmuvo;u4trenmocia1lp eaueilt0texo(rpiy1lltnmnetat  2um(  ;o1aex ii3tadfs um(vpn() ltnmf totfmD  uvi (  eurirpiy4ap emfcsatfaDua(ro;o4tleomoeiad a raums u0tleoircoatopDelieils t2xoim nu1aptnlnvtlt)a2tm(mp;t4tltomieiad a uluvp (4aetrio tadfm r ieol(0s2tmirpnu1ol  mivi s  2uaxmpno1tlt moeiad sDuauvp;u) renmf ty1lateai ol( trtoiopio4lle  fcs t  rrru p;u0aetnioctytfa eaumonu4tlxnmfcio1lat  uvi (  eumim3nu1ole mfeiltf Duru  ;t4apeo ieildlaDulu s ()alxrxo oo1faDe ivo;(0 2xmxm iodopt mnvias)artru onu4texo oeiatfmDul(mont0 rermfciodoa rauvo;(0sexoxrpoo1om emiei s)srurx  nt1tpenmo3iyd s ul(vpnu)tlxrmf3ootfmtrlueslt setmxopio1opeelivias)sDtaumo;t0oeenmoeiat m2uanvo (0aetnmf3oatfp e uvs;t)srxoim iydlmen ncsl(farraum oo0opxoifeiydlsDra( o;() reoifcoydfpDrlnvil(0teto(m iydoptelnet (fa2um(  nu0olt  ieiat a rmumo;t)tltoifciytopDrliei t0srxmimpnu4lpte nvsat artrur nu4tle mociyslsDumuvo u4arxoxfcty1opte nvs;( seuo(o3iu1lmt micsls aDtax pno4aexnmfciadfa2emuvs;u0tetoxf ta1fa r uvi s t2tmxr3iudlptemictl(fa2rm(rpoo4aeeo oetlt sDemuvs t4tetrmr3iadfpDrliesls)t2uo(r oydlp nlicia()sDtau ono1openifctyd sDel( p;(0aexrmf to1fateaneslt0 rtr(r nudolee ivt sfsrumumpnt1apto feiysfaDrmu p;t4 rxnxo iadlmte ueo;s0s2uoxmpou4apt  nvslt aDtm(mp;o4opxn ociyt
\ No newline at end of file
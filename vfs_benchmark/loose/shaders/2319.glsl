@@ -0,0 +1 @@
+u sl(0s2toio3nydlme lncs (  rtr(m nt0oeenmoeiyt m2rlums;(4 rermr iatlpteaneo;t) eurxo3oy1ap  lncilt) Dum( onu4texomi3ildfaDea(mp;u4 etnxf iytfmD an o;t  2toxo3iudllt mict tf Dtmumo;t0olx  fcias m em( o;u4arxoir3io1omteanes;t0srtm(rpou4ole mfvs () Dtru pot4oltoiietysfs2emuvo t4 renxr3tytlaD au o s) rxoxr ny4lmt  nctasfs2trxmp;o0olto oetadls2emnmo;t4 rerio3oo1oatr uei;t0trtr(m3nu4llen ivtatf 2tr(r nt4olt iiciadls2ua( p;t4trermf3oydomtranvo t0 euoio ny4omt lfvil(  2taumo;t0opx  o3tasfm uan s;() lxnxr iy1opDe nvi t0seumir oo1amtelnesa()s2ururpnu0oeeomo3ilsla uau s;u) lxrxo oatopDr uesls) etoxo no1alte ict (fsrur( oou4oee iieiyt a2umumsnu) rxomr3tatlat aieo t)s2uoir3no4ape  iviltfa2ta(mo;o0tpenmieiat a2ua( onu0areoirciydlm rln il(0 rtoir oo1ame lieiatfsDrr(rpnu0altn o3ilt a eanvp u0artrxf3ty1omDrauvilt) 2xrir ny4lme liei s s2tau pou0oexn fctydfmDeauvp u4 lenxrcoydoaDe ivi;t)sexo(rpiu1ol n ivs t  rtmxm ;u4alxoii3ilt aDeau s;u0 ltnirciadlmDe ivslt  rum(r iy1al   ivta( aDtaxm ou1aeenmo3iatls eau p (0trtrmo iodlp e ivi t)teuoxrpoy1lm nmies tf 2rr( ont1tltn i3iydfm2rluvp u4altnxocoadlmtean i;t t2xrio3iydal nmnvta( aDum( p;t4tpxomiciatls rmnvo (0aeeoir ia1omDelieo;t)texm(rpny4op  liei ( srumxm nu0ape  i3iyslm uluvpnt4texoif3oytfp   i s (0 2trirpnu4lpte fvil(  Dua(rono4tptnmoeiat mDrmnvpnt0alerxr3iatomDrli i s)t2toim3iu4al nmnct (  Dtaxmo;t4olx  fetadlmDrluvon() ltnif iotomte ieo;s)t2uo(rpoydom nmneilt)a2rru pno4tlx mi3ilslm2uluvo;t4teeomr oodfm  auesls t2xmirpno4lltnlictlt) rumumo;t0altoiicilt a eau s t0trtoxf3oy1lp ran s;s  2um(r oo1om emfvils srur(ro;t4tpe moetys s rmuvs t0tlxrio iatlpDr uvs ()trto(r iu4amenmivslt)a2urxmoou1tleo feiadfs ra(vo t0aleoiociy1oaDelnesls0trumir oo4ll nlnctas)artrump;u4oeen ieils sDum(ms t) rtrmr3iotomDr ies (  eumxmpoo4lptnlivtasfsrrmx o;u4tpxn i3ils m2rmuvon(0 eermr3iytlm eaivo s trxoxmpnu1alt  nciat) rra(moot1apxn fcias a eau sn(4artnio oydfmDe ieo;t)trxo(m iydopen icilsf Dumur ot4apenmoeiytfa2uauvo t4tetoxocoa1lpDr n sls0trxrxr3iu1llt mfesl(faDtmum ot4oexomoeildla2emu pnt)aetoif oa1fat aieols s2ur(o3oo1aptemivsl()srua( pot0tlx  ictytfaDua(mp (4texnxr todfatrauvs s) ruoxm3oo4ole lict s sDta(r ;t1oeto fcilsfm2el( p u) rtomr3iodfpD lieo s t2urxopny1al nmivs sfs2umur ou1aeeo fciys aDrmnmsn()aetomr ta1fp elivs s)teum(r3oo1altnlnet s)sDrau  ;t0opx mf3tlsfa2umumsnt4aetnir oa1lp rluvi (  2uo(mpno4aptelncias a2raxrpnu4altomo3ild s ea(msnu) rxoxf ia1fat lu sl(0srxoxr3nudalte ncias)sDurxmoou1altomi3tlsls rluvpnt4 eenxr3iatlatraneo;()texr(mpoo1ap emict tfsrua(  oo4opxniietatfa rm(vo u0 rxrioctatlpte ieo;t  rxo(m3iu4opee ivilt)a2tm(ro;u0tptomiciaslsDeanms (4teerif3iadomDrlies ()s2trir3oydoleelfvtlsfa2raxmoou0opeo ieiys a ulnvp t4 rtomo ootfmD  ieils0 rurxo iy4lpt  iciat)sDuaxro;u0oetomoctldlaDrlu pnt0 etoiocoydopD livol(0texmimpnodop n fcslt srtr(mooo4tetnifetlslaDrmn onu4artrmrctodopD li ol(0t2xoxrpio4al  lfet s) 2tmxront0tptoioeiasfaDelu o t)arxrxr to1fm r ueil(0 etrio ny4oltnliesl( aDua(mpno4alt if3iyslm rm(vont4tetrircoy1opteau o;(0setm(m iodlpeelfetat)srtmxro;t0tpt ifeild m2um( pn(4trtrxrctatla r i ilt) ruo(mpiy4al emictat  Dur(mp;o1apxoii3tys a rauvp;u4 ltomfcoa1fat aivilt  etmxm3oydomtelict ()srtr(m ou0tptnio3tldlmDrlumo;t0aexrir3oydla  aieol()s2xoir3ny4lpen fctas  Dtau  nt0apt  o3ias mDrmnms t)tltomo3iy1lpD au olt setrxm3oo4omee fcsltfsrrmumoou4tpxn o3iasla ulu pnu4tetrmrciatom r ieils)s2trio3iu1alee fetatf ruaxmont4opx mietltla2rauvs;t)tlermr iytoa elneols0teuoio no1lleemnvt t sDuru poo4tlto oeiydla eanvo;u) renmr iatlaD  ivi;s) rxoxm3oudol  lnci s s2tru oou0oet ifcilsls rluvs;u0 eenio to1optraivo;( t2urim3ny4llt lnvil() Durxmonu0oexoio3ildlsDrlnvs (4arerir3iodfpDe nvs;s)trtmxm nu1omte ici ()a2uauro;o0oee iiciyslm2rlnvp;t0 lenmo oy1fmDelivo t0truoxrpiu4lp nmfvsls) 2tr( ooo1oltniiciat s2ea(vs (4 rxomr3oodfaD lnvolt0teur(mpnu4lmenlict t) 2tmur oo0opxn fcild aDean s t0tetrif3oytomtr uei t0trumxr3iy1al nliciat artrxmooo4apxomoctys s2el( s (0 etnxociatomtr ues;t teur(r oo4alt lfvs sfarrmxmpou4tltn fciydfaDeanmsnu4aexrio iodlmt anvilt sruoxo3iudom elictl(fsrrrumooo0optniociytfaDea(ms u) leoir iotop e ies;s)s2tmxmpoydom e fvtatfs2trxmo;o0oet mo3iys s2rm( s;(0arxriociotoa rluvo;t0t2urxr3nudlptnmivi ( s2ra(rpnt1oexniietltlsDelu o;t)aetoif io1lp  lnvilt  rumxm3ny4amen nci ( artru o;u1apxniociatfa uau s (0tltnmf3oydlmteai i;t  rurxo3ou1oleelnvt (fsDra(ro;t4opt  icils aDua( pnt0 renmfctytlm eaivo () rxoio3ou4lp nmncs s)aDuaxm oo1ope mi3ildfsDumnvsnu0altoifcoa1oatraivi t)seurxm3iu4lmt  fcsl()aDrrum nt4olx if3tltlm uluvs ()tetnxfciatomte nvs s0texm(o3ny4ol e ieia(fsrtmu pnt0tlx  f3ils a umu ont)arxrxrcia1lmtr ueols  2trxr3io1am e fctl(  Drrumooo1opto ictyd m eauvo;(0aeeoxo oodfaDeaivil() 2tr(r iydlm n fcsatf rraxrpno4tpx ioeiyd mDul(mo (4aetoif3to1fa r ivilt0tetrimpnu4ole mfes ( aDuax  no0tpeoiieiadfs um(ms;()aleoir3oadfaD li s;t s2ur(m3ny4aptnmict t)arurxr ;t1apxo ociasla uan onu0tetomo3oadfpteaueilt0seurir3nodlmtemnvtlt aDtr(rpoo4tpt  feiys mDel(mp t4alxoxrcoy1faDelivs;(0s2trio3iy4lmen fes s sDtmxrpnu0oexo fcilsfm2rluvsn() rxrxo tatlpD aiei;( srumio oy4omenlnviatfs2trurpoo0oltnmo3iyslaDuaumpn() eeoxf3iodfateau slt t2toio nu1lmt  icia( a2ra(m no0tlx ifeilsfsDemnmp (4altnio oatfp rluvo;t0 rxoxo nu1al e fvsltf 2ta(rpnu0aleo feiytls2rl(vpnu4tlenmr3tatomtrlivilt0tetm(o3io1op nmieia() Dua(m ;t0oeeoii3ildla umnvs;(4 eermo3iatfpDe u slt0srumio3iydoleeliviasf Dtru  oo0apx iociatfsDea(mp;t4 rtnmr3todfate i i s0seuo(o nodol n nvsasf 2ur( oou0alxo feiadlsDeln sn() ltomfciydlmt lneo;s0 exr(o3iy1omenmfvils)sDtm(moou0ole  fciad sDua(mo t)arenio3tatoa eaieo;t  exm(mpio1ope  ieiat srta( poo1optomoctldfs2uluvo (4trxrxr3oy1la  anvils)t2tm(m io4op nmnei ( arumxroou1aex io3iyt mDrmn pnu0trtoxfctydfa   n olt  2trxr nudame mnvias srua(rooo1apxnio3iadfm ra(von(4 exrxrciatlmt livo () etoio3oydll elfcsl()artaxrpno0olxnmo3iadlaDrmnmo;u0alxrxr3to1omD  i o;() rur(mpio4optnmnes t)sDra(rp;t4aeto oeiadfs2ua(msnu)alxrxfcoydopt  n olt s2xmxmpio4amenmfcs ()s2rru  ou4aleomfeild sDeaump t0trtrmr3todfm   ivsl( t2to(m iydoptnliesltf Drrxrooo0aex  fciysls emu snt)artoxocoy1laDe uvi;()s2xm(r oy1lm nlncias) Dum( o;o4aexnif3tltfmDum(vs;u0trtnxo tydlmDr nvols s2ur(r3oy4aptemfctlt)sDrmxmonu4oet moctaslm rlu ont4 eeoifciatom raieo t0seuoir nu4ll elnesl() rrr(  oo4apenioetlsla umnmp u4tetnio3tadom  aneols)s2xr(mpno4ome mncils) rtau pno1texoiieiysfs2umnvonu4teenmfcia1lateaneo t)t2trirpiy4am e ivsl(  2rr( p;u1tee  oeiaslm rm( on(0treoio oatfm eanes (0 etrir3ny4lpee nvta()a2ua(rpnt4tptnmo3ils s em(vp;t0 exnmfcoa1fa e uvsls0 etoim3nudlp nmnvs (f Dtm(rono4apt if3ias s ul(vo t4 lxnmo3iydfmDeauei;s)seuoxr3io1omtnlfvslt) rurxm no1aet  iciys m uauvs;t4areomocootomDr nvilt0 2xoimpoy1lpenlnvsasfa2urx ono1tpeomicildfs2ra(vo;t4tltnxo iy1omtelu o;()s2xmim iu1ol e ncia(f 2um( poo1aleoiociltfa2elump (4trxriociy1lp rlueo t)t2xmxr3iydope mfet t sDum(  ou1tpxo fctatlm2ea( snt4tlxnmrcto1om elu slt  etrim3oydamtn feslt s2rr(mp;u0teenii3iydfm el(vonu4aleoxr iydfm rlues ()srtmirpnodamt mfviltfsrtr(  nu1alxo fciasls rmuvp t0 rerxf iadfa r ivs;s0seuo(rpiydoptnmnet sf Dta(mono4tlt mf3tys sDel(mp (4texoioctydfmD  i s;s0 rto(m oo1ap elfcsa() Drrumpno0tlxo fetldlm2rmu pnu)tlxoio iotfm  aiei;s t2xr(o3oo4ll elncils) 2urumono0oet mo3tlslaDrlnvpnu0 rxnir iatoaD livs;(  rxrxrpoy1ap nmnvsasfa2ua(  ou0opeo fetadlm2uan p (0 rtnxf3oy1fmDelueo;( s2xmio no1amee fvi s)a2taxro;t1apx ifeiytlm2eauvp;(0 exoio oadfaDr ieo;s  2xr(r3nu4optnlivil(faDtau  ;u4altn iciytls2el(vs;t) rxomocta1fatelieol()srumxr nodop nmnvsas srtmxront1optnmfetat s2um(vsnt4 exnmr iydoa r n o;t0 2xmxr3no1ll  lictltfs2tr(  ou0opxoifeiytlm2rm( s;t0trxrif3to1oateau il(0seuoirpiodlle mncsls) rta(r nu4alt mfctysfsDuanmon(0texoir to1fpD livol( seuo(m3nydomen nvsls  rtrx  ot4optn iciasls2rlu s;u4teenxfcoy1fa elu o (  exm(m3oudam n nvilsfartm(rp;u1teenmieildls2umn o u0aeeomfciytfa r ivs ()trxr(o3oo1lle mnvi s)srtrxmpnt1teeo i3tasfmDemuvp;t)tltnmocty1fmtr nvolt texr(r nydope  ivils) 2rax pno0oetnmociaslaDemu on() leoiociatlmte neo (0teuoxmpou4am emnetl()arua(mono1alen fcils s um( p;u0treomocta1fmte ieo t  exoiopio4lle lnes () rtr(m oo0apxn o3tysfs ul(msnu)tltrmfciydfpt lnei;t  2xmxo3oy1apenmfcilsfsDtmum oo4aeeo i3ildlaDuaumpn(0 rtrxfctydlp rlnvo (0 rxrxm nu1altnmfei tf Dra( pno1texomociytlm2eauvp ()aexrxf iodlaDr n olt t2xm(r3oydll emneslsf Drmu  ou1opx  ictatfm2rm( onu0texrmr3iydfptrli il(  euoxo3oydlleelnei ()s2ra(mpnu0oeeniieiysfs2ua(msnu) ltoif tydfpDranes (0teurxr iodam n nvias)s2rrxrpot0apeomfeiyd m em( s t4tltrmr oa1oa  livol(0 2tr(rpio4olenmicta( s2uaxrp;u1opx iietadfmDul(vp;t0arxrmr oydlpD lu ils0srxr(o iydlmee feil(f 2tmx o;u1oetn iciysfaDrmnmp;()tetrmr3iytlm  luei;()srur(mpio4omtemfcsa(  2raxrpno1opeomo3ildfm2ea(mo;u0tetnmfcia1laD lu i;()trxmxr3nydopeemiet t a2raxrpnu0alen ictytfa2emnvs t0trtrirciadlptr u s s t2uoxm3iodop emiviat) rtaxmpoo1apeoii3tadfa2umu on()trtrxf iodomt an ils0srxrxr3nydlpt  fei () 2ur(  ;u1aet  f3tysls rlnvp () leoxoctadomD anvils) 2xo(r3oy1ole mncilt a2ur(r ot1oexo f3iatfs2rmnmonu) exoir3oadfm r ieol(0srxmxo3io4al emncils)aDtmumo;o4tltomf3iyt a uauvonu0 lxnmrcta1oaD ai s s0srurxm iu1alt mnvils sDurxmpno0tle  i3tldfa2ranvs;()alxnxfciadlaDeluvo (0seuo(r iy4al nlfctl(farrrxr no4ole  iciytlm ulu o;u)trtoxf oy1lmt  ivo;s0 2xrxo3iu4am nmfes s  rumx ooo1ope mfeiatfm eln o u0trtnmf oatla r n s;s0tetoxmpiy4omte ies ( aruaxrpou1alxomfetytfmDranmpnu4 lxrxr3iodlpteln s;s)srtoir io4lltnmnviltf 2trum ou1oeto feiatfa2rl( sn(4trenxfciadlmt au ol( s2xo(m nodapeemfvslt)srrmx  no4tlx  oetlt aDua(ms u4tlenif3oodfmt livi s srtrxm3nu4amenmicsat) 2rm(monu1tex io3iytfm2ra( on(0artnmr tatlat lu ilt) rtoim iy1lmee fvtls s2rr(  ;u4tetn fctas a ul( p;u0tlenmr oadlpt lues;s0seumio ny1apeemfvsls srtrurp;t0aet iicild s2emu p;u4arxnifcoytoa r neo;t  2xo(r nu4am n nct sf rtaxrpnt0tlxo icilsla rl( p;() renxr oydomDran o s) 2ur(rpoudaptnlfvt s)s2ta(  ou1alxnmoeiadlm2umnvs u0tetoifcoa1oaDr ueolt)sexmxrpiy4llenlnesas  Dur(mp;t1apt moetadfmDrlnmpnu4 ltnxr3oodfp ran o;t sexrxopno4ame  nvi tf rrm(rpno0oex ioetltla2um(mo;u4 eeoifctydla elu o s0setoxmpiudole  fes t) rua(mpno0alxn ictydls el( p t4trerxf oa1opt  neo t)tetoirpnydamte nvias)arrr(moou1opt  feiadla2eauvont0alxoxr to1fmtrauvi;s teumxm oudol   iei t) Duax  ou4tle mo3taslsDua(mp u0tetnxf tytfa   ivo;s t2toxm3ny1apte ivtlt sDtmu ono1optn icils a2em(monu)trermr oatom  liei;t) rxmxm3oydam nmfvsa(  rumumo;t0tpt micildlm2ul(ms (4trxnir3oa1fp r n ol(  rtmxopno1omenmietlt)s2trur nu0aeen fetydfa rln ont0tlxnir oa1faD  nvslt teur(rpnudal e feil() rta(r ;o4tpt iociyd aDel(vsn(0alenxf3tatfmD liei t0trtm(opoo4om   icia()a2uau o;o4tpt ifcilsfs ulnvs;u)trermf3tatla  aies;()s2urxo3oy4llenlivsls)s2raurpot4apxnioeiysfmDua(ms;(0 lxnifcia1fpt  nvol()t2umir ou4olenlnvsa( a2rr(r nt0altn ociasfa rlnmpn(4a
\ No newline at end of file
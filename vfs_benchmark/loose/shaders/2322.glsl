@@ -0,0 +1 @@
+ieils)sexmxm ou1llte nvsl(fa2ua( pot1apxomietasfmDel(vp t0alerifcoo1omDe u sls) exmxrpoo4lp   nvtltf Dta(mo;u1optn ieildfa2emump;()altnmo3oydfmt ai s s0 2urxrpoy4ol nmnvt t) 2tr(mono0aeen feiatfs2rmn pn(4 lxrmociy1faD lieol()trxoio oo4op e iet t  Dumxmpno1tpe  ictldfmDean pnt)aeerxoctytomtean s ( texr(o3nydal nmiei t) rtrxro;u0tltnioetasls2eau sn()trxrir3oodlpD lnvi s) rxmimpiodam nliviltfarrr( pnt4aeenmo3iadlm ra(vp;(0altrif3ootfaDeanei t)trum(rpnodam nlfct s a2rm( p;o1oeen ociydls umn ont4 eeoircoydfate ivs;s0 eumir3nu1op nmnvta( sDtaxmp;t0openio3tysfa2emn s;u)tlxomrcoadfat lnesl()tetrxo3iydlm n nctas) rtrumpoo1tpt  o3tasfa rm(mont)artomf iotla raues t)s2urxr nodlmte ieilt)sruaxr ;o0teto feiytls2ea( o ()aetnxrcoodoaDe n il( t2trirpio1lpenmfei t)artr(  ;o4alt io3tys mDumn o (4aetnmo3tatfaD  u i ( tetmxrpny4om   fcsas) rtru  oo0olxn ieiasfa2uln snu4arxrxf tydomD aues s0 rxrxm nu1lltn ivsas)sruax ooo0tpx  oeild a2eanmp;t4tetoir oodoateaueolt  etoxmpoodal  mnetas) rurumoot0tpxoifctysfs rmnvs;t)tleoxf3tytomD  n olt0trtoxm3ny1amtn feslt sDtr(moot4apxn ociysfmDrl(ms u4arxrxo oadla ran s;t seuoim oydop e ncia(f Dtm(  ;o0oeenmo3tas m2rmuvs;u4trtnxfcoodop  lnvs (  rtmxo3iy4apte icsa() rtrx pnt1alenii3ilt s2emumonu)tltnioctytlmD ai s;s  etmim3oo1lm  mieil(  2ua( onu1tpxn ietldfs ul(vs;() rtomrcto1lp e ivil( t2uoir3ou4lpe  ietl(fsrur(rp;u0oleo ociysfm rlnvp;u)tetnif oodopt  nei;(0 2urxr3ou4amenlncsat) Dra(m nt1tltnmieiadlm rmu snt0 lxnmfciydfmD luvi ()s2uoxm3nu4apte netlsfaDrru p;t0alt mociytfmDrmnmonu0teermrcoadfa eli s;( t2xmirpoy4alenmfvias)s2taxr ;t4apeomi3iltfmDeau p;u4alxrmr oo1latrlneolt seurimpou1lp nlies sfa2rmx o;t4opx  iciyt s2um( sn(0alxnxf io1omtrau o;t  exrio3oo1ol  mieslt  rrrxroot1ape  fetaslsDelnmp u)arxomo3tatfp rauvs;s s2xmim nydamen feta()a2ta(  nt1aptoio3tysfa elu pnt)tetoifctytfm rlieols t2urir nu1ol   fcsl(fsrtm(rpoo0tpt ifcildls2el(vs;u)alerir3tadopt  neil() exm(r oo1lptemneta(faDuaumo;o0oex mfeiatlsDuanvpnt4arermoctadomt  uvsls)srurxopiy4lltelnet s srtru ono0apeomicilsfs2rm(vo u4tlxrmoctytom rli i (  exrxo oodllenlfetl(fartm(mpoo1openmieiysfsDrmnmp u0trtoxf3oadfpte u sls  2urxr3oy1oltnliei s s2ta(rooo0tlxnioetlslsDrmnvo u) eeoirctodlm r ivs;( srxoxo oy1al n icsls  rum( p;t1ole moctytlm rl(vo t4altnxf tytopD anvi;s)srum(o ny4ll  mfei sf rraum oo1aee mfciadfm2em( p t)aexnxr3iytom r n s;t0t2xm(m ny4ome mfci s a2tmxmont1tpt mfciytls2um(msnt)trtrxrcoo1fptrlieo s)trtmio3ou1lp e fes (f 2rr(root4tpxnifcilsfm rluvpnu)tetomr3iy1oaDrli slt t2tr(r oodolt liesa(f Dtrxm ou1oltnii3iysfs elums t4 lxrioctytomD liei;() rumiopny1omte fcsls)arrrxrpnu1ole iieiasla emn pnu0 etrxfcta1fp rlivi t0 2xmxmpiydlpte nvtlt)arta(  no0apx mf3iat aDuaumo ()tlxrxr oydla eauesls)s2xmim3oydopt mieiat srrrum ;t1oexn o3iad m eluvs;(0artrio3oo1lm  livi (  2toimpiu1optn nvtl()a2rr(rpnt1opeomieiasls2ranms t)trtnmfcoytoa r uvs;(0setmxrpiydal   fei t  2uaumo;o0tlenmo3ild aDrl(mp;t0artrirciodfaD lu il( trxr(rpoy1altemnvs t arta(rono4tpe mictydlmDrm( o u4aeenmr oo1op eaieo;t0s2uoimpiy4ol nmicilsfaruaxr oo4tpenmociydfaDrlnvp;u4tleoir oatfmt lu s s0trumir iydam elfeta(  2taxm oo4oeto fcilsfm elnms u)aleriocto1oa r uei t) 2toirpnu1lme mnvil(faDrr(ro;o1openii3ilt m2eluvpn(4aetoio3io1fpt ln o;s  exmxopoudopt  nctl(  2tm( ooo4teeomfeiasfm em(vo;(0arxomfctadopt lu o;()texmio3iu1lpe miet sfsDrm(ro;u0tet  f3tys m2rlums;u)tetriocoa1lmtranes;t0 rurimpoy4ol  lnei t s2ta(r ;o0olx ifctytfaDul(mo (0 rtnxo3tydlmD an o;t) rxr(r3no1lpen fvt s) 2uaur ou0tlen ieiyslsDrauvpn(0 lenxociatoaD luei ()tetmxr3iydaptelncils aDuaxm ;t1oex mfeiatlm2umnmo t0arenif iadomD  ivo;s) ruoim3oy4ap nmiciatf 2um(m ou4apeoii3iasla rmnvs t0texrxfciydopt  i o;t0 2tr(mpny1amtnlnvtls)sDtmx p;u1tlxo ictaslm rmums;(0alxoir iadop elnei;s)teur(o iydop elfes sfsDrmump;t0oexoifeiydlaDuanvsnu4tltniocio1om raneils tetm(r oodom  lnvtlt srtmx o;o0oexn iciat m rluvs () lermf3tatlmteaueols trum(r3nu1ame lieta(  2urx  nu0olxnmfcias m ulumpnt0teerxoctodlm  aivi t)srtoimpiy4alte ict ()sDtauronu0oexoio3iydfa rlu pn(0 ltomf3oadfat lnvolt srtmxm3nu1oltelfei (f 2taur ;o1tle moetytfa2ea(vpnu)tltnmr iy1fpte ues t0texoxmpno1ll   fcilt)srtm(m ;t1olxnmfeiatls2umu o (0alxomr oa1op eai o;s) 2tr(o oo1lmee fvt (f 2umxrpoo4tle ifciltfa2ulu o u0trtnmociydfa elnei;s0setmio3oy1ol n fvs sfsDrru ooo0texomoctatfmDel(vo;t0arxnxrctytfpteanvolt trumio oy1alee ivta(fs2trx o;u0aexniieias s emnmp;(0tlxrxrciotoptrli sl(0t2uo(rpiu4llte nes sfsDrrxrono1optnif3tld m ea( pnt0aexrxf oydopt auvols)s2trir3oo1lmenmfct s a2ta( ooo0tpx  o3tyd mDeluvo u) etrmo iadfp  auvo ()srtr(rpoudalen iesas)srtr(m oo1tle mo3ildfa2ra(vs;(0trxoif3todfa  lueo;t0srxo(mpio1lle mfci ()artrx  ot0optoif3iytfs uluvsnt0 rxrmr3tytom rliei;( t2xoxrpiy4llen feilt) 2uax pnt0apeoifciatfa2eanvo t0teeoif todom elu ils0t2umxo3no4om  lfeil(fa2rr(r nt1oetnmicild m2emumonu4aeerxf ta1oaDeluvo (  eur(mpoodamen fcsl()srta(m ou4tpxnmocilslmDelnmonu0treomf ia1laDr i slt)tetoxr3ny1aptelicsls)s2tau  ;o4aptnmfeiltfsDrlumsnt) etrxociadfateanei t s2xrxm iu1apenmies s)arrax oot1openmf3iyslm2uanmpn(4aleoxo oodom eauvo (0trur(m3iy1lpen nvia(fs2urx  ;o1tlenii3ilsfm rl(vp (0aleomf ta1lpDe uvilt) 2uoxopnudalt mfet tfa2umumono4aee micias a ul( pnu0artomrcoa1fpteai i t trxoimpiu1oleemncs t)aDtau onu1tpeo iciytfm ra(mo;() renmr3oytfaDeanvi s texoir3nu1lltnmnetas artm(ront1oet  i3iyd s ea(vs;(0 renif ootlpD aivs;t trto(m3oudlpeelnet sfaDrm( poo1opt iieiyd a eln on(4texniociotlaD lieo;s0 ruoir3ny1omt mneil(  2uau  ou1tpxnifeilt m umuvp (4 ltnxf tadfaDelnei;(0 rxo(mpoydal e fetas)a2rmu  ;u4aet iiciadfsDua( p;t)tlermf ty1lm  lueo t0 eumiopnu4lm n fetl(faDtmu p;o1oeeoifciytlm ulnvo;t0 etoxo oydfpDraueo;s seto(r3nydopt  icsls s2rmur ot4tlx mocils m elnms t4 rtnmociatlpD aneo;()srtoxo ny1op emnetat srum(m ;o4ole ioeiasfa2rm(ms;(0 lenio3tydoa   i ils texo(m iodlmt  nvil(fartmump;u0tle iiciaslsDrauvont)tltoxf iytfat  nei;t)srur(rpio4lp nlfvs s)sDum(  ou1aptn feiad aDuanvp;(0 ltoir3iydfmDe ivo t  euoxr3nu1amt mfci s)aDrr(monu0ole io3tysla rau p;u)aetomo3iotfmDrluei (0 etrxr iu4lptnmict s a2raxrp;o0alt ifetytfsDemu snu0trtoir tytlmDrln sls  ruoio no1lmeemnci t)s2umx ont4altomieiadlm2ulnvs (0trtrxo iodfaD aieo;t srxm(r3iodope  fei t sDraumoot0aleomicilslm eau s t0 ltomo3oadla ean i;s0sexo(rpoydameemfetlt srrmur ;t0opt  ictasfm eauvs;t0arenmf tadla rluvslt)trum(r3nydlmt  ncsl(f 2ur(roou1altnmoctyslm2ul(mo;(4 ltnmrcto1lp eli i;(0 etoio3oy1lle  ivi s) Durur oo1tleoifcildlaDul(vs u4tlenmo io1oaDr iei;s)srxrxr no4omte fet ( srur(rpnu1tpto ietyd m2ua(vsnu0 exnir tydopt lnvi;()srtrim3iydomeemnvtlt sDrau  ;t4apxnmfctysfa2elu o t)arxrif3iatlm  ln o;( srxo(rpoudamt  fetas arrmxr oo1apenif3ils m rlnvp u)teerifciy1faD aivs s)trum(o nu4lpt mivt t) 2urx  nt1oltnif3iad m umumsnt0 etoir oatlpDe ivsl(0 rtm(m iy4op  lnct t)s2trxrp;u1ope mocilt aDemuvpn()tlxoio oadomDeanvi t texm(m3oydaptnmietasfs2um(root0opxomi3iatfs2ea(mp;t) lenif io1optrlnvi () etm(m3oo4altnmncsltfaDrmx pnt1alxnifetat m elu onu0trerxfcoatlm eaieils seurxopno4al nmnvtat)arrr(ronu1tleoiociysfaDulu o;u4 ltnifctydlat lu sls) exoir nudol emnet t) Duau  no4olt iiciltla2uauvon()tlerxo3tytlm  luvi;t0seuoxrpny1lpe  fetls)srtaxrooo1ape if3tyd m2ra(msnt0 etomf iydfa raivs ()setoiopno1altn fesltfa2umxmp;t0apenifeiytlm2ea( p;u4 renmfcoatlaDelu s;t)s2xmxo3oodllenmfesa()sDtaxm ;t0tptnmoeild s um( pn(4aexomr3oo1oaDean olt)trtr(m nudom  mfei sf 2rmxmpnt1oleoif3iydfsDumnmonu0trtrxf3tatomDranvi s)teurxo3ny1lp emnetat) 2trxm ou0tltn feiltlm2rlu s u) eerir3ta1omteliei t0texmxrpnydap nlfvs ()sruaumpnu4apeo iciytfs2rl( o;u)texnxrctatomtr ivolt0 2um(opny4amtnmnvsl( s2taur nu4ale ifeiaslaDumnvs;(4 rtrir3ootfp e uvi () 2uoxo3ny4amtnmivi sfaDtaxrpot4open ieiat a2rln o t0 rtrmociytoaDr ieol(  2xmxo3nu1ol nmiet s sDurumonu4olx mieilsfm ran p ()trxnmr ta1fate n i;s)texm(r ou4amtemivsat  2um(  ot0aex ii3iad aDrl(mo;(0tetrmrcia1om rlies () rtoirpnu1apee ieia()arrmump;t4ope micilsfs2em(mo t)alxrif iytfpD aieo ()s2xrxmpiy1lpt mfct s)aDtmxrpno1aleomictytls2uauvo t4 rxrmr tydfpt livi;t0 2xmiopno1ale lfvilt)aDurur ot0altn fctatlaDuan snu4aexoioctotoa r nvsl()s2xr(mpnu4oleelictls)srrmu pou4aet mociad sDranmpnt4 etnmf iadlmtr i o;s) exmiopoy4ole lfcs ()s2urxrpot1opeoii3tatfa eanvo;t0trxnmo ta1laD au ilt0 rtoxo3ou1lle mfvils aDrr(r ;u0alto oeilsfmDuau pnu)tlenio ty1fmD aies;s)trxr(mpno4am  livs ()arra(  nt1olt ifctydlaDeanmp;u0trxnmrcto1lp r ues;t0teurim3no1ap nmfvsatfaDumumo;u1apxoiiciatfmDelnvs;(0arxomo3iy1fp r i o;() rum(o3ny4llenlncs ( sDtm(ro;u1texnifeiasfs ulumonu) eeoxfcoytfatelnei (0 rxmim ny1ll  mfvs tfs2ta(r no0tpto feiad a2umnmp ()texrio3tytomt aueo t srum(r oudamtnmfci t) 2tr(r ;u0tetniieiadfa em( o;t0 exrxf3iatoaDraueo t)srtoxr nodal  lnvsa() Dtrxmont4altomieiasfm emump;u) ltnxo3iadfptr nesls t2xoxo ny4om   nvsl(farra( o;t4aptnifciytlsDrl(vp t0areoif tadfpDeanvil()t2tmxo ny1ol eliviltfsruau p;t4optnmo3ilsls ra( o;(4 etoifctatfpDr ieol()t2uo(rpno1ap emnci ()aDrr(rpoo0tltomi3tyt m umuvp t0trxnxr tadfmte ueo;(  rxmxr oo1ll nmfctas arur(rpot4texo oeiltla2um(mo u0 lxnir iotlmtrlnvi s)seumir3nydlmen ivs t  ruaurpot1texnmf3ils m2rlumo;(0artoxfcoy1omD aieolt0s2toxopnudlmeelicias)aDrmu ono4aptn i3ias aDranvp t)tltnmoctodlaD lnvs s trumxm3ny1ap elieslt)srta(moot1olt if3iat mDuanvo u4altnifcootlpDrauesls)tetrxr3nudop elieiat)aDua(mooo0aet ifetadlm2eluvo (0texoifctotopD livo t srtr(r3oo4lmenlnetl(fa2rmx oou0opxo oetltlaDumnvonu)trtnxfctodfptrlies;(  etm(o3no1lpe  icsas)aDtaxrpnu4olxn f3iyt mDemnmo () eenmfcta1om rlieol() 2umxm3nodope  neiltfa2umurpot0tpe ioeiydla eanvo u4trxnioctytoptr ivo (0srxrirpno4am elivt (fsrtmu pou0apx mocias s2um( p;t4 lxrmf3to1lp elivo;t0 etrxm iu1opee nesltfarrm(m ;o4tex ifciadfa rmu p;() exnxfciadoa r n sl(0s2tmimpiu1om n nvil(  Dum(mpot4tlxnmieiyslsDuanms;t0aetnxf3oa1omteaiesl()seur(m io1lmt  icsltf 2ta(  ;t0openmi3tldls ua(ms (0aexrir iy1omDelu i s)srumirpno4ll  mnvi (f rtaxr ;u0ale moctadfmDumu p (0trtoio oy1oateluesl(  2trim iudale mfcil( aDtm(rpoo1tptnifetadfm2umu p t) ltoxo oytlate n sls s2xmir iy4op nmfct t sDrau oou1ope mociat aDrmumont4 etomr oy1fm  lnei;t)s2uo(r iu1lmenlnviasfa2tmxmonu4oeenifciyslm2elnms () lermo3iodomtrlieils0t2umxopiu4lptemfeil( aDtrx  ;u0apxomi3ilsla uanvonu0texrxf3oatla eluvil() exoir nydapen netlt  rumur ou0oeeoiiciys a rm(von() ltnxr oatlmtrlneo;s)t2uoxr3ou4ap n ncs s) 2raxmoot0optniictytfs em(mp;t)trtoir3iatoaDeliei;s) 2tmxr3ny4altnmfct tfaDrm(  ;o1tlxn ietysfm em( p;()teenmo3oadlate uesls  rtm(rpiu1lme  ictasfarumurooo1apxomf3iat s emuvsn()alxnif3tatfm raies s s2urir iu1omt  feslsfa2tr(mo;o0olenmoeiydla2rm(mo u)arxrmr io1oa eau o s0s2ur(r iy1aptelfcsls)sDtmu p;t1tlenif3iadls2uan o;() ltrmrcty1fpDeaivi;()seur(o3nydaleemfvsatf 2um(moou1oeeoio3ildls2elu p;()alenmf io1fmDean i t)teuoxr ou1lp n ict tfs2tm(mo;u4aeen f3ildfsDeau o t0 lermfcta1fmDeanei (0sexmxm3ou1omte fesa(  Dumx  nu1aetnifciltls ul( snu4aleoif3totlptrli sl( trur(r no4ol emnctlt aDraxroou4tex  o3iltla2ua(vo (4 rtnmo3tadlm  ai ils)setmiopnodlmtn fctatf Dtrxro;u0tptnmo3ildla el( snu4aeenxo3iadfa   uvi;s t2uoiopiu1al n ictat a2rrxrpnu1oex iietytla ua(vont) exoif3iytlpD anes (  2tmxm nydamen ictatfaDtaxroou4oleoiiciyd aDeaumo;t)teermf iatomteli s;t)seuo(rpoo4lmeelfctl()arua( oou0tpto f3tasfaDum(vs;t) exnmocoa1fm e nvil(0trumir ou1ole  ivsat)sDrmx  no0oleo f3iatlsDranmon(0texrmfciadom eau i (  2tmxm oudome mnvs sf Dtrxm ;u0ope mfeiadfm ea(vs t4tlxrmr3oytlmDrau ilt)texr(o3oydam nmicsasfartmxrp;o1texn iciaslmDel(vp u0altrir3iadfm rln s;(0 rtoxrpiu4olt mnesas)srtmu onu1tptoioeiatls2emn p;(4 etoxr3iydfat aivils0 rtriopoo4ape lnci t  Dtaurpno0tpt  oetatfa eln onu4 rxrxf3iadfa rlu olt) 2urim nodoptnlfctas s2trxm ;u4olx moetat s em(ms;t0 eenmfcoodfa r nvi t)setmxrpoodlmte nvsas) 2rrurpot1tlt mfctyt a2uluvsnu) rxnxo iodfa eli i;()srxmxo3nydll   fctlsfartrxr nu1opxomiciyt mDrauvon(4teermo oadfaDelnvs;s texrxr3nu4amtn ncs (fsDrrumpnt1alxniieiyt sDrmnmo;t0tleomo iatoat luvs ( trurxr3oy4lm   fvi s)aDra( onu0aee moeiys a uaumont4 lxnmf oodlm ran o;( t2urxrpoydll  mnvs t a2trur no0tee mociltfs rl(ms u0tetoxrciatla   ueo;t)sexoxmpoo1al nlnetlt) 2uaur no0tptoiociyd sDrm(vp;(0 ltrxocoydlptr u o t)t2xoir3nu4lptnlfvs (fsDumx pnu4oee mfciydfa um( o;u0texoxf3ty1fptrau olt  etr(r oy1lm emivi tfs2urumpno4aexnmictltlaDrluvo u0aeenir iodlpt aues;s0 rxm(o ny4lmt  fvtas  2um(rpoo4aetomocilt sDeanmpnt0 eerxf oa1opD lu ol(0 euoxo oy4optnmivtas)a2tm(rpot1aeenioeilsfm2em(msn(0arxnxrcia1fpD  ivs s sexmxo3oy4lpe  nvsl( s2rm(  oo4aeenmoeiasfs2rlu p;() exnxociy1omt lnvols sexrirpiu4lp nmnei t) Dum(mpot1texniietyd m2umn s ()artnmocta1laDelnvslt0s2xoxo nudol  mfct t a2rau poo0oltn ociyd m2ul(vsnu0aetoio3oo1opDeaivs ()teuoxmpoydale livt t)aDtr(ronu1aee  oeiatls2rmums;(4alermo iytfmt  nei;t0 eurim iu4apeelnct tfa2rrxm nu0olxomocias s rmnmp () lenirciadop  luvo ( sexoxm3io1ll emnci (  Dtrurpot4aetnmi3tldlmDrmnmp;(0arermfcoa1lpDr nes;t srumxm oudlmt  nvtls sDrax ooo1aeto iciytfaDrlump (4 rxnio3iatlaDelivs;t)seum(o3oydlmenlnvs (f 2trxmpnu0aex ioeiad m2uaums;()alxnio tydlmD aivi;t0 2xmim3ny1apt lnci ()artr( o;t1oltn o3iydfm ua(mo t4aexrio oadlpDrli i s0 ruoxm io4lp   ivs sfaDurump;u0texniietldlm umn p u4tlxomo3iadop  livs ( teuoim3iu4ameemiesls)a2tau onu1texnmictys m elnmpnu) ltnxo ootoptrlu slt teumir io1oltemfvi t)aDtrumpnu1tltoiiciad a2um(vpnt)artnmrcoadoat lues t) rxrir3nu1ll e nvtasfaDurx pno4oeeoif3tydls umumpnu4tetniocto1fp rlieslt0srxr(m iu4om n fei s  Drr( poo1oexnmoeiltls2rau p;(4altnif3oytlmDr ivilt)tetm(r3ny4ol emiesat)artrumpot0alt  fetltfa uan s;u4arerxf3ia1op rlueo;s0 exoxr3nu1llen icilsfsrrm(mo;t4tpxniieiad a eluvp ()aetomfcty1lm ean ils) rumxrpiy4aptemnct ( sDum(  ot4ole mietls s2el(vo u)aetnxrcoytfatr uvs s trtmirpny4am e fesls)s2raxmo;u1opxoiicildfs rmnvont0altomociydlpteanvi t) rxo(opiu4apenlfcsa(faDrmu oou1apxo f3iltfa2eluvonu) etrio3tadla eli i t) exmir oodapenmivi s)srtr(m ou1alxo fctyd a ul(mo;t4trxnxo todlmtrln i t0s2trxopiudameemictlt aDrrxmono4olxnif3tls a el(vpn() ltomf3oadlpD an il(0 exrio oo4op elici tf Dtaump;t0oetnmociyt sDemnvonu)treniociotom  lnes;s  rxriopnodoleelieiasfs2tr(rpot1olxnifeild a2el(mpnu0 rxnxr iatlp   ivs;(  2tmio3oo1opt mfcias srtmxrpnu4oex  oeiydfm elnmp (0 exnxf to1lpDelu o;t setr(m oo1omt lnetl(fa2raxrpot0apx  feildfsDrlnmp;(4 rxnxr ootfmt anei;(0 eurimpnydllee neiatfaDraurpoo4tleniietysfm rlnmo u0 leoxrcootla   ivs;t srxr(opoo4om nmfct sf rumxront0ole  o3iydls2umump (0aleomr3ty1oatelueo;s0 rum(mpoodole lics s arumxm ;o0oex io3tat aDeaump ()trerxocootla e i s ()srxm(opiy1lmenlneiasfsDraumoou1oetn iciatlm2ea(vp t)trxnifctodfaDelieilt0 rur(m iydal  liesat  rrmump;o1tpx  fctyd m2ulu s u0tetrxr ootfm rlnei s s2tr(m3oo4ol   icsa() rur( o;u4tlxniiciltlmDra(vpnu4trxrmo ty1fat ai i;s)s2tr(r3no1al e ivtasfs2rau pot0aleniicilt s2ul(ms u0tltrmrciatopteaivi;t  2tm(o3iy4lpenmfciltfs2tmxrp;t0aptn feiasla rmn p u4 exoioctatom  an i ()teuoiopnu4ap  miciltf 2rmu pot1texn fetadfa2el(mpn(4aexrifctadfaDe n s (  2tmir nodll n netlsf Dumx poo0alxoifeild sDrl(mpn()altrifctydfm   n sls  2xoxopiu4ll n ietat  Dua(monu4olx iicils s elnmont4trenxo ty1laD an o;s0t2tmxr3oy1apenmieiat)aruaxm no0apx mfetytlmDranmo t)alenxr3to1oat livilt teurxr3nodape mnet s) rur(rpou4tpxomf3ildlmDua( on(4 etoxo iotlpte neilt tetmxr io4oltelnesa() rra(r nt0tptoiieiat a umu snt)aexomr3tytop  auvs ()srxoio3oodlltnlictas aDta( pno0oex mo3iadfaDem(mp u0 lxnxo3iydlmDran i;()trxrxopiydap nlivsatfsDur(mpno0aetn oetasfm2emu pnu)trxrmo oadfmDrauei;s0 2toxmpnudalte nviat)arrr(r ;o0tpe  ieilt a2ulnvpnt0aexrmo to1lp eanei t)s2trxr3iodomtnlieilsf 2raxr oo4aex ii3iytfmDrmums;t0 rxoif3iytla rau slt0s2xmiopoydomt  fei (  Dtm(  nu1tee  oeiatfm2elnmon()trxoxf3oytfp   i il( sexoim nu1al  mnvil()aDrmxmpno4alenioeils s ea(mon(4tetrxocoy1oat lneilt)setrim iu4oltn nesa(fsrra(r ;o4tltoio3iat a elu pn(4aetrircootla r uei;s teumio io4lpenlfesa(  2trurpoo0alx mo3iysfs2emuvsnu4 lenircia1omD  ivo;t)sexo(mpoo1lmt  nvta(f 2tau onu1opeo o3tasfm2el( s;t)tltomrctydopDeaieils  2tr(rpiy4alt livils artm(m nt4oltomoetat mDrlums (4trtnxr tadfpD lneol() etmxopiodapeelnvt t)sDum(rpno0opt iicildls2el(vp t4 leomf3oatom eln sls) rum(o nu4alen netas aDtmur ;t4oexoii3iadfs ra(mo (4 rxomocoadoaDraiei;t  exoxo oydopeemiet t)a2umur nu1teeniociydfa2rm(msnu)trxriociy1opDelivols0truoxm3iu1ap  lnvia( aDurxroot0alxo fctad mDumnvs t4 ltomo tatlp raieo;s)texrio3oudap   nviat s2ta(m ot4apxomfcilsfaDrauvp t) leoxo to1lmt aneo;()texoir iu1lmte feiat)s2umx oot4tpeomi3iys s eln s;t4texoio3iy1fmDe i o;(0 rto(rpio1ame  fvi t)sDrm( poo1tltnifeiatfs rl(vont4alxrxo3tatlm  lues s0 rxrim nudom e nctls)a2rmumono1optnifctadfa em( on(0 rerio to1la r ivol(0seuriopiydlp elfetat)s2ra( pou0oleoii3iatls rm(vsnt4tlxoircio1lpt lneo t)srxrimpou4lpen ivsls)a2ur(  ;t0alt ifetad s umu pn(0 exnir to1oat luvols)s2umxr3ny4opt mnvt sf 2ur(r nu4opxomf3tatfm ulu p (0aeenmr3iodfpDeluvo ( t2ur(opiodomtn fvil( aDuaxm nt1oex moeiatfsDrauvo t)arxoxf3iodomDeli o;t) etmir3iodlle mfcsat srta( onu1apeoiociat aDea( onu4 rerif io1fptraies;s  eumxo3nu1ap nlnetltf 2rrx pno1oexn o3iatla rmnmo u)treoxf3iytfatranvs;s)s2xoio3iu4olt mfeiasfa2rrxm ;o4tltnmo3iadfm el(mp u)aeeoir oytfate nvo ()srtrim iu4ap nlnes s) rta(mo;u0tpxnmfeiysfmDrlumonu4aexrxo tadoa eanei;()t2to(opoy4am  mivslsfs2um( onu4tpx mo3iat a2rluvo t0tetrir oodlaDe i ol(0 etr(o ou1openlivsa()a2rr( pnt4altnif3tat m2em(vo;()trtrir3iy1omD lu sls0 eurir3ou4al  mncs ( sDtmxro;u4oltnif3iltfs2ua(vsnu4texomrcto1lpDeauvo t0s2xo(rpiy1op nmfet t)sDrrx p;u4tpx ioctld a2uanvp;(4arxoxfciytopDr u il( tetm(m oy1amt liesls)s2tm(roou0oetomi3ilsfmDea(ms u0alerxr oydlmteaivo;s srtoir3ou4op elfei s sDtmum ;u1apenmoctad sDulu o t0tltomr iy1om r u o;s0 2toio nu1lme  nvsa(fa2urxmont1tlt iieils a eluvon(4aetnmfcia1oaDrlnvol( tetrim nodlp   ncia(  Draxrpnt4aetnii3ils s2rln pn(4altnifciodopteaueil(  rum(rpio4lpt  fvtlt)sDtm(mpoo4oexoio3tltfsDuau on(0alermo3oy1fmDr i o t)srxmim nu1open iviasfs2umxrp;u0aptomi3ildfaDem(mon()altnmo3oy1lpDeauvolt0t2xoxm ou4lmenlivt s artru o;o0oet  fciadfm2umuvont4 reomf3oatla rliei;t trur(opiudamtn ici (f 2tmumpot4tle iocildla ul(mpnt4 eeomr3iytlp eauesls0 exoxo3ny1omtnlnesl(  rtm(mo;o4tee if3iytfs2ean snu) rermrciytlpt auei;t trxr(m3nu1oltelfeslsfaDraurpnt1aex  iciyt s ua( sn(4teenxr3tydfaDr ivs s  rurxm3nu4ap nlfvt sf 2taxmo;t4oltn fciydlaDrlnvs u)tetrircto1fa elnesl()tetmim oodope lncias)arrrxrp;u1apx  ietytla rl(msnu)artrif iodop e ies (  2xrxr no1amen fciltfsDra( pnt4aexnmo3tat a ea(mo u)artrxo3iatfpD  n s ( truoirpno1lpenlfetls)aDtmu pnt1tlx  icildfa2rauvp;u4aexnmociadom r uesls0t2toxo nydaptnlivt t sDra(r oo0aptomi3iydlm2em(vp;(0alxrxocto1lpD anvilt)seurio oy1apt licil(fsDtmxmp;o1tle io3tlt m rln s (4altrmf3oodlmt au i s0 2uoir3oo1oltelnvils srumx ono1oeenmf3iys mDemuvo t4aleoiociotfaDrluvs;( t2tmxr ny1lpenlfetls aDrax  no1apxnmo3taslm2emuvp u)teerxr todomD lueo (0 eur(rpiu4op  livsa( artm(m ot0tpeomictytfa2uln o;t4 reriocoo1oa  aivi;t) 2ur(m nu1lmtelnctl()sDraxr nu1oetomo3iatls rlu o u4altnif3iadomDe ies ( texoim io1ol nmncils) 2trx pot4aptomi3ildla ul(mo t4texrxo oy1opDr nes () rxrxm3iu1am nlnvs s)srum(rpot4aet  feiytls rln o;u4artoxo3oa1la r i ol(  exrim3oodlmtnlfct () rrr(rp;t0teen f3iad a2rmu onu0alxoircootopDran o t0 exmim3ou4amee fctat)aDrmumpnu1oee io3tls sDemnms;t0trxnir ia1oat aueil(  exmxm iu4ll n ncil(f 2tm( o;u0olx mociadlaDuauvs;t0 eenxo totlpteaivi;t  exoxm nu4lmeemfciat arra( ooo0aeeomociltlmDranvp;u4aleoif io1fate nes (0s2uoxrpiu4ale mfcsa( sDtaum oo1tpenmictydfa2ea(mo;() exnxfcto1fmte n o t0s2xrxo io4lpeelnvi s)s2umurpnu1oee moetlsfm2um(mp t0 lxrmo oadopDranvs;s sexrxo nu1lpe liesl()s2tauro;t1opxn octytfa2umumon(4 ltoir totomDr nesls)trumxo oy1al n fctls) Dtr(r nu4ope  ieilsfa2ulnvo;t0 renxfcto1fmtr ivol() rtoxo3iu1lltelnet ()srrmu  ;o4tet  i3tatfsDrlnvonu0 etoir tadla   n o (0trxoxo iu1lmtn ivslt)a2taumont0ole mfeilt m raumpnt0 leoxo oadoa  lneo;s) rur(o iy4ap n nvilt)srra(  ;t1apeo iciyslm rmu onu4texrmf iy1fmtrai i s0trtm(m oo4lm emies ()srur( onu1opx  fciltfsDeaump;() reoir tadfmteluvi () exmimpiodopt lnct s s2ur(  ou4olx  octas s2rlnmsn()tlxnxrcta1fptrli s t)trurio3ou4ol nlfcils a2rmu  ou0oex  oeiadfm rmumo;t4 exnxo3tadomtraieil( seur(o3ny4omte fvsat)s2rrx  ou1apx  fciysfmDrm(vo () rtoxf3iy1fmD auei;(  2tmxrpou4ll e fes t s2ururoot0apxnmfctytfaDuaumonu)teerxo3oo1lpD aneo;s)s2um(o oy1ape  ieta( srtm(mp;t1alxoiietysls2rmnmp;(4 eenmf3ta1opteauei;s0 2ur(opny1om elfei sfa2rm(  ;t1texnio3tltlm2emu s;u4artrxrcoa1latrluvsls teuoxo3iydamt mfctas)sDrrxmooo1olx  icias m ul(vo;u) etnxocoa1oa e uvi;s)t2umxr oy4ope  nvsl( aruax poo0oexn i3ils a ea(mo;u4texnxr3iytopD luesls)t2urir3ny1llt mfct s)sDrrxm ou0tltomoeild m2umuvo;(4tlxrmrcto1oaD luvo (0trtrim3nudapte ivil()arurur ot0open oetad sDeauvo u0areomrcoy1lp  ai s ( t2toxo3oudllt  nct (faDtr( o;t4alx iicildfaDeanmp t)aetoiociatlaDr uvi s0s2tmim oydlmee ncs s s2ra(r ot1apt mi3iatlaDrlu p;u0trxoxr3oytomtrlivo s) rumxo3io4lmen net (fsDrmur ;u0teen f3iyslm emuvp u4alxrir3iodlmt aieol(0trto(m3oudam  lfcsat)srta(m ;o4oetoifciad a2rln s u4tleomf
\ No newline at end of file
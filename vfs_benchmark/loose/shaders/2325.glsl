@@ -0,0 +1 @@
+n sl(0 exoimpoo1op e fvilt)sDrmum nu0oeeo oeiytfs ul(msnt4 rxrmo3ia1lpDeauvo;()srxm(opiodom nmncils srtrurpot1aptnif3tld m2ra( onu)aeenmrciatlm   u o t  rtm(m3iu1lmee fcils) 2ta(mpot4ale mfeiltlaDumu p t)tlxrif oydlaD aies;s0srurxo io4om nmnetl()aDuau  no0aleoiicils m2eaump;u0texnir oytomD luvol( sruoxm3nu4ll elfeslt  Drmxm no0olx io3tlsls2uluvp (4 lxnir3iy1fp e n i;s0 2xoio iy1am elnctl(farur(mo;u0aeeomieiltfaDemumon(4arxnxo iydlpt luvi s) eur(m nu4optelfvsa(farurum ot1oleo ocils mDuauvsn(0teenxfctotomDeau s;s s2xrxopio4om e ivia(farurx  ou4opto oetyd a ua(vpnt0 eenxf3oy1lmt li slt) 2uoxr3nodlme  fvia()aDumx pot0apto i3tld mDel(mo u0trxoxo tytlpt  neo;( t2toim3io1ome mivi t  Dtm( pot1oeenmi3ilt mDrmu o;(0 exrmo oo1lmD lnes;(0trxoim nudomee iciasf rumxmpnt0olt  i3iat mDul(vsnt0tetriocoadomtrlnvi (0 eurxo iy4lptn neils a2tr(  ot4olto fctatfa2um( onu4aexoxo3iatfptr ivo (  rumxmpno4lm nmfes s s2rm(mp;u0tpe  octltfm rm(vp;(4aeenmo3oodoaDeanesls0trumxm3ou1lpt mnvslt)a2tm(mp;u1tpxo ietlsfaDum( o;u0tetrmrcoy1la rau s s0t2xmxopiy4om emies (f Drmur nt4oexo feilslm ulnms;u)teeomr oatomDrluvsl() euoim3oodal   ieiatf 2rr(r ot1tpenifetasfm uanmo;u0tlxrmf3iotoa   nvil()setoio oo1am emnciat)srrrxrpot0apto ietyslmDeaumo u)texnmocoatlmD anes;s) 2xoio nudamtnlnciasf 2tr(r ;o4apx ifcilslm2eau o;u0tetomrcoo1oa eaivs ( sexoxr iodolt mfvtl(  Dtr(moot4aetnioetysfmDrluvsnt)aeenir3oa1faD  u o s0 eurxopiu1alt  fetas a2urumo;o0teeomoeiatla2emnvo;u4tlxoirctydlmD auvs t)setmirpoo4lptnlivsa( s2trxrooo1tpxo fciytfs2em(vs () leoir ootfatrluesl()sexrir oudlltnlfetasfa2rmuroot1alto f3tydla2rm(vo u)tlerxf3tatomD aieo (  rxmxo nu1opee nei t  Dtaumpnu1oltn oeiydfs2raums;t4arenmf3ia1lm eli i;t0teumim3oydopenmnctl(f rua(  no0open icild sDumnvonu0aeenxr oydfmDe uei;s sexr(m nudoltelfcsl(  rrm(m nu4tle mieiltls emums u4texnir3iadfa raueolt0 2to(opiu4lpenmfcilsf Drrur ;t1tpt mf3ilslmDeauvp;(4 ltrir to1omDelu ilt0trtm(m iy1lleelfvias  2trxmoou0oleoiiciysfsDumnvs () rtnio3oydfptraivilt0s2xoimpoy4optemicias aDrr(  ;u0opxo i3tyslmDrm(vs u)aleoiocoo1lptraies t0 rtoxr nudlp  livilt  2uru  ou0oeenmf3iasla emu pn(0aeenio3tydfmte nvi;( trumio3oodam emfvt tf rtmuro;u0tpe ifcild m um(mo u4tlxrxr todfaDeluvil(0 exrir iu4lmtnlneil(  2urx  ;o1aeeniociys m raumsnu4trtnxoctotopteaiesl() 2umim3iydame  ivi s  Drm(m nu1aee ifctls a2rlu o t)tlerxf oodoptr nvs;t)texrim iy4ale mfvtl(farrmxmp;u4tpeoifciatlaDraumo t0texnif tatfaDrlueo ()trtmir iudamen feils  2rmum ;u4optn f3iad s umu o u0aexoxf iatfp   iei ()tetm(m3oy1ameemies (  rraxm ot4oeenmo3tlslsDua(mo;() lxomr iy1fa  an slt s2uo(r nodlmt mfvta( arta( p;o0optnmfeiaslaDuanmo ()tetnxf iydoa  anvolt)t2tr(mpio1om  livia(faDtauroot1aetnifcildfa2ra(vs t)tltnxfcoa1faDe ivo s0 rxr(m nu4apen fes (fa2ra( poo4apt iieils m rmn s u4 rxrmoctodfatrliei;s tetoirpnu4ame  ictl() Durumono0aex io3tasfm2ranmo t4 eeoxf3tytop   n s (0seur(o3nodoltn nvsas s2rrump;u0alto ictlsfa ul(vp;u)aetomocoatfpDelivils) rurxm ny4am elnvilsfsrurumo;t1olx mf3tas sDemu o;()tetrmrcoydfaDe uvolt)t2toirpoy1ame mnesa(  rur(r no1aexo ocildfa ul(msn(4aexomo oa1faDr ies t texoim3nudamtn ncs s artm(mpoo0olenifcils mDem(mon(0 etnmo3iodfaDe n ilt0s2xrxo3ny1lptelnvia( srumxmpnt4oee moetadfa um(vo;u0trenxo ta1lmteln s;s) etoirpiodlp   fet s arrm(r ;t4teto feiysfm2rluvs t)teerxo oadom elivsls0 etmim nu4llenmivi (f Dtmxrp;t0tpto i3iadla ulnvp;(0arxrmoctodlpteai i;s  rtrxmpio4lmeemfcsas  2rm(mpnu4aexn iciltfm2um( o;t)teenmoctotfatr u ils0t2umir3io1lp nmneia( srtr(r no1olxnmoeiltfa ulnvs;t0arenxf3oa1lat ln i;s srumiopno4lp  liviatfsDtmx ont1aexomfeilt m2um(vpnt0arerio oatfpD  ieslt)srxmxrpio1ol  mnesatfa2raurp;t1oee  ieiyt a2rm(vpn(0aexnxo3oadopDrauei;s) etmxm3oy4lp nlivs t) 2trxr ;t4oexo fctydls ulnvp;u4 rtoxo todfp eaueols) 2xr(m ny4lp   fvsasf 2rmxm oo4texoiieildfmDemnvont0 rxnirciadom r nvsl(0s2urxr3no1ll   iet s  rtmxmp;o1oeeoifetyslsDea( p (4aetnxf tadla rlivo;( teumxo3ny4lpe lncsl(fa2rr( oou1opxomfciasfa umuvont0tleoxo iytlm rlnes (0trurxo nu4ame livsa(f Dtau  nu0ape ifeiydls ua(mp t0 leoxo oa1fatraivo t0 2tmio3oo1lmeelfci sfsruaxront0tleoifetlslm2el( pnt4texrxf3oadoptelneo ()srxoim io1olenmfet t)s2trxmpou4aeenio3tyt mDeanvpnu) rtomo iodoatelivil(  2uo(o3nu1ole mietas)a2tm(rpnu4ole mfcild m um(mp;t)aetrmo io1lateli i;t srumim oudlpt livi t aDtaxront4apeoiiciatfm2raumo t)artrxr tydoaD  uvslt t2ur(r ou4ol  mfetl()srra(ronu1alt mfctatla ea( snu0 rtoif3iatlmteanvi;( s2tmxopou4altelivt (faDurx  ;u0optn o3iadfm rl(vo;t4 renif3tadlmDrlneilt)srxo(opiydom nmncil( a2ur(r nt4oleoii3tadfm elnmpnt0 eenif3tadlp r ieslt0trxoiopno1ap e ivs t) rrmx  nu0aleo octldfs el(vs;t) leoir3iytlmDrli i;(0trtoir oydaltnmnci ()s2uaumpou1olxo i3iydfsDemuvs;()aetrircoodlm elu i;t)texmxmpou4lmtemnvilsfsrur( p;u1opxomfeiltfm2uan s;t)trerxf3iadfpD luvs s0srtr(o3oy1ol  mnvtlsf Dur(mpno0alx  ociat s2ulu pnt) etnmf3ootoatraivols)s2tmxm3nodlleelfvta() 2urx o;o4teeo f3iat s2um(mp;u0artrxr3iotfatraieo () rumxrpnu1olte ivsl(  rua( p;t1oeeomf3tasls umn o (4 renxo3ootlaDe i il()setoxrpoodam emncs t) rrr(rpno4olxn f3ilsfmDrmu s (0 etnmo oy1opD ln o s0 2trxmpnudllt mfctltfarumumpno0apx  i3ilt mDrmump u4artoifciadoa e uvo t  2xrio3oo1amtn net () rur(mont0tlen o3ild m uau s t)aetnxrcio1omDr n o t t2xm(mpny1op nmfeslt  2rmur ot1tlen octydlm ranmo u4 reoxo tytfateaueolt) rtmxm nu4aptelivsls s2tmumpno4aptnmieiadlm2um(mp;u) rxoxf oa1oa   nes;( setoxo3ny4lle lfetls) 2rrx pnt4aee mi3tlt mDulumpnu)trtomr3oatfmDeli o t s2urimpoo4alt lics sf Dumumpno4opeoiiciat aDrl( o (4trtoiocty1fp   iei (0trurimpnu4ome mnei t aDtm(r ou1tltn ieiad m rauvont0altrxfcoydlpDeln ilt0sexrxr nudll  lieslt) Drmx oou0opx mictldfs umn snt4tlxnmf ty1fm ran sls  rtoxm3iu1lmee ncia(fs2um(mooo4ole mfeiatfa ra( snt)trtrxf3iytopt ln ol( s2ur(o3iydll  mfet s s2um(  ;o0ope mociyd s emnms u0 exrxr3tydomt aieil( setrim3nodap nlncta( srtrx o;t1tpen fciasfsDemnmonu)tltoiocoadfpteluvi;t  2uoim3oy4lpteliei () 2umump;u1alxnioetat s2ua(msnu) etoifcoo1fmDean i s sruoim3iodaptnlfvil(fs2tax pou4oee mf3iydlsDra( onu)aexrxf iy1omtr ieols)setoim io1llee fvt t)srtr(m nu1ape  feilsla2ul( snt) ltrir3tatfmD  n i;s tetmir3iydam e nctat) rtau ooo0tpxo ictasls2ulu p u4arxomfciatfp   ies t0t2tmir3iodoptemncs (f Drr( pou0alxo iciltls2emnmo;t4artoxfciodoate nvs;s trum(r ou4ol  livsls) rtmumonu1tetoif3tltfs2rau s (4trtomr tadoatr neo s)texr(m3io1lp nlfvt s)srrr( pnt0aptniocild a2um(msnu0 eerir3ty1omDrlnvi;s srtm(m iy4altnmicsat) rum(  ;u4tlxomi3iatfsDem(ms u4artomfctotomte neils0s2tmir no1ol nmfctl(f 2rmx  nu1oet  f3ias m2ea(mo;t4tlxrio3tatfa   nvs ( srtrxm ou4aleelici (faDtr(moou4aeto ictadlsDrmnmo;()arxrir iatfmt lu o s srurimpnudal nmies tfsDumx  oo1aee moetyslm ean o;(4arermf3oa1fmt aueo;s) 2trxr3iydlpt  icil()a2trx  oo1aeeo i3iltfmDea(von() ltrmf3iadfptr ieilt)s2ur(m iy4ap nlfvia(faDumxrpot0oltomiciad mDrmumo t) lenmrcto1oa  ai i;s)srxmimpiudomt lnesls s2rrx p;t1aptn oeiltfaDrlumo;t) ltomo oo1op   n i;(0 rtmim3oo4optnmfvs s  Durum nt0olen i3ilt m2ul(vo;t)alxnmr3tydlpDeanvs t  eurim oydal emfvia(fs2rr(ro;u4oeenmo3iysfa2rl( pnu0alenir oadlat  nei;s)texrxm3oodap nmietls) 2ua(mont1tpt  feiyd m rmnvont)teermoctodfp e ues ()texoxo3nu4amt  ivtls srua(mpnu4teenmfciatlaDrm(mo u4aexnxrctotoa   n i ()s2xr(rpou4amenlnvtlsf Durx  ;t1opx mietatlsDea( pnt4 ltoxrciydoa rlnes;t) euoxo oydlpeemict s)arur(ront1apt  ociadls em(von()artrmrctodfpD auei t0texoxr ou1lle  fvslt)arurxm ;t0apxnmieiydlm ulnvp t4tleomr ootfatelnvo s0t2umimpiu1ol n nvia(fsDrmxm ou4oltomi3tyd m2el( p;(4 lxrif oadom rauei;(0sexrim oy1lme mnctas)aDurum oo1tltnmietytls2elnmp t)aexomrcia1fpDraies;( truo(o3oo4ope  nctat a2rm(  nt1tpxnifetlsla2ean o t4alxnxocio1om  aneo;t0tetmir3io4al nlnvs s) 2rru o;u0oex  oeiatfs2emn ont0 rtnmrcoadla  aues;s) etmio3oudom emivia(f rta(mono0tetn oeiyt a ul(vo;t0 leoiocootlm eaneols)trtmxo iudlp elfes () Durxro;o4altoiictatfs rmu onu)tetrmr3iadopDeai ol( texoio3oo4apt mivs s a2tmxrp;u1apx ifeiatfmDumuvp;t0texoxo3iodfpD aneo;s  2urxm no4am  mneslt sDrmx poo0oet ioetadls rlnvsnu)aeenifcoodlmteln s ( t2xoxo3oy1op elies t)sDua(r nu1aeenmi3tltfm2uanmp t4texoiocia1fat anvo;(0truoio3oy1lp   ici () 2umx pnu1olt mfeiys sDra(vs;u)teerircoa1lmt luvolt0t2xo(rpno1ol e netat arraumpnt1tpeoioeiytfaDra(mpnu)aetoir3iytoaD aies;s  rxoim3nu1apte ivsa( sruaxmpoo0teeo ociytfs2umu s u4aexrifcoytom elu i;t)t2toxo nydaltnmncias  2tmu onu0tpxniieiyt a2emu s;t)teenmoctytlm r n olt)texmim3io1lm e ivsas  Duaumonu4aetnifeildla rau o u0 renircto1fm raneo;t0truo(m3iudole mnvtlt  rtrxr oo1aet mictatfsDel(vp u4tltrif3ty1lateln s;t0 2umxopou1amt  neia( aDtmxmp;u0tptn ictlsfm ea( p;t)teermr3iotlptraieo s sexmio3nodlmte ivs t  ruaxm oo1alxnifetydla2ua(mo;t)teenxo ootla e i o;s)srumxm nu1lmt micia( srumum oo0aetniocildls rm( o;()tltnmf3tytlm r ueils  rto(rpiydoptnmfeiatf Drauro;t1alx  ieildfmDeluvp ()aexoxoctotfaD auvi t seur(m iy1ol nmfvils artmump;t1aexoioetyt m2emump;u0 ltnxr3iadomDrlivil( t2um(o3iu4apt livsls) rrmx  ;o1alxn oetyt sDea(mo;u4 rtnmo oytopDrai ols)t2xr(mpny4om nmnvtas s2tr(r ou4tptnio3iatfaDrl( p u4 ltnircia1fp eli s (0 2tmio3iu4altnmnvi tf 2rm(moot1teeniicilt sDuaumpnt0trxoxr iadlpt  n o (  2toiopoo1lme  feil(faDtmxr oo0oeeoioetltls ra(vs;t)trenxo3iydopDr uvo;t)srurxm iy1aptnlfctltfsDua(mp;o1alxn ociatfsDeaumo;t0alxomo3ia1fpteaivo;s0srtr(r nydlp n nes t artrumont0alxnmo3tytfaDrau s;()texomf io1fa eai s;s texr(mpiudlm nlicsl(faDrr(m ou4tptnii3tldlsDrmu onu)aetoir tytfpDeai s;(0seumiopoudomen ivil() Drmum oo1teeo oetytfs2uanmo;(0 lxrmrcootoaDrlnei ()s2xr(o3oo1olenmfeta(f 2urx pno0texn i3ildlm2ulnmp;u)teenio3tatom  aivolt) etm(r3oydll e ivt sf Dur( oot4oexn f3tldfm elump;u) eeoirciatfm  auvi;()s2xrirpoo1ll nmnesl()artrxr ;u4aexn oeild sDran p u4 etriocto1oaDr n o s truo(r3ou1altn ivs t)srur(rooo4tpen feiltlm ul(vo;u0aexrmo ta1omDrlieolt  exmxm3io1am e nctatf Durumpnu1oexnmfctltfm umu p t4 ltnxo oo1omDelnesl()srtrio ny4lpt  ietat sruaxrpou4aex ifciltfa rlu sn(4aetoircoa1omte i sl( s2uo(mpny1lm elnesas) rtmxmoot0tptnmf3iadfm2rln s;u4 exrif3todomDelueo ()s2toxrpoy1lleelncilsfarurxrp;t0tlxoif3taslm2um( p t0tlenmf3ta1fptr nei;t texm(opiudamtemietat)sDrau  no4apto i3iytfm emu s;u4tleoxo iadoatraieols)srxoxr3oudomt lnvtatf rra(  no1aleomfctadfa ua(ms (4aeerif3ootoatrliesls0 2trxmpiydlp emfci (  rtau poo1tptn iciys m ranmo u0teenmf3iy1lm rluei;t0teumxm3oy4apt mnesls aDtmu  no4oexn fctyd sDem(vs u0aeerif3oatfaDraies (0 rurxr3nydlptnmfet sfsrrmxmpoo1apxomoeiydla2eau p t0tlxoxo tydfat lu s s)t2uriopno4ol   feta() rta(rpnt1tlt ifeildfa2ul( o;(0aeermo3totoatrauei ()teto(opnodlmenmict tfsDuaurpot0aee mociltfsDemuvp t)tlerxf3tydomDrlnvs;(  etmiopnu1amtnlncsl()a2rruronu1tpe ioctltfm em(vs u0 ltrio tatlmtrlnvols)texrirpiu4om  mietls)arurx oou4tlt ioctytfa2ranmsn(4arerxf3oatlat lu i s)truo(opiu4lme mivsl(fa2tmxmo;o1oet mfetyd s uau onu) ltnircoa1oateaies (0t2uoir nodaleemfvia()arrmx  ;u0oee ii3ilsfs2um(mp t4tetrxo iotlateauvo t)srxoio3nodapte feta( srrm(  ;t0tex mi3iltlm2uauvs;t)areomf3oadlm e u s;() rtm(r3iudlmtnmfes sfartruro;t0tlenmfeiydlm2rl(ms u) rtrmo3oytla ranvs (  etoim io4lpe mivtl()arrrum oo1teenmoetld sDrlumo () rtrio oa1opDelivs s0seumxo nudlptnmnviat arum( oot1tpxn f3tysls uauvpnt)trerxr3tytlmteluvslt  etm(rpio1lm  lfes (  rurxr nu4apxoiociydlm rlnvpnu0areoif3ia1lmD anes s) ruoim3ou4lm  mics (f 2urumo;u1tltnioctyslmDra(ms u) eermo ty1oaD  nes t)trxmio3ny4lltn neiat s2raxm no4opx iiciyslmDrm( sn(0tleoxfciytlaDeau ilt0s2xmxo iu1amenlfei t)sDurxm ;o1tpeomfcils m eluvo;u4aetrmr3tytfat livo s  2xoxr3oodol  liciat  Drrxmono0alxn feiadlsDumnmo (4 eenioctodomtrlnvslt0texrim iy4ame  icsl( arta(  ;u1tlxomfciltla ulu o t0artoio todomDe uvi t  etrir3oudame lfetl()artmxm ou1oex  ieiad m2rauvo;u4alxrirciodoa eli o s trtrir3iy1lmeelivias)sDta(rp;u0olxo o3tytfs em(vp t0texnio3oo1fmD luvo t srtrxr iy4ol nlivt t)aDra(monu0tpeo f3iltfsDean o;(0trenio todfa   ivo () etrim iy4omt  feias)srrmxrpnt0tlxnmoeiad s rauvsnt0aexnif3iadoateluvo;()srxmxo3ou4lp emici (f rrau p;o4apx mietyt a uluvon(0alerxfcoatfa r nvol( trxmiopnu4op emfeta( aDum(ront4oltomf3tadlm2rmums () exrxr3iotla eli o;s0seum(rpoy4am  mfctls)s2urxrpou0tleo iciydlm ulnmo (0 reomr ootfpteau s;t)trxmxr3io4omen fcs t)a2rmxmp;u1aexo o3iatlm2rluvp;u0arxnxr3io1laDelnei s)t2xriopno4amen ncsls a2ra( pno4tet mieiasfsDeanvs;t4 reoxo3tadlptrlnvo (0s2umxr iy1omenlfvsls  2trxm ;u0tptnmi3iys a2ean pnu0 eerio3iydfp eaivil(0 etoxopny4lmeelnvtat sDumx pnt0aexoiiciatls raumpnt)tlxomr ta1om  an s (0 exm(r io1lm e iei ()sDuaumont1aeeo feils aDeln snu0 renmo ootoaD  uvo t tetmir3iy4lmenmnvs ()a2taum ;t1altn ieiltls2emnvo;u)trxrxr3todoptelivils0 2to(r3oo1altemnct ()sDrmx ooo4open ieiltlaDemump;()aeerir3iytfpDrlnvil(  2xo(mpny1optn fvilsfs2uax onu4tpeo fctlsla2rmu o t4artoir3tadlp  luvo;t)sruoxm3oydll  lnetas) rtaumoou1ole  oeiydls2ua(ms;()aexrif tadlatr uvo () exr(r iudlpeemfctl()artrxronu0tpt  f3tltlm elu p u4 rxomo ta1omDrli olt0 rurir3iu1apenlnviat) Dumumo;o1oexniiciytfa emump t0aexnxf3ta1oat livs s0seumiopio4am  lnet t aDtax o;u1apx mietasfaDrluvp () renmocia1faDran s;t)t2xoir3oy4ll emfesltf Dur(  ot1openmictyt a2em(msnt)trxomfcto1fpDr ivi;()teurxm3iu1oltemnes (fartaurooo1teeomi3ilt m uanms t) lxoxocoo1fmteliei ()tetoim3iydlme mneilt artr(  nu0texn fetydfm umuvp (4trtoio3tytop r nei t t2tmimpiu1om   ivt t  rrrumoou1openmfciyt mDulump;t0 etnmr3ootlatelnvs;( t2xo(mpiydomen fesasfaDrmxrpoo0oleoii3iytlaDumnmo;() rtrmo3iytfmt  ivo;t) eumio3oo4optemiesa()aDum( p;t0oee mf3tytfsDumums;(4 reoxr3to1fp  lneol()t2xoir3io1lm  mnvsa(fa2trxm ot4ape  fcild m ul(vs;u4aleoircta1optelnes;t0tetm(r ou1ll   fciat a2tmx pou4aex mictys m raumsn(4 eerxrcoadom  anvsls srto(o3oydlmtelfci tfa2raxrpot4oexnmoeiysla rlnvp t)trtoxfciytom e ivs;( srto(m oodlltelivsls artrxmpnt0teeomociadfs2rlumsn(4 lxnmf3iotom r nvi (  rxmxr3oy4op emfcta(farum( o;u1tpx moctldlmDea( o;u0 lermfcoo1la elnei ( trxrxr3nu1alte fcs () 2umum nt4apxo fciad s2uanvsnu0 lxoxocio1oaDe ieo t truoimpny4omt mnciltf Drmxmpou0tpe mi3iysfmDua(vo;t0 ltrifcootfa  lueilt  eurir3no1alt mnetlt)s2urxmoou1oltniieiytlmDul(vo;(4arxnxr oydlp e i i;t  rurimpoy4op nmieils  2tmxmpou4tle mocils m2ul(mp;()tltnio tytfpDrlneilt)srxm(r3ny1opt mivtlt aDum(r ot0tle  o3tydfa2uanmp;t4 leoxr oatfpte u i;t t2xrxmpnu1lp e fci (fsDururono0aeto i3iyd sDulnmp;() exrmocootfp eauei;( srumxr3no4ll emictatfsDtrx  ;t0aex mo3iadfmDemnmont) leomo3ia1fpDelnes;( s2xrirpiu4apt  ivilsf 2rrx o;u1oleo ocilsfs umn s;()trtrmrcoa1fm   iei;t0t2urxo3oudal elfeta() rtru pot0altnmociatfm ranvo;u)arxoxfcoa1op r uvo;(  2um(r3iy4om nlfvtlsfsDur(mono4tlxnmoctasfm rl( pnt4altnxrcootfpDelivslt t2xmxr3iy4al  lnci s  rtmxrono1ope  fcilslmDum(vp;t)artrio3ootlaDrlnvslt0sexr(m3oo1llt  fvs (f Dra(rpoo1olx iictlt m emnmp t) leniocta1om eanvs;t) rtrxo iudape mici s srrmxmono1apx moctyd a2uanvo;u4arenmfcoytlm   i ols trtoir3nudal nmnes s a2uaxmo;u1tltomoctltfa2ra( o u4teenxrcoydfmDrli slt)setrxm3io4opt miciltfaDuru pou1tpen oeiad s ul( snu0 rerxfcoatoatrlnes (0 eumimpoy4ol n fctlt)aDrr( ono1oeenioctat mDrl( o;u4 rtnxo3ty1fm   ivs () 2xmiopnudlme licilsfa2um(ronu1alx ifetasfsDel(mo u4 eeoxoctytlp rln o;t s2umxmpnudaptn ictas)a2umxmo;t1opeomfciys s2ua( on()aeeoxfcty1omteaies t0seuoxm3io1lltelnvs ( a2tr(ro;u0tlenioeild m2rlumonu)alxnio3ootlpteanvs;s)srtm(o iydope miviatfaDtrxmo;t4olxoif3ils s um(vs u) lerxo3oy1laDelu o s)seuoir no4lptemncil(fs2ua(rpno4tpxn ieildfm2emnvp;u4 rxomfcoydfpDr uvi ()s2xr(o3iu1aptnmfcils arur( oou0texoii3iytla2rl(mo () ltnxr3tatopt lieil(0trumirpno4opeemies t) rrmumono4oleoifeiytlsDumnvp u)tleomf3oy1fp  li s s  rtmir oodlmenliei t)a2ta(ro;u0alt  oetydls2um(vs u0tleoiocoatlpDeanvslt) 2xo(mpoo4lm nlieia()a2rm(rpno0tet io3ilslm ulnvs;(0texnxr oatoatrauvo;s0s2xmxrpnudal  mfvtas  rtm(m ou1tpxo f3iadla em(vsn(0 exrxocoo1lptraues t0 exr(m iu1omte nesat)arumu pou0oexnifeiasfs2rmnmpnt) exnif3to1fpt luvil( trxm(r nudlm  mfeiatf Drm(m ;t4tpe mfctydfs2uanvs ()tltrmociodlaD aivi t0sexrxo3iu1ame livil(  Dtm(rpno1aeenifeiad m ulu snt4 leoxr oydlpD livilt  exrxr3ou1ll  lneils  2rr( pnu0tltn f3iatfs rln p;t)alenxfcoydla rlu i t) rxoxm nu4lpe  fct t) rtm(mpoo1ale iiciltlmDrluvs;u4alxomf3iadfatrln i t) rtm(m nu1ap nlncta(fsrtrumooo1alx mieiasfsDemu ont) reoxrciatoa ranvo;()tetoxo3ou1amtemncsl(  Dtaxmo;o4tptnifetld mDua(mo;t4artrmfciotlpDeln slt)sexm(m oy4lpen ivsas  Dtm(mp;t4opx mfcildfaDelumsnt)tlerif3todom elivs t0trum(o nu4ll  liviasf rtaxrpou4aex if3tyd s uaums t)trenmr oo1laDraivo t)srum(m nu4oleelietls  rtmurpno1teenmo3iydfm2ra( pn(0artrxr oy1fpte neil()srxmxo iydome mfvi tf Dtau  nt1tpeoiietls aDumnvpnu)aetrifcoatomDr n i s)trxoxrpoy1apeelivsltfsDtr(mo;t0olxo fetad m2ulnvsn() ltoxf3ia1lmDrln ilt0 2xr(mpny1altelneta(faDumxm no0aleoii3iatlsDrlnvs;t) ltrio oy1oaDrli s t)s2urxm3io1ll  mivtat)srrmurooo1oee ifctasfs2rlnvpn()trxoif3ia1oa e ieo;t)s2tm(o3no1l
\ No newline at end of file
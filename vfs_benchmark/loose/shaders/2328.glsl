@@ -0,0 +1 @@
+ivi s srxoxopiu4lmenmnvi ()srrrx pnu0tetn f3tysfsDra( o ()aetnmrcoodop  lnes (0 2trio ou4lmte ieia(f rum( pno4oet  ocias mDranvpnu)tetoxr io1fmtrlivi;t)srxmxr oodlltnlfctl(fsrumum ot0ale  o3iydfm emn s ()tltniociatfm rln o;s0srxr(opoodopt micsl(  rrru pnt0aee if3iat m2rmums (0aetnxoctodfptelu s;(0t2trxr3ny1optnlnvi sfaDrmurono4aexomf3ils a2ran p;t4 ltnxrcoo1omDeaies;(0setmim ny1open iet ()a2umurpnu1tltoiietadlaDean s;u)areoxf3ta1fate neo;s0t2xrir3iodlmeemics tfaDrmum ;t1ope mfciltfsDeaumpn() reoxrctodfmDrlivo (0s2tmim3iu4ol emicta(fsrum(mpnu1tex mfeiydfa2rlumo t)arxomf tydfaDe uvs t  exr(o3iu1lmt mies ( aDrrxm nu4aee  oeiyd s2eln p ()arxrxrctytfa eln i;( s2xr(opnydlpt lieia( sDrrx p;t1oeen i3iaslm um(vo;t4teerxf3oodlp e ueslt t2trimpiudopenlnvs (f Dua(r nu1tlt moctlslm2rl(vonu)aexomf3tadfpteauvilt) 2umxr3nu4amtnlics sf 2umurpnu4aet mfctys s raumont4 lerir3oatfaDeanvo (0 2xmxrpnu1apt  fctlt)sDrmurp;o1aptomicild mDrmu p () rxoxocoo1oa elieo;(  2tmxr3io4lpt  fvi ()aDtrxmpoo1texniictasfs2rl( o u0 rtoxr3to1fpDr nesl( srtoim3io4amenmneilt) Draurpno1aeeomi3ilsfm2ean o;u0aetomocoodoaDelneo ()texoir3iodlpeemfvilt  2ra(rpnt0tltnif3ias a2ulu s t4 renifcio1omtr i ol( s2xoxr nydoleelivs s)aDrmur ;u0opxnmf3iyt a2em(mon()altnxf ootfm   ieils)trtrxr3nudlme  nviat)srua(ronu0tltoiieiltla rln p t) leoif3oatlm eln i;(0 rtrio iodlmt  ieias  rtmurpoo1tlxomi3tys m2rlnms;t0 lenxfctatfptranei;() etm(r3oo1apte net s a2rmu  no1apenmfctlsfs eanmp;()alxrxf3oatfa rlivi;t  rtrio iu4llee ieiat)s2trum ot0texn i3tls m2ul(vp;()aexnxo tadfa eauvs (0tetm(o io1lpt mieslsf rrr(m ot4tlto ietysla2ra( o;()altoxf3iy1fmte n o t  rxrxr3nu1om nmnvils)s2um(rpoo4olx mi3iasfs2ra(mo (0 lxrio3iatlaDr ieols0srumxrpio4llee ncs t)aDra(mpno0aexn ietldfsDemnvpnu)arxoiocoodomt aieo s0tetr(m3no4lltelfetl( aDrr(ro;o0aeenmo3tlsla2ea(vo ()teeoxrctydom  aueo (0 2toir nydoleemncsls)a2ur(m nt1aexoifcild m2ra(ms (4areoxrciydlmteaues;()s2xoxopiy1altn fesas  Draxrpnu1olenmictldfmDumnmo;(4tlerir3io1omtelueols  2tm(opiy4omenmies sfs2uax pnt4tetn f3iad mDemums (0aeeomocoytfaDr iei () exm(m iy4al nlneiasf Dtrxmpot4apx if3iasfmDeauvo t4arenxrciytlmteau il()srxm(r oy4oltnlfvs t)arrm( p;t1alxnii3ildlaDemnmonu)trerxr tatlat li i t0srxoxrpio4ll   fcs s  Durxmpot4tpxniiciadfs2raums (0trtrxo3iadfa rlivs;t) etm(r iy4am emfetlt  2tau p;u0olto oeiysfaDra(mo t)aleoxo oy1oateanei t)t2umim iodllt livtl( aDumxmpno1oee mo3taslm2elu o u0texoxf ty1omDr uei;( s2umir3iu1apenlnesls  Drmxr ;o0oetniociydls2ean s (0tltoir3iotopt ln slt) rurxo iudamtnmicsl(fs2umurp;t1tpeo ieiaslsDemuvo t)tlxnmf3iodlp e i o (  exrim3no4alt  ivt s  rtmumpnt0ale  ociyslaDean snu0 rtrmf tytoa ran i ( t2tm(opiy4altnmfvtas) 2tm(r nu0tetn ietys sDrmnvont4areoxfcoy1lmtranesls)trtm(m3no1ale  fctl()artmxro;u4oet ioetasfaDra(ms u) rtnio3iytopDe uvils) rxo(mpio4aptn ics t a2rm(r ou1tpxoifeiytfmDum(vp () lxnmr3oytoat  u o;s0 exoxo oudolen fcilt)a2umxro;t4olxoiieiysls2umu pnt) rtoxo3oadfpD  i i;t) etr(rpio1ap nlneiasfartax ooo0tlt iicildls emums (0trtrif iatoaD aieil(0 2xrim3ny4ap eliesat sDtaxmpnu0aexoioeiytls elu snt)tltoioctodlp  anesls trtmio oo4ap   nes tf 2ra( ont4opt mfctltfmDrluvo;()areoxo oytla rlnvs s s2toxr ou4altnmivils sDrmx pnt1tet if3iad a uaump;(0trtomfcia1lmtrluvils) rxoxr iy4lle mnvilt)aDra(  no1tlen icias a2eluvp;t0 ltrxo3ta1fm r uvil( trxo(m3iu4llte feslsfs2ra(ront4oltomo3iadls ul( on(4artoif ty1om e ivils0trumxo3oy1ap nmictl(faDtmumpou4optn i3tadfm umnvsn()trxnxociydfptrlieols0trto(r ou4opeemivsa(f 2ur( o;u0aleoiietyt aDrm(mo t)tltrifctytfmDeaiei;s t2umim nodol nlneta() Dtaxro;t0tptn ictyt m2ranms;()tltrmf3tatfaDran s s0 rxrir3ou4lmte icta() ruau ono4olto o3iadfsDuaumo u0 eenmocia1fm   n s;s0 2urir no4lleelfcsl() rrax  ou1tex  feiadfsDra(mp u0trtomfcoadom elu s (0 2uoirpno1aptelieslt aDrm(rpot1oex io3iadfmDelnvp;t) exnmoctydoateanvo t) rxm(o3ou1lpt  ivi tfsDraurpou4aetnmf3iytfsDrmnvp;u)aexnmr3tatoptrlu o s s2xriopnudaltn ictasfa2rmumont4optn ieiydla em(vpnt)aexnio tytlp  livs t tetrio iy1lpt  feslt aDta(rp;u0aetoioctadlaDemn snu4tetrmf iytlp   uvi;t) eurxo oy1ope  fvt (fs2um(moot1olxo fciatfs uan o u4treomr3oodfm eaivs;t0setoio iu4opt mfei sfa2ta(  nu4oltn o3tldls eau snu) exoifctodopD an i;( t2xm(o3nu4lpe  fvi (fsDum(r nu4alxo octls a2emnvo;u4aexnmo3iatfaDrlieslt trtoxopoydlmt lfcsls)aruaumpnt0opt mieilsfaDelnmo;u4tetoif3oadoaDrau i s trtr(r3oo1aptn nvt tfarta(ro;o1oleomiciasfm ran onu) ltnmfcoydopte iesls t2xm(rpou1openlnesa(fs2tmumonu1olenio3tls m umnvon()trenifciadlp r ueo;()trtrxopoydolte fvta()sDraumpot0oexn fciadfs rlu s u0trermociydla ran s (0 rtmimpny4am n nei s)sDumx  nu4oee  i3tldfm emums t4trtoxfcootfat anvs (0srur(m3oo1lp  mivs t artrxm oo0tlenmieiad sDrlnmp;t) ltomf3iodoaDeau i;s)t2urxopno1lp n nctas)a2ua(moou1ole ii3ils mDemuvsnu0 exrxfcoo1oa r u s;( srtriopno1lpt mnvsas) Dta(ro;u0alxomicias s2um( o;(0tltnif ootla   nesl() exmxm io4amenlnvtl(faDuaxmpoo4apx  ictad sDeanvsn(0 rxnio3iytlmteau o s srtr(rpiydlmte net s artaxmp;o4alxnmfctltlaDua(vp u0aexrif iytoatrlnvil(0s2urimpou4lm  lfesa(  Dtr(rp;t0opeo fciadla um(mp t0aeerir3todfm rlivi;t0trtr(rpiudamte fcsatfaDrmuront1tlxoii3iyslm2um(ms u4 rxomr3oy1fp raueo;s0seum(o3iu1alen ivtl(fs2ta(rpot1alto oetyt s2emums t)trtoifciytlmt  n s s s2um(o3iu4oltemneilt aDua(ro;t4oexnioctldlmDran pnu0altnxo oy1oaDrln ol( sexo(o3io1ol nlnes t aDur(mp;u4tptn oeiyt aDul( s;u) rermr todoat aiesls0teto(r iy4ap n fvs ()arrm(mono1aptoifeils sDeau s;(4alerxfciydoat  n s (0texoxm ny1lptelivs t a2ur(r ;o4tpxn feiasls2rmumpnt4tltrircoadopD lueo ()trxmxr3iy1lmee fei tfartm(  ;t1texoif3tlsfmDem( p;(4aexoio3tytlm   n o;t0trtrxr oy1ame lnvsatfsDuau  ou1tlt ioctlslmDuaumo;u0texomocia1la   i o;t srtoxr3oy4om e neta(fsDur(m nt0tpto icilslmDulnms u4aeermr oodopDe ieil()t2xmio iu1lm e ivt ()sDrmu  nu1aeto f3ild m2rm(ms;u4 exnir3oy1latelueo () rxoxopoo4lpe lncsasfaDrmxrpnu4apeomoetyt a2ea(mo;t)tlerxr3ta1fp e n o t0srtoim ou4apte nctltfsDur(rpoo4altnifeildlaDra( s;u0 lxoifciydop  liei s seuo(rpoo4ale  fci s) Dur(r no4apt miciltla emums t4aexrio3oa1fmt aieil(0t2tmxr iy1am nmfcilt)arua(  ou1aetoifctydfa2ranms;(4tlxnmf oadlpDrlueo () eur(o3ou1lpe mnei ()a2rr( pno1tptnmietldfm rl(vp;u) etrmoctytomt  ivslt0 2xm(m nu1al  miei sfs2umum nu0oex mfciysfsDranms (4altoif iadlaDelu s;s)texrim3iy4ame mnvtat sDraumoou0tltnioetltfa2rmnvs;(4artomrciotfptr ivols0srxrxmpiy4ll  micsat)a2urxmpno4tlen o3iyt m2rmnmo (0altnmfcoy1lm  ai i s srxmxm nydamtelnct t a2ta(m ;u0apeoiiciytls2ea(vo;(4 ltrmr3ty1fmtrauei s0srurirpiodlmee ictas sDra( oot4ope mf3iadfmDul( ont0aexrxfctatlm raieols0tetmiopio1lle lneilt aDrmx pnu1apxomi3tatfaDuau sn(0tetoxocoatom  aies;t0 2tmirpoudap nmfciasfaDtruro;u0olxomo3tadlsDemn snu4 leoxr iatfatr ivo;(  rxmio3oo4lme mnesas) 2ur(m nt0apxniieiyslsDumnvo;u0 lxnmo oo1fp eln o s0 rumimpno1op   ivt t  2uaumpno0opxomfeias m2ra( o (0aleomocio1fatrluei (0t2toxr3oodlpee nctat)aruau  ;o0olt mfetadfaDemu onu)tetoxfcoo1lm elnvo;t0s2to(m3iu4al e neiat a2uru p;u1oeeomo3ilt a emnmp;u4aetoircto1omt auei;s)srumxopnodomee ivta(fsrtmx  ou0alenmfciytlm2ulnvs (4aetnmo3oa1oa  an il(0 rtmir ny4lp nmieiasfa2rrum nt4apx if3iyt aDrmnvp u4arxrmociy1lp  aivi t0s2xmxopno4ale lieils)sDumurpot4openmoeilsla eau p;u4 rtnxocto1fat  uei;s texrim oo4lp n netls aDumxmo;t1altn ietlt s2rl( onu)tlxrmo3ia1om raivslt0truoxr oodaleemnetlsfartax oou1oleomfctyd a ra( p;u0 exrio3iotlm   uvo t)t2xoiopoodoltnlici sfa2ur(m no4tpxo o3ild sDemu s;(4 rxrmociodlp ean sl() etmxrpoudolen nvslt) Dtaumoou4tptomociat m rmu snu) exnxocoo1fp eaivslt  rum(r3oy1lmee feias)arrruroou4aexoiiciatls um(vp u)trxnifctadfaDran s t)tetmxrpoodap n fvilt sDumxront1apt  iciysfsDemn p;(0arxoir tydop rlivo ()teurxrpiodlmtemfciat sDrmxmoot1aexnifctyd s eanvonu)tlermf iydopDr ivo ()teur(mpnydll nmfvta(farum(rooo0tpe mfetltfs2rm(monu4alxnif3oatlmteaieolt srtm(r iy4apen fct t) 2ur(rpot1tpxn o3ilt mDrmnms;t4alenmr oytfaD  u s;(0trtoxr io4lltn fvt ()artaxrooo1aetomicild m2rm(vs u4 rtoxrciy1fa e ieo;(0texoim io4ap nmnviatfsDtmxrpot0oetn fctasfmDrlums;t0altnif3tatoatr i i;(  rtm(mpiu1alee iesasf rrau pnu1teeoii3tls aDua( s;(0texoxf ia1fp raies t texoim iy4altnlnvtat s2um(rooo1tlx iocilt sDemuvo t)tleoif tytop r nvs;( trxoir nydal  lncia( sDrrx pot1tlenii3tasla em( p u0aexnxf3iy1fmDeanvo;( srxrxopny1apt mncia(fsrrm(  oo1aleoiictys sDua(vpnu4arermociy1oa  an o;( t2xmxm iu4lpee nesa( aDtrumoot1olt ifeildfm em(vo;() lxnir3iodlpt  n slt0t2uoxm oodaleeliesa( sDurumpno1altnioctltla2ean s (4 etnir3to1fmtraneo;s setrir oo1olen iesat aDuaur ;u0texoifcilt s uauvo (0aetoxfciy1fm eluei;t s2uoir3iu1lmtemieslt)aDtrumpoo4aex  ietadfa rau p t4 lxrioctotla rluvi;s)s2uoio3ny4al emfvi (f Dtm(  ;t1alt  f3iytlm rau s u)arermrciytomDrliei;s) eumxo3ou1oleemfetlt)sDrrxmo;o1olxo ociytlsDuaumsnt4treomo3tadlmtr u o;t0 2tr(r ny1am   fctas a2rr(mooo1aleo oeild s ul( p t4tetoxr3ta1opD lies ()srurimpoy1lpen ivsls srrmu  ou0ope moetatfs rlnmsnu0 leomo ty1oaDeluei;(0srxoxo3iy4amt lfvsltf Dua(ro;o0opxomo3iadfmDeau o;t0 rerxf oytlmDelivs t) 2xrxm3ny4al n iesas arumu onu4oltomi3tysla2emnvp;u0altnio3tytlmD aueols0 2trio3iudalen nvtas)s2rmu  nu0tpeoifcilsfs umn o;t4texnxo tydomD  uvs;s s2umir iy4lp nlfctat  2ta(rpnt0olx  oetad a uluvo;u0 eenxfcoatfpte u s s)setrir3oo1op n nctl(  Drrxrpnu4aee ii3ilsfm2eau o u) eerif3ty1la  lnvo;s0 2uo(r iu4op e ictls) rtr(moou1tetoio3iatfsDrl(mo;t4aeeoiocootfpDeai o;( srtmxm io4amtnlietatfsDtaxmpoo0openifetatls rmumonu0tetrio iy1fa rlnei;s0seto(r3ou4amtelfvt (fa2raxmp;u1aptnmictytls rlnvo;t4aeenmfctodomt livol( srtmirpou4ll nmnciasfaruru p;o4aee  feilt m2rmuvp;u0tltomo iotlaDrlnvo t srurirpoy1apenlicsas aruaxmo;t0texnmfctldla2rl( s u) etnmrctydlmte uvolt0trurxm3nu1lltemivsatf Dra(m nu1aeeomictytla el(vsn(4trxrmrctotlatrlivi s) exmio3ou4ap nlnctl(fsDtrx ont4aeeoif3tltfm elu s;t0trtrirciydlp eaneslt)teumio oo1alenmivsatf 2rru pot4oexn ociytls rl( p u)aeeoif totlm raiei t sexrir iy4lmt  fct s  rtru oou0olt  octyt a ea( snt0tlxrio tadopt lueo t trur(m iu4ol   fvs sfa2ur(mpnt0oeeomociytlm2rm(mpn(0tetniociytlm rli o;( seumxmpiy1lm e ieia(  Dumuronu1oleomoeiadfs2rln s t0tlxnifcoa1lmDrlnvo ( s2xoxm3nydape  ici t)a2rrx  ;o1olto fetadls eluvo u)tleoir3tadfa eli o ()trurio3ou4ap n ivslt  ruau pot0openmiciytls2ul( o t0aexoxf to1fa  auvs;( seur(opoy1ame mfei (f Dua( ooo1opt mi3iyd m2rmu p;t)aexnxf oa1fa elnesl()trtoxm3iodamtnlicsat) rum(m ou4tpxnmociatfs elumo;t)areoiocio1fmteai s;s t2to(o3oudomen fetas arurx oot0apt mfciydfa ua(vs;t0trxoiocoytlat  neilt s2tmim oudom  mictls srrm(monu0tlt ifciat s ea( p (4 exomf3oydfp  lnvi;s)srxo(rpoydol emfcsat) Dtau poo4apenmieiydlm2ranvont)trxrxo iytlm e n o t)t2toxm no4alenmfcsat) 2raxr nt1tpxnmi3tltfs ulnmp () etnmr iodomtr nvi;s0 etr(o3io1ole  fvs sfa2ta( ooo0tleoif3tyd s eaump;t)trtoxf3oy1fate i s;t)s2umxm iudopenliesat)aDtmum ;t1tetn iciatfs ean s;()altrmr3iytomtran i;t  2to(rpoo4ale lieta(  Dtmxm ;o1olt mfeiasla2uln s u4aexnmf3iy1oatr n i;t0texriopny4lm n fviatfsDtau ont0opxo ociys m em(vp u0trenmrcoatoat  ivo t0texmim3oodopt mnes (fs2ur(rpnt1olx  fciltlmDelums (4arxriociadom   uvo;(0sexrxrpiu4omt mfci tf 2uau  ;u1oltnifeias s emn p;(4treoir ootomte ivi t0 eurxo3nodoleelnvilsfa2umu  ou0aet  feiad a2eluvp (4 lerif3oa1omDrau s (  etmimpoy4op  mfcil(  2um(mont4texnmiciytlm ranvpn(0teeoif3totfatrlnvslt0 rumir3iodom  mfes s)s2rrx pno4tee  fciadls ul(vo u0 etoircoydom  livi s  eumxm iy1ll e fvi ()aDrmxrp;u0alen iciadls rluvs t0 rtniocoa1lmDe i s;s) 2xoir3io1olt  neias)artm(m no0aptniociyt m2rm( s;t0alxrmfctatfpDe nvsl( trtoirpoo4omee nvt (faDtaxmp;t4ape mf3iad m2ea( sn(0 ltnirciy1op rau ilt0 2trxmpny4al n neia(faDraumpnu1teeoif3tltls eanvsn(4tltoir tatfmtelivsls0 rtoxmpoy4ope  ietat s2rrxmo;u4tpxnifcils s rauvp;u) renio ootfmt  i o ( teumxopio1am nlivi (fa2rrx pnu1aetoioetydfm ea( ont4areoxo oatfp ran s s s2um(r3oy4apeemnei sfs2rru o;t1olt  ociad s2eaump;(4 lxomociy1lp   uei ()sexrxm3oo1am  lics sf Duaxrp;o1oetn oeiat m rlnmonu) exoxrciatopteaiei;(0texm(mpno1apeemncs t) 2rrxmo;u1oeeoioeiadfsDrmump;u) lenxocoa1oaDr i o;(0srxr(r3io4om e iviat)srrr(r oo0alt mfctyslsDrlnvon()tlxoir totom r ivsl(  2tm(m ny4olee fvia(f 2trxmont4apxniociadfaDrmump u4alenxf oodfmte ivi t0t2xrxr nydlltnmfeta(faDuau oot0alt mfetltfa rmumsn(0tlxoir io1faDrau olt0 rxmimpno1lmee ietlsf Durx  ;u0alt mieiat s2rmnvo;u4 leoif3iodlpt aneo ()t2triopiy4ll elies tf Dur(rpot1alx if3iadlm emnmp;t)teenmr oodfaDr nvo;(0 eum(o oydlp   net () rrmuro;o4apenmieildfsDea(vs (4 ltrif tydfpt lnvs;(0 etmiopny1am nmicilt sDrrurp;t1tltnmf3ilt s ranmp (0altrxo3tadfpD  i i;s0sexrim iudam  lneil(fartau  ot0apxn octldla2rauvsn()aeeoxf3iytlm  lieil(0 rxmxo3nu1ap nmfvsa()aDtm(m ou1tpt mi3ild s rau p (4 eenxr3oadoptraivsl()trumxo ny4olee nvs t)a2rmu p;u0oetoio3tls s eanvp;(0alerxoctodfmtr nvi;(0s2tr(m nu1lpe lnvsat  ruauroot4oetomo3ilt m el( s;(0arenir oadfa eli o t s2urxm io4lm nlfcia( arrr( p;o4ape mo3ias s eaumon()tlenif3iytomDranvi s0s2um(m3oo4lm n iei sfaDtaum ;u0opeoifctasls2rau snt4teenmr3to1oa e ivs;(  etoxm3io4apeelfes s)arua(r ;t0opxniietaslm2ra(mont4tleomrcty1oa raieo;( srtrxm nudoptemneia(  Dtr(mpot4aeeomi3ild a2ua( p;(0arerir3tydlmt luvols)setm(m3oo4lpe lnvsatfaDrrxrooo4apeomfeiltfm2umn p;t0artrxr3oydlatr nvolt0srxm(m3ny4lmtn net sf Dtmx  ot1tpenmi3tasfs rmn s;t4areoiociodlp elies;s seuo(o iu4am   iesl() 2tr(rpnu1aeenmi3tytfs eanvs;u4tlxnmo3ta1oa   ieo;s  2xr(o3ny4lme livsat)a2rr(mpot1aex  icils mDranmsnt)trtoxr iadomDe ivs ()sruoxm3oudlmeemnvilsfarta(mp;o0tlenifcils sDuauvo;u0arermo3tytfp ranvs s)setoim iudal nlncsa(  Drr(r nu1tpt  f3tas s ranvs;u)tltnxf3iy1opDeluesls trur(mpoodlme mncias) 2um(  oo4alxomfeiat s eln pn(0treomociydlmt lu il() eumxm nodll nmieils)s2uaump;t1optnif3tydlm em(vpn() renir3io1lpDeau i s setmxr oudalen iviltfaDur(mont1tptnii3iydfa2ean o;u4treomo tadoptelivo;(0 2xoio oy4oltn iei ( arrmxr ;t0optn o3iytls2rluvon()artnirciatfp  lues ()srurxr oo4ap   neta(f rtm(m nt4tpen o3iydfaDuanvo () ltoiocoodfpDeai i t truo(r ny1am  mfvsas) 2rrumpoo4oltomiciysfaDranvp;(4aeeoio3totom  livo () rxrxo oy4lmte nvtltfs2rmu ooo1texn fciyd mDelnvs ()treoxrctadlmt  i o ()s2toxr oodlm nmnvtat srrrum nt4oetoiociytfs ul(vonu)artrmf3oodla rai i;t seuoir oy4amt mnvias a2rax p;t1teeo i3ildfa2uluvp t4trenxo3tatop  luvi t  exoimpnudom   fviat a2tm( pou0oltnifetydls uauvo u0 exomo3iotfptr u i;(  rumxr3oo4omee iesas) 2um( ooo4aetnmoctlsfs eluvs;t)aeeoxf to1omte uei t0s2xmxm3oudol nlics t  rurx  nu1olxn oetasfaDumnvo u4 lxnxr tydlpteln i;t  eumxrpnydapt lncs s)a2raump;t1ale mfctytlaDrl( snu)trxnmo todoaD  n sl(  eur(m nydamee ivtls) rrrurono1opxomfetlslaDua(mp;u4alxrmr3oodfa r uvs (  2tmxo oodop nmnvtatf Dtrumono4opeo i3tls a ean p;t0 rtnxocia1fp  aivi;s)s2urxmpiy4lpeelfetl(fs2rr(ro;u0aexn i3ildfa eanvpn(4tlenir ia1optrlnvilt)t2ur(r3iu1ame  nvsl( aDrrxr ;u4aleomiciys sDel(mo;u0trxoio3iy1lpt li ol()sexmxm3oo1amee ncslt)sDrrumooo1alen octldlsDrlu pnu)tltrircia1opDrau ilt s2xm(rpno1lle liciasfaDuaxrooo4oleoio3iatlm2uanvpnu0aetomf3ta1lp elues;s0srtoxopnu4ol  mfcil( artmumpoo4alxnmo3tytla2ul(mp;u0areoxfcta1lmDe uvi;(0srtoim oodlm  lieia(  Drm(moot0aptomfeiys s rmumo () ltniocoa1omteanes;()setoirpio4apeemics sf Drruroou1opx mfciyt mDea(mo;t)tetrxocio1lp elu s t0 exm(o no4aptelnvil()aDrr(rpnt1tpen ietls sDrmnmo;u0tlxrxo3oydom raueo;()srurxopoy1lpe  fctlt) rrrumoou4oetoii3tydfa umnvs t)tlxnxr io1lm r n olt)t2xrxm3iy1alee ieiat)aDum(  ;u0openifeilsls uanmo;u0aeenifcoatlmD lnvo;s teto(o oudal   ncslt)aruaxmpou1tetn f3tysfaDuan o u4artomf3ia1la raies s s2xrim3nudope  nct (f rua(r ou0tleniiciytla ea( p u4teenxf iadlate u o s0s2urir3iy4lleemnct t) Draxm ;o4tptnii3iadfmDea(mp t)texnmf iodop rauvils s2tmxr3no4amen netlsfaDumuroou1tlxn o3tatls ua(mont4teeoxo3iytfat  iesl(  2xr(r iu4ol  mfcia(faDua(mpou4oet mietydfm em( on() etrxo3totomt  neo;s)sruo(mpoodaltemnviat  2rmur ;o0aexoiictldls em(vo (0arerxr tytlp   neilt0sruoxm3oo1omenmnci tf Dtmxmo;o0oeeoifeias m ulumo;(4aetrmocoatoa eanvi t0 exmio3ou1llt lnvsls sruaxm ;o4oleomoctadla2uanmo;u)texnxrciy1fpD  neo;s sexmir3iudamtnlieiasf 2rmxro;u4aptomocildlsDrl(mpnu)tlxomo3iy1faDr ies;(0s2xoirpiy4lm e nvt (f 2ra(mpot0alxo icildfmDulnmp;t)tetrxo3iotlaDrlueslt srurim3nu4omenmivs s a2umu  ;o0oet  ociytla rl( pnu4tlerirctodfmD luvs t) 2tm(m io1ap  mivsl(  Dra(r ot4olxoif3ils a2ulu o;u4alermf oytfatr i s;t) etmimpiu1al nlfeilt  rtaxm no1apx ifctydfs rmn o;u)texnmfciotlpD lu i t)s2xoio io4omeelnvsatfs2rr(rono4apt ioetltlm el( s u4alerxfcoydfat aivi t sexoxo ny1lp  mfcilsfs2tau ono1oexo o3iytlmDuan s;t)arxnxr iotfmDeaivo s  exrxr3iydalt mncil()srraum nu0aee mi3iatlmDum(vs;()artoifctydoaDeanvo t0tetrxo3oo4ap emics () Dtrx  nu1aexomociatfa ea( p;(4altrio3oatfm eaneolt trtr(r3oo4om n ictat  rum( p;t1tex mieiyslm rmnvpnt0aetnxo3iodoa  lnesl()texoir oo4al nlietlt s2trurooo0apen ietadfmDua(vp u4 rtomf iadfaD  nvo;s0 2xoim3oodal eliei tfaDra( oot0texnmoeils mDrlumo;t4arxnmocta1la   ivo ()trxmxm oo4ameelicsl(  rtr(  oo4tlxnmieiadls uluvo (4 exrxf3tydom r ies s0 rxrir3oodll elietl() Dur(rpno1opxn i3iasfmDemnvs u) exoiocoa1laD  uvo (0trxr(o oodomtnmfesls s2rmu  no4tleo feiytfs em(vsnu)aexnmrcia1oa r nvsl()t2uoxrpnu1openlietat)srraump;o0teeomoetasfs2uauvo u0altoir3ta1fm  li i;( trtm(m iu1olt mfvi () 2ua(monu4oetomf3iadlaDea( s u4aeeoxf3tytfa e ivi t0teumxrpoy1lptelfvils a2taxr ;t1opt mf3iyt m2ul(vpnu)trtomr3ia1lp eli ol(0tetoiopiydopen nct tf 2rrurpou4tlt  o3iat m2rmnmo;u0altoifciodoaD lu s t) exr(m ny4ope lietl(faDur(rpnu1oltomieilt aDea( s;u4 etoir3iydoptranesls0s2umir ny1apte fctls)aDuaumpou4optoiiciytfs um( on(0alxnxo3iodlate u s t0 euoxopnu1apt mnvsatf Dta(  nu0aee  f3iat s2um(mp u4 ltnmo oatlate uvo;()s2xr(m iu1llen fvs tfa2ur( ont4tlt mi3iydlaDuln sn(4 rxnmr3oadlmDrauvo (0t2tmir3oy1lmt  nes t) 2raur ;u0altnmoeiatfs el(vs (0aetrmoctytlpDe nvi () 2tmxm3iodlmtnmfetl(fa2ur(mpnu1oeenii3tydlaDem(mpnu0trtrifctadom elivs;s  2xoim iy4ope  fcilsfsrtmxro;u1oexo i3iat s2ea(vont) eermociytfaDeliei t teuo(mpiudll e ivi sfarrrxm ;u0ale  f3iatfa2rl(vs;t0altniocoo1lm rlnei;( t2to(o io1op emieias  Dum(ro;u4aetnmiciytla ra(mo t) eenmfcty1lpD  i s () 2um(m nu4llenliesa()sDtrurpou1oleo feiltfa ul(ms u4aetnio oadfp  auvo (0 rxo(opnu1ll elfet sfsrum(root1alxnmf3ilslsDran p t0alxoir3oa1oa  ln sls0t2tm(m3io4lmtn fes sf rum(r ;t1oetn o3ilsfa2umnvsnu) exnmociytopte neolt  rxrxrpiudomte ies (fs2ururo;u1tleo oetaslmDel( p;t0teenir3iadlpDeanvsl()s2xmim iydaltn ies t)artrur nu0tpx  ieiydfm2eanmo;t4tltrxr3iatfate n i;t)t2tr(r3oy4amt livsas)s2umxm nt0aetn fetyt m um(ms;u) lxrmf3to1fmtelues;s0trxoio iudlmenlfvil()aruru onu4tetn feiysfm2ranms t4 eermr3iadfateln s t) rtmxo iu1optemiesas)srrrx p;o0alt iietlslaDrlu pnt4teenxr3tadfpDranvils  rtr(r oydapeemicilt)arrm(mp;u1apen octadfm2ulnvon() lxnmrctatfpDeanvols0srtmiopoy1apee icsl() Duau pnu0aee mo3tltls2em(vo;u4 lxoxfcoodlatelivs;( srxrxmpoo1lm e ivsas)arta(ro;t4tlt mfeilsfs2rlump;(0alxomrcoytlm elneilt0srxmio iu4lltemivt t) rrr( p;t1alt  feiyd s rlnvpn(0trtoio3iatom rln o;(0 2xoio oudll  livt (fa2um(  ;o1aptn o3tytfm2umnvp ()trxoxrcoa1faD livi;s setoxr3oydom e iviltfs2rmum ;u4oleoif3tatfa umn p;()alxnircoa1la e uvi;s tetr(mpno4lm nmnetls) rtaxro;t1aetnmfciytfmDeauvo t4tlxrif3totomtr ivslt  etr(m oydop n ivsat  2raumoou0aetn fciasls el(mp;u0 lxoxf iotfpt luvs;t s2ur(o iudapeemfvta( a2rrurp;t1apeo fciasfsDul( ont4tetnmf oatfm elivil()trur(opiy4am emfvslt)a2tr( onu0altoioeilslsDrmnvp;(4tlenir oydoaD lnvi s)s2to(r3nudol   fei t srtrur no0tetomi3ias s2eanvs;u0tlxnio3tatlmte nvs t0sexoxopiydal n fciatfsrtmxmpot0oetomieilsfm ra(mpnt4tleoiocoodoptrai s;s)s2toxmpnodlle mfcsl( srrmumooo4alx  feilsla2eau s;t4 lxomrciodfaDelu i s0s2uoxopnu1ll nlfvta(  rurx poo1optn ictltla2uauvsn(0texoio3io1lmte ueo () rxmimpny4lle mietat aDuru  no0tex ifeiat a eln pnt4artrmocootoa elivi t0 eur(m nudamenmfcs ()sDtmumono0aptoifciysfa uau p u0aexoxo3to1fp r nei;()tetr(rpoo4olen fci s aruax pot0apxnmociatfa2ean p;u4texoir3totlmDelneils)s2umio3nu1optnlivi () 2tmur nu4aetnmicilslsDrm( o (4tleomr oytoptrlneo s seuo(mpiudlm n fetl( a2rr( p;u4apenioeildlm2rl(vonu4arxrio3ootfat anei ()setm(rpoo4alt  fetas) Dumxr nu0teeo feiytlmDrlumsnu)trenxo3oydlp rluvs t trum(m3iodlpeemivtls) Dum(  nt0apeoiietldls rl( s (0 rxrir iydfaDr ieils setrio nudamte feiatf rraxroou1teeo ieilsfa ulump;u) lerxrciatom e ues;( trtm(o3io4lmt lfetls a2rrump;u0apxn oetys aDea(vo u) lxnir oydom raivo;()setriopoy1ome lnvilsfsDta( p;t4olx ioctls s um( p t4aetnifciydomt an i s) euo(mpoy4alte iet ( artr(rooo0alxoiictlt m raumo;u4 eeoir iadfpDrli s s  etr(r io1ole lfvt ()a2rmxr nt0tpenmi3ilslsDemuvo () lxnir3iydlm rlnesls srxo(m3nydome  fci t aDtr(rp;t0aetnmo3iltls2emu s u4artnir3iytlp rluvi ( srxo(opoydapenliesl() 2urumont4altoio3iydfsDrmn s;u0tltrxrctytop eaies;t0srtr(opou4olee ivi (fa2rrurpoo0apeomietysfs2rm(vs;t)treomo oydoate nvi;()trtrxrpoo1op  mfctlsf 2uaump;o1tee if3tldlaDrm(vs;t4 lxnxoctotoateaiei s)t2umxr3iy1oltnmnct s)aruaxm ;u1alenmfetltfs eaums;()arxnmf oadop  lnvs;( srxr(r oudal emnvi tfaDrr(mp;t0tpto ieiad sDeaumo ()tetrmr3oydlp rliei t)srxmio io4alee fet s) 2tr( p;t4opeomfeiyt a el(ms ()tetoir3ta1omD  ues;s)trum(r io1lp  mnctat)sDrmx pou1oee if3ias m rm( pnt4altnxr3iy1fmD  u slt) 2umxmpoy4oltnlnvs (  Drmur nu0ope moeilt sDumu pnt0tetrirciadomDeaieo ()texrxo ny4omenlnetls) 2rm(rp;o0tlt ii3tatls rln o;t0 ltnif3tadfa  aiei ()t2xoxm nodamte ivia(faDrr( ont1tpto oetltfaDrmump t0 lxrio tatoa rau s s)sexrim nu1op emivil(fsrrm(m nt0aptoii3ils m ean p;t)alxrmo iy1lpt lues t  eurxo3iu4lpe lieta(f rtaurooo4tpxoiiciysla ean p;u0alxnmrcta1lm rlivo t0setr(r3ny1opte ictlsfs2trumpou0oeen i3ilt aDuluvp u0arxnmocty1omt lnvo t0seuoxr iodlltemfes s  2ua(r oo1opxnmfeildlaDelnvp t4tlermrcoa1lateluvi;t0t2xmxr3io4altnlnci ()artaxrpot4opxomfeildlaDrmu sn(4 ltriocoydlmDrlu sls)t2xmim io1llee ivs s  2rrurp;u1tpxo i3iyt m2um(mo u0tetoxf3oytlmt  n o s0 2trxr3iudom elictl(  Duaxroot0oet iociasfm ra( o;t) lxnmr ia1oaDe uvils)s2xmio nodolt mies ()srrmx oot0tlxnio3ils sDul( p ()tleomoctotfa eli sls  exmimpoo1al   fvi (fsDumu oou1tpt  o3iyslaDemnmp (4 eerxr3oodfmtr nes s)trxr(m3nydop e fvs t)srraumonu1tlt ii3iasfmDum(mp u0trtoiociytlp  an s ()teto(m3iodomenlivias) 2taxr no1teenmiciltls rmuvont4tleomfcoy1omD aiei;s s2toiopnu4ol  mncsat s2rmum ;t0oeeo fctatls rl( s;t4trerxf iy1lpDrau ols0trto(rpoy4ameemivsa(fsrrax o;u4aee ii3ildfm umn s;u0tltnxr3io1om  an o t)s2trio iydop emict ( s2rr(mont4aetomociysls2ran p;u0 leoxfcia1fmD  ivol(0s2uo(m3oudap nlnesl(f Draxmp;t1aee mf3tys s rlnmpn(4teermo oodlate uvils0 exrxm3iu4lpe lnviatfsrrmu o;t0ale mociadfm rl( s ()areoio3oy1opD lieil( t2xmxm3oy4lptelfeslt) rumxrpou4tltomfciytlaDrau s u0aeenir oa1fp  ai ols t2uoir3iudolenlics tf 2ur(mpnt0aee iietlslm ul( snu) lxnifcoatfaDe u i;( t2trxr io4apenlfctl() 2trumont0oetnii3tlslm el( sn(4trtnif3ta1latr ieolt)tetoxo iy1am elnei t srtaumoot4aptnmociysfmDul(mp (4altnmo ta1fa eln i t  2xoxr3iu4olen ivi s)sDumu  oo4aleomf3iat a uluvp;()aeeomf3iotop eln i t)trxoxo3io4open fvi s arraumooo0tex io3iytla emuvonu)alxoifcto1laD anvi (0sexo(r oo1lme  fcsls sruaurp;u1tpxnif3ils mDran o;t)aleoio oytlpDranvol( seuo(o3oo1ll n nctat) ruaxm oo1aleo feilsfs2rmn s;u0 lerxo tydlateanes;t s2xr(mpiy4lmtn ncils  Dua(rono1olt mo3iytfa rmnvo;(0aetrif todfmt liei s0 2urim nudlltnlfcsatf ruaxmo;o0tet ii3iasla2um( on(4aexrxf oydla r u i (0tetrir3io1amtnlfvtas) rrrx pnu0tpeo ietatlsDrlums;u0treoxf oy1laD an s;() rumim3ny1aleelfvsatf rtr( onu0texnmi3iad mDua(ms;(0 etrir oa1faD au ol() etmxo iy4llenmfesa(fa2umu pno4alxnif3iat s ulu pnu) eenxf oo1lmtrai s s  2tmxr3oy1ape  ivtlt s2rmxm ;t1apxniietytfa2rl( o;u4 etnmfcoodfpte ieo;s)t2xoio iodalt mivt (faDta(rpou4aeenifctldls ulu s;t0arenmfciotfm ean s;t0trur(o3nydolen ncsas) 2ua(  ot1aeeoio3iad m rauvonu) eeoiocta1oa  au i;(0 eto(mpoudlltelnvi (  rtmx  nu0olxnmictlslm rm( s;() lxoxrcio1lateaues () 2ur(r ou1lpenmfvtls)aDraurpno0tpx mictydfm2rlnvo;u0 lxnmr oytom eanei s teuoxr ny1am elnvi s) 2rrx p;o0tpe mfeilsfs2eauvonu0artrmf io1opDeauvs s)t2xo(m nudam nmiesatfaDtaxro;t0alenmoeiasfa elump;t)aeerir oa1la  aivo t trtmxopoydap  mivias) ruru  ;t4aee  iciaslaDrm(mo t)tetomfcty1fmDr n i;t0 etoxm iodomtnlnetas aDtr(rpno4tleo iciaslm2uanvo;()tlxnxrctadomt ai s;(0 exmim no1lpeemfetasfsDuau  nu0oexn oetyt a rlnmsn(0alxnxfciadfmtraueils)srum(mpno1lp e nei () 2ua( pnt0aex moctyt a2ra(vsnt4tltomr3tydfaDe neils0texoirpoo4lpen fcsasfsrrrxr oo4ale ii3iysfmDea( p u0tetnxo oa1omt  n i;( trto(o ny1ape mnvilt a2raurono4apxomoetadls2rmumo;t0 rtomocto1lp   u o;s  rumio3no1lmt lfes t)aDtmum ;o4ape iocils m umnvs;u4 lxnxrctotomte iei () rurimpiy1llen ivsl()aDrmump;t4opxnioeias a2umuvpnt0aleoxr3iotlmtelnes;s  rtrxo ny1ome mfvi s  Dtaxmpou0aexnmictyd sDrln s;u0 lxnxocia1fmte nvs () rur(m ou1lp elivtatfaDtm(rono1aexoif3iyslm2ran p;(4tleoio iy1lmD  neo s0 2umxr iydom e nesas)arraumpno4opt  f3tyslsDea(mon() exoxrciadoatr u ilt) rxrxrpoydlpenmnviasf rrm( pnu1olx  f3iad a rmums;t0altoifciatlmteluei t) rxr(r iudal  lfvtlt) rtauroot0open icils s raump u4aexrmoctatfpDeai o;s)t2umirpoo4ape  fcil()sDurxrooo0oeeoiociytlaDumnvs;t0alxnmr to1om   i s;t)srto(o ny1ape lnvsa()aruax ooo4olxniociad m emumon(4 eeomrctytlaDrlu o (0 exr(m3nudopee fvil( arrax pou1aee ifciadfa rmu pn(4tltrirciytfmt  i sl() rumxmpiydoptnlfetas) Drax o;u0apeomoeiad s2uanvo;()artoxf3tadoaDrliei;()sexmxr3nudlmtemnetlt  2rmxr no0ole  i3tadls rmnvont4 leomf todlpteli s;s s2uoxm3nu1ameelici s) 2urx o;o1alxnif3iatfm2uanmpnu) exniocoa1lmDr n i;t0 2xmir3oy4aptnlfvs ()sDtmx  nu1aptn iciysfaDraumsnt4arxnmo3oydfpDean s t) eto(r iu1lltelnetas) rururonu4tleoii3iatla uauvsn()altrxf iydlptraivils0 ruoimpio1om n ictas)a2rru  ot0tlt ifeilsfmDeauvp;() lenxfcoodlmD  neslt tetmxopiodlltelictat)a2rrxmont0tpx mietysla2uau p;u)altoio3io1op eau ils  rtoim3ny4op e ietl(faDraur ot1tpe ii3tltla rlu s;(0tleomr3to1faDranvo;s0s2ur(o nu1lptelfcs tfaDtmu p;o0oltomictlsfs2emumpn(0tlxrio iadfp rai i;(0trtm(o3iudlpe  nesltfsrrrx onu4olt mo3iydla uln p;(4trtrmo ta1opD  u i;s0 eurir3oy1apt miesas)sDrmum no0alto f3iys a rl(vonu0 rermr iadfmtr ivil(  2umir3ou1omtelnciat arrmx poo4tpto oeilsfa2ul( pnu)artnxr3oatfmtrai i s s2xrxr iudam   ncsl(  2raumpot4tpe ioctad a2uaumonu0tlxnio3oytfp r u s;t)sexmxm3oy4omt  ici ()aDur(  no0aexomfeiydfm2eanmo t)trtoxr iydoptranei t)srxoio iudom  lnctat artmxmpnt1oexo oetad s2umnmsnu0 etomr iytlaD li s t0trxoxr iu4llenmfvtlsfs2trxro;u0texo i3ias s raumo;t4aeerif3oytlaD luvs;t0 rxrxr3oudll elneilsf rum(mo;t1tltnioetldlmDrmuvpnt0tlenmr oytomDraues;s)t2xr(opiy1lmtnmivsl() Dtaum nt0texoif3ils aDelnmo u0aeenxr todfp r uei s0 2umir3iy1lm elici s a2ua(  nu0teen feiysla2ua(mp;t)arxoxrciotfmDrlu ols s2urxm io4lltelnes s) Dtmxrpou0aetniieiltfsDranmp t0alxomrciydlpDeauei t  rtmir nu4olenmieiltfsDuru p;t0tpeomfciatlm2eauvsnu4tetoirciatop   ies;s)truoiopnudlpee fes s)a2ra(mono1aptoif3iysfsDea( snu) eerifcio1om r n i;t) ruoir nudom nlivt t aDumurpnt0ale mfeiatfa rm(mo;()treoxf3totlp   ieols0 exoxm3iu4oltnmfesas arrrx poo1texoiociat m ulu s;u4altomf oytfpD  neols0 exmim3iudlptemncslt) Dur(mpot1apen o3iys m ea(vo u)tlxnir3oa1lmDrlnvs t)trtrxm3no4al emicsl(  2rmu oou4altn o3iadlm2rln o t)aexoxr iytfm  auvo s0srtoiopiy1ol  lfvtlt) rrmumoou0aetnmietat s raump;u0aetrxf oa1fm rlivils0 2trxrpnu4alt licia(  2taumont4aexoii3ias s2ulu ont0 etrmr3oa1latean slt)srxo(o oy1omt mnvi s aDuau  ot1apx ifctytla el(mp u0texrxo ia1lat lues;( seumxm3nydom nmfesa(f 2urx pnt1tpeomfciadfs ra(mpnu4aetrmocoatfpDelnesls) rxr(m3oudll elfci ()arrm(mont0aee ioctlt aDrlnmpn(0 lxrxf tydomtr ieilt)s2to(opoy4aptelfvils) Drmx  oo0tlx mociltfaDelu p;(0tlenxfciytfaD  u ol(0 ruoxrpoydaleelnetlt)sDumum oo1oetnmoeiydls2rau s (0aexoxr iy1lptran s;s  eurxmpoydol e ncsl( s2tru  ;o4oetnmi3iadfm2ranvpnu) exoio3iadlpt  nes t) ruoxopou1amee ivt (fs2rmxr nt1aetnmi3iyt a2rmu pnt0 ltoir oadom  lu s s)t2xmxo3iydomt lfcils) Dtm(m ou0opx mfeiyd m rmn p;(0 rxoifcto1lmt  i slt s2xoxr3oo1ap  lfctasfsrtmurp;t0tee mfciad mDrlu s;u) lxnxo todoat au ilt tetm(r ou4optelnct (fsDurum nt1tet mo3iydlaDulumont0 lxoir oadlatelieils)teur(r nu4lmtnmicsl( artrxmo;t4oet mociad aDrl( snt0aexnxrcoa1fm  anei;(  2to(rpio4lp  lfesls aruauro;o1tltoifeild m2ul( p;u) ltnxr oydfmDraueo t  2umimpio1op emiet sfaruaxr ;o0tex ii3tasfaDua(mpnt)trxrxo tatfmteanvs () rtrim3nu4om   ncs tfarum(mpou0tlxnmf3ildla umnmp;u)aeeoxociadfmD  nvol(0 rtmim3nu1al elnvils a2taxr ou0ole  feildls2um(mpn(4 ltoxr ty1lpt  i i;t0t2urimpnu4ame lnetlt sDra(moot0olto f3ilsla2rau s u)tetnxf3iatlmDraivs;t0 eto(o3nu1openlnvsat)a2ra( o;u4tlx  ieiltfaDelnmont4 lxrir oodfmD livo;s) etr(o ou1al n ieiltf Drrx poo4tlxomfcils sDrluvpn()trxrmrciydopD aivi ( trxo(mpnu4ape mfcs sfa2trxr nt0ope iietlt s elnvo;u) etrmf todopteliei s)setrirpnu4llen nesa(fs2rrx o;u0tle io3iytla2ea(vpn(0 exoif oa1lat  ivs;(0 2xm(m3oodlpte fetls) rum(mpno1teeomociyt a eluvp (0altnif oadlmtr n il(0 euoio oydom  mfcs (fsDraxmp;t0altniociytlaDeanmp;(0aexnir3tytopt anvi;(  rto(mpoo1aptnlfetasfa2ta(rpoo4tetnmfctytfa rluvs;()teerxfcoadoatrauesl()t2umxopnydlme livsasf 2rm(rp;t1teto f3iasfm ulnvsnu0teermf3iytlmte iesls0texrirpoudlltnmictlt)srum(ront1olxn feiltla rlnmp;() leomfciodlmDrlivo t)teuo(rpnudlmenlfcs s)arur( pot0tltomi3tatlm uau snu4tetomfcoatfaDeauvils)srumxm ny1alen ietas)a2raumpou1tlen oeils aDrlu pnu4 ltnmf to1fp   i o;(0seurxm3oodlmenmies t aDrrxrpnu4opt  ociyslaDuau pnu)teeoifciatom eluei s)texrimpoy1ol nlfciltfarrm( pno0olxoiiciatfm umn s;t)tetrmr3to1laDeanvs (0tetrxrpnudamenlnvslt srraxr ou4alenifciyd sDumums;u) etomr3tytlatrauvs;(  2uoxr no4op emfviasfs2ra(rooo4tetn octysfm2el(vpn() lxnmoctodlm   ivols0teurirpnu1al elivi s) 2um(mp;u0oeeomoeiadfaDran pn()alerxf3oa1fpt  n i (0truoxm nodll   nctas  2rrxrpou4tpxoiocildfa rmums;t0aeenxo3tadlpDrai s t0 eto(o3iudlpenliesat s2ua(rooo4aleomo3tas s2ranvs u0aexrxociotfptrai s;s  exoir nu4omtemfviltf rrm(rp;o0apx  feils a2rm(ms t)tlxrmr3tytomteau o;( s2umxo3ny1ll  micias  rrm(monu1oltn o3tad s2ul(vsnt0arxnmo to1opt ai s () exmxm3ny1apt mics t)aDur(rpot1tee  ictld sDumn pnu) lxnif tadlmDrlu i;( seurio3iudol nlnvt ()s2trx p;o1oexn i3ilsfa uanms;t)arxrmfcty1opDraivo;(  etmirpny4om  lietls)sDua(  no1opxo ictas m2ua(vo;(4 etnmo3oodlpDr uvs t  eumxo no1opee nciltf rum(  oo1olx  oeiydlsDul( p t0aleoxr3oy1fa r n i;( sexoxr3iy4openlfcs ( aDua(ro;u0olxoif3tlsfa rm(msnu4areoir3oo1opt  u o;t0srxrio iodlp emneil(faruru poo1apeo i3iat m2eln pnu) rtrmf3to1lp eauvo;t)seurio3oo1ope  nei ()aDtmxmont1tpxo icilsla uan o (4aeermr3oydoaD  ueilt tetm(m ny4opeelfct sfsrrrxmpou0tex if3iytfs umuvo (0tetrio ia1lm r nesls t2tr(r3ou1amenmfct (  ruax pnu4tpeo i3iytfaDrm( s;t0texnxoctodfmDr ues (  2xoiopiy4lp n nesas arra(r no4aex mfetlslmDemuvs;t)treoxfctodlpDe uvi;s  exoxrpoodole lfcslt  rurxm oo1tee mociat m rlu p;u) rxoif tadoaDelivilt  2urxm3oy4opt liesa(fsrtaur ;u0alxo oeiyt a2rln p;u)alxrifcoo1fpte i o;()seumxopiodoptn nvs s)aDta(mono1oetniieiyt m rmn o;u0 rerio3iy1fpt anvi;s0s2umxr3iy4olenmiviltfaDtr(r nt1alxnmieilslm2rm(mpnu) lenxo tydlptrluvi ( t2tm(mpiy4llt  icsls) Duru pno0teenio3ildls2ranvo u4 etrxf totfm raivs (0 rxmio oo4amt lncslt sDrax  oo0tpenmi3iatfs2rmuvs;t0alxnif3iadlpDranvo ( t2uoxo iudll e nvsa(fsrtmuro;o1olxn ieiys a2rlumo u) ltnxf3to1omteanes s0t2xrir3oo1lme lfeils)srrr(m nt0texo f3iadfaDulnvp (4 etrmfcio1opt ai i;t) rxoxmpoy1lp nlictls)s2trump;u0tlx iocils m umuvpnu0tlxoir3oytom e uvol()sruoiopiy1alt lfeiatfsDumuront1oltnmocildfaDrmnvp t4tlxoxrcoo1fm elnesl()t2uo(opnu4open nvt s a2uax onu4ale  oeilt aDemuvpnu4tlxnxf oodoptrlu i;s)tetoxr nu4lmen fctatfaDrax  no0oee  iciad a2rm(vs;u0trermo iadfmt luvi s)tetoxr iudam   icsasf Dtrxmpot0teto oetasfmDul(von(4trerxfctytom e n o;(0s2uoxo no4lp  lieil() 2tmum nu1olenio3iys m el(mo;t0alermo oa1fpDeai slt0 rxo(o iu4ll n nesas)a2ua(ro;u4opt  feias mDelu snt)aexrmo3todfpD  nvil() eumio3iu4lpeemncslt)srtr(r nu1apt ioetydfmDea( o;(0trtrxrciadopDrai sls0 eto(o3ny4lmtnlnciasfarta(m nu0aexnifeiat sDua(ms t0 rerxrciodoaDrau s;(  2uoxr3oo4lmenlnvt (fsDtm(roou1aet  oeild a ul( s t) renif3io1fatrln sl(0 exoirpio4omenlivs s)sDrmxr ot0ale  f3iasfm2eauvp t4 lxnmrctotlmD  i ols t2toio no1apt mfetls s2tm(rp;o1aeen octltlm ua(mo u4 lxrxf3iy1omDeaueils) exo(m iu4amtemfcs t sDum(m ;u1aptomieiasla umnvonu)trxomr ty1om   ivilt0t2urir nu1amenlnvs ()s2rru  ;u4aexo iciadfs2ra(mont0tlxnmo to1fpD aivi s)s2tr(m3io1op nmfeslt)srrr(r ot1aexnmoetatls em( p;u4trermf oydomt luvi;(0t2umio3nodamtnmnvs s)srrmurono0tee moeiasfa2ulu ont0alxrmf io1lmDeanesl(  eto(opio1lp emfei t)sDrmxmo;o4opto oetatfm2ra(mp;t0tleoxfciatlp e nvs;s s2uo(rpoudom   fvi (farrmu  no1tptn ictydfsDem( ont4alxrmr3oa1fm  au s t) etmirpoo4ll   feslt a2rr( p;u4tpenmo3iasfm2umuvpn(0artnif3oatop eauvil() eumxmpnu4oltemfeil(  2ta(mpoo1oet miciat mDrm(ms;t0aexrmociy1omD  nvils0trxmim oy4alt mnetls)sDumx pou1aetoioeiysls2rmuvon(0alxrxocoydlpDean o;()texo(o oy4alenmnciat aDraxm nu1tet iieiysls2eanvsn()trtrmocoy1opDelneilt)s2tmim3nudapenmfvi t)arua(m ;t0aeenmf3iytla rau s;u4tetnmo todfaDeau il( s2xoim iu4lp nlfes s  2rr(mooo0tpt  octlslaDranms u4 renirciy1fpDr u o;t s2urir io4lpeelnciasfa2rm( ont1oetnifetyslmDran p;u) rxoif3tadlp eaieils0texoxmpoydamtelicia(fsDrrxr ou0tlt  i3iydla2ranmp u)teeomf3todfa elueol(0t2uoim iodal e icilt  rtrxmpot4oexo fciadfa rmump ()aeerxo iy1fmt lu o (0t2trxr3ou1alee fci tfs2tm(monu4tltoif3tad a2emu s;(0tltoxoctatlmteln o;s srurimpio4oltemnct s  2urum ou0oeeomi3tys mDul(ms;(0trxoifctotop rlivs;t0s2tmxr3oy4ope mnvia()srtr(mpnt0texnifeildlm rmn on(4 ltoxo ty1fpt  u ol(0t2xrio3iu1ameelnetat) Dumurpnu1alxo feiatlm2rm( s t) etrif3iydlmtrluvil()sexmxo ou1olte ncs t) Dumur ou0opxniieiys mDrlums;(4 lerif3tadfptelnvsls) rto(o oo1oltn fct t s2urxm ;o0alenif3iydfmDuauvont4artnmo oy1lmD ai sl(0setoiopno1altn iviat  Dra( p;u0tlx iieiyslm ulnvo;u0 ltnmfcoo1om  lu i t0s2umio3iudomt micilsf Duaxm ou4olt  ocilsfmDrlnmsnu4 exnxf oodlm e uvs t)sexrxmpoodamenlnvslsfsrta( o;o1alto i3iydfm2ea(vpn()trtoxrcty1fpt auvs;(  eumxrpiy1aptn nctasfs2ur(monu4alto feiatfmDelumon(4aexrmr totop  an s;s setm(mpnydlleelncs ( sDtmu ooo0ope  f3tadlmDem(vs;u0 lxoxo3ia1fm rau i t0t2xm(o3ny1olte iet t s2umxm ;t4oet  ictydlmDua(mon(0 reomf3iodlm rlies s)sruoim3oydlm   nvta() Dra(moou1teen ictat m2rlumpn(4arxomo ootfaD auvi s)t2xr(mpio1aptemfcs s) Drmxr ;o4alxn f3iysfaDrmuvs;(4tleoio to1la  auvil() 2toio3nudlp n nvsl()sDua(m ot0opeo fctadla uaumsnu0teenxr oydlp  au o;()trtoxo3iy1ol emnetls s2rr(r ou0tpxnio3ild s2eluvsnu4 lxnxfciodfm  au o ()texmxm ou4ol nlfcilt) Dur(  no0ole  ietat m ulumo;u4arenxf3iotlptr uvo;()trxm(o3oydlmee nvi (fs2rrurpot0tpeoii3tyt sDuan sn(4aexrxocoy1opteai o s) rxrxrpnydlm  miesat aruaumoot1oeeniiciysfmDeau pnt) lxrxf oy1op rlueolt)setrxmpoodlle  icslt  2um(r oo4oetnmo3iys aDrmnvp;(4 leoxrcoatlp  auvslt seurxo nu1lm nmfvsasfaDtm(mpoo0opx  iciltfmDeauvsnu4 rtrmo oydfpDrlueol(0 eumxo iy4om  lncs sfaDtauroot4opxn iciyd sDumumo u4altrxrcia1fat luvo;t)trtoxr3nudll  mfesl()s2uax ont0aeenmfctlslm rlnvp;()aeenxf3iydomt lnvs s srxrxr3no1omtelncia() 2taxrpno0tlxnmocils a2em(mp;t) rtnxrcoytomtelnesls0trtmim oo4open nei s  Drrumo;u4opxoiictlsfmDrmnms;t) etrmf3tadfpD an o t) 2xr(o oydlme  nctatf Duaum ou0aeeoif3iatfa uluvsnu4tltrxrctytlm rauvsls)s2urxmpoydalee fcslt)a2rmuront4oeeomfciltla2umn s;u4 lerxoctytfa rluvi ()trur(m3nydlleemivslt)a2rau  ;t1alxnio3ildlm uauvonu0tlxrxfcoa1fpDelu i t0 rxrxr ny4openmnvta(fsrtaxm no0ope ifeiat a um(vo ()arerif iadop   n o t0s2xmxr ou1lmtn nei s  Dtmu p;u1oex mo3tldfsDulnvpnt)trerirciatlp  aneil(  etmxr3iodll nmfvs t)a2rru poo1oet  iciytfsDrm(vo;t0aeerircootlatr n o;s)trtrio3nu4al nlivtltf Dtm(monu0tex ii3tas a2em( p (0tltnmr totfpDe uvs (0 2xo(r nydllt mncsltf rta(r oo1aptniieiadfm2uaums;(0trtoiocoytfptr ivil()srxmxmpio1apt mfcsls  rrr(  ;u1tptnioctldlsDel(vp;t0 eenxrcoodoa rauei;s)trurirpiu1lp  lnci s  2rmxmo;o1apen fciltlm2el(mp;u0 rtnmo3oy1lpt  nvo ( tetoimpoydlltn nvi ( sDua( ooo4aptniiciydlsDuau o;(4aeermf todlm rluesl(0tetrxo oo1lmtnmieilt a2umu  oo0opx  fctlsfm uau p;t4 etomo3ootfa   u s;(0t2uo(r iydop e feilt)srur(r ;o4oetniieilt sDemums;u4 lerxfciotopD  i ilt  2uoiopnudlmenlnct t a2ta(mo;t4tle  feiadfmDea(vs ()arxnif ootlptraieslt  2tmimpiy1ome  ncil(farur( pno1tpx  f3iad m2em(mp ()tetoxo3oydfpDe uei s0truo(rpnodale lfes s a2rr(  oo4tetn ociadfsDra( p (4 rxomo3oadfpD lnvi;t0srur(mpiodll elies sfaDtaumono0texniictad sDelnmpnt4trtnmr iodfpt lneo (0texoim3ou4ape mneias  rrmxr ot1aetomietaslaDeluvont) lxnxo3tydom rlivs;t t2trimpnu4lmtemnvsa() 2ua(mpot4opeoifetyslaDumnvpnu4aeenmfctydlp eaues;t  2tmxmpiydalt  ict ()a2taump;t1olx  feilsls ul(mpn(0arenxfciytlpDe iesl()teumxrpiy1al e ietlt s2rmumoot4oet moeildlm emumo ()teerxocoydoa e ivs;s setmio3no1aptnmfei ( aDtruro;t1oeenioetldlm umnmo;u) eeoxr oodfa ran o;s)tetrio nudapt mfvt sfsrta(mono0aeenmfeiyt sDumumpnu)altrif iotlmDeauvo t  eum(m ou4am nmnvtatf rrax p;t0altnio3ils s umu pnt)trenxociotomD anes s s2xr(rpny1lp e fes (fa2ta(roou4tpeo ocils m2rlums ()arxnircio1faDrli il(0trumxmpnu1oleelnciltf rtmu  ;t1tpxn fciad a2emnmonu4 ltoxocoa1laD auei;(0 2xoxr3iudap  liei s)s2trxr ot4aeto oeiad sDrmu s t) lxniociadlpDeau o t  rxmxo3oy4ome licil(fsDumumo;u1opeo f3ias s2em(vont4 lxnirctytoa rlneo;()trtmim oy1ol nmicsasfarur(mp;o4aee ioeilsls2ulumonu0aexnifcoydlate nvs;()s2xrio io1ll nmfeilt aDuaumonu0tlxn icilsfm um(vpnt4alermf3to1omD liei;s)setoim3iu1lp e fvsls  2umu  ot4tleoifeiysfa2eln snt4 rtoxocoadopD aieo;s0trxoirpiy1omt mfeiat) rururpnt4tlx io3iyslmDem( p t0 eerifcta1lptrluei;() rtriopno4amenlfci s sDtrxroou4oltnio3tasfm ul( onu)alxriociytop r uei (0srto(opoudoltelfesls) Draxr ;t0aexnmi3iys mDelumo;(4 renxocta1fmD an i;t  2xoimpoodamen iet sf Dtm( pno0tpx ifetyd m2uaump ()artrxrcoo1fpt lu sls0texrir3iy1lpt  nei () 2uaur ot0apto feiytfsDumnmp () ltrxo ia1la e i i s setoio3iy4amtn fes t  Drm(rp;o4aexn o3tyd s2rln s u4altrxr3tadomDrau i;s0 2toir oo4aleemnei ()sDuru  oo0optomociyd a2rl(ms u0 ltnxo3oytlaDr ivs s) etm(opny4om nlieias artrump;u1aexnmfeiatfa ulumo;u)arxnxr3oo1optraies s t2xoio iydlpeelieil( s2taxrp;o0tleo o3iltfs2ua(ms;()trxrmr io1oat lu s (  2xoim ny4omtemfvt sfaDra(roou1apxn o3ias m ranvpnt)altnmf oydlaDr n o t  ruoxm ou4lmtemfvsasf rum(mpnu4tptnmoctytfm ea(mo;t0alxnxf iotfp eln ilt) etmxo3iudalte ncsl( arum( oou4apxniictad sDemn p t)aexnxocoodfaDr uvols  2to(m3ou1altelfvsas  2rr(ront0oleo fciytfaDum(ms (0 lenmr3ty1lp elneol( t2xoxopio1ale livsas  rur(  no0olt  fcild mDulu o ()trerxfctydfp eai s t)t2tmxo3ny1opte neias)aDtmxronu0aee iociytls em(vs;(4tetnxfciotoa e n o s) 2xr(r oudalenmiviatfs2raurp;u1apxo f3tasla2uanvp;t)teenxf ia1lmDraivil(0teuo(rpoo1ope lfvia(f 2umx  ot0olto oeiltlm2uanmp u) lermf iodfmt  neo t0tetr(m oy4op  lfctlt)sDraur ;t0tex ioeiydls2umnvs;t0alenmfctadfmtr ueols setmiopio4oltemneilt)sruaxm nt4olxniietys a2umu p t0 eeoxo3iatoa  auvils t2uoxr3iodamtn fvtlsf rrau  oo1tex miciysfm ea( s;t4arermr oa1fpD au i s) exmxrpiodal nmfct s  2rr(r oo1oeen ociyt a2ea(mpn(0tlxomf oydlpDr nvo;t  etr(m3iy1alt lfci t  Durxmo;t4oetomociadlmDrlnmp u4aexnmfctydomte nvi;s)s2xo(r3no4olenlfvslsfsrurxr ;o4apt if3tyd s2rau o;()alenmfctotla  au sls0seumio3oo1am n icsas) 2rr(  oo1texo ieiydfm2rmumo (4 lxrmo oatfm e uvs;t0 2um(r io4amenlfci (  2ta(r ;o4oexoio3iatfaDeln s;u0trermoctydlatr uvo;t)sexmxopoo4am emicsas a2um(ront0oexn ociltfa umnvp (4 lxoxfciodfaDraiei;t) rtoxm nu4ap emfet s aDraumono4tpt mi3iatfs2rlu p t4alerio3iytoat  n o s0trxr(o oydamt  ncsls aDum( ooo4opx iieiatla2ranms u4 renxrciy1opD lnvsl( srurxrpoydllenmnvia( arrrxrpnt4ole mo3tldla2uln s u4 ltoif3tatlpDrli o (0 rtoxmpiy1llee nes t)a2tr( pou1alt mfeild sDul(vp;()arxrxfctadlaD  uvil(  2uoimpoy1ome  fesas  2ra( pou0tle mietysfs2ulnmon(4 rtoxrcio1laDeluvsls)tetrirpoo4llenlfvt tfsrtax o;u0aexnioeiyd sDeauvp;t4aleoxf iadfpD an s;s  2ur(rpoo1oltelfes tfarrmumo;u1tex iietat s rm(vs t4aeenir3ty1fpDe i ols sexrirpio1lm elfcilt)artmumont1texn i3ils mDemnvs;t)aexnio3tytom r i s;s tetr(o3no4al e ivtat  2raxmpnu4oleo ociatlmDum( s;u0artnmrctadfp r i o s0 exr(o nu1lm nmfei sfs2tr(rooo1oleo i3iadfsDrau p () eenir3oatlmDe uei;s t2tr(m3no4olenmfetlt sDtrum ;t0tlx ioeiatfsDeauvo (0aexoxf3iy1lpte n ol()t2ur(rpou1lpt licta(f rtaxmo;o1oet micilsla rl( pnt0 ltrif ta1fpD auei ()srtoxopno4apte ncilt  2rrur ;o4oeenmfeiatla umuvs;t)teermo todfptelneo s srtr(r ny1olenlfvi ()aDrax  ou1opx  ietatfs ulnms u) ltoxocia1fa eli o;(0teur(o3nodol elfcsat sDrm(mpnu1apenii3iytlm2rluvsnt0trtnir ta1faD  neils) 2tr(r3iy4lp  mnvtasfarumxrp;t1alx if3iadfmDum(mon() ltrmr3iodfatraivo;t0 rxoxr3oydomtn iei tf Dtrump;t0texo f3ilsfa2rmumpnt) rxnmo3ia1opDrauvs ( t2uoio3nodapenlfcta(fsrrr(ront0tpxnioeiysls2uaumpn(4teeoio3oatfp r nvo s  rur(o nydalt mnesa(fsrtaxmo;o1oex  octytfm emu s;u4aetnif oatfpt  i i t0trxrim nu1ole lieia()aDrr(rpnu4oeen ociydfsDeauvo;(0 reoxf3ty1lmte n i s0 exm(r oo4alenlnciatfsDuaumo;t1olx  iciltfs2rmuvp;u4 eeomo3todopt anei;s0 rtoir3ou4lp elfeilsfsrta( ooo1opt ioctltla2el( snt)aeermo totfaDraieols0t2tm(rpoodlm  lfct ()aDrm(  ;o0opxn i3iatfm2uauvs (0 ltoio3totom   u ilt0 etoxmpio1am  mfes t)aruau p;u0oex miciys a2rl(vo;()arxrmr ia1fat livs t0srtoimpoy1alen feias  Dum(m nu0tet  oeias s2umums;t4 ltomr3iodfaD anvo () 2xrim3oy4lleemfeiat) rrau  no4apenii3iysls2uanmp;(0trtrxfciytlmD  iei;s  exo(m ny1ope  fesls)sDrrurooo4tlt  octatla emnmp u)altrir3oy1opteaneo;t) etoxm3nu1ale mfvsltf rrm(m no0tpxoio3tls a ean s u0 lxnmr ia1fatr uvs t0texrio3io4alee iesat)s2rmu ont4tex  oeiltlm2rmnmp;t)tltrio ia1oaD aneo t  2trir3iudamtelfctls arrm(  ou4ope  fciatla2rlnvs;t4tlxnmo oytfm eaies s srumxo3iodomt  nci t  2urx pot0ape  f3tlsfa ua(vsnu4 etrxrcootla  li sls0 etm(m nu1altnmfetl( sDurxm no1tpe mo3tysls2emn p t0aeenxr iotfmDr ivs s)s2um(m3nydol elfcil(farrrurp;u4olxomo3tas m rln s u0 exnmo3oadlpD aues ( sexoxo3nu1ol   feta() 2tmx pnt4tptoio3iydlaDulnmon(0arermr3iotlaDelnesls)t2xrxr nu4ll e ictas sDururono1tpxomieiasls uaumo u0arerir3oytoa e u i (0setrimpnu4openmivilsfa2ra(m nu0ope mfctasfs2uln o;t4 rtomrcio1fm r nes;(  exrxo3nu1ome  ics tfa2raxrono4aex mieild aDrln on(0trxomfcoatlp  luvs t0 2umxo3iudlmenlnesa(fsDtaur ou4olxniictls s2elnmsnu4alerxrcoydfm r u i;s0trxr(m3nudap n nvt t  Drrx  nt1opeomoeiad s2uluvonu)artnxr oytoaDrauesl()t2umxo3oodamtn neiat artmu o;t1oltoifctat s elu pnu)tlxoifctydlmt aieils s2toxopoo4apen ieil(f Drmurpot0ole micilt a em(mo;t0 rermr3ty1fm   uvsls) rxr(m3nu1ll nmfesat)sDrrurp;u4oleoiietld mDrlu o t0 eeomr3oodfa e nvol(0seuoxopiodalt  fcil(f 2umxr ;t0tpt iieiysfmDul( s u4teenxrctodfa e n o;(0 euo(o3io4lpe  iesls)srrr(rpou1alt ii3iysls2el( s t0altnifciydfa r ies t) 2xoim3ou1lmt  fes tfsrur(m ;u4tetn ocilsfs2ul( snu0 etriociy1fp r nvo s trxrxmpnudopte fet s)aruauro;u1altn oeiltlaDum(mont) etnmf iatlmte uvi;s0seurxm3iydlmenmfvs s) 2taxm oo4texn ieiyslmDul(vp (4tlxomfcto1fm   n s;t srxrxr3iu1am nlnvi s  Dtax  nu4tpen octys s2el(vp t4 eenmf3iydlm  livslt0 rur(r iydllee ictat) Dtm( pou4alxnmf3tydfa rauvp;u0aexnmfcootoaD  uei s0seto(opoudop  mnvtls)aDrrum ;o0oexo ieiatlmDulnvs u0trtomr3todfa eaieil( sexmxm iu1om e fvilsf rtmxr no4olxnio3tysfsDrau o u0trenxo oodop r iei (  etrim3nudalenlfvtas srrmx pnt4tptnmfeiatfm emnvs;t4 leomf tatoateaieo;t)s2xo(opnydam n fctat arua(r ot1aetoife
\ No newline at end of file
@@ -0,0 +1 @@
+u il()teumxr3iydale lnvsa(faDrax  oo4opeoif3tat s2uln p (4arerirciatom  aies;t0s2tmxo oo4opee fei () 2taxrpnt1alt miciysfs rlums;u4aetoiocia1omDe i s;( s2uoxm3nudllte ivsa()srtr( pot0tetnifciyslm2ranvs;t4 rxoifcio1op ran o t trumxrpnydameemiesls a2trxm nu1tlen feiytla2el(vpn() exoxf oatla e nei;s)setrxr no4amt livtasf 2um(m ;o4aet mfetas m2umuvo ()tltoif iydom  li o;( sruriopnodame lfvil( srum( p;t0aexnioeiytfm ul(vpnt4tlxomo3tytomD aieils)texo(m oudol elietls s2raurp;t1alxn ociltla2rlumsnt)aleomf3iydfa rai ol()t2xmxm3oo4aleelfes (f rrr(mo;o1apxoifcilslmDul(ms;u)arxnmr3iatfaDrau ol()t2xmim3oy4oleemncta(fsrra(mpno0tex mi3iytlmDumuvo;t4areomocoa1fat lnes s)srxrxo nodolenmnvsl( srrmuroou0oeeniietytlaDrln s u0tltrmo3ty1opDe uvo;t) eur(rpoudlmtemncsat arta(r nu4apenmoctlsls ra(vp u4 ltnif3iadfm e n o;()teum(o oudlm e fcs t) rra(m oo4apto ictlslaDrmnmp;t)altrxr3oadfateli o;(  ruoxr3ou1open neil(  2tax pot0tle  o3tldla eln s t)aeermfctotlpDeaivi t s2trxm nydam emivs t srumxr no0aleoioetaslm ra( p;t) eermf totomt  u s t0 2xrxo3nydlme  neta(  Duru ont1aeenmietydfmDrauvsnu)trxoxr oydfmDrlies (0tetoimpiydol emncils arta( p;t1ape mfciadfm2rln p u) ltnxrctytlmDe ues t0sexm(mpny1om eliet (farta(rp;t4tpxomictlslsDrmnvo;t)trerif3ootoaDe u ol( trumxr ou1am nmnciltfsruru pot1tex if3iyt aDean p u4alxnxf3iytlmte nei s0texmxm ou1omt mfvi ()srrm(root0aetnmociaslm2eau o t4arxnif3ty1fmt aies;t) exrio3oydapt lfviat aDraxmpno4olenmfciyslmDulump (0aeerir3oydfm rau o;s  eurxr iodomtn nvsa()sDtmxm no1tetnii3ildfa ean snu)alerxf tadfaDrln s;s0t2umxmpoodlpe mfvia(fsDua(m nt0apt ifeiltfm2ulums u)aexoxoctadfp  lueo;t) etmio oo1ll emivi s a2tax pnt1oeeoiietadla2ra(ms;u4artrio todlat  ivols0 exm(opoy1lm  mfviat srra(ronu1opxnifctasfsDulnvpnt) leoifctytfmt an il(0seuoirpoodoptn fct (f rtmxr ou4tpx mociasfsDumnvp;t4 rtnmrctodfm  li s;s)trtm(o3oodlpt livi s s2tmxr ;u4apt mfeiyslsDumnvp t0artrir iatlpDe neo;s0 exr(m oudamen nei () 2ra(mont1oee mo3iadla2uluvp;u4aeeoxf3ty1fm elu ols0seumxm3iy1ol nlfcslt arumu  ;o1oexnmi3iyslmDran s t)texrmo oy1oaD  nvo;s teto(o3iy4llen fvtat)sDumu o;o0aptoiietas s2eau o;t)arxomr3tadfmDeln s (0 rumxo3ou4ll nmnetas) Drrurp;o4tltn octldls2rmnms;t0tetrmr oy1omDrlies;()tetr(opiu1oltnliesltfartm(ro;o1aleomfeiat m uanvo t0 reoif tydla eauvsl() rxriopiodomtnmncil(  rrm(roou1oee ii3tlsfm2um(vp u0trenmf3ootfpte i o;t)trxoxr3iu4lp nmietas)srraum no4ole ioeiltfsDumn o (4aexnmr oatfaD  n ols)t2uoxm3iodal   fet (f 2rmx oot1tlto ictlsla eaums;t) rxnmfcoy1lpteluvs;()trtoio nu4om n fvsltf 2tr(roou4aeeoif3iaslmDum( s;t)arxnmr oo1latranei s texm(rpiydope  nvs s s2uaxrpot4tpxnmietaslm2ra(vont0 ltrxo iodopDrlnvo (0t2uo(m3iy1apt mnvi t) Dtm(  ;o4tlenii3tasfs2emu s ()aetrxr ia1om eaneo t t2toir3oo1ale  fvsl( s2rrxr no4aexoiiciaslsDel(mpnu0tetoif to1lm ran o;s0tetrimpiydopt mnetlt)s2trx p;t1tet ioetldlaDrau s;t4trtrmf totfaDe uvs t0srtm(rpnydlm e neiltfsrtaxrp;o1alenmo3tytlm ua(vo;t)aexnio oodlpDeluvils)srtm(rpno4omenlfes tf rurx p;u1oleoiictys a uanvp (0trtnxf tadlaDeli o;()teumim oydopte nct s a2raxrpnu4oet  ieilt a rm(mpnt4tlxoioctadoa e n slt t2xriopiy4amte ivt tf Drrxr oo1ope  i3tydfa2ra(ms;u)altnir oadfpDeaieo ()srtmio3oo4ape  icslsf 2rr(rooo0tlenmietlsla2ean p;t0 eeoifcoo1op raueilt0teumir oodlmt  neta()arua( pnu0tet if3ildls ua(vo;t0arenxfctadfmtr n i;s  rxoio iu1openlfct tf rurur ;t1optomieiadla ul(vs;() leoir oytfpDeluvi;t trtrxr nodom e ivsatfartm( onu4tltniiciysfm ra( on()aexoifcoodopDeaivi;t)trxr(r iy1lle mnvs tfaDrr(rp;o4tpt mi3ils a2emnms u4alenxr3iydoa r i s;() 2xriopoudomtemics ( s2rm(m ;u4oltoioeiyd aDua(ms;t4areoir3oo1lmDr n ols0t2trxr oodam elfcilsf Dtm(mpnt0ape  feiytla2eluvp;(0aexrif3iatomDelies s0seurxmpoo1amt mneiat srta(r ;t4aet if3iad sDrm(vp (4arxrircoytfm eaieo;( t2xo(o oudomtn ncia()a2raxroot4tpxnioeiadfsDranvpn(0tltnircto1fa e n i s) etr(r nydal  mfcilt) Durxmpou0tpxo octldfs uanvpnu0tlxoxo3iotopt aiei;()trtrir3nudamte ncsl()artmum no0aet mietlt m um( p;(0aeenmr ootlat auvol( tetr(mpoy4omte fct ()aDuau ooo4tptomoetat mDul( p;() rtnir3tydfa raues;( s2uoirpny4oleelfvtlsf Dtm(rpot0oeen ietat s2uan o u0arerir iytlmtrli s ()srtoxr ou4ol elfvsls) 2rmumoou4tee ifeildlm rln s;t0tlxoif3io1op   ieo;t0srtoim3iudlmeemivt sfsDurxmoot1tet ifciysfs2rlnvont4arxnxr oadfmDeluvi (0trtoimpoy4lmee fctlsf rtm(monu0apeo feiysfa eanmpn() leoxr ta1oaDeaneslt) rxm(opnu4om e nvslt) Durum nt4tlxoiociatfa2eauvpn(0trtoir iadfa ranei s)teurirpio4ape mnesl( s2tr(r oo1aptn f3iytlaDeluvont4artrmf3oytlpD an olt0t2to(rpiy1ap   nvt t  rraxrpoo0olt ioeiysfs2um(vs u) rtoif ty1la  ai il( texoxr3iy1ope  ietl(fsDtmxrooo1aeenmictldlm2uanmp;(4alenif3oo1la r ieols0 exr(m3ny4ll e ics t)srurumooo1tetniictltla rln o (4 lxnmo ia1omD  nvol(  rxr(r3iy1opt  fciatfa2umxmp;u1ale mf3tas a emu snu4trtnir3oytoaD ln ol(0s2xm(o3iy4ame  fvias)sDrr( ono0tle mfctys s2rm( p t4artnmr oo1lmt anvi s)s2tmxo3oo1lltemneil() rrmxrpoo1tpxniiciaslsDrmu s t)tlenxocta1lpDeaues t setm(mpiudapee ncils  2rru pou4oeeo f3iad s2rlnmp (0trxoxociydfpDraivi (0srxr(m ny1apenlivilsfaDtrurpou4olt mieias s2ulu sn(0 rerio iatfp eauvs s0sexmir3oy1am  miei tfaDrr(rpou4olxoiieildla2uaumpn(0 lerxr3to1om   uei;t trxrxm3iudlptnlnvi s)aDrr(m ;u0teenmi3tltfa2uan p;u4tlenxfcootoa eau i;s0s2uo(o3ou1aptemnctat)sDtmxro;o4tpt mfetlsls2umnmont)tltoif iadomteanvs;t s2triopnodomee iesls s2ra(ronu0tlt  oetytlm2elumpnu)tlxrir3oy1omD ai s;s)t2trio3no1ole mfcilt  2tru  ;t4opx  f3iydfsDuln o (4alxoiociatfate i il()srtmio nydlm elnesa(fs2umxrp;u1aexn i3iatlm2eaums t4 lxnxo oadfpDeanes;t  rxr(o3no1olt  iet ( srtm(m ot0tptnifeiaslsDumumpnt4alxrif iytfa e n sl( texrim oo1al n feil(farumuront4apeo octaslaDumnmp;t4trtoxfciydomtelivslt  rxrimpoo4al elfetatfarrmxr ;u1tpt
\ No newline at end of file
@@ -0,0 +1 @@
+i s;t)srxo(opiu4ope lfcs ( arua(r oo4alto icilt a ranmp (0alxoxf3tydopt  ivs;s srtm(r oodap nlfvtas) rraump;t4alxoioetysfs2ra( p;u) rtrmoctotfp r nvs s)tetriopoy1ap emnvsa() rumxro;t4oltoiiciadlm uln onu4 exnmocia1lpDe uvs;s0 exmir iydap  mfctls)a2rrum ot1oltoii3iydlm rmn onu0arerxoctytlpDr i olt)setoio3ou4omen ncia(fsrta(m ou1aptnmiciasfsDrl(vsnt0tltomrcootlm r ueols)t2xoio iy4ll nlnci sf 2rr(mpot4openifciydfs el(ms;(4trerircoatfaDeli o t  rxmir io1lmt mneia( srrmxrpoo4opxnmfeilslmDuluvonu4 etrmo3tadlmDelieo s)s2ur(opiy1lmtemivi s sDtmxroou4oltomiciydls el(vp t4teenxrctytoptr iei s t2trxopno4lmenmivtl(f 2rauro;t1opeomociyslaDem( p u0teeniociydfmt lnvs;s0s2um(o no1olte nvt ( artmxmpot0tpxomfeildfm2ua(mont0alxrir3iodlaD au s () rxr(rpnydlm nlieta(fsDtau poo4apt  ociys a2eau o (4teerif oadop e i s t0sexr(opiodlme lnvt (  Dtaxro;t1oleoifcilt aDulumo u0treomfcia1fptr u ils)trxmim iu1lpt mfvtlsfs2tmumonu1oetnif3iyd a2umnvont0 etrif iodlaDr n sl()srur(m oodole  fvi tfaDur(rpot0oexn fciltlm2emnmo (4 etrxo3todlaDelnei;(0t2xr(r io1omee nctl( artaum ot1opxomi3ils aDum( p;t)areoio3io1lmDrln slt0 exm(o oudamtnmfvilt  Draxroou0alxnii3tad m eau sn(4alxrif3oadoptrlueols t2toim3iy1apt micils)a2ta(mp;t0opt if3tasla2em(vo (0aeenxf3oy1oat lneo (0 2xr(rpou1lpt lfvtas) rumxmpot4oeenif3iltfmDul(vsn(0tlenirctatlmDrlnes;(  exoxmpiydal elncta()aDtrx o;t1ope ioeiyslmDumuvon(4 lxrir oodfa rauvils0s2trxo3iu1am   icsa( artrump;o0openio3tldla ra( onu)arxrxf3iotlptelueol()s2ur(o oo4lmen nei t)srraxrpoo1apt  f3tld a2ea(vsnu)trenxrctydopDe ivo s  rto(m3no4lp   fei t  rumx  no1tle mieild a2ul( sn(4areoxo oadlm r neo;t0 rxrir oodlmen fvilt aDtr( pou0apx  ietas mDemu p (4arxoio io1fat livilt seumxmpoydop n fctl(f rrmxmpnu4tpeomfetldlm2eauvonu0texrxo oa1omDe n s;s s2trxo io4ll  licsat) 2ra( ooo0tetnmfetat a el(mp u4 rxoxr3todoatrluesl(0 2toxo3io1llenlictltfa2tr(  oo4teeomoetatlm2uauvo t)tlxnio tydfm  lu s s0sexmim nodoleelnci t srumxroou1oltn oeils mDuau sn() ltnmocoy1opDeauvil( setm(m iy4opeelicslt  Dtmxmp;t0olx micilt aDemu snt)artnif iotlatr uei;(0srur(m3oydoleemfcia( s2tmxrpou0oeenifeiyt s2ulump u0 rxoio3ia1omteaieol(0s2toxo oy1lp  lnetas  rurum no0olx moeiad a2rl( p;()teermr oytla rlivo;t sexoxo no1lp nlncsls) rtmurpot4aeeoifciysfa rlumont)trtoxo3totoatranei;t0 etmxr oo1lptemncias)srrrur no1opxomi3ilt m uluvsnt0 exoif3oo1opDr i i;t)t2xr(mpoy4lpen ivils)a2ta(ronu4aleo ictldlsDea(ms t0 etnircoo1fatr nes ( t2um(rpoy4om e nvt () Dtru  no1oeeniociadfsDul(mp u)tltnmo oydom  auei;(0setmio3iy4om nmictlt  2um(mpnt0oexnmfciaslm2uaumo;t4 rxrxocoa1fptrluei;t0setr(r3nu1optemnet s) 2trxm ot1opt  i3ilsfs rl( p;(0texomrcoa1lmte n o;(0t2xoir iy4alenmiesl()a2umx onu1alxn i3iat aDum(mpn(4areomf oytfmD lnes ( seumxm3no4am emivs t) Dururono4olenifeiasfm uau o;t4arenmrcia1oaDr iesl( trtrxopoudamt mnvil(fs2ur(mont0altnmo3iasls2rmnvo;u)altnmo3tadlatranvo;t)s2tmxm3io4lp n nvsa(  Drr(ro;o4optomiciatla2ean onu0tetnmf3ootlm rli s;( sexmxm iy1ameeliei t)aDtr(rp;o1oexoiicils mDean on(0trtnmrciodlmt auei;s)t2tr(o3nydal   fet () rrrur ot4opx mi3iatfm2el(mo;u0 lxrir3iodlpDraivo (0srum(r3iy1op nlncil()srtaxronu1aleomi3ias m ra( snu4trtomr3tatlaDe n i;t s2tmir3io4lp nlfvtl(fsrrrxmp;u0apx mfeildfaDra(vpnt4 rermrcoydlmDrli o s)sexmir3iy4openmncslt)arrrxmpou4teeoio3tas s emnvsnu4 rtomocto1lat aieo ()teuoxr oy1amtnlnesltfsDua( oou0tlxniocildfaDem(vpnt4tetoxfcio1faDeau ilt) 2ur(rpny4lp nmfvs t) rur( pnt4opto o3iyt mDumums;u0texoir tatlmDrli ilt) rxo(rpoydol e fes tfs2raxm ou1tpt  feilsfmDelu s (0 etnxo oo1fmte uvi;s)setmim iudlpee nvs sf Drrxronu4oee  ieiytfs2umums;t) leoif3ta1fpDeai s;t0 rxmxrpno1optn feslt)s2um(ront0tleo oetldfsDumuvpnt4trxnmo3oa1lpDrlnei;t  rxr(r nu1ll nlnetatfarta(  nu0apeoifcildls ranvpn() ltoifctydlp  lues;(0s2xoxo3iu1altemfvs ( aDra(rpnt4apeo fetadfs um(mpnt4tlxrir tatomDe neils0s2tmio3oy4omee neta()a2ur(mo;o0ape  o3tld m eanmpn()tltnmo todlm   ivi s)s2xo(m3iy4ap n ncil(fs2ur(root4opto octlsfm eau snu4 leoxfctotfa rlivo;( texm(opnu1om nmfvtlt a2tmxront4ale  feiltlmDum(vp u0 ltoir oa1lmD ln i ()seumiopio4alt lieslt)aDumx  ot0ape mocilslaDrl(vp;t4aeerir iytom  ln olt0 eurxo3oo4lme  ict ( arumu  ou4tpxoifetldfa2ulnmp;t4 ltnxf3ta1lp r ueilt)t2umir nu1ol   feil(  Durx pno4ole  i3tytlsDrlnvs;u) exrxf iotopte iei (0s2umir3oy1alt lnviat sDrm(mpot4oleniociys s el(mpnu)tetrif3ta1laD  nvi t)s2to(r3iu1lmtnmfcs t)srtr(mo;t0apxn octadlm rmuvo;() etrifciadopD livils  2xr(o3ou1al nmfvi t) 2ur(m nt4tex mietydlm2ranvo;(0tlxrmf totfptelnvs;s  etoirpnu4lltnlnetls sruru pnu0tptn f3tlsfaDumums (0aexnir3iodfat li olt0 euo(opio4lm  lnci t) rtru onu0oetniictytfa emnmp t4arxrxocia1latrluvol() eurim3no4olen fvtatfarraxmpoo0tetn ictls mDeauvo (4teerio3iotoate n o t  etr(m nudoptnlfvtas  2rru  ;u4opxnifciat s2emu p;t0artrmf oa1opDrau i (0s2umirpiudapenmivia(fs2taxmpnu1altn f3tls s uluvp (0alxrxf iatlpDrau o t) eurirpoodlmte ivi () rra(  ;o4oex mi3ilsfa2eln o (4 exrxfcoy1fpte ues s0 etmir3nodlme  feil( aDraxm ou0oeen oeiyt s2um(ms;()arxomr tydlatrli s;t0 2um(m3oodaltemnctl(fsDtrxr oo1oexomf3iatls2umnmp;u0texnmf ootfmt livs s  ruo(opiy1omt mncilsf Duax o;u1teen fetatlaDelumo;() rxrio3tatla r nvo;(0 eumxm3iy4ol emfcsls  2tmum ;t0apxomo3iad mDem( pnu0 lenxfciatla   ivils)srxr(opnu4omtnlneil(f Drr(ro;u1tpenmocils s2eau o t)alenircoa1om  lnvs;( s2xmimpny4lpe  nesat) 2tr(r ;u0tleoifetatfs2emuvpnu0 eermfciotlm elnvs s) rtr(m io4ol   nesatf 2tmx p;u1aee mociltlm2el(vp;u4aeenifcoytlaD ai slt0 rurim3nodlm   fvi s  rta(rpot4texoifcils m ranvs ()trxnxo iy1fptr u olt) exoxm iy4ap n feilt) Dta(m nu0tlx  iciltfaDemumont0trenifcoatfpt  nei;(  2xrir oo4ale mncslt) rra(r oo1tpe  fetldfs eauvo u0texrif3tydfp e nvs;(0 exoir iy1ol  miesat  rum( pnt0olxomi3tydlm ran snt)texoircoytlmt anes;()trxrxo iudap n feil()aDur(moot1tlxnmf3iydls2emuvp;u4tlenmo iadoaD aieo;()s2xr(m ny1alt lies tf 2umumo;t0aleoio3iad s ean p;(0tleoxrcoadfaD luvo;() rxmio iydom nmfeils arua(r oo0aetniiciydlaDem( s u0artoiocto1lmDe u s t t2xrir3iy4ll  mics ( s2uax  oo1tee ifcild a2umnmsnu0alxrmo ty1laDeli i;s srto(m iudlm  mnvsas) Dtaxroou4oleniieiat s2ran onu)alerif3oatlp rlnvol()trxm(rpoy1optnmnvt s aDraxm no1aex if3iat mDuaumo (0trtomfcoy1lateliesls)t2ur(r ny1lle mncs s aDtm(r ;u0oex miciys a rmuvo () leoiocoadfat liei;t0 2toxr iu4lleelfei tf Dururpoo4oleoioetatfm um(mo ()aeeomf oytomt lues;(0 etr(rpio1al emnes ( sDta(m nu0opx  ieiasfsDel( o;u4arxoio3ty1fm r i olt s2tr(m oodap n fvt t)a2tmx  ;t1tpxnii3iyd s em(vp;()treomf iadfp   n o s t2xrio nudolt mivs tfarur( p;t0ale mfeiys s2um(vo (4teeoxfcoydoa  lueslt0 2to(o3iudamenlnet tfartaumont1open octad m uanvsnu)tleomo3iotfat  ivilt s2umxr3iy1omeemictatf 2umxm ;t4oexnmfetls s2ua(vo u0tetoio iy1op r ieo;() etmimpny4lmtn ncils)a2urxmp;u4tpenmi3ias s ra( snu4 ltoifciytlpDrlnvi t)trtrim3io1ll e nctl(fa2rrump;t1alx ioetld mDea( o;t)arxnmf oatfmDrlu i;s0t2toxrpno1lmeelfci sfaDuru pot0opx mieiyt s2rm(vo;u0alenmo oa1lp rlivilt  exmirpoo4ap  lfcsat)s2ra(mono0oeeo ocils mDum(mo (4arxoxf totfaD au s ( truriopnu1alt lfvsltfaDtm( p;u4tpto oeils a ea(vs;() lerxo3ta1oaD au i;(0t2umim oy4op   fvslt a2trx  nt0apx  i3iadlsDrm( p;u)altoxf3ia1fat livo ( sexr(opiodom  mnci t  rrau ooo4tlxniictydfaDel(ms;u)tleoifcoatlaDraieo ()s2xoiopno1op   nvs s)sDur(rpoo1texn feiadfa rl( onu)teeomo3to1lpte nvolt)srto(m3nu4llte neiat) ruax oot4alt  oetls s2elu pnu) lxnxf3iadoate iei (0 etmxopiu1op nlivils)arrr( o;o0oex io3iysfa emu ont4artoxoctatoa r iesl()trumim iodlpe lfetls  2urxrp;u0tex ifetldfs ul( s (0tetrir tadopt  nvo (0teur(o3ou4opt mnetatfarrmum no1tpe mo3iys m uanvo u4alermrcoatfm eauvs () 2tm(opnudomen icilt s2rmxr ou4tlx  i3ias m ua(vs;(0trxoir oadfp elu o (  rtmxm io4apenmfes t  rurx  ot4olx  i3tldlaDelumsnu0 rxnxr3oy1laD  u olt0 rum(o oydapt  ivi (farrm( o;o4alx ii3iaslaDrm(mpnt4 rtnir3tatlateauvs s0seum(r ou4olenmfvt s a2rrxr no4oetniieiad a uln snu)teenmocia1fptrluvslt)srumio3io1lmen fei t  rrmurp;u1ole  ocildfa2rm( snt4teermr3iy1optrlu o;(0tetr(o iydll   nctas) rrm( poo0oetnmf3iytfa ulums;t)altrif3oodlm  li i;s  eurxr3iydoleemictl( a2um(ro;u0tlxnmf3ias s2el(mo;t4arerxo3ta1fat  n sls sexrio3no4am  lnet t)sDumxm nu1olxnmfciad mDuauvs u0 eeomfcio1fa  lnvo;t0srxo(m oo1amtelnci t a2tr(ronu1oexnifeildlm rl(ms;()arerxo3iydoptr i s s seumxr3ny4llee net ()aDua(mp;t1opxnmf3tysfm2rmu o;t) eeoxrcia1fmteaiesl()texrim3nu1lp   ncias arua( o;t1aptnmi3tyslm ean s;t0 etnxr3iotfmt aivsl(0 2ur(mpoudlmt miesatfartmxro;u4tpxnmoeiaslmDuan s u4treomr oatlptran s;s trtoxm oy4lm  lfci tfartmx pou0opxomo3ilsfsDrln s u4aexrmf oy1lpD anvilt0trxo(o3iodolen ietlt s2trxro;u4aeenmi3iasfsDea( snu0tetnmo3oa1lm r nei t0trtmxo3iy4am  licias sDtr(rpoo4ale ii3ilt a2ul(mo;t4aetnmf3tadfpDe uvols0texoxrpoudlpe  nvt ()sDtrump;u4olx  ietldlm2ea(mpnu0trenxo iy1op eai s;(0t2umir oydal e ieil( sDtrurp;t4oet ifctldfm emnvp t0 ltoircoydlp raiei ()trum(mpnu4ll   fcsl(fa2uaump;o0opx moeiatfs em(vo (4 leoxr oy1oa rauei s)teurxmpnudoleelfctls  2urumpnt1oetomictldlm rmuvo (0arxomo tatopte uvs t srto(o oy4altelicsl()aDtaurpnu1apx  o3iyt s2elnms u4teenxfcoodlmt aivs;s0trumxr iu4ome mnes tfa2urxmpnu1alx  o3iatla2rmn pnu0alerioctatop  livi ()srtrxr oydlme mivias a2raxm nu1alx  oeiyd mDrmnvpnu0 lxoxo oytfa r u olt0srtrirpou4ll e neia( aDrr(roou0alt ioctld aDuanvon(0 etnio todfm  au i s teuo(opou4lmt lfct tfsrrmx pou4opt ii3iyslsDemnms ()altomf3tytoate n i;(0srtoio no1opeemnctls sDtaxronu0tleniictasla rlnvp;u)tlxnmfctotfa  li o ( seuo(o ny4lp nmneil(f 2urum ;t1aee ifciytfs rlnvpn(0 etnxfciadomDelivs t texo(r3oodlmtnmneta() rtaum ou0oeen f3ildfsDelnvp;t0 lermo3tytop  luvo;(0t2xoir3oo4llee fet s) rur(rpnt4apx ii3tat sDemump;t4trxriocoadomDr n il(0texr(o oodom elfcia(f 2um(rpou0aee if3ilsfm eanmp;t4 exnircto1oate iesls0 2umio3oy4alenlnesl() 2tmur ou0olto octysfaDeau s;t4tetnmocoy1lp raivs;( s2tr(rpiu4ole  nvilt) Drrumpoo4aptn i3tat mDeau o;u4artnxf3iy1latraues;s)s2um(rpoy1lptemici s srta(mpoo4aleo ietadlm2emnvo (4arermo totoa   ieo;t t2xoirpoy4ll  lnvt sf rtrxr nu0tle  iciltls rlnmo;t)tetomr oydlaDelueo;s) exoxrpoodll e feiat)srtmxrpoo0olenio3tytfmDrln p u0altomo iodfp r n sl() 2tr(m3iu1ameelies ()aDta(mpot0tee  o3tyslsDem(vsnu4 etoxo3iotlmDeau s s0srxmio3oo4lleemnvilt)a2tru p;o0aexo fctlsla uanmsnt)alxnxf ootfpDeanvi s srxrxm ny1aleemnci s aDrm(mpno0apxn iciaslmDumuvo u)arerxr3ta1fptelnes t trtmim3io1ope  fvsa(faDua(mpno1ope iieiydfa ul(vp t0teeoif3oo1lpDeanes ( texr(r ny1oltnmieiltf 2rmx pno4tpeoifciasla2rauvo t0arermf3oatom eanvsls sexo(r3nodllenlnvsltfsDrm(  ;o1tltnio3iydfm ra(mo;t0 eeomfctatfmte ivils srxoxr3no4al  mivt t)srtrx  ;t0tpxnmo3tat s rmu pnt0altnxf iotfpt li i;(0sexmxo nu1lle lfci sfaDumurp;u4tpxniieiatfm2rlnvo t4arenirctatfmD lneilt0srtr(o3ou4al  lfvsasfa2tax  ot4oee  oetys mDuau pnu)altrio3oa1fa rlu s t) 2xoir ny1lpt  fvs (f rrr( o;o1tpe ii3ildfm rmumsnu0teerxf3iy1laDrliei ( seuo(o3nydom  mfctas) rraum ;o1optnifetas mDrmu s t)aeeoiociatlmD  uvi t) rurio ny4olen neils) Dtr( pnt0oexo i3iatlmDulums (4trxrio oatlaD livo s)t2ur(mpiy4am n nvs tfarta(r ;u4tee  fctltfa2ra(vo t4areoiociadlm  an o;s) rxm(opoy4lpeelnvt s)arrr(mono0opt mo3iltls uanvo;u0aeeoxociy1fp rli o;t  2umir3oodlpen icil(fa2tru o;t1apx  f3tlslsDrau o;u)altoirctatla raies;s texo(o nudamte fvtas s2tauro;u1apt  f3iaslaDel(vpnu4altrmr3ta1laDeaivo;s0trxr(mpnydalte iciat a2urx o;u0apto oetatla uanvsnu4 eenifciatfmDr nvi t0tetoirpny1optn ivt t  2trxm ot4oexoiocias a2emn o t0arerircty1fa  auvo s)setmxr oy1ol n fcilsf 2ra(rono0alxnifcildfa2rau o (4teeoxr3iotomt  ivolt  2to(r iu4olt mnvil()arum(m ot0tlxoio3tatfa rmuvp;t) ltrxf3tatlmtrlies ()t2xoio iy1al e ivsas sDtru pnt0oexn feildfmDeluvp ()teeomrcta1fpDeaneo ()s2tmim nu1optemictl()a2urx oou1alx iieildls2ulums;t0trxrif3iy1fpteaieo (  exo(rpiy1aptnmict s  2trxroou1tlt ii3iltfm2elnvp;u0 etrmfcia1fmtrlu i;t) 2urxr3io1lpt liei t s2rmu  ou1aeto ietlslm2rauvsn() exnmocta1laD luvilt) 2uo(o iy4llenlivi sf rrruro;t4olt io3ildls2rlnmpn(4texrio3tadfpt  nvi;() 2xrio iydlmte iet sfs2rax  ;o0opeo o3iat s ranms ()texrmo to1om rlivs ( srurxo nu1ope mfesl(fs2um( ooo1aexnmfeiltls em(mo u4aetnxf3oodlpteai ols)t2xmxmpio1lptnmfetatf rtaump;t4alxoiictldlsDumums;u) rerio tytfa   n i;()tetrxmpnydamtn ietl()aDuax p;t1aptnii3tad mDranmo;u)teenxrctytfpteaueilt)seuo(opoodomee nviat srtaumono4opxomi3iys aDuanvpn(0tleriociydfateaueo (0trtmir oy1amee nct () Drr(rooo1alen ieilt sDrmn s;t0 etrmf3oatop e uvi;(0s2tr(o iudape  nesltfsrraurp;o0opto f3iysfm em(vp (4 lxoxrcoy1lpDean s s)s2tm(o3nodll n netls a2tmx pnu1aetn f3iasls ranmo (0teeoxf todfa r iesl()setm(o ou4lptemncslt)sDtax pot1tpto ieilt a2ea(vo (0arxrxfctatlat au s;( trumxo io1amt mfci s s2uaxmp;o1opxnmieias s umumo t0tlenxf3oadfaDrlnvs (0texmxr ny1ap nlicsasfsDua(monu1opxn feiatla rl(mp (0 renir3oytoptrlivilt t2tmim3iodlltnmietas)arumum ot0tlx  feiyd a rluvs (0aexrmo tatfatrlnvs;s0s2xrir3iodlp   ieil()aDtr( pot4teenmiciyd sDel( p;t4 renxr ia1oa ran o ( texoiopio1am   neia(fsrrrumpnt0oeeniociltfsDuauvonu0alxnxf iodfaDeli i;t s2tmiopiu1lmenlici t)a2tmu pot4olt ifctlsfa2uanvpnu0 rxnmr totopDelivo;s0 etoxm oy1op nmivi t aDrrxrpou4olt ioeiyt s umn onu) leoif3iy1fm  lneol() 2trxr iy1lmtnmfvi tfa2uau oou1tpxo ociasls emnmsn(4 etoir tadfpD au s;() rxmir iydol   nctls  rurxmo;u0olxnmieiasfmDulnmo;u4artrif oodoateanvols  etm(o ny4altnlictas)aDtrxmpno0aexo o3iyt sDeaumsnt0aexrxf3iatlptr u i;t0s2to(o iudope mivils) 2umumo;u0oltomf3ias s rlnvs;(0 lxnio oa1lm rln i (0 2um(o3oy1amen nvi t a2tauroou0aee io3iytfm2um( o (4arxoxrctotlptrli i;t0 2um(m oy4oltn feia()arumx  ot4apxomoctydfs uanvo;()aeeriocoodoatelnvs;(0sexrir3no1llenlfcia(  rra(m nt4tee iieilsfmDrl(vp ()tlxnir3oy1omDe nei t0 2uoimpio4openmiesatfs2tr( o;o1tpx mfeias sDean s (0 ltomo3to1lpDelivo;s)trtoiopny4ole lies t aruaxr ou1apxniictydfaDrau p;u0alxoio ta1oaDelneo;t s2ur(opiy1amtnlicsls) 2umu ont0apeoiietad m ea(ms (4 exomrcoodoa rau i t)s2urxr3io1ol nmfvsat) Dur(rpou1tptn ictys mDemnmonu4 leoxo3oatfptr nvs;(0trxoxmpiodoptn nvi (fa2rrumpot0apenifciys m eanvsn() etoxociytlm elneo s)t2tmirpiodamt lncslsf Drm(m no4aee  i3tldfmDua( o;u) etoir ootfpt au sls) rumim oydomtn nei t s2trxmpoo4alxo i3ias a2rluvpnu4trtrmo3iotlat ai i;t0trumir3io4op n nesls  rtrxr nu4texo o3iyd s eanvp;u0aetnif ta1fa   i ils0s2xo(opou4amtelivtl( a2tax pno1oexnmictytfmDrmn o t0trtnmr3totomDe u s;s trtoiopiu4ll   fvia( aDrr(  ou0tleo ocias m2el( pn()alermf3iotfm e neo;(0 eur(m nu4lme lfesa(f rrrxmoou4tpenmi3tlt a elu p t4 leoxr3totfp r ivi t) 2xmir oo4ol nmfetasf Dtaum no4alen i3iaslm2rl(vp;u4tltnxocoytfp rln il()texoio3iu1op nmnesat  rtaurpnt1tlt  f3tys m eauvsnu0trtrmf3to1optrlneilt)t2um(m3ou4amtnmneilsfaDrmx  ;o1olxnmietyd aDumums;u4altoxrcoa1fpD  nei (0trxmir iydopt mnvsat  Dururo;u1teen ociasls2el(mp (0 etrmo iodoat  ieilt)t2tm(o3oy4ap nmfvia(farurx ont0aexnmfciltfm uaumon(4 exrif iytfp rlnvs;() 2trxmpiudlpe miviatfsDua(mp;t1tlxoif3iyt sDeluvs;t)aexrmf totfpDe n s;s)seurir nodlpe  fvils sDrr(ront4oetnmociadfa2umnmo u4trxrxoctodfm rlivsl( sexmim ou1lmt mfvtasf rrrxrpnt0apxn oeiltfm rm( o;u4 lxrir ia1fpD luvs;(0trxmir ou4al nlncta(fsrtr(rpoo0apx ifetadfsDrluvsn(0tlenxr3tydfpD  u o ()seurir no4ap nmfcilt)s2urur ;u4apeomiciadfs2rlu sn(4 etnmr iotlm  ln s (0tetmxr oy1oltn nvsatfs2rm(m nu1aptoioetadlmDranmsnu0aexomr3iydfm   iei t)t2xmxr3no1amtnmncil()srrrumo;u1teeo fciasfa2eln p (0treoxo tydlm  lueo t0t2um(r3ny1lpteliesls  ruaxmono1oeenii3iyd mDemump t) lenmocio1op  livo s0sexmxo3iy1al  mietls)sDtaxr ;o1tle mieiydlm el( p t4artnxfctatfm  lu sls0srxm(o3oo4lpe mnesas)sDur( o;u4tee iociatlm eauvp;u4 eermr3ootom elues (0 ruoir3iu4optelietl(  Dumx  ou1alxomoctltfm ea(vs (4 lermfciatopDrln ils)t2trio nydomt lfeia()aDur(mpou1tlt  f3tlt a ulnvsnu0teerif oodla  aneo t0s2trxo3iy1op n ies (f Dtr(  no1teeomieiydfs ulu o u4alxrir todom  lnvo s0 exmxm ny4amee fvs sfsDrmxmpot0tltoioetatfs2eln s (0alenir oodopDrlivilt0s2ur(m3oy4lmtnmfcils) 2ta(r ;t1aexomfctydlm2rmnvs;t4 exrxrctotoptelu ols seuoimpou1op  lfviasfsrtmurpoo4tee iiciytla eauvs (0 etrxrctytopDrluvs t  2xr(mpno1op nmiei () 2taumont1aeeo iciyt mDran o t0aetrio3totlpD  i ilt0t2umxm3iudap eliei t)s2ta(r oo1oetn ictytfm eln o (4trtoxr3ta1fmtrlnvo;t trumio ny4ll elneta(fartru o;u1ope  o3iatls2rau s;(0trenxo3iy1oateli o;t texr(o3io1al emfes (f 2ra( ont0altn fetldfm eln p;u0 rxoifcto1lp rlu o;s)t2um(r3oudolen feta( aDumu p;t4olto ocias sDrm( snt4 rtrio3iydlpDe nvo s) 2uoxmpiydlme mneiat a2rr(  nu1alen o3iat s umn s u4arxnif oo1omD lnvils0s2tmxopiodll emfvt s arrr(rono0texn oeiat sDeauvp;t4arxomocoa1fm e n slt0 etr(mpiudlleelivtl()arumur ot4tpxnmf3iltlm2em(mont4arxnxr3ia1lpt anes;t0 2umxm oo4opt lfvt (faDtmxmont4tpx micildlsDrm( o;t0aeeoxociatlmDe neilt s2um(m3no1open ietat srtm(mp;o0alxniicildfaDulumont)arxrmr3iotfmtr ueolt)trurxr iy1altemfvt tf Drmum ot0tex mi3ils m rlnmont) rxoio tatla rli il( seuo(rpiy4ol   fcslsfsrurxrpnt0olt iociaslm2eanms;t) etoio oodlpDe u i t0 eurir iydlpt mfcs s  rraxmo;u0tpx  f3iadfm2rl(vo;u4 reoif ootfaD  nvi;s)s2trxm nodam e nesa(fs2uau  nu4aee if3tydlm2umuvonu0artrxr ootlaDraueilt0 rxm(rpiy1amte fvia(fsDtrxmpot4tlxoifeiysfs ul(vp t) rerxociadfm elu ilt0teumir no1amtn ieslt arra(  ;u4texnmiciydls eau o;(4trenxr3ootfatrlivs s  rtrxm io1apee ivtl() 2rax oot0olx mocils m eluvo (0aeeomf tatfpt aieols)trtmxo nodlp  mfesas)arrmxrpnu1tptomociadlaDel(vo;()tltoxf3ootlpDelu s;( srumxr3oudlm n nvi (f rtrxro;o0aexomf3tat s2em(vo (0tleomfcty1fa r nes t sexm(rpoodlltelfvsa( sDta(r ;u0oexomfctadlm2emn o;u4treomr3oadomt  uesls0seuoxr iodam nliei tf 2ta(moou0altnmoeildfmDumnvs u)trerxocoydomDe ivi t)s2xo(mpou4lmt miesatfa2rrumo;t0tet mf3iatfm uanmp (0tlxniocoa1om eai sls truo(opoo1openmict () Drmx ono0olxn ietydlmDeanmpnt4alxnmf oydlpDrliei;t0tetrimpio1op n iesas a2um(r ;u1tltn f3ilslmDua(mp;(0arxnxfcia1om eli o;s)t2trio3iydopeelncsat aDrrx o;o0oet  ociadla em(vsnu) lenmr iy1fmDe ueo;( srto(r3iu1llt mncslt)aDrrumoot0tpxnifctldfmDem(msnt4 exrxo3oydlateliei ()t2uoirpoy4om  lfvils)arumuroot1ape ioeiyt m ulnmsn()aexniocoydoa rlu o t srxmxopiu1om  lfei s) Dua(r no1opxnmfeild mDrluvo;t) reomociydlp raueols)sexoxm oydlpenmneiltfsrtm(rpoo4tptnmieiadfa2em(vs;()aeenxo3oadfpt anei;( trxo(r3nu1amt lfcslt  2um(  ;u0tltn ociydfa umnmon() rtomocoytla   ueo s)t2xmxm3no4lpen ict (faDta(monu4alx mf3iasfs2ua(vp ()areoifcoadop r nvs;()trum(r nu4omtn nvtas)artm( poo1tptoifciytfmDean p;t4trtnxr oatom rln o s t2umxr3iu1om nlnes tfa2ta(rpnu1oexomi3iysla2eaumo;(0 rxnmo iydfmD  n s t) ruoxopny1omt mfvt s artrurp;u1alxomfciytla elumo ()areoxf3tydfaDrlnvo s)trur(r3nudllt mncsltf 2ururo;o0apt iictasfs ua(mp;()arxrmocta1omDrli i;s0s2xoxo3no4alte fcsa()sDrax pnt4teenmi3ias a2rmnmp (0tltrmr oa1lmD  u o t0 exmxo3nodomen nct (f 2trx ont1tptnif3iltls emnvon(4 ltoxf ootfmteaivsls)texr(r nodop   fctls a2rr(mo;u0alxn fetat sDemu p (0altnxr oa1opt  u olt)sexoxr3oo1omee nei ()a2umur ot0olenmieiytlsDuln p t4 renxfcia1fatrlneo s) etm(m3iu4lm  lfct t  2trxr nt1aleniociatla em(vo;u4aexnio tytlaDraivo t teumxo3oudomeemfeslt  2ur(mpnt4tex moctatfs rl( o () leomo iydfaDelu o;() rur(r3oy1olen ivs t) rrr( pno0tpeo ietls s2um(ms (4teenxfcoatfp ean o;( s2xoirpnu4amt  fvi ()sDtmx o;t1oexnif3ilsls umnms u0alxrio3oadlpD anes;() 2tmim3nu4lltn neilt)s2rr( ono1tetoiiciad aDum(ms u4 rerxrcoo1fa raies;s0t2xr(mpnudlleelncta() 2ur(ront0tlen ieiyt s rlumo;(0tetomf3iy1lmtr nei s)srurxopoy4apen ivs sfsDum(  ou0tlxoifeiys s uauvo t)arxnmrciytom elnvs;s)texoio3ny1altemict s) 2uau pno4altomfetad sDeanvp;t0 rermf totfaD anes;t trxr(r iudalee fctls) rrrurpnu4aee mi3tls aDrlumonu4alxniociodla  auesl( texmim3oy4oleelnvsatfaDtaxr ;o4tetoioetat m uaumpnt)tltnxrcio1fp eaieo;( t2uo(r3ou4apenmfvi () Duauro;t1aeeoiietys mDea( s u4arxriocoo1fatelivi;( t2ur(o3ou1omtelfvsat  Dtaxrpno1aee  oeiltla umu p;u0aeerxr3io1latean i;() rumiopoo4lp e nesa()aDrax pou0olx io3ils a rlu p;u0trtoifctotlaDr nesls0sexmiopou4aleemfesls) 2uru p;u1opto f3iydfmDrl(vs;t4 leomr3iytomte i i;t)tetr(o oy1alee fetl(  rrmxrooo1teenifetldlaDrauvp;u4treriocoytoat aies;t seuo(r3ny4altn fct t)sDrmur ou4oltoif3iltfaDrm(mont0areoiociydfateaieo ( seto(rpoy1openlnvi ( aDtrxrpnu4ape if3tldfmDuluvpnt0aeenmrciadlpDrlueilt0sruoxo3iy4lpe  icsa(fa2rm(mo;u1tex mietyslm2uln onu0teerxr oodfat ai s s)s2umim3io4omtn nvi s)srtr( o;o1alxniiciad s rlu pnu0arenif3iotlmte nei;() eumirpnu1oltnmiet sfsruaxmpno1open oeiydfs2umuvp;() reoif ta1fp rauvs;s tetm(mpiodaptemnvtl()srtaxm nt1apenmf3iad s2eln p;u4 etnio3ootlat  n s () 2ur(o iu4lltnlnvs t a2ta(mp;o0altomieildfaDumump;()tltrxo3ia1oat  i i t) 2ur(o3nu4opeemnvta( sDtruroou4aptomoeiltfm2rl( o t4tlxoxo totla  aivi;s trxrio3iu1lmt  fct s)a2tmx  nu4oleo oeilt a2ulnmp (0tltrxo oatlptelnvsls)s2xmim oodole  feiasfsDua(mont0oltoiieils s2eanmpnu4alerxrcty1lpt liei (0setrxr3oudope mfvsltfsruax pou0opxn ieiyt s eanvpnt4teermf3iotfmteaneols) eto(rpoydamt mietls) Dtmx o;u1aexo octldfs rmuvp (0 rxrxocto1op eau ols0trxoio nu1ap eliet t  rumx o;t0oex moeias m2eanvp;t4 ltrxo tatlaDelneo;( srur(m iu1ll elnes s) 2uaumpot4aleomoeiatfsDra(mpn(0altnxr iatom  auvo t)seur(r3nu1am nmfes (fsDrmxm oo0oetn iciltlaDean p t)trtrmo3oa1la   i o (0 2xmxo io4ap n ies ()a2rr(root0apeo i3ild s uanmsn()aexrmf3to1fptr neo (  2trim3oy4ameelict (fa2tmum nt1aet  fctytla2uanvo u)texnirctotop rai olt0texmim3ny1ome mfvil() 2umurpoo0tpe mi3tlslmDrln p;u4 etomrcootlmDrlneilt0trtrxr3oy1alenmietlsfarta(ro;t1opxoiiciyt a uau pn(0 etoio tatomte neilt t2xrio no1oltemfesas) Drmx  ;u1tlto f3iadla2ra(mon(4aexnmf iy1faDeauvs;( srtoir io4lltnlivias)sDtrump;t4tet  feiytfa2elnmo ()tltoif ty1lp elnvi t)seumxr3oo1lle livsa(  2ua(mooo4alto fciyt sDemnmo;u) rtomo3io1oate n s t0seuoxm oo4amte fvs (f rtrum oo4tpen ocilt mDeanvp;(0 ltomo3iadfmD lu o;t0tetoxo oydapt lnvi tf rumu  ot0tpx micilsla emu p;t4aetnxf to1fptelneo (0 2umxr iu4lleemies tf rurxmono1opeo iciltlm2ea(mo () rtoirctodomtrlneo;( s2uoio ny4lme  ncia(  2um(m oo0tpto oeiydlmDeau p (0 rermf3oadfpte uvsls0 euoxm oudomeelnci s)arua( ont0alt  feilslaDumumo t4treoxf oa1oa eauvols) 2tm(r io4ole  iesltf 2ta(m ;t1tlxoii3tlsfm2rmumpnu)arxrxf iy1fpt aivi;t0seto(opio1opte fvi ()arrm(ro;t1apto feiltla2ul( on()arxomf3iatfmD ln o ()t2xo(opoy4lmtnmfctatfarrmur nt0tltnmietyt aDeau sn(0tltrxo3iadopD  uvs;s)sexrxo ny1ole  ies s) rururpou4oltoiiciatfm rlu sn(4arenxr iodlaDeau sl(0trxrim iy4lmte ivsas srtrumpnt1apx mo3iysfm2uanmpn(4tlxrxo iadoptrluvs;t0 euo(r3oy1aptnmfeil(fa2um(mpoo1aee mf3ias sDem( s;t0alenxrcta1lmD auvs s0trum(o iu1amen fci (fsrraxr oo1oee ifctlslm elnmsn()texrircoadfp  liesl(0sexrir iu4ole miciatfaruau pno0apto ociatfs uanvp u4 etoxo3oa1oaD ai o;s)t2xrxm3ou1lmenmfvi ()a2tmu  oo1olxnmieiltls rmn o;u4aetnxo todopD li i ()t2xoxo3ny1lmtnlnvi sf Dumu pou0olx  i3tatfm2emump t0teenmf3iatla rlies;t seurxm3io4lptnlfes (fsDum( ono4opxnmo3tyd a el(msnt0tlxrxf iotoaDr ivils trumimpny1alt  ivsls) 2tmumoot0tlxniocias s2uan s u4 eeriociodomteauvs (0s2xmxmpiu4lm nliet t aDra(m ;o0alt iietldfm rm(von(0trxrmo oatfmtraues s0 ruoxm3oudlpenmfcil()aDuaxmoou1aetomietad s umn o t)alxrmocta1opDrai s;s)trtrio ny1lle  fei s  Drru pnt4opx  fciat m2elumo ()alermf tydlptrlnei t0srto(r3no4opeelfeilt)s2urxmpnu4apxoiicilslmDumuvs u4 etrxo3totomD  u s (0 2urxopiodaltelfetas)srrm(mooo1alx mieiatlsDuluvo;(4 eenir ia1omDr ueo t) exmim nudlltnmfcia( sDumumpou1apen oetys a ranvsn(0 rtrxf totfm eanes t t2umxm iudlm emnet (f 2rrumo;t1aptoif3iyt aDulu snu0tltoiocty1fptelivsls) exmxr3ny4al   neil( sDumumpnu1tpt ioctytfs em(mo;u4teenxf oatfp e nvslt) rtm(opoy4olee ietlsfsrrmxro;o1aetn icils m ean o t4artrir3tatlm ean s;()seuo(m3oydom emnvt t)srtmxmpot4texn iciad s2el(vo;u)aexnxf iodfatranvo;s0 2xrxrpoudole mieia( srum(moot4olto fctldfa ulnmp;t0treomf oatfm   nvil()srxr(mpno1aptnmfvta(faDuau pot0tee io3ils mDumums;t0 lxrxr3oadfpD luvs s0srxrxmpoy4apen ict t aruau ont0aet mieiaslm2ua(vpnu0tlenxfcty1omDeauei ( sruo(m nu1apeelfeslt)srrm(m ot0texnifcilsfm2uauvsn(0trxnxr3oodoat luvo;t setrir3nu1llt  fcils)srrrxrpnt1ape iietlsla2umnvs;u)tltomo3iatfpD aieo;t0trxmir nodom n nct t) rtr(mono0aex miciadlm ranmont0 lenmr oytfm eluvo (0srtoxm io4apte fei (  rua( pnu0ape  feiysfm2emnvs;t4 etnmf3totlaDranvi (0t2xoio io1al nliei ()aDur(mo;t1optnmfetltfmDeln pn(4arerxr3ta1omD  neo ( srxoiopou4lm n ici t)artruronu1alt mo3tad m ulu s u0texomrcoytoat luesls0seumxrpnu1lltn iciat a2raxroot0opto ociytfs emumonu)trerifciatomtrli o t0trxrxr ou1am nlneils) rrr(rono0tltniieiys m2el(von()altrxr iodfaDrlieo;t0srurimpoy1op e feslt s2raumooo1oetomo3iat s ulumo;(0tlxomrcto1lmDrlu i (0 rxoxm iodole lnci s)sDuru p;o4aeeomo3iys m um(ms (4alxoir3oy1latrau s t t2xo(mpoodlmtnmnctls  rrr(  ou4alxnii3iad m2ra(mo;u)trxrirciotlat aivs () ruoir3io1omeemfvsa() Dra( pnt1oee ioeilslsDeauvp;t0texnif oodlateanvsl( sruo(r3iodlmtnmfvsa()sDuaxm no1tpe  fciys mDeanmpnt)texrio3iatoaD  uvol()setmxo iy4opte ivs ()aDuaur ;u0oeto f3iydfmDuanvpnt) rxrioctytop   neo ( setm(rpoudam nliei ( arumxrooo1aexnmieiasfs2rln p (0teeomf io1fa  auei t seumxmpoy1amt lfcia(f rtau  ;o0tltnifciys s ean s t)arxomo ia1lm eln i t  2xmir3iu1ll emfvta() rrrxmoot4alxniiciasfm rlnvo;() ltnxo oytfpteluvs s teuoim ou4apt  netasfsrua(rpnu1openif3iaslm eln pnt4aleoircootoa elnes;s teurxo io1lmeemnctasfaDtrx ono1apxnioetad m2umums;u0tlxnxo oodlm rlueo;s  exoxm oydomeemivilt  Dumxroou4aex  oeildls2uaums (0trtrmr oadlpDelu i t  2ur(r oy1lptnlnvia(fs2rmxront1alxn o3iydlmDrau p t)texnmo3iy1lm rai i;t)t2toirpno1ll  mfct t)sDumx pot1aleo fctyd aDemumsn(0 leoio3totfp r n sl()s2xr(rpiu1lptnlncia(  rur(r oo4tleniietasls2emu ont)altoxr iodlaD an o;(0s2xmir oydlm   iviltfa2ur(  ou4tpxniietltfs rlnmon(0aeermo iytlmtraieols0teuoxrpoodolee nes sf Dum(ro;o4aeen ociaslmDrlnvsn(0 reomf iodfptr ueolt) rxoxmpoodomt  nesatfarumumpnu0oleomoeiat a2ranvs;t)altnmociytfaDeai sl(0t2xrxm iodop  mieiat)srua(ro;o0apx  oeiadfm ea(mont)tlxnmo oydfa eln s t s2xmim io4lm n nvsl( s2um(ro;o0opeo feiadls2rmnvpnu)areoif3oo1omDeln i s seur(r3io1aptelnetas) Dtr( ont1tpx io3iydfa el(vo t4 etrmfciydfa  ai i;(0seur(o3oydapt  nvilsf rtrx oou0apxoiocias a ra( p ()aetrxr iy1laDr nei s texoim3nudlp emivs sf 2taurp;t1texn i3ildla2uauvsn(4 ltnxoctytoaDelu i;()t2ur(r iu4lm e fesl( arta( o;t0tlxn ociys s um(mpn()arxnir io1omt  nvo;()setmio3iudlp emivi () rumx  nt0texniietydlm2el( p u4 eeoxociodomDeli o;t)setoio oy4apte nciat s2trurono4tlxniietadfm um( o (4texrir3oodlpDe n o t) eurxmpny4olte fes sf Dta(mpot1tleomi3iytls2um( p t)arxrxocoo1lptranes t) rxr(rpio1alenlfvia()srta(rpno4opxnmfcilslaDua(vp;(0 eerif3oy1fptean ol(  2umir nydal elnvtas aDrax p;o4apxomo3tldfm2rl(mp u)tetnmr ty1om e i o;s0trtm(mpoo1am nlfct tfs2taxr no1tlxomfctldfm2ua( p;t0tlenmfciydomtrauei;s  rtoio iu4lp  mieiat sDrmx o;u1tetnmf3iatlmDrl( p t0 rxoxr oodlmtr i o t0t2toio3no4al   ict sf Drmx  nt1opx  ietltlm2uanvs;(0 ltoir3oodlate i ols)trxrirpnodlme  icia() Dta( pno4texoifeildla rlnvs;(4tltnio tytfmte ueils trxoiopny4omen nes tfs2rruro;t0aeeo ieiat m2em(mp;t0 renif3oa1oaDeauei;s0srtmxmpou4ap e icslt  Dur(mont4ape if3tltlmDemnmont0 ltrmf iy1fpte i o;t)trtr(rpiy1lm emnvs ( srua(mpou4texoifciytfsDrmuvp (0alxoxf tytla e ues s srtmxo iudom elivi t  Durx  ;u0tpxo o3iltlsDeanvo ()tlxrmocio1fa  aivolt0trxo(mpiy4lltemnetlt aDumxmo;t1oee mi3tysla2emump;t4aexniociytomte ieolt) ruoir3oy1optemfcil( s2ur(rpoo1opxnii3iydfa ea( s u0arxoxf oo1fmDrlnei;() 2tr(m iy4om e fctas)a2rm(rp;t1opxomo3iltfs raumo (0teenxfcio1faD an i;s)setmio3iudop emncta(  rrr( oot4tee ifeiyt a2eln on(4 ltnxfciydfat aies;s)s2uoxopoudalt mfeia(f 2trx  ;o0tlt ioeiysla2ua(vo t)altrircoydop   u sls)sexoxm ny4ap n nvtas sDrmum oo1tetnii3iasfm2eaumon(4 exnxrctodlpt lnvsls0 etmir iy1alen fvtl( aDra(mpnt0opeo icias s uln pnu4altoir3oydoa eai ils0s2trxo3ou1lp e ivtlt srrrx ono0apeo octyd a eanvp;u0aeenmr ty1la   iei;t) 2trio nu4op e nvsa()sDtrxr no0tpeomfciytfsDrmnvs;(0trtoxo ootlpt ai i;s  rtm(o3iydale lnesa()srra(moou4oetoifctad a em(mp;t4texrif3iadlaD auvols s2toxm oy1open ivs t s2ra(roou4alx  oeiadfm um( snt0 etnif3ta1om ean o;t) rxrxm iydom   ncs s)a2tr(rpnt4tpt moctysfa uaumo;t0tlxnxo3iodla   u ilt)trxmir iy4lpe lfvta() rrrumo;u0aetn f3iadlmDul(mo;(0aeenxocta1la elnvs;t0 2uo(rpiy1lmte nesa()s2rrxr ot1tee  ictysfm2rm( s u0 lerirctydlp  li ils0trxo(o ou1lp  lfvt t)sDrmu o;u0tpenifciadls em( pn(4texnxf3tatopte nes s0teuoxmpny1optemici s)a2rrxr oo0aex mictld s umnmo;u0 lxnif oytopt au ols0t2tmxopnudalt  ncsltfaDur(r ;t0opx mfctys s el(vp () lxoxo oa1fmD  i i (0s2xoxopiu1om n neiatfsrrrxrpot1tee mf3tlsfm2eauvs u0tltoir oa1lpDrai o;(  rum(r3no4amenmfei ()a2uaxmpoo0tpen ieiatlmDuan o u4 rxrmf3io1lmte ivi;t0seuo(rpoudal n ncsls) Dum(mpno0tetnio3iltlm emu s u)aeerxo tydoaDelnesl(0seto(opou1optnlivsl(fs2tru ont0tlxomiciytlmDeau s u)artomo3iotlateaivs;()t2xr(r3ny1alen nvsasf Dtr(mpno1olxn oetadfa2ua(mo;t0 ltrmrcoa1op rlnes () rtoxr3no4ol elncil()srtr(rpoo1aetnifciysls eau onu0trenmr oatom raieo ()seum(opio1lpenlneiat) rur(rpnt1aptn i3iytlaDel( onu0 lenir tatfp  anvsl()s2urirpiydomenlictasfartr(  nu1aexniictasfm2um( ont)areoif3tytfm eaiesls) rxmir iydame mivta()srrax pnu4ole  i3iaslmDea(vsnu0 rerxr3ootfptrlivs;(0 2uoxr3ny4ope  fcslt)sDrrurooo0apxnmicias mDemumpnu0alxrio3oo1lm ranei;s0setmimpoy4ap  mnetat) rra( ono4tltnmietydla2ra( on(0 rtnmr oo1fmDraies s sruoxo nu4op  micsls a2trumono4oexn f3iysfs2rmump (4aexrir3ty1lpteauvo s0 eumiopoo1ameemivta(fsDtr( ont4tltoiicilt m2umuvsn(4 etnxr3oo1laD liei t)teuo(o nodll nlicsl(fsDrrxrp;t4tltoif3iys sDumn o u)texnmociy1op   ivo (0 2to(o oy1alenlfvsl()artruro;u4ope  iciyd aDrau o (4 rxnio3oydoa  li i t) exm(rpiodome micslt  rur( oot0ale ifciydfsDrmnvsn(0trtomocty1fa elnvs;s0trxmxrpio1amt mici (farurxmpnt4tleo oeiydla2umnmo;()altoxo oytfpDeaneils0 2xo(rpiu4alenliei sfa2tmx pou0apt  ietatlaDuln p u) lxrxr tatomtr uvo t)s2ur(opnu1olen ivt ( sDrm(r no4tee ifciasfa2ulump u4altoxf3ty1fp rlnvol() exmio oo1lmt lnei t arrmum ;o1alx ioeiaslm emuvs u0trermo tatopt  nvsls0s2xoim iu4apte fvs (faDraur ;o4tlx mietld a2rmuvs t0 lxnmr ootfaD  i o;()tetmir3nu1lpe mnvi (f rrax pnt4opxo fciyd m2rmuvs;t) ltoif tytomD livs;()s2xoxr iudale lfet (fs2ur(r ;u1tetniiciyslm2umu o;u4aexoio iydom rln sl(0texmxopno1op emncsa(faDrmu pou4aetnmfctysla2eluvo () rxoxo ootomDelnvo ()trtmxr3nu1ll nmivilsf rrm( pnt4tltoifciadlmDrl( o;t4tlxnif iydoaD anvols)texr(opoy4optnlfviltfaDrm(r ou4tex mi3ias s uau pn(0 lxnio oa1opt lueol(0 rxrxmpno1lltn net sfsDtax pnu0oexo fcils s ran p ()aeeomf oy1fatelneo s)trxmxo3io4lp n nvia(fs2um(ronu4aetoii3tlslm rauvs;t)tlxrmo oo1lp   uvo;s0seurxm ou1amenlnei s)s2um(rpnu1oexoii3tatfmDemumpnt4trxomrciotlatran olt  2trir3nydll   nci tfsrraxrpnt4optnmociadfsDra(vo;t4aexrif io1oaD  nvi;s)srum(o oudope mfcias  rrr(r ;u1opeoioeildfmDrluvs u4aeenmf iatlateaivol(  rtm(rpnudll emivs sfs2rm(mont1tlt  fetad mDuau s t4aetrircoodopDelieo;t0trtmim nydalt  fcsas)a2tmuro;t4aeeoio3iadfaDrmu snt4trermr todlateau o s0trxo(opoo1lptnmnes t s2umu  ;o0tee ifeiytlmDrmnmo;t0trxrxr3oytfate n i s t2urxr3io1ap emfvtat  rrrumo;o4tpe miciatla2ulnvo (4trtnmfcio1lptrai i s0trxmxr3oo4opt mnvtls) rra(rpnt0tptomf3iys m2ul(ms u4 exrxocoydfpt livol(0tetrxm oo4om   fcsas) 2uau  nt0olx  o3ilsfs rmn pn(0arermo oatoat  u ilt0truoirpou1alen nes sf rra( pnt1open f3iydla rm( sn(0alxnxf iydopD aues;s0setr(o3iudlltnmiei ( aDraurpoo4aptoii3ildfsDrmu p u)artnmo3tydlm eaieo;( t2tr(m oo1olen icia(  rtr( p;u0apx mf3iltla uauvp u4 eerif3oadlpt  nvsls) rum(o3oodame  fci sf 2ra(mo;o0tpe moeiytla umuvs u0tlenir ta1fmt  i o s)texoio ou1amtemfvs ()artrxroot4tlx mf3iytlsDumn p;(4 lxnmf iydlpteau s;s  rxmim iodam nlfvsatfs2urur ot4opxoioeiyt s2ul(vp (0tlenirciytfpDran i t  rtoir3iu1apeelfvsasfarrmurp;o0tetnio3tas m raumont0arxoifciatopD  n slt0 2xo(m3io4apt lnetasfaDrm(root4olxoiociydls umuvpnt4tlxrir tytfm  an i;s)t2xoxopiu4openmfvsas a2uru oot4altnmfeiysfa uaumo (4texrir oy1fpD an ils0trxrir iu1ame  fcs tf rraumooo0tlxoio3iatfmDuaumont4texrifcoo1la rluvsl(0sruoir3oy4am  lics sfsDtmxrpoo1ole  ieiydla2rl(vo;()artomrcoy1oat auei;t)trtrxr3oy4ole lies s)a2umurpnu1tpenmociltla elnms;t) exrif todop  aivo s s2trir3iudol n nvias a2ta(rooo1optnmociyd a2uanms t)trtnmo ty1lpt au i;(0 rurxr oo4omtnlfcilsf rurxmont4apeoif3iytls2ra( pnu0 ltrxr to1faD  i s s) rtrxr no1lpeelnctl()aDumx  ;u1oeeo i3ias m raums;(4 rxomf iodopD au s;s0 2uo(mpiu4oleemnvtl(  rumxmono4alxoii3tasfs2umnmsnu4tlxrmocty1laDe i o;t) rurirpnodop   ivtlt aDtr(mo;o1tlxo feild m ulu p t0 ltnxfcoa1lmDe i ols0 2uoim iy4ll  mncils aDuaxr ;o1oleomfeiltfa umuvp;t4aeenmfciotlp eaivils)setr(m3ny1lmtnlfvi tfaDtmxm ;o1oltniictadfs2rln s t0trxoif io1fmDr nvol(0 etm(r iudaptn neslsfs2rm(mpno0oltoiiciadlsDuauvont0treoif iodopDe i s;(0srxoxopno4omtn ieiasfa2rm(root0olt mi3iat s2el(vsn(0 lerio3oa1lmD  u s t0 euoxm iu1olenmnvsls) 2rau  nt4aet ifciyt mDel( o u0teeoio3iy1fmte n s t) exoxrpiy1lmt mfeslt artm(ro;t1tlxnif3tatlm2ea(msnt4 exrif3tydfp eaivslt  ruo(opou1llee fcil( aDrrurpnt4aet  o3iytls eaumsnu0trerxr ty1optelnvslt  2to(rpoo1al nlneil(farraxrpnu4tpx iieiat s rlumont)trtrif3todfa  lnvo t) 2xo(mpiy1lm   nvi s)aDtmu o;u4ope iociadlmDea(vo;(0 ltnxo3oodfat  nesls0 rtm(o3nodal  micslt)arur( p;t0tex  ieiytfaDrmuvsn(4tlxrir3iodfmD lu o ()setmirpno1amte fcils srumu  nt0opeoio3tat aDuan p;(4arxnxocoadomte i i t) 2urxopoo1omt lnvtas)a2ur(mp;t4tltoio3tyd mDranvs;t)texomr3oadoaDrlues;s) rtr(r oodoleemfvt tfaDumu p;u4apt ifciyd sDemu pnu4tleomf3oadoatraies t srxmxopiydlpt  nvt ()a2raurp;t4aptoiiciadlmDem(vont4trerio iatlp raivi t)tetrxm ny1lmtn feiat)s2ua(r nt0tex iietytfs el(vp u0tlerxo ia1omDeaies;t)s2xoxr3nu4om   fviatfarrmumoou0texnmietydfa umnmonu)teerif3todopteaneo;s seurirpiu4omtnmfvsltfarrr(r nt1opxniietldla2um( pn(4 rermo iy1fpte nvs;t) eurim ny4olenmfes ( arumumpnu1tetn i3ils a rlumpn(0trtoxrctadlm  anes t sruoxm3oo1opeelnciltfa2uaxr ;t0apxn fcils s2rmnvs u0tlxnmrciadfaD au s ( tetr(o3nu1ale mivilsfs2trx pnt0olx if3ilsfmDua(ms;()teenmf3tatoa   neilt t2xoir iodll   fctlt aDraxmp;u4oee iocilslm eauvsnu)aexnxfcoatlm e n il(0trxr(opou1omenlnesa(f rrrxrpou0altnio3iys aDul(vsnt4altoirctodfmD aivolt0 etmxrpou1altelfes s a2taxr ot1ope  ocils m rmu onu0trerxf3tadoaD ln o;t0 eurxm3oy1alt liet (  rtr(  ;o1tpe mf3iasfa rl(ms;u0trxrmo3iodop  anes;s0trtrir oo1lm n nci ( arua(r ;t0aeeoifeildfm2umnvs (0tlxrmo3tytom  lueo;t  etr(rpnu1oleemfvilsfartax oot0tpeo fcildfm ra(mo (0tltoxr totom ean i;t0 2uo(rpoudop   ictatf Dtrump;o1optn i3iatfs um(vp u0aleoif3iodlmDr uvi;s0trurxrpiodlleemnesls)a2umxroot0oex mf3iat mDrmu on(4artoxfcia1op   ivo;(  2toxr3nodomtemneta(faDumx  ;t4ole if3tyd s um( p;u)trtoir iydoaDrauvol()tetmirpiu4lltn fvtl(fsDrm(  nu0oetnio3tlslm2rln onu4trtnxf3oytlptraneo (0 rxr(m oydlmtelietat) Drmxrpnt4tetnmi3iydfa rm(mp;t) rtnmr3tadlmtr ies s)s2xrxrpnu1optnlivt s sDtmxro;o1alxo feiltfa emumo;(4arenmociadfmD  ivs;t t2urim ny4openlieia()a2tr(moou1oeeomoctldfa uau p;()aexnmocoatla  anvs;t) rumio nodlpenmivt s  rrrxrpou0tetn oetysls umumo t0altnmr3ta1lmD lu sl(  etrxmpio1lmenmietlsf 2taxmpou4alx iictatfmDem(vonu4alxomf3oatfptrluvs s) eurim3oodap  micslsfa2uaumo;t1aptnio3ildlm emnvont4 etoif3oodoat auvilt)srur(r ou4lm n ncsas) rrau  ;u4oet mieiysfa2uan p t) etrmr3totla raueolt0truo(m3iudap n fvilt)aDumuro;u0aex  o3tas sDelnvp u)tltoxf iytlp   ieols0setoxr ny4optelnvsas sDtaur nu0ope mictas mDulu s;u)altnif3iytfaDr neo s s2uoimpnudope mneilt) Duaxr ot0oet  feiad a um( o;()arenmo tytlptrln ols0s2toxopno4lptemfct ()sruru o;u4tlt mi3iatlmDul( on(4 lerxo oy1fat an s;s)srxoxr3ou1ol nmici ( s2raumpoo4ape mieiys m rm( pnt4arxoif tatfm  anes t)seuoxrpnu1lmee ivtat) 2ururp;t4optn f3tytls2umn pnu) lxoifciy1fmD luvslt)s2trxmpiodome  feias)a2ra(  nt4aexn i3tytls2uau s;u)alxoir tatopDeauvo (0t2tmio iu4optn fcta(fartm(rooo4alx mf3tlsfs um(mp u0teermr3tydlmteaivs;t0sexrxo3nudolenmies ()srum( pou0apx mietys s ul(msn() leoif iy1fpDrai o s)t2ur(o3oy4lptn feil(  rra(mpoo1olx iieiadfa eanmo u)tltoio3oatlaDeau s s)setmim iy1olee fetl( aDrau  nu0aeeomieiatlaDumnvp u0arerxf iatop rlneo (0sexrirpiy4opeemfci tf 2tax ono1tlen octlsfs um(msnt4alxrio3ootop eliei ( teum(m3iodamt  fvslt srurumoot0tpe  i3ilsfm2elums;u4 reniociatlmt lies;( trurxopou4llt  ncs s  2ur(r oo1aeeomfeiytls rau p;t) lxoirctydfmDr nvol() exm(r3io1apt micil(f Drmum ot0tex mfeiydls2umuvsnu0artnmr ia1oa e ivi;t)seuoimpny4al emfesatfsrrm(rp;o0optnioetytlsDelnmo;u) rtoxr3ootfmDrli ils0teuriopnodlptnlieias) Drax  no4teeoiociatfaDrmuvp (4alenioctotfaDeaies;s)t2ur(r oydlltn fci () Drmum ;o0alen ieiltfa uanms;(4tetoxf tydlmD li sl(  rxr(r nudlme lncsat) rtr( o;o0olxn ictatlmDum(vs;(0tlxoxrctotfa rln slt0srxo(r iu4oltelfvil(f rrmx  no0tlenioeiaslmDeln o (0artnxf3tydomD  i s () 2to(o oudlm emncsa(f rrrxront4tptoifcias s ranvp u) eenir tydopt  nvo t0 etrim ou1apeelnciat  rtrumpoo0aex  feild m2ua(vs;(0areomr iy1fpD anvs;t)sruoxm3oo4op   nvsatf Durx pot1opxnif3ilslmDrau o;()altnxr ty1fmtranvs;( seum(m ny1apt livsat)a2taumonu0tpxomfeilsla umump;u)alxoxr oodomtelnvol()trumim oy4op nlfvta() 2uax  ;t4aexo f3iasfs2elums;(4alxnmrcoy1op rlnes;t)teto(o3io1llenlivt sf Dtax  nu4olenio3tasfs eanmo;()trxrif ia1oa ean sls  rumiopoo4ome lfvta(fsDtmur nu4tlx mfetyt aDrl(mo () lxrmfcootoptr nvils0srtoir oo1om e nvsa(  Dra( pot4aexomfctysls ul(mp t4teeomf3ty1oat anvi t) 2xm(r oo4ap emnes t  2ua(r nt4tleniietytfsDrmumsnu0arxrmr totoptrlneo s  2xrxrpio1lmtnmfetas s2rax o;t4optoiociadla2rl( o;u0aetrxr oodop e ueil() rum(r3oo4lmenmnvia(f 2umurpoo4olxo feild mDulu s t0 eerifctatfmteln s;t)s2urxo ou4om nlivt t)aruaurp;t4tpe ifctytla2eluvs;()aeenxrciy1lp rlivs s0 2toxo oudllt lfeiat  rrmxmo;t4tpeoiieiltls emuvp (0tltnioctodla e nvo ( trtrim ou1lmte fetasfs2rm(mpot1altnmoeias s2emuvo (0tlenifcto1lm r nvi;s setr(r ou1lmt mnvsas) Dtr(rooo1tpeoif3iyd sDelums (4areoio totlaDrlieslt)sexoxr3ou1ap nmict ()a2uru onu0olt ifetaslaDemnmo ()trxnmf iodop rlivo t) 2um(rpno4aptnlnctat s2rr(rpnt1apxoif3ilt a uauvon(4arxomo iotfa r nvo t s2um(rpoudop nlics t  2ta( poo4opeo ieiatfa2emn pnu0trxoifcoa1latranvs ()srurir3ny1ome lnctasfsrum(monu0tlx moeiyd s eanmo u)tetnifcoy1lpDr i o;s)s2xmxm oo4ll nmicslt) Dra(r ou1aee if3taslaDea( p u)areoir3ootfmD aivi;()t2xoxrpiu1om  mivsa(faDtmx  no4teeomf3iat m rlu sn()aexnio3iy1oatraneilt  etoxo3iu1lm   nvil( sDrrxmono4opx mf3iysfa2um( ont0trtoioctotfaD ln sl()t2toim nu4lmtemfcs s)arrrxm ;u1optn fciasfsDum(mo;u4artoir oatom  lnvolt0 ruoxrpiodlmtemnei () 2uaumo;u1oet iicilt aDea(msn(4aetnmr3oydfp rluvilt0 rto(o3io4lpe mnesasfs2ur(mp;t4ole  oeiadfsDum( snu4arerxf totlmD  uesl( texmxm3oo4olt lnesas)aDuaurono0teeomf3tat sDranvsnu)alenxo iytfaDraieo t0s2uoxo3nudlme mfvtat a2umur ;t1apxnmfeiys m elu ont)aeerifcty1lmDr ieols)texoir3iodome  fvsa(  rumxrpno1aee  fcils a el( o;t0aeermo3io1fat  uvols) 2xmirpoudomtelfesl( a2ra(mpot1altomiciatfaDrlnvp (0arxoxfctytfaDrlues t)srxm(rpoudom nlfctls  2urxmpot4olt moetltlsDraumpnu4 ltoxf ia1fptrlueo;s0t2uoirpou1lm   nvtas s2umx  ou1oex ioctyd m ea( on(4 reoif3tytfm  livi;(0texmirpiy4opt miesasfsrumumoot0oetniiciadfmDumu o () etrioctotlpDrlnvo s0s2xmimpiu1op emnetlt) Durxrp;o1olxn iciyd sDuluvsnt4tlerxf3ta1oat  uvs ( s2xoim3iy4lptnmietltfs2taxro;t0opx iieiat m ua( p;u)alxrxf ty1lm  au s;t) 2urirpiodoleemivsltfartaxmpoo0opxoio3ild a rmn on()trxnmf3oodom eanvi t)srxo(opny1lm emivs ( artaxmp;u0ope iieiltfm2emums;t4trtrir iytoa rliesls)tetm(o3iodllt  nei t)s2taxm no4tlxomoeiaslaDel(vo (4aexrxf3totomD  nes;s  2umxm oy4al nlivsa( srum(rooo1oetnmocilsfa ran pnt0alerirctydlmD au o t)t2tmir oo4lleelfvsas  2taxmpot4apt  oeildfaDranvpn()trtrxocoy1lm e neo t)seur(m3io4om  mfci ( a2ra(rpoo4opxoioeiad m2ulu p;t0tltoif3oytfm  lnes s)t2uoxopiodllt lnctltfsrraumont1altoifeiad a2umnmsnu4tlxnmocoadlm rai il( texoxo oy4lpt lnes s)a2raum oo0oexoio3iyt m elumonu0 etrmocoadlmtrai s;t)texoxm3nu4lpeemiei ( s2ur(m ;o1oeen f3iltfm2um(vp;u4 etnio3oydlatr iei s)t2urirpiudoptemfct () Dtr(r nu1oexniictldlm um( on() eerxocoytlp  lnes t0teto(m3oo4oleelnetltfsDrau  ;o4open ieildlm ran s t4 eenxr oytlp elnvsls0teurxo ny4lmtnlivtl(farraumpnu4oex moctasfs rlnvs;(4 renir3ty1fpD ai sl()srtriopno4ame  nvia(  2uax  nt1altomfctadls eauvp u4trxnmocootlmtr ueo (  rxmirpiy1ale  fes tf Drmu  ;u0ale moetadla emumpnu) rtoxf3ootlat lnvsl(0texo(mpoodlme mivtatfaDrrxrono0tetoiocildfs emumsn(0arxrxfcia1lpDelnvo;(0s2toxr iodome lici (fsDua(mo;t4tlx if3tld aDel(mo;t0 lxrmrciatla  aneo;() exoim3oo4aptelfei t)aDta(rpnu0aexo fctydlsDel( s;(4artnxo3ootfmteaivi t texr(rpny4ope lneta( srtmxro;o4optomoeias sDua( s;t4tetrmo iotopDe nes;(0 2tmim io4altemivilsfsDuru  nu1tlen o3iys m2ea(vp t0 renxr3tydfaD lueol()teumim no1aptn fcsls)s2umxr ;o4tpx  i3ildfs2ulnmpnu)arxrmrciydlmt  uvs s0t2umxr io1ll elfet sf Dtaxr ;u4teto f3iaslm eln p u0 exoio to1faD lueil()s2xrxo3no4apee nci s)artm(r ;t0tex  i3iysla2rlnvsnu4 lxnmo oodoa eaues;s0seum(opio4apen ictls srrmxr no1tltn ieiatls2elnvpn()aexomfciy1fmDrlivi;()setm(opoudome livta() Dtrx onu0aptomfctldls2ulumpnt4areomo3ty1
\ No newline at end of file
@@ -0,0 +1 @@
+u o ()srxoimpiu1opeelietl()sDrmxr ot1alen ietatla2rl(msn(0tltoxo ootomDelueo;() 2xmxr ny1ll  licslt)a2um(rpot1tpxniiciadlm2rlu o;u)alerxr3tytoatrai il(  2trxmpiodapt lfvt ()a2trurpnt4olt mociyt a2elnmp (0alenif oytfp elueol()teto(mpoodlle  ncta()sruau  oo1tpx moetls m ul( p (0 ltoxo3oadfmtrauvsl()t2um(m3nudom   nesatfa2tmu onu1oltomoeiaslm2uluvo u0trtrifciatfmD li o t tetoio3nudlm  mnvsat  2rmu  ot4tpenmfetadlmDeluvsnu0teenircoydfpt anvs s0trxoio oo4am elnctls sruru pnt1alxnmfctadlsDuaumo;t)aeerxrciatlm   ieo () exmio3iudal n netl( aDuru p;u0alenio3iytfs ea( o;t4alxrmr3iatomDeluvsls) ruoir3oo4omtn netasfsrurxrpno1tlxo iciytfa em(vo;u4altoirciadfmtr ies;t)srtmxopiodlmenlnci t) 2ua(  nt1openioeild m rauvo u0arxoif oatlpDe ues s t2xrim iydap emivsat  rtmum oo0apt iiciadlm eanms u)arxoif io1fa eli i t)s2xm(r3oydolte ivi tfarrru oou1oexn o3iysfa2rlums u0 leomo oatfpDraiei;s seuo(mpoudoltelnvi s) Drmxront1tltnmiciltfs umuvont)artnxo oatfmD luei s0seuo(rpnu4olte fciat) rtrxmoou1apxn ieiytlm raump t) eeoircty1fmD anesls srtm(m3oodole mivsat  rrmx p;o1tptoifetatls eln s;t4altriocia1fmDr n s t0 2um(m3ou1lm emfetls arumum nt1texnmf3iys s eanvs;u4tlxrifcoy1lpte ivi;( srxrxo3io4amt lnesas)s2rmx pno0oleo i3iad s umnvs;() eeomoctodopteli ols0trxmim3io4olenlnvtls  Dtmxr nu0apxnmo3iytlm2elnvp;t)trtrxf3todlmD  i s;s) etm(opiy4am e icsasfsDraum nu0tpxomoetad a elnmo t)tleomo3ia1lat aivs;t  etr(o oo1apt lnvi () Draurpnu0apx iocilt mDelnvs t)tltrif todlpt  ivi;()texrxopoy4opte netls) 2ta( onu1aeenioeilsfs el(msnt) reoiocty1lpDelnei;s0sexrxrpiodamtn ivsltfaDta(mont1texnio3iasfa elumsnu) lerxo3oytlmtrau sl()teumio3iudalee ivsa( s2urx o;o0oeen ocild aDumu o (4 eenir3io1fm rau i;() exmxrpoo1olee nciasfarururpnt1olx  ieiyslm2eaump u)aetnmfciodfat aies s0trxoxo ny1am n nvsa()aDrmur oo4teenii3iytfm rm( on(4 rerxfcoytoaD an o;t setrxm3io1lmtemfvsl() Drm(  ;t0tetnioeildlaDumn s t0aexoxo3oa1lp   i ols s2xoio ou1amt lnciat arta(m no4tltoiictls a2eluvonu0aetnxocootoptr n s t) rtrxo3ny1ll elivslsf Drauronu4apx mfeiys aDrlnmp;(0aexrmo io1fmD li i;s  2trxm ny1amte fctat sruax  ;u4olx mfeiytlmDrauvpn()arxnioctydfptrau i t  etm(o iydap n iet sfaDurx  nt1aleomfeiadla2umu o u)trtrxo3tatlpt anvs s0 ruoirpoo4lle lnesltfartr( p;t1tet if3tld mDelumpnt)texomf3oytla eliei;s)trxrxm iydam elfvia() 2uau o;o4tlxomociltfm2umn s;u0trtnxocoo1fm  livi;s  exrxopiudll  mfeta( s2tau oou0alenmfetaslmDrl(ms t)teerir3iy1lmteluei;( s2toiopiodam e ietls) Durumo;o4tlx mi3ias a2el(vo t4 lxnxo3oytlmt li ils0truoxmpoydolen ivta(farta( pnt4tleoio3ild m uluvo t0altomrcoa1omDe i olt)teto(r3oo1om  mnvs t  rrr(mp;t0tetn feiaslaDrmnvpnu0aexrircootlateauvs;s0 2xrxr3oo1alen ictlt arraxrp;o0texomoeiaslsDrmuvs;t)altoio3tadfa r n s s trxo(r3oo4om nmnciasfs2ur( ooo4tptoifcildlmDrln snt)aetrmr oytfpt  iei;s0teuo(r3iydllenlfeiat s2rmx poo4tpxomoetysls2eaums;t)altoif oa1op e neo;()s2urim ou4ap n fcta( arum(r nt0ale mi3iyd m emn s;(0tetrir3oo1lmtelieo t s2umxopnu1omtnlivi s srur( oot1oet if3tldfsDuan on(4altrxf3iytlp e ies;t0sexm(o nodamte neslt s2urxrp;u4teeo o3iasfm2ranmo;t4trtrmo3ia1lmt aneilt seumio ny1lmen ietlt aDur(r nu1olt mf3iysfa ul(mont0tetoxocoytlm elu i;s)srxrxr nu1ap nmfct t aDuauro;t4opxniictat m uln o u4 rerxfciytoaDe iesls) 2to(o3ny4ameemncsls)s2tru o;o4tlxomictytfs rmu pnt) exrxr oy1fpt lueo;s0 ruoxopoudlpt mfct ( s2rmx p;u1olenmfetlt m2em(mp;u0trxoxf oy1op elivs;t0 rurimpoudam   iesl()sDururp;t0olt mfcildlm ulnvsnt)aeenif oodom elneil(0seumim nodom elivslsf rrru o;t1ape  f3tlsla2eluvsnu4 rtrxf3iodla eliei ( srur(r iudamtemfctas) 2urxmono0tpx  i3tadlaDua( o;(0trtrir3io1fmDr nvi ()srtmxmpio1lp nmfvt t  2trurpot4tpt mictysfm2rmn s ()tlxnircoatfpteaivs ()teto(r3nudlltnliet s arrm( ont4tlx moctltlm uan o t)aeeoxo3iatomt auvsls)srxmim iodll n nct (faDrmxmpot1aeto o3iltlmDum(mp t)texoif oatfm  ai s;(0tetmimpoy4aleelfcsas)a2rrx onu1aexoifetyt mDeanvs;t4 ltnxr ootfmDr nvo ( s2tr(r iodame mnviat artr(rpnu4alxomo3ilslmDeluvsnu4tleoir ootfp eanvs;(  2ur(m3nu1am   nvi t)a2rau oot1oetomicias a2ean s u4 exoio oatfa rau s;s0s2uo(mpny1oltnmivils) 2taum nu4oee mf3iatfm rauvp;t0tleoxrciytfat  neo;(  exoim3nodapenlnvi t)arur(  ot1olen i3iadlsDulnvpnu0trtoir iadopDranvs;t)s2xoxr iydape livs s)srrmuronu0teeoii3tyt a em( o;t4 eeoxr3to1omteli ils) 2trxmpio1llt  fvt s)s2tmxr nt1oetoiietls aDemn on()arxoio3totlp r ieils0 rxoim iudlmt lfvtltf 2uaxr ;u0apx mociytfs rlnvpnu4tlxrio3oytfaDrlieslt tetr(opoodlp nlfesas  2rrur ;o4aleoiiciasls2rm(vp () lxnxociy1fmD auvi;s0 euo(rpou4lm elnetat)aDurum ;o0opeoioeiadfa2uau onu4 lenir3tadlat luvo;t0 2xr(m iydlpenlfvi sf rtmuronu0oeeomi3tadlm2eanvont)tleriocty1lat au olt0setoxo3ny1lmtnlnesat)s2tax  ;u1opxo octldfs eluvpn(4teerifctotfm e i s;() 2tmxr3iydope  ivsas  Dtmumono0aptnmieiytlaDrlumsn(4trtoir3todfptr n slt0setrim nudomeemnvt t  2rru pnt1tpeomf3tldfsDrmnvsnu4altnif oo1oatrlneo s0t2xoio oudopt lics sf 2taxm ;o4aex  o3tad s eauvs;(4 exnir3ootla elnvi;s srxr(r3oodomenmnetl(f Dtaxro;o4tpt mfetlsfsDum( s ()tltrmo3oa1fp eluvo;() ruo(m3oy4omenmieiat sDtru  ot0tpx iociat a rmnmp t) exomr3totomte uvsls0t2umim3no4lptnmnvsl()arumu p;o4opt iiciadlsDran o;()artrmfcia1oa eai s;(0trtm(opiu4al elfvta() Dra(r nu1tet iictlsfaDel(msn() leoxr3totoa raivi (  2uoxo3ou4llt lict () Drmx  oo0aleoioeiltfa2ean s (4tltomo3totla r ieolt0s2umxm3nu4omte ieia( s2rmum nt0apx iiciltfs2ua(msn() eenmf3tadlmteaivils0trxrim3no4amtemici sfsDtrx p;u4opt miciadfs em(ms t) rtoir oadfm eaivi (  rur(r iu4ap elnci ()a2tmu  ot4apt mieildfs2rlnvp u4 ltnmf iadopt  nesl()sexrim ny4alte netasfsrtmxr ;t0aleomfetadls rlumpnt0aeenxfciotfateanvs t0 etoir ny4lm  mfvtls)s2ta( o;t4alen f3tld s eluvo;u) rxoxo3oadoat aivs;s  2tm(m3nu4ameelnetatf rrru  ot0tpeoiociyd mDra( snu0aetrmfctadlp r n ol(0teuoim3iu1om elnvsat  Dtmum ;u1tlxnif3tldla2emnmonu0trtrmf3oodoa eluvsls0t2toio3ny4ame lneil()a2rru o;t1altnifeildla uaumpnt4trtnxr iatfmD livil()seuoimpou1apeemneil()artm( ont4tltnmoeiyd sDrln snt0 lenmo iydlat aieo;(  2trir3iydlmtnmiet t  2uax pot1teen iciatfmDua(ms u4 rtoxo3ootoatelieols sexo(o3io4apenlnct ( aDur(  ot1oet mietadlsDemnmo;(4 leniociy1fpt au s;t0s2xr(m3nu1ll emiesasfsrumxm ot0oexnifciatla2el(mpnt)tltoxo3io1lpt aivi t tetmimpoy1lleelivtlt)a2rmx pnt0tltnio3iat m2uanmo;u)artoio iotla  anei t0s2xrirpny1amtnlfes t) Drmurpou4olt  ociadfaDuluvo u0 lenmo oatoateai s;s0seurimpoo1apenlfcs ()srrmu o;u1tee  ocildfa emnms;u4artomrctatfat ln i ( srtoxopny4llt  netat  rra(m ot0olx  fciasfm uan o u)aetnxf tydfpDrlnvs;t  2urirpny1oleelfctlt  2raum no1tee iiciltfa2rl(mo;u) rtrxo3ootfpt li o;t)sexo(mpoudlm nmfvilt)arrmxmono4apxomo3tydlm2uanvp;u4teermo3oydlpte neo;t)seurxo3no1omt mnvils arurx p;u1aleomietys a2rl( o t)alxnxr oa1lmD  nvo (  exmirpiydlmenlfctls  Drmumpno0opeo feilsls ea(vs t) ltnxrciytlmD lneo s) 2trir oy4lm e ietat srtaxr oo1oet if3iltlm em(mp;()artoxo3iatomt lueil()tetmio oydomtelfct (faDrrx  oo1oet mfetasfsDrlnvs;(0alxomrctytfp raivilt)texmxopio1op e ivtls  2trx pnt0oexnifciat s emnvp () lenmrcio1opDr ivo;(0srxr(r3iodlp  lfesa( a2urx  nt1ole mo3tytls rmnvpnu4arenxr ootfmDelnvo ( sexmxmpoo1openmfctls)a2rm(  ;t0tle mocilsls elums () rxnmociytfp e ueslt0truo(o3oudlm emncs s srumxmp;u4oet  feiatfa2ranmp;() lenmr todop   ueils)s2tmxo iydomtelietas)a2uaur ;u0oltnifctlt mDumumpnt4tlxrmrcootfaDrlnvolt0seuo(o oydopenlnetas) rtmxmont0tltn feiaslaDelnms;()alxnxr oadfmteauvi;()srtrxm3no4omenlncsatfs2ra(rp;o0oltnif3iatfaDumumpnt0arenio3oa1oateaues;() etoxmpno4lpt  fes s) rua(r nt1ope mo3tytls ra(vp (0 leoxo oo1lpt an s s srxmxopiodameemnvt (fsDtrxr nt4apxnioeiat a rlu o;u) exnio3totfp   uvs;s0teumxm3oy4lpt mfcils sDrm( onu4oet ioctls s umu o;t4altomr3oatfat lnvo s0 exm(o3nodll   nctat)a2ta(ro;o4olx  icias mDumu p u4aetnmrcoydlmt  u i s teum(r oydlmt  neilt  2raum ot0optoii3tysla rl(mpnt)alxnxrcoo1fatrauvol() rxrio3oydal nlnvils aDuaurp;o1apx ioetyd a rmu sn() rtoxf iodfa  ai o;(  etoio io4ap nlfcta(  Drmu o;t0apx io3tlsfm2eauvp u4tlerio tydlatelueils)texrxm io1olt mfvilt) rurur ;t4oltoio3iatfa uanvpn(4trxomfciotom   u ilt0 2um(mpiy4alt mivs sfarrr(ronu1oee mfetltla2rlnmpn(0trtrxf3iadopD  u o t srumio oo1alt  fctlt) 2tru o;o4altomfciys mDumump t4tlxomf3oa1lat  i s;t)setmir3iy4amen ivtl(fs2ta( o;t4tpt mfeiys sDeau s;t4alxomf io1fat aivs t texrim nodoptnmics s)aDrmu p;o1teen oetys sDrm( p (4alerxr ootomtrluvs;(0t2tmxo3iydoleemfct s) Dtmxm ;u4oeeomfetldlm2rauvp (4tlxrmr3iydfaDe uvo ( teuoxr nu1ll emnctls  rtrur ot0aexomiciasfsDrmuvp;u0 ltriocoo1fptr i o ()sexr(m3oo4openlneias) Durur no4oee micildfsDea(ms t4 eerircto1oatrau o ()trxo(r iy1ap e nesl()s2umurpnt4oleoiietatfs umuvs t0 lerircoytfate ies;()srtm(o nudopt lnctl() Dumxr ;o4alt io3tyd m emuvp;(4 ltrxr3totomD  nesl(0 rurxm oodapte fesl(  2umxmpnt4tpx moetad aDrl( p;()aeenmf3io1oatrlivo;s)texmxm3oudol nmfvt (fsDtmxr ot0apt mf3tatla ran snt)tlenif to1omDrau i;s  exoxo iydlltnmics s) rrrumono0aetomoeiydlmDuaums;(0aeenxr3tadlmtr u s t) rtrxr3io1om emfvi s a2tm(rpoo1tlxoiicildls em(msnu)trtomo oa1opD aivils t2tmiopnu1lmt  fvsl( srrrxmpot0aleoif3tas m rmumo;u0 rerio oodlaDrlivo s0s2urir3no4amt mfesl(  Dtrxmonu1tee ioeiatlsDem(mp ()trtoxo oytfpDeaieo t0trurxo3oodlptnmfeil()s2trxrpnt0tlxn fciydla eau o (4artnxr ta1la   nvol()teuo(rpiydaleemnesas)sDtrxr ou0tee iietldfa2ul( p;t0 lenir3tytoatelieo;t0teuoxmpnodopee fvtat) rta(  no0olx ii3iysfmDrluvp;t)artnxrcoo1oaDe ieo s0 2toim3oodlmee ivi (fsrrmurp;t0olx iictlslm2ra( sn(0alenmociatoaDrli s s seurirpiy1opeemncias) rrau o;u4ole  fciysfmDul(ms t)tlxrmr oatoaD  i s;t tetrirpoydap n fei tf Dtauroou0tlto ieild aDulu s t0 rtnmo3oa1oatrlueo;()srxoiopou1lp elnes tf Drmxm ;o1opxnmicilsfa2ran on(4trtnxr ootoaDean olt)t2trxopou1opeemnes (f ruru pno1aee  oeiyt m2umnvs u0tltnir oatfptrlneo;t)s2uoxr iudol nlnes ( aDraxmono4optomocilsfaDulnmp;() lenmoctadlmDraivi (0trxmirpno4lmeemfetl(  Dum(m nt4aeenifciydlm2rlnvp;u0alermr tytfm   n o;s0 rtrim3nydllee fct t sDtaxm nu4altnif3tltlsDrlump;t)texoxf ty1om eai s s srto(r3nydlp n nei (faruau ont4ale  fciysla elnvsn(0aeenir ty1laDraivilt)texoxopoodlp n ncsa() Dra(ro;t1aetnifeiltlaDuauvpnt)tlxoioctadlm r n i s srtoim3iydlleemnvi t arraxr no4tex  iciatlaDranvp t0aleoxo3oo1lpteln ilt  2uoimpnu1opeemfctl(  2tr(r ;t4tpeomieiydls eaump t0 ltrmf to1lpD li s;s)t2umim3ny1amee fvi t)srrr(mpot1opx  fetatfa2raumpn()tlxnir oo1fpDelues t  eum(opnu4al  lnci tfa2ta(m ot4tleniieildfm ra(mpn(0 etoio iydoptrauvs t0 rtrimpno4lmtemietltfs2uru  ot0apx ioctatls umuvs;u4trenxocoydlmteluvs s0 etrxr iydlmtnlncta( arrrumoou4tpxn feils a uluvp;()trtriocoytlpte ivo t0sexrxr oodlmt  nei t) rtm(root0texnioeiatfa2um(mo t4teenif3ootomteaieo;t srxrim ny1om n nvsa() Dua(moot0opt mo3ilsfm rlu s u) rerifcia1latelnvsl()srxrio no4op n ictls sDtmxr ;t1tlt mictytls rlnms (4tetnxf3totfat au ilt0 2xrxm3nu4lptelnct ( s2umx oou0texomo3iytls ea(vp (0tetoxfcty1lpteli sl(0s2xoio oudal nmnesatfs2tmxmont4oet if3ias aDeanms;t0altrio iadfptr nei;(0srtmxm nu4ap emncsa() 2trx pnu4tet  ieiyt m2umu p;u0 rxnmr oydoatr i i;s)t2uo(mpny1ame  ncia(fsDrax  no1tlenmocias a ulnmo ()trtrio oo1faDraieo;t)trtm(o ny4lmt livtatfaDtaxmpno1aptnmiciydfsDra( ont)teerio oodomt anvolt0 eum(o3nudalenlncsasf Dtmuroot4altnmf3tldlmDea(mpnt4teenio ootfp  lnvo ( s2toxo3oo1ll e feils a2ur( ooo1tet  ieiasfmDum(msn()teeoir ta1fp  aneslt0t2xm(m3nudlltnmnvtat  2umx  nu4ape moctyt a rln sn(4 exnmfctytom e ivo;t texmxm3nudamt  ivi tf 2uaumpoo4opxomoetadlaDra( s;t4tlxnifcia1oa elnei (0sexoimpou1ol elfcsl( s2truro;o4aeen iciasls rmnvo ()texnirciatop ranvs;( s2trxmpio1amtnmfvsa() Dtmu p;t1oltnifeiltfs2rm(msnt0altnxf iodfmD an ol()srxoim ou1op   ict t)s2tr(mpot4tptniictlsfm em(mo () lxrmrcoo1fm  luesls) eumxo iu1lleemnetasf 2rax onu1tpxoio3iatlaDelnmon(0arermr3iydfaD auvol()s2to(m io1optelncia()a2rmumoot0aleo ietls m2emnmpnt)trenif oatlpD  i i s0texo(m3io4op emfcilt)a2ur(rpoo4tpt mociatfa emumsnu0teenir3todfpD lu o (0teuoim iy1am e fcsat aDrrurono4oltoii3tls a2uauvo t4tetnmfcoadoaDe ueo ()srxm(m nu4omee ncta( a2rr(m nu0apx mfeiltfaDuanmp;u0alenmo3oodla rauei;(0 etrxo3ny1am  mfvt ()srtmumpnt0alt mfcias sDrluvp u) rtrxr3iotfmt anvs s) 2um(r3nu4ame mfvtltfaDtrxmo;u0ope  oetys s eaumpnu)artnmo3io1laDranvol(0t2urxm oodllen fci sf 2uaumonu1oeeniicilt sDrln s t4 eenir iy1oa rauvi;()s2xo(mpoo1openlfvt (faDuax onu4ole ifciadfs rl(vs t0tetoxf oa1lat lu ol(0 rxoir nydal nlfciltfarumumpnt1oee  o3ils a2elums;(0trenif3iy1lp r i il()t2xo(r3nu1lmeelnvtas) rurxronu1tet  f3iat s2em( s;(0tetnmf oo1oatelu i (  rtmirpnodol e fcsls) 2rm( ooo4tetomfeilt mDeln o;u)tetoif tatfa elneol()t2um(o oy4aleemicils)aDtr(rp;o1apen octld s rlu o;t)trxnxf oadfm rlu i (0 rxr(m oudapeelicta( aDrrurpnu0tlenmf3tasls2ulnvo t) reomfctotlpteluvolt)s2tr(o ou4ape  nvs ( s2tmu  ot4oet ioetltfaDrluvont) reoio iatfatrlieil()teuo(opny4alte fesl(  2rrxrp;t4tlxoioeiatfaDranms u) etomo tadoa e nvi t0srurxopiy1al e nct sf Draxmp;o1alxomictld s emnvonu)arxnxo todfa  auvs;(0 etrim3io4lm   netas a2ta(rp;o4aeeomociydlaDran p t0alxrif to1om elnvi;s0srxm(m3oy1olenmnetatfaruaumpnu4teenmocild mDra(ms;t0trtrxfcto1fmt lieolt0sexr(o3iu1llee ncs t)s2umur ;u0aptn oetysla uln s;()texomo3oatomte ies ( setr(r iu4ll  mnesat  Drruro;t4optnmo3tldlm rmn on(0treoxr tadfatrauvil(  eumir iy4alt  fvsat)srua(rpnt4oetomictlsls umump t4 rtomrciydop  auvil()trurxo3oodlltnlfcsas  2raumoot1ape io3iyd a ua(ms;t0areriocoydfm   ues t)t2to(r3iodolee iei (fsDtau p;u0tltomfciadfm2umu o;(4 leoxrctotopDe nvo s s2xo(r nu4al nlnct (faDta(mp;u1tlxn iciasls2ua( snu4 rtrxr3tatfat anvil()setrxmpiudamtnlieil(  2rax oou0tet if3ilsfa2emnmo ()tlerir3ootfptr nes s  rtmxo3ny4ap   nctat) 2taxmpno4tptnmfcias sDuluvont0 exrxo totlate ueilt0sexoxo3ny1openmfeiat)sDtmxr ou0tpt mf3iytla em( o t4artnmr3oytfaDe uei;s t2um(opoodam nmncsls)arrruro;t0alt iiciydlaDrm( o;t4 etrmr oy1op  aivo s  2tmxr io1olt lieia(  Dururonu4tpe ifctls m2eauvon(0aetomf oatoat lneslt0trur(opiy4op  mnetltfs2tm(ro;u4aeeomieiltfa emu p t)tlxoif oydfpDrai s;(  etr(o3nydaleelnctlt  2ra( ooo0tpenmfeiytla2umnvpn()aetnxo oydlatrai ol( s2xmirpoodop n iei ()srtaxm nu4tpt ioeiasfa2umu p;t)tlxnxr3to1latr nes;(0 2xm(o3ny1lptnmneiat)s2uax o;o4apt  ietytls ranvpn(0trxrir ta1om  aivols)trtoir3ny4ame lfetltfartmum nu4opt mfeild s ulnmonu4 etrxrcta1fateli o s)texrim3iy4al  liet (  2rmx p;t1tpe moeiatfs rmumo u0 exoxf3oo1oa eauvi (0 2toxr3oy1aptemfeiltfarrax pnt1teeoio3iltfaDuaump t)tlerxocto1lpDelu i;(  rxrxrpnudom nmicta()a2umum ;u1optniociasfaDumn snu) rermo3tytopD aieo;() rxo(opny1ome mfetatfa2ra(mo;o1apen i3iaslm2ul(vs t4 lxnmr iydlpD  n i;t srumxopoydape miciltfarra(rpno0oexn octldla uanms;()alxoircoy1lmtrlivs;s)tetmio nudamee icsasfsrrm( ono1tpto feiasfs em(vo;u4 rerxr iotlptean sls0 exoxmpnodlm emneia( aDtaumoot4apx  f3iyd a ua( snu)treoxo tatlpDrlivsl( teurxm nu1apte ict t aDtaum ;u1oltnmfctldls ua(vsnt) leoxrciatoatelu ils  2xrxopoy4lpen nvs tfsDrrxr ou4tleo fciydfsDem(ms (0alenmf oa1lmt liei s0 etrir iy4amtelivtas  Drmxm ot0tlxomo3iyt s uanmpnu4altriociytfa  ln s s teurxopiu1llt  ivsatf rtaxrpnt4ope io3tad a2umn o u4trxrir3todoptr u s s  etoxo3nudopen neilsfsDra(mpnu0oexomieilt aDua( o;t4trxnmociotla rlueol(0 2umxr3oo1lme lfcils)a2taxmoot0tpxnmocildfa2uln pnt0treomrcoo1opD  n o;s)trtr(m3iy4op   nviltfa2tmu oou4tle  ieiasla2uanvp;(0aleoxrcoytomDrlieo;s trtrirpnu4lmee net tfs2rrxm ;u4tpt mo3ias m2ul(mp u) lxoio iydop elnvilt0t2ur(rpoy4lmeelnctlsfarraurp;u0olxnmf3tadfs ra(vp;u4 exnxocoo1fmD anvi;( srxrir3nudop   icsa( aDtmxr ou1oet mfctydls2eln s;t4teeomo iadla  aueilt) ruoxmpou1apt lfcsatfs2rm(r ot1tpe  f3iad aDrmnmo u) eerxr3oytfpD  i s;(0 2ur(rpiu4olt mfvsa(fsrur(rpno4alxoioeiadlaDeaump u4 ltoif3ty1opDeaieo ()t2xo(r3oo1op n ivs t)aDua(m ot1apt io3tyt m uanmpnt) rxoxo3iatop elnvols)sruo(m oo1alt lfvsas srur(ronu4aexn ociydlmDuaumo (0tlxomo to1fpt  ieo;s0s2um(r3nu1om e fvil(faDumxmoou1aexn icildfaDrmuvo;(0 lxnmo3to1oateanvi t0s2xrio iodapen fetl(faDuau o;t0tlt  oetadlaDeln snt4aexriocoadfateau s;(  rumxo no4omt licsls sDta(  no1ole ifeiadls umu s u)trtrmfctydlmtr ieslt)texr(o no1ap  mietl( srta(mp;o0opeo ietys aDrauvp (4areomr3tydfaDeln s;(0 rur(r ny1lmeemietas) 2taur ;t1opx iictadfaDem( s ()tetrir3todoa  auvs;s0srumxm3ny1alenmfvi sf Dtmxmpnu1tetoif3tat mDua( p;()altnio3totlatraieo t)t2uoxr no4ome mncia() rraurp;o0tptomi3ias s el( p (4 rtomf io1la  ln i;()trxm(rpiu4am nmfesat) 2tmurooo4aet ii3ils s2rauvs (4aetnir3tadlptran i t s2tm(m nodaptelnet (f rumump;t1aexnmoetyslsDumumsnu4 rtnmrciytlmDeai o t0truoirpoy1lm nmnvtasf 2rmum ;u4altomf3iyd a2ra( snt4tetnio3to1oaD lu slt0s2trir3oodameemnvsltf Drrxr ot1oeeomieiytfs2rmnvon(0artoio3ia1oat aivolt)seumir iy4op  mnviasfaDtmumpoo4tlto o3iytlm ra(vo;u4 eenxfcoytlptranvils)t2tm(m3ou1om emnvsat) Dtr(ront0aet mo3tls mDea(vs u)aeeoif3iydopDrauvi s)setrio3nu4lpe lnvi ( s2rrxmonu1apxnio3iysfm2ran p;t4tltoxr iadlm  livo t0srxmxmpnu1amt mivtatfs2tmxro;t1apx ifcild sDea( p ()tltnif3io1fatr uvo t trtrxrpiydam  licta( srumxmo;t0tpx ifetatfs2raumpnu)aexnxf3iy1laDr nei;t)sruoio3nu4lm n nci tfarurur ;o4tlxo ietadfaDem( p t4tleomocootoat lieol( t2ur(o oy1lm nlfctl( srtm(m ou0alt  f3iyd aDrl(mp;t)areoio3oo1op r i i;t)sexr(m oy1apt  icil() Drmuro;o4tlen ictasfs emuvon(0tlxoxrcoydfp r iei;s  rxoim3nu1al nlictl(  2ur(rooo0tlx io3ilsfm2umu s;t0aetniocoatfpD luei t0 rtmio3iudaltnmnesl( a2urxr nt4oexnmfeiasfa2ua(vs (4 lenxf iydlat aies;(0 rxr(r iu1al e feiltfsrururo;u4tpto f3iyslmDul(vsnu)alxoxr totoa e uvi t  rtrim ou1op  mfct ( s2urx  no4altnmoeiyt sDeaumsnu)arxnxo3oo1lpDelueo;(  rumxo iodll  mfeil()s2raurpnt4alx mf3ilt mDra(vs;u0treoxocto1faD livil()texoxm oydalt mivi s)s2uaur nu1oltoifcild a rluvpnu4trenxoctotomt  uvo t0s2um(m3oudamte fei ()aDta(mpnt1aptn ociadls2raumo (4trtnifciadomteai i;t  rtmxm ou1ale mivsas srurxmpot4oeeomietyslsDem( o;(0tltomr oydlpD  uvi s0s2trxo3ny1alenmnes t aDtm(monu0alx  ictlsls um(vs;()arxrmr3tatoa ean o ( truoir3no4amtemietl( srtauront1opeo i3iysls ra( pnu4tlenif3ta1la eaivol(0t2tmio3io4lleemfci s)sDrr(rooo4aexn ociyslmDrmu sn(4arenmf iy1lp e uvo t  2trio oudlmee fctl(faDumxr ou1tpx mieiad a rmuvp u) etoir3oy1op  aivo ( trxm(mpiydole lnes () rraxr oo4opxomoeiytfa ranvo (0trxrio3oydlat  uvo;( s2trio nudam n net s s2uaurpot4tpeo f3tlsfs2ea( o;u4trtnxociadomDr ivo s trtoir iu1llt mfcsl(fsrrax  oo1tpxnif3iasfs eanvp;t0artnmo ia1lpD anvi (0t2umiopno1openmicia(  Dtrurooo1ole  ietltfaDumu s;u0 rtnif oo1op elu i s) 2to(opnodll   ivsat  Drmxronu0tlx ii3ild mDea(ms u) rxomf oytfa eln sls)s2xr(r3iy4lm nliet s a2tm( oou1aptn f3ilt s2ranmpnu4tetrxr iy1fpDraivolt0 2trxm3no4lp  lfetls)s2rmumont0opt  ociadfs um( s;()aetnmf ta1lm  auvo;t) 2toio no1aptn nctlt) 2ta(m ou1aeenmoctltls um(msnt)tetoxr3oytlat luvo (0s2xoxmpoy4om n iciat) 2rmx  nu1texniieiltfaDeln snu)tlxrifciy1op   u o;s t2xr(o3iodale mncta(fsDtm( ono4aet moetysfsDrm(ms;t0tlxnmo3ia1fptraues;(  rtrio ou4lmee ieslsf Dur(  no0tpxnmi3iaslsDem(vs;(0trxrio3ootopD ln i;s trxoxo3oy4apeelfes s s2rmumo;t4oleo i3iltla ulnvont0 rtrirctodfa r ivi t  2tr(rpnydlm nlicslsfsrtmu pnt0olt moctyslm2umnmo u0tltoxocia1omteaivo t0tetmxr oydap  miciatf rrrxmpot1olxn feiad m2ran pnu4 rxoxr iytop   i o;s trtmxr3io4olenlncias artrur no4opt  o3iltlaDrlnvo u0aeeoiocia1lptrauesl() eur(m3oo4lleemnvia( aDtaum no0tpenmietaslmDumn s () rxnio oytla  livs s)sexr(o3oydal n icsltfa2urumono0alt if3iatlaDumn o u)alermrcoodopt ai o;( t2um(rpnu4omt mivtls)arur(monu0tptoiocilslmDra(vs () exoirciytomt aueols)seum(o3oodlmee icsl( sDraxm ;u0tleo i3iatfm2rmu onu0 rxnmfcoytfat lnvilt  rxoio oy1oleemnvs sf 2tauro;t1olxomo3tyt m rmnvpnt)aeeoir oatlpD  ivilt)trto(o3nydalen nciatf Dtrxroou4oetn ieildfaDumnvs;u0aetrxrctadoptraivo;( srtmio3io4aptnmnesasfa2umxrpno4opx moetld sDrm( p u4 eermf3ia1om eau slt0s2uoimpoudomtelnetlt)aDum(r nt1aeen f3iadlm rauvo;()tlenxr oatlmDr i i s t2um(m ou1ap   fcslsfsDtrur ;t4tptomfctad m2el(mo;(0 lxomr3iy1faD lieolt)tetoxmpiudomeemfvilt)s2umumoou1tpeoiieiatfmDumums t0tltrio oo1lpt luei;()trur(m oydlp  lici () 2ra(r ;t1aexomfctldfa2ean s ()tetnmf3oadlatran sl( srxrirpoydlltelfvsls)aDtm(m ou1tleo fciysfa ea(vpnu) etrmfciotop e uvs t sexo(r3iudopenlnvt s sDua(r oo4oetnmiciasfaDemu s t0tlenxo ty1lp rai i s)t2tmxm ou4amtelnei ( a2umxmpno0tex mieilslmDrmu s;u)tleoxf3oa1fp   u slt)s2tm(o3iudap nlivilt) rtmum oo4aptnmfeiaslm ean on() lxnxr tydopt ln i t0 rtrimpou1om e feil(fsDua( p;t4apx ifeiltfa2ra(von(4 rerir3iytlmt  u s (0 rtrio3nudol  livsatfsDrmx  ;u0tpt  i3ildfm2rm(vo;u0tlxnmfcto1oa r ieol() exo(o3oudom e ivtat) 2umxmpot1oee iieiydfa2uluvpnt0arxoxf iotopD auvilt0s2xm(r3iy4lle lieiasfa2tmxmp;u0alenmfeiyd m raumo (0 lxrmo3io1oa   i sls) rtoirpoo4oltemictl( s2taumoou1aetomfeiysls ulnmo;t4arxnxocoadlpDe i slt0tetmxo3iy4oleemictas)srraxm nu1openmfciadlaDrlnmo ()alermrciytlm e iei;(0 2xm(o3oodopen nct t) Dua(rp;u4tlt ifcilsfm2ea( p u0 eeomocio1fate uvi;t)trtmirpoodlmee fvi t)arra(rpnt4aeen ietys m2ea( o t) reomfcoydlpDr neil()sexmxrpoy1apenlfet (farta(ro;u4oexomfctad aDraump;t0 lxomo tytfat li ilt0 rto(r iy1aptelfeiat  Dur(  ;o0tlx  f3iys m rm(monu4 rerxocoodopDrlneslt) rurxm3oy4om elfct ( sDumumo;u1opeomo3iat s umu sn()trxnir3todfa  lneils)t2xoio iudlpenmfvt t sDua(rpno0apeo feiaslaDemums;t0trxnxr3oytlaD livols) 2uo(o3iydap elietl()sDrmxr ;o1tet mf3iydfa2uanvp;t)alerif3io1lp rlneo;t0sruoxm oo4ameemnvtl(  rta(moot4tpt  i3iatfmDrl(mp;(0treoifciadlmt auvo s)s2xmirpiy1am nmncilt a2ua( o;t0ole iietldfaDea( s;() rtrirctotop  aieo s  eurirpiydop  lfesas s2ur(mpoo0apto iciysfm2rau s;t)teermf3tatlpDeln o;t0s2toirpiodalt  iet ( a2ta(  ou0altn f3iadfaDem(mp;t4teenifcootomDrlu s;s setmxmpoy1ol   fvt sfs2tr(m ot4aptn ociyt sDuln o;(4aexnmr iadlmDelu slt)teurxo no4olenmivslt s2uaxrp;t4ape ioetatfa emums t) leoir tadlp   n s t0sexr(r iu1lle lnet (fsDrax  ;u1apxomietysfa ul(mpnu0tlenmf ia1fm   u ols teuo(mpno4lpe  nvt sfsrtm( ooo0teto o3iadfs umn s;u0texoif io1lpt anvs (0srurimpnydalt  nctas)a2raxmooo1aptnmi3tadlm2elumo;u0 reomo iodfp  anei;t trtr(rpoo4openmfvsat)s2rmxrpot4oetn ietlsfmDuaumpn() exrioctadfaD lnvsls srxoxm3no4altn fcs s a2uru  ;o0ope ifetydfsDelums;t0 rtrir3tydoaD aieils trxriopny4ll emfvtl( srur(ro;u0opeo f3iltla elnvsn(0tlenmo3tytoateanes;t)t2umxo3oy1amee icia( aDtmumpoo1tleoii3iysfm2ua(mo;t0 eermf3iytlp  lu sl()s2urxo io1lme lnct s artrxm ot1olx iicilsfs2umuvs;t)trenif todfateauvslt0 eumirpoo4om nmieta(faDurx o;o4aex mf3iltfs uanvo t0tlxoxfctytfptelivs t  2xoxr nu4ll   fct s)srta(rpnu0tpx mfeiyslsDrmuvp (4arxnxf ia1lmt livsls)srxm(o oudape liei t)aDrmurpou1tpe  oetls a2rmuvont4texrio oy1op ean s;()srtoxo3no4optemnesltf 2taxro;o0oee  ietasfs2emuvsn(4 ltrio oydoa e iei;()s2xriopny4apte nctat)srumxmoot1ape mictaslm elumont4 lerirciatomDrau i;s s2xo(opiu4lle  ivtlsfa2tr(r ;t1oet  feiadlm em(vpn(4arenio3iodfmDr ivo;t0srurxopiu1ol nlieta() Drruro;t4tet ioctltlmDem( snt) renmr3to1lmDe u o s tetriopno4apen ieias)sDuaurpoo1alxo feiadfs ulumsnt4tltoxf3iydlm r uei;t s2tm(r3no1open ivtls  rum(  ot0tlenmicildfs2eau s;(0trtrxr oo1lm raneo;(  rxriopiy1ol  lfvsatf 2rrxrono4oexnmfciad mDea(msn()trermfctytfpte uvi s)teumim oo1ol   ivsasfaDta(rono4aetnmocild m rlums t4teeomrcoadfmtrlnvil()sexm(o oo1alte fci (fsrumx  ou4opx iociyd m ranmo u0tlerxr oatfmD  ueo t0sruoio3io4ol  livil(fsrrrx o;u0ole  fetldfm rluvo u) lermf3iydlateau ilt)seuo(o iu1ap elies t  Dumu  no0alx mo3iysfs2em( o;t4aetrxf3oodopt  iesls0tetm(r no1ap e fes ()artm(  no0texomociltfmDuanvp (0 leoxr iydlmDeluvils0trurxopou4altelfcia()artrxm ot4olenmfetatfaDum( s u4 exrxf oy1fa  ln slt0s2toxrpoudll   nesa(f 2taurp;t1tptn f3iydls rmn pnt0aetnifciodfpD li i;s) rurxrpoo4ol  mfctltfs2rrx pnt4olx mo3iydfsDeluvp u4 lxomf3iodfp r ivslt)trumxopnydamtnmfesls)aDuax poo0olxoifciat mDeaumon(0 eenirctodfpD  ies t) 2xoim3oydlme lnvsltfartaxm oo0texomociltfm uln onu0alxoifciotfm e uvo t) rxm(r nu4ape  nvias)arrrurpno1aeenifciyslaDemn p;t0 renxoctadoaDranei;( trumxrpno1am  livi t aDumxmo;t4tetomiciltls2ea( snu4 rermf3iodfp ean i s0t2xriopoy1ole mnetlt)sDtmxmoou0texn i3iyslm2uanmont) lermociatoptelivsl(0 exrim3nudapeelfvils)artmxro;u1aet ifeildfaDem(mo;t4 rxrxf3ia1omDranvo;t  2xmimpoudolenliei t) rtau o;t1apxo f3tysfs ra( p t4trxoxf tytoaDelivi s setoxmpiudlpe  nvs s sDtm( p;t4texn o3ilsls2uluvpn()tetnxo iodlpt lneol(0texmiopoy4alt  nctas sDuau o;o4alto oeiysfaDraumo u4tltnmr3todlmD an i s trxr(r nydale  iei ()artmumpot1tlxomi3iys a2umnvonu0aetriocootfp  au sls  etmirpou1lpeelnetltfa2tr(mpno4tex mi3ild a ul( o (0alxnmfciatfpt  uvsls)trto(r ny1amtelfei (faDraurpno0olxniociasfmDelnmpn(4tleriociytopDran ols srxr(o iy4lle lfctl(  2umum nu1apeoio3iyslm ul( pnt4 exnir iytlp  auvi t s2to(rpnydaltelfetat a2umxmp;t4opxn ociyt a2em( o (4arxomf ia1lmtr nvs s0 rum(mpny4al  licslsf ruaurooo0aet ioeiydls eau onu4trtoxo3iytlptrlnesls)sexrim3nu1lp e nct t  rur(mpoo4apxo o3ilslsDel(vpn(4 rtrioctydfpteai i t0seumxopoudll  mivtltfartau  ot4tpe mi3iytfm uluvp;t4 lxrmf3tatfpDr neo;s sexrxo iydllee nvtltfaDurumpoo4ole ii3iyt s emuvp (0 lenmf tydlpD li s s setm(mpio1alt  nvilsf Drrum oo1tee iocilt m umnvpn(4 ltoxf3iytlpt  u o s)trto(r3iodlme mnet s  Dta( oou4tpx if3ildlm2rmuvo;t)tleoirctotlm e iei t)texoxr iodame lfvsas sDta(moot1tee ifeilsfs em( s u0 lxomf3oy1lpDeliei;s)srxr(o3ou4op nmivt sfa2taxro;u1aexnmocild m um(vo;u) eeoiociytla   nvsls t2uo(rpnudam  mnet t)aDumxr oo4alx iietat mDrmnmsnt)tltoifcoytlpte ivs s srurim3iudamtn nciat)s2ur( pno4oee moeiatfaDelnmp u) rxnio3oytopte i i;(  etrxmpiudapeemnes s) 2um(mp;o1altnmo3iat aDelnmon(0 rtrir3iodfp   nei s)trur(r nodlpt mict s arta(moot0olx if3tytlm rauvp;(0 eeriociadlaDrau i;t)s2xoio oy4ol  mfvi t sDraxroot4texoii3iatlsDra(mo;() exnxo tadoa rluesl(0trxoxo iy1ape mnei (f 2rmumo;t4ale  fciatfaDemnvont)trenir3iatop  lnvslt0t2trim ou1ole lieiatfaDraxmo;o0tpx  f3tydfa ra(vsnt) ltomfcoy1lm elu s s)sexr(o oudopt lici s  2umxr ;u0tet if3tldlm elu o;(4trtnxr oy1laD livo s0seuo(o iy1lp  lfesas a2uaumoou4alt  i3iadfm ulnmo u0 rerircoo1fmt  nvs;(0 2xmio io4am emncta() 2truroou4apxomfeildlmDel(vp;(4tlenxfcoatlmDe i i (0trtoxmpiodlm e ietat)a2umxmpnt4tleo ictydla2ua( p;t)alerxocoadomt lneo;s0s2xoxo3oy4altn ieia( a2raurpoo1aetnmfeiatfa2ul(mo t4texoioctydlmDelu i ( seumxo nudlpt lfvta() Dur(r no1opt io3tys sDemumsn(4texnxo3ootfptrau i;(0 2um(m nudop nmfcsasfsruaumpnt1apen ieiydfmDrmnmo t4 lerxfctytoa   n olt)teuo(r iu1al e icsl( a2rmurpnt1olen iciatfa2ra(vs;t4aexnmo oodfm e ueo;(0s2xo(o iodoltnlivi t a2ua(mpnu1olen fcias a2ua( snu4texrxfctodfa rlneslt0 2um(o iudol emfeilt aDrmx  ;t0optn ociys a2ua(ms (4alermo3tadlpt au slt srxrxo3oy1omt  ivt t) 2rmxmo;u1opx ioctyslsDuluvs t4altrxo iydfmD  ies;()texoirpio4opeelnvsas)srtm(moou0aet mociadlaDraumo (0trenxo3oodoaD  uvo;s) 2uoimpny4lmeelivt ()arrm( pot0oeeoifciysfsDean onu4 rtnir3oytoa elivo;( srxoir oudlm nmfcsltf 2trx  ou1oeeoioetydfsDraumo;u)alxnmfcoodopDeanvi;()tetoir iydap emiviat)srta( p;u1alt moctat m eaump;t4alxomociadfm  aieslt0 euoio3oodap  lnciltfsDua(r ;t1aexnifcildla rmnmp u4alxnxo tytfm rlivi;t)tetoxm nu1omenmici (f 2tmumooo4oeen octltla uanmo;(0trxnmo oydfm   uei;t) rtoio3oy4olenlfviat)aDuau p;u0oltnif3ild s rmn sn() eeomf oatfmDe ueol()s2urxm oy1oltemfct ()aDraxmp;u0altomfeiytfa2elumpnu4alenxrciodfm rlieil()seuoxrpiy1oleemnct t)s2trxmonu0tpe  o3tatfaDrluvp;(4texnio ootfm   u i;t)s2tr(o io4lp emfvil( a2ra(ront1altnmf3tytls uan on(0trenir3iy1omD lu o s)t2xr(r iydlle lnciat) Drrxroot1tlenio3iysla rluvont0treoxociodfmDeln sls)tetrxopio4apen nvils sDua(  nt0olen ictldfs em(vonu0aetomo3tytfaDeanvil( sexm(mpnudlm   ncias aruax pot1openmoeiys m2emnvsnt4 rtomfcoodla e ues;() rurxo3no1ope mict t)srrrx pnu4altomfetldla2eaump ()texoxf3iotoatraivo t)teumxrpno1ol nmictasfsDum(r nu0aeeomictas aDel( onu)areoirciytfp e nei;( teto(o io4lltn ivi ()aruaxronu1teeo ieiaslaDrmnvonu)tltomocoadlaDe uvs ()srtrxopoydape  neil( aDrmu oou4oex iieiltlm2em(mpnu4aexomo3iydfmD  uvo s  etmir nu4lmt mfes ( a2uax  ;o1olxo feiadlaDel(vo;(4 eermf oa1lpt  neilt0setm(o3ou4lpeelfcilsf rur(mpno0ale  f3tys s ra(vsnt0trtomrciotfatrlnvolt) ruoxm3oudlme mfvi sf 2um(moou0aptn fetlt m ul(monu0aetnmfcoadomD lneo t)s2tmxopoudalte ict s aDta(m nt0tlto fciydlm umnmon(0 ltoifcoydfaDe neils  2toio oy4lpt livs sf 2rax o;t4tleomociys m ra(ms;u0 exrxo3tadlp elueo t)texrxm nu1lpenmfeil(fa2uaxronu0tpt miciaslsDemuvs;u0arxomr oadopD  nes ()t2xoxmpno4apeelics ()sruru oot0oex ifetys mDra(mp;u) exomf3oo1lptrluvols srtmirpou4lltnlncia(fsrrmxroou4oetn iciasla rm(mp;t0 lermr3io1oaD an s ()trxmxopnu1oltelneil( sDuau ooo0apen fciytlsDea( snt4tlenmocto1opDeai s s srxoimpny1ape lnvsl(  rrmu oot0alt mo3iltlsDem(ms u0aetoif3tydfpDrlivo;s) rurir3io4lp  mnci s)srrru pot4opxo o3tldls2em( o;() lxoxf oodomDrlu il(  2urxmpio1al nmncs t)s2ra( oou1tee mo3tyt m rl(vp u4trtrxr oatopDrliesls0seurio3iy4lptnmics (f rrmu  nu1aee  i3ildls ul(msn(0tetnmf oa1fpDr u s t0 exoxm3no1ol n fci (  Drr(mpnt4aeen i3iatlmDrl(mo t4 rxnmrctatfp rluvi;s)t2xr(mpny1lpt mfvils)artmx p;u1tleoiietyd s2ulnvp;(4tleoxr ty1faD aivo t)srto(o3oodlptemfviltf rumur nu0oee  ocildlsDranmpnu)texnmrcty1oa  li i;s)s2ur(opoo4om   fvslt) rum(rpnt4oetn octyd m2rmn s;(0alxoxo iatlmt ai s;s)trtoio oo4open ieilt)srrmxronu0tlto feils mDua( o;(4alxoir3iy1fpDrliei;s)setoimpou1omenmnvtlsf 2uaxr ou4oleo oeiyt s umnmp u4trtrmociydlmD  ivi (0tetrir3nu4lm nlfvsas s2trxmono0tltnmo3tld a2rauvs u0texoio iy1fp  anei;s0trto(opoy1alenmivt ()sDtmu  ot4altn f3taslsDrmnvon(0 rtrmr3iodlm  an ilt t2urxr ny4lle  ics t srta( o;u1altnmfeilsfs2uanvs () lenxo iatlmD au s;t srumir3iu1al n feta(fsrurxrp;o4tltnmietld sDranvont)aeermf3oa1fptr i o;s)truo(r io4omen icslsfsruaum ot0opxn oeiytfm2rlnvo;u) reoxf3oo1omtrai s;s) rxrxmpoy4ope  ncsat  Drmx  ou1aetnmf3iyt sDea( sn(0aetoif oytom  an olt srxoimpnu1ap  mfcsl(fsDra( o;u0aptomoctydfs2eauvo (0arxomfcoadfmtelu slt) 2xr(opnudoleelnes t)sDuaxrpot1aee iietltlmDum(mo;u4tlxoio iadopD livs t0s2tr(m nydopen ivta( sDurumoot0ape  o3iasla eauvp (0 lermr3oytfaDr nei;t)s2umxo oy1apte netl(  2rmurp;t4apx  ictaslm emu s;(0trtnircootfmDeluvo;s0t2tmir3oo4lpt lfvsa()srtauroou4tpe iieiadlm2eaums (0 etoxociodopDr i ilt t2urim3iy1al  mnvi s)srumxmpoo4aeto i3tltlm2ul( snt0 rxrxo oa1fmt au o;t)s2toim3oy1ame  ieil()artmump;u4texnmf3tydls um(ms u) rxrxf tydop r i i () 2xo(opno1alenmivsat srua(r no1tlt ioeilsfa2elu p t) eeoif3oa1lm   ivs t0trtmxo3io1llee fcias)artr( ooo1oeto fetas s ea(ms u) rxoxo tytoaD  n sl() euoxrpio1oleemivilsfaDrmx pno1aexo i3tyslmDulnmp;()teermo iotlmt  iei ( s2xmxm nu1ll elneils  Drr(m ;u1tlen o3tydla2eauvs;()aexomo3ta1fm eli s;() rtoxo oodoptnlicias)sDua(rpno1tee  feiydfs rluvsnt)trxnifciydomD an ol(0 2tm(r3iu4omt  ncsa()sDua(rp;u0oexnmoctys aDrm(vs u0alerif3ty1fate ivs;(0 exrir3oy4ol   fvslt) 2taxr nu1tltoii3iasfm2eaump;u)tlxnirctadfmteln olt) 2xmiopno1lpen fvilsfsrtmu o;t0tex ioctyt a2emumpnt)altrmr3oa1lmDe u i ()s2tr(mpiudlptn feia(fsDtrxmo;u0tptn i3tadlm2ua( p (0 rtnirctatoat lies ( t2trxr oodolenmneil( a2trxrpno4opeo i3ildfaDeauvo;t) rtomf3iodfp  lu s s) rtrir3ou4amtelnvi t  rumu o;t1tptn i3ils sDrmn p u)aetrif3iytfmt  i ils0trtoxm3oo4oltnlfviat s2um(r nu4tlxnmfetlsfs2raums ()trxrxr ia1fa r ieol( t2xo(r3nu1ameelncsasfartm(mpno0tptn icildlm eau on() lxomr3ootfpDe ivo () 2um(o oydal nmiesasf Dtmu  no4aleniociasfsDumu snu)tleoxfcoytfmtranei;t0t2xr(m ou1lpt  nvi sf Dtrxmpnt4oet if3iys s emuvo;(4aexrxf totoaD anvo t seumxopny1ll e ncs s)aDumx onu0oeeomf3iydfa ra(mpnu4tltnio oatfmD lnvils0texr(m iu4oltnlfet ()aDtr( oou1alenmoctysfa umums;() rtrxr3oodlmDr u i (  2trxmpoydom n fvslt) 2rau  oo0tlxomo3iaslm2rluvo u)artnif3to1fmteanvi t0srxr(m3iy1ole  feil( srum( o;o0apxomi3iytlm2eaump u0aexnmo tytlmte neil() exoxo iy1lptn fcsas  rrrxmont0oexnioeiasfs2umumo t4texnifcoa1fa  lu olt trtoxm io1lpt  neiasfartau  nu1aexomf3iytfaDeau s u)tlxrif3totlp r neils0s2xrir nudamtnlici sfa2ra(monu0tlt io3iatls ean s t4treoio oy1la elneo s)t2xrxo3iu1opte nvsat) 2rrxr ;u4oltomiciat mDrlnmpn(0 ltoxfciy1oatraivolt)srtoir iy1lle  fctas a2rrum nu4openif3iadfaDranmp;u0aleoio oa1oaDranvo;t) euoim ou4op emfvslt)a2rru ont0aetn f3tas sDumums t)altomf3oy1lptrlueo t0seur(opnudllenmivsatf rta(mpnu1tlxo o3tatfm emums;(4tltnxo3oadla  aiei;(0 etr(r ou1amte fctatfarra(r oo1tle iictlslaDrmu p;u)aetrxf3oa1fate ivi;s  2umio nu4lm  livilsfarra(r ;o1alxo ociytla eln o;t4teenif oydlmtelivi s0s2xo(m3iy1al e ieia()sDurur ;u0tlenifciyd a2ra(mp u) eeoir3tadfm r u i ( texo(m iodlmtemivil()arta(  ;u0tlx ii3ilsla elnvpnt) lxoio ta1oa   i o;s)trtmxo3ou4lp elnvilsfaDrmx poo4aexnii3tld mDemn o;t4artrxf3tydlpDranvols sexoirpoudapenmfvsat) Draxmoot4tetomocilt a ul( s;t) leoifcia1opDean s s)t2xrim3iy1ap n neia() rtruroot4oltn i3iysfm2rauvpnu0 rtnmoctytlpD livi (  etoiopiydap  lfetat)a2ta(mont1optnif3iydfm2emuvpnu0 reoxf oydopD luei (0 euoxm3no1olt  ncslt aDtm(moot4apxnmiciytls2rmnmonu)tltnxo iodopDrlnei;(  eurir nu4lm  mnvias sruaumpnu1openii3ildla2eanvp;t0 lxomr3totfpDelies (0srto(r3iodaltelivtl()srrr(rooo4apeo i3ildls rauvpn(0trenmo3iydfaDrai s (0s2uoxr iodam  mfetlsfsDtm(  no1aexniictydls rm( p;t4alxnio iotfaDrlies;s sruoiopoydopeemfvtat  Durxmoou0opt  i3iat mDrl( onu)aetnxrciydlmDelieo (0s2xr(r ou1optemncs s arrrx  no0aleo oeiydls emumsn(4 exomf3iadlp r ueo s)s2toio3nodll emfetas) 2tru  no4oleniietyd s2um(ms;t4teeoiocto1oa ranvo t)trxoxm nu1amenlnei t) rtmurpnu4tlt ifeiyt a el( p t4 lxoif3tydlm   uvs;t0 etrxopio4al   fctls) Dua(moou0apenmieiadla eaumo;u0 exrmr3tatomt lnesls)t2uo(m3nodom  livias  rrmxrono1tptomociasls2ua(mpnu)tltnmr3iytom rauvilt0srumim3iy4apeelieiat  Dtr(r nt0tex miciyt sDea( o u0tlxnirctodoaDrauvi s  euoxm3oo4opt  netlt)artrur nu4olen o3tlt a2rm( s;u0artrio io1la  au olt) rtoxo iy1omtnlncs (f rrmump;u4apxnifcilsls2eln o;t0artnircoa1fat luvil( s2tr(rpoo1amenlies s  2ur(mont0aptnmocildfs uanmo (4trtnmf3tadfmD an ils s2xr(r ny1amt  nvs (fa2urxm ou0apxn oetas a2rm( o;t4alxoxfcoodfm rlneil( tetmim3oo4lp n ics ()sDtru pnt0apt io3iytfm eluvo;u4aetoir3oadlmDr u sl( trtmim3nudll  lietlsf Dtau  no0tlxnmo3tasla2ua(mpn()tetoirctodlpD auvs;s) rurir nudll e nvi (fsDtrur ot0tltn ietydfm2rl(vp u0tlenif3iodlmDe u s t trtmim3io4lp  lfvt s)aDrmxr ;o1altomoctasfsDrlumpnt4arerxr3iotomt auei;()seumxr oudllee netl( a2rrumpot1texn f3ilsfmDuanmp u0artrxo iytfmt aiei;s) 2toio3nu1opt  fvi t)aDururooo1alx iiciat s elnmp;()alermf tytlp rlnes t truoxm3io1altelfcsat)s2um(rpoo1olx mo3iyt s emuvs t)areoifctadoa eaivi t)t2xm(m nudlpe lnvias)aDtr(r oo0opxn oeiyt m um(vsnt0altrmr3tytoa  anvs ()setm(o3nudol e ies tf ruaurp;t1altomo3tyt aDraums (0 eerxrctotlp rau i t0 rxrirpnodlpenlneilsfs2ur(r nu1aeeoio3ilsfm ua( o;t0altoif oytfa   i sl(0setoxr iy1ll  mfet ( a2tax  ;u4apx ifciaslmDuan o u4aetoif iy1lptraueol(0 rxmxo nu1lmtnlivtls)sDrr(r nu0tpeo f3iat a2ean o;() rtnmf oatfmt livi (0 2xoxrpoo1am   ics t  2rmxrpnt1oee ioetltfaDrmn s (0tetnxo totlat  ies t0teuoxmpno1am nmict s aDtm(ro;u1oeenioetldfs2umnvp (0trxoxrcta1opDranei s0 eumxr3nu4llen feil(  Drmxmp;o4tpeo i3tltfs rluvp (4aetnif3oodomDraneo t t2xrir oy4omenmnctlt)sDurxrono4aeeomi3iat m ra(vp () rxoifcoadlp elneils0 etm(r no4altelict tf ruau  nt1oexn i3tydlsDulump ()tetrir3ootlpDranei;t) 2ur(mpny4amenlivsa(farur(r ot4tlxniictydfmDel(msnu4 rxnmr tytop eauvo t srtm(rpiydolenlnvs s  Drru o;o1apxo ictysfm uluvs u0tltrxoctadoa e ieo;t)teumim3oodop   net s)srra( oot4tlt  iciaslm2rmu s u) exnif oy1lptrlnvs t  exrxopoo4lp elfvtl(  Drmxr nu0olxoiieilsfm ulums;u4trxnmr oytomDe nvsl()t2tm(r io4amenmiesa(  Dumumo;o0tpe ioeils s2el(vsn(4trxrir oo1oaDeln sls0 euoxm iydale  fvs tfsDtr(mp;u0aleoiieilsls2um(mon(4arxnmf3totfp eaivo;(  rxoir3iydlmen neils  rrax  ou0tee ii3tadls ean o ()arxoircty1op rlivi;( setmxo3oydlle mivtas)sDrmur ot1teeo f3iltlmDemuvp;t0tlxomr iadfmDeauvo t) rtr(m3nydoptnmivi (f Dtau  nt1aeen fciyslm2umumo;(0aeenio iytlaDrauvslt t2xrimpiy1ll elivia( artrur ;t4apxn ictydla ulu o;u0artrir3oy1fat li s t0sexo(r3nu1lm   ncta(  2ua(moou1tpxoifciyd mDulu p;t4tltoxr3iodopteln s;s)srxoxo iy1lpe lfesasf Dtruronu1oeeomf3ias mDua(vsn() exniociy1omDeli ilt) rxmir3ou4olen icias)s2taxr ;u4oeto feilt s2emump;t4aeenmf3iydlmDrluvil()trtrir3nu1op n fvs t) rta(rooo4teenmicildlsDuanms t)areomr3ootfaDr u o s)s2xmir nu4am elictls  rtm(r ;t4tle io3iltfs2rauvo;()aetoxf3ia1op eau i;(0truoim3ny1llt  fvilt) rtru p;t1alxoifctyt s ul( s ()altniocoodfpDr uvilt0srurxopno1optelfvt s sDur(m ot1aptomfciytfaDeluvo;t4aetrmr oydfaD  uvs;t0s2xoiopiy1lmeemfesls artrx poo0apto feiadfa2um( p;(4tlxnxfctotfat aies s  rxoir3io4ape micta(faDtmur ;o0oee if3tatls2em( p;u0 renxo3iytfmtrauvs;t srxoio3iydomtn feils)srua( pnt1oeeo oeiadls2eauvp t0 rermf ty1lmte nvo t teto(opnudaleelfvslsfa2rmu oou4tlx ioetad mDra( s () exrmo iytlatr n i;s0 2toxrpno1am e nvs t  rtaumoot1tlxniietyt sDeanms (4 ltoio oadlptraiei;s s2um(o iu1om   fvia(farum(ro;u4oexo oetyslm2emuvpn(0tltnifctodfpt anvi s trumio nydape mieslt) Dtrxrp;o0tpxnifeiytfm2emn ont0 eenifciodfmDraivo (  eum(r ou1openlici s)a2tax  no4optoio3iytfa2el(mo;u0aleoxf3iy1fp elu s s)srum(m oodom  lictasf Dumur nt0tpe mo3tytls2eanvp;u4 lermfcio1fm ran o s  2umirpoydam n ietls)arrm( p;u1aeeoiociadfm ul(vs u4texnmf3iadfa eanvils sexr(o oo1ll n nviltfartrx p;u0tex  f3tld s2el(msn()tltomf oy1fa eli ilt)sexr(m iydal  mietat) Dumxr ;t1teenmicildfsDrlums (0 ltrmf iytfmD au olt)srtoxo oy4ll e nvta()aDtmum ;o0alto i3iyslm2rm(msnt0tltrxf3tydfm eln s t  exrir3iy1lpenmivsl() rururont0aex mo3iysla2rmn p u4 rtoxf oo1om   n o t0t2uoio ny4ale  icsa(faDumxm ;t1texnmoeiyslm2eluvs u4trxrmf3totfptraiei (  rtmim iy1oltelivs sfs2umx pnu0oltoii3tldfs rl(vpnt4 renmrcoydomt  uvs;t0s2xoxm iu1aptn neta()a2tmxmpnu4tle mictat mDra(vsnt) lxoxo oadfm eau i t)teumxm3no4ol elnes t) 2umx p;o0tpe  i3tltfm eanms t4 rxrmo totfpDr uvi ()s2trxopnodlmtelietas srumumoot4olxnifeilsfaDeanvont0altoio tatlmD au s s0 rtrxr nudam n nvtltfa2uaurpou1tlx mo3ilsfs ulump t)aetrmr oadoaD auvsl(0tetmimpnu4aleemnvtlsf rtmxrpou0opt mf3iad sDrmu s () rxnmr tatom eluvols) 2xo(m oy1amt mfvtlt a2trumonu4oltomoeilsls rmn on() rxoif3to1faDe n s;s t2trxr3oo1olen fei t  Dtr(rp;t1opxoiiciyd s emu s;u4 rtrmocta1oatelueo ()t2xm(opiy4op  lfeiat  Dtmxmoot4olt mociasfm2uanmo;(0tleoif tytfatran slt0 eto(rpoodlltn fciat a2urxrpnu4opt  feiasfsDulumpnt4aleoxr3iatfa elueol()teuoir3no1llt  nciat srtrxrpnt4ape mo3iydla2emumo;t)tetoxr oydlmtranesls) 2xr(m nodapee nct sf 2trxro;t1oexniiciydla um( p;(0tltrir3iy1oatr ivo t)srurxrpiudlpt mfeslsf 2uaum ot1ape miciasls2emuvsnu)tetoxfcio1lm r uvo;() ruoim nu1lltn ies s a2tru  no0aee iociydla eanmo;(4altoif oadoptrlnes () rtm(r io1om  mnctls)srraumo;o1oeto oeilslaDra( p;t)tlxrmfcoa1fa e u s;(0t2xm(o oo1ap nmnctasf 2uaurp;t0ope if3tyt mDrm(vp u4 ltrmo3iadfmD an s ()s2xo(o nu4lme lfvsas)a2ua(ro;o1tptomo3iys mDemn sn(4 rerxf iotla r ies s srxrir oy4lm  mnvsl(fa2ur(m ;t0alenio3tadfs2em(vs;t4arerif oodlmtrlieo;s)t2ur(m3io4ap nliet (f 2uru  nt1apxnmieias s2el(monu0 eenmr tatfpDrliei;s t2xoim3oy1oltnmivs t srtru  nu4ope  ictys a2ul(vs;t0 eeoxo oatlmD  u i t)trxmio oo1ll nlfviat srtmxmpnt4tex mfcias sDrm( 
\ No newline at end of file
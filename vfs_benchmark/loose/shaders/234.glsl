@@ -0,0 +1 @@
+ies;s)srur(mpio4aleemfcta(f 2rrxmpoo1opx mfeils mDrmnvpnt)alerio oo1fmD an s;(0s2xrxr oy1ameelneil(  Dumxrpoo4aeeomociad m uan s;u0tleoirctodlp  ln i;t) etoxm no4optelivt t) 2umu ont0apxn ictldlsDrau p u0arermr iodomtrlivil(0 etoxo iydlptnlfvt sfa2rau p;u0oexniietysfa2elnvsnt0tlxrxociytfa eauvo;t)sruoxm oodopeemfct s  2ua(mpou0tetn o3iyt sDeluvs;(0alerxf3oatomt li ols) rxo(m3ny4op elivt s)s2ta(m ou0alto ocilsfsDum(vs u4artnmocoy1op raivsl(  2to(opiu4am nlivsls)srumx  ou1oeen oeiydfm ranvo;(0artomo3oy1fa   ies t t2xrirpio4op e ncias s2uaxmpnu4teenmfciydlsDuauvo ()altrmfciodfmD li s (0 rur(r iu1opt lneias)a2umxm ;t1apxo oeiys sDemnvsnu4tetnioctotfp e uvo;(0 2toxm oo4lltnmnvt sfarrm(m ot0alxniieiytls el( o u0 leomf3oy1oateliesl()srumimpoydameemnviatfsrtmxm ;u4ape mfeiyslm ulnvs t0teerxrcoo1opDr u o;( seurxopiudlp n fci t) Dur( ono1tlxo iciad s rm( on() reoxo3tydfpt lues ( t2tmiopiy4olteliet s) Drrum no0oeeniieiytfs em( s t)artnmo iytlptrai sl(0 2trir oo4amtnlnvtlt)aDrm(mp;u1apt  fctatfm ul(vo u)trtnmo3totomt livilt)t2tmxmpnodopt lnct s)sDumum ;o1aleoifetldla ulump;(4aleniocoydfpte nei;t t2to(o3oo4op nmict t aDrrumpou4tptoifctatfm2eanvs ()tlxoxr3iodla elues;( srumxr io1aptelivta()srtm( pot0oetnmociadfm2umn p;(0 exnir3ia1fatelueilt s2tmxmpoy1opeemfetatfa2ta(moou0tex io3tldlaDem(vpnt)treomf3totfp r n sls sexm(r3oy1optemnct t)a2tmumoot0tltomf3ilslmDemuvo u) etnio3to1omte nvo s0s2toxr oy4ol emfvsltfaDur(mooo1tptomicildfm rmu sn(4tlermf3iodlpt  ies;(0 2xo(m3ou4llt mict s  Drmu pou4oexn fctat mDeanvp u0alenirctodlm   i s;s trxmim oy4lm emnvtatf 2ua(mo;t4tetn i3ildlsDea( s t0artnmoctytfpt anes;s)t2umxrpnu4apenliesat)s2tmu  no0oee moetad m rluvs;u)texoif3iatfpDean i s  2uoim3oy1alte neiltfsruaxm ;o4aeeoio3tyd a ul( o t4trtomocoy1omDelnvs;s0 exmxr iy4op elnetltfs2urx oou1aleoii3tas s ea(mon(0 etnmo oa1fmt  ivols s2xoim nudoltelies tfsDrmx pot4ole  oeiydlmDrlnvsnt0 rxnxo iotfm rlnvs t0s2xr(rpny4omte ieilsfsrrax  no1altoif3tatfs ran s (0tetoxr3tatfa  au olt)trur(m3no1lp elfet s  2raxr ou0opxoiociyd s rluvo ()treoxf3oadoaDeanvi s)tetrimpnydlpe  fvtat)aDrrx ooo0ope  i3iyd m2rmnmsnt4trerxr3ty1oaD  u o ( srxoio iy4lmen iesat a2umx  ;o4oltniietaslm2eaumo t0texnxocoytomDeaieo;s)s2xoxo iodaptnmnct ( a2tm(m ou4tlxniicias aDuanvs t0arxnmr tytla r u o t0 2tmxm3io4aptelfetatfa2tmx o;o0apxnif3tldfsDel( p;u) rtrmr oodoa elu s t0srtr(mpoydlmte fesltfaDua( ont0teeniietatls ulnvs (4alenxo iodlmtranvolt)s2xmir nodamte fei s) rta(  ot0olt ifeiadlsDuaums u0areoir iodom eauesl()srxmim nu1lp nmneslt) Duru pou1olenii3iadla em(mo () exrio3ty1faDe uvi s0trtm(r iydaptemfvia()s2umurpou4oeeoiieilsla elump ()tetrircoa1oa eauvs;( t2xoxrpoudll n nvs sfsDurum no0tet ioetaslm rmnvp;()aexomf oatfat ai sl(0t2tmxopiy1lleemnvilt a2trxmp;u1openmoeildfs2raumo;(0 lxnmfcoytfaDe n sl(0 etr(r3oydol  mici t srtmxmp;t4opxn fciydlaDulu s;t4 rtnir oa1fmDran s s s2trir3oudlltn nci t artrxmp;o0altoif3iysfa ul(mo (4tlxnxr3iydlaDe i i ( t2urxmpio1op n icsat) rtruronu0oltnmieiadlm2eau on(4aexnio ty1omtrluvs;(  rumiopiudalenmnvsat  2rax o;o4tptn fcildfaDrlumsnt4artrif3oydoptrlnvi t)teur(o oydlp nmieta(f 2umu  ;t1oet  fctldlaDemn s;()altomr3iadfpDr neo;(0trtrxr io4am  mivtat arumxmo;t4altnmfcildfmDea(mp (4 renir ia1lm r i sl(  2xm(o iu4optnlfvi tfaDra(rpoo4olx mo3tydlsDulu pn()tetnirciadom   ies;t0s2toxr nydap elfet t  ruaxronu4aeenif3tlsfm ua(ms (0tlxnmo3tatomD  ieols) rtrim3io4alt  ncsl(f ruax p;u4aetoiictlt s elumpn(4 exomrcoydlatean o t setrxm ny1omeemieils  Dua(r ou1oltn fctasla uanvont0altomf oa1fmD livilt)seurim3oy4apte nctlt  2raxm ot4tex  fctysfaDuaums;u4aexnmo iydla rauvi;s trum(rpiudlmt  fvi tfs2uaurpot1tlxoifciatfs rmuvp;u) eeomfcoadlatr n i;t0srtoxm iodlmee icsas aDtm(m nt1aex mi3iyt mDemumpn() eeomrciadfatrlnvilt) 2xoxopoy4am e netasfaruauroot0tltn fctltlm eln ont0altrxocta1lmDe u ilt s2xoxm ny4lmtnlfeslsf Dur(  no4tle  feiadfaDuanvp u)trtoxfctotlaDelieo t) euoim3iudlp   neta(f 2ur(mono4oeen feiyslsDemu on() rtoircta1oat  u s s0t2toio oo4alt lnvils sDtrx  ;u0tpeo ictas s ua(vp (4trenmo oodlp e nvs;s  rur(mpou1opeelnvsa()aDtax  nu0oetoifeiadlm2elu p;u)alxnxf3oytfm e nvi t) rum(mpoudoltnlivtltf ruaxmpou4openii3iadla2eluvp t) rtnifcootfat ai i;s)seumirpnydopeelfei t)srumx pou4opxomociyt mDemuvp;t4 rxomo3tatfa  lu slt) 2trxopoo4aptelfvtlt a2tmxrp;t4apxniieiyslm2elu o;u4tltnmfcoatfptr nvilt0t2toir nu4llee ivtas)srtaxr ot0texoii3iatfa el( sn(4 lxrxr iotomDrln il(0srtrio ou1oleelfvsas  2umuroou4texnmocilsfm2ua( pnt4altoircio1fpteauvolt sexr(o3iudlmt  fctlt aDuau pnt0opto ictatlmDeluvo;()tetrxo3tadomD  nvs t0t2tmxo3iydom nliviat  2ur(mpnu0tpeo f3ilslm2ea( p;u4teenmr iytopteaiei s  etoimpoodlpt lnvt (  rtm(m ;t0tpe mo3tytlm2rl(vp (0trxoxf3to1fpDeauvil( s2xoxrpiudll n fet sfa2ua(ront4olxn fetatls2eanmo;u4 etoir3tatfpteai o;s0teurxr oydll  mfeil(  2uax o;t0olxn ocilt s ulu pnu0teeomoctotoa rlnvols0 exm(rpno4opt  fei sfs2raxront4tleomoeiatls2um(mp;u4 lxnmfcty1fpt  neil( srumxrpnudlm  lnet t  2rr(mono4oeen o3iasfm2ea( s (0trermr iydom   neo t)tetoio iydam e fvt tf Dtmx  ;o0tetnifeias a uau s t)treniocoydfatelivo;( s2toim oy4lp nmfcsl( aDtm(m nt4alx mieilt a rmnmp;t4tleoxf3tytfp rau ol( trtmxrpnodapt mncslt)aDtm(rp;u4opxnif3tydlsDumnvpnu)alenmr ia1omteaueo s)t2tr(mpoy1llenmneiasfs2tmx pno1alen ietlt m2umnmo;t) etnio3iadoaDe u s ( tetr(m ou4lpe mfct s)sDurumoou0apx ifeiydls2uauvo;u) etoxf3tadfatrlu o;( s2trir3nodamtemnesl()aDrrxrpoo0aexo ictyt a um(mp;u0trtoio3iy1lmDraneils texriopnu4omtnmict s sDumx ont4oeto o3ildlsDeln ont0artrxoctadlm r u ils) etrxmpnydlp  mfvt t) 2urum ot4tet ioetlslm2ul(vsnt)aeeoifcoy1omteaneo () 2xrxm3iu4lpe mfcslt a2taxro;o0tlxnmfciat m emumo;(4aeenxf ty1fp raneils trumxr3oodal nmfviasfs2umu poo0tpeomo3iadfs2ua(ms;u0trtrmf to1om e i sl(  eto(o3iodllt  nvtatfaDra( o;u0texnioetltfa emump;(0 eenmo totlmt auvo;() rtmxo3nodam elics t) rrrumo;t4texo fciatfa eluvs;t)tlxoxocoadoaD lnes;()t2xmirpny4ap n nct s  rua( ooo0aleoii3iasfsDemnms ()alenir3iy1lmDr i i s texoir iy1lme  fvi t)arrrx pno4tpx  f3tlslmDum(vo;()aeeoxocty1la eln s;s truoio oydlpte fvi () Dtm( onu4aex  fciyt a2elnmo u) etoioctytlpte ivilt0 rto(r3ou1lptelfes s  2rrxmpou4oltniieiytla uau pnt0artrir3tytopt luvils srtrirpny1lltnmnvtasf rua(rpnu4apeoioctadlm2ulnvs;u4 ltoir3iodlatelnvo s)s2tmim3no1lpt mfeiltfa2tr(ronu0oetnmf3iytlm ea(ms (0texriocoy1lat  ies t) 2trio iy1al e netl() 2rrur nu0oetnmo3ildfs2em(vsn(4texnio tadoa e uvo ()s2xoir3ny4ape micilt)a2tmxront4ole moeiltla ranms;t0 ltrmfctotomD ln s;(0 rxoir3io1al emfci ( s2uaurp;o0altoiiciadfm eluvo;(0trtomf3tadoatrlnvo s0s2toxmpiu4lpt  iesls)s2trurpoo0tlx  fetldfa2emu p ()alenmo oa1lp e nes s0t2triopiy4llt  icilsfaDumxmpot4aexnmocils m2eau p t) etrxf oo1lpt  nes;t0 2tr(r nu1ll emncsl(fsDtaxrono1olx  fciat mDra( o t0aetrxf3oo1optrau ol( trurxr3nodlmt mivias)aDtax  no4aptn iciatla2rl( s;t) eermrcto1faDelueo;(0tetrim io4oleelfesas aDtrum ot1openmiciyd aDulnvp;u)tlermociytoaDeli s s0seto(m3iydlmt lics s  Drrurp;t1alxoio3ilsfmDelu snu0 etomf ootop eluvsls0trtoxo3iudapeelfei tf 2rr(rooo4tleomfctytfs ra(vp u)aetnio3iadfpDr u ils0srtoio ou4lltnlnct s  Dta(r ;t1aet ifeiasfmDulu s u4tlenif oodfaD  uvo;s)trtoir3nu4openlfvta( aDuax ono1tpt  ocild s2umu o;t0tlenifctadfp raieils) euoimpou4open fes t  Durxmpnu1olxoifetas s2ulnvo;t0 etrxfciydfa eaneo t  rxr(m ny4altemieilsfsrra(r nt0olxomoctydfsDuanmpnu4aexnif ta1fmD an sls0seuoxr oodlleemiei tfartaxro;t4tlx mfeiad a eanvs t0 rtomr iadfaDr i s;t0 2xoim3ou1lp e nvsltfaDrax pno1tetnio3iatla2emuvsn(0aeeomrciydlmDelivs s)setmxm oo4oltnlneiat s2uru o;u1oltn o3iydfa2rmn p (4treoxrcoatlmtraivi;()seuo(mpiodop   fes ()a2rmum no1tpxnifctld a2rm(ms;t0altrmf ia1fmt luvo s texm(o iy1apeelnetlt)aDrau  ou1optnioctlt m uauvo;u)alerxociytlp eauei;t0srxmimpno4lle lfvtasfa2rmxm ou1alt  f3tasfm2umnmp;t0aexnmo3iy1fm rlnes;t0 rum(m no1ape micils s2trumpou4altn iciydlm rlumpnu4aexnxocoodoaDrai s (0trxoiopiy4lp   fctls) rtrum nt4oexoifciyt a2rlumo;t0arenmocta1op  li ol(0trto(m3oo1ame lfetlt)a2rmxmpot4tex  o3iadla rl(vo u0 lerxf tydoatraieil(0t2xmxrpiy4olen fvs (f 2rrxr nu4olt mictatlmDumu on(4trxomr tadlmteauvs (0setrxm3iy1op  lncs t aDtau oot1altomf3ilsfmDua( o t0teermocia1fm rauvilt0t2xm(r oy4ll elnes sfsruaxroou1oltnio3iat sDua(mp;(0alxoirciadfat  uvs;t)s2xo(m3io1lmte nesltf rrr( oot0aet mociatfsDrln o u4alxrxo iadom  auvs;s0trtm(o3nu1lmtnmnviat  Duru pou1tlt  ictlsfa2rmumo t4trxrmf3to1opteln slt)srxr(rpiy1altnlictat sDumx onu1tpxoifcilsla2rm(vs;(0trxrmf3oatop eluvsl( s2urxo3oo1lp elnvsat) 2ur( ont1tlxo o3iltfm ran on(4 ltrio3todlmtrlueo;s0seuo(m io4lle  nvt s arra(rono1ope ifetyslaDrlu s;t)altrmo3tadlmDeaivi t0srtmio3io4omeemfvilt) Dur(mo;t1aetomieiad mDeln s;u0tlerxf iy1lmte ueolt0texrxmpou4omt  fci ( a2tmxmoou1tee  feiysfsDeanmp u4 reomo totfptrai s s s2urirpiudal nmiesat srrm( o;o0aex ifeiad s2em( s;()arenir3iatfpt li s;t)s2toxmpiy4ol e ivtls)a2raxrpno1oexo f3iysfm2ea(mpnu0aeeomrcoydfa r nvs;t)srxoxr3no1am e fes (fa2uaxmo;u1open f3iyt mDem(vont0 eenxfcia1lpDelu ols texmxr3iydapt lnvt s)s2rmu pot1oleo o3iatlsDea(vsnt) exoxr totlp  livi t0sruo(r no1alee icsl(faDrr(rpoo0oet ifeiat s2ra(vo;(0 eerxf3iatla e n s t0teuoio ny1lmt lfcil(f rtm(r nu1aleomicild sDel(vp u0 rtomr3ia1fa  lieol( s2xmirpiudal e ics t  rta(ront0tltniietadla rm(vo u4 rxnmfcoatlpteauvol(0teuo(mpiy4lltemfes () Drmump;o1openmo3iatla2uan s (0aetnif ty1fpD anesls0 rxmxo nydlmtnlicia(fsrraxro;t4opt if3tad s rmuvo;t0alxrmr3oa1fat  n s;s0texr(r3nu1ole  ivsltf Dur(m ;o1aeto fciltlaDrm(mo u) exnio ootoa rlnes () rtm(o3oo4amen feias  Dtrx onu4tetnioetldfaDea( snt) ltrxociodfpDelu o s)t2tr(r3oydam   nvtat)arrrxrp;u4aetnmfciadlsDean s;t)alxoiocio1fpt aivs ( srto(r iu1am emfeilsf rur(r ot0texoifciyd s elu p;u0tltrir3tadlpt  ieilt0t2xrim oydolee ies ()s2rru  nt0aexomoetadfaDua(mp t0trxoxo oo1laDrlies ()trxo(m3oy1aptnmfei (fs2tax  ;t1opxo ieils s um(mpn(4 rxnxo3ia1lpDe ueo s srxoxr iydapt  ivsls  rumx  ot0alx iiciytlmDuan onu4aexoxfciy1lp eluvs;t0s2uo(o no1aptemivt t artau p;u1oexnif3iatlm2rmuvsn(4tleomfcoadfp elueols0texrxrpoydlle lneils)aDrr(mo;o4olx mociyd s2rau s;t0 rxomfciotoptraies s)t2toir3nudapeelieilt a2ur( poo1altomf3tadlsDrluvpnt) eerxf3iodfpt ln s s  exo(o3ny4lmtnmnesls artru oot1tetoifcilt sDumu s () etoir tadlat aivs ( s2urim3iodolen fcsls)srtrumpnt0optnmfcildlm2ea( ont0trxoxo3tadoat  ieslt  eurxo3no1omenmncs t) 2urxmp;o0opx mfciadfaDumn o ()tlenircta1fmt  uvolt  2um(r3ny4optn fcsls sDrmxr ;o0aeeo ictasfsDumums (0altnmr3iodomD li o;(  2xm(m oo1amt mnvi (faDua(ronu0ape  feiytla2el( o (0texrxf oy1lp rauvo;s)tetmxm iydll e fctlsfs2taump;t0alenmfciaslsDemu on()tltoxo oy1fa  ai i;t0srxrio iu1lm  mfetas)arta( ont4oleoiieiadls2rlnmp t0alxnmo oy1opDranvs (0 exm(r ou4alenmfvias sDua( pou1apeniociaslm2em(vs (0 eerio3iodfpteauvo;(0trum(o oy4op n ictls) 2trxm oo4aleoiictlslm2rlumo;(0aetrio3tydlp rluei;() rtrxo iu4lle lnet s srrau poo1aexn fcilsfs2rlums t0 rermociydomt  nesl()seto(m io1alt  ictas) Duaxr ;o1tlt moeiasfa2rm( o;(0 exnmociydlm e iei;t) rxrimpoodlle lfvia()s2uau  ;o4open f3iydfm2eanvon() lenxocoo1omDrau o s  2um(m nydolte ivi t  Dururpou1apt ifeiadfmDeau o (0aleomf3tatoaDrlnvo;t)s2urirpoo1op emivs tfs2tmxm ou4alen icildfa2ua( p t) rtoxo3oa1fmtrluvo t  rxo(m ny1apeemnesa()aDtm(  ;o1tptomi3ild sDrluvont0 lxrxociadfpDrlieo;s)s2tm(o oudll nlneias)s2umxmo;u1teeoio3iydfmDumn p t0artomrcta1fa elivsl( seuo(mpiydlp   fcilt)srur(r nu0altnmfeildfs2rmuvp (4 eerir oy1opt  ues t sruo(rpiu1ap  micsltfarumu oot0opeomfctyslmDum(vont4tetomrcta1oat ln i;t  ruoxo oudlm nlneslt) Dtax  ;t4tpenii3iadlsDelu o;u)aexrxf3io1lpD  n s t)tetmxo ny4llenmnciat srumxmono1olx iiciadla2ul( on(0arerir3tatlat  nei;t t2uo(o nydopenmieias aDtm(r no1tetnifctytla2rmn o ()aetomr3tadop r i o;()setrxmpoo1llen nvs t)aDtaxm nu1apt ifciltfs umumonu)artnmrcoatfmDe ieol(  eum(mpny4omtelicil(fs2ururoot0aeeomfeiasfs rlu o (0 eeomf iatfaD aies;()teto(o oodll nmfcslsf rrm(ro;t1tlx  feilslm2emnms u4 lxomr3oadomtr u ol( s2xoxr ou4apen ict sfartrx oot0aet ii3iyd s rm( s;(0tlxoirciy1op  li i;t)t2toxm3nudame  fvtas) Dra(monu1oleo ieild s umuvsnt)tlenmrcia1opD  ues;(0 2ur(m3nudlp nlfeias)arraum ;t0optnii3tydfs2rauvs u) exoio3oadfate neo (0 2uriopiy4lp  livil(fs2taurpnt0tlxomiciydla ra(mp u4aetrio oa1lmt luvo ()seuo(r3io4lp   ics tfa2raxm nt0altnifctyt a rln p;()tlxoio3iotopDelu s;t)s2tr(rpiudoptemfeiat) 2rmumpou1olxoiiciytfs em(mon(4tetnxfciydfpD  nvi t t2um(r3iudope mfes (  rua(r nt0tltnifetys a2rl( pn(4tetrmociodlpDr n s t0 2xm(r ou4open fvt t a2urxmo;t0oetnmfctaslsDelumont)arxrio3ootlmDean o;t setoio3oodlp n fcil()srtr(m ou1oleniieiysla2eluvsn(0 lxnmf oodoptrlues;()t2urim iydopenliet s  rururp;o4aexnif3iysfm2rmn p t0texoxr oa1lmD  n o;t trum(m nu1apenmieil(f 2rmxm ;t0altomf3tyd a rmu onu)trtrxo3iy1fa r i ilt sruoxr no4apeelivil(faDta(ro;t4oexo ieildfm2rluvp;t) lxrxf3iotfpDelieil()teum(opoo4amtelietatfarra(mono0tetn ieiasls2ranvo;(4teerxf3iatlp eanvo s trur(rpiu4altemieta( aDtr( p;o4olxnifeiysls rmnmp (0 lxnxf oo1fm rai ilt0texr(m3io1optnmfeia(f 2um( poo0tleomfciydfm2rluvon()texoir oa1lmDeau i (0 2xr(rpnu1amtnlnvtl(fa2tr(rooo1oexnmoeildfa rm(vonu)alxnio3oatfaDeaneol()s2xoxr3oodam   fetlt)arra(mpno0tlx  feiatfs2ea( p t4texomo iatfa   ivsl()t2ur(rpnodom emivil(fs2umxrpot4olt  oeiatfs2emnvp;(4tltnmo3oo1lmD  neo;() 2to(m3iodll elieilt) Drrx  ;t0tlxomociasfsDuan s;t0tltnxoctydlptelnvi ( s2xrxr ny4lm nlnct () rtmum oo0tltomfetasfa ulu s;u4trtnxr3tytom rau s;()teurio nydom n nvtlt  rum(  nt4alxnmfcilt a2rmn o u)trermr iy1lmDeluvs;t  2ur(rpoodameemnvs s)s2rmu onu0tltomfeilt m rl( pnt) eeomr3iadopD ai o;s0 etm(mpny1ap elnei t srua(r ;t1olxn ocias m2rl( snt0tetnxo ty1oat an o (  etmxo3no4lltnlfei t  Drmum oo0oee mi3iyt m ean o;()artnxf3iodlmtr ivsl( s2tr(r3ou1am nmfvtat) Dtmxr ;u1aex miciatfa rmnmsn(0 lxnxociadlpt aiei s) exo(mpnudlm e nvs s sDtmxm oo0ape  ietydlm2ran ont)trxomf to1opteanvo;( teto(r nu4lmtnmfei sf rrrxmpot4oee moeiysfm2rln p t)teerir3oadop eluvs ( t2trir3oudop   iet (  2ua(r nt1olenifeilsfs2uaumsn(0tlenxr to1opDr nvs;t0s2umio3oudll nmfci t) rumxmpoo0alxomociaslm2em( snt0trerifctytlpDe n s () 2xoim iudape licsas aDum(  ;t4apt mi3iyd sDrlums t)arxoxocoy1fmt anvs t texm(o3nu4omee icsl()aruaurpot4olxnmf3ild a rluvp;() reoxoctatlm rli o;()t2xmxm ou4opt mnet tf Drmxmp;u1altn ociyt a rln pnu4texrmf oy1fpDrlues t  rxoxm oodopt  ieslsfsrrr(  ot4tetn i3ildfaDra(mp;t) rxnifciydfat  neolt0 2xrio ou4aptelnesas a2tru ono0tlxomietltls em(mo;()aeenxf oatop elu i t0setoimpou1am n ivsl(f ruax pnt1oetomo3iytfm2rauvs t)trtoifcoadfateli s s)trtoim no1olenmfcils)sruaumono0altoiietysfsDrlnmp;t) renmf oa1fpD aivol() rxo(mpiu1opt lncsat) rtr(  ot1alxoioetyt sDum(ms u0aexnif3ty1lptr u s;s)trxmio3iy1om e feilt  rum(mpot4aexo o3iad sDrlnmo u4 ltoxf3iadlp  lieo ( tetr(mpny1olt lnet (fa2um(  ;u1tlt ifeilslaDuauvpn(0tlxnxf3oa1om eaivs;t) rtrirpno4om  mneia(faDtaumpoo1aexniictat mDrlnms (4tltnmo oadfm  aues (0s2umio iy4llt mncils)sDraumpnu4apx ifciadfa2umn p t0 rtnmrctotlp   nvs;s0trtriopnu4ll n neiat arrm(mpot0opxomoeiyt aDua(mo;(4 eerxr3iatopD  ivs (0srum(mpou4ap emfvs ()sDurxmo;t4tpx iociasfm rmn s u4arxrmociodlp   ivo;( texmim oydlptnlfvi () 2rmxmo;o0tex iocias mDraump;u) etrmf tadopDr n o (0t2xrxr io1lmenlnei ()sDuaxroot0oetoiieiat a uan pnt4arxrifcio1om rau slt srur(m nu4lp  mictlsf rumump;o1alxnmociad s eau p (4 rtnir oatomtr ieo;( s2xrimpny4lm nlivils) 2tau pot0tpx  ociad aDrlnvpnt4tltnmo3oytlptelnvo;s)t2xrxm io1op nmnvia()srtaum ;o4optn o3iytls2rlumpnt4 ltoxfcty1fmD aneo (0srtrxr3io4lle  ivs (fs2urumpot4oltn f3tls mDeanmo;t)tleoxo tadlm  lu i ()tetmxr3oo4lp n netas)srtr(r ;o0tpto i3ildfm ua(mo u4 ltnxr3ty1oa rauesl(  exm(o ou4lmtelnvil(f 2uax  ;u1optomo3ilslm2ranmo ()aexrxfcty1oatrlivo t)s2toio3io1alen ieslt a2tr(rp;u1tlenio3iydfm2um( snt) rtnmf3oytomDr nvi s)s2tr(rpno4amtn nvtlt)srrr(m ot4apen ieiatla ranmont0 lenxocto1opDraieslt)s2xrxr oo1ll e feia(f rtmurpnt1ole ii3ildlm rmn o;(4trenxo3oydop rlivs s)srumxopiodalenmictlt  rrr( poo4altnifeilsfaDuanms;u0areoxf iytoatrlivi;s  rto(o3oydamtnlfcs () Dta(ront0aetomfeildfs2ua( pn()trermf3oodlaDeau ol(0 etmio3oo1olt lfviltfsrua(r oo0tptomf3tltlaDuln s ()treomfciydfmte nvo;()t2xmir3iy4lmt licsas)a2rrxmp;o1altn i3iad a rl(mont) leomr tatopteai o;(  rxr(mpou1lm  mfei s) 2ra(r ot4opx ii3iysla um(mo;(4altrxr todopt au o;t texo(m3nodome lfct sfa2uax  nt0oetnifetatfs2rl(vpnt)treoxo tydfm r neil(0t2xoxr3ny4am n ncil( sDurxmoou0opt ifetatfs2ua(vp;t0 ltomr tadom  aies s0trurxo3nodlp  miet t  2tmx p;u4alx  octat a2rm(von()tleoircia1oa   nvs t) exr(o3nydalt lnvt tf Dua(m ou4oleomi3tas aDelnvo () lxnir oa1lp   uvs;s)t2xm(m3iudlmtelietat)arra(m no0tpt  ociydfs2rm(msn(4 lxrio3oydfa ean s t) euoirpnodlpenlivtlt  2taurp;t1opx  oeild aDulumpnt4aexnif3io1omtraueils)trxmir3nydapt  neilt s2uax pnu0aptn ociltlm rauvp;(0aetoxo3iydomDelnes;(  rur(r3oy1opeelnvslt)aDuru  ;u4oee mf3ildfs ranvont0trxrxrctotfmDr neo (0trxr(opoy4apt mfeil(fsDrau  ;u1oet io3ildlaDrl(msnu4aeeomr3totomD  uvs;t0trxmxr oo4lltnmieil(f rumxr nt4alx micilsls2eluvon() etnxo oy1oa e nvslt) ruoxmpoudop  lieiasfs2urx oot1ope  fetydls rlnvo;t4 exrmfciadlp  livols)teur(rpoydlpte fvi sf rtrumpnt4tle  fctad aDrl( onu0areoioctotfpte ues s0s2trxm no1ope lnvi ()aDrm(  ;t1alx moeiys aDulumpnt0 etnmr tytfpte n slt s2tm(o3nudal n net s arra(rpnt1oeeoii3iat s eluvs t4 lermo3oo1faDrln i (0 exmir iudlmeelict s) rrrum nt4tpxnmiciltfs emnvp ()arxrir iydfmteluvo;()srtoxm no4al nmnvtl(fa2umxmpou0altnmo3iasls rl( pnu0trxnio3tydlptrlieslt)s2xrio3nodaptemivtas s2uax  ;t0opxnmoeils m2rl(vsn() leoxf iytfmDeanvolt trxr(m3iu1ope miet t)srtrxrp;t0tpx mi3ilsfm emnmo u0altrxf ta1faDeaneils srtm(opiy4llt mfeils)srtmum ;o1apxomictydla umnvpn(0texrxr oo1fpD aieil(  exmio nu1ol  mfeslsfsrta(  oo0tlxnmi3tadfs2eanvo;t4arerxocta1la elneils0setoxopou1aleemfvils  Dururp;u1tlto ieiydfmDum( p t4aexoir3oy1lmDrlnvol() 2urxopio1omeemicilsfa2rrxro;t1apt mietltfsDrm(vs u0 reoxf oa1lpt anei t)teum(o3iydlle mfvsasfsruaum no1aet  iciytls eanvo u)tetnircoytfpteau s;(0t2toxm iy4ameelici (faDua(mo;t4tlt ifeiyd s2ra(vpnt4altrxo io1lpte n s;s seuoxmpiudapeelivi () rurx ont4olxoii3ilt s rmums;(4treomf iy1fmDrluvilt)srurxm3iudam elnviltfsrtm(  ;u0olxoifeiytla2emu pn() ltoxrctytoa rlu s;s t2umxopou4lm nlivsa(fsDtruroot0tlen i3tyslm2emnmpn()altnxf oytoaD  n o;s0 etr(r iu1om  miesas)aDumumono1tlx  icilt s2ranms u4tlxrircto1lpD lneslt0setoim io1omenmfvsat aDtauro;t0ale mo3tlt m2rmnms;()tlxrir3io1la eaies ( s2uo(o3oodale mnvsat  ruaxroot4oeeniictld m ean s ()arenmr ty1faD  n o;t)t2umxo iu4om e ncta( arta(  no0tex ifciyd s ran pnu)aeeomf iotlmDeluvils)sexo(r3ny1apenlivt ( aDraur oo0aeeoif3iasfsDran p t0trenmr3tatfp   neils0trxriopiodal  miesa( s2ur(m ;o4tpenmoeilsls emumpnu0altnmr iy1lateluvo t)t2to(o nu4ol  mivsa()a2rmx o;u4alxn o3ilslsDelnvo;(0teenmo3oo1laD an sls0 2trio3iudlltelnvia() 2tm(m oo0tpx  ociasfsDeauvont4tlenxo3oadla r nvs;s t2urirpno4altnmnvilt  2tm(  ;o0tee ifctysfm2ranvo;t) rxnif3oytlmtranes;s0srxoim iy4ole lnei s) rrmxrpnu4tetnmo3iysla2rlu p;t) eermr3todfaDr n s s  2umio3iu1olt lfeilsfsDta(  nt4opt ifctatfm2eauvp (4trenio todlptrlnvs;t t2trio3ny4ol n iet t  rrm(mooo0tpe  oetldfaDrm(msnt0 rxoir3tydfm raieo;()trxr(opnu4oltnlict (fsrtmx onu0tlxoiociys mDelumonu)alxrmr3todom  anvs s0sexoiopoodlltnmivsltfarumx  nt4tet ifeildfsDumu snu0tetomociy1fp e ueil(0t2uoxr3nu1lptnlnctls)a2raxro;o1aeeomfeiysfs rlnvo;t4tetoio3oydfmtr uvi;s0s2uo(r no4opeemnvils  rrrxmoot1tpeomoetadls2elu pnt0 rtriociytfptran i s0trxoirpoy4amt mnvilt  2ta( ont0opxo ictatfs2rmn p;u)artrxfctotlp   ivs t0 eumxrpno1omteliesl(  rrrurpno0alto fctldls2rlums;() rxomrcia1faDranvs t trxm(mpnu4lmen icilt a2ra(rp;o4tltn ieilt m2umuvp;t0aexrxr tytfp e n o t0tetmxmpoydamtemnesa(  2rrxm ;o1aptomiciad mDea(mpnu0artoxf ia1fpD anvil(  exr(o3no1op nlnvilt) rrau ont0openii3ildfsDeaumsnt0trxomf3iadla  au i;s)s2tmir iydll  mneslsf 2rr(mp;o0tpx moctltfs eln s;t0 lxoifcta1lm  anvilt)texrio3iu1lpenmneiltfaDtru p;o0tlx mfciaslsDelnmo u0trenxo3tatop   u slt trur(r nydlpeelivsat  Drrum nu1tptnmf3iyd s el( pnu)arenif iydoa  liei;s srxoiopnu1lp e fctas artm(m ;o4alto i3ildlaDumnvpnu0tlerxo3iytlm  anvils sexoxm iydomtemict s)aDtaumonu1tleomfeildfm rmnmpnu) rxnxo3tytfpteaieo;(  2tmxopnu4ap elieilsf rrmx ono4oeeomfeilsfm emn o u0aeerxrciotlmDeau i;t0s2xrio3nu1om   fvsas) 2ta( pou4tltn o3tlsfs2eau s;()trxomf3to1oa rai s;s  2xoio3nodapeelicta() 2umx  nu0aex  i3iatlsDea( s t0aeermf3oydlpDr n i;( s2umio3nu4ape lneta()artax  ;t1aptnmf3iltfsDrlums;u4artoif3ta1lm rlnvi;s s2umiopno1opt  iet t aDumu pou1tltoiieiydfs rmums;t0texrmo3ootlaDr nvs s) exr(r3oo4ole  icil(  2rrx  ou4aptniiciysfm2eanvo;u0arxoioctotopD  ivil()t2toirpiu4ol n ivi s)srtrurooo0opeoiieiltfs eluvo t0 lxomrcoadfpDelnvi;s)trxmir no1ape mnct (fsrumx  no0apt mieiytlm eau o;(0texnir to1lat ln i s) etmxo3no1aptnlics ( aDtr(  nt1tpe mietysls2ean on(4artrmo3oy1lp rlnes t  rto(m3oo1omtnmneiat a2rm(rp;t1olxomictlt m2el(mont)tleoxrcoy1oaD  n i;t  eurim3no1apen fctl(fsrtmumono4aetoifciltfa rauvp;t)teenmfcoo1omte ueo () 2umxmpio4lmt  ncsl(  2tmurooo1tpxnifetltfaDrmnvsnt4teeoirciy1op eanvols) etmxo3iu1opt mfeia(fsDtr(rooo1teto iciat sDemu p;u) lerirctodlpDeli s;t  2tr(r iy1ll e nesas)sDrmuroot4oleo ictld aDrau snt0aetrifcoytop   uvs s sexoxr ny4oltemnvtls)aDrmu oot1alxniieiltfaDul( p;u4 etoifciy1fmDe uvs;t0trurxopoudoltnmieias)a2ururpno4oeeomiciys s2umu pnt)tetoio iatla  lu s (0 2xm(r3oodol  lfct sf Drmu ooo0tlenifeilsfm2ea(ms (4 etomo oa1oat luvs;s  eur(r iu4ope  fciat  Dtmurpot1ope ifciltlm emu p;u0arenio iatfaDrlivsls) rumxo nydlme lnetat)s2tm(r no0aptomoeiltls ra( pn() rtoir tatfm   ues s0sruoio3nu4lptnlietat sDtmxro;u1tlx  ietltlm raumo;(4texnxr ty1lmt au o;()srum(o nudlp  mnetltfsrrmxrp;t1tptn iciadlmDea(vs;()trerxr3iytlpte n o t0s2uo(o3oudal  mfeta(f 2trx poo0oexnmieiytfm2elnvpnu4treomr iydomt auvils s2uo(opoodop emnvtl(f 2uaxr ou0oeen iciadfs umnvp (0 renxr iatoaDelnvs;s setmxo3no1olt mfvias)a2uau  nu1oeen oetys s el( snu4trxoxf oo1fp   ivolt sexrxo3iu1lmtnmnvs (  Dta(r nu1aex mf3tasla ran ont) ltrmo3io1faDelnvo;t  eumio iodomenmnvsatfaDrmxront1oeeomoetldfsDrl( o u4 etomrcoatfmD  uvi t) eumiopoo4omtemnvta(fsrrmur nu4aptn o3iysla uln sn()tetrir3oo1om e neo s  rum(r3oy4lleelicsl() 2uaum ou1tetoifetadfsDrl( pnt) lxrxociodlp raiesls0 rtmxo3oy1omtn nctlsfa2ur( oot4tle  iciys s2emuvpn(4texnmr3oodomD anvi;(0 2tmirpio4om nlfvtat) rra(rpno4openii3iytls uln ont4aeerio ta1fp   ueils) rtrio3nydlpen ncs s) rumxm oo0aexnmfciyt a2rlnms;u0 leoif3oytlpte nvols0 rur(m ny1alt lfci t sDurur nt4olto iciadfaDrau s t4 rerxo3ta1fpteai ils  2xr(mpio1optnlivs s sDur(moot1ole io3ildlaDua( s t4 renmr totfpDeaivols0 rxmim3io1ole  nvs (fsrrmu pnu1tpenmietytls eln o u0aeeoxo3todom r ivi s seumxrpny4lp nmfeiat)srtmxmont0opeoiiciasfa uau s;u0trtnif oa1fmD  nesls)setr(r ou4amtnlicil( sDrm(rp;o1aex iiciysfm ranvs t0 rtrmf3ootomt au i;( t2xmxmpno1lpenmnvt s) 2tmumpnu4oeenmi3iltfm2ranmsnt4tlxrxfcoytomDeanei s)tetoim3iu4lm n ncs sfaDurum nu4aexniieiatla2rmumsnt4tetrio iotomte nei;t sexm(o3ou4olenmnvsat srumu  ;o0aeto fciasla2ul( o;t0alxoxr oodfmt li i s0teurio3oy4al nmivt tfaDtrxmpno4tltomieias s em(mo;(0teermr3tytlm  aieo;( t2trxo3iy4al nmncias sDurxm nu0alxo o3ilt s ul(msn(0tleomfcoatopDeaneolt)tetrim oo1omen fetas  Drm(rono1opx mi3ilsfs2ulu onu4aeeoxf ootopDean o;t srtrimpnodamt  ieil()srrru o;t4aexomicils aDel( on(0altnxrcoy1oate nes s trxmiopno1lp   nvsat  Drrump;u1apeomfcildfs2umu o;t0altrif to1latr uei;(0 eumio3ou1al  lfeias)artaurp;t4aptoio3tltls umnvo;t0 rxomocoo1la rlu ols  eur(r nu4apeelfctas a2urxrono1altoiiciltfa2rmums;u4texoiocoadfat au o;( t2umimpoy1lpe mfvtl()arumumpot0tlen o3iys mDean p (4trtoif ia1fat lneol()t2xoir oudlm emfvs s) ruau  ;u0opxoio3iytls2uauvpnu4artnio3oodomteanei ( teur(r3oy1llee fvsl(f Dtauro;o1aetnii3ilslsDrlnvo;t) exrxo3to1fpD  ivo s0 eum(o3oy4am  mnvsat)s2umu  no0oet  oeils m2uau snu)arxoxr to1fp ran s (0s2xrxo ny4ll  lncsatfs2trxm nu0tlx  f3iltlm2elnmsnu0aetnxo3oo1oaDelu o (0t2xr(rpoodlpe lfvt (fs2tr( p;t4alt mfciysfmDrmnms ()aetriociodlpDraues;s0srxm(m ou4alt micsasfsrtrxr no1oexnii3ilt mDra(vs t0tlermfciodom elu o s  etoimpiy1apen fcils)srra(mpoo4tlt ifctltfaDeanmp u4trenio3ia1lptrau o;t) exr(r ny4ape mivia(farraum ot0tltn i3ilsla2umn s;t) exnif tadom rlies t)s2xmimpoy1ll n fvt tfs2ururooo1olt ifetasfaDeauvp;u)tlxoifcto1lpDrlnvsl()t2um(r3ou4ape  iei tfsDurx oou1ape ioctytfs ul( s;t0tlenxo tadfptr uvs;s0 2trimpoudopt  icsl( a2uauront0aptomi3iyt m2uanvs u)artnir3oytfp  an s t0sexo(o3iu4lptnlneils  Drmumono1oex if3iydlm ulump;(0trxrxfctydfpte ivo s0 exo(rpnodam nmfcia(  rraump;o4teeo o3ils s umump;t) lxnifctytlpDraueslt)s2xrio3ou4lpenmfvt (fs2umxmp;u4alt ii3ias aDum( pn(0 lenir3iydlpt  nvs;s trxm(mpnu1apenmnvta() Dtmurp;u1aetoif3iadfa2umums (0arxnxrcoa1fm eau s t) 2uoio3ny1ameelnvia(  rraumpou4tpeo ocildls2raump u)altnifcoydlaD  i o;t) 2tr(o iy1lmtnmieilt sDta(rono4teeoifetydlsDul(mpnt)texoxocoa1faD  u s;t)seumxm3nydomee fctlt  Drrx ont4oetomoctls a2ul(ms;(0tetnif3oatlm   nvo;t teurimpiu4lm nmfctlt) Drrx p;u4tpxo i3ilslmDrm( snu)teerif3tatoatelnvo;s  rtr(m3oodole mneias)arum(r ;t4apx  o3ilslm eauvpn(4 ltrif oadfp  ai ols0texrxmpio4om elnvt tf rur(r nt4tpxo iciysls rau p t4tlerxf3oydfpDr nei;s) rur(rpio4ame lieilsfaDrr(  no1aeeomf3ildla2umuvpn()alxrxf oydfmD aneilt)trtmio3ny4am n icsl()srta(ronu4ape ii3iasfaDra(vonu0alxomfcoatomteanvo;t srxoio iy4opt mfei tfs2uaump;t0tpx mi3tasfm2ulnms;t0 reoxr3oydlptrauvo;t) rxm(m nydamtnlnvtl(fsruau pou1oeenmieiytlaDra(vsnt)tetoxf ia1oaD lnes s) exr(r3oydlmenmies s) Duaxrp;t1tlx mf3iydfa uln s;() etnio oa1fpD lieolt  rurxmpnu1alenlnvi s) rtm(r ;u0alxn fetls sDemu p;t)aetoxr to1lmte ieils0 2xmxo3oodap e netlsfartr(m ou4aet iicils s2eaump (0 etrxoctatoatrau ilt)srxrxo3iy1lmt mnvtltfsDraxmoou0tleo fctat sDrln s;t)aetnxo3io1oatrlu o;t) eurxopnu4om e fvilsfsDuax  no0tlxn oeiad s ra( p (0 etnxf3totoaDr nesls sruoxr ou1lpenmfcsat aDtr(rpno0aexo o3tltlm emump u)artrir3tydfmt lu i t0 rtm(o3ny1lpe mfvi sf Dtm(r ;t0tpe ifeiasfaDelu o (0texrxociatop r ues;() rxoxopiudol emieil(fsDra(mo;t4tlxn ictadlaDea(vont4artnif3iadopt au s;t0 2tr(rpiydlmtelnvt sfaDtaxmpnt1alxo f3tadla raums;t0 rxoxf ty1latraivo;s)srurxmpiy4oltelfet t) Durxro;u0ale iictydfmDua( o;t0arxnmr iadfpt ai i () euoxopoydaleemnetas sDra(r ot4oeen ictyslm emnmonu0aleoxo oatoat lueo;t) exmxrpno1opt  nes sf 2umu pou4tle  feiltfm2ul( p ()texomf iatlptelu sls0s2umxrpno4optnlnet t)srtmxmp;o0olxnioeilslm em( s (4 lxrifcoodla r uvs (0 2tmxr3oo1apeemici () rraxrp;t1apeomfctydfa2ran onu0aeenifciytopt ai s;t srto(m oy1aptnlictls) rrr(mpnu4aexomfciad s2ulnmsnt4trtoxr3iotlatrauei;t0t2tm(mpoy1opt mnei (  rtaxro;o4tlx mieildlmDran snu4texoif oo1la r ivs;s t2tr(r3ny4aleelieslt  Draumpnt4tlt ifeiys sDuan p;u4trermrctatfp eai i s t2xmxm3nu1om elnet (f Duaur ou1oltnmf3iyslaDem( p;()arxoxo3oatfat  iei (0 eumir3ny1openlnctatfarum(rp;t1tpto f3tysls2uln o;t4aeermrcta1faDeauvi;t0tetmxo oy4lpen ivt tfs2ur(ront0alxomfeiadlm ua(vs (4 etoif oa1fpDr u s;s)t2uo(m ou4opte nct s a2tmumoou0apx iictldfaDrl(mp;(0 exomr3oo1fmt lu i t s2xm(rpiy4lmtn iciat srumx ont1tltn i3iytla rmn o u0trtrxf iodlpt lu o;t) rxmxrpoydoleelneia(f rumx  ;u0tptoifeiyslaDea( pn(4tlxrxrctatlmDrlnvi (0 etr(o3nodopee ivtas  rtaxmp;t4tex micias sDrlnmont0 renifctatla e i o t)trxm(m3oy1omtnlfcilt)artr(rpoo0olxnifetytlm rm(mo;t4texnxr oy1op elu s t trtmxo oy1alenmneslt aDurxro;o0oex  oetltls2emn o;u4 eenxo ia1lptran sl( srto(o nydapte ivs s) Dtr(rp;t1tetnmfeildfm2rlnms;t0 lxoir3oa1faDran il(0tetm(r3iodll emicslt arraurooo0tleoif3tysls2ran onu4 leomr3iydlmDeluvsl(0 2xrxo3iodame  icsa( a2urxmont0tetomfetlslmDean s;u4aeenxocoadoaDr ivi;t)sexr(m3ny1lmeelietas)sruaumont1tle mieiasls2rluvs u4aleriocoy1omD liei (  etrir3io1oltn nctls)s2tr( ono4tlto feildls2eanmon(0 rxrir3iy1lpDrlnes;t  rxmxrpno1lmte fcsls) rtaxrp;o4apeo icilsfs um(ms;u4teermo oatlaDean ol(  exrxrpiodaptnmfesa( a2rrurpnt1tle  ictasla uauvonu0 lxrxo oo1lat au s;s s2um(o3ny4lmt lnctltfa2rrxro;t1olxnifetydfsDrlu pnt4trxriociydlmD aieo;s  etmim3iy4lpt lfcsl() Dua(moot0opeoifeiltls rlnvo;()arerxfcio1fpDrauvolt  2toxr3nudal emnetl( artau pou4tpeoio3iadfs2umu o (0trtrxrcta1lmte nvi t t2to(mpou4lm elfvi sfs2tau pou1alen ieilsla raums t)tlxnif3iy1fa rlieo t) rtrxr iodlm e iei s s2rru  no1teen ociadfs ua(mp;() eeoifcio1fmteaivo t seumio nudol nlivs sfaDrrx pou0tpt iieiat mDuanvs;(4trerxr oatlpD ln o t  rtrir io4lpenlicia( arrax  ;u4opeo i3iltfm2ulnmp u)trenxr3iotom  lnvi;( s2xoim3no1aptnlfeil( sDrm(r nt0oexnmf3ildfs2em( s;(4trtnmf3iydfaDelnvolt0 rxoxr3oydomtemncs tfsDrrum oo0oetniiciat mDean o u)aexrxo3ia1fpteluvi (  2tmirpiu4omtn nctls  2tax ooo4tpxn ictadfm ranvs (0texoioctatfptr nes t0trxmio io4olt  nctat) rrax o;u4aet  f3ilsls uaumpn(0tltnmfctatom  luvi;t0srxm(m ou1omeemfvsas  Dumxmo;o0tlto fciytfa ulu o () etoxoctotlaD ln s;t0s2uo(m3oo4alt micsls arraurooo4open fcilsfm2ea(vp;(4 lerif todfm eau sls)texmir3iudap  mnciat  2urum nt1olx mf3iytla2ra(vp;u)altrir oadomD ai olt)trum(r3nudlpenmivtatfsrrrumonu4altn feilsfa ra(mo;t) leoio ootoatraues;s s2trxr3no1openmncs t)srtmxmont1oltnmfcildfmDulnmsn(0tlxrmr iytopt lu ol(  exrio3oo4lmee nciasf 2umxmo;t4tleo fctld m eluvp;t0tleoirctotfmt lneilt0s2xoxopoo1alt  ict t  Dtrxro;u1tlto oetysfm umumsnt)aexoxfciatoat  i i s trxoxr3oy4lle lictltfsrurxm no0tleomi3iat m2ea(vs;u0 exrxo ty1oat anei;s)texmxo nu4amenmncsasfsDrmx o;t0aeenio3ildfsDrmu p t4trxnxo iadfa  luvo;s  rtoxo3no4opte ict s) Drru oou4aptoii3tldlm2el(vo ()aexoif iotfatrlnvsl()srxm(mpou1ll emncil( arra(mpnu1optnmfeildfa rau on(0 rxoxo todlaDrluvs t0trum(rpoo4ol elivt s srrmumpot1optnif3tyd a emnvonu) eerxr ootopD ln i (0 2xmim ou1alt micsl( a2rrxr ;t4tpenioetldfaDra(vs t4alxrir3oadomteau s s0teurir3nudamtnmneias)aDtrumont0tpen ocias s ul(mpnt) etnmf iadop rlnei;t) etrxo3iudlptelfetl( srtrurpot1tpx iiciatls2rm(vo u4aeermfctotfa elu o;t) exr(o io1lltn nciat s2rm(rpou0olt  o3iytfa ulumo (4 rxrmociydlpte nvi s  rtoxo3ou4ol  mfcsa(  Dtm(mpnu4aexo o3iyd m2ea( s u4teeoir3ia1fmDr i i s0 ruoimpno1lptelivs s) 2rmxm no1tetnioetls s ua( s t0 rtoio ty1omD lnvs t) rtoio3iodol elfcsl( a2urx  ;t1aet iociat a2ul(mpnu4tlxnmo3ty1latr u o;()seto(rpno4ame mfvsat  rtru pnt4alxn i3iytla umnvs;t)aleomf3iytomte u ilt)srtm(r3nudll n ietlsf 2urumoot1oltoif3iydfsDulumo t4treomf3oa1fat anvil() etmxo ny4lltelfesl( aDur(rono1aexoiictasfaDrmu s;(0teerif todlp eai o;s  eumimpny4lpt livt t sDtrxrp;t0aee mfeiaslm uln p ()tlxnxr tatlm  aues;(0tetmio3iu1lpt mivi ( srtm(m ot0aee  octlt s2ua( s;t0 rxomr3oadoptean ils) ruoxr oo4olen fcsltf 2uru p;o4apeomfctldfsDumnvo u0trxnir3tydfpDelnes t0sexoio3nodalenmivsl()sDtm( pot4alt  fctldfm2ua(vonu)texoxr ta1oat  u o ( t2toxr3iydoptemfetls) rurxrp;t1ale  fciydlsDran o u4 eenir3to1fmt an s (0 2xo(opou1opt lnvils  2uaxmp;t4opxomf3iltlm2ran p;t)artnxrcootlmte i s t0sruoimpoo4om elfeslt)sDra(mooo4teeomoctasfsDulumo;u)tleoifcootlmte neo t srxrxr oy4aleelfes sfs2raurp;o4oexomieiyd aDea( pnt4arxnmf oodop elieo (0s2xmxm3nu4ap  micias arrruroou1tee iieiasfs rmn sn(4tleomr oodlaD lueo;(  rxo(r3iudlpeelivsa() Dumxrpoo0aleniieildls2uanvsnu)tlenif3oodlmt  u s ()t2xo(o ou1llee nvil() 2rm( ono4tee ifeiasfs2rlums;()areomfcoydomD aivi;s0 2xmiopiydlltemieta() rua(moot4tlxn f3ilsfa2rmumont) reomr3oa1oaDeaneo s s2xmio iu4lp nmivtls)aDrmu  nt4altnmietlsfmDumn o u0texoxo oo1op   ieo t0sruo(o3nudopt lnetl(fa2raxmp;u0oeto ietatfsDraumo (4aeenmrcoatfpte nes ()seumxrpiydamee fcils s2trx pou4alt iietls mDrln p (4 exnxo3iotoa raivo () rtrxr3oo4opt  ivsl(f 2umxr ot4oee  fetad s uluvsn(0artoiocto1omD  uvol(0texrimpoodapenmfvsas)srumu pot4aetomfeiysfmDuln o t4aetrif3oydlaDe u i;(0t2xoio oy4lp  liei tf Drrxm ot4aexoiociys a rl( o;t0arxrioctatlmtraivo;t s2uoirpio1om elfvi ( s2trur ;u4oet moeiys sDeln ont) rerir oytlm e u i s0s2urim3oodol e iesas  2rau o;o4olenifciasla ulump (0tlerxf3iadfm   n slt0s2tmxopiydlm nmictls)s2umu  nu0tlx  fctlt m uan o;t0teenxrcoytfmD  uei ()sexmxmpoo4om elnvta(f 2umxrpou0tlxoiicild aDrln s;u4 eeoxf ta1laDrlu sls  rtmxo3oo4aptelfeta()s2umxmonu4teeoiictatfs2rmu o;t)texrmoctydfm  ln ols)setm(rpiudamt mfvt ( sDraurpoo4oex io3iysls2ul(mon(0tlxrmr ty1oa raivol( t2tmiopnydam n ivtls a2trxmpot1oeenmf3iatfa2emnmo;t0aeenio3iytfptrlueils0 2xr(rpiudom  mfet s)sDumu oou1apt  fctasfm rau s t4trtoxrcoo1lmDeaivols)srtr(o3ny4aleelfvias) Drmu  oo4optoifciadls2ulnvo ()tetnmrciadlaD  uvslt)s2tm(mpnu4oltnlfes t  2raxm ;o4oeenmi3iys s rmuvs;()arxomo3todop rlnei;(0s2xmirpiodamtelncia(f rtr(mo;t4teto ictyt s em(von(0tlenmoctotfmDr i o s)srtmxm3oydlle mneiat) rra(rono0apx iiciltfa2emuvs u) exnxf3tydoptrlieol( truo(o ny4ll   nvta( aDururo;t1apxomieiad a ea(vs;t0arenio3iytfpDrlu s s0t2ur(r io1alenlfci s) 2rr(m ou4alxo i3ias a2el( p;(0trxoif3iy1latr ieol(0srxrxopiu1lmtemneta()sDta(r ou4altomieiytla emu on(4 ltoxfcoytfaDrlivols s2uo(rpnydam   ivsatf Dtauro;t0optn ictys a2rm( p () eeoxr3ty1omtrlueilt0t2tmir3ny1om e icsas aruru poo0opeoif3ild s2umn o;u0altrif3iy1la e i s;s0 2xm(opiy4aptnmfetasf Durumpnt0tetoio3ildfm uluvs;t0trerxo3iatlaDrlivo;s  euoir3oudll emicta(faDtaum oo4apt io3iltls umn snu4aetrxf3ty1laDe ivsl() rtmir ou1amtemfvils a2ua(  ot1opeomi3tad a2umuvp;t) ltrirciy1fpt auvo;s0trtrim3no4ome mnetls)srta(  ou4olx  oeiadfaDeanvo;u4arerxfciy1laDelnei;t0srto(m3nodaptemfci tfa2trxr ;u4aex  fciysfmDel(vp;(0 eerxf3iodop raies ()t2tmir oy4om emivsas arta(mp;t0tpt mf3iyt sDran s u4trtnxfcoy1oateluvi;t texmxm ou1olee ieil( arumum ;t1optniocilsfs2uanmo t)artnmf iodlate ieo;()teurxr oo1omee fcs () 2tm(mp;o1tpen ieiatls rmumsn(0trenmf iatoaDrli s (  2xr(m3nu1lmt lfvias  2rmx ono1aexoiocilsfsDumumo t0tetrio3oa1fp  au s;(0srxrxrpiy4am  miesas arumum oo4tpeomocild mDrl(ms;u4tlermfcoy1laDeliesls)t2tmxopno1lpe  fvs (  Dtmurooo0alxomfeiatlm2rl(vpnt)alxrmf3oy1omtrlivolt) ruoxm oudlmee nct t s2taurp;o0tetn o3iaslm em(mo;(0alerxr iydoa e ues t setm(mpoudlmeelnvtas arraxmpoo1tpeniieiat a2ua(mp (4altomf oatoatelneolt0s2tr(m3oy4lmt  neia()arrmu p;t0aeeniieildls2elnvp;u0texnif3iy1fa ranvs t) etrxr3nu4lm  mivi sf 2tmur ;u0opt mieiatla rlump (0artrirciytfpDe i sl( t2uoir3iu1altemnvtat sDtr( pou1aet ioeiasfm uau o;u) rtnxo3iatlmt ln i t)s2to(o3io4omeelfctatfa2rrx  ;t1olx if3iad aDel(von()texnxfctotoaDe neolt  2urir io1optnlnvsas sDrmumo;t1tet mieiytlaDua(vont)aetnioctytoatrlu i;(  exm(m iydalenmfvia()srrmu  ;t0tptniieilsfa2emnvp t4 rxoir ty1faDeanes t teurxr3iodol elict (f Dtmurpno0tex  icild sDuanmonu4 rerxf3ia1oaD  u i (0texrxopno1op n nes t)a2tmxr oo4tpx iiciltfa2emn p;u)tltrmrctotla rlieil() rum(o iy4lpenlnet s)sruax p;t1oexoifcils aDumu snu4trenio oa1laD lueols  etoxm no1lpe  ivilt)aruau  ;u0oeeniocilt sDuluvo u)artoir oatlmD  uvi;t0sexoirpnydame miet tfa2tr( ooo0apeoio3tatls2elu p t)alxnif oy1opD  nvi;t  etr(r3no1apen nvi sfsDtr(rpno1ape mociys aDran p t)artrmrcoytlptelnei;()sexoxrpiydllenlnvtlt)srumxro;u1oleo ociysfa2eanmp (4arxrmo iytfm  lnei;s  2trim oydlltn fctatfaDtr( oot0optnmiciytfm eau on(0teermr iadlpD aieo;( tetrir3ny1ol elfvslsf Dua( ont4oee moetytfsDrlumsnu)aeerxo tatlmt  n i s0trxr(rpoodlmenmnes t aDua(r nt4oet  i3ias mDelumo;() eermf iodoaDe neo;( srtrxm3ou4amen fvs s arrrxmpnt1olx iictydla rlnvs u) lenxf3tadop r ieo t0t2umiopoudaltemneia( sDtau  nu1apenmocils m uan p u0trtomrciytfpDe ueo;(  2xrim io1openlivs () 2tau poo0teeoio3iatlmDranvpnt) etnxfcio1fatean o;(  rurxr oo1al n feiltfaDum(r ;u4tpeo octysls2ra(mont)alxoir3iydla r ueilt0srurir oodop nlfei s) rrm(r ;o4aleo oeiytla2rlnmsnt)trerircoa1opD  nvols0 etmxr io4ap e fciat a2uau pot0aet  ietydls2rmu s ()artrmoctotlpDean o;( trtmir3ou4lpenmfviat sDuaumonu0tlto f3iydla emnvp;t0 rxrif tadfatran s;(  rurxr oo4omtnlnvilt sDtm(r nu4opx iieiadfmDumnvo u4teenxo3oodlmD lnvs;s)srxr(o3nu4lme liesl()aDrauro;t1tlx  i3iysfaDrm(mont) exoxrctytlmDelnvs;t0 eumio3iodal elfesl(fs2tm( pot0ape io3iat sDeanvp ()texnmo iodlp elnei;() 2xr(o iudopee ics () rur( ont1altn i3ildfsDrm(mo;(4 etoxo3tatfa elneslt tetoim iy1omeeliesa() rrm(mo;u4aet  ieiltla2eaumo u4tlxoirctatlp raueilt  exo(opoodlptemiesls a2rm(rpoo4aeen oeias a2uaums ()artrmfcta1fa rli ols) 2tmirpnu1opeemnvsasf 2ua(mpnu1tptn octyt m2umn s;(0tetoir ta1lpteaieolt trtriopoydlptnmncs t) 2tru  no4altn iciatlaDean onu0 rerircoy1lm  auvsl( s2xo(m3io4omtnmictl(fa2ta( onu1ole  ietldfa rluvo t4aleoiocootla elivolt teumir3ny1om   ncilt arumur ;o1opt ioeilsfa umu s u4altomr3tatfp eaues t0sruoxo3ou1opeemnci tf 2ua(m ou0aleomfeiadlm el(mo t0tlenif iadfat  i i;s) eurxrpnu4ope livtl(f Drmurp;u4apxn ieiysla emuvp u) lxoir oo1omt  iesl(  2xoio iodape  ivi s)s2rmu p;t0tltomfeilt m2rm( s;() ltoxr oadfpD ln s t) 2urxopoydomtelnetlt) 2rr( ont1texo ociadfmDrmn s u0treomrcootlm elues s  exrirpiu1alenlicia(  Draxm no0alenmieiadfm2el( onu0arxrir3totlp eaues;s) rxrio nydalt  fei tf 2rru onu0alxnmfeiasfm ul( o;(4treoio ta1lptelnvilt)texrxm oy4om  lnvtat s2tmurooo0tpen ociydlm ulump;()tetnmo iatop   nvi;(  etriopoy1om nmici s sDtau pou4oleomfciydfm2uanmp;t0aetomf3tydoa  auei;()t2to(r3nu1ameemiei t) Dtrumooo0tpt mfetasfm emn on(0 exrxr3ta1laDelnvo ( t2umxm nudale liviatfsruaxrpnt4ole miciytfa2uau s u) renxrcia1fa   ueslt s2xmiopoydalee fcs (fsDrmu o;o4altomf3ils a uluvp u)texrir todfa rlu o;() etr(r3iydop e fvt ()sDtm(rpno0alxnmfciytfs ul( p u4 lxrif3todfaDeluesls) eumimpoodllenlnctl(f rrmurpot1tex mocildlsDemnms;t4alermf oodfaD  nvolt) eurio3nudom e nvslsfs2rmx pno4aexnio3iadfmDulu o t) renif3tydfa   ivsls0 etr(r3no1lm nmies s arrru ont4aexnifciat a2emump ()trxomf oatfmtranesl() eur(opio4lme  nci s arumxrpoo1aexoiieiadlm2eln snt0altrmr to1lmDraieo s0s2to(m3oodapee icsls)aDumxrpnt4opxo feiat s rmn o t)aeeoxrcootlmDeln sl(  rtm(m ny4lmtnmnei tfarrax o;o0teto feiydfa2elump t)aetomo oodlm  auvo ( s2umxr iu4lptnlnctasfa2trx oou1oltomieias mDrl( o u) exrxoctytlaDe uvo;t)seum(o3iy1ome  ivslsf 2rr( o;t1altn ociat a ul( o;u)trxoxfcoodlmtrln i t0teuo(r oodamtemfei sfsDta(monu1tlxnmfeiadlm rm( p;u4trxrif3tadfp eln ils setmxopiy4lpte fei tfartrx  nu1tpxnifctad aDeauvont)arxnmfcio1omteaueol(  exrxr3no1llte netls s2rmxmooo4olx ifciatfm uln onu)trxrifciodomDe i o t trxrxo3oy4lm e ictl(f 2rrxmonu1tleoifciysls ulumsnt4 leoir3oytfmtrluei ()truoim oodal  liei (faDra( pnu4ole  fciytfsDrauvs u0 eenmo3to1fmDe nvo s0tetmxmpio4ape  ict () rum(mont0tleo icils aDrm( o;u4alxomr3oo1fmD  nvo s) exoio ny4om nlfvs s srta(r ;t4tpto fcilsls2rluvs t)altnxr3iatlm   nvo s) rxo(r3ny1olenmieil(f Dtrum ;t1ape  oetadfsDrl( pnt0 rxoif oydlmt  i o;t  eumxr3io4ap  licsltfa2um( ono0olx  i3ias m2elnmsnt4 rtoxociytfptrlieol()srtrxr3oodaptnmiet t)srumurpot0tptomieiydla2uau o () ltnxfctadfat luei;t)srtrirpoudlpenlnei (fs2tmxr ot0tptnioetltla2eanvs t0 ltrxr iatfmD aueo;()t2xrirpoy4om nlnvi sf rrm( o;o1texomi3tldla ulumo u4 rxrio ty1lmD an i t  etrir3iy1lme mfvt tf rtr( p;u4alt mo3iys mDuanvsnu4trermr3todoptr ivi;t t2xmxm3iydaltemfvtl() rtmxmo;t4apx iietydfa ulu o;(0alermociatopD aiei t)trxrxmpoy1lmt liet tfaDuru  nu4tet miciyslmDumuvsn()texoioctotlp rauvs;(0 2xoxo no1alen icilt)srtmxmp;u4aexoio3tasfs2rmu p;t) rerxo3tydfp ran slt t2uoxmpoo1aptelncil()a2raumonu0alxnmoctytlm2emn s;u)treomocty1lm r ueils)srumxm iudlm  mfvta(  Dtr(r no1opx iicildfmDeanvp ()arxnxf oodoaD anei;s0tetoxo iudll  mnvilt s2rmuro;t4tptn f3ildlaDel(vp;()texnxf to1lp   n o t  2urxm3oydlm   nvilsfs2rr(mo;t1altomf3iltla ranmont)arermf3oydfaDr n s (0 2to(rpoudlle  fetls  2uaxmp;u0aexo ictytfm2ua(vp (0teerxocoa1opDeanei;(0seumxm iodame  ivs () rumumpoo4aetomictyslaDranmo u)tltomfcoytlaDe ivo s setm(m3oodam emivi s aDua(  ;o1aetniociysls2uau o;(4teenmf3iatlm   u i (0trurir oudlp  lieil(faDuaump;u1olt ii3iltls ranvo t4 rtoir oadoaDe ivsl(0trtmxm iy4ap nlnesas  rurxrpnu4aleo o3iltfm2uln p t0 rtoxf3iatop  auei s0teumio iy4altelietat s2tmxrp;u0tpx  i3iyslaDean s;t) leoxr iadomDraivols s2toim3iodolte ieta(  Dtauro;u1aleomoeilsla2ul(vo u) lxomo3ia1opteli o;(0 2tmio no1apen neslt) rumxr no0alt moctld m2umu o ()arerxr3iy1lpteau i t) 2ur(rpoo1aptelncsat aDrax o;u4aexnmociad m2uau s u4aetoxo3iadfpt liei s0 rto(r iydapen nes t s2um(m ot1oexn feiad mDrmu o;t) rxomrctotoa e n olt0texmxrpiydop nmiviat aDraxmpno1ape  ieilt sDrlnmo;t4trxrxfcty1opD  nvs;t) rxo(r ou4lmeelnetl(f rrmxrp;t4aleniictatfm2umnmsnt4tlxnmr oodlmD  ueo;(0t2tr(rpnu1omtnlfei (  Dra(rpnt4aleo o3iytfa rl( o t0arenmfcoodlpt  u o;t s2xm(m3ou4ll emnviatf rtmurpnt4oltnmictltlmDrmn pnu0 eenir oadfaDe neol( s2xr(r3nydlpeelnviltfsrra( ono4aptoifeild s ran s u) ltoifcio1lmDran o;()s2xmim iodll nmfci ( sDraum nt1tltnmo3ilt a2rmn s;u) rxrmrctotfp rai s t) exoxm oydalte nci tfarraxm nt4apenifciaslm uanms (0 rtnxo oadoatrli s;t0t2urir3iy4op n ics t aDrm(mpou0tlxomi3iatls2uaumont4artrif3totoptelieol( s2xrxr3iy4lmtemfci t arrrumpot4tpe mociytlm uan s u4tetrmo3tatfpD lu i;()seumxo no4alte ieilt)aDtmx  no0aexo ocilsfs uauvo u4texrircoadfp e ies t)teur(m3ou4lpe  fet s arraumoou0tleoif3iatlmDumu pn(0tlerircoodoa   uvi s) etmir3nu4lle mfvtl(  2umu o;o4tptoiietat m ulnmpnu0alerxr iotoaDrlieo;( teuoxo iu4olt mfvi t)srtm(mpou1aptnifetadlm emnvp ()trtnmo3ty1faDe uvo;t)s2xmir oy4lmtnlnci sf Dtr(moot1opxniiciys aDem(vp;u4 ltoxo to1fp  ai o s)trtmirpny4lpt lnvt t sDua(mooo4oexomo3iasla2umnmp;u0tlxrmr3oadlateli s s0srxmio oydlpe mfvs () 2raumono4olxnmf3tydls ul(vpnu0 ltrif iotom eaivi;t0sexoxm iy4altelict sfarrr(mo;u4tetnmi3tltfsDeau o u0trerio iadfatrau i ()s2tr(m ou1lp elivi sfs2rmurp;o1texo oeiysfaDulnmsn()teenif3oy1omteluvi;t0seto(o3oy4olte fcsl()a2ururo;u1alxnmicilt s2ua(mp t0trxoircty1op   ieils)sexr(mpnudomt livtas srum(mont0tpe mociys s2ea(msnu0teenxr iotlmD li o;t0sexm(m3nu4am  lncs ( arrmump;u0aptnmo3ils a2eln snu) lxoir3oytfp elu ol(  2xr(m oy4ame lfvtlt)sDrmxmont0apx if3tytlmDemn pn(4trenirctadfptr ueo;(  2tmxr3iydlmtn feiasfa2rax pou0oexn octld a rmums t0trxomfcoydlatr i o s t2umxrpio4lptn fcilt a2urumo;o0oeen fctys a2rl(msnu) rtomf3ty1fpt aueo;s0 rtrio3nodomtelfct t aDrr(rp;t0oet  i3iys m ua(mp;u)alxrioctotomtr nei;( texr(mpou4amtn ivta(farur(ro;u0alen ietas s ra(vo;u)tltnir3totfate uvol()truoxr3iydaltelivt ( s2tmu pnt1apenmfeiytlsDulumonu)aetoif3oytla r uvo;(0srumio3iydllee icils) rtmx  ;o4tlen i3ias a rlnvs t0tetrmf oadfpDrlieo;() etm(o3oo4ap e icsatfa2umumpoo4oltomocilslm2rl(msnu) lenxf3ta1lpt  i o s0 rtmxopnudlp emies tfsDtr( o;o0oex miciatla rm(mp;u4 lenif ty1lmDelu i;t t2tmxr3nudop  lict (fsrtrx  ;u4ole moetad s umn p;(4aexrmf3tatfpDrln s s  rxmxmpoo4lltn nei t s2uax oou4tpxoii3tyt m eanms;()altrxrcta1omt  ivo (0teurxo3nu4al  mfes tf Drrump;o4oeto oeiytfa rmu s;t4altrmr3iydlp   iesls0 rtr(r ou4lm  lieilsfsDua(rpno1opxo fctas a2el(msnt)trermf3oy1fm eanvi t  eumirpou4aleelnvia(fsDtrxm ;u0ape  ociad s2ul(mp;t4 etrif tatom raivol()trtoiopnu4lpee nvtas)a2rrxm ;t1oexn ietltfs ranvp;t0 lxoxo3oadlpDeluvsl()teurirpnu4omte ncia()artrur nt0apxniocias sDumu p t) rtrxociodfp eluei;t0seuo(r nudame mnctat) 2rmxr nt0aeen o3ilt mDea( o;(4tltomf iatfa e i il(0tetmirpny4omtemncta( s2rau  ;u1oex if3iadfm2umuvsnt4 lxnmfcoo1opt auvolt0 2urio3nydap  lfvt ()srur(mp;u1ope ioeiysfs emn sn()trtnxo3iodfm e nvolt0trtmxrpiydlptelfes (fsrumumono0alt mf3iat m2elu p;(0 ltnmfciydfmt  u o;s t2toxm iy1llenlnciasfsDurxmont1apeoiieiyd s2rau o u)aetnxoctatlpteai ols0t2xriopnydamenlnetat)srum( pno1tle mf3iatla2umn on()trxoxf tadopDrlueils t2xoir ou1olenmieils)arrmu p;t1olt  oeiadla2umnvsn() renxfciatop  aieil(  2xrxr no4lltnmivt tfsDtaxmont4tltnifciaslm2emums (4trxoxo3iotlp r nesl()s2xoiopoydlmt mfeils artaur no4olx mi3iasfm emn p (0 reomr to1laDelneo;s s2xoxopoy4omeelfetas)arum( ont4oeen fctasla2eanvon(4alxnirctotfaDrluvils trxrxo oydap e nctas a2umu o;o4oexo iciad m ua(mp;t0teeomrciy1lat  n s ()trurxr3ny4amt licslsfsDuaurp;u4tpxo oeiadfm2el( p;u4aexrmr3iy1lm  lnvs t t2trxr ou1optnliciatfa2umumooo1alt  o3iyd mDem(mpnt4artoxrciotoptr nes;s)tetrxm3oydop  lfctlt  rraumpou1tet  ictydfaDulnmo (0altnmf3iatlatr uvsls  eto(rpnu4ome  ict s) rrmu  ;u0tleoioctld m uanvsnt)texrmo todoa raneo s) rxrir3nudam n ici s a2tmu o;t1altomieiasfm2eaumpnt4arxnxrciy1lpD ln s;s  2tm(r3nydoleelnvs ()s2rau  ot1opxnmfeiyd m2elnvo t)aexoxf3tydoa   u i t0s2ur(opiu4lpe mnvt s)sDrrxr ;u0tpxoio3iys m ran pn(4tltrmr ootfp   ueilt)s2uoxo oydalenmnvs ( arraxr ;t1tpx iieiatfa rlnvsnt0 ltniociatfpD lnvs;()sexr(m oy1aleemnvs ()aDrrur nu1ape  ictatfa2rlu p u4teenmr3iytfmDrauvilt)s2um(r3iu1amenmies (fsrraumoou1aeen f3ild sDem(vo u)artomo oo1fatr neolt)s2xoimpou1al n fcias a2tr(root0aptniietas s2rau onu) etnxo3iatfpDeai i (0texrxr ny4lle  fcs ()s2rr(mpoo4aetn f3iysfmDranvpn()artnmr ootlp e uvi s srtm(o oudapeemfvs s  Dta(m nu4oex  ictydfaDrmu p;u)aeeomf3iodomte u i;t teuo(m3iu1op e nvil()artax pnu0tpxoio3tytfsDuauvp;()aleriociytop rauvs t0t2tm(r3io4lp nlfvt ( a2rmumono4olxniociyslm2umnvpn(0 etnmoctydop rai s;s0srumxmpnodlleelfvs (  Dua(m ;t4oexnmoetas m rmnmsnu) rxoxf3oadlaDrli o t) 2tm(opiudap  mictat  Dtmum ot1tlxo ietysfs rmnms t)arermocto1op e uvi s  2trim3no1oltn ncsas) 2uru pnt1oetniociytlm rmnvs (0alxnmocoytlptr ivilt0seurxm nodll emietltfaDtr(rpoo1tet  f3tysls2ran o t)aexriocoytopD aivo (0 rxoio3oo4al   ictls s2taxrpot0oeeoifeilsfa2ulnmsn(4 reomocoa1la  anes s0setrim3iu4lm elfcsl( a2ua(rp;t1ope ifctatfsDeanmp;t0tltomrciotlaDeaieo (0sexo(rpiydal nmnetlsfartaum nu1opxo feiltlsDum(mp;u4aleoiocoatlmtr nesls)srxmxo nudapt  nesa(f 2tmxront0teenio3iltlsDrlnvp;u4 rxrir3tadlmtrlu o;t)srtmxr3no4om  mnvslsf Drmum ;t0tpxo octysfa2emn snt0aeeoxrciytfmtelneil()teurxo ou1amenmivtas sDuaumooo4opx  fetlt sDra(vp;t) lerxf3ia1lmD lueo;s0 exoxr oo1lme  fet s)a2tmu  no1tptoiieiat a2eaumo;t4areoxo3io1fp ean ils  2xrirpno1lltelies s)s2rrx poo1apen oeiltfa2elnvpnu0arxomfcta1fmDean s t) 2xrxopnodal   fcslt) rta( pou1ape  feiadlmDul(mon(4arxnio oatfa e ieils0 2tmxo3nudom e ivsat)aDuax pnu0optnmoctadla2uan s t0 eenir oodfpt  uvs () ruo(opio4omtn fvia( aDrr( oou1oee ioeiys mDra( sn(0alxoxf oy1fpDeln o;t0 2tmxrpnodome miesasfa2tm(mp;u1oleomiciytlaDrl( s;u)aeenxfcoytopDran i t t2um(r ou4lpe mnviat)sDrmx poo4olx moetasls2emnvsnt4tltrioctodoatranvo ()s2uoxm io4lmeelncia( sDtrxm ou0ale  feils s ul(vp;(0aetrmo3iodlpt an ils)t2xrxrpny1ome mncia(farrmxmo;t4oeto fcias a2rluvp;u)arenmf tadoa   n o;s)s2xmxr nudlm emictl(fa2uru o;t1olen i3iadla2eauvs t) reomr oytomD lu s s) eur(m oodaltelfcta()a2raumpoo0opto octydlm2elu s;t0trtomo3oy1laDr nei (0srurxrpny1lmtnmivt ( s2taum ot1tpto i3iydfs em(vpn(4 etoxocoy1om e ueil()trur(m3no4apenmfvtlt a2raurp;o1alenmoeiasfm ulnvsn() lenmr3tatop raueo;t t2xoim3oudalee icsls  2ur(mp;o1apt mf3iysls2rmnmo t) leoio iydoaD au i;(0s2to(opou4aptnlictatfartmu oou1teeo i3ild sDem(vonu4tlermfcoadomt aieilt srxoim oodllt  feia(  2trum no4aeen o3iasfa eluvo (4tlxnif oytlaDe ueilt t2tmirpiodlmenlnet ( aDra( ont0apeo o3iyslsDumnmont)aetomfciodfptranei;(0 2tmxmpoo4open fcta( a2tm( p;t4aptn f3iytla2ul(mpnt) etoxo3oo1faDrauvo s) eurim3nudape lfctls)arumxro;u1oeeomf3iyd m2um(vo;u) exnif iodla r iei (0tetoxrpoo4amte ivtl( sDrmu  ot4apto o3tytlaDum(vpn(4 exoxf iytfmDrlu i s0 euoxmpiydome mnet sf rrmxr oo0aptn feiasfaDuln o;u0 exomrcoy1oaDeluesl( s2xrim3nu1ll  lfciatf 2uau  ou0aet mfeiyd aDrlumont)texnio iotlaDeln s;(  eurxo3nudomtemics s)a2ta(m ;t4aetomfetltfa ua( s t4tlxomocootopDe ueo s  rto(m3ny1op e fvil()arrrur ;o0texo f3iadls uaumonu0aexrxo tadfpt  nesls  rtm(o3iu4am n netlt sDtaum ou0olxoio3tldlm2uaumsnt)alxoif3tydoptrli o t) rum(m ou1amt mieilsfarrm(rpnu4alx ioctatfsDrmu p;(0texoxf3oy1fm   nvs;t  rxmxr iydomenlivi s aDuaxmpno4apenmf3tytfsDel( pn(0tetrmo3iatlaDelnes;(0truriopoodlme  nvil(  rtmxr ;o0optnioeiltfmDeau ont) lxoif tytoptelu i;t srxo(r oodlm n ivta(  Dtmxront0altnmfctasfm um( ont4 rtrxr to1om   uvslt  rxmxmpno1amtelnvta()aDtaum ou1aee  f3ildfa2emu s ()arermf oy1fm eau o s)seumxm iydlme  fes tfs2trum ;u4aet mictltfs2ea(vsnt)alxnxocoydfaDrliei;(  etoxrpnydoltemfeslt)sDta( ont1teenmf3tatfmDrlumon(4trtoir oy1lp   ieolt)srtrirpiy4ll  livsat  2ta(ronu1olt  octytfa rluvo;t) lenxo3iydfp  au i ( seuoio3oudape miei ()srrrump;t4aptnmfeiadfa2em(vs u0tltnir tydlmt anei;(0srtrxmpiy1apt  nct ()sDtr(m ou4aexo ieilsfa eauvo t0aetoir3oy1laDranvi;s)s2xm(mpiudop nmietlsf rumxm nu4aetn oeiltla ulu p t4trxnxo3iodlpDe ieo s0t2tmiopoo1al eliei t) Dtmumpoo0apxo octat m2rau p u4arxomfciadfpDrauesls  2tmio oo1lptelict t)sDurur ou4aee io3iyt mDrlu s;u0 ltrxrctatfatrlieo t)srtrio io4lle mfcsatfa2ua(mp;u1aexn ieiydfs uan p (4aetomo iatfmD ln s ( seuoxo ou4am e nci s)sDraurp;t1tpeoiieilsfsDemnvs;u0altrio ootomt anvs;s)t2xm(mpou4lltnmietat a2ra(  oo1ope iiciytfaDuanvo u4aeenxr iotfmtrluei;s srtr(mpio1aptnmnctasfarumxr ;t4oltoiociasfsDua( pn(4artrif3iytfpteluvs t teum(r3oudoptemiet (f 2uaxrono4olxnio3tld m rmnvp;t4teerir3tatom eaneo t)s2toir3nu1omenmneias)a2tr( oot1apxomo3ildfs ua(mo t4treomf oa1fpDeaueo s)seurxrpio4ll emies s  2ua(  no1alxnmietltfs ulums t0arxnir3iydlp elnvi;s0 etr(r oy4olenlfctl(f rurumono4tpxn fctydls2uln s (0tleoio tytfp rlnvo s texmim3oudlle livia()sDtrxro;o4opx mi3tldla rl( pnt4alxnio tydla  lues t) 2xrxr3nodam   ivt s)sDtmumpnt4oeto i3iasls eau onu) rtnmr3tydoptraivo;t0setrxo3ny1lme mfcs ()sDtr(  ou4aptoifctldlaDrlu o t)tetrir iatfa  lues;s0 2uo(m no1optelietlt  2um(m ot0aetnmfctadfsDel(monu)tleomr iydoatrli s;() 2xo(rpiu4al elfcils)sDurumpou4teto f3iadfs ra(von()texoxocoytopD  ieo;()trxmxo3nu1al nmncil()a2ur( pnu4tpt ifeiydlm ra(vpn(0altoif3totoa  li i s s2xoxo3ny4lpenmiviasfsDtrxr no4teen f3iltls2ua(mo u0trxoio3iytlm elivo;s0 2toim iu1am   nesl(fa2urxroot0tpx ii3ilsfmDuauvo;t0 etrmrciotfpDe ues (0 exmxo iudomt livtlsfsrrmx pnt1alenioetytlm2emu o t)texoxo3oydopD  i o;( srto(o3io1apte ict (  Dumxr ;t0oeeomfciyt s2emu on()aexnxr oatoa elies;s)t2uoim iy1am   ivslsfa2raxrpou4oetnmfciatlm2umuvs;()artomociytla raivslt  2urirpio1alt  ietlt arrmxronu1alxnmi3iltfmDem( snu0trtnif tatop rlnei;s0 eumir io1omenmfcia( s2ur(ronu0tlenmi3tlsfsDrlnmsn()alermr oytop ran i ( s2urxr oydlptn fct sfsrumx oou1aetnmi3ilslmDumuvp u)tlxomfctydfpDrlneils)t2urxr3iudaltnlici tfa2trum nt1oleoiieiadfmDea(vsn(4 rerxocty1la eanes (  2urio oudale lfvtlt s2taxmp;u1tptnmociltls2emnvs t0trxnmo3tatoaD anei;t)t2xo(mpnu4am nmnvi s)arraxrp;u1olto oeiydla elnvo;(0arxomr3iy1lmtraieo;()s2xrxopny1lp e nvtasfs2ururp;o1texn oeiatlm2ua(mon(0 lxomr3tatlpDelieo () 2urxo3nudolte nciat sDra( pou4apxnif3iytla2rl(vo;t0trxrmocoydlmDr ieolt)t2xr(mpiy1ameelics sfaDurx ono0oltoii3tltlm2rlu p t4artrxociydlp  li s t) 2uoiopoudopen fvt s aDraxr oo4tetnmieiysfs2ua(vp;(0aleomfcootoa   nvo;( setrir iudale lfeil( arrrxmpnu0tpxn f3iydfsDeln p u4aetoxociotfmDr nei ()tetrxopnu4lm   neta(  2urxmp;t1teto fciltlm rm( pnt0altoxo3ta1omD  neil(0tetoxo3no4lpt mivi t)a2tax  no0tle mi3tadlm uanvsnt)aetomfcoydfa  lueslt0 2xr(o nodalteliei t)s2uax pnu4oexnmieiatlm2umumo u0aeeomo tydfatr n o;(0t2xrxm3oydome mncilt  2tmu  ou1alxnmoetadfs2emnms;t0 leomo io1fateai ols)sruoim3ny1oltnliciat sDrmxro;t1tpto icild s eauvsn(4 reomf3iy1oaDr i olt0 2xmiopoydlptelici (farur(moot0oeeomietadls ul(vonu0arxoxf3oa1oa   ueilt truoir3ny4lpte ici s)aDua( pno0tpt moetatlsDelumsnu0aeeomr oy1la   ivsl(0sexmxo3nu1openmietltfsrrmumo;o0oleomfciyt mDumuvs;() rtrio3totlp eanvi ( seumiopnydolen nvsat sDurx onu4apxomoeiytls ranvsn() exrxo3iadfa elieolt0 rtm(r io4opeemfvt () 2ururpnu4texoif3tatfmDrm( o u0 rxomfcoodfpDrlnvo t0seumxo3io1altnlivils arumurpoo0oexnmieiyslmDelnvsnu0treoir tytfp ean i;t) ruoxo3io4lleelictat)a2uaurpot1opeo octysfa ua(vs ()aeenxr3todfmt auesl( setr(o oo1ll nmies t)srta(rooo4opxo ictldla rl(vo;t)tlenmf3oy1fa raueslt0 rxr(m3no4alt  nesat s2tm(m ot1oexnmfciatlsDeanmsn(4trtrir3tytfateln il()t2uo(m oydlmtn ncia() 2taumpnt0olen octldla2rlnvp () lxrxr oadomt  uvilt)t2xrirpno4omenlfcsat) Dta(  ;t4tex mociysfs eln snu0tlermo oadomt aueils trxmir3ny1alee netlt a2raxrono0tpe  oetat s eluvo;u0alxomf tadfaD luvi ()srtm(opnu1ap  mnetltfs2tm(  ;o0apenmfeiys mDrau s t0arxoif iydlp  aneo;s) 2xo(m oy1lmt  fei t) Draurono4teto o3tldls2rl(vp (4areomr oo1lp rli s (0t2xo(r iu4am   ieil(f 2tmu  ;t0teenio3ildla umu o t) etomrcoa1fmte ues;()truoimpoo1amt  nvs (faDrau o;o0openiiciasls2em(mp;t4texnxo iadfate uvi s  exoxr iudamee iesa(f 2ta(moou4oltnmictatlaDra( p u4trtoiocio1oa rlies s0truoxr3nydal   ncils)a2uaur ;t0opt moetysfaDrmumo u4tleoxr3to1fm rlieo s)t2toxr io1llte icilsfs2uax  ou0apen fcildfs2rauvp u4 eeoxf3oy1fmDrluesls0t2xm(opiu1am emnci ( arurxmpoo0texo o3iat m eauvsnu4tetnmo oo1la  ln ils sexm(r nydopt lneia(fsrua( pou1aexn feildla emu p;t0artomo iotlpDe uvolt) etmimpiudom elicil( aDraxronu1tpe ifciadfsDelu ont) rxrmo oatop ran ilt0 rurim3nu1opeelfvi s)s2ua(root0ale mfetldfs2el( p u4teenmfcoodfaD aivsls) rtrxr3iu1om n nciasfs2umumooo0olen fciyd s2ranvo;() lxrmo oodfatrauei s)texrim3io4ale mfeslsf ruau  ou1tpeo fetyt a2emn pn()arxrxr3iotopDe nvi t0s2tm(r3iu1ll e fvs s s2tauroou4ale ioctydls2rmnmo (4altrio3todlatr nvsl()srxo(r3nu4ol  lneslsf 2tru pnt1teenif3iydfsDeau snt)trtoxocoo1lm  livils0 2xmio3iu1optn fetasf 2ururpnu4aeeo iciydfsDelu ont4trermf3iytfmt lieil()s2tm(r nu4apt  net s)arrr(mp;t0oetnmo3ild sDem(mo t0aeeoir3todlmDrln s t  rtr(o3nydaltnmfvtasfaDrm(r nu1texoio3tydfsDranvsn(4aeenxf3tydlm  aueo;s)t2um(m iy1lmenlfviatf rrmurpnu0oeeo feildlm2ra(vs u4aeermfcoodfaD lueslt0seumxr iu1omen ivi tfarrr(rpno1oleo ieildlm2ra(vs u4trtrmf3oatop r uvs t tetoio ny4ame  fctas s2rrumo;t1aeto ociyd a2elnvp;t0aexniociydlmt auvs;s)teuoirpoo1lptnmicsa()srraxmooo1ale ii3tys a ulnvs;(4alxrxrcta1la e i il(0s2xmxo oodlm n ictat)aDrrurp;u1aeeomoeiytlsDumuvs;()tlxomo3oodlmteaneils  2uoxr no1lltnmivs ()s2raumpno4oeen oeildfsDuanms (4aleomfcoa1fmDrai i t0setr(o ny4lpenlivta( aDumurpou4olxoifctytfm2emnms;u4 rtnifcoydfmDrlnei s)sexmxo nu4altemnesa( a2ururp;t0tltoiocildfs emnms;u)aetoxr3ta1lptelu sl() rtoio ny1omeemnet ( a2tax  nu0aptoiictyd sDuluvo;t0arxrxr oodlaD lneo;t)teto(r3nu1ame  fvia(  rrr(m ou4aleomfciys aDulnvp ()tlxrxrciy1lpDeai s (  rxo(m3iydomtnmivtlt aruau ont0teeniociyt sDrauvs;t0texnmf oo1fpt aueols)trxmxo nydolte fvsatfartaxmp;t0apxoiietys s2emuvonu0 rerir3oytoate nvo;t0s2tm(mpiodlm n iviatfsrtaxrpoo0tet ifeiatla rau o;t4trtrxr3ty1fm elueo;s trtrio ou1aleelfeil() Dtaxmp;u1tetniociatfm ranmon()artnmr3tatfmDe u il() exoio io1oleelieiltf 2umx  ot1tetoiietat m rlnvo;(4alenir3iytfat  neils0sexriopny1al  lietls)srur(  ou1texnmieiltfa umuvs;()teerxoctytla rai il(  2tmim iy1ap  mncilsfa2tmu p;u4alxo i3iydfsDumnvo (0arxoir to1fa rlivs t)trumxrpny4lp   fvs s  2taxronu1apenmi3ild sDem(vs;u) etnxo iadomD liei s0seuo(mpnodll   nctl(fa2ua(r nu1opeomfetad aDumuvs u4artoxf totoat an s;t0 eumimpio4amt mfeia()aDuaurpot0oet  fciatfs2ea(vpnu)arxrxf3oadopD aivi () ruoir3iydll  mfcs tfsrurumo;t1olxnmfcilsfa ulnmo;(0 lxoif oodfmDeaivi;s0t2tr(rpou4lptelivtl()s2ua(r ;t0texoiociadfm2umuvsn() eeomfciydlmD  uei;()t2uo(opnu1lp e nctl()aDrmxm ou0oee  icils m ranvo (0 lxomo3oo1fp  auvo;(0sexmimpno1om elicslt  2ua(rpnt1tlxnif3iasfmDra(vo;t)aexnmo to1op e ies;s texoir oo1amee iciltfs2tr(m ;t4aexoio3tatfa ul(msn()arenxoctadlmD  u o (0 exmiopiu4lm n fcsas)sDurxrono1apx ii3ildfa elu pnu0 exoxf3iydfpt  nvs;( s2umiopoodal  liet ()arrr( pno0oeeo f3iad mDranms t4tltnxfciytoaDeau s t t2urio3no1apee fei s aDtmxmonu1oetn oeiydfs2elnvpn()trxrmf to1oa elies;t  eumimpno1lltelivsa(fsrrrum nt0aleomoctls sDrl( s ()aetomr3ty1lp eaieols0seurxm iy1alee nviltfsDuaumo;t0opxnmfciatlmDemnms;u4artomo oodfmDrlu ol() exmim3oudamen nvil()aDta(rp;t1tex mf3tadfm2umnvpnt4tltomf todfa e uei () 2xrxm oudlp eliet t s2taxronu4tpe mi3tldlmDem(ms;(0tltrxf oa1fmtr uvs;s s2um(mpny1lpeemiet s s2urx  nt0alenmieiasfaDemnmpnu) lxomf tatfateau i;t)srxo(m3oydlp nlfetat  2urx ont1tpxoio3iytfs rlump;(0aetoiociotlm elivols0s2xo(o oo4apen fcsas)sDum(r oo0tpxnmoeiytfa ea( s (4aleoxfciytop   i slt  etrxo3iy1lp elnes sfartmxm nu4tlt mf3ils mDranvo u4tlxrmoctodla e u s () rum(m3nydolt  iet ( a2tr(m ot1oeenmoetydfmDel(mo (0altoio oa1lpDeliei t texo(m io1olt lfcsatf Dtrur ;o0oeeoifciatls ean pn(0altnxf iydlm rlu il(  rxrxr iydopt lfcilsf Drr(r ;o0tptnii3iyslmDrmnmo;(0teenio3oatlmDelu olt0t2urxr iy1al nlfct s)aDur(mono0alxn f3iadla2elu p;t0aleoxo iy1lpt aues;t) rurxr3iudape mietat) Dtmu o;u4oeenmfciatfs2emnvp (0trxoir3oytlptraueols)seur(o3ny1lpte ncs (fsDururo;t4aeen ieiad s2ea(mp t)aeeomf totlmte nei t0seuoxm3io4om   ietl(faDrrumpot0opxniictadlaDeln s;(4 rxnio3todopt aivo;s trtoimpoy1optn nctat  rumumpoo4ope micildls uln o;u4tetrio3ty1om raueolt0t2tr(mpio1ope mnes ( aDrr(rpnt0tlt mo3iaslm2um( snt0alxnif iydfmt  ieo (  2uoxo io1op eliviltf rra( ont0teeoiiciasfs2rauvs (4 ltrio io1lpDraivo t) eumiopnydlpt mncsltfsrumu oou0tetnmfcildls2rau o u0 etoir3oydlm e ueo t s2ur(o io4ll e nvt t)sDrmxrp;o4oex if3tysls rm(ms;(4 exoifciodom   nvo;s0srxoir3ny4omenlics t)sDrr(m ;t4aetomi3ildfmDua(msn(4alxrifcoydomDr nvo s)teuoimpiudam nmfetlt) rrmu oou4tpxnmoeiad mDem(vo u4texnmr3oo1omDeanei s0 2xrio3oodol n nvslt)srrrx o;t1opxoifeiatfm2umnvp;(4texoif3io1fmD  u ol(0 2uo(m3oy4op  mictat)srtmu p;u4alxniieildfa2emn pnt4arxoirciytlmt  nvs;t trumxr3io1op  lncs (f Dua(r nu0olt  i3iysfm2um(vo (4 exrxo iydlpDelues;s0t2xmxm3oy4alenmiei tf 2rr( o;o4aee ifeilsls uan o (0treoiocia1fa rai ols0 rtoim3oo1am e fci sf Dtaur ;u4opxomo3tysls2ul( o;t0aexrmf3tadfpteln ols0 2xoimpio4al   fetat)arrax  nu0tpx mfctytfa em(vo (4tlxrif3totlpt au olt0trurxmpiu4om n fvs tfaDumx p;o4aexomocild sDelnvpn()teenxf3oydoat  u s s)s2ur(r3oy4lm n nvia(faDrr(ro;o4apx mfeilt a2umnvpn(0tetrxociadlat lueslt)srto(opoudal  mncil()srtm(  ot0apxn iciyslmDum(mpnt) rxoiocootfa  aivo;t0teur(r3oy4om nlfeiat arrrurpot0apxoio3tatla ul(vp t) lxnxfciydom  ai s;( srxmiopiy4alen fvsas s2uax o;o0ale mociadfa ua( pn(0 rerir3iotlm   ueilt0 2tmxo oudomtn ncsat  2ra( pnu0optniietat m2rmums (4alxoxo3iodoaD an s t)trumxm3iy1amtnmncsat sDur(mpnu1olx  ietat s2ean s ()teenmfctodfpt lueo;s0 rtrim3ny1apeelfeiat a2uaur no4opto fciydlaDrlums;t)tltrif ta1fm  ln i t0 rxoir nu1op e ivs ( aDrmumonu0tpxn fciys m ranvp u0aexoxfcoydfaDeanvilt0s2um(m3oy1lltnlfvilt)s2uru  ot0alxnifctlsfaDrau o;u0aexrif totfmD ln o;t)t2urirpoy1al n fvta(faDta(rp;u4oltnifciyt mDemuvonu4 rerircoadop   nvs (  rtrio ny4ope liesa(fsrumumo;t1aetn f3ild a elu o;t0 lerir3iadfa r iei ()teto(o oo1ol   ncs sfs2raxr ot0teeoiieiys s um(mp u)tltoxo3oydfpD  ueo s trxmio3nydamtn fvs (f 2taxm ou0apeomieildfa emnms;u)alxnio oadlm e i o t)sexrxr3iydopeelnei ( srrm(rpou1open ieiatla uauvpn(4texrmf ty1omDean o s) 2um(opiy4op n iviatfaDtmx ooo1oeeomf3ilsfaDrl(vo t)texoxf3ootlpteai i t)setoimpou4optelfcil(fa2rm( ont0aeeomoeiatfs2umu p;u)aexrmfciatomte uvo t)teurim3oudopeelncsltf Dra(rpot0olx mi3iltla2ul( snu) etnxrciotlm   u i t  2tm(m3iy4llen fvs t) rum(rp;u4tlxomf3ild m2umn s t4arxnir3oa1fa  lueo;( teumxm no1lpenlictl( sruau o;u1alenmf3iatla raump;t)aeeriociy1fmteaueolt)trtrxr ou1omenmnci t  Dum(r ot0optnmf3tldlsDrl(vo ()teeomo tatfmtr iei;t0 2urxr oy4lp n ivt sfsrraxrpno1tee  ietltfsDemums t4 ltnmo oadop   nvo s s2xrimpoy4openlivsls arrm( p;u0tee mieiasla rluvo u0 rxnmr3iotoa  lieol() exrirpnodomt lnvslsfartrxm ;o4tpxn feiatlmDrmnvo;t0trtnxf3oo1laD  i i (  rxrimpoydlm  lnctls aDtr( poo0aexnmo3iat a ua( s;u)teeomrcta1om rli s t)truo(m3no4olte feilt)artmurpoo4apenmf3iydfm2umnmpnt)teenxr3oadlp  lneil()sexr(rpno1opt lnct (  rumxroou1alto feiyd m2em( o;(0 eeoirciydlmD  ues;(0srtmxr iudol nmnei s)s2trx  ;o0apx  o3ias a2um(vo;t)tlxrmo3todlaDelues;t) 2xoxmpoudame mncil() rururpot4opt ifetldfm ra(mont0aexnmfctytlmte ivi;()s2xrir3ny1apenlnvtlsfsrtr(rono4apen feiysfm uan p t4tleoirciatfp eluvi;t) etr(opiu1omt mfct s)a2taxr ou4ape  ietlslmDul(mon(4aetrmf ia1fmDe uei s0s2xmimpiodam emneil(fartmxro;t4alxoiictld s elnvsn(0arxnmr3ootfp rli s s0sexo(r ou4lp nmfvilsf 2tm(m nt1apt  i3iyt a2um(ms ()aetrxo3iatlm r nvo ()teto(m3iodoptelietas)aDtm(  ;u4alt mictls mDrmnvo t4texoif3oadomDr ivo t  exmiopoudam nlfeslt)artrxrono1texomf3iatla ea(vsnt0trxomr3tatfa r neslt tetrir3iodole lnciat)s2raxr ou0texomoeilsfm elnvp u4trxrir3oa1lmDrli i s seuo(o iy1aptelfcsls)sDua(ro;t1oltoifeiasfs eaumo u0arxoxo3iotlaDeli o;s  2xrxr ou1lmt mfeslsfaDtmur nt1apxnio3tadfsDeaums (4aexnmocoydfaDeliesls0trxmir oodlp  mnei ( sDtrxrpot4tltnii3ilsfa ea(vp;u)aexriocoodlpteanei;(0trxo(mpoudam n feiat)s2tru poo4opt  ieiltlmDumu s t4 rxoxfcoytomtrlnvilt0 rxmxmpno1altnmivta()a2umxm ;t4oex ioeiltlm em(vsnu0tlerif3iy1lat  nvo (  rxr(mpiy4lm nlivilt) rtm( oot0olxnmieiaslmDean pnt0 ltrxfcto1lpte neo;t  rtoxr no4ll  lnci s  Drmuroot4tetnmo3tytfa umump (0 rxomo oatlp  aivo;t0tetoirpno4ope lnvtltf Drm(  ;o1olx mociat mDemnmpnt0trerir3tytla  livs;(0 rxoxr iy1lmt lfcil( arurumoou4tpx ioeiyslaDuanmon(0altrxf io1omDr uesl(0 rumxrpoydop n fcsat) 2rmuronu1oetnmicias sDrmnvo t)artnio iotlaDrlnei s s2xriopou1opt lfciatfsDurump;t4alt ioeiyt mDrmu p;(4teenxo3to1fa rlnvsls trxrxr3oy1ame mnetat  rururont1opxomieilsfm2umump (4arxrmo3oo1opt li s;t0trtoxr iu4ol  lnvias)srrau ono1tlx iietaslm rmnvs;(0tltnmociadlp e i i s) etoio iydlleelfct s  2raum no0tpenii3tysfa uan pnt)tlenxo3tydfm e uvs s) etrim oo4lleemfvt ()sDtrx oou4oeenmfctytlmDua(vsnu)trtrmrctotlptrlnes t  2toxrpnu4ol   nci s) ruaxmo;u4texn f3tat s eauvo;() exnxf3iatomtelnvo;()srtoxm nodam e nct t) 2ua(r no4teeoifeilsfa rln o;t0 rxnif3iodop  au o t  2triopnu1amt lnvsls sDrr(m nu1altomiciltlmDrauvs;(4 etomf3oytfmt  ueo ( seurxm nu4lm n nvs (f rraxr ou0aetnmi3iltlsDra(vs;t4tlxnmo3oadoaDeanvol() rtm(r3iu1apenmicsat)aDrrxm no1aetn feiyslaDul(mpnt) lxnir tytfmD  i i s) rtoir oodom n ietls  Durxmpot1tpxnmi3iyslaDemn o;u) eenxf oodlpDr ues;()s2umxmpno1lpeelnesas) Drau  nt1openmi3iydlm rmuvp;t)aexnxrciodfpt lnvi;t  rxmio3oo4lpee ncils srtaxrp;o0alenifcild m um( p t4alxrxf3oa1fmDrlivo;s0 eumir iydapenmfvsls  Drrx  ou4tetnif3iysfs2rl(vsnt4aetnmfcoo1faDr nes;s srxr(opno1am nmfcsl( aDta( pnt0texoii3tasfs2umnms u4aeermr3io1lateli o ()t2umxm3oudol e fvsat)a2trumont1oeenmi3iltla2ul(vs ()texomr to1lmDrai ols seumio no4amtnlfesasf 2rmxr ;t0tpxnifcildlm eanvs;u4arxrio ta1lmD  u s t0s2xoio oudlpt mnvi tfa2rmxrpoo0tpeo fciysla um( s u) rxoifcoytfa elieilt  eum(rpio1amt  fvils) 2urxmono4aeeomieiytlsDem(vont4trerio iadlm  lues t)srtr(o ou4opt  fei () Dtr( pnu1apenmietadlm2em(vpnu0tleomf3oo1oatran o s) 2trir3iydam  lnei t)aDraum ou4teen iciyt sDrmuvont4trermr3ta1omtr ivil() rtmio3iydlpen fes () 2rmxr nu1ape mi3ias a elnvp t)trxrmf3tydomt lies t0trxmir oodomt lnetlt) Drru  no0aet miciydlm rl(vs;u4aexrxf totopteluvo;s) etrir3ny4alte nct (f Drrx  oo0aetomf3ild a emn p;u4trxnmrciatlp   n i;t0t2xoio no1lltelfei t a2ra(mpoo0aee mo3tls a rmuvont) rxrxfcty1fm rlnvslt) eumxo3iy4am e fvsl( aDtr(ronu0tex if3tldfs2ean p;(0 rtnmfcta1fpte ies t)t2umxrpoo4op emici s)s2raumpnu0opx  iciatfaDulums;u4 exrmr3oatlpte nes;s0texoiopoy4ome  nctl(  Dur(ro;o1aleoiieilt m2eln o u4tlxnmfcoa1fpD aivslt) 2xm(m3iydope lieiat a2ua( o;u0olxo i3tysfm2emn ont4alxoxf3oa1lm r u o;t s2xr(o3ou4lpee fesltfsDtr(rpno0opxoiicildfmDumuvp;u)trerio tatfa ranesl(0 ruo(rpny4al nmnciatfsDraum ;t0tpxn ociatfm2rm(mo;u) renmocoadfpDeauei t)sexmxrpiy1amen fesatfsruau ooo1apt mf3iyslm2emumo (0tlenxr3tydlpDr uvi s teurxopoy4apenlfeilsf 2uaxm nu4tpxoii3iyd mDuau snu)alxrxr tadla raivo;t0 etoim3no4omtemnct tf 2tau pou1aexnif3ilt sDumuvsn(4 exomo tatfpte nes;s0texo(m oydoptn ieias) 2tau o;t4ope moetadla rlnvo;()teeoxf3oydlptrau o ( sexrio nydape  ivtls aruaxm oo4oet  feiytls emums;t0 exoir3iodopDr uvs;t  rum(o iy4apeemfei s  2ua(  ;t1texn fetlt s2um(vo;u) leoxo3ta1fpD  nei;t  2tr(o nudol nmfvs ()a2uru oou1alt mfeilt sDul(vo;t)tltnmocoodfm rauvi;s) eurxm nu4lmeelivi (  rraumpnu1oet mictydla ra( o t4tlerxr3ootfmt  ueslt0s2umim iodll  lnct s srrrx pou1apeo iciltlm2emnvs t4trtomr3iodlp r i s s)s2umim no4om e fviat srtmxmo;u4tlxoifciaslmDul(vsnu)aeermrcoydomt ln sls  2toio3nu1al emicsl(f Drrxm no0opxnmo3iadfa2eauvpn(0 lerxo oadop  lieols0trxmio3iu1oleelics (  rtr(rpou1aetn oetad m emuvo;t) rtomr3iodlm  aieo;( srtoimpno4am   fciatf rtmu pno0tlx mi3iytfmDrlnmo ()aetomociatfatran ol(0texrxr io4lmee fct tfs2rr(monu4aetnmo3ilsfm uln p (4tlenmrctatlpDr nvslt texm(mpiu1omtnmnetltfartmxmonu1alx ifeiltfs elump t0 rxoxrctotfaDrau o t0s2xo(opiydlpt mfeils srtrxmooo0aee  ictydfs2em(vsnt) lxoir3iatfp rluvo;t)s2umxmpny4al n 
\ No newline at end of file
@@ -0,0 +1 @@
+n s s) 2urxr3oo4alt  fes t  Duax  nt0altnifctyslm um(mp (0arenir iydla e ues;()s2trio3no1ll  lfvsat s2rm(ro;o4aeenmi3iydfm ea(vpn(0alenio iy1laD lu s;()t2trxopoy1am nmfeia(f Dta(  nu1oetoiicilt m uan pnt4aleoifciodlm ran i (0srur(rpnu1ll nlfesas sDuau  nu1tee ifciltlmDuanvo;u)teermf3oatoatrln sls)t2tm(m nydomt lfciatf rtm(rp;t4oeeniieildlaDra(vs;t)aetnmf3iatfaDr u o;(0seuo(opou4lpenlfetl()sruaurpot4tpe iicilsfs ulu on() etrxf oatopt anvols0srxrxm iy4olen ivta( sDrmu  ;t4olt  fcildlmDulnmsnu)tltrxociadfaDr nesl()teuoxm no4amenmneilt) rta(mpot4tee mfeiytlsDul( p;u)artrmrctadfmteaivol(0s2um(rpnu4al n ics t)aDurxroou0optnmfciysla2umnvsnu4aetrxf3ty1fpt lueo (  rxmirpiy4lm nmnetatf ruaurpno0oleoioeiatlmDrau s;t)altoif ta1fatrli s;s0s2xo(m3nu1al nlfvtlt) 2uax p;t1aptn f3iadlsDuanvonu)tlenxocoa1lptrln o t0s2uo(rpiydalenmfvta( aDrru  ;u1tptnmieiad s2eluvp t)artnio3oadfatr uesls0srtmio3iy1open fetl(farum(rpnt4oltoiieiaslm ea( snt4tetniocio1om eaueolt0sruo(o3nu1am n fvtl()artaumpno1apx  feiltfmDean p;t) reniocoadopDr u o () rto(m3iu1al e icta( a2taxr ;o1tetnmf3iysla uau sn(4 etrmo ia1lp  aieo ( trtmxo3iu4omeemics s)a2um(mono0tlxomo3ias aDuln o u0alxoxr ia1fptrln i ()tetmim oodal  lnci s)artr( pou1aleoif3tad s um( o;u0tlxoxo oatlm  ln ils)srxmxm3nydom  mfvsls)arrmu o;u4oexo ieiat a elnvp ()tltoxf3io1opDelivi t s2tmxo no4ol nlivias srrrx o;t1oeto ieiydlaDelumo;t)aeenxf ta1fp ean sl(0 2xmxr iydale  nvtls)aDrr(rpou4oet moeildlaDem( o u)teeomo todfpDelnvo;( seuoxm iy1ap nlnet ()aDtmurono4alxo oetas s2um(vs;u)aetrmr3to1fa eau il( srtr(m3iy1lptemfeta() Dtrxmpno1apeomicilsla uln o;u0 leomocoytlatelnvo s0 2tmxr3iudoptnlfeiatf 2rmumo;o1olto fciyslaDrmnvp;()arxrif oytopDrluvs;s) 2tm(m3nydoltemfei t a2tmu ont4olx mf3iytlm2umn snt0artnxoctodlmteli s;t t2trir3iy1lm elfes sfs2rrxr no0oexnmiciad m ua(mpnu4texrircia1op e uvo ()setrxmpnudlltn nci t srrr(r oo4tptnmfeiatlsDumump t)arxnxf iatfmteau s;t sruo(r nydaltelfvt s)srurxrpot1ape mocilslmDea(vont4tlenxf ootlatraneols0trurir3ou1lmenlfct t) 2rr(  no0tptoifciydlaDelumpn(4tltriociadlaDeaneo;s)seuoxr nydapenmicta()s2tax pnt0olx mfeiasfa emu o;(4trxnif totlaDrli i;()seuo(opoudaptnlfvil(fs2rrx oou1oeen fciad m rln ont4tltomfcoydfaDrln ilt) rxrxr nydlpen ivsatf Drau  ;o4alx miciytlaDum(vont4tlxrxr3oy1lp rlnvilt0 euoxm3iydll nmivs sfaDum(m nt0alto f3tlsla2el( snt4tltrircoo1oat lu i;s0trxmir3iydomtn ivias aDrm( poo0oeeoiieiad m2uanvo;()texomoctotlmDr uvo t)texm(o oy1ol n nvs t  Dumur nu4oexn ocild m rmn p;(0teerir iadom rau sls0s2urxm no1al nlfct t sDtaxronu0aptoioctysfs2uanmo;u)teenmr3ia1laDr nesls trtr(r oo4lptn feil( arrm(ro;o4apt io3iatls rl(mp u0 rxnmfcoadlp elnvi;t0 eumim oo4lm nmnvta(fsDrau ono1tptnio3tadfm rmnvs t0 lenif3ta1oatrlnei (0 2xo(r3oo4ll  lietl()s2uax o;t0tpxnmfcils m rmuvs;t4 etoxo iytfp r uvil()t2trxr iudopt mfcil(fa2urxroot0alxnmictasfsDemuvsn()arxoir3oydfmD lu s (0 eurxm no4lptnlivsa(fsrurumo;t1olx mieiydlm rmuvo;() lenmf3iytlaD  iei;s0sexmxr iy4altnmivi t  2ra(rpot4tex iieiytla2umump (4 exnxf oy1lm e ivils) 2tm(r3nudomtemiciasfsruaxronu4oltn o3iltfm2umump;u)arenxocoatfateaivslt)seuoxrpno1optnmfvta()s2rmx poo1oleomfeiyt m rln s t4tetnmociadlp  aneo;s  2xoio ou1ape  ivsltfs2uaumo;t4aexnifeildlsDumumonu4treoifctatop e nvi;t)sruoir ny4aptelncs t s2trxmpot4oetn o3iytfa2el(ms u4alenio ta1fm e uesls sexo(r iy4amenmicsat) rurxrp;u4opt  fctadfsDelumpnu0tlxnir3oodfp   ivolt)sexmio3oudlp elfvilsf 2raxm ;u0aeeomictyd mDel(vpnu4 eerif3iotfp eaues;s trur(r ou4lltemfvsl()a2trxro;o0tetn f3iys m2rlnvonu4teermr tytlatrau olt)t2xr(r3ou4am nmfcs ()a2urum nt4opeoio3tls m ulu o;t)aexriocoo1lat  neols0setmir3nu4om nmfeslsf 2umx poo4tlto i3iysls2uan pnu4trxrxo oatoaDelies t)trxmir iu4ol elfcta()srta(mo;u4oex moeilt m elump;u0 lxnmocoodla ran i;(0 rxoio nu4ome  ietl(  2tm(roou0aeenifetys a2eln p u)tleoifcoydlaDe ivs () eurxo ou4lmt mieiatfaDraxr ;t4oet mociydlm rlnvp;t4trtrir io1lpDrlu s;(0 rtr(m nydap  mnciat)sDtm(rono4alxomocilsla rm(vpnt4tltrxrciydopDelnvs;t trurxr3nu1lleemfct () Dtaxm nt1apeoiieiytfaDeaump t)teeomo oa1fmDraieol() 2urimpoodlmenlfes (fsrtaumpoo4olt ifciad aDemu s;(0trtomf3tydlaDrauvo ()truo(m3ou4ole mivia()sDrrurpnu4opeo feiytlm em(vpnt4aeenir oadom eaiei;s trumimpiydal  mneil( aDraumpno4tpenio3tys mDem(vs u) lermoctadfpDe i i s)t2xm(m3iudoltelfviat artrx  ou0texo o3tltfs ra(vp;() rerxfcoodlateliei t0srumimpiydomt livs s)s2ua(monu1tet  ieiatlmDrm(vsnt) rxoio3iy1oatr uvi (0teuoxr3iy4apee net t)aDrauroot4olxoii3iysfa2ranvs t4texoio oatomtrai s t) 2xo(rpno1am e ivtls arurumono4optn ictldfsDrmnmp u0tlxoir todlmD anvolt0trtmir iy4ol e iei s srrm(mo;o1aetnmf3tas mDumuvonu)artomr3oydlmt  n o;s sexr(mpou1ap e ivilsfsrrax ont0olen f3iatlmDum(msnu4artrmfcoadoptraies;t  rum(mpnu1omenlfvs s)srtrx poo4tleomf3iat a2emumo u4 ltomr3oadoa elivs;t)t2xrir3nu4ape mfesls)arrmxrp;u0apenif3ilt m ea( o;(4 leomrcto1lmt lneo t)t2xr(o3io1op elfvt t)srururo;t4aexoiociadfm rl(vp u0teerir todlpt ln s;t0t2tmio3nu1lptnlieta(faDta(  no4apenmfeiasfa2ulump;(0trtrmrcoadfmtrlues;t0 euo(o3io4ole  neia(  2um(mooo1aexnio3tys sDean onu) rxoxo3oy1laDrlieols0sexm(opiy1lmenmnvtltfarraxro;o1aptnmi3ilt a2em(mp;(4arxoxf ia1opDe ieslt0seuo(r oy1aleelicia(faDuax o;o1tpe  feildfm2rm(vo;t)trtoxr3io1lmtr i o;s0t2tmimpoy1openlnvi t) rurx  nu4olx  oetls a ranvp u4 rtnmo3iatlate iei s)t2tmxr3ou1om  lietltfaDta(m ;t1apt  oetlsfsDra( on() ltnxfcia1lpD auesl(0tetmiopnu1omt lfet ()sDrrxm nu0aetoiicils a2ra(mo t)tlxoxo iatlptr uvi;t0sexrir3oydol n nvsas s2uaumpoo4tleo iciatfmDem(mo;t) lxnifctatlm r ivs s0teumir3iy4ap   fctls aDrm(m oo1tpeoiiciyd a2ean s t)aexnxf tydfa e i o;s)teumim iudome lnvi (fa2urxrp;o1tlxniictasls2eauvs u0aexrmf3ia1omtrlnvo;s)s2xm(o3oodap e nctatfs2taumoot0alx ioctld a2el(vsn()trermocta1lp elu olt  2ur(m3ny4lp   feil( aDumum nt0tpenmo3tldfm2uln s;u0 ltoxociadfmD lnei (  rumxopoudop nlnviatfsDtm( pou0tpxoio3tys a ean s;() rtrio iadopD  ivs s) rumim3oydolee nctat srurxmono1apxnio3iytfa2eaumo;u4 ltrif3ootlpD lneilt)srtmir oy4ap n neilsf Duax ooo0tptn oetlt mDrmn o;(0trtnmr3iotla  anvsls) rur(r3iudolt lnes t aDtmur nt1tlxomfctldfm ea(ms u) rxrmo iy1latr uei;() 2xmim oo4lpt  fctl() Durxmp;t4aeeoiietyd s umumon() lxrxo totfpDelivslt)srto(r iu4altelfeslt srum(  ;u1oexnmicild a2eau s u0 reoxo3iodom r ieils0trxo(r3nu4apte fct s) rtmu o;o1tet iiciydfa eluvon(0tlerio ootoaDeaivo;t teuoir iodlp  mivta(farumurpoo1oex  f3tytfs ra(ms t4tlerioctadlp rauei;t0teumxm3no1omtnlncsatf rrmuront4aexoiociydfa2rmu snu0teeoxf3tadlpteaneolt seumxm3no4lm elneils)arrmumpnu1oetoii3ilsls2emn s t) etomr3tatoptr ueo (0t2xrxm oudameemict t sDtruro;t0apxnioeiatlm2uauvp;(4texrmo ootlpD lu ols s2to(opoo4omtn ivi sf rtr(r ot1apxn ieias a2rlu o;(4aeermo tytoaDe uvo s trxmxm no1al nmnctl() rrmxmonu0tee ioctltls2ulumsn(4artnircootoa  li ilt seuoir oudlmtelfesatfa2urxm oo1olto fciyd a emuvpnt0aexriocoytomtr u s s  2tmxm3oy1ol elfctl(farrr(ronu4tpxnmfetat a ua(vp;(4aetrxr3iodfateaneo;s srxoio3nydap nmnvils) rra(m ;t1tpxn ociyd m2eluvo u4 rxoir3ia1op rauvi;s0sexm(rpou4ll nmictlsf rurxmonu0aeen f3iyd a2elumo;(4texnio3tatlat aueol(0 rxrxo oy4lmt lfeslt aDrax pou1ale  fciad m el( pn()tlerxo3iatfpD luvsl( s2xrir3io1lp elivt t)aDtaxr ot0aptnioetyslm rmu s t4 rxomf oo1fmDe u ol(  2uoxrpiudlm nlicsl() Dtrx ont0openmf3iatfm ua( p;t0artnmo3tytlatranes;t  exo(r ou4aptnmnvsa() 2um(rp;t4opeo i3iasfmDrl( o;t0trxnxr oatlmtr ivolt0sexmio nydlpt mfcsl(  Dta(  oo1oltomfetad m2eanvsnu)artnmr oodom r ueilt)s2umir nodam n nvta() 2truro;t4teeoifcildfs2em( s u) rermo ty1fm e i sl() ruo(opno1opeemncsl()aDraumpou4tpx mfciysfmDuauvo;t4trermrcootoaDeaivi s)setr(mpoodlpt  netas a2ur( oot4tlxn oeiyd mDrmnvs t)tleomrciytfat  nvo;t0teur(r3oydaltn fetasfsDurxmonu4opxomo3iydla2rmn sn(0treomr ootoa  lnvi;(  rum(opoy1al nmiesltfaDur( pno0aee  o3iysfa2umuvo;() lxnxo3oodla  luvs s0setoio nodomt  ieil(  2rru  nu0opx ioetyt m2ulump;()treoxrcia1opD li ol()teto(r3oo4apt mivils sDtru o;o4tet iociysfmDranmo (4 ltnio oo1fm raivsl()srxoirpoydlm  lieils  Dtaxroou1opxo ociatfs2umu pnu4alenmociytoaDr uvo ( srxoxo ny1opt  fctasfsDtm( p;t1tpe  fcilslmDuln p;t0treomf oodoaDeli s s) exmxm no4lmeelieil(farrmu  ot4optnmiciatfm rm(vs u0 rxrir ootfp r ueolt trxoio nu1om emics (fs2ur(ro;o1tleoiicilsla rl( pnu0tlenxoctytoateli s s0truoxr ou1opeemnvs s) Dumxr ou0aeeniietlt sDran pn()aeenmfcoy1oa   ieo t0srumxo3iy1lmtnlfvt ()sDumxr ;u1oltnifciadls2eluvp;u0aexoircta1lp   nes t srur(o nu1opt  ietat s2rm(r ou0tpt  i3ilslm rau p u4aexnxf oadfm eanvo t) ruo(m ny1amtnlfetlsf Dtax  ;u4oee iictas aDumnvs (0altnif3io1laDr nvs (0srtmir3oo1lle  fes t srtr( pou4tlxnifctatfs2ua(vs;()trtrmfcoytoa ranvsl() exo(opnudlpteliet (  2rmxrp;t0ope  i3iad a2rluvsnt) ltoif3iatlp elnvi (0s2xmxm oodom elivt t  Drm(mono0alenmoeiytfsDra(vp;(4 rxoif3oatfatelnvo;s srtrxmpiydlpe liviasfsDrrxm nt4alt  fciadfa ranmsn(0alenxr oatla  aies s truoir oodopt  fvsatf Draxroou4oleoioctldfa2rln p (0tlermr totfmD  ieo;(0teumxopoodapenmfeiat)s2trxm no1teenmfcilslaDea( s u4alenif3iatomDrlu i (  2uoim3iy4ome  ietas)sDrrump;o4tlxnmfetydla2rlu p (4arenxf3iytla  lueo (0 rxrxm ou1ap  mict s)a2ta(rooo0oexomicils m eau s (0 ltrxf3oa1fmDrlueols)sruoxo3oo1amtnmfei s  rrm(  ;t1tetomiciadlmDum(mp;u0 leriocty1omD ai s s0trxm(opiy1lpe mfcilt sDtrum oo4ole micilt sDrl( snu)arenif3oytoaDe ueo;s  2xrxr3iydllte nciat)aDumx  nu0aexnmictltfm2rmn s;(0 lxrmr3oodomteli s s trxr(m iy4omtnmneiasf Dtr( p;o4ole mfciltfs2rmuvp (0 lenxf3oadfpDeai o ()s2ur(o nodome lfcslt) rtrxr ;u0olxo ieildla2umn sn(0arxnir io1laDeaneo;t)t2xoir3nodlptn nesls a2raurp;t0tptnii3tasfsDrlumon()tltrir to1lmD ai o;()sruoirpnu1ome  fes s sDuaxrpoo0aptomo3iytla2rlu p t0tlerircootfm r ueol( trxoxr oudomenlncil(  rrrumo;u4apenmi3iytfa2umuvo ()trenio3oodop rai i;() 2uoir3nu1lmt mneia()aDtmu  ;u0ale mfetls s2ulnmp t4areoxr3todopte nvol(0 2xmirpno4lpee ncil(farra( ont1oeenmieildlm rln s;u4tlenirctodfmD auvi;( srur(mpnu1lm  licsas)arrr(moot0tpt iictytfsDrluvpn(4trenircoadop  au i (0 2tm(m oodale lncsa()a2trum nu0oltomo3tltfs2rauvs (4 exoxo3totomtr nes (0 2uoxo3ny1alt livi t)sDtmum ;u1tetnmi3taslm2emums;t4tltnxocia1fp rluvsl( trurir ny4apenlfetls)a2rrxrp;t1alt mf3iyt aDul( p;t0arxrxoctytoatrau i t0 etrxopoy1ap  liviatfa2trxmono4oexnifetat m rmn snt4trtoxo3oatoa   n sl(0trxmxm ou1ll  mieilt s2rr( o;o1ole  ociat s2ulumpnu0altoiocoadlm  aues;t t2tm(r3oodllt mfeta(f ruau p;t0tltomo3iysla2ul(mpnt) lxomr3iadlptelu slt)srtmir3nu4am e ivi ()s2tr(  ;u1ope moeiatfa2ran ont4aleriociodlmDr ies;t0 etm(m3nudlltnlivsa()sDumx  ;t0tpe mieiatlm rlnvont4 rtrio3tatop e iei;(0sexr(o3oy1omt lieslt  Dtr(mont4aexo f3ils m2rln snt4texoxo io1omte ies t s2xrxr ny4amee ieils sruaurono0teenmieiydfa ulump u4trxnmf ootopDran s (  2ur(o3nu4aptnlnvta(fartrur ot0tet  oetldfaDeanmsn(0teerio3oo1fa   i s (0s2umxr3nu4om n ici ()arrr(rono1ale ioetat mDuln p u4tlxomr ta1omDeaivsls  2xoxrpoodol nmnet (  2ur(  ;t1alto oetasfm2rl( o ()arenmfcia1op rliesls0srum(r nu1lmenlfet t  2tm( oot1tlx moeiadfm2rluvonu0texnif oodfp   u i t  2toxo oodlpe lfcta(f Drau onu4olx  i3iad mDrmnvp;(4 eeoir tytop r u sl(0setoxm3oydlltnmici (faDtaur no0oetomf3ias s emnmpnt)alermr ootfp r ueol( srxmxo3nydop nlfvi (f Durx  oo1tpxoiiciasls emnmp t0 eenxf tytoa   n s;( trtoxr oydopenliviasfarur(mo;u0opt  ietyt sDuau s;t4 ltoxrcoo1oaD lnvi;t0trxrxopio4apenlfvtls)a2trxroou1opeo f3ilt m elnvs (0 rxrmfcoo1latr i ols0 etoim3nu1ap e nvtas) rtmx p;u0aptomi3ils m2eau p t)treoio oydlm   uvo ()setoirpno4am   neias aDtmx pnu0tlto fcilslm umu onu4tlenxo3iy1fmte ies;s s2xmxm3ou4ame lnvs tfsrtmu  no0tpxnif3tyd s uluvsnt4aetrxfcoa1oa eli i;s  2tm(mpno1ame lnesls) 2rm(m ;u0tlt  ociasfm umumo;(4 rtoxo3tydlpt li olt  rxmxm io1lmeemies tfsDta(ro;t4aptoiietyd s rauvs;t0altrmr3oadoaD anvs t  rtmxm iu1alenmfvi ()aDrmxm ;o4tet mociasfs2rm(msnt)altrmo io1fmDe nvi;t)setm(m iy4omeelietatf rurx pnu1altn o3iltfa ranmp t4artoxo totlaD luvsls)truoim3iodlptnmncsls)arrrurpnu0oex mocilsla ulnvp;(0 lenmf ty1oa  ai s;()tetmxrpiu1oltnlnctls) 2rmx pnt1open feiytls2elumsn(4tetoxf to1oaDrau s t teuoim3oudomee ietls aDtaxro;u0tptn o3iatlaDumnmp t) eerxrctotopDean ils0 rum(r ou1lle livtl( a2urxrooo1oetnioctat a uluvs (0 eeoxf oo1fptr u s ()t2xrxm iodol nmiesatfs2rrxr no1ope ii3iad s2ul( on(4 reoxf3iydfmDelueo;s0texmxr3iydal n fciat a2rmu oou4aexnmoeils m2ulu o u4texomr oa1fat li o t)t2trim3ny4omeemfvslt)arum(  oo4aleniiciadla2el(vs;t0aetnmrcoydomDeli i t  2xrio iudome mfcs s)aDtru pou0olt miciytlm ea(vpn(0arxrir oodfptean sl(0 2trir no4lltemiei t sDtaurp;u4aee mo3iadls ulumo (4aeenmfcoo1lpD auv
\ No newline at end of file
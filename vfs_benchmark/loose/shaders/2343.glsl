@@ -0,0 +1 @@
+ues;s)teur(opou1ll elnvsls)sDraxrpnu1olx  ietasfaDrlump u) rtnmociatop   i il() exm(m3nu1lpt mivt t sDuax pot0ole mociydfa uauvpn(0treomf3iy1fm  ai i;( setoirpny1ope miesl( artrxront0tpenif3tadfaDeanvo;u0alermf oatfmt lueols srxm(opnodamtelivta(f 2truront0apeomoetytfm2rlnmo u4alerif oytopDrlues (0 rxo(o nodoptnlfesatfa2tmx o;o1oetomi3tatfm emuvp;t0arenxrciytoaD  nvil(0teuo(m nodll emnesa()sDtmxmont1apeoio3ils m rmnmo;t)tetnxr3iadlaDe nvs;t0setmiopiudoptnmieil()sDrmx  ou4oee ii3ildls2eluvo (4teerir3to1fmDrli i;(0 eum(mpoy4optnmfvs s)artaumont1ole mietltfs2umnvp;(0teeoxr3iatoaDe nvol(0 etmxrpiodoptnlicia(  Draump;t0olxn ocilsfmDua( s;t4aetrxf tytfaD  neolt trxo(r3ny1alt mfvi t)srtr(  ;o4tex if3ilt a2eanvsnt)trxoio oadlptranvi;s s2xmxm3ny1aptnmicia(faDuaurpnt4tpxnmfcilt sDelu p u0alxniocta1laDr n ol(0texr(m3nu4lpeemfet s) Dra(rpnu1tlxnmoetydls2rm( on(4tleoifctotfm  anvo (0setoim3iu1al elncslt srtmum ;t1aeeoioetyd s2eluvp u4texrio3ootfatrli i s trxm(o3io1opeelfvt sf Durx pou4altomo3iasfsDeaums;u)tetoif ta1fpD  ivo;s trxoio nudomeemivi ()a2uru o;o4tpxoif3ildla ul(vs ()trtnmfcoodlp rauvi;t  euoir ou4altemies (fs2ua( p;u1oexoio3iat s2uanmp;u4tltnio3tadfpt aieslt)t2urir nodaltnmnesat sDraurpoo1apt io3iasfaDelnmp (4 lerxfciy1optelu il( setr(r3no4om emnetl( artr(  nu1olxoii3iltlm2rlnmsnu)altrio3iotla   uvs t0srtoxrpio1om nmfeiasf ruru  ot1alt  icild s emumsnt) lxrxo oadop rli o s0 exmim ny4lpt liesl() 2uru o;o1apt mieilt m2uau o (0aetrxo oatomD aivsls  rtoxrpiodlpen nvta(fsrtaxmo;o1opxo i3iyt s ulnvo;(0 exomf3io1fptraues s  exoim iodlleelfeiatf Dtm(mo;t1alxnmieiytlsDuau s u)artnxr ootlmDe ueo;(0trtr(m3oudalt  iciat)artmum ;t1tptn ieiytla2uan s;()arerir3oy1fmD ai o;(  etrio3iydapt  fci tf Dtrx pnu0teto fciadfaDua(vo;() leomf3totlatr u s (0texoxopoodal nmicslt  ruaurpnu4tpeomfciadfa rm( ont4aexoxocoydom e uvi;t texo(opio1am n netas  2urur ;o4alt if3ildfs2rm(ms u4 reomo iadfm   nei t)seto(o3iodam elietat)a2rau  nu1tlxnifeiyslaDelumon()tlxnmo3oydoa eai ol() etmxmpiu1amt mnvil(farrru pot4ole  i3tadfa ulumpnu0tltnmocta1lm r ivi (0 euoim3oy1lptemnvsls)aDta(  ;u1apto iciyd a2uaumont) eenmf iydlaDr ueil()t2tr(rpiydalenmivta()arrrur no0tltnmiciat a2ulnmo;()teerircto1fmtran s;t0 rxo(m oo4ome mfcta( aDtmxmonu0tltnii3tadlm2ranvp (4aexnmr3iotoa eln s t)trxrxmpio1oltelnct s)sDuaur oo0tle mo3taslaDumnmo;t)arxrxo3iatop  liei s0 2tmxm3oy4lmt mnci ( aDrrumpot0ale  oeiydfmDrlu s;t0trerif ootoa e n sls) rtrxr3iydamee ivsas  Dra(m ;u4aex ii3iys m2eaump;u4tetomr3to1fp eliei;s0t2xo(o nodap nlivs s)srumx pno4tptnii3tldls rlumo t0tlenmf tydlmD ln o s t2uo(mpou1ol nmies t  Dtaurpot1opt mf3iyd sDelnvo;t0trxnxfctotlp eai i;()srumxrpno4op nmfcils aDra(ront1tpxn f3tadfmDulnvs u) lxoir tytoa elu s;( s2xmxm io1lpe mnci s)artmum oo4opx  ietat sDul(vo u0trxrxoctydfmDraueilt0 2xmxmpou4lpen ieils)srtr(  ;t0oleo fcilsla el(mo;t4 ltrmo iytopD lnei t0s2to(opoo1lpe mfvtatfsrumx p;u0oet if3tltfm uln s t0 rxoxo tytlmDraues;t s2tm(opou4oleemnvtlt a2tm( oot1aetoioctat s2um(mo;u4altnxrciadopD luvi t seuoir3oy1ape lici s)srua(r ;o0aptomoeiadlsDel(vo u4alenmrciy1la rauvo s)texmxmpoodlm  lfvs tfsrrr( p;u4aetoii3iltfs eanvp;u0arenxo3oydlat  ieilt)texrxm nydlmt mnctat a2rmuronu4apt micildfa ea(vpn(0 exnxrcoytopD au s;s0trum(m3iu1ol elneiasfsrtrx oou0tpen i3iaslaDrmu p u0alenmf ty1lptraivil(0s2umxr3iodlmeelfci s) rrau onu1aptnioeilt a elu o;t0alenio tydlaD lnvsls0 2um(mpnu4oltelfetat)aDuau ooo0aetn ieiadfaDrlnmo u)altoxr3oatfa r uesl()t2uoxr ou4optemivils sDua( p;u4olt  ieiltlm2eau s;(4trenmf ia1fp  liei;()teuoim3iy4lltnmncsas  2tmumooo1tlxn ieiydlm uanvsnt)trxrxrciatlmDe i s;t)srxmxo3iudolt lfcsl()aDtmump;t1oexomfctldfsDeln p t0 exnir3oydom elu slt)t2tmir3ny4om  lfet (fsDtrxmo;u0aleoifctltfa raump t4tlxrio3iotlp ran ols  rxo(r ou4oleelfeias)sDtrxr no1tlxn ieild mDrau snt0 etrxrciodoat  ieo ( t2toio3iy1lltnmnvtlsfa2uru  ot4oleo iciadla2rlnvs ()aeenir3oydopDelues t0teum(m3io1om elfvt s a2ra( poo1alxo fcilsfs emu p t)aleomr ty1omDeaieil()s2um(m ny1al  mivt t  2rrumpnu0opto fciatlmDrl( on(4arxrmo3ia1oaDe ues t)t2xm(mpoo4ll   nvilt)aDra( pno0ale mociaslm2ea( s;t4 rtrxf3ty1laDranvi t t2tm(r io4apeemfvilsf rumxro;u1aleomieiyt s2emnvs;t)arxrxr tydlp e u s s)trum(r ou4lpenlfet () 2uaumo;t1opt mf3ilt s ean s;u4tetnxfcta1faDe n o;t0setrxmpoy4ap elfes s  2ta(m no0oexoio3iyd a2rm(vo t0 rtoircto1fm  li s;t s2xrxrpnu4lltnlnvt t)a2rrx pnt4ape mictld sDul(mon() lerif oatfmtrau ilt t2xoxm oodop nlfvsls)s2urur oo1tptn iciytls elu snt4altoxr iotlpDrlieol()srurxopoo1apee ieiat a2tr( pot4apx mfctlsfa rmnmpnu4 rerifctatlm   u olt0 ruoir oodlptnlfctl( s2trumooo0alenmi3iyt s emu p;(0tlerxo oydlm eaivs;s t2xoirpnudapen ivi t aDrmu poo0tlxoif3ilsfa2rln p;u0alxrmr3todop rlueils0t2xoiopoodapt  ieil()s2tmxmooo0ale mietydfmDeau snu0areomo ty1lpteanvs;t) exm(r io1aptemnesl( aDrrxmont0oet  feiyslsDulump u0 lxrmfcoa1oaD auesls trto(r3nu4al  mnctltfartaxrpoo1alt  ocias s2el(mp;u4aexnxf3oo1fpDe ivi;(  etrirpoy1lpen fvtlsfarrmuroot0oeenmf3iytls ean s;u0teenmrcoodop ran i t)setrxo oodalenlict ( aruaxro;t1altomfcilt aDrm( s u)teenir tatoa r ivols) 2xoio oy4ll   ivs t artmxmo;t1aex  oeilslm2ea(von()tlxoiocoytoat an sls t2tm(o3oy4op nmfvsl(fsrrru o;o0oet ii3iydfa ean o t0 rxrxrcoydla eanvil()s2toxr3ny1lptnmnvils arrr(ro;u1tlt mf3ilt aDemnvs (4 lxrmf3iydoat aiei;t sexm(r3ny1aptelnvtlt  Drm(rpou4tlxomieiydfmDrmu onu4altrircoydfm eluvs t)sruoim3ny4oltn nvtlt s2tm(rpno1oexnmf3iad m rm(vo (4alxrxf3tydomt ln ilt)setoir3nodamtelnvslt sDurumono4aetoifctytlm ean snu0texnxrciadfmte i i;t  rxr(o nu4ol elfeia( s2trxmpoo0tpt  ieiytla2rl(vs u4 reniocto1fmtr neo;s0 rxmxopoo4apt licsa(f rtm(m ou4tetn i3iatla2eanvs;u)tleoxr oytlpDrluvs t  rurirpiudlle lnesltf Durumpot0aetomoctas a2el( s;u4 exoxfcoo1oa r i s;s0 rtr(o oudlm   fctas) 2taxmont1tlxomoetysfmDem(ms;u) etnmr3oy1fm rau i;s0 euriopoo1om elivt s  2rmxmoou4tee mfeiad mDeaumo t) eeoxr3todoaDeli s ( trtmio iy1ol  mneils srtmumoot4alxomoeiat mDel(vsnu4aeeoif oy1lm e ivols)trxr(r3iudol elfeiat srtmu p;o4olt ioetlt aDrl(mo t0 lenmf oydlptrli slt)teuoxo no1optelncslt sDtmxmpnt0opt ii3iydfm uanmo u)trxnmf tadfm  ai s t  2xm(r3oy4oltemnet t)a2rm(mpno1teenmfeiat s emn s (4teeoirciotomtraies;t0 etrirpnu1amt  ivt sf 2um( o;u4optniieilslsDrl( o;(4trtomrctadlmDrlnei ( t2xmio oy4omte nvtas)s2rm(ro;t0oeeoii3iatfm2eauvp () eerio3ootfptr ieil()s2trim3iy4omtnmfci s sDuaxrp;o1oeto ictat a elnvpnu0 eerif oa1op r n o;s teum(m3ny1lpt mnet s)aDuaxro;u4tex  octysfa eluvp;(0aeeomr3oa1oa r ivi t  2uo(r iu1ol n fviat)aDtaumont4tpt io3tlsfm ul(mpnu0 rtnmr io1lm  an ol()trum(r iu1lm  mfeilt sDtaxmp;t1alxo oetys m2rm( s;(4teermo oy1fat lnei;t0setoio3nodal   ncilt)aDrmur ou1tptnmoetatfsDuanvonu0 rxrxf3iy1lmDraivsl()texo(mpiy4ap n fesa()s2raxmpno1olx mo3tat a em(mon()texoxr ootopt ai ol(  2tr(m3oodomt mnvsa( srrru  ;o0oexo iciasls2ulnvs (0arerxociadfmtrau o s0s2tmir iu4om emfvt sfaDuau pot1tlto ociadfaDrlnvs u0aeeomo iodop elneo;t s2xm(rpoy4omtelics ( sDum(r nu0openifeild mDelnvsn()tlerifciotlm raues s  rum(mpoy4lleelncs t  rrm(r nt1ole  ieilt aDrlnmont)aeeoif3oodom rlneo (0 rumirpio1openlfes s  rtaxmpot0alx  f3ias s2rlu onu4tetrmr tytopDr iei (0 eto(r3oy4op n ivta()sDuax  nu0apx if3tas mDem( p t0 etrmr oy1op raieolt)sexmim no1olt lict s sDtr(rpnu1tet mfeiltfm rlumsnt) rtoxf3iotom elies;(  ruo(mpou4am  lfeils)a2urxmonu1openmf3iydfa2rluvo t)trtomo oadomDeluesl() 2toiopoydamtnlnvsasf 2tmumont0tpe ifetad m2uluvp;t)altomr oadfmtelu s;s t2xrxr3iu1om nmivi ()arrr(m nu0oexomfciad mDua(mpn()alxrmr ia1op  auvi;s sexrim io1amenlnci ()aDumx o;t0aee miciad s2uauvpnu)tleoxr3tytlp rau i s)texoxrpnudomtn fcs s srumum no4optnmfciyt s2eln p;t)tetnifcootoate nvi s  etoxo oodlltnmnetl(fs2umumpnt0aexomiciys a rlnvo (4 lxoir3iatlm e n sl(0t2trxrpno4ol  mics sfsrrmurpno0oleoifctyd a umump (0trenio3to1fm rlueols0 exrir ny1lmtelnei ()srtaxmpnt1oex mieils s2ranvpn(4altrifcoodlm eluvo;t  rtoimpio1lmtnmnesas a2ua(m ou1texn fetld m2emu p t0 exnmo3tatomt  u o (0t2toiopiu4lleelfes sfsrra( o;u1tpxo octytfs ulnvp t)arxrxrctadopDrlu o;(  eurim ou4ll  lies ()sDrr(ronu0apen o3iytla2umn o;(4arxrxo iadom  lneo t0srtoim3oy4apeemnctl(  rurx p;o0oleomoeildlmDrmn o;t4altrir3oy1lat ai o;s s2trxrpnu4lmenlicsl() 2trx pou4ole  icias a ea(vp t0 lenif3iadlmtrlies t srtoir no1lmeemfcilt arum(mono4ape miciat sDrm( pnt0 ltrxfciatlatr ivs t0 exo(o3nu1ol emfvsls)arra(  nt4aptomoetlt sDem( ont)trenircoydlm   ues (  etrxrpnydopeelnvi s  2tax p;t0aetomieilt a rmnvon() renmo3oadla eanei t0srtrxo3no4op elfcs t)srurxrpnu0aetnmieiltlsDrm( o u) rtnxo ta1fm r uvils trumirpnydlme mnviasf 2trxmpno1texnioeiyt s rlnvp t)alenmr ta1fmDr nvs;t) 2urxo3nudope mfci (farta(mo;t4aptnmfciat a rau onu4altoxo3tydfm rlueilt0t2toxo3nudoptnlietltf Durum ot0tpen ociydlsDrm(vs;(4 eeoxfcoodfmDrlneol(0trtr(o iu1ole mieta()a2tmu  oo1ole  ociatfs2rmn p;t)trxrmrctydom  ln o ( texmxo3no1amt lnvtatf Dra(mp;o0apt io3tys a2ea(mp;t) lxrmf iatfpD  nvo s  2xoio nodalenlfetatfarrau p;u0olenifctltfs ua(mp (0 ltnxr io1late u ilt) euoir3no1apen ietlt sDua(m oo0tet  fctltlsDrau s;u)arxrirciatlp ran i;(0setrxm iodopeemiei sf Draum ot4ope ii3tadlm emu s t)aleomf3ootoaD  nei ()s2to(mpoudop nmnvtlt)a2rm(mp;o1olenmietys m el(mp u4aetoxocoytlaD aiei ()trur(o iy1omee ici t s2trxmo;t1optnmfeiysfs2uanms t)tlerir3oytfm elivsls) ruoim nudal  lfvsasfsDraxm ;t1aexn o3tltfa ranvo;()teermo iydlpDeaueo ( srto(m3oudal elfct ()artmumpno4tlxomi3tasfs2rluvo t4arxnir io1oa rlivs;t  etrxrpio1aptemiciltf rtmxrpno1texo feiysfmDea( snu4trermo3ty1lp  ai o;s s2urio3oodapeelnctls) rtrxmpoo4teeo feiadfsDeanvon(0arxoif oodopD  iesls  2urxmpoo1optnlnvi (farrmxroou1teeoiictytfs2ua( p (4 rxnmfctydoateai olt0 rurim3oo4al nmnvslt)sDurxrpoo1olenifctldfsDul( s;u4teerif3oytlp   n i t0t2urirpnudom n fvtatf 2taxmoou0alt micild sDraumsnt)aexrxo3iadlmtranei;()truo(m3no4ole lnet t) rtrxmpot4opxo fctldfs ul( p;u4arxnio iydlpDran ils srto(r no4opte fet ()a2urx  oo4tlen iciyslm2eaums ()areoif tytop eai i;t)srtoxmpiy1ol   neia()arrrxroou0oeenmf3iasfmDeau o;t4 reoiocoo1op r nvo (0srto(r iu1alt  ivi sfaDta(  no1tpxnmieiyt m ranmpn(0arenmr to1fpDr nvi t)srxm(mpoudlmtnmfeiatf rra(  no1oexo oetas aDel( o;u0aexnxo ootfmte i sls)tetmxr3oy4om n nvi sfarraur ;o0oleomo3tytlm rmuvs u0trxoif3tydoa r ues;s0teumxo3ou1am e nci sfaDur(mo;u4texnmoetat sDua( p;u4 lxrxo3to1op   i i;(0t2xmxo no4ol e ictasfaDrmumont0tpto oetlsls rlu snu4trxomo3oodoa  aieilt  etmimpny1lm elfvtas)s2ta(r ot0opx iietatlm umn p;u0arxoir ootlpt lueo;(0 rtrio oy1ap nmnvia( a2rrumpot0aee  o3tlsfs2ua(von(0 lxnmfcoydfa ranvsls)srtmim3nodame lfvs s) 2rrxr no1ope mf3tys m uauvsn(0trenmoctydla rau o t)sexoir3oudal nmieias)aDurur no4ope ifciad a2eaumo;u)aeerifcty1lptranvi (0sexoxo3iodol   ivi tfsrrm( pot1tpenifciydls uanmp t0tetoiocoy1oaD aneo;(0 rtrxm nudal nliei (f 2rmx  nu0tlx moetydlaDumuvp;t4teenir ta1fmtr ivilt)t2xm(r3oy4llt mneta()artm(mo;u1olt moetad m2umnmpn(0arxnxrctotopDr i ol(0srxr(o3iu4llen icta()sDumxmp;t1apeoio3ilslmDulnms;t4treriocoa1omD lu s t s2xm(m iu1lmtelnvsls) 2taumoot4tee  octld m ra(ms;(4aeeomf totfpDrai o t s2to(o iu1am e neils)aDuaxm nu4alxo i3ilt aDulnms;u0 ltoio iadfm rau i;(0t2tm(r nu4lp elnes t)srumx  no1optn oeiatfs2ea( s (0trtnmo3iytom  au o;(0s2urim ny4lpt mnvta() rur(moot4oltomictytfs rl(ms;t4trxrmo3iatlmD  u i t0setm(opnodoptnmicias srur(ro;u1alxomo3iydls el(mon(0 etrmr oo1fmtrlivi ()s2xoim3oy4am   fesa(f Draur ;o0oltnmi3tldfm eauvo;(4trtoio3tytfp  aivs;t0 exrir oodopeelies () 2ur(r ;t1tptomoetaslmDrmn o ()trxrxfctatom eaivi;s0trur(opnu4optelicsatfaDraxrono4oexo fciltla2um( p u)arxrirctydoa rlues ()t2ur(m no1op nlnvi (farrrxm nu1tetoiocilt a2uanmp t4treomo3oo1fa   i il(  2umim no4ame  feiat  Dururpnt0aeenmi3tls a2rau o () ltomf3io1lmDrlnvo s) etr(mpiodoptnmfvs ( srtm( pnt0olenmfctyslsDemnmpn(0tetrxf3tydfmDeluesl(0 rtmir iodomtnmfcil(farraurpnt4tlxnii3iat a rln snt4arxnxrctatfaD lu ilt0t2tm(o oy1lp   nvia(  rur( o;o0aetnio3tlsfm2rlu pnt4tetoxr3iadlp   uvilt)setrimpio4op   nvt ( arrrumpoo4tlxo o3iadfa ul( s u)tleomr3iotfp eluvo (0sruoio3oy1lle  fvtatf Dtm(mpnu1olx iictldfmDulnvp;t4tlermf tatoa eai s t0s2um(rpiu1alenlnct s) rtax  ot0ale  f3ildfm rauvsnu0trxnir3iy1optranes;s)t2urirpiy1omt lfci () 2ururpou0tex  oeiatla emnvo t0tleoxr3ootoa rlnvslt) 2toxm iy4om  lfctat s2rmxroou4oetnmieiad sDuauvo;(0 etomo3io1fat  u o;()t2toxm3iudam elivs t s2urxrpno0aptomociadfm2rm( s;u4tetoxo oadfaDe n s s)srtoxr nydoltnmict (fa2rmx pot0aexnifciadfm2rmnmo;(0trxomo iydfate nvsl( s2umxopno4ame  fctas)srurxmpoo1tlen ociyd m emn on(4trxoxf3oy1omDraivs ()s2trirpio1ape  fvsa( a2tr(moot4tpe mo3iltfs umuvs u0 etrxrcoytlp   u i s) rurxr iu4apt  iesas)sDtr( pot0tpe ioeiysfm eaump;(0alenmf oydoaDranei () 2umio io1altnlnetas)a2taxro;o0altn oetas a2ra(mp u)artnmo to1faDelnvolt t2uo(o3oo4lme  icil()a2uaur ;t4oeenmfctatfa ra(vp t)tetoxr io1la eau olt)t2xoir3iodol  lieiat  Dtr( p;t0opx iociadfm2elnmo;u0aexomocty1la r neo;( seurxo3oudlmen fvt t  Dur(m nt4olenmoeilslmDua(mp (4texrxo totlp   u i t trumxopiudop  mfeta()aDtau o;t1olxomfctys a rlumsnt0tltomrcootoa rluvi (0texmimpiy1lp nlnctat srrrx pou1aetnmo3iys aDul(vp;(4artoxo3ootfpteai s;t0texoir ny1lpenlncsat)sDtaur no1aeenmocils m2umu s u)aetnmrcoadlmDrln ols) 2toirpnu4ol   icslsfs2umu p;u4aptomfetasfm rl( o (4 rermrciy1lpt aieils)s2umxmpoo4lm  mfct (f 2rm(r no1apxn iciyd aDran ont0tlxoio tytlmD anvs;s)srxoxm3nu1om  lfes s  rrr(  ot0teto ociadlaDumn sn(4 exnio oytoa rlnesls)tetrxrpnodlptn ieils)arrmumooo0alenmfciyt s um(mpn(4tlenxo3totlpD lu o;s  exoxopnodlmtelicils)aruru pou0tpeniieias m umnmont0aeenircoatfm e i sls) 2xr(o3oy4apeemiciltfs2ur(rp;t0olt mf3tltla2elu s ()tleoxocoydoa e ies (0teumxr ny4ll   nei (  Durxrooo1tltoioeildfs2ran snu)aleomrcto1opt  ivs s0 rxo(rpoo1lptemivil(faDum( ooo4tpe iociydlm uanvonu4tlxniociytfaDelu ols srur(rpiu1lptemnvt tfsrraumpot0tptn oetytla2emnvs;t)arermo ia1latrai o s  2trir oy4lptemivia(  2umxm no1ale mfciytfsDra(vo u0trtomo iadlate nes;(0seurxrpoy4om nmivils) rtr(mpou0alxo fctadls2rauvsn(0tlenmocta1fmteluvo ()t2xm(mpno4lpeelnvi ( aruaxmpno1aeeoiictys m uau s;(0aexrmocio1omt anvsl( t2umxo3nu1omt  fei ()arrr(rpoo1tetoif3iydfa ua(vo (4altoif tydfmDrlueol(0trtrxo ny1ol emnetl( srtm(  nt1aeto f3tyslmDean snt)aetoif to1latrli s;t)t2ur(o3io4opeelnvsat) Drm( oou0aetnmieiatfm2elnvp u0areoxociatoptr ivi;s)s2urxo iydalenmfviltfaDurur ot4optnii3ildls eln onu) etnxocootfpD lnes t0srxmxr nu1lmtnmivsat) Durx o;t0oetnmi3iytlm2uanmp;t)aleomfcootopD lies t0 2xrim3oo4ap nmicsat) rtrum nt0tltnmo3tydfs2rmnmp;u0tlxoio ia1la   i ilt) rto(rpno1ole  ncslt aDrrxr ;o1oleoiiciatfsDua(vpnt0 rxnxfcoa1faDelneo s0teurio3ou1altnmnvi t)sDtm(  ou4tpe ifciaslm rluvsnt4aleoxrciadlat auesl() eum(m iu4am  mnvi t  2tr(  ot0aptomociad a2eaumo u4 exoxo oo1lp rluei;t)seumir3nudlmenmnei t a2taxmont0aet iictytlm ua(von(4artoio iatla   iei s) rxmio3iy1llee fcias s2rrx  nu4tpenifeiatfm rm(mo;u0 rxoxocoatoaD luesls0setm(opoy4lmte nvtl( a2tmxm ;t4aetn ietlt aDelnmo;(0tlxnxfcoytlmt lnvo ( setm(mpno4olt mncia(fsrurxr nt1apxnmfciyt m2emu s u0aeeoxf ootlm   i o (0trxoxo3iudlptelnvsa() 2um(  ;o4aleomieiyd aDelnmp;u0 exrmrcia1fmt  i olt0texo(m3ny1open fetatfsrraxrpou4aex moetytlaDuan snt4arenmfcoydlatr nvi;s)trxoxopiydlme lncias)artm( pou0alenmoeils aDrl(vont0altnir3tadlpDeln i ()t2uriopno4lmtn fctatfs2uauro;o4aleniociltls emnmp;()aexoxf iytlmD lnei;t) ruoxo3ny1omte nvsl(faDrru pou1apxnio3iydfm2emnvo t4 exoxr to1opDeau i;s)texmxr3iudlltnmfcsat arraumo;t4tptomicildla2rm(mo (4tlerxf3ia1fpD  nvs t) rtmxo io4am n fct t sruaxm no4apx io3tat m rl(vs t4teenmrcta1fmt ai sl( trtm(o3io4llt mieiatfsDum(rpou4apx  oeild m2rmums;u4 renxf oa1fpt  i sls  ruoio3ou4optnlfci t)s2umu pnu4opxnmociysfa2elnmo;t4aeeomr3oa1fateli il( trxr(mpoo1lptemivilsf Dra( p;t1oex mf3tltfa2el(vp u)trtomrciodfm rlnei s0teto(opiy4lpt lfvi s a2tr(moot1aexomociysfaDrln ont)tleoxocoydfpt lu o s  etoim3no4op emivs t s2rr(mo;t4aetnii3iadls el(mp u0artrir3oadlateaivi ()s2xmir oudolenmics t)sDra(m ;o4texnmi3iat a2uaumo u0 eermrcta1la e n il( sexr(rpoy4lmeelivslsfsDur(r ;o0ale ifeiltfmDeau snt4trenxfcty1lpDeanvs;() rur(m3iudamt  nvtas)a2trur ;o4tlx  f3iad m2rlnmsnu0aleoircootfmDelueo;(0 ruoimpiy1ll  mies t  2trxmpoo1oex mfcilsfs2ra(vp t)trtrif3io1laDe ivs ( trxoxr3no4lpeemiesatf Dta(rooo1aeto oeiadfs rl( o t)altomr3tytfaDr ueo t  ruoxr ny4amee icsasfarum(mont0aeto f3tas s2eln o t0 ltnifcoa1fptr uvols seuoxrpou4al emnvsa()srua(m ;u1aex  f3tyd s rl( s u0aexrxf oa1fpDeaueolt0srtrxm3iu4lm emncs t sDumumpot0apt mictysfs2eanms () lerxr iodlmDeluvol(  rxoxr iodlp   neslt)aDtaxm ;u4oetnmietyt m2rlnvo;t0 exoiociotopt  u o;t  euo(r iydop nmncia( aDtr(root4teeoioctld mDum(ms (0arenmociotom eln s t sexm(m nydom elnci sfaDtrx pno0oltn ieiyd a2rmn p (4trerxrcoatlpt aivo t)srto(m3no1ol e fei tfs2rrur ou1alxnmo3tasla2um(vo;t) etrmfcto1oa rluei s)s2toxr nodlpeelfct ( srum(  no0tpxn i3tysla ra(vo u)tetnmr3oy1om  lies;t0srtmir oy1aptnmivsltfsrtrxm no4tpeo oetlsfa2rl( s u0 exrmociytlaDrln s (  2xo(o3oo4lme lies ()sDumurpou4aeen fctadfa2rlu s t4teerxf iatlmtranvo (  rxmxmpiudapenmfcil( aDrmxrpoo1tetnifctytlsDuau o;t) renmf totfmDe ivi;( s2um(o nodop n ictlt) 2taurpou4teeniiciydlmDeaums t4tleriocoodfp   uvsl(0 euoimpnydlmtelnvtls  rrm(ro;u0ope  ocilt aDel(ms u4texrifctytfmt li ilt0seurxmpnodameemfvta()a2raxroot1alxnmfeiat m2uluvo;u) lenir3totlpDeaueo;t  2xm(o3oy4op nlfetls a2urumpnu0tex  f3iadlsDrmumsnt0artoifctotomtean ol()tetmir ny4lmen ncils)aDur(ronu1tetoiocild a emuvp t0altoio3iotomt luvo;s) rtm(opoo4lpenmfcslt  rur(rp;u1opt mocils s2elnmpn(0tltrmr3ta1lm rluvol() 2xr(m oodaptelncia() 2umump;t0alt miciysfs rmnvsnt0 etoio3oytlpt aieols0t2toxmpno4am e nctls)sDuauro;o4apenio3ildfm2uanmo t)arxnxf3tadlaDrluvi t) eur(o iy1ll nmfvilsf rrmxr ou0opt  fciadla emnvs t0 renxr oodom r neo t0 rtm(opnydlp e ivilsf Drm(moot0ale  f3tls sDeauvo () renxfcoydlat livsls) ruoimpou1lpe  ieia() 2um(ro;u4olenmfetys sDelumsn(4alxrxr iytfptrlu s;(0 euoir oo1lmenlfct (fs2urxrp;o0tle  f3iad a2um(vp (4aexoxf3to1omD lueolt0s2xmio3ou4om  lfvs (  2uaxronu0aeto o3iysfs2eaumsnt4trtomrctotom r i s;s0teuoxopny1ame  fvt t s2taxrpnt1opt mo3iadlmDrlnmo;t0 rtoif oo1oa e i sls)sexmxr3oo4olt licia(f rumxrpoo0aex ioctydlsDrmnvs;t0aetoxr oadlateaivi;(0 2ur(o oodameemfet sf 2taxmono0tpt ifetadla rluvsn()tetomfcia1opD aieolt teurxm3oo1lpen net ( aDtrx pnt0tlenio3tldlaDrluvonu0tetnifctodfp eln i;t sexr(mpnodoltemivtls)arurx ooo0tpe mf3iytfm2umuvp;t) ltnmfcoatoaDe nvol(  rxr(o3nu4open nesa(  rrr(mpnu1apt ifeiyt sDrm(vp;u4tlxoircoytlp rlneo (0t2tm(opio4op   iviltfarrmxrpno4tltomo3ildfmDrl(mp;u) lxnir3todop ranvi;s  2tmxrpoo4altnmnvtlsfs2raur ou0tle ifciad m2ran p t0aetrifcoytlpt anei s) rtriopou4llee ivt (farrr( oou0tetoif3tlsla uaums u0 rxrxfciatla rlieo;t0t2uoxo iodopt mfciasf 2taump;o1olt moetadfmDuluvon(4texoio3ia1omDraivi s) euoio3oodlpeemici ()a2tm(ront4olx mieilsfmDuanvs;u0altnxocoytlmte u s;t trtrio3iu4lmtemieiat) rta( pnu4oeto feiysfm2emu pnu4alxnxf oytopteanvo;(  2umir oudll nmnvs s)arra(r ot0apen oeiltlm rl(msn(4trtomfcoodop r uvo t teur(r3oydlp e icsl( arrm( oot0oet iietaslsDrmumo t)tltrio iytfmtrlivilt0s2uoxopoudllt  ivi t  Dtruro;t4texn ociad sDea(von(0 rtnmoctydfpDe i o;t0texr(r3oudamtnlncsat s2urx p;t1oex  ociasfm rm(mo;u) etrmrcia1fpt  n s;s)teuoir3oodam nmietlt  2rr(rpno0alxomocildfmDrln o;(4trxrircoatoa rlivs t)teumxm ny4al   nvsatfs2umurpnu1apenmociatla el(vo;u0tlermo iotfp elies;s s2uo(opou1aptnlnvia()srua( pnt4opxomf3iytfaDra(vsnt4arenmocoodopDe i o s) rtmxrpio1ome  nesat)aDuru  no0tet  feiaslsDel( p (4arenif3iydomDranvi t0texrio3ou4aptnlict ( s2umu pnt0apxo ociasfaDrlump u) exoxf3iatfa e n o t0seum(o3iu1amt lieias)sruaxr ;u4tlt  fcilt a emnms;t4aetrxr3tydom  aueo t  exrio3iu4apt  ncsat) Dururoot0olx mf3tatfa uauvp;t0 rermr oodlm raiesl() rumxm oodomte icilt) rra(ronu0aexoifeils s2em(mp ()tlxrmr3tadlmtrlu olt)tetrxr3iodlleemivs tfarurumonu1olxnmoeils s uluvs;u0 rxnmo3oatoptr nei;s0srxmirpnudope mieiat)aDua(rono4opxn oetldfm2elu o;u0trenxf3iadop rai o;s srxoio oy1opeelnvsltf rta(r oo1tee iociasfaDua( pnt)tlxoif tytlmtr nvsls) 2xr(mpoudome  icsasfsrra(rp;t1tptoifeilslsDrauvpnu0alxoxr3iytom raieo s0trurim3io4aptemfvsasfsDrm(rpot0tptnmi3iltfm el( s u0tlenxf iatomDe iei;()seum(m ou1ll nmfcils)aDtaxr no1oltn i3iytfs rmuvo t) rermr3ta1lmt liei s)teum(r3io1ll  mncsas  2uaxmo;o1ope  ieilsfsDrmnms t)texoif3tytfa e iei (0 rxm(rpoo1opeemncilsfarrau poo4alenmi3iaslmDrmuvs t4aexnmfciotlaDr ies t0t2xo(r iu1oltn ieiat  2rmx p;o1tpen icilsfmDuan ont0arenmo3oo1opD au s;() 2xoim3nu4am e ncil(fsDtaxmp;u4tptnmfeiydlsDum( o ()trtomr3io1fm rlnvols trurxo3oodaptnlnciat)sDrru  nt0tleoioetlsfs2ul( o (0aleomr3oy1lpDeaivi;t) rtoxmpou4om  lfeia( aDtrxmp;u4tpxnioetltfm2elnmont0alxrmo oy1lp rlnvi;s texmxm3oy4lme  nvs t aDuauront4olenmi3iytlmDeluvsnu)aeenxf3iy1late ieo;(0t2uoio oy1ope mnetat aDta(ront0tlxnmo3iyt m2rl(vs;u0tlenmf totfpt anvi;(0s2xoir oo1olenlietlt) Durx  nu1tlxnmfetydla elumsnu4alenxf ty1opDelivi;(0s2to(mpiodoptnlfvs t  2umxrp;o4aexnmoctysfm2emn p;u4teenio io1opte u i s0s2xmxr iu4ap  mfvi (f Drmx pou4alxnifctys a rmnms (0tlxrxf tydop ranvs;t) rxr(m ou4opt  ieiasf 2trxmpnu0tpeoifctls sDumumsn()texnxfctytoa   ieilt0trxrio oodlltn ivtls)s2trumooo4olxomo3iydfs uanmp u4aexnxf3ootfaDe n ols  rtmxr3no1lptnlfes () rurum nu1tlxnio3ilsfaDrl( p t0trtrxo iy1lm eln o s)sexoxopou4apee fci s) 2uaur ot0aetn o3tlt aDel(vpnt0tlxrxfcoo1la r u ilt) 2xoirpno1amenlfci () 2urum ;t1oex  iciadlaDem( ont0trxnmfctadom  aneslt) 2xm(opny4amt lfcias sDra( o;o4optn icias m emumont4alerxf tadop eli o ( teurirpoo4ap elfei ( sDrmxro;u1tetnmietydlsDemnvpn()arenio iotlpDeln ilt texmio3oy1ll   ivsl()s2ua( p;t1oet  octyt a ran o t4tltrmo3tatoa  lues s teuoio nudlm  lictasf Dtrxmpoo4tltnio3iadls2ulump t0aetnxo ia1oat  nvil(0 euoxm3nydamenlictasfsrtmx p;t0oleoio3iltfm rm(vo t4 etrxr3iotfp eln s t0s2uoim3iydame licsa( a2tr( ooo0opt mfeiys sDrlnvpnt0arermr iydomtean i (0seuoim io1ope mfvsat) Duaxm ou4tlt  o3tydfm2eauvp t4 eeoiocoy1oaD  ueo ( tetrim oydomtnmiciltfs2uaxmo;t4opt ii3iltla ua( sn() eenmr tadfpDr i i ( tetr(o3nudal   nvilsfsDur(m ;t4tpxomi3tad s2rm(mp t0trxrmocio1oa eauvi;() 2uoir3ny1ll emnct s sDra(mp;t4apt  ietltfsDrln pn() leomr3oy1fpDeai s;()t2uoxr oydole  nvi t)arumxm ;o1ape ii3iysfsDemumo;t0aetrmfcta1lm rluvols0srxrim oy4omtnlfcias sDrmur ;u1aetoiocildfa ulnvsn(4trenmf3to1lm eaies;s0srtoxo iodllen icsat)srrrx  nu4alx ifeiadfm2rln o;() etrxf3oydlpDran s s  2tmxr3oo1ap  mfvtatfsrrmxmono0oeenmfetaslaDuaump;t) lerxo ty1opDr i ilt0trtmim oy4oltn neta( srrm(r ot4tltn ociltlm ulumo u4arxrir3oy1lpD  nesl(0texr(opoy1lp  mietls)arum( o;o4tpeoiicilsfa2ua(mo;()arenmrciadfm  lnvil(0srtmxopno4lpe liesat a2rrxm nt0tpxomietytfm2uln ont0 rtomo3oytfaD  u o;t  rtmxr3oodolt  nes () ruaxmpoo1tlx ifciysfs2ulnvo;() lxrio iodlate u sls0teur(mpiu4altnlfciasfsDur(m nu0tlxn o3iyd mDeanvpnt) rtrxrcty1fmt  nvils srxm(opnydomee fvta( aruaumo;t4aptoiictyd a rm(vp;u) eeoirctytlpD aivo;( srtmir no1lpte fcias  2rax p;o4opxniiciyd s2rmu p ()treoxocoatlmtrlu ols0srxmim3io4alte nct tfaruax  ;t4aee iieiyslmDumnvo;(0teermocio1lmtr ivi t0srto(opoydlmtnmnvt ( arur(m ;t4tet miciadla2rau o (4areomf iy1lm e n s t t2uo(r oo4alenlics t s2trxrp;o0alen i3ildlaDea( snu4alxrmfctytfmt ai s t srumio3no1lmee fcilsfa2rmx ono1apx ioctlslaDra(mo ()aetrxrcoadopDraueils0sexmimpou1amtnlfvtl() rrmxr oo0tetnmfetlsfm ran o (0aetrmf oadopDe n i;(0s2xmio3oo1olt lfvsls  Draxmoot4tleoiieiys m elnmonu0 rxnxrcta1fmtrln ils) etrxo3iy4lptelivtlt)a2urx o;u4tpenifciasla elnvs ()tltnmf totlpt  i i;( s2xoxopiodllee ivsa() rtrxmpoo4alxoif3tydfa ea(mont4 leoxr tadlatean i;s0 2uoxo ou1optelnctat  rtrxmpno4ape iiciysfmDrm(vo;u4tltoxo ia1la elneils0trxoxm iu1ape lfeiatfa2umx  oo4tlxoiociatla umnmp t4alxrmr oatoaD  uvslt0trxr(m3ny1olt mnesa(  rrm(rpnt0oet  icild s ul(mpnu) rerio oo1omDr nei;()s2uo(r3nu4omenmnei ()aDumur nu4altoiictyslaDuanvsnt4tlxnmf3oydopDrai ol(0 exmxr iy4lmtnmietl( sDua(ront1alx  ieilt s2rmu p u0aleomr tadoa rlneo ()texm(mpiudapt  ivil(  rrrxrp;u1apxomoctysls2rl( p (4tltoio3oa1lp  livi;t0seto(m3ou1olt lnes t  Dtruro;t0alxnifciadfsDemnmpnt4 reoxr3tytlm   nvi t0 exoim nydlmtn nvtl()arraxmpnu1olxn ieiysfa rmuvo;t4arenmf oydfaDeaieo s0 exoim3oy4alee feias) rrm(r nt4oetnmociyd a2ea(ms;t0 etoxrcoatlpDrauei s0 2xr(mpiy1lltn neiasfarrrurpno4oetn ictld mDrmnvonu)arxnxf3oytlatrlu i s sexmxo3iu1alee iesl(  Dta(  nu4aeen f3ilt a el(vo;t0alxnmf3iydfm r iei;t)trtm(opoydlm nlict tfsDuau oou0apeoifetadfm2rl(mo u4 ltoircoodop   ieilt srxm(mpou4al eliviat sDtrxro;t4teenmoetltla2ranms;t4 rtnxfctadfa rlneo (0trurio3io1ap nlivsatfartmump;u4tpx if3tldla2emn s t4alxoio3iatlaDr ueo t0 rum(o3iudomt lfesa() Drru  ;o1alt ioeiydfs emumo t0 ltnir3tytfa e u ol()srur(m3oo1altelfcsas)a2uru pot0olt mf3iat aDemnmsnt)areoxfcoytlaDe uvi ( trtoxmpny1amte ieia()artr(moot0olt  i3iatfsDem(ms;(4areoxo iatla r i i (  2umim nu4lptn ivs s)artax p;o4altn o3ilslm emn ont0 eenxf tydfp eaies;()t2trio ou4lpee ies (farrmxr no4oetnmictatla2ua(mp ()trxomociatoptr i s;( tetoxm3oo4ap elfvt sfaDtaxm ;u0texnmfetasfm2rl(mp;u0 reomo tatlaDeln s;t texoir nodom nlnviasf Dum(  ou1alenii3iytfm2rl(vo t0tleriocto1om r nvslt  2tm(r3no4ap  mnei s)a2umx o;o1alxo ietldfm ua(msnt4alenmfcoodla   nvs ()teumxm oodlme  ivsl(fsDumxm nu4texo feiatfmDumnvs u4artoiocoa1lpte nvsl(0t2xmxopoy4ol emnvtat)srrmxrpnt4tex mf3iyd s um( snt) lxnmo iadfpt aues;()s2um(o3oy4lp  mneia() rumum ;t0tet  oeildfa2rmu s u0 rxoxo iodfm r u s t)s2uoxm ny4al  lietat)srur(rp;t0opxnmociat aDelnmp;t0 lxomrcty1la  lu o;(  exmio3iydlmenliesa() Dtruroou0apxoifciysfs2elnmont4trtomrctadlp  au ils)trtrxm3oydlpte iviat)sDuru o;o1tltnifcias a2emuvp;t4teenmoctytomteliei;t0tetm(m iu4lmt mfvt ()artaxro;t1aexnii3iysla2umnvo u)teenif3ty1omDraieo (0t2urimpoodom emies (f 2um(  ;u0aexnmoetldfaDulnvs (4 etnio io1op eauvolt)trumxm3ou4open nesa()srtmu  ot0oltnifeias m ulnvp;u4tlxrmf oo1fmtr iei;( sruoxo iy4al emncsat  Dtmu  no0texniociyt s2rmu s u)tltrmr ta1oaDe uvs;s) 2toio3oudaptemfvtatfa2rr(roou1tlx  ociltfs2elnvpn(4trenxo3iytomtrlivil()srxoxopno1om n fetltfa2urxr ;o4tee mociad aDem(mo;t0treoxfciy1fa r nvslt)t2tr(r3iy1lm emfcil(  rrm(m nt0oexn octysla2eln sn(0teerio iytoat auvs;s)trxm(o oo1amtelivt t)aDtm( p;t0ope moeiytls2rl(von(0altnmf oy1fpt lnvs s0sexoio3no1lp emfetls a2rm(r ;t4tlt ioctaslsDea(msnt4 rermfcoa1fmtranvols  2urim3io1lltelfeiat  rrax poo0ale  feiys a2eln p;(0altoifcto1fmtraivo;t0s2trxrpoodll nmics t)aDrrxr ;o4tpenio3tytfa ean p u0aexrmo3tytoaD lieo s teumxm io4ll  mfvsl(fsDur(  ot1tetnmfctldfm2em(mo u)treoxfciy1oaDr nesls  2tm(o oy4lle liesat)aDrmum nu0tpto ietydlm2eluvon(0tlenio ootla eau i;t truoxrpny1ome  fvil( srtrxr ;o4tltn ietatfs2ra(mo (0alxnirciodoa  li slt)trxoim3oy1lptnmncil(fsDtr(root0teenmocilsfm2rlump u4aetrxfciodoat  uvi;s  2xmxr iu1omenmfvt tfartrumpnt4aex mieiydfm2umumonu0altrio oytfp  anvsl(0 exmxr3io4llee netls)s2tmxm oo1tetnio3ils s rm(msnt4 lermr3oytlm   nvilt setoxo ou1ame lnvil( arum(mooo0tpx  ociys s rluvo;(0 ltnir3iadlpte ies;() rumxm ny1oltelnet ( aDrrumpno4apxnif3ils aDrau onu0tetoxo iydoa r ivo s)trtrxm3nodape mfesa()sDurxm oo4ale  oeias s2uanmo;t4texnmr iytfptrluei;t0tetmxrpoodameemictl()arumumo;u0apt mocias a elump;() lxnircootla  aueo;() etmir oy1al   fcsl()aDrm(rp;o1opeomictytls2rln p;(4trxrmr3oy1omD livi t seurxo ou1am  mnciat aDrmxmo;o0tex  fciatla rmuvpn(4tltnxr3oy1la  an s ()trumio oodap emictas) 2tau onu4tptn oetas a rlnmpnt) leoxr3oydlpDrauvo s0 etrir3iu1amtnlicsatfartruroot4oltnmociadfm2emnmpnt0tltoxo oo1omt  ivolt)tetmxr3nu1amt mnvilsf rtrxmpno4oee  o3ilsfaDuaumo;() leomrcia1fateanes s  rtmir3ny1lltnmfvsa()aDrmur nt4apeniiciatlmDra(vpn(0tleoir todlm   nei s) exr(opnu1om nlfciltf 2tau  ;u0aetoiictltfm2em( s;t)tlenio oytfmDeli s s) eurxr3ou1opeelnvs sfs2trurp;u0altnmiciat s em(vo (4texnmr3oa1op r nvslt)srxr(rpoudllenlnei t arrm(ro;o0apxn ieiydfa2umnmpn(0 exrxr3todoatr uvo s srtoxo3oydap e iesltfsrumxmpou1teen ociltfmDulu s;(4 rerxoctadfat  u ol() 2xmxo3ou1amenmieiltfsrumx p;u4oet moeilsfs rm( onu) lxrio3oa1fm  luvi t0 eum(rpiy1opeelicils srumu oot0tlt  ociytls2raumonu4aexnif3oatoa rlueo t0seum(r oodopee netlt) rta( poo1oetoiieiasfsDrlump t0artrmfciadfmtrai sl( s2umxm iy1al   nvi t)srra(r oo1tpxoiiciadfa ul(vsnt4tetomr3io1late ivs;t teuo(o3iu4olt  fctls) Dtmur ot1olx ifeiltlm2ul(ms t)trtnxr3io1fp eaivs;s0 exoir nodlp  mfcias)s2trumono0alx mocilsla rm(msnt4aeeomf oytla elieol(0srurxrpoudomtn ncslsf 2rrurooo1tetnif3tatls em(ms t4texomrciydlmteai o;t)t2xoio oy1al n ics t srrmuroot4tpxoif3tas aDel( s;(4trxrio3iytfpDraueols  eum(r3oy4lltnlfvs t  rtaxm ot4opxn fetat mDeanvont4aeerircty1latelieilt0sexrirpnydoltnlics (  Dta(m oo0alx ioeild mDeau pnu4 eenir to1fmDrlies;s) 2xmxmpny4opt  ics t aDumu  ot1tlxn o3tlsfm2rlu p t) rtrmo iydfa eauvslt  ruo(o oo4omte neilsf rtmx ono0tlxniociys aDumn ont4treoiociy1fp  an o ()srtr(mpno1ameemieia(f 2tm(m ;u4oltoio3tadlmDuauvo t) rtomrciodfatr uvo;t0 etrxo3nu4apt micsa( srtmxm ot1aexoiietytls eanms u4 rtomo3todfm   u s s0seumir3ny4aleemivilsfartrumoou0opto feildfs2um(vp t4tltoxrcoatfaDrai o (0 2to(r iodoptnlicia(faDtrxmpno4apxo feiyd a2umn s;u0trxrxf3ia1om  ai i;s teumirpoo1omeelietlt  2uaum oo0aet iictatfm2uluvs u0arxnir3tydfmtrau i t0seto(r io1lmtnlici s a2rrump;u0tpx mfciydlaDumuvs;t4alenmr3iadlmtr u sl() rtmir iy4olee nvi ( aDumx pnu1optn ieiasfm2emnmp;(4 renmr oydfp  lnvo s0srtmxm iydopt  iviat  2rau  ot1tltnmoeiydfs2emn p;(0trenif iadfat  i o;( t2toiopny1lmtn icsa(fsrum(rpno4apxnifetytfmDrmnvo u0tltnif tydlm raivsls)t2urir nu1omtelfcsasfartm(m ;u4opxnioeiadfa umumpnt4 rxrmo tadlatrlnvsls) 2umim nu4op n nvsas)s2trumont1olxomiciytfa2umuvont0 rxrmfciadfaD li s;( s2tm(m nudlmt lies ()aDtm(m nt1tet iicildfmDea( ont) rxriocto1fpteaieol()s2toir3io1amt lnesat) rta(mpot4alto o3iadlmDel(vs;(4aetomo iydopDrli sls) ruoxo3iudalenlncslsf Dumu o;u1tptoif3ildfm emnvonu0 rxnio oy1oat lneilt)trtr(r oydome licta( srtr( pou0aeeomi3iatlaDulu s t0areomo3tytfpt  nei s0t2uoxo nydapenlfvs ()aDtm(r ot4tet  feildls2emums;t)teerxfcoodlatelieil( trtmim3ou4ol nlncsasfaDrruronu1aptomo3tldls2ea(mpnu0trtoir3tatfaD auvs;() rumxr oy1amtemivsl()aDtaxr ot4olen fctysfa uan s (4trxrir oadfmteanvi ( t2tr(m iodapenlncsltfs2uau  ot1apx mfcilt aDumn snu4 lenmo3tadla   u o t teuoxopiudlme mncils)srra( p;t0oex ii3iydls ul(mon(4trerio iodom   neilt0 rtmxr oudapt mietls  Drmxr ot1aeeo f3tyslm2rl( on() rxnxocto1lm  aueols)srtrxr iodaleelnesl(  2tm( pnt4tlxo fetyslsDrauvpnt)aeenxr oa1faD livo () 2tmxr iudameelies () rtaxronu1olxnii3taslm ulump;t0 rtrmo totlm r ueo (0trxrimpio4amtelivs sfa2ra(  oo1olxnifetls m eanvont0treoxociytoaDelneol() rxoxm oudlmee nvias aDrmxm oo0tlxn i3iyslm2rmumpnt4texomrctadoptrauvol(  rtmir3oudapeemfcta() 2taumooo4aeeo f3tltfaDemu pn()alxnmr3iytlpD  n s;s  rxrir oydoptnlietl()srumx  oo4ope  ieiatfs ra( o;u) ltnir oydoatr ivslt0s2xmimpiudlm   nctat  2uau  nu0apenifeiys s uau on(4 renmf iytfp  aies;s s2trim iy4omenlict t s2urum ;u1teenifeils m2uan o u0trerxoctytlatr i i () ruoxrpnu4lmt lnctl()srumxm no0olxo i3tytfs2emumo u0trenmf todfatrlivs s  exoxr3iu1ap  mfes t)artrum oo4aexnmietadfs2ra(vo;() lermfcootfa elues s  etrxo3iudamte ivtasf rtr( poo4alxoif3tat m emn p t) ltrmrciodfat luvolt)trum(rpnudope mict s) rrrxmo;o0aet  feild a ua(ms;u)alxomrciatlp  au s t) 2xmimpnudllte ictl(fs2umumo;t4alt  oetldfa2ua(msnu4 rxoif3ta1lptr i s;t0t2toxopiudlpen feiasfs2rrumpou4aex  oeildfa2umn snt)tlxrxr3oatoa e nes s  etmxo3oo4omtnmnct t sDtm(m oo1aleo o3tytfm rlu pnu) lermo oatla  au sl()trtr(mpnydome  fetl( srrm(r ou4tex  iciad sDumumo u4altrif3oatfmDeau sl()teurio3nydoptemict (  2trxro;t4tlt ii3ilt a2umn o;() lerxo totoa elies;s0t2xo(o3iydop n nei t arum( ono0apxoio3iysla2umu p;u)alenxr oy1fm ranes t) eto(opiy4omtelfciat  rra(mo;u1oltomociys s2ran s;u4trxrmo3oy1faDranei (0 2triopnodomt  fci tfa2trum ou0apxnifeilt a umu pnt)aleoxf todlpDe n i;s0 2toir oy1ll nmnvs (f rtau p;o0oltoioeildfm2el(vsn(0 eeoxfciydfmDe ies;t t2tm(m3iy4openlici t sDrr(rono1tpxoif3ias a ranmsnt0 ltomfcoatfatr i o;s0 rxmxm oo4ll n ies (fsrtrxr no0oetnioctld mDem( o;()alxrxf3ia1oaDr i i;t)t2um(m ny4om elivsat  Dumx p;u4oexnmfcilt s2uluvsnu4aetrxf ty1oatraues t)seurim3no1ap  micsa(  2trum nt4oet  ietyt a uanvo;(0tlxrxf iodlpD lu o;s srum(m oo4aptnlfetls)srtr( o;o1tleomocils aDrm(vsnu4trtnmf3totfpD  ivil() 2xrxmpiydoltelfetl()srrmxmo;t4oeeoii3iydla uluvs;u) reomo tydfpDelnes;s)trtmxrpno4amen ies s a2rm(rp;u0opxo iciadls2ranmpn(4 etoif iytlat li i;s0trtm(r3iydlm  mict tf Dum(r no0oexo feild mDrmu snt0aetrir oytlat  ieo;s0seurxm nu4aptelnes t  Dua(mpou4olt mieild m el( o u4aetomr3ta1oaD lnvols  rumxo3oydlpeemivt t) rtaumont1aet ifciyd s ranvpn(4tetrxr tatopt lneo;t0srtoim no4om e fvi ( srrmuroou0opt mfeildls2rmnms u4 eenir3tydom  luvo t)teum(r io4amtelfvt (  Dumxrooo0aetoio3iasfsDuln on(0aeenmrcio1lmDeluvilt trtriopio4olt mictlt arumxmo;u1altnmoctytfs2el(ms;(0 rtnir oatfa rln sl() 2umxrpiudamen fcsl(fsDua(rp;t4tlt if3tydfmDranvp (0 renir3tydlmD  ivo (0seur(opny1alt mici ( sruaxr ;u4aetnifciat s2eauvo;(4teenio3ty1lpDeln sl()srxmio ou1lmee fvil()sDuau poo1tlxomfeilt a2umuvs ()trerxf oatla  ai sls)s2toim3iodaltn fctas arta( pou0oltomietldlm2rmnvo;u4artrmo3tydfp eluvo ( teur(mpoydlp  lnes t aDraxr nt1aexnio3iatlaDuluvo;u) lxoxo3ootlm raiei;t)trurirpiydllt mnvs s)aDuax  ou1tleo ieilt aDra(vsn(4treoxf iodomteauvslt)teurxr nu1aptemfcsa() 2trxro;t0aleo fcilt m rmuvo;(0 exomo oa1lptelivs;t  rtoxopou4om elfcia() rrmxm ;u0tpenmoeias m ul(ms;t0aexoxr todom e u i;(  etoxr oydoleelnes sfsDua(r nu0oexomoctls aDemnmo t4 exrxo iadomDrauvils0s2xr(r3oy1apeemfvs s) Duaumpno1aexomf3iysfs2rlumsnu0trenif iotlmt anvs ( t2tmirpny1lm nlnvta() 2tax o;o4tltomi3tytla2ulnmo u)teerif oodoa  lu s;(0t2xmir3oodam nmicil( sDtrxrpoo1alx mfeias aDum( s u) eerif oydlatelneo;()s2tr(o oo1llt  fesls) rtaurpou0ale ifcils sDel(mo u)artrxo oadlm rln s;t  2tmxmpio4lp nmivtasfsDrrxmpnt1ape mo3iytfm2rmnmont) eenxrcoadfpt  nvo s)srxr(m nudom n iviat aDra(m no0aeen ietys s2emump u4tleoif oydop eluei t t2xmir3io4ol  lnct s srumu  ot0aee mieiydlaDrln p u0alxrxo to1omtelivo t  rur(r3iu1ll  mnes t) 2tmu ooo1apenifciad a eanvp;()aexoifciydlpD livs t) 2urio nydapt lfcilt)s2rr(moou1oexomociysfs rm(mo;t)trtnxf iytlat li o s s2xoir3iydoltn nvtl()aDum(  ;t0aet mo3iltlmDrmuvs;t0 reoxr tadlmDe i i ()seur(m no1ll   icta() rra(ront4aeen i3ildlm2uln p;() rxnif3oatomt  nvo;s)s2tr(m ny4optnmfvtat aDur(mpno4oee iociadlaDumnvo u0 reoif3iydfat anvs;t0 2tm(opoydopt mneia()srum(  ou1tptn ictydlm eau o;u4aexoxr todfateaivo t)t2umxr nu1alt livs t) Drm( oou1opeomfeildlm rlnmp;u4alenxr3todoa  an i ( trxr(o3io1omt mfcs t  Dtmxm ;o4oltomocilslm ul(vs () lxrxr ta1opD li s s trxmxm3nudlp nlfvt ( aDur( oou4aptnioctytfs2ra(mp t4 exrxocto1opteanei;(0 rurxm3nodap e neias sDtr(m ot4apt ifctlt s2uanvp t)trtnxrcia1fmtelneol( tetoirpiodoltemnviltfa2ta( pnt0alt mf3tadfaDrauvs;(4 leoxfctydfpD  nvs;s)s2toxr iydame liei s artmuroou4aleomieiasfs ea( p;(4 leoxf oy1lmte u ils  euoxm3io1op nmfcils)a2umxroou0tpt mfciad mDrmnvo;(4texoifciodoatr ueo (0texoim3nydol  mnvs (  rua( oot0alenmf3iytfs rmnvs u)treomrcio1omD livslt)s2xo(m iydom n fcsasfarrrxm ot1ole ii3ildlsDeanvo t4aetoircty1optrlues s setm(o nydoptemfcias srua(mpoo1oet mfeilslmDea( s;t0 exrircia1fmtraivils) rtrir3iudamte nvils  Drmxm ;t0aetnmfctasfaDeanvp t0 lerxf oa1laDraueo;(0 rtmxrpiy4ape lnciasfs2rm( ooo0aetn f3iat a2ul(mpnt4aeenxf3oadfmDe u sls0t2ur(r3no4lmtemnct s arrrxrpot4ole ifciydfaDrluvpn()aetnmf3oatfa rauvolt t2xr(r3nu4aptn fvs sf 2raxmooo0opeomocilsfaDemnvp u4trerxr oydop raueo;() ruoxm3iy1amenmicilt a2rax ono0oleomoeiat mDrl( onu)tleomr3tydfa  liei s  rumiopiydolen nvtlsfaDumur ;t0tetomiciadlaDumnvs;u) exrxfciotlmt au i;t trxoio oy4olenlnet t)aDtaurpnu0olt iictltlaDelnmo t0aexnircoa1fm  lues s) eum(r nu4ope  nviltfartaxr ;o0oex miciad a2rlnmonu) lerir3totlptrauvols)t2tm(mpnu1alenmfcs (f rua(mo;u1texn i3tatlmDrm(mo;u4 rtrxrctodomte nes;() 2to(m3ny4apee feilt)aDrrxm no4aex  ictasfmDemumo (4 rtrmf ty1la r nvs t  exm(mpnydaptnmfeias  Duaumo;t0openmo3ias aDulumont)tleoxfcoatop eai ilt)t2tmio nydlp e iesatfaDurx o;o4olto oeiatfm rln p;()treomrciatop r u i;s)s2tmxo nydoltn fviatfsrum(monu0tpe mf3iasfsDran p (0alxoif3ty1lpD  nei ()setrxmpoydamtn iesat)sDtax pno0alenifeils a2umumont4tetoio iodfpD  nesls)srxo(opny4altelfvsl() Dra(mooo1aexoio3ilsfs rl( p u) lxrif iytfaDranvo (0 etrxm3iodoleelieia()aDra(rpot4aetomo3iadfa2eanvont0 rtrmr ia1lm r uesls srumio iy1omt micia(fs2taxr nt1alt ioeiadls uau p;u4trtomr oa1fatr nvi ( texr(mpnu4lptnmicsat)aDtmumpnu1ope  octltfm uanvp;u0 reoxo3io1op r i slt0texoxo ou1openmnesa(fsrrm(moou4aptoifetadla2uanvp u)tltrxr ootopD lnvo s tetmiopnodomtelivtatfsrtmum oo4aeen o3tydfaDea(mon(0 leoio3oodfpteai o t  etoim3oy1lmt lneias)s2rrxmont4apx ioeildfm emump t0texnxfcto1laDeauvi s0texoxm no4olenlivia(  Durxr nu1tee iiciadfm2ua(vsn(0teeomr3ia1fp elneo;s)seumir iy4ome  nvils aDtmu  ot4tpt ioctydfs2ean ont) leomo ootlpt lu s t  euriopiydal elivtlsf Dtrur ;o0opt mfciysls2ul(vo t)alenxo3ta1lm rlnvils0sruoir ny4am e fvslsfaruru pnu4teeoii3tldfs umnvont) exomo3totlp rln o ( s2toir3ny4lmt  nctltfaDtaumpou1ope  octad a2ra( pnt4 rtomrcia1omtr ueo t teurir3ny1apt lfei ()srtru p;u1oet  ieiasfa rm(vo;u0 lenio oa1fp rli sl(0 rxm(m3io4omt  nctl(fa2taxmpot4oexo i3ildlm2el( sn() renmr3iatfmte uesls0trxrirpiy4am emicta()aruaurpnu4ole ii3ilsfa uluvpn() eerif tatfp  au o;( truo(m3iu4am nlfei (fsDuaumpou1oeeomi3ilslmDumums t4arerxf3oytom rlivo;s0seurxmpou4ol nmfcsa( aDrm(rp;u1aet iieiyt s emuvs t4 rxomf3iadfm r u ols  rto(rpio4ol nmnes s)a2tm(mooo4apt mf3iyd mDel(mo;u0aexnxf3todlm  au slt  2urim3nu4lpe micslsfs2ra(m nu4apx ioetlsls2emnmont)tltrmoctodlm  livi;s tetrirpiu1lmee nvsas) rrmu  ou4alx ioeiat sDulu p (0altnircto1fa   ues s) 2trxmpno1lmtelicsl(fa2urur ;o4aexn fcias s2ranvpn(4alxoxf3iadlaDr uvi t  exo(opoo1ol  lfvtlt  2ur(rono4aexnmoeild a ra(msnt0tleoio3iytoat auvo t0srto(r3nudlmte ivta()sDur(ro;u0tpen feils s2uauvonu0trxomr3oy1om  an i;t  2toiopnudal n fcilsfartmur ;t0oex mo3tls aDua( pn(0tleomf oatomDe nvslt)t2um(m iu4ol   ivtls artmxrpnu0alenmoctat a2umuvo t0 rtnmr3todopDr nvi t truoim nodllt lnet () Dtm( p;u4olenii3iyt aDrl(monu) rtnmfcia1late ieo s0 exmimpio4lm  micilt) Dtm(  ot4oeeoiictltlmDumu p ()aexrif3iadop e u slt)setoxm3iu1ale lict (faDurx ono1apxnmiciadfs2raumpnt)trtnxo3tydfa r uesl()s2umxr3io1aptn fesasfs2taum nu4tet  oeiyd sDrl(vs;(0 rtoxr3tytfpt  uvs s0t2uo(opnu1lm  mivia(f 2um(mpoo1tetomictys aDem(vp;u0trermr oy1lmDeau s t0 eto(r3ny1lm e fesat  Drr(mpnt4oetn ieils a uanvsn(0arxrmr oo1opD lieo t0 rto(opnudal   fvsas)aDrax p;u4teenmi3ilsfm ean s u4 rxrmr oodlpD an o s0srumxr ny4amenmnvt (  rta(mpnt1altoifciadfm2rmumsnu0texoif tatop r uvi;s) rtrxo oudole lictatfaDua(mp;o1tltomoeiatfm rmu p;u0 rtomf3oadla r ivs;t s2uoio oydllenlieil(fs2ra(mpot0apt ifcilt sDraums;() rermo iotla ran o ( seuoir nudamtelict ( artrx o;u4open f3tad m el(ms u)alenir tatfpDean ils)s2urirpnudol elfes ()s2rrumpnu4aet moetadla emnvo t4artrmf tydomDrluvo t0 rxoio3no4ape mfei t  Drm( o;o0olto o3iadfs rmuvp;t4trermo oytlat aieo () eum(mpou1amenmneil(  2rmu  ;t4tpe  f3iatfsDulu o t)tleoir iatfm ran i s)trumxopno1alee ivsas)aDrmu  oo1aee  ocildlmDran p;(0 exoifcio1opDrai o;()srtoio oo1lmte feils  Draumpou4oeeomoetls mDum( snu) etnmfciatfmD anes;s0srum(m iu1op  lnvs ( arrru poo4tpt  fctlslaDemuvo;(4arxoxfcia1omDr nei t trumio ny4ap  mnetatfs2raurp;t4tpenifeiatfsDrl(vpn(4aexoxo iotfp   uvi;t  rxoxr nodam  lnesl()s2rmu o;t1oee mfetasfa2em(vp (0aexnif iotomtr nei s trum(opou4altnmiei tf rtr(rpoo1tle ii3iysls rlums;(4texnmo3tytom  ai s t) rurxr iodlleemfes ( s2ta(rpno1alxn i3tld s2um(vo;t0 ltrmf3iotlmDe uvs;(0 rur(mpiydllt mnvil(fsDraxmoot0apeoii3iad sDem( pnu) rtomrctytlpt  ivi s)trtoxmpiu4al   fct t  rur(rpoo4oexn f3iat s2uln p;u0 eermocoadfp  anes;t)seumimpiudal elfvs s srrrx  nt0oleomfctltla2emumont)aeermrcoy1laDraneslt  exoxr io1lpt lfet tfarrmuroot1tptomi3iys aDrm(vpn(0tlxrmr tadoat aiei t0 rto(m nu4olt  nesa() Drau pou1tleo oetlt s uluvpnu)tetnif3oadoaDe ueols s2umio nydapenlfetas)sDta(m oo4oeen i3iydlsDrlnvp () reoxo iotfaDr i i (0s2trxo oy1op  lfei s aDtr(m ou0ape  feildfs2ran s;t) rxrif iadlpDrlu i;t  rxoim3ny1omee fesa() 2urumonu0optnmiciaslmDeau p (4texoxr iotfpDeaivi ( t2xr(mpnudap e ivs ()srururp;o1tlx iicild sDrlnms;u0 rtrxfcto1fp  lu ols s2trim3oy1olenmfcslsf 2ta(rooo4aetomoetytla2raums t4 ltrxrcoy1op rai i;s s2xm(r3iu1olt livtls srrmx oou1optoioeilsls uanvp t)aeermf oodoaDeaneolt trtmxopoo4amtemncilt a2urxmpnu1aee iieiltfm ulu s;u4 rermr iodoptrluvslt0 2xo(rpou1ale  nct t)sDtmur ;u4apx  icils m rmnmo (4teenxo3tydfptelu i;t t2trio3oy4altelfciasfs2rau poo1tpe  oeiatfa rau o ()trxnxfcty1lmtelivo s)sruriopou4apteliesa(  2ra(r no0alx ii3iysfa uaump;t4trxomf3totla r neil()srxmxmpou4amtnmici sf Dtax ooo1alxn feiadlaDulnvon(4 lenmrcoadfatelnes;s0t2urim nu4lpe mfeia(farrmum ;o0opto f3iltla emnvp;t)aeeoio3oo1oaDrlu i;s)texm(r ny1lmte feta(  rrmu p;u0tlt mfeiys aDrm( s;() lenmr3oo1fa e ivol() rumir ou4lmeemiet (fsrtaxmp;u0alxo oeiasfa2el( o (4alxoir3iydlmDe ivi;t) 2tmiopny1olte feils)aDum(mpot4alxo ictld m rl(vo t4artnif3oa1optelieilt0s2xmxrpiy1lmen ies t)srra(rpot0tltn ociydfm elump t4 eeomr oa1fatran s;s sexr(rpiydoptnmfcta(fa2trum ot1oltnmoeiys a2raumsn()aexrmo oydopDeaivi t)trxrxmpou1ale  ivia(f Drm(mp;u1apxo octlt a el(ms (4aeeoxo3ia1oaDranvolt)srto(mpnudop n ies t sDur(mont0tpxnio3iadla eau pn(4aetrxfctytlmt  u ils s2xriopno1altemfcs (  rumurpnu4apeoioctydla emuvs;(0tetrif3iytom  anesls) rtr(rpiu4aptemnet tf rurumoou0opeo o3iyt s2uau s;t0 rxnir3iydlpt aiei;( s2umir oydlmt mies t) 2ua( pnt1teeo iciytfs ua(mo (4 lxoio oodlmtrluei t0 2uoxm3io1ll  mnvtlt  rrrxmpot4aet  o3iysfsDem(ms u) ltoxrctodlmtean o;t tetm(m3iu4amt lnvtatf rurur ;u0texn i3tysfm um( s u4tlxnxrcty1faDrli i;( s2trir3no1opte fet t  rtm(roou4aee  fetyd sDeau p u4tltrio3tadfmtrluvo;t)srtri
\ No newline at end of file